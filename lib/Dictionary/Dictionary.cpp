@@ -0,0 +1,333 @@
+#include "Dictionary.h"
+
+#include <InflateReader.h>
+#include <Logging.h>
+#include <Memory.h>
+#include <Serialization.h>
+#include <Utf8.h>
+
+#include <cstring>
+
+#include "Epub/hyphenation/HyphenationCommon.h"
+
+namespace {
+constexpr char MAGIC[4] = {'C', 'P', 'D', 'C'};
+constexpr uint8_t VERSION = 1;
+// Bounds on what a lookup will allocate, well above what the converter writes
+constexpr uint32_t MAX_SPARSE_BYTES = 96 * 1024;
+constexpr uint32_t MAX_PAGE_BYTES = 0xFFFF;
+constexpr uint32_t MAX_BLOCK_BYTES = 72 * 1024;
+
+#pragma pack(push, 1)
+struct Header {
+  char magic[4];
+  uint8_t version;
+  uint8_t flags;
+  uint16_t pageEntries;
+  uint32_t entryCount;
+  uint32_t pageCount;
+  uint32_t sparseOffset;
+  uint32_t sparseBytes;
+  uint32_t indexOffset;
+  uint32_t blocksOffset;
+  uint32_t blocksBytes;
+};
+#pragma pack(pop)
+static_assert(sizeof(Header) == 36, "Header layout must match scripts/convert_dictionary.py");
+
+uint32_t readU32(const uint8_t* p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint16_t readU16(const uint8_t* p) {
+  uint16_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+int compareKey(const uint8_t* stored, const size_t storedLen, const std::string& key) {
+  const int c = memcmp(stored, key.data(), std::min(storedLen, key.size()));
+  if (c != 0) return c;
+  return storedLen < key.size() ? -1 : (storedLen > key.size() ? 1 : 0);
+}
+
+// Word with surrounding punctuation (quotes, brackets, commas...) removed
+std::string trimPunctuation(const std::string& word) {
+  std::vector<CodepointInfo> cps = collectCodepoints(word);
+  size_t first = 0;
+  size_t last = cps.size();
+  while (first < last && isPunctuation(cps[first].value)) first++;
+  while (last > first && isPunctuation(cps[last - 1].value)) last--;
+  if (first == last) return "";
+  const size_t start = cps[first].byteOffset;
+  const size_t end = last < cps.size() ? cps[last].byteOffset : word.size();
+  return word.substr(start, end - start);
+}
+}  // namespace
+
+std::string Dictionary::foldKey(const std::string& word) {
+  std::string key;
+  key.reserve(word.size());
+  const auto* p = reinterpret_cast<const unsigned char*>(word.c_str());
+  while (const uint32_t raw = utf8NextCodepoint(&p)) {
+    uint32_t cp = raw;
+    if (cp == 0x00AD) continue;
+    if (cp == 0x2018 || cp == 0x2019 || cp == 0x02BC) cp = '\'';
+    if (cp == ' ' || cp == '\t' || cp == '\n' || cp == '\r' || cp == 0x00A0) {
+      if (!key.empty() && key.back() != ' ') key += ' ';
+      continue;
+    }
+    utf8AppendCodepoint(toLowerCyrillic(toLowerLatin(cp)), key);
+  }
+  if (!key.empty() && key.back() == ' ') key.pop_back();
+  return key;
+}
+
+bool Dictionary::open(const std::string& path) {
+  close();
+  if (!Storage.openFileForRead("DIC", path, file)) {
+    return false;
+  }
+
+  Header header;
+  if (file.read(&header, sizeof(header)) != static_cast<int>(sizeof(header)) ||
+      memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+    LOG_ERR("DIC", "Not a v%u dictionary: %s", VERSION, path.c_str());
+    close();
+    return false;
+  }
+  const uint32_t fileSize = file.size();
+  if (header.pageCount == 0 || header.sparseBytes > MAX_SPARSE_BYTES ||
+      header.sparseOffset + header.sparseBytes > fileSize || header.blocksOffset + header.blocksBytes > fileSize) {
+    LOG_ERR("DIC", "Malformed dictionary header: %s", path.c_str());
+    close();
+    return false;
+  }
+
+  uint8_t titleLen;
+  serialization::readPod(file, titleLen);
+  title.resize(titleLen);
+  if (titleLen > 0) file.read(&title[0], titleLen);
+
+  sparse.resize(header.sparseBytes);
+  if (!file.seek(header.sparseOffset) ||
+      file.read(sparse.data(), header.sparseBytes) != static_cast<int>(header.sparseBytes)) {
+    LOG_ERR("DIC", "Failed to read sparse index");
+    close();
+    return false;
+  }
+
+  // Walk the page records once so lookups can binary search them
+  pageRecords.reserve(header.pageCount);
+  size_t pos = 0;
+  for (uint32_t i = 0; i < header.pageCount; i++) {
+    if (pos + 5 > sparse.size() || pos + 5 + sparse[pos + 4] > sparse.size()) {
+      LOG_ERR("DIC", "Truncated sparse index");
+      close();
+      return false;
+    }
+    pageRecords.push_back(pos);
+    pos += 5 + sparse[pos + 4];
+  }
+  if (pos + sizeof(uint32_t) != sparse.size()) {
+    LOG_ERR("DIC", "Malformed sparse index");
+    close();
+    return false;
+  }
+
+  entryCount = header.entryCount;
+  indexOffset = header.indexOffset;
+  blocksOffset = header.blocksOffset;
+  blocksBytes = header.blocksBytes;
+  LOG_DBG("DIC", "Opened %s: %u entries, %u pages", title.c_str(), entryCount, header.pageCount);
+  return true;
+}
+
+void Dictionary::close() {
+  if (file) file.close();
+  title.clear();
+  entryCount = 0;
+  sparse.clear();
+  sparse.shrink_to_fit();
+  pageRecords.clear();
+  pageRecords.shrink_to_fit();
+  block.clear();
+  block.shrink_to_fit();
+  blockOffsetLoaded = UINT32_MAX;
+}
+
+uint32_t Dictionary::pageOffset(const uint32_t page) const {
+  // The sparse index ends with the end offset of the last page
+  return page < pageRecords.size() ? readU32(&sparse[pageRecords[page]]) : readU32(&sparse[sparse.size() - 4]);
+}
+
+int Dictionary::compareFirstKey(const uint32_t page, const std::string& key) const {
+  const uint8_t* record = &sparse[pageRecords[page]];
+  return compareKey(record + 5, record[4], key);
+}
+
+bool Dictionary::lookup(const std::string& word, std::vector<Entry>& out, const size_t maxResults) {
+  out.clear();
+  if (!file || maxResults == 0) {
+    return false;
+  }
+
+  const std::string key = foldKey(word);
+  if (!key.empty() && lookupKey(key, out, maxResults)) {
+    return true;
+  }
+  // "word," or "(word" as tapped in running text
+  const std::string trimmed = foldKey(trimPunctuation(word));
+  return !trimmed.empty() && trimmed != key && lookupKey(trimmed, out, maxResults);
+}
+
+bool Dictionary::lookupKey(const std::string& key, std::vector<Entry>& out, const size_t maxResults) {
+  // First page whose first key is >= key; the key can only be on the page before
+  // it, or start on it when the first keys are equal
+  uint32_t lo = 0;
+  uint32_t hi = pageRecords.size();
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    if (compareFirstKey(mid, key) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  uint32_t page = lo > 0 ? lo - 1 : 0;
+  bool runsOn = true;
+  while (runsOn && page < pageRecords.size() && out.size() < maxResults) {
+    if (!scanPage(page, key, out, maxResults, runsOn)) {
+      break;
+    }
+    // Entries sharing a key may continue on the next page, or start there when
+    // the previous page had none
+    if (!runsOn && out.empty() && page + 1 == lo && lo < pageRecords.size() && compareFirstKey(lo, key) == 0) {
+      runsOn = true;
+    }
+    page++;
+  }
+  return !out.empty();
+}
+
+bool Dictionary::scanPage(const uint32_t page, const std::string& key, std::vector<Entry>& out,
+                          const size_t maxResults, bool& runsOn) {
+  runsOn = false;
+  const uint32_t start = pageOffset(page);
+  const uint32_t end = pageOffset(page + 1);
+  if (end <= start || end - start > MAX_PAGE_BYTES) {
+    LOG_ERR("DIC", "Bad index page %u", page);
+    return false;
+  }
+
+  const uint32_t bytes = end - start;
+  auto buffer = makeUniqueNoThrow<uint8_t[]>(bytes);
+  if (!buffer) {
+    LOG_ERR("DIC", "OOM reading index page (%u bytes)", bytes);
+    return false;
+  }
+  if (!file.seek(indexOffset + start) || file.read(buffer.get(), bytes) != static_cast<int>(bytes)) {
+    LOG_ERR("DIC", "Failed to read index page %u", page);
+    return false;
+  }
+
+  // Entries are variable length: find their starts, then binary search
+  std::vector<uint16_t> entryStarts;
+  entryStarts.reserve(128);
+  for (uint32_t pos = 0; pos < bytes;) {
+    const uint32_t next = pos + 1 + buffer[pos] + 6;
+    if (next > bytes) {
+      LOG_ERR("DIC", "Truncated index page %u", page);
+      return false;
+    }
+    entryStarts.push_back(static_cast<uint16_t>(pos));
+    pos = next;
+  }
+  const size_t count = entryStarts.size();
+
+  size_t lo = 0;
+  size_t hi = count;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    const uint8_t* entry = &buffer[entryStarts[mid]];
+    if (compareKey(entry + 1, entry[0], key) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  for (size_t i = lo; i < count && out.size() < maxResults; i++) {
+    const uint8_t* entry = &buffer[entryStarts[i]];
+    if (compareKey(entry + 1, entry[0], key) != 0) {
+      return true;
+    }
+    const uint8_t* location = entry + 1 + entry[0];
+    Entry result;
+    if (readEntry(readU32(location), readU16(location + 4), result)) {
+      out.push_back(std::move(result));
+    }
+    runsOn = i + 1 == count;
+  }
+  return true;
+}
+
+bool Dictionary::readEntry(const uint32_t blockOffset, const uint16_t entryOffset, Entry& out) {
+  if (blockOffset != blockOffsetLoaded) {
+    blockOffsetLoaded = UINT32_MAX;
+    uint32_t compressedSize;
+    uint32_t rawSize;
+    if (blockOffset + 8 > blocksBytes || !file.seek(blocksOffset + blockOffset)) {
+      LOG_ERR("DIC", "Bad block offset %u", blockOffset);
+      return false;
+    }
+    serialization::readPod(file, compressedSize);
+    serialization::readPod(file, rawSize);
+    if (rawSize > MAX_BLOCK_BYTES || blockOffset + 8 + compressedSize > blocksBytes) {
+      LOG_ERR("DIC", "Bad block at %u", blockOffset);
+      return false;
+    }
+
+    auto compressed = makeUniqueNoThrow<uint8_t[]>(compressedSize);
+    if (!compressed) {
+      LOG_ERR("DIC", "OOM reading block (%u bytes)", compressedSize);
+      return false;
+    }
+    if (file.read(compressed.get(), compressedSize) != static_cast<int>(compressedSize)) {
+      LOG_ERR("DIC", "Failed to read block at %u", blockOffset);
+      return false;
+    }
+
+    block.resize(rawSize);
+    InflateReader inflater;
+    inflater.init(false);
+    inflater.setSource(compressed.get(), compressedSize);
+    if (!inflater.read(block.data(), rawSize)) {
+      LOG_ERR("DIC", "Failed to inflate block at %u", blockOffset);
+      return false;
+    }
+    blockOffsetLoaded = blockOffset;
+  }
+
+  // u8 headwordLen, headword, u16 definitionLen, definition
+  const size_t size = block.size();
+  size_t pos = entryOffset;
+  if (pos + 1 > size || pos + 1 + block[pos] + 2 > size) {
+    LOG_ERR("DIC", "Bad entry offset %u", entryOffset);
+    return false;
+  }
+  const uint8_t headwordLen = block[pos++];
+  out.headword.assign(reinterpret_cast<const char*>(&block[pos]), headwordLen);
+  pos += headwordLen;
+  const uint16_t definitionLen = readU16(&block[pos]);
+  pos += 2;
+  if (pos + definitionLen > size) {
+    LOG_ERR("DIC", "Truncated entry at %u", entryOffset);
+    return false;
+  }
+  out.definition.assign(reinterpret_cast<const char*>(&block[pos]), definitionLen);
+  return true;
+}
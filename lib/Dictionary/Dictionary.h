@@ -0,0 +1,74 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Offline dictionary in the .cpdict format (built on a computer with
+// scripts/convert_dictionary.py from StarDict or TSV sources, see
+// docs/file-formats.md).
+//
+// Headwords are sorted by their folded key and split into index pages; only
+// the first key of every page (the sparse index) stays in RAM. A lookup binary
+// searches the sparse index, reads one index page and binary searches it, then
+// reads and inflates the one definition block that holds the entry: two or
+// three SD reads whatever the dictionary size.
+class Dictionary {
+ public:
+  struct Entry {
+    std::string headword;
+    std::string definition;
+  };
+
+  static constexpr size_t MAX_RESULTS = 4;
+
+  Dictionary() = default;
+  Dictionary(const Dictionary&) = delete;
+  Dictionary& operator=(const Dictionary&) = delete;
+
+  // Open a .cpdict and load its sparse index. Keeps the file open for lookups.
+  bool open(const std::string& path);
+  void close();
+  bool isOpen() const { return static_cast<bool>(file); }
+
+  const std::string& getTitle() const { return title; }
+  uint32_t getEntryCount() const { return entryCount; }
+
+  // Definitions of a word as it appears in text: case is folded and, when the
+  // word as given has no entry, surrounding punctuation is trimmed. Fills `out`
+  // with up to maxResults entries (headwords that fold to the same key, in
+  // dictionary order). False when nothing matches.
+  bool lookup(const std::string& word, std::vector<Entry>& out, size_t maxResults = MAX_RESULTS);
+
+  // Lookup key of a headword: Latin/Cyrillic case folded, soft hyphens dropped,
+  // typographic apostrophes straightened, whitespace collapsed and trimmed.
+  // Must match fold_key() in scripts/convert_dictionary.py.
+  static std::string foldKey(const std::string& word);
+
+ private:
+  HalFile file;
+  std::string title;
+  uint32_t entryCount = 0;
+  uint32_t indexOffset = 0;
+  uint32_t blocksOffset = 0;
+  uint32_t blocksBytes = 0;
+  // Sparse index as stored: per page {u32 pageOffset, u8 keyLen, key}, then a
+  // u32 end offset. pageRecords holds where each page's record starts.
+  std::vector<uint8_t> sparse;
+  std::vector<uint32_t> pageRecords;
+
+  uint32_t pageOffset(uint32_t page) const;
+  int compareFirstKey(uint32_t page, const std::string& key) const;
+  bool lookupKey(const std::string& key, std::vector<Entry>& out, size_t maxResults);
+  // Collect the entries of one index page whose key equals `key`. Sets
+  // `runsOn` when the page's last entry matched (more may follow on the next page).
+  bool scanPage(uint32_t page, const std::string& key, std::vector<Entry>& out, size_t maxResults, bool& runsOn);
+  bool readEntry(uint32_t blockOffset, uint16_t entryOffset, Entry& out);
+
+  // Last inflated definition block, reused while consecutive results share it
+  std::vector<uint8_t> block;
+  uint32_t blockOffsetLoaded = UINT32_MAX;
+};
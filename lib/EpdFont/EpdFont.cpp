@@ -100,6 +100,60 @@ static uint8_t lookupKernClass(const EpdKernClassEntry* entries, const uint16_t
   return 0;
 }
 
+// Glyph array index of cp from the interval table, or -1
+static int32_t findGlyphIndex(const EpdFontData& data, const uint32_t cp) {
+  if (data.intervalCount == 0) {
+    return -1;
+  }
+  const EpdUnicodeInterval* intervals = data.intervals;
+  const auto* end = intervals + data.intervalCount;
+
+  // upper_bound: range lookup. Finds the first interval with first > cp, so the
+  // interval just before it is the last one with first <= cp. That's the only
+  // candidate that could contain cp. Then we verify cp <= candidate.last.
+  const auto it = std::upper_bound(
+      intervals, end, cp, [](uint32_t value, const EpdUnicodeInterval& interval) { return value < interval.first; });
+
+  if (it != intervals) {
+    const auto& interval = *(it - 1);
+    if (cp <= interval.last) {
+      return static_cast<int32_t>(interval.offset + (cp - interval.first));
+    }
+  }
+  return -1;
+}
+
+uint8_t EpdFont::getKernLeftClass(const uint32_t cp) const {
+  const int slot = data->glyphLut ? epdGlyphLutSlot(cp) : -1;
+  if (slot >= 0) {
+    return data->glyphLut[slot].kernLeftClass;
+  }
+  return lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, cp);
+}
+
+uint8_t EpdFont::getKernRightClass(const uint32_t cp) const {
+  const int slot = data->glyphLut ? epdGlyphLutSlot(cp) : -1;
+  if (slot >= 0) {
+    return data->glyphLut[slot].kernRightClass;
+  }
+  return lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, cp);
+}
+
+bool EpdFont::buildGlyphLut(const EpdFontData& data, EpdGlyphLutEntry* out) {
+  for (uint32_t slot = 0; slot < EPD_GLYPH_LUT_SIZE; slot++) {
+    const uint32_t cp =
+        slot < EPD_GLYPH_LUT_LATIN_END ? slot : EPD_GLYPH_LUT_CYRILLIC_FIRST + (slot - EPD_GLYPH_LUT_LATIN_END);
+    const int32_t index = findGlyphIndex(data, cp);
+    if (index >= EPD_GLYPH_LUT_NONE) {
+      return false;
+    }
+    out[slot].glyphIndex = index < 0 ? EPD_GLYPH_LUT_NONE : static_cast<uint16_t>(index);
+    out[slot].kernLeftClass = lookupKernClass(data.kernLeftClasses, data.kernLeftEntryCount, cp);
+    out[slot].kernRightClass = lookupKernClass(data.kernRightClasses, data.kernRightEntryCount, cp);
+  }
+  return true;
+}
+
 int8_t EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const {
   if (utf8IsCjkBreakable(leftCp) || utf8IsCjkBreakable(rightCp)) {
     return 0;
@@ -107,9 +161,9 @@ int8_t EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const
   if (!data->kernMatrix) {
     return 0;
   }
-  const uint8_t lc = lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
+  const uint8_t lc = getKernLeftClass(leftCp);
   if (lc == 0) return 0;
-  const uint8_t rc = lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, rightCp);
+  const uint8_t rc = getKernRightClass(rightCp);
   if (rc == 0) return 0;
   return data->kernMatrix[(lc - 1) * data->kernRightClassCount + (rc - 1)];
 }
@@ -155,25 +209,19 @@ uint32_t EpdFont::applyLigatures(uint32_t cp, const char*& text) const {
 }
 
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
-  const int count = data->intervalCount;
-  if (count == 0 && !data->glyphMissHandler) return nullptr;
-
-  if (count > 0) {
-    const EpdUnicodeInterval* intervals = data->intervals;
-    const auto* end = intervals + count;
-
-    // upper_bound: range lookup. Finds the first interval with first > cp, so the
-    // interval just before it is the last one with first <= cp. That's the only
-    // candidate that could contain cp. Then we verify cp <= candidate.last.
-    const auto it = std::upper_bound(
-        intervals, end, cp, [](uint32_t value, const EpdUnicodeInterval& interval) { return value < interval.first; });
-
-    if (it != intervals) {
-      const auto& interval = *(it - 1);
-      if (cp <= interval.last) {
-        return &data->glyph[interval.offset + (cp - interval.first)];
-      }
-    }
+  if (data->intervalCount == 0 && !data->glyphMissHandler) return nullptr;
+
+  // Hot ranges: one table access. Outside them, search the intervals.
+  const int slot = data->glyphLut ? epdGlyphLutSlot(cp) : -1;
+  int32_t index;
+  if (slot >= 0) {
+    const uint16_t lutIndex = data->glyphLut[slot].glyphIndex;
+    index = lutIndex == EPD_GLYPH_LUT_NONE ? -1 : lutIndex;
+  } else {
+    index = findGlyphIndex(*data, cp);
+  }
+  if (index >= 0) {
+    return &data->glyph[index];
   }
 
   // Codepoint not in interval table — try on-demand loading (SD card fonts).
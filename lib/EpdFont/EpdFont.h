@@ -3,6 +3,8 @@
 
 class EpdFont {
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
+  uint8_t getKernLeftClass(uint32_t cp) const;
+  uint8_t getKernRightClass(uint32_t cp) const;
 
  public:
   const EpdFontData* data;
@@ -23,4 +25,9 @@ class EpdFont {
   /// as many following codepoints from text as possible. Returns the
   /// (possibly substituted) codepoint; advances text past consumed chars.
   uint32_t applyLigatures(uint32_t cp, const char*& text) const;
+
+  /// Fills `out` (EPD_GLYPH_LUT_SIZE entries) with the direct-index table for `data`, from its
+  /// intervals and kern class maps (any existing data.glyphLut is ignored). Returns false when
+  /// a glyph index doesn't fit the table; `out` must not be used then.
+  static bool buildGlyphLut(const EpdFontData& data, EpdGlyphLutEntry* out);
 };
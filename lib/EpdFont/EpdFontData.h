@@ -107,6 +107,37 @@ typedef struct {
   uint32_t ligatureCp;  ///< Codepoint of the replacement ligature glyph
 } __attribute__((packed)) EpdLigaturePair;
 
+/// Direct-index glyph/kern-class lookup for the codepoints text hits most: ASCII, Latin-1,
+/// Latin Extended-A (U+0000-U+017F) and basic Cyrillic (U+0400-U+045F). One array access
+/// replaces the interval and kern class binary searches. Slots come from epdGlyphLutSlot().
+typedef struct {
+  uint16_t glyphIndex;     ///< Index into the glyph array, EPD_GLYPH_LUT_NONE if the font lacks the codepoint
+  uint8_t kernLeftClass;   ///< As in kernLeftClasses, 0 = no kerning
+  uint8_t kernRightClass;  ///< As in kernRightClasses, 0 = no kerning
+} EpdGlyphLutEntry;
+
+constexpr uint16_t EPD_GLYPH_LUT_NONE = 0xFFFF;
+constexpr uint32_t EPD_GLYPH_LUT_LATIN_END = 0x180;  // U+0000-U+017F
+constexpr uint32_t EPD_GLYPH_LUT_CYRILLIC_FIRST = 0x400;
+constexpr uint32_t EPD_GLYPH_LUT_CYRILLIC_END = 0x460;  // U+0400-U+045F
+constexpr uint32_t EPD_GLYPH_LUT_SIZE =
+    EPD_GLYPH_LUT_LATIN_END + (EPD_GLYPH_LUT_CYRILLIC_END - EPD_GLYPH_LUT_CYRILLIC_FIRST);
+
+/// LUT slot for a codepoint, or -1 when it is outside the covered ranges.
+constexpr int epdGlyphLutSlot(const uint32_t cp) {
+  if (cp < EPD_GLYPH_LUT_LATIN_END) return static_cast<int>(cp);
+  if (cp >= EPD_GLYPH_LUT_CYRILLIC_FIRST && cp < EPD_GLYPH_LUT_CYRILLIC_END) {
+    return static_cast<int>(EPD_GLYPH_LUT_LATIN_END + (cp - EPD_GLYPH_LUT_CYRILLIC_FIRST));
+  }
+  return -1;
+}
+
+/// Glyph bitmap encoding of a font without groups (see fontconvert.py --rle).
+enum EpdBitmapEncoding : uint8_t {
+  EPD_BITMAP_PACKED = 0,  ///< Packed bitmaps, read in place
+  EPD_BITMAP_RLE = 1,     ///< One run-length stream per glyph (GlyphRle.h); dataLength stays the packed size
+};
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -119,7 +150,7 @@ typedef struct {
   bool is2Bit;
   const EpdFontGroup* groups;                 ///< NULL for uncompressed fonts
   uint16_t groupCount;                        ///< 0 for uncompressed fonts
-  const uint16_t* glyphToGroup;               ///< Per-glyph group ID (nullptr for contiguous-group fonts)
+  const uint16_t* glyphToGroup;               ///< Per-glyph group ID, group 0 = most frequent (nullptr if contiguous)
   const EpdKernClassEntry* kernLeftClasses;   ///< Sorted left-side class map (nullptr if none)
   const EpdKernClassEntry* kernRightClasses;  ///< Sorted right-side class map (nullptr if none)
   const int8_t* kernMatrix;              ///< Flat leftClassCount x rightClassCount matrix, 4.4 fixed-point in pixels
@@ -129,6 +160,8 @@ typedef struct {
   uint8_t kernRightClassCount;           ///< Number of distinct right classes (matrix cols)
   const EpdLigaturePair* ligaturePairs;  ///< Sorted ligature pair table (nullptr if none)
   uint32_t ligaturePairCount;            ///< Number of entries in ligaturePairs
+  const EpdGlyphLutEntry* glyphLut;      ///< EPD_GLYPH_LUT_SIZE entries, nullptr = search only
+  uint8_t bitmapEncoding;                ///< EpdBitmapEncoding; EPD_BITMAP_RLE fonts have no groups
 
   /// On-demand glyph loading for fonts that don't keep all glyphs in RAM (e.g. SD card fonts).
   /// Called by getGlyph() when a codepoint is not found in the interval table.
@@ -4,8 +4,25 @@
 #include <Logging.h>
 #include <Utf8.h>
 
+#include <algorithm>
 #include <cstdlib>
 
+#include "GlyphBitmap.h"
+#include "GlyphRle.h"
+
+static_assert(FontDecompressor::GLYPH_CACHE_BYTES <= UINT16_MAX, "glyph cache offsets are 16-bit");
+
+namespace {
+uint32_t alignedSize(const EpdGlyph& glyph) { return GlyphBitmap::alignedRowBytes(glyph.width) * glyph.height; }
+
+// Glyph cache key order: font data address, then glyph index
+bool glyphKeyLess(const EpdFontData* fontA, const uint32_t indexA, const EpdFontData* fontB, const uint32_t indexB) {
+  const auto a = reinterpret_cast<uintptr_t>(fontA);
+  const auto b = reinterpret_cast<uintptr_t>(fontB);
+  return a != b ? a < b : indexA < indexB;
+}
+}  // namespace
+
 FontDecompressor::~FontDecompressor() { deinit(); }
 
 bool FontDecompressor::init() {
@@ -16,6 +33,8 @@ bool FontDecompressor::init() {
 void FontDecompressor::deinit() {
   freePageBuffer();
   freeHotGroup();
+  releaseResidentGroups();
+  releaseGlyphCache();
 }
 
 void FontDecompressor::clearCache() {
@@ -43,6 +62,13 @@ void FontDecompressor::freeHotGroup() {
   hotGlyphBufCapacity = 0;
 }
 
+void FontDecompressor::releaseResidentGroups() {
+  for (auto& slot : residentGroups) {
+    free(slot.buffer);
+    slot = {};
+  }
+}
+
 bool FontDecompressor::ensureCapacity(uint8_t*& buf, uint32_t& capacity, uint32_t needed) {
   if (capacity >= needed) return true;
   // Grow-only, free-then-malloc: every caller fully rewrites the buffer after a grow, so the
@@ -53,6 +79,12 @@ bool FontDecompressor::ensureCapacity(uint8_t*& buf, uint32_t& capacity, uint32_
   return buf != nullptr;
 }
 
+uint32_t FontDecompressor::getGlyphCount(const EpdFontData* fontData) {
+  if (fontData->intervalCount == 0) return 0;
+  const auto& lastInterval = fontData->intervals[fontData->intervalCount - 1];
+  return lastInterval.offset + (lastInterval.last - lastInterval.first + 1);
+}
+
 uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint32_t glyphIndex) {
   // O(1) path for frequency-grouped fonts with glyphToGroup mapping
   if (fontData->glyphToGroup != nullptr) {
@@ -85,6 +117,227 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   return true;
 }
 
+// --- Resident groups ---
+
+bool FontDecompressor::hasResidentGroup(const EpdFontData* fontData) {
+  // Only frequency-grouped fonts order their most frequent glyphs into group 0
+  return fontData->glyphToGroup != nullptr && fontData->groupCount > 0 &&
+         fontData->groups[0].uncompressedSize <= MAX_RESIDENT_GROUP_BYTES;
+}
+
+const uint8_t* FontDecompressor::getResidentGroup(const EpdFontData* fontData) {
+  ResidentGroup* victim = &residentGroups[0];
+  for (auto& slot : residentGroups) {
+    if (slot.fontData == fontData) {
+      slot.lastUse = ++residentUseCounter;
+      return slot.buffer;
+    }
+    if (slot.lastUse < victim->lastUse) victim = &slot;  // empty slots have lastUse 0
+  }
+
+  if (!loadResidentGroup(*victim, fontData)) return nullptr;
+  victim->lastUse = ++residentUseCounter;
+  return victim->buffer;
+}
+
+bool FontDecompressor::loadResidentGroup(ResidentGroup& slot, const EpdFontData* fontData) {
+  free(slot.buffer);
+  slot = {};
+
+  // The group's glyphs are packed back to back in glyph order, so dataOffset indexes the buffer
+  const EpdFontGroup& group = fontData->groups[0];
+  // Packed buffer plus inflate buffer, each at most uncompressedSize. On a short heap the glyphs go
+  // through the page buffer and glyph cache like any other group instead.
+  if (ESP.getFreeHeap() < GLYPH_CACHE_MIN_FREE_HEAP + 2 * group.uncompressedSize) return false;
+  const uint32_t glyphCount = getGlyphCount(fontData);
+  uint32_t packedSize = 0;
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    if (fontData->glyphToGroup[i] == 0) {
+      packedSize += fontData->glyph[i].dataLength;
+    }
+  }
+
+  // Long-lived buffer first, so the transient one doesn't leave a hole below it
+  auto* buffer = static_cast<uint8_t*>(malloc(packedSize > 0 ? packedSize : 1));
+  auto* tempBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+  if (!buffer || !tempBuf) {
+    LOG_ERR("FDC", "Failed to allocate resident group (%u + %u bytes)", packedSize, group.uncompressedSize);
+    free(buffer);
+    free(tempBuf);
+    return false;
+  }
+  if (group.uncompressedSize > stats.peakTempBytes) {
+    stats.peakTempBytes = group.uncompressedSize;
+  }
+
+  if (!decompressGroup(fontData, 0, tempBuf, group.uncompressedSize)) {
+    free(buffer);
+    free(tempBuf);
+    return false;
+  }
+
+  uint32_t alignedOffset = 0;
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    if (fontData->glyphToGroup[i] != 0) continue;
+    const EpdGlyph& glyph = fontData->glyph[i];
+    if (glyph.width == 0 || glyph.height == 0) continue;
+    compactSingleGlyph(&tempBuf[alignedOffset], &buffer[glyph.dataOffset], glyph.width, glyph.height);
+    alignedOffset += ((glyph.width + 3) / 4) * glyph.height;
+  }
+  free(tempBuf);
+
+  slot.fontData = fontData;
+  slot.buffer = buffer;
+  slot.size = packedSize;
+  stats.residentLoads++;
+  LOG_DBG("FDC", "Resident group loaded: %u bytes for fontData=%p", packedSize, (void*)fontData);
+  return true;
+}
+
+void FontDecompressor::shrinkResidentGroups() {
+  while (ESP.getFreeHeap() < GLYPH_CACHE_MIN_FREE_HEAP) {
+    ResidentGroup* victim = nullptr;
+    for (auto& slot : residentGroups) {
+      if (slot.buffer && (!victim || slot.lastUse < victim->lastUse)) victim = &slot;
+    }
+    if (!victim) return;
+    LOG_DBG("FDC", "Low heap: resident group released (%u bytes, fontData=%p)", victim->size,
+            (void*)victim->fontData);
+    free(victim->buffer);
+    *victim = {};
+  }
+}
+
+// --- Glyph cache ---
+
+void FontDecompressor::releaseGlyphCache() {
+  free(glyphCacheEntries);
+  glyphCacheEntries = nullptr;
+  glyphCacheCount = 0;
+  free(glyphCacheArena);
+  glyphCacheArena = nullptr;
+  glyphCacheCapacity = 0;
+  glyphCacheUsed = 0;
+}
+
+FontDecompressor::CachedGlyph* FontDecompressor::findCachedGlyph(const EpdFontData* fontData, uint32_t glyphIndex) {
+  int left = 0, right = static_cast<int>(glyphCacheCount) - 1;
+  while (left <= right) {
+    const int mid = left + (right - left) / 2;
+    CachedGlyph& entry = glyphCacheEntries[mid];
+    if (entry.fontData == fontData && entry.glyphIndex == glyphIndex) {
+      entry.lastUse = ++glyphCacheUseCounter;
+      return &entry;
+    }
+    if (glyphKeyLess(entry.fontData, entry.glyphIndex, fontData, glyphIndex))
+      left = mid + 1;
+    else
+      right = mid - 1;
+  }
+  return nullptr;
+}
+
+void FontDecompressor::cacheGlyph(const EpdFontData* fontData, uint32_t glyphIndex, const uint8_t* bitmap,
+                                  uint16_t length) {
+  if (uint8_t* cached = allocCachedGlyph(fontData, glyphIndex, length)) {
+    memcpy(cached, bitmap, length);
+  }
+}
+
+uint8_t* FontDecompressor::allocCachedGlyph(const EpdFontData* fontData, uint32_t glyphIndex, uint16_t length) {
+  if (length == 0 || length > GLYPH_CACHE_BYTES / 4) return nullptr;
+
+  if (!glyphCacheArena) {
+    if (ESP.getFreeHeap() < GLYPH_CACHE_MIN_FREE_HEAP + GLYPH_CACHE_BYTES) return nullptr;
+    glyphCacheEntries = static_cast<CachedGlyph*>(malloc(GLYPH_CACHE_ENTRIES * sizeof(CachedGlyph)));
+    glyphCacheArena = static_cast<uint8_t*>(malloc(GLYPH_CACHE_BYTES));
+    if (!glyphCacheEntries || !glyphCacheArena) {
+      LOG_ERR("FDC", "Failed to allocate glyph cache (%u bytes)", GLYPH_CACHE_BYTES);
+      releaseGlyphCache();
+      return nullptr;
+    }
+    glyphCacheCapacity = GLYPH_CACHE_BYTES;
+  }
+
+  if (findCachedGlyph(fontData, glyphIndex)) return nullptr;
+
+  if (glyphCacheUsed + length > glyphCacheCapacity || glyphCacheCount >= GLYPH_CACHE_ENTRIES) {
+    evictGlyphCache(glyphCacheCapacity - glyphCacheCapacity / 4, GLYPH_CACHE_ENTRIES - GLYPH_CACHE_ENTRIES / 4);
+    if (glyphCacheUsed + length > glyphCacheCapacity) return nullptr;
+  }
+
+  // Insert at the sorted position
+  const CachedGlyph* it = std::lower_bound(glyphCacheEntries, glyphCacheEntries + glyphCacheCount, glyphIndex,
+                                           [fontData](const CachedGlyph& entry, uint32_t index) {
+                                             return glyphKeyLess(entry.fontData, entry.glyphIndex, fontData, index);
+                                           });
+  const auto pos = static_cast<uint16_t>(it - glyphCacheEntries);
+  memmove(&glyphCacheEntries[pos + 1], &glyphCacheEntries[pos], (glyphCacheCount - pos) * sizeof(CachedGlyph));
+  glyphCacheEntries[pos] = {fontData, glyphIndex, ++glyphCacheUseCounter, static_cast<uint16_t>(glyphCacheUsed),
+                            length};
+  glyphCacheCount++;
+  uint8_t* slot = &glyphCacheArena[glyphCacheUsed];
+  glyphCacheUsed += length;
+  return slot;
+}
+
+void FontDecompressor::evictGlyphCache(uint32_t maxUsed, uint16_t maxCount) {
+  if (glyphCacheUsed <= maxUsed && glyphCacheCount <= maxCount) return;
+
+  // Drop least recently used entries until both limits hold
+  uint16_t order[GLYPH_CACHE_ENTRIES];
+  for (uint16_t i = 0; i < glyphCacheCount; i++) order[i] = i;
+  std::sort(order, order + glyphCacheCount,
+            [this](uint16_t a, uint16_t b) { return glyphCacheEntries[a].lastUse < glyphCacheEntries[b].lastUse; });
+  uint16_t live = glyphCacheCount;
+  for (uint16_t i = 0; i < glyphCacheCount && (glyphCacheUsed > maxUsed || live > maxCount); i++) {
+    CachedGlyph& entry = glyphCacheEntries[order[i]];
+    glyphCacheUsed -= entry.length;
+    entry.fontData = nullptr;  // evicted
+    live--;
+    stats.glyphCacheEvictions++;
+  }
+
+  // Compact the arena in offset order, then the entry table in key order
+  uint16_t liveCount = 0;
+  for (uint16_t i = 0; i < glyphCacheCount; i++) {
+    if (glyphCacheEntries[i].fontData) order[liveCount++] = i;
+  }
+  std::sort(order, order + liveCount,
+            [this](uint16_t a, uint16_t b) { return glyphCacheEntries[a].offset < glyphCacheEntries[b].offset; });
+  uint32_t writeOffset = 0;
+  for (uint16_t i = 0; i < liveCount; i++) {
+    CachedGlyph& entry = glyphCacheEntries[order[i]];
+    memmove(&glyphCacheArena[writeOffset], &glyphCacheArena[entry.offset], entry.length);
+    entry.offset = static_cast<uint16_t>(writeOffset);
+    writeOffset += entry.length;
+  }
+  uint16_t writeIndex = 0;
+  for (uint16_t i = 0; i < glyphCacheCount; i++) {
+    if (glyphCacheEntries[i].fontData) glyphCacheEntries[writeIndex++] = glyphCacheEntries[i];
+  }
+  glyphCacheCount = writeIndex;
+  glyphCacheUsed = writeOffset;
+}
+
+void FontDecompressor::shrinkGlyphCache() {
+  const uint32_t target = glyphCacheCapacity / 2;
+  if (target < GLYPH_CACHE_BYTES / 8) {
+    stats.glyphCacheEvictions += glyphCacheCount;
+    releaseGlyphCache();
+    LOG_DBG("FDC", "Low heap: glyph cache released");
+    return;
+  }
+  evictGlyphCache(target, GLYPH_CACHE_ENTRIES);
+  // Shrinking realloc keeps the data; on failure the old, larger block stays valid
+  auto* shrunk = static_cast<uint8_t*>(realloc(glyphCacheArena, target));
+  if (shrunk) {
+    glyphCacheArena = shrunk;
+    glyphCacheCapacity = target;
+  }
+  LOG_DBG("FDC", "Low heap: glyph cache shrunk to %u bytes", glyphCacheCapacity);
+}
+
 // --- Byte-aligned helpers ---
 
 uint32_t FontDecompressor::getAlignedOffset(const EpdFontData* fontData, uint16_t groupIndex, uint32_t glyphIndex) {
@@ -138,17 +391,55 @@ void FontDecompressor::compactSingleGlyph(const uint8_t* alignedSrc, uint8_t* pa
   if (outBits > 0) packedDst[writeIdx] = outByte << (8 - outBits);
 }
 
-// --- getBitmap: page buffer → hot group → decompress ---
+const uint8_t* FontDecompressor::alignedBitmap(const uint8_t* rows, const EpdGlyph* glyph, uint8_t* rowStride) {
+  if (glyph->width % 4 == 0) return rows;
+  if (rowStride) {
+    *rowStride = static_cast<uint8_t>(GlyphBitmap::alignedRowBytes(glyph->width));
+    return rows;
+  }
+  if (!ensureCapacity(hotGlyphBuf, hotGlyphBufCapacity, glyph->dataLength)) {
+    LOG_ERR("FDC", "Failed to allocate %u bytes for glyph scratch", (unsigned)glyph->dataLength);
+    return nullptr;
+  }
+  compactSingleGlyph(rows, hotGlyphBuf, glyph->width, glyph->height);
+  return hotGlyphBuf;
+}
 
-const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint32_t glyphIndex) {
+// --- getBitmap: resident group → page buffer → glyph cache → hot group → decompress ---
+
+const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint32_t glyphIndex,
+                                           uint8_t* rowStride) {
   const uint32_t tStart = micros();
   stats.getBitmapCalls++;
+  if (rowStride) *rowStride = 0;
+
+  // Per-glyph RLE fonts decode one glyph straight from flash: no group, page buffer or cache involved
+  if (fontData->bitmapEncoding == EPD_BITMAP_RLE) {
+    if (!ensureCapacity(hotGlyphBuf, hotGlyphBufCapacity, glyph->dataLength)) {
+      LOG_ERR("FDC", "Failed to allocate %u bytes for glyph scratch", (unsigned)glyph->dataLength);
+      stats.getBitmapTimeUs += micros() - tStart;
+      return nullptr;
+    }
+    GlyphRle::decode(&fontData->bitmap[glyph->dataOffset], hotGlyphBuf, glyph->width, glyph->height);
+    stats.getBitmapTimeUs += micros() - tStart;
+    return hotGlyphBuf;
+  }
 
   if (!fontData->groups || fontData->groupCount == 0) {
     stats.getBitmapTimeUs += micros() - tStart;
     return &fontData->bitmap[glyph->dataOffset];
   }
 
+  // Frequent glyphs: resident group, kept across pages
+  if (hasResidentGroup(fontData) && fontData->glyphToGroup[glyphIndex] == 0) {
+    const uint8_t* resident = getResidentGroup(fontData);
+    if (resident) {
+      stats.cacheHits++;
+      stats.getBitmapTimeUs += micros() - tStart;
+      return &resident[glyph->dataOffset];
+    }
+  }
+
   // Check page buffer slots (populated by prewarmCache — one slot per font style)
   for (uint8_t s = 0; s < pageSlotCount; s++) {
     const auto& slot = pageSlots[s];
@@ -160,8 +451,9 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
       if (slot.glyphs[mid].glyphIndex == glyphIndex) {
         if (slot.glyphs[mid].bufferOffset != UINT32_MAX) {
           stats.cacheHits++;
+          const uint8_t* bitmap = alignedBitmap(&slot.buffer[slot.glyphs[mid].bufferOffset], glyph, rowStride);
           stats.getBitmapTimeUs += micros() - tStart;
-          return &slot.buffer[slot.glyphs[mid].bufferOffset];
+          return bitmap;
         }
         break;  // Not extracted during prewarm; fall through to hot-group path
       }
@@ -173,6 +465,16 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
     break;  // Found the right slot but glyph wasn't in it; don't check other slots
   }
 
+  // Glyphs prewarm skipped because an earlier page left them in the glyph cache
+  if (const CachedGlyph* cached = findCachedGlyph(fontData, glyphIndex)) {
+    stats.cacheHits++;
+    stats.glyphCacheHits++;
+    const uint8_t* bitmap = alignedBitmap(&glyphCacheArena[cached->offset], glyph, rowStride);
+    stats.getBitmapTimeUs += micros() - tStart;
+    return bitmap;
+  }
+  stats.glyphCacheMisses++;
+
   // Fallback: hot group slot
   uint16_t groupIndex = getGroupIndex(fontData, glyphIndex);
   if (groupIndex >= fontData->groupCount) {
@@ -207,17 +509,18 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
     stats.cacheHits++;
   }
 
-  // Compact just the requested glyph from byte-aligned data into scratch buffer
-  if (!ensureCapacity(hotGlyphBuf, hotGlyphBufCapacity, glyph->dataLength)) {
-    LOG_ERR("FDC", "Failed to allocate %u bytes for glyph scratch", (unsigned)glyph->dataLength);
-    stats.getBitmapTimeUs += micros() - tStart;
-    return nullptr;
-  }
+  const uint32_t alignedOff = getAlignedOffset(fontData, groupIndex, glyphIndex);
 
-  uint32_t alignedOff = getAlignedOffset(fontData, groupIndex, glyphIndex);
-  compactSingleGlyph(&hotGroup[alignedOff], hotGlyphBuf, glyph->width, glyph->height);
+  // Later pages reuse the rows from the glyph cache; without room there they are read in the hot group
+  const uint8_t* rows = &hotGroup[alignedOff];
+  const uint32_t size = alignedSize(*glyph);
+  if (uint8_t* cached = allocCachedGlyph(fontData, glyphIndex, static_cast<uint16_t>(size))) {
+    memcpy(cached, rows, size);
+    rows = cached;
+  }
+  const uint8_t* bitmap = alignedBitmap(rows, glyph, rowStride);
   stats.getBitmapTimeUs += micros() - tStart;
-  return hotGlyphBuf;
+  return bitmap;
 }
 
 // --- Prewarm: pre-decompress glyph bitmaps for a page of text ---
@@ -258,6 +561,12 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
   }
   PageSlot& slot = pageSlots[pageSlotCount];
 
+  // The glyph cache gives memory back first; resident groups only if that wasn't enough
+  if (ESP.getFreeHeap() < GLYPH_CACHE_MIN_FREE_HEAP) {
+    if (glyphCacheArena) shrinkGlyphCache();
+    shrinkResidentGroups();
+  }
+
   // Step 1: Collect unique glyph indices needed for this page
   uint32_t neededGlyphs[MAX_PAGE_GLYPHS];
   uint16_t glyphCount = 0;
@@ -327,6 +636,30 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
     }
   }
 
+  // Glyphs served by the resident group need neither page buffer space nor inflation. Filtered
+  // only now so the ligature check above still sees every glyph on the page.
+  if (hasResidentGroup(fontData) && getResidentGroup(fontData)) {
+    uint16_t kept = 0;
+    for (uint16_t i = 0; i < glyphCount; i++) {
+      if (fontData->glyphToGroup[neededGlyphs[i]] != 0) {
+        neededGlyphs[kept++] = neededGlyphs[i];
+      }
+    }
+    glyphCount = kept;
+  }
+
+  // Likewise glyphs an earlier page left in the glyph cache
+  uint16_t uncached = 0;
+  for (uint16_t i = 0; i < glyphCount; i++) {
+    if (findCachedGlyph(fontData, neededGlyphs[i])) {
+      stats.glyphCacheHits++;
+    } else {
+      stats.glyphCacheMisses++;
+      neededGlyphs[uncached++] = neededGlyphs[i];
+    }
+  }
+  glyphCount = uncached;
+
   if (glyphCount == 0) return 0;
 
   // Step 2: Compute total buffer size and collect unique groups
@@ -336,7 +669,7 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
   bool groupCapWarned = false;
 
   for (uint16_t i = 0; i < glyphCount; i++) {
-    totalBytes += fontData->glyph[neededGlyphs[i]].dataLength;
+    totalBytes += alignedSize(fontData->glyph[neededGlyphs[i]]);
     uint16_t gi = getGroupIndex(fontData, neededGlyphs[i]);
     bool found = false;
     for (uint8_t j = 0; j < groupCount; j++) {
@@ -360,6 +693,15 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
   // Step 3: Allocate page buffer and lookup table for this slot
   slot.buffer = static_cast<uint8_t*>(malloc(totalBytes));
   slot.glyphs = static_cast<PageGlyphEntry*>(malloc(glyphCount * sizeof(PageGlyphEntry)));
+  if ((!slot.buffer || !slot.glyphs) && glyphCacheArena) {
+    // The glyph cache is the first thing to give back; glyphs skipped above fall back to the hot group
+    free(slot.buffer);
+    free(slot.glyphs);
+    stats.glyphCacheEvictions += glyphCacheCount;
+    releaseGlyphCache();
+    slot.buffer = static_cast<uint8_t*>(malloc(totalBytes));
+    slot.glyphs = static_cast<PageGlyphEntry*>(malloc(glyphCount * sizeof(PageGlyphEntry)));
+  }
   if (!slot.buffer || !slot.glyphs) {
     LOG_ERR("FDC", "Failed to allocate page buffer (%u bytes, %u glyphs)", totalBytes, glyphCount);
     free(slot.buffer);
@@ -396,8 +738,7 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
 
   if (fontData->glyphToGroup) {
     // Frequency-grouped: single O(totalGlyphs) pass through glyphToGroup
-    const auto& lastInterval = fontData->intervals[fontData->intervalCount - 1];
-    const uint32_t totalGlyphs = lastInterval.offset + (lastInterval.last - lastInterval.first + 1);
+    const uint32_t totalGlyphs = getGlyphCount(fontData);
 
     for (uint32_t i = 0; i < totalGlyphs; i++) {
       const uint16_t gi = fontData->glyphToGroup[i];
@@ -484,16 +825,17 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
       continue;
     }
 
-    // Extract needed glyphs directly from the byte-aligned temp buffer, compacting on the fly.
-    // alignedOffset was pre-computed in step 3b — no full-group compact scan needed.
+    // Copy needed glyphs' byte-aligned rows out of the temp buffer as they are; the renderer reads
+    // them with a row stride. alignedOffset was pre-computed in step 3b.
     for (uint16_t i = 0; i < slot.glyphCount; i++) {
       if (slot.glyphs[i].bufferOffset != UINT32_MAX) continue;  // already extracted
       if (getGroupIndex(fontData, slot.glyphs[i].glyphIndex) != groupIdx) continue;
 
-      const EpdGlyph& glyph = fontData->glyph[slot.glyphs[i].glyphIndex];
-      compactSingleGlyph(&tempBuf[slot.glyphs[i].alignedOffset], &slot.buffer[writeOffset], glyph.width, glyph.height);
+      const uint32_t size = alignedSize(fontData->glyph[slot.glyphs[i].glyphIndex]);
+      memcpy(&slot.buffer[writeOffset], &tempBuf[slot.glyphs[i].alignedOffset], size);
       slot.glyphs[i].bufferOffset = writeOffset;
-      writeOffset += glyph.dataLength;
+      cacheGlyph(fontData, slot.glyphs[i].glyphIndex, &slot.buffer[writeOffset], static_cast<uint16_t>(size));
+      writeOffset += size;
     }
 
     free(tempBuf);
@@ -513,9 +855,17 @@ void FontDecompressor::logStats(const char* label) {
   const uint32_t total = stats.cacheHits + stats.cacheMisses;
   LOG_DBG("FDC", "[%s] hits=%lu misses=%lu (%.1f%% hit rate)", label, stats.cacheHits, stats.cacheMisses,
           total > 0 ? 100.0f * stats.cacheHits / total : 0.0f);
-  LOG_DBG("FDC", "[%s] decompress=%lums groups_accessed=%u", label, stats.decompressTimeMs, stats.uniqueGroupsAccessed);
-  LOG_DBG("FDC", "[%s] mem: pageBuf=%lu pageGlyphs=%lu hotGroup=%lu peakTemp=%lu", label, stats.pageBufferBytes,
-          stats.pageGlyphsBytes, stats.hotGroupBytes, stats.peakTempBytes);
+  LOG_DBG("FDC", "[%s] decompress=%lums groups_accessed=%u resident_loads=%u", label, stats.decompressTimeMs,
+          stats.uniqueGroupsAccessed, stats.residentLoads);
+  uint32_t residentBytes = 0;
+  for (const auto& slot : residentGroups) {
+    residentBytes += slot.size;
+  }
+  LOG_DBG("FDC", "[%s] mem: pageBuf=%lu pageGlyphs=%lu hotGroup=%lu resident=%lu peakTemp=%lu", label,
+          stats.pageBufferBytes, stats.pageGlyphsBytes, stats.hotGroupBytes, residentBytes, stats.peakTempBytes);
+  LOG_DBG("FDC", "[%s] glyphCache: hits=%lu misses=%lu evictions=%lu used=%lu/%lu (%u glyphs)", label,
+          stats.glyphCacheHits, stats.glyphCacheMisses, stats.glyphCacheEvictions, glyphCacheUsed, glyphCacheCapacity,
+          glyphCacheCount);
   if (stats.getBitmapCalls > 0) {
     LOG_DBG("FDC", "[%s] getBitmap: %lu calls, %luus total, %luus/call avg", label, stats.getBitmapCalls,
             stats.getBitmapTimeUs, stats.getBitmapTimeUs / stats.getBitmapCalls);
@@ -7,7 +7,12 @@
 class FontDecompressor {
  public:
   static constexpr uint16_t MAX_PAGE_GLYPHS = 512;
-  static constexpr uint8_t MAX_PAGE_SLOTS = 4;  // One per font style (R/B/I/BI)
+  static constexpr uint8_t MAX_PAGE_SLOTS = 4;                 // One per font style (R/B/I/BI)
+  static constexpr uint8_t MAX_RESIDENT_GROUPS = 4;            // One hot group per font style
+  static constexpr uint32_t MAX_RESIDENT_GROUP_BYTES = 16384;  // Larger group 0s are not kept resident
+  static constexpr uint32_t GLYPH_CACHE_BYTES = 16384;         // Cross-page glyph cache budget
+  static constexpr uint16_t GLYPH_CACHE_ENTRIES = 256;
+  static constexpr uint32_t GLYPH_CACHE_MIN_FREE_HEAP = 32768;  // Below this the caches shrink
 
   FontDecompressor() = default;
   ~FontDecompressor();
@@ -16,14 +21,28 @@ class FontDecompressor {
   void deinit();
 
   // Returns pointer to decompressed bitmap data for the given glyph.
-  // Checks the page buffer (from prewarm) first, then falls back to the hot group slot.
-  const uint8_t* getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint32_t glyphIndex);
+  // Checks the resident groups, then the page buffer (from prewarm), then the glyph cache, then falls
+  // back to the hot group slot. Per-glyph RLE fonts (EPD_BITMAP_RLE) are decoded directly instead.
+  // The page buffer, glyph cache and hot group hold byte-aligned rows as inflated. A caller that passes
+  // rowStride gets them in place, with *rowStride set to the bytes per row (0 = packed, see
+  // GlyphBitmap.h); otherwise the glyph is compacted into a packed scratch copy.
+  const uint8_t* getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint32_t glyphIndex,
+                           uint8_t* rowStride = nullptr);
 
-  // Free all cached data (page buffer + hot group).
+  // Free per-page cached data (page buffer + hot group). Resident groups and the glyph cache survive.
   void clearCache();
 
+  // Free the resident groups too, e.g. when leaving the reader.
+  void releaseResidentGroups();
+
+  // Free the cross-page glyph cache.
+  void releaseGlyphCache();
+
   // Pre-scan UTF-8 text and extract needed glyph bitmaps into a flat page buffer.
-  // Each group is decompressed once into a temp buffer; only needed glyphs are kept.
+  // Each group is decompressed once into a temp buffer; only needed glyphs are kept, their
+  // byte-aligned rows copied as they are.
+  // Glyphs served by a resident group or still in the glyph cache are skipped, so a page using only
+  // those inflates nothing. Newly extracted glyphs are added to the glyph cache for later pages.
   // Returns the number of glyphs that couldn't be loaded (0 on full success).
   int prewarmCache(const EpdFontData* fontData, const char* utf8Text);
 
@@ -32,12 +51,16 @@ class FontDecompressor {
     uint32_t cacheMisses = 0;
     uint32_t decompressTimeMs = 0;
     uint16_t uniqueGroupsAccessed = 0;
-    uint32_t pageBufferBytes = 0;  // pageBuffer allocation
-    uint32_t pageGlyphsBytes = 0;  // pageGlyphs lookup table allocation
-    uint32_t hotGroupBytes = 0;    // current hot group allocation
-    uint32_t peakTempBytes = 0;    // largest temp buffer in prewarm
-    uint32_t getBitmapTimeUs = 0;  // cumulative getBitmap time (micros)
-    uint32_t getBitmapCalls = 0;   // number of getBitmap calls
+    uint32_t pageBufferBytes = 0;      // pageBuffer allocation
+    uint32_t pageGlyphsBytes = 0;      // pageGlyphs lookup table allocation
+    uint32_t hotGroupBytes = 0;        // current hot group allocation
+    uint16_t residentLoads = 0;        // resident groups inflated since the last stats reset
+    uint32_t glyphCacheHits = 0;       // glyphs found in the cross-page glyph cache
+    uint32_t glyphCacheMisses = 0;     // glyphs looked up there and not found
+    uint32_t glyphCacheEvictions = 0;  // glyphs dropped to make room or under memory pressure
+    uint32_t peakTempBytes = 0;        // largest temp buffer in prewarm
+    uint32_t getBitmapTimeUs = 0;      // cumulative getBitmap time (micros)
+    uint32_t getBitmapCalls = 0;       // number of getBitmap calls
   };
   void logStats(const char* label = "FDC");
   void resetStats();
@@ -51,7 +74,7 @@ class FontDecompressor {
   // Up to MAX_PAGE_SLOTS (4) styles can be prewarmed simultaneously.
   struct PageGlyphEntry {
     uint32_t glyphIndex;
-    uint32_t bufferOffset;
+    uint32_t bufferOffset;   // byte-aligned rows in the page buffer
     uint32_t alignedOffset;  // byte-aligned offset within its decompressed group (set during prewarm pre-scan)
   };
   struct PageSlot {
@@ -63,6 +86,39 @@ class FontDecompressor {
   PageSlot pageSlots[MAX_PAGE_SLOTS] = {};
   uint8_t pageSlotCount = 0;
 
+  // Resident groups: group 0 of frequency-grouped fonts (fontconvert.py --hot-group-corpus) holds the
+  // most frequent glyphs. It is kept packed, one per font style, across pages and prewarms, so pages
+  // that only use those glyphs need no inflation at all. Glyph dataOffset indexes the buffer directly.
+  // Least recently used slot is replaced when a fifth style shows up. Under memory pressure they are
+  // released least recently used first (shrinkResidentGroups()) and not reloaded until the heap recovers.
+  struct ResidentGroup {
+    const EpdFontData* fontData = nullptr;
+    uint8_t* buffer = nullptr;  // owned; freed in releaseResidentGroups()/dtor
+    uint32_t size = 0;
+    uint32_t lastUse = 0;
+  };
+  ResidentGroup residentGroups[MAX_RESIDENT_GROUPS] = {};
+  uint32_t residentUseCounter = 0;
+
+  // Glyph cache: byte-aligned bitmaps of recently drawn glyphs, keyed by (fontData, glyphIndex), kept across
+  // pages so steady-state reading only inflates glyphs not seen recently. Bitmaps are bump-allocated
+  // in one arena; entries stay sorted by key for binary search. When the arena or the entry table is
+  // full, the least recently used quarter is evicted in one go and the arena compacted, so pointers
+  // into it are only valid until the next insertion. Both buffers are allocated on first use.
+  struct CachedGlyph {
+    const EpdFontData* fontData;
+    uint32_t glyphIndex;
+    uint32_t lastUse;
+    uint16_t offset;  // into glyphCacheArena
+    uint16_t length;
+  };
+  CachedGlyph* glyphCacheEntries = nullptr;  // owned; GLYPH_CACHE_ENTRIES, sorted by (fontData, glyphIndex)
+  uint16_t glyphCacheCount = 0;
+  uint8_t* glyphCacheArena = nullptr;  // owned; freed in releaseGlyphCache()/dtor
+  uint32_t glyphCacheCapacity = 0;
+  uint32_t glyphCacheUsed = 0;
+  uint32_t glyphCacheUseCounter = 0;
+
   // Hot group: last decompressed group (byte-aligned) for non-prewarmed fallback path.
   // Kept in byte-aligned format; individual glyphs are compacted on demand into hotGlyphBuf.
   // Nothrow high-water malloc buffers, NOT std::vector: getBitmap() runs on the render path,
@@ -84,9 +140,23 @@ class FontDecompressor {
 
   void freePageBuffer();
   void freeHotGroup();
+  static bool hasResidentGroup(const EpdFontData* fontData);
+  const uint8_t* getResidentGroup(const EpdFontData* fontData);
+  bool loadResidentGroup(ResidentGroup& slot, const EpdFontData* fontData);
+  void shrinkResidentGroups();
+  static uint32_t getGlyphCount(const EpdFontData* fontData);
+  CachedGlyph* findCachedGlyph(const EpdFontData* fontData, uint32_t glyphIndex);
+  void cacheGlyph(const EpdFontData* fontData, uint32_t glyphIndex, const uint8_t* bitmap, uint16_t length);
+  // Reserves `length` bytes for a new entry; nullptr when already cached or there is no room.
+  uint8_t* allocCachedGlyph(const EpdFontData* fontData, uint32_t glyphIndex, uint16_t length);
+  void evictGlyphCache(uint32_t maxUsed, uint16_t maxCount);
+  void shrinkGlyphCache();
   uint16_t getGroupIndex(const EpdFontData* fontData, uint32_t glyphIndex);
   uint32_t getAlignedOffset(const EpdFontData* fontData, uint16_t groupIndex, uint32_t glyphIndex);
   bool decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, uint8_t* outBuf, uint32_t outSize);
   static void compactSingleGlyph(const uint8_t* alignedSrc, uint8_t* packedDst, uint8_t width, uint8_t height);
+  // Byte-aligned rows for a getBitmap() caller: in place when it takes a row stride (or the rows are
+  // already packed), else compacted into hotGlyphBuf
+  const uint8_t* alignedBitmap(const uint8_t* rows, const EpdGlyph* glyph, uint8_t* rowStride);
   static int32_t findGlyphIndex(const EpdFontData* fontData, uint32_t codepoint);
 };
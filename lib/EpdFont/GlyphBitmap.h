@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+// Walking decoded 2-bit glyph bitmaps (raw values 0 = white ... 3 = black, four pixels per byte, MSB
+// first). Bitmaps come in two layouts: packed, where rows run on from each other (dataLength bytes,
+// as stored for uncompressed fonts and the resident group), and byte-aligned, where every row starts
+// on a new byte (rowStride = (width + 3) / 4 bytes per row, as inflated from compressed groups).
+namespace GlyphBitmap {
+
+// Bytes per row of a byte-aligned glyph
+inline uint32_t alignedRowBytes(const uint8_t width) { return (width + 3) / 4; }
+
+// Calls fn(glyphX, glyphY, rawValue) for each non-white pixel, row by row. rowStride is the bytes per
+// row of a byte-aligned bitmap, or 0 for a packed one. All-white bytes are skipped four pixels at a
+// time; a skip that runs past the end of a packed row only covers pixels the next row re-reads.
+template <typename PixelFn>
+void forEachInkedPixel(const uint8_t* bitmap, const uint8_t width, const uint8_t height, const uint8_t rowStride,
+                       PixelFn&& fn) {
+  const uint32_t rowPixels = rowStride ? rowStride * 4u : width;
+  for (int glyphY = 0; glyphY < height; glyphY++) {
+    uint32_t pixelPosition = glyphY * rowPixels;
+    for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
+      const uint8_t byte = bitmap[pixelPosition >> 2];
+      if (byte == 0 && (pixelPosition & 3) == 0) {
+        // Four white pixels
+        glyphX += 3;
+        pixelPosition += 3;
+        continue;
+      }
+      const uint8_t raw = (byte >> ((3 - (pixelPosition & 3)) * 2)) & 0x3;
+      if (raw != 0) fn(glyphX, glyphY, raw);
+    }
+  }
+}
+
+}  // namespace GlyphBitmap
@@ -0,0 +1,29 @@
+#include "GlyphRle.h"
+
+#include <cstring>
+
+namespace GlyphRle {
+
+void decode(const uint8_t* src, uint8_t* packedDst, const uint8_t width, const uint8_t height) {
+  if (width == 0 || height == 0) return;
+  memset(packedDst, 0, (static_cast<uint32_t>(width) * height + 3) / 4);
+
+  forEachRun(src, width, height, [packedDst](uint32_t pos, uint32_t run, const uint8_t value) {
+    if (value == 0) return;  // white is already zero
+    // Head pixels up to a byte boundary, whole bytes, then the tail
+    for (; run > 0 && (pos & 3) != 0; pos++, run--) {
+      packedDst[pos >> 2] |= value << ((3 - (pos & 3)) * 2);
+    }
+    if (run >= 4) {
+      const uint8_t fill = value * 0x55;
+      memset(&packedDst[pos >> 2], fill, run >> 2);
+      pos += run & ~3u;
+      run &= 3;
+    }
+    for (; run > 0; pos++, run--) {
+      packedDst[pos >> 2] |= value << ((3 - (pos & 3)) * 2);
+    }
+  });
+}
+
+}  // namespace GlyphRle
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+// Per-glyph run-length encoding of 2-bit glyph bitmaps (EPD_BITMAP_RLE fonts, fontconvert.py --rle).
+//
+// Each glyph is an independent nibble stream starting at its dataOffset into EpdFontData::bitmap, so a
+// single glyph decodes without touching its neighbours or any group buffer. Pixels are covered in the
+// packed bitmap order (row-major, rows continuous); raw values are 0 = white ... 3 = black.
+//
+// Nibbles are read high nibble first:
+//   0x0       one light-gray pixel (1)
+//   0x1       one dark-gray pixel (2)
+//   0x2-0x7   white run of 1-6
+//   0x8 n     white run of 7 + n (7-22)
+//   0x9-0xD   black run of 1-5
+//   0xE n     black run of 6 + n (6-21)
+//   0xF h l   run of ((h << 4 | l) & 0x7F) + 1 (1-128), black if h & 0x8, else white
+// The stream ends once width * height pixels are covered; a trailing half byte is padding.
+namespace GlyphRle {
+
+// Calls fn(pixelPosition, runLength, rawValue) for each run, in pixel order.
+template <typename RunFn>
+void forEachRun(const uint8_t* src, const uint8_t width, const uint8_t height, RunFn&& fn) {
+  const uint32_t pixelCount = static_cast<uint32_t>(width) * height;
+  uint32_t nibble = 0;
+  auto next = [src, &nibble]() -> uint8_t {
+    const uint8_t byte = src[nibble >> 1];
+    return (nibble++ & 1) ? (byte & 0x0F) : (byte >> 4);
+  };
+
+  uint32_t pos = 0;
+  while (pos < pixelCount) {
+    const uint8_t code = next();
+    uint8_t value;
+    uint32_t run;
+    if (code <= 0x1) {
+      value = code + 1;
+      run = 1;
+    } else if (code <= 0x7) {
+      value = 0;
+      run = code - 1;
+    } else if (code == 0x8) {
+      value = 0;
+      run = 7 + next();
+    } else if (code <= 0xD) {
+      value = 3;
+      run = code - 8;
+    } else if (code == 0xE) {
+      value = 3;
+      run = 6 + next();
+    } else {
+      const uint8_t high = next();
+      const uint8_t low = next();
+      value = (high & 0x8) ? 3 : 0;
+      run = (((high & 0x7) << 4) | low) + 1;
+    }
+    if (run > pixelCount - pos) run = pixelCount - pos;  // malformed stream: never run past the glyph
+    fn(pos, run, value);
+    pos += run;
+  }
+}
+
+// Decodes a glyph stream into the packed 2-bit format (dataLength bytes) getBitmap() callers expect.
+void decode(const uint8_t* src, uint8_t* packedDst, uint8_t width, uint8_t height);
+
+}  // namespace GlyphRle
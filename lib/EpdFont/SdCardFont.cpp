@@ -113,6 +113,8 @@ void SdCardFont::freeStyleMiniKern(PerStyle& s) {
 
 void SdCardFont::freeStyleAll(PerStyle& s) {
   freeStyleMiniData(s);
+  delete[] s.miniGlyphLut;
+  s.miniGlyphLut = nullptr;
   delete[] s.fullIntervals;
   s.fullIntervals = nullptr;
   delete[] s.bmpIntervals;
@@ -127,6 +129,7 @@ void SdCardFont::freeStyleAll(PerStyle& s) {
 void SdCardFont::freeAll() {
   clearOverflow();
   clearPersistentCache();
+  releaseBlockCache();
   for (uint8_t i = 0; i < MAX_STYLES; i++) {
     freeStyleAll(styles_[i]);
   }
@@ -850,37 +853,24 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
   unsigned long sdStart = millis();
   uint32_t seekCount = 0;
 
-  // Read glyph metadata. lastReadIndex tracks sequential reads to skip redundant
-  // seeks; INT32_MIN guarantees the first iteration always seeks to the correct
-  // offset (otherwise when gIdx == 0, the "gIdx != lastReadIndex + 1" check would
-  // be false and we'd read from the file's current position — the header — which
-  // decodes to a garbage EpdGlyph with a massive advanceX, inflating any word
-  // containing that codepoint beyond page width).
-  int32_t lastReadIndex = INT32_MIN;
+  // Read glyph metadata in file order through the block cache
+  auto glyphFileOffset = [&s](int32_t gIdx) {
+    return s.glyphsFileOffset + static_cast<uint32_t>(gIdx) * sizeof(EpdGlyph);
+  };
   for (uint32_t i = 0; i < validCount; i++) {
     uint32_t mapIdx = readOrder[i];
     int32_t gIdx = mappings[mapIdx].globalIndex;
 
-    uint32_t fileOff = s.glyphsFileOffset + static_cast<uint32_t>(gIdx) * sizeof(EpdGlyph);
-    if (gIdx != lastReadIndex + 1) {
-      if (!file.seekSet(fileOff)) {
-        LOG_ERR("SDCF", "Prewarm: failed to seek to glyph %d (style %u)", gIdx, styleIdx);
-        file.close();
-        delete[] readOrder;
-        delete[] mappings;
-        freeStyleMiniData(s);
-        return static_cast<int>(cpCount);
-      }
-      seekCount++;
-    }
-    if (file.read(reinterpret_cast<uint8_t*>(&s.miniGlyphs[mapIdx]), sizeof(EpdGlyph)) != sizeof(EpdGlyph)) {
+    uint32_t fileOff = glyphFileOffset(gIdx);
+    uint32_t nextOff = i + 1 < validCount ? glyphFileOffset(mappings[readOrder[i + 1]].globalIndex) : UINT32_MAX;
+    if (!readPlanned(file, fileOff, &s.miniGlyphs[mapIdx], sizeof(EpdGlyph), nextOff, seekCount)) {
       LOG_ERR("SDCF", "Prewarm: short glyph read (style %u, glyph %d)", styleIdx, gIdx);
+      file.close();
       delete[] readOrder;
       delete[] mappings;
       freeStyleMiniData(s);
       return static_cast<int>(cpCount);
     }
-    lastReadIndex = gIdx;
   }
 
   uint32_t totalBitmapSize = 0;
@@ -892,6 +882,11 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
     }
 
     s.miniBitmap = new (std::nothrow) uint8_t[totalBitmapSize > 0 ? totalBitmapSize : 1];
+    if (!s.miniBitmap && blockData_) {
+      // The page's bitmaps matter more than the cross-page block cache
+      releaseBlockCache();
+      s.miniBitmap = new (std::nothrow) uint8_t[totalBitmapSize > 0 ? totalBitmapSize : 1];
+    }
     if (!s.miniBitmap) {
       LOG_ERR("SDCF", "Failed to allocate mini bitmap (%u bytes) for style %u", totalBitmapSize, styleIdx);
       delete[] readOrder;
@@ -905,7 +900,6 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
               [&](uint32_t a, uint32_t b) { return s.miniGlyphs[a].dataOffset < s.miniGlyphs[b].dataOffset; });
 
     uint32_t miniBitmapOffset = 0;
-    uint32_t lastBitmapEnd = UINT32_MAX;
     for (uint32_t i = 0; i < validCount; i++) {
       uint32_t mapIdx = readOrder[i];
       EpdGlyph& glyph = s.miniGlyphs[mapIdx];
@@ -916,25 +910,16 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
       }
 
       uint32_t fileOff = s.bitmapFileOffset + glyph.dataOffset;
-      if (fileOff != lastBitmapEnd) {
-        if (!file.seekSet(fileOff)) {
-          LOG_ERR("SDCF", "Prewarm: failed to seek to bitmap (style %u)", styleIdx);
-          file.close();
-          delete[] readOrder;
-          delete[] mappings;
-          freeStyleMiniData(s);
-          return static_cast<int>(cpCount);
-        }
-        seekCount++;
-      }
-      if (file.read(s.miniBitmap + miniBitmapOffset, glyph.dataLength) != static_cast<int>(glyph.dataLength)) {
+      uint32_t nextOff =
+          i + 1 < validCount ? s.bitmapFileOffset + s.miniGlyphs[readOrder[i + 1]].dataOffset : UINT32_MAX;
+      if (!readPlanned(file, fileOff, s.miniBitmap + miniBitmapOffset, glyph.dataLength, nextOff, seekCount)) {
         LOG_ERR("SDCF", "Prewarm: short bitmap read (style %u)", styleIdx);
+        file.close();
         delete[] readOrder;
         delete[] mappings;
         freeStyleMiniData(s);
         return static_cast<int>(cpCount);
       }
-      lastBitmapEnd = fileOff + glyph.dataLength;
 
       glyph.dataOffset = miniBitmapOffset;
       miniBitmapOffset += glyph.dataLength;
@@ -973,6 +958,18 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
   s.miniData.glyphMissHandler = &SdCardFont::onGlyphMiss;
   s.miniData.glyphMissCtx = &overflowCtx_[styleIdx];
 
+  // Rendering looks up every glyph and kern pair of the page; give the hot
+  // ranges a direct-index table. Layout (metadata-only) measures through the
+  // advance table instead, so it doesn't need one.
+  if (!metadataOnly) {
+    if (!s.miniGlyphLut) {
+      s.miniGlyphLut = new (std::nothrow) EpdGlyphLutEntry[EPD_GLYPH_LUT_SIZE];
+    }
+    if (s.miniGlyphLut && EpdFont::buildGlyphLut(s.miniData, s.miniGlyphLut)) {
+      s.miniData.glyphLut = s.miniGlyphLut;
+    }
+  }
+
   s.epdFont.data = &s.miniData;
 
   // Accumulate stats
@@ -998,6 +995,88 @@ void SdCardFont::clearCache() {
   }
 }
 
+// --- File block cache ---
+
+void SdCardFont::releaseBlockCache() {
+  delete[] blockData_;
+  blockData_ = nullptr;
+  for (auto& block : blocks_) block = CachedBlock{};
+  blockUseCounter_ = 0;
+}
+
+int SdCardFont::findBlock(uint32_t blockIndex) {
+  for (int i = 0; i < BLOCK_COUNT; i++) {
+    if (blocks_[i].blockIndex == blockIndex) {
+      blocks_[i].lastUse = ++blockUseCounter_;
+      return i;
+    }
+  }
+  return -1;
+}
+
+int SdCardFont::loadBlock(HalFile& file, uint32_t blockIndex, uint32_t& seekCount) {
+  if (!blockData_) {
+    blockData_ = new (std::nothrow) uint8_t[BLOCK_COUNT * BLOCK_SIZE];
+    if (!blockData_) return -1;
+  }
+
+  // Empty slots have lastUse 0, so they are taken before any live block is evicted
+  int slot = 0;
+  for (int i = 1; i < BLOCK_COUNT; i++) {
+    if (blocks_[i].lastUse < blocks_[slot].lastUse) slot = i;
+  }
+  blocks_[slot] = CachedBlock{};
+
+  const uint32_t fileOff = blockIndex * BLOCK_SIZE;
+  if (file.position() != fileOff) {
+    if (!file.seekSet(fileOff)) return -1;
+    seekCount++;
+  }
+  const int bytesRead = file.read(blockData_ + slot * BLOCK_SIZE, BLOCK_SIZE);
+  if (bytesRead <= 0) return -1;
+
+  blocks_[slot].blockIndex = blockIndex;
+  blocks_[slot].length = static_cast<uint32_t>(bytesRead);
+  blocks_[slot].lastUse = ++blockUseCounter_;
+  stats_.blockLoads++;
+  return slot;
+}
+
+bool SdCardFont::readPlanned(HalFile& file, uint32_t fileOffset, void* dst, uint32_t length, uint32_t nextOffset,
+                             uint32_t& seekCount) {
+  auto* out = static_cast<uint8_t*>(dst);
+  while (length > 0) {
+    const uint32_t blockIndex = fileOffset / BLOCK_SIZE;
+    const uint32_t inBlock = fileOffset % BLOCK_SIZE;
+
+    int slot = findBlock(blockIndex);
+    if (slot >= 0) {
+      stats_.blockHits++;
+    } else {
+      const bool blockShared =
+          inBlock + length > BLOCK_SIZE || (nextOffset != UINT32_MAX && nextOffset / BLOCK_SIZE == blockIndex);
+      if (blockShared) slot = loadBlock(file, blockIndex, seekCount);
+      if (slot < 0) {
+        // Isolated read, or no heap for the cache: read straight into dst
+        if (file.position() != fileOffset) {
+          if (!file.seekSet(fileOffset)) return false;
+          seekCount++;
+        }
+        return file.read(out, length) == static_cast<int>(length);
+      }
+    }
+
+    const CachedBlock& block = blocks_[slot];
+    if (inBlock >= block.length) return false;  // past the end of the file
+    const uint32_t chunk = std::min(length, block.length - inBlock);
+    memcpy(out, blockData_ + slot * BLOCK_SIZE + inBlock, chunk);
+    out += chunk;
+    fileOffset += chunk;
+    length -= chunk;
+  }
+  return true;
+}
+
 // --- Advance table ---
 
 void SdCardFont::clearPersistentCache() {
@@ -1158,26 +1237,23 @@ int SdCardFont::fetchAdvancesForCodepoints(uint32_t* codepoints, uint32_t cpCoun
     }
 
     uint32_t fetched = 0;
+    uint32_t seekCount = 0;
     EpdGlyph tempGlyph;
-    int32_t lastReadIndex = INT32_MIN;
     for (uint32_t i = 0; i < needCount; i++) {
       int32_t gIdx = mappings[i].glyphIndex;
       uint32_t fileOff = s.glyphsFileOffset + static_cast<uint32_t>(gIdx) * sizeof(EpdGlyph);
-      if (gIdx != lastReadIndex + 1) {
-        if (!file.seekSet(fileOff)) {
-          LOG_ERR("SDCF", "buildAdvanceTable: failed to seek to glyph %d (style %u)", gIdx, si);
-          break;
-        }
-      }
-      if (file.read(reinterpret_cast<uint8_t*>(&tempGlyph), sizeof(EpdGlyph)) != sizeof(EpdGlyph)) {
+      uint32_t nextOff = i + 1 < needCount
+                             ? s.glyphsFileOffset + static_cast<uint32_t>(mappings[i + 1].glyphIndex) * sizeof(EpdGlyph)
+                             : UINT32_MAX;
+      if (!readPlanned(file, fileOff, &tempGlyph, sizeof(EpdGlyph), nextOff, seekCount)) {
         LOG_ERR("SDCF", "buildAdvanceTable: short glyph read (style %u, glyph %d)", si, gIdx);
         break;
       }
-      lastReadIndex = gIdx;
       staged[fetched].codepoint = mappings[i].codepoint;
       staged[fetched].advanceX = tempGlyph.advanceX;
       fetched++;
     }
+    stats_.seekCount += seekCount;
     file.close();
 
     if (fetched > 0) {
@@ -1243,8 +1319,9 @@ int SdCardFont::buildAdvanceTable(const std::vector<std::string>& words, bool in
 // --- Stats ---
 
 void SdCardFont::logStats(const char* label) {
-  LOG_DBG("SDCF", "[%s] total=%ums sd_read=%ums seeks=%u glyphs=%u bitmap=%u bytes", label, stats_.prewarmTotalMs,
-          stats_.sdReadTimeMs, stats_.seekCount, stats_.uniqueGlyphs, stats_.bitmapBytes);
+  LOG_DBG("SDCF", "[%s] total=%ums sd_read=%ums seeks=%u blocks=%u hit/%u read glyphs=%u bitmap=%u bytes", label,
+          stats_.prewarmTotalMs, stats_.sdReadTimeMs, stats_.seekCount, stats_.blockHits, stats_.blockLoads,
+          stats_.uniqueGlyphs, stats_.bitmapBytes);
 }
 
 void SdCardFont::resetStats() { stats_ = Stats{}; }
@@ -7,6 +7,8 @@
 #include "EpdFont.h"
 #include "EpdFontData.h"
 
+class HalFile;
+
 // On-disk binary format version for .cpfont files. Defined as a preprocessor
 // macro (rather than a constexpr) so it can be stringified into the SD-fonts
 // release URL — see FONT_MANIFEST_URL in FontDownloadActivity.h. No integer
@@ -67,6 +69,9 @@ class SdCardFont {
   // when font/size/family/glyph-table state changes.
   void clearPersistentCache();
 
+  // Free the file block cache, which clearCache() keeps across pages.
+  void releaseBlockCache();
+
   // Returns pointer to the managed EpdFont for a given style.
   // Returns nullptr if the style is not present.
   EpdFont* getEpdFont(uint8_t style = 0);
@@ -98,6 +103,8 @@ class SdCardFont {
     uint32_t prewarmTotalMs = 0;
     uint32_t sdReadTimeMs = 0;
     uint32_t seekCount = 0;
+    uint32_t blockHits = 0;
+    uint32_t blockLoads = 0;
     uint32_t uniqueGlyphs = 0;
     uint32_t bitmapBytes = 0;
   };
@@ -185,6 +192,11 @@ class SdCardFont {
     uint8_t miniKernRightClassCount = 0;
     int8_t* miniKernMatrix = nullptr;
 
+    // Direct-index glyph/kern-class table over miniData, rebuilt on each full
+    // prewarm (mini glyph indices and kern classes change per page). Allocated
+    // on the first full prewarm and kept until the style is freed (~2KB).
+    EpdGlyphLutEntry* miniGlyphLut = nullptr;
+
     // The EpdFont whose data pointer we manage
     EpdFont epdFont{&stubData};
 
@@ -233,6 +245,33 @@ class SdCardFont {
   // advance table for styleIdx, preserving sort order; cap-truncates the tail.
   void mergeIntoAdvanceTable(uint8_t styleIdx, const AdvanceEntry* sortedNew, uint32_t newCount);
 
+  // Small LRU cache of BLOCK_SIZE-aligned .cpfont blocks, shared by all styles.
+  // Prewarm and advance fetches read glyph records and bitmaps in file order, so
+  // neighbouring reads land in one block and cost a single large sequential read
+  // instead of a seek + small read each. Blocks survive clearCache(), so the
+  // records and bitmaps of a book's common glyphs are served from RAM on later
+  // pages. Allocated on first use (16KB); released with the font, by
+  // releaseBlockCache(), or when prewarm needs the heap for the mini bitmap.
+  static constexpr uint32_t BLOCK_SIZE = 4096;
+  static constexpr uint8_t BLOCK_COUNT = 4;
+  struct CachedBlock {
+    uint32_t blockIndex = UINT32_MAX;  // file offset / BLOCK_SIZE; UINT32_MAX = empty slot
+    uint32_t length = 0;               // short only for the file's last block
+    uint32_t lastUse = 0;
+  };
+  uint8_t* blockData_ = nullptr;  // BLOCK_COUNT * BLOCK_SIZE bytes
+  CachedBlock blocks_[BLOCK_COUNT] = {};
+  uint32_t blockUseCounter_ = 0;
+  // Slot holding blockIndex (refreshing its LRU stamp), or -1.
+  int findBlock(uint32_t blockIndex);
+  // Reads blockIndex into the least recently used slot; -1 on allocation or read failure.
+  int loadBlock(HalFile& file, uint32_t blockIndex, uint32_t& seekCount);
+  // Copies [fileOffset, fileOffset + length) to dst. nextOffset is where the caller's
+  // next read starts (UINT32_MAX if none): a missing block is loaded whole only when
+  // that read or the rest of this one needs it too, isolated reads go straight to dst.
+  bool readPlanned(HalFile& file, uint32_t fileOffset, void* dst, uint32_t length, uint32_t nextOffset,
+                   uint32_t& seekCount);
+
   Stats stats_;
   uint32_t contentHash_ = 0;
   bool loaded_ = false;
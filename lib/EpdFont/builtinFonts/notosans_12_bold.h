@@ -3,1674 +3,1678 @@
  * name: notosans_12_bold
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_12_bold 12 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_12_bold 12 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_boldBitmaps[26577] = {
-    0xB5, 0x58, 0xBF, 0x93, 0xDD, 0x56, 0x15, 0x3E, 0x4F, 0x8F, 0xF8, 0x0D, 0x56, 0x21, 0x0A, 0xCC,
-    0x78, 0xEC, 0x42, 0x4D, 0x9A, 0x2C, 0xC6, 0x6A, 0x68, 0x28, 0xF0, 0x15, 0xE3, 0xC2, 0x45, 0x0A,
-    0x5C, 0x78, 0x43, 0x91, 0x02, 0x4A, 0x8F, 0x29, 0xCC, 0x1F, 0x00, 0x7B, 0x95, 0x71, 0x41, 0x91,
-    0x22, 0xDB, 0xA4, 0xA2, 0xC0, 0x45, 0x0A, 0xD8, 0x14, 0xDB, 0x50, 0x7A, 0xF7, 0xDE, 0x4C, 0x0A,
-    0x8A, 0x14, 0x96, 0x99, 0xA1, 0x46, 0x01, 0x67, 0x18, 0xA0, 0xB0, 0x0C, 0x1A, 0xA2, 0xB5, 0x25,
-    0x5D, 0xBE, 0xEF, 0xDC, 0xF7, 0xDE, 0xBE, 0xB5, 0xD7, 0x36, 0x31, 0x83, 0x74, 0xCF, 0xDD, 0xB7,
-    0xD2, 0xFD, 0x71, 0xEE, 0x39, 0xDF, 0xF9, 0x25, 0x5B, 0xB9, 0xCA, 0x56, 0xB6, 0x8C, 0xB7, 0x29,
-    0x8D, 0xC4, 0x9B, 0xD7, 0x65, 0x71, 0x7C, 0x5B, 0x7E, 0x4D, 0x6C, 0x56, 0x6B, 0xF3, 0x46, 0xDB,
-    0x95, 0xD4, 0xBF, 0x75, 0xA6, 0x92, 0xEC, 0x6A, 0x2D, 0xF9, 0xB5, 0x5A, 0x8A, 0x85, 0x97, 0x22,
-    0xF5, 0x82, 0x37, 0x79, 0x08, 0x53, 0x01, 0xBA, 0x30, 0xB9, 0xBF, 0xC9, 0xBD, 0x42, 0x64, 0x30,
-    0x72, 0x6E, 0xB4, 0x37, 0x6C, 0x08, 0x03, 0x29, 0x69, 0xEF, 0xC9, 0xBC, 0x1D, 0x64, 0xDE, 0xF4,
-    0x32, 0xAF, 0x3B, 0x59, 0x3C, 0xE8, 0x44, 0x2E, 0x89, 0xD2, 0x22, 0xF4, 0x82, 0xB9, 0xE2, 0xC2,
-    0x28, 0xE1, 0xD2, 0x79, 0x90, 0x88, 0xBB, 0x27, 0x62, 0x47, 0x91, 0x3C, 0xD4, 0x92, 0x84, 0x41,
-    0xC4, 0x04, 0x91, 0xEF, 0x80, 0x2E, 0xD9, 0xF2, 0xE1, 0x25, 0x27, 0x01, 0xE3, 0xB1, 0xAC, 0x5C,
-    0x0C, 0xBB, 0xEB, 0x75, 0xE4, 0x9B, 0xB2, 0xBC, 0x16, 0xA3, 0x2C, 0xC0, 0x62, 0x90, 0x0C, 0xCC,
-    0xED, 0x57, 0x45, 0x49, 0x16, 0x71, 0xB6, 0x2B, 0x99, 0x3F, 0x40, 0x9F, 0x7E, 0xD2, 0xF3, 0xF7,
-    0xA7, 0x2D, 0x96, 0xCD, 0x7E, 0xFF, 0xF9, 0x28, 0xC5, 0xFE, 0xFD, 0xCF, 0x42, 0x95, 0x85, 0xFC,
-    0x87, 0x8F, 0xFC, 0x62, 0x34, 0xF9, 0xB5, 0x46, 0xE4, 0xA0, 0xB8, 0x8A, 0x7E, 0x28, 0xAE, 0xB6,
-    0x92, 0x74, 0xEC, 0x17, 0x4D, 0x81, 0xE7, 0x99, 0xCF, 0xEE, 0x63, 0xE9, 0x2A, 0x0D, 0x58, 0x1A,
-    0xAC, 0xC9, 0xC6, 0x35, 0x0B, 0x98, 0x91, 0x92, 0xDB, 0x2C, 0x4C, 0xE0, 0xDD, 0xAF, 0xBB, 0x07,
-    0x38, 0x4A, 0xF6, 0x14, 0x2F, 0xE6, 0xA1, 0xE5, 0x81, 0xAB, 0xAD, 0xAA, 0x08, 0xDE, 0x54, 0xF6,
-    0x51, 0xEB, 0xCA, 0x70, 0x6D, 0xC0, 0x61, 0x66, 0x3C, 0xBD, 0xD8, 0x5E, 0x42, 0x65, 0x3A, 0xA1,
-    0xCC, 0x28, 0x94, 0x50, 0x2E, 0xC2, 0x43, 0x5B, 0xEB, 0xF2, 0x56, 0x6F, 0x2A, 0xE9, 0x8A, 0xBC,
-    0x05, 0xA6, 0x16, 0x6D, 0x56, 0xE7, 0x9E, 0xAA, 0xB3, 0x72, 0x28, 0xE3, 0xC6, 0x7D, 0x28, 0x8E,
-    0xE3, 0xCA, 0xC2, 0x67, 0x7E, 0xD1, 0x26, 0x9D, 0x01, 0x1B, 0x59, 0xBD, 0x68, 0xE7, 0x5D, 0xD2,
-    0xCF, 0x06, 0x19, 0x4E, 0x0C, 0x1E, 0x66, 0x43, 0xD2, 0xCF, 0xB1, 0x5A, 0xCA, 0xD5, 0x20, 0x92,
-    0x52, 0x04, 0x0A, 0x24, 0xBD, 0x99, 0x27, 0xA5, 0x09, 0xAE, 0x32, 0x21, 0x54, 0xDF, 0x72, 0x5F,
-    0x94, 0x42, 0x6D, 0x3C, 0x85, 0x28, 0x1E, 0x0F, 0x10, 0x07, 0x84, 0x58, 0x62, 0xEC, 0xF7, 0xE5,
-    0x24, 0xED, 0xC8, 0x52, 0x3B, 0x41, 0x6E, 0xB9, 0xBD, 0xE7, 0xDF, 0xE3, 0xCA, 0x6A, 0x72, 0x5E,
-    0x54, 0x11, 0x70, 0xE7, 0x6E, 0xD8, 0x11, 0xF7, 0x70, 0x0C, 0x3B, 0x59, 0xB4, 0x92, 0x42, 0xD6,
-    0x10, 0x34, 0xA4, 0x5C, 0x71, 0x94, 0x13, 0x99, 0x04, 0xBC, 0x27, 0xC0, 0x50, 0xC7, 0xF7, 0xD9,
-    0x73, 0xEF, 0xD7, 0x5A, 0xA8, 0xA1, 0x84, 0x1E, 0xEA, 0x1F, 0xC5, 0x3C, 0x08, 0x78, 0xEF, 0x84,
-    0x18, 0x77, 0xFA, 0x4B, 0xC9, 0x6F, 0x10, 0x36, 0x34, 0x95, 0xF6, 0x3E, 0x60, 0xCE, 0xA4, 0x0A,
-    0x54, 0x4D, 0xF2, 0xC2, 0xFA, 0xCE, 0xCF, 0x03, 0xF0, 0xED, 0xED, 0x23, 0x6F, 0x0A, 0x7F, 0xBE,
-    0x00, 0xE6, 0x5F, 0xD5, 0xC8, 0x85, 0x7B, 0xA8, 0x28, 0x80, 0xE8, 0xCA, 0xBC, 0x76, 0xD5, 0x1B,
-    0xD8, 0x4D, 0x22, 0x55, 0xCA, 0xED, 0x0C, 0xB8, 0x58, 0x00, 0x11, 0x39, 0x00, 0x61, 0x3D, 0x76,
-    0x3C, 0xFE, 0x17, 0x73, 0xEA, 0x15, 0x71, 0xAD, 0x24, 0x3C, 0x04, 0x16, 0x26, 0x70, 0x17, 0xCA,
-    0xAC, 0x74, 0xD5, 0x89, 0x75, 0x3E, 0x1E, 0x95, 0xDB, 0x19, 0x11, 0xF7, 0x4E, 0x58, 0xBE, 0x2B,
-    0x6A, 0xFE, 0x7D, 0x13, 0x0B, 0x53, 0x75, 0x46, 0xE7, 0x76, 0x4B, 0xF9, 0x60, 0x5C, 0xC2, 0xBD,
-    0x41, 0x19, 0xA8, 0x00, 0xED, 0x80, 0x86, 0x09, 0x90, 0x9A, 0xA0, 0xD6, 0x09, 0x18, 0x07, 0xDF,
-    0xE5, 0x24, 0x76, 0x2F, 0xDC, 0x75, 0x21, 0xB4, 0xA4, 0x73, 0xDB, 0xE1, 0xBA, 0xCE, 0x5D, 0x52,
-    0x01, 0x29, 0x99, 0x15, 0x7D, 0x78, 0x43, 0x51, 0xA3, 0xB4, 0x4D, 0xFE, 0x1B, 0x00, 0x78, 0x90,
-    0xCB, 0xFB, 0x93, 0xE8, 0xC1, 0x54, 0x3B, 0xA4, 0x20, 0xBB, 0x49, 0x34, 0x74, 0x07, 0x0D, 0xDD,
-    0x8E, 0xC7, 0x5B, 0x4A, 0x7A, 0xD2, 0x33, 0x2C, 0x40, 0x19, 0x58, 0xA5, 0x14, 0xB9, 0x9E, 0x3D,
-    0xB3, 0x2B, 0xD6, 0x0E, 0x18, 0x8F, 0x79, 0x5F, 0x04, 0x00, 0x64, 0xA5, 0xB9, 0xC2, 0x53, 0x67,
-    0xF8, 0x55, 0x41, 0x2E, 0xD0, 0x1A, 0xE5, 0x10, 0xCF, 0x88, 0xB1, 0x7E, 0x45, 0xE7, 0xB6, 0x6D,
-    0x45, 0xD3, 0xE1, 0xDE, 0x32, 0x83, 0x19, 0xCE, 0x21, 0xE4, 0x05, 0xC6, 0xA5, 0x10, 0x34, 0x30,
-    0x14, 0x37, 0xA2, 0x28, 0xCB, 0x93, 0x43, 0xFA, 0xC8, 0x56, 0x82, 0xB3, 0xE4, 0x3C, 0xE3, 0x53,
-    0x22, 0x29, 0x10, 0x49, 0x8A, 0xA1, 0xE2, 0xCF, 0xE0, 0x13, 0x67, 0x98, 0x2B, 0xDA, 0x3A, 0x31,
-    0x7F, 0x85, 0xBC, 0x4A, 0x18, 0x33, 0xDE, 0x4E, 0x4B, 0xA4, 0xD9, 0xBF, 0x07, 0xD5, 0xDB, 0x62,
-    0x2D, 0x7B, 0xAE, 0x07, 0xFF, 0xC9, 0xF1, 0xE0, 0xD7, 0xBE, 0x87, 0x33, 0x61, 0x56, 0x5C, 0x59,
-    0x57, 0xAF, 0xDC, 0x7B, 0x41, 0xCD, 0x2D, 0x0F, 0xB6, 0x4A, 0x8E, 0x54, 0x02, 0x91, 0xF7, 0xF9,
-    0x28, 0x97, 0xD5, 0x51, 0x36, 0xAA, 0xB2, 0x93, 0x7E, 0xFA, 0xF8, 0x3A, 0x7E, 0x96, 0x56, 0x79,
-    0x53, 0x34, 0x59, 0x2D, 0x27, 0xAE, 0x93, 0xA6, 0x87, 0xF3, 0x52, 0xF4, 0x51, 0x4B, 0xAA, 0x01,
-    0x9C, 0x16, 0x12, 0x70, 0x98, 0x45, 0x2C, 0xD9, 0xA3, 0x28, 0x01, 0xDD, 0x52, 0x35, 0x99, 0xEB,
-    0xAC, 0x5B, 0x7B, 0x7B, 0x6B, 0x23, 0x5F, 0x5D, 0x6E, 0xF9, 0x3F, 0x09, 0x6C, 0x0B, 0xCF, 0x1C,
-    0xC8, 0x7F, 0x47, 0x8F, 0xB7, 0xFC, 0x71, 0x26, 0xC4, 0x75, 0x0A, 0x78, 0x68, 0x48, 0xCE, 0x1D,
-    0xC5, 0x7D, 0x38, 0xB6, 0x8C, 0xCB, 0xA4, 0xD0, 0x71, 0xE8, 0x00, 0x9F, 0xEF, 0x25, 0x60, 0x64,
-    0xA4, 0x42, 0xA0, 0x0F, 0x98, 0x05, 0x8C, 0x44, 0x3D, 0xC0, 0xAC, 0x5F, 0xED, 0xF8, 0x3B, 0xBE,
-    0x81, 0x5C, 0xE0, 0x13, 0xE4, 0x1B, 0x60, 0x14, 0x26, 0x27, 0x74, 0x9A, 0x25, 0xB6, 0xF8, 0xF0,
-    0x76, 0x43, 0x35, 0xCF, 0x7B, 0xA0, 0xF9, 0x8D, 0x12, 0x2E, 0xFE, 0x07, 0x61, 0xB8, 0x22, 0x06,
-    0xC6, 0x5D, 0xC8, 0x2F, 0x72, 0x3F, 0xE4, 0x88, 0x52, 0xE5, 0x90, 0x97, 0x88, 0x53, 0xCB, 0xBE,
-    0x40, 0xCC, 0x9A, 0xE1, 0xC7, 0xBD, 0xE2, 0xCE, 0xB0, 0x23, 0x07, 0x19, 0x3D, 0xB0, 0x99, 0x4F,
-    0x79, 0xA3, 0x38, 0x54, 0xB0, 0xCC, 0x68, 0x36, 0xDB, 0x0A, 0x64, 0x3D, 0x78, 0x1A, 0xB8, 0x63,
-    0x36, 0xB0, 0x1B, 0x75, 0x6F, 0x74, 0x86, 0xEF, 0xAD, 0x42, 0x8A, 0xD8, 0x9A, 0xE0, 0x42, 0x66,
-    0x23, 0x26, 0x27, 0x43, 0xD6, 0x82, 0x61, 0x30, 0xB5, 0x38, 0x7A, 0xB7, 0xC7, 0x5C, 0xAC, 0x8F,
-    0x4D, 0x46, 0x9A, 0x35, 0x10, 0x53, 0x43, 0xC9, 0x30, 0x5D, 0x57, 0x02, 0xAF, 0xD6, 0xE3, 0x0C,
-    0x40, 0x36, 0x82, 0x1B, 0xDF, 0x31, 0x0C, 0x20, 0x3E, 0x78, 0x0E, 0x88, 0xE4, 0xAA, 0xF0, 0x31,
-    0x9F, 0xF7, 0x51, 0xE2, 0x33, 0xB7, 0x7C, 0x5E, 0xD4, 0xF8, 0x0B, 0xC2, 0xFF, 0xC0, 0x50, 0x9C,
-    0xFB, 0x70, 0x69, 0x5F, 0x61, 0x77, 0x06, 0x3B, 0x5E, 0x84, 0xD0, 0x64, 0x63, 0x52, 0x17, 0x4D,
-    0xF4, 0x14, 0x76, 0x09, 0xFD, 0x4D, 0xB2, 0x2B, 0x0F, 0x83, 0x31, 0x79, 0x2F, 0xBB, 0xE0, 0xB2,
-    0x49, 0x82, 0x1A, 0x75, 0x15, 0x35, 0x4D, 0xBE, 0x46, 0xD1, 0x3D, 0xB6, 0x43, 0x83, 0x7D, 0x5B,
-    0xC4, 0xDA, 0x2E, 0xC0, 0x6A, 0x02, 0x8E, 0x78, 0x92, 0xF8, 0x8C, 0xEF, 0x30, 0x06, 0xAE, 0x39,
-    0xF2, 0xC5, 0xB9, 0xBB, 0x58, 0xA7, 0xC3, 0x11, 0xD8, 0xB6, 0xAF, 0x07, 0x05, 0x39, 0x5B, 0x68,
-    0x97, 0x6D, 0xF3, 0x21, 0x9F, 0xF7, 0xB1, 0xE9, 0x2C, 0x6D, 0xCF, 0x0E, 0x58, 0x4D, 0xDC, 0x7C,
-    0xB8, 0x6A, 0x7A, 0x5D, 0xC4, 0x19, 0x20, 0xF6, 0x39, 0x26, 0xC3, 0xF5, 0xFD, 0xAC, 0xA0, 0xAF,
-    0xAD, 0xD5, 0xFD, 0x2E, 0xE5, 0x10, 0x06, 0x92, 0x25, 0x55, 0xC9, 0x60, 0x3C, 0xA8, 0x49, 0x86,
-    0xBC, 0x4F, 0x06, 0xAA, 0x2B, 0xA1, 0xCA, 0x6C, 0x14, 0xA8, 0x03, 0xB4, 0x9E, 0x3F, 0xEB, 0x92,
-    0x30, 0x6E, 0x4D, 0xDB, 0x3F, 0x1A, 0x5E, 0x38, 0x0E, 0x64, 0x90, 0x06, 0x04, 0x5F, 0x84, 0x92,
-    0x50, 0x7E, 0x55, 0xCB, 0x43, 0x19, 0xC7, 0xD3, 0x99, 0x86, 0xD7, 0x69, 0xF0, 0xFC, 0x14, 0x7E,
-    0x2F, 0xD1, 0xF5, 0x3A, 0xC9, 0xDA, 0x88, 0x1A, 0x20, 0x0A, 0x76, 0x19, 0xB0, 0x49, 0x80, 0xFB,
-    0x0D, 0x80, 0x07, 0x1C, 0x10, 0x84, 0x45, 0xF2, 0x12, 0x1E, 0xB5, 0x12, 0xDE, 0xEE, 0xE3, 0x7B,
-    0x78, 0x70, 0xDC, 0xF0, 0x5A, 0x96, 0x88, 0x6B, 0xA8, 0xDD, 0xAF, 0xC6, 0x0E, 0x25, 0xC3, 0x06,
-    0x2F, 0x93, 0x8D, 0x48, 0x88, 0x72, 0x76, 0xC5, 0x48, 0xAF, 0x38, 0x82, 0x35, 0x3B, 0x4E, 0x83,
-    0x1C, 0x8C, 0xD3, 0x81, 0x0C, 0xE3, 0xB4, 0x23, 0xFD, 0x38, 0x99, 0xA4, 0x43, 0x77, 0xB5, 0x1D,
-    0xA7, 0xE2, 0x4E, 0x33, 0x4E, 0xD9, 0x67, 0x35, 0xBA, 0xFB, 0x7E, 0x9C, 0xD2, 0x47, 0xE8, 0xE0,
-    0x5C, 0xC6, 0x69, 0x1E, 0x64, 0x9C, 0x12, 0x76, 0x70, 0x18, 0xA3, 0xF3, 0x70, 0x9B, 0x58, 0x14,
-    0x5D, 0xC7, 0x6E, 0x60, 0x07, 0x07, 0x2D, 0x23, 0xB8, 0x96, 0x09, 0x89, 0xAF, 0x4C, 0xA6, 0x46,
-    0x97, 0xB5, 0xE8, 0xD2, 0x0E, 0xDD, 0x7C, 0x40, 0x37, 0x9B, 0x0C, 0x9C, 0x4C, 0xC0, 0x2F, 0xE8,
-    0x59, 0xA3, 0x9C, 0xD0, 0xCD, 0x0B, 0xB3, 0x02, 0x74, 0xF3, 0x15, 0x90, 0x0A, 0xC8, 0x05, 0x68,
-    0xE8, 0x68, 0xC5, 0x30, 0xE0, 0x7E, 0x11, 0x68, 0x2C, 0xF0, 0xDC, 0xD8, 0xD7, 0x43, 0x6E, 0x8C,
-    0x4A, 0x80, 0x16, 0x8C, 0xA9, 0xD8, 0xE8, 0xF4, 0x05, 0x86, 0xA0, 0x6B, 0x20, 0x70, 0xC0, 0x2A,
-    0xC4, 0x05, 0x12, 0x5A, 0x32, 0xC2, 0x61, 0xB5, 0xF4, 0xA4, 0x53, 0xB5, 0xB4, 0x6D, 0xF0, 0xF2,
-    0x0E, 0xA5, 0xCD, 0xB8, 0x62, 0x97, 0x84, 0xFB, 0xDD, 0xB0, 0xB4, 0x3F, 0x68, 0x6A, 0xAF, 0x54,
-    0x78, 0x9F, 0x46, 0xFF, 0x07, 0x5E, 0xA7, 0x35, 0xAF, 0xC4, 0x0F, 0x0D, 0x28, 0xBA, 0xBF, 0xB9,
-    0x86, 0x24, 0x3D, 0xC0, 0xB9, 0xF2, 0x98, 0x7F, 0xCD, 0x6B, 0x4B, 0x45, 0x17, 0x2C, 0x6C, 0xCD,
-    0xFF, 0x8A, 0x77, 0x9A, 0x23, 0xE2, 0x70, 0x44, 0xD5, 0x24, 0xFA, 0x4E, 0x51, 0x45, 0x1F, 0x96,
-    0xB5, 0x31, 0xF5, 0x41, 0x4E, 0x66, 0x68, 0x8F, 0x37, 0x9D, 0xE6, 0x10, 0x48, 0x86, 0xCD, 0x08,
-    0x9D, 0x54, 0x09, 0x55, 0x3B, 0x68, 0x1E, 0x83, 0x16, 0xBA, 0x64, 0x52, 0x54, 0x75, 0x51, 0x8C,
-    0x76, 0x99, 0xB7, 0x68, 0xEE, 0x62, 0xFF, 0x78, 0x5D, 0xE3, 0xFC, 0x6B, 0xD0, 0x4B, 0xED, 0xFC,
-    0x74, 0xEA, 0x5D, 0xB9, 0xE8, 0x6D, 0x9D, 0xB7, 0x86, 0xBE, 0x16, 0x26, 0xC4, 0xD4, 0x3E, 0x5A,
-    0x1B, 0x9A, 0xA3, 0xBE, 0x4C, 0x05, 0x94, 0xD2, 0xBD, 0x60, 0x0B, 0x1C, 0x3E, 0x6B, 0x10, 0x15,
-    0xB2, 0x16, 0xA2, 0x48, 0x5B, 0x06, 0x89, 0x0E, 0x51, 0x7B, 0x3E, 0x60, 0x77, 0xC4, 0x23, 0x1C,
-    0x66, 0x64, 0x00, 0x9A, 0x98, 0x07, 0xD8, 0x43, 0x06, 0x18, 0xAE, 0x66, 0x28, 0xF5, 0x9C, 0xA1,
-    0x90, 0xD9, 0xD2, 0xC4, 0x74, 0xC6, 0xA9, 0x39, 0x53, 0x82, 0x65, 0xDE, 0x09, 0x93, 0x90, 0xA2,
-    0xE7, 0x36, 0x95, 0x19, 0x74, 0x23, 0x73, 0x40, 0x17, 0xE2, 0x77, 0x0E, 0x19, 0x14, 0xEB, 0x43,
-    0xCB, 0x3D, 0x9B, 0xD1, 0xE8, 0xAE, 0x83, 0x79, 0x5B, 0xD3, 0xFA, 0xE2, 0x83, 0x46, 0xE6, 0xFF,
-    0xEE, 0x73, 0xD4, 0x38, 0xF3, 0xA7, 0x5D, 0xF6, 0x27, 0xCF, 0x7C, 0x3F, 0x7B, 0xC4, 0xFC, 0xB4,
-    0x4D, 0x29, 0xD8, 0x50, 0x6B, 0x2C, 0x0F, 0x5E, 0x6D, 0xC1, 0xE9, 0x1F, 0xEB, 0x67, 0x74, 0x22,
-    0x88, 0xC4, 0x59, 0x8B, 0xBC, 0x69, 0xD1, 0xF3, 0x0C, 0x23, 0x73, 0xD0, 0xA0, 0xAE, 0x55, 0xA3,
-    0xE2, 0xB4, 0x82, 0x4A, 0x3E, 0xAC, 0xFE, 0x75, 0x8C, 0xD4, 0x13, 0x40, 0x86, 0xB3, 0x36, 0x92,
-    0x76, 0x38, 0x49, 0xDE, 0x22, 0x09, 0x36, 0x35, 0xC0, 0x00, 0x50, 0x06, 0xE4, 0x53, 0xC9, 0x68,
-    0x21, 0xA1, 0xA2, 0xC6, 0x5B, 0x88, 0x26, 0xED, 0xB0, 0x0D, 0xFD, 0xF2, 0x48, 0x8F, 0x83, 0x35,
-    0x1C, 0x4B, 0xC3, 0x3E, 0xA6, 0xCD, 0xD9, 0x8B, 0x89, 0x9A, 0x58, 0x11, 0x32, 0x42, 0xAF, 0x71,
-    0x8E, 0x19, 0x38, 0x53, 0x3D, 0x8E, 0xC9, 0x97, 0xE1, 0x10, 0xAC, 0x32, 0xED, 0x60, 0xF6, 0xC7,
-    0xC7, 0x3C, 0x03, 0x91, 0xB4, 0x22, 0xD3, 0xDB, 0xDE, 0x7E, 0x64, 0xE5, 0x15, 0xF7, 0x47, 0xB6,
-    0x37, 0xFD, 0xA1, 0xA6, 0x6E, 0x50, 0x1D, 0xF4, 0x88, 0x3A, 0x14, 0x19, 0xC0, 0x82, 0xAA, 0x95,
-    0xA4, 0x67, 0x16, 0x23, 0x63, 0x44, 0xB3, 0x26, 0x9F, 0x9B, 0x23, 0x98, 0x27, 0xD9, 0xFE, 0xA7,
-    0x7D, 0xF2, 0x8A, 0xFB, 0xDB, 0x64, 0xA5, 0xD7, 0x7C, 0xAC, 0x28, 0x23, 0xF3, 0xCC, 0xDA, 0x50,
-    0x9D, 0x25, 0x8F, 0x91, 0x96, 0x36, 0x83, 0xA4, 0xF5, 0x8E, 0xB0, 0xEC, 0xCD, 0xCB, 0x1C, 0xE9,
-    0x5E, 0xE6, 0x51, 0x33, 0xEE, 0xC2, 0x92, 0x98, 0x79, 0xD2, 0xA2, 0x6B, 0xE8, 0xFF, 0xDE, 0xCC,
-    0xD5, 0x9A, 0xDE, 0xB2, 0x54, 0xF9, 0xBA, 0x2C, 0x53, 0x75, 0xB8, 0x1C, 0xC0, 0x16, 0x3A, 0xA2,
-    0x9B, 0x77, 0x74, 0x3F, 0xD1, 0x34, 0xFF, 0x01, 0x68, 0xC1, 0x37, 0xE6, 0x63, 0xA1, 0x70, 0x26,
-    0x34, 0x9F, 0xA3, 0xF7, 0xE1, 0xC4, 0x5D, 0x10, 0x2D, 0x3B, 0x1A, 0x94, 0x1F, 0xBE, 0xA8, 0x0D,
-    0xF6, 0x32, 0x55, 0xD6, 0x44, 0xCA, 0x1B, 0x7D, 0x56, 0x9B, 0x58, 0x9A, 0x70, 0xAC, 0x22, 0x82,
-    0x5B, 0x3F, 0x44, 0x7A, 0x96, 0x87, 0xDE, 0x34, 0x3F, 0x81, 0xFB, 0xD9, 0x8C, 0x29, 0xD0, 0x96,
-    0xF5, 0xE7, 0xC1, 0x7C, 0xC6, 0x28, 0x1C, 0xB3, 0xE9, 0x75, 0x3D, 0xB5, 0xA6, 0x64, 0x34, 0x3E,
-    0x0B, 0xFB, 0x5C, 0xD8, 0xDB, 0x07, 0xC8, 0xFF, 0xAB, 0x58, 0x27, 0x84, 0x0D, 0x72, 0xA8, 0x19,
-    0xE0, 0xF6, 0x74, 0x4C, 0x1E, 0x50, 0xEE, 0x87, 0xCC, 0xC7, 0xCD, 0x77, 0xB5, 0xF2, 0xE3, 0x87,
-    0x08, 0xCC, 0xE2, 0x37, 0x91, 0xCA, 0xA1, 0x76, 0x80, 0x0F, 0x63, 0x2E, 0xE5, 0xB5, 0x82, 0x51,
-    0x39, 0xCF, 0xA4, 0x78, 0xB2, 0xAF, 0x02, 0xD2, 0x9A, 0x6B, 0x95, 0xFD, 0xC2, 0x41, 0x76, 0xA8,
-    0xEE, 0x89, 0x7F, 0xB8, 0xDA, 0x69, 0xD7, 0x86, 0xC6, 0x85, 0x26, 0xED, 0xF8, 0xEF, 0x4B, 0x5A,
-    0x32, 0x9E, 0xAD, 0x32, 0xF0, 0x41, 0x7E, 0xE0, 0x84, 0x5F, 0xCE, 0xF3, 0x53, 0xF2, 0x1C, 0xC0,
-    0xF3, 0xF1, 0x99, 0xBF, 0x2B, 0x5A, 0x2F, 0x68, 0x3D, 0x71, 0x11, 0x4E, 0xF9, 0x54, 0xA5, 0xFC,
-    0xB2, 0xA7, 0x52, 0x4A, 0xDD, 0xA3, 0xB3, 0xB5, 0x2A, 0xC0, 0xE7, 0x4B, 0xC5, 0xBC, 0x98, 0x88,
-    0x2C, 0xEC, 0x5A, 0x5D, 0xC0, 0xF9, 0xB6, 0xB4, 0x4A, 0x3E, 0xFD, 0xC6, 0xEB, 0x83, 0x19, 0xE3,
-    0xE3, 0x4D, 0xFC, 0xFA, 0x2D, 0xFE, 0xBE, 0xE4, 0x86, 0x3D, 0x0F, 0xB0, 0x8E, 0xFA, 0x54, 0x3E,
-    0xAB, 0xB3, 0x77, 0xB1, 0x9E, 0xD7, 0x6A, 0xE8, 0x0E, 0x3C, 0xD7, 0x07, 0x00, 0xD3, 0x3E, 0xCE,
-    0xC4, 0x6F, 0x2D, 0x88, 0x15, 0x86, 0x19, 0xC2, 0xA7, 0xF0, 0x0F, 0xEF, 0x69, 0x55, 0xCF, 0xBD,
-    0x09, 0xAC, 0xF6, 0xC5, 0x9C, 0x6D, 0xDE, 0x5B, 0x69, 0x7F, 0xE6, 0x48, 0x8C, 0x0D, 0x85, 0x4A,
-    0x8C, 0xB2, 0x68, 0x5D, 0xA7, 0x40, 0x6C, 0x22, 0x28, 0x09, 0xCF, 0xC2, 0x7F, 0x95, 0x7E, 0x0B,
-    0xEA, 0x36, 0xE6, 0x35, 0x24, 0xBB, 0x89, 0xB6, 0xDA, 0xE9, 0xD7, 0x07, 0xA7, 0x79, 0x58, 0xAE,
-    0xE4, 0x34, 0x0C, 0xC3, 0x65, 0x43, 0xEB, 0xC5, 0x13, 0x54, 0xFD, 0x61, 0x5A, 0x57, 0xB7, 0x5B,
-    0xC0, 0x14, 0x4E, 0xF1, 0xDF, 0x9B, 0x18, 0xF7, 0xF8, 0xF5, 0x70, 0x3A, 0x32, 0x2A, 0xF9, 0x9F,
-    0x11, 0xF8, 0x2C, 0x6D, 0x2D, 0x1A, 0x53, 0x34, 0xC6, 0x35, 0x66, 0xDA, 0x45, 0xEE, 0x60, 0xE2,
-    0x17, 0x9A, 0xD3, 0xDA, 0x99, 0x09, 0x82, 0x43, 0x84, 0x46, 0x0A, 0x7A, 0x1D, 0xA1, 0xC0, 0xB1,
-    0x2A, 0x2E, 0x53, 0xD6, 0x19, 0x34, 0x8D, 0x72, 0xDE, 0x4D, 0xFB, 0xC8, 0xE7, 0x1B, 0x1B, 0xB4,
-    0xFE, 0xBA, 0x2B, 0x09, 0xFC, 0x27, 0x82, 0xD5, 0x93, 0xBB, 0x86, 0xDE, 0x38, 0x86, 0xCB, 0xE7,
-    0x1A, 0xA6, 0x86, 0x96, 0x9F, 0xD9, 0xF8, 0xA5, 0x0D, 0xB0, 0x3D, 0xBB, 0x6B, 0x21, 0x9C, 0x97,
-    0x11, 0x54, 0x09, 0x51, 0x59, 0xFD, 0xDC, 0x02, 0x97, 0x80, 0x00, 0xF7, 0xBE, 0x26, 0xC7, 0x7B,
-    0x72, 0xF6, 0xAE, 0x2B, 0x09, 0xAF, 0x9C, 0x8A, 0xF5, 0x51, 0xC4, 0xB6, 0x4C, 0x5B, 0x07, 0x47,
-    0x8D, 0x6C, 0xF0, 0x68, 0x40, 0x3E, 0x3D, 0x30, 0xF7, 0x10, 0xDD, 0xCD, 0x36, 0x5A, 0x4F, 0xDC,
-    0x92, 0x5B, 0xD5, 0x05, 0xA8, 0xD4, 0x79, 0x85, 0x72, 0x4D, 0x48, 0xE3, 0x14, 0x52, 0x7C, 0xF2,
-    0x25, 0x66, 0xE6, 0x7F, 0xF8, 0x27, 0xE6, 0x66, 0x7F, 0x79, 0xDC, 0x8D, 0x92, 0xFE, 0xEB, 0x73,
-    0xAC, 0xB1, 0xF8, 0xB2, 0x7E, 0x82, 0xF4, 0xFE, 0xA9, 0x9F, 0xF8, 0x39, 0xC1, 0xBB, 0x96, 0x1F,
-    0x09, 0x6C, 0x0B, 0x85, 0x97, 0xAC, 0xC0, 0x82, 0xAE, 0x49, 0xD3, 0x80, 0x4A, 0x91, 0xAF, 0x56,
-    0x29, 0x8A, 0xA9, 0xF9, 0xC4, 0xCF, 0x1D, 0x88, 0x52, 0x18, 0xAD, 0xA4, 0x9F, 0x22, 0xB0, 0x22,
-    0x8B, 0x2D, 0x8C, 0xE1, 0x58, 0x07, 0xD3, 0xD8, 0x93, 0x33, 0xEB, 0x33, 0x14, 0xCF, 0x9C, 0x01,
-    0xF2, 0x95, 0x04, 0xFB, 0xCF, 0x56, 0x67, 0xE0, 0x3A, 0xDC, 0x31, 0x7E, 0x3D, 0xD2, 0x9A, 0x88,
-    0xB5, 0x3A, 0x63, 0x35, 0x63, 0x2C, 0x4B, 0xA5, 0xAD, 0xBD, 0xDF, 0xC0, 0xD3, 0xD0, 0xD9, 0x20,
-    0x4E, 0x23, 0x42, 0x62, 0x28, 0xCB, 0x04, 0xC6, 0x51, 0x48, 0x9E, 0xB5, 0x72, 0x18, 0x6D, 0x98,
-    0xD0, 0xE4, 0x22, 0x9E, 0x23, 0x31, 0xF0, 0xFC, 0x68, 0xD7, 0x1F, 0x37, 0x24, 0x1F, 0x3F, 0xEE,
-    0x18, 0xAA, 0x60, 0x02, 0xB7, 0xB5, 0x40, 0xDF, 0x7C, 0xCB, 0xFA, 0x9E, 0x35, 0x07, 0x3F, 0xA3,
-    0xFD, 0xFC, 0x05, 0xD7, 0x4D, 0x7E, 0x34, 0xF0, 0x6C, 0x30, 0xA4, 0x6C, 0xB3, 0x21, 0x89, 0x38,
-    0x82, 0xF0, 0x4A, 0x48, 0x2E, 0x9D, 0xCA, 0xF8, 0x85, 0x70, 0xB3, 0xC5, 0x59, 0xFC, 0xE8, 0xD5,
-    0xCC, 0x90, 0x3E, 0xFC, 0x4A, 0x33, 0x54, 0x9F, 0x47, 0x2F, 0xFE, 0x1F, 0xBD, 0x59, 0x3F, 0x6C,
-    0xDD, 0xC6, 0x19, 0xFF, 0x48, 0xCA, 0x66, 0x6D, 0x0E, 0xE7, 0x41, 0x06, 0x12, 0xB8, 0x31, 0x3B,
-    0x64, 0x68, 0x0D, 0x5B, 0x5C, 0x35, 0x44, 0x3E, 0xC6, 0x05, 0x9A, 0xA1, 0x8B, 0x86, 0xCA, 0x1D,
-    0x3A, 0xB8, 0x63, 0x93, 0x21, 0x5E, 0x3C, 0xB8, 0x80, 0x9F, 0x8E, 0x72, 0x06, 0x0F, 0x1E, 0xA2,
-    0xA1, 0x40, 0x87, 0x00, 0x4D, 0x07, 0x0F, 0xAD, 0x3A, 0xD8, 0x83, 0x87, 0x0C, 0x96, 0x78, 0x75,
-    0x87, 0x0E, 0x59, 0xCE, 0x2E, 0x82, 0x0E, 0x5D, 0xD8, 0xC2, 0x40, 0x81, 0x66, 0x10, 0x5B, 0x30,
-    0x05, 0x25, 0x91, 0xBC, 0xFE, 0xBE, 0x23, 0xDF, 0xD3, 0x93, 0x2B, 0x3B, 0xB6, 0x9F, 0x65, 0x3E,
-    0x7E, 0x1F, 0xF8, 0xE7, 0xF8, 0xFD, 0xB9, 0xFB, 0xFE, 0xDE, 0x7B, 0x9B, 0x54, 0x96, 0x67, 0x2A,
-    0x3D, 0x4D, 0x44, 0xA7, 0x49, 0x8E, 0x7F, 0xA9, 0x1A, 0xFF, 0xF0, 0xF6, 0xA3, 0x14, 0x2F, 0x49,
-    0xF0, 0xE9, 0xE5, 0x3B, 0xA1, 0x6D, 0x63, 0xDB, 0x24, 0xC5, 0x9C, 0xD4, 0x24, 0xB3, 0xA9, 0x53,
-    0x53, 0x52, 0xBE, 0x2D, 0x6C, 0x8B, 0x01, 0x94, 0x3F, 0xE9, 0xC7, 0xD3, 0x31, 0x72, 0x87, 0xDA,
-    0x21, 0xDF, 0x5A, 0x0A, 0x6D, 0x47, 0x51, 0x35, 0x47, 0xA2, 0xA4, 0x09, 0xDC, 0xDD, 0xBD, 0x43,
-    0xD6, 0x56, 0x0E, 0xA6, 0x9F, 0x0B, 0x83, 0xCF, 0x32, 0xC2, 0x73, 0xAB, 0xC7, 0x00, 0x4A, 0x4B,
-    0x1F, 0xBE, 0xA7, 0x58, 0x82, 0x3A, 0x5E, 0xAB, 0x13, 0x6A, 0x24, 0x3D, 0x48, 0xD2, 0x3A, 0xFE,
-    0xBA, 0x92, 0xB6, 0x59, 0xB5, 0x9B, 0xF3, 0x34, 0x9F, 0x53, 0x54, 0xAA, 0x4C, 0x98, 0x44, 0x27,
-    0x5A, 0x18, 0x99, 0x46, 0x65, 0x4E, 0x41, 0xD5, 0x92, 0xBF, 0xD3, 0x80, 0x58, 0x45, 0x94, 0x97,
-    0x74, 0xDC, 0xEE, 0x52, 0x04, 0x79, 0x8E, 0xA9, 0xAF, 0x88, 0x12, 0xED, 0xAE, 0x19, 0xBC, 0xAB,
-    0xFD, 0x3D, 0xC3, 0x8D, 0xC9, 0xC1, 0x0A, 0xCC, 0x4F, 0xEE, 0x7E, 0x81, 0xBB, 0xC8, 0x66, 0xD2,
-    0x16, 0xEA, 0x47, 0x7A, 0x0B, 0x32, 0xA6, 0x94, 0x54, 0x14, 0xDB, 0x54, 0x2A, 0x33, 0x0A, 0xCB,
-    0xCD, 0xA0, 0x54, 0x3F, 0x2C, 0x93, 0x3D, 0x13, 0xDA, 0x8C, 0x94, 0x81, 0x30, 0x14, 0x94, 0x77,
-    0xA2, 0x22, 0xB7, 0x5A, 0x75, 0x4C, 0xE9, 0x7A, 0x94, 0x76, 0xB1, 0xDE, 0x8C, 0xF5, 0xFC, 0x30,
-    0x37, 0x74, 0x06, 0x23, 0x69, 0xEB, 0xB3, 0x9A, 0x82, 0x82, 0x12, 0x4C, 0xDA, 0x87, 0x91, 0xBE,
-    0x10, 0xDA, 0x87, 0x66, 0x31, 0x7E, 0x3F, 0x2D, 0xAF, 0x2D, 0x11, 0xDD, 0xBB, 0xF7, 0x1E, 0xD1,
-    0xB5, 0x12, 0x82, 0x2C, 0x3A, 0xE4, 0x6E, 0xF9, 0xC5, 0xFD, 0xC5, 0x84, 0xA8, 0x3C, 0x1F, 0xD9,
-    0x9B, 0x85, 0xF0, 0xB6, 0x42, 0x1D, 0x1A, 0x10, 0xF0, 0xBA, 0xCB, 0xD0, 0x34, 0xB6, 0x86, 0xC6,
-    0xC7, 0x99, 0x16, 0xB7, 0x34, 0x27, 0xD2, 0xE3, 0x77, 0x53, 0x69, 0xD3, 0x91, 0x48, 0x47, 0x09,
-    0x5F, 0x44, 0x37, 0x53, 0x3A, 0xE5, 0x11, 0x8D, 0xC0, 0xB8, 0x13, 0x65, 0xD0, 0x48, 0x2D, 0xCA,
-    0x3C, 0x4D, 0x1E, 0x75, 0x24, 0x1F, 0xB6, 0x58, 0x05, 0xAC, 0x58, 0x2D, 0xB5, 0xD7, 0x8A, 0x82,
-    0xB6, 0xC2, 0x92, 0xDE, 0xF5, 0x9D, 0x25, 0x60, 0x25, 0x1C, 0x7C, 0xB4, 0x91, 0xE3, 0x2E, 0x3E,
-    0x00, 0xA7, 0x7F, 0xA2, 0x5A, 0xFC, 0x9A, 0x43, 0x35, 0x3B, 0xF9, 0x2B, 0x68, 0x26, 0xEC, 0x25,
-    0xB3, 0x28, 0xCE, 0xE8, 0xF2, 0x9A, 0x08, 0xF4, 0xBD, 0x7B, 0x40, 0xD7, 0x4A, 0x71, 0x25, 0x5B,
-    0x2C, 0x45, 0x07, 0xCD, 0xC4, 0xC7, 0xD0, 0x4C, 0x88, 0xF4, 0xFE, 0xA2, 0x08, 0x75, 0x79, 0x5E,
-    0x04, 0x8F, 0x0B, 0x71, 0x82, 0x7E, 0x7D, 0xA8, 0x66, 0xA7, 0x57, 0x56, 0x96, 0xA5, 0xB5, 0x05,
-    0x03, 0x2F, 0x4A, 0x4D, 0xB2, 0xA3, 0x4D, 0x98, 0x83, 0xC8, 0x2A, 0x91, 0x35, 0x71, 0xAA, 0x2C,
-    0xC5, 0x0D, 0x79, 0x10, 0xFA, 0x07, 0x6C, 0x39, 0x07, 0x61, 0xAC, 0x45, 0x0E, 0x78, 0xFA, 0x1D,
-    0xCD, 0x13, 0x6D, 0x6C, 0x6C, 0x4C, 0xC6, 0xD0, 0x32, 0xC5, 0x2D, 0x49, 0x4B, 0x6F, 0xC9, 0x14,
-    0xEE, 0x41, 0x8A, 0xBC, 0x86, 0x30, 0x21, 0x31, 0x5C, 0xC0, 0x82, 0x4D, 0x76, 0x6E, 0x23, 0xC5,
-    0x98, 0xC4, 0x8D, 0x99, 0x8F, 0x53, 0x4C, 0x44, 0xD8, 0x52, 0x88, 0xF5, 0xC6, 0xB5, 0xC8, 0x7E,
-    0x79, 0x35, 0x83, 0x28, 0x67, 0x9E, 0x38, 0x21, 0xE3, 0x42, 0xA6, 0x0F, 0xE8, 0x5C, 0x7A, 0x72,
-    0x5D, 0x66, 0xB1, 0x79, 0x3E, 0x24, 0x46, 0x6A, 0x65, 0xA0, 0x1F, 0x60, 0xDB, 0xC8, 0xFC, 0x4B,
-    0x3C, 0x23, 0x3A, 0x0C, 0xE0, 0x5D, 0x3A, 0x06, 0x48, 0xFB, 0x57, 0xAD, 0xEC, 0x9F, 0x74, 0xFE,
-    0x14, 0xF0, 0x33, 0x09, 0x48, 0x00, 0x11, 0x80, 0x7E, 0x0A, 0x08, 0x5E, 0x00, 0x70, 0x2C, 0x50,
-    0xEE, 0x62, 0x04, 0xFC, 0x16, 0x1A, 0x07, 0x65, 0x50, 0xE6, 0x25, 0x7B, 0xA6, 0xD7, 0x84, 0x4D,
-    0xD2, 0x2C, 0x34, 0x73, 0x0D, 0xED, 0xFF, 0x7E, 0x87, 0x0F, 0xC2, 0x9A, 0x12, 0x4B, 0x17, 0x45,
-    0x36, 0x8A, 0xF4, 0x8D, 0x48, 0x2F, 0x45, 0x5A, 0x5E, 0xC9, 0x60, 0x81, 0x7E, 0x4D, 0x1E, 0x9D,
-    0x22, 0x78, 0x2E, 0xB1, 0x8D, 0xB1, 0xAD, 0xB1, 0xCD, 0x91, 0x85, 0xBF, 0xDB, 0xA8, 0xF4, 0x9B,
-    0xC4, 0x44, 0x95, 0xCA, 0xE2, 0xC2, 0x52, 0xB2, 0xD6, 0x90, 0x4F, 0xDF, 0x23, 0xAF, 0xE2, 0x29,
-    0x04, 0x41, 0xCC, 0x7A, 0x52, 0xD3, 0x26, 0xD1, 0xC5, 0x1A, 0x5C, 0xC8, 0xAB, 0xFD, 0x8A, 0x71,
-    0x50, 0x32, 0x8E, 0x34, 0xE3, 0x38, 0xC3, 0x62, 0xD7, 0xD2, 0x67, 0xBC, 0x1A, 0x02, 0x57, 0x8D,
-    0xE0, 0xA1, 0xD5, 0x05, 0xE0, 0xA0, 0xBC, 0x0E, 0x1C, 0x99, 0x12, 0x58, 0x3C, 0xB4, 0x16, 0x5E,
-    0x8B, 0x39, 0xCB, 0x68, 0x95, 0x98, 0x9C, 0x3B, 0x5F, 0x8A, 0xD7, 0xAD, 0x1D, 0xE6, 0x05, 0x35,
-    0xC1, 0x2B, 0x56, 0x19, 0x78, 0x51, 0x9C, 0x31, 0x89, 0x24, 0x05, 0x2F, 0x26, 0x1B, 0x19, 0x8F,
-    0x79, 0x69, 0xD8, 0x09, 0x6C, 0x37, 0xFE, 0x2A, 0xC5, 0x43, 0x89, 0x18, 0xD6, 0x38, 0xCC, 0x07,
-    0xC7, 0x8D, 0x34, 0xC7, 0x3D, 0xBD, 0x3B, 0x62, 0x76, 0x4B, 0x54, 0xD3, 0xC9, 0xDA, 0x87, 0x5D,
-    0x55, 0x61, 0x41, 0xC7, 0x36, 0x05, 0x86, 0xC9, 0xF8, 0x66, 0x65, 0x94, 0x0C, 0x2B, 0xDB, 0x6E,
-    0x8A, 0x4A, 0x55, 0xCD, 0x42, 0x45, 0x7E, 0xB5, 0x5A, 0x81, 0xC9, 0x7F, 0x2A, 0x8A, 0x1E, 0x3E,
-    0x06, 0x8D, 0x4F, 0x60, 0xA2, 0x32, 0x00, 0x5A, 0xC5, 0x2B, 0xD0, 0x07, 0x42, 0x5C, 0x50, 0x9A,
-    0x4F, 0x99, 0x0E, 0x41, 0x00, 0xAA, 0xE1, 0x5A, 0x91, 0x8F, 0x89, 0xC7, 0xFC, 0x1B, 0x36, 0x1B,
-    0xC5, 0xE1, 0x6B, 0x5E, 0xFD, 0xAB, 0x91, 0xB6, 0x8B, 0x6C, 0x4D, 0x2B, 0xC3, 0xD8, 0x84, 0x3D,
-    0x2C, 0x82, 0xD2, 0x6C, 0xE7, 0x38, 0x2E, 0x8E, 0x23, 0x09, 0xCF, 0x27, 0x89, 0x96, 0x87, 0xC0,
-    0x2B, 0x48, 0x72, 0x00, 0x50, 0x6C, 0x7F, 0x39, 0x47, 0x4D, 0xC4, 0x35, 0x72, 0xC1, 0xC2, 0x6F,
-    0xB0, 0xA2, 0x41, 0x13, 0x56, 0x14, 0xEE, 0xFC, 0xAC, 0xE6, 0xD0, 0xDA, 0x90, 0xB0, 0x96, 0xC3,
-    0x10, 0x32, 0x80, 0x34, 0x64, 0x39, 0x5D, 0xE4, 0xC8, 0x2E, 0x10, 0x11, 0x4B, 0x21, 0xF5, 0x40,
-    0x5F, 0x32, 0x63, 0x26, 0xEA, 0x33, 0xA3, 0xA0, 0x78, 0x43, 0x7C, 0xA3, 0x66, 0x4C, 0x59, 0x25,
-    0x20, 0x5A, 0x87, 0xE6, 0xC8, 0xF9, 0xC6, 0x19, 0x94, 0xCB, 0xF7, 0x80, 0x76, 0xD9, 0x1A, 0x8A,
-    0x85, 0xA3, 0x57, 0x75, 0x31, 0x82, 0x2D, 0x6C, 0x81, 0x00, 0x6D, 0xB1, 0x65, 0x4D, 0xF2, 0xCF,
-    0x11, 0xB2, 0x0C, 0xAB, 0x31, 0xE5, 0xB3, 0x67, 0xC7, 0xC8, 0xDD, 0x1E, 0xCD, 0x5A, 0x5A, 0x2E,
-    0x22, 0x7C, 0x87, 0x03, 0x87, 0xA3, 0xFF, 0x76, 0x2B, 0xCB, 0x24, 0xFE, 0xCE, 0xDC, 0xE2, 0x3F,
-    0x32, 0x96, 0x0E, 0xAB, 0xF7, 0x39, 0x67, 0xE4, 0x9E, 0xB5, 0x25, 0x75, 0x8C, 0xFD, 0xEE, 0x72,
-    0xB7, 0x92, 0x06, 0x4C, 0x9F, 0x59, 0x01, 0x3B, 0x5E, 0x14, 0x1B, 0x0F, 0x51, 0x1C, 0x39, 0x10,
-    0xD4, 0x54, 0xCA, 0x18, 0x1E, 0xCF, 0x94, 0x9D, 0x4B, 0xD9, 0x75, 0xFE, 0x36, 0x04, 0x2D, 0xD1,
-    0xFA, 0x26, 0x29, 0xC8, 0x49, 0xC1, 0xB1, 0x31, 0x4F, 0x0F, 0x02, 0x3F, 0xE3, 0x77, 0x12, 0x63,
-    0xE2, 0x9A, 0xD6, 0x41, 0xBD, 0xF0, 0x59, 0x06, 0x24, 0x0F, 0x0A, 0x60, 0x6E, 0x6E, 0xA6, 0x9A,
-    0x1E, 0x62, 0x06, 0x67, 0xFB, 0x20, 0x09, 0x37, 0x64, 0x27, 0x94, 0x7C, 0x9B, 0x83, 0xBD, 0xAD,
-    0xF9, 0x5C, 0x59, 0xC6, 0xDC, 0x0D, 0xA7, 0x2D, 0x87, 0x73, 0xFA, 0x21, 0x3F, 0xAF, 0xFB, 0x73,
-    0x20, 0x04, 0xF1, 0xDB, 0xC1, 0xA5, 0x5E, 0x99, 0x4E, 0xC0, 0x75, 0x52, 0x96, 0x7C, 0x6A, 0x46,
-    0x88, 0x52, 0xAF, 0x4A, 0xE7, 0xAC, 0x6F, 0xE4, 0x8F, 0x4B, 0xF9, 0x41, 0x71, 0x8C, 0x53, 0xF3,
-    0xAB, 0x0B, 0x83, 0xE8, 0x06, 0x3B, 0x09, 0x70, 0xF9, 0xC0, 0xC5, 0x0E, 0xCE, 0x7E, 0x48, 0x70,
-    0xC8, 0x29, 0xF4, 0xAD, 0x27, 0xD7, 0x6B, 0x6E, 0x3C, 0xF5, 0x84, 0x3A, 0xA6, 0x13, 0x99, 0x99,
-    0xE8, 0xF8, 0x5C, 0xE0, 0xEA, 0xF8, 0xCB, 0xF2, 0xA2, 0xC7, 0xE2, 0x09, 0x5B, 0xE2, 0x8C, 0xAC,
-    0xA1, 0x03, 0x0A, 0x1C, 0x7E, 0x86, 0xD6, 0xF4, 0xE3, 0x2F, 0x44, 0x59, 0x2E, 0xF4, 0xAA, 0xD0,
-    0xF3, 0xDE, 0xAB, 0x0B, 0x13, 0xD9, 0x1D, 0x67, 0xC0, 0x86, 0x51, 0x4D, 0xE2, 0x9B, 0x2B, 0x9C,
-    0x6D, 0x21, 0x1F, 0x27, 0xDA, 0x14, 0x08, 0x49, 0xF6, 0x9B, 0x14, 0xB5, 0x85, 0x35, 0x13, 0xA4,
-    0xB9, 0xF8, 0xC3, 0x8B, 0x61, 0x88, 0x1B, 0x8C, 0xA2, 0xA7, 0x27, 0xD0, 0x93, 0xDA, 0xE1, 0x62,
-    0xC0, 0x67, 0x3F, 0xDB, 0xD3, 0xE4, 0xEF, 0xC1, 0x72, 0x7D, 0x3D, 0x1A, 0x62, 0x48, 0x8E, 0x6C,
-    0x43, 0xF0, 0x26, 0xC5, 0x35, 0x36, 0x50, 0xC3, 0xA8, 0x03, 0x6A, 0x2D, 0x50, 0xA7, 0x32, 0x20,
-    0x69, 0x14, 0xD7, 0x99, 0x40, 0x48, 0xF3, 0xD4, 0x05, 0x0D, 0x90, 0xD7, 0x49, 0x4C, 0xBE, 0xC5,
-    0x15, 0x5C, 0x01, 0x28, 0x61, 0x24, 0x18, 0x45, 0x8C, 0x02, 0x3B, 0x4E, 0x49, 0x6C, 0xB8, 0xCE,
-    0x49, 0xA8, 0x75, 0xF7, 0xE3, 0xE0, 0x95, 0xB0, 0x18, 0xCE, 0xD7, 0x5D, 0x70, 0xA8, 0x43, 0xCB,
-    0x4E, 0x86, 0x02, 0x9D, 0xD3, 0x9F, 0xE2, 0xBE, 0x24, 0x07, 0x32, 0x70, 0xC2, 0x64, 0x0A, 0xB9,
-    0x17, 0xDC, 0xC1, 0x68, 0x0C, 0xCE, 0xB3, 0xB8, 0xF6, 0x6D, 0x4F, 0xC0, 0x77, 0xB6, 0x75, 0x95,
-    0x0B, 0xD7, 0xA9, 0xC3, 0x71, 0x47, 0xA5, 0x8F, 0xD0, 0x74, 0x20, 0x2F, 0xBD, 0x09, 0xE6, 0xA1,
-    0x0B, 0x5E, 0x2E, 0x54, 0x72, 0xEC, 0xAE, 0x27, 0xDC, 0x8F, 0x98, 0x79, 0x9C, 0xC1, 0xC5, 0xD5,
-    0x1E, 0x50, 0xC7, 0x15, 0x77, 0xB9, 0x90, 0xBE, 0x19, 0xBE, 0x17, 0x42, 0x5C, 0x29, 0xD7, 0xFE,
-    0xB9, 0x34, 0xE5, 0xBD, 0xB1, 0xC9, 0x7E, 0x87, 0x16, 0x65, 0xDA, 0xC6, 0x7F, 0x01, 0xE5, 0xC2,
-    0xC3, 0x73, 0x78, 0x1D, 0xDC, 0xF2, 0x9F, 0x95, 0x5C, 0x6B, 0x17, 0xE8, 0xC6, 0x1C, 0x4A, 0x57,
-    0xA2, 0xEF, 0xB0, 0x1C, 0x39, 0x7F, 0xDC, 0x1E, 0x90, 0x23, 0x64, 0x39, 0x04, 0x9A, 0xBC, 0x4C,
-    0xB2, 0x1C, 0x23, 0x96, 0xA3, 0x86, 0x08, 0x97, 0x4A, 0xA0, 0x0F, 0x0C, 0xE4, 0xF8, 0x14, 0x03,
-    0xE4, 0x36, 0xCB, 0xD1, 0xB2, 0x1C, 0xCD, 0x58, 0x8E, 0xD0, 0x79, 0xD8, 0x36, 0xF8, 0x85, 0x07,
-    0x6C, 0xCE, 0xE7, 0x76, 0x91, 0x73, 0x07, 0xAF, 0xFA, 0xB0, 0xE8, 0x68, 0x65, 0x6B, 0x0B, 0x57,
-    0x7F, 0x09, 0xA8, 0xF3, 0x34, 0xAC, 0x95, 0x89, 0x4B, 0x6E, 0x93, 0xE0, 0xC8, 0x99, 0x67, 0xDB,
-    0x29, 0x26, 0x6D, 0x5F, 0xE8, 0x31, 0x8F, 0xA1, 0xCA, 0x7B, 0xED, 0x3C, 0x38, 0xE7, 0x41, 0x45,
-    0xBF, 0x86, 0xAE, 0x26, 0x79, 0xED, 0x3C, 0xBC, 0xE2, 0x3C, 0x1A, 0x7C, 0x6E, 0xF2, 0x51, 0x74,
-    0x2F, 0xCF, 0x1F, 0x8D, 0x0E, 0xBC, 0x10, 0x3C, 0x57, 0x5C, 0xCC, 0x8B, 0x6C, 0x78, 0xE2, 0xB7,
-    0x4A, 0x07, 0xAE, 0x69, 0x11, 0xA5, 0x28, 0xA3, 0x2A, 0x31, 0xDC, 0xCE, 0xF8, 0x2D, 0x2A, 0x1A,
-    0x84, 0x3E, 0xCA, 0x39, 0x6D, 0xC3, 0xC4, 0xE2, 0xE9, 0x5D, 0x8D, 0xFF, 0x07, 0xAE, 0x7F, 0xEC,
-    0x18, 0x38, 0x5B, 0x20, 0x76, 0xBA, 0xC6, 0xD3, 0xB3, 0x29, 0x62, 0x27, 0x43, 0xD6, 0x03, 0xEE,
-    0xFF, 0xC0, 0x0D, 0x69, 0xCB, 0xE9, 0x91, 0xEC, 0xCA, 0xD4, 0x77, 0x83, 0x94, 0x5E, 0xEE, 0xAC,
-    0x92, 0x5B, 0xC1, 0x42, 0xB2, 0x2E, 0x08, 0xE7, 0x3D, 0x28, 0x2D, 0xD7, 0x60, 0xA7, 0x9F, 0x34,
-    0x03, 0x20, 0x55, 0xAC, 0x61, 0x4C, 0x96, 0x34, 0x32, 0x0B, 0x5B, 0x99, 0x21, 0x0E, 0x33, 0xDC,
-    0xFE, 0xAC, 0x95, 0xB7, 0x6D, 0x23, 0x6F, 0xD9, 0x49, 0x8C, 0x0B, 0xDA, 0xA1, 0x26, 0xE7, 0xF2,
-    0x2C, 0x2C, 0x06, 0x3E, 0x06, 0x21, 0x89, 0x0B, 0xB2, 0x8E, 0x4E, 0x38, 0xEE, 0x18, 0x70, 0xD9,
-    0x72, 0xA2, 0x40, 0x13, 0xCE, 0x92, 0xE6, 0x78, 0xCA, 0x80, 0xDF, 0xD7, 0x90, 0x1E, 0x01, 0x3E,
-    0x6E, 0x93, 0xFD, 0xE9, 0x0C, 0x9A, 0x5E, 0x7F, 0x2E, 0xB7, 0x47, 0xF4, 0x7A, 0x68, 0x22, 0x09,
-    0xFB, 0x10, 0x3B, 0xFA, 0x47, 0x8D, 0x66, 0x67, 0x73, 0x66, 0x9A, 0x7E, 0x75, 0x16, 0x73, 0xB9,
-    0x49, 0x02, 0xEB, 0xF8, 0x8E, 0x3F, 0xBB, 0xDE, 0x61, 0x76, 0x9F, 0xC4, 0xA3, 0xC6, 0x81, 0x97,
-    0x2E, 0xCF, 0xAE, 0x33, 0xE7, 0x23, 0xD6, 0xF9, 0x71, 0xE1, 0x80, 0xAF, 0xE9, 0xE3, 0xD9, 0xE7,
-    0xD2, 0xB7, 0x99, 0x5A, 0xC7, 0xD7, 0x7B, 0x7D, 0xC1, 0xCD, 0xDB, 0x64, 0x20, 0xAD, 0x5C, 0x21,
-    0x8B, 0x32, 0x7D, 0xC5, 0xAE, 0x28, 0xB6, 0x2F, 0xDE, 0x6C, 0xD8, 0x65, 0x9C, 0xA7, 0xBD, 0x05,
-    0x5B, 0x16, 0xC7, 0xB3, 0xDA, 0xA3, 0xFC, 0x6F, 0x76, 0xF7, 0x2E, 0x68, 0xFE, 0x19, 0xDF, 0xC6,
-    0x9D, 0xF3, 0x85, 0xC1, 0x89, 0x9E, 0x44, 0xB6, 0x89, 0x6D, 0x2D, 0x8B, 0x9F, 0x23, 0x2C, 0xE7,
-    0x53, 0x15, 0x10, 0xDC, 0x4B, 0xE9, 0xB7, 0xA4, 0x6D, 0x84, 0x45, 0x60, 0xAC, 0x78, 0x13, 0x06,
-    0xDD, 0x2A, 0xE2, 0x3F, 0xBA, 0x68, 0xCB, 0xE5, 0xD9, 0xB3, 0x2C, 0x91, 0xF2, 0x75, 0xAC, 0x52,
-    0x83, 0xA0, 0xCC, 0xFD, 0x00, 0xDA, 0x01, 0xC8, 0x98, 0xAF, 0xC0, 0x5B, 0x86, 0x2D, 0xC3, 0x7C,
-    0x08, 0xA2, 0x28, 0xE1, 0x29, 0x81, 0x54, 0x3C, 0x03, 0xDE, 0xBE, 0x44, 0x87, 0x5A, 0xE2, 0xCC,
-    0x34, 0x0F, 0xB1, 0xC4, 0x59, 0x68, 0x1E, 0x66, 0x39, 0x33, 0xCA, 0xB8, 0xDF, 0x58, 0xB8, 0xA8,
-    0xEF, 0xDF, 0xE1, 0xFA, 0xF7, 0x45, 0x4E, 0x5E, 0x85, 0xA8, 0x8A, 0x35, 0x7F, 0x76, 0x0E, 0x3C,
-    0x9F, 0xF5, 0x9B, 0xAA, 0x87, 0x8B, 0xBE, 0x1E, 0xA6, 0xDF, 0x13, 0xAF, 0xE3, 0x0B, 0x9C, 0xE7,
-    0xA3, 0x14, 0x1D, 0xEA, 0xD6, 0xB8, 0x06, 0x7E, 0x19, 0xE1, 0x70, 0xDC, 0xFF, 0x2E, 0x79, 0x1D,
-    0xE8, 0x28, 0xDC, 0xAB, 0x12, 0x4A, 0x43, 0xC9, 0xA2, 0x73, 0xFE, 0xE2, 0xDB, 0x3C, 0x13, 0xBD,
-    0xE1, 0x72, 0xA2, 0x36, 0x39, 0xEA, 0x03, 0x98, 0xA8, 0x03, 0x5C, 0xF3, 0x33, 0x7E, 0x97, 0x0A,
-    0x57, 0x1E, 0xF4, 0x4D, 0x1E, 0x7D, 0x11, 0xA1, 0x0A, 0xDD, 0xA6, 0x68, 0x1B, 0x25, 0xA9, 0xD7,
-    0x3F, 0x3B, 0xC7, 0x9B, 0x44, 0x92, 0xAB, 0x6D, 0xD0, 0xAA, 0x14, 0xEA, 0x67, 0xDE, 0xA9, 0xFB,
-    0xB6, 0xDD, 0xBC, 0xD8, 0x4C, 0xD2, 0xBA, 0x1A, 0xD2, 0xBA, 0xEB, 0xA2, 0x9E, 0x5A, 0x4C, 0xC3,
-    0x7B, 0x6D, 0x58, 0xD2, 0x83, 0xB2, 0xA1, 0x9C, 0x48, 0x50, 0xC6, 0x28, 0x9D, 0x38, 0xF9, 0x3A,
-    0xE8, 0x55, 0x3D, 0x37, 0x8D, 0xCF, 0x4C, 0x13, 0x15, 0xBD, 0x87, 0x34, 0x13, 0xFE, 0x1B, 0x86,
-    0x97, 0xAD, 0xCE, 0x4C, 0xD3, 0xAB, 0x05, 0xCC, 0x61, 0x0B, 0x95, 0x0E, 0x9A, 0x0A, 0xFF, 0xC9,
-    0xCC, 0xF4, 0x7C, 0xF3, 0x05, 0x45, 0x65, 0x83, 0x38, 0xC0, 0x4E, 0x71, 0x6A, 0x76, 0x9D, 0x97,
-    0x86, 0xE0, 0xB2, 0x05, 0xF8, 0xFE, 0xE0, 0xC7, 0x93, 0x9D, 0xEE, 0x0D, 0xB7, 0x27, 0xCC, 0xDB,
-    0x7A, 0x6E, 0xCC, 0xEA, 0x74, 0x65, 0xF0, 0x1B, 0xF7, 0xDF, 0x81, 0xE3, 0xF9, 0xC8, 0x66, 0xF9,
-    0x25, 0x38, 0x1F, 0xEC, 0xDE, 0x8A, 0xCF, 0x8D, 0x4D, 0xC0, 0x77, 0x04, 0x9E, 0x35, 0x38, 0x96,
-    0x2A, 0xE3, 0x31, 0x6C, 0x5B, 0x09, 0xE6, 0xF5, 0xC4, 0x38, 0x65, 0xBB, 0xCA, 0x1E, 0xFE, 0x82,
-    0x5E, 0x76, 0x6C, 0x0F, 0xBC, 0x3B, 0x8C, 0x16, 0xCD, 0x3C, 0x0F, 0xA6, 0x77, 0x87, 0x63, 0xBB,
-    0x6D, 0x42, 0x7B, 0x7B, 0x7F, 0xC7, 0x9F, 0x37, 0x2D, 0x60, 0xA3, 0xEE, 0x4F, 0x94, 0x21, 0x5B,
-    0xCC, 0x4C, 0x93, 0xF7, 0xE6, 0x78, 0x63, 0xA5, 0x6A, 0x28, 0xD2, 0xC9, 0xCC, 0x34, 0x7D, 0x73,
-    0x9D, 0x82, 0xB2, 0x75, 0x40, 0xE9, 0xFC, 0x91, 0xE9, 0xBD, 0x41, 0xC7, 0x7F, 0x9B, 0xA7, 0x5C,
-    0x02, 0xC5, 0xEE, 0x3F, 0x21, 0xA6, 0x20, 0x0A, 0x35, 0xFC, 0x2F, 0xD4, 0xB9, 0xFF, 0x85, 0xBC,
-    0x6E, 0xFF, 0xBF, 0x21, 0x57, 0xAE, 0xF2, 0x06, 0xE8, 0xB0, 0x95, 0xC3, 0xEB, 0x23, 0xBB, 0xBE,
-    0x92, 0xE3, 0x29, 0x38, 0x74, 0x07, 0xFE, 0x56, 0x45, 0x32, 0xC7, 0xFA, 0xA3, 0x6C, 0x94, 0x05,
-    0x4A, 0x2D, 0x8E, 0x07, 0x59, 0xCF, 0xA9, 0x87, 0xB8, 0x70, 0xCF, 0x80, 0xDD, 0x18, 0xB6, 0x95,
-    0xCF, 0x1B, 0x7A, 0xE6, 0x6E, 0xBE, 0x9B, 0x1B, 0x74, 0xBF, 0xE5, 0xE6, 0x64, 0x6E, 0x5E, 0xB7,
-    0x1E, 0xFF, 0x03, 0xBD, 0x5A, 0xBF, 0x93, 0xDD, 0xD4, 0x15, 0x3E, 0x92, 0xB0, 0x35, 0x41, 0x33,
-    0xC8, 0x05, 0x9E, 0x49, 0xEC, 0x99, 0xA8, 0x05, 0x17, 0x56, 0x93, 0x22, 0x45, 0xF0, 0xD5, 0x4C,
-    0xBA, 0x50, 0xC4, 0x45, 0x36, 0x14, 0x29, 0x48, 0x41, 0x91, 0x71, 0x43, 0xFE, 0x00, 0x62, 0x89,
-    0x49, 0x91, 0x99, 0x50, 0x78, 0x8B, 0xF4, 0x71, 0x41, 0x01, 0x4E, 0x61, 0x8A, 0x14, 0x2E, 0xEC,
-    0x95, 0x32, 0x14, 0x14, 0x14, 0x16, 0xBF, 0x26, 0x45, 0x0A, 0x44, 0xE2, 0x4C, 0x0A, 0x0A, 0x0B,
-    0x90, 0x41, 0x6B, 0x24, 0x9D, 0x7C, 0xDF, 0xBD, 0x7A, 0xEB, 0xB7, 0xF6, 0xEE, 0xB2, 0xFB, 0xF6,
-    0x2D, 0x6F, 0x75, 0x8E, 0xFD, 0xA4, 0xAB, 0x7B, 0xBF, 0x73, 0xEF, 0x3D, 0x3F, 0xEF, 0x93, 0x2B,
-    0x37, 0x32, 0x91, 0x52, 0x2B, 0x91, 0x5C, 0x0B, 0x71, 0x9F, 0x78, 0x20, 0x1B, 0xC1, 0x52, 0x05,
-    0x33, 0x25, 0x58, 0x6E, 0xF0, 0xB4, 0x4C, 0xD1, 0x6E, 0x4A, 0x2A, 0xF1, 0xC6, 0xB8, 0x11, 0x7F,
-    0x88, 0x5B, 0x09, 0x86, 0xB0, 0x93, 0x70, 0xFB, 0x37, 0xBD, 0x44, 0xAA, 0x83, 0xC4, 0xAA, 0xA3,
-    0x24, 0xAA, 0x93, 0x98, 0x5A, 0x54, 0x4C, 0x25, 0x65, 0x96, 0x17, 0x92, 0x57, 0x9A, 0xE1, 0xCB,
-    0xE9, 0x1B, 0x6F, 0xA2, 0x59, 0x6F, 0x89, 0x1F, 0xAF, 0xAC, 0xD1, 0x98, 0x6F, 0x4D, 0xF2, 0x03,
-    0xE1, 0x58, 0x18, 0xEA, 0xD7, 0xCA, 0x5E, 0xC4, 0x4C, 0x2A, 0x9A, 0x95, 0xB8, 0x4B, 0xC2, 0xDF,
-    0xE7, 0x0A, 0x88, 0xB9, 0x24, 0x63, 0xEA, 0x50, 0x5E, 0x16, 0x20, 0xEF, 0x82, 0x86, 0xC8, 0x2B,
-    0x42, 0xC5, 0xD7, 0xD3, 0xBD, 0x9C, 0xB4, 0x0C, 0xA7, 0xE4, 0x29, 0x89, 0xB3, 0x17, 0xD0, 0x74,
-    0x90, 0x40, 0x3B, 0x91, 0x57, 0x8B, 0xE3, 0xCB, 0x72, 0x62, 0x68, 0xD9, 0x23, 0x07, 0x78, 0x8D,
-    0xCC, 0x4E, 0xCE, 0x44, 0xB8, 0x25, 0x1F, 0x9C, 0x2F, 0x56, 0xC7, 0xFC, 0x02, 0x08, 0xB2, 0x7B,
-    0x2D, 0x68, 0x1B, 0x13, 0xCF, 0xBD, 0x73, 0x31, 0x73, 0xC2, 0xE4, 0x84, 0x2C, 0x12, 0x60, 0xB8,
-    0xA8, 0x76, 0xB7, 0x12, 0xDD, 0xF4, 0x54, 0xDB, 0x50, 0xB5, 0x89, 0x47, 0xBF, 0x4E, 0xB1, 0x68,
-    0xC4, 0x96, 0x53, 0xC2, 0x6C, 0x37, 0xF1, 0x1E, 0x9F, 0x19, 0xB4, 0x49, 0x7A, 0xD9, 0x04, 0x96,
-    0xC6, 0x07, 0x2D, 0xED, 0x4F, 0x09, 0x01, 0xB9, 0x11, 0xCC, 0xCF, 0x1D, 0xFB, 0xB5, 0xBC, 0x87,
-    0xC5, 0x48, 0xB4, 0x37, 0xCD, 0x6F, 0xF1, 0x36, 0x44, 0xD0, 0xC5, 0x85, 0x0E, 0xF3, 0xEA, 0x87,
-    0x46, 0x87, 0x58, 0x07, 0x9F, 0x8B, 0x35, 0x4F, 0x37, 0xA0, 0x19, 0xCC, 0xF6, 0x96, 0xC9, 0xBC,
-    0x2E, 0xAA, 0x4E, 0x02, 0xA2, 0x16, 0x81, 0xD6, 0xF1, 0x47, 0x5D, 0x9A, 0xDD, 0x5E, 0x09, 0x62,
-    0x88, 0xBE, 0x23, 0x7C, 0x8B, 0x30, 0xC3, 0xFE, 0xE6, 0x89, 0xCC, 0xE2, 0x55, 0x8C, 0x9F, 0x11,
-    0xCB, 0xF3, 0x2B, 0xCD, 0xA2, 0xD7, 0x47, 0x8D, 0xDD, 0xA4, 0x29, 0x16, 0x3B, 0x1A, 0x4E, 0x02,
-    0x62, 0x52, 0xDC, 0x89, 0xBE, 0xEA, 0x7D, 0xDC, 0xD3, 0x6A, 0x15, 0x88, 0x51, 0x93, 0x66, 0xFE,
-    0x88, 0x85, 0xA6, 0xBD, 0xE1, 0x38, 0xEC, 0x43, 0x37, 0x85, 0x2A, 0xA3, 0xAA, 0x85, 0x6E, 0x68,
-    0xA3, 0x92, 0xB6, 0xD8, 0xF1, 0x9D, 0x4A, 0xD8, 0x2B, 0x94, 0x6B, 0x37, 0xF1, 0x1E, 0x9F, 0xA1,
-    0x8D, 0xA7, 0xB5, 0x7D, 0xC7, 0xBE, 0xCB, 0x15, 0x31, 0xEF, 0x62, 0x6D, 0xCC, 0x7B, 0x14, 0xF1,
-    0x7D, 0xCA, 0x71, 0xD7, 0x09, 0xE4, 0x8F, 0x60, 0xB1, 0xDE, 0xAC, 0xC4, 0x28, 0x60, 0xE7, 0x1F,
-    0x80, 0x95, 0x05, 0xF5, 0x52, 0xA0, 0xCC, 0xBA, 0x9B, 0x95, 0x19, 0x1E, 0xE4, 0x55, 0x3E, 0x37,
-    0x4E, 0xF4, 0x7E, 0x25, 0xA1, 0xC6, 0xD5, 0x8C, 0x5F, 0xB7, 0x85, 0xCA, 0x58, 0x93, 0xF5, 0x12,
-    0x3F, 0x78, 0x79, 0x92, 0xB8, 0xF5, 0x01, 0xA9, 0xC5, 0xD2, 0x81, 0xE5, 0x45, 0xF2, 0x00, 0x3D,
-    0xE4, 0x5A, 0xEF, 0xB0, 0xCA, 0x54, 0xF6, 0xC1, 0xDC, 0xC4, 0x36, 0x4E, 0xC6, 0xB9, 0x03, 0xD7,
-    0xD5, 0x36, 0xFB, 0xB6, 0x53, 0x5F, 0xC1, 0xDE, 0x0C, 0x96, 0xCE, 0xE6, 0x1F, 0xF3, 0x7B, 0x30,
-    0xA5, 0x15, 0x41, 0x10, 0x4D, 0x5E, 0x97, 0x15, 0x81, 0x6B, 0x96, 0xEE, 0x10, 0xBF, 0x13, 0x2E,
-    0x9F, 0x27, 0x5A, 0x56, 0x21, 0x6D, 0x13, 0x3E, 0xE7, 0x6E, 0x6C, 0xA6, 0xDA, 0xE0, 0xB2, 0x33,
-    0xDC, 0x61, 0x30, 0x5E, 0x1B, 0x97, 0x77, 0x16, 0x08, 0x9B, 0x62, 0xBE, 0x96, 0x6F, 0xF2, 0x7E,
-    0xEF, 0xAE, 0xC7, 0x7D, 0x83, 0x94, 0x9B, 0xD6, 0xC6, 0xA6, 0xB4, 0x45, 0x15, 0x6C, 0x5A, 0x66,
-    0x8A, 0x72, 0x23, 0xC7, 0xFC, 0x6B, 0x45, 0xA2, 0x89, 0xE4, 0x36, 0x32, 0x95, 0x27, 0xE9, 0xC3,
-    0x9B, 0xD6, 0x66, 0x79, 0xB0, 0x63, 0xFC, 0x3C, 0x2B, 0x67, 0x5E, 0x90, 0x2E, 0xD5, 0x36, 0xD6,
-    0xDA, 0xDB, 0x92, 0x95, 0x31, 0xED, 0x67, 0xEB, 0x8F, 0x83, 0x8D, 0x9F, 0x41, 0xBC, 0x09, 0x16,
-    0x5D, 0xE4, 0x95, 0xD5, 0xB1, 0xD9, 0x8E, 0x0C, 0x5F, 0x07, 0xA6, 0x1C, 0x83, 0xFD, 0x48, 0x8E,
-    0x8D, 0x6D, 0x45, 0x24, 0x01, 0x36, 0x55, 0x21, 0x09, 0xF4, 0xF5, 0x2F, 0x34, 0xAD, 0xFE, 0xBD,
-    0x95, 0x31, 0x78, 0x10, 0xCB, 0x87, 0x56, 0xA1, 0x47, 0x09, 0x3E, 0x03, 0x11, 0x97, 0xC5, 0x76,
-    0xD5, 0xEF, 0x93, 0x7F, 0x35, 0x91, 0x56, 0xBE, 0x1E, 0x6F, 0xCE, 0xE2, 0xEA, 0xAA, 0x84, 0x5F,
-    0x63, 0x05, 0xB4, 0x9D, 0xFD, 0xE0, 0xF1, 0xD7, 0x53, 0xC2, 0x91, 0xA6, 0x0F, 0x0D, 0xA0, 0x0D,
-    0x7D, 0xE0, 0x0C, 0xCD, 0x79, 0x9A, 0x2D, 0x1D, 0x02, 0xD5, 0x2E, 0x9E, 0xE4, 0xF7, 0x29, 0x8D,
-    0x45, 0xED, 0xBC, 0xA3, 0x33, 0x87, 0x3A, 0x90, 0x72, 0x52, 0xE1, 0x0F, 0xA6, 0x02, 0x35, 0xFE,
-    0x90, 0xF4, 0xFE, 0x40, 0xC7, 0xEE, 0xD3, 0xB9, 0xE7, 0x7A, 0x6F, 0x67, 0x0C, 0x60, 0x25, 0xE6,
-    0xF0, 0x4B, 0xE8, 0x71, 0xF1, 0x07, 0x7B, 0xCB, 0x1F, 0x9F, 0x2E, 0xE2, 0x59, 0x5B, 0xCD, 0xAC,
-    0xAD, 0xB4, 0x32, 0xBA, 0x44, 0xB4, 0x30, 0x56, 0x63, 0xBF, 0xA5, 0xC6, 0x6A, 0x15, 0xEA, 0xAC,
-    0xF9, 0xA0, 0x9F, 0xC0, 0x4D, 0x19, 0xCA, 0x0C, 0x9B, 0x76, 0x1E, 0xA6, 0x41, 0xCE, 0x20, 0xAA,
-    0x7A, 0x0D, 0x4E, 0xDD, 0x28, 0x03, 0x83, 0x42, 0xFC, 0x6D, 0x59, 0xB7, 0x2C, 0x1E, 0x74, 0x2A,
-    0x2A, 0x2E, 0xC2, 0xCA, 0x8D, 0xE2, 0x2F, 0xE9, 0xD4, 0xDA, 0x65, 0xB1, 0x9D, 0x62, 0xC9, 0x83,
-    0xC1, 0x91, 0x5C, 0x97, 0x13, 0x59, 0x97, 0x74, 0xE1, 0xCB, 0x40, 0xE7, 0xE4, 0xE4, 0x64, 0x59,
-    0x27, 0x6E, 0xEF, 0x57, 0xF3, 0xDC, 0x50, 0xD7, 0xB0, 0x5D, 0xFD, 0xD9, 0xAE, 0x31, 0x16, 0x82,
-    0x2A, 0x4B, 0x4A, 0x79, 0xB2, 0x25, 0x59, 0x3E, 0x5D, 0xAF, 0x2C, 0x86, 0xBA, 0x07, 0x4B, 0xD1,
-    0x6F, 0x49, 0x58, 0xA7, 0x76, 0xA0, 0x12, 0x01, 0xE3, 0x93, 0xFE, 0x77, 0x26, 0x60, 0xDF, 0xA1,
-    0x8D, 0x97, 0x86, 0x7D, 0xDB, 0xB9, 0x85, 0x06, 0x68, 0x1A, 0x89, 0x90, 0x41, 0x43, 0xF2, 0x3E,
-    0x86, 0xBA, 0xE4, 0xED, 0xE4, 0x05, 0xD3, 0xBE, 0x2C, 0xC1, 0x3C, 0x4C, 0xCA, 0x60, 0x41, 0x69,
-    0x33, 0x3E, 0x40, 0x6C, 0xA4, 0xD4, 0x7A, 0xA5, 0x75, 0x9D, 0x0E, 0xC7, 0x10, 0xAD, 0x59, 0xF7,
-    0x6B, 0xAA, 0x97, 0xB7, 0x37, 0xF2, 0x8F, 0x75, 0x06, 0xAD, 0x43, 0xBC, 0xF3, 0x20, 0xA6, 0x41,
-    0x59, 0x62, 0x0F, 0x36, 0xF2, 0x6A, 0xE9, 0xE9, 0xBE, 0x0C, 0xE8, 0x48, 0x6A, 0x77, 0x41, 0x23,
-    0x2F, 0x3F, 0xC8, 0xEC, 0xF7, 0xF8, 0xDF, 0xF0, 0xF2, 0xF7, 0x11, 0x6D, 0xC1, 0xEC, 0xC5, 0x7D,
-    0xDC, 0xC5, 0x6D, 0xD8, 0xC7, 0x6D, 0xD0, 0xC7, 0xCD, 0xFE, 0x14, 0x15, 0xEF, 0x98, 0xA9, 0xDD,
-    0xD2, 0xE6, 0x9D, 0x84, 0x53, 0x1F, 0xD3, 0x4F, 0xB6, 0x91, 0xD6, 0xB2, 0xCB, 0x68, 0xEE, 0x7D,
-    0x85, 0x88, 0x6A, 0x6D, 0xFB, 0xB0, 0xF9, 0x59, 0x32, 0xF5, 0x97, 0xCA, 0xF6, 0xA7, 0x91, 0xDD,
-    0x3C, 0x6F, 0xDB, 0x79, 0x3C, 0xC4, 0x75, 0xE1, 0x46, 0x81, 0x28, 0xC5, 0xE6, 0x6C, 0xD8, 0x14,
-    0xD8, 0x57, 0x15, 0x52, 0x37, 0xAC, 0xDB, 0x77, 0x5E, 0x89, 0x66, 0xAE, 0xFD, 0x72, 0x0F, 0xFE,
-    0x9B, 0x4C, 0x34, 0x0E, 0x73, 0x9D, 0x91, 0xEC, 0x96, 0xDF, 0x20, 0x4A, 0x4A, 0xB5, 0x38, 0xED,
-    0x42, 0xA0, 0x95, 0x46, 0x7F, 0xB2, 0x9F, 0xC3, 0x63, 0x58, 0x6D, 0x44, 0xB9, 0x28, 0x72, 0xDB,
-    0xE6, 0x5B, 0x63, 0xC6, 0x48, 0x98, 0x0A, 0x93, 0x66, 0x50, 0xB7, 0x82, 0xF6, 0xE6, 0x02, 0x9C,
-    0xD5, 0x7E, 0x7F, 0x17, 0x91, 0xF8, 0xF5, 0x32, 0x16, 0x65, 0x75, 0x9E, 0x8B, 0xE4, 0x77, 0x73,
-    0xD7, 0xDE, 0xF5, 0xD5, 0xE5, 0x3F, 0x68, 0x3C, 0x43, 0x5F, 0x69, 0x59, 0xCA, 0xDC, 0x11, 0xAF,
-    0xAD, 0xCC, 0x12, 0x76, 0xB0, 0xE8, 0xCF, 0xFA, 0x7C, 0x32, 0x8F, 0xBA, 0x4A, 0x25, 0xB5, 0x21,
-    0xBD, 0x68, 0x23, 0x4B, 0x76, 0xD8, 0xC0, 0x18, 0x96, 0x74, 0xDD, 0xD9, 0xB9, 0x39, 0xA7, 0xB9,
-    0x90, 0x5D, 0x81, 0x5D, 0x2E, 0x8F, 0x4C, 0x36, 0x11, 0xB6, 0xA4, 0x2E, 0x25, 0x4F, 0x31, 0x64,
-    0xEA, 0xFC, 0x17, 0xA6, 0x0B, 0x6A, 0xFB, 0xCF, 0x36, 0x95, 0x5B, 0xCE, 0x6E, 0x1D, 0x46, 0x6D,
-    0x9E, 0xBC, 0xFC, 0x89, 0x72, 0x40, 0x8A, 0x85, 0x4D, 0xA4, 0xD1, 0x82, 0xC9, 0x4A, 0xDE, 0x6F,
-    0x2E, 0x79, 0xDD, 0x91, 0x34, 0xCA, 0x5D, 0xFE, 0x28, 0x39, 0x2C, 0x7C, 0x4F, 0xAF, 0x50, 0x22,
-    0xE8, 0x87, 0x61, 0xAE, 0x61, 0xC0, 0x0A, 0x24, 0x2E, 0xA2, 0x98, 0x52, 0x8D, 0x3B, 0x51, 0x24,
-    0x64, 0x0A, 0x6F, 0x81, 0x3C, 0x46, 0x98, 0x6F, 0xE8, 0x7D, 0x64, 0x09, 0x2F, 0xF6, 0xEE, 0xB9,
-    0x6F, 0xD3, 0xFC, 0x4C, 0x59, 0x3B, 0x90, 0xB4, 0x61, 0xE2, 0x63, 0x71, 0x9D, 0xCD, 0x9C, 0x73,
-    0x63, 0xB0, 0x79, 0x09, 0xF4, 0xDC, 0xFC, 0xF5, 0x09, 0x7A, 0xFA, 0x3A, 0x76, 0x00, 0x76, 0x25,
-    0x8C, 0xFD, 0x1F, 0x47, 0x31, 0xD7, 0x3A, 0x31, 0x37, 0x6B, 0x2E, 0x1F, 0x08, 0xE9, 0x3A, 0x9C,
-    0xBD, 0x79, 0x77, 0x10, 0xF3, 0xBA, 0x72, 0x8E, 0xB9, 0x5B, 0x6A, 0xC3, 0x34, 0x65, 0x31, 0x46,
-    0xBA, 0x7B, 0x8C, 0x0B, 0xD9, 0xA2, 0x3F, 0xAC, 0xE9, 0xEB, 0xE8, 0xEF, 0x4F, 0x10, 0xED, 0x1A,
-    0xFA, 0x29, 0x2B, 0x1B, 0x9F, 0xD8, 0xFE, 0x3E, 0xDA, 0xBB, 0x3F, 0x4C, 0xAE, 0x84, 0x40, 0x1F,
-    0xD7, 0xAE, 0x3B, 0xBB, 0x3F, 0x76, 0x5C, 0xD2, 0x0A, 0x64, 0x1D, 0x98, 0x23, 0x78, 0xCC, 0x31,
-    0xEA, 0x92, 0x8A, 0xFD, 0x1E, 0xA0, 0x09, 0x4B, 0x7F, 0x47, 0xDB, 0x22, 0xF4, 0x18, 0xBC, 0x88,
-    0x79, 0x03, 0x2A, 0x6F, 0xD3, 0x05, 0xC8, 0xB2, 0x79, 0xC8, 0xD1, 0x38, 0x99, 0xF8, 0x17, 0x72,
-    0x3F, 0x87, 0x7D, 0xB0, 0xA5, 0x32, 0xAA, 0x0C, 0xEA, 0xB5, 0x87, 0x1F, 0xD9, 0xBC, 0xD1, 0x9A,
-    0x37, 0x6A, 0x73, 0xAD, 0x32, 0xD7, 0xB8, 0xB2, 0x87, 0xBF, 0xF6, 0x16, 0x34, 0x68, 0x15, 0x69,
-    0x74, 0xD8, 0xA9, 0xB7, 0xB9, 0xF7, 0x70, 0xFB, 0x75, 0xF8, 0xD7, 0x0A, 0xFB, 0x87, 0xD7, 0x9F,
-    0xB3, 0x3D, 0x1B, 0xB0, 0x36, 0x12, 0x3F, 0x4E, 0x5F, 0xD0, 0xA1, 0xC1, 0x37, 0x2A, 0x93, 0x70,
-    0xAC, 0x10, 0x66, 0xAE, 0x6C, 0x5D, 0xC4, 0x91, 0x2C, 0xB7, 0x53, 0x3A, 0x32, 0x47, 0x7B, 0x5B,
-    0xEB, 0x09, 0x29, 0x1F, 0x54, 0xBD, 0x88, 0xB1, 0xF5, 0x7A, 0x49, 0x7B, 0x09, 0x9F, 0x68, 0xB3,
-    0x88, 0xCC, 0x8B, 0xD9, 0x30, 0x05, 0xDD, 0x1C, 0x43, 0x2D, 0x02, 0xF6, 0x5C, 0x10, 0xB1, 0x83,
-    0x75, 0x64, 0x03, 0x19, 0xA2, 0x04, 0x2E, 0x48, 0x2E, 0x53, 0x5E, 0x80, 0x99, 0x1A, 0x2C, 0x6E,
-    0xC1, 0xA2, 0x0E, 0x2C, 0x18, 0xC0, 0xBC, 0xC9, 0x40, 0x9D, 0x35, 0x67, 0x44, 0xA1, 0x60, 0x29,
-    0x59, 0x4C, 0x16, 0x91, 0x05, 0x3A, 0xD7, 0x5F, 0xB8, 0xC7, 0x7B, 0xB7, 0xC7, 0xE7, 0x32, 0xE2,
-    0x05, 0x7C, 0x37, 0x86, 0x86, 0x1A, 0x96, 0xBA, 0xCB, 0x6B, 0x53, 0xA5, 0xA0, 0x04, 0x6A, 0x71,
-    0x30, 0x9D, 0x30, 0x52, 0xF1, 0x2E, 0x33, 0x1C, 0xA3, 0x66, 0xDA, 0x82, 0xA0, 0x2D, 0x6F, 0x3C,
-    0x7D, 0x0C, 0xBC, 0xB6, 0xD3, 0x53, 0x30, 0x19, 0x2C, 0x3E, 0xD0, 0x1B, 0x1A, 0x67, 0x32, 0xE6,
-    0x98, 0x9F, 0x83, 0x6C, 0x31, 0x25, 0x36, 0xD3, 0x5C, 0xEC, 0xFB, 0x1E, 0xD6, 0x63, 0xAF, 0x5A,
-    0xD3, 0xAA, 0xF2, 0x31, 0xB0, 0xB3, 0xEB, 0x6A, 0x05, 0x94, 0x84, 0xBE, 0x3B, 0xFD, 0xC5, 0xEB,
-    0x53, 0x66, 0xE2, 0x4F, 0xB5, 0x7E, 0x96, 0xB1, 0x9E, 0xC4, 0x63, 0xD2, 0x09, 0xA3, 0x3D, 0x61,
-    0xB8, 0x37, 0xB3, 0xE6, 0xBB, 0x58, 0x59, 0xEF, 0xCC, 0x41, 0x4F, 0x36, 0x92, 0xA9, 0x9D, 0x83,
-    0x8A, 0xE2, 0x37, 0x60, 0x89, 0x15, 0x9F, 0x92, 0x07, 0x94, 0xDC, 0xD3, 0x12, 0x52, 0x96, 0x14,
-    0xD5, 0x90, 0x25, 0xCB, 0x92, 0x4F, 0x54, 0xE5, 0xC9, 0xB9, 0x4A, 0xF4, 0x32, 0x3B, 0xCD, 0xCF,
-    0xAD, 0x97, 0x1E, 0x96, 0x1C, 0xF4, 0x85, 0xE8, 0xF1, 0x99, 0x48, 0x0E, 0xB9, 0xD2, 0x0B, 0x4A,
-    0x6B, 0x1B, 0xD0, 0x87, 0xF0, 0x5C, 0x01, 0x66, 0x19, 0x31, 0xE0, 0x5C, 0xF8, 0x37, 0xBA, 0x50,
-    0xB8, 0x94, 0x19, 0x2B, 0xD2, 0x23, 0x16, 0xC6, 0x47, 0x49, 0xFA, 0x50, 0xB9, 0x10, 0x5A, 0xB8,
-    0x12, 0x5B, 0xC1, 0xD4, 0x1E, 0xAC, 0x46, 0x4C, 0x9F, 0x2E, 0x31, 0xFB, 0x00, 0x4D, 0xC0, 0x1A,
-    0xA8, 0x32, 0xF2, 0x25, 0x75, 0x1D, 0xF8, 0xB6, 0x62, 0xF0, 0xEA, 0xA2, 0x1A, 0xE9, 0xDF, 0x78,
-    0x0B, 0xA3, 0x0F, 0x96, 0x9E, 0x28, 0x1A, 0xD4, 0x65, 0x91, 0x67, 0x36, 0x31, 0x82, 0xCF, 0x4D,
-    0x2C, 0x95, 0x76, 0x80, 0xB4, 0x62, 0x6A, 0x94, 0x3E, 0x44, 0x94, 0x8E, 0xBD, 0xE6, 0x2D, 0x4A,
-    0x93, 0x4C, 0xB4, 0xE5, 0x16, 0x4B, 0x1D, 0x74, 0x65, 0x16, 0xB9, 0x9C, 0xDE, 0x96, 0xEF, 0x45,
-    0x90, 0xDD, 0x19, 0x38, 0x9F, 0x6C, 0x1E, 0x5F, 0x20, 0x97, 0xD6, 0xDD, 0x85, 0x40, 0x39, 0x1D,
-    0xED, 0x00, 0xEF, 0xE8, 0x37, 0xB7, 0xBE, 0x1F, 0x81, 0xF8, 0x09, 0x86, 0x49, 0xC2, 0x2F, 0x07,
-    0x89, 0xDF, 0x6B, 0xE4, 0x62, 0x94, 0xAD, 0x49, 0x20, 0x8C, 0xE1, 0xAA, 0xD2, 0xCA, 0x04, 0x89,
-    0x1C, 0xD8, 0xC7, 0x8D, 0xCC, 0xD4, 0x4C, 0x34, 0x4D, 0x45, 0x9E, 0x17, 0x96, 0xC3, 0x55, 0x28,
-    0x7A, 0x7B, 0xC4, 0x71, 0x07, 0x2D, 0xDD, 0x53, 0xD7, 0xD2, 0xBD, 0x95, 0x74, 0xE4, 0xAE, 0xB7,
-    0xC0, 0x72, 0xEC, 0x63, 0xF2, 0x05, 0xE6, 0xF3, 0x2C, 0x82, 0x8E, 0xAA, 0x59, 0xCA, 0xA7, 0x35,
-    0x90, 0x23, 0xAB, 0x43, 0x0C, 0xD4, 0x84, 0x2D, 0x10, 0xFF, 0xF7, 0xA5, 0x4E, 0x79, 0xDE, 0xB3,
-    0xC3, 0xA1, 0x18, 0x2C, 0x23, 0xDB, 0x4A, 0x7B, 0xDE, 0xC9, 0x19, 0xBC, 0x35, 0xFD, 0x0D, 0xF9,
-    0xE0, 0x64, 0x91, 0x37, 0xE9, 0xF2, 0x2C, 0xF1, 0xE4, 0xC4, 0xA6, 0x8D, 0x4C, 0xEE, 0xEF, 0xCC,
-    0x03, 0x4E, 0x8C, 0x05, 0x7B, 0x9B, 0xF6, 0x22, 0x56, 0xCC, 0x6C, 0xCC, 0x08, 0xA9, 0x98, 0xF7,
-    0xDA, 0x88, 0xD0, 0x16, 0xBC, 0x3B, 0x97, 0x79, 0xC2, 0xE5, 0xBA, 0x58, 0x71, 0x72, 0x87, 0x42,
-    0x36, 0x56, 0x34, 0xB5, 0xAD, 0x48, 0x8B, 0xF5, 0xB0, 0xF0, 0xCB, 0xA3, 0xAD, 0xE1, 0xD1, 0xFC,
-    0x35, 0x26, 0x6D, 0x4C, 0xD9, 0x98, 0x69, 0x13, 0xF8, 0xB8, 0x92, 0xFB, 0x05, 0x0E, 0x6B, 0xC4,
-    0xE0, 0xE2, 0xD5, 0xD9, 0x29, 0xB0, 0x4E, 0xF6, 0xCA, 0x51, 0x90, 0xB8, 0xF7, 0xF9, 0x7F, 0x1B,
-    0x39, 0x3E, 0xB7, 0x73, 0x10, 0x21, 0xD1, 0x57, 0xBD, 0xF0, 0x28, 0x62, 0x3E, 0x8B, 0x58, 0x27,
-    0xE6, 0x2D, 0xBF, 0x4B, 0xEF, 0x36, 0x91, 0x16, 0xB6, 0xDE, 0x79, 0x34, 0xB4, 0x62, 0xCB, 0x03,
-    0xB2, 0x25, 0x2E, 0x69, 0xF0, 0xF5, 0x5E, 0xA2, 0x93, 0x61, 0x0D, 0xE8, 0x77, 0xA5, 0xB5, 0xC6,
-    0x79, 0xCD, 0xB3, 0xAE, 0x58, 0x0B, 0x56, 0xDB, 0x90, 0x21, 0x84, 0x2E, 0x61, 0xD0, 0xCE, 0x9F,
-    0x6C, 0xFC, 0xD5, 0x3D, 0xD2, 0xA3, 0xDD, 0xCB, 0x77, 0x1A, 0xFE, 0x46, 0xDB, 0x52, 0x11, 0x39,
-    0x5E, 0xE6, 0x41, 0x11, 0xC2, 0x6D, 0xCD, 0x22, 0x1E, 0xD0, 0x74, 0x08, 0xAE, 0xB3, 0xA0, 0x9B,
-    0x6E, 0xB6, 0x10, 0x2E, 0xD7, 0x59, 0xDB, 0x76, 0x32, 0xA3, 0x8B, 0xF6, 0xA4, 0xF1, 0x38, 0x48,
-    0x02, 0x3A, 0xD8, 0xCC, 0xFC, 0xB2, 0xBE, 0x6D, 0xA1, 0x1C, 0x15, 0xC9, 0x8A, 0x43, 0xDF, 0xB2,
-    0xF7, 0x10, 0x4F, 0x24, 0x10, 0x84, 0x5E, 0xE6, 0xF0, 0xE3, 0x7A, 0xAD, 0xF8, 0x83, 0xDD, 0x72,
-    0x46, 0x22, 0xB8, 0xC7, 0xDE, 0x65, 0xA4, 0x63, 0xFC, 0xBF, 0x2E, 0x60, 0x61, 0xA5, 0x38, 0xE6,
-    0x84, 0x3C, 0xB6, 0x43, 0x8E, 0x34, 0x21, 0xB0, 0x2E, 0x68, 0xEA, 0xE8, 0x6C, 0xFE, 0xC9, 0x65,
-    0x9B, 0x09, 0xAD, 0x42, 0xF1, 0x9C, 0x45, 0xD9, 0xAA, 0x21, 0x2B, 0x78, 0x8D, 0x8B, 0x7D, 0xAF,
-    0x73, 0xC3, 0xE0, 0x46, 0xF4, 0xF0, 0x3A, 0x50, 0xE5, 0x30, 0x95, 0xAD, 0xEC, 0x71, 0x01, 0x1A,
-    0x2D, 0x5E, 0xCB, 0xF8, 0x23, 0xB1, 0xE9, 0x5E, 0x68, 0x5F, 0x2B, 0x1B, 0xDB, 0x0B, 0xCF, 0x3C,
-    0x11, 0x42, 0x0D, 0x93, 0x2D, 0x0D, 0xDA, 0x80, 0x7D, 0x9D, 0xE0, 0x6D, 0xFC, 0x19, 0x36, 0x72,
-    0x3D, 0xAA, 0xFC, 0x36, 0x2E, 0x88, 0x1F, 0x78, 0x31, 0x6F, 0x34, 0xBF, 0x16, 0xE0, 0xFE, 0xD4,
-    0xB1, 0x98, 0x08, 0xAC, 0x34, 0xD2, 0xFA, 0xDD, 0xB8, 0x4E, 0xE5, 0x9F, 0xD0, 0xBE, 0xEF, 0xD0,
-    0x81, 0xB8, 0xF6, 0x99, 0xBC, 0xF4, 0x61, 0x81, 0xC8, 0x00, 0xD7, 0x1E, 0x93, 0xC7, 0x73, 0x92,
-    0x67, 0xD0, 0xF3, 0x96, 0xC4, 0x37, 0x07, 0x79, 0xC6, 0x9F, 0x0F, 0x36, 0x0F, 0x2A, 0xA0, 0xEE,
-    0x4D, 0x7D, 0x99, 0x85, 0x7D, 0x5E, 0x27, 0xAD, 0x51, 0x5B, 0x41, 0x2C, 0x3C, 0x5B, 0x5A, 0xC1,
-    0xE7, 0x56, 0x04, 0x69, 0xEF, 0x4B, 0x74, 0x1F, 0x7B, 0xD9, 0x19, 0x16, 0xE6, 0xE3, 0x9B, 0x39,
-    0x42, 0xB2, 0x83, 0xC8, 0x14, 0x0C, 0x70, 0x11, 0xDE, 0xC1, 0x6F, 0x25, 0x7A, 0xBF, 0x0E, 0xF5,
-    0x0D, 0x1B, 0xAC, 0x7B, 0x37, 0xDE, 0xC6, 0xF6, 0x9F, 0x40, 0xE3, 0xDA, 0xB1, 0x32, 0x2E, 0x0B,
-    0xF0, 0xFF, 0x60, 0x8E, 0xCB, 0x8E, 0x85, 0x33, 0xF3, 0x24, 0xA8, 0xE2, 0xCC, 0xB7, 0x25, 0x60,
-    0x3A, 0xEB, 0xF5, 0xCF, 0xAD, 0x27, 0xA7, 0x24, 0xAC, 0x12, 0xE0, 0x65, 0xB4, 0x81, 0x31, 0xD2,
-    0xCD, 0x63, 0xE3, 0xB6, 0xB5, 0x13, 0xA6, 0xB9, 0xED, 0x4C, 0xFC, 0x7F, 0x52, 0xAC, 0x7F, 0x5F,
-    0xEC, 0x35, 0x4E, 0x5A, 0x1C, 0x1F, 0xBF, 0xAD, 0xC0, 0x23, 0x62, 0xEA, 0x47, 0x89, 0x3E, 0x44,
-    0x5E, 0xF3, 0xF3, 0x6A, 0xFD, 0xD8, 0xB9, 0x57, 0x06, 0xF4, 0xF8, 0x00, 0x51, 0xE2, 0xBB, 0xAD,
-    0xFC, 0x38, 0x3C, 0x3E, 0xEE, 0x35, 0xE0, 0xAB, 0xDC, 0x41, 0xE2, 0xED, 0xE5, 0x1F, 0xD4, 0x88,
-    0xFB, 0x41, 0x4D, 0x9E, 0xAD, 0x8E, 0x2D, 0x9E, 0x7F, 0xA4, 0xC3, 0x1F, 0xFE, 0x6C, 0x65, 0xEE,
-    0xA8, 0xE8, 0xFC, 0xA3, 0x48, 0x30, 0x71, 0x3A, 0x6D, 0x9C, 0xCA, 0x8C, 0x36, 0x73, 0xF3, 0x9B,
-    0xF8, 0x51, 0x83, 0x89, 0x56, 0xA7, 0xB4, 0x85, 0x44, 0x7B, 0x02, 0x82, 0x17, 0x90, 0xFF, 0x15,
-    0x69, 0xEF, 0x8D, 0xAC, 0x43, 0x0D, 0xF0, 0x76, 0x08, 0x9C, 0xEF, 0xB0, 0x30, 0x5C, 0x5D, 0xDD,
-    0x62, 0x76, 0x59, 0x6F, 0xE5, 0x21, 0x56, 0xAE, 0x19, 0x8D, 0x35, 0x59, 0x83, 0x79, 0xB1, 0x95,
-    0xF0, 0x8B, 0x21, 0xBD, 0xD6, 0x48, 0xF0, 0x75, 0x9F, 0xDC, 0xAD, 0x25, 0xF8, 0xB6, 0x8B, 0x3F,
-    0xAD, 0xC4, 0xFF, 0xB6, 0x8D, 0xEF, 0xDB, 0xC3, 0xCC, 0x88, 0x52, 0x2A, 0x10, 0xF3, 0x17, 0x44,
-    0x95, 0x4D, 0xA4, 0xCB, 0x6A, 0xA7, 0x6A, 0xB0, 0xF8, 0x9D, 0x92, 0x3D, 0xA9, 0xB5, 0xC1, 0x3D,
-    0x0F, 0xA7, 0xAE, 0x2E, 0x9E, 0x5D, 0x91, 0x2B, 0xC5, 0x39, 0xC4, 0xF4, 0x65, 0x65, 0x6B, 0x8E,
-    0x35, 0x6B, 0x85, 0x70, 0x79, 0x92, 0xFE, 0xE3, 0x1B, 0xC4, 0xC9, 0xC9, 0x87, 0x5F, 0xB6, 0x08,
-    0x22, 0xFE, 0xF3, 0x45, 0x87, 0x1D, 0xF5, 0xD5, 0x67, 0xDB, 0x70, 0xAE, 0xDF, 0xD4, 0x0F, 0x07,
-    0x60, 0xA8, 0xA6, 0x1E, 0xBA, 0x57, 0x61, 0xE7, 0xFA, 0x5A, 0xE4, 0x2D, 0xC3, 0x16, 0x06, 0xCF,
-    0x6A, 0xA7, 0xC8, 0xEE, 0x71, 0x26, 0x31, 0x83, 0x78, 0xC8, 0x80, 0x83, 0xC6, 0x29, 0x51, 0x89,
-    0xD4, 0x3E, 0x47, 0x0C, 0x9F, 0xD6, 0x11, 0x62, 0xF1, 0xB8, 0x8D, 0xBA, 0x14, 0xB1, 0xBC, 0xA9,
-    0xFC, 0x91, 0x25, 0x2F, 0x7A, 0x2C, 0x3A, 0xFF, 0xFE, 0xB1, 0x12, 0xD3, 0x1E, 0x64, 0x27, 0x9D,
-    0xA3, 0x75, 0x12, 0x74, 0x83, 0x44, 0x95, 0xAB, 0xDC, 0xDC, 0x90, 0xD3, 0xD7, 0xCB, 0x2C, 0x6E,
-    0x99, 0xF2, 0xA6, 0x55, 0x6A, 0x13, 0xE3, 0xB8, 0xE1, 0x79, 0x12, 0x76, 0x58, 0x07, 0xBB, 0xB9,
-    0xCD, 0x9F, 0x0C, 0x0C, 0xF6, 0x3D, 0x57, 0xCE, 0x6A, 0x6C, 0x46, 0xBC, 0xF8, 0x71, 0x8D, 0xA7,
-    0xAE, 0xD8, 0x41, 0x08, 0x56, 0x8C, 0xBF, 0x5F, 0xC4, 0x5E, 0x37, 0xF0, 0x13, 0x88, 0x48, 0x2E,
-    0x3F, 0x25, 0x6B, 0x97, 0x81, 0x29, 0x38, 0xDD, 0x22, 0xEB, 0x13, 0x73, 0x81, 0x95, 0xFB, 0x79,
-    0x41, 0x67, 0x37, 0x78, 0x2C, 0x89, 0x24, 0x8E, 0x45, 0x2A, 0xA6, 0x3B, 0x7C, 0x2F, 0x99, 0x7F,
-    0x0C, 0xA4, 0x3C, 0x54, 0x9C, 0x6B, 0x57, 0xAD, 0x13, 0x83, 0xDE, 0x74, 0x41, 0x4B, 0x3F, 0xF0,
-    0xCA, 0xAC, 0x5A, 0x20, 0xD7, 0x7F, 0xCB, 0xE8, 0xC8, 0x03, 0x44, 0xDE, 0x6F, 0xF9, 0x06, 0x6B,
-    0xD8, 0xEC, 0x18, 0x18, 0x12, 0x96, 0x96, 0xC7, 0x5C, 0xA7, 0x7C, 0x3E, 0x91, 0x67, 0x79, 0x29,
-    0x75, 0x15, 0x03, 0x39, 0x9D, 0xAD, 0x1D, 0xDB, 0xD5, 0x45, 0x01, 0xF3, 0xF9, 0xA3, 0x63, 0xDB,
-    0x2B, 0xC2, 0x59, 0x23, 0xB6, 0xF4, 0xD1, 0xEF, 0xA5, 0x8A, 0xA3, 0x62, 0xE3, 0xD1, 0x03, 0xCF,
-    0x77, 0xB2, 0x03, 0xD2, 0x8D, 0x3D, 0xAF, 0xFF, 0x03, 0xCD, 0x5A, 0x3D, 0xB0, 0xD5, 0xD6, 0x11,
-    0x5E, 0x49, 0x06, 0xC5, 0x68, 0x26, 0x72, 0x43, 0x11, 0x18, 0x50, 0x93, 0x22, 0x66, 0x62, 0xAB,
-    0x49, 0x91, 0x82, 0x20, 0xE1, 0x26, 0x05, 0x45, 0x28, 0x7C, 0xA1, 0xA0, 0xA0, 0x49, 0x91, 0x71,
-    0x43, 0x9A, 0xCC, 0x38, 0x33, 0x31, 0x52, 0xEF, 0x82, 0xD7, 0x64, 0xD2, 0xC5, 0xAF, 0x48, 0x61,
-    0x3F, 0x17, 0xA4, 0xA0, 0xB0, 0x67, 0x00, 0xC9, 0x76, 0xE1, 0x22, 0x8D, 0x48, 0x86, 0x71, 0xE1,
-    0x22, 0x22, 0x03, 0x93, 0xC9, 0xA4, 0x40, 0x71, 0x64, 0x46, 0x06, 0x5D, 0x9D, 0x7C, 0xDF, 0x9E,
-    0x73, 0x7F, 0xDE, 0xE3, 0xC7, 0x10, 0xDE, 0x23, 0xB9, 0xE8, 0xEC, 0x0E, 0x57, 0xBA, 0xE7, 0xEC,
-    0x9E, 0xB3, 0x3F, 0xDF, 0xAE, 0x9E, 0x88, 0x48, 0x95, 0x4B, 0x6A, 0xCA, 0x4A, 0x7C, 0x63, 0xFA,
-    0x49, 0x22, 0x63, 0xCC, 0x28, 0xC9, 0x10, 0x9A, 0x5E, 0xB2, 0x56, 0x4C, 0x2D, 0x99, 0x5E, 0x45,
-    0x49, 0x5A, 0x95, 0x92, 0x36, 0xFA, 0x8B, 0x25, 0xD5, 0x6F, 0xEC, 0x5D, 0x77, 0xB5, 0xFC, 0x32,
-    0x19, 0x7C, 0x23, 0x9C, 0x6D, 0x2E, 0x9C, 0x79, 0xC0, 0x42, 0x17, 0x4C, 0x29, 0xAB, 0xCF, 0x31,
-    0xFE, 0x27, 0x2B, 0xA5, 0xDA, 0x28, 0xF2, 0xC8, 0xCC, 0x0D, 0x84, 0xC0, 0xC2, 0x59, 0x53, 0xB5,
-    0x98, 0x8D, 0x4B, 0x71, 0x5E, 0x23, 0x89, 0x23, 0x95, 0x5D, 0x52, 0x97, 0x28, 0x6A, 0x3E, 0x9C,
-    0x4B, 0x6C, 0x26, 0x11, 0x0F, 0x82, 0xAE, 0x3E, 0x55, 0x5E, 0x49, 0x30, 0x54, 0xF8, 0x4D, 0x30,
-    0x4E, 0xA4, 0x98, 0x93, 0xB4, 0x23, 0x9D, 0x72, 0xFD, 0x5E, 0x9E, 0x96, 0x0E, 0x9C, 0x2F, 0x04,
-    0x2D, 0x9A, 0xA4, 0x83, 0xB0, 0xC6, 0xB4, 0x82, 0x45, 0xA9, 0x86, 0x47, 0xBD, 0x56, 0x1F, 0xFF,
-    0x7D, 0x90, 0x60, 0x38, 0x96, 0x1F, 0xF8, 0x5D, 0x5F, 0x94, 0xC9, 0xDD, 0x0E, 0xC4, 0xD4, 0x20,
-    0x13, 0x94, 0x49, 0x9A, 0x87, 0x09, 0x94, 0xC9, 0xCA, 0xAC, 0xA1, 0x32, 0x0D, 0x27, 0x6E, 0x24,
-    0x31, 0x77, 0x1B, 0x09, 0xCD, 0xA9, 0x46, 0x1E, 0xFA, 0x84, 0x6D, 0xAA, 0x3B, 0xE7, 0xCD, 0xAF,
-    0x3B, 0x2D, 0x47, 0xCB, 0xD3, 0x6E, 0xA5, 0xB8, 0xD9, 0xE0, 0x3C, 0x1D, 0x37, 0xDC, 0x72, 0x53,
-    0x2A, 0x9F, 0x99, 0xF6, 0xE0, 0xAC, 0x68, 0x8C, 0x3E, 0x5C, 0x94, 0x46, 0xE2, 0x9E, 0xCA, 0x19,
-    0x81, 0x62, 0xC1, 0x68, 0x95, 0x8D, 0x7A, 0xCB, 0x93, 0xCE, 0x72, 0xEC, 0xB2, 0xF2, 0x2A, 0xD7,
-    0xE7, 0xBC, 0x89, 0xBF, 0x88, 0x7B, 0xBB, 0x2D, 0x69, 0x17, 0x71, 0x06, 0xCF, 0x34, 0x09, 0xB6,
-    0x63, 0xB9, 0xCE, 0x72, 0x5D, 0x2B, 0xC7, 0xBA, 0xFC, 0x71, 0x7D, 0x51, 0xE5, 0x0B, 0xEF, 0x61,
-    0x3D, 0x3C, 0xE7, 0xF1, 0x38, 0xB8, 0x8D, 0x15, 0xD6, 0x99, 0x71, 0x53, 0xED, 0xBC, 0x87, 0xB6,
-    0x3E, 0xD0, 0x75, 0x52, 0x33, 0xE9, 0xBA, 0x96, 0x63, 0xD5, 0x70, 0xA7, 0x9C, 0xED, 0x9A, 0x9C,
-    0xD0, 0xC3, 0x58, 0xF9, 0xFC, 0xB9, 0x9D, 0x87, 0x47, 0x46, 0xF9, 0xE2, 0xCE, 0xCA, 0x07, 0x63,
-    0x11, 0x27, 0x9F, 0x38, 0xF9, 0x56, 0xC2, 0x65, 0xF5, 0xB5, 0xA0, 0x27, 0x4B, 0xDF, 0x6B, 0xC8,
-    0x62, 0x18, 0x16, 0x58, 0x30, 0xE9, 0x3D, 0x9E, 0xED, 0x3C, 0xAB, 0xB7, 0xB6, 0x36, 0x63, 0x73,
-    0xB9, 0x86, 0x5E, 0xF8, 0x2D, 0x59, 0x71, 0x03, 0x9E, 0x91, 0xB6, 0x55, 0xA9, 0x06, 0x09, 0xE3,
-    0xAC, 0x75, 0x4F, 0xD3, 0x1A, 0x32, 0x90, 0xA9, 0x50, 0x69, 0x0D, 0x09, 0x68, 0xB3, 0xF4, 0x1F,
-    0x58, 0x2D, 0xB6, 0xD3, 0xFE, 0xBC, 0xC7, 0x61, 0x7F, 0x02, 0x16, 0x9A, 0x98, 0x6C, 0x71, 0x84,
-    0xF0, 0x97, 0xCE, 0xEC, 0x0E, 0x31, 0xE3, 0x3A, 0xE1, 0x19, 0x90, 0xD0, 0x8A, 0x23, 0xD8, 0x1A,
-    0x08, 0x34, 0x8B, 0xA6, 0xED, 0x66, 0x16, 0x35, 0x15, 0x9F, 0x33, 0x8E, 0xEC, 0x2F, 0x8D, 0x3D,
-    0x18, 0x39, 0xB0, 0xC1, 0xEF, 0xDA, 0x67, 0x23, 0x66, 0x5C, 0x27, 0x94, 0x60, 0x49, 0x52, 0x90,
-    0x80, 0x62, 0x04, 0x14, 0x23, 0xB0, 0x62, 0xC0, 0x1D, 0x30, 0xB0, 0x5B, 0x3A, 0x5E, 0x65, 0x68,
-    0xC0, 0x78, 0x8B, 0xDF, 0x3D, 0xF3, 0xD0, 0xBD, 0xD4, 0x01, 0x59, 0x52, 0x0E, 0x58, 0x46, 0x7A,
-    0x9B, 0xF6, 0x56, 0x48, 0x91, 0xC3, 0xFC, 0x94, 0xF5, 0x96, 0x8D, 0x96, 0x4D, 0xCA, 0x10, 0x88,
-    0xC8, 0xA6, 0xA2, 0x54, 0x96, 0x35, 0xCA, 0xE2, 0x4E, 0x59, 0xD4, 0x2B, 0x0B, 0x46, 0x65, 0xDE,
-    0x94, 0x91, 0x89, 0xD1, 0xFF, 0x49, 0x61, 0x94, 0xA5, 0x96, 0xC5, 0x96, 0x45, 0x96, 0x05, 0x64,
-    0x8B, 0x43, 0xA6, 0x27, 0x5B, 0x03, 0xAC, 0xA6, 0x75, 0x77, 0xAE, 0x5A, 0x79, 0xC4, 0xE7, 0xA2,
-    0x95, 0x1A, 0xD6, 0xD5, 0x59, 0x46, 0xA9, 0x7F, 0x20, 0x2A, 0x35, 0xF4, 0xA3, 0xD4, 0x5B, 0xA2,
-    0x52, 0x1B, 0x51, 0xA9, 0xC1, 0x28, 0x35, 0x18, 0xA5, 0x06, 0xA3, 0xD4, 0x60, 0x94, 0x1A, 0x8C,
-    0x52, 0x83, 0x51, 0x6A, 0xB2, 0xC2, 0x28, 0x4B, 0x2D, 0x8B, 0x2D, 0x8B, 0x2C, 0x0B, 0xC8, 0xC4,
-    0x19, 0xC1, 0x8A, 0x39, 0xE1, 0x33, 0x77, 0x6E, 0x56, 0xF8, 0x6C, 0x5D, 0xF8, 0xA4, 0x94, 0x85,
-    0xF7, 0x38, 0x7A, 0x20, 0x77, 0x51, 0x1F, 0x8E, 0x71, 0xA8, 0xCC, 0x32, 0x43, 0xAF, 0x80, 0x2F,
-    0x80, 0xF6, 0x45, 0x43, 0x0F, 0x49, 0x95, 0x26, 0xA4, 0xE5, 0xB3, 0xD1, 0x9D, 0x6B, 0x15, 0xA4,
-    0xB1, 0x26, 0x9B, 0x58, 0x45, 0x8D, 0x06, 0x27, 0xD7, 0x18, 0x32, 0x8C, 0x5F, 0xC0, 0xFD, 0x84,
-    0x37, 0xC2, 0x65, 0x0C, 0x8F, 0xA9, 0x44, 0xCC, 0xFF, 0xD2, 0x5A, 0x24, 0xE3, 0x29, 0x15, 0xB4,
-    0xC0, 0x0A, 0x8E, 0x2D, 0x53, 0x52, 0x23, 0xF6, 0xC2, 0x74, 0xFD, 0x11, 0x6E, 0x14, 0x8C, 0x61,
-    0x2F, 0xE1, 0x37, 0xE7, 0x06, 0x66, 0xB7, 0x91, 0xF9, 0x60, 0x8E, 0xE9, 0x70, 0x10, 0x19, 0x53,
-    0x15, 0x33, 0x57, 0x8E, 0x74, 0x58, 0xD4, 0x88, 0x23, 0x56, 0x1E, 0x86, 0x3F, 0x86, 0x3E, 0x86,
-    0x3D, 0x1E, 0xA6, 0xEE, 0x61, 0xC5, 0x88, 0x3F, 0x6A, 0x0A, 0x7B, 0x59, 0xF7, 0x15, 0x4B, 0x9E,
-    0x31, 0x9C, 0x0D, 0x1B, 0x8B, 0x7D, 0xCF, 0x99, 0xC3, 0x2A, 0x0D, 0x2A, 0xE6, 0x9F, 0x38, 0x5D,
-    0x1C, 0x57, 0x32, 0x4F, 0x97, 0x41, 0xCB, 0x1B, 0xE3, 0x2F, 0xBB, 0xD0, 0xD4, 0x1E, 0xA3, 0x15,
-    0x7E, 0xD5, 0xE1, 0xA2, 0x67, 0x6B, 0x24, 0x7C, 0xF2, 0x15, 0x22, 0x30, 0xEA, 0xF3, 0x9C, 0xE7,
-    0xE4, 0x18, 0x7F, 0xD1, 0xC1, 0x17, 0xED, 0x3C, 0xF2, 0x01, 0x94, 0x7D, 0xBA, 0x4B, 0x3F, 0xD7,
-    0x02, 0xEE, 0x27, 0xE3, 0xA6, 0x46, 0xCD, 0x60, 0x19, 0x50, 0x00, 0x28, 0x14, 0x4F, 0x58, 0x00,
-    0x40, 0x34, 0xA1, 0x60, 0xA2, 0xB4, 0x81, 0x90, 0x60, 0x01, 0x10, 0x01, 0xB9, 0x9E, 0x10, 0x62,
-    0x45, 0xF4, 0x86, 0x06, 0x54, 0xC5, 0x10, 0x0A, 0x21, 0x74, 0x02, 0x0B, 0x20, 0xB6, 0xE1, 0x87,
-    0xB8, 0xC9, 0x24, 0xF8, 0x86, 0x09, 0x09, 0xE1, 0xB3, 0x70, 0xC6, 0x57, 0x6D, 0xE0, 0xF9, 0x91,
-    0xE0, 0x80, 0x93, 0x97, 0x45, 0xAE, 0xA1, 0xB9, 0x21, 0x80, 0xE0, 0xA8, 0x74, 0xA1, 0xB4, 0x26,
-    0x82, 0x48, 0xEF, 0x9B, 0x9C, 0x9B, 0xBF, 0x0E, 0x1F, 0x90, 0x67, 0x73, 0x1F, 0xB0, 0x41, 0x2A,
-    0xAC, 0x96, 0x75, 0xCE, 0x5F, 0x83, 0x81, 0xB9, 0xE6, 0x19, 0xC6, 0x40, 0xD0, 0x40, 0xC8, 0x40,
-    0xC0, 0x40, 0xB8, 0xB0, 0x0E, 0x16, 0x22, 0x5D, 0x63, 0xEE, 0xD6, 0xB0, 0x72, 0x03, 0x36, 0x6C,
-    0x10, 0x17, 0x3C, 0x69, 0x64, 0x25, 0x1D, 0x04, 0xAE, 0x02, 0xAC, 0x40, 0xA8, 0x10, 0x9A, 0x77,
-    0x15, 0x29, 0x78, 0xC8, 0x99, 0x3E, 0xF4, 0xF0, 0xDD, 0x1A, 0x5E, 0xFF, 0x8E, 0xF8, 0xC3, 0x35,
-    0x91, 0xF6, 0xC7, 0xBB, 0x2E, 0xBF, 0x37, 0x7B, 0x13, 0x31, 0x61, 0xAE, 0x43, 0x51, 0x4F, 0xF7,
-    0x91, 0x04, 0xDD, 0xA8, 0xFC, 0x79, 0xF5, 0xB0, 0x0B, 0x4C, 0xA2, 0xA8, 0x2B, 0xC2, 0xBE, 0xEC,
-    0xDB, 0x5B, 0x5D, 0xAC, 0x02, 0x6E, 0xBD, 0x18, 0x22, 0x1C, 0xDA, 0x5D, 0x7D, 0x3C, 0xFC, 0xF3,
-    0xBB, 0x13, 0x22, 0xD7, 0xDD, 0x39, 0xEF, 0xCB, 0xF7, 0x5C, 0x9F, 0xA0, 0xF9, 0x89, 0x78, 0xF7,
-    0x9D, 0x3F, 0x1C, 0xCC, 0x77, 0xFD, 0x7C, 0x88, 0xFF, 0x34, 0x81, 0x11, 0x8E, 0xBE, 0x00, 0x7D,
-    0x00, 0xFB, 0x10, 0x77, 0x19, 0xA6, 0x6C, 0x06, 0xD9, 0x4D, 0x7D, 0xF6, 0x4F, 0x04, 0x63, 0xA8,
-    0x71, 0xB0, 0xDE, 0xF7, 0x35, 0xA3, 0x55, 0xC4, 0x7D, 0x65, 0x05, 0x19, 0x88, 0x19, 0xCD, 0x16,
-    0x6B, 0xA2, 0x22, 0x67, 0x96, 0xCC, 0xFE, 0x3E, 0x69, 0xB0, 0xF6, 0x8D, 0x8B, 0x33, 0x6F, 0x6D,
-    0xE1, 0xD9, 0x82, 0xE0, 0xA5, 0x58, 0xC6, 0xA4, 0x13, 0x09, 0xBE, 0xBB, 0xC8, 0xCC, 0xF7, 0x5A,
-    0xB4, 0xE7, 0x69, 0xC5, 0x9B, 0x9D, 0xC6, 0x63, 0x83, 0x0E, 0x3D, 0x99, 0x1B, 0x9D, 0x44, 0x7F,
-    0x1B, 0x94, 0x3F, 0x77, 0x7A, 0x51, 0xED, 0xAA, 0x95, 0x76, 0xCC, 0x0C, 0x0C, 0xF4, 0x96, 0x78,
-    0xED, 0x9E, 0x6B, 0xB7, 0x7F, 0xEB, 0x0F, 0xDB, 0xB4, 0xD3, 0xF3, 0xE7, 0x78, 0x5D, 0x76, 0x21,
-    0x79, 0xAA, 0x7A, 0x56, 0xBF, 0xB5, 0xE3, 0xD3, 0x4A, 0xA1, 0x67, 0xA6, 0x01, 0x0D, 0x94, 0x46,
-    0xF7, 0x26, 0x6C, 0x73, 0x7C, 0x8B, 0x1A, 0x26, 0x9F, 0xA8, 0x1D, 0x2A, 0x2D, 0x4E, 0xB2, 0x10,
-    0xAC, 0x3C, 0x56, 0x39, 0x13, 0xA9, 0x3F, 0x9D, 0x99, 0x66, 0x79, 0xA0, 0xB5, 0xAE, 0xAD, 0x78,
-    0x55, 0x3F, 0x64, 0x1C, 0x06, 0x34, 0x9C, 0x16, 0x66, 0x2B, 0x72, 0x52, 0x23, 0xA4, 0x42, 0x05,
-    0x61, 0xDE, 0x66, 0x54, 0x3A, 0x2C, 0xC3, 0x91, 0x29, 0x8B, 0x0D, 0x68, 0xF6, 0xC0, 0xEE, 0x10,
-    0xB4, 0xD9, 0x87, 0x02, 0x9C, 0xC0, 0x91, 0x90, 0x58, 0x66, 0x66, 0x56, 0xD4, 0x09, 0xBF, 0xAF,
-    0xB3, 0xFB, 0xA4, 0x2C, 0x76, 0xB5, 0x96, 0xCB, 0xB5, 0xDE, 0xA9, 0x3D, 0xA9, 0xBE, 0x34, 0xF7,
-    0x2F, 0x43, 0xAB, 0xCF, 0xF1, 0x5B, 0xD4, 0x9E, 0x66, 0x3B, 0xC2, 0x3F, 0x6C, 0xB4, 0x60, 0x1B,
-    0xA9, 0x5F, 0x2F, 0xF1, 0x24, 0xBF, 0xB4, 0x15, 0x64, 0xD6, 0x2C, 0x50, 0x53, 0x51, 0x6E, 0xBD,
-    0x8F, 0xC5, 0xCC, 0x68, 0x49, 0x91, 0x9F, 0x01, 0x29, 0xCF, 0xCE, 0x99, 0x48, 0x91, 0xBD, 0x1B,
-    0x90, 0xA4, 0xF7, 0x51, 0x88, 0x99, 0xCB, 0x74, 0x07, 0x2A, 0x50, 0x98, 0xDB, 0x8B, 0x60, 0x7A,
-    0xA0, 0x8C, 0xCD, 0x5D, 0x85, 0x75, 0x2C, 0x8F, 0x58, 0xF8, 0xB0, 0x06, 0x5A, 0x0C, 0xFE, 0xBF,
-    0x42, 0xE6, 0xCD, 0x1E, 0x18, 0x6A, 0x51, 0x87, 0x13, 0xE1, 0x11, 0xD3, 0xBD, 0xBA, 0x61, 0xFF,
-    0x0A, 0x52, 0x7E, 0x86, 0xD3, 0xA2, 0x47, 0x1E, 0x5E, 0x78, 0xDA, 0x1C, 0x88, 0x2D, 0x3B, 0x5F,
-    0x2B, 0xBE, 0x58, 0xC0, 0x35, 0xDE, 0xC4, 0xD2, 0x54, 0x82, 0x3A, 0x50, 0x05, 0x6A, 0x40, 0x05,
-    0x0A, 0x5A, 0x1F, 0x24, 0xE7, 0x20, 0xB2, 0x2F, 0x4A, 0x7F, 0xCC, 0x6A, 0x8C, 0xD6, 0x1F, 0x01,
-    0x27, 0x46, 0x1A, 0x9F, 0x8A, 0xBD, 0x94, 0x9A, 0xC1, 0xBF, 0x90, 0xE0, 0x1E, 0x91, 0x04, 0x0B,
-    0x64, 0x1B, 0xEC, 0xFC, 0xF9, 0x4A, 0x17, 0x68, 0x5D, 0xB3, 0xCE, 0xAB, 0xD6, 0x74, 0x59, 0xE8,
-    0x53, 0xAC, 0xEB, 0x63, 0x9C, 0x3E, 0x18, 0x3F, 0x12, 0xAD, 0x8A, 0x9D, 0x2E, 0xCD, 0x1A, 0x62,
-    0x99, 0x5B, 0xC4, 0xE2, 0x32, 0x7F, 0xA5, 0xA5, 0x16, 0x11, 0x4A, 0x55, 0xE2, 0x04, 0xC5, 0xB0,
-    0x22, 0x47, 0x81, 0x6E, 0x50, 0x22, 0x19, 0x28, 0xC3, 0x22, 0x19, 0x53, 0x8B, 0xB9, 0x8B, 0x8A,
-    0xF9, 0xD4, 0x60, 0xEF, 0xFB, 0x6A, 0xD7, 0xB9, 0xA1, 0xBB, 0xA0, 0x96, 0xB2, 0x15, 0xBD, 0x05,
-    0x73, 0x58, 0xE5, 0x8B, 0xCE, 0xD5, 0x55, 0x0E, 0xD2, 0xF1, 0x33, 0x3D, 0x9E, 0x1C, 0x2B, 0x59,
-    0x0B, 0x08, 0xCB, 0x03, 0x10, 0xCE, 0x34, 0x71, 0x33, 0x27, 0x46, 0x43, 0x2D, 0x93, 0xB5, 0xDD,
-    0xC1, 0x06, 0x05, 0x04, 0xC3, 0xD4, 0x13, 0x83, 0xF2, 0xE4, 0x2B, 0x08, 0xC4, 0x02, 0x93, 0xC3,
-    0xB8, 0x7B, 0x09, 0xF9, 0xBC, 0x5E, 0x73, 0x1B, 0x7D, 0x85, 0x6B, 0x45, 0x3C, 0xB9, 0x80, 0xB6,
-    0xE0, 0x7D, 0xF4, 0x1C, 0x98, 0x8F, 0xE1, 0xE0, 0x38, 0xC6, 0x55, 0x8C, 0xEB, 0xA5, 0x35, 0x9F,
-    0xC3, 0xE0, 0xC7, 0xB6, 0x58, 0x78, 0x72, 0x03, 0x95, 0xBC, 0x58, 0xDD, 0xC2, 0x3B, 0xB2, 0x80,
-    0xD1, 0x1F, 0xC3, 0x0A, 0xE1, 0x8C, 0xA1, 0xBA, 0xEB, 0xF8, 0x7C, 0xF8, 0x36, 0xD9, 0xA9, 0x6B,
-    0x63, 0x75, 0xD5, 0xA2, 0x3F, 0xCB, 0xFD, 0x1D, 0x56, 0x89, 0xF9, 0xEB, 0xC5, 0xD8, 0x87, 0xB8,
-    0xAA, 0x89, 0x98, 0xBD, 0x03, 0xEC, 0x11, 0xAD, 0xCA, 0xB7, 0x3A, 0x94, 0x1A, 0x88, 0xD9, 0x8C,
-    0xD1, 0xEE, 0x42, 0xDC, 0xFE, 0x1C, 0x52, 0x15, 0xF4, 0x7E, 0xC3, 0x6E, 0xDE, 0xB0, 0xD6, 0x58,
-    0x78, 0xD8, 0xF2, 0x8F, 0x6D, 0x6D, 0x95, 0xEA, 0x5D, 0x34, 0x6F, 0x4E, 0x4A, 0xFB, 0xE3, 0x34,
-    0xB4, 0x27, 0xC3, 0x58, 0xD8, 0x2B, 0xAE, 0xF5, 0x3E, 0x34, 0xEE, 0x70, 0x92, 0xC6, 0xB6, 0x0F,
-    0xB8, 0x5E, 0xDA, 0xFC, 0x0A, 0x95, 0x14, 0xD6, 0xC9, 0x8B, 0x55, 0xB4, 0x58, 0x14, 0x33, 0xF5,
-    0x33, 0x17, 0x33, 0x7A, 0xF9, 0x73, 0x29, 0x10, 0x18, 0x06, 0x06, 0x93, 0xFF, 0xB7, 0x6E, 0x1A,
-    0xE5, 0x51, 0x5F, 0x9C, 0xBB, 0x4C, 0xC5, 0xC3, 0x73, 0xAD, 0x33, 0xD7, 0x39, 0x73, 0x8D, 0x33,
-    0xD7, 0x37, 0x73, 0x6D, 0x33, 0x27, 0x8F, 0x6B, 0x9A, 0x39, 0x69, 0x5C, 0xCB, 0xCC, 0x75, 0xCC,
-    0x5C, 0xC3, 0xCC, 0xF5, 0xCB, 0x5C, 0xBB, 0xCC, 0xAD, 0xBF, 0x6C, 0x96, 0x39, 0x27, 0x7F, 0x3C,
-    0x7B, 0x61, 0x4D, 0x32, 0x59, 0xAE, 0x69, 0x2C, 0x76, 0x0F, 0x9B, 0x3D, 0xC9, 0x0A, 0x1A, 0x61,
-    0x78, 0x34, 0x80, 0x31, 0x72, 0x42, 0xF6, 0x24, 0x2B, 0x54, 0x6A, 0xCF, 0xE6, 0x91, 0x74, 0xFF,
-    0x26, 0x29, 0xDB, 0x79, 0x4A, 0x81, 0x38, 0x76, 0xD0, 0xD9, 0xF9, 0xD5, 0xDD, 0x05, 0xED, 0x98,
-    0x4D, 0xE2, 0x9E, 0x27, 0x0D, 0x9D, 0x1A, 0x36, 0xBE, 0x0D, 0xBB, 0x78, 0xD5, 0x7A, 0xB3, 0xFA,
-    0x6A, 0x34, 0xC8, 0x9C, 0x6D, 0x1F, 0xEE, 0x72, 0x8B, 0x1C, 0x52, 0x23, 0x82, 0xE4, 0xFC, 0x0D,
-    0x5B, 0x77, 0xE4, 0x8C, 0x26, 0x34, 0x13, 0xE6, 0x17, 0xE4, 0x19, 0xB6, 0x81, 0x12, 0x76, 0x6E,
-    0x3B, 0x9B, 0x8B, 0xE8, 0xC8, 0x8D, 0x6D, 0x06, 0x3D, 0x6A, 0xD8, 0x8F, 0xC2, 0x09, 0x9A, 0xB4,
-    0x04, 0x7A, 0x74, 0x57, 0x17, 0x4D, 0x4E, 0x6D, 0x66, 0x69, 0x2B, 0x8B, 0x8D, 0x2C, 0x6D, 0x63,
-    0x69, 0x13, 0x4B, 0x5B, 0x58, 0xDA, 0xC0, 0xD2, 0xF6, 0x95, 0x36, 0xAF, 0xB4, 0x75, 0xA5, 0x8D,
-    0x2B, 0x6D, 0x5B, 0x69, 0xD3, 0x4A, 0x5B, 0x56, 0xDA, 0xB0, 0xD2, 0x76, 0x95, 0x36, 0xAB, 0xB4,
-    0x55, 0xB5, 0x6C, 0x4D, 0x11, 0x82, 0x72, 0x1B, 0xFD, 0x6E, 0xD9, 0x72, 0xD2, 0x86, 0x13, 0x4F,
-    0x4D, 0x9B, 0x4D, 0xAC, 0x08, 0x58, 0x19, 0x3C, 0x79, 0x58, 0x1D, 0xB4, 0xFE, 0xF0, 0x37, 0x17,
-    0x44, 0x31, 0xEF, 0xD1, 0xA3, 0x20, 0x47, 0x48, 0xE2, 0x6B, 0x24, 0xD3, 0x0A, 0x02, 0xE7, 0xDB,
-    0x21, 0x70, 0x23, 0x9E, 0x45, 0xBF, 0x11, 0xC8, 0x10, 0xF6, 0x4B, 0xF4, 0x3B, 0x5A, 0xF4, 0x9B,
-    0x6E, 0x43, 0xBF, 0xE5, 0xB2, 0x65, 0xA4, 0x2D, 0x2B, 0x4E, 0xF1, 0x2A, 0x15, 0xE0, 0xC6, 0x22,
-    0x48, 0xDE, 0x6A, 0x75, 0xC8, 0x83, 0xC6, 0x9A, 0xF4, 0x13, 0x90, 0x30, 0x26, 0x97, 0xE2, 0xDB,
-    0xDB, 0x48, 0xEE, 0x48, 0x4A, 0x57, 0x7A, 0x2F, 0xCE, 0x2A, 0xAA, 0xE5, 0x7F, 0x81, 0x8A, 0x17,
-    0xD9, 0x42, 0x13, 0x47, 0x62, 0x43, 0x7A, 0xBE, 0x6E, 0x3B, 0x7B, 0x8F, 0x90, 0xB5, 0x35, 0x6D,
-    0x5B, 0xB5, 0xD4, 0x29, 0xB0, 0xB9, 0xEA, 0x3B, 0x3C, 0x5E, 0x7D, 0x41, 0x36, 0xDF, 0x86, 0x00,
-    0x42, 0x22, 0x80, 0x98, 0xEF, 0x79, 0x32, 0x22, 0x80, 0x77, 0x88, 0x00, 0x06, 0xA4, 0xE0, 0x37,
-    0x3A, 0x90, 0x9F, 0x36, 0x40, 0x00, 0x97, 0xF0, 0x40, 0x76, 0x97, 0x08, 0x60, 0x4E, 0x04, 0x30,
-    0x2E, 0x10, 0x40, 0x48, 0x04, 0x10, 0xDF, 0x45, 0x18, 0x0F, 0x77, 0xBC, 0xEA, 0x19, 0xAD, 0xED,
-    0x52, 0xF1, 0xA5, 0xCB, 0xFC, 0x9E, 0x3F, 0xB2, 0x59, 0xFF, 0x06, 0xAA, 0xD2, 0x37, 0xA0, 0x57,
-    0x08, 0xDF, 0x8D, 0xDF, 0x6B, 0x4C, 0x0A, 0x5F, 0x7D, 0x07, 0xAB, 0x0D, 0x88, 0x3A, 0x5D, 0xA1,
-    0x6F, 0x3A, 0x62, 0xCC, 0x9F, 0xE2, 0x10, 0x5E, 0x5E, 0x6E, 0xE8, 0xBF, 0x07, 0x9E, 0x2C, 0x2D,
-    0x77, 0x64, 0x15, 0xF5, 0x5A, 0x94, 0xBF, 0x88, 0xB6, 0x67, 0x76, 0xA9, 0x95, 0xF8, 0x2F, 0xF8,
-    0x61, 0x87, 0xE5, 0xAF, 0x1C, 0xB7, 0x2B, 0x5E, 0xE8, 0xA9, 0xBB, 0xC6, 0x25, 0x9F, 0x2F, 0xF3,
-    0x68, 0xE4, 0x07, 0xAB, 0x1A, 0xFF, 0xC7, 0x46, 0x56, 0x88, 0xAA, 0x44, 0x2F, 0x1C, 0x19, 0x4F,
-    0x10, 0x67, 0xF9, 0x57, 0x44, 0xD0, 0x53, 0xCE, 0x1E, 0x29, 0x76, 0x32, 0x2D, 0xCA, 0xB6, 0xF9,
-    0x39, 0x7C, 0xDD, 0xF9, 0xCD, 0x9E, 0xEB, 0xF2, 0x12, 0xE3, 0x4A, 0xA3, 0x85, 0x5A, 0x7C, 0xF3,
-    0xAA, 0xC4, 0xF2, 0xC3, 0xDD, 0x68, 0xE1, 0x3E, 0x72, 0x7F, 0x20, 0x4E, 0xCE, 0x2E, 0x88, 0x8E,
-    0xAF, 0x67, 0x16, 0x57, 0x2D, 0x86, 0x31, 0xAB, 0xB1, 0xF3, 0x9E, 0xBD, 0x5F, 0x2E, 0xC6, 0x72,
-    0xFE, 0xCF, 0xDC, 0xFC, 0xBD, 0xDB, 0xFF, 0xF4, 0x36, 0xCD, 0x98, 0xEB, 0x20, 0xED, 0xA6, 0x4D,
-    0xD2, 0xC4, 0x6D, 0x7A, 0xF3, 0x7C, 0x9B, 0xD9, 0xA4, 0xDD, 0x71, 0xAB, 0xD2, 0x46, 0xE7, 0xCB,
-    0xA3, 0xE9, 0x43, 0x3D, 0x97, 0x65, 0x91, 0xFC, 0x0A, 0xB6, 0xA0, 0x4C, 0x4C, 0x9B, 0x9D, 0xE9,
-    0x8E, 0xCB, 0x1F, 0xB5, 0x86, 0xEE, 0x61, 0xC7, 0xBC, 0x66, 0xA7, 0x57, 0x0D, 0x66, 0xA2, 0x16,
-    0xBD, 0xD6, 0xBF, 0xE4, 0xF7, 0x83, 0xBD, 0x1E, 0xB7, 0x9F, 0xDB, 0xD0, 0x2D, 0x3C, 0xB7, 0xE0,
-    0xAB, 0xA0, 0x59, 0x51, 0x6A, 0x9E, 0xA2, 0x2F, 0x2F, 0x7A, 0x34, 0xF0, 0xE2, 0x14, 0x3E, 0xCC,
-    0x7D, 0xF0, 0x56, 0xFE, 0x5B, 0xA4, 0x75, 0xFA, 0x6E, 0x13, 0x7D, 0xDA, 0xF9, 0x2D, 0xCB, 0x82,
-    0x80, 0x50, 0x60, 0x24, 0x8A, 0x5C, 0xBD, 0x98, 0x7E, 0xEC, 0x05, 0x90, 0x6C, 0x9F, 0x17, 0x35,
-    0x97, 0xF4, 0x67, 0x4D, 0xF4, 0x19, 0xE6, 0xB9, 0x62, 0x9B, 0x4C, 0x4C, 0x28, 0x4F, 0x73, 0x9D,
-    0xE6, 0x1B, 0x35, 0x14, 0x0D, 0xD7, 0xCF, 0x35, 0x57, 0xB4, 0x4B, 0x92, 0x11, 0xDE, 0x02, 0x45,
-    0xE7, 0x80, 0x5D, 0xDF, 0x7A, 0x25, 0xCC, 0x50, 0x7C, 0x1E, 0xFB, 0x1C, 0xF0, 0x14, 0xBB, 0xF4,
-    0x0C, 0x4E, 0xED, 0xCA, 0xB3, 0xB7, 0xE5, 0xC3, 0xAF, 0xA0, 0x87, 0xF6, 0xE5, 0xE4, 0x2A, 0xCD,
-    0xED, 0xF5, 0xA8, 0x7C, 0x61, 0x6D, 0x79, 0x3A, 0x5B, 0x7A, 0xA9, 0x11, 0xEC, 0x9F, 0xB8, 0x0D,
-    0x7C, 0xCE, 0xB6, 0xFC, 0x69, 0x71, 0x6F, 0x2A, 0xB5, 0x1C, 0xBB, 0x7E, 0x16, 0xD6, 0x79, 0x65,
-    0xD9, 0x83, 0xDA, 0x63, 0x85, 0x5E, 0x62, 0xF2, 0x68, 0xB5, 0xFE, 0x8A, 0xEE, 0x5C, 0x83, 0xA5,
-    0x1E, 0xD9, 0x95, 0xF7, 0x0C, 0xD9, 0x79, 0x44, 0x8E, 0xCF, 0x3B, 0x09, 0x6F, 0xF5, 0xE2, 0x75,
-    0xBF, 0x71, 0x9A, 0x6C, 0x42, 0xC3, 0x49, 0xEC, 0x4B, 0x31, 0x45, 0x29, 0x2D, 0x50, 0x4A, 0xEB,
-    0x5E, 0x89, 0x11, 0x73, 0xE6, 0x99, 0xA2, 0x72, 0xA0, 0x99, 0x4F, 0x2D, 0x8C, 0xCF, 0x14, 0x81,
-    0xEA, 0x6B, 0xB3, 0x0E, 0x89, 0xA8, 0xCF, 0x6A, 0xED, 0xD0, 0x66, 0xE7, 0x6B, 0xCC, 0x1E, 0xDE,
-    0xE8, 0xED, 0xDC, 0xFE, 0xE6, 0xC5, 0xE0, 0xAB, 0x29, 0x78, 0x30, 0x05, 0xE6, 0x1F, 0x28, 0x2D,
-    0x69, 0x6D, 0xC3, 0xA3, 0x2F, 0xEA, 0xEB, 0xC3, 0x33, 0x23, 0x64, 0x8F, 0xE4, 0xB7, 0x83, 0x1C,
-    0x95, 0xE3, 0xEE, 0x35, 0x25, 0xBB, 0x10, 0x03, 0xB1, 0x00, 0xB3, 0x68, 0xAE, 0xDD, 0x0A, 0xAD,
-    0x7E, 0x80, 0xA6, 0xC5, 0xBE, 0x5B, 0xE7, 0x21, 0x10, 0x00, 0x18, 0x20, 0x1D, 0xDB, 0xA5, 0x98,
-    0x6C, 0xE4, 0x53, 0x14, 0x99, 0x35, 0x44, 0xA7, 0xB0, 0xEC, 0xC8, 0xE4, 0xA9, 0xA9, 0x2F, 0x9E,
-    0x6D, 0xDF, 0x96, 0x4E, 0xB1, 0x59, 0x9B, 0x41, 0xCF, 0xAA, 0xCD, 0xA6, 0x0D, 0x9C, 0x05, 0xCF,
-    0xE4, 0x31, 0xCE, 0x65, 0x23, 0x5A, 0x63, 0x23, 0xDA, 0xBF, 0x56, 0x11, 0x6D, 0xB7, 0x7B, 0xCE,
-    0x6C, 0x36, 0x25, 0x7F, 0x6A, 0x25, 0xFC, 0x33, 0xCF, 0xE6, 0xED, 0xE7, 0xEF, 0x9B, 0x7B, 0x8C,
-    0x4D, 0xBD, 0xFE, 0xC1, 0x48, 0xF0, 0xF5, 0x05, 0x09, 0xEA, 0x78, 0xF7, 0xE5, 0xE6, 0x1A, 0x55,
-    0xA7, 0x76, 0x1A, 0xDE, 0xB9, 0x28, 0x51, 0xFE, 0xDD, 0xDD, 0xE8, 0xF7, 0xFB, 0xE6, 0x76, 0x62,
-    0xA6, 0x8C, 0xF5, 0xD2, 0x2F, 0x2A, 0xCD, 0x6E, 0xFC, 0x5B, 0x95, 0x39, 0x5F, 0xAD, 0x32, 0xAE,
-    0xA2, 0x58, 0x0E, 0x6D, 0xD0, 0x31, 0xBD, 0x3F, 0x21, 0x8F, 0xC2, 0x04, 0x9C, 0xEB, 0xCC, 0xE0,
-    0xA8, 0x00, 0x1B, 0x22, 0x38, 0xA7, 0x4D, 0xB6, 0xDA, 0x33, 0x96, 0xB0, 0xA8, 0x4D, 0x4E, 0x23,
-    0xA3, 0x56, 0xEC, 0xF6, 0xE5, 0x11, 0x6C, 0x05, 0xDB, 0x12, 0xF6, 0x79, 0xD0, 0x4F, 0x97, 0x91,
-    0x2F, 0xDA, 0xC2, 0x56, 0xED, 0x6F, 0x02, 0x32, 0x23, 0x7A, 0xB1, 0xD9, 0xEC, 0x23, 0x07, 0x6B,
-    0xF1, 0x6B, 0xC7, 0xC1, 0xE2, 0xE6, 0x69, 0x05, 0xC5, 0xFF, 0xCD, 0xE0, 0x67, 0x5F, 0x6E, 0xCB,
-    0x39, 0x36, 0xE9, 0x19, 0x18, 0xBF, 0x27, 0x14, 0xCF, 0x67, 0x8A, 0x94, 0xE8, 0xFE, 0x26, 0x84,
-    0x2C, 0x4C, 0x07, 0xFB, 0x7D, 0xC4, 0x45, 0xD8, 0xD2, 0xE9, 0x9F, 0x11, 0x69, 0x51, 0x71, 0x50,
-    0xF8, 0xF6, 0xFD, 0x9A, 0xEA, 0xB8, 0xE9, 0xD0, 0x80, 0x42, 0x08, 0xF6, 0x4C, 0xDA, 0x38, 0xD7,
-    0x3F, 0xB4, 0x70, 0x03, 0x48, 0x76, 0x3F, 0xCB, 0x26, 0xCD, 0x81, 0xB5, 0x7C, 0xCC, 0x7B, 0x80,
-    0x1F, 0xEA, 0x70, 0x5A, 0xC0, 0x0E, 0xAE, 0xF1, 0x01, 0x85, 0x71, 0xBF, 0x22, 0xD2, 0xEB, 0x31,
-    0x10, 0xA9, 0x36, 0x98, 0x74, 0xC5, 0x6D, 0x60, 0x6A, 0xC6, 0x23, 0x70, 0x2C, 0x4F, 0xAF, 0x70,
-    0xF0, 0x2A, 0xC8, 0xD3, 0x06, 0x0F, 0x46, 0xEF, 0xE4, 0x7C, 0x95, 0x00, 0x02, 0x46, 0xC1, 0xFD,
-    0x54, 0x24, 0xAF, 0x6E, 0xCB, 0xAF, 0x5D, 0x42, 0xE8, 0x92, 0xD2, 0x9B, 0xF3, 0xFC, 0xC6, 0xE5,
-    0xDF, 0x0C, 0x3D, 0xD1, 0xFE, 0xF4, 0x30, 0xDD, 0x98, 0x9D, 0x7D, 0xA2, 0x5D, 0x3E, 0xD4, 0x79,
-    0x6C, 0x9E, 0xB2, 0xF3, 0x48, 0x80, 0x3F, 0x69, 0x2D, 0xA9, 0x3B, 0x73, 0xC3, 0xB0, 0x3B, 0xA2,
-    0x2D, 0x92, 0x82, 0x6D, 0xC5, 0xA7, 0x22, 0xFF, 0x01, 0x75, 0x54, 0xCF, 0x8F, 0x1B, 0x35, 0x14,
-    0xFE, 0x26, 0xB3, 0x49, 0xDA, 0x44, 0xD4, 0x11, 0x4A, 0xA0, 0x55, 0xD5, 0x9D, 0x1E, 0x51, 0x61,
-    0x77, 0x38, 0x2C, 0x52, 0x90, 0x92, 0x19, 0xDF, 0xB9, 0xCC, 0x61, 0x23, 0x0E, 0x1C, 0xD8, 0xF3,
-    0x4A, 0x68, 0x23, 0x94, 0x8A, 0xA5, 0x64, 0x33, 0xFE, 0x0B, 0x68, 0x0E, 0x88, 0x2B, 0x11, 0x2A,
-    0xA8, 0x84, 0x43, 0xE7, 0xB0, 0x48, 0xAB, 0xD2, 0x76, 0x7C, 0xE3, 0xC0, 0xC5, 0xE5, 0xC2, 0xD5,
-    0xFC, 0x16, 0x42, 0x42, 0x3E, 0xA4, 0x22, 0x45, 0xD9, 0x98, 0xE7, 0x99, 0x05, 0xB5, 0xAA, 0xB0,
-    0x9F, 0x3C, 0x63, 0x3F, 0xFB, 0xF9, 0x7D, 0xEF, 0x7D, 0xCF, 0x40, 0xAC, 0x9A, 0xA6, 0xB2, 0xC2,
-    0x04, 0x40, 0x65, 0x8D, 0xFA, 0x02, 0x81, 0x42, 0x04, 0xD7, 0x3C, 0xCB, 0xEB, 0x56, 0xB2, 0x6F,
-    0x4C, 0x84, 0x65, 0x53, 0x8D, 0xE2, 0xF5, 0x62, 0x62, 0xCD, 0xE8, 0xB2, 0xB8, 0x36, 0x17, 0xB1,
-    0x95, 0x24, 0xB4, 0x27, 0xB6, 0x2B, 0x92, 0x6B, 0xF3, 0xDB, 0x2D, 0x24, 0x63, 0xCF, 0xC4, 0x56,
-    0x07, 0x56, 0x56, 0x1E, 0x93, 0x26, 0x14, 0xB1, 0x8C, 0x65, 0x03, 0x5B, 0x75, 0x91, 0x32, 0x95,
-    0x32, 0xD9, 0xF6, 0xF8, 0x3E, 0x4F, 0xF5, 0x8B, 0xC6, 0x37, 0x81, 0x0A, 0x68, 0x47, 0x53, 0xC5,
-    0x8B, 0x6E, 0xAF, 0xDB, 0x8B, 0x17, 0x4D, 0x45, 0x53, 0xF6, 0xD3, 0x32, 0xBC, 0xA9, 0x27, 0x81,
-    0x38, 0xEE, 0xBB, 0xDB, 0x43, 0xBE, 0x62, 0xBF, 0x2D, 0x7C, 0xAB, 0x60, 0x45, 0xFB, 0x88, 0x1A,
-    0xDA, 0xED, 0x71, 0xBF, 0xEC, 0x85, 0x7B, 0xF1, 0x4D, 0x45, 0xBE, 0xF9, 0x3F, 0x2C, 0x61, 0xC6,
-    0xE0, 0xF0, 0x16, 0x78, 0x7E, 0xC1, 0x0F, 0x3F, 0x55, 0xD1, 0x5B, 0x32, 0xB0, 0xBC, 0xB6, 0x04,
-    0x5A, 0x68, 0x5A, 0xF2, 0x50, 0x4E, 0xDE, 0xD4, 0xC7, 0x9E, 0xAE, 0x2B, 0x26, 0x99, 0x24, 0xB7,
-    0x44, 0xCA, 0x3B, 0x60, 0x2A, 0x90, 0xA1, 0x8C, 0x79, 0x4C, 0x60, 0xDB, 0x48, 0x41, 0x7F, 0x22,
-    0x20, 0x7D, 0x53, 0x79, 0xFC, 0x69, 0x9D, 0xF3, 0x45, 0xBB, 0xC0, 0x78, 0x2B, 0xFA, 0xA3, 0x99,
-    0xBF, 0x62, 0x26, 0x14, 0x47, 0x00, 0xF7, 0xE4, 0xCB, 0x84, 0xD1, 0x93, 0xE0, 0x2D, 0xEC, 0x20,
-    0x22, 0xC4, 0x3B, 0x74, 0x69, 0xBE, 0xDC, 0x3F, 0x41, 0xB7, 0xEC, 0xFE, 0xB2, 0xBE, 0x60, 0x26,
-    0x56, 0x29, 0xED, 0x38, 0x1F, 0x1D, 0x1E, 0xF7, 0xAF, 0x34, 0xC0, 0x10, 0xF0, 0x5C, 0x03, 0xB9,
-    0x3E, 0x98, 0x32, 0x9A, 0xB9, 0xC6, 0x70, 0x30, 0xCD, 0x35, 0x43, 0x03, 0x9D, 0x42, 0xE7, 0x25,
-    0xBE, 0x29, 0xFB, 0x81, 0xC9, 0xE9, 0xF4, 0x2E, 0x56, 0x67, 0xDD, 0x4E, 0x53, 0x1D, 0xA8, 0x0D,
-    0xA4, 0x3C, 0x17, 0x31, 0xDF, 0x78, 0x2A, 0xBE, 0x4F, 0x46, 0xB4, 0xCA, 0x09, 0x04, 0x41, 0x78,
-    0x09, 0x9B, 0x94, 0x8B, 0xBA, 0xF6, 0x8D, 0x55, 0x39, 0xF7, 0xC0, 0x78, 0x1F, 0x63, 0x4C, 0x92,
-    0x58, 0x37, 0xA7, 0x65, 0x5C, 0x53, 0xAB, 0x26, 0x5F, 0xAA, 0x21, 0x9C, 0xB4, 0xC0, 0x93, 0x24,
-    0xC9, 0x8C, 0xA6, 0xB0, 0x55, 0xAB, 0xCE, 0xB3, 0xFB, 0x95, 0x45, 0xF8, 0x89, 0x62, 0x96, 0xFB,
-    0xEB, 0x33, 0x52, 0xF8, 0x44, 0x8A, 0xEF, 0xCD, 0x36, 0x96, 0xB4, 0xF9, 0xA4, 0xA2, 0xE9, 0x78,
-    0x68, 0x45, 0xED, 0xF1, 0x33, 0xF1, 0xD6, 0xBD, 0x60, 0xBD, 0x8A, 0xF3, 0x45, 0xAF, 0x39, 0xFD,
-    0x8F, 0x32, 0xB9, 0x5D, 0x5B, 0x6B, 0x07, 0x83, 0xC4, 0xDA, 0x65, 0x67, 0x90, 0x90, 0x41, 0xFA,
-    0x99, 0xCF, 0x6F, 0x35, 0x45, 0x16, 0xAF, 0xCD, 0x03, 0xAB, 0xB3, 0x80, 0x3F, 0x49, 0xAB, 0x32,
-    0xD3, 0x74, 0x64, 0x55, 0x0C, 0x9D, 0xC1, 0x60, 0xB0, 0xEB, 0x96, 0xEA, 0x02, 0xB1, 0xAC, 0x58,
-    0x1E, 0x2C, 0xE9, 0x8B, 0x2D, 0x94, 0x6D, 0x0C, 0x50, 0xDA, 0x0D, 0x2A, 0x06, 0xBE, 0x42, 0x5D,
-    0xA2, 0x29, 0x08, 0xAF, 0x4B, 0x5A, 0xBF, 0x50, 0x9E, 0x00, 0x94, 0x46, 0x52, 0xEA, 0x42, 0x29,
-    0x9D, 0x92, 0x98, 0x48, 0x74, 0xA7, 0x34, 0xEF, 0xDD, 0xDB, 0xBA, 0x32, 0x1E, 0x95, 0x61, 0x20,
-    0x21, 0x58, 0x9D, 0x01, 0x27, 0xC9, 0xAD, 0x9E, 0x61, 0x46, 0x72, 0x77, 0xAE, 0xE7, 0xF3, 0x19,
-    0x45, 0x85, 0x70, 0x50, 0x84, 0x28, 0x4E, 0xC0, 0x75, 0x15, 0x8A, 0x80, 0xDF, 0x50, 0x2D, 0x7E,
-    0xFE, 0x28, 0xEB, 0x6E, 0x5D, 0x18, 0x27, 0xCF, 0x62, 0x23, 0x00, 0x92, 0xB9, 0x1A, 0x23, 0xCA,
-    0xF8, 0xA7, 0xC4, 0x1D, 0x39, 0x41, 0x70, 0x86, 0x57, 0x99, 0x80, 0xC8, 0x98, 0xF2, 0x40, 0x30,
-    0x7E, 0xC1, 0x41, 0xA8, 0x26, 0xD8, 0x0C, 0x7E, 0x14, 0x71, 0xF0, 0xAD, 0x8E, 0xC3, 0x37, 0xF4,
-    0x46, 0xE4, 0xF1, 0xDB, 0x94, 0xF5, 0x53, 0x58, 0x9E, 0xBA, 0xC8, 0xA4, 0xF6, 0xF4, 0xFD, 0xC1,
-    0x3B, 0x43, 0x3C, 0x47, 0x42, 0xD3, 0x67, 0x6F, 0x7B, 0xB2, 0x4A, 0xAE, 0x89, 0x54, 0x79, 0x45,
-    0x77, 0x99, 0xEB, 0xF2, 0xF0, 0x91, 0xBA, 0x61, 0xE5, 0xBB, 0x7F, 0xC2, 0x23, 0x53, 0x33, 0x57,
-    0x32, 0x24, 0xD5, 0x64, 0x1A, 0xFF, 0x4A, 0x70, 0x65, 0x16, 0x72, 0x17, 0xBB, 0xA5, 0x5B, 0x74,
-    0x9E, 0x70, 0x11, 0xFE, 0x25, 0x5F, 0xCF, 0x45, 0x6B, 0x03, 0xC1, 0x43, 0x45, 0xA0, 0x77, 0xB6,
-    0xDD, 0x7A, 0xE5, 0x1C, 0x82, 0x3B, 0x9C, 0xA6, 0x8D, 0x06, 0xCE, 0xB8, 0x4B, 0xF8, 0xE0, 0xBA,
-    0x75, 0xA5, 0xF1, 0xBB, 0x77, 0xAB, 0x96, 0xB9, 0x0B, 0x87, 0xAA, 0xFA, 0x19, 0x86, 0xE8, 0x54,
-    0xE9, 0xB2, 0x3D, 0x4C, 0xDD, 0xA5, 0x6D, 0x3C, 0xA4, 0x61, 0xF8, 0x1D, 0x70, 0xAE, 0x1C, 0x68,
-    0xDF, 0xC6, 0xB0, 0x22, 0x70, 0x11, 0x48, 0xA8, 0x63, 0xD7, 0x4B, 0xA0, 0xCE, 0x7F, 0x8E, 0x61,
-    0x61, 0xE0, 0x17, 0x6F, 0xB7, 0x9A, 0x15, 0x46, 0xAF, 0x52, 0x92, 0xEA, 0x32, 0x90, 0x5D, 0x77,
-    0xE1, 0x66, 0x74, 0xD8, 0xDB, 0xAE, 0xD2, 0xF6, 0xE6, 0x1A, 0x44, 0xBD, 0x9E, 0x2F, 0xAF, 0x3F,
-    0x52, 0xE4, 0x37, 0x32, 0x52, 0xBE, 0x46, 0xA5, 0x1B, 0xF0, 0x48, 0xBA, 0xEA, 0x0C, 0x45, 0x9F,
-    0xB8, 0xEF, 0x51, 0x55, 0x86, 0xBC, 0x4E, 0xB3, 0x1D, 0xCC, 0x6A, 0x98, 0x30, 0xC1, 0x3E, 0x94,
-    0x93, 0x57, 0xD4, 0x6C, 0x67, 0x86, 0xC3, 0x88, 0x6D, 0x8F, 0xAF, 0x52, 0x86, 0x90, 0xF3, 0x9C,
-    0x5F, 0x2A, 0xD0, 0xA4, 0xEA, 0x60, 0x1A, 0x8A, 0x4E, 0xC9, 0x43, 0x97, 0x69, 0x3D, 0xCB, 0xBE,
-    0x7A, 0xA4, 0xC3, 0xB7, 0x45, 0x9B, 0xAA, 0x3C, 0x96, 0x2F, 0x48, 0x72, 0x18, 0xF7, 0x48, 0x1D,
-    0xC5, 0x02, 0x95, 0x15, 0x5B, 0x7F, 0x9C, 0x9B, 0x0A, 0xD1, 0x53, 0xE0, 0xB2, 0xFD, 0xF9, 0xFF,
-    0x15, 0xA9, 0xB5, 0xA7, 0xFB, 0xF3, 0xF9, 0x17, 0xFF, 0x7E, 0x9B, 0xF6, 0x23, 0x04, 0x44, 0xEB,
-    0xBF, 0xD7, 0x0F, 0xF6, 0x89, 0xDB, 0x19, 0xAA, 0x77, 0xA6, 0xA8, 0xD9, 0x5B, 0x54, 0x63, 0xD6,
-    0x72, 0x66, 0xE7, 0xD6, 0xC4, 0x53, 0xD4, 0x57, 0xF7, 0xC9, 0xE0, 0x04, 0x4F, 0xB7, 0x57, 0x41,
-    0x16, 0xE6, 0xA7, 0xCE, 0xA6, 0xB5, 0xC5, 0xCA, 0x61, 0x31, 0xB6, 0xDC, 0x6B, 0xA5, 0x60, 0x42,
-    0x73, 0x6C, 0xEE, 0x9A, 0x4B, 0x2D, 0x37, 0x1B, 0x65, 0xB9, 0x19, 0x21, 0x9A, 0xD5, 0xA6, 0xC8,
-    0x5A, 0x99, 0x6B, 0x7B, 0xB4, 0x2C, 0x47, 0xC6, 0xFD, 0x46, 0xBA, 0xC1, 0xB3, 0xB2, 0x99, 0x89,
-    0xB9, 0x44, 0xA1, 0x60, 0xBA, 0x5F, 0xBC, 0x5D, 0xDB, 0xB3, 0x1A, 0xC1, 0xA4, 0x98, 0x66, 0x31,
-    0x19, 0x73, 0x9B, 0x4B, 0x3D, 0x2D, 0xE0, 0x6B, 0x7D, 0x62, 0xCA, 0x43, 0x7B, 0x64, 0x0B, 0x1F,
-    0xFC, 0xA1, 0x0E, 0x97, 0x66, 0x94, 0x9D, 0xC9, 0xD5, 0x3D, 0xCA, 0xE4, 0x7B, 0xF4, 0x42, 0x8E,
-    0x8A, 0x4E, 0x67, 0xE8, 0x15, 0xCA, 0x79, 0xF9, 0x24, 0x46, 0xBC, 0x81, 0x6C, 0x34, 0x32, 0x5D,
-    0xB5, 0x29, 0x99, 0xA8, 0x61, 0xAB, 0xC7, 0x32, 0x5F, 0x37, 0xCD, 0x66, 0xB7, 0x7D, 0xF1, 0x1F,
-    0xCD, 0x5C, 0x3D, 0x90, 0x1D, 0xD5, 0x95, 0xBE, 0xDD, 0x4F, 0x33, 0x6D, 0xAB, 0xCB, 0xDB, 0x0A,
-    0x50, 0xAD, 0x57, 0xAA, 0x72, 0x13, 0x38, 0xD8, 0x52, 0xD9, 0x74, 0xB2, 0x81, 0x5D, 0x85, 0xE9,
-    0x16, 0x04, 0x04, 0x04, 0x4C, 0xA0, 0x27, 0x02, 0x02, 0x1C, 0x38, 0x58, 0x48, 0x86, 0x60, 0xB7,
-    0x8A, 0x72, 0x01, 0xDD, 0x82, 0x80, 0xDA, 0xA2, 0xD6, 0x4C, 0xB0, 0xEC, 0x86, 0x28, 0xA0, 0xB6,
-    0xA4, 0xA7, 0xDA, 0x12, 0x01, 0x81, 0x03, 0x6B, 0x6E, 0x03, 0x01, 0x01, 0x81, 0x1A, 0xB3, 0x98,
-    0xC0, 0x01, 0x0D, 0xC8, 0xCB, 0x96, 0x08, 0xD4, 0xD8, 0x4F, 0xB8, 0x25, 0x75, 0xF7, 0xDD, 0xEF,
-    0x3B, 0xB7, 0xBB, 0xDF, 0x9B, 0xD1, 0x68, 0x24, 0x46, 0x23, 0x7B, 0x67, 0xDE, 0x39, 0x3D, 0xD3,
-    0x3F, 0xB7, 0xEF, 0xCF, 0xF9, 0x3F, 0xE7, 0x3E, 0xA5, 0x54, 0x58, 0x2A, 0x6F, 0xAE, 0x9C, 0x46,
-    0xA9, 0x87, 0x14, 0x7E, 0xB4, 0xA9, 0x8D, 0xFD, 0x4C, 0xD7, 0x8C, 0x52, 0xFD, 0xC7, 0x54, 0xFD,
-    0x67, 0xF9, 0x24, 0xCF, 0xF7, 0x37, 0x1F, 0x71, 0xB3, 0xF8, 0xD5, 0x0A, 0x1F, 0xFC, 0xB1, 0xE7,
-    0x46, 0x52, 0x63, 0x4A, 0x3C, 0x6A, 0x2A, 0x8B, 0x0E, 0xEB, 0xD7, 0xD7, 0x94, 0x4A, 0x13, 0xB5,
-    0x05, 0x99, 0x9A, 0xC8, 0x24, 0x44, 0xB9, 0x4A, 0xB3, 0xB8, 0xC4, 0x85, 0xA0, 0xDA, 0x82, 0x42,
-    0xA0, 0x47, 0x4D, 0xA1, 0xD2, 0xC7, 0x78, 0xCB, 0x63, 0x1D, 0xC7, 0xB5, 0x46, 0xA4, 0xFC, 0xB9,
-    0x0A, 0x0B, 0x15, 0x27, 0xEA, 0x37, 0x76, 0xAC, 0x8D, 0x31, 0x2D, 0x3F, 0xD3, 0x13, 0x5B, 0x7A,
-    0xB4, 0xEB, 0x47, 0x7E, 0x22, 0xB3, 0xE1, 0xA0, 0x93, 0x1E, 0x20, 0x68, 0x9D, 0x02, 0xBD, 0x50,
-    0x71, 0x8E, 0x9E, 0x61, 0xF4, 0xFA, 0xF2, 0x8C, 0x03, 0xB0, 0xF0, 0xFA, 0x54, 0x69, 0xF4, 0x3B,
-    0xC5, 0xB5, 0xB8, 0xC0, 0x64, 0xD7, 0xEA, 0xE7, 0x01, 0x9E, 0x71, 0x39, 0xC0, 0xD4, 0x6C, 0xF4,
-    0xAD, 0xB9, 0xE6, 0x52, 0x68, 0xDA, 0xD8, 0x34, 0x3A, 0x7B, 0x4E, 0xA3, 0x05, 0x7C, 0x72, 0x15,
-    0xD7, 0x2A, 0x34, 0xD9, 0x84, 0x37, 0x36, 0xCA, 0x6B, 0x95, 0xC2, 0x38, 0xBA, 0x4B, 0x2E, 0xFA,
-    0x8B, 0x5E, 0xCF, 0xD7, 0x8D, 0x9D, 0xE8, 0xED, 0x3F, 0xEA, 0xC0, 0x0B, 0x0F, 0x6D, 0xA6, 0x2F,
-    0x3C, 0xA4, 0x0E, 0x60, 0xB4, 0x55, 0x70, 0xDB, 0x5F, 0xBE, 0xCC, 0xEC, 0xE5, 0xE3, 0x76, 0xCA,
-    0xB4, 0x0A, 0xCB, 0x81, 0x89, 0xB6, 0x93, 0x29, 0xF3, 0xCC, 0x2E, 0x2C, 0x0E, 0xDD, 0x54, 0x0E,
-    0xAD, 0xDA, 0x76, 0x98, 0x25, 0x72, 0xE0, 0x62, 0x36, 0x38, 0x74, 0xA4, 0x3F, 0xF3, 0xA4, 0x91,
-    0x83, 0xD2, 0x99, 0x1C, 0xE2, 0xCC, 0xB5, 0x87, 0x09, 0x0F, 0x69, 0xE6, 0xE1, 0x55, 0xAE, 0x49,
-    0xCC, 0x5C, 0x1A, 0xC7, 0xB4, 0x60, 0x22, 0x14, 0x16, 0xD8, 0x60, 0x1A, 0x0F, 0xD8, 0x79, 0xD4,
-    0x6A, 0x32, 0x67, 0xDF, 0x70, 0xEB, 0xED, 0x30, 0x7F, 0x12, 0xC1, 0x95, 0xE0, 0x9A, 0xE7, 0xBD,
-    0x86, 0x18, 0x53, 0x0C, 0xEC, 0xB4, 0x8B, 0xBF, 0x8F, 0xF2, 0xBC, 0xBD, 0x07, 0x34, 0x4A, 0xDC,
-    0x25, 0x37, 0x53, 0x6B, 0x72, 0x33, 0xB5, 0x9E, 0xDF, 0x4A, 0xAD, 0x45, 0xBA, 0x03, 0xB5, 0xDE,
-    0x8C, 0xF8, 0x83, 0x41, 0x2B, 0xFE, 0x19, 0xE6, 0x3D, 0x63, 0x72, 0x74, 0x7E, 0x65, 0xC0, 0xAF,
-    0x98, 0x93, 0x1C, 0xB3, 0x94, 0x18, 0x07, 0x4B, 0xC0, 0xC9, 0xF1, 0x39, 0x25, 0xA5, 0x32, 0x32,
-    0x19, 0x38, 0x3E, 0x85, 0xB9, 0xF1, 0x70, 0x7E, 0x82, 0xEB, 0xF2, 0x9B, 0xE2, 0xFE, 0x18, 0xCF,
-    0x05, 0x78, 0xDE, 0x6F, 0x6C, 0x63, 0x20, 0x9F, 0x08, 0x2B, 0xE7, 0xE1, 0x1D, 0xCE, 0xBC, 0x6F,
-    0xDF, 0xC3, 0x68, 0x03, 0x40, 0x08, 0x88, 0x01, 0x29, 0xA0, 0x6B, 0x8D, 0xDB, 0xB6, 0x66, 0x72,
-    0xB5, 0x35, 0xFE, 0xD7, 0xAD, 0x09, 0x3E, 0x6C, 0x4D, 0xF4, 0x4E, 0x6B, 0xE2, 0xE3, 0xAD, 0xD1,
-    0x98, 0xA3, 0x06, 0xC0, 0xB9, 0xAA, 0x00, 0x25, 0x20, 0x77, 0x5A, 0x75, 0x62, 0x25, 0xC1, 0x4A,
-    0x06, 0x68, 0xDD, 0x68, 0x32, 0x05, 0x57, 0x7D, 0xF5, 0xCD, 0x9E, 0xD6, 0xC1, 0x0E, 0x9A, 0xBC,
-    0xD2, 0xA9, 0x28, 0xC7, 0x02, 0x07, 0xE5, 0xA4, 0x46, 0xBF, 0x20, 0x82, 0xBC, 0xB9, 0x5F, 0x61,
-    0xD8, 0x78, 0xCC, 0x69, 0x23, 0x3C, 0xD6, 0xC5, 0xE8, 0x62, 0x9A, 0xE2, 0x91, 0x98, 0x94, 0x15,
-    0x82, 0x03, 0x54, 0xC0, 0xCE, 0x07, 0xEC, 0x6E, 0xC4, 0xB9, 0x21, 0xE9, 0x85, 0x98, 0x5D, 0x7B,
-    0xB1, 0x1F, 0x84, 0x8B, 0xC5, 0x9A, 0xEC, 0x0D, 0x84, 0xB5, 0x2C, 0x50, 0x4E, 0x8C, 0x70, 0x70,
-    0x63, 0x78, 0x75, 0x2B, 0xBC, 0xCF, 0x3E, 0x69, 0xAE, 0x2F, 0xBB, 0xA8, 0xA5, 0xB3, 0x58, 0x27,
-    0xA7, 0x0D, 0x4A, 0xBC, 0x3D, 0xE0, 0x28, 0x38, 0x9E, 0x6B, 0x4F, 0xD6, 0xCA, 0x67, 0x53, 0xE0,
-    0xF8, 0x16, 0xFD, 0x04, 0x99, 0x43, 0x06, 0x70, 0xF5, 0x30, 0x09, 0x90, 0x14, 0x58, 0x95, 0x04,
-    0xFF, 0x90, 0x71, 0x84, 0xA2, 0x09, 0xD3, 0x13, 0xC2, 0x23, 0x23, 0xC8, 0xB2, 0x92, 0x53, 0x40,
-    0xAC, 0x8E, 0xC9, 0xED, 0xD2, 0xF7, 0xE0, 0x98, 0xCC, 0x3E, 0xD7, 0x2A, 0x4B, 0x8B, 0x1B, 0xC2,
-    0x4A, 0x37, 0xDF, 0x9B, 0x66, 0xE6, 0x9C, 0x11, 0x6E, 0x93, 0xFB, 0x1D, 0xCD, 0xF3, 0x85, 0xC1,
-    0xFA, 0x5B, 0xC0, 0xFF, 0x86, 0x6D, 0xF1, 0xD9, 0x4B, 0x7B, 0x95, 0x8A, 0xA0, 0xF0, 0xAC, 0x27,
-    0x73, 0x41, 0x53, 0xC8, 0xBC, 0x54, 0xC6, 0xBA, 0x03, 0xEA, 0x46, 0xD4, 0x02, 0x81, 0xDD, 0xE3,
-    0x7C, 0x42, 0x04, 0x4A, 0x8E, 0xD9, 0x19, 0x59, 0x83, 0x01, 0x29, 0x59, 0xD2, 0x01, 0xCD, 0x40,
-    0xAF, 0x67, 0xF6, 0xA6, 0x60, 0xE2, 0x1C, 0xCB, 0xD2, 0x81, 0x83, 0xBC, 0xB9, 0xDB, 0x82, 0x99,
-    0xBC, 0x39, 0x44, 0x01, 0xD7, 0x0A, 0x4B, 0xE6, 0x74, 0xDE, 0x9C, 0xFC, 0xA0, 0xBD, 0x39, 0x85,
-    0x78, 0xFC, 0xFE, 0x9C, 0x83, 0x0A, 0x39, 0xB9, 0x8A, 0x0B, 0xD8, 0x2C, 0xFE, 0x8B, 0x7F, 0x7F,
-    0x8D, 0xD7, 0xF4, 0x2B, 0x73, 0x30, 0x91, 0x63, 0xBC, 0x39, 0x86, 0x31, 0x69, 0xBD, 0x39, 0xD4,
-    0x8E, 0x5F, 0xA3, 0xB1, 0xB9, 0xD0, 0x33, 0xC7, 0x53, 0xE0, 0x45, 0xE4, 0x3E, 0xBC, 0x96, 0x54,
-    0xAA, 0xD4, 0x51, 0x50, 0x2C, 0xDB, 0x4A, 0x31, 0xD7, 0x3F, 0x75, 0x97, 0x56, 0x1A, 0xAC, 0xBC,
-    0xAA, 0x49, 0x2E, 0x05, 0xA0, 0x56, 0xCE, 0x13, 0xC6, 0xB2, 0x8A, 0xC8, 0x11, 0x9D, 0x40, 0xD9,
-    0xF4, 0x34, 0xC2, 0x67, 0x8B, 0x7D, 0x65, 0x57, 0x67, 0x6D, 0x25, 0x99, 0xCC, 0xA3, 0xCC, 0xED,
-    0xC8, 0x9A, 0x60, 0xB5, 0x23, 0x1B, 0xFB, 0xDA, 0xFE, 0xBE, 0x89, 0x2D, 0xD1, 0x29, 0x0B, 0x24,
-    0xBA, 0xA5, 0xA5, 0xFE, 0x1A, 0x11, 0x08, 0xE9, 0x26, 0xE4, 0x8E, 0x68, 0x42, 0xE4, 0xD7, 0x40,
-    0xD0, 0x21, 0x9A, 0x1A, 0x04, 0x28, 0x03, 0x12, 0xED, 0xA1, 0x0B, 0x8E, 0xB5, 0xE2, 0x60, 0x2B,
-    0x15, 0xB5, 0xB8, 0x05, 0x43, 0xAE, 0x31, 0xE6, 0xAE, 0x51, 0x17, 0xDA, 0xEE, 0x82, 0x6A, 0xDA,
-    0xEE, 0x45, 0x55, 0xB7, 0x5D, 0xEC, 0xCE, 0x81, 0x1E, 0xA9, 0xDA, 0x2E, 0x7A, 0xB9, 0x6C, 0xBB,
-    0xE0, 0x83, 0x02, 0xE8, 0x62, 0xDE, 0x76, 0xFE, 0x15, 0x20, 0xCF, 0x24, 0x6D, 0x37, 0x31, 0xAA,
-    0xED, 0x5C, 0x22, 0x48, 0xC3, 0x76, 0x57, 0x91, 0xB4, 0x24, 0x72, 0xCC, 0xF4, 0x89, 0x5D, 0xC5,
-    0xD3, 0x60, 0x79, 0x24, 0x4A, 0xCC, 0x07, 0x11, 0x2D, 0x61, 0xED, 0x71, 0x8E, 0x40, 0x5E, 0x31,
-    0xAD, 0x21, 0x90, 0x2E, 0x04, 0x4A, 0x72, 0x33, 0x92, 0x0B, 0xA9, 0x18, 0x4C, 0xA0, 0xC0, 0x44,
-    0x1E, 0x13, 0xAA, 0x46, 0x53, 0x73, 0x32, 0x6F, 0xD6, 0x8B, 0x4F, 0xE1, 0x94, 0x3B, 0xEB, 0xCF,
-    0x6E, 0xA0, 0xBB, 0xAC, 0x17, 0x38, 0x58, 0xCC, 0x93, 0x5C, 0x4C, 0x2C, 0x3C, 0x88, 0xD9, 0x02,
-    0x04, 0xD4, 0x13, 0x83, 0xE0, 0x02, 0x11, 0x5C, 0x4F, 0xB6, 0x0A, 0xBD, 0x25, 0x58, 0x36, 0xB6,
-    0x30, 0xE0, 0x32, 0x6C, 0x9D, 0x7C, 0x8B, 0xB1, 0x95, 0x6C, 0x05, 0x9E, 0x13, 0x63, 0xAB, 0x14,
-    0x63, 0x6B, 0x03, 0x63, 0x2C, 0x5D, 0x52, 0x57, 0x6F, 0x6C, 0x41, 0x36, 0x55, 0xBA, 0x87, 0xC3,
-    0xE9, 0xC7, 0x6B, 0x8A, 0xC2, 0x7B, 0x0F, 0x70, 0x8F, 0xB5, 0xD8, 0x42, 0x9B, 0x8D, 0x78, 0xDD,
-    0x5C, 0x83, 0x55, 0x80, 0x75, 0x29, 0xB8, 0x70, 0x98, 0xDA, 0x78, 0xAE, 0x3D, 0x4A, 0x4F, 0xED,
-    0x70, 0x52, 0x35, 0xA7, 0x78, 0xE9, 0xD7, 0x9E, 0xB1, 0x57, 0x71, 0xA7, 0xDF, 0xF6, 0x4F, 0xB9,
-    0xD2, 0x02, 0xA6, 0xF4, 0xDA, 0xB6, 0xF6, 0xD5, 0x61, 0x25, 0xD3, 0x47, 0xD5, 0x00, 0xE9, 0x18,
-    0x54, 0x20, 0x38, 0xAF, 0x16, 0x65, 0x06, 0x17, 0x41, 0x19, 0xCE, 0xB8, 0x36, 0xE3, 0x38, 0x38,
-    0x84, 0xA8, 0x19, 0xFE, 0x35, 0x98, 0x0F, 0xA7, 0xA5, 0x1C, 0xE4, 0xCD, 0xB0, 0x3B, 0x61, 0x67,
-    0x97, 0x22, 0xD1, 0x61, 0x26, 0xE2, 0x9A, 0x41, 0x6F, 0x30, 0x43, 0x42, 0xC5, 0x77, 0x8F, 0xF0,
-    0x93, 0x2F, 0x90, 0xB2, 0x8B, 0xB2, 0x84, 0x8E, 0x64, 0x71, 0x32, 0xA9, 0xD3, 0xEC, 0x66, 0x88,
-    0x09, 0x39, 0xE0, 0xEA, 0x7A, 0x0D, 0x69, 0x5E, 0xFB, 0x9C, 0x92, 0xF3, 0xFF, 0x01, 0x2B, 0x6D,
-    0xB2, 0x23, 0x68, 0xD8, 0x5F, 0x13, 0x68, 0x82, 0x28, 0xF7, 0xEA, 0x7D, 0xC4, 0x85, 0x57, 0xF7,
-    0x46, 0xE7, 0x12, 0xD6, 0xBC, 0x0A, 0x6E, 0xC0, 0xC1, 0xBF, 0x67, 0x87, 0x42, 0x84, 0xAE, 0xB1,
-    0xFA, 0x7E, 0xF9, 0x20, 0x24, 0x10, 0xEF, 0x7C, 0x10, 0xE9, 0xA0, 0x4D, 0xDE, 0xA3, 0xC3, 0x64,
-    0x30, 0xE1, 0xC0, 0x1E, 0x5D, 0x86, 0x73, 0x15, 0x53, 0x35, 0xC6, 0x6C, 0x28, 0xBE, 0x8C, 0x9B,
-    0xE2, 0x3C, 0x2A, 0x81, 0x82, 0x11, 0x85, 0x44, 0x90, 0xB1, 0x31, 0x57, 0x2C, 0xA6, 0xFC, 0x8E,
-    0x69, 0x6B, 0x70, 0x92, 0x8D, 0x12, 0xA1, 0xB1, 0x03, 0x9A, 0x25, 0x94, 0x90, 0xB5, 0x88, 0x49,
-    0xA0, 0x93, 0xE6, 0x11, 0x5C, 0x48, 0x5F, 0x06, 0x8A, 0xDF, 0x1B, 0x50, 0x0A, 0xE4, 0xF0, 0x82,
-    0xDC, 0x62, 0x1A, 0xA2, 0x0D, 0x08, 0xA0, 0x5B, 0x08, 0x14, 0xBA, 0x1E, 0xA3, 0x25, 0x74, 0xCE,
-    0x24, 0xBD, 0x96, 0xB9, 0x85, 0x55, 0x65, 0x35, 0xED, 0x51, 0xB1, 0xAC, 0xA8, 0x79, 0x8D, 0xFA,
-    0xA9, 0xC3, 0xC9, 0xE0, 0xB8, 0xC9, 0x15, 0x41, 0xB5, 0x3A, 0x3B, 0x4F, 0xC1, 0x24, 0xB0, 0x32,
-    0x85, 0x0A, 0xB3, 0x56, 0xBB, 0x88, 0xA8, 0x35, 0x58, 0x61, 0xD6, 0x13, 0x6C, 0xC0, 0xBE, 0xC5,
-    0x16, 0xBE, 0x5E, 0xA5, 0xC6, 0x03, 0x1B, 0xD2, 0x27, 0xD2, 0x62, 0x95, 0x99, 0xE3, 0x20, 0x68,
-    0xB1, 0x1A, 0x0C, 0x88, 0x0F, 0xFA, 0xD2, 0xA3, 0x21, 0x41, 0x49, 0xBF, 0x0D, 0x3F, 0x29, 0xD8,
-    0x5E, 0xB5, 0x77, 0xDA, 0xA7, 0x1C, 0x70, 0x59, 0x6E, 0xAC, 0xFD, 0x27, 0xEB, 0x41, 0x47, 0xA5,
-    0x1C, 0x5E, 0x79, 0x14, 0x7A, 0x99, 0xD3, 0x03, 0xF0, 0xDB, 0x27, 0x1A, 0xF2, 0xF7, 0x00, 0x3E,
-    0x66, 0x78, 0x62, 0xCE, 0x35, 0xBC, 0x8E, 0x07, 0x31, 0xD0, 0x4F, 0xC0, 0x65, 0x8F, 0x34, 0x6E,
-    0x87, 0xF3, 0xF8, 0x0D, 0x60, 0xCC, 0x44, 0x60, 0x67, 0x1A, 0x69, 0x8E, 0xBE, 0x44, 0x49, 0x42,
-    0xED, 0x93, 0xB9, 0x49, 0x6A, 0xA5, 0xE1, 0x61, 0x9D, 0xA3, 0xDD, 0x3C, 0x80, 0xB9, 0x1F, 0x17,
-    0x51, 0x8E, 0xC5, 0x07, 0xE0, 0xF7, 0xBA, 0xC9, 0x43, 0xF3, 0x69, 0xEE, 0x99, 0xC7, 0xF2, 0x71,
-    0xE8, 0xAB, 0xA2, 0xBF, 0xE9, 0x48, 0x25, 0x41, 0xB7, 0x26, 0x3E, 0x88, 0x88, 0x48, 0x48, 0x6B,
-    0xAD, 0x65, 0x2E, 0x32, 0x53, 0xD0, 0x34, 0xA6, 0x65, 0x1A, 0x16, 0xE0, 0xC0, 0x12, 0x50, 0xA4,
-    0xF8, 0x9F, 0x6D, 0x46, 0x37, 0x4C, 0xE2, 0xD3, 0x61, 0x34, 0xD6, 0x69, 0x39, 0x36, 0xDB, 0x90,
-    0xB1, 0x82, 0xA4, 0x92, 0x38, 0xD3, 0x19, 0xA8, 0x35, 0x89, 0x5F, 0xE7, 0xF8, 0x21, 0x21, 0x69,
-    0x71, 0x9F, 0xE2, 0x39, 0x3C, 0x49, 0xB8, 0x6C, 0x32, 0x92, 0x5E, 0x8C, 0x67, 0x67, 0xB3, 0x0D,
-    0x2C, 0x2F, 0x3F, 0xD3, 0xA4, 0xB3, 0xBE, 0xF5, 0x2D, 0x3E, 0x0E, 0x6E, 0x75, 0x7B, 0x9F, 0x7D,
-    0x02, 0x81, 0x28, 0x30, 0x5F, 0x02, 0x78, 0xD1, 0x1E, 0x7D, 0xE9, 0x32, 0xA0, 0x5A, 0xE9, 0x4C,
-    0x0F, 0x7C, 0x7A, 0x80, 0xA7, 0x95, 0x7A, 0x5A, 0xE9, 0x0D, 0xB1, 0xED, 0x22, 0xF6, 0x2A, 0xA7,
-    0x8C, 0x8E, 0x13, 0x33, 0x4D, 0xB3, 0x9E, 0x09, 0x33, 0xD3, 0x4B, 0xE2, 0x34, 0x77, 0x54, 0x7C,
-    0x5D, 0xCB, 0x2C, 0xBB, 0xE4, 0xAA, 0x15, 0x8C, 0x32, 0xC1, 0x6F, 0x86, 0x59, 0xCD, 0x34, 0x1C,
-    0xC4, 0x38, 0xEB, 0xC0, 0x36, 0xF1, 0xCB, 0xD0, 0xDE, 0x4D, 0xFC, 0x2A, 0xC8, 0xCD, 0xA4, 0x6F,
-    0x94, 0xCA, 0xB2, 0x96, 0xB5, 0xBE, 0x71, 0xE6, 0x0A, 0x24, 0x77, 0x1B, 0xBF, 0x0A, 0x8D, 0x24,
-    0x77, 0xE2, 0xA9, 0x53, 0x14, 0xED, 0x9C, 0x23, 0x3B, 0x23, 0xAB, 0x66, 0x03, 0x93, 0x04, 0x0A,
-    0x3C, 0x00, 0x83, 0x4C, 0xB5, 0xCE, 0x13, 0xA0, 0x81, 0x72, 0x82, 0x0E, 0xAE, 0xE2, 0x9D, 0xE6,
-    0x10, 0x24, 0xFE, 0xB9, 0x0E, 0xC4, 0x10, 0x09, 0x09, 0x9D, 0x55, 0xCF, 0xE0, 0xA5, 0x26, 0x87,
-    0x55, 0x93, 0xC3, 0xBC, 0xC9, 0x3B, 0x1F, 0x10, 0x5C, 0xC9, 0xBB, 0x68, 0x3D, 0xEF, 0x5E, 0x8C,
-    0xF2, 0x0E, 0xC4, 0xD1, 0x41, 0xB4, 0x9A, 0x0A, 0x50, 0x02, 0xB0, 0x54, 0x98, 0xEC, 0x7C, 0x25,
-    0x39, 0x01, 0x11, 0x8A, 0xD7, 0x7F, 0x09, 0x6D, 0x02, 0xF2, 0x15, 0xBF, 0xF3, 0x2E, 0xDA, 0x3B,
-    0x8B, 0xA9, 0xA0, 0x79, 0xD8, 0x41, 0x45, 0x75, 0xB0, 0xDE, 0x3B, 0x70, 0x9B, 0x59, 0xA7, 0x01,
-    0x49, 0xB6, 0x86, 0xF6, 0x4A, 0x0B, 0x39, 0xD7, 0xC1, 0x90, 0xEC, 0xA0, 0x7B, 0xE4, 0x5E, 0x4C,
-    0xA9, 0x8B, 0x45, 0x9C, 0x70, 0x01, 0x09, 0xD7, 0x9E, 0x1A, 0x17, 0x6E, 0x58, 0xBC, 0x01, 0xF8,
-    0x6B, 0xB0, 0x90, 0x20, 0xE6, 0xCA, 0xF4, 0xBE, 0xF8, 0x2C, 0xC3, 0x87, 0x66, 0x44, 0xCE, 0xE7,
-    0x73, 0x33, 0xF7, 0xD0, 0xD7, 0x9A, 0xD6, 0x5E, 0x83, 0x1E, 0xB7, 0x17, 0xC2, 0xF3, 0x79, 0x1B,
-    0x47, 0x11, 0x50, 0x0C, 0x14, 0x42, 0xED, 0xB7, 0x41, 0x33, 0x20, 0x78, 0x15, 0x79, 0x3B, 0xA9,
-    0xA2, 0xBE, 0xE7, 0xE9, 0x16, 0x30, 0x53, 0x9D, 0xF4, 0x71, 0x88, 0xC4, 0xCC, 0xF4, 0x4D, 0xD7,
-    0x09, 0x96, 0x6C, 0x1A, 0x90, 0x8D, 0xA8, 0x73, 0x10, 0x00, 0x05, 0x55, 0x58, 0x2C, 0x03, 0x55,
-    0x47, 0x9A, 0x09, 0xC3, 0x25, 0x01, 0x48, 0xC6, 0xED, 0x99, 0x63, 0x36, 0x9B, 0xA9, 0xB1, 0x7D,
-    0xB5, 0x73, 0xFB, 0x3B, 0xC1, 0x19, 0xC8, 0xAF, 0x56, 0xDB, 0xC8, 0x8C, 0x79, 0x47, 0x4C, 0x71,
-    0x8A, 0x14, 0xAC, 0x98, 0x05, 0x23, 0x00, 0xD2, 0xCD, 0xA4, 0x6D, 0x11, 0x8E, 0x5D, 0x5A, 0x91,
-    0x5B, 0x76, 0x04, 0xA5, 0x2F, 0xF9, 0xA4, 0xA4, 0x3A, 0x2E, 0xEF, 0xD7, 0xD9, 0x16, 0xBF, 0x11,
-    0xC6, 0x41, 0x5A, 0x1C, 0x00, 0x9D, 0x05, 0xA6, 0xB1, 0xDD, 0x7E, 0x66, 0xA9, 0xD3, 0xD6, 0xAE,
-    0x53, 0x77, 0x04, 0xC7, 0x32, 0xE7, 0x4C, 0x54, 0x50, 0xA2, 0xD1, 0xA1, 0xA3, 0x77, 0x47, 0xAB,
-    0x2C, 0x2C, 0x5C, 0x2C, 0x83, 0x6A, 0x21, 0x63, 0xBA, 0x18, 0xDC, 0x81, 0x1B, 0xE3, 0xD6, 0x9A,
-    0x2E, 0x41, 0x6D, 0xAD, 0x30, 0x9F, 0x42, 0xBB, 0x14, 0xBB, 0x31, 0x00, 0x09, 0x05, 0x5D, 0x6F,
-    0x9C, 0xB9, 0xCD, 0x2D, 0xD0, 0x3A, 0xF4, 0x81, 0xC7, 0xB9, 0x09, 0xC9, 0xB7, 0xF1, 0x6F, 0x9B,
-    0xB4, 0xD0, 0x0F, 0xE3, 0xBD, 0xC6, 0xB5, 0xC8, 0x5F, 0x42, 0x72, 0x21, 0x7E, 0xB7, 0x89, 0x8A,
-    0xE8, 0x46, 0x67, 0x72, 0x5F, 0x5C, 0x17, 0xCD, 0x81, 0xDE, 0xB2, 0x79, 0xA2, 0x67, 0x92, 0x83,
-    0xA7, 0x21, 0xEC, 0x8A, 0xB0, 0x4A, 0x33, 0x1F, 0x06, 0xC8, 0xA4, 0x6B, 0x21, 0xF2, 0xD0, 0x61,
-    0x5D, 0x59, 0xC0, 0xDF, 0x3C, 0xC7, 0x6B, 0x41, 0xC5, 0xB5, 0x8F, 0x0A, 0x9D, 0x05, 0xD5, 0xB1,
-    0x04, 0xC6, 0x8F, 0x08, 0x8A, 0x3B, 0x00, 0x2C, 0xDB, 0x00, 0xF6, 0xAD, 0x03, 0x38, 0x67, 0x9E,
-    0xC1, 0x74, 0x6A, 0x11, 0x53, 0x0B, 0x80, 0x60, 0xCD, 0xD3, 0x3F, 0x68, 0x3E, 0x07, 0x51, 0x0F,
-    0xD7, 0xEE, 0x69, 0xAA, 0xC1, 0xAD, 0x70, 0x56, 0xCD, 0xD4, 0x4C, 0xFC, 0xB7, 0x6F, 0x85, 0xB6,
-    0xFD, 0x9C, 0x55, 0xFC, 0xED, 0xEE, 0xE2, 0x57, 0x9A, 0x29, 0x97, 0x31, 0xC9, 0x30, 0xB8, 0x09,
-    0xAF, 0x6E, 0x3C, 0x73, 0x56, 0xB1, 0x13, 0x02, 0x42, 0xAC, 0x66, 0x6D, 0x88, 0xBB, 0x80, 0x01,
-    0xCE, 0x41, 0xCC, 0x38, 0xBD, 0x18, 0xA1, 0xDF, 0x6A, 0xDA, 0xDE, 0x7A, 0xD8, 0xC0, 0x63, 0x07,
-    0xC1, 0x0C, 0xE0, 0xBE, 0x05, 0x32, 0x27, 0x88, 0xE0, 0xA5, 0x00, 0x35, 0x40, 0x4F, 0xB6, 0xB8,
-    0xE0, 0x74, 0xBC, 0x4A, 0xE4, 0xB6, 0xC3, 0x05, 0x33, 0x27, 0xCA, 0xC2, 0xE2, 0xEC, 0x92, 0xA2,
-    0xC1, 0x8B, 0xA5, 0xB7, 0x0D, 0xDE, 0x8A, 0xA7, 0xF0, 0x36, 0x60, 0x09, 0xC5, 0xC0, 0x42, 0xDC,
-    0xF0, 0x3B, 0xF8, 0x71, 0xE8, 0x56, 0x84, 0x6E, 0x1D, 0x60, 0x38, 0xD8, 0x76, 0x96, 0x2E, 0x81,
-    0x80, 0x33, 0xB5, 0x26, 0xCE, 0xA1, 0x09, 0x94, 0xA1, 0xA6, 0x1E, 0x87, 0x1B, 0x6B, 0x06, 0x69,
-    0x1B, 0x5E, 0x42, 0xFF, 0x71, 0x57, 0x47, 0x3D, 0xDD, 0xF9, 0x75, 0x54, 0x74, 0x22, 0xEA, 0x9E,
-    0x2A, 0x40, 0xA7, 0x66, 0x44, 0xE7, 0x81, 0x3A, 0x2A, 0x32, 0x5C, 0x0D, 0x4B, 0x38, 0xB3, 0x22,
-    0xA1, 0x0D, 0x85, 0x42, 0xEF, 0x7E, 0x82, 0x3D, 0x33, 0x9C, 0x2E, 0x40, 0x00, 0x45, 0x88, 0x81,
-    0x46, 0x39, 0xA0, 0x08, 0x8B, 0xE0, 0xBA, 0x2E, 0x78, 0x1E, 0x2F, 0x29, 0x38, 0x4E, 0x0F, 0xC3,
-    0x44, 0x1B, 0x72, 0x2D, 0xCD, 0x43, 0x31, 0x7E, 0xBC, 0x46, 0x02, 0x1D, 0xA0, 0x13, 0xCE, 0xFF,
-    0xE0, 0x71, 0xEE, 0x5D, 0x2B, 0xBA, 0xD9, 0x69, 0xE5, 0x7F, 0x56, 0x2B, 0xFF, 0xF3, 0x46, 0xFE,
-    0xBE, 0xDB, 0xF6, 0x48, 0x12, 0x4F, 0x5D, 0xE5, 0x2A, 0x54, 0x02, 0xFC, 0x9B, 0xE7, 0x82, 0xCF,
-    0x21, 0x56, 0xAF, 0xC8, 0x98, 0xAB, 0x00, 0xD6, 0x90, 0x95, 0x30, 0x3D, 0x94, 0x3B, 0x83, 0x52,
-    0x03, 0xD0, 0x85, 0x32, 0x84, 0x02, 0x1C, 0x6B, 0x2D, 0xEA, 0x82, 0x72, 0x1D, 0x7D, 0xB6, 0xEA,
-    0xE5, 0x8E, 0x2D, 0x91, 0x85, 0x18, 0x2D, 0x0E, 0xE9, 0xC4, 0x86, 0xB6, 0x72, 0x7E, 0xA6, 0x70,
-    0xAF, 0x28, 0xBE, 0xE2, 0x6E, 0x21, 0x46, 0x57, 0x3B, 0xD8, 0x3A, 0x30, 0x48, 0xCA, 0x4E, 0x25,
-    0x14, 0x39, 0x97, 0x40, 0x11, 0xB0, 0x9C, 0xE0, 0x09, 0x57, 0x90, 0x1A, 0x89, 0x37, 0xEF, 0xCE,
-    0x63, 0xD1, 0x4B, 0x2D, 0x81, 0xA9, 0x28, 0xA1, 0x6D, 0x75, 0x84, 0xF6, 0x14, 0xAC, 0xA8, 0x5B,
-    0xFD, 0x3E, 0xF8, 0xFC, 0x8B, 0xBF, 0x79, 0xE1, 0x37, 0x7F, 0xFF, 0x43, 0x50, 0xFE, 0xE9, 0x5D,
-    0x32, 0x0A, 0x4A, 0x5D, 0x70, 0xA8, 0x75, 0xFF, 0x51, 0x28, 0x6F, 0x57, 0x3E, 0x75, 0xDB, 0xB4,
-    0x49, 0x31, 0x1C, 0xDA, 0x58, 0x4C, 0x83, 0x90, 0x4D, 0x27, 0x16, 0xD7, 0xA1, 0xE0, 0xE0, 0x0F,
-    0x89, 0x82, 0xB2, 0xC6, 0x0A, 0x11, 0x9B, 0x0C, 0xF8, 0x2A, 0xAC, 0x4D, 0x58, 0x5B, 0x90, 0xF5,
-    0xC0, 0x21, 0x28, 0x36, 0x28, 0x61, 0xFD, 0x56, 0x14, 0x49, 0xB2, 0x46, 0x8A, 0x4A, 0xB0, 0xEE,
-    0xC9, 0x15, 0x86, 0x86, 0xB0, 0x8A, 0xDE, 0x11, 0xD3, 0x4E, 0xDB, 0x10, 0x61, 0x61, 0xDD, 0xCA,
-    0x4E, 0xCE, 0x1B, 0xC1, 0x7A, 0xF1, 0xB7, 0xB1, 0xB8, 0x11, 0x5C, 0xEE, 0x33, 0x9D, 0x2C, 0x05,
-    0xFB, 0xA3, 0x6C, 0x0C, 0xF6, 0xEF, 0xD5, 0xD0, 0x91, 0x2C, 0x17, 0x06, 0xEF, 0x50, 0x42, 0xA4,
-    0x0B, 0x3E, 0xDB, 0xAB, 0xC1, 0x25, 0xC1, 0xFC, 0x26, 0xC8, 0x55, 0xB7, 0xCE, 0xC8, 0x6E, 0x22,
-    0x8D, 0xAB, 0xFD, 0xD7, 0xB6, 0x5C, 0xA7, 0x3B, 0x35, 0x4F, 0x46, 0x93, 0x46, 0x2C, 0x84, 0x25,
-    0x2B, 0xE0, 0x69, 0xC6, 0x4B, 0xC3, 0xD2, 0x6D, 0xD2, 0x0C, 0xB8, 0x4D, 0xA1, 0x10, 0xF1, 0x77,
-    0x4E, 0x0C, 0x37, 0xB4, 0x9A, 0x2C, 0x30, 0x3D, 0x9A, 0x22, 0xAC, 0x49, 0x65, 0xB1, 0x04, 0x80,
-    0x81, 0x31, 0x8A, 0xB4, 0xC5, 0x48, 0xEA, 0x4D, 0x88, 0xC0, 0x49, 0xD3, 0x18, 0x8C, 0xA6, 0x6D,
-    0x52, 0x4E, 0x7A, 0x1D, 0x33, 0x50, 0x38, 0x0F, 0xE9, 0xB6, 0x56, 0x4C, 0x02, 0x84, 0x25, 0xE6,
-    0x1D, 0x4A, 0x12, 0xEA, 0x96, 0x6A, 0x31, 0x12, 0xE5, 0xD8, 0x7B, 0x19, 0xBD, 0x82, 0xA5, 0x4A,
-    0x8E, 0x13, 0xFC, 0x55, 0xA6, 0x2A, 0x28, 0xD2, 0x4A, 0xD3, 0x5F, 0xAB, 0x5A, 0xE5, 0xFD, 0xF1,
-    0xC6, 0xD5, 0x46, 0x4D, 0x6E, 0x7C, 0xCD, 0x38, 0x2F, 0xE4, 0x3D, 0x95, 0x79, 0x9E, 0x72, 0x46,
-    0x38, 0xDD, 0x54, 0xBF, 0x24, 0x87, 0x73, 0xDD, 0xD9, 0x3E, 0x9A, 0xDF, 0xA9, 0x27, 0xDA, 0x13,
-    0x72, 0x6E, 0x62, 0xBA, 0xA4, 0x37, 0x62, 0xE1, 0x95, 0x79, 0x2D, 0xBC, 0x31, 0x78, 0x68, 0x90,
-    0xE9, 0x72, 0xC4, 0xFF, 0xD6, 0xBF, 0xAB, 0x78, 0x9F, 0x73, 0xC2, 0xB6, 0x63, 0xDB, 0x3A, 0xD3,
-    0x6B, 0xAE, 0x76, 0x3C, 0x37, 0x69, 0xA7, 0xC2, 0x69, 0x8B, 0xB6, 0xFA, 0x76, 0xBA, 0x73, 0x6C,
-    0xA7, 0x9E, 0x98, 0x21, 0x3B, 0xA9, 0x95, 0xA3, 0xAF, 0x29, 0x09, 0x17, 0xD2, 0xF0, 0x13, 0x53,
-    0x12, 0xB2, 0x5F, 0x19, 0x57, 0x14, 0x90, 0xC4, 0x25, 0xE9, 0x87, 0xDA, 0xA4, 0x5A, 0xB5, 0x15,
-    0x3F, 0x79, 0x6D, 0x0A, 0x3E, 0xF1, 0xEA, 0xC5, 0x9D, 0xF6, 0x29, 0x78, 0xD1, 0xAB, 0x83, 0xE7,
-    0x2B, 0xA6, 0x2D, 0xA5, 0x70, 0xD7, 0xF3, 0xEC, 0xB1, 0xC4, 0x85, 0x6F, 0x92, 0x45, 0xA0, 0xC5,
-    0x0C, 0xFC, 0x46, 0x5B, 0x33, 0x89, 0x4F, 0x31, 0xBE, 0xF0, 0x09, 0x7A, 0x1D, 0x73, 0xD9, 0x2D,
-    0x92, 0x7F, 0x5F, 0x42, 0xB3, 0xF1, 0xA9, 0x4E, 0x1D, 0xC2, 0x7D, 0x97, 0xF1, 0x44, 0xCC, 0xC7,
-    0xFC, 0xC1, 0xF1, 0xF5, 0xD8, 0xA8, 0x6F, 0x24, 0x88, 0x0F, 0x49, 0x17, 0x7D, 0x4A, 0xEF, 0xFD,
-    0x71, 0xFA, 0x49, 0x3E, 0x74, 0xD2, 0x26, 0xD3, 0x5F, 0xDD, 0xB9, 0x39, 0x16, 0x82, 0x06, 0x15,
-    0xC5, 0xC0, 0xE4, 0x9B, 0x16, 0x66, 0xD5, 0x1F, 0x1B, 0x2C, 0xD7, 0xE7, 0x4D, 0xAC, 0xC2, 0x77,
-    0x1B, 0xF4, 0x04, 0xF6, 0x5B, 0x8E, 0x17, 0x41, 0x95, 0xC1, 0xC4, 0x2B, 0xC5, 0xB0, 0x53, 0x47,
-    0xA0, 0x70, 0x22, 0x0C, 0x2C, 0xC6, 0xFB, 0x37, 0x37, 0x95, 0xC2, 0xCD, 0x4E, 0x1D, 0x25, 0x93,
-    0x4E, 0xE7, 0xD4, 0x9B, 0x8C, 0x56, 0x06, 0x1F, 0x7C, 0x51, 0x45, 0x1F, 0x7C, 0x51, 0xC7, 0x8F,
-    0x7D, 0xD6, 0xA4, 0x7E, 0xD9, 0x1A, 0xBF, 0x34, 0x98, 0x4E, 0xB2, 0x30, 0x5E, 0x96, 0x8F, 0xD8,
-    0xFF, 0x8A, 0xC1, 0x80, 0xE0, 0x3D, 0x4C, 0x98, 0x0A, 0xDF, 0x63, 0xA0, 0x26, 0x3E, 0x2E, 0x21,
-    0x8A, 0xD9, 0x20, 0x96, 0x6C, 0x6E, 0xD7, 0x9C, 0x6C, 0x0D, 0xC8, 0xDF, 0xAD, 0x37, 0xA3, 0xCC,
-    0x4C, 0xE6, 0x9B, 0x61, 0x6E, 0xBC, 0x6A, 0x33, 0x28, 0x4C, 0x50, 0x6E, 0x42, 0x7B, 0x07, 0x05,
-    0xC6, 0x63, 0xA2, 0x7C, 0x73, 0x52, 0x9B, 0x38, 0xDB, 0x74, 0x9B, 0x63, 0xCA, 0x9D, 0x51, 0xDB,
-    0x4E, 0x98, 0x68, 0xC2, 0x2C, 0x64, 0xC0, 0xC1, 0x45, 0xE8, 0x09, 0x15, 0xBE, 0x5A, 0xAA, 0xF8,
-    0xF5, 0xF4, 0xD1, 0x4A, 0xA6, 0x73, 0x2E, 0x18, 0x36, 0xC3, 0x49, 0x46, 0xBB, 0x63, 0xB7, 0x69,
-    0x36, 0x55, 0x3C, 0x99, 0x37, 0xA9, 0x8A, 0xBD, 0xAA, 0x89, 0x93, 0x38, 0x28, 0x39, 0x01, 0x41,
-    0xD1, 0x04, 0x05, 0x2D, 0x58, 0xCA, 0x5A, 0x49, 0x7E, 0x53, 0xD7, 0x43, 0xB9, 0x8A, 0x9C, 0xB4,
-    0x2B, 0x11, 0x7C, 0x59, 0x71, 0xBE, 0xCB, 0x3E, 0x22, 0xC4, 0x65, 0x9A, 0x74, 0x46, 0x33, 0xEE,
-    0x15, 0xD1, 0xC2, 0xA0, 0x9F, 0x6C, 0x7C, 0x18, 0x06, 0x86, 0x9E, 0x91, 0x21, 0x33, 0x62, 0x3A,
-    0x31, 0x28, 0xA7, 0x3D, 0x32, 0x9B, 0xBD, 0x09, 0x52, 0xA0, 0x98, 0x2F, 0x3D, 0x78, 0x4C, 0x0E,
-    0xDE, 0xAF, 0x36, 0x5B, 0x31, 0xCD, 0xB0, 0x34, 0x19, 0x4D, 0x8E, 0xE0, 0xE2, 0x27, 0x55, 0xF4,
-    0xDA, 0x47, 0x55, 0x1C, 0xFC, 0x76, 0x1E, 0x07, 0x1F, 0x36, 0x18, 0x7C, 0xA3, 0x27, 0x12, 0xD9,
-    0x34, 0xFD, 0xC1, 0xB5, 0x94, 0xA7, 0xCC, 0x74, 0x5D, 0xB2, 0x6D, 0x50, 0x5C, 0x9C, 0xDC, 0x42,
-    0xFC, 0x0D, 0xEF, 0x9B, 0xC6, 0xD2, 0xE9, 0xBC, 0xCF, 0x01, 0xF7, 0x07, 0xAC, 0xC2, 0xD4, 0x50,
-    0xB6, 0x1B, 0xB7, 0x8D, 0x5F, 0xAB, 0x48, 0xAC, 0xF1, 0x2B, 0x58, 0x08, 0x6F, 0x4E, 0xE7, 0x19,
-    0x1D, 0xE6, 0xE0, 0x0C, 0x9D, 0x68, 0xB0, 0x51, 0x28, 0x24, 0x69, 0xC4, 0x1D, 0x57, 0xC7, 0x5C,
-    0x7A, 0x59, 0x31, 0x27, 0x03, 0x33, 0x27, 0xB3, 0x08, 0x4E, 0xC2, 0x8C, 0x82, 0xCC, 0x38, 0xC7,
-    0xEB, 0x57, 0x32, 0x99, 0x5D, 0x89, 0x7A, 0xA1, 0x63, 0xF1, 0xC9, 0x8E, 0xF7, 0x4C, 0xAE, 0x36,
-    0xC4, 0x5F, 0x73, 0xA6, 0xBD, 0xCF, 0x40, 0x3B, 0x1C, 0x0D, 0xF1, 0x3B, 0x4D, 0x94, 0x39, 0xC9,
-    0x2A, 0x14, 0x1D, 0xCC, 0x84, 0xF6, 0x02, 0x16, 0x8E, 0xD4, 0x79, 0x8D, 0x4C, 0x42, 0xCB, 0xBB,
-    0x0C, 0x58, 0xDE, 0x20, 0x52, 0xD4, 0x97, 0x40, 0x13, 0x28, 0x37, 0x73, 0x44, 0x94, 0x60, 0x79,
-    0x1D, 0xBA, 0x06, 0xFE, 0x7C, 0x11, 0xC2, 0x0C, 0xE6, 0xCE, 0x39, 0x53, 0x85, 0xF2, 0x6C, 0xAB,
-    0xD2, 0x7F, 0xB3, 0x3A, 0x21, 0xBD, 0x7C, 0x56, 0x18, 0xD9, 0xA7, 0x00, 0xBD, 0xCF, 0x51, 0xAB,
-    0x49, 0x94, 0x78, 0xA5, 0x49, 0xDC, 0x1B, 0x73, 0x09, 0x4C, 0xC5, 0xD6, 0xB7, 0x49, 0xBE, 0x2B,
-    0xA1, 0x99, 0x38, 0x51, 0x27, 0x8D, 0x78, 0x1C, 0x62, 0x24, 0x3B, 0x3A, 0x1B, 0xAC, 0x7D, 0x67,
-    0x06, 0x1B, 0xB6, 0x0F, 0xA8, 0x68, 0x98, 0xCD, 0x9B, 0x14, 0x17, 0xB3, 0x37, 0x25, 0x86, 0x14,
-    0xD2, 0xA9, 0x38, 0x71, 0x40, 0x6D, 0xBA, 0xB5, 0x5F, 0x76, 0x40, 0xD5, 0x6E, 0x28, 0xA8, 0x34,
-    0x50, 0x99, 0xBE, 0x04, 0xCB, 0x34, 0xA6, 0xA3, 0x44, 0x0A, 0xA3, 0x41, 0x80, 0x97, 0xFE, 0x6D,
-    0x0B, 0xC6, 0x75, 0x29, 0x42, 0xB6, 0x21, 0x16, 0xAD, 0xEC, 0x84, 0x8E, 0x39, 0xCD, 0xC1, 0x2C,
-    0x3D, 0x0E, 0x4E, 0x25, 0xAA, 0x80, 0xFC, 0x11, 0x79, 0x16, 0xC5, 0x3D, 0xC2, 0xC2, 0x9E, 0xA2,
-    0x83, 0xF6, 0x61, 0x13, 0x95, 0xF4, 0xE6, 0xB6, 0x38, 0x68, 0xED, 0x2E, 0xEF, 0x18, 0x32, 0x13,
-    0x99, 0xCD, 0xA0, 0xF8, 0x92, 0xE2, 0x65, 0xB6, 0x8F, 0xC6, 0x1D, 0x49, 0x8E, 0xFE, 0x12, 0xDC,
-    0x72, 0x3D, 0x9B, 0xE9, 0x82, 0x65, 0x1A, 0x3D, 0x7A, 0x1D, 0x54, 0x29, 0x17, 0xE4, 0x16, 0x49,
-    0xDA, 0x84, 0x73, 0xC7, 0xD8, 0x06, 0xEC, 0x78, 0xD7, 0x87, 0x64, 0xCC, 0x16, 0xD7, 0xBF, 0xB0,
-    0xAE, 0x3F, 0x5D, 0x7D, 0x23, 0xF6, 0x22, 0x0D, 0x46, 0x38, 0x9E, 0xD2, 0x4A, 0x9A, 0xF1, 0x1E,
-    0xEB, 0xFA, 0x57, 0x43, 0x4C, 0x3F, 0x2C, 0xE8, 0x5C, 0x97, 0x24, 0x7F, 0x28, 0x74, 0x87, 0xA9,
-    0x8A, 0xC9, 0x22, 0x55, 0x51, 0x49, 0x79, 0x08, 0xAD, 0xAA, 0x92, 0x51, 0xFB, 0x1C, 0xA3, 0xE2,
-    0xA2, 0xB6, 0x58, 0x6D, 0xF8, 0xF2, 0xCA, 0x2A, 0x6F, 0xD1, 0xDE, 0x22, 0xE1, 0x98, 0x4D, 0xB1,
-    0x9A, 0x7A, 0xC6, 0xFC, 0x6B, 0xE2, 0x43, 0x2C, 0x06, 0x78, 0x22, 0xFA, 0xEF, 0xB0, 0x60, 0x88,
-    0x37, 0x4E, 0xE0, 0xEB, 0x2A, 0xAF, 0x02, 0xAB, 0x5E, 0x83, 0x65, 0xDB, 0x91, 0xCD, 0xE6, 0xD6,
-    0x55, 0x4D, 0xFB, 0x7C, 0x8D, 0x78, 0x5D, 0x1F, 0x91, 0x38, 0xBF, 0xA6, 0x23, 0x50, 0xBF, 0x80,
-    0xFF, 0x1F, 0x0C, 0x17, 0x99, 0x8E, 0x7B, 0xD4, 0x5F, 0xB1, 0xB8, 0x5F, 0x2B, 0x54, 0xF0, 0x3E,
-    0x9E, 0x86, 0xB7, 0xA0, 0xAA, 0xE7, 0x6D, 0x70, 0xE4, 0x6E, 0xC6, 0x21, 0x19, 0x99, 0x2E, 0xB1,
-    0xC5, 0x3B, 0xBD, 0x73, 0x69, 0xAC, 0xD1, 0x19, 0xCE, 0xC5, 0x3B, 0xC3, 0x8A, 0x39, 0xDD, 0xC1,
-    0xD3, 0x6A, 0x86, 0x47, 0x20, 0x38, 0x9C, 0x8E, 0x62, 0xD2, 0xAB, 0x29, 0xEB, 0x94, 0x7E, 0x04,
-    0x3A, 0x97, 0x83, 0x7D, 0x18, 0xB6, 0x07, 0x8F, 0x49, 0x07, 0xE2, 0x64, 0xB4, 0x03, 0x92, 0x9C,
-    0xF7, 0x25, 0x29, 0x7B, 0x43, 0xE9, 0x75, 0x3E, 0x47, 0x3B, 0x50, 0x91, 0x3A, 0x93, 0x76, 0x03,
-    0x63, 0xDF, 0x13, 0x88, 0xD3, 0x57, 0x49, 0x5D, 0x10, 0xAD, 0xB2, 0x21, 0x3B, 0x38, 0xE9, 0xED,
-    0x5E, 0xBF, 0x1F, 0x78, 0x68, 0xA9, 0xC1, 0xEB, 0xA3, 0xCF, 0x9E, 0x4D, 0x43, 0x4B, 0x09, 0x0C,
-    0xA8, 0x6B, 0xF5, 0x34, 0x6C, 0x18, 0x50, 0x98, 0x4D, 0x3B, 0x30, 0x80, 0xCE, 0xA4, 0x7C, 0xA1,
-    0x5F, 0x6A, 0x60, 0x86, 0xD0, 0xA2, 0x69, 0x25, 0x67, 0x1A, 0x15, 0x50, 0x36, 0x54, 0x4D, 0x45,
-    0xEA, 0x89, 0x8A, 0x2A, 0x28, 0xDA, 0x78, 0x3E, 0xBA, 0x58, 0xA0, 0xB3, 0x51, 0x0E, 0x43, 0x52,
-    0xF2, 0x8B, 0xB4, 0xE8, 0xA2, 0xEB, 0x26, 0xF1, 0x0C, 0xE7, 0x83, 0x62, 0x5B, 0x49, 0xA4, 0xD6,
-    0xED, 0x33, 0x5B, 0xEE, 0xB6, 0x6E, 0xF6, 0xEB, 0x33, 0xE9, 0xB5, 0xF5, 0xC4, 0xD8, 0xE9, 0x9D,
-    0xD8, 0xDB, 0x0F, 0x11, 0xD9, 0xC4, 0xFB, 0x86, 0x92, 0xE0, 0x34, 0xA5, 0x6C, 0x12, 0x74, 0x2D,
-    0xC4, 0x59, 0xB9, 0x16, 0x83, 0x4A, 0x14, 0x03, 0x24, 0x20, 0x0F, 0x4C, 0x62, 0xC0, 0x99, 0xF4,
-    0x47, 0x14, 0xCC, 0xE5, 0x82, 0xDC, 0x12, 0x97, 0x87, 0xE2, 0x32, 0x6C, 0x5B, 0xCB, 0xDE, 0xB0,
-    0x2E, 0xA8, 0x9A, 0x24, 0xB0, 0x69, 0x59, 0xF9, 0xE7, 0xFD, 0x8A, 0xFA, 0x60, 0xBC, 0xF5, 0x4B,
-    0x12, 0x9B, 0x86, 0x30, 0x28, 0xE2, 0x4F, 0x3F, 0xAD, 0xD2, 0x53, 0x5E, 0xAD, 0x97, 0x13, 0x9B,
-    0x84, 0xC4, 0xAB, 0xE3, 0x0F, 0x2E, 0xCE, 0x31, 0x63, 0x25, 0xE3, 0xE0, 0x0A, 0xF6, 0x91, 0x82,
-    0x89, 0xAC, 0x1C, 0x36, 0x32, 0xA4, 0xCF, 0x2D, 0x75, 0xF4, 0xC4, 0x31, 0x3F, 0x2A, 0x07, 0xAF,
-    0x5F, 0x8E, 0x7E, 0x75, 0xFA, 0x52, 0x1F, 0x3B, 0xF8, 0x55, 0xB9, 0x5F, 0x97, 0x2E, 0x1A, 0x9C,
-    0x30, 0x1E, 0x36, 0xC7, 0x14, 0xD6, 0x1E, 0xF9, 0xBF, 0xBA, 0xDF, 0x75, 0x3B, 0x4B, 0x7B, 0xC6,
-    0xA6, 0x65, 0xD2, 0x44, 0x0A, 0x8C, 0xA8, 0x80, 0xB6, 0x1E, 0xDC, 0x37, 0x99, 0xB0, 0x81, 0x7B,
-    0xC7, 0x43, 0x86, 0x03, 0x97, 0x11, 0x07, 0xAC, 0x52, 0xE1, 0x51, 0xD0, 0x84, 0x75, 0xD0, 0xC2,
-    0x28, 0xF2, 0xAD, 0xD3, 0x83, 0xA9, 0xD0, 0x94, 0x18, 0x69, 0x1B, 0x8C, 0x52, 0x07, 0xCB, 0x74,
-    0xCD, 0x12, 0xF4, 0x25, 0xCE, 0xFD, 0x15, 0x2E, 0x46, 0x78, 0xF8, 0x02, 0x4F, 0x6D, 0xCA, 0xE5,
-    0xD4, 0x92, 0x96, 0x60, 0xCB, 0x4B, 0xAC, 0xAE, 0x73, 0x74, 0xB2, 0x5E, 0xB2, 0x82, 0x01, 0x93,
-    0x1B, 0x51, 0xDF, 0xA8, 0xF8, 0x43, 0x75, 0x48, 0x67, 0x52, 0x4E, 0x91, 0x6B, 0x49, 0xCE, 0x19,
-    0x75, 0x58, 0x2A, 0x4E, 0x60, 0x52, 0x51, 0x72, 0xC1, 0x4E, 0xD6, 0xF4, 0x37, 0x41, 0x39, 0x3A,
-    0x97, 0xC0, 0x12, 0x97, 0xD7, 0xFC, 0x19, 0x94, 0xE3, 0x42, 0x56, 0xCE, 0xC7, 0xFE, 0xCC, 0x66,
-    0x99, 0x38, 0x86, 0x98, 0x01, 0xF7, 0x93, 0x4F, 0x38, 0xF2, 0xE3, 0xEE, 0x70, 0xF1, 0x2F, 0x69,
-    0xF1, 0xAB, 0x95, 0xE9, 0x54, 0xE8, 0x91, 0x56, 0x65, 0x70, 0xFE, 0xBF, 0x80, 0x57, 0xBE, 0xF3,
-    0x9D, 0xA1, 0x27, 0xF7, 0xC2, 0x1F, 0x58, 0x4E, 0x40, 0xB1, 0x04, 0x2D, 0x68, 0x9D, 0xB7, 0x98,
-    0x35, 0x1E, 0x12, 0xE0, 0xE9, 0x72, 0xF2, 0xBB, 0x4F, 0x80, 0xC7, 0x8B, 0x04, 0x38, 0xD7, 0xB9,
-    0x70, 0x99, 0xC8, 0x8A, 0x24, 0xED, 0xBB, 0x23, 0x38, 0xBA, 0x94, 0xB8, 0x42, 0x93, 0x16, 0xBF,
-    0xE8, 0xE3, 0x0A, 0xCB, 0xE1, 0x59, 0x5A, 0x2E, 0xB0, 0xF8, 0x2A, 0x87, 0x45, 0x07, 0x37, 0x7D,
-    0x14, 0x87, 0xFF, 0x63, 0xA5, 0x36, 0x1E, 0x54, 0xAA, 0x7E, 0xDB, 0xA6, 0xB4, 0x25, 0xF4, 0x01,
-    0x51, 0x13, 0xF8, 0xD9, 0x3F, 0xE1, 0x52, 0xFA, 0xBC, 0x15, 0x48, 0x34, 0xFD, 0x27, 0x9F, 0x16,
-    0xCA, 0x7F, 0x09, 0xBE, 0x1F, 0x9E, 0xFA, 0xEE, 0x52, 0x46, 0xCC, 0x2D, 0x53, 0x46, 0x2B, 0x8A,
-    0xE7, 0x24, 0x36, 0x03, 0xD3, 0x3F, 0xBD, 0x51, 0xFD, 0x52, 0x55, 0x0F, 0x80, 0xD8, 0x2E, 0xA8,
-    0x9F, 0xA9, 0x20, 0xE1, 0x4B, 0x34, 0x88, 0x2E, 0x54, 0xBF, 0x56, 0x52, 0x95, 0x95, 0x76, 0x1B,
-    0x9D, 0xA9, 0x6A, 0x76, 0x41, 0xFD, 0xDD, 0xA0, 0x45, 0xFA, 0x09, 0x2B, 0xDE, 0xB2, 0xC7, 0x44,
-    0x44, 0x08, 0xEB, 0x3B, 0x56, 0xC8, 0x3B, 0x99, 0xCC, 0x8B, 0xF3, 0x21, 0x46, 0xFD, 0xF6, 0xB3,
-    0xCA, 0x49, 0xD6, 0x86, 0x3B, 0x76, 0xFD, 0xB1, 0x32, 0xD4, 0x24, 0x3F, 0x65, 0xDF, 0xDC, 0xDF,
-    0xE5, 0xF7, 0x73, 0xC4, 0xAE, 0xCA, 0x6E, 0xFB, 0xE0, 0x8B, 0x7C, 0x18, 0xB7, 0x7D, 0x85, 0x5E,
-    0xFD, 0xB2, 0x52, 0x6E, 0x06, 0xC9, 0xB0, 0xF1, 0x0F, 0xCB, 0x77, 0x44, 0x56, 0x1C, 0x0F, 0x35,
-    0x94, 0x2A, 0x7F, 0x76, 0x6B, 0x0B, 0x2B, 0xF6, 0xF0, 0x3D, 0x7B, 0xF8, 0x91, 0x3D, 0x3C, 0x48,
-    0xF4, 0xAC, 0xE5, 0xBC, 0xE7, 0xD4, 0x2F, 0x94, 0x97, 0xC8, 0x29, 0x2D, 0x2C, 0xE9, 0x32, 0xE2,
-    0x84, 0xFF, 0x76, 0xEF, 0x9D, 0xC8, 0x26, 0xAF, 0xE0, 0xF2, 0xC3, 0x43, 0x72, 0x44, 0x62, 0x1D,
-    0xD9, 0xF5, 0x09, 0xB2, 0xDB, 0x5B, 0x76, 0x38, 0x73, 0x2B, 0x07, 0x9E, 0x57, 0x4E, 0x89, 0x35,
-    0xF9, 0x91, 0xED, 0xD2, 0xF7, 0xC6, 0x9E, 0x29, 0xF5, 0x4F, 0xF6, 0xF0, 0xAC, 0xC4, 0x57, 0xDD,
-    0xD3, 0x14, 0x7B, 0x5C, 0xA5, 0x49, 0xBB, 0x4E, 0x89, 0x6B, 0x93, 0xCD, 0x47, 0xCE, 0x8C, 0x4D,
-    0x6F, 0x8A, 0x47, 0xD4, 0x89, 0x97, 0x42, 0xC1, 0x44, 0x1C, 0x08, 0x8E, 0x05, 0xA7, 0x29, 0xB1,
-    0x81, 0xA2, 0xEF, 0xC0, 0xD5, 0x09, 0xC3, 0x21, 0xC4, 0xE0, 0x60, 0x60, 0xF2, 0x14, 0x8B, 0x2C,
-    0x88, 0x19, 0xEB, 0xA3, 0x89, 0x4A, 0x0C, 0xE3, 0x7A, 0xAA, 0xC4, 0xB1, 0x51, 0x62, 0xD0, 0xB2,
-    0x52, 0x34, 0xB6, 0x0E, 0xA6, 0x28, 0x17, 0x2B, 0xF8, 0xAD, 0xDA, 0xB4, 0xDA, 0x68, 0x50, 0x99,
-    0x6A, 0x35, 0x73, 0x61, 0x77, 0x95, 0xE8, 0xB2, 0x77, 0x0D, 0x2E, 0x84, 0x2B, 0x1D, 0x5E, 0xAF,
-    0x47, 0xE7, 0x74, 0xF5, 0x8C, 0xA2, 0xCD, 0x40, 0xCF, 0x82, 0x28, 0x25, 0xE2, 0xFB, 0x5E, 0x6E,
-    0x81, 0x5E, 0x01, 0x2F, 0xC7, 0x8F, 0x7F, 0x0E, 0x94, 0xBE, 0xCB, 0x20, 0xEC, 0xC3, 0x40, 0xE8,
-    0x36, 0x6C, 0x12, 0xB7, 0x7B, 0x33, 0x86, 0x81, 0x38, 0x8F, 0x4B, 0x6B, 0xA3, 0x4D, 0x88, 0x3C,
-    0xCA, 0x7E, 0x56, 0x4A, 0x5A, 0x14, 0xE6, 0x7E, 0x9F, 0x41, 0x4E, 0xA5, 0x66, 0xC5, 0x42, 0xD0,
-    0x9F, 0x0B, 0xE0, 0x06, 0x04, 0x36, 0xF8, 0x0E, 0x53, 0x28, 0x9C, 0xF7, 0xB9, 0xC8, 0xC6, 0x1E,
-    0xC3, 0x79, 0x60, 0x3D, 0xB3, 0x5C, 0xEE, 0x2B, 0x97, 0xE3, 0x99, 0x73, 0x81, 0xE1, 0xDC, 0x16,
-    0x60, 0xEC, 0xCA, 0x3A, 0x57, 0x8C, 0xA6, 0x2D, 0x62, 0x53, 0xD7, 0x75, 0x25, 0x0E, 0x97, 0xE9,
-    0xFA, 0xCA, 0xC2, 0x9B, 0x8A, 0x79, 0x32, 0xF3, 0x3D, 0x40, 0x64, 0x12, 0xB3, 0x6E, 0x16, 0x91,
-    0x71, 0xBA, 0xAC, 0xEA, 0x27, 0x3B, 0xE6, 0xDE, 0x8F, 0xC1, 0xEC, 0x88, 0xD7, 0x25, 0x86, 0x90,
-    0x41, 0x0A, 0xE6, 0x22, 0x11, 0x69, 0x73, 0x65, 0x3D, 0xBC, 0xFB, 0x69, 0x19, 0xBF, 0x0F, 0xBD,
-    0xFB, 0xB9, 0xB8, 0x3A, 0xB9, 0xE4, 0x6A, 0xDF, 0x60, 0x5E, 0x37, 0x80, 0x45, 0xED, 0x58, 0x67,
-    0x64, 0x09, 0x28, 0x71, 0xA9, 0x8C, 0xF8, 0x59, 0x54, 0x42, 0x4F, 0xA7, 0xDF, 0xA6, 0x96, 0xFB,
-    0x04, 0x29, 0x41, 0x3E, 0xC7, 0xCE, 0x35, 0xB1, 0x91, 0x4F, 0xA6, 0x76, 0xFF, 0xF8, 0x7D, 0xFC,
-    0x5B, 0xE0, 0xEA, 0x34, 0x19, 0xD7, 0x87, 0x0E, 0xD9, 0xD5, 0x13, 0x58, 0xB3, 0x46, 0x60, 0xFD,
-    0xFA, 0x19, 0xB5, 0x7C, 0x6D, 0x3B, 0x1C, 0x9C, 0x9D, 0x85, 0x26, 0xE1, 0xE7, 0x0F, 0x53, 0x08,
-    0xB4, 0x90, 0xB5, 0x81, 0x85, 0xA4, 0x00, 0x0A, 0xFB, 0xEF, 0xF8, 0xD1, 0x7D, 0xF4, 0x46, 0x60,
-    0x7B, 0x8D, 0xA8, 0x58, 0x19, 0x97, 0x86, 0x1A, 0xD2, 0xDC, 0xFC, 0xBB, 0x61, 0xBD, 0xDD, 0x1C,
-    0xCE, 0x6E, 0x6F, 0xB5, 0xB8, 0x23, 0x58, 0x8A, 0xF7, 0x6B, 0xB5, 0x16, 0x55, 0x3D, 0x79, 0xC1,
-    0x03, 0x69, 0xFB, 0x4C, 0xFA, 0x19, 0x71, 0xDC, 0x04, 0x3E, 0x3E, 0xB1, 0x98, 0x69, 0x86, 0x0D,
-    0x86, 0x6C, 0xFA, 0xEF, 0xB8, 0x1A, 0x69, 0xAF, 0xD1, 0x42, 0x01, 0x5B, 0x74, 0x03, 0x9D, 0x93,
-    0x30, 0xB5, 0xC7, 0x79, 0x6D, 0x69, 0xC6, 0xF4, 0xBA, 0x39, 0x28, 0xC0, 0x5D, 0x30, 0x10, 0x4B,
-    0x9F, 0xF5, 0x0A, 0x41, 0x19, 0x70, 0xBB, 0x41, 0x50, 0x4A, 0xA4, 0x2B, 0x28, 0x25, 0x06, 0x1B,
-    0x7C, 0x26, 0x46, 0xFB, 0xE3, 0x5F, 0x48, 0x4D, 0xD1, 0xC5, 0xAF, 0x2A, 0x6B, 0x4C, 0x0B, 0x53,
-    0x5C, 0xB9, 0xC2, 0x86, 0xE2, 0x8B, 0x5F, 0x92, 0x39, 0xB5, 0xDC, 0xE2, 0x40, 0x57, 0x4B, 0x79,
-    0x08, 0x4C, 0x65, 0xDA, 0x7A, 0x68, 0xEC, 0x63, 0x98, 0x00, 0x68, 0x9A, 0x31, 0x4B, 0xD0, 0xAE,
-    0x81, 0x51, 0x01, 0x75, 0xDE, 0xDB, 0x92, 0xE1, 0xED, 0x0F, 0x2C, 0xF0, 0x3D, 0x78, 0x7A, 0xF5,
-    0x4D, 0x36, 0x56, 0x85, 0x52, 0xBE, 0x45, 0xBB, 0x91, 0x22, 0x46, 0xD4, 0xEA, 0xE3, 0x5F, 0x4B,
-    0xD9, 0xEF, 0xC5, 0x3F, 0xD5, 0xB6, 0x67, 0xD5, 0xE2, 0x10, 0x5F, 0xFC, 0x53, 0x23, 0x3D, 0xFB,
-    0xBA, 0x93, 0x9E, 0xF1, 0x01, 0x79, 0x9C, 0x69, 0x39, 0xFC, 0xB2, 0xE4, 0x06, 0xCE, 0x4B, 0x5F,
-    0xCA, 0x96, 0xDE, 0xF6, 0xB0, 0x6F, 0x05, 0xA2, 0x0F, 0xF4, 0xA1, 0x5F, 0x1F, 0xE3, 0x78, 0x2A,
-    0xB7, 0xBA, 0xEF, 0x45, 0x56, 0x5F, 0xDC, 0x71, 0xD2, 0xFF, 0x01, 0x69, 0x00, 0xCF, 0xE3, 0x71,
-    0x3C, 0x7D, 0x41, 0xEA, 0xCF, 0xA5, 0x86, 0x48, 0xCA, 0xF1, 0xA5, 0x42, 0xD3, 0x06, 0xF5, 0x58,
-    0xC9, 0xC9, 0xA8, 0x48, 0x5F, 0x25, 0x26, 0xA5, 0xFF, 0x86, 0x51, 0x02, 0xC3, 0x3D, 0x0F, 0x86,
-    0xA4, 0x2E, 0x21, 0x40, 0x43, 0x37, 0x80, 0x81, 0x19, 0x36, 0xC0, 0x30, 0x22, 0x65, 0x87, 0x8D,
-    0xCB, 0xDD, 0x54, 0x39, 0x3F, 0x22, 0x4A, 0xDC, 0x23, 0x1B, 0xB6, 0x84, 0x03, 0xE2, 0xE0, 0xA5,
-    0x16, 0x32, 0x16, 0xC4, 0xF8, 0x06, 0x84, 0x3A, 0x37, 0x49, 0x10, 0xDE, 0xA8, 0xEC, 0xB9, 0x97,
-    0x24, 0x37, 0xDD, 0x50, 0x2E, 0x83, 0x30, 0x1B, 0x2B, 0xE4, 0x97, 0x41, 0x35, 0x62, 0x74, 0xB1,
-    0x58, 0xE6, 0x47, 0x3A, 0x33, 0x3F, 0x66, 0x10, 0x07, 0xE2, 0x2A, 0x82, 0x78, 0x8C, 0x4A, 0xE9,
-    0xBC, 0xD0, 0x2F, 0xE9, 0x98, 0x65, 0x92, 0xE0, 0x11, 0x13, 0x41, 0xA4, 0x45, 0x60, 0x3A, 0xDE,
-    0xFB, 0x7D, 0x96, 0x0A, 0x45, 0x2C, 0x48, 0x9D, 0x4B, 0x9F, 0xFE, 0x05, 0x7D, 0xFA, 0x15, 0x5A,
-    0x7B, 0x0D, 0x7D, 0x7A, 0x6D, 0x87, 0x3E, 0xF1, 0xDC, 0x6B, 0xE8, 0xD3, 0xAF, 0xC0, 0x34, 0xFF,
-    0xCA, 0xFE, 0x87, 0x95, 0x54, 0x0B, 0xC2, 0x20, 0x47, 0xAB, 0x2C, 0x14, 0xC7, 0x4C, 0xE3, 0x3D,
-    0x8D, 0x54, 0x67, 0xD2, 0xD2, 0x7C, 0x57, 0x8A, 0xA8, 0x18, 0x54, 0x24, 0x75, 0xD9, 0xBF, 0x3E,
-    0x61, 0x7C, 0xF3, 0x1D, 0x5E, 0xCD, 0x4D, 0x1F, 0x33, 0x88, 0x73, 0x50, 0x29, 0x68, 0xBD, 0x1E,
-    0xEA, 0xA6, 0x5D, 0x33, 0x0A, 0x15, 0x23, 0x14, 0x54, 0x40, 0xF0, 0xC3, 0xFE, 0xAA, 0xDC, 0x33,
-    0x36, 0x29, 0x43, 0x2A, 0xD4, 0x59, 0x00, 0x2A, 0x0D, 0xFE, 0xC4, 0x82, 0xF4, 0x4A, 0x89, 0x7F,
-    0xC1, 0xBF, 0xBF, 0xE6, 0xB3, 0xCC, 0x1D, 0x47, 0x25, 0xEE, 0xA4, 0x52, 0x69, 0x40, 0x7C, 0xE0,
-    0x31, 0x29, 0x87, 0xA2, 0xAC, 0x9F, 0xB2, 0x64, 0xB7, 0x5F, 0x6A, 0x79, 0x05, 0xED, 0x06, 0x43,
-    0x4B, 0xD3, 0x2E, 0x35, 0x17, 0xD0, 0xAE, 0xBC, 0xD0, 0x80, 0x50, 0x83, 0xDC, 0xEC, 0x88, 0x94,
-    0xD5, 0xB6, 0xA8, 0x90, 0x41, 0xB8, 0x6A, 0x36, 0xC3, 0x72, 0x4A, 0xB8, 0xD7, 0x18, 0x8A, 0x23,
-    0x4D, 0x53, 0x51, 0x53, 0xF7, 0x69, 0xA9, 0xA5, 0x17, 0xAA, 0x16, 0x24, 0xF5, 0x86, 0xD4, 0x50,
-    0xF6, 0x16, 0x92, 0x8E, 0x44, 0x19, 0x6D, 0x36, 0xFA, 0xF6, 0xC5, 0x84, 0x7D, 0x4A, 0x67, 0x40,
-    0xD3, 0x27, 0x76, 0xBA, 0xAF, 0x5D, 0xA3, 0x1F, 0x5D, 0x2F, 0xD0, 0x60, 0x0D, 0xEC, 0x84, 0x48,
-    0x89, 0x07, 0x37, 0xA8, 0xFB, 0xCB, 0x9B, 0xD0, 0xC7, 0x4F, 0xD1, 0xC8, 0x30, 0x03, 0x92, 0x7F,
-    0x97, 0x6F, 0xB9, 0x0E, 0x05, 0x46, 0xF9, 0x44, 0x34, 0x08, 0x9E, 0x9B, 0x90, 0x1E, 0xBA, 0xD1,
-    0x0C, 0xA8, 0x3D, 0xB1, 0xA7, 0x61, 0xDD, 0x84, 0xD0, 0xF1, 0xD9, 0x69, 0xBE, 0xBC, 0x1A, 0xD0,
-    0x9D, 0x76, 0x7C, 0x19, 0x69, 0xEB, 0xCC, 0x1A, 0x2B, 0xFA, 0x86, 0x83, 0x14, 0xBD, 0x29, 0x4B,
-    0x80, 0xB7, 0x3C, 0x98, 0x2E, 0xB1, 0x29, 0x84, 0x4A, 0xF5, 0x85, 0xC7, 0x38, 0x5C, 0xA3, 0xDD,
-    0x80, 0x5B, 0x1C, 0x7B, 0xA0, 0x45, 0xC1, 0x03, 0x59, 0x61, 0x87, 0x83, 0x95, 0x92, 0xD6, 0xAE,
-    0x15, 0x91, 0xB1, 0x62, 0xC5, 0xAA, 0x2F, 0x45, 0xF9, 0x22, 0x15, 0xE5, 0x30, 0xD6, 0xD9, 0x1D,
-    0x13, 0xAF, 0xD1, 0x56, 0x45, 0xF5, 0x58, 0x3C, 0xAA, 0x6D, 0x98, 0x79, 0x75, 0x26, 0x0D, 0x04,
-    0x8B, 0x55, 0xF7, 0xFB, 0x4E, 0xAE, 0x4A, 0xEC, 0x38, 0x4F, 0x2D, 0x16, 0x37, 0x35, 0x4E, 0xD4,
-    0x28, 0x96, 0xA8, 0xBA, 0x1C, 0x91, 0xD0, 0x13, 0xE9, 0xC0, 0x44, 0xB2, 0xAE, 0xEE, 0x96, 0x32,
-    0x3F, 0x98, 0x8D, 0xAC, 0xA8, 0x60, 0x24, 0x54, 0xBA, 0x17, 0xCE, 0x25, 0x2E, 0xE4, 0x5F, 0x22,
-    0x1B, 0x77, 0x1C, 0xAF, 0x81, 0x1F, 0xDF, 0xC1, 0x0B, 0x3E, 0xDE, 0x84, 0x16, 0xA5, 0x82, 0x4E,
-    0x01, 0xC5, 0x79, 0x8B, 0x77, 0x96, 0x1A, 0xFE, 0x6D, 0x1D, 0x77, 0xB6, 0xDC, 0xDB, 0x35, 0xB6,
-    0x96, 0x59, 0xD6, 0x61, 0xDD, 0xEA, 0x58, 0xC6, 0x63, 0x7D, 0x8C, 0x8E, 0xB1, 0xC8, 0xB8, 0x98,
-    0x2A, 0xFD, 0x30, 0x14, 0xA0, 0x07, 0x2B, 0x22, 0xF8, 0xB2, 0x32, 0xC1, 0x7B, 0x02, 0xDA, 0xFF,
-    0xA8, 0x4A, 0xDF, 0x37, 0x65, 0x5F, 0xBA, 0x51, 0xDB, 0x40, 0xE3, 0xAA, 0xB5, 0x78, 0xC3, 0x71,
-    0x2F, 0x5B, 0x19, 0xB4, 0x6E, 0x11, 0xDD, 0xA6, 0xBC, 0x3A, 0xDE, 0xB9, 0xBC, 0x3A, 0xB3, 0x71,
-    0x0C, 0x36, 0x89, 0xA6, 0x0F, 0x36, 0x7D, 0xB6, 0x6F, 0xA3, 0xCF, 0x5A, 0x87, 0x2C, 0xFE, 0xF9,
-    0xB9, 0xA4, 0x0A, 0xB6, 0x79, 0x97, 0xDF, 0x5F, 0x14, 0xFF, 0x44, 0x5B, 0x55, 0xCE, 0xE6, 0x5D,
-    0x94, 0x6B, 0x7F, 0xCC, 0x00, 0x4F, 0x3E, 0x82, 0x8A, 0x77, 0x00, 0xA9, 0x35, 0xCA, 0xF0, 0x8E,
-    0x82, 0xB0, 0xE3, 0x2D, 0x5B, 0xE0, 0x32, 0xE9, 0xC8, 0x82, 0x94, 0x30, 0x6C, 0x05, 0x9D, 0xB8,
-    0x6D, 0x9A, 0x33, 0xCA, 0x40, 0x33, 0x22, 0xA8, 0xFC, 0x39, 0xF3, 0xA3, 0x90, 0xCD, 0xAD, 0xB6,
-    0x81, 0x73, 0x4D, 0x41, 0x5E, 0x5B, 0x7F, 0x72, 0x17, 0xB3, 0x70, 0xA6, 0x0E, 0x9E, 0xA6, 0x38,
-    0x66, 0xCD, 0x2C, 0xA5, 0x3D, 0xB3, 0x0D, 0xB4, 0x2B, 0xA4, 0x0C, 0xA8, 0x86, 0x9B, 0x04, 0x37,
-    0xC3, 0xD9, 0x29, 0x2E, 0x79, 0xCB, 0x52, 0xF5, 0x3B, 0xEF, 0xD7, 0xCA, 0xFA, 0xD5, 0x35, 0xAE,
-    0x29, 0xE1, 0xE0, 0xF9, 0xEB, 0x1B, 0xFB, 0xD1, 0xAF, 0xD0, 0x48, 0x92, 0x80, 0x1E, 0x46, 0xB2,
-    0xDC, 0xAF, 0x7D, 0xAB, 0x35, 0xBF, 0xBA, 0x16, 0xC2, 0x84, 0xA9, 0xA8, 0x05, 0x69, 0x7E, 0x89,
-    0x54, 0xF2, 0x6F, 0x85, 0x98, 0xB9, 0x3E, 0x78, 0x3A, 0x2E, 0xA8, 0xEC, 0x52, 0xA9, 0xC6, 0x9E,
-    0xB0, 0x42, 0x93, 0x2C, 0x2A, 0x7D, 0xAE, 0xE4, 0x6F, 0x9E, 0xE3, 0x35, 0xDC, 0xD3, 0xE2, 0xDE,
-    0x2E, 0xCD, 0x83, 0x9D, 0xEA, 0xDA, 0x5A, 0xD0, 0x0D, 0x5C, 0x3D, 0xBD, 0x84, 0x41, 0xA5, 0x0F,
-    0x73, 0x3E, 0xA9, 0xE7, 0xF7, 0x8E, 0xDB, 0xB5, 0x21, 0x23, 0xB7, 0x84, 0x17, 0xFE, 0xEA, 0x2D,
-    0x30, 0xE9, 0xF9, 0xCC, 0x33, 0x74, 0x3D, 0xB4, 0x45, 0x0E, 0x2B, 0x18, 0x9C, 0xF6, 0xF6, 0x88,
-    0x35, 0x57, 0x44, 0xAD, 0xA0, 0xD1, 0x49, 0xDE, 0x8E, 0x96, 0x37, 0xD2, 0xEC, 0x8A, 0xF2, 0xA3,
-    0x52, 0x2D, 0x2D, 0xA9, 0x0B, 0x46, 0x6D, 0xBF, 0x6C, 0x86, 0x4E, 0x5A, 0x84, 0xF1, 0x59, 0x6D,
-    0xBB, 0x40, 0xBB, 0xE9, 0xDD, 0x67, 0xB8, 0x03, 0x4F, 0x8B, 0x23, 0xB4, 0x15, 0xA5, 0x82, 0xB2,
-    0x75, 0xA9, 0x2B, 0x2F, 0x48, 0x6A, 0xF0, 0xD7, 0xAF, 0x4B, 0xB5, 0x91, 0x45, 0xD7, 0x33, 0xCA,
-    0xB7, 0xBC, 0x47, 0xDB, 0x37, 0x0A, 0x08, 0x0A, 0xB3, 0x34, 0x71, 0x9A, 0x94, 0x5C, 0xB2, 0x0C,
-    0x8F, 0xBC, 0x6B, 0xE1, 0x65, 0xC0, 0x47, 0x1F, 0xB4, 0x68, 0xBF, 0xE5, 0xFE, 0xAF, 0x55, 0xF3,
-    0x4D, 0xAB, 0x26, 0xEF, 0x2E, 0x01, 0x2C, 0x52, 0x89, 0x6F, 0xBB, 0x2D, 0xBB, 0x09, 0x03, 0xB3,
-    0x1C, 0x21, 0xE8, 0xE1, 0xB5, 0xB4, 0xA4, 0xCC, 0x66, 0xBC, 0x78, 0xD5, 0x40, 0x91, 0x06, 0x3D,
-    0xAC, 0x58, 0x2F, 0xFC, 0x96, 0xB5, 0xEA, 0x47, 0xA5, 0xC6, 0x81, 0x05, 0x6C, 0x73, 0x73, 0x29,
-    0xAC, 0x6F, 0xB7, 0xE9, 0x66, 0xBB, 0x7F, 0x2C, 0x40, 0xC3, 0x58, 0x4B, 0xC2, 0x3C, 0x8F, 0xE7,
-    0x69, 0x61, 0x7D, 0xEE, 0xB0, 0x80, 0x31, 0xBA, 0x2B, 0x8C, 0xC1, 0x2F, 0x96, 0x01, 0x48, 0x76,
-    0x9C, 0xF1, 0x57, 0x16, 0x6B, 0x80, 0x46, 0x92, 0xFB, 0xA4, 0x9C, 0xFF, 0x02, 0xB9, 0x3B, 0x27,
-    0x2B, 0xB2, 0x9A, 0xCD, 0x48, 0x35, 0x91, 0xB1, 0xE3, 0x04, 0x76, 0xD2, 0x8F, 0xA7, 0xD3, 0xA4,
-    0x17, 0xB4, 0x16, 0x53, 0xF2, 0x65, 0xDC, 0x44, 0x09, 0x83, 0x67, 0x62, 0xF7, 0x6E, 0xD8, 0xBD,
-    0x07, 0xE1, 0x58, 0xAF, 0x23, 0x01, 0x78, 0x56, 0x3A, 0x88, 0x8B, 0x95, 0x1D, 0x09, 0xCB, 0x28,
-    0x7F, 0x08, 0xFE, 0x63, 0x11, 0xA7, 0xB0, 0x4D, 0xC8, 0x08, 0x0C, 0xB9, 0xD3, 0x54, 0x19, 0xF7,
-    0x1F, 0xA0, 0x2F, 0x30, 0x75, 0xBB, 0xF3, 0x79, 0x1F, 0x21, 0xD6, 0x7D, 0x92, 0xE3, 0xAF, 0x31,
-    0x04, 0xC7, 0x06, 0x97, 0x6E, 0x81, 0x17, 0x03, 0x94, 0x62, 0x07, 0xFF, 0x16, 0x03, 0x0C, 0xEE,
-    0x64, 0x80, 0x8B, 0xA0, 0xD1, 0x16, 0x14, 0x33, 0x6C, 0x92, 0xC3, 0xB1, 0x02, 0xA3, 0xDD, 0xF6,
-    0x13, 0x92, 0x2E, 0x78, 0xBF, 0x52, 0x27, 0x1C, 0xD9, 0x21, 0xDF, 0xF8, 0x62, 0x54, 0xE8, 0xF3,
-    0x76, 0xC8, 0x76, 0x26, 0xC7, 0xBD, 0xBB, 0xD2, 0xA1, 0xBF, 0xEA, 0x1E, 0xCA, 0x95, 0xE4, 0x3E,
-    0x19, 0xA7, 0x54, 0x75, 0x7C, 0x23, 0xB2, 0xC4, 0x92, 0xCE, 0xFA, 0xC6, 0x68, 0xF6, 0xDD, 0x83,
-    0x5A, 0x79, 0x2D, 0x85, 0xB6, 0xDC, 0xC3, 0x48, 0x17, 0xD0, 0x2C, 0xF6, 0x2F, 0x32, 0x66, 0xC3,
-    0x84, 0xA5, 0xD4, 0x6E, 0xF6, 0xDC, 0xFA, 0x9F, 0x7A, 0xCE, 0xFD, 0x8A, 0x46, 0x71, 0xF3, 0xB8,
-    0xEA, 0x96, 0xC1, 0xD6, 0x3F, 0x4E, 0x5A, 0x75, 0x5F, 0xD8, 0x48, 0xD6, 0x3C, 0x96, 0xC8, 0x7C,
-    0xD2, 0xBB, 0xB9, 0x30, 0xD1, 0xF9, 0x56, 0xAC, 0xCA, 0xCB, 0x70, 0x29, 0xD1, 0x9F, 0xF8, 0x7C,
-    0x21, 0xB7, 0x48, 0xEC, 0x85, 0x1C, 0xFC, 0xA1, 0x16, 0xAD, 0x1B, 0x67, 0x3E, 0x00, 0xB3, 0x96,
-    0x49, 0xA8, 0xDD, 0x2A, 0xE8, 0x43, 0x51, 0xD9, 0xDB, 0x3B, 0x89, 0xCD, 0x7E, 0xCA, 0x0A, 0xB2,
-    0xF1, 0x65, 0x9C, 0x4E, 0xC5, 0x90, 0xB3, 0x71, 0x03, 0xC1, 0x46, 0x70, 0xB7, 0x84, 0x5B, 0x62,
-    0x47, 0xB0, 0x24, 0x02, 0x49, 0x2B, 0xC4, 0x35, 0x31, 0x73, 0x4A, 0xAF, 0x2B, 0xF9, 0xFE, 0x82,
-    0x44, 0x2C, 0x3F, 0x25, 0x1B, 0x7F, 0xB7, 0x87, 0x56, 0xDD, 0x9D, 0x42, 0xAB, 0x6A, 0x36, 0x3B,
-    0x2D, 0x1B, 0x75, 0xC9, 0x8F, 0x40, 0xAC, 0xA3, 0x71, 0x47, 0x34, 0xA9, 0x47, 0xC4, 0x5D, 0x74,
-    0x12, 0x35, 0x66, 0x6D, 0x99, 0x02, 0xCF, 0x77, 0xA7, 0x99, 0xBC, 0x2B, 0x59, 0xB3, 0x20, 0x94,
-    0x3E, 0xBA, 0x4D, 0xAC, 0x99, 0x53, 0x62, 0x98, 0xA7, 0x54, 0x3E, 0xF5, 0xFE, 0xEC, 0xB4, 0x64,
-    0xBF, 0xFB, 0x30, 0x99, 0x96, 0xBD, 0xD5, 0x30, 0x5C, 0xDB, 0xD1, 0x07, 0x1C, 0x03, 0x96, 0x03,
-    0x58, 0xCE, 0xB5, 0xC0, 0xBF, 0xB7, 0x5F, 0xCF, 0x86, 0x70, 0x2B, 0xD8, 0x63, 0x2D, 0xCD, 0x6D,
-    0x7B, 0x98, 0xB2, 0x74, 0xD8, 0x79, 0xBF, 0xAF, 0xFE, 0x6C, 0x33, 0xFA, 0xB3, 0xF3, 0x21, 0xE7,
-    0x18, 0x8C, 0x71, 0xE6, 0x68, 0x14, 0x2B, 0xFB, 0xE4, 0xCF, 0x66, 0x43, 0x1E, 0xA3, 0x5F, 0x84,
-    0x61, 0x43, 0x21, 0x49, 0x69, 0x07, 0xBD, 0x3A, 0x40, 0x06, 0x28, 0x8E, 0x8E, 0x7A, 0xD5, 0x33,
-    0xFF, 0x33, 0xEA, 0x51, 0x0B, 0x7A, 0x19, 0x76, 0x28, 0xF9, 0xB7, 0x66, 0x81, 0xB6, 0x7B, 0x84,
-    0x46, 0xA0, 0x45, 0x40, 0x83, 0x80, 0xF6, 0x00, 0xCD, 0x01, 0x6B, 0x0D, 0x00, 0x5C, 0x5D, 0xD8,
-    0x1A, 0x5C, 0x02, 0x8B, 0x10, 0xB6, 0x82, 0x6C, 0xFF, 0x55, 0xB2, 0xFF, 0x57, 0xC9, 0x06, 0x60,
-    0x49, 0x1E, 0xC8, 0x17, 0x5C, 0xA4, 0xAD, 0x92, 0x3D, 0xC0, 0x4A, 0x36, 0x01, 0x2B, 0xD9, 0x05,
-    0xAC, 0x64, 0x1B, 0xB0, 0x92, 0x7D, 0xC0, 0x4A, 0x36, 0x02, 0x2B, 0xD9, 0x09, 0xAC, 0x64, 0x2B,
-    0xB0, 0x92, 0xBD, 0xC0, 0x4A, 0x36, 0x03, 0x9F, 0xE0, 0x6E, 0x60, 0xD3, 0x70, 0x3B, 0x30, 0xB0,
-    0x23, 0x2D, 0x2A, 0xFB, 0xDA, 0x21, 0x1F, 0x6C, 0xB7, 0x99, 0xD8, 0x82, 0xF4, 0xA8, 0xD7, 0xBC,
-    0xC7, 0x4E, 0xF3, 0x03, 0xB3, 0x1C, 0x16, 0x69, 0xDC, 0xD0, 0x36, 0x8D, 0xA5, 0x63, 0xB1, 0x76,
-    0x6E, 0x00, 0xA7, 0x93, 0x3F, 0x03, 0xAF, 0x3F, 0xF2, 0x25, 0xF0, 0xE3, 0x1F, 0x7C, 0x42, 0xFC,
-    0xE9, 0xFB, 0xC0, 0x8F, 0x9A, 0x57, 0x80, 0x1F, 0x31, 0x9E, 0xC5, 0xDD, 0xE9, 0xF8, 0x38, 0x7A,
-    0x51, 0xC6, 0x49, 0xD3, 0x97, 0x00, 0x04, 0xF9, 0x22, 0xF0, 0x29, 0xAC, 0xA3, 0x7A, 0xA7, 0x76,
-    0xAF, 0x9A, 0x43, 0x14, 0x47, 0x4B, 0xB5, 0xA1, 0xCF, 0x17, 0xB6, 0x22, 0x86, 0x49, 0xE8, 0xFE,
-    0xE7, 0x9E, 0x7D, 0x6B, 0x82, 0x93, 0x1C, 0x56, 0x7E, 0xB9, 0xA9, 0xBC, 0xAB, 0xAC, 0x79, 0xA9,
-    0x47, 0x05, 0xE0, 0xE8, 0x42, 0x4A, 0x8F, 0x98, 0xB7, 0xF8, 0xAE, 0xEA, 0xAB, 0xBD, 0x4F, 0x4A,
-    0xCC, 0x01, 0xEE, 0x83, 0x91, 0x9D, 0xA8, 0x46, 0x22, 0x49, 0xF8, 0xFD, 0x8A, 0x71, 0x48, 0x50,
-    0x4C, 0x1B, 0xD9, 0xDE, 0xFE, 0xC4, 0xC7, 0x5C, 0x6C, 0x72, 0x72, 0x04, 0xDD, 0xB7, 0x72, 0xCF,
-    0x87, 0xE1, 0x65, 0x6F, 0xAB, 0xE0, 0xC3, 0x46, 0x40, 0xF2, 0x91, 0x77, 0x3B, 0x04, 0x25, 0xB5,
-    0x6D, 0xAE, 0xE0, 0x89, 0x60, 0xFF, 0x9B, 0x6E, 0xBA, 0xA6, 0x6C, 0x90, 0x3D, 0x7C, 0x47, 0x94,
-    0xAF, 0xE0, 0xF4, 0xB8, 0x7C, 0x6B, 0x84, 0x08, 0x62, 0xEE, 0x0D, 0xA8, 0xDC, 0xEE, 0x64, 0x37,
-    0x65, 0x81, 0x69, 0xAB, 0x6C, 0x39, 0x92, 0xED, 0x3B, 0x98, 0x87, 0x4A, 0x0B, 0x53, 0x8E, 0xD6,
-    0xC0, 0xD2, 0x34, 0x46, 0x29, 0xBE, 0xA1, 0x96, 0xB3, 0x74, 0x03, 0x3D, 0xBD, 0x61, 0x47, 0x89,
-    0xDE, 0xAD, 0x30, 0x73, 0x2D, 0xA1, 0x02, 0xCC, 0xCD, 0xD4, 0x4C, 0xD3, 0x3C, 0x94, 0xE2, 0xBA,
-    0xF8, 0x3A, 0xB1, 0x4E, 0xAC, 0xA1, 0x2B, 0xE1, 0x42, 0xC7, 0xE4, 0x8E, 0xD2, 0xBF, 0x37, 0xD7,
-    0xCF, 0xA3, 0xFF, 0xEF, 0xE3, 0xD9, 0xB0, 0x53, 0x63, 0x01, 0xE8, 0x7D, 0xCE, 0x5A, 0x3A, 0xA9,
-    0xE2, 0xF3, 0x15, 0xAC, 0x76, 0xE7, 0xAC, 0xDD, 0x97, 0x3E, 0xDF, 0xC3, 0x17, 0x3E, 0xD0, 0x5A,
-    0x08, 0x7A, 0x22, 0x99, 0x2C, 0x11, 0xC9, 0xB6, 0x3D, 0x55, 0x09, 0xA3, 0x3B, 0xDA, 0x6E, 0x12,
-    0xC8, 0xA5, 0xA7, 0x7D, 0x6C, 0x1D, 0x63, 0x56, 0x11, 0x7A, 0xC8, 0x99, 0x77, 0xC6, 0xDE, 0x71,
-    0x89, 0xF8, 0x4F, 0xD4, 0xCB, 0x47, 0x18, 0xD8, 0x1B, 0x7E, 0xA7, 0xEE, 0xEF, 0x33, 0x4A, 0x3A,
-    0x19, 0xF6, 0xCE, 0xC6, 0xF9, 0xB6, 0xAD, 0xCA, 0xA6, 0xAF, 0x84, 0x48, 0x6D, 0x4D, 0x62, 0x5C,
-    0x7A, 0x9D, 0xB5, 0x8B, 0xA4, 0x96, 0x67, 0x61, 0xB8, 0xAE, 0xCA, 0x5E, 0x8F, 0xB9, 0x94, 0x50,
-    0xFE, 0xD0, 0x19, 0x22, 0xFD, 0x2C, 0x86, 0xED, 0x37, 0x31, 0xCC, 0x4C, 0x46, 0xDD, 0x9D, 0xB2,
-    0x91, 0x2F, 0x3B, 0xA1, 0x16, 0x77, 0xA8, 0x78, 0x7D, 0xEE, 0x6F, 0x68, 0xC7, 0x91, 0xB7, 0x05,
-    0x1D, 0x5A, 0xF9, 0xCB, 0xF4, 0xD9, 0xCB, 0xE0, 0xD3, 0xBC, 0x5B, 0x0B, 0x38, 0xFD, 0xD7, 0x2D,
-    0xDD, 0xD5, 0x38, 0xD4, 0x73, 0xBE, 0x34, 0x2D, 0xDB, 0xE8, 0x71, 0x08, 0x45, 0x5A, 0x2D, 0x78,
-    0xF2, 0xAF, 0x6E, 0x8B, 0xBA, 0xF9, 0xAF, 0x25, 0xAA, 0xD0, 0x48, 0x1E, 0x57, 0x0A, 0x03, 0x17,
-    0xD5, 0x04, 0xF7, 0xC2, 0x0A, 0xF5, 0x4F, 0x61, 0x8A, 0xDF, 0xE3, 0x14, 0xCF, 0xC7, 0x29, 0xDE,
-    0xCF, 0x6F, 0x14, 0xC1, 0x12, 0x62, 0xF5, 0xF0, 0xB1, 0x8D, 0x7F, 0xAB, 0x0D, 0xA2, 0x2C, 0x4F,
-    0x1D, 0x60, 0x85, 0xE5, 0xA2, 0xAC, 0x96, 0xA1, 0xB3, 0x04, 0x6B, 0xC7, 0x91, 0xAF, 0xAC, 0x68,
-    0x6D, 0x26, 0x9D, 0xD2, 0xAD, 0xDF, 0x3B, 0x4D, 0x9D, 0xF7, 0x0B, 0x8C, 0x90, 0x13, 0xC0, 0xBD,
-    0xD5, 0x51, 0xEF, 0x05, 0x32, 0x70, 0xDB, 0xE7, 0x7F, 0xED, 0xC3, 0xC3, 0xFE, 0x08, 0xC9, 0x31,
-    0x28, 0xD9, 0xDE, 0x48, 0x07, 0xCA, 0x39, 0x67, 0xFA, 0xAF, 0x7B, 0xA0, 0x8E, 0xA7, 0xFE, 0x0C,
-    0xC5, 0xC4, 0xFA, 0x67, 0xA5, 0xD9, 0x5E, 0x92, 0xE2, 0x9D, 0x47, 0xD9, 0xBB, 0xD9, 0x8C, 0x02,
-    0x4B, 0x60, 0x3F, 0xBF, 0xD9, 0x64, 0x75, 0xF6, 0xA6, 0xCC, 0x6D, 0x1F, 0x7A, 0xDE, 0xFB, 0x1E,
-    0x8B, 0xB7, 0x1E, 0x20, 0x5D, 0x28, 0xA7, 0x8E, 0x95, 0x5A, 0x3B, 0xB0, 0xAF, 0x7D, 0xF4, 0xB2,
-    0xB7, 0x54, 0xF0, 0x5B, 0x2A, 0x98, 0x7A, 0x54, 0x30, 0x7B, 0xEE, 0xE7, 0x8F, 0x3D, 0xCE, 0x37,
-    0xCD, 0xC8, 0x94, 0x76, 0xC4, 0x7D, 0xCE, 0x2D, 0xEA, 0x60, 0x87, 0x2F, 0x25, 0xE1, 0x33, 0xA9,
-    0xFD, 0xEE, 0x11, 0xCD, 0xE0, 0x34, 0xC8, 0x2F, 0x5A, 0x42, 0xE9, 0x98, 0xCE, 0xC2, 0xCD, 0x3A,
-    0x0B, 0x6B, 0x77, 0xE7, 0x3A, 0x58, 0xB7, 0xF8, 0xB5, 0xB0, 0x19, 0x99, 0x6C, 0x64, 0xB1, 0x6D,
-    0xB5, 0xB1, 0xA9, 0xAD, 0x8D, 0x5D, 0xDE, 0x12, 0x5B, 0xB0, 0x32, 0x91, 0xB5, 0x65, 0x91, 0x6C,
-    0x8B, 0x5D, 0xEC, 0x19, 0xFF, 0xFF, 0x5E, 0xBB, 0x3B, 0xCC, 0x73, 0x7E, 0xBB, 0x79, 0xDE, 0xE7,
-    0x3E, 0x53, 0xA0, 0xDD, 0x6E, 0x9E, 0xBF, 0xCD, 0x38, 0xFC, 0x87, 0xE1, 0x90, 0xBE, 0x07, 0x93,
-    0xFA, 0xE5, 0x0A, 0xA6, 0x41, 0xB2, 0xEF, 0xDF, 0xA5, 0xE0, 0x1F, 0x2F, 0x55, 0xC8, 0xF6, 0xDF,
-    0x5B, 0xB4, 0x7F, 0x37, 0xDB, 0x24, 0x29, 0x27, 0x86, 0x74, 0xE6, 0xA0, 0xD6, 0xEE, 0xF5, 0x17,
-    0xBD, 0xF0, 0x95, 0x76, 0x4F, 0xD7, 0x3D, 0xD9, 0x56, 0xA5, 0xDE, 0xFE, 0x01, 0xAD, 0x01, 0xDA,
-    0xF8, 0x82, 0x46, 0x6B, 0xE0, 0x5E, 0x8F, 0x8B, 0xEF, 0xE5, 0x1B, 0x09, 0xFD, 0x4B, 0xF7, 0x7D,
-    0x6C, 0xB6, 0x7A, 0xF6, 0x1A, 0x0D, 0xD5, 0x2F, 0x98, 0xBF, 0x78, 0x15, 0xFD, 0xF8, 0x59, 0xF0,
-    0x17, 0x1A, 0xA0, 0x2D, 0x2B, 0x2F, 0xD5, 0x66, 0x9C, 0x39, 0xF5, 0x05, 0x35, 0x29, 0xFA, 0x2D,
-    0xF7, 0x6A, 0xF5, 0xB4, 0xD5, 0xF8, 0xDC, 0x1B, 0x1B, 0x49, 0xA4, 0x95, 0x85, 0x2A, 0xAC, 0x2A,
-    0x9F, 0xCC, 0x3B, 0xE5, 0x5E, 0xDB, 0x96, 0x25, 0x89, 0x6D, 0x54, 0x60, 0x48, 0xB9, 0xD1, 0x4A,
-    0x62, 0x3F, 0x98, 0x90, 0x61, 0xF5, 0x84, 0x7A, 0xEB, 0xC7, 0xCA, 0x85, 0x5E, 0x70, 0x97, 0x74,
-    0xC3, 0x7E, 0x7D, 0xBB, 0xCD, 0x04, 0xCE, 0x87, 0xFF, 0x59, 0x03, 0x3F, 0x6A, 0xE1, 0x7C, 0xEC,
-    0x75, 0xE3, 0xB7, 0xE6, 0x3E, 0xE5, 0x8E, 0x9F, 0xDB, 0x7E, 0x6B, 0xDC, 0x09, 0xD9, 0xF4, 0x6D,
-    0xCD, 0xFD, 0xED, 0x3B, 0x5C, 0xA1, 0xFB, 0x4F, 0xC3, 0x62, 0xE4, 0xE7, 0x56, 0xF5, 0x57, 0x97,
-    0x99, 0x80, 0x63, 0x0E, 0x2E, 0xDD, 0xFA, 0xF9, 0x81, 0xCB, 0x59, 0x7C, 0x8C, 0x53, 0xFA, 0x28,
-    0xE6, 0x74, 0xC5, 0x49, 0xC6, 0x9D, 0x05, 0xF7, 0xE8, 0x3B, 0x66, 0x96, 0xFD, 0xC5, 0x60, 0xD9,
-    0x5F, 0xDC, 0x9F, 0xBD, 0xE1, 0x77, 0x55, 0x66, 0x26, 0x15, 0x1E, 0x16, 0x16, 0x27, 0xCB, 0x3E,
-    0x02, 0x92, 0x4B, 0x29, 0xAE, 0x14, 0x3E, 0xDD, 0xB6, 0x04, 0xED, 0x7A, 0x12, 0x32, 0x7F, 0x97,
-    0x31, 0x5A, 0x80, 0x0F, 0x68, 0xCF, 0xE0, 0x43, 0x17, 0x3F, 0xCD, 0xB9, 0x31, 0xA1, 0x98, 0x30,
-    0x81, 0x07, 0xC3, 0xDB, 0x26, 0xF0, 0x5A, 0x5B, 0x1B, 0x32, 0x7C, 0xED, 0xA3, 0xB0, 0x94, 0x70,
-    0x53, 0x38, 0x26, 0xF0, 0xE8, 0x32, 0x38, 0x9D, 0x24, 0xF0, 0xA2, 0x92, 0x35, 0x57, 0x57, 0x93,
-    0xB0, 0x62, 0x90, 0xA2, 0x80, 0xED, 0xCF, 0x62, 0x91, 0x72, 0x0C, 0x58, 0x95, 0x36, 0xFA, 0x2D,
-    0xDD, 0xB6, 0xBB, 0x03, 0xFA, 0x2D, 0xD4, 0xB0, 0x60, 0x98, 0xC5, 0x8B, 0x8B, 0x60, 0xB7, 0x2F,
-    0x48, 0x80, 0x2E, 0xF2, 0x6D, 0x16, 0xEF, 0x7F, 0x71, 0x6F, 0xAB, 0x33, 0x71, 0xE1, 0x07, 0x68,
-    0x6C, 0xA7, 0x18, 0x2A, 0x3D, 0xB8, 0x71, 0x07, 0x83, 0x39, 0xA2, 0xCD, 0x19, 0xEA, 0xC1, 0xD6,
-    0xA2, 0xC3, 0x1A, 0x4B, 0x2A, 0xB2, 0x7B, 0xCB, 0x60, 0xE6, 0xB0, 0x7A, 0x3D, 0xFA, 0x0A, 0xFC,
-    0xE6, 0x2B, 0x0C, 0x26, 0xD9, 0xA9, 0xA7, 0xAB, 0xA6, 0x4D, 0x06, 0x0B, 0xF7, 0x88, 0xE9, 0xB2,
-    0xA5, 0x9E, 0x32, 0x02, 0x2C, 0x5F, 0xE5, 0xF0, 0x7F, 0xC5, 0x5A, 0xBF, 0x93, 0xD4, 0x46, 0x16,
-    0x7E, 0x92, 0xD8, 0x55, 0x19, 0xD5, 0x59, 0x04, 0xB8, 0x5C, 0xC6, 0x67, 0x94, 0x38, 0xB8, 0x23,
-    0x40, 0xFF, 0x00, 0xAC, 0x44, 0xEC, 0x2A, 0x9B, 0xC0, 0x1C, 0x01, 0x55, 0x47, 0x70, 0x89, 0xCB,
-    0x09, 0x89, 0x03, 0x07, 0x2C, 0xD2, 0xD5, 0x05, 0x17, 0x6C, 0xC0, 0x96, 0x13, 0xA7, 0x04, 0x04,
-    0x36, 0x09, 0x09, 0xC1, 0x06, 0x60, 0x29, 0x23, 0x70, 0xD2, 0x76, 0x95, 0x2F, 0x9E, 0xA2, 0xB8,
-    0x4B, 0x08, 0x56, 0xBE, 0x12, 0x65, 0x2D, 0xA7, 0x51, 0xFB, 0xFB, 0xBA, 0xA5, 0x61, 0x60, 0x0F,
-    0x63, 0x76, 0x46, 0x33, 0xB3, 0xEA, 0x66, 0xA6, 0xA5, 0xE9, 0xF7, 0xBE, 0xF7, 0x5E, 0xBF, 0x5F,
-    0x83, 0x84, 0xAD, 0x88, 0x84, 0x53, 0x4C, 0xB1, 0xC6, 0x94, 0x14, 0x98, 0xB2, 0x24, 0x17, 0x29,
-    0xE2, 0x52, 0xA4, 0x8B, 0x4A, 0x71, 0xA6, 0xE1, 0x44, 0xDC, 0x36, 0xAC, 0xC4, 0x6B, 0xFD, 0x5A,
-    0xFC, 0x83, 0x2B, 0x8D, 0x04, 0x5A, 0xB7, 0x12, 0x6A, 0x3D, 0x95, 0x48, 0xEB, 0x4E, 0x12, 0x25,
-    0x5A, 0x92, 0x52, 0x8A, 0x34, 0xCB, 0x25, 0x2B, 0x75, 0xCA, 0x0F, 0xF6, 0x95, 0x62, 0x78, 0x35,
-    0x26, 0xBF, 0x19, 0xDE, 0x71, 0xCD, 0x29, 0x14, 0xBE, 0xCA, 0x3D, 0x3A, 0x79, 0x4B, 0x48, 0x19,
-    0x84, 0xFF, 0xA2, 0xB9, 0xA7, 0x24, 0x9D, 0x16, 0x9D, 0x16, 0x58, 0xE5, 0xC0, 0xDF, 0x13, 0x2D,
-    0x99, 0xCE, 0x24, 0x9A, 0xC6, 0x76, 0xCF, 0x63, 0xE4, 0x11, 0x9B, 0x14, 0x60, 0x33, 0xEB, 0x3F,
-    0x1F, 0xBF, 0x45, 0x1C, 0x04, 0xB3, 0xF1, 0x80, 0xCF, 0x6C, 0x63, 0xB8, 0xFC, 0xE8, 0x4D, 0x7A,
-    0x4E, 0x64, 0x3C, 0xA8, 0x77, 0xB0, 0x93, 0xC6, 0x1E, 0x57, 0x95, 0x48, 0x80, 0xC1, 0x4D, 0xCF,
-    0x5B, 0xA2, 0x0B, 0x01, 0x05, 0x18, 0xCA, 0x0F, 0x9F, 0x82, 0xF6, 0xBA, 0x48, 0xD4, 0x5D, 0x14,
-    0xD9, 0x8A, 0xB0, 0x74, 0xDB, 0xCD, 0x47, 0x07, 0x25, 0x02, 0x6A, 0x5E, 0x25, 0xC5, 0x4E, 0xE9,
-    0xEA, 0x9F, 0xC4, 0x7F, 0x54, 0x49, 0x98, 0x7E, 0xB9, 0x30, 0xA8, 0x93, 0x9C, 0x12, 0x4E, 0xC1,
-    0x0E, 0x78, 0x77, 0xAE, 0x76, 0xB2, 0x3A, 0x50, 0x27, 0x7B, 0xDA, 0xE1, 0x47, 0x0D, 0x28, 0x83,
-    0xC0, 0x56, 0x9C, 0x4A, 0xED, 0x5B, 0x63, 0x7D, 0x7F, 0x2A, 0x8E, 0x86, 0x1A, 0xB5, 0x9E, 0xC8,
-    0x2E, 0x76, 0x96, 0xA0, 0x92, 0x8D, 0x6B, 0x15, 0x3E, 0x57, 0x9E, 0xDE, 0xAF, 0xC2, 0x3A, 0xA8,
-    0xC2, 0x8A, 0x03, 0x7F, 0x5D, 0x51, 0xF9, 0xFA, 0x97, 0xCA, 0xD1, 0x3F, 0x56, 0x3D, 0xCF, 0x34,
-    0x6F, 0xF9, 0x8E, 0xD3, 0x69, 0xAA, 0x6B, 0x8F, 0xEA, 0x3A, 0xB1, 0x4A, 0x75, 0xBD, 0x8D, 0x5D,
-    0x42, 0x18, 0x9F, 0xA3, 0xA0, 0xB2, 0xDC, 0xD1, 0xFF, 0x12, 0xCF, 0xA8, 0xEC, 0xFA, 0xE2, 0x76,
-    0xE8, 0x08, 0x90, 0x44, 0x4F, 0x71, 0x92, 0xCE, 0x63, 0x1B, 0xF9, 0x70, 0x93, 0x6B, 0x04, 0xE1,
-    0x73, 0xA3, 0x68, 0x07, 0xD4, 0xFF, 0xE4, 0xDC, 0x5A, 0x81, 0x45, 0x8A, 0xD3, 0xFD, 0x55, 0xBC,
-    0xFD, 0x56, 0xDC, 0x0B, 0x20, 0x77, 0x8A, 0xE7, 0xBF, 0x12, 0xE7, 0xA0, 0x11, 0xAF, 0x3C, 0xBB,
-    0x8C, 0xE3, 0x46, 0xAB, 0x24, 0xFB, 0x11, 0xBF, 0x99, 0xC5, 0xD8, 0xBF, 0xF1, 0xD5, 0x2A, 0x70,
-    0xBD, 0xDA, 0x53, 0x9A, 0x17, 0xAC, 0xD2, 0x85, 0x55, 0xFA, 0x8F, 0x1A, 0x89, 0xF2, 0xED, 0xC5,
-    0x91, 0x1A, 0x0F, 0xCA, 0xAF, 0xA4, 0xCF, 0x3D, 0xA8, 0x7D, 0x99, 0xCD, 0x49, 0xFB, 0xDE, 0x57,
-    0x60, 0x6C, 0xEB, 0x4A, 0x49, 0x61, 0xE0, 0x29, 0xF7, 0x1B, 0x59, 0x89, 0x1C, 0x28, 0xEE, 0x30,
-    0x95, 0xE0, 0xBD, 0x73, 0xE2, 0xFF, 0x70, 0x5F, 0x3C, 0x8D, 0xF3, 0x75, 0x2D, 0x5F, 0x96, 0x6E,
-    0x49, 0xC3, 0x65, 0x40, 0xB8, 0xF7, 0xB7, 0xB5, 0xA0, 0xA3, 0x66, 0x11, 0x18, 0x82, 0xE3, 0x63,
-    0xA0, 0xF3, 0xE8, 0x8A, 0x1C, 0xE3, 0xA1, 0xEF, 0x71, 0xFC, 0x03, 0x34, 0xB7, 0xAF, 0x96, 0x3D,
-    0x92, 0xCD, 0xDB, 0xE3, 0x43, 0xDC, 0xA2, 0x17, 0x85, 0x38, 0x03, 0xEC, 0xFF, 0xC7, 0x73, 0x12,
-    0xFC, 0xD0, 0x58, 0x88, 0xD9, 0x12, 0x20, 0x3A, 0x29, 0x7C, 0x50, 0xF8, 0x14, 0xBB, 0x9D, 0xA5,
-    0x0F, 0x3A, 0xB9, 0x09, 0x3A, 0xE7, 0x04, 0xBA, 0x8C, 0x2F, 0xD3, 0x64, 0x18, 0x7E, 0x9D, 0x6F,
-    0x57, 0xA3, 0xC5, 0xEE, 0x63, 0xF8, 0xA0, 0x29, 0x7C, 0xD0, 0x6D, 0xF1, 0xF2, 0x3F, 0x88, 0xF7,
-    0x78, 0x1B, 0x81, 0x03, 0x14, 0xE3, 0xDD, 0xC5, 0x61, 0x9E, 0xE0, 0x99, 0xDF, 0xA3, 0x8D, 0x66,
-    0x5A, 0x91, 0x7D, 0x30, 0xBD, 0x79, 0x20, 0xEB, 0xF5, 0x41, 0x1B, 0x70, 0x10, 0x61, 0xBA, 0x85,
-    0x8D, 0x5A, 0x28, 0xB4, 0x5E, 0x8E, 0xCD, 0x1E, 0xB3, 0x8F, 0xCF, 0xFB, 0xA0, 0x42, 0xD7, 0x5A,
-    0x37, 0xBC, 0x2E, 0x5D, 0xC4, 0x6E, 0xFD, 0xA5, 0xAB, 0xFE, 0x9A, 0x5F, 0xE4, 0x7A, 0x63, 0x2F,
-    0x31, 0xA9, 0x8A, 0x07, 0x5B, 0x6B, 0x39, 0xF3, 0x55, 0xEC, 0x1A, 0x5E, 0x63, 0xF2, 0x51, 0x02,
-    0x67, 0x9A, 0xE4, 0xC5, 0xA5, 0x2C, 0xD7, 0x08, 0xEF, 0x1C, 0x03, 0xD9, 0xA4, 0x74, 0x24, 0x7E,
-    0x76, 0xD7, 0xF0, 0xEB, 0xE8, 0xAE, 0x4F, 0xB9, 0x28, 0xD8, 0xB2, 0x1F, 0x16, 0x27, 0xCE, 0x4E,
-    0xD0, 0xC9, 0x46, 0xC6, 0xE4, 0x01, 0x71, 0xCF, 0x31, 0x31, 0xFF, 0x88, 0xCC, 0x7E, 0xCE, 0xC4,
-    0x15, 0xEA, 0xBD, 0x5C, 0xD9, 0x13, 0x1B, 0x41, 0xCB, 0x51, 0x2F, 0xFE, 0x05, 0xD8, 0x0E, 0xD4,
-    0x17, 0x49, 0x57, 0xDF, 0xD0, 0xD5, 0x17, 0xEF, 0xE7, 0x47, 0x66, 0xCE, 0xAD, 0x4F, 0x83, 0x81,
-    0x07, 0x12, 0x16, 0xAD, 0x7C, 0xB0, 0x39, 0x59, 0x98, 0x29, 0x9B, 0xBF, 0xC6, 0x26, 0x7B, 0x65,
-    0xF2, 0xCA, 0x64, 0x68, 0xC8, 0x85, 0xC0, 0x21, 0x09, 0xDB, 0x71, 0xE9, 0xA2, 0xB1, 0x9E, 0xD9,
-    0xD0, 0xD5, 0xF3, 0xF1, 0xF2, 0x3D, 0x73, 0xBF, 0x99, 0x0D, 0x9B, 0xA7, 0xBA, 0xB5, 0x14, 0x0F,
-    0x95, 0xA3, 0xFF, 0x2D, 0xDE, 0x7F, 0x6B, 0x09, 0xF2, 0xEB, 0x0B, 0xF3, 0xFE, 0xE9, 0x90, 0x2A,
-    0xDE, 0x6C, 0xC5, 0xB9, 0x86, 0xB5, 0x1B, 0x48, 0x15, 0x6F, 0x6F, 0x2E, 0x95, 0xF9, 0x59, 0x3A,
-    0x8A, 0x4C, 0xD8, 0x24, 0xC2, 0x09, 0x68, 0xEC, 0xF5, 0xE9, 0x68, 0x70, 0x40, 0x3A, 0xC8, 0xBD,
-    0x91, 0x7E, 0xB6, 0x41, 0xED, 0xD7, 0x5E, 0x13, 0x3C, 0xBD, 0xDC, 0x80, 0xC7, 0x96, 0x23, 0x60,
-    0x82, 0x8A, 0xA3, 0x08, 0xA3, 0x3F, 0xE1, 0xEA, 0x3B, 0x96, 0x5E, 0xA4, 0x27, 0xB3, 0x6C, 0x14,
-    0xB9, 0xE8, 0x69, 0xE4, 0xA1, 0xC8, 0x42, 0x21, 0x76, 0x2B, 0xF5, 0xA3, 0x9E, 0xAF, 0x00, 0x5F,
-    0x0E, 0xB0, 0xB3, 0x33, 0x91, 0xE2, 0x7B, 0xA4, 0x96, 0xFF, 0x59, 0x9A, 0x94, 0xE1, 0xD5, 0xE1,
-    0xD3, 0xE1, 0xD1, 0x4F, 0x6E, 0xF2, 0x64, 0x21, 0x9F, 0x0C, 0x77, 0x4A, 0x9B, 0x4B, 0x1E, 0xDD,
-    0x19, 0x88, 0xFE, 0x44, 0x5C, 0x3A, 0xE8, 0x14, 0x31, 0xEF, 0x14, 0x9C, 0x72, 0x02, 0x59, 0x35,
-    0x70, 0x0E, 0xEA, 0xF4, 0x12, 0x4C, 0x5A, 0xBC, 0x0E, 0x2B, 0x69, 0x7C, 0x53, 0x6D, 0xBB, 0x95,
-    0x2C, 0xD1, 0x69, 0xCD, 0x25, 0x7A, 0x01, 0x13, 0xBD, 0x74, 0x5B, 0xC6, 0x70, 0x66, 0x50, 0x24,
-    0xC2, 0xC8, 0x31, 0x04, 0x91, 0xFB, 0x86, 0xBE, 0xC9, 0x6F, 0x13, 0x5D, 0xE2, 0x8A, 0x75, 0x4A,
-    0x76, 0x5E, 0x77, 0x21, 0x65, 0xB2, 0xCF, 0x7F, 0x9E, 0x16, 0x93, 0xCB, 0x95, 0x57, 0x45, 0x8A,
-    0x1E, 0xEC, 0x0C, 0x18, 0x7B, 0xE5, 0xDF, 0x91, 0xF6, 0x37, 0x06, 0xC2, 0x32, 0x0C, 0xE1, 0x8C,
-    0xF6, 0x6E, 0x8A, 0xE1, 0x34, 0x2B, 0x93, 0xFC, 0xD4, 0x6B, 0xE8, 0x11, 0x79, 0x92, 0xF3, 0xC9,
-    0x21, 0xB5, 0x65, 0x24, 0xC5, 0x59, 0xAA, 0x19, 0x0D, 0x11, 0x08, 0x1B, 0x98, 0x5A, 0x32, 0x11,
-    0x9D, 0x43, 0x32, 0x59, 0x89, 0x40, 0x08, 0xD1, 0x62, 0x52, 0x90, 0x64, 0x3C, 0x37, 0x99, 0x1B,
-    0x78, 0x04, 0x13, 0x6C, 0x3F, 0x8F, 0x1A, 0x57, 0xDB, 0x0D, 0x5C, 0xA3, 0xC3, 0x6B, 0x7A, 0x28,
-    0xEC, 0xE8, 0x84, 0xAC, 0x22, 0xBD, 0x76, 0x78, 0x77, 0x48, 0x7B, 0xAA, 0xC8, 0xA1, 0x3D, 0x68,
-    0x2C, 0x56, 0x1A, 0x8E, 0x9F, 0xA3, 0x30, 0x94, 0x62, 0xD0, 0xC8, 0xCA, 0xF8, 0x99, 0x4E, 0x19,
-    0x4A, 0x1D, 0x5D, 0xCF, 0x69, 0x8F, 0x45, 0x0E, 0xB5, 0x97, 0xDA, 0x90, 0x69, 0x22, 0x73, 0x60,
-    0xD4, 0x9B, 0x0D, 0xA5, 0xB4, 0xA9, 0xC5, 0x9C, 0xA1, 0x12, 0x1D, 0x1B, 0xEA, 0xEF, 0x8D, 0x60,
-    0x6F, 0x8A, 0x76, 0xE8, 0x76, 0x40, 0xE3, 0xED, 0x36, 0x13, 0x73, 0x88, 0x34, 0x89, 0xF2, 0xF9,
-    0xF2, 0x79, 0x6C, 0x25, 0xD2, 0xEB, 0x23, 0x94, 0x64, 0xAF, 0x09, 0x25, 0x6F, 0x88, 0xEC, 0x1D,
-    0xB1, 0x4D, 0x1C, 0xE8, 0xED, 0xA1, 0x69, 0x79, 0x98, 0xDC, 0x8D, 0xC8, 0x3E, 0x5B, 0x11, 0xB2,
-    0x59, 0xA0, 0xF9, 0xE7, 0x10, 0x68, 0xA2, 0xFF, 0x1F, 0x68, 0xA6, 0x41, 0x83, 0x40, 0x83, 0xE0,
-    0xE2, 0x4E, 0xC3, 0xCA, 0x31, 0x83, 0xEF, 0x83, 0xDA, 0x6D, 0x91, 0x4F, 0xB6, 0xAE, 0xBE, 0x5B,
-    0x9B, 0xFE, 0x88, 0xA9, 0x9A, 0xCC, 0x6B, 0x8F, 0xD3, 0x5D, 0x4E, 0x6F, 0xB3, 0x78, 0xFE, 0x92,
-    0x8A, 0x3B, 0xB1, 0x72, 0xC5, 0x0D, 0x11, 0x0A, 0x05, 0x41, 0xF6, 0x10, 0x11, 0xEA, 0xD1, 0xD2,
-    0x94, 0xD7, 0x17, 0x1E, 0x07, 0x2F, 0x14, 0x1E, 0xE6, 0xC0, 0x79, 0x94, 0x41, 0xB8, 0x83, 0xB5,
-    0x3F, 0xCB, 0xAD, 0x55, 0x19, 0xA8, 0x0D, 0x6E, 0x4F, 0x70, 0x2B, 0x47, 0x70, 0x3B, 0xDE, 0x07,
-    0xB7, 0xF6, 0xBE, 0xB8, 0x2A, 0x5A, 0xC6, 0x11, 0xA4, 0x87, 0x21, 0xB8, 0xD0, 0xD8, 0x28, 0xAB,
-    0xC7, 0xBD, 0x59, 0x07, 0x75, 0x5D, 0x2E, 0xD4, 0xF8, 0x3A, 0x94, 0x36, 0x48, 0x70, 0xBC, 0x9F,
-    0x51, 0x6D, 0xE4, 0x37, 0xC6, 0x71, 0xAD, 0x03, 0x4C, 0x83, 0x97, 0x21, 0x55, 0x9C, 0x56, 0xE6,
-    0x5B, 0xC8, 0xC4, 0xA3, 0xF3, 0xC2, 0x08, 0xA1, 0x23, 0x08, 0x50, 0xA7, 0x18, 0x6A, 0x23, 0x07,
-    0x42, 0xE4, 0x65, 0x00, 0xB3, 0x39, 0x1D, 0x2B, 0xF3, 0x8D, 0xD9, 0x6C, 0x56, 0xEC, 0xDD, 0xFE,
-    0xA2, 0x40, 0xC4, 0x48, 0xC4, 0x8A, 0xA4, 0x97, 0xC9, 0x4B, 0x1A, 0x27, 0x0B, 0xD4, 0x09, 0xD3,
-    0x3D, 0x89, 0x78, 0x68, 0xB7, 0xE4, 0x4C, 0x6E, 0x01, 0x14, 0xBB, 0x59, 0x1A, 0xE8, 0xA9, 0xA6,
-    0x14, 0x5A, 0x8A, 0x01, 0x07, 0x80, 0x0A, 0x21, 0x78, 0xA1, 0x14, 0xEC, 0x54, 0x58, 0x36, 0x0C,
-    0x59, 0x40, 0xC6, 0xC3, 0xA9, 0xA9, 0xDA, 0x5E, 0x52, 0x7D, 0x9F, 0x2D, 0x08, 0x03, 0x2E, 0x5B,
-    0x25, 0xCD, 0xF3, 0x9E, 0xD0, 0x3A, 0xE1, 0xFB, 0x46, 0x0D, 0x5A, 0x7A, 0x9D, 0xA1, 0xD8, 0x19,
-    0x01, 0xBE, 0x6D, 0x90, 0x98, 0xE2, 0x5A, 0x36, 0x0A, 0xB3, 0xB4, 0x25, 0x33, 0x1B, 0x70, 0xAB,
-    0x75, 0x0A, 0x81, 0x21, 0x57, 0xD8, 0x0F, 0x90, 0x2B, 0xB4, 0x45, 0x9F, 0x13, 0x2B, 0x7E, 0x39,
-    0x3B, 0x86, 0x21, 0x44, 0x39, 0xC1, 0x66, 0xFF, 0xE3, 0xFC, 0x9D, 0xA1, 0x5A, 0x9D, 0x4D, 0xD7,
-    0x87, 0xDE, 0x69, 0x42, 0x76, 0x9A, 0x51, 0xCF, 0x84, 0x48, 0xEA, 0x25, 0x74, 0x1F, 0x8F, 0x63,
-    0xFC, 0xEB, 0x31, 0xEF, 0x8B, 0x32, 0xF3, 0x75, 0x5E, 0x2B, 0x87, 0xFC, 0xDE, 0x08, 0x50, 0x37,
-    0x66, 0xE7, 0xC8, 0x9C, 0x75, 0xF3, 0xCE, 0x36, 0x63, 0xBC, 0x46, 0x83, 0x89, 0x37, 0x18, 0x4D,
-    0x91, 0xFA, 0x4D, 0xA6, 0xA2, 0x2A, 0x41, 0x52, 0x80, 0xC2, 0x03, 0x91, 0x77, 0xFA, 0x4A, 0xFF,
-    0x7A, 0x26, 0x3D, 0xBE, 0x9B, 0xE5, 0x91, 0xFA, 0xAD, 0x91, 0xE4, 0xB1, 0x02, 0xE7, 0x0A, 0xFB,
-    0xA9, 0x48, 0xEF, 0x2B, 0x5F, 0xEF, 0xA8, 0x17, 0xF6, 0x9B, 0x2B, 0x64, 0xEC, 0x6F, 0x80, 0x38,
-    0x0A, 0x7E, 0x65, 0x7D, 0x34, 0x4F, 0xC4, 0x10, 0x04, 0x97, 0x89, 0xE5, 0x4C, 0x6A, 0x7E, 0x67,
-    0x90, 0x77, 0xFB, 0x84, 0x97, 0xBF, 0xB2, 0x84, 0xC3, 0xAD, 0x05, 0x30, 0xF5, 0xE6, 0xAD, 0x9F,
-    0x6B, 0x3D, 0x34, 0x91, 0x26, 0x4E, 0x67, 0x16, 0x49, 0x1C, 0xEC, 0x9F, 0x79, 0x6D, 0xC7, 0x19,
-    0xAA, 0xD7, 0xA6, 0xA5, 0x8A, 0xB9, 0x4B, 0xCD, 0xBA, 0xFC, 0xDE, 0xB9, 0xE1, 0x7E, 0xAC, 0x1E,
-    0x88, 0x91, 0x15, 0x1F, 0x7B, 0x05, 0xC4, 0x49, 0x16, 0xA6, 0x2F, 0x06, 0x01, 0x71, 0xBB, 0xA1,
-    0xD4, 0x20, 0x58, 0xB8, 0x19, 0xD3, 0x21, 0xF7, 0x1A, 0xE0, 0xFD, 0xBA, 0x06, 0xA8, 0xFD, 0x0A,
-    0x93, 0x46, 0xD0, 0x8F, 0x3A, 0x21, 0xC6, 0xC3, 0x13, 0xEC, 0x10, 0x85, 0x98, 0xA2, 0x1D, 0x2A,
-    0x12, 0x63, 0xA7, 0x70, 0x5F, 0xE1, 0x1C, 0x7F, 0xA4, 0x0E, 0x05, 0x36, 0xDB, 0x08, 0xEC, 0x5D,
-    0x9A, 0xF5, 0x6E, 0x6B, 0x85, 0x6F, 0x99, 0xD2, 0x33, 0x96, 0x7C, 0x35, 0x02, 0x7C, 0xDB, 0x14,
-    0x2F, 0x0C, 0x58, 0xBF, 0x9A, 0x35, 0xF0, 0x6D, 0x80, 0x9F, 0x15, 0x54, 0xEB, 0x11, 0x82, 0xF1,
-    0x3A, 0x34, 0x79, 0x63, 0xF3, 0x96, 0x31, 0x63, 0x9B, 0xE1, 0x18, 0x86, 0xF0, 0xC0, 0x4F, 0x99,
-    0x4D, 0xEF, 0x53, 0x10, 0xFB, 0xC6, 0xF0, 0x2E, 0xEC, 0xAD, 0x13, 0xFD, 0x5E, 0xD0, 0xB3, 0x13,
-    0x90, 0x9B, 0xC0, 0xA9, 0xC7, 0x31, 0xFE, 0xB5, 0x60, 0xB3, 0x79, 0xAE, 0xF5, 0xA0, 0xD6, 0x02,
-    0x93, 0x54, 0xE6, 0x7E, 0x01, 0x1C, 0x01, 0xEA, 0xAB, 0xE2, 0x8D, 0x15, 0x42, 0x6E, 0x1B, 0x08,
-    0xE6, 0x04, 0xDC, 0xEF, 0xE5, 0xE2, 0x4E, 0xB3, 0xD2, 0x6B, 0x63, 0x15, 0xD4, 0xFC, 0xB1, 0x3D,
-    0xA8, 0x63, 0xE5, 0xB5, 0x49, 0xE9, 0x4E, 0xE1, 0x25, 0x18, 0xCB, 0x0A, 0x40, 0x4E, 0x00, 0x95,
-    0x40, 0xC3, 0xDF, 0x18, 0x83, 0x73, 0x25, 0x45, 0x5A, 0x6F, 0x9F, 0xC3, 0xDD, 0x91, 0xCD, 0x5B,
-    0x45, 0x1A, 0x56, 0x09, 0x00, 0xC4, 0x65, 0x5C, 0xD2, 0x43, 0x87, 0x13, 0x84, 0xD7, 0x0A, 0xFA,
-    0x40, 0xE4, 0x77, 0x0F, 0x50, 0x24, 0x77, 0x14, 0x2B, 0x42, 0x66, 0x41, 0x61, 0x32, 0xB6, 0x28,
-    0xCB, 0x3E, 0x64, 0xC6, 0x3D, 0x93, 0xCE, 0xB2, 0x00, 0xE0, 0x4B, 0xE5, 0x97, 0xFD, 0x2E, 0xC3,
-    0xAB, 0x79, 0x96, 0x2D, 0xD7, 0x45, 0xF9, 0xFD, 0x3B, 0xF8, 0x0D, 0x55, 0xD2, 0x45, 0x93, 0xA4,
-    0xC1, 0xBF, 0xCA, 0xB1, 0xF2, 0x8E, 0x9B, 0x3E, 0xB3, 0x6D, 0xCC, 0xFF, 0x73, 0x90, 0xBE, 0x17,
-    0xB0, 0x34, 0x2C, 0x87, 0x62, 0xE6, 0x64, 0x16, 0x33, 0x97, 0x2D, 0x7F, 0xB9, 0xE1, 0x95, 0x8E,
-    0xDE, 0xCF, 0xBD, 0x27, 0x38, 0x07, 0xF9, 0xDE, 0x72, 0x71, 0xC0, 0x17, 0xD0, 0x15, 0xD0, 0x13,
-    0xC0, 0x11, 0x8C, 0xC2, 0xFF, 0xAF, 0xAD, 0x57, 0xBD, 0x6F, 0x1C, 0xC7, 0x15, 0x7F, 0xBB, 0x4B,
-    0x79, 0x0D, 0x6D, 0x31, 0x2C, 0x48, 0x27, 0xFE, 0xBC, 0x14, 0x2E, 0x18, 0xDA, 0xE0, 0xBA, 0x70,
-    0x00, 0x05, 0xA1, 0x34, 0x93, 0xB0, 0x70, 0x91, 0xC2, 0x57, 0x98, 0x4D, 0x5C, 0x24, 0x85, 0x0A,
-    0x0B, 0x29, 0x9C, 0x32, 0x85, 0x74, 0xB3, 0x32, 0x0B, 0x97, 0xE6, 0x3F, 0x10, 0x80, 0x40, 0x18,
-    0x20, 0x39, 0x20, 0x50, 0x0A, 0x17, 0x2A, 0x74, 0xDA, 0xA1, 0x54, 0xA8, 0x50, 0xE1, 0xB5, 0x5D,
-    0xA6, 0xF0, 0x3A, 0x1F, 0x55, 0x0A, 0x8D, 0xA1, 0x35, 0xB0, 0x96, 0x77, 0x77, 0xFC, 0x7B, 0xB3,
-    0x7B, 0xCC, 0x9D, 0x29, 0x50, 0xB4, 0xE1, 0xF9, 0xDA, 0xB9, 0x79, 0x6F, 0xE6, 0xCD, 0xFB, 0x9C,
-    0x77, 0x44, 0x91, 0xA2, 0x22, 0xB7, 0x07, 0xC5, 0x9F, 0xE9, 0xE0, 0xD4, 0xCA, 0x25, 0xA6, 0x17,
-    0x48, 0xD6, 0x2F, 0x6C, 0xC4, 0x1B, 0x74, 0x7A, 0xA5, 0xF5, 0xB7, 0x74, 0x8B, 0xDA, 0xCC, 0xBF,
-    0xBC, 0xDB, 0x39, 0xA7, 0xB8, 0x4F, 0xA7, 0x53, 0x85, 0x9F, 0xD2, 0x75, 0x68, 0x9B, 0xD3, 0xBF,
-    0x51, 0x5F, 0xA4, 0xE3, 0x32, 0xFF, 0x6C, 0x4E, 0xB9, 0xD0, 0x69, 0xB0, 0x5B, 0x51, 0xF1, 0x83,
-    0xB4, 0x77, 0xC2, 0xFD, 0xF5, 0xDD, 0xB7, 0xA4, 0x6B, 0x31, 0x7A, 0x5A, 0xED, 0xE6, 0xF4, 0xAF,
-    0x89, 0x11, 0x26, 0xCD, 0xA4, 0xD2, 0x94, 0xD3, 0x3A, 0x8D, 0x4C, 0x6A, 0xA4, 0x92, 0x34, 0xA1,
-    0x19, 0xAD, 0x91, 0x28, 0xE6, 0xBF, 0x2F, 0xE1, 0x57, 0x4E, 0x9A, 0xA4, 0x4A, 0xB3, 0x51, 0x26,
-    0x4C, 0xA0, 0x12, 0x53, 0x8B, 0xA3, 0x3A, 0xDD, 0xAB, 0xE4, 0x8E, 0xD5, 0x89, 0xCD, 0x45, 0xB9,
-    0x7E, 0x4E, 0x8D, 0xEE, 0xD4, 0xE9, 0xDD, 0x1A, 0x2B, 0x32, 0xB6, 0x93, 0xA4, 0x98, 0x09, 0xB3,
-    0x76, 0x8E, 0xC4, 0xC7, 0x8D, 0xF8, 0xA4, 0x61, 0x10, 0x90, 0x23, 0x80, 0x8A, 0xB5, 0x40, 0x01,
-    0x1F, 0xBB, 0xE4, 0x1B, 0x36, 0xDD, 0xB3, 0xA3, 0xF7, 0x2A, 0x61, 0xEA, 0x40, 0x8D, 0x03, 0x88,
-    0x0F, 0xAD, 0xF6, 0xAD, 0xA2, 0xDC, 0x55, 0x68, 0x57, 0xBE, 0x3A, 0xC4, 0x9C, 0x5B, 0xBD, 0xDC,
-    0x1A, 0x0A, 0xE6, 0x8D, 0x8E, 0xDB, 0x4D, 0xBA, 0xD2, 0x1E, 0xE6, 0xAE, 0x46, 0xC3, 0x7C, 0x71,
-    0xBD, 0x5F, 0xBC, 0xD2, 0x1D, 0x2E, 0xAE, 0x8F, 0x4A, 0x59, 0xE7, 0x8D, 0x43, 0xCD, 0x1B, 0x59,
-    0x9D, 0xDF, 0x1F, 0x33, 0x26, 0xE5, 0x8A, 0x72, 0x90, 0xEF, 0x28, 0xAF, 0x29, 0x2F, 0x20, 0x8A,
-    0xC1, 0x2C, 0xB6, 0x08, 0x8A, 0x55, 0x39, 0xAD, 0x60, 0x76, 0x8D, 0xF2, 0xCC, 0xF9, 0xAE, 0x55,
-    0x87, 0x95, 0x55, 0xAC, 0xDD, 0x0C, 0xCB, 0xFC, 0x7A, 0x17, 0x37, 0xF9, 0x75, 0x17, 0x37, 0x5A,
-    0xB5, 0x51, 0xCD, 0xEB, 0x6A, 0x0B, 0x68, 0x79, 0xA6, 0xD5, 0x0A, 0x8E, 0xC8, 0xAB, 0x03, 0x3A,
-    0x38, 0x83, 0x05, 0xEA, 0x9A, 0x36, 0x9E, 0x58, 0xD9, 0xD6, 0xEC, 0xBC, 0x9E, 0xA7, 0xD3, 0xAA,
-    0xC7, 0x2D, 0x0D, 0x71, 0x3D, 0x0B, 0x6E, 0x6E, 0xE9, 0x35, 0xAE, 0x67, 0xC1, 0xED, 0x4B, 0xDC,
-    0x52, 0x5C, 0xE0, 0x3B, 0x72, 0x24, 0x0C, 0x9B, 0xD7, 0x8D, 0x2C, 0xF5, 0xE6, 0x2F, 0x8C, 0x64,
-    0xF8, 0x25, 0x61, 0x66, 0xFE, 0x9B, 0x1C, 0xD5, 0xFD, 0xEF, 0xBB, 0xD6, 0x9B, 0xBC, 0xB8, 0xF7,
-    0x79, 0x4B, 0x69, 0x96, 0xDE, 0xF8, 0xE8, 0xBE, 0xCB, 0x9C, 0x15, 0x6E, 0xF4, 0xE6, 0x83, 0x3B,
-    0x8F, 0xEA, 0xB8, 0x95, 0xA3, 0x37, 0xFE, 0x6D, 0xA1, 0xA6, 0x59, 0xBA, 0xE3, 0xBF, 0x4D, 0xBA,
-    0xF3, 0xB0, 0xBC, 0x45, 0x61, 0xD5, 0x7F, 0xE3, 0x32, 0xF5, 0x70, 0x61, 0xC4, 0x47, 0x9F, 0x7E,
-    0x09, 0x5D, 0x66, 0x89, 0x3B, 0x72, 0x15, 0x49, 0x0A, 0xA1, 0x94, 0x82, 0x4E, 0x96, 0xF9, 0x15,
-    0x17, 0x6E, 0xE9, 0x2F, 0x6A, 0xFC, 0x45, 0x17, 0xEE, 0xDA, 0x4F, 0x67, 0xC3, 0x14, 0x96, 0xDC,
-    0x1C, 0xAF, 0xDE, 0xB1, 0xC7, 0xD3, 0x7B, 0x9F, 0x77, 0xB8, 0x77, 0x5C, 0xE3, 0x04, 0x5C, 0xDD,
-    0xB8, 0x2A, 0xED, 0x48, 0xB8, 0xDF, 0x7E, 0xF0, 0xE0, 0x93, 0xAE, 0x91, 0xB9, 0x62, 0x06, 0xDE,
-    0xC7, 0x05, 0x27, 0xA3, 0xCC, 0xF3, 0xF0, 0xD0, 0xCE, 0x66, 0x4C, 0xB3, 0x39, 0x9E, 0x7A, 0x4E,
-    0xFA, 0x69, 0x64, 0x47, 0x7B, 0x98, 0x4E, 0x30, 0x85, 0x47, 0xFE, 0xF3, 0x5F, 0x5F, 0x35, 0xF2,
-    0xDD, 0xCC, 0xB3, 0x64, 0x5C, 0x9D, 0x3A, 0x1A, 0xB8, 0x2A, 0x93, 0x66, 0x91, 0xA1, 0xB0, 0x8A,
-    0xAD, 0x30, 0xA3, 0x4C, 0xC2, 0x1C, 0x2F, 0xE3, 0x97, 0xA6, 0xD8, 0xB6, 0x24, 0x8E, 0x20, 0x8C,
-    0x3D, 0x4B, 0xF0, 0x34, 0xBA, 0x86, 0x03, 0x2F, 0x9F, 0x67, 0x4C, 0x9D, 0x14, 0x00, 0x8E, 0x0C,
-    0xA0, 0x52, 0x01, 0x3C, 0x61, 0x78, 0x03, 0x84, 0xA3, 0x0A, 0x18, 0xC1, 0x3E, 0x7C, 0x5E, 0x2A,
-    0x61, 0x92, 0x22, 0xB2, 0x70, 0xB6, 0xCB, 0x60, 0x9A, 0xE0, 0x9E, 0x24, 0xEE, 0x54, 0xC4, 0xFC,
-    0x47, 0xF6, 0x1A, 0x9C, 0x30, 0x25, 0x3E, 0x6D, 0x92, 0x7C, 0xDC, 0x30, 0xB0, 0x65, 0xA8, 0x64,
-    0xF0, 0x48, 0x01, 0x0E, 0x52, 0x55, 0x1A, 0x15, 0xFD, 0x69, 0x28, 0x96, 0x82, 0x8A, 0xA2, 0x86,
-    0xE2, 0xBF, 0x93, 0x10, 0xF4, 0x52, 0xA2, 0xB6, 0x23, 0x73, 0x35, 0x2C, 0xE0, 0x12, 0xB8, 0x2E,
-    0x75, 0x0C, 0x12, 0x96, 0x52, 0xD0, 0x31, 0x3C, 0x81, 0x20, 0x83, 0x96, 0xE8, 0x36, 0xD1, 0xCB,
-    0x14, 0x40, 0x43, 0x19, 0x83, 0xB0, 0x0E, 0x34, 0x72, 0xDC, 0xC2, 0x86, 0x92, 0x0A, 0x2E, 0x0B,
-    0xA1, 0x53, 0x38, 0x48, 0x60, 0x05, 0x4E, 0xAC, 0x52, 0x6A, 0x43, 0x2B, 0x4D, 0x9B, 0x58, 0x61,
-    0xDF, 0x49, 0x0D, 0x36, 0xE4, 0xC0, 0x07, 0x3A, 0xC9, 0xFB, 0x96, 0x7E, 0x2A, 0x9C, 0x39, 0xC8,
-    0x23, 0x17, 0x35, 0x79, 0x88, 0x61, 0x02, 0x2B, 0xA9, 0x29, 0xFD, 0x0C, 0x7A, 0xCC, 0xA3, 0x9A,
-    0x0F, 0xED, 0x28, 0xB1, 0xAB, 0x32, 0x4B, 0x4D, 0x23, 0x4A, 0x49, 0x5D, 0x64, 0x9F, 0xA6, 0x16,
-    0x6E, 0x02, 0x89, 0x92, 0xBE, 0xDE, 0xC1, 0xA3, 0x31, 0xEA, 0x5F, 0x76, 0xF0, 0x73, 0xDF, 0x5A,
-    0x89, 0x46, 0x7D, 0x6B, 0x24, 0x0D, 0x0A, 0x81, 0xF7, 0xE7, 0x8C, 0xEC, 0x80, 0xC0, 0x5E, 0x4F,
-    0x94, 0xB8, 0x0C, 0xE1, 0x4B, 0xBB, 0xE6, 0x17, 0x5F, 0x34, 0x91, 0x6D, 0x23, 0xDB, 0x44, 0x0F,
-    0x9B, 0xC8, 0xD9, 0xC8, 0x99, 0xA8, 0x63, 0xBA, 0x61, 0x3D, 0x30, 0x11, 0x7C, 0xC8, 0x4C, 0xA2,
-    0xF1, 0x95, 0x57, 0x69, 0x7D, 0x77, 0x77, 0x8C, 0x17, 0xA0, 0xE4, 0xCE, 0xE0, 0x3F, 0x10, 0x5D,
-    0xD8, 0x26, 0xFA, 0x87, 0x50, 0x51, 0x11, 0x3D, 0x42, 0x70, 0x7A, 0x17, 0xC1, 0xF0, 0x95, 0x43,
-    0x18, 0x04, 0x8C, 0x38, 0x8B, 0xCD, 0xAB, 0x10, 0x35, 0x70, 0x5E, 0x5F, 0x25, 0x4F, 0x97, 0x05,
-    0x0F, 0x29, 0x47, 0xB0, 0x24, 0x45, 0x82, 0xE8, 0x45, 0x22, 0xEC, 0xFE, 0xE3, 0x82, 0x3E, 0xFE,
-    0x34, 0xE8, 0xE3, 0xD5, 0xC8, 0x5C, 0x08, 0xD9, 0x21, 0x06, 0x4B, 0x1F, 0x3E, 0x57, 0xFD, 0xB8,
-    0x7F, 0xF5, 0x9C, 0x0F, 0x1A, 0xB7, 0xBB, 0xE1, 0x4D, 0xE3, 0xCF, 0x6F, 0xDC, 0x5F, 0xBC, 0xDD,
-    0x39, 0xEF, 0x30, 0xF1, 0x03, 0xEF, 0x42, 0xE2, 0x9E, 0xF7, 0x09, 0x36, 0x39, 0x38, 0x4B, 0x10,
-    0x28, 0x70, 0x31, 0x21, 0x1F, 0x61, 0x2F, 0xFA, 0xCF, 0xF8, 0xE2, 0x53, 0xB4, 0x7F, 0xEB, 0xC7,
-    0xF9, 0x6D, 0x47, 0xAE, 0x6B, 0x71, 0x54, 0xE0, 0x5C, 0xC7, 0x47, 0xBD, 0xED, 0x0E, 0x03, 0x97,
-    0x51, 0xE4, 0x28, 0xFA, 0xBA, 0xA0, 0xE4, 0x33, 0x23, 0x3E, 0xB5, 0x34, 0xBA, 0x5F, 0xB2, 0xD1,
-    0xA5, 0x3B, 0x65, 0xA0, 0x14, 0x85, 0x01, 0xAD, 0x8F, 0x73, 0x84, 0x67, 0xC4, 0x62, 0x70, 0x4B,
-    0xC4, 0xBE, 0x7A, 0xA9, 0x3F, 0x3D, 0xC0, 0x12, 0xAC, 0x15, 0x91, 0x80, 0xBC, 0x37, 0x33, 0x48,
-    0x0E, 0x7C, 0x7C, 0x0B, 0xC4, 0x3E, 0x38, 0x07, 0xC9, 0x5A, 0xD7, 0xFA, 0x50, 0xD3, 0x42, 0x1D,
-    0x6B, 0x5E, 0x1B, 0x2F, 0xAD, 0x1D, 0xEA, 0x1A, 0x98, 0x95, 0xAE, 0x7F, 0x5F, 0x87, 0x0B, 0xF5,
-    0x19, 0xC6, 0xAC, 0x7F, 0xB4, 0xB4, 0xF6, 0x8A, 0x5F, 0xEB, 0xA5, 0x07, 0xB5, 0x3F, 0xEF, 0x35,
-    0xEF, 0x9C, 0x85, 0xF2, 0x73, 0xD7, 0xFC, 0x3C, 0x6C, 0x2F, 0xB0, 0x11, 0xB7, 0xFE, 0xB5, 0x6A,
-    0x59, 0xCB, 0xAC, 0x85, 0x9A, 0x46, 0xB0, 0x7E, 0x4B, 0xDA, 0x50, 0x6E, 0x60, 0x84, 0x41, 0xC7,
-    0x70, 0x18, 0x05, 0xD8, 0x0A, 0xAB, 0xE5, 0xC8, 0xF5, 0xE1, 0xA0, 0x3A, 0x6E, 0xED, 0x60, 0x29,
-    0x30, 0x5E, 0xD6, 0xF7, 0xF8, 0x98, 0x6C, 0x5A, 0x80, 0x6A, 0x5A, 0x82, 0x68, 0x5A, 0x80, 0x26,
-    0xBC, 0x87, 0xDA, 0x51, 0x01, 0x8A, 0x18, 0xA2, 0x66, 0x64, 0x40, 0x0F, 0x83, 0xC6, 0x83, 0x0F,
-    0x6A, 0x78, 0xC3, 0x39, 0x74, 0x82, 0xD6, 0x3C, 0x0E, 0x0E, 0x84, 0x92, 0x0C, 0xC7, 0xA7, 0x05,
-    0xC8, 0xA4, 0x25, 0xA8, 0x60, 0xC7, 0x2A, 0xBB, 0xA3, 0x7F, 0x94, 0xB2, 0xBC, 0xA5, 0xFC, 0x7D,
-    0xE7, 0x32, 0xBD, 0xE7, 0x9C, 0xD1, 0xBF, 0xDA, 0x4F, 0x0B, 0x0D, 0x1B, 0x2B, 0x79, 0xE0, 0x99,
-    0x44, 0xB2, 0x10, 0x38, 0xE4, 0x0B, 0x88, 0xB4, 0x92, 0x7D, 0x57, 0xF2, 0xE9, 0xD2, 0x4B, 0xFF,
-    0xB8, 0x6C, 0x81, 0x04, 0x5E, 0x44, 0x5C, 0x2F, 0xCF, 0x64, 0x81, 0xE7, 0x13, 0x24, 0x56, 0x98,
-    0x04, 0xE7, 0x3A, 0x6C, 0x67, 0xBD, 0xAD, 0x21, 0x14, 0xF0, 0xCB, 0x1E, 0x41, 0x12, 0x89, 0xED,
-    0x95, 0x28, 0x71, 0x8C, 0xEE, 0x41, 0xEC, 0x29, 0x31, 0x40, 0xA2, 0xE4, 0x44, 0xA6, 0xE6, 0x8C,
-    0x49, 0x5D, 0xD4, 0xCE, 0x6C, 0x4B, 0x57, 0xA0, 0x97, 0xE8, 0x76, 0xE8, 0xE5, 0xD0, 0x79, 0x1D,
-    0xF0, 0x8E, 0xB6, 0x2F, 0x8E, 0x69, 0x1B, 0x2E, 0xF1, 0xA4, 0xEE, 0x5D, 0x73, 0x3A, 0xCD, 0x04,
-    0x78, 0x95, 0xBE, 0xDF, 0x35, 0x1A, 0x3D, 0xFF, 0x56, 0xE7, 0x35, 0xE9, 0xFE, 0x67, 0x18, 0x0F,
-    0x3E, 0x69, 0xA6, 0xD3, 0x7D, 0xF0, 0xD0, 0x7A, 0x3E, 0x2C, 0x84, 0x85, 0x6E, 0x1E, 0xD3, 0xB3,
-    0x47, 0x3E, 0x4F, 0xEC, 0x80, 0xF7, 0x1F, 0x30, 0x01, 0xDB, 0x45, 0x74, 0xE5, 0xFE, 0xF2, 0x28,
-    0x54, 0xD2, 0x41, 0x38, 0xC0, 0x79, 0x26, 0xFF, 0xAF, 0x22, 0x57, 0x50, 0xF8, 0x35, 0x02, 0xE4,
-    0x17, 0xB0, 0x9A, 0x12, 0x5A, 0x87, 0x5B, 0x6C, 0xB1, 0x32, 0x32, 0xA9, 0x96, 0xCD, 0x84, 0x13,
-    0x34, 0x99, 0x21, 0xC6, 0x9B, 0x84, 0x95, 0x7A, 0x5A, 0x8C, 0xF8, 0x9E, 0xE5, 0xB1, 0xB1, 0xE8,
-    0x3B, 0xDE, 0xBD, 0x7F, 0x3E, 0xBF, 0xF3, 0x1E, 0x1D, 0x56, 0x6E, 0xC7, 0xBA, 0xB8, 0x40, 0x26,
-    0xE1, 0x5F, 0x07, 0xEF, 0xD1, 0x33, 0x9F, 0x08, 0xD6, 0xEC, 0xEC, 0x68, 0x78, 0xB4, 0x18, 0xF8,
-    0x5E, 0x29, 0x93, 0x6A, 0x92, 0x54, 0xB3, 0x18, 0x96, 0xA3, 0x90, 0xBB, 0x7A, 0x07, 0xE9, 0x14,
-    0x6D, 0x73, 0x66, 0x3D, 0xAD, 0x67, 0xC1, 0x0D, 0xC4, 0x56, 0x64, 0x5A, 0x6F, 0x63, 0xED, 0xDC,
-    0x98, 0x02, 0x68, 0x2B, 0x29, 0x9E, 0xCF, 0x5E, 0xA4, 0xA0, 0x7C, 0x1D, 0x52, 0xFA, 0x09, 0x61,
-    0x0F, 0x27, 0x37, 0x08, 0x9F, 0xC9, 0x9B, 0x2F, 0x21, 0x32, 0x4D, 0x20, 0xC9, 0x9A, 0xD6, 0xDD,
-    0x97, 0x4A, 0x3B, 0x57, 0xB0, 0x35, 0x04, 0x48, 0x35, 0x62, 0xEC, 0x13, 0x1F, 0xA4, 0x14, 0x8A,
-    0xA7, 0x3D, 0x2E, 0x79, 0x52, 0x6E, 0xA1, 0xAF, 0x2D, 0x49, 0x6F, 0xCB, 0x3B, 0x11, 0x1E, 0x9E,
-    0x21, 0x1A, 0x2D, 0x17, 0x56, 0x4C, 0xB7, 0xB0, 0x77, 0x03, 0x61, 0x60, 0x22, 0xEE, 0xE2, 0x8D,
-    0x6F, 0xE4, 0xAF, 0x11, 0x13, 0x6B, 0x8D, 0xB7, 0x7E, 0xCF, 0x36, 0xA9, 0x92, 0xC9, 0x51, 0x75,
-    0x09, 0x4F, 0xF7, 0x9E, 0xBD, 0x85, 0xD7, 0x36, 0xCC, 0x0E, 0xE7, 0x94, 0xDC, 0xF2, 0xB0, 0x76,
-    0x82, 0x06, 0xDF, 0xE0, 0x26, 0xAE, 0x10, 0xB5, 0x39, 0x0F, 0xB2, 0x77, 0xB2, 0xC7, 0x5C, 0x84,
-    0xBA, 0xE5, 0xA3, 0x36, 0xF8, 0xAD, 0x45, 0xB4, 0x81, 0x97, 0x87, 0x8D, 0xDF, 0xEB, 0x67, 0xCF,
-    0x62, 0xED, 0x77, 0x27, 0x0E, 0xB8, 0xB6, 0xBC, 0x77, 0x76, 0x02, 0x81, 0x8F, 0x5A, 0x5D, 0x38,
-    0x2A, 0x1B, 0x8E, 0xBA, 0xCC, 0x86, 0xC1, 0xD9, 0xB2, 0x7C, 0xAC, 0xF5, 0xCD, 0xAD, 0x1E, 0xDB,
-    0x9F, 0x82, 0x08, 0x91, 0x0A, 0x70, 0x0C, 0xF5, 0x41, 0x20, 0x58, 0x76, 0x85, 0x4D, 0x0A, 0x0E,
-    0x34, 0x22, 0x59, 0x9E, 0x71, 0x26, 0xCE, 0x89, 0xF8, 0x3C, 0x50, 0x0E, 0x25, 0x59, 0xDC, 0x8F,
-    0x48, 0xE9, 0x43, 0xDC, 0x73, 0xBD, 0x69, 0x12, 0x87, 0x1D, 0x89, 0xC8, 0x93, 0xD4, 0x32, 0x6E,
-    0x86, 0x11, 0x19, 0x86, 0x8F, 0xCA, 0xF2, 0x18, 0x67, 0x7D, 0x57, 0xEF, 0xEE, 0xF6, 0xFF, 0xD5,
-    0x54, 0x3F, 0xF6, 0x2B, 0x8B, 0x38, 0x61, 0x29, 0xC3, 0x12, 0xB1, 0xFE, 0xFF, 0xE7, 0xF0, 0xC9,
-    0x6C, 0xD3, 0x92, 0x14, 0xCD, 0x5D, 0x40, 0x67, 0xFA, 0xD8, 0x97, 0x57, 0x20, 0x01, 0x6D, 0x74,
-    0xB6, 0x35, 0x5C, 0xF4, 0x39, 0xCF, 0xB3, 0x56, 0xE7, 0x00, 0xD1, 0x8A, 0x67, 0xCF, 0x9E, 0x9C,
-    0x65, 0x8B, 0x33, 0xD8, 0x57, 0xD9, 0x67, 0xE7, 0x67, 0xFA, 0x57, 0x60, 0xCD, 0x6B, 0x5C, 0xCF,
-    0xF4, 0xAF, 0xA0, 0x94, 0x66, 0xA4, 0x04, 0x9D, 0xA7, 0x27, 0xE3, 0xE2, 0x8F, 0x1F, 0x12, 0x35,
-    0x69, 0xE6, 0x77, 0x39, 0x0D, 0x57, 0xD0, 0xCF, 0xCC, 0xC1, 0xC1, 0x66, 0x76, 0x96, 0x73, 0x6F,
-    0xD3, 0x59, 0x79, 0xFB, 0x06, 0xED, 0x53, 0xB1, 0x8E, 0xD3, 0x40, 0x10, 0x7D, 0xBE, 0x70, 0xB6,
-    0x84, 0x8B, 0xA5, 0x20, 0x08, 0xE9, 0x8A, 0x6D, 0x68, 0xA0, 0xB8, 0xFD, 0x81, 0xB3, 0x77, 0xEE,
-    0x0B, 0x70, 0x11, 0x2A, 0x9A, 0x14, 0x47, 0x73, 0x4D, 0x6A, 0xA4, 0x24, 0x5E, 0x89, 0x0F, 0x20,
-    0x9F, 0x40, 0x41, 0x81, 0x68, 0x22, 0x9D, 0x84, 0x14, 0xC4, 0x05, 0xFB, 0x13, 0xFC, 0x09, 0x57,
-    0x40, 0x9F, 0x22, 0xC5, 0xC2, 0xAD, 0xB3, 0xCC, 0xC6, 0x51, 0x82, 0x40, 0x48, 0x88, 0x9A, 0x9D,
-    0x67, 0x6B, 0x76, 0x76, 0xC6, 0x33, 0xF3, 0x66, 0x8D, 0x02, 0xA2, 0x85, 0xF2, 0xD0, 0x23, 0x33,
-    0x15, 0xF5, 0x1E, 0x5A, 0x1A, 0xED, 0x49, 0x7A, 0x1C, 0x59, 0x0C, 0xED, 0xB0, 0xB0, 0xDD, 0x5A,
-    0x80, 0x57, 0x85, 0xC8, 0xA3, 0xE7, 0x91, 0x56, 0x10, 0x1A, 0x99, 0xC6, 0xB2, 0xA4, 0xCA, 0x37,
-    0x97, 0x95, 0x81, 0x06, 0x1E, 0xB3, 0x47, 0xE9, 0x4A, 0xB7, 0xC0, 0x47, 0xAA, 0xEC, 0x65, 0x8B,
-    0x1C, 0xF9, 0xD7, 0xA5, 0x77, 0xA3, 0x19, 0xFA, 0x21, 0x4A, 0x70, 0x2E, 0x42, 0x7E, 0x0F, 0x53,
-    0x8F, 0x72, 0x6E, 0x26, 0xA2, 0x66, 0x70, 0xF6, 0x2E, 0x57, 0x08, 0xF6, 0x35, 0x03, 0xC2, 0x40,
-    0x81, 0x83, 0x71, 0x0D, 0x38, 0x1C, 0xAD, 0xD1, 0x5B, 0x21, 0x6D, 0x70, 0xD7, 0x00, 0x5C, 0xF3,
-    0x06, 0xBA, 0xA2, 0x5C, 0x18, 0x2D, 0x89, 0xEB, 0x97, 0x1B, 0xE4, 0xCA, 0x8C, 0xD3, 0x7A, 0x2A,
-    0x6B, 0x2E, 0x3B, 0xB6, 0x5B, 0x9F, 0x16, 0xDA, 0x63, 0x22, 0x42, 0x8A, 0xAD, 0xBD, 0x4E, 0x5F,
-    0x1B, 0x48, 0xEA, 0x57, 0x50, 0x1C, 0xF2, 0x06, 0xD1, 0x0C, 0x47, 0x4D, 0x00, 0xBB, 0x31, 0x3A,
-    0x9D, 0x8D, 0xDD, 0xB6, 0xFF, 0x6C, 0xF7, 0xDE, 0x2B, 0xB1, 0x11, 0xA4, 0x90, 0xE1, 0x0C, 0xE3,
-    0xBD, 0x9C, 0x71, 0x85, 0x12, 0x82, 0x22, 0xBA, 0x60, 0xFD, 0x34, 0xE8, 0xBC, 0xDB, 0x0B, 0xEF,
-    0x33, 0xF6, 0x2A, 0x50, 0x5C, 0xE0, 0xD6, 0x63, 0x33, 0x22, 0x27, 0xC8, 0xFE, 0x84, 0x85, 0x20,
-    0xFC, 0xC5, 0x08, 0x80, 0xC8, 0x25, 0x4E, 0xB9, 0x53, 0x77, 0xC7, 0xE1, 0x20, 0xEF, 0x38, 0x56,
-    0x6E, 0xDB, 0x7C, 0xC8, 0x9C, 0x32, 0xF9, 0x25, 0xFB, 0x21, 0x59, 0x41, 0xD6, 0x6C, 0xA4, 0xD2,
-    0x9B, 0x27, 0xEF, 0xC3, 0xF7, 0xD5, 0xD6, 0xE7, 0xBE, 0x24, 0xAE, 0x27, 0x69, 0x91, 0x6C, 0xC0,
-    0x3C, 0x30, 0xC3, 0x2F, 0x47, 0xA6, 0xF4, 0x38, 0xF9, 0x82, 0xFF, 0x63, 0xFD, 0xB7, 0xB1, 0xA6,
-    0x2D, 0x44, 0x05, 0x6E, 0x2A, 0x9E, 0x1B, 0x1D, 0xBA, 0x36, 0x13, 0x9E, 0xDA, 0xAD, 0x89, 0xCF,
-    0x11, 0x7F, 0x83, 0xF4, 0x94, 0xA7, 0xB5, 0x9E, 0x87, 0x22, 0x33, 0x40, 0x9D, 0x93, 0xF0, 0x14,
-    0xBD, 0x40, 0xDC, 0xEE, 0x8E, 0xB2, 0x5E, 0x13, 0x90, 0xD4, 0xEA, 0x69, 0xCD, 0x04, 0x46, 0x6F,
-    0x31, 0x4E, 0xB7, 0xBD, 0x7F, 0x46, 0xE2, 0xD0, 0xB3, 0x10, 0x0E, 0x4A, 0x85, 0x66, 0x07, 0x11,
-    0x9D, 0xD8, 0x50, 0x30, 0xE7, 0xEA, 0x3F, 0x0F, 0x4C, 0x66, 0xA2, 0xCE, 0x25, 0x31, 0x45, 0xDC,
-    0x1A, 0x13, 0xD3, 0xE1, 0xBB, 0x83, 0xF7, 0x70, 0xF2, 0xD7, 0x6B, 0x36, 0x38, 0x06, 0xFF, 0xBA,
-    0x3B, 0xF0, 0xAD, 0xCB, 0xB1, 0xB0, 0xF8, 0x74, 0x83, 0x6A, 0x85, 0xA5, 0x45, 0xD8, 0x4A, 0xF6,
-    0x21, 0x7B, 0x58, 0x83, 0x2B, 0x5B, 0x92, 0xF7, 0xBE, 0x71, 0xEA, 0xD5, 0x8D, 0x95, 0xBD, 0xDF,
-    0x9E, 0xC1, 0x71, 0x54, 0x5C, 0xB5, 0x7F, 0x4C, 0xF7, 0xC1, 0xEE, 0x8E, 0x3A, 0x0B, 0x3B, 0x6C,
-    0x4A, 0xF8, 0x16, 0x76, 0x78, 0xA8, 0x36, 0xB5, 0xFA, 0x7A, 0x02, 0xDD, 0xA4, 0x0E, 0x93, 0x47,
-    0x59, 0xE9, 0x1E, 0xCC, 0x62, 0xE6, 0x59, 0xAD, 0xAB, 0xB5, 0xC4, 0x4E, 0x0A, 0x61, 0xA3, 0xD9,
-    0x0F, 0x85, 0x56, 0x3B, 0x6C, 0x15, 0x47, 0x14, 0xBD, 0xFB, 0x16, 0xBC, 0x52, 0x56, 0xCA, 0x36,
-    0x50, 0xA1, 0x30, 0x75, 0xA2, 0x88, 0x69, 0x29, 0x80, 0x59, 0x43, 0x41, 0xE1, 0xC2, 0x96, 0x12,
-    0x2B, 0x45, 0x24, 0x93, 0x9E, 0xC2, 0x69, 0xA2, 0x54, 0xB0, 0x6B, 0x59, 0x11, 0x85, 0xA5, 0x40,
-    0x97, 0x22, 0x05, 0x94, 0x88, 0x14, 0xA6, 0x48, 0x13, 0x89, 0xB0, 0x03, 0x56, 0x44, 0x91, 0xC2,
-    0x8B, 0x08, 0x15, 0x52, 0xBC, 0x7C, 0xA2, 0x28, 0x46, 0xCA, 0x1B, 0xD0, 0x9A, 0x3C, 0x9B, 0xDD,
-    0xBD, 0x39, 0x77, 0xF6, 0xBD, 0x67, 0x22, 0xA2, 0xE4, 0xD9, 0xE7, 0xEC, 0x67, 0x3E, 0x3B, 0x73,
-    0x3F, 0xE7, 0x0E, 0x11, 0x51, 0xC0, 0x15, 0xC5, 0xEC, 0x48, 0xE3, 0x6A, 0x2C, 0x51, 0x96, 0x02,
-    0xC1, 0xE2, 0x42, 0x16, 0x73, 0xE5, 0x31, 0xB7, 0xB3, 0x60, 0xD6, 0xA4, 0x9D, 0xCB, 0x04, 0x08,
-    0x00, 0x8A, 0x1D, 0xF5, 0xF0, 0x83, 0x7B, 0x90, 0x03, 0x5E, 0x94, 0xA4, 0x70, 0xCF, 0x5C, 0x87,
-    0xCC, 0x2E, 0x79, 0x7D, 0xEF, 0x9A, 0x7A, 0x7A, 0x2F, 0x35, 0x1B, 0x6B, 0x64, 0xEE, 0xCD, 0x93,
-    0x59, 0x7B, 0x97, 0xCC, 0xE5, 0xA3, 0x64, 0xBE, 0x7E, 0x8F, 0xCC, 0xAF, 0x1F, 0x92, 0x6E, 0x4F,
-    0x90, 0x6A, 0x8E, 0x63, 0x78, 0x51, 0x0D, 0x18, 0xE3, 0x0A, 0xE0, 0x8B, 0x1D, 0xA2, 0x9B, 0x98,
-    0x6A, 0x01, 0x0B, 0x91, 0x9F, 0xE2, 0x1C, 0xF3, 0x55, 0x98, 0xCF, 0xC6, 0x4D, 0x90, 0x27, 0xF8,
-    0xAC, 0x2E, 0xC9, 0xAF, 0xD5, 0xDC, 0x7D, 0x5A, 0x99, 0xD5, 0xD7, 0xA5, 0x59, 0x65, 0xA0, 0x25,
-    0xB3, 0x31, 0x22, 0x0D, 0xA8, 0xA7, 0x23, 0x4A, 0xFE, 0x1A, 0xA5, 0x11, 0xC6, 0x60, 0x5E, 0x4B,
-    0x19, 0xE6, 0x20, 0x59, 0x2E, 0xDB, 0x64, 0x82, 0x9D, 0x45, 0x92, 0xB9, 0xA6, 0xD8, 0xBB, 0x91,
-    0xE2, 0x7D, 0xEE, 0x31, 0x6E, 0x53, 0x3B, 0x0B, 0x58, 0x92, 0xC3, 0xF0, 0xEA, 0x1F, 0x7D, 0xFD,
-    0x2F, 0xDB, 0x25, 0xCC, 0x4D, 0x11, 0x77, 0x14, 0xD7, 0x07, 0xA6, 0x6D, 0xEB, 0x7B, 0xD7, 0x64,
-    0xFB, 0xFE, 0x2A, 0xCF, 0x72, 0x2F, 0xF0, 0xED, 0x58, 0x77, 0x96, 0xCB, 0x3B, 0xB6, 0x13, 0x60,
-    0xA6, 0x77, 0xFC, 0x4E, 0x95, 0x9F, 0xF5, 0x14, 0xD1, 0x07, 0xF1, 0x08, 0x73, 0x9B, 0x0C, 0xAD,
-    0xB9, 0x61, 0xE9, 0x63, 0x5C, 0x51, 0x9B, 0xD2, 0x58, 0x53, 0xA9, 0xCA, 0x58, 0x5D, 0x26, 0x95,
-    0xC9, 0xB5, 0xDD, 0x67, 0xE3, 0xB9, 0xF0, 0xCC, 0xC2, 0x2B, 0x9E, 0x57, 0x3D, 0x5F, 0x12, 0xA6,
-    0x24, 0xDF, 0xFF, 0xC6, 0x31, 0x7F, 0x5B, 0x25, 0xB9, 0x72, 0x40, 0x0D, 0x8C, 0x80, 0x5B, 0xC0,
-    0x85, 0x24, 0x2F, 0x78, 0xBD, 0xC2, 0x37, 0x9D, 0xBA, 0x7A, 0x2E, 0x57, 0xF3, 0xF3, 0xB9, 0xDC,
-    0x17, 0xF2, 0x7C, 0x66, 0x2B, 0x57, 0xA7, 0x87, 0xB9, 0x9A, 0xE5, 0x5C, 0xA5, 0x13, 0x64, 0xB9,
-    0xE9, 0x64, 0xF5, 0x06, 0x3B, 0x14, 0x6E, 0x85, 0x2F, 0xB1, 0x70, 0xDE, 0x73, 0x11, 0x59, 0xE1,
-    0x58, 0x98, 0x93, 0x87, 0x64, 0xBE, 0xED, 0x32, 0x46, 0xCF, 0x86, 0x85, 0xDD, 0x32, 0xDE, 0xFC,
-    0x41, 0x4A, 0x5A, 0xFF, 0x8D, 0xF7, 0x52, 0x70, 0xC2, 0xC2, 0x21, 0x8F, 0x0D, 0x3F, 0xF9, 0xA2,
-    0xF3, 0x3C, 0x12, 0xFE, 0xA6, 0x11, 0x9E, 0x6D, 0x66, 0x3A, 0x61, 0x0D, 0x8B, 0xCD, 0x36, 0xF0,
-    0xB9, 0x39, 0xD3, 0x14, 0x81, 0xAC, 0xAD, 0x90, 0x9E, 0x65, 0x56, 0x82, 0xAD, 0x46, 0x9C, 0x5C,
-    0x2D, 0x63, 0xCC, 0x39, 0xEF, 0xA8, 0xB0, 0x66, 0xAE, 0x26, 0x6D, 0xCD, 0x19, 0x44, 0x8D, 0x35,
-    0xA7, 0x9B, 0x1F, 0x32, 0x6B, 0xD2, 0xAE, 0x40, 0x6B, 0xCA, 0x59, 0x3B, 0xFE, 0xE2, 0x85, 0xA0,
-    0x09, 0xAB, 0x8B, 0x03, 0x90, 0x09, 0x9B, 0x08, 0xD4, 0x46, 0xA5, 0x09, 0xFF, 0x8C, 0xAD, 0x8E,
-    0x84, 0xCE, 0x6E, 0x25, 0x56, 0xCD, 0x5D, 0x16, 0xDB, 0xF5, 0xC6, 0x42, 0xE4, 0x6F, 0xCE, 0x5F,
-    0x4D, 0xE3, 0xAD, 0x78, 0x9D, 0x40, 0x43, 0x8A, 0x86, 0x51, 0x47, 0x61, 0x17, 0x82, 0xDA, 0xB0,
-    0x15, 0x6A, 0x68, 0xD0, 0x0C, 0x1A, 0x44, 0xD7, 0xB3, 0x60, 0xC4, 0xDC, 0x05, 0x30, 0x07, 0xAF,
-    0x34, 0x2D, 0xE9, 0x3B, 0x4D, 0x7B, 0x30, 0xB9, 0xDF, 0xB4, 0x7A, 0xED, 0xF1, 0xFF, 0xD3, 0x13,
-    0xD0, 0x57, 0x1F, 0x8D, 0x5A, 0x9D, 0x47, 0x75, 0xAB, 0xB7, 0x0B, 0xD7, 0x22, 0x4D, 0x2D, 0xC8,
-    0xFB, 0xC1, 0x7A, 0x68, 0x6E, 0x3C, 0x0E, 0x67, 0xBF, 0xC8, 0x73, 0xD8, 0x69, 0xAB, 0x78, 0x68,
-    0x11, 0x59, 0x36, 0x2B, 0x0B, 0x5B, 0x20, 0x7A, 0x38, 0xD5, 0x53, 0xC8, 0x73, 0x86, 0x3F, 0x69,
-    0x57, 0x5C, 0xD8, 0xA8, 0x53, 0x76, 0x6C, 0x06, 0x38, 0x82, 0x3D, 0x68, 0x06, 0xF9, 0xA4, 0xE1,
-    0x00, 0x68, 0xC1, 0x80, 0x67, 0x73, 0xEC, 0x86, 0x22, 0x04, 0x80, 0xDE, 0xBB, 0x2E, 0x9E, 0xF5,
-    0x57, 0x89, 0x77, 0x89, 0x0A, 0x41, 0x8C, 0xB6, 0x10, 0x8E, 0x1A, 0x74, 0x94, 0xCA, 0x18, 0x24,
-    0x14, 0x34, 0x04, 0x90, 0x39, 0xCB, 0xD8, 0x25, 0x95, 0x92, 0x98, 0x46, 0x9C, 0x16, 0x94, 0x54,
-    0x1D, 0x25, 0x4F, 0x1A, 0x4A, 0x7E, 0x47, 0xCE, 0x0C, 0xAB, 0x69, 0xAE, 0x2C, 0xF3, 0x6E, 0x9A,
-    0x48, 0x5E, 0x4B, 0x9B, 0xF4, 0xA9, 0x8A, 0xB4, 0x1F, 0x23, 0xF9, 0x90, 0x38, 0xA4, 0x4B, 0x55,
-    0x8C, 0x63, 0xF5, 0x70, 0xF6, 0x30, 0x25, 0xFD, 0x13, 0x16, 0x34, 0x04, 0x60, 0x0B, 0x5D, 0x79,
-    0x53, 0x0C, 0x78, 0x13, 0x9F, 0xED, 0x68, 0xA0, 0xEB, 0xDE, 0x3C, 0x85, 0x45, 0xFE, 0x02, 0xCB,
-    0xB8, 0xD7, 0x63, 0xF4, 0xBF, 0x23, 0xFC, 0xCC, 0x27, 0x39, 0xFB, 0xA8, 0x33, 0x7D, 0xA2, 0x1E,
-    0xA2, 0x4C, 0x82, 0x2E, 0xB8, 0x9E, 0x48, 0xB4, 0x0F, 0x9A, 0x48, 0x82, 0x2F, 0x1C, 0x85, 0xFE,
-    0x52, 0x8B, 0x15, 0x28, 0x72, 0xFE, 0x12, 0xBB, 0x70, 0x34, 0x73, 0x05, 0x46, 0x88, 0x46, 0xA6,
-    0xC5, 0x5A, 0x63, 0x27, 0xA6, 0x2B, 0x93, 0x97, 0x23, 0x9D, 0x22, 0xCE, 0x1E, 0x38, 0x95, 0xEA,
-    0xBB, 0xBC, 0xEA, 0x74, 0x6A, 0xB8, 0x8B, 0xEA, 0x4C, 0xCC, 0x24, 0x2B, 0xCB, 0xBA, 0x34, 0x19,
-    0xD6, 0xDE, 0x2E, 0xFD, 0x52, 0xC6, 0xC6, 0x57, 0x3E, 0x7D, 0x49, 0xF7, 0x9A, 0x68, 0xE8, 0xCD,
-    0x0B, 0x3E, 0xDA, 0x89, 0x4C, 0x5A, 0x89, 0x71, 0x32, 0x73, 0x15, 0x65, 0x67, 0x01, 0x5C, 0xCD,
-    0x1A, 0xB0, 0x69, 0x7D, 0x5B, 0xC2, 0xBE, 0x5F, 0x20, 0xE1, 0xB7, 0x01, 0xC9, 0x7A, 0xE4, 0x5D,
-    0x99, 0x6B, 0x36, 0xF6, 0xE4, 0x05, 0x55, 0xDE, 0x3A, 0x0E, 0x91, 0x78, 0x53, 0xE4, 0xA4, 0x2E,
-    0x0C, 0x30, 0x2E, 0xE8, 0x30, 0xFC, 0x0A, 0xD0, 0x02, 0x4C, 0xAA, 0x2C, 0xF6, 0x25, 0xA1, 0xD4,
-    0x76, 0x79, 0xBB, 0xE8, 0xE5, 0x02, 0xEF, 0xD5, 0x36, 0x8F, 0xFB, 0x55, 0xE8, 0x47, 0x6F, 0x81,
-    0x02, 0x27, 0x86, 0x15, 0x9F, 0x36, 0x90, 0xF3, 0x3A, 0xE9, 0xDC, 0xE7, 0xFA, 0x85, 0x23, 0x73,
-    0x1F, 0x12, 0x7B, 0x07, 0x58, 0x41, 0x42, 0xCE, 0x72, 0x23, 0xC8, 0x04, 0x2B, 0x2F, 0x1B, 0x73,
-    0x07, 0x78, 0xFC, 0xB2, 0x51, 0xBB, 0x2F, 0x1B, 0xC8, 0x77, 0x03, 0xC9, 0x6D, 0xE0, 0x95, 0x67,
-    0x7E, 0x2E, 0x81, 0x77, 0x85, 0xF2, 0x2A, 0xE0, 0x45, 0x40, 0x22, 0x3F, 0xBB, 0x0D, 0xEA, 0x32,
-    0x4F, 0x12, 0x70, 0x58, 0xF7, 0x77, 0x5D, 0xB1, 0x0D, 0x1F, 0x41, 0x81, 0xCF, 0xEF, 0xAD, 0xEF,
-    0xF5, 0xEF, 0xD4, 0x6F, 0x9F, 0xEC, 0xC2, 0xC0, 0x70, 0x9F, 0xB1, 0xC8, 0x45, 0x93, 0x07, 0xAD,
-    0x94, 0xBF, 0x8E, 0x60, 0xAA, 0xC2, 0x1B, 0x76, 0x80, 0xE0, 0x55, 0x70, 0x0B, 0x2C, 0x95, 0xC6,
-    0x69, 0x66, 0x27, 0x49, 0x75, 0xE3, 0x06, 0xFB, 0x5D, 0x07, 0xD8, 0x6D, 0xE8, 0x37, 0xD4, 0x5B,
-    0x64, 0x12, 0x43, 0xBA, 0x9A, 0x91, 0x42, 0x62, 0xA5, 0xE0, 0x04, 0xDC, 0xF5, 0x5E, 0x93, 0xD5,
-    0x6A, 0x4E, 0x51, 0x40, 0x1D, 0x0A, 0x53, 0x95, 0xEC, 0xBE, 0xB2, 0xFA, 0x31, 0x76, 0x3F, 0xDE,
-    0x79, 0x36, 0x2B, 0xBB, 0xEF, 0x21, 0xF7, 0xF2, 0x4E, 0xDA, 0xC4, 0x3A, 0x6A, 0xF7, 0xC5, 0x15,
-    0x29, 0xBE, 0x61, 0x9F, 0x3C, 0xF9, 0x74, 0xF7, 0xD7, 0x66, 0x52, 0x1A, 0x40, 0xC5, 0x29, 0x74,
-    0x3A, 0xA7, 0x78, 0xAF, 0xD8, 0x4E, 0xA5, 0x64, 0xA4, 0x52, 0x3C, 0xD2, 0xD8, 0xA1, 0xD8, 0xC4,
-    0xCE, 0xFC, 0x37, 0x59, 0xA1, 0xD7, 0x79, 0xEC, 0x50, 0x68, 0x63, 0x07, 0x5D, 0xA4, 0x37, 0x7E,
-    0x22, 0x81, 0xBE, 0x82, 0x62, 0x27, 0x10, 0xE2, 0xFA, 0x08, 0x0C, 0x5E, 0xD1, 0x84, 0xC4, 0xEA,
-    0x91, 0x94, 0xD6, 0x81, 0x97, 0xFF, 0xAC, 0x9B, 0x3C, 0x23, 0xB1, 0xDE, 0x3F, 0x76, 0x54, 0x59,
-    0x2C, 0x63, 0xB3, 0xFC, 0x72, 0x63, 0x63, 0xD3, 0x9A, 0x8D, 0x8D, 0x61, 0x1E, 0xF3, 0x73, 0xA6,
-    0x70, 0x88, 0xCE, 0xE1, 0xEA, 0x86, 0xED, 0x49, 0xF2, 0x16, 0x90, 0xFC, 0x75, 0x87, 0x17, 0x17,
-    0x17, 0xC6, 0x59, 0xB7, 0xFF, 0x2E, 0x7B, 0xB8, 0x30, 0x91, 0xB2, 0xFF, 0x02, 0xFA, 0x4A, 0xB2,
-    0x16, 0x29, 0x1E, 0x32, 0xEE, 0xE4, 0x1E, 0x9E, 0xC8, 0xF2, 0xF3, 0x4C, 0xD9, 0xC8, 0xEB, 0x60,
-    0x29, 0x61, 0x8D, 0x94, 0x45, 0x06, 0x04, 0xE2, 0xE1, 0x9C, 0x4C, 0x19, 0x39, 0x49, 0x59, 0xE0,
-    0xC5, 0x4D, 0xAC, 0xDC, 0x61, 0x9B, 0x38, 0x6C, 0x60, 0x2F, 0xFC, 0xCA, 0xD1, 0x59, 0x3C, 0x2B,
-    0xF8, 0x8E, 0x5D, 0x5C, 0x3D, 0x87, 0x46, 0x45, 0x2E, 0x29, 0x7B, 0x18, 0x1B, 0xB9, 0x22, 0x95,
-    0xCA, 0x1F, 0xA1, 0xFE, 0x44, 0x48, 0x8F, 0xE9, 0x4F, 0x89, 0x40, 0x1C, 0xBF, 0x05, 0xBA, 0x79,
-    0x12, 0xF4, 0xFD, 0x29, 0x31, 0xC6, 0xA4, 0x92, 0xD7, 0xC8, 0x20, 0x6E, 0x82, 0x8B, 0x8B, 0x8B,
-    0xB7, 0xE9, 0x14, 0x8E, 0x0C, 0x74, 0xEA, 0xD8, 0x89, 0x44, 0xC4, 0xE5, 0x28, 0xE9, 0x07, 0xCF,
-    0x11, 0x81, 0xC1, 0x0A, 0x0E, 0x0F, 0x62, 0xCF, 0xAD, 0x67, 0x01, 0x24, 0x45, 0xC4, 0x27, 0xF0,
-    0x0A, 0xA4, 0x27, 0xC5, 0x8F, 0x24, 0xB4, 0xA9, 0x7B, 0x9B, 0x34, 0xFB, 0xF3, 0x88, 0x3F, 0xC0,
-    0x20, 0x10, 0xEB, 0x4E, 0x8D, 0x8C, 0xED, 0xC2, 0x26, 0x4B, 0xBB, 0xA0, 0x2D, 0xD0, 0xC5, 0x53,
-    0x57, 0xD0, 0x8F, 0x42, 0xF4, 0x16, 0xC5, 0x18, 0x3F, 0x3E, 0x1B, 0xB9, 0x64, 0x67, 0xB9, 0x16,
-    0xE9, 0x1A, 0xA3, 0x4E, 0xEA, 0x65, 0xE8, 0x97, 0x0F, 0x79, 0xD4, 0xB8, 0xDD, 0xA9, 0x4C, 0xB0,
-    0x2F, 0x01, 0xCE, 0x9F, 0x93, 0xA6, 0x67, 0xA3, 0xE0, 0x80, 0xE8, 0xDF, 0x92, 0xC4, 0x47, 0xE7,
-    0x37, 0x5F, 0xC1, 0x42, 0x48, 0xDA, 0x84, 0xCF, 0xC1, 0x25, 0x8F, 0x96, 0x8A, 0xD4, 0xFC, 0xBC,
-    0x04, 0x1F, 0xAD, 0x2D, 0xA1, 0xD8, 0xCC, 0x2D, 0xE9, 0x12, 0x04, 0xF5, 0x98, 0x3D, 0x70, 0x30,
-    0xCD, 0xD2, 0x71, 0xD9, 0xEA, 0x85, 0xD8, 0x4F, 0x17, 0x76, 0xFE, 0x0C, 0x88, 0x70, 0xD6, 0x53,
-    0x0A, 0x0E, 0x52, 0x78, 0x59, 0xFE, 0x51, 0xA7, 0xFD, 0xB2, 0x46, 0xFC, 0x69, 0xC3, 0xE1, 0xE4,
-    0x9F, 0x6B, 0xA4, 0x89, 0x70, 0xD4, 0xF0, 0xA0, 0xE5, 0xA0, 0x15, 0x8E, 0x5A, 0x96, 0x33, 0x07,
-    0xF6, 0x91, 0xF6, 0x63, 0x31, 0x09, 0x15, 0x55, 0xCC, 0x38, 0x2E, 0xE0, 0x70, 0xF5, 0x19, 0x02,
-    0x07, 0x36, 0x9E, 0xFE, 0xE3, 0x31, 0xB3, 0x87, 0x70, 0xBC, 0x48, 0x78, 0xD4, 0x47, 0x37, 0xC9,
-    0x7E, 0x31, 0x43, 0xB3, 0xB8, 0xF8, 0xF1, 0xDF, 0x63, 0x60, 0x60, 0x60, 0xF8, 0xFF, 0xFF, 0xBF,
-    0x03, 0x08, 0x67, 0xAD, 0x5A, 0xC5, 0x00, 0x00, 0xB5, 0x90, 0xCD, 0x4D, 0x04, 0x31, 0x0C, 0x85,
-    0xBD, 0xB3, 0x12, 0x91, 0xC8, 0x21, 0x25, 0xCC, 0x9D, 0x26, 0x3C, 0xC5, 0x70, 0xA7, 0x84, 0x49,
-    0x09, 0x0B, 0x55, 0x6C, 0x17, 0x49, 0x09, 0x29, 0x61, 0xC4, 0x95, 0x03, 0x11, 0x8A, 0x56, 0xCB,
-    0x68, 0x93, 0x87, 0x93, 0x19, 0x60, 0x6E, 0x20, 0x7E, 0x2C, 0xE5, 0x8B, 0x64, 0x5B, 0xF6, 0xF3,
-    0x23, 0x6A, 0xE1, 0xCE, 0x1A, 0xD4, 0x21, 0x31, 0x68, 0x8F, 0xE8, 0x0A, 0xA9, 0x33, 0x39, 0x22,
-    0x95, 0x08, 0x44, 0xBA, 0xDC, 0xE3, 0x48, 0x23, 0x9E, 0x70, 0x21, 0x87, 0x67, 0xA1, 0x6E, 0x79,
-    0xF5, 0x0B, 0xAE, 0x5B, 0x2F, 0x1D, 0x4E, 0x79, 0x8F, 0x97, 0x2C, 0xFB, 0x6E, 0xA5, 0x52, 0x77,
-    0x1D, 0x47, 0x3C, 0x66, 0x27, 0x4F, 0xA7, 0x2E, 0xAB, 0x6F, 0xBE, 0x65, 0xDE, 0x9C, 0x3F, 0xE7,
-    0x2D, 0x79, 0x5D, 0x1E, 0xF2, 0x8F, 0xE7, 0xAD, 0xC6, 0xF4, 0xB6, 0x39, 0xC3, 0xBE, 0x59, 0xC3,
-    0xBE, 0x79, 0x73, 0xFD, 0x7E, 0x48, 0x73, 0xE7, 0xC6, 0x36, 0x7B, 0xD8, 0x37, 0x7F, 0xD8, 0x37,
-    0x83, 0xA4, 0xF3, 0x4F, 0xBE, 0xAD, 0x16, 0xF6, 0x1B, 0x2D, 0x58, 0xB5, 0x7C, 0x74, 0x36, 0x2D,
-    0xEC, 0xFF, 0x5B, 0xCB, 0xCE, 0xBD, 0xCA, 0xDD, 0x40, 0xA0, 0x1E, 0x88, 0xC4, 0xC1, 0x08, 0x7C,
-    0x85, 0x35, 0xF3, 0x81, 0xC5, 0x8B, 0x89, 0x2D, 0x2A, 0x96, 0xDC, 0xD7, 0xD0, 0x45, 0x9A, 0x15,
-    0x22, 0xDB, 0x1D, 0x26, 0xDA, 0x46, 0x5D, 0x45, 0x0A, 0x90, 0xCD, 0x06, 0xB5, 0x66, 0x42, 0x5F,
-    0xE9, 0xCD, 0x44, 0x57, 0x08, 0xFD, 0x6C, 0xB9, 0x3A, 0x11, 0x1C, 0xA2, 0x08, 0x02, 0x1D, 0xA4,
-    0x8A, 0x81, 0xA4, 0xEA, 0x52, 0x25, 0x63, 0x10, 0x6A, 0x4C, 0x42, 0x1A, 0x63, 0xA5, 0x4E, 0xC2,
-    0x41, 0x55, 0x96, 0xBB, 0x68, 0x4A, 0x90, 0xB9, 0xBA, 0x4E, 0x18, 0x3A, 0x39, 0xA9, 0xC5, 0x1B,
-    0x45, 0x8D, 0xC1, 0x0D, 0x80, 0x30, 0x0C, 0x03, 0x23, 0xF2, 0xE4, 0x91, 0x01, 0xD8, 0x85, 0xC2,
-    0x64, 0x88, 0xC9, 0x28, 0x1B, 0x74, 0x04, 0x46, 0xE8, 0x07, 0x09, 0xA1, 0x8A, 0x23, 0x11, 0x0F,
-    0x22, 0xC7, 0x0F, 0x5B, 0xB6, 0x45, 0x54, 0xE2, 0x2C, 0x07, 0xA7, 0x1A, 0x4C, 0x73, 0x52, 0x08,
-    0x79, 0xEA, 0xDD, 0x18, 0xA5, 0x73, 0x83, 0x61, 0x6E, 0x21, 0xEF, 0x88, 0xC1, 0x4A, 0x4E, 0x3C,
-    0x4A, 0xDD, 0xB8, 0x8C, 0x2B, 0x51, 0x1D, 0xC6, 0xB1, 0x91, 0x95, 0x33, 0xC2, 0x10, 0x45, 0xE9,
-    0xC4, 0xB3, 0x56, 0x16, 0xEF, 0xD1, 0xB2, 0x44, 0xFF, 0xDD, 0xFE, 0xAD, 0x6F, 0xB7, 0xF3, 0x7F,
-    0x01,
+static const uint8_t notosans_12_boldBitmaps[26649] = {
+    0xB5, 0x58, 0xBD, 0x93, 0xE4, 0xC4, 0x15, 0x7F, 0xA3, 0xE1, 0x4E, 0xE5, 0x53, 0x20, 0x07, 0x6C,
+    0x15, 0x05, 0x81, 0x12, 0x47, 0x1B, 0x9C, 0x12, 0x27, 0x4E, 0xDC, 0xAA, 0x72, 0x48, 0x72, 0x01,
+    0x8B, 0x03, 0x12, 0x02, 0x07, 0x14, 0x89, 0xFD, 0x17, 0x5C, 0xEB, 0xEA, 0x02, 0x07, 0x04, 0x2C,
+    0xAE, 0x72, 0xEC, 0x0D, 0x8F, 0x25, 0xD8, 0xC4, 0x81, 0x93, 0xDD, 0x6E, 0x4C, 0xE8, 0x00, 0xE1,
+    0x2A, 0x62, 0xCB, 0xF8, 0x5C, 0xAE, 0x32, 0xC1, 0x0A, 0xAC, 0x02, 0xDD, 0x9D, 0xD4, 0xED, 0xDF,
+    0xEF, 0x49, 0x33, 0x3B, 0x7B, 0xEC, 0x1D, 0xB0, 0x36, 0x92, 0x5E, 0x6B, 0x46, 0xEA, 0x7E, 0xDF,
+    0x5F, 0x2D, 0x5B, 0xBB, 0xDA, 0xD6, 0xB6, 0x9A, 0x4F, 0x53, 0x19, 0x99, 0x4F, 0x1E, 0xB7, 0xC5,
+    0xF1, 0x6D, 0xF5, 0x82, 0x24, 0x7D, 0xDA, 0xE5, 0x4D, 0xE1, 0xF9, 0xDE, 0xCA, 0x99, 0x4C, 0x3B,
+    0xE7, 0x99, 0x38, 0xAE, 0xA8, 0x4A, 0x9F, 0xFB, 0xB4, 0x4B, 0x7A, 0x23, 0x85, 0xCF, 0x9B, 0xB4,
+    0x5B, 0xF7, 0xC9, 0xB0, 0x1A, 0x65, 0xBC, 0x34, 0x79, 0x5C, 0x8D, 0xC9, 0xB0, 0x06, 0xB6, 0x8C,
+    0xD8, 0x24, 0x6F, 0x88, 0xB5, 0xAC, 0x67, 0x8A, 0x7B, 0xAF, 0xD9, 0x09, 0xE7, 0x78, 0x41, 0x97,
+    0xC7, 0x2A, 0x36, 0x92, 0xC5, 0x41, 0x8A, 0x38, 0x89, 0xF9, 0x24, 0x8A, 0xA9, 0x9D, 0x90, 0x57,
+    0xA7, 0xBF, 0x14, 0xFC, 0x0E, 0x60, 0x9D, 0xA9, 0x75, 0xF4, 0x11, 0x6B, 0x02, 0xD6, 0x8E, 0xC0,
+    0xD1, 0x2A, 0x2E, 0xB0, 0x26, 0xCE, 0xAF, 0xA3, 0x2F, 0xA2, 0xB7, 0xE7, 0xDE, 0x94, 0xFE, 0xA5,
+    0xD2, 0xCB, 0xB7, 0x5E, 0xE4, 0xC2, 0x3D, 0x94, 0x1C, 0xD8, 0x4C, 0x8C, 0x55, 0xD1, 0xB8, 0xFA,
+    0x06, 0xA8, 0xC9, 0x0C, 0xB5, 0x40, 0x03, 0xB2, 0x0A, 0x22, 0xE9, 0x08, 0x0A, 0x9D, 0x88, 0xF5,
+    0xA0, 0x78, 0xF1, 0x17, 0x6B, 0x9A, 0x0D, 0x10, 0x57, 0x12, 0x1F, 0x4A, 0x09, 0x5C, 0x05, 0x70,
+    0xE5, 0x95, 0xAB, 0x2F, 0xE1, 0xF9, 0x60, 0x52, 0x6E, 0x57, 0x78, 0x2F, 0xAF, 0xC7, 0xE5, 0x5D,
+    0xD9, 0xF0, 0xFE, 0x13, 0x20, 0x06, 0x8E, 0xDA, 0xE8, 0xDA, 0x7E, 0x96, 0x48, 0x30, 0x2F, 0x21,
+    0x6D, 0x40, 0x0E, 0x28, 0x01, 0x77, 0x01, 0x63, 0x80, 0xD5, 0x82, 0xA4, 0x6D, 0x90, 0xDC, 0x83,
+    0xEF, 0x2A, 0x88, 0x3D, 0x8E, 0x47, 0x2E, 0xC6, 0x8E, 0xB0, 0x77, 0x10, 0xEF, 0xE8, 0xDA, 0x05,
+    0x4A, 0x68, 0xC9, 0x6C, 0xE0, 0xF7, 0xAF, 0x61, 0xBE, 0xCC, 0x70, 0x40, 0xFE, 0x5B, 0xB1, 0x78,
+    0x7E, 0xFB, 0x24, 0x88, 0x0A, 0x46, 0x3E, 0x15, 0xA2, 0x1C, 0x26, 0x51, 0x1C, 0x2C, 0xE3, 0x60,
+    0xA1, 0x5F, 0xCF, 0xE2, 0x2D, 0x9A, 0x0E, 0x2A, 0x43, 0x0A, 0xC8, 0xC1, 0x2A, 0xB5, 0x48, 0x7C,
+    0xF6, 0xE6, 0xA1, 0x58, 0x3B, 0x62, 0x3E, 0xD6, 0xFD, 0x33, 0xC2, 0xCE, 0x1B, 0xCB, 0x95, 0x9E,
+    0x36, 0xC3, 0xAF, 0x1A, 0x7A, 0x81, 0xD5, 0xA8, 0x87, 0x59, 0x46, 0xCC, 0xF5, 0x1B, 0xD8, 0x3B,
+    0xB0, 0xD0, 0x89, 0x55, 0xDA, 0xB2, 0x9A, 0x44, 0xD6, 0x50, 0x72, 0x8A, 0x79, 0x19, 0x14, 0x9D,
+    0xB7, 0x0B, 0x21, 0xAA, 0xB2, 0xBA, 0x3C, 0x65, 0x98, 0xD9, 0x4A, 0x20, 0x4B, 0x41, 0x19, 0x9F,
+    0xD0, 0x93, 0x22, 0x3D, 0x49, 0x7D, 0xA8, 0xFC, 0x0C, 0x7C, 0x42, 0x86, 0xB5, 0x7A, 0x5B, 0x2F,
+    0xE6, 0x5F, 0xD0, 0x57, 0xE5, 0x2A, 0xCE, 0x0A, 0x8B, 0xA7, 0xD9, 0x7F, 0x47, 0xB5, 0x5B, 0xBA,
+    0xD5, 0x3D, 0xF1, 0xD5, 0x58, 0x87, 0xF9, 0xE0, 0xD7, 0xDE, 0x83, 0x4C, 0x58, 0x35, 0x63, 0x56,
+    0xEC, 0xB5, 0xBB, 0x47, 0x7B, 0x45, 0xC8, 0x64, 0xEB, 0xE4, 0x91, 0x6A, 0x60, 0xE6, 0x7D, 0x3D,
+    0xC9, 0x6D, 0xD0, 0x2B, 0xC1, 0x0F, 0x4D, 0x76, 0x39, 0xDE, 0x2E, 0x8E, 0x8B, 0x67, 0x59, 0x5D,
+    0xB4, 0x65, 0x9B, 0xEF, 0xA8, 0x98, 0xC7, 0xE5, 0x08, 0xC2, 0x91, 0x41, 0xA7, 0xB1, 0x87, 0xB9,
+    0x7E, 0x96, 0x40, 0xF4, 0x89, 0x0A, 0x80, 0xFC, 0x70, 0x43, 0x38, 0x25, 0x4C, 0x82, 0x58, 0x18,
+    0x36, 0x6B, 0xFF, 0xC8, 0x37, 0xE0, 0x23, 0x81, 0x7E, 0x7E, 0x0C, 0x54, 0x23, 0xF1, 0x61, 0x11,
+    0x98, 0xC2, 0x60, 0x68, 0x60, 0xAB, 0xAA, 0xA4, 0x4E, 0x03, 0x42, 0x67, 0x35, 0x41, 0xC3, 0xC9,
+    0x98, 0x77, 0x58, 0x08, 0x9D, 0xA7, 0x8F, 0xDE, 0x18, 0x40, 0x0F, 0xDA, 0xCC, 0x23, 0xC4, 0x87,
+    0xD9, 0xA0, 0xA9, 0x06, 0xC2, 0xC1, 0x65, 0x5D, 0x05, 0x3B, 0x59, 0x1F, 0x2B, 0xDA, 0x36, 0x1E,
+    0x0A, 0xDF, 0x45, 0xF8, 0x7B, 0x5C, 0x45, 0xCF, 0x09, 0x33, 0xB8, 0x3A, 0x7E, 0xC0, 0xE7, 0x03,
+    0xDF, 0x49, 0x5C, 0xB9, 0xE5, 0x79, 0xD9, 0xE0, 0x0E, 0xC0, 0x7F, 0xE8, 0x6E, 0x5E, 0xFB, 0x70,
+    0xF1, 0xAB, 0x78, 0xB8, 0x82, 0xFF, 0xA6, 0x31, 0xB6, 0xF9, 0x94, 0x34, 0x65, 0x3B, 0x47, 0x88,
+    0x5D, 0x4C, 0xBE, 0x0B, 0x76, 0x13, 0x59, 0x98, 0x53, 0x0C, 0x72, 0x08, 0x2E, 0xDB, 0x24, 0xAA,
+    0x33, 0xD7, 0xB3, 0x5F, 0x91, 0xAF, 0x49, 0x94, 0xC6, 0x41, 0x6C, 0x41, 0xB7, 0x8B, 0xF0, 0xD6,
+    0x08, 0x6F, 0x89, 0x10, 0xF1, 0x32, 0xF0, 0x19, 0xDF, 0x61, 0x0E, 0x52, 0xD2, 0xCC, 0x17, 0xD7,
+    0x1E, 0x02, 0x4F, 0x0F, 0x11, 0x78, 0x1D, 0xDC, 0x89, 0x6A, 0x5C, 0x5E, 0xB1, 0x5B, 0xAE, 0xDD,
+    0x87, 0x7C, 0x3E, 0xCC, 0x97, 0xAE, 0xD2, 0xEB, 0xE9, 0x09, 0x9B, 0x85, 0xBB, 0x0F, 0x37, 0x97,
+    0x1E, 0xAF, 0x40, 0x06, 0xA8, 0x7D, 0x8D, 0xC5, 0x08, 0xF9, 0xDF, 0x94, 0xCC, 0x31, 0x8D, 0xA6,
+    0x9D, 0x45, 0x0F, 0x71, 0x24, 0x58, 0x42, 0x9D, 0x8C, 0xC6, 0x03, 0xDA, 0x64, 0x2C, 0x86, 0x64,
+    0xA4, 0xB9, 0x12, 0x9A, 0xCC, 0xCE, 0x0A, 0x75, 0xB2, 0xBE, 0x42, 0xD6, 0x05, 0x30, 0x6F, 0x0B,
+    0x07, 0xBF, 0x1C, 0x9F, 0x39, 0x0F, 0x60, 0x22, 0x52, 0x93, 0x2F, 0x63, 0x45, 0x97, 0xFA, 0xB6,
+    0xAB, 0x88, 0xD5, 0x3C, 0x9F, 0x49, 0x24, 0x5E, 0xE7, 0x42, 0xC6, 0xA3, 0xF2, 0xE1, 0x37, 0xCD,
+    0x2C, 0x45, 0xDE, 0xCD, 0x5E, 0x03, 0x8F, 0x42, 0x86, 0x8A, 0x20, 0x12, 0x91, 0x76, 0x22, 0xDC,
+    0x03, 0x81, 0x07, 0x65, 0x11, 0xBC, 0xC4, 0xF3, 0x4E, 0xE2, 0xAB, 0xC3, 0xFC, 0x1E, 0x99, 0x0B,
+    0x27, 0xA2, 0xD5, 0xD2, 0xE3, 0x5A, 0x5A, 0xF7, 0xFB, 0xB1, 0x43, 0xCD, 0xF0, 0x72, 0x0D, 0xC2,
+    0x26, 0x76, 0x52, 0x70, 0x28, 0x27, 0x66, 0x83, 0x09, 0xAC, 0xD9, 0x29, 0x8C, 0x72, 0x3A, 0x85,
+    0x53, 0x19, 0xA7, 0x70, 0x57, 0x86, 0x29, 0x98, 0xA4, 0xC7, 0xF0, 0x8B, 0x6E, 0x0A, 0xE5, 0xFD,
+    0x76, 0x0A, 0xF9, 0x5F, 0x1A, 0x0C, 0x1F, 0xFB, 0x29, 0x64, 0xE7, 0x18, 0xD2, 0x58, 0x4D, 0x61,
+    0x1D, 0x65, 0x0A, 0x09, 0x07, 0x04, 0xEE, 0xE4, 0x3C, 0xD2, 0x05, 0x90, 0x62, 0xE8, 0x39, 0x8C,
+    0x1C, 0x90, 0x98, 0x64, 0x02, 0xD7, 0x12, 0x50, 0xB8, 0x25, 0x98, 0x06, 0x43, 0xDE, 0x61, 0xC8,
+    0x7A, 0x0C, 0xEB, 0x11, 0xC3, 0x2A, 0x18, 0x04, 0x7B, 0xC4, 0x2F, 0xD8, 0x59, 0xB3, 0xBB, 0x30,
+    0xBD, 0x09, 0xAB, 0x21, 0x86, 0xF5, 0xC6, 0x91, 0x4A, 0xE8, 0x05, 0xDE, 0xD0, 0x33, 0x8A, 0x11,
+    0xC0, 0x43, 0x1A, 0x19, 0x2C, 0xC8, 0x58, 0xA0, 0xEB, 0xA1, 0x37, 0x66, 0x63, 0xB8, 0x16, 0x82,
+    0xA9, 0xDC, 0x19, 0xF4, 0x05, 0xA6, 0x60, 0x68, 0xA1, 0x70, 0xB8, 0x55, 0x9C, 0x11, 0x24, 0x8C,
+    0x64, 0x94, 0x81, 0x7A, 0xC6, 0xEE, 0x42, 0xBD, 0xC4, 0x36, 0x78, 0x79, 0x9D, 0xDA, 0x66, 0x3E,
+    0xB5, 0x0B, 0xE0, 0x7C, 0x23, 0x2E, 0xF1, 0x07, 0x4B, 0x1D, 0x57, 0xEA, 0xDE, 0x57, 0xC1, 0x0F,
+    0xC0, 0x6B, 0xD8, 0xF2, 0x4A, 0xFF, 0x61, 0x00, 0xCD, 0xE9, 0x6F, 0xAD, 0xA9, 0x58, 0x05, 0xD8,
+    0xAB, 0x2E, 0xF8, 0x67, 0x6E, 0xA2, 0xA7, 0x38, 0xCD, 0xE9, 0x5B, 0xFE, 0x37, 0xBC, 0x33, 0x1C,
+    0x51, 0x7F, 0x66, 0xAF, 0x0A, 0xA2, 0xEF, 0xD4, 0xAB, 0x98, 0xC3, 0xF2, 0x6E, 0x2E, 0xF9, 0xE8,
+    0x45, 0x0C, 0xE3, 0xF1, 0x2D, 0xA7, 0xB5, 0xD3, 0x36, 0xF0, 0x12, 0xD8, 0xA4, 0x4E, 0x68, 0xDA,
+    0x51, 0xEB, 0x37, 0xAE, 0xD8, 0x27, 0x41, 0xBD, 0xAA, 0x9F, 0xD5, 0x68, 0x97, 0x7A, 0xAD, 0x35,
+    0xDB, 0x7E, 0x7A, 0x47, 0xEB, 0xDB, 0x35, 0x40, 0x89, 0x3A, 0xEA, 0xD8, 0xD4, 0xF0, 0x2C, 0xA6,
+    0x04, 0x3C, 0x06, 0xC3, 0x79, 0x8B, 0x4C, 0x9E, 0x77, 0x60, 0x3F, 0xEB, 0x98, 0xD8, 0x7B, 0x54,
+    0x98, 0xF5, 0x88, 0x15, 0xAB, 0x91, 0xB9, 0x7F, 0x62, 0xC9, 0x0A, 0xAC, 0x59, 0xF6, 0x8C, 0x45,
+    0x81, 0xE5, 0xC1, 0x50, 0x53, 0x05, 0xCB, 0x08, 0x2B, 0x7B, 0x60, 0xE9, 0x75, 0x1A, 0x82, 0x94,
+    0xBA, 0x2A, 0x7A, 0x61, 0xC1, 0x2C, 0x07, 0x92, 0xA9, 0xCD, 0xA8, 0x84, 0xCC, 0x29, 0xC3, 0xDE,
+    0xDF, 0x3D, 0x5B, 0x0F, 0x28, 0x59, 0x67, 0x96, 0x34, 0xDB, 0xC9, 0x28, 0xD5, 0xD1, 0xBC, 0xDA,
+    0x49, 0xFA, 0xC5, 0x58, 0xBE, 0xDB, 0xCA, 0xFA, 0xAB, 0xA1, 0xF8, 0x18, 0x0C, 0x3C, 0xE9, 0xF3,
+    0xBF, 0x79, 0x49, 0x9E, 0x74, 0xF9, 0x39, 0x7B, 0xA9, 0x2E, 0xA3, 0x32, 0x62, 0x83, 0x10, 0xC1,
+    0xCD, 0xAB, 0xFF, 0x3A, 0xBD, 0x59, 0xBF, 0x62, 0xE0, 0xA3, 0x8A, 0xE5, 0x1D, 0x6A, 0x7C, 0x3A,
+    0x50, 0x86, 0x89, 0xFD, 0x52, 0xD4, 0x74, 0xA8, 0x95, 0x2C, 0x6C, 0xCC, 0x5B, 0x8C, 0x9B, 0xBF,
+    0x0E, 0x98, 0x10, 0x25, 0x9E, 0xB2, 0xB6, 0x92, 0xF5, 0x90, 0xA4, 0xE8, 0xD0, 0xB0, 0x99, 0x06,
+    0x06, 0x84, 0x23, 0x45, 0xD4, 0xFE, 0x64, 0xB2, 0xD0, 0x50, 0xD9, 0xE0, 0x2D, 0x54, 0x93, 0xF5,
+    0x20, 0xC3, 0x5C, 0x3A, 0x31, 0x4B, 0x00, 0x87, 0x03, 0x32, 0x33, 0xCC, 0x2D, 0x5E, 0xFE, 0x6C,
+    0x40, 0xF5, 0x6F, 0x37, 0x80, 0xEE, 0xC5, 0x6B, 0x6D, 0x62, 0xB7, 0xC8, 0xB6, 0x84, 0x73, 0x8A,
+    0xA5, 0x84, 0x81, 0x55, 0x96, 0x6C, 0x76, 0x2A, 0x7C, 0x4C, 0x19, 0x68, 0xFD, 0x0D, 0xAC, 0x90,
+    0x66, 0x0A, 0xAD, 0xB5, 0x41, 0x7E, 0x24, 0x4B, 0x17, 0x86, 0xA8, 0x42, 0x55, 0x83, 0x48, 0xCC,
+    0x64, 0x8E, 0x11, 0x36, 0x7B, 0xDF, 0xE7, 0xB0, 0x04, 0xC2, 0xBF, 0x98, 0x4A, 0x8D, 0x1D, 0x5A,
+    0xF2, 0x1B, 0xF0, 0x0E, 0xF2, 0x94, 0x8B, 0xA2, 0x1D, 0x65, 0x8B, 0xCE, 0xD2, 0x97, 0x8D, 0xA9,
+    0x0B, 0x40, 0xDE, 0xCE, 0x50, 0xB4, 0xFA, 0xAC, 0x31, 0x73, 0xD7, 0xC9, 0xB9, 0xAA, 0x40, 0x92,
+    0x7E, 0x88, 0xB6, 0xBA, 0x88, 0x83, 0x69, 0xDF, 0x44, 0x84, 0xED, 0xA6, 0x4D, 0x08, 0x67, 0xFD,
+    0x4B, 0xF0, 0xF4, 0x9C, 0x85, 0x66, 0x6E, 0x94, 0xB6, 0xAD, 0xF2, 0x16, 0x92, 0xC9, 0xF8, 0x3C,
+    0x9E, 0x10, 0xB1, 0xB7, 0x9F, 0xA0, 0xB5, 0xAB, 0xE7, 0x16, 0x30, 0xEE, 0x80, 0x43, 0x3B, 0x88,
+    0xC8, 0xD6, 0x39, 0x45, 0x3C, 0xF7, 0x69, 0xCC, 0xFD, 0x4C, 0xFC, 0x50, 0x9B, 0xFA, 0x92, 0x82,
+    0x63, 0x16, 0x1B, 0x7E, 0x87, 0xB6, 0x10, 0x61, 0xCA, 0x76, 0xC1, 0x6B, 0x73, 0xCA, 0xD6, 0xD5,
+    0xAF, 0xA4, 0x7C, 0x7C, 0xA2, 0x0A, 0xD2, 0x76, 0x7A, 0x39, 0x1C, 0x72, 0x40, 0xBF, 0x8E, 0xEA,
+    0x2E, 0xC8, 0x26, 0xE1, 0xD0, 0xC6, 0xD6, 0xC5, 0x36, 0xEB, 0xF9, 0xF7, 0x39, 0x57, 0x32, 0xDD,
+    0xAA, 0x73, 0xF0, 0x41, 0x7E, 0x90, 0x67, 0x9E, 0xCF, 0xF3, 0x13, 0xF2, 0x1C, 0xC1, 0xF3, 0x85,
+    0xCC, 0x3F, 0x15, 0x6D, 0x05, 0xB5, 0x55, 0x7C, 0x05, 0x79, 0xE7, 0x4A, 0xA3, 0xFC, 0x76, 0xA0,
+    0x51, 0x2A, 0xA5, 0xD1, 0xDB, 0x46, 0x0D, 0xE0, 0x8B, 0xC5, 0x30, 0xCF, 0x06, 0xB8, 0x4B, 0x05,
+    0xAA, 0xF5, 0xCB, 0x90, 0x6F, 0x5F, 0x37, 0x40, 0x57, 0x9F, 0x78, 0x7D, 0xBA, 0x62, 0x09, 0x78,
+    0x0B, 0xBF, 0xDE, 0xC7, 0xFD, 0x39, 0x27, 0xDC, 0x7F, 0xB4, 0x03, 0xCC, 0x7F, 0x15, 0x9F, 0xF5,
+    0xAD, 0x23, 0xE0, 0xF3, 0xDA, 0xE8, 0xDE, 0x47, 0xA0, 0xBF, 0x0B, 0x67, 0x3A, 0x81, 0x4C, 0x28,
+    0xB2, 0xDC, 0x2E, 0x18, 0x16, 0xC1, 0x8F, 0x10, 0x4E, 0xF7, 0x74, 0xC3, 0x46, 0xDA, 0x74, 0xAC,
+    0xEE, 0xD9, 0x9C, 0xED, 0x9E, 0xFB, 0xD9, 0x70, 0xF3, 0x91, 0x18, 0x1B, 0x4B, 0xD5, 0x18, 0x75,
+    0xD1, 0xB9, 0x5E, 0x1D, 0xB1, 0x9D, 0x9D, 0x92, 0xEE, 0x89, 0x0D, 0xE7, 0xF7, 0x18, 0xF7, 0x61,
+    0x6E, 0x63, 0xAE, 0xA1, 0xD9, 0x5D, 0x6F, 0x6B, 0x9C, 0x6E, 0x2C, 0x9D, 0xB6, 0x1A, 0x85, 0x82,
+    0xD3, 0x4A, 0x83, 0x0C, 0x07, 0xAB, 0x97, 0x8F, 0xB1, 0xA1, 0x8B, 0x61, 0xBB, 0x71, 0xD9, 0x87,
+    0x4F, 0x41, 0x8A, 0xEF, 0x1E, 0x62, 0xA4, 0xF1, 0x87, 0xF1, 0x6A, 0xCF, 0xA8, 0xE5, 0x7F, 0xF6,
+    0xC0, 0xA7, 0x61, 0x3F, 0x6D, 0x4D, 0xD9, 0x1A, 0xD7, 0x9A, 0x70, 0x88, 0xF2, 0xC8, 0x32, 0x59,
+    0x5F, 0x7D, 0xDD, 0x0C, 0x50, 0x1C, 0x8A, 0x10, 0xBA, 0xAC, 0x3B, 0xC8, 0x9C, 0x8E, 0x1B, 0x9E,
+    0x2A, 0x63, 0x2B, 0xCD, 0xD0, 0xA8, 0xD6, 0x7D, 0x38, 0x41, 0xCB, 0xDA, 0x5A, 0xE6, 0x67, 0x91,
+    0x23, 0x49, 0x90, 0x85, 0x91, 0xDB, 0x1F, 0x1F, 0x19, 0x26, 0xAF, 0xB9, 0xBA, 0x7C, 0xE3, 0xC2,
+    0xD2, 0xD8, 0x21, 0x10, 0xD9, 0xE1, 0xD0, 0x6D, 0x6F, 0x1D, 0x5A, 0x28, 0xE7, 0x79, 0x00, 0x53,
+    0x42, 0x55, 0x56, 0x77, 0xD2, 0x48, 0x09, 0xA8, 0x07, 0xEF, 0x68, 0xFF, 0x77, 0x2C, 0xB7, 0x8E,
+    0x5C, 0x45, 0xF7, 0x2A, 0x68, 0x58, 0x3F, 0xAB, 0xD8, 0x56, 0x59, 0xE7, 0x24, 0xED, 0xD0, 0xF0,
+    0x3C, 0x1A, 0xD1, 0x32, 0x8E, 0x2C, 0xAF, 0xA2, 0xD4, 0x6C, 0xAB, 0x2D, 0xF3, 0xDB, 0xF2, 0x76,
+    0xFD, 0x32, 0x4C, 0xEA, 0xBC, 0xBA, 0x72, 0x43, 0x97, 0x86, 0x14, 0x52, 0x7E, 0xF8, 0x35, 0x56,
+    0x16, 0x7F, 0xFD, 0x12, 0x6B, 0xF3, 0x7F, 0x7C, 0xD1, 0x4F, 0x92, 0xFD, 0xE7, 0xEF, 0xC0, 0x91,
+    0x7E, 0xDD, 0x3C, 0x46, 0x07, 0xFB, 0xC4, 0x07, 0xEE, 0x14, 0xBD, 0xEB, 0xB8, 0xFF, 0xB3, 0x1D,
+    0x0C, 0x5E, 0x71, 0x93, 0x11, 0x15, 0x27, 0x43, 0x03, 0x26, 0x45, 0x4B, 0x56, 0x67, 0xD8, 0x2F,
+    0xAC, 0x03, 0x77, 0xB2, 0x48, 0xEA, 0x98, 0xAD, 0xA0, 0xBB, 0x4C, 0x60, 0xE4, 0x7E, 0x02, 0x73,
+    0x38, 0xD7, 0x21, 0x34, 0x8E, 0xE5, 0xE6, 0x56, 0x86, 0xF2, 0x29, 0x19, 0xA0, 0x5F, 0x49, 0x40,
+    0x7F, 0xB5, 0x91, 0x81, 0x78, 0x48, 0x71, 0xFE, 0x30, 0xA0, 0x6D, 0x3F, 0x37, 0xE6, 0x2C, 0x6D,
+    0x2C, 0x49, 0xDC, 0x0D, 0xEC, 0x1F, 0x3F, 0x40, 0xA6, 0x61, 0xB2, 0x41, 0x59, 0x43, 0x41, 0xC1,
+    0x54, 0x76, 0xC2, 0x2C, 0x3B, 0xD0, 0x7C, 0xC1, 0x18, 0x9D, 0x6C, 0x0C, 0x76, 0xC9, 0x8C, 0x2C,
+    0x3D, 0x78, 0xCE, 0x2F, 0x24, 0xF2, 0xF3, 0x4D, 0xA6, 0xBC, 0xBE, 0xEB, 0x33, 0xEB, 0xB3, 0xE1,
+    0x09, 0xFB, 0xC7, 0xEF, 0x6F, 0xFF, 0xF3, 0xD8, 0xDC, 0xF6, 0x8F, 0x79, 0x80, 0x5C, 0xA9, 0x5F,
+    0x95, 0xEE, 0xCA, 0xA9, 0xBC, 0x28, 0x99, 0x1F, 0xF2, 0x0F, 0x87, 0xF2, 0x7E, 0x8F, 0x26, 0xD9,
+    0x42, 0xF0, 0xBC, 0xDD, 0xBB, 0x51, 0x15, 0x7F, 0x1E, 0xCA, 0x8F, 0x06, 0x3C, 0x31, 0x69, 0x77,
+    0x37, 0x6B, 0x4E, 0x73, 0xFF, 0xE2, 0x0D, 0xEC, 0x8B, 0xFF, 0x94, 0xB4, 0xEE, 0x5E, 0x48, 0x47,
+    0xEC, 0xB0, 0x53, 0x6C, 0x75, 0xA6, 0xF5, 0xF0, 0x02, 0x76, 0xB1, 0xD5, 0x36, 0xC9, 0xA3, 0xD3,
+    0x45, 0x9E, 0x37, 0x10, 0x18, 0x8E, 0x1B, 0x58, 0x56, 0x9D, 0x7E, 0x29, 0x80, 0x9A, 0xB2, 0xF0,
+    0x5E, 0x7C, 0x80, 0x02, 0xF9, 0x79, 0xE4, 0x87, 0x88, 0xF3, 0xA8, 0x1A, 0x89, 0x9B, 0xB7, 0xD7,
+    0x1B, 0x17, 0xAA, 0xA8, 0x79, 0x5F, 0x4D, 0xEB, 0xF8, 0xE5, 0x04, 0x7A, 0xBF, 0xD2, 0xEF, 0x12,
+    0xE1, 0xBD, 0x07, 0x36, 0x7E, 0x36, 0x39, 0x40, 0xD6, 0x27, 0x53, 0xFA, 0x1D, 0x61, 0xC6, 0xF7,
+    0x78, 0xBA, 0xC0, 0x37, 0x3F, 0xCF, 0xC2, 0xEF, 0xA6, 0x6B, 0xE3, 0x5B, 0x14, 0x53, 0xD4, 0xAA,
+    0x19, 0xE3, 0x55, 0x35, 0xC6, 0xAB, 0x6E, 0x6E, 0x6D, 0x04, 0x51, 0xED, 0xEC, 0xD7, 0xAA, 0x1E,
+    0x6E, 0xDE, 0xCF, 0x79, 0x53, 0x05, 0x61, 0xE6, 0xFF, 0xE5, 0xB6, 0xCB, 0x0B, 0x7A, 0x81, 0x0B,
+    0x5E, 0xE2, 0xC2, 0xCB, 0x76, 0xA6, 0xF2, 0x02, 0xFF, 0xFA, 0xE1, 0x78, 0xF9, 0x2F, 0x95, 0x53,
+    0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0x67, 0x8B, 0xB8, 0x70, 0xE1, 0x06, 0x10, 0x22, 0xC5, 0x36,
+    0x34, 0x81, 0x43, 0xFB, 0x05, 0x64, 0x8D, 0x52, 0xA4, 0xA4, 0x81, 0x9A, 0x16, 0x85, 0x22, 0x3F,
+    0x00, 0xD9, 0x95, 0xF8, 0x81, 0x34, 0x54, 0xB4, 0xA9, 0xD2, 0xE4, 0x07, 0x2E, 0xD8, 0x88, 0x82,
+    0x82, 0x22, 0xCE, 0x1F, 0x18, 0xE9, 0x28, 0xA8, 0x72, 0x91, 0xAE, 0x70, 0x14, 0x9F, 0x87, 0x37,
+    0xF6, 0x71, 0x24, 0x8A, 0x50, 0xC4, 0xEE, 0xCC, 0x66, 0x2F, 0x3B, 0x3B, 0x7E, 0xF3, 0xDE, 0xAC,
+    0xCF, 0x2A, 0xAF, 0x56, 0xBA, 0xDE, 0x36, 0xD3, 0x72, 0x63, 0x2D, 0x20, 0xDB, 0xAA, 0x60, 0xB6,
+    0x2B, 0xD8, 0xA4, 0x84, 0x4D, 0x4B, 0xF0, 0xC4, 0x88, 0x74, 0x96, 0xFE, 0xB0, 0x2B, 0x7E, 0x61,
+    0x62, 0x81, 0xD6, 0xE1, 0xDE, 0xC2, 0xBF, 0xF4, 0x22, 0xAD, 0x7A, 0x34, 0x9B, 0x20, 0x9E, 0xB5,
+    0x88, 0xEB, 0x06, 0x71, 0x35, 0x47, 0x72, 0x3A, 0x07, 0xC6, 0xE8, 0x3D, 0x91, 0x06, 0xBC, 0x8B,
+    0x42, 0x16, 0x90, 0xF1, 0x03, 0x3A, 0x50, 0x4C, 0x00, 0xBF, 0x00, 0x8C, 0x54, 0x88, 0xA4, 0x05,
+    0x9C, 0x00, 0x4F, 0xE9, 0x63, 0x9F, 0x4F, 0xC7, 0x05, 0x84, 0xF1, 0x4C, 0x8B, 0x75, 0xD9, 0x5F,
+    0xE5, 0xC1, 0x5D, 0x2C, 0x47, 0xB2, 0x40, 0x42, 0x88, 0x82, 0x8C, 0xE0, 0x8E, 0x82, 0xCD, 0x15,
+    0xA2, 0x03, 0x36, 0xB3, 0xF2, 0x98, 0x6B, 0xFA, 0xA5, 0xD1, 0xFD, 0xD7, 0x19, 0xD3, 0x66, 0xDF,
+    0x7E, 0x2C, 0x60, 0x8F, 0x4E, 0xBE, 0x4B, 0xC8, 0xC4, 0xBC, 0x38, 0x2B, 0x93, 0x85, 0x33, 0xDB,
+    0x35, 0x70, 0x6C, 0xB7, 0xB8, 0xB6, 0x76, 0x6B, 0x86, 0x68, 0xAE, 0x6B, 0x52, 0x5B, 0xFE, 0x3F,
+    0x2B, 0xB3, 0x13, 0xA6, 0x0E, 0xA9, 0x30, 0x35, 0xA1, 0xE1, 0xCA, 0x18, 0x09, 0x6F, 0xA4, 0x8A,
+    0x36, 0x93, 0x8E, 0xD8, 0xCB, 0xD5, 0x72, 0xCA, 0x52, 0xB2, 0x4B, 0x1E, 0xC4, 0x32, 0xD3, 0x82,
+    0xC3, 0xE3, 0x60, 0xA5, 0x74, 0xC1, 0x9F, 0xCD, 0x8A, 0x5C, 0xB6, 0x5B, 0x16, 0x33, 0xD2, 0xEA,
+    0xE1, 0x1B, 0x48, 0x70, 0x73, 0x28, 0x67, 0x4A, 0x8A, 0xE4, 0x89, 0x4C, 0x7D, 0xD5, 0xA7, 0xF7,
+    0xFD, 0x74, 0x9C, 0x9B, 0xD8, 0x20, 0xF4, 0x1C, 0x20, 0xD1, 0xEA, 0x8F, 0x4C, 0x94, 0x3B, 0x29,
+    0x82, 0x13, 0x09, 0xF7, 0x8B, 0x9F, 0x39, 0x94, 0xB5, 0x4B, 0x42, 0x3E, 0x6F, 0x09, 0x9B, 0xC5,
+    0xE6, 0x8C, 0x7D, 0x86, 0xEB, 0xBE, 0x87, 0x25, 0x8B, 0x82, 0x9D, 0xE2, 0xF0, 0xE6, 0x79, 0x4F,
+    0xE4, 0x0C, 0x29, 0x6B, 0x66, 0xC1, 0xAC, 0x36, 0xF0, 0xCB, 0x28, 0x80, 0x0E, 0xA3, 0x16, 0x11,
+    0xB5, 0x9C, 0xEB, 0x79, 0x76, 0xE3, 0x7C, 0xE0, 0x82, 0x6E, 0x94, 0x12, 0xFE, 0xE9, 0x7A, 0x66,
+    0x0C, 0x39, 0x28, 0x58, 0x89, 0x04, 0x96, 0x72, 0x01, 0x72, 0x47, 0xB6, 0x6C, 0x37, 0xC4, 0x68,
+    0x2C, 0xC7, 0xCE, 0xE1, 0xE1, 0x0A, 0xD4, 0x9F, 0x51, 0x2C, 0x7F, 0xAB, 0xB3, 0x0C, 0xB0, 0x71,
+    0x20, 0xDC, 0xF8, 0xB9, 0x32, 0xB9, 0xDC, 0xAC, 0xC9, 0x90, 0xC7, 0x52, 0x79, 0x16, 0x5F, 0x5C,
+    0x0C, 0xDF, 0xD1, 0x58, 0xBD, 0x83, 0xA8, 0x98, 0x2A, 0x55, 0xE4, 0x93, 0x61, 0x1F, 0x77, 0x6B,
+    0x24, 0x73, 0xC4, 0x0D, 0xD5, 0xBC, 0x93, 0x53, 0xFE, 0xE7, 0xD2, 0x6E, 0xC2, 0x51, 0x39, 0x8B,
+    0xF7, 0xA6, 0x6C, 0x0D, 0x3B, 0x38, 0x6F, 0x4D, 0xCE, 0x1E, 0x5E, 0xAE, 0x96, 0xFD, 0x3C, 0xE2,
+    0x66, 0x62, 0x3F, 0xB4, 0x7B, 0x38, 0xCE, 0x54, 0x1D, 0x17, 0x77, 0xA6, 0xEE, 0x55, 0x80, 0x92,
+    0xC0, 0x82, 0x93, 0xEE, 0x95, 0x96, 0x3F, 0x80, 0x4F, 0x65, 0xAA, 0x6C, 0xC4, 0x8D, 0x20, 0x6E,
+    0xFF, 0xC3, 0x9B, 0x22, 0x4F, 0x1A, 0x5F, 0x99, 0x19, 0xC5, 0xAC, 0xF9, 0xA1, 0xA0, 0x8D, 0xA1,
+    0xC3, 0x35, 0xBE, 0xF1, 0x07, 0x1E, 0xB7, 0xCC, 0x03, 0xDF, 0xB8, 0xE6, 0xB3, 0x76, 0x8B, 0x62,
+    0xB3, 0xA5, 0xBE, 0x01, 0xC2, 0xA3, 0x52, 0xD4, 0x2B, 0x6A, 0x54, 0x3B, 0x2C, 0x7A, 0x9D, 0x34,
+    0x22, 0x5C, 0x8B, 0x50, 0x2E, 0x7D, 0xF3, 0xB6, 0x89, 0x6E, 0x99, 0x4F, 0x14, 0x4A, 0xD3, 0x6B,
+    0xC6, 0xB7, 0x05, 0x57, 0x0E, 0xCA, 0xB2, 0xE3, 0xA2, 0x73, 0xBE, 0xEF, 0xBA, 0x45, 0x5A, 0xED,
+    0x41, 0x9F, 0x9C, 0xC9, 0x4D, 0x70, 0xDC, 0x6D, 0x20, 0xDA, 0x77, 0xD2, 0x3A, 0xAD, 0xA5, 0x08,
+    0xA6, 0x22, 0xFD, 0x13, 0xAC, 0x07, 0x48, 0x39, 0xA2, 0xB5, 0x0A, 0x6C, 0x65, 0xD4, 0xE5, 0xF5,
+    0x5C, 0x13, 0x16, 0xFB, 0xD8, 0xED, 0x65, 0xBA, 0x7A, 0xCA, 0xE0, 0x91, 0xE8, 0x45, 0x22, 0x7F,
+    0xF7, 0x8F, 0xF1, 0x46, 0xE5, 0x2F, 0xD5, 0x4C, 0xA5, 0xDD, 0xF9, 0xD7, 0x6A, 0xA4, 0x17, 0xEC,
+    0xBC, 0x7C, 0x24, 0x79, 0xDA, 0xE5, 0x43, 0xEF, 0x5E, 0xB5, 0xE1, 0x16, 0x9B, 0xD2, 0xD6, 0x23,
+    0x48, 0xF7, 0xA9, 0x17, 0xB3, 0x64, 0x07, 0xEB, 0xF8, 0x0D, 0xBD, 0x59, 0x3F, 0x8C, 0x15, 0xC7,
+    0x19, 0xFF, 0x76, 0x17, 0xBC, 0x81, 0x2D, 0x86, 0xE2, 0x90, 0x6C, 0x11, 0x33, 0x29, 0x5C, 0x24,
+    0x08, 0x6E, 0xDB, 0x2B, 0x0C, 0xB3, 0x26, 0x52, 0x5C, 0xA4, 0xB9, 0x22, 0x47, 0x8A, 0x14, 0xA4,
+    0x8C, 0x5D, 0x98, 0x86, 0x82, 0x48, 0xDC, 0xCD, 0x82, 0x0B, 0x0A, 0x0A, 0x53, 0x44, 0x4A, 0x61,
+    0x29, 0x4E, 0x41, 0x91, 0x5C, 0x0A, 0x28, 0x28, 0x5C, 0x70, 0xB7, 0x13, 0x52, 0xA4, 0x70, 0x33,
+    0x10, 0x59, 0x29, 0xD2, 0x6C, 0x22, 0xA4, 0x48, 0x71, 0x71, 0x9B, 0x68, 0x1D, 0xED, 0x71, 0xBB,
+    0x3B, 0xF9, 0x7D, 0xB3, 0xFB, 0xDE, 0xBD, 0x23, 0x87, 0x0D, 0x3C, 0x8E, 0x7D, 0xFB, 0x7D, 0xDA,
+    0x3F, 0xB3, 0xDF, 0x9F, 0x99, 0xEF, 0xEF, 0xBC, 0xB7, 0x48, 0xE7, 0x45, 0xAE, 0xB3, 0xE3, 0x44,
+    0x74, 0x9C, 0xD4, 0xE4, 0x97, 0xE9, 0xC9, 0x0F, 0x6F, 0x3F, 0xCC, 0xF0, 0x92, 0x04, 0x9F, 0x41,
+    0xB1, 0x1D, 0xBB, 0x4E, 0xBA, 0x36, 0x2D, 0x0F, 0x29, 0x43, 0x2A, 0x9F, 0x39, 0x0D, 0xA5, 0xD5,
+    0x5B, 0xC2, 0x75, 0x18, 0x40, 0xC5, 0xE3, 0x61, 0x3C, 0x1D, 0x26, 0x7F, 0xE8, 0x6D, 0x0A, 0x9D,
+    0xA3, 0xD8, 0xF5, 0x94, 0xD4, 0x87, 0x48, 0x54, 0x34, 0x85, 0x3B, 0x4F, 0x6E, 0x93, 0x73, 0xB5,
+    0x87, 0xD9, 0xE7, 0xC2, 0xE2, 0xB3, 0x9C, 0xF0, 0xDC, 0x99, 0x09, 0x80, 0xD2, 0xD9, 0x0F, 0xDE,
+    0xD5, 0x2C, 0x41, 0x23, 0xAF, 0x35, 0x29, 0xB5, 0x8A, 0xEE, 0xA7, 0x59, 0x23, 0xBF, 0xAA, 0x95,
+    0x6B, 0xD7, 0xDC, 0xC6, 0x02, 0x2D, 0x14, 0x94, 0x54, 0x3A, 0x17, 0x36, 0x35, 0xA9, 0x11, 0x56,
+    0x65, 0x49, 0x55, 0x50, 0x54, 0x77, 0x14, 0x6E, 0xB7, 0x20, 0x56, 0x13, 0x15, 0x15, 0xBD, 0xE1,
+    0x9E, 0x50, 0x02, 0x79, 0x0E, 0xEB, 0x2F, 0x89, 0x52, 0xE3, 0xAF, 0x19, 0x82, 0x4B, 0xC3, 0x3D,
+    0xC3, 0xD5, 0xE9, 0xC1, 0x0A, 0x2C, 0x4C, 0xEF, 0x7E, 0x81, 0xBB, 0xC4, 0xE5, 0xCA, 0x95, 0xFA,
+    0x47, 0x66, 0x13, 0x32, 0x66, 0x94, 0xD6, 0x24, 0x5D, 0xA6, 0xB4, 0x5D, 0x8D, 0xAB, 0x8D, 0xA8,
+    0xD2, 0x3F, 0xAC, 0xD2, 0x1D, 0x1B, 0xBB, 0x9C, 0xB4, 0x85, 0x30, 0x14, 0x55, 0xB7, 0x93, 0xB2,
+    0x70, 0x46, 0xF7, 0x4C, 0xE9, 0x4A, 0x92, 0xF5, 0xD2, 0x6C, 0x48, 0xB3, 0x30, 0xCE, 0x0D, 0x9D,
+    0xC0, 0x48, 0xDA, 0xFC, 0xB4, 0xA1, 0xA8, 0xA4, 0x14, 0x93, 0xF6, 0x41, 0x62, 0xCE, 0xC4, 0xEE,
+    0x81, 0x5D, 0x92, 0xEF, 0x65, 0xD5, 0xE5, 0xB3, 0x44, 0x77, 0xEF, 0xBE, 0x4B, 0x74, 0xB9, 0x82,
+    0x20, 0x4B, 0x1E, 0xF9, 0x5B, 0x7E, 0x71, 0x6F, 0x29, 0x25, 0xAA, 0x4E, 0x27, 0xEE, 0x7A, 0x29,
+    0x82, 0xCD, 0xD8, 0xC4, 0x16, 0x04, 0x82, 0xFE, 0x02, 0x34, 0x95, 0xCE, 0xD2, 0xE4, 0x38, 0xD1,
+    0xE1, 0x96, 0x0E, 0x89, 0xEC, 0x8D, 0x3B, 0x99, 0x72, 0xD9, 0xAA, 0xC8, 0x56, 0x53, 0xBE, 0x48,
+    0xAE, 0x67, 0x74, 0x2C, 0x20, 0x5A, 0x05, 0xE3, 0x5E, 0x54, 0x51, 0xAB, 0x8C, 0xA8, 0x8A, 0x2C,
+    0x7D, 0xD8, 0x93, 0x7A, 0xD0, 0x61, 0x15, 0xB0, 0x62, 0x8D, 0x32, 0x41, 0x27, 0x4A, 0xDA, 0x8C,
+    0x2B, 0x7A, 0x27, 0xF4, 0x96, 0x80, 0x95, 0xF0, 0xF0, 0xE1, 0x7A, 0x81, 0x3B, 0xB9, 0x07, 0x8E,
+    0xFF, 0x44, 0x77, 0xF8, 0xB5, 0xFB, 0x6A, 0x76, 0xF4, 0x57, 0xD0, 0x4C, 0xB8, 0xF3, 0x76, 0x49,
+    0x9C, 0x30, 0xD5, 0x65, 0x11, 0x99, 0xBB, 0x77, 0x81, 0x2E, 0x57, 0xE2, 0x62, 0xBE, 0x54, 0x89,
+    0x1E, 0x9A, 0x89, 0x8F, 0xA0, 0x99, 0x10, 0xD9, 0xBD, 0x25, 0x11, 0x9B, 0xEA, 0xB4, 0x88, 0x1E,
+    0x95, 0xE2, 0x08, 0xFD, 0x7A, 0x5F, 0xCD, 0x8E, 0xAF, 0xAC, 0x2C, 0x2B, 0xE7, 0x4A, 0x06, 0x5E,
+    0x94, 0x86, 0x54, 0x4F, 0x1B, 0x30, 0x07, 0x91, 0xD7, 0x22, 0x6F, 0x65, 0xA6, 0x1D, 0xC9, 0x96,
+    0x02, 0x08, 0xFD, 0x03, 0xB6, 0x9C, 0xBD, 0x30, 0xD1, 0xA2, 0x00, 0x3C, 0xFD, 0x8E, 0x16, 0x88,
+    0xD6, 0xD7, 0xD7, 0xA7, 0x63, 0x68, 0x99, 0x64, 0x47, 0xCA, 0xD1, 0x9B, 0x2A, 0x83, 0x7B, 0x90,
+    0xA6, 0xA0, 0x25, 0x4C, 0x88, 0x84, 0x0B, 0x38, 0xB0, 0xC9, 0x4F, 0xAD, 0x67, 0x18, 0x93, 0xFA,
+    0x31, 0x0B, 0x32, 0xC3, 0x44, 0xC4, 0x1D, 0xC5, 0x58, 0x6F, 0x5C, 0x8B, 0xFC, 0x97, 0x97, 0x72,
+    0x88, 0x72, 0xE2, 0xB1, 0x17, 0x52, 0x96, 0x2A, 0xBB, 0x4F, 0xA7, 0xB2, 0xA3, 0xB7, 0x54, 0x2E,
+    0xED, 0x37, 0x43, 0x6A, 0x95, 0xD1, 0x16, 0xFA, 0x01, 0xB6, 0xAC, 0x2A, 0xBE, 0xC0, 0x33, 0xA2,
+    0xFD, 0x00, 0xDE, 0x65, 0x24, 0x40, 0xB9, 0xBF, 0x1A, 0xED, 0xFE, 0x64, 0x8A, 0xA7, 0x80, 0x9F,
+    0x29, 0x40, 0x0A, 0x48, 0x00, 0xF4, 0x53, 0x40, 0xF4, 0x1C, 0x80, 0x63, 0x91, 0x0A, 0x1F, 0x23,
+    0xE0, 0xB7, 0xD0, 0x38, 0xAA, 0xA2, 0xAA, 0xA8, 0xD8, 0x33, 0x83, 0x36, 0x6E, 0xD3, 0x76, 0xB1,
+    0x3D, 0xD4, 0xD2, 0xEE, 0xEF, 0x77, 0xF8, 0x20, 0x6E, 0x28, 0x75, 0x74, 0x4E, 0xE4, 0xAB, 0x89,
+    0xB9, 0x9A, 0x98, 0xB3, 0x89, 0x51, 0x17, 0x73, 0x58, 0x60, 0xD8, 0x50, 0x40, 0xC7, 0x08, 0x9E,
+    0x4B, 0x6C, 0x63, 0x6C, 0x6B, 0x6C, 0x73, 0xE4, 0xE0, 0xEF, 0x2E, 0xA9, 0xC2, 0x36, 0xB5, 0x49,
+    0xAD, 0x73, 0x59, 0x3A, 0x4A, 0xAF, 0xB5, 0x14, 0xD2, 0xF7, 0x28, 0xA8, 0x79, 0x0A, 0x41, 0x10,
+    0xB3, 0x9E, 0x36, 0xB4, 0x41, 0x74, 0xAE, 0x01, 0x17, 0x0A, 0x9A, 0xB0, 0x66, 0x1C, 0x55, 0x8C,
+    0x13, 0xC3, 0x58, 0xE6, 0x58, 0xEC, 0x46, 0x85, 0x8C, 0xD7, 0x62, 0xE0, 0xBA, 0x15, 0x3C, 0xB4,
+    0x3E, 0x03, 0x1C, 0x55, 0x57, 0x80, 0x13, 0x5B, 0x01, 0x8B, 0x07, 0xCE, 0xC1, 0x6B, 0x31, 0x67,
+    0x39, 0xAD, 0x11, 0x93, 0xF3, 0xE7, 0x0B, 0xF1, 0xBA, 0xB1, 0xCD, 0xBC, 0xA0, 0x26, 0x78, 0x49,
+    0x9D, 0x83, 0x17, 0xC9, 0x9C, 0x49, 0xA4, 0x19, 0x78, 0x31, 0xD9, 0xC4, 0x06, 0xCC, 0xCB, 0xC0,
+    0x4E, 0x60, 0xBB, 0xF2, 0xCB, 0x0C, 0x0F, 0x15, 0x62, 0x58, 0xEB, 0x31, 0x1F, 0x1C, 0x37, 0xB2,
+    0x02, 0xF7, 0xF4, 0xCE, 0x2A, 0xB3, 0x3B, 0x4B, 0x0D, 0x1D, 0x6D, 0x42, 0xD8, 0x55, 0x1D, 0x97,
+    0x74, 0x78, 0x43, 0x60, 0x98, 0x92, 0xD7, 0x6B, 0xAB, 0x55, 0x5C, 0xBB, 0x6E, 0x43, 0xD4, 0xBA,
+    0x6E, 0x17, 0x6B, 0x0A, 0xEB, 0xB5, 0x1A, 0x4C, 0xFE, 0x53, 0x53, 0xF2, 0xE0, 0x11, 0x68, 0x7C,
+    0x0C, 0x13, 0x55, 0x11, 0xD0, 0x1A, 0x5E, 0x81, 0x3E, 0x10, 0xE2, 0x82, 0x36, 0x7C, 0xAA, 0x6C,
+    0x0C, 0x02, 0x50, 0x0D, 0xD7, 0x9A, 0x42, 0x4C, 0x3C, 0xE6, 0xDF, 0xB2, 0xD9, 0x68, 0x0E, 0x5F,
+    0x0B, 0xFA, 0x5F, 0xAD, 0x72, 0x7D, 0xE2, 0x1A, 0x5A, 0x19, 0xC7, 0xA6, 0xEC, 0x61, 0x09, 0x94,
+    0x66, 0x3B, 0xC7, 0x71, 0x6E, 0x12, 0x49, 0x78, 0x3E, 0x49, 0x74, 0x3C, 0x04, 0x5E, 0x41, 0x8A,
+    0x03, 0x80, 0x66, 0xFB, 0x2B, 0x38, 0x6A, 0x22, 0xAE, 0x91, 0x0F, 0x16, 0x61, 0x8B, 0x15, 0x8D,
+    0xDA, 0xB8, 0xA6, 0x78, 0xFB, 0x67, 0x0D, 0x87, 0xD6, 0x96, 0x84, 0x73, 0x1C, 0x86, 0x90, 0x01,
+    0x94, 0x25, 0xC7, 0xE9, 0xA2, 0x40, 0x76, 0x81, 0x88, 0x58, 0x0A, 0x65, 0x46, 0xFA, 0x8A, 0x19,
+    0x33, 0xD1, 0x90, 0x19, 0x45, 0xE5, 0x6B, 0xE2, 0x9B, 0xB4, 0x13, 0xCA, 0x3A, 0x05, 0xD1, 0x26,
+    0xB6, 0x07, 0xCE, 0x57, 0xE6, 0x50, 0xAE, 0xD8, 0x01, 0x7A, 0xC2, 0xD6, 0x50, 0x2E, 0x1E, 0xBC,
+    0xAA, 0x4B, 0x09, 0x6C, 0x61, 0x13, 0x04, 0x68, 0x93, 0x2D, 0x6B, 0x9A, 0x7F, 0x0E, 0x90, 0x65,
+    0x5C, 0x4F, 0x28, 0x9F, 0x3C, 0x39, 0x41, 0xFE, 0xF6, 0x60, 0xD6, 0xD2, 0x71, 0x11, 0x11, 0x7A,
+    0x1C, 0x79, 0x9C, 0xFC, 0xB7, 0x5F, 0x59, 0x26, 0xF1, 0x77, 0xE6, 0x26, 0xFF, 0xC8, 0x58, 0x79,
+    0xAC, 0xDF, 0xE3, 0x9C, 0x51, 0x04, 0xCE, 0x55, 0xD4, 0x33, 0x0E, 0xFB, 0x0B, 0xFD, 0x4A, 0x16,
+    0x31, 0x7D, 0x66, 0x05, 0xEC, 0x79, 0x91, 0xB4, 0x01, 0xA2, 0x38, 0x72, 0x20, 0xA8, 0xE9, 0x8C,
+    0x31, 0x3C, 0x9E, 0x29, 0x7B, 0x97, 0x72, 0xB7, 0xF8, 0xDB, 0x18, 0xB4, 0x44, 0x17, 0xDA, 0xB4,
+    0x24, 0x2F, 0x05, 0xC7, 0xC6, 0x22, 0xDB, 0x0B, 0xFC, 0x8C, 0xDF, 0x29, 0x8C, 0x91, 0x0D, 0xDD,
+    0x02, 0xF5, 0x32, 0x64, 0x19, 0x90, 0x3C, 0x28, 0x82, 0xB9, 0xF9, 0x99, 0x6A, 0x07, 0x90, 0x0C,
+    0xDE, 0xF6, 0x41, 0x12, 0x6E, 0xC8, 0x4E, 0xA8, 0xF8, 0xB6, 0x00, 0x7B, 0xD7, 0xF0, 0xB9, 0xB2,
+    0x8C, 0xB9, 0x1B, 0x4F, 0x57, 0x8D, 0xE7, 0xEC, 0x43, 0x7E, 0xDE, 0x0C, 0xE7, 0x48, 0x08, 0xE2,
+    0x77, 0xA3, 0x4B, 0xBD, 0x34, 0x9D, 0x88, 0xEB, 0xA4, 0x3C, 0xFD, 0xC4, 0xAE, 0x22, 0x4A, 0xBD,
+    0x2C, 0x9D, 0x93, 0xA1, 0x55, 0x3F, 0xAE, 0xD4, 0xFB, 0xE5, 0x61, 0x4E, 0xCD, 0x2F, 0x2F, 0x0C,
+    0xA2, 0x1B, 0xEC, 0x24, 0xC2, 0xE5, 0x7D, 0x1F, 0x3B, 0x38, 0xFB, 0x21, 0xC1, 0x21, 0xA7, 0xD0,
+    0xB7, 0x9E, 0x5C, 0xAF, 0xF9, 0xF1, 0x34, 0x10, 0xEA, 0x99, 0x4E, 0x62, 0xE7, 0xA2, 0x13, 0x72,
+    0x81, 0x6B, 0xE4, 0x17, 0xD5, 0xB9, 0x80, 0xC5, 0x13, 0xAE, 0xC2, 0x99, 0x38, 0x4B, 0x7B, 0x14,
+    0xD8, 0xFF, 0x8C, 0x9D, 0x1D, 0xC6, 0x9F, 0x49, 0xF2, 0x42, 0x98, 0x35, 0x61, 0x16, 0x82, 0x97,
+    0x17, 0x26, 0x71, 0xDB, 0xDE, 0x80, 0x2D, 0xA3, 0x86, 0xC4, 0xD7, 0x17, 0x39, 0xDB, 0x42, 0x3E,
+    0x4E, 0xB4, 0x19, 0x10, 0x92, 0xEC, 0xD7, 0x19, 0x6A, 0x0B, 0x67, 0xA7, 0xC8, 0x70, 0xF1, 0x87,
+    0x17, 0xE3, 0x10, 0x3F, 0x18, 0x45, 0xCF, 0x40, 0x60, 0x20, 0xB5, 0xCD, 0xC5, 0x40, 0xC8, 0x7E,
+    0xB6, 0x63, 0x28, 0xDC, 0x81, 0xE5, 0x86, 0x66, 0x75, 0x8C, 0x21, 0x05, 0xB2, 0x0D, 0xC1, 0x9B,
+    0x34, 0xD7, 0xD8, 0x40, 0x2D, 0xA3, 0x1E, 0xA8, 0x73, 0x40, 0xBD, 0xCE, 0x81, 0x94, 0xD5, 0x5C,
+    0x67, 0x02, 0x21, 0xCD, 0x53, 0x1F, 0xB5, 0x40, 0x41, 0xAF, 0x30, 0xF9, 0x0E, 0x57, 0x70, 0x05,
+    0xA0, 0x94, 0x91, 0x60, 0x94, 0x30, 0x8A, 0xDC, 0x24, 0x25, 0xB1, 0xE1, 0x7A, 0x27, 0xA1, 0xCE,
+    0xDF, 0x4F, 0x82, 0x57, 0xCA, 0x62, 0x78, 0x5F, 0xF7, 0xC1, 0xA1, 0x89, 0x1D, 0x3B, 0x19, 0x0A,
+    0x74, 0x4E, 0x7F, 0x9A, 0xFB, 0x92, 0x02, 0xC8, 0xC2, 0x09, 0xD3, 0x19, 0xE4, 0x5F, 0x70, 0x07,
+    0x63, 0x30, 0xB8, 0xC8, 0x65, 0x13, 0xBA, 0x81, 0x40, 0xE8, 0x6D, 0xEB, 0x12, 0x17, 0xAE, 0x33,
+    0x87, 0xE7, 0x8E, 0x4A, 0x1F, 0xA1, 0x69, 0x4F, 0x5E, 0x7A, 0x1D, 0xCC, 0x63, 0x1F, 0xBC, 0x7C,
+    0xA8, 0xE4, 0xD8, 0xDD, 0x4C, 0xB9, 0x1F, 0x30, 0x73, 0x99, 0xC3, 0xC5, 0xF5, 0x0E, 0x50, 0xCF,
+    0x15, 0x77, 0xB5, 0x98, 0xBD, 0x1E, 0xBE, 0x67, 0x62, 0x5C, 0x69, 0xDF, 0xFE, 0xF9, 0x34, 0x15,
+    0xBC, 0xB6, 0xC9, 0x7E, 0x9B, 0x96, 0x54, 0xD6, 0xC9, 0xBF, 0x80, 0x72, 0x19, 0xE0, 0x39, 0xBC,
+    0x0E, 0x6E, 0xF9, 0xCF, 0x5A, 0x5D, 0xEB, 0x16, 0xE9, 0xEA, 0x21, 0x94, 0xAE, 0x44, 0xDF, 0x61,
+    0x39, 0x0A, 0xFE, 0xB8, 0xDB, 0x23, 0x47, 0xCC, 0x72, 0x08, 0x34, 0x79, 0xB9, 0x62, 0x39, 0x56,
+    0x59, 0x8E, 0x06, 0x22, 0x9C, 0xAF, 0x80, 0xDE, 0xB7, 0x90, 0xE3, 0x13, 0x0C, 0x50, 0x5B, 0x2C,
+    0x47, 0xC7, 0x72, 0xB4, 0x13, 0x39, 0x62, 0xEF, 0x61, 0x5B, 0xE0, 0x17, 0xEF, 0xB1, 0xB9, 0x90,
+    0xDB, 0x45, 0xCE, 0x1D, 0xBC, 0xEA, 0xE3, 0xA2, 0xA3, 0x95, 0x6D, 0x1C, 0x5C, 0xFD, 0x05, 0xA0,
+    0x29, 0xB2, 0xB8, 0xD1, 0x56, 0x56, 0xDC, 0x26, 0xC1, 0x91, 0xF3, 0xC0, 0x75, 0x33, 0x4C, 0xBA,
+    0xA1, 0xD0, 0x63, 0x1E, 0x63, 0x95, 0xF7, 0xCA, 0x79, 0x70, 0xCE, 0x83, 0x8A, 0x61, 0x03, 0x5D,
+    0x6D, 0xFA, 0xCA, 0x79, 0x04, 0xE5, 0x69, 0x34, 0xF8, 0xDC, 0xE4, 0xA3, 0xE8, 0x5E, 0x5E, 0x38,
+    0x18, 0x1D, 0x78, 0x21, 0x78, 0xAE, 0xB8, 0x98, 0x17, 0xF9, 0xF8, 0x24, 0xEC, 0xB4, 0x89, 0x7C,
+    0xD3, 0x22, 0x2A, 0x51, 0x25, 0x75, 0x6A, 0xB9, 0x9D, 0x09, 0x3B, 0x54, 0x34, 0x08, 0x7D, 0x54,
+    0x70, 0xDA, 0x86, 0x89, 0xC9, 0xD9, 0x5D, 0x8D, 0xFF, 0x07, 0xAE, 0x7F, 0xDC, 0x04, 0x38, 0x5B,
+    0x20, 0x76, 0xFA, 0xC6, 0x33, 0x70, 0x19, 0x62, 0x27, 0x43, 0x3E, 0x00, 0xEE, 0xFF, 0xC0, 0x0D,
+    0x69, 0xC7, 0xE9, 0x91, 0xDC, 0xCA, 0xCC, 0x77, 0xA3, 0x94, 0x41, 0xE1, 0xAD, 0x92, 0x5B, 0xC1,
+    0x52, 0xB1, 0x2E, 0x08, 0xE7, 0x03, 0x68, 0xA3, 0xAE, 0xC1, 0x4E, 0x3F, 0x6E, 0x47, 0x40, 0xAA,
+    0xB8, 0x86, 0x31, 0x79, 0xDA, 0xAA, 0x3C, 0xEE, 0x54, 0x8E, 0x38, 0xCC, 0x70, 0xF3, 0xD3, 0x4E,
+    0xDD, 0x74, 0xAD, 0xBA, 0xE1, 0xA6, 0x31, 0x2E, 0xEA, 0xC6, 0x9A, 0x9C, 0xCB, 0xB3, 0xB8, 0x1C,
+    0xF9, 0x58, 0x84, 0x24, 0x2E, 0xC8, 0x7A, 0x3A, 0xE2, 0xB9, 0x63, 0xC0, 0x05, 0xC7, 0x89, 0x02,
+    0x4D, 0x38, 0x4B, 0x5A, 0xE0, 0x29, 0x03, 0x7E, 0x5F, 0x41, 0x7A, 0x04, 0x78, 0xD9, 0xA5, 0xBB,
+    0xD3, 0x19, 0xB5, 0x83, 0xFE, 0x5C, 0x6E, 0xAF, 0xD2, 0xAB, 0xA1, 0x89, 0x24, 0x1C, 0x42, 0xEC,
+    0xE4, 0x1F, 0x0D, 0x9A, 0x9D, 0x8D, 0xB9, 0x69, 0x86, 0xF5, 0x49, 0xCC, 0xE5, 0x06, 0x09, 0xAC,
+    0xE3, 0xDB, 0xE1, 0xFC, 0x7A, 0xC7, 0xF9, 0x3D, 0x12, 0x0F, 0x5B, 0x0F, 0x41, 0xB6, 0x3C, 0xBF,
+    0xCE, 0x9C, 0x8F, 0x58, 0xE7, 0x47, 0xA5, 0x07, 0xBE, 0xA6, 0x8F, 0xE6, 0x9F, 0xCB, 0xD0, 0xE5,
+    0xFA, 0x16, 0xBE, 0xDE, 0x19, 0x0A, 0x6E, 0xDE, 0x26, 0x03, 0x69, 0xED, 0x0B, 0x59, 0x94, 0xE9,
+    0x2B, 0x6E, 0x45, 0xB3, 0x7D, 0xF1, 0x66, 0xC3, 0x13, 0xC6, 0x45, 0x36, 0x58, 0xB0, 0x63, 0x71,
+    0x02, 0x67, 0x02, 0x2A, 0xFE, 0xE6, 0x9E, 0xDC, 0x01, 0xCD, 0x3F, 0xE3, 0x5B, 0xD9, 0x7B, 0x5F,
+    0x18, 0x9D, 0xE8, 0x71, 0xE2, 0x5A, 0xE9, 0x1A, 0x55, 0xFE, 0x1C, 0x61, 0xB9, 0x98, 0xA9, 0x80,
+    0xE0, 0x5E, 0xDA, 0xBC, 0xA9, 0x5C, 0x2B, 0x1C, 0x02, 0x63, 0xCD, 0x9B, 0x30, 0xE8, 0x56, 0x11,
+    0xFF, 0xD1, 0x45, 0x3B, 0x2E, 0xCF, 0x9E, 0x65, 0x89, 0x54, 0xDC, 0xC2, 0x2A, 0xB5, 0x08, 0xCA,
+    0xDC, 0x0F, 0xA0, 0x1D, 0x80, 0x8C, 0xC5, 0x0A, 0xBC, 0x65, 0xDC, 0x32, 0x2C, 0xC6, 0x20, 0x8A,
+    0x12, 0x9E, 0x52, 0x48, 0xC5, 0x33, 0x10, 0xEC, 0x4A, 0xB4, 0xAF, 0x25, 0xCE, 0x4D, 0x73, 0x1F,
+    0x4B, 0x9C, 0x87, 0xE6, 0x7E, 0x96, 0x33, 0xA7, 0x8C, 0xBB, 0x8D, 0x85, 0x8F, 0xFA, 0xE1, 0x6D,
+    0xAE, 0x7F, 0x9F, 0xE7, 0xE4, 0x55, 0x48, 0x6A, 0x69, 0xF8, 0xB3, 0x53, 0xE0, 0xF9, 0xAC, 0xDF,
+    0x4C, 0x3D, 0x5C, 0x0E, 0xF5, 0x30, 0xFD, 0x9E, 0x78, 0x1D, 0x9F, 0xE3, 0x3C, 0x9D, 0x64, 0xE8,
+    0x50, 0x37, 0x27, 0x35, 0xF0, 0x8B, 0x08, 0x87, 0xE3, 0xDE, 0x77, 0x29, 0xE8, 0x41, 0x47, 0xE3,
+    0x5E, 0x57, 0x50, 0x1A, 0x4A, 0x96, 0xBD, 0xF7, 0x97, 0xD0, 0x15, 0xB9, 0x18, 0x0C, 0x97, 0x13,
+    0xB5, 0x2D, 0x50, 0x1F, 0xC0, 0x44, 0x3D, 0xE0, 0x9A, 0x9F, 0xF1, 0xBB, 0x4C, 0xF8, 0xF2, 0x60,
+    0x68, 0xF2, 0xE8, 0xF3, 0x04, 0x55, 0xE8, 0x16, 0x25, 0x5B, 0x28, 0x49, 0x83, 0xE1, 0xD9, 0x29,
+    0xDE, 0x24, 0x52, 0x5C, 0x6D, 0x83, 0x56, 0xAD, 0x51, 0x3F, 0xF3, 0x4E, 0xDD, 0xB7, 0xED, 0xE6,
+    0x49, 0x3B, 0x4D, 0xEB, 0x7A, 0x4C, 0xEB, 0xBE, 0x8B, 0x7A, 0x6A, 0x31, 0x2D, 0xEF, 0xB5, 0x61,
+    0x49, 0xF7, 0xCA, 0x86, 0x72, 0x22, 0x45, 0x19, 0xA3, 0x4D, 0xEA, 0xE5, 0xEB, 0xA1, 0x57, 0x3D,
+    0x93, 0x9D, 0xD0, 0x34, 0x23, 0x25, 0xC4, 0xFF, 0x86, 0x91, 0xE4, 0x6B, 0x73, 0xD3, 0x0C, 0x1A,
+    0x81, 0xA5, 0xDB, 0x44, 0x55, 0x82, 0x06, 0x20, 0x7C, 0x3C, 0x37, 0xBD, 0xD0, 0x7E, 0x4E, 0x49,
+    0xD5, 0xC2, 0x67, 0xD9, 0x80, 0x8F, 0xCD, 0xAF, 0xF3, 0xD9, 0x31, 0x10, 0x6C, 0x02, 0xBE, 0x3F,
+    0xFA, 0xDC, 0x74, 0x57, 0x7A, 0xDD, 0xEF, 0xDF, 0xF2, 0x16, 0x9C, 0x1F, 0xB3, 0x36, 0x9B, 0xC5,
+    0x7F, 0xE3, 0xF7, 0xF9, 0x3D, 0xCF, 0x87, 0x2E, 0x2F, 0xCE, 0xC3, 0x51, 0x60, 0xA3, 0x4E, 0x7C,
+    0x66, 0x5D, 0x0A, 0xBE, 0xAB, 0xE0, 0xD9, 0x80, 0x63, 0xA5, 0x73, 0x1E, 0xC3, 0x76, 0x90, 0x62,
+    0x5E, 0x8F, 0x4C, 0xD2, 0xAB, 0xAF, 0xC2, 0x61, 0xDB, 0xE8, 0x3B, 0x27, 0x6B, 0xC7, 0x3B, 0xB9,
+    0x68, 0xA7, 0xEC, 0x37, 0xC1, 0xEC, 0x4E, 0xAE, 0x74, 0x5B, 0x36, 0x76, 0x37, 0x77, 0x77, 0xE7,
+    0x79, 0x83, 0x01, 0xF6, 0xE4, 0xFF, 0xF0, 0x18, 0x23, 0xFB, 0xDC, 0x34, 0x79, 0x1F, 0x8D, 0x37,
+    0x41, 0xEA, 0x96, 0x12, 0x93, 0xCE, 0x4D, 0x33, 0xB4, 0x57, 0x28, 0xAA, 0x3A, 0x0F, 0x94, 0x2D,
+    0x1C, 0x98, 0xDE, 0xEB, 0xF4, 0xC6, 0x6F, 0x8B, 0x8C, 0xCB, 0x15, 0xE9, 0xFF, 0xBF, 0x61, 0x0A,
+    0xA2, 0xD4, 0xE3, 0x7F, 0x38, 0xBD, 0xFF, 0x0F, 0x27, 0xE8, 0x77, 0xFF, 0xC7, 0xF1, 0xA5, 0x25,
+    0x6F, 0x56, 0x8E, 0xDB, 0x2E, 0xBC, 0x3E, 0xAA, 0x1F, 0xAA, 0x2E, 0x9E, 0x82, 0x7D, 0x77, 0xCB,
+    0x6F, 0xD4, 0xA4, 0x0A, 0xAC, 0x3F, 0x4A, 0x3C, 0x55, 0xA2, 0x2C, 0x62, 0xDF, 0xCD, 0x07, 0x4E,
+    0x03, 0xC8, 0xD2, 0x3F, 0x03, 0xF6, 0x63, 0xD8, 0x56, 0x3E, 0x6B, 0xE9, 0x99, 0x3B, 0xEF, 0x7E,
+    0x6E, 0xD0, 0xA9, 0x56, 0x1B, 0xD3, 0xB9, 0x79, 0xD5, 0x7A, 0xFC, 0x0F, 0xBD, 0x5A, 0xBF, 0x93,
+    0xDD, 0xD4, 0x15, 0x3E, 0x92, 0xB0, 0x35, 0x41, 0x33, 0xC8, 0x05, 0x9E, 0x49, 0xEC, 0x99, 0xA8,
+    0x05, 0x17, 0x56, 0x93, 0x22, 0x45, 0xF0, 0xD5, 0x4C, 0xBA, 0x50, 0xC4, 0x45, 0x36, 0x14, 0x29,
+    0x48, 0x41, 0x91, 0x71, 0x43, 0xFE, 0x00, 0x62, 0x89, 0x49, 0x91, 0x99, 0x50, 0x78, 0x8B, 0xF4,
+    0x71, 0x41, 0x01, 0x4E, 0x61, 0x8A, 0x14, 0x2E, 0xEC, 0x95, 0x32, 0x14, 0x14, 0x14, 0x16, 0xBF,
+    0x26, 0x45, 0x0A, 0x44, 0xE2, 0x4C, 0x0A, 0x0A, 0x0B, 0x90, 0x41, 0x6B, 0x24, 0x9D, 0x7C, 0xDF,
+    0xBD, 0x7A, 0xEB, 0xB7, 0xF6, 0xEE, 0xB2, 0xFB, 0xF6, 0x2D, 0x6F, 0x75, 0x8E, 0xFD, 0xA4, 0xAB,
+    0x7B, 0xBF, 0x73, 0xEF, 0x3D, 0x3F, 0xEF, 0x93, 0x2B, 0x37, 0x32, 0x91, 0x52, 0x2B, 0x91, 0x5C,
+    0x0B, 0x71, 0x9F, 0x78, 0x20, 0x1B, 0xC1, 0x52, 0x05, 0x33, 0x25, 0x58, 0x6E, 0xF0, 0xB4, 0x4C,
+    0xD1, 0x6E, 0x4A, 0x2A, 0xF1, 0xC6, 0xB8, 0x11, 0x7F, 0x88, 0x5B, 0x09, 0x86, 0xB0, 0x93, 0x70,
+    0xFB, 0x37, 0xBD, 0x44, 0xAA, 0x83, 0xC4, 0xAA, 0xA3, 0x24, 0xAA, 0x93, 0x98, 0x5A, 0x54, 0x4C,
+    0x25, 0x65, 0x96, 0x17, 0x92, 0x57, 0x9A, 0xE1, 0xCB, 0xE9, 0x1B, 0x6F, 0xA2, 0x59, 0x6F, 0x89,
+    0x1F, 0xAF, 0xAC, 0xD1, 0x98, 0x6F, 0x4D, 0xF2, 0x03, 0xE1, 0x58, 0x18, 0xEA, 0xD7, 0xCA, 0x5E,
+    0xC4, 0x4C, 0x2A, 0x9A, 0x95, 0xB8, 0x4B, 0xC2, 0xDF, 0xE7, 0x0A, 0x88, 0xB9, 0x24, 0x63, 0xEA,
+    0x50, 0x5E, 0x16, 0x20, 0xEF, 0x82, 0x86, 0xC8, 0x2B, 0x42, 0xC5, 0xD7, 0xD3, 0xBD, 0x9C, 0xB4,
+    0x0C, 0xA7, 0xE4, 0x29, 0x89, 0xB3, 0x17, 0xD0, 0x74, 0x90, 0x40, 0x3B, 0x91, 0x57, 0x8B, 0xE3,
+    0xCB, 0x72, 0x62, 0x68, 0xD9, 0x23, 0x07, 0x78, 0x8D, 0xCC, 0x4E, 0xCE, 0x44, 0xB8, 0x25, 0x1F,
+    0x9C, 0x2F, 0x56, 0xC7, 0xFC, 0x02, 0x08, 0xB2, 0x7B, 0x2D, 0x68, 0x1B, 0x13, 0xCF, 0xBD, 0x73,
+    0x31, 0x73, 0xC2, 0xE4, 0x84, 0x2C, 0x12, 0x60, 0xB8, 0xA8, 0x76, 0xB7, 0x12, 0xDD, 0xF4, 0x54,
+    0xDB, 0x50, 0xB5, 0x89, 0x47, 0xBF, 0x4E, 0xB1, 0x68, 0xC4, 0x96, 0x53, 0xC2, 0x6C, 0x37, 0xF1,
+    0x1E, 0x9F, 0x19, 0xB4, 0x49, 0x7A, 0xD9, 0x04, 0x96, 0xC6, 0x07, 0x2D, 0xED, 0x4F, 0x09, 0x01,
+    0xB9, 0x11, 0xCC, 0xCF, 0x1D, 0xFB, 0xB5, 0xBC, 0x87, 0xC5, 0x48, 0xB4, 0x37, 0xCD, 0x6F, 0xF1,
+    0x36, 0x44, 0xD0, 0xC5, 0x85, 0x0E, 0xF3, 0xEA, 0x87, 0x46, 0x87, 0x58, 0x07, 0x9F, 0x8B, 0x35,
+    0x4F, 0x37, 0xA0, 0x19, 0xCC, 0xF6, 0x96, 0xC9, 0xBC, 0x2E, 0xAA, 0x4E, 0x02, 0xA2, 0x16, 0x81,
+    0xD6, 0xF1, 0x47, 0x5D, 0x9A, 0xDD, 0x5E, 0x09, 0x62, 0x88, 0xBE, 0x23, 0x7C, 0x8B, 0x30, 0xC3,
+    0xFE, 0xE6, 0x89, 0xCC, 0xE2, 0x55, 0x8C, 0x9F, 0x11, 0xCB, 0xF3, 0x2B, 0xCD, 0xA2, 0xD7, 0x47,
+    0x8D, 0xDD, 0xA4, 0x29, 0x16, 0x3B, 0x1A, 0x4E, 0x02, 0x62, 0x52, 0xDC, 0x89, 0xBE, 0xEA, 0x7D,
+    0xDC, 0xD3, 0x6A, 0x15, 0x88, 0x51, 0x93, 0x66, 0xFE, 0x88, 0x85, 0xA6, 0xBD, 0xE1, 0x38, 0xEC,
+    0x43, 0x37, 0x85, 0x2A, 0xA3, 0xAA, 0x85, 0x6E, 0x68, 0xA3, 0x92, 0xB6, 0xD8, 0xF1, 0x9D, 0x4A,
+    0xD8, 0x2B, 0x94, 0x6B, 0x37, 0xF1, 0x1E, 0x9F, 0xA1, 0x8D, 0xA7, 0xB5, 0x7D, 0xC7, 0xBE, 0xCB,
+    0x15, 0x31, 0xEF, 0x62, 0x6D, 0xCC, 0x7B, 0x14, 0xF1, 0x7D, 0xCA, 0x71, 0xD7, 0x09, 0xE4, 0x8F,
+    0x60, 0xB1, 0xDE, 0xAC, 0xC4, 0x28, 0x60, 0xE7, 0x1F, 0x80, 0x95, 0x05, 0xF5, 0x52, 0xA0, 0xCC,
+    0xBA, 0x9B, 0x95, 0x19, 0x1E, 0xE4, 0x55, 0x3E, 0x37, 0x4E, 0xF4, 0x7E, 0x25, 0xA1, 0xC6, 0xD5,
+    0x8C, 0x5F, 0xB7, 0x85, 0xCA, 0x58, 0x93, 0xF5, 0x12, 0x3F, 0x78, 0x79, 0x92, 0xB8, 0xF5, 0x01,
+    0xA9, 0xC5, 0xD2, 0x81, 0xE5, 0x45, 0xF2, 0x00, 0x3D, 0xE4, 0x5A, 0xEF, 0xB0, 0xCA, 0x54, 0xF6,
+    0xC1, 0xDC, 0xC4, 0x36, 0x4E, 0xC6, 0xB9, 0x03, 0xD7, 0xD5, 0x36, 0xFB, 0xB6, 0x53, 0x5F, 0xC1,
+    0xDE, 0x0C, 0x96, 0xCE, 0xE6, 0x1F, 0xF3, 0x7B, 0x30, 0xA5, 0x15, 0x41, 0x10, 0x4D, 0x5E, 0x97,
+    0x15, 0x81, 0x6B, 0x96, 0xEE, 0x10, 0xBF, 0x13, 0x2E, 0x9F, 0x27, 0x5A, 0x56, 0x21, 0x6D, 0x13,
+    0x3E, 0xE7, 0x6E, 0x6C, 0xA6, 0xDA, 0xE0, 0xB2, 0x33, 0xDC, 0x61, 0x30, 0x5E, 0x1B, 0x97, 0x77,
+    0x16, 0x08, 0x9B, 0x62, 0xBE, 0x96, 0x6F, 0xF2, 0x7E, 0xEF, 0xAE, 0xC7, 0x7D, 0x83, 0x94, 0x9B,
+    0xD6, 0xC6, 0xA6, 0xB4, 0x45, 0x15, 0x6C, 0x5A, 0x66, 0x8A, 0x72, 0x23, 0xC7, 0xFC, 0x6B, 0x45,
+    0xA2, 0x89, 0xE4, 0x36, 0x32, 0x95, 0x27, 0xE9, 0xC3, 0x9B, 0xD6, 0x66, 0x79, 0xB0, 0x63, 0xFC,
+    0x3C, 0x2B, 0x67, 0x5E, 0x90, 0x2E, 0xD5, 0x36, 0xD6, 0xDA, 0xDB, 0x92, 0x95, 0x31, 0xED, 0x67,
+    0xEB, 0x8F, 0x83, 0x8D, 0x9F, 0x41, 0xBC, 0x09, 0x16, 0x5D, 0xE4, 0x95, 0xD5, 0xB1, 0xD9, 0x8E,
+    0x0C, 0x5F, 0x07, 0xA6, 0x1C, 0x83, 0xFD, 0x48, 0x8E, 0x8D, 0x6D, 0x45, 0x24, 0x01, 0x36, 0x55,
+    0x21, 0x09, 0xF4, 0xF5, 0x2F, 0x34, 0xAD, 0xFE, 0xBD, 0x95, 0x31, 0x78, 0x10, 0xCB, 0x87, 0x56,
+    0xA1, 0x47, 0x09, 0x3E, 0x03, 0x11, 0x97, 0xC5, 0x76, 0xD5, 0xEF, 0x93, 0x7F, 0x35, 0x91, 0x56,
+    0xBE, 0x1E, 0x6F, 0xCE, 0xE2, 0xEA, 0xAA, 0x84, 0x5F, 0x63, 0x05, 0xB4, 0x9D, 0xFD, 0xE0, 0xF1,
+    0xD7, 0x53, 0xC2, 0x91, 0xA6, 0x0F, 0x0D, 0xA0, 0x0D, 0x7D, 0xE0, 0x0C, 0xCD, 0x79, 0x9A, 0x2D,
+    0x1D, 0x02, 0xD5, 0x2E, 0x9E, 0xE4, 0xF7, 0x29, 0x8D, 0x45, 0xED, 0xBC, 0xA3, 0x33, 0x87, 0x3A,
+    0x90, 0x72, 0x52, 0xE1, 0x0F, 0xA6, 0x02, 0x35, 0xFE, 0x90, 0xF4, 0xFE, 0x40, 0xC7, 0xEE, 0xD3,
+    0xB9, 0xE7, 0x7A, 0x6F, 0x67, 0x0C, 0x60, 0x25, 0xE6, 0xF0, 0x4B, 0xE8, 0x71, 0xF1, 0x07, 0x7B,
+    0xCB, 0x1F, 0x9F, 0x2E, 0xE2, 0x59, 0x5B, 0xCD, 0xAC, 0xAD, 0xB4, 0x32, 0xBA, 0x44, 0xB4, 0x30,
+    0x56, 0x63, 0xBF, 0xA5, 0xC6, 0x6A, 0x15, 0xEA, 0xAC, 0xF9, 0xA0, 0x9F, 0xC0, 0x4D, 0x19, 0xCA,
+    0x0C, 0x9B, 0x76, 0x1E, 0xA6, 0x41, 0xCE, 0x20, 0xAA, 0x7A, 0x0D, 0x4E, 0xDD, 0x28, 0x03, 0x83,
+    0x42, 0xFC, 0x6D, 0x59, 0xB7, 0x2C, 0x1E, 0x74, 0x2A, 0x2A, 0x2E, 0xC2, 0xCA, 0x8D, 0xE2, 0x2F,
+    0xE9, 0xD4, 0xDA, 0x65, 0xB1, 0x9D, 0x62, 0xC9, 0x83, 0xC1, 0x91, 0x5C, 0x97, 0x13, 0x59, 0x97,
+    0x74, 0xE1, 0xCB, 0x40, 0xE7, 0xE4, 0xE4, 0x64, 0x59, 0x27, 0x6E, 0xEF, 0x57, 0xF3, 0xDC, 0x50,
+    0xD7, 0xB0, 0x5D, 0xFD, 0xD9, 0xAE, 0x31, 0x16, 0x82, 0x2A, 0x4B, 0x4A, 0x79, 0xB2, 0x25, 0x59,
+    0x3E, 0x5D, 0xAF, 0x2C, 0x86, 0xBA, 0x07, 0x4B, 0xD1, 0x6F, 0x49, 0x58, 0xA7, 0x76, 0xA0, 0x12,
+    0x01, 0xE3, 0x93, 0xFE, 0x77, 0x26, 0x60, 0xDF, 0xA1, 0x8D, 0x97, 0x86, 0x7D, 0xDB, 0xB9, 0x85,
+    0x06, 0x68, 0x1A, 0x89, 0x90, 0x41, 0x43, 0xF2, 0x3E, 0x86, 0xBA, 0xE4, 0xED, 0xE4, 0x05, 0xD3,
+    0xBE, 0x2C, 0xC1, 0x3C, 0x4C, 0xCA, 0x60, 0x41, 0x69, 0x33, 0x3E, 0x40, 0x6C, 0xA4, 0xD4, 0x7A,
+    0xA5, 0x75, 0x9D, 0x0E, 0xC7, 0x10, 0xAD, 0x59, 0xF7, 0x6B, 0xAA, 0x97, 0xB7, 0x37, 0xF2, 0x8F,
+    0x75, 0x06, 0xAD, 0x43, 0xBC, 0xF3, 0x20, 0xA6, 0x41, 0x59, 0x62, 0x0F, 0x36, 0xF2, 0x6A, 0xE9,
+    0xE9, 0xBE, 0x0C, 0xE8, 0x48, 0x6A, 0x77, 0x41, 0x23, 0x2F, 0x3F, 0xC8, 0xEC, 0xF7, 0xF8, 0xDF,
+    0xF0, 0xF2, 0xF7, 0x11, 0x6D, 0xC1, 0xEC, 0xC5, 0x7D, 0xDC, 0xC5, 0x6D, 0xD8, 0xC7, 0x6D, 0xD0,
+    0xC7, 0xCD, 0xFE, 0x14, 0x15, 0xEF, 0x98, 0xA9, 0xDD, 0xD2, 0xE6, 0x9D, 0x84, 0x53, 0x1F, 0xD3,
+    0x4F, 0xB6, 0x91, 0xD6, 0xB2, 0xCB, 0x68, 0xEE, 0x7D, 0x85, 0x88, 0x6A, 0x6D, 0xFB, 0xB0, 0xF9,
+    0x59, 0x32, 0xF5, 0x97, 0xCA, 0xF6, 0xA7, 0x91, 0xDD, 0x3C, 0x6F, 0xDB, 0x79, 0x3C, 0xC4, 0x75,
+    0xE1, 0x46, 0x81, 0x28, 0xC5, 0xE6, 0x6C, 0xD8, 0x14, 0xD8, 0x57, 0x15, 0x52, 0x37, 0xAC, 0xDB,
+    0x77, 0x5E, 0x89, 0x66, 0xAE, 0xFD, 0x72, 0x0F, 0xFE, 0x9B, 0x4C, 0x34, 0x0E, 0x73, 0x9D, 0x91,
+    0xEC, 0x96, 0xDF, 0x20, 0x4A, 0x4A, 0xB5, 0x38, 0xED, 0x42, 0xA0, 0x95, 0x46, 0x7F, 0xB2, 0x9F,
+    0xC3, 0x63, 0x58, 0x6D, 0x44, 0xB9, 0x28, 0x72, 0xDB, 0xE6, 0x5B, 0x63, 0xC6, 0x48, 0x98, 0x0A,
+    0x93, 0x66, 0x50, 0xB7, 0x82, 0xF6, 0xE6, 0x02, 0x9C, 0xD5, 0x7E, 0x7F, 0x17, 0x91, 0xF8, 0xF5,
+    0x32, 0x16, 0x65, 0x75, 0x9E, 0x8B, 0xE4, 0x77, 0x73, 0xD7, 0xDE, 0xF5, 0xD5, 0xE5, 0x3F, 0x68,
+    0x3C, 0x43, 0x5F, 0x69, 0x59, 0xCA, 0xDC, 0x11, 0xAF, 0xAD, 0xCC, 0x12, 0x76, 0xB0, 0xE8, 0xCF,
+    0xFA, 0x7C, 0x32, 0x8F, 0xBA, 0x4A, 0x25, 0xB5, 0x21, 0xBD, 0x68, 0x23, 0x4B, 0x76, 0xD8, 0xC0,
+    0x18, 0x96, 0x74, 0xDD, 0xD9, 0xB9, 0x39, 0xA7, 0xB9, 0x90, 0x5D, 0x81, 0x5D, 0x2E, 0x8F, 0x4C,
+    0x36, 0x11, 0xB6, 0xA4, 0x2E, 0x25, 0x4F, 0x31, 0x64, 0xEA, 0xFC, 0x17, 0xA6, 0x0B, 0x6A, 0xFB,
+    0xCF, 0x36, 0x95, 0x5B, 0xCE, 0x6E, 0x1D, 0x46, 0x6D, 0x9E, 0xBC, 0xFC, 0x89, 0x72, 0x40, 0x8A,
+    0x85, 0x4D, 0xA4, 0xD1, 0x82, 0xC9, 0x4A, 0xDE, 0x6F, 0x2E, 0x79, 0xDD, 0x91, 0x34, 0xCA, 0x5D,
+    0xFE, 0x28, 0x39, 0x2C, 0x7C, 0x4F, 0xAF, 0x50, 0x22, 0xE8, 0x87, 0x61, 0xAE, 0x61, 0xC0, 0x0A,
+    0x24, 0x2E, 0xA2, 0x98, 0x52, 0x8D, 0x3B, 0x51, 0x24, 0x64, 0x0A, 0x6F, 0x81, 0x3C, 0x46, 0x98,
+    0x6F, 0xE8, 0x7D, 0x64, 0x09, 0x2F, 0xF6, 0xEE, 0xB9, 0x6F, 0xD3, 0xFC, 0x4C, 0x59, 0x3B, 0x90,
+    0xB4, 0x61, 0xE2, 0x63, 0x71, 0x9D, 0xCD, 0x9C, 0x73, 0x63, 0xB0, 0x79, 0x09, 0xF4, 0xDC, 0xFC,
+    0xF5, 0x09, 0x7A, 0xFA, 0x3A, 0x76, 0x00, 0x76, 0x25, 0x8C, 0xFD, 0x1F, 0x47, 0x31, 0xD7, 0x3A,
+    0x31, 0x37, 0x6B, 0x2E, 0x1F, 0x08, 0xE9, 0x3A, 0x9C, 0xBD, 0x79, 0x77, 0x10, 0xF3, 0xBA, 0x72,
+    0x8E, 0xB9, 0x5B, 0x6A, 0xC3, 0x34, 0x65, 0x31, 0x46, 0xBA, 0x7B, 0x8C, 0x0B, 0xD9, 0xA2, 0x3F,
+    0xAC, 0xE9, 0xEB, 0xE8, 0xEF, 0x4F, 0x10, 0xED, 0x1A, 0xFA, 0x29, 0x2B, 0x1B, 0x9F, 0xD8, 0xFE,
+    0x3E, 0xDA, 0xBB, 0x3F, 0x4C, 0xAE, 0x84, 0x40, 0x1F, 0xD7, 0xAE, 0x3B, 0xBB, 0x3F, 0x76, 0x5C,
+    0xD2, 0x0A, 0x64, 0x1D, 0x98, 0x23, 0x78, 0xCC, 0x31, 0xEA, 0x92, 0x8A, 0xFD, 0x1E, 0xA0, 0x09,
+    0x4B, 0x7F, 0x47, 0xDB, 0x22, 0xF4, 0x18, 0xBC, 0x88, 0x79, 0x03, 0x2A, 0x6F, 0xD3, 0x05, 0xC8,
+    0xB2, 0x79, 0xC8, 0xD1, 0x38, 0x99, 0xF8, 0x17, 0x72, 0x3F, 0x87, 0x7D, 0xB0, 0xA5, 0x32, 0xAA,
+    0x0C, 0xEA, 0xB5, 0x87, 0x1F, 0xD9, 0xBC, 0xD1, 0x9A, 0x37, 0x6A, 0x73, 0xAD, 0x32, 0xD7, 0xB8,
+    0xB2, 0x87, 0xBF, 0xF6, 0x16, 0x34, 0x68, 0x15, 0x69, 0x74, 0xD8, 0xA9, 0xB7, 0xB9, 0xF7, 0x70,
+    0xFB, 0x75, 0xF8, 0xD7, 0x0A, 0xFB, 0x87, 0xD7, 0x9F, 0xB3, 0x3D, 0x1B, 0xB0, 0x36, 0x12, 0x3F,
+    0x4E, 0x5F, 0xD0, 0xA1, 0xC1, 0x37, 0x2A, 0x93, 0x70, 0xAC, 0x10, 0x66, 0xAE, 0x6C, 0x5D, 0xC4,
+    0x91, 0x2C, 0xB7, 0x53, 0x3A, 0x32, 0x47, 0x7B, 0x5B, 0xEB, 0x09, 0x29, 0x1F, 0x54, 0xBD, 0x88,
+    0xB1, 0xF5, 0x7A, 0x49, 0x7B, 0x09, 0x9F, 0x68, 0xB3, 0x88, 0xCC, 0x8B, 0xD9, 0x30, 0x05, 0xDD,
+    0x1C, 0x43, 0x2D, 0x02, 0xF6, 0x5C, 0x10, 0xB1, 0x83, 0x75, 0x64, 0x03, 0x19, 0xA2, 0x04, 0x2E,
+    0x48, 0x2E, 0x53, 0x5E, 0x80, 0x99, 0x1A, 0x2C, 0x6E, 0xC1, 0xA2, 0x0E, 0x2C, 0x18, 0xC0, 0xBC,
+    0xC9, 0x40, 0x9D, 0x35, 0x67, 0x44, 0xA1, 0x60, 0x29, 0x59, 0x4C, 0x16, 0x91, 0x05, 0x3A, 0xD7,
+    0x5F, 0xB8, 0xC7, 0x7B, 0xB7, 0xC7, 0xE7, 0x32, 0xE2, 0x05, 0x7C, 0x37, 0x86, 0x86, 0x1A, 0x96,
+    0xBA, 0xCB, 0x6B, 0x53, 0xA5, 0xA0, 0x04, 0x6A, 0x71, 0x30, 0x9D, 0x30, 0x52, 0xF1, 0x2E, 0x33,
+    0x1C, 0xA3, 0x66, 0xDA, 0x82, 0xA0, 0x2D, 0x6F, 0x3C, 0x7D, 0x0C, 0xBC, 0xB6, 0xD3, 0x53, 0x30,
+    0x19, 0x2C, 0x3E, 0xD0, 0x1B, 0x1A, 0x67, 0x32, 0xE6, 0x98, 0x9F, 0x83, 0x6C, 0x31, 0x25, 0x36,
+    0xD3, 0x5C, 0xEC, 0xFB, 0x1E, 0xD6, 0x63, 0xAF, 0x5A, 0xD3, 0xAA, 0xF2, 0x31, 0xB0, 0xB3, 0xEB,
+    0x6A, 0x05, 0x94, 0x84, 0xBE, 0x3B, 0xFD, 0xC5, 0xEB, 0x53, 0x66, 0xE2, 0x4F, 0xB5, 0x7E, 0x96,
+    0xB1, 0x9E, 0xC4, 0x63, 0xD2, 0x09, 0xA3, 0x3D, 0x61, 0xB8, 0x37, 0xB3, 0xE6, 0xBB, 0x58, 0x59,
+    0xEF, 0xCC, 0x41, 0x4F, 0x36, 0x92, 0xA9, 0x9D, 0x83, 0x8A, 0xE2, 0x37, 0x60, 0x89, 0x15, 0x9F,
+    0x92, 0x07, 0x94, 0xDC, 0xD3, 0x12, 0x52, 0x96, 0x14, 0xD5, 0x90, 0x25, 0xCB, 0x92, 0x4F, 0x54,
+    0xE5, 0xC9, 0xB9, 0x4A, 0xF4, 0x32, 0x3B, 0xCD, 0xCF, 0xAD, 0x97, 0x1E, 0x96, 0x1C, 0xF4, 0x85,
+    0xE8, 0xF1, 0x99, 0x48, 0x0E, 0xB9, 0xD2, 0x0B, 0x4A, 0x6B, 0x1B, 0xD0, 0x87, 0xF0, 0x5C, 0x01,
+    0x66, 0x19, 0x31, 0xE0, 0x5C, 0xF8, 0x37, 0xBA, 0x50, 0xB8, 0x94, 0x19, 0x2B, 0xD2, 0x23, 0x16,
+    0xC6, 0x47, 0x49, 0xFA, 0x50, 0xB9, 0x10, 0x5A, 0xB8, 0x12, 0x5B, 0xC1, 0xD4, 0x1E, 0xAC, 0x46,
+    0x4C, 0x9F, 0x2E, 0x31, 0xFB, 0x00, 0x4D, 0xC0, 0x1A, 0xA8, 0x32, 0xF2, 0x25, 0x75, 0x1D, 0xF8,
+    0xB6, 0x62, 0xF0, 0xEA, 0xA2, 0x1A, 0xE9, 0xDF, 0x78, 0x0B, 0xA3, 0x0F, 0x96, 0x9E, 0x28, 0x1A,
+    0xD4, 0x65, 0x91, 0x67, 0x36, 0x31, 0x82, 0xCF, 0x4D, 0x2C, 0x95, 0x76, 0x80, 0xB4, 0x62, 0x6A,
+    0x94, 0x3E, 0x44, 0x94, 0x8E, 0xBD, 0xE6, 0x2D, 0x4A, 0x93, 0x4C, 0xB4, 0xE5, 0x16, 0x4B, 0x1D,
+    0x74, 0x65, 0x16, 0xB9, 0x9C, 0xDE, 0x96, 0xEF, 0x45, 0x90, 0xDD, 0x19, 0x38, 0x9F, 0x6C, 0x1E,
+    0x5F, 0x20, 0x97, 0xD6, 0xDD, 0x85, 0x40, 0x39, 0x1D, 0xED, 0x00, 0xEF, 0xE8, 0x37, 0xB7, 0xBE,
+    0x1F, 0x81, 0xF8, 0x09, 0x86, 0x49, 0xC2, 0x2F, 0x07, 0x89, 0xDF, 0x6B, 0xE4, 0x62, 0x94, 0xAD,
+    0x49, 0x20, 0x8C, 0xE1, 0xAA, 0xD2, 0xCA, 0x04, 0x89, 0x1C, 0xD8, 0xC7, 0x8D, 0xCC, 0xD4, 0x4C,
+    0x34, 0x4D, 0x45, 0x9E, 0x17, 0x96, 0xC3, 0x55, 0x28, 0x7A, 0x7B, 0xC4, 0x71, 0x07, 0x2D, 0xDD,
+    0x53, 0xD7, 0xD2, 0xBD, 0x95, 0x74, 0xE4, 0xAE, 0xB7, 0xC0, 0x72, 0xEC, 0x63, 0xF2, 0x05, 0xE6,
+    0xF3, 0x2C, 0x82, 0x8E, 0xAA, 0x59, 0xCA, 0xA7, 0x35, 0x90, 0x23, 0xAB, 0x43, 0x0C, 0xD4, 0x84,
+    0x2D, 0x10, 0xFF, 0xF7, 0xA5, 0x4E, 0x79, 0xDE, 0xB3, 0xC3, 0xA1, 0x18, 0x2C, 0x23, 0xDB, 0x4A,
+    0x7B, 0xDE, 0xC9, 0x19, 0xBC, 0x35, 0xFD, 0x0D, 0xF9, 0xE0, 0x64, 0x91, 0x37, 0xE9, 0xF2, 0x2C,
+    0xF1, 0xE4, 0xC4, 0xA6, 0x8D, 0x4C, 0xEE, 0xEF, 0xCC, 0x03, 0x4E, 0x8C, 0x05, 0x7B, 0x9B, 0xF6,
+    0x22, 0x56, 0xCC, 0x6C, 0xCC, 0x08, 0xA9, 0x98, 0xF7, 0xDA, 0x88, 0xD0, 0x16, 0xBC, 0x3B, 0x97,
+    0x79, 0xC2, 0xE5, 0xBA, 0x58, 0x71, 0x72, 0x87, 0x42, 0x36, 0x56, 0x34, 0xB5, 0xAD, 0x48, 0x8B,
+    0xF5, 0xB0, 0xF0, 0xCB, 0xA3, 0xAD, 0xE1, 0xD1, 0xFC, 0x35, 0x26, 0x6D, 0x4C, 0xD9, 0x98, 0x69,
+    0x13, 0xF8, 0xB8, 0x92, 0xFB, 0x05, 0x0E, 0x6B, 0xC4, 0xE0, 0xE2, 0xD5, 0xD9, 0x29, 0xB0, 0x4E,
+    0xF6, 0xCA, 0x51, 0x90, 0xB8, 0xF7, 0xF9, 0x7F, 0x1B, 0x39, 0x3E, 0xB7, 0x73, 0x10, 0x21, 0xD1,
+    0x57, 0xBD, 0xF0, 0x28, 0x62, 0x3E, 0x8B, 0x58, 0x27, 0xE6, 0x2D, 0xBF, 0x4B, 0xEF, 0x36, 0x91,
+    0x16, 0xB6, 0xDE, 0x79, 0x34, 0xB4, 0x62, 0xCB, 0x03, 0xB2, 0x25, 0x2E, 0x69, 0xF0, 0xF5, 0x5E,
+    0xA2, 0x93, 0x61, 0x0D, 0xE8, 0x77, 0xA5, 0xB5, 0xC6, 0x79, 0xCD, 0xB3, 0xAE, 0x58, 0x0B, 0x56,
+    0xDB, 0x90, 0x21, 0x84, 0x2E, 0x61, 0xD0, 0xCE, 0x9F, 0x6C, 0xFC, 0xD5, 0x3D, 0xD2, 0xA3, 0xDD,
+    0xCB, 0x77, 0x1A, 0xFE, 0x46, 0xDB, 0x52, 0x11, 0x39, 0x5E, 0xE6, 0x41, 0x11, 0xC2, 0x6D, 0xCD,
+    0x22, 0x1E, 0xD0, 0x74, 0x08, 0xAE, 0xB3, 0xA0, 0x9B, 0x6E, 0xB6, 0x10, 0x2E, 0xD7, 0x59, 0xDB,
+    0x76, 0x32, 0xA3, 0x8B, 0xF6, 0xA4, 0xF1, 0x38, 0x48, 0x02, 0x3A, 0xD8, 0xCC, 0xFC, 0xB2, 0xBE,
+    0x6D, 0xA1, 0x1C, 0x15, 0xC9, 0x8A, 0x43, 0xDF, 0xB2, 0xF7, 0x10, 0x4F, 0x24, 0x10, 0x84, 0x5E,
+    0xE6, 0xF0, 0xE3, 0x7A, 0xAD, 0xF8, 0x83, 0xDD, 0x72, 0x46, 0x22, 0xB8, 0xC7, 0xDE, 0x65, 0xA4,
+    0x63, 0xFC, 0xBF, 0x2E, 0x60, 0x61, 0xA5, 0x38, 0xE6, 0x84, 0x3C, 0xB6, 0x43, 0x8E, 0x34, 0x21,
+    0xB0, 0x2E, 0x68, 0xEA, 0xE8, 0x6C, 0xFE, 0xC9, 0x65, 0x9B, 0x09, 0xAD, 0x42, 0xF1, 0x9C, 0x45,
+    0xD9, 0xAA, 0x21, 0x2B, 0x78, 0x8D, 0x8B, 0x7D, 0xAF, 0x73, 0xC3, 0xE0, 0x46, 0xF4, 0xF0, 0x3A,
+    0x50, 0xE5, 0x30, 0x95, 0xAD, 0xEC, 0x71, 0x01, 0x1A, 0x2D, 0x5E, 0xCB, 0xF8, 0x23, 0xB1, 0xE9,
+    0x5E, 0x68, 0x5F, 0x2B, 0x1B, 0xDB, 0x0B, 0xCF, 0x3C, 0x11, 0x42, 0x0D, 0x93, 0x2D, 0x0D, 0xDA,
+    0x80, 0x7D, 0x9D, 0xE0, 0x6D, 0xFC, 0x19, 0x36, 0x72, 0x3D, 0xAA, 0xFC, 0x36, 0x2E, 0x88, 0x1F,
+    0x78, 0x31, 0x6F, 0x34, 0xBF, 0x16, 0xE0, 0xFE, 0xD4, 0xB1, 0x98, 0x08, 0xAC, 0x34, 0xD2, 0xFA,
+    0xDD, 0xB8, 0x4E, 0xE5, 0x9F, 0xD0, 0xBE, 0xEF, 0xD0, 0x81, 0xB8, 0xF6, 0x99, 0xBC, 0xF4, 0x61,
+    0x81, 0xC8, 0x00, 0xD7, 0x1E, 0x93, 0xC7, 0x73, 0x92, 0x67, 0xD0, 0xF3, 0x96, 0xC4, 0x37, 0x07,
+    0x79, 0xC6, 0x9F, 0x0F, 0x36, 0x0F, 0x2A, 0xA0, 0xEE, 0x4D, 0x7D, 0x99, 0x85, 0x7D, 0x5E, 0x27,
+    0xAD, 0x51, 0x5B, 0x41, 0x2C, 0x3C, 0x5B, 0x5A, 0xC1, 0xE7, 0x56, 0x04, 0x69, 0xEF, 0x4B, 0x74,
+    0x1F, 0x7B, 0xD9, 0x19, 0x16, 0xE6, 0xE3, 0x9B, 0x39, 0x42, 0xB2, 0x83, 0xC8, 0x14, 0x0C, 0x70,
+    0x11, 0xDE, 0xC1, 0x6F, 0x25, 0x7A, 0xBF, 0x0E, 0xF5, 0x0D, 0x1B, 0xAC, 0x7B, 0x37, 0xDE, 0xC6,
+    0xF6, 0x9F, 0x40, 0xE3, 0xDA, 0xB1, 0x32, 0x2E, 0x0B, 0xF0, 0xFF, 0x60, 0x8E, 0xCB, 0x8E, 0x85,
+    0x33, 0xF3, 0x24, 0xA8, 0xE2, 0xCC, 0xB7, 0x25, 0x60, 0x3A, 0xEB, 0xF5, 0xCF, 0xAD, 0x27, 0xA7,
+    0x24, 0xAC, 0x12, 0xE0, 0x65, 0xB4, 0x81, 0x31, 0xD2, 0xCD, 0x63, 0xE3, 0xB6, 0xB5, 0x13, 0xA6,
+    0xB9, 0xED, 0x4C, 0xFC, 0x7F, 0x52, 0xAC, 0x7F, 0x5F, 0xEC, 0x35, 0x4E, 0x5A, 0x1C, 0x1F, 0xBF,
+    0xAD, 0xC0, 0x23, 0x62, 0xEA, 0x47, 0x89, 0x3E, 0x44, 0x5E, 0xF3, 0xF3, 0x6A, 0xFD, 0xD8, 0xB9,
+    0x57, 0x06, 0xF4, 0xF8, 0x00, 0x51, 0xE2, 0xBB, 0xAD, 0xFC, 0x38, 0x3C, 0x3E, 0xEE, 0x35, 0xE0,
+    0xAB, 0xDC, 0x41, 0xE2, 0xED, 0xE5, 0x1F, 0xD4, 0x88, 0xFB, 0x41, 0x4D, 0x9E, 0xAD, 0x8E, 0x2D,
+    0x9E, 0x7F, 0xA4, 0xC3, 0x1F, 0xFE, 0x6C, 0x65, 0xEE, 0xA8, 0xE8, 0xFC, 0xA3, 0x48, 0x30, 0x71,
+    0x3A, 0x6D, 0x9C, 0xCA, 0x8C, 0x36, 0x73, 0xF3, 0x9B, 0xF8, 0x51, 0x83, 0x89, 0x56, 0xA7, 0xB4,
+    0x85, 0x44, 0x7B, 0x02, 0x82, 0x17, 0x90, 0xFF, 0x15, 0x69, 0xEF, 0x8D, 0xAC, 0x43, 0x0D, 0xF0,
+    0x76, 0x08, 0x9C, 0xEF, 0xB0, 0x30, 0x5C, 0x5D, 0xDD, 0x62, 0x76, 0x59, 0x6F, 0xE5, 0x21, 0x56,
+    0xAE, 0x19, 0x8D, 0x35, 0x59, 0x83, 0x79, 0xB1, 0x95, 0xF0, 0x8B, 0x21, 0xBD, 0xD6, 0x48, 0xF0,
+    0x75, 0x9F, 0xDC, 0xAD, 0x25, 0xF8, 0xB6, 0x8B, 0x3F, 0xAD, 0xC4, 0xFF, 0xB6, 0x8D, 0xEF, 0xDB,
+    0xC3, 0xCC, 0x88, 0x52, 0x2A, 0x10, 0xF3, 0x17, 0x44, 0x95, 0x4D, 0xA4, 0xCB, 0x6A, 0xA7, 0x6A,
+    0xB0, 0xF8, 0x9D, 0x92, 0x3D, 0xA9, 0xB5, 0xC1, 0x3D, 0x0F, 0xA7, 0xAE, 0x2E, 0x9E, 0x5D, 0x91,
+    0x2B, 0xC5, 0x39, 0xC4, 0xF4, 0x65, 0x65, 0x6B, 0x8E, 0x35, 0x6B, 0x85, 0x70, 0x79, 0x92, 0xFE,
+    0xE3, 0x1B, 0xC4, 0xC9, 0xC9, 0x87, 0x5F, 0xB6, 0x08, 0x22, 0xFE, 0xF3, 0x45, 0x87, 0x1D, 0xF5,
+    0xD5, 0x67, 0xDB, 0x70, 0xAE, 0xDF, 0xD4, 0x0F, 0x07, 0x60, 0xA8, 0xA6, 0x1E, 0xBA, 0x57, 0x61,
+    0xE7, 0xFA, 0x5A, 0xE4, 0x2D, 0xC3, 0x16, 0x06, 0xCF, 0x6A, 0xA7, 0xC8, 0xEE, 0x71, 0x26, 0x31,
+    0x83, 0x78, 0xC8, 0x80, 0x83, 0xC6, 0x29, 0x51, 0x89, 0xD4, 0x3E, 0x47, 0x0C, 0x9F, 0xD6, 0x11,
+    0x62, 0xF1, 0xB8, 0x8D, 0xBA, 0x14, 0xB1, 0xBC, 0xA9, 0xFC, 0x91, 0x25, 0x2F, 0x7A, 0x2C, 0x3A,
+    0xFF, 0xFE, 0xB1, 0x12, 0xD3, 0x1E, 0x64, 0x27, 0x9D, 0xA3, 0x75, 0x12, 0x74, 0x83, 0x44, 0x95,
+    0xAB, 0xDC, 0xDC, 0x90, 0xD3, 0xD7, 0xCB, 0x2C, 0x6E, 0x99, 0xF2, 0xA6, 0x55, 0x6A, 0x13, 0xE3,
+    0xB8, 0xE1, 0x79, 0x12, 0x76, 0x58, 0x07, 0xBB, 0xB9, 0xCD, 0x9F, 0x0C, 0x0C, 0xF6, 0x3D, 0x57,
+    0xCE, 0x6A, 0x6C, 0x46, 0xBC, 0xF8, 0x71, 0x8D, 0xA7, 0xAE, 0xD8, 0x41, 0x08, 0x56, 0x8C, 0xBF,
+    0x5F, 0xC4, 0x5E, 0x37, 0xF0, 0x13, 0x88, 0x48, 0x2E, 0x3F, 0x25, 0x6B, 0x97, 0x81, 0x29, 0x38,
+    0xDD, 0x22, 0xEB, 0x13, 0x73, 0x81, 0x95, 0xFB, 0x79, 0x41, 0x67, 0x37, 0x78, 0x2C, 0x89, 0x24,
+    0x8E, 0x45, 0x2A, 0xA6, 0x3B, 0x7C, 0x2F, 0x99, 0x7F, 0x0C, 0xA4, 0x3C, 0x54, 0x9C, 0x6B, 0x57,
+    0xAD, 0x13, 0x83, 0xDE, 0x74, 0x41, 0x4B, 0x3F, 0xF0, 0xCA, 0xAC, 0x5A, 0x20, 0xD7, 0x7F, 0xCB,
+    0xE8, 0xC8, 0x03, 0x44, 0xDE, 0x6F, 0xF9, 0x06, 0x6B, 0xD8, 0xEC, 0x18, 0x18, 0x12, 0x96, 0x96,
+    0xC7, 0x5C, 0xA7, 0x7C, 0x3E, 0x91, 0x67, 0x79, 0x29, 0x75, 0x15, 0x03, 0x39, 0x9D, 0xAD, 0x1D,
+    0xDB, 0xD5, 0x45, 0x01, 0xF3, 0xF9, 0xA3, 0x63, 0xDB, 0x2B, 0xC2, 0x59, 0x23, 0xB6, 0xF4, 0xD1,
+    0xEF, 0xA5, 0x8A, 0xA3, 0x62, 0xE3, 0xD1, 0x03, 0xCF, 0x77, 0xB2, 0x03, 0xD2, 0x8D, 0x3D, 0xAF,
+    0xFF, 0x03, 0xCD, 0x5A, 0x3D, 0xB0, 0xD5, 0xD6, 0x11, 0x5E, 0x49, 0x06, 0xC5, 0x68, 0x26, 0x72,
+    0x43, 0x11, 0x18, 0x50, 0x93, 0x22, 0x66, 0x62, 0xAB, 0x49, 0x91, 0x82, 0x20, 0xE1, 0x26, 0x05,
+    0x45, 0x28, 0x7C, 0xA1, 0xA0, 0xA0, 0x49, 0x91, 0x71, 0x43, 0x9A, 0xCC, 0x38, 0x33, 0x31, 0x52,
+    0xEF, 0x82, 0xD7, 0x64, 0xD2, 0xC5, 0xAF, 0x48, 0x61, 0x3F, 0x17, 0xA4, 0xA0, 0xB0, 0x67, 0x00,
+    0xC9, 0x76, 0xE1, 0x22, 0x8D, 0x48, 0x86, 0x71, 0xE1, 0x22, 0x22, 0x03, 0x93, 0xC9, 0xA4, 0x40,
+    0x71, 0x64, 0x46, 0x06, 0x5D, 0x9D, 0x7C, 0xDF, 0x9E, 0x73, 0x7F, 0xDE, 0xE3, 0xC7, 0x10, 0xDE,
+    0x23, 0xB9, 0xE8, 0xEC, 0x0E, 0x57, 0xBA, 0xE7, 0xEC, 0x9E, 0xB3, 0x3F, 0xDF, 0xAE, 0x9E, 0x88,
+    0x48, 0x95, 0x4B, 0x6A, 0xCA, 0x4A, 0x7C, 0x63, 0xFA, 0x49, 0x22, 0x63, 0xCC, 0x28, 0xC9, 0x10,
+    0x9A, 0x5E, 0xB2, 0x56, 0x4C, 0x2D, 0x99, 0x5E, 0x45, 0x49, 0x5A, 0x95, 0x92, 0x36, 0xFA, 0x8B,
+    0x25, 0xD5, 0x6F, 0xEC, 0x5D, 0x77, 0xB5, 0xFC, 0x32, 0x19, 0x7C, 0x23, 0x9C, 0x6D, 0x2E, 0x9C,
+    0x79, 0xC0, 0x42, 0x17, 0x4C, 0x29, 0xAB, 0xCF, 0x31, 0xFE, 0x27, 0x2B, 0xA5, 0xDA, 0x28, 0xF2,
+    0xC8, 0xCC, 0x0D, 0x84, 0xC0, 0xC2, 0x59, 0x53, 0xB5, 0x98, 0x8D, 0x4B, 0x71, 0x5E, 0x23, 0x89,
+    0x23, 0x95, 0x5D, 0x52, 0x97, 0x28, 0x6A, 0x3E, 0x9C, 0x4B, 0x6C, 0x26, 0x11, 0x0F, 0x82, 0xAE,
+    0x3E, 0x55, 0x5E, 0x49, 0x30, 0x54, 0xF8, 0x4D, 0x30, 0x4E, 0xA4, 0x98, 0x93, 0xB4, 0x23, 0x9D,
+    0x72, 0xFD, 0x5E, 0x9E, 0x96, 0x0E, 0x9C, 0x2F, 0x04, 0x2D, 0x9A, 0xA4, 0x83, 0xB0, 0xC6, 0xB4,
+    0x82, 0x45, 0xA9, 0x86, 0x47, 0xBD, 0x56, 0x1F, 0xFF, 0x7D, 0x90, 0x60, 0x38, 0x96, 0x1F, 0xF8,
+    0x5D, 0x5F, 0x94, 0xC9, 0xDD, 0x0E, 0xC4, 0xD4, 0x20, 0x13, 0x94, 0x49, 0x9A, 0x87, 0x09, 0x94,
+    0xC9, 0xCA, 0xAC, 0xA1, 0x32, 0x0D, 0x27, 0x6E, 0x24, 0x31, 0x77, 0x1B, 0x09, 0xCD, 0xA9, 0x46,
+    0x1E, 0xFA, 0x84, 0x6D, 0xAA, 0x3B, 0xE7, 0xCD, 0xAF, 0x3B, 0x2D, 0x47, 0xCB, 0xD3, 0x6E, 0xA5,
+    0xB8, 0xD9, 0xE0, 0x3C, 0x1D, 0x37, 0xDC, 0x72, 0x53, 0x2A, 0x9F, 0x99, 0xF6, 0xE0, 0xAC, 0x68,
+    0x8C, 0x3E, 0x5C, 0x94, 0x46, 0xE2, 0x9E, 0xCA, 0x19, 0x81, 0x62, 0xC1, 0x68, 0x95, 0x8D, 0x7A,
+    0xCB, 0x93, 0xCE, 0x72, 0xEC, 0xB2, 0xF2, 0x2A, 0xD7, 0xE7, 0xBC, 0x89, 0xBF, 0x88, 0x7B, 0xBB,
+    0x2D, 0x69, 0x17, 0x71, 0x06, 0xCF, 0x34, 0x09, 0xB6, 0x63, 0xB9, 0xCE, 0x72, 0x5D, 0x2B, 0xC7,
+    0xBA, 0xFC, 0x71, 0x7D, 0x51, 0xE5, 0x0B, 0xEF, 0x61, 0x3D, 0x3C, 0xE7, 0xF1, 0x38, 0xB8, 0x8D,
+    0x15, 0xD6, 0x99, 0x71, 0x53, 0xED, 0xBC, 0x87, 0xB6, 0x3E, 0xD0, 0x75, 0x52, 0x33, 0xE9, 0xBA,
+    0x96, 0x63, 0xD5, 0x70, 0xA7, 0x9C, 0xED, 0x9A, 0x9C, 0xD0, 0xC3, 0x58, 0xF9, 0xFC, 0xB9, 0x9D,
+    0x87, 0x47, 0x46, 0xF9, 0xE2, 0xCE, 0xCA, 0x07, 0x63, 0x11, 0x27, 0x9F, 0x38, 0xF9, 0x56, 0xC2,
+    0x65, 0xF5, 0xB5, 0xA0, 0x27, 0x4B, 0xDF, 0x6B, 0xC8, 0x62, 0x18, 0x16, 0x58, 0x30, 0xE9, 0x3D,
+    0x9E, 0xED, 0x3C, 0xAB, 0xB7, 0xB6, 0x36, 0x63, 0x73, 0xB9, 0x86, 0x5E, 0xF8, 0x2D, 0x59, 0x71,
+    0x03, 0x9E, 0x91, 0xB6, 0x55, 0xA9, 0x06, 0x09, 0xE3, 0xAC, 0x75, 0x4F, 0xD3, 0x1A, 0x32, 0x90,
+    0xA9, 0x50, 0x69, 0x0D, 0x09, 0x68, 0xB3, 0xF4, 0x1F, 0x58, 0x2D, 0xB6, 0xD3, 0xFE, 0xBC, 0xC7,
+    0x61, 0x7F, 0x02, 0x16, 0x9A, 0x98, 0x6C, 0x71, 0x84, 0xF0, 0x97, 0xCE, 0xEC, 0x0E, 0x31, 0xE3,
+    0x3A, 0xE1, 0x19, 0x90, 0xD0, 0x8A, 0x23, 0xD8, 0x1A, 0x08, 0x34, 0x8B, 0xA6, 0xED, 0x66, 0x16,
+    0x35, 0x15, 0x9F, 0x33, 0x8E, 0xEC, 0x2F, 0x8D, 0x3D, 0x18, 0x39, 0xB0, 0xC1, 0xEF, 0xDA, 0x67,
+    0x23, 0x66, 0x5C, 0x27, 0x94, 0x60, 0x49, 0x52, 0x90, 0x80, 0x62, 0x04, 0x14, 0x23, 0xB0, 0x62,
+    0xC0, 0x1D, 0x30, 0xB0, 0x5B, 0x3A, 0x5E, 0x65, 0x68, 0xC0, 0x78, 0x8B, 0xDF, 0x3D, 0xF3, 0xD0,
+    0xBD, 0xD4, 0x01, 0x59, 0x52, 0x0E, 0x58, 0x46, 0x7A, 0x9B, 0xF6, 0x56, 0x48, 0x91, 0xC3, 0xFC,
+    0x94, 0xF5, 0x96, 0x8D, 0x96, 0x4D, 0xCA, 0x10, 0x88, 0xC8, 0xA6, 0xA2, 0x54, 0x96, 0x35, 0xCA,
+    0xE2, 0x4E, 0x59, 0xD4, 0x2B, 0x0B, 0x46, 0x65, 0xDE, 0x94, 0x91, 0x89, 0xD1, 0xFF, 0x49, 0x61,
+    0x94, 0xA5, 0x96, 0xC5, 0x96, 0x45, 0x96, 0x05, 0x64, 0x8B, 0x43, 0xA6, 0x27, 0x5B, 0x03, 0xAC,
+    0xA6, 0x75, 0x77, 0xAE, 0x5A, 0x79, 0xC4, 0xE7, 0xA2, 0x95, 0x1A, 0xD6, 0xD5, 0x59, 0x46, 0xA9,
+    0x7F, 0x20, 0x2A, 0x35, 0xF4, 0xA3, 0xD4, 0x5B, 0xA2, 0x52, 0x1B, 0x51, 0xA9, 0xC1, 0x28, 0x35,
+    0x18, 0xA5, 0x06, 0xA3, 0xD4, 0x60, 0x94, 0x1A, 0x8C, 0x52, 0x83, 0x51, 0x6A, 0xB2, 0xC2, 0x28,
+    0x4B, 0x2D, 0x8B, 0x2D, 0x8B, 0x2C, 0x0B, 0xC8, 0xC4, 0x19, 0xC1, 0x8A, 0x39, 0xE1, 0x33, 0x77,
+    0x6E, 0x56, 0xF8, 0x6C, 0x5D, 0xF8, 0xA4, 0x94, 0x85, 0xF7, 0x38, 0x7A, 0x20, 0x77, 0x51, 0x1F,
+    0x8E, 0x71, 0xA8, 0xCC, 0x32, 0x43, 0xAF, 0x80, 0x2F, 0x80, 0xF6, 0x45, 0x43, 0x0F, 0x49, 0x95,
+    0x26, 0xA4, 0xE5, 0xB3, 0xD1, 0x9D, 0x6B, 0x15, 0xA4, 0xB1, 0x26, 0x9B, 0x58, 0x45, 0x8D, 0x06,
+    0x27, 0xD7, 0x18, 0x32, 0x8C, 0x5F, 0xC0, 0xFD, 0x84, 0x37, 0xC2, 0x65, 0x0C, 0x8F, 0xA9, 0x44,
+    0xCC, 0xFF, 0xD2, 0x5A, 0x24, 0xE3, 0x29, 0x15, 0xB4, 0xC0, 0x0A, 0x8E, 0x2D, 0x53, 0x52, 0x23,
+    0xF6, 0xC2, 0x74, 0xFD, 0x11, 0x6E, 0x14, 0x8C, 0x61, 0x2F, 0xE1, 0x37, 0xE7, 0x06, 0x66, 0xB7,
+    0x91, 0xF9, 0x60, 0x8E, 0xE9, 0x70, 0x10, 0x19, 0x53, 0x15, 0x33, 0x57, 0x8E, 0x74, 0x58, 0xD4,
+    0x88, 0x23, 0x56, 0x1E, 0x86, 0x3F, 0x86, 0x3E, 0x86, 0x3D, 0x1E, 0xA6, 0xEE, 0x61, 0xC5, 0x88,
+    0x3F, 0x6A, 0x0A, 0x7B, 0x59, 0xF7, 0x15, 0x4B, 0x9E, 0x31, 0x9C, 0x0D, 0x1B, 0x8B, 0x7D, 0xCF,
+    0x99, 0xC3, 0x2A, 0x0D, 0x2A, 0xE6, 0x9F, 0x38, 0x5D, 0x1C, 0x57, 0x32, 0x4F, 0x97, 0x41, 0xCB,
+    0x1B, 0xE3, 0x2F, 0xBB, 0xD0, 0xD4, 0x1E, 0xA3, 0x15, 0x7E, 0xD5, 0xE1, 0xA2, 0x67, 0x6B, 0x24,
+    0x7C, 0xF2, 0x15, 0x22, 0x30, 0xEA, 0xF3, 0x9C, 0xE7, 0xE4, 0x18, 0x7F, 0xD1, 0xC1, 0x17, 0xED,
+    0x3C, 0xF2, 0x01, 0x94, 0x7D, 0xBA, 0x4B, 0x3F, 0xD7, 0x02, 0xEE, 0x27, 0xE3, 0xA6, 0x46, 0xCD,
+    0x60, 0x19, 0x50, 0x00, 0x28, 0x14, 0x4F, 0x58, 0x00, 0x40, 0x34, 0xA1, 0x60, 0xA2, 0xB4, 0x81,
+    0x90, 0x60, 0x01, 0x10, 0x01, 0xB9, 0x9E, 0x10, 0x62, 0x45, 0xF4, 0x86, 0x06, 0x54, 0xC5, 0x10,
+    0x0A, 0x21, 0x74, 0x02, 0x0B, 0x20, 0xB6, 0xE1, 0x87, 0xB8, 0xC9, 0x24, 0xF8, 0x86, 0x09, 0x09,
+    0xE1, 0xB3, 0x70, 0xC6, 0x57, 0x6D, 0xE0, 0xF9, 0x91, 0xE0, 0x80, 0x93, 0x97, 0x45, 0xAE, 0xA1,
+    0xB9, 0x21, 0x80, 0xE0, 0xA8, 0x74, 0xA1, 0xB4, 0x26, 0x82, 0x48, 0xEF, 0x9B, 0x9C, 0x9B, 0xBF,
+    0x0E, 0x1F, 0x90, 0x67, 0x73, 0x1F, 0xB0, 0x41, 0x2A, 0xAC, 0x96, 0x75, 0xCE, 0x5F, 0x83, 0x81,
+    0xB9, 0xE6, 0x19, 0xC6, 0x40, 0xD0, 0x40, 0xC8, 0x40, 0xC0, 0x40, 0xB8, 0xB0, 0x0E, 0x16, 0x22,
+    0x5D, 0x63, 0xEE, 0xD6, 0xB0, 0x72, 0x03, 0x36, 0x6C, 0x10, 0x17, 0x3C, 0x69, 0x64, 0x25, 0x1D,
+    0x04, 0xAE, 0x02, 0xAC, 0x40, 0xA8, 0x10, 0x9A, 0x77, 0x15, 0x29, 0x78, 0xC8, 0x99, 0x3E, 0xF4,
+    0xF0, 0xDD, 0x1A, 0x5E, 0xFF, 0x8E, 0xF8, 0xC3, 0x35, 0x91, 0xF6, 0xC7, 0xBB, 0x2E, 0xBF, 0x37,
+    0x7B, 0x13, 0x31, 0x61, 0xAE, 0x43, 0x51, 0x4F, 0xF7, 0x91, 0x04, 0xDD, 0xA8, 0xFC, 0x79, 0xF5,
+    0xB0, 0x0B, 0x4C, 0xA2, 0xA8, 0x2B, 0xC2, 0xBE, 0xEC, 0xDB, 0x5B, 0x5D, 0xAC, 0x02, 0x6E, 0xBD,
+    0x18, 0x22, 0x1C, 0xDA, 0x5D, 0x7D, 0x3C, 0xFC, 0xF3, 0xBB, 0x13, 0x22, 0xD7, 0xDD, 0x39, 0xEF,
+    0xCB, 0xF7, 0x5C, 0x9F, 0xA0, 0xF9, 0x89, 0x78, 0xF7, 0x9D, 0x3F, 0x1C, 0xCC, 0x77, 0xFD, 0x7C,
+    0x88, 0xFF, 0x34, 0x81, 0x11, 0x8E, 0xBE, 0x00, 0x7D, 0x00, 0xFB, 0x10, 0x77, 0x19, 0xA6, 0x6C,
+    0x06, 0xD9, 0x4D, 0x7D, 0xF6, 0x4F, 0x04, 0x63, 0xA8, 0x71, 0xB0, 0xDE, 0xF7, 0x35, 0xA3, 0x55,
+    0xC4, 0x7D, 0x65, 0x05, 0x19, 0x88, 0x19, 0xCD, 0x16, 0x6B, 0xA2, 0x22, 0x67, 0x96, 0xCC, 0xFE,
+    0x3E, 0x69, 0xB0, 0xF6, 0x8D, 0x8B, 0x33, 0x6F, 0x6D, 0xE1, 0xD9, 0x82, 0xE0, 0xA5, 0x58, 0xC6,
+    0xA4, 0x13, 0x09, 0xBE, 0xBB, 0xC8, 0xCC, 0xF7, 0x5A, 0xB4, 0xE7, 0x69, 0xC5, 0x9B, 0x9D, 0xC6,
+    0x63, 0x83, 0x0E, 0x3D, 0x99, 0x1B, 0x9D, 0x44, 0x7F, 0x1B, 0x94, 0x3F, 0x77, 0x7A, 0x51, 0xED,
+    0xAA, 0x95, 0x76, 0xCC, 0x0C, 0x0C, 0xF4, 0x96, 0x78, 0xED, 0x9E, 0x6B, 0xB7, 0x7F, 0xEB, 0x0F,
+    0xDB, 0xB4, 0xD3, 0xF3, 0xE7, 0x78, 0x5D, 0x76, 0x21, 0x79, 0xAA, 0x7A, 0x56, 0xBF, 0xB5, 0xE3,
+    0xD3, 0x4A, 0xA1, 0x67, 0xA6, 0x01, 0x0D, 0x94, 0x46, 0xF7, 0x26, 0x6C, 0x73, 0x7C, 0x8B, 0x1A,
+    0x26, 0x9F, 0xA8, 0x1D, 0x2A, 0x2D, 0x4E, 0xB2, 0x10, 0xAC, 0x3C, 0x56, 0x39, 0x13, 0xA9, 0x3F,
+    0x9D, 0x99, 0x66, 0x79, 0xA0, 0xB5, 0xAE, 0xAD, 0x78, 0x55, 0x3F, 0x64, 0x1C, 0x06, 0x34, 0x9C,
+    0x16, 0x66, 0x2B, 0x72, 0x52, 0x23, 0xA4, 0x42, 0x05, 0x61, 0xDE, 0x66, 0x54, 0x3A, 0x2C, 0xC3,
+    0x91, 0x29, 0x8B, 0x0D, 0x68, 0xF6, 0xC0, 0xEE, 0x10, 0xB4, 0xD9, 0x87, 0x02, 0x9C, 0xC0, 0x91,
+    0x90, 0x58, 0x66, 0x66, 0x56, 0xD4, 0x09, 0xBF, 0xAF, 0xB3, 0xFB, 0xA4, 0x2C, 0x76, 0xB5, 0x96,
+    0xCB, 0xB5, 0xDE, 0xA9, 0x3D, 0xA9, 0xBE, 0x34, 0xF7, 0x2F, 0x43, 0xAB, 0xCF, 0xF1, 0x5B, 0xD4,
+    0x9E, 0x66, 0x3B, 0xC2, 0x3F, 0x6C, 0xB4, 0x60, 0x1B, 0xA9, 0x5F, 0x2F, 0xF1, 0x24, 0xBF, 0xB4,
+    0x15, 0x64, 0xD6, 0x2C, 0x50, 0x53, 0x51, 0x6E, 0xBD, 0x8F, 0xC5, 0xCC, 0x68, 0x49, 0x91, 0x9F,
+    0x01, 0x29, 0xCF, 0xCE, 0x99, 0x48, 0x91, 0xBD, 0x1B, 0x90, 0xA4, 0xF7, 0x51, 0x88, 0x99, 0xCB,
+    0x74, 0x07, 0x2A, 0x50, 0x98, 0xDB, 0x8B, 0x60, 0x7A, 0xA0, 0x8C, 0xCD, 0x5D, 0x85, 0x75, 0x2C,
+    0x8F, 0x58, 0xF8, 0xB0, 0x06, 0x5A, 0x0C, 0xFE, 0xBF, 0x42, 0xE6, 0xCD, 0x1E, 0x18, 0x6A, 0x51,
+    0x87, 0x13, 0xE1, 0x11, 0xD3, 0xBD, 0xBA, 0x61, 0xFF, 0x0A, 0x52, 0x7E, 0x86, 0xD3, 0xA2, 0x47,
+    0x1E, 0x5E, 0x78, 0xDA, 0x1C, 0x88, 0x2D, 0x3B, 0x5F, 0x2B, 0xBE, 0x58, 0xC0, 0x35, 0xDE, 0xC4,
+    0xD2, 0x54, 0x82, 0x3A, 0x50, 0x05, 0x6A, 0x40, 0x05, 0x0A, 0x5A, 0x1F, 0x24, 0xE7, 0x20, 0xB2,
+    0x2F, 0x4A, 0x7F, 0xCC, 0x6A, 0x8C, 0xD6, 0x1F, 0x01, 0x27, 0x46, 0x1A, 0x9F, 0x8A, 0xBD, 0x94,
+    0x9A, 0xC1, 0xBF, 0x90, 0xE0, 0x1E, 0x91, 0x04, 0x0B, 0x64, 0x1B, 0xEC, 0xFC, 0xF9, 0x4A, 0x17,
+    0x68, 0x5D, 0xB3, 0xCE, 0xAB, 0xD6, 0x74, 0x59, 0xE8, 0x53, 0xAC, 0xEB, 0x63, 0x9C, 0x3E, 0x18,
+    0x3F, 0x12, 0xAD, 0x8A, 0x9D, 0x2E, 0xCD, 0x1A, 0x62, 0x99, 0x5B, 0xC4, 0xE2, 0x32, 0x7F, 0xA5,
+    0xA5, 0x16, 0x11, 0x4A, 0x55, 0xE2, 0x04, 0xC5, 0xB0, 0x22, 0x47, 0x81, 0x6E, 0x50, 0x22, 0x19,
+    0x28, 0xC3, 0x22, 0x19, 0x53, 0x8B, 0xB9, 0x8B, 0x8A, 0xF9, 0xD4, 0x60, 0xEF, 0xFB, 0x6A, 0xD7,
+    0xB9, 0xA1, 0xBB, 0xA0, 0x96, 0xB2, 0x15, 0xBD, 0x05, 0x73, 0x58, 0xE5, 0x8B, 0xCE, 0xD5, 0x55,
+    0x0E, 0xD2, 0xF1, 0x33, 0x3D, 0x9E, 0x1C, 0x2B, 0x59, 0x0B, 0x08, 0xCB, 0x03, 0x10, 0xCE, 0x34,
+    0x71, 0x33, 0x27, 0x46, 0x43, 0x2D, 0x93, 0xB5, 0xDD, 0xC1, 0x06, 0x05, 0x04, 0xC3, 0xD4, 0x13,
+    0x83, 0xF2, 0xE4, 0x2B, 0x08, 0xC4, 0x02, 0x93, 0xC3, 0xB8, 0x7B, 0x09, 0xF9, 0xBC, 0x5E, 0x73,
+    0x1B, 0x7D, 0x85, 0x6B, 0x45, 0x3C, 0xB9, 0x80, 0xB6, 0xE0, 0x7D, 0xF4, 0x1C, 0x98, 0x8F, 0xE1,
+    0xE0, 0x38, 0xC6, 0x55, 0x8C, 0xEB, 0xA5, 0x35, 0x9F, 0xC3, 0xE0, 0xC7, 0xB6, 0x58, 0x78, 0x72,
+    0x03, 0x95, 0xBC, 0x58, 0xDD, 0xC2, 0x3B, 0xB2, 0x80, 0xD1, 0x1F, 0xC3, 0x0A, 0xE1, 0x8C, 0xA1,
+    0xBA, 0xEB, 0xF8, 0x7C, 0xF8, 0x36, 0xD9, 0xA9, 0x6B, 0x63, 0x75, 0xD5, 0xA2, 0x3F, 0xCB, 0xFD,
+    0x1D, 0x56, 0x89, 0xF9, 0xEB, 0xC5, 0xD8, 0x87, 0xB8, 0xAA, 0x89, 0x98, 0xBD, 0x03, 0xEC, 0x11,
+    0xAD, 0xCA, 0xB7, 0x3A, 0x94, 0x1A, 0x88, 0xD9, 0x8C, 0xD1, 0xEE, 0x42, 0xDC, 0xFE, 0x1C, 0x52,
+    0x15, 0xF4, 0x7E, 0xC3, 0x6E, 0xDE, 0xB0, 0xD6, 0x58, 0x78, 0xD8, 0xF2, 0x8F, 0x6D, 0x6D, 0x95,
+    0xEA, 0x5D, 0x34, 0x6F, 0x4E, 0x4A, 0xFB, 0xE3, 0x34, 0xB4, 0x27, 0xC3, 0x58, 0xD8, 0x2B, 0xAE,
+    0xF5, 0x3E, 0x34, 0xEE, 0x70, 0x92, 0xC6, 0xB6, 0x0F, 0xB8, 0x5E, 0xDA, 0xFC, 0x0A, 0x95, 0x14,
+    0xD6, 0xC9, 0x8B, 0x55, 0xB4, 0x58, 0x14, 0x33, 0xF5, 0x33, 0x17, 0x33, 0x7A, 0xF9, 0x73, 0x29,
+    0x10, 0x18, 0x06, 0x06, 0x93, 0xFF, 0xB7, 0x6E, 0x1A, 0xE5, 0x51, 0x5F, 0x9C, 0xBB, 0x4C, 0xC5,
+    0xC3, 0x73, 0xAD, 0x33, 0xD7, 0x39, 0x73, 0x8D, 0x33, 0xD7, 0x37, 0x73, 0x6D, 0x33, 0x27, 0x8F,
+    0x6B, 0x9A, 0x39, 0x69, 0x5C, 0xCB, 0xCC, 0x75, 0xCC, 0x5C, 0xC3, 0xCC, 0xF5, 0xCB, 0x5C, 0xBB,
+    0xCC, 0xAD, 0xBF, 0x6C, 0x96, 0x39, 0x27, 0x7F, 0x3C, 0x7B, 0x61, 0x4D, 0x32, 0x59, 0xAE, 0x69,
+    0x2C, 0x76, 0x0F, 0x9B, 0x3D, 0xC9, 0x0A, 0x1A, 0x61, 0x78, 0x34, 0x80, 0x31, 0x72, 0x42, 0xF6,
+    0x24, 0x2B, 0x54, 0x6A, 0xCF, 0xE6, 0x91, 0x74, 0xFF, 0x26, 0x29, 0xDB, 0x79, 0x4A, 0x81, 0x38,
+    0x76, 0xD0, 0xD9, 0xF9, 0xD5, 0xDD, 0x05, 0xED, 0x98, 0x4D, 0xE2, 0x9E, 0x27, 0x0D, 0x9D, 0x1A,
+    0x36, 0xBE, 0x0D, 0xBB, 0x78, 0xD5, 0x7A, 0xB3, 0xFA, 0x6A, 0x34, 0xC8, 0x9C, 0x6D, 0x1F, 0xEE,
+    0x72, 0x8B, 0x1C, 0x52, 0x23, 0x82, 0xE4, 0xFC, 0x0D, 0x5B, 0x77, 0xE4, 0x8C, 0x26, 0x34, 0x13,
+    0xE6, 0x17, 0xE4, 0x19, 0xB6, 0x81, 0x12, 0x76, 0x6E, 0x3B, 0x9B, 0x8B, 0xE8, 0xC8, 0x8D, 0x6D,
+    0x06, 0x3D, 0x6A, 0xD8, 0x8F, 0xC2, 0x09, 0x9A, 0xB4, 0x04, 0x7A, 0x74, 0x57, 0x17, 0x4D, 0x4E,
+    0x6D, 0x66, 0x69, 0x2B, 0x8B, 0x8D, 0x2C, 0x6D, 0x63, 0x69, 0x13, 0x4B, 0x5B, 0x58, 0xDA, 0xC0,
+    0xD2, 0xF6, 0x95, 0x36, 0xAF, 0xB4, 0x75, 0xA5, 0x8D, 0x2B, 0x6D, 0x5B, 0x69, 0xD3, 0x4A, 0x5B,
+    0x56, 0xDA, 0xB0, 0xD2, 0x76, 0x95, 0x36, 0xAB, 0xB4, 0x55, 0xB5, 0x6C, 0x4D, 0x11, 0x82, 0x72,
+    0x1B, 0xFD, 0x6E, 0xD9, 0x72, 0xD2, 0x86, 0x13, 0x4F, 0x4D, 0x9B, 0x4D, 0xAC, 0x08, 0x58, 0x19,
+    0x3C, 0x79, 0x58, 0x1D, 0xB4, 0xFE, 0xF0, 0x37, 0x17, 0x44, 0x31, 0xEF, 0xD1, 0xA3, 0x20, 0x47,
+    0x48, 0xE2, 0x6B, 0x24, 0xD3, 0x0A, 0x02, 0xE7, 0xDB, 0x21, 0x70, 0x23, 0x9E, 0x45, 0xBF, 0x11,
+    0xC8, 0x10, 0xF6, 0x4B, 0xF4, 0x3B, 0x5A, 0xF4, 0x9B, 0x6E, 0x43, 0xBF, 0xE5, 0xB2, 0x65, 0xA4,
+    0x2D, 0x2B, 0x4E, 0xF1, 0x2A, 0x15, 0xE0, 0xC6, 0x22, 0x48, 0xDE, 0x6A, 0x75, 0xC8, 0x83, 0xC6,
+    0x9A, 0xF4, 0x13, 0x90, 0x30, 0x26, 0x97, 0xE2, 0xDB, 0xDB, 0x48, 0xEE, 0x48, 0x4A, 0x57, 0x7A,
+    0x2F, 0xCE, 0x2A, 0xAA, 0xE5, 0x7F, 0x81, 0x8A, 0x17, 0xD9, 0x42, 0x13, 0x47, 0x62, 0x43, 0x7A,
+    0xBE, 0x6E, 0x3B, 0x7B, 0x8F, 0x90, 0xB5, 0x35, 0x6D, 0x5B, 0xB5, 0xD4, 0x29, 0xB0, 0xB9, 0xEA,
+    0x3B, 0x3C, 0x5E, 0x7D, 0x41, 0x36, 0xDF, 0x86, 0x00, 0x42, 0x22, 0x80, 0x98, 0xEF, 0x79, 0x32,
+    0x22, 0x80, 0x77, 0x88, 0x00, 0x06, 0xA4, 0xE0, 0x37, 0x3A, 0x90, 0x9F, 0x36, 0x40, 0x00, 0x97,
+    0xF0, 0x40, 0x76, 0x97, 0x08, 0x60, 0x4E, 0x04, 0x30, 0x2E, 0x10, 0x40, 0x48, 0x04, 0x10, 0xDF,
+    0x45, 0x18, 0x0F, 0x77, 0xBC, 0xEA, 0x19, 0xAD, 0xED, 0x52, 0xF1, 0xA5, 0xCB, 0xFC, 0x9E, 0x3F,
+    0xB2, 0x59, 0xFF, 0x06, 0xAA, 0xD2, 0x37, 0xA0, 0x57, 0x08, 0xDF, 0x8D, 0xDF, 0x6B, 0x4C, 0x0A,
+    0x5F, 0x7D, 0x07, 0xAB, 0x0D, 0x88, 0x3A, 0x5D, 0xA1, 0x6F, 0x3A, 0x62, 0xCC, 0x9F, 0xE2, 0x10,
+    0x5E, 0x5E, 0x6E, 0xE8, 0xBF, 0x07, 0x9E, 0x2C, 0x2D, 0x77, 0x64, 0x15, 0xF5, 0x5A, 0x94, 0xBF,
+    0x88, 0xB6, 0x67, 0x76, 0xA9, 0x95, 0xF8, 0x2F, 0xF8, 0x61, 0x87, 0xE5, 0xAF, 0x1C, 0xB7, 0x2B,
+    0x5E, 0xE8, 0xA9, 0xBB, 0xC6, 0x25, 0x9F, 0x2F, 0xF3, 0x68, 0xE4, 0x07, 0xAB, 0x1A, 0xFF, 0xC7,
+    0x46, 0x56, 0x88, 0xAA, 0x44, 0x2F, 0x1C, 0x19, 0x4F, 0x10, 0x67, 0xF9, 0x57, 0x44, 0xD0, 0x53,
+    0xCE, 0x1E, 0x29, 0x76, 0x32, 0x2D, 0xCA, 0xB6, 0xF9, 0x39, 0x7C, 0xDD, 0xF9, 0xCD, 0x9E, 0xEB,
+    0xF2, 0x12, 0xE3, 0x4A, 0xA3, 0x85, 0x5A, 0x7C, 0xF3, 0xAA, 0xC4, 0xF2, 0xC3, 0xDD, 0x68, 0xE1,
+    0x3E, 0x72, 0x7F, 0x20, 0x4E, 0xCE, 0x2E, 0x88, 0x8E, 0xAF, 0x67, 0x16, 0x57, 0x2D, 0x86, 0x31,
+    0xAB, 0xB1, 0xF3, 0x9E, 0xBD, 0x5F, 0x2E, 0xC6, 0x72, 0xFE, 0xCF, 0xDC, 0xFC, 0xBD, 0xDB, 0xFF,
+    0xF4, 0x36, 0xCD, 0x98, 0xEB, 0x20, 0xED, 0xA6, 0x4D, 0xD2, 0xC4, 0x6D, 0x7A, 0xF3, 0x7C, 0x9B,
+    0xD9, 0xA4, 0xDD, 0x71, 0xAB, 0xD2, 0x46, 0xE7, 0xCB, 0xA3, 0xE9, 0x43, 0x3D, 0x97, 0x65, 0x91,
+    0xFC, 0x0A, 0xB6, 0xA0, 0x4C, 0x4C, 0x9B, 0x9D, 0xE9, 0x8E, 0xCB, 0x1F, 0xB5, 0x86, 0xEE, 0x61,
+    0xC7, 0xBC, 0x66, 0xA7, 0x57, 0x0D, 0x66, 0xA2, 0x16, 0xBD, 0xD6, 0xBF, 0xE4, 0xF7, 0x83, 0xBD,
+    0x1E, 0xB7, 0x9F, 0xDB, 0xD0, 0x2D, 0x3C, 0xB7, 0xE0, 0xAB, 0xA0, 0x59, 0x51, 0x6A, 0x9E, 0xA2,
+    0x2F, 0x2F, 0x7A, 0x34, 0xF0, 0xE2, 0x14, 0x3E, 0xCC, 0x7D, 0xF0, 0x56, 0xFE, 0x5B, 0xA4, 0x75,
+    0xFA, 0x6E, 0x13, 0x7D, 0xDA, 0xF9, 0x2D, 0xCB, 0x82, 0x80, 0x50, 0x60, 0x24, 0x8A, 0x5C, 0xBD,
+    0x98, 0x7E, 0xEC, 0x05, 0x90, 0x6C, 0x9F, 0x17, 0x35, 0x97, 0xF4, 0x67, 0x4D, 0xF4, 0x19, 0xE6,
+    0xB9, 0x62, 0x9B, 0x4C, 0x4C, 0x28, 0x4F, 0x73, 0x9D, 0xE6, 0x1B, 0x35, 0x14, 0x0D, 0xD7, 0xCF,
+    0x35, 0x57, 0xB4, 0x4B, 0x92, 0x11, 0xDE, 0x02, 0x45, 0xE7, 0x80, 0x5D, 0xDF, 0x7A, 0x25, 0xCC,
+    0x50, 0x7C, 0x1E, 0xFB, 0x1C, 0xF0, 0x14, 0xBB, 0xF4, 0x0C, 0x4E, 0xED, 0xCA, 0xB3, 0xB7, 0xE5,
+    0xC3, 0xAF, 0xA0, 0x87, 0xF6, 0xE5, 0xE4, 0x2A, 0xCD, 0xED, 0xF5, 0xA8, 0x7C, 0x61, 0x6D, 0x79,
+    0x3A, 0x5B, 0x7A, 0xA9, 0x11, 0xEC, 0x9F, 0xB8, 0x0D, 0x7C, 0xCE, 0xB6, 0xFC, 0x69, 0x71, 0x6F,
+    0x2A, 0xB5, 0x1C, 0xBB, 0x7E, 0x16, 0xD6, 0x79, 0x65, 0xD9, 0x83, 0xDA, 0x63, 0x85, 0x5E, 0x62,
+    0xF2, 0x68, 0xB5, 0xFE, 0x8A, 0xEE, 0x5C, 0x83, 0xA5, 0x1E, 0xD9, 0x95, 0xF7, 0x0C, 0xD9, 0x79,
+    0x44, 0x8E, 0xCF, 0x3B, 0x09, 0x6F, 0xF5, 0xE2, 0x75, 0xBF, 0x71, 0x9A, 0x6C, 0x42, 0xC3, 0x49,
+    0xEC, 0x4B, 0x31, 0x45, 0x29, 0x2D, 0x50, 0x4A, 0xEB, 0x5E, 0x89, 0x11, 0x73, 0xE6, 0x99, 0xA2,
+    0x72, 0xA0, 0x99, 0x4F, 0x2D, 0x8C, 0xCF, 0x14, 0x81, 0xEA, 0x6B, 0xB3, 0x0E, 0x89, 0xA8, 0xCF,
+    0x6A, 0xED, 0xD0, 0x66, 0xE7, 0x6B, 0xCC, 0x1E, 0xDE, 0xE8, 0xED, 0xDC, 0xFE, 0xE6, 0xC5, 0xE0,
+    0xAB, 0x29, 0x78, 0x30, 0x05, 0xE6, 0x1F, 0x28, 0x2D, 0x69, 0x6D, 0xC3, 0xA3, 0x2F, 0xEA, 0xEB,
+    0xC3, 0x33, 0x23, 0x64, 0x8F, 0xE4, 0xB7, 0x83, 0x1C, 0x95, 0xE3, 0xEE, 0x35, 0x25, 0xBB, 0x10,
+    0x03, 0xB1, 0x00, 0xB3, 0x68, 0xAE, 0xDD, 0x0A, 0xAD, 0x7E, 0x80, 0xA6, 0xC5, 0xBE, 0x5B, 0xE7,
+    0x21, 0x10, 0x00, 0x18, 0x20, 0x1D, 0xDB, 0xA5, 0x98, 0x6C, 0xE4, 0x53, 0x14, 0x99, 0x35, 0x44,
+    0xA7, 0xB0, 0xEC, 0xC8, 0xE4, 0xA9, 0xA9, 0x2F, 0x9E, 0x6D, 0xDF, 0x96, 0x4E, 0xB1, 0x59, 0x9B,
+    0x41, 0xCF, 0xAA, 0xCD, 0xA6, 0x0D, 0x9C, 0x05, 0xCF, 0xE4, 0x31, 0xCE, 0x65, 0x23, 0x5A, 0x63,
+    0x23, 0xDA, 0xBF, 0x56, 0x11, 0x6D, 0xB7, 0x7B, 0xCE, 0x6C, 0x36, 0x25, 0x7F, 0x6A, 0x25, 0xFC,
+    0x33, 0xCF, 0xE6, 0xED, 0xE7, 0xEF, 0x9B, 0x7B, 0x8C, 0x4D, 0xBD, 0xFE, 0xC1, 0x48, 0xF0, 0xF5,
+    0x05, 0x09, 0xEA, 0x78, 0xF7, 0xE5, 0xE6, 0x1A, 0x55, 0xA7, 0x76, 0x1A, 0xDE, 0xB9, 0x28, 0x51,
+    0xFE, 0xDD, 0xDD, 0xE8, 0xF7, 0xFB, 0xE6, 0x76, 0x62, 0xA6, 0x8C, 0xF5, 0xD2, 0x2F, 0x2A, 0xCD,
+    0x6E, 0xFC, 0x5B, 0x95, 0x39, 0x5F, 0xAD, 0x32, 0xAE, 0xA2, 0x58, 0x0E, 0x6D, 0xD0, 0x31, 0xBD,
+    0x3F, 0x21, 0x8F, 0xC2, 0x04, 0x9C, 0xEB, 0xCC, 0xE0, 0xA8, 0x00, 0x1B, 0x22, 0x38, 0xA7, 0x4D,
+    0xB6, 0xDA, 0x33, 0x96, 0xB0, 0xA8, 0x4D, 0x4E, 0x23, 0xA3, 0x56, 0xEC, 0xF6, 0xE5, 0x11, 0x6C,
+    0x05, 0xDB, 0x12, 0xF6, 0x79, 0xD0, 0x4F, 0x97, 0x91, 0x2F, 0xDA, 0xC2, 0x56, 0xED, 0x6F, 0x02,
+    0x32, 0x23, 0x7A, 0xB1, 0xD9, 0xEC, 0x23, 0x07, 0x6B, 0xF1, 0x6B, 0xC7, 0xC1, 0xE2, 0xE6, 0x69,
+    0x05, 0xC5, 0xFF, 0xCD, 0xE0, 0x67, 0x5F, 0x6E, 0xCB, 0x39, 0x36, 0xE9, 0x19, 0x18, 0xBF, 0x27,
+    0x14, 0xCF, 0x67, 0x8A, 0x94, 0xE8, 0xFE, 0x26, 0x84, 0x2C, 0x4C, 0x07, 0xFB, 0x7D, 0xC4, 0x45,
+    0xD8, 0xD2, 0xE9, 0x9F, 0x11, 0x69, 0x51, 0x71, 0x50, 0xF8, 0xF6, 0xFD, 0x9A, 0xEA, 0xB8, 0xE9,
+    0xD0, 0x80, 0x42, 0x08, 0xF6, 0x4C, 0xDA, 0x38, 0xD7, 0x3F, 0xB4, 0x70, 0x03, 0x48, 0x76, 0x3F,
+    0xCB, 0x26, 0xCD, 0x81, 0xB5, 0x7C, 0xCC, 0x7B, 0x80, 0x1F, 0xEA, 0x70, 0x5A, 0xC0, 0x0E, 0xAE,
+    0xF1, 0x01, 0x85, 0x71, 0xBF, 0x22, 0xD2, 0xEB, 0x31, 0x10, 0xA9, 0x36, 0x98, 0x74, 0xC5, 0x6D,
+    0x60, 0x6A, 0xC6, 0x23, 0x70, 0x2C, 0x4F, 0xAF, 0x70, 0xF0, 0x2A, 0xC8, 0xD3, 0x06, 0x0F, 0x46,
+    0xEF, 0xE4, 0x7C, 0x95, 0x00, 0x02, 0x46, 0xC1, 0xFD, 0x54, 0x24, 0xAF, 0x6E, 0xCB, 0xAF, 0x5D,
+    0x42, 0xE8, 0x92, 0xD2, 0x9B, 0xF3, 0xFC, 0xC6, 0xE5, 0xDF, 0x0C, 0x3D, 0xD1, 0xFE, 0xF4, 0x30,
+    0xDD, 0x98, 0x9D, 0x7D, 0xA2, 0x5D, 0x3E, 0xD4, 0x79, 0x6C, 0x9E, 0xB2, 0xF3, 0x48, 0x80, 0x3F,
+    0x69, 0x2D, 0xA9, 0x3B, 0x73, 0xC3, 0xB0, 0x3B, 0xA2, 0x2D, 0x92, 0x82, 0x6D, 0xC5, 0xA7, 0x22,
+    0xFF, 0x01, 0x75, 0x54, 0xCF, 0x8F, 0x1B, 0x35, 0x14, 0xFE, 0x26, 0xB3, 0x49, 0xDA, 0x44, 0xD4,
+    0x11, 0x4A, 0xA0, 0x55, 0xD5, 0x9D, 0x1E, 0x51, 0x61, 0x77, 0x38, 0x2C, 0x52, 0x90, 0x92, 0x19,
+    0xDF, 0xB9, 0xCC, 0x61, 0x23, 0x0E, 0x1C, 0xD8, 0xF3, 0x4A, 0x68, 0x23, 0x94, 0x8A, 0xA5, 0x64,
+    0x33, 0xFE, 0x0B, 0x68, 0x0E, 0x88, 0x2B, 0x11, 0x2A, 0xA8, 0x84, 0x43, 0xE7, 0xB0, 0x48, 0xAB,
+    0xD2, 0x76, 0x7C, 0xE3, 0xC0, 0xC5, 0xE5, 0xC2, 0xD5, 0xFC, 0x16, 0x42, 0x42, 0x3E, 0xA4, 0x22,
+    0x45, 0xD9, 0x98, 0xE7, 0x99, 0x05, 0xB5, 0xAA, 0xB0, 0x9F, 0x3C, 0x63, 0x3F, 0xFB, 0xF9, 0x7D,
+    0xEF, 0x7D, 0xCF, 0x40, 0xAC, 0x9A, 0xA6, 0xB2, 0xC2, 0x04, 0x40, 0x65, 0x8D, 0xFA, 0x02, 0x81,
+    0x42, 0x04, 0xD7, 0x3C, 0xCB, 0xEB, 0x56, 0xB2, 0x6F, 0x4C, 0x84, 0x65, 0x53, 0x8D, 0xE2, 0xF5,
+    0x62, 0x62, 0xCD, 0xE8, 0xB2, 0xB8, 0x36, 0x17, 0xB1, 0x95, 0x24, 0xB4, 0x27, 0xB6, 0x2B, 0x92,
+    0x6B, 0xF3, 0xDB, 0x2D, 0x24, 0x63, 0xCF, 0xC4, 0x56, 0x07, 0x56, 0x56, 0x1E, 0x93, 0x26, 0x14,
+    0xB1, 0x8C, 0x65, 0x03, 0x5B, 0x75, 0x91, 0x32, 0x95, 0x32, 0xD9, 0xF6, 0xF8, 0x3E, 0x4F, 0xF5,
+    0x8B, 0xC6, 0x37, 0x81, 0x0A, 0x68, 0x47, 0x53, 0xC5, 0x8B, 0x6E, 0xAF, 0xDB, 0x8B, 0x17, 0x4D,
+    0x45, 0x53, 0xF6, 0xD3, 0x32, 0xBC, 0xA9, 0x27, 0x81, 0x38, 0xEE, 0xBB, 0xDB, 0x43, 0xBE, 0x62,
+    0xBF, 0x2D, 0x7C, 0xAB, 0x60, 0x45, 0xFB, 0x88, 0x1A, 0xDA, 0xED, 0x71, 0xBF, 0xEC, 0x85, 0x7B,
+    0xF1, 0x4D, 0x45, 0xBE, 0xF9, 0x3F, 0x2C, 0x61, 0xC6, 0xE0, 0xF0, 0x16, 0x78, 0x7E, 0xC1, 0x0F,
+    0x3F, 0x55, 0xD1, 0x5B, 0x32, 0xB0, 0xBC, 0xB6, 0x04, 0x5A, 0x68, 0x5A, 0xF2, 0x50, 0x4E, 0xDE,
+    0xD4, 0xC7, 0x9E, 0xAE, 0x2B, 0x26, 0x99, 0x24, 0xB7, 0x44, 0xCA, 0x3B, 0x60, 0x2A, 0x90, 0xA1,
+    0x8C, 0x79, 0x4C, 0x60, 0xDB, 0x48, 0x41, 0x7F, 0x22, 0x20, 0x7D, 0x53, 0x79, 0xFC, 0x69, 0x9D,
+    0xF3, 0x45, 0xBB, 0xC0, 0x78, 0x2B, 0xFA, 0xA3, 0x99, 0xBF, 0x62, 0x26, 0x14, 0x47, 0x00, 0xF7,
+    0xE4, 0xCB, 0x84, 0xD1, 0x93, 0xE0, 0x2D, 0xEC, 0x20, 0x22, 0xC4, 0x3B, 0x74, 0x69, 0xBE, 0xDC,
+    0x3F, 0x41, 0xB7, 0xEC, 0xFE, 0xB2, 0xBE, 0x60, 0x26, 0x56, 0x29, 0xED, 0x38, 0x1F, 0x1D, 0x1E,
+    0xF7, 0xAF, 0x34, 0xC0, 0x10, 0xF0, 0x5C, 0x03, 0xB9, 0x3E, 0x98, 0x32, 0x9A, 0xB9, 0xC6, 0x70,
+    0x30, 0xCD, 0x35, 0x43, 0x03, 0x9D, 0x42, 0xE7, 0x25, 0xBE, 0x29, 0xFB, 0x81, 0xC9, 0xE9, 0xF4,
+    0x2E, 0x56, 0x67, 0xDD, 0x4E, 0x53, 0x1D, 0xA8, 0x0D, 0xA4, 0x3C, 0x17, 0x31, 0xDF, 0x78, 0x2A,
+    0xBE, 0x4F, 0x46, 0xB4, 0xCA, 0x09, 0x04, 0x41, 0x78, 0x09, 0x9B, 0x94, 0x8B, 0xBA, 0xF6, 0x8D,
+    0x55, 0x39, 0xF7, 0xC0, 0x78, 0x1F, 0x63, 0x4C, 0x92, 0x58, 0x37, 0xA7, 0x65, 0x5C, 0x53, 0xAB,
+    0x26, 0x5F, 0xAA, 0x21, 0x9C, 0xB4, 0xC0, 0x93, 0x24, 0xC9, 0x8C, 0xA6, 0xB0, 0x55, 0xAB, 0xCE,
+    0xB3, 0xFB, 0x95, 0x45, 0xF8, 0x89, 0x62, 0x96, 0xFB, 0xEB, 0x33, 0x52, 0xF8, 0x44, 0x8A, 0xEF,
+    0xCD, 0x36, 0x96, 0xB4, 0xF9, 0xA4, 0xA2, 0xE9, 0x78, 0x68, 0x45, 0xED, 0xF1, 0x33, 0xF1, 0xD6,
+    0xBD, 0x60, 0xBD, 0x8A, 0xF3, 0x45, 0xAF, 0x39, 0xFD, 0x8F, 0x32, 0xB9, 0x5D, 0x5B, 0x6B, 0x07,
+    0x83, 0xC4, 0xDA, 0x65, 0x67, 0x90, 0x90, 0x41, 0xFA, 0x99, 0xCF, 0x6F, 0x35, 0x45, 0x16, 0xAF,
+    0xCD, 0x03, 0xAB, 0xB3, 0x80, 0x3F, 0x49, 0xAB, 0x32, 0xD3, 0x74, 0x64, 0x55, 0x0C, 0x9D, 0xC1,
+    0x60, 0xB0, 0xEB, 0x96, 0xEA, 0x02, 0xB1, 0xAC, 0x58, 0x1E, 0x2C, 0xE9, 0x8B, 0x2D, 0x94, 0x6D,
+    0x0C, 0x50, 0xDA, 0x0D, 0x2A, 0x06, 0xBE, 0x42, 0x5D, 0xA2, 0x29, 0x08, 0xAF, 0x4B, 0x5A, 0xBF,
+    0x50, 0x9E, 0x00, 0x94, 0x46, 0x52, 0xEA, 0x42, 0x29, 0x9D, 0x92, 0x98, 0x48, 0x74, 0xA7, 0x34,
+    0xEF, 0xDD, 0xDB, 0xBA, 0x32, 0x1E, 0x95, 0x61, 0x20, 0x21, 0x58, 0x9D, 0x01, 0x27, 0xC9, 0xAD,
+    0x9E, 0x61, 0x46, 0x72, 0x77, 0xAE, 0xE7, 0xF3, 0x19, 0x45, 0x85, 0x70, 0x50, 0x84, 0x28, 0x4E,
+    0xC0, 0x75, 0x15, 0x8A, 0x80, 0xDF, 0x50, 0x2D, 0x7E, 0xFE, 0x28, 0xEB, 0x6E, 0x5D, 0x18, 0x27,
+    0xCF, 0x62, 0x23, 0x00, 0x92, 0xB9, 0x1A, 0x23, 0xCA, 0xF8, 0xA7, 0xC4, 0x1D, 0x39, 0x41, 0x70,
+    0x86, 0x57, 0x99, 0x80, 0xC8, 0x98, 0xF2, 0x40, 0x30, 0x7E, 0xC1, 0x41, 0xA8, 0x26, 0xD8, 0x0C,
+    0x7E, 0x14, 0x71, 0xF0, 0xAD, 0x8E, 0xC3, 0x37, 0xF4, 0x46, 0xE4, 0xF1, 0xDB, 0x94, 0xF5, 0x53,
+    0x58, 0x9E, 0xBA, 0xC8, 0xA4, 0xF6, 0xF4, 0xFD, 0xC1, 0x3B, 0x43, 0x3C, 0x47, 0x42, 0xD3, 0x67,
+    0x6F, 0x7B, 0xB2, 0x4A, 0xAE, 0x89, 0x54, 0x79, 0x45, 0x77, 0x99, 0xEB, 0xF2, 0xF0, 0x91, 0xBA,
+    0x61, 0xE5, 0xBB, 0x7F, 0xC2, 0x23, 0x53, 0x33, 0x57, 0x32, 0x24, 0xD5, 0x64, 0x1A, 0xFF, 0x4A,
+    0x70, 0x65, 0x16, 0x72, 0x17, 0xBB, 0xA5, 0x5B, 0x74, 0x9E, 0x70, 0x11, 0xFE, 0x25, 0x5F, 0xCF,
+    0x45, 0x6B, 0x03, 0xC1, 0x43, 0x45, 0xA0, 0x77, 0xB6, 0xDD, 0x7A, 0xE5, 0x1C, 0x82, 0x3B, 0x9C,
+    0xA6, 0x8D, 0x06, 0xCE, 0xB8, 0x4B, 0xF8, 0xE0, 0xBA, 0x75, 0xA5, 0xF1, 0xBB, 0x77, 0xAB, 0x96,
+    0xB9, 0x0B, 0x87, 0xAA, 0xFA, 0x19, 0x86, 0xE8, 0x54, 0xE9, 0xB2, 0x3D, 0x4C, 0xDD, 0xA5, 0x6D,
+    0x3C, 0xA4, 0x61, 0xF8, 0x1D, 0x70, 0xAE, 0x1C, 0x68, 0xDF, 0xC6, 0xB0, 0x22, 0x70, 0x11, 0x48,
+    0xA8, 0x63, 0xD7, 0x4B, 0xA0, 0xCE, 0x7F, 0x8E, 0x61, 0x61, 0xE0, 0x17, 0x6F, 0xB7, 0x9A, 0x15,
+    0x46, 0xAF, 0x52, 0x92, 0xEA, 0x32, 0x90, 0x5D, 0x77, 0xE1, 0x66, 0x74, 0xD8, 0xDB, 0xAE, 0xD2,
+    0xF6, 0xE6, 0x1A, 0x44, 0xBD, 0x9E, 0x2F, 0xAF, 0x3F, 0x52, 0xE4, 0x37, 0x32, 0x52, 0xBE, 0x46,
+    0xA5, 0x1B, 0xF0, 0x48, 0xBA, 0xEA, 0x0C, 0x45, 0x9F, 0xB8, 0xEF, 0x51, 0x55, 0x86, 0xBC, 0x4E,
+    0xB3, 0x1D, 0xCC, 0x6A, 0x98, 0x30, 0xC1, 0x3E, 0x94, 0x93, 0x57, 0xD4, 0x6C, 0x67, 0x86, 0xC3,
+    0x88, 0x6D, 0x8F, 0xAF, 0x52, 0x86, 0x90, 0xF3, 0x9C, 0x5F, 0x2A, 0xD0, 0xA4, 0xEA, 0x60, 0x1A,
+    0x8A, 0x4E, 0xC9, 0x43, 0x97, 0x69, 0x3D, 0xCB, 0xBE, 0x7A, 0xA4, 0xC3, 0xB7, 0x45, 0x9B, 0xAA,
+    0x3C, 0x96, 0x2F, 0x48, 0x72, 0x18, 0xF7, 0x48, 0x1D, 0xC5, 0x02, 0x95, 0x15, 0x5B, 0x7F, 0x9C,
+    0x9B, 0x0A, 0xD1, 0x53, 0xE0, 0xB2, 0xFD, 0xF9, 0xFF, 0x15, 0xA9, 0xB5, 0xA7, 0xFB, 0xF3, 0xF9,
+    0x17, 0xFF, 0x7E, 0x9B, 0xF6, 0x23, 0x04, 0x44, 0xEB, 0xBF, 0xD7, 0x0F, 0xF6, 0x89, 0xDB, 0x19,
+    0xAA, 0x77, 0xA6, 0xA8, 0xD9, 0x5B, 0x54, 0x63, 0xD6, 0x72, 0x66, 0xE7, 0xD6, 0xC4, 0x53, 0xD4,
+    0x57, 0xF7, 0xC9, 0xE0, 0x04, 0x4F, 0xB7, 0x57, 0x41, 0x16, 0xE6, 0xA7, 0xCE, 0xA6, 0xB5, 0xC5,
+    0xCA, 0x61, 0x31, 0xB6, 0xDC, 0x6B, 0xA5, 0x60, 0x42, 0x73, 0x6C, 0xEE, 0x9A, 0x4B, 0x2D, 0x37,
+    0x1B, 0x65, 0xB9, 0x19, 0x21, 0x9A, 0xD5, 0xA6, 0xC8, 0x5A, 0x99, 0x6B, 0x7B, 0xB4, 0x2C, 0x47,
+    0xC6, 0xFD, 0x46, 0xBA, 0xC1, 0xB3, 0xB2, 0x99, 0x89, 0xB9, 0x44, 0xA1, 0x60, 0xBA, 0x5F, 0xBC,
+    0x5D, 0xDB, 0xB3, 0x1A, 0xC1, 0xA4, 0x98, 0x66, 0x31, 0x19, 0x73, 0x9B, 0x4B, 0x3D, 0x2D, 0xE0,
+    0x6B, 0x7D, 0x62, 0xCA, 0x43, 0x7B, 0x64, 0x0B, 0x1F, 0xFC, 0xA1, 0x0E, 0x97, 0x66, 0x94, 0x9D,
+    0xC9, 0xD5, 0x3D, 0xCA, 0xE4, 0x7B, 0xF4, 0x42, 0x8E, 0x8A, 0x4E, 0x67, 0xE8, 0x15, 0xCA, 0x79,
+    0xF9, 0x24, 0x46, 0xBC, 0x81, 0x6C, 0x34, 0x32, 0x5D, 0xB5, 0x29, 0x99, 0xA8, 0x61, 0xAB, 0xC7,
+    0x32, 0x5F, 0x37, 0xCD, 0x66, 0xB7, 0x7D, 0xF1, 0x1F, 0xCD, 0x5C, 0x3D, 0x90, 0x1D, 0xD5, 0x95,
+    0xBE, 0xDD, 0x4F, 0x33, 0x6D, 0xAB, 0xCB, 0xDB, 0x0A, 0x50, 0xAD, 0x57, 0xAA, 0x72, 0x13, 0x38,
+    0xD8, 0x52, 0xD9, 0x74, 0xB2, 0x81, 0x5D, 0x85, 0xE9, 0x16, 0x04, 0x04, 0x04, 0x4C, 0xA0, 0x27,
+    0x02, 0x02, 0x1C, 0x38, 0x58, 0x48, 0x86, 0x60, 0xB7, 0x8A, 0x72, 0x01, 0xDD, 0x82, 0x80, 0xDA,
+    0xA2, 0xD6, 0x4C, 0xB0, 0xEC, 0x86, 0x28, 0xA0, 0xB6, 0xA4, 0xA7, 0xDA, 0x12, 0x01, 0x81, 0x03,
+    0x6B, 0x6E, 0x03, 0x01, 0x01, 0x81, 0x1A, 0xB3, 0x98, 0xC0, 0x01, 0x0D, 0xC8, 0xCB, 0x96, 0x08,
+    0xD4, 0xD8, 0x4F, 0xB8, 0x25, 0x75, 0xF7, 0xDD, 0xEF, 0x3B, 0xB7, 0xBB, 0xDF, 0x9B, 0xD1, 0x68,
+    0x24, 0x46, 0x23, 0x7B, 0x67, 0xDE, 0x39, 0x3D, 0xD3, 0x3F, 0xB7, 0xEF, 0xCF, 0xF9, 0x3F, 0xE7,
+    0x3E, 0xA5, 0x54, 0x58, 0x2A, 0x6F, 0xAE, 0x9C, 0x46, 0xA9, 0x87, 0x14, 0x7E, 0xB4, 0xA9, 0x8D,
+    0xFD, 0x4C, 0xD7, 0x8C, 0x52, 0xFD, 0xC7, 0x54, 0xFD, 0x67, 0xF9, 0x24, 0xCF, 0xF7, 0x37, 0x1F,
+    0x71, 0xB3, 0xF8, 0xD5, 0x0A, 0x1F, 0xFC, 0xB1, 0xE7, 0x46, 0x52, 0x63, 0x4A, 0x3C, 0x6A, 0x2A,
+    0x8B, 0x0E, 0xEB, 0xD7, 0xD7, 0x94, 0x4A, 0x13, 0xB5, 0x05, 0x99, 0x9A, 0xC8, 0x24, 0x44, 0xB9,
+    0x4A, 0xB3, 0xB8, 0xC4, 0x85, 0xA0, 0xDA, 0x82, 0x42, 0xA0, 0x47, 0x4D, 0xA1, 0xD2, 0xC7, 0x78,
+    0xCB, 0x63, 0x1D, 0xC7, 0xB5, 0x46, 0xA4, 0xFC, 0xB9, 0x0A, 0x0B, 0x15, 0x27, 0xEA, 0x37, 0x76,
+    0xAC, 0x8D, 0x31, 0x2D, 0x3F, 0xD3, 0x13, 0x5B, 0x7A, 0xB4, 0xEB, 0x47, 0x7E, 0x22, 0xB3, 0xE1,
+    0xA0, 0x93, 0x1E, 0x20, 0x68, 0x9D, 0x02, 0xBD, 0x50, 0x71, 0x8E, 0x9E, 0x61, 0xF4, 0xFA, 0xF2,
+    0x8C, 0x03, 0xB0, 0xF0, 0xFA, 0x54, 0x69, 0xF4, 0x3B, 0xC5, 0xB5, 0xB8, 0xC0, 0x64, 0xD7, 0xEA,
+    0xE7, 0x01, 0x9E, 0x71, 0x39, 0xC0, 0xD4, 0x6C, 0xF4, 0xAD, 0xB9, 0xE6, 0x52, 0x68, 0xDA, 0xD8,
+    0x34, 0x3A, 0x7B, 0x4E, 0xA3, 0x05, 0x7C, 0x72, 0x15, 0xD7, 0x2A, 0x34, 0xD9, 0x84, 0x37, 0x36,
+    0xCA, 0x6B, 0x95, 0xC2, 0x38, 0xBA, 0x4B, 0x2E, 0xFA, 0x8B, 0x5E, 0xCF, 0xD7, 0x8D, 0x9D, 0xE8,
+    0xED, 0x3F, 0xEA, 0xC0, 0x0B, 0x0F, 0x6D, 0xA6, 0x2F, 0x3C, 0xA4, 0x0E, 0x60, 0xB4, 0x55, 0x70,
+    0xDB, 0x5F, 0xBE, 0xCC, 0xEC, 0xE5, 0xE3, 0x76, 0xCA, 0xB4, 0x0A, 0xCB, 0x81, 0x89, 0xB6, 0x93,
+    0x29, 0xF3, 0xCC, 0x2E, 0x2C, 0x0E, 0xDD, 0x54, 0x0E, 0xAD, 0xDA, 0x76, 0x98, 0x25, 0x72, 0xE0,
+    0x62, 0x36, 0x38, 0x74, 0xA4, 0x3F, 0xF3, 0xA4, 0x91, 0x83, 0xD2, 0x99, 0x1C, 0xE2, 0xCC, 0xB5,
+    0x87, 0x09, 0x0F, 0x69, 0xE6, 0xE1, 0x55, 0xAE, 0x49, 0xCC, 0x5C, 0x1A, 0xC7, 0xB4, 0x60, 0x22,
+    0x14, 0x16, 0xD8, 0x60, 0x1A, 0x0F, 0xD8, 0x79, 0xD4, 0x6A, 0x32, 0x67, 0xDF, 0x70, 0xEB, 0xED,
+    0x30, 0x7F, 0x12, 0xC1, 0x95, 0xE0, 0x9A, 0xE7, 0xBD, 0x86, 0x18, 0x53, 0x0C, 0xEC, 0xB4, 0x8B,
+    0xBF, 0x8F, 0xF2, 0xBC, 0xBD, 0x07, 0x34, 0x4A, 0xDC, 0x25, 0x37, 0x53, 0x6B, 0x72, 0x33, 0xB5,
+    0x9E, 0xDF, 0x4A, 0xAD, 0x45, 0xBA, 0x03, 0xB5, 0xDE, 0x8C, 0xF8, 0x83, 0x41, 0x2B, 0xFE, 0x19,
+    0xE6, 0x3D, 0x63, 0x72, 0x74, 0x7E, 0x65, 0xC0, 0xAF, 0x98, 0x93, 0x1C, 0xB3, 0x94, 0x18, 0x07,
+    0x4B, 0xC0, 0xC9, 0xF1, 0x39, 0x25, 0xA5, 0x32, 0x32, 0x19, 0x38, 0x3E, 0x85, 0xB9, 0xF1, 0x70,
+    0x7E, 0x82, 0xEB, 0xF2, 0x9B, 0xE2, 0xFE, 0x18, 0xCF, 0x05, 0x78, 0xDE, 0x6F, 0x6C, 0x63, 0x20,
+    0x9F, 0x08, 0x2B, 0xE7, 0xE1, 0x1D, 0xCE, 0xBC, 0x6F, 0xDF, 0xC3, 0x68, 0x03, 0x40, 0x08, 0x88,
+    0x01, 0x29, 0xA0, 0x6B, 0x8D, 0xDB, 0xB6, 0x66, 0x72, 0xB5, 0x35, 0xFE, 0xD7, 0xAD, 0x09, 0x3E,
+    0x6C, 0x4D, 0xF4, 0x4E, 0x6B, 0xE2, 0xE3, 0xAD, 0xD1, 0x98, 0xA3, 0x06, 0xC0, 0xB9, 0xAA, 0x00,
+    0x25, 0x20, 0x77, 0x5A, 0x75, 0x62, 0x25, 0xC1, 0x4A, 0x06, 0x68, 0xDD, 0x68, 0x32, 0x05, 0x57,
+    0x7D, 0xF5, 0xCD, 0x9E, 0xD6, 0xC1, 0x0E, 0x9A, 0xBC, 0xD2, 0xA9, 0x28, 0xC7, 0x02, 0x07, 0xE5,
+    0xA4, 0x46, 0xBF, 0x20, 0x82, 0xBC, 0xB9, 0x5F, 0x61, 0xD8, 0x78, 0xCC, 0x69, 0x23, 0x3C, 0xD6,
+    0xC5, 0xE8, 0x62, 0x9A, 0xE2, 0x91, 0x98, 0x94, 0x15, 0x82, 0x03, 0x54, 0xC0, 0xCE, 0x07, 0xEC,
+    0x6E, 0xC4, 0xB9, 0x21, 0xE9, 0x85, 0x98, 0x5D, 0x7B, 0xB1, 0x1F, 0x84, 0x8B, 0xC5, 0x9A, 0xEC,
+    0x0D, 0x84, 0xB5, 0x2C, 0x50, 0x4E, 0x8C, 0x70, 0x70, 0x63, 0x78, 0x75, 0x2B, 0xBC, 0xCF, 0x3E,
+    0x69, 0xAE, 0x2F, 0xBB, 0xA8, 0xA5, 0xB3, 0x58, 0x27, 0xA7, 0x0D, 0x4A, 0xBC, 0x3D, 0xE0, 0x28,
+    0x38, 0x9E, 0x6B, 0x4F, 0xD6, 0xCA, 0x67, 0x53, 0xE0, 0xF8, 0x16, 0xFD, 0x04, 0x99, 0x43, 0x06,
+    0x70, 0xF5, 0x30, 0x09, 0x90, 0x14, 0x58, 0x95, 0x04, 0xFF, 0x90, 0x71, 0x84, 0xA2, 0x09, 0xD3,
+    0x13, 0xC2, 0x23, 0x23, 0xC8, 0xB2, 0x92, 0x53, 0x40, 0xAC, 0x8E, 0xC9, 0xED, 0xD2, 0xF7, 0xE0,
+    0x98, 0xCC, 0x3E, 0xD7, 0x2A, 0x4B, 0x8B, 0x1B, 0xC2, 0x4A, 0x37, 0xDF, 0x9B, 0x66, 0xE6, 0x9C,
+    0x11, 0x6E, 0x93, 0xFB, 0x1D, 0xCD, 0xF3, 0x85, 0xC1, 0xFA, 0x5B, 0xC0, 0xFF, 0x86, 0x6D, 0xF1,
+    0xD9, 0x4B, 0x7B, 0x95, 0x8A, 0xA0, 0xF0, 0xAC, 0x27, 0x73, 0x41, 0x53, 0xC8, 0xBC, 0x54, 0xC6,
+    0xBA, 0x03, 0xEA, 0x46, 0xD4, 0x02, 0x81, 0xDD, 0xE3, 0x7C, 0x42, 0x04, 0x4A, 0x8E, 0xD9, 0x19,
+    0x59, 0x83, 0x01, 0x29, 0x59, 0xD2, 0x01, 0xCD, 0x40, 0xAF, 0x67, 0xF6, 0xA6, 0x60, 0xE2, 0x1C,
+    0xCB, 0xD2, 0x81, 0x83, 0xBC, 0xB9, 0xDB, 0x82, 0x99, 0xBC, 0x39, 0x44, 0x01, 0xD7, 0x0A, 0x4B,
+    0xE6, 0x74, 0xDE, 0x9C, 0xFC, 0xA0, 0xBD, 0x39, 0x85, 0x78, 0xFC, 0xFE, 0x9C, 0x83, 0x0A, 0x39,
+    0xB9, 0x8A, 0x0B, 0xD8, 0x2C, 0xFE, 0x8B, 0x7F, 0x7F, 0x8D, 0xD7, 0xF4, 0x2B, 0x73, 0x30, 0x91,
+    0x63, 0xBC, 0x39, 0x86, 0x31, 0x69, 0xBD, 0x39, 0xD4, 0x8E, 0x5F, 0xA3, 0xB1, 0xB9, 0xD0, 0x33,
+    0xC7, 0x53, 0xE0, 0x45, 0xE4, 0x3E, 0xBC, 0x96, 0x54, 0xAA, 0xD4, 0x51, 0x50, 0x2C, 0xDB, 0x4A,
+    0x31, 0xD7, 0x3F, 0x75, 0x97, 0x56, 0x1A, 0xAC, 0xBC, 0xAA, 0x49, 0x2E, 0x05, 0xA0, 0x56, 0xCE,
+    0x13, 0xC6, 0xB2, 0x8A, 0xC8, 0x11, 0x9D, 0x40, 0xD9, 0xF4, 0x34, 0xC2, 0x67, 0x8B, 0x7D, 0x65,
+    0x57, 0x67, 0x6D, 0x25, 0x99, 0xCC, 0xA3, 0xCC, 0xED, 0xC8, 0x9A, 0x60, 0xB5, 0x23, 0x1B, 0xFB,
+    0xDA, 0xFE, 0xBE, 0x89, 0x2D, 0xD1, 0x29, 0x0B, 0x24, 0xBA, 0xA5, 0xA5, 0xFE, 0x1A, 0x11, 0x08,
+    0xE9, 0x26, 0xE4, 0x8E, 0x68, 0x42, 0xE4, 0xD7, 0x40, 0xD0, 0x21, 0x9A, 0x1A, 0x04, 0x28, 0x03,
+    0x12, 0xED, 0xA1, 0x0B, 0x8E, 0xB5, 0xE2, 0x60, 0x2B, 0x15, 0xB5, 0xB8, 0x05, 0x43, 0xAE, 0x31,
+    0xE6, 0xAE, 0x51, 0x17, 0xDA, 0xEE, 0x82, 0x6A, 0xDA, 0xEE, 0x45, 0x55, 0xB7, 0x5D, 0xEC, 0xCE,
+    0x81, 0x1E, 0xA9, 0xDA, 0x2E, 0x7A, 0xB9, 0x6C, 0xBB, 0xE0, 0x83, 0x02, 0xE8, 0x62, 0xDE, 0x76,
+    0xFE, 0x15, 0x20, 0xCF, 0x24, 0x6D, 0x37, 0x31, 0xAA, 0xED, 0x5C, 0x22, 0x48, 0xC3, 0x76, 0x57,
+    0x91, 0xB4, 0x24, 0x72, 0xCC, 0xF4, 0x89, 0x5D, 0xC5, 0xD3, 0x60, 0x79, 0x24, 0x4A, 0xCC, 0x07,
+    0x11, 0x2D, 0x61, 0xED, 0x71, 0x8E, 0x40, 0x5E, 0x31, 0xAD, 0x21, 0x90, 0x2E, 0x04, 0x4A, 0x72,
+    0x33, 0x92, 0x0B, 0xA9, 0x18, 0x4C, 0xA0, 0xC0, 0x44, 0x1E, 0x13, 0xAA, 0x46, 0x53, 0x73, 0x32,
+    0x6F, 0xD6, 0x8B, 0x4F, 0xE1, 0x94, 0x3B, 0xEB, 0xCF, 0x6E, 0xA0, 0xBB, 0xAC, 0x17, 0x38, 0x58,
+    0xCC, 0x93, 0x5C, 0x4C, 0x2C, 0x3C, 0x88, 0xD9, 0x02, 0x04, 0xD4, 0x13, 0x83, 0xE0, 0x02, 0x11,
+    0x5C, 0x4F, 0xB6, 0x0A, 0xBD, 0x25, 0x58, 0x36, 0xB6, 0x30, 0xE0, 0x32, 0x6C, 0x9D, 0x7C, 0x8B,
+    0xB1, 0x95, 0x6C, 0x05, 0x9E, 0x13, 0x63, 0xAB, 0x14, 0x63, 0x6B, 0x03, 0x63, 0x2C, 0x5D, 0x52,
+    0x57, 0x6F, 0x6C, 0x41, 0x36, 0x55, 0xBA, 0x87, 0xC3, 0xE9, 0xC7, 0x6B, 0x8A, 0xC2, 0x7B, 0x0F,
+    0x70, 0x8F, 0xB5, 0xD8, 0x42, 0x9B, 0x8D, 0x78, 0xDD, 0x5C, 0x83, 0x55, 0x80, 0x75, 0x29, 0xB8,
+    0x70, 0x98, 0xDA, 0x78, 0xAE, 0x3D, 0x4A, 0x4F, 0xED, 0x70, 0x52, 0x35, 0xA7, 0x78, 0xE9, 0xD7,
+    0x9E, 0xB1, 0x57, 0x71, 0xA7, 0xDF, 0xF6, 0x4F, 0xB9, 0xD2, 0x02, 0xA6, 0xF4, 0xDA, 0xB6, 0xF6,
+    0xD5, 0x61, 0x25, 0xD3, 0x47, 0xD5, 0x00, 0xE9, 0x18, 0x54, 0x20, 0x38, 0xAF, 0x16, 0x65, 0x06,
+    0x17, 0x41, 0x19, 0xCE, 0xB8, 0x36, 0xE3, 0x38, 0x38, 0x84, 0xA8, 0x19, 0xFE, 0x35, 0x98, 0x0F,
+    0xA7, 0xA5, 0x1C, 0xE4, 0xCD, 0xB0, 0x3B, 0x61, 0x67, 0x97, 0x22, 0xD1, 0x61, 0x26, 0xE2, 0x9A,
+    0x41, 0x6F, 0x30, 0x43, 0x42, 0xC5, 0x77, 0x8F, 0xF0, 0x93, 0x2F, 0x90, 0xB2, 0x8B, 0xB2, 0x84,
+    0x8E, 0x64, 0x71, 0x32, 0xA9, 0xD3, 0xEC, 0x66, 0x88, 0x09, 0x39, 0xE0, 0xEA, 0x7A, 0x0D, 0x69,
+    0x5E, 0xFB, 0x9C, 0x92, 0xF3, 0xFF, 0x01, 0x2B, 0x6D, 0xB2, 0x23, 0x68, 0xD8, 0x5F, 0x13, 0x68,
+    0x82, 0x28, 0xF7, 0xEA, 0x7D, 0xC4, 0x85, 0x57, 0xF7, 0x46, 0xE7, 0x12, 0xD6, 0xBC, 0x0A, 0x6E,
+    0xC0, 0xC1, 0xBF, 0x67, 0x87, 0x42, 0x84, 0xAE, 0xB1, 0xFA, 0x7E, 0xF9, 0x20, 0x24, 0x10, 0xEF,
+    0x7C, 0x10, 0xE9, 0xA0, 0x4D, 0xDE, 0xA3, 0xC3, 0x64, 0x30, 0xE1, 0xC0, 0x1E, 0x5D, 0x86, 0x73,
+    0x15, 0x53, 0x35, 0xC6, 0x6C, 0x28, 0xBE, 0x8C, 0x9B, 0xE2, 0x3C, 0x2A, 0x81, 0x82, 0x11, 0x85,
+    0x44, 0x90, 0xB1, 0x31, 0x57, 0x2C, 0xA6, 0xFC, 0x8E, 0x69, 0x6B, 0x70, 0x92, 0x8D, 0x12, 0xA1,
+    0xB1, 0x03, 0x9A, 0x25, 0x94, 0x90, 0xB5, 0x88, 0x49, 0xA0, 0x93, 0xE6, 0x11, 0x5C, 0x48, 0x5F,
+    0x06, 0x8A, 0xDF, 0x1B, 0x50, 0x0A, 0xE4, 0xF0, 0x82, 0xDC, 0x62, 0x1A, 0xA2, 0x0D, 0x08, 0xA0,
+    0x5B, 0x08, 0x14, 0xBA, 0x1E, 0xA3, 0x25, 0x74, 0xCE, 0x24, 0xBD, 0x96, 0xB9, 0x85, 0x55, 0x65,
+    0x35, 0xED, 0x51, 0xB1, 0xAC, 0xA8, 0x79, 0x8D, 0xFA, 0xA9, 0xC3, 0xC9, 0xE0, 0xB8, 0xC9, 0x15,
+    0x41, 0xB5, 0x3A, 0x3B, 0x4F, 0xC1, 0x24, 0xB0, 0x32, 0x85, 0x0A, 0xB3, 0x56, 0xBB, 0x88, 0xA8,
+    0x35, 0x58, 0x61, 0xD6, 0x13, 0x6C, 0xC0, 0xBE, 0xC5, 0x16, 0xBE, 0x5E, 0xA5, 0xC6, 0x03, 0x1B,
+    0xD2, 0x27, 0xD2, 0x62, 0x95, 0x99, 0xE3, 0x20, 0x68, 0xB1, 0x1A, 0x0C, 0x88, 0x0F, 0xFA, 0xD2,
+    0xA3, 0x21, 0x41, 0x49, 0xBF, 0x0D, 0x3F, 0x29, 0xD8, 0x5E, 0xB5, 0x77, 0xDA, 0xA7, 0x1C, 0x70,
+    0x59, 0x6E, 0xAC, 0xFD, 0x27, 0xEB, 0x41, 0x47, 0xA5, 0x1C, 0x5E, 0x79, 0x14, 0x7A, 0x99, 0xD3,
+    0x03, 0xF0, 0xDB, 0x27, 0x1A, 0xF2, 0xF7, 0x00, 0x3E, 0x66, 0x78, 0x62, 0xCE, 0x35, 0xBC, 0x8E,
+    0x07, 0x31, 0xD0, 0x4F, 0xC0, 0x65, 0x8F, 0x34, 0x6E, 0x87, 0xF3, 0xF8, 0x0D, 0x60, 0xCC, 0x44,
+    0x60, 0x67, 0x1A, 0x69, 0x8E, 0xBE, 0x44, 0x49, 0x42, 0xED, 0x93, 0xB9, 0x49, 0x6A, 0xA5, 0xE1,
+    0x61, 0x9D, 0xA3, 0xDD, 0x3C, 0x80, 0xB9, 0x1F, 0x17, 0x51, 0x8E, 0xC5, 0x07, 0xE0, 0xF7, 0xBA,
+    0xC9, 0x43, 0xF3, 0x69, 0xEE, 0x99, 0xC7, 0xF2, 0x71, 0xE8, 0xAB, 0xA2, 0xBF, 0xE9, 0x48, 0x25,
+    0x41, 0xB7, 0x26, 0x3E, 0x88, 0x88, 0x48, 0x48, 0x6B, 0xAD, 0x65, 0x2E, 0x32, 0x53, 0xD0, 0x34,
+    0xA6, 0x65, 0x1A, 0x16, 0xE0, 0xC0, 0x12, 0x50, 0xA4, 0xF8, 0x9F, 0x6D, 0x46, 0x37, 0x4C, 0xE2,
+    0xD3, 0x61, 0x34, 0xD6, 0x69, 0x39, 0x36, 0xDB, 0x90, 0xB1, 0x82, 0xA4, 0x92, 0x38, 0xD3, 0x19,
+    0xA8, 0x35, 0x89, 0x5F, 0xE7, 0xF8, 0x21, 0x21, 0x69, 0x71, 0x9F, 0xE2, 0x39, 0x3C, 0x49, 0xB8,
+    0x6C, 0x32, 0x92, 0x5E, 0x8C, 0x67, 0x67, 0xB3, 0x0D, 0x2C, 0x2F, 0x3F, 0xD3, 0xA4, 0xB3, 0xBE,
+    0xF5, 0x2D, 0x3E, 0x0E, 0x6E, 0x75, 0x7B, 0x9F, 0x7D, 0x02, 0x81, 0x28, 0x30, 0x5F, 0x02, 0x78,
+    0xD1, 0x1E, 0x7D, 0xE9, 0x32, 0xA0, 0x5A, 0xE9, 0x4C, 0x0F, 0x7C, 0x7A, 0x80, 0xA7, 0x95, 0x7A,
+    0x5A, 0xE9, 0x0D, 0xB1, 0xED, 0x22, 0xF6, 0x2A, 0xA7, 0x8C, 0x8E, 0x13, 0x33, 0x4D, 0xB3, 0x9E,
+    0x09, 0x33, 0xD3, 0x4B, 0xE2, 0x34, 0x77, 0x54, 0x7C, 0x5D, 0xCB, 0x2C, 0xBB, 0xE4, 0xAA, 0x15,
+    0x8C, 0x32, 0xC1, 0x6F, 0x86, 0x59, 0xCD, 0x34, 0x1C, 0xC4, 0x38, 0xEB, 0xC0, 0x36, 0xF1, 0xCB,
+    0xD0, 0xDE, 0x4D, 0xFC, 0x2A, 0xC8, 0xCD, 0xA4, 0x6F, 0x94, 0xCA, 0xB2, 0x96, 0xB5, 0xBE, 0x71,
+    0xE6, 0x0A, 0x24, 0x77, 0x1B, 0xBF, 0x0A, 0x8D, 0x24, 0x77, 0xE2, 0xA9, 0x53, 0x14, 0xED, 0x9C,
+    0x23, 0x3B, 0x23, 0xAB, 0x66, 0x03, 0x93, 0x04, 0x0A, 0x3C, 0x00, 0x83, 0x4C, 0xB5, 0xCE, 0x13,
+    0xA0, 0x81, 0x72, 0x82, 0x0E, 0xAE, 0xE2, 0x9D, 0xE6, 0x10, 0x24, 0xFE, 0xB9, 0x0E, 0xC4, 0x10,
+    0x09, 0x09, 0x9D, 0x55, 0xCF, 0xE0, 0xA5, 0x26, 0x87, 0x55, 0x93, 0xC3, 0xBC, 0xC9, 0x3B, 0x1F,
+    0x10, 0x5C, 0xC9, 0xBB, 0x68, 0x3D, 0xEF, 0x5E, 0x8C, 0xF2, 0x0E, 0xC4, 0xD1, 0x41, 0xB4, 0x9A,
+    0x0A, 0x50, 0x02, 0xB0, 0x54, 0x98, 0xEC, 0x7C, 0x25, 0x39, 0x01, 0x11, 0x8A, 0xD7, 0x7F, 0x09,
+    0x6D, 0x02, 0xF2, 0x15, 0xBF, 0xF3, 0x2E, 0xDA, 0x3B, 0x8B, 0xA9, 0xA0, 0x79, 0xD8, 0x41, 0x45,
+    0x75, 0xB0, 0xDE, 0x3B, 0x70, 0x9B, 0x59, 0xA7, 0x01, 0x49, 0xB6, 0x86, 0xF6, 0x4A, 0x0B, 0x39,
+    0xD7, 0xC1, 0x90, 0xEC, 0xA0, 0x7B, 0xE4, 0x5E, 0x4C, 0xA9, 0x8B, 0x45, 0x9C, 0x70, 0x01, 0x09,
+    0xD7, 0x9E, 0x1A, 0x17, 0x6E, 0x58, 0xBC, 0x01, 0xF8, 0x6B, 0xB0, 0x90, 0x20, 0xE6, 0xCA, 0xF4,
+    0xBE, 0xF8, 0x2C, 0xC3, 0x87, 0x66, 0x44, 0xCE, 0xE7, 0x73, 0x33, 0xF7, 0xD0, 0xD7, 0x9A, 0xD6,
+    0x5E, 0x83, 0x1E, 0xB7, 0x17, 0xC2, 0xF3, 0x79, 0x1B, 0x47, 0x11, 0x50, 0x0C, 0x14, 0x42, 0xED,
+    0xB7, 0x41, 0x33, 0x20, 0x78, 0x15, 0x79, 0x3B, 0xA9, 0xA2, 0xBE, 0xE7, 0xE9, 0x16, 0x30, 0x53,
+    0x9D, 0xF4, 0x71, 0x88, 0xC4, 0xCC, 0xF4, 0x4D, 0xD7, 0x09, 0x96, 0x6C, 0x1A, 0x90, 0x8D, 0xA8,
+    0x73, 0x10, 0x00, 0x05, 0x55, 0x58, 0x2C, 0x03, 0x55, 0x47, 0x9A, 0x09, 0xC3, 0x25, 0x01, 0x48,
+    0xC6, 0xED, 0x99, 0x63, 0x36, 0x9B, 0xA9, 0xB1, 0x7D, 0xB5, 0x73, 0xFB, 0x3B, 0xC1, 0x19, 0xC8,
+    0xAF, 0x56, 0xDB, 0xC8, 0x8C, 0x79, 0x47, 0x4C, 0x71, 0x8A, 0x14, 0xAC, 0x98, 0x05, 0x23, 0x00,
+    0xD2, 0xCD, 0xA4, 0x6D, 0x11, 0x8E, 0x5D, 0x5A, 0x91, 0x5B, 0x76, 0x04, 0xA5, 0x2F, 0xF9, 0xA4,
+    0xA4, 0x3A, 0x2E, 0xEF, 0xD7, 0xD9, 0x16, 0xBF, 0x11, 0xC6, 0x41, 0x5A, 0x1C, 0x00, 0x9D, 0x05,
+    0xA6, 0xB1, 0xDD, 0x7E, 0x66, 0xA9, 0xD3, 0xD6, 0xAE, 0x53, 0x77, 0x04, 0xC7, 0x32, 0xE7, 0x4C,
+    0x54, 0x50, 0xA2, 0xD1, 0xA1, 0xA3, 0x77, 0x47, 0xAB, 0x2C, 0x2C, 0x5C, 0x2C, 0x83, 0x6A, 0x21,
+    0x63, 0xBA, 0x18, 0xDC, 0x81, 0x1B, 0xE3, 0xD6, 0x9A, 0x2E, 0x41, 0x6D, 0xAD, 0x30, 0x9F, 0x42,
+    0xBB, 0x14, 0xBB, 0x31, 0x00, 0x09, 0x05, 0x5D, 0x6F, 0x9C, 0xB9, 0xCD, 0x2D, 0xD0, 0x3A, 0xF4,
+    0x81, 0xC7, 0xB9, 0x09, 0xC9, 0xB7, 0xF1, 0x6F, 0x9B, 0xB4, 0xD0, 0x0F, 0xE3, 0xBD, 0xC6, 0xB5,
+    0xC8, 0x5F, 0x42, 0x72, 0x21, 0x7E, 0xB7, 0x89, 0x8A, 0xE8, 0x46, 0x67, 0x72, 0x5F, 0x5C, 0x17,
+    0xCD, 0x81, 0xDE, 0xB2, 0x79, 0xA2, 0x67, 0x92, 0x83, 0xA7, 0x21, 0xEC, 0x8A, 0xB0, 0x4A, 0x33,
+    0x1F, 0x06, 0xC8, 0xA4, 0x6B, 0x21, 0xF2, 0xD0, 0x61, 0x5D, 0x59, 0xC0, 0xDF, 0x3C, 0xC7, 0x6B,
+    0x41, 0xC5, 0xB5, 0x8F, 0x0A, 0x9D, 0x05, 0xD5, 0xB1, 0x04, 0xC6, 0x8F, 0x08, 0x8A, 0x3B, 0x00,
+    0x2C, 0xDB, 0x00, 0xF6, 0xAD, 0x03, 0x38, 0x67, 0x9E, 0xC1, 0x74, 0x6A, 0x11, 0x53, 0x0B, 0x80,
+    0x60, 0xCD, 0xD3, 0x3F, 0x68, 0x3E, 0x07, 0x51, 0x0F, 0xD7, 0xEE, 0x69, 0xAA, 0xC1, 0xAD, 0x70,
+    0x56, 0xCD, 0xD4, 0x4C, 0xFC, 0xB7, 0x6F, 0x85, 0xB6, 0xFD, 0x9C, 0x55, 0xFC, 0xED, 0xEE, 0xE2,
+    0x57, 0x9A, 0x29, 0x97, 0x31, 0xC9, 0x30, 0xB8, 0x09, 0xAF, 0x6E, 0x3C, 0x73, 0x56, 0xB1, 0x13,
+    0x02, 0x42, 0xAC, 0x66, 0x6D, 0x88, 0xBB, 0x80, 0x01, 0xCE, 0x41, 0xCC, 0x38, 0xBD, 0x18, 0xA1,
+    0xDF, 0x6A, 0xDA, 0xDE, 0x7A, 0xD8, 0xC0, 0x63, 0x07, 0xC1, 0x0C, 0xE0, 0xBE, 0x05, 0x32, 0x27,
+    0x88, 0xE0, 0xA5, 0x00, 0x35, 0x40, 0x4F, 0xB6, 0xB8, 0xE0, 0x74, 0xBC, 0x4A, 0xE4, 0xB6, 0xC3,
+    0x05, 0x33, 0x27, 0xCA, 0xC2, 0xE2, 0xEC, 0x92, 0xA2, 0xC1, 0x8B, 0xA5, 0xB7, 0x0D, 0xDE, 0x8A,
+    0xA7, 0xF0, 0x36, 0x60, 0x09, 0xC5, 0xC0, 0x42, 0xDC, 0xF0, 0x3B, 0xF8, 0x71, 0xE8, 0x56, 0x84,
+    0x6E, 0x1D, 0x60, 0x38, 0xD8, 0x76, 0x96, 0x2E, 0x81, 0x80, 0x33, 0xB5, 0x26, 0xCE, 0xA1, 0x09,
+    0x94, 0xA1, 0xA6, 0x1E, 0x87, 0x1B, 0x6B, 0x06, 0x69, 0x1B, 0x5E, 0x42, 0xFF, 0x71, 0x57, 0x47,
+    0x3D, 0xDD, 0xF9, 0x75, 0x54, 0x74, 0x22, 0xEA, 0x9E, 0x2A, 0x40, 0xA7, 0x66, 0x44, 0xE7, 0x81,
+    0x3A, 0x2A, 0x32, 0x5C, 0x0D, 0x4B, 0x38, 0xB3, 0x22, 0xA1, 0x0D, 0x85, 0x42, 0xEF, 0x7E, 0x82,
+    0x3D, 0x33, 0x9C, 0x2E, 0x40, 0x00, 0x45, 0x88, 0x81, 0x46, 0x39, 0xA0, 0x08, 0x8B, 0xE0, 0xBA,
+    0x2E, 0x78, 0x1E, 0x2F, 0x29, 0x38, 0x4E, 0x0F, 0xC3, 0x44, 0x1B, 0x72, 0x2D, 0xCD, 0x43, 0x31,
+    0x7E, 0xBC, 0x46, 0x02, 0x1D, 0xA0, 0x13, 0xCE, 0xFF, 0xE0, 0x71, 0xEE, 0x5D, 0x2B, 0xBA, 0xD9,
+    0x69, 0xE5, 0x7F, 0x56, 0x2B, 0xFF, 0xF3, 0x46, 0xFE, 0xBE, 0xDB, 0xF6, 0x48, 0x12, 0x4F, 0x5D,
+    0xE5, 0x2A, 0x54, 0x02, 0xFC, 0x9B, 0xE7, 0x82, 0xCF, 0x21, 0x56, 0xAF, 0xC8, 0x98, 0xAB, 0x00,
+    0xD6, 0x90, 0x95, 0x30, 0x3D, 0x94, 0x3B, 0x83, 0x52, 0x03, 0xD0, 0x85, 0x32, 0x84, 0x02, 0x1C,
+    0x6B, 0x2D, 0xEA, 0x82, 0x72, 0x1D, 0x7D, 0xB6, 0xEA, 0xE5, 0x8E, 0x2D, 0x91, 0x85, 0x18, 0x2D,
+    0x0E, 0xE9, 0xC4, 0x86, 0xB6, 0x72, 0x7E, 0xA6, 0x70, 0xAF, 0x28, 0xBE, 0xE2, 0x6E, 0x21, 0x46,
+    0x57, 0x3B, 0xD8, 0x3A, 0x30, 0x48, 0xCA, 0x4E, 0x25, 0x14, 0x39, 0x97, 0x40, 0x11, 0xB0, 0x9C,
+    0xE0, 0x09, 0x57, 0x90, 0x1A, 0x89, 0x37, 0xEF, 0xCE, 0x63, 0xD1, 0x4B, 0x2D, 0x81, 0xA9, 0x28,
+    0xA1, 0x6D, 0x75, 0x84, 0xF6, 0x14, 0xAC, 0xA8, 0x5B, 0xFD, 0x3E, 0xF8, 0xFC, 0x8B, 0xBF, 0x79,
+    0xE1, 0x37, 0x7F, 0xFF, 0x43, 0x50, 0xFE, 0xE9, 0x5D, 0x32, 0x0A, 0x4A, 0x5D, 0x70, 0xA8, 0x75,
+    0xFF, 0x51, 0x28, 0x6F, 0x57, 0x3E, 0x75, 0xDB, 0xB4, 0x49, 0x31, 0x1C, 0xDA, 0x58, 0x4C, 0x83,
+    0x90, 0x4D, 0x27, 0x16, 0xD7, 0xA1, 0xE0, 0xE0, 0x0F, 0x89, 0x82, 0xB2, 0xC6, 0x0A, 0x11, 0x9B,
+    0x0C, 0xF8, 0x2A, 0xAC, 0x4D, 0x58, 0x5B, 0x90, 0xF5, 0xC0, 0x21, 0x28, 0x36, 0x28, 0x61, 0xFD,
+    0x56, 0x14, 0x49, 0xB2, 0x46, 0x8A, 0x4A, 0xB0, 0xEE, 0xC9, 0x15, 0x86, 0x86, 0xB0, 0x8A, 0xDE,
+    0x11, 0xD3, 0x4E, 0xDB, 0x10, 0x61, 0x61, 0xDD, 0xCA, 0x4E, 0xCE, 0x1B, 0xC1, 0x7A, 0xF1, 0xB7,
+    0xB1, 0xB8, 0x11, 0x5C, 0xEE, 0x33, 0x9D, 0x2C, 0x05, 0xFB, 0xA3, 0x6C, 0x0C, 0xF6, 0xEF, 0xD5,
+    0xD0, 0x91, 0x2C, 0x17, 0x06, 0xEF, 0x50, 0x42, 0xA4, 0x0B, 0x3E, 0xDB, 0xAB, 0xC1, 0x25, 0xC1,
+    0xFC, 0x26, 0xC8, 0x55, 0xB7, 0xCE, 0xC8, 0x6E, 0x22, 0x8D, 0xAB, 0xFD, 0xD7, 0xB6, 0x5C, 0xA7,
+    0x3B, 0x35, 0x4F, 0x46, 0x93, 0x46, 0x2C, 0x84, 0x25, 0x2B, 0xE0, 0x69, 0xC6, 0x4B, 0xC3, 0xD2,
+    0x6D, 0xD2, 0x0C, 0xB8, 0x4D, 0xA1, 0x10, 0xF1, 0x77, 0x4E, 0x0C, 0x37, 0xB4, 0x9A, 0x2C, 0x30,
+    0x3D, 0x9A, 0x22, 0xAC, 0x49, 0x65, 0xB1, 0x04, 0x80, 0x81, 0x31, 0x8A, 0xB4, 0xC5, 0x48, 0xEA,
+    0x4D, 0x88, 0xC0, 0x49, 0xD3, 0x18, 0x8C, 0xA6, 0x6D, 0x52, 0x4E, 0x7A, 0x1D, 0x33, 0x50, 0x38,
+    0x0F, 0xE9, 0xB6, 0x56, 0x4C, 0x02, 0x84, 0x25, 0xE6, 0x1D, 0x4A, 0x12, 0xEA, 0x96, 0x6A, 0x31,
+    0x12, 0xE5, 0xD8, 0x7B, 0x19, 0xBD, 0x82, 0xA5, 0x4A, 0x8E, 0x13, 0xFC, 0x55, 0xA6, 0x2A, 0x28,
+    0xD2, 0x4A, 0xD3, 0x5F, 0xAB, 0x5A, 0xE5, 0xFD, 0xF1, 0xC6, 0xD5, 0x46, 0x4D, 0x6E, 0x7C, 0xCD,
+    0x38, 0x2F, 0xE4, 0x3D, 0x95, 0x79, 0x9E, 0x72, 0x46, 0x38, 0xDD, 0x54, 0xBF, 0x24, 0x87, 0x73,
+    0xDD, 0xD9, 0x3E, 0x9A, 0xDF, 0xA9, 0x27, 0xDA, 0x13, 0x72, 0x6E, 0x62, 0xBA, 0xA4, 0x37, 0x62,
+    0xE1, 0x95, 0x79, 0x2D, 0xBC, 0x31, 0x78, 0x68, 0x90, 0xE9, 0x72, 0xC4, 0xFF, 0xD6, 0xBF, 0xAB,
+    0x78, 0x9F, 0x73, 0xC2, 0xB6, 0x63, 0xDB, 0x3A, 0xD3, 0x6B, 0xAE, 0x76, 0x3C, 0x37, 0x69, 0xA7,
+    0xC2, 0x69, 0x8B, 0xB6, 0xFA, 0x76, 0xBA, 0x73, 0x6C, 0xA7, 0x9E, 0x98, 0x21, 0x3B, 0xA9, 0x95,
+    0xA3, 0xAF, 0x29, 0x09, 0x17, 0xD2, 0xF0, 0x13, 0x53, 0x12, 0xB2, 0x5F, 0x19, 0x57, 0x14, 0x90,
+    0xC4, 0x25, 0xE9, 0x87, 0xDA, 0xA4, 0x5A, 0xB5, 0x15, 0x3F, 0x79, 0x6D, 0x0A, 0x3E, 0xF1, 0xEA,
+    0xC5, 0x9D, 0xF6, 0x29, 0x78, 0xD1, 0xAB, 0x83, 0xE7, 0x2B, 0xA6, 0x2D, 0xA5, 0x70, 0xD7, 0xF3,
+    0xEC, 0xB1, 0xC4, 0x85, 0x6F, 0x92, 0x45, 0xA0, 0xC5, 0x0C, 0xFC, 0x46, 0x5B, 0x33, 0x89, 0x4F,
+    0x31, 0xBE, 0xF0, 0x09, 0x7A, 0x1D, 0x73, 0xD9, 0x2D, 0x92, 0x7F, 0x5F, 0x42, 0xB3, 0xF1, 0xA9,
+    0x4E, 0x1D, 0xC2, 0x7D, 0x97, 0xF1, 0x44, 0xCC, 0xC7, 0xFC, 0xC1, 0xF1, 0xF5, 0xD8, 0xA8, 0x6F,
+    0x24, 0x88, 0x0F, 0x49, 0x17, 0x7D, 0x4A, 0xEF, 0xFD, 0x71, 0xFA, 0x49, 0x3E, 0x74, 0xD2, 0x26,
+    0xD3, 0x5F, 0xDD, 0xB9, 0x39, 0x16, 0x82, 0x06, 0x15, 0xC5, 0xC0, 0xE4, 0x9B, 0x16, 0x66, 0xD5,
+    0x1F, 0x1B, 0x2C, 0xD7, 0xE7, 0x4D, 0xAC, 0xC2, 0x77, 0x1B, 0xF4, 0x04, 0xF6, 0x5B, 0x8E, 0x17,
+    0x41, 0x95, 0xC1, 0xC4, 0x2B, 0xC5, 0xB0, 0x53, 0x47, 0xA0, 0x70, 0x22, 0x0C, 0x2C, 0xC6, 0xFB,
+    0x37, 0x37, 0x95, 0xC2, 0xCD, 0x4E, 0x1D, 0x25, 0x93, 0x4E, 0xE7, 0xD4, 0x9B, 0x8C, 0x56, 0x06,
+    0x1F, 0x7C, 0x51, 0x45, 0x1F, 0x7C, 0x51, 0xC7, 0x8F, 0x7D, 0xD6, 0xA4, 0x7E, 0xD9, 0x1A, 0xBF,
+    0x34, 0x98, 0x4E, 0xB2, 0x30, 0x5E, 0x96, 0x8F, 0xD8, 0xFF, 0x8A, 0xC1, 0x80, 0xE0, 0x3D, 0x4C,
+    0x98, 0x0A, 0xDF, 0x63, 0xA0, 0x26, 0x3E, 0x2E, 0x21, 0x8A, 0xD9, 0x20, 0x96, 0x6C, 0x6E, 0xD7,
+    0x9C, 0x6C, 0x0D, 0xC8, 0xDF, 0xAD, 0x37, 0xA3, 0xCC, 0x4C, 0xE6, 0x9B, 0x61, 0x6E, 0xBC, 0x6A,
+    0x33, 0x28, 0x4C, 0x50, 0x6E, 0x42, 0x7B, 0x07, 0x05, 0xC6, 0x63, 0xA2, 0x7C, 0x73, 0x52, 0x9B,
+    0x38, 0xDB, 0x74, 0x9B, 0x63, 0xCA, 0x9D, 0x51, 0xDB, 0x4E, 0x98, 0x68, 0xC2, 0x2C, 0x64, 0xC0,
+    0xC1, 0x45, 0xE8, 0x09, 0x15, 0xBE, 0x5A, 0xAA, 0xF8, 0xF5, 0xF4, 0xD1, 0x4A, 0xA6, 0x73, 0x2E,
+    0x18, 0x36, 0xC3, 0x49, 0x46, 0xBB, 0x63, 0xB7, 0x69, 0x36, 0x55, 0x3C, 0x99, 0x37, 0xA9, 0x8A,
+    0xBD, 0xAA, 0x89, 0x93, 0x38, 0x28, 0x39, 0x01, 0x41, 0xD1, 0x04, 0x05, 0x2D, 0x58, 0xCA, 0x5A,
+    0x49, 0x7E, 0x53, 0xD7, 0x43, 0xB9, 0x8A, 0x9C, 0xB4, 0x2B, 0x11, 0x7C, 0x59, 0x71, 0xBE, 0xCB,
+    0x3E, 0x22, 0xC4, 0x65, 0x9A, 0x74, 0x46, 0x33, 0xEE, 0x15, 0xD1, 0xC2, 0xA0, 0x9F, 0x6C, 0x7C,
+    0x18, 0x06, 0x86, 0x9E, 0x91, 0x21, 0x33, 0x62, 0x3A, 0x31, 0x28, 0xA7, 0x3D, 0x32, 0x9B, 0xBD,
+    0x09, 0x52, 0xA0, 0x98, 0x2F, 0x3D, 0x78, 0x4C, 0x0E, 0xDE, 0xAF, 0x36, 0x5B, 0x31, 0xCD, 0xB0,
+    0x34, 0x19, 0x4D, 0x8E, 0xE0, 0xE2, 0x27, 0x55, 0xF4, 0xDA, 0x47, 0x55, 0x1C, 0xFC, 0x76, 0x1E,
+    0x07, 0x1F, 0x36, 0x18, 0x7C, 0xA3, 0x27, 0x12, 0xD9, 0x34, 0xFD, 0xC1, 0xB5, 0x94, 0xA7, 0xCC,
+    0x74, 0x5D, 0xB2, 0x6D, 0x50, 0x5C, 0x9C, 0xDC, 0x42, 0xFC, 0x0D, 0xEF, 0x9B, 0xC6, 0xD2, 0xE9,
+    0xBC, 0xCF, 0x01, 0xF7, 0x07, 0xAC, 0xC2, 0xD4, 0x50, 0xB6, 0x1B, 0xB7, 0x8D, 0x5F, 0xAB, 0x48,
+    0xAC, 0xF1, 0x2B, 0x58, 0x08, 0x6F, 0x4E, 0xE7, 0x19, 0x1D, 0xE6, 0xE0, 0x0C, 0x9D, 0x68, 0xB0,
+    0x51, 0x28, 0x24, 0x69, 0xC4, 0x1D, 0x57, 0xC7, 0x5C, 0x7A, 0x59, 0x31, 0x27, 0x03, 0x33, 0x27,
+    0xB3, 0x08, 0x4E, 0xC2, 0x8C, 0x82, 0xCC, 0x38, 0xC7, 0xEB, 0x57, 0x32, 0x99, 0x5D, 0x89, 0x7A,
+    0xA1, 0x63, 0xF1, 0xC9, 0x8E, 0xF7, 0x4C, 0xAE, 0x36, 0xC4, 0x5F, 0x73, 0xA6, 0xBD, 0xCF, 0x40,
+    0x3B, 0x1C, 0x0D, 0xF1, 0x3B, 0x4D, 0x94, 0x39, 0xC9, 0x2A, 0x14, 0x1D, 0xCC, 0x84, 0xF6, 0x02,
+    0x16, 0x8E, 0xD4, 0x79, 0x8D, 0x4C, 0x42, 0xCB, 0xBB, 0x0C, 0x58, 0xDE, 0x20, 0x52, 0xD4, 0x97,
+    0x40, 0x13, 0x28, 0x37, 0x73, 0x44, 0x94, 0x60, 0x79, 0x1D, 0xBA, 0x06, 0xFE, 0x7C, 0x11, 0xC2,
+    0x0C, 0xE6, 0xCE, 0x39, 0x53, 0x85, 0xF2, 0x6C, 0xAB, 0xD2, 0x7F, 0xB3, 0x3A, 0x21, 0xBD, 0x7C,
+    0x56, 0x18, 0xD9, 0xA7, 0x00, 0xBD, 0xCF, 0x51, 0xAB, 0x49, 0x94, 0x78, 0xA5, 0x49, 0xDC, 0x1B,
+    0x73, 0x09, 0x4C, 0xC5, 0xD6, 0xB7, 0x49, 0xBE, 0x2B, 0xA1, 0x99, 0x38, 0x51, 0x27, 0x8D, 0x78,
+    0x1C, 0x62, 0x24, 0x3B, 0x3A, 0x1B, 0xAC, 0x7D, 0x67, 0x06, 0x1B, 0xB6, 0x0F, 0xA8, 0x68, 0x98,
+    0xCD, 0x9B, 0x14, 0x17, 0xB3, 0x37, 0x25, 0x86, 0x14, 0xD2, 0xA9, 0x38, 0x71, 0x40, 0x6D, 0xBA,
+    0xB5, 0x5F, 0x76, 0x40, 0xD5, 0x6E, 0x28, 0xA8, 0x34, 0x50, 0x99, 0xBE, 0x04, 0xCB, 0x34, 0xA6,
+    0xA3, 0x44, 0x0A, 0xA3, 0x41, 0x80, 0x97, 0xFE, 0x6D, 0x0B, 0xC6, 0x75, 0x29, 0x42, 0xB6, 0x21,
+    0x16, 0xAD, 0xEC, 0x84, 0x8E, 0x39, 0xCD, 0xC1, 0x2C, 0x3D, 0x0E, 0x4E, 0x25, 0xAA, 0x80, 0xFC,
+    0x11, 0x79, 0x16, 0xC5, 0x3D, 0xC2, 0xC2, 0x9E, 0xA2, 0x83, 0xF6, 0x61, 0x13, 0x95, 0xF4, 0xE6,
+    0xB6, 0x38, 0x68, 0xED, 0x2E, 0xEF, 0x18, 0x32, 0x13, 0x99, 0xCD, 0xA0, 0xF8, 0x92, 0xE2, 0x65,
+    0xB6, 0x8F, 0xC6, 0x1D, 0x49, 0x8E, 0xFE, 0x12, 0xDC, 0x72, 0x3D, 0x9B, 0xE9, 0x82, 0x65, 0x1A,
+    0x3D, 0x7A, 0x1D, 0x54, 0x29, 0x17, 0xE4, 0x16, 0x49, 0xDA, 0x84, 0x73, 0xC7, 0xD8, 0x06, 0xEC,
+    0x78, 0xD7, 0x87, 0x64, 0xCC, 0x16, 0xD7, 0xBF, 0xB0, 0xAE, 0x3F, 0x5D, 0x7D, 0x23, 0xF6, 0x22,
+    0x0D, 0x46, 0x38, 0x9E, 0xD2, 0x4A, 0x9A, 0xF1, 0x1E, 0xEB, 0xFA, 0x57, 0x43, 0x4C, 0x3F, 0x2C,
+    0xE8, 0x5C, 0x97, 0x24, 0x7F, 0x28, 0x74, 0x87, 0xA9, 0x8A, 0xC9, 0x22, 0x55, 0x51, 0x49, 0x79,
+    0x08, 0xAD, 0xAA, 0x92, 0x51, 0xFB, 0x1C, 0xA3, 0xE2, 0xA2, 0xB6, 0x58, 0x6D, 0xF8, 0xF2, 0xCA,
+    0x2A, 0x6F, 0xD1, 0xDE, 0x22, 0xE1, 0x98, 0x4D, 0xB1, 0x9A, 0x7A, 0xC6, 0xFC, 0x6B, 0xE2, 0x43,
+    0x2C, 0x06, 0x78, 0x22, 0xFA, 0xEF, 0xB0, 0x60, 0x88, 0x37, 0x4E, 0xE0, 0xEB, 0x2A, 0xAF, 0x02,
+    0xAB, 0x5E, 0x83, 0x65, 0xDB, 0x91, 0xCD, 0xE6, 0xD6, 0x55, 0x4D, 0xFB, 0x7C, 0x8D, 0x78, 0x5D,
+    0x1F, 0x91, 0x38, 0xBF, 0xA6, 0x23, 0x50, 0xBF, 0x80, 0xFF, 0x1F, 0x0C, 0x17, 0x99, 0x8E, 0x7B,
+    0xD4, 0x5F, 0xB1, 0xB8, 0x5F, 0x2B, 0x54, 0xF0, 0x3E, 0x9E, 0x86, 0xB7, 0xA0, 0xAA, 0xE7, 0x6D,
+    0x70, 0xE4, 0x6E, 0xC6, 0x21, 0x19, 0x99, 0x2E, 0xB1, 0xC5, 0x3B, 0xBD, 0x73, 0x69, 0xAC, 0xD1,
+    0x19, 0xCE, 0xC5, 0x3B, 0xC3, 0x8A, 0x39, 0xDD, 0xC1, 0xD3, 0x6A, 0x86, 0x47, 0x20, 0x38, 0x9C,
+    0x8E, 0x62, 0xD2, 0xAB, 0x29, 0xEB, 0x94, 0x7E, 0x04, 0x3A, 0x97, 0x83, 0x7D, 0x18, 0xB6, 0x07,
+    0x8F, 0x49, 0x07, 0xE2, 0x64, 0xB4, 0x03, 0x92, 0x9C, 0xF7, 0x25, 0x29, 0x7B, 0x43, 0xE9, 0x75,
+    0x3E, 0x47, 0x3B, 0x50, 0x91, 0x3A, 0x93, 0x76, 0x03, 0x63, 0xDF, 0x13, 0x88, 0xD3, 0x57, 0x49,
+    0x5D, 0x10, 0xAD, 0xB2, 0x21, 0x3B, 0x38, 0xE9, 0xED, 0x5E, 0xBF, 0x1F, 0x78, 0x68, 0xA9, 0xC1,
+    0xEB, 0xA3, 0xCF, 0x9E, 0x4D, 0x43, 0x4B, 0x09, 0x0C, 0xA8, 0x6B, 0xF5, 0x34, 0x6C, 0x18, 0x50,
+    0x98, 0x4D, 0x3B, 0x30, 0x80, 0xCE, 0xA4, 0x7C, 0xA1, 0x5F, 0x6A, 0x60, 0x86, 0xD0, 0xA2, 0x69,
+    0x25, 0x67, 0x1A, 0x15, 0x50, 0x36, 0x54, 0x4D, 0x45, 0xEA, 0x89, 0x8A, 0x2A, 0x28, 0xDA, 0x78,
+    0x3E, 0xBA, 0x58, 0xA0, 0xB3, 0x51, 0x0E, 0x43, 0x52, 0xF2, 0x8B, 0xB4, 0xE8, 0xA2, 0xEB, 0x26,
+    0xF1, 0x0C, 0xE7, 0x83, 0x62, 0x5B, 0x49, 0xA4, 0xD6, 0xED, 0x33, 0x5B, 0xEE, 0xB6, 0x6E, 0xF6,
+    0xEB, 0x33, 0xE9, 0xB5, 0xF5, 0xC4, 0xD8, 0xE9, 0x9D, 0xD8, 0xDB, 0x0F, 0x11, 0xD9, 0xC4, 0xFB,
+    0x86, 0x92, 0xE0, 0x34, 0xA5, 0x6C, 0x12, 0x74, 0x2D, 0xC4, 0x59, 0xB9, 0x16, 0x83, 0x4A, 0x14,
+    0x03, 0x24, 0x20, 0x0F, 0x4C, 0x62, 0xC0, 0x99, 0xF4, 0x47, 0x14, 0xCC, 0xE5, 0x82, 0xDC, 0x12,
+    0x97, 0x87, 0xE2, 0x32, 0x6C, 0x5B, 0xCB, 0xDE, 0xB0, 0x2E, 0xA8, 0x9A, 0x24, 0xB0, 0x69, 0x59,
+    0xF9, 0xE7, 0xFD, 0x8A, 0xFA, 0x60, 0xBC, 0xF5, 0x4B, 0x12, 0x9B, 0x86, 0x30, 0x28, 0xE2, 0x4F,
+    0x3F, 0xAD, 0xD2, 0x53, 0x5E, 0xAD, 0x97, 0x13, 0x9B, 0x84, 0xC4, 0xAB, 0xE3, 0x0F, 0x2E, 0xCE,
+    0x31, 0x63, 0x25, 0xE3, 0xE0, 0x0A, 0xF6, 0x91, 0x82, 0x89, 0xAC, 0x1C, 0x36, 0x32, 0xA4, 0xCF,
+    0x2D, 0x75, 0xF4, 0xC4, 0x31, 0x3F, 0x2A, 0x07, 0xAF, 0x5F, 0x8E, 0x7E, 0x75, 0xFA, 0x52, 0x1F,
+    0x3B, 0xF8, 0x55, 0xB9, 0x5F, 0x97, 0x2E, 0x1A, 0x9C, 0x30, 0x1E, 0x36, 0xC7, 0x14, 0xD6, 0x1E,
+    0xF9, 0xBF, 0xBA, 0xDF, 0x75, 0x3B, 0x4B, 0x7B, 0xC6, 0xA6, 0x65, 0xD2, 0x44, 0x0A, 0x8C, 0xA8,
+    0x80, 0xB6, 0x1E, 0xDC, 0x37, 0x99, 0xB0, 0x81, 0x7B, 0xC7, 0x43, 0x86, 0x03, 0x97, 0x11, 0x07,
+    0xAC, 0x52, 0xE1, 0x51, 0xD0, 0x84, 0x75, 0xD0, 0xC2, 0x28, 0xF2, 0xAD, 0xD3, 0x83, 0xA9, 0xD0,
+    0x94, 0x18, 0x69, 0x1B, 0x8C, 0x52, 0x07, 0xCB, 0x74, 0xCD, 0x12, 0xF4, 0x25, 0xCE, 0xFD, 0x15,
+    0x2E, 0x46, 0x78, 0xF8, 0x02, 0x4F, 0x6D, 0xCA, 0xE5, 0xD4, 0x92, 0x96, 0x60, 0xCB, 0x4B, 0xAC,
+    0xAE, 0x73, 0x74, 0xB2, 0x5E, 0xB2, 0x82, 0x01, 0x93, 0x1B, 0x51, 0xDF, 0xA8, 0xF8, 0x43, 0x75,
+    0x48, 0x67, 0x52, 0x4E, 0x91, 0x6B, 0x49, 0xCE, 0x19, 0x75, 0x58, 0x2A, 0x4E, 0x60, 0x52, 0x51,
+    0x72, 0xC1, 0x4E, 0xD6, 0xF4, 0x37, 0x41, 0x39, 0x3A, 0x97, 0xC0, 0x12, 0x97, 0xD7, 0xFC, 0x19,
+    0x94, 0xE3, 0x42, 0x56, 0xCE, 0xC7, 0xFE, 0xCC, 0x66, 0x99, 0x38, 0x86, 0x98, 0x01, 0xF7, 0x93,
+    0x4F, 0x38, 0xF2, 0xE3, 0xEE, 0x70, 0xF1, 0x2F, 0x69, 0xF1, 0xAB, 0x95, 0xE9, 0x54, 0xE8, 0x91,
+    0x56, 0x65, 0x70, 0xFE, 0xBF, 0x80, 0x57, 0xBE, 0xF3, 0x9D, 0xA1, 0x27, 0xF7, 0xC2, 0x1F, 0x58,
+    0x4E, 0x40, 0xB1, 0x04, 0x2D, 0x68, 0x9D, 0xB7, 0x98, 0x35, 0x1E, 0x12, 0xE0, 0xE9, 0x72, 0xF2,
+    0xBB, 0x4F, 0x80, 0xC7, 0x8B, 0x04, 0x38, 0xD7, 0xB9, 0x70, 0x99, 0xC8, 0x8A, 0x24, 0xED, 0xBB,
+    0x23, 0x38, 0xBA, 0x94, 0xB8, 0x42, 0x93, 0x16, 0xBF, 0xE8, 0xE3, 0x0A, 0xCB, 0xE1, 0x59, 0x5A,
+    0x2E, 0xB0, 0xF8, 0x2A, 0x87, 0x45, 0x07, 0x37, 0x7D, 0x14, 0x87, 0xFF, 0x63, 0xA5, 0x36, 0x1E,
+    0x54, 0xAA, 0x7E, 0xDB, 0xA6, 0xB4, 0x25, 0xF4, 0x01, 0x51, 0x13, 0xF8, 0xD9, 0x3F, 0xE1, 0x52,
+    0xFA, 0xBC, 0x15, 0x48, 0x34, 0xFD, 0x27, 0x9F, 0x16, 0xCA, 0x7F, 0x09, 0xBE, 0x1F, 0x9E, 0xFA,
+    0xEE, 0x52, 0x46, 0xCC, 0x2D, 0x53, 0x46, 0x2B, 0x8A, 0xE7, 0x24, 0x36, 0x03, 0xD3, 0x3F, 0xBD,
+    0x51, 0xFD, 0x52, 0x55, 0x0F, 0x80, 0xD8, 0x2E, 0xA8, 0x9F, 0xA9, 0x20, 0xE1, 0x4B, 0x34, 0x88,
+    0x2E, 0x54, 0xBF, 0x56, 0x52, 0x95, 0x95, 0x76, 0x1B, 0x9D, 0xA9, 0x6A, 0x76, 0x41, 0xFD, 0xDD,
+    0xA0, 0x45, 0xFA, 0x09, 0x2B, 0xDE, 0xB2, 0xC7, 0x44, 0x44, 0x08, 0xEB, 0x3B, 0x56, 0xC8, 0x3B,
+    0x99, 0xCC, 0x8B, 0xF3, 0x21, 0x46, 0xFD, 0xF6, 0xB3, 0xCA, 0x49, 0xD6, 0x86, 0x3B, 0x76, 0xFD,
+    0xB1, 0x32, 0xD4, 0x24, 0x3F, 0x65, 0xDF, 0xDC, 0xDF, 0xE5, 0xF7, 0x73, 0xC4, 0xAE, 0xCA, 0x6E,
+    0xFB, 0xE0, 0x8B, 0x7C, 0x18, 0xB7, 0x7D, 0x85, 0x5E, 0xFD, 0xB2, 0x52, 0x6E, 0x06, 0xC9, 0xB0,
+    0xF1, 0x0F, 0xCB, 0x77, 0x44, 0x56, 0x1C, 0x0F, 0x35, 0x94, 0x2A, 0x7F, 0x76, 0x6B, 0x0B, 0x2B,
+    0xF6, 0xF0, 0x3D, 0x7B, 0xF8, 0x91, 0x3D, 0x3C, 0x48, 0xF4, 0xAC, 0xE5, 0xBC, 0xE7, 0xD4, 0x2F,
+    0x94, 0x97, 0xC8, 0x29, 0x2D, 0x2C, 0xE9, 0x32, 0xE2, 0x84, 0xFF, 0x76, 0xEF, 0x9D, 0xC8, 0x26,
+    0xAF, 0xE0, 0xF2, 0xC3, 0x43, 0x72, 0x44, 0x62, 0x1D, 0xD9, 0xF5, 0x09, 0xB2, 0xDB, 0x5B, 0x76,
+    0x38, 0x73, 0x2B, 0x07, 0x9E, 0x57, 0x4E, 0x89, 0x35, 0xF9, 0x91, 0xED, 0xD2, 0xF7, 0xC6, 0x9E,
+    0x29, 0xF5, 0x4F, 0xF6, 0xF0, 0xAC, 0xC4, 0x57, 0xDD, 0xD3, 0x14, 0x7B, 0x5C, 0xA5, 0x49, 0xBB,
+    0x4E, 0x89, 0x6B, 0x93, 0xCD, 0x47, 0xCE, 0x8C, 0x4D, 0x6F, 0x8A, 0x47, 0xD4, 0x89, 0x97, 0x42,
+    0xC1, 0x44, 0x1C, 0x08, 0x8E, 0x05, 0xA7, 0x29, 0xB1, 0x81, 0xA2, 0xEF, 0xC0, 0xD5, 0x09, 0xC3,
+    0x21, 0xC4, 0xE0, 0x60, 0x60, 0xF2, 0x14, 0x8B, 0x2C, 0x88, 0x19, 0xEB, 0xA3, 0x89, 0x4A, 0x0C,
+    0xE3, 0x7A, 0xAA, 0xC4, 0xB1, 0x51, 0x62, 0xD0, 0xB2, 0x52, 0x34, 0xB6, 0x0E, 0xA6, 0x28, 0x17,
+    0x2B, 0xF8, 0xAD, 0xDA, 0xB4, 0xDA, 0x68, 0x50, 0x99, 0x6A, 0x35, 0x73, 0x61, 0x77, 0x95, 0xE8,
+    0xB2, 0x77, 0x0D, 0x2E, 0x84, 0x2B, 0x1D, 0x5E, 0xAF, 0x47, 0xE7, 0x74, 0xF5, 0x8C, 0xA2, 0xCD,
+    0x40, 0xCF, 0x82, 0x28, 0x25, 0xE2, 0xFB, 0x5E, 0x6E, 0x81, 0x5E, 0x01, 0x2F, 0xC7, 0x8F, 0x7F,
+    0x0E, 0x94, 0xBE, 0xCB, 0x20, 0xEC, 0xC3, 0x40, 0xE8, 0x36, 0x6C, 0x12, 0xB7, 0x7B, 0x33, 0x86,
+    0x81, 0x38, 0x8F, 0x4B, 0x6B, 0xA3, 0x4D, 0x88, 0x3C, 0xCA, 0x7E, 0x56, 0x4A, 0x5A, 0x14, 0xE6,
+    0x7E, 0x9F, 0x41, 0x4E, 0xA5, 0x66, 0xC5, 0x42, 0xD0, 0x9F, 0x0B, 0xE0, 0x06, 0x04, 0x36, 0xF8,
+    0x0E, 0x53, 0x28, 0x9C, 0xF7, 0xB9, 0xC8, 0xC6, 0x1E, 0xC3, 0x79, 0x60, 0x3D, 0xB3, 0x5C, 0xEE,
+    0x2B, 0x97, 0xE3, 0x99, 0x73, 0x81, 0xE1, 0xDC, 0x16, 0x60, 0xEC, 0xCA, 0x3A, 0x57, 0x8C, 0xA6,
+    0x2D, 0x62, 0x53, 0xD7, 0x75, 0x25, 0x0E, 0x97, 0xE9, 0xFA, 0xCA, 0xC2, 0x9B, 0x8A, 0x79, 0x32,
+    0xF3, 0x3D, 0x40, 0x64, 0x12, 0xB3, 0x6E, 0x16, 0x91, 0x71, 0xBA, 0xAC, 0xEA, 0x27, 0x3B, 0xE6,
+    0xDE, 0x8F, 0xC1, 0xEC, 0x88, 0xD7, 0x25, 0x86, 0x90, 0x41, 0x0A, 0xE6, 0x22, 0x11, 0x69, 0x73,
+    0x65, 0x3D, 0xBC, 0xFB, 0x69, 0x19, 0xBF, 0x0F, 0xBD, 0xFB, 0xB9, 0xB8, 0x3A, 0xB9, 0xE4, 0x6A,
+    0xDF, 0x60, 0x5E, 0x37, 0x80, 0x45, 0xED, 0x58, 0x67, 0x64, 0x09, 0x28, 0x71, 0xA9, 0x8C, 0xF8,
+    0x59, 0x54, 0x42, 0x4F, 0xA7, 0xDF, 0xA6, 0x96, 0xFB, 0x04, 0x29, 0x41, 0x3E, 0xC7, 0xCE, 0x35,
+    0xB1, 0x91, 0x4F, 0xA6, 0x76, 0xFF, 0xF8, 0x7D, 0xFC, 0x5B, 0xE0, 0xEA, 0x34, 0x19, 0xD7, 0x87,
+    0x0E, 0xD9, 0xD5, 0x13, 0x58, 0xB3, 0x46, 0x60, 0xFD, 0xFA, 0x19, 0xB5, 0x7C, 0x6D, 0x3B, 0x1C,
+    0x9C, 0x9D, 0x85, 0x26, 0xE1, 0xE7, 0x0F, 0x53, 0x08, 0xB4, 0x90, 0xB5, 0x81, 0x85, 0xA4, 0x00,
+    0x0A, 0xFB, 0xEF, 0xF8, 0xD1, 0x7D, 0xF4, 0x46, 0x60, 0x7B, 0x8D, 0xA8, 0x58, 0x19, 0x97, 0x86,
+    0x1A, 0xD2, 0xDC, 0xFC, 0xBB, 0x61, 0xBD, 0xDD, 0x1C, 0xCE, 0x6E, 0x6F, 0xB5, 0xB8, 0x23, 0x58,
+    0x8A, 0xF7, 0x6B, 0xB5, 0x16, 0x55, 0x3D, 0x79, 0xC1, 0x03, 0x69, 0xFB, 0x4C, 0xFA, 0x19, 0x71,
+    0xDC, 0x04, 0x3E, 0x3E, 0xB1, 0x98, 0x69, 0x86, 0x0D, 0x86, 0x6C, 0xFA, 0xEF, 0xB8, 0x1A, 0x69,
+    0xAF, 0xD1, 0x42, 0x01, 0x5B, 0x74, 0x03, 0x9D, 0x93, 0x30, 0xB5, 0xC7, 0x79, 0x6D, 0x69, 0xC6,
+    0xF4, 0xBA, 0x39, 0x28, 0xC0, 0x5D, 0x30, 0x10, 0x4B, 0x9F, 0xF5, 0x0A, 0x41, 0x19, 0x70, 0xBB,
+    0x41, 0x50, 0x4A, 0xA4, 0x2B, 0x28, 0x25, 0x06, 0x1B, 0x7C, 0x26, 0x46, 0xFB, 0xE3, 0x5F, 0x48,
+    0x4D, 0xD1, 0xC5, 0xAF, 0x2A, 0x6B, 0x4C, 0x0B, 0x53, 0x5C, 0xB9, 0xC2, 0x86, 0xE2, 0x8B, 0x5F,
+    0x92, 0x39, 0xB5, 0xDC, 0xE2, 0x40, 0x57, 0x4B, 0x79, 0x08, 0x4C, 0x65, 0xDA, 0x7A, 0x68, 0xEC,
+    0x63, 0x98, 0x00, 0x68, 0x9A, 0x31, 0x4B, 0xD0, 0xAE, 0x81, 0x51, 0x01, 0x75, 0xDE, 0xDB, 0x92,
+    0xE1, 0xED, 0x0F, 0x2C, 0xF0, 0x3D, 0x78, 0x7A, 0xF5, 0x4D, 0x36, 0x56, 0x85, 0x52, 0xBE, 0x45,
+    0xBB, 0x91, 0x22, 0x46, 0xD4, 0xEA, 0xE3, 0x5F, 0x4B, 0xD9, 0xEF, 0xC5, 0x3F, 0xD5, 0xB6, 0x67,
+    0xD5, 0xE2, 0x10, 0x5F, 0xFC, 0x53, 0x23, 0x3D, 0xFB, 0xBA, 0x93, 0x9E, 0xF1, 0x01, 0x79, 0x9C,
+    0x69, 0x39, 0xFC, 0xB2, 0xE4, 0x06, 0xCE, 0x4B, 0x5F, 0xCA, 0x96, 0xDE, 0xF6, 0xB0, 0x6F, 0x05,
+    0xA2, 0x0F, 0xF4, 0xA1, 0x5F, 0x1F, 0xE3, 0x78, 0x2A, 0xB7, 0xBA, 0xEF, 0x45, 0x56, 0x5F, 0xDC,
+    0x71, 0xD2, 0xFF, 0x01, 0x69, 0x00, 0xCF, 0xE3, 0x71, 0x3C, 0x7D, 0x41, 0xEA, 0xCF, 0xA5, 0x86,
+    0x48, 0xCA, 0xF1, 0xA5, 0x42, 0xD3, 0x06, 0xF5, 0x58, 0xC9, 0xC9, 0xA8, 0x48, 0x5F, 0x25, 0x26,
+    0xA5, 0xFF, 0x86, 0x51, 0x02, 0xC3, 0x3D, 0x0F, 0x86, 0xA4, 0x2E, 0x21, 0x40, 0x43, 0x37, 0x80,
+    0x81, 0x19, 0x36, 0xC0, 0x30, 0x22, 0x65, 0x87, 0x8D, 0xCB, 0xDD, 0x54, 0x39, 0x3F, 0x22, 0x4A,
+    0xDC, 0x23, 0x1B, 0xB6, 0x84, 0x03, 0xE2, 0xE0, 0xA5, 0x16, 0x32, 0x16, 0xC4, 0xF8, 0x06, 0x84,
+    0x3A, 0x37, 0x49, 0x10, 0xDE, 0xA8, 0xEC, 0xB9, 0x97, 0x24, 0x37, 0xDD, 0x50, 0x2E, 0x83, 0x30,
+    0x1B, 0x2B, 0xE4, 0x97, 0x41, 0x35, 0x62, 0x74, 0xB1, 0x58, 0xE6, 0x47, 0x3A, 0x33, 0x3F, 0x66,
+    0x10, 0x07, 0xE2, 0x2A, 0x82, 0x78, 0x8C, 0x4A, 0xE9, 0xBC, 0xD0, 0x2F, 0xE9, 0x98, 0x65, 0x92,
+    0xE0, 0x11, 0x13, 0x41, 0xA4, 0x45, 0x60, 0x3A, 0xDE, 0xFB, 0x7D, 0x96, 0x0A, 0x45, 0x2C, 0x48,
+    0x9D, 0x4B, 0x9F, 0xFE, 0x05, 0x7D, 0xFA, 0x15, 0x5A, 0x7B, 0x0D, 0x7D, 0x7A, 0x6D, 0x87, 0x3E,
+    0xF1, 0xDC, 0x6B, 0xE8, 0xD3, 0xAF, 0xC0, 0x34, 0xFF, 0xCA, 0xFE, 0x87, 0x95, 0x54, 0x0B, 0xC2,
+    0x20, 0x47, 0xAB, 0x2C, 0x14, 0xC7, 0x4C, 0xE3, 0x3D, 0x8D, 0x54, 0x67, 0xD2, 0xD2, 0x7C, 0x57,
+    0x8A, 0xA8, 0x18, 0x54, 0x24, 0x75, 0xD9, 0xBF, 0x3E, 0x61, 0x7C, 0xF3, 0x1D, 0x5E, 0xCD, 0x4D,
+    0x1F, 0x33, 0x88, 0x73, 0x50, 0x29, 0x68, 0xBD, 0x1E, 0xEA, 0xA6, 0x5D, 0x33, 0x0A, 0x15, 0x23,
+    0x14, 0x54, 0x40, 0xF0, 0xC3, 0xFE, 0xAA, 0xDC, 0x33, 0x36, 0x29, 0x43, 0x2A, 0xD4, 0x59, 0x00,
+    0x2A, 0x0D, 0xFE, 0xC4, 0x82, 0xF4, 0x4A, 0x89, 0x7F, 0xC1, 0xBF, 0xBF, 0xE6, 0xB3, 0xCC, 0x1D,
+    0x47, 0x25, 0xEE, 0xA4, 0x52, 0x69, 0x40, 0x7C, 0xE0, 0x31, 0x29, 0x87, 0xA2, 0xAC, 0x9F, 0xB2,
+    0x64, 0xB7, 0x5F, 0x6A, 0x79, 0x05, 0xED, 0x06, 0x43, 0x4B, 0xD3, 0x2E, 0x35, 0x17, 0xD0, 0xAE,
+    0xBC, 0xD0, 0x80, 0x50, 0x83, 0xDC, 0xEC, 0x88, 0x94, 0xD5, 0xB6, 0xA8, 0x90, 0x41, 0xB8, 0x6A,
+    0x36, 0xC3, 0x72, 0x4A, 0xB8, 0xD7, 0x18, 0x8A, 0x23, 0x4D, 0x53, 0x51, 0x53, 0xF7, 0x69, 0xA9,
+    0xA5, 0x17, 0xAA, 0x16, 0x24, 0xF5, 0x86, 0xD4, 0x50, 0xF6, 0x16, 0x92, 0x8E, 0x44, 0x19, 0x6D,
+    0x36, 0xFA, 0xF6, 0xC5, 0x84, 0x7D, 0x4A, 0x67, 0x40, 0xD3, 0x27, 0x76, 0xBA, 0xAF, 0x5D, 0xA3,
+    0x1F, 0x5D, 0x2F, 0xD0, 0x60, 0x0D, 0xEC, 0x84, 0x48, 0x89, 0x07, 0x37, 0xA8, 0xFB, 0xCB, 0x9B,
+    0xD0, 0xC7, 0x4F, 0xD1, 0xC8, 0x30, 0x03, 0x92, 0x7F, 0x97, 0x6F, 0xB9, 0x0E, 0x05, 0x46, 0xF9,
+    0x44, 0x34, 0x08, 0x9E, 0x9B, 0x90, 0x1E, 0xBA, 0xD1, 0x0C, 0xA8, 0x3D, 0xB1, 0xA7, 0x61, 0xDD,
+    0x84, 0xD0, 0xF1, 0xD9, 0x69, 0xBE, 0xBC, 0x1A, 0xD0, 0x9D, 0x76, 0x7C, 0x19, 0x69, 0xEB, 0xCC,
+    0x1A, 0x2B, 0xFA, 0x86, 0x83, 0x14, 0xBD, 0x29, 0x4B, 0x80, 0xB7, 0x3C, 0x98, 0x2E, 0xB1, 0x29,
+    0x84, 0x4A, 0xF5, 0x85, 0xC7, 0x38, 0x5C, 0xA3, 0xDD, 0x80, 0x5B, 0x1C, 0x7B, 0xA0, 0x45, 0xC1,
+    0x03, 0x59, 0x61, 0x87, 0x83, 0x95, 0x92, 0xD6, 0xAE, 0x15, 0x91, 0xB1, 0x62, 0xC5, 0xAA, 0x2F,
+    0x45, 0xF9, 0x22, 0x15, 0xE5, 0x30, 0xD6, 0xD9, 0x1D, 0x13, 0xAF, 0xD1, 0x56, 0x45, 0xF5, 0x58,
+    0x3C, 0xAA, 0x6D, 0x98, 0x79, 0x75, 0x26, 0x0D, 0x04, 0x8B, 0x55, 0xF7, 0xFB, 0x4E, 0xAE, 0x4A,
+    0xEC, 0x38, 0x4F, 0x2D, 0x16, 0x37, 0x35, 0x4E, 0xD4, 0x28, 0x96, 0xA8, 0xBA, 0x1C, 0x91, 0xD0,
+    0x13, 0xE9, 0xC0, 0x44, 0xB2, 0xAE, 0xEE, 0x96, 0x32, 0x3F, 0x98, 0x8D, 0xAC, 0xA8, 0x60, 0x24,
+    0x54, 0xBA, 0x17, 0xCE, 0x25, 0x2E, 0xE4, 0x5F, 0x22, 0x1B, 0x77, 0x1C, 0xAF, 0x81, 0x1F, 0xDF,
+    0xC1, 0x0B, 0x3E, 0xDE, 0x84, 0x16, 0xA5, 0x82, 0x4E, 0x01, 0xC5, 0x79, 0x8B, 0x77, 0x96, 0x1A,
+    0xFE, 0x6D, 0x1D, 0x77, 0xB6, 0xDC, 0xDB, 0x35, 0xB6, 0x96, 0x59, 0xD6, 0x61, 0xDD, 0xEA, 0x58,
+    0xC6, 0x63, 0x7D, 0x8C, 0x8E, 0xB1, 0xC8, 0xB8, 0x98, 0x2A, 0xFD, 0x30, 0x14, 0xA0, 0x07, 0x2B,
+    0x22, 0xF8, 0xB2, 0x32, 0xC1, 0x7B, 0x02, 0xDA, 0xFF, 0xA8, 0x4A, 0xDF, 0x37, 0x65, 0x5F, 0xBA,
+    0x51, 0xDB, 0x40, 0xE3, 0xAA, 0xB5, 0x78, 0xC3, 0x71, 0x2F, 0x5B, 0x19, 0xB4, 0x6E, 0x11, 0xDD,
+    0xA6, 0xBC, 0x3A, 0xDE, 0xB9, 0xBC, 0x3A, 0xB3, 0x71, 0x0C, 0x36, 0x89, 0xA6, 0x0F, 0x36, 0x7D,
+    0xB6, 0x6F, 0xA3, 0xCF, 0x5A, 0x87, 0x2C, 0xFE, 0xF9, 0xB9, 0xA4, 0x0A, 0xB6, 0x79, 0x97, 0xDF,
+    0x5F, 0x14, 0xFF, 0x44, 0x5B, 0x55, 0xCE, 0xE6, 0x5D, 0x94, 0x6B, 0x7F, 0xCC, 0x00, 0x4F, 0x3E,
+    0x82, 0x8A, 0x77, 0x00, 0xA9, 0x35, 0xCA, 0xF0, 0x8E, 0x82, 0xB0, 0xE3, 0x2D, 0x5B, 0xE0, 0x32,
+    0xE9, 0xC8, 0x82, 0x94, 0x30, 0x6C, 0x05, 0x9D, 0xB8, 0x6D, 0x9A, 0x33, 0xCA, 0x40, 0x33, 0x22,
+    0xA8, 0xFC, 0x39, 0xF3, 0xA3, 0x90, 0xCD, 0xAD, 0xB6, 0x81, 0x73, 0x4D, 0x41, 0x5E, 0x5B, 0x7F,
+    0x72, 0x17, 0xB3, 0x70, 0xA6, 0x0E, 0x9E, 0xA6, 0x38, 0x66, 0xCD, 0x2C, 0xA5, 0x3D, 0xB3, 0x0D,
+    0xB4, 0x2B, 0xA4, 0x0C, 0xA8, 0x86, 0x9B, 0x04, 0x37, 0xC3, 0xD9, 0x29, 0x2E, 0x79, 0xCB, 0x52,
+    0xF5, 0x3B, 0xEF, 0xD7, 0xCA, 0xFA, 0xD5, 0x35, 0xAE, 0x29, 0xE1, 0xE0, 0xF9, 0xEB, 0x1B, 0xFB,
+    0xD1, 0xAF, 0xD0, 0x48, 0x92, 0x80, 0x1E, 0x46, 0xB2, 0xDC, 0xAF, 0x7D, 0xAB, 0x35, 0xBF, 0xBA,
+    0x16, 0xC2, 0x84, 0xA9, 0xA8, 0x05, 0x69, 0x7E, 0x89, 0x54, 0xF2, 0x6F, 0x85, 0x98, 0xB9, 0x3E,
+    0x78, 0x3A, 0x2E, 0xA8, 0xEC, 0x52, 0xA9, 0xC6, 0x9E, 0xB0, 0x42, 0x93, 0x2C, 0x2A, 0x7D, 0xAE,
+    0xE4, 0x6F, 0x9E, 0xE3, 0x35, 0xDC, 0xD3, 0xE2, 0xDE, 0x2E, 0xCD, 0x83, 0x9D, 0xEA, 0xDA, 0x5A,
+    0xD0, 0x0D, 0x5C, 0x3D, 0xBD, 0x84, 0x41, 0xA5, 0x0F, 0x73, 0x3E, 0xA9, 0xE7, 0xF7, 0x8E, 0xDB,
+    0xB5, 0x21, 0x23, 0xB7, 0x84, 0x17, 0xFE, 0xEA, 0x2D, 0x30, 0xE9, 0xF9, 0xCC, 0x33, 0x74, 0x3D,
+    0xB4, 0x45, 0x0E, 0x2B, 0x18, 0x9C, 0xF6, 0xF6, 0x88, 0x35, 0x57, 0x44, 0xAD, 0xA0, 0xD1, 0x49,
+    0xDE, 0x8E, 0x96, 0x37, 0xD2, 0xEC, 0x8A, 0xF2, 0xA3, 0x52, 0x2D, 0x2D, 0xA9, 0x0B, 0x46, 0x6D,
+    0xBF, 0x6C, 0x86, 0x4E, 0x5A, 0x84, 0xF1, 0x59, 0x6D, 0xBB, 0x40, 0xBB, 0xE9, 0xDD, 0x67, 0xB8,
+    0x03, 0x4F, 0x8B, 0x23, 0xB4, 0x15, 0xA5, 0x82, 0xB2, 0x75, 0xA9, 0x2B, 0x2F, 0x48, 0x6A, 0xF0,
+    0xD7, 0xAF, 0x4B, 0xB5, 0x91, 0x45, 0xD7, 0x33, 0xCA, 0xB7, 0xBC, 0x47, 0xDB, 0x37, 0x0A, 0x08,
+    0x0A, 0xB3, 0x34, 0x71, 0x9A, 0x94, 0x5C, 0xB2, 0x0C, 0x8F, 0xBC, 0x6B, 0xE1, 0x65, 0xC0, 0x47,
+    0x1F, 0xB4, 0x68, 0xBF, 0xE5, 0xFE, 0xAF, 0x55, 0xF3, 0x4D, 0xAB, 0x26, 0xEF, 0x2E, 0x01, 0x2C,
+    0x52, 0x89, 0x6F, 0xBB, 0x2D, 0xBB, 0x09, 0x03, 0xB3, 0x1C, 0x21, 0xE8, 0xE1, 0xB5, 0xB4, 0xA4,
+    0xCC, 0x66, 0xBC, 0x78, 0xD5, 0x40, 0x91, 0x06, 0x3D, 0xAC, 0x58, 0x2F, 0xFC, 0x96, 0xB5, 0xEA,
+    0x47, 0xA5, 0xC6, 0x81, 0x05, 0x6C, 0x73, 0x73, 0x29, 0xAC, 0x6F, 0xB7, 0xE9, 0x66, 0xBB, 0x7F,
+    0x2C, 0x40, 0xC3, 0x58, 0x4B, 0xC2, 0x3C, 0x8F, 0xE7, 0x69, 0x61, 0x7D, 0xEE, 0xB0, 0x80, 0x31,
+    0xBA, 0x2B, 0x8C, 0xC1, 0x2F, 0x96, 0x01, 0x48, 0x76, 0x9C, 0xF1, 0x57, 0x16, 0x6B, 0x80, 0x46,
+    0x92, 0xFB, 0xA4, 0x9C, 0xFF, 0x02, 0xB9, 0x3B, 0x27, 0x2B, 0xB2, 0x9A, 0xCD, 0x48, 0x35, 0x91,
+    0xB1, 0xE3, 0x04, 0x76, 0xD2, 0x8F, 0xA7, 0xD3, 0xA4, 0x17, 0xB4, 0x16, 0x53, 0xF2, 0x65, 0xDC,
+    0x44, 0x09, 0x83, 0x67, 0x62, 0xF7, 0x6E, 0xD8, 0xBD, 0x07, 0xE1, 0x58, 0xAF, 0x23, 0x01, 0x78,
+    0x56, 0x3A, 0x88, 0x8B, 0x95, 0x1D, 0x09, 0xCB, 0x28, 0x7F, 0x08, 0xFE, 0x63, 0x11, 0xA7, 0xB0,
+    0x4D, 0xC8, 0x08, 0x0C, 0xB9, 0xD3, 0x54, 0x19, 0xF7, 0x1F, 0xA0, 0x2F, 0x30, 0x75, 0xBB, 0xF3,
+    0x79, 0x1F, 0x21, 0xD6, 0x7D, 0x92, 0xE3, 0xAF, 0x31, 0x04, 0xC7, 0x06, 0x97, 0x6E, 0x81, 0x17,
+    0x03, 0x94, 0x62, 0x07, 0xFF, 0x16, 0x03, 0x0C, 0xEE, 0x64, 0x80, 0x8B, 0xA0, 0xD1, 0x16, 0x14,
+    0x33, 0x6C, 0x92, 0xC3, 0xB1, 0x02, 0xA3, 0xDD, 0xF6, 0x13, 0x92, 0x2E, 0x78, 0xBF, 0x52, 0x27,
+    0x1C, 0xD9, 0x21, 0xDF, 0xF8, 0x62, 0x54, 0xE8, 0xF3, 0x76, 0xC8, 0x76, 0x26, 0xC7, 0xBD, 0xBB,
+    0xD2, 0xA1, 0xBF, 0xEA, 0x1E, 0xCA, 0x95, 0xE4, 0x3E, 0x19, 0xA7, 0x54, 0x75, 0x7C, 0x23, 0xB2,
+    0xC4, 0x92, 0xCE, 0xFA, 0xC6, 0x68, 0xF6, 0xDD, 0x83, 0x5A, 0x79, 0x2D, 0x85, 0xB6, 0xDC, 0xC3,
+    0x48, 0x17, 0xD0, 0x2C, 0xF6, 0x2F, 0x32, 0x66, 0xC3, 0x84, 0xA5, 0xD4, 0x6E, 0xF6, 0xDC, 0xFA,
+    0x9F, 0x7A, 0xCE, 0xFD, 0x8A, 0x46, 0x71, 0xF3, 0xB8, 0xEA, 0x96, 0xC1, 0xD6, 0x3F, 0x4E, 0x5A,
+    0x75, 0x5F, 0xD8, 0x48, 0xD6, 0x3C, 0x96, 0xC8, 0x7C, 0xD2, 0xBB, 0xB9, 0x30, 0xD1, 0xF9, 0x56,
+    0xAC, 0xCA, 0xCB, 0x70, 0x29, 0xD1, 0x9F, 0xF8, 0x7C, 0x21, 0xB7, 0x48, 0xEC, 0x85, 0x1C, 0xFC,
+    0xA1, 0x16, 0xAD, 0x1B, 0x67, 0x3E, 0x00, 0xB3, 0x96, 0x49, 0xA8, 0xDD, 0x2A, 0xE8, 0x43, 0x51,
+    0xD9, 0xDB, 0x3B, 0x89, 0xCD, 0x7E, 0xCA, 0x0A, 0xB2, 0xF1, 0x65, 0x9C, 0x4E, 0xC5, 0x90, 0xB3,
+    0x71, 0x03, 0xC1, 0x46, 0x70, 0xB7, 0x84, 0x5B, 0x62, 0x47, 0xB0, 0x24, 0x02, 0x49, 0x2B, 0xC4,
+    0x35, 0x31, 0x73, 0x4A, 0xAF, 0x2B, 0xF9, 0xFE, 0x82, 0x44, 0x2C, 0x3F, 0x25, 0x1B, 0x7F, 0xB7,
+    0x87, 0x56, 0xDD, 0x9D, 0x42, 0xAB, 0x6A, 0x36, 0x3B, 0x2D, 0x1B, 0x75, 0xC9, 0x8F, 0x40, 0xAC,
+    0xA3, 0x71, 0x47, 0x34, 0xA9, 0x47, 0xC4, 0x5D, 0x74, 0x12, 0x35, 0x66, 0x6D, 0x99, 0x02, 0xCF,
+    0x77, 0xA7, 0x99, 0xBC, 0x2B, 0x59, 0xB3, 0x20, 0x94, 0x3E, 0xBA, 0x4D, 0xAC, 0x99, 0x53, 0x62,
+    0x98, 0xA7, 0x54, 0x3E, 0xF5, 0xFE, 0xEC, 0xB4, 0x64, 0xBF, 0xFB, 0x30, 0x99, 0x96, 0xBD, 0xD5,
+    0x30, 0x5C, 0xDB, 0xD1, 0x07, 0x1C, 0x03, 0x96, 0x03, 0x58, 0xCE, 0xB5, 0xC0, 0xBF, 0xB7, 0x5F,
+    0xCF, 0x86, 0x70, 0x2B, 0xD8, 0x63, 0x2D, 0xCD, 0x6D, 0x7B, 0x98, 0xB2, 0x74, 0xD8, 0x79, 0xBF,
+    0xAF, 0xFE, 0x6C, 0x33, 0xFA, 0xB3, 0xF3, 0x21, 0xE7, 0x18, 0x8C, 0x71, 0xE6, 0x68, 0x14, 0x2B,
+    0xFB, 0xE4, 0xCF, 0x66, 0x43, 0x1E, 0xA3, 0x5F, 0x84, 0x61, 0x43, 0x21, 0x49, 0x69, 0x07, 0xBD,
+    0x3A, 0x40, 0x06, 0x28, 0x8E, 0x8E, 0x7A, 0xD5, 0x33, 0xFF, 0x33, 0xEA, 0x51, 0x0B, 0x7A, 0x19,
+    0x76, 0x28, 0xF9, 0xB7, 0x66, 0x81, 0xB6, 0x7B, 0x84, 0x46, 0xA0, 0x45, 0x40, 0x83, 0x80, 0xF6,
+    0x00, 0xCD, 0x01, 0x6B, 0x0D, 0x00, 0x5C, 0x5D, 0xD8, 0x1A, 0x5C, 0x02, 0x8B, 0x10, 0xB6, 0x82,
+    0x6C, 0xFF, 0x55, 0xB2, 0xFF, 0x57, 0xC9, 0x06, 0x60, 0x49, 0x1E, 0xC8, 0x17, 0x5C, 0xA4, 0xAD,
+    0x92, 0x3D, 0xC0, 0x4A, 0x36, 0x01, 0x2B, 0xD9, 0x05, 0xAC, 0x64, 0x1B, 0xB0, 0x92, 0x7D, 0xC0,
+    0x4A, 0x36, 0x02, 0x2B, 0xD9, 0x09, 0xAC, 0x64, 0x2B, 0xB0, 0x92, 0xBD, 0xC0, 0x4A, 0x36, 0x03,
+    0x9F, 0xE0, 0x6E, 0x60, 0xD3, 0x70, 0x3B, 0x30, 0xB0, 0x23, 0x2D, 0x2A, 0xFB, 0xDA, 0x21, 0x1F,
+    0x6C, 0xB7, 0x99, 0xD8, 0x82, 0xF4, 0xA8, 0xD7, 0xBC, 0xC7, 0x4E, 0xF3, 0x03, 0xB3, 0x1C, 0x16,
+    0x69, 0xDC, 0xD0, 0x36, 0x8D, 0xA5, 0x63, 0xB1, 0x76, 0x6E, 0x00, 0xA7, 0x93, 0x3F, 0x03, 0xAF,
+    0x3F, 0xF2, 0x25, 0xF0, 0xE3, 0x1F, 0x7C, 0x42, 0xFC, 0xE9, 0xFB, 0xC0, 0x8F, 0x9A, 0x57, 0x80,
+    0x1F, 0x31, 0x9E, 0xC5, 0xDD, 0xE9, 0xF8, 0x38, 0x7A, 0x51, 0xC6, 0x49, 0xD3, 0x97, 0x00, 0x04,
+    0xF9, 0x22, 0xF0, 0x29, 0xAC, 0xA3, 0x7A, 0xA7, 0x76, 0xAF, 0x9A, 0x43, 0x14, 0x47, 0x4B, 0xB5,
+    0xA1, 0xCF, 0x17, 0xB6, 0x22, 0x86, 0x49, 0xE8, 0xFE, 0xE7, 0x9E, 0x7D, 0x6B, 0x82, 0x93, 0x1C,
+    0x56, 0x7E, 0xB9, 0xA9, 0xBC, 0xAB, 0xAC, 0x79, 0xA9, 0x47, 0x05, 0xE0, 0xE8, 0x42, 0x4A, 0x8F,
+    0x98, 0xB7, 0xF8, 0xAE, 0xEA, 0xAB, 0xBD, 0x4F, 0x4A, 0xCC, 0x01, 0xEE, 0x83, 0x91, 0x9D, 0xA8,
+    0x46, 0x22, 0x49, 0xF8, 0xFD, 0x8A, 0x71, 0x48, 0x50, 0x4C, 0x1B, 0xD9, 0xDE, 0xFE, 0xC4, 0xC7,
+    0x5C, 0x6C, 0x72, 0x72, 0x04, 0xDD, 0xB7, 0x72, 0xCF, 0x87, 0xE1, 0x65, 0x6F, 0xAB, 0xE0, 0xC3,
+    0x46, 0x40, 0xF2, 0x91, 0x77, 0x3B, 0x04, 0x25, 0xB5, 0x6D, 0xAE, 0xE0, 0x89, 0x60, 0xFF, 0x9B,
+    0x6E, 0xBA, 0xA6, 0x6C, 0x90, 0x3D, 0x7C, 0x47, 0x94, 0xAF, 0xE0, 0xF4, 0xB8, 0x7C, 0x6B, 0x84,
+    0x08, 0x62, 0xEE, 0x0D, 0xA8, 0xDC, 0xEE, 0x64, 0x37, 0x65, 0x81, 0x69, 0xAB, 0x6C, 0x39, 0x92,
+    0xED, 0x3B, 0x98, 0x87, 0x4A, 0x0B, 0x53, 0x8E, 0xD6, 0xC0, 0xD2, 0x34, 0x46, 0x29, 0xBE, 0xA1,
+    0x96, 0xB3, 0x74, 0x03, 0x3D, 0xBD, 0x61, 0x47, 0x89, 0xDE, 0xAD, 0x30, 0x73, 0x2D, 0xA1, 0x02,
+    0xCC, 0xCD, 0xD4, 0x4C, 0xD3, 0x3C, 0x94, 0xE2, 0xBA, 0xF8, 0x3A, 0xB1, 0x4E, 0xAC, 0xA1, 0x2B,
+    0xE1, 0x42, 0xC7, 0xE4, 0x8E, 0xD2, 0xBF, 0x37, 0xD7, 0xCF, 0xA3, 0xFF, 0xEF, 0xE3, 0xD9, 0xB0,
+    0x53, 0x63, 0x01, 0xE8, 0x7D, 0xCE, 0x5A, 0x3A, 0xA9, 0xE2, 0xF3, 0x15, 0xAC, 0x76, 0xE7, 0xAC,
+    0xDD, 0x97, 0x3E, 0xDF, 0xC3, 0x17, 0x3E, 0xD0, 0x5A, 0x08, 0x7A, 0x22, 0x99, 0x2C, 0x11, 0xC9,
+    0xB6, 0x3D, 0x55, 0x09, 0xA3, 0x3B, 0xDA, 0x6E, 0x12, 0xC8, 0xA5, 0xA7, 0x7D, 0x6C, 0x1D, 0x63,
+    0x56, 0x11, 0x7A, 0xC8, 0x99, 0x77, 0xC6, 0xDE, 0x71, 0x89, 0xF8, 0x4F, 0xD4, 0xCB, 0x47, 0x18,
+    0xD8, 0x1B, 0x7E, 0xA7, 0xEE, 0xEF, 0x33, 0x4A, 0x3A, 0x19, 0xF6, 0xCE, 0xC6, 0xF9, 0xB6, 0xAD,
+    0xCA, 0xA6, 0xAF, 0x84, 0x48, 0x6D, 0x4D, 0x62, 0x5C, 0x7A, 0x9D, 0xB5, 0x8B, 0xA4, 0x96, 0x67,
+    0x61, 0xB8, 0xAE, 0xCA, 0x5E, 0x8F, 0xB9, 0x94, 0x50, 0xFE, 0xD0, 0x19, 0x22, 0xFD, 0x2C, 0x86,
+    0xED, 0x37, 0x31, 0xCC, 0x4C, 0x46, 0xDD, 0x9D, 0xB2, 0x91, 0x2F, 0x3B, 0xA1, 0x16, 0x77, 0xA8,
+    0x78, 0x7D, 0xEE, 0x6F, 0x68, 0xC7, 0x91, 0xB7, 0x05, 0x1D, 0x5A, 0xF9, 0xCB, 0xF4, 0xD9, 0xCB,
+    0xE0, 0xD3, 0xBC, 0x5B, 0x0B, 0x38, 0xFD, 0xD7, 0x2D, 0xDD, 0xD5, 0x38, 0xD4, 0x73, 0xBE, 0x34,
+    0x2D, 0xDB, 0xE8, 0x71, 0x08, 0x45, 0x5A, 0x2D, 0x78, 0xF2, 0xAF, 0x6E, 0x8B, 0xBA, 0xF9, 0xAF,
+    0x25, 0xAA, 0xD0, 0x48, 0x1E, 0x57, 0x0A, 0x03, 0x17, 0xD5, 0x04, 0xF7, 0xC2, 0x0A, 0xF5, 0x4F,
+    0x61, 0x8A, 0xDF, 0xE3, 0x14, 0xCF, 0xC7, 0x29, 0xDE, 0xCF, 0x6F, 0x14, 0xC1, 0x12, 0x62, 0xF5,
+    0xF0, 0xB1, 0x8D, 0x7F, 0xAB, 0x0D, 0xA2, 0x2C, 0x4F, 0x1D, 0x60, 0x85, 0xE5, 0xA2, 0xAC, 0x96,
+    0xA1, 0xB3, 0x04, 0x6B, 0xC7, 0x91, 0xAF, 0xAC, 0x68, 0x6D, 0x26, 0x9D, 0xD2, 0xAD, 0xDF, 0x3B,
+    0x4D, 0x9D, 0xF7, 0x0B, 0x8C, 0x90, 0x13, 0xC0, 0xBD, 0xD5, 0x51, 0xEF, 0x05, 0x32, 0x70, 0xDB,
+    0xE7, 0x7F, 0xED, 0xC3, 0xC3, 0xFE, 0x08, 0xC9, 0x31, 0x28, 0xD9, 0xDE, 0x48, 0x07, 0xCA, 0x39,
+    0x67, 0xFA, 0xAF, 0x7B, 0xA0, 0x8E, 0xA7, 0xFE, 0x0C, 0xC5, 0xC4, 0xFA, 0x67, 0xA5, 0xD9, 0x5E,
+    0x92, 0xE2, 0x9D, 0x47, 0xD9, 0xBB, 0xD9, 0x8C, 0x02, 0x4B, 0x60, 0x3F, 0xBF, 0xD9, 0x64, 0x75,
+    0xF6, 0xA6, 0xCC, 0x6D, 0x1F, 0x7A, 0xDE, 0xFB, 0x1E, 0x8B, 0xB7, 0x1E, 0x20, 0x5D, 0x28, 0xA7,
+    0x8E, 0x95, 0x5A, 0x3B, 0xB0, 0xAF, 0x7D, 0xF4, 0xB2, 0xB7, 0x54, 0xF0, 0x5B, 0x2A, 0x98, 0x7A,
+    0x54, 0x30, 0x7B, 0xEE, 0xE7, 0x8F, 0x3D, 0xCE, 0x37, 0xCD, 0xC8, 0x94, 0x76, 0xC4, 0x7D, 0xCE,
+    0x2D, 0xEA, 0x60, 0x87, 0x2F, 0x25, 0xE1, 0x33, 0xA9, 0xFD, 0xEE, 0x11, 0xCD, 0xE0, 0x34, 0xC8,
+    0x2F, 0x5A, 0x42, 0xE9, 0x98, 0xCE, 0xC2, 0xCD, 0x3A, 0x0B, 0x6B, 0x77, 0xE7, 0x3A, 0x58, 0xB7,
+    0xF8, 0xB5, 0xB0, 0x19, 0x99, 0x6C, 0x64, 0xB1, 0x6D, 0xB5, 0xB1, 0xA9, 0xAD, 0x8D, 0x5D, 0xDE,
+    0x12, 0x5B, 0xB0, 0x32, 0x91, 0xB5, 0x65, 0x91, 0x6C, 0x8B, 0x5D, 0xEC, 0x19, 0xFF, 0xFF, 0x5E,
+    0xBB, 0x3B, 0xCC, 0x73, 0x7E, 0xBB, 0x79, 0xDE, 0xE7, 0x3E, 0x53, 0xA0, 0xDD, 0x6E, 0x9E, 0xBF,
+    0xCD, 0x38, 0xFC, 0x87, 0xE1, 0x90, 0xBE, 0x07, 0x93, 0xFA, 0xE5, 0x0A, 0xA6, 0x41, 0xB2, 0xEF,
+    0xDF, 0xA5, 0xE0, 0x1F, 0x2F, 0x55, 0xC8, 0xF6, 0xDF, 0x5B, 0xB4, 0x7F, 0x37, 0xDB, 0x24, 0x29,
+    0x27, 0x86, 0x74, 0xE6, 0xA0, 0xD6, 0xEE, 0xF5, 0x17, 0xBD, 0xF0, 0x95, 0x76, 0x4F, 0xD7, 0x3D,
+    0xD9, 0x56, 0xA5, 0xDE, 0xFE, 0x01, 0xAD, 0x01, 0xDA, 0xF8, 0x82, 0x46, 0x6B, 0xE0, 0x5E, 0x8F,
+    0x8B, 0xEF, 0xE5, 0x1B, 0x09, 0xFD, 0x4B, 0xF7, 0x7D, 0x6C, 0xB6, 0x7A, 0xF6, 0x1A, 0x0D, 0xD5,
+    0x2F, 0x98, 0xBF, 0x78, 0x15, 0xFD, 0xF8, 0x59, 0xF0, 0x17, 0x1A, 0xA0, 0x2D, 0x2B, 0x2F, 0xD5,
+    0x66, 0x9C, 0x39, 0xF5, 0x05, 0x35, 0x29, 0xFA, 0x2D, 0xF7, 0x6A, 0xF5, 0xB4, 0xD5, 0xF8, 0xDC,
+    0x1B, 0x1B, 0x49, 0xA4, 0x95, 0x85, 0x2A, 0xAC, 0x2A, 0x9F, 0xCC, 0x3B, 0xE5, 0x5E, 0xDB, 0x96,
+    0x25, 0x89, 0x6D, 0x54, 0x60, 0x48, 0xB9, 0xD1, 0x4A, 0x62, 0x3F, 0x98, 0x90, 0x61, 0xF5, 0x84,
+    0x7A, 0xEB, 0xC7, 0xCA, 0x85, 0x5E, 0x70, 0x97, 0x74, 0xC3, 0x7E, 0x7D, 0xBB, 0xCD, 0x04, 0xCE,
+    0x87, 0xFF, 0x59, 0x03, 0x3F, 0x6A, 0xE1, 0x7C, 0xEC, 0x75, 0xE3, 0xB7, 0xE6, 0x3E, 0xE5, 0x8E,
+    0x9F, 0xDB, 0x7E, 0x6B, 0xDC, 0x09, 0xD9, 0xF4, 0x6D, 0xCD, 0xFD, 0xED, 0x3B, 0x5C, 0xA1, 0xFB,
+    0x4F, 0xC3, 0x62, 0xE4, 0xE7, 0x56, 0xF5, 0x57, 0x97, 0x99, 0x80, 0x63, 0x0E, 0x2E, 0xDD, 0xFA,
+    0xF9, 0x81, 0xCB, 0x59, 0x7C, 0x8C, 0x53, 0xFA, 0x28, 0xE6, 0x74, 0xC5, 0x49, 0xC6, 0x9D, 0x05,
+    0xF7, 0xE8, 0x3B, 0x66, 0x96, 0xFD, 0xC5, 0x60, 0xD9, 0x5F, 0xDC, 0x9F, 0xBD, 0xE1, 0x77, 0x55,
+    0x66, 0x26, 0x15, 0x1E, 0x16, 0x16, 0x27, 0xCB, 0x3E, 0x02, 0x92, 0x4B, 0x29, 0xAE, 0x14, 0x3E,
+    0xDD, 0xB6, 0x04, 0xED, 0x7A, 0x12, 0x32, 0x7F, 0x97, 0x31, 0x5A, 0x80, 0x0F, 0x68, 0xCF, 0xE0,
+    0x43, 0x17, 0x3F, 0xCD, 0xB9, 0x31, 0xA1, 0x98, 0x30, 0x81, 0x07, 0xC3, 0xDB, 0x26, 0xF0, 0x5A,
+    0x5B, 0x1B, 0x32, 0x7C, 0xED, 0xA3, 0xB0, 0x94, 0x70, 0x53, 0x38, 0x26, 0xF0, 0xE8, 0x32, 0x38,
+    0x9D, 0x24, 0xF0, 0xA2, 0x92, 0x35, 0x57, 0x57, 0x93, 0xB0, 0x62, 0x90, 0xA2, 0x80, 0xED, 0xCF,
+    0x62, 0x91, 0x72, 0x0C, 0x58, 0x95, 0x36, 0xFA, 0x2D, 0xDD, 0xB6, 0xBB, 0x03, 0xFA, 0x2D, 0xD4,
+    0xB0, 0x60, 0x98, 0xC5, 0x8B, 0x8B, 0x60, 0xB7, 0x2F, 0x48, 0x80, 0x2E, 0xF2, 0x6D, 0x16, 0xEF,
+    0x7F, 0x71, 0x6F, 0xAB, 0x33, 0x71, 0xE1, 0x07, 0x68, 0x6C, 0xA7, 0x18, 0x2A, 0x3D, 0xB8, 0x71,
+    0x07, 0x83, 0x39, 0xA2, 0xCD, 0x19, 0xEA, 0xC1, 0xD6, 0xA2, 0xC3, 0x1A, 0x4B, 0x2A, 0xB2, 0x7B,
+    0xCB, 0x60, 0xE6, 0xB0, 0x7A, 0x3D, 0xFA, 0x0A, 0xFC, 0xE6, 0x2B, 0x0C, 0x26, 0xD9, 0xA9, 0xA7,
+    0xAB, 0xA6, 0x4D, 0x06, 0x0B, 0xF7, 0x88, 0xE9, 0xB2, 0xA5, 0x9E, 0x32, 0x02, 0x2C, 0x5F, 0xE5,
+    0xF0, 0x7F, 0xC5, 0x5A, 0xBF, 0x93, 0xD4, 0x46, 0x16, 0x7E, 0x92, 0xD8, 0x55, 0x19, 0xD5, 0x59,
+    0x04, 0xB8, 0x5C, 0xC6, 0x67, 0x94, 0x38, 0xB8, 0x23, 0x40, 0xFF, 0x00, 0xAC, 0x44, 0xEC, 0x2A,
+    0x9B, 0xC0, 0x1C, 0x01, 0x55, 0x47, 0x70, 0x89, 0xCB, 0x09, 0x89, 0x03, 0x07, 0x2C, 0xD2, 0xD5,
+    0x05, 0x17, 0x6C, 0xC0, 0x96, 0x13, 0xA7, 0x04, 0x04, 0x36, 0x09, 0x09, 0xC1, 0x06, 0x60, 0x29,
+    0x23, 0x70, 0xD2, 0x76, 0x95, 0x2F, 0x9E, 0xA2, 0xB8, 0x4B, 0x08, 0x56, 0xBE, 0x12, 0x65, 0x2D,
+    0xA7, 0x51, 0xFB, 0xFB, 0xBA, 0xA5, 0x61, 0x60, 0x0F, 0x63, 0x76, 0x46, 0x33, 0xB3, 0xEA, 0x66,
+    0xA6, 0xA5, 0xE9, 0xF7, 0xBE, 0xF7, 0x5E, 0xBF, 0x5F, 0x83, 0x84, 0xAD, 0x88, 0x84, 0x53, 0x4C,
+    0xB1, 0xC6, 0x94, 0x14, 0x98, 0xB2, 0x24, 0x17, 0x29, 0xE2, 0x52, 0xA4, 0x8B, 0x4A, 0x71, 0xA6,
+    0xE1, 0x44, 0xDC, 0x36, 0xAC, 0xC4, 0x6B, 0xFD, 0x5A, 0xFC, 0x83, 0x2B, 0x8D, 0x04, 0x5A, 0xB7,
+    0x12, 0x6A, 0x3D, 0x95, 0x48, 0xEB, 0x4E, 0x12, 0x25, 0x5A, 0x92, 0x52, 0x8A, 0x34, 0xCB, 0x25,
+    0x2B, 0x75, 0xCA, 0x0F, 0xF6, 0x95, 0x62, 0x78, 0x35, 0x26, 0xBF, 0x19, 0xDE, 0x71, 0xCD, 0x29,
+    0x14, 0xBE, 0xCA, 0x3D, 0x3A, 0x79, 0x4B, 0x48, 0x19, 0x84, 0xFF, 0xA2, 0xB9, 0xA7, 0x24, 0x9D,
+    0x16, 0x9D, 0x16, 0x58, 0xE5, 0xC0, 0xDF, 0x13, 0x2D, 0x99, 0xCE, 0x24, 0x9A, 0xC6, 0x76, 0xCF,
+    0x63, 0xE4, 0x11, 0x9B, 0x14, 0x60, 0x33, 0xEB, 0x3F, 0x1F, 0xBF, 0x45, 0x1C, 0x04, 0xB3, 0xF1,
+    0x80, 0xCF, 0x6C, 0x63, 0xB8, 0xFC, 0xE8, 0x4D, 0x7A, 0x4E, 0x64, 0x3C, 0xA8, 0x77, 0xB0, 0x93,
+    0xC6, 0x1E, 0x57, 0x95, 0x48, 0x80, 0xC1, 0x4D, 0xCF, 0x5B, 0xA2, 0x0B, 0x01, 0x05, 0x18, 0xCA,
+    0x0F, 0x9F, 0x82, 0xF6, 0xBA, 0x48, 0xD4, 0x5D, 0x14, 0xD9, 0x8A, 0xB0, 0x74, 0xDB, 0xCD, 0x47,
+    0x07, 0x25, 0x02, 0x6A, 0x5E, 0x25, 0xC5, 0x4E, 0xE9, 0xEA, 0x9F, 0xC4, 0x7F, 0x54, 0x49, 0x98,
+    0x7E, 0xB9, 0x30, 0xA8, 0x93, 0x9C, 0x12, 0x4E, 0xC1, 0x0E, 0x78, 0x77, 0xAE, 0x76, 0xB2, 0x3A,
+    0x50, 0x27, 0x7B, 0xDA, 0xE1, 0x47, 0x0D, 0x28, 0x83, 0xC0, 0x56, 0x9C, 0x4A, 0xED, 0x5B, 0x63,
+    0x7D, 0x7F, 0x2A, 0x8E, 0x86, 0x1A, 0xB5, 0x9E, 0xC8, 0x2E, 0x76, 0x96, 0xA0, 0x92, 0x8D, 0x6B,
+    0x15, 0x3E, 0x57, 0x9E, 0xDE, 0xAF, 0xC2, 0x3A, 0xA8, 0xC2, 0x8A, 0x03, 0x7F, 0x5D, 0x51, 0xF9,
+    0xFA, 0x97, 0xCA, 0xD1, 0x3F, 0x56, 0x3D, 0xCF, 0x34, 0x6F, 0xF9, 0x8E, 0xD3, 0x69, 0xAA, 0x6B,
+    0x8F, 0xEA, 0x3A, 0xB1, 0x4A, 0x75, 0xBD, 0x8D, 0x5D, 0x42, 0x18, 0x9F, 0xA3, 0xA0, 0xB2, 0xDC,
+    0xD1, 0xFF, 0x12, 0xCF, 0xA8, 0xEC, 0xFA, 0xE2, 0x76, 0xE8, 0x08, 0x90, 0x44, 0x4F, 0x71, 0x92,
+    0xCE, 0x63, 0x1B, 0xF9, 0x70, 0x93, 0x6B, 0x04, 0xE1, 0x73, 0xA3, 0x68, 0x07, 0xD4, 0xFF, 0xE4,
+    0xDC, 0x5A, 0x81, 0x45, 0x8A, 0xD3, 0xFD, 0x55, 0xBC, 0xFD, 0x56, 0xDC, 0x0B, 0x20, 0x77, 0x8A,
+    0xE7, 0xBF, 0x12, 0xE7, 0xA0, 0x11, 0xAF, 0x3C, 0xBB, 0x8C, 0xE3, 0x46, 0xAB, 0x24, 0xFB, 0x11,
+    0xBF, 0x99, 0xC5, 0xD8, 0xBF, 0xF1, 0xD5, 0x2A, 0x70, 0xBD, 0xDA, 0x53, 0x9A, 0x17, 0xAC, 0xD2,
+    0x85, 0x55, 0xFA, 0x8F, 0x1A, 0x89, 0xF2, 0xED, 0xC5, 0x91, 0x1A, 0x0F, 0xCA, 0xAF, 0xA4, 0xCF,
+    0x3D, 0xA8, 0x7D, 0x99, 0xCD, 0x49, 0xFB, 0xDE, 0x57, 0x60, 0x6C, 0xEB, 0x4A, 0x49, 0x61, 0xE0,
+    0x29, 0xF7, 0x1B, 0x59, 0x89, 0x1C, 0x28, 0xEE, 0x30, 0x95, 0xE0, 0xBD, 0x73, 0xE2, 0xFF, 0x70,
+    0x5F, 0x3C, 0x8D, 0xF3, 0x75, 0x2D, 0x5F, 0x96, 0x6E, 0x49, 0xC3, 0x65, 0x40, 0xB8, 0xF7, 0xB7,
+    0xB5, 0xA0, 0xA3, 0x66, 0x11, 0x18, 0x82, 0xE3, 0x63, 0xA0, 0xF3, 0xE8, 0x8A, 0x1C, 0xE3, 0xA1,
+    0xEF, 0x71, 0xFC, 0x03, 0x34, 0xB7, 0xAF, 0x96, 0x3D, 0x92, 0xCD, 0xDB, 0xE3, 0x43, 0xDC, 0xA2,
+    0x17, 0x85, 0x38, 0x03, 0xEC, 0xFF, 0xC7, 0x73, 0x12, 0xFC, 0xD0, 0x58, 0x88, 0xD9, 0x12, 0x20,
+    0x3A, 0x29, 0x7C, 0x50, 0xF8, 0x14, 0xBB, 0x9D, 0xA5, 0x0F, 0x3A, 0xB9, 0x09, 0x3A, 0xE7, 0x04,
+    0xBA, 0x8C, 0x2F, 0xD3, 0x64, 0x18, 0x7E, 0x9D, 0x6F, 0x57, 0xA3, 0xC5, 0xEE, 0x63, 0xF8, 0xA0,
+    0x29, 0x7C, 0xD0, 0x6D, 0xF1, 0xF2, 0x3F, 0x88, 0xF7, 0x78, 0x1B, 0x81, 0x03, 0x14, 0xE3, 0xDD,
+    0xC5, 0x61, 0x9E, 0xE0, 0x99, 0xDF, 0xA3, 0x8D, 0x66, 0x5A, 0x91, 0x7D, 0x30, 0xBD, 0x79, 0x20,
+    0xEB, 0xF5, 0x41, 0x1B, 0x70, 0x10, 0x61, 0xBA, 0x85, 0x8D, 0x5A, 0x28, 0xB4, 0x5E, 0x8E, 0xCD,
+    0x1E, 0xB3, 0x8F, 0xCF, 0xFB, 0xA0, 0x42, 0xD7, 0x5A, 0x37, 0xBC, 0x2E, 0x5D, 0xC4, 0x6E, 0xFD,
+    0xA5, 0xAB, 0xFE, 0x9A, 0x5F, 0xE4, 0x7A, 0x63, 0x2F, 0x31, 0xA9, 0x8A, 0x07, 0x5B, 0x6B, 0x39,
+    0xF3, 0x55, 0xEC, 0x1A, 0x5E, 0x63, 0xF2, 0x51, 0x02, 0x67, 0x9A, 0xE4, 0xC5, 0xA5, 0x2C, 0xD7,
+    0x08, 0xEF, 0x1C, 0x03, 0xD9, 0xA4, 0x74, 0x24, 0x7E, 0x76, 0xD7, 0xF0, 0xEB, 0xE8, 0xAE, 0x4F,
+    0xB9, 0x28, 0xD8, 0xB2, 0x1F, 0x16, 0x27, 0xCE, 0x4E, 0xD0, 0xC9, 0x46, 0xC6, 0xE4, 0x01, 0x71,
+    0xCF, 0x31, 0x31, 0xFF, 0x88, 0xCC, 0x7E, 0xCE, 0xC4, 0x15, 0xEA, 0xBD, 0x5C, 0xD9, 0x13, 0x1B,
+    0x41, 0xCB, 0x51, 0x2F, 0xFE, 0x05, 0xD8, 0x0E, 0xD4, 0x17, 0x49, 0x57, 0xDF, 0xD0, 0xD5, 0x17,
+    0xEF, 0xE7, 0x47, 0x66, 0xCE, 0xAD, 0x4F, 0x83, 0x81, 0x07, 0x12, 0x16, 0xAD, 0x7C, 0xB0, 0x39,
+    0x59, 0x98, 0x29, 0x9B, 0xBF, 0xC6, 0x26, 0x7B, 0x65, 0xF2, 0xCA, 0x64, 0x68, 0xC8, 0x85, 0xC0,
+    0x21, 0x09, 0xDB, 0x71, 0xE9, 0xA2, 0xB1, 0x9E, 0xD9, 0xD0, 0xD5, 0xF3, 0xF1, 0xF2, 0x3D, 0x73,
+    0xBF, 0x99, 0x0D, 0x9B, 0xA7, 0xBA, 0xB5, 0x14, 0x0F, 0x95, 0xA3, 0xFF, 0x2D, 0xDE, 0x7F, 0x6B,
+    0x09, 0xF2, 0xEB, 0x0B, 0xF3, 0xFE, 0xE9, 0x90, 0x2A, 0xDE, 0x6C, 0xC5, 0xB9, 0x86, 0xB5, 0x1B,
+    0x48, 0x15, 0x6F, 0x6F, 0x2E, 0x95, 0xF9, 0x59, 0x3A, 0x8A, 0x4C, 0xD8, 0x24, 0xC2, 0x09, 0x68,
+    0xEC, 0xF5, 0xE9, 0x68, 0x70, 0x40, 0x3A, 0xC8, 0xBD, 0x91, 0x7E, 0xB6, 0x41, 0xED, 0xD7, 0x5E,
+    0x13, 0x3C, 0xBD, 0xDC, 0x80, 0xC7, 0x96, 0x23, 0x60, 0x82, 0x8A, 0xA3, 0x08, 0xA3, 0x3F, 0xE1,
+    0xEA, 0x3B, 0x96, 0x5E, 0xA4, 0x27, 0xB3, 0x6C, 0x14, 0xB9, 0xE8, 0x69, 0xE4, 0xA1, 0xC8, 0x42,
+    0x21, 0x76, 0x2B, 0xF5, 0xA3, 0x9E, 0xAF, 0x00, 0x5F, 0x0E, 0xB0, 0xB3, 0x33, 0x91, 0xE2, 0x7B,
+    0xA4, 0x96, 0xFF, 0x59, 0x9A, 0x94, 0xE1, 0xD5, 0xE1, 0xD3, 0xE1, 0xD1, 0x4F, 0x6E, 0xF2, 0x64,
+    0x21, 0x9F, 0x0C, 0x77, 0x4A, 0x9B, 0x4B, 0x1E, 0xDD, 0x19, 0x88, 0xFE, 0x44, 0x5C, 0x3A, 0xE8,
+    0x14, 0x31, 0xEF, 0x14, 0x9C, 0x72, 0x02, 0x59, 0x35, 0x70, 0x0E, 0xEA, 0xF4, 0x12, 0x4C, 0x5A,
+    0xBC, 0x0E, 0x2B, 0x69, 0x7C, 0x53, 0x6D, 0xBB, 0x95, 0x2C, 0xD1, 0x69, 0xCD, 0x25, 0x7A, 0x01,
+    0x13, 0xBD, 0x74, 0x5B, 0xC6, 0x70, 0x66, 0x50, 0x24, 0xC2, 0xC8, 0x31, 0x04, 0x91, 0xFB, 0x86,
+    0xBE, 0xC9, 0x6F, 0x13, 0x5D, 0xE2, 0x8A, 0x75, 0x4A, 0x76, 0x5E, 0x77, 0x21, 0x65, 0xB2, 0xCF,
+    0x7F, 0x9E, 0x16, 0x93, 0xCB, 0x95, 0x57, 0x45, 0x8A, 0x1E, 0xEC, 0x0C, 0x18, 0x7B, 0xE5, 0xDF,
+    0x91, 0xF6, 0x37, 0x06, 0xC2, 0x32, 0x0C, 0xE1, 0x8C, 0xF6, 0x6E, 0x8A, 0xE1, 0x34, 0x2B, 0x93,
+    0xFC, 0xD4, 0x6B, 0xE8, 0x11, 0x79, 0x92, 0xF3, 0xC9, 0x21, 0xB5, 0x65, 0x24, 0xC5, 0x59, 0xAA,
+    0x19, 0x0D, 0x11, 0x08, 0x1B, 0x98, 0x5A, 0x32, 0x11, 0x9D, 0x43, 0x32, 0x59, 0x89, 0x40, 0x08,
+    0xD1, 0x62, 0x52, 0x90, 0x64, 0x3C, 0x37, 0x99, 0x1B, 0x78, 0x04, 0x13, 0x6C, 0x3F, 0x8F, 0x1A,
+    0x57, 0xDB, 0x0D, 0x5C, 0xA3, 0xC3, 0x6B, 0x7A, 0x28, 0xEC, 0xE8, 0x84, 0xAC, 0x22, 0xBD, 0x76,
+    0x78, 0x77, 0x48, 0x7B, 0xAA, 0xC8, 0xA1, 0x3D, 0x68, 0x2C, 0x56, 0x1A, 0x8E, 0x9F, 0xA3, 0x30,
+    0x94, 0x62, 0xD0, 0xC8, 0xCA, 0xF8, 0x99, 0x4E, 0x19, 0x4A, 0x1D, 0x5D, 0xCF, 0x69, 0x8F, 0x45,
+    0x0E, 0xB5, 0x97, 0xDA, 0x90, 0x69, 0x22, 0x73, 0x60, 0xD4, 0x9B, 0x0D, 0xA5, 0xB4, 0xA9, 0xC5,
+    0x9C, 0xA1, 0x12, 0x1D, 0x1B, 0xEA, 0xEF, 0x8D, 0x60, 0x6F, 0x8A, 0x76, 0xE8, 0x76, 0x40, 0xE3,
+    0xED, 0x36, 0x13, 0x73, 0x88, 0x34, 0x89, 0xF2, 0xF9, 0xF2, 0x79, 0x6C, 0x25, 0xD2, 0xEB, 0x23,
+    0x94, 0x64, 0xAF, 0x09, 0x25, 0x6F, 0x88, 0xEC, 0x1D, 0xB1, 0x4D, 0x1C, 0xE8, 0xED, 0xA1, 0x69,
+    0x79, 0x98, 0xDC, 0x8D, 0xC8, 0x3E, 0x5B, 0x11, 0xB2, 0x59, 0xA0, 0xF9, 0xE7, 0x10, 0x68, 0xA2,
+    0xFF, 0x1F, 0x68, 0xA6, 0x41, 0x83, 0x40, 0x83, 0xE0, 0xE2, 0x4E, 0xC3, 0xCA, 0x31, 0x83, 0xEF,
+    0x83, 0xDA, 0x6D, 0x91, 0x4F, 0xB6, 0xAE, 0xBE, 0x5B, 0x9B, 0xFE, 0x88, 0xA9, 0x9A, 0xCC, 0x6B,
+    0x8F, 0xD3, 0x5D, 0x4E, 0x6F, 0xB3, 0x78, 0xFE, 0x92, 0x8A, 0x3B, 0xB1, 0x72, 0xC5, 0x0D, 0x11,
+    0x0A, 0x05, 0x41, 0xF6, 0x10, 0x11, 0xEA, 0xD1, 0xD2, 0x94, 0xD7, 0x17, 0x1E, 0x07, 0x2F, 0x14,
+    0x1E, 0xE6, 0xC0, 0x79, 0x94, 0x41, 0xB8, 0x83, 0xB5, 0x3F, 0xCB, 0xAD, 0x55, 0x19, 0xA8, 0x0D,
+    0x6E, 0x4F, 0x70, 0x2B, 0x47, 0x70, 0x3B, 0xDE, 0x07, 0xB7, 0xF6, 0xBE, 0xB8, 0x2A, 0x5A, 0xC6,
+    0x11, 0xA4, 0x87, 0x21, 0xB8, 0xD0, 0xD8, 0x28, 0xAB, 0xC7, 0xBD, 0x59, 0x07, 0x75, 0x5D, 0x2E,
+    0xD4, 0xF8, 0x3A, 0x94, 0x36, 0x48, 0x70, 0xBC, 0x9F, 0x51, 0x6D, 0xE4, 0x37, 0xC6, 0x71, 0xAD,
+    0x03, 0x4C, 0x83, 0x97, 0x21, 0x55, 0x9C, 0x56, 0xE6, 0x5B, 0xC8, 0xC4, 0xA3, 0xF3, 0xC2, 0x08,
+    0xA1, 0x23, 0x08, 0x50, 0xA7, 0x18, 0x6A, 0x23, 0x07, 0x42, 0xE4, 0x65, 0x00, 0xB3, 0x39, 0x1D,
+    0x2B, 0xF3, 0x8D, 0xD9, 0x6C, 0x56, 0xEC, 0xDD, 0xFE, 0xA2, 0x40, 0xC4, 0x48, 0xC4, 0x8A, 0xA4,
+    0x97, 0xC9, 0x4B, 0x1A, 0x27, 0x0B, 0xD4, 0x09, 0xD3, 0x3D, 0x89, 0x78, 0x68, 0xB7, 0xE4, 0x4C,
+    0x6E, 0x01, 0x14, 0xBB, 0x59, 0x1A, 0xE8, 0xA9, 0xA6, 0x14, 0x5A, 0x8A, 0x01, 0x07, 0x80, 0x0A,
+    0x21, 0x78, 0xA1, 0x14, 0xEC, 0x54, 0x58, 0x36, 0x0C, 0x59, 0x40, 0xC6, 0xC3, 0xA9, 0xA9, 0xDA,
+    0x5E, 0x52, 0x7D, 0x9F, 0x2D, 0x08, 0x03, 0x2E, 0x5B, 0x25, 0xCD, 0xF3, 0x9E, 0xD0, 0x3A, 0xE1,
+    0xFB, 0x46, 0x0D, 0x5A, 0x7A, 0x9D, 0xA1, 0xD8, 0x19, 0x01, 0xBE, 0x6D, 0x90, 0x98, 0xE2, 0x5A,
+    0x36, 0x0A, 0xB3, 0xB4, 0x25, 0x33, 0x1B, 0x70, 0xAB, 0x75, 0x0A, 0x81, 0x21, 0x57, 0xD8, 0x0F,
+    0x90, 0x2B, 0xB4, 0x45, 0x9F, 0x13, 0x2B, 0x7E, 0x39, 0x3B, 0x86, 0x21, 0x44, 0x39, 0xC1, 0x66,
+    0xFF, 0xE3, 0xFC, 0x9D, 0xA1, 0x5A, 0x9D, 0x4D, 0xD7, 0x87, 0xDE, 0x69, 0x42, 0x76, 0x9A, 0x51,
+    0xCF, 0x84, 0x48, 0xEA, 0x25, 0x74, 0x1F, 0x8F, 0x63, 0xFC, 0xEB, 0x31, 0xEF, 0x8B, 0x32, 0xF3,
+    0x75, 0x5E, 0x2B, 0x87, 0xFC, 0xDE, 0x08, 0x50, 0x37, 0x66, 0xE7, 0xC8, 0x9C, 0x75, 0xF3, 0xCE,
+    0x36, 0x63, 0xBC, 0x46, 0x83, 0x89, 0x37, 0x18, 0x4D, 0x91, 0xFA, 0x4D, 0xA6, 0xA2, 0x2A, 0x41,
+    0x52, 0x80, 0xC2, 0x03, 0x91, 0x77, 0xFA, 0x4A, 0xFF, 0x7A, 0x26, 0x3D, 0xBE, 0x9B, 0xE5, 0x91,
+    0xFA, 0xAD, 0x91, 0xE4, 0xB1, 0x02, 0xE7, 0x0A, 0xFB, 0xA9, 0x48, 0xEF, 0x2B, 0x5F, 0xEF, 0xA8,
+    0x17, 0xF6, 0x9B, 0x2B, 0x64, 0xEC, 0x6F, 0x80, 0x38, 0x0A, 0x7E, 0x65, 0x7D, 0x34, 0x4F, 0xC4,
+    0x10, 0x04, 0x97, 0x89, 0xE5, 0x4C, 0x6A, 0x7E, 0x67, 0x90, 0x77, 0xFB, 0x84, 0x97, 0xBF, 0xB2,
+    0x84, 0xC3, 0xAD, 0x05, 0x30, 0xF5, 0xE6, 0xAD, 0x9F, 0x6B, 0x3D, 0x34, 0x91, 0x26, 0x4E, 0x67,
+    0x16, 0x49, 0x1C, 0xEC, 0x9F, 0x79, 0x6D, 0xC7, 0x19, 0xAA, 0xD7, 0xA6, 0xA5, 0x8A, 0xB9, 0x4B,
+    0xCD, 0xBA, 0xFC, 0xDE, 0xB9, 0xE1, 0x7E, 0xAC, 0x1E, 0x88, 0x91, 0x15, 0x1F, 0x7B, 0x05, 0xC4,
+    0x49, 0x16, 0xA6, 0x2F, 0x06, 0x01, 0x71, 0xBB, 0xA1, 0xD4, 0x20, 0x58, 0xB8, 0x19, 0xD3, 0x21,
+    0xF7, 0x1A, 0xE0, 0xFD, 0xBA, 0x06, 0xA8, 0xFD, 0x0A, 0x93, 0x46, 0xD0, 0x8F, 0x3A, 0x21, 0xC6,
+    0xC3, 0x13, 0xEC, 0x10, 0x85, 0x98, 0xA2, 0x1D, 0x2A, 0x12, 0x63, 0xA7, 0x70, 0x5F, 0xE1, 0x1C,
+    0x7F, 0xA4, 0x0E, 0x05, 0x36, 0xDB, 0x08, 0xEC, 0x5D, 0x9A, 0xF5, 0x6E, 0x6B, 0x85, 0x6F, 0x99,
+    0xD2, 0x33, 0x96, 0x7C, 0x35, 0x02, 0x7C, 0xDB, 0x14, 0x2F, 0x0C, 0x58, 0xBF, 0x9A, 0x35, 0xF0,
+    0x6D, 0x80, 0x9F, 0x15, 0x54, 0xEB, 0x11, 0x82, 0xF1, 0x3A, 0x34, 0x79, 0x63, 0xF3, 0x96, 0x31,
+    0x63, 0x9B, 0xE1, 0x18, 0x86, 0xF0, 0xC0, 0x4F, 0x99, 0x4D, 0xEF, 0x53, 0x10, 0xFB, 0xC6, 0xF0,
+    0x2E, 0xEC, 0xAD, 0x13, 0xFD, 0x5E, 0xD0, 0xB3, 0x13, 0x90, 0x9B, 0xC0, 0xA9, 0xC7, 0x31, 0xFE,
+    0xB5, 0x60, 0xB3, 0x79, 0xAE, 0xF5, 0xA0, 0xD6, 0x02, 0x93, 0x54, 0xE6, 0x7E, 0x01, 0x1C, 0x01,
+    0xEA, 0xAB, 0xE2, 0x8D, 0x15, 0x42, 0x6E, 0x1B, 0x08, 0xE6, 0x04, 0xDC, 0xEF, 0xE5, 0xE2, 0x4E,
+    0xB3, 0xD2, 0x6B, 0x63, 0x15, 0xD4, 0xFC, 0xB1, 0x3D, 0xA8, 0x63, 0xE5, 0xB5, 0x49, 0xE9, 0x4E,
+    0xE1, 0x25, 0x18, 0xCB, 0x0A, 0x40, 0x4E, 0x00, 0x95, 0x40, 0xC3, 0xDF, 0x18, 0x83, 0x73, 0x25,
+    0x45, 0x5A, 0x6F, 0x9F, 0xC3, 0xDD, 0x91, 0xCD, 0x5B, 0x45, 0x1A, 0x56, 0x09, 0x00, 0xC4, 0x65,
+    0x5C, 0xD2, 0x43, 0x87, 0x13, 0x84, 0xD7, 0x0A, 0xFA, 0x40, 0xE4, 0x77, 0x0F, 0x50, 0x24, 0x77,
+    0x14, 0x2B, 0x42, 0x66, 0x41, 0x61, 0x32, 0xB6, 0x28, 0xCB, 0x3E, 0x64, 0xC6, 0x3D, 0x93, 0xCE,
+    0xB2, 0x00, 0xE0, 0x4B, 0xE5, 0x97, 0xFD, 0x2E, 0xC3, 0xAB, 0x79, 0x96, 0x2D, 0xD7, 0x45, 0xF9,
+    0xFD, 0x3B, 0xF8, 0x0D, 0x55, 0xD2, 0x45, 0x93, 0xA4, 0xC1, 0xBF, 0xCA, 0xB1, 0xF2, 0x8E, 0x9B,
+    0x3E, 0xB3, 0x6D, 0xCC, 0xFF, 0x73, 0x90, 0xBE, 0x17, 0xB0, 0x34, 0x2C, 0x87, 0x62, 0xE6, 0x64,
+    0x16, 0x33, 0x97, 0x2D, 0x7F, 0xB9, 0xE1, 0x95, 0x8E, 0xDE, 0xCF, 0xBD, 0x27, 0x38, 0x07, 0xF9,
+    0xDE, 0x72, 0x71, 0xC0, 0x17, 0xD0, 0x15, 0xD0, 0x13, 0xC0, 0x11, 0x8C, 0xC2, 0xFF, 0xAF, 0xAD,
+    0x57, 0xBD, 0x8F, 0xDC, 0xC6, 0x15, 0x7F, 0x24, 0x4F, 0xA6, 0x21, 0x16, 0x73, 0x85, 0xCE, 0xF1,
+    0x37, 0x53, 0xB8, 0xB8, 0xC8, 0xC6, 0xD1, 0x85, 0x0D, 0x28, 0xC8, 0x49, 0x33, 0x89, 0x0A, 0x17,
+    0x29, 0xBC, 0x85, 0xAF, 0x89, 0x8B, 0xA4, 0x50, 0x61, 0x21, 0x85, 0x53, 0xA6, 0x90, 0x76, 0x68,
+    0x5F, 0xE1, 0xD2, 0xF7, 0x0F, 0x04, 0x38, 0x20, 0x17, 0x20, 0x58, 0x20, 0x50, 0x0A, 0x17, 0x2A,
+    0xB4, 0xE2, 0x9C, 0x54, 0xA8, 0x50, 0x61, 0xDA, 0x2E, 0x53, 0x98, 0xCE, 0x47, 0x95, 0x42, 0x63,
+    0x88, 0x06, 0x68, 0x99, 0xE4, 0xE4, 0xF7, 0x86, 0xDC, 0xCB, 0xAE, 0x4F, 0x38, 0x9D, 0x83, 0xCC,
+    0x17, 0x67, 0xE7, 0xBD, 0x99, 0x37, 0xEF, 0x7B, 0x96, 0x28, 0x52, 0x54, 0x16, 0x76, 0xBF, 0xFC,
+    0x23, 0xED, 0x9F, 0x58, 0xB9, 0xC4, 0xF4, 0x22, 0xC9, 0xE6, 0xC5, 0xCD, 0x78, 0x93, 0x4E, 0xAE,
+    0xB4, 0xF1, 0x8E, 0xEE, 0x50, 0xDB, 0xC5, 0x97, 0x77, 0x3B, 0xE7, 0x14, 0xF7, 0xD9, 0x6C, 0xA6,
+    0x68, 0x28, 0xD2, 0x71, 0x59, 0x7C, 0xCE, 0xCF, 0xB8, 0xD0, 0xAD, 0xA8, 0xFC, 0xBF, 0xB4, 0xF7,
+    0xC2, 0xBD, 0x8D, 0x9D, 0x77, 0xA4, 0xEB, 0x30, 0x7A, 0x5A, 0xDD, 0xF9, 0xD9, 0x9F, 0x13, 0x23,
+    0x4C, 0x96, 0x4B, 0xA5, 0xA9, 0xA0, 0x0D, 0x12, 0x65, 0x6A, 0x32, 0x23, 0x95, 0xA4, 0x4B, 0x74,
+    0x0E, 0x2B, 0x9A, 0xA4, 0xCA, 0xF2, 0x34, 0x17, 0x26, 0x50, 0xE2, 0xB3, 0x56, 0x7C, 0xDE, 0xA6,
+    0x77, 0x9A, 0x6C, 0xB7, 0x96, 0x91, 0x95, 0x71, 0x79, 0x2E, 0x50, 0x85, 0xA8, 0x74, 0x62, 0xE5,
+    0x5B, 0x36, 0xDB, 0xB5, 0xE9, 0x87, 0xB5, 0x30, 0x4D, 0xA0, 0x26, 0x01, 0xD8, 0x43, 0x6B, 0x7C,
+    0xAB, 0xA9, 0x70, 0x35, 0xDA, 0xD5, 0x6F, 0x0F, 0x30, 0xE7, 0xD6, 0xAC, 0xB6, 0x96, 0x82, 0x45,
+    0xA3, 0xA3, 0x76, 0x93, 0xAE, 0x76, 0x07, 0x85, 0x6B, 0xD0, 0x30, 0x5F, 0x5E, 0x1F, 0x16, 0xAF,
+    0xF6, 0x07, 0xCB, 0xEB, 0x69, 0x25, 0x9B, 0xA2, 0x75, 0xA8, 0x45, 0x2B, 0xEB, 0xB3, 0x7B, 0x13,
+    0xC6, 0xA4, 0x42, 0x51, 0x01, 0xF2, 0x3D, 0x15, 0x0D, 0x15, 0x25, 0xCD, 0x69, 0x54, 0xDB, 0x16,
+    0x41, 0xF0, 0xAA, 0xA0, 0x35, 0xCC, 0xAE, 0x53, 0x91, 0x3B, 0xDF, 0xB5, 0xEA, 0xB1, 0xB2, 0x8E,
+    0xB5, 0x22, 0x2F, 0x72, 0xAD, 0xD6, 0x80, 0x59, 0xD4, 0xFB, 0xB4, 0x7F, 0x0A, 0x43, 0xD0, 0x0D,
+    0x6D, 0x3E, 0xB1, 0xB2, 0xCA, 0xED, 0xA2, 0x9E, 0xA5, 0x93, 0xAA, 0xC7, 0xAD, 0x0C, 0x71, 0x3D,
+    0x0D, 0x6E, 0x61, 0xE9, 0x75, 0xAE, 0xA7, 0xC1, 0x1D, 0x4A, 0xDC, 0x51, 0x5C, 0xE2, 0x9B, 0x3A,
+    0x12, 0x86, 0xAD, 0xE1, 0x46, 0x9E, 0xB1, 0x15, 0x4A, 0x61, 0x24, 0xC3, 0x2F, 0x09, 0x33, 0xF7,
+    0xDF, 0xE4, 0xB0, 0x19, 0x7E, 0xDF, 0xB5, 0xDE, 0x42, 0xC5, 0xBD, 0xAF, 0x3A, 0xCA, 0xF2, 0xEC,
+    0xC6, 0xA7, 0xF7, 0x5D, 0xEE, 0xAC, 0x70, 0xE9, 0xDB, 0x0F, 0xEE, 0x3C, 0x6A, 0xE2, 0x4E, 0xA6,
+    0x6F, 0xFD, 0xC3, 0x42, 0x1B, 0xF3, 0xEC, 0xB2, 0xFF, 0xB6, 0xD9, 0xE5, 0x87, 0xD5, 0x2D, 0x0A,
+    0xEB, 0xE1, 0x1B, 0x57, 0x99, 0x87, 0x0B, 0x23, 0x3E, 0xFD, 0xE2, 0x1B, 0xA8, 0x2C, 0x4F, 0xDC,
+    0xA1, 0xAB, 0x49, 0x52, 0x08, 0xD9, 0x97, 0x74, 0xBC, 0x2C, 0xAE, 0xB8, 0x74, 0x4B, 0x7F, 0x51,
+    0x93, 0x8D, 0xEE, 0xB2, 0xB8, 0xEB, 0x30, 0x9D, 0x8F, 0xD3, 0x69, 0x52, 0xB6, 0x47, 0xAB, 0x77,
+    0xEC, 0xD1, 0xF4, 0xDE, 0x57, 0x3D, 0xEE, 0x1D, 0x37, 0x38, 0x01, 0x57, 0x37, 0xAE, 0xCE, 0x7A,
+    0x12, 0xEE, 0xD7, 0x1F, 0x3F, 0xF8, 0xBC, 0x6F, 0x65, 0xA1, 0x98, 0x81, 0x8F, 0x70, 0xC1, 0x69,
+    0x9A, 0x7B, 0x1E, 0x1E, 0xDA, 0xF9, 0x9C, 0x69, 0xB6, 0x47, 0x53, 0xCF, 0xC9, 0x30, 0x8D, 0x6C,
+    0xBA, 0x8B, 0xE9, 0x14, 0x53, 0x38, 0xD0, 0xDF, 0xFE, 0xFE, 0x6D, 0x2B, 0xDF, 0xCF, 0x3D, 0x4B,
+    0xC6, 0x35, 0x99, 0xA3, 0x91, 0xAB, 0x2A, 0x69, 0x97, 0x19, 0x0A, 0xEB, 0xD8, 0x0A, 0x93, 0xE6,
+    0x12, 0x56, 0x77, 0x05, 0xBF, 0x34, 0xC5, 0xB6, 0x23, 0x71, 0x08, 0x61, 0xEC, 0x5A, 0x82, 0x43,
+    0xD1, 0x75, 0x1C, 0x78, 0xE5, 0x2C, 0x63, 0xEA, 0xA4, 0x04, 0x30, 0x35, 0x80, 0x4A, 0x05, 0xF0,
+    0x94, 0xE1, 0x2D, 0x10, 0x0E, 0x6B, 0x60, 0x04, 0x7B, 0x84, 0x05, 0x25, 0x4C, 0x52, 0x46, 0x16,
+    0x3E, 0x75, 0x05, 0x4C, 0x13, 0xBC, 0x90, 0xC4, 0x9D, 0x9A, 0x98, 0xFF, 0xC8, 0x5E, 0x87, 0xAF,
+    0x65, 0xC4, 0xA7, 0x4D, 0x93, 0xCF, 0x5A, 0x06, 0x76, 0x0C, 0x95, 0x0C, 0x4E, 0x15, 0xE0, 0x20,
+    0x55, 0x67, 0x51, 0x39, 0x9C, 0x86, 0x62, 0x29, 0xA8, 0x29, 0x6A, 0x29, 0xFE, 0x0B, 0x09, 0x41,
+    0x2F, 0x27, 0x6A, 0x3B, 0x32, 0xD7, 0xC2, 0x12, 0x1E, 0x81, 0xEB, 0x52, 0xCF, 0x20, 0x61, 0x29,
+    0x03, 0x1D, 0xC3, 0x13, 0x08, 0x32, 0xE8, 0x88, 0x6E, 0x13, 0xBD, 0x42, 0x01, 0x34, 0x94, 0x33,
+    0x08, 0xEB, 0x40, 0x23, 0xC7, 0x2D, 0x6C, 0x29, 0xA9, 0xE1, 0x99, 0x10, 0x3A, 0x85, 0xA3, 0x04,
+    0xD6, 0xE0, 0xAB, 0x2A, 0xA3, 0x2E, 0xB4, 0xD2, 0x74, 0x89, 0x15, 0xF6, 0xBD, 0xCC, 0x60, 0x43,
+    0x01, 0x7C, 0xA0, 0x93, 0xBC, 0x6F, 0xE9, 0x27, 0xC2, 0x99, 0xFD, 0x22, 0x72, 0x51, 0x5B, 0x84,
+    0x18, 0xA6, 0xB0, 0x92, 0x86, 0xB2, 0x2F, 0xA1, 0xC7, 0x22, 0x6A, 0xF8, 0xD0, 0x9E, 0x12, 0xBB,
+    0x2E, 0xF3, 0xCC, 0xB4, 0xA2, 0x92, 0xD4, 0x47, 0xF6, 0x69, 0xEA, 0xE0, 0x26, 0x90, 0x28, 0xE9,
+    0x0F, 0xFA, 0xE2, 0x83, 0x1E, 0xA3, 0xFE, 0x79, 0x0F, 0x77, 0xF6, 0xAD, 0x93, 0x68, 0x34, 0xB4,
+    0x56, 0xD2, 0xA8, 0x90, 0x2D, 0xBA, 0x59, 0x30, 0xB2, 0x03, 0x02, 0x3B, 0x3D, 0x51, 0xE2, 0x72,
+    0x44, 0x29, 0xED, 0xDA, 0x9F, 0x7D, 0xDD, 0x46, 0xB6, 0x8B, 0x6C, 0x1B, 0x3D, 0x6C, 0x23, 0x67,
+    0x23, 0x67, 0xA2, 0x9E, 0xE9, 0x86, 0xCD, 0xC8, 0x44, 0xF0, 0x09, 0x33, 0x89, 0xC6, 0x57, 0x5E,
+    0xA7, 0x8D, 0x9D, 0x9D, 0x09, 0x02, 0x76, 0xC5, 0x9D, 0xC1, 0xBF, 0x23, 0xBA, 0xB0, 0x4D, 0xF4,
+    0x57, 0xA1, 0xA2, 0x32, 0x7A, 0x84, 0x18, 0xF4, 0x3E, 0x62, 0xDE, 0xAB, 0x07, 0x30, 0x08, 0x18,
+    0x71, 0x1E, 0x9B, 0xD7, 0x20, 0x6A, 0xE0, 0xBC, 0xB1, 0x4E, 0x9E, 0x2E, 0x0B, 0x1E, 0x52, 0x8E,
+    0x60, 0x49, 0x8A, 0x04, 0xD1, 0x4B, 0x44, 0xD8, 0xFD, 0xFB, 0x25, 0x7D, 0xFC, 0x61, 0xD4, 0xC7,
+    0x6B, 0x91, 0xB9, 0x10, 0xB2, 0x43, 0x8C, 0x96, 0x3E, 0x7E, 0xAE, 0xF9, 0x71, 0xEF, 0xDA, 0x19,
+    0x1F, 0x34, 0x6E, 0xF7, 0x63, 0x6A, 0xE1, 0xCF, 0xAF, 0xDC, 0x9F, 0xBC, 0xDD, 0x39, 0xEF, 0x30,
+    0xF1, 0x03, 0xEF, 0x42, 0xE2, 0x9E, 0xF7, 0x09, 0x36, 0x39, 0x38, 0x4B, 0x10, 0x28, 0x70, 0x31,
+    0x25, 0x1F, 0x48, 0x2F, 0xFA, 0xCF, 0xE4, 0xE2, 0x53, 0xB4, 0x77, 0xEB, 0xD9, 0xE2, 0xB6, 0x23,
+    0xD7, 0x77, 0x38, 0x2A, 0x70, 0xAE, 0xE7, 0xA3, 0xDE, 0x75, 0x07, 0x81, 0xCB, 0x29, 0x72, 0x14,
+    0x7D, 0x57, 0x52, 0xF2, 0xA5, 0x11, 0x5F, 0x58, 0x4A, 0xEF, 0x57, 0x6C, 0x74, 0xD9, 0xE5, 0x2A,
+    0x50, 0x8A, 0xC2, 0x80, 0x36, 0x26, 0x05, 0xA2, 0x30, 0x42, 0x2E, 0xB8, 0x25, 0x62, 0x5F, 0xBD,
+    0x34, 0x9C, 0x1E, 0x60, 0x09, 0xD6, 0x8A, 0x48, 0x40, 0xDE, 0x9B, 0x19, 0x24, 0x47, 0x3E, 0xBE,
+    0x07, 0x62, 0x1F, 0x5C, 0x80, 0x64, 0xA3, 0x1B, 0x7D, 0xA0, 0x69, 0xA9, 0x4E, 0x34, 0xAF, 0x4D,
+    0x56, 0xD6, 0x0E, 0x74, 0x03, 0xCC, 0x5A, 0x37, 0xBF, 0x6D, 0xC2, 0xA5, 0xFA, 0x0C, 0x63, 0x36,
+    0x3F, 0x5A, 0x59, 0x7B, 0xD5, 0xAF, 0x0D, 0xD2, 0x83, 0xDA, 0x5F, 0xF0, 0x9A, 0x77, 0xCE, 0x42,
+    0xF9, 0x85, 0x6B, 0x7F, 0x1A, 0x76, 0x17, 0xD8, 0x88, 0x3B, 0x9F, 0x94, 0x3A, 0xD6, 0x32, 0x6B,
+    0xA1, 0xA1, 0x14, 0xD6, 0x6F, 0x49, 0x1B, 0x2A, 0x0C, 0x8C, 0x30, 0xE8, 0x19, 0x0E, 0xA3, 0x00,
+    0x5B, 0x61, 0xBD, 0x1A, 0xB9, 0x3E, 0x19, 0x55, 0xC7, 0xAD, 0x1B, 0x2D, 0x05, 0xC6, 0xCB, 0xFA,
+    0x9E, 0x1C, 0x91, 0xCD, 0x4A, 0x50, 0xCD, 0x2A, 0x10, 0xCD, 0x4A, 0xD0, 0x84, 0xF7, 0x50, 0x97,
+    0x96, 0xA0, 0x88, 0x21, 0x6A, 0x53, 0x03, 0x7A, 0x18, 0x34, 0xF2, 0x33, 0xA8, 0x21, 0x01, 0x73,
+    0xE8, 0x04, 0xAD, 0x45, 0x1C, 0x1C, 0x09, 0x25, 0x39, 0x8E, 0xCF, 0x4A, 0x90, 0xC9, 0x2A, 0x50,
+    0xC1, 0x8E, 0x75, 0x76, 0x47, 0x9F, 0x94, 0xF2, 0xA2, 0xA3, 0xE2, 0x23, 0xE7, 0x72, 0xBD, 0xEB,
+    0x9C, 0xD1, 0xBF, 0xD8, 0xCB, 0x4A, 0x0D, 0x1B, 0xAB, 0x78, 0xE0, 0x99, 0x44, 0xA6, 0x0F, 0x1C,
+    0x92, 0x3D, 0x22, 0xAD, 0x64, 0xDF, 0x95, 0x7C, 0xBA, 0xF4, 0xD2, 0x3F, 0x2A, 0x5B, 0x20, 0x81,
+    0x8C, 0x88, 0xEB, 0x15, 0xB9, 0x2C, 0x91, 0x25, 0x41, 0x62, 0x8D, 0x49, 0xF0, 0xD3, 0x84, 0xED,
+    0x6C, 0xB0, 0x35, 0x84, 0x02, 0x4E, 0xE0, 0x11, 0x24, 0x91, 0xD8, 0x41, 0x89, 0x12, 0xC7, 0xE8,
+    0x01, 0xC4, 0x9E, 0x12, 0x03, 0x24, 0x2A, 0x7E, 0x77, 0x34, 0xFC, 0xC0, 0x51, 0x17, 0xB5, 0x33,
+    0xDB, 0xD2, 0x95, 0xE8, 0x15, 0xBA, 0x1D, 0x7B, 0x35, 0x76, 0x5E, 0x07, 0xBC, 0xA7, 0xED, 0x8B,
+    0x13, 0xDA, 0x86, 0x4B, 0x3C, 0xA9, 0x7B, 0xD7, 0x9C, 0xCD, 0x72, 0x01, 0x5E, 0xA5, 0xEF, 0x77,
+    0x8D, 0x46, 0x2F, 0xBE, 0xD7, 0x79, 0x4D, 0xBA, 0x7F, 0x1B, 0xC6, 0x83, 0x4F, 0x9A, 0xD9, 0x6C,
+    0x0F, 0x3C, 0x74, 0x9E, 0x0F, 0x0B, 0x61, 0xA1, 0x9B, 0xC7, 0xF4, 0xFC, 0x91, 0x7F, 0xAE, 0xF5,
+    0xC0, 0xFB, 0x27, 0x98, 0x80, 0xED, 0x22, 0xBA, 0x72, 0x7F, 0x25, 0x0D, 0x95, 0x74, 0x10, 0x0E,
+    0x70, 0x9E, 0x29, 0xFE, 0xA5, 0xC8, 0x95, 0x14, 0x7E, 0x87, 0x00, 0xF9, 0x35, 0xAC, 0xA6, 0x82,
+    0xD6, 0xE1, 0x16, 0x5B, 0xAC, 0x8C, 0x5C, 0xAA, 0x55, 0x33, 0xE1, 0xD7, 0x95, 0xCC, 0x11, 0xE3,
+    0x4D, 0xC2, 0x4A, 0x3D, 0x29, 0x46, 0xFC, 0x8F, 0xE5, 0xB1, 0xB1, 0xE8, 0x07, 0xDE, 0x7D, 0x48,
+    0x9F, 0x3F, 0x78, 0x8F, 0x0E, 0x6B, 0x77, 0xD9, 0xBA, 0xB8, 0xC4, 0x4B, 0xC2, 0x67, 0x07, 0xEF,
+    0xD1, 0x73, 0xFF, 0xDE, 0x6B, 0xD8, 0xD9, 0xD1, 0x90, 0xB4, 0x18, 0xF8, 0x61, 0x25, 0x93, 0x7A,
+    0x9A, 0xD4, 0xF3, 0x18, 0x96, 0xA3, 0xF0, 0xF0, 0xF4, 0x0E, 0xD2, 0x2B, 0xDA, 0xE6, 0x87, 0xF0,
+    0xAC, 0x99, 0x07, 0x37, 0x10, 0x5B, 0xF1, 0xD2, 0x7A, 0x17, 0x6B, 0x67, 0x26, 0x14, 0x40, 0x5B,
+    0x49, 0xF9, 0x42, 0xFE, 0x12, 0x05, 0xD5, 0x1B, 0x90, 0xD2, 0x8F, 0x09, 0x7B, 0xF8, 0x71, 0x83,
+    0xF0, 0x99, 0xBC, 0xFD, 0x32, 0x22, 0xD3, 0x14, 0x92, 0x6C, 0x68, 0xC3, 0x7D, 0xA3, 0xB4, 0x73,
+    0x25, 0x5B, 0x43, 0x80, 0xA7, 0x46, 0x8C, 0x7D, 0xE2, 0xE3, 0x8C, 0x42, 0xF1, 0xB4, 0xC7, 0x25,
+    0x4F, 0xCA, 0x2D, 0xF5, 0x73, 0x2B, 0xD2, 0xDB, 0xF2, 0x4E, 0x84, 0xC4, 0x33, 0x46, 0xA3, 0xD5,
+    0xC2, 0x8A, 0xE9, 0x97, 0xF6, 0x6E, 0x22, 0x0C, 0x4C, 0xC5, 0x5D, 0xE4, 0xF8, 0x56, 0xFE, 0x12,
+    0x31, 0xB1, 0xD1, 0xC8, 0xF5, 0xBB, 0xB6, 0xCD, 0x94, 0x4C, 0x0E, 0xEB, 0x4B, 0x48, 0xDD, 0xBB,
+    0xF6, 0x16, 0xB2, 0x6D, 0x98, 0x1F, 0x2C, 0x28, 0xB9, 0xD5, 0xE1, 0xDC, 0x31, 0x1A, 0x7C, 0x83,
+    0x9B, 0xB8, 0x42, 0xD4, 0x15, 0x3C, 0xC8, 0xC1, 0xC9, 0x1E, 0x73, 0x11, 0xEA, 0x57, 0x8F, 0xDA,
+    0xE4, 0x5C, 0x8B, 0x68, 0x03, 0x2F, 0x0F, 0x5B, 0xBF, 0xD7, 0xCF, 0x9E, 0xC3, 0xDA, 0x6F, 0x8E,
+    0x1D, 0x70, 0x7D, 0x75, 0xEF, 0xFC, 0x18, 0x02, 0x1F, 0xB5, 0xBE, 0x74, 0x54, 0x3E, 0x1E, 0x75,
+    0x85, 0x0D, 0x83, 0x5F, 0xCB, 0xF2, 0xB1, 0xD6, 0xB7, 0xB0, 0x7A, 0x6C, 0x7F, 0x0A, 0x22, 0xC4,
+    0x53, 0x80, 0x63, 0xA8, 0x0F, 0x02, 0xC1, 0xAA, 0x2B, 0x9C, 0xA7, 0x60, 0x5F, 0x23, 0x92, 0x15,
+    0x79, 0xDC, 0x6A, 0x15, 0x35, 0x6B, 0x47, 0x81, 0x72, 0x2C, 0xC9, 0xF2, 0x7E, 0x44, 0x4A, 0x1F,
+    0xE2, 0x9E, 0x1F, 0x4C, 0x93, 0x38, 0xEC, 0x48, 0x44, 0x9E, 0xA4, 0x91, 0x71, 0x3B, 0x8E, 0x78,
+    0x61, 0xF8, 0xA8, 0x2C, 0x8F, 0x70, 0x36, 0x76, 0xF4, 0xCE, 0xCE, 0xF0, 0xD7, 0x4A, 0x0D, 0xE3,
+    0xB0, 0xB2, 0x8C, 0x13, 0x56, 0x32, 0xAC, 0x10, 0xEB, 0xFF, 0x7B, 0x0E, 0x9F, 0xCC, 0x36, 0x2D,
+    0x49, 0xD1, 0xC2, 0x05, 0x74, 0xAE, 0x8F, 0x7C, 0x79, 0x0D, 0x12, 0xD0, 0x46, 0xE7, 0x5B, 0xE3,
+    0x45, 0x9F, 0xF7, 0x3C, 0x6B, 0x75, 0x06, 0x10, 0xAD, 0x78, 0xF6, 0xDC, 0xF1, 0x59, 0xBE, 0x3C,
+    0x83, 0x7D, 0x55, 0xC3, 0xEB, 0xFC, 0x54, 0xFF, 0x0A, 0xAC, 0x79, 0x9D, 0xEB, 0xA9, 0xFE, 0x15,
+    0x54, 0xD2, 0xA4, 0x4A, 0xD0, 0x59, 0x7A, 0x32, 0xEE, 0x19, 0x38, 0x04, 0xFE, 0x07, 0x9A, 0xC5,
+    0x5D, 0x4E, 0xC2, 0x15, 0xF4, 0xA6, 0xD9, 0xDF, 0x3F, 0x9F, 0x9F, 0xE6, 0xDC, 0xDB, 0x74, 0x5A,
+    0xDE, 0xFE, 0x03, 0xED, 0x53, 0xB1, 0x8E, 0xD3, 0x40, 0x10, 0x7D, 0xBE, 0x70, 0xB6, 0x84, 0x8B,
+    0xA5, 0x20, 0x08, 0xE9, 0x8A, 0x6D, 0x68, 0xA0, 0xB8, 0xFD, 0x81, 0xB3, 0x77, 0xEE, 0x0B, 0x70,
+    0x11, 0x2A, 0x9A, 0x14, 0x47, 0x73, 0x4D, 0x6A, 0xA4, 0x24, 0x5E, 0x89, 0x0F, 0x20, 0x9F, 0x40,
+    0x41, 0x81, 0x68, 0x22, 0x9D, 0x84, 0x14, 0xC4, 0x05, 0xFB, 0x13, 0xFC, 0x09, 0x57, 0x40, 0x9F,
+    0x22, 0xC5, 0xC2, 0xAD, 0xB3, 0xCC, 0xC6, 0x51, 0x82, 0x40, 0x48, 0x88, 0x9A, 0x9D, 0x67, 0x6B,
+    0x76, 0x76, 0xC6, 0x33, 0xF3, 0x66, 0x8D, 0x02, 0xA2, 0x85, 0xF2, 0xD0, 0x23, 0x33, 0x15, 0xF5,
+    0x1E, 0x5A, 0x1A, 0xED, 0x49, 0x7A, 0x1C, 0x59, 0x0C, 0xED, 0xB0, 0xB0, 0xDD, 0x5A, 0x80, 0x57,
+    0x85, 0xC8, 0xA3, 0xE7, 0x91, 0x56, 0x10, 0x1A, 0x99, 0xC6, 0xB2, 0xA4, 0xCA, 0x37, 0x97, 0x95,
+    0x81, 0x06, 0x1E, 0xB3, 0x47, 0xE9, 0x4A, 0xB7, 0xC0, 0x47, 0xAA, 0xEC, 0x65, 0x8B, 0x1C, 0xF9,
+    0xD7, 0xA5, 0x77, 0xA3, 0x19, 0xFA, 0x21, 0x4A, 0x70, 0x2E, 0x42, 0x7E, 0x0F, 0x53, 0x8F, 0x72,
+    0x6E, 0x26, 0xA2, 0x66, 0x70, 0xF6, 0x2E, 0x57, 0x08, 0xF6, 0x35, 0x03, 0xC2, 0x40, 0x81, 0x83,
+    0x71, 0x0D, 0x38, 0x1C, 0xAD, 0xD1, 0x5B, 0x21, 0x6D, 0x70, 0xD7, 0x00, 0x5C, 0xF3, 0x06, 0xBA,
+    0xA2, 0x5C, 0x18, 0x2D, 0x89, 0xEB, 0x97, 0x1B, 0xE4, 0xCA, 0x8C, 0xD3, 0x7A, 0x2A, 0x6B, 0x2E,
+    0x3B, 0xB6, 0x5B, 0x9F, 0x16, 0xDA, 0x63, 0x22, 0x42, 0x8A, 0xAD, 0xBD, 0x4E, 0x5F, 0x1B, 0x48,
+    0xEA, 0x57, 0x50, 0x1C, 0xF2, 0x06, 0xD1, 0x0C, 0x47, 0x4D, 0x00, 0xBB, 0x31, 0x3A, 0x9D, 0x8D,
+    0xDD, 0xB6, 0xFF, 0x6C, 0xF7, 0xDE, 0x2B, 0xB1, 0x11, 0xA4, 0x90, 0xE1, 0x0C, 0xE3, 0xBD, 0x9C,
+    0x71, 0x85, 0x12, 0x82, 0x22, 0xBA, 0x60, 0xFD, 0x34, 0xE8, 0xBC, 0xDB, 0x0B, 0xEF, 0x33, 0xF6,
+    0x2A, 0x50, 0x5C, 0xE0, 0xD6, 0x63, 0x33, 0x22, 0x27, 0xC8, 0xFE, 0x84, 0x85, 0x20, 0xFC, 0xC5,
+    0x08, 0x80, 0xC8, 0x25, 0x4E, 0xB9, 0x53, 0x77, 0xC7, 0xE1, 0x20, 0xEF, 0x38, 0x56, 0x6E, 0xDB,
+    0x7C, 0xC8, 0x9C, 0x32, 0xF9, 0x25, 0xFB, 0x21, 0x59, 0x41, 0xD6, 0x6C, 0xA4, 0xD2, 0x9B, 0x27,
+    0xEF, 0xC3, 0xF7, 0xD5, 0xD6, 0xE7, 0xBE, 0x24, 0xAE, 0x27, 0x69, 0x91, 0x6C, 0xC0, 0x3C, 0x30,
+    0xC3, 0x2F, 0x47, 0xA6, 0xF4, 0x38, 0xF9, 0x82, 0xFF, 0x63, 0xFD, 0xB7, 0xB1, 0xA6, 0x2D, 0x44,
+    0x05, 0x6E, 0x2A, 0x9E, 0x1B, 0x1D, 0xBA, 0x36, 0x13, 0x9E, 0xDA, 0xAD, 0x89, 0xCF, 0x11, 0x7F,
+    0x83, 0xF4, 0x94, 0xA7, 0xB5, 0x9E, 0x87, 0x22, 0x33, 0x40, 0x9D, 0x93, 0xF0, 0x14, 0xBD, 0x40,
+    0xDC, 0xEE, 0x8E, 0xB2, 0x5E, 0x13, 0x90, 0xD4, 0xEA, 0x69, 0xCD, 0x04, 0x46, 0x6F, 0x31, 0x4E,
+    0xB7, 0xBD, 0x7F, 0x46, 0xE2, 0xD0, 0xB3, 0x10, 0x0E, 0x4A, 0x85, 0x66, 0x07, 0x11, 0x9D, 0xD8,
+    0x50, 0x30, 0xE7, 0xEA, 0x3F, 0x0F, 0x4C, 0x66, 0xA2, 0xCE, 0x25, 0x31, 0x45, 0xDC, 0x1A, 0x13,
+    0xD3, 0xE1, 0xBB, 0x83, 0xF7, 0x70, 0xF2, 0xD7, 0x6B, 0x36, 0x38, 0x06, 0xFF, 0xBA, 0x3B, 0xF0,
+    0xAD, 0xCB, 0xB1, 0xB0, 0xF8, 0x74, 0x83, 0x6A, 0x85, 0xA5, 0x45, 0xD8, 0x4A, 0xF6, 0x21, 0x7B,
+    0x58, 0x83, 0x2B, 0x5B, 0x92, 0xF7, 0xBE, 0x71, 0xEA, 0xD5, 0x8D, 0x95, 0xBD, 0xDF, 0x9E, 0xC1,
+    0x71, 0x54, 0x5C, 0xB5, 0x7F, 0x4C, 0xF7, 0xC1, 0xEE, 0x8E, 0x3A, 0x0B, 0x3B, 0x6C, 0x4A, 0xF8,
+    0x16, 0x76, 0x78, 0xA8, 0x36, 0xB5, 0xFA, 0x7A, 0x02, 0xDD, 0xA4, 0x0E, 0x93, 0x47, 0x59, 0xE9,
+    0x1E, 0xCC, 0x62, 0xE6, 0x59, 0xAD, 0xAB, 0xB5, 0xC4, 0x4E, 0x0A, 0x61, 0xA3, 0xD9, 0x0F, 0x85,
+    0x56, 0x3B, 0x6C, 0x15, 0x47, 0x14, 0xBD, 0xFB, 0x16, 0xBC, 0x52, 0x56, 0xCA, 0x36, 0x50, 0xA1,
+    0x30, 0x75, 0xA2, 0x88, 0x69, 0x29, 0x80, 0x59, 0x43, 0x41, 0xE1, 0xC2, 0x96, 0x12, 0x2B, 0x45,
+    0x24, 0x93, 0x9E, 0xC2, 0x69, 0xA2, 0x54, 0xB0, 0x6B, 0x59, 0x11, 0x85, 0xA5, 0x40, 0x97, 0x22,
+    0x05, 0x94, 0x88, 0x14, 0xA6, 0x48, 0x13, 0x89, 0xB0, 0x03, 0x56, 0x44, 0x91, 0xC2, 0x8B, 0x08,
+    0x15, 0x52, 0xBC, 0x7C, 0xA2, 0x28, 0x46, 0xCA, 0x1B, 0xD0, 0x9A, 0x3C, 0x9B, 0xDD, 0xBD, 0x39,
+    0x77, 0xF6, 0xBD, 0x67, 0x22, 0xA2, 0xE4, 0xD9, 0xE7, 0xEC, 0x67, 0x3E, 0x3B, 0x73, 0x3F, 0xE7,
+    0x0E, 0x11, 0x51, 0xC0, 0x15, 0xC5, 0xEC, 0x48, 0xE3, 0x6A, 0x2C, 0x51, 0x96, 0x02, 0xC1, 0xE2,
+    0x42, 0x16, 0x73, 0xE5, 0x31, 0xB7, 0xB3, 0x60, 0xD6, 0xA4, 0x9D, 0xCB, 0x04, 0x08, 0x00, 0x8A,
+    0x1D, 0xF5, 0xF0, 0x83, 0x7B, 0x90, 0x03, 0x5E, 0x94, 0xA4, 0x70, 0xCF, 0x5C, 0x87, 0xCC, 0x2E,
+    0x79, 0x7D, 0xEF, 0x9A, 0x7A, 0x7A, 0x2F, 0x35, 0x1B, 0x6B, 0x64, 0xEE, 0xCD, 0x93, 0x59, 0x7B,
+    0x97, 0xCC, 0xE5, 0xA3, 0x64, 0xBE, 0x7E, 0x8F, 0xCC, 0xAF, 0x1F, 0x92, 0x6E, 0x4F, 0x90, 0x6A,
+    0x8E, 0x63, 0x78, 0x51, 0x0D, 0x18, 0xE3, 0x0A, 0xE0, 0x8B, 0x1D, 0xA2, 0x9B, 0x98, 0x6A, 0x01,
+    0x0B, 0x91, 0x9F, 0xE2, 0x1C, 0xF3, 0x55, 0x98, 0xCF, 0xC6, 0x4D, 0x90, 0x27, 0xF8, 0xAC, 0x2E,
+    0xC9, 0xAF, 0xD5, 0xDC, 0x7D, 0x5A, 0x99, 0xD5, 0xD7, 0xA5, 0x59, 0x65, 0xA0, 0x25, 0xB3, 0x31,
+    0x22, 0x0D, 0xA8, 0xA7, 0x23, 0x4A, 0xFE, 0x1A, 0xA5, 0x11, 0xC6, 0x60, 0x5E, 0x4B, 0x19, 0xE6,
+    0x20, 0x59, 0x2E, 0xDB, 0x64, 0x82, 0x9D, 0x45, 0x92, 0xB9, 0xA6, 0xD8, 0xBB, 0x91, 0xE2, 0x7D,
+    0xEE, 0x31, 0x6E, 0x53, 0x3B, 0x0B, 0x58, 0x92, 0xC3, 0xF0, 0xEA, 0x1F, 0x7D, 0xFD, 0x2F, 0xDB,
+    0x25, 0xCC, 0x4D, 0x11, 0x77, 0x14, 0xD7, 0x07, 0xA6, 0x6D, 0xEB, 0x7B, 0xD7, 0x64, 0xFB, 0xFE,
+    0x2A, 0xCF, 0x72, 0x2F, 0xF0, 0xED, 0x58, 0x77, 0x96, 0xCB, 0x3B, 0xB6, 0x13, 0x60, 0xA6, 0x77,
+    0xFC, 0x4E, 0x95, 0x9F, 0xF5, 0x14, 0xD1, 0x07, 0xF1, 0x08, 0x73, 0x9B, 0x0C, 0xAD, 0xB9, 0x61,
+    0xE9, 0x63, 0x5C, 0x51, 0x9B, 0xD2, 0x58, 0x53, 0xA9, 0xCA, 0x58, 0x5D, 0x26, 0x95, 0xC9, 0xB5,
+    0xDD, 0x67, 0xE3, 0xB9, 0xF0, 0xCC, 0xC2, 0x2B, 0x9E, 0x57, 0x3D, 0x5F, 0x12, 0xA6, 0x24, 0xDF,
+    0xFF, 0xC6, 0x31, 0x7F, 0x5B, 0x25, 0xB9, 0x72, 0x40, 0x0D, 0x8C, 0x80, 0x5B, 0xC0, 0x85, 0x24,
+    0x2F, 0x78, 0xBD, 0xC2, 0x37, 0x9D, 0xBA, 0x7A, 0x2E, 0x57, 0xF3, 0xF3, 0xB9, 0xDC, 0x17, 0xF2,
+    0x7C, 0x66, 0x2B, 0x57, 0xA7, 0x87, 0xB9, 0x9A, 0xE5, 0x5C, 0xA5, 0x13, 0x64, 0xB9, 0xE9, 0x64,
+    0xF5, 0x06, 0x3B, 0x14, 0x6E, 0x85, 0x2F, 0xB1, 0x70, 0xDE, 0x73, 0x11, 0x59, 0xE1, 0x58, 0x98,
+    0x93, 0x87, 0x64, 0xBE, 0xED, 0x32, 0x46, 0xCF, 0x86, 0x85, 0xDD, 0x32, 0xDE, 0xFC, 0x41, 0x4A,
+    0x5A, 0xFF, 0x8D, 0xF7, 0x52, 0x70, 0xC2, 0xC2, 0x21, 0x8F, 0x0D, 0x3F, 0xF9, 0xA2, 0xF3, 0x3C,
+    0x12, 0xFE, 0xA6, 0x11, 0x9E, 0x6D, 0x66, 0x3A, 0x61, 0x0D, 0x8B, 0xCD, 0x36, 0xF0, 0xB9, 0x39,
+    0xD3, 0x14, 0x81, 0xAC, 0xAD, 0x90, 0x9E, 0x65, 0x56, 0x82, 0xAD, 0x46, 0x9C, 0x5C, 0x2D, 0x63,
+    0xCC, 0x39, 0xEF, 0xA8, 0xB0, 0x66, 0xAE, 0x26, 0x6D, 0xCD, 0x19, 0x44, 0x8D, 0x35, 0xA7, 0x9B,
+    0x1F, 0x32, 0x6B, 0xD2, 0xAE, 0x40, 0x6B, 0xCA, 0x59, 0x3B, 0xFE, 0xE2, 0x85, 0xA0, 0x09, 0xAB,
+    0x8B, 0x03, 0x90, 0x09, 0x9B, 0x08, 0xD4, 0x46, 0xA5, 0x09, 0xFF, 0x8C, 0xAD, 0x8E, 0x84, 0xCE,
+    0x6E, 0x25, 0x56, 0xCD, 0x5D, 0x16, 0xDB, 0xF5, 0xC6, 0x42, 0xE4, 0x6F, 0xCE, 0x5F, 0x4D, 0xE3,
+    0xAD, 0x78, 0x9D, 0x40, 0x43, 0x8A, 0x86, 0x51, 0x47, 0x61, 0x17, 0x82, 0xDA, 0xB0, 0x15, 0x6A,
+    0x68, 0xD0, 0x0C, 0x1A, 0x44, 0xD7, 0xB3, 0x60, 0xC4, 0xDC, 0x05, 0x30, 0x07, 0xAF, 0x34, 0x2D,
+    0xE9, 0x3B, 0x4D, 0x7B, 0x30, 0xB9, 0xDF, 0xB4, 0x7A, 0xED, 0xF1, 0xFF, 0xD3, 0x13, 0xD0, 0x57,
+    0x1F, 0x8D, 0x5A, 0x9D, 0x47, 0x75, 0xAB, 0xB7, 0x0B, 0xD7, 0x22, 0x4D, 0x2D, 0xC8, 0xFB, 0xC1,
+    0x7A, 0x68, 0x6E, 0x3C, 0x0E, 0x67, 0xBF, 0xC8, 0x73, 0xD8, 0x69, 0xAB, 0x78, 0x68, 0x11, 0x59,
+    0x36, 0x2B, 0x0B, 0x5B, 0x20, 0x7A, 0x38, 0xD5, 0x53, 0xC8, 0x73, 0x86, 0x3F, 0x69, 0x57, 0x5C,
+    0xD8, 0xA8, 0x53, 0x76, 0x6C, 0x06, 0x38, 0x82, 0x3D, 0x68, 0x06, 0xF9, 0xA4, 0xE1, 0x00, 0x68,
+    0xC1, 0x80, 0x67, 0x73, 0xEC, 0x86, 0x22, 0x04, 0x80, 0xDE, 0xBB, 0x2E, 0x9E, 0xF5, 0x57, 0x89,
+    0x77, 0x89, 0x0A, 0x41, 0x8C, 0xB6, 0x10, 0x8E, 0x1A, 0x74, 0x94, 0xCA, 0x18, 0x24, 0x14, 0x34,
+    0x04, 0x90, 0x39, 0xCB, 0xD8, 0x25, 0x95, 0x92, 0x98, 0x46, 0x9C, 0x16, 0x94, 0x54, 0x1D, 0x25,
+    0x4F, 0x1A, 0x4A, 0x7E, 0x47, 0xCE, 0x0C, 0xAB, 0x69, 0xAE, 0x2C, 0xF3, 0x6E, 0x9A, 0x48, 0x5E,
+    0x4B, 0x9B, 0xF4, 0xA9, 0x8A, 0xB4, 0x1F, 0x23, 0xF9, 0x90, 0x38, 0xA4, 0x4B, 0x55, 0x8C, 0x63,
+    0xF5, 0x70, 0xF6, 0x30, 0x25, 0xFD, 0x13, 0x16, 0x34, 0x04, 0x60, 0x0B, 0x5D, 0x79, 0x53, 0x0C,
+    0x78, 0x13, 0x9F, 0xED, 0x68, 0xA0, 0xEB, 0xDE, 0x3C, 0x85, 0x45, 0xFE, 0x02, 0xCB, 0xB8, 0xD7,
+    0x63, 0xF4, 0xBF, 0x23, 0xFC, 0xCC, 0x27, 0x39, 0xFB, 0xA8, 0x33, 0x7D, 0xA2, 0x1E, 0xA2, 0x4C,
+    0x82, 0x2E, 0xB8, 0x9E, 0x48, 0xB4, 0x0F, 0x9A, 0x48, 0x82, 0x2F, 0x1C, 0x85, 0xFE, 0x52, 0x8B,
+    0x15, 0x28, 0x72, 0xFE, 0x12, 0xBB, 0x70, 0x34, 0x73, 0x05, 0x46, 0x88, 0x46, 0xA6, 0xC5, 0x5A,
+    0x63, 0x27, 0xA6, 0x2B, 0x93, 0x97, 0x23, 0x9D, 0x22, 0xCE, 0x1E, 0x38, 0x95, 0xEA, 0xBB, 0xBC,
+    0xEA, 0x74, 0x6A, 0xB8, 0x8B, 0xEA, 0x4C, 0xCC, 0x24, 0x2B, 0xCB, 0xBA, 0x34, 0x19, 0xD6, 0xDE,
+    0x2E, 0xFD, 0x52, 0xC6, 0xC6, 0x57, 0x3E, 0x7D, 0x49, 0xF7, 0x9A, 0x68, 0xE8, 0xCD, 0x0B, 0x3E,
+    0xDA, 0x89, 0x4C, 0x5A, 0x89, 0x71, 0x32, 0x73, 0x15, 0x65, 0x67, 0x01, 0x5C, 0xCD, 0x1A, 0xB0,
+    0x69, 0x7D, 0x5B, 0xC2, 0xBE, 0x5F, 0x20, 0xE1, 0xB7, 0x01, 0xC9, 0x7A, 0xE4, 0x5D, 0x99, 0x6B,
+    0x36, 0xF6, 0xE4, 0x05, 0x55, 0xDE, 0x3A, 0x0E, 0x91, 0x78, 0x53, 0xE4, 0xA4, 0x2E, 0x0C, 0x30,
+    0x2E, 0xE8, 0x30, 0xFC, 0x0A, 0xD0, 0x02, 0x4C, 0xAA, 0x2C, 0xF6, 0x25, 0xA1, 0xD4, 0x76, 0x79,
+    0xBB, 0xE8, 0xE5, 0x02, 0xEF, 0xD5, 0x36, 0x8F, 0xFB, 0x55, 0xE8, 0x47, 0x6F, 0x81, 0x02, 0x27,
+    0x86, 0x15, 0x9F, 0x36, 0x90, 0xF3, 0x3A, 0xE9, 0xDC, 0xE7, 0xFA, 0x85, 0x23, 0x73, 0x1F, 0x12,
+    0x7B, 0x07, 0x58, 0x41, 0x42, 0xCE, 0x72, 0x23, 0xC8, 0x04, 0x2B, 0x2F, 0x1B, 0x73, 0x07, 0x78,
+    0xFC, 0xB2, 0x51, 0xBB, 0x2F, 0x1B, 0xC8, 0x77, 0x03, 0xC9, 0x6D, 0xE0, 0x95, 0x67, 0x7E, 0x2E,
+    0x81, 0x77, 0x85, 0xF2, 0x2A, 0xE0, 0x45, 0x40, 0x22, 0x3F, 0xBB, 0x0D, 0xEA, 0x32, 0x4F, 0x12,
+    0x70, 0x58, 0xF7, 0x77, 0x5D, 0xB1, 0x0D, 0x1F, 0x41, 0x81, 0xCF, 0xEF, 0xAD, 0xEF, 0xF5, 0xEF,
+    0xD4, 0x6F, 0x9F, 0xEC, 0xC2, 0xC0, 0x70, 0x9F, 0xB1, 0xC8, 0x45, 0x93, 0x07, 0xAD, 0x94, 0xBF,
+    0x8E, 0x60, 0xAA, 0xC2, 0x1B, 0x76, 0x80, 0xE0, 0x55, 0x70, 0x0B, 0x2C, 0x95, 0xC6, 0x69, 0x66,
+    0x27, 0x49, 0x75, 0xE3, 0x06, 0xFB, 0x5D, 0x07, 0xD8, 0x6D, 0xE8, 0x37, 0xD4, 0x5B, 0x64, 0x12,
+    0x43, 0xBA, 0x9A, 0x91, 0x42, 0x62, 0xA5, 0xE0, 0x04, 0xDC, 0xF5, 0x5E, 0x93, 0xD5, 0x6A, 0x4E,
+    0x51, 0x40, 0x1D, 0x0A, 0x53, 0x95, 0xEC, 0xBE, 0xB2, 0xFA, 0x31, 0x76, 0x3F, 0xDE, 0x79, 0x36,
+    0x2B, 0xBB, 0xEF, 0x21, 0xF7, 0xF2, 0x4E, 0xDA, 0xC4, 0x3A, 0x6A, 0xF7, 0xC5, 0x15, 0x29, 0xBE,
+    0x61, 0x9F, 0x3C, 0xF9, 0x74, 0xF7, 0xD7, 0x66, 0x52, 0x1A, 0x40, 0xC5, 0x29, 0x74, 0x3A, 0xA7,
+    0x78, 0xAF, 0xD8, 0x4E, 0xA5, 0x64, 0xA4, 0x52, 0x3C, 0xD2, 0xD8, 0xA1, 0xD8, 0xC4, 0xCE, 0xFC,
+    0x37, 0x59, 0xA1, 0xD7, 0x79, 0xEC, 0x50, 0x68, 0x63, 0x07, 0x5D, 0xA4, 0x37, 0x7E, 0x22, 0x81,
+    0xBE, 0x82, 0x62, 0x27, 0x10, 0xE2, 0xFA, 0x08, 0x0C, 0x5E, 0xD1, 0x84, 0xC4, 0xEA, 0x91, 0x94,
+    0xD6, 0x81, 0x97, 0xFF, 0xAC, 0x9B, 0x3C, 0x23, 0xB1, 0xDE, 0x3F, 0x76, 0x54, 0x59, 0x2C, 0x63,
+    0xB3, 0xFC, 0x72, 0x63, 0x63, 0xD3, 0x9A, 0x8D, 0x8D, 0x61, 0x1E, 0xF3, 0x73, 0xA6, 0x70, 0x88,
+    0xCE, 0xE1, 0xEA, 0x86, 0xED, 0x49, 0xF2, 0x16, 0x90, 0xFC, 0x75, 0x87, 0x17, 0x17, 0x17, 0xC6,
+    0x59, 0xB7, 0xFF, 0x2E, 0x7B, 0xB8, 0x30, 0x91, 0xB2, 0xFF, 0x02, 0xFA, 0x4A, 0xB2, 0x16, 0x29,
+    0x1E, 0x32, 0xEE, 0xE4, 0x1E, 0x9E, 0xC8, 0xF2, 0xF3, 0x4C, 0xD9, 0xC8, 0xEB, 0x60, 0x29, 0x61,
+    0x8D, 0x94, 0x45, 0x06, 0x04, 0xE2, 0xE1, 0x9C, 0x4C, 0x19, 0x39, 0x49, 0x59, 0xE0, 0xC5, 0x4D,
+    0xAC, 0xDC, 0x61, 0x9B, 0x38, 0x6C, 0x60, 0x2F, 0xFC, 0xCA, 0xD1, 0x59, 0x3C, 0x2B, 0xF8, 0x8E,
+    0x5D, 0x5C, 0x3D, 0x87, 0x46, 0x45, 0x2E, 0x29, 0x7B, 0x18, 0x1B, 0xB9, 0x22, 0x95, 0xCA, 0x1F,
+    0xA1, 0xFE, 0x44, 0x48, 0x8F, 0xE9, 0x4F, 0x89, 0x40, 0x1C, 0xBF, 0x05, 0xBA, 0x79, 0x12, 0xF4,
+    0xFD, 0x29, 0x31, 0xC6, 0xA4, 0x92, 0xD7, 0xC8, 0x20, 0x6E, 0x82, 0x8B, 0x8B, 0x8B, 0xB7, 0xE9,
+    0x14, 0x8E, 0x0C, 0x74, 0xEA, 0xD8, 0x89, 0x44, 0xC4, 0xE5, 0x28, 0xE9, 0x07, 0xCF, 0x11, 0x81,
+    0xC1, 0x0A, 0x0E, 0x0F, 0x62, 0xCF, 0xAD, 0x67, 0x01, 0x24, 0x45, 0xC4, 0x27, 0xF0, 0x0A, 0xA4,
+    0x27, 0xC5, 0x8F, 0x24, 0xB4, 0xA9, 0x7B, 0x9B, 0x34, 0xFB, 0xF3, 0x88, 0x3F, 0xC0, 0x20, 0x10,
+    0xEB, 0x4E, 0x8D, 0x8C, 0xED, 0xC2, 0x26, 0x4B, 0xBB, 0xA0, 0x2D, 0xD0, 0xC5, 0x53, 0x57, 0xD0,
+    0x8F, 0x42, 0xF4, 0x16, 0xC5, 0x18, 0x3F, 0x3E, 0x1B, 0xB9, 0x64, 0x67, 0xB9, 0x16, 0xE9, 0x1A,
+    0xA3, 0x4E, 0xEA, 0x65, 0xE8, 0x97, 0x0F, 0x79, 0xD4, 0xB8, 0xDD, 0xA9, 0x4C, 0xB0, 0x2F, 0x01,
+    0xCE, 0x9F, 0x93, 0xA6, 0x67, 0xA3, 0xE0, 0x80, 0xE8, 0xDF, 0x92, 0xC4, 0x47, 0xE7, 0x37, 0x5F,
+    0xC1, 0x42, 0x48, 0xDA, 0x84, 0xCF, 0xC1, 0x25, 0x8F, 0x96, 0x8A, 0xD4, 0xFC, 0xBC, 0x04, 0x1F,
+    0xAD, 0x2D, 0xA1, 0xD8, 0xCC, 0x2D, 0xE9, 0x12, 0x04, 0xF5, 0x98, 0x3D, 0x70, 0x30, 0xCD, 0xD2,
+    0x71, 0xD9, 0xEA, 0x85, 0xD8, 0x4F, 0x17, 0x76, 0xFE, 0x0C, 0x88, 0x70, 0xD6, 0x53, 0x0A, 0x0E,
+    0x52, 0x78, 0x59, 0xFE, 0x51, 0xA7, 0xFD, 0xB2, 0x46, 0xFC, 0x69, 0xC3, 0xE1, 0xE4, 0x9F, 0x6B,
+    0xA4, 0x89, 0x70, 0xD4, 0xF0, 0xA0, 0xE5, 0xA0, 0x15, 0x8E, 0x5A, 0x96, 0x33, 0x07, 0xF6, 0x91,
+    0xF6, 0x63, 0x31, 0x09, 0x15, 0x55, 0xCC, 0x38, 0x2E, 0xE0, 0x70, 0xF5, 0x19, 0x02, 0x07, 0x36,
+    0x9E, 0xFE, 0xE3, 0x31, 0xB3, 0x87, 0x70, 0xBC, 0x48, 0x78, 0xD4, 0x47, 0x37, 0xC9, 0x7E, 0x31,
+    0x43, 0xB3, 0xB8, 0xF8, 0xF1, 0xDF, 0x63, 0x60, 0x60, 0x60, 0xF8, 0xFF, 0xFF, 0xBF, 0x03, 0x08,
+    0x67, 0xAD, 0x5A, 0xC5, 0x00, 0x00, 0x85, 0xCF, 0xB1, 0x15, 0xC3, 0x20, 0x0C, 0x04, 0xD0, 0x73,
+    0x0A, 0x53, 0x50, 0x68, 0x04, 0x46, 0x11, 0x1B, 0x65, 0x04, 0x33, 0x82, 0x37, 0x82, 0x11, 0x18,
+    0x81, 0x11, 0x28, 0xDC, 0xC4, 0x05, 0x17, 0x29, 0x69, 0xD2, 0xE5, 0x8A, 0x5F, 0x70, 0x3C, 0x21,
+    0x00, 0xCB, 0x56, 0x5F, 0x40, 0x24, 0x3B, 0x12, 0x39, 0xA1, 0x5D, 0x8C, 0xE6, 0x14, 0xB9, 0x4F,
+    0x2D, 0x07, 0x87, 0x16, 0x3A, 0xDF, 0xB3, 0xFF, 0xC4, 0x65, 0x97, 0x03, 0xA7, 0x96, 0x8D, 0x03,
+    0xBF, 0xF1, 0xA7, 0x10, 0xC8, 0x06, 0x08, 0xBD, 0x93, 0x9E, 0xDC, 0x26, 0x03, 0x3B, 0x7B, 0xBA,
+    0x8B, 0x72, 0x56, 0xF6, 0xCA, 0x69, 0x0B, 0x11, 0xA7, 0xB5, 0xCC, 0xB0, 0xB6, 0x5E, 0xAE, 0x32,
+    0x9B, 0x91, 0xC3, 0xC4, 0x31, 0xDD, 0x78, 0x99, 0x39, 0xB8, 0xEB, 0x39, 0x65, 0x75, 0x9B, 0x1B,
+    0x7D, 0x42, 0x7E, 0xD8, 0x97, 0x3E, 0x79, 0x03, 0x45, 0x8D, 0xC1, 0x0D, 0x80, 0x30, 0x0C, 0x03,
+    0x23, 0xF2, 0xE4, 0x91, 0x01, 0xD8, 0x85, 0xC2, 0x64, 0x88, 0xC9, 0x28, 0x1B, 0x74, 0x04, 0x46,
+    0xE8, 0x07, 0x09, 0xA1, 0x8A, 0x23, 0x11, 0x0F, 0x22, 0xC7, 0x0F, 0x5B, 0xB6, 0x45, 0x54, 0xE2,
+    0x2C, 0x07, 0xA7, 0x1A, 0x4C, 0x73, 0x52, 0x08, 0x79, 0xEA, 0xDD, 0x18, 0xA5, 0x73, 0x83, 0x61,
+    0x6E, 0x21, 0xEF, 0x88, 0xC1, 0x4A, 0x4E, 0x3C, 0x4A, 0xDD, 0xB8, 0x8C, 0x2B, 0x51, 0x1D, 0xC6,
+    0xB1, 0x91, 0x95, 0x33, 0xC2, 0x10, 0x45, 0xE9, 0xC4, 0xB3, 0x56, 0x16, 0xEF, 0xD1, 0xB2, 0x44,
+    0xFF, 0xDD, 0xFE, 0xAD, 0x6F, 0xB7, 0xF3, 0x7F, 0x01,
 };
 
 static const EpdGlyph notosans_12_boldGlyphs[] = {
@@ -1678,99 +1682,99 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 5, 19, 113, 1, 18, 24, 0 }, // !
-    { 10, 7, 192, 1, 18, 18, 24 }, // "
-    { 16, 18, 258, 0, 18, 72, 42 }, // #
-    { 13, 21, 229, 1, 19, 69, 114 }, // $
-    { 22, 20, 361, 0, 19, 110, 183 }, // %
-    { 18, 20, 300, 1, 19, 90, 293 }, // &
-    { 5, 7, 106, 1, 18, 9, 383 }, // '
-    { 7, 22, 136, 1, 18, 39, 392 }, // (
-    { 8, 22, 136, 0, 18, 44, 431 }, // )
-    { 13, 12, 217, 0, 19, 39, 475 }, // *
-    { 13, 13, 229, 1, 15, 43, 514 }, // +
-    { 6, 7, 114, 0, 3, 11, 557 }, // ,
-    { 8, 4, 128, 0, 9, 8, 568 }, // -
-    { 5, 5, 112, 1, 4, 7, 576 }, // .
-    { 11, 19, 166, 0, 18, 53, 583 }, // /
-    { 13, 20, 242, 1, 19, 65, 636 }, // 0
-    { 10, 18, 207, 0, 18, 45, 701 }, // 1
-    { 14, 19, 224, 0, 19, 67, 746 }, // 2
-    { 14, 20, 229, 0, 19, 70, 813 }, // 3
-    { 14, 18, 232, 0, 18, 63, 883 }, // 4
-    { 13, 19, 231, 1, 18, 62, 946 }, // 5
-    { 13, 20, 241, 1, 19, 65, 1008 }, // 6
-    { 14, 18, 214, 0, 18, 63, 1073 }, // 7
-    { 13, 20, 238, 1, 19, 65, 1136 }, // 8
-    { 13, 20, 241, 1, 19, 65, 1201 }, // 9
-    { 5, 15, 112, 1, 14, 19, 1266 }, // :
-    { 6, 18, 114, 0, 14, 27, 1285 }, // ;
-    { 13, 14, 229, 1, 16, 46, 1312 }, // <
-    { 13, 8, 229, 1, 13, 26, 1358 }, // =
-    { 13, 14, 229, 1, 16, 46, 1384 }, // >
-    { 12, 20, 191, 0, 19, 60, 1430 }, // ?
-    { 21, 20, 359, 1, 18, 105, 1490 }, // @
-    { 18, 18, 277, 0, 18, 81, 1595 }, // A
-    { 14, 18, 266, 2, 18, 63, 1676 }, // B
-    { 15, 20, 257, 1, 19, 75, 1739 }, // C
-    { 15, 18, 293, 2, 18, 68, 1814 }, // D
-    { 11, 18, 224, 2, 18, 50, 1882 }, // E
-    { 11, 18, 220, 2, 18, 50, 1932 }, // F
-    { 16, 20, 290, 1, 19, 80, 1982 }, // G
-    { 15, 18, 306, 2, 18, 68, 2062 }, // H
-    { 9, 18, 156, 0, 18, 41, 2130 }, // I
-    { 9, 24, 132, -2, 18, 54, 2171 }, // J
-    { 15, 18, 266, 2, 18, 68, 2225 }, // K
-    { 12, 18, 224, 2, 18, 54, 2293 }, // L
-    { 20, 18, 377, 2, 18, 90, 2347 }, // M
-    { 17, 18, 325, 2, 18, 77, 2437 }, // N
-    { 18, 20, 316, 1, 19, 90, 2514 }, // O
-    { 13, 18, 248, 2, 18, 59, 2604 }, // P
-    { 18, 24, 316, 1, 19, 108, 2663 }, // Q
-    { 15, 18, 262, 2, 18, 68, 2771 }, // R
-    { 12, 20, 220, 1, 19, 60, 2839 }, // S
-    { 14, 18, 231, 0, 18, 63, 2899 }, // T
-    { 15, 19, 302, 2, 18, 72, 2962 }, // U
-    { 17, 18, 260, 0, 18, 77, 3034 }, // V
-    { 25, 18, 387, 0, 18, 113, 3111 }, // W
-    { 17, 18, 268, 0, 18, 77, 3224 }, // X
-    { 16, 18, 250, 0, 18, 72, 3301 }, // Y
-    { 14, 18, 232, 0, 18, 63, 3373 }, // Z
-    { 7, 22, 132, 1, 18, 39, 3436 }, // [
-    { 11, 19, 166, 0, 18, 53, 3475 }, // <backslash>
-    { 7, 22, 132, 0, 18, 39, 3528 }, // ]
-    { 14, 12, 229, 0, 18, 42, 3567 }, // ^
-    { 12, 2, 164, -1, -2, 6, 3609 }, // _
-    { 8, 5, 146, 1, 20, 10, 3615 }, // `
-    { 13, 15, 240, 1, 14, 49, 3625 }, // a
-    { 14, 20, 253, 1, 19, 70, 3674 }, // b
-    { 12, 15, 206, 1, 14, 45, 3744 }, // c
-    { 13, 20, 253, 1, 19, 65, 3789 }, // d
-    { 13, 15, 239, 1, 14, 49, 3854 }, // e
-    { 11, 20, 155, 0, 20, 55, 3903 }, // f
-    { 13, 20, 253, 1, 14, 65, 3958 }, // g
-    { 14, 19, 260, 1, 19, 67, 4023 }, // h
-    { 5, 20, 120, 1, 20, 25, 4090 }, // i
-    { 8, 26, 119, -2, 20, 52, 4115 }, // j
-    { 15, 19, 248, 1, 19, 72, 4167 }, // k
-    { 5, 19, 119, 1, 19, 24, 4239 }, // l
-    { 22, 14, 390, 1, 14, 77, 4263 }, // m
-    { 14, 14, 260, 1, 14, 49, 4340 }, // n
-    { 14, 15, 250, 1, 14, 53, 4389 }, // o
-    { 14, 20, 253, 1, 14, 70, 4442 }, // p
-    { 13, 20, 253, 1, 14, 65, 4512 }, // q
-    { 10, 14, 179, 1, 14, 35, 4577 }, // r
-    { 11, 15, 201, 1, 14, 42, 4612 }, // s
-    { 11, 18, 174, 0, 17, 50, 4654 }, // t
-    { 14, 15, 260, 1, 14, 53, 4704 }, // u
-    { 15, 14, 228, 0, 14, 53, 4757 }, // v
-    { 22, 14, 342, 0, 14, 77, 4810 }, // w
-    { 15, 14, 231, 0, 14, 53, 4887 }, // x
-    { 15, 20, 228, 0, 14, 75, 4940 }, // y
-    { 12, 14, 197, 0, 14, 42, 5015 }, // z
-    { 9, 22, 158, 0, 18, 50, 5057 }, // {
-    { 4, 25, 220, 5, 19, 25, 5107 }, // |
-    { 9, 22, 158, 1, 18, 50, 5132 }, // }
-    { 13, 5, 229, 1, 11, 17, 5182 }, // ~
+    { 10, 7, 192, 1, 18, 18, 0 }, // "
+    { 16, 18, 258, 0, 18, 72, 18 }, // #
+    { 13, 21, 229, 1, 19, 69, 90 }, // $
+    { 22, 20, 361, 0, 19, 110, 159 }, // %
+    { 18, 20, 300, 1, 19, 90, 269 }, // &
+    { 5, 7, 106, 1, 18, 9, 359 }, // '
+    { 7, 22, 136, 1, 18, 39, 24 }, // (
+    { 8, 22, 136, 0, 18, 44, 63 }, // )
+    { 13, 12, 217, 0, 19, 39, 368 }, // *
+    { 13, 13, 229, 1, 15, 43, 407 }, // +
+    { 6, 7, 114, 0, 3, 11, 107 }, // ,
+    { 8, 4, 128, 0, 9, 8, 118 }, // -
+    { 5, 5, 112, 1, 4, 7, 126 }, // .
+    { 11, 19, 166, 0, 18, 53, 450 }, // /
+    { 13, 20, 242, 1, 19, 65, 133 }, // 0
+    { 10, 18, 207, 0, 18, 45, 198 }, // 1
+    { 14, 19, 224, 0, 19, 67, 243 }, // 2
+    { 14, 20, 229, 0, 19, 70, 310 }, // 3
+    { 14, 18, 232, 0, 18, 63, 380 }, // 4
+    { 13, 19, 231, 1, 18, 62, 443 }, // 5
+    { 13, 20, 241, 1, 19, 65, 505 }, // 6
+    { 14, 18, 214, 0, 18, 63, 570 }, // 7
+    { 13, 20, 238, 1, 19, 65, 633 }, // 8
+    { 13, 20, 241, 1, 19, 65, 698 }, // 9
+    { 5, 15, 112, 1, 14, 19, 763 }, // :
+    { 6, 18, 114, 0, 14, 27, 782 }, // ;
+    { 13, 14, 229, 1, 16, 46, 503 }, // <
+    { 13, 8, 229, 1, 13, 26, 549 }, // =
+    { 13, 14, 229, 1, 16, 46, 575 }, // >
+    { 12, 20, 191, 0, 19, 60, 809 }, // ?
+    { 21, 20, 359, 1, 18, 105, 621 }, // @
+    { 18, 18, 277, 0, 18, 81, 869 }, // A
+    { 14, 18, 266, 2, 18, 63, 950 }, // B
+    { 15, 20, 257, 1, 19, 75, 1013 }, // C
+    { 15, 18, 293, 2, 18, 68, 1088 }, // D
+    { 11, 18, 224, 2, 18, 50, 1156 }, // E
+    { 11, 18, 220, 2, 18, 50, 1206 }, // F
+    { 16, 20, 290, 1, 19, 80, 1256 }, // G
+    { 15, 18, 306, 2, 18, 68, 1336 }, // H
+    { 9, 18, 156, 0, 18, 41, 1404 }, // I
+    { 9, 24, 132, -2, 18, 54, 1445 }, // J
+    { 15, 18, 266, 2, 18, 68, 1499 }, // K
+    { 12, 18, 224, 2, 18, 54, 1567 }, // L
+    { 20, 18, 377, 2, 18, 90, 1621 }, // M
+    { 17, 18, 325, 2, 18, 77, 1711 }, // N
+    { 18, 20, 316, 1, 19, 90, 1788 }, // O
+    { 13, 18, 248, 2, 18, 59, 1878 }, // P
+    { 18, 24, 316, 1, 19, 108, 1937 }, // Q
+    { 15, 18, 262, 2, 18, 68, 2045 }, // R
+    { 12, 20, 220, 1, 19, 60, 2113 }, // S
+    { 14, 18, 231, 0, 18, 63, 2173 }, // T
+    { 15, 19, 302, 2, 18, 72, 726 }, // U
+    { 17, 18, 260, 0, 18, 77, 2236 }, // V
+    { 25, 18, 387, 0, 18, 113, 2313 }, // W
+    { 17, 18, 268, 0, 18, 77, 2426 }, // X
+    { 16, 18, 250, 0, 18, 72, 2503 }, // Y
+    { 14, 18, 232, 0, 18, 63, 2575 }, // Z
+    { 7, 22, 132, 1, 18, 39, 798 }, // [
+    { 11, 19, 166, 0, 18, 53, 837 }, // <backslash>
+    { 7, 22, 132, 0, 18, 39, 890 }, // ]
+    { 14, 12, 229, 0, 18, 42, 929 }, // ^
+    { 12, 2, 164, -1, -2, 6, 971 }, // _
+    { 8, 5, 146, 1, 20, 10, 977 }, // `
+    { 13, 15, 240, 1, 14, 49, 2638 }, // a
+    { 14, 20, 253, 1, 19, 70, 2687 }, // b
+    { 12, 15, 206, 1, 14, 45, 2757 }, // c
+    { 13, 20, 253, 1, 19, 65, 2802 }, // d
+    { 13, 15, 239, 1, 14, 49, 2867 }, // e
+    { 11, 20, 155, 0, 20, 55, 2916 }, // f
+    { 13, 20, 253, 1, 14, 65, 2971 }, // g
+    { 14, 19, 260, 1, 19, 67, 3036 }, // h
+    { 5, 20, 120, 1, 20, 25, 3103 }, // i
+    { 8, 26, 119, -2, 20, 52, 3128 }, // j
+    { 15, 19, 248, 1, 19, 72, 3180 }, // k
+    { 5, 19, 119, 1, 19, 24, 3252 }, // l
+    { 22, 14, 390, 1, 14, 77, 3276 }, // m
+    { 14, 14, 260, 1, 14, 49, 3353 }, // n
+    { 14, 15, 250, 1, 14, 53, 3402 }, // o
+    { 14, 20, 253, 1, 14, 70, 3455 }, // p
+    { 13, 20, 253, 1, 14, 65, 3525 }, // q
+    { 10, 14, 179, 1, 14, 35, 3590 }, // r
+    { 11, 15, 201, 1, 14, 42, 3625 }, // s
+    { 11, 18, 174, 0, 17, 50, 3667 }, // t
+    { 14, 15, 260, 1, 14, 53, 3717 }, // u
+    { 15, 14, 228, 0, 14, 53, 3770 }, // v
+    { 22, 14, 342, 0, 14, 77, 3823 }, // w
+    { 15, 14, 231, 0, 14, 53, 3900 }, // x
+    { 15, 20, 228, 0, 14, 75, 3953 }, // y
+    { 12, 14, 197, 0, 14, 42, 4028 }, // z
+    { 9, 22, 158, 0, 18, 50, 987 }, // {
+    { 4, 25, 220, 5, 19, 25, 1037 }, // |
+    { 9, 22, 158, 1, 18, 50, 1062 }, // }
+    { 13, 5, 229, 1, 11, 17, 1112 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 5, 19, 114, 1, 14, 24, 0 }, // U+00A1
     { 12, 20, 229, 1, 19, 60, 24 }, // U+00A2
@@ -1854,19 +1858,19 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 14, 21, 251, 1, 20, 74, 5188 }, // U+00F0
     { 14, 19, 260, 1, 19, 67, 5262 }, // U+00F1
     { 14, 21, 250, 1, 20, 74, 5329 }, // U+00F2
-    { 14, 21, 250, 1, 20, 74, 5403 }, // U+00F3
-    { 14, 21, 250, 1, 20, 74, 5477 }, // U+00F4
-    { 14, 20, 250, 1, 19, 70, 5551 }, // U+00F5
-    { 14, 20, 250, 1, 19, 70, 5621 }, // U+00F6
-    { 13, 13, 229, 1, 15, 43, 5691 }, // U+00F7
-    { 14, 16, 248, 1, 15, 56, 5734 }, // U+00F8
-    { 14, 21, 260, 1, 20, 74, 5790 }, // U+00F9
-    { 14, 21, 260, 1, 20, 74, 5864 }, // U+00FA
-    { 14, 21, 260, 1, 20, 74, 5938 }, // U+00FB
-    { 14, 20, 260, 1, 19, 70, 6012 }, // U+00FC
-    { 15, 26, 228, 0, 20, 98, 6082 }, // U+00FD
-    { 14, 25, 253, 1, 19, 88, 6180 }, // U+00FE
-    { 15, 25, 228, 0, 19, 94, 6268 }, // U+00FF
+    { 14, 21, 250, 1, 20, 74, 4070 }, // U+00F3
+    { 14, 21, 250, 1, 20, 74, 5403 }, // U+00F4
+    { 14, 20, 250, 1, 19, 70, 5477 }, // U+00F5
+    { 14, 20, 250, 1, 19, 70, 5547 }, // U+00F6
+    { 13, 13, 229, 1, 15, 43, 5617 }, // U+00F7
+    { 14, 16, 248, 1, 15, 56, 5660 }, // U+00F8
+    { 14, 21, 260, 1, 20, 74, 5716 }, // U+00F9
+    { 14, 21, 260, 1, 20, 74, 5790 }, // U+00FA
+    { 14, 21, 260, 1, 20, 74, 5864 }, // U+00FB
+    { 14, 20, 260, 1, 19, 70, 5938 }, // U+00FC
+    { 15, 26, 228, 0, 20, 98, 6008 }, // U+00FD
+    { 14, 25, 253, 1, 19, 88, 6106 }, // U+00FE
+    { 15, 25, 228, 0, 19, 94, 6194 }, // U+00FF
     { 18, 22, 277, 0, 22, 99, 0 }, // U+0100
     { 13, 19, 240, 1, 18, 62, 99 }, // U+0101
     { 18, 24, 277, 0, 24, 108, 161 }, // U+0102
@@ -2568,98 +2572,98 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 8, 4, 128, 0, 9, 8, 78 }, // U+2010
     { 8, 4, 128, 0, 9, 8, 86 }, // U+2011
     { 13, 4, 231, 1, 11, 13, 94 }, // U+2012
-    { 12, 4, 200, 0, 9, 12, 107 }, // U+2013
-    { 25, 4, 400, 0, 9, 25, 119 }, // U+2014
-    { 25, 4, 400, 0, 9, 25, 144 }, // U+2015
-    { 10, 25, 220, 2, 19, 63, 169 }, // U+2016
-    { 12, 6, 164, -1, 0, 18, 232 }, // U+2017
-    { 6, 7, 87, 0, 18, 11, 250 }, // U+2018
-    { 6, 7, 87, 0, 18, 11, 261 }, // U+2019
-    { 6, 7, 114, 0, 4, 11, 272 }, // U+201A
-    { 6, 7, 87, 0, 18, 11, 283 }, // U+201B
-    { 11, 7, 178, 0, 18, 20, 294 }, // U+201C
-    { 11, 7, 178, 0, 18, 20, 314 }, // U+201D
-    { 12, 7, 205, 0, 3, 21, 334 }, // U+201E
-    { 11, 7, 178, 0, 18, 20, 355 }, // U+201F
-    { 11, 19, 205, 1, 19, 53, 375 }, // U+2020
-    { 11, 19, 208, 1, 19, 53, 428 }, // U+2021
-    { 8, 8, 150, 1, 13, 16, 481 }, // U+2022
-    { 9, 10, 150, 1, 14, 23, 497 }, // U+2023
-    { 5, 5, 200, 4, 4, 7, 520 }, // U+2024
-    { 13, 5, 230, 1, 4, 17, 527 }, // U+2025
-    { 19, 5, 342, 1, 4, 24, 544 }, // U+2026
-    { 5, 5, 112, 1, 9, 7, 568 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 575 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 575 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 575 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 610 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 645 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 678 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 711 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 744 }, // U+202F
-    { 32, 20, 512, 0, 19, 160, 744 }, // U+2030
-    { 41, 20, 667, 0, 19, 205, 904 }, // U+2031
-    { 7, 7, 121, 1, 18, 13, 1109 }, // U+2032
-    { 13, 7, 210, 1, 18, 23, 1122 }, // U+2033
-    { 18, 7, 298, 1, 18, 32, 1145 }, // U+2034
-    { 7, 7, 169, 1, 18, 13, 1177 }, // U+2035
-    { 13, 7, 257, 1, 18, 23, 1190 }, // U+2036
-    { 18, 7, 346, 1, 18, 32, 1213 }, // U+2037
-    { 10, 9, 163, 0, 3, 23, 1245 }, // U+2038
-    { 9, 12, 146, 0, 13, 27, 1268 }, // U+2039
-    { 9, 12, 146, 0, 13, 27, 1295 }, // U+203A
-    { 19, 20, 340, 1, 19, 95, 1322 }, // U+203B
-    { 12, 19, 228, 1, 18, 57, 1417 }, // U+203C
-    { 12, 20, 191, 0, 19, 60, 1474 }, // U+203D
-    { 14, 3, 200, -1, 22, 11, 1534 }, // U+203E
-    { 15, 6, 244, 0, 0, 23, 1545 }, // U+203F
-    { 15, 6, 244, 0, 20, 23, 1568 }, // U+2040
-    { 11, 17, 170, 0, 11, 47, 1591 }, // U+2041
-    { 28, 23, 448, 0, 19, 161, 1638 }, // U+2042
-    { 7, 4, 128, 1, 9, 7, 1799 }, // U+2043
-    { 14, 18, 52, -5, 18, 63, 1806 }, // U+2044
-    { 7, 22, 132, 1, 18, 39, 1869 }, // U+2045
-    { 7, 22, 132, 0, 18, 39, 1908 }, // U+2046
-    { 24, 20, 380, 0, 19, 120, 1947 }, // U+2047
-    { 18, 20, 305, 0, 19, 90, 2067 }, // U+2048
-    { 18, 20, 305, 1, 19, 90, 2157 }, // U+2049
-    { 13, 14, 235, 1, 14, 46, 2247 }, // U+204A
-    { 14, 23, 259, 1, 19, 81, 2293 }, // U+204B
-    { 14, 13, 262, 1, 14, 46, 2374 }, // U+204C
-    { 14, 13, 262, 2, 14, 46, 2420 }, // U+204D
-    { 13, 12, 217, 0, 7, 39, 2466 }, // U+204E
-    { 6, 18, 114, 1, 14, 27, 2505 }, // U+204F
-    { 15, 26, 240, 0, 20, 98, 2532 }, // U+2050
-    { 13, 25, 217, 0, 19, 82, 2630 }, // U+2051
-    { 11, 20, 169, 0, 19, 55, 2712 }, // U+2052
-    { 24, 5, 400, 1, 10, 30, 2767 }, // U+2053
-    { 15, 6, 240, 0, 0, 23, 2797 }, // U+2054
-    { 14, 13, 224, 0, 13, 46, 2820 }, // U+2055
-    { 13, 20, 232, 1, 19, 65, 2866 }, // U+2056
-    { 23, 7, 374, 1, 18, 41, 2931 }, // U+2057
-    { 20, 20, 349, 1, 19, 100, 2972 }, // U+2058
-    { 20, 20, 349, 1, 19, 100, 3072 }, // U+2059
-    { 5, 20, 114, 1, 19, 25, 3172 }, // U+205A
-    { 15, 21, 277, 1, 20, 79, 3197 }, // U+205B
-    { 21, 20, 341, 0, 19, 105, 3276 }, // U+205C
-    { 5, 20, 112, 1, 19, 25, 3381 }, // U+205D
-    { 5, 20, 114, 1, 19, 25, 3406 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 3431 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 3431 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 3431 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 3431 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 3431 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 3431 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 3431 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 3431 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 3431 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 3431 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 3431 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3464 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3497 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3530 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3563 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3596 }, // U+206F
+    { 12, 4, 200, 0, 9, 12, 4144 }, // U+2013
+    { 25, 4, 400, 0, 9, 25, 4156 }, // U+2014
+    { 25, 4, 400, 0, 9, 25, 107 }, // U+2015
+    { 10, 25, 220, 2, 19, 63, 132 }, // U+2016
+    { 12, 6, 164, -1, 0, 18, 195 }, // U+2017
+    { 6, 7, 87, 0, 18, 11, 213 }, // U+2018
+    { 6, 7, 87, 0, 18, 11, 4181 }, // U+2019
+    { 6, 7, 114, 0, 4, 11, 224 }, // U+201A
+    { 6, 7, 87, 0, 18, 11, 235 }, // U+201B
+    { 11, 7, 178, 0, 18, 20, 4192 }, // U+201C
+    { 11, 7, 178, 0, 18, 20, 4212 }, // U+201D
+    { 12, 7, 205, 0, 3, 21, 246 }, // U+201E
+    { 11, 7, 178, 0, 18, 20, 267 }, // U+201F
+    { 11, 19, 205, 1, 19, 53, 287 }, // U+2020
+    { 11, 19, 208, 1, 19, 53, 340 }, // U+2021
+    { 8, 8, 150, 1, 13, 16, 393 }, // U+2022
+    { 9, 10, 150, 1, 14, 23, 409 }, // U+2023
+    { 5, 5, 200, 4, 4, 7, 432 }, // U+2024
+    { 13, 5, 230, 1, 4, 17, 439 }, // U+2025
+    { 19, 5, 342, 1, 4, 24, 4232 }, // U+2026
+    { 5, 5, 112, 1, 9, 7, 456 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 463 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 463 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 463 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 498 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 533 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 566 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 599 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 632 }, // U+202F
+    { 32, 20, 512, 0, 19, 160, 632 }, // U+2030
+    { 41, 20, 667, 0, 19, 205, 792 }, // U+2031
+    { 7, 7, 121, 1, 18, 13, 997 }, // U+2032
+    { 13, 7, 210, 1, 18, 23, 1010 }, // U+2033
+    { 18, 7, 298, 1, 18, 32, 1033 }, // U+2034
+    { 7, 7, 169, 1, 18, 13, 1065 }, // U+2035
+    { 13, 7, 257, 1, 18, 23, 1078 }, // U+2036
+    { 18, 7, 346, 1, 18, 32, 1101 }, // U+2037
+    { 10, 9, 163, 0, 3, 23, 1133 }, // U+2038
+    { 9, 12, 146, 0, 13, 27, 1156 }, // U+2039
+    { 9, 12, 146, 0, 13, 27, 1183 }, // U+203A
+    { 19, 20, 340, 1, 19, 95, 1210 }, // U+203B
+    { 12, 19, 228, 1, 18, 57, 1305 }, // U+203C
+    { 12, 20, 191, 0, 19, 60, 1362 }, // U+203D
+    { 14, 3, 200, -1, 22, 11, 1422 }, // U+203E
+    { 15, 6, 244, 0, 0, 23, 1433 }, // U+203F
+    { 15, 6, 244, 0, 20, 23, 1456 }, // U+2040
+    { 11, 17, 170, 0, 11, 47, 1479 }, // U+2041
+    { 28, 23, 448, 0, 19, 161, 1526 }, // U+2042
+    { 7, 4, 128, 1, 9, 7, 1687 }, // U+2043
+    { 14, 18, 52, -5, 18, 63, 1694 }, // U+2044
+    { 7, 22, 132, 1, 18, 39, 1757 }, // U+2045
+    { 7, 22, 132, 0, 18, 39, 1796 }, // U+2046
+    { 24, 20, 380, 0, 19, 120, 1835 }, // U+2047
+    { 18, 20, 305, 0, 19, 90, 1955 }, // U+2048
+    { 18, 20, 305, 1, 19, 90, 2045 }, // U+2049
+    { 13, 14, 235, 1, 14, 46, 2135 }, // U+204A
+    { 14, 23, 259, 1, 19, 81, 2181 }, // U+204B
+    { 14, 13, 262, 1, 14, 46, 2262 }, // U+204C
+    { 14, 13, 262, 2, 14, 46, 2308 }, // U+204D
+    { 13, 12, 217, 0, 7, 39, 2354 }, // U+204E
+    { 6, 18, 114, 1, 14, 27, 2393 }, // U+204F
+    { 15, 26, 240, 0, 20, 98, 2420 }, // U+2050
+    { 13, 25, 217, 0, 19, 82, 2518 }, // U+2051
+    { 11, 20, 169, 0, 19, 55, 2600 }, // U+2052
+    { 24, 5, 400, 1, 10, 30, 2655 }, // U+2053
+    { 15, 6, 240, 0, 0, 23, 2685 }, // U+2054
+    { 14, 13, 224, 0, 13, 46, 2708 }, // U+2055
+    { 13, 20, 232, 1, 19, 65, 2754 }, // U+2056
+    { 23, 7, 374, 1, 18, 41, 2819 }, // U+2057
+    { 20, 20, 349, 1, 19, 100, 2860 }, // U+2058
+    { 20, 20, 349, 1, 19, 100, 2960 }, // U+2059
+    { 5, 20, 114, 1, 19, 25, 3060 }, // U+205A
+    { 15, 21, 277, 1, 20, 79, 3085 }, // U+205B
+    { 21, 20, 341, 0, 19, 105, 3164 }, // U+205C
+    { 5, 20, 112, 1, 19, 25, 3269 }, // U+205D
+    { 5, 20, 114, 1, 19, 25, 3294 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 3319 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 3319 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 3319 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 3319 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 3319 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 3319 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 3319 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 3319 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 3319 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 3319 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 3319 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 3352 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 3385 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 3418 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 3451 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3484 }, // U+206F
     { 9, 12, 152, 0, 22, 27, 0 }, // U+2070
     { 3, 12, 78, 1, 19, 9, 27 }, // U+2071
     { 10, 12, 152, 0, 22, 30, 36 }, // U+2074
@@ -2736,13 +2740,13 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 12, 24, 229, 2, 21, 72, 2514 }, // U+20BF
     { 12, 19, 210, 1, 14, 57, 2586 }, // U+20C0
     { 13, 4, 232, 1, 11, 13, 0 }, // U+2212
-    { 21, 20, 309, 0, 20, 105, 0 }, // U+FB00
-    { 16, 20, 274, 0, 20, 80, 105 }, // U+FB01
-    { 16, 20, 277, 0, 20, 80, 185 }, // U+FB02
-    { 26, 20, 428, 0, 20, 130, 265 }, // U+FB03
-    { 25, 20, 432, 0, 20, 125, 395 }, // U+FB04
-    { 18, 21, 313, 1, 20, 95, 520 }, // U+FB05
-    { 22, 21, 372, 1, 20, 116, 615 }, // U+FB06
+    { 21, 20, 309, 0, 20, 105, 4256 }, // U+FB00
+    { 16, 20, 274, 0, 20, 80, 4361 }, // U+FB01
+    { 16, 20, 277, 0, 20, 80, 4441 }, // U+FB02
+    { 26, 20, 428, 0, 20, 130, 4521 }, // U+FB03
+    { 25, 20, 432, 0, 20, 125, 4651 }, // U+FB04
+    { 18, 21, 313, 1, 20, 95, 0 }, // U+FB05
+    { 22, 21, 372, 1, 20, 116, 95 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -2750,8 +2754,7 @@ static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -2759,8 +2762,7 @@ static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -2770,19 +2772,57 @@ static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
 };
 
 static const EpdFontGroup notosans_12_boldGroups[] = {
-    { 0, 2652, 5906, 97, 0 },
-    { 2652, 2407, 7162, 96, 97 },
-    { 5059, 3030, 10819, 128, 193 },
-    { 8089, 3120, 9919, 96, 321 },
-    { 11209, 1095, 1678, 112, 417 },
-    { 12304, 7929, 22428, 256, 529 },
-    { 20233, 2013, 9604, 90, 785 },
-    { 22246, 1855, 4084, 111, 875 },
-    { 24101, 524, 1189, 42, 986 },
-    { 24625, 1575, 2873, 33, 1028 },
-    { 26200, 16, 16, 1, 1061 },
-    { 26216, 264, 791, 7, 1062 },
-    { 26480, 97, 138, 1, 1069 },
+    { 0, 2238, 5377, 83, 2 },
+    { 2238, 684, 1294, 26, 0 },
+    { 2922, 2402, 7078, 95, 97 },
+    { 5324, 3030, 10819, 128, 193 },
+    { 8354, 3120, 9919, 96, 321 },
+    { 11474, 1095, 1678, 112, 417 },
+    { 12569, 7929, 22428, 256, 529 },
+    { 20498, 2013, 9604, 90, 785 },
+    { 22511, 1796, 3963, 105, 875 },
+    { 24307, 524, 1189, 42, 986 },
+    { 24831, 1575, 2873, 33, 1028 },
+    { 26406, 16, 16, 1, 1061 },
+    { 26422, 130, 231, 2, 1067 },
+    { 26552, 97, 138, 1, 1069 },
+};
+
+static const uint16_t notosans_12_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_12_boldKernLeftClasses[] = {
@@ -3842,18 +3882,81 @@ static const EpdLigaturePair notosans_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_12_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 70, 49 }, { 0x0265, 66, 51 }, { 0x0266, 71, 60 }, { 0x0267, 0, 0 }, { 0x0268, 72, 61 }, // U+0450
+    { 0x0269, 73, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 74, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_12_bold = {
     notosans_12_boldBitmaps,
     notosans_12_boldGlyphs,
     notosans_12_boldIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notosans_12_boldGroups,
-    13,
-    nullptr,
+    14,
+    notosans_12_boldGlyphToGroup,
     notosans_12_boldKernLeftClasses,
     notosans_12_boldKernRightClasses,
     notosans_12_boldKernMatrix,
@@ -3863,4 +3966,8 @@ static const EpdFontData notosans_12_bold = {
     76,
     notosans_12_boldLigaturePairs,
     5,
+    notosans_12_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,1922 +3,1927 @@
  * name: notosans_12_bolditalic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_bolditalicBitmaps[30550] = {
-    0x95, 0x58, 0x3F, 0x8C, 0xE5, 0xC4, 0x1D, 0xFE, 0xF9, 0x19, 0xCE, 0xD2, 0x59, 0x62, 0x28, 0xA0,
-    0xC9, 0x29, 0x72, 0x8A, 0x14, 0x09, 0x91, 0xE2, 0x36, 0xD5, 0x8D, 0x01, 0x09, 0x0A, 0x8A, 0xA3,
-    0xC8, 0x92, 0x82, 0x82, 0x14, 0x14, 0xA7, 0x4B, 0xA4, 0x6D, 0x68, 0x22, 0xB1, 0x3B, 0x86, 0x26,
-    0x05, 0x45, 0xB6, 0x49, 0x95, 0x22, 0x57, 0x5C, 0xA4, 0xD3, 0x36, 0x50, 0xA6, 0xB8, 0xDD, 0x99,
-    0x40, 0x91, 0x82, 0x22, 0x06, 0x0A, 0xCA, 0x33, 0xE2, 0x1A, 0x40, 0xD1, 0x1A, 0xCE, 0xC7, 0x19,
-    0xD6, 0xF6, 0xE4, 0xFB, 0x66, 0xFC, 0xDE, 0xBE, 0x85, 0xBB, 0x24, 0xBC, 0xE7, 0xF1, 0xDD, 0x3E,
-    0x7B, 0x66, 0x7E, 0x7F, 0xBF, 0xDF, 0xF7, 0x9B, 0x64, 0x5E, 0xCD, 0xAB, 0x29, 0x1D, 0xF1, 0x1D,
-    0xB2, 0x3E, 0xEF, 0xF2, 0x4E, 0xB5, 0xAA, 0x51, 0x4E, 0xF0, 0x29, 0xC5, 0xD4, 0xB6, 0x36, 0xF2,
-    0x88, 0x94, 0x2F, 0x34, 0xFA, 0x4A, 0xA3, 0x95, 0xBB, 0xAC, 0xEA, 0xBD, 0xA2, 0x7A, 0xBD, 0x90,
-    0xAB, 0x3F, 0x12, 0x49, 0xDB, 0x41, 0x24, 0x6B, 0x7A, 0x91, 0xFC, 0xDD, 0x4E, 0x44, 0xBD, 0xC7,
-    0xDB, 0xB3, 0xAD, 0x28, 0xEF, 0x7D, 0xBC, 0x5D, 0xB4, 0x6F, 0x7F, 0x2E, 0xB2, 0xA7, 0x2A, 0x91,
-    0x5B, 0xA5, 0xC8, 0x53, 0xB3, 0xBD, 0x21, 0xC6, 0xFB, 0x31, 0xDE, 0x56, 0xDD, 0xAD, 0xF5, 0x22,
-    0x1F, 0x9C, 0x5B, 0x44, 0xE4, 0x35, 0x8C, 0x77, 0x20, 0x81, 0xAF, 0xC5, 0xFB, 0x26, 0xF5, 0xDE,
-    0x65, 0xDF, 0x7C, 0x50, 0x65, 0x5F, 0x39, 0xC9, 0x4E, 0x9D, 0xA4, 0xDE, 0x49, 0xE2, 0x31, 0x4F,
-    0x7B, 0x4C, 0xF3, 0x95, 0x28, 0x53, 0xCB, 0x63, 0xBA, 0x7E, 0xED, 0xC7, 0xB6, 0xC2, 0xCA, 0x58,
-    0x7D, 0x94, 0x4B, 0xFE, 0x40, 0xE4, 0x57, 0xCB, 0x52, 0x8F, 0x4B, 0xFC, 0xAC, 0x66, 0xEC, 0xA7,
-    0x7C, 0xAD, 0x5C, 0x71, 0xE2, 0x4A, 0x81, 0x42, 0x7B, 0x62, 0x94, 0x1B, 0x64, 0x9F, 0xFB, 0x1E,
-    0x15, 0x6F, 0x35, 0x72, 0xA4, 0x5F, 0x79, 0xAB, 0x35, 0x56, 0x9B, 0x51, 0x4F, 0xE3, 0x3C, 0x15,
-    0x5F, 0xDD, 0x1B, 0x8F, 0x24, 0xFB, 0xB4, 0x3F, 0xA2, 0x68, 0x47, 0xA2, 0xD3, 0x6E, 0x94, 0x23,
-    0xDC, 0x92, 0x21, 0xBD, 0xDF, 0xA7, 0xDD, 0xCA, 0x77, 0x30, 0x16, 0xC4, 0x3C, 0xFB, 0x64, 0x10,
-    0x08, 0x92, 0x37, 0x02, 0x39, 0x5A, 0x11, 0x9B, 0x43, 0xA3, 0x39, 0xDC, 0x14, 0xFF, 0x34, 0x2E,
-    0xCA, 0x2D, 0xB6, 0xBF, 0x58, 0xA7, 0xBE, 0x2B, 0x9D, 0x3A, 0x1D, 0x74, 0x55, 0x7E, 0x38, 0x79,
-    0xD1, 0xCE, 0x4F, 0xA2, 0x6B, 0x33, 0x88, 0x6E, 0x74, 0x87, 0xD7, 0x7C, 0x2F, 0x05, 0x4D, 0x95,
-    0xF9, 0x4F, 0x7C, 0x5C, 0xBD, 0xAC, 0x74, 0xA5, 0xE5, 0xB2, 0xEC, 0xC9, 0xEB, 0x72, 0x15, 0x9B,
-    0xC1, 0xDC, 0x4E, 0x74, 0x25, 0xC7, 0x92, 0x8C, 0x92, 0xF6, 0x92, 0x75, 0xA2, 0xC2, 0x6F, 0x85,
-    0x93, 0xB2, 0xE6, 0x13, 0x5E, 0xB2, 0xBE, 0xC2, 0x9F, 0xF8, 0x1D, 0x4F, 0xF1, 0x4E, 0xD6, 0x84,
-    0x35, 0xF1, 0x60, 0xF3, 0x93, 0x6A, 0x78, 0xE5, 0xED, 0x72, 0x71, 0xAD, 0xE6, 0xDC, 0x72, 0x46,
-    0x64, 0x5A, 0xF6, 0xC2, 0xC3, 0xD2, 0xF1, 0x87, 0xF0, 0x29, 0xA0, 0x76, 0x51, 0xCB, 0x4F, 0xE0,
-    0xE8, 0x7D, 0x0C, 0x3B, 0xBF, 0x44, 0xD9, 0xE1, 0x28, 0x0F, 0xF1, 0x1F, 0x95, 0xE2, 0x36, 0xA6,
-    0x5F, 0x71, 0x72, 0x31, 0xC7, 0xA6, 0x19, 0xDE, 0xBD, 0x2C, 0xE7, 0x07, 0xA4, 0xB0, 0xDE, 0x57,
-    0x1C, 0xD7, 0xEC, 0xE1, 0xF7, 0x9F, 0xE3, 0x13, 0x63, 0x14, 0xDE, 0xAB, 0xF1, 0xB2, 0x3C, 0xFA,
-    0x6B, 0x3D, 0x99, 0xD1, 0x8C, 0xBF, 0x14, 0x5B, 0xFB, 0xDA, 0xCA, 0x13, 0x34, 0x3E, 0x63, 0x08,
-    0x66, 0x2E, 0x5C, 0x50, 0x56, 0xAC, 0x50, 0x5C, 0x59, 0x8D, 0x42, 0x81, 0xA9, 0x51, 0x7C, 0x04,
-    0x87, 0x99, 0xEF, 0x3C, 0xE2, 0xCC, 0xE5, 0xD1, 0xE6, 0x53, 0x22, 0xC8, 0x20, 0x3F, 0x02, 0xB0,
-    0xCA, 0x07, 0x5D, 0xAB, 0x4E, 0xBB, 0xB2, 0xD1, 0x8E, 0x5F, 0x53, 0x63, 0x54, 0xDA, 0x59, 0xCC,
-    0xB0, 0x62, 0x2A, 0x8F, 0xBD, 0x3C, 0xBE, 0x36, 0x99, 0xC5, 0x3E, 0xCB, 0x10, 0xEF, 0x43, 0x14,
-    0x30, 0x3E, 0xC3, 0x07, 0x1B, 0x18, 0xC4, 0x4B, 0x5B, 0xF8, 0xC6, 0x7A, 0xA7, 0x77, 0xDD, 0xCF,
-    0xB0, 0x15, 0x2E, 0x53, 0x51, 0x4A, 0xB8, 0x77, 0x0E, 0x96, 0x9D, 0x28, 0x51, 0x8A, 0x6B, 0x90,
-    0xAC, 0x5F, 0x66, 0x62, 0x09, 0xEB, 0x9B, 0x95, 0xF7, 0x9D, 0x4C, 0xAA, 0x97, 0xDF, 0xF2, 0x01,
-    0x87, 0x82, 0xCC, 0x25, 0x03, 0x8D, 0xF9, 0x80, 0xF7, 0xA0, 0x4A, 0x09, 0x0D, 0x11, 0x8E, 0x29,
-    0x34, 0xC3, 0x9B, 0x0C, 0xA1, 0x1A, 0x29, 0xC1, 0xB4, 0x88, 0x62, 0xEC, 0x4E, 0x41, 0x1B, 0xA6,
-    0x54, 0xD2, 0x68, 0xCC, 0x2D, 0x30, 0xE0, 0x45, 0xE4, 0xBA, 0xBC, 0x0C, 0x09, 0xFC, 0x1D, 0x0C,
-    0x68, 0x7D, 0x61, 0x96, 0x68, 0x3D, 0x13, 0xFE, 0x3D, 0x58, 0x41, 0x37, 0x04, 0x27, 0x23, 0xD2,
-    0x6C, 0xC2, 0x3D, 0xC7, 0x0E, 0x05, 0x64, 0x30, 0x18, 0x88, 0xF5, 0x14, 0x43, 0x9D, 0x34, 0x52,
-    0xFE, 0x15, 0x51, 0x51, 0xBA, 0x64, 0xD4, 0x75, 0xDA, 0xEB, 0x4A, 0x35, 0x46, 0xCA, 0xCF, 0xFD,
-    0x75, 0xC8, 0xD2, 0x61, 0xB4, 0x4F, 0xEE, 0xCC, 0x15, 0x23, 0x28, 0x9A, 0x7E, 0xA4, 0xDB, 0x5B,
-    0xA6, 0xB9, 0x50, 0xA6, 0x69, 0xA7, 0x82, 0xE6, 0xC1, 0x23, 0xD4, 0x30, 0xC7, 0x7E, 0x0A, 0xFB,
-    0xE6, 0x5F, 0x30, 0xFE, 0xA9, 0x83, 0x5D, 0x86, 0x87, 0x4C, 0xB3, 0x30, 0x39, 0xCE, 0xCB, 0xC4,
-    0x34, 0x87, 0x9D, 0x0A, 0xAC, 0x09, 0x9B, 0x25, 0x98, 0xC2, 0x2D, 0x82, 0x77, 0x3F, 0xB9, 0x8E,
-    0x28, 0x9C, 0xE1, 0x15, 0x64, 0xDA, 0x3D, 0x0B, 0xFF, 0xE9, 0xFA, 0xEC, 0x4B, 0x5F, 0x7A, 0x4C,
-    0x9B, 0xB0, 0xDF, 0x80, 0x25, 0x9A, 0x25, 0x99, 0x7D, 0x0F, 0x28, 0xEB, 0x38, 0x1E, 0xDD, 0x31,
-    0x4D, 0x8C, 0x0F, 0xC8, 0x02, 0x2F, 0xC7, 0x85, 0x17, 0x13, 0x68, 0x98, 0xD0, 0xC6, 0x47, 0x2B,
-    0xD8, 0x3E, 0x1B, 0x17, 0xEF, 0xB4, 0xF1, 0x51, 0x8C, 0xA6, 0x89, 0xD1, 0x54, 0xA7, 0xB3, 0x75,
-    0x69, 0x5F, 0x34, 0x59, 0xA7, 0x9A, 0xAC, 0x2F, 0x5C, 0x3A, 0x9A, 0x3A, 0xF1, 0xB4, 0x3D, 0xD2,
-    0x17, 0x7B, 0x97, 0x5F, 0xCF, 0xD8, 0x85, 0xF1, 0x64, 0xE2, 0xA8, 0x70, 0xFF, 0x82, 0x72, 0x13,
-    0x08, 0xDA, 0x33, 0x3D, 0x6D, 0x0F, 0x93, 0x53, 0x5E, 0xC8, 0xDD, 0xDA, 0x6A, 0xA3, 0x4F, 0xC5,
-    0x3B, 0xF4, 0xFB, 0xD0, 0x57, 0x65, 0x80, 0x62, 0x2B, 0xC9, 0x0D, 0xAC, 0x8F, 0xD8, 0x0A, 0x32,
-    0x17, 0x7D, 0x30, 0xB9, 0x85, 0xCD, 0xEC, 0x10, 0x97, 0x4A, 0xFA, 0x6C, 0xCC, 0x91, 0x5D, 0x52,
-    0x9D, 0x2D, 0xBF, 0x95, 0x57, 0xC8, 0x6D, 0xC4, 0x98, 0x0D, 0xC1, 0xFA, 0x88, 0x7C, 0xFF, 0xB3,
-    0x0D, 0x3C, 0x84, 0x89, 0xAD, 0x47, 0x79, 0xF4, 0x57, 0x8E, 0xFD, 0x6D, 0x1B, 0xFE, 0x31, 0x84,
-    0xC1, 0x83, 0x68, 0x8E, 0x15, 0xF5, 0x29, 0x68, 0x4F, 0xFA, 0x36, 0x0F, 0xBB, 0x5F, 0x3B, 0x3C,
-    0xDC, 0x20, 0xC1, 0x46, 0xD5, 0xE5, 0x6F, 0x0E, 0xFE, 0xF8, 0x77, 0x89, 0xE6, 0x36, 0xAC, 0x1E,
-    0xF4, 0x3D, 0x33, 0x75, 0x85, 0xF7, 0xB9, 0x4E, 0x39, 0xCB, 0x05, 0xF8, 0xCF, 0x4C, 0xF1, 0x1D,
-    0xBE, 0x5B, 0xAD, 0x23, 0xA3, 0x29, 0xFD, 0x50, 0xF8, 0xF1, 0xB1, 0x55, 0x00, 0x31, 0x44, 0x60,
-    0x3E, 0x40, 0x20, 0xCC, 0x82, 0x61, 0xA0, 0x42, 0xBE, 0x36, 0x6F, 0x5E, 0xD3, 0x6F, 0xBC, 0xEA,
-    0xA8, 0xF1, 0xEE, 0x67, 0x21, 0x13, 0x3D, 0x53, 0xE5, 0xB3, 0xB7, 0x7B, 0x7A, 0x99, 0xB3, 0xE1,
-    0xE3, 0x7D, 0x68, 0x6D, 0x06, 0x2D, 0x7A, 0xE5, 0xC7, 0x52, 0x2E, 0xE7, 0x2D, 0xEE, 0x7B, 0x45,
-    0x3D, 0x94, 0x28, 0x7A, 0x49, 0x5F, 0xCA, 0xA8, 0x57, 0x9D, 0x96, 0xF1, 0x72, 0xDA, 0xED, 0xE1,
-    0xFF, 0x78, 0x2C, 0xB7, 0x02, 0xB2, 0x1F, 0xA9, 0x01, 0x52, 0xEA, 0xE4, 0xC5, 0x27, 0x03, 0xFE,
-    0x4A, 0xC8, 0x58, 0x94, 0xAB, 0x94, 0x0F, 0x97, 0xEA, 0x21, 0xF2, 0x62, 0x04, 0x57, 0xFE, 0xA2,
-    0xE9, 0x2C, 0x6A, 0x2C, 0xF3, 0x40, 0x6F, 0x32, 0x7D, 0xEE, 0x8D, 0x04, 0x3D, 0x46, 0x5B, 0xCB,
-    0xEC, 0x77, 0x23, 0x23, 0x94, 0x8A, 0xFF, 0x39, 0x04, 0xDB, 0x0C, 0x95, 0x71, 0x4B, 0x59, 0x8D,
-    0x21, 0xAB, 0xA5, 0x8F, 0x2C, 0xF3, 0xDD, 0x06, 0xE8, 0x21, 0x4C, 0x57, 0x21, 0x81, 0x90, 0x48,
-    0xC9, 0xFC, 0x9B, 0x31, 0x19, 0x57, 0xD3, 0x6A, 0x5C, 0x81, 0x0F, 0x64, 0x03, 0x26, 0x75, 0x19,
-    0x91, 0x0F, 0x31, 0xAB, 0xBA, 0xDD, 0x56, 0x75, 0x8A, 0xEC, 0xA0, 0x2B, 0x1A, 0x85, 0xAA, 0x65,
-    0x5A, 0x28, 0xE1, 0x34, 0x73, 0x89, 0x98, 0x11, 0x93, 0xA5, 0x65, 0xED, 0x05, 0xE2, 0x63, 0xEE,
-    0xD3, 0xEF, 0xA8, 0x21, 0xA6, 0x06, 0x11, 0x4A, 0xAF, 0x41, 0x77, 0x2B, 0x83, 0xF9, 0xFF, 0x50,
-    0x0D, 0xDB, 0x0B, 0xA1, 0x52, 0xE4, 0xA1, 0x5A, 0x4C, 0x8B, 0xC3, 0x89, 0x3F, 0x9E, 0x26, 0x60,
-    0x8A, 0x27, 0xF3, 0xCB, 0x84, 0x46, 0x80, 0x1C, 0x6C, 0xEE, 0x19, 0xC4, 0x96, 0x00, 0x69, 0x89,
-    0x11, 0x41, 0x31, 0xCF, 0x6C, 0xE3, 0x0D, 0x6E, 0x51, 0x2D, 0x9E, 0x43, 0x48, 0x64, 0xD2, 0x07,
-    0x36, 0x54, 0x51, 0x78, 0x91, 0xF9, 0xA5, 0xC9, 0x09, 0x10, 0x4A, 0xD4, 0xB6, 0xE3, 0x48, 0xE6,
-    0x9D, 0x2A, 0x99, 0xCE, 0x80, 0x88, 0xC8, 0x98, 0x2D, 0x92, 0xA8, 0x7B, 0x3B, 0x21, 0x83, 0x43,
-    0x35, 0x69, 0x16, 0x2D, 0x20, 0xCA, 0x7A, 0x60, 0x9D, 0xEE, 0xA1, 0xEB, 0x84, 0xA8, 0x5C, 0xD6,
-    0xC1, 0xCE, 0xE7, 0xD6, 0x71, 0x67, 0xD6, 0xD8, 0xD4, 0x9A, 0x0B, 0x48, 0x7B, 0x9A, 0x12, 0x10,
-    0x9B, 0xFA, 0xEA, 0xF7, 0x04, 0xF2, 0x6D, 0xCB, 0x99, 0xDA, 0x8F, 0xA8, 0x30, 0xA3, 0xAD, 0xFC,
-    0x60, 0xAB, 0xAC, 0x37, 0x55, 0xDE, 0x19, 0x87, 0x6A, 0xD4, 0x2A, 0x94, 0x13, 0xDF, 0x60, 0x1F,
-    0x20, 0xDD, 0x1C, 0x83, 0xDC, 0xB2, 0x62, 0x7B, 0xEE, 0x05, 0xC8, 0x70, 0xC0, 0x29, 0x0D, 0x54,
-    0xC5, 0x56, 0x10, 0xCE, 0x30, 0xCA, 0x4D, 0x15, 0xA2, 0x21, 0xF3, 0x51, 0x40, 0x48, 0x77, 0xEF,
-    0xA5, 0x89, 0x96, 0x1B, 0xD7, 0x96, 0xC3, 0xAD, 0x74, 0xD0, 0x41, 0x3B, 0x98, 0x57, 0xD7, 0x30,
-    0x2F, 0x4B, 0x1F, 0x3C, 0x31, 0x87, 0x6B, 0xA0, 0x0E, 0x31, 0x33, 0xC8, 0x07, 0xCE, 0xCA, 0x57,
-    0xAC, 0x5D, 0xB1, 0x7C, 0x15, 0x33, 0x42, 0x01, 0xE9, 0xBA, 0xF8, 0x99, 0x95, 0xC4, 0x2F, 0x63,
-    0x41, 0xA2, 0x73, 0xC6, 0x1A, 0x22, 0x92, 0x06, 0x98, 0x7E, 0x90, 0xB1, 0x62, 0x81, 0x62, 0x91,
-    0x0B, 0x40, 0x39, 0x86, 0x7A, 0x13, 0x13, 0xD3, 0xF2, 0xA9, 0x67, 0x6D, 0x00, 0x97, 0xC5, 0xCA,
-    0x30, 0x5E, 0x32, 0xC2, 0x7A, 0xAB, 0x11, 0xBF, 0xA7, 0x23, 0x0B, 0xC0, 0x29, 0x11, 0x99, 0x55,
-    0x2D, 0xE7, 0x4D, 0x71, 0xBA, 0xFA, 0x8A, 0x15, 0xB2, 0xF5, 0xDC, 0xC7, 0x73, 0x23, 0xC3, 0x84,
-    0x0F, 0x5A, 0xC1, 0xEA, 0xBA, 0x2A, 0x5A, 0xD9, 0xD6, 0x2B, 0x19, 0xCF, 0x95, 0x65, 0xC8, 0xA9,
-    0xE2, 0xD5, 0x52, 0x4E, 0xDA, 0xC3, 0x8F, 0xE1, 0x42, 0x50, 0x62, 0x3A, 0xA2, 0xA2, 0x11, 0x1B,
-    0xEE, 0x1E, 0xE0, 0xD2, 0xAE, 0xE8, 0x9F, 0x16, 0xBC, 0x75, 0x75, 0xDA, 0xE6, 0x27, 0x2E, 0xBD,
-    0xDF, 0x2A, 0xDC, 0xEF, 0x76, 0xA5, 0xA9, 0xB3, 0xBB, 0x9D, 0xD6, 0x55, 0x7E, 0xB7, 0xBB, 0x65,
-    0x44, 0x7D, 0xFA, 0xE5, 0x00, 0xF7, 0x7D, 0x74, 0xB7, 0x3B, 0x06, 0xDD, 0xBC, 0xDF, 0xCE, 0x52,
-    0xBC, 0xEB, 0xDD, 0x24, 0xE5, 0x9B, 0xFE, 0x0D, 0x44, 0xDD, 0x9B, 0x1E, 0x32, 0xE8, 0x67, 0x66,
-    0xBA, 0x26, 0x19, 0x59, 0x22, 0x6D, 0x0D, 0xC1, 0xB0, 0x2A, 0x6E, 0x4D, 0x3A, 0x24, 0xBE, 0x4B,
-    0x7B, 0x14, 0xBF, 0xAC, 0x5B, 0x9D, 0x82, 0x27, 0xA5, 0x5F, 0x8F, 0x79, 0x9B, 0x7E, 0x39, 0xAA,
-    0x36, 0xEB, 0x26, 0xD5, 0xE4, 0x9D, 0x2F, 0x9C, 0x6A, 0x51, 0x98, 0x55, 0xA3, 0x77, 0xC1, 0x81,
-    0xB5, 0xAF, 0x0A, 0x57, 0xA0, 0x46, 0x38, 0xE5, 0xE9, 0x61, 0xDC, 0x2A, 0xE0, 0xB3, 0x09, 0xE4,
-    0x61, 0x49, 0xE8, 0x03, 0xE2, 0xD0, 0x40, 0x12, 0x07, 0xDE, 0x30, 0x83, 0x04, 0x20, 0xAB, 0x3C,
-    0x63, 0xD3, 0x56, 0x30, 0x13, 0x6B, 0x26, 0x6F, 0xAC, 0x0B, 0x8C, 0x83, 0x0A, 0x69, 0x8D, 0xBA,
-    0x55, 0xC1, 0x4F, 0xA6, 0x42, 0x26, 0x1A, 0x87, 0x3A, 0xA8, 0xDB, 0x32, 0xB0, 0xD8, 0x96, 0xD1,
-    0x56, 0x47, 0xE2, 0xBE, 0xCE, 0xF1, 0x6A, 0xC9, 0xA0, 0x01, 0x09, 0xBE, 0x60, 0x4F, 0x82, 0x6E,
-    0x04, 0x1D, 0xC9, 0x00, 0x04, 0xFA, 0x66, 0x77, 0xC0, 0x14, 0x10, 0x76, 0x5F, 0xA9, 0x6F, 0x6F,
-    0x3C, 0x38, 0x83, 0x2A, 0x79, 0x88, 0xAC, 0xCF, 0xFC, 0x10, 0x59, 0x53, 0xCA, 0x9A, 0x9F, 0xC9,
-    0x4A, 0xDA, 0x16, 0x8A, 0xC9, 0x18, 0xBB, 0x86, 0x25, 0x72, 0x03, 0x5C, 0xE1, 0x25, 0x92, 0x4F,
-    0x06, 0xF5, 0xB7, 0xB2, 0xF0, 0x96, 0x3E, 0x99, 0xF3, 0x21, 0x48, 0x3E, 0xC6, 0x5E, 0x2A, 0x1D,
-    0x54, 0x8F, 0x0C, 0x6B, 0x03, 0x76, 0xB2, 0x46, 0x7F, 0x39, 0x85, 0x68, 0x2B, 0x1A, 0x08, 0x13,
-    0xB8, 0x23, 0xAB, 0x75, 0xD9, 0xC6, 0xC4, 0x22, 0xC0, 0x07, 0x5B, 0x90, 0xE3, 0xB9, 0x74, 0xBA,
-    0x50, 0x31, 0x21, 0x02, 0xCB, 0x0B, 0xA8, 0x44, 0x49, 0xB0, 0xA9, 0x21, 0xE5, 0xE3, 0x0F, 0x53,
-    0xE4, 0x1F, 0x88, 0xCB, 0x57, 0xF1, 0x7F, 0x0B, 0x29, 0x09, 0x46, 0xE5, 0xC2, 0x81, 0xC0, 0xF5,
-    0x1C, 0xEA, 0xA4, 0x43, 0x82, 0xD7, 0x3B, 0x7E, 0xE7, 0xC1, 0x49, 0xB7, 0x4E, 0xBC, 0xED, 0xA4,
-    0xC3, 0x28, 0xB6, 0x6C, 0xBC, 0x06, 0x8C, 0x00, 0xB5, 0x7E, 0x03, 0xB5, 0x84, 0xB3, 0x84, 0xDA,
-    0xE0, 0x79, 0x41, 0xC0, 0x28, 0x11, 0x7A, 0x98, 0x90, 0x6D, 0x03, 0x86, 0xA1, 0x5E, 0xA6, 0xC6,
-    0x72, 0xBA, 0x31, 0x2E, 0xD0, 0xD0, 0x80, 0x84, 0x28, 0x47, 0x0B, 0xA9, 0x45, 0xC7, 0x92, 0x22,
-    0xD8, 0xF3, 0x1E, 0x01, 0xDF, 0x19, 0x6C, 0x6A, 0x30, 0xDD, 0xD0, 0x43, 0xD8, 0x46, 0x3F, 0x0D,
-    0x5F, 0x3C, 0x8B, 0x05, 0x9F, 0x07, 0xF6, 0x5C, 0xC1, 0x22, 0x60, 0x94, 0x25, 0x6A, 0x79, 0x89,
-    0x94, 0x44, 0x75, 0x97, 0x82, 0x00, 0x39, 0x44, 0x91, 0x8F, 0xC1, 0xE8, 0xD3, 0x9E, 0x28, 0x90,
-    0x77, 0x20, 0x4A, 0x08, 0x71, 0x2B, 0xD6, 0x15, 0x20, 0xE6, 0x28, 0x4F, 0xCE, 0xAE, 0x3C, 0x68,
-    0xBA, 0x4D, 0x4F, 0xF1, 0xB7, 0xCD, 0xBF, 0x68, 0xE0, 0x68, 0xF5, 0xFE, 0x87, 0xD0, 0xAC, 0x78,
-    0xEB, 0x23, 0x54, 0x7E, 0xFD, 0xC2, 0xC7, 0x90, 0xD3, 0xE4, 0xB7, 0x51, 0xB9, 0x8E, 0xF2, 0xDB,
-    0x88, 0x90, 0x11, 0xF9, 0x09, 0x4B, 0x93, 0x73, 0x1B, 0x94, 0x3F, 0xD2, 0x95, 0x6C, 0x62, 0xC0,
-    0xD1, 0x15, 0x50, 0x2E, 0xA8, 0x89, 0x7D, 0x0B, 0xB2, 0x67, 0xA4, 0x13, 0xF4, 0xEA, 0xF0, 0x56,
-    0x76, 0x3F, 0x78, 0xAA, 0x97, 0xC0, 0x82, 0xA1, 0xA6, 0x93, 0xD0, 0xA7, 0x42, 0x6B, 0xDC, 0xCA,
-    0x13, 0xB2, 0xF4, 0x3F, 0x11, 0x43, 0x61, 0x9C, 0x74, 0xC2, 0x22, 0xF9, 0x40, 0x94, 0xEC, 0xE0,
-    0x3F, 0x4D, 0x90, 0x0E, 0x56, 0x40, 0x9C, 0x82, 0x88, 0x3A, 0x12, 0xD1, 0xF2, 0xDD, 0x49, 0x0A,
-    0x48, 0xA8, 0x6E, 0x03, 0x64, 0x42, 0x3C, 0xD6, 0x42, 0x69, 0xD2, 0xE9, 0x21, 0xCE, 0x6B, 0xE3,
-    0x40, 0x24, 0x90, 0xA5, 0xA3, 0x54, 0x22, 0x2A, 0x76, 0x5E, 0xE9, 0x23, 0x05, 0xB5, 0xB1, 0x41,
-    0x08, 0x5D, 0x01, 0x26, 0x96, 0x5D, 0x0C, 0xE5, 0xE5, 0xA7, 0x7C, 0x29, 0xD4, 0x4B, 0xB3, 0x50,
-    0x07, 0xE2, 0x05, 0x42, 0x05, 0xBE, 0x61, 0x6E, 0xC0, 0xBE, 0x72, 0x24, 0x32, 0xF2, 0x22, 0x0A,
-    0x0E, 0x24, 0x7B, 0x69, 0xC7, 0x2B, 0x8B, 0x2D, 0xE2, 0x56, 0x7F, 0x58, 0xA2, 0xBF, 0xBC, 0x19,
-    0xE6, 0x21, 0x0E, 0xE2, 0xB7, 0x2A, 0xAB, 0xA2, 0x06, 0xF0, 0xF0, 0xDB, 0xE4, 0x4D, 0x0E, 0x30,
-    0x4A, 0xE3, 0xB7, 0x5F, 0x0D, 0x91, 0xD4, 0xE0, 0xE5, 0xDF, 0xC5, 0x05, 0xBB, 0xB3, 0x05, 0xB9,
-    0x66, 0xBD, 0x6E, 0x61, 0x43, 0x1B, 0xB2, 0x7F, 0x4E, 0x90, 0x5F, 0x84, 0x79, 0xC0, 0x58, 0x49,
-    0x30, 0x30, 0x39, 0x52, 0x71, 0xF2, 0x9F, 0x5B, 0x78, 0x71, 0x4F, 0x64, 0xB8, 0x8C, 0x9F, 0x4B,
-    0xC9, 0x9B, 0x02, 0x8B, 0x29, 0xB4, 0x8C, 0xCA, 0xFD, 0x5C, 0x2E, 0xD4, 0x20, 0x80, 0xA1, 0x7E,
-    0x6B, 0x48, 0x95, 0x37, 0xAB, 0x56, 0xF6, 0x9F, 0x3B, 0x48, 0xFD, 0x6D, 0x80, 0xA0, 0x77, 0x45,
-    0xEF, 0x43, 0x6B, 0x87, 0x2F, 0xF0, 0xC1, 0x48, 0x6C, 0xEA, 0x50, 0xF3, 0xE0, 0x21, 0xBF, 0xA4,
-    0x9A, 0x9E, 0xE1, 0xB7, 0x7B, 0x0B, 0x88, 0xD9, 0xF3, 0x35, 0x2D, 0x76, 0x35, 0x88, 0xEC, 0x53,
-    0xA4, 0x31, 0xD2, 0x39, 0x9B, 0xCA, 0x36, 0xEF, 0x03, 0x71, 0x22, 0x75, 0xE2, 0xD1, 0x4A, 0x5B,
-    0xA0, 0x85, 0x2C, 0x99, 0xFE, 0x2D, 0x28, 0x7A, 0xA0, 0x4F, 0xA3, 0xEC, 0xE9, 0x88, 0x02, 0xB2,
-    0x7B, 0x07, 0x24, 0x12, 0x0D, 0x48, 0xD9, 0xFF, 0x94, 0x70, 0x55, 0x2F, 0x35, 0x28, 0x5E, 0xB6,
-    0x42, 0x1F, 0xD7, 0x68, 0xD6, 0xFB, 0x7A, 0x4D, 0xBB, 0x43, 0xC7, 0xBB, 0x15, 0x04, 0xFB, 0xAA,
-    0xD9, 0x28, 0xD3, 0x6D, 0x29, 0x23, 0xDB, 0xCA, 0x4C, 0xE7, 0x95, 0xE9, 0x17, 0x65, 0xCA, 0x3B,
-    0x88, 0xDB, 0x29, 0xB0, 0x96, 0xA2, 0x25, 0x5E, 0x22, 0x1D, 0x9F, 0xF6, 0x4B, 0x44, 0xA1, 0x45,
-    0xFB, 0x5B, 0xD4, 0xD5, 0xCA, 0xE3, 0x62, 0x3E, 0x87, 0x83, 0x11, 0xED, 0xF9, 0x76, 0x3F, 0x22,
-    0x25, 0x69, 0xD1, 0x18, 0x1A, 0x99, 0xD5, 0x12, 0xA7, 0xD9, 0x0C, 0xC0, 0x45, 0x0A, 0xA0, 0xE5,
-    0xDD, 0x80, 0xCC, 0xC3, 0xA8, 0xD0, 0x36, 0x51, 0xD8, 0x6A, 0x57, 0xB8, 0x22, 0xFD, 0x4C, 0x2E,
-    0x2F, 0xE5, 0x1B, 0x37, 0xC4, 0xDF, 0xEF, 0x02, 0x37, 0x9D, 0x34, 0xCC, 0x5A, 0xB4, 0xF8, 0x36,
-    0x65, 0x53, 0x40, 0xD7, 0x60, 0xD6, 0x3A, 0xF4, 0xE6, 0xFF, 0x58, 0xF7, 0x3E, 0x00, 0xAE, 0x71,
-    0xDE, 0xB4, 0xFA, 0x2F, 0x66, 0x11, 0x2B, 0xD1, 0x1A, 0x06, 0x20, 0x79, 0xB0, 0x03, 0xF7, 0xD7,
-    0x0E, 0x6C, 0xB3, 0xB9, 0xE8, 0xF2, 0x71, 0xCD, 0x7C, 0x83, 0xFB, 0x1A, 0xEC, 0x16, 0x77, 0x72,
-    0x4B, 0xB7, 0x85, 0x40, 0x31, 0x61, 0xA1, 0x10, 0xA3, 0xD1, 0x57, 0x57, 0x43, 0x57, 0x75, 0xF3,
-    0xBF, 0x52, 0x86, 0x2D, 0x0A, 0x25, 0xEB, 0xD9, 0x1B, 0x96, 0x74, 0x75, 0x69, 0xCC, 0x6E, 0x9E,
-    0xCF, 0xF7, 0xEF, 0xB8, 0xFB, 0x7B, 0x2C, 0xE9, 0x3B, 0x76, 0x64, 0xED, 0xD2, 0x63, 0x6C, 0x1D,
-    0xD8, 0xED, 0x3F, 0x58, 0xDF, 0xD5, 0xCD, 0x74, 0x54, 0x7D, 0x3A, 0x68, 0xF4, 0xA3, 0xB6, 0xCA,
-    0x41, 0x8D, 0xD4, 0x29, 0xFB, 0x6E, 0x9E, 0xE5, 0xB1, 0x95, 0xEE, 0xA5, 0xFC, 0x18, 0x70, 0xF0,
-    0x1E, 0xE2, 0xE5, 0x0D, 0xF0, 0xC9, 0x0A, 0x25, 0xF3, 0x2C, 0x36, 0x23, 0x3F, 0x9A, 0xFE, 0x17,
-    0x3F, 0x72, 0xCB, 0x59, 0x07, 0xAE, 0xE4, 0xFA, 0x31, 0xD1, 0xFF, 0xAE, 0xFF, 0x27, 0x9A, 0xE1,
-    0x53, 0x7F, 0xE2, 0x1D, 0xCC, 0x3C, 0x95, 0x0D, 0x0C, 0xDD, 0xB3, 0xB9, 0x80, 0x53, 0x1D, 0xDB,
-    0x0C, 0x10, 0x93, 0x96, 0x86, 0xE6, 0xFF, 0x50, 0x2C, 0x5D, 0x6C, 0xD2, 0x71, 0xE7, 0x19, 0x19,
-    0x42, 0x5A, 0x57, 0x0C, 0x68, 0x13, 0x82, 0x9A, 0x6B, 0x62, 0x45, 0x87, 0xF5, 0x7E, 0x98, 0xD3,
-    0x76, 0x79, 0x6E, 0x31, 0x86, 0x40, 0x29, 0x3B, 0x1E, 0xC1, 0x91, 0x1E, 0xF0, 0x48, 0x27, 0xA8,
-    0x79, 0x76, 0xAC, 0x43, 0x3A, 0x83, 0xF7, 0x4A, 0x18, 0x64, 0x9D, 0x7E, 0x72, 0x15, 0xF0, 0x34,
-    0x05, 0x02, 0xD3, 0x27, 0xFE, 0x85, 0x61, 0x39, 0x48, 0x0D, 0xE5, 0x3F, 0x85, 0x39, 0xB3, 0x2E,
-    0xE7, 0x71, 0x55, 0xA7, 0x86, 0x92, 0x24, 0xC6, 0xA9, 0x13, 0x24, 0xD6, 0xFB, 0xE3, 0xB9, 0xB8,
-    0x5F, 0xFB, 0x2A, 0x84, 0x8F, 0x79, 0xAE, 0xFE, 0xBF, 0x93, 0xF7, 0x24, 0xB6, 0x21, 0xC5, 0xDD,
-    0xE1, 0x81, 0x38, 0x40, 0xB3, 0x27, 0xD7, 0x8F, 0xD2, 0xFB, 0x23, 0xB4, 0xCB, 0xFC, 0x4D, 0x90,
-    0x1B, 0x74, 0x97, 0x0F, 0x0D, 0x3F, 0xDB, 0x66, 0xC4, 0x1D, 0x70, 0xC5, 0x27, 0x50, 0xB3, 0x41,
-    0x32, 0xA0, 0x23, 0x7B, 0x73, 0x4D, 0x2F, 0xA2, 0xDB, 0x38, 0xB6, 0x1D, 0x32, 0xD8, 0x04, 0x26,
-    0x24, 0xAF, 0x02, 0x5B, 0x65, 0x05, 0x2F, 0xCF, 0x07, 0x86, 0x87, 0x59, 0xCD, 0x66, 0xCD, 0x6D,
-    0x47, 0x83, 0x5F, 0xD9, 0x7F, 0xB3, 0x09, 0x27, 0x2A, 0x88, 0x5C, 0xBC, 0x7E, 0xF1, 0x80, 0x00,
-    0x08, 0x57, 0xA0, 0x38, 0x6F, 0x3B, 0x83, 0x06, 0x5F, 0x54, 0x64, 0x21, 0x4C, 0xE7, 0x80, 0x38,
-    0x7A, 0x22, 0x32, 0x85, 0xA9, 0x72, 0x4D, 0x9E, 0xE2, 0x19, 0x5B, 0xCD, 0x77, 0x0C, 0x3B, 0x1A,
-    0x04, 0x9A, 0x7E, 0x1E, 0x08, 0x74, 0x05, 0xF4, 0xE0, 0x15, 0xF0, 0xED, 0x5D, 0xD2, 0x03, 0xD4,
-    0x2C, 0x7F, 0x9E, 0x1A, 0x5C, 0x93, 0x43, 0x39, 0x34, 0x09, 0x6C, 0x66, 0x52, 0x70, 0x67, 0x93,
-    0xF9, 0xB4, 0x37, 0xF9, 0x49, 0xDE, 0x69, 0xF5, 0xB6, 0x6A, 0x75, 0xB9, 0x0B, 0xD0, 0xD0, 0x25,
-    0x64, 0xD8, 0x2B, 0x11, 0x53, 0xB7, 0xCA, 0x63, 0xE4, 0x09, 0xA4, 0xD5, 0x1D, 0x8B, 0x5F, 0x8B,
-    0x2A, 0xA9, 0x1B, 0x56, 0x4F, 0x2C, 0x02, 0x0B, 0x3D, 0xC3, 0xA3, 0x8B, 0x3F, 0x32, 0x97, 0xFE,
-    0x45, 0xA2, 0x14, 0x6B, 0x3B, 0x0F, 0x2D, 0x68, 0x14, 0xD2, 0xB2, 0x05, 0x50, 0xC2, 0xE1, 0x90,
-    0xE1, 0xB1, 0x93, 0x26, 0xE4, 0xD1, 0x24, 0x0D, 0x6C, 0x8A, 0x44, 0x3E, 0x44, 0x8E, 0x40, 0x7A,
-    0x50, 0x77, 0x56, 0x30, 0x52, 0xBC, 0x89, 0x1E, 0x9B, 0xE8, 0xAE, 0x99, 0x41, 0x71, 0x4C, 0x3A,
-    0x7B, 0xCC, 0x50, 0xD8, 0x27, 0x05, 0x37, 0x81, 0x71, 0x84, 0xCE, 0x9F, 0xE5, 0x21, 0xE4, 0x6F,
-    0x68, 0x19, 0xED, 0x9A, 0x95, 0x12, 0x1A, 0x03, 0x36, 0x86, 0x86, 0x1A, 0x92, 0x1E, 0xD6, 0x28,
-    0xFC, 0xF0, 0x9C, 0x8F, 0xCD, 0x12, 0x91, 0x83, 0xC7, 0x80, 0x6C, 0x24, 0x01, 0x9F, 0xEB, 0x43,
-    0x2B, 0x15, 0x8A, 0xFD, 0x10, 0x86, 0x09, 0x84, 0xEC, 0x88, 0x4C, 0x53, 0x8D, 0xC1, 0x8D, 0x5B,
-    0x25, 0xF7, 0x58, 0x2E, 0x21, 0x5C, 0x7B, 0x6E, 0x7D, 0xA9, 0x0B, 0x85, 0x7F, 0x53, 0xFB, 0x3B,
-    0x46, 0x1B, 0x98, 0x11, 0x09, 0xC4, 0x91, 0xBC, 0xFE, 0x90, 0xCF, 0x55, 0xF9, 0x43, 0xA0, 0x1A,
-    0xD6, 0x6D, 0x95, 0xF5, 0x48, 0x15, 0x6A, 0x29, 0xEE, 0xF0, 0xC8, 0xF2, 0x12, 0x0F, 0x60, 0x88,
-    0x47, 0x5B, 0xFC, 0x02, 0xAB, 0x43, 0x65, 0xD3, 0x10, 0x11, 0x61, 0x3B, 0xF4, 0x91, 0x7F, 0x09,
-    0x47, 0x3F, 0x07, 0x97, 0x62, 0x04, 0xFE, 0x07, 0xBD, 0x59, 0x3D, 0x8C, 0xDD, 0xC6, 0x11, 0x1E,
-    0x92, 0x92, 0xE8, 0x88, 0x40, 0xD6, 0x85, 0x9C, 0x18, 0x11, 0x20, 0x36, 0x0E, 0xE0, 0x20, 0x56,
-    0xD8, 0x5E, 0x00, 0xE9, 0x76, 0x65, 0x03, 0x6E, 0x54, 0xF8, 0x0A, 0x2B, 0x29, 0x5C, 0xA8, 0xB5,
-    0x55, 0x58, 0x8D, 0xCA, 0xE8, 0x48, 0x39, 0x45, 0x80, 0xA4, 0xC8, 0x15, 0x09, 0x52, 0xA4, 0x88,
-    0x80, 0x20, 0x80, 0x73, 0x29, 0xA2, 0xC2, 0x45, 0x0A, 0xDD, 0x71, 0x61, 0x17, 0x2E, 0x0C, 0x24,
-    0xB4, 0x8D, 0x20, 0x85, 0x0B, 0x31, 0x90, 0x1C, 0x04, 0x76, 0x61, 0x1A, 0xA6, 0x2C, 0x5A, 0x47,
-    0x72, 0xF3, 0x7D, 0x4B, 0xBE, 0xFB, 0x11, 0x94, 0xC0, 0xC1, 0x93, 0x8E, 0xF7, 0x76, 0xF9, 0x8E,
-    0x3F, 0xF3, 0xB7, 0x33, 0xDF, 0xCC, 0xEC, 0x93, 0x57, 0x83, 0x31, 0x1C, 0x83, 0x41, 0xD6, 0x44,
-    0x82, 0xB5, 0xA8, 0x89, 0x9B, 0xA4, 0x56, 0xB5, 0xAA, 0x52, 0x9B, 0x59, 0x6D, 0x75, 0x91, 0x17,
-    0xA5, 0xB9, 0x24, 0x3C, 0x12, 0x2B, 0xAA, 0x90, 0xB2, 0x8B, 0x5D, 0xAF, 0xC6, 0x36, 0xAB, 0x45,
-    0xE3, 0x3F, 0x23, 0x4E, 0xF8, 0x19, 0xFD, 0xEC, 0xAE, 0xD9, 0xDC, 0xD9, 0xCC, 0xD9, 0x78, 0x94,
-    0xA8, 0x92, 0xC8, 0x4A, 0x60, 0x64, 0x3E, 0xF2, 0xAF, 0x44, 0x42, 0x87, 0x87, 0x62, 0x37, 0x88,
-    0xA8, 0xF6, 0x09, 0x4C, 0x35, 0xAE, 0xA7, 0x15, 0x27, 0x8B, 0x29, 0xC3, 0x14, 0x39, 0x67, 0xF0,
-    0x04, 0xA6, 0x63, 0xE5, 0x26, 0xAE, 0x95, 0x7C, 0x15, 0x2F, 0x09, 0x24, 0xC4, 0xAB, 0x2D, 0x1F,
-    0x73, 0x0E, 0xBC, 0x9D, 0xAB, 0x38, 0x59, 0x39, 0x22, 0x72, 0xF6, 0xB5, 0xB3, 0xB9, 0x1B, 0x53,
-    0xD7, 0xA5, 0xD7, 0xBA, 0x4C, 0x6E, 0xE2, 0x93, 0x9A, 0x5E, 0x7D, 0xDA, 0x69, 0x37, 0xAC, 0x96,
-    0x5B, 0x4F, 0xC8, 0x89, 0xD4, 0xC6, 0x6D, 0x5A, 0xA9, 0x46, 0x55, 0x99, 0x4D, 0x6A, 0x6D, 0xE2,
-    0xC6, 0x49, 0xF4, 0x79, 0x2F, 0xD1, 0xBD, 0x16, 0x32, 0x35, 0x12, 0x80, 0xCE, 0xF7, 0xDD, 0xBF,
-    0x41, 0xB0, 0x97, 0x6F, 0x8D, 0x2F, 0x7B, 0x66, 0x39, 0xAE, 0x3B, 0x8C, 0x1F, 0x7F, 0x65, 0x24,
-    0x02, 0xDF, 0xB8, 0x11, 0xF9, 0xC9, 0xEE, 0x41, 0xB1, 0x4E, 0xEC, 0xFE, 0xF7, 0xAA, 0xD7, 0x30,
-    0xA3, 0x11, 0x9C, 0x09, 0x87, 0x8B, 0xFE, 0x85, 0xA8, 0x87, 0xD4, 0xAE, 0xC0, 0x68, 0x25, 0xBE,
-    0xD7, 0x8B, 0xB2, 0x03, 0xC6, 0x96, 0xA8, 0xAA, 0x97, 0xC4, 0x91, 0x31, 0x34, 0xCF, 0x61, 0x82,
-    0xA4, 0xF1, 0xD4, 0xDB, 0x94, 0x0C, 0xAD, 0xE4, 0xE3, 0x64, 0xB0, 0x67, 0x4F, 0xC9, 0xA0, 0xA5,
-    0xD7, 0x72, 0xE2, 0xC4, 0x6C, 0xC2, 0x93, 0xA0, 0x26, 0xDB, 0xBF, 0xED, 0x24, 0xAA, 0x25, 0x13,
-    0x25, 0xAF, 0x25, 0xF6, 0x74, 0xEC, 0xDE, 0xAE, 0x56, 0xD2, 0x73, 0xA6, 0xB9, 0x72, 0x56, 0xE4,
-    0xC6, 0x8D, 0x33, 0x22, 0x57, 0x1A, 0x48, 0xB7, 0xE2, 0x27, 0xFF, 0x2F, 0x6F, 0xBC, 0xB5, 0x92,
-    0x89, 0x34, 0xCF, 0x25, 0xEE, 0x8D, 0x5A, 0x05, 0xDB, 0xB1, 0x8D, 0x2B, 0x10, 0x08, 0xC6, 0x1F,
-    0x41, 0xC4, 0x94, 0x62, 0xCC, 0x47, 0xF8, 0x55, 0xAD, 0x5C, 0x95, 0x9E, 0xB7, 0x3A, 0xB6, 0xAB,
-    0x89, 0x3D, 0xAB, 0x8A, 0xD5, 0xCC, 0x68, 0x27, 0xC9, 0xCF, 0x45, 0x9E, 0x0C, 0x60, 0x68, 0xBC,
-    0xE7, 0x54, 0x13, 0xF5, 0xDA, 0xAA, 0xD6, 0x99, 0xEC, 0x83, 0x41, 0xF4, 0x3B, 0xBD, 0x64, 0x6F,
-    0x43, 0xBB, 0x7A, 0x84, 0x22, 0x25, 0x14, 0xC9, 0x25, 0x34, 0xCF, 0x78, 0x72, 0x25, 0xAC, 0xC1,
-    0x71, 0x69, 0xF3, 0xCF, 0x70, 0x03, 0x75, 0x60, 0x1C, 0x7D, 0x59, 0x0F, 0x79, 0x9F, 0xF7, 0x0F,
-    0xD5, 0xEC, 0xF8, 0xAF, 0xA0, 0x99, 0x72, 0xCF, 0x57, 0x2B, 0xEA, 0xA4, 0x6D, 0xAE, 0xA8, 0xC8,
-    0xDE, 0xB8, 0x81, 0xE9, 0x4A, 0xA3, 0x2E, 0x16, 0x2B, 0x8D, 0x1A, 0xA1, 0x99, 0x7A, 0x1D, 0x9A,
-    0x29, 0x65, 0xDE, 0x5A, 0x51, 0xB1, 0x6D, 0x9E, 0x53, 0xD1, 0x07, 0xB5, 0xFA, 0x86, 0xFC, 0xE6,
-    0xA1, 0x9A, 0x3D, 0x75, 0xE1, 0x82, 0x76, 0x63, 0x4E, 0xBF, 0xF3, 0x8E, 0xDC, 0x89, 0x1E, 0x65,
-    0x2B, 0x33, 0x9D, 0x2A, 0x5A, 0x55, 0xF4, 0xA9, 0xC9, 0x9D, 0xA4, 0xBD, 0xF7, 0xD5, 0xEF, 0xE1,
-    0xFE, 0xEA, 0xC1, 0xB1, 0xD0, 0x82, 0xE3, 0xC1, 0x7B, 0xF2, 0x94, 0xC8, 0xA5, 0xCD, 0xCD, 0xBD,
-    0xFB, 0x27, 0xE0, 0xC1, 0x45, 0xE2, 0xAA, 0xE8, 0x7C, 0x2D, 0x49, 0x85, 0xF5, 0x16, 0x98, 0x03,
-    0xEB, 0x4D, 0x8F, 0x2D, 0x72, 0x57, 0x5C, 0x82, 0x53, 0xFB, 0x67, 0x62, 0x57, 0x05, 0x71, 0x2D,
-    0x71, 0x15, 0x38, 0x13, 0x61, 0xC5, 0xD3, 0x02, 0x0F, 0xFF, 0x30, 0x2F, 0x60, 0xED, 0x93, 0x77,
-    0x84, 0xDE, 0x93, 0xB4, 0xA9, 0x05, 0x8B, 0x4B, 0xF2, 0x47, 0x04, 0xC0, 0x28, 0x88, 0xD1, 0x60,
-    0x08, 0x7B, 0xFE, 0x45, 0x7D, 0xD4, 0x4D, 0x7F, 0x71, 0x1B, 0xB7, 0xAA, 0x49, 0x1A, 0xB8, 0x76,
-    0xAB, 0xB1, 0x76, 0xAE, 0x52, 0x6E, 0xC7, 0xA6, 0x9F, 0xFD, 0xCD, 0x32, 0x98, 0x34, 0x07, 0x0C,
-    0x9B, 0x9B, 0x29, 0x90, 0x38, 0x02, 0x44, 0x0F, 0x9E, 0xAB, 0x53, 0xF7, 0x65, 0xAD, 0xDD, 0x3F,
-    0x1F, 0x3A, 0x32, 0x0C, 0x85, 0x11, 0x63, 0xC8, 0x05, 0x8C, 0xE0, 0x6B, 0x0C, 0x46, 0xB1, 0xD1,
-    0x36, 0xB7, 0xDA, 0x1C, 0x91, 0xA4, 0x50, 0x75, 0xD4, 0x44, 0x4D, 0xD9, 0xE4, 0xE0, 0x2F, 0xDB,
-    0xF1, 0xA0, 0xFB, 0xF5, 0xFE, 0xBB, 0x5D, 0xD8, 0x86, 0x2D, 0xAF, 0xC7, 0xF5, 0xB1, 0x8D, 0xB8,
-    0xCB, 0xC6, 0x75, 0x7D, 0x33, 0xEB, 0xB2, 0x6E, 0xB5, 0xDF, 0xCA, 0x3B, 0x00, 0x01, 0xDF, 0xB4,
-    0x37, 0x77, 0x7D, 0x29, 0xEA, 0xB4, 0xA1, 0xAF, 0x79, 0x7F, 0x43, 0xC8, 0x66, 0x1F, 0x0E, 0x52,
-    0x9E, 0x6F, 0x65, 0x1D, 0x86, 0x7B, 0x22, 0x28, 0x16, 0xC0, 0x02, 0x23, 0x86, 0x0E, 0xD6, 0x43,
-    0xFC, 0x69, 0xD1, 0x83, 0x6C, 0xC9, 0xD3, 0x7D, 0xD0, 0x89, 0xF4, 0x11, 0x02, 0xAB, 0xC7, 0x12,
-    0x04, 0x5D, 0xF6, 0x7C, 0x1F, 0xB6, 0xEB, 0x49, 0x17, 0x35, 0x7D, 0xDA, 0x86, 0xBF, 0x6F, 0xF2,
-    0x06, 0xAB, 0x73, 0xAF, 0x91, 0xF4, 0xA7, 0xB7, 0x1B, 0xD1, 0xEA, 0xA3, 0x3B, 0x72, 0x53, 0x39,
-    0x3C, 0xA2, 0x5C, 0x0B, 0xDA, 0xCA, 0xE2, 0xA5, 0xE3, 0x66, 0x1F, 0x7D, 0xF1, 0x0C, 0xC4, 0x73,
-    0x98, 0x58, 0xCC, 0x3C, 0x26, 0x26, 0xE4, 0xB2, 0x46, 0x36, 0x17, 0x07, 0x01, 0x1F, 0xAC, 0x21,
-    0x18, 0x3D, 0xAD, 0x05, 0x9C, 0xF8, 0x02, 0x1C, 0x61, 0x9B, 0x2B, 0x1C, 0xE2, 0x05, 0xED, 0x51,
-    0xAF, 0x17, 0x6D, 0xF0, 0x64, 0x00, 0x97, 0x8C, 0xEB, 0xD0, 0x11, 0x1C, 0xC2, 0xCD, 0x37, 0x11,
-    0x64, 0x74, 0x4F, 0x27, 0x61, 0xA3, 0x80, 0xA1, 0xF5, 0x11, 0x2F, 0x88, 0x2A, 0xB4, 0xC0, 0x43,
-    0xB6, 0x24, 0x1E, 0xC8, 0x51, 0x93, 0x61, 0xA6, 0xEC, 0xF8, 0x71, 0x99, 0xBD, 0x30, 0xB8, 0x61,
-    0x3D, 0xE9, 0x2F, 0x5F, 0xEF, 0x33, 0x80, 0x59, 0x73, 0xB5, 0x93, 0xE4, 0xFD, 0xBB, 0x2D, 0xB4,
-    0xFA, 0x57, 0x2B, 0x3A, 0x76, 0xA3, 0xF4, 0x00, 0xDB, 0x10, 0xF0, 0x53, 0x43, 0xAB, 0x63, 0x1B,
-    0xA0, 0x2B, 0x71, 0x47, 0xFF, 0x27, 0x98, 0xF9, 0xE3, 0xF8, 0x06, 0xF5, 0xD2, 0x36, 0x40, 0x90,
-    0x0F, 0x92, 0x35, 0x82, 0xF5, 0x2A, 0xE9, 0x29, 0x6B, 0xE5, 0xA7, 0x8D, 0x76, 0x2D, 0x62, 0x28,
-    0x78, 0x79, 0x01, 0x0F, 0x1E, 0xAA, 0x89, 0x56, 0xE2, 0x95, 0x96, 0x76, 0xF7, 0x06, 0xBF, 0x69,
-    0x9A, 0x23, 0xE7, 0x34, 0x76, 0xC4, 0x6B, 0x44, 0x60, 0x74, 0xB7, 0x27, 0xB4, 0xF5, 0x84, 0xFA,
-    0x9E, 0x00, 0xDF, 0xD3, 0x21, 0x11, 0x86, 0xE5, 0xAF, 0x07, 0x62, 0xE5, 0xC8, 0x8C, 0x30, 0x12,
-    0xF4, 0x1D, 0xE9, 0x96, 0xB4, 0x4D, 0xC9, 0x3C, 0x50, 0xD2, 0x6F, 0xF3, 0x5D, 0x5C, 0xA2, 0x23,
-    0xFB, 0x2C, 0x40, 0x0B, 0x72, 0x39, 0x0E, 0x87, 0x6F, 0x42, 0x24, 0x4E, 0xC9, 0x37, 0x47, 0x78,
-    0x06, 0x5D, 0x62, 0x1F, 0x3B, 0xDF, 0xB4, 0x80, 0x65, 0xF3, 0x1D, 0xB8, 0xC8, 0x7D, 0xA4, 0x02,
-    0xA9, 0x7F, 0xF0, 0xF8, 0x55, 0x3D, 0x95, 0xC0, 0xD3, 0x35, 0x33, 0xB0, 0x86, 0x96, 0x72, 0xE2,
+static const uint8_t notosans_12_bolditalicBitmaps[30636] = {
+    0xC5, 0x58, 0xBF, 0x93, 0xDE, 0x46, 0x19, 0x5E, 0x49, 0xB1, 0x35, 0x13, 0xCD, 0xB0, 0x14, 0x4E,
+    0xAD, 0x86, 0x82, 0x50, 0x44, 0xFF, 0x01, 0x2B, 0x3B, 0x33, 0x49, 0x91, 0xC2, 0x29, 0x38, 0x28,
+    0x52, 0x84, 0x22, 0x85, 0xC7, 0xC3, 0xCC, 0xFD, 0x05, 0xF1, 0xCA, 0x49, 0x91, 0x82, 0x02, 0x37,
+    0xD4, 0xB8, 0x08, 0x33, 0x87, 0x29, 0xA0, 0xA4, 0x48, 0x6E, 0x85, 0x5D, 0x50, 0xA4, 0x40, 0x71,
+    0x8A, 0x94, 0x5E, 0x0F, 0xA9, 0x92, 0x61, 0x4E, 0xC1, 0x72, 0x2C, 0x72, 0x92, 0x96, 0xE7, 0x79,
+    0x57, 0xBA, 0xFB, 0xCE, 0x39, 0x03, 0x21, 0x05, 0xDF, 0x27, 0xE9, 0xBE, 0xD3, 0x8F, 0xDD, 0xF7,
+    0xC7, 0xF3, 0x3E, 0xEF, 0xB3, 0x4A, 0x96, 0x74, 0x49, 0xE7, 0x6C, 0xC2, 0x77, 0xCC, 0x87, 0xA2,
+    0x2F, 0x7A, 0xED, 0x75, 0xA7, 0x5B, 0x85, 0x4F, 0xA5, 0x6C, 0xE3, 0x1A, 0xAB, 0x9E, 0x53, 0x2A,
+    0xF7, 0x0A, 0xE7, 0x4C, 0xAD, 0x0E, 0x55, 0x32, 0xA9, 0x6C, 0x50, 0x79, 0xAF, 0xB4, 0x9C, 0x2B,
+    0x5B, 0x55, 0x35, 0xBC, 0xC2, 0x4D, 0x6D, 0x9B, 0xFC, 0x8B, 0xF3, 0xB8, 0x8A, 0x7B, 0xF2, 0x8E,
+    0xC3, 0xF1, 0xC2, 0xC9, 0x29, 0xDD, 0x71, 0x2B, 0xFC, 0xBA, 0x71, 0xAC, 0xEE, 0xCC, 0x70, 0x56,
+    0xA9, 0x79, 0x9D, 0x0B, 0x17, 0xAB, 0x96, 0x27, 0xA2, 0x89, 0xBA, 0x2D, 0x1B, 0x0C, 0xA5, 0x2E,
+    0xFC, 0xC4, 0xCC, 0x76, 0xB2, 0xD3, 0x4B, 0xCA, 0x35, 0xA1, 0x71, 0xEA, 0x92, 0x4C, 0xA2, 0xAA,
+    0x51, 0xA9, 0x10, 0x54, 0x16, 0x42, 0x5D, 0x8C, 0xA6, 0xD1, 0xBD, 0x69, 0xAB, 0xCE, 0xB4, 0xFC,
+    0xDA, 0x06, 0x7B, 0x6D, 0x5A, 0xA7, 0x0C, 0xEE, 0xB7, 0x75, 0x50, 0x4E, 0x05, 0x7C, 0x5D, 0xB2,
+    0x28, 0xF7, 0xF2, 0xA4, 0x6C, 0x18, 0x54, 0x15, 0x60, 0x56, 0xA8, 0xE3, 0x58, 0x45, 0xAF, 0x6C,
+    0x9F, 0x06, 0x5F, 0x86, 0xCE, 0x85, 0xD6, 0xEC, 0xB7, 0x3F, 0x34, 0x30, 0xAE, 0xC1, 0xA3, 0x78,
+    0x12, 0x0F, 0xAA, 0x45, 0xAC, 0x9C, 0x55, 0x0A, 0x43, 0xB1, 0x8D, 0x2A, 0x1F, 0xD6, 0x27, 0x31,
+    0x84, 0x0B, 0x5D, 0x1A, 0x42, 0xAF, 0x66, 0x3D, 0xA8, 0x9F, 0xF3, 0x02, 0x77, 0xDD, 0xC3, 0x44,
+    0xC4, 0xC3, 0xB6, 0x2A, 0xC1, 0x00, 0xC5, 0x84, 0x7F, 0x3D, 0xC6, 0x6A, 0x54, 0x36, 0xE3, 0x2A,
+    0xEE, 0x30, 0x21, 0x34, 0x16, 0xD6, 0x73, 0x97, 0xB1, 0xF6, 0x67, 0xF1, 0x06, 0x7B, 0x9B, 0x74,
+    0x06, 0xCF, 0x96, 0xD8, 0x11, 0x11, 0xA4, 0x47, 0xBD, 0x01, 0x0B, 0xC2, 0x67, 0xD8, 0xE1, 0xF5,
+    0x45, 0xFC, 0xA6, 0x5D, 0x0C, 0x15, 0xFE, 0xDE, 0x4A, 0xE1, 0x5B, 0x98, 0xB1, 0x0F, 0xF0, 0xAC,
+    0x51, 0xAB, 0x61, 0x98, 0xA1, 0x84, 0x0D, 0x16, 0x7B, 0xF0, 0x18, 0x18, 0x91, 0x3F, 0xEA, 0x54,
+    0xF5, 0x1B, 0x44, 0xB8, 0x6A, 0x93, 0xC9, 0x34, 0xD9, 0x60, 0x6A, 0xDD, 0x59, 0x55, 0x7D, 0x1E,
+    0x6E, 0xC3, 0x96, 0x1E, 0xBB, 0x7F, 0x61, 0x6F, 0xA9, 0x99, 0x0D, 0x3A, 0x4A, 0x4F, 0xE1, 0x9B,
+    0xC7, 0xC0, 0x9D, 0xA2, 0x4D, 0xF3, 0x5E, 0x0D, 0xCF, 0x99, 0x29, 0xF1, 0xB0, 0xC0, 0x7C, 0x1A,
+    0xF3, 0x16, 0x5F, 0xC0, 0x3F, 0x45, 0x1F, 0xDC, 0xBA, 0x07, 0xD8, 0xB4, 0xE0, 0x91, 0xE9, 0x29,
+    0x9B, 0xF0, 0x49, 0x11, 0xA7, 0x12, 0x63, 0x22, 0x66, 0x09, 0x1E, 0xE1, 0x14, 0x08, 0xBE, 0xD2,
+    0x0F, 0x6F, 0xAB, 0xF2, 0xC1, 0x82, 0xAC, 0x04, 0x65, 0x1E, 0x3B, 0xE4, 0xCF, 0x34, 0xA7, 0x5F,
+    0xE6, 0x32, 0xE0, 0xB1, 0x19, 0xF3, 0x8D, 0x18, 0x22, 0xC2, 0x2C, 0xC7, 0xE0, 0x1A, 0x76, 0x73,
+    0xBF, 0xB0, 0x67, 0x71, 0x12, 0x19, 0x63, 0xB2, 0x90, 0xE5, 0x38, 0xF0, 0x1A, 0x02, 0x83, 0x10,
+    0xBA, 0x78, 0x29, 0x45, 0xEC, 0xF3, 0x69, 0xCD, 0x8E, 0x8F, 0x97, 0x22, 0x9A, 0x66, 0xA2, 0xA9,
+    0xC9, 0x16, 0xD7, 0x66, 0x43, 0xD9, 0xE5, 0xBD, 0xEE, 0xF2, 0xA1, 0x6C, 0xB3, 0xC9, 0x36, 0x49,
+    0x60, 0xEC, 0x51, 0x0A, 0x98, 0xBB, 0xFA, 0x6A, 0xC1, 0x2C, 0xC4, 0x93, 0x8D, 0x7B, 0x8D, 0xE3,
+    0x17, 0xB4, 0x7B, 0xC2, 0x75, 0x7F, 0xEA, 0xA7, 0x1B, 0x10, 0x72, 0xDA, 0x0B, 0xBB, 0xBD, 0xAB,
+    0x4F, 0xFC, 0xA9, 0x79, 0x84, 0x7F, 0xF7, 0x43, 0x4D, 0x5F, 0x75, 0x70, 0x2A, 0x79, 0x1F, 0xE3,
+    0x03, 0x5B, 0x62, 0x73, 0x39, 0x48, 0xC8, 0x1D, 0x62, 0xE6, 0xC6, 0x38, 0x54, 0x32, 0xE4, 0x53,
+    0x81, 0x8A, 0x50, 0xF5, 0xE9, 0xF0, 0x3B, 0xB5, 0x50, 0xD6, 0xC4, 0x98, 0x13, 0xB0, 0x3E, 0xA7,
+    0xBE, 0xF9, 0xD9, 0x2D, 0x62, 0x96, 0xDC, 0x69, 0x26, 0xBA, 0x2A, 0x8C, 0x65, 0x98, 0xBE, 0x97,
+    0x4A, 0x01, 0x22, 0xE3, 0xC5, 0xA8, 0xAC, 0x47, 0x5A, 0x60, 0x08, 0x1E, 0x29, 0x36, 0x77, 0x8A,
+    0x86, 0x71, 0xE2, 0xD6, 0xC4, 0x19, 0x4A, 0x82, 0xDF, 0xD0, 0x3C, 0xCB, 0xC3, 0x32, 0xD2, 0x7E,
+    0x02, 0xE6, 0x31, 0x0E, 0x79, 0xCF, 0xF8, 0x7A, 0xE2, 0xBD, 0x9D, 0x98, 0x13, 0x78, 0xE6, 0x7E,
+    0x2D, 0xE1, 0x5D, 0x30, 0x29, 0x0E, 0x00, 0x78, 0x60, 0xD6, 0x1D, 0xAD, 0x72, 0x44, 0xB8, 0x93,
+    0x62, 0xC3, 0x7D, 0x40, 0x1F, 0x21, 0x03, 0xE8, 0x24, 0xCB, 0xCF, 0xA6, 0x64, 0x4A, 0xE7, 0x74,
+    0x4A, 0x41, 0x5A, 0xF9, 0x88, 0x87, 0xFA, 0x9C, 0xB5, 0x8E, 0x2C, 0xE9, 0x7E, 0xDF, 0xEB, 0x5E,
+    0x93, 0xC2, 0xFA, 0xB2, 0xD3, 0x7D, 0xD5, 0x5A, 0x0F, 0xF4, 0xB6, 0x86, 0xE8, 0x61, 0x95, 0x44,
+    0x78, 0x78, 0x40, 0x6F, 0x4A, 0x42, 0xC0, 0xB3, 0x97, 0xFF, 0xA8, 0xC7, 0x08, 0x06, 0xD6, 0x24,
+    0xB3, 0x4E, 0xAC, 0xD8, 0x1D, 0xCC, 0xF2, 0xB7, 0xE5, 0x79, 0x7F, 0x11, 0x48, 0x83, 0x7D, 0xD8,
+    0x13, 0x64, 0x30, 0x66, 0x93, 0x15, 0x17, 0x98, 0x5F, 0x82, 0x3A, 0x59, 0xDE, 0x20, 0x19, 0xA0,
+    0xAC, 0x11, 0xB3, 0xC0, 0xB4, 0x39, 0x52, 0x82, 0x63, 0x55, 0x88, 0x63, 0x81, 0xF8, 0xE2, 0x01,
+    0x91, 0xD5, 0x1E, 0xD7, 0x61, 0x24, 0xB0, 0xF3, 0xB1, 0xEB, 0x59, 0xF4, 0x88, 0x23, 0x11, 0x65,
+    0xC2, 0x2D, 0x8E, 0x2C, 0xDE, 0xF6, 0xDC, 0x93, 0x65, 0xAF, 0x26, 0x0C, 0xB6, 0xD2, 0x23, 0x17,
+    0xE4, 0xAB, 0x25, 0xFA, 0xF1, 0x9E, 0x60, 0x16, 0x01, 0x8B, 0xAC, 0x40, 0x2F, 0x60, 0xCA, 0xB6,
+    0x63, 0x9C, 0xFE, 0x99, 0xE3, 0x8C, 0x52, 0x2B, 0x71, 0x1C, 0xCC, 0x7C, 0x66, 0x9C, 0xF6, 0x34,
+    0x1A, 0x66, 0x2B, 0xD3, 0x8B, 0x00, 0x3A, 0x43, 0x09, 0x52, 0xC9, 0x42, 0xFD, 0x0B, 0x52, 0xD7,
+    0x6E, 0xE4, 0x6C, 0x13, 0x26, 0x70, 0xEA, 0xE4, 0xEA, 0x30, 0xBA, 0x3A, 0x1F, 0x6C, 0x5D, 0xF4,
+    0xB6, 0x05, 0xFF, 0x7A, 0x0D, 0x02, 0x0D, 0x1D, 0xE6, 0x41, 0x6D, 0x2F, 0x11, 0xAD, 0x8E, 0x7C,
+    0x1F, 0x38, 0x17, 0x8A, 0xA4, 0x45, 0x65, 0x1A, 0xF0, 0x08, 0xA6, 0x82, 0x71, 0x96, 0x38, 0xB3,
+    0xB5, 0xA0, 0x21, 0x0F, 0xD1, 0x40, 0x58, 0xF7, 0xF8, 0xA7, 0x33, 0x23, 0x37, 0x6D, 0x91, 0xC3,
+    0xA1, 0x6A, 0xE1, 0x83, 0x69, 0x11, 0x5E, 0xD3, 0x20, 0xBC, 0x24, 0x7B, 0x64, 0x62, 0x91, 0x6D,
+    0xA4, 0x0F, 0x11, 0x9B, 0xEC, 0x26, 0xA7, 0x84, 0x1D, 0xD9, 0x3A, 0x12, 0x76, 0xB9, 0x00, 0x0A,
+    0xB5, 0x0B, 0x6B, 0x9E, 0xC9, 0x9D, 0x61, 0xDD, 0xD7, 0xDA, 0x3B, 0x13, 0xAC, 0x31, 0x72, 0x87,
+    0x10, 0xD3, 0x79, 0xC1, 0x8A, 0x94, 0x4C, 0x5A, 0x17, 0x6A, 0x98, 0x84, 0x61, 0x63, 0x69, 0x38,
+    0x5E, 0x0D, 0x64, 0x43, 0x34, 0x5C, 0x8C, 0x8C, 0xE0, 0x25, 0x13, 0xA2, 0x97, 0x4E, 0x38, 0x9F,
+    0x4D, 0xA4, 0xBC, 0x63, 0x72, 0x10, 0x79, 0xBC, 0xE0, 0x41, 0xF3, 0x71, 0xFD, 0x0F, 0xF6, 0x04,
+    0x1F, 0x38, 0x4F, 0xE0, 0x44, 0x96, 0x25, 0x27, 0x5E, 0x21, 0xEA, 0xA6, 0x2E, 0xBD, 0xDA, 0xF5,
+    0x2B, 0x99, 0xCE, 0x34, 0x22, 0xD8, 0xA9, 0xE3, 0xE6, 0x69, 0x27, 0xE3, 0x11, 0x26, 0xD9, 0x00,
+    0x4A, 0x3C, 0x0E, 0x54, 0x74, 0xCA, 0xC9, 0x31, 0xA0, 0xBC, 0x7D, 0xCA, 0xFC, 0xF8, 0x2C, 0xB4,
+    0xE9, 0xB1, 0x2F, 0x8E, 0xDA, 0xEC, 0x89, 0xD7, 0x38, 0x3E, 0xEA, 0x2B, 0xDB, 0xE4, 0x8F, 0x7A,
+    0x63, 0xEA, 0xE2, 0x51, 0xFF, 0x81, 0x55, 0xFA, 0x6F, 0x5F, 0x8E, 0x48, 0xDF, 0x27, 0x8F, 0xFA,
+    0x43, 0xA5, 0xEF, 0x3D, 0xF1, 0x8B, 0x2A, 0xEF, 0x86, 0x76, 0x56, 0xD5, 0x3B, 0xE1, 0x26, 0x50,
+    0xF7, 0x4E, 0x80, 0x0D, 0xE6, 0xCA, 0xC2, 0xD4, 0x24, 0x13, 0x9B, 0x82, 0x6B, 0x60, 0x18, 0x46,
+    0xC5, 0xA1, 0xCB, 0xC6, 0x24, 0xF4, 0xD9, 0x00, 0xBA, 0xCF, 0xFB, 0xF4, 0x18, 0xDD, 0x3C, 0xFB,
+    0x6A, 0x2A, 0x7C, 0xF6, 0xE5, 0xA4, 0x7D, 0xDE, 0xCF, 0xBA, 0x2B, 0xFA, 0x50, 0xB6, 0xDA, 0xA3,
+    0x15, 0xE9, 0xCE, 0xEC, 0x37, 0x1A, 0xB5, 0x5B, 0x97, 0x6D, 0x09, 0x56, 0x6C, 0x75, 0x60, 0x86,
+    0x71, 0xA8, 0x0B, 0xA4, 0x4D, 0xDA, 0xE5, 0x5A, 0xD0, 0x28, 0x18, 0x0B, 0x9F, 0x12, 0x76, 0xBB,
+    0x6C, 0x41, 0xDB, 0x43, 0x55, 0x05, 0x62, 0xD3, 0xD5, 0x08, 0x13, 0xBB, 0x04, 0x0F, 0x64, 0x42,
+    0xE2, 0xA0, 0x46, 0x59, 0x83, 0xA9, 0x6B, 0xE4, 0xC9, 0xD6, 0xA8, 0x44, 0xDB, 0x82, 0xF9, 0x8D,
+    0xAF, 0x06, 0xD6, 0xB7, 0x27, 0xDA, 0x98, 0xC3, 0xF1, 0x84, 0xB1, 0x85, 0x7B, 0x58, 0x41, 0x23,
+    0x0A, 0x7C, 0xE5, 0x9E, 0x04, 0x92, 0x09, 0xB2, 0x69, 0x04, 0x03, 0xFD, 0x73, 0x7F, 0xC4, 0x23,
+    0x1E, 0x8C, 0x5E, 0xEB, 0xAF, 0xDF, 0x3F, 0xBF, 0x82, 0x4E, 0x18, 0xFA, 0x69, 0x5B, 0xAF, 0x7C,
+    0x1B, 0x5B, 0x33, 0xDA, 0x5A, 0x9C, 0xDA, 0x4A, 0xA1, 0x02, 0xE0, 0x24, 0x44, 0x8A, 0x4A, 0x49,
+    0x45, 0x82, 0x5C, 0xA1, 0x2B, 0xDC, 0x44, 0x89, 0x44, 0x50, 0x7F, 0xAD, 0xD6, 0x4E, 0x3D, 0x24,
+    0x4B, 0x31, 0x8A, 0xE5, 0x53, 0x14, 0x7C, 0xD9, 0xA8, 0x07, 0x54, 0x98, 0x17, 0xEE, 0x64, 0x57,
+    0xFA, 0x72, 0x16, 0xB4, 0x95, 0x1D, 0x8C, 0x11, 0xB5, 0xC4, 0xFE, 0x54, 0xF9, 0x58, 0x58, 0x24,
+    0x78, 0x89, 0x05, 0x55, 0x4D, 0x9B, 0xCD, 0x17, 0x6B, 0x16, 0x84, 0xE8, 0x1A, 0x61, 0x25, 0x5A,
+    0x82, 0x49, 0x2D, 0x45, 0x0E, 0x4F, 0xCC, 0xB1, 0xE3, 0x02, 0x97, 0x6F, 0xE1, 0xB7, 0x83, 0x95,
+    0x24, 0xA3, 0x6A, 0xED, 0xFA, 0x50, 0x37, 0xAD, 0xC3, 0x8E, 0x02, 0x6F, 0xF6, 0xC2, 0xDE, 0xF9,
+    0x45, 0xB7, 0x15, 0xDE, 0x6E, 0xD1, 0x61, 0x2F, 0x77, 0x62, 0x7C, 0x88, 0x3B, 0x1C, 0xCA, 0x12,
+    0x88, 0xEC, 0x2D, 0xCE, 0x5A, 0x44, 0xDD, 0x32, 0x84, 0x18, 0xD0, 0x5C, 0x46, 0xB0, 0x5E, 0x06,
+    0x0E, 0x5F, 0x05, 0x39, 0x5C, 0xF5, 0xCA, 0x40, 0xE4, 0x54, 0xE8, 0x88, 0x15, 0x6A, 0xA6, 0xC2,
+    0x5C, 0x25, 0x19, 0x6C, 0x8C, 0x63, 0x1E, 0x42, 0x7A, 0x66, 0x03, 0xCB, 0xB4, 0xE8, 0xD1, 0xBB,
+    0x81, 0x41, 0xA7, 0x5C, 0x5B, 0x42, 0x2B, 0xA2, 0x7F, 0xB4, 0x2E, 0x0D, 0x50, 0x8E, 0x2E, 0x3B,
+    0xC6, 0xFF, 0xAE, 0xF8, 0xA2, 0x43, 0x26, 0xF4, 0x47, 0xF7, 0x41, 0x53, 0xE5, 0x2F, 0x3F, 0x41,
+    0x73, 0x34, 0xAF, 0x7D, 0x0A, 0xA5, 0x68, 0x8B, 0x07, 0x68, 0x2D, 0x1F, 0x16, 0x0F, 0x90, 0xC2,
+    0x09, 0x05, 0x84, 0x50, 0x50, 0x06, 0x5A, 0xF4, 0x27, 0xF8, 0xEB, 0xF3, 0x99, 0x88, 0x60, 0xAC,
+    0x00, 0x8A, 0x9C, 0xC4, 0x85, 0x79, 0x4B, 0x0A, 0x3A, 0xE0, 0xBD, 0x81, 0x11, 0xB8, 0x2B, 0x7F,
+    0x22, 0xA1, 0x1C, 0x94, 0x08, 0x33, 0xB4, 0xC5, 0x96, 0xBF, 0x5A, 0xD2, 0x01, 0x0E, 0xD5, 0x11,
+    0x85, 0xE3, 0xAF, 0x48, 0x72, 0x08, 0x47, 0x36, 0x63, 0x90, 0x62, 0x24, 0x8D, 0xF5, 0x08, 0xB0,
+    0x21, 0x8B, 0x4A, 0x14, 0x00, 0x24, 0x68, 0xA3, 0x96, 0xDA, 0xA8, 0xBA, 0x3B, 0xAB, 0x12, 0x16,
+    0xEA, 0x07, 0x60, 0x01, 0x01, 0x4C, 0xA3, 0x68, 0x4D, 0x36, 0x3F, 0x23, 0xBA, 0x3E, 0xEE, 0x48,
+    0x15, 0x85, 0x23, 0x7A, 0x19, 0xD2, 0xB6, 0xF7, 0xE6, 0x10, 0x55, 0x91, 0x8B, 0x9A, 0x55, 0x84,
+    0x2A, 0x1E, 0xAC, 0xFA, 0x88, 0xB5, 0xF5, 0x54, 0xB1, 0x76, 0xD2, 0x55, 0xBF, 0x36, 0x8E, 0xE0,
+    0xBC, 0xF1, 0xCA, 0xAD, 0x2C, 0x3C, 0x40, 0xED, 0x86, 0xB6, 0x1C, 0x82, 0x68, 0x70, 0x7C, 0x01,
+    0x6B, 0xAB, 0xA2, 0xFA, 0x06, 0x55, 0xC3, 0xEE, 0xB0, 0x22, 0xC4, 0x2C, 0xF0, 0xE6, 0xF1, 0x5A,
+    0x7B, 0xEE, 0x2C, 0x15, 0x47, 0xF9, 0x89, 0x7C, 0x1F, 0x03, 0x7D, 0x40, 0x61, 0x3E, 0x57, 0xBE,
+    0x18, 0xA4, 0xDF, 0xB3, 0xE3, 0x73, 0xD9, 0xE2, 0x4B, 0x68, 0xFD, 0x8A, 0xA8, 0xF5, 0xD0, 0x52,
+    0xD2, 0xF5, 0x27, 0xF5, 0xB6, 0x89, 0xE0, 0x55, 0xFB, 0x9F, 0xA5, 0x61, 0x82, 0x52, 0xAC, 0x86,
+    0x1F, 0xB0, 0xCA, 0x9A, 0x95, 0x3A, 0xE3, 0xE6, 0x6A, 0x08, 0xEE, 0xCE, 0xB0, 0x4D, 0x35, 0x9B,
+    0x3E, 0xA2, 0xDA, 0xD9, 0x0D, 0xCD, 0x0D, 0xDD, 0x9D, 0x38, 0xD3, 0xEF, 0x38, 0xA3, 0x76, 0x9D,
+    0x99, 0xCF, 0x3A, 0x33, 0xAC, 0xCE, 0x54, 0x9F, 0x21, 0x9B, 0xB3, 0x34, 0xDB, 0xD2, 0xB3, 0xCC,
+    0x01, 0xD2, 0xCB, 0x61, 0x8D, 0x33, 0xB4, 0xF4, 0x6F, 0xA3, 0xAF, 0x4E, 0x7D, 0x5F, 0xD9, 0xCF,
+    0xD1, 0xD0, 0x80, 0x81, 0x62, 0x57, 0x38, 0xAA, 0x8A, 0xDD, 0x7C, 0x12, 0xC5, 0x99, 0xAE, 0xD9,
+    0xCB, 0x17, 0xF0, 0x04, 0x80, 0x81, 0xB5, 0xC9, 0x49, 0x6D, 0x3C, 0xAB, 0x83, 0xEF, 0xF6, 0xB7,
+    0x1D, 0x5D, 0xC9, 0x11, 0xD1, 0x02, 0x44, 0x07, 0xAB, 0xEA, 0xE6, 0xFB, 0x2A, 0x3C, 0xE9, 0x45,
+    0x52, 0xCD, 0x06, 0x61, 0x2D, 0x3D, 0xBE, 0x5D, 0xD5, 0x95, 0xF0, 0x55, 0xC2, 0xDA, 0xC8, 0x22,
+    0xEA, 0xCF, 0x9B, 0x48, 0x45, 0x83, 0x9E, 0xC8, 0x3B, 0xB1, 0x66, 0x5F, 0xCF, 0x63, 0x89, 0x43,
+    0xC3, 0x4B, 0x79, 0x9D, 0x9F, 0xC0, 0x1B, 0x5B, 0x02, 0x7D, 0xBE, 0x94, 0x7D, 0x31, 0x6D, 0x82,
+    0x4D, 0xD2, 0xD7, 0x61, 0xB6, 0x38, 0x53, 0xBB, 0xCA, 0x62, 0x00, 0xC5, 0xCA, 0x40, 0x4A, 0xDD,
+    0xD8, 0x72, 0x75, 0x4D, 0xE4, 0xEF, 0xC1, 0xBF, 0xED, 0x74, 0x3B, 0x9D, 0x5F, 0x6D, 0x4F, 0x9F,
+    0x34, 0xF7, 0x6B, 0xAB, 0x82, 0x3E, 0x38, 0x5B, 0x05, 0x4F, 0xA5, 0xFB, 0x1B, 0xCD, 0xFD, 0xA9,
+    0x38, 0x92, 0x72, 0xCD, 0x14, 0x15, 0x2F, 0x97, 0x65, 0xE7, 0xFB, 0x9B, 0x1E, 0x64, 0x93, 0x1E,
+    0xB2, 0xD1, 0x60, 0xE1, 0xE0, 0xEA, 0x02, 0x1D, 0x5D, 0x1F, 0x73, 0x81, 0x04, 0xE1, 0x2D, 0x6B,
+    0x1E, 0x2C, 0x39, 0x3F, 0x05, 0x19, 0xDC, 0x03, 0x5E, 0x6E, 0x42, 0x06, 0x61, 0x51, 0x6A, 0x4F,
+    0xB1, 0x19, 0xDB, 0xFA, 0xFC, 0x9F, 0xDA, 0x7A, 0xBB, 0x2E, 0x4A, 0xB1, 0x25, 0xB7, 0x0F, 0xC9,
+    0x89, 0x8F, 0xC2, 0x5F, 0xB0, 0x6A, 0x39, 0x0E, 0x47, 0xA1, 0x45, 0x98, 0xE7, 0xAA, 0x43, 0xA0,
+    0x07, 0x6A, 0x62, 0x24, 0xB5, 0xA5, 0x3A, 0x46, 0x3F, 0xF5, 0x0C, 0x34, 0x7F, 0x81, 0xE3, 0xDB,
+    0xB8, 0x9A, 0xC2, 0x51, 0x19, 0x81, 0xB4, 0xA9, 0x09, 0x68, 0x2B, 0xA0, 0xE6, 0x98, 0x18, 0xB1,
+    0xC5, 0x78, 0xDF, 0x2E, 0x69, 0xFB, 0x5C, 0x60, 0x4E, 0x02, 0x94, 0x0A, 0xF4, 0xC6, 0xD5, 0x37,
+    0x9B, 0x9B, 0x8B, 0x6E, 0x9E, 0xAE, 0xBF, 0xD9, 0x85, 0x71, 0x5F, 0x85, 0x80, 0x6C, 0xE5, 0xA7,
+    0xAE, 0x61, 0x51, 0x32, 0x4B, 0xDF, 0x1D, 0x92, 0xF0, 0xDA, 0xB8, 0xBE, 0xA4, 0x90, 0xAE, 0x95,
+    0x21, 0x9C, 0x79, 0x5F, 0xF0, 0x5D, 0x40, 0xAF, 0xC7, 0x8A, 0xBD, 0xB7, 0xD5, 0x47, 0x28, 0xAC,
+    0x8F, 0xA6, 0x33, 0xB8, 0xDF, 0x72, 0x25, 0xF0, 0xB1, 0xAF, 0x34, 0xFF, 0x75, 0xF1, 0x1E, 0x45,
+    0xF5, 0x5C, 0x3E, 0x1A, 0xCF, 0xE5, 0x01, 0x86, 0x3D, 0xB9, 0xFD, 0x61, 0xF6, 0x64, 0x82, 0x77,
+    0x79, 0x38, 0x40, 0x4F, 0xC6, 0xC2, 0xFD, 0x99, 0xF0, 0x73, 0x3E, 0x27, 0xEF, 0x40, 0xE2, 0x5C,
+    0x42, 0xE7, 0x42, 0x6F, 0x84, 0x8F, 0x29, 0xF2, 0x6F, 0x98, 0x45, 0x88, 0xE4, 0x43, 0xD7, 0xA3,
+    0x82, 0xAD, 0x34, 0x70, 0xF5, 0x96, 0x52, 0x58, 0xCA, 0x22, 0xCB, 0xCB, 0x2D, 0xCB, 0xB7, 0x0E,
+    0xDD, 0xC9, 0x98, 0xBB, 0x89, 0x86, 0x2C, 0x70, 0x7F, 0x57, 0x76, 0x16, 0x56, 0x50, 0xEA, 0xF9,
+    0xDB, 0xCF, 0xDF, 0x22, 0x01, 0x22, 0x15, 0x68, 0x59, 0xBB, 0xC9, 0x60, 0xC0, 0x57, 0x17, 0xD9,
+    0x1E, 0xB2, 0x45, 0x18, 0xC7, 0xCC, 0x64, 0x26, 0x79, 0x54, 0x5D, 0x57, 0x3F, 0xE2, 0xCB, 0x90,
+    0x86, 0xF7, 0x58, 0x0A, 0x71, 0x00, 0xCD, 0xBC, 0x0A, 0x06, 0xBA, 0x8A, 0xA6, 0xF9, 0x26, 0x64,
+    0xE2, 0x3E, 0x9B, 0x66, 0x8D, 0xE4, 0x9C, 0x6D, 0x98, 0xD7, 0xD5, 0x1D, 0x75, 0xC7, 0x26, 0x88,
+    0x99, 0xCD, 0x20, 0xF9, 0x6C, 0x1E, 0xB2, 0xC1, 0x16, 0x47, 0x45, 0x6F, 0xF4, 0x1F, 0xB4, 0x37,
+    0xD5, 0x3E, 0x48, 0xC3, 0x54, 0xB0, 0xE1, 0xED, 0x0A, 0x98, 0xFA, 0xA0, 0x3A, 0x44, 0x9D, 0xC0,
+    0x5A, 0xD3, 0x57, 0x23, 0x15, 0x0C, 0x06, 0xEF, 0xD8, 0x53, 0x30, 0x08, 0x22, 0x74, 0x05, 0xCE,
+    0xDB, 0xF7, 0x58, 0x4B, 0x7F, 0x65, 0x7F, 0x8F, 0x1D, 0x0F, 0xA1, 0x2B, 0x18, 0x14, 0xAA, 0x89,
+    0x95, 0x50, 0x64, 0x15, 0x6F, 0xF9, 0x7E, 0xC0, 0x90, 0xF2, 0x18, 0x92, 0x0E, 0x31, 0x45, 0x21,
+    0xDF, 0x41, 0x8D, 0xC0, 0x7A, 0x28, 0x4E, 0x2A, 0x6B, 0x2A, 0x93, 0x99, 0x19, 0x9B, 0x99, 0xAE,
+    0x45, 0x84, 0x02, 0x55, 0xD8, 0x21, 0xA1, 0x70, 0x83, 0xCA, 0xD1, 0x4A, 0x1F, 0x96, 0x05, 0x2B,
+    0xDB, 0x83, 0xD4, 0xAF, 0xAC, 0x74, 0xDC, 0x26, 0xA6, 0x48, 0x8D, 0xC2, 0x8D, 0xB2, 0x0E, 0x84,
+    0xA5, 0x77, 0xB0, 0xE4, 0x67, 0xE6, 0x42, 0xD4, 0xF8, 0x64, 0x0E, 0xBE, 0xAF, 0xE1, 0xFA, 0x07,
+    0xF4, 0xB9, 0xBD, 0x5D, 0xD0, 0xD2, 0x02, 0x47, 0xD9, 0xF9, 0x42, 0x29, 0x7E, 0xE0, 0x8C, 0xBC,
+    0x63, 0x20, 0x80, 0x56, 0x80, 0x7F, 0x97, 0xE2, 0xE0, 0x14, 0x33, 0xCE, 0x5E, 0xBF, 0x73, 0xB0,
+    0xFD, 0x8B, 0x0F, 0xCE, 0xE0, 0x83, 0x93, 0xF8, 0x1C, 0xE4, 0x2C, 0x8E, 0xAE, 0x6A, 0x0C, 0x98,
+    0xEF, 0x92, 0x4A, 0xFB, 0x1F, 0x67, 0xFD, 0xA4, 0x3F, 0x9E, 0xCA, 0x7B, 0x83, 0x79, 0xAF, 0xB7,
+    0x57, 0xFD, 0x0B, 0x17, 0xEA, 0xBC, 0x5F, 0xF4, 0xC3, 0x49, 0xDF, 0x1D, 0xAB, 0x77, 0x7B, 0x53,
+    0xF8, 0x1B, 0xBA, 0xBD, 0x74, 0x41, 0xBD, 0xA4, 0xFE, 0x94, 0x7A, 0xF7, 0xCE, 0x0C, 0x3D, 0xF2,
+    0x2E, 0x0E, 0x2E, 0x25, 0x6E, 0xD5, 0xEB, 0xC9, 0x69, 0x23, 0x1A, 0x35, 0x97, 0xEE, 0x23, 0xA8,
+    0x2F, 0x09, 0x43, 0x90, 0x35, 0x87, 0xF8, 0x4E, 0xCE, 0xCB, 0x97, 0xDF, 0x2F, 0xB7, 0xC4, 0x1A,
+    0xBE, 0xAC, 0xA0, 0xEE, 0xD4, 0x3D, 0x93, 0x41, 0x79, 0xCF, 0x23, 0x73, 0x42, 0x1A, 0x22, 0xB1,
+    0x6A, 0x79, 0xD1, 0x52, 0xCA, 0x0B, 0x1A, 0x29, 0xDB, 0x5A, 0x5E, 0x6A, 0x49, 0x1A, 0xDC, 0xFA,
+    0xD2, 0x86, 0xF5, 0x43, 0x59, 0x43, 0x12, 0x94, 0x98, 0x33, 0x35, 0x32, 0x37, 0x52, 0x43, 0xE2,
+    0x45, 0x9F, 0xEF, 0x76, 0x9B, 0xA4, 0x91, 0xCC, 0xC9, 0xDB, 0x26, 0xA8, 0x39, 0x06, 0xFD, 0xC5,
+    0x98, 0x17, 0xDA, 0x76, 0xF3, 0x80, 0xC2, 0xF3, 0xAE, 0xAC, 0x8B, 0xEF, 0x49, 0xAE, 0xB2, 0xF1,
+    0xE4, 0xE8, 0xD9, 0x02, 0xCA, 0xAE, 0x88, 0xB6, 0xC9, 0xFB, 0x21, 0xB1, 0xB0, 0x89, 0x16, 0xF2,
+    0x68, 0xC5, 0x42, 0x59, 0xCB, 0x51, 0x5E, 0x36, 0x42, 0xF5, 0x91, 0xEC, 0xB7, 0x49, 0x5C, 0x3C,
+    0x8A, 0xE4, 0x70, 0x8D, 0x3A, 0xD3, 0xC0, 0x85, 0x0C, 0x26, 0xE9, 0x12, 0xAB, 0x6D, 0x11, 0x46,
+    0x8B, 0xD8, 0x36, 0xFF, 0xEF, 0xB6, 0x49, 0xDC, 0xBE, 0x8B, 0x6D, 0x31, 0xAB, 0x95, 0x8A, 0xB1,
+    0x95, 0x45, 0xEC, 0xC0, 0xD5, 0x7C, 0xCC, 0xED, 0x8B, 0x5B, 0x76, 0xD7, 0xFC, 0xFE, 0x2E, 0xE2,
+    0xED, 0x21, 0x61, 0x80, 0xBF, 0xF7, 0xC5, 0xDA, 0x7C, 0x4C, 0xA7, 0x98, 0xE7, 0x68, 0x71, 0x21,
+    0x7F, 0x99, 0x6B, 0xDA, 0xCE, 0x6C, 0x17, 0x7D, 0xCC, 0xB7, 0xD8, 0xDF, 0xAC, 0xF9, 0xE7, 0xC2,
+    0xAE, 0x8B, 0x59, 0x2F, 0xA3, 0xFD, 0xE2, 0x4D, 0x88, 0x4B, 0xA1, 0x98, 0xFB, 0x2D, 0xFB, 0x5B,
+    0xFE, 0x37, 0x04, 0x6C, 0x18, 0x78, 0x1A, 0x05, 0x9B, 0x3F, 0x02, 0x24, 0xFA, 0x53, 0xAF, 0xFE,
+    0xA8, 0xE8, 0x8F, 0x5B, 0xFD, 0x09, 0xAB, 0x3F, 0xCB, 0xF9, 0xFE, 0x64, 0xFF, 0x7F, 0x7F, 0xFE,
+    0x05, 0x75, 0x54, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0x77, 0x16, 0x58, 0x8A, 0x25, 0x96, 0x86,
+    0x86, 0x08, 0x2D, 0x2D, 0x50, 0x6C, 0x4B, 0x75, 0x6B, 0x89, 0x92, 0x02, 0x2A, 0x5A, 0xDA, 0x28,
+    0x14, 0x34, 0x69, 0x90, 0x72, 0xE7, 0xED, 0xD3, 0xD0, 0xD3, 0x52, 0xA0, 0x34, 0x50, 0x52, 0xC4,
+    0x78, 0x05, 0x3F, 0x60, 0xF8, 0x01, 0x8C, 0xA0, 0x09, 0x0D, 0x56, 0x64, 0x84, 0x51, 0x6C, 0x2F,
+    0x6F, 0xEC, 0x1C, 0xE1, 0x40, 0xD8, 0xB7, 0x73, 0xE7, 0x9D, 0x99, 0xB7, 0x6F, 0xDE, 0x8C, 0xCF,
+    0xDC, 0x2D, 0xED, 0xBD, 0xD2, 0x2A, 0xBF, 0x50, 0x6E, 0xA9, 0xD3, 0x7D, 0x8D, 0x9D, 0xAB, 0x40,
+    0x54, 0xB5, 0x40, 0x5C, 0x36, 0x40, 0xF2, 0xB6, 0x06, 0xD4, 0x3B, 0x31, 0x77, 0x2A, 0xA8, 0x10,
+    0xC2, 0x64, 0xB6, 0x8A, 0x97, 0x5F, 0x81, 0xA5, 0x4A, 0x81, 0x23, 0x03, 0xDC, 0x1C, 0x8A, 0xE7,
+    0xC8, 0x42, 0xE8, 0x26, 0x33, 0xAF, 0x8F, 0xD6, 0x20, 0xEF, 0x37, 0x40, 0x80, 0x3D, 0xAE, 0x57,
+    0x80, 0x09, 0x0E, 0x21, 0x94, 0x51, 0x08, 0x3E, 0xFE, 0xF9, 0x3E, 0x8D, 0x4F, 0x3C, 0xE2, 0x53,
+    0x8F, 0x28, 0x78, 0xCC, 0x02, 0xF3, 0x6C, 0x60, 0x5A, 0x48, 0xA1, 0x32, 0x87, 0x4B, 0xD6, 0xED,
+    0x5D, 0x2B, 0x52, 0x22, 0x13, 0xBD, 0xC3, 0x76, 0x78, 0x0A, 0xDC, 0x3E, 0x83, 0xBA, 0x8C, 0xE9,
+    0x9A, 0x0F, 0x3C, 0x4F, 0x05, 0xA7, 0xBC, 0xFE, 0xE6, 0x0D, 0x58, 0xD0, 0x12, 0x99, 0xF2, 0x2D,
+    0x56, 0x72, 0x6E, 0xAE, 0x0F, 0x4A, 0xE4, 0xF6, 0xE1, 0x41, 0x95, 0x15, 0x36, 0xEB, 0x6C, 0xDF,
+    0x0D, 0xBD, 0x3E, 0xF9, 0xDE, 0xE5, 0x88, 0x3F, 0x37, 0xB9, 0x50, 0xCB, 0x61, 0xA3, 0xBA, 0x43,
+    0x4E, 0x33, 0x6B, 0xA3, 0x1F, 0x4D, 0x54, 0xCF, 0x43, 0xAD, 0x3C, 0x48, 0xF3, 0xFC, 0x8A, 0x49,
+    0x88, 0xCC, 0x4B, 0x90, 0x47, 0x05, 0x14, 0x09, 0x2B, 0x1A, 0x46, 0xA3, 0xE4, 0x31, 0xF3, 0x13,
+    0x6F, 0x14, 0xCD, 0x96, 0x8B, 0x42, 0x6D, 0xBC, 0x3A, 0x6D, 0x6D, 0x6A, 0x3E, 0xF4, 0x01, 0xD6,
+    0x87, 0x1E, 0xD6, 0x65, 0x2D, 0x6C, 0x69, 0x6B, 0x86, 0x85, 0x06, 0x5A, 0xA4, 0x8A, 0xC3, 0xA7,
+    0x30, 0xA1, 0x9B, 0xD4, 0xA6, 0x16, 0x0B, 0x2C, 0xB1, 0x8F, 0x9D, 0x69, 0x4B, 0xF3, 0x3C, 0xED,
+    0x70, 0x9D, 0x0A, 0xAF, 0xB8, 0x8A, 0xE1, 0x81, 0x24, 0x51, 0xA1, 0xC0, 0xBC, 0x0B, 0xD0, 0x1F,
+    0x1D, 0xEC, 0x3D, 0x8F, 0xAD, 0x84, 0x94, 0x62, 0xC6, 0x2E, 0xB0, 0xB9, 0x2C, 0x73, 0x42, 0x48,
+    0x65, 0xED, 0x16, 0x87, 0xFF, 0xFA, 0xA7, 0xAA, 0xA4, 0x39, 0xE4, 0xAF, 0x85, 0x3E, 0x41, 0x0A,
+    0xEE, 0xF5, 0x54, 0xB4, 0x63, 0x0B, 0xA5, 0x79, 0x6B, 0x17, 0x95, 0xC8, 0xFE, 0x72, 0x49, 0xE6,
+    0x99, 0xEB, 0xFC, 0x4A, 0x04, 0x23, 0x45, 0x32, 0xF0, 0xAB, 0x1A, 0xBF, 0x32, 0x51, 0x87, 0x4D,
+    0x33, 0x92, 0x2B, 0xCA, 0x69, 0x96, 0x3C, 0x13, 0x31, 0x25, 0x16, 0xD8, 0x3D, 0x3C, 0xFC, 0xCD,
+    0x73, 0x8D, 0xB2, 0x7E, 0x96, 0x25, 0x9B, 0xAF, 0x65, 0x4F, 0x28, 0xC8, 0x50, 0x49, 0x57, 0x4C,
+    0x2B, 0x60, 0xE9, 0x88, 0x63, 0x06, 0x5C, 0x64, 0x5B, 0xB2, 0x7E, 0x8A, 0x91, 0xD8, 0x09, 0xE8,
+    0xF1, 0xB1, 0x10, 0xE2, 0x90, 0x31, 0xF1, 0xF8, 0x65, 0x83, 0x79, 0x2F, 0xE4, 0x85, 0xF7, 0x8A,
+    0xCC, 0xB3, 0xD6, 0xC2, 0xCE, 0x43, 0x67, 0xB0, 0x48, 0x2A, 0xDA, 0xA5, 0x76, 0xAD, 0xE1, 0x3C,
+    0xCF, 0x1A, 0x83, 0xCE, 0xCE, 0x6B, 0x8B, 0x6E, 0x11, 0xD5, 0x4B, 0xFE, 0xA6, 0x1B, 0x47, 0x63,
+    0xD3, 0x72, 0xD5, 0xF2, 0x24, 0x3B, 0xBB, 0x7F, 0x85, 0x14, 0xC6, 0xBA, 0x55, 0x23, 0x93, 0x18,
+    0x89, 0xF3, 0x6C, 0x30, 0x80, 0xFB, 0x18, 0x55, 0xCA, 0xD2, 0xA8, 0xA3, 0x9E, 0x51, 0x0B, 0x36,
+    0xAC, 0xA1, 0xE1, 0xC9, 0x03, 0x54, 0x3D, 0xEB, 0xA9, 0x38, 0xFD, 0xBA, 0xA2, 0xDF, 0x94, 0xF4,
+    0x1B, 0x1F, 0x73, 0x34, 0x3C, 0x83, 0xAC, 0x63, 0x50, 0xE6, 0x94, 0x18, 0x5D, 0x71, 0x5C, 0x38,
+    0x56, 0x3C, 0xD9, 0xF1, 0xBD, 0x1B, 0xA4, 0xE2, 0x66, 0xAD, 0x10, 0x05, 0xB0, 0x2D, 0xB2, 0xE7,
+    0x78, 0x03, 0xE4, 0x40, 0x27, 0x9F, 0x19, 0xDF, 0xBD, 0x56, 0x7A, 0x13, 0xD5, 0xF2, 0x89, 0x2B,
+    0x69, 0x9F, 0x2A, 0xA5, 0x4B, 0xEC, 0x21, 0xF9, 0x9A, 0x14, 0xF6, 0xC5, 0x98, 0xC7, 0x93, 0xA6,
+    0x3B, 0x35, 0xA9, 0x76, 0xDA, 0x2B, 0xB9, 0xCB, 0xA4, 0x4C, 0xAA, 0xB8, 0x8E, 0xA6, 0xBB, 0x21,
+    0x16, 0xCE, 0x82, 0x1F, 0x4D, 0x80, 0xF5, 0x39, 0xA0, 0x60, 0x3A, 0xC1, 0xE4, 0xD0, 0xD8, 0x71,
+    0x36, 0x56, 0x1B, 0x44, 0x6E, 0x8D, 0x79, 0x05, 0xB5, 0x9E, 0x71, 0x31, 0x19, 0x09, 0xB9, 0x6B,
+    0xBA, 0x2D, 0xFF, 0x1D, 0xF2, 0x25, 0xD0, 0x2E, 0xB8, 0x6D, 0x90, 0x94, 0x9A, 0x60, 0xCA, 0x59,
+    0xDA, 0x1B, 0xB8, 0xE8, 0x4C, 0x68, 0x6D, 0x90, 0x30, 0xB2, 0x4A, 0xCA, 0x79, 0x25, 0xA8, 0x71,
+    0x07, 0x45, 0xBD, 0xCA, 0x8D, 0xF3, 0xDE, 0x60, 0x9B, 0xF2, 0xB1, 0x90, 0x12, 0xDB, 0xF5, 0x58,
+    0xF5, 0xEF, 0xC2, 0x6B, 0x91, 0x3A, 0xEE, 0x11, 0xF5, 0x92, 0xBD, 0xFF, 0x9F, 0x6B, 0x07, 0x4F,
+    0x08, 0xE4, 0x51, 0xF8, 0x3F, 0x6A, 0x9A, 0x74, 0x72, 0xD0, 0x5F, 0x90, 0xF0, 0xDF, 0xA6, 0x95,
+    0xF1, 0x1D, 0x36, 0xC4, 0x25, 0x3A, 0xDF, 0xE1, 0xAC, 0x94, 0x82, 0xD9, 0x22, 0xCE, 0xE8, 0xB3,
+    0x71, 0x4E, 0x9F, 0x6E, 0x0F, 0x63, 0x67, 0x7E, 0x01, 0xBD, 0x59, 0x3D, 0x8C, 0xDD, 0xC6, 0x11,
+    0x1E, 0x92, 0x92, 0xE8, 0x88, 0x40, 0xD6, 0x85, 0x9C, 0x18, 0x11, 0x20, 0x36, 0x0E, 0xE0, 0x20,
+    0x56, 0xD8, 0x5E, 0x00, 0xEB, 0x96, 0xB2, 0x01, 0x37, 0x2A, 0x7C, 0x85, 0x95, 0x14, 0x2E, 0xD4,
+    0xDA, 0x2A, 0xAC, 0x46, 0x65, 0x74, 0xA4, 0x9C, 0x22, 0x40, 0x52, 0xE4, 0x8A, 0x04, 0x29, 0x52,
+    0x44, 0x40, 0x10, 0xC0, 0xB9, 0x14, 0x51, 0xE1, 0x22, 0x85, 0xEE, 0xB8, 0xB0, 0x0B, 0x17, 0x06,
+    0x12, 0x5A, 0x42, 0x90, 0xC2, 0x85, 0x18, 0x58, 0x0E, 0x02, 0xBB, 0xF0, 0x1A, 0xA6, 0x2C, 0x5A,
+    0x47, 0x72, 0xF3, 0x7D, 0x4B, 0xBE, 0xFB, 0x11, 0x64, 0xC0, 0xC1, 0x93, 0x8E, 0xF7, 0x76, 0xF9,
+    0x8E, 0x3F, 0xF3, 0xB7, 0x33, 0xDF, 0xCC, 0xEC, 0x93, 0xD7, 0x82, 0x31, 0x1C, 0x83, 0x41, 0xD6,
+    0x44, 0x82, 0xB5, 0xC8, 0xC6, 0x36, 0x69, 0x54, 0xA3, 0xEA, 0xD4, 0x64, 0x46, 0x1B, 0x5D, 0x16,
+    0x65, 0x95, 0x5F, 0x14, 0x1E, 0x89, 0x11, 0x55, 0x4A, 0xD5, 0xC5, 0xAE, 0x57, 0x63, 0x9B, 0x35,
+    0xA2, 0xF1, 0x5F, 0x2E, 0x4E, 0xF8, 0x19, 0xFD, 0xEC, 0xAE, 0x9A, 0xC2, 0x99, 0xCC, 0x99, 0x78,
+    0x94, 0xA8, 0x96, 0xC8, 0x48, 0x90, 0xCB, 0x7C, 0x14, 0x5F, 0x89, 0x84, 0x0E, 0x0F, 0xC5, 0x6E,
+    0x10, 0x51, 0xED, 0x13, 0x98, 0x1A, 0x5C, 0x4F, 0x6B, 0x4E, 0x06, 0x53, 0x86, 0x29, 0x72, 0x2E,
+    0xC7, 0x13, 0x98, 0x8E, 0x55, 0x9B, 0xB8, 0x56, 0xF1, 0x55, 0xBC, 0x24, 0x90, 0x10, 0xAF, 0xB6,
+    0x7C, 0xCC, 0x39, 0xF0, 0x76, 0xAE, 0xE6, 0x64, 0xE4, 0x88, 0xC8, 0x99, 0xD7, 0xCF, 0x14, 0x6E,
+    0x4C, 0x5D, 0x97, 0x5E, 0xED, 0x32, 0xB9, 0x81, 0x4F, 0x9A, 0xF7, 0xEA, 0xD3, 0x4E, 0xBB, 0x61,
+    0xB5, 0xDA, 0x7A, 0x42, 0x4E, 0xA4, 0x26, 0x6E, 0xD3, 0x5A, 0x59, 0x55, 0x67, 0x26, 0x69, 0x74,
+    0x1E, 0x5B, 0x27, 0xD1, 0xE7, 0xBD, 0x44, 0xF7, 0x5A, 0xC8, 0x64, 0x25, 0x00, 0x9D, 0x1F, 0xBA,
+    0xFF, 0x82, 0x60, 0x2F, 0xDF, 0x19, 0x5F, 0xF1, 0xCC, 0x0A, 0x5C, 0x77, 0x18, 0x3F, 0xFD, 0x2A,
+    0x97, 0x08, 0x7C, 0x63, 0x2B, 0xF2, 0xB3, 0xDD, 0x83, 0x62, 0x9D, 0xD8, 0xFD, 0xEF, 0x35, 0xAF,
+    0x61, 0x46, 0x23, 0xB8, 0x3C, 0x1C, 0x2E, 0xF8, 0x17, 0xA2, 0x1E, 0x52, 0xBB, 0x12, 0xA3, 0x95,
+    0xF8, 0x5E, 0x2F, 0xCA, 0x0C, 0x18, 0x5B, 0xA2, 0xEA, 0x5E, 0x12, 0x47, 0xC6, 0xD0, 0xBC, 0x80,
+    0x09, 0x12, 0xEB, 0xA9, 0xB7, 0x29, 0x19, 0x1A, 0x29, 0xC6, 0xC9, 0x60, 0xCF, 0x9E, 0x92, 0x41,
+    0x4B, 0xAF, 0xE5, 0xC4, 0x89, 0xD9, 0x84, 0x27, 0x41, 0x4D, 0xB6, 0x7F, 0xDF, 0x49, 0xD4, 0x48,
+    0x26, 0x4A, 0x5E, 0x4F, 0xCC, 0xE9, 0xD8, 0xBD, 0x53, 0xAF, 0xA4, 0x67, 0x73, 0x7B, 0xF9, 0x8C,
+    0xC8, 0xF5, 0xEB, 0xCF, 0x8B, 0x5C, 0xB6, 0x90, 0x6E, 0xC5, 0x4F, 0xFE, 0x5F, 0xDE, 0x78, 0x7B,
+    0x25, 0x13, 0xB1, 0xCF, 0x25, 0xEE, 0xCD, 0x46, 0x05, 0xDB, 0xB1, 0x89, 0x6B, 0x10, 0x08, 0xC6,
+    0x9F, 0x40, 0xC4, 0x94, 0x62, 0xCC, 0x47, 0xF8, 0x55, 0xA3, 0x5C, 0x9D, 0x9E, 0x33, 0x3A, 0x36,
+    0xAB, 0x89, 0x39, 0xA3, 0xCA, 0xD5, 0x2C, 0xD7, 0x4E, 0x92, 0x5F, 0x8A, 0x3C, 0x19, 0xC0, 0xD0,
+    0x78, 0xCF, 0x29, 0x1B, 0xF5, 0xDA, 0xA8, 0xD6, 0xE5, 0xD9, 0xCD, 0x41, 0xF4, 0xBB, 0xBD, 0x64,
+    0xEF, 0x40, 0xBB, 0x66, 0x84, 0x22, 0x15, 0x14, 0x29, 0x24, 0xCC, 0x9F, 0xF1, 0xE4, 0x2A, 0x58,
+    0x83, 0xE3, 0xE2, 0xE6, 0x5F, 0xE1, 0x06, 0xEA, 0xC0, 0x38, 0xFA, 0x8A, 0x1E, 0x8A, 0xBE, 0xE8,
+    0x1F, 0xAA, 0xD9, 0xF1, 0xDF, 0x40, 0x33, 0xE5, 0x5E, 0xA8, 0x57, 0xD4, 0x49, 0x63, 0x2F, 0xAB,
+    0xC8, 0x5C, 0xBF, 0x8E, 0xE9, 0xB2, 0x55, 0x17, 0xCA, 0x15, 0xAB, 0x46, 0x68, 0xA6, 0xDE, 0x80,
+    0x66, 0x4A, 0xE5, 0x6F, 0xAF, 0xA8, 0xD8, 0xD8, 0xE7, 0x54, 0x74, 0xB3, 0x51, 0xDF, 0x92, 0xDF,
+    0x3D, 0x54, 0xB3, 0xA7, 0xCE, 0x9F, 0xD7, 0x6E, 0x2C, 0xE8, 0x77, 0xDE, 0x91, 0x3B, 0xD1, 0xA3,
+    0x6C, 0x65, 0x79, 0xA7, 0xCA, 0x56, 0x95, 0x7D, 0x9A, 0x17, 0x4E, 0xD2, 0xDE, 0xFB, 0xEA, 0x0F,
+    0x70, 0x7F, 0xF5, 0xE0, 0x58, 0x68, 0xC1, 0xF1, 0xE0, 0x3D, 0x79, 0x4A, 0xE4, 0xE2, 0xE6, 0xE6,
+    0xDE, 0xFD, 0x13, 0xF0, 0xE0, 0x32, 0x71, 0x75, 0x74, 0xAE, 0x91, 0xA4, 0xC6, 0x7A, 0x0B, 0xCC,
+    0x81, 0xF5, 0xA6, 0xC7, 0x96, 0x85, 0x2B, 0x2F, 0xC2, 0xA9, 0xFD, 0x33, 0xB1, 0xAB, 0x83, 0xB8,
+    0x91, 0xB8, 0x0E, 0x5C, 0x1E, 0x61, 0xC5, 0xD3, 0x12, 0x0F, 0xFF, 0xB8, 0x28, 0x61, 0xED, 0x93,
+    0x77, 0x84, 0xDE, 0x93, 0xB4, 0xA9, 0x01, 0x8B, 0x8B, 0xF2, 0x67, 0x04, 0xC0, 0x28, 0x88, 0xD1,
+    0x60, 0x08, 0x7B, 0xFE, 0x45, 0x7D, 0xD4, 0x4D, 0x7F, 0x71, 0x1B, 0xB7, 0xCA, 0x26, 0x16, 0xAE,
+    0xDD, 0x6A, 0xAC, 0x9D, 0xAB, 0x95, 0xDB, 0x31, 0xE9, 0x67, 0xFF, 0x30, 0x0C, 0x26, 0xCD, 0x01,
+    0xC3, 0x16, 0xF9, 0x14, 0x48, 0x1C, 0x01, 0xA2, 0x07, 0xCF, 0x35, 0xA9, 0xFB, 0xB2, 0xD1, 0xEE,
+    0xDF, 0x0F, 0x1D, 0x19, 0x86, 0xC2, 0x88, 0x31, 0xE4, 0x3C, 0x46, 0xF0, 0x0D, 0x06, 0xA3, 0x38,
+    0xD7, 0xA6, 0x30, 0x3A, 0x3F, 0x22, 0x49, 0xA9, 0x9A, 0xC8, 0x46, 0xB6, 0xB2, 0x05, 0xF8, 0xCB,
+    0x76, 0x3C, 0xE8, 0x7E, 0xBD, 0xFF, 0x7E, 0x17, 0xB6, 0x61, 0xCB, 0xEB, 0x71, 0x73, 0x6C, 0x23,
+    0xEE, 0xB2, 0x71, 0x5D, 0xDF, 0xC8, 0xBA, 0xAC, 0x5B, 0xED, 0xB7, 0x8A, 0x0E, 0x40, 0xC0, 0x37,
+    0xCD, 0x8D, 0x5D, 0x5F, 0x8A, 0x3A, 0x9D, 0xD3, 0xD7, 0xBC, 0xBF, 0x21, 0x64, 0xB3, 0x5B, 0x83,
+    0x54, 0xE7, 0x5A, 0x59, 0x87, 0xE1, 0x9E, 0x08, 0xCA, 0x05, 0xB0, 0xC0, 0x88, 0xA1, 0x83, 0xF5,
+    0x10, 0x7F, 0x5A, 0xF4, 0x20, 0x5B, 0xF2, 0x74, 0x1F, 0x74, 0x22, 0x7D, 0x84, 0xC0, 0xEA, 0xB1,
+    0x04, 0x41, 0x97, 0xBD, 0xD0, 0x87, 0xED, 0x7A, 0xD2, 0x45, 0xB6, 0x4F, 0xDB, 0xF0, 0x8F, 0xB6,
+    0xB0, 0x58, 0x9D, 0x7B, 0x56, 0xD2, 0x9F, 0x7F, 0x64, 0x45, 0xAB, 0x0F, 0xEF, 0xC8, 0x0D, 0xE5,
+    0xF0, 0x88, 0x72, 0x2D, 0x68, 0x2B, 0x83, 0x97, 0x8E, 0xE7, 0xFB, 0xE8, 0x8B, 0x67, 0x20, 0x9E,
+    0xC3, 0xC4, 0x62, 0xE6, 0x31, 0x31, 0x21, 0x97, 0x35, 0xB2, 0xB9, 0x30, 0x08, 0xF8, 0x60, 0x0D,
+    0xC1, 0xE8, 0x69, 0x2D, 0xE0, 0xC4, 0x17, 0xE0, 0x08, 0xDB, 0x5C, 0xE1, 0x10, 0x2F, 0x68, 0x8F,
+    0x7A, 0xBD, 0xE8, 0x1C, 0x4F, 0x06, 0x70, 0xC9, 0xB8, 0x09, 0x1D, 0xC1, 0x21, 0xDC, 0x7C, 0x0B,
+    0x41, 0x46, 0xF7, 0x74, 0x12, 0x5A, 0x05, 0x0C, 0x6D, 0x8E, 0x78, 0x41, 0x54, 0xA9, 0x05, 0x1E,
+    0xB2, 0x25, 0xF1, 0x40, 0x8E, 0x9A, 0x0C, 0x33, 0x65, 0xC6, 0x8F, 0xAB, 0xEC, 0xC5, 0xC1, 0x0D,
+    0xEB, 0x49, 0x7F, 0xE9, 0x5A, 0x9F, 0x01, 0xCC, 0xEC, 0x95, 0x4E, 0x92, 0x0F, 0xEE, 0xB6, 0xD0,
+    0xEA, 0x3F, 0xAD, 0xE8, 0xD8, 0x8D, 0xD2, 0x03, 0x6C, 0x43, 0xC0, 0x4F, 0x03, 0xAD, 0x8E, 0x6D,
+    0x80, 0xAE, 0xC4, 0x1D, 0xFD, 0x9F, 0x60, 0xE6, 0x8F, 0xE3, 0x1B, 0xD4, 0x4B, 0x9B, 0x00, 0x41,
+    0x3E, 0x48, 0x66, 0x05, 0xEB, 0x55, 0xD1, 0x53, 0xD6, 0xAA, 0x4F, 0xAD, 0x76, 0x2D, 0x62, 0x28,
+    0x78, 0x65, 0x01, 0x0F, 0x1E, 0xAA, 0x89, 0x56, 0xE2, 0x95, 0x96, 0x76, 0xF7, 0x06, 0xBF, 0x69,
+    0x9A, 0xA3, 0xE0, 0x34, 0x76, 0xC4, 0x6B, 0x44, 0x60, 0x74, 0xB7, 0x27, 0xB4, 0xF5, 0x84, 0xFA,
+    0x9E, 0x00, 0xDF, 0xD3, 0x21, 0x11, 0x86, 0xD5, 0x6F, 0x07, 0x62, 0xE5, 0xC8, 0x8C, 0x30, 0x12,
+    0xF4, 0x1D, 0xE9, 0x56, 0xB4, 0x4D, 0xC5, 0x3C, 0x50, 0xD1, 0x6F, 0x8B, 0x5D, 0x5C, 0xA2, 0x23,
+    0xFB, 0x2C, 0x40, 0x0B, 0x72, 0x39, 0x0E, 0x87, 0x6F, 0x42, 0x24, 0x4E, 0xC9, 0xB7, 0x40, 0x78,
+    0x06, 0x5D, 0x62, 0x1E, 0x3B, 0xDF, 0xB4, 0x84, 0x65, 0x8B, 0x1D, 0xB8, 0xC8, 0x7D, 0xA4, 0x02,
+    0x69, 0x7E, 0xF4, 0xF8, 0x55, 0x3D, 0x95, 0xC0, 0xD3, 0x35, 0x33, 0xB0, 0x86, 0x96, 0x72, 0xE2,
     0xE8, 0xE3, 0x67, 0x19, 0x92, 0xB2, 0xA2, 0x75, 0x95, 0xDA, 0x9D, 0x86, 0xC5, 0x8D, 0xC7, 0xCC,
-    0x1C, 0x08, 0xE8, 0xA6, 0x4A, 0x83, 0xA7, 0x04, 0x27, 0x68, 0x9D, 0x7E, 0x7A, 0xF7, 0x02, 0x19,
-    0xBE, 0xE7, 0x1D, 0xBB, 0x7C, 0x89, 0xA7, 0x60, 0xF4, 0x05, 0x4A, 0xD4, 0xA7, 0x08, 0x50, 0x49,
-    0xDA, 0x8C, 0x27, 0xD5, 0xF8, 0x93, 0xFE, 0x38, 0xFF, 0xFB, 0x1A, 0x8B, 0x04, 0xBE, 0x0C, 0xB6,
-    0x80, 0x7E, 0x32, 0xA6, 0xAF, 0x20, 0xC2, 0x78, 0x52, 0x53, 0xF9, 0x90, 0x55, 0xFE, 0xC4, 0x08,
-    0x73, 0xF5, 0xA4, 0x5A, 0x8C, 0x2F, 0xB9, 0xEB, 0x71, 0xA1, 0x8B, 0xDC, 0xB9, 0x1B, 0x0A, 0xAA,
-    0xA5, 0x8C, 0xE9, 0xEA, 0x01, 0xC4, 0x9E, 0x07, 0xBF, 0xE7, 0xBC, 0x5E, 0x1F, 0x83, 0x33, 0x3A,
-    0x4A, 0x2C, 0x04, 0x0E, 0x49, 0x65, 0x7A, 0x18, 0xF0, 0xC2, 0xC1, 0x22, 0x46, 0xE6, 0xDA, 0x81,
-    0x42, 0x30, 0xEF, 0x10, 0x69, 0xA6, 0x44, 0xE5, 0xD3, 0x71, 0xEB, 0x65, 0xC1, 0x08, 0xC6, 0x0B,
-    0x86, 0x45, 0x0E, 0x1F, 0x61, 0x9D, 0xC2, 0xB2, 0x2B, 0x9E, 0x69, 0x2B, 0x58, 0x02, 0xC2, 0x7B,
+    0x1C, 0x08, 0xE8, 0xA6, 0x4A, 0x83, 0xA7, 0x04, 0x27, 0x68, 0x9D, 0x7E, 0x7A, 0xF7, 0x3C, 0x19,
+    0xBE, 0xEF, 0x1D, 0xBB, 0x7A, 0x99, 0xA7, 0x60, 0xF4, 0x05, 0x4A, 0xD4, 0xA7, 0x08, 0x50, 0x49,
+    0xDA, 0x8C, 0x27, 0x65, 0xFD, 0x49, 0x7F, 0x5C, 0xFC, 0x73, 0x8D, 0x45, 0x02, 0x5F, 0x06, 0x5B,
+    0x40, 0x3F, 0x19, 0xD3, 0x57, 0x10, 0x61, 0x3C, 0xA9, 0xA9, 0x7C, 0xC8, 0x6A, 0x7F, 0x62, 0x84,
+    0xB9, 0x66, 0x52, 0x2D, 0xC6, 0x97, 0xC2, 0xF5, 0xB8, 0xD0, 0x45, 0xEE, 0xEC, 0x75, 0x05, 0xD5,
+    0x52, 0xC6, 0x74, 0xFD, 0x00, 0x62, 0xCF, 0x83, 0xDF, 0x0B, 0x5E, 0x6F, 0x8E, 0xC1, 0x19, 0x1D,
+    0x25, 0x16, 0x02, 0x87, 0xA4, 0x32, 0x3D, 0x0C, 0x78, 0xE1, 0x60, 0x11, 0x23, 0x73, 0xED, 0x40,
+    0x21, 0x98, 0x77, 0x88, 0x34, 0x53, 0xA2, 0xF2, 0xE9, 0xB8, 0xF5, 0xB2, 0x60, 0x04, 0xE3, 0xF9,
+    0x9C, 0x45, 0x0E, 0x1F, 0x61, 0x9D, 0xC2, 0xB2, 0x2B, 0x9E, 0x69, 0x2B, 0x58, 0x02, 0xC2, 0x7B,
     0x9C, 0x62, 0xC4, 0x7B, 0xB9, 0xA0, 0xF3, 0x62, 0x4C, 0x07, 0x9F, 0x60, 0x8E, 0xA1, 0x45, 0xBB,
-    0x47, 0x4F, 0x9F, 0x85, 0x53, 0x0C, 0x85, 0xD2, 0x77, 0x1B, 0x59, 0x0D, 0xDA, 0x47, 0x4A, 0x3F,
-    0x7E, 0x03, 0x89, 0xF9, 0x1F, 0x8D, 0x28, 0xD0, 0x0E, 0xE6, 0x02, 0xF5, 0x11, 0xCA, 0x0E, 0xAB,
-    0xE0, 0x36, 0x10, 0x72, 0x12, 0x1B, 0xCE, 0xC8, 0x4F, 0xC7, 0xEB, 0x58, 0x5E, 0x2C, 0x18, 0xA0,
-    0x1F, 0x6B, 0x5A, 0xCE, 0x75, 0x33, 0x58, 0x81, 0x13, 0x3E, 0xE0, 0x95, 0x8E, 0x70, 0x0C, 0x14,
-    0x12, 0x73, 0xEA, 0x61, 0xEE, 0xC4, 0x82, 0x46, 0xDD, 0x1E, 0xE6, 0xB9, 0x71, 0x1E, 0xDD, 0x64,
-    0xFE, 0x85, 0xC3, 0x68, 0xB3, 0x97, 0xE6, 0xE9, 0x7D, 0xE3, 0x54, 0x31, 0x53, 0x87, 0x85, 0x1E,
-    0x20, 0x4E, 0xEA, 0xB2, 0x4B, 0x1E, 0x80, 0x8F, 0x62, 0x1A, 0xD9, 0x39, 0x33, 0x61, 0x3B, 0x63,
-    0xDB, 0xA3, 0xA2, 0x7F, 0xFA, 0x38, 0xFE, 0xC9, 0x0A, 0x59, 0xCF, 0xCC, 0x2E, 0xA2, 0x3C, 0x2A,
-    0xDA, 0xE5, 0xE8, 0x43, 0xAE, 0xE6, 0x84, 0xAA, 0x6D, 0x7C, 0x65, 0xC0, 0xF3, 0x48, 0x60, 0x78,
-    0xD8, 0xF1, 0xE9, 0x52, 0xBE, 0x3D, 0x18, 0x84, 0xBB, 0xAB, 0x1C, 0x5E, 0xB2, 0x4E, 0x2E, 0xDF,
-    0x2F, 0xB0, 0x74, 0x4D, 0x88, 0xFA, 0xBB, 0xA6, 0x95, 0x2B, 0x84, 0x5C, 0xF6, 0x7E, 0xD9, 0x4C,
-    0x0D, 0x84, 0xA6, 0x4C, 0xDA, 0x6D, 0xF8, 0xB5, 0x3B, 0x07, 0xAA, 0xE5, 0x0E, 0x8C, 0xBD, 0x83,
-    0x3B, 0x41, 0xF5, 0xFA, 0xEC, 0xED, 0x65, 0x11, 0x80, 0xB8, 0x25, 0x87, 0x2A, 0xEA, 0x02, 0xD7,
-    0x44, 0x2D, 0xFA, 0x86, 0xB8, 0x09, 0x77, 0xDA, 0xA4, 0x89, 0xBE, 0xEC, 0x93, 0x1A, 0xED, 0x84,
-    0xAA, 0xE3, 0x66, 0x50, 0x55, 0xD2, 0xB8, 0xD4, 0xAA, 0x3A, 0xCF, 0xAC, 0xAA, 0xF4, 0xE5, 0x42,
-    0x59, 0xED, 0x4C, 0x6A, 0x53, 0x94, 0xCB, 0x56, 0x39, 0x28, 0xCC, 0xC9, 0x20, 0xB5, 0xE4, 0x12,
-    0xCD, 0x05, 0xE9, 0xD4, 0xDC, 0x4C, 0xBD, 0x8E, 0xF6, 0xC1, 0xB5, 0xA8, 0x3D, 0x62, 0x8A, 0x95,
-    0xC3, 0x60, 0x00, 0x8B, 0x01, 0x55, 0x00, 0xCB, 0x10, 0xC2, 0x0B, 0xF0, 0xA2, 0x34, 0x70, 0xBE,
-    0x1C, 0x15, 0x17, 0x27, 0x20, 0x9B, 0xA1, 0x4F, 0x19, 0xDF, 0x90, 0x95, 0x06, 0xD6, 0xC8, 0xD1,
-    0x88, 0x00, 0x37, 0x62, 0x38, 0x66, 0x9D, 0xB5, 0x44, 0x8E, 0x9A, 0x2E, 0xCC, 0x7E, 0xA4, 0x93,
-    0x03, 0x07, 0x0D, 0x3C, 0xA5, 0x75, 0xDF, 0x86, 0xAD, 0xCA, 0x61, 0x32, 0x67, 0x03, 0x04, 0x7B,
-    0x82, 0xDB, 0xE7, 0x5C, 0xE7, 0xE2, 0xEA, 0xE1, 0x30, 0x0F, 0x3A, 0xC5, 0xC8, 0x86, 0xC9, 0x93,
-    0xCF, 0xD8, 0x8E, 0x86, 0x77, 0x0E, 0x89, 0xEF, 0xF5, 0xBF, 0x80, 0x6F, 0x4B, 0xB7, 0x66, 0x0E,
-    0x93, 0xB5, 0xB5, 0xC3, 0x32, 0xF6, 0x37, 0xE5, 0x8C, 0x2E, 0x46, 0x75, 0xBB, 0x8F, 0x08, 0x73,
-    0x56, 0x5C, 0x11, 0xA1, 0x13, 0xB8, 0xD7, 0x69, 0x3B, 0x66, 0x72, 0xF6, 0x08, 0xFB, 0x68, 0x39,
-    0x4A, 0x39, 0x7E, 0x67, 0x98, 0xD6, 0x28, 0xC7, 0x38, 0xCB, 0xD1, 0xC6, 0xF0, 0x60, 0x74, 0x04,
-    0xF0, 0x60, 0x4D, 0x39, 0xB6, 0xB4, 0xD1, 0xD7, 0x3A, 0xC8, 0xF1, 0x42, 0x9D, 0x4B, 0xAE, 0x6C,
-    0x29, 0xB9, 0x46, 0xD4, 0xE6, 0x03, 0xE5, 0xE8, 0x28, 0x47, 0x83, 0xF4, 0xBD, 0xE8, 0xD3, 0x8D,
-    0x6C, 0x53, 0x8E, 0x67, 0xE5, 0x21, 0x5E, 0x17, 0x78, 0xC8, 0x5C, 0xF7, 0xA1, 0xB7, 0xE8, 0x41,
-    0x7B, 0x28, 0xE4, 0xA3, 0x38, 0xA2, 0xFE, 0x68, 0xF9, 0x7D, 0x22, 0x1F, 0x11, 0xC0, 0x01, 0x03,
-    0x18, 0xF7, 0x53, 0x46, 0x71, 0x86, 0x40, 0x04, 0x8C, 0x20, 0xD1, 0x69, 0x74, 0xF7, 0x88, 0xAB,
-    0x84, 0xC5, 0xAB, 0xE2, 0x94, 0x82, 0x6F, 0x95, 0x33, 0xB2, 0x61, 0x04, 0xC5, 0xF0, 0x0E, 0x5D,
-    0x7B, 0x90, 0x7B, 0xD2, 0x2E, 0xEA, 0x59, 0xA2, 0x8F, 0xDC, 0x3C, 0x54, 0xE6, 0x53, 0xF9, 0x01,
-    0xC7, 0x57, 0x1F, 0x32, 0x8B, 0x2E, 0xF2, 0xE7, 0xE3, 0x66, 0x1E, 0x56, 0xD7, 0xB1, 0xBE, 0x5F,
-    0x30, 0x9B, 0xDC, 0xC6, 0xC5, 0xC0, 0xAC, 0x1D, 0x9E, 0xD2, 0x70, 0x53, 0xBF, 0xE2, 0x09, 0x13,
-    0xE7, 0x9C, 0x72, 0x41, 0x3F, 0x87, 0x6B, 0xEB, 0x02, 0x3D, 0x23, 0x50, 0x3A, 0x7B, 0x7B, 0x90,
-    0xF4, 0xC3, 0x4E, 0xD4, 0x2D, 0xA4, 0x66, 0xB4, 0xEE, 0x89, 0x2F, 0x01, 0xC4, 0xA3, 0xA4, 0xCF,
-    0xC3, 0xDD, 0xB4, 0x01, 0x44, 0xA4, 0x5A, 0xE4, 0x60, 0x5F, 0xA0, 0xED, 0xCF, 0x1B, 0x60, 0x0D,
-    0xC7, 0xB5, 0x28, 0xC5, 0x20, 0x71, 0xDA, 0x44, 0x5D, 0x82, 0x0E, 0x39, 0x69, 0x7D, 0x87, 0xDC,
-    0xA4, 0x8D, 0xBA, 0xCF, 0x0E, 0x19, 0xDE, 0xCC, 0x7C, 0xFC, 0xB1, 0xD9, 0x4B, 0x41, 0x85, 0xEC,
-    0xA1, 0x5E, 0x3D, 0xE5, 0x74, 0x24, 0x1B, 0x26, 0x2B, 0x48, 0x0E, 0x2B, 0x30, 0xBB, 0x04, 0x23,
-    0xBB, 0xF2, 0x9E, 0x6D, 0x29, 0xFA, 0xA8, 0x16, 0x8E, 0x9D, 0x7C, 0x3E, 0x52, 0x1E, 0x7C, 0x53,
-    0x4D, 0x89, 0xA2, 0xA2, 0xD6, 0x08, 0xBF, 0x0A, 0x8F, 0x64, 0xE8, 0x59, 0x41, 0x1C, 0x96, 0xD3,
-    0x7F, 0xFD, 0x13, 0xEC, 0xF5, 0x4B, 0xC4, 0x5C, 0xFE, 0x92, 0x2B, 0xF6, 0xF6, 0xB3, 0x42, 0x26,
-    0x31, 0xDD, 0x2F, 0x8A, 0x5C, 0x5D, 0xED, 0xEF, 0x75, 0x88, 0xC3, 0xE8, 0xD8, 0xD8, 0xAF, 0xF9,
-    0x63, 0xFD, 0xC5, 0x8D, 0xC8, 0xDD, 0x42, 0xFA, 0x70, 0x36, 0x6D, 0x1D, 0xAC, 0x95, 0x17, 0xF8,
-    0x03, 0x04, 0xE4, 0xC4, 0x00, 0xBF, 0x3D, 0xE0, 0x20, 0x9D, 0x83, 0xA9, 0x4A, 0x56, 0x22, 0x23,
-    0x56, 0xEC, 0xEE, 0x7E, 0xA0, 0x2D, 0x0B, 0x9F, 0x63, 0xB8, 0x2D, 0xB5, 0x68, 0x62, 0x96, 0xA5,
-    0xA9, 0x58, 0x05, 0x43, 0x89, 0x41, 0xB3, 0x5D, 0x2D, 0x96, 0xA6, 0xC9, 0xD4, 0xCB, 0xCC, 0xBB,
-    0xE3, 0x8A, 0xDD, 0xBC, 0xBB, 0x0C, 0xBD, 0xD3, 0xDF, 0x41, 0x65, 0x83, 0xE0, 0xDE, 0xD6, 0x7B,
-    0x3D, 0xCD, 0x32, 0xF4, 0xB8, 0x1E, 0x29, 0x74, 0x3E, 0x7D, 0x7A, 0x1A, 0xFC, 0x1E, 0xD7, 0xCB,
-    0xD3, 0xCD, 0x5F, 0x7C, 0xE5, 0x0E, 0xD0, 0xE0, 0x16, 0x50, 0x1F, 0xEF, 0x3B, 0x22, 0xBE, 0x03,
-    0xAC, 0x92, 0x06, 0x70, 0xB5, 0xC8, 0xCF, 0x91, 0x02, 0xDA, 0x05, 0x52, 0x82, 0x6B, 0x3A, 0x71,
-    0x7F, 0x10, 0x4F, 0x0D, 0x73, 0xE4, 0xE4, 0x49, 0xEE, 0x4F, 0x7D, 0x82, 0x52, 0x66, 0x64, 0xF9,
-    0x9A, 0xDE, 0xBD, 0xB7, 0xB7, 0x9D, 0x77, 0xF9, 0x4E, 0xE8, 0x7A, 0xE5, 0xBA, 0xAC, 0x7D, 0x86,
-    0xB9, 0xA3, 0x98, 0x4B, 0xCE, 0xE9, 0x53, 0x1A, 0x93, 0xBB, 0x0A, 0x35, 0x12, 0xC2, 0x2C, 0xAA,
-    0x7D, 0x60, 0xF5, 0xFC, 0x64, 0x08, 0x8C, 0xFA, 0xA0, 0x27, 0x26, 0xFB, 0x3C, 0x31, 0xBB, 0x83,
-    0xC8, 0x1E, 0x7C, 0x2D, 0x9C, 0xD6, 0xCC, 0x05, 0x48, 0x00, 0x94, 0x10, 0xD7, 0x08, 0xF7, 0x5E,
-    0x36, 0x1F, 0x92, 0x4F, 0x4A, 0xFE, 0x09, 0x30, 0x02, 0x28, 0x90, 0x2C, 0xFA, 0x9E, 0x09, 0xFB,
-    0x8C, 0x20, 0x4B, 0xF8, 0x0D, 0x88, 0xD9, 0x69, 0x96, 0xA6, 0xE9, 0x3D, 0x71, 0xF0, 0x9E, 0x18,
-    0xD5, 0x33, 0xD1, 0x65, 0x68, 0x3E, 0x7B, 0x0A, 0x58, 0xA2, 0x3D, 0xBD, 0xDD, 0xBD, 0xD7, 0xA5,
-    0x64, 0x44, 0x89, 0xD8, 0xC1, 0xB4, 0x67, 0x81, 0x4F, 0x6F, 0x72, 0xEF, 0x2E, 0x9E, 0xF1, 0x48,
-    0xD5, 0x69, 0x35, 0xED, 0xB2, 0x6B, 0xE6, 0x74, 0xF1, 0x7D, 0x20, 0xAC, 0xBE, 0x3D, 0xB7, 0x0E,
-    0xC1, 0x9B, 0x04, 0x3E, 0xBC, 0x8B, 0xD5, 0x01, 0xEA, 0xA9, 0xE9, 0x53, 0x33, 0x6F, 0x3D, 0xD0,
-    0x4C, 0x10, 0x50, 0x9C, 0x49, 0x9C, 0xCD, 0x7E, 0x56, 0x5F, 0xF5, 0x6B, 0xF5, 0xF5, 0xDF, 0x4D,
-    0xDE, 0xA8, 0xD4, 0x7B, 0x35, 0x3E, 0x47, 0x7D, 0x2F, 0xF4, 0x7F, 0x31, 0x05, 0xA4, 0x14, 0x1B,
-    0x92, 0xEC, 0x00, 0x0F, 0x67, 0xB4, 0xCE, 0x70, 0x3E, 0x45, 0xAF, 0x51, 0x95, 0x94, 0x1F, 0x55,
-    0x11, 0xB7, 0x1B, 0x47, 0x57, 0xA7, 0x8D, 0xAE, 0xB5, 0x05, 0xD8, 0x73, 0x14, 0x5E, 0x65, 0xCC,
-    0xA8, 0x28, 0x76, 0x90, 0x66, 0xE0, 0xDC, 0xE1, 0xC2, 0x6D, 0xE3, 0xFA, 0x0C, 0xAA, 0xFD, 0x4E,
-    0x56, 0x51, 0x9E, 0xAF, 0x24, 0xC5, 0x54, 0x33, 0x6D, 0x4B, 0xF4, 0x85, 0xB3, 0xD1, 0x8E, 0xAB,
-    0xE3, 0x31, 0x6D, 0x92, 0x7E, 0x32, 0x1E, 0xF7, 0xF3, 0x69, 0x42, 0x1A, 0xD1, 0x9B, 0x71, 0xA2,
-    0x6A, 0x60, 0x4C, 0x14, 0xD7, 0xE5, 0xEC, 0xC4, 0xC5, 0xD4, 0x6C, 0xB0, 0x49, 0x0E, 0xE7, 0x05,
-    0xB9, 0x8C, 0xF6, 0x8C, 0x7B, 0x6E, 0x58, 0xCC, 0xAC, 0x71, 0x0C, 0x35, 0xC3, 0xCA, 0x0A, 0x2D,
-    0x83, 0x61, 0x35, 0x35, 0x85, 0x2C, 0x66, 0x96, 0x33, 0x78, 0x2E, 0x43, 0x60, 0x25, 0xAE, 0xF8,
-    0xDF, 0x4E, 0xBC, 0x2C, 0xCD, 0x83, 0x4E, 0x6C, 0x96, 0xA6, 0x99, 0x3D, 0xCF, 0x8D, 0x07, 0x1B,
-    0xEC, 0x38, 0x13, 0xDA, 0xAB, 0xCB, 0xCB, 0xC8, 0xA0, 0x18, 0x1E, 0x08, 0x8A, 0x65, 0xE8, 0x9D,
-    0x96, 0x69, 0xEF, 0x20, 0x9F, 0xBF, 0x1F, 0xF8, 0xB9, 0x60, 0x53, 0x7C, 0x39, 0xAA, 0xE7, 0xFB,
-    0x3C, 0x1F, 0x59, 0xFC, 0x06, 0x72, 0x1F, 0xA5, 0xAB, 0xA3, 0x5F, 0xD9, 0x04, 0xB5, 0xAB, 0xAA,
-    0x5D, 0x95, 0x7E, 0xE0, 0xEA, 0xEC, 0xDD, 0x5B, 0x95, 0xBE, 0x75, 0xB1, 0xD2, 0x23, 0x3C, 0xA1,
-    0x87, 0x97, 0x35, 0xA5, 0x49, 0x77, 0x10, 0xAC, 0xBE, 0x31, 0xAF, 0xE5, 0xB9, 0xFD, 0xC5, 0x88,
-    0x9E, 0xDC, 0xD3, 0xC3, 0x77, 0x30, 0x01, 0xDB, 0xF1, 0xEB, 0xC7, 0x37, 0xFC, 0xCF, 0x5E, 0x15,
-    0x5A, 0x35, 0xBB, 0xDF, 0x9F, 0xA8, 0x13, 0x00, 0x98, 0x7A, 0x00, 0x74, 0xCB, 0x68, 0xF4, 0x41,
-    0xAF, 0x07, 0x40, 0x78, 0xDB, 0x1F, 0x4C, 0xB1, 0xBE, 0x59, 0x6F, 0x27, 0x5F, 0x7B, 0x14, 0x34,
-    0x17, 0x29, 0x76, 0xDC, 0x6B, 0xD0, 0x97, 0xA2, 0xE9, 0x9B, 0x72, 0x9F, 0x12, 0x77, 0x9B, 0xF2,
-    0xE5, 0xF5, 0xF6, 0xB5, 0x98, 0x0F, 0xB1, 0x69, 0xE3, 0x74, 0x51, 0x22, 0x00, 0x47, 0x36, 0xA7,
-    0xA2, 0x29, 0xE8, 0x01, 0x28, 0x41, 0xCF, 0x2D, 0xA9, 0x81, 0xC5, 0xDB, 0xC0, 0xAA, 0x6D, 0xE4,
-    0x1B, 0x14, 0x44, 0xB6, 0x19, 0xA9, 0xEB, 0xEC, 0x80, 0xFD, 0xAF, 0x41, 0xDA, 0x6F, 0xFC, 0x35,
-    0x8B, 0x9A, 0xC8, 0x57, 0x66, 0xE5, 0xA2, 0x60, 0x2A, 0xF9, 0x44, 0xC9, 0x9B, 0xA5, 0x99, 0xF7,
-    0x5A, 0x0E, 0xEC, 0x99, 0x51, 0x82, 0x32, 0x2B, 0x64, 0xF4, 0x5B, 0x39, 0x6D, 0xE0, 0x7E, 0xD1,
-    0x85, 0x63, 0xD4, 0x47, 0x8B, 0x9F, 0x4C, 0xDA, 0xB8, 0x8B, 0x9B, 0xB9, 0x1C, 0xEC, 0x32, 0xFE,
-    0x10, 0x62, 0xD5, 0x67, 0x28, 0x07, 0xDF, 0xEB, 0xE5, 0xBF, 0xFD, 0x60, 0x22, 0xC7, 0xAE, 0x2D,
-    0x2A, 0x75, 0xF5, 0x0E, 0xA6, 0xE0, 0x9C, 0x39, 0x3C, 0x05, 0xFF, 0x03, 0xBD, 0x5A, 0x3D, 0x8C,
-    0xDC, 0xC6, 0x15, 0x1E, 0x92, 0x91, 0x08, 0x88, 0xC5, 0xB8, 0x90, 0x11, 0xC4, 0x46, 0xC2, 0x26,
-    0x45, 0x9C, 0xC0, 0x66, 0x9B, 0x22, 0xBE, 0xA1, 0x52, 0x24, 0x40, 0x5C, 0x44, 0x85, 0x2E, 0x4D,
-    0x0A, 0x35, 0x2A, 0x0C, 0x23, 0xC8, 0xB5, 0x2E, 0xA2, 0x23, 0x55, 0xA5, 0x48, 0x73, 0x4D, 0xEA,
-    0x5C, 0xA1, 0x00, 0xC2, 0x35, 0x49, 0xA9, 0xE2, 0xEE, 0xC8, 0xC4, 0xA5, 0x8B, 0x30, 0x36, 0x02,
-    0x17, 0x29, 0x44, 0x04, 0x02, 0x12, 0xD8, 0x30, 0x44, 0xC9, 0x94, 0x4D, 0xEB, 0x48, 0x4E, 0xBE,
-    0x6F, 0x66, 0xC8, 0xDD, 0xFB, 0x91, 0x64, 0xDD, 0xED, 0x69, 0x75, 0x9C, 0xD3, 0xED, 0x72, 0x67,
-    0xBE, 0xF7, 0xE6, 0xFD, 0x7C, 0xEF, 0x0D, 0x85, 0xF8, 0xE1, 0x4E, 0x2A, 0x84, 0xD2, 0xD3, 0x60,
-    0x5E, 0x71, 0x8B, 0x41, 0x75, 0x18, 0x32, 0x0E, 0x23, 0x06, 0x6F, 0xE8, 0x85, 0x08, 0x1E, 0x63,
-    0x08, 0x1B, 0x0C, 0xB2, 0xC6, 0x90, 0x94, 0x18, 0x54, 0x3E, 0x08, 0x51, 0xFC, 0x11, 0x83, 0xD6,
-    0xA3, 0xF0, 0x39, 0x04, 0x5A, 0x6B, 0x11, 0x35, 0xA2, 0xC0, 0x6D, 0x18, 0x92, 0x12, 0x83, 0xCA,
-    0x45, 0x26, 0xB0, 0x18, 0xEE, 0xD5, 0xB8, 0x46, 0xBB, 0xD0, 0xE6, 0xCF, 0xB6, 0x02, 0x7D, 0xAF,
-    0x94, 0x5A, 0x97, 0x71, 0xAB, 0x4B, 0x55, 0x66, 0x39, 0xFE, 0xA5, 0x45, 0x9A, 0x09, 0x8D, 0x2F,
-    0x69, 0x31, 0x0A, 0xED, 0xE1, 0x0A, 0x06, 0x7C, 0xAD, 0x17, 0x6A, 0xEC, 0x45, 0xFC, 0xB8, 0x13,
-    0x4B, 0xAF, 0xDD, 0xB0, 0x04, 0xCA, 0x22, 0x27, 0x7C, 0xFC, 0x19, 0xDD, 0x17, 0xE7, 0x2D, 0x03,
-    0x5F, 0x5D, 0x84, 0xBF, 0x8B, 0x14, 0x80, 0x16, 0x4B, 0x9E, 0x49, 0x96, 0xF3, 0x43, 0xEB, 0x71,
-    0xE6, 0xB0, 0xC2, 0x20, 0x4B, 0x0E, 0xE6, 0x7F, 0x5C, 0x23, 0x9C, 0xD6, 0x3E, 0x2D, 0xF0, 0x00,
-    0x53, 0x49, 0xDA, 0x0D, 0xA1, 0x5F, 0xC5, 0x55, 0x13, 0xE5, 0xD2, 0xDE, 0x44, 0xB8, 0x29, 0xC6,
-    0x1B, 0x0A, 0x37, 0xED, 0xD9, 0xB7, 0x42, 0x5D, 0x8B, 0x4C, 0xF7, 0x9E, 0xD6, 0x5D, 0xA0, 0xAF,
-    0xFC, 0x95, 0x40, 0xE2, 0x06, 0x72, 0x61, 0x2A, 0x55, 0x52, 0x34, 0x28, 0x00, 0x77, 0x17, 0xEE,
-    0xE2, 0xFF, 0x33, 0xBE, 0x5F, 0x5F, 0x14, 0x31, 0x45, 0xC4, 0xE5, 0xE9, 0x61, 0x5E, 0xC1, 0x1F,
-    0x29, 0x06, 0x64, 0x4A, 0x8C, 0xE9, 0x6E, 0xDC, 0xF7, 0x75, 0x2F, 0x75, 0x97, 0xB4, 0xDF, 0xC7,
-    0x6C, 0x59, 0x0E, 0xF4, 0x80, 0xEF, 0x7E, 0x8A, 0x34, 0xCD, 0x74, 0xA5, 0x74, 0x15, 0xE9, 0x7C,
-    0x9E, 0x40, 0x97, 0xD0, 0x5D, 0x2D, 0xE4, 0xC7, 0xAD, 0x48, 0x44, 0x77, 0x1E, 0x10, 0x55, 0x23,
-    0x30, 0x51, 0x37, 0x44, 0xD5, 0x5B, 0xA7, 0x83, 0x48, 0xF5, 0xE2, 0x3E, 0xB3, 0xD8, 0x1B, 0xE7,
-    0xA2, 0x45, 0x18, 0x06, 0xB6, 0x09, 0xDF, 0xBE, 0x74, 0x3A, 0x2D, 0xCA, 0x72, 0x4F, 0x04, 0x5F,
-    0xB4, 0x30, 0x45, 0x00, 0x70, 0x41, 0x64, 0xC5, 0x10, 0x83, 0x06, 0x3B, 0xDC, 0xD3, 0xEE, 0x61,
-    0xCE, 0xAA, 0xB2, 0x6F, 0x6E, 0xDC, 0xC7, 0x92, 0xBD, 0x00, 0x54, 0x01, 0xAC, 0x66, 0x5E, 0xA3,
-    0x28, 0x61, 0x90, 0xCE, 0x17, 0x20, 0x03, 0x4A, 0x85, 0x00, 0x51, 0x89, 0x65, 0xC5, 0x72, 0x56,
-    0x98, 0xA6, 0xF7, 0x75, 0xCF, 0x1B, 0xE9, 0x26, 0x99, 0x9B, 0xD8, 0xC6, 0x27, 0x0D, 0x11, 0x30,
-    0xF4, 0xC2, 0x1B, 0x7F, 0x3D, 0xC0, 0x1D, 0x3D, 0x2D, 0xFC, 0x1E, 0x33, 0x06, 0x3D, 0x96, 0x08,
-    0x3A, 0x0C, 0x61, 0x2B, 0x8C, 0xDB, 0x69, 0x21, 0xED, 0xE0, 0x0F, 0xF0, 0x00, 0x7C, 0x1E, 0x57,
-    0x10, 0x38, 0xF9, 0x67, 0xD1, 0x60, 0x51, 0x98, 0x98, 0x82, 0x8B, 0x62, 0xD8, 0x32, 0x6B, 0xB6,
-    0xA3, 0xF3, 0xE8, 0xE8, 0x11, 0xD6, 0x94, 0x5F, 0x54, 0xD6, 0x6B, 0x36, 0x61, 0xC5, 0x74, 0x43,
-    0x41, 0x3F, 0x84, 0xAE, 0xF8, 0x35, 0x78, 0xA2, 0xA0, 0x2B, 0x62, 0xA9, 0x4C, 0x18, 0x67, 0x34,
-    0xDE, 0x08, 0x77, 0xA4, 0xF3, 0x07, 0x54, 0x87, 0x66, 0x40, 0x80, 0x47, 0x22, 0x82, 0xCC, 0x71,
-    0xF1, 0xF9, 0xE8, 0xBF, 0x3D, 0xA4, 0x05, 0xF5, 0xA1, 0xA1, 0x98, 0x52, 0x8B, 0x8D, 0x27, 0xF9,
-    0x37, 0x46, 0x2F, 0x28, 0x75, 0x88, 0xED, 0x09, 0xF1, 0xF6, 0x85, 0xEB, 0xF7, 0x19, 0x52, 0x3C,
-    0x7D, 0xBD, 0xC4, 0x5B, 0x0C, 0x21, 0xB9, 0xAA, 0x8B, 0x5C, 0xB9, 0xF0, 0x41, 0xD8, 0x26, 0x7C,
-    0x88, 0xE1, 0x70, 0xF8, 0x98, 0xB0, 0x5E, 0xDC, 0xD9, 0x86, 0xBC, 0xF0, 0x3F, 0x6D, 0x35, 0x5F,
-    0x60, 0x1B, 0xB4, 0x6E, 0x78, 0x79, 0xE3, 0x7A, 0x4A, 0x31, 0x7D, 0x46, 0x41, 0x5E, 0x5A, 0xA7,
-    0xA1, 0xB3, 0x0C, 0xF9, 0x78, 0x9D, 0x1A, 0x37, 0x7A, 0x8B, 0x2B, 0x67, 0x55, 0x9C, 0xDB, 0x5D,
-    0xE2, 0x3D, 0x97, 0x67, 0xB4, 0xCB, 0x33, 0x09, 0x2D, 0x65, 0x30, 0xDF, 0x8D, 0xEB, 0x2C, 0x85,
-    0x62, 0x45, 0x76, 0x05, 0xFA, 0xC4, 0x7B, 0xD4, 0x93, 0xFE, 0xB3, 0xB3, 0x14, 0xF1, 0x8A, 0xC8,
-    0x3E, 0x6D, 0x31, 0x47, 0x8B, 0x7B, 0x97, 0x42, 0x99, 0x14, 0xAD, 0x90, 0x9F, 0x35, 0x78, 0xB3,
-    0x12, 0xDE, 0xBE, 0x58, 0x29, 0x56, 0xBE, 0x1A, 0x99, 0x8B, 0x11, 0xBB, 0x9B, 0x61, 0x92, 0xD7,
-    0xEB, 0xD5, 0x60, 0x16, 0x9B, 0x4B, 0x3E, 0xF0, 0xEE, 0xEA, 0x31, 0x07, 0xB8, 0x21, 0xA2, 0x05,
-    0xE3, 0xB7, 0x9F, 0x9F, 0x1D, 0xF3, 0xAA, 0xB0, 0x31, 0xD7, 0xC5, 0x08, 0x27, 0x6B, 0xC2, 0x66,
-    0x1E, 0xE5, 0x6E, 0x3C, 0x0B, 0x3E, 0xCE, 0x77, 0x13, 0x1F, 0x50, 0x74, 0x06, 0x25, 0x46, 0x11,
-    0xE5, 0x64, 0x8E, 0xF3, 0x5E, 0x44, 0xFF, 0x6D, 0x00, 0xB2, 0x44, 0xC8, 0x5A, 0xBD, 0x9E, 0x7B,
-    0x04, 0x86, 0x4D, 0xB8, 0xBF, 0xEA, 0x1D, 0x4D, 0x58, 0x85, 0x6D, 0x64, 0x35, 0xB0, 0xB6, 0x26,
-    0x0E, 0xC9, 0xFC, 0xA6, 0xF5, 0x45, 0x84, 0x51, 0xF8, 0x3B, 0x26, 0x18, 0x02, 0x9D, 0xFE, 0x26,
-    0xEA, 0x0F, 0x47, 0xEC, 0x2C, 0xD7, 0x7D, 0x96, 0xEA, 0xBE, 0x48, 0x75, 0x57, 0xA4, 0x61, 0x9B,
-    0xA5, 0x51, 0x93, 0x95, 0xB2, 0x51, 0xB5, 0xAC, 0x11, 0xB1, 0x91, 0x0F, 0x34, 0xE2, 0xC0, 0x98,
-    0x2E, 0x82, 0x2B, 0x10, 0x48, 0x28, 0x4A, 0xFD, 0xB2, 0x14, 0x5D, 0x60, 0x17, 0x4F, 0x6E, 0xDD,
-    0x16, 0xFA, 0xAB, 0x06, 0x3A, 0x68, 0xC2, 0x41, 0x35, 0xB2, 0x89, 0x6B, 0xFC, 0xAB, 0x92, 0x2A,
-    0x06, 0xED, 0x48, 0x70, 0xA9, 0x9C, 0x41, 0x4F, 0xFD, 0x4D, 0xA7, 0x09, 0xF5, 0xC3, 0x30, 0xD3,
-    0x8F, 0x56, 0xE9, 0x50, 0xE0, 0xD5, 0x10, 0xC1, 0x0B, 0x6A, 0x2D, 0xE0, 0x86, 0xC9, 0x38, 0xAD,
-    0x53, 0xAE, 0x89, 0xE0, 0x49, 0x6F, 0xE4, 0x11, 0x1B, 0xF9, 0xB9, 0xC8, 0xF2, 0xB6, 0xDF, 0x88,
-    0xE4, 0x41, 0x85, 0xD4, 0x94, 0x0B, 0xFF, 0x6B, 0x71, 0x6E, 0xB2, 0xC0, 0x98, 0x5C, 0x7E, 0xC4,
-    0x75, 0x49, 0x9C, 0x8B, 0x2C, 0x34, 0x62, 0xDF, 0x19, 0xA4, 0xB8, 0x7D, 0x7E, 0xB2, 0xAC, 0x12,
-    0xF7, 0xAB, 0xA9, 0xF5, 0x37, 0x72, 0xA1, 0xDD, 0x05, 0x6C, 0xEB, 0xE4, 0x98, 0xD8, 0xEB, 0x6D,
-    0x6A, 0x3A, 0xB7, 0x7D, 0x21, 0x8D, 0x83, 0x4F, 0x91, 0xF5, 0x76, 0xA0, 0xB2, 0x51, 0x95, 0x4C,
-    0xB9, 0x96, 0xEC, 0x53, 0xD3, 0x7B, 0x47, 0xD0, 0x6E, 0xD0, 0x64, 0x55, 0xC2, 0xDB, 0x55, 0x8E,
-    0x99, 0xB2, 0x34, 0x30, 0x83, 0x36, 0xC9, 0xD2, 0xBA, 0xFC, 0x08, 0x9F, 0xFF, 0xD5, 0xC0, 0x5C,
-    0xDB, 0x4F, 0xB9, 0x16, 0x43, 0x52, 0x82, 0x4E, 0xA8, 0x12, 0x89, 0x55, 0xE5, 0xA0, 0x13, 0x2A,
-    0x67, 0x50, 0x98, 0xDD, 0xB4, 0x11, 0xE1, 0xC3, 0x0E, 0x96, 0xF1, 0xBB, 0x69, 0x45, 0xEB, 0xDC,
-    0x23, 0x4B, 0x04, 0x2B, 0xBA, 0xDF, 0x6F, 0x8A, 0xE0, 0x40, 0x97, 0x58, 0xAA, 0x0E, 0xC7, 0xB8,
-    0x89, 0x7A, 0x09, 0xB9, 0x65, 0x8D, 0xAB, 0x82, 0x36, 0x2B, 0x48, 0x6F, 0x25, 0xA7, 0xEC, 0xB9,
-    0x4A, 0x15, 0x72, 0x33, 0xB3, 0xF3, 0x02, 0xFD, 0x25, 0xBD, 0x53, 0xFC, 0x0F, 0x6A, 0xD7, 0x7D,
-    0xC2, 0x81, 0xE8, 0xF3, 0x33, 0xA1, 0x77, 0x28, 0x25, 0x22, 0x92, 0x44, 0x24, 0xBB, 0x38, 0x5C,
-    0xB3, 0x11, 0xB0, 0xD3, 0x29, 0x91, 0x62, 0xC6, 0x3A, 0x1A, 0x64, 0x1D, 0xB5, 0xDF, 0x00, 0x65,
-    0x72, 0x05, 0x45, 0xCD, 0x41, 0x25, 0xF0, 0x3D, 0xAF, 0xFA, 0xAD, 0x23, 0xEE, 0xA3, 0xBB, 0x3A,
-    0x56, 0x45, 0x0B, 0x52, 0xA9, 0x1C, 0x99, 0x3C, 0xA2, 0x25, 0xBF, 0x5F, 0x44, 0xE0, 0x18, 0xEF,
-    0x65, 0xA0, 0xA9, 0x05, 0xAE, 0xB0, 0xFE, 0x49, 0x3C, 0x76, 0x6B, 0x45, 0xF3, 0xE3, 0x88, 0x91,
-    0xC3, 0xBB, 0xC3, 0x3B, 0x20, 0x0E, 0x84, 0x81, 0x28, 0xD2, 0xFE, 0xD4, 0xDC, 0xDE, 0x84, 0x7C,
-    0x8C, 0x4B, 0x60, 0x05, 0x2E, 0xC0, 0xBA, 0x99, 0xB3, 0x64, 0x7A, 0xA5, 0x80, 0x2E, 0xED, 0x6C,
-    0x81, 0x0C, 0xC5, 0xBA, 0x7C, 0x31, 0x34, 0x7C, 0xDD, 0x35, 0x45, 0x69, 0x6E, 0x0A, 0xE1, 0xA9,
-    0x28, 0x5D, 0x11, 0x2A, 0x46, 0x26, 0xD1, 0xC4, 0x9F, 0x35, 0x52, 0xD3, 0xC6, 0x5F, 0x0C, 0x1B,
-    0xD6, 0xE7, 0x4F, 0x77, 0xF4, 0x03, 0x5B, 0x56, 0x8C, 0x5C, 0x18, 0x6B, 0xE2, 0x87, 0x06, 0x35,
-    0x72, 0x4D, 0x2C, 0x89, 0xB2, 0x15, 0x95, 0x3D, 0x68, 0x51, 0xBC, 0x25, 0x64, 0xCB, 0x55, 0x16,
-    0x11, 0x52, 0x99, 0x79, 0x5E, 0x33, 0x7F, 0xBE, 0x77, 0x68, 0x92, 0xA0, 0x3F, 0x86, 0xAA, 0xA6,
-    0x89, 0x03, 0x15, 0xA6, 0x5A, 0x33, 0xC1, 0x63, 0xC0, 0xCA, 0xE5, 0x9C, 0xBD, 0x21, 0x6F, 0xCB,
-    0x1A, 0x12, 0x5F, 0xF0, 0xB6, 0x9C, 0xC6, 0x4E, 0x81, 0xF6, 0x4E, 0xD0, 0x07, 0x5D, 0xD8, 0x46,
-    0x8D, 0x75, 0x3C, 0x9A, 0xB2, 0x31, 0xE3, 0x14, 0xDF, 0xD4, 0x23, 0x89, 0xF7, 0x88, 0xFB, 0x59,
-    0x08, 0x62, 0x5E, 0x7A, 0x4A, 0x39, 0x79, 0x8A, 0x4A, 0x01, 0x31, 0x4B, 0x63, 0xD6, 0xED, 0x31,
-    0x9D, 0x11, 0xEB, 0x1E, 0x8E, 0x22, 0xBE, 0xA9, 0x37, 0xC8, 0xDD, 0x63, 0x52, 0x69, 0xAC, 0x38,
-    0x62, 0x53, 0xAE, 0x90, 0x87, 0x70, 0x9F, 0x04, 0x23, 0x6B, 0xC8, 0xE4, 0xC7, 0x9A, 0x0B, 0x03,
-    0xB7, 0xEB, 0xEA, 0xCC, 0x01, 0x77, 0x6D, 0xF1, 0x8E, 0x88, 0xFF, 0xAE, 0x0D, 0x9B, 0xDE, 0x1D,
-    0xFF, 0x76, 0xD0, 0x87, 0x6D, 0xD0, 0x45, 0x4D, 0xD8, 0xCA, 0x26, 0xB2, 0x81, 0x02, 0x17, 0x78,
-    0x7F, 0x9D, 0x94, 0x71, 0x65, 0xC2, 0x24, 0x83, 0x64, 0xAA, 0x72, 0x94, 0x09, 0x28, 0x15, 0x10,
-    0xA8, 0x17, 0x46, 0xC2, 0x45, 0x0B, 0xD8, 0x53, 0x41, 0x37, 0x9F, 0xD4, 0x98, 0x35, 0xC7, 0x08,
-    0xC5, 0x21, 0x03, 0x3B, 0x62, 0x64, 0x86, 0x09, 0x75, 0xB6, 0x09, 0x41, 0x12, 0x19, 0x35, 0xE2,
-    0x30, 0x13, 0x2A, 0x17, 0x79, 0x10, 0x45, 0x90, 0xE7, 0xB8, 0x3C, 0x39, 0x11, 0x85, 0xFC, 0xD6,
-    0xBC, 0x79, 0x90, 0x36, 0x82, 0xB3, 0x24, 0xBF, 0xAF, 0xC5, 0x4D, 0xDF, 0x46, 0x4D, 0x98, 0xE6,
-    0x62, 0x7E, 0xAA, 0xA5, 0x79, 0xF6, 0xFC, 0x73, 0x2D, 0x6A, 0x61, 0xFA, 0xA3, 0xE5, 0x5A, 0xEC,
-    0xC6, 0x98, 0x4A, 0xB3, 0xE0, 0x5D, 0x9A, 0x85, 0xED, 0xE8, 0x73, 0xFF, 0xA1, 0x6F, 0xAF, 0x47,
-    0x2A, 0xF3, 0x7B, 0xBC, 0x1F, 0xF4, 0x78, 0x3F, 0x38, 0x18, 0xA8, 0x78, 0xCA, 0xC2, 0x81, 0x01,
-    0x4F, 0xC8, 0x47, 0x03, 0x97, 0xD3, 0x5C, 0x4F, 0x73, 0xC1, 0x8C, 0x86, 0x6B, 0x2C, 0x0A, 0x29,
-    0x50, 0x71, 0xC3, 0xC5, 0x9C, 0xDB, 0x4C, 0x62, 0x13, 0xA6, 0xB0, 0x30, 0x95, 0xD1, 0xF6, 0x53,
-    0x03, 0xBD, 0x0F, 0x4B, 0x93, 0xD8, 0x3B, 0x55, 0x85, 0x6D, 0x91, 0x46, 0x58, 0x44, 0x1E, 0xB4,
-    0xAE, 0x86, 0x6A, 0xC0, 0x4F, 0x5A, 0x91, 0x7C, 0x82, 0x68, 0xFC, 0x01, 0x08, 0xE4, 0x2D, 0x98,
-    0x11, 0xF6, 0x2D, 0x33, 0x45, 0x31, 0x5E, 0xEB, 0x6E, 0x2E, 0xCE, 0xE3, 0x38, 0x3B, 0x6C, 0xE1,
-    0xF4, 0xF3, 0x31, 0x10, 0x50, 0xC7, 0xD2, 0x11, 0xE4, 0xA7, 0x62, 0x3E, 0xBC, 0x1D, 0xF3, 0x56,
-    0x1C, 0xDD, 0x8E, 0x99, 0xF8, 0xDA, 0xE2, 0x10, 0xDF, 0xC1, 0x2D, 0xF8, 0x64, 0x6D, 0x9A, 0x79,
-    0xF2, 0xBF, 0x85, 0xAF, 0x3F, 0x33, 0xFC, 0x64, 0xE9, 0xB4, 0xAD, 0xF3, 0x17, 0xFB, 0xE7, 0x7D,
-    0x51, 0xF7, 0xE6, 0xC7, 0x20, 0xB8, 0xC6, 0xFB, 0xC1, 0x2A, 0xC0, 0x5D, 0x2F, 0xA6, 0xE2, 0xE8,
-    0xBC, 0xC5, 0xF3, 0x03, 0x4F, 0x5C, 0xB9, 0xC2, 0x03, 0x5B, 0xCC, 0x38, 0x62, 0xC2, 0x0F, 0x7D,
-    0xB0, 0x40, 0xED, 0xA4, 0xA3, 0x5A, 0x8C, 0x12, 0x6E, 0x1E, 0x9F, 0x5E, 0x4B, 0x45, 0x0C, 0xC3,
-    0x4C, 0x50, 0x3A, 0x2A, 0xC0, 0xD8, 0x3D, 0xEE, 0x5C, 0xCF, 0x9A, 0x67, 0xC9, 0xF0, 0x4D, 0x02,
-    0x79, 0xE6, 0xCE, 0x25, 0x24, 0x68, 0x48, 0xEE, 0x59, 0x2A, 0x9B, 0x37, 0x9E, 0x83, 0xE9, 0x69,
-    0xFB, 0xB4, 0x17, 0x3D, 0x1C, 0x25, 0x7E, 0x9A, 0x1B, 0x27, 0xEF, 0xD3, 0x31, 0x54, 0x04, 0xF5,
-    0x0A, 0x66, 0x6B, 0x4C, 0xFA, 0xF2, 0x60, 0x92, 0xB1, 0x73, 0xCD, 0xD8, 0x45, 0x8E, 0x59, 0x40,
-    0xC7, 0xE3, 0x24, 0x63, 0x84, 0xDD, 0x9B, 0xC2, 0x48, 0x32, 0x63, 0x60, 0x8B, 0x14, 0x65, 0x57,
-    0x9E, 0x0C, 0x9C, 0x0F, 0xC1, 0x2A, 0xB1, 0xDB, 0x53, 0x1A, 0x18, 0xF9, 0x52, 0x3A, 0xB0, 0x21,
-    0x6D, 0x74, 0xBD, 0x0E, 0x30, 0xBD, 0xF9, 0x6D, 0xA8, 0x44, 0x97, 0x0C, 0xE5, 0x55, 0xD0, 0x81,
-    0x95, 0x05, 0xAD, 0x0F, 0x86, 0xD9, 0xF8, 0x07, 0x88, 0xFA, 0xC1, 0x97, 0x7D, 0x54, 0x07, 0x0F,
-    0x7B, 0x59, 0x87, 0xCD, 0x20, 0xAB, 0xA8, 0xD1, 0x71, 0x29, 0xEB, 0x2C, 0x29, 0x65, 0xA5, 0x36,
-    0x72, 0x59, 0x2A, 0x9D, 0xC6, 0x65, 0x0C, 0xC2, 0x59, 0x4A, 0xCD, 0xB0, 0x8F, 0x21, 0x8D, 0x90,
-    0x3C, 0x44, 0x30, 0xB5, 0xB8, 0x48, 0x8D, 0x09, 0x62, 0xDF, 0x75, 0x6C, 0xF1, 0x6B, 0x7B, 0x5F,
-    0x04, 0x5F, 0x80, 0xD4, 0x1D, 0xBC, 0x28, 0xA9, 0x3B, 0x5F, 0xA4, 0x17, 0xAE, 0x4E, 0xBD, 0xE4,
-    0x24, 0x9F, 0x22, 0xD7, 0x0F, 0xCE, 0x82, 0xF7, 0x29, 0xB1, 0x69, 0xAA, 0x56, 0x22, 0x76, 0x90,
-    0xC9, 0x57, 0x92, 0x61, 0x6A, 0x5D, 0x9F, 0xFF, 0x7E, 0x24, 0x57, 0x3A, 0x21, 0xFF, 0x5D, 0x23,
-    0xA8, 0xE7, 0x26, 0x21, 0x9C, 0x41, 0x3E, 0x63, 0x46, 0xCC, 0x41, 0xB6, 0x39, 0x1E, 0x1B, 0xCD,
-    0xFD, 0xE2, 0xA7, 0x08, 0xAA, 0xF1, 0x9F, 0x46, 0x71, 0x39, 0x61, 0x9F, 0x4A, 0xB5, 0x3C, 0x4C,
-    0xA8, 0x60, 0xBA, 0x2C, 0xE5, 0x61, 0xC2, 0xC6, 0x82, 0xB5, 0x6B, 0xF7, 0x8D, 0xC6, 0x97, 0x3C,
-    0xA6, 0x1D, 0x43, 0x3D, 0x4C, 0xB0, 0xA1, 0x83, 0x4F, 0x3A, 0xE8, 0x9C, 0x0E, 0xEA, 0xA0, 0xF5,
-    0x8C, 0x0E, 0xBE, 0xEA, 0x8C, 0x0E, 0xC0, 0xD1, 0x29, 0x7E, 0xD8, 0x20, 0xD0, 0xC0, 0x79, 0xA9,
-    0x03, 0xB5, 0x01, 0x1D, 0x24, 0x0F, 0xA0, 0x83, 0x98, 0x3A, 0x80, 0xE4, 0x49, 0x1E, 0x51, 0x07,
-    0x01, 0x75, 0x00, 0x3F, 0x51, 0xC6, 0xFD, 0xCD, 0x4E, 0x18, 0xE7, 0x0F, 0x0B, 0xC3, 0x2C, 0xAA,
-    0x89, 0x59, 0x2C, 0x6B, 0xE2, 0x45, 0xCB, 0x8D, 0x29, 0xC0, 0xB0, 0xFC, 0xCC, 0x30, 0x77, 0xD6,
-    0xDA, 0x8E, 0xAD, 0xB7, 0x73, 0x9B, 0xFD, 0x02, 0x56, 0x57, 0x7A, 0x22, 0x7A, 0x21, 0x1B, 0x8E,
-    0x99, 0x71, 0x7C, 0xD4, 0x10, 0xC1, 0xE8, 0x6B, 0xEE, 0xBD, 0xA6, 0xA3, 0x14, 0x29, 0x32, 0x28,
-    0xBB, 0x1E, 0x1C, 0x18, 0x3F, 0xE8, 0xF2, 0x29, 0x34, 0xA8, 0xF1, 0x0B, 0x54, 0x01, 0x94, 0x69,
-    0x10, 0x59, 0x89, 0x42, 0x4E, 0xD5, 0x49, 0xCB, 0x7E, 0x72, 0xCD, 0xEA, 0x85, 0x34, 0x62, 0xEE,
-    0x91, 0x1E, 0xED, 0x10, 0x6E, 0xD4, 0x58, 0xBB, 0x37, 0x51, 0x24, 0x69, 0x34, 0xB7, 0x21, 0x9D,
-    0xE8, 0x8F, 0x36, 0xF4, 0x87, 0xDB, 0x81, 0x91, 0x33, 0xE3, 0xBE, 0x44, 0x37, 0x47, 0x7B, 0xC9,
-    0xE5, 0xDB, 0xC2, 0xF4, 0x21, 0xC0, 0x49, 0x28, 0xC3, 0x46, 0xFE, 0x72, 0x04, 0xE1, 0xAB, 0x8D,
-    0x5C, 0xFB, 0x10, 0xC2, 0xBC, 0x7E, 0x7F, 0x45, 0x02, 0x89, 0xE4, 0x43, 0x18, 0x6D, 0x46, 0x7B,
-    0xED, 0xD6, 0x78, 0xDA, 0x73, 0xF7, 0xE5, 0x09, 0x14, 0x3D, 0x02, 0xB9, 0xFE, 0x00, 0xE4, 0x18,
-    0x71, 0xE6, 0xEE, 0x5B, 0xAB, 0x12, 0x88, 0x65, 0x2C, 0x82, 0x3F, 0x47, 0x40, 0xC7, 0x08, 0xEC,
-    0xE3, 0x7A, 0x2A, 0x3B, 0xDF, 0xF4, 0x26, 0x38, 0x26, 0x2C, 0x68, 0x31, 0x37, 0xBB, 0x74, 0x2A,
-    0x67, 0x9F, 0x2E, 0x4B, 0x23, 0x33, 0xCA, 0xC7, 0xD7, 0x38, 0xD6, 0x62, 0x1A, 0x73, 0xA6, 0x3F,
-    0x88, 0x01, 0xFD, 0x98, 0xC2, 0x99, 0x82, 0xB0, 0xDD, 0x8E, 0x71, 0x96, 0x65, 0x63, 0x2B, 0xB9,
-    0x0F, 0xD4, 0x5F, 0xB3, 0x72, 0xE6, 0x8A, 0x48, 0x3B, 0xBA, 0x81, 0x43, 0x94, 0x85, 0x41, 0x9F,
-    0xDD, 0x22, 0xEA, 0x8C, 0x5D, 0x3B, 0xDB, 0x32, 0x74, 0x9D, 0x3B, 0xD3, 0xBB, 0x0B, 0xE8, 0x6E,
-    0x00, 0x6B, 0xFA, 0x77, 0x0F, 0x4C, 0x07, 0xEF, 0xE7, 0x87, 0x7A, 0x78, 0x36, 0x07, 0x12, 0x0B,
-    0x13, 0x87, 0xE3, 0xDC, 0xC5, 0x13, 0x76, 0xFD, 0x51, 0x47, 0xE8, 0xD6, 0x1B, 0xA3, 0xCE, 0x1B,
-    0x82, 0x9E, 0x01, 0x83, 0xF1, 0x22, 0xE8, 0x64, 0x6B, 0xEA, 0x6E, 0x28, 0xDC, 0xD4, 0xE5, 0x0F,
-    0x07, 0x43, 0x50, 0xE3, 0x0A, 0xDB, 0xC6, 0x8E, 0x88, 0x71, 0xD8, 0xA4, 0x5E, 0xB4, 0x1F, 0xB4,
-    0xE5, 0x00, 0x0C, 0x5E, 0xD2, 0x71, 0xBE, 0xED, 0x3D, 0x11, 0x7C, 0xD5, 0x9B, 0x9D, 0x08, 0xF5,
-    0x1D, 0x53, 0x7B, 0xC8, 0xF6, 0xE9, 0xF4, 0x42, 0xCD, 0xF4, 0x62, 0x85, 0xB8, 0x5E, 0x15, 0x96,
-    0x1D, 0x90, 0xA6, 0xF0, 0xA0, 0x94, 0x75, 0xDB, 0xBB, 0x49, 0x2A, 0x06, 0xFA, 0x33, 0xCF, 0x8D,
-    0x3E, 0x85, 0x0F, 0x0A, 0x13, 0xCB, 0x4F, 0xA4, 0x42, 0xB5, 0x3D, 0x06, 0x9D, 0x9A, 0xC2, 0x17,
-    0x52, 0x9B, 0xCA, 0x98, 0xC9, 0x78, 0x4C, 0x79, 0x63, 0x61, 0x86, 0x15, 0xD2, 0x71, 0xF0, 0x88,
-    0x6B, 0x18, 0xCD, 0xCF, 0xE6, 0x44, 0x69, 0x8C, 0x38, 0x94, 0x47, 0x50, 0x20, 0x41, 0x89, 0x96,
-    0x62, 0x33, 0x85, 0xA2, 0xC1, 0x39, 0xFB, 0xA6, 0x5C, 0x46, 0xB0, 0xA9, 0x24, 0x80, 0x4F, 0x1C,
-    0x2A, 0x09, 0xEA, 0x45, 0xD7, 0xC7, 0xEB, 0xE0, 0x73, 0x7B, 0xAE, 0xE3, 0x9B, 0x34, 0x67, 0xD3,
-    0xBB, 0xF5, 0xE4, 0xCA, 0xFE, 0x35, 0xD8, 0xEC, 0x6A, 0xF8, 0xC6, 0x98, 0x52, 0x00, 0x5F, 0x23,
-    0x8C, 0x0F, 0x17, 0xD3, 0x89, 0x4D, 0x85, 0xA6, 0x43, 0x9D, 0x5A, 0x79, 0x19, 0x9E, 0x65, 0x6F,
-    0x15, 0xE9, 0x59, 0x5E, 0x78, 0xC3, 0x9D, 0xE2, 0xB0, 0x43, 0x96, 0x2C, 0x7B, 0xD7, 0x5C, 0x0C,
-    0x10, 0xC8, 0x54, 0x0C, 0x30, 0x7F, 0xF6, 0xA6, 0x1C, 0x92, 0xF5, 0x65, 0x73, 0x14, 0xCC, 0xE9,
-    0xE8, 0x95, 0x3E, 0xE7, 0x57, 0x76, 0x43, 0x52, 0x6C, 0xCC, 0x7E, 0xC1, 0x8E, 0x5B, 0x69, 0x22,
-    0xD8, 0x89, 0x1D, 0xE4, 0x5D, 0xD7, 0x41, 0x5E, 0x35, 0x6E, 0x62, 0x28, 0xB0, 0x71, 0xDD, 0xDE,
-    0xA2, 0xA9, 0x77, 0x56, 0xDC, 0x2B, 0xC2, 0xE8, 0x35, 0xAE, 0xC0, 0xDF, 0xB7, 0x97, 0x74, 0x7B,
-    0x0E, 0x7C, 0x21, 0x0F, 0x68, 0x91, 0xDE, 0x2F, 0x03, 0x9B, 0x64, 0xE4, 0xC9, 0x09, 0x4C, 0xB1,
-    0xF0, 0x00, 0x2A, 0x80, 0x02, 0x26, 0x40, 0x82, 0xCE, 0xB8, 0x30, 0x89, 0x03, 0xCB, 0xD9, 0xC4,
-    0x19, 0xBC, 0xF2, 0x11, 0x7A, 0xFF, 0xC1, 0xC3, 0xD0, 0x74, 0x26, 0x3C, 0x2B, 0xD6, 0x6B, 0xD0,
-    0xC0, 0xA3, 0xD8, 0x55, 0x65, 0xA3, 0x40, 0xD5, 0x67, 0xD6, 0x2B, 0x22, 0x6C, 0x93, 0xE0, 0x52,
-    0xF0, 0xA8, 0x57, 0xB3, 0x7F, 0xA5, 0x27, 0x15, 0xEE, 0x27, 0xF6, 0x18, 0xFA, 0xC3, 0x95, 0x42,
-    0x50, 0xDA, 0xDF, 0xA0, 0x4C, 0xE6, 0x52, 0xD3, 0x71, 0xF2, 0x0D, 0x56, 0xDE, 0xD0, 0x4B, 0x34,
-    0x6E, 0x65, 0xBA, 0x2A, 0x74, 0x35, 0x17, 0x29, 0xCB, 0x75, 0x0A, 0xBC, 0xB6, 0xF8, 0x9C, 0xA7,
-    0x74, 0x49, 0x6F, 0x7A, 0x53, 0x15, 0x4F, 0xC1, 0x58, 0xCC, 0xD5, 0x53, 0x27, 0xC4, 0x9F, 0x04,
-    0xCF, 0x16, 0x82, 0x23, 0x88, 0x97, 0x05, 0x2E, 0x24, 0x80, 0x7C, 0x5D, 0xAF, 0x3F, 0x15, 0xE8,
-    0x49, 0x35, 0x5B, 0xBC, 0xE4, 0xDC, 0xCE, 0xAD, 0x01, 0x16, 0x37, 0x77, 0x2D, 0xE1, 0x12, 0xAF,
-    0x39, 0xDC, 0x66, 0xBB, 0x7A, 0x39, 0x10, 0x1C, 0xAD, 0xA6, 0xCC, 0x41, 0xFB, 0xE7, 0xF6, 0x84,
-    0x31, 0xE9, 0x9F, 0xAF, 0xD4, 0x0B, 0xC5, 0x35, 0x6C, 0xA8, 0xAD, 0xE9, 0x78, 0x7C, 0xF4, 0x2C,
-    0xA5, 0x8A, 0xEF, 0x98, 0x46, 0xFC, 0x1E, 0x76, 0xF1, 0x76, 0xAC, 0xDB, 0x44, 0xB7, 0xB6, 0x10,
-    0xFE, 0xD1, 0x93, 0x34, 0x83, 0x1D, 0x22, 0xAA, 0x5B, 0x5D, 0xE2, 0xE7, 0x20, 0x05, 0xED, 0x8C,
-    0xB4, 0x6B, 0xBC, 0x7D, 0x8F, 0x9B, 0x8F, 0x9A, 0x58, 0xD2, 0x4A, 0xBE, 0x1B, 0x3A, 0x33, 0x99,
-    0x5A, 0xE7, 0xE6, 0x90, 0x5D, 0xCF, 0x87, 0xEC, 0x48, 0xA1, 0x8D, 0xC7, 0xCC, 0x80, 0xCF, 0x63,
-    0x36, 0x9F, 0x91, 0xAB, 0x4D, 0x37, 0x6D, 0xB9, 0xF9, 0x9C, 0x31, 0x88, 0x22, 0x35, 0xD7, 0x64,
-    0xD3, 0xAC, 0xE7, 0x4D, 0xEC, 0x1D, 0x27, 0x52, 0xE6, 0xB8, 0xFD, 0xB1, 0x76, 0xF2, 0xA5, 0xED,
-    0x4B, 0x5B, 0xE0, 0xAF, 0x60, 0xAE, 0x28, 0x0B, 0xCA, 0x65, 0xF6, 0xCA, 0x34, 0x6D, 0x8F, 0xB1,
-    0x0B, 0x98, 0x7C, 0x11, 0x8C, 0xE6, 0x90, 0x4D, 0x0D, 0x3C, 0xC4, 0x76, 0x6A, 0xF4, 0x77, 0xB6,
-    0x29, 0x07, 0xBB, 0x4C, 0xFA, 0x25, 0x89, 0xC0, 0xE7, 0xA8, 0xD8, 0x78, 0x2E, 0xF4, 0xD9, 0xE1,
-    0xDB, 0x03, 0xEE, 0x1C, 0xDB, 0x10, 0x1D, 0xB4, 0xC2, 0x3C, 0x0E, 0x83, 0x70, 0x93, 0xBE, 0x1C,
-    0x41, 0x4C, 0xDF, 0x3A, 0x3C, 0xD6, 0xB7, 0x3E, 0x9B, 0x40, 0x3C, 0xF8, 0xF6, 0xD8, 0x41, 0xF7,
-    0x3F, 0xAA, 0xDC, 0x60, 0xFE, 0x34, 0x1F, 0xBC, 0x0C, 0xA9, 0x68, 0xC9, 0x31, 0xD0, 0xBC, 0xF9,
-    0xA6, 0xBD, 0xF8, 0x7F, 0x67, 0xDD, 0x67, 0xDF, 0x2A, 0x91, 0x5D, 0x87, 0x40, 0x03, 0x42, 0x41,
-    0xD0, 0x80, 0xAE, 0x84, 0xB7, 0xEA, 0x97, 0xB7, 0x55, 0x41, 0x87, 0xE9, 0x3E, 0xC6, 0xD7, 0xDF,
-    0xA9, 0xC4, 0xFB, 0xF2, 0xCC, 0x02, 0x9D, 0x23, 0x64, 0xD3, 0x96, 0xD8, 0x9D, 0x9E, 0x7F, 0x33,
-    0x67, 0xB6, 0xF6, 0x70, 0xBE, 0x98, 0x64, 0x39, 0x35, 0x70, 0x32, 0x11, 0xD2, 0xE1, 0xC4, 0x3D,
-    0xF7, 0x96, 0x34, 0x47, 0x9E, 0x7B, 0xB3, 0x0D, 0x2A, 0x5B, 0xE2, 0x22, 0xF5, 0x92, 0xAA, 0x06,
-    0xF5, 0xD4, 0x21, 0x45, 0x26, 0x8F, 0xCB, 0xA0, 0x2D, 0xCC, 0x11, 0x00, 0x56, 0x41, 0x4D, 0x5E,
-    0x88, 0x02, 0x08, 0x50, 0xBE, 0x60, 0xFD, 0xC2, 0x47, 0xC4, 0x4C, 0x8B, 0xE0, 0x00, 0x7F, 0x17,
-    0xD1, 0x67, 0x15, 0x8A, 0x19, 0xF9, 0xE1, 0x47, 0xD0, 0x53, 0xFC, 0x07, 0xE8, 0x3D, 0x53, 0xEF,
-    0x7C, 0x02, 0xA9, 0xB3, 0xE8, 0x5E, 0x2D, 0xB2, 0xBD, 0xE8, 0x1E, 0x12, 0x64, 0x1F, 0x3D, 0xC0,
-    0xD8, 0x32, 0x97, 0x67, 0x4D, 0xA8, 0x79, 0x66, 0x18, 0x0E, 0x8C, 0xFD, 0xE1, 0xC2, 0x68, 0x0A,
-    0xBA, 0x81, 0x09, 0x50, 0xFF, 0xE1, 0x73, 0x58, 0xE9, 0xAE, 0xAB, 0x81, 0xC5, 0x8E, 0xD8, 0xC9,
-    0x3C, 0xED, 0x0D, 0x59, 0xA0, 0xFD, 0x3E, 0x0B, 0x75, 0xD0, 0x66, 0xD1, 0x83, 0xA8, 0x51, 0xF2,
-    0x2F, 0xB2, 0x56, 0xC9, 0x46, 0x5C, 0x2A, 0x95, 0x40, 0x23, 0x37, 0x93, 0x4C, 0xA8, 0xDD, 0x64,
-    0x1F, 0x24, 0x02, 0xB9, 0x43, 0x35, 0x49, 0xC7, 0xC2, 0x07, 0xE5, 0x59, 0x95, 0x4C, 0x0F, 0xAB,
-    0xB4, 0x8E, 0x46, 0x6D, 0x8A, 0xD0, 0xD1, 0xA8, 0x02, 0xBB, 0x98, 0xA1, 0x1E, 0x84, 0x3E, 0x21,
-    0x17, 0x4A, 0x9F, 0xBF, 0x0F, 0x22, 0x86, 0x0C, 0xF2, 0x5E, 0x63, 0x9E, 0xF7, 0x61, 0xDA, 0x0F,
-    0x9F, 0x47, 0xD3, 0x67, 0xB5, 0x1A, 0x07, 0x0E, 0xC8, 0xB8, 0x59, 0x17, 0x8A, 0x35, 0xD7, 0x24,
-    0x63, 0xB3, 0x7F, 0x07, 0x76, 0x84, 0x7D, 0xF2, 0xC8, 0xBD, 0xBD, 0x9E, 0x89, 0x69, 0xE0, 0x1C,
-    0x03, 0xBF, 0x3C, 0x32, 0x0F, 0xEE, 0x33, 0x6D, 0xEE, 0x73, 0xE3, 0x37, 0x87, 0x69, 0x5B, 0x54,
-    0x3B, 0x1D, 0xEA, 0x9A, 0xF4, 0x6F, 0xFA, 0x7F, 0x85, 0x7D, 0xA2, 0xD0, 0x48, 0x62, 0x8F, 0x37,
-    0x4C, 0xDA, 0x14, 0xE2, 0x7D, 0xF8, 0x70, 0x8F, 0x4F, 0x7B, 0xB0, 0xB0, 0xAB, 0x97, 0xCF, 0x41,
-    0xBA, 0x93, 0x0A, 0x39, 0xF3, 0x2C, 0xC7, 0xE0, 0xB1, 0xA6, 0x5C, 0xBF, 0x8E, 0x6F, 0x52, 0xD5,
-    0x85, 0x7D, 0xC4, 0x84, 0x93, 0xB2, 0x11, 0x46, 0xCB, 0xE3, 0x53, 0x73, 0xEE, 0xAD, 0xC8, 0x3D,
-    0x64, 0x47, 0x5F, 0x00, 0xE7, 0xC8, 0xC1, 0x39, 0x9C, 0xD1, 0xA9, 0x72, 0x2E, 0xE6, 0x1C, 0x8F,
-    0x16, 0x3B, 0x3B, 0x39, 0xE6, 0x06, 0x6F, 0xD4, 0xF6, 0x78, 0x25, 0x70, 0xEC, 0x92, 0x24, 0x11,
-    0xC1, 0xD8, 0xF0, 0xF9, 0xDE, 0x62, 0xB5, 0x1C, 0x00, 0xD6, 0x37, 0x07, 0x03, 0x32, 0xFC, 0xE9,
-    0x71, 0xBB, 0xD7, 0x56, 0x8F, 0x97, 0x55, 0xDD, 0x44, 0x34, 0xBC, 0xED, 0x15, 0xE0, 0x8D, 0x2A,
-    0x84, 0xFE, 0xE0, 0xCB, 0xB9, 0x90, 0x9B, 0x8F, 0xAD, 0x88, 0x9A, 0xB0, 0x85, 0xC1, 0x6D, 0x81,
-    0x1B, 0xE4, 0x84, 0x6E, 0x23, 0x46, 0x30, 0xB7, 0x1D, 0x4D, 0x2D, 0x46, 0xFC, 0x62, 0x7E, 0x9F,
-    0x22, 0x18, 0x19, 0x6C, 0x00, 0xA2, 0x14, 0x62, 0xA1, 0xF6, 0x4D, 0x54, 0xCE, 0xC9, 0x06, 0x1F,
-    0xE9, 0xB3, 0xA7, 0x74, 0x67, 0xD7, 0x7B, 0x6B, 0x9E, 0x54, 0xA4, 0x2F, 0x07, 0xEE, 0x91, 0x87,
-    0x93, 0x4E, 0xB7, 0xE2, 0x89, 0x00, 0xE6, 0xC7, 0x49, 0xB2, 0x7B, 0xD2, 0x61, 0xE2, 0x73, 0x8C,
-    0x12, 0x9C, 0xDE, 0x3C, 0x2D, 0x88, 0xDB, 0xFE, 0x0F, 0xC5, 0x5A, 0x3F, 0x8C, 0xDE, 0xE4, 0x19,
-    0x7F, 0x6D, 0x2B, 0x67, 0x29, 0x1E, 0xCC, 0xD0, 0x0C, 0x25, 0x12, 0x5E, 0x3A, 0x54, 0x08, 0xEA,
-    0x85, 0x31, 0xC4, 0x06, 0x24, 0x3A, 0x74, 0x20, 0x43, 0xD3, 0x0E, 0x0C, 0x59, 0x98, 0x4E, 0x95,
-    0x6E, 0xCD, 0x00, 0x67, 0xA7, 0x4B, 0xD7, 0xAB, 0xAA, 0xB6, 0x43, 0x07, 0x6E, 0x08, 0x52, 0xB8,
-    0xA5, 0x4B, 0x87, 0x0E, 0x24, 0xAF, 0x69, 0x87, 0x0E, 0x0C, 0x18, 0x10, 0x62, 0xE8, 0x10, 0x97,
-    0x26, 0xAA, 0x44, 0x55, 0xE1, 0xC0, 0x17, 0x70, 0x88, 0xED, 0xB7, 0xBF, 0xDF, 0xF3, 0xD8, 0xFE,
-    0xBE, 0x3B, 0x22, 0x95, 0x92, 0xCB, 0xF1, 0x91, 0x7B, 0xBF, 0xC3, 0x9F, 0xEF, 0x7D, 0x9F, 0xFF,
-    0xCF, 0xEF, 0xF9, 0xF9, 0x33, 0xC6, 0x98, 0xAC, 0x32, 0xA1, 0xDB, 0x2B, 0x72, 0x53, 0xB8, 0xCE,
-    0x19, 0xCF, 0x39, 0x37, 0x98, 0x60, 0xF4, 0x5D, 0x6B, 0xE2, 0xCE, 0xB8, 0xD2, 0x24, 0xAD, 0xC1,
-    0x87, 0x69, 0xCD, 0x15, 0xF7, 0x72, 0x2D, 0xB9, 0xE2, 0x9F, 0x35, 0x5C, 0x9D, 0xAC, 0x23, 0x57,
-    0x7F, 0xC0, 0x5A, 0x86, 0x3D, 0x76, 0x6D, 0xD2, 0x95, 0x31, 0x89, 0x73, 0x8D, 0x31, 0x91, 0x73,
-    0xB9, 0xC1, 0xCE, 0x9D, 0xD9, 0x78, 0x3D, 0x5E, 0x62, 0x49, 0x2B, 0xB3, 0xD3, 0x64, 0x65, 0xE0,
-    0x06, 0x67, 0x62, 0xE7, 0x7A, 0x93, 0xB6, 0xAE, 0xC6, 0x29, 0xB2, 0x3D, 0x8E, 0xB1, 0x26, 0xE3,
-    0xFE, 0x72, 0x08, 0x0E, 0x73, 0x3C, 0xCB, 0xCA, 0x21, 0xB8, 0xD7, 0xA4, 0x90, 0x11, 0x9B, 0x97,
-    0x1B, 0xBB, 0xC6, 0xAD, 0xDF, 0x9B, 0xE2, 0xA5, 0x26, 0xE8, 0x8C, 0x4D, 0x2B, 0xAE, 0x2E, 0x0F,
-    0x57, 0x06, 0x2A, 0x45, 0xAD, 0x71, 0x7B, 0xF8, 0xDC, 0xC3, 0x5F, 0xC7, 0x0D, 0xEE, 0x32, 0x49,
-    0x1D, 0xE8, 0xDA, 0x51, 0x10, 0xAE, 0x59, 0x85, 0x7B, 0xA1, 0x1E, 0xEE, 0xC5, 0x99, 0x31, 0xD7,
-    0x32, 0x69, 0x78, 0xBD, 0xA8, 0xB0, 0x8A, 0x1A, 0x31, 0xF6, 0x32, 0xC6, 0xA7, 0x5E, 0xEB, 0x97,
-    0x77, 0x8D, 0xD7, 0xFA, 0xD3, 0xFB, 0xA7, 0x7F, 0xD3, 0xC5, 0x4D, 0xFC, 0x69, 0x9B, 0xD4, 0x89,
-    0xAB, 0x92, 0x2A, 0xBD, 0x87, 0x9D, 0x61, 0xB4, 0xAC, 0x82, 0x32, 0x59, 0x29, 0x6A, 0xD1, 0x68,
-    0xA2, 0x87, 0x07, 0x93, 0xD9, 0x80, 0x0B, 0xB7, 0x2C, 0x06, 0x0A, 0xB3, 0xEA, 0xCD, 0x83, 0x5E,
-    0x51, 0x7D, 0x43, 0x7F, 0x09, 0x3E, 0x9B, 0x8C, 0xE8, 0x2D, 0x02, 0x1C, 0xD2, 0xDF, 0x62, 0x3B,
-    0x3A, 0xD0, 0xD0, 0xF0, 0xD3, 0x2F, 0xBD, 0x47, 0xCB, 0x7A, 0xE3, 0xCB, 0x83, 0xB9, 0x78, 0x69,
-    0x65, 0xBC, 0xC1, 0x73, 0xF4, 0x0F, 0xE4, 0x15, 0x31, 0x2A, 0x03, 0x33, 0x58, 0xC3, 0x8B, 0xB4,
-    0x97, 0x09, 0xF0, 0x47, 0x34, 0x99, 0x89, 0x61, 0x0B, 0x5A, 0xCD, 0xA4, 0x0D, 0x0D, 0x4B, 0x3F,
-    0x54, 0x62, 0xE1, 0x81, 0x7F, 0x07, 0x23, 0x06, 0x3D, 0xEF, 0x85, 0x05, 0xE3, 0x2E, 0xA6, 0x58,
-    0xE9, 0x7B, 0xB6, 0x4D, 0x5B, 0x23, 0x96, 0xAA, 0x0A, 0x07, 0xC1, 0x32, 0x37, 0x42, 0x3B, 0x98,
-    0x2D, 0x83, 0xED, 0xF1, 0xCB, 0x11, 0xB5, 0xAE, 0x87, 0x8D, 0x48, 0x9C, 0xED, 0x94, 0x22, 0x70,
-    0x22, 0xD2, 0xF7, 0x26, 0xEA, 0x54, 0x5C, 0xEA, 0x49, 0x69, 0x0F, 0x0E, 0x4A, 0x0A, 0xEB, 0x63,
-    0x4B, 0xCA, 0x1A, 0x60, 0x47, 0x11, 0xD5, 0x77, 0x2A, 0x29, 0x2E, 0x8A, 0xA0, 0x10, 0x52, 0xE4,
-    0xCC, 0x6A, 0x15, 0xD3, 0x96, 0x22, 0x25, 0x0D, 0x4D, 0x21, 0x19, 0x97, 0x94, 0x91, 0x8E, 0xA5,
-    0x88, 0x19, 0x22, 0x92, 0x12, 0xEA, 0xFB, 0x1E, 0x82, 0x6A, 0xB5, 0x96, 0x2D, 0x58, 0xA5, 0xCF,
-    0x43, 0xA9, 0xB0, 0x8D, 0xDF, 0x61, 0x08, 0xB7, 0x21, 0xED, 0x1C, 0xB7, 0xF4, 0x17, 0x36, 0xE5,
-    0x1D, 0xBB, 0x71, 0xBD, 0x7D, 0xB0, 0x17, 0xB8, 0x9B, 0x95, 0x75, 0x0D, 0xA2, 0xB7, 0x72, 0xAE,
-    0x4E, 0x5A, 0x57, 0xE1, 0x58, 0x04, 0x4C, 0x09, 0xB9, 0x0B, 0x78, 0x5C, 0x8C, 0x5B, 0xD0, 0x98,
-    0x0C, 0x61, 0xA4, 0x91, 0x43, 0xAA, 0x40, 0x30, 0xA7, 0x7E, 0x70, 0xC1, 0xC0, 0x28, 0xB4, 0xAE,
-    0x8F, 0x29, 0xC9, 0xD8, 0x27, 0x70, 0x5A, 0xB2, 0xEA, 0x52, 0xB7, 0x8E, 0x04, 0x4B, 0xF1, 0x69,
-    0x73, 0xA4, 0x0B, 0xAD, 0x55, 0x31, 0x86, 0xB3, 0xD2, 0xEB, 0x19, 0x9F, 0x8C, 0x64, 0x39, 0x85,
-    0xAE, 0xEB, 0x98, 0x23, 0x8C, 0xE1, 0x91, 0x06, 0xC1, 0x6D, 0x50, 0x15, 0x37, 0x60, 0xC5, 0x0D,
-    0x90, 0x1A, 0x2B, 0x76, 0xC2, 0x6D, 0xD8, 0x09, 0xB7, 0x65, 0xAE, 0xC7, 0x6D, 0x58, 0x63, 0xAE,
-    0x9D, 0xAA, 0x85, 0x1B, 0xF0, 0xA2, 0xAB, 0x71, 0xAD, 0x94, 0x95, 0x17, 0x32, 0x09, 0x3C, 0xEF,
-    0x90, 0xFF, 0x12, 0x66, 0x28, 0x8B, 0x82, 0x93, 0x15, 0xB2, 0x3D, 0xCE, 0x43, 0x79, 0x1F, 0xE4,
-    0xD9, 0xE6, 0xD1, 0xEA, 0x1D, 0x7C, 0x84, 0x43, 0xF1, 0x11, 0x0E, 0xF5, 0xC5, 0x59, 0x6B, 0xA9,
-    0x5A, 0x7E, 0x84, 0xA3, 0xF1, 0x11, 0x8E, 0xC6, 0x47, 0x90, 0x2D, 0x56, 0xA9, 0x9A, 0x65, 0xED,
-    0x54, 0xAA, 0xB4, 0x32, 0x5A, 0xB1, 0x68, 0x15, 0xCA, 0x96, 0x88, 0x6C, 0x8C, 0x1B, 0x23, 0xF1,
-    0x3A, 0xD9, 0xEB, 0x2D, 0x98, 0x77, 0x34, 0xA3, 0x3F, 0xE0, 0xC8, 0xAB, 0x94, 0xC8, 0xEF, 0xFD,
-    0xAB, 0x41, 0x1F, 0xAE, 0x82, 0x0E, 0x9E, 0x5C, 0xC5, 0x6D, 0xD4, 0x22, 0x4D, 0xE5, 0x07, 0x81,
-    0xD1, 0xA4, 0x55, 0x52, 0x67, 0x15, 0x32, 0x95, 0x8E, 0x43, 0xDD, 0xB1, 0x92, 0xA6, 0x45, 0xCE,
-    0xCD, 0x47, 0x23, 0x2A, 0x89, 0x81, 0x61, 0x02, 0xDB, 0xEA, 0xC9, 0x16, 0xE6, 0x87, 0x92, 0xAE,
-    0xC2, 0xCE, 0x78, 0x43, 0x11, 0x41, 0x9C, 0xB9, 0x36, 0xC0, 0x09, 0x28, 0x9D, 0x21, 0x0E, 0xF1,
-    0xEF, 0xAF, 0x22, 0x9C, 0x13, 0x7C, 0xD1, 0x47, 0x38, 0x26, 0xB8, 0xD3, 0xF3, 0xB4, 0xB0, 0x1D,
-    0x62, 0x1C, 0x18, 0xB5, 0x2E, 0xA9, 0x78, 0x72, 0x91, 0xE2, 0xD8, 0xB8, 0x46, 0x02, 0x64, 0x55,
-    0x8C, 0x80, 0xC4, 0xE1, 0xF8, 0xC0, 0xE5, 0x45, 0x89, 0xCB, 0x4E, 0x8A, 0x60, 0xEC, 0xA4, 0x0C,
-    0x46, 0x23, 0x13, 0x90, 0xD9, 0x39, 0x6A, 0x01, 0x10, 0x3B, 0x9B, 0x50, 0xC2, 0x24, 0xD0, 0xDA,
-    0x1A, 0xB0, 0x20, 0xF2, 0x4D, 0x4B, 0xC2, 0x63, 0x87, 0xB3, 0xCD, 0xEB, 0x44, 0xEA, 0x40, 0xA5,
-    0x86, 0xD1, 0x29, 0xB5, 0xB7, 0x2F, 0x52, 0xB3, 0xA2, 0x41, 0xB8, 0xD3, 0xFB, 0x22, 0x75, 0x3C,
-    0x49, 0xDD, 0x88, 0xD4, 0x49, 0x2D, 0x52, 0xA7, 0x95, 0x48, 0x0D, 0x39, 0x29, 0x35, 0xE4, 0x12,
-    0xA9, 0x73, 0x91, 0xBA, 0xC8, 0x45, 0x6A, 0xC4, 0x37, 0xA5, 0x46, 0x02, 0x52, 0xEA, 0x51, 0xA4,
-    0x86, 0x9C, 0x94, 0xDA, 0xD7, 0x70, 0x9E, 0xDE, 0x02, 0x7D, 0x8B, 0x34, 0xA6, 0x54, 0x6A, 0xCF,
-    0xD5, 0x5A, 0xCF, 0xF2, 0xC3, 0x32, 0x2F, 0xB7, 0x4F, 0x7F, 0xB4, 0x3F, 0x7D, 0xB2, 0x7F, 0xC3,
-    0x6C, 0xED, 0x07, 0x9F, 0xBB, 0x0A, 0xD2, 0xDE, 0x77, 0xB4, 0xED, 0x98, 0xC0, 0xA3, 0x51, 0x2F,
-    0x3E, 0x6D, 0xE9, 0x55, 0xAC, 0x35, 0xE5, 0x85, 0x77, 0xCB, 0x04, 0x0A, 0x64, 0x39, 0xAB, 0x31,
-    0x8C, 0x5A, 0xD1, 0xC7, 0xF0, 0x36, 0x3C, 0x9C, 0xE5, 0x05, 0x24, 0x2D, 0x50, 0x8E, 0x87, 0xB5,
-    0x80, 0x7A, 0x54, 0x28, 0x87, 0x6B, 0x51, 0xD0, 0x72, 0xBB, 0x96, 0xED, 0xB5, 0x90, 0x45, 0x64,
-    0x87, 0x05, 0xD1, 0x2D, 0x9A, 0x48, 0x2C, 0xAE, 0xE6, 0x64, 0x29, 0xB8, 0x8C, 0x1D, 0x5D, 0x85,
-    0xED, 0x82, 0xBB, 0x3D, 0xAB, 0x49, 0xCF, 0xEA, 0xC1, 0x3A, 0x54, 0xB1, 0x49, 0x96, 0x38, 0xD3,
-    0xFE, 0x56, 0xAA, 0xF4, 0x08, 0x0F, 0x60, 0x41, 0x6D, 0x73, 0x4C, 0x02, 0xCB, 0x94, 0xA0, 0x3D,
-    0xE9, 0x7C, 0xF4, 0x5B, 0xDD, 0xBC, 0x8F, 0xD0, 0x1D, 0xD1, 0x12, 0xD3, 0x61, 0x1D, 0xEE, 0xBB,
-    0x2F, 0x4A, 0x0D, 0x62, 0x01, 0x4A, 0x56, 0x8E, 0xFA, 0x95, 0xAC, 0x3B, 0x36, 0x2F, 0xA4, 0xE2,
-    0xD0, 0x0F, 0x4C, 0x06, 0x14, 0x1A, 0x56, 0x19, 0x96, 0x18, 0x93, 0xDC, 0xDD, 0x68, 0xC5, 0xD7,
-    0x23, 0x24, 0x58, 0x5A, 0x4A, 0x12, 0xC5, 0xD3, 0x75, 0x37, 0x4E, 0x3F, 0x9D, 0xE6, 0x1C, 0x33,
-    0x0E, 0x52, 0xB0, 0x1B, 0xB3, 0x19, 0x33, 0xEB, 0xCD, 0x46, 0x72, 0xD0, 0x68, 0xFC, 0x91, 0x7E,
-    0x4A, 0x20, 0x00, 0x3B, 0x59, 0xB5, 0x55, 0xFA, 0x5C, 0x17, 0xFF, 0xBD, 0x41, 0xF1, 0xF4, 0xC7,
-    0xA9, 0x51, 0xE2, 0x26, 0xC4, 0x1E, 0xB2, 0x3D, 0x6A, 0xA7, 0x82, 0x0D, 0x4D, 0x91, 0xDE, 0x29,
-    0xDB, 0x24, 0x4F, 0xC9, 0x04, 0x5B, 0xE8, 0x2B, 0x6C, 0xA0, 0xB9, 0xFF, 0x05, 0xDD, 0x21, 0x51,
-    0x62, 0xAB, 0xF9, 0x03, 0xD4, 0x6B, 0x22, 0x16, 0x02, 0x16, 0xC5, 0x2B, 0x02, 0x57, 0x88, 0x56,
-    0x6C, 0x2E, 0x60, 0x45, 0xB0, 0x8A, 0x40, 0x15, 0x22, 0x15, 0xD8, 0x83, 0xE6, 0xC8, 0x59, 0x95,
-    0x09, 0x53, 0x8A, 0x0A, 0x99, 0x23, 0x20, 0x45, 0x30, 0x4A, 0xC4, 0x6E, 0x75, 0x04, 0xA1, 0xF4,
-    0x71, 0x65, 0x76, 0x71, 0x7C, 0x46, 0xAD, 0x5A, 0xBD, 0xB6, 0x83, 0x1A, 0x0A, 0x23, 0xC2, 0xD8,
-    0x84, 0x2A, 0x82, 0x54, 0xB4, 0x60, 0x30, 0x94, 0x58, 0x30, 0xAC, 0x80, 0x14, 0x62, 0x14, 0x42,
-    0x14, 0x22, 0x94, 0x23, 0x00, 0xA5, 0xBA, 0x0E, 0xE1, 0x3F, 0x97, 0x84, 0xAB, 0x37, 0x22, 0x8A,
-    0xB0, 0x45, 0x7B, 0x05, 0x13, 0x53, 0xDB, 0x1A, 0x0C, 0x34, 0x2A, 0x62, 0x11, 0xC0, 0x92, 0xA0,
-    0x95, 0xA1, 0x81, 0x48, 0xF5, 0x46, 0x68, 0x0A, 0x58, 0x11, 0xAC, 0x52, 0x94, 0x71, 0xAB, 0x48,
-    0x25, 0xAB, 0x51, 0xB7, 0x33, 0xEA, 0xC2, 0x6E, 0x82, 0x23, 0x56, 0x87, 0x14, 0xA2, 0xA7, 0xE7,
-    0xE8, 0x51, 0x55, 0x81, 0x58, 0xF6, 0x50, 0x97, 0x6A, 0xE0, 0x15, 0xC2, 0x15, 0xD6, 0x40, 0xFE,
-    0x57, 0x12, 0xAB, 0x48, 0x0D, 0xA4, 0x32, 0x88, 0x1E, 0xE2, 0x14, 0xC2, 0x94, 0x0C, 0xA1, 0xBC,
-    0x80, 0x14, 0xEF, 0xE0, 0x9A, 0x11, 0x73, 0xE0, 0xA0, 0xD9, 0x72, 0xC1, 0xC7, 0x44, 0x0D, 0xFF,
-    0xC4, 0x12, 0xBC, 0xDD, 0x9C, 0x8C, 0x6A, 0xA7, 0x2E, 0x42, 0x25, 0xC2, 0x46, 0xA7, 0xC1, 0x71,
-    0x3E, 0x41, 0x00, 0x41, 0xCD, 0x67, 0xD3, 0x87, 0x57, 0xD1, 0xAC, 0xCB, 0x15, 0x41, 0x21, 0x3B,
-    0x9E, 0x31, 0x67, 0x18, 0x7F, 0xEF, 0x13, 0x7B, 0x7E, 0x80, 0x25, 0xBC, 0xD2, 0x9C, 0x9C, 0x0B,
-    0x09, 0x6D, 0xA4, 0x18, 0xF4, 0xAC, 0x80, 0xC6, 0x3C, 0x9B, 0x20, 0x81, 0xD3, 0xDC, 0xBC, 0x7A,
-    0x0C, 0xBA, 0x7A, 0xE6, 0x14, 0xCE, 0x6B, 0x5E, 0x9B, 0x6B, 0x9E, 0x40, 0x80, 0x33, 0x88, 0xCF,
-    0xF0, 0xE3, 0x76, 0xF6, 0xE9, 0x49, 0xEA, 0x7A, 0x3E, 0x68, 0x4C, 0xFC, 0xC7, 0xD2, 0x84, 0x08,
-    0x57, 0xEF, 0xA7, 0xF4, 0xAB, 0x39, 0x5E, 0xBF, 0x6A, 0xAD, 0x97, 0xB2, 0x9F, 0x49, 0x20, 0xD1,
-    0xAF, 0xEF, 0x89, 0x5F, 0x57, 0x27, 0xEC, 0x57, 0x16, 0xD9, 0x18, 0xAE, 0x0D, 0x5A, 0xED, 0x70,
-    0xF4, 0xEB, 0x2E, 0xFD, 0x9A, 0x3C, 0xBC, 0xAE, 0x16, 0xD8, 0x0A, 0xD7, 0x42, 0xD4, 0xAC, 0x2D,
-    0xC1, 0x2E, 0x52, 0xCD, 0x2B, 0xCF, 0x3A, 0x36, 0x8D, 0x32, 0xBB, 0x6D, 0x73, 0xA9, 0x5E, 0xF8,
-    0xFB, 0xEC, 0x0F, 0x28, 0x8A, 0x52, 0xB3, 0xE6, 0x02, 0x7C, 0xFA, 0x60, 0x8F, 0x28, 0xAB, 0xE1,
-    0x32, 0xD7, 0xDE, 0x2C, 0xE6, 0x26, 0x68, 0x19, 0xE6, 0xE9, 0xF8, 0x91, 0xB7, 0x3D, 0x66, 0x37,
-    0x33, 0x7B, 0x9D, 0xDD, 0x1A, 0x05, 0xAF, 0xA5, 0x53, 0xFB, 0xDB, 0x7A, 0x88, 0xF6, 0xF7, 0xF8,
-    0x01, 0x35, 0x71, 0x95, 0x59, 0xB6, 0x87, 0x67, 0xE8, 0x02, 0xF1, 0x83, 0x5F, 0x3F, 0x72, 0xED,
-    0xCE, 0x1C, 0xD1, 0xCE, 0x6F, 0xF4, 0xEC, 0xA0, 0x3E, 0x06, 0xED, 0xCC, 0x16, 0x9D, 0x47, 0x84,
-    0xD2, 0xE8, 0x5B, 0xBD, 0x01, 0xAC, 0x20, 0x52, 0x65, 0x44, 0xB2, 0x4A, 0x26, 0x74, 0x76, 0xA9,
-    0xE4, 0xDF, 0x77, 0x2F, 0x52, 0xD1, 0x77, 0xA4, 0xDB, 0xD9, 0x97, 0xF8, 0xE6, 0x8D, 0x32, 0x16,
-    0x04, 0x18, 0x4C, 0xA0, 0x5C, 0xB4, 0x92, 0xC1, 0x24, 0x6E, 0xE5, 0x2D, 0xBB, 0x5D, 0x7C, 0x78,
-    0x81, 0x6D, 0x58, 0x5A, 0x9C, 0x93, 0xF9, 0xD8, 0x77, 0x32, 0xE6, 0x85, 0x9D, 0x0E, 0x89, 0x18,
-    0xC7, 0x10, 0x4F, 0x1C, 0x7B, 0xF0, 0x86, 0xA0, 0x13, 0x42, 0xC0, 0x6C, 0xBF, 0x39, 0xA3, 0x0C,
-    0x63, 0xDC, 0xB0, 0x08, 0x55, 0xBC, 0xF8, 0xF2, 0x2D, 0x88, 0x74, 0x13, 0x97, 0xA0, 0xB1, 0x63,
-    0x37, 0x77, 0x00, 0x00, 0xD4, 0xDA, 0x72, 0x98, 0x7A, 0x8E, 0x3A, 0xB3, 0xAF, 0xE2, 0x9D, 0xF3,
-    0xAD, 0x71, 0x6F, 0x18, 0xD1, 0x9F, 0x73, 0x94, 0x03, 0xDE, 0xC5, 0x88, 0xF9, 0x09, 0x8E, 0x19,
-    0x79, 0x58, 0x72, 0xF7, 0xCB, 0x4D, 0x85, 0x61, 0x0D, 0x19, 0xF3, 0x1C, 0xC7, 0xE2, 0xC0, 0xE5,
-    0xBF, 0x88, 0xA6, 0xB6, 0x0E, 0xD9, 0x70, 0xC2, 0xF6, 0xB5, 0xA2, 0x74, 0x3D, 0x3A, 0x78, 0x6F,
-    0xF3, 0x9F, 0x77, 0x36, 0x7F, 0xF9, 0x5E, 0xF1, 0xBC, 0x1B, 0x8B, 0xBF, 0xB8, 0x21, 0x03, 0x4C,
-    0x4F, 0x46, 0x5B, 0xC3, 0x46, 0xB5, 0xE7, 0x46, 0x4D, 0x8C, 0xF4, 0xBD, 0x7D, 0xE3, 0xBE, 0x6C,
-    0x61, 0xBE, 0x36, 0xEA, 0x33, 0x00, 0xE6, 0x04, 0x20, 0x93, 0x10, 0x93, 0x00, 0x39, 0xD5, 0xDC,
-    0xAC, 0x00, 0x44, 0xEE, 0xBB, 0x3C, 0xA1, 0xEF, 0x07, 0x20, 0xA6, 0x0B, 0x90, 0x73, 0xDB, 0x71,
-    0xD2, 0xAD, 0x72, 0x0C, 0xB7, 0x37, 0x30, 0x4A, 0x58, 0x48, 0x98, 0x8E, 0x66, 0x01, 0x3B, 0x28,
-    0x43, 0xFE, 0xBD, 0x05, 0xEC, 0x14, 0xD5, 0x86, 0xE4, 0x22, 0xBA, 0x8C, 0xF4, 0x14, 0xDE, 0x50,
-    0x7A, 0x45, 0x25, 0x94, 0x5F, 0x47, 0x22, 0x6A, 0x40, 0x10, 0x82, 0x52, 0x95, 0xE3, 0x2F, 0x2C,
-    0x99, 0x8F, 0x22, 0x67, 0x15, 0xAA, 0x38, 0x50, 0x35, 0xC4, 0x59, 0x50, 0x82, 0xDE, 0xAE, 0xCD,
-    0xA2, 0xCA, 0x94, 0xD3, 0x3E, 0x90, 0xD0, 0xEB, 0x98, 0x9B, 0xE1, 0xC3, 0x70, 0xF2, 0x48, 0x7A,
-    0xE5, 0xEA, 0xAC, 0x64, 0x38, 0x4C, 0x4A, 0x42, 0xCD, 0xB4, 0xDE, 0x54, 0xB2, 0x28, 0xB3, 0xB7,
-    0x5D, 0x9E, 0x3A, 0x21, 0x70, 0x30, 0x8E, 0x8C, 0x5A, 0x52, 0x51, 0x14, 0x2F, 0x00, 0x61, 0x59,
-    0x77, 0x54, 0xC9, 0xA0, 0x85, 0x92, 0xDE, 0x03, 0x94, 0xB4, 0x3A, 0x48, 0xE2, 0xFC, 0x11, 0x58,
-    0xD1, 0x1B, 0xA0, 0xA1, 0xD7, 0x27, 0x9C, 0x14, 0x33, 0x52, 0x14, 0xB8, 0x1E, 0xDC, 0x27, 0x35,
-    0x41, 0x5B, 0x44, 0x5C, 0x62, 0x89, 0xC4, 0xCF, 0x84, 0xCF, 0x71, 0x9C, 0x5B, 0x65, 0x42, 0x2E,
-    0x4A, 0xB2, 0x2D, 0x04, 0x92, 0x30, 0x4C, 0x96, 0x27, 0xCD, 0x82, 0x23, 0x05, 0x46, 0xF2, 0xCC,
-    0x19, 0x44, 0x1E, 0x41, 0xB1, 0x9E, 0xA0, 0x58, 0xFF, 0x5A, 0xD0, 0xC7, 0x98, 0xE2, 0xB2, 0x3A,
-    0x5C, 0xD9, 0x3C, 0xC2, 0xF6, 0xF1, 0xFD, 0x95, 0xA4, 0x50, 0xCC, 0xA0, 0x42, 0xD9, 0x4E, 0x3F,
-    0x42, 0x1C, 0xFD, 0x15, 0xC9, 0x76, 0x65, 0x54, 0xD8, 0x07, 0xC3, 0x3F, 0x6A, 0x50, 0x9A, 0xD0,
-    0x57, 0xEC, 0xCC, 0xA6, 0x5B, 0x7A, 0x96, 0x24, 0xDD, 0x82, 0x94, 0xBF, 0x2D, 0x34, 0xF5, 0xD8,
-    0xEA, 0xD8, 0x7D, 0x98, 0xFF, 0x7B, 0x3A, 0x56, 0x84, 0x73, 0x6F, 0xF2, 0x0E, 0xAE, 0x4E, 0xC3,
-    0x65, 0xB0, 0xF4, 0xAB, 0xEF, 0x54, 0xC9, 0xED, 0x03, 0x72, 0x25, 0x73, 0xE9, 0x78, 0x34, 0x4A,
-    0x2B, 0x4C, 0x47, 0xC3, 0xFC, 0x57, 0x8B, 0xCD, 0x99, 0x29, 0x7A, 0x3C, 0x37, 0x60, 0x91, 0x75,
-    0x10, 0xF6, 0x62, 0x81, 0xB8, 0x82, 0x62, 0xFE, 0x34, 0x88, 0x11, 0x96, 0x65, 0xC2, 0x4B, 0x96,
-    0x1A, 0xD2, 0xCC, 0x4A, 0x72, 0x16, 0x69, 0xF5, 0x03, 0xC4, 0x5B, 0xF6, 0x29, 0x26, 0x7B, 0x58,
-    0x2B, 0xDD, 0xA4, 0x0D, 0x63, 0x74, 0x0B, 0x3D, 0xA3, 0x12, 0xF6, 0x4D, 0xF5, 0xBB, 0xB6, 0x9C,
-    0x21, 0xBC, 0x1B, 0x42, 0x8B, 0xF5, 0x8D, 0xA3, 0x28, 0xB7, 0xCB, 0x6E, 0xE1, 0x12, 0xFE, 0xFF,
-    0xC9, 0xF9, 0x1C, 0x26, 0xFE, 0x3C, 0xA1, 0x15, 0xE5, 0x33, 0x3E, 0xCF, 0x51, 0x46, 0xEB, 0xEC,
-    0xE6, 0xDC, 0x81, 0x31, 0xCC, 0x60, 0x0E, 0x33, 0x64, 0xB1, 0xFC, 0x71, 0x4D, 0x5A, 0x12, 0xD9,
-    0x92, 0x35, 0xA2, 0xF2, 0x9C, 0x68, 0x09, 0x72, 0x49, 0x8F, 0xB1, 0xE6, 0xAB, 0xF8, 0x33, 0x5C,
-    0xD0, 0x01, 0x70, 0x63, 0xF8, 0xE3, 0x36, 0x1C, 0x8D, 0xD8, 0x16, 0xA9, 0xFE, 0xC2, 0x3D, 0xCE,
-    0xD4, 0xE3, 0xC4, 0x3C, 0xCE, 0xC4, 0xE3, 0xCC, 0x3B, 0xCE, 0xB4, 0xE3, 0xCC, 0x3A, 0xCE, 0xA4,
-    0xE3, 0xCC, 0x39, 0xCE, 0x94, 0xE3, 0xCC, 0x38, 0xCE, 0x84, 0xE3, 0xCC, 0x37, 0xCE, 0x74, 0xE3,
-    0xCC, 0x36, 0xCE, 0x64, 0xE3, 0xCC, 0x35, 0x2E, 0x54, 0xA3, 0x9D, 0xF4, 0x74, 0x93, 0xD1, 0x9D,
-    0x52, 0x6A, 0xDF, 0x1D, 0xB3, 0x18, 0x68, 0x84, 0x85, 0x3A, 0x4B, 0x46, 0xED, 0xC4, 0x58, 0xEB,
-    0xDB, 0xC9, 0x52, 0x8A, 0xCB, 0x58, 0x43, 0x29, 0x12, 0x38, 0xF7, 0xFC, 0x37, 0xE8, 0x91, 0xDA,
-    0x61, 0xB4, 0x47, 0xBA, 0x8E, 0xED, 0x85, 0xDD, 0x85, 0xCD, 0x85, 0xBD, 0x85, 0xAD, 0xE5, 0x50,
-    0x8F, 0xD4, 0xC0, 0xAB, 0x35, 0x68, 0x86, 0x09, 0x58, 0x3D, 0x82, 0xB6, 0x62, 0x45, 0x01, 0x06,
-    0x4D, 0x25, 0xC5, 0x9C, 0x82, 0xA2, 0x9E, 0x33, 0x5C, 0x3D, 0xF6, 0xC3, 0x27, 0x73, 0x22, 0xF8,
-    0x19, 0xC3, 0x5B, 0x45, 0x63, 0x8E, 0x78, 0x78, 0x24, 0x4F, 0x0A, 0x55, 0x09, 0xE3, 0xEF, 0xFE,
-    0xAC, 0x17, 0x34, 0x1F, 0x90, 0xCF, 0x93, 0x58, 0xEB, 0xE5, 0xD9, 0x40, 0x48, 0x4C, 0x1F, 0x08,
-    0x43, 0x5A, 0x05, 0x0C, 0xA5, 0x0C, 0x6E, 0x20, 0x62, 0xCB, 0x25, 0x11, 0x0F, 0xBD, 0xD2, 0x1F,
-    0x93, 0x98, 0xDD, 0x11, 0xBE, 0x1B, 0xB7, 0x14, 0x0D, 0xC2, 0xB7, 0xA8, 0x60, 0x02, 0xAB, 0x04,
-    0xAE, 0xF0, 0xB7, 0x42, 0xDF, 0x66, 0x0C, 0x3B, 0x9B, 0x93, 0x33, 0x44, 0x02, 0x84, 0xA4, 0x44,
-    0x80, 0x31, 0xD1, 0x71, 0x6A, 0x7D, 0x5A, 0x12, 0x6B, 0x83, 0xAB, 0xA7, 0x41, 0x5D, 0xD8, 0x4F,
-    0x51, 0x4F, 0x1A, 0x7D, 0xB6, 0x14, 0x45, 0xBB, 0xD9, 0xC2, 0xF9, 0x11, 0x87, 0x08, 0x74, 0x3B,
-    0xC6, 0x77, 0x3B, 0x37, 0xD6, 0x72, 0x22, 0x2A, 0x95, 0xF0, 0x23, 0xDD, 0x27, 0x64, 0x9F, 0x50,
-    0x7D, 0x42, 0xF4, 0x09, 0xCD, 0x27, 0x24, 0x9F, 0x50, 0x7C, 0x42, 0xF0, 0x09, 0xBD, 0x27, 0xE4,
-    0x9E, 0x50, 0x7B, 0x42, 0xEC, 0x09, 0xAD, 0x27, 0x54, 0xA4, 0x10, 0x91, 0x4B, 0x18, 0xB3, 0x82,
-    0x70, 0x22, 0xD5, 0xE2, 0x2D, 0xD4, 0x1C, 0x89, 0x39, 0xD2, 0x72, 0x24, 0xE5, 0x48, 0xC9, 0x29,
-    0xD9, 0x4A, 0xEE, 0x53, 0x71, 0xD2, 0x7A, 0x82, 0xC9, 0x72, 0x52, 0x70, 0x85, 0xAA, 0x22, 0xED,
-    0xDA, 0xF2, 0x69, 0xD1, 0x55, 0x46, 0x23, 0xE1, 0x6B, 0xC2, 0xCD, 0xCF, 0x9D, 0xE3, 0xF2, 0x14,
-    0xAD, 0xF0, 0x16, 0x55, 0x65, 0x26, 0xD9, 0xD5, 0x04, 0xC5, 0xFD, 0x7B, 0xAC, 0x60, 0x84, 0xE2,
-    0xF1, 0x1D, 0x79, 0xA2, 0x23, 0x28, 0x5C, 0x78, 0xF1, 0x41, 0x4B, 0xD2, 0x8C, 0xC2, 0xC7, 0x29,
-    0x9B, 0x8F, 0x52, 0x6B, 0xA9, 0x56, 0x73, 0x1E, 0xEA, 0xE5, 0x0A, 0xF7, 0x9F, 0x7D, 0x55, 0x4F,
-    0x3D, 0xFF, 0xAA, 0x56, 0x78, 0x5E, 0x7F, 0x58, 0xAA, 0xCD, 0x6C, 0x10, 0x9C, 0xFE, 0xB0, 0x59,
-    0x0C, 0xE2, 0x4D, 0x8E, 0xE8, 0xBB, 0xC5, 0xE6, 0xB3, 0x94, 0x6B, 0x1E, 0x54, 0x2B, 0xD5, 0x86,
-    0x88, 0x8F, 0x16, 0xA7, 0x1B, 0x8D, 0xAD, 0x88, 0xEE, 0x95, 0xCC, 0xD6, 0xDA, 0x74, 0x8A, 0xD0,
-    0xE3, 0x75, 0x3E, 0xA6, 0x94, 0xA7, 0x94, 0xE3, 0x04, 0x3D, 0x56, 0x21, 0x22, 0x14, 0xB5, 0x92,
-    0xD4, 0x2E, 0xA1, 0xC7, 0x75, 0xC4, 0xD3, 0x95, 0x0E, 0x30, 0xE0, 0x05, 0x48, 0x54, 0xC4, 0x15,
-    0x04, 0xC9, 0x48, 0xF0, 0x0E, 0x84, 0x00, 0xCC, 0xB4, 0xAC, 0x85, 0x7B, 0x53, 0xC9, 0x64, 0x1A,
-    0xE5, 0x06, 0x33, 0xED, 0x87, 0x47, 0x5C, 0x24, 0x0F, 0xFD, 0x4A, 0x45, 0x86, 0x13, 0x2C, 0x38,
-    0xFB, 0x15, 0xD0, 0x29, 0x12, 0x08, 0x3E, 0x89, 0x3A, 0x92, 0xCA, 0xA8, 0xCC, 0xEF, 0xBB, 0x26,
-    0xFD, 0xDB, 0xCD, 0x3A, 0xBB, 0x79, 0xA9, 0xCE, 0x46, 0x9C, 0x0F, 0xA4, 0x9A, 0xB6, 0x36, 0x4F,
-    0xEE, 0xC3, 0x22, 0xF4, 0x3F, 0xCE, 0x78, 0xEA, 0xD0, 0xBE, 0xB1, 0x90, 0x28, 0x77, 0x38, 0x3E,
-    0xAE, 0x18, 0xC7, 0x97, 0x9F, 0x3E, 0x09, 0xDA, 0x38, 0xFE, 0xA8, 0x35, 0x21, 0x4E, 0xF6, 0x5B,
-    0xEC, 0xFA, 0xA7, 0x73, 0xC7, 0x43, 0x1B, 0xC3, 0x41, 0xE3, 0xFC, 0x88, 0x68, 0xF7, 0x12, 0xDC,
-    0xF4, 0xE7, 0xA0, 0x3A, 0x09, 0x0A, 0x3C, 0x66, 0x89, 0x85, 0xDF, 0xAE, 0x5F, 0x2A, 0x4D, 0x1B,
-    0x96, 0xC7, 0xA1, 0x8B, 0xC7, 0xEE, 0x32, 0x64, 0xCA, 0x1C, 0xC6, 0xD3, 0x9E, 0x16, 0x2D, 0x9B,
-    0xE1, 0x89, 0x1F, 0x6F, 0xBC, 0x98, 0xCF, 0x34, 0xB7, 0x00, 0x26, 0xC4, 0x0D, 0xD9, 0x94, 0x88,
-    0xDD, 0x09, 0x59, 0x79, 0x08, 0x30, 0xB1, 0x53, 0x8A, 0xEF, 0xF5, 0x47, 0xEC, 0xF1, 0x2E, 0xD0,
-    0xCC, 0x07, 0x00, 0x7A, 0xFF, 0x80, 0x61, 0xDA, 0xCB, 0x53, 0xAF, 0xB8, 0x05, 0x6D, 0x07, 0xD9,
-    0x23, 0x69, 0x18, 0xB8, 0x88, 0x56, 0xE6, 0xCD, 0x0C, 0xA0, 0xDE, 0xD0, 0x14, 0xB4, 0xC8, 0x96,
-    0xE2, 0x13, 0x3E, 0xAA, 0x03, 0x32, 0xDA, 0xCC, 0x4F, 0x0F, 0xB5, 0x21, 0xE2, 0x43, 0xFA, 0xDF,
-    0xAD, 0xCC, 0x13, 0x66, 0x75, 0xDC, 0x32, 0x9B, 0xB4, 0x53, 0xA4, 0x7D, 0x6F, 0xC7, 0x78, 0x4D,
-    0x7C, 0x1C, 0x32, 0x23, 0x0C, 0xC3, 0x8F, 0x57, 0x3E, 0xFC, 0xAF, 0x31, 0x08, 0x57, 0xF3, 0x5F,
-    0x77, 0x94, 0xF9, 0x97, 0x07, 0xFD, 0x86, 0x23, 0x20, 0xA5, 0xC7, 0x3F, 0x76, 0xE2, 0x91, 0x0F,
-    0x15, 0xF4, 0x99, 0xC2, 0x88, 0x0C, 0x4F, 0xCA, 0xE4, 0x27, 0x55, 0xF8, 0x4B, 0xA9, 0x1B, 0xDB,
-    0x87, 0xEE, 0x0F, 0xFA, 0xAF, 0x3D, 0x61, 0x68, 0xD8, 0x15, 0x93, 0x7A, 0x1D, 0xB5, 0x1A, 0x3F,
-    0x95, 0x59, 0x4D, 0xBE, 0x3E, 0xBE, 0xC7, 0x1D, 0xBE, 0x43, 0x8B, 0x6C, 0x92, 0xDF, 0xB7, 0x3F,
-    0x32, 0xED, 0xB7, 0x78, 0xDC, 0x61, 0xE5, 0xD4, 0x98, 0x93, 0xC9, 0xAF, 0xEA, 0x0D, 0x0A, 0xFD,
-    0x04, 0x1E, 0x77, 0x24, 0x68, 0x2C, 0xE4, 0xB3, 0x83, 0x76, 0x23, 0x48, 0x1F, 0xFA, 0x71, 0x87,
-    0x3C, 0x2F, 0xF5, 0x19, 0x53, 0xC1, 0x6D, 0x14, 0xBC, 0xB0, 0x3C, 0x77, 0x72, 0xCF, 0x6F, 0x12,
-    0x99, 0xC7, 0x90, 0xD9, 0x3B, 0xB9, 0x69, 0xA3, 0xFC, 0x58, 0x14, 0x1A, 0x33, 0x65, 0x3E, 0x11,
-    0x7D, 0x66, 0x0A, 0x3F, 0x63, 0xBF, 0x62, 0xF1, 0x62, 0x17, 0x5D, 0x79, 0x63, 0xD4, 0x79, 0x03,
-    0x21, 0x24, 0xF1, 0x63, 0xD0, 0x05, 0x1D, 0xFB, 0x93, 0x6B, 0x28, 0x1E, 0xBF, 0x38, 0x12, 0xDF,
-    0x19, 0x84, 0xAC, 0x48, 0x6A, 0x28, 0x49, 0x8C, 0x2B, 0x18, 0x28, 0x6D, 0xB2, 0x52, 0xC6, 0x80,
-    0xF4, 0xDD, 0x06, 0x75, 0x82, 0x65, 0x42, 0x1C, 0xE0, 0xED, 0x5F, 0x0F, 0xBE, 0xEC, 0x21, 0x6F,
-    0xE8, 0xAE, 0x01, 0x89, 0x03, 0x85, 0xFC, 0x8F, 0xE8, 0x69, 0x64, 0x4C, 0x8F, 0x6E, 0x63, 0x68,
-    0xC9, 0x2F, 0x1F, 0xB3, 0x6C, 0x90, 0xAE, 0xFF, 0x5A, 0x45, 0x80, 0x84, 0x06, 0x22, 0x8A, 0x4D,
-    0x21, 0xA4, 0xB0, 0x52, 0x04, 0x4B, 0x0F, 0x1C, 0x21, 0x37, 0x12, 0x4A, 0x5F, 0x03, 0x4B, 0xFA,
-    0x2E, 0xAF, 0xA5, 0x04, 0x17, 0xD1, 0x0B, 0xD5, 0x89, 0x11, 0xEE, 0xD2, 0x12, 0x3F, 0x63, 0x4B,
-    0xEC, 0x97, 0x96, 0x78, 0x0C, 0x0F, 0x8A, 0x08, 0x64, 0x84, 0x29, 0x89, 0x3E, 0x24, 0x7E, 0x37,
-    0x97, 0x4F, 0xEE, 0x09, 0xC2, 0x66, 0x5F, 0x9C, 0xEA, 0xDA, 0x43, 0x2B, 0x94, 0x60, 0x92, 0x43,
-    0xF4, 0xA0, 0x2B, 0x57, 0xC1, 0xB0, 0x95, 0x87, 0x33, 0x51, 0x20, 0xFD, 0x24, 0xD7, 0xEF, 0x20,
-    0x15, 0x74, 0x77, 0xAF, 0x98, 0xCD, 0xD3, 0x02, 0xF9, 0xCA, 0xD4, 0x67, 0x39, 0xA5, 0xA5, 0x53,
-    0xF6, 0xF0, 0x01, 0x4E, 0x30, 0x91, 0x0C, 0xAC, 0x6F, 0xA7, 0x35, 0x60, 0x43, 0x0E, 0xA9, 0x18,
-    0x3E, 0xBE, 0x07, 0xFD, 0xB0, 0x0B, 0x72, 0x8D, 0xDF, 0xAC, 0xCA, 0x58, 0x27, 0x31, 0x5A, 0xDE,
-    0xB0, 0xAD, 0xC5, 0x70, 0xAF, 0x4F, 0x8E, 0x2F, 0x48, 0x05, 0xAD, 0xC8, 0x12, 0x7D, 0x5F, 0xBE,
-    0x59, 0x06, 0x9C, 0xEB, 0x5A, 0xD8, 0xA3, 0x39, 0x53, 0x7C, 0x98, 0x3F, 0x88, 0xA1, 0x38, 0x5A,
-    0xB3, 0x83, 0xE9, 0x67, 0xD6, 0x63, 0x9A, 0xC0, 0xCD, 0xA9, 0x0B, 0x53, 0xB4, 0x92, 0x4B, 0x31,
-    0x13, 0x1A, 0x7C, 0x85, 0x2C, 0x94, 0x8F, 0x6C, 0x1A, 0xF7, 0x0A, 0x57, 0x63, 0xD8, 0x5C, 0x12,
-    0x6F, 0xC9, 0x3D, 0xA9, 0x4B, 0xC6, 0xFE, 0x07, 0xE0, 0x52, 0x92, 0x03, 0x3B, 0xE5, 0xF2, 0xA9,
-    0x0C, 0x42, 0xAF, 0x2C, 0x9D, 0xDA, 0x0E, 0x22, 0x2F, 0xBF, 0x0E, 0x85, 0x00, 0x79, 0x22, 0xE7,
-    0xB4, 0xA1, 0x03, 0xBF, 0x34, 0x25, 0xD2, 0x91, 0x67, 0xDD, 0xC2, 0x6C, 0x12, 0xC9, 0xFF, 0xDA,
-    0xCD, 0xFC, 0xE4, 0xC6, 0x98, 0xE7, 0x66, 0x64, 0x9C, 0xF4, 0xD3, 0x97, 0x26, 0x76, 0xF8, 0xF5,
-    0x3C, 0x69, 0x5A, 0xEC, 0x3E, 0xD9, 0xDE, 0xF2, 0x9D, 0x8F, 0xD3, 0xF2, 0xAD, 0x32, 0x54, 0x51,
-    0xDC, 0xF5, 0x4C, 0xB4, 0x5A, 0xAB, 0x8B, 0xCA, 0xBA, 0x25, 0xE3, 0x29, 0x6E, 0xB7, 0xA5, 0x79,
-    0x8C, 0xC9, 0x99, 0x6C, 0x50, 0x48, 0xF8, 0x0C, 0x0D, 0x72, 0xCB, 0xAD, 0x04, 0xD8, 0x15, 0xB7,
-    0x8C, 0x79, 0x73, 0x8D, 0xCA, 0x5B, 0x3E, 0xF2, 0xE9, 0x87, 0x79, 0xF4, 0xCA, 0x9A, 0x85, 0xB9,
-    0x8D, 0x39, 0xDD, 0x42, 0x99, 0x11, 0x1B, 0x79, 0x9B, 0x23, 0xAE, 0x84, 0x3D, 0x16, 0x42, 0xBA,
-    0xD0, 0x29, 0xFE, 0x18, 0x39, 0x6C, 0x0F, 0xFA, 0x55, 0x3D, 0x0E, 0xDA, 0xFA, 0x45, 0x3C, 0xF9,
-    0x06, 0xDE, 0x3A, 0xEC, 0x97, 0xAA, 0x13, 0xD6, 0x98, 0x35, 0xBF, 0x11, 0x73, 0xBB, 0x6B, 0x30,
-    0x70, 0xCA, 0x8C, 0xFE, 0xFF, 0x0C, 0x9D, 0xFF, 0x05, 0x85, 0x54, 0x41, 0x8B, 0x1C, 0x45, 0x14,
-    0xFE, 0xBA, 0x7B, 0x3B, 0x6D, 0x32, 0xB8, 0xBD, 0xC2, 0x2C, 0x26, 0x59, 0xB3, 0x9D, 0x43, 0x0E,
-    0x21, 0x6E, 0xB6, 0x3D, 0xCC, 0x61, 0x82, 0xD3, 0x5D, 0xE5, 0xD9, 0xCB, 0x08, 0x3B, 0x0A, 0x7A,
-    0x88, 0x07, 0x0F, 0x12, 0x90, 0x1D, 0x74, 0x84, 0x45, 0x67, 0xB7, 0xEB, 0x27, 0xCC, 0x4D, 0xF0,
-    0x92, 0x3D, 0x44, 0x91, 0x09, 0x92, 0x46, 0xF7, 0xB0, 0xC6, 0xCD, 0x4E, 0x41, 0x8E, 0x1E, 0xAC,
-    0x98, 0xBB, 0x14, 0x82, 0x07, 0x4F, 0xA9, 0x48, 0x8B, 0x93, 0x30, 0x33, 0xE5, 0xAB, 0x19, 0x56,
-    0x0C, 0x04, 0x2C, 0x7A, 0x6A, 0xBA, 0x5F, 0xBD, 0x7A, 0xF5, 0xDE, 0xFB, 0xBE, 0xAF, 0x00, 0x26,
-    0x12, 0x59, 0x53, 0xBE, 0x06, 0x6A, 0xE3, 0x58, 0x33, 0x7E, 0x0F, 0x6E, 0x58, 0x19, 0x58, 0x15,
-    0x3F, 0x34, 0x39, 0xAA, 0x58, 0x18, 0x66, 0xCD, 0xB1, 0x55, 0x26, 0xE5, 0xE7, 0x87, 0x82, 0x59,
-    0x7A, 0x38, 0xB9, 0x14, 0x76, 0x3C, 0xB2, 0xD5, 0x8D, 0xE1, 0x3E, 0xBD, 0x67, 0xBE, 0x66, 0x77,
-    0x64, 0x62, 0xC5, 0xA9, 0x27, 0xF4, 0xC5, 0x60, 0xB9, 0xC5, 0x65, 0x5C, 0x5E, 0xC7, 0x94, 0xB9,
-    0xA7, 0x5E, 0xC7, 0x15, 0x5E, 0xE8, 0x97, 0x4D, 0xA0, 0x53, 0x99, 0x93, 0x47, 0xA2, 0x98, 0x39,
-    0xE8, 0x1D, 0x1C, 0x30, 0xB3, 0x26, 0xE8, 0x33, 0xAA, 0x66, 0xF1, 0xC3, 0x2A, 0x7D, 0x53, 0xED,
-    0x24, 0xEE, 0x70, 0x16, 0x98, 0xE4, 0xA6, 0x8C, 0x2D, 0xA2, 0x09, 0x42, 0x24, 0x48, 0x91, 0x23,
-    0xC3, 0x2E, 0xFA, 0xF8, 0x10, 0x4B, 0x21, 0xF2, 0x14, 0x59, 0x8E, 0x7E, 0x86, 0xA3, 0x5D, 0x2C,
-    0x06, 0xBB, 0x2E, 0x93, 0x9F, 0x54, 0xED, 0xBE, 0xF1, 0x95, 0x01, 0x47, 0x60, 0x10, 0x3C, 0xC6,
-    0x9F, 0x5F, 0x88, 0xC3, 0x04, 0x6C, 0x8A, 0x9A, 0x76, 0x3E, 0x91, 0x45, 0x6A, 0x65, 0xFE, 0x9E,
-    0xDA, 0x09, 0x94, 0x57, 0x05, 0x26, 0x32, 0xB1, 0x4A, 0x25, 0x13, 0xAB, 0x08, 0x2A, 0x7A, 0xD7,
-    0xB1, 0x4C, 0x05, 0x65, 0x8A, 0xE9, 0x74, 0x7A, 0x6F, 0x37, 0xAB, 0x3F, 0x6B, 0x04, 0x46, 0x60,
-    0x3C, 0x96, 0x91, 0x04, 0x82, 0x49, 0x6C, 0xE6, 0x55, 0x70, 0xE8, 0x57, 0x15, 0x93, 0x81, 0xF4,
-    0xF8, 0x12, 0x5A, 0xC8, 0x45, 0x21, 0x4B, 0xB4, 0x31, 0x9A, 0xDD, 0xF8, 0x16, 0x1B, 0x64, 0x68,
-    0xA2, 0x81, 0x2E, 0xE0, 0x4F, 0x83, 0x49, 0x54, 0x31, 0x5D, 0xF0, 0x2D, 0x78, 0x54, 0x4D, 0x46,
-    0x0B, 0x19, 0x2E, 0x50, 0x4C, 0x4F, 0xFA, 0x32, 0x52, 0xAC, 0xA2, 0x02, 0xF4, 0xF6, 0xFE, 0x32,
-    0x96, 0x9D, 0x0D, 0x11, 0xB6, 0x07, 0x23, 0xBD, 0x8C, 0xD3, 0x58, 0x6D, 0xB3, 0x31, 0x99, 0xEA,
-    0x98, 0x60, 0xE2, 0x4D, 0xFC, 0x71, 0x6A, 0x98, 0x76, 0x09, 0x33, 0x14, 0xD8, 0xC3, 0x31, 0x46,
-    0x9A, 0xE9, 0x33, 0x83, 0x90, 0x20, 0x2C, 0x04, 0xA3, 0x1C, 0xD6, 0x6B, 0x9C, 0x25, 0x92, 0x25,
-    0xA2, 0x1E, 0x52, 0xD1, 0x6C, 0xDC, 0xA2, 0x91, 0x8E, 0x6B, 0x2A, 0xE4, 0x64, 0xE5, 0x39, 0x3E,
-    0x40, 0x4D, 0x24, 0x2A, 0x30, 0x81, 0x19, 0xE9, 0x91, 0xA8, 0xC9, 0x94, 0x7A, 0xBA, 0xC7, 0x0B,
-    0x6A, 0x03, 0xA8, 0xCF, 0x8B, 0x2E, 0x67, 0xD4, 0xE5, 0x23, 0xDC, 0x02, 0xB3, 0x7A, 0xEF, 0xB6,
-    0x2E, 0x3D, 0x65, 0x7C, 0xD9, 0xF6, 0xF8, 0xCA, 0xCA, 0x4A, 0x69, 0x88, 0x07, 0x32, 0x0C, 0x5D,
-    0x33, 0xF3, 0xC0, 0xA4, 0x27, 0x08, 0xB9, 0xA4, 0xE7, 0x74, 0x49, 0xEE, 0x9B, 0xDC, 0xAB, 0x1C,
-    0x1B, 0x82, 0xFF, 0xB2, 0xE1, 0x99, 0xCE, 0x47, 0xBA, 0x95, 0xCC, 0xC6, 0xF9, 0xC8, 0x34, 0x6B,
-    0xE2, 0x5F, 0x32, 0x31, 0x3B, 0x2B, 0xEC, 0x2C, 0xEC, 0x74, 0x10, 0x5B, 0x8B, 0xB0, 0xB3, 0xB5,
-    0x00, 0xD5, 0x4E, 0x71, 0x65, 0xF8, 0x0D, 0x16, 0x5B, 0xD8, 0xC8, 0xB4, 0x6A, 0x62, 0x4E, 0xBB,
-    0xC9, 0xC8, 0x8E, 0x89, 0x76, 0xAB, 0x9D, 0x4E, 0x67, 0x8B, 0x59, 0x6B, 0x27, 0xF3, 0x09, 0x27,
-    0x83, 0xBC, 0x0A, 0xE9, 0xD3, 0x99, 0x15, 0x35, 0x06, 0xAF, 0x9C, 0x98, 0x8F, 0xE8, 0x67, 0x08,
-    0x3D, 0x22, 0x83, 0x43, 0x31, 0xA6, 0x58, 0xA9, 0xCB, 0xF5, 0x39, 0x4B, 0xFC, 0x7F, 0x97, 0x1C,
-    0x23, 0x90, 0xA5, 0xF1, 0xE6, 0x21, 0x61, 0xBC, 0xDF, 0x80, 0xEE, 0x41, 0x8D, 0xAC, 0xEC, 0x74,
-    0x78, 0xD8, 0xA1, 0x72, 0x74, 0x03, 0xAA, 0xEB, 0xC9, 0xBB, 0xB7, 0xE5, 0x70, 0x28, 0xBC, 0x37,
-    0x78, 0x6A, 0x75, 0xB7, 0x2C, 0xDB, 0x2B, 0x2B, 0xC0, 0x46, 0x99, 0xA8, 0x58, 0x7C, 0xA6, 0x56,
-    0x38, 0x06, 0x91, 0x8A, 0x11, 0x23, 0xE2, 0x81, 0x48, 0x71, 0x09, 0xAB, 0xAE, 0x9A, 0xC9, 0x6A,
-    0xA7, 0xED, 0xD8, 0x66, 0xAB, 0xA1, 0x13, 0x16, 0xB1, 0x4E, 0x10, 0xEB, 0x14, 0x55, 0x55, 0x91,
-    0x66, 0xF8, 0xD1, 0x33, 0xDD, 0xA8, 0xD3, 0xFA, 0x36, 0x8F, 0xE7, 0x5C, 0x42, 0xD8, 0xC6, 0xD5,
-    0xE4, 0x37, 0x51, 0xA4, 0x3F, 0xAB, 0x63, 0x16, 0xCB, 0x7A, 0xDF, 0x73, 0x98, 0x72, 0xC6, 0x99,
-    0x4C, 0x28, 0x73, 0x82, 0x60, 0x96, 0x75, 0x3E, 0x6A, 0x62, 0xA3, 0x41, 0xE4, 0xC4, 0x73, 0x4E,
-    0x5B, 0x5A, 0xCA, 0xF2, 0x7E, 0x76, 0xD4, 0x9F, 0xF4, 0x81, 0xF3, 0x03, 0xA6, 0x3C, 0xE5, 0x13,
-    0xB7, 0x1D, 0xBA, 0x97, 0xDB, 0x49, 0xA5, 0x72, 0x2B, 0x3F, 0xFE, 0x15, 0x1E, 0x9F, 0x17, 0xBF,
-    0xE7, 0x1E, 0x6F, 0x6B, 0x25, 0x36, 0xE6, 0xAA, 0x55, 0x8D, 0x35, 0xEE, 0x91, 0xE4, 0x2A, 0xD0,
-    0xEC, 0xF1, 0x8B, 0xB5, 0xA9, 0xB9, 0x50, 0x48, 0x12, 0x6A, 0xFC, 0x40, 0x11, 0xC0, 0xAF, 0x6D,
-    0xBA, 0xF4, 0xFC, 0x53, 0x48, 0xEE, 0x10, 0xD8, 0xF2, 0xCC, 0x8B, 0x0B, 0x3C, 0xD6, 0x51, 0xF0,
-    0x85, 0x4A, 0xAC, 0x53, 0xD4, 0x1F, 0xDE, 0xAD, 0x53, 0x25, 0xD5, 0x89, 0xAE, 0x0A, 0xBF, 0x22,
-    0xD9, 0xAC, 0x86, 0x74, 0xD2, 0xFB, 0x18, 0xB8, 0x13, 0xEB, 0x78, 0x40, 0x53, 0xF7, 0x17, 0xE0,
-    0x85, 0xC5, 0x44, 0x7E, 0x4B, 0x5D, 0x5F, 0xE0, 0x2C, 0x48, 0x6F, 0x54, 0xC1, 0x96, 0xD7, 0x86,
-    0x3A, 0xFD, 0x35, 0xBA, 0xF3, 0x00, 0xBF, 0x7B, 0x5B, 0x61, 0x39, 0x0F, 0x2A, 0xF0, 0x03, 0x09,
-    0xAE, 0x80, 0xBB, 0x00, 0xC2, 0x7C, 0xE7, 0xE0, 0xA8, 0xE5, 0xB2, 0x8F, 0x2C, 0x4F, 0x1E, 0xC9,
-    0xCC, 0x57, 0xCD, 0x27, 0xCA, 0x23, 0x81, 0x95, 0xB4, 0xFA, 0x09, 0x2F, 0x38, 0xC3, 0x8F, 0xE2,
-    0x25, 0xF8, 0xBC, 0xC0, 0x21, 0xB6, 0xE9, 0xBF, 0x81, 0x54, 0x44, 0x74, 0x01, 0x10, 0x98, 0x67,
-    0xB0, 0x17, 0xF3, 0xF8, 0xBA, 0xD8, 0xBB, 0x26, 0x95, 0x3B, 0x64, 0x93, 0xC2, 0xC6, 0xC4, 0x84,
-    0xFE, 0xBC, 0x94, 0x02, 0x16, 0xEE, 0xBE, 0x23, 0x94, 0xF0, 0xBA, 0x4A, 0x07, 0xA9, 0x3C, 0x27,
-    0x48, 0xC8, 0xEC, 0x91, 0xEA, 0x9A, 0x72, 0xBF, 0xEC, 0x7E, 0xFA, 0x97, 0x4E, 0x6F, 0x8A, 0x8B,
-    0x54, 0xD5, 0x48, 0xBC, 0xC3, 0x03, 0xF2, 0x73, 0xB2, 0x1E, 0x17, 0xE4, 0x6F, 0xD2, 0xA7, 0xEF,
-    0x5A, 0x11, 0x59, 0xE2, 0x3A, 0xB6, 0xED, 0x60, 0xCE, 0xB9, 0x5D, 0xA2, 0x6D, 0x54, 0xC5, 0xB3,
-    0xB7, 0x47, 0xCA, 0xB7, 0x76, 0x06, 0xAC, 0xD9, 0x7D, 0x52, 0xC2, 0x70, 0x9F, 0x78, 0xAE, 0x0B,
-    0x6B, 0xD5, 0xC9, 0x3B, 0xFD, 0xC8, 0xE3, 0x16, 0x65, 0x42, 0xBA, 0x79, 0x7A, 0x0C, 0xF6, 0xA5,
-    0xB5, 0x63, 0x6A, 0xA8, 0x77, 0x67, 0x40, 0x61, 0x3A, 0xDC, 0x85, 0x9C, 0x21, 0x20, 0x75, 0xA8,
-    0xB8, 0xC2, 0x9A, 0x61, 0x64, 0x9D, 0x6C, 0x9D, 0xD0, 0x77, 0x31, 0xE6, 0x91, 0x87, 0x13, 0x92,
-    0xD5, 0xFC, 0x28, 0x1A, 0x07, 0xF3, 0xD9, 0xDD, 0xF0, 0xF1, 0x41, 0x56, 0xF6, 0xCA, 0x9E, 0x29,
-    0xF4, 0x59, 0xE1, 0x72, 0xBD, 0xDA, 0xCB, 0xF5, 0x35, 0xE4, 0x83, 0x53, 0xB4, 0x18, 0x71, 0x8F,
-    0xCE, 0x5D, 0x26, 0xEE, 0x39, 0x10, 0x5D, 0xC0, 0x58, 0xB5, 0xE6, 0xDE, 0x39, 0x75, 0x6B, 0xA3,
-    0xD1, 0xEA, 0x35, 0x17, 0x3B, 0xC9, 0x37, 0x91, 0x3B, 0xBC, 0x24, 0x19, 0xDD, 0xE5, 0xE7, 0x5C,
-    0xE8, 0x0D, 0x34, 0xE3, 0x83, 0xD6, 0x49, 0x64, 0x5A, 0x77, 0x51, 0x36, 0x4D, 0x56, 0xBA, 0x1D,
-    0xA5, 0x6E, 0x3B, 0x95, 0x5F, 0xF8, 0x5B, 0x6F, 0xF6, 0x4D, 0xAB, 0x67, 0x9A, 0xA5, 0x6E, 0x3C,
-    0x56, 0x17, 0xDF, 0x22, 0xE3, 0xA6, 0xCC, 0x79, 0x13, 0x3D, 0xB8, 0x4B, 0xD6, 0x6D, 0x62, 0x72,
-    0xC1, 0x9F, 0x1C, 0xE7, 0xA0, 0xF5, 0x77, 0xF2, 0x7B, 0xFE, 0x39, 0x01, 0x72, 0x09, 0xB5, 0xF5,
-    0xE0, 0xD0, 0xD7, 0x91, 0x59, 0xEF, 0xD5, 0x2F, 0xFD, 0x03, 0xCD, 0x5C, 0x3D, 0x90, 0xDD, 0xD6,
-    0x75, 0xBE, 0x00, 0xC8, 0x85, 0x42, 0x4C, 0x0C, 0x15, 0xCA, 0x24, 0x21, 0x67, 0x8C, 0x4C, 0xC6,
-    0x85, 0xCD, 0x44, 0x46, 0xE3, 0x22, 0xC9, 0xC4, 0xB9, 0x90, 0x34, 0x63, 0x15, 0x2C, 0xC8, 0x99,
-    0x90, 0x76, 0xA1, 0x82, 0x29, 0x5C, 0x24, 0xCA, 0x24, 0xEB, 0xC2, 0x85, 0xC6, 0xE3, 0x08, 0x10,
-    0x59, 0xA8, 0x70, 0xA1, 0x9D, 0x49, 0x54, 0x65, 0x26, 0xDE, 0x82, 0x9E, 0xA1, 0xD6, 0x05, 0x55,
-    0xA8, 0x48, 0x32, 0xD2, 0x02, 0x22, 0x27, 0xC3, 0x82, 0x05, 0x21, 0xD1, 0x8A, 0x0A, 0x17, 0x84,
-    0x4C, 0x52, 0x4E, 0xC4, 0x62, 0x41, 0x12, 0x6B, 0x82, 0xBB, 0x00, 0x6E, 0xBE, 0xEF, 0x5C, 0xE0,
-    0xBD, 0xB7, 0xCB, 0x1F, 0xFD, 0x90, 0x94, 0x43, 0xE9, 0xDD, 0xB7, 0xBB, 0xEF, 0xE1, 0xE2, 0xDC,
-    0x73, 0xCF, 0xCF, 0x77, 0x7E, 0x2E, 0x94, 0xC2, 0x3F, 0xBF, 0x51, 0xCA, 0xE9, 0xF0, 0xC3, 0xDB,
-    0x78, 0x7D, 0x5B, 0xC9, 0xBF, 0xDC, 0xD4, 0xCA, 0xD8, 0x97, 0x33, 0x1C, 0x4B, 0x5C, 0x7C, 0xEC,
-    0xF1, 0xD5, 0xE2, 0xEB, 0xC6, 0x24, 0x78, 0xA9, 0x00, 0xAF, 0x70, 0xF3, 0xA8, 0x0A, 0x2B, 0xA5,
-    0xA2, 0x52, 0xA9, 0xB8, 0xB0, 0x2F, 0x6D, 0x3A, 0x79, 0xA5, 0x06, 0x5F, 0x76, 0x30, 0x57, 0x78,
-    0xBE, 0x54, 0xD1, 0xC5, 0x52, 0x85, 0x3F, 0x29, 0xEC, 0x1F, 0x1E, 0xDD, 0xFC, 0xA9, 0x31, 0x55,
-    0x6E, 0x4C, 0x69, 0x8C, 0x29, 0x8E, 0x99, 0x63, 0x89, 0x32, 0x98, 0x7B, 0xC0, 0x5D, 0x7A, 0xA5,
-    0x5C, 0x33, 0x28, 0x0F, 0x9F, 0xE1, 0x55, 0x7B, 0x6D, 0xD4, 0xF8, 0x8D, 0xD7, 0x06, 0xF8, 0x29,
-    0xAC, 0xFD, 0x36, 0xAC, 0xC2, 0x26, 0xBA, 0x64, 0xEA, 0xF8, 0x9C, 0x29, 0xF0, 0x52, 0xF3, 0x7F,
-    0x61, 0x6D, 0xEF, 0x92, 0xE2, 0xE7, 0xF6, 0x9E, 0xB4, 0x92, 0x55, 0x3B, 0xE8, 0x05, 0xFB, 0x82,
-    0xDA, 0x5E, 0x49, 0x5A, 0xC3, 0x72, 0x4E, 0xAF, 0xE6, 0x2B, 0xC3, 0x2B, 0x19, 0xA7, 0xF7, 0x4D,
-    0x05, 0xA2, 0x3B, 0xC7, 0x98, 0xD6, 0x1B, 0xD4, 0x9B, 0x21, 0xAE, 0x8F, 0xC6, 0x3B, 0xEA, 0x4F,
-    0x4E, 0xF3, 0x23, 0x79, 0xE5, 0x6B, 0xA7, 0x54, 0x8E, 0x6B, 0x52, 0xBE, 0xF8, 0x59, 0xB5, 0xA4,
-    0xA2, 0x91, 0x27, 0x8E, 0xE9, 0xE7, 0xE4, 0x46, 0x06, 0x6B, 0x36, 0xA5, 0x8B, 0xF5, 0x7B, 0xFD,
-    0x52, 0xE2, 0x8F, 0xF4, 0xF8, 0xA4, 0x0D, 0x1F, 0x39, 0x06, 0x84, 0xA4, 0xF8, 0x43, 0xC8, 0x3F,
-    0xE0, 0x3A, 0x67, 0x90, 0xD7, 0xF7, 0xF1, 0x73, 0xCE, 0xFB, 0x60, 0x59, 0xB1, 0xC9, 0xC6, 0x75,
-    0x2A, 0xB2, 0x6F, 0x20, 0xF3, 0xB0, 0x3E, 0x2C, 0x0F, 0xAB, 0xC3, 0x84, 0x98, 0x0F, 0xCB, 0xC3,
-    0xEA, 0xB0, 0x38, 0xAC, 0x2B, 0x2E, 0xB9, 0x2A, 0xFE, 0x9F, 0x09, 0x79, 0x98, 0x6F, 0xB3, 0x71,
-    0xB7, 0x5A, 0xF7, 0x66, 0xAD, 0x92, 0xE4, 0x7E, 0xF3, 0x78, 0x77, 0xCD, 0x13, 0x15, 0x5C, 0xF5,
-    0xC2, 0x3C, 0xBB, 0x79, 0x96, 0x8E, 0xEB, 0xC7, 0x74, 0x3B, 0xB6, 0x75, 0x62, 0xFD, 0x7D, 0xD8,
-    0xCF, 0x69, 0xC0, 0x32, 0x8D, 0x55, 0x69, 0x5C, 0xA6, 0x47, 0x21, 0x04, 0x2B, 0x0C, 0xBE, 0x49,
-    0x89, 0x18, 0xDF, 0x6A, 0x6E, 0xC7, 0xE6, 0x71, 0xBE, 0x05, 0x35, 0xAF, 0xC4, 0xE5, 0xDC, 0x3B,
-    0x6C, 0x60, 0x74, 0x8D, 0xF4, 0x14, 0x31, 0x36, 0x0B, 0x24, 0x51, 0xD8, 0x40, 0x91, 0xDE, 0x18,
-    0x48, 0x50, 0x9A, 0x18, 0xD2, 0x94, 0x93, 0x26, 0x23, 0x6F, 0xE0, 0xA7, 0xC1, 0x7F, 0xDF, 0xEB,
-    0xD4, 0xE0, 0xF7, 0xCA, 0xB4, 0xB8, 0x53, 0xA7, 0x4C, 0x8D, 0x3D, 0xA9, 0x94, 0xC9, 0x3C, 0x33,
-    0x24, 0xB3, 0xED, 0xCA, 0x65, 0x85, 0x46, 0xD6, 0x38, 0x70, 0x95, 0x58, 0x11, 0xD6, 0x88, 0x35,
-    0xE5, 0xB2, 0x22, 0x33, 0x8D, 0x50, 0x00, 0x88, 0x2F, 0x47, 0x53, 0x04, 0x1C, 0xEB, 0xB0, 0xF6,
-    0xBA, 0x08, 0x74, 0x42, 0x88, 0x9B, 0xA8, 0xF4, 0x9B, 0xA0, 0x89, 0xCB, 0xA0, 0x09, 0xEB, 0xB8,
-    0x08, 0xEA, 0xB8, 0xD6, 0x45, 0x88, 0x6F, 0xEA, 0x0C, 0x23, 0x28, 0x8C, 0xCC, 0xD5, 0x4F, 0x53,
-    0x8D, 0x04, 0x1C, 0xA8, 0xC8, 0x0C, 0xA8, 0x46, 0xEB, 0x37, 0x3E, 0x54, 0xC3, 0xC7, 0x6C, 0x78,
-    0x55, 0x41, 0x1D, 0x95, 0x9C, 0x37, 0xAC, 0xE2, 0x82, 0xDC, 0x94, 0x7F, 0x14, 0x1C, 0xE5, 0x35,
-    0xCA, 0xCA, 0xB7, 0x8A, 0x92, 0xC5, 0x15, 0x81, 0x0F, 0x99, 0x1A, 0x1C, 0x6E, 0x39, 0xC8, 0x77,
-    0x3B, 0xEC, 0x85, 0xD7, 0x41, 0x50, 0xBC, 0x36, 0xCD, 0xC8, 0x6A, 0xAE, 0x07, 0x3C, 0x0C, 0x38,
-    0x84, 0xBF, 0xE9, 0xC9, 0x69, 0xC3, 0x9D, 0x92, 0x01, 0x5F, 0x01, 0x8F, 0x29, 0x0A, 0x22, 0x0C,
-    0x11, 0x14, 0x24, 0xE1, 0x66, 0xCE, 0x84, 0x12, 0x7B, 0x40, 0x09, 0x0D, 0x0B, 0x52, 0x30, 0xD1,
-    0xB3, 0x0E, 0x9D, 0x50, 0x10, 0x62, 0x0C, 0x10, 0x72, 0xA7, 0xF3, 0x4C, 0xE1, 0x76, 0x01, 0xB4,
-    0xA0, 0x0D, 0x37, 0x32, 0xAF, 0xD1, 0x69, 0xE6, 0xD7, 0xB9, 0x4E, 0xFC, 0xBA, 0x4B, 0x55, 0x70,
-    0xAB, 0xCD, 0x55, 0xF8, 0xEB, 0x7A, 0x50, 0xE1, 0xE5, 0xB2, 0x87, 0xCE, 0x64, 0x3D, 0xA4, 0x1E,
-    0x7A, 0xAC, 0x7B, 0x70, 0x5E, 0xB7, 0x10, 0x23, 0x5D, 0x63, 0x6D, 0x69, 0xE9, 0xE3, 0xBE, 0x7B,
-    0xD5, 0x51, 0x90, 0x95, 0x91, 0xD4, 0x0F, 0x5B, 0xAB, 0xB1, 0x4A, 0xFD, 0xDD, 0x78, 0x5B, 0x48,
-    0x9A, 0x2E, 0x20, 0x72, 0x79, 0x82, 0xEF, 0x1B, 0x2C, 0xD0, 0xA5, 0x90, 0x63, 0x02, 0xA7, 0xA3,
-    0x10, 0xF6, 0xA0, 0x5E, 0x0D, 0xDC, 0xDD, 0x5C, 0xC4, 0x97, 0x3C, 0xD7, 0x34, 0xAD, 0x31, 0x6D,
-    0x09, 0x35, 0x5D, 0x69, 0xAE, 0x20, 0xE7, 0x37, 0xF8, 0x61, 0x4E, 0x5D, 0xCE, 0xEB, 0x9D, 0x02,
-    0x22, 0xF2, 0x41, 0xF1, 0xA0, 0x74, 0x64, 0x20, 0x31, 0x4D, 0x3C, 0x4A, 0x08, 0x6E, 0x63, 0xA8,
-    0x91, 0x10, 0x8C, 0x06, 0x1F, 0x05, 0x35, 0x3E, 0x0A, 0x65, 0xA8, 0xF0, 0x79, 0x54, 0xE2, 0xF3,
-    0x18, 0x92, 0xA1, 0x28, 0x12, 0x10, 0x7E, 0x33, 0x0E, 0x94, 0x04, 0xAB, 0x52, 0x76, 0x10, 0x6D,
-    0xCB, 0xAD, 0xF9, 0xE0, 0x86, 0x52, 0x45, 0x54, 0xCA, 0x61, 0xE8, 0x28, 0x1F, 0xA2, 0x58, 0x18,
-    0xC0, 0x3B, 0xEE, 0x54, 0x47, 0x55, 0xE8, 0x79, 0x2D, 0x86, 0xFC, 0x75, 0x0C, 0x14, 0x4D, 0xD7,
-    0x58, 0xF3, 0x6A, 0xC8, 0x92, 0x9C, 0x9A, 0x27, 0xA4, 0xA7, 0xA2, 0xCE, 0x5C, 0x1C, 0xD8, 0x23,
-    0xAF, 0xDA, 0xE9, 0x77, 0xDA, 0x77, 0x0F, 0x76, 0x9B, 0x36, 0x1E, 0x62, 0x5D, 0x84, 0x75, 0x5A,
-    0x85, 0x55, 0x54, 0x45, 0x25, 0x5E, 0x45, 0x5C, 0xC6, 0x45, 0x0E, 0x75, 0x33, 0x89, 0xC6, 0xE4,
-    0x29, 0xA9, 0xCE, 0x87, 0x64, 0xB4, 0xBD, 0x9D, 0x33, 0xBC, 0xD0, 0x39, 0x9D, 0x8B, 0x2D, 0x03,
-    0xC3, 0xC1, 0x72, 0xAA, 0xF0, 0x38, 0x4F, 0x16, 0xD6, 0xCB, 0x55, 0x08, 0x15, 0x81, 0x06, 0x8F,
-    0xC2, 0x9B, 0x56, 0x9A, 0x0A, 0x21, 0x73, 0x35, 0x8F, 0xD0, 0x86, 0xC3, 0x0A, 0xF3, 0xE7, 0x69,
-    0xE4, 0x26, 0xBF, 0x2E, 0x1B, 0x29, 0xFA, 0x65, 0xA8, 0x61, 0x90, 0x48, 0xEA, 0x59, 0x67, 0xAD,
-    0x95, 0xDC, 0xA6, 0xE5, 0x8D, 0xE8, 0x80, 0x78, 0x0B, 0xDE, 0x2C, 0xAA, 0x78, 0x3B, 0x68, 0x2D,
-    0xC6, 0x3C, 0xA3, 0x51, 0xA4, 0x92, 0x8F, 0x63, 0x24, 0xCA, 0x0F, 0x03, 0x89, 0x19, 0x40, 0x01,
-    0x65, 0xD4, 0x8E, 0x89, 0x10, 0xFB, 0xA8, 0x7C, 0x73, 0x9C, 0x85, 0x60, 0x15, 0xEE, 0x13, 0x96,
-    0xD0, 0x55, 0x6C, 0x43, 0x01, 0x55, 0x84, 0x31, 0x29, 0x68, 0x85, 0x1A, 0x7D, 0x52, 0x78, 0xA4,
-    0x7F, 0x42, 0x11, 0xE9, 0xD3, 0xE3, 0xD4, 0x02, 0xDA, 0x12, 0xFB, 0xA6, 0x68, 0x44, 0xE4, 0xCD,
-    0xEF, 0x07, 0x7A, 0xAA, 0xE8, 0x46, 0x2F, 0x8C, 0x7A, 0xBF, 0xE3, 0x9B, 0x39, 0xD9, 0xE1, 0xB6,
-    0xAE, 0xA1, 0xB7, 0x85, 0x33, 0xF2, 0x1A, 0xAE, 0xB0, 0xF1, 0xEB, 0x00, 0x9A, 0x86, 0x95, 0x93,
-    0x5C, 0xDA, 0x94, 0x5C, 0x4C, 0x5C, 0x41, 0x53, 0xE4, 0x64, 0xD1, 0xC4, 0xFF, 0x5A, 0x68, 0xFE,
-    0x39, 0x38, 0x8C, 0x9D, 0x13, 0x6F, 0xF7, 0x5D, 0xF2, 0x59, 0xF6, 0x40, 0xF6, 0xE3, 0x88, 0x32,
-    0x49, 0x7E, 0xC6, 0x88, 0x07, 0x13, 0x29, 0x79, 0xBC, 0x06, 0xC1, 0x39, 0xB2, 0x17, 0x0C, 0xA9,
-    0x63, 0xD8, 0xE9, 0x3B, 0xE2, 0x8C, 0x48, 0xFD, 0xFE, 0x95, 0xC7, 0x6E, 0x88, 0x1E, 0x9F, 0x69,
-    0xC5, 0xD6, 0xB5, 0xBC, 0xB8, 0xB5, 0xEE, 0x50, 0xBC, 0x20, 0x7C, 0x20, 0x5D, 0xB3, 0x38, 0x67,
-    0xBA, 0xF9, 0x22, 0x9E, 0x5D, 0x87, 0x21, 0x4D, 0xC0, 0xFE, 0x9C, 0xA6, 0x63, 0xC0, 0x1B, 0xE4,
-    0xD2, 0x10, 0x63, 0xC0, 0xED, 0xD1, 0x1A, 0x51, 0xC7, 0xE1, 0xE9, 0xDC, 0x6E, 0x32, 0x62, 0xA5,
-    0x4A, 0x21, 0x9E, 0xA5, 0xA2, 0x90, 0x96, 0x0E, 0x36, 0x97, 0x28, 0x0C, 0x20, 0xA5, 0xF2, 0xC1,
-    0x97, 0xED, 0x2A, 0xDC, 0x28, 0xBC, 0xDB, 0x55, 0x74, 0x26, 0xF3, 0x6E, 0x55, 0x5A, 0x67, 0xFE,
-    0xAD, 0xFA, 0x65, 0x9D, 0x04, 0x57, 0xC8, 0xA1, 0xF0, 0xCA, 0x0D, 0xB2, 0xE8, 0xD2, 0x2D, 0xF0,
-    0x28, 0x3A, 0x77, 0xBB, 0x02, 0x93, 0x00, 0xD1, 0x3A, 0x15, 0x9F, 0x30, 0xAF, 0x80, 0x43, 0xCF,
-    0x1A, 0xF2, 0xC9, 0x1D, 0xC0, 0xA8, 0x14, 0x56, 0x80, 0x8A, 0x4D, 0x59, 0x31, 0xE4, 0xD4, 0x80,
-    0x01, 0x74, 0xE8, 0x82, 0x5F, 0xC9, 0x3C, 0xB1, 0x9A, 0x2D, 0x3E, 0xA7, 0x13, 0xB5, 0x43, 0x40,
-    0xB5, 0x0A, 0x37, 0xBF, 0xDB, 0x63, 0x9D, 0xAE, 0x18, 0x4C, 0x4C, 0x2C, 0x56, 0x93, 0x26, 0x5D,
-    0x17, 0x01, 0x86, 0x0C, 0x7A, 0xB9, 0xE0, 0x7F, 0x02, 0xEA, 0x79, 0x2A, 0x72, 0x08, 0x0E, 0xFB,
-    0x03, 0x40, 0x5B, 0x48, 0xC3, 0x0F, 0x56, 0xE6, 0x49, 0x2C, 0x7C, 0xE1, 0x00, 0x46, 0xE7, 0xF0,
-    0xBB, 0xC4, 0x05, 0x74, 0xB4, 0x79, 0x82, 0x0D, 0x4B, 0x13, 0xF8, 0x86, 0xB4, 0x00, 0x9B, 0x74,
-    0x15, 0x37, 0x54, 0xEA, 0x8A, 0x14, 0xC0, 0xE7, 0x9B, 0x76, 0x66, 0xEE, 0xA9, 0x50, 0x66, 0x1A,
-    0xA0, 0xCD, 0xF9, 0xFD, 0xCC, 0xFD, 0x40, 0x73, 0xDF, 0xDF, 0x65, 0xEE, 0x8B, 0x99, 0xB9, 0xA7,
-    0x29, 0xD1, 0xB4, 0x24, 0xA0, 0x9E, 0x86, 0xF3, 0x0E, 0xF5, 0xB4, 0xA4, 0x11, 0x76, 0x86, 0xE3,
-    0xAD, 0x98, 0x4C, 0x6B, 0x36, 0xF1, 0x0A, 0x5A, 0x7F, 0x2B, 0xAF, 0x41, 0x4C, 0x49, 0xBC, 0x10,
-    0x6E, 0xAD, 0x88, 0x91, 0x88, 0x8A, 0xBB, 0x01, 0xD8, 0xA7, 0x82, 0x56, 0x42, 0xE5, 0xF1, 0xBB,
-    0xF9, 0xF8, 0x7A, 0x10, 0x68, 0x85, 0x2F, 0x2A, 0xB8, 0x68, 0x2C, 0x37, 0x03, 0x2A, 0xF9, 0x7C,
-    0xC8, 0x8E, 0x68, 0x6C, 0x34, 0x66, 0x8F, 0xDB, 0x0F, 0x4F, 0x2B, 0xAF, 0x47, 0xA7, 0xAF, 0xD4,
-    0x92, 0xE0, 0xB8, 0x9C, 0x86, 0x97, 0xC2, 0x84, 0x5D, 0xB8, 0x13, 0x9F, 0x87, 0xE0, 0x95, 0x71,
-    0x46, 0x7F, 0xAD, 0x13, 0x42, 0x43, 0x3B, 0xA6, 0xA2, 0x29, 0xB9, 0xF8, 0xF1, 0xC1, 0x85, 0x23,
-    0x6F, 0xFA, 0xA8, 0x13, 0xDB, 0x5E, 0x8B, 0xCB, 0x04, 0xBF, 0x96, 0x81, 0xD0, 0xEC, 0x2A, 0x47,
-    0x54, 0x05, 0x2B, 0xA3, 0xC4, 0x41, 0x63, 0xC3, 0x65, 0x2F, 0xE3, 0x52, 0xD3, 0x28, 0x43, 0xFB,
-    0xC3, 0x1A, 0x14, 0x06, 0xB7, 0x05, 0xD2, 0x37, 0x1C, 0x2A, 0x6A, 0x70, 0xC1, 0x9F, 0x30, 0x53,
-    0xC8, 0x9F, 0xE2, 0x0D, 0xA2, 0xDE, 0xD7, 0x40, 0xA7, 0xA1, 0x81, 0xE8, 0x31, 0x49, 0x40, 0x9F,
-    0x13, 0xD1, 0xD4, 0x42, 0x23, 0x86, 0x7B, 0x21, 0x8B, 0xE4, 0xD3, 0x90, 0x85, 0x77, 0x97, 0xA8,
-    0x59, 0x1D, 0x31, 0xE2, 0x55, 0xB1, 0xAB, 0xA9, 0x75, 0x01, 0xB2, 0x89, 0xE2, 0xF9, 0xB8, 0x8D,
-    0xDC, 0xC7, 0x10, 0x57, 0xF0, 0x2A, 0x5E, 0x84, 0x6B, 0x6A, 0x0A, 0x26, 0xE5, 0x12, 0xD0, 0xB4,
-    0x84, 0xDE, 0x94, 0xE9, 0x35, 0xF1, 0xF3, 0x05, 0xBD, 0xA9, 0xBB, 0x9E, 0x8F, 0x28, 0xFF, 0x1E,
-    0x48, 0x3F, 0x87, 0xD3, 0x83, 0x2C, 0x1A, 0x0B, 0x2C, 0x06, 0x61, 0xAC, 0x58, 0x9F, 0x9C, 0x21,
-    0x2B, 0x81, 0xB7, 0xDB, 0xC9, 0xEF, 0x1E, 0x1D, 0xED, 0x20, 0x9E, 0x16, 0xBF, 0xC3, 0xD5, 0xF2,
-    0x77, 0x86, 0x7B, 0x5C, 0x44, 0x2D, 0xAE, 0x97, 0xC8, 0x56, 0xDE, 0xC4, 0x05, 0x03, 0x26, 0xD0,
-    0x07, 0xC7, 0x40, 0x1E, 0xA1, 0x00, 0x25, 0xEA, 0xA7, 0xBC, 0x95, 0xF6, 0x8D, 0xA2, 0xC1, 0xDB,
-    0x8A, 0x42, 0x5B, 0xCB, 0x67, 0xAC, 0xED, 0x9B, 0xDD, 0x76, 0x98, 0xDF, 0x56, 0x7E, 0xE7, 0xDD,
-    0xF0, 0x3B, 0xEF, 0xE6, 0xF1, 0xEE, 0xF6, 0xB6, 0x35, 0x7F, 0x90, 0xDB, 0xE2, 0x7E, 0xE3, 0x6D,
-    0xE1, 0x74, 0x79, 0x5B, 0x58, 0x59, 0xDC, 0xDF, 0xDE, 0xCF, 0xD8, 0xB7, 0x41, 0xB8, 0x3A, 0xAA,
-    0xCB, 0x68, 0x52, 0xC7, 0xB7, 0xD1, 0x6D, 0xBA, 0xA7, 0xF0, 0x15, 0x18, 0x1C, 0x09, 0xFD, 0x94,
-    0x3A, 0x66, 0x16, 0xD8, 0x36, 0x1C, 0xA1, 0x71, 0x4F, 0x24, 0xEE, 0x1D, 0x72, 0x46, 0xBB, 0x0D,
-    0x43, 0x85, 0xA0, 0x66, 0xA8, 0x40, 0x7C, 0x94, 0x56, 0x91, 0xE5, 0x3B, 0x1C, 0xCF, 0x55, 0x61,
-    0x39, 0xA8, 0x31, 0xA2, 0x64, 0x03, 0x47, 0x32, 0x3E, 0xA2, 0x75, 0xB4, 0xE6, 0x11, 0x14, 0x7A,
-    0x7D, 0x82, 0x7D, 0xF7, 0x40, 0x11, 0x84, 0x13, 0xFB, 0x95, 0x26, 0xC1, 0x16, 0x94, 0x18, 0x36,
-    0x32, 0x86, 0xAB, 0x21, 0x7A, 0x33, 0xE2, 0x32, 0x60, 0xB0, 0x4B, 0xFD, 0x1E, 0x11, 0x4B, 0x7E,
-    0x96, 0x28, 0xC3, 0x3C, 0xC7, 0x91, 0x5E, 0x2B, 0x35, 0xA5, 0xE0, 0x96, 0xFB, 0x04, 0x72, 0xFD,
-    0x11, 0x48, 0xB2, 0x20, 0x81, 0x0C, 0x33, 0x13, 0xBD, 0x55, 0x23, 0x8E, 0x03, 0x2E, 0x5C, 0xC4,
-    0x84, 0xFD, 0xCC, 0xDB, 0x3B, 0xD0, 0x57, 0x8F, 0xB2, 0x43, 0xE4, 0xB0, 0x12, 0x43, 0xEE, 0x83,
-    0x66, 0x44, 0x97, 0xAD, 0x7A, 0xF1, 0xE7, 0x90, 0x66, 0xD3, 0x0A, 0xFE, 0x5C, 0x3B, 0x33, 0x21,
-    0x0A, 0x42, 0xE0, 0xE2, 0x6F, 0x1C, 0xD0, 0x2F, 0x82, 0x0B, 0x81, 0x36, 0xE5, 0x0E, 0x5D, 0xCF,
-    0xAD, 0xB1, 0xE7, 0x87, 0xF8, 0xFE, 0x20, 0x06, 0x1F, 0x4E, 0x77, 0xF0, 0x01, 0x76, 0xBB, 0x40,
-    0xAC, 0x0C, 0xBD, 0x2F, 0x8D, 0x0D, 0xAC, 0x50, 0xCE, 0xFB, 0x17, 0xD6, 0xBD, 0x50, 0xAF, 0xC4,
-    0xB2, 0x13, 0x74, 0xD1, 0x5D, 0x83, 0x2B, 0xC0, 0xED, 0xBD, 0x78, 0x60, 0xEA, 0x0F, 0xDC, 0x68,
-    0x40, 0x0D, 0x8A, 0xAB, 0x58, 0x2C, 0xB5, 0xC8, 0x18, 0x99, 0x99, 0x50, 0xAE, 0xF2, 0x76, 0x81,
-    0x8A, 0x65, 0xAC, 0x90, 0x78, 0x48, 0xC9, 0x97, 0xA2, 0x66, 0xE6, 0x85, 0x11, 0xDC, 0x61, 0x48,
-    0x13, 0x3B, 0x44, 0x5B, 0xB4, 0x09, 0xD6, 0xFD, 0x0F, 0xA3, 0xE7, 0x07, 0xF6, 0xC2, 0x2A, 0x00,
-    0xDB, 0x80, 0xBB, 0x3A, 0xA2, 0xAE, 0x96, 0x98, 0xAB, 0x11, 0xC4, 0x85, 0x8D, 0x7C, 0x65, 0xD5,
-    0x31, 0xB7, 0x6B, 0xCE, 0x1D, 0xB6, 0x90, 0x82, 0x8A, 0x9C, 0x25, 0x3A, 0xC0, 0x2B, 0x8B, 0x33,
-    0x78, 0x79, 0x28, 0x1A, 0xDD, 0x99, 0xC8, 0x21, 0x0C, 0xF7, 0xBA, 0x0A, 0xFA, 0x7F, 0x5A, 0xA0,
-    0xEC, 0xEF, 0x0B, 0x75, 0x80, 0x2B, 0x06, 0xBE, 0x31, 0xFF, 0x9B, 0xF8, 0xFD, 0x98, 0x2B, 0x39,
-    0xBB, 0xAA, 0xF4, 0x19, 0xD9, 0x6F, 0x95, 0x56, 0x44, 0x2B, 0xB0, 0x7B, 0xB0, 0x80, 0x36, 0x34,
-    0x36, 0x82, 0x88, 0x73, 0x1A, 0x9A, 0x0D, 0x72, 0x1C, 0x30, 0xC3, 0x8C, 0x5E, 0xE5, 0x40, 0x4B,
-    0x07, 0x45, 0x49, 0x2D, 0x42, 0xAC, 0x12, 0xF4, 0x14, 0xF1, 0x07, 0x79, 0x46, 0xE4, 0x2F, 0x28,
-    0xF5, 0x15, 0xD0, 0x21, 0xF4, 0xA4, 0x49, 0x7C, 0x8D, 0xC8, 0x18, 0x06, 0x5E, 0x42, 0x77, 0x32,
-    0xE9, 0xAA, 0xF2, 0xE4, 0x77, 0xAC, 0x3F, 0x19, 0xAD, 0x87, 0x6F, 0x44, 0x2A, 0x02, 0xB0, 0x2E,
-    0xEA, 0xAD, 0xA3, 0xD0, 0xC5, 0x1E, 0x15, 0x7F, 0x0C, 0x2E, 0x48, 0xC4, 0x51, 0xCD, 0x97, 0x62,
-    0xE4, 0xDE, 0x7C, 0x8D, 0x98, 0x52, 0x30, 0x7F, 0xAD, 0xFE, 0xF1, 0x30, 0xA2, 0xF6, 0xEB, 0x74,
-    0x8C, 0x75, 0xD4, 0xE8, 0x9A, 0xBA, 0xA9, 0x41, 0x19, 0xF8, 0x53, 0x12, 0x05, 0x81, 0x9E, 0x8C,
-    0xFC, 0x89, 0xB7, 0x07, 0x99, 0xD3, 0x9D, 0x24, 0xC8, 0xAE, 0x45, 0x24, 0x32, 0x80, 0xBD, 0x0B,
-    0xE5, 0x8A, 0x3C, 0xB1, 0x6B, 0xC1, 0x06, 0xFC, 0x6F, 0x32, 0xA2, 0x57, 0xD0, 0xB3, 0xF5, 0x36,
-    0xAE, 0xE5, 0x1E, 0x59, 0x7A, 0x28, 0xAF, 0x54, 0x32, 0x20, 0x5A, 0x97, 0x48, 0xB8, 0x18, 0x28,
-    0x85, 0x71, 0xD9, 0x8B, 0xD7, 0x7B, 0xAF, 0xA7, 0xB3, 0x0B, 0x7F, 0xD5, 0x69, 0xB1, 0xF4, 0x62,
-    0x6D, 0x23, 0xFB, 0x16, 0x5F, 0x1F, 0xC4, 0xAB, 0x9D, 0xAF, 0xC5, 0x74, 0x1E, 0xAA, 0xC1, 0x87,
-    0x03, 0x43, 0x58, 0xEB, 0xFF, 0x81, 0xA7, 0x43, 0xE8, 0x0E, 0x96, 0x57, 0x61, 0x19, 0x4C, 0x98,
-    0x4C, 0xB9, 0xF9, 0x0A, 0xEE, 0x1B, 0x98, 0xC1, 0xB1, 0xD9, 0x99, 0xEF, 0x76, 0x2E, 0x13, 0x00,
-    0x95, 0xF3, 0x42, 0x2B, 0x39, 0x9A, 0x6E, 0x3D, 0x6F, 0x11, 0x59, 0xA4, 0x92, 0x0D, 0xDA, 0xB7,
-    0xB2, 0x6F, 0x85, 0xDA, 0x17, 0x8D, 0x32, 0xC2, 0xB5, 0x8B, 0x84, 0x88, 0x7F, 0xB3, 0xD9, 0x0F,
-    0x03, 0xAF, 0x62, 0x7C, 0x9B, 0x47, 0x4A, 0x3B, 0x20, 0xA9, 0x66, 0xBC, 0xD7, 0x11, 0x27, 0x51,
-    0x2D, 0xA2, 0xF5, 0x3E, 0xCE, 0xC4, 0xB9, 0x1E, 0xB8, 0x2A, 0x7F, 0x7E, 0x98, 0x39, 0xDD, 0xD3,
-    0xEE, 0x69, 0xC6, 0x12, 0xC0, 0xD3, 0x80, 0xC6, 0x79, 0x16, 0xDC, 0xC0, 0x0E, 0x6C, 0xD3, 0xA7,
-    0xC2, 0x94, 0x82, 0x93, 0xF1, 0x65, 0xD8, 0xD2, 0xF3, 0xF0, 0x9C, 0x90, 0x7E, 0x7D, 0x82, 0xBE,
-    0xCD, 0x58, 0x2C, 0xB6, 0x7F, 0x6D, 0x0D, 0x62, 0xC7, 0x6D, 0x80, 0xF9, 0x7A, 0xB6, 0x23, 0x6A,
-    0x54, 0x03, 0x96, 0xDB, 0x7B, 0xAD, 0xD3, 0xF9, 0x0D, 0x14, 0xBB, 0xF6, 0x6C, 0xEA, 0xA3, 0xCA,
-    0x61, 0x1D, 0xF3, 0x52, 0xFC, 0x53, 0x21, 0xF7, 0x5C, 0x53, 0xFB, 0x4F, 0x63, 0x5F, 0x74, 0xE7,
-    0x43, 0xA0, 0x5B, 0x0C, 0xA6, 0x09, 0xCC, 0x2B, 0xA6, 0x0E, 0x37, 0x4E, 0x6E, 0xD7, 0xE1, 0xE5,
-    0x57, 0xAF, 0x57, 0xD1, 0xC5, 0xD7, 0x2E, 0x96, 0xF1, 0xC5, 0x9F, 0xBE, 0x56, 0xC6, 0xAF, 0x19,
-    0x68, 0xF9, 0xE1, 0x01, 0x0B, 0x0B, 0xB1, 0x59, 0x69, 0xD8, 0xEA, 0x24, 0xC7, 0x66, 0x90, 0xF2,
-    0xD5, 0xF1, 0x0E, 0x35, 0x21, 0x36, 0x53, 0x4D, 0xE1, 0xE6, 0x32, 0x81, 0x17, 0xAD, 0x30, 0x64,
-    0x9E, 0x32, 0x65, 0xE5, 0x5C, 0x67, 0xF9, 0x48, 0x39, 0x54, 0xFA, 0x40, 0x33, 0x93, 0x29, 0x4C,
-    0x56, 0x88, 0xBE, 0x82, 0x3A, 0xFC, 0x54, 0x5A, 0x9D, 0xBD, 0xBF, 0x3C, 0xBA, 0xAB, 0xEB, 0xCA,
-    0xBB, 0x65, 0x0A, 0x18, 0x98, 0xD2, 0x1F, 0x10, 0x6A, 0x32, 0xDF, 0xC9, 0xFB, 0xCE, 0xB8, 0x1F,
-    0xDB, 0x19, 0xE4, 0xBF, 0x39, 0xF7, 0xD5, 0xDF, 0x62, 0xC7, 0x3A, 0x89, 0x2C, 0x5B, 0xC7, 0x3C,
-    0x8F, 0x58, 0x9B, 0x90, 0xD1, 0xB5, 0xA0, 0x11, 0x1E, 0x55, 0x32, 0xA8, 0xF0, 0x26, 0x61, 0x1B,
-    0xD5, 0x34, 0x4F, 0xE1, 0x86, 0x49, 0xA2, 0x0B, 0xFD, 0x5D, 0xA0, 0x71, 0xF2, 0xE5, 0x2A, 0x62,
-    0x2E, 0x0C, 0x9A, 0x1A, 0xB6, 0x4F, 0xC0, 0xFE, 0xCE, 0xD2, 0x7D, 0x5A, 0xD4, 0x41, 0x17, 0x4F,
-    0xC6, 0xE0, 0xA3, 0x81, 0x49, 0x2A, 0x2D, 0xD1, 0xCE, 0x3B, 0x24, 0xFB, 0xBC, 0xA1, 0x65, 0xDC,
-    0x00, 0xF9, 0x43, 0xDC, 0xD3, 0x70, 0x4A, 0x2E, 0xAA, 0xA6, 0x81, 0xE0, 0x02, 0xC8, 0x00, 0x31,
-    0x59, 0x14, 0xA0, 0x84, 0x3F, 0xA5, 0x62, 0x28, 0x80, 0x14, 0x68, 0x7A, 0x04, 0x78, 0x11, 0x27,
-    0x18, 0xF8, 0x18, 0xE7, 0x34, 0x94, 0x4B, 0xE0, 0x81, 0xD3, 0xC3, 0x1C, 0x2B, 0x3A, 0x23, 0x35,
-    0x10, 0x57, 0x0E, 0x12, 0x78, 0x13, 0xF5, 0xE6, 0x42, 0x35, 0xD3, 0xBD, 0x7A, 0x7D, 0x42, 0x89,
-    0x92, 0x11, 0xD1, 0x44, 0x7D, 0x31, 0xB5, 0x94, 0x6B, 0x93, 0x85, 0xB9, 0x73, 0xA8, 0x48, 0x4B,
-    0x94, 0xDA, 0xC4, 0xA9, 0xCD, 0x1D, 0x4A, 0x56, 0x8C, 0x5F, 0x14, 0xE9, 0xE1, 0xA4, 0x4B, 0x88,
-    0x09, 0xE1, 0x4C, 0x24, 0x57, 0x02, 0xC3, 0xD0, 0xE6, 0x29, 0x16, 0x30, 0x70, 0x1D, 0x3D, 0x2C,
-    0xC4, 0xBB, 0x50, 0x52, 0x7D, 0x42, 0x06, 0x40, 0x25, 0x7D, 0x0E, 0x7B, 0xAC, 0x2F, 0x35, 0x60,
-    0x28, 0x21, 0x40, 0x40, 0xFF, 0xE5, 0x88, 0x79, 0xBA, 0xDF, 0xEC, 0x76, 0x78, 0x43, 0xAD, 0x41,
-    0x4C, 0x98, 0xD9, 0xCD, 0x0F, 0x81, 0x68, 0xFD, 0x1A, 0x31, 0x32, 0xA1, 0x4B, 0x44, 0x52, 0x43,
-    0x92, 0x1A, 0xCA, 0x8A, 0x84, 0x68, 0x88, 0x95, 0xDB, 0xD3, 0x56, 0x32, 0x78, 0x84, 0x74, 0x72,
-    0x43, 0x60, 0x28, 0x3F, 0xBB, 0x66, 0x0E, 0x12, 0xB1, 0xA4, 0x3D, 0xE4, 0xB6, 0x49, 0x17, 0xF2,
-    0x22, 0x64, 0xDF, 0xEF, 0xA9, 0x7D, 0xD9, 0xFE, 0x6C, 0x9C, 0x61, 0x94, 0x2D, 0xD8, 0x40, 0xC8,
-    0xB3, 0x3E, 0x47, 0x9F, 0x82, 0xF8, 0x6C, 0x00, 0x32, 0xFB, 0xE8, 0xEE, 0xD4, 0x0B, 0xEE, 0x8F,
-    0x2B, 0x99, 0x6E, 0x5C, 0xD8, 0x5C, 0xB1, 0xFD, 0x0B, 0x9B, 0x9B, 0xD8, 0xCD, 0x15, 0x7F, 0xA2,
-    0x06, 0xEC, 0x66, 0xEE, 0x52, 0x91, 0x41, 0x53, 0xC0, 0x3C, 0x36, 0x19, 0x96, 0x76, 0xF9, 0x1D,
-    0x84, 0x43, 0xB5, 0xFE, 0xD5, 0xE8, 0x27, 0x1E, 0xD1, 0xCC, 0xC0, 0x0C, 0x98, 0xD9, 0x64, 0x98,
-    0xB9, 0xCA, 0xC5, 0x7D, 0xA5, 0xF3, 0xDC, 0xA4, 0xE0, 0x5E, 0xA5, 0x8E, 0xC2, 0xD4, 0x24, 0x60,
-    0x7D, 0x22, 0x59, 0x67, 0x35, 0x7B, 0x99, 0x04, 0xDB, 0x58, 0xB9, 0xE6, 0x0C, 0xF5, 0xA7, 0xB5,
-    0x01, 0x18, 0xEC, 0xCE, 0x70, 0xBC, 0x96, 0xF0, 0x2C, 0x1D, 0x26, 0x48, 0xA7, 0xDE, 0x20, 0x37,
-    0x7A, 0xB0, 0x43, 0x42, 0x98, 0x31, 0xD2, 0x0F, 0x99, 0xA0, 0x0D, 0x0D, 0x64, 0x16, 0x1E, 0xDF,
-    0x67, 0x5E, 0xEB, 0x10, 0xB6, 0x2D, 0x3D, 0x8C, 0x21, 0xC7, 0xB2, 0x3E, 0x36, 0x40, 0x49, 0xA6,
-    0xA3, 0xFF, 0xA8, 0x44, 0x4A, 0xED, 0x54, 0x77, 0x45, 0x4F, 0x70, 0x42, 0x21, 0x9D, 0xFA, 0x96,
-    0xC9, 0x66, 0x1B, 0x4C, 0x66, 0x8C, 0x8E, 0xD5, 0x1B, 0x9D, 0xD1, 0x12, 0xED, 0x48, 0x19, 0x30,
-    0xC4, 0x19, 0x9D, 0x82, 0x67, 0x60, 0xFD, 0x3A, 0xFA, 0x08, 0x42, 0xE6, 0xFA, 0x47, 0xA6, 0x84,
-    0x83, 0x48, 0x7B, 0x6B, 0x93, 0x1D, 0x44, 0x5F, 0x2D, 0x15, 0xB8, 0xD1, 0xA6, 0xF5, 0xEB, 0xF4,
-    0x24, 0x08, 0x87, 0xDA, 0x85, 0xBF, 0x19, 0x30, 0x98, 0xDE, 0xE9, 0x23, 0x03, 0xEB, 0x11, 0xFF,
-    0x1A, 0x46, 0x24, 0x3E, 0x8B, 0x95, 0xEB, 0x77, 0x7B, 0x86, 0x02, 0x26, 0x47, 0x1C, 0x00, 0x18,
-    0x81, 0xD0, 0x7D, 0x98, 0xB2, 0xCB, 0x6B, 0x6F, 0x80, 0x77, 0xD6, 0xEE, 0x1B, 0x22, 0x78, 0x98,
-    0x67, 0xB2, 0xC2, 0x9C, 0xA9, 0x05, 0x8E, 0x69, 0xBC, 0xF2, 0xC3, 0x95, 0x33, 0x10, 0x94, 0xD2,
-    0x1A, 0x80, 0xFA, 0x52, 0x5B, 0xF5, 0xA3, 0x12, 0x07, 0x15, 0x33, 0x34, 0xF8, 0xA5, 0x79, 0x68,
-    0x87, 0xAC, 0xFE, 0x70, 0x1F, 0x3E, 0x80, 0x21, 0x4C, 0xE3, 0x44, 0xFD, 0xC1, 0xBE, 0x87, 0x9F,
-    0x6F, 0x84, 0xBD, 0xFC, 0x5B, 0xC4, 0x1C, 0x42, 0x7F, 0xD4, 0xCA, 0xFE, 0x1D, 0x80, 0x9F, 0x6D,
-    0x6B, 0xA4, 0x83, 0x0E, 0x41, 0x48, 0x63, 0x41, 0x2F, 0x13, 0xA1, 0x3B, 0x15, 0x71, 0x52, 0xC2,
-    0x7C, 0x14, 0xB6, 0xC1, 0x2A, 0x4F, 0xDE, 0xD9, 0x88, 0x75, 0xB4, 0x42, 0xD6, 0x4C, 0xE1, 0x46,
-    0x2E, 0x51, 0x70, 0xF5, 0xF0, 0x40, 0xE9, 0x00, 0x11, 0xF4, 0xDC, 0x78, 0x33, 0x2A, 0x2A, 0xB5,
-    0x29, 0xF4, 0xEB, 0x89, 0x35, 0xDE, 0x7A, 0xBB, 0x8E, 0x98, 0x81, 0x15, 0x9F, 0x93, 0xAF, 0x40,
-    0x4C, 0x70, 0x79, 0x54, 0xFE, 0x11, 0xBE, 0x19, 0x71, 0xAA, 0x84, 0xEE, 0x28, 0x65, 0xC5, 0x07,
-    0xA1, 0xC2, 0x56, 0x5E, 0x31, 0xF2, 0x9F, 0xF6, 0x5B, 0xBD, 0x33, 0xD6, 0x88, 0xD4, 0xF7, 0xAD,
-    0x28, 0x8D, 0x05, 0xA2, 0xDD, 0xB5, 0xA6, 0x9D, 0x35, 0x22, 0xD6, 0x48, 0xCE, 0x67, 0xFE, 0x46,
-    0xE1, 0x5F, 0x2E, 0xDC, 0xEF, 0xEC, 0xB8, 0x30, 0xA8, 0x77, 0x5F, 0x38, 0xBA, 0x9A, 0xE9, 0xC2,
-    0xD9, 0x6D, 0xA7, 0x10, 0xC4, 0xDE, 0x59, 0xA6, 0x98, 0xE9, 0xCB, 0xBD, 0x6A, 0x49, 0xF1, 0x3D,
-    0xB2, 0x22, 0x0B, 0x91, 0x0C, 0xDD, 0x4A, 0xDA, 0xD9, 0x22, 0x5B, 0x4A, 0x56, 0xEC, 0x87, 0x28,
-    0x2B, 0x11, 0x66, 0x9B, 0x6E, 0xC5, 0xF8, 0x1C, 0xC7, 0x54, 0x82, 0xFD, 0xDC, 0x33, 0x77, 0xA8,
-    0xE5, 0x10, 0x24, 0xA8, 0xF9, 0x90, 0x17, 0xD4, 0x73, 0x46, 0xCA, 0xB4, 0xBF, 0x44, 0x21, 0x88,
-    0x76, 0xEA, 0xF0, 0x4E, 0x5E, 0xE4, 0x25, 0xF3, 0xB8, 0x79, 0x32, 0x4F, 0x16, 0xB9, 0xA7, 0x97,
-    0x56, 0x49, 0x2A, 0x89, 0xE3, 0x37, 0xA7, 0xB2, 0x15, 0xCB, 0x35, 0x02, 0x0E, 0x87, 0x15, 0x81,
-    0x88, 0xDD, 0x98, 0x3F, 0x86, 0xAD, 0xA0, 0xED, 0xB5, 0x23, 0x84, 0x88, 0x61, 0xBF, 0xFE, 0x90,
-    0xD8, 0x28, 0x36, 0xAD, 0x44, 0x3B, 0xE5, 0x62, 0x91, 0xE5, 0x91, 0x89, 0xA8, 0xE8, 0xE4, 0x58,
-    0x70, 0x80, 0x47, 0x75, 0x9A, 0x87, 0x43, 0x70, 0x93, 0x64, 0xD3, 0x05, 0xFA, 0x98, 0xD6, 0xA9,
-    0x1F, 0x1A, 0x4D, 0x2A, 0x47, 0x3D, 0xC5, 0x7A, 0x12, 0x53, 0xA6, 0xEF, 0x4B, 0xD6, 0x9C, 0x59,
-    0xDE, 0xF5, 0x31, 0x30, 0xF9, 0x32, 0x40, 0xC3, 0x17, 0xA6, 0x7E, 0x0F, 0xE8, 0x6B, 0x6D, 0xCA,
-    0x88, 0xF6, 0x8E, 0xF9, 0x29, 0xEC, 0x67, 0x11, 0xD4, 0xF4, 0x69, 0xC0, 0xAF, 0xD0, 0x4D, 0x20,
-    0x58, 0x45, 0x3F, 0x67, 0x94, 0x8D, 0xE6, 0xF8, 0x37, 0xC3, 0x8C, 0x79, 0x62, 0x5C, 0x60, 0x58,
-    0xD8, 0x57, 0xF3, 0x0C, 0x56, 0x17, 0x30, 0x3E, 0xCF, 0x43, 0xF3, 0x3C, 0x64, 0x21, 0xCE, 0x0F,
-    0xC3, 0xCE, 0xA6, 0xFA, 0xA7, 0x15, 0x1C, 0x12, 0x74, 0x1C, 0x0B, 0x12, 0x4F, 0xD6, 0xC6, 0x90,
-    0xF0, 0xB8, 0x89, 0x98, 0x0D, 0x60, 0x7A, 0x58, 0x1D, 0x4C, 0x5E, 0x04, 0x73, 0xAC, 0xC7, 0xD4,
-    0x02, 0xB4, 0xB0, 0x4F, 0x8C, 0xEE, 0x68, 0xB5, 0x55, 0xEA, 0x18, 0x86, 0x9B, 0xCF, 0x19, 0x66,
-    0xE7, 0x0E, 0x19, 0xEC, 0x98, 0x3E, 0x6E, 0xA8, 0x8A, 0x39, 0x59, 0x15, 0x0F, 0x1A, 0xB3, 0x45,
-    0x1D, 0x99, 0x85, 0x88, 0x4F, 0xD4, 0x4C, 0xCA, 0x8B, 0xA3, 0xF4, 0xED, 0x37, 0x6F, 0xD8, 0x28,
-    0x12, 0xB2, 0xFB, 0xFB, 0x94, 0xC0, 0x79, 0xAD, 0x48, 0x8D, 0xB5, 0xA2, 0xC2, 0xF2, 0x0C, 0xFF,
-    0x11, 0xC1, 0xBE, 0xBB, 0x98, 0x17, 0x58, 0x51, 0x0E, 0x50, 0xAF, 0xC0, 0x5E, 0x05, 0x99, 0xAD,
-    0x14, 0x80, 0x2F, 0x6C, 0x02, 0xBD, 0x28, 0xA0, 0xEF, 0x35, 0x98, 0x20, 0x58, 0x27, 0x5C, 0x6E,
-    0xE0, 0x42, 0xE2, 0xF7, 0x0C, 0xD9, 0x6E, 0xC8, 0x77, 0x03, 0x56, 0x7D, 0xDC, 0xEB, 0x04, 0x9F,
-    0xA6, 0xCA, 0xDF, 0x99, 0x12, 0xC8, 0xC5, 0x18, 0x1A, 0xA9, 0xC8, 0x33, 0x1F, 0x40, 0x9F, 0x34,
-    0x3C, 0xF3, 0xA6, 0xD3, 0x31, 0x03, 0xEA, 0x76, 0x14, 0x72, 0x4F, 0xCA, 0x1D, 0x9E, 0xA8, 0x9D,
-    0x4D, 0x0B, 0x06, 0x36, 0x39, 0xB8, 0x99, 0x1F, 0x3B, 0xC2, 0xF4, 0x9D, 0xE0, 0x43, 0x29, 0x90,
-    0x30, 0x1B, 0xCF, 0x74, 0x7C, 0xB5, 0x44, 0xD4, 0xC5, 0x74, 0x0F, 0xAB, 0xB5, 0x60, 0xA3, 0x43,
-    0x93, 0x30, 0x89, 0xDE, 0x72, 0x25, 0x4E, 0x97, 0x7E, 0x15, 0xB1, 0xBB, 0xAE, 0xFE, 0x06, 0x5B,
-    0x9B, 0xA9, 0x60, 0xD3, 0xBC, 0x2E, 0xCA, 0x9D, 0x48, 0x10, 0x18, 0x5D, 0x1B, 0x8E, 0x61, 0xAA,
-    0x81, 0x52, 0x66, 0x14, 0xF7, 0x77, 0x83, 0x09, 0x48, 0x20, 0xB3, 0x24, 0x9A, 0xE2, 0x6B, 0x8B,
-    0xFB, 0xA2, 0x6E, 0x12, 0x4F, 0x91, 0xC0, 0xFE, 0x1D, 0x12, 0x4E, 0x3E, 0x61, 0xB5, 0x2A, 0x60,
-    0x12, 0x81, 0xA9, 0x20, 0xE1, 0xBB, 0x4A, 0x73, 0x26, 0xAF, 0x35, 0x08, 0xEA, 0x53, 0x26, 0xD0,
-    0xD7, 0x63, 0x38, 0xBB, 0x81, 0xA8, 0xBB, 0x07, 0xBF, 0xDF, 0xED, 0x10, 0xE0, 0x9C, 0xE8, 0x08,
-    0x42, 0x5F, 0x64, 0x9A, 0x04, 0x6C, 0x06, 0xB7, 0xFC, 0xED, 0x52, 0x85, 0x1F, 0x42, 0x7D, 0xCF,
-    0x63, 0xCB, 0xAF, 0xD7, 0xAC, 0x4D, 0xB1, 0xD0, 0xEE, 0x6D, 0x6D, 0x37, 0xFE, 0xAD, 0xDF, 0xB4,
-    0xE1, 0x95, 0x9B, 0x5D, 0x7C, 0xFE, 0x46, 0xA7, 0x9F, 0xAF, 0x99, 0x66, 0x64, 0xD2, 0xC0, 0x08,
-    0x2A, 0x25, 0x18, 0xA4, 0x92, 0x41, 0x7D, 0x1C, 0x7C, 0x92, 0x12, 0x12, 0xF6, 0x5A, 0x12, 0x68,
-    0x9A, 0xEC, 0x1C, 0xF2, 0x44, 0x8A, 0xDF, 0x89, 0x14, 0xBF, 0xB3, 0x70, 0x33, 0x35, 0x1B, 0xC0,
-    0x71, 0xB9, 0x5E, 0x2E, 0xC2, 0x72, 0xD0, 0xC7, 0x8B, 0xE8, 0x6C, 0x97, 0x82, 0xAA, 0x73, 0x6D,
-    0x1E, 0x16, 0xFA, 0x62, 0xBD, 0x1E, 0x96, 0x90, 0xDE, 0x1E, 0x63, 0x4A, 0x74, 0xED, 0x9C, 0x52,
-    0x07, 0x57, 0x98, 0x19, 0xAE, 0x3C, 0xD0, 0x53, 0xF9, 0xB5, 0xB7, 0x8D, 0xC8, 0x2B, 0xB8, 0x55,
-    0x87, 0x9B, 0xC7, 0x7F, 0xCD, 0xD8, 0xC5, 0x34, 0x1C, 0xDA, 0xE8, 0x83, 0xC1, 0xB4, 0xF1, 0x2B,
-    0x7D, 0xDF, 0xE9, 0x93, 0x77, 0x30, 0x1C, 0xBA, 0xD9, 0x76, 0x3A, 0xBC, 0xD4, 0x80, 0x01, 0xE7,
-    0x6A, 0x81, 0xE1, 0x80, 0xE0, 0xC2, 0x77, 0xF9, 0x19, 0x0A, 0x77, 0xE7, 0x7B, 0xDD, 0x64, 0x84,
-    0x9D, 0x4E, 0xC0, 0xF8, 0x60, 0xEB, 0xA9, 0xBD, 0x54, 0x0B, 0xA4, 0x50, 0x65, 0xA4, 0xEB, 0xE2,
-    0xCC, 0x65, 0xE6, 0xA0, 0xE3, 0x0B, 0x35, 0xBE, 0x88, 0x28, 0x1D, 0x17, 0xE9, 0x57, 0x01, 0xAC,
-    0x9A, 0xF4, 0x79, 0x8A, 0x64, 0x2E, 0x29, 0x48, 0xD1, 0x97, 0xC2, 0x50, 0x9D, 0x0F, 0xAE, 0xAD,
-    0x65, 0x4C, 0xFD, 0x65, 0x02, 0x95, 0x55, 0x74, 0x82, 0x6A, 0x72, 0x9E, 0x3A, 0xBE, 0x21, 0x70,
-    0xBE, 0xB0, 0x85, 0x3F, 0x47, 0x92, 0xC8, 0x37, 0xB7, 0xE0, 0xF2, 0xAE, 0x6C, 0xC2, 0xCD, 0x9E,
-    0xBB, 0xD1, 0x2A, 0x72, 0x18, 0x0A, 0xC7, 0x4A, 0x6D, 0xEE, 0xDB, 0x6A, 0x42, 0x20, 0x6F, 0x03,
-    0x7F, 0xC3, 0x76, 0x7A, 0xFD, 0xF7, 0x7A, 0x16, 0x24, 0x99, 0xC6, 0x62, 0x00, 0x0C, 0xC9, 0xA5,
-    0xBA, 0x6A, 0xA9, 0x20, 0xF1, 0x6E, 0xC2, 0xEB, 0x4C, 0xD6, 0xC8, 0xD4, 0xD3, 0x66, 0x7A, 0xF9,
-    0x3A, 0x5D, 0x69, 0x1E, 0x5D, 0x62, 0xE2, 0x72, 0x88, 0xCF, 0x81, 0xD8, 0xF7, 0x3B, 0x8D, 0x37,
-    0x70, 0x1C, 0xB1, 0x8A, 0xD2, 0x17, 0x1A, 0x7D, 0x12, 0x6F, 0xAF, 0xD5, 0xE9, 0x73, 0x78, 0x3B,
-    0x5E, 0xE6, 0x98, 0xD0, 0x39, 0xC5, 0x45, 0x10, 0x0D, 0x9A, 0xC2, 0xAB, 0x29, 0x53, 0x7E, 0x1D,
-    0xBE, 0xCB, 0x44, 0x68, 0x70, 0x09, 0xD3, 0x6D, 0xBE, 0x00, 0x92, 0x42, 0x49, 0xB0, 0xDA, 0x5C,
-    0x78, 0xF4, 0xDF, 0x03, 0xC0, 0x53, 0x7C, 0x72, 0xF3, 0x0E, 0xA6, 0x78, 0x15, 0xAC, 0x57, 0xFA,
-    0xF0, 0x25, 0x58, 0x39, 0x1D, 0x9D, 0xAB, 0x49, 0xDE, 0xAB, 0x2C, 0x40, 0x3B, 0xEA, 0x1B, 0xCA,
-    0x7B, 0x0F, 0x41, 0xD4, 0x36, 0x03, 0xE2, 0x4C, 0xDC, 0x56, 0x2E, 0xD9, 0xBD, 0x5E, 0xBD, 0xE4,
-    0x0E, 0x63, 0x4B, 0x4B, 0x2F, 0x3D, 0x2F, 0x11, 0xDB, 0x59, 0x86, 0x44, 0x9A, 0x3F, 0xD4, 0x72,
-    0x6D, 0x9D, 0x39, 0x2D, 0x77, 0x48, 0xEF, 0x5C, 0x3B, 0x67, 0x4C, 0x19, 0xB1, 0x41, 0x82, 0x85,
-    0xE9, 0x7F, 0x19, 0x01, 0xFA, 0xDA, 0xAA, 0x4C, 0x47, 0x9F, 0xA8, 0x8E, 0xC0, 0xBC, 0xFE, 0x8E,
-    0x7A, 0x5B, 0x05, 0x70, 0x42, 0xDE, 0x06, 0xF3, 0x5D, 0xC0, 0x0E, 0x52, 0xFC, 0x68, 0xD4, 0xD7,
-    0x46, 0x80, 0xB0, 0x77, 0x99, 0xB9, 0xB9, 0x44, 0x3A, 0x6F, 0xD4, 0x72, 0x69, 0x81, 0x02, 0x2C,
-    0xFE, 0x7E, 0xF1, 0x93, 0xD0, 0x3F, 0xAC, 0xE5, 0x17, 0x10, 0x02, 0xEA, 0xDD, 0xDA, 0x29, 0xCC,
-    0xDB, 0xD9, 0xE2, 0xDC, 0xD1, 0x3D, 0x40, 0xA9, 0x31, 0xA2, 0x0E, 0x82, 0xC7, 0x1C, 0xEE, 0x4C,
-    0x27, 0xAC, 0xF1, 0xA6, 0x89, 0x64, 0x4C, 0x59, 0x03, 0xCC, 0x72, 0xA9, 0x5C, 0x31, 0xF6, 0xD0,
-    0x49, 0x0F, 0x99, 0xD0, 0xCF, 0x30, 0x12, 0xD0, 0x67, 0xBB, 0xD8, 0xA6, 0x88, 0x0B, 0xF1, 0xEC,
-    0x09, 0x77, 0x8B, 0xBE, 0xE6, 0xC0, 0xE6, 0xAC, 0x38, 0x61, 0xA3, 0x44, 0x1B, 0x26, 0xAA, 0xB1,
-    0x67, 0x63, 0x21, 0x5C, 0x9C, 0xC7, 0x8C, 0x89, 0xDA, 0xB7, 0x9A, 0x2E, 0xAD, 0x62, 0x6B, 0x09,
-    0x1B, 0x06, 0x0C, 0x05, 0x30, 0x79, 0x2C, 0xC0, 0xFC, 0x2C, 0x8C, 0xA5, 0x44, 0xA4, 0xD8, 0x52,
-    0x38, 0x11, 0xAF, 0x01, 0x5D, 0x3E, 0x03, 0x8D, 0x43, 0xB5, 0xA4, 0xFA, 0x59, 0xAB, 0x64, 0xB5,
-    0x50, 0x84, 0x9C, 0xB0, 0x71, 0x77, 0x30, 0x2A, 0x8A, 0x90, 0xCE, 0x8B, 0x27, 0x30, 0xCA, 0x92,
-    0x69, 0x75, 0x78, 0xAD, 0x37, 0xC0, 0x11, 0x62, 0x1F, 0x72, 0x25, 0x65, 0x48, 0xBA, 0x85, 0x44,
-    0x7F, 0xB2, 0x66, 0x2B, 0x09, 0x09, 0x73, 0xDE, 0x49, 0x7E, 0xEC, 0x98, 0xB1, 0xDD, 0x43, 0xB6,
-    0x76, 0xC6, 0xDC, 0xA9, 0x2E, 0xA3, 0xFB, 0xD4, 0xCE, 0x96, 0x99, 0x28, 0x95, 0xB2, 0x0A, 0xD8,
-    0x9F, 0x8F, 0x25, 0x18, 0x30, 0x11, 0x13, 0x71, 0x32, 0x73, 0xCC, 0xA6, 0x1F, 0x73, 0xCE, 0xB4,
-    0xD1, 0x8D, 0xC9, 0xC7, 0x6C, 0xAC, 0xD9, 0xAA, 0x9C, 0x09, 0x5C, 0x6C, 0x83, 0x49, 0x71, 0x75,
-    0x4A, 0x98, 0x44, 0x47, 0x49, 0xB7, 0x06, 0xE7, 0xA8, 0x29, 0xD3, 0x50, 0x53, 0x7D, 0x18, 0x8C,
-    0xFF, 0x29, 0x40, 0x68, 0x9E, 0xE1, 0x45, 0x17, 0x66, 0x2D, 0x6A, 0xD4, 0x5A, 0x8C, 0xF8, 0x22,
-    0x1C, 0x39, 0xEE, 0x8C, 0xEB, 0x11, 0xD2, 0x38, 0x58, 0x0A, 0x09, 0x7E, 0x1E, 0x1B, 0x07, 0x77,
-    0x0A, 0x9D, 0x50, 0xB0, 0x56, 0xB8, 0x8E, 0x61, 0xE1, 0xCE, 0xEB, 0xA4, 0xA7, 0xE5, 0x22, 0xE4,
-    0x08, 0x6A, 0xE1, 0x7D, 0x04, 0xB9, 0xAA, 0x5F, 0x7A, 0xA4, 0x74, 0x49, 0x88, 0x4A, 0xF0, 0xFC,
-    0x1A, 0x14, 0xEE, 0x5C, 0xA5, 0xDC, 0x77, 0xED, 0x1F, 0x1F, 0x86, 0xDE, 0xF9, 0x96, 0x2A, 0xBB,
-    0xAB, 0xB6, 0xA7, 0x4A, 0x42, 0x41, 0xD9, 0x5B, 0xCA, 0x1F, 0xD4, 0x72, 0x69, 0xD5, 0x39, 0x0D,
-    0xCF, 0x9B, 0x3F, 0x5F, 0x4B, 0x9D, 0x3A, 0x7D, 0xAE, 0x61, 0xC4, 0xC4, 0x77, 0x48, 0x17, 0x2C,
-    0x1C, 0x65, 0x8B, 0x90, 0xFC, 0xD9, 0x16, 0x92, 0x05, 0x7F, 0xE3, 0x76, 0x00, 0x3C, 0xF0, 0x81,
-    0x4E, 0x67, 0x4B, 0xA6, 0xEC, 0x3F, 0x91, 0xAA, 0xE9, 0xD0, 0xDA, 0xC2, 0xA9, 0x00, 0x44, 0xFA,
-    0xE1, 0x51, 0x04, 0xF2, 0xC2, 0x4A, 0x41, 0x3E, 0xC6, 0x3D, 0x63, 0xF7, 0x9E, 0x33, 0x76, 0xC5,
-    0xF9, 0x63, 0x6F, 0x81, 0xA9, 0xC7, 0xF7, 0x72, 0xDE, 0xBF, 0x04, 0x99, 0x41, 0x78, 0xFC, 0x86,
-    0xF8, 0x57, 0x17, 0x21, 0xAA, 0xA1, 0xBF, 0x89, 0x6B, 0xC3, 0x34, 0x20, 0x38, 0xFD, 0x2C, 0x65,
-    0x3F, 0xD1, 0xAF, 0xC0, 0xAE, 0x33, 0x2D, 0xD0, 0x11, 0x37, 0xA5, 0x49, 0x97, 0x4B, 0x32, 0xBB,
-    0xB7, 0x5D, 0x5E, 0x43, 0x27, 0x12, 0x95, 0xB7, 0xB6, 0x57, 0xAF, 0x16, 0xB9, 0x02, 0xF0, 0xA7,
-    0x68, 0x8D, 0x11, 0xF8, 0x58, 0x37, 0xB5, 0x74, 0x79, 0xFD, 0x2C, 0xE3, 0xCC, 0x37, 0x1B, 0x5B,
-    0xD9, 0x8E, 0xB0, 0x3D, 0x1C, 0xFE, 0x4A, 0xB8, 0x4A, 0x7F, 0xC1, 0x72, 0x83, 0x94, 0xAA, 0x87,
-    0x75, 0xB8, 0x79, 0xCC, 0x5F, 0xB0, 0x32, 0xC4, 0xDC, 0x7F, 0x6C, 0x07, 0xA9, 0xE6, 0x4F, 0x05,
-    0x00, 0x19, 0xD2, 0x2C, 0xCD, 0xA4, 0xA6, 0xC7, 0x22, 0xE3, 0xED, 0xCB, 0xA2, 0x0C, 0xA2, 0xA0,
-    0xE5, 0xE8, 0x90, 0xA4, 0x67, 0x6A, 0x49, 0xF0, 0x37, 0xC1, 0x47, 0x23, 0x91, 0x20, 0x53, 0x8F,
-    0xD0, 0xE4, 0x52, 0xBF, 0xCB, 0xE5, 0x12, 0xA3, 0x84, 0x52, 0xC8, 0x31, 0xD2, 0x36, 0x80, 0x5D,
-    0xF9, 0x07, 0xA6, 0xE1, 0x8D, 0x0D, 0x05, 0x48, 0x31, 0xAB, 0x00, 0x4F, 0x0A, 0xE1, 0xD2, 0x06,
-    0xE5, 0x49, 0xED, 0xD2, 0x7F, 0x86, 0xC1, 0x94, 0xF3, 0x4D, 0x6B, 0x6B, 0x64, 0xFC, 0x8A, 0x8C,
-    0xDF, 0x9A, 0x37, 0x27, 0xF6, 0x8E, 0xD4, 0xA9, 0x3C, 0xE6, 0xF8, 0x06, 0x60, 0xB9, 0xA0, 0x7F,
-    0xC2, 0x79, 0xBE, 0x93, 0x0E, 0x04, 0xA9, 0xD0, 0x3A, 0x52, 0xA2, 0x9D, 0x8D, 0x19, 0x77, 0x31,
-    0x4D, 0x82, 0xCA, 0xED, 0x49, 0x97, 0xD7, 0xB1, 0x5C, 0x88, 0x11, 0x60, 0x96, 0x32, 0xA4, 0x8B,
-    0x88, 0x09, 0x98, 0x32, 0xA7, 0x11, 0x67, 0x24, 0x6E, 0xB6, 0xE1, 0xBB, 0xB0, 0xC1, 0xE6, 0xEA,
-    0xEC, 0x96, 0x62, 0x96, 0xFE, 0x73, 0xC0, 0x4C, 0x1F, 0x1D, 0xC0, 0xE0, 0x73, 0xFD, 0x6E, 0x31,
-    0xAE, 0x1F, 0xB6, 0x7D, 0xFC, 0x97, 0xAE, 0x2C, 0x67, 0x9E, 0xA9, 0x88, 0x02, 0x4A, 0x03, 0xF3,
-    0x9A, 0xFC, 0x35, 0xBB, 0x57, 0x1C, 0x71, 0xE5, 0x43, 0xAE, 0x8E, 0xAA, 0x1E, 0x3B, 0xED, 0x60,
-    0xCB, 0x7B, 0xB7, 0x83, 0x64, 0x7A, 0x9D, 0xF1, 0xFA, 0xA0, 0x61, 0x2E, 0x08, 0x6E, 0x2D, 0x07,
-    0x16, 0xED, 0x83, 0x59, 0x28, 0xBB, 0x06, 0x0F, 0xC2, 0xEC, 0x00, 0xB7, 0xF6, 0xE3, 0x0F, 0x79,
-    0xAF, 0xE4, 0x99, 0xD9, 0x7D, 0xBE, 0x44, 0x6C, 0xAE, 0xF6, 0x1E, 0x3B, 0xA6, 0x24, 0x10, 0xE4,
-    0xB8, 0xCC, 0x4D, 0xDB, 0xFB, 0xC4, 0x1F, 0x4C, 0x94, 0x3C, 0x16, 0xE4, 0xBE, 0xBB, 0x39, 0xC0,
-    0x3C, 0x33, 0x6F, 0x0E, 0x28, 0x77, 0x85, 0xCC, 0x77, 0x35, 0x07, 0xEC, 0x11, 0x01, 0x0B, 0xC4,
-    0x3F, 0x2C, 0xC6, 0xDD, 0xBB, 0x62, 0xEF, 0xE5, 0xAB, 0xAE, 0xCD, 0x2C, 0x34, 0x5F, 0xA3, 0x19,
-    0xC9, 0xC6, 0xF6, 0xD2, 0xF1, 0x7F, 0xE8, 0x00, 0x3D, 0x08, 0xA6, 0x91, 0x68, 0x7C, 0x67, 0xD3,
-    0xA9, 0x52, 0x4F, 0xE0, 0xF5, 0xB4, 0x52, 0x2B, 0x7F, 0xA9, 0x54, 0xFB, 0x16, 0xE6, 0x1B, 0xE1,
-    0x80, 0x8F, 0xEB, 0xC2, 0x20, 0xFB, 0x21, 0x3E, 0x4A, 0x7F, 0x6C, 0x6B, 0x87, 0x44, 0x12, 0xDE,
-    0x65, 0xE8, 0xF1, 0x09, 0x98, 0xCC, 0x45, 0x51, 0xA1, 0x90, 0x63, 0xD3, 0xEB, 0xDC, 0x94, 0x2F,
-    0x49, 0xF8, 0xF6, 0xF7, 0xA6, 0xCC, 0xB7, 0xAB, 0xFF, 0x70, 0xAB, 0xAF, 0x62, 0x31, 0xEF, 0xA8,
-    0x1F, 0x8B, 0xF0, 0x7F, 0x13, 0x4C, 0x8D, 0x92, 0x48, 0x5A, 0x86, 0x97, 0xAE, 0x62, 0x65, 0xBF,
-    0xD0, 0x79, 0xFB, 0x6D, 0x97, 0x01, 0xDF, 0x1F, 0x4E, 0xD1, 0x84, 0xB5, 0x0E, 0xAA, 0x7C, 0xD3,
-    0xBE, 0x27, 0x4F, 0x4E, 0x46, 0x60, 0xAF, 0x12, 0x64, 0xC3, 0x46, 0x22, 0xE7, 0x3D, 0x2C, 0xFB,
-    0xAD, 0x1F, 0x28, 0x27, 0x39, 0x32, 0x7D, 0xE3, 0x81, 0xFF, 0xA4, 0x95, 0x01, 0x6C, 0xF8, 0x73,
-    0xD2, 0xE6, 0xFE, 0x77, 0xF1, 0x47, 0x5C, 0xB1, 0xAB, 0xB2, 0x4F, 0xBD, 0xF0, 0x65, 0x5E, 0x8C,
-    0xAF, 0x5D, 0x07, 0x55, 0x3F, 0xAA, 0xA1, 0x1E, 0x30, 0xEC, 0x2B, 0xDF, 0x5A, 0xFC, 0x46, 0x3C,
-    0x06, 0x12, 0x53, 0x4C, 0x54, 0xFC, 0x60, 0xE7, 0x0C, 0x7B, 0xED, 0xDB, 0xEF, 0xDA, 0xB7, 0x3F,
-    0xB5, 0x6F, 0x7F, 0xC9, 0xE1, 0x07, 0x60, 0x0A, 0xFE, 0xBD, 0xA4, 0xBE, 0xAF, 0xFC, 0x44, 0xFE,
-    0x94, 0x8B, 0x89, 0x20, 0x3B, 0xC8, 0xDB, 0x07, 0x53, 0x27, 0xC6, 0xD1, 0x2F, 0x45, 0x93, 0xFD,
-    0xC1, 0x11, 0x87, 0xB3, 0xFF, 0x81, 0x57, 0xB8, 0x78, 0xBD, 0x69, 0x97, 0xD3, 0x88, 0x13, 0xC5,
-    0xFD, 0x9D, 0x0A, 0x1B, 0xFF, 0xA7, 0x96, 0xA4, 0xDF, 0x9D, 0x51, 0xA6, 0xD4, 0x0F, 0xED, 0xDB,
-    0x0F, 0x6C, 0x9D, 0xC4, 0x5D, 0x05, 0x44, 0x0D, 0x00, 0x24, 0xFA, 0x94, 0x5E, 0x85, 0xC0, 0x66,
-    0xFF, 0xA9, 0x59, 0x63, 0x57, 0xC0, 0xD2, 0x7E, 0xDC, 0x2A, 0x00, 0x88, 0x16, 0x00, 0xCD, 0x34,
-    0x4E, 0xE7, 0x9A, 0xDA, 0x6D, 0xFD, 0xED, 0xDA, 0x6B, 0xC2, 0x5F, 0x56, 0x40, 0xBA, 0x17, 0x99,
-    0xCC, 0x08, 0x8B, 0xE0, 0x06, 0x42, 0xA4, 0xF0, 0x4A, 0x8B, 0x60, 0xE9, 0x32, 0x9B, 0x1D, 0x18,
-    0x8E, 0x01, 0x20, 0x6A, 0x7A, 0xE6, 0xF4, 0x28, 0xF4, 0x26, 0xEF, 0x35, 0x3C, 0x59, 0x87, 0x1D,
-    0x96, 0x1A, 0xA6, 0x80, 0xB6, 0x70, 0x06, 0xA1, 0x24, 0x27, 0x30, 0xFA, 0x31, 0x77, 0xD5, 0x59,
-    0xF5, 0x1A, 0xBF, 0x76, 0xFB, 0xE3, 0x95, 0x14, 0x28, 0xFF, 0xC4, 0x46, 0x87, 0xFB, 0x56, 0x99,
-    0x32, 0x08, 0x25, 0xF8, 0x8D, 0x8A, 0xBB, 0x93, 0x2F, 0x52, 0x72, 0x85, 0x97, 0xCB, 0x3D, 0x49,
-    0xD2, 0xAF, 0xA6, 0x3D, 0x8B, 0x98, 0xDC, 0xBC, 0x70, 0x52, 0xC3, 0x79, 0xED, 0x7D, 0x21, 0xE1,
-    0xC3, 0x9C, 0x1F, 0xF3, 0xC3, 0xB3, 0x9C, 0x3C, 0xAC, 0xE9, 0x8E, 0x90, 0xBB, 0x8E, 0x4B, 0x1B,
-    0x76, 0xB3, 0xEC, 0x34, 0x0F, 0xB9, 0x35, 0xA0, 0x80, 0xD5, 0xB4, 0xDF, 0xEF, 0x8F, 0x68, 0x16,
-    0x0E, 0xEB, 0xDD, 0x19, 0xB8, 0xFF, 0x62, 0xEF, 0x25, 0xBE, 0x9B, 0x9E, 0x80, 0x4D, 0x05, 0xA8,
-    0x19, 0xD2, 0x0F, 0x3B, 0x0D, 0x2F, 0x30, 0xA6, 0x0C, 0x67, 0xAD, 0x9D, 0xED, 0xBC, 0xB5, 0x93,
-    0x5D, 0x6E, 0x7F, 0xDC, 0x7B, 0xAD, 0xE9, 0xFC, 0x3B, 0xFC, 0xA6, 0x61, 0xB0, 0x96, 0x85, 0x5B,
-    0x67, 0x10, 0xFC, 0x05, 0xC9, 0x3D, 0x5B, 0x32, 0x59, 0xB4, 0xEA, 0x65, 0x9E, 0xC6, 0x31, 0x87,
-    0x5A, 0x5B, 0xB4, 0x92, 0x44, 0x7B, 0xEB, 0x35, 0x5E, 0xEB, 0xD7, 0x87, 0x9A, 0xE0, 0x26, 0xE6,
-    0xB9, 0x63, 0x2A, 0x7A, 0xBE, 0x70, 0x03, 0x9E, 0xED, 0x02, 0x3B, 0xC6, 0xC2, 0x4C, 0x17, 0x4B,
-    0x77, 0x17, 0xAD, 0x94, 0x3A, 0x3D, 0x56, 0x28, 0x6C, 0xA2, 0x65, 0x77, 0xEB, 0x68, 0xFF, 0x80,
-    0xD6, 0xD1, 0x5D, 0xB6, 0x6B, 0x46, 0xA7, 0x48, 0xFC, 0xDE, 0x64, 0xFC, 0xAB, 0x50, 0xEE, 0xAC,
-    0xE5, 0x2C, 0x7E, 0x4B, 0x0F, 0x9F, 0x7F, 0xE7, 0xE8, 0xA7, 0xCF, 0x91, 0x4C, 0x9D, 0xBB, 0xBB,
-    0xDA, 0x3F, 0x17, 0xE8, 0xC1, 0x4E, 0x48, 0xAA, 0x9C, 0x29, 0xF3, 0xE5, 0xAD, 0xD5, 0x07, 0xD3,
-    0xF3, 0x22, 0xE2, 0x4D, 0xDB, 0x79, 0x56, 0x4C, 0x6D, 0xA4, 0x7C, 0xC5, 0x92, 0x6E, 0x67, 0xC0,
-    0x51, 0xDE, 0xDD, 0x12, 0x5B, 0x7C, 0x86, 0xE3, 0x10, 0x90, 0x27, 0x69, 0xC9, 0x65, 0x81, 0xB0,
-    0x4E, 0x6B, 0x39, 0x6A, 0x51, 0x06, 0x08, 0x26, 0x7C, 0x20, 0x3E, 0xBC, 0x32, 0xBF, 0xD1, 0x09,
-    0x4D, 0xAE, 0xB4, 0x0F, 0x54, 0x0E, 0x0C, 0xA3, 0x27, 0x8D, 0x00, 0xF3, 0x3A, 0x84, 0xB3, 0xB6,
-    0xA6, 0xE6, 0xBC, 0x39, 0xB6, 0x50, 0xC7, 0x58, 0x11, 0x79, 0x8D, 0x18, 0x8B, 0xBC, 0x3F, 0x48,
-    0xF6, 0x83, 0x0E, 0x94, 0x45, 0xA6, 0x74, 0x21, 0x23, 0xBB, 0x27, 0xE8, 0xC6, 0x9A, 0x07, 0x42,
-    0xCD, 0xC9, 0x51, 0xEB, 0x24, 0xCE, 0xE4, 0xF0, 0x02, 0xCB, 0xA6, 0xEC, 0xC9, 0x60, 0x23, 0x3F,
-    0x10, 0x10, 0x09, 0x0F, 0xEA, 0x9C, 0xF7, 0xF0, 0x1A, 0x43, 0x56, 0x79, 0xDD, 0x90, 0x0A, 0x16,
-    0x19, 0x6C, 0x77, 0x93, 0x64, 0x71, 0x3D, 0xFB, 0x16, 0xDC, 0xDE, 0x92, 0xBC, 0xCA, 0x95, 0x76,
-    0x90, 0xEA, 0x7B, 0x23, 0x41, 0xA4, 0x5F, 0xB3, 0x8B, 0x9F, 0x41, 0x54, 0xA1, 0x58, 0x6D, 0x8D,
-    0x7B, 0x3A, 0xE5, 0x32, 0x64, 0xF3, 0x55, 0x54, 0x86, 0x3B, 0xDA, 0x77, 0x6C, 0xD3, 0x97, 0xC8,
-    0xCD, 0x2C, 0x7C, 0x5B, 0x40, 0xD9, 0x63, 0x43, 0x80, 0x4F, 0x6D, 0x66, 0x48, 0x59, 0x20, 0x88,
-    0x67, 0x36, 0xBB, 0x67, 0x0C, 0x1B, 0x95, 0x3D, 0xED, 0x62, 0xF8, 0x9E, 0xA4, 0x9D, 0x6C, 0x34,
-    0x38, 0xBD, 0xC5, 0xD7, 0xB7, 0x28, 0xBF, 0x88, 0x9A, 0xA9, 0xE8, 0xE6, 0x10, 0xF3, 0x46, 0x7F,
-    0x82, 0x08, 0x0F, 0xBE, 0x5B, 0x1A, 0x02, 0xF0, 0x06, 0xF3, 0xE1, 0x8F, 0x30, 0x79, 0x44, 0xC9,
-    0x3B, 0xFB, 0x8B, 0x2C, 0x65, 0xB6, 0x1F, 0xED, 0xD1, 0x75, 0xE7, 0x12, 0x89, 0xC4, 0x16, 0x24,
-    0x3A, 0xA9, 0xD4, 0x1F, 0x58, 0x5E, 0xFA, 0xBC, 0x4D, 0x09, 0xFF, 0x2E, 0x26, 0xFC, 0xAF, 0xD4,
-    0xDE, 0x75, 0x66, 0xB6, 0xC2, 0x66, 0xCC, 0xD0, 0x09, 0x00, 0xE6, 0xB5, 0x00, 0xDA, 0x0E, 0x30,
-    0x1A, 0x96, 0x04, 0x64, 0x89, 0xA0, 0xA2, 0xC0, 0xD5, 0x6C, 0x64, 0xDE, 0x66, 0x6A, 0x40, 0x00,
-    0x06, 0x87, 0xF0, 0x36, 0x43, 0x9A, 0x2B, 0x04, 0x32, 0xBF, 0xEA, 0xC7, 0x3E, 0x59, 0xC0, 0x31,
-    0xC1, 0xD3, 0x94, 0x25, 0x32, 0x2B, 0x89, 0x17, 0x5B, 0xD9, 0xC6, 0x7D, 0x13, 0xDE, 0x8C, 0x7B,
-    0xA6, 0x1C, 0x26, 0xB3, 0xBB, 0xB0, 0x61, 0x27, 0x90, 0xDF, 0xD8, 0x64, 0x36, 0x1B, 0xF4, 0x98,
-    0xCC, 0x0E, 0x59, 0x57, 0x99, 0x92, 0xD9, 0xE7, 0x98, 0xCC, 0x06, 0x66, 0x4C, 0xB0, 0x06, 0xB6,
-    0x08, 0x4B, 0xA1, 0x2A, 0x1C, 0x6D, 0xB2, 0xF4, 0x5B, 0x12, 0xCF, 0x60, 0x4B, 0xCD, 0x1E, 0xF6,
-    0x0D, 0x7D, 0x9B, 0xF8, 0x45, 0xB3, 0xED, 0x48, 0xD7, 0x8B, 0x6B, 0xD8, 0x9A, 0xAF, 0x81, 0x5B,
-    0x70, 0x8B, 0x6B, 0xB8, 0xC5, 0x35, 0x5C, 0x21, 0x2E, 0xBB, 0xC4, 0x35, 0x9C, 0x67, 0xFC, 0x71,
-    0xC1, 0xB6, 0xF9, 0x96, 0xB6, 0x11, 0xD4, 0x3D, 0xB5, 0x74, 0xCA, 0xDB, 0x3C, 0x5C, 0xFB, 0xB7,
-    0x4D, 0x11, 0xDC, 0x02, 0xC2, 0xBF, 0xDD, 0xAB, 0xF0, 0x7A, 0x63, 0xD3, 0xED, 0x90, 0xA9, 0xF8,
-    0x32, 0xA3, 0x48, 0x68, 0xFB, 0x19, 0x04, 0x1B, 0x29, 0x7C, 0xD4, 0x9F, 0xDB, 0x10, 0x87, 0x4D,
-    0x77, 0x6C, 0x69, 0x62, 0xB2, 0xF1, 0x7D, 0x5C, 0x62, 0x2E, 0xD0, 0x43, 0x5C, 0x26, 0x45, 0x7A,
-    0x27, 0x45, 0xED, 0xC4, 0xD5, 0x39, 0x45, 0x1F, 0x0D, 0x33, 0xAE, 0xE6, 0xC2, 0x55, 0x69, 0x20,
-    0x2E, 0x6D, 0xF7, 0xF1, 0xDC, 0xEF, 0xF4, 0xE2, 0x7B, 0x96, 0x86, 0xA3, 0xEC, 0x90, 0xFF, 0x1C,
-    0xBC, 0x1C, 0x46, 0x5D, 0xCF, 0x33, 0xE2, 0xBE, 0x22, 0x27, 0x95, 0x86, 0x99, 0xF2, 0x63, 0x83,
-    0x4F, 0xBE, 0x71, 0xD9, 0xBD, 0x74, 0xCB, 0xE3, 0xEE, 0xDE, 0x30, 0xD8, 0x14, 0xF2, 0xC8, 0x3C,
-    0xB6, 0x50, 0x86, 0x37, 0xA5, 0x71, 0xC9, 0xCC, 0x1A, 0xA5, 0xE7, 0x3D, 0xD2, 0xB1, 0x50, 0x59,
-    0xAB, 0xFD, 0x6B, 0xD9, 0xC1, 0x2C, 0x66, 0x8B, 0x9B, 0x36, 0x27, 0x78, 0xE6, 0xE7, 0x55, 0xCC,
-    0x90, 0xF2, 0xA0, 0x50, 0x4E, 0xE4, 0x6A, 0x6C, 0x5D, 0x97, 0xD9, 0x54, 0x43, 0x0D, 0xC2, 0x04,
-    0x23, 0x63, 0x98, 0x56, 0x93, 0x86, 0xF7, 0xC6, 0x97, 0x76, 0xB7, 0x90, 0x9D, 0xC9, 0xD8, 0x8D,
-    0x59, 0x67, 0xB2, 0x64, 0x79, 0xA4, 0x91, 0xDF, 0xB6, 0x27, 0xDF, 0xAF, 0x33, 0x79, 0xA1, 0x3D,
-    0xB9, 0x60, 0x4F, 0x38, 0xCC, 0x00, 0x50, 0x45, 0x60, 0x2A, 0xE6, 0xA9, 0xCB, 0xFB, 0xE4, 0x76,
-    0xC6, 0xB0, 0xD3, 0xCA, 0xA6, 0xF5, 0x7E, 0x3E, 0x9B, 0xFF, 0xD8, 0x72, 0xB2, 0x79, 0x9C, 0x7E,
-    0x94, 0xFE, 0xAF, 0x8C, 0xAE, 0x2D, 0x2F, 0xA2, 0x87, 0x5E, 0x27, 0x29, 0x23, 0xF0, 0x6E, 0x87,
-    0xCF, 0x93, 0xC2, 0x82, 0x3D, 0xD8, 0x61, 0x64, 0x11, 0x46, 0xFA, 0xAB, 0x8D, 0x2C, 0xE3, 0x03,
-    0x25, 0xEB, 0x98, 0x4E, 0x24, 0x70, 0x25, 0xF6, 0x24, 0x88, 0x5D, 0x8B, 0x5D, 0x8C, 0x5D, 0x8D,
-    0x5D, 0xC9, 0x38, 0xCE, 0x1A, 0x0A, 0xD9, 0xA8, 0xC0, 0x6E, 0x52, 0xDB, 0x6D, 0x8D, 0x49, 0x24,
-    0x9B, 0x7A, 0xDA, 0x5D, 0x3B, 0x3D, 0xE6, 0xBE, 0xB1, 0x67, 0x24, 0x9D, 0x89, 0xC3, 0x5A, 0x05,
-    0xEC, 0x4E, 0x0F, 0xE7, 0x2D, 0x71, 0xD7, 0x98, 0xA4, 0x58, 0xEC, 0x4E, 0x67, 0x43, 0x09, 0x83,
-    0xE1, 0x24, 0x9D, 0x3A, 0xAA, 0xC7, 0x83, 0x0A, 0x32, 0xC2, 0x47, 0x61, 0x87, 0x9C, 0xEE, 0xAE,
-    0x73, 0x56, 0xEC, 0x76, 0xA5, 0x46, 0x9B, 0x21, 0x09, 0x98, 0xB4, 0xAE, 0x42, 0x1E, 0xD9, 0x6A,
-    0xE4, 0x9C, 0x55, 0xC7, 0x73, 0x56, 0x5E, 0xCF, 0x92, 0x9C, 0x33, 0xC0, 0x18, 0xD7, 0x6C, 0x26,
-    0x0E, 0x38, 0x52, 0xB1, 0x06, 0x50, 0x5C, 0xD9, 0x7C, 0x83, 0xB5, 0xE9, 0x62, 0xCE, 0x12, 0x39,
-    0x4C, 0x63, 0xE3, 0x40, 0xE9, 0xDC, 0xB0, 0x21, 0xF8, 0xE8, 0xCF, 0x4E, 0xD9, 0x56, 0x7B, 0xDB,
-    0x6F, 0xDF, 0x04, 0x63, 0xBF, 0xBD, 0x54, 0xF0, 0x58, 0x95, 0xC8, 0x38, 0xC0, 0x4F, 0xC6, 0x2C,
-    0xE6, 0xEB, 0xF3, 0x10, 0x61, 0xFD, 0xCA, 0x20, 0x55, 0x3B, 0x09, 0xD6, 0x6C, 0x53, 0xCB, 0x68,
-    0x94, 0x78, 0xCF, 0x3D, 0x4C, 0xCD, 0x30, 0xDD, 0x69, 0x33, 0xC3, 0xB3, 0x42, 0xFA, 0x18, 0x92,
-    0x49, 0xD3, 0x3A, 0xB3, 0x65, 0x5C, 0xE8, 0x20, 0x99, 0x99, 0x00, 0x51, 0x49, 0xAD, 0xE1, 0x37,
-    0x4B, 0x16, 0x1D, 0xCE, 0x76, 0xA9, 0xD2, 0x27, 0x5B, 0xCD, 0xBC, 0x4C, 0x8A, 0xA1, 0x96, 0x01,
-    0x60, 0xF5, 0xB9, 0x1B, 0x40, 0xBB, 0x27, 0xA1, 0x29, 0xFA, 0x7D, 0x9B, 0x78, 0x29, 0xB8, 0x9F,
-    0xFD, 0x94, 0xEA, 0xF1, 0xBB, 0xC5, 0xEC, 0x5B, 0x25, 0xE2, 0x11, 0xD7, 0x4F, 0x62, 0x42, 0x68,
-    0xE5, 0x61, 0xE8, 0x4C, 0x74, 0xB9, 0x30, 0xF1, 0x6B, 0x78, 0x1D, 0xC6, 0xEB, 0x78, 0x96, 0x47,
-    0xF8, 0xFB, 0x06, 0xD1, 0xE2, 0x90, 0x05, 0xB2, 0x29, 0x71, 0xF6, 0x70, 0x61, 0xE3, 0xAE, 0x9E,
-    0xF2, 0xA0, 0xB0, 0x87, 0xC2, 0x58, 0xF1, 0x7E, 0xA1, 0xB2, 0xD1, 0xCA, 0x54, 0x02, 0x99, 0x42,
-    0xC7, 0xF8, 0x5E, 0xA1, 0x63, 0x9E, 0x24, 0x29, 0x0B, 0xDA, 0x25, 0x33, 0x37, 0x8D, 0x1C, 0x7E,
-    0xFD, 0xB1, 0xDA, 0xDB, 0x31, 0xEF, 0x15, 0x55, 0x0F, 0xDB, 0xAA, 0x1E, 0x4A, 0xAE, 0xB6, 0xB0,
-    0x67, 0x2B, 0x77, 0x55, 0x8C, 0xD5, 0x28, 0x15, 0xAC, 0x57, 0xAD, 0x8F, 0x0D, 0x4F, 0xDE, 0xD8,
-    0xF0, 0x14, 0xC1, 0xBD, 0x07, 0x1D, 0x01, 0x13, 0xBB, 0x75, 0x23, 0xB6, 0x3D, 0x95, 0xF6, 0x20,
-    0xDE, 0x3D, 0xFA, 0x57, 0xA4, 0x5F, 0x33, 0xAD, 0x29, 0x20, 0x69, 0x4D, 0xF8, 0x13, 0x2F, 0x24,
-    0x81, 0x25, 0xF3, 0x63, 0xED, 0x84, 0x35, 0x14, 0xD2, 0x1E, 0xC5, 0x2E, 0x6C, 0xF6, 0x32, 0xA6,
-    0x85, 0xF4, 0x8D, 0x9D, 0x05, 0x4C, 0xB9, 0x04, 0xE3, 0x7E, 0xB9, 0x96, 0x8D, 0x24, 0x27, 0xE8,
-    0x9D, 0x99, 0xB3, 0xBA, 0xEF, 0xCA, 0x2A, 0xA6, 0x11, 0x0F, 0xB2, 0x53, 0x2D, 0xE3, 0x3D, 0x53,
-    0x84, 0x1C, 0xBB, 0xD3, 0x88, 0xF1, 0x98, 0x46, 0x8C, 0xC6, 0xB4, 0x64, 0xD8, 0xEE, 0x82, 0xB5,
-    0xD3, 0x26, 0x8F, 0x1B, 0x2D, 0x1D, 0xC8, 0x7E, 0xE3, 0xB2, 0x81, 0xDA, 0xEF, 0x6C, 0x9B, 0xAD,
-    0xCB, 0xE4, 0x21, 0xFC, 0x60, 0x66, 0xCD, 0xAC, 0x12, 0xE9, 0x93, 0x4E, 0xD9, 0x74, 0xEA, 0xDE,
-    0xDF, 0x9B, 0x7E, 0x40, 0xB8, 0x3A, 0x95, 0xAF, 0x0E, 0x9A, 0xB5, 0xC5, 0x56, 0x74, 0x19, 0x96,
-    0x56, 0xDD, 0xD3, 0x41, 0xED, 0x23, 0x08, 0x08, 0x6B, 0xBF, 0x8E, 0x2A, 0x0F, 0x00, 0xCD, 0x6B,
-    0x60, 0x79, 0x01, 0xDB, 0xBC, 0xCD, 0x5E, 0xB9, 0xBF, 0xE9, 0xA4, 0xB0, 0xE0, 0x40, 0x1A, 0x1D,
-    0x31, 0x19, 0xD2, 0x01, 0x3C, 0x3F, 0x87, 0xCB, 0xAE, 0xBA, 0x85, 0x7D, 0xDE, 0xD1, 0x9F, 0x2F,
-    0x87, 0xA6, 0xD2, 0xB1, 0x3F, 0xDF, 0xBF, 0xF5, 0xC0, 0xFE, 0x7C, 0xC9, 0xF0, 0xB1, 0x39, 0x6B,
-    0xEC, 0xCF, 0x6F, 0xD8, 0x9F, 0x6F, 0xAA, 0xA8, 0x96, 0xC6, 0x1D, 0x9B, 0xA4, 0xBC, 0x3B, 0x57,
-    0x3F, 0xCB, 0xA6, 0xC3, 0x38, 0xBE, 0xE1, 0xD0, 0xC3, 0xF1, 0xF2, 0x5C, 0x7A, 0x31, 0xE0, 0x5C,
-    0x47, 0xF6, 0xC6, 0x8D, 0xB4, 0x20, 0x38, 0x86, 0xAC, 0x1B, 0x48, 0x0E, 0x78, 0x97, 0xB6, 0x79,
-    0xA6, 0xE7, 0x86, 0x7C, 0xB6, 0x77, 0x61, 0x09, 0xB9, 0x3E, 0x54, 0x43, 0xB0, 0x0F, 0xD7, 0x90,
-    0xEC, 0xB0, 0x82, 0x68, 0x3F, 0xE8, 0x04, 0xCD, 0xFC, 0x74, 0x40, 0xA3, 0x78, 0x06, 0x45, 0xF5,
-    0xB6, 0x49, 0x1C, 0xC6, 0xB2, 0x97, 0x62, 0xA4, 0x24, 0xE3, 0x98, 0x4F, 0x34, 0xF7, 0x70, 0x47,
-    0xF9, 0x42, 0x82, 0xF6, 0xE0, 0xDA, 0xCF, 0x4E, 0xE7, 0xE6, 0x66, 0x97, 0x9B, 0x5B, 0x63, 0x78,
-    0x36, 0x73, 0x4F, 0xB6, 0x2B, 0xB2, 0x8A, 0xF0, 0xD2, 0x08, 0x36, 0x73, 0x76, 0x48, 0x03, 0x15,
-    0x5E, 0x6C, 0xBD, 0x41, 0xFA, 0xBA, 0x17, 0xAA, 0xDD, 0x16, 0x40, 0x45, 0xA5, 0xDB, 0x46, 0xC5,
-    0x74, 0xBE, 0xC0, 0xA7, 0x73, 0xE4, 0xF9, 0x82, 0x3A, 0x97, 0x92, 0x2B, 0x7B, 0x38, 0x53, 0xD1,
-    0x5D, 0x56, 0xA2, 0xC2, 0x21, 0xDD, 0xA5, 0x84, 0x04, 0xF2, 0xC6, 0x32, 0xEC, 0x9E, 0x32, 0xCE,
-    0x6C, 0xD9, 0x41, 0x39, 0xC7, 0x91, 0x8E, 0x27, 0x7D, 0x0D, 0xA4, 0x9C, 0x08, 0xD3, 0x1C, 0xEA,
-    0x24, 0x1C, 0x48, 0xB7, 0x5B, 0x75, 0xE0, 0x9F, 0xA7, 0x4B, 0xA5, 0xAC, 0x95, 0x49, 0x55, 0x48,
-    0xEA, 0x3E, 0xE9, 0xB8, 0x72, 0xAB, 0xEC, 0xA0, 0xB5, 0x8B, 0xED, 0x59, 0x08, 0x06, 0x40, 0x8D,
-    0xD0, 0x7A, 0x08, 0xB4, 0x1E, 0x06, 0xAD, 0x5F, 0x01, 0xAD, 0xFF, 0x36, 0xA7, 0x35, 0x22, 0xAD,
-    0x2F, 0x81, 0xD6, 0x1F, 0xE2, 0xFA, 0x37, 0x41, 0x6B, 0x3D, 0x37, 0x3A, 0x96, 0x26, 0x3D, 0xA7,
-    0xEA, 0xCF, 0x8C, 0x1A, 0xFE, 0x02, 0x90, 0x2D, 0xB7, 0x3D, 0x02, 0x6C, 0x36, 0x09, 0xAE, 0x80,
-    0x26, 0x68, 0xB4, 0x73, 0x1E, 0x32, 0x7D, 0x68, 0x5C, 0xD2, 0x62, 0xDF, 0xFD, 0xA2, 0xFD, 0xEA,
-    0x73, 0x1E, 0x00, 0xEE, 0x7C, 0xF2, 0xBA, 0xF7, 0x7B, 0x6E, 0x2B, 0x8F, 0x17, 0xD1, 0x59, 0xDB,
-    0x36, 0x2B, 0xCF, 0xD2, 0xCB, 0xE4, 0x2B, 0xDD, 0xDE, 0xAE, 0xFE, 0x7D, 0x1B, 0xF8, 0xBD, 0xCC,
-    0x6A, 0xBB, 0xC4, 0x08, 0x2C, 0xB8, 0xB3, 0xDE, 0x6E, 0x4F, 0x61, 0x86, 0xE5, 0x7D, 0xFA, 0x1B,
-    0x84, 0xFA, 0xF1, 0xDF, 0x12, 0xE5, 0x3E, 0x36, 0x8D, 0x8D, 0xB1, 0x3C, 0xF3, 0x6C, 0xBF, 0xD7,
-    0xEF, 0xA0, 0xF4, 0x87, 0x41, 0x8A, 0x8E, 0x2A, 0xBF, 0xD3, 0xE6, 0x13, 0xD3, 0xB2, 0x40, 0x44,
-    0xE8, 0x42, 0x28, 0xF6, 0x41, 0x32, 0x69, 0xC7, 0x4C, 0xDA, 0xE2, 0xDA, 0x4D, 0x08, 0x0D, 0x32,
-    0x39, 0x41, 0x60, 0xBB, 0x1C, 0x77, 0x55, 0x88, 0x86, 0x6F, 0xE8, 0x32, 0x7F, 0x3B, 0x4D, 0xCC,
-    0xDB, 0xB9, 0x3B, 0x80, 0xD7, 0x98, 0xD7, 0x54, 0x4B, 0xE6, 0x94, 0xF5, 0xA7, 0x46, 0x3D, 0xA9,
-    0xCC, 0x27, 0xB6, 0xC9, 0x2C, 0x34, 0x2B, 0x0B, 0x8E, 0xF4, 0xF1, 0xD1, 0x77, 0x2F, 0x15, 0x99,
-    0xFB, 0xF0, 0x2F, 0x48, 0xB8, 0xB7, 0x5B, 0xDF, 0xE9, 0x0B, 0x07, 0xF9, 0xBF, 0xDD, 0xD1, 0x7D,
-    0x6B, 0x5B, 0xA2, 0x16, 0x0E, 0xE9, 0xDB, 0x44, 0x4E, 0xC4, 0xB3, 0x27, 0x49, 0x2E, 0xEE, 0xF3,
-    0xA8, 0x23, 0x4E, 0xB4, 0x0B, 0xC4, 0x9B, 0xAC, 0x2F, 0x5B, 0x17, 0x62, 0x55, 0x79, 0xE9, 0xD4,
-    0x42, 0x96, 0xF0, 0xB7, 0x7B, 0x88, 0xD4, 0x49, 0x24, 0x0D, 0xE9, 0x57, 0x5A, 0xD0, 0xD8, 0xA6,
-    0xED, 0x4C, 0x1C, 0xAB, 0x2D, 0xCB, 0xF3, 0xBD, 0xFC, 0xD2, 0xDA, 0xEC, 0x3F, 0x7B, 0x48, 0x2A,
-    0xA7, 0x36, 0x6D, 0x7B, 0x01, 0x8B, 0xE3, 0xCB, 0xAC, 0xB4, 0xFB, 0x33, 0xD8, 0x2F, 0x87, 0x7E,
-    0xDD, 0xC5, 0x78, 0x61, 0x84, 0x99, 0x12, 0xF9, 0x6A, 0x69, 0x04, 0x28, 0x2C, 0xC0, 0x53, 0xB3,
-    0x9A, 0xE8, 0xBD, 0xE2, 0xD2, 0x70, 0x16, 0x4B, 0xF5, 0x82, 0x9C, 0xE2, 0x0F, 0xCC, 0xA8, 0x90,
-    0x31, 0x93, 0x94, 0x45, 0xBA, 0x70, 0x8E, 0xCF, 0x71, 0x98, 0x87, 0x19, 0x24, 0x66, 0x9A, 0x1D,
-    0x6E, 0x90, 0x73, 0x34, 0xD2, 0x76, 0xE0, 0x4A, 0xEF, 0x41, 0x0F, 0x38, 0xEE, 0xB1, 0xFF, 0xCC,
-    0x67, 0x11, 0x80, 0x5B, 0xCD, 0x92, 0x76, 0xC1, 0xD3, 0x3F, 0x12, 0x4A, 0x8D, 0xC7, 0x54, 0x08,
-    0x59, 0x6D, 0x57, 0xF9, 0xC0, 0x03, 0x52, 0xBD, 0x33, 0x1C, 0xCD, 0x5B, 0x98, 0x5C, 0x3E, 0x18,
-    0xA1, 0x61, 0xCA, 0xE7, 0x3E, 0x29, 0x50, 0x67, 0xAE, 0xBE, 0x77, 0xA6, 0xD3, 0x2D, 0x74, 0xFE,
-    0xF1, 0x47, 0x3C, 0xE2, 0xC2, 0xAE, 0x08, 0xB6, 0x1A, 0x28, 0xC3, 0xB3, 0x7E, 0x2C, 0x92, 0xBB,
-    0x9D, 0xCF, 0xDE, 0x0A, 0x22, 0x6A, 0x0A, 0x48, 0x5E, 0x87, 0x5B, 0x09, 0x2B, 0x44, 0x3C, 0x9F,
-    0x29, 0xE2, 0xDA, 0x4F, 0x79, 0x0E, 0x6F, 0x9E, 0x79, 0xAD, 0xEE, 0x0A, 0xCF, 0x98, 0x4C, 0xA2,
-    0xEF, 0x9B, 0x9D, 0xBF, 0xBC, 0x4F, 0x78, 0xB6, 0x78, 0xFE, 0x72, 0x1E, 0x9E, 0x8D, 0x07, 0x47,
-    0xC5, 0x4C, 0x8E, 0x3E, 0x84, 0xF0, 0x85, 0x39, 0x7F, 0x1E, 0xC7, 0x92, 0x67, 0x91, 0xCC, 0x8F,
-    0xAF, 0x2C, 0xC6, 0x68, 0xED, 0x67, 0x88, 0xD1, 0xB2, 0xA9, 0x2D, 0x6C, 0xB2, 0xBF, 0x8E, 0xDF,
-    0x8B, 0x81, 0xF0, 0x64, 0x53, 0x66, 0x8F, 0xEF, 0x78, 0x34, 0xF1, 0xE6, 0x9D, 0x23, 0xB3, 0x78,
-    0xB3, 0x64, 0xBC, 0x39, 0xF3, 0xE8, 0xF9, 0x64, 0xA4, 0x24, 0x2B, 0x32, 0x45, 0x02, 0x9F, 0x33,
-    0xDE, 0x1C, 0xE6, 0xF1, 0xA6, 0x37, 0xB9, 0xDD, 0x29, 0x3B, 0x99, 0x7D, 0xAA, 0x5B, 0xCF, 0x1E,
-    0xE0, 0xD6, 0xD9, 0x4A, 0xCD, 0x88, 0xCB, 0xF4, 0x77, 0xC3, 0xF4, 0x76, 0x2A, 0x82, 0x7D, 0x76,
-    0xB7, 0xEE, 0xCA, 0x61, 0xCD, 0x5A, 0xE0, 0xDC, 0x6E, 0xA3, 0x2A, 0xE0, 0x3A, 0x2F, 0xA9, 0x86,
-    0xEC, 0x46, 0xB1, 0x67, 0x9D, 0x2B, 0x87, 0x7D, 0xDE, 0x3C, 0xEE, 0xCC, 0x23, 0xE0, 0xDB, 0x55,
-    0x20, 0xA7, 0x9C, 0x79, 0xD6, 0xF9, 0x56, 0x1D, 0xA7, 0x3C, 0xE5, 0xAC, 0x75, 0x12, 0xDC, 0xAA,
-    0xDF, 0x5E, 0x3C, 0xE5, 0xBC, 0xAE, 0xC2, 0x73, 0xB7, 0xAB, 0x41, 0x45, 0x67, 0x4D, 0xD1, 0xCB,
-    0x29, 0xE7, 0xFE, 0x88, 0x3E, 0x61, 0x20, 0x2A, 0xFA, 0xD9, 0x01, 0xB7, 0xD7, 0x3C, 0x50, 0x5E,
-    0xCD, 0xA1, 0xBC, 0xCD, 0x24, 0x2F, 0x34, 0x9E, 0x7B, 0xF3, 0x18, 0x33, 0xD9, 0x77, 0x9A, 0x90,
-    0x33, 0xA6, 0x5C, 0x64, 0x5A, 0xC6, 0x9C, 0xED, 0x73, 0x19, 0xE4, 0x2E, 0xD8, 0x38, 0xBB, 0x0D,
-    0x1B, 0x70, 0xF9, 0xDC, 0x6D, 0x8C, 0x17, 0x2F, 0xFC, 0xB2, 0x52, 0xD1, 0xC5, 0x8B, 0x17, 0x01,
-    0xD5, 0x2F, 0x6E, 0x1C, 0xC6, 0xF8, 0x13, 0x83, 0xE9, 0xF5, 0xA1, 0x3E, 0xFE, 0x44, 0xE9, 0xA0,
-    0x05, 0xB0, 0x4C, 0x83, 0x5A, 0xBA, 0xC6, 0xC6, 0x0C, 0xA1, 0x4D, 0x09, 0x8E, 0xAD, 0x26, 0xE5,
-    0x14, 0x53, 0x7C, 0x41, 0xDF, 0xF2, 0x14, 0x5D, 0xCB, 0x3B, 0xEC, 0xE5, 0x4C, 0x97, 0xE5, 0x99,
-    0x04, 0xC9, 0xA2, 0x4B, 0xD9, 0xFD, 0x48, 0x8A, 0x76, 0x7A, 0x24, 0xC5, 0xE6, 0x8E, 0x47, 0x52,
-    0xC4, 0x45, 0xF7, 0x19, 0x1F, 0x49, 0x91, 0x8F, 0x8F, 0xA4, 0xE0, 0x6D, 0xE9, 0xCE, 0xD6, 0xB9,
-    0x54, 0xA6, 0x29, 0x46, 0xA1, 0x78, 0xF9, 0x3B, 0x2B, 0x9E, 0xB9, 0x2C, 0xCF, 0x4F, 0x89, 0x1A,
-    0xDA, 0x46, 0x56, 0xD5, 0xD9, 0x93, 0x30, 0x1D, 0x62, 0x1B, 0x44, 0x4E, 0xCC, 0xF8, 0xC8, 0x1C,
-    0x3D, 0x60, 0x31, 0x9B, 0x93, 0xC5, 0xFD, 0x6A, 0x40, 0x87, 0xCF, 0xBD, 0xD1, 0x2C, 0x3F, 0x3D,
-    0xB5, 0xF7, 0xB1, 0x2F, 0xE3, 0xE9, 0xFD, 0x70, 0xC7, 0xE0, 0xF3, 0xBA, 0x9E, 0xDF, 0xEE, 0xA1,
-    0x96, 0xE0, 0x58, 0x87, 0xEC, 0xD9, 0x37, 0xDB, 0xF2, 0xA6, 0xA2, 0xEB, 0x9B, 0x2C, 0x26, 0xEB,
-    0x0B, 0xB2, 0xE5, 0x2C, 0x41, 0xD3, 0x32, 0x8B, 0x61, 0xF3, 0xBA, 0x48, 0x7C, 0x57, 0x13, 0xCB,
-    0x33, 0x07, 0x6A, 0x79, 0xD3, 0xD7, 0xD2, 0x0F, 0x8E, 0x28, 0xDB, 0xBF, 0x26, 0xBE, 0x3D, 0x99,
-    0xFB, 0xF6, 0x56, 0xAC, 0x56, 0x68, 0xAB, 0x06, 0xCC, 0x75, 0xB2, 0xC2, 0x50, 0x38, 0x92, 0x29,
-    0x49, 0xBF, 0xF3, 0x02, 0x5B, 0xD4, 0x2F, 0x4B, 0x42, 0x50, 0x5A, 0x1B, 0x6B, 0x63, 0xDB, 0x5E,
-    0x6C, 0x84, 0xF9, 0x8C, 0x9C, 0xBD, 0xE5, 0xA9, 0x00, 0x69, 0xC4, 0x82, 0xCA, 0xFE, 0x4C, 0xC9,
-    0x5A, 0xE8, 0x01, 0x88, 0x7F, 0x60, 0x0E, 0x88, 0x80, 0x06, 0xE9, 0x27, 0xDB, 0xBC, 0x3D, 0x6F,
-    0xE0, 0xE4, 0x63, 0x5C, 0xF8, 0x14, 0x97, 0xF0, 0xC3, 0x46, 0x7A, 0xDD, 0xA7, 0x47, 0xB8, 0xD8,
-    0x27, 0x93, 0xDC, 0xBB, 0x9C, 0xB3, 0xE3, 0xE9, 0x19, 0xC7, 0xEE, 0x8E, 0x59, 0x47, 0x94, 0x2D,
-    0x6D, 0xDD, 0x14, 0xA7, 0x77, 0x66, 0xE2, 0x94, 0xCC, 0xC4, 0x29, 0xBE, 0x8A, 0x85, 0xF7, 0x32,
-    0x47, 0x54, 0xC9, 0xB9, 0x2E, 0x25, 0xAB, 0xC0, 0xDF, 0xA4, 0x8B, 0xE5, 0x67, 0xD6, 0x88, 0xE7,
-    0xA0, 0x3D, 0xFD, 0xA4, 0x91, 0xE3, 0x03, 0xC1, 0xE2, 0xD9, 0xC4, 0x65, 0x39, 0xD6, 0x5B, 0xC9,
-    0x09, 0x56, 0xC1, 0x15, 0x2C, 0xF0, 0x4C, 0x7D, 0xFF, 0xBF, 0x47, 0x2D, 0x62, 0x57, 0x5F, 0x1F,
-    0x9A, 0xEB, 0xBD, 0xAE, 0xD8, 0x7E, 0x0A, 0x7D, 0xCD, 0x22, 0xB6, 0xAF, 0x94, 0x7C, 0x2A, 0x49,
-    0x24, 0xC2, 0x33, 0x1D, 0x3D, 0x80, 0xE9, 0xC2, 0x7D, 0xB9, 0xA6, 0x25, 0xE9, 0x97, 0xB1, 0x51,
-    0xB7, 0xC3, 0x0E, 0x06, 0x7C, 0x57, 0x5F, 0xB3, 0xE7, 0x73, 0x24, 0x86, 0xFF, 0xD7, 0x4E, 0x70,
-    0xE4, 0xEC, 0x7C, 0xA6, 0x5B, 0xBE, 0xA5, 0xBC, 0x9B, 0xB0, 0x1F, 0x78, 0x49, 0x35, 0xFA, 0x11,
-    0xD3, 0xF6, 0x34, 0x34, 0x27, 0x1D, 0x8F, 0x59, 0x4C, 0x72, 0xFC, 0x30, 0xF4, 0x62, 0x46, 0x7B,
-    0x58, 0x23, 0xB7, 0x0F, 0x6A, 0x59, 0x17, 0x44, 0xB8, 0xA0, 0x91, 0xBF, 0x7D, 0xAC, 0xBA, 0xFA,
-    0xEF, 0xD6, 0x96, 0x5A, 0x93, 0x5A, 0x5B, 0x07, 0x7A, 0xE4, 0xC8, 0x6F, 0x01, 0xA4, 0x06, 0xCF,
-    0x66, 0x2A, 0xBA, 0x00, 0x27, 0x70, 0xA1, 0x54, 0x7B, 0x2D, 0xD2, 0x7F, 0xA4, 0x0F, 0x63, 0xF9,
-    0xFA, 0x57, 0xED, 0x06, 0xF4, 0x34, 0x52, 0x4F, 0x4D, 0xA5, 0x1E, 0xC9, 0xF9, 0x07, 0xEC, 0xD9,
-    0x99, 0xE2, 0xC8, 0xEF, 0xDA, 0x73, 0x32, 0x14, 0x0A, 0x96, 0x7C, 0xA6, 0x9C, 0xDA, 0x3A, 0xFC,
-    0x56, 0x2E, 0x75, 0xCC, 0x11, 0xDB, 0xD8, 0x5C, 0x4C, 0x27, 0x82, 0x77, 0x2C, 0xAD, 0x24, 0x27,
-    0x48, 0xD9, 0x23, 0x18, 0x66, 0x2A, 0x88, 0xC7, 0xDB, 0xE4, 0xCB, 0xCC, 0x11, 0xC6, 0xB3, 0x87,
-    0xF7, 0x7C, 0x0D, 0x00, 0x4C, 0x6F, 0xD8, 0x7A, 0x75, 0x3C, 0xD1, 0xF6, 0xE2, 0xDA, 0xE9, 0xD9,
-    0x5C, 0x92, 0x32, 0x63, 0x7A, 0x78, 0xB0, 0xE8, 0x9A, 0x97, 0xE9, 0xAB, 0x16, 0x4B, 0x1C, 0x9C,
-    0xE6, 0xD3, 0xC5, 0xE2, 0xB3, 0x2E, 0xBE, 0xE5, 0x9A, 0xF1, 0xDC, 0x0F, 0xB0, 0xC2, 0x44, 0x9F,
-    0x92, 0x43, 0x1F, 0xE4, 0x8E, 0x24, 0x15, 0x1E, 0xF3, 0x83, 0x61, 0x0E, 0xAE, 0xD9, 0x47, 0x5A,
-    0xE4, 0xE6, 0x0B, 0x74, 0x06, 0x00, 0x17, 0xC2, 0x0F, 0x45, 0xD3, 0x51, 0x08, 0xF5, 0xD6, 0xD7,
-    0xE9, 0xE4, 0x79, 0x50, 0xA3, 0x63, 0x43, 0xD7, 0x91, 0xA7, 0x1E, 0x3B, 0xF9, 0xD4, 0xD3, 0x54,
-    0x3C, 0xD8, 0x4C, 0xF3, 0x1F, 0x6A, 0x09, 0x4E, 0xF5, 0xD6, 0xE8, 0x57, 0xBD, 0x1B, 0x92, 0x88,
-    0x3F, 0xF2, 0x80, 0x06, 0x54, 0x3A, 0x23, 0xB6, 0x27, 0x26, 0xEC, 0x4D, 0x4C, 0xA6, 0x27, 0xDB,
-    0xA4, 0xF2, 0xF0, 0x96, 0x64, 0x7A, 0x78, 0x8B, 0xF9, 0x4C, 0x0F, 0x6F, 0xA1, 0x90, 0xF7, 0x3B,
-    0x85, 0x7C, 0x47, 0x53, 0x6A, 0x6D, 0x4F, 0xDF, 0xD8, 0x73, 0xBD, 0x62, 0xB7, 0x92, 0xE9, 0x54,
-    0xBC, 0x34, 0xA5, 0x9A, 0x9D, 0x4D, 0xA9, 0xFF, 0xDF, 0x9B, 0x66, 0x95, 0xFB, 0xDE, 0x2A, 0x2C,
-    0xC7, 0x15, 0xA2, 0xF6, 0x2B, 0x2C, 0xD8, 0x3C, 0x90, 0xCF, 0x8F, 0x90, 0xE6, 0x97, 0x9E, 0x56,
-    0x0A, 0x42, 0xA6, 0xBA, 0x97, 0xE7, 0xE2, 0xF9, 0x30, 0xEB, 0xD8, 0xE7, 0x03, 0xA8, 0x1E, 0x06,
-    0x59, 0x80, 0xF1, 0x7B, 0xF7, 0x3E, 0xFA, 0xE7, 0x49, 0xBC, 0xF5, 0x75, 0xB7, 0xEB, 0xDD, 0xB6,
-    0xB3, 0xC4, 0x7E, 0xAE, 0x33, 0x95, 0x6A, 0x89, 0xCD, 0x84, 0xA1, 0x54, 0x79, 0x27, 0x7B, 0xF5,
-    0xB8, 0x1F, 0x75, 0xB3, 0x78, 0xCB, 0x72, 0x76, 0x0E, 0x65, 0x8D, 0x4F, 0x38, 0x81, 0xA5, 0xEE,
-    0xD8, 0xD7, 0xDF, 0xD1, 0x36, 0xF6, 0x72, 0xB7, 0x50, 0x0E, 0x35, 0x14, 0x16, 0x83, 0xC2, 0x50,
-    0x13, 0x7D, 0x72, 0xC2, 0x54, 0x0E, 0x9A, 0x34, 0xD3, 0x11, 0x28, 0xB9, 0xE5, 0x2C, 0x6A, 0x64,
-    0x73, 0x9D, 0x9C, 0x57, 0xB4, 0xF7, 0xB5, 0xA7, 0xBA, 0xDC, 0x57, 0x18, 0x4D, 0x51, 0x92, 0xD8,
-    0x06, 0xAD, 0x9C, 0x67, 0x92, 0x2F, 0x69, 0xBD, 0x72, 0x5F, 0xDE, 0x32, 0x3C, 0xB7, 0x78, 0xDF,
-    0x2F, 0x65, 0xD1, 0x23, 0xCE, 0xC1, 0x5C, 0x0E, 0x45, 0xDA, 0x63, 0x0C, 0x10, 0x9C, 0xF8, 0x92,
-    0x76, 0x7A, 0x4C, 0xE7, 0x48, 0x79, 0x9C, 0x8D, 0x18, 0x15, 0xEB, 0x32, 0xCF, 0x7E, 0x99, 0x7B,
-    0xCE, 0x70, 0x49, 0x1F, 0x2F, 0x24, 0x58, 0xDA, 0x63, 0x55, 0xEF, 0x91, 0x3D, 0x2A, 0x88, 0x66,
-    0xA2, 0x4F, 0xAD, 0xA9, 0x78, 0xD2, 0x9A, 0x89, 0x2F, 0x7A, 0x20, 0xFD, 0xA1, 0x1E, 0x17, 0x38,
-    0x1E, 0x01, 0xD7, 0x0B, 0xE5, 0xBE, 0xC5, 0x20, 0xE3, 0x81, 0xFD, 0x4D, 0xD5, 0x3D, 0xFA, 0xB5,
-    0x7A, 0xBB, 0xCB, 0x64, 0xB6, 0xD0, 0xB1, 0xEB, 0xF8, 0x1F, 0xC6, 0x13, 0xF2, 0xD4, 0xD2, 0xF3,
-    0x92, 0x7A, 0x3A, 0x4F, 0x59, 0x72, 0x9C, 0x64, 0xE1, 0x68, 0xE7, 0x97, 0xF6, 0x80, 0x1F, 0xF5,
-    0xB7, 0x5F, 0x55, 0xD6, 0x1D, 0xAA, 0x8E, 0xC3, 0xE4, 0x14, 0x1F, 0xE1, 0xE9, 0xF6, 0x2F, 0xDC,
-    0xFD, 0xB6, 0x95, 0x8C, 0x8F, 0x84, 0x5D, 0x38, 0xA0, 0xBF, 0xEB, 0xF8, 0xAE, 0x9E, 0x62, 0xC7,
-    0xCF, 0xD3, 0x19, 0x27, 0x87, 0x99, 0x6C, 0xB1, 0x77, 0x56, 0xB4, 0x36, 0xF6, 0xF1, 0x0B, 0xD2,
-    0x9A, 0x3D, 0x45, 0x76, 0x8F, 0xAA, 0x70, 0x38, 0xAC, 0xB2, 0x70, 0x58, 0xDF, 0xA7, 0x70, 0x98,
-    0xCA, 0x75, 0x20, 0x21, 0xB4, 0x45, 0xFF, 0x09, 0x9D, 0xF2, 0x29, 0x11, 0x39, 0x35, 0x52, 0xB3,
-    0x97, 0x45, 0x5F, 0x9C, 0xFA, 0x06, 0x42, 0xB2, 0x21, 0x98, 0x3D, 0x25, 0x22, 0x16, 0xAD, 0x66,
-    0x57, 0x0B, 0x3B, 0xE1, 0x11, 0xC0, 0x19, 0x3E, 0x25, 0x62, 0xA0, 0x6F, 0x9E, 0x65, 0x51, 0xE7,
-    0xC9, 0x3F, 0x49, 0x67, 0x4A, 0x1A, 0x77, 0x86, 0x60, 0xE6, 0xAB, 0x8C, 0x76, 0xAD, 0xF2, 0xE6,
-    0xB4, 0xCA, 0x9F, 0x9B, 0xAD, 0x44, 0x12, 0x04, 0x8E, 0x64, 0x09, 0xCE, 0x98, 0x4F, 0x76, 0x3C,
-    0xBE, 0x2C, 0xD8, 0xF5, 0xF8, 0x32, 0x49, 0x63, 0x0E, 0x0F, 0x58, 0xC2, 0x71, 0xF6, 0xA1, 0xD2,
-    0x35, 0x4B, 0x76, 0x1A, 0x51, 0xCC, 0xCA, 0x6C, 0x09, 0x72, 0x3C, 0x73, 0x7A, 0xD0, 0x05, 0x9F,
-    0xB3, 0xF5, 0x7F, 0xC5, 0x9A, 0xBF, 0x8F, 0xDC, 0x54, 0x10, 0xC7, 0xC7, 0x36, 0x77, 0x16, 0xD9,
-    0xC2, 0x81, 0x04, 0x21, 0x40, 0xC1, 0x0D, 0x0D, 0x12, 0xC4, 0xFF, 0xC0, 0x71, 0x36, 0x20, 0xD1,
-    0x26, 0x12, 0xA2, 0x42, 0x22, 0x14, 0x14, 0x88, 0x82, 0x6B, 0x28, 0x68, 0xEE, 0x6C, 0x89, 0x82,
-    0x82, 0xE6, 0x24, 0x84, 0x68, 0x53, 0x04, 0x09, 0xA5, 0x8A, 0x10, 0x05, 0x48, 0xB7, 0x67, 0xF3,
-    0x43, 0x4A, 0x41, 0xB3, 0x22, 0x7F, 0x00, 0x8E, 0x14, 0x51, 0xD0, 0xC4, 0x41, 0x0E, 0x32, 0xC2,
-    0xBB, 0x8F, 0xEF, 0x77, 0x9E, 0xBD, 0xB7, 0x17, 0x7E, 0x08, 0xB1, 0xDE, 0xDD, 0xBD, 0xF3, 0x3B,
-    0xAD, 0x7F, 0xBC, 0x37, 0x9F, 0x99, 0x79, 0x33, 0xF3, 0x9E, 0x4F, 0x24, 0xAC, 0x45, 0x24, 0x6E,
-    0xD0, 0xA4, 0x6C, 0x66, 0x68, 0x9C, 0x69, 0x2B, 0xE2, 0xDD, 0x47, 0xE3, 0x57, 0x68, 0x82, 0x12,
-    0x4D, 0x54, 0xA0, 0x89, 0xB3, 0xA9, 0x48, 0xFE, 0x09, 0x1A, 0x63, 0x66, 0xE2, 0xB2, 0xF1, 0x8C,
-    0x31, 0x32, 0xAA, 0x24, 0xC7, 0x6D, 0x68, 0xA2, 0x02, 0x4D, 0x9C, 0x49, 0x2A, 0xF6, 0xE3, 0x24,
-    0xC2, 0x0E, 0xD0, 0x84, 0x6C, 0x82, 0x09, 0xCF, 0xF1, 0xC2, 0xC1, 0x2B, 0x87, 0x9E, 0xF9, 0xA9,
-    0x08, 0x8C, 0x29, 0xC2, 0xDA, 0x14, 0x71, 0x91, 0x66, 0xF8, 0x49, 0xF2, 0x24, 0x15, 0x83, 0x2E,
-    0x8C, 0xCC, 0xC4, 0x38, 0x38, 0xBC, 0xA9, 0xE4, 0xA6, 0x95, 0x78, 0xD6, 0x4A, 0x78, 0xBF, 0xB1,
-    0x9D, 0x26, 0x14, 0x0C, 0x9D, 0xE1, 0xC0, 0xC8, 0xFA, 0x1D, 0x67, 0x78, 0xD1, 0x9F, 0xB1, 0x7F,
-    0x1D, 0xFC, 0x00, 0x87, 0xC7, 0x73, 0xDE, 0xA4, 0x93, 0x65, 0x75, 0xA8, 0xDB, 0x57, 0xF1, 0x28,
-    0x1E, 0xDA, 0x1A, 0xA3, 0xDB, 0xB1, 0x1D, 0xD7, 0x2F, 0xEC, 0xA0, 0xCB, 0x80, 0xE2, 0xB3, 0x9D,
-    0xB1, 0x8D, 0x88, 0xDC, 0xEE, 0x93, 0x61, 0x76, 0x96, 0x9D, 0x86, 0x3C, 0x7B, 0x6D, 0x3B, 0x91,
-    0x53, 0x6C, 0x16, 0xCE, 0xD2, 0x29, 0x9E, 0xE5, 0xB3, 0x80, 0x96, 0xD0, 0x22, 0x5A, 0x46, 0x0B,
-    0x69, 0x29, 0x15, 0xD3, 0x72, 0x5A, 0x50, 0x4B, 0x6A, 0x51, 0x2D, 0xEB, 0x89, 0x5D, 0xB7, 0x12,
-    0x2B, 0xD3, 0xA8, 0x39, 0xC2, 0xDF, 0xF6, 0x32, 0x04, 0xDA, 0xC5, 0x58, 0x75, 0xD0, 0x4B, 0x03,
-    0x68, 0x21, 0xB5, 0x10, 0x5B, 0xC8, 0x2D, 0x04, 0x17, 0x92, 0x0B, 0xD1, 0x95, 0x5D, 0xE1, 0x95,
-    0x5E, 0xF1, 0x95, 0x5F, 0x15, 0xB0, 0xA8, 0x81, 0x27, 0xD9, 0x04, 0xD4, 0x82, 0x7F, 0x93, 0x32,
-    0x5F, 0x99, 0xF5, 0xFC, 0x27, 0xF8, 0xAB, 0x32, 0xEC, 0x63, 0xC4, 0xC4, 0x31, 0xFA, 0xA8, 0x11,
-    0x67, 0xAF, 0x55, 0xCC, 0x39, 0xE5, 0x92, 0x86, 0xA5, 0xAB, 0xC8, 0x1E, 0x9B, 0xA7, 0x31, 0x40,
-    0xFB, 0x65, 0x67, 0xDA, 0x03, 0x8E, 0x77, 0xF5, 0xCC, 0xAA, 0xC9, 0xF0, 0xF9, 0x0A, 0x07, 0x0D,
-    0x7F, 0x01, 0x66, 0x6C, 0x60, 0xC5, 0x43, 0x39, 0x06, 0x5D, 0x35, 0x0C, 0x1D, 0xE4, 0x0F, 0x7F,
-    0xC6, 0xC4, 0xDB, 0x85, 0xE5, 0xE5, 0x99, 0x27, 0xFA, 0xF9, 0x19, 0x72, 0xC0, 0x83, 0x98, 0xC6,
-    0x5B, 0x07, 0x22, 0x3A, 0xBF, 0x05, 0xCF, 0x33, 0x99, 0xDC, 0x40, 0x38, 0xD8, 0xBE, 0x86, 0xEF,
-    0x34, 0xE2, 0x01, 0x8C, 0x18, 0x0E, 0x82, 0x49, 0xDF, 0xA0, 0x3F, 0x86, 0x86, 0xE2, 0x87, 0x99,
-    0x38, 0xCD, 0xA8, 0x58, 0x07, 0xD7, 0x3F, 0x07, 0x56, 0x9D, 0x2E, 0x3A, 0x8F, 0x60, 0xDE, 0x58,
-    0xDC, 0x4A, 0xE7, 0xCE, 0x0A, 0x02, 0xAE, 0x6C, 0xB1, 0x79, 0x01, 0xC7, 0xD9, 0xFB, 0x38, 0xF1,
-    0xFE, 0xCB, 0x00, 0xDF, 0xDD, 0xA3, 0xE1, 0xA9, 0x11, 0x86, 0xC4, 0x75, 0xE8, 0x01, 0x31, 0xF1,
-    0xEC, 0x3D, 0x91, 0x2F, 0x3E, 0xCC, 0x64, 0x8C, 0xA9, 0x13, 0xE3, 0xD1, 0x51, 0xD9, 0xD9, 0x76,
-    0x7B, 0x09, 0xDB, 0xAA, 0x7E, 0x35, 0x86, 0x3F, 0x72, 0x9B, 0x74, 0xAF, 0xF6, 0x74, 0xD1, 0x1A,
-    0xE9, 0x68, 0xBA, 0x73, 0xDF, 0x88, 0xDC, 0xF8, 0x34, 0x93, 0xFD, 0x21, 0xE9, 0x2C, 0xA2, 0xA6,
-    0x8C, 0x9D, 0xB9, 0x01, 0x3F, 0x58, 0x37, 0xA2, 0x0B, 0x14, 0x07, 0x81, 0xEF, 0x91, 0x95, 0x18,
-    0x50, 0x63, 0xD0, 0x6F, 0x8C, 0x41, 0x39, 0xC0, 0xCE, 0xD3, 0x5B, 0xDF, 0x73, 0x89, 0xF8, 0x3A,
-    0x9A, 0x88, 0x13, 0x96, 0x01, 0x61, 0x1D, 0x31, 0xE8, 0xC7, 0x02, 0x71, 0x30, 0x93, 0x37, 0x9F,
-    0x45, 0x64, 0x77, 0x33, 0xF9, 0x1A, 0x71, 0x22, 0x66, 0x82, 0xBD, 0x33, 0x54, 0x0C, 0x3A, 0xA2,
-    0xA3, 0xA6, 0x39, 0xBC, 0x85, 0xFD, 0xCE, 0x3B, 0xDE, 0x68, 0x0C, 0x62, 0x20, 0xCC, 0xF3, 0x64,
-    0x30, 0xD2, 0xBF, 0x8B, 0x41, 0xB9, 0xA9, 0x21, 0x6C, 0xC5, 0xC3, 0x99, 0xBD, 0x96, 0x38, 0x90,
-    0xDD, 0x25, 0x5D, 0xAB, 0x35, 0x4C, 0xE2, 0x53, 0x7A, 0x1C, 0xC1, 0xFD, 0xD7, 0xF4, 0x39, 0x8A,
-    0x1A, 0x42, 0xC8, 0x68, 0x42, 0x45, 0xB5, 0xF3, 0x43, 0x3F, 0xE7, 0x6D, 0x3A, 0x64, 0x31, 0xE2,
-    0xF0, 0x14, 0xCB, 0xAC, 0xE8, 0x0E, 0xF4, 0x30, 0xD5, 0x3E, 0xC2, 0x32, 0x4D, 0x20, 0xAF, 0xA4,
-    0x2F, 0x42, 0x52, 0x9C, 0x33, 0xA6, 0x14, 0xF3, 0x19, 0x4B, 0x18, 0x88, 0x81, 0x9B, 0xD3, 0x5F,
-    0x6A, 0xF4, 0x55, 0xE3, 0xDE, 0xF2, 0x44, 0x5E, 0x68, 0x7F, 0x54, 0x5B, 0xB9, 0x6D, 0xCC, 0x64,
-    0xE7, 0xCC, 0x88, 0x57, 0x70, 0x04, 0x38, 0x8E, 0x71, 0xAE, 0xB6, 0xF7, 0x0F, 0xC5, 0x72, 0xA6,
-    0xAF, 0x45, 0x99, 0x6A, 0x8F, 0x3A, 0x21, 0xBA, 0x9C, 0xB4, 0x0C, 0x8F, 0x57, 0xEE, 0xA0, 0x9A,
-    0x6B, 0x25, 0xCA, 0x6B, 0xD9, 0x19, 0x4D, 0x06, 0x95, 0xF9, 0xA2, 0x57, 0xA0, 0x8F, 0xC2, 0xFD,
-    0xC3, 0x24, 0x6E, 0x31, 0x5E, 0x5E, 0x56, 0x68, 0x99, 0xD1, 0xCB, 0xC7, 0x57, 0x73, 0x29, 0x83,
-    0x2C, 0xDF, 0x63, 0xF0, 0xEF, 0x30, 0xEA, 0xB3, 0x4E, 0x1F, 0xD5, 0x28, 0xBA, 0xCA, 0xAE, 0x0D,
-    0xA5, 0x17, 0x8A, 0xAF, 0xF2, 0x2B, 0x80, 0x12, 0x88, 0xAF, 0x95, 0x30, 0x1B, 0x42, 0x28, 0x45,
-    0xE7, 0xF1, 0xD4, 0x00, 0x41, 0x2C, 0xC1, 0x49, 0xD3, 0x27, 0x46, 0x14, 0x39, 0x41, 0x0D, 0xFD,
-    0xC7, 0x2C, 0x8F, 0xC7, 0xFB, 0x8C, 0x76, 0x61, 0x2F, 0x1D, 0xD8, 0x14, 0xCE, 0xF6, 0x4C, 0x3C,
-    0x96, 0xC7, 0xA2, 0x80, 0x4A, 0xA8, 0x88, 0xCA, 0xA8, 0x90, 0x4A, 0xA9, 0x98, 0xCA, 0xB9, 0x00,
-    0xEA, 0x1E, 0x42, 0x50, 0x0A, 0x55, 0x41, 0xD8, 0xC7, 0xE1, 0x5A, 0xC4, 0xEC, 0x29, 0x07, 0x32,
-    0xCF, 0x79, 0x4B, 0x23, 0xC1, 0xA5, 0x1A, 0x6B, 0xAB, 0x56, 0x69, 0xE6, 0x30, 0xCB, 0x99, 0x29,
-    0xE4, 0xAC, 0x78, 0x8A, 0xDE, 0x09, 0x0F, 0x70, 0xCC, 0x1B, 0xD2, 0xD9, 0xEA, 0xE6, 0xDA, 0x6C,
-    0x75, 0xAD, 0x9B, 0xEE, 0x70, 0xEE, 0x1A, 0xE2, 0xB5, 0x99, 0x4C, 0x49, 0xF7, 0xF4, 0x10, 0x74,
-    0x90, 0x6B, 0xFA, 0xBE, 0x8C, 0xF2, 0x4A, 0x1E, 0xE6, 0x32, 0x2E, 0xA7, 0x9C, 0x99, 0x04, 0x3F,
-    0x0C, 0x6E, 0x21, 0x2B, 0xEB, 0x07, 0x19, 0xFA, 0x4B, 0xA4, 0x1A, 0xDB, 0x20, 0x10, 0x21, 0x70,
-    0x8E, 0x8F, 0xC0, 0x72, 0x71, 0x18, 0x16, 0x07, 0xB2, 0xFB, 0x5C, 0xCD, 0xDD, 0xAC, 0x64, 0xD7,
-    0xD6, 0x0E, 0x2B, 0x0F, 0xC0, 0xF3, 0x62, 0x76, 0xAA, 0xC5, 0xAC, 0x57, 0x76, 0xC5, 0xEC, 0xD0,
-    0x81, 0x19, 0x27, 0x46, 0x53, 0xDD, 0x33, 0xD8, 0xE7, 0xE2, 0xDD, 0xD3, 0x78, 0x89, 0x04, 0xC8,
-    0xDF, 0x86, 0x79, 0x2F, 0x2E, 0x98, 0xF8, 0xE2, 0x44, 0xB8, 0x7E, 0xD5, 0xCE, 0x67, 0xF4, 0x41,
-    0xC0, 0xE2, 0x17, 0xB8, 0xA8, 0x79, 0x53, 0x93, 0x50, 0xFD, 0xD7, 0x71, 0xB5, 0x60, 0x80, 0x47,
-    0x7C, 0x4F, 0xED, 0x2A, 0x4B, 0x9C, 0xCF, 0x79, 0x0F, 0x3A, 0xE6, 0x38, 0x15, 0x55, 0xC1, 0xDF,
-    0x92, 0xBA, 0x78, 0xA0, 0xEF, 0xFF, 0x39, 0xA8, 0xE6, 0x62, 0x76, 0xA8, 0x7D, 0x76, 0x39, 0x98,
-    0x65, 0x86, 0x76, 0xA2, 0x4B, 0x68, 0x79, 0xE7, 0x54, 0x0F, 0x5E, 0xFB, 0x17, 0x91, 0x4A, 0x66,
-    0x70, 0x9D, 0x2B, 0x8C, 0x60, 0x1C, 0x56, 0x53, 0xFD, 0x43, 0xBD, 0x03, 0xF8, 0x06, 0xC1, 0x26,
-    0x85, 0x68, 0x8E, 0x81, 0x9E, 0xBD, 0x99, 0x0B, 0xC3, 0x36, 0xE8, 0x33, 0x44, 0x81, 0x90, 0xC0,
-    0xA4, 0xB4, 0x03, 0x1B, 0x3C, 0x95, 0xE8, 0x32, 0x1F, 0xD9, 0x1F, 0x36, 0x49, 0x1C, 0x83, 0x13,
-    0xEE, 0x54, 0xD2, 0xC2, 0x87, 0xB9, 0xCB, 0xA8, 0xC6, 0x72, 0x09, 0xC6, 0x80, 0xF1, 0xB0, 0x5E,
-    0x32, 0xF3, 0x42, 0x46, 0xC7, 0x49, 0x35, 0xAD, 0xB3, 0x49, 0xE7, 0xE7, 0xF6, 0x4A, 0x38, 0x53,
-    0xCB, 0xAD, 0x04, 0x89, 0x2A, 0xC3, 0x48, 0x99, 0x70, 0x14, 0x94, 0x22, 0x09, 0x7B, 0xB6, 0x95,
-    0x03, 0x5A, 0x0E, 0xC1, 0x04, 0x05, 0x7F, 0x1C, 0x19, 0xEB, 0x27, 0x82, 0xD8, 0xEB, 0xD1, 0xD8,
-    0xCD, 0x62, 0x16, 0x8E, 0x79, 0x31, 0xE5, 0xD7, 0xC7, 0xD9, 0x68, 0xFC, 0x8C, 0x68, 0xF2, 0xDD,
-    0x35, 0xA1, 0xCE, 0x73, 0x34, 0xFD, 0xBC, 0x3D, 0x9D, 0xA3, 0x97, 0xA1, 0xC5, 0xE7, 0x6D, 0xFA,
-    0x02, 0x06, 0x4A, 0x6F, 0xC1, 0x90, 0x06, 0x85, 0xB5, 0x77, 0x0F, 0x9D, 0x9F, 0x49, 0xDE, 0x5E,
-    0x0F, 0xD9, 0x7F, 0x48, 0x7E, 0x00, 0x54, 0x42, 0x45, 0x54, 0x46, 0x85, 0xB4, 0x83, 0x12, 0x53,
-    0x38, 0x54, 0xBF, 0x41, 0xC4, 0x84, 0x88, 0x61, 0x95, 0x55, 0x61, 0x17, 0x69, 0xB5, 0x7E, 0xD7,
-    0xB1, 0x77, 0x52, 0xE0, 0x6E, 0xF1, 0xF2, 0x5A, 0x79, 0xFF, 0x35, 0x35, 0x2E, 0x67, 0x49, 0x9F,
-    0x13, 0x71, 0x9B, 0xAE, 0x29, 0x68, 0xD2, 0x9B, 0x1C, 0xF6, 0x36, 0x4E, 0xDF, 0x56, 0xBC, 0xB7,
-    0xD6, 0x65, 0xCE, 0x3E, 0x3F, 0x3E, 0x77, 0x3A, 0x3F, 0x0E, 0x82, 0xC8, 0xD9, 0x3D, 0x7B, 0x17,
-    0x26, 0xBB, 0x8B, 0x11, 0xDC, 0x17, 0x99, 0x12, 0x23, 0x5E, 0x64, 0xA4, 0xF6, 0x7E, 0xAD, 0xD6,
-    0xCA, 0xC9, 0xFC, 0x59, 0x30, 0x9C, 0x4A, 0xB5, 0x6F, 0x17, 0xBF, 0x9A, 0x3F, 0xC7, 0x27, 0xF9,
-    0x73, 0xC9, 0x89, 0xC9, 0x90, 0xC3, 0xF5, 0x2E, 0x7D, 0xD4, 0xBF, 0xC7, 0x3D, 0xCE, 0x6C, 0x7F,
-    0xC3, 0x81, 0xF5, 0xAF, 0xD9, 0x35, 0x91, 0x95, 0x04, 0xDC, 0x6E, 0xA7, 0x4C, 0x25, 0xD2, 0x8A,
-    0x8C, 0xB3, 0xBC, 0xDF, 0x03, 0xE5, 0xB7, 0x82, 0x3A, 0x60, 0x0C, 0x30, 0x8D, 0xA1, 0x16, 0x3A,
-    0x35, 0x54, 0xAA, 0x87, 0x8C, 0x8A, 0xC0, 0x45, 0xD5, 0x84, 0xA8, 0x2A, 0x74, 0x15, 0xDA, 0xE7,
-    0x45, 0x0D, 0x16, 0x6C, 0x67, 0x62, 0xF5, 0x81, 0xC4, 0xE5, 0x13, 0x8B, 0x1A, 0xB1, 0x2A, 0xA1,
-    0x4E, 0x12, 0x79, 0xD0, 0xE2, 0x9A, 0xE4, 0x71, 0x9A, 0x8F, 0x58, 0x69, 0x83, 0xEC, 0xC9, 0xCC,
-    0x26, 0x83, 0xBD, 0x32, 0xCE, 0x3C, 0x33, 0x35, 0xD4, 0x42, 0x4B, 0x35, 0x4C, 0xFE, 0x77, 0x94,
-    0xEA, 0x2A, 0x75, 0x5B, 0xE6, 0x4C, 0xA5, 0x8B, 0x8F, 0x7D, 0xF5, 0xBB, 0x51, 0xFC, 0x38, 0xEB,
-    0x53, 0x9F, 0xAE, 0xE8, 0xDC, 0x72, 0x15, 0xF8, 0x3A, 0xA7, 0x25, 0xD6, 0x50, 0x76, 0x4E, 0x5B,
-    0xCD, 0xB8, 0x76, 0x5C, 0xB9, 0xB8, 0x49, 0x1F, 0x60, 0x22, 0xD6, 0x29, 0x60, 0x53, 0xB1, 0xB4,
-    0xB6, 0x16, 0x64, 0x36, 0x5E, 0x81, 0x26, 0xDC, 0x9A, 0xCB, 0x8A, 0x91, 0xA1, 0xDB, 0x07, 0x39,
-    0xC5, 0xB8, 0xB0, 0x5D, 0x6E, 0x90, 0xFE, 0xE2, 0x4B, 0xAC, 0x11, 0x50, 0xAD, 0x3A, 0x58, 0x78,
-    0x8B, 0x5B, 0xEC, 0xAF, 0xC6, 0xF9, 0x37, 0xC2, 0xB6, 0x25, 0xF3, 0xA8, 0x67, 0xC3, 0x5E, 0xB7,
-    0x6B, 0xD5, 0x07, 0xBE, 0x15, 0xA0, 0x5E, 0x3E, 0xBD, 0x24, 0x6D, 0xBA, 0xC5, 0x06, 0xCF, 0xA5,
-    0x09, 0xCE, 0xE5, 0x3C, 0x67, 0xE8, 0x5F, 0xBA, 0xA9, 0x36, 0x43, 0xD1, 0x8D, 0x5A, 0x3C, 0x28,
-    0x71, 0x3D, 0x2C, 0x71, 0x3D, 0x9A, 0x78, 0x2C, 0xFB, 0xFD, 0x06, 0x12, 0xE0, 0xA6, 0x38, 0xC3,
-    0x4D, 0x69, 0x16, 0xB0, 0x41, 0x5D, 0x1F, 0x4F, 0x52, 0xBE, 0xCA, 0xE0, 0x02, 0xD2, 0xBE, 0xA9,
-    0xAB, 0x65, 0xA1, 0x08, 0xD1, 0xB8, 0xE2, 0xE8, 0xDB, 0x4F, 0x75, 0xE4, 0xB3, 0xEA, 0xDC, 0x67,
-    0x0E, 0x83, 0x32, 0x98, 0x84, 0x93, 0xB0, 0x08, 0x8B, 0x08, 0x3F, 0x31, 0x7F, 0xB2, 0x38, 0x63,
-    0x3C, 0xCF, 0x45, 0x37, 0xDD, 0xF0, 0x4C, 0xEE, 0xCD, 0x74, 0xE5, 0x14, 0x4F, 0x21, 0x48, 0xDD,
-    0x9E, 0xDE, 0x6E, 0xAB, 0x17, 0xB7, 0xFC, 0x6D, 0x12, 0x99, 0x74, 0x5B, 0x2B, 0xB6, 0x44, 0xD1,
-    0x10, 0xB2, 0x73, 0x12, 0xE4, 0x56, 0x8A, 0xCA, 0x1D, 0x5B, 0x2E, 0xD4, 0xB6, 0x8E, 0xED, 0x1B,
-    0x5E, 0x2A, 0xB9, 0x7B, 0xBF, 0xBB, 0x14, 0x6D, 0x9F, 0xA1, 0x74, 0x20, 0xBB, 0x04, 0xB2, 0x19,
-    0xEA, 0xA8, 0x4F, 0x93, 0x15, 0xD1, 0x2E, 0x95, 0x18, 0x30, 0x8F, 0x0A, 0xB6, 0x58, 0xDD, 0x82,
-    0x6E, 0x4A, 0x3C, 0xA4, 0x6F, 0xE5, 0xB3, 0x80, 0x78, 0xDE, 0xB3, 0x6D, 0x43, 0x0F, 0x63, 0xAB,
-    0x90, 0x96, 0x12, 0xFA, 0xE1, 0x4A, 0x58, 0x39, 0xE9, 0x69, 0x05, 0x57, 0xC2, 0xF4, 0xDE, 0xC0,
-    0xE8, 0x96, 0xC6, 0xE2, 0x8A, 0xBB, 0xDB, 0xFD, 0xA0, 0x6B, 0xF3, 0x9A, 0x67, 0x03, 0x13, 0x16,
-    0x93, 0x54, 0x34, 0x78, 0x3F, 0x6E, 0x00, 0x7C, 0xB7, 0x02, 0xB1, 0x21, 0xF2, 0xEF, 0x42, 0x66,
-    0x21, 0xB4, 0x90, 0x5A, 0x88, 0xAD, 0xDC, 0x0A, 0xAE, 0xE4, 0x76, 0x77, 0x29, 0xE5, 0x1E, 0xF0,
-    0x83, 0xF0, 0xD6, 0x6D, 0xFB, 0x0C, 0x75, 0x60, 0x33, 0xD4, 0xC6, 0xF1, 0xE3, 0xA2, 0xDF, 0x59,
-    0xD6, 0x04, 0xED, 0x54, 0xAB, 0xC0, 0xEF, 0xC2, 0x84, 0xDA, 0x5D, 0x3D, 0xDB, 0xBA, 0xB6, 0xF5,
-    0xED, 0xB9, 0x73, 0x6F, 0x44, 0x09, 0xFA, 0x8E, 0x82, 0x2E, 0x6F, 0x7D, 0x7E, 0xF1, 0xDF, 0x1A,
-    0x56, 0xA0, 0x09, 0xB7, 0x7E, 0x9E, 0xA0, 0x86, 0x6E, 0x1F, 0x6A, 0x86, 0x7A, 0xDE, 0x9F, 0x6C,
-    0x90, 0x3E, 0xD2, 0x0C, 0xF5, 0x87, 0x66, 0xA8, 0x4C, 0xDC, 0xC9, 0xFE, 0x6A, 0x9C, 0x7F, 0x23,
-    0x6C, 0x1A, 0xB6, 0x99, 0xD5, 0x98, 0xB9, 0x16, 0x66, 0x5E, 0xBF, 0xEF, 0xB5, 0x02, 0xD4, 0xCB,
-    0xBD, 0xF3, 0xE8, 0xCB, 0x78, 0x8D, 0x27, 0x27, 0x05, 0x3A, 0x27, 0x01, 0x1D, 0x9E, 0xEF, 0x25,
-    0xBA, 0x98, 0x9A, 0x83, 0x3C, 0xC5, 0x0A, 0x04, 0xA3, 0x60, 0x44, 0xAC, 0x06, 0xBE, 0x9D, 0x4A,
-    0x78, 0xAB, 0x91, 0xE0, 0x27, 0xE4, 0x6E, 0x64, 0xCA, 0x91, 0x6E, 0x09, 0x72, 0x9B, 0xB3, 0xDB,
-    0xF3, 0x6B, 0xBA, 0xBD, 0x8C, 0xEE, 0x45, 0x0D, 0x6B, 0xFD, 0x60, 0x8E, 0xAC, 0x23, 0xDB, 0xF4,
-    0x34, 0x5E, 0xAC, 0xFC, 0x00, 0x7A, 0x1D, 0xA0, 0x10, 0xDD, 0x69, 0xD1, 0x8B, 0xD3, 0x52, 0xBA,
-    0x29, 0xFB, 0x98, 0xF2, 0xE1, 0x19, 0xEB, 0xC4, 0x63, 0x86, 0xE3, 0xE3, 0x9C, 0x13, 0x80, 0x5A,
-    0x4A, 0xF5, 0xBF, 0x57, 0xEA, 0xBE, 0xAC, 0x8C, 0xE7, 0x89, 0x88, 0x77, 0xB8, 0xD4, 0x69, 0xCE,
-    0x3B, 0xF2, 0xAA, 0xCF, 0xFE, 0x43, 0x92, 0x6C, 0x75, 0x61, 0x49, 0x8F, 0xC4, 0x96, 0x14, 0x83,
-    0x32, 0x6C, 0x91, 0x81, 0xE5, 0x47, 0x9B, 0xA2, 0xA9, 0x62, 0x2E, 0xF9, 0x1E, 0xEA, 0xB6, 0xB0,
-    0xF9, 0xC0, 0xA3, 0x0D, 0x67, 0xAA, 0x0D, 0x8B, 0x5D, 0x84, 0x1E, 0x8E, 0xEF, 0xBA, 0xAE, 0x8A,
-    0x18, 0x75, 0xAF, 0x4C, 0xA4, 0xDB, 0x96, 0xD2, 0xF8, 0x78, 0xB4, 0x46, 0x73, 0xC9, 0x81, 0x9F,
-    0x39, 0xE6, 0x6E, 0xE2, 0xDD, 0x35, 0xE2, 0x65, 0x5F, 0x0D, 0x8B, 0xE8, 0x97, 0x88, 0xE8, 0x01,
-    0xFF, 0xCD, 0x88, 0xEF, 0xB2, 0x64, 0x67, 0x74, 0xB8, 0x3E, 0xB0, 0x3F, 0x01, 0xAD, 0x57, 0x3D,
-    0x6C, 0x1D, 0xC7, 0x11, 0x9E, 0xBB, 0xE3, 0xD3, 0xC9, 0x3A, 0x80, 0xAB, 0x82, 0x0C, 0x20, 0xFF,
-    0xF0, 0x5C, 0xD2, 0x0A, 0xA0, 0x53, 0x91, 0x00, 0x2A, 0x24, 0xEE, 0x26, 0xB2, 0x91, 0x2E, 0x62,
-    0x41, 0x02, 0x41, 0x1A, 0x37, 0x2A, 0x1C, 0xA7, 0x70, 0x4B, 0x03, 0x16, 0xF7, 0x2C, 0x16, 0x29,
-    0x54, 0x98, 0x4D, 0xEA, 0x3C, 0x20, 0x2A, 0x0C, 0xA6, 0x70, 0x93, 0x42, 0x05, 0x1F, 0x6F, 0x6D,
-    0x16, 0x2A, 0xD2, 0x5C, 0xA2, 0x22, 0x40, 0x10, 0xC0, 0x17, 0x38, 0x40, 0x00, 0xBB, 0xF0, 0xC2,
-    0x38, 0x43, 0x27, 0xE4, 0xEE, 0x6D, 0xBE, 0xD9, 0xBB, 0xA7, 0xF7, 0x48, 0x29, 0x12, 0x0B, 0xEF,
-    0xBE, 0xDD, 0x7D, 0x77, 0x3B, 0x3B, 0x33, 0x3B, 0x3B, 0xDF, 0xEC, 0x1C, 0x51, 0xA4, 0xA8, 0x2C,
-    0xEC, 0xB8, 0xFC, 0x23, 0x8D, 0x5F, 0x58, 0xB9, 0xC4, 0xF4, 0x3A, 0xC9, 0xE6, 0xF5, 0xF5, 0x78,
-    0x9D, 0x5E, 0x5C, 0x69, 0xB4, 0x25, 0x3B, 0xDD, 0xEA, 0x76, 0x36, 0xF2, 0xEA, 0xCC, 0x39, 0x23,
-    0xD1, 0x2E, 0x1F, 0x1C, 0xE4, 0x78, 0x94, 0xAE, 0xD3, 0xAE, 0x7D, 0xFF, 0xE0, 0x53, 0xCF, 0x1A,
-    0x8F, 0x28, 0x78, 0x83, 0x82, 0x97, 0x28, 0xFF, 0xF7, 0xFD, 0x61, 0x54, 0xFE, 0x20, 0xBF, 0xF7,
-    0xC2, 0xFD, 0xD5, 0xED, 0x2D, 0xA8, 0x31, 0xDA, 0xDE, 0x82, 0x20, 0xED, 0x9A, 0xF7, 0x0F, 0xEE,
-    0x87, 0x36, 0xB2, 0xA2, 0x4C, 0x8D, 0xCC, 0xB5, 0x5A, 0xA5, 0xD8, 0x0A, 0x3C, 0x65, 0xB9, 0xA4,
-    0x5D, 0x5A, 0xA1, 0xA8, 0xC1, 0x73, 0x25, 0x0C, 0x3F, 0x43, 0xB1, 0xA1, 0x66, 0xA8, 0x23, 0x0A,
-    0xED, 0x46, 0x64, 0x5B, 0xF1, 0xD7, 0x36, 0x3D, 0xAE, 0xE5, 0xEF, 0xAC, 0xBE, 0x55, 0xAD, 0x8E,
-    0x54, 0x6C, 0xA7, 0xE2, 0x5F, 0xAD, 0xF8, 0xA2, 0xC9, 0xF6, 0xAC, 0x4C, 0xAA, 0x5D, 0x61, 0x56,
-    0x46, 0xE0, 0x52, 0x80, 0xEF, 0x94, 0x30, 0x43, 0x98, 0x22, 0xCC, 0x91, 0x8C, 0x4B, 0xBF, 0x59,
-    0x2D, 0x4A, 0xFC, 0x24, 0x7E, 0x49, 0x99, 0xC5, 0x55, 0x7A, 0xB3, 0x1A, 0x05, 0x8A, 0x24, 0x7E,
-    0x44, 0x1B, 0x44, 0x37, 0x88, 0x3E, 0x82, 0x41, 0x1A, 0xED, 0xEA, 0xDF, 0x3C, 0x19, 0x93, 0xA5,
-    0xC0, 0x42, 0x30, 0x45, 0x15, 0xC5, 0x15, 0x25, 0x25, 0x09, 0xC3, 0xBF, 0xD4, 0x50, 0x96, 0x93,
-    0x84, 0x8D, 0xA3, 0x06, 0xCD, 0x0E, 0xAD, 0xA4, 0xF0, 0x4F, 0x5F, 0xE7, 0x11, 0x0E, 0x20, 0x76,
-    0x2E, 0x27, 0x81, 0xF9, 0x14, 0x2D, 0xE3, 0x46, 0xBE, 0x65, 0xAE, 0x03, 0xF7, 0x96, 0x2E, 0x4F,
-    0x60, 0xFB, 0x43, 0xBC, 0xC3, 0xB1, 0x05, 0x68, 0x21, 0xD8, 0x24, 0x75, 0xD6, 0xCA, 0xA9, 0x46,
-    0x95, 0x5D, 0xD6, 0x9E, 0x1B, 0x9F, 0xA7, 0x65, 0x08, 0xCA, 0xAC, 0x6C, 0x71, 0xC0, 0xD5, 0x91,
-    0x77, 0x90, 0x24, 0x97, 0x25, 0xAA, 0x59, 0xA2, 0x2B, 0x74, 0xA7, 0xF8, 0xD8, 0xB9, 0xBB, 0xAE,
-    0x08, 0xBA, 0x15, 0xBA, 0x78, 0x85, 0x1E, 0x84, 0x55, 0x71, 0xB7, 0x13, 0xD6, 0xED, 0xA1, 0x2B,
-    0xC2, 0x56, 0x54, 0x2B, 0xB4, 0x19, 0xF0, 0x0A, 0x83, 0x9A, 0x2F, 0x61, 0x75, 0x51, 0x8F, 0x69,
-    0x7C, 0x06, 0x27, 0xD4, 0x0D, 0xAD, 0xBF, 0xB4, 0xA2, 0x38, 0x3B, 0xAB, 0x17, 0xE8, 0x45, 0xD5,
-    0xD3, 0x56, 0x86, 0xB8, 0x9E, 0x85, 0xB6, 0xB0, 0x74, 0x95, 0xEB, 0x59, 0x68, 0xFB, 0x12, 0x4E,
-    0xF9, 0x88, 0x88, 0x84, 0xCB, 0x71, 0x3C, 0x30, 0xFB, 0xB7, 0x26, 0xF3, 0xAE, 0x2D, 0xCC, 0x9D,
-    0xFE, 0xD4, 0x4D, 0xC3, 0xE3, 0xAE, 0x38, 0xB6, 0x3C, 0x4E, 0xD2, 0x7B, 0xDE, 0x1D, 0x26, 0xF2,
-    0xDD, 0x7B, 0x15, 0x8C, 0xAF, 0x0B, 0xA9, 0x5B, 0xE1, 0x48, 0x76, 0xED, 0xB4, 0x93, 0x85, 0x4A,
-    0xBF, 0xFB, 0xBE, 0x9D, 0x68, 0x1C, 0x5E, 0xFC, 0x55, 0x3D, 0x99, 0x60, 0xC4, 0xBA, 0x49, 0x9B,
-    0xC1, 0x4B, 0xE0, 0x82, 0x2D, 0x5C, 0x65, 0xD2, 0x8F, 0x41, 0x13, 0x3D, 0xAE, 0xBB, 0x0E, 0xC7,
-    0x1F, 0x3A, 0x5B, 0xB4, 0xEC, 0x1B, 0x2E, 0x97, 0x15, 0x3D, 0x5B, 0x66, 0x1A, 0xCE, 0x75, 0x9C,
-    0x6B, 0x39, 0xD7, 0x73, 0xAE, 0xE9, 0x5C, 0xD7, 0xB9, 0xB6, 0x73, 0x7D, 0x8F, 0x66, 0x1A, 0x47,
-    0x00, 0x7C, 0xAF, 0xF3, 0x2D, 0x57, 0x0E, 0x5A, 0xFF, 0xE1, 0x61, 0x35, 0xE8, 0xFD, 0xD9, 0x2F,
-    0xAA, 0x41, 0x73, 0x0D, 0xDF, 0xED, 0x75, 0x87, 0xEB, 0x0F, 0xDA, 0x43, 0xE8, 0xA0, 0xBF, 0xD4,
-    0xF9, 0xB0, 0x83, 0xCC, 0xCD, 0xF6, 0x90, 0x34, 0x8B, 0xEA, 0x77, 0xA0, 0xB4, 0x49, 0x29, 0x80,
-    0x4B, 0x1C, 0x7D, 0xC7, 0x2B, 0x33, 0x15, 0x59, 0x0D, 0x4C, 0x60, 0xD7, 0x1F, 0xD7, 0x60, 0x5E,
-    0xD1, 0xFA, 0xB9, 0x9C, 0xE7, 0x3E, 0x6F, 0x30, 0x79, 0x13, 0x28, 0xD7, 0x49, 0x85, 0x69, 0x61,
-    0x30, 0x9F, 0x31, 0xC1, 0x1D, 0xA6, 0x78, 0x8F, 0x32, 0x95, 0x1A, 0x51, 0x46, 0x15, 0x70, 0x55,
-    0xD3, 0x6D, 0x50, 0x52, 0x0A, 0x90, 0x0A, 0x30, 0x62, 0x92, 0xD0, 0xC2, 0xBC, 0x75, 0x4A, 0x74,
-    0xFB, 0x82, 0xC2, 0x9C, 0xE6, 0x49, 0xA9, 0x30, 0x9B, 0x1A, 0x4C, 0x27, 0x06, 0xF3, 0x10, 0x55,
-    0xA7, 0x58, 0x0D, 0x0A, 0xEF, 0xB0, 0x3F, 0x21, 0x6A, 0x18, 0x46, 0xD1, 0x3F, 0x29, 0x79, 0x83,
-    0xD6, 0x96, 0xE9, 0xFA, 0x32, 0xFD, 0x59, 0x10, 0x5D, 0xF4, 0x78, 0x76, 0x14, 0x41, 0xC5, 0x9A,
-    0xB2, 0x8A, 0x24, 0x70, 0x0B, 0x00, 0x03, 0xC9, 0x16, 0x01, 0x82, 0x42, 0x45, 0xA4, 0x12, 0x23,
-    0xAA, 0xC4, 0x46, 0x4D, 0xD4, 0x46, 0xAD, 0xB0, 0x59, 0x59, 0xA8, 0x5D, 0x3A, 0x0F, 0xA6, 0x0C,
-    0x98, 0x10, 0x51, 0xE1, 0x4D, 0x18, 0x44, 0xAB, 0x43, 0x12, 0x56, 0x86, 0x10, 0xD1, 0x2E, 0x61,
-    0x2D, 0x78, 0x82, 0x0F, 0xD8, 0x15, 0x7C, 0x9E, 0xDF, 0x01, 0xC0, 0xAF, 0x46, 0xCE, 0xBE, 0x85,
-    0x88, 0xE0, 0x8C, 0x46, 0x5F, 0x60, 0x45, 0x06, 0x7B, 0x22, 0xA0, 0x24, 0x8F, 0x39, 0x32, 0x67,
-    0x66, 0xCA, 0x7E, 0xCD, 0x21, 0x03, 0x4C, 0xBC, 0x02, 0x19, 0x42, 0x07, 0x73, 0x06, 0x4F, 0xD2,
-    0x0A, 0x5B, 0xA0, 0x4B, 0x68, 0xC1, 0x34, 0x6E, 0xC2, 0x69, 0x52, 0x87, 0x00, 0x31, 0xEB, 0x83,
-    0x56, 0x45, 0x4D, 0x5A, 0xC6, 0x75, 0x6A, 0xB0, 0x06, 0x4D, 0xE6, 0xA2, 0x62, 0x7B, 0x48, 0x5E,
-    0xFD, 0xF4, 0x7C, 0x32, 0x7A, 0x40, 0xFA, 0x6E, 0x47, 0xC5, 0x5E, 0x47, 0x1A, 0x22, 0x96, 0x68,
-    0x93, 0x5F, 0x27, 0x4E, 0x15, 0xAE, 0xD2, 0xCE, 0xCA, 0xFF, 0xD4, 0xC9, 0x23, 0x2B, 0x1E, 0x5A,
-    0xF1, 0x65, 0xC5, 0x0E, 0x38, 0xA5, 0xD4, 0xF2, 0x1E, 0xE0, 0xD2, 0x7D, 0xB9, 0x02, 0xF5, 0x14,
-    0x39, 0x05, 0x25, 0x11, 0x87, 0x69, 0x75, 0x7B, 0x5B, 0xBA, 0xA9, 0x46, 0xB8, 0xEA, 0xCB, 0x55,
-    0x22, 0x73, 0x8D, 0xA2, 0x7C, 0x8D, 0xD6, 0x28, 0xF9, 0x1A, 0xD6, 0x2E, 0xF6, 0x89, 0x3E, 0xD8,
-    0xA7, 0x08, 0xC1, 0x4C, 0xA8, 0x35, 0xBA, 0x46, 0x31, 0xCE, 0x22, 0xCC, 0xE7, 0x1E, 0x13, 0xC1,
-    0x40, 0x38, 0x03, 0xD0, 0x13, 0x5D, 0x47, 0xAB, 0xB1, 0xB9, 0xAA, 0x7F, 0x9D, 0x40, 0x68, 0xEA,
-    0xE3, 0x3B, 0xDB, 0x84, 0xE8, 0xB1, 0xA2, 0xE8, 0x58, 0x51, 0xBC, 0x07, 0x9C, 0x61, 0xFE, 0x46,
-    0x68, 0x16, 0x5D, 0x2F, 0xAE, 0x4E, 0x8C, 0xE7, 0xE3, 0x7E, 0x56, 0xDC, 0xEB, 0xC7, 0xCC, 0xFD,
-    0xDE, 0xEF, 0xE1, 0x1C, 0xC2, 0xEE, 0x70, 0x9D, 0xF9, 0x31, 0x70, 0x9F, 0xFB, 0xF7, 0xF1, 0xE3,
-    0x01, 0x76, 0x5F, 0x79, 0x34, 0x9D, 0xFB, 0xF9, 0x17, 0x0D, 0x1B, 0x3A, 0x29, 0x83, 0x92, 0x83,
-    0x73, 0x02, 0x62, 0x18, 0x61, 0x0D, 0xC1, 0xFA, 0x06, 0xC0, 0x28, 0xBF, 0x85, 0x05, 0x8E, 0xFA,
-    0x9B, 0x14, 0x37, 0x22, 0xF4, 0x73, 0x26, 0xE0, 0xD1, 0xFD, 0x03, 0x81, 0xFD, 0xD7, 0x14, 0xFF,
-    0x17, 0xFE, 0x03, 0x1A, 0xF1, 0x08, 0xDE, 0xF4, 0x89, 0xA1, 0x18, 0x18, 0x15, 0xC0, 0x16, 0x85,
-    0x90, 0x32, 0x5C, 0x31, 0x03, 0xA4, 0x3B, 0xD9, 0xDF, 0xCA, 0x29, 0xAB, 0xB1, 0x4B, 0x7D, 0xB0,
-    0xE7, 0xCB, 0x64, 0x20, 0x14, 0xF9, 0x60, 0x02, 0x7F, 0x11, 0x04, 0x35, 0xDB, 0xCC, 0xC7, 0x30,
-    0x56, 0x3F, 0x3B, 0xB1, 0x88, 0x6F, 0x17, 0xBE, 0x7D, 0xFA, 0xFB, 0xA4, 0x5F, 0x44, 0x59, 0x83,
-    0x4C, 0x81, 0xF4, 0x7D, 0x04, 0x03, 0x9A, 0x78, 0xBA, 0x96, 0x41, 0x80, 0xE8, 0x10, 0x3D, 0xC1,
-    0xB9, 0x40, 0xDD, 0x3C, 0xFE, 0x9E, 0x12, 0x44, 0x80, 0x72, 0x7E, 0x67, 0x71, 0x08, 0xFB, 0xD4,
-    0xAF, 0x83, 0xBC, 0x7E, 0xF8, 0xAD, 0x65, 0xFE, 0x80, 0xC3, 0x53, 0x52, 0xA0, 0xFB, 0x83, 0x3C,
-    0xC6, 0x72, 0xA7, 0x02, 0xB8, 0x98, 0xF6, 0x9A, 0x2C, 0x88, 0xF8, 0xB1, 0x5F, 0x57, 0xD8, 0x59,
-    0x68, 0x73, 0x25, 0xFC, 0x2C, 0x73, 0x0D, 0x5C, 0x2D, 0x75, 0x2D, 0xBC, 0x6D, 0x39, 0xEC, 0xAE,
-    0x25, 0x35, 0x93, 0xC6, 0x35, 0x3B, 0x3C, 0x20, 0x83, 0x70, 0x02, 0x00, 0xEA, 0x2A, 0x70, 0x79,
-    0xE0, 0x54, 0xDC, 0x79, 0x50, 0x7A, 0xB1, 0x50, 0x0C, 0x92, 0xB3, 0xFC, 0x44, 0xB8, 0x4C, 0x72,
-    0xF6, 0x48, 0xE0, 0xD5, 0x3D, 0xED, 0x73, 0x9A, 0x7A, 0x54, 0x5E, 0x5C, 0x10, 0x5B, 0x43, 0xAA,
-    0xB0, 0x10, 0x2A, 0x58, 0x26, 0x70, 0x15, 0xB4, 0x29, 0x6E, 0xE1, 0x16, 0x9E, 0x9D, 0x34, 0xE8,
-    0x74, 0x25, 0x59, 0x9C, 0x54, 0x90, 0x26, 0x59, 0x98, 0x66, 0x59, 0x47, 0x27, 0x05, 0x3D, 0x80,
-    0x04, 0x9E, 0xF7, 0x5D, 0x0E, 0x58, 0x42, 0xC8, 0x00, 0x8B, 0x60, 0x0A, 0x29, 0xE1, 0x34, 0x75,
-    0x0D, 0xB8, 0x3B, 0x44, 0x88, 0xE5, 0xA0, 0x03, 0x15, 0x75, 0xA0, 0x0A, 0x5B, 0x6C, 0x2E, 0x69,
-    0xB0, 0x37, 0x69, 0xD1, 0x01, 0x54, 0x55, 0xD4, 0xC1, 0x82, 0x90, 0x22, 0x4C, 0xB2, 0x78, 0x07,
-    0x64, 0x2C, 0x45, 0xE7, 0x59, 0x49, 0x05, 0xEE, 0x6F, 0xE8, 0x00, 0xCD, 0x96, 0x90, 0xD1, 0x10,
-    0xB2, 0x2D, 0x05, 0x2F, 0xCB, 0xB9, 0x79, 0x3B, 0x53, 0xD7, 0xE7, 0x03, 0x11, 0x4E, 0x87, 0x59,
-    0xA4, 0xC6, 0x6F, 0xDC, 0xA3, 0x04, 0x53, 0x30, 0x25, 0x6F, 0x82, 0x13, 0x29, 0x62, 0xEF, 0xFC,
-    0xB0, 0x70, 0xF9, 0x8E, 0x76, 0x06, 0xAD, 0x3C, 0xD5, 0xCC, 0xD0, 0xD4, 0x8E, 0xEE, 0x68, 0xE7,
-    0xC3, 0x4D, 0xDA, 0xD9, 0xA1, 0x97, 0x36, 0xBF, 0x65, 0xE4, 0x8E, 0x02, 0xDE, 0x9F, 0xB9, 0x6F,
-    0x90, 0x4B, 0x1E, 0x03, 0x05, 0xC7, 0xA6, 0x38, 0xD5, 0xF8, 0x9D, 0x74, 0x7F, 0x37, 0x29, 0xE8,
-    0x42, 0x9F, 0x6F, 0xDE, 0xE7, 0x2C, 0x92, 0x36, 0x80, 0x96, 0xEB, 0xD2, 0x95, 0x68, 0xD5, 0x73,
-    0x5A, 0x79, 0x43, 0xFB, 0xFC, 0x54, 0x21, 0xC1, 0xEA, 0x85, 0x31, 0x06, 0xE0, 0x70, 0x17, 0x85,
-    0xA2, 0x8D, 0x94, 0xF7, 0xB5, 0x4D, 0xAF, 0x61, 0x9E, 0xD0, 0x22, 0xF7, 0x0E, 0x90, 0x06, 0xA7,
-    0xFD, 0x4B, 0x49, 0x31, 0x6F, 0x3A, 0xCA, 0x01, 0x92, 0xA8, 0x8D, 0x5B, 0x18, 0x47, 0x2D, 0xFA,
-    0x8A, 0x54, 0xF3, 0x34, 0x91, 0x0B, 0xC2, 0x92, 0x8F, 0x4B, 0x3E, 0x30, 0xF9, 0xC8, 0x44, 0x27,
-    0x43, 0xD3, 0x0F, 0x53, 0x38, 0x24, 0x12, 0xC7, 0x44, 0xE2, 0xA0, 0xE8, 0xA3, 0x62, 0x1F, 0x16,
-    0xFB, 0x72, 0xA7, 0x07, 0x70, 0x7E, 0x88, 0x24, 0xE1, 0x10, 0xCE, 0xFA, 0xE4, 0x57, 0xD8, 0x1E,
-    0x00, 0x81, 0x96, 0xB6, 0x2B, 0xA4, 0x31, 0xD7, 0x01, 0xC8, 0xEB, 0x8C, 0xF4, 0x37, 0x4E, 0x58,
-    0x63, 0x05, 0xA3, 0xEC, 0xAD, 0xA1, 0x4E, 0x5B, 0x23, 0x65, 0x6B, 0xF8, 0x64, 0xD3, 0x0B, 0xD2,
-    0x61, 0xED, 0x6E, 0x5A, 0x17, 0x97, 0x1B, 0x8C, 0xF0, 0x9C, 0x0D, 0x20, 0x07, 0xA8, 0x06, 0x0D,
-    0xC3, 0x1A, 0xBF, 0x3E, 0x6B, 0x4D, 0xEF, 0x56, 0x32, 0xA9, 0x77, 0x93, 0x7A, 0xC2, 0xB6, 0x54,
-    0x74, 0x00, 0xB1, 0x2B, 0x89, 0x73, 0xFB, 0xF4, 0x11, 0xE7, 0xFF, 0xDF, 0x34, 0xBB, 0x3F, 0xFB,
-    0xCC, 0x39, 0xFB, 0x00, 0xE6, 0x73, 0x33, 0x53, 0x8D, 0x70, 0x87, 0x20, 0xA9, 0x89, 0xFE, 0x9D,
-    0x22, 0x15, 0x8D, 0x0C, 0x2E, 0x7E, 0xF3, 0x26, 0x76, 0xC4, 0x61, 0x3D, 0x10, 0x6F, 0x93, 0xF8,
-    0xE4, 0x5D, 0xE8, 0x54, 0x78, 0x5B, 0xFF, 0xC8, 0x3D, 0xD9, 0x2C, 0x1C, 0x5F, 0x35, 0x0E, 0x10,
-    0x6F, 0xB0, 0x4D, 0xA4, 0xDF, 0x5F, 0x6A, 0x15, 0x8B, 0x5F, 0xF2, 0x39, 0x10, 0x7B, 0x3B, 0x43,
-    0x37, 0xE8, 0x38, 0x13, 0x0A, 0x80, 0xE4, 0xDB, 0x4F, 0x0D, 0xD9, 0x5F, 0x3D, 0x45, 0x3E, 0xC4,
-    0xB5, 0x59, 0xD9, 0x9A, 0x11, 0x77, 0x4C, 0xDC, 0xC9, 0x5B, 0x8F, 0xEA, 0xA0, 0xD9, 0x4D, 0x1F,
-    0x22, 0xB1, 0x68, 0x91, 0xBA, 0x24, 0x7F, 0xAB, 0x27, 0x99, 0x12, 0x7B, 0x55, 0xB3, 0x81, 0xF4,
-    0xE9, 0xD8, 0xB6, 0xB4, 0x7E, 0x21, 0xCC, 0xC7, 0xD4, 0x07, 0x08, 0x5E, 0xC4, 0x8B, 0x87, 0x7F,
-    0x0B, 0xD2, 0x16, 0xA4, 0x86, 0x35, 0xE4, 0x46, 0x2D, 0xBA, 0x98, 0x73, 0xBA, 0xB0, 0x7E, 0x86,
-    0x68, 0xEB, 0xF9, 0xAC, 0x38, 0x37, 0x50, 0x9A, 0xB3, 0x7F, 0x68, 0xED, 0x19, 0x44, 0x2D, 0x2E,
-    0x95, 0x60, 0xFC, 0x0C, 0x03, 0x1F, 0xDA, 0xA7, 0xB3, 0xCE, 0x07, 0xF3, 0x93, 0x65, 0x15, 0x6D,
-    0x53, 0xAB, 0x9E, 0x55, 0xDC, 0xFA, 0x7F, 0x7C, 0x3F, 0xED, 0x2F, 0x21, 0x1E, 0x14, 0x79, 0xA1,
-    0x2E, 0x3F, 0xD7, 0xF9, 0x2E, 0xC1, 0x64, 0x05, 0x3E, 0xA0, 0x70, 0x55, 0xE3, 0xF3, 0x85, 0x33,
-    0x0A, 0x8E, 0xA6, 0xBE, 0x9D, 0xF2, 0x74, 0x08, 0xD8, 0xD2, 0x2A, 0xE8, 0x8A, 0x3C, 0x9C, 0xF2,
-    0x78, 0xE9, 0xB4, 0x31, 0x98, 0x7E, 0xB6, 0x96, 0xF9, 0x30, 0x3F, 0x7A, 0x8B, 0xFA, 0x7B, 0x26,
-    0xAC, 0x64, 0x58, 0x25, 0x35, 0x5C, 0xC7, 0x77, 0xB1, 0x95, 0xEC, 0x3E, 0x72, 0x98, 0x5D, 0xDD,
-    0xD6, 0xDB, 0xDB, 0xFE, 0xC3, 0xD1, 0x77, 0xFE, 0x71, 0x3E, 0x1B, 0x81, 0x98, 0xD7, 0x8A, 0xDA,
-    0x77, 0xFE, 0x71, 0x98, 0xDD, 0xE0, 0xA0, 0xA8, 0x73, 0x9D, 0xCB, 0x01, 0xC9, 0x4B, 0x40, 0xB1,
-    0x36, 0x3A, 0xBF, 0x32, 0x28, 0xF5, 0x2A, 0x66, 0x79, 0x7F, 0x23, 0x38, 0x0E, 0x3E, 0x14, 0xF1,
-    0x09, 0xF3, 0xCA, 0xC2, 0xBF, 0xA5, 0x67, 0xFE, 0xF1, 0xC7, 0x40, 0x51, 0xF5, 0x9F, 0x05, 0x67,
-    0xFA, 0x1C, 0xB1, 0xE6, 0x2A, 0xD7, 0x33, 0x7D, 0x8E, 0x54, 0xD2, 0xA4, 0x4A, 0xD0, 0x05, 0x7A,
-    0x39, 0xED, 0x08, 0xE0, 0xC0, 0xC7, 0xAB, 0x99, 0xE9, 0xF2, 0x22, 0x5A, 0x41, 0x3F, 0x35, 0xE3,
-    0xF1, 0xE5, 0xFC, 0x2C, 0x7C, 0x8F, 0xE8, 0xAC, 0x7B, 0xFB, 0x1F, 0x4D, 0x94, 0xBF, 0x6F, 0xDC,
-    0x36, 0x14, 0xC7, 0xBF, 0x12, 0x71, 0x61, 0x12, 0x01, 0x65, 0x86, 0xF3, 0xE2, 0x00, 0xE1, 0xD4,
-    0x21, 0x06, 0x6A, 0xAD, 0x2D, 0x70, 0x16, 0x09, 0x64, 0xCC, 0x60, 0x0F, 0x4E, 0xD6, 0x2E, 0x1D,
-    0xBA, 0x65, 0xCD, 0xE0, 0x3B, 0x11, 0xF5, 0xD0, 0xD5, 0xFF, 0xC1, 0x75, 0x29, 0x50, 0x78, 0xF1,
-    0xD2, 0xC1, 0xC3, 0xDD, 0x89, 0x45, 0x86, 0x8E, 0xE1, 0x96, 0xD1, 0x04, 0x12, 0x20, 0x63, 0x84,
-    0x40, 0xC3, 0x15, 0x39, 0x1D, 0xFB, 0xDE, 0xC9, 0xF9, 0x21, 0x3E, 0xE8, 0x28, 0x8A, 0xE4, 0xBD,
-    0xF7, 0xFD, 0x7C, 0x29, 0x3C, 0x80, 0x48, 0x50, 0xC9, 0x95, 0x73, 0x6F, 0x94, 0x9F, 0x29, 0xBF,
-    0xD4, 0x7E, 0x59, 0xBA, 0xA5, 0x41, 0xBD, 0x85, 0xD9, 0xA0, 0x88, 0xC8, 0x9C, 0x88, 0x99, 0xCB,
-    0x6C, 0xE1, 0x95, 0x53, 0x56, 0x41, 0xA3, 0x44, 0x85, 0x23, 0xF0, 0xA5, 0x02, 0x8C, 0x47, 0xF2,
-    0x79, 0xF2, 0xC5, 0x8D, 0xD3, 0xDA, 0x56, 0xB5, 0x6D, 0x52, 0x68, 0x92, 0xC7, 0x0C, 0xF8, 0x95,
-    0xA7, 0x88, 0x14, 0x45, 0x0A, 0xD2, 0x43, 0x5D, 0xD0, 0x1F, 0xE1, 0x7E, 0xE3, 0xA0, 0xE8, 0xC1,
-    0x7D, 0x5F, 0x5B, 0xB3, 0xC5, 0xC3, 0x77, 0xC0, 0x08, 0xB4, 0x9C, 0x73, 0xB0, 0xA8, 0x1E, 0x60,
-    0xB6, 0x45, 0xD3, 0x60, 0xA1, 0x2D, 0xC5, 0xAC, 0x86, 0xE9, 0x39, 0x07, 0xBA, 0x74, 0x8A, 0x65,
-    0x0A, 0xD0, 0x1E, 0x06, 0xBC, 0xF9, 0x06, 0xA2, 0x85, 0x8C, 0xBC, 0x99, 0xB1, 0x78, 0x4C, 0x33,
-    0xC6, 0xC8, 0x92, 0x97, 0x9F, 0x62, 0xF1, 0x2A, 0xCA, 0xF7, 0x41, 0x24, 0x2B, 0x93, 0x1D, 0xEA,
-    0xA2, 0x28, 0xE9, 0xF1, 0x3F, 0xE0, 0x04, 0xC5, 0x16, 0xD4, 0x37, 0xCA, 0x1D, 0x29, 0x5F, 0x69,
-    0x6F, 0x92, 0x2B, 0xAE, 0x2C, 0xED, 0xF9, 0xBC, 0x47, 0xD3, 0x61, 0x66, 0x01, 0x87, 0x2C, 0x70,
-    0x98, 0xC4, 0x31, 0xF4, 0x69, 0xF0, 0xE0, 0x92, 0x1F, 0x9F, 0x9D, 0xA6, 0xFE, 0xD9, 0xE9, 0x70,
-    0x07, 0xF2, 0x20, 0x9D, 0xC2, 0x0F, 0x98, 0xE0, 0x25, 0xFE, 0x46, 0xBB, 0x6B, 0x1D, 0xF5, 0x7E,
-    0xA4, 0x64, 0xF8, 0x6D, 0x16, 0x6F, 0x07, 0xA9, 0x65, 0x31, 0x0F, 0xC2, 0x17, 0x34, 0x7F, 0x42,
-    0x69, 0x64, 0x23, 0x14, 0xB5, 0x57, 0x6F, 0x82, 0x3A, 0xF7, 0x5A, 0xFA, 0xB2, 0xF0, 0x15, 0xA7,
-    0x64, 0x27, 0x0A, 0xF8, 0x02, 0xE5, 0xE6, 0x36, 0x79, 0xE2, 0x32, 0xD3, 0x6E, 0x65, 0x6C, 0x9D,
-    0x6E, 0xA1, 0xF0, 0x55, 0x93, 0x6E, 0x24, 0x0B, 0xCA, 0x15, 0xEE, 0x2E, 0x59, 0x10, 0x8A, 0x6C,
-    0xCD, 0x91, 0x77, 0xC8, 0xFF, 0xB8, 0x15, 0x56, 0xA6, 0x36, 0x7F, 0xD2, 0xB2, 0x58, 0x45, 0x60,
-    0xA5, 0x7A, 0xC8, 0x96, 0x14, 0xA0, 0xC2, 0xFD, 0xC1, 0xA5, 0xA5, 0x3C, 0x45, 0xF2, 0xC4, 0x28,
-    0x13, 0x11, 0x32, 0x64, 0xC9, 0xE6, 0x5B, 0xD2, 0x9A, 0x19, 0xFD, 0xF4, 0xC2, 0x51, 0xBD, 0x0C,
-    0x88, 0x41, 0xD3, 0x9A, 0x88, 0x26, 0xB0, 0xC2, 0x37, 0x5E, 0x1D, 0x3B, 0xC3, 0x6F, 0x63, 0x4D,
-    0x44, 0x08, 0x07, 0xAB, 0x8F, 0x62, 0x07, 0x51, 0x59, 0x32, 0x08, 0xCA, 0x1E, 0xFB, 0x0D, 0xF8,
-    0x95, 0xC1, 0x9F, 0x2B, 0xA4, 0x0D, 0x5E, 0x5C, 0x70, 0x3E, 0xB4, 0x9C, 0xA6, 0xD1, 0xF6, 0x66,
-    0xCC, 0x62, 0xD6, 0x57, 0x6E, 0xAA, 0x38, 0xAA, 0x1A, 0xE5, 0x16, 0xF2, 0xDD, 0x37, 0xA0, 0x89,
-    0x2B, 0x19, 0x62, 0x07, 0x9A, 0xCA, 0xA1, 0x9C, 0x87, 0x81, 0x03, 0xB0, 0x3E, 0x92, 0xF4, 0xF9,
-    0xE0, 0xF5, 0xB1, 0xD7, 0x73, 0x47, 0x40, 0x75, 0x0F, 0xB2, 0xCA, 0xA6, 0xB4, 0x9B, 0x9D, 0x6F,
-    0x39, 0x67, 0x9A, 0x43, 0xE3, 0xC9, 0x91, 0x7A, 0x55, 0xE1, 0x0D, 0x83, 0x66, 0x8B, 0x7E, 0x05,
-    0xED, 0x90, 0x5B, 0xE1, 0x84, 0x4B, 0x7D, 0xD3, 0xF3, 0x6F, 0x6E, 0x2F, 0xFF, 0x4A, 0xFD, 0xDE,
-    0x69, 0xB3, 0xDD, 0x3B, 0x1D, 0xEE, 0x40, 0x16, 0xA5, 0x57, 0x78, 0x44, 0xC0, 0x06, 0xC0, 0xDC,
-    0xAE, 0xA9, 0x37, 0xD9, 0xE1, 0x25, 0x5B, 0x0C, 0xBC, 0xB9, 0xED, 0x00, 0x0B, 0x3F, 0xD8, 0x81,
-    0x44, 0x7D, 0x4B, 0x62, 0x10, 0x3A, 0x2A, 0xCE, 0x9E, 0x29, 0x2C, 0x4A, 0x4C, 0x57, 0xEC, 0xE5,
-    0x7B, 0x63, 0xE4, 0x3D, 0xE5, 0x8E, 0x4A, 0xD9, 0x69, 0x8D, 0x66, 0x8D, 0x05, 0x30, 0xBD, 0xCB,
-    0x54, 0xEF, 0x5C, 0x20, 0x5F, 0x33, 0xCF, 0x8A, 0x97, 0xD8, 0x05, 0x85, 0xC6, 0x74, 0x06, 0xB3,
-    0xC6, 0x9D, 0x13, 0xE4, 0xF1, 0x3A, 0xFF, 0xD8, 0xE2, 0x93, 0x47, 0x63, 0xB1, 0x62, 0xF2, 0xF2,
-    0xB5, 0xD3, 0x4F, 0xFD, 0x1E, 0x1D, 0xCC, 0x35, 0x8B, 0x47, 0xA7, 0x32, 0xBB, 0x62, 0x51, 0x17,
-    0x15, 0xD6, 0x0B, 0x2E, 0x71, 0xDF, 0x22, 0x27, 0xF0, 0x11, 0x22, 0x40, 0xDE, 0x38, 0x99, 0x02,
-    0x9D, 0x0C, 0x75, 0x1E, 0x94, 0x60, 0xC7, 0x1D, 0xEE, 0x1C, 0x37, 0x1E, 0x7D, 0x33, 0xE7, 0x9F,
-    0xB6, 0xF8, 0x37, 0xA8, 0x39, 0xD4, 0x86, 0x43, 0x2F, 0x71, 0x58, 0x82, 0x2C, 0x39, 0x1E, 0xD9,
-    0xBC, 0x15, 0x51, 0xD0, 0x21, 0x96, 0xEC, 0xDF, 0x2F, 0xDF, 0x00, 0x2A, 0xF3, 0xE7, 0xDF, 0x63,
-    0x91, 0x3E, 0x74, 0xC5, 0xAB, 0xB6, 0x53, 0xE7, 0xB1, 0xA3, 0xAD, 0x5B, 0x4D, 0xFB, 0x94, 0xC5,
-    0x6F, 0xB1, 0xA2, 0xBF, 0x1A, 0x8F, 0x32, 0xFB, 0xDD, 0x8C, 0x39, 0x94, 0xC7, 0x6E, 0x30, 0xF8,
-    0x99, 0xA6, 0xC3, 0x8D, 0xF5, 0x21, 0x4E, 0x68, 0xF9, 0xFC, 0x73, 0x56, 0x4F, 0xA2, 0x12, 0x81,
-    0xCF, 0xC1, 0x9C, 0x4D, 0x77, 0xF4, 0x0B, 0xCE, 0xC0, 0x71, 0x0D, 0xC8, 0xB5, 0x5E, 0x96, 0xD0,
-    0x41, 0x76, 0xD8, 0x9C, 0x6C, 0x9A, 0x6E, 0xDF, 0x66, 0x56, 0xBA, 0xB2, 0xAB, 0x3B, 0x8D, 0x43,
-    0xFA, 0x0C, 0x4D, 0x30, 0xB5, 0xC6, 0xDF, 0xB7, 0xFF, 0x03, 0x4D, 0x56, 0xBF, 0x6F, 0xDD, 0xD6,
-    0x15, 0x3E, 0x24, 0x2D, 0x31, 0x35, 0x81, 0xDC, 0x0E, 0xE9, 0xD0, 0xB8, 0x15, 0x33, 0xB7, 0x71,
-    0xB8, 0x7A, 0x70, 0x7C, 0xAF, 0xAC, 0x21, 0xE3, 0x13, 0x02, 0xA8, 0x19, 0xD3, 0x3F, 0xA0, 0x40,
-    0x96, 0x0C, 0x19, 0xEA, 0x5E, 0xCA, 0x06, 0xBA, 0x78, 0xC8, 0x9B, 0x32, 0xA6, 0x1E, 0x32, 0x04,
-    0x6E, 0x01, 0x65, 0x08, 0x50, 0x07, 0x90, 0x4D, 0xDA, 0x1A, 0x34, 0x08, 0x81, 0x08, 0x18, 0x48,
-    0x86, 0x02, 0x15, 0xF3, 0x0B, 0x41, 0xAA, 0x41, 0x57, 0x0A, 0x8D, 0xD0, 0xCF, 0x97, 0x3C, 0xFD,
-    0xCE, 0xE5, 0x53, 0x62, 0xE2, 0x9D, 0xC3, 0xF7, 0xF8, 0x78, 0xCF, 0xCF, 0xEF, 0x3B, 0xF7, 0x12,
-    0xE1, 0xB2, 0x3D, 0x25, 0xDC, 0x93, 0xE2, 0x8E, 0xF2, 0xF6, 0xD7, 0xA4, 0x6B, 0x3C, 0x5A, 0xDF,
-    0xDA, 0xB4, 0x19, 0xB7, 0x95, 0xE2, 0xA6, 0x52, 0xDF, 0x19, 0x3B, 0xAB, 0x49, 0x33, 0x9B, 0x82,
-    0x99, 0x52, 0x08, 0x69, 0x59, 0x07, 0xA9, 0x86, 0x49, 0xD8, 0xE3, 0x87, 0xFA, 0x3D, 0xD1, 0xDA,
-    0xAB, 0xB4, 0x8A, 0x1F, 0x9A, 0x07, 0x62, 0xF6, 0x09, 0x9F, 0x76, 0xD9, 0xF0, 0x75, 0xAD, 0xCE,
-    0xF6, 0xCA, 0xE2, 0xF1, 0x6D, 0xA3, 0x0F, 0x66, 0xA4, 0x0F, 0xD7, 0x48, 0x7F, 0xF8, 0x2A, 0xE9,
-    0x7F, 0x5D, 0x25, 0xED, 0x3F, 0x25, 0xDD, 0x9D, 0x52, 0x3E, 0x32, 0xFC, 0x33, 0xE2, 0x80, 0x1C,
-    0xCD, 0x29, 0x9D, 0x11, 0xAD, 0xAC, 0xD0, 0x74, 0xAD, 0xF2, 0xB7, 0xB0, 0xE7, 0x27, 0x7B, 0xE6,
-    0xD3, 0x14, 0xAE, 0x94, 0x23, 0xC4, 0x4A, 0x54, 0x3C, 0x3C, 0x75, 0xFA, 0xD1, 0x4F, 0xAD, 0xDE,
-    0xE3, 0x46, 0xDF, 0xEA, 0x49, 0xDF, 0x72, 0xA4, 0xF7, 0x21, 0x07, 0x2D, 0x15, 0x27, 0x5F, 0x04,
-    0x9B, 0x12, 0x6F, 0x84, 0x70, 0xC2, 0xA5, 0x91, 0xA8, 0x45, 0xA2, 0x15, 0x84, 0xB7, 0x36, 0x69,
-    0x24, 0x8A, 0xF0, 0x57, 0x0C, 0x9B, 0xF1, 0x78, 0xD7, 0xC0, 0x7F, 0x09, 0x31, 0xE9, 0xD3, 0x2D,
-    0xCA, 0xC4, 0xC7, 0x13, 0x83, 0x57, 0x6B, 0x48, 0x49, 0x79, 0x03, 0x7F, 0xA8, 0x8D, 0xD4, 0x67,
-    0x79, 0xD9, 0xA7, 0x58, 0x26, 0xE5, 0x48, 0xC5, 0xBE, 0xEA, 0x5E, 0x80, 0x42, 0x54, 0xE1, 0xD5,
-    0xB8, 0xFA, 0xDF, 0x5C, 0xF2, 0x69, 0xE4, 0x5B, 0x89, 0x65, 0x90, 0x0C, 0xE6, 0x25, 0x26, 0x83,
-    0x82, 0xD1, 0xE4, 0x99, 0xD2, 0x0E, 0x0A, 0x75, 0x6D, 0xA5, 0xC0, 0x8D, 0xA8, 0xC9, 0xFE, 0x47,
-    0xA2, 0x62, 0x27, 0x3A, 0xAD, 0x29, 0xBA, 0xF3, 0x40, 0x8D, 0x94, 0xFC, 0xC8, 0x27, 0x08, 0xF0,
-    0x19, 0xE3, 0xA5, 0x74, 0xCC, 0x87, 0xA2, 0xC9, 0xBC, 0xEA, 0xF2, 0x46, 0x39, 0xE5, 0xF2, 0x1A,
-    0xD2, 0x14, 0xB5, 0x6A, 0x8B, 0x5A, 0xD7, 0x79, 0xA3, 0x6B, 0x5D, 0x16, 0x35, 0x97, 0xD6, 0xE8,
-    0x47, 0xD0, 0x28, 0x0D, 0x9B, 0x8A, 0xF4, 0x8C, 0xE1, 0xDA, 0x16, 0x2C, 0x99, 0xBF, 0x1E, 0x1C,
-    0xF5, 0xA2, 0xA2, 0x36, 0x7C, 0xAF, 0x68, 0x97, 0xD8, 0xF4, 0x11, 0xAF, 0x77, 0x22, 0x31, 0xDF,
-    0x74, 0xC9, 0xF1, 0x2D, 0x77, 0x89, 0x8F, 0x7B, 0x84, 0xE8, 0xB3, 0xFF, 0x1C, 0x34, 0xD9, 0xFE,
-    0x61, 0x6D, 0x99, 0x9D, 0x48, 0xBE, 0x71, 0x64, 0x8A, 0xE4, 0x84, 0x74, 0xC2, 0x90, 0x91, 0xAE,
-    0x41, 0x6E, 0x24, 0x43, 0x80, 0x14, 0x2E, 0xC9, 0x56, 0x34, 0xAA, 0x41, 0xC3, 0x3B, 0x48, 0x25,
-    0xF2, 0x52, 0xD4, 0x18, 0xFA, 0x1E, 0x25, 0xBD, 0x3A, 0xED, 0x28, 0xE9, 0xF2, 0x6F, 0x9E, 0x98,
-    0x74, 0xC1, 0x47, 0xC8, 0x88, 0xD9, 0x72, 0x99, 0xF1, 0x80, 0x1A, 0xAA, 0xC5, 0xA6, 0x6A, 0x48,
-    0x3E, 0x35, 0xE5, 0xE1, 0x53, 0x84, 0x0F, 0xAA, 0x58, 0xFC, 0x20, 0x3A, 0x1F, 0x49, 0x1B, 0xCA,
-    0x86, 0xF3, 0x56, 0x00, 0x23, 0xC1, 0x97, 0xE4, 0x12, 0x4A, 0x18, 0x0F, 0x16, 0x7E, 0x13, 0x9F,
-    0x37, 0xD5, 0x3C, 0xE9, 0xF3, 0xC7, 0xDC, 0x25, 0x5D, 0x71, 0xC4, 0x2E, 0x75, 0xF6, 0xB0, 0xD9,
-    0x44, 0x27, 0x66, 0x30, 0x0E, 0x5F, 0x9D, 0x00, 0x3F, 0x1B, 0x29, 0xFF, 0x12, 0xE9, 0x96, 0xC5,
-    0x1E, 0xF0, 0x51, 0x17, 0x7B, 0x1E, 0x2E, 0xF5, 0x4D, 0x6F, 0xA0, 0xB7, 0xFD, 0x67, 0x55, 0x6D,
-    0xD7, 0x87, 0x4A, 0xEA, 0x37, 0xDA, 0x73, 0x8F, 0x49, 0x93, 0x97, 0x37, 0xD2, 0x46, 0x97, 0xBB,
-    0xA2, 0x7C, 0xDA, 0x54, 0xDB, 0x5D, 0x5A, 0xF3, 0x86, 0x4B, 0x1F, 0x3E, 0xDB, 0x68, 0xB3, 0xBD,
-    0x93, 0x37, 0x9A, 0x6C, 0xEF, 0x70, 0x56, 0xA3, 0xA1, 0xA1, 0x58, 0xEC, 0xD4, 0x91, 0xD2, 0xA4,
-    0x76, 0xD4, 0x0D, 0x52, 0xF7, 0xD5, 0x2E, 0x29, 0xAF, 0x40, 0xBA, 0x3E, 0x47, 0x00, 0x5D, 0xEE,
-    0x00, 0x69, 0x00, 0x5A, 0x35, 0xB9, 0xB0, 0x8F, 0xCB, 0xB4, 0x11, 0x88, 0x66, 0x8D, 0x80, 0x1E,
-    0x25, 0xF0, 0x34, 0xAA, 0x3A, 0xF2, 0x2F, 0xD9, 0xBC, 0x8E, 0xFB, 0xC1, 0x16, 0x65, 0xDC, 0xF9,
-    0xBF, 0x69, 0x93, 0x9C, 0xFA, 0x07, 0x9A, 0x92, 0xB3, 0x7E, 0xD0, 0x94, 0x9E, 0xE1, 0x11, 0x65,
-    0xDF, 0x9C, 0xFA, 0xFB, 0xA4, 0x1E, 0x9F, 0xF6, 0x03, 0xA9, 0x7D, 0x3C, 0x22, 0x75, 0xF0, 0xD5,
-    0x9B, 0x3D, 0xE5, 0xEF, 0x37, 0x00, 0x5A, 0x31, 0x5B, 0x54, 0xAD, 0x60, 0x00, 0x8D, 0xD1, 0x39,
-    0x3F, 0x0D, 0x89, 0x0C, 0x4B, 0x24, 0x86, 0xB2, 0x45, 0xF2, 0x57, 0xF4, 0x96, 0xFC, 0x93, 0x00,
-    0x98, 0xF6, 0x4B, 0x27, 0x8F, 0x9C, 0x00, 0x19, 0xD1, 0xF5, 0x05, 0x54, 0x0B, 0x74, 0x17, 0x4D,
-    0xE8, 0x08, 0x94, 0xC0, 0x4C, 0x94, 0x81, 0x02, 0xAE, 0x65, 0x40, 0xA0, 0xA0, 0x15, 0x40, 0x3B,
-    0x5C, 0xA3, 0xE7, 0x2E, 0x21, 0x5D, 0x60, 0xDD, 0xF2, 0xAA, 0xBE, 0x05, 0x69, 0x50, 0x65, 0x3C,
-    0xD1, 0xCD, 0x9F, 0x85, 0x0E, 0x11, 0x10, 0x99, 0x8D, 0x1F, 0xC3, 0x84, 0xA7, 0x4B, 0xB8, 0x0B,
-    0x31, 0x34, 0x5C, 0x5B, 0x78, 0x16, 0xD8, 0x88, 0xA4, 0x7D, 0x14, 0x66, 0x44, 0x24, 0x6E, 0xEC,
-    0xB8, 0x34, 0x45, 0x95, 0x21, 0x8E, 0xF0, 0x64, 0x4C, 0x3C, 0x52, 0x41, 0x4B, 0x23, 0x8F, 0x48,
-    0x63, 0x6F, 0x4B, 0x00, 0x00, 0xCF, 0x93, 0x85, 0x17, 0x5B, 0x30, 0x64, 0x05, 0x8D, 0x39, 0x0F,
-    0x86, 0xD4, 0x99, 0xCC, 0x91, 0xAF, 0x06, 0x61, 0x2B, 0x0B, 0xB3, 0x65, 0xAA, 0xD5, 0xB0, 0xA4,
-    0x4B, 0x2C, 0xD3, 0x06, 0x34, 0x4F, 0x05, 0xF2, 0xD2, 0x00, 0xE6, 0x7E, 0xE5, 0xED, 0x27, 0x9B,
-    0x58, 0x23, 0xC9, 0x19, 0xCA, 0xB1, 0x0A, 0x0E, 0x64, 0x14, 0xC4, 0xFC, 0x5F, 0x81, 0x11, 0xFD,
-    0xCA, 0xE2, 0x37, 0x56, 0xC7, 0x30, 0x03, 0x6C, 0xD2, 0x6B, 0xCF, 0x4D, 0x96, 0xE5, 0x75, 0x69,
-    0xC2, 0xA8, 0xE5, 0x71, 0x9A, 0x44, 0x81, 0xE8, 0x2F, 0x91, 0x2C, 0xA4, 0xE8, 0x63, 0x19, 0x69,
-    0x78, 0x3B, 0x15, 0xE6, 0x24, 0x7D, 0xE2, 0x43, 0x07, 0xC2, 0x2D, 0x75, 0xE1, 0x96, 0xB9, 0xA4,
-    0x5F, 0x9D, 0x03, 0x27, 0x69, 0x0F, 0x10, 0xAA, 0x36, 0x73, 0x28, 0x82, 0x6A, 0xD4, 0x59, 0x5F,
-    0x08, 0x4C, 0x1F, 0xBB, 0xDC, 0x14, 0x8F, 0xF8, 0x96, 0x2B, 0x8C, 0xE6, 0x11, 0x28, 0x87, 0x87,
-    0x2E, 0x83, 0x2F, 0x3B, 0x1A, 0x75, 0x12, 0xF8, 0xA8, 0xA6, 0xC9, 0x92, 0x2F, 0x6F, 0x65, 0xB8,
-    0x15, 0x66, 0x1A, 0x8C, 0xF4, 0xFC, 0x4D, 0xAE, 0xC0, 0x2D, 0x2D, 0x84, 0x92, 0xE9, 0x47, 0x8C,
-    0xF7, 0xA3, 0x21, 0x28, 0x2C, 0x89, 0x80, 0x38, 0xA8, 0x07, 0xB4, 0x1C, 0xFD, 0x2C, 0xD1, 0x57,
-    0x20, 0xDC, 0x2B, 0x16, 0xD6, 0xDF, 0x15, 0xF5, 0x14, 0x95, 0x0E, 0xB0, 0xC9, 0xF8, 0xB0, 0xA5,
-    0xBC, 0x40, 0x82, 0xAF, 0xFF, 0x4E, 0xB2, 0xBC, 0x10, 0x52, 0x0D, 0x4A, 0x66, 0x78, 0x22, 0xF3,
-    0x21, 0x11, 0x17, 0xB1, 0x78, 0xC4, 0x80, 0x46, 0x77, 0x0D, 0xC6, 0x6A, 0x9D, 0x78, 0xE0, 0x0C,
-    0xF5, 0x97, 0xD1, 0x93, 0x3A, 0xD5, 0x14, 0x8B, 0x9D, 0x56, 0x0B, 0x91, 0x5A, 0x36, 0x78, 0x0E,
-    0xA4, 0xF4, 0x90, 0x79, 0x18, 0xAD, 0x00, 0xE0, 0xB4, 0x21, 0xD1, 0x34, 0x5B, 0x97, 0xD7, 0x5A,
-    0xD8, 0x3F, 0xFA, 0x50, 0x6E, 0xB1, 0x3B, 0xC0, 0x93, 0xFF, 0x0B, 0xB8, 0x77, 0x0F, 0xCE, 0x9D,
-    0x20, 0xAC, 0x71, 0xD2, 0x47, 0x28, 0xBB, 0x8D, 0x4C, 0xEC, 0x75, 0xA8, 0x6A, 0x23, 0x28, 0x8C,
-    0x82, 0xEA, 0x8D, 0xFD, 0x8E, 0xEC, 0xFE, 0x6D, 0xEC, 0x28, 0xC7, 0x33, 0x37, 0x8D, 0xE9, 0x4C,
-    0x54, 0xE0, 0x09, 0xBD, 0x26, 0x2E, 0x2E, 0x4F, 0x65, 0x94, 0x74, 0x74, 0xA8, 0x82, 0x5B, 0xD6,
-    0x23, 0x16, 0x95, 0xFC, 0x04, 0x27, 0xD9, 0x8F, 0x9D, 0x94, 0x82, 0xDB, 0xD5, 0xEA, 0x78, 0x04,
-    0xB8, 0x6E, 0xF6, 0x08, 0xEA, 0x9F, 0xE8, 0x0B, 0x9E, 0x95, 0xE9, 0xF0, 0x27, 0x44, 0xD5, 0x47,
-    0x1E, 0x1D, 0x86, 0x52, 0x2D, 0x60, 0x83, 0x49, 0x37, 0x10, 0x60, 0xB8, 0x1C, 0x36, 0xC5, 0x38,
-    0xB1, 0x53, 0x3C, 0x7F, 0x94, 0x2F, 0xB9, 0xA0, 0xDC, 0x1F, 0xEE, 0x56, 0x1D, 0xF2, 0xEA, 0xA2,
-    0xB0, 0xCB, 0xC9, 0xA6, 0xC6, 0x0E, 0xD2, 0xCA, 0x0E, 0x15, 0x6A, 0x52, 0xBF, 0x8C, 0x90, 0x47,
-    0xE0, 0x73, 0x44, 0x30, 0xFD, 0xB2, 0x24, 0xB9, 0x6C, 0x57, 0xB2, 0xDB, 0x78, 0xAC, 0xEB, 0x13,
-    0xDE, 0xFD, 0x44, 0xF5, 0xEF, 0xA1, 0x18, 0xF7, 0xC0, 0xEA, 0x2E, 0x94, 0x42, 0x6F, 0x83, 0x75,
-    0xD7, 0x41, 0x96, 0xEB, 0x0D, 0xD9, 0x0D, 0x91, 0x1A, 0x45, 0x00, 0xD7, 0x8F, 0xFF, 0x4E, 0x52,
-    0xF7, 0xEC, 0x7C, 0x47, 0x85, 0xA9, 0x50, 0x83, 0xDF, 0xCA, 0x6E, 0x75, 0x2D, 0x42, 0xA6, 0xF7,
-    0x13, 0x07, 0x57, 0x3B, 0x8B, 0x32, 0x97, 0x3D, 0xAA, 0x10, 0x95, 0xF4, 0x45, 0x03, 0x32, 0x23,
-    0xA5, 0xD4, 0x21, 0xB2, 0xCC, 0x21, 0x34, 0xE5, 0x2C, 0x18, 0xD8, 0x5A, 0x21, 0x5F, 0xF5, 0x33,
-    0xF9, 0xE4, 0xDC, 0x50, 0x56, 0x5E, 0xC8, 0xD7, 0x3F, 0x3F, 0x3B, 0x10, 0xEF, 0x5C, 0x3A, 0x18,
-    0x26, 0x08, 0x32, 0xE7, 0xF5, 0xF9, 0xB4, 0x77, 0x4E, 0x2A, 0xB4, 0x3B, 0x90, 0xC9, 0xCA, 0x78,
-    0x11, 0x72, 0xA2, 0xDA, 0xE1, 0xA1, 0x59, 0x7B, 0x79, 0x4D, 0x1B, 0xCB, 0x95, 0x36, 0xFF, 0x3E,
-    0x38, 0xB4, 0x64, 0x0F, 0x66, 0x23, 0x4A, 0xB2, 0x23, 0xA7, 0x1D, 0xC0, 0x4E, 0xE5, 0x68, 0xDE,
-    0xDA, 0x65, 0x28, 0x84, 0xDB, 0x16, 0x93, 0x34, 0xBF, 0xD9, 0xDA, 0x32, 0x13, 0x51, 0xB9, 0x44,
-    0x39, 0x0D, 0xCB, 0x86, 0x2D, 0xF6, 0xCE, 0x29, 0xBD, 0xA4, 0xB5, 0xB0, 0x32, 0xE9, 0xA7, 0x1D,
-    0x3C, 0xEB, 0x96, 0x03, 0x0A, 0x09, 0x67, 0x41, 0xEA, 0x00, 0xF1, 0x8B, 0x3B, 0x8B, 0x50, 0xB2,
-    0x95, 0xB7, 0xF1, 0x42, 0x21, 0xDB, 0x3B, 0xDA, 0x3F, 0x9E, 0xB7, 0x67, 0x3A, 0x29, 0x08, 0x13,
-    0xC4, 0x86, 0xD8, 0x9B, 0x28, 0x40, 0xBF, 0x60, 0x79, 0x5C, 0xC5, 0xEF, 0xA9, 0x7D, 0x05, 0xFE,
-    0xD3, 0x00, 0x6F, 0x22, 0x03, 0x52, 0x66, 0x19, 0xD6, 0xEC, 0xB8, 0x8B, 0x73, 0xD5, 0x62, 0x0A,
-    0x60, 0xD7, 0x57, 0x8D, 0x2D, 0xF3, 0x47, 0x42, 0x8B, 0x21, 0x0C, 0x4E, 0xCD, 0xE6, 0x17, 0x32,
-    0xC3, 0x47, 0xB1, 0x4B, 0x74, 0xF5, 0x2A, 0xD1, 0x5F, 0x21, 0xF6, 0xC1, 0xDD, 0x39, 0xA0, 0xE3,
-    0x11, 0xDB, 0x18, 0x2D, 0xEE, 0x56, 0x84, 0x0D, 0x88, 0xCE, 0x3E, 0x7F, 0x11, 0x90, 0xB8, 0x1C,
-    0x8F, 0xCF, 0x7C, 0xEC, 0xB6, 0xEF, 0x48, 0x5C, 0xBA, 0xBF, 0x40, 0x17, 0xA4, 0xD5, 0x68, 0x0B,
-    0x15, 0xE7, 0xB3, 0x2C, 0xF2, 0xB4, 0x9C, 0x6C, 0xF1, 0x34, 0xAE, 0x96, 0xDB, 0x45, 0xB4, 0x33,
-    0x1A, 0x49, 0x37, 0x40, 0xD1, 0xC7, 0xFC, 0x8F, 0xEF, 0x31, 0x91, 0x55, 0xC3, 0x69, 0x97, 0xD7,
-    0x55, 0xE6, 0x8A, 0xBA, 0x52, 0xAD, 0x2E, 0x59, 0x35, 0xDA, 0x8C, 0x98, 0x42, 0x98, 0x24, 0x50,
-    0x5E, 0xA6, 0xA8, 0x47, 0x41, 0x60, 0x26, 0x47, 0xA3, 0x85, 0xD5, 0x72, 0x7C, 0xD4, 0x1F, 0xC8,
-    0x16, 0x8F, 0xC3, 0x0A, 0xEA, 0x81, 0x8D, 0x97, 0x38, 0x19, 0x2E, 0x72, 0x25, 0xC3, 0xD8, 0xA9,
-    0x40, 0x9B, 0xCD, 0xE0, 0xF8, 0x8F, 0xE3, 0x1D, 0xBC, 0x8E, 0xE3, 0xDE, 0x62, 0x1E, 0x2A, 0x19,
-    0x0E, 0x60, 0x14, 0xC9, 0xE1, 0x31, 0x55, 0x92, 0xF9, 0x8B, 0x13, 0x81, 0x84, 0x80, 0xB5, 0x04,
-    0x07, 0x2C, 0x0F, 0x98, 0x4F, 0xBC, 0x7B, 0x05, 0x55, 0xBD, 0xF2, 0x2E, 0xCA, 0x7E, 0xE5, 0x13,
-    0xA8, 0x57, 0xEE, 0x50, 0x98, 0xBD, 0xE1, 0x3C, 0x36, 0x65, 0xF4, 0x73, 0x96, 0xD3, 0x44, 0xD1,
-    0xDF, 0x85, 0x31, 0xD2, 0x89, 0x72, 0x93, 0xA2, 0x68, 0x1D, 0xEF, 0xDD, 0x86, 0xE0, 0xC0, 0x5A,
-    0x8D, 0x72, 0x00, 0x11, 0x96, 0x36, 0xD1, 0xF0, 0x4E, 0x1B, 0x79, 0xE5, 0x62, 0xAF, 0x5A, 0xC1,
-    0x7F, 0x38, 0x53, 0x22, 0x2F, 0x1C, 0x6E, 0x48, 0x9D, 0xB2, 0x40, 0xBF, 0x44, 0x15, 0xCA, 0xBC,
-    0xB6, 0xA6, 0x78, 0x88, 0xC3, 0x13, 0x5A, 0xAC, 0x43, 0xDE, 0xF3, 0x60, 0x2A, 0x45, 0xD0, 0x2B,
-    0x17, 0x88, 0xFE, 0x0F, 0x63, 0x0D, 0xB1, 0xFF, 0x5B, 0xFF, 0xA7, 0xFE, 0x0F, 0x00, 0xCD, 0x94,
-    0x31, 0x72, 0x9C, 0x40, 0x14, 0x44, 0x7B, 0x21, 0x20, 0x20, 0x98, 0x03, 0x28, 0x20, 0x71, 0xA2,
-    0x88, 0x23, 0xC0, 0xCD, 0x16, 0xDD, 0x40, 0x47, 0x70, 0xE0, 0xC0, 0x2E, 0xDF, 0x40, 0xC9, 0x50,
-    0xF2, 0x05, 0x28, 0x9F, 0x60, 0x74, 0x83, 0x09, 0x08, 0x08, 0x86, 0xF9, 0xEE, 0xFF, 0x07, 0xE4,
-    0x2D, 0xD9, 0x91, 0x94, 0x88, 0xA0, 0xB7, 0x96, 0xDD, 0xF9, 0xF3, 0x7A, 0xBA, 0x01, 0x28, 0x57,
-    0xBF, 0xB9, 0x1D, 0xF0, 0xDB, 0x90, 0x70, 0x91, 0x55, 0x12, 0xAA, 0x84, 0x0C, 0xD4, 0xE9, 0xC2,
-    0xDB, 0x4D, 0xFE, 0x99, 0x1F, 0x31, 0x88, 0x48, 0x80, 0xA7, 0x2E, 0x70, 0xB1, 0xD9, 0x00, 0x17,
-    0x9A, 0xA8, 0xDA, 0x52, 0xBB, 0xC5, 0x51, 0xFB, 0xD9, 0x05, 0x60, 0x98, 0xBB, 0x85, 0x3A, 0xF5,
-    0x33, 0x75, 0x54, 0xBD, 0xF2, 0x1B, 0xC7, 0x9B, 0x0A, 0xAE, 0x23, 0x38, 0xDC, 0x03, 0x1C, 0x2E,
-    0xBA, 0x49, 0x95, 0x8F, 0xBD, 0xE1, 0xE3, 0xC0, 0xC1, 0x7E, 0x1A, 0x16, 0xBC, 0x5E, 0x7D, 0x1A,
-    0xA8, 0x3E, 0x79, 0x2E, 0x93, 0x95, 0xCB, 0xAA, 0x1D, 0xF7, 0xBA, 0x4C, 0x7F, 0x6C, 0xF2, 0xC3,
-    0x77, 0xCE, 0x97, 0x67, 0x5D, 0x2C, 0xBF, 0xA8, 0x2E, 0xD6, 0xDB, 0xAB, 0x86, 0x66, 0x55, 0xB6,
-    0xB6, 0xB0, 0x45, 0x65, 0x33, 0xC2, 0xA9, 0x10, 0xAA, 0x5E, 0x8D, 0x90, 0x6C, 0xB3, 0xB2, 0x29,
-    0x61, 0xD6, 0xC1, 0x6A, 0xFC, 0xDC, 0xC4, 0x17, 0x8D, 0xA6, 0x13, 0x70, 0xCB, 0xA6, 0x66, 0xC8,
-    0x86, 0xBF, 0x6C, 0x66, 0x49, 0x87, 0x90, 0x6D, 0x7F, 0x3F, 0x9B, 0x9D, 0xDB, 0x47, 0xD8, 0x4A,
-    0xAA, 0x3D, 0xCA, 0xD9, 0x5E, 0xA7, 0x92, 0x2C, 0x79, 0x2D, 0xDB, 0xFB, 0x33, 0xDD, 0x23, 0xDF,
-    0x1F, 0xB0, 0x84, 0x5F, 0xB4, 0x06, 0xFC, 0xFC, 0x6D, 0xB4, 0xCD, 0x56, 0xA5, 0x92, 0x73, 0x21,
-    0x6E, 0xED, 0x53, 0xB3, 0x56, 0x76, 0x4D, 0xBB, 0x8D, 0x25, 0x6F, 0xE3, 0x9F, 0x8E, 0xFC, 0x49,
-    0xED, 0x96, 0x92, 0x7A, 0x57, 0xF8, 0xCD, 0x8D, 0x26, 0xAF, 0x4E, 0x2C, 0xFB, 0x33, 0xFD, 0x33,
-    0xFF, 0xB3, 0x01, 0x67, 0x07, 0xDE, 0xB6, 0xE0, 0xF4, 0x63, 0x45, 0x52, 0x3F, 0xE3, 0xE1, 0x07,
-    0xC5, 0x8F, 0x3F, 0xFC, 0xC8, 0xE1, 0x27, 0xFF, 0xDF, 0x4F, 0xFD, 0x79, 0xFC, 0xDC, 0xC9, 0xA3,
-    0xDE, 0x15, 0x12, 0x5E, 0x44, 0xF4, 0x69, 0xDB, 0xD9, 0x1E, 0xD4, 0x76, 0xE6, 0xCD, 0x5A, 0xE7,
-    0xAF, 0x68, 0x63, 0x2F, 0x91, 0xDC, 0x83, 0xEA, 0x4D, 0x5F, 0xBA, 0xF9, 0xF6, 0x69, 0x73, 0xA5,
-    0xCB, 0xFF, 0xF6, 0x45, 0x94, 0xAD, 0xA7, 0xEE, 0x70, 0xF9, 0x68, 0x4D, 0x55, 0x1E, 0x1B, 0x53,
-    0x59, 0x4D, 0x83, 0xE9, 0x78, 0xCB, 0xD6, 0xCA, 0x72, 0xB2, 0xC1, 0xD8, 0x2A, 0xEB, 0x4A, 0xB5,
-    0x5E, 0xEC, 0x35, 0x51, 0xE7, 0x6F, 0xB5, 0xA4, 0x5E, 0x56, 0x27, 0x89, 0x6C, 0x2E, 0x7C, 0xE1,
-    0xFB, 0xA0, 0x0B, 0xE0, 0xFB, 0xC0, 0x6D, 0xA4, 0xE6, 0xFA, 0x91, 0x84, 0x95, 0x04, 0x23, 0x8C,
-    0xDA, 0x68, 0x17, 0xC9, 0x36, 0xB6, 0xAA, 0x4F, 0x3E, 0x90, 0xCA, 0xCB, 0xDC, 0xF1, 0x08, 0x33,
-    0xFF, 0x7C, 0xEC, 0xFA, 0x07, 0x45, 0x8D, 0xC1, 0x0D, 0x80, 0x30, 0x0C, 0x03, 0x23, 0xF2, 0xE4,
-    0x91, 0x01, 0xD8, 0x85, 0xC2, 0x64, 0x88, 0xC9, 0x28, 0x1B, 0x74, 0x04, 0x46, 0xE8, 0x07, 0x09,
-    0xA1, 0x8A, 0x23, 0x11, 0x0F, 0x22, 0xC7, 0x0F, 0x5B, 0xB6, 0x45, 0x54, 0xE2, 0x2C, 0x07, 0xA7,
-    0x1A, 0x4C, 0x73, 0x52, 0x08, 0x79, 0xEA, 0xDD, 0x18, 0xA5, 0x73, 0x83, 0x61, 0x6E, 0x21, 0xEF,
-    0x88, 0xC1, 0x4A, 0x4E, 0x3C, 0x4A, 0xDD, 0xB8, 0x8C, 0x2B, 0x51, 0x1D, 0xC6, 0xB1, 0x91, 0x95,
-    0x33, 0xC2, 0x10, 0x45, 0xE9, 0xC4, 0xB3, 0x56, 0x16, 0xEF, 0xD1, 0xB2, 0x44, 0xFF, 0xDD, 0xFE,
-    0xAD, 0x6F, 0xB7, 0xF3, 0x7F, 0x01,
+    0x47, 0x4F, 0x9F, 0x85, 0x53, 0x0C, 0x85, 0xD2, 0xF7, 0xAC, 0xAC, 0x06, 0xED, 0x23, 0xA5, 0x1F,
+    0xBF, 0x89, 0xC4, 0xFC, 0x2F, 0x2B, 0x0A, 0xB4, 0x83, 0xB9, 0x40, 0x7D, 0x84, 0xB2, 0xC3, 0x2A,
+    0xB8, 0x0D, 0x84, 0x9C, 0xC4, 0x86, 0x33, 0xF2, 0xD3, 0xF1, 0x3A, 0x96, 0x17, 0x0B, 0x06, 0xE8,
+    0xC7, 0x9A, 0x56, 0x73, 0xDD, 0x0C, 0x56, 0xE0, 0x84, 0x0F, 0x78, 0xA5, 0x23, 0x1C, 0x03, 0x85,
+    0xC4, 0x9C, 0x7A, 0x98, 0x3B, 0xB1, 0xA0, 0x51, 0xB7, 0x87, 0x79, 0x6E, 0x9C, 0x47, 0x37, 0x99,
+    0x7F, 0xE1, 0x30, 0x3A, 0xDF, 0x4B, 0xF3, 0xF4, 0xBE, 0x71, 0xAA, 0x98, 0xA9, 0xC3, 0x42, 0x0F,
+    0x10, 0x27, 0x75, 0xD9, 0x25, 0x0F, 0xC0, 0x47, 0x31, 0x8D, 0xEC, 0x9C, 0xE5, 0x61, 0x3B, 0x63,
+    0xDB, 0xA3, 0xA2, 0x7F, 0xFA, 0x38, 0xFE, 0xC9, 0x4A, 0x59, 0xCF, 0xF2, 0x5D, 0x44, 0x79, 0x54,
+    0xB4, 0xAB, 0xD1, 0x87, 0x5C, 0xC3, 0x09, 0x55, 0xDB, 0xF8, 0xEA, 0x80, 0xE7, 0x91, 0xC0, 0xF0,
+    0xB0, 0xE3, 0xD3, 0x95, 0x7C, 0x77, 0xC8, 0x11, 0xEE, 0xAE, 0x76, 0x78, 0xC9, 0x38, 0xB9, 0x74,
+    0xBF, 0xC4, 0xD2, 0xD9, 0x10, 0xF5, 0x77, 0x43, 0x2B, 0xD7, 0x08, 0xB9, 0xEC, 0x83, 0xCA, 0x4E,
+    0x0D, 0x84, 0xA6, 0x4C, 0xDA, 0x6D, 0xF8, 0xB5, 0x3B, 0x0B, 0xAA, 0xD5, 0x0E, 0x8C, 0xBD, 0x83,
+    0x3B, 0x41, 0xFD, 0xC6, 0xEC, 0xED, 0x55, 0x19, 0x80, 0xB8, 0x21, 0x87, 0x3A, 0xEA, 0x02, 0x67,
+    0xA3, 0x16, 0x7D, 0x43, 0x6C, 0xC3, 0x9D, 0x36, 0xB1, 0xD1, 0x97, 0x7D, 0xD2, 0xA0, 0x9D, 0x50,
+    0x4D, 0x6C, 0x07, 0x55, 0x27, 0xD6, 0xA5, 0x46, 0x35, 0x45, 0x66, 0x54, 0xAD, 0x2F, 0x95, 0xCA,
+    0x68, 0x97, 0xA7, 0x26, 0x45, 0xB9, 0x6C, 0x94, 0x83, 0xC2, 0x9C, 0x72, 0xA4, 0x96, 0x42, 0xA2,
+    0xB9, 0x20, 0x9D, 0x9A, 0x9B, 0xA9, 0xD7, 0xD1, 0x3E, 0xB8, 0x16, 0xB5, 0x47, 0x4C, 0xB1, 0x0A,
+    0x18, 0x0C, 0x60, 0x31, 0xA0, 0x0A, 0x60, 0x19, 0x42, 0x78, 0x01, 0x5E, 0x54, 0x39, 0x9C, 0xAF,
+    0x40, 0xC5, 0xC5, 0x09, 0xC8, 0x96, 0xD3, 0xA7, 0x72, 0xDF, 0x90, 0x55, 0x39, 0xAC, 0x51, 0xA0,
+    0x11, 0x01, 0x6E, 0xC4, 0x70, 0xCC, 0x26, 0x6B, 0x89, 0x1C, 0x0D, 0x5D, 0x98, 0xFD, 0x48, 0x27,
+    0x07, 0x0E, 0x1A, 0x78, 0x4A, 0xEB, 0xBE, 0x0D, 0x5B, 0x95, 0xC3, 0x64, 0xCE, 0x06, 0x08, 0xF6,
+    0x04, 0xB7, 0xCF, 0xB9, 0xCE, 0xE5, 0x95, 0xC3, 0x61, 0x1E, 0x74, 0x8A, 0x91, 0x0D, 0x93, 0x27,
+    0x9F, 0xB1, 0x1D, 0x0D, 0xEF, 0x1C, 0x12, 0xDF, 0x6B, 0x7F, 0x03, 0xDF, 0x96, 0x6E, 0xCD, 0x1C,
+    0x26, 0x6B, 0x6B, 0x87, 0x65, 0xEC, 0x6F, 0xCB, 0xF3, 0xBA, 0x1C, 0xD5, 0x47, 0x7D, 0x44, 0x98,
+    0x33, 0xE2, 0xCA, 0x08, 0x9D, 0xC0, 0xBD, 0x4E, 0x9B, 0x31, 0x93, 0x33, 0x47, 0xD8, 0x47, 0xCB,
+    0x51, 0xCA, 0xF1, 0x87, 0x9C, 0x69, 0x8D, 0x72, 0x8C, 0xB3, 0x1C, 0x6D, 0x0C, 0x0F, 0x46, 0x47,
+    0x00, 0x0F, 0xD6, 0x94, 0x63, 0x4B, 0xE7, 0xFA, 0x6A, 0x07, 0x39, 0x5E, 0x6C, 0x0A, 0x29, 0x94,
+    0xA9, 0xA4, 0xD0, 0x88, 0xDA, 0x62, 0xA0, 0x1C, 0x1D, 0xE5, 0xB0, 0x48, 0xDF, 0x8B, 0x3E, 0x3D,
+    0x97, 0x6D, 0xCA, 0xF1, 0xAC, 0x3C, 0xC4, 0xEB, 0x02, 0x0F, 0x99, 0xEB, 0x3E, 0xF4, 0x16, 0x3D,
+    0x68, 0x0F, 0x85, 0x7C, 0x14, 0x47, 0xD4, 0x1F, 0x2D, 0xBF, 0x4F, 0xE4, 0x23, 0x02, 0x38, 0x60,
+    0x00, 0xE3, 0x7E, 0xCA, 0x28, 0xCE, 0x10, 0x88, 0x80, 0x11, 0x24, 0x3A, 0x8D, 0xEE, 0x1E, 0x71,
+    0x95, 0xB0, 0x78, 0x55, 0x9C, 0x52, 0xF0, 0xAD, 0x0B, 0x46, 0x36, 0x8C, 0xA0, 0x18, 0xDE, 0xA1,
+    0x6B, 0x0F, 0x72, 0x4F, 0xDA, 0x45, 0x3D, 0x4B, 0xF4, 0x91, 0x1B, 0x87, 0xCA, 0x7C, 0x2A, 0x3F,
+    0xE0, 0xF8, 0xEA, 0x16, 0xB3, 0xE8, 0x22, 0x7F, 0x3E, 0x6E, 0xE6, 0x61, 0x7D, 0x0D, 0xEB, 0xFB,
+    0x05, 0xB3, 0xC9, 0x47, 0xB8, 0x18, 0xE4, 0x6B, 0x87, 0xA7, 0x34, 0xDC, 0xD4, 0xAF, 0x78, 0xC2,
+    0xC4, 0x39, 0xA7, 0x5C, 0xD0, 0x2F, 0xE0, 0xDA, 0xBA, 0x44, 0xCF, 0x08, 0x94, 0xCE, 0xDE, 0x19,
+    0x24, 0xBD, 0xD5, 0x89, 0xBA, 0x8D, 0xD4, 0x8C, 0xD6, 0x3D, 0xF1, 0x25, 0x80, 0x78, 0x94, 0xF4,
+    0x79, 0xB8, 0x9B, 0x36, 0x80, 0x88, 0x54, 0x8B, 0x1C, 0xEC, 0x0B, 0xB4, 0xFD, 0x79, 0x03, 0xAC,
+    0xE1, 0xB8, 0x06, 0xA5, 0x18, 0x24, 0x4E, 0x6D, 0xD4, 0x25, 0xE8, 0x90, 0x93, 0xD6, 0x77, 0xC8,
+    0x36, 0xB5, 0xEA, 0x3E, 0x3B, 0x64, 0x78, 0x33, 0xF3, 0xF1, 0xC7, 0xF9, 0x5E, 0x0A, 0x2A, 0x65,
+    0x0F, 0xF5, 0x9A, 0x29, 0xA7, 0x23, 0xD9, 0x30, 0x59, 0x41, 0x72, 0x58, 0x81, 0xD9, 0x25, 0x18,
+    0xD9, 0x95, 0xF7, 0x6C, 0x4B, 0xD1, 0x47, 0xB5, 0x70, 0xEC, 0xE4, 0xF3, 0x91, 0xF2, 0xE0, 0x9B,
+    0xB2, 0x15, 0x8A, 0x8A, 0x46, 0x23, 0xFC, 0x6A, 0x3C, 0x92, 0xA1, 0x67, 0x05, 0x71, 0x58, 0x4E,
+    0xFF, 0xFD, 0x2F, 0xB0, 0xD7, 0xAF, 0x11, 0x73, 0xC5, 0xCB, 0xAE, 0xDC, 0xDB, 0xCF, 0x0A, 0x99,
+    0xC4, 0x74, 0xBF, 0x28, 0x72, 0x75, 0xBD, 0xBF, 0xD7, 0x21, 0x0E, 0xA3, 0x63, 0x63, 0xBF, 0xE6,
+    0x8F, 0xF5, 0x97, 0x36, 0x22, 0x77, 0x1B, 0xE9, 0xC3, 0x99, 0xB4, 0x75, 0xB0, 0x56, 0x51, 0xE2,
+    0x0F, 0x10, 0x50, 0x10, 0x03, 0xFC, 0xF6, 0x80, 0x83, 0x74, 0x0E, 0xA6, 0xAA, 0x58, 0x89, 0x8C,
+    0x58, 0xB1, 0xBB, 0xFB, 0x81, 0xB6, 0x2A, 0x7D, 0x8E, 0xE1, 0xB6, 0xD4, 0xA2, 0x89, 0x59, 0x96,
+    0xA6, 0x62, 0x15, 0x0C, 0x25, 0x06, 0xCD, 0x76, 0xB5, 0x5C, 0x9A, 0x26, 0x53, 0x2F, 0x33, 0xEF,
+    0x8E, 0x2B, 0x77, 0xF3, 0xEE, 0x32, 0xF4, 0x4E, 0x7F, 0x0F, 0x95, 0x0D, 0x82, 0x7B, 0x5B, 0xEF,
+    0xF5, 0x34, 0xCB, 0xD0, 0xE3, 0x7A, 0xA4, 0xD0, 0xF9, 0xF4, 0xE9, 0x69, 0xF0, 0x7B, 0xDC, 0x2C,
+    0x4F, 0xB7, 0x78, 0xE9, 0xD5, 0x3B, 0x40, 0x83, 0xDB, 0x40, 0x7D, 0xBC, 0xEF, 0x88, 0xF8, 0x0E,
+    0xB0, 0x4A, 0x1A, 0xC0, 0xD5, 0xB2, 0x38, 0x4B, 0x0A, 0x68, 0x17, 0x48, 0x09, 0xAE, 0xE9, 0xC4,
+    0xFD, 0x49, 0x3C, 0x35, 0xCC, 0x91, 0x93, 0x27, 0xB9, 0x3F, 0xF5, 0x09, 0x4A, 0x99, 0x91, 0xE5,
+    0x6B, 0x7A, 0xF7, 0xDE, 0xDE, 0x76, 0xDE, 0xA5, 0x3B, 0xA1, 0xEB, 0x95, 0xEB, 0xB2, 0xF6, 0x19,
+    0xE6, 0x8E, 0x72, 0x2E, 0x39, 0xA7, 0x4F, 0x95, 0xE7, 0x85, 0xAB, 0x51, 0x23, 0x21, 0xCC, 0xA2,
+    0xC6, 0x07, 0x56, 0xCF, 0x4F, 0x86, 0xC0, 0x68, 0x0E, 0x7A, 0x62, 0xB2, 0xCF, 0x13, 0xB3, 0x3B,
+    0x88, 0xEC, 0xC1, 0xD7, 0xC2, 0x69, 0xC3, 0x5C, 0x80, 0x04, 0x40, 0x09, 0x71, 0x8D, 0x70, 0xEF,
+    0x65, 0xF3, 0x21, 0xF9, 0xA4, 0x14, 0x9F, 0x00, 0x23, 0x80, 0x02, 0xC9, 0xA2, 0xEF, 0x99, 0xB0,
+    0x2F, 0x17, 0x64, 0x09, 0xBF, 0x01, 0x31, 0x3B, 0xCD, 0xD2, 0x34, 0xBD, 0x27, 0x0E, 0xDE, 0x13,
+    0xA3, 0x66, 0x26, 0xBA, 0x0C, 0xCD, 0x67, 0x4F, 0x01, 0x4B, 0xB4, 0xA7, 0xB7, 0xBB, 0xF7, 0xBA,
+    0x94, 0x8C, 0x28, 0x11, 0x3B, 0x98, 0xF6, 0x0C, 0xF0, 0xE9, 0x2D, 0xEE, 0xDD, 0xC5, 0x33, 0x1E,
+    0xA9, 0x26, 0xAD, 0xA7, 0x5D, 0x76, 0xCD, 0x9C, 0x2E, 0xBE, 0x0F, 0x84, 0xD5, 0xB7, 0xE7, 0xD6,
+    0x21, 0x78, 0x8B, 0xC0, 0x87, 0x77, 0xB1, 0x3A, 0x40, 0x3D, 0x35, 0x7D, 0x1A, 0xE6, 0xAD, 0x07,
+    0x9A, 0x09, 0x02, 0x8A, 0xCB, 0x13, 0x67, 0xB2, 0x5F, 0x34, 0x57, 0xFC, 0x5A, 0x7D, 0xF3, 0x77,
+    0x93, 0x37, 0x6B, 0xF5, 0x7E, 0x83, 0xCF, 0x51, 0xDF, 0x0B, 0xFD, 0x5F, 0x4C, 0x01, 0x29, 0xE5,
+    0x86, 0x24, 0x3B, 0xC0, 0xC3, 0x19, 0xAD, 0x33, 0x9C, 0x4F, 0xD1, 0x6B, 0x54, 0x2D, 0xD5, 0x87,
+    0x75, 0xC4, 0xED, 0xC6, 0xD1, 0x35, 0xA9, 0xD5, 0x8D, 0x36, 0x00, 0x7B, 0x8E, 0xD2, 0xAB, 0x8C,
+    0x19, 0x15, 0xC5, 0x0E, 0xD2, 0x0C, 0x9C, 0x3B, 0x5C, 0xB8, 0x6D, 0xDC, 0x3C, 0x8F, 0x6A, 0xBF,
+    0x93, 0x55, 0x94, 0xE7, 0x2B, 0x49, 0x39, 0xD5, 0x4C, 0xDB, 0x12, 0x7D, 0xE1, 0x4C, 0xB4, 0xE3,
+    0x9A, 0x78, 0x4C, 0x6D, 0xD2, 0x4F, 0xC6, 0xE3, 0x7E, 0x3E, 0x4D, 0x48, 0x23, 0x7A, 0x33, 0x4E,
+    0x54, 0x73, 0x18, 0x13, 0xC5, 0x75, 0x35, 0x3B, 0x71, 0x39, 0x35, 0x1B, 0x6C, 0x92, 0xC3, 0x79,
+    0x41, 0x2E, 0xA1, 0x3D, 0xE3, 0x9E, 0x1B, 0x16, 0x33, 0xB3, 0x8E, 0xA1, 0x96, 0xB3, 0xB2, 0x42,
+    0xCB, 0x90, 0xB3, 0x9A, 0x9A, 0x42, 0x16, 0x33, 0xCB, 0x19, 0x3C, 0x97, 0x21, 0xB0, 0x12, 0x57,
+    0x7E, 0x9D, 0xC3, 0xE5, 0x4B, 0xD3, 0xCC, 0x5E, 0xE0, 0x26, 0x81, 0x09, 0x76, 0x5C, 0x1E, 0x9A,
+    0x2B, 0xCB, 0xCB, 0x48, 0x07, 0x1E, 0x1E, 0x70, 0xE0, 0x65, 0xE8, 0x9D, 0x96, 0xA9, 0xCF, 0x2F,
+    0xE6, 0xEF, 0x07, 0xB6, 0xF6, 0x37, 0xC5, 0x97, 0x8E, 0x7A, 0xBE, 0xCF, 0xF3, 0x91, 0xC5, 0xEF,
+    0x15, 0xF7, 0x51, 0x66, 0x3A, 0xFA, 0x80, 0x49, 0x50, 0x67, 0xAA, 0xC6, 0xD5, 0xE9, 0x4D, 0xD7,
+    0x64, 0xEF, 0xDD, 0xAE, 0xF5, 0xED, 0x0B, 0xB5, 0x1E, 0xB1, 0x6A, 0x3D, 0x3C, 0xC2, 0x56, 0x79,
+    0xBA, 0x83, 0xC0, 0xF2, 0x4D, 0x74, 0x23, 0xCF, 0xED, 0x2F, 0x1C, 0xF4, 0xE4, 0x4A, 0x1E, 0x6A,
+    0x83, 0x09, 0x84, 0x8E, 0x5F, 0x3B, 0xBE, 0xE1, 0x7F, 0xA2, 0xAA, 0xD1, 0x56, 0x99, 0xFD, 0x6B,
+    0x4F, 0x9D, 0x00, 0x96, 0xD4, 0x03, 0x00, 0x59, 0x45, 0xA3, 0x0F, 0x50, 0x3D, 0x00, 0x6E, 0xDB,
+    0xFE, 0x60, 0x3A, 0xF4, 0x8D, 0x75, 0x3B, 0xF9, 0xC5, 0xA3, 0xA0, 0xB9, 0x48, 0x87, 0xE3, 0x5E,
+    0x33, 0xBD, 0x14, 0x4D, 0xDF, 0x40, 0xFB, 0xF4, 0xB5, 0xDB, 0x40, 0x2F, 0xAF, 0xB7, 0xAF, 0x9B,
+    0x7C, 0x38, 0x4C, 0x9B, 0x9C, 0x8B, 0x74, 0x8E, 0x98, 0xDF, 0x9C, 0x0A, 0x9C, 0xA0, 0x47, 0xF0,
+    0x07, 0x3D, 0xB7, 0x8F, 0x06, 0x16, 0x5A, 0x03, 0x2B, 0xAC, 0x91, 0x6F, 0x50, 0x10, 0xD9, 0x66,
+    0x54, 0xAD, 0xB3, 0x5B, 0xF5, 0xBF, 0xDC, 0x68, 0xBF, 0x49, 0x67, 0x17, 0xF5, 0x8B, 0xAF, 0xA2,
+    0xAA, 0x45, 0x71, 0x53, 0xF1, 0x89, 0x8A, 0x37, 0xAB, 0x7C, 0xDE, 0x17, 0x39, 0xB0, 0xBF, 0x45,
+    0x09, 0xAA, 0xAC, 0x94, 0xD1, 0x6F, 0xBB, 0xB4, 0x81, 0xFB, 0x55, 0x17, 0x8E, 0x51, 0x1F, 0x2D,
+    0x7E, 0xDE, 0x68, 0xE3, 0x2E, 0xB6, 0x73, 0xE9, 0xD6, 0x65, 0xFC, 0xD1, 0xC2, 0xA8, 0xCF, 0x50,
+    0xBA, 0xBD, 0xDF, 0xCB, 0xD7, 0xFD, 0xB8, 0x21, 0xC7, 0xAE, 0x2E, 0xAA, 0x6A, 0xF5, 0x2E, 0xA6,
+    0xE0, 0x6C, 0x7E, 0x78, 0x0A, 0xFE, 0x0F, 0xBD, 0x5A, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x1E, 0x92,
+    0x91, 0x08, 0x88, 0xC5, 0xB8, 0x90, 0x11, 0xC4, 0x46, 0xC2, 0x26, 0x45, 0x9C, 0xC0, 0x66, 0x9B,
+    0x22, 0xBE, 0xA1, 0x52, 0x24, 0x40, 0x5C, 0x44, 0x85, 0x2E, 0x4D, 0x0A, 0x35, 0x2A, 0x0C, 0x23,
+    0xC8, 0xB5, 0x2E, 0xA2, 0x23, 0x55, 0xA5, 0x48, 0x73, 0x4D, 0xEA, 0x5C, 0xA1, 0x00, 0xC2, 0x35,
+    0x49, 0xA9, 0xE2, 0xEE, 0xC8, 0xC4, 0xA5, 0x8B, 0x30, 0x36, 0x02, 0x17, 0x29, 0x44, 0x04, 0x02,
+    0x12, 0xD8, 0x30, 0x44, 0xC9, 0x94, 0x4D, 0xEB, 0x48, 0x4E, 0xBE, 0x6F, 0x66, 0xC8, 0xDD, 0xFB,
+    0x91, 0x64, 0xDD, 0xED, 0x69, 0x75, 0x9C, 0xD3, 0xED, 0x72, 0x67, 0xBE, 0xF7, 0xE6, 0xFD, 0x7C,
+    0xEF, 0x0D, 0x85, 0xF8, 0xE1, 0x4E, 0x2A, 0x84, 0xD2, 0xD3, 0x60, 0x5E, 0x71, 0x8B, 0x41, 0x75,
+    0x18, 0x32, 0x0E, 0x23, 0x06, 0x6F, 0xE8, 0x85, 0x08, 0x1E, 0x63, 0x08, 0x1B, 0x0C, 0xB2, 0xC6,
+    0x90, 0x94, 0x18, 0x54, 0x3E, 0x08, 0x51, 0xFC, 0x11, 0x83, 0xD6, 0xA3, 0xF0, 0x39, 0x04, 0x5A,
+    0x6B, 0x11, 0x35, 0xA2, 0xC0, 0x6D, 0x18, 0x92, 0x12, 0x83, 0xCA, 0x45, 0x26, 0xB0, 0x18, 0xEE,
+    0xD5, 0xB8, 0x46, 0xBB, 0xD0, 0xE6, 0xCF, 0xB6, 0x02, 0x7D, 0xAF, 0x94, 0x5A, 0x97, 0x71, 0xAB,
+    0x4B, 0x55, 0x66, 0x39, 0xFE, 0xA5, 0x45, 0x9A, 0x09, 0x8D, 0x2F, 0x69, 0x31, 0x0A, 0xED, 0xE1,
+    0x0A, 0x06, 0x7C, 0xAD, 0x17, 0x6A, 0xEC, 0x45, 0xFC, 0xB8, 0x13, 0x4B, 0xAF, 0xDD, 0xB0, 0x04,
+    0xCA, 0x22, 0x27, 0x7C, 0xFC, 0x19, 0xDD, 0x17, 0xE7, 0x2D, 0x03, 0x5F, 0x5D, 0x84, 0xBF, 0x8B,
+    0x14, 0x80, 0x16, 0x4B, 0x9E, 0x49, 0x96, 0xF3, 0x43, 0xEB, 0x71, 0xE6, 0xB0, 0xC2, 0x20, 0x4B,
+    0x0E, 0xE6, 0x7F, 0x5C, 0x23, 0x9C, 0xD6, 0x3E, 0x2D, 0xF0, 0x00, 0x53, 0x49, 0xDA, 0x0D, 0xA1,
+    0x5F, 0xC5, 0x55, 0x13, 0xE5, 0xD2, 0xDE, 0x44, 0xB8, 0x29, 0xC6, 0x1B, 0x0A, 0x37, 0xED, 0xD9,
+    0xB7, 0x42, 0x5D, 0x8B, 0x4C, 0xF7, 0x9E, 0xD6, 0x5D, 0xA0, 0xAF, 0xFC, 0x95, 0x40, 0xE2, 0x06,
+    0x72, 0x61, 0x2A, 0x55, 0x52, 0x34, 0x28, 0x00, 0x77, 0x17, 0xEE, 0xE2, 0xFF, 0x33, 0xBE, 0x5F,
+    0x5F, 0x14, 0x31, 0x45, 0xC4, 0xE5, 0xE9, 0x61, 0x5E, 0xC1, 0x1F, 0x29, 0x06, 0x64, 0x4A, 0x8C,
+    0xE9, 0x6E, 0xDC, 0xF7, 0x75, 0x2F, 0x75, 0x97, 0xB4, 0xDF, 0xC7, 0x6C, 0x59, 0x0E, 0xF4, 0x80,
+    0xEF, 0x7E, 0x8A, 0x34, 0xCD, 0x74, 0xA5, 0x74, 0x15, 0xE9, 0x7C, 0x9E, 0x40, 0x97, 0xD0, 0x5D,
+    0x2D, 0xE4, 0xC7, 0xAD, 0x48, 0x44, 0x77, 0x1E, 0x10, 0x55, 0x23, 0x30, 0x51, 0x37, 0x44, 0xD5,
+    0x5B, 0xA7, 0x83, 0x48, 0xF5, 0xE2, 0x3E, 0xB3, 0xD8, 0x1B, 0xE7, 0xA2, 0x45, 0x18, 0x06, 0xB6,
+    0x09, 0xDF, 0xBE, 0x74, 0x3A, 0x2D, 0xCA, 0x72, 0x4F, 0x04, 0x5F, 0xB4, 0x30, 0x45, 0x00, 0x70,
+    0x41, 0x64, 0xC5, 0x10, 0x83, 0x06, 0x3B, 0xDC, 0xD3, 0xEE, 0x61, 0xCE, 0xAA, 0xB2, 0x6F, 0x6E,
+    0xDC, 0xC7, 0x92, 0xBD, 0x00, 0x54, 0x01, 0xAC, 0x66, 0x5E, 0xA3, 0x28, 0x61, 0x90, 0xCE, 0x17,
+    0x20, 0x03, 0x4A, 0x85, 0x00, 0x51, 0x89, 0x65, 0xC5, 0x72, 0x56, 0x98, 0xA6, 0xF7, 0x75, 0xCF,
+    0x1B, 0xE9, 0x26, 0x99, 0x9B, 0xD8, 0xC6, 0x27, 0x0D, 0x11, 0x30, 0xF4, 0xC2, 0x1B, 0x7F, 0x3D,
+    0xC0, 0x1D, 0x3D, 0x2D, 0xFC, 0x1E, 0x33, 0x06, 0x3D, 0x96, 0x08, 0x3A, 0x0C, 0x61, 0x2B, 0x8C,
+    0xDB, 0x69, 0x21, 0xED, 0xE0, 0x0F, 0xF0, 0x00, 0x7C, 0x1E, 0x57, 0x10, 0x38, 0xF9, 0x67, 0xD1,
+    0x60, 0x51, 0x98, 0x98, 0x82, 0x8B, 0x62, 0xD8, 0x32, 0x6B, 0xB6, 0xA3, 0xF3, 0xE8, 0xE8, 0x11,
+    0xD6, 0x94, 0x5F, 0x54, 0xD6, 0x6B, 0x36, 0x61, 0xC5, 0x74, 0x43, 0x41, 0x3F, 0x84, 0xAE, 0xF8,
+    0x35, 0x78, 0xA2, 0xA0, 0x2B, 0x62, 0xA9, 0x4C, 0x18, 0x67, 0x34, 0xDE, 0x08, 0x77, 0xA4, 0xF3,
+    0x07, 0x54, 0x87, 0x66, 0x40, 0x80, 0x47, 0x22, 0x82, 0xCC, 0x71, 0xF1, 0xF9, 0xE8, 0xBF, 0x3D,
+    0xA4, 0x05, 0xF5, 0xA1, 0xA1, 0x98, 0x52, 0x8B, 0x8D, 0x27, 0xF9, 0x37, 0x46, 0x2F, 0x28, 0x75,
+    0x88, 0xED, 0x09, 0xF1, 0xF6, 0x85, 0xEB, 0xF7, 0x19, 0x52, 0x3C, 0x7D, 0xBD, 0xC4, 0x5B, 0x0C,
+    0x21, 0xB9, 0xAA, 0x8B, 0x5C, 0xB9, 0xF0, 0x41, 0xD8, 0x26, 0x7C, 0x88, 0xE1, 0x70, 0xF8, 0x98,
+    0xB0, 0x5E, 0xDC, 0xD9, 0x86, 0xBC, 0xF0, 0x3F, 0x6D, 0x35, 0x5F, 0x60, 0x1B, 0xB4, 0x6E, 0x78,
+    0x79, 0xE3, 0x7A, 0x4A, 0x31, 0x7D, 0x46, 0x41, 0x5E, 0x5A, 0xA7, 0xA1, 0xB3, 0x0C, 0xF9, 0x78,
+    0x9D, 0x1A, 0x37, 0x7A, 0x8B, 0x2B, 0x67, 0x55, 0x9C, 0xDB, 0x5D, 0xE2, 0x3D, 0x97, 0x67, 0xB4,
+    0xCB, 0x33, 0x09, 0x2D, 0x65, 0x30, 0xDF, 0x8D, 0xEB, 0x2C, 0x85, 0x62, 0x45, 0x76, 0x05, 0xFA,
+    0xC4, 0x7B, 0xD4, 0x93, 0xFE, 0xB3, 0xB3, 0x14, 0xF1, 0x8A, 0xC8, 0x3E, 0x6D, 0x31, 0x47, 0x8B,
+    0x7B, 0x97, 0x42, 0x99, 0x14, 0xAD, 0x90, 0x9F, 0x35, 0x78, 0xB3, 0x12, 0xDE, 0xBE, 0x58, 0x29,
+    0x56, 0xBE, 0x1A, 0x99, 0x8B, 0x11, 0xBB, 0x9B, 0x61, 0x92, 0xD7, 0xEB, 0xD5, 0x60, 0x16, 0x9B,
+    0x4B, 0x3E, 0xF0, 0xEE, 0xEA, 0x31, 0x07, 0xB8, 0x21, 0xA2, 0x05, 0xE3, 0xB7, 0x9F, 0x9F, 0x1D,
+    0xF3, 0xAA, 0xB0, 0x31, 0xD7, 0xC5, 0x08, 0x27, 0x6B, 0xC2, 0x66, 0x1E, 0xE5, 0x6E, 0x3C, 0x0B,
+    0x3E, 0xCE, 0x77, 0x13, 0x1F, 0x50, 0x74, 0x06, 0x25, 0x46, 0x11, 0xE5, 0x64, 0x8E, 0xF3, 0x5E,
+    0x44, 0xFF, 0x6D, 0x00, 0xB2, 0x44, 0xC8, 0x5A, 0xBD, 0x9E, 0x7B, 0x04, 0x86, 0x4D, 0xB8, 0xBF,
+    0xEA, 0x1D, 0x4D, 0x58, 0x85, 0x6D, 0x64, 0x35, 0xB0, 0xB6, 0x26, 0x0E, 0xC9, 0xFC, 0xA6, 0xF5,
+    0x45, 0x84, 0x51, 0xF8, 0x3B, 0x26, 0x18, 0x02, 0x9D, 0xFE, 0x26, 0xEA, 0x0F, 0x47, 0xEC, 0x2C,
+    0xD7, 0x7D, 0x96, 0xEA, 0xBE, 0x48, 0x75, 0x57, 0xA4, 0x61, 0x9B, 0xA5, 0x51, 0x93, 0x95, 0xB2,
+    0x51, 0xB5, 0xAC, 0x11, 0xB1, 0x91, 0x0F, 0x34, 0xE2, 0xC0, 0x98, 0x2E, 0x82, 0x2B, 0x10, 0x48,
+    0x28, 0x4A, 0xFD, 0xB2, 0x14, 0x5D, 0x60, 0x17, 0x4F, 0x6E, 0xDD, 0x16, 0xFA, 0xAB, 0x06, 0x3A,
+    0x68, 0xC2, 0x41, 0x35, 0xB2, 0x89, 0x6B, 0xFC, 0xAB, 0x92, 0x2A, 0x06, 0xED, 0x48, 0x70, 0xA9,
+    0x9C, 0x41, 0x4F, 0xFD, 0x4D, 0xA7, 0x09, 0xF5, 0xC3, 0x30, 0xD3, 0x8F, 0x56, 0xE9, 0x50, 0xE0,
+    0xD5, 0x10, 0xC1, 0x0B, 0x6A, 0x2D, 0xE0, 0x86, 0xC9, 0x38, 0xAD, 0x53, 0xAE, 0x89, 0xE0, 0x49,
+    0x6F, 0xE4, 0x11, 0x1B, 0xF9, 0xB9, 0xC8, 0xF2, 0xB6, 0xDF, 0x88, 0xE4, 0x41, 0x85, 0xD4, 0x94,
+    0x0B, 0xFF, 0x6B, 0x71, 0x6E, 0xB2, 0xC0, 0x98, 0x5C, 0x7E, 0xC4, 0x75, 0x49, 0x9C, 0x8B, 0x2C,
+    0x34, 0x62, 0xDF, 0x19, 0xA4, 0xB8, 0x7D, 0x7E, 0xB2, 0xAC, 0x12, 0xF7, 0xAB, 0xA9, 0xF5, 0x37,
+    0x72, 0xA1, 0xDD, 0x05, 0x6C, 0xEB, 0xE4, 0x98, 0xD8, 0xEB, 0x6D, 0x6A, 0x3A, 0xB7, 0x7D, 0x21,
+    0x8D, 0x83, 0x4F, 0x91, 0xF5, 0x76, 0xA0, 0xB2, 0x51, 0x95, 0x4C, 0xB9, 0x96, 0xEC, 0x53, 0xD3,
+    0x7B, 0x47, 0xD0, 0x6E, 0xD0, 0x64, 0x55, 0xC2, 0xDB, 0x55, 0x8E, 0x99, 0xB2, 0x34, 0x30, 0x83,
+    0x36, 0xC9, 0xD2, 0xBA, 0xFC, 0x08, 0x9F, 0xFF, 0xD5, 0xC0, 0x5C, 0xDB, 0x4F, 0xB9, 0x16, 0x43,
+    0x52, 0x82, 0x4E, 0xA8, 0x12, 0x89, 0x55, 0xE5, 0xA0, 0x13, 0x2A, 0x67, 0x50, 0x98, 0xDD, 0xB4,
+    0x11, 0xE1, 0xC3, 0x0E, 0x96, 0xF1, 0xBB, 0x69, 0x45, 0xEB, 0xDC, 0x23, 0x4B, 0x04, 0x2B, 0xBA,
+    0xDF, 0x6F, 0x8A, 0xE0, 0x40, 0x97, 0x58, 0xAA, 0x0E, 0xC7, 0xB8, 0x89, 0x7A, 0x09, 0xB9, 0x65,
+    0x8D, 0xAB, 0x82, 0x36, 0x2B, 0x48, 0x6F, 0x25, 0xA7, 0xEC, 0xB9, 0x4A, 0x15, 0x72, 0x33, 0xB3,
+    0xF3, 0x02, 0xFD, 0x25, 0xBD, 0x53, 0xFC, 0x0F, 0x6A, 0xD7, 0x7D, 0xC2, 0x81, 0xE8, 0xF3, 0x33,
+    0xA1, 0x77, 0x28, 0x25, 0x22, 0x92, 0x44, 0x24, 0xBB, 0x38, 0x5C, 0xB3, 0x11, 0xB0, 0xD3, 0x29,
+    0x91, 0x62, 0xC6, 0x3A, 0x1A, 0x64, 0x1D, 0xB5, 0xDF, 0x00, 0x65, 0x72, 0x05, 0x45, 0xCD, 0x41,
+    0x25, 0xF0, 0x3D, 0xAF, 0xFA, 0xAD, 0x23, 0xEE, 0xA3, 0xBB, 0x3A, 0x56, 0x45, 0x0B, 0x52, 0xA9,
+    0x1C, 0x99, 0x3C, 0xA2, 0x25, 0xBF, 0x5F, 0x44, 0xE0, 0x18, 0xEF, 0x65, 0xA0, 0xA9, 0x05, 0xAE,
+    0xB0, 0xFE, 0x49, 0x3C, 0x76, 0x6B, 0x45, 0xF3, 0xE3, 0x88, 0x91, 0xC3, 0xBB, 0xC3, 0x3B, 0x20,
+    0x0E, 0x84, 0x81, 0x28, 0xD2, 0xFE, 0xD4, 0xDC, 0xDE, 0x84, 0x7C, 0x8C, 0x4B, 0x60, 0x05, 0x2E,
+    0xC0, 0xBA, 0x99, 0xB3, 0x64, 0x7A, 0xA5, 0x80, 0x2E, 0xED, 0x6C, 0x81, 0x0C, 0xC5, 0xBA, 0x7C,
+    0x31, 0x34, 0x7C, 0xDD, 0x35, 0x45, 0x69, 0x6E, 0x0A, 0xE1, 0xA9, 0x28, 0x5D, 0x11, 0x2A, 0x46,
+    0x26, 0xD1, 0xC4, 0x9F, 0x35, 0x52, 0xD3, 0xC6, 0x5F, 0x0C, 0x1B, 0xD6, 0xE7, 0x4F, 0x77, 0xF4,
+    0x03, 0x5B, 0x56, 0x8C, 0x5C, 0x18, 0x6B, 0xE2, 0x87, 0x06, 0x35, 0x72, 0x4D, 0x2C, 0x89, 0xB2,
+    0x15, 0x95, 0x3D, 0x68, 0x51, 0xBC, 0x25, 0x64, 0xCB, 0x55, 0x16, 0x11, 0x52, 0x99, 0x79, 0x5E,
+    0x33, 0x7F, 0xBE, 0x77, 0x68, 0x92, 0xA0, 0x3F, 0x86, 0xAA, 0xA6, 0x89, 0x03, 0x15, 0xA6, 0x5A,
+    0x33, 0xC1, 0x63, 0xC0, 0xCA, 0xE5, 0x9C, 0xBD, 0x21, 0x6F, 0xCB, 0x1A, 0x12, 0x5F, 0xF0, 0xB6,
+    0x9C, 0xC6, 0x4E, 0x81, 0xF6, 0x4E, 0xD0, 0x07, 0x5D, 0xD8, 0x46, 0x8D, 0x75, 0x3C, 0x9A, 0xB2,
+    0x31, 0xE3, 0x14, 0xDF, 0xD4, 0x23, 0x89, 0xF7, 0x88, 0xFB, 0x59, 0x08, 0x62, 0x5E, 0x7A, 0x4A,
+    0x39, 0x79, 0x8A, 0x4A, 0x01, 0x31, 0x4B, 0x63, 0xD6, 0xED, 0x31, 0x9D, 0x11, 0xEB, 0x1E, 0x8E,
+    0x22, 0xBE, 0xA9, 0x37, 0xC8, 0xDD, 0x63, 0x52, 0x69, 0xAC, 0x38, 0x62, 0x53, 0xAE, 0x90, 0x87,
+    0x70, 0x9F, 0x04, 0x23, 0x6B, 0xC8, 0xE4, 0xC7, 0x9A, 0x0B, 0x03, 0xB7, 0xEB, 0xEA, 0xCC, 0x01,
+    0x77, 0x6D, 0xF1, 0x8E, 0x88, 0xFF, 0xAE, 0x0D, 0x9B, 0xDE, 0x1D, 0xFF, 0x76, 0xD0, 0x87, 0x6D,
+    0xD0, 0x45, 0x4D, 0xD8, 0xCA, 0x26, 0xB2, 0x81, 0x02, 0x17, 0x78, 0x7F, 0x9D, 0x94, 0x71, 0x65,
+    0xC2, 0x24, 0x83, 0x64, 0xAA, 0x72, 0x94, 0x09, 0x28, 0x15, 0x10, 0xA8, 0x17, 0x46, 0xC2, 0x45,
+    0x0B, 0xD8, 0x53, 0x41, 0x37, 0x9F, 0xD4, 0x98, 0x35, 0xC7, 0x08, 0xC5, 0x21, 0x03, 0x3B, 0x62,
+    0x64, 0x86, 0x09, 0x75, 0xB6, 0x09, 0x41, 0x12, 0x19, 0x35, 0xE2, 0x30, 0x13, 0x2A, 0x17, 0x79,
+    0x10, 0x45, 0x90, 0xE7, 0xB8, 0x3C, 0x39, 0x11, 0x85, 0xFC, 0xD6, 0xBC, 0x79, 0x90, 0x36, 0x82,
+    0xB3, 0x24, 0xBF, 0xAF, 0xC5, 0x4D, 0xDF, 0x46, 0x4D, 0x98, 0xE6, 0x62, 0x7E, 0xAA, 0xA5, 0x79,
+    0xF6, 0xFC, 0x73, 0x2D, 0x6A, 0x61, 0xFA, 0xA3, 0xE5, 0x5A, 0xEC, 0xC6, 0x98, 0x4A, 0xB3, 0xE0,
+    0x5D, 0x9A, 0x85, 0xED, 0xE8, 0x73, 0xFF, 0xA1, 0x6F, 0xAF, 0x47, 0x2A, 0xF3, 0x7B, 0xBC, 0x1F,
+    0xF4, 0x78, 0x3F, 0x38, 0x18, 0xA8, 0x78, 0xCA, 0xC2, 0x81, 0x01, 0x4F, 0xC8, 0x47, 0x03, 0x97,
+    0xD3, 0x5C, 0x4F, 0x73, 0xC1, 0x8C, 0x86, 0x6B, 0x2C, 0x0A, 0x29, 0x50, 0x71, 0xC3, 0xC5, 0x9C,
+    0xDB, 0x4C, 0x62, 0x13, 0xA6, 0xB0, 0x30, 0x95, 0xD1, 0xF6, 0x53, 0x03, 0xBD, 0x0F, 0x4B, 0x93,
+    0xD8, 0x3B, 0x55, 0x85, 0x6D, 0x91, 0x46, 0x58, 0x44, 0x1E, 0xB4, 0xAE, 0x86, 0x6A, 0xC0, 0x4F,
+    0x5A, 0x91, 0x7C, 0x82, 0x68, 0xFC, 0x01, 0x08, 0xE4, 0x2D, 0x98, 0x11, 0xF6, 0x2D, 0x33, 0x45,
+    0x31, 0x5E, 0xEB, 0x6E, 0x2E, 0xCE, 0xE3, 0x38, 0x3B, 0x6C, 0xE1, 0xF4, 0xF3, 0x31, 0x10, 0x50,
+    0xC7, 0xD2, 0x11, 0xE4, 0xA7, 0x62, 0x3E, 0xBC, 0x1D, 0xF3, 0x56, 0x1C, 0xDD, 0x8E, 0x99, 0xF8,
+    0xDA, 0xE2, 0x10, 0xDF, 0xC1, 0x2D, 0xF8, 0x64, 0x6D, 0x9A, 0x79, 0xF2, 0xBF, 0x85, 0xAF, 0x3F,
+    0x33, 0xFC, 0x64, 0xE9, 0xB4, 0xAD, 0xF3, 0x17, 0xFB, 0xE7, 0x7D, 0x51, 0xF7, 0xE6, 0xC7, 0x20,
+    0xB8, 0xC6, 0xFB, 0xC1, 0x2A, 0xC0, 0x5D, 0x2F, 0xA6, 0xE2, 0xE8, 0xBC, 0xC5, 0xF3, 0x03, 0x4F,
+    0x5C, 0xB9, 0xC2, 0x03, 0x5B, 0xCC, 0x38, 0x62, 0xC2, 0x0F, 0x7D, 0xB0, 0x40, 0xED, 0xA4, 0xA3,
+    0x5A, 0x8C, 0x12, 0x6E, 0x1E, 0x9F, 0x5E, 0x4B, 0x45, 0x0C, 0xC3, 0x4C, 0x50, 0x3A, 0x2A, 0xC0,
+    0xD8, 0x3D, 0xEE, 0x5C, 0xCF, 0x9A, 0x67, 0xC9, 0xF0, 0x4D, 0x02, 0x79, 0xE6, 0xCE, 0x25, 0x24,
+    0x68, 0x48, 0xEE, 0x59, 0x2A, 0x9B, 0x37, 0x9E, 0x83, 0xE9, 0x69, 0xFB, 0xB4, 0x17, 0x3D, 0x1C,
+    0x25, 0x7E, 0x9A, 0x1B, 0x27, 0xEF, 0xD3, 0x31, 0x54, 0x04, 0xF5, 0x0A, 0x66, 0x6B, 0x4C, 0xFA,
+    0xF2, 0x60, 0x92, 0xB1, 0x73, 0xCD, 0xD8, 0x45, 0x8E, 0x59, 0x40, 0xC7, 0xE3, 0x24, 0x63, 0x84,
+    0xDD, 0x9B, 0xC2, 0x48, 0x32, 0x63, 0x60, 0x8B, 0x14, 0x65, 0x57, 0x9E, 0x0C, 0x9C, 0x0F, 0xC1,
+    0x2A, 0xB1, 0xDB, 0x53, 0x1A, 0x18, 0xF9, 0x52, 0x3A, 0xB0, 0x21, 0x6D, 0x74, 0xBD, 0x0E, 0x30,
+    0xBD, 0xF9, 0x6D, 0xA8, 0x44, 0x97, 0x0C, 0xE5, 0x55, 0xD0, 0x81, 0x95, 0x05, 0xAD, 0x0F, 0x86,
+    0xD9, 0xF8, 0x07, 0x88, 0xFA, 0xC1, 0x97, 0x7D, 0x54, 0x07, 0x0F, 0x7B, 0x59, 0x87, 0xCD, 0x20,
+    0xAB, 0xA8, 0xD1, 0x71, 0x29, 0xEB, 0x2C, 0x29, 0x65, 0xA5, 0x36, 0x72, 0x59, 0x2A, 0x9D, 0xC6,
+    0x65, 0x0C, 0xC2, 0x59, 0x4A, 0xCD, 0xB0, 0x8F, 0x21, 0x8D, 0x90, 0x3C, 0x44, 0x30, 0xB5, 0xB8,
+    0x48, 0x8D, 0x09, 0x62, 0xDF, 0x75, 0x6C, 0xF1, 0x6B, 0x7B, 0x5F, 0x04, 0x5F, 0x80, 0xD4, 0x1D,
+    0xBC, 0x28, 0xA9, 0x3B, 0x5F, 0xA4, 0x17, 0xAE, 0x4E, 0xBD, 0xE4, 0x24, 0x9F, 0x22, 0xD7, 0x0F,
+    0xCE, 0x82, 0xF7, 0x29, 0xB1, 0x69, 0xAA, 0x56, 0x22, 0x76, 0x90, 0xC9, 0x57, 0x92, 0x61, 0x6A,
+    0x5D, 0x9F, 0xFF, 0x7E, 0x24, 0x57, 0x3A, 0x21, 0xFF, 0x5D, 0x23, 0xA8, 0xE7, 0x26, 0x21, 0x9C,
+    0x41, 0x3E, 0x63, 0x46, 0xCC, 0x41, 0xB6, 0x39, 0x1E, 0x1B, 0xCD, 0xFD, 0xE2, 0xA7, 0x08, 0xAA,
+    0xF1, 0x9F, 0x46, 0x71, 0x39, 0x61, 0x9F, 0x4A, 0xB5, 0x3C, 0x4C, 0xA8, 0x60, 0xBA, 0x2C, 0xE5,
+    0x61, 0xC2, 0xC6, 0x82, 0xB5, 0x6B, 0xF7, 0x8D, 0xC6, 0x97, 0x3C, 0xA6, 0x1D, 0x43, 0x3D, 0x4C,
+    0xB0, 0xA1, 0x83, 0x4F, 0x3A, 0xE8, 0x9C, 0x0E, 0xEA, 0xA0, 0xF5, 0x8C, 0x0E, 0xBE, 0xEA, 0x8C,
+    0x0E, 0xC0, 0xD1, 0x29, 0x7E, 0xD8, 0x20, 0xD0, 0xC0, 0x79, 0xA9, 0x03, 0xB5, 0x01, 0x1D, 0x24,
+    0x0F, 0xA0, 0x83, 0x98, 0x3A, 0x80, 0xE4, 0x49, 0x1E, 0x51, 0x07, 0x01, 0x75, 0x00, 0x3F, 0x51,
+    0xC6, 0xFD, 0xCD, 0x4E, 0x18, 0xE7, 0x0F, 0x0B, 0xC3, 0x2C, 0xAA, 0x89, 0x59, 0x2C, 0x6B, 0xE2,
+    0x45, 0xCB, 0x8D, 0x29, 0xC0, 0xB0, 0xFC, 0xCC, 0x30, 0x77, 0xD6, 0xDA, 0x8E, 0xAD, 0xB7, 0x73,
+    0x9B, 0xFD, 0x02, 0x56, 0x57, 0x7A, 0x22, 0x7A, 0x21, 0x1B, 0x8E, 0x99, 0x71, 0x7C, 0xD4, 0x10,
+    0xC1, 0xE8, 0x6B, 0xEE, 0xBD, 0xA6, 0xA3, 0x14, 0x29, 0x32, 0x28, 0xBB, 0x1E, 0x1C, 0x18, 0x3F,
+    0xE8, 0xF2, 0x29, 0x34, 0xA8, 0xF1, 0x0B, 0x54, 0x01, 0x94, 0x69, 0x10, 0x59, 0x89, 0x42, 0x4E,
+    0xD5, 0x49, 0xCB, 0x7E, 0x72, 0xCD, 0xEA, 0x85, 0x34, 0x62, 0xEE, 0x91, 0x1E, 0xED, 0x10, 0x6E,
+    0xD4, 0x58, 0xBB, 0x37, 0x51, 0x24, 0x69, 0x34, 0xB7, 0x21, 0x9D, 0xE8, 0x8F, 0x36, 0xF4, 0x87,
+    0xDB, 0x81, 0x91, 0x33, 0xE3, 0xBE, 0x44, 0x37, 0x47, 0x7B, 0xC9, 0xE5, 0xDB, 0xC2, 0xF4, 0x21,
+    0xC0, 0x49, 0x28, 0xC3, 0x46, 0xFE, 0x72, 0x04, 0xE1, 0xAB, 0x8D, 0x5C, 0xFB, 0x10, 0xC2, 0xBC,
+    0x7E, 0x7F, 0x45, 0x02, 0x89, 0xE4, 0x43, 0x18, 0x6D, 0x46, 0x7B, 0xED, 0xD6, 0x78, 0xDA, 0x73,
+    0xF7, 0xE5, 0x09, 0x14, 0x3D, 0x02, 0xB9, 0xFE, 0x00, 0xE4, 0x18, 0x71, 0xE6, 0xEE, 0x5B, 0xAB,
+    0x12, 0x88, 0x65, 0x2C, 0x82, 0x3F, 0x47, 0x40, 0xC7, 0x08, 0xEC, 0xE3, 0x7A, 0x2A, 0x3B, 0xDF,
+    0xF4, 0x26, 0x38, 0x26, 0x2C, 0x68, 0x31, 0x37, 0xBB, 0x74, 0x2A, 0x67, 0x9F, 0x2E, 0x4B, 0x23,
+    0x33, 0xCA, 0xC7, 0xD7, 0x38, 0xD6, 0x62, 0x1A, 0x73, 0xA6, 0x3F, 0x88, 0x01, 0xFD, 0x98, 0xC2,
+    0x99, 0x82, 0xB0, 0xDD, 0x8E, 0x71, 0x96, 0x65, 0x63, 0x2B, 0xB9, 0x0F, 0xD4, 0x5F, 0xB3, 0x72,
+    0xE6, 0x8A, 0x48, 0x3B, 0xBA, 0x81, 0x43, 0x94, 0x85, 0x41, 0x9F, 0xDD, 0x22, 0xEA, 0x8C, 0x5D,
+    0x3B, 0xDB, 0x32, 0x74, 0x9D, 0x3B, 0xD3, 0xBB, 0x0B, 0xE8, 0x6E, 0x00, 0x6B, 0xFA, 0x77, 0x0F,
+    0x4C, 0x07, 0xEF, 0xE7, 0x87, 0x7A, 0x78, 0x36, 0x07, 0x12, 0x0B, 0x13, 0x87, 0xE3, 0xDC, 0xC5,
+    0x13, 0x76, 0xFD, 0x51, 0x47, 0xE8, 0xD6, 0x1B, 0xA3, 0xCE, 0x1B, 0x82, 0x9E, 0x01, 0x83, 0xF1,
+    0x22, 0xE8, 0x64, 0x6B, 0xEA, 0x6E, 0x28, 0xDC, 0xD4, 0xE5, 0x0F, 0x07, 0x43, 0x50, 0xE3, 0x0A,
+    0xDB, 0xC6, 0x8E, 0x88, 0x71, 0xD8, 0xA4, 0x5E, 0xB4, 0x1F, 0xB4, 0xE5, 0x00, 0x0C, 0x5E, 0xD2,
+    0x71, 0xBE, 0xED, 0x3D, 0x11, 0x7C, 0xD5, 0x9B, 0x9D, 0x08, 0xF5, 0x1D, 0x53, 0x7B, 0xC8, 0xF6,
+    0xE9, 0xF4, 0x42, 0xCD, 0xF4, 0x62, 0x85, 0xB8, 0x5E, 0x15, 0x96, 0x1D, 0x90, 0xA6, 0xF0, 0xA0,
+    0x94, 0x75, 0xDB, 0xBB, 0x49, 0x2A, 0x06, 0xFA, 0x33, 0xCF, 0x8D, 0x3E, 0x85, 0x0F, 0x0A, 0x13,
+    0xCB, 0x4F, 0xA4, 0x42, 0xB5, 0x3D, 0x06, 0x9D, 0x9A, 0xC2, 0x17, 0x52, 0x9B, 0xCA, 0x98, 0xC9,
+    0x78, 0x4C, 0x79, 0x63, 0x61, 0x86, 0x15, 0xD2, 0x71, 0xF0, 0x88, 0x6B, 0x18, 0xCD, 0xCF, 0xE6,
+    0x44, 0x69, 0x8C, 0x38, 0x94, 0x47, 0x50, 0x20, 0x41, 0x89, 0x96, 0x62, 0x33, 0x85, 0xA2, 0xC1,
+    0x39, 0xFB, 0xA6, 0x5C, 0x46, 0xB0, 0xA9, 0x24, 0x80, 0x4F, 0x1C, 0x2A, 0x09, 0xEA, 0x45, 0xD7,
+    0xC7, 0xEB, 0xE0, 0x73, 0x7B, 0xAE, 0xE3, 0x9B, 0x34, 0x67, 0xD3, 0xBB, 0xF5, 0xE4, 0xCA, 0xFE,
+    0x35, 0xD8, 0xEC, 0x6A, 0xF8, 0xC6, 0x98, 0x52, 0x00, 0x5F, 0x23, 0x8C, 0x0F, 0x17, 0xD3, 0x89,
+    0x4D, 0x85, 0xA6, 0x43, 0x9D, 0x5A, 0x79, 0x19, 0x9E, 0x65, 0x6F, 0x15, 0xE9, 0x59, 0x5E, 0x78,
+    0xC3, 0x9D, 0xE2, 0xB0, 0x43, 0x96, 0x2C, 0x7B, 0xD7, 0x5C, 0x0C, 0x10, 0xC8, 0x54, 0x0C, 0x30,
+    0x7F, 0xF6, 0xA6, 0x1C, 0x92, 0xF5, 0x65, 0x73, 0x14, 0xCC, 0xE9, 0xE8, 0x95, 0x3E, 0xE7, 0x57,
+    0x76, 0x43, 0x52, 0x6C, 0xCC, 0x7E, 0xC1, 0x8E, 0x5B, 0x69, 0x22, 0xD8, 0x89, 0x1D, 0xE4, 0x5D,
+    0xD7, 0x41, 0x5E, 0x35, 0x6E, 0x62, 0x28, 0xB0, 0x71, 0xDD, 0xDE, 0xA2, 0xA9, 0x77, 0x56, 0xDC,
+    0x2B, 0xC2, 0xE8, 0x35, 0xAE, 0xC0, 0xDF, 0xB7, 0x97, 0x74, 0x7B, 0x0E, 0x7C, 0x21, 0x0F, 0x68,
+    0x91, 0xDE, 0x2F, 0x03, 0x9B, 0x64, 0xE4, 0xC9, 0x09, 0x4C, 0xB1, 0xF0, 0x00, 0x2A, 0x80, 0x02,
+    0x26, 0x40, 0x82, 0xCE, 0xB8, 0x30, 0x89, 0x03, 0xCB, 0xD9, 0xC4, 0x19, 0xBC, 0xF2, 0x11, 0x7A,
+    0xFF, 0xC1, 0xC3, 0xD0, 0x74, 0x26, 0x3C, 0x2B, 0xD6, 0x6B, 0xD0, 0xC0, 0xA3, 0xD8, 0x55, 0x65,
+    0xA3, 0x40, 0xD5, 0x67, 0xD6, 0x2B, 0x22, 0x6C, 0x93, 0xE0, 0x52, 0xF0, 0xA8, 0x57, 0xB3, 0x7F,
+    0xA5, 0x27, 0x15, 0xEE, 0x27, 0xF6, 0x18, 0xFA, 0xC3, 0x95, 0x42, 0x50, 0xDA, 0xDF, 0xA0, 0x4C,
+    0xE6, 0x52, 0xD3, 0x71, 0xF2, 0x0D, 0x56, 0xDE, 0xD0, 0x4B, 0x34, 0x6E, 0x65, 0xBA, 0x2A, 0x74,
+    0x35, 0x17, 0x29, 0xCB, 0x75, 0x0A, 0xBC, 0xB6, 0xF8, 0x9C, 0xA7, 0x74, 0x49, 0x6F, 0x7A, 0x53,
+    0x15, 0x4F, 0xC1, 0x58, 0xCC, 0xD5, 0x53, 0x27, 0xC4, 0x9F, 0x04, 0xCF, 0x16, 0x82, 0x23, 0x88,
+    0x97, 0x05, 0x2E, 0x24, 0x80, 0x7C, 0x5D, 0xAF, 0x3F, 0x15, 0xE8, 0x49, 0x35, 0x5B, 0xBC, 0xE4,
+    0xDC, 0xCE, 0xAD, 0x01, 0x16, 0x37, 0x77, 0x2D, 0xE1, 0x12, 0xAF, 0x39, 0xDC, 0x66, 0xBB, 0x7A,
+    0x39, 0x10, 0x1C, 0xAD, 0xA6, 0xCC, 0x41, 0xFB, 0xE7, 0xF6, 0x84, 0x31, 0xE9, 0x9F, 0xAF, 0xD4,
+    0x0B, 0xC5, 0x35, 0x6C, 0xA8, 0xAD, 0xE9, 0x78, 0x7C, 0xF4, 0x2C, 0xA5, 0x8A, 0xEF, 0x98, 0x46,
+    0xFC, 0x1E, 0x76, 0xF1, 0x76, 0xAC, 0xDB, 0x44, 0xB7, 0xB6, 0x10, 0xFE, 0xD1, 0x93, 0x34, 0x83,
+    0x1D, 0x22, 0xAA, 0x5B, 0x5D, 0xE2, 0xE7, 0x20, 0x05, 0xED, 0x8C, 0xB4, 0x6B, 0xBC, 0x7D, 0x8F,
+    0x9B, 0x8F, 0x9A, 0x58, 0xD2, 0x4A, 0xBE, 0x1B, 0x3A, 0x33, 0x99, 0x5A, 0xE7, 0xE6, 0x90, 0x5D,
+    0xCF, 0x87, 0xEC, 0x48, 0xA1, 0x8D, 0xC7, 0xCC, 0x80, 0xCF, 0x63, 0x36, 0x9F, 0x91, 0xAB, 0x4D,
+    0x37, 0x6D, 0xB9, 0xF9, 0x9C, 0x31, 0x88, 0x22, 0x35, 0xD7, 0x64, 0xD3, 0xAC, 0xE7, 0x4D, 0xEC,
+    0x1D, 0x27, 0x52, 0xE6, 0xB8, 0xFD, 0xB1, 0x76, 0xF2, 0xA5, 0xED, 0x4B, 0x5B, 0xE0, 0xAF, 0x60,
+    0xAE, 0x28, 0x0B, 0xCA, 0x65, 0xF6, 0xCA, 0x34, 0x6D, 0x8F, 0xB1, 0x0B, 0x98, 0x7C, 0x11, 0x8C,
+    0xE6, 0x90, 0x4D, 0x0D, 0x3C, 0xC4, 0x76, 0x6A, 0xF4, 0x77, 0xB6, 0x29, 0x07, 0xBB, 0x4C, 0xFA,
+    0x25, 0x89, 0xC0, 0xE7, 0xA8, 0xD8, 0x78, 0x2E, 0xF4, 0xD9, 0xE1, 0xDB, 0x03, 0xEE, 0x1C, 0xDB,
+    0x10, 0x1D, 0xB4, 0xC2, 0x3C, 0x0E, 0x83, 0x70, 0x93, 0xBE, 0x1C, 0x41, 0x4C, 0xDF, 0x3A, 0x3C,
+    0xD6, 0xB7, 0x3E, 0x9B, 0x40, 0x3C, 0xF8, 0xF6, 0xD8, 0x41, 0xF7, 0x3F, 0xAA, 0xDC, 0x60, 0xFE,
+    0x34, 0x1F, 0xBC, 0x0C, 0xA9, 0x68, 0xC9, 0x31, 0xD0, 0xBC, 0xF9, 0xA6, 0xBD, 0xF8, 0x7F, 0x67,
+    0xDD, 0x67, 0xDF, 0x2A, 0x91, 0x5D, 0x87, 0x40, 0x03, 0x42, 0x41, 0xD0, 0x80, 0xAE, 0x84, 0xB7,
+    0xEA, 0x97, 0xB7, 0x55, 0x41, 0x87, 0xE9, 0x3E, 0xC6, 0xD7, 0xDF, 0xA9, 0xC4, 0xFB, 0xF2, 0xCC,
+    0x02, 0x9D, 0x23, 0x64, 0xD3, 0x96, 0xD8, 0x9D, 0x9E, 0x7F, 0x33, 0x67, 0xB6, 0xF6, 0x70, 0xBE,
+    0x98, 0x64, 0x39, 0x35, 0x70, 0x32, 0x11, 0xD2, 0xE1, 0xC4, 0x3D, 0xF7, 0x96, 0x34, 0x47, 0x9E,
+    0x7B, 0xB3, 0x0D, 0x2A, 0x5B, 0xE2, 0x22, 0xF5, 0x92, 0xAA, 0x06, 0xF5, 0xD4, 0x21, 0x45, 0x26,
+    0x8F, 0xCB, 0xA0, 0x2D, 0xCC, 0x11, 0x00, 0x56, 0x41, 0x4D, 0x5E, 0x88, 0x02, 0x08, 0x50, 0xBE,
+    0x60, 0xFD, 0xC2, 0x47, 0xC4, 0x4C, 0x8B, 0xE0, 0x00, 0x7F, 0x17, 0xD1, 0x67, 0x15, 0x8A, 0x19,
+    0xF9, 0xE1, 0x47, 0xD0, 0x53, 0xFC, 0x07, 0xE8, 0x3D, 0x53, 0xEF, 0x7C, 0x02, 0xA9, 0xB3, 0xE8,
+    0x5E, 0x2D, 0xB2, 0xBD, 0xE8, 0x1E, 0x12, 0x64, 0x1F, 0x3D, 0xC0, 0xD8, 0x32, 0x97, 0x67, 0x4D,
+    0xA8, 0x79, 0x66, 0x18, 0x0E, 0x8C, 0xFD, 0xE1, 0xC2, 0x68, 0x0A, 0xBA, 0x81, 0x09, 0x50, 0xFF,
+    0xE1, 0x73, 0x58, 0xE9, 0xAE, 0xAB, 0x81, 0xC5, 0x8E, 0xD8, 0xC9, 0x3C, 0xED, 0x0D, 0x59, 0xA0,
+    0xFD, 0x3E, 0x0B, 0x75, 0xD0, 0x66, 0xD1, 0x83, 0xA8, 0x51, 0xF2, 0x2F, 0xB2, 0x56, 0xC9, 0x46,
+    0x5C, 0x2A, 0x95, 0x40, 0x23, 0x37, 0x93, 0x4C, 0xA8, 0xDD, 0x64, 0x1F, 0x24, 0x02, 0xB9, 0x43,
+    0x35, 0x49, 0xC7, 0xC2, 0x07, 0xE5, 0x59, 0x95, 0x4C, 0x0F, 0xAB, 0xB4, 0x8E, 0x46, 0x6D, 0x8A,
+    0xD0, 0xD1, 0xA8, 0x02, 0xBB, 0x98, 0xA1, 0x1E, 0x84, 0x3E, 0x21, 0x17, 0x4A, 0x9F, 0xBF, 0x0F,
+    0x22, 0x86, 0x0C, 0xF2, 0x5E, 0x63, 0x9E, 0xF7, 0x61, 0xDA, 0x0F, 0x9F, 0x47, 0xD3, 0x67, 0xB5,
+    0x1A, 0x07, 0x0E, 0xC8, 0xB8, 0x59, 0x17, 0x8A, 0x35, 0xD7, 0x24, 0x63, 0xB3, 0x7F, 0x07, 0x76,
+    0x84, 0x7D, 0xF2, 0xC8, 0xBD, 0xBD, 0x9E, 0x89, 0x69, 0xE0, 0x1C, 0x03, 0xBF, 0x3C, 0x32, 0x0F,
+    0xEE, 0x33, 0x6D, 0xEE, 0x73, 0xE3, 0x37, 0x87, 0x69, 0x5B, 0x54, 0x3B, 0x1D, 0xEA, 0x9A, 0xF4,
+    0x6F, 0xFA, 0x7F, 0x85, 0x7D, 0xA2, 0xD0, 0x48, 0x62, 0x8F, 0x37, 0x4C, 0xDA, 0x14, 0xE2, 0x7D,
+    0xF8, 0x70, 0x8F, 0x4F, 0x7B, 0xB0, 0xB0, 0xAB, 0x97, 0xCF, 0x41, 0xBA, 0x93, 0x0A, 0x39, 0xF3,
+    0x2C, 0xC7, 0xE0, 0xB1, 0xA6, 0x5C, 0xBF, 0x8E, 0x6F, 0x52, 0xD5, 0x85, 0x7D, 0xC4, 0x84, 0x93,
+    0xB2, 0x11, 0x46, 0xCB, 0xE3, 0x53, 0x73, 0xEE, 0xAD, 0xC8, 0x3D, 0x64, 0x47, 0x5F, 0x00, 0xE7,
+    0xC8, 0xC1, 0x39, 0x9C, 0xD1, 0xA9, 0x72, 0x2E, 0xE6, 0x1C, 0x8F, 0x16, 0x3B, 0x3B, 0x39, 0xE6,
+    0x06, 0x6F, 0xD4, 0xF6, 0x78, 0x25, 0x70, 0xEC, 0x92, 0x24, 0x11, 0xC1, 0xD8, 0xF0, 0xF9, 0xDE,
+    0x62, 0xB5, 0x1C, 0x00, 0xD6, 0x37, 0x07, 0x03, 0x32, 0xFC, 0xE9, 0x71, 0xBB, 0xD7, 0x56, 0x8F,
+    0x97, 0x55, 0xDD, 0x44, 0x34, 0xBC, 0xED, 0x15, 0xE0, 0x8D, 0x2A, 0x84, 0xFE, 0xE0, 0xCB, 0xB9,
+    0x90, 0x9B, 0x8F, 0xAD, 0x88, 0x9A, 0xB0, 0x85, 0xC1, 0x6D, 0x81, 0x1B, 0xE4, 0x84, 0x6E, 0x23,
+    0x46, 0x30, 0xB7, 0x1D, 0x4D, 0x2D, 0x46, 0xFC, 0x62, 0x7E, 0x9F, 0x22, 0x18, 0x19, 0x6C, 0x00,
+    0xA2, 0x14, 0x62, 0xA1, 0xF6, 0x4D, 0x54, 0xCE, 0xC9, 0x06, 0x1F, 0xE9, 0xB3, 0xA7, 0x74, 0x67,
+    0xD7, 0x7B, 0x6B, 0x9E, 0x54, 0xA4, 0x2F, 0x07, 0xEE, 0x91, 0x87, 0x93, 0x4E, 0xB7, 0xE2, 0x89,
+    0x00, 0xE6, 0xC7, 0x49, 0xB2, 0x7B, 0xD2, 0x61, 0xE2, 0x73, 0x8C, 0x12, 0x9C, 0xDE, 0x3C, 0x2D,
+    0x88, 0xDB, 0xFE, 0x0F, 0xC5, 0x5A, 0x3F, 0x8C, 0xDE, 0xE4, 0x19, 0x7F, 0x6D, 0x2B, 0x67, 0x29,
+    0x1E, 0xCC, 0xD0, 0x0C, 0x25, 0x12, 0x5E, 0x3A, 0x54, 0x08, 0xEA, 0x85, 0x31, 0xC4, 0x06, 0x24,
+    0x3A, 0x74, 0x20, 0x43, 0xD3, 0x0E, 0x0C, 0x59, 0x98, 0x4E, 0x95, 0x6E, 0xCD, 0x00, 0x67, 0xA7,
+    0x4B, 0xD7, 0xAB, 0xAA, 0xB6, 0x43, 0x07, 0x6E, 0x08, 0x52, 0xB8, 0xA5, 0x4B, 0x87, 0x0E, 0x24,
+    0xAF, 0x69, 0x87, 0x0E, 0x0C, 0x18, 0x10, 0x62, 0xE8, 0x10, 0x97, 0x26, 0xAA, 0x44, 0x55, 0xE1,
+    0xC0, 0x17, 0x70, 0x88, 0xED, 0xB7, 0xBF, 0xDF, 0xF3, 0xD8, 0xFE, 0xBE, 0x3B, 0x22, 0x95, 0x92,
+    0xCB, 0xF1, 0x91, 0x7B, 0xBF, 0xC3, 0x9F, 0xEF, 0x7D, 0x9F, 0xFF, 0xCF, 0xEF, 0xF9, 0xF9, 0x33,
+    0xC6, 0x98, 0xAC, 0x32, 0xA1, 0xDB, 0x2B, 0x72, 0x53, 0xB8, 0xCE, 0x19, 0xCF, 0x39, 0x37, 0x98,
+    0x60, 0xF4, 0x5D, 0x6B, 0xE2, 0xCE, 0xB8, 0xD2, 0x24, 0xAD, 0xC1, 0x87, 0x69, 0xCD, 0x15, 0xF7,
+    0x72, 0x2D, 0xB9, 0xE2, 0x9F, 0x35, 0x5C, 0x9D, 0xAC, 0x23, 0x57, 0x7F, 0xC0, 0x5A, 0x86, 0x3D,
+    0x76, 0x6D, 0xD2, 0x95, 0x31, 0x89, 0x73, 0x8D, 0x31, 0x91, 0x73, 0xB9, 0xC1, 0xCE, 0x9D, 0xD9,
+    0x78, 0x3D, 0x5E, 0x62, 0x49, 0x2B, 0xB3, 0xD3, 0x64, 0x65, 0xE0, 0x06, 0x67, 0x62, 0xE7, 0x7A,
+    0x93, 0xB6, 0xAE, 0xC6, 0x29, 0xB2, 0x3D, 0x8E, 0xB1, 0x26, 0xE3, 0xFE, 0x72, 0x08, 0x0E, 0x73,
+    0x3C, 0xCB, 0xCA, 0x21, 0xB8, 0xD7, 0xA4, 0x90, 0x11, 0x9B, 0x97, 0x1B, 0xBB, 0xC6, 0xAD, 0xDF,
+    0x9B, 0xE2, 0xA5, 0x26, 0xE8, 0x8C, 0x4D, 0x2B, 0xAE, 0x2E, 0x0F, 0x57, 0x06, 0x2A, 0x45, 0xAD,
+    0x71, 0x7B, 0xF8, 0xDC, 0xC3, 0x5F, 0xC7, 0x0D, 0xEE, 0x32, 0x49, 0x1D, 0xE8, 0xDA, 0x51, 0x10,
+    0xAE, 0x59, 0x85, 0x7B, 0xA1, 0x1E, 0xEE, 0xC5, 0x99, 0x31, 0xD7, 0x32, 0x69, 0x78, 0xBD, 0xA8,
+    0xB0, 0x8A, 0x1A, 0x31, 0xF6, 0x32, 0xC6, 0xA7, 0x5E, 0xEB, 0x97, 0x77, 0x8D, 0xD7, 0xFA, 0xD3,
+    0xFB, 0xA7, 0x7F, 0xD3, 0xC5, 0x4D, 0xFC, 0x69, 0x9B, 0xD4, 0x89, 0xAB, 0x92, 0x2A, 0xBD, 0x87,
+    0x9D, 0x61, 0xB4, 0xAC, 0x82, 0x32, 0x59, 0x29, 0x6A, 0xD1, 0x68, 0xA2, 0x87, 0x07, 0x93, 0xD9,
+    0x80, 0x0B, 0xB7, 0x2C, 0x06, 0x0A, 0xB3, 0xEA, 0xCD, 0x83, 0x5E, 0x51, 0x7D, 0x43, 0x7F, 0x09,
+    0x3E, 0x9B, 0x8C, 0xE8, 0x2D, 0x02, 0x1C, 0xD2, 0xDF, 0x62, 0x3B, 0x3A, 0xD0, 0xD0, 0xF0, 0xD3,
+    0x2F, 0xBD, 0x47, 0xCB, 0x7A, 0xE3, 0xCB, 0x83, 0xB9, 0x78, 0x69, 0x65, 0xBC, 0xC1, 0x73, 0xF4,
+    0x0F, 0xE4, 0x15, 0x31, 0x2A, 0x03, 0x33, 0x58, 0xC3, 0x8B, 0xB4, 0x97, 0x09, 0xF0, 0x47, 0x34,
+    0x99, 0x89, 0x61, 0x0B, 0x5A, 0xCD, 0xA4, 0x0D, 0x0D, 0x4B, 0x3F, 0x54, 0x62, 0xE1, 0x81, 0x7F,
+    0x07, 0x23, 0x06, 0x3D, 0xEF, 0x85, 0x05, 0xE3, 0x2E, 0xA6, 0x58, 0xE9, 0x7B, 0xB6, 0x4D, 0x5B,
+    0x23, 0x96, 0xAA, 0x0A, 0x07, 0xC1, 0x32, 0x37, 0x42, 0x3B, 0x98, 0x2D, 0x83, 0xED, 0xF1, 0xCB,
+    0x11, 0xB5, 0xAE, 0x87, 0x8D, 0x48, 0x9C, 0xED, 0x94, 0x22, 0x70, 0x22, 0xD2, 0xF7, 0x26, 0xEA,
+    0x54, 0x5C, 0xEA, 0x49, 0x69, 0x0F, 0x0E, 0x4A, 0x0A, 0xEB, 0x63, 0x4B, 0xCA, 0x1A, 0x60, 0x47,
+    0x11, 0xD5, 0x77, 0x2A, 0x29, 0x2E, 0x8A, 0xA0, 0x10, 0x52, 0xE4, 0xCC, 0x6A, 0x15, 0xD3, 0x96,
+    0x22, 0x25, 0x0D, 0x4D, 0x21, 0x19, 0x97, 0x94, 0x91, 0x8E, 0xA5, 0x88, 0x19, 0x22, 0x92, 0x12,
+    0xEA, 0xFB, 0x1E, 0x82, 0x6A, 0xB5, 0x96, 0x2D, 0x58, 0xA5, 0xCF, 0x43, 0xA9, 0xB0, 0x8D, 0xDF,
+    0x61, 0x08, 0xB7, 0x21, 0xED, 0x1C, 0xB7, 0xF4, 0x17, 0x36, 0xE5, 0x1D, 0xBB, 0x71, 0xBD, 0x7D,
+    0xB0, 0x17, 0xB8, 0x9B, 0x95, 0x75, 0x0D, 0xA2, 0xB7, 0x72, 0xAE, 0x4E, 0x5A, 0x57, 0xE1, 0x58,
+    0x04, 0x4C, 0x09, 0xB9, 0x0B, 0x78, 0x5C, 0x8C, 0x5B, 0xD0, 0x98, 0x0C, 0x61, 0xA4, 0x91, 0x43,
+    0xAA, 0x40, 0x30, 0xA7, 0x7E, 0x70, 0xC1, 0xC0, 0x28, 0xB4, 0xAE, 0x8F, 0x29, 0xC9, 0xD8, 0x27,
+    0x70, 0x5A, 0xB2, 0xEA, 0x52, 0xB7, 0x8E, 0x04, 0x4B, 0xF1, 0x69, 0x73, 0xA4, 0x0B, 0xAD, 0x55,
+    0x31, 0x86, 0xB3, 0xD2, 0xEB, 0x19, 0x9F, 0x8C, 0x64, 0x39, 0x85, 0xAE, 0xEB, 0x98, 0x23, 0x8C,
+    0xE1, 0x91, 0x06, 0xC1, 0x6D, 0x50, 0x15, 0x37, 0x60, 0xC5, 0x0D, 0x90, 0x1A, 0x2B, 0x76, 0xC2,
+    0x6D, 0xD8, 0x09, 0xB7, 0x65, 0xAE, 0xC7, 0x6D, 0x58, 0x63, 0xAE, 0x9D, 0xAA, 0x85, 0x1B, 0xF0,
+    0xA2, 0xAB, 0x71, 0xAD, 0x94, 0x95, 0x17, 0x32, 0x09, 0x3C, 0xEF, 0x90, 0xFF, 0x12, 0x66, 0x28,
+    0x8B, 0x82, 0x93, 0x15, 0xB2, 0x3D, 0xCE, 0x43, 0x79, 0x1F, 0xE4, 0xD9, 0xE6, 0xD1, 0xEA, 0x1D,
+    0x7C, 0x84, 0x43, 0xF1, 0x11, 0x0E, 0xF5, 0xC5, 0x59, 0x6B, 0xA9, 0x5A, 0x7E, 0x84, 0xA3, 0xF1,
+    0x11, 0x8E, 0xC6, 0x47, 0x90, 0x2D, 0x56, 0xA9, 0x9A, 0x65, 0xED, 0x54, 0xAA, 0xB4, 0x32, 0x5A,
+    0xB1, 0x68, 0x15, 0xCA, 0x96, 0x88, 0x6C, 0x8C, 0x1B, 0x23, 0xF1, 0x3A, 0xD9, 0xEB, 0x2D, 0x98,
+    0x77, 0x34, 0xA3, 0x3F, 0xE0, 0xC8, 0xAB, 0x94, 0xC8, 0xEF, 0xFD, 0xAB, 0x41, 0x1F, 0xAE, 0x82,
+    0x0E, 0x9E, 0x5C, 0xC5, 0x6D, 0xD4, 0x22, 0x4D, 0xE5, 0x07, 0x81, 0xD1, 0xA4, 0x55, 0x52, 0x67,
+    0x15, 0x32, 0x95, 0x8E, 0x43, 0xDD, 0xB1, 0x92, 0xA6, 0x45, 0xCE, 0xCD, 0x47, 0x23, 0x2A, 0x89,
+    0x81, 0x61, 0x02, 0xDB, 0xEA, 0xC9, 0x16, 0xE6, 0x87, 0x92, 0xAE, 0xC2, 0xCE, 0x78, 0x43, 0x11,
+    0x41, 0x9C, 0xB9, 0x36, 0xC0, 0x09, 0x28, 0x9D, 0x21, 0x0E, 0xF1, 0xEF, 0xAF, 0x22, 0x9C, 0x13,
+    0x7C, 0xD1, 0x47, 0x38, 0x26, 0xB8, 0xD3, 0xF3, 0xB4, 0xB0, 0x1D, 0x62, 0x1C, 0x18, 0xB5, 0x2E,
+    0xA9, 0x78, 0x72, 0x91, 0xE2, 0xD8, 0xB8, 0x46, 0x02, 0x64, 0x55, 0x8C, 0x80, 0xC4, 0xE1, 0xF8,
+    0xC0, 0xE5, 0x45, 0x89, 0xCB, 0x4E, 0x8A, 0x60, 0xEC, 0xA4, 0x0C, 0x46, 0x23, 0x13, 0x90, 0xD9,
+    0x39, 0x6A, 0x01, 0x10, 0x3B, 0x9B, 0x50, 0xC2, 0x24, 0xD0, 0xDA, 0x1A, 0xB0, 0x20, 0xF2, 0x4D,
+    0x4B, 0xC2, 0x63, 0x87, 0xB3, 0xCD, 0xEB, 0x44, 0xEA, 0x40, 0xA5, 0x86, 0xD1, 0x29, 0xB5, 0xB7,
+    0x2F, 0x52, 0xB3, 0xA2, 0x41, 0xB8, 0xD3, 0xFB, 0x22, 0x75, 0x3C, 0x49, 0xDD, 0x88, 0xD4, 0x49,
+    0x2D, 0x52, 0xA7, 0x95, 0x48, 0x0D, 0x39, 0x29, 0x35, 0xE4, 0x12, 0xA9, 0x73, 0x91, 0xBA, 0xC8,
+    0x45, 0x6A, 0xC4, 0x37, 0xA5, 0x46, 0x02, 0x52, 0xEA, 0x51, 0xA4, 0x86, 0x9C, 0x94, 0xDA, 0xD7,
+    0x70, 0x9E, 0xDE, 0x02, 0x7D, 0x8B, 0x34, 0xA6, 0x54, 0x6A, 0xCF, 0xD5, 0x5A, 0xCF, 0xF2, 0xC3,
+    0x32, 0x2F, 0xB7, 0x4F, 0x7F, 0xB4, 0x3F, 0x7D, 0xB2, 0x7F, 0xC3, 0x6C, 0xED, 0x07, 0x9F, 0xBB,
+    0x0A, 0xD2, 0xDE, 0x77, 0xB4, 0xED, 0x98, 0xC0, 0xA3, 0x51, 0x2F, 0x3E, 0x6D, 0xE9, 0x55, 0xAC,
+    0x35, 0xE5, 0x85, 0x77, 0xCB, 0x04, 0x0A, 0x64, 0x39, 0xAB, 0x31, 0x8C, 0x5A, 0xD1, 0xC7, 0xF0,
+    0x36, 0x3C, 0x9C, 0xE5, 0x05, 0x24, 0x2D, 0x50, 0x8E, 0x87, 0xB5, 0x80, 0x7A, 0x54, 0x28, 0x87,
+    0x6B, 0x51, 0xD0, 0x72, 0xBB, 0x96, 0xED, 0xB5, 0x90, 0x45, 0x64, 0x87, 0x05, 0xD1, 0x2D, 0x9A,
+    0x48, 0x2C, 0xAE, 0xE6, 0x64, 0x29, 0xB8, 0x8C, 0x1D, 0x5D, 0x85, 0xED, 0x82, 0xBB, 0x3D, 0xAB,
+    0x49, 0xCF, 0xEA, 0xC1, 0x3A, 0x54, 0xB1, 0x49, 0x96, 0x38, 0xD3, 0xFE, 0x56, 0xAA, 0xF4, 0x08,
+    0x0F, 0x60, 0x41, 0x6D, 0x73, 0x4C, 0x02, 0xCB, 0x94, 0xA0, 0x3D, 0xE9, 0x7C, 0xF4, 0x5B, 0xDD,
+    0xBC, 0x8F, 0xD0, 0x1D, 0xD1, 0x12, 0xD3, 0x61, 0x1D, 0xEE, 0xBB, 0x2F, 0x4A, 0x0D, 0x62, 0x01,
+    0x4A, 0x56, 0x8E, 0xFA, 0x95, 0xAC, 0x3B, 0x36, 0x2F, 0xA4, 0xE2, 0xD0, 0x0F, 0x4C, 0x06, 0x14,
+    0x1A, 0x56, 0x19, 0x96, 0x18, 0x93, 0xDC, 0xDD, 0x68, 0xC5, 0xD7, 0x23, 0x24, 0x58, 0x5A, 0x4A,
+    0x12, 0xC5, 0xD3, 0x75, 0x37, 0x4E, 0x3F, 0x9D, 0xE6, 0x1C, 0x33, 0x0E, 0x52, 0xB0, 0x1B, 0xB3,
+    0x19, 0x33, 0xEB, 0xCD, 0x46, 0x72, 0xD0, 0x68, 0xFC, 0x91, 0x7E, 0x4A, 0x20, 0x00, 0x3B, 0x59,
+    0xB5, 0x55, 0xFA, 0x5C, 0x17, 0xFF, 0xBD, 0x41, 0xF1, 0xF4, 0xC7, 0xA9, 0x51, 0xE2, 0x26, 0xC4,
+    0x1E, 0xB2, 0x3D, 0x6A, 0xA7, 0x82, 0x0D, 0x4D, 0x91, 0xDE, 0x29, 0xDB, 0x24, 0x4F, 0xC9, 0x04,
+    0x5B, 0xE8, 0x2B, 0x6C, 0xA0, 0xB9, 0xFF, 0x05, 0xDD, 0x21, 0x51, 0x62, 0xAB, 0xF9, 0x03, 0xD4,
+    0x6B, 0x22, 0x16, 0x02, 0x16, 0xC5, 0x2B, 0x02, 0x57, 0x88, 0x56, 0x6C, 0x2E, 0x60, 0x45, 0xB0,
+    0x8A, 0x40, 0x15, 0x22, 0x15, 0xD8, 0x83, 0xE6, 0xC8, 0x59, 0x95, 0x09, 0x53, 0x8A, 0x0A, 0x99,
+    0x23, 0x20, 0x45, 0x30, 0x4A, 0xC4, 0x6E, 0x75, 0x04, 0xA1, 0xF4, 0x71, 0x65, 0x76, 0x71, 0x7C,
+    0x46, 0xAD, 0x5A, 0xBD, 0xB6, 0x83, 0x1A, 0x0A, 0x23, 0xC2, 0xD8, 0x84, 0x2A, 0x82, 0x54, 0xB4,
+    0x60, 0x30, 0x94, 0x58, 0x30, 0xAC, 0x80, 0x14, 0x62, 0x14, 0x42, 0x14, 0x22, 0x94, 0x23, 0x00,
+    0xA5, 0xBA, 0x0E, 0xE1, 0x3F, 0x97, 0x84, 0xAB, 0x37, 0x22, 0x8A, 0xB0, 0x45, 0x7B, 0x05, 0x13,
+    0x53, 0xDB, 0x1A, 0x0C, 0x34, 0x2A, 0x62, 0x11, 0xC0, 0x92, 0xA0, 0x95, 0xA1, 0x81, 0x48, 0xF5,
+    0x46, 0x68, 0x0A, 0x58, 0x11, 0xAC, 0x52, 0x94, 0x71, 0xAB, 0x48, 0x25, 0xAB, 0x51, 0xB7, 0x33,
+    0xEA, 0xC2, 0x6E, 0x82, 0x23, 0x56, 0x87, 0x14, 0xA2, 0xA7, 0xE7, 0xE8, 0x51, 0x55, 0x81, 0x58,
+    0xF6, 0x50, 0x97, 0x6A, 0xE0, 0x15, 0xC2, 0x15, 0xD6, 0x40, 0xFE, 0x57, 0x12, 0xAB, 0x48, 0x0D,
+    0xA4, 0x32, 0x88, 0x1E, 0xE2, 0x14, 0xC2, 0x94, 0x0C, 0xA1, 0xBC, 0x80, 0x14, 0xEF, 0xE0, 0x9A,
+    0x11, 0x73, 0xE0, 0xA0, 0xD9, 0x72, 0xC1, 0xC7, 0x44, 0x0D, 0xFF, 0xC4, 0x12, 0xBC, 0xDD, 0x9C,
+    0x8C, 0x6A, 0xA7, 0x2E, 0x42, 0x25, 0xC2, 0x46, 0xA7, 0xC1, 0x71, 0x3E, 0x41, 0x00, 0x41, 0xCD,
+    0x67, 0xD3, 0x87, 0x57, 0xD1, 0xAC, 0xCB, 0x15, 0x41, 0x21, 0x3B, 0x9E, 0x31, 0x67, 0x18, 0x7F,
+    0xEF, 0x13, 0x7B, 0x7E, 0x80, 0x25, 0xBC, 0xD2, 0x9C, 0x9C, 0x0B, 0x09, 0x6D, 0xA4, 0x18, 0xF4,
+    0xAC, 0x80, 0xC6, 0x3C, 0x9B, 0x20, 0x81, 0xD3, 0xDC, 0xBC, 0x7A, 0x0C, 0xBA, 0x7A, 0xE6, 0x14,
+    0xCE, 0x6B, 0x5E, 0x9B, 0x6B, 0x9E, 0x40, 0x80, 0x33, 0x88, 0xCF, 0xF0, 0xE3, 0x76, 0xF6, 0xE9,
+    0x49, 0xEA, 0x7A, 0x3E, 0x68, 0x4C, 0xFC, 0xC7, 0xD2, 0x84, 0x08, 0x57, 0xEF, 0xA7, 0xF4, 0xAB,
+    0x39, 0x5E, 0xBF, 0x6A, 0xAD, 0x97, 0xB2, 0x9F, 0x49, 0x20, 0xD1, 0xAF, 0xEF, 0x89, 0x5F, 0x57,
+    0x27, 0xEC, 0x57, 0x16, 0xD9, 0x18, 0xAE, 0x0D, 0x5A, 0xED, 0x70, 0xF4, 0xEB, 0x2E, 0xFD, 0x9A,
+    0x3C, 0xBC, 0xAE, 0x16, 0xD8, 0x0A, 0xD7, 0x42, 0xD4, 0xAC, 0x2D, 0xC1, 0x2E, 0x52, 0xCD, 0x2B,
+    0xCF, 0x3A, 0x36, 0x8D, 0x32, 0xBB, 0x6D, 0x73, 0xA9, 0x5E, 0xF8, 0xFB, 0xEC, 0x0F, 0x28, 0x8A,
+    0x52, 0xB3, 0xE6, 0x02, 0x7C, 0xFA, 0x60, 0x8F, 0x28, 0xAB, 0xE1, 0x32, 0xD7, 0xDE, 0x2C, 0xE6,
+    0x26, 0x68, 0x19, 0xE6, 0xE9, 0xF8, 0x91, 0xB7, 0x3D, 0x66, 0x37, 0x33, 0x7B, 0x9D, 0xDD, 0x1A,
+    0x05, 0xAF, 0xA5, 0x53, 0xFB, 0xDB, 0x7A, 0x88, 0xF6, 0xF7, 0xF8, 0x01, 0x35, 0x71, 0x95, 0x59,
+    0xB6, 0x87, 0x67, 0xE8, 0x02, 0xF1, 0x83, 0x5F, 0x3F, 0x72, 0xED, 0xCE, 0x1C, 0xD1, 0xCE, 0x6F,
+    0xF4, 0xEC, 0xA0, 0x3E, 0x06, 0xED, 0xCC, 0x16, 0x9D, 0x47, 0x84, 0xD2, 0xE8, 0x5B, 0xBD, 0x01,
+    0xAC, 0x20, 0x52, 0x65, 0x44, 0xB2, 0x4A, 0x26, 0x74, 0x76, 0xA9, 0xE4, 0xDF, 0x77, 0x2F, 0x52,
+    0xD1, 0x77, 0xA4, 0xDB, 0xD9, 0x97, 0xF8, 0xE6, 0x8D, 0x32, 0x16, 0x04, 0x18, 0x4C, 0xA0, 0x5C,
+    0xB4, 0x92, 0xC1, 0x24, 0x6E, 0xE5, 0x2D, 0xBB, 0x5D, 0x7C, 0x78, 0x81, 0x6D, 0x58, 0x5A, 0x9C,
+    0x93, 0xF9, 0xD8, 0x77, 0x32, 0xE6, 0x85, 0x9D, 0x0E, 0x89, 0x18, 0xC7, 0x10, 0x4F, 0x1C, 0x7B,
+    0xF0, 0x86, 0xA0, 0x13, 0x42, 0xC0, 0x6C, 0xBF, 0x39, 0xA3, 0x0C, 0x63, 0xDC, 0xB0, 0x08, 0x55,
+    0xBC, 0xF8, 0xF2, 0x2D, 0x88, 0x74, 0x13, 0x97, 0xA0, 0xB1, 0x63, 0x37, 0x77, 0x00, 0x00, 0xD4,
+    0xDA, 0x72, 0x98, 0x7A, 0x8E, 0x3A, 0xB3, 0xAF, 0xE2, 0x9D, 0xF3, 0xAD, 0x71, 0x6F, 0x18, 0xD1,
+    0x9F, 0x73, 0x94, 0x03, 0xDE, 0xC5, 0x88, 0xF9, 0x09, 0x8E, 0x19, 0x79, 0x58, 0x72, 0xF7, 0xCB,
+    0x4D, 0x85, 0x61, 0x0D, 0x19, 0xF3, 0x1C, 0xC7, 0xE2, 0xC0, 0xE5, 0xBF, 0x88, 0xA6, 0xB6, 0x0E,
+    0xD9, 0x70, 0xC2, 0xF6, 0xB5, 0xA2, 0x74, 0x3D, 0x3A, 0x78, 0x6F, 0xF3, 0x9F, 0x77, 0x36, 0x7F,
+    0xF9, 0x5E, 0xF1, 0xBC, 0x1B, 0x8B, 0xBF, 0xB8, 0x21, 0x03, 0x4C, 0x4F, 0x46, 0x5B, 0xC3, 0x46,
+    0xB5, 0xE7, 0x46, 0x4D, 0x8C, 0xF4, 0xBD, 0x7D, 0xE3, 0xBE, 0x6C, 0x61, 0xBE, 0x36, 0xEA, 0x33,
+    0x00, 0xE6, 0x04, 0x20, 0x93, 0x10, 0x93, 0x00, 0x39, 0xD5, 0xDC, 0xAC, 0x00, 0x44, 0xEE, 0xBB,
+    0x3C, 0xA1, 0xEF, 0x07, 0x20, 0xA6, 0x0B, 0x90, 0x73, 0xDB, 0x71, 0xD2, 0xAD, 0x72, 0x0C, 0xB7,
+    0x37, 0x30, 0x4A, 0x58, 0x48, 0x98, 0x8E, 0x66, 0x01, 0x3B, 0x28, 0x43, 0xFE, 0xBD, 0x05, 0xEC,
+    0x14, 0xD5, 0x86, 0xE4, 0x22, 0xBA, 0x8C, 0xF4, 0x14, 0xDE, 0x50, 0x7A, 0x45, 0x25, 0x94, 0x5F,
+    0x47, 0x22, 0x6A, 0x40, 0x10, 0x82, 0x52, 0x95, 0xE3, 0x2F, 0x2C, 0x99, 0x8F, 0x22, 0x67, 0x15,
+    0xAA, 0x38, 0x50, 0x35, 0xC4, 0x59, 0x50, 0x82, 0xDE, 0xAE, 0xCD, 0xA2, 0xCA, 0x94, 0xD3, 0x3E,
+    0x90, 0xD0, 0xEB, 0x98, 0x9B, 0xE1, 0xC3, 0x70, 0xF2, 0x48, 0x7A, 0xE5, 0xEA, 0xAC, 0x64, 0x38,
+    0x4C, 0x4A, 0x42, 0xCD, 0xB4, 0xDE, 0x54, 0xB2, 0x28, 0xB3, 0xB7, 0x5D, 0x9E, 0x3A, 0x21, 0x70,
+    0x30, 0x8E, 0x8C, 0x5A, 0x52, 0x51, 0x14, 0x2F, 0x00, 0x61, 0x59, 0x77, 0x54, 0xC9, 0xA0, 0x85,
+    0x92, 0xDE, 0x03, 0x94, 0xB4, 0x3A, 0x48, 0xE2, 0xFC, 0x11, 0x58, 0xD1, 0x1B, 0xA0, 0xA1, 0xD7,
+    0x27, 0x9C, 0x14, 0x33, 0x52, 0x14, 0xB8, 0x1E, 0xDC, 0x27, 0x35, 0x41, 0x5B, 0x44, 0x5C, 0x62,
+    0x89, 0xC4, 0xCF, 0x84, 0xCF, 0x71, 0x9C, 0x5B, 0x65, 0x42, 0x2E, 0x4A, 0xB2, 0x2D, 0x04, 0x92,
+    0x30, 0x4C, 0x96, 0x27, 0xCD, 0x82, 0x23, 0x05, 0x46, 0xF2, 0xCC, 0x19, 0x44, 0x1E, 0x41, 0xB1,
+    0x9E, 0xA0, 0x58, 0xFF, 0x5A, 0xD0, 0xC7, 0x98, 0xE2, 0xB2, 0x3A, 0x5C, 0xD9, 0x3C, 0xC2, 0xF6,
+    0xF1, 0xFD, 0x95, 0xA4, 0x50, 0xCC, 0xA0, 0x42, 0xD9, 0x4E, 0x3F, 0x42, 0x1C, 0xFD, 0x15, 0xC9,
+    0x76, 0x65, 0x54, 0xD8, 0x07, 0xC3, 0x3F, 0x6A, 0x50, 0x9A, 0xD0, 0x57, 0xEC, 0xCC, 0xA6, 0x5B,
+    0x7A, 0x96, 0x24, 0xDD, 0x82, 0x94, 0xBF, 0x2D, 0x34, 0xF5, 0xD8, 0xEA, 0xD8, 0x7D, 0x98, 0xFF,
+    0x7B, 0x3A, 0x56, 0x84, 0x73, 0x6F, 0xF2, 0x0E, 0xAE, 0x4E, 0xC3, 0x65, 0xB0, 0xF4, 0xAB, 0xEF,
+    0x54, 0xC9, 0xED, 0x03, 0x72, 0x25, 0x73, 0xE9, 0x78, 0x34, 0x4A, 0x2B, 0x4C, 0x47, 0xC3, 0xFC,
+    0x57, 0x8B, 0xCD, 0x99, 0x29, 0x7A, 0x3C, 0x37, 0x60, 0x91, 0x75, 0x10, 0xF6, 0x62, 0x81, 0xB8,
+    0x82, 0x62, 0xFE, 0x34, 0x88, 0x11, 0x96, 0x65, 0xC2, 0x4B, 0x96, 0x1A, 0xD2, 0xCC, 0x4A, 0x72,
+    0x16, 0x69, 0xF5, 0x03, 0xC4, 0x5B, 0xF6, 0x29, 0x26, 0x7B, 0x58, 0x2B, 0xDD, 0xA4, 0x0D, 0x63,
+    0x74, 0x0B, 0x3D, 0xA3, 0x12, 0xF6, 0x4D, 0xF5, 0xBB, 0xB6, 0x9C, 0x21, 0xBC, 0x1B, 0x42, 0x8B,
+    0xF5, 0x8D, 0xA3, 0x28, 0xB7, 0xCB, 0x6E, 0xE1, 0x12, 0xFE, 0xFF, 0xC9, 0xF9, 0x1C, 0x26, 0xFE,
+    0x3C, 0xA1, 0x15, 0xE5, 0x33, 0x3E, 0xCF, 0x51, 0x46, 0xEB, 0xEC, 0xE6, 0xDC, 0x81, 0x31, 0xCC,
+    0x60, 0x0E, 0x33, 0x64, 0xB1, 0xFC, 0x71, 0x4D, 0x5A, 0x12, 0xD9, 0x92, 0x35, 0xA2, 0xF2, 0x9C,
+    0x68, 0x09, 0x72, 0x49, 0x8F, 0xB1, 0xE6, 0xAB, 0xF8, 0x33, 0x5C, 0xD0, 0x01, 0x70, 0x63, 0xF8,
+    0xE3, 0x36, 0x1C, 0x8D, 0xD8, 0x16, 0xA9, 0xFE, 0xC2, 0x3D, 0xCE, 0xD4, 0xE3, 0xC4, 0x3C, 0xCE,
+    0xC4, 0xE3, 0xCC, 0x3B, 0xCE, 0xB4, 0xE3, 0xCC, 0x3A, 0xCE, 0xA4, 0xE3, 0xCC, 0x39, 0xCE, 0x94,
+    0xE3, 0xCC, 0x38, 0xCE, 0x84, 0xE3, 0xCC, 0x37, 0xCE, 0x74, 0xE3, 0xCC, 0x36, 0xCE, 0x64, 0xE3,
+    0xCC, 0x35, 0x2E, 0x54, 0xA3, 0x9D, 0xF4, 0x74, 0x93, 0xD1, 0x9D, 0x52, 0x6A, 0xDF, 0x1D, 0xB3,
+    0x18, 0x68, 0x84, 0x85, 0x3A, 0x4B, 0x46, 0xED, 0xC4, 0x58, 0xEB, 0xDB, 0xC9, 0x52, 0x8A, 0xCB,
+    0x58, 0x43, 0x29, 0x12, 0x38, 0xF7, 0xFC, 0x37, 0xE8, 0x91, 0xDA, 0x61, 0xB4, 0x47, 0xBA, 0x8E,
+    0xED, 0x85, 0xDD, 0x85, 0xCD, 0x85, 0xBD, 0x85, 0xAD, 0xE5, 0x50, 0x8F, 0xD4, 0xC0, 0xAB, 0x35,
+    0x68, 0x86, 0x09, 0x58, 0x3D, 0x82, 0xB6, 0x62, 0x45, 0x01, 0x06, 0x4D, 0x25, 0xC5, 0x9C, 0x82,
+    0xA2, 0x9E, 0x33, 0x5C, 0x3D, 0xF6, 0xC3, 0x27, 0x73, 0x22, 0xF8, 0x19, 0xC3, 0x5B, 0x45, 0x63,
+    0x8E, 0x78, 0x78, 0x24, 0x4F, 0x0A, 0x55, 0x09, 0xE3, 0xEF, 0xFE, 0xAC, 0x17, 0x34, 0x1F, 0x90,
+    0xCF, 0x93, 0x58, 0xEB, 0xE5, 0xD9, 0x40, 0x48, 0x4C, 0x1F, 0x08, 0x43, 0x5A, 0x05, 0x0C, 0xA5,
+    0x0C, 0x6E, 0x20, 0x62, 0xCB, 0x25, 0x11, 0x0F, 0xBD, 0xD2, 0x1F, 0x93, 0x98, 0xDD, 0x11, 0xBE,
+    0x1B, 0xB7, 0x14, 0x0D, 0xC2, 0xB7, 0xA8, 0x60, 0x02, 0xAB, 0x04, 0xAE, 0xF0, 0xB7, 0x42, 0xDF,
+    0x66, 0x0C, 0x3B, 0x9B, 0x93, 0x33, 0x44, 0x02, 0x84, 0xA4, 0x44, 0x80, 0x31, 0xD1, 0x71, 0x6A,
+    0x7D, 0x5A, 0x12, 0x6B, 0x83, 0xAB, 0xA7, 0x41, 0x5D, 0xD8, 0x4F, 0x51, 0x4F, 0x1A, 0x7D, 0xB6,
+    0x14, 0x45, 0xBB, 0xD9, 0xC2, 0xF9, 0x11, 0x87, 0x08, 0x74, 0x3B, 0xC6, 0x77, 0x3B, 0x37, 0xD6,
+    0x72, 0x22, 0x2A, 0x95, 0xF0, 0x23, 0xDD, 0x27, 0x64, 0x9F, 0x50, 0x7D, 0x42, 0xF4, 0x09, 0xCD,
+    0x27, 0x24, 0x9F, 0x50, 0x7C, 0x42, 0xF0, 0x09, 0xBD, 0x27, 0xE4, 0x9E, 0x50, 0x7B, 0x42, 0xEC,
+    0x09, 0xAD, 0x27, 0x54, 0xA4, 0x10, 0x91, 0x4B, 0x18, 0xB3, 0x82, 0x70, 0x22, 0xD5, 0xE2, 0x2D,
+    0xD4, 0x1C, 0x89, 0x39, 0xD2, 0x72, 0x24, 0xE5, 0x48, 0xC9, 0x29, 0xD9, 0x4A, 0xEE, 0x53, 0x71,
+    0xD2, 0x7A, 0x82, 0xC9, 0x72, 0x52, 0x70, 0x85, 0xAA, 0x22, 0xED, 0xDA, 0xF2, 0x69, 0xD1, 0x55,
+    0x46, 0x23, 0xE1, 0x6B, 0xC2, 0xCD, 0xCF, 0x9D, 0xE3, 0xF2, 0x14, 0xAD, 0xF0, 0x16, 0x55, 0x65,
+    0x26, 0xD9, 0xD5, 0x04, 0xC5, 0xFD, 0x7B, 0xAC, 0x60, 0x84, 0xE2, 0xF1, 0x1D, 0x79, 0xA2, 0x23,
+    0x28, 0x5C, 0x78, 0xF1, 0x41, 0x4B, 0xD2, 0x8C, 0xC2, 0xC7, 0x29, 0x9B, 0x8F, 0x52, 0x6B, 0xA9,
+    0x56, 0x73, 0x1E, 0xEA, 0xE5, 0x0A, 0xF7, 0x9F, 0x7D, 0x55, 0x4F, 0x3D, 0xFF, 0xAA, 0x56, 0x78,
+    0x5E, 0x7F, 0x58, 0xAA, 0xCD, 0x6C, 0x10, 0x9C, 0xFE, 0xB0, 0x59, 0x0C, 0xE2, 0x4D, 0x8E, 0xE8,
+    0xBB, 0xC5, 0xE6, 0xB3, 0x94, 0x6B, 0x1E, 0x54, 0x2B, 0xD5, 0x86, 0x88, 0x8F, 0x16, 0xA7, 0x1B,
+    0x8D, 0xAD, 0x88, 0xEE, 0x95, 0xCC, 0xD6, 0xDA, 0x74, 0x8A, 0xD0, 0xE3, 0x75, 0x3E, 0xA6, 0x94,
+    0xA7, 0x94, 0xE3, 0x04, 0x3D, 0x56, 0x21, 0x22, 0x14, 0xB5, 0x92, 0xD4, 0x2E, 0xA1, 0xC7, 0x75,
+    0xC4, 0xD3, 0x95, 0x0E, 0x30, 0xE0, 0x05, 0x48, 0x54, 0xC4, 0x15, 0x04, 0xC9, 0x48, 0xF0, 0x0E,
+    0x84, 0x00, 0xCC, 0xB4, 0xAC, 0x85, 0x7B, 0x53, 0xC9, 0x64, 0x1A, 0xE5, 0x06, 0x33, 0xED, 0x87,
+    0x47, 0x5C, 0x24, 0x0F, 0xFD, 0x4A, 0x45, 0x86, 0x13, 0x2C, 0x38, 0xFB, 0x15, 0xD0, 0x29, 0x12,
+    0x08, 0x3E, 0x89, 0x3A, 0x92, 0xCA, 0xA8, 0xCC, 0xEF, 0xBB, 0x26, 0xFD, 0xDB, 0xCD, 0x3A, 0xBB,
+    0x79, 0xA9, 0xCE, 0x46, 0x9C, 0x0F, 0xA4, 0x9A, 0xB6, 0x36, 0x4F, 0xEE, 0xC3, 0x22, 0xF4, 0x3F,
+    0xCE, 0x78, 0xEA, 0xD0, 0xBE, 0xB1, 0x90, 0x28, 0x77, 0x38, 0x3E, 0xAE, 0x18, 0xC7, 0x97, 0x9F,
+    0x3E, 0x09, 0xDA, 0x38, 0xFE, 0xA8, 0x35, 0x21, 0x4E, 0xF6, 0x5B, 0xEC, 0xFA, 0xA7, 0x73, 0xC7,
+    0x43, 0x1B, 0xC3, 0x41, 0xE3, 0xFC, 0x88, 0x68, 0xF7, 0x12, 0xDC, 0xF4, 0xE7, 0xA0, 0x3A, 0x09,
+    0x0A, 0x3C, 0x66, 0x89, 0x85, 0xDF, 0xAE, 0x5F, 0x2A, 0x4D, 0x1B, 0x96, 0xC7, 0xA1, 0x8B, 0xC7,
+    0xEE, 0x32, 0x64, 0xCA, 0x1C, 0xC6, 0xD3, 0x9E, 0x16, 0x2D, 0x9B, 0xE1, 0x89, 0x1F, 0x6F, 0xBC,
+    0x98, 0xCF, 0x34, 0xB7, 0x00, 0x26, 0xC4, 0x0D, 0xD9, 0x94, 0x88, 0xDD, 0x09, 0x59, 0x79, 0x08,
+    0x30, 0xB1, 0x53, 0x8A, 0xEF, 0xF5, 0x47, 0xEC, 0xF1, 0x2E, 0xD0, 0xCC, 0x07, 0x00, 0x7A, 0xFF,
+    0x80, 0x61, 0xDA, 0xCB, 0x53, 0xAF, 0xB8, 0x05, 0x6D, 0x07, 0xD9, 0x23, 0x69, 0x18, 0xB8, 0x88,
+    0x56, 0xE6, 0xCD, 0x0C, 0xA0, 0xDE, 0xD0, 0x14, 0xB4, 0xC8, 0x96, 0xE2, 0x13, 0x3E, 0xAA, 0x03,
+    0x32, 0xDA, 0xCC, 0x4F, 0x0F, 0xB5, 0x21, 0xE2, 0x43, 0xFA, 0xDF, 0xAD, 0xCC, 0x13, 0x66, 0x75,
+    0xDC, 0x32, 0x9B, 0xB4, 0x53, 0xA4, 0x7D, 0x6F, 0xC7, 0x78, 0x4D, 0x7C, 0x1C, 0x32, 0x23, 0x0C,
+    0xC3, 0x8F, 0x57, 0x3E, 0xFC, 0xAF, 0x31, 0x08, 0x57, 0xF3, 0x5F, 0x77, 0x94, 0xF9, 0x97, 0x07,
+    0xFD, 0x86, 0x23, 0x20, 0xA5, 0xC7, 0x3F, 0x76, 0xE2, 0x91, 0x0F, 0x15, 0xF4, 0x99, 0xC2, 0x88,
+    0x0C, 0x4F, 0xCA, 0xE4, 0x27, 0x55, 0xF8, 0x4B, 0xA9, 0x1B, 0xDB, 0x87, 0xEE, 0x0F, 0xFA, 0xAF,
+    0x3D, 0x61, 0x68, 0xD8, 0x15, 0x93, 0x7A, 0x1D, 0xB5, 0x1A, 0x3F, 0x95, 0x59, 0x4D, 0xBE, 0x3E,
+    0xBE, 0xC7, 0x1D, 0xBE, 0x43, 0x8B, 0x6C, 0x92, 0xDF, 0xB7, 0x3F, 0x32, 0xED, 0xB7, 0x78, 0xDC,
+    0x61, 0xE5, 0xD4, 0x98, 0x93, 0xC9, 0xAF, 0xEA, 0x0D, 0x0A, 0xFD, 0x04, 0x1E, 0x77, 0x24, 0x68,
+    0x2C, 0xE4, 0xB3, 0x83, 0x76, 0x23, 0x48, 0x1F, 0xFA, 0x71, 0x87, 0x3C, 0x2F, 0xF5, 0x19, 0x53,
+    0xC1, 0x6D, 0x14, 0xBC, 0xB0, 0x3C, 0x77, 0x72, 0xCF, 0x6F, 0x12, 0x99, 0xC7, 0x90, 0xD9, 0x3B,
+    0xB9, 0x69, 0xA3, 0xFC, 0x58, 0x14, 0x1A, 0x33, 0x65, 0x3E, 0x11, 0x7D, 0x66, 0x0A, 0x3F, 0x63,
+    0xBF, 0x62, 0xF1, 0x62, 0x17, 0x5D, 0x79, 0x63, 0xD4, 0x79, 0x03, 0x21, 0x24, 0xF1, 0x63, 0xD0,
+    0x05, 0x1D, 0xFB, 0x93, 0x6B, 0x28, 0x1E, 0xBF, 0x38, 0x12, 0xDF, 0x19, 0x84, 0xAC, 0x48, 0x6A,
+    0x28, 0x49, 0x8C, 0x2B, 0x18, 0x28, 0x6D, 0xB2, 0x52, 0xC6, 0x80, 0xF4, 0xDD, 0x06, 0x75, 0x82,
+    0x65, 0x42, 0x1C, 0xE0, 0xED, 0x5F, 0x0F, 0xBE, 0xEC, 0x21, 0x6F, 0xE8, 0xAE, 0x01, 0x89, 0x03,
+    0x85, 0xFC, 0x8F, 0xE8, 0x69, 0x64, 0x4C, 0x8F, 0x6E, 0x63, 0x68, 0xC9, 0x2F, 0x1F, 0xB3, 0x6C,
+    0x90, 0xAE, 0xFF, 0x5A, 0x45, 0x80, 0x84, 0x06, 0x22, 0x8A, 0x4D, 0x21, 0xA4, 0xB0, 0x52, 0x04,
+    0x4B, 0x0F, 0x1C, 0x21, 0x37, 0x12, 0x4A, 0x5F, 0x03, 0x4B, 0xFA, 0x2E, 0xAF, 0xA5, 0x04, 0x17,
+    0xD1, 0x0B, 0xD5, 0x89, 0x11, 0xEE, 0xD2, 0x12, 0x3F, 0x63, 0x4B, 0xEC, 0x97, 0x96, 0x78, 0x0C,
+    0x0F, 0x8A, 0x08, 0x64, 0x84, 0x29, 0x89, 0x3E, 0x24, 0x7E, 0x37, 0x97, 0x4F, 0xEE, 0x09, 0xC2,
+    0x66, 0x5F, 0x9C, 0xEA, 0xDA, 0x43, 0x2B, 0x94, 0x60, 0x92, 0x43, 0xF4, 0xA0, 0x2B, 0x57, 0xC1,
+    0xB0, 0x95, 0x87, 0x33, 0x51, 0x20, 0xFD, 0x24, 0xD7, 0xEF, 0x20, 0x15, 0x74, 0x77, 0xAF, 0x98,
+    0xCD, 0xD3, 0x02, 0xF9, 0xCA, 0xD4, 0x67, 0x39, 0xA5, 0xA5, 0x53, 0xF6, 0xF0, 0x01, 0x4E, 0x30,
+    0x91, 0x0C, 0xAC, 0x6F, 0xA7, 0x35, 0x60, 0x43, 0x0E, 0xA9, 0x18, 0x3E, 0xBE, 0x07, 0xFD, 0xB0,
+    0x0B, 0x72, 0x8D, 0xDF, 0xAC, 0xCA, 0x58, 0x27, 0x31, 0x5A, 0xDE, 0xB0, 0xAD, 0xC5, 0x70, 0xAF,
+    0x4F, 0x8E, 0x2F, 0x48, 0x05, 0xAD, 0xC8, 0x12, 0x7D, 0x5F, 0xBE, 0x59, 0x06, 0x9C, 0xEB, 0x5A,
+    0xD8, 0xA3, 0x39, 0x53, 0x7C, 0x98, 0x3F, 0x88, 0xA1, 0x38, 0x5A, 0xB3, 0x83, 0xE9, 0x67, 0xD6,
+    0x63, 0x9A, 0xC0, 0xCD, 0xA9, 0x0B, 0x53, 0xB4, 0x92, 0x4B, 0x31, 0x13, 0x1A, 0x7C, 0x85, 0x2C,
+    0x94, 0x8F, 0x6C, 0x1A, 0xF7, 0x0A, 0x57, 0x63, 0xD8, 0x5C, 0x12, 0x6F, 0xC9, 0x3D, 0xA9, 0x4B,
+    0xC6, 0xFE, 0x07, 0xE0, 0x52, 0x92, 0x03, 0x3B, 0xE5, 0xF2, 0xA9, 0x0C, 0x42, 0xAF, 0x2C, 0x9D,
+    0xDA, 0x0E, 0x22, 0x2F, 0xBF, 0x0E, 0x85, 0x00, 0x79, 0x22, 0xE7, 0xB4, 0xA1, 0x03, 0xBF, 0x34,
+    0x25, 0xD2, 0x91, 0x67, 0xDD, 0xC2, 0x6C, 0x12, 0xC9, 0xFF, 0xDA, 0xCD, 0xFC, 0xE4, 0xC6, 0x98,
+    0xE7, 0x66, 0x64, 0x9C, 0xF4, 0xD3, 0x97, 0x26, 0x76, 0xF8, 0xF5, 0x3C, 0x69, 0x5A, 0xEC, 0x3E,
+    0xD9, 0xDE, 0xF2, 0x9D, 0x8F, 0xD3, 0xF2, 0xAD, 0x32, 0x54, 0x51, 0xDC, 0xF5, 0x4C, 0xB4, 0x5A,
+    0xAB, 0x8B, 0xCA, 0xBA, 0x25, 0xE3, 0x29, 0x6E, 0xB7, 0xA5, 0x79, 0x8C, 0xC9, 0x99, 0x6C, 0x50,
+    0x48, 0xF8, 0x0C, 0x0D, 0x72, 0xCB, 0xAD, 0x04, 0xD8, 0x15, 0xB7, 0x8C, 0x79, 0x73, 0x8D, 0xCA,
+    0x5B, 0x3E, 0xF2, 0xE9, 0x87, 0x79, 0xF4, 0xCA, 0x9A, 0x85, 0xB9, 0x8D, 0x39, 0xDD, 0x42, 0x99,
+    0x11, 0x1B, 0x79, 0x9B, 0x23, 0xAE, 0x84, 0x3D, 0x16, 0x42, 0xBA, 0xD0, 0x29, 0xFE, 0x18, 0x39,
+    0x6C, 0x0F, 0xFA, 0x55, 0x3D, 0x0E, 0xDA, 0xFA, 0x45, 0x3C, 0xF9, 0x06, 0xDE, 0x3A, 0xEC, 0x97,
+    0xAA, 0x13, 0xD6, 0x98, 0x35, 0xBF, 0x11, 0x73, 0xBB, 0x6B, 0x30, 0x70, 0xCA, 0x8C, 0xFE, 0xFF,
+    0x0C, 0x9D, 0xFF, 0x05, 0x85, 0x54, 0x41, 0x8B, 0x1C, 0x45, 0x14, 0xFE, 0xBA, 0x7B, 0x3B, 0x6D,
+    0x32, 0xB8, 0xBD, 0xC2, 0x2C, 0x26, 0x59, 0xB3, 0x9D, 0x43, 0x0E, 0x21, 0x6E, 0xB6, 0x3D, 0xCC,
+    0x61, 0x82, 0xD3, 0x5D, 0xE5, 0xD9, 0xCB, 0x08, 0x3B, 0x0A, 0x7A, 0x88, 0x07, 0x0F, 0x12, 0x90,
+    0x1D, 0x74, 0x84, 0x45, 0x67, 0xB7, 0xEB, 0x27, 0xCC, 0x4D, 0xF0, 0x92, 0x3D, 0x44, 0x91, 0x09,
+    0x92, 0x46, 0xF7, 0xB0, 0xC6, 0xCD, 0x4E, 0x41, 0x8E, 0x1E, 0xAC, 0x98, 0xBB, 0x14, 0x82, 0x07,
+    0x4F, 0xA9, 0x48, 0x8B, 0x93, 0x30, 0x33, 0xE5, 0xAB, 0x19, 0x56, 0x0C, 0x04, 0x2C, 0x7A, 0x6A,
+    0xBA, 0x5F, 0xBD, 0x7A, 0xF5, 0xDE, 0xFB, 0xBE, 0xAF, 0x00, 0x26, 0x12, 0x59, 0x53, 0xBE, 0x06,
+    0x6A, 0xE3, 0x58, 0x33, 0x7E, 0x0F, 0x6E, 0x58, 0x19, 0x58, 0x15, 0x3F, 0x34, 0x39, 0xAA, 0x58,
+    0x18, 0x66, 0xCD, 0xB1, 0x55, 0x26, 0xE5, 0xE7, 0x87, 0x82, 0x59, 0x7A, 0x38, 0xB9, 0x14, 0x76,
+    0x3C, 0xB2, 0xD5, 0x8D, 0xE1, 0x3E, 0xBD, 0x67, 0xBE, 0x66, 0x77, 0x64, 0x62, 0xC5, 0xA9, 0x27,
+    0xF4, 0xC5, 0x60, 0xB9, 0xC5, 0x65, 0x5C, 0x5E, 0xC7, 0x94, 0xB9, 0xA7, 0x5E, 0xC7, 0x15, 0x5E,
+    0xE8, 0x97, 0x4D, 0xA0, 0x53, 0x99, 0x93, 0x47, 0xA2, 0x98, 0x39, 0xE8, 0x1D, 0x1C, 0x30, 0xB3,
+    0x26, 0xE8, 0x33, 0xAA, 0x66, 0xF1, 0xC3, 0x2A, 0x7D, 0x53, 0xED, 0x24, 0xEE, 0x70, 0x16, 0x98,
+    0xE4, 0xA6, 0x8C, 0x2D, 0xA2, 0x09, 0x42, 0x24, 0x48, 0x91, 0x23, 0xC3, 0x2E, 0xFA, 0xF8, 0x10,
+    0x4B, 0x21, 0xF2, 0x14, 0x59, 0x8E, 0x7E, 0x86, 0xA3, 0x5D, 0x2C, 0x06, 0xBB, 0x2E, 0x93, 0x9F,
+    0x54, 0xED, 0xBE, 0xF1, 0x95, 0x01, 0x47, 0x60, 0x10, 0x3C, 0xC6, 0x9F, 0x5F, 0x88, 0xC3, 0x04,
+    0x6C, 0x8A, 0x9A, 0x76, 0x3E, 0x91, 0x45, 0x6A, 0x65, 0xFE, 0x9E, 0xDA, 0x09, 0x94, 0x57, 0x05,
+    0x26, 0x32, 0xB1, 0x4A, 0x25, 0x13, 0xAB, 0x08, 0x2A, 0x7A, 0xD7, 0xB1, 0x4C, 0x05, 0x65, 0x8A,
+    0xE9, 0x74, 0x7A, 0x6F, 0x37, 0xAB, 0x3F, 0x6B, 0x04, 0x46, 0x60, 0x3C, 0x96, 0x91, 0x04, 0x82,
+    0x49, 0x6C, 0xE6, 0x55, 0x70, 0xE8, 0x57, 0x15, 0x93, 0x81, 0xF4, 0xF8, 0x12, 0x5A, 0xC8, 0x45,
+    0x21, 0x4B, 0xB4, 0x31, 0x9A, 0xDD, 0xF8, 0x16, 0x1B, 0x64, 0x68, 0xA2, 0x81, 0x2E, 0xE0, 0x4F,
+    0x83, 0x49, 0x54, 0x31, 0x5D, 0xF0, 0x2D, 0x78, 0x54, 0x4D, 0x46, 0x0B, 0x19, 0x2E, 0x50, 0x4C,
+    0x4F, 0xFA, 0x32, 0x52, 0xAC, 0xA2, 0x02, 0xF4, 0xF6, 0xFE, 0x32, 0x96, 0x9D, 0x0D, 0x11, 0xB6,
+    0x07, 0x23, 0xBD, 0x8C, 0xD3, 0x58, 0x6D, 0xB3, 0x31, 0x99, 0xEA, 0x98, 0x60, 0xE2, 0x4D, 0xFC,
+    0x71, 0x6A, 0x98, 0x76, 0x09, 0x33, 0x14, 0xD8, 0xC3, 0x31, 0x46, 0x9A, 0xE9, 0x33, 0x83, 0x90,
+    0x20, 0x2C, 0x04, 0xA3, 0x1C, 0xD6, 0x6B, 0x9C, 0x25, 0x92, 0x25, 0xA2, 0x1E, 0x52, 0xD1, 0x6C,
+    0xDC, 0xA2, 0x91, 0x8E, 0x6B, 0x2A, 0xE4, 0x64, 0xE5, 0x39, 0x3E, 0x40, 0x4D, 0x24, 0x2A, 0x30,
+    0x81, 0x19, 0xE9, 0x91, 0xA8, 0xC9, 0x94, 0x7A, 0xBA, 0xC7, 0x0B, 0x6A, 0x03, 0xA8, 0xCF, 0x8B,
+    0x2E, 0x67, 0xD4, 0xE5, 0x23, 0xDC, 0x02, 0xB3, 0x7A, 0xEF, 0xB6, 0x2E, 0x3D, 0x65, 0x7C, 0xD9,
+    0xF6, 0xF8, 0xCA, 0xCA, 0x4A, 0x69, 0x88, 0x07, 0x32, 0x0C, 0x5D, 0x33, 0xF3, 0xC0, 0xA4, 0x27,
+    0x08, 0xB9, 0xA4, 0xE7, 0x74, 0x49, 0xEE, 0x9B, 0xDC, 0xAB, 0x1C, 0x1B, 0x82, 0xFF, 0xB2, 0xE1,
+    0x99, 0xCE, 0x47, 0xBA, 0x95, 0xCC, 0xC6, 0xF9, 0xC8, 0x34, 0x6B, 0xE2, 0x5F, 0x32, 0x31, 0x3B,
+    0x2B, 0xEC, 0x2C, 0xEC, 0x74, 0x10, 0x5B, 0x8B, 0xB0, 0xB3, 0xB5, 0x00, 0xD5, 0x4E, 0x71, 0x65,
+    0xF8, 0x0D, 0x16, 0x5B, 0xD8, 0xC8, 0xB4, 0x6A, 0x62, 0x4E, 0xBB, 0xC9, 0xC8, 0x8E, 0x89, 0x76,
+    0xAB, 0x9D, 0x4E, 0x67, 0x8B, 0x59, 0x6B, 0x27, 0xF3, 0x09, 0x27, 0x83, 0xBC, 0x0A, 0xE9, 0xD3,
+    0x99, 0x15, 0x35, 0x06, 0xAF, 0x9C, 0x98, 0x8F, 0xE8, 0x67, 0x08, 0x3D, 0x22, 0x83, 0x43, 0x31,
+    0xA6, 0x58, 0xA9, 0xCB, 0xF5, 0x39, 0x4B, 0xFC, 0x7F, 0x97, 0x1C, 0x23, 0x90, 0xA5, 0xF1, 0xE6,
+    0x21, 0x61, 0xBC, 0xDF, 0x80, 0xEE, 0x41, 0x8D, 0xAC, 0xEC, 0x74, 0x78, 0xD8, 0xA1, 0x72, 0x74,
+    0x03, 0xAA, 0xEB, 0xC9, 0xBB, 0xB7, 0xE5, 0x70, 0x28, 0xBC, 0x37, 0x78, 0x6A, 0x75, 0xB7, 0x2C,
+    0xDB, 0x2B, 0x2B, 0xC0, 0x46, 0x99, 0xA8, 0x58, 0x7C, 0xA6, 0x56, 0x38, 0x06, 0x91, 0x8A, 0x11,
+    0x23, 0xE2, 0x81, 0x48, 0x71, 0x09, 0xAB, 0xAE, 0x9A, 0xC9, 0x6A, 0xA7, 0xED, 0xD8, 0x66, 0xAB,
+    0xA1, 0x13, 0x16, 0xB1, 0x4E, 0x10, 0xEB, 0x14, 0x55, 0x55, 0x91, 0x66, 0xF8, 0xD1, 0x33, 0xDD,
+    0xA8, 0xD3, 0xFA, 0x36, 0x8F, 0xE7, 0x5C, 0x42, 0xD8, 0xC6, 0xD5, 0xE4, 0x37, 0x51, 0xA4, 0x3F,
+    0xAB, 0x63, 0x16, 0xCB, 0x7A, 0xDF, 0x73, 0x98, 0x72, 0xC6, 0x99, 0x4C, 0x28, 0x73, 0x82, 0x60,
+    0x96, 0x75, 0x3E, 0x6A, 0x62, 0xA3, 0x41, 0xE4, 0xC4, 0x73, 0x4E, 0x5B, 0x5A, 0xCA, 0xF2, 0x7E,
+    0x76, 0xD4, 0x9F, 0xF4, 0x81, 0xF3, 0x03, 0xA6, 0x3C, 0xE5, 0x13, 0xB7, 0x1D, 0xBA, 0x97, 0xDB,
+    0x49, 0xA5, 0x72, 0x2B, 0x3F, 0xFE, 0x15, 0x1E, 0x9F, 0x17, 0xBF, 0xE7, 0x1E, 0x6F, 0x6B, 0x25,
+    0x36, 0xE6, 0xAA, 0x55, 0x8D, 0x35, 0xEE, 0x91, 0xE4, 0x2A, 0xD0, 0xEC, 0xF1, 0x8B, 0xB5, 0xA9,
+    0xB9, 0x50, 0x48, 0x12, 0x6A, 0xFC, 0x40, 0x11, 0xC0, 0xAF, 0x6D, 0xBA, 0xF4, 0xFC, 0x53, 0x48,
+    0xEE, 0x10, 0xD8, 0xF2, 0xCC, 0x8B, 0x0B, 0x3C, 0xD6, 0x51, 0xF0, 0x85, 0x4A, 0xAC, 0x53, 0xD4,
+    0x1F, 0xDE, 0xAD, 0x53, 0x25, 0xD5, 0x89, 0xAE, 0x0A, 0xBF, 0x22, 0xD9, 0xAC, 0x86, 0x74, 0xD2,
+    0xFB, 0x18, 0xB8, 0x13, 0xEB, 0x78, 0x40, 0x53, 0xF7, 0x17, 0xE0, 0x85, 0xC5, 0x44, 0x7E, 0x4B,
+    0x5D, 0x5F, 0xE0, 0x2C, 0x48, 0x6F, 0x54, 0xC1, 0x96, 0xD7, 0x86, 0x3A, 0xFD, 0x35, 0xBA, 0xF3,
+    0x00, 0xBF, 0x7B, 0x5B, 0x61, 0x39, 0x0F, 0x2A, 0xF0, 0x03, 0x09, 0xAE, 0x80, 0xBB, 0x00, 0xC2,
+    0x7C, 0xE7, 0xE0, 0xA8, 0xE5, 0xB2, 0x8F, 0x2C, 0x4F, 0x1E, 0xC9, 0xCC, 0x57, 0xCD, 0x27, 0xCA,
+    0x23, 0x81, 0x95, 0xB4, 0xFA, 0x09, 0x2F, 0x38, 0xC3, 0x8F, 0xE2, 0x25, 0xF8, 0xBC, 0xC0, 0x21,
+    0xB6, 0xE9, 0xBF, 0x81, 0x54, 0x44, 0x74, 0x01, 0x10, 0x98, 0x67, 0xB0, 0x17, 0xF3, 0xF8, 0xBA,
+    0xD8, 0xBB, 0x26, 0x95, 0x3B, 0x64, 0x93, 0xC2, 0xC6, 0xC4, 0x84, 0xFE, 0xBC, 0x94, 0x02, 0x16,
+    0xEE, 0xBE, 0x23, 0x94, 0xF0, 0xBA, 0x4A, 0x07, 0xA9, 0x3C, 0x27, 0x48, 0xC8, 0xEC, 0x91, 0xEA,
+    0x9A, 0x72, 0xBF, 0xEC, 0x7E, 0xFA, 0x97, 0x4E, 0x6F, 0x8A, 0x8B, 0x54, 0xD5, 0x48, 0xBC, 0xC3,
+    0x03, 0xF2, 0x73, 0xB2, 0x1E, 0x17, 0xE4, 0x6F, 0xD2, 0xA7, 0xEF, 0x5A, 0x11, 0x59, 0xE2, 0x3A,
+    0xB6, 0xED, 0x60, 0xCE, 0xB9, 0x5D, 0xA2, 0x6D, 0x54, 0xC5, 0xB3, 0xB7, 0x47, 0xCA, 0xB7, 0x76,
+    0x06, 0xAC, 0xD9, 0x7D, 0x52, 0xC2, 0x70, 0x9F, 0x78, 0xAE, 0x0B, 0x6B, 0xD5, 0xC9, 0x3B, 0xFD,
+    0xC8, 0xE3, 0x16, 0x65, 0x42, 0xBA, 0x79, 0x7A, 0x0C, 0xF6, 0xA5, 0xB5, 0x63, 0x6A, 0xA8, 0x77,
+    0x67, 0x40, 0x61, 0x3A, 0xDC, 0x85, 0x9C, 0x21, 0x20, 0x75, 0xA8, 0xB8, 0xC2, 0x9A, 0x61, 0x64,
+    0x9D, 0x6C, 0x9D, 0xD0, 0x77, 0x31, 0xE6, 0x91, 0x87, 0x13, 0x92, 0xD5, 0xFC, 0x28, 0x1A, 0x07,
+    0xF3, 0xD9, 0xDD, 0xF0, 0xF1, 0x41, 0x56, 0xF6, 0xCA, 0x9E, 0x29, 0xF4, 0x59, 0xE1, 0x72, 0xBD,
+    0xDA, 0xCB, 0xF5, 0x35, 0xE4, 0x83, 0x53, 0xB4, 0x18, 0x71, 0x8F, 0xCE, 0x5D, 0x26, 0xEE, 0x39,
+    0x10, 0x5D, 0xC0, 0x58, 0xB5, 0xE6, 0xDE, 0x39, 0x75, 0x6B, 0xA3, 0xD1, 0xEA, 0x35, 0x17, 0x3B,
+    0xC9, 0x37, 0x91, 0x3B, 0xBC, 0x24, 0x19, 0xDD, 0xE5, 0xE7, 0x5C, 0xE8, 0x0D, 0x34, 0xE3, 0x83,
+    0xD6, 0x49, 0x64, 0x5A, 0x77, 0x51, 0x36, 0x4D, 0x56, 0xBA, 0x1D, 0xA5, 0x6E, 0x3B, 0x95, 0x5F,
+    0xF8, 0x5B, 0x6F, 0xF6, 0x4D, 0xAB, 0x67, 0x9A, 0xA5, 0x6E, 0x3C, 0x56, 0x17, 0xDF, 0x22, 0xE3,
+    0xA6, 0xCC, 0x79, 0x13, 0x3D, 0xB8, 0x4B, 0xD6, 0x6D, 0x62, 0x72, 0xC1, 0x9F, 0x1C, 0xE7, 0xA0,
+    0xF5, 0x77, 0xF2, 0x7B, 0xFE, 0x39, 0x01, 0x72, 0x09, 0xB5, 0xF5, 0xE0, 0xD0, 0xD7, 0x91, 0x59,
+    0xEF, 0xD5, 0x2F, 0xFD, 0x03, 0xCD, 0x5C, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xC8, 0x85,
+    0x42, 0x4C, 0x0C, 0x15, 0xCA, 0x24, 0x21, 0x67, 0x8C, 0x4C, 0xC6, 0x85, 0xCD, 0x44, 0x46, 0xE3,
+    0x22, 0xC9, 0xC4, 0xB9, 0x90, 0x34, 0x63, 0x15, 0x2C, 0xC8, 0x99, 0x90, 0x76, 0xA1, 0x82, 0x29,
+    0x5C, 0x24, 0xCA, 0x24, 0xEB, 0xC2, 0x85, 0xC6, 0xE3, 0x08, 0x10, 0x59, 0xA8, 0x70, 0xA1, 0x9D,
+    0x49, 0x54, 0x65, 0x26, 0xDE, 0x82, 0x9E, 0xA1, 0xD6, 0x05, 0x55, 0xA8, 0x48, 0x32, 0xD2, 0x02,
+    0x22, 0x27, 0xC3, 0x82, 0x05, 0x21, 0xD1, 0x8A, 0x0A, 0x17, 0x84, 0x4C, 0x52, 0x4E, 0xC4, 0x62,
+    0x41, 0x12, 0x6B, 0x82, 0xBB, 0x00, 0x6E, 0xBE, 0xEF, 0x5C, 0xE0, 0xBD, 0xB7, 0xCB, 0x1F, 0xFD,
+    0x90, 0x94, 0x43, 0xE9, 0xDD, 0xB7, 0xBB, 0xEF, 0xE1, 0xE2, 0xDC, 0x73, 0xCF, 0xCF, 0x77, 0x7E,
+    0x2E, 0x94, 0xC2, 0x3F, 0xBF, 0x51, 0xCA, 0xE9, 0xF0, 0xC3, 0xDB, 0x78, 0x7D, 0x5B, 0xC9, 0xBF,
+    0xDC, 0xD4, 0xCA, 0xD8, 0x97, 0x33, 0x1C, 0x4B, 0x5C, 0x7C, 0xEC, 0xF1, 0xD5, 0xE2, 0xEB, 0xC6,
+    0x24, 0x78, 0xA9, 0x00, 0xAF, 0x70, 0xF3, 0xA8, 0x0A, 0x2B, 0xA5, 0xA2, 0x52, 0xA9, 0xB8, 0xB0,
+    0x2F, 0x6D, 0x3A, 0x79, 0xA5, 0x06, 0x5F, 0x76, 0x30, 0x57, 0x78, 0xBE, 0x54, 0xD1, 0xC5, 0x52,
+    0x85, 0x3F, 0x29, 0xEC, 0x1F, 0x1E, 0xDD, 0xFC, 0xA9, 0x31, 0x55, 0x6E, 0x4C, 0x69, 0x8C, 0x29,
+    0x8E, 0x99, 0x63, 0x89, 0x32, 0x98, 0x7B, 0xC0, 0x5D, 0x7A, 0xA5, 0x5C, 0x33, 0x28, 0x0F, 0x9F,
+    0xE1, 0x55, 0x7B, 0x6D, 0xD4, 0xF8, 0x8D, 0xD7, 0x06, 0xF8, 0x29, 0xAC, 0xFD, 0x36, 0xAC, 0xC2,
+    0x26, 0xBA, 0x64, 0xEA, 0xF8, 0x9C, 0x29, 0xF0, 0x52, 0xF3, 0x7F, 0x61, 0x6D, 0xEF, 0x92, 0xE2,
+    0xE7, 0xF6, 0x9E, 0xB4, 0x92, 0x55, 0x3B, 0xE8, 0x05, 0xFB, 0x82, 0xDA, 0x5E, 0x49, 0x5A, 0xC3,
+    0x72, 0x4E, 0xAF, 0xE6, 0x2B, 0xC3, 0x2B, 0x19, 0xA7, 0xF7, 0x4D, 0x05, 0xA2, 0x3B, 0xC7, 0x98,
+    0xD6, 0x1B, 0xD4, 0x9B, 0x21, 0xAE, 0x8F, 0xC6, 0x3B, 0xEA, 0x4F, 0x4E, 0xF3, 0x23, 0x79, 0xE5,
+    0x6B, 0xA7, 0x54, 0x8E, 0x6B, 0x52, 0xBE, 0xF8, 0x59, 0xB5, 0xA4, 0xA2, 0x91, 0x27, 0x8E, 0xE9,
+    0xE7, 0xE4, 0x46, 0x06, 0x6B, 0x36, 0xA5, 0x8B, 0xF5, 0x7B, 0xFD, 0x52, 0xE2, 0x8F, 0xF4, 0xF8,
+    0xA4, 0x0D, 0x1F, 0x39, 0x06, 0x84, 0xA4, 0xF8, 0x43, 0xC8, 0x3F, 0xE0, 0x3A, 0x67, 0x90, 0xD7,
+    0xF7, 0xF1, 0x73, 0xCE, 0xFB, 0x60, 0x59, 0xB1, 0xC9, 0xC6, 0x75, 0x2A, 0xB2, 0x6F, 0x20, 0xF3,
+    0xB0, 0x3E, 0x2C, 0x0F, 0xAB, 0xC3, 0x84, 0x98, 0x0F, 0xCB, 0xC3, 0xEA, 0xB0, 0x38, 0xAC, 0x2B,
+    0x2E, 0xB9, 0x2A, 0xFE, 0x9F, 0x09, 0x79, 0x98, 0x6F, 0xB3, 0x71, 0xB7, 0x5A, 0xF7, 0x66, 0xAD,
+    0x92, 0xE4, 0x7E, 0xF3, 0x78, 0x77, 0xCD, 0x13, 0x15, 0x5C, 0xF5, 0xC2, 0x3C, 0xBB, 0x79, 0x96,
+    0x8E, 0xEB, 0xC7, 0x74, 0x3B, 0xB6, 0x75, 0x62, 0xFD, 0x7D, 0xD8, 0xCF, 0x69, 0xC0, 0x32, 0x8D,
+    0x55, 0x69, 0x5C, 0xA6, 0x47, 0x21, 0x04, 0x2B, 0x0C, 0xBE, 0x49, 0x89, 0x18, 0xDF, 0x6A, 0x6E,
+    0xC7, 0xE6, 0x71, 0xBE, 0x05, 0x35, 0xAF, 0xC4, 0xE5, 0xDC, 0x3B, 0x6C, 0x60, 0x74, 0x8D, 0xF4,
+    0x14, 0x31, 0x36, 0x0B, 0x24, 0x51, 0xD8, 0x40, 0x91, 0xDE, 0x18, 0x48, 0x50, 0x9A, 0x18, 0xD2,
+    0x94, 0x93, 0x26, 0x23, 0x6F, 0xE0, 0xA7, 0xC1, 0x7F, 0xDF, 0xEB, 0xD4, 0xE0, 0xF7, 0xCA, 0xB4,
+    0xB8, 0x53, 0xA7, 0x4C, 0x8D, 0x3D, 0xA9, 0x94, 0xC9, 0x3C, 0x33, 0x24, 0xB3, 0xED, 0xCA, 0x65,
+    0x85, 0x46, 0xD6, 0x38, 0x70, 0x95, 0x58, 0x11, 0xD6, 0x88, 0x35, 0xE5, 0xB2, 0x22, 0x33, 0x8D,
+    0x50, 0x00, 0x88, 0x2F, 0x47, 0x53, 0x04, 0x1C, 0xEB, 0xB0, 0xF6, 0xBA, 0x08, 0x74, 0x42, 0x88,
+    0x9B, 0xA8, 0xF4, 0x9B, 0xA0, 0x89, 0xCB, 0xA0, 0x09, 0xEB, 0xB8, 0x08, 0xEA, 0xB8, 0xD6, 0x45,
+    0x88, 0x6F, 0xEA, 0x0C, 0x23, 0x28, 0x8C, 0xCC, 0xD5, 0x4F, 0x53, 0x8D, 0x04, 0x1C, 0xA8, 0xC8,
+    0x0C, 0xA8, 0x46, 0xEB, 0x37, 0x3E, 0x54, 0xC3, 0xC7, 0x6C, 0x78, 0x55, 0x41, 0x1D, 0x95, 0x9C,
+    0x37, 0xAC, 0xE2, 0x82, 0xDC, 0x94, 0x7F, 0x14, 0x1C, 0xE5, 0x35, 0xCA, 0xCA, 0xB7, 0x8A, 0x92,
+    0xC5, 0x15, 0x81, 0x0F, 0x99, 0x1A, 0x1C, 0x6E, 0x39, 0xC8, 0x77, 0x3B, 0xEC, 0x85, 0xD7, 0x41,
+    0x50, 0xBC, 0x36, 0xCD, 0xC8, 0x6A, 0xAE, 0x07, 0x3C, 0x0C, 0x38, 0x84, 0xBF, 0xE9, 0xC9, 0x69,
+    0xC3, 0x9D, 0x92, 0x01, 0x5F, 0x01, 0x8F, 0x29, 0x0A, 0x22, 0x0C, 0x11, 0x14, 0x24, 0xE1, 0x66,
+    0xCE, 0x84, 0x12, 0x7B, 0x40, 0x09, 0x0D, 0x0B, 0x52, 0x30, 0xD1, 0xB3, 0x0E, 0x9D, 0x50, 0x10,
+    0x62, 0x0C, 0x10, 0x72, 0xA7, 0xF3, 0x4C, 0xE1, 0x76, 0x01, 0xB4, 0xA0, 0x0D, 0x37, 0x32, 0xAF,
+    0xD1, 0x69, 0xE6, 0xD7, 0xB9, 0x4E, 0xFC, 0xBA, 0x4B, 0x55, 0x70, 0xAB, 0xCD, 0x55, 0xF8, 0xEB,
+    0x7A, 0x50, 0xE1, 0xE5, 0xB2, 0x87, 0xCE, 0x64, 0x3D, 0xA4, 0x1E, 0x7A, 0xAC, 0x7B, 0x70, 0x5E,
+    0xB7, 0x10, 0x23, 0x5D, 0x63, 0x6D, 0x69, 0xE9, 0xE3, 0xBE, 0x7B, 0xD5, 0x51, 0x90, 0x95, 0x91,
+    0xD4, 0x0F, 0x5B, 0xAB, 0xB1, 0x4A, 0xFD, 0xDD, 0x78, 0x5B, 0x48, 0x9A, 0x2E, 0x20, 0x72, 0x79,
+    0x82, 0xEF, 0x1B, 0x2C, 0xD0, 0xA5, 0x90, 0x63, 0x02, 0xA7, 0xA3, 0x10, 0xF6, 0xA0, 0x5E, 0x0D,
+    0xDC, 0xDD, 0x5C, 0xC4, 0x97, 0x3C, 0xD7, 0x34, 0xAD, 0x31, 0x6D, 0x09, 0x35, 0x5D, 0x69, 0xAE,
+    0x20, 0xE7, 0x37, 0xF8, 0x61, 0x4E, 0x5D, 0xCE, 0xEB, 0x9D, 0x02, 0x22, 0xF2, 0x41, 0xF1, 0xA0,
+    0x74, 0x64, 0x20, 0x31, 0x4D, 0x3C, 0x4A, 0x08, 0x6E, 0x63, 0xA8, 0x91, 0x10, 0x8C, 0x06, 0x1F,
+    0x05, 0x35, 0x3E, 0x0A, 0x65, 0xA8, 0xF0, 0x79, 0x54, 0xE2, 0xF3, 0x18, 0x92, 0xA1, 0x28, 0x12,
+    0x10, 0x7E, 0x33, 0x0E, 0x94, 0x04, 0xAB, 0x52, 0x76, 0x10, 0x6D, 0xCB, 0xAD, 0xF9, 0xE0, 0x86,
+    0x52, 0x45, 0x54, 0xCA, 0x61, 0xE8, 0x28, 0x1F, 0xA2, 0x58, 0x18, 0xC0, 0x3B, 0xEE, 0x54, 0x47,
+    0x55, 0xE8, 0x79, 0x2D, 0x86, 0xFC, 0x75, 0x0C, 0x14, 0x4D, 0xD7, 0x58, 0xF3, 0x6A, 0xC8, 0x92,
+    0x9C, 0x9A, 0x27, 0xA4, 0xA7, 0xA2, 0xCE, 0x5C, 0x1C, 0xD8, 0x23, 0xAF, 0xDA, 0xE9, 0x77, 0xDA,
+    0x77, 0x0F, 0x76, 0x9B, 0x36, 0x1E, 0x62, 0x5D, 0x84, 0x75, 0x5A, 0x85, 0x55, 0x54, 0x45, 0x25,
+    0x5E, 0x45, 0x5C, 0xC6, 0x45, 0x0E, 0x75, 0x33, 0x89, 0xC6, 0xE4, 0x29, 0xA9, 0xCE, 0x87, 0x64,
+    0xB4, 0xBD, 0x9D, 0x33, 0xBC, 0xD0, 0x39, 0x9D, 0x8B, 0x2D, 0x03, 0xC3, 0xC1, 0x72, 0xAA, 0xF0,
+    0x38, 0x4F, 0x16, 0xD6, 0xCB, 0x55, 0x08, 0x15, 0x81, 0x06, 0x8F, 0xC2, 0x9B, 0x56, 0x9A, 0x0A,
+    0x21, 0x73, 0x35, 0x8F, 0xD0, 0x86, 0xC3, 0x0A, 0xF3, 0xE7, 0x69, 0xE4, 0x26, 0xBF, 0x2E, 0x1B,
+    0x29, 0xFA, 0x65, 0xA8, 0x61, 0x90, 0x48, 0xEA, 0x59, 0x67, 0xAD, 0x95, 0xDC, 0xA6, 0xE5, 0x8D,
+    0xE8, 0x80, 0x78, 0x0B, 0xDE, 0x2C, 0xAA, 0x78, 0x3B, 0x68, 0x2D, 0xC6, 0x3C, 0xA3, 0x51, 0xA4,
+    0x92, 0x8F, 0x63, 0x24, 0xCA, 0x0F, 0x03, 0x89, 0x19, 0x40, 0x01, 0x65, 0xD4, 0x8E, 0x89, 0x10,
+    0xFB, 0xA8, 0x7C, 0x73, 0x9C, 0x85, 0x60, 0x15, 0xEE, 0x13, 0x96, 0xD0, 0x55, 0x6C, 0x43, 0x01,
+    0x55, 0x84, 0x31, 0x29, 0x68, 0x85, 0x1A, 0x7D, 0x52, 0x78, 0xA4, 0x7F, 0x42, 0x11, 0xE9, 0xD3,
+    0xE3, 0xD4, 0x02, 0xDA, 0x12, 0xFB, 0xA6, 0x68, 0x44, 0xE4, 0xCD, 0xEF, 0x07, 0x7A, 0xAA, 0xE8,
+    0x46, 0x2F, 0x8C, 0x7A, 0xBF, 0xE3, 0x9B, 0x39, 0xD9, 0xE1, 0xB6, 0xAE, 0xA1, 0xB7, 0x85, 0x33,
+    0xF2, 0x1A, 0xAE, 0xB0, 0xF1, 0xEB, 0x00, 0x9A, 0x86, 0x95, 0x93, 0x5C, 0xDA, 0x94, 0x5C, 0x4C,
+    0x5C, 0x41, 0x53, 0xE4, 0x64, 0xD1, 0xC4, 0xFF, 0x5A, 0x68, 0xFE, 0x39, 0x38, 0x8C, 0x9D, 0x13,
+    0x6F, 0xF7, 0x5D, 0xF2, 0x59, 0xF6, 0x40, 0xF6, 0xE3, 0x88, 0x32, 0x49, 0x7E, 0xC6, 0x88, 0x07,
+    0x13, 0x29, 0x79, 0xBC, 0x06, 0xC1, 0x39, 0xB2, 0x17, 0x0C, 0xA9, 0x63, 0xD8, 0xE9, 0x3B, 0xE2,
+    0x8C, 0x48, 0xFD, 0xFE, 0x95, 0xC7, 0x6E, 0x88, 0x1E, 0x9F, 0x69, 0xC5, 0xD6, 0xB5, 0xBC, 0xB8,
+    0xB5, 0xEE, 0x50, 0xBC, 0x20, 0x7C, 0x20, 0x5D, 0xB3, 0x38, 0x67, 0xBA, 0xF9, 0x22, 0x9E, 0x5D,
+    0x87, 0x21, 0x4D, 0xC0, 0xFE, 0x9C, 0xA6, 0x63, 0xC0, 0x1B, 0xE4, 0xD2, 0x10, 0x63, 0xC0, 0xED,
+    0xD1, 0x1A, 0x51, 0xC7, 0xE1, 0xE9, 0xDC, 0x6E, 0x32, 0x62, 0xA5, 0x4A, 0x21, 0x9E, 0xA5, 0xA2,
+    0x90, 0x96, 0x0E, 0x36, 0x97, 0x28, 0x0C, 0x20, 0xA5, 0xF2, 0xC1, 0x97, 0xED, 0x2A, 0xDC, 0x28,
+    0xBC, 0xDB, 0x55, 0x74, 0x26, 0xF3, 0x6E, 0x55, 0x5A, 0x67, 0xFE, 0xAD, 0xFA, 0x65, 0x9D, 0x04,
+    0x57, 0xC8, 0xA1, 0xF0, 0xCA, 0x0D, 0xB2, 0xE8, 0xD2, 0x2D, 0xF0, 0x28, 0x3A, 0x77, 0xBB, 0x02,
+    0x93, 0x00, 0xD1, 0x3A, 0x15, 0x9F, 0x30, 0xAF, 0x80, 0x43, 0xCF, 0x1A, 0xF2, 0xC9, 0x1D, 0xC0,
+    0xA8, 0x14, 0x56, 0x80, 0x8A, 0x4D, 0x59, 0x31, 0xE4, 0xD4, 0x80, 0x01, 0x74, 0xE8, 0x82, 0x5F,
+    0xC9, 0x3C, 0xB1, 0x9A, 0x2D, 0x3E, 0xA7, 0x13, 0xB5, 0x43, 0x40, 0xB5, 0x0A, 0x37, 0xBF, 0xDB,
+    0x63, 0x9D, 0xAE, 0x18, 0x4C, 0x4C, 0x2C, 0x56, 0x93, 0x26, 0x5D, 0x17, 0x01, 0x86, 0x0C, 0x7A,
+    0xB9, 0xE0, 0x7F, 0x02, 0xEA, 0x79, 0x2A, 0x72, 0x08, 0x0E, 0xFB, 0x03, 0x40, 0x5B, 0x48, 0xC3,
+    0x0F, 0x56, 0xE6, 0x49, 0x2C, 0x7C, 0xE1, 0x00, 0x46, 0xE7, 0xF0, 0xBB, 0xC4, 0x05, 0x74, 0xB4,
+    0x79, 0x82, 0x0D, 0x4B, 0x13, 0xF8, 0x86, 0xB4, 0x00, 0x9B, 0x74, 0x15, 0x37, 0x54, 0xEA, 0x8A,
+    0x14, 0xC0, 0xE7, 0x9B, 0x76, 0x66, 0xEE, 0xA9, 0x50, 0x66, 0x1A, 0xA0, 0xCD, 0xF9, 0xFD, 0xCC,
+    0xFD, 0x40, 0x73, 0xDF, 0xDF, 0x65, 0xEE, 0x8B, 0x99, 0xB9, 0xA7, 0x29, 0xD1, 0xB4, 0x24, 0xA0,
+    0x9E, 0x86, 0xF3, 0x0E, 0xF5, 0xB4, 0xA4, 0x11, 0x76, 0x86, 0xE3, 0xAD, 0x98, 0x4C, 0x6B, 0x36,
+    0xF1, 0x0A, 0x5A, 0x7F, 0x2B, 0xAF, 0x41, 0x4C, 0x49, 0xBC, 0x10, 0x6E, 0xAD, 0x88, 0x91, 0x88,
+    0x8A, 0xBB, 0x01, 0xD8, 0xA7, 0x82, 0x56, 0x42, 0xE5, 0xF1, 0xBB, 0xF9, 0xF8, 0x7A, 0x10, 0x68,
+    0x85, 0x2F, 0x2A, 0xB8, 0x68, 0x2C, 0x37, 0x03, 0x2A, 0xF9, 0x7C, 0xC8, 0x8E, 0x68, 0x6C, 0x34,
+    0x66, 0x8F, 0xDB, 0x0F, 0x4F, 0x2B, 0xAF, 0x47, 0xA7, 0xAF, 0xD4, 0x92, 0xE0, 0xB8, 0x9C, 0x86,
+    0x97, 0xC2, 0x84, 0x5D, 0xB8, 0x13, 0x9F, 0x87, 0xE0, 0x95, 0x71, 0x46, 0x7F, 0xAD, 0x13, 0x42,
+    0x43, 0x3B, 0xA6, 0xA2, 0x29, 0xB9, 0xF8, 0xF1, 0xC1, 0x85, 0x23, 0x6F, 0xFA, 0xA8, 0x13, 0xDB,
+    0x5E, 0x8B, 0xCB, 0x04, 0xBF, 0x96, 0x81, 0xD0, 0xEC, 0x2A, 0x47, 0x54, 0x05, 0x2B, 0xA3, 0xC4,
+    0x41, 0x63, 0xC3, 0x65, 0x2F, 0xE3, 0x52, 0xD3, 0x28, 0x43, 0xFB, 0xC3, 0x1A, 0x14, 0x06, 0xB7,
+    0x05, 0xD2, 0x37, 0x1C, 0x2A, 0x6A, 0x70, 0xC1, 0x9F, 0x30, 0x53, 0xC8, 0x9F, 0xE2, 0x0D, 0xA2,
+    0xDE, 0xD7, 0x40, 0xA7, 0xA1, 0x81, 0xE8, 0x31, 0x49, 0x40, 0x9F, 0x13, 0xD1, 0xD4, 0x42, 0x23,
+    0x86, 0x7B, 0x21, 0x8B, 0xE4, 0xD3, 0x90, 0x85, 0x77, 0x97, 0xA8, 0x59, 0x1D, 0x31, 0xE2, 0x55,
+    0xB1, 0xAB, 0xA9, 0x75, 0x01, 0xB2, 0x89, 0xE2, 0xF9, 0xB8, 0x8D, 0xDC, 0xC7, 0x10, 0x57, 0xF0,
+    0x2A, 0x5E, 0x84, 0x6B, 0x6A, 0x0A, 0x26, 0xE5, 0x12, 0xD0, 0xB4, 0x84, 0xDE, 0x94, 0xE9, 0x35,
+    0xF1, 0xF3, 0x05, 0xBD, 0xA9, 0xBB, 0x9E, 0x8F, 0x28, 0xFF, 0x1E, 0x48, 0x3F, 0x87, 0xD3, 0x83,
+    0x2C, 0x1A, 0x0B, 0x2C, 0x06, 0x61, 0xAC, 0x58, 0x9F, 0x9C, 0x21, 0x2B, 0x81, 0xB7, 0xDB, 0xC9,
+    0xEF, 0x1E, 0x1D, 0xED, 0x20, 0x9E, 0x16, 0xBF, 0xC3, 0xD5, 0xF2, 0x77, 0x86, 0x7B, 0x5C, 0x44,
+    0x2D, 0xAE, 0x97, 0xC8, 0x56, 0xDE, 0xC4, 0x05, 0x03, 0x26, 0xD0, 0x07, 0xC7, 0x40, 0x1E, 0xA1,
+    0x00, 0x25, 0xEA, 0xA7, 0xBC, 0x95, 0xF6, 0x8D, 0xA2, 0xC1, 0xDB, 0x8A, 0x42, 0x5B, 0xCB, 0x67,
+    0xAC, 0xED, 0x9B, 0xDD, 0x76, 0x98, 0xDF, 0x56, 0x7E, 0xE7, 0xDD, 0xF0, 0x3B, 0xEF, 0xE6, 0xF1,
+    0xEE, 0xF6, 0xB6, 0x35, 0x7F, 0x90, 0xDB, 0xE2, 0x7E, 0xE3, 0x6D, 0xE1, 0x74, 0x79, 0x5B, 0x58,
+    0x59, 0xDC, 0xDF, 0xDE, 0xCF, 0xD8, 0xB7, 0x41, 0xB8, 0x3A, 0xAA, 0xCB, 0x68, 0x52, 0xC7, 0xB7,
+    0xD1, 0x6D, 0xBA, 0xA7, 0xF0, 0x15, 0x18, 0x1C, 0x09, 0xFD, 0x94, 0x3A, 0x66, 0x16, 0xD8, 0x36,
+    0x1C, 0xA1, 0x71, 0x4F, 0x24, 0xEE, 0x1D, 0x72, 0x46, 0xBB, 0x0D, 0x43, 0x85, 0xA0, 0x66, 0xA8,
+    0x40, 0x7C, 0x94, 0x56, 0x91, 0xE5, 0x3B, 0x1C, 0xCF, 0x55, 0x61, 0x39, 0xA8, 0x31, 0xA2, 0x64,
+    0x03, 0x47, 0x32, 0x3E, 0xA2, 0x75, 0xB4, 0xE6, 0x11, 0x14, 0x7A, 0x7D, 0x82, 0x7D, 0xF7, 0x40,
+    0x11, 0x84, 0x13, 0xFB, 0x95, 0x26, 0xC1, 0x16, 0x94, 0x18, 0x36, 0x32, 0x86, 0xAB, 0x21, 0x7A,
+    0x33, 0xE2, 0x32, 0x60, 0xB0, 0x4B, 0xFD, 0x1E, 0x11, 0x4B, 0x7E, 0x96, 0x28, 0xC3, 0x3C, 0xC7,
+    0x91, 0x5E, 0x2B, 0x35, 0xA5, 0xE0, 0x96, 0xFB, 0x04, 0x72, 0xFD, 0x11, 0x48, 0xB2, 0x20, 0x81,
+    0x0C, 0x33, 0x13, 0xBD, 0x55, 0x23, 0x8E, 0x03, 0x2E, 0x5C, 0xC4, 0x84, 0xFD, 0xCC, 0xDB, 0x3B,
+    0xD0, 0x57, 0x8F, 0xB2, 0x43, 0xE4, 0xB0, 0x12, 0x43, 0xEE, 0x83, 0x66, 0x44, 0x97, 0xAD, 0x7A,
+    0xF1, 0xE7, 0x90, 0x66, 0xD3, 0x0A, 0xFE, 0x5C, 0x3B, 0x33, 0x21, 0x0A, 0x42, 0xE0, 0xE2, 0x6F,
+    0x1C, 0xD0, 0x2F, 0x82, 0x0B, 0x81, 0x36, 0xE5, 0x0E, 0x5D, 0xCF, 0xAD, 0xB1, 0xE7, 0x87, 0xF8,
+    0xFE, 0x20, 0x06, 0x1F, 0x4E, 0x77, 0xF0, 0x01, 0x76, 0xBB, 0x40, 0xAC, 0x0C, 0xBD, 0x2F, 0x8D,
+    0x0D, 0xAC, 0x50, 0xCE, 0xFB, 0x17, 0xD6, 0xBD, 0x50, 0xAF, 0xC4, 0xB2, 0x13, 0x74, 0xD1, 0x5D,
+    0x83, 0x2B, 0xC0, 0xED, 0xBD, 0x78, 0x60, 0xEA, 0x0F, 0xDC, 0x68, 0x40, 0x0D, 0x8A, 0xAB, 0x58,
+    0x2C, 0xB5, 0xC8, 0x18, 0x99, 0x99, 0x50, 0xAE, 0xF2, 0x76, 0x81, 0x8A, 0x65, 0xAC, 0x90, 0x78,
+    0x48, 0xC9, 0x97, 0xA2, 0x66, 0xE6, 0x85, 0x11, 0xDC, 0x61, 0x48, 0x13, 0x3B, 0x44, 0x5B, 0xB4,
+    0x09, 0xD6, 0xFD, 0x0F, 0xA3, 0xE7, 0x07, 0xF6, 0xC2, 0x2A, 0x00, 0xDB, 0x80, 0xBB, 0x3A, 0xA2,
+    0xAE, 0x96, 0x98, 0xAB, 0x11, 0xC4, 0x85, 0x8D, 0x7C, 0x65, 0xD5, 0x31, 0xB7, 0x6B, 0xCE, 0x1D,
+    0xB6, 0x90, 0x82, 0x8A, 0x9C, 0x25, 0x3A, 0xC0, 0x2B, 0x8B, 0x33, 0x78, 0x79, 0x28, 0x1A, 0xDD,
+    0x99, 0xC8, 0x21, 0x0C, 0xF7, 0xBA, 0x0A, 0xFA, 0x7F, 0x5A, 0xA0, 0xEC, 0xEF, 0x0B, 0x75, 0x80,
+    0x2B, 0x06, 0xBE, 0x31, 0xFF, 0x9B, 0xF8, 0xFD, 0x98, 0x2B, 0x39, 0xBB, 0xAA, 0xF4, 0x19, 0xD9,
+    0x6F, 0x95, 0x56, 0x44, 0x2B, 0xB0, 0x7B, 0xB0, 0x80, 0x36, 0x34, 0x36, 0x82, 0x88, 0x73, 0x1A,
+    0x9A, 0x0D, 0x72, 0x1C, 0x30, 0xC3, 0x8C, 0x5E, 0xE5, 0x40, 0x4B, 0x07, 0x45, 0x49, 0x2D, 0x42,
+    0xAC, 0x12, 0xF4, 0x14, 0xF1, 0x07, 0x79, 0x46, 0xE4, 0x2F, 0x28, 0xF5, 0x15, 0xD0, 0x21, 0xF4,
+    0xA4, 0x49, 0x7C, 0x8D, 0xC8, 0x18, 0x06, 0x5E, 0x42, 0x77, 0x32, 0xE9, 0xAA, 0xF2, 0xE4, 0x77,
+    0xAC, 0x3F, 0x19, 0xAD, 0x87, 0x6F, 0x44, 0x2A, 0x02, 0xB0, 0x2E, 0xEA, 0xAD, 0xA3, 0xD0, 0xC5,
+    0x1E, 0x15, 0x7F, 0x0C, 0x2E, 0x48, 0xC4, 0x51, 0xCD, 0x97, 0x62, 0xE4, 0xDE, 0x7C, 0x8D, 0x98,
+    0x52, 0x30, 0x7F, 0xAD, 0xFE, 0xF1, 0x30, 0xA2, 0xF6, 0xEB, 0x74, 0x8C, 0x75, 0xD4, 0xE8, 0x9A,
+    0xBA, 0xA9, 0x41, 0x19, 0xF8, 0x53, 0x12, 0x05, 0x81, 0x9E, 0x8C, 0xFC, 0x89, 0xB7, 0x07, 0x99,
+    0xD3, 0x9D, 0x24, 0xC8, 0xAE, 0x45, 0x24, 0x32, 0x80, 0xBD, 0x0B, 0xE5, 0x8A, 0x3C, 0xB1, 0x6B,
+    0xC1, 0x06, 0xFC, 0x6F, 0x32, 0xA2, 0x57, 0xD0, 0xB3, 0xF5, 0x36, 0xAE, 0xE5, 0x1E, 0x59, 0x7A,
+    0x28, 0xAF, 0x54, 0x32, 0x20, 0x5A, 0x97, 0x48, 0xB8, 0x18, 0x28, 0x85, 0x71, 0xD9, 0x8B, 0xD7,
+    0x7B, 0xAF, 0xA7, 0xB3, 0x0B, 0x7F, 0xD5, 0x69, 0xB1, 0xF4, 0x62, 0x6D, 0x23, 0xFB, 0x16, 0x5F,
+    0x1F, 0xC4, 0xAB, 0x9D, 0xAF, 0xC5, 0x74, 0x1E, 0xAA, 0xC1, 0x87, 0x03, 0x43, 0x58, 0xEB, 0xFF,
+    0x81, 0xA7, 0x43, 0xE8, 0x0E, 0x96, 0x57, 0x61, 0x19, 0x4C, 0x98, 0x4C, 0xB9, 0xF9, 0x0A, 0xEE,
+    0x1B, 0x98, 0xC1, 0xB1, 0xD9, 0x99, 0xEF, 0x76, 0x2E, 0x13, 0x00, 0x95, 0xF3, 0x42, 0x2B, 0x39,
+    0x9A, 0x6E, 0x3D, 0x6F, 0x11, 0x59, 0xA4, 0x92, 0x0D, 0xDA, 0xB7, 0xB2, 0x6F, 0x85, 0xDA, 0x17,
+    0x8D, 0x32, 0xC2, 0xB5, 0x8B, 0x84, 0x88, 0x7F, 0xB3, 0xD9, 0x0F, 0x03, 0xAF, 0x62, 0x7C, 0x9B,
+    0x47, 0x4A, 0x3B, 0x20, 0xA9, 0x66, 0xBC, 0xD7, 0x11, 0x27, 0x51, 0x2D, 0xA2, 0xF5, 0x3E, 0xCE,
+    0xC4, 0xB9, 0x1E, 0xB8, 0x2A, 0x7F, 0x7E, 0x98, 0x39, 0xDD, 0xD3, 0xEE, 0x69, 0xC6, 0x12, 0xC0,
+    0xD3, 0x80, 0xC6, 0x79, 0x16, 0xDC, 0xC0, 0x0E, 0x6C, 0xD3, 0xA7, 0xC2, 0x94, 0x82, 0x93, 0xF1,
+    0x65, 0xD8, 0xD2, 0xF3, 0xF0, 0x9C, 0x90, 0x7E, 0x7D, 0x82, 0xBE, 0xCD, 0x58, 0x2C, 0xB6, 0x7F,
+    0x6D, 0x0D, 0x62, 0xC7, 0x6D, 0x80, 0xF9, 0x7A, 0xB6, 0x23, 0x6A, 0x54, 0x03, 0x96, 0xDB, 0x7B,
+    0xAD, 0xD3, 0xF9, 0x0D, 0x14, 0xBB, 0xF6, 0x6C, 0xEA, 0xA3, 0xCA, 0x61, 0x1D, 0xF3, 0x52, 0xFC,
+    0x53, 0x21, 0xF7, 0x5C, 0x53, 0xFB, 0x4F, 0x63, 0x5F, 0x74, 0xE7, 0x43, 0xA0, 0x5B, 0x0C, 0xA6,
+    0x09, 0xCC, 0x2B, 0xA6, 0x0E, 0x37, 0x4E, 0x6E, 0xD7, 0xE1, 0xE5, 0x57, 0xAF, 0x57, 0xD1, 0xC5,
+    0xD7, 0x2E, 0x96, 0xF1, 0xC5, 0x9F, 0xBE, 0x56, 0xC6, 0xAF, 0x19, 0x68, 0xF9, 0xE1, 0x01, 0x0B,
+    0x0B, 0xB1, 0x59, 0x69, 0xD8, 0xEA, 0x24, 0xC7, 0x66, 0x90, 0xF2, 0xD5, 0xF1, 0x0E, 0x35, 0x21,
+    0x36, 0x53, 0x4D, 0xE1, 0xE6, 0x32, 0x81, 0x17, 0xAD, 0x30, 0x64, 0x9E, 0x32, 0x65, 0xE5, 0x5C,
+    0x67, 0xF9, 0x48, 0x39, 0x54, 0xFA, 0x40, 0x33, 0x93, 0x29, 0x4C, 0x56, 0x88, 0xBE, 0x82, 0x3A,
+    0xFC, 0x54, 0x5A, 0x9D, 0xBD, 0xBF, 0x3C, 0xBA, 0xAB, 0xEB, 0xCA, 0xBB, 0x65, 0x0A, 0x18, 0x98,
+    0xD2, 0x1F, 0x10, 0x6A, 0x32, 0xDF, 0xC9, 0xFB, 0xCE, 0xB8, 0x1F, 0xDB, 0x19, 0xE4, 0xBF, 0x39,
+    0xF7, 0xD5, 0xDF, 0x62, 0xC7, 0x3A, 0x89, 0x2C, 0x5B, 0xC7, 0x3C, 0x8F, 0x58, 0x9B, 0x90, 0xD1,
+    0xB5, 0xA0, 0x11, 0x1E, 0x55, 0x32, 0xA8, 0xF0, 0x26, 0x61, 0x1B, 0xD5, 0x34, 0x4F, 0xE1, 0x86,
+    0x49, 0xA2, 0x0B, 0xFD, 0x5D, 0xA0, 0x71, 0xF2, 0xE5, 0x2A, 0x62, 0x2E, 0x0C, 0x9A, 0x1A, 0xB6,
+    0x4F, 0xC0, 0xFE, 0xCE, 0xD2, 0x7D, 0x5A, 0xD4, 0x41, 0x17, 0x4F, 0xC6, 0xE0, 0xA3, 0x81, 0x49,
+    0x2A, 0x2D, 0xD1, 0xCE, 0x3B, 0x24, 0xFB, 0xBC, 0xA1, 0x65, 0xDC, 0x00, 0xF9, 0x43, 0xDC, 0xD3,
+    0x70, 0x4A, 0x2E, 0xAA, 0xA6, 0x81, 0xE0, 0x02, 0xC8, 0x00, 0x31, 0x59, 0x14, 0xA0, 0x84, 0x3F,
+    0xA5, 0x62, 0x28, 0x80, 0x14, 0x68, 0x7A, 0x04, 0x78, 0x11, 0x27, 0x18, 0xF8, 0x18, 0xE7, 0x34,
+    0x94, 0x4B, 0xE0, 0x81, 0xD3, 0xC3, 0x1C, 0x2B, 0x3A, 0x23, 0x35, 0x10, 0x57, 0x0E, 0x12, 0x78,
+    0x13, 0xF5, 0xE6, 0x42, 0x35, 0xD3, 0xBD, 0x7A, 0x7D, 0x42, 0x89, 0x92, 0x11, 0xD1, 0x44, 0x7D,
+    0x31, 0xB5, 0x94, 0x6B, 0x93, 0x85, 0xB9, 0x73, 0xA8, 0x48, 0x4B, 0x94, 0xDA, 0xC4, 0xA9, 0xCD,
+    0x1D, 0x4A, 0x56, 0x8C, 0x5F, 0x14, 0xE9, 0xE1, 0xA4, 0x4B, 0x88, 0x09, 0xE1, 0x4C, 0x24, 0x57,
+    0x02, 0xC3, 0xD0, 0xE6, 0x29, 0x16, 0x30, 0x70, 0x1D, 0x3D, 0x2C, 0xC4, 0xBB, 0x50, 0x52, 0x7D,
+    0x42, 0x06, 0x40, 0x25, 0x7D, 0x0E, 0x7B, 0xAC, 0x2F, 0x35, 0x60, 0x28, 0x21, 0x40, 0x40, 0xFF,
+    0xE5, 0x88, 0x79, 0xBA, 0xDF, 0xEC, 0x76, 0x78, 0x43, 0xAD, 0x41, 0x4C, 0x98, 0xD9, 0xCD, 0x0F,
+    0x81, 0x68, 0xFD, 0x1A, 0x31, 0x32, 0xA1, 0x4B, 0x44, 0x52, 0x43, 0x92, 0x1A, 0xCA, 0x8A, 0x84,
+    0x68, 0x88, 0x95, 0xDB, 0xD3, 0x56, 0x32, 0x78, 0x84, 0x74, 0x72, 0x43, 0x60, 0x28, 0x3F, 0xBB,
+    0x66, 0x0E, 0x12, 0xB1, 0xA4, 0x3D, 0xE4, 0xB6, 0x49, 0x17, 0xF2, 0x22, 0x64, 0xDF, 0xEF, 0xA9,
+    0x7D, 0xD9, 0xFE, 0x6C, 0x9C, 0x61, 0x94, 0x2D, 0xD8, 0x40, 0xC8, 0xB3, 0x3E, 0x47, 0x9F, 0x82,
+    0xF8, 0x6C, 0x00, 0x32, 0xFB, 0xE8, 0xEE, 0xD4, 0x0B, 0xEE, 0x8F, 0x2B, 0x99, 0x6E, 0x5C, 0xD8,
+    0x5C, 0xB1, 0xFD, 0x0B, 0x9B, 0x9B, 0xD8, 0xCD, 0x15, 0x7F, 0xA2, 0x06, 0xEC, 0x66, 0xEE, 0x52,
+    0x91, 0x41, 0x53, 0xC0, 0x3C, 0x36, 0x19, 0x96, 0x76, 0xF9, 0x1D, 0x84, 0x43, 0xB5, 0xFE, 0xD5,
+    0xE8, 0x27, 0x1E, 0xD1, 0xCC, 0xC0, 0x0C, 0x98, 0xD9, 0x64, 0x98, 0xB9, 0xCA, 0xC5, 0x7D, 0xA5,
+    0xF3, 0xDC, 0xA4, 0xE0, 0x5E, 0xA5, 0x8E, 0xC2, 0xD4, 0x24, 0x60, 0x7D, 0x22, 0x59, 0x67, 0x35,
+    0x7B, 0x99, 0x04, 0xDB, 0x58, 0xB9, 0xE6, 0x0C, 0xF5, 0xA7, 0xB5, 0x01, 0x18, 0xEC, 0xCE, 0x70,
+    0xBC, 0x96, 0xF0, 0x2C, 0x1D, 0x26, 0x48, 0xA7, 0xDE, 0x20, 0x37, 0x7A, 0xB0, 0x43, 0x42, 0x98,
+    0x31, 0xD2, 0x0F, 0x99, 0xA0, 0x0D, 0x0D, 0x64, 0x16, 0x1E, 0xDF, 0x67, 0x5E, 0xEB, 0x10, 0xB6,
+    0x2D, 0x3D, 0x8C, 0x21, 0xC7, 0xB2, 0x3E, 0x36, 0x40, 0x49, 0xA6, 0xA3, 0xFF, 0xA8, 0x44, 0x4A,
+    0xED, 0x54, 0x77, 0x45, 0x4F, 0x70, 0x42, 0x21, 0x9D, 0xFA, 0x96, 0xC9, 0x66, 0x1B, 0x4C, 0x66,
+    0x8C, 0x8E, 0xD5, 0x1B, 0x9D, 0xD1, 0x12, 0xED, 0x48, 0x19, 0x30, 0xC4, 0x19, 0x9D, 0x82, 0x67,
+    0x60, 0xFD, 0x3A, 0xFA, 0x08, 0x42, 0xE6, 0xFA, 0x47, 0xA6, 0x84, 0x83, 0x48, 0x7B, 0x6B, 0x93,
+    0x1D, 0x44, 0x5F, 0x2D, 0x15, 0xB8, 0xD1, 0xA6, 0xF5, 0xEB, 0xF4, 0x24, 0x08, 0x87, 0xDA, 0x85,
+    0xBF, 0x19, 0x30, 0x98, 0xDE, 0xE9, 0x23, 0x03, 0xEB, 0x11, 0xFF, 0x1A, 0x46, 0x24, 0x3E, 0x8B,
+    0x95, 0xEB, 0x77, 0x7B, 0x86, 0x02, 0x26, 0x47, 0x1C, 0x00, 0x18, 0x81, 0xD0, 0x7D, 0x98, 0xB2,
+    0xCB, 0x6B, 0x6F, 0x80, 0x77, 0xD6, 0xEE, 0x1B, 0x22, 0x78, 0x98, 0x67, 0xB2, 0xC2, 0x9C, 0xA9,
+    0x05, 0x8E, 0x69, 0xBC, 0xF2, 0xC3, 0x95, 0x33, 0x10, 0x94, 0xD2, 0x1A, 0x80, 0xFA, 0x52, 0x5B,
+    0xF5, 0xA3, 0x12, 0x07, 0x15, 0x33, 0x34, 0xF8, 0xA5, 0x79, 0x68, 0x87, 0xAC, 0xFE, 0x70, 0x1F,
+    0x3E, 0x80, 0x21, 0x4C, 0xE3, 0x44, 0xFD, 0xC1, 0xBE, 0x87, 0x9F, 0x6F, 0x84, 0xBD, 0xFC, 0x5B,
+    0xC4, 0x1C, 0x42, 0x7F, 0xD4, 0xCA, 0xFE, 0x1D, 0x80, 0x9F, 0x6D, 0x6B, 0xA4, 0x83, 0x0E, 0x41,
+    0x48, 0x63, 0x41, 0x2F, 0x13, 0xA1, 0x3B, 0x15, 0x71, 0x52, 0xC2, 0x7C, 0x14, 0xB6, 0xC1, 0x2A,
+    0x4F, 0xDE, 0xD9, 0x88, 0x75, 0xB4, 0x42, 0xD6, 0x4C, 0xE1, 0x46, 0x2E, 0x51, 0x70, 0xF5, 0xF0,
+    0x40, 0xE9, 0x00, 0x11, 0xF4, 0xDC, 0x78, 0x33, 0x2A, 0x2A, 0xB5, 0x29, 0xF4, 0xEB, 0x89, 0x35,
+    0xDE, 0x7A, 0xBB, 0x8E, 0x98, 0x81, 0x15, 0x9F, 0x93, 0xAF, 0x40, 0x4C, 0x70, 0x79, 0x54, 0xFE,
+    0x11, 0xBE, 0x19, 0x71, 0xAA, 0x84, 0xEE, 0x28, 0x65, 0xC5, 0x07, 0xA1, 0xC2, 0x56, 0x5E, 0x31,
+    0xF2, 0x9F, 0xF6, 0x5B, 0xBD, 0x33, 0xD6, 0x88, 0xD4, 0xF7, 0xAD, 0x28, 0x8D, 0x05, 0xA2, 0xDD,
+    0xB5, 0xA6, 0x9D, 0x35, 0x22, 0xD6, 0x48, 0xCE, 0x67, 0xFE, 0x46, 0xE1, 0x5F, 0x2E, 0xDC, 0xEF,
+    0xEC, 0xB8, 0x30, 0xA8, 0x77, 0x5F, 0x38, 0xBA, 0x9A, 0xE9, 0xC2, 0xD9, 0x6D, 0xA7, 0x10, 0xC4,
+    0xDE, 0x59, 0xA6, 0x98, 0xE9, 0xCB, 0xBD, 0x6A, 0x49, 0xF1, 0x3D, 0xB2, 0x22, 0x0B, 0x91, 0x0C,
+    0xDD, 0x4A, 0xDA, 0xD9, 0x22, 0x5B, 0x4A, 0x56, 0xEC, 0x87, 0x28, 0x2B, 0x11, 0x66, 0x9B, 0x6E,
+    0xC5, 0xF8, 0x1C, 0xC7, 0x54, 0x82, 0xFD, 0xDC, 0x33, 0x77, 0xA8, 0xE5, 0x10, 0x24, 0xA8, 0xF9,
+    0x90, 0x17, 0xD4, 0x73, 0x46, 0xCA, 0xB4, 0xBF, 0x44, 0x21, 0x88, 0x76, 0xEA, 0xF0, 0x4E, 0x5E,
+    0xE4, 0x25, 0xF3, 0xB8, 0x79, 0x32, 0x4F, 0x16, 0xB9, 0xA7, 0x97, 0x56, 0x49, 0x2A, 0x89, 0xE3,
+    0x37, 0xA7, 0xB2, 0x15, 0xCB, 0x35, 0x02, 0x0E, 0x87, 0x15, 0x81, 0x88, 0xDD, 0x98, 0x3F, 0x86,
+    0xAD, 0xA0, 0xED, 0xB5, 0x23, 0x84, 0x88, 0x61, 0xBF, 0xFE, 0x90, 0xD8, 0x28, 0x36, 0xAD, 0x44,
+    0x3B, 0xE5, 0x62, 0x91, 0xE5, 0x91, 0x89, 0xA8, 0xE8, 0xE4, 0x58, 0x70, 0x80, 0x47, 0x75, 0x9A,
+    0x87, 0x43, 0x70, 0x93, 0x64, 0xD3, 0x05, 0xFA, 0x98, 0xD6, 0xA9, 0x1F, 0x1A, 0x4D, 0x2A, 0x47,
+    0x3D, 0xC5, 0x7A, 0x12, 0x53, 0xA6, 0xEF, 0x4B, 0xD6, 0x9C, 0x59, 0xDE, 0xF5, 0x31, 0x30, 0xF9,
+    0x32, 0x40, 0xC3, 0x17, 0xA6, 0x7E, 0x0F, 0xE8, 0x6B, 0x6D, 0xCA, 0x88, 0xF6, 0x8E, 0xF9, 0x29,
+    0xEC, 0x67, 0x11, 0xD4, 0xF4, 0x69, 0xC0, 0xAF, 0xD0, 0x4D, 0x20, 0x58, 0x45, 0x3F, 0x67, 0x94,
+    0x8D, 0xE6, 0xF8, 0x37, 0xC3, 0x8C, 0x79, 0x62, 0x5C, 0x60, 0x58, 0xD8, 0x57, 0xF3, 0x0C, 0x56,
+    0x17, 0x30, 0x3E, 0xCF, 0x43, 0xF3, 0x3C, 0x64, 0x21, 0xCE, 0x0F, 0xC3, 0xCE, 0xA6, 0xFA, 0xA7,
+    0x15, 0x1C, 0x12, 0x74, 0x1C, 0x0B, 0x12, 0x4F, 0xD6, 0xC6, 0x90, 0xF0, 0xB8, 0x89, 0x98, 0x0D,
+    0x60, 0x7A, 0x58, 0x1D, 0x4C, 0x5E, 0x04, 0x73, 0xAC, 0xC7, 0xD4, 0x02, 0xB4, 0xB0, 0x4F, 0x8C,
+    0xEE, 0x68, 0xB5, 0x55, 0xEA, 0x18, 0x86, 0x9B, 0xCF, 0x19, 0x66, 0xE7, 0x0E, 0x19, 0xEC, 0x98,
+    0x3E, 0x6E, 0xA8, 0x8A, 0x39, 0x59, 0x15, 0x0F, 0x1A, 0xB3, 0x45, 0x1D, 0x99, 0x85, 0x88, 0x4F,
+    0xD4, 0x4C, 0xCA, 0x8B, 0xA3, 0xF4, 0xED, 0x37, 0x6F, 0xD8, 0x28, 0x12, 0xB2, 0xFB, 0xFB, 0x94,
+    0xC0, 0x79, 0xAD, 0x48, 0x8D, 0xB5, 0xA2, 0xC2, 0xF2, 0x0C, 0xFF, 0x11, 0xC1, 0xBE, 0xBB, 0x98,
+    0x17, 0x58, 0x51, 0x0E, 0x50, 0xAF, 0xC0, 0x5E, 0x05, 0x99, 0xAD, 0x14, 0x80, 0x2F, 0x6C, 0x02,
+    0xBD, 0x28, 0xA0, 0xEF, 0x35, 0x98, 0x20, 0x58, 0x27, 0x5C, 0x6E, 0xE0, 0x42, 0xE2, 0xF7, 0x0C,
+    0xD9, 0x6E, 0xC8, 0x77, 0x03, 0x56, 0x7D, 0xDC, 0xEB, 0x04, 0x9F, 0xA6, 0xCA, 0xDF, 0x99, 0x12,
+    0xC8, 0xC5, 0x18, 0x1A, 0xA9, 0xC8, 0x33, 0x1F, 0x40, 0x9F, 0x34, 0x3C, 0xF3, 0xA6, 0xD3, 0x31,
+    0x03, 0xEA, 0x76, 0x14, 0x72, 0x4F, 0xCA, 0x1D, 0x9E, 0xA8, 0x9D, 0x4D, 0x0B, 0x06, 0x36, 0x39,
+    0xB8, 0x99, 0x1F, 0x3B, 0xC2, 0xF4, 0x9D, 0xE0, 0x43, 0x29, 0x90, 0x30, 0x1B, 0xCF, 0x74, 0x7C,
+    0xB5, 0x44, 0xD4, 0xC5, 0x74, 0x0F, 0xAB, 0xB5, 0x60, 0xA3, 0x43, 0x93, 0x30, 0x89, 0xDE, 0x72,
+    0x25, 0x4E, 0x97, 0x7E, 0x15, 0xB1, 0xBB, 0xAE, 0xFE, 0x06, 0x5B, 0x9B, 0xA9, 0x60, 0xD3, 0xBC,
+    0x2E, 0xCA, 0x9D, 0x48, 0x10, 0x18, 0x5D, 0x1B, 0x8E, 0x61, 0xAA, 0x81, 0x52, 0x66, 0x14, 0xF7,
+    0x77, 0x83, 0x09, 0x48, 0x20, 0xB3, 0x24, 0x9A, 0xE2, 0x6B, 0x8B, 0xFB, 0xA2, 0x6E, 0x12, 0x4F,
+    0x91, 0xC0, 0xFE, 0x1D, 0x12, 0x4E, 0x3E, 0x61, 0xB5, 0x2A, 0x60, 0x12, 0x81, 0xA9, 0x20, 0xE1,
+    0xBB, 0x4A, 0x73, 0x26, 0xAF, 0x35, 0x08, 0xEA, 0x53, 0x26, 0xD0, 0xD7, 0x63, 0x38, 0xBB, 0x81,
+    0xA8, 0xBB, 0x07, 0xBF, 0xDF, 0xED, 0x10, 0xE0, 0x9C, 0xE8, 0x08, 0x42, 0x5F, 0x64, 0x9A, 0x04,
+    0x6C, 0x06, 0xB7, 0xFC, 0xED, 0x52, 0x85, 0x1F, 0x42, 0x7D, 0xCF, 0x63, 0xCB, 0xAF, 0xD7, 0xAC,
+    0x4D, 0xB1, 0xD0, 0xEE, 0x6D, 0x6D, 0x37, 0xFE, 0xAD, 0xDF, 0xB4, 0xE1, 0x95, 0x9B, 0x5D, 0x7C,
+    0xFE, 0x46, 0xA7, 0x9F, 0xAF, 0x99, 0x66, 0x64, 0xD2, 0xC0, 0x08, 0x2A, 0x25, 0x18, 0xA4, 0x92,
+    0x41, 0x7D, 0x1C, 0x7C, 0x92, 0x12, 0x12, 0xF6, 0x5A, 0x12, 0x68, 0x9A, 0xEC, 0x1C, 0xF2, 0x44,
+    0x8A, 0xDF, 0x89, 0x14, 0xBF, 0xB3, 0x70, 0x33, 0x35, 0x1B, 0xC0, 0x71, 0xB9, 0x5E, 0x2E, 0xC2,
+    0x72, 0xD0, 0xC7, 0x8B, 0xE8, 0x6C, 0x97, 0x82, 0xAA, 0x73, 0x6D, 0x1E, 0x16, 0xFA, 0x62, 0xBD,
+    0x1E, 0x96, 0x90, 0xDE, 0x1E, 0x63, 0x4A, 0x74, 0xED, 0x9C, 0x52, 0x07, 0x57, 0x98, 0x19, 0xAE,
+    0x3C, 0xD0, 0x53, 0xF9, 0xB5, 0xB7, 0x8D, 0xC8, 0x2B, 0xB8, 0x55, 0x87, 0x9B, 0xC7, 0x7F, 0xCD,
+    0xD8, 0xC5, 0x34, 0x1C, 0xDA, 0xE8, 0x83, 0xC1, 0xB4, 0xF1, 0x2B, 0x7D, 0xDF, 0xE9, 0x93, 0x77,
+    0x30, 0x1C, 0xBA, 0xD9, 0x76, 0x3A, 0xBC, 0xD4, 0x80, 0x01, 0xE7, 0x6A, 0x81, 0xE1, 0x80, 0xE0,
+    0xC2, 0x77, 0xF9, 0x19, 0x0A, 0x77, 0xE7, 0x7B, 0xDD, 0x64, 0x84, 0x9D, 0x4E, 0xC0, 0xF8, 0x60,
+    0xEB, 0xA9, 0xBD, 0x54, 0x0B, 0xA4, 0x50, 0x65, 0xA4, 0xEB, 0xE2, 0xCC, 0x65, 0xE6, 0xA0, 0xE3,
+    0x0B, 0x35, 0xBE, 0x88, 0x28, 0x1D, 0x17, 0xE9, 0x57, 0x01, 0xAC, 0x9A, 0xF4, 0x79, 0x8A, 0x64,
+    0x2E, 0x29, 0x48, 0xD1, 0x97, 0xC2, 0x50, 0x9D, 0x0F, 0xAE, 0xAD, 0x65, 0x4C, 0xFD, 0x65, 0x02,
+    0x95, 0x55, 0x74, 0x82, 0x6A, 0x72, 0x9E, 0x3A, 0xBE, 0x21, 0x70, 0xBE, 0xB0, 0x85, 0x3F, 0x47,
+    0x92, 0xC8, 0x37, 0xB7, 0xE0, 0xF2, 0xAE, 0x6C, 0xC2, 0xCD, 0x9E, 0xBB, 0xD1, 0x2A, 0x72, 0x18,
+    0x0A, 0xC7, 0x4A, 0x6D, 0xEE, 0xDB, 0x6A, 0x42, 0x20, 0x6F, 0x03, 0x7F, 0xC3, 0x76, 0x7A, 0xFD,
+    0xF7, 0x7A, 0x16, 0x24, 0x99, 0xC6, 0x62, 0x00, 0x0C, 0xC9, 0xA5, 0xBA, 0x6A, 0xA9, 0x20, 0xF1,
+    0x6E, 0xC2, 0xEB, 0x4C, 0xD6, 0xC8, 0xD4, 0xD3, 0x66, 0x7A, 0xF9, 0x3A, 0x5D, 0x69, 0x1E, 0x5D,
+    0x62, 0xE2, 0x72, 0x88, 0xCF, 0x81, 0xD8, 0xF7, 0x3B, 0x8D, 0x37, 0x70, 0x1C, 0xB1, 0x8A, 0xD2,
+    0x17, 0x1A, 0x7D, 0x12, 0x6F, 0xAF, 0xD5, 0xE9, 0x73, 0x78, 0x3B, 0x5E, 0xE6, 0x98, 0xD0, 0x39,
+    0xC5, 0x45, 0x10, 0x0D, 0x9A, 0xC2, 0xAB, 0x29, 0x53, 0x7E, 0x1D, 0xBE, 0xCB, 0x44, 0x68, 0x70,
+    0x09, 0xD3, 0x6D, 0xBE, 0x00, 0x92, 0x42, 0x49, 0xB0, 0xDA, 0x5C, 0x78, 0xF4, 0xDF, 0x03, 0xC0,
+    0x53, 0x7C, 0x72, 0xF3, 0x0E, 0xA6, 0x78, 0x15, 0xAC, 0x57, 0xFA, 0xF0, 0x25, 0x58, 0x39, 0x1D,
+    0x9D, 0xAB, 0x49, 0xDE, 0xAB, 0x2C, 0x40, 0x3B, 0xEA, 0x1B, 0xCA, 0x7B, 0x0F, 0x41, 0xD4, 0x36,
+    0x03, 0xE2, 0x4C, 0xDC, 0x56, 0x2E, 0xD9, 0xBD, 0x5E, 0xBD, 0xE4, 0x0E, 0x63, 0x4B, 0x4B, 0x2F,
+    0x3D, 0x2F, 0x11, 0xDB, 0x59, 0x86, 0x44, 0x9A, 0x3F, 0xD4, 0x72, 0x6D, 0x9D, 0x39, 0x2D, 0x77,
+    0x48, 0xEF, 0x5C, 0x3B, 0x67, 0x4C, 0x19, 0xB1, 0x41, 0x82, 0x85, 0xE9, 0x7F, 0x19, 0x01, 0xFA,
+    0xDA, 0xAA, 0x4C, 0x47, 0x9F, 0xA8, 0x8E, 0xC0, 0xBC, 0xFE, 0x8E, 0x7A, 0x5B, 0x05, 0x70, 0x42,
+    0xDE, 0x06, 0xF3, 0x5D, 0xC0, 0x0E, 0x52, 0xFC, 0x68, 0xD4, 0xD7, 0x46, 0x80, 0xB0, 0x77, 0x99,
+    0xB9, 0xB9, 0x44, 0x3A, 0x6F, 0xD4, 0x72, 0x69, 0x81, 0x02, 0x2C, 0xFE, 0x7E, 0xF1, 0x93, 0xD0,
+    0x3F, 0xAC, 0xE5, 0x17, 0x10, 0x02, 0xEA, 0xDD, 0xDA, 0x29, 0xCC, 0xDB, 0xD9, 0xE2, 0xDC, 0xD1,
+    0x3D, 0x40, 0xA9, 0x31, 0xA2, 0x0E, 0x82, 0xC7, 0x1C, 0xEE, 0x4C, 0x27, 0xAC, 0xF1, 0xA6, 0x89,
+    0x64, 0x4C, 0x59, 0x03, 0xCC, 0x72, 0xA9, 0x5C, 0x31, 0xF6, 0xD0, 0x49, 0x0F, 0x99, 0xD0, 0xCF,
+    0x30, 0x12, 0xD0, 0x67, 0xBB, 0xD8, 0xA6, 0x88, 0x0B, 0xF1, 0xEC, 0x09, 0x77, 0x8B, 0xBE, 0xE6,
+    0xC0, 0xE6, 0xAC, 0x38, 0x61, 0xA3, 0x44, 0x1B, 0x26, 0xAA, 0xB1, 0x67, 0x63, 0x21, 0x5C, 0x9C,
+    0xC7, 0x8C, 0x89, 0xDA, 0xB7, 0x9A, 0x2E, 0xAD, 0x62, 0x6B, 0x09, 0x1B, 0x06, 0x0C, 0x05, 0x30,
+    0x79, 0x2C, 0xC0, 0xFC, 0x2C, 0x8C, 0xA5, 0x44, 0xA4, 0xD8, 0x52, 0x38, 0x11, 0xAF, 0x01, 0x5D,
+    0x3E, 0x03, 0x8D, 0x43, 0xB5, 0xA4, 0xFA, 0x59, 0xAB, 0x64, 0xB5, 0x50, 0x84, 0x9C, 0xB0, 0x71,
+    0x77, 0x30, 0x2A, 0x8A, 0x90, 0xCE, 0x8B, 0x27, 0x30, 0xCA, 0x92, 0x69, 0x75, 0x78, 0xAD, 0x37,
+    0xC0, 0x11, 0x62, 0x1F, 0x72, 0x25, 0x65, 0x48, 0xBA, 0x85, 0x44, 0x7F, 0xB2, 0x66, 0x2B, 0x09,
+    0x09, 0x73, 0xDE, 0x49, 0x7E, 0xEC, 0x98, 0xB1, 0xDD, 0x43, 0xB6, 0x76, 0xC6, 0xDC, 0xA9, 0x2E,
+    0xA3, 0xFB, 0xD4, 0xCE, 0x96, 0x99, 0x28, 0x95, 0xB2, 0x0A, 0xD8, 0x9F, 0x8F, 0x25, 0x18, 0x30,
+    0x11, 0x13, 0x71, 0x32, 0x73, 0xCC, 0xA6, 0x1F, 0x73, 0xCE, 0xB4, 0xD1, 0x8D, 0xC9, 0xC7, 0x6C,
+    0xAC, 0xD9, 0xAA, 0x9C, 0x09, 0x5C, 0x6C, 0x83, 0x49, 0x71, 0x75, 0x4A, 0x98, 0x44, 0x47, 0x49,
+    0xB7, 0x06, 0xE7, 0xA8, 0x29, 0xD3, 0x50, 0x53, 0x7D, 0x18, 0x8C, 0xFF, 0x29, 0x40, 0x68, 0x9E,
+    0xE1, 0x45, 0x17, 0x66, 0x2D, 0x6A, 0xD4, 0x5A, 0x8C, 0xF8, 0x22, 0x1C, 0x39, 0xEE, 0x8C, 0xEB,
+    0x11, 0xD2, 0x38, 0x58, 0x0A, 0x09, 0x7E, 0x1E, 0x1B, 0x07, 0x77, 0x0A, 0x9D, 0x50, 0xB0, 0x56,
+    0xB8, 0x8E, 0x61, 0xE1, 0xCE, 0xEB, 0xA4, 0xA7, 0xE5, 0x22, 0xE4, 0x08, 0x6A, 0xE1, 0x7D, 0x04,
+    0xB9, 0xAA, 0x5F, 0x7A, 0xA4, 0x74, 0x49, 0x88, 0x4A, 0xF0, 0xFC, 0x1A, 0x14, 0xEE, 0x5C, 0xA5,
+    0xDC, 0x77, 0xED, 0x1F, 0x1F, 0x86, 0xDE, 0xF9, 0x96, 0x2A, 0xBB, 0xAB, 0xB6, 0xA7, 0x4A, 0x42,
+    0x41, 0xD9, 0x5B, 0xCA, 0x1F, 0xD4, 0x72, 0x69, 0xD5, 0x39, 0x0D, 0xCF, 0x9B, 0x3F, 0x5F, 0x4B,
+    0x9D, 0x3A, 0x7D, 0xAE, 0x61, 0xC4, 0xC4, 0x77, 0x48, 0x17, 0x2C, 0x1C, 0x65, 0x8B, 0x90, 0xFC,
+    0xD9, 0x16, 0x92, 0x05, 0x7F, 0xE3, 0x76, 0x00, 0x3C, 0xF0, 0x81, 0x4E, 0x67, 0x4B, 0xA6, 0xEC,
+    0x3F, 0x91, 0xAA, 0xE9, 0xD0, 0xDA, 0xC2, 0xA9, 0x00, 0x44, 0xFA, 0xE1, 0x51, 0x04, 0xF2, 0xC2,
+    0x4A, 0x41, 0x3E, 0xC6, 0x3D, 0x63, 0xF7, 0x9E, 0x33, 0x76, 0xC5, 0xF9, 0x63, 0x6F, 0x81, 0xA9,
+    0xC7, 0xF7, 0x72, 0xDE, 0xBF, 0x04, 0x99, 0x41, 0x78, 0xFC, 0x86, 0xF8, 0x57, 0x17, 0x21, 0xAA,
+    0xA1, 0xBF, 0x89, 0x6B, 0xC3, 0x34, 0x20, 0x38, 0xFD, 0x2C, 0x65, 0x3F, 0xD1, 0xAF, 0xC0, 0xAE,
+    0x33, 0x2D, 0xD0, 0x11, 0x37, 0xA5, 0x49, 0x97, 0x4B, 0x32, 0xBB, 0xB7, 0x5D, 0x5E, 0x43, 0x27,
+    0x12, 0x95, 0xB7, 0xB6, 0x57, 0xAF, 0x16, 0xB9, 0x02, 0xF0, 0xA7, 0x68, 0x8D, 0x11, 0xF8, 0x58,
+    0x37, 0xB5, 0x74, 0x79, 0xFD, 0x2C, 0xE3, 0xCC, 0x37, 0x1B, 0x5B, 0xD9, 0x8E, 0xB0, 0x3D, 0x1C,
+    0xFE, 0x4A, 0xB8, 0x4A, 0x7F, 0xC1, 0x72, 0x83, 0x94, 0xAA, 0x87, 0x75, 0xB8, 0x79, 0xCC, 0x5F,
+    0xB0, 0x32, 0xC4, 0xDC, 0x7F, 0x6C, 0x07, 0xA9, 0xE6, 0x4F, 0x05, 0x00, 0x19, 0xD2, 0x2C, 0xCD,
+    0xA4, 0xA6, 0xC7, 0x22, 0xE3, 0xED, 0xCB, 0xA2, 0x0C, 0xA2, 0xA0, 0xE5, 0xE8, 0x90, 0xA4, 0x67,
+    0x6A, 0x49, 0xF0, 0x37, 0xC1, 0x47, 0x23, 0x91, 0x20, 0x53, 0x8F, 0xD0, 0xE4, 0x52, 0xBF, 0xCB,
+    0xE5, 0x12, 0xA3, 0x84, 0x52, 0xC8, 0x31, 0xD2, 0x36, 0x80, 0x5D, 0xF9, 0x07, 0xA6, 0xE1, 0x8D,
+    0x0D, 0x05, 0x48, 0x31, 0xAB, 0x00, 0x4F, 0x0A, 0xE1, 0xD2, 0x06, 0xE5, 0x49, 0xED, 0xD2, 0x7F,
+    0x86, 0xC1, 0x94, 0xF3, 0x4D, 0x6B, 0x6B, 0x64, 0xFC, 0x8A, 0x8C, 0xDF, 0x9A, 0x37, 0x27, 0xF6,
+    0x8E, 0xD4, 0xA9, 0x3C, 0xE6, 0xF8, 0x06, 0x60, 0xB9, 0xA0, 0x7F, 0xC2, 0x79, 0xBE, 0x93, 0x0E,
+    0x04, 0xA9, 0xD0, 0x3A, 0x52, 0xA2, 0x9D, 0x8D, 0x19, 0x77, 0x31, 0x4D, 0x82, 0xCA, 0xED, 0x49,
+    0x97, 0xD7, 0xB1, 0x5C, 0x88, 0x11, 0x60, 0x96, 0x32, 0xA4, 0x8B, 0x88, 0x09, 0x98, 0x32, 0xA7,
+    0x11, 0x67, 0x24, 0x6E, 0xB6, 0xE1, 0xBB, 0xB0, 0xC1, 0xE6, 0xEA, 0xEC, 0x96, 0x62, 0x96, 0xFE,
+    0x73, 0xC0, 0x4C, 0x1F, 0x1D, 0xC0, 0xE0, 0x73, 0xFD, 0x6E, 0x31, 0xAE, 0x1F, 0xB6, 0x7D, 0xFC,
+    0x97, 0xAE, 0x2C, 0x67, 0x9E, 0xA9, 0x88, 0x02, 0x4A, 0x03, 0xF3, 0x9A, 0xFC, 0x35, 0xBB, 0x57,
+    0x1C, 0x71, 0xE5, 0x43, 0xAE, 0x8E, 0xAA, 0x1E, 0x3B, 0xED, 0x60, 0xCB, 0x7B, 0xB7, 0x83, 0x64,
+    0x7A, 0x9D, 0xF1, 0xFA, 0xA0, 0x61, 0x2E, 0x08, 0x6E, 0x2D, 0x07, 0x16, 0xED, 0x83, 0x59, 0x28,
+    0xBB, 0x06, 0x0F, 0xC2, 0xEC, 0x00, 0xB7, 0xF6, 0xE3, 0x0F, 0x79, 0xAF, 0xE4, 0x99, 0xD9, 0x7D,
+    0xBE, 0x44, 0x6C, 0xAE, 0xF6, 0x1E, 0x3B, 0xA6, 0x24, 0x10, 0xE4, 0xB8, 0xCC, 0x4D, 0xDB, 0xFB,
+    0xC4, 0x1F, 0x4C, 0x94, 0x3C, 0x16, 0xE4, 0xBE, 0xBB, 0x39, 0xC0, 0x3C, 0x33, 0x6F, 0x0E, 0x28,
+    0x77, 0x85, 0xCC, 0x77, 0x35, 0x07, 0xEC, 0x11, 0x01, 0x0B, 0xC4, 0x3F, 0x2C, 0xC6, 0xDD, 0xBB,
+    0x62, 0xEF, 0xE5, 0xAB, 0xAE, 0xCD, 0x2C, 0x34, 0x5F, 0xA3, 0x19, 0xC9, 0xC6, 0xF6, 0xD2, 0xF1,
+    0x7F, 0xE8, 0x00, 0x3D, 0x08, 0xA6, 0x91, 0x68, 0x7C, 0x67, 0xD3, 0xA9, 0x52, 0x4F, 0xE0, 0xF5,
+    0xB4, 0x52, 0x2B, 0x7F, 0xA9, 0x54, 0xFB, 0x16, 0xE6, 0x1B, 0xE1, 0x80, 0x8F, 0xEB, 0xC2, 0x20,
+    0xFB, 0x21, 0x3E, 0x4A, 0x7F, 0x6C, 0x6B, 0x87, 0x44, 0x12, 0xDE, 0x65, 0xE8, 0xF1, 0x09, 0x98,
+    0xCC, 0x45, 0x51, 0xA1, 0x90, 0x63, 0xD3, 0xEB, 0xDC, 0x94, 0x2F, 0x49, 0xF8, 0xF6, 0xF7, 0xA6,
+    0xCC, 0xB7, 0xAB, 0xFF, 0x70, 0xAB, 0xAF, 0x62, 0x31, 0xEF, 0xA8, 0x1F, 0x8B, 0xF0, 0x7F, 0x13,
+    0x4C, 0x8D, 0x92, 0x48, 0x5A, 0x86, 0x97, 0xAE, 0x62, 0x65, 0xBF, 0xD0, 0x79, 0xFB, 0x6D, 0x97,
+    0x01, 0xDF, 0x1F, 0x4E, 0xD1, 0x84, 0xB5, 0x0E, 0xAA, 0x7C, 0xD3, 0xBE, 0x27, 0x4F, 0x4E, 0x46,
+    0x60, 0xAF, 0x12, 0x64, 0xC3, 0x46, 0x22, 0xE7, 0x3D, 0x2C, 0xFB, 0xAD, 0x1F, 0x28, 0x27, 0x39,
+    0x32, 0x7D, 0xE3, 0x81, 0xFF, 0xA4, 0x95, 0x01, 0x6C, 0xF8, 0x73, 0xD2, 0xE6, 0xFE, 0x77, 0xF1,
+    0x47, 0x5C, 0xB1, 0xAB, 0xB2, 0x4F, 0xBD, 0xF0, 0x65, 0x5E, 0x8C, 0xAF, 0x5D, 0x07, 0x55, 0x3F,
+    0xAA, 0xA1, 0x1E, 0x30, 0xEC, 0x2B, 0xDF, 0x5A, 0xFC, 0x46, 0x3C, 0x06, 0x12, 0x53, 0x4C, 0x54,
+    0xFC, 0x60, 0xE7, 0x0C, 0x7B, 0xED, 0xDB, 0xEF, 0xDA, 0xB7, 0x3F, 0xB5, 0x6F, 0x7F, 0xC9, 0xE1,
+    0x07, 0x60, 0x0A, 0xFE, 0xBD, 0xA4, 0xBE, 0xAF, 0xFC, 0x44, 0xFE, 0x94, 0x8B, 0x89, 0x20, 0x3B,
+    0xC8, 0xDB, 0x07, 0x53, 0x27, 0xC6, 0xD1, 0x2F, 0x45, 0x93, 0xFD, 0xC1, 0x11, 0x87, 0xB3, 0xFF,
+    0x81, 0x57, 0xB8, 0x78, 0xBD, 0x69, 0x97, 0xD3, 0x88, 0x13, 0xC5, 0xFD, 0x9D, 0x0A, 0x1B, 0xFF,
+    0xA7, 0x96, 0xA4, 0xDF, 0x9D, 0x51, 0xA6, 0xD4, 0x0F, 0xED, 0xDB, 0x0F, 0x6C, 0x9D, 0xC4, 0x5D,
+    0x05, 0x44, 0x0D, 0x00, 0x24, 0xFA, 0x94, 0x5E, 0x85, 0xC0, 0x66, 0xFF, 0xA9, 0x59, 0x63, 0x57,
+    0xC0, 0xD2, 0x7E, 0xDC, 0x2A, 0x00, 0x88, 0x16, 0x00, 0xCD, 0x34, 0x4E, 0xE7, 0x9A, 0xDA, 0x6D,
+    0xFD, 0xED, 0xDA, 0x6B, 0xC2, 0x5F, 0x56, 0x40, 0xBA, 0x17, 0x99, 0xCC, 0x08, 0x8B, 0xE0, 0x06,
+    0x42, 0xA4, 0xF0, 0x4A, 0x8B, 0x60, 0xE9, 0x32, 0x9B, 0x1D, 0x18, 0x8E, 0x01, 0x20, 0x6A, 0x7A,
+    0xE6, 0xF4, 0x28, 0xF4, 0x26, 0xEF, 0x35, 0x3C, 0x59, 0x87, 0x1D, 0x96, 0x1A, 0xA6, 0x80, 0xB6,
+    0x70, 0x06, 0xA1, 0x24, 0x27, 0x30, 0xFA, 0x31, 0x77, 0xD5, 0x59, 0xF5, 0x1A, 0xBF, 0x76, 0xFB,
+    0xE3, 0x95, 0x14, 0x28, 0xFF, 0xC4, 0x46, 0x87, 0xFB, 0x56, 0x99, 0x32, 0x08, 0x25, 0xF8, 0x8D,
+    0x8A, 0xBB, 0x93, 0x2F, 0x52, 0x72, 0x85, 0x97, 0xCB, 0x3D, 0x49, 0xD2, 0xAF, 0xA6, 0x3D, 0x8B,
+    0x98, 0xDC, 0xBC, 0x70, 0x52, 0xC3, 0x79, 0xED, 0x7D, 0x21, 0xE1, 0xC3, 0x9C, 0x1F, 0xF3, 0xC3,
+    0xB3, 0x9C, 0x3C, 0xAC, 0xE9, 0x8E, 0x90, 0xBB, 0x8E, 0x4B, 0x1B, 0x76, 0xB3, 0xEC, 0x34, 0x0F,
+    0xB9, 0x35, 0xA0, 0x80, 0xD5, 0xB4, 0xDF, 0xEF, 0x8F, 0x68, 0x16, 0x0E, 0xEB, 0xDD, 0x19, 0xB8,
+    0xFF, 0x62, 0xEF, 0x25, 0xBE, 0x9B, 0x9E, 0x80, 0x4D, 0x05, 0xA8, 0x19, 0xD2, 0x0F, 0x3B, 0x0D,
+    0x2F, 0x30, 0xA6, 0x0C, 0x67, 0xAD, 0x9D, 0xED, 0xBC, 0xB5, 0x93, 0x5D, 0x6E, 0x7F, 0xDC, 0x7B,
+    0xAD, 0xE9, 0xFC, 0x3B, 0xFC, 0xA6, 0x61, 0xB0, 0x96, 0x85, 0x5B, 0x67, 0x10, 0xFC, 0x05, 0xC9,
+    0x3D, 0x5B, 0x32, 0x59, 0xB4, 0xEA, 0x65, 0x9E, 0xC6, 0x31, 0x87, 0x5A, 0x5B, 0xB4, 0x92, 0x44,
+    0x7B, 0xEB, 0x35, 0x5E, 0xEB, 0xD7, 0x87, 0x9A, 0xE0, 0x26, 0xE6, 0xB9, 0x63, 0x2A, 0x7A, 0xBE,
+    0x70, 0x03, 0x9E, 0xED, 0x02, 0x3B, 0xC6, 0xC2, 0x4C, 0x17, 0x4B, 0x77, 0x17, 0xAD, 0x94, 0x3A,
+    0x3D, 0x56, 0x28, 0x6C, 0xA2, 0x65, 0x77, 0xEB, 0x68, 0xFF, 0x80, 0xD6, 0xD1, 0x5D, 0xB6, 0x6B,
+    0x46, 0xA7, 0x48, 0xFC, 0xDE, 0x64, 0xFC, 0xAB, 0x50, 0xEE, 0xAC, 0xE5, 0x2C, 0x7E, 0x4B, 0x0F,
+    0x9F, 0x7F, 0xE7, 0xE8, 0xA7, 0xCF, 0x91, 0x4C, 0x9D, 0xBB, 0xBB, 0xDA, 0x3F, 0x17, 0xE8, 0xC1,
+    0x4E, 0x48, 0xAA, 0x9C, 0x29, 0xF3, 0xE5, 0xAD, 0xD5, 0x07, 0xD3, 0xF3, 0x22, 0xE2, 0x4D, 0xDB,
+    0x79, 0x56, 0x4C, 0x6D, 0xA4, 0x7C, 0xC5, 0x92, 0x6E, 0x67, 0xC0, 0x51, 0xDE, 0xDD, 0x12, 0x5B,
+    0x7C, 0x86, 0xE3, 0x10, 0x90, 0x27, 0x69, 0xC9, 0x65, 0x81, 0xB0, 0x4E, 0x6B, 0x39, 0x6A, 0x51,
+    0x06, 0x08, 0x26, 0x7C, 0x20, 0x3E, 0xBC, 0x32, 0xBF, 0xD1, 0x09, 0x4D, 0xAE, 0xB4, 0x0F, 0x54,
+    0x0E, 0x0C, 0xA3, 0x27, 0x8D, 0x00, 0xF3, 0x3A, 0x84, 0xB3, 0xB6, 0xA6, 0xE6, 0xBC, 0x39, 0xB6,
+    0x50, 0xC7, 0x58, 0x11, 0x79, 0x8D, 0x18, 0x8B, 0xBC, 0x3F, 0x48, 0xF6, 0x83, 0x0E, 0x94, 0x45,
+    0xA6, 0x74, 0x21, 0x23, 0xBB, 0x27, 0xE8, 0xC6, 0x9A, 0x07, 0x42, 0xCD, 0xC9, 0x51, 0xEB, 0x24,
+    0xCE, 0xE4, 0xF0, 0x02, 0xCB, 0xA6, 0xEC, 0xC9, 0x60, 0x23, 0x3F, 0x10, 0x10, 0x09, 0x0F, 0xEA,
+    0x9C, 0xF7, 0xF0, 0x1A, 0x43, 0x56, 0x79, 0xDD, 0x90, 0x0A, 0x16, 0x19, 0x6C, 0x77, 0x93, 0x64,
+    0x71, 0x3D, 0xFB, 0x16, 0xDC, 0xDE, 0x92, 0xBC, 0xCA, 0x95, 0x76, 0x90, 0xEA, 0x7B, 0x23, 0x41,
+    0xA4, 0x5F, 0xB3, 0x8B, 0x9F, 0x41, 0x54, 0xA1, 0x58, 0x6D, 0x8D, 0x7B, 0x3A, 0xE5, 0x32, 0x64,
+    0xF3, 0x55, 0x54, 0x86, 0x3B, 0xDA, 0x77, 0x6C, 0xD3, 0x97, 0xC8, 0xCD, 0x2C, 0x7C, 0x5B, 0x40,
+    0xD9, 0x63, 0x43, 0x80, 0x4F, 0x6D, 0x66, 0x48, 0x59, 0x20, 0x88, 0x67, 0x36, 0xBB, 0x67, 0x0C,
+    0x1B, 0x95, 0x3D, 0xED, 0x62, 0xF8, 0x9E, 0xA4, 0x9D, 0x6C, 0x34, 0x38, 0xBD, 0xC5, 0xD7, 0xB7,
+    0x28, 0xBF, 0x88, 0x9A, 0xA9, 0xE8, 0xE6, 0x10, 0xF3, 0x46, 0x7F, 0x82, 0x08, 0x0F, 0xBE, 0x5B,
+    0x1A, 0x02, 0xF0, 0x06, 0xF3, 0xE1, 0x8F, 0x30, 0x79, 0x44, 0xC9, 0x3B, 0xFB, 0x8B, 0x2C, 0x65,
+    0xB6, 0x1F, 0xED, 0xD1, 0x75, 0xE7, 0x12, 0x89, 0xC4, 0x16, 0x24, 0x3A, 0xA9, 0xD4, 0x1F, 0x58,
+    0x5E, 0xFA, 0xBC, 0x4D, 0x09, 0xFF, 0x2E, 0x26, 0xFC, 0xAF, 0xD4, 0xDE, 0x75, 0x66, 0xB6, 0xC2,
+    0x66, 0xCC, 0xD0, 0x09, 0x00, 0xE6, 0xB5, 0x00, 0xDA, 0x0E, 0x30, 0x1A, 0x96, 0x04, 0x64, 0x89,
+    0xA0, 0xA2, 0xC0, 0xD5, 0x6C, 0x64, 0xDE, 0x66, 0x6A, 0x40, 0x00, 0x06, 0x87, 0xF0, 0x36, 0x43,
+    0x9A, 0x2B, 0x04, 0x32, 0xBF, 0xEA, 0xC7, 0x3E, 0x59, 0xC0, 0x31, 0xC1, 0xD3, 0x94, 0x25, 0x32,
+    0x2B, 0x89, 0x17, 0x5B, 0xD9, 0xC6, 0x7D, 0x13, 0xDE, 0x8C, 0x7B, 0xA6, 0x1C, 0x26, 0xB3, 0xBB,
+    0xB0, 0x61, 0x27, 0x90, 0xDF, 0xD8, 0x64, 0x36, 0x1B, 0xF4, 0x98, 0xCC, 0x0E, 0x59, 0x57, 0x99,
+    0x92, 0xD9, 0xE7, 0x98, 0xCC, 0x06, 0x66, 0x4C, 0xB0, 0x06, 0xB6, 0x08, 0x4B, 0xA1, 0x2A, 0x1C,
+    0x6D, 0xB2, 0xF4, 0x5B, 0x12, 0xCF, 0x60, 0x4B, 0xCD, 0x1E, 0xF6, 0x0D, 0x7D, 0x9B, 0xF8, 0x45,
+    0xB3, 0xED, 0x48, 0xD7, 0x8B, 0x6B, 0xD8, 0x9A, 0xAF, 0x81, 0x5B, 0x70, 0x8B, 0x6B, 0xB8, 0xC5,
+    0x35, 0x5C, 0x21, 0x2E, 0xBB, 0xC4, 0x35, 0x9C, 0x67, 0xFC, 0x71, 0xC1, 0xB6, 0xF9, 0x96, 0xB6,
+    0x11, 0xD4, 0x3D, 0xB5, 0x74, 0xCA, 0xDB, 0x3C, 0x5C, 0xFB, 0xB7, 0x4D, 0x11, 0xDC, 0x02, 0xC2,
+    0xBF, 0xDD, 0xAB, 0xF0, 0x7A, 0x63, 0xD3, 0xED, 0x90, 0xA9, 0xF8, 0x32, 0xA3, 0x48, 0x68, 0xFB,
+    0x19, 0x04, 0x1B, 0x29, 0x7C, 0xD4, 0x9F, 0xDB, 0x10, 0x87, 0x4D, 0x77, 0x6C, 0x69, 0x62, 0xB2,
+    0xF1, 0x7D, 0x5C, 0x62, 0x2E, 0xD0, 0x43, 0x5C, 0x26, 0x45, 0x7A, 0x27, 0x45, 0xED, 0xC4, 0xD5,
+    0x39, 0x45, 0x1F, 0x0D, 0x33, 0xAE, 0xE6, 0xC2, 0x55, 0x69, 0x20, 0x2E, 0x6D, 0xF7, 0xF1, 0xDC,
+    0xEF, 0xF4, 0xE2, 0x7B, 0x96, 0x86, 0xA3, 0xEC, 0x90, 0xFF, 0x1C, 0xBC, 0x1C, 0x46, 0x5D, 0xCF,
+    0x33, 0xE2, 0xBE, 0x22, 0x27, 0x95, 0x86, 0x99, 0xF2, 0x63, 0x83, 0x4F, 0xBE, 0x71, 0xD9, 0xBD,
+    0x74, 0xCB, 0xE3, 0xEE, 0xDE, 0x30, 0xD8, 0x14, 0xF2, 0xC8, 0x3C, 0xB6, 0x50, 0x86, 0x37, 0xA5,
+    0x71, 0xC9, 0xCC, 0x1A, 0xA5, 0xE7, 0x3D, 0xD2, 0xB1, 0x50, 0x59, 0xAB, 0xFD, 0x6B, 0xD9, 0xC1,
+    0x2C, 0x66, 0x8B, 0x9B, 0x36, 0x27, 0x78, 0xE6, 0xE7, 0x55, 0xCC, 0x90, 0xF2, 0xA0, 0x50, 0x4E,
+    0xE4, 0x6A, 0x6C, 0x5D, 0x97, 0xD9, 0x54, 0x43, 0x0D, 0xC2, 0x04, 0x23, 0x63, 0x98, 0x56, 0x93,
+    0x86, 0xF7, 0xC6, 0x97, 0x76, 0xB7, 0x90, 0x9D, 0xC9, 0xD8, 0x8D, 0x59, 0x67, 0xB2, 0x64, 0x79,
+    0xA4, 0x91, 0xDF, 0xB6, 0x27, 0xDF, 0xAF, 0x33, 0x79, 0xA1, 0x3D, 0xB9, 0x60, 0x4F, 0x38, 0xCC,
+    0x00, 0x50, 0x45, 0x60, 0x2A, 0xE6, 0xA9, 0xCB, 0xFB, 0xE4, 0x76, 0xC6, 0xB0, 0xD3, 0xCA, 0xA6,
+    0xF5, 0x7E, 0x3E, 0x9B, 0xFF, 0xD8, 0x72, 0xB2, 0x79, 0x9C, 0x7E, 0x94, 0xFE, 0xAF, 0x8C, 0xAE,
+    0x2D, 0x2F, 0xA2, 0x87, 0x5E, 0x27, 0x29, 0x23, 0xF0, 0x6E, 0x87, 0xCF, 0x93, 0xC2, 0x82, 0x3D,
+    0xD8, 0x61, 0x64, 0x11, 0x46, 0xFA, 0xAB, 0x8D, 0x2C, 0xE3, 0x03, 0x25, 0xEB, 0x98, 0x4E, 0x24,
+    0x70, 0x25, 0xF6, 0x24, 0x88, 0x5D, 0x8B, 0x5D, 0x8C, 0x5D, 0x8D, 0x5D, 0xC9, 0x38, 0xCE, 0x1A,
+    0x0A, 0xD9, 0xA8, 0xC0, 0x6E, 0x52, 0xDB, 0x6D, 0x8D, 0x49, 0x24, 0x9B, 0x7A, 0xDA, 0x5D, 0x3B,
+    0x3D, 0xE6, 0xBE, 0xB1, 0x67, 0x24, 0x9D, 0x89, 0xC3, 0x5A, 0x05, 0xEC, 0x4E, 0x0F, 0xE7, 0x2D,
+    0x71, 0xD7, 0x98, 0xA4, 0x58, 0xEC, 0x4E, 0x67, 0x43, 0x09, 0x83, 0xE1, 0x24, 0x9D, 0x3A, 0xAA,
+    0xC7, 0x83, 0x0A, 0x32, 0xC2, 0x47, 0x61, 0x87, 0x9C, 0xEE, 0xAE, 0x73, 0x56, 0xEC, 0x76, 0xA5,
+    0x46, 0x9B, 0x21, 0x09, 0x98, 0xB4, 0xAE, 0x42, 0x1E, 0xD9, 0x6A, 0xE4, 0x9C, 0x55, 0xC7, 0x73,
+    0x56, 0x5E, 0xCF, 0x92, 0x9C, 0x33, 0xC0, 0x18, 0xD7, 0x6C, 0x26, 0x0E, 0x38, 0x52, 0xB1, 0x06,
+    0x50, 0x5C, 0xD9, 0x7C, 0x83, 0xB5, 0xE9, 0x62, 0xCE, 0x12, 0x39, 0x4C, 0x63, 0xE3, 0x40, 0xE9,
+    0xDC, 0xB0, 0x21, 0xF8, 0xE8, 0xCF, 0x4E, 0xD9, 0x56, 0x7B, 0xDB, 0x6F, 0xDF, 0x04, 0x63, 0xBF,
+    0xBD, 0x54, 0xF0, 0x58, 0x95, 0xC8, 0x38, 0xC0, 0x4F, 0xC6, 0x2C, 0xE6, 0xEB, 0xF3, 0x10, 0x61,
+    0xFD, 0xCA, 0x20, 0x55, 0x3B, 0x09, 0xD6, 0x6C, 0x53, 0xCB, 0x68, 0x94, 0x78, 0xCF, 0x3D, 0x4C,
+    0xCD, 0x30, 0xDD, 0x69, 0x33, 0xC3, 0xB3, 0x42, 0xFA, 0x18, 0x92, 0x49, 0xD3, 0x3A, 0xB3, 0x65,
+    0x5C, 0xE8, 0x20, 0x99, 0x99, 0x00, 0x51, 0x49, 0xAD, 0xE1, 0x37, 0x4B, 0x16, 0x1D, 0xCE, 0x76,
+    0xA9, 0xD2, 0x27, 0x5B, 0xCD, 0xBC, 0x4C, 0x8A, 0xA1, 0x96, 0x01, 0x60, 0xF5, 0xB9, 0x1B, 0x40,
+    0xBB, 0x27, 0xA1, 0x29, 0xFA, 0x7D, 0x9B, 0x78, 0x29, 0xB8, 0x9F, 0xFD, 0x94, 0xEA, 0xF1, 0xBB,
+    0xC5, 0xEC, 0x5B, 0x25, 0xE2, 0x11, 0xD7, 0x4F, 0x62, 0x42, 0x68, 0xE5, 0x61, 0xE8, 0x4C, 0x74,
+    0xB9, 0x30, 0xF1, 0x6B, 0x78, 0x1D, 0xC6, 0xEB, 0x78, 0x96, 0x47, 0xF8, 0xFB, 0x06, 0xD1, 0xE2,
+    0x90, 0x05, 0xB2, 0x29, 0x71, 0xF6, 0x70, 0x61, 0xE3, 0xAE, 0x9E, 0xF2, 0xA0, 0xB0, 0x87, 0xC2,
+    0x58, 0xF1, 0x7E, 0xA1, 0xB2, 0xD1, 0xCA, 0x54, 0x02, 0x99, 0x42, 0xC7, 0xF8, 0x5E, 0xA1, 0x63,
+    0x9E, 0x24, 0x29, 0x0B, 0xDA, 0x25, 0x33, 0x37, 0x8D, 0x1C, 0x7E, 0xFD, 0xB1, 0xDA, 0xDB, 0x31,
+    0xEF, 0x15, 0x55, 0x0F, 0xDB, 0xAA, 0x1E, 0x4A, 0xAE, 0xB6, 0xB0, 0x67, 0x2B, 0x77, 0x55, 0x8C,
+    0xD5, 0x28, 0x15, 0xAC, 0x57, 0xAD, 0x8F, 0x0D, 0x4F, 0xDE, 0xD8, 0xF0, 0x14, 0xC1, 0xBD, 0x07,
+    0x1D, 0x01, 0x13, 0xBB, 0x75, 0x23, 0xB6, 0x3D, 0x95, 0xF6, 0x20, 0xDE, 0x3D, 0xFA, 0x57, 0xA4,
+    0x5F, 0x33, 0xAD, 0x29, 0x20, 0x69, 0x4D, 0xF8, 0x13, 0x2F, 0x24, 0x81, 0x25, 0xF3, 0x63, 0xED,
+    0x84, 0x35, 0x14, 0xD2, 0x1E, 0xC5, 0x2E, 0x6C, 0xF6, 0x32, 0xA6, 0x85, 0xF4, 0x8D, 0x9D, 0x05,
+    0x4C, 0xB9, 0x04, 0xE3, 0x7E, 0xB9, 0x96, 0x8D, 0x24, 0x27, 0xE8, 0x9D, 0x99, 0xB3, 0xBA, 0xEF,
+    0xCA, 0x2A, 0xA6, 0x11, 0x0F, 0xB2, 0x53, 0x2D, 0xE3, 0x3D, 0x53, 0x84, 0x1C, 0xBB, 0xD3, 0x88,
+    0xF1, 0x98, 0x46, 0x8C, 0xC6, 0xB4, 0x64, 0xD8, 0xEE, 0x82, 0xB5, 0xD3, 0x26, 0x8F, 0x1B, 0x2D,
+    0x1D, 0xC8, 0x7E, 0xE3, 0xB2, 0x81, 0xDA, 0xEF, 0x6C, 0x9B, 0xAD, 0xCB, 0xE4, 0x21, 0xFC, 0x60,
+    0x66, 0xCD, 0xAC, 0x12, 0xE9, 0x93, 0x4E, 0xD9, 0x74, 0xEA, 0xDE, 0xDF, 0x9B, 0x7E, 0x40, 0xB8,
+    0x3A, 0x95, 0xAF, 0x0E, 0x9A, 0xB5, 0xC5, 0x56, 0x74, 0x19, 0x96, 0x56, 0xDD, 0xD3, 0x41, 0xED,
+    0x23, 0x08, 0x08, 0x6B, 0xBF, 0x8E, 0x2A, 0x0F, 0x00, 0xCD, 0x6B, 0x60, 0x79, 0x01, 0xDB, 0xBC,
+    0xCD, 0x5E, 0xB9, 0xBF, 0xE9, 0xA4, 0xB0, 0xE0, 0x40, 0x1A, 0x1D, 0x31, 0x19, 0xD2, 0x01, 0x3C,
+    0x3F, 0x87, 0xCB, 0xAE, 0xBA, 0x85, 0x7D, 0xDE, 0xD1, 0x9F, 0x2F, 0x87, 0xA6, 0xD2, 0xB1, 0x3F,
+    0xDF, 0xBF, 0xF5, 0xC0, 0xFE, 0x7C, 0xC9, 0xF0, 0xB1, 0x39, 0x6B, 0xEC, 0xCF, 0x6F, 0xD8, 0x9F,
+    0x6F, 0xAA, 0xA8, 0x96, 0xC6, 0x1D, 0x9B, 0xA4, 0xBC, 0x3B, 0x57, 0x3F, 0xCB, 0xA6, 0xC3, 0x38,
+    0xBE, 0xE1, 0xD0, 0xC3, 0xF1, 0xF2, 0x5C, 0x7A, 0x31, 0xE0, 0x5C, 0x47, 0xF6, 0xC6, 0x8D, 0xB4,
+    0x20, 0x38, 0x86, 0xAC, 0x1B, 0x48, 0x0E, 0x78, 0x97, 0xB6, 0x79, 0xA6, 0xE7, 0x86, 0x7C, 0xB6,
+    0x77, 0x61, 0x09, 0xB9, 0x3E, 0x54, 0x43, 0xB0, 0x0F, 0xD7, 0x90, 0xEC, 0xB0, 0x82, 0x68, 0x3F,
+    0xE8, 0x04, 0xCD, 0xFC, 0x74, 0x40, 0xA3, 0x78, 0x06, 0x45, 0xF5, 0xB6, 0x49, 0x1C, 0xC6, 0xB2,
+    0x97, 0x62, 0xA4, 0x24, 0xE3, 0x98, 0x4F, 0x34, 0xF7, 0x70, 0x47, 0xF9, 0x42, 0x82, 0xF6, 0xE0,
+    0xDA, 0xCF, 0x4E, 0xE7, 0xE6, 0x66, 0x97, 0x9B, 0x5B, 0x63, 0x78, 0x36, 0x73, 0x4F, 0xB6, 0x2B,
+    0xB2, 0x8A, 0xF0, 0xD2, 0x08, 0x36, 0x73, 0x76, 0x48, 0x03, 0x15, 0x5E, 0x6C, 0xBD, 0x41, 0xFA,
+    0xBA, 0x17, 0xAA, 0xDD, 0x16, 0x40, 0x45, 0xA5, 0xDB, 0x46, 0xC5, 0x74, 0xBE, 0xC0, 0xA7, 0x73,
+    0xE4, 0xF9, 0x82, 0x3A, 0x97, 0x92, 0x2B, 0x7B, 0x38, 0x53, 0xD1, 0x5D, 0x56, 0xA2, 0xC2, 0x21,
+    0xDD, 0xA5, 0x84, 0x04, 0xF2, 0xC6, 0x32, 0xEC, 0x9E, 0x32, 0xCE, 0x6C, 0xD9, 0x41, 0x39, 0xC7,
+    0x91, 0x8E, 0x27, 0x7D, 0x0D, 0xA4, 0x9C, 0x08, 0xD3, 0x1C, 0xEA, 0x24, 0x1C, 0x48, 0xB7, 0x5B,
+    0x75, 0xE0, 0x9F, 0xA7, 0x4B, 0xA5, 0xAC, 0x95, 0x49, 0x55, 0x48, 0xEA, 0x3E, 0xE9, 0xB8, 0x72,
+    0xAB, 0xEC, 0xA0, 0xB5, 0x8B, 0xED, 0x59, 0x08, 0x06, 0x40, 0x8D, 0xD0, 0x7A, 0x08, 0xB4, 0x1E,
+    0x06, 0xAD, 0x5F, 0x01, 0xAD, 0xFF, 0x36, 0xA7, 0x35, 0x22, 0xAD, 0x2F, 0x81, 0xD6, 0x1F, 0xE2,
+    0xFA, 0x37, 0x41, 0x6B, 0x3D, 0x37, 0x3A, 0x96, 0x26, 0x3D, 0xA7, 0xEA, 0xCF, 0x8C, 0x1A, 0xFE,
+    0x02, 0x90, 0x2D, 0xB7, 0x3D, 0x02, 0x6C, 0x36, 0x09, 0xAE, 0x80, 0x26, 0x68, 0xB4, 0x73, 0x1E,
+    0x32, 0x7D, 0x68, 0x5C, 0xD2, 0x62, 0xDF, 0xFD, 0xA2, 0xFD, 0xEA, 0x73, 0x1E, 0x00, 0xEE, 0x7C,
+    0xF2, 0xBA, 0xF7, 0x7B, 0x6E, 0x2B, 0x8F, 0x17, 0xD1, 0x59, 0xDB, 0x36, 0x2B, 0xCF, 0xD2, 0xCB,
+    0xE4, 0x2B, 0xDD, 0xDE, 0xAE, 0xFE, 0x7D, 0x1B, 0xF8, 0xBD, 0xCC, 0x6A, 0xBB, 0xC4, 0x08, 0x2C,
+    0xB8, 0xB3, 0xDE, 0x6E, 0x4F, 0x61, 0x86, 0xE5, 0x7D, 0xFA, 0x1B, 0x84, 0xFA, 0xF1, 0xDF, 0x12,
+    0xE5, 0x3E, 0x36, 0x8D, 0x8D, 0xB1, 0x3C, 0xF3, 0x6C, 0xBF, 0xD7, 0xEF, 0xA0, 0xF4, 0x87, 0x41,
+    0x8A, 0x8E, 0x2A, 0xBF, 0xD3, 0xE6, 0x13, 0xD3, 0xB2, 0x40, 0x44, 0xE8, 0x42, 0x28, 0xF6, 0x41,
+    0x32, 0x69, 0xC7, 0x4C, 0xDA, 0xE2, 0xDA, 0x4D, 0x08, 0x0D, 0x32, 0x39, 0x41, 0x60, 0xBB, 0x1C,
+    0x77, 0x55, 0x88, 0x86, 0x6F, 0xE8, 0x32, 0x7F, 0x3B, 0x4D, 0xCC, 0xDB, 0xB9, 0x3B, 0x80, 0xD7,
+    0x98, 0xD7, 0x54, 0x4B, 0xE6, 0x94, 0xF5, 0xA7, 0x46, 0x3D, 0xA9, 0xCC, 0x27, 0xB6, 0xC9, 0x2C,
+    0x34, 0x2B, 0x0B, 0x8E, 0xF4, 0xF1, 0xD1, 0x77, 0x2F, 0x15, 0x99, 0xFB, 0xF0, 0x2F, 0x48, 0xB8,
+    0xB7, 0x5B, 0xDF, 0xE9, 0x0B, 0x07, 0xF9, 0xBF, 0xDD, 0xD1, 0x7D, 0x6B, 0x5B, 0xA2, 0x16, 0x0E,
+    0xE9, 0xDB, 0x44, 0x4E, 0xC4, 0xB3, 0x27, 0x49, 0x2E, 0xEE, 0xF3, 0xA8, 0x23, 0x4E, 0xB4, 0x0B,
+    0xC4, 0x9B, 0xAC, 0x2F, 0x5B, 0x17, 0x62, 0x55, 0x79, 0xE9, 0xD4, 0x42, 0x96, 0xF0, 0xB7, 0x7B,
+    0x88, 0xD4, 0x49, 0x24, 0x0D, 0xE9, 0x57, 0x5A, 0xD0, 0xD8, 0xA6, 0xED, 0x4C, 0x1C, 0xAB, 0x2D,
+    0xCB, 0xF3, 0xBD, 0xFC, 0xD2, 0xDA, 0xEC, 0x3F, 0x7B, 0x48, 0x2A, 0xA7, 0x36, 0x6D, 0x7B, 0x01,
+    0x8B, 0xE3, 0xCB, 0xAC, 0xB4, 0xFB, 0x33, 0xD8, 0x2F, 0x87, 0x7E, 0xDD, 0xC5, 0x78, 0x61, 0x84,
+    0x99, 0x12, 0xF9, 0x6A, 0x69, 0x04, 0x28, 0x2C, 0xC0, 0x53, 0xB3, 0x9A, 0xE8, 0xBD, 0xE2, 0xD2,
+    0x70, 0x16, 0x4B, 0xF5, 0x82, 0x9C, 0xE2, 0x0F, 0xCC, 0xA8, 0x90, 0x31, 0x93, 0x94, 0x45, 0xBA,
+    0x70, 0x8E, 0xCF, 0x71, 0x98, 0x87, 0x19, 0x24, 0x66, 0x9A, 0x1D, 0x6E, 0x90, 0x73, 0x34, 0xD2,
+    0x76, 0xE0, 0x4A, 0xEF, 0x41, 0x0F, 0x38, 0xEE, 0xB1, 0xFF, 0xCC, 0x67, 0x11, 0x80, 0x5B, 0xCD,
+    0x92, 0x76, 0xC1, 0xD3, 0x3F, 0x12, 0x4A, 0x8D, 0xC7, 0x54, 0x08, 0x59, 0x6D, 0x57, 0xF9, 0xC0,
+    0x03, 0x52, 0xBD, 0x33, 0x1C, 0xCD, 0x5B, 0x98, 0x5C, 0x3E, 0x18, 0xA1, 0x61, 0xCA, 0xE7, 0x3E,
+    0x29, 0x50, 0x67, 0xAE, 0xBE, 0x77, 0xA6, 0xD3, 0x2D, 0x74, 0xFE, 0xF1, 0x47, 0x3C, 0xE2, 0xC2,
+    0xAE, 0x08, 0xB6, 0x1A, 0x28, 0xC3, 0xB3, 0x7E, 0x2C, 0x92, 0xBB, 0x9D, 0xCF, 0xDE, 0x0A, 0x22,
+    0x6A, 0x0A, 0x48, 0x5E, 0x87, 0x5B, 0x09, 0x2B, 0x44, 0x3C, 0x9F, 0x29, 0xE2, 0xDA, 0x4F, 0x79,
+    0x0E, 0x6F, 0x9E, 0x79, 0xAD, 0xEE, 0x0A, 0xCF, 0x98, 0x4C, 0xA2, 0xEF, 0x9B, 0x9D, 0xBF, 0xBC,
+    0x4F, 0x78, 0xB6, 0x78, 0xFE, 0x72, 0x1E, 0x9E, 0x8D, 0x07, 0x47, 0xC5, 0x4C, 0x8E, 0x3E, 0x84,
+    0xF0, 0x85, 0x39, 0x7F, 0x1E, 0xC7, 0x92, 0x67, 0x91, 0xCC, 0x8F, 0xAF, 0x2C, 0xC6, 0x68, 0xED,
+    0x67, 0x88, 0xD1, 0xB2, 0xA9, 0x2D, 0x6C, 0xB2, 0xBF, 0x8E, 0xDF, 0x8B, 0x81, 0xF0, 0x64, 0x53,
+    0x66, 0x8F, 0xEF, 0x78, 0x34, 0xF1, 0xE6, 0x9D, 0x23, 0xB3, 0x78, 0xB3, 0x64, 0xBC, 0x39, 0xF3,
+    0xE8, 0xF9, 0x64, 0xA4, 0x24, 0x2B, 0x32, 0x45, 0x02, 0x9F, 0x33, 0xDE, 0x1C, 0xE6, 0xF1, 0xA6,
+    0x37, 0xB9, 0xDD, 0x29, 0x3B, 0x99, 0x7D, 0xAA, 0x5B, 0xCF, 0x1E, 0xE0, 0xD6, 0xD9, 0x4A, 0xCD,
+    0x88, 0xCB, 0xF4, 0x77, 0xC3, 0xF4, 0x76, 0x2A, 0x82, 0x7D, 0x76, 0xB7, 0xEE, 0xCA, 0x61, 0xCD,
+    0x5A, 0xE0, 0xDC, 0x6E, 0xA3, 0x2A, 0xE0, 0x3A, 0x2F, 0xA9, 0x86, 0xEC, 0x46, 0xB1, 0x67, 0x9D,
+    0x2B, 0x87, 0x7D, 0xDE, 0x3C, 0xEE, 0xCC, 0x23, 0xE0, 0xDB, 0x55, 0x20, 0xA7, 0x9C, 0x79, 0xD6,
+    0xF9, 0x56, 0x1D, 0xA7, 0x3C, 0xE5, 0xAC, 0x75, 0x12, 0xDC, 0xAA, 0xDF, 0x5E, 0x3C, 0xE5, 0xBC,
+    0xAE, 0xC2, 0x73, 0xB7, 0xAB, 0x41, 0x45, 0x67, 0x4D, 0xD1, 0xCB, 0x29, 0xE7, 0xFE, 0x88, 0x3E,
+    0x61, 0x20, 0x2A, 0xFA, 0xD9, 0x01, 0xB7, 0xD7, 0x3C, 0x50, 0x5E, 0xCD, 0xA1, 0xBC, 0xCD, 0x24,
+    0x2F, 0x34, 0x9E, 0x7B, 0xF3, 0x18, 0x33, 0xD9, 0x77, 0x9A, 0x90, 0x33, 0xA6, 0x5C, 0x64, 0x5A,
+    0xC6, 0x9C, 0xED, 0x73, 0x19, 0xE4, 0x2E, 0xD8, 0x38, 0xBB, 0x0D, 0x1B, 0x70, 0xF9, 0xDC, 0x6D,
+    0x8C, 0x17, 0x2F, 0xFC, 0xB2, 0x52, 0xD1, 0xC5, 0x8B, 0x17, 0x01, 0xD5, 0x2F, 0x6E, 0x1C, 0xC6,
+    0xF8, 0x13, 0x83, 0xE9, 0xF5, 0xA1, 0x3E, 0xFE, 0x44, 0xE9, 0xA0, 0x05, 0xB0, 0x4C, 0x83, 0x5A,
+    0xBA, 0xC6, 0xC6, 0x0C, 0xA1, 0x4D, 0x09, 0x8E, 0xAD, 0x26, 0xE5, 0x14, 0x53, 0x7C, 0x41, 0xDF,
+    0xF2, 0x14, 0x5D, 0xCB, 0x3B, 0xEC, 0xE5, 0x4C, 0x97, 0xE5, 0x99, 0x04, 0xC9, 0xA2, 0x4B, 0xD9,
+    0xFD, 0x48, 0x8A, 0x76, 0x7A, 0x24, 0xC5, 0xE6, 0x8E, 0x47, 0x52, 0xC4, 0x45, 0xF7, 0x19, 0x1F,
+    0x49, 0x91, 0x8F, 0x8F, 0xA4, 0xE0, 0x6D, 0xE9, 0xCE, 0xD6, 0xB9, 0x54, 0xA6, 0x29, 0x46, 0xA1,
+    0x78, 0xF9, 0x3B, 0x2B, 0x9E, 0xB9, 0x2C, 0xCF, 0x4F, 0x89, 0x1A, 0xDA, 0x46, 0x56, 0xD5, 0xD9,
+    0x93, 0x30, 0x1D, 0x62, 0x1B, 0x44, 0x4E, 0xCC, 0xF8, 0xC8, 0x1C, 0x3D, 0x60, 0x31, 0x9B, 0x93,
+    0xC5, 0xFD, 0x6A, 0x40, 0x87, 0xCF, 0xBD, 0xD1, 0x2C, 0x3F, 0x3D, 0xB5, 0xF7, 0xB1, 0x2F, 0xE3,
+    0xE9, 0xFD, 0x70, 0xC7, 0xE0, 0xF3, 0xBA, 0x9E, 0xDF, 0xEE, 0xA1, 0x96, 0xE0, 0x58, 0x87, 0xEC,
+    0xD9, 0x37, 0xDB, 0xF2, 0xA6, 0xA2, 0xEB, 0x9B, 0x2C, 0x26, 0xEB, 0x0B, 0xB2, 0xE5, 0x2C, 0x41,
+    0xD3, 0x32, 0x8B, 0x61, 0xF3, 0xBA, 0x48, 0x7C, 0x57, 0x13, 0xCB, 0x33, 0x07, 0x6A, 0x79, 0xD3,
+    0xD7, 0xD2, 0x0F, 0x8E, 0x28, 0xDB, 0xBF, 0x26, 0xBE, 0x3D, 0x99, 0xFB, 0xF6, 0x56, 0xAC, 0x56,
+    0x68, 0xAB, 0x06, 0xCC, 0x75, 0xB2, 0xC2, 0x50, 0x38, 0x92, 0x29, 0x49, 0xBF, 0xF3, 0x02, 0x5B,
+    0xD4, 0x2F, 0x4B, 0x42, 0x50, 0x5A, 0x1B, 0x6B, 0x63, 0xDB, 0x5E, 0x6C, 0x84, 0xF9, 0x8C, 0x9C,
+    0xBD, 0xE5, 0xA9, 0x00, 0x69, 0xC4, 0x82, 0xCA, 0xFE, 0x4C, 0xC9, 0x5A, 0xE8, 0x01, 0x88, 0x7F,
+    0x60, 0x0E, 0x88, 0x80, 0x06, 0xE9, 0x27, 0xDB, 0xBC, 0x3D, 0x6F, 0xE0, 0xE4, 0x63, 0x5C, 0xF8,
+    0x14, 0x97, 0xF0, 0xC3, 0x46, 0x7A, 0xDD, 0xA7, 0x47, 0xB8, 0xD8, 0x27, 0x93, 0xDC, 0xBB, 0x9C,
+    0xB3, 0xE3, 0xE9, 0x19, 0xC7, 0xEE, 0x8E, 0x59, 0x47, 0x94, 0x2D, 0x6D, 0xDD, 0x14, 0xA7, 0x77,
+    0x66, 0xE2, 0x94, 0xCC, 0xC4, 0x29, 0xBE, 0x8A, 0x85, 0xF7, 0x32, 0x47, 0x54, 0xC9, 0xB9, 0x2E,
+    0x25, 0xAB, 0xC0, 0xDF, 0xA4, 0x8B, 0xE5, 0x67, 0xD6, 0x88, 0xE7, 0xA0, 0x3D, 0xFD, 0xA4, 0x91,
+    0xE3, 0x03, 0xC1, 0xE2, 0xD9, 0xC4, 0x65, 0x39, 0xD6, 0x5B, 0xC9, 0x09, 0x56, 0xC1, 0x15, 0x2C,
+    0xF0, 0x4C, 0x7D, 0xFF, 0xBF, 0x47, 0x2D, 0x62, 0x57, 0x5F, 0x1F, 0x9A, 0xEB, 0xBD, 0xAE, 0xD8,
+    0x7E, 0x0A, 0x7D, 0xCD, 0x22, 0xB6, 0xAF, 0x94, 0x7C, 0x2A, 0x49, 0x24, 0xC2, 0x33, 0x1D, 0x3D,
+    0x80, 0xE9, 0xC2, 0x7D, 0xB9, 0xA6, 0x25, 0xE9, 0x97, 0xB1, 0x51, 0xB7, 0xC3, 0x0E, 0x06, 0x7C,
+    0x57, 0x5F, 0xB3, 0xE7, 0x73, 0x24, 0x86, 0xFF, 0xD7, 0x4E, 0x70, 0xE4, 0xEC, 0x7C, 0xA6, 0x5B,
+    0xBE, 0xA5, 0xBC, 0x9B, 0xB0, 0x1F, 0x78, 0x49, 0x35, 0xFA, 0x11, 0xD3, 0xF6, 0x34, 0x34, 0x27,
+    0x1D, 0x8F, 0x59, 0x4C, 0x72, 0xFC, 0x30, 0xF4, 0x62, 0x46, 0x7B, 0x58, 0x23, 0xB7, 0x0F, 0x6A,
+    0x59, 0x17, 0x44, 0xB8, 0xA0, 0x91, 0xBF, 0x7D, 0xAC, 0xBA, 0xFA, 0xEF, 0xD6, 0x96, 0x5A, 0x93,
+    0x5A, 0x5B, 0x07, 0x7A, 0xE4, 0xC8, 0x6F, 0x01, 0xA4, 0x06, 0xCF, 0x66, 0x2A, 0xBA, 0x00, 0x27,
+    0x70, 0xA1, 0x54, 0x7B, 0x2D, 0xD2, 0x7F, 0xA4, 0x0F, 0x63, 0xF9, 0xFA, 0x57, 0xED, 0x06, 0xF4,
+    0x34, 0x52, 0x4F, 0x4D, 0xA5, 0x1E, 0xC9, 0xF9, 0x07, 0xEC, 0xD9, 0x99, 0xE2, 0xC8, 0xEF, 0xDA,
+    0x73, 0x32, 0x14, 0x0A, 0x96, 0x7C, 0xA6, 0x9C, 0xDA, 0x3A, 0xFC, 0x56, 0x2E, 0x75, 0xCC, 0x11,
+    0xDB, 0xD8, 0x5C, 0x4C, 0x27, 0x82, 0x77, 0x2C, 0xAD, 0x24, 0x27, 0x48, 0xD9, 0x23, 0x18, 0x66,
+    0x2A, 0x88, 0xC7, 0xDB, 0xE4, 0xCB, 0xCC, 0x11, 0xC6, 0xB3, 0x87, 0xF7, 0x7C, 0x0D, 0x00, 0x4C,
+    0x6F, 0xD8, 0x7A, 0x75, 0x3C, 0xD1, 0xF6, 0xE2, 0xDA, 0xE9, 0xD9, 0x5C, 0x92, 0x32, 0x63, 0x7A,
+    0x78, 0xB0, 0xE8, 0x9A, 0x97, 0xE9, 0xAB, 0x16, 0x4B, 0x1C, 0x9C, 0xE6, 0xD3, 0xC5, 0xE2, 0xB3,
+    0x2E, 0xBE, 0xE5, 0x9A, 0xF1, 0xDC, 0x0F, 0xB0, 0xC2, 0x44, 0x9F, 0x92, 0x43, 0x1F, 0xE4, 0x8E,
+    0x24, 0x15, 0x1E, 0xF3, 0x83, 0x61, 0x0E, 0xAE, 0xD9, 0x47, 0x5A, 0xE4, 0xE6, 0x0B, 0x74, 0x06,
+    0x00, 0x17, 0xC2, 0x0F, 0x45, 0xD3, 0x51, 0x08, 0xF5, 0xD6, 0xD7, 0xE9, 0xE4, 0x79, 0x50, 0xA3,
+    0x63, 0x43, 0xD7, 0x91, 0xA7, 0x1E, 0x3B, 0xF9, 0xD4, 0xD3, 0x54, 0x3C, 0xD8, 0x4C, 0xF3, 0x1F,
+    0x6A, 0x09, 0x4E, 0xF5, 0xD6, 0xE8, 0x57, 0xBD, 0x1B, 0x92, 0x88, 0x3F, 0xF2, 0x80, 0x06, 0x54,
+    0x3A, 0x23, 0xB6, 0x27, 0x26, 0xEC, 0x4D, 0x4C, 0xA6, 0x27, 0xDB, 0xA4, 0xF2, 0xF0, 0x96, 0x64,
+    0x7A, 0x78, 0x8B, 0xF9, 0x4C, 0x0F, 0x6F, 0xA1, 0x90, 0xF7, 0x3B, 0x85, 0x7C, 0x47, 0x53, 0x6A,
+    0x6D, 0x4F, 0xDF, 0xD8, 0x73, 0xBD, 0x62, 0xB7, 0x92, 0xE9, 0x54, 0xBC, 0x34, 0xA5, 0x9A, 0x9D,
+    0x4D, 0xA9, 0xFF, 0xDF, 0x9B, 0x66, 0x95, 0xFB, 0xDE, 0x2A, 0x2C, 0xC7, 0x15, 0xA2, 0xF6, 0x2B,
+    0x2C, 0xD8, 0x3C, 0x90, 0xCF, 0x8F, 0x90, 0xE6, 0x97, 0x9E, 0x56, 0x0A, 0x42, 0xA6, 0xBA, 0x97,
+    0xE7, 0xE2, 0xF9, 0x30, 0xEB, 0xD8, 0xE7, 0x03, 0xA8, 0x1E, 0x06, 0x59, 0x80, 0xF1, 0x7B, 0xF7,
+    0x3E, 0xFA, 0xE7, 0x49, 0xBC, 0xF5, 0x75, 0xB7, 0xEB, 0xDD, 0xB6, 0xB3, 0xC4, 0x7E, 0xAE, 0x33,
+    0x95, 0x6A, 0x89, 0xCD, 0x84, 0xA1, 0x54, 0x79, 0x27, 0x7B, 0xF5, 0xB8, 0x1F, 0x75, 0xB3, 0x78,
+    0xCB, 0x72, 0x76, 0x0E, 0x65, 0x8D, 0x4F, 0x38, 0x81, 0xA5, 0xEE, 0xD8, 0xD7, 0xDF, 0xD1, 0x36,
+    0xF6, 0x72, 0xB7, 0x50, 0x0E, 0x35, 0x14, 0x16, 0x83, 0xC2, 0x50, 0x13, 0x7D, 0x72, 0xC2, 0x54,
+    0x0E, 0x9A, 0x34, 0xD3, 0x11, 0x28, 0xB9, 0xE5, 0x2C, 0x6A, 0x64, 0x73, 0x9D, 0x9C, 0x57, 0xB4,
+    0xF7, 0xB5, 0xA7, 0xBA, 0xDC, 0x57, 0x18, 0x4D, 0x51, 0x92, 0xD8, 0x06, 0xAD, 0x9C, 0x67, 0x92,
+    0x2F, 0x69, 0xBD, 0x72, 0x5F, 0xDE, 0x32, 0x3C, 0xB7, 0x78, 0xDF, 0x2F, 0x65, 0xD1, 0x23, 0xCE,
+    0xC1, 0x5C, 0x0E, 0x45, 0xDA, 0x63, 0x0C, 0x10, 0x9C, 0xF8, 0x92, 0x76, 0x7A, 0x4C, 0xE7, 0x48,
+    0x79, 0x9C, 0x8D, 0x18, 0x15, 0xEB, 0x32, 0xCF, 0x7E, 0x99, 0x7B, 0xCE, 0x70, 0x49, 0x1F, 0x2F,
+    0x24, 0x58, 0xDA, 0x63, 0x55, 0xEF, 0x91, 0x3D, 0x2A, 0x88, 0x66, 0xA2, 0x4F, 0xAD, 0xA9, 0x78,
+    0xD2, 0x9A, 0x89, 0x2F, 0x7A, 0x20, 0xFD, 0xA1, 0x1E, 0x17, 0x38, 0x1E, 0x01, 0xD7, 0x0B, 0xE5,
+    0xBE, 0xC5, 0x20, 0xE3, 0x81, 0xFD, 0x4D, 0xD5, 0x3D, 0xFA, 0xB5, 0x7A, 0xBB, 0xCB, 0x64, 0xB6,
+    0xD0, 0xB1, 0xEB, 0xF8, 0x1F, 0xC6, 0x13, 0xF2, 0xD4, 0xD2, 0xF3, 0x92, 0x7A, 0x3A, 0x4F, 0x59,
+    0x72, 0x9C, 0x64, 0xE1, 0x68, 0xE7, 0x97, 0xF6, 0x80, 0x1F, 0xF5, 0xB7, 0x5F, 0x55, 0xD6, 0x1D,
+    0xAA, 0x8E, 0xC3, 0xE4, 0x14, 0x1F, 0xE1, 0xE9, 0xF6, 0x2F, 0xDC, 0xFD, 0xB6, 0x95, 0x8C, 0x8F,
+    0x84, 0x5D, 0x38, 0xA0, 0xBF, 0xEB, 0xF8, 0xAE, 0x9E, 0x62, 0xC7, 0xCF, 0xD3, 0x19, 0x27, 0x87,
+    0x99, 0x6C, 0xB1, 0x77, 0x56, 0xB4, 0x36, 0xF6, 0xF1, 0x0B, 0xD2, 0x9A, 0x3D, 0x45, 0x76, 0x8F,
+    0xAA, 0x70, 0x38, 0xAC, 0xB2, 0x70, 0x58, 0xDF, 0xA7, 0x70, 0x98, 0xCA, 0x75, 0x20, 0x21, 0xB4,
+    0x45, 0xFF, 0x09, 0x9D, 0xF2, 0x29, 0x11, 0x39, 0x35, 0x52, 0xB3, 0x97, 0x45, 0x5F, 0x9C, 0xFA,
+    0x06, 0x42, 0xB2, 0x21, 0x98, 0x3D, 0x25, 0x22, 0x16, 0xAD, 0x66, 0x57, 0x0B, 0x3B, 0xE1, 0x11,
+    0xC0, 0x19, 0x3E, 0x25, 0x62, 0xA0, 0x6F, 0x9E, 0x65, 0x51, 0xE7, 0xC9, 0x3F, 0x49, 0x67, 0x4A,
+    0x1A, 0x77, 0x86, 0x60, 0xE6, 0xAB, 0x8C, 0x76, 0xAD, 0xF2, 0xE6, 0xB4, 0xCA, 0x9F, 0x9B, 0xAD,
+    0x44, 0x12, 0x04, 0x8E, 0x64, 0x09, 0xCE, 0x98, 0x4F, 0x76, 0x3C, 0xBE, 0x2C, 0xD8, 0xF5, 0xF8,
+    0x32, 0x49, 0x63, 0x0E, 0x0F, 0x58, 0xC2, 0x71, 0xF6, 0xA1, 0xD2, 0x35, 0x4B, 0x76, 0x1A, 0x51,
+    0xCC, 0xCA, 0x6C, 0x09, 0x72, 0x3C, 0x73, 0x7A, 0xD0, 0x05, 0x9F, 0xB3, 0xF5, 0x7F, 0xC5, 0x9A,
+    0xBF, 0x8F, 0xDC, 0x54, 0x10, 0xC7, 0xC7, 0x36, 0x77, 0x16, 0xD9, 0xC2, 0x81, 0x04, 0x21, 0x40,
+    0xC1, 0x0D, 0x0D, 0x12, 0xC4, 0xFF, 0xC0, 0x71, 0x36, 0x20, 0xD1, 0x26, 0x12, 0xA2, 0x42, 0x22,
+    0x14, 0x14, 0x88, 0x82, 0x6B, 0x28, 0x68, 0xEE, 0x6C, 0x89, 0x82, 0x82, 0xE6, 0x24, 0x84, 0x68,
+    0x53, 0x04, 0x09, 0xA5, 0x8A, 0x10, 0x05, 0x48, 0xB7, 0x67, 0xF3, 0x43, 0x4A, 0x41, 0xB3, 0x22,
+    0x7F, 0x00, 0x8E, 0x14, 0x51, 0xD0, 0xC4, 0x41, 0x0E, 0x32, 0xC2, 0xBB, 0x8F, 0xEF, 0x77, 0x9E,
+    0xBD, 0xB7, 0x17, 0x7E, 0x08, 0xB1, 0xDE, 0xDD, 0xBD, 0xF3, 0x3B, 0xAD, 0x7F, 0xBC, 0x37, 0x9F,
+    0x99, 0x79, 0x33, 0xF3, 0x9E, 0x4F, 0x24, 0xAC, 0x45, 0x24, 0x6E, 0xD0, 0xA4, 0x6C, 0x66, 0x68,
+    0x9C, 0x69, 0x2B, 0xE2, 0xDD, 0x47, 0xE3, 0x57, 0x68, 0x82, 0x12, 0x4D, 0x54, 0xA0, 0x89, 0xB3,
+    0xA9, 0x48, 0xFE, 0x09, 0x1A, 0x63, 0x66, 0xE2, 0xB2, 0xF1, 0x8C, 0x31, 0x32, 0xAA, 0x24, 0xC7,
+    0x6D, 0x68, 0xA2, 0x02, 0x4D, 0x9C, 0x49, 0x2A, 0xF6, 0xE3, 0x24, 0xC2, 0x0E, 0xD0, 0x84, 0x6C,
+    0x82, 0x09, 0xCF, 0xF1, 0xC2, 0xC1, 0x2B, 0x87, 0x9E, 0xF9, 0xA9, 0x08, 0x8C, 0x29, 0xC2, 0xDA,
+    0x14, 0x71, 0x91, 0x66, 0xF8, 0x49, 0xF2, 0x24, 0x15, 0x83, 0x2E, 0x8C, 0xCC, 0xC4, 0x38, 0x38,
+    0xBC, 0xA9, 0xE4, 0xA6, 0x95, 0x78, 0xD6, 0x4A, 0x78, 0xBF, 0xB1, 0x9D, 0x26, 0x14, 0x0C, 0x9D,
+    0xE1, 0xC0, 0xC8, 0xFA, 0x1D, 0x67, 0x78, 0xD1, 0x9F, 0xB1, 0x7F, 0x1D, 0xFC, 0x00, 0x87, 0xC7,
+    0x73, 0xDE, 0xA4, 0x93, 0x65, 0x75, 0xA8, 0xDB, 0x57, 0xF1, 0x28, 0x1E, 0xDA, 0x1A, 0xA3, 0xDB,
+    0xB1, 0x1D, 0xD7, 0x2F, 0xEC, 0xA0, 0xCB, 0x80, 0xE2, 0xB3, 0x9D, 0xB1, 0x8D, 0x88, 0xDC, 0xEE,
+    0x93, 0x61, 0x76, 0x96, 0x9D, 0x86, 0x3C, 0x7B, 0x6D, 0x3B, 0x91, 0x53, 0x6C, 0x16, 0xCE, 0xD2,
+    0x29, 0x9E, 0xE5, 0xB3, 0x80, 0x96, 0xD0, 0x22, 0x5A, 0x46, 0x0B, 0x69, 0x29, 0x15, 0xD3, 0x72,
+    0x5A, 0x50, 0x4B, 0x6A, 0x51, 0x2D, 0xEB, 0x89, 0x5D, 0xB7, 0x12, 0x2B, 0xD3, 0xA8, 0x39, 0xC2,
+    0xDF, 0xF6, 0x32, 0x04, 0xDA, 0xC5, 0x58, 0x75, 0xD0, 0x4B, 0x03, 0x68, 0x21, 0xB5, 0x10, 0x5B,
+    0xC8, 0x2D, 0x04, 0x17, 0x92, 0x0B, 0xD1, 0x95, 0x5D, 0xE1, 0x95, 0x5E, 0xF1, 0x95, 0x5F, 0x15,
+    0xB0, 0xA8, 0x81, 0x27, 0xD9, 0x04, 0xD4, 0x82, 0x7F, 0x93, 0x32, 0x5F, 0x99, 0xF5, 0xFC, 0x27,
+    0xF8, 0xAB, 0x32, 0xEC, 0x63, 0xC4, 0xC4, 0x31, 0xFA, 0xA8, 0x11, 0x67, 0xAF, 0x55, 0xCC, 0x39,
+    0xE5, 0x92, 0x86, 0xA5, 0xAB, 0xC8, 0x1E, 0x9B, 0xA7, 0x31, 0x40, 0xFB, 0x65, 0x67, 0xDA, 0x03,
+    0x8E, 0x77, 0xF5, 0xCC, 0xAA, 0xC9, 0xF0, 0xF9, 0x0A, 0x07, 0x0D, 0x7F, 0x01, 0x66, 0x6C, 0x60,
+    0xC5, 0x43, 0x39, 0x06, 0x5D, 0x35, 0x0C, 0x1D, 0xE4, 0x0F, 0x7F, 0xC6, 0xC4, 0xDB, 0x85, 0xE5,
+    0xE5, 0x99, 0x27, 0xFA, 0xF9, 0x19, 0x72, 0xC0, 0x83, 0x98, 0xC6, 0x5B, 0x07, 0x22, 0x3A, 0xBF,
+    0x05, 0xCF, 0x33, 0x99, 0xDC, 0x40, 0x38, 0xD8, 0xBE, 0x86, 0xEF, 0x34, 0xE2, 0x01, 0x8C, 0x18,
+    0x0E, 0x82, 0x49, 0xDF, 0xA0, 0x3F, 0x86, 0x86, 0xE2, 0x87, 0x99, 0x38, 0xCD, 0xA8, 0x58, 0x07,
+    0xD7, 0x3F, 0x07, 0x56, 0x9D, 0x2E, 0x3A, 0x8F, 0x60, 0xDE, 0x58, 0xDC, 0x4A, 0xE7, 0xCE, 0x0A,
+    0x02, 0xAE, 0x6C, 0xB1, 0x79, 0x01, 0xC7, 0xD9, 0xFB, 0x38, 0xF1, 0xFE, 0xCB, 0x00, 0xDF, 0xDD,
+    0xA3, 0xE1, 0xA9, 0x11, 0x86, 0xC4, 0x75, 0xE8, 0x01, 0x31, 0xF1, 0xEC, 0x3D, 0x91, 0x2F, 0x3E,
+    0xCC, 0x64, 0x8C, 0xA9, 0x13, 0xE3, 0xD1, 0x51, 0xD9, 0xD9, 0x76, 0x7B, 0x09, 0xDB, 0xAA, 0x7E,
+    0x35, 0x86, 0x3F, 0x72, 0x9B, 0x74, 0xAF, 0xF6, 0x74, 0xD1, 0x1A, 0xE9, 0x68, 0xBA, 0x73, 0xDF,
+    0x88, 0xDC, 0xF8, 0x34, 0x93, 0xFD, 0x21, 0xE9, 0x2C, 0xA2, 0xA6, 0x8C, 0x9D, 0xB9, 0x01, 0x3F,
+    0x58, 0x37, 0xA2, 0x0B, 0x14, 0x07, 0x81, 0xEF, 0x91, 0x95, 0x18, 0x50, 0x63, 0xD0, 0x6F, 0x8C,
+    0x41, 0x39, 0xC0, 0xCE, 0xD3, 0x5B, 0xDF, 0x73, 0x89, 0xF8, 0x3A, 0x9A, 0x88, 0x13, 0x96, 0x01,
+    0x61, 0x1D, 0x31, 0xE8, 0xC7, 0x02, 0x71, 0x30, 0x93, 0x37, 0x9F, 0x45, 0x64, 0x77, 0x33, 0xF9,
+    0x1A, 0x71, 0x22, 0x66, 0x82, 0xBD, 0x33, 0x54, 0x0C, 0x3A, 0xA2, 0xA3, 0xA6, 0x39, 0xBC, 0x85,
+    0xFD, 0xCE, 0x3B, 0xDE, 0x68, 0x0C, 0x62, 0x20, 0xCC, 0xF3, 0x64, 0x30, 0xD2, 0xBF, 0x8B, 0x41,
+    0xB9, 0xA9, 0x21, 0x6C, 0xC5, 0xC3, 0x99, 0xBD, 0x96, 0x38, 0x90, 0xDD, 0x25, 0x5D, 0xAB, 0x35,
+    0x4C, 0xE2, 0x53, 0x7A, 0x1C, 0xC1, 0xFD, 0xD7, 0xF4, 0x39, 0x8A, 0x1A, 0x42, 0xC8, 0x68, 0x42,
+    0x45, 0xB5, 0xF3, 0x43, 0x3F, 0xE7, 0x6D, 0x3A, 0x64, 0x31, 0xE2, 0xF0, 0x14, 0xCB, 0xAC, 0xE8,
+    0x0E, 0xF4, 0x30, 0xD5, 0x3E, 0xC2, 0x32, 0x4D, 0x20, 0xAF, 0xA4, 0x2F, 0x42, 0x52, 0x9C, 0x33,
+    0xA6, 0x14, 0xF3, 0x19, 0x4B, 0x18, 0x88, 0x81, 0x9B, 0xD3, 0x5F, 0x6A, 0xF4, 0x55, 0xE3, 0xDE,
+    0xF2, 0x44, 0x5E, 0x68, 0x7F, 0x54, 0x5B, 0xB9, 0x6D, 0xCC, 0x64, 0xE7, 0xCC, 0x88, 0x57, 0x70,
+    0x04, 0x38, 0x8E, 0x71, 0xAE, 0xB6, 0xF7, 0x0F, 0xC5, 0x72, 0xA6, 0xAF, 0x45, 0x99, 0x6A, 0x8F,
+    0x3A, 0x21, 0xBA, 0x9C, 0xB4, 0x0C, 0x8F, 0x57, 0xEE, 0xA0, 0x9A, 0x6B, 0x25, 0xCA, 0x6B, 0xD9,
+    0x19, 0x4D, 0x06, 0x95, 0xF9, 0xA2, 0x57, 0xA0, 0x8F, 0xC2, 0xFD, 0xC3, 0x24, 0x6E, 0x31, 0x5E,
+    0x5E, 0x56, 0x68, 0x99, 0xD1, 0xCB, 0xC7, 0x57, 0x73, 0x29, 0x83, 0x2C, 0xDF, 0x63, 0xF0, 0xEF,
+    0x30, 0xEA, 0xB3, 0x4E, 0x1F, 0xD5, 0x28, 0xBA, 0xCA, 0xAE, 0x0D, 0xA5, 0x17, 0x8A, 0xAF, 0xF2,
+    0x2B, 0x80, 0x12, 0x88, 0xAF, 0x95, 0x30, 0x1B, 0x42, 0x28, 0x45, 0xE7, 0xF1, 0xD4, 0x00, 0x41,
+    0x2C, 0xC1, 0x49, 0xD3, 0x27, 0x46, 0x14, 0x39, 0x41, 0x0D, 0xFD, 0xC7, 0x2C, 0x8F, 0xC7, 0xFB,
+    0x8C, 0x76, 0x61, 0x2F, 0x1D, 0xD8, 0x14, 0xCE, 0xF6, 0x4C, 0x3C, 0x96, 0xC7, 0xA2, 0x80, 0x4A,
+    0xA8, 0x88, 0xCA, 0xA8, 0x90, 0x4A, 0xA9, 0x98, 0xCA, 0xB9, 0x00, 0xEA, 0x1E, 0x42, 0x50, 0x0A,
+    0x55, 0x41, 0xD8, 0xC7, 0xE1, 0x5A, 0xC4, 0xEC, 0x29, 0x07, 0x32, 0xCF, 0x79, 0x4B, 0x23, 0xC1,
+    0xA5, 0x1A, 0x6B, 0xAB, 0x56, 0x69, 0xE6, 0x30, 0xCB, 0x99, 0x29, 0xE4, 0xAC, 0x78, 0x8A, 0xDE,
+    0x09, 0x0F, 0x70, 0xCC, 0x1B, 0xD2, 0xD9, 0xEA, 0xE6, 0xDA, 0x6C, 0x75, 0xAD, 0x9B, 0xEE, 0x70,
+    0xEE, 0x1A, 0xE2, 0xB5, 0x99, 0x4C, 0x49, 0xF7, 0xF4, 0x10, 0x74, 0x90, 0x6B, 0xFA, 0xBE, 0x8C,
+    0xF2, 0x4A, 0x1E, 0xE6, 0x32, 0x2E, 0xA7, 0x9C, 0x99, 0x04, 0x3F, 0x0C, 0x6E, 0x21, 0x2B, 0xEB,
+    0x07, 0x19, 0xFA, 0x4B, 0xA4, 0x1A, 0xDB, 0x20, 0x10, 0x21, 0x70, 0x8E, 0x8F, 0xC0, 0x72, 0x71,
+    0x18, 0x16, 0x07, 0xB2, 0xFB, 0x5C, 0xCD, 0xDD, 0xAC, 0x64, 0xD7, 0xD6, 0x0E, 0x2B, 0x0F, 0xC0,
+    0xF3, 0x62, 0x76, 0xAA, 0xC5, 0xAC, 0x57, 0x76, 0xC5, 0xEC, 0xD0, 0x81, 0x19, 0x27, 0x46, 0x53,
+    0xDD, 0x33, 0xD8, 0xE7, 0xE2, 0xDD, 0xD3, 0x78, 0x89, 0x04, 0xC8, 0xDF, 0x86, 0x79, 0x2F, 0x2E,
+    0x98, 0xF8, 0xE2, 0x44, 0xB8, 0x7E, 0xD5, 0xCE, 0x67, 0xF4, 0x41, 0xC0, 0xE2, 0x17, 0xB8, 0xA8,
+    0x79, 0x53, 0x93, 0x50, 0xFD, 0xD7, 0x71, 0xB5, 0x60, 0x80, 0x47, 0x7C, 0x4F, 0xED, 0x2A, 0x4B,
+    0x9C, 0xCF, 0x79, 0x0F, 0x3A, 0xE6, 0x38, 0x15, 0x55, 0xC1, 0xDF, 0x92, 0xBA, 0x78, 0xA0, 0xEF,
+    0xFF, 0x39, 0xA8, 0xE6, 0x62, 0x76, 0xA8, 0x7D, 0x76, 0x39, 0x98, 0x65, 0x86, 0x76, 0xA2, 0x4B,
+    0x68, 0x79, 0xE7, 0x54, 0x0F, 0x5E, 0xFB, 0x17, 0x91, 0x4A, 0x66, 0x70, 0x9D, 0x2B, 0x8C, 0x60,
+    0x1C, 0x56, 0x53, 0xFD, 0x43, 0xBD, 0x03, 0xF8, 0x06, 0xC1, 0x26, 0x85, 0x68, 0x8E, 0x81, 0x9E,
+    0xBD, 0x99, 0x0B, 0xC3, 0x36, 0xE8, 0x33, 0x44, 0x81, 0x90, 0xC0, 0xA4, 0xB4, 0x03, 0x1B, 0x3C,
+    0x95, 0xE8, 0x32, 0x1F, 0xD9, 0x1F, 0x36, 0x49, 0x1C, 0x83, 0x13, 0xEE, 0x54, 0xD2, 0xC2, 0x87,
+    0xB9, 0xCB, 0xA8, 0xC6, 0x72, 0x09, 0xC6, 0x80, 0xF1, 0xB0, 0x5E, 0x32, 0xF3, 0x42, 0x46, 0xC7,
+    0x49, 0x35, 0xAD, 0xB3, 0x49, 0xE7, 0xE7, 0xF6, 0x4A, 0x38, 0x53, 0xCB, 0xAD, 0x04, 0x89, 0x2A,
+    0xC3, 0x48, 0x99, 0x70, 0x14, 0x94, 0x22, 0x09, 0x7B, 0xB6, 0x95, 0x03, 0x5A, 0x0E, 0xC1, 0x04,
+    0x05, 0x7F, 0x1C, 0x19, 0xEB, 0x27, 0x82, 0xD8, 0xEB, 0xD1, 0xD8, 0xCD, 0x62, 0x16, 0x8E, 0x79,
+    0x31, 0xE5, 0xD7, 0xC7, 0xD9, 0x68, 0xFC, 0x8C, 0x68, 0xF2, 0xDD, 0x35, 0xA1, 0xCE, 0x73, 0x34,
+    0xFD, 0xBC, 0x3D, 0x9D, 0xA3, 0x97, 0xA1, 0xC5, 0xE7, 0x6D, 0xFA, 0x02, 0x06, 0x4A, 0x6F, 0xC1,
+    0x90, 0x06, 0x85, 0xB5, 0x77, 0x0F, 0x9D, 0x9F, 0x49, 0xDE, 0x5E, 0x0F, 0xD9, 0x7F, 0x48, 0x7E,
+    0x00, 0x54, 0x42, 0x45, 0x54, 0x46, 0x85, 0xB4, 0x83, 0x12, 0x53, 0x38, 0x54, 0xBF, 0x41, 0xC4,
+    0x84, 0x88, 0x61, 0x95, 0x55, 0x61, 0x17, 0x69, 0xB5, 0x7E, 0xD7, 0xB1, 0x77, 0x52, 0xE0, 0x6E,
+    0xF1, 0xF2, 0x5A, 0x79, 0xFF, 0x35, 0x35, 0x2E, 0x67, 0x49, 0x9F, 0x13, 0x71, 0x9B, 0xAE, 0x29,
+    0x68, 0xD2, 0x9B, 0x1C, 0xF6, 0x36, 0x4E, 0xDF, 0x56, 0xBC, 0xB7, 0xD6, 0x65, 0xCE, 0x3E, 0x3F,
+    0x3E, 0x77, 0x3A, 0x3F, 0x0E, 0x82, 0xC8, 0xD9, 0x3D, 0x7B, 0x17, 0x26, 0xBB, 0x8B, 0x11, 0xDC,
+    0x17, 0x99, 0x12, 0x23, 0x5E, 0x64, 0xA4, 0xF6, 0x7E, 0xAD, 0xD6, 0xCA, 0xC9, 0xFC, 0x59, 0x30,
+    0x9C, 0x4A, 0xB5, 0x6F, 0x17, 0xBF, 0x9A, 0x3F, 0xC7, 0x27, 0xF9, 0x73, 0xC9, 0x89, 0xC9, 0x90,
+    0xC3, 0xF5, 0x2E, 0x7D, 0xD4, 0xBF, 0xC7, 0x3D, 0xCE, 0x6C, 0x7F, 0xC3, 0x81, 0xF5, 0xAF, 0xD9,
+    0x35, 0x91, 0x95, 0x04, 0xDC, 0x6E, 0xA7, 0x4C, 0x25, 0xD2, 0x8A, 0x8C, 0xB3, 0xBC, 0xDF, 0x03,
+    0xE5, 0xB7, 0x82, 0x3A, 0x60, 0x0C, 0x30, 0x8D, 0xA1, 0x16, 0x3A, 0x35, 0x54, 0xAA, 0x87, 0x8C,
+    0x8A, 0xC0, 0x45, 0xD5, 0x84, 0xA8, 0x2A, 0x74, 0x15, 0xDA, 0xE7, 0x45, 0x0D, 0x16, 0x6C, 0x67,
+    0x62, 0xF5, 0x81, 0xC4, 0xE5, 0x13, 0x8B, 0x1A, 0xB1, 0x2A, 0xA1, 0x4E, 0x12, 0x79, 0xD0, 0xE2,
+    0x9A, 0xE4, 0x71, 0x9A, 0x8F, 0x58, 0x69, 0x83, 0xEC, 0xC9, 0xCC, 0x26, 0x83, 0xBD, 0x32, 0xCE,
+    0x3C, 0x33, 0x35, 0xD4, 0x42, 0x4B, 0x35, 0x4C, 0xFE, 0x77, 0x94, 0xEA, 0x2A, 0x75, 0x5B, 0xE6,
+    0x4C, 0xA5, 0x8B, 0x8F, 0x7D, 0xF5, 0xBB, 0x51, 0xFC, 0x38, 0xEB, 0x53, 0x9F, 0xAE, 0xE8, 0xDC,
+    0x72, 0x15, 0xF8, 0x3A, 0xA7, 0x25, 0xD6, 0x50, 0x76, 0x4E, 0x5B, 0xCD, 0xB8, 0x76, 0x5C, 0xB9,
+    0xB8, 0x49, 0x1F, 0x60, 0x22, 0xD6, 0x29, 0x60, 0x53, 0xB1, 0xB4, 0xB6, 0x16, 0x64, 0x36, 0x5E,
+    0x81, 0x26, 0xDC, 0x9A, 0xCB, 0x8A, 0x91, 0xA1, 0xDB, 0x07, 0x39, 0xC5, 0xB8, 0xB0, 0x5D, 0x6E,
+    0x90, 0xFE, 0xE2, 0x4B, 0xAC, 0x11, 0x50, 0xAD, 0x3A, 0x58, 0x78, 0x8B, 0x5B, 0xEC, 0xAF, 0xC6,
+    0xF9, 0x37, 0xC2, 0xB6, 0x25, 0xF3, 0xA8, 0x67, 0xC3, 0x5E, 0xB7, 0x6B, 0xD5, 0x07, 0xBE, 0x15,
+    0xA0, 0x5E, 0x3E, 0xBD, 0x24, 0x6D, 0xBA, 0xC5, 0x06, 0xCF, 0xA5, 0x09, 0xCE, 0xE5, 0x3C, 0x67,
+    0xE8, 0x5F, 0xBA, 0xA9, 0x36, 0x43, 0xD1, 0x8D, 0x5A, 0x3C, 0x28, 0x71, 0x3D, 0x2C, 0x71, 0x3D,
+    0x9A, 0x78, 0x2C, 0xFB, 0xFD, 0x06, 0x12, 0xE0, 0xA6, 0x38, 0xC3, 0x4D, 0x69, 0x16, 0xB0, 0x41,
+    0x5D, 0x1F, 0x4F, 0x52, 0xBE, 0xCA, 0xE0, 0x02, 0xD2, 0xBE, 0xA9, 0xAB, 0x65, 0xA1, 0x08, 0xD1,
+    0xB8, 0xE2, 0xE8, 0xDB, 0x4F, 0x75, 0xE4, 0xB3, 0xEA, 0xDC, 0x67, 0x0E, 0x83, 0x32, 0x98, 0x84,
+    0x93, 0xB0, 0x08, 0x8B, 0x08, 0x3F, 0x31, 0x7F, 0xB2, 0x38, 0x63, 0x3C, 0xCF, 0x45, 0x37, 0xDD,
+    0xF0, 0x4C, 0xEE, 0xCD, 0x74, 0xE5, 0x14, 0x4F, 0x21, 0x48, 0xDD, 0x9E, 0xDE, 0x6E, 0xAB, 0x17,
+    0xB7, 0xFC, 0x6D, 0x12, 0x99, 0x74, 0x5B, 0x2B, 0xB6, 0x44, 0xD1, 0x10, 0xB2, 0x73, 0x12, 0xE4,
+    0x56, 0x8A, 0xCA, 0x1D, 0x5B, 0x2E, 0xD4, 0xB6, 0x8E, 0xED, 0x1B, 0x5E, 0x2A, 0xB9, 0x7B, 0xBF,
+    0xBB, 0x14, 0x6D, 0x9F, 0xA1, 0x74, 0x20, 0xBB, 0x04, 0xB2, 0x19, 0xEA, 0xA8, 0x4F, 0x93, 0x15,
+    0xD1, 0x2E, 0x95, 0x18, 0x30, 0x8F, 0x0A, 0xB6, 0x58, 0xDD, 0x82, 0x6E, 0x4A, 0x3C, 0xA4, 0x6F,
+    0xE5, 0xB3, 0x80, 0x78, 0xDE, 0xB3, 0x6D, 0x43, 0x0F, 0x63, 0xAB, 0x90, 0x96, 0x12, 0xFA, 0xE1,
+    0x4A, 0x58, 0x39, 0xE9, 0x69, 0x05, 0x57, 0xC2, 0xF4, 0xDE, 0xC0, 0xE8, 0x96, 0xC6, 0xE2, 0x8A,
+    0xBB, 0xDB, 0xFD, 0xA0, 0x6B, 0xF3, 0x9A, 0x67, 0x03, 0x13, 0x16, 0x93, 0x54, 0x34, 0x78, 0x3F,
+    0x6E, 0x00, 0x7C, 0xB7, 0x02, 0xB1, 0x21, 0xF2, 0xEF, 0x42, 0x66, 0x21, 0xB4, 0x90, 0x5A, 0x88,
+    0xAD, 0xDC, 0x0A, 0xAE, 0xE4, 0x76, 0x77, 0x29, 0xE5, 0x1E, 0xF0, 0x83, 0xF0, 0xD6, 0x6D, 0xFB,
+    0x0C, 0x75, 0x60, 0x33, 0xD4, 0xC6, 0xF1, 0xE3, 0xA2, 0xDF, 0x59, 0xD6, 0x04, 0xED, 0x54, 0xAB,
+    0xC0, 0xEF, 0xC2, 0x84, 0xDA, 0x5D, 0x3D, 0xDB, 0xBA, 0xB6, 0xF5, 0xED, 0xB9, 0x73, 0x6F, 0x44,
+    0x09, 0xFA, 0x8E, 0x82, 0x2E, 0x6F, 0x7D, 0x7E, 0xF1, 0xDF, 0x1A, 0x56, 0xA0, 0x09, 0xB7, 0x7E,
+    0x9E, 0xA0, 0x86, 0x6E, 0x1F, 0x6A, 0x86, 0x7A, 0xDE, 0x9F, 0x6C, 0x90, 0x3E, 0xD2, 0x0C, 0xF5,
+    0x87, 0x66, 0xA8, 0x4C, 0xDC, 0xC9, 0xFE, 0x6A, 0x9C, 0x7F, 0x23, 0x6C, 0x1A, 0xB6, 0x99, 0xD5,
+    0x98, 0xB9, 0x16, 0x66, 0x5E, 0xBF, 0xEF, 0xB5, 0x02, 0xD4, 0xCB, 0xBD, 0xF3, 0xE8, 0xCB, 0x78,
+    0x8D, 0x27, 0x27, 0x05, 0x3A, 0x27, 0x01, 0x1D, 0x9E, 0xEF, 0x25, 0xBA, 0x98, 0x9A, 0x83, 0x3C,
+    0xC5, 0x0A, 0x04, 0xA3, 0x60, 0x44, 0xAC, 0x06, 0xBE, 0x9D, 0x4A, 0x78, 0xAB, 0x91, 0xE0, 0x27,
+    0xE4, 0x6E, 0x64, 0xCA, 0x91, 0x6E, 0x09, 0x72, 0x9B, 0xB3, 0xDB, 0xF3, 0x6B, 0xBA, 0xBD, 0x8C,
+    0xEE, 0x45, 0x0D, 0x6B, 0xFD, 0x60, 0x8E, 0xAC, 0x23, 0xDB, 0xF4, 0x34, 0x5E, 0xAC, 0xFC, 0x00,
+    0x7A, 0x1D, 0xA0, 0x10, 0xDD, 0x69, 0xD1, 0x8B, 0xD3, 0x52, 0xBA, 0x29, 0xFB, 0x98, 0xF2, 0xE1,
+    0x19, 0xEB, 0xC4, 0x63, 0x86, 0xE3, 0xE3, 0x9C, 0x13, 0x80, 0x5A, 0x4A, 0xF5, 0xBF, 0x57, 0xEA,
+    0xBE, 0xAC, 0x8C, 0xE7, 0x89, 0x88, 0x77, 0xB8, 0xD4, 0x69, 0xCE, 0x3B, 0xF2, 0xAA, 0xCF, 0xFE,
+    0x43, 0x92, 0x6C, 0x75, 0x61, 0x49, 0x8F, 0xC4, 0x96, 0x14, 0x83, 0x32, 0x6C, 0x91, 0x81, 0xE5,
+    0x47, 0x9B, 0xA2, 0xA9, 0x62, 0x2E, 0xF9, 0x1E, 0xEA, 0xB6, 0xB0, 0xF9, 0xC0, 0xA3, 0x0D, 0x67,
+    0xAA, 0x0D, 0x8B, 0x5D, 0x84, 0x1E, 0x8E, 0xEF, 0xBA, 0xAE, 0x8A, 0x18, 0x75, 0xAF, 0x4C, 0xA4,
+    0xDB, 0x96, 0xD2, 0xF8, 0x78, 0xB4, 0x46, 0x73, 0xC9, 0x81, 0x9F, 0x39, 0xE6, 0x6E, 0xE2, 0xDD,
+    0x35, 0xE2, 0x65, 0x5F, 0x0D, 0x8B, 0xE8, 0x97, 0x88, 0xE8, 0x01, 0xFF, 0xCD, 0x88, 0xEF, 0xB2,
+    0x64, 0x67, 0x74, 0xB8, 0x3E, 0xB0, 0x3F, 0x01, 0xAD, 0x57, 0x31, 0x6C, 0x1D, 0xC7, 0x11, 0x9D,
+    0xBB, 0x23, 0x75, 0x8A, 0x0E, 0xE0, 0xAA, 0x20, 0x0D, 0xC8, 0xB1, 0x79, 0x2E, 0x69, 0x05, 0xD0,
+    0xA9, 0x70, 0x00, 0x15, 0x12, 0x77, 0x13, 0x25, 0x48, 0x17, 0xAB, 0x20, 0x81, 0x20, 0x8D, 0x1B,
+    0x15, 0x8E, 0x53, 0xB8, 0x95, 0x01, 0x8B, 0xBB, 0x96, 0x4A, 0x15, 0x66, 0x93, 0xDA, 0x1F, 0x88,
+    0x0A, 0x81, 0x29, 0xDC, 0xA4, 0x50, 0xC1, 0xCF, 0x5B, 0x9B, 0x85, 0x8A, 0x34, 0x87, 0xA8, 0x08,
+    0x10, 0x04, 0xF0, 0x05, 0x0E, 0x10, 0xC0, 0x2E, 0xBC, 0x30, 0xCE, 0xD0, 0x09, 0xB9, 0xFB, 0x9B,
+    0x37, 0x7B, 0xF7, 0xF5, 0x49, 0x4A, 0x90, 0x58, 0x78, 0xF7, 0xCF, 0xED, 0xFF, 0x7F, 0x67, 0x77,
+    0x66, 0x67, 0xE7, 0xCD, 0xCC, 0x11, 0x25, 0x8A, 0xAA, 0xD2, 0x4D, 0xAA, 0x3F, 0xD3, 0xE4, 0xA5,
+    0x9D, 0x5B, 0x4A, 0x6F, 0x90, 0x6C, 0xDF, 0xD8, 0x48, 0x37, 0xE8, 0xE5, 0x9D, 0x96, 0xB7, 0x64,
+    0xAF, 0x3B, 0xDD, 0xCD, 0x47, 0x5E, 0x5D, 0x78, 0x6F, 0x25, 0xE8, 0xE2, 0xDE, 0x9E, 0x09, 0xDB,
+    0x11, 0x7E, 0x79, 0xDF, 0x6B, 0x7E, 0x76, 0x1F, 0xEC, 0xA1, 0x3D, 0xD8, 0x4F, 0xAA, 0x1F, 0xE5,
+    0xF3, 0x7E, 0xBC, 0xBB, 0xB6, 0xBD, 0x25, 0x7D, 0xBF, 0xBC, 0xBD, 0x05, 0x41, 0xDA, 0xB7, 0x1F,
+    0xEC, 0xDD, 0x8F, 0x5D, 0xE2, 0x44, 0x95, 0x5B, 0x69, 0xB4, 0x5A, 0xA3, 0xA4, 0x4D, 0x9D, 0xA8,
+    0x85, 0x2D, 0x8C, 0x64, 0x55, 0xC6, 0x5E, 0xA0, 0x2F, 0x63, 0xAE, 0xA4, 0xD4, 0xCD, 0x48, 0xFC,
+    0xBB, 0x23, 0xF1, 0x65, 0x4B, 0xC5, 0x5D, 0x47, 0x32, 0xAD, 0x82, 0xD2, 0x5A, 0x54, 0xF8, 0x48,
+    0x7C, 0xB2, 0xAA, 0x48, 0xEB, 0xFC, 0x7A, 0xBD, 0x1C, 0x29, 0x92, 0xF8, 0x10, 0x6D, 0x12, 0x5D,
+    0x23, 0xFA, 0x18, 0x07, 0x6B, 0xB5, 0x6F, 0xFE, 0xF0, 0x74, 0x42, 0x8E, 0x22, 0x47, 0xB1, 0xA3,
+    0xA4, 0xA6, 0xB4, 0xA6, 0xAC, 0x22, 0x61, 0xF9, 0x93, 0x5B, 0x2A, 0x0C, 0x49, 0xD8, 0x21, 0x69,
+    0x41, 0x6E, 0xA4, 0x8A, 0xE2, 0xBF, 0x7C, 0x63, 0x12, 0x18, 0x29, 0xF5, 0xDE, 0x90, 0xC0, 0x7C,
+    0x0E, 0x2A, 0x98, 0x28, 0x50, 0xE1, 0x7B, 0xEC, 0xDE, 0xD1, 0xC5, 0xE9, 0x03, 0xA2, 0x7D, 0xFC,
+    0x07, 0xD3, 0x46, 0xA0, 0x18, 0xDB, 0x64, 0x4D, 0xD1, 0xC9, 0x99, 0x46, 0x97, 0x7D, 0xD1, 0x9D,
+    0x99, 0x9C, 0xA5, 0x15, 0x08, 0x2A, 0x9C, 0xEC, 0x70, 0x09, 0xF5, 0x41, 0xB8, 0xC4, 0xCC, 0xC8,
+    0x0A, 0xDD, 0x2E, 0xD1, 0x25, 0xBA, 0x5D, 0x7E, 0xE2, 0xFD, 0x1D, 0x5F, 0x46, 0xFD, 0x2A, 0x9D,
+    0xC7, 0x84, 0x45, 0x37, 0x4B, 0x60, 0x2A, 0x9B, 0x09, 0x4D, 0x4E, 0xE1, 0x0F, 0xBA, 0xA5, 0x8D,
+    0x57, 0x76, 0x34, 0xEF, 0xE6, 0xFD, 0x1C, 0xBD, 0xAC, 0x07, 0xDE, 0xDA, 0x12, 0xF7, 0xD3, 0xF0,
+    0x96, 0x8E, 0x2E, 0x73, 0x3F, 0x0D, 0xEF, 0xD0, 0xE2, 0x19, 0xDF, 0x04, 0x91, 0xF0, 0x06, 0xB7,
+    0x00, 0xEB, 0x7E, 0x67, 0x8B, 0xE0, 0x89, 0xC2, 0xDE, 0x1E, 0x2E, 0xD7, 0xB6, 0x3C, 0xEE, 0x88,
+    0x43, 0xC7, 0xE3, 0x34, 0xBF, 0x17, 0x6E, 0x7D, 0x2A, 0xDF, 0xBB, 0x57, 0xC3, 0xC6, 0xBA, 0x94,
+    0xBA, 0x13, 0x9E, 0x64, 0xDF, 0xCD, 0x7A, 0x59, 0xAA, 0xFC, 0xFB, 0x1F, 0xBA, 0xA9, 0xC6, 0x1D,
+    0xA5, 0x5F, 0x37, 0xD3, 0x29, 0x46, 0xAC, 0x9B, 0x76, 0x05, 0x9C, 0x21, 0x71, 0x5D, 0x07, 0x8F,
+    0x98, 0x0E, 0x63, 0xD4, 0x26, 0x4F, 0x9A, 0xBE, 0xC7, 0x2D, 0xC7, 0xDE, 0x95, 0x1D, 0xBB, 0x80,
+    0x37, 0xB2, 0xA6, 0xE7, 0xDB, 0x5C, 0xC3, 0x85, 0x8E, 0x0B, 0x2D, 0x17, 0x7A, 0x2E, 0x34, 0x5D,
+    0xE8, 0xBA, 0xD0, 0x76, 0xA1, 0xEF, 0xC1, 0x5C, 0xE3, 0x04, 0xD8, 0x1B, 0x74, 0x7E, 0xD7, 0x57,
+    0xA3, 0xD6, 0x9F, 0x3D, 0xAA, 0x47, 0xBD, 0x3F, 0xFF, 0x4D, 0x3D, 0x6A, 0xAE, 0xE1, 0xA2, 0x83,
+    0xEE, 0xF0, 0xF0, 0x51, 0x7B, 0x08, 0x1D, 0xF5, 0x97, 0xDA, 0x8C, 0x27, 0x28, 0xFC, 0xFC, 0x0C,
+    0x59, 0x7B, 0x54, 0xFD, 0x1E, 0x9C, 0x2E, 0xAB, 0x04, 0x40, 0x85, 0xAB, 0xEF, 0x79, 0x65, 0xA1,
+    0x12, 0xA7, 0xE1, 0xFA, 0x38, 0xF5, 0x27, 0x0D, 0x36, 0xAF, 0x69, 0xE3, 0x8C, 0xE1, 0xB9, 0x2F,
+    0x5A, 0x4C, 0x5E, 0x07, 0x28, 0x75, 0x56, 0x63, 0x5A, 0x58, 0xCC, 0x17, 0xCC, 0x70, 0x9B, 0x39,
+    0xDE, 0xA7, 0x42, 0xE5, 0x56, 0x54, 0x49, 0x0D, 0xF8, 0x34, 0x74, 0x13, 0x9C, 0x94, 0x03, 0x8B,
+    0x02, 0x1B, 0x31, 0x4B, 0xEC, 0x60, 0xDE, 0x26, 0x27, 0xBA, 0x79, 0x4E, 0x61, 0x4E, 0xF3, 0xA4,
+    0x54, 0x98, 0xCD, 0x2D, 0xA6, 0x33, 0x8B, 0x79, 0x88, 0x6A, 0x72, 0xAC, 0x06, 0x47, 0x70, 0xD8,
+    0x77, 0x88, 0x5A, 0x46, 0x4B, 0xF2, 0x2F, 0xCA, 0xDE, 0xA4, 0xF5, 0x15, 0xBA, 0xBA, 0x42, 0x7F,
+    0x15, 0x44, 0xE7, 0x03, 0x6C, 0x3D, 0x25, 0x50, 0xB1, 0xA1, 0xA2, 0x26, 0x09, 0x78, 0x02, 0xA7,
+    0x00, 0xAC, 0x43, 0x1C, 0xA0, 0x58, 0x11, 0xA9, 0xCC, 0x8A, 0x3A, 0x73, 0x49, 0x9B, 0x74, 0x49,
+    0x27, 0x5C, 0x51, 0x95, 0x6A, 0x87, 0xCE, 0x62, 0x53, 0x06, 0x4C, 0x0C, 0xF0, 0xBF, 0x05, 0x83,
+    0x68, 0xB5, 0x4F, 0xC2, 0xC9, 0x18, 0x22, 0xBA, 0x25, 0xAC, 0xC5, 0x9E, 0xD8, 0x07, 0xDB, 0x95,
+    0x7C, 0x9F, 0xDF, 0x03, 0xA7, 0xAF, 0x27, 0xDE, 0xBD, 0x0D, 0xE0, 0x7B, 0xAB, 0xF1, 0x2C, 0xB1,
+    0xA2, 0x80, 0x3D, 0x11, 0x37, 0xB2, 0x27, 0x1C, 0x24, 0x0B, 0x3B, 0x63, 0xBF, 0xE6, 0xC8, 0x80,
+    0x4D, 0x82, 0x02, 0x05, 0x22, 0x04, 0xEF, 0x8C, 0x3D, 0x49, 0x2B, 0x1C, 0x81, 0x2E, 0x80, 0xA2,
+    0x59, 0xDA, 0xC6, 0xB3, 0xAC, 0x89, 0x7B, 0xE1, 0x58, 0x1F, 0x50, 0x9D, 0xB4, 0x79, 0x95, 0x36,
+    0xB9, 0xC5, 0x1A, 0x90, 0x34, 0xA2, 0x66, 0x7B, 0x48, 0x5E, 0xFD, 0xEC, 0x7E, 0x0A, 0x7A, 0x48,
+    0xFA, 0x4E, 0x4F, 0xE5, 0xDD, 0x9E, 0x34, 0x44, 0x2C, 0xD1, 0x0D, 0xFE, 0x3B, 0xF3, 0xAA, 0xF4,
+    0xB5, 0xF6, 0x4E, 0xFE, 0xB7, 0xC9, 0x1E, 0x3B, 0xF1, 0xC8, 0x89, 0xAF, 0x6A, 0x76, 0xC0, 0x19,
+    0xE5, 0x8E, 0xCF, 0x00, 0x97, 0x1E, 0xDA, 0x25, 0xA8, 0xA7, 0xC8, 0x2B, 0x28, 0x49, 0xAB, 0x44,
+    0x6B, 0xDB, 0xDB, 0xD2, 0xCF, 0x34, 0xA2, 0xD2, 0xD0, 0x2E, 0x13, 0xD9, 0x2B, 0x94, 0x98, 0x75,
+    0x5A, 0xA7, 0xEC, 0x1B, 0x58, 0xBB, 0xDC, 0x25, 0xFA, 0x70, 0x97, 0x12, 0xC4, 0x2C, 0xA1, 0xD6,
+    0xE9, 0x0A, 0xA5, 0xB8, 0x8B, 0xD8, 0x2C, 0x3C, 0x26, 0x81, 0x81, 0x70, 0x07, 0xE0, 0x27, 0xBA,
+    0x0A, 0x6A, 0x70, 0xB8, 0x7A, 0xF8, 0x3B, 0x83, 0xD0, 0x3C, 0x04, 0x67, 0xB6, 0x09, 0xD1, 0x13,
+    0x45, 0xC9, 0xA1, 0xA2, 0xF4, 0x2E, 0x70, 0x86, 0xF9, 0x6B, 0xB1, 0x3D, 0xEA, 0x7A, 0x69, 0x7D,
+    0x6C, 0x3C, 0x9B, 0x0E, 0xB3, 0xE2, 0xDE, 0x30, 0x16, 0xFE, 0x4F, 0xE1, 0x0C, 0x67, 0x10, 0x5D,
+    0xC7, 0xEC, 0x13, 0xC6, 0xC8, 0x7F, 0x11, 0xFE, 0x4F, 0x9F, 0x8C, 0xB0, 0xFB, 0x3A, 0xA0, 0xE9,
+    0xCC, 0x2F, 0xBF, 0x6C, 0xD9, 0xD0, 0x59, 0x15, 0x55, 0x1C, 0x83, 0x33, 0x30, 0xC3, 0x08, 0xEB,
+    0x88, 0xC9, 0xD7, 0x00, 0x46, 0xF9, 0x1D, 0x2C, 0x70, 0x30, 0x24, 0x35, 0x24, 0x30, 0xE8, 0xE7,
+    0x6D, 0xC4, 0xA3, 0xFF, 0x27, 0xE2, 0xF7, 0xEF, 0x29, 0xFD, 0x1F, 0xFC, 0x07, 0x3C, 0xE2, 0x31,
+    0xBC, 0xE9, 0x53, 0x4B, 0x29, 0x30, 0x2A, 0x80, 0x2D, 0x8A, 0x21, 0x65, 0xCC, 0x24, 0x23, 0xA4,
+    0x7B, 0x39, 0x24, 0xC8, 0x9C, 0xD5, 0xD8, 0xA1, 0x21, 0xA6, 0x73, 0xCE, 0x18, 0x19, 0x39, 0x0B,
+    0x04, 0x13, 0x84, 0x78, 0x1F, 0x35, 0x6C, 0xB3, 0x10, 0xC3, 0x58, 0xFD, 0xE2, 0xD8, 0x22, 0x4E,
+    0x22, 0x9C, 0x64, 0x86, 0xB4, 0x31, 0x2C, 0xA2, 0xA2, 0x45, 0xD2, 0x26, 0x7D, 0x1F, 0xC1, 0x80,
+    0xA6, 0x81, 0xAF, 0x63, 0x10, 0x20, 0x3A, 0x24, 0x4F, 0x71, 0x2F, 0x50, 0xD7, 0xA4, 0x3F, 0x50,
+    0x86, 0x08, 0x50, 0x2D, 0x52, 0x13, 0x87, 0xB0, 0x07, 0x61, 0x1D, 0xE4, 0x0D, 0xC3, 0x1F, 0x1D,
+    0xEF, 0x0F, 0x38, 0x3C, 0x63, 0x05, 0xBA, 0x3F, 0x34, 0x29, 0x96, 0x7B, 0x15, 0xC1, 0xC5, 0x74,
+    0xD0, 0xE4, 0x88, 0x88, 0x9F, 0x85, 0x75, 0xA5, 0x9B, 0x87, 0x36, 0x5F, 0xC1, 0xCF, 0x0A, 0xDF,
+    0xC2, 0xD5, 0x72, 0xDF, 0xC1, 0xDB, 0x56, 0xE2, 0xFE, 0x4A, 0xD6, 0x30, 0x6B, 0xDA, 0xB0, 0xC3,
+    0x03, 0x32, 0x08, 0x27, 0x00, 0xA0, 0xAE, 0x23, 0x6F, 0x22, 0xAF, 0xD2, 0x3E, 0x80, 0x32, 0x88,
+    0x85, 0x62, 0x90, 0x5C, 0x98, 0x63, 0xE1, 0x32, 0x33, 0xEC, 0x91, 0xC0, 0xAB, 0x7F, 0xF6, 0x34,
+    0x34, 0x0B, 0xA8, 0x3C, 0x7F, 0x44, 0x6C, 0x03, 0xA9, 0xC2, 0x41, 0xA8, 0x60, 0x99, 0xC0, 0x55,
+    0xD4, 0xE5, 0x48, 0xB6, 0x1D, 0x3C, 0x3B, 0x6B, 0xF1, 0xD0, 0xB5, 0x64, 0x71, 0x52, 0x41, 0x9A,
+    0x64, 0x61, 0x9A, 0x65, 0x1D, 0x1C, 0x17, 0xF4, 0x10, 0x12, 0x78, 0x3E, 0x3C, 0x0C, 0x60, 0x09,
+    0x21, 0x23, 0x2C, 0xA2, 0x19, 0xA4, 0xC4, 0xB3, 0xDC, 0xB7, 0xD8, 0xDD, 0x23, 0x42, 0xAC, 0x44,
+    0x3D, 0xB8, 0xA8, 0x07, 0x57, 0xDC, 0xE1, 0x70, 0x59, 0x8B, 0xB3, 0x49, 0x87, 0x07, 0x40, 0x55,
+    0x27, 0x3D, 0x2C, 0x08, 0x29, 0xC2, 0x66, 0x47, 0x73, 0x40, 0xC1, 0x52, 0xB4, 0x29, 0x2A, 0x2A,
+    0x91, 0xA6, 0xA1, 0x03, 0x34, 0x5B, 0x42, 0x39, 0x42, 0x28, 0x8E, 0x14, 0xBC, 0xCC, 0x30, 0x05,
+    0x3B, 0x53, 0x3F, 0xA4, 0xFD, 0x04, 0xB7, 0xC3, 0x5B, 0xE4, 0x36, 0x1C, 0x3C, 0xA0, 0x04, 0x53,
+    0x30, 0x25, 0x1F, 0x82, 0xEB, 0x1E, 0x62, 0xEF, 0xFC, 0xA8, 0xF4, 0xE6, 0x96, 0xF6, 0x16, 0x54,
+    0x9D, 0x20, 0x3B, 0x92, 0xBA, 0xA5, 0x7B, 0xBA, 0xF5, 0xD1, 0x0D, 0xBA, 0x75, 0x8B, 0x5E, 0x49,
+    0xE1, 0xC8, 0x28, 0xE3, 0x04, 0xBC, 0xBF, 0xF0, 0xDF, 0xA2, 0xAC, 0x3B, 0x04, 0x0A, 0x0E, 0x6D,
+    0x79, 0x82, 0xF8, 0x3F, 0xE9, 0xFF, 0x61, 0x73, 0xF0, 0xC5, 0xA1, 0xF4, 0xBB, 0xCF, 0x45, 0x1F,
+    0x6D, 0x02, 0x2D, 0x57, 0xA5, 0xAF, 0x40, 0xF5, 0x0B, 0xA8, 0xBA, 0xA6, 0x43, 0xA9, 0xA8, 0x50,
+    0x47, 0x0D, 0xC2, 0x18, 0x03, 0x70, 0xB8, 0xF3, 0x42, 0xD1, 0x66, 0xCE, 0xE7, 0xDA, 0xA6, 0x9F,
+    0x62, 0x9E, 0x40, 0x89, 0xFF, 0x35, 0x90, 0x06, 0xA7, 0xFD, 0x5B, 0x45, 0x29, 0x1F, 0x3A, 0x31,
+    0x00, 0x49, 0xD2, 0xA5, 0x1D, 0x8C, 0xA3, 0x8E, 0xFA, 0x8A, 0x54, 0x8B, 0x1A, 0x8F, 0x1B, 0xC2,
+    0x52, 0x88, 0x4B, 0x21, 0x30, 0x85, 0xC8, 0x44, 0xC7, 0x43, 0xD3, 0x8F, 0xD3, 0x38, 0x24, 0x12,
+    0xC7, 0x44, 0xE2, 0xA0, 0x18, 0xA2, 0xE2, 0x10, 0x16, 0x87, 0x76, 0x7B, 0x00, 0xB0, 0xD9, 0x47,
+    0x91, 0xB0, 0x0F, 0x67, 0x7D, 0xFA, 0x3B, 0x1C, 0x0F, 0x80, 0x00, 0xE5, 0xDD, 0x2A, 0x69, 0xCC,
+    0xF5, 0x00, 0xF2, 0x06, 0x23, 0xFD, 0xCD, 0x63, 0xD6, 0x58, 0xC5, 0x28, 0x07, 0x6B, 0xA8, 0x93,
+    0xD6, 0xC8, 0xD9, 0x1A, 0xA1, 0xA6, 0x0C, 0x82, 0x74, 0xDC, 0xF8, 0xEB, 0xCE, 0xA7, 0xD5, 0x26,
+    0x23, 0xDC, 0xB0, 0x01, 0xE4, 0x08, 0xD5, 0xA8, 0x65, 0x58, 0xE3, 0x33, 0x14, 0xA7, 0xF9, 0x9D,
+    0x5A, 0x66, 0xCD, 0x4E, 0xD6, 0x4C, 0xD9, 0x96, 0x8A, 0xF6, 0x20, 0x76, 0x35, 0xF3, 0x7E, 0x97,
+    0x3E, 0xE6, 0x72, 0xFD, 0xDB, 0x76, 0xE7, 0x17, 0x9F, 0x7B, 0xEF, 0x1E, 0xC2, 0x7C, 0x7E, 0x6E,
+    0xAA, 0x65, 0xE4, 0x10, 0x14, 0x35, 0xC9, 0x7F, 0x72, 0x54, 0x9C, 0x89, 0x45, 0xE2, 0xB7, 0x6F,
+    0xE1, 0x44, 0x1C, 0xD6, 0x23, 0xF1, 0x2B, 0x12, 0x9F, 0xBE, 0x07, 0x9D, 0xCA, 0x60, 0xEB, 0xD7,
+    0xFC, 0xD3, 0x1B, 0xA5, 0xE7, 0x54, 0xE3, 0x01, 0xF1, 0x16, 0xC7, 0x44, 0x95, 0xFD, 0x95, 0x56,
+    0xA9, 0xF8, 0x2D, 0xDF, 0x03, 0xB1, 0xB7, 0x33, 0x74, 0xA3, 0x9E, 0x2B, 0xA1, 0x08, 0x48, 0xBE,
+    0xF9, 0xCC, 0x90, 0x43, 0xEA, 0x29, 0xCD, 0x18, 0xD7, 0xE6, 0x6D, 0x6B, 0xCE, 0xDC, 0x33, 0x73,
+    0x2F, 0xDF, 0x7D, 0xDC, 0x44, 0xED, 0x4E, 0xFE, 0x08, 0x85, 0x45, 0x87, 0xD2, 0x25, 0xFB, 0x7B,
+    0x33, 0x2D, 0x94, 0xB8, 0x5B, 0xB7, 0x9B, 0x28, 0x9F, 0x0E, 0x5D, 0x47, 0x1B, 0xE7, 0x62, 0x33,
+    0xA1, 0x21, 0x40, 0xF0, 0x22, 0x5E, 0x3C, 0x7E, 0x3B, 0x22, 0xED, 0x88, 0xD4, 0xB8, 0x81, 0xDC,
+    0xA4, 0xC3, 0x23, 0xE5, 0x9A, 0x2E, 0x6E, 0x9E, 0x63, 0xDA, 0x7A, 0xF1, 0x56, 0x5C, 0x1B, 0x28,
+    0xCD, 0x45, 0x3E, 0xB4, 0x0E, 0x1B, 0x24, 0x1D, 0x92, 0x4A, 0x34, 0x79, 0x6E, 0x83, 0x10, 0xDA,
+    0x67, 0xF3, 0x47, 0x08, 0xE6, 0xC7, 0xDB, 0x1A, 0xE8, 0x86, 0x56, 0xC3, 0x56, 0x69, 0x17, 0xBE,
+    0x71, 0x7E, 0xDA, 0x5D, 0x42, 0x3C, 0x28, 0x4D, 0xA9, 0x2E, 0xBE, 0xD0, 0xF9, 0x2E, 0xC0, 0x64,
+    0x25, 0xDE, 0x77, 0x90, 0xAA, 0xF1, 0x96, 0xC2, 0x15, 0x05, 0x47, 0xD3, 0x40, 0x27, 0x3C, 0x1D,
+    0x02, 0xB6, 0xB4, 0x8A, 0xFA, 0xD2, 0xC4, 0x33, 0x1E, 0x2F, 0x9C, 0x34, 0x06, 0xF3, 0xCF, 0xD7,
+    0xF2, 0x3E, 0xBC, 0x1F, 0xBD, 0x4D, 0x43, 0x9E, 0x89, 0x6B, 0x19, 0xD7, 0x59, 0x03, 0xD7, 0x09,
+    0x8F, 0xD4, 0x49, 0x76, 0x1F, 0x39, 0xCE, 0xAE, 0x6D, 0xEB, 0xED, 0xED, 0xF0, 0x9E, 0x17, 0x1E,
+    0xE1, 0xE7, 0x62, 0x36, 0x01, 0x33, 0xAF, 0x15, 0x4D, 0x78, 0x84, 0x9F, 0xE3, 0xEC, 0x26, 0x07,
+    0x45, 0x6D, 0xB4, 0x91, 0x23, 0x92, 0x97, 0x80, 0x62, 0x6D, 0xB5, 0xB9, 0x34, 0x2A, 0xF5, 0x3A,
+    0x66, 0xF9, 0x7C, 0xCB, 0x70, 0x1C, 0xBC, 0xD7, 0xE1, 0x15, 0xE6, 0x27, 0x47, 0xBE, 0x2D, 0x3D,
+    0xF7, 0x8D, 0x5F, 0x06, 0xCA, 0x7A, 0x78, 0x2D, 0x38, 0xD5, 0xEB, 0x88, 0xB3, 0x97, 0xB9, 0x9F,
+    0xEA, 0x75, 0xA4, 0x96, 0x36, 0x57, 0x82, 0xCE, 0xD1, 0xAB, 0x79, 0x97, 0x01, 0x0E, 0xBC, 0x79,
+    0xDA, 0xB9, 0x2E, 0x2F, 0xE3, 0x15, 0xF4, 0x73, 0x3B, 0x99, 0x5C, 0x34, 0xA7, 0xD9, 0xF7, 0x80,
+    0x4E, 0x7B, 0xB6, 0xFF, 0x03, 0x4D, 0x94, 0xBF, 0x6F, 0xDC, 0x36, 0x14, 0xC7, 0xBF, 0x12, 0x71,
+    0x61, 0x12, 0x01, 0x65, 0x86, 0xF3, 0xE2, 0x00, 0xE1, 0xD4, 0x21, 0x06, 0x6A, 0xAD, 0x2D, 0x70,
+    0x16, 0x09, 0x64, 0xCC, 0x60, 0x0F, 0x4E, 0xD6, 0x2E, 0x1D, 0xBA, 0x65, 0xCD, 0xE0, 0x3B, 0x11,
+    0xF5, 0xD0, 0xD5, 0xFF, 0xC1, 0x75, 0x29, 0x50, 0x78, 0xF1, 0xD2, 0xC1, 0xC3, 0xDD, 0x89, 0x45,
+    0x86, 0x8E, 0xE1, 0x96, 0xD1, 0x04, 0x12, 0x20, 0x63, 0x84, 0x40, 0xC3, 0x15, 0x39, 0x1D, 0xFB,
+    0xDE, 0xC9, 0xF9, 0x21, 0x3E, 0xE8, 0x28, 0x8A, 0xE4, 0xBD, 0xF7, 0xFD, 0x7C, 0x29, 0x3C, 0x80,
+    0x48, 0x50, 0xC9, 0x95, 0x73, 0x6F, 0x94, 0x9F, 0x29, 0xBF, 0xD4, 0x7E, 0x59, 0xBA, 0xA5, 0x41,
+    0xBD, 0x85, 0xD9, 0xA0, 0x88, 0xC8, 0x9C, 0x88, 0x99, 0xCB, 0x6C, 0xE1, 0x95, 0x53, 0x56, 0x41,
+    0xA3, 0x44, 0x85, 0x23, 0xF0, 0xA5, 0x02, 0x8C, 0x47, 0xF2, 0x79, 0xF2, 0xC5, 0x8D, 0xD3, 0xDA,
+    0x56, 0xB5, 0x6D, 0x52, 0x68, 0x92, 0xC7, 0x0C, 0xF8, 0x95, 0xA7, 0x88, 0x14, 0x45, 0x0A, 0xD2,
+    0x43, 0x5D, 0xD0, 0x1F, 0xE1, 0x7E, 0xE3, 0xA0, 0xE8, 0xC1, 0x7D, 0x5F, 0x5B, 0xB3, 0xC5, 0xC3,
+    0x77, 0xC0, 0x08, 0xB4, 0x9C, 0x73, 0xB0, 0xA8, 0x1E, 0x60, 0xB6, 0x45, 0xD3, 0x60, 0xA1, 0x2D,
+    0xC5, 0xAC, 0x86, 0xE9, 0x39, 0x07, 0xBA, 0x74, 0x8A, 0x65, 0x0A, 0xD0, 0x1E, 0x06, 0xBC, 0xF9,
+    0x06, 0xA2, 0x85, 0x8C, 0xBC, 0x99, 0xB1, 0x78, 0x4C, 0x33, 0xC6, 0xC8, 0x92, 0x97, 0x9F, 0x62,
+    0xF1, 0x2A, 0xCA, 0xF7, 0x41, 0x24, 0x2B, 0x93, 0x1D, 0xEA, 0xA2, 0x28, 0xE9, 0xF1, 0x3F, 0xE0,
+    0x04, 0xC5, 0x16, 0xD4, 0x37, 0xCA, 0x1D, 0x29, 0x5F, 0x69, 0x6F, 0x92, 0x2B, 0xAE, 0x2C, 0xED,
+    0xF9, 0xBC, 0x47, 0xD3, 0x61, 0x66, 0x01, 0x87, 0x2C, 0x70, 0x98, 0xC4, 0x31, 0xF4, 0x69, 0xF0,
+    0xE0, 0x92, 0x1F, 0x9F, 0x9D, 0xA6, 0xFE, 0xD9, 0xE9, 0x70, 0x07, 0xF2, 0x20, 0x9D, 0xC2, 0x0F,
+    0x98, 0xE0, 0x25, 0xFE, 0x46, 0xBB, 0x6B, 0x1D, 0xF5, 0x7E, 0xA4, 0x64, 0xF8, 0x6D, 0x16, 0x6F,
+    0x07, 0xA9, 0x65, 0x31, 0x0F, 0xC2, 0x17, 0x34, 0x7F, 0x42, 0x69, 0x64, 0x23, 0x14, 0xB5, 0x57,
+    0x6F, 0x82, 0x3A, 0xF7, 0x5A, 0xFA, 0xB2, 0xF0, 0x15, 0xA7, 0x64, 0x27, 0x0A, 0xF8, 0x02, 0xE5,
+    0xE6, 0x36, 0x79, 0xE2, 0x32, 0xD3, 0x6E, 0x65, 0x6C, 0x9D, 0x6E, 0xA1, 0xF0, 0x55, 0x93, 0x6E,
+    0x24, 0x0B, 0xCA, 0x15, 0xEE, 0x2E, 0x59, 0x10, 0x8A, 0x6C, 0xCD, 0x91, 0x77, 0xC8, 0xFF, 0xB8,
+    0x15, 0x56, 0xA6, 0x36, 0x7F, 0xD2, 0xB2, 0x58, 0x45, 0x60, 0xA5, 0x7A, 0xC8, 0x96, 0x14, 0xA0,
+    0xC2, 0xFD, 0xC1, 0xA5, 0xA5, 0x3C, 0x45, 0xF2, 0xC4, 0x28, 0x13, 0x11, 0x32, 0x64, 0xC9, 0xE6,
+    0x5B, 0xD2, 0x9A, 0x19, 0xFD, 0xF4, 0xC2, 0x51, 0xBD, 0x0C, 0x88, 0x41, 0xD3, 0x9A, 0x88, 0x26,
+    0xB0, 0xC2, 0x37, 0x5E, 0x1D, 0x3B, 0xC3, 0x6F, 0x63, 0x4D, 0x44, 0x08, 0x07, 0xAB, 0x8F, 0x62,
+    0x07, 0x51, 0x59, 0x32, 0x08, 0xCA, 0x1E, 0xFB, 0x0D, 0xF8, 0x95, 0xC1, 0x9F, 0x2B, 0xA4, 0x0D,
+    0x5E, 0x5C, 0x70, 0x3E, 0xB4, 0x9C, 0xA6, 0xD1, 0xF6, 0x66, 0xCC, 0x62, 0xD6, 0x57, 0x6E, 0xAA,
+    0x38, 0xAA, 0x1A, 0xE5, 0x16, 0xF2, 0xDD, 0x37, 0xA0, 0x89, 0x2B, 0x19, 0x62, 0x07, 0x9A, 0xCA,
+    0xA1, 0x9C, 0x87, 0x81, 0x03, 0xB0, 0x3E, 0x92, 0xF4, 0xF9, 0xE0, 0xF5, 0xB1, 0xD7, 0x73, 0x47,
+    0x40, 0x75, 0x0F, 0xB2, 0xCA, 0xA6, 0xB4, 0x9B, 0x9D, 0x6F, 0x39, 0x67, 0x9A, 0x43, 0xE3, 0xC9,
+    0x91, 0x7A, 0x55, 0xE1, 0x0D, 0x83, 0x66, 0x8B, 0x7E, 0x05, 0xED, 0x90, 0x5B, 0xE1, 0x84, 0x4B,
+    0x7D, 0xD3, 0xF3, 0x6F, 0x6E, 0x2F, 0xFF, 0x4A, 0xFD, 0xDE, 0x69, 0xB3, 0xDD, 0x3B, 0x1D, 0xEE,
+    0x40, 0x16, 0xA5, 0x57, 0x78, 0x44, 0xC0, 0x06, 0xC0, 0xDC, 0xAE, 0xA9, 0x37, 0xD9, 0xE1, 0x25,
+    0x5B, 0x0C, 0xBC, 0xB9, 0xED, 0x00, 0x0B, 0x3F, 0xD8, 0x81, 0x44, 0x7D, 0x4B, 0x62, 0x10, 0x3A,
+    0x2A, 0xCE, 0x9E, 0x29, 0x2C, 0x4A, 0x4C, 0x57, 0xEC, 0xE5, 0x7B, 0x63, 0xE4, 0x3D, 0xE5, 0x8E,
+    0x4A, 0xD9, 0x69, 0x8D, 0x66, 0x8D, 0x05, 0x30, 0xBD, 0xCB, 0x54, 0xEF, 0x5C, 0x20, 0x5F, 0x33,
+    0xCF, 0x8A, 0x97, 0xD8, 0x05, 0x85, 0xC6, 0x74, 0x06, 0xB3, 0xC6, 0x9D, 0x13, 0xE4, 0xF1, 0x3A,
+    0xFF, 0xD8, 0xE2, 0x93, 0x47, 0x63, 0xB1, 0x62, 0xF2, 0xF2, 0xB5, 0xD3, 0x4F, 0xFD, 0x1E, 0x1D,
+    0xCC, 0x35, 0x8B, 0x47, 0xA7, 0x32, 0xBB, 0x62, 0x51, 0x17, 0x15, 0xD6, 0x0B, 0x2E, 0x71, 0xDF,
+    0x22, 0x27, 0xF0, 0x11, 0x22, 0x40, 0xDE, 0x38, 0x99, 0x02, 0x9D, 0x0C, 0x75, 0x1E, 0x94, 0x60,
+    0xC7, 0x1D, 0xEE, 0x1C, 0x37, 0x1E, 0x7D, 0x33, 0xE7, 0x9F, 0xB6, 0xF8, 0x37, 0xA8, 0x39, 0xD4,
+    0x86, 0x43, 0x2F, 0x71, 0x58, 0x82, 0x2C, 0x39, 0x1E, 0xD9, 0xBC, 0x15, 0x51, 0xD0, 0x21, 0x96,
+    0xEC, 0xDF, 0x2F, 0xDF, 0x00, 0x2A, 0xF3, 0xE7, 0xDF, 0x63, 0x91, 0x3E, 0x74, 0xC5, 0xAB, 0xB6,
+    0x53, 0xE7, 0xB1, 0xA3, 0xAD, 0x5B, 0x4D, 0xFB, 0x94, 0xC5, 0x6F, 0xB1, 0xA2, 0xBF, 0x1A, 0x8F,
+    0x32, 0xFB, 0xDD, 0x8C, 0x39, 0x94, 0xC7, 0x6E, 0x30, 0xF8, 0x99, 0xA6, 0xC3, 0x8D, 0xF5, 0x21,
+    0x4E, 0x68, 0xF9, 0xFC, 0x73, 0x56, 0x4F, 0xA2, 0x12, 0x81, 0xCF, 0xC1, 0x9C, 0x4D, 0x77, 0xF4,
+    0x0B, 0xCE, 0xC0, 0x71, 0x0D, 0xC8, 0xB5, 0x5E, 0x96, 0xD0, 0x41, 0x76, 0xD8, 0x9C, 0x6C, 0x9A,
+    0x6E, 0xDF, 0x66, 0x56, 0xBA, 0xB2, 0xAB, 0x3B, 0x8D, 0x43, 0xFA, 0x0C, 0x4D, 0x30, 0xB5, 0xC6,
+    0xDF, 0xB7, 0xFF, 0x03, 0x4D, 0x56, 0xBF, 0x6F, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0x2D, 0x31, 0x35,
+    0x81, 0xDC, 0x0E, 0xE9, 0xD0, 0xB8, 0x15, 0x33, 0xB7, 0x71, 0xB8, 0x7A, 0x70, 0x7C, 0xAF, 0xAC,
+    0x21, 0xE3, 0x13, 0x02, 0xA8, 0x19, 0xD3, 0x3F, 0xA0, 0x40, 0x96, 0x0C, 0x19, 0xEA, 0x5E, 0xCA,
+    0x06, 0xBA, 0x78, 0xC8, 0x9B, 0x32, 0xA6, 0x1E, 0x32, 0x04, 0x6E, 0x01, 0x65, 0x08, 0x50, 0x07,
+    0x90, 0x4D, 0xDA, 0x1A, 0x34, 0x08, 0x81, 0x08, 0x18, 0x48, 0x86, 0x02, 0x15, 0xF3, 0x0B, 0x41,
+    0xAA, 0x41, 0x57, 0x0A, 0x8D, 0xD0, 0xCF, 0x97, 0x3C, 0xFD, 0xCE, 0xE5, 0x53, 0x62, 0xE2, 0x9D,
+    0xC3, 0xF7, 0xF8, 0x78, 0xCF, 0xCF, 0xEF, 0x3B, 0xF7, 0x12, 0xE1, 0xB2, 0x3D, 0x25, 0xDC, 0x93,
+    0xE2, 0x8E, 0xF2, 0xF6, 0xD7, 0xA4, 0x6B, 0x3C, 0x5A, 0xDF, 0xDA, 0xB4, 0x19, 0xB7, 0x95, 0xE2,
+    0xA6, 0x52, 0xDF, 0x19, 0x3B, 0xAB, 0x49, 0x33, 0x9B, 0x82, 0x99, 0x52, 0x08, 0x69, 0x59, 0x07,
+    0xA9, 0x86, 0x49, 0xD8, 0xE3, 0x87, 0xFA, 0x3D, 0xD1, 0xDA, 0xAB, 0xB4, 0x8A, 0x1F, 0x9A, 0x07,
+    0x62, 0xF6, 0x09, 0x9F, 0x76, 0xD9, 0xF0, 0x75, 0xAD, 0xCE, 0xF6, 0xCA, 0xE2, 0xF1, 0x6D, 0xA3,
+    0x0F, 0x66, 0xA4, 0x0F, 0xD7, 0x48, 0x7F, 0xF8, 0x2A, 0xE9, 0x7F, 0x5D, 0x25, 0xED, 0x3F, 0x25,
+    0xDD, 0x9D, 0x52, 0x3E, 0x32, 0xFC, 0x33, 0xE2, 0x80, 0x1C, 0xCD, 0x29, 0x9D, 0x11, 0xAD, 0xAC,
+    0xD0, 0x74, 0xAD, 0xF2, 0xB7, 0xB0, 0xE7, 0x27, 0x7B, 0xE6, 0xD3, 0x14, 0xAE, 0x94, 0x23, 0xC4,
+    0x4A, 0x54, 0x3C, 0x3C, 0x75, 0xFA, 0xD1, 0x4F, 0xAD, 0xDE, 0xE3, 0x46, 0xDF, 0xEA, 0x49, 0xDF,
+    0x72, 0xA4, 0xF7, 0x21, 0x07, 0x2D, 0x15, 0x27, 0x5F, 0x04, 0x9B, 0x12, 0x6F, 0x84, 0x70, 0xC2,
+    0xA5, 0x91, 0xA8, 0x45, 0xA2, 0x15, 0x84, 0xB7, 0x36, 0x69, 0x24, 0x8A, 0xF0, 0x57, 0x0C, 0x9B,
+    0xF1, 0x78, 0xD7, 0xC0, 0x7F, 0x09, 0x31, 0xE9, 0xD3, 0x2D, 0xCA, 0xC4, 0xC7, 0x13, 0x83, 0x57,
+    0x6B, 0x48, 0x49, 0x79, 0x03, 0x7F, 0xA8, 0x8D, 0xD4, 0x67, 0x79, 0xD9, 0xA7, 0x58, 0x26, 0xE5,
+    0x48, 0xC5, 0xBE, 0xEA, 0x5E, 0x80, 0x42, 0x54, 0xE1, 0xD5, 0xB8, 0xFA, 0xDF, 0x5C, 0xF2, 0x69,
+    0xE4, 0x5B, 0x89, 0x65, 0x90, 0x0C, 0xE6, 0x25, 0x26, 0x83, 0x82, 0xD1, 0xE4, 0x99, 0xD2, 0x0E,
+    0x0A, 0x75, 0x6D, 0xA5, 0xC0, 0x8D, 0xA8, 0xC9, 0xFE, 0x47, 0xA2, 0x62, 0x27, 0x3A, 0xAD, 0x29,
+    0xBA, 0xF3, 0x40, 0x8D, 0x94, 0xFC, 0xC8, 0x27, 0x08, 0xF0, 0x19, 0xE3, 0xA5, 0x74, 0xCC, 0x87,
+    0xA2, 0xC9, 0xBC, 0xEA, 0xF2, 0x46, 0x39, 0xE5, 0xF2, 0x1A, 0xD2, 0x14, 0xB5, 0x6A, 0x8B, 0x5A,
+    0xD7, 0x79, 0xA3, 0x6B, 0x5D, 0x16, 0x35, 0x97, 0xD6, 0xE8, 0x47, 0xD0, 0x28, 0x0D, 0x9B, 0x8A,
+    0xF4, 0x8C, 0xE1, 0xDA, 0x16, 0x2C, 0x99, 0xBF, 0x1E, 0x1C, 0xF5, 0xA2, 0xA2, 0x36, 0x7C, 0xAF,
+    0x68, 0x97, 0xD8, 0xF4, 0x11, 0xAF, 0x77, 0x22, 0x31, 0xDF, 0x74, 0xC9, 0xF1, 0x2D, 0x77, 0x89,
+    0x8F, 0x7B, 0x84, 0xE8, 0xB3, 0xFF, 0x1C, 0x34, 0xD9, 0xFE, 0x61, 0x6D, 0x99, 0x9D, 0x48, 0xBE,
+    0x71, 0x64, 0x8A, 0xE4, 0x84, 0x74, 0xC2, 0x90, 0x91, 0xAE, 0x41, 0x6E, 0x24, 0x43, 0x80, 0x14,
+    0x2E, 0xC9, 0x56, 0x34, 0xAA, 0x41, 0xC3, 0x3B, 0x48, 0x25, 0xF2, 0x52, 0xD4, 0x18, 0xFA, 0x1E,
+    0x25, 0xBD, 0x3A, 0xED, 0x28, 0xE9, 0xF2, 0x6F, 0x9E, 0x98, 0x74, 0xC1, 0x47, 0xC8, 0x88, 0xD9,
+    0x72, 0x99, 0xF1, 0x80, 0x1A, 0xAA, 0xC5, 0xA6, 0x6A, 0x48, 0x3E, 0x35, 0xE5, 0xE1, 0x53, 0x84,
+    0x0F, 0xAA, 0x58, 0xFC, 0x20, 0x3A, 0x1F, 0x49, 0x1B, 0xCA, 0x86, 0xF3, 0x56, 0x00, 0x23, 0xC1,
+    0x97, 0xE4, 0x12, 0x4A, 0x18, 0x0F, 0x16, 0x7E, 0x13, 0x9F, 0x37, 0xD5, 0x3C, 0xE9, 0xF3, 0xC7,
+    0xDC, 0x25, 0x5D, 0x71, 0xC4, 0x2E, 0x75, 0xF6, 0xB0, 0xD9, 0x44, 0x27, 0x66, 0x30, 0x0E, 0x5F,
+    0x9D, 0x00, 0x3F, 0x1B, 0x29, 0xFF, 0x12, 0xE9, 0x96, 0xC5, 0x1E, 0xF0, 0x51, 0x17, 0x7B, 0x1E,
+    0x2E, 0xF5, 0x4D, 0x6F, 0xA0, 0xB7, 0xFD, 0x67, 0x55, 0x6D, 0xD7, 0x87, 0x4A, 0xEA, 0x37, 0xDA,
+    0x73, 0x8F, 0x49, 0x93, 0x97, 0x37, 0xD2, 0x46, 0x97, 0xBB, 0xA2, 0x7C, 0xDA, 0x54, 0xDB, 0x5D,
+    0x5A, 0xF3, 0x86, 0x4B, 0x1F, 0x3E, 0xDB, 0x68, 0xB3, 0xBD, 0x93, 0x37, 0x9A, 0x6C, 0xEF, 0x70,
+    0x56, 0xA3, 0xA1, 0xA1, 0x58, 0xEC, 0xD4, 0x91, 0xD2, 0xA4, 0x76, 0xD4, 0x0D, 0x52, 0xF7, 0xD5,
+    0x2E, 0x29, 0xAF, 0x40, 0xBA, 0x3E, 0x47, 0x00, 0x5D, 0xEE, 0x00, 0x69, 0x00, 0x5A, 0x35, 0xB9,
+    0xB0, 0x8F, 0xCB, 0xB4, 0x11, 0x88, 0x66, 0x8D, 0x80, 0x1E, 0x25, 0xF0, 0x34, 0xAA, 0x3A, 0xF2,
+    0x2F, 0xD9, 0xBC, 0x8E, 0xFB, 0xC1, 0x16, 0x65, 0xDC, 0xF9, 0xBF, 0x69, 0x93, 0x9C, 0xFA, 0x07,
+    0x9A, 0x92, 0xB3, 0x7E, 0xD0, 0x94, 0x9E, 0xE1, 0x11, 0x65, 0xDF, 0x9C, 0xFA, 0xFB, 0xA4, 0x1E,
+    0x9F, 0xF6, 0x03, 0xA9, 0x7D, 0x3C, 0x22, 0x75, 0xF0, 0xD5, 0x9B, 0x3D, 0xE5, 0xEF, 0x37, 0x00,
+    0x5A, 0x31, 0x5B, 0x54, 0xAD, 0x60, 0x00, 0x8D, 0xD1, 0x39, 0x3F, 0x0D, 0x89, 0x0C, 0x4B, 0x24,
+    0x86, 0xB2, 0x45, 0xF2, 0x57, 0xF4, 0x96, 0xFC, 0x93, 0x00, 0x98, 0xF6, 0x4B, 0x27, 0x8F, 0x9C,
+    0x00, 0x19, 0xD1, 0xF5, 0x05, 0x54, 0x0B, 0x74, 0x17, 0x4D, 0xE8, 0x08, 0x94, 0xC0, 0x4C, 0x94,
+    0x81, 0x02, 0xAE, 0x65, 0x40, 0xA0, 0xA0, 0x15, 0x40, 0x3B, 0x5C, 0xA3, 0xE7, 0x2E, 0x21, 0x5D,
+    0x60, 0xDD, 0xF2, 0xAA, 0xBE, 0x05, 0x69, 0x50, 0x65, 0x3C, 0xD1, 0xCD, 0x9F, 0x85, 0x0E, 0x11,
+    0x10, 0x99, 0x8D, 0x1F, 0xC3, 0x84, 0xA7, 0x4B, 0xB8, 0x0B, 0x31, 0x34, 0x5C, 0x5B, 0x78, 0x16,
+    0xD8, 0x88, 0xA4, 0x7D, 0x14, 0x66, 0x44, 0x24, 0x6E, 0xEC, 0xB8, 0x34, 0x45, 0x95, 0x21, 0x8E,
+    0xF0, 0x64, 0x4C, 0x3C, 0x52, 0x41, 0x4B, 0x23, 0x8F, 0x48, 0x63, 0x6F, 0x4B, 0x00, 0x00, 0xCF,
+    0x93, 0x85, 0x17, 0x5B, 0x30, 0x64, 0x05, 0x8D, 0x39, 0x0F, 0x86, 0xD4, 0x99, 0xCC, 0x91, 0xAF,
+    0x06, 0x61, 0x2B, 0x0B, 0xB3, 0x65, 0xAA, 0xD5, 0xB0, 0xA4, 0x4B, 0x2C, 0xD3, 0x06, 0x34, 0x4F,
+    0x05, 0xF2, 0xD2, 0x00, 0xE6, 0x7E, 0xE5, 0xED, 0x27, 0x9B, 0x58, 0x23, 0xC9, 0x19, 0xCA, 0xB1,
+    0x0A, 0x0E, 0x64, 0x14, 0xC4, 0xFC, 0x5F, 0x81, 0x11, 0xFD, 0xCA, 0xE2, 0x37, 0x56, 0xC7, 0x30,
+    0x03, 0x6C, 0xD2, 0x6B, 0xCF, 0x4D, 0x96, 0xE5, 0x75, 0x69, 0xC2, 0xA8, 0xE5, 0x71, 0x9A, 0x44,
+    0x81, 0xE8, 0x2F, 0x91, 0x2C, 0xA4, 0xE8, 0x63, 0x19, 0x69, 0x78, 0x3B, 0x15, 0xE6, 0x24, 0x7D,
+    0xE2, 0x43, 0x07, 0xC2, 0x2D, 0x75, 0xE1, 0x96, 0xB9, 0xA4, 0x5F, 0x9D, 0x03, 0x27, 0x69, 0x0F,
+    0x10, 0xAA, 0x36, 0x73, 0x28, 0x82, 0x6A, 0xD4, 0x59, 0x5F, 0x08, 0x4C, 0x1F, 0xBB, 0xDC, 0x14,
+    0x8F, 0xF8, 0x96, 0x2B, 0x8C, 0xE6, 0x11, 0x28, 0x87, 0x87, 0x2E, 0x83, 0x2F, 0x3B, 0x1A, 0x75,
+    0x12, 0xF8, 0xA8, 0xA6, 0xC9, 0x92, 0x2F, 0x6F, 0x65, 0xB8, 0x15, 0x66, 0x1A, 0x8C, 0xF4, 0xFC,
+    0x4D, 0xAE, 0xC0, 0x2D, 0x2D, 0x84, 0x92, 0xE9, 0x47, 0x8C, 0xF7, 0xA3, 0x21, 0x28, 0x2C, 0x89,
+    0x80, 0x38, 0xA8, 0x07, 0xB4, 0x1C, 0xFD, 0x2C, 0xD1, 0x57, 0x20, 0xDC, 0x2B, 0x16, 0xD6, 0xDF,
+    0x15, 0xF5, 0x14, 0x95, 0x0E, 0xB0, 0xC9, 0xF8, 0xB0, 0xA5, 0xBC, 0x40, 0x82, 0xAF, 0xFF, 0x4E,
+    0xB2, 0xBC, 0x10, 0x52, 0x0D, 0x4A, 0x66, 0x78, 0x22, 0xF3, 0x21, 0x11, 0x17, 0xB1, 0x78, 0xC4,
+    0x80, 0x46, 0x77, 0x0D, 0xC6, 0x6A, 0x9D, 0x78, 0xE0, 0x0C, 0xF5, 0x97, 0xD1, 0x93, 0x3A, 0xD5,
+    0x14, 0x8B, 0x9D, 0x56, 0x0B, 0x91, 0x5A, 0x36, 0x78, 0x0E, 0xA4, 0xF4, 0x90, 0x79, 0x18, 0xAD,
+    0x00, 0xE0, 0xB4, 0x21, 0xD1, 0x34, 0x5B, 0x97, 0xD7, 0x5A, 0xD8, 0x3F, 0xFA, 0x50, 0x6E, 0xB1,
+    0x3B, 0xC0, 0x93, 0xFF, 0x0B, 0xB8, 0x77, 0x0F, 0xCE, 0x9D, 0x20, 0xAC, 0x71, 0xD2, 0x47, 0x28,
+    0xBB, 0x8D, 0x4C, 0xEC, 0x75, 0xA8, 0x6A, 0x23, 0x28, 0x8C, 0x82, 0xEA, 0x8D, 0xFD, 0x8E, 0xEC,
+    0xFE, 0x6D, 0xEC, 0x28, 0xC7, 0x33, 0x37, 0x8D, 0xE9, 0x4C, 0x54, 0xE0, 0x09, 0xBD, 0x26, 0x2E,
+    0x2E, 0x4F, 0x65, 0x94, 0x74, 0x74, 0xA8, 0x82, 0x5B, 0xD6, 0x23, 0x16, 0x95, 0xFC, 0x04, 0x27,
+    0xD9, 0x8F, 0x9D, 0x94, 0x82, 0xDB, 0xD5, 0xEA, 0x78, 0x04, 0xB8, 0x6E, 0xF6, 0x08, 0xEA, 0x9F,
+    0xE8, 0x0B, 0x9E, 0x95, 0xE9, 0xF0, 0x27, 0x44, 0xD5, 0x47, 0x1E, 0x1D, 0x86, 0x52, 0x2D, 0x60,
+    0x83, 0x49, 0x37, 0x10, 0x60, 0xB8, 0x1C, 0x36, 0xC5, 0x38, 0xB1, 0x53, 0x3C, 0x7F, 0x94, 0x2F,
+    0xB9, 0xA0, 0xDC, 0x1F, 0xEE, 0x56, 0x1D, 0xF2, 0xEA, 0xA2, 0xB0, 0xCB, 0xC9, 0xA6, 0xC6, 0x0E,
+    0xD2, 0xCA, 0x0E, 0x15, 0x6A, 0x52, 0xBF, 0x8C, 0x90, 0x47, 0xE0, 0x73, 0x44, 0x30, 0xFD, 0xB2,
+    0x24, 0xB9, 0x6C, 0x57, 0xB2, 0xDB, 0x78, 0xAC, 0xEB, 0x13, 0xDE, 0xFD, 0x44, 0xF5, 0xEF, 0xA1,
+    0x18, 0xF7, 0xC0, 0xEA, 0x2E, 0x94, 0x42, 0x6F, 0x83, 0x75, 0xD7, 0x41, 0x96, 0xEB, 0x0D, 0xD9,
+    0x0D, 0x91, 0x1A, 0x45, 0x00, 0xD7, 0x8F, 0xFF, 0x4E, 0x52, 0xF7, 0xEC, 0x7C, 0x47, 0x85, 0xA9,
+    0x50, 0x83, 0xDF, 0xCA, 0x6E, 0x75, 0x2D, 0x42, 0xA6, 0xF7, 0x13, 0x07, 0x57, 0x3B, 0x8B, 0x32,
+    0x97, 0x3D, 0xAA, 0x10, 0x95, 0xF4, 0x45, 0x03, 0x32, 0x23, 0xA5, 0xD4, 0x21, 0xB2, 0xCC, 0x21,
+    0x34, 0xE5, 0x2C, 0x18, 0xD8, 0x5A, 0x21, 0x5F, 0xF5, 0x33, 0xF9, 0xE4, 0xDC, 0x50, 0x56, 0x5E,
+    0xC8, 0xD7, 0x3F, 0x3F, 0x3B, 0x10, 0xEF, 0x5C, 0x3A, 0x18, 0x26, 0x08, 0x32, 0xE7, 0xF5, 0xF9,
+    0xB4, 0x77, 0x4E, 0x2A, 0xB4, 0x3B, 0x90, 0xC9, 0xCA, 0x78, 0x11, 0x72, 0xA2, 0xDA, 0xE1, 0xA1,
+    0x59, 0x7B, 0x79, 0x4D, 0x1B, 0xCB, 0x95, 0x36, 0xFF, 0x3E, 0x38, 0xB4, 0x64, 0x0F, 0x66, 0x23,
+    0x4A, 0xB2, 0x23, 0xA7, 0x1D, 0xC0, 0x4E, 0xE5, 0x68, 0xDE, 0xDA, 0x65, 0x28, 0x84, 0xDB, 0x16,
+    0x93, 0x34, 0xBF, 0xD9, 0xDA, 0x32, 0x13, 0x51, 0xB9, 0x44, 0x39, 0x0D, 0xCB, 0x86, 0x2D, 0xF6,
+    0xCE, 0x29, 0xBD, 0xA4, 0xB5, 0xB0, 0x32, 0xE9, 0xA7, 0x1D, 0x3C, 0xEB, 0x96, 0x03, 0x0A, 0x09,
+    0x67, 0x41, 0xEA, 0x00, 0xF1, 0x8B, 0x3B, 0x8B, 0x50, 0xB2, 0x95, 0xB7, 0xF1, 0x42, 0x21, 0xDB,
+    0x3B, 0xDA, 0x3F, 0x9E, 0xB7, 0x67, 0x3A, 0x29, 0x08, 0x13, 0xC4, 0x86, 0xD8, 0x9B, 0x28, 0x40,
+    0xBF, 0x60, 0x79, 0x5C, 0xC5, 0xEF, 0xA9, 0x7D, 0x05, 0xFE, 0xD3, 0x00, 0x6F, 0x22, 0x03, 0x52,
+    0x66, 0x19, 0xD6, 0xEC, 0xB8, 0x8B, 0x73, 0xD5, 0x62, 0x0A, 0x60, 0xD7, 0x57, 0x8D, 0x2D, 0xF3,
+    0x47, 0x42, 0x8B, 0x21, 0x0C, 0x4E, 0xCD, 0xE6, 0x17, 0x32, 0xC3, 0x47, 0xB1, 0x4B, 0x74, 0xF5,
+    0x2A, 0xD1, 0x5F, 0x21, 0xF6, 0xC1, 0xDD, 0x39, 0xA0, 0xE3, 0x11, 0xDB, 0x18, 0x2D, 0xEE, 0x56,
+    0x84, 0x0D, 0x88, 0xCE, 0x3E, 0x7F, 0x11, 0x90, 0xB8, 0x1C, 0x8F, 0xCF, 0x7C, 0xEC, 0xB6, 0xEF,
+    0x48, 0x5C, 0xBA, 0xBF, 0x40, 0x17, 0xA4, 0xD5, 0x68, 0x0B, 0x15, 0xE7, 0xB3, 0x2C, 0xF2, 0xB4,
+    0x9C, 0x6C, 0xF1, 0x34, 0xAE, 0x96, 0xDB, 0x45, 0xB4, 0x33, 0x1A, 0x49, 0x37, 0x40, 0xD1, 0xC7,
+    0xFC, 0x8F, 0xEF, 0x31, 0x91, 0x55, 0xC3, 0x69, 0x97, 0xD7, 0x55, 0xE6, 0x8A, 0xBA, 0x52, 0xAD,
+    0x2E, 0x59, 0x35, 0xDA, 0x8C, 0x98, 0x42, 0x98, 0x24, 0x50, 0x5E, 0xA6, 0xA8, 0x47, 0x41, 0x60,
+    0x26, 0x47, 0xA3, 0x85, 0xD5, 0x72, 0x7C, 0xD4, 0x1F, 0xC8, 0x16, 0x8F, 0xC3, 0x0A, 0xEA, 0x81,
+    0x8D, 0x97, 0x38, 0x19, 0x2E, 0x72, 0x25, 0xC3, 0xD8, 0xA9, 0x40, 0x9B, 0xCD, 0xE0, 0xF8, 0x8F,
+    0xE3, 0x1D, 0xBC, 0x8E, 0xE3, 0xDE, 0x62, 0x1E, 0x2A, 0x19, 0x0E, 0x60, 0x14, 0xC9, 0xE1, 0x31,
+    0x55, 0x92, 0xF9, 0x8B, 0x13, 0x81, 0x84, 0x80, 0xB5, 0x04, 0x07, 0x2C, 0x0F, 0x98, 0x4F, 0xBC,
+    0x7B, 0x05, 0x55, 0xBD, 0xF2, 0x2E, 0xCA, 0x7E, 0xE5, 0x13, 0xA8, 0x57, 0xEE, 0x50, 0x98, 0xBD,
+    0xE1, 0x3C, 0x36, 0x65, 0xF4, 0x73, 0x96, 0xD3, 0x44, 0xD1, 0xDF, 0x85, 0x31, 0xD2, 0x89, 0x72,
+    0x93, 0xA2, 0x68, 0x1D, 0xEF, 0xDD, 0x86, 0xE0, 0xC0, 0x5A, 0x8D, 0x72, 0x00, 0x11, 0x96, 0x36,
+    0xD1, 0xF0, 0x4E, 0x1B, 0x79, 0xE5, 0x62, 0xAF, 0x5A, 0xC1, 0x7F, 0x38, 0x53, 0x22, 0x2F, 0x1C,
+    0x6E, 0x48, 0x9D, 0xB2, 0x40, 0xBF, 0x44, 0x15, 0xCA, 0xBC, 0xB6, 0xA6, 0x78, 0x88, 0xC3, 0x13,
+    0x5A, 0xAC, 0x43, 0xDE, 0xF3, 0x60, 0x2A, 0x45, 0xD0, 0x2B, 0x17, 0x88, 0xFE, 0x0F, 0x63, 0x0D,
+    0xB1, 0xFF, 0x5B, 0xFF, 0xA7, 0xFE, 0x0F, 0x00, 0x4D, 0x8E, 0xB1, 0x11, 0xC3, 0x20, 0x0C, 0x45,
+    0xBF, 0xA1, 0x70, 0xE1, 0x82, 0x01, 0x52, 0xD0, 0xA4, 0x67, 0x04, 0xB3, 0x99, 0x33, 0x42, 0x46,
+    0x48, 0x91, 0x29, 0xD2, 0xC0, 0x08, 0x1E, 0x81, 0x11, 0x28, 0x28, 0x5C, 0x18, 0x94, 0x0F, 0x49,
+    0xEE, 0xA2, 0xE2, 0x9D, 0x4E, 0x27, 0x7D, 0x3D, 0xE0, 0x53, 0x17, 0xB9, 0x93, 0x41, 0x2A, 0x30,
+    0x89, 0x34, 0x40, 0x57, 0xC5, 0x5E, 0x1F, 0xEA, 0x04, 0xE6, 0xA2, 0xDB, 0x03, 0x4B, 0x76, 0x92,
+    0x61, 0xF2, 0xDA, 0x99, 0xE6, 0x02, 0xD8, 0x7D, 0xC9, 0x64, 0x34, 0xA4, 0x8B, 0x26, 0x01, 0x6B,
+    0x34, 0x3B, 0x79, 0xB3, 0x11, 0xD8, 0xBC, 0x23, 0x03, 0x67, 0x80, 0x60, 0x15, 0xA0, 0xC1, 0x91,
+    0x15, 0xA6, 0x61, 0xAA, 0xFD, 0x6B, 0x0F, 0x67, 0xFC, 0xA0, 0x94, 0xC1, 0x34, 0xE8, 0xF1, 0x57,
+    0x8B, 0xEC, 0x3F, 0x37, 0x0C, 0x37, 0x75, 0xF6, 0x73, 0x55, 0x3A, 0xC3, 0xA1, 0xDB, 0x53, 0xCB,
+    0xE9, 0xA4, 0x18, 0x39, 0xE9, 0x66, 0xD2, 0x75, 0x3E, 0x60, 0x13, 0x66, 0x6A, 0x1E, 0xB4, 0xE6,
+    0xBD, 0xA7, 0xA1, 0x92, 0x34, 0x0C, 0xB3, 0x65, 0x9A, 0xC9, 0x74, 0xF3, 0x4B, 0xE7, 0x2B, 0x24,
+    0x5A, 0x05, 0x89, 0x56, 0xB0, 0x35, 0x2E, 0x7F, 0xBF, 0xBE, 0x01, 0x45, 0x8D, 0xC1, 0x0D, 0x80,
+    0x30, 0x0C, 0x03, 0x23, 0xF2, 0xE4, 0x91, 0x01, 0xD8, 0x85, 0xC2, 0x64, 0x88, 0xC9, 0x28, 0x1B,
+    0x74, 0x04, 0x46, 0xE8, 0x07, 0x09, 0xA1, 0x8A, 0x23, 0x11, 0x0F, 0x22, 0xC7, 0x0F, 0x5B, 0xB6,
+    0x45, 0x54, 0xE2, 0x2C, 0x07, 0xA7, 0x1A, 0x4C, 0x73, 0x52, 0x08, 0x79, 0xEA, 0xDD, 0x18, 0xA5,
+    0x73, 0x83, 0x61, 0x6E, 0x21, 0xEF, 0x88, 0xC1, 0x4A, 0x4E, 0x3C, 0x4A, 0xDD, 0xB8, 0x8C, 0x2B,
+    0x51, 0x1D, 0xC6, 0xB1, 0x91, 0x95, 0x33, 0xC2, 0x10, 0x45, 0xE9, 0xC4, 0xB3, 0x56, 0x16, 0xEF,
+    0xD1, 0xB2, 0x44, 0xFF, 0xDD, 0xFE, 0xAD, 0x6F, 0xB7, 0xF3, 0x7F, 0x01,
 };
 
 static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
@@ -1926,99 +1931,99 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 8, 19, 115, 0, 18, 38, 0 }, // !
-    { 10, 7, 181, 2, 18, 18, 38 }, // "
-    { 17, 18, 258, 0, 18, 77, 56 }, // #
-    { 14, 21, 220, 0, 19, 74, 133 }, // $
-    { 20, 20, 342, 1, 19, 100, 207 }, // %
-    { 18, 20, 283, 0, 19, 90, 307 }, // &
-    { 5, 7, 102, 2, 18, 9, 397 }, // '
-    { 11, 22, 136, 0, 18, 61, 406 }, // (
-    { 10, 23, 136, -2, 19, 58, 467 }, // )
-    { 13, 13, 218, 2, 20, 43, 525 }, // *
-    { 13, 13, 229, 1, 15, 43, 568 }, // +
-    { 7, 7, 115, -2, 3, 13, 611 }, // ,
-    { 8, 4, 129, 0, 9, 8, 624 }, // -
-    { 5, 5, 115, 0, 4, 7, 632 }, // .
-    { 15, 19, 170, -2, 18, 72, 639 }, // /
-    { 13, 20, 237, 1, 19, 65, 711 }, // 0
-    { 11, 18, 189, 1, 18, 50, 776 }, // 1
-    { 15, 19, 220, -1, 19, 72, 826 }, // 2
-    { 14, 20, 220, 0, 19, 70, 898 }, // 3
-    { 15, 18, 220, -1, 18, 68, 968 }, // 4
-    { 14, 19, 220, 0, 18, 67, 1036 }, // 5
-    { 14, 20, 228, 0, 19, 70, 1103 }, // 6
-    { 15, 18, 203, 0, 18, 68, 1173 }, // 7
-    { 14, 20, 222, 0, 19, 70, 1241 }, // 8
-    { 13, 20, 222, 1, 19, 65, 1311 }, // 9
-    { 7, 15, 115, 0, 14, 27, 1376 }, // :
-    { 9, 18, 115, -2, 14, 41, 1403 }, // ;
-    { 13, 14, 229, 1, 16, 46, 1444 }, // <
-    { 13, 8, 229, 1, 13, 26, 1490 }, // =
-    { 13, 14, 229, 1, 16, 46, 1516 }, // >
-    { 12, 20, 184, 1, 19, 60, 1562 }, // ?
-    { 21, 21, 342, 1, 18, 111, 1622 }, // @
-    { 17, 18, 251, -2, 18, 77, 1733 }, // A
-    { 16, 18, 248, 0, 18, 72, 1810 }, // B
-    { 16, 20, 245, 1, 19, 80, 1882 }, // C
-    { 17, 18, 271, 0, 18, 77, 1962 }, // D
-    { 15, 18, 217, 0, 18, 68, 2039 }, // E
-    { 15, 18, 213, 0, 18, 68, 2107 }, // F
-    { 16, 20, 276, 1, 19, 80, 2175 }, // G
-    { 18, 18, 280, 0, 18, 81, 2255 }, // H
-    { 12, 18, 153, -1, 18, 54, 2336 }, // I
-    { 13, 24, 134, -4, 18, 78, 2390 }, // J
-    { 18, 18, 245, 0, 18, 81, 2468 }, // K
-    { 12, 18, 207, 0, 18, 54, 2549 }, // L
-    { 23, 18, 352, 0, 18, 104, 2603 }, // M
-    { 20, 18, 303, 0, 18, 90, 2707 }, // N
-    { 17, 20, 292, 1, 19, 85, 2797 }, // O
-    { 16, 18, 244, 0, 18, 72, 2882 }, // P
-    { 17, 24, 292, 1, 19, 102, 2954 }, // Q
-    { 15, 18, 248, 0, 18, 68, 3056 }, // R
-    { 14, 20, 212, 0, 19, 70, 3124 }, // S
-    { 14, 18, 213, 2, 18, 63, 3194 }, // T
-    { 17, 19, 277, 1, 18, 81, 3257 }, // U
-    { 15, 18, 236, 2, 18, 68, 3338 }, // V
-    { 23, 18, 358, 2, 18, 104, 3406 }, // W
-    { 20, 18, 244, -2, 18, 90, 3510 }, // X
-    { 15, 18, 226, 2, 18, 68, 3600 }, // Y
-    { 16, 18, 214, -1, 18, 72, 3668 }, // Z
-    { 11, 22, 132, -1, 18, 61, 3740 }, // [
-    { 7, 19, 170, 2, 18, 34, 3801 }, // <backslash>
-    { 11, 22, 132, -2, 18, 61, 3835 }, // ]
-    { 14, 12, 220, 0, 18, 42, 3896 }, // ^
-    { 12, 2, 160, -3, -2, 6, 3938 }, // _
-    { 6, 5, 130, 3, 20, 8, 3944 }, // `
-    { 14, 15, 237, 1, 14, 53, 3952 }, // a
-    { 14, 20, 238, 0, 19, 70, 4005 }, // b
-    { 12, 15, 194, 1, 14, 45, 4075 }, // c
-    { 15, 20, 238, 1, 19, 75, 4120 }, // d
-    { 13, 15, 223, 1, 14, 49, 4195 }, // e
-    { 16, 26, 150, -3, 20, 104, 4244 }, // f
-    { 15, 20, 238, 0, 14, 75, 4348 }, // g
-    { 14, 19, 242, 0, 19, 67, 4423 }, // h
-    { 9, 20, 120, 0, 20, 45, 4490 }, // i
-    { 13, 26, 120, -4, 20, 85, 4535 }, // j
-    { 16, 19, 227, 0, 19, 76, 4620 }, // k
-    { 9, 19, 120, 0, 19, 43, 4696 }, // l
-    { 22, 14, 362, 0, 14, 77, 4739 }, // m
-    { 14, 14, 242, 0, 14, 49, 4816 }, // n
-    { 13, 15, 234, 1, 14, 49, 4865 }, // o
-    { 15, 20, 238, -1, 14, 75, 4914 }, // p
-    { 14, 20, 238, 1, 14, 70, 4989 }, // q
-    { 12, 14, 169, 0, 14, 42, 5059 }, // r
-    { 12, 15, 190, 0, 14, 45, 5101 }, // s
-    { 10, 18, 164, 1, 17, 45, 5146 }, // t
-    { 14, 15, 242, 1, 14, 53, 5191 }, // u
-    { 14, 14, 205, 1, 14, 49, 5244 }, // v
-    { 20, 14, 315, 1, 14, 70, 5293 }, // w
-    { 17, 14, 214, -2, 14, 60, 5363 }, // x
-    { 17, 20, 208, -2, 14, 85, 5423 }, // y
-    { 13, 14, 188, -1, 14, 46, 5508 }, // z
-    { 12, 22, 142, -1, 18, 66, 5554 }, // {
-    { 4, 25, 220, 5, 19, 25, 5620 }, // |
-    { 11, 22, 142, -2, 18, 61, 5645 }, // }
-    { 13, 5, 229, 1, 11, 17, 5706 }, // ~
+    { 10, 7, 181, 2, 18, 18, 0 }, // "
+    { 17, 18, 258, 0, 18, 77, 18 }, // #
+    { 14, 21, 220, 0, 19, 74, 95 }, // $
+    { 20, 20, 342, 1, 19, 100, 169 }, // %
+    { 18, 20, 283, 0, 19, 90, 269 }, // &
+    { 5, 7, 102, 2, 18, 9, 359 }, // '
+    { 11, 22, 136, 0, 18, 61, 38 }, // (
+    { 10, 23, 136, -2, 19, 58, 99 }, // )
+    { 13, 13, 218, 2, 20, 43, 368 }, // *
+    { 13, 13, 229, 1, 15, 43, 411 }, // +
+    { 7, 7, 115, -2, 3, 13, 157 }, // ,
+    { 8, 4, 129, 0, 9, 8, 170 }, // -
+    { 5, 5, 115, 0, 4, 7, 178 }, // .
+    { 15, 19, 170, -2, 18, 72, 454 }, // /
+    { 13, 20, 237, 1, 19, 65, 185 }, // 0
+    { 11, 18, 189, 1, 18, 50, 250 }, // 1
+    { 15, 19, 220, -1, 19, 72, 300 }, // 2
+    { 14, 20, 220, 0, 19, 70, 372 }, // 3
+    { 15, 18, 220, -1, 18, 68, 442 }, // 4
+    { 14, 19, 220, 0, 18, 67, 510 }, // 5
+    { 14, 20, 228, 0, 19, 70, 577 }, // 6
+    { 15, 18, 203, 0, 18, 68, 647 }, // 7
+    { 14, 20, 222, 0, 19, 70, 715 }, // 8
+    { 13, 20, 222, 1, 19, 65, 785 }, // 9
+    { 7, 15, 115, 0, 14, 27, 850 }, // :
+    { 9, 18, 115, -2, 14, 41, 877 }, // ;
+    { 13, 14, 229, 1, 16, 46, 526 }, // <
+    { 13, 8, 229, 1, 13, 26, 572 }, // =
+    { 13, 14, 229, 1, 16, 46, 598 }, // >
+    { 12, 20, 184, 1, 19, 60, 918 }, // ?
+    { 21, 21, 342, 1, 18, 111, 644 }, // @
+    { 17, 18, 251, -2, 18, 77, 978 }, // A
+    { 16, 18, 248, 0, 18, 72, 1055 }, // B
+    { 16, 20, 245, 1, 19, 80, 1127 }, // C
+    { 17, 18, 271, 0, 18, 77, 1207 }, // D
+    { 15, 18, 217, 0, 18, 68, 1284 }, // E
+    { 15, 18, 213, 0, 18, 68, 1352 }, // F
+    { 16, 20, 276, 1, 19, 80, 1420 }, // G
+    { 18, 18, 280, 0, 18, 81, 1500 }, // H
+    { 12, 18, 153, -1, 18, 54, 1581 }, // I
+    { 13, 24, 134, -4, 18, 78, 1635 }, // J
+    { 18, 18, 245, 0, 18, 81, 1713 }, // K
+    { 12, 18, 207, 0, 18, 54, 1794 }, // L
+    { 23, 18, 352, 0, 18, 104, 1848 }, // M
+    { 20, 18, 303, 0, 18, 90, 1952 }, // N
+    { 17, 20, 292, 1, 19, 85, 2042 }, // O
+    { 16, 18, 244, 0, 18, 72, 2127 }, // P
+    { 17, 24, 292, 1, 19, 102, 2199 }, // Q
+    { 15, 18, 248, 0, 18, 68, 2301 }, // R
+    { 14, 20, 212, 0, 19, 70, 2369 }, // S
+    { 14, 18, 213, 2, 18, 63, 2439 }, // T
+    { 17, 19, 277, 1, 18, 81, 755 }, // U
+    { 15, 18, 236, 2, 18, 68, 2502 }, // V
+    { 23, 18, 358, 2, 18, 104, 2570 }, // W
+    { 20, 18, 244, -2, 18, 90, 2674 }, // X
+    { 15, 18, 226, 2, 18, 68, 2764 }, // Y
+    { 16, 18, 214, -1, 18, 72, 2832 }, // Z
+    { 11, 22, 132, -1, 18, 61, 836 }, // [
+    { 7, 19, 170, 2, 18, 34, 897 }, // <backslash>
+    { 11, 22, 132, -2, 18, 61, 931 }, // ]
+    { 14, 12, 220, 0, 18, 42, 992 }, // ^
+    { 12, 2, 160, -3, -2, 6, 1034 }, // _
+    { 6, 5, 130, 3, 20, 8, 1040 }, // `
+    { 14, 15, 237, 1, 14, 53, 2904 }, // a
+    { 14, 20, 238, 0, 19, 70, 2957 }, // b
+    { 12, 15, 194, 1, 14, 45, 3027 }, // c
+    { 15, 20, 238, 1, 19, 75, 3072 }, // d
+    { 13, 15, 223, 1, 14, 49, 3147 }, // e
+    { 16, 26, 150, -3, 20, 104, 3196 }, // f
+    { 15, 20, 238, 0, 14, 75, 3300 }, // g
+    { 14, 19, 242, 0, 19, 67, 3375 }, // h
+    { 9, 20, 120, 0, 20, 45, 3442 }, // i
+    { 13, 26, 120, -4, 20, 85, 3487 }, // j
+    { 16, 19, 227, 0, 19, 76, 3572 }, // k
+    { 9, 19, 120, 0, 19, 43, 3648 }, // l
+    { 22, 14, 362, 0, 14, 77, 3691 }, // m
+    { 14, 14, 242, 0, 14, 49, 3768 }, // n
+    { 13, 15, 234, 1, 14, 49, 3817 }, // o
+    { 15, 20, 238, -1, 14, 75, 3866 }, // p
+    { 14, 20, 238, 1, 14, 70, 3941 }, // q
+    { 12, 14, 169, 0, 14, 42, 4011 }, // r
+    { 12, 15, 190, 0, 14, 45, 4053 }, // s
+    { 10, 18, 164, 1, 17, 45, 4098 }, // t
+    { 14, 15, 242, 1, 14, 53, 4143 }, // u
+    { 14, 14, 205, 1, 14, 49, 4196 }, // v
+    { 20, 14, 315, 1, 14, 70, 4245 }, // w
+    { 17, 14, 214, -2, 14, 60, 4315 }, // x
+    { 17, 20, 208, -2, 14, 85, 4375 }, // y
+    { 13, 14, 188, -1, 14, 46, 4460 }, // z
+    { 12, 22, 142, -1, 18, 66, 1048 }, // {
+    { 4, 25, 220, 5, 19, 25, 1114 }, // |
+    { 11, 22, 142, -2, 18, 61, 1139 }, // }
+    { 13, 5, 229, 1, 11, 17, 1200 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 8, 19, 114, -1, 14, 38, 0 }, // U+00A1
     { 12, 20, 220, 2, 19, 60, 38 }, // U+00A2
@@ -2102,19 +2107,19 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 15, 21, 231, 0, 20, 79, 5558 }, // U+00F0
     { 15, 19, 242, 0, 19, 72, 5637 }, // U+00F1
     { 13, 21, 236, 1, 20, 69, 5709 }, // U+00F2
-    { 13, 21, 236, 1, 20, 69, 5778 }, // U+00F3
-    { 13, 21, 236, 1, 20, 69, 5847 }, // U+00F4
-    { 14, 20, 236, 1, 19, 70, 5916 }, // U+00F5
-    { 13, 20, 236, 1, 19, 65, 5986 }, // U+00F6
-    { 13, 13, 229, 1, 15, 43, 6051 }, // U+00F7
-    { 14, 17, 234, 0, 15, 60, 6094 }, // U+00F8
-    { 14, 21, 242, 1, 20, 74, 6154 }, // U+00F9
-    { 14, 21, 242, 1, 20, 74, 6228 }, // U+00FA
-    { 14, 21, 242, 1, 20, 74, 6302 }, // U+00FB
-    { 14, 20, 242, 1, 19, 70, 6376 }, // U+00FC
-    { 17, 26, 208, -2, 20, 111, 6446 }, // U+00FD
-    { 15, 25, 238, -1, 19, 94, 6557 }, // U+00FE
-    { 17, 25, 208, -2, 19, 107, 6651 }, // U+00FF
+    { 13, 21, 236, 1, 20, 69, 4506 }, // U+00F3
+    { 13, 21, 236, 1, 20, 69, 5778 }, // U+00F4
+    { 14, 20, 236, 1, 19, 70, 5847 }, // U+00F5
+    { 13, 20, 236, 1, 19, 65, 5917 }, // U+00F6
+    { 13, 13, 229, 1, 15, 43, 5982 }, // U+00F7
+    { 14, 17, 234, 0, 15, 60, 6025 }, // U+00F8
+    { 14, 21, 242, 1, 20, 74, 6085 }, // U+00F9
+    { 14, 21, 242, 1, 20, 74, 6159 }, // U+00FA
+    { 14, 21, 242, 1, 20, 74, 6233 }, // U+00FB
+    { 14, 20, 242, 1, 19, 70, 6307 }, // U+00FC
+    { 17, 26, 208, -2, 20, 111, 6377 }, // U+00FD
+    { 15, 25, 238, -1, 19, 94, 6488 }, // U+00FE
+    { 17, 25, 208, -2, 19, 107, 6582 }, // U+00FF
     { 17, 22, 251, -2, 22, 94, 0 }, // U+0100
     { 14, 19, 237, 1, 18, 67, 94 }, // U+0101
     { 18, 24, 251, -2, 24, 108, 161 }, // U+0102
@@ -2816,98 +2821,98 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 8, 4, 129, 0, 9, 8, 78 }, // U+2010
     { 8, 4, 129, 0, 9, 8, 86 }, // U+2011
     { 14, 4, 220, 0, 11, 14, 94 }, // U+2012
-    { 12, 4, 192, 0, 9, 12, 108 }, // U+2013
-    { 24, 4, 384, 0, 9, 24, 120 }, // U+2014
-    { 24, 4, 384, 0, 9, 24, 144 }, // U+2015
-    { 10, 25, 220, 2, 19, 63, 168 }, // U+2016
-    { 12, 6, 160, -3, 0, 18, 231 }, // U+2017
-    { 7, 7, 87, 1, 18, 13, 249 }, // U+2018
-    { 7, 7, 87, 1, 18, 13, 262 }, // U+2019
-    { 7, 7, 112, -2, 3, 13, 275 }, // U+201A
-    { 5, 7, 86, 2, 18, 9, 288 }, // U+201B
-    { 12, 7, 173, 1, 18, 21, 297 }, // U+201C
-    { 12, 7, 173, 1, 18, 21, 318 }, // U+201D
-    { 13, 7, 199, -2, 3, 23, 339 }, // U+201E
-    { 10, 7, 173, 2, 18, 18, 362 }, // U+201F
-    { 11, 19, 206, 2, 19, 53, 380 }, // U+2020
-    { 14, 19, 206, 0, 19, 67, 433 }, // U+2021
-    { 8, 8, 150, 1, 13, 16, 500 }, // U+2022
-    { 8, 10, 141, 1, 14, 20, 516 }, // U+2023
-    { 6, 5, 200, 2, 4, 8, 536 }, // U+2024
-    { 12, 5, 230, 0, 4, 15, 544 }, // U+2025
-    { 19, 5, 333, 0, 4, 24, 559 }, // U+2026
-    { 6, 5, 129, 1, 9, 8, 583 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 591 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 591 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 591 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 626 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 661 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 694 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 727 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 760 }, // U+202F
-    { 29, 20, 487, 1, 19, 145, 760 }, // U+2030
-    { 38, 20, 632, 1, 19, 190, 905 }, // U+2031
-    { 8, 7, 113, 1, 18, 14, 1095 }, // U+2032
-    { 14, 7, 205, 1, 18, 25, 1109 }, // U+2033
-    { 20, 7, 297, 1, 18, 35, 1134 }, // U+2034
-    { 7, 7, 113, 1, 18, 13, 1169 }, // U+2035
-    { 13, 7, 205, 1, 18, 23, 1182 }, // U+2036
-    { 19, 7, 297, 1, 18, 34, 1205 }, // U+2037
-    { 9, 9, 141, -2, 3, 21, 1239 }, // U+2038
-    { 9, 12, 130, 0, 13, 27, 1260 }, // U+2039
-    { 8, 12, 130, 0, 13, 24, 1287 }, // U+203A
-    { 21, 20, 338, 0, 19, 105, 1311 }, // U+203B
-    { 15, 19, 224, 0, 18, 72, 1416 }, // U+203C
-    { 11, 20, 184, 2, 19, 55, 1488 }, // U+203D
-    { 12, 4, 200, 2, 22, 12, 1543 }, // U+203E
-    { 14, 6, 214, -2, 0, 21, 1555 }, // U+203F
-    { 13, 6, 214, 2, 20, 20, 1576 }, // U+2040
-    { 14, 17, 154, -3, 11, 60, 1596 }, // U+2041
-    { 29, 24, 461, -1, 20, 174, 1656 }, // U+2042
-    { 8, 4, 130, 0, 9, 8, 1830 }, // U+2043
-    { 17, 18, 50, -7, 18, 77, 1838 }, // U+2044
-    { 11, 22, 132, -1, 18, 61, 1915 }, // U+2045
-    { 11, 22, 132, -2, 18, 61, 1976 }, // U+2046
-    { 23, 20, 362, 1, 19, 115, 2037 }, // U+2047
-    { 19, 20, 301, 1, 19, 95, 2152 }, // U+2048
-    { 20, 20, 298, 0, 19, 100, 2247 }, // U+2049
-    { 13, 14, 213, 1, 14, 46, 2347 }, // U+204A
-    { 14, 23, 249, 2, 19, 81, 2393 }, // U+204B
-    { 14, 13, 256, 1, 14, 46, 2474 }, // U+204C
-    { 14, 13, 256, 1, 14, 46, 2520 }, // U+204D
-    { 13, 13, 217, -1, 8, 43, 2566 }, // U+204E
-    { 7, 18, 114, 0, 14, 32, 2609 }, // U+204F
-    { 17, 26, 214, -2, 20, 111, 2641 }, // U+2050
-    { 16, 26, 217, -1, 20, 104, 2752 }, // U+2051
-    { 11, 20, 169, 0, 19, 55, 2856 }, // U+2052
-    { 24, 6, 400, 1, 10, 36, 2911 }, // U+2053
-    { 14, 6, 214, -3, 0, 21, 2947 }, // U+2054
-    { 14, 14, 230, 0, 13, 49, 2968 }, // U+2055
-    { 12, 20, 224, 1, 19, 60, 3017 }, // U+2056
-    { 23, 7, 354, 1, 18, 41, 3077 }, // U+2057
-    { 19, 20, 340, 1, 19, 95, 3118 }, // U+2058
-    { 19, 20, 341, 1, 19, 95, 3213 }, // U+2059
-    { 5, 20, 110, 1, 19, 25, 3308 }, // U+205A
-    { 16, 21, 286, 1, 20, 84, 3333 }, // U+205B
-    { 20, 20, 331, 0, 19, 100, 3417 }, // U+205C
-    { 5, 20, 112, 1, 19, 25, 3517 }, // U+205D
-    { 5, 20, 114, 1, 19, 25, 3542 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 3567 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2064
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2066
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2067
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2068
-    { 0, 0, 240, 0, 0, 0, 3567 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 3567 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3600 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3633 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3666 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3699 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3732 }, // U+206F
+    { 12, 4, 192, 0, 9, 12, 4575 }, // U+2013
+    { 24, 4, 384, 0, 9, 24, 4587 }, // U+2014
+    { 24, 4, 384, 0, 9, 24, 108 }, // U+2015
+    { 10, 25, 220, 2, 19, 63, 132 }, // U+2016
+    { 12, 6, 160, -3, 0, 18, 195 }, // U+2017
+    { 7, 7, 87, 1, 18, 13, 213 }, // U+2018
+    { 7, 7, 87, 1, 18, 13, 4611 }, // U+2019
+    { 7, 7, 112, -2, 3, 13, 226 }, // U+201A
+    { 5, 7, 86, 2, 18, 9, 239 }, // U+201B
+    { 12, 7, 173, 1, 18, 21, 4624 }, // U+201C
+    { 12, 7, 173, 1, 18, 21, 4645 }, // U+201D
+    { 13, 7, 199, -2, 3, 23, 248 }, // U+201E
+    { 10, 7, 173, 2, 18, 18, 271 }, // U+201F
+    { 11, 19, 206, 2, 19, 53, 289 }, // U+2020
+    { 14, 19, 206, 0, 19, 67, 342 }, // U+2021
+    { 8, 8, 150, 1, 13, 16, 409 }, // U+2022
+    { 8, 10, 141, 1, 14, 20, 425 }, // U+2023
+    { 6, 5, 200, 2, 4, 8, 445 }, // U+2024
+    { 12, 5, 230, 0, 4, 15, 453 }, // U+2025
+    { 19, 5, 333, 0, 4, 24, 4666 }, // U+2026
+    { 6, 5, 129, 1, 9, 8, 468 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 476 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 476 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 476 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 511 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 546 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 579 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 612 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 645 }, // U+202F
+    { 29, 20, 487, 1, 19, 145, 645 }, // U+2030
+    { 38, 20, 632, 1, 19, 190, 790 }, // U+2031
+    { 8, 7, 113, 1, 18, 14, 980 }, // U+2032
+    { 14, 7, 205, 1, 18, 25, 994 }, // U+2033
+    { 20, 7, 297, 1, 18, 35, 1019 }, // U+2034
+    { 7, 7, 113, 1, 18, 13, 1054 }, // U+2035
+    { 13, 7, 205, 1, 18, 23, 1067 }, // U+2036
+    { 19, 7, 297, 1, 18, 34, 1090 }, // U+2037
+    { 9, 9, 141, -2, 3, 21, 1124 }, // U+2038
+    { 9, 12, 130, 0, 13, 27, 1145 }, // U+2039
+    { 8, 12, 130, 0, 13, 24, 1172 }, // U+203A
+    { 21, 20, 338, 0, 19, 105, 1196 }, // U+203B
+    { 15, 19, 224, 0, 18, 72, 1301 }, // U+203C
+    { 11, 20, 184, 2, 19, 55, 1373 }, // U+203D
+    { 12, 4, 200, 2, 22, 12, 1428 }, // U+203E
+    { 14, 6, 214, -2, 0, 21, 1440 }, // U+203F
+    { 13, 6, 214, 2, 20, 20, 1461 }, // U+2040
+    { 14, 17, 154, -3, 11, 60, 1481 }, // U+2041
+    { 29, 24, 461, -1, 20, 174, 1541 }, // U+2042
+    { 8, 4, 130, 0, 9, 8, 1715 }, // U+2043
+    { 17, 18, 50, -7, 18, 77, 1723 }, // U+2044
+    { 11, 22, 132, -1, 18, 61, 1800 }, // U+2045
+    { 11, 22, 132, -2, 18, 61, 1861 }, // U+2046
+    { 23, 20, 362, 1, 19, 115, 1922 }, // U+2047
+    { 19, 20, 301, 1, 19, 95, 2037 }, // U+2048
+    { 20, 20, 298, 0, 19, 100, 2132 }, // U+2049
+    { 13, 14, 213, 1, 14, 46, 2232 }, // U+204A
+    { 14, 23, 249, 2, 19, 81, 2278 }, // U+204B
+    { 14, 13, 256, 1, 14, 46, 2359 }, // U+204C
+    { 14, 13, 256, 1, 14, 46, 2405 }, // U+204D
+    { 13, 13, 217, -1, 8, 43, 2451 }, // U+204E
+    { 7, 18, 114, 0, 14, 32, 2494 }, // U+204F
+    { 17, 26, 214, -2, 20, 111, 2526 }, // U+2050
+    { 16, 26, 217, -1, 20, 104, 2637 }, // U+2051
+    { 11, 20, 169, 0, 19, 55, 2741 }, // U+2052
+    { 24, 6, 400, 1, 10, 36, 2796 }, // U+2053
+    { 14, 6, 214, -3, 0, 21, 2832 }, // U+2054
+    { 14, 14, 230, 0, 13, 49, 2853 }, // U+2055
+    { 12, 20, 224, 1, 19, 60, 2902 }, // U+2056
+    { 23, 7, 354, 1, 18, 41, 2962 }, // U+2057
+    { 19, 20, 340, 1, 19, 95, 3003 }, // U+2058
+    { 19, 20, 341, 1, 19, 95, 3098 }, // U+2059
+    { 5, 20, 110, 1, 19, 25, 3193 }, // U+205A
+    { 16, 21, 286, 1, 20, 84, 3218 }, // U+205B
+    { 20, 20, 331, 0, 19, 100, 3302 }, // U+205C
+    { 5, 20, 112, 1, 19, 25, 3402 }, // U+205D
+    { 5, 20, 114, 1, 19, 25, 3427 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 3452 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2064
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2066
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2067
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2068
+    { 0, 0, 240, 0, 0, 0, 3452 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 3452 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 3485 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 3518 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 3551 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 3584 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3617 }, // U+206F
     { 9, 12, 152, 2, 22, 27, 0 }, // U+2070
     { 6, 12, 98, 1, 19, 18, 27 }, // U+2071
     { 10, 12, 152, 1, 22, 30, 45 }, // U+2074
@@ -2983,13 +2988,13 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 18, 21, 245, -1, 21, 95, 2579 }, // U+20BE
     { 14, 24, 220, 0, 21, 84, 2674 }, // U+20BF
     { 8, 4, 129, 0, 9, 8, 0 }, // U+2212
-    { 24, 26, 285, -3, 20, 156, 0 }, // U+FB00
-    { 21, 26, 268, -3, 20, 137, 156 }, // U+FB01
-    { 21, 26, 268, -3, 20, 137, 293 }, // U+FB02
-    { 29, 26, 400, -3, 20, 189, 430 }, // U+FB03
-    { 29, 26, 400, -3, 20, 189, 619 }, // U+FB04
-    { 23, 26, 303, -3, 20, 150, 808 }, // U+FB05
-    { 23, 21, 353, 0, 20, 121, 958 }, // U+FB06
+    { 24, 26, 285, -3, 20, 156, 4690 }, // U+FB00
+    { 21, 26, 268, -3, 20, 137, 4846 }, // U+FB01
+    { 21, 26, 268, -3, 20, 137, 4983 }, // U+FB02
+    { 29, 26, 400, -3, 20, 189, 5120 }, // U+FB03
+    { 29, 26, 400, -3, 20, 189, 5309 }, // U+FB04
+    { 23, 26, 303, -3, 20, 150, 0 }, // U+FB05
+    { 23, 21, 353, 0, 20, 121, 150 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -2997,8 +3002,7 @@ static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3006,8 +3010,7 @@ static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3017,19 +3020,57 @@ static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
 };
 
 static const EpdFontGroup notosans_12_bolditalicGroups[] = {
-    { 0, 3144, 6327, 97, 0 },
-    { 3144, 2772, 7582, 96, 97 },
-    { 5916, 3533, 11793, 128, 193 },
-    { 9449, 3584, 10499, 96, 321 },
-    { 13033, 1185, 1760, 112, 417 },
-    { 14218, 9065, 23279, 256, 529 },
-    { 23283, 2138, 10096, 90, 785 },
-    { 25421, 1998, 4208, 111, 875 },
-    { 27419, 799, 1227, 42, 986 },
-    { 28218, 1786, 2976, 32, 1028 },
-    { 30004, 10, 8, 1, 1060 },
-    { 30014, 439, 1166, 7, 1061 },
-    { 30453, 97, 138, 1, 1068 },
+    { 0, 2801, 6047, 83, 2 },
+    { 2801, 760, 1365, 26, 0 },
+    { 3561, 2766, 7498, 95, 97 },
+    { 6327, 3533, 11793, 128, 193 },
+    { 9860, 3584, 10499, 96, 321 },
+    { 13444, 1185, 1760, 112, 417 },
+    { 14629, 9065, 23279, 256, 529 },
+    { 23694, 2138, 10096, 90, 785 },
+    { 25832, 1933, 4091, 105, 875 },
+    { 27765, 799, 1227, 42, 986 },
+    { 28564, 1786, 2976, 32, 1028 },
+    { 30350, 10, 8, 1, 1060 },
+    { 30360, 179, 282, 2, 1066 },
+    { 30539, 97, 138, 1, 1068 },
+};
+
+static const uint16_t notosans_12_bolditalicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_12_bolditalicKernLeftClasses[] = {
@@ -4081,18 +4122,81 @@ static const EpdLigaturePair notosans_12_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_12_bolditalicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 1, 0 }, { 0x0003, 0, 1 }, { 0x0004, 2, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 3, 3 }, { 0x0009, 2, 2 }, // U+0020
+    { 0x000A, 4, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 13, 0 }, { 0x002E, 14, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 15, 0 }, { 0x0033, 10, 10 }, { 0x0034, 16, 0 }, { 0x0035, 0, 13 }, { 0x0036, 17, 14 }, { 0x0037, 18, 15 }, { 0x0038, 19, 16 }, { 0x0039, 19, 16 }, // U+0050
+    { 0x003A, 13, 17 }, { 0x003B, 20, 18 }, { 0x003C, 21, 19 }, { 0x003D, 4, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 22, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 20 }, { 0x0044, 24, 0 }, { 0x0045, 25, 21 }, { 0x0046, 0, 21 }, { 0x0047, 24, 21 }, { 0x0048, 26, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 0, 0 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 27, 0 }, { 0x004E, 0, 0 }, { 0x004F, 0, 25 }, { 0x0050, 0, 25 }, { 0x0051, 24, 21 }, // U+0068
+    { 0x0052, 24, 25 }, { 0x0053, 0, 21 }, { 0x0054, 28, 25 }, { 0x0055, 0, 26 }, { 0x0056, 29, 27 }, { 0x0057, 0, 25 }, { 0x0058, 30, 28 }, { 0x0059, 30, 28 }, // U+0070
+    { 0x005A, 27, 0 }, { 0x005B, 30, 28 }, { 0x005C, 0, 29 }, { 0x005D, 4, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 31, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 32, 30 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 33, 31 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 34, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 32 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 18, 15 }, { 0x009B, 18, 15 }, { 0x009C, 18, 15 }, { 0x009D, 18, 15 }, { 0x009E, 20, 18 }, { 0x009F, 15, 0 }, { 0x00A0, 0, 24 }, // U+00D8
+    { 0x00A1, 23, 21 }, { 0x00A2, 23, 20 }, { 0x00A3, 23, 20 }, { 0x00A4, 23, 20 }, { 0x00A5, 23, 20 }, { 0x00A6, 23, 20 }, { 0x00A7, 24, 20 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 24, 21 }, { 0x00AA, 24, 21 }, { 0x00AB, 24, 21 }, { 0x00AC, 24, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 0, 0 }, { 0x00B0, 35, 0 }, // U+00E8
+    { 0x00B1, 24, 0 }, { 0x00B2, 0, 25 }, { 0x00B3, 24, 21 }, { 0x00B4, 24, 21 }, { 0x00B5, 24, 21 }, { 0x00B6, 24, 21 }, { 0x00B7, 24, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 30, 28 }, { 0x00BF, 24, 0 }, { 0x00C0, 30, 28 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 23, 20 }, { 0x00C3, 7, 9 }, { 0x00C4, 23, 20 }, { 0x00C5, 7, 9 }, { 0x00C6, 23, 20 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 36, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 24, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 24, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 24, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 24, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 24, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 33 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 37, 34 }, { 0x00EB, 0, 0 }, { 0x00EC, 35, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 38, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 24 }, { 0x00F7, 13, 0 }, { 0x00F8, 27, 0 }, // U+0130
+    { 0x00F9, 27, 25 }, { 0x00FA, 14, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 14, 0 }, { 0x00FD, 0, 0 }, { 0x00FE, 14, 0 }, { 0x00FF, 36, 0 }, { 0x0100, 14, 0 }, // U+0138
+    { 0x0101, 0, 0 }, { 0x0102, 14, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 0, 25 }, { 0x0106, 0, 0 }, { 0x0107, 0, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 25 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 25 }, { 0x010D, 10, 10 }, { 0x010E, 24, 21 }, { 0x010F, 10, 10 }, { 0x0110, 24, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 24, 21 }, { 0x0113, 11, 10 }, { 0x0114, 24, 21 }, { 0x0115, 0, 0 }, { 0x0116, 28, 25 }, { 0x0117, 0, 0 }, { 0x0118, 28, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 28, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 26 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 26 }, { 0x0123, 17, 14 }, { 0x0124, 29, 27 }, { 0x0125, 17, 14 }, { 0x0126, 39, 27 }, { 0x0127, 17, 14 }, { 0x0128, 29, 27 }, // U+0160
+    { 0x0129, 18, 15 }, { 0x012A, 0, 25 }, { 0x012B, 18, 15 }, { 0x012C, 0, 25 }, { 0x012D, 18, 15 }, { 0x012E, 0, 25 }, { 0x012F, 18, 15 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 18, 15 }, { 0x0132, 0, 25 }, { 0x0133, 18, 15 }, { 0x0134, 0, 25 }, { 0x0135, 19, 16 }, { 0x0136, 30, 28 }, { 0x0137, 20, 18 }, { 0x0138, 30, 28 }, // U+0170
+    { 0x0139, 20, 18 }, { 0x013A, 21, 19 }, { 0x013B, 0, 29 }, { 0x013C, 21, 19 }, { 0x013D, 0, 29 }, { 0x013E, 21, 19 }, { 0x013F, 0, 29 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 35 }, { 0x0214, 45, 0 }, { 0x0215, 46, 36 }, { 0x0216, 47, 37 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 48, 38 }, { 0x021A, 44, 39 }, { 0x021B, 44, 0 }, { 0x021C, 49, 35 }, { 0x021D, 50, 0 }, { 0x021E, 0, 0 }, { 0x021F, 51, 40 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 52, 41 }, { 0x0222, 53, 0 }, { 0x0223, 54, 0 }, { 0x0224, 45, 0 }, { 0x0225, 55, 42 }, { 0x0226, 0, 0 }, { 0x0227, 50, 43 }, { 0x0228, 54, 44 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 50, 0 }, { 0x022C, 0, 39 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 56, 36 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 57, 0 }, { 0x0232, 46, 36 }, { 0x0233, 45, 35 }, { 0x0234, 51, 40 }, { 0x0235, 58, 45 }, { 0x0236, 50, 43 }, { 0x0237, 55, 0 }, { 0x0238, 0, 46 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 55, 0 }, { 0x023B, 44, 35 }, { 0x023C, 0, 0 }, { 0x023D, 44, 0 }, { 0x023E, 56, 44 }, { 0x023F, 56, 0 }, { 0x0240, 0, 47 }, // U+0428
+    { 0x0241, 59, 48 }, { 0x0242, 60, 49 }, { 0x0243, 61, 48 }, { 0x0244, 62, 50 }, { 0x0245, 63, 51 }, { 0x0246, 62, 48 }, { 0x0247, 64, 52 }, { 0x0248, 61, 50 }, // U+0430
+    { 0x0249, 59, 53 }, { 0x024A, 59, 53 }, { 0x024B, 65, 54 }, { 0x024C, 59, 55 }, { 0x024D, 59, 54 }, { 0x024E, 59, 54 }, { 0x024F, 66, 48 }, { 0x0250, 67, 54 }, // U+0438
+    { 0x0251, 66, 54 }, { 0x0252, 64, 48 }, { 0x0253, 67, 54 }, { 0x0254, 68, 56 }, { 0x0255, 66, 48 }, { 0x0256, 65, 57 }, { 0x0257, 69, 53 }, { 0x0258, 59, 58 }, // U+0440
+    { 0x0259, 59, 53 }, { 0x025A, 69, 53 }, { 0x025B, 70, 59 }, { 0x025C, 59, 53 }, { 0x025D, 70, 53 }, { 0x025E, 66, 52 }, { 0x025F, 66, 54 }, { 0x0260, 59, 60 }, // U+0448
+    { 0x0261, 62, 48 }, { 0x0262, 62, 48 }, { 0x0263, 71, 61 }, { 0x0264, 62, 50 }, { 0x0265, 64, 48 }, { 0x0266, 72, 62 }, { 0x0267, 0, 0 }, { 0x0268, 73, 63 }, // U+0450
+    { 0x0269, 74, 64 }, { 0x026A, 70, 55 }, { 0x026B, 70, 54 }, { 0x026C, 67, 61 }, { 0x026D, 65, 54 }, { 0x026E, 59, 53 }, { 0x026F, 75, 65 }, { 0x0270, 59, 53 }, // U+0458
+};
+
 static const EpdFontData notosans_12_bolditalic = {
     notosans_12_bolditalicBitmaps,
     notosans_12_bolditalicGlyphs,
     notosans_12_bolditalicIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notosans_12_bolditalicGroups,
-    13,
-    nullptr,
+    14,
+    notosans_12_bolditalicGlyphToGroup,
     notosans_12_bolditalicKernLeftClasses,
     notosans_12_bolditalicKernRightClasses,
     notosans_12_bolditalicKernMatrix,
@@ -4102,4 +4206,8 @@ static const EpdFontData notosans_12_bolditalic = {
     83,
     notosans_12_bolditalicLigaturePairs,
     5,
+    notosans_12_bolditalicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,1775 +3,1781 @@
  * name: notosans_12_italic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_italicBitmaps[28205] = {
-    0xA5, 0x58, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0x2D, 0x13, 0x01, 0xA1, 0x9B, 0x2B, 0x64,
-    0x20, 0x90, 0x70, 0x4B, 0x15, 0x2E, 0x02, 0xE5, 0x96, 0x6C, 0x54, 0x6C, 0x00, 0x72, 0x77, 0x80,
-    0x00, 0x49, 0xE1, 0x42, 0x57, 0xE4, 0x9A, 0xA4, 0x50, 0xCA, 0xC0, 0x41, 0xA0, 0x14, 0x87, 0x60,
-    0x03, 0xEC, 0xDD, 0x32, 0x76, 0xE1, 0x42, 0x40, 0xAC, 0x22, 0x42, 0xBA, 0x58, 0x85, 0x0A, 0xE7,
-    0x84, 0x40, 0x17, 0x60, 0x8B, 0x4D, 0x7C, 0xBA, 0xA5, 0x95, 0x42, 0x85, 0x8B, 0x30, 0x3F, 0x86,
-    0x8A, 0x20, 0x32, 0x93, 0xC8, 0x81, 0x11, 0xC7, 0xD6, 0x00, 0xA2, 0xE0, 0x95, 0x74, 0xB7, 0xCC,
-    0xF7, 0x66, 0xC8, 0x5B, 0xEE, 0xE9, 0x24, 0x17, 0xE1, 0xED, 0xF0, 0x76, 0x87, 0x33, 0x6F, 0xDE,
-    0xEF, 0xF7, 0xDE, 0x23, 0x8D, 0x69, 0x4A, 0x85, 0xA5, 0x6C, 0xE5, 0xE4, 0x4E, 0xE6, 0xA4, 0x6E,
-    0xEA, 0x26, 0x9E, 0x14, 0x24, 0x88, 0xAF, 0x98, 0xB6, 0x68, 0x93, 0x96, 0xA9, 0x25, 0x28, 0xF0,
-    0xA9, 0xDD, 0xA2, 0xA8, 0x4D, 0x9D, 0x55, 0x3A, 0xDF, 0xA1, 0xB3, 0xAF, 0x12, 0xD9, 0xE9, 0x79,
-    0x22, 0x27, 0xDD, 0xC0, 0x2D, 0xD9, 0x21, 0x72, 0x65, 0x4E, 0xE4, 0x59, 0x19, 0xBD, 0x7C, 0xF3,
-    0xC6, 0x7F, 0xC8, 0x2B, 0xCB, 0x92, 0x68, 0xD5, 0x4D, 0x88, 0x22, 0x0F, 0xA4, 0x3A, 0x4C, 0x71,
-    0x63, 0x89, 0xA8, 0x57, 0x96, 0xFB, 0x7C, 0x9B, 0x92, 0x95, 0x45, 0x4C, 0xA4, 0xC3, 0x44, 0x76,
-    0x98, 0x88, 0xAA, 0x88, 0x10, 0xE1, 0x27, 0xE1, 0x97, 0xF7, 0x98, 0x68, 0x52, 0xA6, 0xD6, 0xA3,
-    0xDB, 0xD2, 0xB9, 0x9D, 0x92, 0xF3, 0x07, 0x8C, 0xBF, 0x24, 0x64, 0x3F, 0x95, 0x98, 0x07, 0x65,
-    0x51, 0x10, 0x2D, 0xDD, 0x22, 0x3A, 0x19, 0x10, 0xAD, 0x60, 0xAC, 0xC6, 0xF4, 0x8D, 0x98, 0xA9,
-    0xE7, 0xF4, 0xF2, 0x0C, 0x24, 0x7E, 0x5C, 0x91, 0x5A, 0x23, 0x73, 0xB9, 0x53, 0x5A, 0x22, 0xFF,
-    0x16, 0x45, 0x14, 0xB5, 0x68, 0x44, 0xFD, 0x25, 0x2B, 0xA7, 0x9D, 0x25, 0x27, 0x25, 0xB5, 0x02,
-    0xF6, 0xD4, 0x6A, 0x1B, 0xB7, 0xA8, 0xBF, 0x47, 0x6A, 0xE3, 0xE1, 0x03, 0xF9, 0xFB, 0x87, 0x1F,
-    0x7C, 0x33, 0x0D, 0x2F, 0x5F, 0xC0, 0xE3, 0xD6, 0x0A, 0x6E, 0xD1, 0xAA, 0x93, 0xE0, 0xB1, 0x2B,
-    0xED, 0x0C, 0x12, 0xB9, 0x49, 0xB4, 0x04, 0x2D, 0x05, 0x03, 0x10, 0x63, 0x36, 0xE6, 0x97, 0xCB,
-    0x27, 0x87, 0x37, 0xC1, 0xDE, 0xC0, 0x4D, 0x89, 0xC6, 0xD8, 0x4A, 0x23, 0xBE, 0x8D, 0x05, 0xD8,
-    0x8E, 0xB6, 0xF0, 0xB4, 0xC7, 0x1B, 0x86, 0x58, 0x61, 0x3F, 0x4D, 0x4F, 0x90, 0x78, 0x33, 0x0F,
-    0x28, 0xA0, 0x02, 0x5C, 0xD1, 0x60, 0x8A, 0x5B, 0x98, 0x33, 0xD1, 0x94, 0xBA, 0x34, 0xCC, 0xC8,
-    0xFF, 0xF4, 0x89, 0x22, 0xB7, 0x4C, 0xA6, 0x86, 0x7A, 0x2B, 0x68, 0x47, 0x9D, 0xF3, 0x67, 0x21,
-    0x07, 0xD6, 0x50, 0x41, 0x76, 0x0E, 0xED, 0x11, 0x28, 0xFB, 0x44, 0x6D, 0x3D, 0x37, 0xC0, 0x49,
-    0xFC, 0x84, 0x15, 0xD8, 0xFC, 0x60, 0x66, 0x44, 0xD4, 0xD7, 0x6B, 0x56, 0xD8, 0x22, 0xD0, 0x97,
-    0xFE, 0x06, 0x52, 0xE2, 0xB8, 0x0F, 0x28, 0x06, 0xEC, 0x03, 0xBC, 0x61, 0xCC, 0x24, 0x70, 0x16,
-    0x24, 0x12, 0xFA, 0xA0, 0x71, 0x25, 0xAD, 0x30, 0x63, 0x19, 0x23, 0x3E, 0x09, 0xB9, 0xFF, 0x4B,
-    0x64, 0x4D, 0x60, 0xF9, 0xBD, 0xD7, 0xC9, 0xFE, 0x08, 0x8F, 0x2E, 0x83, 0x33, 0x6C, 0x7A, 0x89,
-    0x15, 0x60, 0x61, 0xED, 0x49, 0x96, 0x61, 0x71, 0x9C, 0x9B, 0x6C, 0xCB, 0x61, 0x59, 0x26, 0x47,
-    0xE7, 0xF5, 0xC0, 0x65, 0xC3, 0x33, 0xBD, 0x54, 0xC8, 0x16, 0x33, 0x42, 0xE7, 0xDE, 0xED, 0x4D,
-    0x5F, 0x59, 0xA3, 0x78, 0x6B, 0x73, 0x19, 0xBA, 0x66, 0x27, 0x90, 0x9A, 0x4F, 0xFD, 0x70, 0x6C,
-    0xFC, 0xC6, 0x81, 0x13, 0xB1, 0xEE, 0xF9, 0x91, 0xAF, 0xFD, 0xF8, 0xF0, 0x11, 0x64, 0x60, 0x85,
-    0x91, 0x48, 0xE6, 0x8F, 0xF4, 0x15, 0x42, 0x3F, 0xE5, 0x01, 0x39, 0x2A, 0x24, 0x1C, 0x86, 0xAD,
-    0x42, 0xFA, 0xB8, 0x77, 0x31, 0x62, 0x0C, 0x18, 0x04, 0x9A, 0xF5, 0xA1, 0x3F, 0x1F, 0xA4, 0x02,
-    0x8C, 0x18, 0x63, 0x80, 0xBF, 0x82, 0x62, 0x47, 0xC1, 0xE0, 0x29, 0x79, 0xB3, 0x8A, 0x16, 0x08,
-    0xCF, 0xF8, 0x57, 0x6F, 0x93, 0x3A, 0xCF, 0x58, 0xC4, 0xD2, 0x8A, 0x74, 0x32, 0x66, 0x03, 0x4C,
-    0x42, 0x04, 0x2F, 0xD1, 0x9C, 0xF2, 0xC5, 0x24, 0xE0, 0xF1, 0x34, 0x72, 0x33, 0xC3, 0x6B, 0x3D,
-    0x6A, 0x9E, 0x43, 0x2C, 0xDA, 0xC5, 0x14, 0x48, 0xC1, 0x43, 0xE0, 0x22, 0x84, 0x00, 0x26, 0x5E,
-    0xED, 0x4B, 0x1D, 0x5C, 0x34, 0x2C, 0x2B, 0x36, 0x7C, 0xFC, 0x67, 0xB5, 0xE6, 0xFC, 0xD4, 0xA9,
-    0x07, 0x36, 0xE1, 0x3C, 0x04, 0x36, 0xF5, 0xEE, 0x13, 0x7D, 0x9D, 0x3D, 0x71, 0xD3, 0xB0, 0xAC,
-    0x6D, 0xC9, 0xFF, 0x43, 0x3A, 0x8B, 0xB9, 0xDE, 0x8D, 0x29, 0x85, 0x65, 0x56, 0x89, 0xE4, 0x61,
-    0x5F, 0x98, 0x6A, 0xAF, 0xB5, 0x10, 0x7E, 0xCE, 0x1F, 0xB1, 0xFC, 0x02, 0xD4, 0x87, 0xF5, 0xE3,
-    0x00, 0x1C, 0xC6, 0x90, 0x25, 0xC2, 0x6E, 0xED, 0xC4, 0x10, 0xA1, 0xCC, 0x30, 0x52, 0x2D, 0xB2,
-    0xC5, 0x83, 0xC5, 0x00, 0xAD, 0x21, 0xF8, 0x61, 0x9E, 0x1A, 0x53, 0xCC, 0x11, 0x0F, 0xF8, 0x38,
-    0x50, 0xA3, 0x30, 0xF2, 0x69, 0xBB, 0x04, 0xD5, 0xE0, 0xEF, 0x03, 0x5A, 0xB3, 0xA6, 0xB4, 0x77,
-    0x33, 0x07, 0x09, 0xD9, 0x08, 0xB6, 0x92, 0x69, 0x12, 0x1E, 0x69, 0xE9, 0x6A, 0xAB, 0x6A, 0x7F,
-    0x98, 0x64, 0x34, 0xFC, 0xB4, 0xA0, 0x09, 0xE8, 0xED, 0x82, 0xAB, 0xE2, 0x70, 0x0C, 0x60, 0x0E,
-    0xDC, 0xA1, 0xC3, 0x5E, 0xC3, 0x6A, 0x7E, 0x59, 0xCA, 0xB0, 0x64, 0xE2, 0xE1, 0xA2, 0xCB, 0x34,
-    0xBD, 0x29, 0x9C, 0x3B, 0x1A, 0x8B, 0xC5, 0x67, 0xD6, 0x8F, 0x6A, 0x1F, 0xD4, 0xD7, 0x99, 0x03,
-    0xF0, 0x05, 0x88, 0x2A, 0xBC, 0xD4, 0x52, 0x4E, 0x0A, 0x17, 0xC6, 0xC0, 0x4A, 0x05, 0x2B, 0x6D,
-    0x02, 0xB1, 0x7A, 0x39, 0x62, 0x5F, 0xC1, 0x84, 0xBB, 0x20, 0xD9, 0xC5, 0x69, 0xAC, 0x39, 0x1E,
-    0x01, 0x7E, 0x6D, 0x22, 0xE8, 0xA7, 0x10, 0x2D, 0x9B, 0xCB, 0xA9, 0xBD, 0x73, 0x06, 0x56, 0x7C,
-    0xF6, 0x4E, 0xF8, 0xA6, 0x97, 0x08, 0xAA, 0x87, 0x48, 0x84, 0x0C, 0xA5, 0xF7, 0xEF, 0x92, 0xEC,
-    0xF2, 0x1D, 0xA2, 0x53, 0x73, 0x9D, 0x69, 0xAF, 0x73, 0x73, 0xEA, 0x82, 0x95, 0xDE, 0x41, 0x15,
-    0x4E, 0x89, 0x9B, 0x7B, 0x99, 0x2D, 0x69, 0xE1, 0xAA, 0xA1, 0x9E, 0xBE, 0x86, 0x2F, 0xB7, 0xE8,
-    0xD5, 0xC5, 0xA7, 0x0E, 0x78, 0xE7, 0x93, 0x5A, 0x73, 0x09, 0x41, 0x07, 0x6C, 0x49, 0xB2, 0xA1,
-    0xFA, 0x30, 0xA9, 0xFF, 0x69, 0x87, 0x3C, 0xC3, 0x46, 0x64, 0x7C, 0x76, 0x1F, 0xD7, 0x38, 0x97,
-    0xD4, 0xBB, 0xE0, 0xA1, 0xF2, 0xDC, 0xF6, 0xF6, 0x02, 0xF5, 0xE6, 0xDC, 0x06, 0xFF, 0x06, 0x6F,
-    0x9E, 0xA6, 0x81, 0x2F, 0xAE, 0xC6, 0x4A, 0x32, 0x87, 0xB0, 0x56, 0xAF, 0x90, 0x37, 0x35, 0x6B,
-    0x36, 0xE6, 0x24, 0x5E, 0x2E, 0x13, 0xBF, 0xCC, 0xBF, 0x62, 0x19, 0x9C, 0xD3, 0xA1, 0x06, 0xB3,
-    0x21, 0x42, 0xB6, 0xD8, 0x37, 0x60, 0x26, 0x57, 0x92, 0x47, 0xF3, 0xF0, 0xEC, 0x69, 0x4E, 0x5F,
-    0xE2, 0x5F, 0x3F, 0xFC, 0x84, 0x38, 0x5B, 0x25, 0xB4, 0x25, 0x5D, 0x65, 0x15, 0x15, 0x62, 0x47,
-    0x82, 0x2E, 0xDD, 0x6F, 0xB7, 0xEC, 0x27, 0xD3, 0x95, 0xC8, 0x4B, 0x46, 0xAD, 0x8E, 0x4F, 0xAA,
-    0xB5, 0xD1, 0xA6, 0x7C, 0x65, 0x14, 0x59, 0xD9, 0xEA, 0x4E, 0xE4, 0x64, 0xD1, 0x4E, 0xE4, 0xA6,
-    0xA3, 0x51, 0xD0, 0xFA, 0xA7, 0xEA, 0x8B, 0xA2, 0x4C, 0x22, 0x4B, 0x9E, 0xD2, 0x5E, 0xC0, 0x6E,
-    0xB8, 0x4C, 0xCE, 0x93, 0xEF, 0x2A, 0x76, 0xCE, 0x2B, 0x98, 0x90, 0xD5, 0x2C, 0xF9, 0x20, 0xDD,
-    0xC3, 0x78, 0x0F, 0xE3, 0x61, 0x4A, 0xF6, 0xBF, 0x00, 0x03, 0xB7, 0x33, 0xF2, 0xDE, 0xC8, 0xC9,
-    0x47, 0x40, 0x74, 0x21, 0xC0, 0xD6, 0xB6, 0x42, 0x88, 0x28, 0xEB, 0xD1, 0xBA, 0x02, 0xDF, 0x70,
-    0x20, 0x2A, 0xE0, 0x5E, 0x63, 0x78, 0xDE, 0x38, 0x66, 0x9B, 0x96, 0x8F, 0xC9, 0x02, 0xBB, 0x36,
-    0x8C, 0x88, 0x8C, 0x5D, 0x39, 0x96, 0x93, 0x7B, 0x89, 0x9B, 0x8A, 0xAB, 0x97, 0xA4, 0x40, 0x08,
-    0x89, 0xED, 0x7D, 0x08, 0x19, 0x82, 0x19, 0x0D, 0x5E, 0x49, 0xA4, 0x01, 0xCC, 0xC7, 0xE6, 0x2D,
-    0x84, 0xE6, 0x14, 0xE4, 0xAF, 0x54, 0x36, 0x44, 0xA6, 0x0C, 0x31, 0x31, 0xA3, 0xB3, 0x8C, 0x28,
-    0x6E, 0x23, 0x84, 0xEA, 0x20, 0x88, 0x2B, 0xB7, 0x8E, 0xAA, 0xEF, 0xDD, 0xEA, 0x19, 0xA3, 0x8F,
-    0x3B, 0x9B, 0x81, 0x97, 0xCA, 0xAF, 0xCA, 0x4F, 0x2A, 0xBE, 0x7C, 0xE0, 0x35, 0xEA, 0x89, 0x94,
-    0xA6, 0x70, 0xF8, 0x5D, 0x80, 0xCD, 0x00, 0xFC, 0xF3, 0xD8, 0x05, 0xC0, 0x8C, 0x41, 0x7B, 0x1A,
-    0x20, 0x78, 0x62, 0x40, 0x6D, 0x44, 0x1E, 0x6A, 0x80, 0x30, 0x19, 0x58, 0x33, 0xF0, 0x55, 0xC0,
-    0xC3, 0xA5, 0x86, 0x2C, 0x43, 0x67, 0x0E, 0x58, 0x6E, 0x05, 0x5A, 0xE2, 0xEA, 0x1A, 0x09, 0xB0,
-    0x2B, 0xB6, 0xAF, 0x1F, 0x86, 0x79, 0x93, 0x3F, 0x76, 0xF8, 0x09, 0xC2, 0x46, 0x23, 0xCF, 0x8B,
-    0xE8, 0xE0, 0x18, 0xA6, 0xC1, 0xBA, 0xF2, 0xD7, 0xD7, 0x8E, 0xA5, 0x33, 0x36, 0xC1, 0x53, 0xEB,
-    0xA9, 0x80, 0x9E, 0x0E, 0xA0, 0xA7, 0xAF, 0xDA, 0xC5, 0xA2, 0x9E, 0xCC, 0xDE, 0x57, 0xBE, 0x13,
-    0x23, 0xAB, 0x47, 0x74, 0x0E, 0x83, 0x20, 0x9B, 0xA5, 0xBA, 0x00, 0xC5, 0x10, 0x27, 0x8B, 0x14,
-    0x55, 0xD5, 0x0C, 0x0C, 0x4D, 0x66, 0x26, 0xE4, 0x10, 0xF5, 0x8C, 0x1D, 0x3E, 0xC3, 0x7A, 0xC0,
-    0xAC, 0xC5, 0xCC, 0x5B, 0xC4, 0xCC, 0x45, 0xCC, 0xDD, 0x80, 0xBC, 0xAB, 0xEB, 0x63, 0xF0, 0xA6,
-    0x0D, 0xB9, 0xCD, 0x2B, 0xB1, 0x9C, 0x31, 0x16, 0x2B, 0x01, 0x98, 0x11, 0xEF, 0x89, 0x78, 0xCF,
-    0x80, 0xF7, 0x8C, 0x79, 0x4F, 0xA1, 0x45, 0x9A, 0x14, 0x34, 0xCC, 0x8F, 0x66, 0xEE, 0x81, 0xCE,
-    0xF9, 0x75, 0xFE, 0x69, 0x26, 0x9F, 0x33, 0xF7, 0x69, 0xB8, 0x4F, 0x47, 0x6B, 0x06, 0xB3, 0xA2,
-    0x99, 0xA1, 0x4C, 0x7A, 0x7A, 0xB6, 0x26, 0xD8, 0xA5, 0x6F, 0xC1, 0x64, 0x39, 0x6D, 0x6B, 0xA1,
-    0xC6, 0x56, 0x6E, 0x2B, 0x38, 0x65, 0xEA, 0x64, 0x10, 0x1B, 0xB8, 0xE6, 0xDE, 0x56, 0xE4, 0x5D,
-    0x46, 0xBD, 0x70, 0x09, 0x3B, 0x81, 0xB1, 0xE2, 0x01, 0xB6, 0xBF, 0x96, 0x50, 0x00, 0x92, 0x31,
-    0x8B, 0x00, 0x8F, 0xAB, 0xD1, 0x78, 0xAC, 0xF3, 0x68, 0x57, 0x9F, 0x7F, 0xEC, 0xE1, 0xF2, 0xE8,
-    0xE1, 0x86, 0x69, 0x18, 0x1B, 0xB6, 0xB6, 0xF6, 0x19, 0x21, 0x6C, 0xDC, 0x4B, 0xBE, 0xDB, 0xC0,
-    0xC9, 0xCF, 0xF4, 0xE7, 0xEF, 0xE4, 0x41, 0x47, 0xBF, 0x22, 0x01, 0xC5, 0xFE, 0x9C, 0xE2, 0x01,
-    0xA7, 0xAC, 0x3E, 0x54, 0x2B, 0x48, 0x41, 0x63, 0xC2, 0xCA, 0x15, 0xB5, 0x3C, 0xE7, 0x7D, 0x45,
-    0x6D, 0xEF, 0xB5, 0x9F, 0x29, 0x8A, 0xDD, 0x0B, 0x38, 0x3A, 0x72, 0x7F, 0x83, 0xD3, 0x07, 0xEE,
-    0x3E, 0x18, 0xE8, 0x3B, 0x05, 0x78, 0x18, 0x39, 0x0A, 0x6C, 0xC0, 0xA3, 0x71, 0x07, 0x40, 0xB8,
-    0x09, 0xC0, 0xCE, 0x4B, 0x70, 0x92, 0x90, 0xCE, 0x01, 0x18, 0x73, 0x3E, 0x02, 0x6B, 0xEE, 0xDB,
-    0x40, 0x47, 0xEF, 0x72, 0xD2, 0x26, 0xF1, 0xED, 0x14, 0x41, 0x07, 0x7C, 0x20, 0x61, 0xE7, 0x03,
-    0xCC, 0xAA, 0x31, 0x2A, 0xA6, 0x62, 0x04, 0xCE, 0xFB, 0x2C, 0x72, 0xA4, 0xC0, 0x7A, 0xA0, 0xB8,
-    0x94, 0xC8, 0x51, 0x92, 0x89, 0x0C, 0x52, 0x73, 0x7A, 0xAD, 0x12, 0x5A, 0xC2, 0x80, 0x08, 0x53,
-    0x1C, 0xD0, 0x3E, 0x42, 0x04, 0x4A, 0xC1, 0xB3, 0xD0, 0x68, 0xC0, 0x67, 0x1B, 0x04, 0x7C, 0x8B,
-    0xAB, 0x1B, 0xA7, 0x0C, 0x3C, 0x8D, 0x48, 0x27, 0x11, 0x20, 0x38, 0x74, 0xB8, 0x8F, 0x09, 0x9B,
-    0x73, 0x8B, 0x07, 0xD8, 0x9B, 0x71, 0x42, 0x9B, 0x4C, 0x6B, 0x47, 0x2E, 0xEF, 0x73, 0x90, 0x42,
-    0xC3, 0x7E, 0xE2, 0x64, 0x80, 0x0D, 0x76, 0xCE, 0x94, 0x05, 0x73, 0x39, 0xAB, 0x20, 0x8F, 0x0C,
-    0xE1, 0x78, 0x00, 0x0F, 0x00, 0xC4, 0x97, 0x06, 0xC5, 0xFF, 0xC9, 0xEB, 0xE0, 0x05, 0xBC, 0x5A,
-    0x9A, 0xE1, 0x4D, 0xAA, 0xB0, 0x46, 0x83, 0x0D, 0x59, 0xB2, 0xC9, 0x7F, 0x7A, 0x2C, 0xFF, 0xEB,
-    0x7B, 0x26, 0xA8, 0x6F, 0xA4, 0x14, 0x70, 0x68, 0xB1, 0x3D, 0xAD, 0xDA, 0xCF, 0x76, 0xC1, 0x7F,
-    0x64, 0xFC, 0xCC, 0xD4, 0x47, 0x92, 0x41, 0xC2, 0x2E, 0x6C, 0x59, 0xE7, 0x71, 0x1E, 0x9C, 0xEE,
-    0x39, 0x9B, 0xE9, 0xEC, 0xE3, 0xD7, 0x3F, 0x76, 0x1B, 0x9A, 0xD8, 0xD5, 0xB5, 0xC8, 0x64, 0x32,
-    0xAF, 0x45, 0xB8, 0x7C, 0x9D, 0x70, 0xED, 0x10, 0x1F, 0xA3, 0xAC, 0x82, 0x0E, 0xCB, 0xA0, 0xA3,
-    0x60, 0xB4, 0x00, 0x48, 0xA4, 0x6B, 0x22, 0xC1, 0x8B, 0x7C, 0x5E, 0x15, 0xF0, 0xB2, 0x36, 0xAF,
-    0x89, 0x79, 0x11, 0x83, 0x38, 0xE8, 0x32, 0x86, 0xF2, 0xAD, 0x60, 0x0D, 0x33, 0x2E, 0xE0, 0xC6,
-    0x78, 0xC3, 0xE0, 0x90, 0x1B, 0x70, 0x88, 0x8D, 0x19, 0x90, 0x9C, 0xC5, 0xD3, 0x03, 0x03, 0x5E,
-    0xE6, 0x1A, 0x61, 0xC9, 0x18, 0x2B, 0xFA, 0x58, 0x30, 0xD0, 0x39, 0x81, 0xCD, 0x11, 0x63, 0xB0,
-    0x62, 0x94, 0x56, 0x57, 0x1B, 0x87, 0x06, 0x38, 0x0E, 0x3D, 0x1F, 0x9A, 0x0D, 0x68, 0x00, 0xE2,
-    0x08, 0x34, 0x0E, 0x82, 0x2B, 0xCE, 0xCC, 0x98, 0xA2, 0xCF, 0x4E, 0x9F, 0x0D, 0x70, 0x02, 0x17,
-    0x7D, 0x3D, 0xC9, 0x19, 0x66, 0x82, 0xAE, 0x31, 0xA2, 0x2F, 0x64, 0x80, 0xC0, 0xBE, 0x8B, 0xDF,
-    0x91, 0x73, 0x27, 0x01, 0x55, 0xF7, 0x2D, 0xB4, 0x75, 0x91, 0x70, 0x11, 0x5E, 0x51, 0xCB, 0x79,
-    0x13, 0x61, 0x1F, 0x39, 0x6F, 0x01, 0xE9, 0xFA, 0xCE, 0x07, 0x92, 0xA2, 0x11, 0xD7, 0x91, 0xB1,
-    0x72, 0xEE, 0x21, 0xB2, 0x33, 0x67, 0x9F, 0x4B, 0x4C, 0x87, 0x0B, 0x09, 0x09, 0x67, 0x02, 0x6F,
-    0x6C, 0x0A, 0x46, 0x46, 0x80, 0x06, 0x4B, 0xEB, 0x1B, 0x57, 0xC2, 0x02, 0xEF, 0x0D, 0x2E, 0xBE,
-    0xEE, 0xB0, 0xB5, 0x1E, 0xB0, 0xDA, 0x74, 0x0A, 0x62, 0x33, 0x31, 0x0D, 0xF2, 0xF8, 0xE6, 0xB7,
-    0xC9, 0x94, 0xA7, 0x34, 0x15, 0x5C, 0x2F, 0x43, 0x24, 0x34, 0xB7, 0xDC, 0x2A, 0x41, 0x43, 0x0C,
-    0xCE, 0x1A, 0x39, 0x07, 0xDA, 0x2B, 0x63, 0x5D, 0xCC, 0x07, 0x8C, 0xCA, 0x78, 0x28, 0x18, 0x73,
-    0x2E, 0x82, 0xCC, 0x2D, 0xDD, 0x31, 0xB2, 0x63, 0x2F, 0x1A, 0x2D, 0x59, 0x34, 0x1A, 0xAC, 0xBF,
-    0x0F, 0x24, 0xDA, 0x37, 0x6E, 0xCB, 0x3C, 0x73, 0x34, 0xD7, 0xCD, 0x45, 0x45, 0xE0, 0xC8, 0x94,
-    0x5D, 0x4F, 0x55, 0x45, 0x3B, 0x0F, 0x0A, 0x51, 0x90, 0xAA, 0x39, 0x1C, 0x8F, 0xEA, 0x86, 0xA1,
-    0x81, 0x88, 0x8E, 0x69, 0x18, 0x1A, 0x70, 0xDC, 0xD2, 0xED, 0x18, 0xF6, 0xA1, 0xA4, 0xEC, 0xE8,
-    0xF2, 0x3B, 0xC2, 0x44, 0x1B, 0xF3, 0xA2, 0xFA, 0xF3, 0xA4, 0x9B, 0xB8, 0x89, 0xA3, 0x83, 0x05,
-    0xF9, 0xA3, 0x97, 0x71, 0x5B, 0x39, 0xA7, 0xD5, 0x40, 0xF7, 0x56, 0xDD, 0x43, 0x1E, 0xE6, 0x8D,
-    0x45, 0x1E, 0xB0, 0x6F, 0x92, 0xEA, 0x86, 0xD1, 0x30, 0x8E, 0xEF, 0x3F, 0x81, 0x62, 0x14, 0x3F,
-    0x1F, 0x81, 0x1E, 0x9B, 0xAA, 0x8D, 0x3A, 0x4B, 0x60, 0x89, 0x27, 0xDB, 0x98, 0x39, 0x85, 0xDA,
-    0x07, 0x05, 0x46, 0x0F, 0x49, 0x5B, 0x17, 0xB7, 0xF0, 0x9B, 0x84, 0x4E, 0x5B, 0xD2, 0x2A, 0xEF,
-    0x26, 0xEE, 0xC7, 0xF0, 0x19, 0xD9, 0x63, 0x4F, 0x85, 0x5A, 0x02, 0x06, 0xC5, 0xC3, 0xB6, 0xAA,
-    0x00, 0x32, 0x8C, 0xA1, 0xCE, 0x5D, 0x94, 0x7F, 0xBD, 0x5B, 0x3B, 0xE4, 0x17, 0xCA, 0xB8, 0x70,
-    0x33, 0xB0, 0x54, 0x15, 0x58, 0xF9, 0x0F, 0xC8, 0xBE, 0x5B, 0x92, 0xF3, 0xF9, 0xC5, 0xD4, 0x29,
-    0x00, 0x08, 0xA8, 0x89, 0x3C, 0x0D, 0x0A, 0x0E, 0x40, 0x01, 0xC0, 0x00, 0x4D, 0x73, 0x2B, 0x17,
-    0x42, 0x5D, 0xBD, 0x64, 0x93, 0xE2, 0xA7, 0x53, 0xEA, 0x0C, 0xAB, 0xE2, 0xFA, 0xF4, 0x15, 0xAB,
-    0x2C, 0xDC, 0xFB, 0xDF, 0x87, 0x0E, 0xBA, 0x8B, 0xA9, 0xB0, 0xD0, 0x5F, 0xF0, 0xB3, 0x77, 0x23,
-    0xF1, 0xAA, 0x38, 0x3F, 0x1A, 0xC3, 0x18, 0xA7, 0xDD, 0xD4, 0x2A, 0xFF, 0x96, 0x78, 0x95, 0x30,
-    0xDD, 0x43, 0x61, 0xDA, 0x5F, 0x2E, 0xCC, 0x69, 0xE8, 0x41, 0xB9, 0xFF, 0x98, 0x0A, 0xD9, 0x87,
-    0xE8, 0x48, 0x88, 0x5B, 0x93, 0x6C, 0x32, 0x63, 0xFF, 0xA8, 0x0F, 0x97, 0xBD, 0x1B, 0xA9, 0x57,
-    0x26, 0xF3, 0x3E, 0x00, 0x3B, 0xF7, 0xF2, 0x05, 0x3E, 0xDC, 0x0F, 0x75, 0x0B, 0x44, 0x67, 0xFE,
-    0x4A, 0xEC, 0x18, 0x87, 0x6E, 0xF9, 0xBC, 0x02, 0x69, 0x7C, 0x3C, 0x24, 0x71, 0xC9, 0xB4, 0xA7,
-    0x4B, 0xE9, 0x64, 0x8D, 0x86, 0x8F, 0x72, 0xFB, 0xF1, 0xA5, 0x8C, 0xAB, 0x17, 0x2F, 0xE5, 0x86,
-    0xC3, 0x4B, 0xA0, 0xC1, 0x84, 0xEB, 0xC9, 0x40, 0x87, 0x61, 0x0F, 0xA4, 0xB7, 0x28, 0x44, 0xE0,
-    0x89, 0x07, 0x48, 0xB1, 0x07, 0x4D, 0xE2, 0x8A, 0xD6, 0x1C, 0x86, 0x46, 0x60, 0xD0, 0xC1, 0x0B,
-    0x2D, 0x26, 0x9D, 0xCF, 0xBF, 0xD7, 0xB0, 0x18, 0xB7, 0x18, 0x68, 0x32, 0xA0, 0x46, 0xA1, 0xF3,
-    0x87, 0x20, 0x73, 0x56, 0x50, 0x61, 0x14, 0xCE, 0x58, 0x26, 0x7E, 0x5F, 0xB5, 0xCC, 0xAF, 0x74,
-    0xEC, 0xF9, 0xFB, 0x2A, 0xDE, 0x83, 0x95, 0x41, 0xBD, 0x8A, 0x17, 0x8C, 0x75, 0x98, 0x2D, 0x6B,
-    0xA5, 0xAD, 0x3D, 0xD3, 0x70, 0x3F, 0xBF, 0xA2, 0xD0, 0xB6, 0x87, 0x5E, 0x10, 0x25, 0xDC, 0x62,
-    0x1C, 0xA3, 0x30, 0x2B, 0x3F, 0x21, 0x91, 0x7F, 0x00, 0x23, 0x9B, 0xE4, 0xBC, 0x8F, 0x72, 0xE0,
-    0x0E, 0xEA, 0xF7, 0x77, 0xD0, 0x5E, 0x40, 0x7B, 0x02, 0x76, 0x10, 0x6F, 0x9B, 0x57, 0x1E, 0x26,
-    0xFF, 0xA8, 0xAA, 0xEB, 0xD4, 0xD6, 0xE4, 0xB6, 0x53, 0x91, 0xB2, 0x54, 0xCD, 0xBC, 0xC7, 0x2F,
-    0xDB, 0x16, 0x99, 0x97, 0xEF, 0x5A, 0xD7, 0xC9, 0xBE, 0x53, 0x7A, 0x70, 0xE8, 0x7B, 0x17, 0x7F,
-    0x84, 0x73, 0x0A, 0x4F, 0xC1, 0x8D, 0x51, 0xEE, 0xB3, 0x33, 0x1B, 0x63, 0x68, 0x15, 0x49, 0xA3,
-    0x24, 0x5F, 0xAB, 0x29, 0xD0, 0x8A, 0x8A, 0x0F, 0x55, 0x65, 0xFA, 0xF0, 0x48, 0x1F, 0x6A, 0xC9,
-    0x5F, 0x1B, 0x75, 0x3F, 0x40, 0x80, 0xA0, 0x28, 0x77, 0xB9, 0x9B, 0xC3, 0xE9, 0xC2, 0xA8, 0x8E,
-    0x3B, 0x48, 0xE9, 0x6B, 0x1A, 0x61, 0x45, 0x25, 0xD6, 0x7B, 0xB5, 0x7F, 0x16, 0xDE, 0xC7, 0xBB,
-    0xBE, 0xEC, 0x76, 0x39, 0x11, 0xF8, 0x80, 0x4B, 0xE0, 0x24, 0x32, 0x28, 0x44, 0x42, 0xD5, 0x36,
-    0xB0, 0x54, 0x78, 0x33, 0xAB, 0x1A, 0xE8, 0xE5, 0xD3, 0x44, 0xBF, 0x85, 0xD1, 0xBF, 0xF8, 0xA5,
-    0x42, 0x3D, 0xA0, 0xE0, 0xEF, 0x10, 0x94, 0x20, 0x2A, 0x2A, 0xA7, 0x4C, 0x37, 0xC1, 0x0A, 0xA9,
-    0x3A, 0xD3, 0x07, 0x43, 0x7D, 0x62, 0x6B, 0x46, 0xC2, 0x2F, 0x8E, 0x75, 0xD3, 0xBE, 0x0E, 0x8E,
-    0x1A, 0x25, 0xDE, 0x3B, 0x82, 0x12, 0xF1, 0x73, 0x02, 0x4B, 0x99, 0xC0, 0x3A, 0x26, 0x46, 0x35,
-    0x64, 0xCB, 0xEB, 0xF6, 0x9D, 0xC2, 0xB9, 0xB7, 0xE6, 0x14, 0xDC, 0x11, 0x37, 0xEB, 0xDA, 0x23,
-    0x5E, 0x40, 0xAF, 0x4B, 0xA7, 0x54, 0xE2, 0x4F, 0xD7, 0xCC, 0x23, 0x14, 0xFA, 0xDC, 0x83, 0x42,
-    0x48, 0x9F, 0x53, 0x08, 0xE8, 0x49, 0x2F, 0x7D, 0x32, 0x91, 0x13, 0xD3, 0xF7, 0x48, 0xB2, 0x34,
-    0x94, 0x7A, 0x1F, 0x22, 0x07, 0x90, 0xFF, 0x8B, 0x39, 0xC1, 0x66, 0x09, 0x3E, 0xD6, 0x9F, 0xAD,
-    0x6B, 0xFC, 0x6E, 0x0F, 0xD7, 0x09, 0xD8, 0xC4, 0xF4, 0xF0, 0xB5, 0xB3, 0xB3, 0xF6, 0x5B, 0x87,
-    0xCE, 0xCE, 0xEF, 0x95, 0xFA, 0x0D, 0xE1, 0x86, 0x40, 0x8D, 0xB0, 0x42, 0x8D, 0x35, 0x3A, 0x81,
-    0x52, 0x12, 0xE2, 0xF7, 0xA9, 0x18, 0xD8, 0x2A, 0x02, 0xEC, 0x7A, 0x09, 0xDA, 0xD5, 0x08, 0x86,
-    0x03, 0xF4, 0x8F, 0xB9, 0xB4, 0xF4, 0x33, 0xEE, 0x34, 0x97, 0xB1, 0x76, 0x6D, 0x8C, 0xFA, 0x26,
-    0x1F, 0x73, 0x94, 0xF5, 0xDD, 0x91, 0x97, 0xF4, 0x45, 0x5F, 0x50, 0x9F, 0xDB, 0xD9, 0x7E, 0xD4,
-    0xC1, 0x41, 0xFD, 0x0E, 0xCE, 0xDA, 0xE9, 0xC0, 0x9E, 0x39, 0xEA, 0xD2, 0x6E, 0xDA, 0x85, 0xDF,
-    0x27, 0x00, 0xF6, 0x9E, 0xEC, 0x25, 0x88, 0xF2, 0x1E, 0x97, 0x5D, 0x96, 0xE4, 0xBA, 0x9E, 0x14,
-    0xC4, 0x1A, 0x71, 0xE1, 0x56, 0xE8, 0xF7, 0x17, 0xAC, 0x0E, 0x9D, 0x06, 0x86, 0xA6, 0x97, 0x75,
-    0xFE, 0x8C, 0xE2, 0x05, 0xC9, 0x3E, 0x84, 0xA4, 0xFC, 0xBE, 0x85, 0x19, 0x5D, 0x78, 0x4D, 0xA6,
-    0x0B, 0x7E, 0x6E, 0x75, 0xA0, 0xF8, 0x98, 0xDF, 0x22, 0xF2, 0x5B, 0x5B, 0xAC, 0x6B, 0x21, 0xC9,
-    0x2C, 0x35, 0xAA, 0x8B, 0xE6, 0x7B, 0x16, 0xC4, 0xF0, 0x50, 0x99, 0x77, 0x08, 0xB4, 0xBE, 0xCE,
-    0xA5, 0xDF, 0xFA, 0x26, 0xCF, 0x82, 0x94, 0xCE, 0xE5, 0xAC, 0xE1, 0xFA, 0x17, 0xB7, 0xF5, 0xDB,
-    0xD7, 0x86, 0xE8, 0x48, 0xB8, 0xA2, 0xE4, 0xE6, 0xAA, 0x32, 0x68, 0x23, 0x8F, 0xA1, 0x73, 0x1B,
-    0x4A, 0xC6, 0x39, 0xF0, 0x60, 0xF2, 0x5F, 0x33, 0x9D, 0xF2, 0x47, 0x27, 0xBA, 0xD1, 0xF3, 0x2E,
-    0x6D, 0xC6, 0xD2, 0xF8, 0xC5, 0x33, 0x29, 0xB3, 0xAD, 0x65, 0x38, 0x93, 0x71, 0xE1, 0x7A, 0x98,
-    0x35, 0xEB, 0x54, 0x8B, 0x03, 0x4B, 0x2D, 0xCF, 0x09, 0xCE, 0x9C, 0x07, 0x76, 0xF2, 0xD3, 0x4B,
-    0x48, 0x2A, 0xF6, 0xEF, 0xE8, 0x7F, 0xBD, 0x58, 0x3F, 0x6C, 0xDC, 0xD6, 0x19, 0xFF, 0x48, 0xDA,
-    0x26, 0x6C, 0xC2, 0x7A, 0x1A, 0xDC, 0x16, 0xB0, 0x2D, 0xB1, 0x43, 0x06, 0xD7, 0xD5, 0xDD, 0x2D,
-    0x1A, 0x84, 0x80, 0xBC, 0x7B, 0x69, 0x81, 0x7A, 0xC8, 0x10, 0x0D, 0x71, 0x3B, 0x74, 0x88, 0x87,
-    0xCE, 0x8D, 0x06, 0x0D, 0x42, 0x70, 0xD6, 0xD1, 0xEE, 0xD0, 0x21, 0x43, 0x5C, 0xB4, 0x45, 0xD6,
-    0x0C, 0x19, 0x6A, 0x05, 0xA8, 0xAE, 0xC0, 0x15, 0x38, 0x20, 0x72, 0x8E, 0x8E, 0x87, 0x8C, 0x61,
-    0xD1, 0x21, 0xE8, 0x14, 0x06, 0xB5, 0xD1, 0xC1, 0x83, 0x89, 0x86, 0x41, 0x4F, 0xB1, 0xEE, 0xD8,
-    0xDF, 0xEF, 0x91, 0x3C, 0xCB, 0x8A, 0x87, 0xCA, 0x52, 0xC5, 0xD3, 0xA3, 0xEE, 0x1E, 0xF9, 0xBE,
-    0xFF, 0xDF, 0xEF, 0xFB, 0xDE, 0x93, 0x57, 0x64, 0x0F, 0x9F, 0x5F, 0x89, 0x88, 0x96, 0xC4, 0x4A,
-    0xEC, 0xD8, 0xC1, 0xC7, 0x8D, 0x3C, 0xAD, 0xB4, 0x12, 0x5F, 0x5A, 0xD2, 0x96, 0x1F, 0x09, 0x2F,
-    0x27, 0x12, 0x47, 0x4B, 0x6B, 0x6C, 0x15, 0x63, 0x37, 0x15, 0x15, 0xE1, 0x91, 0x84, 0x22, 0x81,
-    0x48, 0xB7, 0xFE, 0xC3, 0xCF, 0x96, 0x8E, 0x54, 0x11, 0x5B, 0x53, 0x10, 0x13, 0x2B, 0x21, 0xD1,
-    0xF2, 0xEA, 0xE5, 0x62, 0x17, 0x7B, 0xE2, 0x26, 0xA7, 0x44, 0x61, 0x4E, 0x61, 0xCA, 0xC7, 0x58,
-    0xC4, 0x68, 0x8A, 0xD8, 0x9F, 0xDC, 0x15, 0xAF, 0x98, 0x1A, 0x22, 0x32, 0xC4, 0xC8, 0x31, 0x32,
-    0xCC, 0xA7, 0x22, 0x5E, 0x24, 0xD2, 0x29, 0x8A, 0x88, 0x03, 0xB3, 0xFD, 0x37, 0x97, 0x47, 0x45,
-    0xD6, 0xBA, 0x96, 0x04, 0x92, 0xAE, 0x48, 0x7F, 0x59, 0xFA, 0x81, 0x64, 0x4D, 0x27, 0xE9, 0x14,
-    0xD9, 0x5F, 0x86, 0x03, 0x91, 0x79, 0x90, 0xCE, 0x94, 0x76, 0x12, 0x2F, 0xF2, 0xA0, 0x89, 0x12,
-    0x27, 0x0E, 0xC5, 0x4E, 0x86, 0x62, 0xA5, 0x20, 0xF8, 0x35, 0x44, 0x7A, 0x1A, 0xC9, 0xE9, 0xE2,
-    0x0F, 0xD2, 0x2A, 0xC6, 0x25, 0xBF, 0x0D, 0xD2, 0xCF, 0xA4, 0x57, 0xA4, 0x86, 0xA7, 0x85, 0x7F,
-    0x36, 0x5E, 0x1B, 0xD4, 0xD7, 0x0D, 0xA3, 0xC0, 0x8D, 0xD9, 0xEF, 0x52, 0xA1, 0x16, 0xA4, 0x9D,
-    0x6E, 0x8B, 0x55, 0xAD, 0x30, 0x12, 0x8F, 0xA0, 0x19, 0xA8, 0x38, 0xF7, 0xC7, 0xE2, 0xC1, 0x30,
-    0x8A, 0x43, 0x6F, 0x88, 0x0B, 0xCE, 0x16, 0x85, 0xF7, 0x63, 0x98, 0x31, 0x2D, 0x17, 0x38, 0x89,
-    0x6C, 0x6E, 0xC7, 0xD2, 0x9A, 0x54, 0x06, 0x92, 0x6E, 0xB8, 0x11, 0xD4, 0xDF, 0x2F, 0xF1, 0xED,
-    0xDD, 0x9F, 0x8D, 0x21, 0x3C, 0xCC, 0x34, 0x27, 0xD7, 0x9D, 0x78, 0xC9, 0x2D, 0x6E, 0x25, 0xCB,
-    0xEA, 0x35, 0xDD, 0x5F, 0x6B, 0x88, 0xAC, 0x41, 0x6B, 0x59, 0x4E, 0x71, 0x5B, 0x31, 0x37, 0xF3,
-    0x73, 0x0D, 0xF6, 0x5F, 0x5E, 0x86, 0x59, 0xFB, 0x4B, 0x5E, 0x11, 0xA5, 0x73, 0x72, 0x97, 0x9E,
-    0x84, 0x18, 0xD6, 0xAE, 0xB5, 0x03, 0xEE, 0x45, 0x52, 0xD3, 0xF7, 0xFE, 0xD1, 0xB8, 0xB9, 0xBE,
-    0xD4, 0x5F, 0x4A, 0x57, 0xD2, 0xE5, 0x2C, 0xEF, 0xAD, 0x5D, 0x98, 0x17, 0x3D, 0x6F, 0xA5, 0x03,
-    0xF7, 0x7E, 0xDA, 0x72, 0xE3, 0x1D, 0x5F, 0xF2, 0x50, 0xBA, 0x4D, 0x09, 0x95, 0x2C, 0x22, 0x10,
-    0x9C, 0xD8, 0xB2, 0xF4, 0xD5, 0xAD, 0x2D, 0xDD, 0x33, 0x2E, 0x70, 0x0F, 0x0C, 0x47, 0x5F, 0xFD,
-    0x53, 0x67, 0xFC, 0xBD, 0xD5, 0x17, 0x8A, 0x7E, 0xFA, 0x4D, 0x88, 0xAE, 0x8A, 0xD7, 0x20, 0xFA,
-    0xA5, 0xB8, 0xBF, 0x06, 0x5A, 0x6B, 0x7D, 0xDC, 0x96, 0x53, 0xF5, 0xCB, 0x68, 0x25, 0x55, 0x53,
-    0x88, 0xAE, 0x16, 0x21, 0xBA, 0x52, 0x7A, 0x79, 0x59, 0xB9, 0x71, 0x7F, 0x49, 0xD9, 0x49, 0x3A,
-    0x77, 0x56, 0x7E, 0xFF, 0x42, 0xD1, 0xAF, 0x6E, 0x7D, 0xD8, 0xA3, 0xDF, 0xC4, 0x1B, 0x4B, 0xF8,
-    0x6B, 0x59, 0xF7, 0xA4, 0xEF, 0x6A, 0xFC, 0xAD, 0x20, 0x56, 0x27, 0x62, 0xDD, 0x29, 0x23, 0xEA,
-    0xC0, 0x40, 0xE4, 0x94, 0xA2, 0xBF, 0xE0, 0x19, 0xAF, 0xD9, 0xF3, 0x0B, 0x88, 0x51, 0xED, 0x5C,
-    0x8B, 0x29, 0x3B, 0xC2, 0xDD, 0x13, 0x81, 0xA9, 0x07, 0xFC, 0xA5, 0xF8, 0x96, 0x5C, 0xBD, 0x2B,
-    0xB2, 0xAA, 0x26, 0x67, 0x7D, 0xFC, 0x9E, 0x3B, 0x33, 0x3E, 0x97, 0xC3, 0xC1, 0x4B, 0x3A, 0xF8,
-    0x36, 0x7F, 0x9B, 0x66, 0xC8, 0xDC, 0xD8, 0x97, 0x15, 0x01, 0x95, 0x0B, 0x88, 0xE1, 0x0D, 0x44,
-    0xC4, 0x10, 0xF1, 0x94, 0x23, 0x42, 0x32, 0x2B, 0xB5, 0x32, 0x3B, 0xB5, 0x53, 0x27, 0xC1, 0x87,
-    0xF9, 0x15, 0x7B, 0xF8, 0xF8, 0xB1, 0x8A, 0x7B, 0x91, 0x7A, 0xFA, 0x58, 0xAB, 0xD1, 0xEB, 0x75,
-    0x2A, 0x30, 0x89, 0x98, 0x54, 0x66, 0x20, 0x34, 0x21, 0x52, 0x81, 0x94, 0x62, 0xFC, 0xDF, 0x8E,
-    0x7A, 0x18, 0xA3, 0x03, 0x83, 0x73, 0x7C, 0xD6, 0xC2, 0xF0, 0x30, 0xE4, 0x17, 0x18, 0xF6, 0xFF,
-    0x30, 0x4C, 0xD0, 0xED, 0xED, 0xCD, 0x3B, 0x91, 0xAB, 0x11, 0xF0, 0xE9, 0x0F, 0x92, 0x8E, 0x66,
-    0xCA, 0xF9, 0xC9, 0xAB, 0x25, 0x0C, 0x60, 0xDE, 0x83, 0xA6, 0x4A, 0xCE, 0xD2, 0xE0, 0x59, 0xA3,
-    0xBB, 0x7E, 0xB9, 0x7F, 0x3E, 0xBD, 0x9C, 0x2E, 0xF5, 0xD7, 0x3B, 0xE9, 0x69, 0x39, 0x6D, 0x8B,
-    0xC2, 0x3B, 0xB7, 0x13, 0xE7, 0x3E, 0x94, 0xCB, 0xED, 0x6C, 0xC7, 0xBD, 0x9F, 0x2B, 0x27, 0x09,
-    0x95, 0x1E, 0x84, 0x32, 0x7F, 0xCA, 0x30, 0x80, 0xF6, 0x4B, 0x2A, 0x95, 0x41, 0x98, 0x58, 0xA9,
-    0x0D, 0xDD, 0x6D, 0x93, 0x91, 0x0D, 0x98, 0x17, 0x79, 0xA1, 0xB3, 0xC0, 0x73, 0xE2, 0x3D, 0xE5,
-    0xFD, 0x64, 0xEF, 0xDC, 0xA2, 0xBB, 0x21, 0xC1, 0xC2, 0xBA, 0x64, 0x2B, 0x7D, 0x3B, 0xF9, 0x26,
-    0x77, 0x6F, 0x15, 0x13, 0x78, 0x3F, 0x5D, 0x02, 0x8A, 0xAC, 0x8B, 0x15, 0xCD, 0x88, 0x09, 0xA9,
-    0x09, 0xC9, 0x09, 0xE9, 0x09, 0x09, 0x1A, 0x8A, 0x24, 0x79, 0x01, 0x34, 0xFF, 0x5D, 0x68, 0xCF,
-    0x7E, 0x70, 0x2D, 0x56, 0xD0, 0x2A, 0x3E, 0x37, 0x47, 0xEF, 0x05, 0xE2, 0x69, 0x2C, 0x6A, 0x32,
-    0xF1, 0xE8, 0x4E, 0x68, 0x4B, 0xB5, 0xE0, 0x5D, 0x38, 0x75, 0x03, 0x41, 0x05, 0xB7, 0x52, 0xC5,
-    0x29, 0x5E, 0x38, 0x4B, 0xF9, 0xE0, 0x7A, 0x8F, 0x20, 0xB5, 0x20, 0xF6, 0x10, 0x2E, 0x3D, 0x33,
-    0x26, 0x30, 0x34, 0x88, 0x0A, 0x0B, 0xEE, 0xAD, 0x4C, 0x1A, 0xCA, 0x4D, 0x3F, 0x19, 0x07, 0x2A,
-    0xF9, 0xF1, 0x9D, 0xC1, 0xAB, 0x31, 0x16, 0x7D, 0x8D, 0x78, 0xF9, 0xF4, 0x01, 0xE2, 0xD5, 0x7D,
-    0xFF, 0x0E, 0x9E, 0x02, 0x4D, 0x36, 0x48, 0x20, 0x13, 0x43, 0x0C, 0xE6, 0x43, 0x64, 0x3A, 0x19,
-    0x73, 0xDF, 0x36, 0x9A, 0x58, 0xC8, 0x1C, 0x4D, 0x09, 0xE0, 0x70, 0x80, 0x62, 0x2A, 0xBE, 0xA6,
-    0xDF, 0xBB, 0x06, 0xFC, 0x70, 0xDF, 0x3C, 0x13, 0xB7, 0x8A, 0xF8, 0xCC, 0x6E, 0x95, 0xAE, 0x0C,
-    0x0B, 0x22, 0x26, 0xB3, 0xCD, 0x8A, 0xCB, 0x39, 0x55, 0xE1, 0x49, 0x07, 0xE3, 0x63, 0x0C, 0x88,
-    0x60, 0xFF, 0x33, 0x81, 0x18, 0x89, 0x78, 0xB7, 0x41, 0x10, 0xAA, 0xB6, 0x61, 0xAF, 0xCD, 0xAD,
-    0x4C, 0x8A, 0x22, 0xB3, 0xBE, 0xB9, 0x9E, 0x01, 0x71, 0x72, 0x2F, 0x96, 0x1C, 0xF8, 0x3B, 0x04,
-    0x76, 0x0F, 0x4B, 0x86, 0xE6, 0x0A, 0x4B, 0x00, 0xA3, 0x82, 0xAE, 0x3E, 0x7E, 0xFA, 0x50, 0x50,
-    0x7C, 0x58, 0xB0, 0x8B, 0xEC, 0x48, 0x2F, 0x1F, 0x2F, 0xFD, 0x53, 0x16, 0xAB, 0xCB, 0x6F, 0x20,
-    0xF5, 0xE3, 0x82, 0xD6, 0xD9, 0xA8, 0x31, 0x8E, 0x0C, 0x0C, 0x07, 0xC3, 0xC2, 0xF0, 0x20, 0x13,
-    0xC3, 0xC5, 0xB0, 0x31, 0x7C, 0x0C, 0x23, 0xC3, 0xC9, 0xB0, 0x22, 0x2F, 0x21, 0x33, 0xE2, 0x73,
-    0x2E, 0x64, 0xC7, 0x7A, 0x35, 0x64, 0xB1, 0x1B, 0xCA, 0x3E, 0x8B, 0x05, 0x0D, 0x22, 0xB6, 0xC8,
-    0x7E, 0x6E, 0xC7, 0xA1, 0x8E, 0xC5, 0xE2, 0x08, 0x39, 0xAE, 0xC0, 0x54, 0x2B, 0x57, 0x10, 0x6F,
-    0x28, 0x37, 0x5E, 0x72, 0xCC, 0x3C, 0x8A, 0x02, 0x55, 0xC7, 0x31, 0x77, 0xEF, 0x73, 0xFA, 0x5B,
-    0x31, 0xBA, 0xA4, 0xED, 0x1B, 0x48, 0x60, 0xB4, 0xB1, 0x00, 0x10, 0x0B, 0xC2, 0xEB, 0x5A, 0xDC,
-    0xB8, 0x07, 0xF8, 0x55, 0x7A, 0x73, 0x0B, 0x35, 0x7F, 0x8B, 0xE0, 0xDB, 0x2B, 0x58, 0xED, 0x76,
-    0x7F, 0xCE, 0x0A, 0x9D, 0xD1, 0x74, 0x4E, 0x62, 0x67, 0x94, 0x8F, 0xF5, 0xDA, 0x27, 0x65, 0x98,
-    0x8A, 0x77, 0x73, 0xD9, 0x28, 0x89, 0x2C, 0xB6, 0x53, 0xF9, 0x21, 0xDF, 0x72, 0x93, 0x4A, 0x13,
-    0x16, 0xD1, 0x2A, 0xF6, 0xF6, 0x63, 0x1E, 0xBF, 0xB7, 0xAB, 0x67, 0x0A, 0x5A, 0xBA, 0x53, 0xA4,
-    0x25, 0x45, 0x3D, 0x2F, 0x06, 0x8F, 0x99, 0x2B, 0x26, 0x4A, 0xDF, 0x82, 0x26, 0x93, 0x7D, 0xE6,
-    0x47, 0xA6, 0x99, 0x96, 0x43, 0xFA, 0xE5, 0x1C, 0x30, 0x13, 0x9A, 0x1A, 0x99, 0x9C, 0xA4, 0x7C,
-    0xEC, 0xC6, 0x65, 0x3F, 0xA1, 0xFE, 0xB8, 0x2A, 0x0A, 0x22, 0xA9, 0xAD, 0x0F, 0x8D, 0x1C, 0x07,
-    0x71, 0x97, 0x5E, 0x1E, 0x41, 0xE9, 0xA2, 0xA8, 0xB2, 0xCD, 0x30, 0xAD, 0xB2, 0xA4, 0xCE, 0xC0,
-    0xE3, 0xA4, 0x6F, 0x81, 0xAE, 0xBB, 0x87, 0x8A, 0x84, 0x2A, 0xB0, 0xEE, 0x1E, 0x3F, 0xFD, 0x45,
-    0x55, 0x8E, 0xFA, 0x3A, 0x46, 0xDA, 0x4D, 0x83, 0x4D, 0x80, 0xA6, 0xD2, 0x2E, 0xA3, 0x5C, 0x7A,
-    0x29, 0x67, 0x7C, 0xF3, 0x68, 0xD6, 0x21, 0x6E, 0x18, 0x6C, 0xCB, 0x09, 0x8A, 0x88, 0x18, 0x30,
-    0x06, 0x5F, 0xB0, 0xBD, 0xF4, 0x50, 0x7A, 0x7B, 0x33, 0x10, 0xCA, 0x09, 0x41, 0x25, 0x02, 0xBD,
-    0x34, 0x1D, 0x36, 0xA7, 0x99, 0x74, 0xD1, 0x1E, 0x2E, 0x1C, 0x89, 0x0E, 0x32, 0x7C, 0x96, 0xE0,
-    0x2F, 0x47, 0xA4, 0xF3, 0xAD, 0x98, 0xAE, 0x72, 0xE8, 0x8E, 0xF1, 0xCE, 0x0E, 0x5E, 0x62, 0x7A,
-    0xB6, 0xF0, 0x9A, 0x8F, 0xF7, 0x7C, 0x20, 0x7C, 0xAB, 0x53, 0xC4, 0x4D, 0x18, 0xBE, 0x0D, 0xC3,
-    0x77, 0x91, 0xA4, 0x7B, 0x4A, 0xEC, 0x5C, 0x89, 0x97, 0xFA, 0xD2, 0x43, 0x41, 0x9F, 0xA0, 0x3E,
-    0xA1, 0xA5, 0x31, 0xB5, 0xD4, 0x9A, 0x22, 0xFE, 0x9D, 0x6D, 0x90, 0x75, 0xE9, 0xB5, 0x2A, 0x68,
-    0xDC, 0xC8, 0x46, 0xAF, 0x19, 0xD9, 0x7B, 0xC8, 0x4F, 0x67, 0xC2, 0x72, 0xF3, 0x25, 0x64, 0x74,
-    0xDF, 0x43, 0x37, 0xE1, 0xBD, 0x1B, 0x35, 0x44, 0x5D, 0x43, 0xF7, 0x8B, 0x9A, 0x8C, 0x46, 0xD4,
-    0x4E, 0xBB, 0x98, 0xCD, 0x86, 0xC8, 0xA1, 0x1C, 0x05, 0x54, 0x36, 0x32, 0x28, 0x11, 0xC0, 0x52,
-    0xD2, 0x64, 0xB9, 0xF2, 0x59, 0x1A, 0x55, 0x02, 0x21, 0xBD, 0x3A, 0xE6, 0x4D, 0x27, 0x6E, 0x7C,
-    0x5E, 0x76, 0x4A, 0x6E, 0x3D, 0xEF, 0x16, 0xA6, 0x27, 0x87, 0xDE, 0x13, 0x94, 0x2F, 0x14, 0xB6,
-    0x36, 0x17, 0xB5, 0x88, 0x94, 0xDC, 0x33, 0xE0, 0x66, 0x82, 0x22, 0xAC, 0x6E, 0x3E, 0x69, 0xB4,
-    0x78, 0x6B, 0xF3, 0xE7, 0x4D, 0xA6, 0xF7, 0x1E, 0x26, 0x80, 0x06, 0x2A, 0x06, 0xB8, 0xB9, 0xD3,
-    0x02, 0x2E, 0x1F, 0x8D, 0xE5, 0xF9, 0x8B, 0x18, 0xC3, 0xE0, 0x64, 0xF1, 0x06, 0x10, 0x9E, 0x28,
-    0x73, 0x9F, 0xC5, 0xA3, 0x47, 0x40, 0xC9, 0x98, 0x22, 0xD1, 0xDA, 0x09, 0x31, 0x3F, 0xE0, 0x69,
-    0x2B, 0x3D, 0x49, 0xA5, 0x33, 0xFA, 0x3B, 0x1B, 0xEC, 0x9F, 0xFA, 0xBF, 0xF3, 0x5D, 0x97, 0x95,
-    0x9B, 0x32, 0xF6, 0x7F, 0x9A, 0xBA, 0x5F, 0x46, 0xD6, 0x94, 0x6C, 0x9C, 0x27, 0x5A, 0xFD, 0x36,
-    0x69, 0x5B, 0xF9, 0x50, 0xBA, 0xF3, 0x32, 0xCF, 0x02, 0x42, 0x39, 0xDE, 0x8D, 0xD8, 0xA7, 0xCF,
-    0xE4, 0x98, 0x42, 0x0E, 0xA7, 0x80, 0x1C, 0xDE, 0x7B, 0xE0, 0xEA, 0x53, 0x8E, 0x2E, 0x45, 0x40,
-    0xF6, 0x84, 0x4E, 0x02, 0x39, 0xBC, 0x08, 0x72, 0xF8, 0x94, 0xA3, 0x4B, 0x39, 0x72, 0xCA, 0x91,
-    0xD4, 0x72, 0xF8, 0x94, 0xE3, 0x26, 0xE5, 0x78, 0xE5, 0x40, 0xD0, 0xB1, 0xD1, 0xDB, 0x1F, 0xF8,
-    0xE7, 0xAB, 0x69, 0x8B, 0xE9, 0xCF, 0xCC, 0x65, 0x48, 0x36, 0x99, 0xE4, 0x0D, 0x22, 0x66, 0x48,
-    0xC8, 0xE4, 0x2E, 0x0F, 0x69, 0xA4, 0xB8, 0x4E, 0x31, 0x6E, 0x7D, 0x92, 0x69, 0xF2, 0x16, 0x12,
-    0x17, 0x42, 0x2E, 0x0C, 0xB8, 0x30, 0x2C, 0xAD, 0xD7, 0x82, 0xF5, 0x9E, 0x4E, 0x58, 0x19, 0xF3,
-    0xE7, 0x99, 0xB3, 0x3E, 0x1A, 0x20, 0x36, 0xED, 0x1E, 0x37, 0x13, 0x27, 0xC8, 0xBC, 0x63, 0x90,
-    0x0E, 0xFE, 0xB6, 0xFF, 0xCE, 0x52, 0x20, 0x1F, 0x9C, 0x20, 0x73, 0x3B, 0xC9, 0xAA, 0xDB, 0xEC,
-    0x3A, 0x11, 0xBE, 0xE3, 0xD2, 0xE6, 0x6C, 0xAC, 0xE7, 0x6A, 0xCC, 0xF3, 0xA2, 0xAE, 0x09, 0xE4,
-    0x10, 0x9F, 0xA1, 0x34, 0x41, 0x8E, 0x70, 0xAD, 0xC0, 0x56, 0xA1, 0xE5, 0xF0, 0xEE, 0xE1, 0xF5,
-    0x31, 0xB7, 0x7B, 0xCF, 0x97, 0x4E, 0x92, 0x30, 0xE5, 0xB3, 0x3A, 0xDD, 0x98, 0x1D, 0x25, 0x10,
-    0x3F, 0xA6, 0x68, 0xFF, 0x81, 0xE6, 0xE8, 0xA4, 0xF0, 0x8E, 0xE2, 0xD1, 0x4A, 0x84, 0x0D, 0x08,
-    0x87, 0xE6, 0x11, 0x4B, 0x53, 0xEE, 0x21, 0xB8, 0xC7, 0x18, 0xD1, 0xAC, 0xC4, 0xD6, 0xA7, 0x20,
-    0xB3, 0x44, 0x04, 0xDD, 0xD6, 0x13, 0x30, 0xEC, 0x92, 0x22, 0x77, 0x95, 0x92, 0x61, 0x3F, 0x61,
-    0x65, 0xD0, 0xCF, 0x4E, 0x3B, 0x14, 0x86, 0x52, 0x7D, 0x8A, 0x87, 0xEE, 0x03, 0xD3, 0xDC, 0x66,
-    0x44, 0xCE, 0x09, 0x25, 0x6A, 0x51, 0x24, 0xC5, 0xFD, 0x38, 0x24, 0x6D, 0x96, 0x56, 0x44, 0xC7,
-    0x14, 0xBC, 0x33, 0x42, 0x94, 0x77, 0xAA, 0x63, 0x90, 0x32, 0xE8, 0xF3, 0x72, 0x9B, 0x85, 0x68,
-    0x20, 0xF2, 0x76, 0xEA, 0xE3, 0x9B, 0xB2, 0x1B, 0x2B, 0x4F, 0x81, 0x66, 0x0D, 0xD0, 0x45, 0x4B,
-    0x5B, 0xC5, 0x17, 0x91, 0xFB, 0x68, 0x04, 0x8D, 0x3A, 0xB4, 0x32, 0xE8, 0x36, 0x59, 0x50, 0x4C,
-    0xAF, 0x8C, 0xFC, 0x15, 0xA6, 0xDD, 0xD0, 0x1A, 0xCB, 0x8E, 0x9B, 0x4B, 0xE7, 0x5E, 0x5F, 0xFC,
-    0x7C, 0xBF, 0x8B, 0xDB, 0x95, 0x07, 0x68, 0x22, 0x7D, 0x3C, 0x34, 0x79, 0xBC, 0xA2, 0xA0, 0x44,
-    0x00, 0x3B, 0xA6, 0x0B, 0x47, 0xA7, 0x79, 0x4A, 0xB4, 0xD9, 0x5D, 0xFC, 0x07, 0xD0, 0x53, 0xEF,
-    0x2D, 0x8E, 0x2A, 0x63, 0xD0, 0x2C, 0xF7, 0x0F, 0xF5, 0x75, 0x14, 0x7A, 0xF5, 0x7E, 0x61, 0x09,
-    0x58, 0x71, 0x05, 0xFB, 0x85, 0xC5, 0x41, 0xD9, 0x61, 0x1F, 0x95, 0xEE, 0x55, 0xEB, 0x1C, 0x3A,
-    0xC4, 0xCF, 0x47, 0xB9, 0xFB, 0xE8, 0xC9, 0xC3, 0x1D, 0xA5, 0x7B, 0x11, 0xF6, 0x05, 0x1D, 0x76,
-    0x44, 0xA1, 0x95, 0x77, 0xA5, 0x3D, 0x4A, 0x86, 0xD2, 0x9B, 0x82, 0xC6, 0x98, 0xC1, 0x88, 0xDB,
-    0xD8, 0x41, 0xC1, 0xDA, 0xF1, 0x26, 0xA2, 0x3B, 0xF7, 0x8A, 0xC7, 0x89, 0xFF, 0xD5, 0x67, 0x45,
-    0x54, 0x89, 0x71, 0xC7, 0x2A, 0x72, 0xF7, 0xE1, 0x0D, 0x64, 0x46, 0xBB, 0x6E, 0x9C, 0xCA, 0xAE,
-    0x29, 0xAF, 0xF7, 0xBB, 0x9D, 0x8F, 0x22, 0xAF, 0xD0, 0x96, 0x39, 0x78, 0x31, 0x91, 0x2D, 0xDF,
-    0x47, 0xA3, 0x54, 0xAE, 0x0F, 0xEA, 0x16, 0xB3, 0x0C, 0x91, 0x8B, 0xD0, 0x29, 0x73, 0xBF, 0x1A,
-    0x2B, 0xBD, 0x01, 0x35, 0x02, 0x3B, 0xDB, 0x1C, 0x25, 0xA3, 0xA9, 0x11, 0xA3, 0xA2, 0xA6, 0x3B,
-    0x1F, 0xC5, 0x5E, 0xCD, 0x1C, 0x32, 0x91, 0x22, 0xE8, 0x96, 0xF9, 0x7D, 0xD8, 0xE5, 0xC8, 0x9A,
-    0x16, 0x3A, 0xA3, 0xCC, 0x8E, 0xAF, 0xBC, 0xCC, 0xF2, 0x41, 0x20, 0x59, 0xBD, 0x23, 0x3D, 0xDC,
-    0x5A, 0x37, 0x76, 0xD8, 0x8C, 0xAD, 0xE3, 0xEB, 0xAA, 0x39, 0x38, 0x8A, 0x5D, 0x1E, 0xCB, 0x46,
-    0xE5, 0xB1, 0x6C, 0x13, 0xFE, 0x0B, 0xCA, 0x0A, 0xC5, 0x4C, 0x6E, 0x9A, 0x56, 0xB4, 0x6C, 0x16,
-    0x56, 0x9F, 0xF5, 0xA1, 0x48, 0x74, 0xC0, 0x12, 0x81, 0x4B, 0x1F, 0x6C, 0x5E, 0xAB, 0xA3, 0x46,
-    0xD4, 0x52, 0x74, 0x8D, 0x6F, 0xC8, 0x95, 0xD2, 0xB8, 0x87, 0x59, 0xAB, 0xDC, 0x48, 0x79, 0x35,
-    0x3E, 0x1C, 0x8A, 0xA9, 0x9C, 0xB7, 0xB5, 0xF8, 0xDB, 0x5A, 0x1C, 0xE8, 0xEE, 0x43, 0xF9, 0x9B,
-    0x78, 0x30, 0xDF, 0x28, 0xDB, 0xCC, 0x3F, 0xBF, 0x01, 0xAC, 0x43, 0x13, 0x1B, 0x8D, 0xB0, 0x08,
-    0x01, 0x87, 0xA0, 0x05, 0x08, 0xC3, 0x44, 0xA8, 0xED, 0x20, 0xC0, 0x43, 0xB5, 0x1D, 0x38, 0xB4,
-    0xB3, 0x0D, 0x48, 0x9E, 0xD6, 0xA5, 0x02, 0x6D, 0x82, 0x4A, 0x53, 0x69, 0x60, 0x4B, 0xB2, 0x7C,
-    0x49, 0x97, 0x79, 0x71, 0x57, 0xEC, 0x2F, 0x0A, 0xED, 0x3C, 0x79, 0x2B, 0x76, 0xC6, 0x30, 0x5D,
-    0xCA, 0x33, 0x37, 0x37, 0x56, 0xA5, 0x09, 0x2B, 0xE8, 0xA5, 0x21, 0xCB, 0xA4, 0x20, 0xD8, 0x77,
-    0x2B, 0x01, 0x4D, 0x23, 0xC3, 0xAE, 0xB3, 0x3C, 0xAC, 0xA1, 0xDF, 0x72, 0xEF, 0xD1, 0x8E, 0xAF,
-    0xDB, 0x6D, 0xF1, 0x03, 0xF1, 0x51, 0x1E, 0x20, 0x52, 0xCE, 0xA6, 0x22, 0x18, 0xCA, 0xB0, 0x6B,
-    0x65, 0xAD, 0xED, 0xC4, 0x9B, 0xCA, 0xC1, 0x88, 0x3B, 0x27, 0x2F, 0xB3, 0x9C, 0xF5, 0x2A, 0x93,
-    0xE1, 0xC0, 0x4A, 0x96, 0x0E, 0xBD, 0xFC, 0x82, 0x85, 0x0A, 0xFE, 0xBA, 0x58, 0x8F, 0x27, 0x90,
-    0x7D, 0x58, 0x87, 0x1D, 0xB6, 0xCF, 0xB9, 0x80, 0x04, 0x36, 0xB1, 0x6D, 0xA4, 0x20, 0x6B, 0x9B,
-    0x2F, 0xAC, 0x71, 0xA5, 0x61, 0xDB, 0xC6, 0xB0, 0x43, 0xE2, 0x01, 0xB7, 0x27, 0x30, 0xEC, 0x3E,
-    0x5D, 0x10, 0xA8, 0x0C, 0x62, 0x39, 0xBC, 0x2A, 0x67, 0xAB, 0xAA, 0xD1, 0x32, 0x28, 0x5A, 0x9D,
-    0xDE, 0xD6, 0x67, 0xC8, 0xD5, 0xB5, 0x58, 0xB5, 0x1D, 0xD5, 0x41, 0xAC, 0x9C, 0xF9, 0x5D, 0x8C,
-    0x1D, 0x53, 0x64, 0xEF, 0xBE, 0xAD, 0xDD, 0xB8, 0x03, 0x47, 0x7D, 0x1C, 0x2B, 0xEB, 0x5F, 0xF1,
-    0xA2, 0xFB, 0x59, 0xDC, 0x40, 0xBC, 0x85, 0x81, 0xA7, 0xC3, 0x81, 0x42, 0x46, 0x36, 0xC5, 0x8F,
-    0x51, 0xFF, 0x1F, 0x83, 0x35, 0xC8, 0xCD, 0x9A, 0x38, 0xEE, 0x57, 0x59, 0x80, 0x59, 0x94, 0xA5,
-    0x44, 0xC1, 0xD3, 0x08, 0x05, 0x74, 0x89, 0xC6, 0xE1, 0xCA, 0x34, 0xAD, 0x74, 0xFA, 0xA2, 0x71,
-    0x7A, 0x60, 0x9C, 0xDE, 0x45, 0xEE, 0x3C, 0x43, 0xC1, 0x1E, 0x50, 0xB0, 0xF5, 0x9D, 0x2A, 0x35,
-    0xAC, 0x0E, 0xED, 0xA3, 0xE3, 0xA1, 0xC9, 0xE6, 0x81, 0x55, 0x2A, 0x84, 0x65, 0x3F, 0x38, 0x7F,
-    0x3C, 0x34, 0x83, 0xC5, 0xB2, 0xB2, 0x54, 0xD7, 0xD1, 0xF5, 0xA6, 0x90, 0xDC, 0x0B, 0xFA, 0xCF,
-    0x3A, 0xD1, 0x55, 0x90, 0xAD, 0x4B, 0x07, 0x8B, 0x07, 0x40, 0x4C, 0x02, 0x1E, 0xB0, 0x22, 0xDD,
-    0x43, 0x1E, 0xA8, 0x82, 0xFF, 0x42, 0x50, 0x56, 0xA1, 0x39, 0xEA, 0x98, 0x94, 0x67, 0x38, 0xF4,
-    0x49, 0xAB, 0x6A, 0xA9, 0x91, 0xF3, 0x3D, 0x3C, 0xEA, 0x45, 0x95, 0xBF, 0xBE, 0x73, 0xE6, 0x7D,
-    0x51, 0xE4, 0xAF, 0x48, 0xE4, 0xA7, 0xEF, 0x67, 0x68, 0xF6, 0x33, 0x88, 0xC7, 0x23, 0xA6, 0x0C,
-    0xF8, 0x92, 0x39, 0x89, 0x95, 0x39, 0xB1, 0x9D, 0x11, 0x1B, 0x4D, 0x32, 0xA7, 0xBE, 0x56, 0x9B,
-    0x53, 0x51, 0x7E, 0xFE, 0x62, 0x52, 0x33, 0x55, 0xFE, 0x86, 0x84, 0xBC, 0x9F, 0xCE, 0x54, 0x3B,
-    0x66, 0x3D, 0xFE, 0x0B, 0xBD, 0x5A, 0x3F, 0x6C, 0x24, 0xE5, 0x15, 0x7F, 0x33, 0xE3, 0x63, 0x50,
-    0x46, 0xF8, 0x73, 0x71, 0x17, 0x10, 0x70, 0x9E, 0x2B, 0x09, 0xB2, 0x77, 0x52, 0x50, 0xB8, 0x98,
-    0xDD, 0xFD, 0x10, 0x52, 0x52, 0x5C, 0x91, 0x2D, 0x70, 0x95, 0x82, 0x94, 0x49, 0x8A, 0x40, 0x71,
-    0xC5, 0x46, 0xDA, 0xBB, 0x1D, 0x42, 0x41, 0x41, 0x01, 0x05, 0x28, 0x25, 0x57, 0x50, 0x90, 0xA3,
-    0x38, 0x47, 0x72, 0xA4, 0x91, 0xE2, 0x63, 0x07, 0x28, 0xAE, 0xB8, 0x22, 0x13, 0x11, 0x74, 0x45,
-    0xA4, 0x63, 0x08, 0x9C, 0xF2, 0xA7, 0x08, 0xA3, 0x64, 0x4E, 0x2C, 0x60, 0xEF, 0xE4, 0xF7, 0xDE,
-    0xF7, 0xCD, 0x7A, 0xED, 0xB3, 0xC3, 0xD9, 0xB7, 0xBE, 0xB5, 0x67, 0xE5, 0x5D, 0xCF, 0xF7, 0xDE,
-    0xEF, 0xBD, 0xEF, 0xFD, 0xFF, 0x86, 0x68, 0xB8, 0x43, 0x34, 0xDA, 0x26, 0x79, 0xA9, 0x84, 0x28,
-    0xCC, 0x88, 0xBA, 0xB8, 0xFE, 0x88, 0xEB, 0xBF, 0x19, 0xB9, 0x9F, 0xE7, 0xE4, 0x7D, 0x98, 0x53,
-    0xF0, 0x9B, 0x82, 0x42, 0xA7, 0xA0, 0x8E, 0x53, 0xD2, 0xA5, 0x2B, 0x25, 0xD5, 0x75, 0xE9, 0xDC,
-    0x59, 0x2F, 0xBD, 0x9C, 0xAA, 0x20, 0xA3, 0x4A, 0x69, 0x4A, 0x23, 0xA2, 0xB4, 0x4D, 0x34, 0x10,
-    0x92, 0x43, 0x4B, 0xF2, 0x71, 0x47, 0x3B, 0xF5, 0xCD, 0xC4, 0xBF, 0x3D, 0xD2, 0x4A, 0x77, 0x29,
-    0xC2, 0x4F, 0x9B, 0x5A, 0xB8, 0xA9, 0x45, 0x29, 0xFE, 0x4A, 0xF1, 0x57, 0x45, 0xDB, 0x94, 0x3A,
-    0x63, 0xDA, 0xF2, 0x2B, 0xEA, 0x5E, 0xDB, 0xA0, 0xB0, 0x2A, 0xCD, 0x5A, 0x5A, 0x3A, 0x45, 0x74,
-    0xE1, 0x2C, 0xF0, 0x80, 0x58, 0x50, 0xCC, 0x15, 0xE3, 0x39, 0x90, 0x7E, 0x66, 0x79, 0x2F, 0xE9,
-    0xFB, 0xC2, 0x3A, 0x27, 0x5C, 0x44, 0x00, 0xE3, 0x81, 0x96, 0x22, 0x73, 0x31, 0x38, 0x47, 0x1F,
-    0x1B, 0x9B, 0x0B, 0x28, 0x01, 0xC8, 0x9C, 0xB5, 0x97, 0xCA, 0x84, 0x9C, 0x79, 0x01, 0x0F, 0x79,
-    0x99, 0xE1, 0xB3, 0x62, 0xBE, 0x72, 0xEB, 0x82, 0xA2, 0x7A, 0x4C, 0x13, 0x3A, 0xE7, 0xE2, 0xBF,
-    0x7E, 0x6E, 0x25, 0xC3, 0xBF, 0x80, 0x11, 0x9C, 0xCC, 0x15, 0xDB, 0x8B, 0xFF, 0xEE, 0xD8, 0xFF,
-    0x31, 0x69, 0x7F, 0x32, 0x21, 0xA7, 0xDE, 0xA1, 0xE9, 0x6B, 0x4C, 0x6E, 0x41, 0x7E, 0x42, 0x8B,
-    0x46, 0xC3, 0x6F, 0x38, 0x75, 0xE5, 0x7F, 0xF1, 0x33, 0x88, 0xDC, 0x11, 0x02, 0x10, 0x38, 0x25,
-    0x20, 0xE7, 0xDF, 0x54, 0x3E, 0x76, 0xDF, 0x4B, 0x82, 0x5A, 0x4F, 0xD7, 0x47, 0xF8, 0x73, 0x04,
-    0x55, 0xFE, 0x2D, 0x27, 0x5F, 0x6F, 0x9C, 0x04, 0x44, 0x7C, 0xD7, 0xC5, 0x4E, 0x94, 0x6E, 0xF2,
-    0xCC, 0xD1, 0x21, 0xC2, 0x8A, 0x84, 0x31, 0x5F, 0x0B, 0xF3, 0xD7, 0xA0, 0x23, 0x6B, 0x01, 0xC5,
-    0x39, 0x9E, 0xFA, 0xDC, 0xBC, 0x4F, 0xF4, 0x1F, 0x58, 0xD0, 0x10, 0x08, 0x5A, 0x27, 0xB2, 0xC3,
-    0xE5, 0x0A, 0xF5, 0x4B, 0xB6, 0xFA, 0x50, 0x1F, 0x0B, 0xA2, 0x97, 0x6D, 0x92, 0xF3, 0x39, 0x08,
-    0x8F, 0x2C, 0x33, 0xBC, 0xEA, 0x7F, 0x80, 0x45, 0x9D, 0xB8, 0x45, 0x58, 0x78, 0xB9, 0x5B, 0xC2,
-    0x44, 0xC7, 0x7E, 0x46, 0x5B, 0x41, 0x42, 0x03, 0xD0, 0xE5, 0x6B, 0x0B, 0x26, 0x9B, 0x02, 0xF2,
-    0xB8, 0x05, 0x23, 0x6E, 0x93, 0x57, 0xC6, 0x14, 0xE4, 0x31, 0x45, 0xC9, 0xC0, 0x99, 0xD0, 0xA8,
-    0xAE, 0xA8, 0x9E, 0x68, 0x31, 0x70, 0x76, 0x01, 0xD8, 0x0E, 0x79, 0x1F, 0x43, 0x46, 0xEF, 0x06,
-    0x19, 0x83, 0x7F, 0x1C, 0xE4, 0x9C, 0xFA, 0xAF, 0x09, 0x05, 0xF0, 0x27, 0x62, 0x87, 0x02, 0xDA,
-    0x88, 0xC4, 0xA5, 0x00, 0x71, 0x95, 0xC4, 0xA9, 0xC4, 0xAB, 0xC4, 0xAD, 0xC4, 0xAF, 0xC4, 0xB1,
-    0xC4, 0xB3, 0x66, 0xDC, 0x9E, 0xBA, 0xDF, 0x40, 0xBB, 0x50, 0x69, 0xEA, 0x8F, 0x71, 0xEB, 0x16,
-    0x95, 0xE2, 0xE6, 0x11, 0xAC, 0x3E, 0x84, 0x83, 0x87, 0x51, 0x9D, 0x45, 0xDD, 0x3A, 0x6B, 0x81,
-    0x61, 0xC7, 0xE2, 0xDF, 0x56, 0xE4, 0x56, 0x0A, 0x8E, 0x1D, 0x62, 0x5B, 0x22, 0xA8, 0xB2, 0x5B,
-    0xBF, 0x61, 0x9D, 0x11, 0xAB, 0xBC, 0x7A, 0x9B, 0x7C, 0x5C, 0x8C, 0xF3, 0x69, 0x3F, 0x73, 0x81,
-    0x32, 0x28, 0x46, 0x3A, 0x04, 0x46, 0x86, 0x18, 0x8B, 0xD3, 0xAF, 0x7E, 0x77, 0x40, 0x8A, 0x6A,
-    0x73, 0x89, 0x3E, 0xEB, 0xC4, 0xE8, 0x13, 0x54, 0x73, 0xA3, 0x01, 0x9F, 0xE3, 0x02, 0x87, 0x99,
-    0xB7, 0x7A, 0xA4, 0x60, 0x0D, 0xEA, 0xCA, 0x3B, 0x62, 0x02, 0xAD, 0x7D, 0xDB, 0xCF, 0x11, 0x69,
-    0x54, 0xE7, 0x20, 0x81, 0x05, 0xB8, 0x0F, 0xAA, 0xE5, 0x5D, 0x46, 0x30, 0x2A, 0xFD, 0xCF, 0xC6,
-    0x4A, 0xF7, 0x11, 0x7F, 0x62, 0xB7, 0xBC, 0x34, 0xCA, 0x47, 0x13, 0x38, 0xFB, 0x74, 0x97, 0x75,
-    0xF7, 0xBD, 0x2C, 0xA8, 0x13, 0xBE, 0xF9, 0x34, 0xE2, 0xCD, 0x8A, 0x0F, 0x35, 0x4F, 0x88, 0x1E,
-    0xAA, 0xE6, 0x8B, 0x48, 0x3F, 0x4C, 0xC5, 0x0A, 0x8D, 0x2A, 0x0A, 0x93, 0x23, 0xE3, 0xA2, 0x1E,
-    0x9B, 0xAF, 0x51, 0x3C, 0xE9, 0xF9, 0xE2, 0x82, 0xBF, 0x22, 0xB4, 0x63, 0x99, 0x75, 0xDC, 0xA3,
-    0xE0, 0x9A, 0x17, 0x06, 0x0E, 0xB9, 0x6B, 0xB8, 0x36, 0xEC, 0x35, 0xB4, 0xF1, 0xEA, 0xDE, 0xC1,
-    0xC0, 0x0F, 0x2E, 0x88, 0x8A, 0xF0, 0x8B, 0xCD, 0x3B, 0x6D, 0x74, 0x74, 0x16, 0xE1, 0x5C, 0xFD,
-    0x0A, 0xC0, 0xC6, 0x62, 0xB0, 0x73, 0xD5, 0x1B, 0xEF, 0xC8, 0x2A, 0xC5, 0x15, 0x45, 0x39, 0x87,
-    0xBD, 0x23, 0x6F, 0xA9, 0x0D, 0xE8, 0x1C, 0xD1, 0x09, 0xBE, 0xEF, 0x99, 0x98, 0x8E, 0x98, 0x07,
-    0x8A, 0xF0, 0xB4, 0x09, 0x3D, 0xE6, 0x56, 0x7B, 0x63, 0x9E, 0x81, 0x73, 0xE6, 0xF9, 0x36, 0x75,
-    0xAB, 0x98, 0x9E, 0xC6, 0x45, 0x08, 0x28, 0x4E, 0xD9, 0x81, 0x6C, 0x11, 0x84, 0x51, 0x99, 0x97,
-    0xF9, 0x13, 0x60, 0x1B, 0x4D, 0x76, 0xB3, 0x12, 0x47, 0x03, 0x0F, 0x3E, 0x1A, 0x22, 0x0C, 0xAD,
-    0xF9, 0xE6, 0xFB, 0x87, 0x92, 0x1E, 0x0D, 0xEF, 0x14, 0xEE, 0xD7, 0x2F, 0xE6, 0xBC, 0x2A, 0xC0,
-    0x8F, 0xD2, 0x41, 0x12, 0x82, 0x53, 0x0B, 0xB2, 0xB4, 0xC0, 0x0D, 0x3C, 0xC0, 0xEF, 0x12, 0x45,
-    0xCE, 0x0E, 0xA9, 0x2F, 0x07, 0xE4, 0xEF, 0x34, 0x0A, 0x48, 0xC5, 0x14, 0x7B, 0x5E, 0x81, 0x58,
-    0x92, 0x51, 0x24, 0xE1, 0x35, 0x41, 0x42, 0x29, 0xB0, 0x81, 0x35, 0xB4, 0x1F, 0x25, 0x73, 0x97,
-    0x63, 0x01, 0x6E, 0x79, 0x96, 0xDD, 0x12, 0x41, 0xC2, 0x1D, 0xD3, 0xC9, 0xC8, 0xE0, 0xD8, 0xCA,
-    0x88, 0xF7, 0xD2, 0xA1, 0xF9, 0xEF, 0xC5, 0x12, 0x89, 0x1D, 0x50, 0xB9, 0x5B, 0x71, 0xCC, 0x5D,
-    0x86, 0x39, 0x63, 0x3E, 0x65, 0x0B, 0xBB, 0x55, 0xEB, 0x9E, 0xE7, 0x1A, 0xE0, 0x4F, 0xDA, 0x2F,
-    0x38, 0x24, 0x15, 0x27, 0x27, 0x0B, 0x9C, 0x43, 0x3C, 0x96, 0xF3, 0xE1, 0xC7, 0x52, 0x1D, 0x16,
-    0x4D, 0x2A, 0x07, 0x2E, 0x04, 0xC3, 0x90, 0xBD, 0xBA, 0xC5, 0x7E, 0xDC, 0x66, 0x47, 0x8E, 0xD9,
-    0x93, 0x63, 0x76, 0xE5, 0x01, 0x05, 0x6F, 0xAD, 0xA7, 0x30, 0x18, 0x68, 0x43, 0x5D, 0xB9, 0xC2,
-    0x77, 0xE2, 0xF6, 0x16, 0xDF, 0xDE, 0x46, 0xA9, 0x81, 0x9B, 0x3C, 0x79, 0xCB, 0x70, 0x27, 0xD6,
-    0xA4, 0xBC, 0xA6, 0xB2, 0x6E, 0x6C, 0xB8, 0x82, 0x29, 0xF3, 0xDC, 0x65, 0x39, 0x03, 0xB5, 0xD9,
-    0x46, 0x11, 0xFF, 0xE7, 0xE4, 0xDE, 0xAC, 0xB5, 0xF7, 0xEF, 0x9F, 0x66, 0x5E, 0x05, 0xFD, 0x15,
-    0x1E, 0x24, 0xF7, 0xB3, 0x20, 0x09, 0x12, 0x85, 0xFA, 0x57, 0x01, 0x28, 0x74, 0x40, 0x46, 0xFE,
-    0x16, 0x78, 0xB6, 0x71, 0xC5, 0x56, 0x82, 0xA2, 0x91, 0xA0, 0x5B, 0xD7, 0x75, 0x31, 0xC4, 0x5B,
-    0xEE, 0x33, 0x24, 0x91, 0x40, 0xBD, 0xB5, 0x3E, 0x3E, 0x44, 0x02, 0x28, 0xEA, 0x70, 0x09, 0x2C,
-    0x4A, 0x9F, 0x17, 0x72, 0x0E, 0x14, 0x94, 0xCF, 0x93, 0xFB, 0x71, 0x4D, 0xDE, 0xA7, 0x2F, 0x64,
-    0x1E, 0x0A, 0x14, 0x46, 0xE9, 0xDF, 0x0B, 0xCA, 0x05, 0x78, 0xC2, 0xF0, 0x15, 0x4D, 0xDF, 0xD6,
-    0xE4, 0x64, 0x7D, 0xA3, 0x05, 0xA4, 0x30, 0x1A, 0x16, 0xC6, 0x32, 0xF6, 0x47, 0x49, 0xE6, 0xDD,
-    0xDF, 0xAB, 0x25, 0x5B, 0x2C, 0x4C, 0x83, 0xED, 0x13, 0x5F, 0x98, 0x96, 0xCB, 0xA1, 0x25, 0x55,
-    0x14, 0xED, 0x3A, 0xFB, 0xE1, 0xB2, 0x4D, 0x71, 0x5C, 0x52, 0xE4, 0x7C, 0x0F, 0xE4, 0x41, 0xE0,
-    0x0E, 0xA4, 0x9C, 0x54, 0xC2, 0xA4, 0x25, 0x2C, 0x62, 0xC3, 0x04, 0x4D, 0x9B, 0xE9, 0xD9, 0x80,
-    0x04, 0x40, 0xF6, 0xDD, 0x31, 0x10, 0x04, 0xA6, 0x90, 0x2B, 0x99, 0xFB, 0x94, 0x2C, 0x38, 0x63,
-    0x9D, 0xAA, 0x93, 0xD0, 0xD4, 0x74, 0xF7, 0xCE, 0x11, 0xDD, 0x1D, 0x9A, 0x3B, 0x34, 0x60, 0xA6,
-    0xFF, 0x3A, 0x16, 0xDF, 0x87, 0x49, 0x2F, 0x7A, 0x09, 0x42, 0x98, 0x8D, 0x60, 0xF7, 0xCE, 0xFD,
-    0x58, 0xEC, 0xD0, 0x4D, 0x29, 0xE9, 0xA3, 0x56, 0xA5, 0xD9, 0xE3, 0x46, 0x6A, 0x01, 0xAB, 0x3B,
-    0x52, 0xFB, 0x9F, 0xC6, 0xC2, 0x8A, 0x4A, 0xA7, 0x74, 0x0A, 0x17, 0x75, 0xAB, 0x27, 0xA6, 0x60,
-    0xCC, 0x60, 0x11, 0x8E, 0xBD, 0x01, 0x8A, 0x23, 0x3A, 0x23, 0xB5, 0x86, 0xA1, 0x39, 0xDD, 0xF9,
-    0xA3, 0x03, 0xA1, 0x5E, 0xC3, 0xC2, 0x37, 0xD6, 0x86, 0xD5, 0xAD, 0xC6, 0xBE, 0x46, 0xA8, 0x2E,
-    0x41, 0x33, 0x24, 0x31, 0x3E, 0xB1, 0x3E, 0x31, 0x3F, 0xF9, 0x3F, 0x7E, 0x07, 0x4C, 0x3F, 0x65,
-    0x0E, 0x92, 0x42, 0x61, 0x4A, 0x15, 0xDB, 0x13, 0x90, 0x83, 0x13, 0x18, 0x31, 0x69, 0x62, 0xEA,
-    0xC4, 0x0C, 0xC0, 0x11, 0x4A, 0x1C, 0x6E, 0x8B, 0x1F, 0xCB, 0x1B, 0xB7, 0x02, 0x67, 0xAE, 0xB1,
-    0x4B, 0x8F, 0xA5, 0xE2, 0xE7, 0xBD, 0x84, 0x2A, 0x52, 0xDF, 0xD4, 0xE9, 0x4B, 0x36, 0xD0, 0xF7,
-    0x4E, 0x81, 0x92, 0x02, 0xA1, 0x10, 0x74, 0x5A, 0xD8, 0x8F, 0x36, 0x36, 0x84, 0x03, 0x09, 0xBC,
-    0x50, 0xF7, 0x81, 0x6D, 0x13, 0xD0, 0x2A, 0x20, 0x2B, 0xA9, 0x0D, 0xD6, 0x31, 0x38, 0xC7, 0xAE,
-    0xB5, 0xE7, 0xA6, 0x80, 0x00, 0x3F, 0x77, 0x26, 0x3F, 0x1D, 0x1C, 0x45, 0xE2, 0xBB, 0xA3, 0x48,
-    0xE3, 0x1F, 0x07, 0x16, 0x24, 0x7A, 0xB7, 0xBB, 0xDE, 0xEF, 0x6A, 0x5B, 0x44, 0x3F, 0x02, 0x09,
-    0xD4, 0xF3, 0x74, 0x65, 0x1A, 0xA1, 0xB8, 0x18, 0x47, 0xF4, 0x54, 0x3F, 0x21, 0x7A, 0xCA, 0xB3,
-    0xD1, 0xAC, 0x77, 0x37, 0x6D, 0x58, 0x1B, 0x05, 0x7A, 0x97, 0xFE, 0x61, 0xC5, 0x8E, 0x85, 0xC9,
-    0x10, 0xB9, 0x4C, 0xE9, 0x6A, 0x81, 0x9C, 0xC2, 0x6A, 0xA0, 0xFC, 0x20, 0xF3, 0x72, 0xA4, 0x8D,
-    0x6C, 0x8B, 0xFC, 0x0F, 0x4B, 0x0A, 0x5E, 0x83, 0xC1, 0xBD, 0x48, 0x52, 0x3A, 0xAB, 0x2F, 0x41,
-    0xF2, 0x7C, 0x42, 0xDC, 0x4A, 0xB4, 0x39, 0x4C, 0xA1, 0x7B, 0x8B, 0x41, 0x88, 0xB7, 0xD2, 0x74,
-    0x02, 0x1D, 0x9A, 0x2D, 0x6B, 0x45, 0x95, 0x89, 0x4D, 0xBB, 0x07, 0xA8, 0xC7, 0x29, 0x4E, 0x69,
-    0x74, 0x58, 0xDA, 0xCB, 0x2F, 0x92, 0xF7, 0x41, 0x45, 0xFE, 0xF5, 0x9C, 0x82, 0xB7, 0x35, 0x05,
-    0xEF, 0x93, 0xD4, 0x04, 0xEA, 0x75, 0x4D, 0x21, 0x78, 0xB5, 0x38, 0x11, 0x58, 0x5E, 0xB1, 0x10,
-    0x21, 0x53, 0x0A, 0x56, 0x26, 0x4F, 0xB1, 0xF8, 0xAE, 0xD9, 0xEF, 0x63, 0xD3, 0xF3, 0xA5, 0xDA,
-    0x83, 0xA2, 0x5E, 0xB2, 0x89, 0xC8, 0x29, 0xF6, 0x38, 0xB2, 0xF5, 0xE2, 0x83, 0x1C, 0x79, 0x20,
-    0xD5, 0xA3, 0x2D, 0x1E, 0xBD, 0x92, 0xCB, 0xEE, 0xD0, 0xE4, 0xD1, 0x26, 0xBB, 0x34, 0x5E, 0xB4,
-    0xCF, 0x91, 0x0C, 0xD9, 0xE0, 0x10, 0xB2, 0xC7, 0xC7, 0xD0, 0x63, 0xCD, 0x43, 0xF1, 0x01, 0x21,
-    0x3A, 0xD1, 0x8C, 0x5F, 0x0E, 0x9A, 0xF8, 0xE0, 0x16, 0x6E, 0xBE, 0x37, 0x3E, 0x70, 0x55, 0xB0,
-    0x8C, 0x5B, 0x5E, 0xE2, 0xCD, 0x2B, 0x17, 0x9D, 0x62, 0xD5, 0x2D, 0xD6, 0xBC, 0x7C, 0xE3, 0x08,
-    0x9C, 0x07, 0x20, 0x5F, 0xD1, 0x9D, 0x82, 0xFE, 0x9B, 0xCC, 0x43, 0x50, 0xAD, 0x9E, 0x2D, 0x95,
-    0x5B, 0x86, 0xA4, 0x0F, 0x61, 0x77, 0x88, 0x5E, 0x3F, 0x20, 0xFF, 0x46, 0x12, 0xBC, 0x9E, 0x04,
-    0xCF, 0x1E, 0xC2, 0xCE, 0x2C, 0xDC, 0x17, 0xD9, 0x6E, 0x26, 0x5E, 0xAD, 0xD1, 0xC1, 0x46, 0x28,
-    0x93, 0x12, 0x9E, 0x24, 0x28, 0xB2, 0x6B, 0xA3, 0xBA, 0xEA, 0xA2, 0x00, 0xB6, 0xBA, 0x33, 0xDA,
-    0xF3, 0xFE, 0xE2, 0x6D, 0xFB, 0x55, 0x94, 0x71, 0x57, 0xBC, 0x27, 0xF0, 0xD9, 0x17, 0x1B, 0x39,
-    0x3B, 0xA6, 0x78, 0xA3, 0x4C, 0xBD, 0xA4, 0x14, 0x85, 0x49, 0x26, 0x08, 0x24, 0x41, 0xE2, 0x22,
-    0x5F, 0x69, 0x78, 0x34, 0x62, 0xD3, 0xA7, 0x58, 0xEE, 0xBF, 0x0E, 0xDD, 0x07, 0xAF, 0x25, 0xAB,
-    0xA4, 0x7E, 0x8C, 0x18, 0xA5, 0xBC, 0x3C, 0x26, 0xE5, 0x16, 0x03, 0x7C, 0x5B, 0xA6, 0x88, 0xF4,
-    0xD5, 0x26, 0xE8, 0xF7, 0xD9, 0x60, 0x63, 0x06, 0xD2, 0x2A, 0x11, 0x38, 0xC3, 0x02, 0xD1, 0x4B,
-    0xE5, 0x24, 0xF6, 0xB6, 0x3B, 0x00, 0x8C, 0x6C, 0xA6, 0x36, 0x81, 0xC9, 0xD1, 0xBF, 0x33, 0x65,
-    0xCC, 0x97, 0x4D, 0x81, 0xE0, 0x4B, 0x19, 0xA3, 0x4C, 0xC8, 0x4E, 0xB0, 0xF3, 0x3A, 0x14, 0xFC,
-    0x66, 0x98, 0xD7, 0xC6, 0xCF, 0x00, 0x6C, 0x4E, 0x1A, 0xE9, 0x99, 0x26, 0x68, 0x0A, 0x56, 0x53,
-    0x3B, 0x27, 0xF7, 0x81, 0x77, 0x1A, 0x11, 0xFA, 0x36, 0xBA, 0xE4, 0x33, 0x33, 0x46, 0x7C, 0xE2,
-    0xE0, 0xF3, 0x07, 0xE6, 0xC2, 0xB3, 0x51, 0xD1, 0xD1, 0x03, 0xD8, 0x0F, 0x05, 0x2F, 0x04, 0x25,
-    0x72, 0xB7, 0xAD, 0x45, 0x1C, 0x5F, 0xBE, 0xC0, 0x24, 0x22, 0x09, 0xE8, 0x12, 0xCC, 0x7B, 0x4F,
-    0xEB, 0x8D, 0x3B, 0x75, 0xAE, 0xBF, 0xFD, 0x6D, 0x49, 0x3B, 0xC8, 0xF7, 0x63, 0x58, 0x25, 0x2C,
-    0xD3, 0x33, 0x79, 0x1F, 0xD5, 0x26, 0x5F, 0x52, 0x08, 0x66, 0xBB, 0x74, 0xD5, 0x77, 0x49, 0x7C,
-    0x9E, 0x25, 0x7E, 0x6E, 0x2A, 0xB1, 0xB3, 0x2B, 0xF1, 0x26, 0x4B, 0x3C, 0x60, 0x89, 0xDB, 0x2C,
-    0x71, 0xC4, 0x12, 0xAB, 0xA9, 0xC4, 0x9C, 0x7B, 0xCC, 0x1B, 0x9B, 0xE0, 0x29, 0x6E, 0xF3, 0x15,
-    0x17, 0xFB, 0xDF, 0xE3, 0xC4, 0xAC, 0x7F, 0x41, 0xEE, 0x75, 0x88, 0x7C, 0x6B, 0xB7, 0x92, 0xBE,
-    0xA7, 0x1A, 0x55, 0x32, 0xC6, 0x40, 0x06, 0xB8, 0x26, 0x53, 0xC1, 0xA4, 0xBB, 0x9C, 0x4D, 0xB8,
-    0xF8, 0x75, 0xEB, 0xA6, 0xDF, 0xF2, 0xB9, 0x8D, 0xE8, 0xF2, 0x77, 0x3B, 0x48, 0x93, 0x08, 0xBF,
-    0x1D, 0xD6, 0x56, 0x64, 0x7C, 0xBF, 0x29, 0x40, 0x14, 0x6B, 0x4D, 0xDE, 0x42, 0x26, 0xCD, 0x43,
-    0x2C, 0xDC, 0x87, 0x8F, 0x17, 0x39, 0x65, 0x6D, 0xE3, 0x0B, 0xA4, 0x03, 0x74, 0x37, 0xD8, 0xB0,
-    0x09, 0x17, 0x91, 0xA3, 0x69, 0xB6, 0x1F, 0x6D, 0xF3, 0xCC, 0xC9, 0x4E, 0x01, 0xAA, 0xE0, 0xF6,
-    0x56, 0xA8, 0x3B, 0x1D, 0x0A, 0x63, 0x0A, 0x07, 0x14, 0xA6, 0xD4, 0x42, 0xCE, 0x43, 0x12, 0x41,
-    0xFE, 0x1B, 0x38, 0x65, 0x74, 0x35, 0x0F, 0x26, 0x66, 0x99, 0x3E, 0xCD, 0x66, 0x77, 0x81, 0x4C,
-    0xEF, 0xDC, 0x34, 0xCF, 0x27, 0x8E, 0xB6, 0xB7, 0x40, 0x1B, 0x2B, 0x34, 0x1C, 0xD3, 0x13, 0x6F,
-    0x1C, 0x1D, 0xB3, 0x31, 0xDA, 0xF3, 0x3C, 0xA7, 0x65, 0x3B, 0xEB, 0x73, 0x06, 0xCB, 0x2F, 0x3F,
-    0x18, 0xE0, 0x92, 0x3A, 0x3F, 0x42, 0x0E, 0x3E, 0xAF, 0x69, 0x15, 0xF1, 0xF2, 0xA5, 0x67, 0xEC,
-    0x81, 0x88, 0x96, 0xFD, 0x86, 0x0C, 0x88, 0xC9, 0x1D, 0x50, 0x61, 0xC2, 0x21, 0xCC, 0x22, 0x44,
-    0x38, 0x6E, 0x49, 0xC5, 0x61, 0x72, 0x38, 0xEA, 0x0F, 0x1E, 0x7A, 0x5E, 0x45, 0xC6, 0x9F, 0x15,
-    0x87, 0x81, 0xA3, 0xFB, 0x92, 0x46, 0x2C, 0x03, 0x74, 0x3E, 0x6E, 0xE0, 0x2A, 0x13, 0xE0, 0xB9,
-    0x78, 0x52, 0x9A, 0xDF, 0x43, 0x89, 0xD5, 0xE8, 0x37, 0x3F, 0x79, 0x1E, 0x60, 0x7D, 0x74, 0xD9,
-    0x6D, 0x0A, 0xFE, 0xF5, 0x2E, 0xE8, 0xB2, 0xCF, 0xC5, 0x92, 0x1D, 0xDB, 0xF2, 0xDE, 0xB1, 0x43,
-    0xEA, 0x96, 0x0C, 0x79, 0xD8, 0x13, 0x21, 0x08, 0xEF, 0xF0, 0xA8, 0x9E, 0x1A, 0x24, 0x30, 0x3F,
-    0xC4, 0x23, 0xE8, 0xEE, 0x4E, 0x70, 0xFB, 0xDA, 0xD7, 0x51, 0xA8, 0xBB, 0x79, 0x88, 0x75, 0x09,
-    0xEB, 0x9F, 0x2E, 0x22, 0x50, 0x5C, 0xAD, 0x52, 0x24, 0x95, 0x84, 0xEB, 0x4E, 0x53, 0x32, 0xA5,
-    0x3C, 0x79, 0x1E, 0x38, 0xB5, 0x5E, 0x8A, 0xAE, 0xDE, 0xF8, 0xA6, 0x0A, 0x26, 0x3C, 0x20, 0x9F,
-    0xD9, 0x92, 0xC4, 0xCC, 0xBF, 0xB9, 0x50, 0xC9, 0xED, 0xB0, 0xEB, 0x0B, 0x1E, 0x4F, 0x23, 0x71,
-    0x85, 0xE2, 0xE8, 0x1E, 0x77, 0xF8, 0xB8, 0x82, 0xC4, 0x37, 0xEE, 0xBE, 0xFE, 0xBE, 0xF4, 0x88,
-    0xE1, 0x7B, 0x4D, 0xB1, 0x83, 0xC2, 0xD6, 0x69, 0x8A, 0xB5, 0x2D, 0x50, 0x8A, 0x77, 0x8B, 0x35,
-    0x19, 0x30, 0xE3, 0xA6, 0xC0, 0x18, 0xEE, 0x3B, 0xEE, 0xF5, 0xCA, 0xBB, 0xD5, 0xF3, 0x10, 0x29,
-    0x8A, 0x99, 0xD4, 0x7F, 0x77, 0x1A, 0x9D, 0x27, 0x86, 0x7D, 0x05, 0xA3, 0x14, 0x73, 0x4B, 0x3F,
-    0xA0, 0xDF, 0xEF, 0xD0, 0x57, 0x6F, 0x62, 0xD7, 0x9C, 0xF1, 0x01, 0xE5, 0x84, 0x6A, 0x72, 0xB4,
-    0x99, 0x68, 0x2C, 0x0B, 0xAA, 0x0B, 0x86, 0x16, 0xBF, 0x16, 0xF9, 0xCE, 0xB7, 0xCD, 0x94, 0xCC,
-    0x29, 0xE7, 0xAF, 0xB7, 0x0B, 0xCC, 0x11, 0x7B, 0x82, 0x30, 0x28, 0x45, 0xBD, 0xD1, 0x1E, 0x62,
-    0x1D, 0xB4, 0x79, 0xAB, 0x47, 0x1E, 0x4F, 0x69, 0x8A, 0xBB, 0x6B, 0xFE, 0x83, 0x6A, 0x72, 0xBB,
-    0xCF, 0x7A, 0xBA, 0xCF, 0x8E, 0xDD, 0xE7, 0x70, 0xA2, 0x79, 0xB0, 0xE9, 0x56, 0xAE, 0x66, 0x13,
-    0xF5, 0x6D, 0x9D, 0xEF, 0x15, 0xB6, 0x21, 0x19, 0x71, 0x4E, 0x68, 0x3E, 0x6C, 0xCD, 0x50, 0xDC,
-    0xA2, 0x1E, 0x94, 0x36, 0x1A, 0xF1, 0xE4, 0x45, 0xCF, 0x9E, 0x85, 0x61, 0x29, 0xD0, 0x3C, 0x22,
-    0x9F, 0x7E, 0xA9, 0xBD, 0xBA, 0x54, 0x7F, 0xBE, 0x6C, 0x36, 0x17, 0x66, 0xC6, 0xA7, 0x0B, 0xF0,
-    0x9E, 0x30, 0x61, 0x2E, 0x5E, 0xA6, 0x83, 0xEC, 0x9B, 0x91, 0x1E, 0xED, 0xDC, 0x35, 0x74, 0x54,
-    0x33, 0x43, 0xC7, 0x39, 0x43, 0x04, 0x0A, 0xB4, 0x24, 0x65, 0x69, 0xE7, 0xA6, 0x47, 0x86, 0x38,
-    0x2F, 0x38, 0x85, 0x1D, 0x81, 0xA5, 0x66, 0x24, 0x76, 0x6A, 0x93, 0x38, 0xD5, 0x1D, 0x01, 0x10,
-    0xEC, 0x18, 0xED, 0x18, 0x87, 0x97, 0x92, 0xBE, 0x5F, 0x98, 0x1E, 0xCB, 0x5A, 0x65, 0xF0, 0xC2,
-    0x5E, 0xAB, 0x9C, 0xB3, 0x0A, 0x8B, 0x98, 0x7E, 0x6D, 0xCE, 0xC3, 0x8E, 0xBC, 0xCB, 0x61, 0x5D,
-    0x17, 0x11, 0xC7, 0xCB, 0x83, 0xAC, 0xB5, 0x7D, 0x78, 0xA3, 0xBB, 0x7F, 0x18, 0xC4, 0x4E, 0xCC,
-    0xF6, 0x21, 0xC3, 0x79, 0x5C, 0x8F, 0x36, 0x5D, 0xE6, 0x92, 0x34, 0x58, 0xF0, 0xE5, 0x3B, 0x3A,
-    0xAA, 0x33, 0xFF, 0xF6, 0x4C, 0x77, 0xB0, 0x37, 0xCE, 0xF0, 0xD4, 0xE0, 0x5D, 0x0A, 0x60, 0xB0,
-    0x9A, 0x8B, 0x68, 0xB4, 0x67, 0xF0, 0x89, 0x47, 0xB3, 0xA9, 0x1E, 0xCB, 0x15, 0xE2, 0x0A, 0x4C,
-    0x0A, 0x3A, 0x73, 0xEE, 0x07, 0x1D, 0xD4, 0x09, 0xE2, 0xB0, 0x3E, 0x10, 0xE8, 0x21, 0x53, 0x2B,
-    0xFF, 0x80, 0xAE, 0x5C, 0xF0, 0xE5, 0xF4, 0x5C, 0xE2, 0xDC, 0xE0, 0x7B, 0x82, 0x4F, 0x10, 0xDD,
-    0x29, 0x7C, 0x73, 0x0F, 0xB6, 0xF6, 0xCC, 0xC9, 0x22, 0x7E, 0x2F, 0x5D, 0xA6, 0xA8, 0xB8, 0x17,
-    0x0C, 0x23, 0x44, 0x76, 0x3E, 0x6A, 0xF8, 0x4E, 0x0C, 0x87, 0x28, 0x2A, 0xFA, 0x27, 0x8F, 0xC9,
-    0x0E, 0x54, 0x94, 0x09, 0x40, 0x0B, 0x3C, 0x29, 0x80, 0x6E, 0x82, 0xAB, 0xE0, 0xF6, 0x88, 0x6B,
-    0xE3, 0x88, 0xC3, 0xE3, 0x1D, 0x3E, 0x10, 0x64, 0xA6, 0x2D, 0xA6, 0xB5, 0xCA, 0xD4, 0xDA, 0xCC,
-    0x53, 0xB2, 0xDC, 0x80, 0x09, 0xA6, 0xFC, 0x56, 0x31, 0x5D, 0x9E, 0x48, 0xF2, 0x50, 0x84, 0xF5,
-    0xD5, 0xE6, 0x85, 0xB1, 0x19, 0xC6, 0x4A, 0xCA, 0x8F, 0xC0, 0xFD, 0xDB, 0x1D, 0x33, 0x92, 0xB6,
-    0xAF, 0x05, 0xD2, 0xD4, 0x7D, 0x25, 0xA1, 0xAF, 0xD0, 0x65, 0xA3, 0xF9, 0x36, 0x21, 0xD9, 0xD1,
-    0x3C, 0x29, 0xE6, 0xD2, 0xD3, 0xD4, 0x78, 0x5C, 0xD6, 0x2E, 0x4F, 0x6B, 0xBC, 0x01, 0x7E, 0xFA,
-    0x33, 0x47, 0x87, 0xC3, 0x6B, 0x1B, 0x14, 0x35, 0x47, 0x87, 0x1E, 0x27, 0x40, 0xAF, 0x7E, 0x40,
-    0xE8, 0xBB, 0x13, 0x19, 0x3E, 0xDE, 0x37, 0x6A, 0x87, 0x27, 0xE9, 0x5E, 0xB2, 0xC1, 0xC4, 0x19,
-    0xFA, 0x25, 0x7A, 0x30, 0xF8, 0xCF, 0x39, 0x88, 0x51, 0x8B, 0xA8, 0x4B, 0x76, 0x9F, 0x24, 0xB9,
-    0x2F, 0x39, 0xCC, 0x73, 0x04, 0x1C, 0x75, 0x9C, 0x0F, 0x32, 0xFB, 0x46, 0x7F, 0xCF, 0x68, 0x7A,
-    0x80, 0x7F, 0xE2, 0x12, 0x71, 0xEF, 0xA6, 0xF0, 0xE9, 0x49, 0x58, 0xF2, 0xCA, 0x93, 0x88, 0x9A,
-    0x7D, 0x93, 0x4C, 0xEF, 0x5B, 0x32, 0x13, 0x6F, 0xD9, 0xC3, 0x62, 0xF6, 0xD0, 0x12, 0x61, 0xDD,
-    0x7D, 0x39, 0x7B, 0x30, 0x42, 0xC9, 0x31, 0xCE, 0x67, 0xE8, 0x96, 0x3E, 0xCA, 0x24, 0x83, 0x3E,
-    0xF5, 0xD8, 0x7D, 0x0B, 0x74, 0x82, 0x90, 0x97, 0xF7, 0x76, 0xE7, 0xF2, 0xF6, 0x7E, 0xD3, 0x66,
-    0x1F, 0x1B, 0xF3, 0xFF, 0x7D, 0x18, 0x08, 0xFF, 0x12, 0x8F, 0x8F, 0x84, 0x59, 0xBA, 0x29, 0xAD,
-    0xFB, 0x4A, 0xF3, 0x3F, 0x9E, 0xD7, 0x7A, 0xE8, 0xE4, 0x23, 0xED, 0x67, 0x31, 0xF2, 0x80, 0x4A,
-    0x62, 0xD8, 0xA8, 0x02, 0xBF, 0xAF, 0x34, 0xB8, 0xBA, 0x37, 0xF1, 0x39, 0xF6, 0xAE, 0x27, 0x28,
-    0xD2, 0xFC, 0x57, 0x13, 0x14, 0x6D, 0xCA, 0x7F, 0x19, 0xEF, 0xCB, 0xDE, 0x2B, 0x39, 0xC5, 0xB1,
-    0xF7, 0x6A, 0x46, 0x71, 0xDF, 0xBB, 0xA1, 0x29, 0xDE, 0xF4, 0xFE, 0x84, 0x00, 0x5E, 0x7A, 0xB7,
-    0x60, 0xCF, 0x39, 0xE7, 0xE1, 0x28, 0xE3, 0x83, 0xE4, 0x48, 0x7B, 0x7C, 0xCC, 0x29, 0x69, 0xD7,
-    0xBE, 0x38, 0x92, 0x39, 0xFC, 0x04, 0x03, 0x08, 0x02, 0xAF, 0x93, 0x35, 0x47, 0x7E, 0x3D, 0xEA,
-    0xA5, 0x48, 0xD7, 0x45, 0xCA, 0x1D, 0x6D, 0xDF, 0xDF, 0x0C, 0x92, 0xBE, 0xEA, 0x2B, 0xEA, 0x2F,
-    0xAF, 0x85, 0xD4, 0x8F, 0xD7, 0xA0, 0x80, 0xFE, 0x1A, 0x74, 0xB0, 0xB1, 0x86, 0xE6, 0xA4, 0x88,
-    0xD1, 0x2C, 0x65, 0x1D, 0xF4, 0x20, 0x49, 0x97, 0xF3, 0x17, 0x7A, 0xD8, 0xAE, 0x39, 0x00, 0x9B,
-    0x39, 0x29, 0x86, 0x6E, 0xDC, 0xCC, 0x8C, 0x0C, 0x53, 0x99, 0x4F, 0x87, 0xA2, 0x47, 0x7E, 0xC2,
-    0xA2, 0xC5, 0x07, 0x62, 0xD8, 0x25, 0xC5, 0x19, 0x12, 0x95, 0x43, 0x70, 0x0D, 0x78, 0xC6, 0x32,
-    0x69, 0xBC, 0x7B, 0xF8, 0xBB, 0x27, 0x8D, 0x1D, 0x32, 0xAD, 0xEE, 0x61, 0xFB, 0x9A, 0x87, 0x37,
-    0x78, 0x68, 0x2B, 0x63, 0x5C, 0x3E, 0x66, 0xC3, 0xEA, 0x36, 0x56, 0xAE, 0xC2, 0x46, 0xCE, 0x22,
-    0x77, 0x2D, 0x63, 0x03, 0x16, 0x4B, 0x53, 0xF7, 0x28, 0x3B, 0x80, 0x88, 0x6C, 0x5A, 0x03, 0xFF,
-    0x61, 0x69, 0x1E, 0xEA, 0x31, 0x19, 0xB3, 0x6F, 0x2E, 0xFB, 0x9A, 0xAF, 0x0C, 0xF2, 0x90, 0x90,
-    0x7D, 0x48, 0xEC, 0x29, 0xB2, 0xB9, 0x7E, 0x1B, 0x79, 0x74, 0xDB, 0x96, 0xA4, 0x85, 0x3C, 0xEB,
-    0x30, 0x9D, 0x8E, 0x58, 0xC2, 0xFB, 0xBE, 0x72, 0x9B, 0xAF, 0x34, 0x37, 0xB2, 0xB5, 0x5C, 0xF6,
-    0x41, 0x15, 0x9B, 0xA7, 0xD9, 0x3E, 0xAD, 0x40, 0xEB, 0xEB, 0xD2, 0x28, 0xD0, 0xFA, 0xC5, 0xDD,
-    0xC5, 0xF6, 0x34, 0x60, 0x96, 0x9E, 0x6F, 0x59, 0x74, 0xAF, 0x5C, 0x96, 0x47, 0x70, 0x4C, 0xE8,
-    0x6C, 0x1E, 0x64, 0x5A, 0x98, 0x33, 0x56, 0x2D, 0x5D, 0x50, 0x69, 0x1F, 0x15, 0x59, 0x5F, 0x67,
-    0x84, 0x0C, 0x70, 0xCC, 0x5F, 0x02, 0x8A, 0x19, 0x60, 0x37, 0x9F, 0x42, 0x81, 0x35, 0xB4, 0xAD,
-    0xA4, 0x9B, 0xCD, 0x3C, 0x87, 0xD5, 0x99, 0xBF, 0x12, 0x57, 0x78, 0xBA, 0xBB, 0x4A, 0x52, 0x5C,
-    0x36, 0x1E, 0x74, 0x6C, 0x25, 0x4A, 0x90, 0xE6, 0x27, 0x9D, 0x36, 0x9B, 0x33, 0xE4, 0x03, 0xAB,
-    0xCC, 0xA6, 0x68, 0x3A, 0xC2, 0x91, 0x87, 0x3B, 0x73, 0xE4, 0xF1, 0x3F, 0xCD, 0x5A, 0x3D, 0x8C,
-    0x1C, 0xE5, 0x19, 0x7E, 0x67, 0x86, 0x63, 0x14, 0x06, 0x18, 0x22, 0xD9, 0x11, 0xE2, 0xE7, 0x26,
-    0x45, 0x0A, 0x84, 0x7C, 0xBB, 0x8D, 0x0B, 0x23, 0xCD, 0xDC, 0x7E, 0x4A, 0x0A, 0x0A, 0x9A, 0x2D,
-    0xBC, 0x34, 0x2E, 0xA0, 0x8C, 0x90, 0x08, 0x2E, 0x28, 0x0E, 0x69, 0xED, 0x1B, 0x92, 0x22, 0x05,
-    0x05, 0x49, 0x41, 0x95, 0x02, 0x17, 0x14, 0x70, 0x2E, 0xB8, 0xE2, 0x22, 0x2D, 0x62, 0xED, 0x9D,
-    0x40, 0xE1, 0x22, 0x05, 0x83, 0x92, 0x88, 0x22, 0x52, 0x32, 0x24, 0xB6, 0x12, 0x09, 0x29, 0x1E,
-    0x29, 0x63, 0x69, 0x09, 0x77, 0x3B, 0x79, 0x9E, 0xF7, 0x9B, 0xD9, 0x5D, 0x9F, 0x8D, 0xA2, 0x83,
-    0xF5, 0x91, 0xB5, 0xE7, 0xDB, 0xDD, 0xD9, 0x99, 0xEF, 0x7D, 0xDE, 0xFF, 0x9F, 0x39, 0x11, 0x91,
-    0xAE, 0xF8, 0x75, 0x9A, 0x48, 0xAF, 0xAE, 0xC6, 0x72, 0x20, 0xB3, 0xD2, 0x2B, 0xA5, 0x67, 0x82,
-    0x0C, 0xE7, 0x43, 0x23, 0xA1, 0x44, 0x82, 0xA5, 0xC3, 0x25, 0x69, 0x96, 0x48, 0x62, 0xDE, 0x85,
-    0x65, 0x93, 0x5F, 0x2F, 0xE0, 0x4D, 0xF6, 0x71, 0xC2, 0x2D, 0x25, 0xCC, 0x82, 0x5C, 0xFC, 0x59,
-    0x6D, 0x44, 0x26, 0x53, 0x99, 0xBF, 0x4E, 0xE2, 0x48, 0xE4, 0x31, 0x33, 0x74, 0xEA, 0xAA, 0x0A,
-    0x6E, 0x4C, 0xF2, 0xC8, 0x6C, 0xE2, 0x2E, 0x6E, 0x14, 0xC9, 0x10, 0xC7, 0x08, 0x14, 0x2A, 0x9C,
-    0xA9, 0x70, 0x66, 0x84, 0x7F, 0x43, 0xA7, 0x94, 0xEE, 0xFB, 0xB9, 0x04, 0xB3, 0xC5, 0x26, 0x61,
-    0xEA, 0x14, 0x12, 0x86, 0xC6, 0x2D, 0x24, 0xEA, 0x88, 0x97, 0x4B, 0x77, 0x2A, 0x1E, 0x60, 0x82,
-    0x60, 0x46, 0x1C, 0x41, 0x4A, 0x48, 0xC0, 0x3C, 0x24, 0x4E, 0x6C, 0xC2, 0xB5, 0x22, 0x5C, 0x29,
-    0x85, 0x1C, 0x94, 0x04, 0xE1, 0xE8, 0x8A, 0x3D, 0x70, 0x31, 0xF6, 0xC0, 0x67, 0xB0, 0x0A, 0xF0,
-    0x5D, 0x40, 0x0E, 0xBF, 0x3A, 0x00, 0x1D, 0xB7, 0xAE, 0x64, 0xE9, 0xE5, 0xE0, 0x07, 0xD0, 0x59,
-    0x13, 0xE7, 0xB9, 0x2C, 0x34, 0xC1, 0xDB, 0xD8, 0x35, 0xDC, 0xE7, 0xF2, 0x2B, 0xEC, 0x1C, 0x71,
-    0xE3, 0x75, 0xEE, 0xB2, 0xC1, 0x0D, 0x81, 0x62, 0x48, 0xF2, 0x5B, 0x90, 0x87, 0x8C, 0x1C, 0x48,
-    0x60, 0xEC, 0x63, 0xB3, 0xED, 0x2B, 0xBB, 0x20, 0x51, 0x95, 0x72, 0x97, 0x57, 0xE8, 0xE6, 0xFA,
-    0xEE, 0xBF, 0x69, 0xBF, 0xBB, 0xFB, 0xCD, 0x0F, 0x4B, 0x20, 0xEA, 0x7F, 0x02, 0x54, 0x5D, 0x3A,
-    0x75, 0x9D, 0x7A, 0x75, 0x5D, 0xB8, 0x45, 0x04, 0xF8, 0x41, 0xE6, 0xE5, 0x90, 0x38, 0x18, 0x86,
-    0x10, 0xA6, 0xD4, 0x05, 0xC4, 0x30, 0x06, 0x45, 0x0A, 0x62, 0xA8, 0xCA, 0xA0, 0x28, 0xFC, 0x9C,
-    0xEF, 0x63, 0xAB, 0x4B, 0x08, 0x65, 0x53, 0x05, 0x32, 0xE5, 0x95, 0x1D, 0x08, 0xC3, 0x8A, 0xC3,
-    0x2B, 0x71, 0x19, 0xF0, 0x07, 0x79, 0x98, 0xF2, 0xBD, 0x9B, 0xE2, 0x32, 0x28, 0x61, 0xC6, 0xCB,
-    0x64, 0x52, 0x57, 0x20, 0xBD, 0x2F, 0xF5, 0xCC, 0xE0, 0x7D, 0x7A, 0x1B, 0xFC, 0xF2, 0x14, 0xD1,
-    0xC9, 0x96, 0x82, 0x93, 0x6E, 0xA6, 0xD8, 0x22, 0x63, 0xA1, 0x51, 0x3D, 0x53, 0x67, 0xD0, 0x27,
-    0xB0, 0xA0, 0xAE, 0x88, 0xCB, 0x79, 0xBE, 0x54, 0x58, 0x5E, 0x6E, 0x51, 0xA5, 0x0A, 0xAA, 0xD3,
-    0x62, 0x6A, 0x20, 0x11, 0x11, 0x94, 0xA3, 0x80, 0x4C, 0x8B, 0xA7, 0x81, 0x43, 0x34, 0xB3, 0x1D,
-    0x03, 0x30, 0x90, 0x89, 0x59, 0xA8, 0xA9, 0x7C, 0x18, 0xD4, 0xA0, 0xD8, 0xE0, 0x05, 0x12, 0xCE,
-    0xBD, 0x7D, 0xA5, 0xEF, 0x34, 0x30, 0xF0, 0x7A, 0xCC, 0xCF, 0x06, 0x03, 0x71, 0xEA, 0x3F, 0xA7,
-    0xB8, 0x0F, 0x46, 0x68, 0x06, 0xAF, 0x40, 0x2A, 0x3D, 0xAA, 0x6C, 0x13, 0x06, 0x00, 0x81, 0x27,
-    0xA0, 0xEF, 0x15, 0xF8, 0xBE, 0x41, 0x19, 0x8E, 0xF0, 0xBD, 0x4B, 0x74, 0xAA, 0xD2, 0x0A, 0x2A,
-    0xAD, 0x54, 0xA9, 0xB4, 0x1A, 0xA8, 0x95, 0x92, 0xEA, 0x5D, 0xD9, 0xED, 0xEE, 0x5C, 0x92, 0xA8,
-    0x2A, 0x7B, 0xF5, 0x42, 0xBB, 0x25, 0x99, 0x28, 0x00, 0xC5, 0xE5, 0x82, 0xCB, 0x81, 0x26, 0x03,
-    0x08, 0x88, 0xC1, 0xCF, 0xB0, 0x71, 0x90, 0x52, 0x19, 0x46, 0x35, 0x12, 0x8A, 0x75, 0xB1, 0x88,
-    0x06, 0xDA, 0xA1, 0x01, 0x25, 0xB4, 0xE2, 0x98, 0x8B, 0xD2, 0x1D, 0x82, 0xE1, 0x7C, 0x24, 0x75,
-    0x9D, 0x55, 0x76, 0x6F, 0xA1, 0x6A, 0xC5, 0x79, 0x1C, 0x28, 0x3C, 0xF2, 0xEF, 0xBE, 0x6B, 0xA9,
-    0x1A, 0xFC, 0xE6, 0x15, 0xA0, 0x0B, 0xD9, 0xC3, 0x3C, 0x0C, 0x61, 0x92, 0x73, 0xC7, 0x80, 0x6E,
-    0x60, 0x40, 0xB7, 0x25, 0x69, 0x40, 0x2D, 0x14, 0x2B, 0x74, 0xB2, 0x6C, 0x0D, 0xB7, 0x21, 0x19,
-    0x5B, 0x8E, 0xC1, 0x2B, 0xE8, 0x96, 0xA4, 0x4B, 0x92, 0xD8, 0x56, 0xD4, 0x69, 0xD4, 0x67, 0x68,
-    0x69, 0xB0, 0x4A, 0x0A, 0xFF, 0x40, 0xED, 0xC4, 0xC8, 0x08, 0xA7, 0x2A, 0x1C, 0xA5, 0xA3, 0x18,
-    0x9D, 0x72, 0x0D, 0x97, 0x87, 0xB8, 0x3A, 0x02, 0x86, 0x0E, 0x6E, 0x80, 0x9F, 0xA5, 0xD0, 0xA7,
-    0x19, 0x82, 0xFE, 0x16, 0xC8, 0xEF, 0x81, 0x7A, 0x05, 0xE2, 0x50, 0x36, 0x74, 0x14, 0x63, 0xEF,
-    0x98, 0x9E, 0x40, 0x55, 0xF1, 0x20, 0x05, 0x00, 0x75, 0x6B, 0x90, 0x85, 0xC5, 0x39, 0x95, 0xF8,
-    0xE9, 0x3A, 0x3E, 0x05, 0x69, 0x02, 0x0F, 0x09, 0x4D, 0xEC, 0x1D, 0x60, 0x93, 0xD8, 0xFB, 0x2B,
-    0x03, 0x08, 0x7C, 0x67, 0x5D, 0x46, 0xC1, 0x1B, 0xE9, 0x86, 0x54, 0xE1, 0xB3, 0x20, 0x55, 0x86,
-    0x5E, 0x1E, 0x3B, 0x65, 0xE8, 0x16, 0x08, 0x24, 0xEB, 0x52, 0x8E, 0xDC, 0x02, 0x3F, 0xED, 0x79,
-    0x79, 0x02, 0x4B, 0xF5, 0x32, 0xB0, 0x5A, 0xFA, 0xD9, 0x50, 0x3A, 0x65, 0x90, 0x6E, 0x49, 0x54,
-    0x84, 0x66, 0x4F, 0x42, 0x58, 0x5A, 0x09, 0xA7, 0x0A, 0x55, 0x98, 0x91, 0xAE, 0x74, 0x02, 0xF9,
-    0xBE, 0x3A, 0x64, 0x4F, 0xD5, 0xFB, 0x74, 0x63, 0x6F, 0xF7, 0x29, 0x9E, 0x44, 0xF1, 0xC4, 0x8A,
-    0x47, 0x14, 0x8F, 0x28, 0x9E, 0xBE, 0xE2, 0x29, 0x15, 0x4F, 0x49, 0x3C, 0x8E, 0xE2, 0x81, 0x3C,
-    0x80, 0xC7, 0xCB, 0x89, 0xC7, 0xCB, 0x14, 0x4F, 0x46, 0x3C, 0x7E, 0x4A, 0x3C, 0x41, 0x4A, 0x3C,
-    0x94, 0x0D, 0xF0, 0x08, 0xF1, 0x44, 0x42, 0x3C, 0x1D, 0x25, 0xB8, 0xA1, 0x6B, 0xBC, 0xB4, 0x8E,
-    0x14, 0xA6, 0xA2, 0x8A, 0xB2, 0x45, 0xA0, 0x6A, 0x6C, 0x5D, 0x15, 0x24, 0xCE, 0x3C, 0x84, 0xBD,
-    0x27, 0xD0, 0xC7, 0x67, 0xB5, 0x81, 0x46, 0x6E, 0xBE, 0x90, 0x41, 0x27, 0x53, 0x9F, 0x5A, 0x29,
-    0x54, 0x2F, 0x30, 0xCC, 0x18, 0x9E, 0x48, 0xFD, 0xC0, 0x44, 0xD2, 0x2D, 0xB5, 0x91, 0x91, 0x46,
-    0x37, 0x6A, 0xA8, 0x4B, 0x1D, 0x49, 0x47, 0xDD, 0x32, 0x71, 0xE9, 0x1E, 0xB1, 0x8D, 0x59, 0x96,
-    0xD4, 0x32, 0xC1, 0xD0, 0x68, 0xFC, 0xD4, 0x38, 0xB6, 0x88, 0x13, 0x67, 0x28, 0xD3, 0x8D, 0x21,
-    0x7F, 0x2F, 0xE7, 0x97, 0xDA, 0x88, 0xDE, 0xA2, 0xEF, 0x71, 0xF9, 0x90, 0xCB, 0xBF, 0xE9, 0xC4,
-    0x7F, 0xA7, 0x25, 0x7C, 0x84, 0x25, 0xF8, 0x39, 0x6C, 0x2E, 0xA2, 0xF5, 0x6D, 0xD2, 0x93, 0x2F,
-    0xEE, 0x60, 0x41, 0x24, 0x14, 0xE7, 0xD6, 0xA0, 0xA4, 0x29, 0x56, 0x8C, 0xDE, 0x15, 0xE9, 0x8E,
-    0xAC, 0xAF, 0x6A, 0x04, 0x9E, 0x53, 0x5D, 0x1F, 0x5A, 0x9A, 0x2D, 0xC9, 0xC7, 0x1C, 0x44, 0xB0,
-    0xCF, 0x52, 0x1F, 0xCE, 0x4F, 0xCF, 0x47, 0xD4, 0x57, 0x07, 0x80, 0xE4, 0xF5, 0x56, 0x1A, 0x3E,
-    0xFD, 0x9C, 0x91, 0x9B, 0x81, 0x1B, 0xEE, 0x4D, 0xDF, 0x96, 0xDB, 0x38, 0xD9, 0x38, 0xB4, 0xE7,
-    0x84, 0x01, 0xBE, 0xD0, 0x64, 0xA3, 0x66, 0xD3, 0xD1, 0x5C, 0x67, 0xD5, 0x44, 0x28, 0x5B, 0x8D,
-    0xB2, 0x2A, 0x69, 0x3C, 0xC3, 0x3A, 0x92, 0xD7, 0x18, 0xFB, 0xE3, 0xD7, 0x71, 0xFB, 0x7E, 0x93,
-    0x0A, 0x32, 0x58, 0x0E, 0x02, 0x97, 0x63, 0x63, 0x7F, 0x9F, 0x17, 0x32, 0x7C, 0x30, 0x6E, 0xC0,
-    0xDE, 0x44, 0x7D, 0x98, 0x84, 0x34, 0xED, 0x58, 0xA7, 0x6D, 0xCC, 0x81, 0xAF, 0x82, 0x1F, 0x7F,
-    0x5B, 0xB6, 0xE2, 0x8C, 0xDA, 0xF3, 0x48, 0xEF, 0xC2, 0xF4, 0x4E, 0x6F, 0xDD, 0x47, 0x64, 0x85,
-    0x5D, 0xAF, 0x36, 0xBD, 0xCB, 0xEE, 0xBA, 0xC4, 0x30, 0x98, 0xC2, 0x6A, 0x14, 0x89, 0x1E, 0x79,
-    0x3E, 0xB8, 0x31, 0x46, 0x96, 0x47, 0x92, 0x47, 0x8E, 0x47, 0x8A, 0x47, 0x90, 0x47, 0x82, 0xAF,
-    0x78, 0xDD, 0x08, 0x4E, 0x89, 0xE4, 0xBE, 0x9C, 0xDB, 0xBD, 0x6C, 0x8F, 0xBA, 0xA7, 0x59, 0x4D,
-    0x4C, 0x23, 0x40, 0xB1, 0x71, 0x27, 0xA4, 0x14, 0x22, 0xCA, 0xA1, 0x43, 0x49, 0x6C, 0xD8, 0x6C,
-    0xAF, 0xC9, 0x5E, 0x33, 0x89, 0x26, 0x10, 0xCD, 0xF4, 0x9A, 0xE8, 0x35, 0xCF, 0x6B, 0x9A, 0xD7,
-    0x2C, 0xAF, 0x49, 0x3E, 0xB1, 0xFC, 0x22, 0xC5, 0x6B, 0x86, 0x3F, 0x94, 0xE0, 0xE3, 0x00, 0x86,
-    0x02, 0x6E, 0x03, 0x2A, 0xD5, 0x26, 0x63, 0x24, 0x7B, 0x18, 0x08, 0xE2, 0x34, 0x1D, 0x42, 0x85,
-    0x14, 0x69, 0x9E, 0xA7, 0xB1, 0x30, 0x58, 0x32, 0x32, 0x6F, 0x2D, 0x19, 0x0A, 0x13, 0xFC, 0x22,
-    0xBF, 0x0F, 0xFA, 0x8C, 0x8E, 0xD3, 0xF6, 0x93, 0x7A, 0x43, 0x46, 0x95, 0x7F, 0x4A, 0xFD, 0x1B,
-    0x73, 0x3C, 0xAC, 0x85, 0xD0, 0x52, 0x54, 0xDB, 0xCF, 0x27, 0xEE, 0x03, 0x9B, 0x0C, 0xF4, 0x4F,
-    0xAE, 0x80, 0x3D, 0xCB, 0xD0, 0xDC, 0x93, 0x35, 0x60, 0x9E, 0x98, 0xF3, 0xF8, 0x51, 0x71, 0x8C,
-    0x3C, 0xB2, 0xF4, 0x52, 0x5B, 0xA9, 0x48, 0x7E, 0xC1, 0xE7, 0x99, 0x95, 0xF1, 0xF9, 0x75, 0x3E,
-    0xF5, 0x1D, 0x28, 0xF4, 0x51, 0x27, 0x65, 0xF9, 0x2B, 0xFE, 0x15, 0x50, 0xAE, 0x34, 0x3E, 0xDC,
-    0x03, 0xC5, 0x56, 0xF3, 0x14, 0xF3, 0xA4, 0xDD, 0xF1, 0xBB, 0x31, 0x5E, 0x1C, 0x81, 0x69, 0x92,
-    0x4B, 0xBE, 0x5A, 0x3E, 0x5F, 0x92, 0xA0, 0x2E, 0x1E, 0xF8, 0x71, 0xC5, 0x52, 0xD9, 0x06, 0xD0,
-    0x1F, 0x8C, 0xBD, 0x7A, 0x3F, 0xFA, 0xE3, 0x28, 0x91, 0x0A, 0xA1, 0x69, 0xE8, 0xE7, 0xBD, 0x89,
-    0x89, 0x0E, 0xEC, 0xD5, 0x6B, 0x03, 0xB6, 0x48, 0xF4, 0xA3, 0x93, 0x83, 0x79, 0x1A, 0x38, 0xC5,
-    0xD8, 0x4E, 0xBB, 0x7B, 0xE4, 0xC4, 0x3D, 0xCF, 0x65, 0x11, 0xFC, 0xB8, 0xBB, 0xEC, 0xC7, 0x1B,
-    0x0D, 0x80, 0x6F, 0x9B, 0xCF, 0x0E, 0x73, 0x66, 0xDA, 0x64, 0xAE, 0x6E, 0xED, 0xC8, 0x31, 0x70,
-    0x26, 0x73, 0xCE, 0xE8, 0xBD, 0x4C, 0x89, 0x6E, 0xBA, 0x8A, 0x4C, 0x1D, 0xD6, 0x8A, 0x79, 0xD1,
-    0x1E, 0xA0, 0x3B, 0x39, 0x60, 0xBD, 0xCC, 0x35, 0xF8, 0x84, 0xA7, 0x43, 0x8D, 0x5B, 0x9B, 0xEA,
-    0xD0, 0x43, 0x2D, 0xB2, 0xAA, 0x44, 0x6B, 0xDC, 0x64, 0x00, 0x17, 0xCB, 0xB6, 0x6B, 0xF6, 0x4D,
-    0x17, 0x77, 0xD0, 0xD3, 0xEC, 0x30, 0x92, 0x6F, 0xAB, 0x6D, 0x7E, 0xF9, 0x3C, 0xB3, 0xB7, 0x36,
-    0x4D, 0x4D, 0xF3, 0x95, 0x32, 0x97, 0x47, 0xDC, 0x99, 0x4D, 0x4B, 0x5D, 0x37, 0x91, 0xDF, 0x99,
-    0x9B, 0xF2, 0xD3, 0xCE, 0x03, 0xA9, 0x53, 0x7F, 0x32, 0xA9, 0xFC, 0x1B, 0x37, 0xAF, 0x8F, 0x43,
-    0xB3, 0x9D, 0x82, 0x5A, 0x8F, 0xD6, 0x93, 0x38, 0x15, 0x3A, 0x8F, 0x09, 0x8A, 0xFB, 0xED, 0x19,
-    0x18, 0xC2, 0x5D, 0x15, 0x3B, 0xC6, 0x29, 0x3B, 0x97, 0x71, 0x70, 0x20, 0xA6, 0x77, 0xA5, 0xFE,
-    0x22, 0x8F, 0x3E, 0xBF, 0x56, 0xA7, 0x4B, 0x71, 0x17, 0x1B, 0x77, 0xC1, 0xC5, 0x4C, 0x1E, 0x75,
-    0x2B, 0x9B, 0xAF, 0xA8, 0x9F, 0x45, 0xE1, 0x71, 0xF2, 0x2C, 0x5A, 0xF9, 0x2A, 0x96, 0xA7, 0x71,
-    0x48, 0x99, 0xC8, 0xE5, 0xE9, 0xA6, 0xD4, 0xFB, 0x5D, 0x36, 0x5C, 0x19, 0x5A, 0x90, 0x59, 0x9D,
-    0xC9, 0x64, 0x66, 0xE5, 0x72, 0x7F, 0xDA, 0x97, 0xED, 0x5B, 0x85, 0xFB, 0xE5, 0x2B, 0x39, 0x7F,
-    0x45, 0x05, 0xC8, 0x06, 0x37, 0x45, 0x73, 0x90, 0x76, 0xC0, 0x7C, 0x47, 0x9D, 0xAA, 0x87, 0xE3,
-    0xAA, 0x44, 0x2E, 0xCA, 0xDB, 0x1A, 0x5D, 0xE5, 0xB4, 0x29, 0x6B, 0xB6, 0x6B, 0x76, 0x62, 0xD2,
-    0x07, 0xFB, 0xDB, 0xD8, 0xB2, 0x7B, 0xB0, 0x1C, 0x30, 0x5F, 0x2B, 0xAD, 0xAD, 0x44, 0xDF, 0x10,
-    0xB3, 0x53, 0x6E, 0x42, 0x11, 0x77, 0xC5, 0xCC, 0x17, 0x1B, 0x3D, 0x76, 0x79, 0x14, 0x94, 0xD3,
-    0xE8, 0xFC, 0x10, 0x2F, 0x41, 0x76, 0x27, 0x2F, 0x89, 0xF2, 0x72, 0x51, 0xBA, 0x0E, 0x78, 0xB9,
-    0x89, 0xCE, 0xF8, 0xA0, 0x2D, 0xD1, 0x46, 0x5A, 0x9A, 0xF5, 0xBD, 0x43, 0xBC, 0x04, 0x6C, 0xA6,
-    0x7E, 0x9F, 0x8A, 0xC3, 0x42, 0x65, 0xDA, 0xF6, 0x76, 0x23, 0xA7, 0x70, 0x4B, 0xB4, 0x99, 0x68,
-    0xBF, 0x81, 0x30, 0x1B, 0x8B, 0xFF, 0x11, 0xEA, 0xF4, 0x37, 0x32, 0x09, 0x5F, 0x01, 0x5F, 0xB8,
-    0x34, 0xBC, 0x09, 0xDE, 0x9E, 0x4B, 0xA5, 0xC3, 0x80, 0xC8, 0x2E, 0x16, 0x86, 0x12, 0xC3, 0x5A,
-    0x87, 0x76, 0xB2, 0xA1, 0x73, 0x8E, 0x79, 0xCD, 0xC3, 0x92, 0x87, 0x15, 0x4F, 0xB2, 0x14, 0x82,
-    0x87, 0x77, 0x56, 0x8C, 0x4E, 0xB1, 0x66, 0xD0, 0x5A, 0xA3, 0xA9, 0xBB, 0x20, 0xDE, 0xEF, 0xD0,
-    0x7C, 0x5C, 0xCB, 0x25, 0x78, 0xDB, 0x48, 0x70, 0x95, 0xC6, 0x8E, 0xE3, 0x4D, 0x24, 0x7B, 0xD0,
-    0xEB, 0x30, 0xAA, 0x36, 0xF4, 0x62, 0xDB, 0x23, 0xDC, 0xD3, 0x02, 0x30, 0x9C, 0x67, 0x8B, 0x57,
-    0xB9, 0xB0, 0x88, 0x93, 0xED, 0x36, 0x6F, 0x1C, 0xA1, 0x0E, 0x84, 0xA0, 0x53, 0xDB, 0x0B, 0x4B,
-    0x50, 0x68, 0x27, 0xA3, 0x1E, 0xE4, 0xCE, 0xBB, 0xEA, 0xEF, 0x8A, 0x85, 0xC9, 0xBE, 0xAD, 0xE4,
-    0xBE, 0x15, 0x2F, 0xAD, 0xD1, 0xFA, 0x6F, 0xDF, 0x6E, 0xB4, 0x75, 0x9D, 0x23, 0x30, 0xC1, 0x02,
-    0xA2, 0xD4, 0x36, 0x9B, 0x53, 0x1B, 0x04, 0x23, 0x43, 0xC8, 0xF8, 0x1D, 0x9F, 0x2F, 0x93, 0xFA,
-    0x85, 0xA6, 0x19, 0xED, 0x34, 0xEF, 0x89, 0xA4, 0xCE, 0xBE, 0xCC, 0xDE, 0x2F, 0x61, 0xB0, 0x0B,
-    0xBF, 0xB8, 0xAB, 0x63, 0x0C, 0x10, 0xCE, 0xD0, 0xC4, 0xCB, 0xE0, 0x85, 0xD4, 0xDE, 0x3F, 0xB2,
-    0xFD, 0x07, 0x12, 0x35, 0x63, 0x31, 0xFC, 0x01, 0x74, 0x8A, 0xA6, 0x5F, 0x1B, 0x36, 0xE5, 0x54,
-    0xDB, 0xBF, 0xC4, 0x8A, 0xA9, 0x0F, 0x71, 0x4F, 0x96, 0x1D, 0x03, 0x8D, 0x8A, 0xCE, 0xAB, 0x94,
-    0x4E, 0x1B, 0xE8, 0xFA, 0xB7, 0xF7, 0x35, 0x4C, 0x22, 0x68, 0x59, 0x34, 0x8B, 0xB3, 0x2D, 0xBC,
-    0x5B, 0x7B, 0x14, 0xDF, 0x6E, 0xEC, 0x84, 0xDC, 0xC3, 0xED, 0x3D, 0xF3, 0x7F, 0x38, 0xF3, 0xE2,
-    0x94, 0x4B, 0xF3, 0x48, 0xAA, 0x59, 0x22, 0xB2, 0xB3, 0x90, 0x63, 0x9B, 0x72, 0x35, 0xEA, 0xD4,
-    0x11, 0x4C, 0x33, 0x84, 0x69, 0x5B, 0xEF, 0xE3, 0x1E, 0x6F, 0xD9, 0xD7, 0xD4, 0x82, 0xA1, 0x8A,
-    0x1F, 0xBA, 0x37, 0x61, 0x5E, 0xCD, 0x26, 0xB1, 0x2E, 0xE9, 0xE4, 0xF7, 0x26, 0xCC, 0x33, 0x52,
-    0xB2, 0x98, 0x1D, 0x2A, 0x37, 0x23, 0x95, 0xEC, 0x9E, 0x4A, 0xB4, 0xD2, 0xB9, 0x59, 0x19, 0xA4,
-    0x41, 0xEA, 0x40, 0x99, 0xE1, 0x5B, 0xCF, 0x17, 0xA8, 0x34, 0xE1, 0xAD, 0xA0, 0xB5, 0x73, 0x39,
-    0x23, 0x25, 0x0E, 0xB6, 0xEC, 0x68, 0xCB, 0x0E, 0xB7, 0x58, 0xF8, 0x0E, 0x75, 0xA5, 0x50, 0xC3,
-    0xD7, 0x91, 0x2B, 0x58, 0x6A, 0x42, 0xAE, 0xEE, 0x72, 0x0A, 0x67, 0x69, 0x1D, 0x41, 0x7C, 0x4F,
-    0x4E, 0x10, 0x2C, 0x3A, 0x39, 0xAA, 0xDF, 0x9E, 0x81, 0xA0, 0x34, 0xA0, 0x0D, 0xAD, 0x66, 0xB0,
-    0x68, 0xB9, 0x54, 0xD2, 0x7E, 0x4B, 0xB5, 0x17, 0x9A, 0x77, 0x01, 0xA9, 0x7B, 0x39, 0xF0, 0x7B,
-    0x19, 0x22, 0x86, 0x9F, 0x81, 0x03, 0xFF, 0x37, 0x50, 0x4C, 0x40, 0x0B, 0x09, 0xAF, 0xB7, 0xC1,
-    0x4C, 0xD3, 0xAE, 0x96, 0x34, 0xC9, 0x3C, 0xB6, 0xC5, 0x4B, 0xD4, 0x47, 0xF3, 0x13, 0xEB, 0x1A,
-    0x5A, 0xDB, 0x1A, 0x89, 0x33, 0x2D, 0x1D, 0x69, 0xE9, 0x44, 0x4B, 0x07, 0x5A, 0x3A, 0xCF, 0xD2,
-    0x71, 0x96, 0x4E, 0xB3, 0x74, 0xB8, 0xC6, 0x59, 0x96, 0x70, 0x94, 0xC5, 0x21, 0xD7, 0x48, 0x38,
-    0xC8, 0x12, 0xCE, 0xB1, 0x38, 0x41, 0x24, 0xCC, 0x4E, 0x29, 0x1C, 0x62, 0xE9, 0x0C, 0x4B, 0x47,
-    0x58, 0x4D, 0x04, 0x67, 0xC9, 0x98, 0x37, 0x23, 0xCC, 0xD3, 0xF3, 0xB9, 0x14, 0xA7, 0x52, 0x9C,
-    0x49, 0x71, 0x22, 0xC5, 0x79, 0x14, 0xA7, 0x51, 0x9C, 0x45, 0x71, 0x12, 0xC5, 0xF2, 0xDE, 0x96,
-    0xF6, 0xB6, 0xFA, 0x4B, 0xB4, 0xB4, 0x8F, 0xDB, 0xD1, 0x5C, 0x65, 0x4D, 0xDF, 0x69, 0xCA, 0xD3,
-    0xD3, 0xBB, 0x22, 0xE7, 0xCF, 0x23, 0x8C, 0xEF, 0xDA, 0xEA, 0x83, 0x85, 0x2A, 0xEA, 0x54, 0x96,
-    0xA9, 0xAC, 0x52, 0x43, 0x14, 0xA9, 0xAC, 0x51, 0x59, 0xA2, 0xB2, 0x42, 0x65, 0x70, 0x41, 0x7D,
-    0xCA, 0xF2, 0x94, 0xD5, 0x29, 0x8B, 0x53, 0xBA, 0x83, 0x2D, 0x4D, 0xF9, 0x34, 0x60, 0xD8, 0x8C,
-    0x3D, 0x59, 0x09, 0x00, 0xF7, 0x06, 0xEC, 0xE2, 0xCC, 0x19, 0x1C, 0xA7, 0xED, 0xDC, 0x8D, 0x81,
-    0xFD, 0xDB, 0xCE, 0x93, 0x5A, 0x4F, 0x6A, 0x1D, 0xDB, 0x57, 0x33, 0x79, 0x78, 0xE9, 0xE1, 0xC3,
-    0x31, 0xD6, 0xAD, 0x0B, 0x34, 0x0A, 0x46, 0xB1, 0xCC, 0xA1, 0xAC, 0xB8, 0x8C, 0x5D, 0x26, 0xC4,
-    0x4C, 0xD4, 0xC4, 0x10, 0x97, 0x89, 0xFE, 0x8D, 0x14, 0x89, 0xBE, 0x9E, 0x27, 0xFA, 0x19, 0xA3,
-    0x7E, 0x0D, 0xA6, 0x82, 0x37, 0xD9, 0xE7, 0x31, 0xD1, 0x0F, 0x99, 0xE3, 0xAB, 0x90, 0xD5, 0x15,
-    0x12, 0x7D, 0x90, 0x22, 0xD1, 0x47, 0x4C, 0xF4, 0x43, 0x26, 0x7A, 0x0A, 0xBC, 0x9B, 0xB7, 0x89,
-    0x3E, 0x62, 0xA2, 0xBF, 0xC0, 0x44, 0xFF, 0xA3, 0x43, 0x62, 0x0F, 0x9A, 0x02, 0x95, 0xE6, 0x74,
-    0xA9, 0x89, 0x2E, 0xBF, 0xCE, 0x20, 0xB0, 0x14, 0xD1, 0x05, 0xBE, 0xDF, 0x83, 0x09, 0x7E, 0x98,
-    0x85, 0xCE, 0x3F, 0xB2, 0x75, 0xFF, 0x5A, 0xB6, 0x11, 0xFA, 0x69, 0x12, 0x07, 0x26, 0xD9, 0x0B,
-    0xA5, 0x5B, 0xC0, 0xFB, 0x33, 0x78, 0xF8, 0x17, 0xC8, 0xFE, 0xE0, 0x6A, 0xBE, 0x73, 0x88, 0xAA,
-    0xCF, 0xFF, 0x18, 0x26, 0xF7, 0x29, 0xF8, 0xBA, 0x74, 0x7E, 0xD1, 0x3E, 0xD1, 0x3C, 0xEF, 0x62,
-    0x92, 0xC1, 0x51, 0x4C, 0x12, 0x3B, 0xA1, 0xC8, 0xF4, 0x3E, 0xCE, 0x11, 0x0C, 0xA1, 0xC1, 0xDD,
-    0xF3, 0x2B, 0x68, 0x94, 0x1C, 0x24, 0xED, 0x08, 0x7A, 0x7A, 0xED, 0x65, 0xE0, 0x7D, 0x68, 0xA5,
-    0x78, 0xDB, 0xAD, 0x13, 0x6C, 0x7D, 0xFE, 0x7B, 0x2B, 0x19, 0xBF, 0x7A, 0x7F, 0x40, 0x39, 0x55,
-    0x90, 0xF7, 0x57, 0x17, 0x2D, 0x30, 0x12, 0x32, 0x93, 0xF2, 0xE1, 0xD2, 0x83, 0x46, 0x15, 0xBE,
-    0xD5, 0x47, 0xC4, 0x9E, 0x22, 0x5E, 0xBF, 0xF3, 0xB5, 0xA5, 0xC7, 0x04, 0xFE, 0xC2, 0xF2, 0x88,
-    0x31, 0x24, 0xA4, 0x02, 0xBD, 0x8F, 0x33, 0x27, 0xCF, 0xDB, 0x8A, 0xAF, 0xF4, 0x3F, 0x9F, 0x86,
-    0x66, 0x0B, 0xF8, 0x50, 0xC5, 0x5F, 0x9C, 0xE4, 0x08, 0xD9, 0x53, 0x0D, 0x3C, 0x23, 0xDE, 0x6E,
-    0x7A, 0x97, 0xB3, 0xA0, 0x31, 0xEB, 0xB3, 0xA2, 0x0F, 0x2B, 0xD7, 0xCF, 0x89, 0x3C, 0xE5, 0xAD,
-    0x16, 0xDA, 0x9A, 0x91, 0xED, 0x52, 0x6E, 0x8D, 0x9C, 0xEC, 0xA9, 0xA3, 0xE3, 0x22, 0x4F, 0xB0,
-    0x49, 0x9A, 0xA4, 0x35, 0x99, 0x49, 0xC5, 0x71, 0xF5, 0xA1, 0x21, 0xB2, 0x3E, 0xB3, 0xE4, 0xCD,
-    0x95, 0x7D, 0x7C, 0xB5, 0x98, 0x3C, 0x3F, 0x7E, 0xBD, 0x19, 0x4F, 0x8F, 0x10, 0x79, 0x13, 0x59,
-    0x0F, 0xC5, 0xF7, 0x4D, 0x33, 0xF2, 0x5B, 0xBA, 0x5E, 0x9F, 0x77, 0x2D, 0x86, 0xD5, 0xF3, 0x49,
-    0x75, 0x68, 0xAD, 0x0C, 0x96, 0xF0, 0xCC, 0xCB, 0xF2, 0xE2, 0x43, 0xDF, 0x1C, 0xC0, 0x59, 0x44,
-    0x06, 0x09, 0xCF, 0xA5, 0x4F, 0xD8, 0x09, 0xC1, 0x11, 0x67, 0xE3, 0x49, 0xC7, 0x2A, 0x18, 0xD2,
-    0x7F, 0x16, 0xF7, 0xBB, 0xAF, 0x67, 0xC7, 0x35, 0x1B, 0x8F, 0x10, 0xB8, 0x7E, 0x99, 0xD1, 0x7B,
-    0xF2, 0x4B, 0x47, 0x9F, 0x8D, 0xAF, 0x51, 0xD4, 0xDB, 0xCC, 0x36, 0x37, 0xF6, 0x38, 0x1C, 0x39,
-    0x7D, 0x3C, 0xB0, 0x41, 0xB6, 0x57, 0xC9, 0x07, 0x43, 0xC9, 0x1F, 0xFC, 0x26, 0xF3, 0x7C, 0xEF,
-    0x6F, 0x40, 0x5C, 0x02, 0xDC, 0x16, 0x28, 0x9E, 0x7A, 0xA2, 0xF1, 0x86, 0xEB, 0xCC, 0x66, 0x2C,
-    0x9D, 0x51, 0xC4, 0xFB, 0x28, 0xF8, 0xF8, 0x40, 0xD4, 0xCB, 0x82, 0x14, 0xF9, 0x9E, 0xB9, 0x7E,
-    0x70, 0x15, 0x1E, 0x51, 0x49, 0x74, 0xB9, 0xED, 0x62, 0x0B, 0x89, 0x9D, 0xB6, 0x73, 0x1E, 0xC3,
-    0x34, 0xE2, 0xB6, 0x73, 0x0E, 0x51, 0x1F, 0xFC, 0x42, 0x45, 0x5A, 0xEC, 0xEA, 0xE0, 0xEA, 0x1D,
-    0xF7, 0x5A, 0xE5, 0xFD, 0xA5, 0xEF, 0xA1, 0x80, 0x29, 0x6E, 0xB3, 0xBE, 0x3B, 0x6C, 0xE1, 0x2C,
-    0x45, 0x87, 0x1D, 0xCE, 0x19, 0x79, 0xC2, 0x35, 0x2B, 0xC5, 0x05, 0x2B, 0xEF, 0x4E, 0xE5, 0xB5,
-    0xA1, 0x5C, 0x7A, 0xF0, 0x88, 0xA0, 0x34, 0x95, 0xC7, 0xAD, 0x95, 0x6A, 0x82, 0xF7, 0x7F, 0x62,
-    0x8E, 0xED, 0x01, 0x08, 0xCC, 0xD3, 0xA6, 0x15, 0x86, 0xD6, 0xF3, 0xA7, 0x57, 0x30, 0x48, 0x3E,
-    0x29, 0x4D, 0xF3, 0xEA, 0xFD, 0x89, 0x15, 0x87, 0xBC, 0x78, 0x3C, 0xBC, 0xCC, 0x53, 0xCE, 0xCF,
-    0xC0, 0xC7, 0x03, 0xAB, 0x19, 0x88, 0x47, 0x33, 0xB6, 0xCF, 0xA9, 0x5B, 0xB9, 0xFA, 0x40, 0xDD,
-    0x6F, 0x62, 0xB8, 0xD7, 0x76, 0xCC, 0x9C, 0xDD, 0x44, 0xED, 0x97, 0xF1, 0x52, 0x04, 0x1F, 0x4B,
-    0x1F, 0x7B, 0x4E, 0x26, 0xC5, 0xA2, 0x45, 0xEF, 0xDB, 0x82, 0x52, 0xF3, 0x80, 0x69, 0xE6, 0x0B,
-    0x2F, 0x19, 0xAF, 0x2E, 0xC3, 0x4F, 0x2F, 0x59, 0xBB, 0x40, 0xEE, 0xE5, 0xDF, 0x8B, 0xCC, 0x74,
-    0x22, 0xE0, 0xF3, 0x6F, 0x06, 0x4C, 0x90, 0xFD, 0x67, 0x62, 0x26, 0x07, 0xCD, 0x03, 0x5E, 0x9C,
-    0x0B, 0x75, 0x32, 0x7F, 0x82, 0xA5, 0x5D, 0x9D, 0x4E, 0xD8, 0x1C, 0x26, 0x77, 0xB6, 0xD2, 0x5F,
-    0xF7, 0xB4, 0xD1, 0x5F, 0xCE, 0x41, 0x4D, 0x57, 0xDE, 0xCE, 0x3A, 0xD6, 0x9B, 0x6D, 0x5E, 0xB5,
-    0x50, 0x45, 0x1E, 0x81, 0x18, 0xB9, 0x8B, 0x7B, 0xCB, 0x74, 0xEB, 0xCC, 0xBF, 0xB1, 0x88, 0xED,
-    0x87, 0x6C, 0x19, 0xFF, 0xA3, 0x77, 0x25, 0x98, 0x36, 0x20, 0x03, 0xFD, 0x09, 0xF9, 0xF9, 0x87,
-    0x73, 0xCD, 0xF0, 0x21, 0x69, 0xB7, 0x9E, 0xF1, 0x41, 0x76, 0x77, 0xFE, 0xA0, 0x58, 0x89, 0xEB,
-    0x57, 0xCE, 0x37, 0xC8, 0xB8, 0xC3, 0x74, 0x17, 0x7C, 0x05, 0xB0, 0x6B, 0x76, 0xAE, 0xA0, 0x5B,
-    0x8E, 0xE7, 0x4D, 0x4B, 0x35, 0x7F, 0xF2, 0xC4, 0x0C, 0xDD, 0x05, 0x13, 0xF7, 0x1F, 0x70, 0x77,
-    0x70, 0xA8, 0xED, 0x5C, 0x2F, 0xB5, 0xB0, 0xC9, 0xD1, 0x7B, 0x94, 0x50, 0x2A, 0xCF, 0xF0, 0x52,
-    0x8A, 0xA0, 0x15, 0x03, 0x64, 0xEC, 0x5C, 0xC5, 0xF5, 0x34, 0x94, 0x6E, 0x03, 0xA5, 0x3D, 0x22,
-    0xDB, 0x59, 0x38, 0xFB, 0xAA, 0xD4, 0xFB, 0x21, 0xDB, 0x6D, 0x74, 0x55, 0x1F, 0xFC, 0xCF, 0xC7,
-    0x94, 0xDA, 0xA8, 0x41, 0xD6, 0x11, 0xA9, 0x74, 0xAC, 0x95, 0x42, 0x58, 0x31, 0xC5, 0x15, 0xDB,
-    0xD9, 0x44, 0xF0, 0xD6, 0x60, 0xC4, 0xFE, 0x11, 0x7D, 0xDD, 0xCE, 0x0E, 0xAF, 0x74, 0x68, 0xDE,
-    0xB8, 0x3C, 0x61, 0x57, 0xA4, 0x96, 0x1D, 0xF3, 0x9E, 0x21, 0xEF, 0x59, 0x74, 0x80, 0x47, 0x19,
-    0x14, 0xAA, 0xC2, 0x8B, 0x9F, 0xDA, 0x96, 0xEA, 0x5F, 0xE7, 0x32, 0xAF, 0x42, 0x28, 0x2B, 0x3C,
-    0x6D, 0xA9, 0x02, 0xDB, 0x52, 0x35, 0x4E, 0x10, 0x8A, 0xED, 0x94, 0xAD, 0x13, 0xB0, 0x73, 0xFD,
-    0x2F, 0x9D, 0x54, 0xCF, 0x6F, 0x1B, 0x45, 0x14, 0xFE, 0xD6, 0x1B, 0x67, 0x93, 0x6C, 0xEA, 0x5D,
-    0x50, 0x2A, 0xD2, 0x40, 0xBD, 0x41, 0xB2, 0x50, 0x55, 0xD9, 0xDE, 0xAD, 0xE4, 0x83, 0x0B, 0xEB,
-    0xEC, 0x70, 0xE6, 0x80, 0x0F, 0x35, 0x1C, 0x31, 0x82, 0x53, 0xA5, 0x92, 0x95, 0x08, 0x52, 0x88,
-    0x4C, 0x3C, 0xF0, 0x17, 0xF8, 0xC0, 0x1D, 0x23, 0x15, 0x24, 0x5C, 0x21, 0x56, 0xA8, 0x07, 0x0A,
-    0x4A, 0x3D, 0x12, 0xFF, 0xC0, 0x94, 0x3F, 0x00, 0x2D, 0x12, 0x1C, 0x38, 0x61, 0xA1, 0x20, 0xE5,
-    0xE0, 0x76, 0xF8, 0x76, 0xDB, 0x54, 0xC0, 0x91, 0x59, 0xCF, 0xAC, 0xE7, 0xCD, 0xDB, 0xF7, 0xE3,
-    0x7B, 0xDF, 0x3C, 0x60, 0x84, 0x1E, 0x3C, 0x38, 0x02, 0xB0, 0xB5, 0x27, 0x5A, 0x38, 0x40, 0x31,
-    0x96, 0xB0, 0x1F, 0xC2, 0x7B, 0x1D, 0x57, 0x6C, 0x61, 0xC1, 0x0F, 0x72, 0xDD, 0x33, 0x2A, 0xAA,
-    0x63, 0xFC, 0x70, 0xBE, 0xE4, 0x69, 0x62, 0xCE, 0xAE, 0xCE, 0x6E, 0xEF, 0x5A, 0xDD, 0x5A, 0xB2,
-    0x74, 0xF3, 0x95, 0x5E, 0x6F, 0x05, 0x88, 0xDB, 0x71, 0x0B, 0xB8, 0x88, 0x44, 0x55, 0x94, 0xA3,
-    0xF6, 0xD0, 0x85, 0x0F, 0x0B, 0x61, 0xDE, 0x49, 0xD3, 0xE8, 0xFA, 0xC2, 0x95, 0xFC, 0xCC, 0xFE,
-    0x51, 0x7B, 0xAF, 0xC9, 0xD6, 0x65, 0xA4, 0x9D, 0xC2, 0x47, 0xEC, 0xA2, 0x1E, 0xC3, 0x5D, 0xC0,
-    0xD1, 0xF0, 0xEA, 0xAD, 0x38, 0x8E, 0x1B, 0xF5, 0xFA, 0xE5, 0x56, 0xF1, 0xA7, 0x8C, 0xA1, 0xB7,
-    0x87, 0xBA, 0x07, 0xD7, 0x11, 0xF6, 0x27, 0x8A, 0x5B, 0x2B, 0x47, 0x65, 0x81, 0x17, 0x3F, 0x46,
-    0xD7, 0x43, 0xB8, 0x84, 0x9B, 0xC3, 0xEA, 0x07, 0xCB, 0xEB, 0xB7, 0x86, 0x17, 0xE8, 0x50, 0x7A,
-    0x08, 0x98, 0xC8, 0x88, 0x4E, 0x1D, 0xE5, 0x72, 0xD7, 0x46, 0xCC, 0x54, 0x7C, 0x1C, 0x8E, 0x46,
-    0x71, 0xDC, 0x5C, 0xF9, 0xB7, 0x10, 0x54, 0x6C, 0x31, 0x6B, 0x9B, 0x59, 0x3B, 0xE7, 0x59, 0x0B,
-    0xE4, 0x57, 0x75, 0x11, 0xBD, 0x25, 0x56, 0xA8, 0xB7, 0x37, 0x49, 0xD4, 0x01, 0xFA, 0x18, 0x3F,
-    0xBA, 0xFA, 0x35, 0x9A, 0x7C, 0xBA, 0xE8, 0x20, 0xB5, 0xB5, 0xA3, 0x3C, 0x71, 0x8C, 0x53, 0xDA,
-    0x58, 0x45, 0xBD, 0x14, 0x36, 0xB1, 0x06, 0x07, 0x2E, 0x02, 0x61, 0x34, 0xB1, 0x59, 0xEC, 0x4F,
-    0x3D, 0xD4, 0x8A, 0x80, 0x89, 0x6A, 0x38, 0x99, 0xE7, 0x35, 0xAC, 0xE3, 0xA2, 0x30, 0x79, 0x91,
-    0x53, 0x45, 0xDB, 0xDA, 0x56, 0x36, 0xA3, 0x31, 0x38, 0xE1, 0xBE, 0xC5, 0xA0, 0x63, 0x3E, 0x23,
-    0xE2, 0x16, 0xC8, 0xAD, 0xD1, 0x88, 0xC1, 0xC5, 0xAD, 0x51, 0x0F, 0xA8, 0x52, 0x92, 0xE5, 0xD3,
-    0xE9, 0x91, 0x0E, 0x84, 0x25, 0x5C, 0x51, 0xA3, 0x9F, 0x5D, 0x46, 0xEC, 0x88, 0x8A, 0xB6, 0xF2,
-    0xE7, 0x74, 0x22, 0xDC, 0x32, 0x9B, 0xBB, 0x18, 0x53, 0xB7, 0xC4, 0xEF, 0xF0, 0xDD, 0xC4, 0xE4,
-    0x7B, 0xB3, 0x3C, 0x85, 0xCE, 0x2C, 0xD5, 0xB7, 0x84, 0xEF, 0xFB, 0x69, 0x96, 0x25, 0x46, 0x57,
-    0xAB, 0x85, 0x73, 0x02, 0x57, 0x1F, 0xC1, 0x23, 0xE0, 0x05, 0x9E, 0xF6, 0xC2, 0x3B, 0xED, 0xC5,
-    0xD3, 0xDA, 0xAE, 0x85, 0x6E, 0x0D, 0xC9, 0x53, 0x44, 0x7B, 0xEF, 0xA5, 0x1B, 0x16, 0x44, 0xF0,
-    0x8B, 0x7E, 0xD9, 0xA8, 0xB4, 0xCD, 0x9A, 0x8F, 0x97, 0x89, 0x29, 0x7E, 0xD5, 0xC1, 0x8D, 0xD0,
-    0x3C, 0xE4, 0xFA, 0x94, 0x02, 0xFF, 0xD4, 0xE3, 0x98, 0x9B, 0xC5, 0x6C, 0x36, 0x4D, 0x8C, 0x31,
-    0x7A, 0xCC, 0x45, 0x11, 0x98, 0x13, 0xE7, 0x34, 0x91, 0x87, 0x65, 0x3D, 0x59, 0x40, 0xD8, 0xF4,
-    0xEC, 0x12, 0x75, 0xAF, 0xCC, 0x9D, 0x21, 0x71, 0x2E, 0xFE, 0xD7, 0x51, 0x9F, 0x73, 0xBB, 0xEE,
-    0xD6, 0x46, 0x7E, 0x07, 0xD3, 0x0E, 0xF2, 0x03, 0xE8, 0xB9, 0x51, 0x83, 0x81, 0xA8, 0x0E, 0x04,
-    0x61, 0xE8, 0x40, 0xA7, 0x96, 0xFA, 0xFE, 0x8E, 0x9A, 0xCD, 0xA4, 0xF5, 0xAA, 0x08, 0x4D, 0x4E,
-    0x24, 0xFA, 0x3E, 0xE1, 0x6D, 0x66, 0x81, 0xF6, 0xE4, 0x91, 0xF6, 0x05, 0x26, 0x2C, 0x7E, 0x41,
-    0x7E, 0x69, 0xCB, 0x10, 0x0D, 0x30, 0xB3, 0xC0, 0x3C, 0x3A, 0xCF, 0x6F, 0xC9, 0xFC, 0x80, 0xBD,
-    0xF2, 0x72, 0x54, 0x54, 0x81, 0x97, 0xA3, 0x02, 0xBA, 0xAE, 0x42, 0x84, 0x0F, 0xD4, 0x91, 0x91,
-    0xD3, 0x36, 0xB6, 0x90, 0x30, 0x30, 0x17, 0x9B, 0x05, 0xF3, 0x59, 0xCA, 0xDE, 0xBD, 0x3C, 0xFE,
-    0x53, 0x5B, 0x0A, 0x87, 0x77, 0x4F, 0x3E, 0xA2, 0x15, 0x9A, 0x6B, 0x0D, 0x6E, 0x75, 0xF1, 0x42,
-    0x97, 0xD5, 0x63, 0x4D, 0x07, 0x83, 0xFF, 0x38, 0x68, 0x95, 0x74, 0x8F, 0x09, 0xD0, 0x4D, 0x61,
-    0x94, 0x2D, 0x1D, 0xE1, 0x94, 0x50, 0x35, 0x7D, 0xEF, 0x34, 0xE7, 0x9D, 0xBB, 0xF6, 0x73, 0x41,
-    0xCC, 0x62, 0xF0, 0xFB, 0x98, 0x94, 0xA2, 0x3C, 0x6B, 0xCF, 0x75, 0xE7, 0x79, 0xD2, 0x15, 0x16,
-    0xF1, 0x99, 0x50, 0xC1, 0x77, 0xCF, 0xB2, 0x0B, 0xFB, 0x7A, 0xC5, 0x82, 0x2B, 0x27, 0x6D, 0xA3,
-    0x3A, 0x65, 0x35, 0x2A, 0xAB, 0x08, 0xBE, 0x91, 0x89, 0x51, 0x1B, 0x17, 0x4A, 0x0B, 0xA4, 0xEB,
-    0x58, 0x34, 0x69, 0xA5, 0x0B, 0x63, 0x2F, 0xBD, 0xC5, 0xEF, 0xD6, 0xED, 0xD5, 0x8C, 0x8C, 0x45,
-    0xAA, 0xAB, 0x5F, 0x20, 0xC5, 0xC5, 0x2A, 0x3D, 0x0D, 0x69, 0xD0, 0x12, 0x4C, 0xEC, 0x01, 0x97,
-    0xF4, 0x27, 0x60, 0xED, 0xF1, 0x42, 0xBD, 0x95, 0xB4, 0x22, 0xB1, 0x5D, 0x20, 0x4F, 0xEC, 0x6F,
-    0x58, 0x7D, 0xE8, 0xF5, 0x2F, 0x91, 0x96, 0x06, 0x7E, 0xB3, 0x6E, 0x54, 0xB3, 0xD2, 0xA8, 0xC4,
-    0x3D, 0xDE, 0xC4, 0x31, 0x0A, 0xB6, 0xAF, 0xC7, 0x59, 0x7E, 0xB0, 0xC5, 0xD2, 0x9D, 0x85, 0x27,
-    0x1D, 0xF7, 0x59, 0x65, 0x6B, 0x1A, 0xC0, 0xFB, 0x62, 0x2C, 0x12, 0xFC, 0x20, 0x9F, 0x41, 0x45,
-    0x8C, 0xF1, 0x1D, 0xF6, 0xF9, 0xEE, 0x20, 0x94, 0x8E, 0x0A, 0x25, 0xAB, 0xB6, 0x81, 0x63, 0x4F,
-    0x78, 0x6F, 0xC9, 0xE3, 0xEB, 0x4A, 0xA7, 0x7A, 0xAD, 0xE6, 0xB8, 0x3D, 0xFF, 0x71, 0x87, 0x71,
-    0xF1, 0x8A, 0x0E, 0x27, 0xA1, 0xBA, 0x24, 0x89, 0x43, 0xF2, 0x87, 0x4E, 0x17, 0xD9, 0x34, 0x4B,
-    0x3F, 0xF8, 0x2B, 0x0F, 0x3F, 0x93, 0xBB, 0x8C, 0x7F, 0x2E, 0xDF, 0x14, 0xF6, 0x39, 0x71, 0xDA,
-    0xE5, 0xCD, 0xD6, 0xCC, 0xB8, 0x62, 0xCC, 0x19, 0xB0, 0x33, 0x13, 0xBC, 0x2A, 0x64, 0x13, 0x7B,
-    0x8B, 0xAB, 0x82, 0x89, 0x75, 0x1F, 0xB6, 0x31, 0xBC, 0xC6, 0x3B, 0x5F, 0x15, 0xB5, 0x30, 0x9A,
-    0x53, 0x9D, 0xBF, 0xC1, 0x02, 0xF9, 0x81, 0xF9, 0x15, 0x59, 0xEF, 0x0D, 0x8A, 0xA6, 0x58, 0xBD,
-    0x4F, 0x9B, 0x03, 0xCE, 0x7D, 0xDA, 0xB2, 0x1F, 0x0D, 0xE6, 0xC2, 0x93, 0xB4, 0x5F, 0xF4, 0xA9,
-    0x45, 0xD1, 0x4E, 0x7C, 0x3C, 0x19, 0x96, 0xB8, 0x39, 0x9B, 0xDD, 0xC9, 0x49, 0x7E, 0xB3, 0x28,
-    0x4A, 0x20, 0x4B, 0xA9, 0xFB, 0xE9, 0x95, 0x88, 0x63, 0x7A, 0x4D, 0x5F, 0x12, 0x81, 0x8C, 0xD4,
-    0x1D, 0xA1, 0xF1, 0x39, 0x2E, 0x91, 0x36, 0x5B, 0x8D, 0x28, 0x1A, 0x0A, 0x57, 0x37, 0x8A, 0xF3,
-    0xA8, 0xC3, 0xEC, 0xB7, 0x1B, 0x8D, 0x27, 0xBA, 0xDB, 0x62, 0x43, 0x46, 0x65, 0x41, 0x52, 0xEA,
-    0x72, 0x6C, 0x62, 0xDB, 0xBD, 0x7D, 0xE5, 0xE9, 0x69, 0x21, 0xD8, 0xC4, 0x4E, 0xDE, 0x8C, 0x3A,
-    0x34, 0xB2, 0x3B, 0xF1, 0xC5, 0xFA, 0xB7, 0x7A, 0xB3, 0x3B, 0xDC, 0x8E, 0x86, 0x8D, 0x68, 0x12,
-    0x0D, 0x95, 0x2F, 0xC4, 0x8E, 0x6C, 0xB2, 0x43, 0x45, 0xEC, 0x1C, 0x0C, 0x71, 0xEB, 0xC3, 0x68,
-    0x38, 0xD1, 0x8D, 0xFE, 0xE4, 0x6D, 0xF5, 0x0E, 0x5E, 0x22, 0x11, 0xB6, 0xB0, 0xB6, 0xBB, 0xAE,
-    0x1C, 0x76, 0x97, 0x06, 0x95, 0xFF, 0x06, 0xCD, 0x7C, 0x4F, 0x8C, 0x1C, 0xE7, 0x75, 0xE7, 0xAB,
-    0x2A, 0x91, 0x65, 0xB0, 0x10, 0x96, 0x0E, 0x92, 0x13, 0x9B, 0xAB, 0x29, 0x1F, 0x7C, 0x70, 0x62,
-    0x4D, 0xF7, 0xC5, 0x01, 0x1C, 0xA0, 0xBA, 0xBB, 0x24, 0x01, 0xAB, 0x83, 0x0E, 0x9E, 0x05, 0x38,
-    0x76, 0x80, 0x00, 0xA6, 0x0F, 0x3E, 0x24, 0x42, 0x12, 0x1A, 0x88, 0x03, 0x0C, 0x82, 0x26, 0xA7,
-    0x24, 0x1D, 0x7C, 0x30, 0xB0, 0x66, 0x80, 0xF5, 0xE6, 0xB6, 0xD1, 0x41, 0x07, 0x2F, 0xB9, 0xBB,
-    0x64, 0x80, 0x01, 0xB6, 0x17, 0x69, 0xB2, 0x4B, 0xE2, 0x41, 0x07, 0x1F, 0x58, 0x96, 0xAD, 0xE8,
-    0x20, 0xC4, 0x2A, 0xCB, 0x24, 0x8C, 0x25, 0xB1, 0x66, 0xD9, 0x2E, 0x26, 0x45, 0xB2, 0xA7, 0x2B,
-    0xBF, 0xDF, 0xFB, 0xBE, 0xEA, 0xEE, 0x19, 0x36, 0x49, 0xF1, 0x9F, 0x37, 0x33, 0x5D, 0x1F, 0x39,
-    0xDD, 0x55, 0xDF, 0xF7, 0xDE, 0xFB, 0xDE, 0xFF, 0xF7, 0xBE, 0x16, 0xC1, 0x8F, 0x5B, 0x60, 0x28,
-    0x71, 0x7D, 0x19, 0xD7, 0x7F, 0x10, 0xFD, 0xD9, 0x6E, 0x72, 0x99, 0xE0, 0xAA, 0xCC, 0x47, 0x4E,
-    0x69, 0x6E, 0xE3, 0xE5, 0x5D, 0x39, 0x2A, 0x5E, 0xB3, 0x2B, 0xFE, 0xD5, 0x1F, 0x48, 0x90, 0x8A,
-    0x84, 0x09, 0x2E, 0x31, 0x57, 0x84, 0xAB, 0x83, 0x6B, 0xD0, 0x94, 0x7A, 0x89, 0xF3, 0x42, 0x22,
-    0xDE, 0xC5, 0x4C, 0xFC, 0xEF, 0x64, 0xE2, 0xC8, 0x63, 0x9D, 0x7B, 0xD0, 0x34, 0x98, 0xAA, 0x11,
-    0x19, 0xE1, 0xCD, 0xFD, 0x73, 0xDD, 0xBE, 0x8C, 0x79, 0x1A, 0xF1, 0xF2, 0x28, 0xF5, 0x33, 0x3F,
-    0x0B, 0x52, 0x2F, 0x0F, 0x13, 0x5C, 0xE2, 0x65, 0xA1, 0x04, 0x59, 0x24, 0x51, 0xD2, 0x39, 0x3C,
-    0x93, 0x5E, 0x58, 0xCB, 0xE2, 0xC7, 0xCF, 0xCC, 0x4A, 0x31, 0xAE, 0x6F, 0x2D, 0xC3, 0x9A, 0xAD,
-    0x84, 0x35, 0xC7, 0x95, 0x99, 0xA7, 0xEE, 0x06, 0x6B, 0xCF, 0xCE, 0x66, 0xA6, 0x6F, 0x0A, 0x00,
-    0x5D, 0xC9, 0xAE, 0x7C, 0xCE, 0xC3, 0x3C, 0x41, 0x66, 0x9E, 0xE9, 0xE2, 0xA3, 0xBE, 0xE2, 0x35,
-    0xC5, 0x55, 0xCB, 0x10, 0xFF, 0x6F, 0x2F, 0x3E, 0x3F, 0xE0, 0x7C, 0x98, 0xDF, 0x9F, 0xED, 0x8A,
-    0x83, 0x7B, 0xE6, 0x3F, 0xDD, 0x59, 0x22, 0x4D, 0x93, 0xBA, 0x95, 0xAB, 0xB0, 0xF8, 0x16, 0x16,
-    0x8F, 0xF0, 0x11, 0xAD, 0x09, 0x26, 0x8F, 0xF8, 0x07, 0x81, 0x1F, 0x5B, 0x48, 0x62, 0xFD, 0xFF,
-    0x86, 0x53, 0xCB, 0x64, 0x52, 0x00, 0xBD, 0xC4, 0xCC, 0xB5, 0x05, 0x2A, 0x56, 0x52, 0x3A, 0xA5,
-    0x5B, 0xB8, 0x85, 0x97, 0x7B, 0x4A, 0xB3, 0x30, 0xC1, 0x2F, 0x70, 0xE9, 0x00, 0x0E, 0x3C, 0xF7,
-    0x9F, 0x12, 0xF9, 0x4D, 0xC6, 0x57, 0xFB, 0x08, 0x29, 0x5F, 0x91, 0x2E, 0x20, 0x0B, 0x28, 0x82,
-    0x17, 0xE0, 0x00, 0x49, 0x00, 0x05, 0x08, 0x02, 0xDC, 0xF8, 0x52, 0x62, 0x74, 0x14, 0x15, 0xA5,
-    0x44, 0xAC, 0x98, 0xDD, 0xF7, 0x49, 0xD9, 0xFF, 0xE4, 0x58, 0xFE, 0x63, 0x25, 0xA0, 0xE0, 0x69,
-    0x4E, 0xD2, 0x60, 0x4B, 0x40, 0x0C, 0x8E, 0x6E, 0xAE, 0x48, 0x67, 0xDC, 0x02, 0x3F, 0x23, 0x41,
-    0x09, 0x38, 0x49, 0x6B, 0x36, 0x23, 0x9A, 0x71, 0x9E, 0x2E, 0x9E, 0x5C, 0x97, 0x1E, 0x48, 0x11,
-    0xE3, 0x77, 0x84, 0x6B, 0x88, 0xDF, 0x2D, 0x1D, 0x2B, 0xFC, 0x3D, 0x02, 0x2C, 0x95, 0x54, 0xA0,
-    0x5D, 0xE9, 0x97, 0x4D, 0xC6, 0xA9, 0x1B, 0x71, 0x9B, 0x9B, 0x32, 0x47, 0x96, 0xB3, 0x8D, 0x74,
-    0x63, 0x2B, 0xDD, 0xDA, 0x92, 0x23, 0xC0, 0xEF, 0x29, 0x37, 0xC4, 0x3A, 0x02, 0x31, 0xEF, 0xD6,
-    0xE9, 0xD9, 0x5B, 0xE4, 0xBD, 0xA6, 0x49, 0xFC, 0xF7, 0x37, 0x6F, 0x1C, 0x27, 0x60, 0xA5, 0x57,
-    0x84, 0x09, 0x69, 0x1B, 0x0A, 0xE9, 0x0B, 0x2E, 0xCC, 0xC1, 0x99, 0x42, 0x2A, 0x77, 0x00, 0x74,
-    0x37, 0xED, 0x81, 0x39, 0x66, 0x98, 0x24, 0x50, 0x16, 0xB9, 0x17, 0x5F, 0xD7, 0x9C, 0x1B, 0x9C,
-    0x1C, 0xE1, 0x59, 0x22, 0x0D, 0x7E, 0x4E, 0xC8, 0xD3, 0x3E, 0xF9, 0x3A, 0x8D, 0x24, 0x48, 0x3A,
-    0x40, 0xBD, 0xA7, 0xE0, 0x9A, 0x1F, 0xB2, 0x02, 0xF9, 0x03, 0x1F, 0x61, 0xF8, 0x9D, 0x05, 0x46,
-    0x1D, 0x2E, 0x01, 0xBE, 0xA8, 0x38, 0x7B, 0x09, 0x2A, 0x3A, 0x25, 0x08, 0xE7, 0x16, 0xC4, 0x28,
-    0xC7, 0x53, 0xDE, 0x2F, 0xC8, 0xE5, 0xA4, 0xB1, 0x7F, 0x8D, 0x3C, 0xFE, 0x06, 0x26, 0x09, 0x5F,
-    0x2C, 0x49, 0x54, 0x1D, 0x46, 0x24, 0xEC, 0x50, 0x94, 0x3D, 0xF0, 0x8A, 0xB8, 0x4D, 0x61, 0xD2,
-    0xCE, 0x4F, 0x96, 0x36, 0x50, 0xF8, 0x29, 0x95, 0xCC, 0x82, 0x6D, 0xB0, 0x12, 0x08, 0x49, 0x99,
-    0x1A, 0x64, 0x98, 0xA9, 0x49, 0x41, 0x99, 0x6B, 0x89, 0x5B, 0xF8, 0x97, 0xB0, 0x78, 0x48, 0xE2,
-    0xF4, 0xD6, 0x40, 0x9B, 0x11, 0x48, 0xF3, 0x76, 0xD9, 0xC3, 0xBA, 0x19, 0xE6, 0xFD, 0x4A, 0x32,
-    0x94, 0xB0, 0x83, 0x07, 0x43, 0x6E, 0x58, 0x54, 0xE2, 0xC1, 0x6E, 0x8E, 0x61, 0x00, 0xBA, 0x62,
-    0x2D, 0x12, 0x27, 0x24, 0x1E, 0xE1, 0x77, 0x28, 0x96, 0xCA, 0xD6, 0x47, 0x5B, 0xB9, 0x4B, 0x01,
-    0x22, 0x98, 0xAB, 0x47, 0x32, 0xD4, 0xB8, 0xD5, 0x21, 0xDF, 0x91, 0x24, 0x44, 0x5A, 0x2A, 0xC2,
-    0x3C, 0xE2, 0x96, 0x0E, 0x55, 0x40, 0x76, 0x30, 0xAC, 0x53, 0x1D, 0x46, 0x24, 0x5A, 0x98, 0x5A,
-    0x71, 0x56, 0x59, 0x74, 0x28, 0x7E, 0xD4, 0x6B, 0x80, 0x5A, 0x16, 0x94, 0x04, 0x65, 0x47, 0x44,
-    0xBD, 0x22, 0xC2, 0x25, 0x6E, 0xC7, 0x0A, 0x6B, 0x84, 0xA9, 0xC3, 0x41, 0xD7, 0x8D, 0x09, 0xC1,
-    0xD0, 0xE0, 0x0E, 0x8E, 0xA8, 0xEC, 0xED, 0x09, 0x6E, 0x0F, 0x79, 0x7B, 0x64, 0x6E, 0xC7, 0x9D,
-    0x03, 0xB2, 0xB5, 0x0E, 0x86, 0x7C, 0x6B, 0x1C, 0xD6, 0x65, 0xAE, 0x49, 0x08, 0x11, 0xA8, 0x47,
-    0xE2, 0xC9, 0x3F, 0xE2, 0x82, 0x40, 0xBA, 0x3F, 0x87, 0xF4, 0xBC, 0x93, 0x4B, 0xF0, 0x7A, 0x21,
-    0x91, 0x53, 0x48, 0x1F, 0x13, 0x9E, 0x3C, 0x0D, 0xD2, 0x36, 0xA5, 0x73, 0x63, 0x93, 0xA8, 0x56,
-    0xD0, 0x36, 0x44, 0x74, 0x04, 0x6D, 0x33, 0xEA, 0x51, 0x04, 0xB7, 0x81, 0xC6, 0xA4, 0x29, 0xEF,
-    0xE0, 0x30, 0x92, 0x6F, 0x76, 0x0A, 0x24, 0x9C, 0x02, 0xD8, 0x6D, 0xB1, 0x5A, 0x20, 0x0D, 0x55,
-    0xA0, 0xC2, 0x04, 0xA2, 0x04, 0x30, 0xCF, 0xAB, 0x22, 0x1B, 0x90, 0x08, 0xDB, 0x90, 0x11, 0xD5,
-    0x90, 0x3E, 0xF6, 0xC4, 0x21, 0x2F, 0x55, 0x98, 0xA7, 0x74, 0x73, 0xE8, 0x91, 0xF7, 0x8F, 0x65,
-    0x1E, 0x64, 0xC8, 0xBF, 0x7A, 0xDE, 0xCE, 0xE3, 0x5B, 0x4E, 0xF5, 0xA1, 0x81, 0xC3, 0xB4, 0x03,
-    0xDD, 0x36, 0x80, 0xB6, 0x1F, 0x80, 0xEB, 0x1F, 0x9F, 0xA6, 0x0D, 0x28, 0x3B, 0x12, 0xEA, 0x18,
-    0xE9, 0x67, 0xEB, 0xF6, 0x53, 0xA3, 0xFF, 0x86, 0x56, 0xDD, 0x89, 0x0A, 0xBE, 0xA8, 0xE0, 0x73,
-    0x39, 0x5D, 0x90, 0xCB, 0x7A, 0x19, 0x17, 0xA5, 0xC9, 0xE0, 0x12, 0x5C, 0xB8, 0xAF, 0xE3, 0x98,
-    0x00, 0x60, 0x5E, 0x50, 0x86, 0x63, 0xAD, 0x6B, 0x8F, 0x74, 0x85, 0x4A, 0x57, 0x28, 0xB9, 0x02,
-    0x67, 0x78, 0x5C, 0xD6, 0x73, 0x0D, 0xBF, 0x1D, 0x7E, 0xD6, 0x23, 0xD4, 0x41, 0x1A, 0x3B, 0x15,
-    0xC1, 0x8B, 0x09, 0x99, 0x9B, 0x0F, 0xC9, 0x09, 0x4E, 0x39, 0x52, 0x49, 0xAB, 0x2A, 0x6A, 0x78,
-    0x39, 0xF1, 0x2F, 0xA5, 0x31, 0x5B, 0x2A, 0x6E, 0xCD, 0x6D, 0xFE, 0xE3, 0x7D, 0xFC, 0x73, 0xE5,
-    0xE4, 0x8B, 0x3F, 0xE2, 0x67, 0x5D, 0x2F, 0x23, 0x58, 0x43, 0x3F, 0x03, 0xF2, 0x4E, 0x85, 0x49,
-    0x49, 0x60, 0xAA, 0x0C, 0xE1, 0x2E, 0x47, 0x34, 0x38, 0xE1, 0x5C, 0x8E, 0x27, 0xBB, 0x54, 0xB6,
-    0xA9, 0x24, 0x81, 0xB5, 0x2C, 0x9E, 0xDD, 0x0F, 0xEE, 0xC5, 0x71, 0x7C, 0x7E, 0x59, 0xE4, 0xD5,
-    0xDA, 0xC2, 0xAD, 0x78, 0x24, 0xAD, 0x55, 0x7B, 0x5A, 0x2E, 0xC8, 0xE0, 0x7A, 0x0D, 0xD5, 0x9B,
-    0x3F, 0x69, 0xC9, 0x97, 0x92, 0x42, 0x52, 0x71, 0x67, 0xB7, 0x89, 0xDC, 0x01, 0x79, 0xE2, 0xCA,
-    0xE6, 0x09, 0xAA, 0xCF, 0x06, 0xE2, 0xE0, 0x70, 0x70, 0x73, 0xB5, 0x8A, 0x6A, 0x17, 0xD5, 0x32,
-    0x92, 0xFF, 0x12, 0x1A, 0x48, 0xDE, 0x18, 0x91, 0xDE, 0xEB, 0xE6, 0xB9, 0x0E, 0x87, 0x75, 0x42,
-    0xD5, 0x23, 0x33, 0xC6, 0x64, 0xBB, 0x21, 0xF7, 0x6A, 0x24, 0x2A, 0x52, 0x8D, 0x71, 0xF0, 0xF8,
-    0x73, 0x12, 0x7B, 0x93, 0xC9, 0x04, 0xDB, 0x9C, 0xF2, 0xED, 0x49, 0x2A, 0xB7, 0xB1, 0x5A, 0xE2,
-    0x5C, 0x4B, 0xBC, 0x8F, 0xC4, 0xFD, 0x45, 0xE2, 0xFF, 0xBD, 0xB8, 0x1F, 0xA4, 0xC0, 0xDE, 0x7B,
-    0x37, 0x5D, 0x5B, 0xA7, 0xF3, 0x16, 0xC3, 0x3A, 0x5D, 0xCC, 0x76, 0x62, 0x12, 0xA7, 0x04, 0x61,
-    0x5E, 0x7A, 0x27, 0x07, 0x65, 0xDC, 0x8B, 0xE0, 0xA3, 0xD0, 0xFD, 0x30, 0x81, 0xAA, 0x73, 0x66,
-    0x98, 0x7E, 0xDD, 0x99, 0xAA, 0x39, 0xAC, 0xD5, 0x1C, 0xAA, 0x7E, 0xDD, 0xA2, 0xEE, 0xB5, 0xFA,
-    0x2E, 0x50, 0x55, 0x47, 0x02, 0xD2, 0x08, 0xCE, 0xF5, 0xDD, 0x95, 0xCD, 0x13, 0xB4, 0x68, 0x50,
-    0x36, 0x57, 0x4F, 0x4F, 0x79, 0xE7, 0x90, 0xB8, 0x8D, 0x88, 0xDB, 0xB2, 0x36, 0xB5, 0x8A, 0x54,
-    0xA7, 0xF6, 0x2C, 0x3F, 0x05, 0xD0, 0xF2, 0xD0, 0x62, 0x4E, 0xED, 0xD4, 0xC0, 0x74, 0x08, 0x0E,
-    0xED, 0xE1, 0xD1, 0x0E, 0x34, 0x5C, 0x07, 0x22, 0xD1, 0x01, 0x25, 0x3A, 0x20, 0x6F, 0x0F, 0x57,
-    0x8C, 0x6B, 0x88, 0xAB, 0xEE, 0x61, 0x2E, 0x08, 0x73, 0x11, 0xA5, 0x51, 0x16, 0xCC, 0x1A, 0x20,
-    0x5E, 0xB5, 0x7E, 0x1E, 0x98, 0x7C, 0x02, 0xCB, 0xBA, 0x4A, 0x29, 0xDF, 0xA9, 0xC3, 0x87, 0x84,
-    0x74, 0x59, 0xE5, 0xDF, 0xF5, 0x76, 0xD9, 0xAE, 0xA9, 0x1F, 0x41, 0x81, 0x23, 0x39, 0xFD, 0x00,
-    0xC7, 0xF8, 0x58, 0xAD, 0x9F, 0x05, 0x4F, 0x0B, 0x1E, 0x2A, 0x6C, 0x7F, 0xD0, 0x5C, 0x7E, 0x64,
-    0x0F, 0xB2, 0xBD, 0xF7, 0x93, 0x78, 0x90, 0x30, 0x30, 0xA9, 0x22, 0xBD, 0xFF, 0xC1, 0xD6, 0xEB,
-    0xD8, 0xA7, 0xBB, 0x96, 0x75, 0xF0, 0xB2, 0x1E, 0x7E, 0xD2, 0xC6, 0xD5, 0xFC, 0xA8, 0x5C, 0x90,
-    0x2C, 0x07, 0x41, 0x26, 0xEE, 0x93, 0x78, 0x55, 0x2F, 0xCA, 0xC2, 0x34, 0xF6, 0x8A, 0xAE, 0x0C,
-    0x9D, 0x92, 0x0A, 0xB2, 0x84, 0x63, 0xE7, 0x80, 0x41, 0x2B, 0x0E, 0x20, 0x70, 0x0C, 0x38, 0xB2,
-    0x3E, 0xA4, 0x3C, 0x8D, 0x7E, 0xFC, 0xA3, 0x09, 0x88, 0x07, 0x95, 0x2D, 0xC7, 0x67, 0x89, 0x41,
-    0x40, 0x31, 0x30, 0x31, 0x49, 0x6C, 0xB0, 0x88, 0x08, 0x0B, 0xD5, 0x20, 0x5D, 0x26, 0x9A, 0x52,
-    0x88, 0x00, 0xB5, 0xDE, 0x47, 0xBC, 0x6F, 0xB7, 0x75, 0xA5, 0x5C, 0x42, 0x19, 0x70, 0x88, 0x74,
-    0x7F, 0x08, 0x7E, 0x0D, 0xD0, 0xDC, 0x12, 0x13, 0xAA, 0x9C, 0x32, 0xD0, 0x98, 0x6B, 0x89, 0x55,
-    0xAE, 0x41, 0x74, 0x4F, 0xD7, 0x60, 0xE7, 0x9E, 0xAE, 0xC1, 0x8C, 0xC3, 0xEE, 0xDC, 0x1B, 0xD0,
-    0x81, 0xDB, 0xA6, 0x22, 0xE3, 0x32, 0xC0, 0x51, 0xC7, 0x92, 0x6E, 0x25, 0xC4, 0x16, 0xCA, 0x8C,
-    0x0A, 0x3E, 0x4C, 0x70, 0x01, 0x24, 0x84, 0x3D, 0x57, 0x67, 0x20, 0x04, 0x9E, 0x7F, 0x66, 0xD5,
-    0x9E, 0x97, 0xE6, 0xDA, 0xC2, 0x07, 0x6B, 0xEA, 0x24, 0x77, 0xF0, 0xF6, 0x10, 0x50, 0x96, 0xFC,
-    0x8B, 0xA6, 0x5D, 0x62, 0xC0, 0x82, 0xF7, 0x5C, 0xAA, 0xC3, 0x91, 0x97, 0xF3, 0x3D, 0xB5, 0x97,
-    0xD8, 0x6D, 0xFE, 0x45, 0x87, 0x14, 0x14, 0x87, 0xA1, 0xA7, 0x9B, 0xCB, 0xF7, 0xE8, 0x96, 0x7A,
-    0x34, 0xF7, 0x09, 0x9D, 0x5D, 0xFE, 0x35, 0x50, 0xE7, 0x58, 0x47, 0xA3, 0xB1, 0x56, 0xAF, 0xB5,
-    0x33, 0x5F, 0xAB, 0xB8, 0xFB, 0x5A, 0x4E, 0x41, 0xF7, 0xF7, 0x3E, 0x6B, 0x4D, 0x75, 0x34, 0x91,
-    0xDE, 0x8E, 0x8E, 0x46, 0xEA, 0x55, 0x25, 0x3A, 0xE5, 0x00, 0x9B, 0xB9, 0x3D, 0x95, 0xD5, 0x0E,
-    0x37, 0x24, 0x8E, 0xE6, 0xDA, 0x83, 0x2B, 0xC4, 0xE8, 0x22, 0x48, 0xD5, 0x91, 0xB1, 0xA1, 0x51,
-    0x17, 0x14, 0x3D, 0x0F, 0x03, 0x57, 0x1B, 0x57, 0x68, 0x4B, 0x14, 0x15, 0xC5, 0x44, 0x11, 0x51,
-    0x3C, 0x14, 0x0D, 0xC5, 0x02, 0x48, 0x34, 0xA7, 0x80, 0x03, 0x44, 0x10, 0x28, 0x9C, 0x24, 0x06,
-    0x11, 0x11, 0x08, 0x5F, 0x04, 0xFC, 0x21, 0xC1, 0x8F, 0x08, 0x7D, 0x1F, 0xC0, 0x3B, 0x53, 0xC2,
-    0x0E, 0xE9, 0x19, 0x34, 0x58, 0x89, 0x33, 0xAF, 0x84, 0x4E, 0x2D, 0xCC, 0x1E, 0x67, 0x4D, 0x0C,
-    0x64, 0x7A, 0xC9, 0x1D, 0xCE, 0x1A, 0xF9, 0xB7, 0x31, 0x21, 0x84, 0x93, 0xD0, 0x89, 0x54, 0x4F,
-    0xC2, 0xCE, 0x68, 0xAF, 0x46, 0x1D, 0xC3, 0x25, 0x91, 0x6F, 0xD5, 0xCC, 0x40, 0x45, 0x94, 0x3E,
-    0xE3, 0x3C, 0x6C, 0x6C, 0xAD, 0x2C, 0x83, 0xAC, 0x91, 0x46, 0x65, 0x95, 0xA7, 0x8E, 0x60, 0x98,
-    0xD1, 0x15, 0x84, 0x6C, 0xC0, 0x1A, 0x40, 0xC3, 0x8C, 0x21, 0x8D, 0xA0, 0x81, 0x77, 0x05, 0xF6,
-    0x72, 0xEC, 0x71, 0x2B, 0x46, 0xFE, 0x55, 0x20, 0x53, 0x07, 0x69, 0xA5, 0x4A, 0xA2, 0xA2, 0xF5,
-    0x04, 0x7A, 0xDC, 0xC9, 0x5A, 0xDD, 0xC3, 0xA1, 0x75, 0x10, 0xB7, 0x69, 0x1B, 0x6F, 0x4F, 0xC1,
-    0x20, 0x6E, 0xEB, 0x48, 0x00, 0x0E, 0xF8, 0x25, 0x21, 0xE3, 0x65, 0x18, 0xEA, 0xB1, 0x0D, 0xE1,
-    0x2A, 0xFD, 0x2D, 0x65, 0x0C, 0x1C, 0x06, 0x5F, 0x2D, 0xF0, 0x39, 0xAE, 0x33, 0x90, 0x44, 0xE0,
-    0x30, 0xF6, 0x33, 0xE5, 0x97, 0xDC, 0xEC, 0x1D, 0x3D, 0x9C, 0x31, 0xE5, 0xFD, 0x33, 0x0E, 0x66,
-    0x7D, 0x37, 0x09, 0xAE, 0x34, 0x12, 0xE1, 0xDD, 0x3E, 0x7E, 0x87, 0xB8, 0x46, 0x58, 0x93, 0x56,
-    0xB4, 0xD2, 0xA9, 0x6B, 0x78, 0xB4, 0x58, 0xC0, 0xAF, 0x64, 0xFB, 0x3C, 0x1C, 0x81, 0xB2, 0x5C,
-    0x42, 0xFD, 0x78, 0x26, 0x11, 0xB0, 0x9E, 0x9C, 0xD2, 0x28, 0xDB, 0xB7, 0x94, 0x8A, 0xA0, 0xEB,
-    0x3B, 0x13, 0x80, 0x97, 0x9F, 0x00, 0x06, 0x1D, 0x39, 0x81, 0xB5, 0xB8, 0x1E, 0x9D, 0xC5, 0x1D,
-    0xCC, 0xBD, 0xA3, 0x31, 0xA8, 0x61, 0xF3, 0xEE, 0x59, 0xF8, 0xED, 0x8D, 0x9D, 0xEE, 0xE0, 0x29,
-    0x75, 0xB9, 0xDC, 0x1B, 0xCA, 0x6D, 0x62, 0xC2, 0xEF, 0xBE, 0x74, 0x4F, 0xD7, 0xEA, 0x24, 0xF7,
-    0x40, 0x7F, 0x86, 0xE2, 0x3D, 0xFC, 0x76, 0x49, 0xA1, 0x6B, 0xD5, 0x82, 0x2A, 0xAF, 0x26, 0x7E,
-    0x53, 0x7A, 0x7F, 0x5B, 0xDB, 0xF8, 0x1A, 0xBB, 0xBA, 0x9D, 0xF9, 0x37, 0xA5, 0x9B, 0xDA, 0x90,
-    0x7B, 0x28, 0xC9, 0xE0, 0x4C, 0x16, 0xCE, 0x75, 0x2B, 0x59, 0xDB, 0xBD, 0x5A, 0x5B, 0xE5, 0x1B,
-    0x2D, 0xFC, 0xB7, 0x0B, 0x5F, 0xC1, 0x4C, 0x1F, 0x81, 0x50, 0x93, 0x84, 0x1B, 0x10, 0x2B, 0xE0,
-    0x91, 0x86, 0xBD, 0x95, 0x12, 0x66, 0xA8, 0x94, 0x1E, 0xC3, 0x04, 0x0D, 0xCE, 0x42, 0xDD, 0xCD,
-    0xEC, 0x84, 0x9F, 0x4D, 0x9C, 0xA6, 0x0C, 0xAE, 0x54, 0xB8, 0xBD, 0x0F, 0x67, 0xCC, 0x2D, 0x2F,
-    0x4C, 0x32, 0x88, 0x4E, 0x25, 0xF6, 0x65, 0x00, 0x08, 0x94, 0x77, 0x9C, 0x37, 0x65, 0x43, 0xBE,
-    0xE9, 0xE1, 0xD3, 0x60, 0xEA, 0x74, 0xA5, 0xEC, 0x1E, 0x95, 0xF0, 0x05, 0x28, 0x70, 0x09, 0x5E,
-    0x2B, 0x20, 0xA2, 0xFE, 0xEB, 0x39, 0xED, 0xDB, 0xB5, 0xAB, 0xA5, 0xFA, 0xF3, 0x0C, 0xEE, 0x5E,
-    0xBE, 0x08, 0x3C, 0xA3, 0xE0, 0x75, 0x8C, 0x9D, 0xE0, 0x45, 0x4A, 0x14, 0xE3, 0xBD, 0x2F, 0x82,
-    0x6B, 0x66, 0xE9, 0x20, 0x5B, 0xD3, 0x70, 0x48, 0x59, 0xE3, 0xCF, 0xB0, 0xF3, 0xF9, 0xA1, 0x97,
-    0x4B, 0x95, 0x14, 0xA6, 0x17, 0xDC, 0x26, 0xF5, 0x1A, 0x65, 0x63, 0xBA, 0x53, 0x39, 0x28, 0x7B,
-    0x6B, 0x92, 0x4C, 0x54, 0x87, 0x1E, 0x10, 0x07, 0xE2, 0x12, 0xD8, 0xC8, 0x26, 0x54, 0x23, 0xB0,
-    0x8E, 0x31, 0x56, 0x32, 0x9B, 0x24, 0xC1, 0x48, 0xA6, 0xB0, 0x2B, 0xF5, 0x82, 0x01, 0x2A, 0xCB,
-    0x00, 0xDF, 0x38, 0x04, 0x75, 0x02, 0xBA, 0xF5, 0xC1, 0xD4, 0x47, 0x0A, 0x79, 0xD4, 0xF9, 0x1C,
-    0x88, 0x24, 0x18, 0x34, 0xA5, 0xF2, 0xF6, 0xB2, 0x31, 0xFD, 0x51, 0x09, 0xBE, 0xC3, 0x88, 0x43,
-    0xCC, 0x85, 0xAD, 0x59, 0x03, 0x12, 0x1D, 0xA0, 0xD0, 0x33, 0x3E, 0x96, 0xCE, 0x26, 0xCE, 0xA6,
-    0x0D, 0x29, 0xDE, 0x1F, 0x63, 0x59, 0x70, 0x05, 0x05, 0x52, 0x79, 0xAD, 0x52, 0x2D, 0x44, 0x2E,
-    0xDB, 0xA2, 0x2A, 0xA5, 0xD2, 0xF4, 0xB2, 0x01, 0x7C, 0x8E, 0x41, 0xA2, 0x26, 0x50, 0x9C, 0x0D,
-    0xBC, 0xBC, 0x5A, 0xC2, 0x12, 0x43, 0x54, 0x78, 0x53, 0xE9, 0xE7, 0xFE, 0xFF, 0x90, 0xFF, 0x9D,
-    0x05, 0x7F, 0x81, 0xB8, 0x32, 0x7C, 0xCE, 0xFB, 0x20, 0x0B, 0x0F, 0xFB, 0xDF, 0x4D, 0xC3, 0x30,
-    0x0C, 0x92, 0xB5, 0x70, 0x3D, 0x94, 0xF5, 0x60, 0x18, 0x4A, 0xEC, 0x57, 0x6B, 0x18, 0x8A, 0x0E,
-    0x44, 0x1A, 0x66, 0xC6, 0x49, 0x64, 0xC3, 0x63, 0xBC, 0x97, 0xD1, 0x9F, 0x61, 0x56, 0x83, 0xD9,
-    0x23, 0x28, 0x23, 0xA8, 0x19, 0xC6, 0x61, 0x91, 0xAA, 0x22, 0xC6, 0x62, 0x1D, 0x65, 0x5D, 0x43,
-    0x89, 0x78, 0xC1, 0xEE, 0xD5, 0x71, 0xB2, 0x7B, 0x4A, 0xB5, 0x1D, 0x89, 0xC9, 0x89, 0xAC, 0x43,
-    0x99, 0xF5, 0x6C, 0x26, 0xA3, 0xA3, 0x74, 0x84, 0xCF, 0xA5, 0xEC, 0x9E, 0x59, 0x6A, 0xBD, 0x25,
-    0xDE, 0x0F, 0xE1, 0x07, 0xFC, 0xF2, 0x58, 0xEA, 0x21, 0xBA, 0xF5, 0xF3, 0x20, 0x0B, 0x98, 0xB3,
-    0x4A, 0x5B, 0xD5, 0x17, 0x41, 0x19, 0xEF, 0x5F, 0x13, 0x62, 0xB0, 0xF1, 0x19, 0x91, 0x5F, 0x61,
-    0x92, 0x7F, 0xFD, 0xBB, 0x52, 0x76, 0xE1, 0x8D, 0x51, 0xBA, 0x4B, 0x93, 0xF9, 0x31, 0xF4, 0x71,
-    0xD5, 0xBC, 0x60, 0xC6, 0x2C, 0x2C, 0xA2, 0x24, 0x3C, 0x39, 0x93, 0xA8, 0x5B, 0xD9, 0x38, 0x72,
-    0x91, 0x43, 0x6B, 0xCD, 0x26, 0x71, 0x98, 0x4C, 0xDD, 0x9B, 0x7F, 0xAC, 0x86, 0x7F, 0x91, 0xB1,
-    0x32, 0xAF, 0xBE, 0x3A, 0x67, 0xE1, 0xD5, 0xDC, 0x48, 0xA9, 0x93, 0x7C, 0xD3, 0x01, 0xD8, 0xEF,
-    0xCE, 0x20, 0x33, 0xDE, 0x4F, 0x8F, 0x9D, 0xE8, 0x8A, 0x57, 0x06, 0x88, 0x1A, 0x08, 0x3C, 0xD8,
-    0x26, 0x6B, 0xC3, 0x6C, 0x43, 0xB0, 0x35, 0xBD, 0x3A, 0xB8, 0x18, 0xC0, 0x76, 0xAC, 0xE4, 0x1B,
-    0xD2, 0x71, 0xE3, 0x87, 0xAA, 0xF4, 0xE4, 0x19, 0x86, 0x3B, 0x1A, 0x8E, 0x28, 0x7E, 0x31, 0xBD,
-    0x14, 0xB5, 0x3B, 0x3D, 0x2A, 0xF0, 0x75, 0x6E, 0x74, 0x87, 0x4A, 0x69, 0x8D, 0x22, 0xBE, 0x46,
-    0x59, 0x0F, 0x69, 0x4E, 0x42, 0x72, 0x5D, 0x48, 0xB6, 0x0D, 0xE6, 0xDE, 0xD0, 0xDC, 0x15, 0x13,
-    0x9A, 0xC3, 0x01, 0xEF, 0x18, 0x18, 0x75, 0xB1, 0xC2, 0x25, 0x75, 0xCE, 0x6B, 0xA0, 0xEB, 0xDE,
-    0xBC, 0x55, 0xF9, 0x79, 0x35, 0x0E, 0x93, 0xB2, 0x17, 0x39, 0x65, 0xA7, 0xE3, 0x16, 0x9D, 0x9E,
-    0x9B, 0x77, 0x7A, 0xE0, 0x0C, 0x5C, 0xC3, 0x8E, 0x9F, 0xD5, 0xE1, 0x77, 0xDF, 0x28, 0x7D, 0x5A,
-    0x87, 0xC9, 0x4D, 0x33, 0xCD, 0xDA, 0x3E, 0xEF, 0x96, 0xD4, 0xDC, 0xC0, 0x6F, 0xC9, 0x90, 0x05,
-    0xA0, 0xC4, 0xB8, 0x69, 0x7D, 0x68, 0x80, 0x0C, 0x19, 0x37, 0x01, 0x44, 0x44, 0x60, 0x72, 0x9E,
-    0xCE, 0x65, 0x05, 0x21, 0x1E, 0xAA, 0x4F, 0xD3, 0xC7, 0x24, 0x77, 0x13, 0xB9, 0xDE, 0x4A, 0x91,
-    0xAB, 0x21, 0x72, 0x17, 0x20, 0x72, 0xDB, 0xB2, 0x17, 0x90, 0xDF, 0xC3, 0x3C, 0x07, 0x56, 0x30,
-    0xEA, 0x79, 0xD5, 0xB9, 0x83, 0xB3, 0x90, 0xAC, 0xDD, 0x11, 0x64, 0x65, 0xC9, 0x00, 0x5B, 0x23,
-    0x7C, 0x40, 0x7F, 0x17, 0xBB, 0xD6, 0xD1, 0x6B, 0x5D, 0xAF, 0x58, 0x77, 0x6E, 0xD5, 0xAE, 0x8D,
-    0x34, 0x6C, 0x1C, 0xB9, 0x15, 0x94, 0xE8, 0x28, 0xA8, 0x81, 0xE7, 0xC9, 0xF1, 0xC9, 0xFF, 0x53,
-    0xC0, 0xBA, 0x74, 0x3F, 0x6E, 0xAD, 0xDC, 0xBD, 0x66, 0xEE, 0x3D, 0xE0, 0xCC, 0x37, 0x39, 0x73,
-    0x61, 0x34, 0xB5, 0x6E, 0xB0, 0x0D, 0x2A, 0xCC, 0xF8, 0x79, 0x79, 0xF6, 0x28, 0x24, 0x11, 0xC8,
-    0x6D, 0x96, 0x4B, 0x1E, 0xC6, 0x95, 0x0D, 0xE3, 0xFB, 0x5C, 0x39, 0xCE, 0xB4, 0x79, 0x4A, 0xA1,
-    0xF6, 0x35, 0xDD, 0x08, 0x8F, 0xF4, 0xD6, 0x05, 0xF3, 0x80, 0x72, 0x35, 0x5E, 0xF0, 0x73, 0xE9,
-    0x7D, 0x98, 0xB4, 0x6B, 0x68, 0x7C, 0xE9, 0xCE, 0x26, 0x60, 0x1D, 0x34, 0x90, 0xE5, 0xFE, 0xD7,
-    0x4A, 0x42, 0x5A, 0x11, 0xD0, 0x8A, 0x3B, 0x52, 0xC2, 0xF8, 0xB9, 0xD8, 0x49, 0x58, 0xBF, 0x92,
-    0x81, 0x5C, 0xD9, 0xA2, 0xBC, 0x27, 0x67, 0x8C, 0x09, 0x06, 0x4D, 0x8E, 0x87, 0xF1, 0xD4, 0x16,
-    0x1F, 0xAC, 0xE0, 0xEA, 0x0F, 0xCE, 0xE6, 0xD6, 0x86, 0x50, 0xD3, 0x67, 0x87, 0xBE, 0x56, 0xAA,
-    0x75, 0x19, 0xA9, 0x7B, 0x55, 0xFB, 0x74, 0x2E, 0x2A, 0xA3, 0xF8, 0xA1, 0x46, 0xFE, 0x66, 0x92,
-    0x0C, 0x4C, 0xC0, 0xB3, 0x21, 0x7F, 0x86, 0xB7, 0x02, 0xD8, 0x82, 0xBC, 0xFB, 0x32, 0x54, 0x15,
-    0x66, 0xF2, 0x11, 0xC1, 0x96, 0xFE, 0x6B, 0x90, 0x7E, 0xE6, 0x5D, 0x4B, 0x98, 0x0D, 0x0C, 0x54,
-    0x02, 0x11, 0xB5, 0x59, 0x07, 0xE1, 0x77, 0xD6, 0x83, 0x5B, 0x02, 0x07, 0x7A, 0x36, 0x01, 0xF4,
-    0xDD, 0xB6, 0x56, 0x70, 0x60, 0x93, 0x81, 0x67, 0xE6, 0xDC, 0xFC, 0x13, 0x2A, 0x8A, 0x79, 0x0A,
-    0x16, 0x61, 0x25, 0x42, 0x17, 0xD0, 0x78, 0x7B, 0x57, 0x43, 0x4D, 0x0F, 0x3E, 0x4F, 0x90, 0x0D,
-    0xA1, 0x01, 0x46, 0xF0, 0x00, 0x76, 0x5A, 0xDA, 0x47, 0x9A, 0x89, 0x75, 0xD3, 0x07, 0x35, 0x99,
-    0xEA, 0xBD, 0xC6, 0xA4, 0xC2, 0xD3, 0x4F, 0x3F, 0xF0, 0xB3, 0x56, 0x5D, 0xF9, 0x70, 0x04, 0xC3,
-    0xA6, 0x5A, 0x6C, 0xF1, 0xC7, 0x50, 0x44, 0x1F, 0x81, 0x26, 0x53, 0xE8, 0xBB, 0xD2, 0x5F, 0x68,
-    0xEE, 0xA4, 0xD5, 0xA2, 0x46, 0xA0, 0x7A, 0x4B, 0x36, 0x4C, 0x6C, 0x06, 0x4D, 0xC3, 0x21, 0xCD,
-    0x76, 0x15, 0x73, 0x35, 0x01, 0x2F, 0xC7, 0x29, 0x18, 0x4D, 0x1D, 0x7E, 0x70, 0x97, 0x84, 0x8A,
-    0x74, 0x77, 0x59, 0x91, 0x76, 0x9B, 0x0C, 0xCC, 0xB3, 0x57, 0x91, 0x16, 0xD6, 0xDD, 0x79, 0x35,
-    0xF1, 0x9A, 0x32, 0x7C, 0xFF, 0x9C, 0x61, 0x15, 0xC4, 0x91, 0x30, 0xA6, 0x32, 0xD3, 0x30, 0x17,
-    0xCF, 0x7B, 0x19, 0x94, 0xE9, 0xDC, 0xC8, 0xCB, 0xD3, 0x58, 0xBB, 0x16, 0x12, 0x6D, 0xA3, 0x2D,
-    0x6E, 0xF8, 0x06, 0xC9, 0x79, 0x71, 0x23, 0x16, 0xE7, 0x29, 0xF1, 0x2E, 0x89, 0xFF, 0x53, 0xFE,
-    0xC7, 0x30, 0xB5, 0x29, 0x49, 0xEC, 0xAB, 0x4A, 0x44, 0xAA, 0x33, 0xE6, 0x55, 0x89, 0xA1, 0x99,
-    0x5F, 0x0C, 0xD3, 0x3D, 0x7D, 0xFF, 0x27, 0xD7, 0x97, 0x9E, 0x1C, 0x69, 0x38, 0x52, 0x2A, 0x5D,
-    0x10, 0xDC, 0x25, 0xC6, 0x94, 0x8B, 0xBA, 0xF3, 0xA2, 0xE6, 0x9C, 0xE2, 0xA0, 0xCA, 0x5A, 0xD9,
-    0x27, 0x92, 0x1B, 0x1B, 0x5C, 0x9B, 0x3C, 0xD6, 0x73, 0x6E, 0x1C, 0x4F, 0x19, 0x5A, 0x60, 0x89,
-    0x2D, 0x9A, 0x5E, 0xA6, 0x5D, 0xE9, 0xE5, 0x92, 0x61, 0x07, 0x39, 0x39, 0x16, 0x13, 0x0E, 0xE6,
-    0xE5, 0x2D, 0x38, 0x17, 0xCC, 0x27, 0x65, 0x5A, 0x74, 0x30, 0xE5, 0x12, 0xAD, 0x96, 0x68, 0xB1,
-    0x84, 0xE9, 0xCC, 0x3C, 0x3C, 0x3D, 0x39, 0x53, 0x72, 0xBB, 0xEB, 0x35, 0xE6, 0x1B, 0x49, 0x97,
-    0x11, 0xDD, 0x4C, 0x08, 0x6D, 0x78, 0x0D, 0x12, 0xE8, 0xB7, 0x9E, 0xE3, 0x2A, 0x5E, 0x2A, 0x8E,
-    0x8A, 0xFB, 0x63, 0x58, 0xE3, 0x8F, 0xCE, 0xA6, 0x5E, 0x0D, 0xF2, 0x16, 0xDE, 0x7E, 0x5E, 0x4A,
-    0x56, 0xF3, 0x52, 0x9B, 0xD1, 0xEE, 0x58, 0x9E, 0xCA, 0x1F, 0xCD, 0x17, 0x12, 0xAB, 0xD7, 0x69,
-    0xCE, 0x18, 0xBB, 0xD8, 0xF9, 0x1E, 0xC9, 0xCF, 0x73, 0xD2, 0x2F, 0xB0, 0x7E, 0x01, 0xE8, 0x9C,
-    0x5B, 0x7C, 0xEB, 0x78, 0xEB, 0x41, 0xFF, 0x16, 0x2C, 0xEF, 0x23, 0x01, 0xBE, 0x2F, 0x75, 0x13,
-    0x6B, 0xD2, 0x4A, 0x93, 0x8C, 0x95, 0x66, 0xD9, 0x98, 0xCC, 0x4B, 0x1C, 0x1D, 0xBD, 0x62, 0x88,
-    0x08, 0x08, 0x5A, 0x11, 0x5C, 0x43, 0x9D, 0xB5, 0x9D, 0xD0, 0x93, 0x6C, 0xB0, 0xE6, 0xD0, 0xBD,
-    0x9E, 0xF4, 0x25, 0xF6, 0x2E, 0x41, 0x0D, 0xF6, 0x82, 0x57, 0x52, 0xC4, 0x46, 0x11, 0xB7, 0xA3,
-    0x1F, 0xFB, 0xF0, 0xC8, 0xBB, 0x5B, 0x70, 0x11, 0x25, 0x2A, 0xBD, 0xEB, 0x44, 0x89, 0x59, 0x12,
-    0xE0, 0x34, 0x67, 0xBA, 0x67, 0xF8, 0xAB, 0x06, 0x2A, 0x06, 0x9D, 0xB6, 0xD4, 0x40, 0x71, 0xC0,
-    0x92, 0x23, 0x46, 0x84, 0x35, 0x73, 0xD9, 0xB5, 0x9F, 0xC6, 0xC1, 0x38, 0x94, 0xDE, 0x5A, 0x0C,
-    0xCB, 0x16, 0xC7, 0x43, 0x59, 0x3B, 0xB7, 0x5E, 0xC2, 0xEC, 0x47, 0x39, 0x33, 0xD2, 0x26, 0xAE,
-    0xE6, 0xDE, 0x3E, 0x7B, 0xF3, 0xA8, 0x16, 0x49, 0xFF, 0xE0, 0xD6, 0x5B, 0xD4, 0x32, 0x36, 0x9D,
-    0x4E, 0x71, 0xA9, 0xC4, 0xBF, 0x3A, 0x03, 0x76, 0x5D, 0x1B, 0xF7, 0x2E, 0x45, 0xBF, 0xCE, 0xAE,
-    0x89, 0x7E, 0x67, 0x34, 0x52, 0xFF, 0x1D, 0x0F, 0x7D, 0x00, 0x85, 0xE8, 0x5D, 0x3F, 0x06, 0x19,
-    0x00, 0x9F, 0x8A, 0x4F, 0xF9, 0x09, 0x34, 0x6B, 0x93, 0x06, 0xD7, 0x19, 0x1E, 0x36, 0x35, 0x9F,
-    0x1D, 0x92, 0xD8, 0x3D, 0xE6, 0x10, 0x62, 0x7A, 0xA0, 0xC3, 0x1E, 0x9D, 0xCF, 0xE1, 0x72, 0x08,
-    0x6A, 0x08, 0x7C, 0xA4, 0x49, 0x01, 0xCA, 0xA4, 0xA1, 0xF7, 0x5B, 0x0B, 0x03, 0x4C, 0x2D, 0x46,
-    0x46, 0x5A, 0x4D, 0xEE, 0xEB, 0xEE, 0x52, 0x5C, 0xC2, 0xEF, 0xEF, 0x6E, 0x6E, 0xA8, 0x98, 0x01,
-    0xB1, 0xD3, 0xB7, 0x4E, 0xBF, 0x09, 0xE0, 0xB8, 0x49, 0x1D, 0x72, 0x8B, 0x49, 0x15, 0x68, 0xB8,
-    0xC9, 0x71, 0xAA, 0x22, 0x76, 0x52, 0x71, 0xEE, 0xDE, 0x66, 0xA4, 0xE5, 0x37, 0xF3, 0x90, 0x73,
-    0x03, 0x9A, 0x0F, 0x72, 0xDE, 0xE4, 0xB0, 0x62, 0x7F, 0x0B, 0xF1, 0x38, 0xC1, 0x75, 0x6A, 0xA6,
-    0xE1, 0x4C, 0xA4, 0xC4, 0xB0, 0x98, 0xF5, 0x09, 0xEE, 0x79, 0xC4, 0xA1, 0x43, 0x2A, 0xF5, 0x34,
-    0x0D, 0x21, 0xB3, 0xFF, 0x45, 0x2B, 0xB6, 0xDB, 0xCE, 0x45, 0x9E, 0x20, 0xB8, 0x4C, 0xC5, 0xF5,
-    0x71, 0x17, 0xDC, 0x0F, 0x29, 0x69, 0x37, 0x4B, 0xE8, 0x9E, 0x52, 0x65, 0x3B, 0xBA, 0x50, 0x63,
-    0xEF, 0xB6, 0x64, 0xB4, 0x05, 0x09, 0xDB, 0x8A, 0xBD, 0x7C, 0x27, 0xF6, 0xB3, 0xB2, 0x07, 0x5F,
-    0xAF, 0xD3, 0x75, 0x8A, 0x35, 0xA8, 0x9F, 0x88, 0xBB, 0xAC, 0xAA, 0xD7, 0x81, 0x5C, 0x42, 0x83,
-    0x4A, 0xF0, 0x3D, 0x23, 0x9F, 0x83, 0xB3, 0xB4, 0x92, 0xA9, 0xDC, 0xF8, 0x20, 0x73, 0x3F, 0xBE,
-    0x98, 0x79, 0x17, 0x2F, 0x66, 0xC1, 0x1B, 0x17, 0xF3, 0x08, 0xB1, 0x5D, 0x8F, 0x01, 0x9C, 0x66,
-    0xB7, 0x0A, 0xF0, 0x1B, 0x20, 0xDC, 0x66, 0xCA, 0xEC, 0x36, 0x73, 0x47, 0xBF, 0x60, 0x5D, 0xF3,
-    0x22, 0x15, 0xC7, 0x1B, 0x59, 0xF8, 0xFD, 0x63, 0x5F, 0xCB, 0xAD, 0x6E, 0x9A, 0xDD, 0xC6, 0x52,
-    0xE5, 0xAF, 0x4A, 0xE0, 0x53, 0x94, 0x3D, 0xEF, 0xED, 0xA2, 0x8C, 0xC3, 0xD7, 0xF3, 0x2A, 0x8E,
-    0xBC, 0xAC, 0x1A, 0xC2, 0xCF, 0x1C, 0x8D, 0xC6, 0x7E, 0x3A, 0xAC, 0x4A, 0xD2, 0x9B, 0x9E, 0xA4,
-    0xEE, 0x87, 0x97, 0xC3, 0xE1, 0x83, 0x69, 0x8E, 0x19, 0x50, 0x30, 0xCB, 0x17, 0xC7, 0x73, 0x22,
-    0xCD, 0x40, 0xA4, 0x1F, 0x7E, 0x1D, 0x11, 0xE5, 0xF7, 0x20, 0x55, 0x88, 0x6F, 0xA4, 0xD7, 0xC3,
-    0x10, 0x0F, 0xD7, 0x82, 0x24, 0xAE, 0xD6, 0x21, 0x29, 0xDD, 0xC6, 0x34, 0x19, 0x30, 0xF9, 0xEC,
-    0xE7, 0x26, 0xE7, 0xCE, 0x98, 0x44, 0xB4, 0x80, 0xE2, 0x6A, 0x4D, 0x85, 0x2A, 0x31, 0xA2, 0x0E,
-    0xBC, 0x70, 0x7E, 0xCA, 0x52, 0x0C, 0xF3, 0x79, 0x15, 0xC3, 0x17, 0xC4, 0x47, 0x20, 0x12, 0x7C,
-    0x49, 0x26, 0x41, 0x7A, 0x24, 0xD3, 0x90, 0x89, 0xB9, 0x9A, 0x7E, 0x82, 0x3C, 0xBB, 0xB9, 0xA9,
-    0x09, 0xD8, 0x04, 0x0E, 0xCE, 0x05, 0x9B, 0x6F, 0xF4, 0x59, 0x1E, 0xF0, 0x3E, 0x62, 0xF9, 0x9A,
-    0x93, 0x5E, 0xB8, 0x4D, 0x4F, 0x57, 0x5D, 0xDD, 0x72, 0x0B, 0xEA, 0x0F, 0xE2, 0x19, 0x52, 0x62,
-    0xE0, 0x94, 0x40, 0xEC, 0x19, 0x74, 0x49, 0x19, 0x35, 0x4D, 0xE5, 0x14, 0x04, 0x93, 0xF3, 0x43,
-    0xE5, 0x6A, 0x76, 0x83, 0x8A, 0xB7, 0xAF, 0xD9, 0xB0, 0x1A, 0xE0, 0x3A, 0xBF, 0x2E, 0xC0, 0x7C,
-    0x9B, 0x4D, 0x66, 0x4B, 0x56, 0x20, 0xE4, 0x85, 0xF3, 0x0C, 0xE6, 0xA1, 0xDF, 0x41, 0x4A, 0xB0,
-    0x39, 0x69, 0x07, 0xBC, 0x83, 0xB4, 0xC2, 0x18, 0xC2, 0x01, 0x92, 0x61, 0x97, 0xB9, 0x98, 0x51,
-    0x8F, 0xB9, 0x98, 0x6A, 0xEC, 0x62, 0x56, 0xD9, 0xD8, 0xDC, 0xDC, 0x74, 0x0B, 0x10, 0xCD, 0xCB,
-    0xCF, 0x6F, 0x52, 0x6A, 0x69, 0x6B, 0x22, 0xB8, 0x83, 0x69, 0xF0, 0x97, 0xA4, 0x28, 0x88, 0xD9,
-    0xDC, 0xBE, 0x9D, 0x85, 0xDE, 0x7B, 0xEF, 0x15, 0x11, 0xCB, 0x04, 0x1D, 0xEC, 0x4B, 0xD9, 0xEB,
-    0x81, 0x2D, 0xE3, 0x61, 0x90, 0x54, 0x71, 0x15, 0x24, 0xC6, 0x01, 0xF2, 0x5E, 0x07, 0x87, 0x7D,
-    0x98, 0x2A, 0xC7, 0x1C, 0x69, 0xD8, 0xC0, 0x90, 0xCB, 0x8E, 0x67, 0xDD, 0x91, 0xD6, 0x2D, 0x21,
-    0xE3, 0x1E, 0x4F, 0x64, 0x02, 0xBA, 0x9C, 0x21, 0xBB, 0x46, 0x89, 0xD1, 0x95, 0x6D, 0xF2, 0x99,
-    0x4A, 0x61, 0x3B, 0x71, 0x8E, 0xEF, 0x82, 0xF8, 0x85, 0x9C, 0x3C, 0x6A, 0x12, 0x63, 0xB5, 0x43,
-    0x86, 0xAB, 0x31, 0xAD, 0x55, 0x40, 0x9F, 0x82, 0x93, 0x15, 0x82, 0xC3, 0x3D, 0xCC, 0x01, 0x46,
-    0xC0, 0x87, 0x22, 0x7F, 0xCD, 0x44, 0x78, 0x60, 0x2F, 0x7A, 0xA9, 0x78, 0xBF, 0xBB, 0x9C, 0x04,
-    0x61, 0x44, 0x00, 0xA9, 0x3A, 0x02, 0xEA, 0x35, 0xA7, 0x64, 0xB0, 0x61, 0x7C, 0xE4, 0x3E, 0xC4,
-    0x97, 0x1B, 0xED, 0x6C, 0x7E, 0x13, 0x6C, 0xD4, 0x91, 0x1D, 0x72, 0x42, 0xC5, 0xF0, 0x14, 0xA4,
-    0x8A, 0xB9, 0xC9, 0x43, 0x78, 0x8C, 0xCC, 0x52, 0xF6, 0x99, 0xA4, 0xEC, 0x31, 0xC1, 0xA7, 0xBE,
-    0x63, 0xDF, 0x25, 0x17, 0xBC, 0x58, 0x9C, 0x90, 0xF0, 0xF6, 0x6D, 0x86, 0xAF, 0xDC, 0xDD, 0x20,
-    0x6F, 0xF5, 0xBE, 0x49, 0x6C, 0xB7, 0xD9, 0xED, 0x55, 0x21, 0xE6, 0x01, 0xA9, 0x9E, 0x01, 0x2B,
-    0x21, 0xF4, 0x2E, 0x3B, 0xA1, 0x53, 0x74, 0x22, 0xB7, 0x58, 0x87, 0xD9, 0x63, 0x6C, 0x15, 0x43,
-    0x18, 0x71, 0xA5, 0x23, 0x92, 0x78, 0x08, 0xFE, 0xE8, 0x87, 0x41, 0xD6, 0xBD, 0x3E, 0x51, 0xD3,
-    0x3C, 0x8F, 0xAD, 0xF6, 0x27, 0x79, 0x6D, 0x25, 0x21, 0x15, 0x55, 0x8C, 0xB2, 0x0B, 0x85, 0xE3,
-    0xB1, 0xAA, 0x05, 0x02, 0x77, 0x8D, 0xAB, 0x42, 0x8F, 0xCA, 0xD4, 0x1D, 0x99, 0x38, 0x35, 0x43,
-    0x4C, 0x07, 0x2C, 0xA6, 0x23, 0xD6, 0x23, 0x7D, 0xFA, 0x34, 0x54, 0x5D, 0x7A, 0x2E, 0x61, 0x06,
-    0x6C, 0xFC, 0x19, 0xDD, 0xCC, 0xC9, 0x5C, 0xF1, 0xD3, 0x37, 0xAD, 0x82, 0x2B, 0xE3, 0x28, 0xE9,
-    0xF4, 0x25, 0x8A, 0x25, 0xDA, 0x6E, 0x9A, 0x09, 0xD8, 0x55, 0x3A, 0x95, 0xC4, 0x23, 0x19, 0xC1,
-    0xF9, 0x86, 0xE7, 0x1F, 0xCC, 0x4C, 0x46, 0xD6, 0x99, 0x8E, 0xC4, 0x9F, 0x6E, 0x69, 0xF2, 0xA2,
-    0xA3, 0x66, 0xCD, 0xB4, 0x68, 0x94, 0x9A, 0x3A, 0xA5, 0x31, 0x5D, 0xA7, 0xAD, 0xA7, 0xCD, 0x8F,
-    0x8C, 0x21, 0x8D, 0x18, 0x1B, 0xEE, 0xEC, 0x8D, 0x0F, 0x37, 0x40, 0xAA, 0x1D, 0xD9, 0xD6, 0x20,
-    0x88, 0xE9, 0x8E, 0x21, 0xB3, 0xEA, 0x8C, 0x25, 0x41, 0x59, 0xC6, 0x93, 0x71, 0xCF, 0x14, 0x83,
-    0xD6, 0x81, 0x74, 0xA7, 0x34, 0x6A, 0x2F, 0xB2, 0x49, 0xA3, 0x88, 0x41, 0xCB, 0x2B, 0xA9, 0xB6,
-    0x2A, 0x39, 0x79, 0x2E, 0x8F, 0x13, 0x2E, 0x4D, 0xCE, 0x0F, 0xCD, 0xFA, 0x6B, 0x58, 0x27, 0xF0,
-    0x13, 0xAB, 0xCA, 0x1F, 0x1E, 0xDE, 0xC5, 0x1E, 0x8A, 0xDD, 0x46, 0x31, 0x3B, 0x49, 0x09, 0x2B,
-    0x4D, 0xEF, 0x05, 0xF7, 0x13, 0xFE, 0xC9, 0x06, 0xB7, 0x94, 0xA9, 0x4F, 0xEE, 0xAA, 0x9F, 0x32,
-    0xBB, 0x82, 0x7F, 0x33, 0x53, 0xF0, 0xF5, 0xB2, 0xAE, 0x86, 0x24, 0xE0, 0x25, 0xDD, 0x61, 0xE8,
-    0x02, 0xDD, 0x64, 0x37, 0xD7, 0xC6, 0x96, 0x13, 0xEE, 0x7B, 0x85, 0x6E, 0xB5, 0xF3, 0xF3, 0x4C,
-    0x77, 0xDB, 0xB9, 0x96, 0x9A, 0x0D, 0xBF, 0x2E, 0x66, 0xCF, 0x29, 0x9D, 0xDC, 0xF6, 0xB6, 0x2D,
-    0xC9, 0x32, 0x98, 0x63, 0x0D, 0x56, 0x5B, 0xAA, 0x0B, 0x53, 0x0B, 0xB1, 0x7D, 0xBB, 0x36, 0x4C,
-    0x42, 0xF0, 0xC8, 0x28, 0x80, 0x0E, 0xCC, 0x42, 0xE0, 0xA2, 0xA4, 0x4F, 0xD8, 0xFA, 0x26, 0x13,
-    0x1E, 0xF3, 0x1F, 0x96, 0x76, 0x60, 0xCA, 0x98, 0x2F, 0xED, 0x10, 0xAE, 0x0A, 0xE0, 0x7D, 0xCC,
-    0xC2, 0x40, 0x4C, 0xA8, 0xF0, 0x36, 0x81, 0x02, 0x43, 0x11, 0x26, 0x26, 0x53, 0xE9, 0x83, 0xCC,
-    0xE6, 0x10, 0x55, 0xCB, 0xF0, 0x58, 0x70, 0x0C, 0x34, 0x16, 0x18, 0x03, 0x8B, 0xA8, 0xD3, 0x3F,
-    0xD0, 0x0A, 0xD3, 0x29, 0xD1, 0x3E, 0x2C, 0xD9, 0x3D, 0x71, 0x81, 0xC4, 0xEC, 0x92, 0x92, 0x74,
-    0x62, 0xF1, 0x1C, 0x63, 0xB7, 0xB4, 0x2F, 0xC6, 0x0E, 0xE8, 0xC0, 0xE8, 0x50, 0x73, 0x11, 0xA6,
-    0x76, 0xC4, 0x1C, 0x32, 0xC4, 0xA3, 0xCB, 0x88, 0x20, 0xFC, 0xE1, 0x77, 0x4A, 0xD1, 0xB4, 0x87,
-    0x96, 0xD1, 0xB5, 0x04, 0x67, 0x4A, 0xD3, 0x07, 0x13, 0xDD, 0x4A, 0x07, 0xAB, 0x04, 0xD7, 0x2F,
-    0x40, 0xBD, 0x31, 0xC9, 0xAB, 0x45, 0x9A, 0x64, 0x64, 0x2E, 0x96, 0x9D, 0x35, 0xE3, 0xCA, 0x54,
-    0xF4, 0xF0, 0xF3, 0xAC, 0xA2, 0x6B, 0x9C, 0x6C, 0x6A, 0x50, 0x26, 0xCE, 0xF8, 0x81, 0xC1, 0xE2,
-    0x27, 0xC4, 0x48, 0xAB, 0x52, 0x4F, 0x0D, 0xE7, 0x3A, 0x44, 0xE4, 0x79, 0x1D, 0xDF, 0x9C, 0x73,
-    0x4B, 0xB0, 0x7B, 0x90, 0xA1, 0xE9, 0x2C, 0x00, 0x3C, 0xF5, 0xA7, 0x5C, 0xAF, 0x60, 0x25, 0xDF,
-    0xD1, 0x22, 0x1D, 0x74, 0x18, 0x41, 0x2B, 0xD5, 0x09, 0x2D, 0xBB, 0x4A, 0xAF, 0xBE, 0x8E, 0x3D,
-    0x6D, 0x0F, 0xEC, 0x69, 0x49, 0x8B, 0x25, 0x24, 0x16, 0x94, 0x22, 0xD0, 0x83, 0x3E, 0x3C, 0x77,
-    0xA9, 0xC7, 0xE4, 0x74, 0x32, 0x01, 0xB1, 0xC3, 0xDB, 0xB4, 0x94, 0x6E, 0xF3, 0xC6, 0x52, 0xED,
-    0x6E, 0x9B, 0xFF, 0xBD, 0x85, 0x55, 0xDD, 0xB7, 0xBB, 0x2D, 0xD9, 0x3D, 0x0E, 0x2A, 0x01, 0x9F,
-    0x5A, 0x28, 0x0B, 0x44, 0xE6, 0xCD, 0x3B, 0x4D, 0x1A, 0x5C, 0x49, 0xFE, 0x2E, 0x8F, 0x58, 0x43,
-    0xEF, 0xB3, 0x2A, 0xA1, 0xCD, 0x14, 0x63, 0x02, 0x30, 0x92, 0x37, 0xDD, 0xA2, 0x62, 0x59, 0xB1,
-    0xA6, 0xE1, 0x19, 0x31, 0x34, 0x80, 0x3D, 0xED, 0xC2, 0xC7, 0x98, 0xC1, 0x98, 0xEF, 0x4E, 0xCA,
-    0x3D, 0xD5, 0x42, 0x2D, 0x9E, 0x8B, 0x64, 0x6F, 0x67, 0x7B, 0xDE, 0xFE, 0xED, 0xFB, 0xBF, 0x72,
-    0xE8, 0xF4, 0x69, 0xBC, 0x73, 0xEC, 0xEB, 0xD8, 0x9B, 0xA7, 0x9E, 0x7A, 0xAC, 0x3E, 0x71, 0x9B,
-    0xC1, 0x67, 0xF1, 0x69, 0x26, 0x9F, 0x63, 0x0D, 0xC7, 0xCF, 0x6D, 0x73, 0x90, 0x98, 0x92, 0x70,
-    0x4F, 0xF6, 0x1A, 0x81, 0x9E, 0x2D, 0x13, 0xEB, 0x5E, 0xD0, 0x92, 0xD2, 0x99, 0x6D, 0x6C, 0x81,
-    0x67, 0xB9, 0x17, 0x25, 0xB2, 0xD7, 0x67, 0x4F, 0x51, 0x38, 0x2F, 0x7F, 0x03, 0xEF, 0xF7, 0xF7,
-    0x36, 0xEE, 0x99, 0x7C, 0x0B, 0xFE, 0x1C, 0xFC, 0x12, 0x8C, 0xA5, 0x9F, 0xC5, 0x7B, 0x3A, 0x02,
-    0xCD, 0xF6, 0xC2, 0x96, 0x9E, 0xC2, 0xFB, 0x53, 0x68, 0xC4, 0x2E, 0xCD, 0x3A, 0x4B, 0x24, 0x0D,
-    0xD5, 0x51, 0xF6, 0x25, 0x7C, 0xB4, 0xCD, 0x9E, 0x16, 0xE6, 0x10, 0xC0, 0x21, 0xDE, 0x75, 0x18,
-    0x91, 0xD7, 0x72, 0x5D, 0xFE, 0xD0, 0x7C, 0x1F, 0xF3, 0x57, 0xCF, 0xE4, 0xB3, 0xD3, 0xC9, 0x37,
-    0xEC, 0xAE, 0xA6, 0x93, 0x7F, 0xCA, 0xDE, 0x92, 0xF4, 0xE9, 0xF1, 0xB9, 0x2F, 0x7D, 0xEA, 0x99,
-    0xDE, 0x73, 0xCF, 0xF3, 0xFD, 0xE8, 0xB2, 0xF4, 0x9B, 0x53, 0xE7, 0x88, 0xBB, 0x7C, 0xC6, 0x3E,
-    0x37, 0xB1, 0xFB, 0x9E, 0x9F, 0xB3, 0xB1, 0xEF, 0xD3, 0xAD, 0x84, 0x1F, 0xB0, 0x3E, 0xDB, 0xA0,
-    0x10, 0xE7, 0x47, 0x78, 0x64, 0xE7, 0x5B, 0x88, 0x0A, 0x36, 0xDA, 0x3B, 0xEE, 0xF9, 0x13, 0x29,
-    0x8F, 0x35, 0xC9, 0x1F, 0x31, 0x1A, 0x71, 0xFF, 0x29, 0xFB, 0x1C, 0x11, 0x74, 0x25, 0xBD, 0xEF,
-    0x83, 0x27, 0xAD, 0xE8, 0xB3, 0x09, 0xE4, 0x6F, 0x20, 0x22, 0x29, 0xF4, 0xCB, 0xA9, 0x2F, 0x2D,
-    0xDF, 0xD1, 0xB5, 0xE9, 0x9D, 0x36, 0xB8, 0xC8, 0xBE, 0xB5, 0x77, 0x06, 0xDB, 0xCE, 0x62, 0x5B,
-    0xF7, 0x9E, 0x97, 0x45, 0xE6, 0xEE, 0x5B, 0x26, 0x01, 0xB1, 0x25, 0xDF, 0xA4, 0x4C, 0xF1, 0xAD,
-    0x89, 0x6E, 0x1D, 0x8B, 0x51, 0x24, 0xE5, 0xBD, 0xA1, 0x63, 0x29, 0x1C, 0x5C, 0xC3, 0xC4, 0x2A,
-    0xB4, 0xB9, 0x73, 0x4A, 0x85, 0xF1, 0x9E, 0x4F, 0xB8, 0xB8, 0xCE, 0x19, 0x74, 0xE8, 0xF4, 0xAA,
-    0x67, 0xE1, 0xB0, 0xB3, 0xF2, 0x79, 0x03, 0xD2, 0xEF, 0x2C, 0x72, 0x8A, 0xF2, 0x6D, 0xF3, 0xCF,
-    0x02, 0x97, 0x90, 0x9F, 0x04, 0x10, 0x20, 0x44, 0x6C, 0x24, 0xE6, 0x69, 0x8B, 0x36, 0x26, 0x08,
-    0x19, 0x04, 0x20, 0x12, 0xC8, 0xA5, 0x61, 0xFB, 0x15, 0x07, 0xFF, 0xA7, 0x4C, 0x50, 0x74, 0xA8,
-    0x65, 0xA9, 0x7F, 0x28, 0xB7, 0x0E, 0x54, 0x02, 0x4C, 0xD6, 0x16, 0xCC, 0x28, 0xBC, 0xC9, 0x75,
-    0xD6, 0x37, 0x20, 0x19, 0xB0, 0x54, 0xA5, 0xC3, 0x0C, 0x0A, 0xE6, 0xD9, 0x4E, 0x31, 0xC5, 0x05,
-    0x3A, 0x7C, 0x70, 0x6A, 0xA6, 0xF3, 0x7A, 0x6F, 0xD9, 0xEA, 0x7E, 0xD5, 0x76, 0x87, 0xB0, 0x6E,
-    0x09, 0x63, 0xCB, 0x76, 0x9D, 0x09, 0xDD, 0xD0, 0xCB, 0xCB, 0x39, 0x82, 0x74, 0x11, 0x3E, 0x46,
-    0x9A, 0x7C, 0x6F, 0xF3, 0x15, 0xA6, 0x61, 0xD4, 0x84, 0xDA, 0x63, 0x0D, 0xB5, 0x27, 0x08, 0xB5,
-    0x69, 0x44, 0x9E, 0xB3, 0x48, 0x6F, 0x59, 0x0F, 0xF6, 0x94, 0x76, 0xB6, 0x16, 0x72, 0xE4, 0x56,
-    0x3A, 0x68, 0xB2, 0xDF, 0x7D, 0xBF, 0x4D, 0x03, 0xFD, 0x17, 0xD6, 0x24, 0xC3, 0x33, 0x75, 0x24,
-    0xE3, 0x0E, 0xC2, 0x0D, 0xE9, 0xC5, 0x7C, 0x8D, 0x87, 0x07, 0x2B, 0x04, 0x90, 0xCD, 0x4D, 0xED,
-    0x84, 0xCD, 0x4D, 0x9D, 0x3F, 0xE9, 0x5E, 0x5D, 0xD1, 0x09, 0x3B, 0x68, 0x30, 0x61, 0x39, 0x74,
-    0xA0, 0x30, 0x76, 0xB6, 0xDA, 0x64, 0x68, 0x68, 0x32, 0x7C, 0xCD, 0x65, 0xEA, 0x3D, 0xCC, 0x11,
-    0xC1, 0x9A, 0xB2, 0x37, 0xD4, 0xB3, 0x1D, 0xA2, 0x3E, 0xC2, 0xAE, 0x4B, 0x69, 0xF8, 0x62, 0xA3,
-    0x15, 0x53, 0x3A, 0xB1, 0x1D, 0xAD, 0xB3, 0x7F, 0x6E, 0xB5, 0x77, 0xF8, 0x34, 0x38, 0xE0, 0x1F,
-    0xDA, 0xFA, 0x88, 0xB0, 0x3E, 0x42, 0xEA, 0x96, 0xEE, 0x9E, 0xFA, 0xC8, 0x4B, 0x79, 0x70, 0xF1,
-    0xDD, 0x2C, 0xFC, 0x59, 0xA3, 0xF5, 0x91, 0x30, 0x9A, 0xDA, 0xB4, 0xC4, 0xE1, 0x3D, 0x0A, 0x67,
-    0xCB, 0xA6, 0x4F, 0x16, 0x29, 0x08, 0x5C, 0x70, 0x80, 0x01, 0x67, 0x72, 0xD7, 0xBE, 0xBE, 0x64,
-    0x75, 0xFF, 0xCB, 0x9D, 0x5E, 0xEC, 0x53, 0x8B, 0x4C, 0xDA, 0xE6, 0xC8, 0x6D, 0x2A, 0xEF, 0xFD,
-    0x0D, 0x93, 0x71, 0xF3, 0x53, 0x26, 0x58, 0xEF, 0xEC, 0x3D, 0x8E, 0xD5, 0x57, 0x2A, 0xB4, 0x3B,
-    0x6F, 0xB4, 0xBA, 0xC3, 0xA5, 0xAB, 0xAD, 0x97, 0xD9, 0x7D, 0x3B, 0x0D, 0x65, 0xF3, 0xA8, 0xDB,
-    0xD4, 0xDE, 0x95, 0x8D, 0x79, 0x8E, 0xEF, 0xF8, 0xFF, 0x65, 0x5A, 0x6E, 0xC5, 0x8A, 0x06, 0xDF,
-    0x74, 0x15, 0xBE, 0x6C, 0xC8, 0x0D, 0x67, 0x4C, 0xBF, 0x95, 0x08, 0x14, 0xA7, 0x78, 0xAE, 0xAF,
-    0x85, 0x5D, 0xDA, 0x58, 0x5A, 0xDB, 0xA1, 0x76, 0x89, 0xD1, 0x0F, 0x68, 0x3B, 0x7C, 0x4E, 0x98,
-    0x04, 0x91, 0x0F, 0xF3, 0x03, 0x25, 0x37, 0x68, 0x2B, 0xAF, 0x7B, 0xA1, 0x21, 0xFE, 0xBF, 0x64,
-    0x11, 0x34, 0x7C, 0x19, 0x26, 0x1D, 0xE1, 0x28, 0xC2, 0x52, 0x88, 0x0F, 0x5F, 0x44, 0x1A, 0xF8,
-    0xC2, 0xF4, 0x07, 0x59, 0x84, 0xCD, 0xAB, 0xAD, 0x2A, 0x89, 0xED, 0xBA, 0x35, 0x7D, 0x5D, 0xFD,
-    0x74, 0xC4, 0xB8, 0x29, 0xDF, 0xE9, 0xD2, 0x10, 0xD3, 0x08, 0x4B, 0xF5, 0x6B, 0x4A, 0xD1, 0xF9,
-    0x7F, 0xCD, 0x94, 0x8A, 0x64, 0xB9, 0xC9, 0x75, 0x6A, 0x84, 0xDF, 0x5C, 0x62, 0x70, 0x76, 0x91,
-    0x9D, 0x32, 0xD1, 0xCB, 0x0C, 0x62, 0x4F, 0x04, 0x2F, 0x94, 0x6C, 0x89, 0x49, 0x10, 0xBC, 0x16,
-    0x8A, 0x04, 0xDC, 0xA6, 0x41, 0x3E, 0x60, 0x3D, 0x2B, 0x6B, 0xF3, 0x0E, 0xB6, 0x2B, 0xD8, 0x04,
-    0x41, 0xB6, 0xDB, 0xF0, 0x90, 0xB8, 0x6F, 0xC2, 0x1F, 0x7C, 0xCB, 0x9B, 0xC1, 0x15, 0xA9, 0x9D,
-    0xAE, 0x53, 0x9C, 0x04, 0x6D, 0x5E, 0x67, 0x2F, 0x5D, 0x70, 0xF1, 0x1D, 0x1A, 0xB8, 0x8B, 0xAC,
-    0x01, 0xFB, 0xD7, 0xB4, 0x9D, 0xCE, 0x34, 0xC8, 0xBE, 0xF2, 0x0A, 0xC7, 0x90, 0x14, 0xED, 0xEB,
-    0x38, 0x3E, 0x0C, 0x2A, 0x7F, 0xB1, 0x5A, 0x73, 0x6F, 0xA5, 0xDB, 0xD9, 0x3A, 0xDB, 0xDB, 0xE6,
-    0xF3, 0x87, 0xB2, 0x18, 0xB5, 0xA9, 0xB6, 0x35, 0x18, 0x8F, 0xAB, 0xC9, 0xF1, 0xDB, 0xF6, 0x0C,
-    0x85, 0xE5, 0xFD, 0xA0, 0xD4, 0x64, 0xF0, 0x03, 0x54, 0xA4, 0x1D, 0x4C, 0x52, 0x58, 0xE5, 0xD1,
-    0xCD, 0x54, 0xEF, 0x97, 0xEC, 0x69, 0x62, 0xBB, 0x58, 0x90, 0xD1, 0xE1, 0xD1, 0x64, 0x28, 0x68,
-    0x11, 0x7C, 0x17, 0x5C, 0xF7, 0xF7, 0x80, 0x62, 0x6C, 0xAE, 0x88, 0xDD, 0x6E, 0x60, 0xBD, 0x1E,
-    0x1C, 0x00, 0xB6, 0x87, 0xC6, 0x2E, 0x13, 0xA2, 0x35, 0x76, 0x7C, 0x3B, 0xAB, 0x34, 0x95, 0x18,
-    0xEC, 0x63, 0x65, 0xE0, 0xBE, 0x71, 0x00, 0x62, 0x08, 0xAF, 0x27, 0x3F, 0x21, 0xDE, 0xDB, 0x95,
-    0xF8, 0xEF, 0xE6, 0x98, 0x33, 0x91, 0xE0, 0x3C, 0xEE, 0x02, 0x97, 0x85, 0x8C, 0x0C, 0xC8, 0xCE,
-    0xD8, 0x24, 0x06, 0x3B, 0xB1, 0xC3, 0x30, 0xB0, 0x59, 0x21, 0x98, 0x9F, 0xDF, 0x0B, 0xE7, 0x7B,
-    0x67, 0x11, 0x48, 0x4D, 0x31, 0x9F, 0x85, 0x13, 0x24, 0x0C, 0x61, 0x97, 0xC2, 0x0B, 0x16, 0x4E,
-    0x30, 0x55, 0x0F, 0x20, 0xC5, 0x03, 0xCC, 0xF9, 0xE9, 0x16, 0x4E, 0x36, 0x15, 0x0C, 0x18, 0x0F,
-    0x24, 0xEE, 0xCF, 0xC2, 0xD4, 0xFB, 0xB0, 0x2F, 0xDE, 0x0F, 0x01, 0xD3, 0xA5, 0x15, 0x30, 0xE1,
-    0xB6, 0x0E, 0x9E, 0xEF, 0xFD, 0x15, 0x9E, 0xFF, 0x87, 0xD2, 0xE4, 0x5D, 0xB9, 0x7E, 0xE1, 0x96,
-    0x47, 0x6E, 0x22, 0x02, 0x9E, 0x75, 0xE5, 0x77, 0x7F, 0xB2, 0xA0, 0x53, 0x78, 0xDC, 0xD2, 0x69,
-    0xB4, 0x8F, 0x4E, 0xD8, 0x5E, 0x43, 0xA7, 0xCA, 0xAE, 0xDF, 0x9F, 0xEB, 0x98, 0x00, 0xFB, 0xC9,
-    0x7A, 0x90, 0x49, 0x6E, 0xDF, 0x49, 0x27, 0xFF, 0x7B, 0x4B, 0x30, 0xF5, 0x5B, 0x3A, 0x65, 0xA0,
-    0x53, 0xA1, 0x29, 0x60, 0xA6, 0xF1, 0xB6, 0x6B, 0x10, 0x0A, 0xC1, 0x11, 0x6E, 0x61, 0x31, 0x8E,
-    0x4D, 0x31, 0x10, 0xBE, 0x2E, 0x27, 0xA4, 0x57, 0xFB, 0x31, 0x3D, 0xA2, 0x0F, 0xC9, 0x71, 0xD7,
-    0xD5, 0xFE, 0x8A, 0x49, 0x9D, 0x81, 0xA7, 0xC9, 0xD2, 0x2F, 0xE5, 0xB6, 0xA1, 0x3D, 0x22, 0x76,
-    0xB6, 0x47, 0xB4, 0xAB, 0x3D, 0xA2, 0xA9, 0x3C, 0xBB, 0x29, 0xCF, 0x0C, 0x66, 0x4E, 0xF5, 0xEC,
-    0x09, 0xF8, 0x3D, 0x31, 0x3C, 0xE6, 0x21, 0x3E, 0xDE, 0x82, 0x3E, 0xFB, 0x47, 0xEB, 0xD1, 0xFD,
-    0x26, 0x17, 0xE7, 0x57, 0xA5, 0x7A, 0xCE, 0x6E, 0xDE, 0xD3, 0x84, 0x24, 0x4C, 0x41, 0x76, 0x67,
-    0x47, 0x19, 0x3F, 0x63, 0xFF, 0x5B, 0x66, 0xBC, 0xE3, 0xA1, 0x04, 0xDF, 0xDF, 0x1C, 0x31, 0x57,
-    0x54, 0x49, 0x78, 0xFA, 0xF4, 0xBE, 0xE6, 0xCB, 0xDC, 0x34, 0x5F, 0xEE, 0xE9, 0x57, 0xAB, 0xD9,
-    0xAA, 0x56, 0xCF, 0x23, 0xAD, 0xB2, 0x1D, 0x98, 0xA0, 0x55, 0x4B, 0xB8, 0xC1, 0xA2, 0xCB, 0xDC,
-    0x76, 0x14, 0x4C, 0x4C, 0xF9, 0x29, 0x80, 0x81, 0xFC, 0x86, 0xBC, 0xF4, 0xD4, 0x42, 0xC8, 0x53,
-    0x0B, 0xDA, 0x04, 0x0B, 0xDD, 0x87, 0x48, 0xA3, 0xBB, 0xDC, 0x6D, 0x68, 0x93, 0x35, 0x87, 0xB4,
-    0xCF, 0xB2, 0xE1, 0xCC, 0x51, 0x63, 0x10, 0x30, 0x18, 0x18, 0x14, 0x4C, 0x5B, 0x26, 0xEF, 0xDC,
-    0x62, 0xBE, 0x75, 0xB3, 0x16, 0x83, 0x86, 0xC1, 0xC3, 0x20, 0x62, 0x30, 0x31, 0x5D, 0x77, 0xB6,
-    0x91, 0xD4, 0x34, 0x69, 0x2A, 0x36, 0xA6, 0xFD, 0xCE, 0xB4, 0xDE, 0x11, 0xEE, 0x4D, 0x02, 0xDE,
-    0xB0, 0x6B, 0xE2, 0xC6, 0x86, 0xF6, 0x9D, 0x11, 0x76, 0x21, 0xF0, 0x46, 0xFB, 0x84, 0x3A, 0xF0,
-    0x19, 0x22, 0xC0, 0x88, 0x68, 0xDE, 0xC7, 0xDB, 0x36, 0xE5, 0x0A, 0x53, 0x63, 0xB4, 0xCB, 0x33,
-    0x31, 0x34, 0x34, 0xF4, 0x33, 0x04, 0x34, 0x14, 0x34, 0xDD, 0xB1, 0xA6, 0x3D, 0x96, 0xD3, 0xDC,
-    0xBE, 0xCC, 0x3D, 0xC2, 0x03, 0xDC, 0xA4, 0x6E, 0xCA, 0x5D, 0xF2, 0x75, 0x0B, 0x59, 0x4E, 0xF4,
-    0x33, 0x86, 0x45, 0x2C, 0xF3, 0xB0, 0x03, 0xD5, 0x29, 0x19, 0x2D, 0xB2, 0x8C, 0x1A, 0xAA, 0xCA,
-    0x6A, 0x03, 0x5C, 0x2D, 0x2B, 0x98, 0x70, 0x53, 0x58, 0xE8, 0xF6, 0xAF, 0x6B, 0x3D, 0x69, 0x91,
-    0xBB, 0xDE, 0xDC, 0xDC, 0x60, 0x26, 0xAA, 0x10, 0xEF, 0xCA, 0xD7, 0xE6, 0x1D, 0xC6, 0x1C, 0xD8,
-    0x61, 0x1C, 0x24, 0xB4, 0x1E, 0x09, 0xED, 0x07, 0xD8, 0x90, 0xD9, 0x2B, 0xDA, 0x10, 0xB5, 0x22,
-    0xEB, 0xEC, 0xE2, 0xEC, 0x71, 0x88, 0x4D, 0xB1, 0x65, 0xBE, 0xE7, 0x8C, 0x3F, 0x34, 0xAD, 0x15,
-    0xD1, 0x34, 0xEC, 0x39, 0x55, 0xD5, 0xE6, 0x9A, 0x52, 0xD1, 0x6C, 0x81, 0x57, 0x3A, 0x1B, 0x80,
-    0x10, 0x82, 0x13, 0x26, 0x83, 0x93, 0x6C, 0x8C, 0x62, 0xF0, 0x5B, 0x85, 0x4C, 0x52, 0xDB, 0x54,
-    0x69, 0x0C, 0xC4, 0xA1, 0xC5, 0x10, 0x05, 0x42, 0x9C, 0x4E, 0x20, 0xDC, 0x2F, 0xA6, 0xD2, 0x75,
-    0x7E, 0xCD, 0x5C, 0x53, 0x33, 0xCF, 0x35, 0x99, 0x1A, 0xD9, 0x74, 0x1E, 0x43, 0x6A, 0x67, 0x48,
-    0x98, 0xB3, 0x72, 0xF8, 0xA7, 0x78, 0xAE, 0x91, 0x61, 0xF0, 0x61, 0x3A, 0x82, 0x4D, 0x18, 0x45,
-    0x7E, 0x56, 0x41, 0x87, 0x55, 0x1D, 0x78, 0x91, 0xDD, 0xAE, 0x9C, 0x80, 0x2E, 0xE8, 0x9E, 0x2D,
-    0xED, 0x39, 0x81, 0x57, 0x1F, 0x4F, 0x28, 0x35, 0x9B, 0x61, 0xCF, 0x76, 0x8D, 0x76, 0x0D, 0x6C,
-    0x84, 0x1B, 0x9A, 0xBC, 0x38, 0x38, 0xC9, 0x86, 0x52, 0xFE, 0xBD, 0x43, 0xA9, 0x33, 0x29, 0x03,
-    0xFC, 0xC2, 0x5A, 0x09, 0x8A, 0xA9, 0x9A, 0x00, 0x76, 0xE9, 0x6A, 0x67, 0xF2, 0xC3, 0x76, 0xE9,
-    0x56, 0xB6, 0xE4, 0x54, 0xCA, 0xA2, 0x6C, 0xC2, 0xB6, 0x3F, 0xF2, 0x47, 0xF2, 0x03, 0xE7, 0x2D,
-    0x71, 0xDF, 0x6D, 0x82, 0x86, 0x0D, 0x29, 0x7F, 0x01, 0x25, 0x57, 0x69, 0x43, 0x4A, 0x11, 0xE4,
-    0xEC, 0xC6, 0xD1, 0xB6, 0x94, 0xB4, 0x6D, 0x28, 0x5C, 0x6E, 0x43, 0x58, 0x6E, 0x48, 0x31, 0xBF,
-    0xFD, 0x94, 0x51, 0x6D, 0xF7, 0x0E, 0xB3, 0x1E, 0xCE, 0x8B, 0x72, 0x34, 0x3A, 0x23, 0xAD, 0x88,
-    0x44, 0xB6, 0x89, 0x6D, 0xA4, 0x15, 0x10, 0x16, 0x2A, 0x42, 0x7A, 0xBB, 0xC7, 0x44, 0x95, 0x2A,
-    0x73, 0xB5, 0x5E, 0xB9, 0x0F, 0x9B, 0x74, 0xAF, 0x47, 0xB6, 0x21, 0x07, 0x10, 0x89, 0x8F, 0xE0,
-    0x3D, 0x23, 0x72, 0x46, 0xDC, 0x8C, 0xA8, 0x39, 0x4C, 0x63, 0x78, 0xA1, 0x3D, 0x36, 0x8E, 0xAC,
-    0x95, 0x3C, 0xF9, 0x16, 0xB2, 0xAA, 0xB3, 0xF0, 0xC9, 0xE6, 0xA5, 0x57, 0x6A, 0x81, 0xA8, 0x6D,
-    0xB0, 0x4B, 0x3A, 0x0A, 0x11, 0x7B, 0x01, 0xBC, 0x77, 0x20, 0x11, 0x08, 0xE7, 0x11, 0xF1, 0x6B,
-    0x50, 0xAA, 0x39, 0x24, 0xCD, 0x1B, 0x1B, 0xA7, 0xD1, 0xD9, 0x77, 0x1E, 0x85, 0xE9, 0x2B, 0xCD,
-    0x5D, 0xA5, 0xDA, 0x2D, 0xA4, 0x9D, 0x4B, 0xCC, 0xA4, 0x79, 0x59, 0x0D, 0x43, 0x01, 0x37, 0xEB,
-    0xC7, 0xB9, 0xB8, 0x98, 0xCF, 0xB9, 0x2E, 0x7B, 0xE6, 0x1B, 0x60, 0xAE, 0x2F, 0xDE, 0x4A, 0x17,
-    0xE7, 0x6D, 0xEC, 0x7C, 0x77, 0x69, 0x44, 0x2E, 0xDB, 0x46, 0xE4, 0xEB, 0x7B, 0x1A, 0x91, 0xBD,
-    0x45, 0x23, 0xF2, 0xFA, 0x5D, 0x1B, 0x91, 0xA7, 0x6C, 0x44, 0x9E, 0x4A, 0xEB, 0x8C, 0xEF, 0xEC,
-    0x55, 0xD4, 0x6F, 0x2E, 0x77, 0xDD, 0x64, 0x8B, 0xAE, 0x9B, 0xEA, 0x1E, 0x5D, 0x37, 0x83, 0xAC,
-    0xAF, 0x9B, 0xBC, 0xDF, 0x3D, 0xFE, 0x0C, 0x19, 0xF5, 0xF5, 0x1C, 0x9C, 0xFA, 0xD2, 0xB2, 0x59,
-    0xD9, 0xD7, 0x29, 0xCF, 0xB4, 0xD6, 0xBE, 0x9E, 0xFE, 0x7D, 0x16, 0x65, 0xE9, 0x84, 0x14, 0xF3,
-    0xCE, 0x3A, 0xB4, 0x0E, 0x5B, 0x67, 0x5E, 0x25, 0xD5, 0x18, 0xF3, 0x0B, 0x30, 0x84, 0x1B, 0x1B,
-    0x93, 0xA6, 0xAC, 0xBE, 0x7A, 0x63, 0xC3, 0x46, 0x29, 0x4C, 0x12, 0x99, 0x4E, 0x34, 0x6A, 0x34,
-    0x5F, 0x9B, 0x56, 0xD8, 0x13, 0xD6, 0x05, 0x1F, 0x4F, 0x12, 0xFF, 0xDA, 0x47, 0x70, 0xBE, 0xFC,
-    0x15, 0x12, 0xE3, 0xA6, 0x20, 0x7D, 0x49, 0x9D, 0xCA, 0x58, 0xD4, 0xB6, 0x51, 0xE7, 0xDC, 0xCF,
-    0x9E, 0xB6, 0x52, 0x9B, 0x6E, 0xB4, 0xC1, 0x0B, 0x13, 0x68, 0xB8, 0x46, 0x0E, 0xDE, 0x8C, 0x56,
-    0x74, 0x30, 0x31, 0xEF, 0x30, 0xD9, 0x47, 0x96, 0x35, 0x25, 0x4D, 0xDB, 0x5C, 0xB4, 0xB7, 0x39,
-    0x69, 0x0C, 0x75, 0xB7, 0xD4, 0x5C, 0x94, 0x2C, 0x0B, 0xF3, 0xAE, 0xB9, 0xF6, 0x08, 0xFC, 0x48,
-    0xB7, 0x6C, 0x25, 0x9C, 0x07, 0x00, 0x27, 0x74, 0x5D, 0xEF, 0x30, 0xE0, 0x7C, 0x0E, 0x70, 0xFE,
-    0xA5, 0x81, 0xD3, 0xDD, 0x05, 0x9C, 0x5F, 0x06, 0x9C, 0xDF, 0x06, 0x9C, 0xE7, 0x30, 0xD7, 0xC6,
-    0x62, 0xAE, 0x3B, 0x60, 0x7A, 0x1E, 0x30, 0x7D, 0x19, 0x30, 0xFD, 0x21, 0x60, 0x9A, 0x58, 0x98,
-    0xB0, 0xED, 0x52, 0x00, 0x1E, 0x1E, 0x1D, 0x7A, 0xD1, 0xB2, 0xFF, 0x5D, 0xF4, 0x4D, 0xF0, 0xDA,
-    0x0F, 0xA8, 0x53, 0x93, 0xF0, 0xE6, 0xB1, 0x6C, 0xD1, 0x86, 0xEE, 0xED, 0x69, 0x43, 0x5F, 0x44,
-    0x34, 0xD1, 0xCA, 0xCE, 0x73, 0xA7, 0xF8, 0x53, 0xAD, 0xD0, 0x7A, 0xBF, 0xFC, 0x93, 0xCC, 0xAB,
-    0x3C, 0xED, 0x23, 0x08, 0x3E, 0x51, 0x4F, 0x8A, 0x51, 0x32, 0x33, 0x7B, 0x36, 0xD4, 0xAF, 0x7C,
-    0x88, 0x7F, 0x0A, 0x55, 0x3E, 0x00, 0xAC, 0x5F, 0x18, 0x42, 0x28, 0xB6, 0x6A, 0xD8, 0xA7, 0xAD,
-    0xCA, 0x99, 0xF0, 0xD8, 0x03, 0x0B, 0x47, 0xB7, 0x12, 0x73, 0x76, 0xC8, 0x0C, 0xE5, 0x3C, 0x4B,
-    0xAC, 0xE2, 0x71, 0x5E, 0x7E, 0x0F, 0x72, 0x7A, 0x7B, 0x2A, 0x7A, 0x30, 0x43, 0xDA, 0x0E, 0x5B,
-    0xF1, 0xD8, 0x54, 0xFC, 0x5E, 0xA9, 0x6D, 0x11, 0xB1, 0x94, 0xF1, 0xC8, 0x2F, 0xFA, 0xB7, 0x26,
-    0x69, 0x84, 0xE8, 0xDD, 0x59, 0x2A, 0x62, 0x41, 0x40, 0x13, 0xD9, 0x3E, 0x0B, 0xCF, 0x60, 0xB6,
-    0xDC, 0x29, 0xFD, 0xE4, 0xE0, 0xDB, 0xEB, 0x81, 0xE9, 0x8D, 0x26, 0x9F, 0xF3, 0x90, 0x30, 0x2F,
-    0x1F, 0x28, 0x56, 0xE7, 0x2B, 0xD1, 0x76, 0xAF, 0xED, 0x62, 0x7F, 0x88, 0x3B, 0x5C, 0x71, 0x10,
-    0xD8, 0xB4, 0xBF, 0x1C, 0xB9, 0x6C, 0xBA, 0xEA, 0x9D, 0xC2, 0x24, 0xA4, 0x2B, 0x93, 0x9D, 0xDE,
-    0x2E, 0x97, 0x73, 0x5A, 0x36, 0x18, 0xFB, 0xFF, 0x7A, 0xCC, 0xED, 0xA0, 0x66, 0xC9, 0x03, 0xED,
-    0x41, 0xF3, 0x18, 0x5B, 0x8A, 0x73, 0x61, 0x9E, 0x82, 0x7C, 0x62, 0x7D, 0xCA, 0xF7, 0x8C, 0xEC,
-    0x18, 0xB1, 0x5C, 0x48, 0x4C, 0x09, 0xFE, 0xBF, 0xEE, 0x82, 0x38, 0x2C, 0xD3, 0xB0, 0x40, 0x40,
-    0x3C, 0x98, 0x9F, 0x46, 0x80, 0x2E, 0xEC, 0x9D, 0x0F, 0xD3, 0xC5, 0x11, 0xA0, 0x13, 0x7A, 0x38,
-    0x25, 0x9A, 0x14, 0xC6, 0x09, 0xD3, 0x1A, 0xD3, 0x5D, 0x22, 0x3C, 0x56, 0x9D, 0x19, 0xE1, 0xBC,
-    0x58, 0x69, 0x67, 0x7A, 0xC7, 0x9A, 0xE3, 0xBD, 0x2D, 0x5E, 0x1A, 0xF5, 0xCB, 0x53, 0x3E, 0xBD,
-    0xEE, 0x4C, 0x82, 0x36, 0xD9, 0xA0, 0xA7, 0x34, 0xCD, 0x09, 0xEC, 0x32, 0x60, 0x44, 0x03, 0xFE,
-    0xD0, 0x22, 0xB1, 0xD6, 0xB6, 0xD9, 0xC1, 0xAB, 0x2E, 0xBD, 0xFA, 0xF4, 0xBA, 0xA7, 0x6A, 0xED,
-    0xB5, 0xB3, 0xDE, 0xB8, 0x8D, 0x43, 0xC3, 0x2E, 0x15, 0x99, 0xBA, 0x94, 0xB3, 0x39, 0xC2, 0xCA,
-    0x26, 0x71, 0x67, 0xAC, 0x6A, 0xC4, 0xD2, 0xB6, 0xD5, 0xEA, 0x66, 0x28, 0xE7, 0xD3, 0x95, 0x38,
-    0xB8, 0xA1, 0x65, 0x26, 0xF7, 0x06, 0x70, 0xC8, 0x40, 0xA3, 0xB4, 0xD4, 0xE0, 0x68, 0xCD, 0x96,
-    0xE1, 0x60, 0xFD, 0x65, 0xC4, 0x8C, 0x1E, 0x8F, 0x9D, 0x04, 0x20, 0x73, 0x58, 0x0D, 0x12, 0xFA,
-    0x3C, 0x4E, 0xAB, 0x9F, 0x52, 0x69, 0x53, 0xCB, 0x8F, 0x16, 0x02, 0x15, 0x2B, 0x42, 0xA0, 0xB4,
-    0x0D, 0x19, 0xD4, 0xD3, 0xE9, 0x8A, 0xCD, 0xD3, 0x38, 0xAC, 0x2C, 0x93, 0x25, 0xA2, 0xC5, 0x69,
-    0x89, 0x07, 0x0E, 0x86, 0xD6, 0x6C, 0x1C, 0xD1, 0x9A, 0x19, 0xA8, 0x64, 0x50, 0xCD, 0xC3, 0xDE,
-    0x79, 0xED, 0xAC, 0x8F, 0x3F, 0xA6, 0x9B, 0x12, 0xA1, 0x85, 0x6B, 0x3F, 0x4F, 0x9C, 0x6A, 0xDD,
-    0xE1, 0xB3, 0x0F, 0x83, 0x46, 0x54, 0x2C, 0xC5, 0x74, 0xC9, 0xC2, 0x32, 0x7E, 0x41, 0x1E, 0xD9,
-    0xEA, 0xB2, 0x82, 0xC0, 0x78, 0x63, 0xD9, 0xE0, 0x76, 0x74, 0x6A, 0xF6, 0x67, 0xC1, 0x48, 0x68,
-    0x92, 0x35, 0x1E, 0xCA, 0x78, 0x24, 0xF5, 0xD8, 0xAB, 0x4F, 0x1E, 0xAF, 0xBA, 0x75, 0xE9, 0xBC,
-    0xD0, 0x6A, 0xAA, 0x6E, 0x46, 0x91, 0x5C, 0xF6, 0xC8, 0xDF, 0xD4, 0x93, 0x68, 0xDB, 0xEA, 0x37,
-    0x35, 0x1C, 0xC1, 0x9B, 0xDE, 0xFF, 0xD3, 0xD7, 0x3F, 0x4B, 0x00, 0x22, 0xFD, 0x37, 0x09, 0x41,
-    0xD9, 0xFF, 0xCC, 0xEA, 0x6C, 0xF8, 0x15, 0xD9, 0x02, 0x6D, 0x43, 0x61, 0x10, 0x16, 0x3A, 0x30,
-    0x95, 0x6B, 0x01, 0x5D, 0xBF, 0xF5, 0xE0, 0x95, 0xD7, 0x40, 0x5F, 0xFF, 0x2B, 0xE4, 0x18, 0xFF,
-    0x7F, 0x62, 0x9D, 0xA1, 0x3F, 0x05, 0xF6, 0x5B, 0x5E, 0x05, 0x52, 0xEE, 0x78, 0x25, 0x88, 0x0C,
-    0xDA, 0x05, 0x4B, 0x07, 0x91, 0x94, 0xCE, 0x86, 0xD0, 0xB6, 0x42, 0x69, 0x48, 0x0D, 0x11, 0xAE,
-    0x65, 0x90, 0x7A, 0x35, 0xBB, 0x64, 0xC6, 0x80, 0xC8, 0x1F, 0x3B, 0x1F, 0x89, 0xFF, 0xE7, 0xDE,
-    0x25, 0x09, 0x9E, 0x0F, 0xBE, 0x2E, 0xE1, 0x73, 0xE1, 0x3A, 0x86, 0xE7, 0xC1, 0x2C, 0x87, 0xBF,
-    0x1C, 0xCB, 0xFA, 0xE1, 0x73, 0x5B, 0x12, 0x87, 0x05, 0x87, 0x6C, 0x22, 0x71, 0x90, 0xA8, 0xFF,
-    0xF4, 0xDC, 0xDC, 0x6B, 0x9A, 0x67, 0xC4, 0x69, 0x20, 0x1E, 0x52, 0xA7, 0x97, 0xFA, 0x6D, 0x08,
-    0xE4, 0x72, 0xED, 0x30, 0x74, 0xE6, 0x0C, 0x6E, 0x4E, 0xF4, 0x69, 0x8E, 0x90, 0x03, 0xCF, 0xA7,
-    0xEB, 0x37, 0x46, 0x68, 0xBB, 0x0C, 0x8F, 0xA8, 0x9B, 0x83, 0x75, 0x3C, 0xA4, 0xAE, 0xA7, 0xD4,
-    0xF5, 0x98, 0xBA, 0x1E, 0x39, 0xE2, 0x41, 0x75, 0xAE, 0x52, 0x31, 0x7C, 0xAD, 0xCC, 0x21, 0x50,
-    0x1E, 0x56, 0x17, 0x3D, 0xAD, 0x2E, 0x9F, 0x3F, 0x08, 0xA0, 0xB0, 0x6A, 0x1F, 0xF1, 0x41, 0x60,
-    0x2D, 0xF2, 0x67, 0x9D, 0xC4, 0x69, 0x3E, 0x48, 0xFD, 0x2B, 0x93, 0x84, 0x67, 0x7A, 0xBA, 0xAA,
-    0x25, 0x99, 0xDC, 0x36, 0x65, 0x53, 0x93, 0xD3, 0x59, 0x24, 0xEC, 0x07, 0xE7, 0xCF, 0x49, 0x54,
-    0x2D, 0x97, 0x0A, 0x63, 0x58, 0xA6, 0x61, 0x6F, 0xE9, 0x98, 0xE1, 0xE3, 0x39, 0x5A, 0xAF, 0x53,
-    0x77, 0xCC, 0xF4, 0xF3, 0x22, 0xE7, 0xA3, 0xC0, 0xEA, 0xE8, 0x91, 0x3F, 0x4F, 0xC7, 0xE0, 0x92,
-    0xAA, 0x1A, 0xD5, 0x35, 0x7D, 0x8D, 0xAA, 0x86, 0xEA, 0x16, 0x57, 0xB6, 0x56, 0xBB, 0x99, 0xF0,
-    0x28, 0x18, 0x95, 0x7B, 0x72, 0xF2, 0x74, 0xAA, 0x47, 0x87, 0x68, 0x28, 0xC9, 0x68, 0x37, 0xBF,
-    0x4A, 0xB7, 0xAD, 0x34, 0x1D, 0x36, 0xF4, 0x28, 0x42, 0x4D, 0x4B, 0x47, 0xFA, 0x55, 0x29, 0x3D,
-    0x1D, 0xE5, 0x0F, 0x9C, 0x43, 0xA9, 0xD3, 0x5C, 0x9A, 0x54, 0xFE, 0x95, 0xEB, 0x97, 0xC7, 0x61,
-    0xB2, 0x9D, 0x0E, 0x79, 0x08, 0x08, 0x54, 0xEA, 0xB1, 0xEC, 0xD0, 0x9F, 0xE4, 0x23, 0xD9, 0x9E,
-    0x69, 0x43, 0xAD, 0x54, 0x54, 0x71, 0x35, 0xE3, 0x90, 0x71, 0xB0, 0x2B, 0xC9, 0xE0, 0x7C, 0x73,
-    0x2D, 0x8F, 0x7E, 0xF6, 0x6E, 0x5B, 0x01, 0x5E, 0x07, 0xC3, 0xAC, 0x31, 0xAC, 0x6B, 0x83, 0xE0,
-    0x7B, 0x67, 0xC3, 0xC3, 0xEF, 0xB3, 0x43, 0x8E, 0x2D, 0x4A, 0x6F, 0xDD, 0x35, 0xFB, 0xCF, 0x43,
-    0xF5, 0x6A, 0x79, 0xF4, 0xEC, 0x0D, 0x44, 0xFD, 0xE4, 0xE2, 0xEC, 0x0D, 0x73, 0x00, 0x0E, 0x18,
-    0xC9, 0xFF, 0x59, 0xAD, 0x5D, 0xB3, 0x24, 0x2C, 0xD3, 0x7B, 0x27, 0x27, 0xB9, 0x96, 0x79, 0x6A,
-    0xEB, 0x21, 0x8D, 0x74, 0xAE, 0x04, 0xF1, 0x76, 0x66, 0x7A, 0xAD, 0x96, 0xCE, 0x94, 0x81, 0x04,
-    0xA9, 0x97, 0x04, 0x85, 0x75, 0xB8, 0x2A, 0xEB, 0x59, 0x19, 0x87, 0xF9, 0xD3, 0x67, 0x6A, 0x17,
-    0x4A, 0xB4, 0x7B, 0xC5, 0x29, 0x4F, 0xE2, 0xF3, 0x29, 0x7B, 0xBD, 0xC0, 0xAC, 0xCC, 0xCE, 0x4F,
-    0xED, 0x21, 0xBB, 0xF9, 0xE9, 0xAA, 0x57, 0xF9, 0x55, 0x1E, 0x87, 0x60, 0x5E, 0x69, 0x45, 0xB5,
-    0x12, 0xF0, 0xE9, 0xB1, 0xD7, 0x4C, 0xA3, 0x9F, 0x80, 0x43, 0x58, 0xB7, 0x19, 0xFA, 0xF9, 0x60,
-    0x92, 0x44, 0xBB, 0x8B, 0xF2, 0xFC, 0x1B, 0x80, 0xE6, 0xA5, 0xEC, 0x89, 0x00, 0x63, 0x38, 0x7D,
-    0xAB, 0x75, 0x93, 0x1F, 0x18, 0x36, 0xA3, 0xA3, 0x76, 0x96, 0xFF, 0x91, 0x7F, 0x3F, 0xEE, 0x9B,
-    0x4D, 0x32, 0xBD, 0x91, 0xCD, 0xC7, 0xA5, 0x4E, 0x80, 0x27, 0xE7, 0xBE, 0x69, 0xBA, 0x0D, 0x8A,
-    0x61, 0x79, 0xC9, 0xC7, 0xF9, 0x6D, 0x09, 0xA4, 0xF5, 0x16, 0x5F, 0x0F, 0x7E, 0xAA, 0x8D, 0x4D,
-    0x75, 0x0E, 0x1B, 0xEB, 0x34, 0x07, 0xD8, 0x37, 0x7C, 0xA3, 0x1D, 0xA1, 0x89, 0x71, 0x4D, 0xF8,
-    0xD1, 0x99, 0xDA, 0xFA, 0x29, 0x7D, 0x0B, 0x8F, 0x39, 0x08, 0x9E, 0xC2, 0xF6, 0xCD, 0xCE, 0x2E,
-    0x1D, 0xF1, 0xDC, 0xDC, 0x4C, 0x54, 0xE4, 0x36, 0x8F, 0xD9, 0x2E, 0xED, 0x91, 0x09, 0x49, 0x28,
-    0xB2, 0x5D, 0x5B, 0xDE, 0x6E, 0xDA, 0xAF, 0x1C, 0x1A, 0xAE, 0xC8, 0x95, 0xD5, 0xB2, 0xE1, 0x95,
-    0xEA, 0x34, 0x9A, 0xD6, 0xD3, 0xC9, 0x54, 0x96, 0x5A, 0xC5, 0x9E, 0xDC, 0x37, 0x34, 0x0C, 0xEC,
-    0x49, 0x8C, 0x87, 0x2A, 0xED, 0x9E, 0x5B, 0x74, 0x51, 0x5B, 0x38, 0xD5, 0xFB, 0x8A, 0xF7, 0x1E,
-    0x7B, 0x7D, 0x62, 0xDF, 0x67, 0x41, 0xD2, 0xAD, 0x19, 0x23, 0x32, 0xEF, 0x01, 0x78, 0x64, 0x14,
-    0x28, 0xBA, 0x1A, 0xD0, 0xDF, 0x91, 0x9A, 0xBD, 0x5F, 0x1B, 0x60, 0x6F, 0xD9, 0x91, 0x7F, 0x80,
-    0x36, 0x40, 0x43, 0xB2, 0x9D, 0xF8, 0x8E, 0xAE, 0xC0, 0xBE, 0xE9, 0x0A, 0x1C, 0x4A, 0x34, 0x62,
-    0x4B, 0x60, 0xFF, 0xCE, 0xAE, 0xC0, 0x7F, 0x77, 0x6D, 0x8A, 0x56, 0xE2, 0xA9, 0x9D, 0xBC, 0xB7,
-    0x8B, 0x87, 0x20, 0xE2, 0xC3, 0x02, 0x69, 0x8E, 0xFD, 0xAC, 0x20, 0xE2, 0x27, 0x84, 0x99, 0x3D,
-    0x87, 0x9D, 0xC5, 0xD7, 0x41, 0x3D, 0xE6, 0xF3, 0xDF, 0x70, 0x79, 0xD9, 0x30, 0xBE, 0x50, 0x52,
-    0x9F, 0xF8, 0x40, 0x96, 0xD6, 0x23, 0x02, 0x7B, 0x9C, 0xF3, 0x89, 0x7F, 0x8F, 0x84, 0xA7, 0x07,
-    0xF9, 0xF3, 0x79, 0xE7, 0x65, 0xEB, 0x74, 0x0D, 0xF5, 0x3B, 0x0D, 0x4A, 0x0D, 0x21, 0x63, 0x16,
-    0x3A, 0xF9, 0xA5, 0x2A, 0x58, 0xE7, 0x39, 0x2C, 0xB3, 0x86, 0x55, 0x0E, 0x2F, 0x75, 0x72, 0xB6,
-    0x81, 0x76, 0x6C, 0xD3, 0xC2, 0xA5, 0x6D, 0x71, 0x9B, 0xDB, 0x02, 0x61, 0x4B, 0xD8, 0x12, 0x63,
-    0xFC, 0x16, 0xBE, 0x1B, 0x83, 0x0C, 0xB9, 0xCC, 0x8F, 0x4F, 0x04, 0x37, 0x9E, 0x84, 0x30, 0x4D,
-    0xAC, 0x4E, 0x41, 0xC6, 0x78, 0x31, 0xFD, 0xED, 0x21, 0x68, 0x6A, 0xAB, 0xEC, 0x96, 0xC3, 0xAC,
-    0xE7, 0xC0, 0xAD, 0xAF, 0x65, 0x4B, 0xA8, 0x9A, 0xF8, 0x60, 0x64, 0x0E, 0x93, 0x55, 0xA2, 0xE8,
-    0x2A, 0xBE, 0x8A, 0xB0, 0x62, 0xAC, 0x28, 0x2B, 0xCE, 0x8A, 0xB4, 0x62, 0xAD, 0x68, 0x9B, 0xEE,
-    0x5C, 0xF5, 0x21, 0xBA, 0xF3, 0xE8, 0xA8, 0x6E, 0x53, 0x54, 0x0B, 0xEC, 0xC3, 0x20, 0x91, 0x68,
-    0xE1, 0x6A, 0x3C, 0xB6, 0xAF, 0xD9, 0xB0, 0x92, 0xDD, 0x26, 0xC6, 0xDA, 0x23, 0x9F, 0x0F, 0x73,
-    0x08, 0xF5, 0xBE, 0x5D, 0x26, 0xF7, 0xE9, 0xAA, 0x61, 0xD6, 0xBA, 0x59, 0xD1, 0xEB, 0xF2, 0xFB,
-    0xAB, 0xBB, 0x4B, 0xEE, 0xE8, 0xAE, 0x19, 0x68, 0x10, 0xBD, 0xDC, 0xB0, 0xB4, 0xE8, 0x23, 0x23,
-    0xF9, 0x54, 0x09, 0x2D, 0x5B, 0xCE, 0x27, 0xF5, 0x45, 0x19, 0x0B, 0x51, 0xD4, 0x61, 0xE1, 0x08,
-    0x3E, 0xBE, 0x33, 0xAA, 0x8F, 0xDA, 0x43, 0xC4, 0x3C, 0xC8, 0x20, 0x9B, 0xF7, 0x43, 0xE9, 0x3D,
-    0x13, 0x4D, 0xE9, 0x0A, 0x8F, 0x86, 0x30, 0x56, 0xB9, 0x79, 0x74, 0x1E, 0x77, 0x1F, 0xB9, 0x05,
-    0xCC, 0xD2, 0x3D, 0x47, 0x09, 0x4B, 0x2D, 0xE7, 0x15, 0x4C, 0x6E, 0x79, 0x4A, 0xF7, 0xFE, 0x93,
-    0x2B, 0x1D, 0xD5, 0xF3, 0x4E, 0xBE, 0x79, 0xDA, 0x40, 0x4F, 0xAE, 0x41, 0x78, 0x79, 0x46, 0x8F,
-    0xC9, 0x4B, 0xED, 0x1B, 0xDE, 0x61, 0xE0, 0x5B, 0x69, 0x63, 0xA5, 0x3A, 0x9D, 0xF4, 0x34, 0xB7,
-    0x4D, 0x04, 0xED, 0xBD, 0xC7, 0x54, 0x37, 0xD3, 0xCF, 0x13, 0x04, 0x1C, 0x83, 0xA5, 0x34, 0xCD,
-    0xBA, 0x81, 0x84, 0x84, 0xFB, 0x04, 0xE0, 0x7F, 0xB5, 0x39, 0x4A, 0x3E, 0xC7, 0x22, 0x67, 0x66,
-    0x6F, 0xDE, 0x1F, 0x7C, 0xFB, 0x15, 0x3C, 0x77, 0x83, 0xF2, 0xE0, 0xE4, 0x2A, 0xF6, 0x74, 0xB6,
-    0x02, 0x4A, 0x7E, 0xA9, 0x57, 0x2C, 0xFF, 0x06, 0xC5, 0x99, 0x3F, 0x6C, 0xDC, 0x74, 0x14, 0xC7,
-    0xBF, 0xBE, 0xBB, 0x9C, 0x45, 0x8F, 0xC4, 0x11, 0x4A, 0x87, 0xFE, 0x8B, 0x19, 0x18, 0x5A, 0xA9,
-    0x39, 0x2F, 0x1D, 0x2A, 0x74, 0x7F, 0x8C, 0x90, 0x58, 0x3A, 0x90, 0x01, 0xE6, 0x16, 0x89, 0x11,
-    0xA9, 0x1D, 0x32, 0xA4, 0x70, 0x6D, 0x4C, 0x3B, 0x30, 0x20, 0x50, 0x01, 0xB1, 0x02, 0x43, 0xA7,
-    0x32, 0x34, 0x42, 0x19, 0x4E, 0x90, 0xE8, 0xAC, 0x2E, 0xAC, 0x66, 0x40, 0x0C, 0x2C, 0x46, 0x6D,
-    0xC4, 0xD0, 0xC5, 0x88, 0xAB, 0x74, 0xA8, 0x49, 0x8E, 0xEF, 0x7B, 0x3F, 0xDB, 0xB9, 0xA6, 0x48,
-    0x28, 0x3D, 0x5F, 0xCE, 0x89, 0x1D, 0x9F, 0x63, 0xBF, 0xDF, 0xFB, 0xFC, 0xDE, 0xF3, 0xF7, 0xF7,
-    0x7E, 0xBF, 0x03, 0x9C, 0x00, 0x70, 0x43, 0xA0, 0xCD, 0xFD, 0x27, 0xEE, 0x7F, 0x87, 0x28, 0x3D,
-    0x8C, 0x50, 0x7E, 0x10, 0xA1, 0x76, 0x2B, 0x86, 0x6B, 0xC5, 0x68, 0x59, 0x09, 0x6E, 0xDE, 0x4B,
-    0x30, 0x1C, 0x26, 0xD6, 0x93, 0x77, 0x93, 0x72, 0x84, 0x7E, 0x2D, 0x44, 0xDF, 0xF1, 0xD1, 0xF5,
-    0x80, 0x6E, 0x13, 0xE8, 0x40, 0x36, 0x8B, 0xBB, 0xC3, 0xDD, 0xE5, 0x5E, 0xE1, 0x7E, 0xD2, 0xF2,
-    0xAD, 0xE1, 0x6F, 0x81, 0xBD, 0xDD, 0xF3, 0x1D, 0xBF, 0x0D, 0x8F, 0x3F, 0x4D, 0xD4, 0x79, 0x73,
-    0x1D, 0x5D, 0x9E, 0x75, 0x79, 0xD6, 0xC7, 0x0E, 0xBA, 0xD6, 0x00, 0x9B, 0x76, 0x1F, 0xED, 0xAD,
-    0x75, 0xB8, 0xFD, 0x44, 0x4D, 0xC1, 0x07, 0xD8, 0x0E, 0xCA, 0xA1, 0x31, 0x0B, 0x94, 0xEE, 0x00,
-    0xD5, 0x01, 0x4F, 0x1A, 0xDC, 0xBB, 0xE6, 0xBF, 0xB6, 0xB9, 0xB7, 0x28, 0x06, 0x6B, 0x99, 0x66,
-    0xB3, 0x26, 0x88, 0x54, 0x8E, 0xB9, 0xFB, 0xC6, 0x81, 0x71, 0x58, 0xB8, 0xAD, 0xCA, 0x81, 0x1F,
-    0xED, 0x87, 0x74, 0x75, 0x51, 0xAE, 0xAF, 0x48, 0x23, 0x7E, 0x05, 0x23, 0x08, 0xCA, 0xA0, 0x10,
-    0x4A, 0x21, 0x18, 0xCA, 0xA1, 0x20, 0x4A, 0xA2, 0x28, 0xCA, 0xA2, 0x30, 0x42, 0x03, 0xC1, 0x91,
-    0xDE, 0xE8, 0x43, 0x80, 0x20, 0x44, 0x10, 0x24, 0x64, 0x71, 0x59, 0xD0, 0x0E, 0x2B, 0x7D, 0x19,
-    0xC1, 0xF9, 0x0B, 0x68, 0xD2, 0x95, 0xEF, 0x5E, 0x36, 0x8D, 0x8E, 0x03, 0x75, 0x8C, 0xBB, 0x2D,
-    0x9D, 0xF3, 0x73, 0x6C, 0x88, 0x04, 0x28, 0xE3, 0x29, 0x26, 0x20, 0x33, 0xB4, 0x54, 0x63, 0x13,
-    0xA5, 0x07, 0x8C, 0xFD, 0xDB, 0x49, 0x71, 0xBE, 0x9B, 0xEC, 0x01, 0xAE, 0x49, 0xD2, 0xC6, 0x12,
-    0x15, 0xFF, 0xA8, 0xA3, 0x62, 0x09, 0xD7, 0xBA, 0xFA, 0x50, 0xFA, 0xAA, 0xD8, 0xC8, 0x60, 0x06,
-    0x74, 0xBB, 0xFD, 0x27, 0x0F, 0xD7, 0x7A, 0x19, 0x89, 0x4D, 0x0F, 0x8F, 0x3A, 0xF1, 0xF8, 0xD4,
-    0x17, 0x21, 0x5E, 0x1F, 0xFA, 0xB8, 0x72, 0xC2, 0xBC, 0xC0, 0x4E, 0xA1, 0x41, 0x4C, 0xB1, 0x5C,
-    0x5E, 0xE8, 0x5C, 0x04, 0xE2, 0xD3, 0x85, 0xAA, 0xC1, 0x7F, 0x29, 0x9A, 0xA6, 0x0E, 0x9B, 0x74,
-    0xFA, 0x14, 0x09, 0xF6, 0x63, 0x7C, 0x66, 0x7C, 0x8E, 0xE7, 0x94, 0x0E, 0x27, 0x52, 0xC1, 0xE0,
-    0xD5, 0x2B, 0x7C, 0xCD, 0xAE, 0xD3, 0x17, 0xAF, 0x6F, 0x52, 0xA6, 0x60, 0x3E, 0x09, 0x15, 0x36,
-    0x80, 0xF9, 0x8F, 0x99, 0x17, 0x73, 0x34, 0xB9, 0xC3, 0x70, 0xC7, 0x05, 0xC4, 0xE6, 0x25, 0x79,
-    0x75, 0xA5, 0xB3, 0x82, 0x89, 0x33, 0x48, 0x7C, 0x44, 0xA5, 0x0B, 0x67, 0xC8, 0x5F, 0xD1, 0x0B,
-    0xFC, 0xCB, 0x58, 0xBC, 0x37, 0x39, 0x8E, 0x52, 0x62, 0x9A, 0x01, 0x9B, 0x7B, 0xA5, 0x68, 0x8E,
-    0x19, 0x49, 0x31, 0x95, 0x83, 0xF5, 0x5C, 0x0E, 0x24, 0x26, 0xB8, 0xFE, 0x01, 0x0C, 0x4D, 0x8E,
-    0x33, 0x69, 0x39, 0xB8, 0x15, 0xE2, 0x43, 0xCA, 0xC1, 0x32, 0x33, 0x7C, 0xDE, 0x2A, 0x18, 0x73,
-    0x9E, 0xC3, 0xC5, 0xCA, 0x99, 0x67, 0x0D, 0x4E, 0x50, 0x0A, 0x5E, 0x65, 0x73, 0x17, 0x16, 0x8B,
-    0xF3, 0xFF, 0xA0, 0x0C, 0x0C, 0x87, 0x81, 0xC5, 0xBD, 0x14, 0xEF, 0x5F, 0xB7, 0xB9, 0xD7, 0x48,
-    0xE4, 0x7C, 0xBD, 0x0C, 0x67, 0x38, 0x80, 0x73, 0xEF, 0xAE, 0xBA, 0x53, 0x4F, 0x5F, 0xE4, 0xC6,
-    0x7E, 0xE9, 0x82, 0xDE, 0x30, 0xA2, 0x89, 0x70, 0xDF, 0x76, 0x6A, 0x47, 0xCE, 0x71, 0x92, 0x6E,
-    0x26, 0xF6, 0x1F, 0x03, 0xC7, 0x5F, 0xA5, 0x67, 0x8D, 0x52, 0x72, 0xB3, 0x17, 0xF5, 0xF6, 0xC0,
-    0xD2, 0xA7, 0xAF, 0xB5, 0x55, 0x07, 0x7E, 0xFB, 0xFB, 0xB0, 0x36, 0x0C, 0xCC, 0xC3, 0x6C, 0x9B,
-    0xBF, 0xE2, 0x95, 0x75, 0x97, 0x99, 0xB0, 0xC5, 0x13, 0x06, 0x0E, 0x37, 0xF8, 0xF9, 0x11, 0x3F,
-    0xA7, 0x8D, 0x14, 0xE5, 0xF0, 0x8C, 0xAF, 0xC3, 0xC4, 0x8A, 0xD4, 0x4B, 0x7C, 0x78, 0xCE, 0xF4,
-    0xEC, 0x61, 0x3C, 0xB6, 0xE8, 0xB3, 0xF7, 0x8B, 0x8C, 0x3C, 0x01, 0xAE, 0xD4, 0x8B, 0xF5, 0x4E,
-    0xD2, 0x76, 0x78, 0x09, 0xA5, 0xC7, 0xBB, 0x14, 0x9D, 0x8D, 0x34, 0xEC, 0x3E, 0xE8, 0x1D, 0xE8,
-    0x1E, 0xB3, 0x7E, 0x55, 0x83, 0x4D, 0x0F, 0x41, 0x17, 0x41, 0x1F, 0xC5, 0x49, 0xF1, 0x52, 0xDC,
-    0x14, 0x3F, 0x41, 0x47, 0x91, 0x7A, 0x2A, 0xDB, 0xA2, 0xAA, 0x7D, 0xE9, 0x09, 0x53, 0x72, 0x13,
-    0x58, 0x9A, 0x33, 0x6D, 0x14, 0x9B, 0x02, 0xF3, 0xEC, 0x94, 0x04, 0xD5, 0x4F, 0x02, 0x78, 0xBF,
-    0xD2, 0x11, 0xBE, 0xAC, 0xC1, 0x6B, 0x63, 0xFB, 0x5E, 0xE2, 0x1F, 0x4B, 0x52, 0xEA, 0x07, 0xDE,
-    0x31, 0x21, 0xDF, 0x2B, 0x9A, 0x6A, 0x76, 0x35, 0xB0, 0xAE, 0x46, 0xF4, 0x3B, 0x75, 0xFB, 0x50,
-    0xD9, 0x00, 0x4B, 0x00, 0xCE, 0x9B, 0x5E, 0xEE, 0x87, 0x93, 0xEB, 0x65, 0x26, 0x2E, 0xAA, 0x91,
-    0x8E, 0xDB, 0xD5, 0x4F, 0x99, 0x81, 0x51, 0x61, 0x3D, 0x4D, 0x7D, 0x9E, 0x87, 0xF3, 0x4F, 0x8C,
-    0xF3, 0x5E, 0xDA, 0xF5, 0x93, 0xEB, 0x71, 0xDD, 0xDA, 0x6F, 0xFA, 0x78, 0x3A, 0x04, 0x82, 0xF7,
-    0x89, 0x44, 0x03, 0x45, 0xB2, 0x64, 0x21, 0xB1, 0x29, 0x9C, 0x8B, 0x4C, 0xFE, 0x15, 0xBB, 0x78,
-    0xFF, 0x0F, 0x0A, 0x9E, 0x68, 0x77, 0x08, 0x2F, 0xC6, 0x46, 0x52, 0x0A, 0xCF, 0x62, 0x1C, 0x09,
-    0x64, 0x19, 0x2B, 0xD3, 0xD0, 0x86, 0xDC, 0x45, 0xFB, 0x65, 0x35, 0xDE, 0xEB, 0x63, 0x2D, 0x96,
-    0xE1, 0xC1, 0x55, 0xE7, 0x9A, 0xFA, 0xFF, 0x8E, 0x56, 0x71, 0x5D, 0xB5, 0x98, 0xC8, 0xFB, 0x47,
-    0x34, 0x79, 0x22, 0xC4, 0xA9, 0x47, 0x58, 0x23, 0xFD, 0x3B, 0x84, 0xD6, 0x49, 0x94, 0xA3, 0xB7,
-    0x99, 0x41, 0x64, 0x79, 0xFF, 0x36, 0xE2, 0xDB, 0x81, 0x74, 0x80, 0xE3, 0x1F, 0xB4, 0xDD, 0x78,
-    0xE1, 0x46, 0x75, 0x78, 0x71, 0xF4, 0xB7, 0xA2, 0x43, 0x59, 0x1D, 0x2D, 0x3D, 0x5B, 0xE0, 0x53,
-    0x7D, 0x24, 0x56, 0x62, 0xC5, 0xA5, 0xB8, 0x1C, 0x95, 0x43, 0x3B, 0xAC, 0x05, 0x8E, 0xEF, 0xE8,
-    0xA8, 0x57, 0xA1, 0xF9, 0x66, 0x5E, 0x02, 0xDB, 0xD2, 0x2D, 0xED, 0x21, 0x9B, 0xD8, 0xE5, 0x70,
-    0x56, 0x4E, 0x68, 0x81, 0x63, 0xA6, 0x67, 0xFC, 0x74, 0xC5, 0x76, 0x5D, 0x0E, 0xCD, 0xF4, 0xE0,
-    0x8A, 0x63, 0x9E, 0x1C, 0x5A, 0xF2, 0xF1, 0x06, 0xFF, 0xF0, 0x31, 0x4F, 0xAA, 0x1E, 0x27, 0xAC,
-    0x45, 0xB0, 0xF7, 0x58, 0x13, 0xA0, 0x37, 0xC8, 0xB2, 0x43, 0x9B, 0x51, 0xDD, 0x6E, 0xE5, 0x1F,
-    0x25, 0x5E, 0xFD, 0xDA, 0xF6, 0xA6, 0xEB, 0xB7, 0x5A, 0x70, 0x1B, 0x70, 0x3B, 0x70, 0xBB, 0xA8,
-    0xF7, 0xD1, 0xEA, 0xA3, 0xD1, 0x45, 0xB7, 0x63, 0x25, 0xDE, 0xFD, 0xA8, 0xB6, 0x97, 0x86, 0x9F,
-    0xD4, 0x92, 0x48, 0x12, 0xFB, 0x63, 0x72, 0x38, 0x15, 0xA7, 0x13, 0x70, 0xBD, 0x2C, 0x8E, 0x02,
-    0xA7, 0x71, 0x34, 0x38, 0x2C, 0xAE, 0x6A, 0xB4, 0x7D, 0x51, 0x2A, 0x6D, 0x3B, 0x4A, 0x17, 0x2D,
-    0x0E, 0xC5, 0x63, 0x66, 0xA9, 0xFA, 0x4A, 0xB8, 0x9F, 0xF3, 0xE4, 0x23, 0x29, 0x12, 0xA2, 0x44,
-    0x42, 0x39, 0x7F, 0x34, 0x0C, 0x3A, 0x84, 0xB0, 0xFF, 0xAA, 0xB7, 0x43, 0xB8, 0xDB, 0xCC, 0xB1,
-    0x75, 0x3A, 0x70, 0x76, 0x44, 0x0C, 0x58, 0xF5, 0x6D, 0x6F, 0x82, 0x34, 0xB4, 0x24, 0xC6, 0x5D,
-    0x66, 0xA2, 0xCB, 0x8C, 0xAA, 0x33, 0xA7, 0x5A, 0xDC, 0x1B, 0x3C, 0x67, 0xFD, 0xC3, 0x84, 0x24,
-    0x16, 0x72, 0x2E, 0x35, 0xA1, 0x93, 0x28, 0xDB, 0x0D, 0xA6, 0x41, 0x56, 0xD1, 0x37, 0xA1, 0xFC,
-    0x56, 0x80, 0xCB, 0x31, 0xA9, 0x52, 0xA8, 0x43, 0x46, 0x47, 0xD3, 0xC9, 0x12, 0xED, 0xB1, 0xA5,
-    0xE0, 0xFC, 0x6C, 0x3A, 0x21, 0x92, 0x22, 0xBE, 0x2A, 0x79, 0x12, 0xEB, 0x48, 0xEF, 0xC6, 0xC5,
-    0x85, 0x09, 0x0B, 0x25, 0x51, 0xE8, 0x6F, 0xD8, 0xC8, 0x83, 0x9D, 0xEC, 0xDA, 0x74, 0x02, 0xA6,
-    0x9B, 0x77, 0x3B, 0xC0, 0x8F, 0x32, 0x3E, 0x9D, 0x35, 0xE3, 0x53, 0xA1, 0xAC, 0xFB, 0x70, 0x6B,
-    0x02, 0x97, 0xC8, 0x40, 0x12, 0x5C, 0x9B, 0x9E, 0xF4, 0xC9, 0x54, 0x9A, 0x4D, 0x24, 0xE8, 0x6E,
-    0x58, 0xD1, 0xF9, 0xF1, 0xC4, 0xD0, 0x54, 0x0F, 0xA2, 0x83, 0x32, 0xB6, 0xAA, 0xB4, 0x8B, 0x30,
-    0x69, 0x9F, 0x0A, 0x5B, 0x53, 0xD8, 0x36, 0xC9, 0xB6, 0x97, 0x90, 0xAD, 0xED, 0x17, 0x1D, 0x38,
-    0x6C, 0x1A, 0x19, 0x16, 0x29, 0x3B, 0x86, 0xE3, 0x3A, 0x8E, 0x9F, 0xF4, 0x3B, 0xC4, 0x21, 0x4F,
-    0x2F, 0x7A, 0xC1, 0x60, 0xE9, 0x14, 0x4A, 0x8A, 0x0D, 0x1D, 0x17, 0x31, 0x7B, 0x84, 0x40, 0xCD,
-    0x74, 0x4A, 0xA8, 0xEB, 0x94, 0x41, 0x01, 0x40, 0xFF, 0x37, 0x5C, 0x4D, 0x9C, 0x4A, 0x64, 0x44,
-    0xC6, 0x2B, 0xCD, 0x0B, 0xCE, 0x70, 0x6C, 0x5D, 0x68, 0x2F, 0x80, 0x4C, 0xD6, 0x1C, 0xCB, 0xBB,
-    0x4C, 0xE0, 0xDA, 0x7D, 0x9A, 0x9F, 0x2D, 0x45, 0x47, 0xC3, 0xB3, 0xC0, 0x7A, 0xA7, 0x77, 0x09,
-    0xD6, 0xE3, 0x3D, 0x06, 0xA8, 0x5B, 0x48, 0xCA, 0x4D, 0xDC, 0xE7, 0x4A, 0x9E, 0xCB, 0x9D, 0x6C,
-    0xEC, 0xE5, 0x36, 0xBE, 0xEF, 0x07, 0x16, 0x19, 0x2C, 0x29, 0x1F, 0x99, 0x61, 0xAE, 0x5C, 0xAD,
-    0xCB, 0xE5, 0x25, 0xD1, 0x85, 0xA6, 0xD4, 0x9C, 0x0D, 0x61, 0xE9, 0x98, 0xD2, 0xD4, 0x91, 0x72,
-    0xD2, 0x95, 0x84, 0xAC, 0xCB, 0xA1, 0x29, 0x75, 0x65, 0x53, 0x1E, 0x6C, 0xC8, 0x83, 0x4D, 0xA3,
-    0x80, 0x1E, 0xD1, 0x9F, 0xEE, 0x32, 0x63, 0x45, 0x1C, 0xD3, 0xAE, 0xCF, 0x09, 0x72, 0x8C, 0x19,
-    0xE6, 0x97, 0xE3, 0xB3, 0xB0, 0x84, 0x29, 0x2D, 0x5D, 0xFE, 0xD4, 0x39, 0x07, 0x96, 0x75, 0x92,
-    0x06, 0x8F, 0x1D, 0xFE, 0xAC, 0x8E, 0xAC, 0x91, 0xAC, 0x6D, 0xAD, 0xC3, 0x1B, 0x5D, 0x23, 0x49,
-    0xA7, 0x05, 0x66, 0xD2, 0x73, 0x0E, 0xD9, 0x42, 0x95, 0xAE, 0x42, 0xA8, 0xA6, 0xA9, 0x70, 0x5E,
-    0xD8, 0xAF, 0x9B, 0x26, 0x4A, 0xA8, 0x5F, 0x19, 0xED, 0xA4, 0xF3, 0xCB, 0x67, 0xBF, 0x32, 0x1A,
-    0x8B, 0x34, 0x5B, 0x6B, 0x4E, 0x52, 0xF5, 0x4F, 0x55, 0x26, 0x17, 0x6B, 0x38, 0x81, 0xA0, 0x39,
-    0xBE, 0xB0, 0xD5, 0xC5, 0x47, 0x6F, 0x20, 0x74, 0x9C, 0xA8, 0x29, 0x9E, 0xE1, 0x33, 0x80, 0xE9,
-    0xF4, 0x42, 0x11, 0x0D, 0xA3, 0x81, 0x34, 0x94, 0x06, 0xD3, 0x70, 0x1A, 0x50, 0x43, 0x6A, 0x50,
-    0x47, 0x59, 0xB3, 0x4D, 0x3B, 0x78, 0x90, 0x69, 0x53, 0xD9, 0xD7, 0xC5, 0xC3, 0x72, 0x48, 0xDE,
-    0x4B, 0x21, 0x81, 0xBF, 0x65, 0x4B, 0xCE, 0x8E, 0x1C, 0xEE, 0x28, 0xB3, 0x42, 0xD3, 0xF2, 0x12,
-    0x14, 0x5B, 0xB9, 0x15, 0x5C, 0xC9, 0x15, 0x5D, 0xD9, 0x9F, 0x83, 0x57, 0xEF, 0x8C, 0x06, 0x65,
-    0x6F, 0x43, 0x26, 0xED, 0x53, 0xC4, 0xF7, 0xF2, 0x82, 0x4F, 0x52, 0x91, 0x55, 0xDF, 0x24, 0xF0,
-    0xCF, 0x21, 0x4F, 0xEC, 0x74, 0x7D, 0x4D, 0x53, 0xDB, 0x74, 0xFD, 0x74, 0x73, 0x40, 0x32, 0xDE,
-    0xA4, 0xBC, 0xE6, 0xBC, 0xBE, 0xD9, 0xE5, 0x3C, 0x11, 0xAC, 0xA2, 0x7B, 0x42, 0xBF, 0xA8, 0x2A,
-    0x0F, 0x04, 0xD9, 0x59, 0x93, 0xCB, 0xB3, 0x76, 0x34, 0x45, 0xFA, 0x8A, 0xE8, 0xCE, 0xDA, 0x6D,
-    0xFE, 0x53, 0x96, 0x47, 0x10, 0xAE, 0x4E, 0x26, 0xF9, 0xA7, 0xC2, 0xA6, 0x6A, 0x9D, 0xAE, 0x76,
-    0x77, 0x30, 0x32, 0xEE, 0x60, 0x02, 0x90, 0x7E, 0x9E, 0x36, 0x11, 0x30, 0x52, 0x9B, 0x4A, 0xC3,
-    0x4B, 0x23, 0xDF, 0xEA, 0x68, 0x61, 0x57, 0x0B, 0x3A, 0x3A, 0xCA, 0x35, 0x75, 0x11, 0xBD, 0x4E,
-    0x2E, 0x97, 0x8F, 0x39, 0xB2, 0x32, 0x72, 0x99, 0x9D, 0xB1, 0xC5, 0xD7, 0x63, 0x60, 0xC4, 0x72,
-    0x74, 0xE5, 0x48, 0xE6, 0x62, 0xBA, 0x7A, 0xE4, 0xA7, 0x85, 0x6E, 0xAE, 0x29, 0xDD, 0x54, 0x4F,
-    0x52, 0x35, 0x59, 0xA6, 0x56, 0x67, 0xEB, 0xF3, 0xB2, 0x42, 0x2F, 0x4B, 0x59, 0x0D, 0x5A, 0x69,
-    0xF0, 0xE9, 0x26, 0x9F, 0x5C, 0x62, 0x87, 0x9E, 0xE1, 0xFD, 0x8B, 0x54, 0xA2, 0x39, 0x3E, 0xEF,
-    0x44, 0xBA, 0x9C, 0xA4, 0x86, 0xBD, 0xD4, 0x14, 0xDB, 0x97, 0xF4, 0x5C, 0x0B, 0x8A, 0xF5, 0xB7,
-    0x92, 0xBE, 0xF4, 0xCD, 0xAC, 0x28, 0x18, 0xCB, 0x57, 0x5A, 0x68, 0xD0, 0xD2, 0xA0, 0x49, 0x5F,
-    0x2B, 0xEA, 0xAB, 0xCC, 0x94, 0x4C, 0xB5, 0x99, 0x98, 0x2F, 0xB9, 0x5C, 0x3F, 0xAF, 0x34, 0x8B,
-    0xE3, 0x38, 0x9E, 0x8A, 0x99, 0xAC, 0x16, 0xCB, 0x1D, 0xF5, 0x7D, 0x11, 0x2B, 0xB8, 0xEF, 0xCD,
-    0xFA, 0xFC, 0x1C, 0x4A, 0xBF, 0x73, 0x72, 0xF6, 0xC6, 0x46, 0xC1, 0x1C, 0x14, 0xA3, 0xF2, 0xCE,
-    0x45, 0xD4, 0xAE, 0x26, 0x98, 0xAD, 0x46, 0x93, 0xF0, 0xFF, 0x5F, 0xAD, 0x57, 0x3F, 0x68, 0x24,
-    0xD7, 0x19, 0xFF, 0xCD, 0xCE, 0x4A, 0xE3, 0xBB, 0x87, 0x76, 0xB6, 0x90, 0x20, 0x10, 0xAD, 0xE6,
-    0x8A, 0x2B, 0x84, 0xD8, 0xBD, 0xBD, 0xE2, 0x02, 0x2A, 0x66, 0x35, 0x03, 0x57, 0xB8, 0x08, 0x21,
-    0x2A, 0x7C, 0x29, 0x0C, 0x21, 0xD7, 0x26, 0x24, 0x58, 0x85, 0x42, 0x16, 0xB3, 0xD2, 0x0E, 0x71,
-    0x91, 0xC2, 0x18, 0xAE, 0x49, 0x97, 0x80, 0xC0, 0x07, 0x36, 0xAA, 0x54, 0x2C, 0x61, 0x09, 0xD2,
-    0xED, 0xCB, 0xA9, 0x48, 0x71, 0x01, 0x0F, 0x97, 0x22, 0x85, 0xC1, 0x9E, 0x10, 0x27, 0x90, 0x98,
-    0xE0, 0x07, 0x5E, 0xC3, 0xC6, 0x48, 0x37, 0xF9, 0x7D, 0x6F, 0x66, 0x57, 0x7B, 0xCA, 0xE5, 0x4E,
-    0x85, 0xDF, 0x9B, 0xEF, 0xCD, 0xEC, 0xF7, 0xFE, 0x7C, 0xBF, 0xF7, 0xDE, 0xF7, 0x6F, 0x01, 0x37,
-    0x46, 0x3A, 0x32, 0x07, 0xE9, 0xFB, 0x38, 0x78, 0x69, 0x95, 0xE2, 0x61, 0x15, 0xD1, 0x64, 0x75,
-    0xDD, 0x5B, 0xC7, 0xCB, 0x2B, 0x36, 0x3E, 0x8C, 0x26, 0x2B, 0xDB, 0x45, 0x1B, 0xE5, 0x39, 0xFA,
-    0xA4, 0x8D, 0xC3, 0x0F, 0xA3, 0xFC, 0x6C, 0xE5, 0xDE, 0xF6, 0xC6, 0x21, 0x0B, 0xBF, 0x59, 0xF8,
-    0x93, 0xE5, 0x05, 0x9C, 0xAE, 0x8F, 0x6F, 0xEA, 0x61, 0x59, 0xB8, 0xF7, 0x46, 0x3B, 0x3F, 0x63,
-    0xCB, 0xEF, 0x7E, 0x3E, 0xF9, 0xC9, 0xE1, 0x43, 0x47, 0xBB, 0x5A, 0xC5, 0x3E, 0xB6, 0xB0, 0x87,
-    0x65, 0xB8, 0xA9, 0xD2, 0x7E, 0x1C, 0xA0, 0x85, 0x4D, 0xD4, 0xE1, 0x66, 0x9E, 0x56, 0x89, 0x8F,
-    0x35, 0x84, 0x1C, 0x1F, 0xB2, 0x34, 0x1B, 0x55, 0x47, 0x1F, 0xB8, 0x7F, 0x48, 0xD5, 0x5D, 0xED,
-    0xAB, 0x64, 0xCB, 0xC7, 0x5E, 0x1B, 0xCB, 0x55, 0xB8, 0x4F, 0x8D, 0x3A, 0xCD, 0xFC, 0xD7, 0x75,
-    0xA0, 0xE2, 0x96, 0x8F, 0xCD, 0x26, 0x67, 0xC3, 0xFD, 0xAB, 0xF1, 0x1E, 0x1B, 0xF5, 0x8E, 0xF6,
-    0xBD, 0x64, 0xCD, 0x47, 0xD8, 0x10, 0x04, 0x61, 0x87, 0xB5, 0x15, 0xB6, 0x9A, 0x6B, 0x8D, 0x5A,
-    0xB5, 0x4A, 0xB1, 0xB2, 0x36, 0x9F, 0x4D, 0x60, 0x07, 0x51, 0x6E, 0xDE, 0xFE, 0x3A, 0x43, 0x06,
-    0xA4, 0x70, 0x34, 0x2A, 0x1A, 0x2E, 0x9F, 0x04, 0x2A, 0x81, 0x1F, 0x83, 0x3B, 0x08, 0x80, 0x36,
-    0x64, 0x12, 0xB1, 0x91, 0x52, 0xC8, 0x00, 0x19, 0x51, 0xF9, 0xE0, 0x10, 0x2E, 0xCF, 0xD6, 0x51,
-    0x0B, 0x90, 0x81, 0xC4, 0x0C, 0xDC, 0x22, 0x75, 0x60, 0x97, 0x5F, 0xDE, 0xAC, 0xCB, 0xEA, 0xD8,
-    0xF8, 0x1D, 0x6F, 0xF0, 0x88, 0x3C, 0x03, 0x38, 0xA4, 0x8A, 0x11, 0x50, 0x6D, 0xDD, 0x37, 0x23,
-    0xD6, 0x7E, 0x16, 0x24, 0xAF, 0x51, 0x48, 0x90, 0xB6, 0x27, 0xD1, 0x79, 0xF4, 0xA0, 0x2B, 0x9D,
-    0x9D, 0xFD, 0xBD, 0xBA, 0xBC, 0x2A, 0xD9, 0xBE, 0x6B, 0xF6, 0xDC, 0xAC, 0x8E, 0xD8, 0x2A, 0x41,
-    0xC7, 0x31, 0x3E, 0xC8, 0x6A, 0xC7, 0x64, 0xB6, 0xB9, 0xE1, 0xB8, 0x4A, 0x91, 0xD1, 0x16, 0xDB,
-    0xD1, 0xF8, 0x00, 0x07, 0x57, 0xD0, 0xA3, 0xFE, 0x04, 0xEB, 0xAF, 0xAC, 0x2C, 0xB9, 0x99, 0xD6,
-    0xEB, 0x78, 0x59, 0xB5, 0x63, 0x33, 0x0D, 0xA9, 0x57, 0x19, 0x3B, 0x32, 0xB8, 0x2D, 0xF5, 0x2A,
-    0x63, 0x0B, 0xC5, 0x9F, 0xA0, 0xC6, 0x57, 0x70, 0x52, 0x68, 0xC4, 0x1A, 0x06, 0x7C, 0x75, 0x6B,
-    0x0E, 0x2F, 0x03, 0x47, 0x35, 0xB9, 0x0B, 0x98, 0x86, 0xD5, 0x34, 0xD3, 0x6C, 0xD9, 0x57, 0xD8,
-    0x7D, 0x84, 0x47, 0x30, 0xBB, 0x5F, 0x7E, 0x71, 0x37, 0x4F, 0x7E, 0xFF, 0xE5, 0x93, 0xBB, 0x4F,
-    0xDE, 0xD1, 0xED, 0x77, 0xBF, 0xEF, 0x7E, 0xC4, 0xC1, 0x6B, 0x0D, 0xF7, 0x13, 0xBE, 0xC2, 0xA6,
-    0xFB, 0x5B, 0xBE, 0x4C, 0xE8, 0xFD, 0xD4, 0x4D, 0x2A, 0x69, 0xA8, 0x9A, 0x2A, 0xF6, 0x92, 0xB0,
-    0x46, 0x45, 0xF2, 0x71, 0xAB, 0x17, 0xEC, 0x51, 0x98, 0x3F, 0x56, 0x63, 0x5C, 0x2E, 0x25, 0x9A,
-    0x19, 0x9E, 0x19, 0xA2, 0x19, 0xA6, 0x19, 0xAA, 0x19, 0xAE, 0x19, 0xB2, 0x19, 0xB6, 0xFD, 0x12,
-    0xDD, 0x2F, 0x73, 0x5D, 0xE0, 0xFB, 0xE3, 0x14, 0xE1, 0x47, 0x95, 0x12, 0xA3, 0x7C, 0x58, 0x94,
-    0x9F, 0x4C, 0x71, 0x12, 0x70, 0x81, 0xF4, 0x87, 0x5E, 0x89, 0xB5, 0x31, 0x45, 0xEB, 0xFF, 0xAC,
-    0xC4, 0x4B, 0x78, 0xB3, 0xE2, 0x18, 0x37, 0xF5, 0xB4, 0x8F, 0x06, 0xFB, 0x6E, 0xF0, 0x97, 0x71,
-    0x9F, 0x66, 0xDE, 0x29, 0x6D, 0x28, 0x6E, 0xD4, 0xB8, 0x34, 0x6E, 0xDC, 0x14, 0xE6, 0xC0, 0x7D,
-    0x4A, 0x9B, 0x39, 0x15, 0xFE, 0xEB, 0x49, 0xA3, 0x46, 0x9B, 0x69, 0x36, 0xD8, 0xB5, 0x8C, 0xDD,
-    0x2E, 0xBF, 0x96, 0x16, 0x76, 0x07, 0xDD, 0x2E, 0x8D, 0x30, 0x6C, 0x34, 0x97, 0x96, 0x16, 0xAE,
-    0xED, 0x0E, 0x8E, 0xBA, 0xDD, 0x41, 0x18, 0x76, 0x9B, 0x21, 0x39, 0x64, 0xAD, 0x2E, 0x5C, 0x7B,
-    0x4D, 0x84, 0xD5, 0xAC, 0x95, 0xFC, 0x02, 0xF8, 0x5B, 0x52, 0x79, 0xAC, 0x3D, 0x47, 0x2F, 0x21,
-    0xDD, 0xA4, 0x55, 0xC5, 0x0E, 0x0D, 0x3A, 0x40, 0x0F, 0x63, 0x52, 0x87, 0x26, 0xE2, 0xC3, 0xC1,
-    0x02, 0x5B, 0x2F, 0xE1, 0x76, 0x32, 0x62, 0xCC, 0xFC, 0xA4, 0xC3, 0x13, 0xAC, 0x17, 0xA0, 0xEB,
-    0xF2, 0x19, 0x62, 0x02, 0x13, 0x60, 0xE0, 0x6A, 0x4F, 0xD3, 0x0A, 0x69, 0x34, 0x34, 0x29, 0x59,
-    0x02, 0x01, 0xED, 0xAF, 0xEE, 0x7D, 0x1A, 0xD7, 0x8F, 0x9D, 0x73, 0x4C, 0x8E, 0x71, 0x86, 0xC9,
-    0x4D, 0xF7, 0x0B, 0xDC, 0x07, 0xFD, 0x80, 0x35, 0x0F, 0x58, 0x41, 0x1C, 0x15, 0x70, 0xE2, 0x7D,
-    0x4F, 0x77, 0x30, 0x71, 0xCC, 0x4D, 0xAE, 0x77, 0x1F, 0x56, 0xC4, 0xD0, 0x4F, 0x30, 0xA1, 0x61,
-    0x8F, 0x03, 0x6E, 0xBE, 0x4D, 0x5B, 0xBC, 0x45, 0xB3, 0xEE, 0x70, 0x42, 0x48, 0xB3, 0xEE, 0xC1,
-    0xD3, 0x5D, 0x22, 0x1B, 0x40, 0xC5, 0x86, 0x18, 0x85, 0xB2, 0xD9, 0x79, 0x76, 0x78, 0x11, 0xFB,
-    0x2A, 0xC5, 0x9E, 0xD2, 0xA8, 0x3B, 0x96, 0xB5, 0x98, 0x27, 0x41, 0x9E, 0x5D, 0xFB, 0xCA, 0x38,
-    0x66, 0xCC, 0xA7, 0x92, 0x19, 0xF7, 0xCF, 0x99, 0xFB, 0xA9, 0x76, 0x9F, 0xC1, 0x1B, 0xC3, 0x4B,
-    0xB9, 0x0E, 0xD4, 0x74, 0x3E, 0x1D, 0x49, 0x64, 0x1D, 0x09, 0xAD, 0x75, 0xE3, 0xF0, 0x21, 0x7D,
-    0xA1, 0x70, 0x6F, 0x03, 0x7A, 0x93, 0xEE, 0xA4, 0xC1, 0x23, 0x54, 0xBF, 0x1E, 0xC2, 0x19, 0x25,
-    0xC0, 0x5B, 0x0F, 0xE0, 0xFE, 0xF3, 0x98, 0x9C, 0x1A, 0xEE, 0xC0, 0xA5, 0xE5, 0x56, 0xE2, 0x19,
-    0x0C, 0x9E, 0x74, 0x13, 0x64, 0x93, 0xEB, 0x14, 0x9E, 0x0A, 0x58, 0xB2, 0x0E, 0xA7, 0x07, 0x9E,
-    0x47, 0xE5, 0x4F, 0x70, 0xBF, 0x87, 0xDA, 0x12, 0x56, 0xAF, 0xE3, 0x8E, 0x9A, 0xD3, 0x5C, 0x55,
-    0x2C, 0x51, 0x6A, 0x64, 0xF1, 0xEA, 0x14, 0xBA, 0xDC, 0xFE, 0x77, 0xA1, 0x30, 0xA3, 0xDC, 0xBE,
-    0x1F, 0xBD, 0x29, 0x6D, 0xE5, 0xE3, 0x62, 0xDA, 0xAF, 0xEC, 0x3C, 0xBF, 0x50, 0xE9, 0xAA, 0xF8,
-    0x3F, 0xEE, 0xC4, 0x41, 0xB7, 0xF0, 0x77, 0xBC, 0xAD, 0x55, 0x38, 0xF1, 0x11, 0x4E, 0x9A, 0x70,
-    0xE9, 0x82, 0xDE, 0xFA, 0xCF, 0x3D, 0x67, 0xF4, 0xF7, 0x6D, 0xE4, 0x3C, 0x81, 0x7C, 0xEC, 0x9C,
-    0xAD, 0x40, 0x99, 0x6D, 0xF5, 0x1E, 0xD0, 0xDA, 0x45, 0x9B, 0x42, 0x87, 0x21, 0x68, 0x6A, 0x38,
-    0xE2, 0x85, 0x7A, 0xDC, 0x68, 0x6B, 0x8A, 0x6E, 0xE3, 0x61, 0x34, 0x5E, 0xD9, 0x86, 0x75, 0xCA,
-    0xE2, 0x2C, 0x9D, 0xD4, 0xFA, 0x58, 0x8B, 0x53, 0x06, 0x75, 0x0B, 0xFF, 0x29, 0x28, 0x64, 0x23,
-    0x6B, 0x85, 0x8B, 0x15, 0x56, 0x25, 0x2D, 0x96, 0xF2, 0x4B, 0x96, 0x35, 0xC6, 0xB6, 0x41, 0x64,
-    0xCA, 0x33, 0x19, 0x5A, 0x9E, 0x91, 0x87, 0x06, 0x5A, 0xC9, 0xE8, 0xB4, 0xC1, 0x0B, 0xE2, 0x52,
-    0x9C, 0xA6, 0xAC, 0x8F, 0x2F, 0xDC, 0xFC, 0x9A, 0x15, 0xC5, 0x79, 0x11, 0x2F, 0x3D, 0x4A, 0xD1,
-    0x4F, 0x6D, 0x2C, 0x28, 0xC6, 0x4D, 0xC3, 0x81, 0x2F, 0xE3, 0xBC, 0x73, 0xA8, 0xB3, 0xE9, 0x99,
-    0x77, 0x2F, 0xAF, 0xCF, 0x79, 0x23, 0x5D, 0xEE, 0x4B, 0x34, 0xE4, 0x1C, 0x54, 0x92, 0x51, 0x1E,
-    0x5F, 0x73, 0xCC, 0x0D, 0xEA, 0x0E, 0x35, 0xD4, 0x9D, 0xB5, 0x86, 0x2A, 0x27, 0x81, 0x45, 0x16,
-    0xA7, 0x7A, 0x81, 0x8F, 0x33, 0x91, 0x87, 0x8A, 0xC6, 0xB3, 0xA6, 0x34, 0x2F, 0x96, 0xFB, 0x56,
-    0x28, 0xDD, 0x0D, 0xE6, 0xD4, 0x69, 0x28, 0x1A, 0xE5, 0x9C, 0x59, 0xA5, 0x1A, 0x5B, 0xBD, 0xAA,
-    0x5F, 0x88, 0x65, 0x4C, 0xCD, 0xB3, 0x40, 0x84, 0x72, 0x24, 0xC6, 0x6D, 0x69, 0x24, 0x8A, 0x99,
-    0x8E, 0x44, 0x32, 0x2E, 0xE6, 0x53, 0xDF, 0x29, 0x6E, 0x28, 0xD2, 0x06, 0x22, 0xCC, 0x88, 0x2C,
-    0x23, 0xA2, 0xB2, 0xE7, 0xE4, 0x10, 0x67, 0x24, 0x78, 0xB6, 0x40, 0xF4, 0x55, 0x38, 0xD3, 0x9E,
-    0xA1, 0xCA, 0x63, 0x4C, 0xA2, 0x3C, 0xC5, 0x78, 0xD9, 0xA5, 0x29, 0xD3, 0xA2, 0x2A, 0xD2, 0xB8,
-    0x72, 0x0A, 0x5C, 0xCF, 0x63, 0x9C, 0x47, 0x10, 0x73, 0x83, 0x27, 0x3C, 0x42, 0x76, 0x29, 0xF9,
-    0xF6, 0x8B, 0x53, 0xAC, 0xCD, 0xEF, 0xA5, 0x23, 0x06, 0xBE, 0x2F, 0xDB, 0xDF, 0x63, 0xE5, 0x2E,
-    0xB8, 0x0F, 0xE6, 0x22, 0x31, 0x53, 0x97, 0x64, 0xE5, 0xDE, 0x8F, 0xE6, 0x2E, 0x7C, 0x50, 0xC4,
-    0x50, 0x51, 0x43, 0x55, 0x5E, 0xBA, 0x84, 0xDB, 0x1E, 0xEC, 0x09, 0xF0, 0xF0, 0x99, 0x63, 0x7C,
-    0x46, 0x7A, 0x86, 0x9D, 0x7E, 0x2E, 0x94, 0x90, 0xF4, 0x0B, 0x28, 0x2E, 0xFA, 0xCF, 0xB0, 0xF3,
-    0xF3, 0x18, 0x3B, 0x3B, 0x78, 0x25, 0xD9, 0x42, 0x4C, 0x2A, 0xCF, 0x75, 0x3B, 0xFF, 0x8B, 0x8E,
-    0xF2, 0x53, 0xDD, 0x27, 0x8D, 0x2E, 0x91, 0xF0, 0xA4, 0x2F, 0xC8, 0x3F, 0xD7, 0x8B, 0x1C, 0x5B,
-    0x4E, 0x43, 0x4E, 0x7B, 0xFF, 0x8A, 0xB8, 0x32, 0xA6, 0x0C, 0xA4, 0x98, 0x94, 0x5C, 0x22, 0xE1,
-    0xE1, 0xEB, 0xFC, 0x9C, 0x63, 0xE7, 0x6E, 0x80, 0x97, 0x62, 0x75, 0x9E, 0xF7, 0xB2, 0x55, 0x2B,
-    0x8D, 0x95, 0xDA, 0x84, 0xFE, 0x9B, 0x70, 0x3E, 0x27, 0xFB, 0x34, 0xB1, 0xD6, 0xE9, 0x88, 0x21,
-    0x88, 0xDD, 0x26, 0x5E, 0xA6, 0xD2, 0x39, 0x87, 0x51, 0x44, 0xA9, 0x59, 0x6D, 0x8A, 0x9E, 0x88,
-    0x87, 0xB1, 0x2E, 0xC6, 0xFA, 0x18, 0xEB, 0x64, 0x9E, 0xF7, 0x32, 0xDF, 0x50, 0x11, 0xEF, 0x06,
-    0x71, 0x6F, 0x10, 0xFF, 0x66, 0x1D, 0x5C, 0xE1, 0xE1, 0xCA, 0x70, 0x68, 0xC9, 0x21, 0xB9, 0x69,
-    0x8A, 0xCA, 0x33, 0x1E, 0xD6, 0xB7, 0x99, 0x31, 0xA9, 0x7F, 0x1C, 0xA0, 0xC5, 0xBE, 0xC9, 0x80,
-    0x97, 0xCD, 0xAB, 0x8D, 0x43, 0xCC, 0x54, 0x7B, 0xAD, 0x24, 0xDA, 0xC4, 0x90, 0x34, 0xE2, 0x82,
-    0x15, 0x9E, 0x98, 0x73, 0xFE, 0x63, 0x78, 0xBF, 0xA1, 0xB6, 0x52, 0x4A, 0x48, 0xAD, 0xA8, 0x8A,
-    0x76, 0x14, 0x9A, 0x7A, 0xEC, 0xEA, 0x33, 0x2F, 0xE9, 0x2A, 0xAB, 0x2D, 0x2D, 0xAB, 0x46, 0x5D,
-    0xEB, 0x63, 0x8C, 0x78, 0x99, 0x79, 0x37, 0xC0, 0x6C, 0x31, 0xF4, 0x92, 0x4D, 0xA5, 0x07, 0xCA,
-    0x5E, 0xDB, 0x1B, 0xD6, 0x01, 0x52, 0x9F, 0x90, 0xDE, 0xFA, 0x41, 0xFE, 0x99, 0xA7, 0xEF, 0xD0,
-    0xB0, 0x72, 0x09, 0x25, 0x8B, 0x0F, 0x99, 0xD8, 0xD2, 0x5D, 0x8D, 0xCE, 0x25, 0x7F, 0x8D, 0x6B,
-    0xCC, 0x1B, 0x99, 0x35, 0xA5, 0x37, 0x88, 0x15, 0x8B, 0xB0, 0x77, 0xA5, 0x94, 0x82, 0xF7, 0xA4,
-    0x05, 0x27, 0xA7, 0xCE, 0xF6, 0x33, 0x49, 0xC3, 0xD3, 0x8D, 0xD1, 0xBF, 0x12, 0xC9, 0x80, 0x2A,
-    0x1F, 0xF7, 0xA0, 0xBE, 0x1B, 0x14, 0xA9, 0xE3, 0xBC, 0x93, 0x1E, 0x8B, 0x31, 0x96, 0x99, 0x1A,
-    0xA6, 0x11, 0x11, 0xC7, 0xF6, 0xB9, 0x79, 0xF9, 0x70, 0x89, 0x63, 0x62, 0xD5, 0x7E, 0x9B, 0x71,
-    0x7C, 0x3C, 0x94, 0x40, 0x2E, 0x91, 0xFC, 0x71, 0xCA, 0x50, 0x7E, 0x57, 0x62, 0xB9, 0x62, 0x30,
-    0x5F, 0x5D, 0x92, 0x68, 0xFE, 0xAD, 0x0B, 0x01, 0xB0, 0x22, 0x2E, 0x09, 0x79, 0x4E, 0x1C, 0xE2,
-    0x63, 0xC9, 0x52, 0x6D, 0x23, 0x42, 0x1F, 0xBC, 0x78, 0xE4, 0x7D, 0x69, 0x26, 0xD3, 0x45, 0xB1,
-    0x5D, 0xB2, 0x7B, 0x62, 0xA1, 0x9C, 0xEB, 0x8C, 0xD7, 0xFF, 0xBF, 0x94, 0x8B, 0xB9, 0x93, 0xF9,
-    0xB9, 0x97, 0x8A, 0x15, 0x7E, 0x81, 0xC5, 0x42, 0x43, 0xEF, 0xB8, 0x37, 0x3F, 0x66, 0x53, 0x7E,
-    0x4A, 0xBA, 0x18, 0x50, 0x79, 0xE9, 0x45, 0x2F, 0xDC, 0xD3, 0x45, 0x59, 0x87, 0xC3, 0x65, 0x5C,
-    0xAE, 0x62, 0x17, 0xF9, 0x5F, 0x2D, 0x9F, 0x9F, 0x6F, 0xCB, 0x32, 0x4A, 0x7F, 0x23, 0x0D, 0xBD,
-    0xA5, 0xD2, 0xAE, 0x09, 0x7D, 0xC9, 0xBF, 0xC4, 0x1A, 0xC3, 0xF9, 0x5E, 0xF9, 0xE7, 0x74, 0x66,
-    0x9B, 0x4B, 0x1D, 0x4E, 0x12, 0x2E, 0xCA, 0x5C, 0x3F, 0xB1, 0x0D, 0xB5, 0xD8, 0x99, 0xF6, 0x72,
-    0x63, 0xD5, 0x28, 0xB2, 0xC1, 0x6F, 0x2B, 0xDA, 0x2A, 0x5F, 0x55, 0xF4, 0x4E, 0xB8, 0x97, 0xDE,
-    0xC9, 0xB1, 0x6D, 0xEA, 0x45, 0x83, 0x51, 0x56, 0x24, 0xC4, 0x57, 0x4A, 0xC4, 0x8D, 0xBE, 0x2D,
-    0xF5, 0x4A, 0x89, 0x78, 0x16, 0xE9, 0x80, 0xFF, 0xC2, 0xAE, 0xE3, 0xD5, 0x63, 0x25, 0x61, 0x6B,
-    0x27, 0x91, 0x9E, 0x62, 0x79, 0xD9, 0x58, 0x1F, 0xDF, 0xD1, 0x07, 0x07, 0x1B, 0xC9, 0x55, 0xD6,
-    0x7D, 0x84, 0xAB, 0xEE, 0xED, 0xBF, 0x75, 0x93, 0x3D, 0x6F, 0xDB, 0x56, 0x14, 0x86, 0x1F, 0x92,
-    0xB6, 0xAE, 0xED, 0x5B, 0xF2, 0x7A, 0x70, 0x06, 0x37, 0xFA, 0x58, 0x5A, 0xC0, 0x70, 0xA9, 0x28,
-    0x03, 0x07, 0x21, 0xA0, 0xA5, 0xBB, 0x65, 0x8C, 0x87, 0x14, 0x08, 0x50, 0x20, 0xCE, 0x5A, 0x34,
-    0x68, 0x35, 0x78, 0x70, 0x83, 0x24, 0x66, 0xF2, 0x0B, 0x9C, 0x39, 0x68, 0xA6, 0xA2, 0xCD, 0x07,
-    0x50, 0x70, 0xD0, 0x10, 0xB4, 0x83, 0xEF, 0x3F, 0x88, 0xB2, 0x27, 0x80, 0x0A, 0x64, 0x48, 0x90,
-    0xC5, 0x83, 0x06, 0xA3, 0xB0, 0xAC, 0x9E, 0x4B, 0x19, 0x75, 0x10, 0xA0, 0x3A, 0xC4, 0x25, 0x45,
-    0x1E, 0xBE, 0xEF, 0xB9, 0xE7, 0x39, 0x64, 0x1B, 0x35, 0xC5, 0x5C, 0xA3, 0xAD, 0xC9, 0x35, 0x5D,
-    0xCD, 0xAE, 0x61, 0x37, 0x61, 0xB7, 0xC1, 0x5E, 0x4E, 0x7F, 0x82, 0x2E, 0x40, 0x07, 0xD4, 0xD3,
-    0x8D, 0xEC, 0xF2, 0xA0, 0x3C, 0x40, 0x7E, 0x72, 0xAB, 0x65, 0xE9, 0xC3, 0x47, 0xA2, 0x57, 0xE8,
-    0x84, 0xF6, 0x4D, 0xFA, 0xB3, 0x82, 0x1C, 0xBA, 0xF0, 0x95, 0x4F, 0x51, 0x33, 0xF4, 0xB7, 0x24,
-    0x10, 0x43, 0x6B, 0xC2, 0xE2, 0x5D, 0x68, 0x54, 0x47, 0xCE, 0x9F, 0x13, 0x3A, 0xA2, 0xB9, 0x40,
-    0x30, 0x43, 0x3D, 0xF2, 0x39, 0x29, 0xF4, 0x4F, 0xD8, 0x6A, 0xB3, 0x27, 0xBE, 0x31, 0xDD, 0x94,
-    0xDE, 0x31, 0xBA, 0xB2, 0x32, 0xB3, 0x62, 0x71, 0xC7, 0xFA, 0x24, 0x11, 0xDF, 0x85, 0x23, 0x42,
-    0x87, 0x2A, 0x30, 0xD0, 0x86, 0x0D, 0xC9, 0xA8, 0xEA, 0x4F, 0x0C, 0x0D, 0x4D, 0x92, 0xA0, 0x8E,
-    0xBD, 0x9D, 0x54, 0x5E, 0x36, 0x38, 0x4A, 0xB9, 0x7F, 0xCC, 0xC5, 0x4A, 0x47, 0x9D, 0xD0, 0x6A,
-    0x92, 0x56, 0x7B, 0xCC, 0x0D, 0x9D, 0x43, 0xF4, 0x2F, 0x95, 0xF1, 0x90, 0x17, 0x63, 0xEE, 0x40,
-    0x60, 0xC3, 0x22, 0x2C, 0xF6, 0xA7, 0xDF, 0xBC, 0xF7, 0x67, 0xD8, 0x9F, 0x6E, 0x3E, 0xF5, 0x2B,
-    0x5C, 0xB8, 0x2E, 0xEB, 0x2A, 0xE3, 0xC8, 0x29, 0x2B, 0x36, 0xF2, 0x52, 0x2E, 0xDB, 0xF4, 0x91,
-    0xCB, 0x75, 0x4C, 0x40, 0xE4, 0x02, 0x17, 0x8C, 0x90, 0x08, 0x24, 0x42, 0x17, 0x15, 0xDA, 0x26,
-    0xF2, 0xAC, 0x84, 0x45, 0xF4, 0x61, 0x61, 0x1E, 0x3A, 0x13, 0xB9, 0x46, 0x54, 0xA4, 0x91, 0x4D,
-    0x95, 0xEF, 0x71, 0xB6, 0xE2, 0x0B, 0x8F, 0x3E, 0x6B, 0xFC, 0xBC, 0xF7, 0x4D, 0xBA, 0xFF, 0x35,
-    0x9E, 0xE0, 0xC8, 0x8C, 0xB7, 0xBC, 0xA4, 0x8F, 0x42, 0x59, 0x2D, 0x3B, 0x5F, 0x86, 0x35, 0xC2,
-    0x99, 0x8D, 0xAE, 0x3A, 0xB1, 0xF6, 0x87, 0xB6, 0xBE, 0x1B, 0x43, 0xA2, 0x91, 0x6F, 0x4C, 0x7F,
-    0xC6, 0xE6, 0x33, 0xD1, 0x37, 0xD3, 0xE5, 0x96, 0xFC, 0x4F, 0x6A, 0x2F, 0x6B, 0x13, 0xA9, 0x26,
-    0xB5, 0xF9, 0x3F, 0x93, 0x9F, 0xBC, 0x28, 0x2D, 0xE8, 0xC1, 0x29, 0xE1, 0x5B, 0x74, 0x4A, 0x23,
-    0xE7, 0xE7, 0x7B, 0x1C, 0xCE, 0xBC, 0x82, 0xAF, 0xF9, 0xD6, 0xFF, 0x03, 0xAC, 0x7F, 0x06, 0xD0,
-    0xAA, 0xD7, 0x15, 0xC0, 0xD5, 0x0A, 0xA0, 0x54, 0x9E, 0x90, 0x25, 0x74, 0xDB, 0x74, 0x3E, 0x05,
-    0xF8, 0x9D, 0x3D, 0xA3, 0xBC, 0x57, 0x01, 0x1C, 0x11, 0x55, 0x00, 0x9B, 0x73, 0x80, 0xAB, 0xA8,
-    0x53, 0x8C, 0xD0, 0x93, 0xF6, 0x1A, 0x0F, 0xD0, 0x4C, 0xBC, 0x82, 0x00, 0x2C, 0xDB, 0xF4, 0x5E,
-    0x9E, 0xE9, 0x08, 0x40, 0xB3, 0x73, 0x0E, 0xB0, 0x75, 0x88, 0x7A, 0x72, 0xA6, 0xF9, 0xC3, 0x98,
-    0x1F, 0x25, 0xC3, 0x0A, 0x04, 0xD7, 0x9F, 0x6E, 0x7E, 0xF0, 0x67, 0xAC, 0x5C, 0x49, 0x13, 0xFA,
-    0xA7, 0x1E, 0xA0, 0xAC, 0x36, 0x72, 0x5A, 0x76, 0x90, 0xCB, 0x10, 0x95, 0x52, 0xC4, 0x3C, 0x4A,
-    0x06, 0x64, 0x02, 0x30, 0x9C, 0xE3, 0x1B, 0xFB, 0xA8, 0x00, 0x56, 0xA8, 0x53, 0xC9, 0x0D, 0xFF,
-    0xB6, 0x66, 0xC7, 0x8A, 0x6D, 0xA6, 0x19, 0x24, 0x94, 0x31, 0x83, 0x9C, 0xDE, 0x1B, 0x96, 0x17,
-    0x08, 0xDF, 0x99, 0xDB, 0x69, 0x9C, 0xDD, 0xDD, 0x3F, 0xF0, 0x32, 0xBD, 0x61, 0xCD, 0x86, 0xBF,
-    0x62, 0x6E, 0xFA, 0x02, 0x33, 0xC5, 0x40, 0x53, 0x26, 0x0C, 0xEA, 0xF2, 0x80, 0x9A, 0x65, 0x39,
-    0xB4, 0x4A, 0x13, 0xDD, 0x16, 0xA0, 0x04, 0x63, 0x54, 0x49, 0x9C, 0xF9, 0x41, 0xDF, 0x5E, 0x90,
-    0x01, 0xFD, 0x7A, 0xE8, 0xF1, 0xB4, 0x4E, 0x86, 0xDD, 0x71, 0xF9, 0x97, 0x5B, 0x47, 0xC9, 0x27,
-    0x46, 0xD5, 0xFB, 0xEF, 0x69, 0x3E, 0xA6, 0xA9, 0x90, 0xA9, 0x91, 0x02, 0x2E, 0x8B, 0x60, 0x4C,
-    0x59, 0xF7, 0x6F, 0x9D, 0xE7, 0xAC, 0xC8, 0xB7, 0x49, 0x5A, 0xB2, 0xE9, 0xE8, 0x3B, 0xB2, 0x11,
-    0x83, 0x92, 0x32, 0x63, 0x7B, 0x4D, 0x72, 0xA4, 0xAB, 0x02, 0xF0, 0x0B, 0xE1, 0xB6, 0x21, 0x1B,
-    0xCD, 0xA4, 0xCE, 0x52, 0xE6, 0x6E, 0x69, 0xAF, 0x69, 0x93, 0x27, 0xBF, 0xBB, 0x86, 0x7A, 0xE0,
-    0x52, 0x1D, 0xBA, 0x6E, 0x12, 0x15, 0x59, 0x1C, 0xD9, 0x41, 0x5D, 0x51, 0x8A, 0xD5, 0xF6, 0xDA,
-    0x22, 0x4B, 0xF7, 0xBC, 0xF5, 0x25, 0x45, 0x3E, 0x1F, 0xD8, 0x4F, 0xAC, 0xC3, 0x2F, 0x51, 0xBF,
-    0x39, 0x55, 0x8C, 0x34, 0xA3, 0x38, 0x70, 0x71, 0x28, 0x42, 0xB6, 0xF3, 0x07, 0xDD, 0x5B, 0xE2,
-    0x20, 0x16, 0x7E, 0x86, 0x6A, 0xEF, 0x9A, 0x37, 0x52, 0x21, 0xAC, 0x46, 0xBE, 0xC9, 0xCF, 0xC7,
-    0xEB, 0x36, 0x60, 0x85, 0xCE, 0x41, 0xDB, 0x9E, 0x97, 0x72, 0x85, 0x75, 0xFE, 0x05, 0x55, 0x56,
-    0xBF, 0x6F, 0xDC, 0x56, 0x12, 0xFE, 0x48, 0x3A, 0x62, 0x20, 0xDA, 0xFB, 0x8C, 0x83, 0x91, 0x5F,
-    0x16, 0xC4, 0x2B, 0x13, 0x58, 0x5A, 0xA6, 0x08, 0x10, 0xC5, 0x26, 0xB5, 0x84, 0x5D, 0xB8, 0x30,
-    0x70, 0x11, 0x02, 0xF9, 0x52, 0xE6, 0xFE, 0x00, 0x03, 0x52, 0xE1, 0x42, 0x07, 0xD0, 0x5E, 0xFA,
-    0x52, 0x5C, 0xEB, 0x26, 0x55, 0x80, 0x20, 0x45, 0x0A, 0x43, 0x0E, 0x20, 0x15, 0x0A, 0xA0, 0x20,
-    0x8A, 0xF6, 0x25, 0x2E, 0x52, 0xB8, 0x38, 0x22, 0xC8, 0x55, 0x39, 0x24, 0x44, 0x2E, 0x2E, 0xCE,
-    0x4E, 0xCE, 0x44, 0x42, 0x3B, 0xEB, 0xBD, 0xDD, 0x7D, 0xF7, 0xCD, 0x23, 0xA5, 0xC8, 0x14, 0x66,
-    0xB4, 0x4B, 0xBE, 0x9D, 0x37, 0xF3, 0xCD, 0xF7, 0xCD, 0x23, 0xC0, 0xAB, 0x5F, 0xC2, 0x1B, 0x55,
-    0x08, 0x34, 0xA0, 0xF8, 0xB5, 0x4B, 0x4B, 0x9C, 0xCB, 0x69, 0xEC, 0x1B, 0x1D, 0x07, 0x29, 0x62,
-    0xDE, 0x4C, 0x68, 0xD1, 0xDA, 0x2A, 0x02, 0x33, 0x05, 0xAE, 0xAF, 0x02, 0x31, 0x1A, 0xDB, 0xA0,
-    0xED, 0xDF, 0x02, 0xCC, 0x90, 0x1F, 0xB6, 0x0B, 0xE0, 0x07, 0x8D, 0x19, 0xA3, 0xD1, 0x33, 0xA5,
-    0x63, 0x2E, 0xE5, 0xFE, 0xB7, 0x27, 0xA0, 0xFE, 0xB4, 0x80, 0x68, 0x6E, 0x09, 0x49, 0x7C, 0x15,
-    0xF1, 0x6B, 0xDB, 0xC8, 0xB8, 0x6C, 0x97, 0xCB, 0x3E, 0xBD, 0x93, 0xA3, 0xFF, 0x55, 0x8A, 0xDE,
-    0x25, 0xA0, 0x77, 0x02, 0x08, 0xA7, 0x43, 0x84, 0xA6, 0x06, 0x97, 0x81, 0xCB, 0x70, 0x72, 0x05,
-    0xCD, 0x15, 0x18, 0x2E, 0x34, 0x85, 0x33, 0x44, 0xEE, 0x95, 0xCC, 0x31, 0xE7, 0xDA, 0x83, 0x3C,
-    0x83, 0x88, 0xF9, 0x0D, 0x90, 0x29, 0x4D, 0x4B, 0x91, 0xF1, 0x41, 0xB6, 0x48, 0x63, 0x6E, 0x09,
-    0x2D, 0xDA, 0xE3, 0x7A, 0xC6, 0x74, 0x4D, 0xD5, 0xC4, 0x92, 0x0D, 0x22, 0x5A, 0x82, 0xA7, 0x6B,
-    0xD8, 0xA1, 0xD5, 0xB4, 0xD1, 0x26, 0x1C, 0x63, 0xE0, 0x3C, 0xBA, 0x0C, 0x97, 0xD5, 0x78, 0xC4,
-    0xA4, 0x67, 0x52, 0x6E, 0xCF, 0x34, 0xB8, 0x2F, 0xB7, 0xB0, 0x18, 0x35, 0x57, 0x5F, 0x02, 0x8F,
-    0xE1, 0x17, 0xC7, 0x0E, 0x1F, 0x48, 0x62, 0xF3, 0xFC, 0x1D, 0x63, 0xF8, 0x82, 0x15, 0xE3, 0x3B,
-    0xD7, 0x56, 0x99, 0xC3, 0x18, 0xCF, 0x3C, 0x21, 0x6E, 0x4C, 0xC3, 0x65, 0x0D, 0x7E, 0x2E, 0x71,
-    0x4D, 0x2E, 0xC6, 0x5F, 0x38, 0xE2, 0xE0, 0x59, 0x2F, 0x51, 0xD2, 0x5B, 0xF3, 0x1F, 0xC1, 0xFD,
-    0xCA, 0xF4, 0x0C, 0xBC, 0xEF, 0xDE, 0x99, 0x84, 0xA9, 0x57, 0x07, 0x95, 0x4A, 0xFD, 0x32, 0x28,
-    0xE8, 0xB5, 0xD2, 0x2A, 0x0D, 0xF2, 0x30, 0x55, 0xDC, 0xB6, 0xC7, 0x2D, 0x15, 0x06, 0x44, 0x23,
-    0xC4, 0x94, 0x65, 0x75, 0xBD, 0x09, 0x37, 0x4D, 0xFC, 0x8C, 0x3E, 0xEE, 0xC4, 0xE0, 0xFF, 0x85,
-    0x0C, 0xBB, 0xC0, 0x55, 0x9B, 0xB2, 0x85, 0xC1, 0xD1, 0xF6, 0x73, 0xC6, 0x6F, 0x9F, 0xA3, 0xC4,
-    0xC4, 0x29, 0x31, 0x75, 0x0B, 0xE7, 0xBF, 0x9E, 0x76, 0xBF, 0xF7, 0xF4, 0xE9, 0x87, 0xB7, 0x7F,
-    0x8C, 0x8C, 0xA9, 0xBC, 0xBB, 0x97, 0xE0, 0xFF, 0xFD, 0x4D, 0xD6, 0x6E, 0xCA, 0xB5, 0xDB, 0x0F,
-    0x6F, 0x2A, 0xEF, 0x67, 0x74, 0xBC, 0x9F, 0x30, 0xEF, 0x8D, 0xB1, 0xE8, 0x8E, 0x11, 0xBB, 0x43,
-    0xC4, 0x0E, 0x41, 0x1B, 0xDC, 0x64, 0x30, 0x16, 0xC8, 0xE8, 0x7D, 0x71, 0xAC, 0xC0, 0x29, 0x09,
-    0x88, 0x5B, 0xAA, 0x8B, 0xF0, 0x0A, 0xA5, 0x08, 0x63, 0xD4, 0x5D, 0xF1, 0xF5, 0xBE, 0xA9, 0x02,
-    0x53, 0x5F, 0x4B, 0x03, 0x93, 0xC6, 0x82, 0xD8, 0x86, 0x14, 0xBB, 0x23, 0x98, 0xD5, 0xD2, 0xCD,
-    0x4A, 0xBA, 0x52, 0x09, 0x64, 0x23, 0x3E, 0xC7, 0x20, 0x6D, 0x50, 0x1E, 0x94, 0xE2, 0xCD, 0xC4,
-    0xA6, 0xDF, 0x93, 0xF4, 0x65, 0x07, 0xD9, 0xC2, 0x25, 0x48, 0x85, 0x0A, 0x09, 0x52, 0x11, 0x2E,
-    0xBF, 0xC8, 0x5D, 0x96, 0x33, 0x42, 0xFB, 0xCF, 0x71, 0x26, 0x9C, 0x29, 0x19, 0x4C, 0x3D, 0xCC,
-    0xA3, 0x14, 0xCA, 0xD7, 0x41, 0x09, 0xE5, 0x69, 0x26, 0x1B, 0x7A, 0x24, 0x1F, 0xBA, 0xEC, 0xED,
-    0x06, 0x12, 0x76, 0x42, 0x4A, 0xF8, 0xF5, 0x81, 0x6C, 0xFA, 0x8B, 0xD1, 0x6D, 0x5B, 0xFD, 0x3C,
-    0x76, 0x0A, 0x3F, 0xCF, 0x3C, 0xED, 0xE7, 0x63, 0xBA, 0xF4, 0xA7, 0x20, 0x0D, 0xCE, 0xFF, 0x4B,
-    0x21, 0xB8, 0xF0, 0x71, 0x07, 0xC1, 0xC5, 0x2B, 0x8B, 0x08, 0x82, 0x85, 0x58, 0x1A, 0x68, 0xB0,
-    0x36, 0xD8, 0x1F, 0x41, 0xC5, 0x71, 0x05, 0xB5, 0xF4, 0x46, 0x01, 0xB5, 0x7E, 0x56, 0xA3, 0x53,
-    0x9D, 0xCB, 0xA1, 0x8A, 0x1E, 0xB7, 0xD6, 0x3D, 0x21, 0xEC, 0xB2, 0x30, 0x47, 0x28, 0xD7, 0x9F,
-    0xA6, 0x01, 0x6B, 0x31, 0x05, 0x2B, 0xA8, 0x6C, 0x1D, 0x15, 0x76, 0xE6, 0x59, 0xCB, 0xCA, 0xD5,
-    0x45, 0xD6, 0x52, 0xED, 0xC4, 0xF0, 0xBE, 0x28, 0xC5, 0x7F, 0x59, 0x56, 0x19, 0xFC, 0xBF, 0x15,
-    0xD5, 0x06, 0xFC, 0x77, 0x79, 0x8B, 0x9B, 0x7F, 0x59, 0x70, 0x13, 0xFF, 0x5D, 0x4D, 0x1F, 0x5C,
-    0xF8, 0xA2, 0xC4, 0xBC, 0x72, 0xCE, 0x17, 0x58, 0x14, 0x78, 0x45, 0xA0, 0x21, 0xA5, 0x1A, 0x6E,
-    0x0A, 0xE7, 0x22, 0xF3, 0x63, 0xDB, 0x60, 0x5E, 0xBB, 0x02, 0x1E, 0xE9, 0x2B, 0xB4, 0x6E, 0x08,
-    0x30, 0x7B, 0x83, 0x6E, 0xF0, 0xB8, 0x84, 0x3B, 0x8C, 0x0A, 0xB2, 0x97, 0xDA, 0x51, 0x39, 0xD5,
-    0xAF, 0x84, 0xE2, 0x21, 0x28, 0xF9, 0xAE, 0x74, 0x47, 0x18, 0xC5, 0x8E, 0xF4, 0x44, 0x69, 0xD7,
-    0x29, 0x25, 0x67, 0x22, 0x80, 0x5E, 0x21, 0x3E, 0x93, 0x18, 0x47, 0xAE, 0xBE, 0x11, 0x0E, 0x1C,
-    0x08, 0xCC, 0xAA, 0xC2, 0x23, 0x1B, 0x54, 0x71, 0x0A, 0x51, 0x9B, 0x04, 0x87, 0x83, 0xB0, 0x3F,
-    0x14, 0xB1, 0xDC, 0x5B, 0x69, 0x55, 0x55, 0x58, 0x93, 0xCF, 0xD6, 0xD8, 0x65, 0x21, 0x13, 0xCC,
-    0x3E, 0xF7, 0x9A, 0x34, 0xA1, 0x62, 0xA1, 0xC5, 0x06, 0x28, 0xE2, 0x5D, 0x97, 0xF1, 0x6B, 0x19,
-    0x51, 0x55, 0x24, 0x0C, 0xE0, 0x2D, 0xF7, 0x07, 0xDE, 0xF2, 0xBE, 0xB5, 0xB1, 0xD8, 0xBB, 0x33,
-    0x66, 0x94, 0xC3, 0xFF, 0x9A, 0x61, 0x02, 0xA9, 0x4F, 0xA5, 0xB5, 0x68, 0x49, 0xF4, 0x2F, 0xB4,
-    0x0A, 0x25, 0x52, 0x5B, 0x11, 0x07, 0x48, 0x48, 0x4E, 0x93, 0xE3, 0xC5, 0xEF, 0xBA, 0x7D, 0x96,
-    0x8F, 0xB9, 0xB8, 0xC7, 0xDF, 0xB3, 0x6F, 0x0E, 0xD9, 0xAC, 0xC6, 0xDB, 0x48, 0x06, 0x1C, 0x02,
-    0x84, 0xD4, 0x65, 0xB0, 0x90, 0x51, 0xF7, 0x69, 0x6F, 0x71, 0x89, 0xD7, 0xCE, 0x86, 0xE6, 0x3A,
-    0x6D, 0x44, 0x01, 0x3D, 0x2B, 0x81, 0x53, 0x10, 0x0D, 0x60, 0x45, 0xC9, 0xD3, 0x4A, 0xD6, 0xA1,
-    0x12, 0xC5, 0x3B, 0xA5, 0x63, 0xB5, 0x2F, 0xDE, 0x2B, 0xAC, 0xD7, 0x4E, 0xE5, 0xC0, 0xD7, 0x6E,
-    0xD9, 0xAF, 0xFC, 0xDC, 0x2B, 0x9E, 0x8C, 0x49, 0xB3, 0x3B, 0x65, 0xA2, 0x52, 0x75, 0x41, 0xB3,
-    0x9F, 0xD7, 0x7D, 0x1D, 0x87, 0x33, 0xE3, 0x20, 0xDF, 0x8B, 0x4C, 0xA9, 0x1E, 0xD4, 0xD1, 0x13,
-    0x28, 0x49, 0xA7, 0x1D, 0x40, 0xF3, 0xD6, 0x2F, 0x5A, 0x9F, 0xB4, 0x68, 0x1D, 0x36, 0xDD, 0xD2,
-    0x98, 0xA8, 0x2B, 0x82, 0x49, 0x82, 0x70, 0x12, 0xD0, 0xF8, 0x8B, 0xA5, 0x05, 0xDA, 0x12, 0x3F,
-    0x73, 0xFF, 0x44, 0x4A, 0x65, 0x96, 0x51, 0x33, 0x4B, 0x5F, 0x65, 0x8F, 0x2B, 0x03, 0xF7, 0x7F,
-    0xFF, 0x80, 0xBF, 0xF5, 0x26, 0xD4, 0x7C, 0x90, 0x2E, 0x1E, 0x27, 0x17, 0x70, 0x60, 0x02, 0x55,
-    0x28, 0xDD, 0xA7, 0x11, 0x8E, 0xFE, 0x50, 0xBA, 0x9E, 0x4A, 0x53, 0x9E, 0x79, 0xF4, 0xF6, 0x37,
-    0xCA, 0x98, 0xB1, 0x53, 0x72, 0x82, 0xD0, 0xCE, 0x8C, 0xB6, 0xCA, 0x33, 0xF7, 0xB7, 0x3E, 0xF4,
-    0xF5, 0x32, 0x82, 0x07, 0x63, 0x8A, 0xB1, 0x78, 0x6A, 0x40, 0x76, 0xDB, 0x94, 0x9B, 0x84, 0x39,
-    0xFA, 0x5D, 0x3B, 0x95, 0x27, 0x98, 0xC6, 0x2F, 0xB8, 0xF5, 0x12, 0x29, 0x79, 0x95, 0x4D, 0x5A,
-    0xE7, 0xDA, 0x6D, 0x66, 0x57, 0x72, 0xED, 0xBD, 0xD5, 0xC4, 0x31, 0x75, 0xEC, 0xDE, 0xAF, 0x63,
-    0x4F, 0x57, 0x89, 0x77, 0xA3, 0x5A, 0xF6, 0xCE, 0x97, 0x91, 0xCF, 0xE9, 0x72, 0x97, 0x0A, 0x35,
-    0x03, 0x8D, 0xC1, 0x34, 0xB5, 0x98, 0xCC, 0xD9, 0x21, 0x2A, 0xA3, 0x34, 0x94, 0x16, 0x48, 0x85,
-    0xF8, 0x4C, 0xDC, 0xAF, 0x74, 0xEE, 0xBF, 0x09, 0xA0, 0x90, 0x84, 0x03, 0xDA, 0x68, 0x67, 0xED,
-    0xCF, 0x8F, 0x52, 0x2C, 0xB3, 0x19, 0x33, 0xFB, 0x9B, 0x54, 0xB1, 0xE8, 0x99, 0x5F, 0x2A, 0x69,
-    0x6F, 0x2D, 0xE7, 0xE1, 0x8E, 0xA4, 0xBD, 0x2B, 0x08, 0xED, 0x4A, 0xC2, 0x2D, 0xB4, 0xA7, 0xA7,
-    0xD2, 0x6C, 0x8D, 0x53, 0x5E, 0x25, 0x54, 0x6C, 0x44, 0xE5, 0x54, 0xB3, 0x9B, 0xB7, 0x87, 0xE4,
-    0xD5, 0x10, 0x01, 0x11, 0x1A, 0x08, 0xBB, 0x4D, 0x15, 0xDD, 0xDF, 0xBC, 0x29, 0x15, 0x47, 0x6D,
-    0xE5, 0x61, 0x7E, 0x0C, 0xC1, 0x68, 0xCC, 0x82, 0x87, 0x6D, 0x97, 0x6C, 0xF5, 0x25, 0xAB, 0x1F,
-    0xB2, 0xFA, 0x3F, 0xBA, 0x95, 0x54, 0xFF, 0xDA, 0x53, 0xD5, 0x2F, 0x0B, 0x02, 0x4E, 0xC1, 0x79,
-    0xAB, 0xAD, 0x25, 0x3C, 0x27, 0x96, 0xBD, 0x14, 0x91, 0xCF, 0xF9, 0x72, 0x17, 0xF6, 0x9C, 0x71,
-    0x64, 0x3C, 0x1E, 0x54, 0x7F, 0xD2, 0x01, 0xD6, 0x03, 0x3B, 0x88, 0xDD, 0x47, 0x6B, 0xAB, 0xE4,
-    0xF9, 0xD8, 0xBF, 0x77, 0x6D, 0xC5, 0xD3, 0x31, 0xD9, 0x96, 0x51, 0xE4, 0xBB, 0xB4, 0x9A, 0xA5,
-    0x71, 0x90, 0x30, 0xF5, 0x90, 0x25, 0x74, 0x49, 0x51, 0x19, 0x87, 0xB1, 0x33, 0xCA, 0x63, 0x0C,
-    0xF2, 0x23, 0xF2, 0x96, 0xD3, 0x57, 0x8E, 0x73, 0xF0, 0x9C, 0xC8, 0x9B, 0x72, 0xDD, 0x43, 0x67,
-    0x15, 0x2B, 0x02, 0x69, 0x81, 0x0E, 0xEC, 0x77, 0xAB, 0xDE, 0x1E, 0xE6, 0x5F, 0x79, 0x39, 0xC4,
-    0xB9, 0xF7, 0xDF, 0x0F, 0xF1, 0xFA, 0xC5, 0x8B, 0x5D, 0xF4, 0xFC, 0xD9, 0x0C, 0xE1, 0x07, 0xAA,
-    0x46, 0x47, 0x4E, 0xBD, 0xE3, 0x27, 0x98, 0xEB, 0xF1, 0xB9, 0x39, 0x39, 0x93, 0x8D, 0x8E, 0xCC,
-    0xE1, 0xF8, 0x15, 0xE0, 0xD2, 0xBE, 0x4C, 0xAB, 0x03, 0x8E, 0x64, 0xED, 0x18, 0xAB, 0x0F, 0xA0,
-    0x6E, 0xCC, 0x3D, 0x22, 0x44, 0x5F, 0x4B, 0xA6, 0x86, 0x47, 0x8B, 0x69, 0x90, 0xE6, 0x28, 0x7B,
-    0x69, 0xEB, 0x3F, 0x8C, 0x35, 0x69, 0xD8, 0xC0, 0x0E, 0x3C, 0x37, 0x69, 0x0E, 0x93, 0xAC, 0xA5,
-    0x5F, 0xB7, 0xD5, 0x92, 0x1C, 0xEC, 0x87, 0x23, 0xA8, 0x3A, 0xBA, 0xE7, 0x0C, 0xF0, 0x84, 0x0A,
-    0x22, 0x7D, 0x43, 0xEE, 0x7D, 0xB6, 0xBA, 0x42, 0x79, 0xD4, 0x56, 0x01, 0x7D, 0xAE, 0x7F, 0x5B,
-    0xBB, 0x85, 0xAF, 0x3D, 0x1D, 0xE4, 0x3C, 0x92, 0x53, 0xFE, 0xB1, 0xE6, 0x90, 0x93, 0x23, 0x92,
-    0x7E, 0x4E, 0xD3, 0x43, 0x04, 0x15, 0x73, 0x4C, 0x18, 0x77, 0x9D, 0x47, 0xF0, 0x36, 0xED, 0xAF,
-    0x9F, 0x5C, 0x96, 0x1A, 0xEB, 0x99, 0xD1, 0xE6, 0x1E, 0x7B, 0xDB, 0x61, 0x6F, 0x67, 0xDD, 0x3B,
-    0xCF, 0xCE, 0x7A, 0xDF, 0x0F, 0x3A, 0xDE, 0xE3, 0xDF, 0x3E, 0xF6, 0xF4, 0x8D, 0x5A, 0xC6, 0xC7,
-    0x39, 0xDA, 0x1F, 0xE4, 0xF0, 0x9B, 0xEE, 0x35, 0x72, 0xB3, 0x97, 0x23, 0x77, 0xEC, 0x5C, 0x69,
-    0x9C, 0xC0, 0x26, 0xD5, 0xE3, 0x9D, 0xC2, 0x42, 0x99, 0x62, 0xB0, 0xB5, 0x55, 0xB8, 0x75, 0xE8,
-    0x72, 0xFA, 0x84, 0xA8, 0x7C, 0xDD, 0x25, 0x13, 0xF2, 0x84, 0x2E, 0x8D, 0xE5, 0xC8, 0x89, 0xDD,
-    0x2A, 0x14, 0xF0, 0xBA, 0x12, 0x21, 0x91, 0x08, 0x89, 0x8D, 0xA0, 0x38, 0xC5, 0x64, 0x42, 0x77,
-    0xB1, 0x4F, 0x78, 0xF8, 0x5E, 0x45, 0x1C, 0xD9, 0x30, 0x39, 0x2E, 0x89, 0x7C, 0x86, 0xFA, 0xF9,
-    0x9A, 0xE1, 0x8B, 0xD0, 0xDC, 0x3A, 0x44, 0x5E, 0x06, 0xF8, 0x99, 0xFB, 0x79, 0x83, 0x7E, 0xFB,
-    0x7A, 0xC4, 0x0C, 0x8F, 0xD1, 0x75, 0xE6, 0x0E, 0x9C, 0x0C, 0x73, 0x57, 0x3A, 0xAE, 0xC6, 0x67,
-    0xF9, 0xB6, 0xB7, 0xB4, 0x0E, 0xEC, 0xC9, 0xFB, 0x5D, 0x4D, 0xE7, 0x56, 0xEB, 0xD4, 0x62, 0xF1,
-    0x97, 0xFC, 0x48, 0x31, 0x47, 0x5C, 0x81, 0xB6, 0x23, 0xB0, 0xD5, 0xF3, 0x2C, 0xB7, 0xAA, 0x12,
-    0x57, 0x36, 0xFB, 0x04, 0xDC, 0xA1, 0xB3, 0x60, 0xDF, 0x3F, 0x1D, 0xEA, 0xC0, 0x2D, 0xA3, 0x94,
-    0x33, 0x21, 0x6F, 0x9A, 0x12, 0xE4, 0x7C, 0x4B, 0x82, 0x7A, 0xEF, 0x73, 0xD6, 0xC6, 0x17, 0x80,
-    0xDB, 0xB5, 0xAD, 0xA8, 0xCB, 0xEA, 0x12, 0xAA, 0x8A, 0x6F, 0x49, 0x90, 0xF7, 0xA3, 0x8C, 0x2F,
-    0x96, 0x03, 0x3E, 0x37, 0x6C, 0x99, 0x84, 0x3A, 0xC1, 0xF9, 0x78, 0xEC, 0x24, 0xF0, 0x7F, 0xD3,
-    0x5A, 0x61, 0xFF, 0x43, 0x34, 0x00, 0x00, 0xBD, 0x93, 0x31, 0x6A, 0xC3, 0x40, 0x10, 0x45, 0xBF,
-    0xAD, 0x42, 0xC5, 0x16, 0x3A, 0x80, 0x21, 0x3A, 0x41, 0xEC, 0x0B, 0xC8, 0x64, 0x0F, 0x11, 0x70,
-    0x91, 0x22, 0x7D, 0xCE, 0x20, 0x62, 0x1D, 0x21, 0x45, 0x0E, 0x90, 0x43, 0xA4, 0x50, 0x65, 0xE9,
-    0x08, 0x0A, 0x44, 0xBD, 0x70, 0x2E, 0xB0, 0x06, 0x15, 0x21, 0x60, 0x6F, 0xE6, 0xCF, 0xAE, 0x83,
-    0x0D, 0x81, 0x84, 0x14, 0xD1, 0x87, 0x6F, 0x61, 0x46, 0x3B, 0x8F, 0xF9, 0x3B, 0x40, 0x78, 0x16,
-    0x6E, 0xE1, 0x80, 0xCD, 0x70, 0x18, 0x30, 0x71, 0x13, 0x79, 0x9D, 0x0E, 0xD3, 0x01, 0x48, 0xBA,
-    0xA4, 0x03, 0xD2, 0x7E, 0xD5, 0x03, 0x6B, 0xEF, 0x3D, 0x30, 0xEB, 0x6F, 0x1E, 0x01, 0x63, 0x8D,
-    0x05, 0x32, 0x9B, 0xD1, 0x45, 0x40, 0x2E, 0x02, 0xE6, 0x22, 0x60, 0x29, 0x02, 0x0A, 0xD1, 0xD1,
-    0x4B, 0x11, 0x50, 0x8B, 0x80, 0x51, 0x04, 0x38, 0xD1, 0x37, 0xAD, 0x7C, 0xEB, 0x5B, 0xE1, 0x10,
-    0x7D, 0x3D, 0x0B, 0x27, 0x4D, 0x36, 0x6F, 0x04, 0x4B, 0x06, 0x29, 0x86, 0x05, 0x2B, 0x85, 0x6A,
-    0x62, 0x05, 0xCA, 0x54, 0x98, 0xBD, 0x0A, 0x87, 0xB1, 0x19, 0x89, 0x72, 0x02, 0xCD, 0xC9, 0xB3,
-    0x24, 0x4E, 0x41, 0x9A, 0x82, 0x18, 0x25, 0xAD, 0x26, 0xCA, 0x48, 0x12, 0x47, 0x10, 0x47, 0x0E,
-    0x62, 0x80, 0x14, 0x40, 0x38, 0x98, 0x04, 0xA7, 0x00, 0x58, 0xEC, 0x38, 0x9B, 0xAD, 0x12, 0x74,
-    0x52, 0x98, 0xB4, 0x52, 0x98, 0xB6, 0x42, 0x20, 0xCD, 0x85, 0xC0, 0xFE, 0x99, 0x60, 0xF2, 0x4B,
-    0x82, 0x10, 0x90, 0xD5, 0x84, 0xB6, 0x21, 0x22, 0x9D, 0x45, 0x9C, 0x46, 0x9C, 0xC7, 0x2A, 0x4C,
-    0xC4, 0xEB, 0x4C, 0x24, 0x27, 0x65, 0x8A, 0x54, 0x91, 0x2B, 0x92, 0xE5, 0xB8, 0x0C, 0x61, 0x15,
-    0x21, 0xAD, 0x22, 0x04, 0x55, 0x86, 0x9F, 0x3A, 0x04, 0x36, 0x86, 0xC4, 0x5C, 0x88, 0xCC, 0xC5,
-    0xCC, 0x62, 0x68, 0x31, 0xB5, 0x63, 0xF3, 0x90, 0xDB, 0x79, 0x70, 0x81, 0x7A, 0xE7, 0xCE, 0xA8,
-    0x3B, 0xFD, 0x50, 0x27, 0x18, 0x67, 0xB8, 0xEA, 0xD3, 0x2A, 0x50, 0xDB, 0x1F, 0xA9, 0x97, 0xFF,
-    0x41, 0x6D, 0xF6, 0xF4, 0xAB, 0xA6, 0xE2, 0x95, 0xD5, 0x3A, 0x27, 0xBC, 0x0C, 0x5F, 0xDD, 0xF4,
-    0x3C, 0xA6, 0xF1, 0x3C, 0x25, 0x97, 0x5D, 0x48, 0x5A, 0xDE, 0xFF, 0x54, 0xDD, 0x54, 0xDC, 0x02,
-    0x63, 0xB9, 0x05, 0x99, 0xE5, 0x16, 0x64, 0x7A, 0xFF, 0x73, 0xBD, 0xFF, 0x73, 0xF5, 0xA5, 0x7A,
-    0x81, 0xFB, 0x27, 0x3A, 0xD7, 0xAE, 0xD4, 0xB6, 0xB5, 0x3A, 0x77, 0x03, 0x53, 0xA7, 0x04, 0x9D,
-    0xBA, 0x3D, 0x41, 0xCB, 0x89, 0xB6, 0x6E, 0xE4, 0xAF, 0x51, 0x66, 0x17, 0xB8, 0x06, 0x79, 0xBB,
-    0x73, 0x79, 0x9F, 0x78, 0xE7, 0x0F, 0xD9, 0xCB, 0xD3, 0xED, 0x75, 0x16, 0xD7, 0xF1, 0x02, 0x59,
-    0x25, 0x4D, 0xD3, 0x91, 0x73, 0x3B, 0x10, 0x24, 0xAF, 0x4A, 0xA2, 0xD6, 0xA4, 0x7E, 0x86, 0x35,
-    0xED, 0x3B, 0x3E, 0x1A, 0xBB, 0x79, 0x68, 0xF6, 0xB1, 0x1B, 0x3E, 0x01, 0x45, 0x8D, 0xC1, 0x0D,
-    0x80, 0x30, 0x0C, 0x03, 0x23, 0xF2, 0xE4, 0x91, 0x01, 0xD8, 0x85, 0xC2, 0x64, 0x88, 0xC9, 0x28,
-    0x1B, 0x74, 0x04, 0x46, 0xE8, 0x07, 0x09, 0xA1, 0x8A, 0x23, 0x11, 0x0F, 0x22, 0xC7, 0x0F, 0x5B,
-    0xB6, 0x45, 0x54, 0xE2, 0x2C, 0x07, 0xA7, 0x1A, 0x4C, 0x73, 0x52, 0x08, 0x79, 0xEA, 0xDD, 0x18,
-    0xA5, 0x73, 0x83, 0x61, 0x6E, 0x21, 0xEF, 0x88, 0xC1, 0x4A, 0x4E, 0x3C, 0x4A, 0xDD, 0xB8, 0x8C,
-    0x2B, 0x51, 0x1D, 0xC6, 0xB1, 0x91, 0x95, 0x33, 0xC2, 0x10, 0x45, 0xE9, 0xC4, 0xB3, 0x56, 0x16,
-    0xEF, 0xD1, 0xB2, 0x44, 0xFF, 0xDD, 0xFE, 0xAD, 0x6F, 0xB7, 0xF3, 0x7F, 0x01,
+static const uint8_t notosans_12_italicBitmaps[28289] = {
+    0xB5, 0x58, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0xA5, 0x10, 0x09, 0x01, 0xCF, 0x15, 0x16,
+    0x10, 0xE8, 0xE0, 0xA3, 0x8B, 0x14, 0x81, 0xE2, 0x5B, 0xB6, 0x57, 0x90, 0xBB, 0x03, 0x04, 0x48,
+    0x0A, 0x17, 0xDE, 0x22, 0x07, 0x15, 0x2E, 0x94, 0x32, 0x08, 0x10, 0xA8, 0xDD, 0x62, 0xF7, 0x96,
+    0x71, 0x0A, 0x17, 0x06, 0x6C, 0x17, 0x16, 0xD2, 0xC5, 0x2A, 0x54, 0x28, 0x27, 0x04, 0x72, 0x80,
+    0x2B, 0x08, 0x78, 0x75, 0x4B, 0x39, 0x85, 0x8A, 0x14, 0x61, 0x02, 0x0B, 0x2A, 0x82, 0x28, 0x8C,
+    0x2D, 0x07, 0x01, 0x8C, 0x58, 0x63, 0x84, 0x86, 0xD7, 0xD1, 0xDD, 0x32, 0xDF, 0x7B, 0x33, 0x7B,
+    0xB7, 0x7B, 0x3A, 0x49, 0x46, 0x82, 0xAC, 0x6E, 0xA8, 0x25, 0x39, 0x3F, 0xDF, 0x7C, 0xEF, 0xBD,
+    0xEF, 0xBD, 0x59, 0x2A, 0x68, 0x46, 0x8D, 0x67, 0x7C, 0x13, 0xD4, 0x41, 0x15, 0x94, 0x61, 0x19,
+    0xE6, 0x91, 0x56, 0xA4, 0x88, 0x3F, 0x19, 0xED, 0xD0, 0x88, 0xD6, 0x88, 0x9E, 0x23, 0x4A, 0x89,
+    0x1A, 0xF2, 0x6B, 0x0A, 0x4A, 0x52, 0x9A, 0x62, 0xA2, 0x4D, 0x79, 0x36, 0x24, 0x2A, 0xF8, 0x0D,
+    0x99, 0xD5, 0x3F, 0x3C, 0xD9, 0x23, 0x1A, 0x48, 0x9F, 0x17, 0x30, 0xD5, 0x16, 0xD1, 0x4B, 0xF2,
+    0x0D, 0x53, 0xA9, 0xD3, 0xFE, 0x30, 0x63, 0x87, 0x57, 0xE4, 0x01, 0x05, 0x4F, 0x81, 0xB5, 0xC2,
+    0x92, 0xDF, 0x6C, 0xCA, 0x03, 0x1F, 0xF8, 0xA2, 0x52, 0xE9, 0x0D, 0xEE, 0x40, 0x17, 0xAE, 0xF7,
+    0x66, 0xE7, 0xFA, 0x94, 0xED, 0x8C, 0xD6, 0x04, 0x69, 0x82, 0xF5, 0xDA, 0x43, 0x0A, 0x4C, 0x42,
+    0xE8, 0x04, 0x84, 0x4A, 0xC7, 0xB8, 0x76, 0xD1, 0x32, 0xB4, 0x14, 0xF3, 0x0C, 0xB1, 0xC4, 0x00,
+    0xAD, 0xC0, 0x3A, 0x05, 0x16, 0x2A, 0xF0, 0x64, 0x08, 0x9C, 0x59, 0x60, 0x28, 0xB9, 0x59, 0x52,
+    0x34, 0x27, 0xFB, 0x01, 0x92, 0x39, 0xDF, 0xF5, 0x46, 0xB4, 0xF5, 0xD8, 0x0E, 0x3D, 0x01, 0x16,
+    0x54, 0xCC, 0x03, 0xE0, 0x85, 0x39, 0x45, 0x39, 0x13, 0x22, 0x1F, 0x9E, 0x62, 0xDA, 0x96, 0xB4,
+    0x17, 0x56, 0x0C, 0xF8, 0xB8, 0xA1, 0x33, 0xA9, 0x1C, 0x30, 0xD1, 0x69, 0x82, 0x47, 0x98, 0x4A,
+    0xE1, 0x51, 0x17, 0xB7, 0x33, 0x22, 0xEE, 0x1D, 0x63, 0x8A, 0x5E, 0xDB, 0xD2, 0xB8, 0x75, 0x30,
+    0x62, 0xFC, 0xDF, 0xB6, 0x39, 0xD5, 0xFC, 0x36, 0x58, 0x34, 0x0C, 0xC2, 0x7A, 0x30, 0x0B, 0xF5,
+    0x1E, 0x10, 0x7D, 0x0F, 0xA8, 0x60, 0x20, 0x81, 0x2C, 0x26, 0xE3, 0xFF, 0x13, 0x7A, 0x11, 0xCF,
+    0x7A, 0x37, 0x66, 0x94, 0xB4, 0x95, 0xDB, 0x52, 0x84, 0x71, 0x09, 0xDA, 0x38, 0x27, 0xEF, 0x91,
+    0xA6, 0xE0, 0x0F, 0xE8, 0xFE, 0x0A, 0xD8, 0x46, 0xFF, 0xA2, 0x03, 0x84, 0x19, 0xF6, 0x92, 0x62,
+    0x74, 0x8A, 0x7F, 0x43, 0x6C, 0xA1, 0xAD, 0xD0, 0x4A, 0xD9, 0xB2, 0xC7, 0x8D, 0xB7, 0x81, 0xB9,
+    0xC6, 0xC0, 0xC3, 0x98, 0x96, 0x1E, 0x31, 0x22, 0x6E, 0x21, 0x1E, 0x47, 0x6D, 0x63, 0xF7, 0xC7,
+    0x66, 0x64, 0x6B, 0x4A, 0xE3, 0xEF, 0x43, 0xEA, 0x7B, 0x33, 0xDA, 0xBF, 0x59, 0x63, 0x0A, 0xC7,
+    0x15, 0x7F, 0xC2, 0x96, 0xE7, 0x24, 0xBC, 0x92, 0xDD, 0x31, 0x43, 0xB1, 0x1B, 0x95, 0x4E, 0x2B,
+    0x1A, 0x7F, 0xDA, 0xD0, 0x14, 0xF3, 0x4D, 0x80, 0xAA, 0x39, 0x6A, 0x43, 0x98, 0x03, 0x57, 0x70,
+    0xD8, 0x5B, 0xB2, 0x5A, 0xDC, 0xB6, 0x3A, 0x69, 0x79, 0xF2, 0xC4, 0xAD, 0x09, 0xA3, 0x31, 0xD0,
+    0x00, 0x40, 0x43, 0xA6, 0xDF, 0xBD, 0x4A, 0xED, 0x2B, 0xDE, 0x16, 0xAF, 0xB9, 0x78, 0xD5, 0x71,
+    0xAF, 0xE4, 0xB3, 0x7E, 0x08, 0x5C, 0xD3, 0x9C, 0x9A, 0xA8, 0xF4, 0x4C, 0x50, 0xC2, 0xF5, 0xD0,
+    0xD0, 0xD3, 0xC0, 0x4A, 0xA3, 0x5B, 0xE0, 0xBE, 0x26, 0xFF, 0x91, 0x81, 0x09, 0x27, 0x98, 0xB2,
+    0x8B, 0xD5, 0x98, 0x39, 0x6E, 0x1D, 0xDC, 0x8D, 0x28, 0xFE, 0x74, 0x86, 0xAD, 0x55, 0xC7, 0xFB,
+    0x14, 0xEF, 0x9C, 0x03, 0x4A, 0xCC, 0xDE, 0x09, 0xDF, 0x8C, 0x72, 0x45, 0x8B, 0xA6, 0x72, 0xA5,
+    0x13, 0x1D, 0xFD, 0xBD, 0x25, 0xBF, 0x7D, 0x97, 0xE8, 0xF9, 0x63, 0xCE, 0xC4, 0xEB, 0xC2, 0x9A,
+    0xBA, 0x80, 0xD2, 0x3B, 0xB4, 0x53, 0xF9, 0x79, 0x58, 0x47, 0x95, 0xBF, 0x44, 0xE2, 0x4A, 0xA0,
+    0x7E, 0x17, 0x5F, 0x6E, 0xD1, 0x77, 0x56, 0xDF, 0x06, 0xC0, 0xCE, 0x2B, 0x6D, 0x2C, 0x76, 0xF8,
+    0x8D, 0x36, 0x8F, 0xDB, 0xFA, 0x9B, 0x9E, 0x8D, 0x53, 0x71, 0x6D, 0xD0, 0x04, 0x8F, 0xDC, 0x61,
+    0x5B, 0x80, 0x96, 0x50, 0x53, 0x44, 0xC7, 0xE1, 0xD0, 0x13, 0x57, 0x3D, 0xC3, 0x77, 0x62, 0x23,
+    0x70, 0xD6, 0x43, 0x7B, 0x1F, 0xED, 0x5F, 0x25, 0xF9, 0x1F, 0x23, 0x1A, 0x3E, 0xA8, 0x28, 0x7A,
+    0xAD, 0xA6, 0x18, 0x7E, 0xD1, 0xC5, 0xBC, 0x3B, 0xBB, 0x06, 0x9E, 0x62, 0xBC, 0x2F, 0xB6, 0x0D,
+    0xA6, 0x03, 0x8F, 0xD4, 0x80, 0xE5, 0x02, 0x06, 0x28, 0x32, 0xDE, 0x5A, 0xFB, 0x15, 0x79, 0xF0,
+    0x24, 0x1F, 0x7B, 0x81, 0xEC, 0x38, 0x7E, 0x83, 0x3A, 0xCA, 0xC3, 0x52, 0x5D, 0xB9, 0xAC, 0x15,
+    0x3C, 0x49, 0xED, 0x1E, 0x60, 0xED, 0x04, 0x9C, 0x4A, 0x0C, 0xE7, 0xA9, 0xC4, 0x71, 0x8C, 0xC1,
+    0x3B, 0xF0, 0xD0, 0x19, 0xA6, 0x7F, 0xDB, 0x51, 0xD2, 0xD6, 0x70, 0xF5, 0x19, 0x82, 0xF6, 0x45,
+    0x0E, 0xAC, 0x70, 0xC9, 0x93, 0x16, 0xBE, 0x90, 0x39, 0xEB, 0xA6, 0xEE, 0x7B, 0xD7, 0xBD, 0xE3,
+    0x20, 0x0C, 0xE7, 0x73, 0x60, 0x71, 0xF4, 0xB6, 0xFF, 0x70, 0xB8, 0x62, 0xC8, 0x0D, 0x44, 0xB1,
+    0xA4, 0x19, 0xEC, 0x3E, 0x41, 0xCC, 0x0D, 0x81, 0x9F, 0xDB, 0x04, 0x71, 0x56, 0x60, 0xEE, 0x59,
+    0x07, 0x3E, 0x94, 0x41, 0x71, 0x52, 0x8A, 0xAA, 0x94, 0x92, 0x7C, 0xE8, 0xCD, 0x81, 0xAB, 0x81,
+    0xA1, 0xB5, 0x44, 0xAE, 0x9D, 0xE7, 0x38, 0x6E, 0x43, 0x17, 0xBB, 0xEA, 0x4A, 0x9F, 0x14, 0xE0,
+    0xAA, 0xDD, 0x6B, 0x47, 0xDE, 0xBE, 0x8C, 0x8F, 0xED, 0x3E, 0x85, 0xF7, 0x48, 0x00, 0x3E, 0x6D,
+    0x1E, 0x2C, 0xC3, 0x73, 0x30, 0x57, 0xF1, 0x76, 0xFF, 0xD4, 0x79, 0x0A, 0xEB, 0x43, 0x0B, 0x9E,
+    0x1A, 0xF0, 0x74, 0x08, 0x9E, 0xBE, 0xED, 0x37, 0xAB, 0x3C, 0xD9, 0xB1, 0xE7, 0x7E, 0x94, 0x51,
+    0xAF, 0x49, 0xE9, 0x02, 0x1A, 0x61, 0x6F, 0x9E, 0xE9, 0x42, 0x1B, 0x12, 0xAC, 0xAC, 0x4A, 0xA4,
+    0x86, 0x39, 0x00, 0x4D, 0xE7, 0xD6, 0xF3, 0xE0, 0xFC, 0x1C, 0x42, 0x31, 0xAB, 0x5B, 0x87, 0xA1,
+    0x65, 0x8C, 0x2D, 0x65, 0x70, 0x29, 0xA3, 0x1B, 0x52, 0x74, 0x65, 0xBB, 0x00, 0x36, 0x31, 0xE4,
+    0x2E, 0xF7, 0x44, 0x77, 0x96, 0x1A, 0xF4, 0x84, 0x6E, 0xA4, 0x3C, 0x26, 0xE5, 0x31, 0x43, 0x1E,
+    0x53, 0xF0, 0x98, 0x46, 0xB6, 0x34, 0x6D, 0x68, 0x5C, 0x9F, 0x4C, 0x08, 0x43, 0x49, 0x25, 0x0B,
+    0x19, 0x5E, 0xD6, 0xE0, 0xF5, 0x07, 0x34, 0x3E, 0xA0, 0x93, 0xA9, 0xC8, 0xF6, 0x58, 0x16, 0x6A,
+    0xAB, 0xD2, 0x8F, 0xA7, 0x9A, 0x09, 0xFD, 0x00, 0x26, 0xAB, 0x69, 0x57, 0x36, 0x55, 0x78, 0xB5,
+    0x6F, 0xE0, 0x94, 0x65, 0x50, 0x61, 0xDB, 0x08, 0xEF, 0xF0, 0x03, 0x43, 0xD1, 0x1B, 0x48, 0x43,
+    0x97, 0x31, 0x12, 0x52, 0xA3, 0x1E, 0x62, 0xF8, 0xCB, 0x39, 0x75, 0x30, 0x65, 0xC6, 0x5B, 0x80,
+    0xC7, 0x2D, 0x44, 0xA9, 0x90, 0x74, 0xD2, 0x95, 0xF5, 0x4F, 0x5D, 0x5C, 0x9F, 0x5C, 0xDC, 0x82,
+    0x86, 0xB1, 0x61, 0x6B, 0x0F, 0xBB, 0x18, 0x93, 0x8F, 0x6B, 0xCB, 0x57, 0x1F, 0x72, 0xF1, 0x4F,
+    0xF9, 0xFB, 0x0B, 0x45, 0xE0, 0xE8, 0x57, 0xA4, 0x40, 0xEC, 0x9B, 0x94, 0x0D, 0x59, 0xB9, 0x07,
+    0xA0, 0x56, 0x91, 0x01, 0x63, 0xCA, 0xAB, 0x0D, 0x6D, 0x44, 0xC1, 0x6D, 0x43, 0x9B, 0xD1, 0xCB,
+    0x3F, 0x37, 0x94, 0x85, 0xAF, 0x60, 0xE9, 0x34, 0xFC, 0x0D, 0x56, 0x1F, 0x86, 0x07, 0x00, 0x30,
+    0x08, 0x1A, 0x60, 0xD8, 0x0B, 0x0C, 0x60, 0xC0, 0xA3, 0x71, 0xF5, 0x1A, 0x24, 0x2E, 0x7F, 0x06,
+    0x5C, 0x58, 0x49, 0xE9, 0xE0, 0x10, 0xC0, 0x82, 0xBF, 0x02, 0x5A, 0xF8, 0x16, 0x44, 0x22, 0x7A,
+    0x23, 0xDF, 0x24, 0xF5, 0xC3, 0x12, 0x41, 0x17, 0xC0, 0xB3, 0x95, 0x5F, 0x0F, 0xF1, 0xD4, 0x14,
+    0x48, 0xC4, 0xCD, 0x1E, 0x90, 0x0F, 0x78, 0xCB, 0xA9, 0x01, 0xF4, 0x8E, 0xE1, 0x8C, 0x5A, 0x23,
+    0xD3, 0xAB, 0x0A, 0xBB, 0xE6, 0x2C, 0xE3, 0x74, 0x3D, 0xE7, 0x6C, 0x06, 0x53, 0x1C, 0xD2, 0x01,
+    0x42, 0x04, 0xA4, 0xE0, 0x5D, 0x62, 0x19, 0x88, 0xD9, 0x06, 0x1D, 0xBE, 0x64, 0xEE, 0xC2, 0xCA,
+    0x89, 0xB7, 0x29, 0x89, 0x96, 0x42, 0xC8, 0xC0, 0xE1, 0x01, 0x1E, 0xF8, 0x2C, 0xB1, 0x11, 0xD4,
+    0x68, 0xCE, 0xBA, 0x3E, 0x9D, 0x2D, 0x1C, 0xB9, 0x7D, 0xC0, 0x41, 0x0A, 0x86, 0xE3, 0x3C, 0xA8,
+    0x20, 0x1B, 0xEC, 0x9C, 0x25, 0x6F, 0x2C, 0x64, 0x71, 0x85, 0x9C, 0x8E, 0xE1, 0x78, 0x10, 0x0F,
+    0x08, 0xC4, 0x33, 0x83, 0xE2, 0x7F, 0xC4, 0x3A, 0x7C, 0x0A, 0x56, 0x4F, 0x00, 0x8F, 0xC8, 0x69,
+    0x8D, 0x88, 0x0D, 0x79, 0x7A, 0x19, 0x7F, 0x79, 0x2A, 0xFE, 0xED, 0x7D, 0x1B, 0xD4, 0x37, 0x4A,
+    0xEA, 0x70, 0x68, 0xB1, 0x3D, 0xBD, 0x85, 0x9F, 0x4D, 0x80, 0x3F, 0xB5, 0x7E, 0x66, 0xCB, 0x04,
+    0xCD, 0x22, 0xE1, 0x37, 0xBE, 0x5E, 0xA4, 0x33, 0x6E, 0x9C, 0xF5, 0x7C, 0x5E, 0x7F, 0x8A, 0xF5,
+    0xE2, 0xC5, 0xCD, 0x64, 0x89, 0x89, 0x89, 0xA4, 0xE4, 0xE9, 0xF4, 0x38, 0x25, 0x8F, 0x31, 0xCF,
+    0x94, 0x53, 0x68, 0x76, 0x0A, 0x59, 0x0D, 0x1D, 0x55, 0x03, 0x27, 0xC5, 0x68, 0x45, 0x90, 0x88,
+    0xEB, 0x3E, 0xBF, 0x2E, 0xD0, 0x63, 0x00, 0x22, 0x87, 0x22, 0xDA, 0xCC, 0x57, 0x86, 0xC6, 0xC8,
+    0x8D, 0xEC, 0x67, 0x13, 0x83, 0x3B, 0x18, 0xB4, 0x81, 0x01, 0x1B, 0x20, 0x38, 0xC6, 0x7A, 0x0A,
+    0x05, 0xA3, 0xE2, 0xCA, 0xA8, 0xB2, 0x5C, 0x0D, 0xD8, 0x2B, 0xAB, 0x21, 0x25, 0x9A, 0x8B, 0x93,
+    0x9E, 0xE6, 0x14, 0x30, 0x45, 0x6D, 0x9A, 0xD2, 0x97, 0xBA, 0x83, 0xC8, 0xBB, 0x87, 0xFB, 0x34,
+    0xB8, 0x93, 0x63, 0xD6, 0xF0, 0xF5, 0x1C, 0xFC, 0xA8, 0x10, 0xFE, 0x9F, 0x6E, 0x04, 0xBF, 0x40,
+    0x5C, 0xA6, 0xC1, 0xEB, 0x90, 0xA2, 0x41, 0xF0, 0x7B, 0x4D, 0xE9, 0x1E, 0xD7, 0x3B, 0x99, 0x09,
+    0xEE, 0x23, 0xF4, 0xAA, 0xE0, 0x80, 0x4B, 0xA1, 0x00, 0x74, 0x24, 0x1A, 0xD6, 0x06, 0x36, 0xE6,
+    0x8A, 0xA5, 0x0B, 0x51, 0xCD, 0x06, 0x8F, 0xAD, 0xAD, 0xD1, 0x21, 0x7A, 0x8D, 0x8B, 0x84, 0x3B,
+    0x4C, 0xE7, 0x43, 0x36, 0x9D, 0xE4, 0x08, 0xE6, 0x91, 0xE7, 0xA0, 0x88, 0x2F, 0xF1, 0x26, 0xD9,
+    0x32, 0x8A, 0x66, 0x8A, 0xEB, 0x3A, 0x6C, 0x09, 0x25, 0x34, 0x97, 0xC8, 0x60, 0x88, 0xD5, 0x53,
+    0xA4, 0x6D, 0x28, 0x6E, 0x93, 0x49, 0xD1, 0xD9, 0x61, 0xD9, 0xC4, 0x4B, 0xC5, 0xA2, 0x70, 0x09,
+    0xD3, 0xA0, 0x9E, 0x08, 0xB9, 0x00, 0x32, 0x27, 0x58, 0xCD, 0x57, 0x59, 0x85, 0x79, 0x0E, 0x20,
+    0x15, 0x07, 0xD6, 0xAF, 0x18, 0x33, 0x87, 0x5B, 0xEC, 0xFC, 0xDB, 0x4D, 0x70, 0xE2, 0x91, 0xBF,
+    0x78, 0xE4, 0x8A, 0x4B, 0x6E, 0x74, 0xDE, 0xD3, 0x5E, 0x7B, 0x2F, 0x0F, 0x3F, 0x01, 0x97, 0xBA,
+    0x87, 0xFD, 0x27, 0xE8, 0xDE, 0xE1, 0x68, 0x3E, 0x2A, 0x8B, 0x1B, 0xB8, 0x74, 0x81, 0x65, 0x26,
+    0x61, 0x43, 0xBD, 0x5B, 0xEF, 0x51, 0xDC, 0x18, 0xEB, 0x6D, 0xCB, 0x1E, 0x61, 0x9C, 0x47, 0xD4,
+    0x3F, 0x21, 0xFF, 0x5E, 0x4B, 0xC1, 0x67, 0x97, 0xCA, 0xA0, 0x81, 0x27, 0x23, 0x99, 0x47, 0xE2,
+    0xCD, 0x01, 0xBC, 0x19, 0x1E, 0x0D, 0x04, 0x5C, 0x8A, 0x27, 0x00, 0xD6, 0xCB, 0x47, 0x94, 0x3D,
+    0x9A, 0xD1, 0xD6, 0xD8, 0x15, 0x47, 0xE7, 0xDF, 0xF6, 0xDA, 0x26, 0x7C, 0xF0, 0x63, 0x6C, 0xB2,
+    0xBB, 0xAA, 0xE1, 0x8D, 0x7C, 0xC1, 0x6D, 0xEF, 0x46, 0x1E, 0x39, 0x07, 0x3D, 0xE9, 0x7C, 0x68,
+    0xE7, 0xC3, 0xD2, 0x6B, 0xFF, 0x9C, 0x47, 0x6E, 0x33, 0xDD, 0xA3, 0xCD, 0x6C, 0x3E, 0x7B, 0x33,
+    0xE7, 0xC1, 0x83, 0x09, 0xFF, 0x36, 0x53, 0x7A, 0x80, 0xAD, 0x43, 0xC9, 0x77, 0xA6, 0xD5, 0x74,
+    0xCE, 0xBC, 0x2D, 0x16, 0xD7, 0xBD, 0x1B, 0x65, 0xC4, 0xFA, 0xB0, 0xA8, 0xE3, 0x30, 0x72, 0xBF,
+    0x5E, 0xC1, 0x11, 0xDE, 0x95, 0x12, 0x96, 0xD6, 0x3F, 0x04, 0xD5, 0xFA, 0xD8, 0x5C, 0x4F, 0xCA,
+    0xEC, 0xC5, 0xE9, 0xB1, 0xC4, 0xB9, 0x7E, 0x5F, 0x4A, 0xB3, 0xBC, 0x4F, 0xE3, 0x2F, 0x6A, 0xFF,
+    0xAB, 0xCB, 0x15, 0xA7, 0xDD, 0xA8, 0xE4, 0x82, 0x31, 0xCA, 0xC1, 0x60, 0xCE, 0x85, 0x50, 0x47,
+    0xDC, 0xB3, 0x87, 0xA9, 0x77, 0x28, 0x81, 0x43, 0xAA, 0x87, 0xC8, 0x0D, 0x87, 0xCB, 0x93, 0x1B,
+    0xEA, 0x07, 0x1C, 0xD3, 0xD0, 0xB0, 0xC3, 0xA7, 0x5A, 0x4C, 0x07, 0x9F, 0xBD, 0xBA, 0x64, 0x31,
+    0x2E, 0x11, 0x51, 0x24, 0x82, 0x46, 0x25, 0xC2, 0xA7, 0xC8, 0xAE, 0xD5, 0x71, 0xB1, 0x8B, 0x35,
+    0xD6, 0x88, 0x4F, 0x8B, 0x7C, 0xE0, 0xEA, 0xFB, 0xC7, 0xA7, 0x45, 0x1E, 0x83, 0x9E, 0x9D, 0x45,
+    0x2F, 0xEE, 0x50, 0x88, 0xFB, 0xD9, 0xA3, 0x59, 0xFF, 0xB1, 0x03, 0xD3, 0x93, 0x53, 0xA1, 0xD8,
+    0x1E, 0xBC, 0xF4, 0x2A, 0xC4, 0xFB, 0xA9, 0x84, 0x79, 0xF5, 0x59, 0x0D, 0xE1, 0x44, 0x78, 0x8D,
+    0x28, 0xB8, 0x8D, 0x3C, 0x76, 0x07, 0x85, 0xE7, 0xBB, 0x28, 0x57, 0xC1, 0x9E, 0x82, 0x1D, 0xD4,
+    0x5B, 0x38, 0x9C, 0x86, 0x0B, 0xE1, 0x34, 0xEE, 0xD4, 0x20, 0xD6, 0xE4, 0x63, 0x83, 0x21, 0x83,
+    0xC3, 0xAE, 0x03, 0x1F, 0xF1, 0x51, 0x77, 0x15, 0xBC, 0xBE, 0xEE, 0x5D, 0x23, 0xFF, 0x4E, 0x1B,
+    0xC1, 0xA1, 0xEF, 0x5F, 0xFA, 0x19, 0xD6, 0x69, 0x22, 0x03, 0x37, 0x46, 0x9D, 0xCA, 0xCE, 0x6C,
+    0x8D, 0x21, 0x14, 0x69, 0x4B, 0x52, 0x2C, 0x34, 0x75, 0x84, 0xA8, 0xEC, 0x88, 0x2A, 0x7B, 0x8E,
+    0x4A, 0x65, 0x51, 0x4F, 0xFF, 0xDA, 0xD2, 0xFD, 0x10, 0x01, 0x82, 0x6A, 0x32, 0xE4, 0x6A, 0x1C,
+    0xAB, 0x2B, 0x4B, 0x1D, 0x9F, 0x00, 0x70, 0x56, 0xE5, 0x39, 0x12, 0x37, 0x4B, 0x26, 0x63, 0xC5,
+    0x3F, 0x9B, 0xE8, 0x93, 0x49, 0xAC, 0xBB, 0x5D, 0x16, 0xC8, 0x18, 0x32, 0x02, 0xFD, 0x80, 0xF4,
+    0x63, 0x4B, 0x28, 0x37, 0x86, 0x9E, 0x49, 0x6E, 0x56, 0xEE, 0x00, 0xB4, 0x76, 0x9E, 0xE8, 0xB7,
+    0x30, 0xFA, 0x97, 0xBF, 0x34, 0x48, 0x64, 0x06, 0xFE, 0x8E, 0x8D, 0x12, 0xB6, 0x8A, 0x94, 0x5F,
+    0xC9, 0x21, 0xC6, 0x20, 0xC7, 0x54, 0xB2, 0x30, 0xE8, 0x53, 0x3B, 0x73, 0x52, 0x71, 0x73, 0xAA,
+    0x9B, 0x0E, 0x24, 0x38, 0x16, 0x2A, 0xF1, 0xFE, 0x09, 0x95, 0xC8, 0x9E, 0x10, 0x58, 0xC6, 0x06,
+    0xD6, 0x29, 0x31, 0x2A, 0x52, 0xA6, 0xAF, 0xF9, 0x77, 0x9A, 0xE0, 0x7E, 0x3F, 0x68, 0xF8, 0x44,
+    0xB3, 0x5C, 0x90, 0x9D, 0xF0, 0x02, 0xFA, 0xA9, 0x0E, 0x5A, 0xA3, 0xFE, 0x78, 0xD5, 0xBE, 0x42,
+    0x85, 0x8A, 0xE9, 0x51, 0xB3, 0x52, 0xCC, 0xD2, 0x8A, 0xF9, 0x74, 0x54, 0xFE, 0x7B, 0xAA, 0xA7,
+    0xB6, 0x60, 0xD7, 0xE4, 0xF1, 0x33, 0x8A, 0xEE, 0x42, 0x1B, 0x29, 0x7E, 0xE7, 0x78, 0xC2, 0xE5,
+    0xDA, 0xB1, 0x90, 0xBF, 0x9D, 0xAB, 0x94, 0xB0, 0xD4, 0xD3, 0x59, 0xD8, 0xC4, 0x9E, 0xC1, 0x16,
+    0xCE, 0xCE, 0xEC, 0x6F, 0x1C, 0x39, 0x3B, 0xFF, 0x2E, 0x30, 0x58, 0xDA, 0xDC, 0x18, 0xAA, 0x91,
+    0x38, 0xD5, 0xE8, 0xD3, 0x59, 0xD4, 0x40, 0xD8, 0xFE, 0x80, 0x1A, 0x9C, 0x41, 0xD3, 0xA0, 0x4C,
+    0xA3, 0x3C, 0x45, 0x52, 0x82, 0xE1, 0x52, 0xDA, 0x2C, 0xB8, 0x26, 0x8A, 0x2B, 0x3E, 0x22, 0xAD,
+    0xA1, 0x6F, 0xBF, 0x40, 0x62, 0xAE, 0x0B, 0x8E, 0xB2, 0x41, 0xB8, 0x17, 0xE5, 0x03, 0x35, 0x50,
+    0x34, 0xD8, 0xD8, 0x8A, 0x69, 0x90, 0x6E, 0x61, 0xA1, 0xC1, 0x16, 0xD6, 0x7A, 0x6F, 0x0B, 0xF6,
+    0xAC, 0x51, 0x50, 0x75, 0xCB, 0x2E, 0xFC, 0x3E, 0xC7, 0xD1, 0xAA, 0xA7, 0x7B, 0x38, 0xF2, 0xF1,
+    0xB9, 0x0B, 0x66, 0xD0, 0x5C, 0x90, 0xE2, 0xEC, 0x89, 0xCC, 0xCA, 0x15, 0x47, 0x23, 0xE7, 0x4F,
+    0xA6, 0x43, 0x74, 0x7D, 0x6C, 0x0F, 0x61, 0xC1, 0x9F, 0x50, 0x34, 0x23, 0x09, 0x26, 0xD8, 0x29,
+    0x9F, 0x97, 0x19, 0xE8, 0xCA, 0xCF, 0x1C, 0x52, 0xA9, 0x72, 0x8D, 0x0E, 0xE2, 0x33, 0xFE, 0x55,
+    0x05, 0x04, 0xBD, 0x80, 0x7E, 0x1B, 0xC8, 0xBA, 0xCF, 0x2D, 0x65, 0xDD, 0xE5, 0x73, 0x32, 0x62,
+    0x78, 0x6C, 0xE4, 0x57, 0x03, 0xA2, 0xED, 0x6D, 0xAE, 0x59, 0xB6, 0x47, 0xFC, 0x14, 0x53, 0x49,
+    0x8E, 0x63, 0x86, 0x17, 0x77, 0x7C, 0x4C, 0xDC, 0xBD, 0x3A, 0x6E, 0x85, 0x61, 0x40, 0x80, 0x23,
+    0x60, 0xB5, 0x6F, 0x1D, 0x29, 0xED, 0xD7, 0xF5, 0xE4, 0x0B, 0xBB, 0xD7, 0x7B, 0xED, 0xC1, 0xB9,
+    0xED, 0xFE, 0x85, 0x5D, 0x7C, 0xF0, 0x1D, 0x1F, 0xDC, 0xE2, 0xD3, 0xB7, 0x3F, 0x00, 0xC5, 0xD0,
+    0xF6, 0x2D, 0xB0, 0xEB, 0x95, 0x57, 0x83, 0xDB, 0x55, 0xF4, 0xFD, 0x12, 0x99, 0xB4, 0xAB, 0x68,
+    0x94, 0xD0, 0xF3, 0x67, 0x40, 0x83, 0x89, 0x7E, 0x57, 0xA3, 0x78, 0x8D, 0x23, 0xBD, 0xA9, 0x68,
+    0xEB, 0x25, 0x27, 0x42, 0x70, 0x06, 0xCF, 0x28, 0xDA, 0x09, 0x4C, 0xA2, 0x47, 0x01, 0xCE, 0x34,
+    0x6B, 0xA4, 0xCF, 0x2C, 0xE9, 0xBA, 0x55, 0xF6, 0x39, 0x6B, 0xBB, 0xF5, 0x60, 0xEB, 0xC3, 0x56,
+    0xE1, 0x2F, 0x8A, 0xC6, 0x73, 0xEE, 0x5C, 0xBF, 0xFB, 0xEA, 0x3B, 0xAC, 0xF3, 0x56, 0xE9, 0xAD,
+    0xD6, 0x5B, 0xB5, 0xB7, 0x81, 0x64, 0x43, 0xC9, 0x06, 0x53, 0x7A, 0x74, 0x1D, 0x3A, 0x21, 0xB3,
+    0x52, 0x66, 0xC5, 0x4C, 0x42, 0xE5, 0xE4, 0x52, 0x6D, 0x69, 0xF3, 0xC0, 0xFE, 0xD2, 0x4F, 0x07,
+    0x06, 0x8B, 0xEC, 0x7F, 0xCC, 0xC0, 0x02, 0x39, 0x54, 0x68, 0x09, 0x2D, 0xA0, 0x42, 0x25, 0x39,
+    0x6E, 0x61, 0xCC, 0xF5, 0x0F, 0x81, 0x83, 0x7F, 0xB3, 0x13, 0x1D, 0xB1, 0xF5, 0xAA, 0xD4, 0x30,
+    0xEC, 0xCC, 0xA2, 0x47, 0x22, 0x44, 0x0B, 0x15, 0x94, 0xDC, 0x26, 0x07, 0x7F, 0xFB, 0x43, 0x9D,
+    0x44, 0xAC, 0x84, 0xAC, 0x9D, 0x98, 0x11, 0x2C, 0x03, 0xA0, 0xE4, 0x73, 0xE6, 0xE6, 0x23, 0x41,
+    0x50, 0xF1, 0xCF, 0x70, 0x70, 0xB6, 0x8A, 0x95, 0xFC, 0x2E, 0x16, 0x07, 0x02, 0xFD, 0x5F, 0x23,
+    0xF0, 0xBE, 0x26, 0x02, 0x6B, 0x20, 0x2D, 0x16, 0xFA, 0xC8, 0x9A, 0x48, 0xB8, 0x70, 0x6C, 0x38,
+    0x3E, 0x2E, 0x5A, 0x46, 0x5A, 0xE1, 0x04, 0x76, 0x12, 0x4C, 0x0E, 0x95, 0xC3, 0xE5, 0x90, 0xB1,
+    0x07, 0x89, 0xB1, 0x52, 0x6B, 0xAD, 0x94, 0x9C, 0x60, 0xCB, 0x7F, 0x05, 0xB9, 0x88, 0x11, 0x8B,
+    0x19, 0x6B, 0x32, 0xE3, 0x6C, 0xE6, 0x8C, 0xE6, 0xAC, 0xB6, 0x58, 0xDC, 0xDA, 0x6D, 0xD5, 0x70,
+    0x16, 0xF5, 0xE7, 0x66, 0x05, 0x75, 0x25, 0x03, 0x85, 0x41, 0xC7, 0xE1, 0xC5, 0xBB, 0x61, 0x6E,
+    0x51, 0xEB, 0x67, 0xA2, 0xCE, 0xFE, 0x9F, 0xA8, 0xFF, 0x03, 0x75, 0x54, 0xB1, 0x6E, 0xD3, 0x50,
+    0x14, 0x3D, 0xB6, 0x69, 0x3D, 0x58, 0x8D, 0x3B, 0x74, 0x43, 0xB1, 0x3B, 0x30, 0x55, 0x71, 0xBC,
+    0x74, 0x08, 0xD2, 0x0B, 0xB6, 0xC4, 0x07, 0xC0, 0xCC, 0x27, 0xC0, 0x50, 0x86, 0x08, 0x05, 0x29,
+    0x34, 0x4F, 0x62, 0xEC, 0xD2, 0xEF, 0x28, 0x43, 0x33, 0x78, 0x28, 0x48, 0x6D, 0xAC, 0x32, 0xB2,
+    0x58, 0xE2, 0x03, 0xB0, 0x10, 0x03, 0x02, 0x24, 0x2C, 0x35, 0x48, 0x69, 0x4B, 0x31, 0xE7, 0xDA,
+    0x49, 0x93, 0x16, 0x61, 0xFB, 0xDD, 0x3C, 0xBF, 0xFB, 0xEE, 0xB9, 0xE7, 0x9E, 0xFB, 0x1C, 0xCF,
+    0x45, 0xDB, 0x47, 0xE0, 0x41, 0x05, 0xE8, 0xB4, 0xB0, 0xDD, 0xC1, 0xE6, 0x3D, 0xC0, 0x4C, 0xB7,
+    0x01, 0x2B, 0xED, 0xD1, 0xE8, 0x11, 0x60, 0xC7, 0x39, 0xE0, 0x18, 0x19, 0x56, 0x0F, 0xDF, 0x7C,
+    0x83, 0x53, 0x96, 0x25, 0xD0, 0xB2, 0x35, 0xA0, 0x1C, 0x00, 0x1D, 0x97, 0xA6, 0xD7, 0x00, 0xA2,
+    0xB2, 0xFC, 0x2D, 0x66, 0x0A, 0x23, 0x53, 0x02, 0xD2, 0x11, 0x90, 0x91, 0x80, 0x14, 0x33, 0x10,
+    0x80, 0xAF, 0xE0, 0x9B, 0x73, 0x0E, 0x8C, 0xCB, 0xD4, 0xF8, 0x75, 0x1A, 0x5B, 0xA7, 0x29, 0xAC,
+    0xF7, 0x1C, 0x1F, 0x35, 0xCC, 0xCB, 0x98, 0xEB, 0x44, 0x76, 0x27, 0x40, 0xE3, 0x18, 0x58, 0x6B,
+    0x03, 0x4D, 0x8E, 0x56, 0x17, 0xF7, 0xBB, 0x82, 0x9E, 0x63, 0xF5, 0x0F, 0x21, 0x9E, 0xCF, 0xA0,
+    0x1E, 0xA3, 0xBE, 0xEC, 0x29, 0x1A, 0xF0, 0x8F, 0xA1, 0xA0, 0x3C, 0x24, 0xE8, 0x37, 0x8C, 0x1C,
+    0xA3, 0x86, 0x95, 0xA2, 0x68, 0x92, 0x5E, 0xD1, 0x0A, 0x68, 0x54, 0xFF, 0x04, 0x45, 0xEF, 0xEC,
+    0x67, 0xFC, 0xEE, 0xEC, 0xC3, 0xC3, 0x34, 0xDC, 0x7B, 0x44, 0xB7, 0xD7, 0xA4, 0x51, 0x2D, 0x4B,
+    0xD3, 0x6D, 0xC7, 0x66, 0xC6, 0x8A, 0x6C, 0xAD, 0x1A, 0xA0, 0x2C, 0x03, 0x82, 0x09, 0x8D, 0xC5,
+    0x65, 0x4B, 0xE6, 0xF0, 0x90, 0xF4, 0x06, 0x76, 0x0A, 0x1C, 0x31, 0x14, 0x89, 0x98, 0x23, 0x97,
+    0xB4, 0xD5, 0x2E, 0xBD, 0x91, 0x04, 0x0C, 0xB9, 0xC3, 0xBC, 0x4C, 0x57, 0xE0, 0xBE, 0xCE, 0xDB,
+    0x68, 0x63, 0x42, 0x56, 0x18, 0x4C, 0x69, 0xC2, 0x5C, 0x40, 0x53, 0x3C, 0xC0, 0x30, 0x83, 0xFF,
+    0xFD, 0xA2, 0x80, 0x5D, 0xEA, 0x69, 0x8D, 0xEE, 0xB5, 0x03, 0xD5, 0xD9, 0xDE, 0xAC, 0xE6, 0x6E,
+    0x3D, 0xD6, 0x39, 0xBA, 0x6B, 0xCC, 0xF9, 0x03, 0x30, 0xC6, 0x54, 0xFD, 0xE4, 0x29, 0xCC, 0x4F,
+    0x74, 0xED, 0xC5, 0xF0, 0x49, 0xE1, 0x8E, 0x24, 0x37, 0xB8, 0x77, 0x4D, 0xE2, 0x6F, 0x8E, 0xAD,
+    0xF1, 0x41, 0x3C, 0x2C, 0x4B, 0x7D, 0x7B, 0xBD, 0x1A, 0x75, 0x39, 0xA2, 0x33, 0x89, 0x53, 0x5E,
+    0xB2, 0x62, 0x15, 0x75, 0x6B, 0x2C, 0xF6, 0x49, 0xCA, 0x13, 0x97, 0xCF, 0xA5, 0xEE, 0xC2, 0x65,
+    0xE6, 0xD2, 0x51, 0xBA, 0xF4, 0xC2, 0x55, 0x5F, 0x26, 0x57, 0xC2, 0x18, 0x26, 0x6B, 0x09, 0xF5,
+    0xFC, 0x87, 0x65, 0x02, 0x77, 0x45, 0x11, 0x69, 0xA9, 0x7D, 0x3E, 0x97, 0x46, 0xCF, 0xA3, 0x78,
+    0x58, 0xE2, 0xAD, 0x83, 0x83, 0x65, 0x8D, 0x6F, 0xAC, 0xF5, 0xE4, 0x9D, 0x34, 0x9C, 0x0A, 0x83,
+    0x13, 0xBB, 0x92, 0x17, 0x75, 0x92, 0x2B, 0x4E, 0xF7, 0xE1, 0x4C, 0xEB, 0x3D, 0xBD, 0x6B, 0x84,
+    0x67, 0x5F, 0x21, 0x87, 0x54, 0x63, 0x37, 0xB6, 0x0B, 0x63, 0x32, 0x6B, 0x94, 0x72, 0xB1, 0xF3,
+    0x25, 0xF0, 0xCC, 0x8B, 0x69, 0x53, 0x39, 0x3A, 0xF1, 0x3A, 0x3E, 0x0A, 0xAF, 0x17, 0x20, 0x6F,
+    0x26, 0xCA, 0xC8, 0x5A, 0x23, 0x65, 0x65, 0x6A, 0xA4, 0xEC, 0x34, 0x49, 0xDA, 0xDE, 0xE7, 0xA2,
+    0xEF, 0x4E, 0x4A, 0xAD, 0x8C, 0x78, 0xA3, 0x52, 0x47, 0x0A, 0x5E, 0x87, 0x75, 0xF1, 0x84, 0x1A,
+    0x0C, 0xCB, 0x7D, 0x2E, 0x30, 0x21, 0x4F, 0x98, 0x2B, 0x8A, 0xF8, 0xB0, 0x32, 0xEE, 0x62, 0x8E,
+    0x40, 0x74, 0xEB, 0xC2, 0xD1, 0xD2, 0xE4, 0x18, 0x03, 0x69, 0xE1, 0x91, 0x98, 0x89, 0xA8, 0x55,
+    0x08, 0x54, 0x41, 0xBF, 0x21, 0xC6, 0x94, 0x93, 0xC0, 0x40, 0x6E, 0x4F, 0x11, 0x8A, 0x76, 0xEE,
+    0x25, 0x0B, 0x32, 0xCB, 0xEB, 0x13, 0x17, 0x16, 0x88, 0x0A, 0x69, 0xCC, 0xA0, 0xD2, 0x3F, 0xA9,
+    0x3A, 0x50, 0x48, 0x5A, 0xC6, 0x32, 0x92, 0x09, 0xF9, 0xB0, 0x89, 0x4E, 0x2C, 0x39, 0xDC, 0xAA,
+    0x25, 0x6C, 0x2E, 0x8F, 0x3A, 0xE3, 0xA2, 0x1C, 0x1D, 0xF9, 0x1A, 0x78, 0x07, 0xBC, 0x3D, 0xFA,
+    0xEB, 0xDB, 0x89, 0x6D, 0x6D, 0x6B, 0x2B, 0x95, 0xDB, 0xCC, 0x10, 0x65, 0x72, 0x14, 0x17, 0x58,
+    0x5A, 0x98, 0xD7, 0x70, 0x35, 0x96, 0xC2, 0x8C, 0x43, 0xFF, 0x36, 0x07, 0xC6, 0x8D, 0x29, 0x2C,
+    0xBF, 0x7C, 0xF8, 0xD4, 0x23, 0xE2, 0xFC, 0x45, 0x46, 0xB7, 0xF8, 0x13, 0xE2, 0x29, 0x02, 0x06,
+    0x70, 0x08, 0xD5, 0x60, 0xD6, 0x80, 0x2B, 0x1B, 0x14, 0x2E, 0x2C, 0xA7, 0x11, 0xFF, 0x22, 0x08,
+    0xDA, 0xA6, 0x87, 0x1F, 0x9E, 0x59, 0xC0, 0xCD, 0x45, 0x9B, 0x3A, 0xD3, 0x52, 0x1A, 0x9B, 0xDC,
+    0x62, 0x9C, 0x40, 0x58, 0xD5, 0xF4, 0x96, 0xAB, 0x95, 0xA7, 0xE2, 0x91, 0xFC, 0xEF, 0xAA, 0x74,
+    0x2B, 0x2B, 0x5D, 0xFE, 0xAD, 0x88, 0x13, 0x37, 0xC3, 0xDD, 0x0C, 0xAF, 0x96, 0x8A, 0x9A, 0x2B,
+    0xC1, 0x84, 0x8C, 0x23, 0xCB, 0x15, 0x29, 0xEC, 0xCA, 0xD4, 0x2F, 0x77, 0x4A, 0x9E, 0xEE, 0xB7,
+    0xF8, 0x0B, 0xBD, 0x58, 0x3F, 0x6C, 0xDC, 0xD6, 0x19, 0xFF, 0x48, 0xDA, 0x26, 0x6C, 0xC2, 0x7A,
+    0x1A, 0xDC, 0x16, 0xB0, 0x2D, 0xB1, 0x43, 0x06, 0xD7, 0xD5, 0xDD, 0x2D, 0x1A, 0x84, 0x80, 0xBC,
+    0x7B, 0x69, 0x81, 0x7A, 0xC8, 0x10, 0x0D, 0x71, 0x3B, 0x74, 0x88, 0x87, 0xCE, 0x8D, 0x06, 0x0D,
+    0x42, 0x71, 0xD6, 0xD1, 0xEE, 0xD0, 0x21, 0x43, 0x5C, 0xB4, 0x45, 0xD6, 0x0C, 0x19, 0x6A, 0x05,
+    0xA8, 0xAE, 0xC0, 0x15, 0x38, 0x20, 0x72, 0x8E, 0x8E, 0x87, 0x8C, 0x61, 0xD1, 0x21, 0xE8, 0x14,
+    0x06, 0xB5, 0xD1, 0xC1, 0x83, 0x89, 0x86, 0x41, 0xCF, 0xF1, 0xDD, 0xB1, 0xBF, 0xDF, 0x23, 0x79,
+    0x96, 0x15, 0x0F, 0xB1, 0xA5, 0x8A, 0xA7, 0x47, 0xDD, 0x3D, 0xF2, 0x7D, 0xFF, 0xBF, 0xDF, 0xF7,
+    0xBD, 0x27, 0xAF, 0xC8, 0x04, 0x9F, 0x5F, 0x89, 0x88, 0x96, 0xC4, 0x4A, 0xEC, 0xD8, 0xC1, 0xC7,
+    0x8D, 0x3C, 0xAD, 0xB4, 0x12, 0x5F, 0x5A, 0xD2, 0x96, 0x1F, 0x09, 0x2F, 0x27, 0x12, 0x47, 0x4B,
+    0x6B, 0x6C, 0x15, 0x63, 0x37, 0x15, 0x15, 0xE1, 0x91, 0x84, 0x22, 0x81, 0x48, 0xB7, 0xFE, 0xC3,
+    0xCF, 0x96, 0x8E, 0x54, 0x11, 0x5B, 0x33, 0x10, 0x13, 0x2B, 0x21, 0xD1, 0xF2, 0xEA, 0xE5, 0x62,
+    0x17, 0x13, 0x71, 0x93, 0x13, 0xA2, 0x30, 0xA7, 0x30, 0xE5, 0x63, 0x2C, 0x63, 0x34, 0x45, 0xEC,
+    0x8F, 0x6F, 0x8B, 0x57, 0xCC, 0x0C, 0x11, 0x19, 0x62, 0xE4, 0x18, 0x19, 0xE6, 0x53, 0x11, 0x2F,
+    0x12, 0xE9, 0x14, 0x45, 0xC4, 0x81, 0xD9, 0xFE, 0x9B, 0xAB, 0xA3, 0x22, 0x6B, 0x5D, 0x49, 0x02,
+    0x49, 0xD7, 0xA4, 0xBF, 0x2A, 0xFD, 0x40, 0xB2, 0xA6, 0x93, 0x74, 0x8A, 0xEC, 0xAF, 0xC3, 0x81,
+    0xC8, 0x22, 0x48, 0x67, 0x4A, 0x3B, 0x89, 0x17, 0x79, 0xD0, 0x44, 0x89, 0x13, 0x87, 0x62, 0x27,
+    0x43, 0xB1, 0x52, 0x10, 0xFC, 0x0A, 0x22, 0x3D, 0x89, 0xE4, 0x64, 0xF1, 0x47, 0x69, 0x15, 0xE3,
+    0x92, 0xDF, 0x16, 0xE9, 0x67, 0xD2, 0x2B, 0x52, 0xC3, 0xD3, 0xC2, 0x3F, 0x1B, 0xAF, 0x0D, 0xEA,
+    0xEB, 0x9A, 0x51, 0xE0, 0xDA, 0xFC, 0x77, 0xA9, 0x50, 0x0B, 0xD2, 0xCE, 0x76, 0xC5, 0xAA, 0x56,
+    0x18, 0x89, 0x47, 0xD0, 0x0C, 0x54, 0x9C, 0xBB, 0x63, 0xF1, 0x60, 0x18, 0xC5, 0xA1, 0xB7, 0xC4,
+    0x05, 0x67, 0x8B, 0xC2, 0xFB, 0x31, 0xCC, 0x98, 0x96, 0x0B, 0x9C, 0x44, 0xB6, 0x77, 0x63, 0x69,
+    0x4D, 0x2B, 0x03, 0x49, 0x37, 0xDC, 0x0A, 0xEA, 0xEF, 0x17, 0xF8, 0xF6, 0xE3, 0x9F, 0x8D, 0x21,
+    0x3C, 0xCC, 0xB4, 0x20, 0x57, 0x9D, 0x78, 0xC5, 0x2D, 0x6E, 0x24, 0xAB, 0xEA, 0x35, 0xDD, 0xDF,
+    0x68, 0x88, 0x6C, 0x40, 0x6B, 0x59, 0x4D, 0x71, 0x5B, 0x33, 0x37, 0xF3, 0x73, 0x03, 0xF6, 0x5F,
+    0x5D, 0x85, 0x59, 0xFB, 0x2B, 0x5E, 0x11, 0xA5, 0x0B, 0x72, 0x9B, 0x9E, 0x84, 0x18, 0xD6, 0x63,
+    0x6B, 0x0F, 0xDC, 0x8B, 0xA4, 0xA6, 0xEF, 0xFD, 0xB3, 0x71, 0x7D, 0x73, 0xA5, 0xBF, 0x92, 0xAE,
+    0xA5, 0xAB, 0x59, 0xDE, 0xDB, 0x38, 0xB7, 0x28, 0x7A, 0xD1, 0x4A, 0x07, 0xEE, 0xDD, 0xB4, 0xE5,
+    0xC6, 0x7B, 0xBE, 0xE4, 0xA1, 0x74, 0x9B, 0x12, 0x2A, 0x59, 0x46, 0x20, 0x38, 0xB1, 0x65, 0xE9,
+    0xCB, 0x3B, 0x3B, 0xBA, 0x67, 0x5C, 0xE0, 0x1E, 0x18, 0x8E, 0xBE, 0xFC, 0xE7, 0xCE, 0xF8, 0x7B,
+    0xEB, 0xCF, 0x15, 0xFD, 0xE4, 0x9B, 0x10, 0x5D, 0x15, 0xAF, 0x41, 0xF4, 0x0B, 0x71, 0x7F, 0x03,
+    0xB4, 0x36, 0xFA, 0xB8, 0xAD, 0xA6, 0xEA, 0x97, 0xD1, 0x5A, 0xAA, 0x66, 0x10, 0x5D, 0x2D, 0x43,
+    0x74, 0xA5, 0xF4, 0xEA, 0xAA, 0x72, 0xE3, 0xFE, 0x8A, 0xB2, 0x93, 0x74, 0xE1, 0xB4, 0xFC, 0xE1,
+    0xB9, 0xA2, 0x5F, 0xDE, 0xF9, 0xA0, 0x47, 0xBF, 0x89, 0x37, 0x96, 0xF0, 0xD7, 0xB2, 0xE9, 0x49,
+    0xDF, 0xD5, 0xF8, 0x5B, 0x43, 0xAC, 0x4E, 0xC5, 0xBA, 0x55, 0x46, 0xD4, 0x81, 0x81, 0xC8, 0x29,
+    0x45, 0x7F, 0xCE, 0x33, 0x5E, 0xF3, 0xE7, 0xE7, 0x10, 0xA3, 0xDA, 0xB9, 0x12, 0x53, 0x76, 0x84,
+    0xBB, 0x27, 0x02, 0x53, 0x0F, 0xF8, 0x4B, 0xF1, 0x2D, 0xB9, 0x7C, 0x5B, 0x64, 0x5D, 0x4D, 0x4F,
+    0xFB, 0xF8, 0xBD, 0x70, 0x6A, 0x7C, 0x26, 0x87, 0x83, 0x57, 0x74, 0xF0, 0x4D, 0xFE, 0x36, 0xCD,
+    0x90, 0xB9, 0xB1, 0x2F, 0x6B, 0x02, 0x2A, 0xE7, 0x10, 0xC3, 0x5B, 0x88, 0x88, 0x21, 0xE2, 0x29,
+    0x47, 0x84, 0x64, 0x56, 0x6A, 0x65, 0x76, 0x6A, 0xA7, 0x4E, 0x82, 0x0F, 0xF3, 0x2B, 0xF6, 0xF0,
+    0xF1, 0x63, 0x15, 0xF7, 0x22, 0xF5, 0xE4, 0xA1, 0x56, 0xA3, 0xD7, 0xEB, 0x54, 0x60, 0x12, 0x31,
+    0xA9, 0xCC, 0x40, 0x68, 0x42, 0xA4, 0x02, 0x29, 0xC5, 0xF8, 0xBF, 0x19, 0xF5, 0x30, 0x46, 0x07,
+    0x06, 0xE7, 0xF8, 0xAC, 0x85, 0xE1, 0x61, 0xC8, 0x2F, 0x30, 0xEC, 0xEF, 0x30, 0x4C, 0xD0, 0x4D,
+    0x26, 0x8B, 0x4E, 0xE4, 0x6A, 0x04, 0x7C, 0xFA, 0x83, 0xA4, 0xA3, 0x99, 0x72, 0x7E, 0xF2, 0x6A,
+    0x09, 0x03, 0x98, 0xF7, 0xA0, 0xA9, 0x92, 0xD3, 0x34, 0x78, 0xD6, 0xE8, 0x6E, 0x5E, 0xEC, 0x9F,
+    0x4D, 0x2F, 0xA6, 0x2B, 0xFD, 0xCD, 0x4E, 0x7A, 0x52, 0x4E, 0xDA, 0xA2, 0xF0, 0xCE, 0xCD, 0xC4,
+    0xB9, 0x0B, 0xE5, 0x72, 0x3B, 0xDB, 0x73, 0xEF, 0xE6, 0xCA, 0x49, 0x42, 0xA5, 0x07, 0xA1, 0x2C,
+    0x9E, 0x30, 0x0C, 0xA0, 0xFD, 0x8A, 0x4A, 0x65, 0x10, 0x26, 0x56, 0x6A, 0x43, 0x77, 0xDB, 0x64,
+    0x64, 0x03, 0xE6, 0x45, 0x5E, 0xE8, 0x2C, 0xF0, 0x9C, 0x78, 0xA2, 0xBC, 0x9F, 0x4C, 0xCE, 0x2C,
+    0xBB, 0x5B, 0x12, 0x2C, 0x6D, 0x4A, 0xB6, 0xD6, 0xB7, 0x93, 0xAF, 0x73, 0xF7, 0x46, 0x31, 0x85,
+    0xF7, 0xD3, 0x15, 0xA0, 0xC8, 0xA6, 0x58, 0xD1, 0x9C, 0x98, 0x90, 0x9A, 0x90, 0x9C, 0x90, 0x9E,
+    0x90, 0xA0, 0xA1, 0x48, 0x92, 0xE7, 0x40, 0xF3, 0x3F, 0x85, 0xF6, 0xEC, 0x7B, 0x57, 0x62, 0x05,
+    0xAD, 0xE2, 0x33, 0x0B, 0xF4, 0x5E, 0x20, 0x9E, 0xC6, 0xA2, 0x26, 0x13, 0x8F, 0xEE, 0x84, 0xB6,
+    0x54, 0x0B, 0xDE, 0x85, 0x53, 0xB7, 0x10, 0x54, 0x70, 0x2B, 0x55, 0x9C, 0xE1, 0x85, 0xD3, 0x94,
+    0x0F, 0xAE, 0xF7, 0x08, 0x52, 0x4B, 0x62, 0x0F, 0xE1, 0xD2, 0x53, 0x63, 0x02, 0x43, 0x83, 0xA8,
+    0xB0, 0xE4, 0xDE, 0xC8, 0xA4, 0xA1, 0xDC, 0xF4, 0xE3, 0x71, 0xA0, 0x92, 0x1F, 0xDF, 0x1A, 0xBC,
+    0x1A, 0x63, 0xD1, 0x57, 0x88, 0x97, 0x4F, 0xEE, 0x21, 0x5E, 0xDD, 0xF7, 0x6E, 0xE1, 0x29, 0xD0,
+    0x64, 0x8B, 0x04, 0x32, 0x31, 0xC4, 0x60, 0x3E, 0x44, 0xA6, 0x93, 0x31, 0xF7, 0x6D, 0xA3, 0x89,
+    0x85, 0xCC, 0xD1, 0x94, 0x00, 0x0E, 0x07, 0x28, 0xA6, 0xE2, 0x6B, 0xFA, 0xBD, 0x6B, 0xC0, 0x0F,
+    0xF7, 0xED, 0x53, 0x71, 0xAB, 0x88, 0x4F, 0x3D, 0xAE, 0xD2, 0x95, 0x61, 0x41, 0xC4, 0x64, 0xB6,
+    0x59, 0x71, 0x39, 0xA7, 0x2A, 0x3C, 0xE9, 0x60, 0x7C, 0x84, 0x01, 0x11, 0xEC, 0x7F, 0x25, 0x10,
+    0x23, 0x11, 0xEF, 0x26, 0x08, 0x42, 0xD5, 0x36, 0xEC, 0xB5, 0xBD, 0x93, 0x49, 0x51, 0x64, 0xD6,
+    0xD7, 0x57, 0x33, 0x20, 0x4E, 0xEE, 0xC5, 0x92, 0x03, 0x7F, 0x87, 0xC0, 0xEE, 0x61, 0xC9, 0xD0,
+    0x5C, 0x61, 0x09, 0x60, 0x54, 0xD0, 0xD5, 0x47, 0x4F, 0x1F, 0x0A, 0x8A, 0x0F, 0x0B, 0x76, 0x91,
+    0x1D, 0xE9, 0xC5, 0xA3, 0xA5, 0x7F, 0xC2, 0x62, 0x75, 0xF9, 0x2D, 0xA4, 0x7E, 0x58, 0xD0, 0x3A,
+    0x5B, 0x35, 0xC6, 0x91, 0x81, 0xE1, 0x60, 0x58, 0x18, 0x1E, 0x64, 0x62, 0xB8, 0x18, 0x36, 0x86,
+    0x8F, 0x61, 0x64, 0x38, 0x19, 0x56, 0xE4, 0x25, 0x64, 0x46, 0x7C, 0xCE, 0x85, 0xEC, 0x58, 0xAF,
+    0x86, 0x2C, 0x76, 0x43, 0xD9, 0x67, 0xB1, 0xA0, 0x41, 0xC4, 0x16, 0xD9, 0xCF, 0xED, 0x28, 0xD4,
+    0xB1, 0x58, 0x1C, 0x21, 0xC7, 0x25, 0x98, 0x6A, 0xED, 0x12, 0xE2, 0x0D, 0xE5, 0xC6, 0x4B, 0x8E,
+    0x98, 0x47, 0x51, 0xA0, 0xEA, 0x38, 0xE6, 0xEE, 0x7D, 0x46, 0x7F, 0x2B, 0x46, 0x97, 0xB4, 0x7D,
+    0x03, 0x09, 0x8C, 0x36, 0x16, 0x00, 0x62, 0x41, 0x78, 0x55, 0x8B, 0x1B, 0xF7, 0x00, 0xBF, 0x4A,
+    0x6F, 0xEF, 0xA0, 0xE6, 0xEF, 0x10, 0x7C, 0x7B, 0x05, 0xAB, 0xDD, 0xE3, 0x9F, 0xB3, 0x42, 0x67,
+    0x34, 0x9D, 0x93, 0xD8, 0x19, 0xE5, 0x63, 0xBD, 0xF6, 0x49, 0x19, 0xA6, 0xE2, 0xDD, 0x5C, 0x36,
+    0x4A, 0x22, 0x8B, 0xED, 0x4C, 0x7E, 0xC8, 0xB7, 0xDC, 0xA4, 0xD2, 0x84, 0x45, 0xB4, 0x8A, 0xBD,
+    0xFD, 0x98, 0xC7, 0xEF, 0xED, 0xEA, 0x99, 0x82, 0x96, 0xEE, 0x0C, 0x69, 0x49, 0x51, 0xCF, 0x8A,
+    0xC1, 0x63, 0xE6, 0x8A, 0x89, 0xD2, 0xB7, 0xA0, 0xC9, 0x74, 0x9F, 0xF9, 0x91, 0x69, 0xA6, 0xE5,
+    0x90, 0x7E, 0x39, 0x07, 0xCC, 0x84, 0xA6, 0x46, 0x26, 0x27, 0x29, 0x1F, 0xBB, 0x71, 0xD9, 0x4F,
+    0xA8, 0x3F, 0xAD, 0x8B, 0x82, 0x48, 0x6A, 0xE7, 0x03, 0x23, 0xC7, 0x41, 0xDC, 0xA5, 0x97, 0x47,
+    0x50, 0xBA, 0x28, 0xAA, 0x6C, 0x33, 0x4C, 0xAB, 0x2C, 0xA9, 0x33, 0xF0, 0x28, 0xE9, 0x5B, 0xA0,
+    0xEB, 0x4E, 0x50, 0x91, 0x50, 0x05, 0x36, 0xDD, 0xA3, 0xA7, 0xBF, 0xAC, 0xCA, 0x51, 0x5F, 0x47,
+    0x48, 0xBB, 0x69, 0xB0, 0x09, 0xD0, 0x54, 0xDA, 0x65, 0x94, 0x4B, 0x2F, 0xE5, 0x8C, 0x6F, 0x1E,
+    0xCD, 0x3B, 0xC4, 0x2D, 0x83, 0x6D, 0x39, 0x41, 0x11, 0x11, 0x03, 0xC6, 0xE0, 0x0B, 0xB6, 0x17,
+    0xEE, 0x4B, 0x6F, 0x32, 0x07, 0xA1, 0x9C, 0x10, 0x54, 0x22, 0xD0, 0x4B, 0xD3, 0x61, 0x73, 0x9A,
+    0x49, 0x17, 0xED, 0xE1, 0xD2, 0xA1, 0xE8, 0x20, 0xC3, 0xE7, 0x09, 0xFE, 0x72, 0x44, 0x3A, 0xDF,
+    0x88, 0xE9, 0x2A, 0x87, 0xEE, 0x18, 0xEF, 0xEC, 0xE1, 0x25, 0xA6, 0x67, 0x0B, 0xAF, 0xF9, 0x78,
+    0xCF, 0x07, 0xC2, 0xB7, 0x3A, 0x45, 0xDC, 0x84, 0xE1, 0xDB, 0x30, 0x7C, 0x17, 0x49, 0x3A, 0x51,
+    0x62, 0xE7, 0x4A, 0xBC, 0xD4, 0x97, 0x1E, 0x0A, 0xFA, 0x14, 0xF5, 0x09, 0x2D, 0x8D, 0xA9, 0xA5,
+    0xD6, 0x0C, 0xF1, 0xEF, 0xEC, 0x82, 0xAC, 0x4B, 0xAF, 0x55, 0x41, 0xE3, 0x46, 0x36, 0x7A, 0xCD,
+    0xC8, 0x9E, 0x20, 0x3F, 0x9D, 0x29, 0xCB, 0xCD, 0x17, 0x90, 0xD1, 0x7D, 0x17, 0xDD, 0x84, 0xF7,
+    0x4E, 0xD4, 0x10, 0x75, 0x05, 0xDD, 0x2F, 0x6A, 0x32, 0x1A, 0x51, 0x3B, 0xED, 0x62, 0x36, 0x1B,
+    0x22, 0x87, 0x72, 0x14, 0x50, 0xD9, 0xCA, 0xA0, 0x44, 0x00, 0x4B, 0x49, 0x93, 0xE5, 0xCA, 0x67,
+    0x69, 0x54, 0x09, 0x84, 0xF4, 0xEA, 0x98, 0x37, 0x9D, 0xB8, 0xF1, 0x79, 0xD9, 0x29, 0xB9, 0xF5,
+    0xBC, 0x5B, 0x98, 0x9E, 0x1C, 0x7A, 0x4F, 0x51, 0xBE, 0x50, 0xD8, 0xDA, 0x5C, 0xD4, 0x22, 0x52,
+    0x72, 0xCF, 0x80, 0x9B, 0x09, 0x8A, 0xB0, 0xBA, 0xF9, 0xA4, 0xD1, 0xE2, 0xAD, 0xCD, 0x9F, 0xD7,
+    0x99, 0xDE, 0x13, 0x4C, 0x00, 0x0D, 0x54, 0x0C, 0x70, 0x73, 0x67, 0x05, 0x5C, 0x3E, 0x1A, 0xCB,
+    0xB3, 0x17, 0x31, 0x86, 0xC1, 0xC9, 0xE2, 0x0D, 0x20, 0x3C, 0x56, 0xE6, 0x3E, 0x8B, 0x47, 0x8F,
+    0x80, 0x92, 0x31, 0x45, 0xA2, 0x8D, 0x63, 0x62, 0x7E, 0xC0, 0xD3, 0x56, 0x7A, 0x9C, 0x4A, 0x67,
+    0xF4, 0x77, 0x36, 0xD8, 0x3F, 0xF5, 0x7F, 0xE7, 0xBB, 0x29, 0x6B, 0xD7, 0x65, 0xEC, 0xFF, 0x34,
+    0x75, 0xBF, 0x88, 0xAC, 0x19, 0xD9, 0x38, 0x8F, 0xB4, 0xFA, 0x5D, 0xD2, 0xB6, 0xF2, 0xA1, 0x74,
+    0x17, 0x65, 0x91, 0x05, 0x84, 0x72, 0xBC, 0x13, 0xB1, 0x4F, 0x9F, 0xCB, 0x31, 0x83, 0x1C, 0x4E,
+    0x01, 0x39, 0xBC, 0x77, 0xC1, 0xD5, 0xA7, 0x1C, 0x5D, 0x8A, 0x80, 0xEC, 0x09, 0x9D, 0x04, 0x72,
+    0x78, 0x11, 0xE4, 0xF0, 0x29, 0x47, 0x97, 0x72, 0xE4, 0x94, 0x23, 0xA9, 0xE5, 0xF0, 0x29, 0xC7,
+    0x75, 0xCA, 0xF1, 0xCA, 0x81, 0xA0, 0x63, 0xA3, 0xB7, 0x3F, 0xF0, 0xCF, 0x56, 0xD3, 0x16, 0xD3,
+    0x9F, 0x99, 0xCB, 0x90, 0x6C, 0x32, 0xC9, 0x1B, 0x44, 0xCC, 0x90, 0x90, 0xC9, 0x5D, 0x1E, 0xD2,
+    0x48, 0x71, 0x9D, 0x62, 0xDC, 0xFA, 0x24, 0xD3, 0xE4, 0x2D, 0x24, 0x2E, 0x84, 0x5C, 0x18, 0x70,
+    0x61, 0x58, 0x5A, 0xAF, 0x05, 0xEB, 0x3D, 0x99, 0xB2, 0x32, 0xE6, 0xCF, 0x32, 0x67, 0x7D, 0x34,
+    0x40, 0x6C, 0xDA, 0x3D, 0x6E, 0x26, 0x8E, 0x91, 0x79, 0xC7, 0x20, 0x1D, 0xFC, 0x6D, 0xFF, 0x83,
+    0xA5, 0x40, 0xDE, 0x3F, 0x46, 0xE6, 0x76, 0x92, 0x55, 0xB7, 0xF9, 0x75, 0x2C, 0x7C, 0xC7, 0xA5,
+    0xCD, 0xD9, 0x58, 0x2F, 0xD4, 0x98, 0xE7, 0x45, 0x5D, 0x13, 0xC8, 0x21, 0x3E, 0x43, 0x69, 0x82,
+    0x1C, 0xE1, 0x5A, 0x81, 0xAD, 0x42, 0xCB, 0xE1, 0xDD, 0xC1, 0xEB, 0x63, 0x6E, 0xF7, 0x9E, 0x2D,
+    0x9D, 0x24, 0x61, 0xCA, 0x67, 0x75, 0xBA, 0x31, 0x3F, 0x4A, 0x20, 0x7E, 0xCC, 0xD0, 0xFE, 0x03,
+    0xCD, 0xD1, 0x49, 0xE1, 0x1D, 0xC5, 0xA3, 0x95, 0x08, 0x1B, 0x10, 0x0E, 0xCD, 0x23, 0x96, 0xA6,
+    0xDC, 0x41, 0x70, 0x8F, 0x31, 0xA2, 0x79, 0x89, 0xAD, 0x4F, 0x41, 0xE6, 0x89, 0x08, 0xBA, 0xAD,
+    0x47, 0x60, 0xD8, 0x25, 0x45, 0xEE, 0x2A, 0x25, 0xC3, 0x7E, 0xC2, 0xCA, 0xA0, 0x9F, 0x9D, 0x76,
+    0x28, 0x0C, 0xA5, 0xFA, 0x04, 0x0F, 0xDD, 0x7B, 0xA6, 0xB9, 0xCD, 0x88, 0x9C, 0x53, 0x4A, 0xD4,
+    0xA2, 0x48, 0x8A, 0xFB, 0x71, 0x48, 0xDA, 0x2C, 0xAD, 0x88, 0x8E, 0x29, 0xF8, 0xCD, 0x08, 0x51,
+    0xDE, 0xA9, 0x8E, 0x41, 0xCA, 0xA0, 0xCF, 0xCB, 0x6D, 0x16, 0xA2, 0x81, 0xC8, 0xDB, 0xA9, 0x8F,
+    0x6F, 0xCA, 0x6E, 0xAC, 0x3C, 0x05, 0x9A, 0x37, 0x40, 0xE7, 0x2D, 0x6D, 0x15, 0x9F, 0x47, 0xEE,
+    0x83, 0x11, 0x34, 0xEA, 0xD0, 0xCA, 0xA0, 0xDB, 0x64, 0x41, 0x31, 0xBD, 0x32, 0xF2, 0x57, 0x98,
+    0x76, 0x43, 0x6B, 0x2C, 0x7B, 0x6E, 0x2E, 0x9D, 0x3B, 0x7D, 0xF1, 0xF3, 0xFD, 0x2E, 0x6E, 0x57,
+    0x1E, 0xA0, 0x89, 0xF4, 0xD1, 0xD0, 0xE4, 0xF1, 0x8A, 0x82, 0x12, 0x01, 0xEC, 0x98, 0x2E, 0x1D,
+    0x9E, 0xE6, 0x09, 0xD1, 0x66, 0x77, 0xF1, 0x5F, 0x40, 0x4F, 0xBD, 0xB7, 0x38, 0xAC, 0x8C, 0x41,
+    0xB3, 0xDC, 0x3F, 0xD4, 0xD7, 0x61, 0xE8, 0xD5, 0xFB, 0x85, 0x15, 0x60, 0xC5, 0x25, 0xEC, 0x17,
+    0x96, 0x07, 0x65, 0x87, 0x7D, 0x58, 0xBA, 0x97, 0xAD, 0x33, 0xE8, 0x10, 0x3F, 0x1B, 0xE5, 0xEE,
+    0x83, 0x47, 0xF7, 0xF7, 0x94, 0xEE, 0x45, 0xD8, 0x17, 0x74, 0xD8, 0x11, 0x85, 0x56, 0xDE, 0x95,
+    0xF6, 0x28, 0x19, 0x4A, 0x6F, 0x06, 0x1A, 0x63, 0x06, 0x23, 0x6E, 0x63, 0x07, 0x05, 0x6B, 0xCF,
+    0x9B, 0x8A, 0xEE, 0xDC, 0x29, 0x1E, 0x26, 0xFE, 0x97, 0x9F, 0x16, 0x51, 0x25, 0xC6, 0x2D, 0xAB,
+    0xC8, 0xDD, 0xFB, 0xD7, 0x90, 0x19, 0xED, 0xBA, 0x71, 0x2A, 0xBB, 0xA6, 0xBC, 0xDE, 0xEF, 0x76,
+    0x3E, 0x8C, 0xBC, 0x42, 0x5B, 0xE6, 0xE0, 0xC5, 0x44, 0xB6, 0x7C, 0x1F, 0x8D, 0x52, 0xB9, 0x3E,
+    0xA8, 0x5B, 0xCC, 0x32, 0x44, 0xCE, 0x43, 0xA7, 0xCC, 0xFD, 0x72, 0xAC, 0xF4, 0x16, 0xD4, 0x08,
+    0xEC, 0x6C, 0x7B, 0x94, 0x8C, 0x66, 0x46, 0x8C, 0x8A, 0x9A, 0xEE, 0x7C, 0x18, 0x7B, 0x35, 0x73,
+    0xC8, 0x44, 0x8A, 0xA0, 0x5B, 0xE6, 0xF7, 0x8B, 0x2E, 0x47, 0xD6, 0xB4, 0xD0, 0x19, 0x65, 0x76,
+    0x7C, 0xE9, 0x65, 0x96, 0x0F, 0x02, 0xC9, 0xEA, 0x1D, 0xE9, 0x8B, 0xAD, 0x75, 0x63, 0x87, 0xCD,
+    0xD8, 0x26, 0xBE, 0xAE, 0x9B, 0x83, 0xA3, 0xD8, 0xE5, 0xB1, 0x6C, 0x54, 0x1E, 0xCB, 0x36, 0xE1,
+    0xBF, 0xA0, 0xAC, 0x50, 0xCC, 0xE4, 0xA6, 0x69, 0x45, 0xCB, 0x66, 0x61, 0xFD, 0x69, 0x1F, 0x8A,
+    0x44, 0x07, 0x2C, 0x11, 0xB8, 0xF4, 0xC1, 0xE6, 0xB5, 0x3A, 0x6A, 0x44, 0x2D, 0x45, 0xD7, 0xF8,
+    0x86, 0x5C, 0x2A, 0x8D, 0xFB, 0x22, 0x6B, 0x95, 0x1B, 0x29, 0xAF, 0xC6, 0x87, 0x17, 0x62, 0x2A,
+    0x67, 0x6D, 0x2D, 0xFE, 0xAE, 0x16, 0x07, 0xBA, 0xFB, 0x50, 0xFE, 0x3A, 0x1E, 0x2C, 0x36, 0xCA,
+    0x36, 0xF3, 0x2F, 0x6F, 0x00, 0xEB, 0xD0, 0xC4, 0x46, 0x23, 0x2C, 0x42, 0xC0, 0x21, 0x68, 0x01,
+    0xC2, 0x30, 0x11, 0x6A, 0x3B, 0x08, 0xF0, 0x50, 0x6D, 0x0F, 0x0E, 0xED, 0xEC, 0x02, 0x92, 0x67,
+    0x75, 0xA9, 0x40, 0x9B, 0xA0, 0xD2, 0x54, 0x1A, 0xD8, 0x92, 0xAC, 0x5E, 0xD0, 0x65, 0x5E, 0xDC,
+    0x16, 0xFB, 0xF3, 0x42, 0x3B, 0x8F, 0xDE, 0x8A, 0x9D, 0x31, 0x4C, 0x97, 0xF2, 0xCC, 0xCD, 0x8D,
+    0x55, 0x69, 0xC2, 0x0A, 0x7A, 0x69, 0xC8, 0x32, 0x29, 0x08, 0xF6, 0xDD, 0x4A, 0x40, 0xD3, 0xC8,
+    0xB0, 0xEB, 0x2C, 0x0F, 0x6B, 0xE8, 0xB7, 0xDC, 0x7B, 0xB0, 0xE7, 0xEB, 0x76, 0x5B, 0xFC, 0x40,
+    0x7C, 0x94, 0x07, 0x88, 0x94, 0xB3, 0xA9, 0x08, 0x86, 0x32, 0xEC, 0x5A, 0x59, 0x6B, 0x37, 0xF1,
+    0x66, 0xF3, 0xC3, 0x55, 0x84, 0x4C, 0x26, 0xC3, 0x81, 0x95, 0xAC, 0xBC, 0xF0, 0xF2, 0x73, 0x16,
+    0x4A, 0xF0, 0xEB, 0x62, 0x3D, 0x9C, 0x82, 0xF9, 0xB0, 0x8E, 0x1B, 0xEC, 0x7F, 0x73, 0x01, 0x09,
+    0xEC, 0x42, 0xDB, 0xC8, 0x21, 0x16, 0x27, 0x5F, 0x58, 0xA4, 0x4A, 0xCB, 0xB4, 0x8D, 0x65, 0x86,
+    0x4C, 0x68, 0xEE, 0x2F, 0x60, 0x99, 0xA7, 0xC2, 0x20, 0xB2, 0x02, 0x46, 0xE1, 0xD3, 0x10, 0xFC,
+    0xCE, 0xB2, 0x9C, 0xAE, 0x60, 0xBF, 0x65, 0x60, 0xB0, 0x3A, 0x7E, 0xAD, 0x0F, 0x81, 0xAB, 0x6B,
+    0xB9, 0xEA, 0x1B, 0xAA, 0x93, 0x54, 0x39, 0xF5, 0xFB, 0x18, 0x5B, 0x9E, 0xC8, 0x7E, 0xFC, 0xB6,
+    0x76, 0xE3, 0x0E, 0x2C, 0xFD, 0x51, 0xAC, 0xAC, 0x7F, 0xC7, 0xCB, 0xEE, 0xA7, 0x71, 0x03, 0x01,
+    0x13, 0x06, 0x9E, 0x0E, 0x07, 0x0A, 0x29, 0xD5, 0x14, 0x3F, 0x46, 0x01, 0x7F, 0x08, 0xD6, 0x20,
+    0x37, 0xEF, 0xC2, 0xB8, 0xE1, 0x64, 0x05, 0x65, 0x55, 0x95, 0x12, 0xC6, 0x4E, 0xC2, 0x97, 0x68,
+    0xF3, 0x8C, 0xC7, 0x94, 0xE9, 0x3A, 0xE9, 0xB5, 0x65, 0xE3, 0xB5, 0xC0, 0x78, 0xAD, 0x8B, 0xE0,
+    0x7F, 0x0A, 0x63, 0x3D, 0xC0, 0x58, 0xEB, 0x5B, 0x65, 0x66, 0x58, 0x9D, 0xBA, 0x47, 0x47, 0x43,
+    0x93, 0xD5, 0x9F, 0x65, 0x26, 0x84, 0x65, 0xDF, 0x3F, 0x7B, 0x34, 0x34, 0x83, 0xE5, 0xB2, 0x34,
+    0x54, 0xD7, 0xE1, 0xF5, 0xA6, 0x90, 0xDC, 0xCC, 0xF9, 0x4F, 0x5B, 0xC9, 0x75, 0x90, 0xAD, 0xB1,
+    0x9F, 0xE8, 0x0F, 0x14, 0x92, 0x80, 0x27, 0xA4, 0xC8, 0xD7, 0x90, 0x27, 0xA2, 0xE0, 0xBF, 0x14,
+    0x94, 0x65, 0x64, 0x81, 0x3A, 0x26, 0xE5, 0x21, 0x0C, 0x7D, 0xD2, 0xAA, 0x7A, 0x62, 0x24, 0x6D,
+    0x0F, 0x8F, 0x7A, 0x51, 0xE5, 0xAF, 0x6F, 0x1D, 0x5A, 0x9F, 0x17, 0xF9, 0x1B, 0x32, 0xF1, 0xC9,
+    0x7B, 0x19, 0xBA, 0xF5, 0x0C, 0xE2, 0xF1, 0x8C, 0x28, 0x03, 0x40, 0x64, 0x4E, 0x62, 0x65, 0x4E,
+    0x6C, 0x67, 0x04, 0x37, 0x93, 0x8D, 0xA9, 0xAF, 0xD5, 0xF6, 0x4C, 0x94, 0x9F, 0x3F, 0x9F, 0xD4,
+    0x5C, 0x95, 0xBF, 0x03, 0xC3, 0xEF, 0xA6, 0x73, 0xD5, 0x8E, 0x58, 0x8F, 0xFF, 0x01, 0xBD, 0x5A,
+    0x3F, 0x6C, 0x24, 0xE5, 0x15, 0x7F, 0x33, 0xE3, 0x63, 0x50, 0x46, 0xF8, 0x73, 0x71, 0x17, 0x10,
+    0x70, 0x9E, 0x2B, 0x09, 0xB2, 0x77, 0x52, 0x50, 0xB8, 0x98, 0xDD, 0xFD, 0x10, 0x52, 0x52, 0x5C,
+    0x91, 0x2D, 0x70, 0x95, 0x82, 0x94, 0x49, 0x8A, 0x40, 0x71, 0xC5, 0x46, 0xDA, 0xBB, 0x1D, 0x42,
+    0x41, 0x41, 0x01, 0x05, 0x28, 0x25, 0x57, 0x50, 0x90, 0xA3, 0x38, 0x47, 0x72, 0xA4, 0x91, 0xE2,
+    0x63, 0x07, 0x28, 0xAE, 0xB8, 0x22, 0x13, 0x11, 0x74, 0x45, 0xA4, 0x63, 0x08, 0x9C, 0xF2, 0xA7,
+    0x08, 0xA3, 0x64, 0x4E, 0x2C, 0x60, 0xEF, 0xE4, 0xF7, 0xDE, 0xF7, 0xCD, 0x7A, 0xED, 0xB3, 0xC3,
+    0xD9, 0xB7, 0xBE, 0xB5, 0x67, 0xE5, 0x5D, 0xCF, 0xF7, 0xDE, 0xEF, 0xBD, 0xEF, 0xFD, 0xFF, 0x86,
+    0x68, 0xB8, 0x43, 0x34, 0xDA, 0x26, 0x79, 0xA9, 0x84, 0x28, 0xCC, 0x88, 0xBA, 0xB8, 0xFE, 0x88,
+    0xEB, 0xBF, 0x19, 0xB9, 0x9F, 0xE7, 0xE4, 0x7D, 0x98, 0x53, 0xF0, 0x9B, 0x82, 0x42, 0xA7, 0xA0,
+    0x8E, 0x53, 0xD2, 0xA5, 0x2B, 0x25, 0xD5, 0x75, 0xE9, 0xDC, 0x59, 0x2F, 0xBD, 0x9C, 0xAA, 0x20,
+    0xA3, 0x4A, 0x69, 0x4A, 0x23, 0xA2, 0xB4, 0x4D, 0x34, 0x10, 0x92, 0x43, 0x4B, 0xF2, 0x71, 0x47,
+    0x3B, 0xF5, 0xCD, 0xC4, 0xBF, 0x3D, 0xD2, 0x4A, 0x77, 0x29, 0xC2, 0x4F, 0x9B, 0x5A, 0xB8, 0xA9,
+    0x45, 0x29, 0xFE, 0x4A, 0xF1, 0x57, 0x45, 0xDB, 0x94, 0x3A, 0x63, 0xDA, 0xF2, 0x2B, 0xEA, 0x5E,
+    0xDB, 0xA0, 0xB0, 0x2A, 0xCD, 0x5A, 0x5A, 0x3A, 0x45, 0x74, 0xE1, 0x2C, 0xF0, 0x80, 0x58, 0x50,
+    0xCC, 0x15, 0xE3, 0x39, 0x90, 0x7E, 0x66, 0x79, 0x2F, 0xE9, 0xFB, 0xC2, 0x3A, 0x27, 0x5C, 0x44,
+    0x00, 0xE3, 0x81, 0x96, 0x22, 0x73, 0x31, 0x38, 0x47, 0x1F, 0x1B, 0x9B, 0x0B, 0x28, 0x01, 0xC8,
+    0x9C, 0xB5, 0x97, 0xCA, 0x84, 0x9C, 0x79, 0x01, 0x0F, 0x79, 0x99, 0xE1, 0xB3, 0x62, 0xBE, 0x72,
+    0xEB, 0x82, 0xA2, 0x7A, 0x4C, 0x13, 0x3A, 0xE7, 0xE2, 0xBF, 0x7E, 0x6E, 0x25, 0xC3, 0xBF, 0x80,
+    0x11, 0x9C, 0xCC, 0x15, 0xDB, 0x8B, 0xFF, 0xEE, 0xD8, 0xFF, 0x31, 0x69, 0x7F, 0x32, 0x21, 0xA7,
+    0xDE, 0xA1, 0xE9, 0x6B, 0x4C, 0x6E, 0x41, 0x7E, 0x42, 0x8B, 0x46, 0xC3, 0x6F, 0x38, 0x75, 0xE5,
+    0x7F, 0xF1, 0x33, 0x88, 0xDC, 0x11, 0x02, 0x10, 0x38, 0x25, 0x20, 0xE7, 0xDF, 0x54, 0x3E, 0x76,
+    0xDF, 0x4B, 0x82, 0x5A, 0x4F, 0xD7, 0x47, 0xF8, 0x73, 0x04, 0x55, 0xFE, 0x2D, 0x27, 0x5F, 0x6F,
+    0x9C, 0x04, 0x44, 0x7C, 0xD7, 0xC5, 0x4E, 0x94, 0x6E, 0xF2, 0xCC, 0xD1, 0x21, 0xC2, 0x8A, 0x84,
+    0x31, 0x5F, 0x0B, 0xF3, 0xD7, 0xA0, 0x23, 0x6B, 0x01, 0xC5, 0x39, 0x9E, 0xFA, 0xDC, 0xBC, 0x4F,
+    0xF4, 0x1F, 0x58, 0xD0, 0x10, 0x08, 0x5A, 0x27, 0xB2, 0xC3, 0xE5, 0x0A, 0xF5, 0x4B, 0xB6, 0xFA,
+    0x50, 0x1F, 0x0B, 0xA2, 0x97, 0x6D, 0x92, 0xF3, 0x39, 0x08, 0x8F, 0x2C, 0x33, 0xBC, 0xEA, 0x7F,
+    0x80, 0x45, 0x9D, 0xB8, 0x45, 0x58, 0x78, 0xB9, 0x5B, 0xC2, 0x44, 0xC7, 0x7E, 0x46, 0x5B, 0x41,
+    0x42, 0x03, 0xD0, 0xE5, 0x6B, 0x0B, 0x26, 0x9B, 0x02, 0xF2, 0xB8, 0x05, 0x23, 0x6E, 0x93, 0x57,
+    0xC6, 0x14, 0xE4, 0x31, 0x45, 0xC9, 0xC0, 0x99, 0xD0, 0xA8, 0xAE, 0xA8, 0x9E, 0x68, 0x31, 0x70,
+    0x76, 0x01, 0xD8, 0x0E, 0x79, 0x1F, 0x43, 0x46, 0xEF, 0x06, 0x19, 0x83, 0x7F, 0x1C, 0xE4, 0x9C,
+    0xFA, 0xAF, 0x09, 0x05, 0xF0, 0x27, 0x62, 0x87, 0x02, 0xDA, 0x88, 0xC4, 0xA5, 0x00, 0x71, 0x95,
+    0xC4, 0xA9, 0xC4, 0xAB, 0xC4, 0xAD, 0xC4, 0xAF, 0xC4, 0xB1, 0xC4, 0xB3, 0x66, 0xDC, 0x9E, 0xBA,
+    0xDF, 0x40, 0xBB, 0x50, 0x69, 0xEA, 0x8F, 0x71, 0xEB, 0x16, 0x95, 0xE2, 0xE6, 0x11, 0xAC, 0x3E,
+    0x84, 0x83, 0x87, 0x51, 0x9D, 0x45, 0xDD, 0x3A, 0x6B, 0x81, 0x61, 0xC7, 0xE2, 0xDF, 0x56, 0xE4,
+    0x56, 0x0A, 0x8E, 0x1D, 0x62, 0x5B, 0x22, 0xA8, 0xB2, 0x5B, 0xBF, 0x61, 0x9D, 0x11, 0xAB, 0xBC,
+    0x7A, 0x9B, 0x7C, 0x5C, 0x8C, 0xF3, 0x69, 0x3F, 0x73, 0x81, 0x32, 0x28, 0x46, 0x3A, 0x04, 0x46,
+    0x86, 0x18, 0x8B, 0xD3, 0xAF, 0x7E, 0x77, 0x40, 0x8A, 0x6A, 0x73, 0x89, 0x3E, 0xEB, 0xC4, 0xE8,
+    0x13, 0x54, 0x73, 0xA3, 0x01, 0x9F, 0xE3, 0x02, 0x87, 0x99, 0xB7, 0x7A, 0xA4, 0x60, 0x0D, 0xEA,
+    0xCA, 0x3B, 0x62, 0x02, 0xAD, 0x7D, 0xDB, 0xCF, 0x11, 0x69, 0x54, 0xE7, 0x20, 0x81, 0x05, 0xB8,
+    0x0F, 0xAA, 0xE5, 0x5D, 0x46, 0x30, 0x2A, 0xFD, 0xCF, 0xC6, 0x4A, 0xF7, 0x11, 0x7F, 0x62, 0xB7,
+    0xBC, 0x34, 0xCA, 0x47, 0x13, 0x38, 0xFB, 0x74, 0x97, 0x75, 0xF7, 0xBD, 0x2C, 0xA8, 0x13, 0xBE,
+    0xF9, 0x34, 0xE2, 0xCD, 0x8A, 0x0F, 0x35, 0x4F, 0x88, 0x1E, 0xAA, 0xE6, 0x8B, 0x48, 0x3F, 0x4C,
+    0xC5, 0x0A, 0x8D, 0x2A, 0x0A, 0x93, 0x23, 0xE3, 0xA2, 0x1E, 0x9B, 0xAF, 0x51, 0x3C, 0xE9, 0xF9,
+    0xE2, 0x82, 0xBF, 0x22, 0xB4, 0x63, 0x99, 0x75, 0xDC, 0xA3, 0xE0, 0x9A, 0x17, 0x06, 0x0E, 0xB9,
+    0x6B, 0xB8, 0x36, 0xEC, 0x35, 0xB4, 0xF1, 0xEA, 0xDE, 0xC1, 0xC0, 0x0F, 0x2E, 0x88, 0x8A, 0xF0,
+    0x8B, 0xCD, 0x3B, 0x6D, 0x74, 0x74, 0x16, 0xE1, 0x5C, 0xFD, 0x0A, 0xC0, 0xC6, 0x62, 0xB0, 0x73,
+    0xD5, 0x1B, 0xEF, 0xC8, 0x2A, 0xC5, 0x15, 0x45, 0x39, 0x87, 0xBD, 0x23, 0x6F, 0xA9, 0x0D, 0xE8,
+    0x1C, 0xD1, 0x09, 0xBE, 0xEF, 0x99, 0x98, 0x8E, 0x98, 0x07, 0x8A, 0xF0, 0xB4, 0x09, 0x3D, 0xE6,
+    0x56, 0x7B, 0x63, 0x9E, 0x81, 0x73, 0xE6, 0xF9, 0x36, 0x75, 0xAB, 0x98, 0x9E, 0xC6, 0x45, 0x08,
+    0x28, 0x4E, 0xD9, 0x81, 0x6C, 0x11, 0x84, 0x51, 0x99, 0x97, 0xF9, 0x13, 0x60, 0x1B, 0x4D, 0x76,
+    0xB3, 0x12, 0x47, 0x03, 0x0F, 0x3E, 0x1A, 0x22, 0x0C, 0xAD, 0xF9, 0xE6, 0xFB, 0x87, 0x92, 0x1E,
+    0x0D, 0xEF, 0x14, 0xEE, 0xD7, 0x2F, 0xE6, 0xBC, 0x2A, 0xC0, 0x8F, 0xD2, 0x41, 0x12, 0x82, 0x53,
+    0x0B, 0xB2, 0xB4, 0xC0, 0x0D, 0x3C, 0xC0, 0xEF, 0x12, 0x45, 0xCE, 0x0E, 0xA9, 0x2F, 0x07, 0xE4,
+    0xEF, 0x34, 0x0A, 0x48, 0xC5, 0x14, 0x7B, 0x5E, 0x81, 0x58, 0x92, 0x51, 0x24, 0xE1, 0x35, 0x41,
+    0x42, 0x29, 0xB0, 0x81, 0x35, 0xB4, 0x1F, 0x25, 0x73, 0x97, 0x63, 0x01, 0x6E, 0x79, 0x96, 0xDD,
+    0x12, 0x41, 0xC2, 0x1D, 0xD3, 0xC9, 0xC8, 0xE0, 0xD8, 0xCA, 0x88, 0xF7, 0xD2, 0xA1, 0xF9, 0xEF,
+    0xC5, 0x12, 0x89, 0x1D, 0x50, 0xB9, 0x5B, 0x71, 0xCC, 0x5D, 0x86, 0x39, 0x63, 0x3E, 0x65, 0x0B,
+    0xBB, 0x55, 0xEB, 0x9E, 0xE7, 0x1A, 0xE0, 0x4F, 0xDA, 0x2F, 0x38, 0x24, 0x15, 0x27, 0x27, 0x0B,
+    0x9C, 0x43, 0x3C, 0x96, 0xF3, 0xE1, 0xC7, 0x52, 0x1D, 0x16, 0x4D, 0x2A, 0x07, 0x2E, 0x04, 0xC3,
+    0x90, 0xBD, 0xBA, 0xC5, 0x7E, 0xDC, 0x66, 0x47, 0x8E, 0xD9, 0x93, 0x63, 0x76, 0xE5, 0x01, 0x05,
+    0x6F, 0xAD, 0xA7, 0x30, 0x18, 0x68, 0x43, 0x5D, 0xB9, 0xC2, 0x77, 0xE2, 0xF6, 0x16, 0xDF, 0xDE,
+    0x46, 0xA9, 0x81, 0x9B, 0x3C, 0x79, 0xCB, 0x70, 0x27, 0xD6, 0xA4, 0xBC, 0xA6, 0xB2, 0x6E, 0x6C,
+    0xB8, 0x82, 0x29, 0xF3, 0xDC, 0x65, 0x39, 0x03, 0xB5, 0xD9, 0x46, 0x11, 0xFF, 0xE7, 0xE4, 0xDE,
+    0xAC, 0xB5, 0xF7, 0xEF, 0x9F, 0x66, 0x5E, 0x05, 0xFD, 0x15, 0x1E, 0x24, 0xF7, 0xB3, 0x20, 0x09,
+    0x12, 0x85, 0xFA, 0x57, 0x01, 0x28, 0x74, 0x40, 0x46, 0xFE, 0x16, 0x78, 0xB6, 0x71, 0xC5, 0x56,
+    0x82, 0xA2, 0x91, 0xA0, 0x5B, 0xD7, 0x75, 0x31, 0xC4, 0x5B, 0xEE, 0x33, 0x24, 0x91, 0x40, 0xBD,
+    0xB5, 0x3E, 0x3E, 0x44, 0x02, 0x28, 0xEA, 0x70, 0x09, 0x2C, 0x4A, 0x9F, 0x17, 0x72, 0x0E, 0x14,
+    0x94, 0xCF, 0x93, 0xFB, 0x71, 0x4D, 0xDE, 0xA7, 0x2F, 0x64, 0x1E, 0x0A, 0x14, 0x46, 0xE9, 0xDF,
+    0x0B, 0xCA, 0x05, 0x78, 0xC2, 0xF0, 0x15, 0x4D, 0xDF, 0xD6, 0xE4, 0x64, 0x7D, 0xA3, 0x05, 0xA4,
+    0x30, 0x1A, 0x16, 0xC6, 0x32, 0xF6, 0x47, 0x49, 0xE6, 0xDD, 0xDF, 0xAB, 0x25, 0x5B, 0x2C, 0x4C,
+    0x83, 0xED, 0x13, 0x5F, 0x98, 0x96, 0xCB, 0xA1, 0x25, 0x55, 0x14, 0xED, 0x3A, 0xFB, 0xE1, 0xB2,
+    0x4D, 0x71, 0x5C, 0x52, 0xE4, 0x7C, 0x0F, 0xE4, 0x41, 0xE0, 0x0E, 0xA4, 0x9C, 0x54, 0xC2, 0xA4,
+    0x25, 0x2C, 0x62, 0xC3, 0x04, 0x4D, 0x9B, 0xE9, 0xD9, 0x80, 0x04, 0x40, 0xF6, 0xDD, 0x31, 0x10,
+    0x04, 0xA6, 0x90, 0x2B, 0x99, 0xFB, 0x94, 0x2C, 0x38, 0x63, 0x9D, 0xAA, 0x93, 0xD0, 0xD4, 0x74,
+    0xF7, 0xCE, 0x11, 0xDD, 0x1D, 0x9A, 0x3B, 0x34, 0x60, 0xA6, 0xFF, 0x3A, 0x16, 0xDF, 0x87, 0x49,
+    0x2F, 0x7A, 0x09, 0x42, 0x98, 0x8D, 0x60, 0xF7, 0xCE, 0xFD, 0x58, 0xEC, 0xD0, 0x4D, 0x29, 0xE9,
+    0xA3, 0x56, 0xA5, 0xD9, 0xE3, 0x46, 0x6A, 0x01, 0xAB, 0x3B, 0x52, 0xFB, 0x9F, 0xC6, 0xC2, 0x8A,
+    0x4A, 0xA7, 0x74, 0x0A, 0x17, 0x75, 0xAB, 0x27, 0xA6, 0x60, 0xCC, 0x60, 0x11, 0x8E, 0xBD, 0x01,
+    0x8A, 0x23, 0x3A, 0x23, 0xB5, 0x86, 0xA1, 0x39, 0xDD, 0xF9, 0xA3, 0x03, 0xA1, 0x5E, 0xC3, 0xC2,
+    0x37, 0xD6, 0x86, 0xD5, 0xAD, 0xC6, 0xBE, 0x46, 0xA8, 0x2E, 0x41, 0x33, 0x24, 0x31, 0x3E, 0xB1,
+    0x3E, 0x31, 0x3F, 0xF9, 0x3F, 0x7E, 0x07, 0x4C, 0x3F, 0x65, 0x0E, 0x92, 0x42, 0x61, 0x4A, 0x15,
+    0xDB, 0x13, 0x90, 0x83, 0x13, 0x18, 0x31, 0x69, 0x62, 0xEA, 0xC4, 0x0C, 0xC0, 0x11, 0x4A, 0x1C,
+    0x6E, 0x8B, 0x1F, 0xCB, 0x1B, 0xB7, 0x02, 0x67, 0xAE, 0xB1, 0x4B, 0x8F, 0xA5, 0xE2, 0xE7, 0xBD,
+    0x84, 0x2A, 0x52, 0xDF, 0xD4, 0xE9, 0x4B, 0x36, 0xD0, 0xF7, 0x4E, 0x81, 0x92, 0x02, 0xA1, 0x10,
+    0x74, 0x5A, 0xD8, 0x8F, 0x36, 0x36, 0x84, 0x03, 0x09, 0xBC, 0x50, 0xF7, 0x81, 0x6D, 0x13, 0xD0,
+    0x2A, 0x20, 0x2B, 0xA9, 0x0D, 0xD6, 0x31, 0x38, 0xC7, 0xAE, 0xB5, 0xE7, 0xA6, 0x80, 0x00, 0x3F,
+    0x77, 0x26, 0x3F, 0x1D, 0x1C, 0x45, 0xE2, 0xBB, 0xA3, 0x48, 0xE3, 0x1F, 0x07, 0x16, 0x24, 0x7A,
+    0xB7, 0xBB, 0xDE, 0xEF, 0x6A, 0x5B, 0x44, 0x3F, 0x02, 0x09, 0xD4, 0xF3, 0x74, 0x65, 0x1A, 0xA1,
+    0xB8, 0x18, 0x47, 0xF4, 0x54, 0x3F, 0x21, 0x7A, 0xCA, 0xB3, 0xD1, 0xAC, 0x77, 0x37, 0x6D, 0x58,
+    0x1B, 0x05, 0x7A, 0x97, 0xFE, 0x61, 0xC5, 0x8E, 0x85, 0xC9, 0x10, 0xB9, 0x4C, 0xE9, 0x6A, 0x81,
+    0x9C, 0xC2, 0x6A, 0xA0, 0xFC, 0x20, 0xF3, 0x72, 0xA4, 0x8D, 0x6C, 0x8B, 0xFC, 0x0F, 0x4B, 0x0A,
+    0x5E, 0x83, 0xC1, 0xBD, 0x48, 0x52, 0x3A, 0xAB, 0x2F, 0x41, 0xF2, 0x7C, 0x42, 0xDC, 0x4A, 0xB4,
+    0x39, 0x4C, 0xA1, 0x7B, 0x8B, 0x41, 0x88, 0xB7, 0xD2, 0x74, 0x02, 0x1D, 0x9A, 0x2D, 0x6B, 0x45,
+    0x95, 0x89, 0x4D, 0xBB, 0x07, 0xA8, 0xC7, 0x29, 0x4E, 0x69, 0x74, 0x58, 0xDA, 0xCB, 0x2F, 0x92,
+    0xF7, 0x41, 0x45, 0xFE, 0xF5, 0x9C, 0x82, 0xB7, 0x35, 0x05, 0xEF, 0x93, 0xD4, 0x04, 0xEA, 0x75,
+    0x4D, 0x21, 0x78, 0xB5, 0x38, 0x11, 0x58, 0x5E, 0xB1, 0x10, 0x21, 0x53, 0x0A, 0x56, 0x26, 0x4F,
+    0xB1, 0xF8, 0xAE, 0xD9, 0xEF, 0x63, 0xD3, 0xF3, 0xA5, 0xDA, 0x83, 0xA2, 0x5E, 0xB2, 0x89, 0xC8,
+    0x29, 0xF6, 0x38, 0xB2, 0xF5, 0xE2, 0x83, 0x1C, 0x79, 0x20, 0xD5, 0xA3, 0x2D, 0x1E, 0xBD, 0x92,
+    0xCB, 0xEE, 0xD0, 0xE4, 0xD1, 0x26, 0xBB, 0x34, 0x5E, 0xB4, 0xCF, 0x91, 0x0C, 0xD9, 0xE0, 0x10,
+    0xB2, 0xC7, 0xC7, 0xD0, 0x63, 0xCD, 0x43, 0xF1, 0x01, 0x21, 0x3A, 0xD1, 0x8C, 0x5F, 0x0E, 0x9A,
+    0xF8, 0xE0, 0x16, 0x6E, 0xBE, 0x37, 0x3E, 0x70, 0x55, 0xB0, 0x8C, 0x5B, 0x5E, 0xE2, 0xCD, 0x2B,
+    0x17, 0x9D, 0x62, 0xD5, 0x2D, 0xD6, 0xBC, 0x7C, 0xE3, 0x08, 0x9C, 0x07, 0x20, 0x5F, 0xD1, 0x9D,
+    0x82, 0xFE, 0x9B, 0xCC, 0x43, 0x50, 0xAD, 0x9E, 0x2D, 0x95, 0x5B, 0x86, 0xA4, 0x0F, 0x61, 0x77,
+    0x88, 0x5E, 0x3F, 0x20, 0xFF, 0x46, 0x12, 0xBC, 0x9E, 0x04, 0xCF, 0x1E, 0xC2, 0xCE, 0x2C, 0xDC,
+    0x17, 0xD9, 0x6E, 0x26, 0x5E, 0xAD, 0xD1, 0xC1, 0x46, 0x28, 0x93, 0x12, 0x9E, 0x24, 0x28, 0xB2,
+    0x6B, 0xA3, 0xBA, 0xEA, 0xA2, 0x00, 0xB6, 0xBA, 0x33, 0xDA, 0xF3, 0xFE, 0xE2, 0x6D, 0xFB, 0x55,
+    0x94, 0x71, 0x57, 0xBC, 0x27, 0xF0, 0xD9, 0x17, 0x1B, 0x39, 0x3B, 0xA6, 0x78, 0xA3, 0x4C, 0xBD,
+    0xA4, 0x14, 0x85, 0x49, 0x26, 0x08, 0x24, 0x41, 0xE2, 0x22, 0x5F, 0x69, 0x78, 0x34, 0x62, 0xD3,
+    0xA7, 0x58, 0xEE, 0xBF, 0x0E, 0xDD, 0x07, 0xAF, 0x25, 0xAB, 0xA4, 0x7E, 0x8C, 0x18, 0xA5, 0xBC,
+    0x3C, 0x26, 0xE5, 0x16, 0x03, 0x7C, 0x5B, 0xA6, 0x88, 0xF4, 0xD5, 0x26, 0xE8, 0xF7, 0xD9, 0x60,
+    0x63, 0x06, 0xD2, 0x2A, 0x11, 0x38, 0xC3, 0x02, 0xD1, 0x4B, 0xE5, 0x24, 0xF6, 0xB6, 0x3B, 0x00,
+    0x8C, 0x6C, 0xA6, 0x36, 0x81, 0xC9, 0xD1, 0xBF, 0x33, 0x65, 0xCC, 0x97, 0x4D, 0x81, 0xE0, 0x4B,
+    0x19, 0xA3, 0x4C, 0xC8, 0x4E, 0xB0, 0xF3, 0x3A, 0x14, 0xFC, 0x66, 0x98, 0xD7, 0xC6, 0xCF, 0x00,
+    0x6C, 0x4E, 0x1A, 0xE9, 0x99, 0x26, 0x68, 0x0A, 0x56, 0x53, 0x3B, 0x27, 0xF7, 0x81, 0x77, 0x1A,
+    0x11, 0xFA, 0x36, 0xBA, 0xE4, 0x33, 0x33, 0x46, 0x7C, 0xE2, 0xE0, 0xF3, 0x07, 0xE6, 0xC2, 0xB3,
+    0x51, 0xD1, 0xD1, 0x03, 0xD8, 0x0F, 0x05, 0x2F, 0x04, 0x25, 0x72, 0xB7, 0xAD, 0x45, 0x1C, 0x5F,
+    0xBE, 0xC0, 0x24, 0x22, 0x09, 0xE8, 0x12, 0xCC, 0x7B, 0x4F, 0xEB, 0x8D, 0x3B, 0x75, 0xAE, 0xBF,
+    0xFD, 0x6D, 0x49, 0x3B, 0xC8, 0xF7, 0x63, 0x58, 0x25, 0x2C, 0xD3, 0x33, 0x79, 0x1F, 0xD5, 0x26,
+    0x5F, 0x52, 0x08, 0x66, 0xBB, 0x74, 0xD5, 0x77, 0x49, 0x7C, 0x9E, 0x25, 0x7E, 0x6E, 0x2A, 0xB1,
+    0xB3, 0x2B, 0xF1, 0x26, 0x4B, 0x3C, 0x60, 0x89, 0xDB, 0x2C, 0x71, 0xC4, 0x12, 0xAB, 0xA9, 0xC4,
+    0x9C, 0x7B, 0xCC, 0x1B, 0x9B, 0xE0, 0x29, 0x6E, 0xF3, 0x15, 0x17, 0xFB, 0xDF, 0xE3, 0xC4, 0xAC,
+    0x7F, 0x41, 0xEE, 0x75, 0x88, 0x7C, 0x6B, 0xB7, 0x92, 0xBE, 0xA7, 0x1A, 0x55, 0x32, 0xC6, 0x40,
+    0x06, 0xB8, 0x26, 0x53, 0xC1, 0xA4, 0xBB, 0x9C, 0x4D, 0xB8, 0xF8, 0x75, 0xEB, 0xA6, 0xDF, 0xF2,
+    0xB9, 0x8D, 0xE8, 0xF2, 0x77, 0x3B, 0x48, 0x93, 0x08, 0xBF, 0x1D, 0xD6, 0x56, 0x64, 0x7C, 0xBF,
+    0x29, 0x40, 0x14, 0x6B, 0x4D, 0xDE, 0x42, 0x26, 0xCD, 0x43, 0x2C, 0xDC, 0x87, 0x8F, 0x17, 0x39,
+    0x65, 0x6D, 0xE3, 0x0B, 0xA4, 0x03, 0x74, 0x37, 0xD8, 0xB0, 0x09, 0x17, 0x91, 0xA3, 0x69, 0xB6,
+    0x1F, 0x6D, 0xF3, 0xCC, 0xC9, 0x4E, 0x01, 0xAA, 0xE0, 0xF6, 0x56, 0xA8, 0x3B, 0x1D, 0x0A, 0x63,
+    0x0A, 0x07, 0x14, 0xA6, 0xD4, 0x42, 0xCE, 0x43, 0x12, 0x41, 0xFE, 0x1B, 0x38, 0x65, 0x74, 0x35,
+    0x0F, 0x26, 0x66, 0x99, 0x3E, 0xCD, 0x66, 0x77, 0x81, 0x4C, 0xEF, 0xDC, 0x34, 0xCF, 0x27, 0x8E,
+    0xB6, 0xB7, 0x40, 0x1B, 0x2B, 0x34, 0x1C, 0xD3, 0x13, 0x6F, 0x1C, 0x1D, 0xB3, 0x31, 0xDA, 0xF3,
+    0x3C, 0xA7, 0x65, 0x3B, 0xEB, 0x73, 0x06, 0xCB, 0x2F, 0x3F, 0x18, 0xE0, 0x92, 0x3A, 0x3F, 0x42,
+    0x0E, 0x3E, 0xAF, 0x69, 0x15, 0xF1, 0xF2, 0xA5, 0x67, 0xEC, 0x81, 0x88, 0x96, 0xFD, 0x86, 0x0C,
+    0x88, 0xC9, 0x1D, 0x50, 0x61, 0xC2, 0x21, 0xCC, 0x22, 0x44, 0x38, 0x6E, 0x49, 0xC5, 0x61, 0x72,
+    0x38, 0xEA, 0x0F, 0x1E, 0x7A, 0x5E, 0x45, 0xC6, 0x9F, 0x15, 0x87, 0x81, 0xA3, 0xFB, 0x92, 0x46,
+    0x2C, 0x03, 0x74, 0x3E, 0x6E, 0xE0, 0x2A, 0x13, 0xE0, 0xB9, 0x78, 0x52, 0x9A, 0xDF, 0x43, 0x89,
+    0xD5, 0xE8, 0x37, 0x3F, 0x79, 0x1E, 0x60, 0x7D, 0x74, 0xD9, 0x6D, 0x0A, 0xFE, 0xF5, 0x2E, 0xE8,
+    0xB2, 0xCF, 0xC5, 0x92, 0x1D, 0xDB, 0xF2, 0xDE, 0xB1, 0x43, 0xEA, 0x96, 0x0C, 0x79, 0xD8, 0x13,
+    0x21, 0x08, 0xEF, 0xF0, 0xA8, 0x9E, 0x1A, 0x24, 0x30, 0x3F, 0xC4, 0x23, 0xE8, 0xEE, 0x4E, 0x70,
+    0xFB, 0xDA, 0xD7, 0x51, 0xA8, 0xBB, 0x79, 0x88, 0x75, 0x09, 0xEB, 0x9F, 0x2E, 0x22, 0x50, 0x5C,
+    0xAD, 0x52, 0x24, 0x95, 0x84, 0xEB, 0x4E, 0x53, 0x32, 0xA5, 0x3C, 0x79, 0x1E, 0x38, 0xB5, 0x5E,
+    0x8A, 0xAE, 0xDE, 0xF8, 0xA6, 0x0A, 0x26, 0x3C, 0x20, 0x9F, 0xD9, 0x92, 0xC4, 0xCC, 0xBF, 0xB9,
+    0x50, 0xC9, 0xED, 0xB0, 0xEB, 0x0B, 0x1E, 0x4F, 0x23, 0x71, 0x85, 0xE2, 0xE8, 0x1E, 0x77, 0xF8,
+    0xB8, 0x82, 0xC4, 0x37, 0xEE, 0xBE, 0xFE, 0xBE, 0xF4, 0x88, 0xE1, 0x7B, 0x4D, 0xB1, 0x83, 0xC2,
+    0xD6, 0x69, 0x8A, 0xB5, 0x2D, 0x50, 0x8A, 0x77, 0x8B, 0x35, 0x19, 0x30, 0xE3, 0xA6, 0xC0, 0x18,
+    0xEE, 0x3B, 0xEE, 0xF5, 0xCA, 0xBB, 0xD5, 0xF3, 0x10, 0x29, 0x8A, 0x99, 0xD4, 0x7F, 0x77, 0x1A,
+    0x9D, 0x27, 0x86, 0x7D, 0x05, 0xA3, 0x14, 0x73, 0x4B, 0x3F, 0xA0, 0xDF, 0xEF, 0xD0, 0x57, 0x6F,
+    0x62, 0xD7, 0x9C, 0xF1, 0x01, 0xE5, 0x84, 0x6A, 0x72, 0xB4, 0x99, 0x68, 0x2C, 0x0B, 0xAA, 0x0B,
+    0x86, 0x16, 0xBF, 0x16, 0xF9, 0xCE, 0xB7, 0xCD, 0x94, 0xCC, 0x29, 0xE7, 0xAF, 0xB7, 0x0B, 0xCC,
+    0x11, 0x7B, 0x82, 0x30, 0x28, 0x45, 0xBD, 0xD1, 0x1E, 0x62, 0x1D, 0xB4, 0x79, 0xAB, 0x47, 0x1E,
+    0x4F, 0x69, 0x8A, 0xBB, 0x6B, 0xFE, 0x83, 0x6A, 0x72, 0xBB, 0xCF, 0x7A, 0xBA, 0xCF, 0x8E, 0xDD,
+    0xE7, 0x70, 0xA2, 0x79, 0xB0, 0xE9, 0x56, 0xAE, 0x66, 0x13, 0xF5, 0x6D, 0x9D, 0xEF, 0x15, 0xB6,
+    0x21, 0x19, 0x71, 0x4E, 0x68, 0x3E, 0x6C, 0xCD, 0x50, 0xDC, 0xA2, 0x1E, 0x94, 0x36, 0x1A, 0xF1,
+    0xE4, 0x45, 0xCF, 0x9E, 0x85, 0x61, 0x29, 0xD0, 0x3C, 0x22, 0x9F, 0x7E, 0xA9, 0xBD, 0xBA, 0x54,
+    0x7F, 0xBE, 0x6C, 0x36, 0x17, 0x66, 0xC6, 0xA7, 0x0B, 0xF0, 0x9E, 0x30, 0x61, 0x2E, 0x5E, 0xA6,
+    0x83, 0xEC, 0x9B, 0x91, 0x1E, 0xED, 0xDC, 0x35, 0x74, 0x54, 0x33, 0x43, 0xC7, 0x39, 0x43, 0x04,
+    0x0A, 0xB4, 0x24, 0x65, 0x69, 0xE7, 0xA6, 0x47, 0x86, 0x38, 0x2F, 0x38, 0x85, 0x1D, 0x81, 0xA5,
+    0x66, 0x24, 0x76, 0x6A, 0x93, 0x38, 0xD5, 0x1D, 0x01, 0x10, 0xEC, 0x18, 0xED, 0x18, 0x87, 0x97,
+    0x92, 0xBE, 0x5F, 0x98, 0x1E, 0xCB, 0x5A, 0x65, 0xF0, 0xC2, 0x5E, 0xAB, 0x9C, 0xB3, 0x0A, 0x8B,
+    0x98, 0x7E, 0x6D, 0xCE, 0xC3, 0x8E, 0xBC, 0xCB, 0x61, 0x5D, 0x17, 0x11, 0xC7, 0xCB, 0x83, 0xAC,
+    0xB5, 0x7D, 0x78, 0xA3, 0xBB, 0x7F, 0x18, 0xC4, 0x4E, 0xCC, 0xF6, 0x21, 0xC3, 0x79, 0x5C, 0x8F,
+    0x36, 0x5D, 0xE6, 0x92, 0x34, 0x58, 0xF0, 0xE5, 0x3B, 0x3A, 0xAA, 0x33, 0xFF, 0xF6, 0x4C, 0x77,
+    0xB0, 0x37, 0xCE, 0xF0, 0xD4, 0xE0, 0x5D, 0x0A, 0x60, 0xB0, 0x9A, 0x8B, 0x68, 0xB4, 0x67, 0xF0,
+    0x89, 0x47, 0xB3, 0xA9, 0x1E, 0xCB, 0x15, 0xE2, 0x0A, 0x4C, 0x0A, 0x3A, 0x73, 0xEE, 0x07, 0x1D,
+    0xD4, 0x09, 0xE2, 0xB0, 0x3E, 0x10, 0xE8, 0x21, 0x53, 0x2B, 0xFF, 0x80, 0xAE, 0x5C, 0xF0, 0xE5,
+    0xF4, 0x5C, 0xE2, 0xDC, 0xE0, 0x7B, 0x82, 0x4F, 0x10, 0xDD, 0x29, 0x7C, 0x73, 0x0F, 0xB6, 0xF6,
+    0xCC, 0xC9, 0x22, 0x7E, 0x2F, 0x5D, 0xA6, 0xA8, 0xB8, 0x17, 0x0C, 0x23, 0x44, 0x76, 0x3E, 0x6A,
+    0xF8, 0x4E, 0x0C, 0x87, 0x28, 0x2A, 0xFA, 0x27, 0x8F, 0xC9, 0x0E, 0x54, 0x94, 0x09, 0x40, 0x0B,
+    0x3C, 0x29, 0x80, 0x6E, 0x82, 0xAB, 0xE0, 0xF6, 0x88, 0x6B, 0xE3, 0x88, 0xC3, 0xE3, 0x1D, 0x3E,
+    0x10, 0x64, 0xA6, 0x2D, 0xA6, 0xB5, 0xCA, 0xD4, 0xDA, 0xCC, 0x53, 0xB2, 0xDC, 0x80, 0x09, 0xA6,
+    0xFC, 0x56, 0x31, 0x5D, 0x9E, 0x48, 0xF2, 0x50, 0x84, 0xF5, 0xD5, 0xE6, 0x85, 0xB1, 0x19, 0xC6,
+    0x4A, 0xCA, 0x8F, 0xC0, 0xFD, 0xDB, 0x1D, 0x33, 0x92, 0xB6, 0xAF, 0x05, 0xD2, 0xD4, 0x7D, 0x25,
+    0xA1, 0xAF, 0xD0, 0x65, 0xA3, 0xF9, 0x36, 0x21, 0xD9, 0xD1, 0x3C, 0x29, 0xE6, 0xD2, 0xD3, 0xD4,
+    0x78, 0x5C, 0xD6, 0x2E, 0x4F, 0x6B, 0xBC, 0x01, 0x7E, 0xFA, 0x33, 0x47, 0x87, 0xC3, 0x6B, 0x1B,
+    0x14, 0x35, 0x47, 0x87, 0x1E, 0x27, 0x40, 0xAF, 0x7E, 0x40, 0xE8, 0xBB, 0x13, 0x19, 0x3E, 0xDE,
+    0x37, 0x6A, 0x87, 0x27, 0xE9, 0x5E, 0xB2, 0xC1, 0xC4, 0x19, 0xFA, 0x25, 0x7A, 0x30, 0xF8, 0xCF,
+    0x39, 0x88, 0x51, 0x8B, 0xA8, 0x4B, 0x76, 0x9F, 0x24, 0xB9, 0x2F, 0x39, 0xCC, 0x73, 0x04, 0x1C,
+    0x75, 0x9C, 0x0F, 0x32, 0xFB, 0x46, 0x7F, 0xCF, 0x68, 0x7A, 0x80, 0x7F, 0xE2, 0x12, 0x71, 0xEF,
+    0xA6, 0xF0, 0xE9, 0x49, 0x58, 0xF2, 0xCA, 0x93, 0x88, 0x9A, 0x7D, 0x93, 0x4C, 0xEF, 0x5B, 0x32,
+    0x13, 0x6F, 0xD9, 0xC3, 0x62, 0xF6, 0xD0, 0x12, 0x61, 0xDD, 0x7D, 0x39, 0x7B, 0x30, 0x42, 0xC9,
+    0x31, 0xCE, 0x67, 0xE8, 0x96, 0x3E, 0xCA, 0x24, 0x83, 0x3E, 0xF5, 0xD8, 0x7D, 0x0B, 0x74, 0x82,
+    0x90, 0x97, 0xF7, 0x76, 0xE7, 0xF2, 0xF6, 0x7E, 0xD3, 0x66, 0x1F, 0x1B, 0xF3, 0xFF, 0x7D, 0x18,
+    0x08, 0xFF, 0x12, 0x8F, 0x8F, 0x84, 0x59, 0xBA, 0x29, 0xAD, 0xFB, 0x4A, 0xF3, 0x3F, 0x9E, 0xD7,
+    0x7A, 0xE8, 0xE4, 0x23, 0xED, 0x67, 0x31, 0xF2, 0x80, 0x4A, 0x62, 0xD8, 0xA8, 0x02, 0xBF, 0xAF,
+    0x34, 0xB8, 0xBA, 0x37, 0xF1, 0x39, 0xF6, 0xAE, 0x27, 0x28, 0xD2, 0xFC, 0x57, 0x13, 0x14, 0x6D,
+    0xCA, 0x7F, 0x19, 0xEF, 0xCB, 0xDE, 0x2B, 0x39, 0xC5, 0xB1, 0xF7, 0x6A, 0x46, 0x71, 0xDF, 0xBB,
+    0xA1, 0x29, 0xDE, 0xF4, 0xFE, 0x84, 0x00, 0x5E, 0x7A, 0xB7, 0x60, 0xCF, 0x39, 0xE7, 0xE1, 0x28,
+    0xE3, 0x83, 0xE4, 0x48, 0x7B, 0x7C, 0xCC, 0x29, 0x69, 0xD7, 0xBE, 0x38, 0x92, 0x39, 0xFC, 0x04,
+    0x03, 0x08, 0x02, 0xAF, 0x93, 0x35, 0x47, 0x7E, 0x3D, 0xEA, 0xA5, 0x48, 0xD7, 0x45, 0xCA, 0x1D,
+    0x6D, 0xDF, 0xDF, 0x0C, 0x92, 0xBE, 0xEA, 0x2B, 0xEA, 0x2F, 0xAF, 0x85, 0xD4, 0x8F, 0xD7, 0xA0,
+    0x80, 0xFE, 0x1A, 0x74, 0xB0, 0xB1, 0x86, 0xE6, 0xA4, 0x88, 0xD1, 0x2C, 0x65, 0x1D, 0xF4, 0x20,
+    0x49, 0x97, 0xF3, 0x17, 0x7A, 0xD8, 0xAE, 0x39, 0x00, 0x9B, 0x39, 0x29, 0x86, 0x6E, 0xDC, 0xCC,
+    0x8C, 0x0C, 0x53, 0x99, 0x4F, 0x87, 0xA2, 0x47, 0x7E, 0xC2, 0xA2, 0xC5, 0x07, 0x62, 0xD8, 0x25,
+    0xC5, 0x19, 0x12, 0x95, 0x43, 0x70, 0x0D, 0x78, 0xC6, 0x32, 0x69, 0xBC, 0x7B, 0xF8, 0xBB, 0x27,
+    0x8D, 0x1D, 0x32, 0xAD, 0xEE, 0x61, 0xFB, 0x9A, 0x87, 0x37, 0x78, 0x68, 0x2B, 0x63, 0x5C, 0x3E,
+    0x66, 0xC3, 0xEA, 0x36, 0x56, 0xAE, 0xC2, 0x46, 0xCE, 0x22, 0x77, 0x2D, 0x63, 0x03, 0x16, 0x4B,
+    0x53, 0xF7, 0x28, 0x3B, 0x80, 0x88, 0x6C, 0x5A, 0x03, 0xFF, 0x61, 0x69, 0x1E, 0xEA, 0x31, 0x19,
+    0xB3, 0x6F, 0x2E, 0xFB, 0x9A, 0xAF, 0x0C, 0xF2, 0x90, 0x90, 0x7D, 0x48, 0xEC, 0x29, 0xB2, 0xB9,
+    0x7E, 0x1B, 0x79, 0x74, 0xDB, 0x96, 0xA4, 0x85, 0x3C, 0xEB, 0x30, 0x9D, 0x8E, 0x58, 0xC2, 0xFB,
+    0xBE, 0x72, 0x9B, 0xAF, 0x34, 0x37, 0xB2, 0xB5, 0x5C, 0xF6, 0x41, 0x15, 0x9B, 0xA7, 0xD9, 0x3E,
+    0xAD, 0x40, 0xEB, 0xEB, 0xD2, 0x28, 0xD0, 0xFA, 0xC5, 0xDD, 0xC5, 0xF6, 0x34, 0x60, 0x96, 0x9E,
+    0x6F, 0x59, 0x74, 0xAF, 0x5C, 0x96, 0x47, 0x70, 0x4C, 0xE8, 0x6C, 0x1E, 0x64, 0x5A, 0x98, 0x33,
+    0x56, 0x2D, 0x5D, 0x50, 0x69, 0x1F, 0x15, 0x59, 0x5F, 0x67, 0x84, 0x0C, 0x70, 0xCC, 0x5F, 0x02,
+    0x8A, 0x19, 0x60, 0x37, 0x9F, 0x42, 0x81, 0x35, 0xB4, 0xAD, 0xA4, 0x9B, 0xCD, 0x3C, 0x87, 0xD5,
+    0x99, 0xBF, 0x12, 0x57, 0x78, 0xBA, 0xBB, 0x4A, 0x52, 0x5C, 0x36, 0x1E, 0x74, 0x6C, 0x25, 0x4A,
+    0x90, 0xE6, 0x27, 0x9D, 0x36, 0x9B, 0x33, 0xE4, 0x03, 0xAB, 0xCC, 0xA6, 0x68, 0x3A, 0xC2, 0x91,
+    0x87, 0x3B, 0x73, 0xE4, 0xF1, 0x3F, 0xCD, 0x5A, 0x3D, 0x8C, 0x1C, 0xE5, 0x19, 0x7E, 0x67, 0x86,
+    0x63, 0x14, 0x06, 0x18, 0x22, 0xD9, 0x11, 0xE2, 0xE7, 0x26, 0x45, 0x0A, 0x84, 0x7C, 0xBB, 0x8D,
+    0x0B, 0x23, 0xCD, 0xDC, 0x7E, 0x4A, 0x0A, 0x0A, 0x9A, 0x2D, 0xBC, 0x34, 0x2E, 0xA0, 0x8C, 0x90,
+    0x08, 0x2E, 0x28, 0x0E, 0x69, 0xED, 0x1B, 0x92, 0x22, 0x05, 0x05, 0x49, 0x41, 0x95, 0x02, 0x17,
+    0x14, 0x70, 0x2E, 0xB8, 0xE2, 0x22, 0x2D, 0x62, 0xED, 0x9D, 0x40, 0xE1, 0x22, 0x05, 0x83, 0x92,
+    0x88, 0x22, 0x52, 0x32, 0x24, 0xB6, 0x12, 0x09, 0x29, 0x1E, 0x29, 0x63, 0x69, 0x09, 0x77, 0x3B,
+    0x79, 0x9E, 0xF7, 0x9B, 0xD9, 0x5D, 0x9F, 0x8D, 0xA2, 0x83, 0xF5, 0x91, 0xB5, 0xE7, 0xDB, 0xDD,
+    0xD9, 0x99, 0xEF, 0x7D, 0xDE, 0xFF, 0x9F, 0x39, 0x11, 0x91, 0xAE, 0xF8, 0x75, 0x9A, 0x48, 0xAF,
+    0xAE, 0xC6, 0x72, 0x20, 0xB3, 0xD2, 0x2B, 0xA5, 0x67, 0x82, 0x0C, 0xE7, 0x43, 0x23, 0xA1, 0x44,
+    0x82, 0xA5, 0xC3, 0x25, 0x69, 0x96, 0x48, 0x62, 0xDE, 0x85, 0x65, 0x93, 0x5F, 0x2F, 0xE0, 0x4D,
+    0xF6, 0x71, 0xC2, 0x2D, 0x25, 0xCC, 0x82, 0x5C, 0xFC, 0x59, 0x6D, 0x44, 0x26, 0x53, 0x99, 0xBF,
+    0x4E, 0xE2, 0x48, 0xE4, 0x31, 0x33, 0x74, 0xEA, 0xAA, 0x0A, 0x6E, 0x4C, 0xF2, 0xC8, 0x6C, 0xE2,
+    0x2E, 0x6E, 0x14, 0xC9, 0x10, 0xC7, 0x08, 0x14, 0x2A, 0x9C, 0xA9, 0x70, 0x66, 0x84, 0x7F, 0x43,
+    0xA7, 0x94, 0xEE, 0xFB, 0xB9, 0x04, 0xB3, 0xC5, 0x26, 0x61, 0xEA, 0x14, 0x12, 0x86, 0xC6, 0x2D,
+    0x24, 0xEA, 0x88, 0x97, 0x4B, 0x77, 0x2A, 0x1E, 0x60, 0x82, 0x60, 0x46, 0x1C, 0x41, 0x4A, 0x48,
+    0xC0, 0x3C, 0x24, 0x4E, 0x6C, 0xC2, 0xB5, 0x22, 0x5C, 0x29, 0x85, 0x1C, 0x94, 0x04, 0xE1, 0xE8,
+    0x8A, 0x3D, 0x70, 0x31, 0xF6, 0xC0, 0x67, 0xB0, 0x0A, 0xF0, 0x5D, 0x40, 0x0E, 0xBF, 0x3A, 0x00,
+    0x1D, 0xB7, 0xAE, 0x64, 0xE9, 0xE5, 0xE0, 0x07, 0xD0, 0x59, 0x13, 0xE7, 0xB9, 0x2C, 0x34, 0xC1,
+    0xDB, 0xD8, 0x35, 0xDC, 0xE7, 0xF2, 0x2B, 0xEC, 0x1C, 0x71, 0xE3, 0x75, 0xEE, 0xB2, 0xC1, 0x0D,
+    0x81, 0x62, 0x48, 0xF2, 0x5B, 0x90, 0x87, 0x8C, 0x1C, 0x48, 0x60, 0xEC, 0x63, 0xB3, 0xED, 0x2B,
+    0xBB, 0x20, 0x51, 0x95, 0x72, 0x97, 0x57, 0xE8, 0xE6, 0xFA, 0xEE, 0xBF, 0x69, 0xBF, 0xBB, 0xFB,
+    0xCD, 0x0F, 0x4B, 0x20, 0xEA, 0x7F, 0x02, 0x54, 0x5D, 0x3A, 0x75, 0x9D, 0x7A, 0x75, 0x5D, 0xB8,
+    0x45, 0x04, 0xF8, 0x41, 0xE6, 0xE5, 0x90, 0x38, 0x18, 0x86, 0x10, 0xA6, 0xD4, 0x05, 0xC4, 0x30,
+    0x06, 0x45, 0x0A, 0x62, 0xA8, 0xCA, 0xA0, 0x28, 0xFC, 0x9C, 0xEF, 0x63, 0xAB, 0x4B, 0x08, 0x65,
+    0x53, 0x05, 0x32, 0xE5, 0x95, 0x1D, 0x08, 0xC3, 0x8A, 0xC3, 0x2B, 0x71, 0x19, 0xF0, 0x07, 0x79,
+    0x98, 0xF2, 0xBD, 0x9B, 0xE2, 0x32, 0x28, 0x61, 0xC6, 0xCB, 0x64, 0x52, 0x57, 0x20, 0xBD, 0x2F,
+    0xF5, 0xCC, 0xE0, 0x7D, 0x7A, 0x1B, 0xFC, 0xF2, 0x14, 0xD1, 0xC9, 0x96, 0x82, 0x93, 0x6E, 0xA6,
+    0xD8, 0x22, 0x63, 0xA1, 0x51, 0x3D, 0x53, 0x67, 0xD0, 0x27, 0xB0, 0xA0, 0xAE, 0x88, 0xCB, 0x79,
+    0xBE, 0x54, 0x58, 0x5E, 0x6E, 0x51, 0xA5, 0x0A, 0xAA, 0xD3, 0x62, 0x6A, 0x20, 0x11, 0x11, 0x94,
+    0xA3, 0x80, 0x4C, 0x8B, 0xA7, 0x81, 0x43, 0x34, 0xB3, 0x1D, 0x03, 0x30, 0x90, 0x89, 0x59, 0xA8,
+    0xA9, 0x7C, 0x18, 0xD4, 0xA0, 0xD8, 0xE0, 0x05, 0x12, 0xCE, 0xBD, 0x7D, 0xA5, 0xEF, 0x34, 0x30,
+    0xF0, 0x7A, 0xCC, 0xCF, 0x06, 0x03, 0x71, 0xEA, 0x3F, 0xA7, 0xB8, 0x0F, 0x46, 0x68, 0x06, 0xAF,
+    0x40, 0x2A, 0x3D, 0xAA, 0x6C, 0x13, 0x06, 0x00, 0x81, 0x27, 0xA0, 0xEF, 0x15, 0xF8, 0xBE, 0x41,
+    0x19, 0x8E, 0xF0, 0xBD, 0x4B, 0x74, 0xAA, 0xD2, 0x0A, 0x2A, 0xAD, 0x54, 0xA9, 0xB4, 0x1A, 0xA8,
+    0x95, 0x92, 0xEA, 0x5D, 0xD9, 0xED, 0xEE, 0x5C, 0x92, 0xA8, 0x2A, 0x7B, 0xF5, 0x42, 0xBB, 0x25,
+    0x99, 0x28, 0x00, 0xC5, 0xE5, 0x82, 0xCB, 0x81, 0x26, 0x03, 0x08, 0x88, 0xC1, 0xCF, 0xB0, 0x71,
+    0x90, 0x52, 0x19, 0x46, 0x35, 0x12, 0x8A, 0x75, 0xB1, 0x88, 0x06, 0xDA, 0xA1, 0x01, 0x25, 0xB4,
+    0xE2, 0x98, 0x8B, 0xD2, 0x1D, 0x82, 0xE1, 0x7C, 0x24, 0x75, 0x9D, 0x55, 0x76, 0x6F, 0xA1, 0x6A,
+    0xC5, 0x79, 0x1C, 0x28, 0x3C, 0xF2, 0xEF, 0xBE, 0x6B, 0xA9, 0x1A, 0xFC, 0xE6, 0x15, 0xA0, 0x0B,
+    0xD9, 0xC3, 0x3C, 0x0C, 0x61, 0x92, 0x73, 0xC7, 0x80, 0x6E, 0x60, 0x40, 0xB7, 0x25, 0x69, 0x40,
+    0x2D, 0x14, 0x2B, 0x74, 0xB2, 0x6C, 0x0D, 0xB7, 0x21, 0x19, 0x5B, 0x8E, 0xC1, 0x2B, 0xE8, 0x96,
+    0xA4, 0x4B, 0x92, 0xD8, 0x56, 0xD4, 0x69, 0xD4, 0x67, 0x68, 0x69, 0xB0, 0x4A, 0x0A, 0xFF, 0x40,
+    0xED, 0xC4, 0xC8, 0x08, 0xA7, 0x2A, 0x1C, 0xA5, 0xA3, 0x18, 0x9D, 0x72, 0x0D, 0x97, 0x87, 0xB8,
+    0x3A, 0x02, 0x86, 0x0E, 0x6E, 0x80, 0x9F, 0xA5, 0xD0, 0xA7, 0x19, 0x82, 0xFE, 0x16, 0xC8, 0xEF,
+    0x81, 0x7A, 0x05, 0xE2, 0x50, 0x36, 0x74, 0x14, 0x63, 0xEF, 0x98, 0x9E, 0x40, 0x55, 0xF1, 0x20,
+    0x05, 0x00, 0x75, 0x6B, 0x90, 0x85, 0xC5, 0x39, 0x95, 0xF8, 0xE9, 0x3A, 0x3E, 0x05, 0x69, 0x02,
+    0x0F, 0x09, 0x4D, 0xEC, 0x1D, 0x60, 0x93, 0xD8, 0xFB, 0x2B, 0x03, 0x08, 0x7C, 0x67, 0x5D, 0x46,
+    0xC1, 0x1B, 0xE9, 0x86, 0x54, 0xE1, 0xB3, 0x20, 0x55, 0x86, 0x5E, 0x1E, 0x3B, 0x65, 0xE8, 0x16,
+    0x08, 0x24, 0xEB, 0x52, 0x8E, 0xDC, 0x02, 0x3F, 0xED, 0x79, 0x79, 0x02, 0x4B, 0xF5, 0x32, 0xB0,
+    0x5A, 0xFA, 0xD9, 0x50, 0x3A, 0x65, 0x90, 0x6E, 0x49, 0x54, 0x84, 0x66, 0x4F, 0x42, 0x58, 0x5A,
+    0x09, 0xA7, 0x0A, 0x55, 0x98, 0x91, 0xAE, 0x74, 0x02, 0xF9, 0xBE, 0x3A, 0x64, 0x4F, 0xD5, 0xFB,
+    0x74, 0x63, 0x6F, 0xF7, 0x29, 0x9E, 0x44, 0xF1, 0xC4, 0x8A, 0x47, 0x14, 0x8F, 0x28, 0x9E, 0xBE,
+    0xE2, 0x29, 0x15, 0x4F, 0x49, 0x3C, 0x8E, 0xE2, 0x81, 0x3C, 0x80, 0xC7, 0xCB, 0x89, 0xC7, 0xCB,
+    0x14, 0x4F, 0x46, 0x3C, 0x7E, 0x4A, 0x3C, 0x41, 0x4A, 0x3C, 0x94, 0x0D, 0xF0, 0x08, 0xF1, 0x44,
+    0x42, 0x3C, 0x1D, 0x25, 0xB8, 0xA1, 0x6B, 0xBC, 0xB4, 0x8E, 0x14, 0xA6, 0xA2, 0x8A, 0xB2, 0x45,
+    0xA0, 0x6A, 0x6C, 0x5D, 0x15, 0x24, 0xCE, 0x3C, 0x84, 0xBD, 0x27, 0xD0, 0xC7, 0x67, 0xB5, 0x81,
+    0x46, 0x6E, 0xBE, 0x90, 0x41, 0x27, 0x53, 0x9F, 0x5A, 0x29, 0x54, 0x2F, 0x30, 0xCC, 0x18, 0x9E,
+    0x48, 0xFD, 0xC0, 0x44, 0xD2, 0x2D, 0xB5, 0x91, 0x91, 0x46, 0x37, 0x6A, 0xA8, 0x4B, 0x1D, 0x49,
+    0x47, 0xDD, 0x32, 0x71, 0xE9, 0x1E, 0xB1, 0x8D, 0x59, 0x96, 0xD4, 0x32, 0xC1, 0xD0, 0x68, 0xFC,
+    0xD4, 0x38, 0xB6, 0x88, 0x13, 0x67, 0x28, 0xD3, 0x8D, 0x21, 0x7F, 0x2F, 0xE7, 0x97, 0xDA, 0x88,
+    0xDE, 0xA2, 0xEF, 0x71, 0xF9, 0x90, 0xCB, 0xBF, 0xE9, 0xC4, 0x7F, 0xA7, 0x25, 0x7C, 0x84, 0x25,
+    0xF8, 0x39, 0x6C, 0x2E, 0xA2, 0xF5, 0x6D, 0xD2, 0x93, 0x2F, 0xEE, 0x60, 0x41, 0x24, 0x14, 0xE7,
+    0xD6, 0xA0, 0xA4, 0x29, 0x56, 0x8C, 0xDE, 0x15, 0xE9, 0x8E, 0xAC, 0xAF, 0x6A, 0x04, 0x9E, 0x53,
+    0x5D, 0x1F, 0x5A, 0x9A, 0x2D, 0xC9, 0xC7, 0x1C, 0x44, 0xB0, 0xCF, 0x52, 0x1F, 0xCE, 0x4F, 0xCF,
+    0x47, 0xD4, 0x57, 0x07, 0x80, 0xE4, 0xF5, 0x56, 0x1A, 0x3E, 0xFD, 0x9C, 0x91, 0x9B, 0x81, 0x1B,
+    0xEE, 0x4D, 0xDF, 0x96, 0xDB, 0x38, 0xD9, 0x38, 0xB4, 0xE7, 0x84, 0x01, 0xBE, 0xD0, 0x64, 0xA3,
+    0x66, 0xD3, 0xD1, 0x5C, 0x67, 0xD5, 0x44, 0x28, 0x5B, 0x8D, 0xB2, 0x2A, 0x69, 0x3C, 0xC3, 0x3A,
+    0x92, 0xD7, 0x18, 0xFB, 0xE3, 0xD7, 0x71, 0xFB, 0x7E, 0x93, 0x0A, 0x32, 0x58, 0x0E, 0x02, 0x97,
+    0x63, 0x63, 0x7F, 0x9F, 0x17, 0x32, 0x7C, 0x30, 0x6E, 0xC0, 0xDE, 0x44, 0x7D, 0x98, 0x84, 0x34,
+    0xED, 0x58, 0xA7, 0x6D, 0xCC, 0x81, 0xAF, 0x82, 0x1F, 0x7F, 0x5B, 0xB6, 0xE2, 0x8C, 0xDA, 0xF3,
+    0x48, 0xEF, 0xC2, 0xF4, 0x4E, 0x6F, 0xDD, 0x47, 0x64, 0x85, 0x5D, 0xAF, 0x36, 0xBD, 0xCB, 0xEE,
+    0xBA, 0xC4, 0x30, 0x98, 0xC2, 0x6A, 0x14, 0x89, 0x1E, 0x79, 0x3E, 0xB8, 0x31, 0x46, 0x96, 0x47,
+    0x92, 0x47, 0x8E, 0x47, 0x8A, 0x47, 0x90, 0x47, 0x82, 0xAF, 0x78, 0xDD, 0x08, 0x4E, 0x89, 0xE4,
+    0xBE, 0x9C, 0xDB, 0xBD, 0x6C, 0x8F, 0xBA, 0xA7, 0x59, 0x4D, 0x4C, 0x23, 0x40, 0xB1, 0x71, 0x27,
+    0xA4, 0x14, 0x22, 0xCA, 0xA1, 0x43, 0x49, 0x6C, 0xD8, 0x6C, 0xAF, 0xC9, 0x5E, 0x33, 0x89, 0x26,
+    0x10, 0xCD, 0xF4, 0x9A, 0xE8, 0x35, 0xCF, 0x6B, 0x9A, 0xD7, 0x2C, 0xAF, 0x49, 0x3E, 0xB1, 0xFC,
+    0x22, 0xC5, 0x6B, 0x86, 0x3F, 0x94, 0xE0, 0xE3, 0x00, 0x86, 0x02, 0x6E, 0x03, 0x2A, 0xD5, 0x26,
+    0x63, 0x24, 0x7B, 0x18, 0x08, 0xE2, 0x34, 0x1D, 0x42, 0x85, 0x14, 0x69, 0x9E, 0xA7, 0xB1, 0x30,
+    0x58, 0x32, 0x32, 0x6F, 0x2D, 0x19, 0x0A, 0x13, 0xFC, 0x22, 0xBF, 0x0F, 0xFA, 0x8C, 0x8E, 0xD3,
+    0xF6, 0x93, 0x7A, 0x43, 0x46, 0x95, 0x7F, 0x4A, 0xFD, 0x1B, 0x73, 0x3C, 0xAC, 0x85, 0xD0, 0x52,
+    0x54, 0xDB, 0xCF, 0x27, 0xEE, 0x03, 0x9B, 0x0C, 0xF4, 0x4F, 0xAE, 0x80, 0x3D, 0xCB, 0xD0, 0xDC,
+    0x93, 0x35, 0x60, 0x9E, 0x98, 0xF3, 0xF8, 0x51, 0x71, 0x8C, 0x3C, 0xB2, 0xF4, 0x52, 0x5B, 0xA9,
+    0x48, 0x7E, 0xC1, 0xE7, 0x99, 0x95, 0xF1, 0xF9, 0x75, 0x3E, 0xF5, 0x1D, 0x28, 0xF4, 0x51, 0x27,
+    0x65, 0xF9, 0x2B, 0xFE, 0x15, 0x50, 0xAE, 0x34, 0x3E, 0xDC, 0x03, 0xC5, 0x56, 0xF3, 0x14, 0xF3,
+    0xA4, 0xDD, 0xF1, 0xBB, 0x31, 0x5E, 0x1C, 0x81, 0x69, 0x92, 0x4B, 0xBE, 0x5A, 0x3E, 0x5F, 0x92,
+    0xA0, 0x2E, 0x1E, 0xF8, 0x71, 0xC5, 0x52, 0xD9, 0x06, 0xD0, 0x1F, 0x8C, 0xBD, 0x7A, 0x3F, 0xFA,
+    0xE3, 0x28, 0x91, 0x0A, 0xA1, 0x69, 0xE8, 0xE7, 0xBD, 0x89, 0x89, 0x0E, 0xEC, 0xD5, 0x6B, 0x03,
+    0xB6, 0x48, 0xF4, 0xA3, 0x93, 0x83, 0x79, 0x1A, 0x38, 0xC5, 0xD8, 0x4E, 0xBB, 0x7B, 0xE4, 0xC4,
+    0x3D, 0xCF, 0x65, 0x11, 0xFC, 0xB8, 0xBB, 0xEC, 0xC7, 0x1B, 0x0D, 0x80, 0x6F, 0x9B, 0xCF, 0x0E,
+    0x73, 0x66, 0xDA, 0x64, 0xAE, 0x6E, 0xED, 0xC8, 0x31, 0x70, 0x26, 0x73, 0xCE, 0xE8, 0xBD, 0x4C,
+    0x89, 0x6E, 0xBA, 0x8A, 0x4C, 0x1D, 0xD6, 0x8A, 0x79, 0xD1, 0x1E, 0xA0, 0x3B, 0x39, 0x60, 0xBD,
+    0xCC, 0x35, 0xF8, 0x84, 0xA7, 0x43, 0x8D, 0x5B, 0x9B, 0xEA, 0xD0, 0x43, 0x2D, 0xB2, 0xAA, 0x44,
+    0x6B, 0xDC, 0x64, 0x00, 0x17, 0xCB, 0xB6, 0x6B, 0xF6, 0x4D, 0x17, 0x77, 0xD0, 0xD3, 0xEC, 0x30,
+    0x92, 0x6F, 0xAB, 0x6D, 0x7E, 0xF9, 0x3C, 0xB3, 0xB7, 0x36, 0x4D, 0x4D, 0xF3, 0x95, 0x32, 0x97,
+    0x47, 0xDC, 0x99, 0x4D, 0x4B, 0x5D, 0x37, 0x91, 0xDF, 0x99, 0x9B, 0xF2, 0xD3, 0xCE, 0x03, 0xA9,
+    0x53, 0x7F, 0x32, 0xA9, 0xFC, 0x1B, 0x37, 0xAF, 0x8F, 0x43, 0xB3, 0x9D, 0x82, 0x5A, 0x8F, 0xD6,
+    0x93, 0x38, 0x15, 0x3A, 0x8F, 0x09, 0x8A, 0xFB, 0xED, 0x19, 0x18, 0xC2, 0x5D, 0x15, 0x3B, 0xC6,
+    0x29, 0x3B, 0x97, 0x71, 0x70, 0x20, 0xA6, 0x77, 0xA5, 0xFE, 0x22, 0x8F, 0x3E, 0xBF, 0x56, 0xA7,
+    0x4B, 0x71, 0x17, 0x1B, 0x77, 0xC1, 0xC5, 0x4C, 0x1E, 0x75, 0x2B, 0x9B, 0xAF, 0xA8, 0x9F, 0x45,
+    0xE1, 0x71, 0xF2, 0x2C, 0x5A, 0xF9, 0x2A, 0x96, 0xA7, 0x71, 0x48, 0x99, 0xC8, 0xE5, 0xE9, 0xA6,
+    0xD4, 0xFB, 0x5D, 0x36, 0x5C, 0x19, 0x5A, 0x90, 0x59, 0x9D, 0xC9, 0x64, 0x66, 0xE5, 0x72, 0x7F,
+    0xDA, 0x97, 0xED, 0x5B, 0x85, 0xFB, 0xE5, 0x2B, 0x39, 0x7F, 0x45, 0x05, 0xC8, 0x06, 0x37, 0x45,
+    0x73, 0x90, 0x76, 0xC0, 0x7C, 0x47, 0x9D, 0xAA, 0x87, 0xE3, 0xAA, 0x44, 0x2E, 0xCA, 0xDB, 0x1A,
+    0x5D, 0xE5, 0xB4, 0x29, 0x6B, 0xB6, 0x6B, 0x76, 0x62, 0xD2, 0x07, 0xFB, 0xDB, 0xD8, 0xB2, 0x7B,
+    0xB0, 0x1C, 0x30, 0x5F, 0x2B, 0xAD, 0xAD, 0x44, 0xDF, 0x10, 0xB3, 0x53, 0x6E, 0x42, 0x11, 0x77,
+    0xC5, 0xCC, 0x17, 0x1B, 0x3D, 0x76, 0x79, 0x14, 0x94, 0xD3, 0xE8, 0xFC, 0x10, 0x2F, 0x41, 0x76,
+    0x27, 0x2F, 0x89, 0xF2, 0x72, 0x51, 0xBA, 0x0E, 0x78, 0xB9, 0x89, 0xCE, 0xF8, 0xA0, 0x2D, 0xD1,
+    0x46, 0x5A, 0x9A, 0xF5, 0xBD, 0x43, 0xBC, 0x04, 0x6C, 0xA6, 0x7E, 0x9F, 0x8A, 0xC3, 0x42, 0x65,
+    0xDA, 0xF6, 0x76, 0x23, 0xA7, 0x70, 0x4B, 0xB4, 0x99, 0x68, 0xBF, 0x81, 0x30, 0x1B, 0x8B, 0xFF,
+    0x11, 0xEA, 0xF4, 0x37, 0x32, 0x09, 0x5F, 0x01, 0x5F, 0xB8, 0x34, 0xBC, 0x09, 0xDE, 0x9E, 0x4B,
+    0xA5, 0xC3, 0x80, 0xC8, 0x2E, 0x16, 0x86, 0x12, 0xC3, 0x5A, 0x87, 0x76, 0xB2, 0xA1, 0x73, 0x8E,
+    0x79, 0xCD, 0xC3, 0x92, 0x87, 0x15, 0x4F, 0xB2, 0x14, 0x82, 0x87, 0x77, 0x56, 0x8C, 0x4E, 0xB1,
+    0x66, 0xD0, 0x5A, 0xA3, 0xA9, 0xBB, 0x20, 0xDE, 0xEF, 0xD0, 0x7C, 0x5C, 0xCB, 0x25, 0x78, 0xDB,
+    0x48, 0x70, 0x95, 0xC6, 0x8E, 0xE3, 0x4D, 0x24, 0x7B, 0xD0, 0xEB, 0x30, 0xAA, 0x36, 0xF4, 0x62,
+    0xDB, 0x23, 0xDC, 0xD3, 0x02, 0x30, 0x9C, 0x67, 0x8B, 0x57, 0xB9, 0xB0, 0x88, 0x93, 0xED, 0x36,
+    0x6F, 0x1C, 0xA1, 0x0E, 0x84, 0xA0, 0x53, 0xDB, 0x0B, 0x4B, 0x50, 0x68, 0x27, 0xA3, 0x1E, 0xE4,
+    0xCE, 0xBB, 0xEA, 0xEF, 0x8A, 0x85, 0xC9, 0xBE, 0xAD, 0xE4, 0xBE, 0x15, 0x2F, 0xAD, 0xD1, 0xFA,
+    0x6F, 0xDF, 0x6E, 0xB4, 0x75, 0x9D, 0x23, 0x30, 0xC1, 0x02, 0xA2, 0xD4, 0x36, 0x9B, 0x53, 0x1B,
+    0x04, 0x23, 0x43, 0xC8, 0xF8, 0x1D, 0x9F, 0x2F, 0x93, 0xFA, 0x85, 0xA6, 0x19, 0xED, 0x34, 0xEF,
+    0x89, 0xA4, 0xCE, 0xBE, 0xCC, 0xDE, 0x2F, 0x61, 0xB0, 0x0B, 0xBF, 0xB8, 0xAB, 0x63, 0x0C, 0x10,
+    0xCE, 0xD0, 0xC4, 0xCB, 0xE0, 0x85, 0xD4, 0xDE, 0x3F, 0xB2, 0xFD, 0x07, 0x12, 0x35, 0x63, 0x31,
+    0xFC, 0x01, 0x74, 0x8A, 0xA6, 0x5F, 0x1B, 0x36, 0xE5, 0x54, 0xDB, 0xBF, 0xC4, 0x8A, 0xA9, 0x0F,
+    0x71, 0x4F, 0x96, 0x1D, 0x03, 0x8D, 0x8A, 0xCE, 0xAB, 0x94, 0x4E, 0x1B, 0xE8, 0xFA, 0xB7, 0xF7,
+    0x35, 0x4C, 0x22, 0x68, 0x59, 0x34, 0x8B, 0xB3, 0x2D, 0xBC, 0x5B, 0x7B, 0x14, 0xDF, 0x6E, 0xEC,
+    0x84, 0xDC, 0xC3, 0xED, 0x3D, 0xF3, 0x7F, 0x38, 0xF3, 0xE2, 0x94, 0x4B, 0xF3, 0x48, 0xAA, 0x59,
+    0x22, 0xB2, 0xB3, 0x90, 0x63, 0x9B, 0x72, 0x35, 0xEA, 0xD4, 0x11, 0x4C, 0x33, 0x84, 0x69, 0x5B,
+    0xEF, 0xE3, 0x1E, 0x6F, 0xD9, 0xD7, 0xD4, 0x82, 0xA1, 0x8A, 0x1F, 0xBA, 0x37, 0x61, 0x5E, 0xCD,
+    0x26, 0xB1, 0x2E, 0xE9, 0xE4, 0xF7, 0x26, 0xCC, 0x33, 0x52, 0xB2, 0x98, 0x1D, 0x2A, 0x37, 0x23,
+    0x95, 0xEC, 0x9E, 0x4A, 0xB4, 0xD2, 0xB9, 0x59, 0x19, 0xA4, 0x41, 0xEA, 0x40, 0x99, 0xE1, 0x5B,
+    0xCF, 0x17, 0xA8, 0x34, 0xE1, 0xAD, 0xA0, 0xB5, 0x73, 0x39, 0x23, 0x25, 0x0E, 0xB6, 0xEC, 0x68,
+    0xCB, 0x0E, 0xB7, 0x58, 0xF8, 0x0E, 0x75, 0xA5, 0x50, 0xC3, 0xD7, 0x91, 0x2B, 0x58, 0x6A, 0x42,
+    0xAE, 0xEE, 0x72, 0x0A, 0x67, 0x69, 0x1D, 0x41, 0x7C, 0x4F, 0x4E, 0x10, 0x2C, 0x3A, 0x39, 0xAA,
+    0xDF, 0x9E, 0x81, 0xA0, 0x34, 0xA0, 0x0D, 0xAD, 0x66, 0xB0, 0x68, 0xB9, 0x54, 0xD2, 0x7E, 0x4B,
+    0xB5, 0x17, 0x9A, 0x77, 0x01, 0xA9, 0x7B, 0x39, 0xF0, 0x7B, 0x19, 0x22, 0x86, 0x9F, 0x81, 0x03,
+    0xFF, 0x37, 0x50, 0x4C, 0x40, 0x0B, 0x09, 0xAF, 0xB7, 0xC1, 0x4C, 0xD3, 0xAE, 0x96, 0x34, 0xC9,
+    0x3C, 0xB6, 0xC5, 0x4B, 0xD4, 0x47, 0xF3, 0x13, 0xEB, 0x1A, 0x5A, 0xDB, 0x1A, 0x89, 0x33, 0x2D,
+    0x1D, 0x69, 0xE9, 0x44, 0x4B, 0x07, 0x5A, 0x3A, 0xCF, 0xD2, 0x71, 0x96, 0x4E, 0xB3, 0x74, 0xB8,
+    0xC6, 0x59, 0x96, 0x70, 0x94, 0xC5, 0x21, 0xD7, 0x48, 0x38, 0xC8, 0x12, 0xCE, 0xB1, 0x38, 0x41,
+    0x24, 0xCC, 0x4E, 0x29, 0x1C, 0x62, 0xE9, 0x0C, 0x4B, 0x47, 0x58, 0x4D, 0x04, 0x67, 0xC9, 0x98,
+    0x37, 0x23, 0xCC, 0xD3, 0xF3, 0xB9, 0x14, 0xA7, 0x52, 0x9C, 0x49, 0x71, 0x22, 0xC5, 0x79, 0x14,
+    0xA7, 0x51, 0x9C, 0x45, 0x71, 0x12, 0xC5, 0xF2, 0xDE, 0x96, 0xF6, 0xB6, 0xFA, 0x4B, 0xB4, 0xB4,
+    0x8F, 0xDB, 0xD1, 0x5C, 0x65, 0x4D, 0xDF, 0x69, 0xCA, 0xD3, 0xD3, 0xBB, 0x22, 0xE7, 0xCF, 0x23,
+    0x8C, 0xEF, 0xDA, 0xEA, 0x83, 0x85, 0x2A, 0xEA, 0x54, 0x96, 0xA9, 0xAC, 0x52, 0x43, 0x14, 0xA9,
+    0xAC, 0x51, 0x59, 0xA2, 0xB2, 0x42, 0x65, 0x70, 0x41, 0x7D, 0xCA, 0xF2, 0x94, 0xD5, 0x29, 0x8B,
+    0x53, 0xBA, 0x83, 0x2D, 0x4D, 0xF9, 0x34, 0x60, 0xD8, 0x8C, 0x3D, 0x59, 0x09, 0x00, 0xF7, 0x06,
+    0xEC, 0xE2, 0xCC, 0x19, 0x1C, 0xA7, 0xED, 0xDC, 0x8D, 0x81, 0xFD, 0xDB, 0xCE, 0x93, 0x5A, 0x4F,
+    0x6A, 0x1D, 0xDB, 0x57, 0x33, 0x79, 0x78, 0xE9, 0xE1, 0xC3, 0x31, 0xD6, 0xAD, 0x0B, 0x34, 0x0A,
+    0x46, 0xB1, 0xCC, 0xA1, 0xAC, 0xB8, 0x8C, 0x5D, 0x26, 0xC4, 0x4C, 0xD4, 0xC4, 0x10, 0x97, 0x89,
+    0xFE, 0x8D, 0x14, 0x89, 0xBE, 0x9E, 0x27, 0xFA, 0x19, 0xA3, 0x7E, 0x0D, 0xA6, 0x82, 0x37, 0xD9,
+    0xE7, 0x31, 0xD1, 0x0F, 0x99, 0xE3, 0xAB, 0x90, 0xD5, 0x15, 0x12, 0x7D, 0x90, 0x22, 0xD1, 0x47,
+    0x4C, 0xF4, 0x43, 0x26, 0x7A, 0x0A, 0xBC, 0x9B, 0xB7, 0x89, 0x3E, 0x62, 0xA2, 0xBF, 0xC0, 0x44,
+    0xFF, 0xA3, 0x43, 0x62, 0x0F, 0x9A, 0x02, 0x95, 0xE6, 0x74, 0xA9, 0x89, 0x2E, 0xBF, 0xCE, 0x20,
+    0xB0, 0x14, 0xD1, 0x05, 0xBE, 0xDF, 0x83, 0x09, 0x7E, 0x98, 0x85, 0xCE, 0x3F, 0xB2, 0x75, 0xFF,
+    0x5A, 0xB6, 0x11, 0xFA, 0x69, 0x12, 0x07, 0x26, 0xD9, 0x0B, 0xA5, 0x5B, 0xC0, 0xFB, 0x33, 0x78,
+    0xF8, 0x17, 0xC8, 0xFE, 0xE0, 0x6A, 0xBE, 0x73, 0x88, 0xAA, 0xCF, 0xFF, 0x18, 0x26, 0xF7, 0x29,
+    0xF8, 0xBA, 0x74, 0x7E, 0xD1, 0x3E, 0xD1, 0x3C, 0xEF, 0x62, 0x92, 0xC1, 0x51, 0x4C, 0x12, 0x3B,
+    0xA1, 0xC8, 0xF4, 0x3E, 0xCE, 0x11, 0x0C, 0xA1, 0xC1, 0xDD, 0xF3, 0x2B, 0x68, 0x94, 0x1C, 0x24,
+    0xED, 0x08, 0x7A, 0x7A, 0xED, 0x65, 0xE0, 0x7D, 0x68, 0xA5, 0x78, 0xDB, 0xAD, 0x13, 0x6C, 0x7D,
+    0xFE, 0x7B, 0x2B, 0x19, 0xBF, 0x7A, 0x7F, 0x40, 0x39, 0x55, 0x90, 0xF7, 0x57, 0x17, 0x2D, 0x30,
+    0x12, 0x32, 0x93, 0xF2, 0xE1, 0xD2, 0x83, 0x46, 0x15, 0xBE, 0xD5, 0x47, 0xC4, 0x9E, 0x22, 0x5E,
+    0xBF, 0xF3, 0xB5, 0xA5, 0xC7, 0x04, 0xFE, 0xC2, 0xF2, 0x88, 0x31, 0x24, 0xA4, 0x02, 0xBD, 0x8F,
+    0x33, 0x27, 0xCF, 0xDB, 0x8A, 0xAF, 0xF4, 0x3F, 0x9F, 0x86, 0x66, 0x0B, 0xF8, 0x50, 0xC5, 0x5F,
+    0x9C, 0xE4, 0x08, 0xD9, 0x53, 0x0D, 0x3C, 0x23, 0xDE, 0x6E, 0x7A, 0x97, 0xB3, 0xA0, 0x31, 0xEB,
+    0xB3, 0xA2, 0x0F, 0x2B, 0xD7, 0xCF, 0x89, 0x3C, 0xE5, 0xAD, 0x16, 0xDA, 0x9A, 0x91, 0xED, 0x52,
+    0x6E, 0x8D, 0x9C, 0xEC, 0xA9, 0xA3, 0xE3, 0x22, 0x4F, 0xB0, 0x49, 0x9A, 0xA4, 0x35, 0x99, 0x49,
+    0xC5, 0x71, 0xF5, 0xA1, 0x21, 0xB2, 0x3E, 0xB3, 0xE4, 0xCD, 0x95, 0x7D, 0x7C, 0xB5, 0x98, 0x3C,
+    0x3F, 0x7E, 0xBD, 0x19, 0x4F, 0x8F, 0x10, 0x79, 0x13, 0x59, 0x0F, 0xC5, 0xF7, 0x4D, 0x33, 0xF2,
+    0x5B, 0xBA, 0x5E, 0x9F, 0x77, 0x2D, 0x86, 0xD5, 0xF3, 0x49, 0x75, 0x68, 0xAD, 0x0C, 0x96, 0xF0,
+    0xCC, 0xCB, 0xF2, 0xE2, 0x43, 0xDF, 0x1C, 0xC0, 0x59, 0x44, 0x06, 0x09, 0xCF, 0xA5, 0x4F, 0xD8,
+    0x09, 0xC1, 0x11, 0x67, 0xE3, 0x49, 0xC7, 0x2A, 0x18, 0xD2, 0x7F, 0x16, 0xF7, 0xBB, 0xAF, 0x67,
+    0xC7, 0x35, 0x1B, 0x8F, 0x10, 0xB8, 0x7E, 0x99, 0xD1, 0x7B, 0xF2, 0x4B, 0x47, 0x9F, 0x8D, 0xAF,
+    0x51, 0xD4, 0xDB, 0xCC, 0x36, 0x37, 0xF6, 0x38, 0x1C, 0x39, 0x7D, 0x3C, 0xB0, 0x41, 0xB6, 0x57,
+    0xC9, 0x07, 0x43, 0xC9, 0x1F, 0xFC, 0x26, 0xF3, 0x7C, 0xEF, 0x6F, 0x40, 0x5C, 0x02, 0xDC, 0x16,
+    0x28, 0x9E, 0x7A, 0xA2, 0xF1, 0x86, 0xEB, 0xCC, 0x66, 0x2C, 0x9D, 0x51, 0xC4, 0xFB, 0x28, 0xF8,
+    0xF8, 0x40, 0xD4, 0xCB, 0x82, 0x14, 0xF9, 0x9E, 0xB9, 0x7E, 0x70, 0x15, 0x1E, 0x51, 0x49, 0x74,
+    0xB9, 0xED, 0x62, 0x0B, 0x89, 0x9D, 0xB6, 0x73, 0x1E, 0xC3, 0x34, 0xE2, 0xB6, 0x73, 0x0E, 0x51,
+    0x1F, 0xFC, 0x42, 0x45, 0x5A, 0xEC, 0xEA, 0xE0, 0xEA, 0x1D, 0xF7, 0x5A, 0xE5, 0xFD, 0xA5, 0xEF,
+    0xA1, 0x80, 0x29, 0x6E, 0xB3, 0xBE, 0x3B, 0x6C, 0xE1, 0x2C, 0x45, 0x87, 0x1D, 0xCE, 0x19, 0x79,
+    0xC2, 0x35, 0x2B, 0xC5, 0x05, 0x2B, 0xEF, 0x4E, 0xE5, 0xB5, 0xA1, 0x5C, 0x7A, 0xF0, 0x88, 0xA0,
+    0x34, 0x95, 0xC7, 0xAD, 0x95, 0x6A, 0x82, 0xF7, 0x7F, 0x62, 0x8E, 0xED, 0x01, 0x08, 0xCC, 0xD3,
+    0xA6, 0x15, 0x86, 0xD6, 0xF3, 0xA7, 0x57, 0x30, 0x48, 0x3E, 0x29, 0x4D, 0xF3, 0xEA, 0xFD, 0x89,
+    0x15, 0x87, 0xBC, 0x78, 0x3C, 0xBC, 0xCC, 0x53, 0xCE, 0xCF, 0xC0, 0xC7, 0x03, 0xAB, 0x19, 0x88,
+    0x47, 0x33, 0xB6, 0xCF, 0xA9, 0x5B, 0xB9, 0xFA, 0x40, 0xDD, 0x6F, 0x62, 0xB8, 0xD7, 0x76, 0xCC,
+    0x9C, 0xDD, 0x44, 0xED, 0x97, 0xF1, 0x52, 0x04, 0x1F, 0x4B, 0x1F, 0x7B, 0x4E, 0x26, 0xC5, 0xA2,
+    0x45, 0xEF, 0xDB, 0x82, 0x52, 0xF3, 0x80, 0x69, 0xE6, 0x0B, 0x2F, 0x19, 0xAF, 0x2E, 0xC3, 0x4F,
+    0x2F, 0x59, 0xBB, 0x40, 0xEE, 0xE5, 0xDF, 0x8B, 0xCC, 0x74, 0x22, 0xE0, 0xF3, 0x6F, 0x06, 0x4C,
+    0x90, 0xFD, 0x67, 0x62, 0x26, 0x07, 0xCD, 0x03, 0x5E, 0x9C, 0x0B, 0x75, 0x32, 0x7F, 0x82, 0xA5,
+    0x5D, 0x9D, 0x4E, 0xD8, 0x1C, 0x26, 0x77, 0xB6, 0xD2, 0x5F, 0xF7, 0xB4, 0xD1, 0x5F, 0xCE, 0x41,
+    0x4D, 0x57, 0xDE, 0xCE, 0x3A, 0xD6, 0x9B, 0x6D, 0x5E, 0xB5, 0x50, 0x45, 0x1E, 0x81, 0x18, 0xB9,
+    0x8B, 0x7B, 0xCB, 0x74, 0xEB, 0xCC, 0xBF, 0xB1, 0x88, 0xED, 0x87, 0x6C, 0x19, 0xFF, 0xA3, 0x77,
+    0x25, 0x98, 0x36, 0x20, 0x03, 0xFD, 0x09, 0xF9, 0xF9, 0x87, 0x73, 0xCD, 0xF0, 0x21, 0x69, 0xB7,
+    0x9E, 0xF1, 0x41, 0x76, 0x77, 0xFE, 0xA0, 0x58, 0x89, 0xEB, 0x57, 0xCE, 0x37, 0xC8, 0xB8, 0xC3,
+    0x74, 0x17, 0x7C, 0x05, 0xB0, 0x6B, 0x76, 0xAE, 0xA0, 0x5B, 0x8E, 0xE7, 0x4D, 0x4B, 0x35, 0x7F,
+    0xF2, 0xC4, 0x0C, 0xDD, 0x05, 0x13, 0xF7, 0x1F, 0x70, 0x77, 0x70, 0xA8, 0xED, 0x5C, 0x2F, 0xB5,
+    0xB0, 0xC9, 0xD1, 0x7B, 0x94, 0x50, 0x2A, 0xCF, 0xF0, 0x52, 0x8A, 0xA0, 0x15, 0x03, 0x64, 0xEC,
+    0x5C, 0xC5, 0xF5, 0x34, 0x94, 0x6E, 0x03, 0xA5, 0x3D, 0x22, 0xDB, 0x59, 0x38, 0xFB, 0xAA, 0xD4,
+    0xFB, 0x21, 0xDB, 0x6D, 0x74, 0x55, 0x1F, 0xFC, 0xCF, 0xC7, 0x94, 0xDA, 0xA8, 0x41, 0xD6, 0x11,
+    0xA9, 0x74, 0xAC, 0x95, 0x42, 0x58, 0x31, 0xC5, 0x15, 0xDB, 0xD9, 0x44, 0xF0, 0xD6, 0x60, 0xC4,
+    0xFE, 0x11, 0x7D, 0xDD, 0xCE, 0x0E, 0xAF, 0x74, 0x68, 0xDE, 0xB8, 0x3C, 0x61, 0x57, 0xA4, 0x96,
+    0x1D, 0xF3, 0x9E, 0x21, 0xEF, 0x59, 0x74, 0x80, 0x47, 0x19, 0x14, 0xAA, 0xC2, 0x8B, 0x9F, 0xDA,
+    0x96, 0xEA, 0x5F, 0xE7, 0x32, 0xAF, 0x42, 0x28, 0x2B, 0x3C, 0x6D, 0xA9, 0x02, 0xDB, 0x52, 0x35,
+    0x4E, 0x10, 0x8A, 0xED, 0x94, 0xAD, 0x13, 0xB0, 0x73, 0xFD, 0x2F, 0x9D, 0x54, 0xCF, 0x6F, 0x1B,
+    0x45, 0x14, 0xFE, 0xD6, 0x1B, 0x67, 0x93, 0x6C, 0xEA, 0x5D, 0x50, 0x2A, 0xD2, 0x40, 0xBD, 0x41,
+    0xB2, 0x50, 0x55, 0xD9, 0xDE, 0xAD, 0xE4, 0x83, 0x0B, 0xEB, 0xEC, 0x70, 0xE6, 0x80, 0x0F, 0x35,
+    0x1C, 0x31, 0x82, 0x53, 0xA5, 0x92, 0x95, 0x08, 0x52, 0x88, 0x4C, 0x3C, 0xF0, 0x17, 0xF8, 0xC0,
+    0x1D, 0x23, 0x15, 0x24, 0x5C, 0x21, 0x56, 0xA8, 0x07, 0x0A, 0x4A, 0x3D, 0x12, 0xFF, 0xC0, 0x94,
+    0x3F, 0x00, 0x2D, 0x12, 0x1C, 0x38, 0x61, 0xA1, 0x20, 0xE5, 0xE0, 0x76, 0xF8, 0x76, 0xDB, 0x54,
+    0xC0, 0x91, 0x59, 0xCF, 0xAC, 0xE7, 0xCD, 0xDB, 0xF7, 0xE3, 0x7B, 0xDF, 0x3C, 0x60, 0x84, 0x1E,
+    0x3C, 0x38, 0x02, 0xB0, 0xB5, 0x27, 0x5A, 0x38, 0x40, 0x31, 0x96, 0xB0, 0x1F, 0xC2, 0x7B, 0x1D,
+    0x57, 0x6C, 0x61, 0xC1, 0x0F, 0x72, 0xDD, 0x33, 0x2A, 0xAA, 0x63, 0xFC, 0x70, 0xBE, 0xE4, 0x69,
+    0x62, 0xCE, 0xAE, 0xCE, 0x6E, 0xEF, 0x5A, 0xDD, 0x5A, 0xB2, 0x74, 0xF3, 0x95, 0x5E, 0x6F, 0x05,
+    0x88, 0xDB, 0x71, 0x0B, 0xB8, 0x88, 0x44, 0x55, 0x94, 0xA3, 0xF6, 0xD0, 0x85, 0x0F, 0x0B, 0x61,
+    0xDE, 0x49, 0xD3, 0xE8, 0xFA, 0xC2, 0x95, 0xFC, 0xCC, 0xFE, 0x51, 0x7B, 0xAF, 0xC9, 0xD6, 0x65,
+    0xA4, 0x9D, 0xC2, 0x47, 0xEC, 0xA2, 0x1E, 0xC3, 0x5D, 0xC0, 0xD1, 0xF0, 0xEA, 0xAD, 0x38, 0x8E,
+    0x1B, 0xF5, 0xFA, 0xE5, 0x56, 0xF1, 0xA7, 0x8C, 0xA1, 0xB7, 0x87, 0xBA, 0x07, 0xD7, 0x11, 0xF6,
+    0x27, 0x8A, 0x5B, 0x2B, 0x47, 0x65, 0x81, 0x17, 0x3F, 0x46, 0xD7, 0x43, 0xB8, 0x84, 0x9B, 0xC3,
+    0xEA, 0x07, 0xCB, 0xEB, 0xB7, 0x86, 0x17, 0xE8, 0x50, 0x7A, 0x08, 0x98, 0xC8, 0x88, 0x4E, 0x1D,
+    0xE5, 0x72, 0xD7, 0x46, 0xCC, 0x54, 0x7C, 0x1C, 0x8E, 0x46, 0x71, 0xDC, 0x5C, 0xF9, 0xB7, 0x10,
+    0x54, 0x6C, 0x31, 0x6B, 0x9B, 0x59, 0x3B, 0xE7, 0x59, 0x0B, 0xE4, 0x57, 0x75, 0x11, 0xBD, 0x25,
+    0x56, 0xA8, 0xB7, 0x37, 0x49, 0xD4, 0x01, 0xFA, 0x18, 0x3F, 0xBA, 0xFA, 0x35, 0x9A, 0x7C, 0xBA,
+    0xE8, 0x20, 0xB5, 0xB5, 0xA3, 0x3C, 0x71, 0x8C, 0x53, 0xDA, 0x58, 0x45, 0xBD, 0x14, 0x36, 0xB1,
+    0x06, 0x07, 0x2E, 0x02, 0x61, 0x34, 0xB1, 0x59, 0xEC, 0x4F, 0x3D, 0xD4, 0x8A, 0x80, 0x89, 0x6A,
+    0x38, 0x99, 0xE7, 0x35, 0xAC, 0xE3, 0xA2, 0x30, 0x79, 0x91, 0x53, 0x45, 0xDB, 0xDA, 0x56, 0x36,
+    0xA3, 0x31, 0x38, 0xE1, 0xBE, 0xC5, 0xA0, 0x63, 0x3E, 0x23, 0xE2, 0x16, 0xC8, 0xAD, 0xD1, 0x88,
+    0xC1, 0xC5, 0xAD, 0x51, 0x0F, 0xA8, 0x52, 0x92, 0xE5, 0xD3, 0xE9, 0x91, 0x0E, 0x84, 0x25, 0x5C,
+    0x51, 0xA3, 0x9F, 0x5D, 0x46, 0xEC, 0x88, 0x8A, 0xB6, 0xF2, 0xE7, 0x74, 0x22, 0xDC, 0x32, 0x9B,
+    0xBB, 0x18, 0x53, 0xB7, 0xC4, 0xEF, 0xF0, 0xDD, 0xC4, 0xE4, 0x7B, 0xB3, 0x3C, 0x85, 0xCE, 0x2C,
+    0xD5, 0xB7, 0x84, 0xEF, 0xFB, 0x69, 0x96, 0x25, 0x46, 0x57, 0xAB, 0x85, 0x73, 0x02, 0x57, 0x1F,
+    0xC1, 0x23, 0xE0, 0x05, 0x9E, 0xF6, 0xC2, 0x3B, 0xED, 0xC5, 0xD3, 0xDA, 0xAE, 0x85, 0x6E, 0x0D,
+    0xC9, 0x53, 0x44, 0x7B, 0xEF, 0xA5, 0x1B, 0x16, 0x44, 0xF0, 0x8B, 0x7E, 0xD9, 0xA8, 0xB4, 0xCD,
+    0x9A, 0x8F, 0x97, 0x89, 0x29, 0x7E, 0xD5, 0xC1, 0x8D, 0xD0, 0x3C, 0xE4, 0xFA, 0x94, 0x02, 0xFF,
+    0xD4, 0xE3, 0x98, 0x9B, 0xC5, 0x6C, 0x36, 0x4D, 0x8C, 0x31, 0x7A, 0xCC, 0x45, 0x11, 0x98, 0x13,
+    0xE7, 0x34, 0x91, 0x87, 0x65, 0x3D, 0x59, 0x40, 0xD8, 0xF4, 0xEC, 0x12, 0x75, 0xAF, 0xCC, 0x9D,
+    0x21, 0x71, 0x2E, 0xFE, 0xD7, 0x51, 0x9F, 0x73, 0xBB, 0xEE, 0xD6, 0x46, 0x7E, 0x07, 0xD3, 0x0E,
+    0xF2, 0x03, 0xE8, 0xB9, 0x51, 0x83, 0x81, 0xA8, 0x0E, 0x04, 0x61, 0xE8, 0x40, 0xA7, 0x96, 0xFA,
+    0xFE, 0x8E, 0x9A, 0xCD, 0xA4, 0xF5, 0xAA, 0x08, 0x4D, 0x4E, 0x24, 0xFA, 0x3E, 0xE1, 0x6D, 0x66,
+    0x81, 0xF6, 0xE4, 0x91, 0xF6, 0x05, 0x26, 0x2C, 0x7E, 0x41, 0x7E, 0x69, 0xCB, 0x10, 0x0D, 0x30,
+    0xB3, 0xC0, 0x3C, 0x3A, 0xCF, 0x6F, 0xC9, 0xFC, 0x80, 0xBD, 0xF2, 0x72, 0x54, 0x54, 0x81, 0x97,
+    0xA3, 0x02, 0xBA, 0xAE, 0x42, 0x84, 0x0F, 0xD4, 0x91, 0x91, 0xD3, 0x36, 0xB6, 0x90, 0x30, 0x30,
+    0x17, 0x9B, 0x05, 0xF3, 0x59, 0xCA, 0xDE, 0xBD, 0x3C, 0xFE, 0x53, 0x5B, 0x0A, 0x87, 0x77, 0x4F,
+    0x3E, 0xA2, 0x15, 0x9A, 0x6B, 0x0D, 0x6E, 0x75, 0xF1, 0x42, 0x97, 0xD5, 0x63, 0x4D, 0x07, 0x83,
+    0xFF, 0x38, 0x68, 0x95, 0x74, 0x8F, 0x09, 0xD0, 0x4D, 0x61, 0x94, 0x2D, 0x1D, 0xE1, 0x94, 0x50,
+    0x35, 0x7D, 0xEF, 0x34, 0xE7, 0x9D, 0xBB, 0xF6, 0x73, 0x41, 0xCC, 0x62, 0xF0, 0xFB, 0x98, 0x94,
+    0xA2, 0x3C, 0x6B, 0xCF, 0x75, 0xE7, 0x79, 0xD2, 0x15, 0x16, 0xF1, 0x99, 0x50, 0xC1, 0x77, 0xCF,
+    0xB2, 0x0B, 0xFB, 0x7A, 0xC5, 0x82, 0x2B, 0x27, 0x6D, 0xA3, 0x3A, 0x65, 0x35, 0x2A, 0xAB, 0x08,
+    0xBE, 0x91, 0x89, 0x51, 0x1B, 0x17, 0x4A, 0x0B, 0xA4, 0xEB, 0x58, 0x34, 0x69, 0xA5, 0x0B, 0x63,
+    0x2F, 0xBD, 0xC5, 0xEF, 0xD6, 0xED, 0xD5, 0x8C, 0x8C, 0x45, 0xAA, 0xAB, 0x5F, 0x20, 0xC5, 0xC5,
+    0x2A, 0x3D, 0x0D, 0x69, 0xD0, 0x12, 0x4C, 0xEC, 0x01, 0x97, 0xF4, 0x27, 0x60, 0xED, 0xF1, 0x42,
+    0xBD, 0x95, 0xB4, 0x22, 0xB1, 0x5D, 0x20, 0x4F, 0xEC, 0x6F, 0x58, 0x7D, 0xE8, 0xF5, 0x2F, 0x91,
+    0x96, 0x06, 0x7E, 0xB3, 0x6E, 0x54, 0xB3, 0xD2, 0xA8, 0xC4, 0x3D, 0xDE, 0xC4, 0x31, 0x0A, 0xB6,
+    0xAF, 0xC7, 0x59, 0x7E, 0xB0, 0xC5, 0xD2, 0x9D, 0x85, 0x27, 0x1D, 0xF7, 0x59, 0x65, 0x6B, 0x1A,
+    0xC0, 0xFB, 0x62, 0x2C, 0x12, 0xFC, 0x20, 0x9F, 0x41, 0x45, 0x8C, 0xF1, 0x1D, 0xF6, 0xF9, 0xEE,
+    0x20, 0x94, 0x8E, 0x0A, 0x25, 0xAB, 0xB6, 0x81, 0x63, 0x4F, 0x78, 0x6F, 0xC9, 0xE3, 0xEB, 0x4A,
+    0xA7, 0x7A, 0xAD, 0xE6, 0xB8, 0x3D, 0xFF, 0x71, 0x87, 0x71, 0xF1, 0x8A, 0x0E, 0x27, 0xA1, 0xBA,
+    0x24, 0x89, 0x43, 0xF2, 0x87, 0x4E, 0x17, 0xD9, 0x34, 0x4B, 0x3F, 0xF8, 0x2B, 0x0F, 0x3F, 0x93,
+    0xBB, 0x8C, 0x7F, 0x2E, 0xDF, 0x14, 0xF6, 0x39, 0x71, 0xDA, 0xE5, 0xCD, 0xD6, 0xCC, 0xB8, 0x62,
+    0xCC, 0x19, 0xB0, 0x33, 0x13, 0xBC, 0x2A, 0x64, 0x13, 0x7B, 0x8B, 0xAB, 0x82, 0x89, 0x75, 0x1F,
+    0xB6, 0x31, 0xBC, 0xC6, 0x3B, 0x5F, 0x15, 0xB5, 0x30, 0x9A, 0x53, 0x9D, 0xBF, 0xC1, 0x02, 0xF9,
+    0x81, 0xF9, 0x15, 0x59, 0xEF, 0x0D, 0x8A, 0xA6, 0x58, 0xBD, 0x4F, 0x9B, 0x03, 0xCE, 0x7D, 0xDA,
+    0xB2, 0x1F, 0x0D, 0xE6, 0xC2, 0x93, 0xB4, 0x5F, 0xF4, 0xA9, 0x45, 0xD1, 0x4E, 0x7C, 0x3C, 0x19,
+    0x96, 0xB8, 0x39, 0x9B, 0xDD, 0xC9, 0x49, 0x7E, 0xB3, 0x28, 0x4A, 0x20, 0x4B, 0xA9, 0xFB, 0xE9,
+    0x95, 0x88, 0x63, 0x7A, 0x4D, 0x5F, 0x12, 0x81, 0x8C, 0xD4, 0x1D, 0xA1, 0xF1, 0x39, 0x2E, 0x91,
+    0x36, 0x5B, 0x8D, 0x28, 0x1A, 0x0A, 0x57, 0x37, 0x8A, 0xF3, 0xA8, 0xC3, 0xEC, 0xB7, 0x1B, 0x8D,
+    0x27, 0xBA, 0xDB, 0x62, 0x43, 0x46, 0x65, 0x41, 0x52, 0xEA, 0x72, 0x6C, 0x62, 0xDB, 0xBD, 0x7D,
+    0xE5, 0xE9, 0x69, 0x21, 0xD8, 0xC4, 0x4E, 0xDE, 0x8C, 0x3A, 0x34, 0xB2, 0x3B, 0xF1, 0xC5, 0xFA,
+    0xB7, 0x7A, 0xB3, 0x3B, 0xDC, 0x8E, 0x86, 0x8D, 0x68, 0x12, 0x0D, 0x95, 0x2F, 0xC4, 0x8E, 0x6C,
+    0xB2, 0x43, 0x45, 0xEC, 0x1C, 0x0C, 0x71, 0xEB, 0xC3, 0x68, 0x38, 0xD1, 0x8D, 0xFE, 0xE4, 0x6D,
+    0xF5, 0x0E, 0x5E, 0x22, 0x11, 0xB6, 0xB0, 0xB6, 0xBB, 0xAE, 0x1C, 0x76, 0x97, 0x06, 0x95, 0xFF,
+    0x06, 0xCD, 0x7C, 0x4F, 0x8C, 0x1C, 0xE7, 0x75, 0xE7, 0xAB, 0x2A, 0x91, 0x65, 0xB0, 0x10, 0x96,
+    0x0E, 0x92, 0x13, 0x9B, 0xAB, 0x29, 0x1F, 0x7C, 0x70, 0x62, 0x4D, 0xF7, 0xC5, 0x01, 0x1C, 0xA0,
+    0xBA, 0xBB, 0x24, 0x01, 0xAB, 0x83, 0x0E, 0x9E, 0x05, 0x38, 0x76, 0x80, 0x00, 0xA6, 0x0F, 0x3E,
+    0x24, 0x42, 0x12, 0x1A, 0x88, 0x03, 0x0C, 0x82, 0x26, 0xA7, 0x24, 0x1D, 0x7C, 0x30, 0xB0, 0x66,
+    0x80, 0xF5, 0xE6, 0xB6, 0xD1, 0x41, 0x07, 0x2F, 0xB9, 0xBB, 0x64, 0x80, 0x01, 0xB6, 0x17, 0x69,
+    0xB2, 0x4B, 0xE2, 0x41, 0x07, 0x1F, 0x58, 0x96, 0xAD, 0xE8, 0x20, 0xC4, 0x2A, 0xCB, 0x24, 0x8C,
+    0x25, 0xB1, 0x66, 0xD9, 0x2E, 0x26, 0x45, 0xB2, 0xA7, 0x2B, 0xBF, 0xDF, 0xFB, 0xBE, 0xEA, 0xEE,
+    0x19, 0x36, 0x49, 0xF1, 0x9F, 0x37, 0x33, 0x5D, 0x1F, 0x39, 0xDD, 0x55, 0xDF, 0xF7, 0xDE, 0xFB,
+    0xDE, 0xFF, 0xF7, 0xBE, 0x16, 0xC1, 0x8F, 0x5B, 0x60, 0x28, 0x71, 0x7D, 0x19, 0xD7, 0x7F, 0x10,
+    0xFD, 0xD9, 0x6E, 0x72, 0x99, 0xE0, 0xAA, 0xCC, 0x47, 0x4E, 0x69, 0x6E, 0xE3, 0xE5, 0x5D, 0x39,
+    0x2A, 0x5E, 0xB3, 0x2B, 0xFE, 0xD5, 0x1F, 0x48, 0x90, 0x8A, 0x84, 0x09, 0x2E, 0x31, 0x57, 0x84,
+    0xAB, 0x83, 0x6B, 0xD0, 0x94, 0x7A, 0x89, 0xF3, 0x42, 0x22, 0xDE, 0xC5, 0x4C, 0xFC, 0xEF, 0x64,
+    0xE2, 0xC8, 0x63, 0x9D, 0x7B, 0xD0, 0x34, 0x98, 0xAA, 0x11, 0x19, 0xE1, 0xCD, 0xFD, 0x73, 0xDD,
+    0xBE, 0x8C, 0x79, 0x1A, 0xF1, 0xF2, 0x28, 0xF5, 0x33, 0x3F, 0x0B, 0x52, 0x2F, 0x0F, 0x13, 0x5C,
+    0xE2, 0x65, 0xA1, 0x04, 0x59, 0x24, 0x51, 0xD2, 0x39, 0x3C, 0x93, 0x5E, 0x58, 0xCB, 0xE2, 0xC7,
+    0xCF, 0xCC, 0x4A, 0x31, 0xAE, 0x6F, 0x2D, 0xC3, 0x9A, 0xAD, 0x84, 0x35, 0xC7, 0x95, 0x99, 0xA7,
+    0xEE, 0x06, 0x6B, 0xCF, 0xCE, 0x66, 0xA6, 0x6F, 0x0A, 0x00, 0x5D, 0xC9, 0xAE, 0x7C, 0xCE, 0xC3,
+    0x3C, 0x41, 0x66, 0x9E, 0xE9, 0xE2, 0xA3, 0xBE, 0xE2, 0x35, 0xC5, 0x55, 0xCB, 0x10, 0xFF, 0x6F,
+    0x2F, 0x3E, 0x3F, 0xE0, 0x7C, 0x98, 0xDF, 0x9F, 0xED, 0x8A, 0x83, 0x7B, 0xE6, 0x3F, 0xDD, 0x59,
+    0x22, 0x4D, 0x93, 0xBA, 0x95, 0xAB, 0xB0, 0xF8, 0x16, 0x16, 0x8F, 0xF0, 0x11, 0xAD, 0x09, 0x26,
+    0x8F, 0xF8, 0x07, 0x81, 0x1F, 0x5B, 0x48, 0x62, 0xFD, 0xFF, 0x86, 0x53, 0xCB, 0x64, 0x52, 0x00,
+    0xBD, 0xC4, 0xCC, 0xB5, 0x05, 0x2A, 0x56, 0x52, 0x3A, 0xA5, 0x5B, 0xB8, 0x85, 0x97, 0x7B, 0x4A,
+    0xB3, 0x30, 0xC1, 0x2F, 0x70, 0xE9, 0x00, 0x0E, 0x3C, 0xF7, 0x9F, 0x12, 0xF9, 0x4D, 0xC6, 0x57,
+    0xFB, 0x08, 0x29, 0x5F, 0x91, 0x2E, 0x20, 0x0B, 0x28, 0x82, 0x17, 0xE0, 0x00, 0x49, 0x00, 0x05,
+    0x08, 0x02, 0xDC, 0xF8, 0x52, 0x62, 0x74, 0x14, 0x15, 0xA5, 0x44, 0xAC, 0x98, 0xDD, 0xF7, 0x49,
+    0xD9, 0xFF, 0xE4, 0x58, 0xFE, 0x63, 0x25, 0xA0, 0xE0, 0x69, 0x4E, 0xD2, 0x60, 0x4B, 0x40, 0x0C,
+    0x8E, 0x6E, 0xAE, 0x48, 0x67, 0xDC, 0x02, 0x3F, 0x23, 0x41, 0x09, 0x38, 0x49, 0x6B, 0x36, 0x23,
+    0x9A, 0x71, 0x9E, 0x2E, 0x9E, 0x5C, 0x97, 0x1E, 0x48, 0x11, 0xE3, 0x77, 0x84, 0x6B, 0x88, 0xDF,
+    0x2D, 0x1D, 0x2B, 0xFC, 0x3D, 0x02, 0x2C, 0x95, 0x54, 0xA0, 0x5D, 0xE9, 0x97, 0x4D, 0xC6, 0xA9,
+    0x1B, 0x71, 0x9B, 0x9B, 0x32, 0x47, 0x96, 0xB3, 0x8D, 0x74, 0x63, 0x2B, 0xDD, 0xDA, 0x92, 0x23,
+    0xC0, 0xEF, 0x29, 0x37, 0xC4, 0x3A, 0x02, 0x31, 0xEF, 0xD6, 0xE9, 0xD9, 0x5B, 0xE4, 0xBD, 0xA6,
+    0x49, 0xFC, 0xF7, 0x37, 0x6F, 0x1C, 0x27, 0x60, 0xA5, 0x57, 0x84, 0x09, 0x69, 0x1B, 0x0A, 0xE9,
+    0x0B, 0x2E, 0xCC, 0xC1, 0x99, 0x42, 0x2A, 0x77, 0x00, 0x74, 0x37, 0xED, 0x81, 0x39, 0x66, 0x98,
+    0x24, 0x50, 0x16, 0xB9, 0x17, 0x5F, 0xD7, 0x9C, 0x1B, 0x9C, 0x1C, 0xE1, 0x59, 0x22, 0x0D, 0x7E,
+    0x4E, 0xC8, 0xD3, 0x3E, 0xF9, 0x3A, 0x8D, 0x24, 0x48, 0x3A, 0x40, 0xBD, 0xA7, 0xE0, 0x9A, 0x1F,
+    0xB2, 0x02, 0xF9, 0x03, 0x1F, 0x61, 0xF8, 0x9D, 0x05, 0x46, 0x1D, 0x2E, 0x01, 0xBE, 0xA8, 0x38,
+    0x7B, 0x09, 0x2A, 0x3A, 0x25, 0x08, 0xE7, 0x16, 0xC4, 0x28, 0xC7, 0x53, 0xDE, 0x2F, 0xC8, 0xE5,
+    0xA4, 0xB1, 0x7F, 0x8D, 0x3C, 0xFE, 0x06, 0x26, 0x09, 0x5F, 0x2C, 0x49, 0x54, 0x1D, 0x46, 0x24,
+    0xEC, 0x50, 0x94, 0x3D, 0xF0, 0x8A, 0xB8, 0x4D, 0x61, 0xD2, 0xCE, 0x4F, 0x96, 0x36, 0x50, 0xF8,
+    0x29, 0x95, 0xCC, 0x82, 0x6D, 0xB0, 0x12, 0x08, 0x49, 0x99, 0x1A, 0x64, 0x98, 0xA9, 0x49, 0x41,
+    0x99, 0x6B, 0x89, 0x5B, 0xF8, 0x97, 0xB0, 0x78, 0x48, 0xE2, 0xF4, 0xD6, 0x40, 0x9B, 0x11, 0x48,
+    0xF3, 0x76, 0xD9, 0xC3, 0xBA, 0x19, 0xE6, 0xFD, 0x4A, 0x32, 0x94, 0xB0, 0x83, 0x07, 0x43, 0x6E,
+    0x58, 0x54, 0xE2, 0xC1, 0x6E, 0x8E, 0x61, 0x00, 0xBA, 0x62, 0x2D, 0x12, 0x27, 0x24, 0x1E, 0xE1,
+    0x77, 0x28, 0x96, 0xCA, 0xD6, 0x47, 0x5B, 0xB9, 0x4B, 0x01, 0x22, 0x98, 0xAB, 0x47, 0x32, 0xD4,
+    0xB8, 0xD5, 0x21, 0xDF, 0x91, 0x24, 0x44, 0x5A, 0x2A, 0xC2, 0x3C, 0xE2, 0x96, 0x0E, 0x55, 0x40,
+    0x76, 0x30, 0xAC, 0x53, 0x1D, 0x46, 0x24, 0x5A, 0x98, 0x5A, 0x71, 0x56, 0x59, 0x74, 0x28, 0x7E,
+    0xD4, 0x6B, 0x80, 0x5A, 0x16, 0x94, 0x04, 0x65, 0x47, 0x44, 0xBD, 0x22, 0xC2, 0x25, 0x6E, 0xC7,
+    0x0A, 0x6B, 0x84, 0xA9, 0xC3, 0x41, 0xD7, 0x8D, 0x09, 0xC1, 0xD0, 0xE0, 0x0E, 0x8E, 0xA8, 0xEC,
+    0xED, 0x09, 0x6E, 0x0F, 0x79, 0x7B, 0x64, 0x6E, 0xC7, 0x9D, 0x03, 0xB2, 0xB5, 0x0E, 0x86, 0x7C,
+    0x6B, 0x1C, 0xD6, 0x65, 0xAE, 0x49, 0x08, 0x11, 0xA8, 0x47, 0xE2, 0xC9, 0x3F, 0xE2, 0x82, 0x40,
+    0xBA, 0x3F, 0x87, 0xF4, 0xBC, 0x93, 0x4B, 0xF0, 0x7A, 0x21, 0x91, 0x53, 0x48, 0x1F, 0x13, 0x9E,
+    0x3C, 0x0D, 0xD2, 0x36, 0xA5, 0x73, 0x63, 0x93, 0xA8, 0x56, 0xD0, 0x36, 0x44, 0x74, 0x04, 0x6D,
+    0x33, 0xEA, 0x51, 0x04, 0xB7, 0x81, 0xC6, 0xA4, 0x29, 0xEF, 0xE0, 0x30, 0x92, 0x6F, 0x76, 0x0A,
+    0x24, 0x9C, 0x02, 0xD8, 0x6D, 0xB1, 0x5A, 0x20, 0x0D, 0x55, 0xA0, 0xC2, 0x04, 0xA2, 0x04, 0x30,
+    0xCF, 0xAB, 0x22, 0x1B, 0x90, 0x08, 0xDB, 0x90, 0x11, 0xD5, 0x90, 0x3E, 0xF6, 0xC4, 0x21, 0x2F,
+    0x55, 0x98, 0xA7, 0x74, 0x73, 0xE8, 0x91, 0xF7, 0x8F, 0x65, 0x1E, 0x64, 0xC8, 0xBF, 0x7A, 0xDE,
+    0xCE, 0xE3, 0x5B, 0x4E, 0xF5, 0xA1, 0x81, 0xC3, 0xB4, 0x03, 0xDD, 0x36, 0x80, 0xB6, 0x1F, 0x80,
+    0xEB, 0x1F, 0x9F, 0xA6, 0x0D, 0x28, 0x3B, 0x12, 0xEA, 0x18, 0xE9, 0x67, 0xEB, 0xF6, 0x53, 0xA3,
+    0xFF, 0x86, 0x56, 0xDD, 0x89, 0x0A, 0xBE, 0xA8, 0xE0, 0x73, 0x39, 0x5D, 0x90, 0xCB, 0x7A, 0x19,
+    0x17, 0xA5, 0xC9, 0xE0, 0x12, 0x5C, 0xB8, 0xAF, 0xE3, 0x98, 0x00, 0x60, 0x5E, 0x50, 0x86, 0x63,
+    0xAD, 0x6B, 0x8F, 0x74, 0x85, 0x4A, 0x57, 0x28, 0xB9, 0x02, 0x67, 0x78, 0x5C, 0xD6, 0x73, 0x0D,
+    0xBF, 0x1D, 0x7E, 0xD6, 0x23, 0xD4, 0x41, 0x1A, 0x3B, 0x15, 0xC1, 0x8B, 0x09, 0x99, 0x9B, 0x0F,
+    0xC9, 0x09, 0x4E, 0x39, 0x52, 0x49, 0xAB, 0x2A, 0x6A, 0x78, 0x39, 0xF1, 0x2F, 0xA5, 0x31, 0x5B,
+    0x2A, 0x6E, 0xCD, 0x6D, 0xFE, 0xE3, 0x7D, 0xFC, 0x73, 0xE5, 0xE4, 0x8B, 0x3F, 0xE2, 0x67, 0x5D,
+    0x2F, 0x23, 0x58, 0x43, 0x3F, 0x03, 0xF2, 0x4E, 0x85, 0x49, 0x49, 0x60, 0xAA, 0x0C, 0xE1, 0x2E,
+    0x47, 0x34, 0x38, 0xE1, 0x5C, 0x8E, 0x27, 0xBB, 0x54, 0xB6, 0xA9, 0x24, 0x81, 0xB5, 0x2C, 0x9E,
+    0xDD, 0x0F, 0xEE, 0xC5, 0x71, 0x7C, 0x7E, 0x59, 0xE4, 0xD5, 0xDA, 0xC2, 0xAD, 0x78, 0x24, 0xAD,
+    0x55, 0x7B, 0x5A, 0x2E, 0xC8, 0xE0, 0x7A, 0x0D, 0xD5, 0x9B, 0x3F, 0x69, 0xC9, 0x97, 0x92, 0x42,
+    0x52, 0x71, 0x67, 0xB7, 0x89, 0xDC, 0x01, 0x79, 0xE2, 0xCA, 0xE6, 0x09, 0xAA, 0xCF, 0x06, 0xE2,
+    0xE0, 0x70, 0x70, 0x73, 0xB5, 0x8A, 0x6A, 0x17, 0xD5, 0x32, 0x92, 0xFF, 0x12, 0x1A, 0x48, 0xDE,
+    0x18, 0x91, 0xDE, 0xEB, 0xE6, 0xB9, 0x0E, 0x87, 0x75, 0x42, 0xD5, 0x23, 0x33, 0xC6, 0x64, 0xBB,
+    0x21, 0xF7, 0x6A, 0x24, 0x2A, 0x52, 0x8D, 0x71, 0xF0, 0xF8, 0x73, 0x12, 0x7B, 0x93, 0xC9, 0x04,
+    0xDB, 0x9C, 0xF2, 0xED, 0x49, 0x2A, 0xB7, 0xB1, 0x5A, 0xE2, 0x5C, 0x4B, 0xBC, 0x8F, 0xC4, 0xFD,
+    0x45, 0xE2, 0xFF, 0xBD, 0xB8, 0x1F, 0xA4, 0xC0, 0xDE, 0x7B, 0x37, 0x5D, 0x5B, 0xA7, 0xF3, 0x16,
+    0xC3, 0x3A, 0x5D, 0xCC, 0x76, 0x62, 0x12, 0xA7, 0x04, 0x61, 0x5E, 0x7A, 0x27, 0x07, 0x65, 0xDC,
+    0x8B, 0xE0, 0xA3, 0xD0, 0xFD, 0x30, 0x81, 0xAA, 0x73, 0x66, 0x98, 0x7E, 0xDD, 0x99, 0xAA, 0x39,
+    0xAC, 0xD5, 0x1C, 0xAA, 0x7E, 0xDD, 0xA2, 0xEE, 0xB5, 0xFA, 0x2E, 0x50, 0x55, 0x47, 0x02, 0xD2,
+    0x08, 0xCE, 0xF5, 0xDD, 0x95, 0xCD, 0x13, 0xB4, 0x68, 0x50, 0x36, 0x57, 0x4F, 0x4F, 0x79, 0xE7,
+    0x90, 0xB8, 0x8D, 0x88, 0xDB, 0xB2, 0x36, 0xB5, 0x8A, 0x54, 0xA7, 0xF6, 0x2C, 0x3F, 0x05, 0xD0,
+    0xF2, 0xD0, 0x62, 0x4E, 0xED, 0xD4, 0xC0, 0x74, 0x08, 0x0E, 0xED, 0xE1, 0xD1, 0x0E, 0x34, 0x5C,
+    0x07, 0x22, 0xD1, 0x01, 0x25, 0x3A, 0x20, 0x6F, 0x0F, 0x57, 0x8C, 0x6B, 0x88, 0xAB, 0xEE, 0x61,
+    0x2E, 0x08, 0x73, 0x11, 0xA5, 0x51, 0x16, 0xCC, 0x1A, 0x20, 0x5E, 0xB5, 0x7E, 0x1E, 0x98, 0x7C,
+    0x02, 0xCB, 0xBA, 0x4A, 0x29, 0xDF, 0xA9, 0xC3, 0x87, 0x84, 0x74, 0x59, 0xE5, 0xDF, 0xF5, 0x76,
+    0xD9, 0xAE, 0xA9, 0x1F, 0x41, 0x81, 0x23, 0x39, 0xFD, 0x00, 0xC7, 0xF8, 0x58, 0xAD, 0x9F, 0x05,
+    0x4F, 0x0B, 0x1E, 0x2A, 0x6C, 0x7F, 0xD0, 0x5C, 0x7E, 0x64, 0x0F, 0xB2, 0xBD, 0xF7, 0x93, 0x78,
+    0x90, 0x30, 0x30, 0xA9, 0x22, 0xBD, 0xFF, 0xC1, 0xD6, 0xEB, 0xD8, 0xA7, 0xBB, 0x96, 0x75, 0xF0,
+    0xB2, 0x1E, 0x7E, 0xD2, 0xC6, 0xD5, 0xFC, 0xA8, 0x5C, 0x90, 0x2C, 0x07, 0x41, 0x26, 0xEE, 0x93,
+    0x78, 0x55, 0x2F, 0xCA, 0xC2, 0x34, 0xF6, 0x8A, 0xAE, 0x0C, 0x9D, 0x92, 0x0A, 0xB2, 0x84, 0x63,
+    0xE7, 0x80, 0x41, 0x2B, 0x0E, 0x20, 0x70, 0x0C, 0x38, 0xB2, 0x3E, 0xA4, 0x3C, 0x8D, 0x7E, 0xFC,
+    0xA3, 0x09, 0x88, 0x07, 0x95, 0x2D, 0xC7, 0x67, 0x89, 0x41, 0x40, 0x31, 0x30, 0x31, 0x49, 0x6C,
+    0xB0, 0x88, 0x08, 0x0B, 0xD5, 0x20, 0x5D, 0x26, 0x9A, 0x52, 0x88, 0x00, 0xB5, 0xDE, 0x47, 0xBC,
+    0x6F, 0xB7, 0x75, 0xA5, 0x5C, 0x42, 0x19, 0x70, 0x88, 0x74, 0x7F, 0x08, 0x7E, 0x0D, 0xD0, 0xDC,
+    0x12, 0x13, 0xAA, 0x9C, 0x32, 0xD0, 0x98, 0x6B, 0x89, 0x55, 0xAE, 0x41, 0x74, 0x4F, 0xD7, 0x60,
+    0xE7, 0x9E, 0xAE, 0xC1, 0x8C, 0xC3, 0xEE, 0xDC, 0x1B, 0xD0, 0x81, 0xDB, 0xA6, 0x22, 0xE3, 0x32,
+    0xC0, 0x51, 0xC7, 0x92, 0x6E, 0x25, 0xC4, 0x16, 0xCA, 0x8C, 0x0A, 0x3E, 0x4C, 0x70, 0x01, 0x24,
+    0x84, 0x3D, 0x57, 0x67, 0x20, 0x04, 0x9E, 0x7F, 0x66, 0xD5, 0x9E, 0x97, 0xE6, 0xDA, 0xC2, 0x07,
+    0x6B, 0xEA, 0x24, 0x77, 0xF0, 0xF6, 0x10, 0x50, 0x96, 0xFC, 0x8B, 0xA6, 0x5D, 0x62, 0xC0, 0x82,
+    0xF7, 0x5C, 0xAA, 0xC3, 0x91, 0x97, 0xF3, 0x3D, 0xB5, 0x97, 0xD8, 0x6D, 0xFE, 0x45, 0x87, 0x14,
+    0x14, 0x87, 0xA1, 0xA7, 0x9B, 0xCB, 0xF7, 0xE8, 0x96, 0x7A, 0x34, 0xF7, 0x09, 0x9D, 0x5D, 0xFE,
+    0x35, 0x50, 0xE7, 0x58, 0x47, 0xA3, 0xB1, 0x56, 0xAF, 0xB5, 0x33, 0x5F, 0xAB, 0xB8, 0xFB, 0x5A,
+    0x4E, 0x41, 0xF7, 0xF7, 0x3E, 0x6B, 0x4D, 0x75, 0x34, 0x91, 0xDE, 0x8E, 0x8E, 0x46, 0xEA, 0x55,
+    0x25, 0x3A, 0xE5, 0x00, 0x9B, 0xB9, 0x3D, 0x95, 0xD5, 0x0E, 0x37, 0x24, 0x8E, 0xE6, 0xDA, 0x83,
+    0x2B, 0xC4, 0xE8, 0x22, 0x48, 0xD5, 0x91, 0xB1, 0xA1, 0x51, 0x17, 0x14, 0x3D, 0x0F, 0x03, 0x57,
+    0x1B, 0x57, 0x68, 0x4B, 0x14, 0x15, 0xC5, 0x44, 0x11, 0x51, 0x3C, 0x14, 0x0D, 0xC5, 0x02, 0x48,
+    0x34, 0xA7, 0x80, 0x03, 0x44, 0x10, 0x28, 0x9C, 0x24, 0x06, 0x11, 0x11, 0x08, 0x5F, 0x04, 0xFC,
+    0x21, 0xC1, 0x8F, 0x08, 0x7D, 0x1F, 0xC0, 0x3B, 0x53, 0xC2, 0x0E, 0xE9, 0x19, 0x34, 0x58, 0x89,
+    0x33, 0xAF, 0x84, 0x4E, 0x2D, 0xCC, 0x1E, 0x67, 0x4D, 0x0C, 0x64, 0x7A, 0xC9, 0x1D, 0xCE, 0x1A,
+    0xF9, 0xB7, 0x31, 0x21, 0x84, 0x93, 0xD0, 0x89, 0x54, 0x4F, 0xC2, 0xCE, 0x68, 0xAF, 0x46, 0x1D,
+    0xC3, 0x25, 0x91, 0x6F, 0xD5, 0xCC, 0x40, 0x45, 0x94, 0x3E, 0xE3, 0x3C, 0x6C, 0x6C, 0xAD, 0x2C,
+    0x83, 0xAC, 0x91, 0x46, 0x65, 0x95, 0xA7, 0x8E, 0x60, 0x98, 0xD1, 0x15, 0x84, 0x6C, 0xC0, 0x1A,
+    0x40, 0xC3, 0x8C, 0x21, 0x8D, 0xA0, 0x81, 0x77, 0x05, 0xF6, 0x72, 0xEC, 0x71, 0x2B, 0x46, 0xFE,
+    0x55, 0x20, 0x53, 0x07, 0x69, 0xA5, 0x4A, 0xA2, 0xA2, 0xF5, 0x04, 0x7A, 0xDC, 0xC9, 0x5A, 0xDD,
+    0xC3, 0xA1, 0x75, 0x10, 0xB7, 0x69, 0x1B, 0x6F, 0x4F, 0xC1, 0x20, 0x6E, 0xEB, 0x48, 0x00, 0x0E,
+    0xF8, 0x25, 0x21, 0xE3, 0x65, 0x18, 0xEA, 0xB1, 0x0D, 0xE1, 0x2A, 0xFD, 0x2D, 0x65, 0x0C, 0x1C,
+    0x06, 0x5F, 0x2D, 0xF0, 0x39, 0xAE, 0x33, 0x90, 0x44, 0xE0, 0x30, 0xF6, 0x33, 0xE5, 0x97, 0xDC,
+    0xEC, 0x1D, 0x3D, 0x9C, 0x31, 0xE5, 0xFD, 0x33, 0x0E, 0x66, 0x7D, 0x37, 0x09, 0xAE, 0x34, 0x12,
+    0xE1, 0xDD, 0x3E, 0x7E, 0x87, 0xB8, 0x46, 0x58, 0x93, 0x56, 0xB4, 0xD2, 0xA9, 0x6B, 0x78, 0xB4,
+    0x58, 0xC0, 0xAF, 0x64, 0xFB, 0x3C, 0x1C, 0x81, 0xB2, 0x5C, 0x42, 0xFD, 0x78, 0x26, 0x11, 0xB0,
+    0x9E, 0x9C, 0xD2, 0x28, 0xDB, 0xB7, 0x94, 0x8A, 0xA0, 0xEB, 0x3B, 0x13, 0x80, 0x97, 0x9F, 0x00,
+    0x06, 0x1D, 0x39, 0x81, 0xB5, 0xB8, 0x1E, 0x9D, 0xC5, 0x1D, 0xCC, 0xBD, 0xA3, 0x31, 0xA8, 0x61,
+    0xF3, 0xEE, 0x59, 0xF8, 0xED, 0x8D, 0x9D, 0xEE, 0xE0, 0x29, 0x75, 0xB9, 0xDC, 0x1B, 0xCA, 0x6D,
+    0x62, 0xC2, 0xEF, 0xBE, 0x74, 0x4F, 0xD7, 0xEA, 0x24, 0xF7, 0x40, 0x7F, 0x86, 0xE2, 0x3D, 0xFC,
+    0x76, 0x49, 0xA1, 0x6B, 0xD5, 0x82, 0x2A, 0xAF, 0x26, 0x7E, 0x53, 0x7A, 0x7F, 0x5B, 0xDB, 0xF8,
+    0x1A, 0xBB, 0xBA, 0x9D, 0xF9, 0x37, 0xA5, 0x9B, 0xDA, 0x90, 0x7B, 0x28, 0xC9, 0xE0, 0x4C, 0x16,
+    0xCE, 0x75, 0x2B, 0x59, 0xDB, 0xBD, 0x5A, 0x5B, 0xE5, 0x1B, 0x2D, 0xFC, 0xB7, 0x0B, 0x5F, 0xC1,
+    0x4C, 0x1F, 0x81, 0x50, 0x93, 0x84, 0x1B, 0x10, 0x2B, 0xE0, 0x91, 0x86, 0xBD, 0x95, 0x12, 0x66,
+    0xA8, 0x94, 0x1E, 0xC3, 0x04, 0x0D, 0xCE, 0x42, 0xDD, 0xCD, 0xEC, 0x84, 0x9F, 0x4D, 0x9C, 0xA6,
+    0x0C, 0xAE, 0x54, 0xB8, 0xBD, 0x0F, 0x67, 0xCC, 0x2D, 0x2F, 0x4C, 0x32, 0x88, 0x4E, 0x25, 0xF6,
+    0x65, 0x00, 0x08, 0x94, 0x77, 0x9C, 0x37, 0x65, 0x43, 0xBE, 0xE9, 0xE1, 0xD3, 0x60, 0xEA, 0x74,
+    0xA5, 0xEC, 0x1E, 0x95, 0xF0, 0x05, 0x28, 0x70, 0x09, 0x5E, 0x2B, 0x20, 0xA2, 0xFE, 0xEB, 0x39,
+    0xED, 0xDB, 0xB5, 0xAB, 0xA5, 0xFA, 0xF3, 0x0C, 0xEE, 0x5E, 0xBE, 0x08, 0x3C, 0xA3, 0xE0, 0x75,
+    0x8C, 0x9D, 0xE0, 0x45, 0x4A, 0x14, 0xE3, 0xBD, 0x2F, 0x82, 0x6B, 0x66, 0xE9, 0x20, 0x5B, 0xD3,
+    0x70, 0x48, 0x59, 0xE3, 0xCF, 0xB0, 0xF3, 0xF9, 0xA1, 0x97, 0x4B, 0x95, 0x14, 0xA6, 0x17, 0xDC,
+    0x26, 0xF5, 0x1A, 0x65, 0x63, 0xBA, 0x53, 0x39, 0x28, 0x7B, 0x6B, 0x92, 0x4C, 0x54, 0x87, 0x1E,
+    0x10, 0x07, 0xE2, 0x12, 0xD8, 0xC8, 0x26, 0x54, 0x23, 0xB0, 0x8E, 0x31, 0x56, 0x32, 0x9B, 0x24,
+    0xC1, 0x48, 0xA6, 0xB0, 0x2B, 0xF5, 0x82, 0x01, 0x2A, 0xCB, 0x00, 0xDF, 0x38, 0x04, 0x75, 0x02,
+    0xBA, 0xF5, 0xC1, 0xD4, 0x47, 0x0A, 0x79, 0xD4, 0xF9, 0x1C, 0x88, 0x24, 0x18, 0x34, 0xA5, 0xF2,
+    0xF6, 0xB2, 0x31, 0xFD, 0x51, 0x09, 0xBE, 0xC3, 0x88, 0x43, 0xCC, 0x85, 0xAD, 0x59, 0x03, 0x12,
+    0x1D, 0xA0, 0xD0, 0x33, 0x3E, 0x96, 0xCE, 0x26, 0xCE, 0xA6, 0x0D, 0x29, 0xDE, 0x1F, 0x63, 0x59,
+    0x70, 0x05, 0x05, 0x52, 0x79, 0xAD, 0x52, 0x2D, 0x44, 0x2E, 0xDB, 0xA2, 0x2A, 0xA5, 0xD2, 0xF4,
+    0xB2, 0x01, 0x7C, 0x8E, 0x41, 0xA2, 0x26, 0x50, 0x9C, 0x0D, 0xBC, 0xBC, 0x5A, 0xC2, 0x12, 0x43,
+    0x54, 0x78, 0x53, 0xE9, 0xE7, 0xFE, 0xFF, 0x90, 0xFF, 0x9D, 0x05, 0x7F, 0x81, 0xB8, 0x32, 0x7C,
+    0xCE, 0xFB, 0x20, 0x0B, 0x0F, 0xFB, 0xDF, 0x4D, 0xC3, 0x30, 0x0C, 0x92, 0xB5, 0x70, 0x3D, 0x94,
+    0xF5, 0x60, 0x18, 0x4A, 0xEC, 0x57, 0x6B, 0x18, 0x8A, 0x0E, 0x44, 0x1A, 0x66, 0xC6, 0x49, 0x64,
+    0xC3, 0x63, 0xBC, 0x97, 0xD1, 0x9F, 0x61, 0x56, 0x83, 0xD9, 0x23, 0x28, 0x23, 0xA8, 0x19, 0xC6,
+    0x61, 0x91, 0xAA, 0x22, 0xC6, 0x62, 0x1D, 0x65, 0x5D, 0x43, 0x89, 0x78, 0xC1, 0xEE, 0xD5, 0x71,
+    0xB2, 0x7B, 0x4A, 0xB5, 0x1D, 0x89, 0xC9, 0x89, 0xAC, 0x43, 0x99, 0xF5, 0x6C, 0x26, 0xA3, 0xA3,
+    0x74, 0x84, 0xCF, 0xA5, 0xEC, 0x9E, 0x59, 0x6A, 0xBD, 0x25, 0xDE, 0x0F, 0xE1, 0x07, 0xFC, 0xF2,
+    0x58, 0xEA, 0x21, 0xBA, 0xF5, 0xF3, 0x20, 0x0B, 0x98, 0xB3, 0x4A, 0x5B, 0xD5, 0x17, 0x41, 0x19,
+    0xEF, 0x5F, 0x13, 0x62, 0xB0, 0xF1, 0x19, 0x91, 0x5F, 0x61, 0x92, 0x7F, 0xFD, 0xBB, 0x52, 0x76,
+    0xE1, 0x8D, 0x51, 0xBA, 0x4B, 0x93, 0xF9, 0x31, 0xF4, 0x71, 0xD5, 0xBC, 0x60, 0xC6, 0x2C, 0x2C,
+    0xA2, 0x24, 0x3C, 0x39, 0x93, 0xA8, 0x5B, 0xD9, 0x38, 0x72, 0x91, 0x43, 0x6B, 0xCD, 0x26, 0x71,
+    0x98, 0x4C, 0xDD, 0x9B, 0x7F, 0xAC, 0x86, 0x7F, 0x91, 0xB1, 0x32, 0xAF, 0xBE, 0x3A, 0x67, 0xE1,
+    0xD5, 0xDC, 0x48, 0xA9, 0x93, 0x7C, 0xD3, 0x01, 0xD8, 0xEF, 0xCE, 0x20, 0x33, 0xDE, 0x4F, 0x8F,
+    0x9D, 0xE8, 0x8A, 0x57, 0x06, 0x88, 0x1A, 0x08, 0x3C, 0xD8, 0x26, 0x6B, 0xC3, 0x6C, 0x43, 0xB0,
+    0x35, 0xBD, 0x3A, 0xB8, 0x18, 0xC0, 0x76, 0xAC, 0xE4, 0x1B, 0xD2, 0x71, 0xE3, 0x87, 0xAA, 0xF4,
+    0xE4, 0x19, 0x86, 0x3B, 0x1A, 0x8E, 0x28, 0x7E, 0x31, 0xBD, 0x14, 0xB5, 0x3B, 0x3D, 0x2A, 0xF0,
+    0x75, 0x6E, 0x74, 0x87, 0x4A, 0x69, 0x8D, 0x22, 0xBE, 0x46, 0x59, 0x0F, 0x69, 0x4E, 0x42, 0x72,
+    0x5D, 0x48, 0xB6, 0x0D, 0xE6, 0xDE, 0xD0, 0xDC, 0x15, 0x13, 0x9A, 0xC3, 0x01, 0xEF, 0x18, 0x18,
+    0x75, 0xB1, 0xC2, 0x25, 0x75, 0xCE, 0x6B, 0xA0, 0xEB, 0xDE, 0xBC, 0x55, 0xF9, 0x79, 0x35, 0x0E,
+    0x93, 0xB2, 0x17, 0x39, 0x65, 0xA7, 0xE3, 0x16, 0x9D, 0x9E, 0x9B, 0x77, 0x7A, 0xE0, 0x0C, 0x5C,
+    0xC3, 0x8E, 0x9F, 0xD5, 0xE1, 0x77, 0xDF, 0x28, 0x7D, 0x5A, 0x87, 0xC9, 0x4D, 0x33, 0xCD, 0xDA,
+    0x3E, 0xEF, 0x96, 0xD4, 0xDC, 0xC0, 0x6F, 0xC9, 0x90, 0x05, 0xA0, 0xC4, 0xB8, 0x69, 0x7D, 0x68,
+    0x80, 0x0C, 0x19, 0x37, 0x01, 0x44, 0x44, 0x60, 0x72, 0x9E, 0xCE, 0x65, 0x05, 0x21, 0x1E, 0xAA,
+    0x4F, 0xD3, 0xC7, 0x24, 0x77, 0x13, 0xB9, 0xDE, 0x4A, 0x91, 0xAB, 0x21, 0x72, 0x17, 0x20, 0x72,
+    0xDB, 0xB2, 0x17, 0x90, 0xDF, 0xC3, 0x3C, 0x07, 0x56, 0x30, 0xEA, 0x79, 0xD5, 0xB9, 0x83, 0xB3,
+    0x90, 0xAC, 0xDD, 0x11, 0x64, 0x65, 0xC9, 0x00, 0x5B, 0x23, 0x7C, 0x40, 0x7F, 0x17, 0xBB, 0xD6,
+    0xD1, 0x6B, 0x5D, 0xAF, 0x58, 0x77, 0x6E, 0xD5, 0xAE, 0x8D, 0x34, 0x6C, 0x1C, 0xB9, 0x15, 0x94,
+    0xE8, 0x28, 0xA8, 0x81, 0xE7, 0xC9, 0xF1, 0xC9, 0xFF, 0x53, 0xC0, 0xBA, 0x74, 0x3F, 0x6E, 0xAD,
+    0xDC, 0xBD, 0x66, 0xEE, 0x3D, 0xE0, 0xCC, 0x37, 0x39, 0x73, 0x61, 0x34, 0xB5, 0x6E, 0xB0, 0x0D,
+    0x2A, 0xCC, 0xF8, 0x79, 0x79, 0xF6, 0x28, 0x24, 0x11, 0xC8, 0x6D, 0x96, 0x4B, 0x1E, 0xC6, 0x95,
+    0x0D, 0xE3, 0xFB, 0x5C, 0x39, 0xCE, 0xB4, 0x79, 0x4A, 0xA1, 0xF6, 0x35, 0xDD, 0x08, 0x8F, 0xF4,
+    0xD6, 0x05, 0xF3, 0x80, 0x72, 0x35, 0x5E, 0xF0, 0x73, 0xE9, 0x7D, 0x98, 0xB4, 0x6B, 0x68, 0x7C,
+    0xE9, 0xCE, 0x26, 0x60, 0x1D, 0x34, 0x90, 0xE5, 0xFE, 0xD7, 0x4A, 0x42, 0x5A, 0x11, 0xD0, 0x8A,
+    0x3B, 0x52, 0xC2, 0xF8, 0xB9, 0xD8, 0x49, 0x58, 0xBF, 0x92, 0x81, 0x5C, 0xD9, 0xA2, 0xBC, 0x27,
+    0x67, 0x8C, 0x09, 0x06, 0x4D, 0x8E, 0x87, 0xF1, 0xD4, 0x16, 0x1F, 0xAC, 0xE0, 0xEA, 0x0F, 0xCE,
+    0xE6, 0xD6, 0x86, 0x50, 0xD3, 0x67, 0x87, 0xBE, 0x56, 0xAA, 0x75, 0x19, 0xA9, 0x7B, 0x55, 0xFB,
+    0x74, 0x2E, 0x2A, 0xA3, 0xF8, 0xA1, 0x46, 0xFE, 0x66, 0x92, 0x0C, 0x4C, 0xC0, 0xB3, 0x21, 0x7F,
+    0x86, 0xB7, 0x02, 0xD8, 0x82, 0xBC, 0xFB, 0x32, 0x54, 0x15, 0x66, 0xF2, 0x11, 0xC1, 0x96, 0xFE,
+    0x6B, 0x90, 0x7E, 0xE6, 0x5D, 0x4B, 0x98, 0x0D, 0x0C, 0x54, 0x02, 0x11, 0xB5, 0x59, 0x07, 0xE1,
+    0x77, 0xD6, 0x83, 0x5B, 0x02, 0x07, 0x7A, 0x36, 0x01, 0xF4, 0xDD, 0xB6, 0x56, 0x70, 0x60, 0x93,
+    0x81, 0x67, 0xE6, 0xDC, 0xFC, 0x13, 0x2A, 0x8A, 0x79, 0x0A, 0x16, 0x61, 0x25, 0x42, 0x17, 0xD0,
+    0x78, 0x7B, 0x57, 0x43, 0x4D, 0x0F, 0x3E, 0x4F, 0x90, 0x0D, 0xA1, 0x01, 0x46, 0xF0, 0x00, 0x76,
+    0x5A, 0xDA, 0x47, 0x9A, 0x89, 0x75, 0xD3, 0x07, 0x35, 0x99, 0xEA, 0xBD, 0xC6, 0xA4, 0xC2, 0xD3,
+    0x4F, 0x3F, 0xF0, 0xB3, 0x56, 0x5D, 0xF9, 0x70, 0x04, 0xC3, 0xA6, 0x5A, 0x6C, 0xF1, 0xC7, 0x50,
+    0x44, 0x1F, 0x81, 0x26, 0x53, 0xE8, 0xBB, 0xD2, 0x5F, 0x68, 0xEE, 0xA4, 0xD5, 0xA2, 0x46, 0xA0,
+    0x7A, 0x4B, 0x36, 0x4C, 0x6C, 0x06, 0x4D, 0xC3, 0x21, 0xCD, 0x76, 0x15, 0x73, 0x35, 0x01, 0x2F,
+    0xC7, 0x29, 0x18, 0x4D, 0x1D, 0x7E, 0x70, 0x97, 0x84, 0x8A, 0x74, 0x77, 0x59, 0x91, 0x76, 0x9B,
+    0x0C, 0xCC, 0xB3, 0x57, 0x91, 0x16, 0xD6, 0xDD, 0x79, 0x35, 0xF1, 0x9A, 0x32, 0x7C, 0xFF, 0x9C,
+    0x61, 0x15, 0xC4, 0x91, 0x30, 0xA6, 0x32, 0xD3, 0x30, 0x17, 0xCF, 0x7B, 0x19, 0x94, 0xE9, 0xDC,
+    0xC8, 0xCB, 0xD3, 0x58, 0xBB, 0x16, 0x12, 0x6D, 0xA3, 0x2D, 0x6E, 0xF8, 0x06, 0xC9, 0x79, 0x71,
+    0x23, 0x16, 0xE7, 0x29, 0xF1, 0x2E, 0x89, 0xFF, 0x53, 0xFE, 0xC7, 0x30, 0xB5, 0x29, 0x49, 0xEC,
+    0xAB, 0x4A, 0x44, 0xAA, 0x33, 0xE6, 0x55, 0x89, 0xA1, 0x99, 0x5F, 0x0C, 0xD3, 0x3D, 0x7D, 0xFF,
+    0x27, 0xD7, 0x97, 0x9E, 0x1C, 0x69, 0x38, 0x52, 0x2A, 0x5D, 0x10, 0xDC, 0x25, 0xC6, 0x94, 0x8B,
+    0xBA, 0xF3, 0xA2, 0xE6, 0x9C, 0xE2, 0xA0, 0xCA, 0x5A, 0xD9, 0x27, 0x92, 0x1B, 0x1B, 0x5C, 0x9B,
+    0x3C, 0xD6, 0x73, 0x6E, 0x1C, 0x4F, 0x19, 0x5A, 0x60, 0x89, 0x2D, 0x9A, 0x5E, 0xA6, 0x5D, 0xE9,
+    0xE5, 0x92, 0x61, 0x07, 0x39, 0x39, 0x16, 0x13, 0x0E, 0xE6, 0xE5, 0x2D, 0x38, 0x17, 0xCC, 0x27,
+    0x65, 0x5A, 0x74, 0x30, 0xE5, 0x12, 0xAD, 0x96, 0x68, 0xB1, 0x84, 0xE9, 0xCC, 0x3C, 0x3C, 0x3D,
+    0x39, 0x53, 0x72, 0xBB, 0xEB, 0x35, 0xE6, 0x1B, 0x49, 0x97, 0x11, 0xDD, 0x4C, 0x08, 0x6D, 0x78,
+    0x0D, 0x12, 0xE8, 0xB7, 0x9E, 0xE3, 0x2A, 0x5E, 0x2A, 0x8E, 0x8A, 0xFB, 0x63, 0x58, 0xE3, 0x8F,
+    0xCE, 0xA6, 0x5E, 0x0D, 0xF2, 0x16, 0xDE, 0x7E, 0x5E, 0x4A, 0x56, 0xF3, 0x52, 0x9B, 0xD1, 0xEE,
+    0x58, 0x9E, 0xCA, 0x1F, 0xCD, 0x17, 0x12, 0xAB, 0xD7, 0x69, 0xCE, 0x18, 0xBB, 0xD8, 0xF9, 0x1E,
+    0xC9, 0xCF, 0x73, 0xD2, 0x2F, 0xB0, 0x7E, 0x01, 0xE8, 0x9C, 0x5B, 0x7C, 0xEB, 0x78, 0xEB, 0x41,
+    0xFF, 0x16, 0x2C, 0xEF, 0x23, 0x01, 0xBE, 0x2F, 0x75, 0x13, 0x6B, 0xD2, 0x4A, 0x93, 0x8C, 0x95,
+    0x66, 0xD9, 0x98, 0xCC, 0x4B, 0x1C, 0x1D, 0xBD, 0x62, 0x88, 0x08, 0x08, 0x5A, 0x11, 0x5C, 0x43,
+    0x9D, 0xB5, 0x9D, 0xD0, 0x93, 0x6C, 0xB0, 0xE6, 0xD0, 0xBD, 0x9E, 0xF4, 0x25, 0xF6, 0x2E, 0x41,
+    0x0D, 0xF6, 0x82, 0x57, 0x52, 0xC4, 0x46, 0x11, 0xB7, 0xA3, 0x1F, 0xFB, 0xF0, 0xC8, 0xBB, 0x5B,
+    0x70, 0x11, 0x25, 0x2A, 0xBD, 0xEB, 0x44, 0x89, 0x59, 0x12, 0xE0, 0x34, 0x67, 0xBA, 0x67, 0xF8,
+    0xAB, 0x06, 0x2A, 0x06, 0x9D, 0xB6, 0xD4, 0x40, 0x71, 0xC0, 0x92, 0x23, 0x46, 0x84, 0x35, 0x73,
+    0xD9, 0xB5, 0x9F, 0xC6, 0xC1, 0x38, 0x94, 0xDE, 0x5A, 0x0C, 0xCB, 0x16, 0xC7, 0x43, 0x59, 0x3B,
+    0xB7, 0x5E, 0xC2, 0xEC, 0x47, 0x39, 0x33, 0xD2, 0x26, 0xAE, 0xE6, 0xDE, 0x3E, 0x7B, 0xF3, 0xA8,
+    0x16, 0x49, 0xFF, 0xE0, 0xD6, 0x5B, 0xD4, 0x32, 0x36, 0x9D, 0x4E, 0x71, 0xA9, 0xC4, 0xBF, 0x3A,
+    0x03, 0x76, 0x5D, 0x1B, 0xF7, 0x2E, 0x45, 0xBF, 0xCE, 0xAE, 0x89, 0x7E, 0x67, 0x34, 0x52, 0xFF,
+    0x1D, 0x0F, 0x7D, 0x00, 0x85, 0xE8, 0x5D, 0x3F, 0x06, 0x19, 0x00, 0x9F, 0x8A, 0x4F, 0xF9, 0x09,
+    0x34, 0x6B, 0x93, 0x06, 0xD7, 0x19, 0x1E, 0x36, 0x35, 0x9F, 0x1D, 0x92, 0xD8, 0x3D, 0xE6, 0x10,
+    0x62, 0x7A, 0xA0, 0xC3, 0x1E, 0x9D, 0xCF, 0xE1, 0x72, 0x08, 0x6A, 0x08, 0x7C, 0xA4, 0x49, 0x01,
+    0xCA, 0xA4, 0xA1, 0xF7, 0x5B, 0x0B, 0x03, 0x4C, 0x2D, 0x46, 0x46, 0x5A, 0x4D, 0xEE, 0xEB, 0xEE,
+    0x52, 0x5C, 0xC2, 0xEF, 0xEF, 0x6E, 0x6E, 0xA8, 0x98, 0x01, 0xB1, 0xD3, 0xB7, 0x4E, 0xBF, 0x09,
+    0xE0, 0xB8, 0x49, 0x1D, 0x72, 0x8B, 0x49, 0x15, 0x68, 0xB8, 0xC9, 0x71, 0xAA, 0x22, 0x76, 0x52,
+    0x71, 0xEE, 0xDE, 0x66, 0xA4, 0xE5, 0x37, 0xF3, 0x90, 0x73, 0x03, 0x9A, 0x0F, 0x72, 0xDE, 0xE4,
+    0xB0, 0x62, 0x7F, 0x0B, 0xF1, 0x38, 0xC1, 0x75, 0x6A, 0xA6, 0xE1, 0x4C, 0xA4, 0xC4, 0xB0, 0x98,
+    0xF5, 0x09, 0xEE, 0x79, 0xC4, 0xA1, 0x43, 0x2A, 0xF5, 0x34, 0x0D, 0x21, 0xB3, 0xFF, 0x45, 0x2B,
+    0xB6, 0xDB, 0xCE, 0x45, 0x9E, 0x20, 0xB8, 0x4C, 0xC5, 0xF5, 0x71, 0x17, 0xDC, 0x0F, 0x29, 0x69,
+    0x37, 0x4B, 0xE8, 0x9E, 0x52, 0x65, 0x3B, 0xBA, 0x50, 0x63, 0xEF, 0xB6, 0x64, 0xB4, 0x05, 0x09,
+    0xDB, 0x8A, 0xBD, 0x7C, 0x27, 0xF6, 0xB3, 0xB2, 0x07, 0x5F, 0xAF, 0xD3, 0x75, 0x8A, 0x35, 0xA8,
+    0x9F, 0x88, 0xBB, 0xAC, 0xAA, 0xD7, 0x81, 0x5C, 0x42, 0x83, 0x4A, 0xF0, 0x3D, 0x23, 0x9F, 0x83,
+    0xB3, 0xB4, 0x92, 0xA9, 0xDC, 0xF8, 0x20, 0x73, 0x3F, 0xBE, 0x98, 0x79, 0x17, 0x2F, 0x66, 0xC1,
+    0x1B, 0x17, 0xF3, 0x08, 0xB1, 0x5D, 0x8F, 0x01, 0x9C, 0x66, 0xB7, 0x0A, 0xF0, 0x1B, 0x20, 0xDC,
+    0x66, 0xCA, 0xEC, 0x36, 0x73, 0x47, 0xBF, 0x60, 0x5D, 0xF3, 0x22, 0x15, 0xC7, 0x1B, 0x59, 0xF8,
+    0xFD, 0x63, 0x5F, 0xCB, 0xAD, 0x6E, 0x9A, 0xDD, 0xC6, 0x52, 0xE5, 0xAF, 0x4A, 0xE0, 0x53, 0x94,
+    0x3D, 0xEF, 0xED, 0xA2, 0x8C, 0xC3, 0xD7, 0xF3, 0x2A, 0x8E, 0xBC, 0xAC, 0x1A, 0xC2, 0xCF, 0x1C,
+    0x8D, 0xC6, 0x7E, 0x3A, 0xAC, 0x4A, 0xD2, 0x9B, 0x9E, 0xA4, 0xEE, 0x87, 0x97, 0xC3, 0xE1, 0x83,
+    0x69, 0x8E, 0x19, 0x50, 0x30, 0xCB, 0x17, 0xC7, 0x73, 0x22, 0xCD, 0x40, 0xA4, 0x1F, 0x7E, 0x1D,
+    0x11, 0xE5, 0xF7, 0x20, 0x55, 0x88, 0x6F, 0xA4, 0xD7, 0xC3, 0x10, 0x0F, 0xD7, 0x82, 0x24, 0xAE,
+    0xD6, 0x21, 0x29, 0xDD, 0xC6, 0x34, 0x19, 0x30, 0xF9, 0xEC, 0xE7, 0x26, 0xE7, 0xCE, 0x98, 0x44,
+    0xB4, 0x80, 0xE2, 0x6A, 0x4D, 0x85, 0x2A, 0x31, 0xA2, 0x0E, 0xBC, 0x70, 0x7E, 0xCA, 0x52, 0x0C,
+    0xF3, 0x79, 0x15, 0xC3, 0x17, 0xC4, 0x47, 0x20, 0x12, 0x7C, 0x49, 0x26, 0x41, 0x7A, 0x24, 0xD3,
+    0x90, 0x89, 0xB9, 0x9A, 0x7E, 0x82, 0x3C, 0xBB, 0xB9, 0xA9, 0x09, 0xD8, 0x04, 0x0E, 0xCE, 0x05,
+    0x9B, 0x6F, 0xF4, 0x59, 0x1E, 0xF0, 0x3E, 0x62, 0xF9, 0x9A, 0x93, 0x5E, 0xB8, 0x4D, 0x4F, 0x57,
+    0x5D, 0xDD, 0x72, 0x0B, 0xEA, 0x0F, 0xE2, 0x19, 0x52, 0x62, 0xE0, 0x94, 0x40, 0xEC, 0x19, 0x74,
+    0x49, 0x19, 0x35, 0x4D, 0xE5, 0x14, 0x04, 0x93, 0xF3, 0x43, 0xE5, 0x6A, 0x76, 0x83, 0x8A, 0xB7,
+    0xAF, 0xD9, 0xB0, 0x1A, 0xE0, 0x3A, 0xBF, 0x2E, 0xC0, 0x7C, 0x9B, 0x4D, 0x66, 0x4B, 0x56, 0x20,
+    0xE4, 0x85, 0xF3, 0x0C, 0xE6, 0xA1, 0xDF, 0x41, 0x4A, 0xB0, 0x39, 0x69, 0x07, 0xBC, 0x83, 0xB4,
+    0xC2, 0x18, 0xC2, 0x01, 0x92, 0x61, 0x97, 0xB9, 0x98, 0x51, 0x8F, 0xB9, 0x98, 0x6A, 0xEC, 0x62,
+    0x56, 0xD9, 0xD8, 0xDC, 0xDC, 0x74, 0x0B, 0x10, 0xCD, 0xCB, 0xCF, 0x6F, 0x52, 0x6A, 0x69, 0x6B,
+    0x22, 0xB8, 0x83, 0x69, 0xF0, 0x97, 0xA4, 0x28, 0x88, 0xD9, 0xDC, 0xBE, 0x9D, 0x85, 0xDE, 0x7B,
+    0xEF, 0x15, 0x11, 0xCB, 0x04, 0x1D, 0xEC, 0x4B, 0xD9, 0xEB, 0x81, 0x2D, 0xE3, 0x61, 0x90, 0x54,
+    0x71, 0x15, 0x24, 0xC6, 0x01, 0xF2, 0x5E, 0x07, 0x87, 0x7D, 0x98, 0x2A, 0xC7, 0x1C, 0x69, 0xD8,
+    0xC0, 0x90, 0xCB, 0x8E, 0x67, 0xDD, 0x91, 0xD6, 0x2D, 0x21, 0xE3, 0x1E, 0x4F, 0x64, 0x02, 0xBA,
+    0x9C, 0x21, 0xBB, 0x46, 0x89, 0xD1, 0x95, 0x6D, 0xF2, 0x99, 0x4A, 0x61, 0x3B, 0x71, 0x8E, 0xEF,
+    0x82, 0xF8, 0x85, 0x9C, 0x3C, 0x6A, 0x12, 0x63, 0xB5, 0x43, 0x86, 0xAB, 0x31, 0xAD, 0x55, 0x40,
+    0x9F, 0x82, 0x93, 0x15, 0x82, 0xC3, 0x3D, 0xCC, 0x01, 0x46, 0xC0, 0x87, 0x22, 0x7F, 0xCD, 0x44,
+    0x78, 0x60, 0x2F, 0x7A, 0xA9, 0x78, 0xBF, 0xBB, 0x9C, 0x04, 0x61, 0x44, 0x00, 0xA9, 0x3A, 0x02,
+    0xEA, 0x35, 0xA7, 0x64, 0xB0, 0x61, 0x7C, 0xE4, 0x3E, 0xC4, 0x97, 0x1B, 0xED, 0x6C, 0x7E, 0x13,
+    0x6C, 0xD4, 0x91, 0x1D, 0x72, 0x42, 0xC5, 0xF0, 0x14, 0xA4, 0x8A, 0xB9, 0xC9, 0x43, 0x78, 0x8C,
+    0xCC, 0x52, 0xF6, 0x99, 0xA4, 0xEC, 0x31, 0xC1, 0xA7, 0xBE, 0x63, 0xDF, 0x25, 0x17, 0xBC, 0x58,
+    0x9C, 0x90, 0xF0, 0xF6, 0x6D, 0x86, 0xAF, 0xDC, 0xDD, 0x20, 0x6F, 0xF5, 0xBE, 0x49, 0x6C, 0xB7,
+    0xD9, 0xED, 0x55, 0x21, 0xE6, 0x01, 0xA9, 0x9E, 0x01, 0x2B, 0x21, 0xF4, 0x2E, 0x3B, 0xA1, 0x53,
+    0x74, 0x22, 0xB7, 0x58, 0x87, 0xD9, 0x63, 0x6C, 0x15, 0x43, 0x18, 0x71, 0xA5, 0x23, 0x92, 0x78,
+    0x08, 0xFE, 0xE8, 0x87, 0x41, 0xD6, 0xBD, 0x3E, 0x51, 0xD3, 0x3C, 0x8F, 0xAD, 0xF6, 0x27, 0x79,
+    0x6D, 0x25, 0x21, 0x15, 0x55, 0x8C, 0xB2, 0x0B, 0x85, 0xE3, 0xB1, 0xAA, 0x05, 0x02, 0x77, 0x8D,
+    0xAB, 0x42, 0x8F, 0xCA, 0xD4, 0x1D, 0x99, 0x38, 0x35, 0x43, 0x4C, 0x07, 0x2C, 0xA6, 0x23, 0xD6,
+    0x23, 0x7D, 0xFA, 0x34, 0x54, 0x5D, 0x7A, 0x2E, 0x61, 0x06, 0x6C, 0xFC, 0x19, 0xDD, 0xCC, 0xC9,
+    0x5C, 0xF1, 0xD3, 0x37, 0xAD, 0x82, 0x2B, 0xE3, 0x28, 0xE9, 0xF4, 0x25, 0x8A, 0x25, 0xDA, 0x6E,
+    0x9A, 0x09, 0xD8, 0x55, 0x3A, 0x95, 0xC4, 0x23, 0x19, 0xC1, 0xF9, 0x86, 0xE7, 0x1F, 0xCC, 0x4C,
+    0x46, 0xD6, 0x99, 0x8E, 0xC4, 0x9F, 0x6E, 0x69, 0xF2, 0xA2, 0xA3, 0x66, 0xCD, 0xB4, 0x68, 0x94,
+    0x9A, 0x3A, 0xA5, 0x31, 0x5D, 0xA7, 0xAD, 0xA7, 0xCD, 0x8F, 0x8C, 0x21, 0x8D, 0x18, 0x1B, 0xEE,
+    0xEC, 0x8D, 0x0F, 0x37, 0x40, 0xAA, 0x1D, 0xD9, 0xD6, 0x20, 0x88, 0xE9, 0x8E, 0x21, 0xB3, 0xEA,
+    0x8C, 0x25, 0x41, 0x59, 0xC6, 0x93, 0x71, 0xCF, 0x14, 0x83, 0xD6, 0x81, 0x74, 0xA7, 0x34, 0x6A,
+    0x2F, 0xB2, 0x49, 0xA3, 0x88, 0x41, 0xCB, 0x2B, 0xA9, 0xB6, 0x2A, 0x39, 0x79, 0x2E, 0x8F, 0x13,
+    0x2E, 0x4D, 0xCE, 0x0F, 0xCD, 0xFA, 0x6B, 0x58, 0x27, 0xF0, 0x13, 0xAB, 0xCA, 0x1F, 0x1E, 0xDE,
+    0xC5, 0x1E, 0x8A, 0xDD, 0x46, 0x31, 0x3B, 0x49, 0x09, 0x2B, 0x4D, 0xEF, 0x05, 0xF7, 0x13, 0xFE,
+    0xC9, 0x06, 0xB7, 0x94, 0xA9, 0x4F, 0xEE, 0xAA, 0x9F, 0x32, 0xBB, 0x82, 0x7F, 0x33, 0x53, 0xF0,
+    0xF5, 0xB2, 0xAE, 0x86, 0x24, 0xE0, 0x25, 0xDD, 0x61, 0xE8, 0x02, 0xDD, 0x64, 0x37, 0xD7, 0xC6,
+    0x96, 0x13, 0xEE, 0x7B, 0x85, 0x6E, 0xB5, 0xF3, 0xF3, 0x4C, 0x77, 0xDB, 0xB9, 0x96, 0x9A, 0x0D,
+    0xBF, 0x2E, 0x66, 0xCF, 0x29, 0x9D, 0xDC, 0xF6, 0xB6, 0x2D, 0xC9, 0x32, 0x98, 0x63, 0x0D, 0x56,
+    0x5B, 0xAA, 0x0B, 0x53, 0x0B, 0xB1, 0x7D, 0xBB, 0x36, 0x4C, 0x42, 0xF0, 0xC8, 0x28, 0x80, 0x0E,
+    0xCC, 0x42, 0xE0, 0xA2, 0xA4, 0x4F, 0xD8, 0xFA, 0x26, 0x13, 0x1E, 0xF3, 0x1F, 0x96, 0x76, 0x60,
+    0xCA, 0x98, 0x2F, 0xED, 0x10, 0xAE, 0x0A, 0xE0, 0x7D, 0xCC, 0xC2, 0x40, 0x4C, 0xA8, 0xF0, 0x36,
+    0x81, 0x02, 0x43, 0x11, 0x26, 0x26, 0x53, 0xE9, 0x83, 0xCC, 0xE6, 0x10, 0x55, 0xCB, 0xF0, 0x58,
+    0x70, 0x0C, 0x34, 0x16, 0x18, 0x03, 0x8B, 0xA8, 0xD3, 0x3F, 0xD0, 0x0A, 0xD3, 0x29, 0xD1, 0x3E,
+    0x2C, 0xD9, 0x3D, 0x71, 0x81, 0xC4, 0xEC, 0x92, 0x92, 0x74, 0x62, 0xF1, 0x1C, 0x63, 0xB7, 0xB4,
+    0x2F, 0xC6, 0x0E, 0xE8, 0xC0, 0xE8, 0x50, 0x73, 0x11, 0xA6, 0x76, 0xC4, 0x1C, 0x32, 0xC4, 0xA3,
+    0xCB, 0x88, 0x20, 0xFC, 0xE1, 0x77, 0x4A, 0xD1, 0xB4, 0x87, 0x96, 0xD1, 0xB5, 0x04, 0x67, 0x4A,
+    0xD3, 0x07, 0x13, 0xDD, 0x4A, 0x07, 0xAB, 0x04, 0xD7, 0x2F, 0x40, 0xBD, 0x31, 0xC9, 0xAB, 0x45,
+    0x9A, 0x64, 0x64, 0x2E, 0x96, 0x9D, 0x35, 0xE3, 0xCA, 0x54, 0xF4, 0xF0, 0xF3, 0xAC, 0xA2, 0x6B,
+    0x9C, 0x6C, 0x6A, 0x50, 0x26, 0xCE, 0xF8, 0x81, 0xC1, 0xE2, 0x27, 0xC4, 0x48, 0xAB, 0x52, 0x4F,
+    0x0D, 0xE7, 0x3A, 0x44, 0xE4, 0x79, 0x1D, 0xDF, 0x9C, 0x73, 0x4B, 0xB0, 0x7B, 0x90, 0xA1, 0xE9,
+    0x2C, 0x00, 0x3C, 0xF5, 0xA7, 0x5C, 0xAF, 0x60, 0x25, 0xDF, 0xD1, 0x22, 0x1D, 0x74, 0x18, 0x41,
+    0x2B, 0xD5, 0x09, 0x2D, 0xBB, 0x4A, 0xAF, 0xBE, 0x8E, 0x3D, 0x6D, 0x0F, 0xEC, 0x69, 0x49, 0x8B,
+    0x25, 0x24, 0x16, 0x94, 0x22, 0xD0, 0x83, 0x3E, 0x3C, 0x77, 0xA9, 0xC7, 0xE4, 0x74, 0x32, 0x01,
+    0xB1, 0xC3, 0xDB, 0xB4, 0x94, 0x6E, 0xF3, 0xC6, 0x52, 0xED, 0x6E, 0x9B, 0xFF, 0xBD, 0x85, 0x55,
+    0xDD, 0xB7, 0xBB, 0x2D, 0xD9, 0x3D, 0x0E, 0x2A, 0x01, 0x9F, 0x5A, 0x28, 0x0B, 0x44, 0xE6, 0xCD,
+    0x3B, 0x4D, 0x1A, 0x5C, 0x49, 0xFE, 0x2E, 0x8F, 0x58, 0x43, 0xEF, 0xB3, 0x2A, 0xA1, 0xCD, 0x14,
+    0x63, 0x02, 0x30, 0x92, 0x37, 0xDD, 0xA2, 0x62, 0x59, 0xB1, 0xA6, 0xE1, 0x19, 0x31, 0x34, 0x80,
+    0x3D, 0xED, 0xC2, 0xC7, 0x98, 0xC1, 0x98, 0xEF, 0x4E, 0xCA, 0x3D, 0xD5, 0x42, 0x2D, 0x9E, 0x8B,
+    0x64, 0x6F, 0x67, 0x7B, 0xDE, 0xFE, 0xED, 0xFB, 0xBF, 0x72, 0xE8, 0xF4, 0x69, 0xBC, 0x73, 0xEC,
+    0xEB, 0xD8, 0x9B, 0xA7, 0x9E, 0x7A, 0xAC, 0x3E, 0x71, 0x9B, 0xC1, 0x67, 0xF1, 0x69, 0x26, 0x9F,
+    0x63, 0x0D, 0xC7, 0xCF, 0x6D, 0x73, 0x90, 0x98, 0x92, 0x70, 0x4F, 0xF6, 0x1A, 0x81, 0x9E, 0x2D,
+    0x13, 0xEB, 0x5E, 0xD0, 0x92, 0xD2, 0x99, 0x6D, 0x6C, 0x81, 0x67, 0xB9, 0x17, 0x25, 0xB2, 0xD7,
+    0x67, 0x4F, 0x51, 0x38, 0x2F, 0x7F, 0x03, 0xEF, 0xF7, 0xF7, 0x36, 0xEE, 0x99, 0x7C, 0x0B, 0xFE,
+    0x1C, 0xFC, 0x12, 0x8C, 0xA5, 0x9F, 0xC5, 0x7B, 0x3A, 0x02, 0xCD, 0xF6, 0xC2, 0x96, 0x9E, 0xC2,
+    0xFB, 0x53, 0x68, 0xC4, 0x2E, 0xCD, 0x3A, 0x4B, 0x24, 0x0D, 0xD5, 0x51, 0xF6, 0x25, 0x7C, 0xB4,
+    0xCD, 0x9E, 0x16, 0xE6, 0x10, 0xC0, 0x21, 0xDE, 0x75, 0x18, 0x91, 0xD7, 0x72, 0x5D, 0xFE, 0xD0,
+    0x7C, 0x1F, 0xF3, 0x57, 0xCF, 0xE4, 0xB3, 0xD3, 0xC9, 0x37, 0xEC, 0xAE, 0xA6, 0x93, 0x7F, 0xCA,
+    0xDE, 0x92, 0xF4, 0xE9, 0xF1, 0xB9, 0x2F, 0x7D, 0xEA, 0x99, 0xDE, 0x73, 0xCF, 0xF3, 0xFD, 0xE8,
+    0xB2, 0xF4, 0x9B, 0x53, 0xE7, 0x88, 0xBB, 0x7C, 0xC6, 0x3E, 0x37, 0xB1, 0xFB, 0x9E, 0x9F, 0xB3,
+    0xB1, 0xEF, 0xD3, 0xAD, 0x84, 0x1F, 0xB0, 0x3E, 0xDB, 0xA0, 0x10, 0xE7, 0x47, 0x78, 0x64, 0xE7,
+    0x5B, 0x88, 0x0A, 0x36, 0xDA, 0x3B, 0xEE, 0xF9, 0x13, 0x29, 0x8F, 0x35, 0xC9, 0x1F, 0x31, 0x1A,
+    0x71, 0xFF, 0x29, 0xFB, 0x1C, 0x11, 0x74, 0x25, 0xBD, 0xEF, 0x83, 0x27, 0xAD, 0xE8, 0xB3, 0x09,
+    0xE4, 0x6F, 0x20, 0x22, 0x29, 0xF4, 0xCB, 0xA9, 0x2F, 0x2D, 0xDF, 0xD1, 0xB5, 0xE9, 0x9D, 0x36,
+    0xB8, 0xC8, 0xBE, 0xB5, 0x77, 0x06, 0xDB, 0xCE, 0x62, 0x5B, 0xF7, 0x9E, 0x97, 0x45, 0xE6, 0xEE,
+    0x5B, 0x26, 0x01, 0xB1, 0x25, 0xDF, 0xA4, 0x4C, 0xF1, 0xAD, 0x89, 0x6E, 0x1D, 0x8B, 0x51, 0x24,
+    0xE5, 0xBD, 0xA1, 0x63, 0x29, 0x1C, 0x5C, 0xC3, 0xC4, 0x2A, 0xB4, 0xB9, 0x73, 0x4A, 0x85, 0xF1,
+    0x9E, 0x4F, 0xB8, 0xB8, 0xCE, 0x19, 0x74, 0xE8, 0xF4, 0xAA, 0x67, 0xE1, 0xB0, 0xB3, 0xF2, 0x79,
+    0x03, 0xD2, 0xEF, 0x2C, 0x72, 0x8A, 0xF2, 0x6D, 0xF3, 0xCF, 0x02, 0x97, 0x90, 0x9F, 0x04, 0x10,
+    0x20, 0x44, 0x6C, 0x24, 0xE6, 0x69, 0x8B, 0x36, 0x26, 0x08, 0x19, 0x04, 0x20, 0x12, 0xC8, 0xA5,
+    0x61, 0xFB, 0x15, 0x07, 0xFF, 0xA7, 0x4C, 0x50, 0x74, 0xA8, 0x65, 0xA9, 0x7F, 0x28, 0xB7, 0x0E,
+    0x54, 0x02, 0x4C, 0xD6, 0x16, 0xCC, 0x28, 0xBC, 0xC9, 0x75, 0xD6, 0x37, 0x20, 0x19, 0xB0, 0x54,
+    0xA5, 0xC3, 0x0C, 0x0A, 0xE6, 0xD9, 0x4E, 0x31, 0xC5, 0x05, 0x3A, 0x7C, 0x70, 0x6A, 0xA6, 0xF3,
+    0x7A, 0x6F, 0xD9, 0xEA, 0x7E, 0xD5, 0x76, 0x87, 0xB0, 0x6E, 0x09, 0x63, 0xCB, 0x76, 0x9D, 0x09,
+    0xDD, 0xD0, 0xCB, 0xCB, 0x39, 0x82, 0x74, 0x11, 0x3E, 0x46, 0x9A, 0x7C, 0x6F, 0xF3, 0x15, 0xA6,
+    0x61, 0xD4, 0x84, 0xDA, 0x63, 0x0D, 0xB5, 0x27, 0x08, 0xB5, 0x69, 0x44, 0x9E, 0xB3, 0x48, 0x6F,
+    0x59, 0x0F, 0xF6, 0x94, 0x76, 0xB6, 0x16, 0x72, 0xE4, 0x56, 0x3A, 0x68, 0xB2, 0xDF, 0x7D, 0xBF,
+    0x4D, 0x03, 0xFD, 0x17, 0xD6, 0x24, 0xC3, 0x33, 0x75, 0x24, 0xE3, 0x0E, 0xC2, 0x0D, 0xE9, 0xC5,
+    0x7C, 0x8D, 0x87, 0x07, 0x2B, 0x04, 0x90, 0xCD, 0x4D, 0xED, 0x84, 0xCD, 0x4D, 0x9D, 0x3F, 0xE9,
+    0x5E, 0x5D, 0xD1, 0x09, 0x3B, 0x68, 0x30, 0x61, 0x39, 0x74, 0xA0, 0x30, 0x76, 0xB6, 0xDA, 0x64,
+    0x68, 0x68, 0x32, 0x7C, 0xCD, 0x65, 0xEA, 0x3D, 0xCC, 0x11, 0xC1, 0x9A, 0xB2, 0x37, 0xD4, 0xB3,
+    0x1D, 0xA2, 0x3E, 0xC2, 0xAE, 0x4B, 0x69, 0xF8, 0x62, 0xA3, 0x15, 0x53, 0x3A, 0xB1, 0x1D, 0xAD,
+    0xB3, 0x7F, 0x6E, 0xB5, 0x77, 0xF8, 0x34, 0x38, 0xE0, 0x1F, 0xDA, 0xFA, 0x88, 0xB0, 0x3E, 0x42,
+    0xEA, 0x96, 0xEE, 0x9E, 0xFA, 0xC8, 0x4B, 0x79, 0x70, 0xF1, 0xDD, 0x2C, 0xFC, 0x59, 0xA3, 0xF5,
+    0x91, 0x30, 0x9A, 0xDA, 0xB4, 0xC4, 0xE1, 0x3D, 0x0A, 0x67, 0xCB, 0xA6, 0x4F, 0x16, 0x29, 0x08,
+    0x5C, 0x70, 0x80, 0x01, 0x67, 0x72, 0xD7, 0xBE, 0xBE, 0x64, 0x75, 0xFF, 0xCB, 0x9D, 0x5E, 0xEC,
+    0x53, 0x8B, 0x4C, 0xDA, 0xE6, 0xC8, 0x6D, 0x2A, 0xEF, 0xFD, 0x0D, 0x93, 0x71, 0xF3, 0x53, 0x26,
+    0x58, 0xEF, 0xEC, 0x3D, 0x8E, 0xD5, 0x57, 0x2A, 0xB4, 0x3B, 0x6F, 0xB4, 0xBA, 0xC3, 0xA5, 0xAB,
+    0xAD, 0x97, 0xD9, 0x7D, 0x3B, 0x0D, 0x65, 0xF3, 0xA8, 0xDB, 0xD4, 0xDE, 0x95, 0x8D, 0x79, 0x8E,
+    0xEF, 0xF8, 0xFF, 0x65, 0x5A, 0x6E, 0xC5, 0x8A, 0x06, 0xDF, 0x74, 0x15, 0xBE, 0x6C, 0xC8, 0x0D,
+    0x67, 0x4C, 0xBF, 0x95, 0x08, 0x14, 0xA7, 0x78, 0xAE, 0xAF, 0x85, 0x5D, 0xDA, 0x58, 0x5A, 0xDB,
+    0xA1, 0x76, 0x89, 0xD1, 0x0F, 0x68, 0x3B, 0x7C, 0x4E, 0x98, 0x04, 0x91, 0x0F, 0xF3, 0x03, 0x25,
+    0x37, 0x68, 0x2B, 0xAF, 0x7B, 0xA1, 0x21, 0xFE, 0xBF, 0x64, 0x11, 0x34, 0x7C, 0x19, 0x26, 0x1D,
+    0xE1, 0x28, 0xC2, 0x52, 0x88, 0x0F, 0x5F, 0x44, 0x1A, 0xF8, 0xC2, 0xF4, 0x07, 0x59, 0x84, 0xCD,
+    0xAB, 0xAD, 0x2A, 0x89, 0xED, 0xBA, 0x35, 0x7D, 0x5D, 0xFD, 0x74, 0xC4, 0xB8, 0x29, 0xDF, 0xE9,
+    0xD2, 0x10, 0xD3, 0x08, 0x4B, 0xF5, 0x6B, 0x4A, 0xD1, 0xF9, 0x7F, 0xCD, 0x94, 0x8A, 0x64, 0xB9,
+    0xC9, 0x75, 0x6A, 0x84, 0xDF, 0x5C, 0x62, 0x70, 0x76, 0x91, 0x9D, 0x32, 0xD1, 0xCB, 0x0C, 0x62,
+    0x4F, 0x04, 0x2F, 0x94, 0x6C, 0x89, 0x49, 0x10, 0xBC, 0x16, 0x8A, 0x04, 0xDC, 0xA6, 0x41, 0x3E,
+    0x60, 0x3D, 0x2B, 0x6B, 0xF3, 0x0E, 0xB6, 0x2B, 0xD8, 0x04, 0x41, 0xB6, 0xDB, 0xF0, 0x90, 0xB8,
+    0x6F, 0xC2, 0x1F, 0x7C, 0xCB, 0x9B, 0xC1, 0x15, 0xA9, 0x9D, 0xAE, 0x53, 0x9C, 0x04, 0x6D, 0x5E,
+    0x67, 0x2F, 0x5D, 0x70, 0xF1, 0x1D, 0x1A, 0xB8, 0x8B, 0xAC, 0x01, 0xFB, 0xD7, 0xB4, 0x9D, 0xCE,
+    0x34, 0xC8, 0xBE, 0xF2, 0x0A, 0xC7, 0x90, 0x14, 0xED, 0xEB, 0x38, 0x3E, 0x0C, 0x2A, 0x7F, 0xB1,
+    0x5A, 0x73, 0x6F, 0xA5, 0xDB, 0xD9, 0x3A, 0xDB, 0xDB, 0xE6, 0xF3, 0x87, 0xB2, 0x18, 0xB5, 0xA9,
+    0xB6, 0x35, 0x18, 0x8F, 0xAB, 0xC9, 0xF1, 0xDB, 0xF6, 0x0C, 0x85, 0xE5, 0xFD, 0xA0, 0xD4, 0x64,
+    0xF0, 0x03, 0x54, 0xA4, 0x1D, 0x4C, 0x52, 0x58, 0xE5, 0xD1, 0xCD, 0x54, 0xEF, 0x97, 0xEC, 0x69,
+    0x62, 0xBB, 0x58, 0x90, 0xD1, 0xE1, 0xD1, 0x64, 0x28, 0x68, 0x11, 0x7C, 0x17, 0x5C, 0xF7, 0xF7,
+    0x80, 0x62, 0x6C, 0xAE, 0x88, 0xDD, 0x6E, 0x60, 0xBD, 0x1E, 0x1C, 0x00, 0xB6, 0x87, 0xC6, 0x2E,
+    0x13, 0xA2, 0x35, 0x76, 0x7C, 0x3B, 0xAB, 0x34, 0x95, 0x18, 0xEC, 0x63, 0x65, 0xE0, 0xBE, 0x71,
+    0x00, 0x62, 0x08, 0xAF, 0x27, 0x3F, 0x21, 0xDE, 0xDB, 0x95, 0xF8, 0xEF, 0xE6, 0x98, 0x33, 0x91,
+    0xE0, 0x3C, 0xEE, 0x02, 0x97, 0x85, 0x8C, 0x0C, 0xC8, 0xCE, 0xD8, 0x24, 0x06, 0x3B, 0xB1, 0xC3,
+    0x30, 0xB0, 0x59, 0x21, 0x98, 0x9F, 0xDF, 0x0B, 0xE7, 0x7B, 0x67, 0x11, 0x48, 0x4D, 0x31, 0x9F,
+    0x85, 0x13, 0x24, 0x0C, 0x61, 0x97, 0xC2, 0x0B, 0x16, 0x4E, 0x30, 0x55, 0x0F, 0x20, 0xC5, 0x03,
+    0xCC, 0xF9, 0xE9, 0x16, 0x4E, 0x36, 0x15, 0x0C, 0x18, 0x0F, 0x24, 0xEE, 0xCF, 0xC2, 0xD4, 0xFB,
+    0xB0, 0x2F, 0xDE, 0x0F, 0x01, 0xD3, 0xA5, 0x15, 0x30, 0xE1, 0xB6, 0x0E, 0x9E, 0xEF, 0xFD, 0x15,
+    0x9E, 0xFF, 0x87, 0xD2, 0xE4, 0x5D, 0xB9, 0x7E, 0xE1, 0x96, 0x47, 0x6E, 0x22, 0x02, 0x9E, 0x75,
+    0xE5, 0x77, 0x7F, 0xB2, 0xA0, 0x53, 0x78, 0xDC, 0xD2, 0x69, 0xB4, 0x8F, 0x4E, 0xD8, 0x5E, 0x43,
+    0xA7, 0xCA, 0xAE, 0xDF, 0x9F, 0xEB, 0x98, 0x00, 0xFB, 0xC9, 0x7A, 0x90, 0x49, 0x6E, 0xDF, 0x49,
+    0x27, 0xFF, 0x7B, 0x4B, 0x30, 0xF5, 0x5B, 0x3A, 0x65, 0xA0, 0x53, 0xA1, 0x29, 0x60, 0xA6, 0xF1,
+    0xB6, 0x6B, 0x10, 0x0A, 0xC1, 0x11, 0x6E, 0x61, 0x31, 0x8E, 0x4D, 0x31, 0x10, 0xBE, 0x2E, 0x27,
+    0xA4, 0x57, 0xFB, 0x31, 0x3D, 0xA2, 0x0F, 0xC9, 0x71, 0xD7, 0xD5, 0xFE, 0x8A, 0x49, 0x9D, 0x81,
+    0xA7, 0xC9, 0xD2, 0x2F, 0xE5, 0xB6, 0xA1, 0x3D, 0x22, 0x76, 0xB6, 0x47, 0xB4, 0xAB, 0x3D, 0xA2,
+    0xA9, 0x3C, 0xBB, 0x29, 0xCF, 0x0C, 0x66, 0x4E, 0xF5, 0xEC, 0x09, 0xF8, 0x3D, 0x31, 0x3C, 0xE6,
+    0x21, 0x3E, 0xDE, 0x82, 0x3E, 0xFB, 0x47, 0xEB, 0xD1, 0xFD, 0x26, 0x17, 0xE7, 0x57, 0xA5, 0x7A,
+    0xCE, 0x6E, 0xDE, 0xD3, 0x84, 0x24, 0x4C, 0x41, 0x76, 0x67, 0x47, 0x19, 0x3F, 0x63, 0xFF, 0x5B,
+    0x66, 0xBC, 0xE3, 0xA1, 0x04, 0xDF, 0xDF, 0x1C, 0x31, 0x57, 0x54, 0x49, 0x78, 0xFA, 0xF4, 0xBE,
+    0xE6, 0xCB, 0xDC, 0x34, 0x5F, 0xEE, 0xE9, 0x57, 0xAB, 0xD9, 0xAA, 0x56, 0xCF, 0x23, 0xAD, 0xB2,
+    0x1D, 0x98, 0xA0, 0x55, 0x4B, 0xB8, 0xC1, 0xA2, 0xCB, 0xDC, 0x76, 0x14, 0x4C, 0x4C, 0xF9, 0x29,
+    0x80, 0x81, 0xFC, 0x86, 0xBC, 0xF4, 0xD4, 0x42, 0xC8, 0x53, 0x0B, 0xDA, 0x04, 0x0B, 0xDD, 0x87,
+    0x48, 0xA3, 0xBB, 0xDC, 0x6D, 0x68, 0x93, 0x35, 0x87, 0xB4, 0xCF, 0xB2, 0xE1, 0xCC, 0x51, 0x63,
+    0x10, 0x30, 0x18, 0x18, 0x14, 0x4C, 0x5B, 0x26, 0xEF, 0xDC, 0x62, 0xBE, 0x75, 0xB3, 0x16, 0x83,
+    0x86, 0xC1, 0xC3, 0x20, 0x62, 0x30, 0x31, 0x5D, 0x77, 0xB6, 0x91, 0xD4, 0x34, 0x69, 0x2A, 0x36,
+    0xA6, 0xFD, 0xCE, 0xB4, 0xDE, 0x11, 0xEE, 0x4D, 0x02, 0xDE, 0xB0, 0x6B, 0xE2, 0xC6, 0x86, 0xF6,
+    0x9D, 0x11, 0x76, 0x21, 0xF0, 0x46, 0xFB, 0x84, 0x3A, 0xF0, 0x19, 0x22, 0xC0, 0x88, 0x68, 0xDE,
+    0xC7, 0xDB, 0x36, 0xE5, 0x0A, 0x53, 0x63, 0xB4, 0xCB, 0x33, 0x31, 0x34, 0x34, 0xF4, 0x33, 0x04,
+    0x34, 0x14, 0x34, 0xDD, 0xB1, 0xA6, 0x3D, 0x96, 0xD3, 0xDC, 0xBE, 0xCC, 0x3D, 0xC2, 0x03, 0xDC,
+    0xA4, 0x6E, 0xCA, 0x5D, 0xF2, 0x75, 0x0B, 0x59, 0x4E, 0xF4, 0x33, 0x86, 0x45, 0x2C, 0xF3, 0xB0,
+    0x03, 0xD5, 0x29, 0x19, 0x2D, 0xB2, 0x8C, 0x1A, 0xAA, 0xCA, 0x6A, 0x03, 0x5C, 0x2D, 0x2B, 0x98,
+    0x70, 0x53, 0x58, 0xE8, 0xF6, 0xAF, 0x6B, 0x3D, 0x69, 0x91, 0xBB, 0xDE, 0xDC, 0xDC, 0x60, 0x26,
+    0xAA, 0x10, 0xEF, 0xCA, 0xD7, 0xE6, 0x1D, 0xC6, 0x1C, 0xD8, 0x61, 0x1C, 0x24, 0xB4, 0x1E, 0x09,
+    0xED, 0x07, 0xD8, 0x90, 0xD9, 0x2B, 0xDA, 0x10, 0xB5, 0x22, 0xEB, 0xEC, 0xE2, 0xEC, 0x71, 0x88,
+    0x4D, 0xB1, 0x65, 0xBE, 0xE7, 0x8C, 0x3F, 0x34, 0xAD, 0x15, 0xD1, 0x34, 0xEC, 0x39, 0x55, 0xD5,
+    0xE6, 0x9A, 0x52, 0xD1, 0x6C, 0x81, 0x57, 0x3A, 0x1B, 0x80, 0x10, 0x82, 0x13, 0x26, 0x83, 0x93,
+    0x6C, 0x8C, 0x62, 0xF0, 0x5B, 0x85, 0x4C, 0x52, 0xDB, 0x54, 0x69, 0x0C, 0xC4, 0xA1, 0xC5, 0x10,
+    0x05, 0x42, 0x9C, 0x4E, 0x20, 0xDC, 0x2F, 0xA6, 0xD2, 0x75, 0x7E, 0xCD, 0x5C, 0x53, 0x33, 0xCF,
+    0x35, 0x99, 0x1A, 0xD9, 0x74, 0x1E, 0x43, 0x6A, 0x67, 0x48, 0x98, 0xB3, 0x72, 0xF8, 0xA7, 0x78,
+    0xAE, 0x91, 0x61, 0xF0, 0x61, 0x3A, 0x82, 0x4D, 0x18, 0x45, 0x7E, 0x56, 0x41, 0x87, 0x55, 0x1D,
+    0x78, 0x91, 0xDD, 0xAE, 0x9C, 0x80, 0x2E, 0xE8, 0x9E, 0x2D, 0xED, 0x39, 0x81, 0x57, 0x1F, 0x4F,
+    0x28, 0x35, 0x9B, 0x61, 0xCF, 0x76, 0x8D, 0x76, 0x0D, 0x6C, 0x84, 0x1B, 0x9A, 0xBC, 0x38, 0x38,
+    0xC9, 0x86, 0x52, 0xFE, 0xBD, 0x43, 0xA9, 0x33, 0x29, 0x03, 0xFC, 0xC2, 0x5A, 0x09, 0x8A, 0xA9,
+    0x9A, 0x00, 0x76, 0xE9, 0x6A, 0x67, 0xF2, 0xC3, 0x76, 0xE9, 0x56, 0xB6, 0xE4, 0x54, 0xCA, 0xA2,
+    0x6C, 0xC2, 0xB6, 0x3F, 0xF2, 0x47, 0xF2, 0x03, 0xE7, 0x2D, 0x71, 0xDF, 0x6D, 0x82, 0x86, 0x0D,
+    0x29, 0x7F, 0x01, 0x25, 0x57, 0x69, 0x43, 0x4A, 0x11, 0xE4, 0xEC, 0xC6, 0xD1, 0xB6, 0x94, 0xB4,
+    0x6D, 0x28, 0x5C, 0x6E, 0x43, 0x58, 0x6E, 0x48, 0x31, 0xBF, 0xFD, 0x94, 0x51, 0x6D, 0xF7, 0x0E,
+    0xB3, 0x1E, 0xCE, 0x8B, 0x72, 0x34, 0x3A, 0x23, 0xAD, 0x88, 0x44, 0xB6, 0x89, 0x6D, 0xA4, 0x15,
+    0x10, 0x16, 0x2A, 0x42, 0x7A, 0xBB, 0xC7, 0x44, 0x95, 0x2A, 0x73, 0xB5, 0x5E, 0xB9, 0x0F, 0x9B,
+    0x74, 0xAF, 0x47, 0xB6, 0x21, 0x07, 0x10, 0x89, 0x8F, 0xE0, 0x3D, 0x23, 0x72, 0x46, 0xDC, 0x8C,
+    0xA8, 0x39, 0x4C, 0x63, 0x78, 0xA1, 0x3D, 0x36, 0x8E, 0xAC, 0x95, 0x3C, 0xF9, 0x16, 0xB2, 0xAA,
+    0xB3, 0xF0, 0xC9, 0xE6, 0xA5, 0x57, 0x6A, 0x81, 0xA8, 0x6D, 0xB0, 0x4B, 0x3A, 0x0A, 0x11, 0x7B,
+    0x01, 0xBC, 0x77, 0x20, 0x11, 0x08, 0xE7, 0x11, 0xF1, 0x6B, 0x50, 0xAA, 0x39, 0x24, 0xCD, 0x1B,
+    0x1B, 0xA7, 0xD1, 0xD9, 0x77, 0x1E, 0x85, 0xE9, 0x2B, 0xCD, 0x5D, 0xA5, 0xDA, 0x2D, 0xA4, 0x9D,
+    0x4B, 0xCC, 0xA4, 0x79, 0x59, 0x0D, 0x43, 0x01, 0x37, 0xEB, 0xC7, 0xB9, 0xB8, 0x98, 0xCF, 0xB9,
+    0x2E, 0x7B, 0xE6, 0x1B, 0x60, 0xAE, 0x2F, 0xDE, 0x4A, 0x17, 0xE7, 0x6D, 0xEC, 0x7C, 0x77, 0x69,
+    0x44, 0x2E, 0xDB, 0x46, 0xE4, 0xEB, 0x7B, 0x1A, 0x91, 0xBD, 0x45, 0x23, 0xF2, 0xFA, 0x5D, 0x1B,
+    0x91, 0xA7, 0x6C, 0x44, 0x9E, 0x4A, 0xEB, 0x8C, 0xEF, 0xEC, 0x55, 0xD4, 0x6F, 0x2E, 0x77, 0xDD,
+    0x64, 0x8B, 0xAE, 0x9B, 0xEA, 0x1E, 0x5D, 0x37, 0x83, 0xAC, 0xAF, 0x9B, 0xBC, 0xDF, 0x3D, 0xFE,
+    0x0C, 0x19, 0xF5, 0xF5, 0x1C, 0x9C, 0xFA, 0xD2, 0xB2, 0x59, 0xD9, 0xD7, 0x29, 0xCF, 0xB4, 0xD6,
+    0xBE, 0x9E, 0xFE, 0x7D, 0x16, 0x65, 0xE9, 0x84, 0x14, 0xF3, 0xCE, 0x3A, 0xB4, 0x0E, 0x5B, 0x67,
+    0x5E, 0x25, 0xD5, 0x18, 0xF3, 0x0B, 0x30, 0x84, 0x1B, 0x1B, 0x93, 0xA6, 0xAC, 0xBE, 0x7A, 0x63,
+    0xC3, 0x46, 0x29, 0x4C, 0x12, 0x99, 0x4E, 0x34, 0x6A, 0x34, 0x5F, 0x9B, 0x56, 0xD8, 0x13, 0xD6,
+    0x05, 0x1F, 0x4F, 0x12, 0xFF, 0xDA, 0x47, 0x70, 0xBE, 0xFC, 0x15, 0x12, 0xE3, 0xA6, 0x20, 0x7D,
+    0x49, 0x9D, 0xCA, 0x58, 0xD4, 0xB6, 0x51, 0xE7, 0xDC, 0xCF, 0x9E, 0xB6, 0x52, 0x9B, 0x6E, 0xB4,
+    0xC1, 0x0B, 0x13, 0x68, 0xB8, 0x46, 0x0E, 0xDE, 0x8C, 0x56, 0x74, 0x30, 0x31, 0xEF, 0x30, 0xD9,
+    0x47, 0x96, 0x35, 0x25, 0x4D, 0xDB, 0x5C, 0xB4, 0xB7, 0x39, 0x69, 0x0C, 0x75, 0xB7, 0xD4, 0x5C,
+    0x94, 0x2C, 0x0B, 0xF3, 0xAE, 0xB9, 0xF6, 0x08, 0xFC, 0x48, 0xB7, 0x6C, 0x25, 0x9C, 0x07, 0x00,
+    0x27, 0x74, 0x5D, 0xEF, 0x30, 0xE0, 0x7C, 0x0E, 0x70, 0xFE, 0xA5, 0x81, 0xD3, 0xDD, 0x05, 0x9C,
+    0x5F, 0x06, 0x9C, 0xDF, 0x06, 0x9C, 0xE7, 0x30, 0xD7, 0xC6, 0x62, 0xAE, 0x3B, 0x60, 0x7A, 0x1E,
+    0x30, 0x7D, 0x19, 0x30, 0xFD, 0x21, 0x60, 0x9A, 0x58, 0x98, 0xB0, 0xED, 0x52, 0x00, 0x1E, 0x1E,
+    0x1D, 0x7A, 0xD1, 0xB2, 0xFF, 0x5D, 0xF4, 0x4D, 0xF0, 0xDA, 0x0F, 0xA8, 0x53, 0x93, 0xF0, 0xE6,
+    0xB1, 0x6C, 0xD1, 0x86, 0xEE, 0xED, 0x69, 0x43, 0x5F, 0x44, 0x34, 0xD1, 0xCA, 0xCE, 0x73, 0xA7,
+    0xF8, 0x53, 0xAD, 0xD0, 0x7A, 0xBF, 0xFC, 0x93, 0xCC, 0xAB, 0x3C, 0xED, 0x23, 0x08, 0x3E, 0x51,
+    0x4F, 0x8A, 0x51, 0x32, 0x33, 0x7B, 0x36, 0xD4, 0xAF, 0x7C, 0x88, 0x7F, 0x0A, 0x55, 0x3E, 0x00,
+    0xAC, 0x5F, 0x18, 0x42, 0x28, 0xB6, 0x6A, 0xD8, 0xA7, 0xAD, 0xCA, 0x99, 0xF0, 0xD8, 0x03, 0x0B,
+    0x47, 0xB7, 0x12, 0x73, 0x76, 0xC8, 0x0C, 0xE5, 0x3C, 0x4B, 0xAC, 0xE2, 0x71, 0x5E, 0x7E, 0x0F,
+    0x72, 0x7A, 0x7B, 0x2A, 0x7A, 0x30, 0x43, 0xDA, 0x0E, 0x5B, 0xF1, 0xD8, 0x54, 0xFC, 0x5E, 0xA9,
+    0x6D, 0x11, 0xB1, 0x94, 0xF1, 0xC8, 0x2F, 0xFA, 0xB7, 0x26, 0x69, 0x84, 0xE8, 0xDD, 0x59, 0x2A,
+    0x62, 0x41, 0x40, 0x13, 0xD9, 0x3E, 0x0B, 0xCF, 0x60, 0xB6, 0xDC, 0x29, 0xFD, 0xE4, 0xE0, 0xDB,
+    0xEB, 0x81, 0xE9, 0x8D, 0x26, 0x9F, 0xF3, 0x90, 0x30, 0x2F, 0x1F, 0x28, 0x56, 0xE7, 0x2B, 0xD1,
+    0x76, 0xAF, 0xED, 0x62, 0x7F, 0x88, 0x3B, 0x5C, 0x71, 0x10, 0xD8, 0xB4, 0xBF, 0x1C, 0xB9, 0x6C,
+    0xBA, 0xEA, 0x9D, 0xC2, 0x24, 0xA4, 0x2B, 0x93, 0x9D, 0xDE, 0x2E, 0x97, 0x73, 0x5A, 0x36, 0x18,
+    0xFB, 0xFF, 0x7A, 0xCC, 0xED, 0xA0, 0x66, 0xC9, 0x03, 0xED, 0x41, 0xF3, 0x18, 0x5B, 0x8A, 0x73,
+    0x61, 0x9E, 0x82, 0x7C, 0x62, 0x7D, 0xCA, 0xF7, 0x8C, 0xEC, 0x18, 0xB1, 0x5C, 0x48, 0x4C, 0x09,
+    0xFE, 0xBF, 0xEE, 0x82, 0x38, 0x2C, 0xD3, 0xB0, 0x40, 0x40, 0x3C, 0x98, 0x9F, 0x46, 0x80, 0x2E,
+    0xEC, 0x9D, 0x0F, 0xD3, 0xC5, 0x11, 0xA0, 0x13, 0x7A, 0x38, 0x25, 0x9A, 0x14, 0xC6, 0x09, 0xD3,
+    0x1A, 0xD3, 0x5D, 0x22, 0x3C, 0x56, 0x9D, 0x19, 0xE1, 0xBC, 0x58, 0x69, 0x67, 0x7A, 0xC7, 0x9A,
+    0xE3, 0xBD, 0x2D, 0x5E, 0x1A, 0xF5, 0xCB, 0x53, 0x3E, 0xBD, 0xEE, 0x4C, 0x82, 0x36, 0xD9, 0xA0,
+    0xA7, 0x34, 0xCD, 0x09, 0xEC, 0x32, 0x60, 0x44, 0x03, 0xFE, 0xD0, 0x22, 0xB1, 0xD6, 0xB6, 0xD9,
+    0xC1, 0xAB, 0x2E, 0xBD, 0xFA, 0xF4, 0xBA, 0xA7, 0x6A, 0xED, 0xB5, 0xB3, 0xDE, 0xB8, 0x8D, 0x43,
+    0xC3, 0x2E, 0x15, 0x99, 0xBA, 0x94, 0xB3, 0x39, 0xC2, 0xCA, 0x26, 0x71, 0x67, 0xAC, 0x6A, 0xC4,
+    0xD2, 0xB6, 0xD5, 0xEA, 0x66, 0x28, 0xE7, 0xD3, 0x95, 0x38, 0xB8, 0xA1, 0x65, 0x26, 0xF7, 0x06,
+    0x70, 0xC8, 0x40, 0xA3, 0xB4, 0xD4, 0xE0, 0x68, 0xCD, 0x96, 0xE1, 0x60, 0xFD, 0x65, 0xC4, 0x8C,
+    0x1E, 0x8F, 0x9D, 0x04, 0x20, 0x73, 0x58, 0x0D, 0x12, 0xFA, 0x3C, 0x4E, 0xAB, 0x9F, 0x52, 0x69,
+    0x53, 0xCB, 0x8F, 0x16, 0x02, 0x15, 0x2B, 0x42, 0xA0, 0xB4, 0x0D, 0x19, 0xD4, 0xD3, 0xE9, 0x8A,
+    0xCD, 0xD3, 0x38, 0xAC, 0x2C, 0x93, 0x25, 0xA2, 0xC5, 0x69, 0x89, 0x07, 0x0E, 0x86, 0xD6, 0x6C,
+    0x1C, 0xD1, 0x9A, 0x19, 0xA8, 0x64, 0x50, 0xCD, 0xC3, 0xDE, 0x79, 0xED, 0xAC, 0x8F, 0x3F, 0xA6,
+    0x9B, 0x12, 0xA1, 0x85, 0x6B, 0x3F, 0x4F, 0x9C, 0x6A, 0xDD, 0xE1, 0xB3, 0x0F, 0x83, 0x46, 0x54,
+    0x2C, 0xC5, 0x74, 0xC9, 0xC2, 0x32, 0x7E, 0x41, 0x1E, 0xD9, 0xEA, 0xB2, 0x82, 0xC0, 0x78, 0x63,
+    0xD9, 0xE0, 0x76, 0x74, 0x6A, 0xF6, 0x67, 0xC1, 0x48, 0x68, 0x92, 0x35, 0x1E, 0xCA, 0x78, 0x24,
+    0xF5, 0xD8, 0xAB, 0x4F, 0x1E, 0xAF, 0xBA, 0x75, 0xE9, 0xBC, 0xD0, 0x6A, 0xAA, 0x6E, 0x46, 0x91,
+    0x5C, 0xF6, 0xC8, 0xDF, 0xD4, 0x93, 0x68, 0xDB, 0xEA, 0x37, 0x35, 0x1C, 0xC1, 0x9B, 0xDE, 0xFF,
+    0xD3, 0xD7, 0x3F, 0x4B, 0x00, 0x22, 0xFD, 0x37, 0x09, 0x41, 0xD9, 0xFF, 0xCC, 0xEA, 0x6C, 0xF8,
+    0x15, 0xD9, 0x02, 0x6D, 0x43, 0x61, 0x10, 0x16, 0x3A, 0x30, 0x95, 0x6B, 0x01, 0x5D, 0xBF, 0xF5,
+    0xE0, 0x95, 0xD7, 0x40, 0x5F, 0xFF, 0x2B, 0xE4, 0x18, 0xFF, 0x7F, 0x62, 0x9D, 0xA1, 0x3F, 0x05,
+    0xF6, 0x5B, 0x5E, 0x05, 0x52, 0xEE, 0x78, 0x25, 0x88, 0x0C, 0xDA, 0x05, 0x4B, 0x07, 0x91, 0x94,
+    0xCE, 0x86, 0xD0, 0xB6, 0x42, 0x69, 0x48, 0x0D, 0x11, 0xAE, 0x65, 0x90, 0x7A, 0x35, 0xBB, 0x64,
+    0xC6, 0x80, 0xC8, 0x1F, 0x3B, 0x1F, 0x89, 0xFF, 0xE7, 0xDE, 0x25, 0x09, 0x9E, 0x0F, 0xBE, 0x2E,
+    0xE1, 0x73, 0xE1, 0x3A, 0x86, 0xE7, 0xC1, 0x2C, 0x87, 0xBF, 0x1C, 0xCB, 0xFA, 0xE1, 0x73, 0x5B,
+    0x12, 0x87, 0x05, 0x87, 0x6C, 0x22, 0x71, 0x90, 0xA8, 0xFF, 0xF4, 0xDC, 0xDC, 0x6B, 0x9A, 0x67,
+    0xC4, 0x69, 0x20, 0x1E, 0x52, 0xA7, 0x97, 0xFA, 0x6D, 0x08, 0xE4, 0x72, 0xED, 0x30, 0x74, 0xE6,
+    0x0C, 0x6E, 0x4E, 0xF4, 0x69, 0x8E, 0x90, 0x03, 0xCF, 0xA7, 0xEB, 0x37, 0x46, 0x68, 0xBB, 0x0C,
+    0x8F, 0xA8, 0x9B, 0x83, 0x75, 0x3C, 0xA4, 0xAE, 0xA7, 0xD4, 0xF5, 0x98, 0xBA, 0x1E, 0x39, 0xE2,
+    0x41, 0x75, 0xAE, 0x52, 0x31, 0x7C, 0xAD, 0xCC, 0x21, 0x50, 0x1E, 0x56, 0x17, 0x3D, 0xAD, 0x2E,
+    0x9F, 0x3F, 0x08, 0xA0, 0xB0, 0x6A, 0x1F, 0xF1, 0x41, 0x60, 0x2D, 0xF2, 0x67, 0x9D, 0xC4, 0x69,
+    0x3E, 0x48, 0xFD, 0x2B, 0x93, 0x84, 0x67, 0x7A, 0xBA, 0xAA, 0x25, 0x99, 0xDC, 0x36, 0x65, 0x53,
+    0x93, 0xD3, 0x59, 0x24, 0xEC, 0x07, 0xE7, 0xCF, 0x49, 0x54, 0x2D, 0x97, 0x0A, 0x63, 0x58, 0xA6,
+    0x61, 0x6F, 0xE9, 0x98, 0xE1, 0xE3, 0x39, 0x5A, 0xAF, 0x53, 0x77, 0xCC, 0xF4, 0xF3, 0x22, 0xE7,
+    0xA3, 0xC0, 0xEA, 0xE8, 0x91, 0x3F, 0x4F, 0xC7, 0xE0, 0x92, 0xAA, 0x1A, 0xD5, 0x35, 0x7D, 0x8D,
+    0xAA, 0x86, 0xEA, 0x16, 0x57, 0xB6, 0x56, 0xBB, 0x99, 0xF0, 0x28, 0x18, 0x95, 0x7B, 0x72, 0xF2,
+    0x74, 0xAA, 0x47, 0x87, 0x68, 0x28, 0xC9, 0x68, 0x37, 0xBF, 0x4A, 0xB7, 0xAD, 0x34, 0x1D, 0x36,
+    0xF4, 0x28, 0x42, 0x4D, 0x4B, 0x47, 0xFA, 0x55, 0x29, 0x3D, 0x1D, 0xE5, 0x0F, 0x9C, 0x43, 0xA9,
+    0xD3, 0x5C, 0x9A, 0x54, 0xFE, 0x95, 0xEB, 0x97, 0xC7, 0x61, 0xB2, 0x9D, 0x0E, 0x79, 0x08, 0x08,
+    0x54, 0xEA, 0xB1, 0xEC, 0xD0, 0x9F, 0xE4, 0x23, 0xD9, 0x9E, 0x69, 0x43, 0xAD, 0x54, 0x54, 0x71,
+    0x35, 0xE3, 0x90, 0x71, 0xB0, 0x2B, 0xC9, 0xE0, 0x7C, 0x73, 0x2D, 0x8F, 0x7E, 0xF6, 0x6E, 0x5B,
+    0x01, 0x5E, 0x07, 0xC3, 0xAC, 0x31, 0xAC, 0x6B, 0x83, 0xE0, 0x7B, 0x67, 0xC3, 0xC3, 0xEF, 0xB3,
+    0x43, 0x8E, 0x2D, 0x4A, 0x6F, 0xDD, 0x35, 0xFB, 0xCF, 0x43, 0xF5, 0x6A, 0x79, 0xF4, 0xEC, 0x0D,
+    0x44, 0xFD, 0xE4, 0xE2, 0xEC, 0x0D, 0x73, 0x00, 0x0E, 0x18, 0xC9, 0xFF, 0x59, 0xAD, 0x5D, 0xB3,
+    0x24, 0x2C, 0xD3, 0x7B, 0x27, 0x27, 0xB9, 0x96, 0x79, 0x6A, 0xEB, 0x21, 0x8D, 0x74, 0xAE, 0x04,
+    0xF1, 0x76, 0x66, 0x7A, 0xAD, 0x96, 0xCE, 0x94, 0x81, 0x04, 0xA9, 0x97, 0x04, 0x85, 0x75, 0xB8,
+    0x2A, 0xEB, 0x59, 0x19, 0x87, 0xF9, 0xD3, 0x67, 0x6A, 0x17, 0x4A, 0xB4, 0x7B, 0xC5, 0x29, 0x4F,
+    0xE2, 0xF3, 0x29, 0x7B, 0xBD, 0xC0, 0xAC, 0xCC, 0xCE, 0x4F, 0xED, 0x21, 0xBB, 0xF9, 0xE9, 0xAA,
+    0x57, 0xF9, 0x55, 0x1E, 0x87, 0x60, 0x5E, 0x69, 0x45, 0xB5, 0x12, 0xF0, 0xE9, 0xB1, 0xD7, 0x4C,
+    0xA3, 0x9F, 0x80, 0x43, 0x58, 0xB7, 0x19, 0xFA, 0xF9, 0x60, 0x92, 0x44, 0xBB, 0x8B, 0xF2, 0xFC,
+    0x1B, 0x80, 0xE6, 0xA5, 0xEC, 0x89, 0x00, 0x63, 0x38, 0x7D, 0xAB, 0x75, 0x93, 0x1F, 0x18, 0x36,
+    0xA3, 0xA3, 0x76, 0x96, 0xFF, 0x91, 0x7F, 0x3F, 0xEE, 0x9B, 0x4D, 0x32, 0xBD, 0x91, 0xCD, 0xC7,
+    0xA5, 0x4E, 0x80, 0x27, 0xE7, 0xBE, 0x69, 0xBA, 0x0D, 0x8A, 0x61, 0x79, 0xC9, 0xC7, 0xF9, 0x6D,
+    0x09, 0xA4, 0xF5, 0x16, 0x5F, 0x0F, 0x7E, 0xAA, 0x8D, 0x4D, 0x75, 0x0E, 0x1B, 0xEB, 0x34, 0x07,
+    0xD8, 0x37, 0x7C, 0xA3, 0x1D, 0xA1, 0x89, 0x71, 0x4D, 0xF8, 0xD1, 0x99, 0xDA, 0xFA, 0x29, 0x7D,
+    0x0B, 0x8F, 0x39, 0x08, 0x9E, 0xC2, 0xF6, 0xCD, 0xCE, 0x2E, 0x1D, 0xF1, 0xDC, 0xDC, 0x4C, 0x54,
+    0xE4, 0x36, 0x8F, 0xD9, 0x2E, 0xED, 0x91, 0x09, 0x49, 0x28, 0xB2, 0x5D, 0x5B, 0xDE, 0x6E, 0xDA,
+    0xAF, 0x1C, 0x1A, 0xAE, 0xC8, 0x95, 0xD5, 0xB2, 0xE1, 0x95, 0xEA, 0x34, 0x9A, 0xD6, 0xD3, 0xC9,
+    0x54, 0x96, 0x5A, 0xC5, 0x9E, 0xDC, 0x37, 0x34, 0x0C, 0xEC, 0x49, 0x8C, 0x87, 0x2A, 0xED, 0x9E,
+    0x5B, 0x74, 0x51, 0x5B, 0x38, 0xD5, 0xFB, 0x8A, 0xF7, 0x1E, 0x7B, 0x7D, 0x62, 0xDF, 0x67, 0x41,
+    0xD2, 0xAD, 0x19, 0x23, 0x32, 0xEF, 0x01, 0x78, 0x64, 0x14, 0x28, 0xBA, 0x1A, 0xD0, 0xDF, 0x91,
+    0x9A, 0xBD, 0x5F, 0x1B, 0x60, 0x6F, 0xD9, 0x91, 0x7F, 0x80, 0x36, 0x40, 0x43, 0xB2, 0x9D, 0xF8,
+    0x8E, 0xAE, 0xC0, 0xBE, 0xE9, 0x0A, 0x1C, 0x4A, 0x34, 0x62, 0x4B, 0x60, 0xFF, 0xCE, 0xAE, 0xC0,
+    0x7F, 0x77, 0x6D, 0x8A, 0x56, 0xE2, 0xA9, 0x9D, 0xBC, 0xB7, 0x8B, 0x87, 0x20, 0xE2, 0xC3, 0x02,
+    0x69, 0x8E, 0xFD, 0xAC, 0x20, 0xE2, 0x27, 0x84, 0x99, 0x3D, 0x87, 0x9D, 0xC5, 0xD7, 0x41, 0x3D,
+    0xE6, 0xF3, 0xDF, 0x70, 0x79, 0xD9, 0x30, 0xBE, 0x50, 0x52, 0x9F, 0xF8, 0x40, 0x96, 0xD6, 0x23,
+    0x02, 0x7B, 0x9C, 0xF3, 0x89, 0x7F, 0x8F, 0x84, 0xA7, 0x07, 0xF9, 0xF3, 0x79, 0xE7, 0x65, 0xEB,
+    0x74, 0x0D, 0xF5, 0x3B, 0x0D, 0x4A, 0x0D, 0x21, 0x63, 0x16, 0x3A, 0xF9, 0xA5, 0x2A, 0x58, 0xE7,
+    0x39, 0x2C, 0xB3, 0x86, 0x55, 0x0E, 0x2F, 0x75, 0x72, 0xB6, 0x81, 0x76, 0x6C, 0xD3, 0xC2, 0xA5,
+    0x6D, 0x71, 0x9B, 0xDB, 0x02, 0x61, 0x4B, 0xD8, 0x12, 0x63, 0xFC, 0x16, 0xBE, 0x1B, 0x83, 0x0C,
+    0xB9, 0xCC, 0x8F, 0x4F, 0x04, 0x37, 0x9E, 0x84, 0x30, 0x4D, 0xAC, 0x4E, 0x41, 0xC6, 0x78, 0x31,
+    0xFD, 0xED, 0x21, 0x68, 0x6A, 0xAB, 0xEC, 0x96, 0xC3, 0xAC, 0xE7, 0xC0, 0xAD, 0xAF, 0x65, 0x4B,
+    0xA8, 0x9A, 0xF8, 0x60, 0x64, 0x0E, 0x93, 0x55, 0xA2, 0xE8, 0x2A, 0xBE, 0x8A, 0xB0, 0x62, 0xAC,
+    0x28, 0x2B, 0xCE, 0x8A, 0xB4, 0x62, 0xAD, 0x68, 0x9B, 0xEE, 0x5C, 0xF5, 0x21, 0xBA, 0xF3, 0xE8,
+    0xA8, 0x6E, 0x53, 0x54, 0x0B, 0xEC, 0xC3, 0x20, 0x91, 0x68, 0xE1, 0x6A, 0x3C, 0xB6, 0xAF, 0xD9,
+    0xB0, 0x92, 0xDD, 0x26, 0xC6, 0xDA, 0x23, 0x9F, 0x0F, 0x73, 0x08, 0xF5, 0xBE, 0x5D, 0x26, 0xF7,
+    0xE9, 0xAA, 0x61, 0xD6, 0xBA, 0x59, 0xD1, 0xEB, 0xF2, 0xFB, 0xAB, 0xBB, 0x4B, 0xEE, 0xE8, 0xAE,
+    0x19, 0x68, 0x10, 0xBD, 0xDC, 0xB0, 0xB4, 0xE8, 0x23, 0x23, 0xF9, 0x54, 0x09, 0x2D, 0x5B, 0xCE,
+    0x27, 0xF5, 0x45, 0x19, 0x0B, 0x51, 0xD4, 0x61, 0xE1, 0x08, 0x3E, 0xBE, 0x33, 0xAA, 0x8F, 0xDA,
+    0x43, 0xC4, 0x3C, 0xC8, 0x20, 0x9B, 0xF7, 0x43, 0xE9, 0x3D, 0x13, 0x4D, 0xE9, 0x0A, 0x8F, 0x86,
+    0x30, 0x56, 0xB9, 0x79, 0x74, 0x1E, 0x77, 0x1F, 0xB9, 0x05, 0xCC, 0xD2, 0x3D, 0x47, 0x09, 0x4B,
+    0x2D, 0xE7, 0x15, 0x4C, 0x6E, 0x79, 0x4A, 0xF7, 0xFE, 0x93, 0x2B, 0x1D, 0xD5, 0xF3, 0x4E, 0xBE,
+    0x79, 0xDA, 0x40, 0x4F, 0xAE, 0x41, 0x78, 0x79, 0x46, 0x8F, 0xC9, 0x4B, 0xED, 0x1B, 0xDE, 0x61,
+    0xE0, 0x5B, 0x69, 0x63, 0xA5, 0x3A, 0x9D, 0xF4, 0x34, 0xB7, 0x4D, 0x04, 0xED, 0xBD, 0xC7, 0x54,
+    0x37, 0xD3, 0xCF, 0x13, 0x04, 0x1C, 0x83, 0xA5, 0x34, 0xCD, 0xBA, 0x81, 0x84, 0x84, 0xFB, 0x04,
+    0xE0, 0x7F, 0xB5, 0x39, 0x4A, 0x3E, 0xC7, 0x22, 0x67, 0x66, 0x6F, 0xDE, 0x1F, 0x7C, 0xFB, 0x15,
+    0x3C, 0x77, 0x83, 0xF2, 0xE0, 0xE4, 0x2A, 0xF6, 0x74, 0xB6, 0x02, 0x4A, 0x7E, 0xA9, 0x57, 0x2C,
+    0xFF, 0x06, 0xC5, 0x99, 0x3F, 0x6C, 0xDC, 0x74, 0x14, 0xC7, 0xBF, 0xBE, 0xBB, 0x9C, 0x45, 0x8F,
+    0xC4, 0x11, 0x4A, 0x87, 0xFE, 0x8B, 0x19, 0x18, 0x5A, 0xA9, 0x39, 0x2F, 0x1D, 0x2A, 0x74, 0x7F,
+    0x8C, 0x90, 0x58, 0x3A, 0x90, 0x01, 0xE6, 0x16, 0x89, 0x11, 0xA9, 0x1D, 0x32, 0xA4, 0x70, 0x6D,
+    0x4C, 0x3B, 0x30, 0x20, 0x50, 0x01, 0xB1, 0x02, 0x43, 0xA7, 0x32, 0x34, 0x42, 0x19, 0x4E, 0x90,
+    0xE8, 0xAC, 0x2E, 0xAC, 0x66, 0x40, 0x0C, 0x2C, 0x46, 0x6D, 0xC4, 0xD0, 0xC5, 0x88, 0xAB, 0x74,
+    0xA8, 0x49, 0x8E, 0xEF, 0x7B, 0x3F, 0xDB, 0xB9, 0xA6, 0x48, 0x28, 0x3D, 0x5F, 0xCE, 0x89, 0x1D,
+    0x9F, 0x63, 0xBF, 0xDF, 0xFB, 0xFC, 0xDE, 0xF3, 0xF7, 0xF7, 0x7E, 0xBF, 0x03, 0x9C, 0x00, 0x70,
+    0x43, 0xA0, 0xCD, 0xFD, 0x27, 0xEE, 0x7F, 0x87, 0x28, 0x3D, 0x8C, 0x50, 0x7E, 0x10, 0xA1, 0x76,
+    0x2B, 0x86, 0x6B, 0xC5, 0x68, 0x59, 0x09, 0x6E, 0xDE, 0x4B, 0x30, 0x1C, 0x26, 0xD6, 0x93, 0x77,
+    0x93, 0x72, 0x84, 0x7E, 0x2D, 0x44, 0xDF, 0xF1, 0xD1, 0xF5, 0x80, 0x6E, 0x13, 0xE8, 0x40, 0x36,
+    0x8B, 0xBB, 0xC3, 0xDD, 0xE5, 0x5E, 0xE1, 0x7E, 0xD2, 0xF2, 0xAD, 0xE1, 0x6F, 0x81, 0xBD, 0xDD,
+    0xF3, 0x1D, 0xBF, 0x0D, 0x8F, 0x3F, 0x4D, 0xD4, 0x79, 0x73, 0x1D, 0x5D, 0x9E, 0x75, 0x79, 0xD6,
+    0xC7, 0x0E, 0xBA, 0xD6, 0x00, 0x9B, 0x76, 0x1F, 0xED, 0xAD, 0x75, 0xB8, 0xFD, 0x44, 0x4D, 0xC1,
+    0x07, 0xD8, 0x0E, 0xCA, 0xA1, 0x31, 0x0B, 0x94, 0xEE, 0x00, 0xD5, 0x01, 0x4F, 0x1A, 0xDC, 0xBB,
+    0xE6, 0xBF, 0xB6, 0xB9, 0xB7, 0x28, 0x06, 0x6B, 0x99, 0x66, 0xB3, 0x26, 0x88, 0x54, 0x8E, 0xB9,
+    0xFB, 0xC6, 0x81, 0x71, 0x58, 0xB8, 0xAD, 0xCA, 0x81, 0x1F, 0xED, 0x87, 0x74, 0x75, 0x51, 0xAE,
+    0xAF, 0x48, 0x23, 0x7E, 0x05, 0x23, 0x08, 0xCA, 0xA0, 0x10, 0x4A, 0x21, 0x18, 0xCA, 0xA1, 0x20,
+    0x4A, 0xA2, 0x28, 0xCA, 0xA2, 0x30, 0x42, 0x03, 0xC1, 0x91, 0xDE, 0xE8, 0x43, 0x80, 0x20, 0x44,
+    0x10, 0x24, 0x64, 0x71, 0x59, 0xD0, 0x0E, 0x2B, 0x7D, 0x19, 0xC1, 0xF9, 0x0B, 0x68, 0xD2, 0x95,
+    0xEF, 0x5E, 0x36, 0x8D, 0x8E, 0x03, 0x75, 0x8C, 0xBB, 0x2D, 0x9D, 0xF3, 0x73, 0x6C, 0x88, 0x04,
+    0x28, 0xE3, 0x29, 0x26, 0x20, 0x33, 0xB4, 0x54, 0x63, 0x13, 0xA5, 0x07, 0x8C, 0xFD, 0xDB, 0x49,
+    0x71, 0xBE, 0x9B, 0xEC, 0x01, 0xAE, 0x49, 0xD2, 0xC6, 0x12, 0x15, 0xFF, 0xA8, 0xA3, 0x62, 0x09,
+    0xD7, 0xBA, 0xFA, 0x50, 0xFA, 0xAA, 0xD8, 0xC8, 0x60, 0x06, 0x74, 0xBB, 0xFD, 0x27, 0x0F, 0xD7,
+    0x7A, 0x19, 0x89, 0x4D, 0x0F, 0x8F, 0x3A, 0xF1, 0xF8, 0xD4, 0x17, 0x21, 0x5E, 0x1F, 0xFA, 0xB8,
+    0x72, 0xC2, 0xBC, 0xC0, 0x4E, 0xA1, 0x41, 0x4C, 0xB1, 0x5C, 0x5E, 0xE8, 0x5C, 0x04, 0xE2, 0xD3,
+    0x85, 0xAA, 0xC1, 0x7F, 0x29, 0x9A, 0xA6, 0x0E, 0x9B, 0x74, 0xFA, 0x14, 0x09, 0xF6, 0x63, 0x7C,
+    0x66, 0x7C, 0x8E, 0xE7, 0x94, 0x0E, 0x27, 0x52, 0xC1, 0xE0, 0xD5, 0x2B, 0x7C, 0xCD, 0xAE, 0xD3,
+    0x17, 0xAF, 0x6F, 0x52, 0xA6, 0x60, 0x3E, 0x09, 0x15, 0x36, 0x80, 0xF9, 0x8F, 0x99, 0x17, 0x73,
+    0x34, 0xB9, 0xC3, 0x70, 0xC7, 0x05, 0xC4, 0xE6, 0x25, 0x79, 0x75, 0xA5, 0xB3, 0x82, 0x89, 0x33,
+    0x48, 0x7C, 0x44, 0xA5, 0x0B, 0x67, 0xC8, 0x5F, 0xD1, 0x0B, 0xFC, 0xCB, 0x58, 0xBC, 0x37, 0x39,
+    0x8E, 0x52, 0x62, 0x9A, 0x01, 0x9B, 0x7B, 0xA5, 0x68, 0x8E, 0x19, 0x49, 0x31, 0x95, 0x83, 0xF5,
+    0x5C, 0x0E, 0x24, 0x26, 0xB8, 0xFE, 0x01, 0x0C, 0x4D, 0x8E, 0x33, 0x69, 0x39, 0xB8, 0x15, 0xE2,
+    0x43, 0xCA, 0xC1, 0x32, 0x33, 0x7C, 0xDE, 0x2A, 0x18, 0x73, 0x9E, 0xC3, 0xC5, 0xCA, 0x99, 0x67,
+    0x0D, 0x4E, 0x50, 0x0A, 0x5E, 0x65, 0x73, 0x17, 0x16, 0x8B, 0xF3, 0xFF, 0xA0, 0x0C, 0x0C, 0x87,
+    0x81, 0xC5, 0xBD, 0x14, 0xEF, 0x5F, 0xB7, 0xB9, 0xD7, 0x48, 0xE4, 0x7C, 0xBD, 0x0C, 0x67, 0x38,
+    0x80, 0x73, 0xEF, 0xAE, 0xBA, 0x53, 0x4F, 0x5F, 0xE4, 0xC6, 0x7E, 0xE9, 0x82, 0xDE, 0x30, 0xA2,
+    0x89, 0x70, 0xDF, 0x76, 0x6A, 0x47, 0xCE, 0x71, 0x92, 0x6E, 0x26, 0xF6, 0x1F, 0x03, 0xC7, 0x5F,
+    0xA5, 0x67, 0x8D, 0x52, 0x72, 0xB3, 0x17, 0xF5, 0xF6, 0xC0, 0xD2, 0xA7, 0xAF, 0xB5, 0x55, 0x07,
+    0x7E, 0xFB, 0xFB, 0xB0, 0x36, 0x0C, 0xCC, 0xC3, 0x6C, 0x9B, 0xBF, 0xE2, 0x95, 0x75, 0x97, 0x99,
+    0xB0, 0xC5, 0x13, 0x06, 0x0E, 0x37, 0xF8, 0xF9, 0x11, 0x3F, 0xA7, 0x8D, 0x14, 0xE5, 0xF0, 0x8C,
+    0xAF, 0xC3, 0xC4, 0x8A, 0xD4, 0x4B, 0x7C, 0x78, 0xCE, 0xF4, 0xEC, 0x61, 0x3C, 0xB6, 0xE8, 0xB3,
+    0xF7, 0x8B, 0x8C, 0x3C, 0x01, 0xAE, 0xD4, 0x8B, 0xF5, 0x4E, 0xD2, 0x76, 0x78, 0x09, 0xA5, 0xC7,
+    0xBB, 0x14, 0x9D, 0x8D, 0x34, 0xEC, 0x3E, 0xE8, 0x1D, 0xE8, 0x1E, 0xB3, 0x7E, 0x55, 0x83, 0x4D,
+    0x0F, 0x41, 0x17, 0x41, 0x1F, 0xC5, 0x49, 0xF1, 0x52, 0xDC, 0x14, 0x3F, 0x41, 0x47, 0x91, 0x7A,
+    0x2A, 0xDB, 0xA2, 0xAA, 0x7D, 0xE9, 0x09, 0x53, 0x72, 0x13, 0x58, 0x9A, 0x33, 0x6D, 0x14, 0x9B,
+    0x02, 0xF3, 0xEC, 0x94, 0x04, 0xD5, 0x4F, 0x02, 0x78, 0xBF, 0xD2, 0x11, 0xBE, 0xAC, 0xC1, 0x6B,
+    0x63, 0xFB, 0x5E, 0xE2, 0x1F, 0x4B, 0x52, 0xEA, 0x07, 0xDE, 0x31, 0x21, 0xDF, 0x2B, 0x9A, 0x6A,
+    0x76, 0x35, 0xB0, 0xAE, 0x46, 0xF4, 0x3B, 0x75, 0xFB, 0x50, 0xD9, 0x00, 0x4B, 0x00, 0xCE, 0x9B,
+    0x5E, 0xEE, 0x87, 0x93, 0xEB, 0x65, 0x26, 0x2E, 0xAA, 0x91, 0x8E, 0xDB, 0xD5, 0x4F, 0x99, 0x81,
+    0x51, 0x61, 0x3D, 0x4D, 0x7D, 0x9E, 0x87, 0xF3, 0x4F, 0x8C, 0xF3, 0x5E, 0xDA, 0xF5, 0x93, 0xEB,
+    0x71, 0xDD, 0xDA, 0x6F, 0xFA, 0x78, 0x3A, 0x04, 0x82, 0xF7, 0x89, 0x44, 0x03, 0x45, 0xB2, 0x64,
+    0x21, 0xB1, 0x29, 0x9C, 0x8B, 0x4C, 0xFE, 0x15, 0xBB, 0x78, 0xFF, 0x0F, 0x0A, 0x9E, 0x68, 0x77,
+    0x08, 0x2F, 0xC6, 0x46, 0x52, 0x0A, 0xCF, 0x62, 0x1C, 0x09, 0x64, 0x19, 0x2B, 0xD3, 0xD0, 0x86,
+    0xDC, 0x45, 0xFB, 0x65, 0x35, 0xDE, 0xEB, 0x63, 0x2D, 0x96, 0xE1, 0xC1, 0x55, 0xE7, 0x9A, 0xFA,
+    0xFF, 0x8E, 0x56, 0x71, 0x5D, 0xB5, 0x98, 0xC8, 0xFB, 0x47, 0x34, 0x79, 0x22, 0xC4, 0xA9, 0x47,
+    0x58, 0x23, 0xFD, 0x3B, 0x84, 0xD6, 0x49, 0x94, 0xA3, 0xB7, 0x99, 0x41, 0x64, 0x79, 0xFF, 0x36,
+    0xE2, 0xDB, 0x81, 0x74, 0x80, 0xE3, 0x1F, 0xB4, 0xDD, 0x78, 0xE1, 0x46, 0x75, 0x78, 0x71, 0xF4,
+    0xB7, 0xA2, 0x43, 0x59, 0x1D, 0x2D, 0x3D, 0x5B, 0xE0, 0x53, 0x7D, 0x24, 0x56, 0x62, 0xC5, 0xA5,
+    0xB8, 0x1C, 0x95, 0x43, 0x3B, 0xAC, 0x05, 0x8E, 0xEF, 0xE8, 0xA8, 0x57, 0xA1, 0xF9, 0x66, 0x5E,
+    0x02, 0xDB, 0xD2, 0x2D, 0xED, 0x21, 0x9B, 0xD8, 0xE5, 0x70, 0x56, 0x4E, 0x68, 0x81, 0x63, 0xA6,
+    0x67, 0xFC, 0x74, 0xC5, 0x76, 0x5D, 0x0E, 0xCD, 0xF4, 0xE0, 0x8A, 0x63, 0x9E, 0x1C, 0x5A, 0xF2,
+    0xF1, 0x06, 0xFF, 0xF0, 0x31, 0x4F, 0xAA, 0x1E, 0x27, 0xAC, 0x45, 0xB0, 0xF7, 0x58, 0x13, 0xA0,
+    0x37, 0xC8, 0xB2, 0x43, 0x9B, 0x51, 0xDD, 0x6E, 0xE5, 0x1F, 0x25, 0x5E, 0xFD, 0xDA, 0xF6, 0xA6,
+    0xEB, 0xB7, 0x5A, 0x70, 0x1B, 0x70, 0x3B, 0x70, 0xBB, 0xA8, 0xF7, 0xD1, 0xEA, 0xA3, 0xD1, 0x45,
+    0xB7, 0x63, 0x25, 0xDE, 0xFD, 0xA8, 0xB6, 0x97, 0x86, 0x9F, 0xD4, 0x92, 0x48, 0x12, 0xFB, 0x63,
+    0x72, 0x38, 0x15, 0xA7, 0x13, 0x70, 0xBD, 0x2C, 0x8E, 0x02, 0xA7, 0x71, 0x34, 0x38, 0x2C, 0xAE,
+    0x6A, 0xB4, 0x7D, 0x51, 0x2A, 0x6D, 0x3B, 0x4A, 0x17, 0x2D, 0x0E, 0xC5, 0x63, 0x66, 0xA9, 0xFA,
+    0x4A, 0xB8, 0x9F, 0xF3, 0xE4, 0x23, 0x29, 0x12, 0xA2, 0x44, 0x42, 0x39, 0x7F, 0x34, 0x0C, 0x3A,
+    0x84, 0xB0, 0xFF, 0xAA, 0xB7, 0x43, 0xB8, 0xDB, 0xCC, 0xB1, 0x75, 0x3A, 0x70, 0x76, 0x44, 0x0C,
+    0x58, 0xF5, 0x6D, 0x6F, 0x82, 0x34, 0xB4, 0x24, 0xC6, 0x5D, 0x66, 0xA2, 0xCB, 0x8C, 0xAA, 0x33,
+    0xA7, 0x5A, 0xDC, 0x1B, 0x3C, 0x67, 0xFD, 0xC3, 0x84, 0x24, 0x16, 0x72, 0x2E, 0x35, 0xA1, 0x93,
+    0x28, 0xDB, 0x0D, 0xA6, 0x41, 0x56, 0xD1, 0x37, 0xA1, 0xFC, 0x56, 0x80, 0xCB, 0x31, 0xA9, 0x52,
+    0xA8, 0x43, 0x46, 0x47, 0xD3, 0xC9, 0x12, 0xED, 0xB1, 0xA5, 0xE0, 0xFC, 0x6C, 0x3A, 0x21, 0x92,
+    0x22, 0xBE, 0x2A, 0x79, 0x12, 0xEB, 0x48, 0xEF, 0xC6, 0xC5, 0x85, 0x09, 0x0B, 0x25, 0x51, 0xE8,
+    0x6F, 0xD8, 0xC8, 0x83, 0x9D, 0xEC, 0xDA, 0x74, 0x02, 0xA6, 0x9B, 0x77, 0x3B, 0xC0, 0x8F, 0x32,
+    0x3E, 0x9D, 0x35, 0xE3, 0x53, 0xA1, 0xAC, 0xFB, 0x70, 0x6B, 0x02, 0x97, 0xC8, 0x40, 0x12, 0x5C,
+    0x9B, 0x9E, 0xF4, 0xC9, 0x54, 0x9A, 0x4D, 0x24, 0xE8, 0x6E, 0x58, 0xD1, 0xF9, 0xF1, 0xC4, 0xD0,
+    0x54, 0x0F, 0xA2, 0x83, 0x32, 0xB6, 0xAA, 0xB4, 0x8B, 0x30, 0x69, 0x9F, 0x0A, 0x5B, 0x53, 0xD8,
+    0x36, 0xC9, 0xB6, 0x97, 0x90, 0xAD, 0xED, 0x17, 0x1D, 0x38, 0x6C, 0x1A, 0x19, 0x16, 0x29, 0x3B,
+    0x86, 0xE3, 0x3A, 0x8E, 0x9F, 0xF4, 0x3B, 0xC4, 0x21, 0x4F, 0x2F, 0x7A, 0xC1, 0x60, 0xE9, 0x14,
+    0x4A, 0x8A, 0x0D, 0x1D, 0x17, 0x31, 0x7B, 0x84, 0x40, 0xCD, 0x74, 0x4A, 0xA8, 0xEB, 0x94, 0x41,
+    0x01, 0x40, 0xFF, 0x37, 0x5C, 0x4D, 0x9C, 0x4A, 0x64, 0x44, 0xC6, 0x2B, 0xCD, 0x0B, 0xCE, 0x70,
+    0x6C, 0x5D, 0x68, 0x2F, 0x80, 0x4C, 0xD6, 0x1C, 0xCB, 0xBB, 0x4C, 0xE0, 0xDA, 0x7D, 0x9A, 0x9F,
+    0x2D, 0x45, 0x47, 0xC3, 0xB3, 0xC0, 0x7A, 0xA7, 0x77, 0x09, 0xD6, 0xE3, 0x3D, 0x06, 0xA8, 0x5B,
+    0x48, 0xCA, 0x4D, 0xDC, 0xE7, 0x4A, 0x9E, 0xCB, 0x9D, 0x6C, 0xEC, 0xE5, 0x36, 0xBE, 0xEF, 0x07,
+    0x16, 0x19, 0x2C, 0x29, 0x1F, 0x99, 0x61, 0xAE, 0x5C, 0xAD, 0xCB, 0xE5, 0x25, 0xD1, 0x85, 0xA6,
+    0xD4, 0x9C, 0x0D, 0x61, 0xE9, 0x98, 0xD2, 0xD4, 0x91, 0x72, 0xD2, 0x95, 0x84, 0xAC, 0xCB, 0xA1,
+    0x29, 0x75, 0x65, 0x53, 0x1E, 0x6C, 0xC8, 0x83, 0x4D, 0xA3, 0x80, 0x1E, 0xD1, 0x9F, 0xEE, 0x32,
+    0x63, 0x45, 0x1C, 0xD3, 0xAE, 0xCF, 0x09, 0x72, 0x8C, 0x19, 0xE6, 0x97, 0xE3, 0xB3, 0xB0, 0x84,
+    0x29, 0x2D, 0x5D, 0xFE, 0xD4, 0x39, 0x07, 0x96, 0x75, 0x92, 0x06, 0x8F, 0x1D, 0xFE, 0xAC, 0x8E,
+    0xAC, 0x91, 0xAC, 0x6D, 0xAD, 0xC3, 0x1B, 0x5D, 0x23, 0x49, 0xA7, 0x05, 0x66, 0xD2, 0x73, 0x0E,
+    0xD9, 0x42, 0x95, 0xAE, 0x42, 0xA8, 0xA6, 0xA9, 0x70, 0x5E, 0xD8, 0xAF, 0x9B, 0x26, 0x4A, 0xA8,
+    0x5F, 0x19, 0xED, 0xA4, 0xF3, 0xCB, 0x67, 0xBF, 0x32, 0x1A, 0x8B, 0x34, 0x5B, 0x6B, 0x4E, 0x52,
+    0xF5, 0x4F, 0x55, 0x26, 0x17, 0x6B, 0x38, 0x81, 0xA0, 0x39, 0xBE, 0xB0, 0xD5, 0xC5, 0x47, 0x6F,
+    0x20, 0x74, 0x9C, 0xA8, 0x29, 0x9E, 0xE1, 0x33, 0x80, 0xE9, 0xF4, 0x42, 0x11, 0x0D, 0xA3, 0x81,
+    0x34, 0x94, 0x06, 0xD3, 0x70, 0x1A, 0x50, 0x43, 0x6A, 0x50, 0x47, 0x59, 0xB3, 0x4D, 0x3B, 0x78,
+    0x90, 0x69, 0x53, 0xD9, 0xD7, 0xC5, 0xC3, 0x72, 0x48, 0xDE, 0x4B, 0x21, 0x81, 0xBF, 0x65, 0x4B,
+    0xCE, 0x8E, 0x1C, 0xEE, 0x28, 0xB3, 0x42, 0xD3, 0xF2, 0x12, 0x14, 0x5B, 0xB9, 0x15, 0x5C, 0xC9,
+    0x15, 0x5D, 0xD9, 0x9F, 0x83, 0x57, 0xEF, 0x8C, 0x06, 0x65, 0x6F, 0x43, 0x26, 0xED, 0x53, 0xC4,
+    0xF7, 0xF2, 0x82, 0x4F, 0x52, 0x91, 0x55, 0xDF, 0x24, 0xF0, 0xCF, 0x21, 0x4F, 0xEC, 0x74, 0x7D,
+    0x4D, 0x53, 0xDB, 0x74, 0xFD, 0x74, 0x73, 0x40, 0x32, 0xDE, 0xA4, 0xBC, 0xE6, 0xBC, 0xBE, 0xD9,
+    0xE5, 0x3C, 0x11, 0xAC, 0xA2, 0x7B, 0x42, 0xBF, 0xA8, 0x2A, 0x0F, 0x04, 0xD9, 0x59, 0x93, 0xCB,
+    0xB3, 0x76, 0x34, 0x45, 0xFA, 0x8A, 0xE8, 0xCE, 0xDA, 0x6D, 0xFE, 0x53, 0x96, 0x47, 0x10, 0xAE,
+    0x4E, 0x26, 0xF9, 0xA7, 0xC2, 0xA6, 0x6A, 0x9D, 0xAE, 0x76, 0x77, 0x30, 0x32, 0xEE, 0x60, 0x02,
+    0x90, 0x7E, 0x9E, 0x36, 0x11, 0x30, 0x52, 0x9B, 0x4A, 0xC3, 0x4B, 0x23, 0xDF, 0xEA, 0x68, 0x61,
+    0x57, 0x0B, 0x3A, 0x3A, 0xCA, 0x35, 0x75, 0x11, 0xBD, 0x4E, 0x2E, 0x97, 0x8F, 0x39, 0xB2, 0x32,
+    0x72, 0x99, 0x9D, 0xB1, 0xC5, 0xD7, 0x63, 0x60, 0xC4, 0x72, 0x74, 0xE5, 0x48, 0xE6, 0x62, 0xBA,
+    0x7A, 0xE4, 0xA7, 0x85, 0x6E, 0xAE, 0x29, 0xDD, 0x54, 0x4F, 0x52, 0x35, 0x59, 0xA6, 0x56, 0x67,
+    0xEB, 0xF3, 0xB2, 0x42, 0x2F, 0x4B, 0x59, 0x0D, 0x5A, 0x69, 0xF0, 0xE9, 0x26, 0x9F, 0x5C, 0x62,
+    0x87, 0x9E, 0xE1, 0xFD, 0x8B, 0x54, 0xA2, 0x39, 0x3E, 0xEF, 0x44, 0xBA, 0x9C, 0xA4, 0x86, 0xBD,
+    0xD4, 0x14, 0xDB, 0x97, 0xF4, 0x5C, 0x0B, 0x8A, 0xF5, 0xB7, 0x92, 0xBE, 0xF4, 0xCD, 0xAC, 0x28,
+    0x18, 0xCB, 0x57, 0x5A, 0x68, 0xD0, 0xD2, 0xA0, 0x49, 0x5F, 0x2B, 0xEA, 0xAB, 0xCC, 0x94, 0x4C,
+    0xB5, 0x99, 0x98, 0x2F, 0xB9, 0x5C, 0x3F, 0xAF, 0x34, 0x8B, 0xE3, 0x38, 0x9E, 0x8A, 0x99, 0xAC,
+    0x16, 0xCB, 0x1D, 0xF5, 0x7D, 0x11, 0x2B, 0xB8, 0xEF, 0xCD, 0xFA, 0xFC, 0x1C, 0x4A, 0xBF, 0x73,
+    0x72, 0xF6, 0xC6, 0x46, 0xC1, 0x1C, 0x14, 0xA3, 0xF2, 0xCE, 0x45, 0xD4, 0xAE, 0x26, 0x98, 0xAD,
+    0x46, 0x93, 0xF0, 0xFF, 0x5F, 0xAD, 0x57, 0x4D, 0x68, 0x24, 0xC7, 0x15, 0xFE, 0xBA, 0x7B, 0xA4,
+    0xF6, 0x6E, 0xA1, 0xE9, 0x39, 0x48, 0x60, 0x88, 0x46, 0xBD, 0x87, 0x3D, 0x08, 0x31, 0xA3, 0xD9,
+    0xC3, 0x1A, 0x74, 0xE8, 0x51, 0x37, 0xEC, 0xC1, 0x87, 0x10, 0xA2, 0x83, 0x37, 0x07, 0x43, 0xC8,
+    0x5E, 0x13, 0x12, 0xAC, 0x83, 0x42, 0x86, 0x30, 0xD2, 0x34, 0xF6, 0x21, 0x87, 0x10, 0xD8, 0x4B,
+    0x6E, 0x09, 0x08, 0xBC, 0x10, 0xB3, 0x27, 0x1D, 0x86, 0x30, 0x04, 0x69, 0xA7, 0xD8, 0x3D, 0xE4,
+    0xB0, 0x01, 0x37, 0xCE, 0x21, 0x07, 0x83, 0xDD, 0x21, 0x4E, 0x20, 0x31, 0xC1, 0x0D, 0x1E, 0x43,
+    0xC7, 0x8C, 0xB6, 0xF3, 0xBD, 0xEA, 0x9E, 0xD1, 0xAC, 0x6C, 0xEF, 0xEA, 0xE0, 0xAA, 0x7E, 0xD5,
+    0x3D, 0xF5, 0xF7, 0xBE, 0x7A, 0xF5, 0xDE, 0x57, 0x35, 0x80, 0x13, 0x21, 0x19, 0x67, 0xC7, 0xC9,
+    0xBB, 0x38, 0x7E, 0x61, 0x96, 0xE4, 0x62, 0x1D, 0x61, 0xBE, 0xBE, 0xE9, 0x6E, 0xE2, 0xC5, 0x19,
+    0x5B, 0xEF, 0x85, 0xF9, 0xDA, 0x5E, 0x59, 0x86, 0x45, 0x81, 0x01, 0x65, 0xEB, 0x21, 0xD3, 0x7B,
+    0xFC, 0x55, 0x14, 0xD3, 0xB5, 0xBB, 0x4C, 0x7B, 0x3D, 0x0F, 0xDF, 0xD6, 0xC3, 0xB4, 0x74, 0xF7,
+    0x8D, 0x4E, 0x31, 0x65, 0xC9, 0xEF, 0x41, 0x91, 0xFF, 0xE4, 0xE1, 0x03, 0x4B, 0x3B, 0x5A, 0x45,
+    0x1E, 0x76, 0x71, 0x88, 0x55, 0x38, 0xA9, 0xAB, 0x55, 0xEC, 0x61, 0x03, 0x01, 0x7B, 0x04, 0x4C,
+    0xAD, 0x66, 0xCD, 0xF9, 0x7B, 0xE6, 0x3E, 0xCE, 0xD4, 0x3B, 0xDA, 0x73, 0xE3, 0x0D, 0x0F, 0x41,
+    0x53, 0x66, 0x0A, 0xBA, 0xCC, 0xED, 0xA0, 0xDD, 0xDA, 0x68, 0xD6, 0x6B, 0x35, 0x0E, 0x97, 0x11,
+    0x7C, 0x76, 0x80, 0x7D, 0x84, 0x45, 0xF6, 0xCB, 0x2F, 0x53, 0xA4, 0x40, 0x02, 0x4B, 0xC3, 0xD6,
+    0x70, 0xF8, 0xC4, 0x50, 0x31, 0xBC, 0x08, 0x44, 0xE2, 0x03, 0x1D, 0xC8, 0x20, 0x6A, 0xA4, 0x24,
+    0x90, 0x0E, 0xD2, 0xC3, 0xFE, 0xC3, 0x43, 0x38, 0x34, 0x84, 0xA5, 0x96, 0x20, 0x1D, 0x89, 0x04,
+    0xD8, 0xA6, 0x74, 0x61, 0xA6, 0x5F, 0xDD, 0x69, 0xC8, 0xEC, 0xD8, 0xFA, 0x23, 0xCD, 0x7D, 0xC2,
+    0xBA, 0x0C, 0xB0, 0x28, 0x76, 0x26, 0xA0, 0x3A, 0x7A, 0x90, 0x8D, 0x99, 0x07, 0xA9, 0x1F, 0xBF,
+    0x42, 0x25, 0x7E, 0xD2, 0xC9, 0xC3, 0xF3, 0xF0, 0x7E, 0x4F, 0x1A, 0xBB, 0x47, 0x87, 0x0D, 0x79,
+    0xD9, 0xE9, 0x91, 0x93, 0x1D, 0x3A, 0x69, 0x03, 0x11, 0xB6, 0xC3, 0xDD, 0x1A, 0x30, 0x9E, 0x1C,
+    0xE3, 0xF8, 0x0A, 0x7B, 0x3B, 0xC8, 0xB1, 0xF9, 0xD2, 0xCC, 0x54, 0x64, 0xB3, 0x7C, 0x1D, 0x2F,
+    0xCA, 0xA6, 0x6F, 0xAA, 0x21, 0xF9, 0x2A, 0x7D, 0xC7, 0x19, 0x6E, 0x49, 0xBE, 0x4A, 0xDF, 0xD2,
+    0x19, 0x73, 0xD4, 0xF9, 0xF2, 0xCF, 0xCA, 0xED, 0xDC, 0xC0, 0x90, 0xAF, 0x5E, 0xDD, 0xA2, 0xCD,
+    0x71, 0x52, 0x17, 0x93, 0x23, 0x6B, 0x1A, 0xC7, 0xC8, 0x5A, 0x6D, 0xF3, 0x0A, 0x7A, 0x8F, 0xF0,
+    0x08, 0xD9, 0xC1, 0xE7, 0x9F, 0xDD, 0x29, 0xE2, 0x3F, 0x7D, 0xFE, 0xF4, 0xCE, 0xD3, 0x77, 0x74,
+    0xE7, 0xD7, 0xDF, 0x77, 0xDE, 0x67, 0xE7, 0x8D, 0xA6, 0xF3, 0x11, 0x5F, 0x41, 0xCB, 0xF9, 0x3D,
+    0x5F, 0x59, 0xE0, 0xFE, 0xD4, 0x89, 0xED, 0x24, 0x50, 0x2D, 0x15, 0xB9, 0x71, 0x50, 0x6F, 0x7B,
+    0xDC, 0xB0, 0xED, 0xBE, 0x7F, 0x48, 0x65, 0xDE, 0x44, 0x4D, 0x70, 0x39, 0x55, 0x68, 0xE6, 0x78,
+    0xE6, 0x88, 0xE6, 0x98, 0xE6, 0xA8, 0xE6, 0xB8, 0xE6, 0xC8, 0xE6, 0xD8, 0x8E, 0x2A, 0x74, 0x6F,
+    0x17, 0xBA, 0xC4, 0xF7, 0xE7, 0x19, 0xC2, 0xF7, 0xED, 0x0A, 0xA3, 0x7C, 0x18, 0x94, 0x1F, 0xCD,
+    0x70, 0x12, 0x70, 0x89, 0xF4, 0x87, 0x6E, 0x85, 0xB5, 0x39, 0x43, 0xEB, 0xFD, 0xAC, 0xC2, 0x4B,
+    0x78, 0xF3, 0x64, 0x65, 0x4E, 0xE2, 0x6A, 0x0F, 0x4D, 0xB6, 0xDD, 0xE0, 0xAF, 0xCC, 0xF9, 0x20,
+    0x75, 0x9F, 0x68, 0x4F, 0x45, 0xCD, 0x3A, 0xA7, 0xC6, 0x8D, 0x9B, 0x52, 0x39, 0x74, 0x3E, 0x60,
+    0x68, 0x3C, 0x91, 0xFA, 0xD7, 0xE3, 0x66, 0x9D, 0xA1, 0xD1, 0x6A, 0xB2, 0x69, 0x15, 0x07, 0x3D,
+    0x7E, 0xAD, 0x2C, 0x1D, 0x0C, 0x7B, 0x3D, 0x46, 0x50, 0xD0, 0x6C, 0xAD, 0xAC, 0x2C, 0x5D, 0x3B,
+    0x18, 0x9E, 0xF4, 0x7A, 0xC3, 0x20, 0xE8, 0xB5, 0x02, 0xD6, 0xB0, 0x6A, 0x7D, 0xE9, 0xDA, 0x2B,
+    0xA2, 0xAC, 0x6E, 0x82, 0xE1, 0x17, 0xC0, 0x3F, 0x62, 0xFB, 0xB1, 0x76, 0x2D, 0xBD, 0x82, 0x64,
+    0x87, 0xC1, 0x13, 0x59, 0x8C, 0x46, 0x1F, 0x7D, 0x4C, 0x28, 0x5D, 0x46, 0x82, 0x07, 0x0B, 0x4B,
+    0x2C, 0xDD, 0x98, 0xCB, 0x49, 0x89, 0x31, 0xF5, 0xE2, 0x2E, 0x2D, 0xD8, 0x28, 0x41, 0x37, 0xE4,
+    0x33, 0x40, 0x8E, 0xCC, 0xC7, 0xD0, 0xD1, 0xAE, 0x66, 0xB0, 0x31, 0x36, 0x18, 0x39, 0x32, 0x05,
+    0x7C, 0x86, 0x59, 0xC3, 0xFD, 0x38, 0x6A, 0x9C, 0x5A, 0xE7, 0xC8, 0x4F, 0x31, 0x45, 0x7E, 0xD3,
+    0xF9, 0x0C, 0xF7, 0xE0, 0xBD, 0x4E, 0x93, 0x77, 0x25, 0x8A, 0x44, 0x11, 0x7B, 0xF9, 0x1C, 0x78,
+    0xCF, 0xD5, 0x5D, 0xE4, 0x56, 0x76, 0x93, 0xF3, 0xDD, 0x83, 0x51, 0x31, 0xF2, 0x62, 0xE4, 0x8C,
+    0xDF, 0x89, 0xCF, 0xC5, 0x77, 0x18, 0x72, 0xDB, 0x8C, 0xDE, 0x2E, 0x07, 0x04, 0x8C, 0xDE, 0x3E,
+    0x5C, 0xDD, 0x23, 0xB2, 0x21, 0x54, 0x94, 0x11, 0xA3, 0x48, 0x3A, 0xB7, 0x67, 0x97, 0x1B, 0x71,
+    0xA4, 0x12, 0x1C, 0x2A, 0x8D, 0x86, 0x65, 0xAA, 0x96, 0x8B, 0xD8, 0x2F, 0xD2, 0x6B, 0x5F, 0x64,
+    0x56, 0x36, 0xE1, 0x63, 0xA7, 0x99, 0xF3, 0xD7, 0xD4, 0xF9, 0x58, 0x3B, 0xCF, 0xE0, 0x4E, 0xE0,
+    0x26, 0x9C, 0x07, 0x6A, 0x36, 0x9E, 0x7C, 0x11, 0x1A, 0xBE, 0x60, 0xB4, 0x6E, 0x3D, 0x7C, 0x40,
+    0xEA, 0x92, 0xDA, 0x5B, 0x80, 0xDE, 0x21, 0x6B, 0x34, 0x69, 0x42, 0xF5, 0xDB, 0x11, 0xAC, 0x71,
+    0x0C, 0xBC, 0x75, 0x1F, 0xCE, 0xBF, 0x4F, 0x59, 0x53, 0xC7, 0x6D, 0x38, 0x8C, 0x5C, 0x3B, 0x9A,
+    0xC3, 0xA0, 0xA5, 0x5B, 0x60, 0x35, 0x6B, 0xAD, 0x92, 0x90, 0x80, 0x15, 0xC3, 0x2B, 0x7D, 0xD0,
+    0x1E, 0xF6, 0x5F, 0xE0, 0x7C, 0x0F, 0xF5, 0x15, 0xAC, 0x5F, 0xC7, 0x6D, 0xB5, 0xE0, 0xB9, 0xAA,
+    0x9C, 0xA2, 0xF2, 0xC8, 0xF2, 0xD5, 0x2D, 0x7D, 0xB9, 0xF3, 0xDF, 0xD2, 0x61, 0xC6, 0x85, 0x79,
+    0x3F, 0x7A, 0x53, 0x4A, 0xFB, 0xC3, 0x72, 0xD8, 0xAF, 0xCC, 0x38, 0xAF, 0x74, 0xE9, 0x9A, 0xD0,
+    0x1C, 0x57, 0x62, 0xA1, 0x57, 0xD2, 0x1A, 0x77, 0x6B, 0x1D, 0x56, 0x74, 0x82, 0xB3, 0x16, 0x1C,
+    0x52, 0xD0, 0x5B, 0xFF, 0xBB, 0x6B, 0x8D, 0xFF, 0xB9, 0x87, 0x82, 0x16, 0x28, 0x26, 0xD6, 0x74,
+    0x0D, 0x2A, 0xDB, 0x53, 0xBF, 0x01, 0xDA, 0x07, 0xE8, 0x50, 0xE9, 0x28, 0x00, 0x43, 0x0D, 0x27,
+    0xDC, 0x50, 0x97, 0x0B, 0x6D, 0xCF, 0xD0, 0x6D, 0x3D, 0x08, 0x27, 0x6B, 0x7B, 0x30, 0xDC, 0x2B,
+    0x9C, 0x68, 0x25, 0x86, 0x4A, 0x0D, 0x4E, 0xE9, 0xD4, 0x2B, 0x69, 0x52, 0x50, 0xC8, 0x42, 0x36,
+    0x4A, 0x26, 0x95, 0x2A, 0x3B, 0x29, 0xA7, 0xF2, 0xAA, 0x2A, 0x13, 0x8C, 0x9D, 0x0C, 0x61, 0x56,
+    0xD9, 0x64, 0x64, 0xEA, 0x32, 0x79, 0x18, 0xA0, 0x76, 0x4A, 0x6E, 0x06, 0x37, 0x88, 0x53, 0x71,
+    0x98, 0x32, 0x54, 0x5E, 0xB2, 0xF9, 0x86, 0x51, 0xC5, 0x71, 0x21, 0x37, 0x3D, 0x4C, 0x30, 0x48,
+    0x0C, 0xE5, 0x97, 0xFD, 0x66, 0xAC, 0xEF, 0x49, 0x3F, 0xF7, 0x1C, 0x6A, 0x3A, 0xB3, 0x79, 0xEF,
+    0xF2, 0xFC, 0x1C, 0x37, 0xD6, 0xD5, 0xBA, 0xC4, 0x43, 0xCE, 0x41, 0x27, 0x19, 0x17, 0xD1, 0x35,
+    0x2B, 0xBB, 0x41, 0xDF, 0xA1, 0x87, 0x3A, 0xF3, 0x32, 0xA3, 0xCB, 0xC9, 0xF9, 0x21, 0x93, 0xD3,
+    0xBD, 0xC0, 0xC7, 0xCA, 0xE5, 0xA1, 0xA3, 0xD1, 0xD6, 0xD4, 0xE6, 0x46, 0xB2, 0xDF, 0x0A, 0x15,
+    0xDD, 0x60, 0xC1, 0x9D, 0x46, 0xE2, 0x51, 0xD6, 0xD4, 0x38, 0xD5, 0xC4, 0xF8, 0x55, 0xE3, 0x42,
+    0xAD, 0x17, 0x51, 0xAB, 0x2F, 0x4A, 0xD9, 0x13, 0x93, 0x8E, 0x14, 0x72, 0x58, 0x65, 0x5D, 0x39,
+    0xB0, 0x38, 0x99, 0x47, 0x7F, 0xA7, 0xBA, 0x91, 0x68, 0x1B, 0x8A, 0xB2, 0x4C, 0x74, 0x65, 0xA2,
+    0x2A, 0x7D, 0x4E, 0x0F, 0x71, 0x86, 0x82, 0x67, 0x17, 0x44, 0x5F, 0x83, 0x35, 0x6B, 0x19, 0xA9,
+    0x22, 0x42, 0x1E, 0x16, 0x09, 0x26, 0xAB, 0x0E, 0x43, 0x99, 0x11, 0x65, 0x4B, 0xE1, 0x88, 0x15,
+    0x38, 0x9F, 0xCB, 0x63, 0x19, 0x7E, 0xC4, 0x05, 0x9E, 0xD1, 0x84, 0x6C, 0x52, 0xF2, 0xED, 0x95,
+    0x56, 0xAC, 0x2F, 0xAE, 0xA5, 0x2B, 0x01, 0x7E, 0x24, 0xCB, 0x3F, 0x64, 0xE6, 0x2A, 0xB8, 0x0E,
+    0x5E, 0x1D, 0x22, 0x5E, 0x27, 0xE2, 0xB5, 0xBB, 0x3F, 0x5A, 0xD8, 0xF0, 0x61, 0x79, 0x54, 0x8A,
+    0x1B, 0xAA, 0x6A, 0xD3, 0xE5, 0x54, 0xED, 0xC3, 0x58, 0x80, 0xC6, 0xE7, 0x95, 0xE0, 0x13, 0xCA,
+    0x33, 0xEC, 0x0F, 0x0A, 0x91, 0x98, 0xA2, 0xBF, 0x46, 0xA2, 0xB2, 0x7D, 0x8A, 0xFD, 0x9F, 0x47,
+    0xD8, 0xDF, 0xC7, 0x4B, 0xC5, 0x24, 0x62, 0x52, 0x45, 0xA1, 0x3B, 0xC5, 0xDF, 0x74, 0x58, 0x3C,
+    0xD1, 0x03, 0xCA, 0xF8, 0x92, 0x48, 0x9D, 0xB4, 0xF9, 0xC5, 0xA7, 0x7A, 0x99, 0x7D, 0xAB, 0x61,
+    0x28, 0x18, 0xEF, 0x5F, 0x10, 0x57, 0xCA, 0x9B, 0x01, 0x25, 0xA2, 0xC4, 0x97, 0x44, 0xEA, 0xF0,
+    0x65, 0x71, 0xCE, 0xBE, 0x0B, 0x3B, 0xC0, 0x4D, 0x31, 0x3E, 0xCF, 0x7D, 0xD9, 0xAD, 0x57, 0xC1,
+    0x4A, 0x6F, 0xC2, 0xE0, 0x4D, 0x58, 0x9F, 0xB2, 0xFA, 0x49, 0x6C, 0xA2, 0xD3, 0x92, 0x40, 0x90,
+    0xB8, 0x8D, 0xDD, 0x54, 0x25, 0x0B, 0x84, 0x51, 0x9E, 0x52, 0xF3, 0xDC, 0x12, 0x3F, 0x11, 0x86,
+    0x31, 0x14, 0x63, 0x38, 0xC6, 0x90, 0xCC, 0xF3, 0x2C, 0xF3, 0x2D, 0x25, 0x61, 0x37, 0x08, 0xBD,
+    0x41, 0xF8, 0xCD, 0x10, 0x5C, 0xC9, 0x70, 0xD5, 0x71, 0x68, 0xC4, 0xA2, 0x38, 0x49, 0x02, 0xFB,
+    0x19, 0x8D, 0xF5, 0x1D, 0x5E, 0x8C, 0xD4, 0xBF, 0x8E, 0xD1, 0x66, 0x5B, 0x3E, 0xE4, 0x66, 0x73,
+    0x6B, 0xA3, 0x00, 0x73, 0xD7, 0xDE, 0xA8, 0x84, 0x31, 0x31, 0xA2, 0x8C, 0x39, 0xA1, 0x4D, 0x8B,
+    0x59, 0xE7, 0x3F, 0x86, 0xFB, 0x3B, 0x7A, 0x2B, 0xB5, 0x04, 0xF4, 0x8A, 0x9A, 0x78, 0x47, 0xE9,
+    0xA9, 0xA7, 0x8E, 0x9E, 0xBA, 0x71, 0x4F, 0x19, 0x6F, 0x69, 0x1B, 0x37, 0xEA, 0x19, 0x8E, 0xC9,
+    0x84, 0x65, 0x16, 0x69, 0x80, 0x97, 0xC2, 0xC0, 0x8D, 0x77, 0x94, 0x1E, 0x2A, 0xB3, 0x6D, 0x6F,
+    0x18, 0x02, 0xA4, 0x3F, 0x21, 0xD9, 0xFE, 0x41, 0xF1, 0x89, 0xAB, 0x6F, 0x33, 0xB0, 0x0A, 0x39,
+    0x4A, 0x96, 0x1F, 0xF0, 0x1E, 0x4A, 0xBA, 0x1A, 0x9F, 0x13, 0xB9, 0x8A, 0xEA, 0xBC, 0x1E, 0xF2,
+    0xD6, 0x94, 0xDC, 0x20, 0x56, 0x2C, 0xC3, 0xEC, 0x95, 0x52, 0x0A, 0xEE, 0xD3, 0x36, 0xAC, 0x82,
+    0x3E, 0x3B, 0x48, 0xE5, 0x6A, 0x9C, 0x6C, 0x8D, 0xFF, 0x13, 0xCB, 0x0D, 0xC8, 0xFE, 0xB0, 0x0F,
+    0xF5, 0x5D, 0xBF, 0xBC, 0x21, 0x2E, 0x92, 0xF4, 0x44, 0x82, 0xB1, 0xBA, 0xA9, 0x61, 0x76, 0x22,
+    0xE2, 0xD4, 0x3C, 0x37, 0x2F, 0x1B, 0x97, 0x38, 0x72, 0xE3, 0xF6, 0x7B, 0x3C, 0xC7, 0x27, 0x23,
+    0x39, 0xC8, 0xE5, 0x24, 0x7F, 0x9C, 0xF0, 0x28, 0xBF, 0x23, 0x67, 0xB9, 0xE2, 0x61, 0xBE, 0xBE,
+    0x22, 0xA7, 0xF9, 0xAB, 0x17, 0x0A, 0x60, 0x54, 0x5C, 0x52, 0xF2, 0x9C, 0x3A, 0x44, 0xA7, 0x72,
+    0x19, 0x35, 0x85, 0x28, 0xBD, 0xFF, 0xF5, 0x3D, 0xEF, 0x49, 0x91, 0xCF, 0x26, 0xC5, 0x5E, 0x55,
+    0xDD, 0x97, 0x08, 0xE5, 0x58, 0x6B, 0xB2, 0xF9, 0xCD, 0x5A, 0x2E, 0xC6, 0xE6, 0x8B, 0x63, 0x2F,
+    0x25, 0xA3, 0xFC, 0x02, 0x8B, 0x81, 0x86, 0xFE, 0x69, 0x7F, 0xB1, 0xCF, 0x8E, 0xFC, 0x94, 0xEB,
+    0xA2, 0x4F, 0xE7, 0x25, 0x8B, 0x5E, 0xD0, 0xD3, 0x45, 0xDA, 0x84, 0xC5, 0x69, 0x1C, 0xCE, 0x62,
+    0x26, 0xF9, 0xAA, 0x97, 0x2F, 0x8E, 0x37, 0x69, 0x15, 0x15, 0xDF, 0x48, 0x41, 0xB6, 0x54, 0xDA,
+    0xC9, 0x02, 0x4F, 0xEE, 0x5F, 0x12, 0x8D, 0xC1, 0x62, 0xAB, 0xFC, 0xD1, 0x99, 0x9A, 0xE2, 0x52,
+    0x83, 0x15, 0x07, 0xCB, 0x32, 0xD6, 0x8B, 0x4D, 0x41, 0x2F, 0xB6, 0x66, 0xAD, 0x5C, 0x58, 0x2D,
+    0x0C, 0xCD, 0xE1, 0xB7, 0x1B, 0xEE, 0x56, 0xAF, 0x1A, 0xFA, 0x67, 0x5C, 0x4B, 0xFF, 0xEC, 0xD4,
+    0x14, 0x8D, 0xB2, 0xC0, 0x38, 0x2D, 0x2F, 0xC4, 0x57, 0xBA, 0x88, 0x67, 0xFA, 0x96, 0xE4, 0x2B,
+    0x5D, 0xC4, 0xD3, 0x50, 0xFB, 0xFC, 0xD3, 0x74, 0x1D, 0x2F, 0xEF, 0x2B, 0x17, 0xB6, 0x4E, 0x1C,
+    0xEA, 0x19, 0x96, 0x17, 0xF5, 0xF5, 0xF0, 0x9A, 0x3E, 0x3E, 0xDE, 0x8A, 0xAF, 0x32, 0xEF, 0x23,
+    0x5C, 0x75, 0x6D, 0xFF, 0x07, 0x75, 0x93, 0x3D, 0x6F, 0xDB, 0x56, 0x14, 0x86, 0x1F, 0x92, 0xB6,
+    0xAE, 0xED, 0x5B, 0xF2, 0x7A, 0x70, 0x06, 0x37, 0xFA, 0x58, 0x5A, 0xC0, 0x70, 0xA9, 0x28, 0x03,
+    0x07, 0x21, 0xA0, 0xA5, 0xBB, 0x65, 0x8C, 0x87, 0x14, 0x08, 0x50, 0x20, 0xCE, 0x5A, 0x34, 0x68,
+    0x35, 0x78, 0x70, 0x83, 0x24, 0x66, 0xF2, 0x0B, 0x9C, 0x39, 0x68, 0xA6, 0xA2, 0xCD, 0x07, 0x50,
+    0x70, 0xD0, 0x10, 0xB4, 0x83, 0xEF, 0x3F, 0x88, 0xB2, 0x27, 0x80, 0x0A, 0x64, 0x48, 0x90, 0xC5,
+    0x83, 0x06, 0xA3, 0xB0, 0xAC, 0x9E, 0x4B, 0x19, 0x75, 0x10, 0xA0, 0x3A, 0xC4, 0x25, 0x45, 0x1E,
+    0xBE, 0xEF, 0xB9, 0xE7, 0x39, 0x64, 0x1B, 0x35, 0xC5, 0x5C, 0xA3, 0xAD, 0xC9, 0x35, 0x5D, 0xCD,
+    0xAE, 0x61, 0x37, 0x61, 0xB7, 0xC1, 0x5E, 0x4E, 0x7F, 0x82, 0x2E, 0x40, 0x07, 0xD4, 0xD3, 0x8D,
+    0xEC, 0xF2, 0xA0, 0x3C, 0x40, 0x7E, 0x72, 0xAB, 0x65, 0xE9, 0xC3, 0x47, 0xA2, 0x57, 0xE8, 0x84,
+    0xF6, 0x4D, 0xFA, 0xB3, 0x82, 0x1C, 0xBA, 0xF0, 0x95, 0x4F, 0x51, 0x33, 0xF4, 0xB7, 0x24, 0x10,
+    0x43, 0x6B, 0xC2, 0xE2, 0x5D, 0x68, 0x54, 0x47, 0xCE, 0x9F, 0x13, 0x3A, 0xA2, 0xB9, 0x40, 0x30,
+    0x43, 0x3D, 0xF2, 0x39, 0x29, 0xF4, 0x4F, 0xD8, 0x6A, 0xB3, 0x27, 0xBE, 0x31, 0xDD, 0x94, 0xDE,
+    0x31, 0xBA, 0xB2, 0x32, 0xB3, 0x62, 0x71, 0xC7, 0xFA, 0x24, 0x11, 0xDF, 0x85, 0x23, 0x42, 0x87,
+    0x2A, 0x30, 0xD0, 0x86, 0x0D, 0xC9, 0xA8, 0xEA, 0x4F, 0x0C, 0x0D, 0x4D, 0x92, 0xA0, 0x8E, 0xBD,
+    0x9D, 0x54, 0x5E, 0x36, 0x38, 0x4A, 0xB9, 0x7F, 0xCC, 0xC5, 0x4A, 0x47, 0x9D, 0xD0, 0x6A, 0x92,
+    0x56, 0x7B, 0xCC, 0x0D, 0x9D, 0x43, 0xF4, 0x2F, 0x95, 0xF1, 0x90, 0x17, 0x63, 0xEE, 0x40, 0x60,
+    0xC3, 0x22, 0x2C, 0xF6, 0xA7, 0xDF, 0xBC, 0xF7, 0x67, 0xD8, 0x9F, 0x6E, 0x3E, 0xF5, 0x2B, 0x5C,
+    0xB8, 0x2E, 0xEB, 0x2A, 0xE3, 0xC8, 0x29, 0x2B, 0x36, 0xF2, 0x52, 0x2E, 0xDB, 0xF4, 0x91, 0xCB,
+    0x75, 0x4C, 0x40, 0xE4, 0x02, 0x17, 0x8C, 0x90, 0x08, 0x24, 0x42, 0x17, 0x15, 0xDA, 0x26, 0xF2,
+    0xAC, 0x84, 0x45, 0xF4, 0x61, 0x61, 0x1E, 0x3A, 0x13, 0xB9, 0x46, 0x54, 0xA4, 0x91, 0x4D, 0x95,
+    0xEF, 0x71, 0xB6, 0xE2, 0x0B, 0x8F, 0x3E, 0x6B, 0xFC, 0xBC, 0xF7, 0x4D, 0xBA, 0xFF, 0x35, 0x9E,
+    0xE0, 0xC8, 0x8C, 0xB7, 0xBC, 0xA4, 0x8F, 0x42, 0x59, 0x2D, 0x3B, 0x5F, 0x86, 0x35, 0xC2, 0x99,
+    0x8D, 0xAE, 0x3A, 0xB1, 0xF6, 0x87, 0xB6, 0xBE, 0x1B, 0x43, 0xA2, 0x91, 0x6F, 0x4C, 0x7F, 0xC6,
+    0xE6, 0x33, 0xD1, 0x37, 0xD3, 0xE5, 0x96, 0xFC, 0x4F, 0x6A, 0x2F, 0x6B, 0x13, 0xA9, 0x26, 0xB5,
+    0xF9, 0x3F, 0x93, 0x9F, 0xBC, 0x28, 0x2D, 0xE8, 0xC1, 0x29, 0xE1, 0x5B, 0x74, 0x4A, 0x23, 0xE7,
+    0xE7, 0x7B, 0x1C, 0xCE, 0xBC, 0x82, 0xAF, 0xF9, 0xD6, 0xFF, 0x03, 0xAC, 0x7F, 0x06, 0xD0, 0xAA,
+    0xD7, 0x15, 0xC0, 0xD5, 0x0A, 0xA0, 0x54, 0x9E, 0x90, 0x25, 0x74, 0xDB, 0x74, 0x3E, 0x05, 0xF8,
+    0x9D, 0x3D, 0xA3, 0xBC, 0x57, 0x01, 0x1C, 0x11, 0x55, 0x00, 0x9B, 0x73, 0x80, 0xAB, 0xA8, 0x53,
+    0x8C, 0xD0, 0x93, 0xF6, 0x1A, 0x0F, 0xD0, 0x4C, 0xBC, 0x82, 0x00, 0x2C, 0xDB, 0xF4, 0x5E, 0x9E,
+    0xE9, 0x08, 0x40, 0xB3, 0x73, 0x0E, 0xB0, 0x75, 0x88, 0x7A, 0x72, 0xA6, 0xF9, 0xC3, 0x98, 0x1F,
+    0x25, 0xC3, 0x0A, 0x04, 0xD7, 0x9F, 0x6E, 0x7E, 0xF0, 0x67, 0xAC, 0x5C, 0x49, 0x13, 0xFA, 0xA7,
+    0x1E, 0xA0, 0xAC, 0x36, 0x72, 0x5A, 0x76, 0x90, 0xCB, 0x10, 0x95, 0x52, 0xC4, 0x3C, 0x4A, 0x06,
+    0x64, 0x02, 0x30, 0x9C, 0xE3, 0x1B, 0xFB, 0xA8, 0x00, 0x56, 0xA8, 0x53, 0xC9, 0x0D, 0xFF, 0xB6,
+    0x66, 0xC7, 0x8A, 0x6D, 0xA6, 0x19, 0x24, 0x94, 0x31, 0x83, 0x9C, 0xDE, 0x1B, 0x96, 0x17, 0x08,
+    0xDF, 0x99, 0xDB, 0x69, 0x9C, 0xDD, 0xDD, 0x3F, 0xF0, 0x32, 0xBD, 0x61, 0xCD, 0x86, 0xBF, 0x62,
+    0x6E, 0xFA, 0x02, 0x33, 0xC5, 0x40, 0x53, 0x26, 0x0C, 0xEA, 0xF2, 0x80, 0x9A, 0x65, 0x39, 0xB4,
+    0x4A, 0x13, 0xDD, 0x16, 0xA0, 0x04, 0x63, 0x54, 0x49, 0x9C, 0xF9, 0x41, 0xDF, 0x5E, 0x90, 0x01,
+    0xFD, 0x7A, 0xE8, 0xF1, 0xB4, 0x4E, 0x86, 0xDD, 0x71, 0xF9, 0x97, 0x5B, 0x47, 0xC9, 0x27, 0x46,
+    0xD5, 0xFB, 0xEF, 0x69, 0x3E, 0xA6, 0xA9, 0x90, 0xA9, 0x91, 0x02, 0x2E, 0x8B, 0x60, 0x4C, 0x59,
+    0xF7, 0x6F, 0x9D, 0xE7, 0xAC, 0xC8, 0xB7, 0x49, 0x5A, 0xB2, 0xE9, 0xE8, 0x3B, 0xB2, 0x11, 0x83,
+    0x92, 0x32, 0x63, 0x7B, 0x4D, 0x72, 0xA4, 0xAB, 0x02, 0xF0, 0x0B, 0xE1, 0xB6, 0x21, 0x1B, 0xCD,
+    0xA4, 0xCE, 0x52, 0xE6, 0x6E, 0x69, 0xAF, 0x69, 0x93, 0x27, 0xBF, 0xBB, 0x86, 0x7A, 0xE0, 0x52,
+    0x1D, 0xBA, 0x6E, 0x12, 0x15, 0x59, 0x1C, 0xD9, 0x41, 0x5D, 0x51, 0x8A, 0xD5, 0xF6, 0xDA, 0x22,
+    0x4B, 0xF7, 0xBC, 0xF5, 0x25, 0x45, 0x3E, 0x1F, 0xD8, 0x4F, 0xAC, 0xC3, 0x2F, 0x51, 0xBF, 0x39,
+    0x55, 0x8C, 0x34, 0xA3, 0x38, 0x70, 0x71, 0x28, 0x42, 0xB6, 0xF3, 0x07, 0xDD, 0x5B, 0xE2, 0x20,
+    0x16, 0x7E, 0x86, 0x6A, 0xEF, 0x9A, 0x37, 0x52, 0x21, 0xAC, 0x46, 0xBE, 0xC9, 0xCF, 0xC7, 0xEB,
+    0x36, 0x60, 0x85, 0xCE, 0x41, 0xDB, 0x9E, 0x97, 0x72, 0x85, 0x75, 0xFE, 0x05, 0x55, 0x56, 0xBF,
+    0x6F, 0xDC, 0x56, 0x12, 0xFE, 0x48, 0x3A, 0x62, 0x20, 0xDA, 0xFB, 0x8C, 0x83, 0x91, 0x5F, 0x16,
+    0xC4, 0x2B, 0x13, 0x58, 0x5A, 0xA6, 0x08, 0x10, 0xC5, 0x26, 0xB5, 0x84, 0x5D, 0xB8, 0x30, 0x70,
+    0x11, 0x02, 0xF9, 0x52, 0xE6, 0xFE, 0x00, 0x03, 0x52, 0xE1, 0x42, 0x07, 0xD0, 0x5E, 0xFA, 0x52,
+    0x5C, 0xEB, 0x26, 0x55, 0x80, 0x20, 0x45, 0x0A, 0x43, 0x0E, 0x20, 0x15, 0x0A, 0xA0, 0x20, 0x8A,
+    0xF6, 0x25, 0x2E, 0x52, 0xB8, 0x38, 0x22, 0xC8, 0x55, 0x39, 0x24, 0x44, 0x2E, 0x2E, 0xCE, 0x4E,
+    0xCE, 0x44, 0x42, 0x3B, 0xEB, 0xBD, 0xDD, 0x7D, 0xF7, 0xCD, 0x23, 0xA5, 0xC8, 0x14, 0x66, 0xB4,
+    0x4B, 0xBE, 0x9D, 0x37, 0xF3, 0xCD, 0xF7, 0xCD, 0x23, 0xC0, 0xAB, 0x5F, 0xC2, 0x1B, 0x55, 0x08,
+    0x34, 0xA0, 0xF8, 0xB5, 0x4B, 0x4B, 0x9C, 0xCB, 0x69, 0xEC, 0x1B, 0x1D, 0x07, 0x29, 0x62, 0xDE,
+    0x4C, 0x68, 0xD1, 0xDA, 0x2A, 0x02, 0x33, 0x05, 0xAE, 0xAF, 0x02, 0x31, 0x1A, 0xDB, 0xA0, 0xED,
+    0xDF, 0x02, 0xCC, 0x90, 0x1F, 0xB6, 0x0B, 0xE0, 0x07, 0x8D, 0x19, 0xA3, 0xD1, 0x33, 0xA5, 0x63,
+    0x2E, 0xE5, 0xFE, 0xB7, 0x27, 0xA0, 0xFE, 0xB4, 0x80, 0x68, 0x6E, 0x09, 0x49, 0x7C, 0x15, 0xF1,
+    0x6B, 0xDB, 0xC8, 0xB8, 0x6C, 0x97, 0xCB, 0x3E, 0xBD, 0x93, 0xA3, 0xFF, 0x55, 0x8A, 0xDE, 0x25,
+    0xA0, 0x77, 0x02, 0x08, 0xA7, 0x43, 0x84, 0xA6, 0x06, 0x97, 0x81, 0xCB, 0x70, 0x72, 0x05, 0xCD,
+    0x15, 0x18, 0x2E, 0x34, 0x85, 0x33, 0x44, 0xEE, 0x95, 0xCC, 0x31, 0xE7, 0xDA, 0x83, 0x3C, 0x83,
+    0x88, 0xF9, 0x0D, 0x90, 0x29, 0x4D, 0x4B, 0x91, 0xF1, 0x41, 0xB6, 0x48, 0x63, 0x6E, 0x09, 0x2D,
+    0xDA, 0xE3, 0x7A, 0xC6, 0x74, 0x4D, 0xD5, 0xC4, 0x92, 0x0D, 0x22, 0x5A, 0x82, 0xA7, 0x6B, 0xD8,
+    0xA1, 0xD5, 0xB4, 0xD1, 0x26, 0x1C, 0x63, 0xE0, 0x3C, 0xBA, 0x0C, 0x97, 0xD5, 0x78, 0xC4, 0xA4,
+    0x67, 0x52, 0x6E, 0xCF, 0x34, 0xB8, 0x2F, 0xB7, 0xB0, 0x18, 0x35, 0x57, 0x5F, 0x02, 0x8F, 0xE1,
+    0x17, 0xC7, 0x0E, 0x1F, 0x48, 0x62, 0xF3, 0xFC, 0x1D, 0x63, 0xF8, 0x82, 0x15, 0xE3, 0x3B, 0xD7,
+    0x56, 0x99, 0xC3, 0x18, 0xCF, 0x3C, 0x21, 0x6E, 0x4C, 0xC3, 0x65, 0x0D, 0x7E, 0x2E, 0x71, 0x4D,
+    0x2E, 0xC6, 0x5F, 0x38, 0xE2, 0xE0, 0x59, 0x2F, 0x51, 0xD2, 0x5B, 0xF3, 0x1F, 0xC1, 0xFD, 0xCA,
+    0xF4, 0x0C, 0xBC, 0xEF, 0xDE, 0x99, 0x84, 0xA9, 0x57, 0x07, 0x95, 0x4A, 0xFD, 0x32, 0x28, 0xE8,
+    0xB5, 0xD2, 0x2A, 0x0D, 0xF2, 0x30, 0x55, 0xDC, 0xB6, 0xC7, 0x2D, 0x15, 0x06, 0x44, 0x23, 0xC4,
+    0x94, 0x65, 0x75, 0xBD, 0x09, 0x37, 0x4D, 0xFC, 0x8C, 0x3E, 0xEE, 0xC4, 0xE0, 0xFF, 0x85, 0x0C,
+    0xBB, 0xC0, 0x55, 0x9B, 0xB2, 0x85, 0xC1, 0xD1, 0xF6, 0x73, 0xC6, 0x6F, 0x9F, 0xA3, 0xC4, 0xC4,
+    0x29, 0x31, 0x75, 0x0B, 0xE7, 0xBF, 0x9E, 0x76, 0xBF, 0xF7, 0xF4, 0xE9, 0x87, 0xB7, 0x7F, 0x8C,
+    0x8C, 0xA9, 0xBC, 0xBB, 0x97, 0xE0, 0xFF, 0xFD, 0x4D, 0xD6, 0x6E, 0xCA, 0xB5, 0xDB, 0x0F, 0x6F,
+    0x2A, 0xEF, 0x67, 0x74, 0xBC, 0x9F, 0x30, 0xEF, 0x8D, 0xB1, 0xE8, 0x8E, 0x11, 0xBB, 0x43, 0xC4,
+    0x0E, 0x41, 0x1B, 0xDC, 0x64, 0x30, 0x16, 0xC8, 0xE8, 0x7D, 0x71, 0xAC, 0xC0, 0x29, 0x09, 0x88,
+    0x5B, 0xAA, 0x8B, 0xF0, 0x0A, 0xA5, 0x08, 0x63, 0xD4, 0x5D, 0xF1, 0xF5, 0xBE, 0xA9, 0x02, 0x53,
+    0x5F, 0x4B, 0x03, 0x93, 0xC6, 0x82, 0xD8, 0x86, 0x14, 0xBB, 0x23, 0x98, 0xD5, 0xD2, 0xCD, 0x4A,
+    0xBA, 0x52, 0x09, 0x64, 0x23, 0x3E, 0xC7, 0x20, 0x6D, 0x50, 0x1E, 0x94, 0xE2, 0xCD, 0xC4, 0xA6,
+    0xDF, 0x93, 0xF4, 0x65, 0x07, 0xD9, 0xC2, 0x25, 0x48, 0x85, 0x0A, 0x09, 0x52, 0x11, 0x2E, 0xBF,
+    0xC8, 0x5D, 0x96, 0x33, 0x42, 0xFB, 0xCF, 0x71, 0x26, 0x9C, 0x29, 0x19, 0x4C, 0x3D, 0xCC, 0xA3,
+    0x14, 0xCA, 0xD7, 0x41, 0x09, 0xE5, 0x69, 0x26, 0x1B, 0x7A, 0x24, 0x1F, 0xBA, 0xEC, 0xED, 0x06,
+    0x12, 0x76, 0x42, 0x4A, 0xF8, 0xF5, 0x81, 0x6C, 0xFA, 0x8B, 0xD1, 0x6D, 0x5B, 0xFD, 0x3C, 0x76,
+    0x0A, 0x3F, 0xCF, 0x3C, 0xED, 0xE7, 0x63, 0xBA, 0xF4, 0xA7, 0x20, 0x0D, 0xCE, 0xFF, 0x4B, 0x21,
+    0xB8, 0xF0, 0x71, 0x07, 0xC1, 0xC5, 0x2B, 0x8B, 0x08, 0x82, 0x85, 0x58, 0x1A, 0x68, 0xB0, 0x36,
+    0xD8, 0x1F, 0x41, 0xC5, 0x71, 0x05, 0xB5, 0xF4, 0x46, 0x01, 0xB5, 0x7E, 0x56, 0xA3, 0x53, 0x9D,
+    0xCB, 0xA1, 0x8A, 0x1E, 0xB7, 0xD6, 0x3D, 0x21, 0xEC, 0xB2, 0x30, 0x47, 0x28, 0xD7, 0x9F, 0xA6,
+    0x01, 0x6B, 0x31, 0x05, 0x2B, 0xA8, 0x6C, 0x1D, 0x15, 0x76, 0xE6, 0x59, 0xCB, 0xCA, 0xD5, 0x45,
+    0xD6, 0x52, 0xED, 0xC4, 0xF0, 0xBE, 0x28, 0xC5, 0x7F, 0x59, 0x56, 0x19, 0xFC, 0xBF, 0x15, 0xD5,
+    0x06, 0xFC, 0x77, 0x79, 0x8B, 0x9B, 0x7F, 0x59, 0x70, 0x13, 0xFF, 0x5D, 0x4D, 0x1F, 0x5C, 0xF8,
+    0xA2, 0xC4, 0xBC, 0x72, 0xCE, 0x17, 0x58, 0x14, 0x78, 0x45, 0xA0, 0x21, 0xA5, 0x1A, 0x6E, 0x0A,
+    0xE7, 0x22, 0xF3, 0x63, 0xDB, 0x60, 0x5E, 0xBB, 0x02, 0x1E, 0xE9, 0x2B, 0xB4, 0x6E, 0x08, 0x30,
+    0x7B, 0x83, 0x6E, 0xF0, 0xB8, 0x84, 0x3B, 0x8C, 0x0A, 0xB2, 0x97, 0xDA, 0x51, 0x39, 0xD5, 0xAF,
+    0x84, 0xE2, 0x21, 0x28, 0xF9, 0xAE, 0x74, 0x47, 0x18, 0xC5, 0x8E, 0xF4, 0x44, 0x69, 0xD7, 0x29,
+    0x25, 0x67, 0x22, 0x80, 0x5E, 0x21, 0x3E, 0x93, 0x18, 0x47, 0xAE, 0xBE, 0x11, 0x0E, 0x1C, 0x08,
+    0xCC, 0xAA, 0xC2, 0x23, 0x1B, 0x54, 0x71, 0x0A, 0x51, 0x9B, 0x04, 0x87, 0x83, 0xB0, 0x3F, 0x14,
+    0xB1, 0xDC, 0x5B, 0x69, 0x55, 0x55, 0x58, 0x93, 0xCF, 0xD6, 0xD8, 0x65, 0x21, 0x13, 0xCC, 0x3E,
+    0xF7, 0x9A, 0x34, 0xA1, 0x62, 0xA1, 0xC5, 0x06, 0x28, 0xE2, 0x5D, 0x97, 0xF1, 0x6B, 0x19, 0x51,
+    0x55, 0x24, 0x0C, 0xE0, 0x2D, 0xF7, 0x07, 0xDE, 0xF2, 0xBE, 0xB5, 0xB1, 0xD8, 0xBB, 0x33, 0x66,
+    0x94, 0xC3, 0xFF, 0x9A, 0x61, 0x02, 0xA9, 0x4F, 0xA5, 0xB5, 0x68, 0x49, 0xF4, 0x2F, 0xB4, 0x0A,
+    0x25, 0x52, 0x5B, 0x11, 0x07, 0x48, 0x48, 0x4E, 0x93, 0xE3, 0xC5, 0xEF, 0xBA, 0x7D, 0x96, 0x8F,
+    0xB9, 0xB8, 0xC7, 0xDF, 0xB3, 0x6F, 0x0E, 0xD9, 0xAC, 0xC6, 0xDB, 0x48, 0x06, 0x1C, 0x02, 0x84,
+    0xD4, 0x65, 0xB0, 0x90, 0x51, 0xF7, 0x69, 0x6F, 0x71, 0x89, 0xD7, 0xCE, 0x86, 0xE6, 0x3A, 0x6D,
+    0x44, 0x01, 0x3D, 0x2B, 0x81, 0x53, 0x10, 0x0D, 0x60, 0x45, 0xC9, 0xD3, 0x4A, 0xD6, 0xA1, 0x12,
+    0xC5, 0x3B, 0xA5, 0x63, 0xB5, 0x2F, 0xDE, 0x2B, 0xAC, 0xD7, 0x4E, 0xE5, 0xC0, 0xD7, 0x6E, 0xD9,
+    0xAF, 0xFC, 0xDC, 0x2B, 0x9E, 0x8C, 0x49, 0xB3, 0x3B, 0x65, 0xA2, 0x52, 0x75, 0x41, 0xB3, 0x9F,
+    0xD7, 0x7D, 0x1D, 0x87, 0x33, 0xE3, 0x20, 0xDF, 0x8B, 0x4C, 0xA9, 0x1E, 0xD4, 0xD1, 0x13, 0x28,
+    0x49, 0xA7, 0x1D, 0x40, 0xF3, 0xD6, 0x2F, 0x5A, 0x9F, 0xB4, 0x68, 0x1D, 0x36, 0xDD, 0xD2, 0x98,
+    0xA8, 0x2B, 0x82, 0x49, 0x82, 0x70, 0x12, 0xD0, 0xF8, 0x8B, 0xA5, 0x05, 0xDA, 0x12, 0x3F, 0x73,
+    0xFF, 0x44, 0x4A, 0x65, 0x96, 0x51, 0x33, 0x4B, 0x5F, 0x65, 0x8F, 0x2B, 0x03, 0xF7, 0x7F, 0xFF,
+    0x80, 0xBF, 0xF5, 0x26, 0xD4, 0x7C, 0x90, 0x2E, 0x1E, 0x27, 0x17, 0x70, 0x60, 0x02, 0x55, 0x28,
+    0xDD, 0xA7, 0x11, 0x8E, 0xFE, 0x50, 0xBA, 0x9E, 0x4A, 0x53, 0x9E, 0x79, 0xF4, 0xF6, 0x37, 0xCA,
+    0x98, 0xB1, 0x53, 0x72, 0x82, 0xD0, 0xCE, 0x8C, 0xB6, 0xCA, 0x33, 0xF7, 0xB7, 0x3E, 0xF4, 0xF5,
+    0x32, 0x82, 0x07, 0x63, 0x8A, 0xB1, 0x78, 0x6A, 0x40, 0x76, 0xDB, 0x94, 0x9B, 0x84, 0x39, 0xFA,
+    0x5D, 0x3B, 0x95, 0x27, 0x98, 0xC6, 0x2F, 0xB8, 0xF5, 0x12, 0x29, 0x79, 0x95, 0x4D, 0x5A, 0xE7,
+    0xDA, 0x6D, 0x66, 0x57, 0x72, 0xED, 0xBD, 0xD5, 0xC4, 0x31, 0x75, 0xEC, 0xDE, 0xAF, 0x63, 0x4F,
+    0x57, 0x89, 0x77, 0xA3, 0x5A, 0xF6, 0xCE, 0x97, 0x91, 0xCF, 0xE9, 0x72, 0x97, 0x0A, 0x35, 0x03,
+    0x8D, 0xC1, 0x34, 0xB5, 0x98, 0xCC, 0xD9, 0x21, 0x2A, 0xA3, 0x34, 0x94, 0x16, 0x48, 0x85, 0xF8,
+    0x4C, 0xDC, 0xAF, 0x74, 0xEE, 0xBF, 0x09, 0xA0, 0x90, 0x84, 0x03, 0xDA, 0x68, 0x67, 0xED, 0xCF,
+    0x8F, 0x52, 0x2C, 0xB3, 0x19, 0x33, 0xFB, 0x9B, 0x54, 0xB1, 0xE8, 0x99, 0x5F, 0x2A, 0x69, 0x6F,
+    0x2D, 0xE7, 0xE1, 0x8E, 0xA4, 0xBD, 0x2B, 0x08, 0xED, 0x4A, 0xC2, 0x2D, 0xB4, 0xA7, 0xA7, 0xD2,
+    0x6C, 0x8D, 0x53, 0x5E, 0x25, 0x54, 0x6C, 0x44, 0xE5, 0x54, 0xB3, 0x9B, 0xB7, 0x87, 0xE4, 0xD5,
+    0x10, 0x01, 0x11, 0x1A, 0x08, 0xBB, 0x4D, 0x15, 0xDD, 0xDF, 0xBC, 0x29, 0x15, 0x47, 0x6D, 0xE5,
+    0x61, 0x7E, 0x0C, 0xC1, 0x68, 0xCC, 0x82, 0x87, 0x6D, 0x97, 0x6C, 0xF5, 0x25, 0xAB, 0x1F, 0xB2,
+    0xFA, 0x3F, 0xBA, 0x95, 0x54, 0xFF, 0xDA, 0x53, 0xD5, 0x2F, 0x0B, 0x02, 0x4E, 0xC1, 0x79, 0xAB,
+    0xAD, 0x25, 0x3C, 0x27, 0x96, 0xBD, 0x14, 0x91, 0xCF, 0xF9, 0x72, 0x17, 0xF6, 0x9C, 0x71, 0x64,
+    0x3C, 0x1E, 0x54, 0x7F, 0xD2, 0x01, 0xD6, 0x03, 0x3B, 0x88, 0xDD, 0x47, 0x6B, 0xAB, 0xE4, 0xF9,
+    0xD8, 0xBF, 0x77, 0x6D, 0xC5, 0xD3, 0x31, 0xD9, 0x96, 0x51, 0xE4, 0xBB, 0xB4, 0x9A, 0xA5, 0x71,
+    0x90, 0x30, 0xF5, 0x90, 0x25, 0x74, 0x49, 0x51, 0x19, 0x87, 0xB1, 0x33, 0xCA, 0x63, 0x0C, 0xF2,
+    0x23, 0xF2, 0x96, 0xD3, 0x57, 0x8E, 0x73, 0xF0, 0x9C, 0xC8, 0x9B, 0x72, 0xDD, 0x43, 0x67, 0x15,
+    0x2B, 0x02, 0x69, 0x81, 0x0E, 0xEC, 0x77, 0xAB, 0xDE, 0x1E, 0xE6, 0x5F, 0x79, 0x39, 0xC4, 0xB9,
+    0xF7, 0xDF, 0x0F, 0xF1, 0xFA, 0xC5, 0x8B, 0x5D, 0xF4, 0xFC, 0xD9, 0x0C, 0xE1, 0x07, 0xAA, 0x46,
+    0x47, 0x4E, 0xBD, 0xE3, 0x27, 0x98, 0xEB, 0xF1, 0xB9, 0x39, 0x39, 0x93, 0x8D, 0x8E, 0xCC, 0xE1,
+    0xF8, 0x15, 0xE0, 0xD2, 0xBE, 0x4C, 0xAB, 0x03, 0x8E, 0x64, 0xED, 0x18, 0xAB, 0x0F, 0xA0, 0x6E,
+    0xCC, 0x3D, 0x22, 0x44, 0x5F, 0x4B, 0xA6, 0x86, 0x47, 0x8B, 0x69, 0x90, 0xE6, 0x28, 0x7B, 0x69,
+    0xEB, 0x3F, 0x8C, 0x35, 0x69, 0xD8, 0xC0, 0x0E, 0x3C, 0x37, 0x69, 0x0E, 0x93, 0xAC, 0xA5, 0x5F,
+    0xB7, 0xD5, 0x92, 0x1C, 0xEC, 0x87, 0x23, 0xA8, 0x3A, 0xBA, 0xE7, 0x0C, 0xF0, 0x84, 0x0A, 0x22,
+    0x7D, 0x43, 0xEE, 0x7D, 0xB6, 0xBA, 0x42, 0x79, 0xD4, 0x56, 0x01, 0x7D, 0xAE, 0x7F, 0x5B, 0xBB,
+    0x85, 0xAF, 0x3D, 0x1D, 0xE4, 0x3C, 0x92, 0x53, 0xFE, 0xB1, 0xE6, 0x90, 0x93, 0x23, 0x92, 0x7E,
+    0x4E, 0xD3, 0x43, 0x04, 0x15, 0x73, 0x4C, 0x18, 0x77, 0x9D, 0x47, 0xF0, 0x36, 0xED, 0xAF, 0x9F,
+    0x5C, 0x96, 0x1A, 0xEB, 0x99, 0xD1, 0xE6, 0x1E, 0x7B, 0xDB, 0x61, 0x6F, 0x67, 0xDD, 0x3B, 0xCF,
+    0xCE, 0x7A, 0xDF, 0x0F, 0x3A, 0xDE, 0xE3, 0xDF, 0x3E, 0xF6, 0xF4, 0x8D, 0x5A, 0xC6, 0xC7, 0x39,
+    0xDA, 0x1F, 0xE4, 0xF0, 0x9B, 0xEE, 0x35, 0x72, 0xB3, 0x97, 0x23, 0x77, 0xEC, 0x5C, 0x69, 0x9C,
+    0xC0, 0x26, 0xD5, 0xE3, 0x9D, 0xC2, 0x42, 0x99, 0x62, 0xB0, 0xB5, 0x55, 0xB8, 0x75, 0xE8, 0x72,
+    0xFA, 0x84, 0xA8, 0x7C, 0xDD, 0x25, 0x13, 0xF2, 0x84, 0x2E, 0x8D, 0xE5, 0xC8, 0x89, 0xDD, 0x2A,
+    0x14, 0xF0, 0xBA, 0x12, 0x21, 0x91, 0x08, 0x89, 0x8D, 0xA0, 0x38, 0xC5, 0x64, 0x42, 0x77, 0xB1,
+    0x4F, 0x78, 0xF8, 0x5E, 0x45, 0x1C, 0xD9, 0x30, 0x39, 0x2E, 0x89, 0x7C, 0x86, 0xFA, 0xF9, 0x9A,
+    0xE1, 0x8B, 0xD0, 0xDC, 0x3A, 0x44, 0x5E, 0x06, 0xF8, 0x99, 0xFB, 0x79, 0x83, 0x7E, 0xFB, 0x7A,
+    0xC4, 0x0C, 0x8F, 0xD1, 0x75, 0xE6, 0x0E, 0x9C, 0x0C, 0x73, 0x57, 0x3A, 0xAE, 0xC6, 0x67, 0xF9,
+    0xB6, 0xB7, 0xB4, 0x0E, 0xEC, 0xC9, 0xFB, 0x5D, 0x4D, 0xE7, 0x56, 0xEB, 0xD4, 0x62, 0xF1, 0x97,
+    0xFC, 0x48, 0x31, 0x47, 0x5C, 0x81, 0xB6, 0x23, 0xB0, 0xD5, 0xF3, 0x2C, 0xB7, 0xAA, 0x12, 0x57,
+    0x36, 0xFB, 0x04, 0xDC, 0xA1, 0xB3, 0x60, 0xDF, 0x3F, 0x1D, 0xEA, 0xC0, 0x2D, 0xA3, 0x94, 0x33,
+    0x21, 0x6F, 0x9A, 0x12, 0xE4, 0x7C, 0x4B, 0x82, 0x7A, 0xEF, 0x73, 0xD6, 0xC6, 0x17, 0x80, 0xDB,
+    0xB5, 0xAD, 0xA8, 0xCB, 0xEA, 0x12, 0xAA, 0x8A, 0x6F, 0x49, 0x90, 0xF7, 0xA3, 0x8C, 0x2F, 0x96,
+    0x03, 0x3E, 0x37, 0x6C, 0x99, 0x84, 0x3A, 0xC1, 0xF9, 0x78, 0xEC, 0x24, 0xF0, 0x7F, 0xD3, 0x5A,
+    0x61, 0xFF, 0x43, 0x34, 0x00, 0x00, 0x45, 0xCE, 0x31, 0x0E, 0x82, 0x30, 0x14, 0xC6, 0xF1, 0x4F,
+    0x3A, 0x30, 0x74, 0xE8, 0x0D, 0xEC, 0x0D, 0xF0, 0x02, 0x10, 0x7B, 0x08, 0x77, 0x77, 0xCF, 0x40,
+    0xB4, 0x47, 0x70, 0xF0, 0x00, 0x1C, 0xC2, 0x81, 0xC9, 0xF6, 0x08, 0x30, 0xB0, 0x73, 0x84, 0x0E,
+    0x0C, 0xC6, 0x04, 0xF0, 0xBD, 0x27, 0x89, 0x1D, 0x7E, 0x29, 0xA4, 0xC9, 0xF7, 0x07, 0x7E, 0x47,
+    0xCF, 0xEC, 0x31, 0x78, 0xB2, 0x55, 0x1D, 0x99, 0x54, 0x04, 0x76, 0x9B, 0x7A, 0x00, 0xB2, 0x31,
+    0xAC, 0x80, 0xEA, 0xEC, 0x83, 0x8C, 0x86, 0x9E, 0xE4, 0xA2, 0xF6, 0x96, 0x75, 0x05, 0x69, 0x5C,
+    0xC5, 0xA2, 0x24, 0x2D, 0x6A, 0xB2, 0x10, 0x2B, 0xB1, 0xC4, 0xB5, 0x61, 0x0F, 0x09, 0xF2, 0x4D,
+    0x53, 0xE2, 0xC4, 0x64, 0x49, 0x0A, 0x3A, 0xD1, 0xE1, 0x7F, 0x2C, 0xA7, 0xDD, 0x02, 0xFD, 0x9A,
+    0xF2, 0xB8, 0x75, 0x8D, 0x74, 0xBB, 0x24, 0x3B, 0xA8, 0x35, 0xAD, 0x8B, 0xE9, 0x9B, 0xF3, 0xC9,
+    0xF0, 0x20, 0x85, 0xEC, 0x61, 0x3C, 0x8D, 0xE6, 0x13, 0x6D, 0x62, 0xE1, 0x10, 0xEB, 0x6B, 0x4E,
+    0x6D, 0xB9, 0xFA, 0x09, 0xA7, 0xE3, 0x1B, 0x9F, 0xE0, 0x5E, 0xF7, 0x30, 0x6F, 0x6B, 0xF8, 0x02,
+    0x45, 0x8D, 0xC1, 0x0D, 0x80, 0x30, 0x0C, 0x03, 0x23, 0xF2, 0xE4, 0x91, 0x01, 0xD8, 0x85, 0xC2,
+    0x64, 0x88, 0xC9, 0x28, 0x1B, 0x74, 0x04, 0x46, 0xE8, 0x07, 0x09, 0xA1, 0x8A, 0x23, 0x11, 0x0F,
+    0x22, 0xC7, 0x0F, 0x5B, 0xB6, 0x45, 0x54, 0xE2, 0x2C, 0x07, 0xA7, 0x1A, 0x4C, 0x73, 0x52, 0x08,
+    0x79, 0xEA, 0xDD, 0x18, 0xA5, 0x73, 0x83, 0x61, 0x6E, 0x21, 0xEF, 0x88, 0xC1, 0x4A, 0x4E, 0x3C,
+    0x4A, 0xDD, 0xB8, 0x8C, 0x2B, 0x51, 0x1D, 0xC6, 0xB1, 0x91, 0x95, 0x33, 0xC2, 0x10, 0x45, 0xE9,
+    0xC4, 0xB3, 0x56, 0x16, 0xEF, 0xD1, 0xB2, 0x44, 0xFF, 0xDD, 0xFE, 0xAD, 0x6F, 0xB7, 0xF3, 0x7F,
+    0x01,
 };
 
 static const EpdGlyph notosans_12_italicGlyphs[] = {
@@ -1779,99 +1785,99 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 7, 19, 104, 0, 18, 34, 0 }, // !
-    { 9, 7, 157, 2, 18, 16, 34 }, // "
-    { 17, 18, 258, 0, 18, 77, 50 }, // #
-    { 14, 21, 220, 0, 19, 74, 127 }, // $
-    { 17, 20, 320, 2, 19, 85, 201 }, // %
-    { 17, 20, 269, 0, 19, 85, 286 }, // &
-    { 4, 7, 88, 2, 18, 7, 371 }, // '
-    { 9, 22, 116, 1, 18, 50, 378 }, // (
-    { 9, 22, 116, -2, 18, 50, 428 }, // )
-    { 13, 13, 220, 2, 20, 43, 478 }, // *
-    { 13, 13, 229, 1, 15, 43, 521 }, // +
-    { 6, 7, 102, -2, 3, 11, 564 }, // ,
-    { 7, 3, 125, 0, 8, 6, 575 }, // -
-    { 4, 5, 102, 0, 4, 5, 581 }, // .
-    { 14, 18, 142, -2, 18, 63, 586 }, // /
-    { 13, 20, 224, 1, 19, 65, 649 }, // 0
-    { 9, 18, 182, 2, 18, 41, 714 }, // 1
-    { 14, 19, 220, -1, 19, 67, 755 }, // 2
-    { 14, 20, 220, -1, 19, 70, 822 }, // 3
-    { 14, 18, 220, 0, 18, 63, 892 }, // 4
-    { 13, 19, 220, 0, 18, 62, 955 }, // 5
-    { 13, 20, 220, 1, 19, 65, 1017 }, // 6
-    { 13, 18, 191, 1, 18, 59, 1082 }, // 7
-    { 14, 20, 221, 0, 19, 70, 1141 }, // 8
-    { 13, 20, 220, 0, 19, 65, 1211 }, // 9
-    { 6, 15, 102, 0, 14, 23, 1276 }, // :
-    { 8, 18, 102, -2, 14, 36, 1299 }, // ;
-    { 13, 14, 229, 1, 16, 46, 1335 }, // <
-    { 13, 8, 229, 1, 13, 26, 1381 }, // =
-    { 13, 14, 229, 1, 16, 46, 1407 }, // >
-    { 11, 20, 172, 1, 19, 55, 1453 }, // ?
-    { 20, 21, 339, 1, 18, 105, 1508 }, // @
-    { 15, 18, 225, -2, 18, 68, 1613 }, // A
-    { 14, 18, 240, 1, 18, 63, 1681 }, // B
-    { 15, 20, 235, 1, 19, 75, 1744 }, // C
-    { 15, 18, 267, 1, 18, 68, 1819 }, // D
-    { 13, 18, 206, 1, 18, 59, 1887 }, // E
-    { 13, 18, 191, 1, 18, 59, 1946 }, // F
-    { 16, 20, 271, 1, 19, 80, 2005 }, // G
-    { 17, 18, 272, 1, 18, 77, 2085 }, // H
-    { 11, 18, 130, -1, 18, 50, 2162 }, // I
-    { 12, 23, 109, -4, 18, 69, 2212 }, // J
-    { 16, 18, 225, 1, 18, 72, 2281 }, // K
-    { 10, 18, 191, 1, 18, 45, 2353 }, // L
-    { 21, 18, 336, 1, 18, 95, 2398 }, // M
-    { 17, 18, 283, 1, 18, 77, 2493 }, // N
-    { 17, 20, 288, 1, 19, 85, 2570 }, // O
-    { 14, 18, 227, 1, 18, 63, 2655 }, // P
-    { 17, 24, 288, 1, 19, 102, 2718 }, // Q
-    { 14, 18, 229, 1, 18, 63, 2820 }, // R
-    { 13, 20, 202, 0, 19, 65, 2883 }, // S
-    { 13, 18, 200, 2, 18, 59, 2948 }, // T
-    { 17, 19, 271, 1, 18, 81, 3007 }, // U
-    { 15, 18, 221, 2, 18, 68, 3088 }, // V
-    { 22, 18, 342, 2, 18, 99, 3156 }, // W
-    { 18, 18, 211, -2, 18, 81, 3255 }, // X
-    { 14, 18, 204, 2, 18, 63, 3336 }, // Y
-    { 16, 18, 212, -1, 18, 72, 3399 }, // Z
-    { 11, 22, 116, -1, 18, 61, 3471 }, // [
-    { 6, 18, 142, 2, 18, 27, 3532 }, // <backslash>
-    { 10, 22, 116, -2, 18, 55, 3559 }, // ]
-    { 14, 12, 229, 0, 18, 42, 3614 }, // ^
-    { 11, 2, 158, -3, -2, 6, 3656 }, // _
-    { 5, 5, 111, 3, 20, 7, 3662 }, // `
-    { 13, 15, 227, 1, 14, 49, 3669 }, // a
-    { 14, 20, 232, 0, 19, 70, 3718 }, // b
-    { 11, 15, 181, 1, 14, 42, 3788 }, // c
-    { 14, 20, 232, 1, 19, 70, 3830 }, // d
-    { 11, 15, 200, 1, 14, 42, 3900 }, // e
-    { 15, 26, 127, -3, 20, 98, 3942 }, // f
-    { 14, 20, 232, 0, 14, 70, 4040 }, // g
-    { 14, 19, 232, 0, 19, 67, 4110 }, // h
-    { 7, 19, 103, 0, 19, 34, 4177 }, // i
-    { 11, 25, 103, -4, 19, 69, 4211 }, // j
-    { 14, 19, 198, 0, 19, 67, 4280 }, // k
-    { 7, 19, 103, 0, 19, 34, 4347 }, // l
-    { 21, 14, 350, 0, 14, 74, 4381 }, // m
-    { 14, 14, 232, 0, 14, 49, 4455 }, // n
-    { 12, 15, 225, 1, 14, 45, 4504 }, // o
-    { 15, 20, 232, -1, 14, 75, 4549 }, // p
-    { 13, 20, 232, 1, 14, 65, 4624 }, // q
-    { 11, 14, 159, 0, 14, 39, 4689 }, // r
-    { 11, 15, 173, 0, 14, 42, 4728 }, // s
-    { 9, 18, 133, 1, 17, 41, 4770 }, // t
-    { 13, 15, 232, 1, 14, 49, 4811 }, // u
-    { 12, 14, 187, 1, 14, 42, 4860 }, // v
-    { 19, 14, 289, 1, 14, 67, 4902 }, // w
-    { 14, 14, 193, -1, 14, 49, 4969 }, // x
-    { 16, 20, 187, -3, 14, 80, 5018 }, // y
-    { 12, 14, 178, -1, 14, 42, 5098 }, // z
-    { 10, 22, 140, 0, 18, 55, 5140 }, // {
-    { 3, 26, 220, 6, 19, 20, 5195 }, // |
-    { 10, 22, 140, -1, 18, 55, 5215 }, // }
-    { 13, 4, 229, 1, 11, 13, 5270 }, // ~
+    { 9, 7, 157, 2, 18, 16, 0 }, // "
+    { 17, 18, 258, 0, 18, 77, 16 }, // #
+    { 14, 21, 220, 0, 19, 74, 93 }, // $
+    { 17, 20, 320, 2, 19, 85, 167 }, // %
+    { 17, 20, 269, 0, 19, 85, 252 }, // &
+    { 4, 7, 88, 2, 18, 7, 337 }, // '
+    { 9, 22, 116, 1, 18, 50, 34 }, // (
+    { 9, 22, 116, -2, 18, 50, 84 }, // )
+    { 13, 13, 220, 2, 20, 43, 344 }, // *
+    { 13, 13, 229, 1, 15, 43, 387 }, // +
+    { 6, 7, 102, -2, 3, 11, 134 }, // ,
+    { 7, 3, 125, 0, 8, 6, 145 }, // -
+    { 4, 5, 102, 0, 4, 5, 151 }, // .
+    { 14, 18, 142, -2, 18, 63, 430 }, // /
+    { 13, 20, 224, 1, 19, 65, 156 }, // 0
+    { 9, 18, 182, 2, 18, 41, 221 }, // 1
+    { 14, 19, 220, -1, 19, 67, 262 }, // 2
+    { 14, 20, 220, -1, 19, 70, 329 }, // 3
+    { 14, 18, 220, 0, 18, 63, 399 }, // 4
+    { 13, 19, 220, 0, 18, 62, 462 }, // 5
+    { 13, 20, 220, 1, 19, 65, 524 }, // 6
+    { 13, 18, 191, 1, 18, 59, 589 }, // 7
+    { 14, 20, 221, 0, 19, 70, 648 }, // 8
+    { 13, 20, 220, 0, 19, 65, 718 }, // 9
+    { 6, 15, 102, 0, 14, 23, 783 }, // :
+    { 8, 18, 102, -2, 14, 36, 806 }, // ;
+    { 13, 14, 229, 1, 16, 46, 493 }, // <
+    { 13, 8, 229, 1, 13, 26, 539 }, // =
+    { 13, 14, 229, 1, 16, 46, 565 }, // >
+    { 11, 20, 172, 1, 19, 55, 842 }, // ?
+    { 20, 21, 339, 1, 18, 105, 611 }, // @
+    { 15, 18, 225, -2, 18, 68, 897 }, // A
+    { 14, 18, 240, 1, 18, 63, 965 }, // B
+    { 15, 20, 235, 1, 19, 75, 1028 }, // C
+    { 15, 18, 267, 1, 18, 68, 1103 }, // D
+    { 13, 18, 206, 1, 18, 59, 1171 }, // E
+    { 13, 18, 191, 1, 18, 59, 1230 }, // F
+    { 16, 20, 271, 1, 19, 80, 1289 }, // G
+    { 17, 18, 272, 1, 18, 77, 1369 }, // H
+    { 11, 18, 130, -1, 18, 50, 1446 }, // I
+    { 12, 23, 109, -4, 18, 69, 1496 }, // J
+    { 16, 18, 225, 1, 18, 72, 1565 }, // K
+    { 10, 18, 191, 1, 18, 45, 1637 }, // L
+    { 21, 18, 336, 1, 18, 95, 1682 }, // M
+    { 17, 18, 283, 1, 18, 77, 1777 }, // N
+    { 17, 20, 288, 1, 19, 85, 1854 }, // O
+    { 14, 18, 227, 1, 18, 63, 1939 }, // P
+    { 17, 24, 288, 1, 19, 102, 2002 }, // Q
+    { 14, 18, 229, 1, 18, 63, 2104 }, // R
+    { 13, 20, 202, 0, 19, 65, 2167 }, // S
+    { 13, 18, 200, 2, 18, 59, 2232 }, // T
+    { 17, 19, 271, 1, 18, 81, 716 }, // U
+    { 15, 18, 221, 2, 18, 68, 2291 }, // V
+    { 22, 18, 342, 2, 18, 99, 2359 }, // W
+    { 18, 18, 211, -2, 18, 81, 2458 }, // X
+    { 14, 18, 204, 2, 18, 63, 2539 }, // Y
+    { 16, 18, 212, -1, 18, 72, 2602 }, // Z
+    { 11, 22, 116, -1, 18, 61, 797 }, // [
+    { 6, 18, 142, 2, 18, 27, 858 }, // <backslash>
+    { 10, 22, 116, -2, 18, 55, 885 }, // ]
+    { 14, 12, 229, 0, 18, 42, 940 }, // ^
+    { 11, 2, 158, -3, -2, 6, 982 }, // _
+    { 5, 5, 111, 3, 20, 7, 988 }, // `
+    { 13, 15, 227, 1, 14, 49, 2674 }, // a
+    { 14, 20, 232, 0, 19, 70, 2723 }, // b
+    { 11, 15, 181, 1, 14, 42, 2793 }, // c
+    { 14, 20, 232, 1, 19, 70, 2835 }, // d
+    { 11, 15, 200, 1, 14, 42, 2905 }, // e
+    { 15, 26, 127, -3, 20, 98, 2947 }, // f
+    { 14, 20, 232, 0, 14, 70, 3045 }, // g
+    { 14, 19, 232, 0, 19, 67, 3115 }, // h
+    { 7, 19, 103, 0, 19, 34, 3182 }, // i
+    { 11, 25, 103, -4, 19, 69, 3216 }, // j
+    { 14, 19, 198, 0, 19, 67, 3285 }, // k
+    { 7, 19, 103, 0, 19, 34, 3352 }, // l
+    { 21, 14, 350, 0, 14, 74, 3386 }, // m
+    { 14, 14, 232, 0, 14, 49, 3460 }, // n
+    { 12, 15, 225, 1, 14, 45, 3509 }, // o
+    { 15, 20, 232, -1, 14, 75, 3554 }, // p
+    { 13, 20, 232, 1, 14, 65, 3629 }, // q
+    { 11, 14, 159, 0, 14, 39, 3694 }, // r
+    { 11, 15, 173, 0, 14, 42, 3733 }, // s
+    { 9, 18, 133, 1, 17, 41, 3775 }, // t
+    { 13, 15, 232, 1, 14, 49, 3816 }, // u
+    { 12, 14, 187, 1, 14, 42, 3865 }, // v
+    { 19, 14, 289, 1, 14, 67, 3907 }, // w
+    { 14, 14, 193, -1, 14, 49, 3974 }, // x
+    { 16, 20, 187, -3, 14, 80, 4023 }, // y
+    { 12, 14, 178, -1, 14, 42, 4103 }, // z
+    { 10, 22, 140, 0, 18, 55, 995 }, // {
+    { 3, 26, 220, 6, 19, 20, 1050 }, // |
+    { 10, 22, 140, -1, 18, 55, 1070 }, // }
+    { 13, 4, 229, 1, 11, 13, 1125 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 8, 19, 104, -1, 14, 38, 0 }, // U+00A1
     { 12, 20, 220, 2, 19, 60, 38 }, // U+00A2
@@ -1955,19 +1961,19 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 13, 21, 228, 1, 20, 69, 5105 }, // U+00F0
     { 14, 19, 232, 0, 19, 67, 5174 }, // U+00F1
     { 12, 21, 225, 1, 20, 63, 5241 }, // U+00F2
-    { 12, 21, 225, 1, 20, 63, 5304 }, // U+00F3
-    { 12, 21, 225, 1, 20, 63, 5367 }, // U+00F4
-    { 13, 20, 225, 1, 19, 65, 5430 }, // U+00F5
-    { 12, 20, 225, 1, 19, 60, 5495 }, // U+00F6
-    { 13, 12, 229, 1, 15, 39, 5555 }, // U+00F7
-    { 14, 16, 225, 0, 15, 56, 5594 }, // U+00F8
-    { 13, 21, 232, 1, 20, 69, 5650 }, // U+00F9
-    { 13, 21, 232, 1, 20, 69, 5719 }, // U+00FA
-    { 13, 21, 232, 1, 20, 69, 5788 }, // U+00FB
-    { 13, 20, 232, 1, 19, 65, 5857 }, // U+00FC
-    { 16, 26, 187, -3, 20, 104, 5922 }, // U+00FD
-    { 15, 25, 232, -1, 19, 94, 6026 }, // U+00FE
-    { 16, 25, 187, -3, 19, 100, 6120 }, // U+00FF
+    { 12, 21, 225, 1, 20, 63, 4145 }, // U+00F3
+    { 12, 21, 225, 1, 20, 63, 5304 }, // U+00F4
+    { 13, 20, 225, 1, 19, 65, 5367 }, // U+00F5
+    { 12, 20, 225, 1, 19, 60, 5432 }, // U+00F6
+    { 13, 12, 229, 1, 15, 39, 5492 }, // U+00F7
+    { 14, 16, 225, 0, 15, 56, 5531 }, // U+00F8
+    { 13, 21, 232, 1, 20, 69, 5587 }, // U+00F9
+    { 13, 21, 232, 1, 20, 69, 5656 }, // U+00FA
+    { 13, 21, 232, 1, 20, 69, 5725 }, // U+00FB
+    { 13, 20, 232, 1, 19, 65, 5794 }, // U+00FC
+    { 16, 26, 187, -3, 20, 104, 5859 }, // U+00FD
+    { 15, 25, 232, -1, 19, 94, 5963 }, // U+00FE
+    { 16, 25, 187, -3, 19, 100, 6057 }, // U+00FF
     { 16, 21, 225, -2, 21, 84, 0 }, // U+0100
     { 13, 18, 227, 1, 17, 59, 84 }, // U+0101
     { 16, 23, 225, -2, 23, 92, 143 }, // U+0102
@@ -2669,98 +2675,98 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 7, 3, 125, 0, 8, 6, 78 }, // U+2010
     { 7, 3, 125, 0, 8, 6, 84 }, // U+2011
     { 13, 2, 220, 1, 10, 7, 90 }, // U+2012
-    { 12, 3, 192, 0, 8, 9, 97 }, // U+2013
-    { 24, 3, 384, 0, 8, 18, 106 }, // U+2014
-    { 24, 3, 384, 0, 8, 18, 124 }, // U+2015
-    { 9, 26, 220, 3, 19, 59, 142 }, // U+2016
-    { 12, 6, 158, -3, 0, 18, 201 }, // U+2017
-    { 6, 7, 70, 1, 18, 11, 219 }, // U+2018
-    { 6, 7, 70, 1, 18, 11, 230 }, // U+2019
-    { 6, 7, 97, -2, 3, 11, 241 }, // U+201A
-    { 4, 7, 70, 2, 18, 7, 252 }, // U+201B
-    { 11, 7, 143, 1, 18, 20, 259 }, // U+201C
-    { 11, 7, 143, 1, 18, 20, 279 }, // U+201D
-    { 11, 7, 170, -2, 3, 20, 299 }, // U+201E
-    { 8, 7, 143, 2, 18, 14, 319 }, // U+201F
-    { 10, 19, 188, 2, 19, 48, 333 }, // U+2020
-    { 13, 19, 188, 0, 19, 62, 381 }, // U+2021
-    { 6, 7, 150, 2, 13, 11, 443 }, // U+2022
-    { 8, 8, 147, 1, 13, 16, 454 }, // U+2023
-    { 4, 5, 200, 3, 4, 5, 470 }, // U+2024
-    { 10, 5, 203, 0, 4, 13, 475 }, // U+2025
-    { 17, 5, 308, 0, 4, 22, 488 }, // U+2026
-    { 4, 5, 102, 1, 9, 5, 510 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 515 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 515 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 515 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 550 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 585 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 618 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 651 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 684 }, // U+202F
-    { 26, 20, 450, 2, 19, 130, 684 }, // U+2030
-    { 34, 20, 581, 2, 19, 170, 814 }, // U+2031
-    { 7, 7, 88, 1, 18, 13, 984 }, // U+2032
-    { 11, 7, 156, 1, 18, 20, 997 }, // U+2033
-    { 15, 7, 223, 1, 18, 27, 1017 }, // U+2034
-    { 4, 7, 108, 3, 18, 7, 1044 }, // U+2035
-    { 8, 7, 170, 3, 18, 14, 1051 }, // U+2036
-    { 12, 7, 231, 3, 18, 21, 1065 }, // U+2037
-    { 10, 9, 160, -3, 3, 23, 1086 }, // U+2038
-    { 6, 11, 115, 1, 12, 17, 1109 }, // U+2039
-    { 7, 11, 115, 0, 12, 20, 1126 }, // U+203A
-    { 19, 20, 335, 1, 19, 95, 1146 }, // U+203B
-    { 13, 19, 198, 0, 18, 62, 1241 }, // U+203C
-    { 11, 20, 172, 1, 19, 55, 1303 }, // U+203D
-    { 11, 2, 157, 2, 21, 6, 1358 }, // U+203E
-    { 14, 6, 217, -2, 0, 21, 1364 }, // U+203F
-    { 13, 6, 217, 2, 20, 20, 1385 }, // U+2040
-    { 12, 17, 136, -3, 11, 51, 1405 }, // U+2041
-    { 27, 24, 447, 0, 20, 162, 1456 }, // U+2042
-    { 7, 3, 114, 0, 8, 6, 1618 }, // U+2043
-    { 16, 18, 52, -6, 18, 72, 1624 }, // U+2044
-    { 11, 22, 116, -1, 18, 61, 1696 }, // U+2045
-    { 10, 22, 116, -2, 18, 55, 1757 }, // U+2046
-    { 22, 20, 344, 1, 19, 110, 1812 }, // U+2047
-    { 17, 20, 276, 1, 19, 85, 1922 }, // U+2048
-    { 18, 20, 276, 0, 19, 90, 2007 }, // U+2049
-    { 13, 14, 208, 1, 14, 46, 2097 }, // U+204A
-    { 13, 23, 240, 2, 19, 75, 2143 }, // U+204B
-    { 13, 14, 256, 1, 14, 46, 2218 }, // U+204C
-    { 13, 14, 256, 2, 14, 46, 2264 }, // U+204D
-    { 13, 13, 220, -1, 7, 43, 2310 }, // U+204E
-    { 6, 18, 102, 0, 14, 27, 2353 }, // U+204F
-    { 17, 26, 217, -2, 20, 111, 2380 }, // U+2050
-    { 15, 26, 220, 0, 20, 98, 2491 }, // U+2051
-    { 10, 20, 149, 0, 19, 50, 2589 }, // U+2052
-    { 22, 5, 400, 2, 10, 28, 2639 }, // U+2053
-    { 14, 6, 217, -3, 0, 21, 2667 }, // U+2054
-    { 14, 14, 229, 0, 13, 49, 2688 }, // U+2055
-    { 11, 20, 207, 1, 19, 55, 2737 }, // U+2056
-    { 19, 7, 290, 1, 18, 34, 2792 }, // U+2057
-    { 19, 20, 329, 1, 19, 95, 2826 }, // U+2058
-    { 19, 20, 332, 1, 19, 95, 2921 }, // U+2059
-    { 4, 20, 88, 1, 19, 20, 3016 }, // U+205A
-    { 15, 20, 262, 1, 19, 75, 3036 }, // U+205B
-    { 19, 20, 318, 0, 19, 95, 3111 }, // U+205C
-    { 4, 19, 107, 1, 18, 19, 3206 }, // U+205D
-    { 4, 20, 107, 2, 19, 20, 3225 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 3245 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2064
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2066
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2067
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2068
-    { 0, 0, 240, 0, 0, 0, 3245 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 3245 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3278 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3311 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3344 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3377 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3410 }, // U+206F
+    { 12, 3, 192, 0, 8, 9, 4208 }, // U+2013
+    { 24, 3, 384, 0, 8, 18, 4217 }, // U+2014
+    { 24, 3, 384, 0, 8, 18, 97 }, // U+2015
+    { 9, 26, 220, 3, 19, 59, 115 }, // U+2016
+    { 12, 6, 158, -3, 0, 18, 174 }, // U+2017
+    { 6, 7, 70, 1, 18, 11, 192 }, // U+2018
+    { 6, 7, 70, 1, 18, 11, 4235 }, // U+2019
+    { 6, 7, 97, -2, 3, 11, 203 }, // U+201A
+    { 4, 7, 70, 2, 18, 7, 214 }, // U+201B
+    { 11, 7, 143, 1, 18, 20, 4246 }, // U+201C
+    { 11, 7, 143, 1, 18, 20, 4266 }, // U+201D
+    { 11, 7, 170, -2, 3, 20, 221 }, // U+201E
+    { 8, 7, 143, 2, 18, 14, 241 }, // U+201F
+    { 10, 19, 188, 2, 19, 48, 255 }, // U+2020
+    { 13, 19, 188, 0, 19, 62, 303 }, // U+2021
+    { 6, 7, 150, 2, 13, 11, 365 }, // U+2022
+    { 8, 8, 147, 1, 13, 16, 376 }, // U+2023
+    { 4, 5, 200, 3, 4, 5, 392 }, // U+2024
+    { 10, 5, 203, 0, 4, 13, 397 }, // U+2025
+    { 17, 5, 308, 0, 4, 22, 4286 }, // U+2026
+    { 4, 5, 102, 1, 9, 5, 410 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 415 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 415 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 415 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 450 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 485 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 518 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 551 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 584 }, // U+202F
+    { 26, 20, 450, 2, 19, 130, 584 }, // U+2030
+    { 34, 20, 581, 2, 19, 170, 714 }, // U+2031
+    { 7, 7, 88, 1, 18, 13, 884 }, // U+2032
+    { 11, 7, 156, 1, 18, 20, 897 }, // U+2033
+    { 15, 7, 223, 1, 18, 27, 917 }, // U+2034
+    { 4, 7, 108, 3, 18, 7, 944 }, // U+2035
+    { 8, 7, 170, 3, 18, 14, 951 }, // U+2036
+    { 12, 7, 231, 3, 18, 21, 965 }, // U+2037
+    { 10, 9, 160, -3, 3, 23, 986 }, // U+2038
+    { 6, 11, 115, 1, 12, 17, 1009 }, // U+2039
+    { 7, 11, 115, 0, 12, 20, 1026 }, // U+203A
+    { 19, 20, 335, 1, 19, 95, 1046 }, // U+203B
+    { 13, 19, 198, 0, 18, 62, 1141 }, // U+203C
+    { 11, 20, 172, 1, 19, 55, 1203 }, // U+203D
+    { 11, 2, 157, 2, 21, 6, 1258 }, // U+203E
+    { 14, 6, 217, -2, 0, 21, 1264 }, // U+203F
+    { 13, 6, 217, 2, 20, 20, 1285 }, // U+2040
+    { 12, 17, 136, -3, 11, 51, 1305 }, // U+2041
+    { 27, 24, 447, 0, 20, 162, 1356 }, // U+2042
+    { 7, 3, 114, 0, 8, 6, 1518 }, // U+2043
+    { 16, 18, 52, -6, 18, 72, 1524 }, // U+2044
+    { 11, 22, 116, -1, 18, 61, 1596 }, // U+2045
+    { 10, 22, 116, -2, 18, 55, 1657 }, // U+2046
+    { 22, 20, 344, 1, 19, 110, 1712 }, // U+2047
+    { 17, 20, 276, 1, 19, 85, 1822 }, // U+2048
+    { 18, 20, 276, 0, 19, 90, 1907 }, // U+2049
+    { 13, 14, 208, 1, 14, 46, 1997 }, // U+204A
+    { 13, 23, 240, 2, 19, 75, 2043 }, // U+204B
+    { 13, 14, 256, 1, 14, 46, 2118 }, // U+204C
+    { 13, 14, 256, 2, 14, 46, 2164 }, // U+204D
+    { 13, 13, 220, -1, 7, 43, 2210 }, // U+204E
+    { 6, 18, 102, 0, 14, 27, 2253 }, // U+204F
+    { 17, 26, 217, -2, 20, 111, 2280 }, // U+2050
+    { 15, 26, 220, 0, 20, 98, 2391 }, // U+2051
+    { 10, 20, 149, 0, 19, 50, 2489 }, // U+2052
+    { 22, 5, 400, 2, 10, 28, 2539 }, // U+2053
+    { 14, 6, 217, -3, 0, 21, 2567 }, // U+2054
+    { 14, 14, 229, 0, 13, 49, 2588 }, // U+2055
+    { 11, 20, 207, 1, 19, 55, 2637 }, // U+2056
+    { 19, 7, 290, 1, 18, 34, 2692 }, // U+2057
+    { 19, 20, 329, 1, 19, 95, 2726 }, // U+2058
+    { 19, 20, 332, 1, 19, 95, 2821 }, // U+2059
+    { 4, 20, 88, 1, 19, 20, 2916 }, // U+205A
+    { 15, 20, 262, 1, 19, 75, 2936 }, // U+205B
+    { 19, 20, 318, 0, 19, 95, 3011 }, // U+205C
+    { 4, 19, 107, 1, 18, 19, 3106 }, // U+205D
+    { 4, 20, 107, 2, 19, 20, 3125 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 3145 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2064
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2066
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2067
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2068
+    { 0, 0, 240, 0, 0, 0, 3145 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 3145 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 3178 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 3211 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 3244 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 3277 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3310 }, // U+206F
     { 9, 12, 141, 2, 22, 27, 0 }, // U+2070
     { 4, 12, 89, 2, 19, 12, 27 }, // U+2071
     { 9, 12, 141, 1, 22, 27, 39 }, // U+2074
@@ -2836,13 +2842,13 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 17, 21, 235, -1, 21, 90, 2439 }, // U+20BE
     { 13, 24, 220, 1, 21, 78, 2529 }, // U+20BF
     { 7, 3, 125, 0, 8, 6, 0 }, // U+2212
-    { 23, 26, 255, -3, 20, 150, 0 }, // U+FB00
-    { 18, 26, 230, -3, 20, 117, 150 }, // U+FB01
-    { 18, 26, 230, -3, 20, 117, 267 }, // U+FB02
-    { 26, 26, 358, -3, 20, 169, 384 }, // U+FB03
-    { 26, 26, 358, -3, 20, 169, 553 }, // U+FB04
-    { 21, 26, 246, -4, 20, 137, 722 }, // U+FB05
-    { 20, 21, 306, 0, 20, 105, 859 }, // U+FB06
+    { 23, 26, 255, -3, 20, 150, 4308 }, // U+FB00
+    { 18, 26, 230, -3, 20, 117, 4458 }, // U+FB01
+    { 18, 26, 230, -3, 20, 117, 4575 }, // U+FB02
+    { 26, 26, 358, -3, 20, 169, 4692 }, // U+FB03
+    { 26, 26, 358, -3, 20, 169, 4861 }, // U+FB04
+    { 21, 26, 246, -4, 20, 137, 0 }, // U+FB05
+    { 20, 21, 306, 0, 20, 105, 137 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -2850,8 +2856,7 @@ static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -2859,8 +2864,7 @@ static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -2870,19 +2874,57 @@ static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
 };
 
 static const EpdFontGroup notosans_12_italicGroups[] = {
-    { 0, 2966, 6019, 97, 0 },
-    { 2966, 2606, 6981, 96, 97 },
-    { 5572, 3288, 10874, 128, 193 },
-    { 8860, 3221, 9737, 96, 321 },
-    { 12081, 1062, 1548, 112, 417 },
-    { 13143, 8401, 21786, 256, 529 },
-    { 21544, 1843, 9104, 90, 785 },
-    { 23387, 1819, 3885, 111, 875 },
-    { 25206, 744, 1151, 42, 986 },
-    { 25950, 1729, 2844, 32, 1028 },
-    { 27679, 8, 6, 1, 1060 },
-    { 27687, 421, 1041, 7, 1061 },
-    { 28108, 97, 138, 1, 1068 },
+    { 0, 2618, 5642, 83, 2 },
+    { 2618, 744, 1328, 26, 0 },
+    { 3362, 2604, 6918, 95, 97 },
+    { 5966, 3288, 10874, 128, 193 },
+    { 9254, 3221, 9737, 96, 321 },
+    { 12475, 1062, 1548, 112, 417 },
+    { 13537, 8401, 21786, 256, 529 },
+    { 21938, 1843, 9104, 90, 785 },
+    { 23781, 1760, 3777, 105, 875 },
+    { 25541, 744, 1151, 42, 986 },
+    { 26285, 1729, 2844, 32, 1028 },
+    { 28014, 8, 6, 1, 1060 },
+    { 28022, 170, 261, 2, 1066 },
+    { 28192, 97, 138, 1, 1068 },
+};
+
+static const uint16_t notosans_12_italicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_12_italicKernLeftClasses[] = {
@@ -3934,18 +3976,81 @@ static const EpdLigaturePair notosans_12_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_12_italicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 1, 0 }, { 0x0003, 0, 1 }, { 0x0004, 2, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 3, 3 }, { 0x0009, 2, 2 }, // U+0020
+    { 0x000A, 4, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 13, 0 }, { 0x002E, 14, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 15, 0 }, { 0x0033, 10, 10 }, { 0x0034, 16, 0 }, { 0x0035, 0, 13 }, { 0x0036, 17, 14 }, { 0x0037, 18, 15 }, { 0x0038, 19, 16 }, { 0x0039, 19, 16 }, // U+0050
+    { 0x003A, 13, 17 }, { 0x003B, 20, 18 }, { 0x003C, 21, 19 }, { 0x003D, 4, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 22, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 20 }, { 0x0044, 24, 0 }, { 0x0045, 25, 21 }, { 0x0046, 0, 21 }, { 0x0047, 24, 21 }, { 0x0048, 26, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 0, 0 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 27, 0 }, { 0x004E, 0, 0 }, { 0x004F, 0, 25 }, { 0x0050, 0, 25 }, { 0x0051, 24, 21 }, // U+0068
+    { 0x0052, 24, 25 }, { 0x0053, 0, 21 }, { 0x0054, 28, 25 }, { 0x0055, 0, 26 }, { 0x0056, 29, 27 }, { 0x0057, 0, 25 }, { 0x0058, 30, 28 }, { 0x0059, 30, 28 }, // U+0070
+    { 0x005A, 27, 0 }, { 0x005B, 30, 28 }, { 0x005C, 0, 29 }, { 0x005D, 4, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 31, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 32, 30 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 33, 31 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 34, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 32 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 18, 15 }, { 0x009B, 18, 15 }, { 0x009C, 18, 15 }, { 0x009D, 18, 15 }, { 0x009E, 20, 18 }, { 0x009F, 15, 0 }, { 0x00A0, 0, 24 }, // U+00D8
+    { 0x00A1, 23, 21 }, { 0x00A2, 23, 20 }, { 0x00A3, 23, 20 }, { 0x00A4, 23, 20 }, { 0x00A5, 23, 20 }, { 0x00A6, 23, 20 }, { 0x00A7, 24, 20 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 24, 21 }, { 0x00AA, 24, 21 }, { 0x00AB, 24, 21 }, { 0x00AC, 24, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 0, 0 }, { 0x00B0, 35, 0 }, // U+00E8
+    { 0x00B1, 24, 0 }, { 0x00B2, 0, 25 }, { 0x00B3, 24, 21 }, { 0x00B4, 24, 21 }, { 0x00B5, 24, 21 }, { 0x00B6, 24, 21 }, { 0x00B7, 24, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 30, 28 }, { 0x00BF, 24, 0 }, { 0x00C0, 30, 28 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 23, 20 }, { 0x00C3, 7, 9 }, { 0x00C4, 23, 20 }, { 0x00C5, 7, 9 }, { 0x00C6, 23, 20 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 36, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 24, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 24, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 24, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 24, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 24, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 33 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 37, 34 }, { 0x00EB, 0, 0 }, { 0x00EC, 35, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 38, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 24 }, { 0x00F7, 13, 0 }, { 0x00F8, 27, 0 }, // U+0130
+    { 0x00F9, 27, 25 }, { 0x00FA, 14, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 14, 0 }, { 0x00FD, 0, 0 }, { 0x00FE, 14, 0 }, { 0x00FF, 36, 0 }, { 0x0100, 14, 0 }, // U+0138
+    { 0x0101, 0, 0 }, { 0x0102, 14, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 0, 25 }, { 0x0106, 0, 0 }, { 0x0107, 0, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 25 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 25 }, { 0x010D, 10, 10 }, { 0x010E, 24, 21 }, { 0x010F, 10, 10 }, { 0x0110, 24, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 24, 21 }, { 0x0113, 11, 10 }, { 0x0114, 24, 21 }, { 0x0115, 0, 0 }, { 0x0116, 28, 25 }, { 0x0117, 0, 0 }, { 0x0118, 28, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 28, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 26 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 26 }, { 0x0123, 17, 14 }, { 0x0124, 29, 27 }, { 0x0125, 17, 14 }, { 0x0126, 39, 27 }, { 0x0127, 17, 14 }, { 0x0128, 29, 27 }, // U+0160
+    { 0x0129, 18, 15 }, { 0x012A, 0, 25 }, { 0x012B, 18, 15 }, { 0x012C, 0, 25 }, { 0x012D, 18, 15 }, { 0x012E, 0, 25 }, { 0x012F, 18, 15 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 18, 15 }, { 0x0132, 0, 25 }, { 0x0133, 18, 15 }, { 0x0134, 0, 25 }, { 0x0135, 19, 16 }, { 0x0136, 30, 28 }, { 0x0137, 20, 18 }, { 0x0138, 30, 28 }, // U+0170
+    { 0x0139, 20, 18 }, { 0x013A, 21, 19 }, { 0x013B, 0, 29 }, { 0x013C, 21, 19 }, { 0x013D, 0, 29 }, { 0x013E, 21, 19 }, { 0x013F, 0, 29 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 35 }, { 0x0214, 45, 0 }, { 0x0215, 46, 36 }, { 0x0216, 47, 37 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 48, 38 }, { 0x021A, 44, 39 }, { 0x021B, 44, 0 }, { 0x021C, 49, 35 }, { 0x021D, 50, 0 }, { 0x021E, 0, 0 }, { 0x021F, 51, 40 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 52, 41 }, { 0x0222, 53, 0 }, { 0x0223, 54, 0 }, { 0x0224, 45, 0 }, { 0x0225, 55, 42 }, { 0x0226, 0, 0 }, { 0x0227, 50, 43 }, { 0x0228, 54, 44 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 50, 0 }, { 0x022C, 0, 39 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 56, 36 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 57, 0 }, { 0x0232, 46, 36 }, { 0x0233, 45, 35 }, { 0x0234, 51, 40 }, { 0x0235, 58, 45 }, { 0x0236, 50, 43 }, { 0x0237, 55, 0 }, { 0x0238, 0, 46 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 55, 0 }, { 0x023B, 44, 35 }, { 0x023C, 0, 0 }, { 0x023D, 44, 0 }, { 0x023E, 56, 44 }, { 0x023F, 56, 0 }, { 0x0240, 0, 47 }, // U+0428
+    { 0x0241, 59, 48 }, { 0x0242, 60, 49 }, { 0x0243, 61, 48 }, { 0x0244, 62, 50 }, { 0x0245, 63, 51 }, { 0x0246, 62, 48 }, { 0x0247, 64, 52 }, { 0x0248, 61, 50 }, // U+0430
+    { 0x0249, 59, 53 }, { 0x024A, 59, 53 }, { 0x024B, 65, 54 }, { 0x024C, 59, 55 }, { 0x024D, 59, 54 }, { 0x024E, 59, 54 }, { 0x024F, 66, 48 }, { 0x0250, 67, 54 }, // U+0438
+    { 0x0251, 66, 54 }, { 0x0252, 64, 48 }, { 0x0253, 67, 54 }, { 0x0254, 68, 56 }, { 0x0255, 66, 48 }, { 0x0256, 65, 57 }, { 0x0257, 69, 53 }, { 0x0258, 59, 58 }, // U+0440
+    { 0x0259, 59, 53 }, { 0x025A, 69, 53 }, { 0x025B, 70, 59 }, { 0x025C, 59, 53 }, { 0x025D, 70, 53 }, { 0x025E, 66, 52 }, { 0x025F, 66, 54 }, { 0x0260, 59, 60 }, // U+0448
+    { 0x0261, 62, 48 }, { 0x0262, 62, 48 }, { 0x0263, 71, 61 }, { 0x0264, 62, 50 }, { 0x0265, 64, 48 }, { 0x0266, 72, 62 }, { 0x0267, 0, 0 }, { 0x0268, 73, 63 }, // U+0450
+    { 0x0269, 74, 64 }, { 0x026A, 70, 55 }, { 0x026B, 70, 54 }, { 0x026C, 67, 61 }, { 0x026D, 65, 54 }, { 0x026E, 59, 53 }, { 0x026F, 75, 65 }, { 0x0270, 59, 53 }, // U+0458
+};
+
 static const EpdFontData notosans_12_italic = {
     notosans_12_italicBitmaps,
     notosans_12_italicGlyphs,
     notosans_12_italicIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notosans_12_italicGroups,
-    13,
-    nullptr,
+    14,
+    notosans_12_italicGlyphToGroup,
     notosans_12_italicKernLeftClasses,
     notosans_12_italicKernRightClasses,
     notosans_12_italicKernMatrix,
@@ -3955,4 +4060,8 @@ static const EpdFontData notosans_12_italic = {
     83,
     notosans_12_italicLigaturePairs,
     5,
+    notosans_12_italicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,1542 +3,1545 @@
  * name: notosans_12_regular
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_12_regular 12 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_12_regular 12 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_regularBitmaps[24467] = {
-    0xAD, 0x58, 0x3D, 0x6C, 0xDC, 0xC8, 0x15, 0x7E, 0x24, 0x65, 0x33, 0x30, 0x01, 0xD1, 0x85, 0x83,
-    0x24, 0x8E, 0x65, 0x36, 0xAE, 0x0E, 0xDA, 0x65, 0xAB, 0x00, 0xE4, 0xEE, 0x1C, 0x02, 0x24, 0x45,
-    0x8A, 0x28, 0xC0, 0xE9, 0xDA, 0x34, 0x29, 0x72, 0x46, 0x10, 0x37, 0x42, 0xB0, 0x07, 0x50, 0x5A,
-    0x02, 0x57, 0xA6, 0x38, 0xB9, 0xB8, 0x4B, 0xEB, 0x32, 0x96, 0x11, 0x48, 0xC5, 0x26, 0x21, 0xE0,
-    0x95, 0x96, 0xCE, 0x15, 0x57, 0x1E, 0x93, 0x83, 0xAB, 0x00, 0x39, 0xE6, 0xE2, 0xCA, 0x46, 0xE0,
-    0xF1, 0x79, 0x7C, 0x66, 0xAC, 0xDD, 0x9D, 0xFB, 0xDE, 0x90, 0xAB, 0x7F, 0xF9, 0x27, 0x09, 0x39,
-    0x6F, 0xC4, 0x25, 0xE7, 0xE7, 0xCD, 0x7B, 0xDF, 0xFB, 0x53, 0xA7, 0xD3, 0xE9, 0xC4, 0x2D, 0x5C,
-    0x8B, 0x57, 0xAE, 0x5C, 0x21, 0xEA, 0x74, 0x3B, 0x73, 0x49, 0x2B, 0x69, 0x45, 0xAD, 0xA5, 0xD6,
-    0xD2, 0x95, 0xA5, 0x2B, 0xD7, 0xBE, 0x45, 0x9E, 0x95, 0xD3, 0xBC, 0x0D, 0x72, 0x72, 0x5A, 0x70,
-    0x52, 0x5A, 0x74, 0xD2, 0x0B, 0xBB, 0x77, 0x6E, 0x07, 0x5A, 0x4F, 0xA9, 0xE7, 0x13, 0xAD, 0xCE,
-    0x13, 0x6D, 0x83, 0xE4, 0x02, 0xF5, 0xB5, 0xAE, 0x98, 0xAC, 0x22, 0x22, 0x3B, 0x5F, 0x02, 0xAD,
-    0x92, 0x93, 0x6F, 0x93, 0x93, 0x4A, 0xA2, 0x45, 0x6E, 0xD6, 0x68, 0x23, 0xD0, 0xE3, 0xCE, 0xAF,
-    0x7E, 0x99, 0x2C, 0x52, 0xDD, 0xBA, 0x43, 0xF2, 0xA6, 0x82, 0x46, 0x8A, 0x5A, 0x13, 0x5A, 0x0C,
-    0x69, 0x31, 0x40, 0xFF, 0x7E, 0x6B, 0xA7, 0xAF, 0xD5, 0xE5, 0x5D, 0x51, 0xCF, 0xA2, 0x4B, 0x64,
-    0x2E, 0xBF, 0xC4, 0x8F, 0x4E, 0x46, 0x3D, 0x5A, 0x5D, 0x24, 0x49, 0xDB, 0x0B, 0x56, 0x81, 0xAD,
-    0xC1, 0x97, 0x9C, 0xF7, 0x04, 0x9E, 0xC0, 0xCD, 0xF6, 0xC2, 0x62, 0x98, 0xF6, 0x16, 0x7B, 0x7B,
-    0x65, 0x67, 0xF8, 0xA4, 0x94, 0xFE, 0x3F, 0xBF, 0x64, 0x1E, 0x3E, 0x41, 0xE7, 0xFE, 0x30, 0xEF,
-    0x91, 0xEF, 0xA0, 0x6B, 0x31, 0x5F, 0x91, 0x55, 0x6C, 0xD3, 0x36, 0x7D, 0x2D, 0xAD, 0x92, 0xFA,
-    0x39, 0xED, 0x5F, 0x96, 0x2E, 0x88, 0xDC, 0x3D, 0x85, 0xDD, 0xD2, 0x0C, 0x1D, 0x25, 0xE8, 0x04,
-    0x3A, 0x2F, 0xAD, 0x88, 0x9C, 0xCF, 0x25, 0x0F, 0x49, 0xD1, 0x4D, 0x99, 0xA1, 0xC7, 0xC2, 0xA7,
-    0xAE, 0x5B, 0x5E, 0xA5, 0xC4, 0xAA, 0x62, 0xCA, 0x68, 0x3D, 0x41, 0x17, 0x28, 0xC2, 0xA1, 0x24,
-    0x75, 0x28, 0xAC, 0x28, 0xDC, 0x9B, 0xAC, 0x93, 0xAB, 0xCB, 0x20, 0x35, 0xCB, 0x27, 0x49, 0xB4,
-    0xB4, 0xB4, 0x74, 0xCD, 0x2E, 0xDC, 0xDC, 0x17, 0x01, 0xC5, 0x14, 0x11, 0x4F, 0x51, 0xB8, 0x25,
-    0x6E, 0xFE, 0x9B, 0x61, 0x76, 0x84, 0x2F, 0x21, 0x36, 0x77, 0x73, 0x1B, 0xB2, 0x0C, 0xC0, 0x81,
-    0x9B, 0x3B, 0x85, 0x5D, 0x5A, 0xB3, 0x41, 0x03, 0xDC, 0x66, 0x92, 0x25, 0xED, 0xD2, 0xC1, 0x6A,
-    0x5E, 0x1A, 0x60, 0x16, 0x73, 0x1B, 0x71, 0x13, 0x4B, 0x73, 0xD3, 0xF7, 0xA7, 0x23, 0xE8, 0x68,
-    0x42, 0xD6, 0x63, 0x72, 0x3E, 0xCD, 0xFD, 0x0F, 0x4A, 0x0F, 0xF2, 0x22, 0x23, 0xD0, 0xE8, 0xA0,
-    0x6D, 0xEE, 0x6E, 0x6A, 0xAD, 0x0F, 0xBF, 0xE1, 0x46, 0xD4, 0x8E, 0xA3, 0x64, 0x20, 0x69, 0xF3,
-    0x96, 0x96, 0x2B, 0xCB, 0x06, 0x18, 0xD0, 0x25, 0xA4, 0x00, 0xAE, 0xC0, 0x10, 0xB5, 0xCC, 0xB0,
-    0x1E, 0x81, 0x07, 0xB0, 0x64, 0x97, 0xFC, 0xD1, 0xC5, 0x77, 0xC1, 0xDF, 0xAF, 0x12, 0xF8, 0xE7,
-    0xEF, 0xD9, 0x4C, 0xA8, 0x29, 0x79, 0x5A, 0x52, 0x20, 0x86, 0xF8, 0xC0, 0x87, 0x6E, 0x83, 0xD3,
-    0x00, 0xD3, 0x7D, 0x0C, 0x39, 0x4A, 0x3D, 0x23, 0x73, 0x3E, 0x4C, 0x60, 0xC6, 0x06, 0x2C, 0xCC,
-    0x47, 0x8A, 0x6C, 0x5D, 0xD4, 0x8B, 0x45, 0xD6, 0xC4, 0x9B, 0x74, 0xE3, 0x28, 0xA6, 0xB3, 0x6F,
-    0xB3, 0x67, 0x49, 0xC0, 0x1A, 0x78, 0x59, 0x27, 0xC3, 0x31, 0x33, 0x66, 0xFE, 0xB6, 0xC9, 0xB0,
-    0xC7, 0xCC, 0xD9, 0x50, 0x27, 0xB8, 0x36, 0xAF, 0x21, 0x3A, 0xEB, 0xD0, 0xCF, 0xAE, 0xD6, 0x39,
-    0x13, 0x1E, 0x3D, 0x9D, 0x02, 0x8E, 0x4B, 0x60, 0x84, 0xCF, 0x54, 0x9F, 0x6C, 0x48, 0xAE, 0x74,
-    0xB4, 0xB0, 0x47, 0x92, 0x9F, 0x79, 0xCD, 0xC0, 0xB4, 0x4E, 0x4A, 0xC3, 0xE9, 0x1D, 0xD5, 0xD7,
-    0x1B, 0xB5, 0xBE, 0x41, 0x63, 0xE0, 0x06, 0xE4, 0x32, 0x92, 0x58, 0xBA, 0xA0, 0x41, 0x44, 0x56,
-    0x19, 0x41, 0x66, 0x11, 0x24, 0x16, 0x81, 0xC7, 0xC8, 0xDC, 0x30, 0x1E, 0xC9, 0x54, 0xAB, 0xE0,
-    0x80, 0x02, 0x5D, 0xA1, 0xB5, 0x8D, 0xD4, 0x5B, 0x33, 0x0E, 0xBA, 0x3A, 0xED, 0x6A, 0x45, 0x16,
-    0x96, 0xEE, 0x10, 0xD0, 0x32, 0x63, 0x60, 0x99, 0x86, 0xFD, 0x2D, 0x15, 0xEA, 0x74, 0x06, 0x69,
-    0xA0, 0xD0, 0xD6, 0x19, 0x79, 0x45, 0x2D, 0x82, 0x76, 0xB3, 0x2C, 0xB3, 0xD6, 0x1B, 0x95, 0x74,
-    0xF7, 0xE1, 0x98, 0x76, 0xB1, 0xC4, 0x10, 0xB3, 0x0F, 0x14, 0xE0, 0x1B, 0xD1, 0xB3, 0x0A, 0xBC,
-    0x47, 0x55, 0x6D, 0x15, 0xB8, 0x46, 0x40, 0x0A, 0xA3, 0xA5, 0x16, 0x51, 0xDC, 0xAC, 0xC2, 0x5A,
-    0x06, 0xCF, 0x00, 0x01, 0xA3, 0x80, 0x31, 0x02, 0xC0, 0x1E, 0x1D, 0xA2, 0x6A, 0xE1, 0x3A, 0x65,
-    0x2D, 0x60, 0xBE, 0x58, 0xA1, 0xFE, 0x1E, 0x2C, 0x84, 0xD6, 0x30, 0xAC, 0x4D, 0x2C, 0x06, 0xA3,
-    0x70, 0x80, 0xC4, 0x7D, 0x2E, 0x0D, 0x68, 0x5C, 0x03, 0x9A, 0x31, 0xBE, 0x85, 0x33, 0xB0, 0x88,
-    0x9A, 0xB7, 0x90, 0x02, 0xF0, 0x0D, 0xC3, 0x9A, 0x9D, 0xD2, 0xD6, 0xA9, 0xAF, 0x65, 0x87, 0xAA,
-    0x84, 0xA2, 0x8C, 0xDA, 0x03, 0x0A, 0x06, 0xE4, 0x67, 0x14, 0xAE, 0x51, 0x3F, 0xFC, 0xF8, 0xB1,
-    0xA7, 0x7F, 0x4E, 0xCB, 0x57, 0x67, 0xB0, 0xCD, 0xA0, 0xF8, 0xCB, 0x5B, 0x79, 0xC0, 0x36, 0x4C,
-    0xDF, 0xEB, 0x76, 0xBF, 0xDB, 0xAC, 0xC1, 0x28, 0xBF, 0x20, 0xFC, 0xDC, 0xCF, 0xCF, 0xD3, 0xD1,
-    0xCB, 0x87, 0xA1, 0x07, 0x86, 0xC9, 0xA5, 0xFD, 0x77, 0x2E, 0xA8, 0x8F, 0x3F, 0x38, 0x5B, 0x5F,
-    0xCC, 0xFE, 0xD0, 0x0E, 0x0B, 0xA7, 0x64, 0x07, 0x81, 0x1F, 0x9E, 0x62, 0xA1, 0x35, 0x63, 0x67,
-    0x12, 0xBC, 0xBE, 0xB9, 0x49, 0x47, 0x7E, 0xDE, 0xE6, 0xA7, 0x5B, 0xA0, 0xDD, 0xFD, 0xB9, 0x8C,
-    0xBA, 0xB2, 0x79, 0xC3, 0x7B, 0xC0, 0xF7, 0x8C, 0x04, 0x7B, 0x16, 0xF3, 0xE6, 0xD6, 0x01, 0x63,
-    0xDF, 0x9F, 0x62, 0x8D, 0xE2, 0x1A, 0x03, 0x79, 0xD6, 0xA0, 0x07, 0x2F, 0xA7, 0x2E, 0x51, 0xC5,
-    0x32, 0x87, 0xCD, 0x5B, 0xC5, 0x4C, 0x46, 0x30, 0x53, 0xC9, 0x8D, 0xC0, 0x9B, 0x35, 0x7A, 0xC0,
-    0xDB, 0x69, 0x8D, 0xE7, 0x09, 0xA3, 0xC3, 0x29, 0x58, 0x4F, 0xB0, 0x60, 0xA3, 0x8A, 0xD1, 0x83,
-    0x05, 0xF8, 0xFA, 0x17, 0xD5, 0x3C, 0x45, 0xBE, 0x58, 0xF5, 0x89, 0x9B, 0x47, 0xAB, 0x57, 0x69,
-    0xE0, 0xD1, 0xA0, 0x45, 0x03, 0x9F, 0x06, 0x0B, 0xA4, 0xE6, 0x69, 0x35, 0x20, 0xB5, 0x80, 0x48,
-    0xF0, 0xBB, 0x1D, 0x08, 0xDE, 0x99, 0xFA, 0x12, 0x32, 0xBE, 0x68, 0xD5, 0x50, 0x03, 0xE3, 0x05,
-    0xCD, 0xF1, 0x79, 0x3E, 0x1E, 0x9A, 0xBD, 0xD4, 0x3E, 0xDF, 0x06, 0x28, 0x38, 0x21, 0xC6, 0xD3,
-    0xD5, 0x01, 0x80, 0xD2, 0xAB, 0x2D, 0x23, 0x83, 0x86, 0x54, 0x00, 0xC6, 0x7D, 0x61, 0x97, 0x5E,
-    0xEA, 0x3C, 0xBC, 0x93, 0xBB, 0x5A, 0x17, 0xFE, 0x47, 0xEF, 0x4A, 0xE0, 0x49, 0x02, 0xBC, 0x19,
-    0xBB, 0x39, 0x60, 0x2A, 0xC6, 0x62, 0x61, 0x7F, 0xBA, 0x81, 0xF3, 0x8F, 0xA1, 0xD1, 0x11, 0x7B,
-    0x5E, 0x03, 0x90, 0xDA, 0x93, 0x04, 0xB4, 0xB3, 0x32, 0xC4, 0xB7, 0x92, 0x76, 0x37, 0x27, 0xFC,
-    0x1B, 0xEF, 0x3D, 0xB8, 0x74, 0x2F, 0xAF, 0x89, 0xDD, 0x7B, 0x57, 0x8C, 0xF4, 0xC4, 0x8C, 0x31,
-    0x57, 0xA0, 0x37, 0x2C, 0x58, 0x1F, 0x34, 0xB9, 0xE1, 0xE7, 0xC6, 0xA4, 0xD8, 0xB2, 0xF6, 0x8D,
-    0xE5, 0x38, 0x31, 0xB6, 0x79, 0x0C, 0xBB, 0x76, 0x3E, 0x8A, 0xAD, 0xB7, 0x0A, 0xBA, 0x61, 0x3C,
-    0x06, 0xD5, 0x7C, 0x61, 0x5F, 0x6B, 0xC4, 0xFB, 0x16, 0x19, 0xA4, 0x9E, 0xE1, 0x54, 0x30, 0x15,
-    0x05, 0xAA, 0x40, 0x59, 0x43, 0x55, 0xFD, 0x8E, 0xBF, 0xF1, 0x18, 0xE6, 0xAD, 0xDF, 0xF0, 0xB5,
-    0x01, 0x8F, 0xA0, 0x46, 0x9A, 0x67, 0x1C, 0x6E, 0x3B, 0x2B, 0xCB, 0x23, 0x2D, 0x77, 0x37, 0x6F,
-    0x1D, 0x7B, 0x9F, 0x31, 0x9E, 0x78, 0xFC, 0xA9, 0xB3, 0xD0, 0x30, 0x05, 0x13, 0x31, 0xFD, 0xE4,
-    0xA7, 0x6C, 0x86, 0x27, 0xFD, 0x00, 0x16, 0x3E, 0x76, 0x2A, 0xFA, 0xC5, 0xE9, 0x32, 0xF8, 0xF6,
-    0x3B, 0x09, 0x75, 0x27, 0x09, 0x5D, 0xDE, 0x61, 0x1D, 0x40, 0x06, 0x31, 0xC6, 0xC4, 0x7E, 0x4A,
-    0x31, 0xE4, 0x16, 0x5B, 0xFA, 0xD1, 0x84, 0x42, 0x5D, 0xF1, 0x52, 0xD0, 0x28, 0x9F, 0xF7, 0x54,
-    0xDA, 0x59, 0x59, 0x91, 0xC0, 0x3E, 0x0E, 0xB1, 0x79, 0xE6, 0x98, 0x19, 0xE1, 0x30, 0x25, 0xEC,
-    0xEF, 0xCC, 0xFB, 0x46, 0xA9, 0x39, 0x20, 0x66, 0xAF, 0x71, 0xAB, 0x1F, 0x4B, 0x5D, 0x6C, 0x82,
-    0x33, 0x46, 0x42, 0x68, 0x42, 0x6D, 0x06, 0x1B, 0xC9, 0x00, 0xD3, 0x0C, 0x2E, 0x2B, 0xC3, 0x71,
-    0x32, 0xF0, 0x7E, 0x97, 0xCD, 0x0D, 0x86, 0xBC, 0x83, 0xA3, 0x65, 0x38, 0x9A, 0xF9, 0x0E, 0x13,
-    0xCB, 0x88, 0x91, 0xD6, 0x99, 0xA1, 0x09, 0xB9, 0x04, 0x65, 0x6F, 0xD2, 0x1A, 0xED, 0x00, 0xFD,
-    0x12, 0xD6, 0xEC, 0xA9, 0x11, 0xA2, 0xA9, 0xBA, 0x9B, 0xD3, 0x55, 0xF5, 0xE7, 0x82, 0x5A, 0xEA,
-    0x8F, 0x92, 0x22, 0x85, 0x98, 0xDB, 0x53, 0xC0, 0x85, 0x54, 0x59, 0x62, 0xA1, 0x8B, 0xED, 0x42,
-    0x65, 0x6D, 0x27, 0x57, 0x99, 0xEF, 0xA6, 0xE8, 0x7E, 0x2A, 0x54, 0xE6, 0x7E, 0x06, 0xC4, 0x38,
-    0xFF, 0x46, 0x67, 0x8F, 0xD1, 0x59, 0x15, 0x03, 0x08, 0xE9, 0xC0, 0x1A, 0xD2, 0x31, 0x78, 0x9B,
-    0x0C, 0xEB, 0x66, 0x58, 0x36, 0xFB, 0x13, 0x58, 0x1E, 0x20, 0xA3, 0x18, 0x20, 0xC7, 0x18, 0x74,
-    0x81, 0x36, 0x18, 0x47, 0x06, 0x80, 0x65, 0x4E, 0x89, 0x1D, 0x78, 0x97, 0x61, 0x0F, 0xE7, 0x01,
-    0x05, 0x78, 0xF6, 0x80, 0x44, 0x07, 0x64, 0x55, 0x4D, 0xDC, 0x80, 0x67, 0x60, 0x7B, 0x20, 0xB7,
-    0x44, 0x90, 0x81, 0x18, 0x3A, 0x75, 0x94, 0x89, 0x39, 0x37, 0x02, 0x20, 0xBC, 0x3C, 0x61, 0x6F,
-    0x7E, 0xB2, 0xF3, 0x72, 0x33, 0xC4, 0x0C, 0x0E, 0x04, 0xA6, 0x79, 0xBC, 0x00, 0xCC, 0x03, 0xB6,
-    0x7E, 0x63, 0x16, 0x97, 0xFA, 0x53, 0xC1, 0x18, 0xB5, 0xC6, 0x19, 0xA7, 0x74, 0x21, 0xB3, 0x40,
-    0xED, 0x8C, 0x62, 0xBC, 0x01, 0x46, 0x47, 0x53, 0x71, 0x36, 0x46, 0xFF, 0x6F, 0x9C, 0x75, 0x4F,
-    0x72, 0x86, 0xB7, 0x64, 0x42, 0x25, 0xD9, 0xC6, 0x59, 0x4D, 0xB8, 0xBB, 0xC4, 0xDC, 0xB2, 0xF6,
-    0x80, 0x96, 0x19, 0x02, 0xC2, 0xC6, 0xDF, 0xB4, 0x41, 0x31, 0xED, 0xBC, 0x5B, 0xB1, 0x1F, 0xA6,
-    0xDD, 0x2D, 0x46, 0x4B, 0xDE, 0xA0, 0xA5, 0x4E, 0xE6, 0x0E, 0x23, 0xC6, 0x04, 0xAA, 0x07, 0x9C,
-    0x03, 0xD3, 0xA5, 0xC4, 0x98, 0x54, 0x52, 0x87, 0xEF, 0x82, 0x5C, 0x38, 0x7D, 0x84, 0x63, 0x76,
-    0xF5, 0x6B, 0xC6, 0xB9, 0xC0, 0xD7, 0xC5, 0x08, 0xE6, 0xA3, 0x2D, 0xD8, 0x73, 0x5A, 0xC7, 0x8A,
-    0x12, 0xC1, 0xB7, 0xDC, 0x4F, 0x66, 0xFE, 0x4B, 0x82, 0xB7, 0x95, 0xD5, 0x1B, 0x10, 0xFB, 0xA6,
-    0x21, 0x08, 0xF9, 0x4A, 0x11, 0x72, 0x74, 0x7C, 0xA1, 0x71, 0x88, 0x1A, 0x24, 0x58, 0xAB, 0x07,
-    0xD7, 0x5E, 0x41, 0xE8, 0x88, 0xBD, 0x36, 0x7C, 0xB4, 0x53, 0x70, 0xDA, 0xEA, 0xA5, 0x5E, 0xCA,
-    0x29, 0xAE, 0x53, 0x04, 0x88, 0x3A, 0x6D, 0xCC, 0xC6, 0x81, 0x54, 0x52, 0x7B, 0xBC, 0x08, 0xD2,
-    0xEE, 0x80, 0x42, 0xF6, 0xFF, 0xB9, 0x21, 0xF6, 0xCD, 0xD4, 0x4B, 0xF8, 0x11, 0x89, 0x74, 0x50,
-    0x90, 0xEA, 0x50, 0x1B, 0xE9, 0x6E, 0x48, 0xB1, 0xE4, 0x55, 0x23, 0xE5, 0xC0, 0x07, 0xF4, 0x32,
-    0x27, 0xF7, 0x53, 0x15, 0xB9, 0xB9, 0x9B, 0xCB, 0x08, 0xD1, 0xE1, 0x9E, 0x6C, 0x63, 0x8F, 0xBF,
-    0x15, 0x81, 0x4F, 0xF6, 0xBF, 0x72, 0x1F, 0x71, 0xE3, 0x69, 0xEE, 0xFD, 0x9A, 0xE8, 0x79, 0xEA,
-    0xFE, 0x81, 0x68, 0x4F, 0x70, 0xDE, 0x35, 0x32, 0xD9, 0xD7, 0x3A, 0xD9, 0x95, 0x91, 0xAA, 0x22,
-    0xCE, 0xBD, 0x42, 0xE6, 0x53, 0x30, 0x8F, 0xCC, 0x5F, 0x5C, 0x7B, 0xE5, 0x35, 0xF0, 0xD4, 0x2D,
-    0x6A, 0x9E, 0x82, 0xBC, 0xE6, 0xB1, 0x42, 0x86, 0x25, 0x13, 0x8C, 0x6E, 0x83, 0x43, 0x4E, 0xD9,
-    0x19, 0x42, 0x4E, 0x39, 0x34, 0xFE, 0x7A, 0xFF, 0x4B, 0xEE, 0x13, 0xAF, 0xC6, 0xAB, 0xA2, 0xF4,
-    0x31, 0x5E, 0x1E, 0x73, 0xD7, 0x71, 0xBE, 0x6E, 0x5E, 0x07, 0x88, 0x97, 0xE8, 0x23, 0xDC, 0xCF,
-    0x34, 0x81, 0x64, 0xE3, 0x71, 0x39, 0xB2, 0x54, 0x75, 0x76, 0xCA, 0x41, 0xF9, 0x15, 0xAF, 0x31,
-    0xB7, 0x60, 0x02, 0x3A, 0x4A, 0x49, 0xAF, 0xBE, 0x79, 0xDC, 0xC0, 0x00, 0xAF, 0x06, 0x99, 0x6F,
-    0xD2, 0x35, 0x80, 0x16, 0x31, 0x19, 0x19, 0x02, 0xE7, 0x69, 0xCA, 0x18, 0x5B, 0x9D, 0xEC, 0x06,
-    0x66, 0x04, 0xD4, 0xE3, 0xE6, 0x7D, 0xD9, 0x7F, 0x9D, 0x0D, 0xA4, 0x19, 0x37, 0xDF, 0x58, 0x13,
-    0x4B, 0xE0, 0x37, 0x60, 0x57, 0x22, 0x17, 0xC1, 0xBE, 0x9C, 0xF3, 0xBA, 0x69, 0x8B, 0x3C, 0xAC,
-    0x3A, 0x8F, 0x6C, 0xA3, 0x85, 0x37, 0xA8, 0xEF, 0x04, 0x4E, 0xC0, 0x27, 0x21, 0x4E, 0xA7, 0x3B,
-    0x60, 0xC8, 0x4E, 0xE9, 0xBA, 0x40, 0x46, 0x37, 0xFF, 0x76, 0xB5, 0x5F, 0xD6, 0xD8, 0x7A, 0x1C,
-    0x3E, 0x1C, 0xAE, 0x51, 0x54, 0x01, 0x10, 0x34, 0x1C, 0x5A, 0xE3, 0xFE, 0xD6, 0x30, 0x98, 0x2C,
-    0xD6, 0x09, 0xE6, 0x91, 0x76, 0x5D, 0x3C, 0xC7, 0x39, 0xDF, 0x1E, 0x8F, 0x29, 0xAE, 0xA8, 0xAD,
-    0x38, 0x75, 0x6A, 0x1A, 0x32, 0xCE, 0x31, 0x75, 0x26, 0x34, 0xDC, 0x7B, 0xA4, 0x9E, 0xD4, 0x79,
-    0xED, 0x75, 0x81, 0x44, 0xD3, 0xBF, 0x7F, 0xAB, 0x43, 0x4D, 0x0D, 0xB5, 0xEF, 0x6F, 0x6A, 0x21,
-    0x41, 0xCA, 0xFE, 0x0B, 0x69, 0x37, 0x79, 0x02, 0xE7, 0xB6, 0xC7, 0xE8, 0x3D, 0x14, 0x68, 0xFA,
-    0x0B, 0x11, 0xDC, 0xD4, 0xA2, 0x83, 0xAC, 0x02, 0xF5, 0x0B, 0xA7, 0xA9, 0x22, 0x3B, 0x44, 0xFC,
-    0x1B, 0x99, 0xBC, 0xE8, 0xE2, 0xBB, 0xFF, 0x10, 0x95, 0x83, 0xFE, 0xAD, 0xA0, 0xD9, 0xE6, 0xA5,
-    0x7F, 0xB3, 0xEA, 0x50, 0x8C, 0xBA, 0x28, 0xA1, 0x10, 0x76, 0x8E, 0xB0, 0x78, 0xB0, 0xB9, 0x98,
-    0xF3, 0x5F, 0x0C, 0xAD, 0xC6, 0xE0, 0xE0, 0x38, 0x0B, 0x6B, 0x5A, 0x40, 0xFF, 0x4D, 0xC1, 0x75,
-    0x1F, 0x7E, 0x41, 0x7C, 0xE7, 0x3E, 0x3F, 0xBF, 0xBC, 0xD1, 0x7B, 0x16, 0xF2, 0xE5, 0xBF, 0xBF,
-    0x21, 0x93, 0x1F, 0x8A, 0x03, 0xAC, 0x06, 0x70, 0x84, 0xEB, 0x26, 0xBA, 0x7B, 0x48, 0x4D, 0x8E,
-    0x4B, 0xFC, 0x2D, 0xF1, 0xB5, 0x96, 0xFA, 0x67, 0x90, 0x38, 0xD4, 0x83, 0xE4, 0xEC, 0xCC, 0x36,
-    0x17, 0xC7, 0x73, 0x74, 0x29, 0x3E, 0x7C, 0xD1, 0x45, 0x53, 0xCD, 0x5E, 0xC4, 0x26, 0xCB, 0xE6,
-    0xE9, 0x25, 0xB7, 0x25, 0xFB, 0x65, 0x3F, 0x3D, 0xBE, 0x3B, 0x2D, 0x2B, 0x5B, 0x2A, 0x2F, 0x57,
-    0x21, 0xA9, 0x21, 0x3D, 0x93, 0xF4, 0xBC, 0x24, 0x04, 0x88, 0xF1, 0x90, 0x3D, 0x89, 0xF2, 0x85,
-    0x72, 0x73, 0x1E, 0x00, 0x7B, 0x3E, 0x79, 0x2D, 0x5F, 0x17, 0x97, 0xC5, 0x53, 0xFD, 0x25, 0xD8,
-    0xFF, 0xD1, 0xDE, 0xCD, 0x31, 0x97, 0x43, 0x38, 0x42, 0xC2, 0xCC, 0xBE, 0x41, 0x87, 0x55, 0xBE,
-    0x7A, 0x3D, 0x01, 0x40, 0xE5, 0xD0, 0x84, 0x22, 0xFF, 0xE6, 0x8E, 0x89, 0x5C, 0x91, 0x91, 0xBC,
-    0x49, 0x4E, 0x67, 0x09, 0x6A, 0x0A, 0x4D, 0xA4, 0x31, 0xA4, 0x1E, 0x22, 0x48, 0xF9, 0xA8, 0x74,
-    0xAC, 0x06, 0x7C, 0xD8, 0xE5, 0x69, 0xB3, 0xCB, 0xDA, 0xA9, 0xC0, 0x9E, 0x1A, 0x60, 0x3F, 0xD3,
-    0xC5, 0x09, 0x09, 0xFD, 0x2F, 0x08, 0x38, 0x95, 0x96, 0xDF, 0x7A, 0xA2, 0x9F, 0xDF, 0x9F, 0x22,
-    0x29, 0x3A, 0xA9, 0x26, 0xEB, 0x36, 0x80, 0x52, 0xAC, 0x9D, 0xCF, 0x07, 0xC6, 0x8E, 0x50, 0x83,
-    0x07, 0x5C, 0xC3, 0x0B, 0xF6, 0xED, 0xC6, 0xC9, 0x20, 0xBD, 0xDF, 0xDD, 0xCA, 0xFB, 0xA6, 0x04,
-    0x43, 0xB9, 0xE0, 0xC0, 0xBF, 0xA4, 0x14, 0x7C, 0xC4, 0x68, 0x46, 0x0F, 0x77, 0x73, 0x7A, 0x83,
-    0x97, 0x7A, 0x21, 0x2C, 0xAE, 0x59, 0x00, 0xC6, 0x73, 0x46, 0x74, 0xAF, 0x22, 0x2E, 0x29, 0x21,
-    0x46, 0x11, 0xE0, 0x38, 0x6E, 0x63, 0x75, 0xCB, 0x74, 0xAE, 0x39, 0x6E, 0x60, 0x8A, 0x4F, 0xA3,
-    0x04, 0x2E, 0x7B, 0x85, 0x82, 0xAD, 0xA0, 0x46, 0xBA, 0x57, 0x22, 0xA2, 0x14, 0x1C, 0x4F, 0x10,
-    0x47, 0x52, 0x53, 0x84, 0x71, 0x49, 0xF5, 0x0E, 0x76, 0x45, 0xE0, 0xDE, 0xE1, 0x5A, 0x65, 0x4A,
-    0x49, 0x6C, 0x3D, 0xA6, 0xAC, 0x6D, 0x7F, 0x81, 0x92, 0xC5, 0xF9, 0x34, 0x95, 0xBE, 0xF3, 0xC9,
-    0xBD, 0xD2, 0xFF, 0xC9, 0x07, 0x7F, 0x29, 0xBC, 0x0F, 0xED, 0xCF, 0x73, 0xF7, 0x33, 0x4C, 0x77,
-    0xFE, 0x81, 0x68, 0x84, 0x34, 0x6D, 0x24, 0x90, 0x3A, 0xF4, 0xD9, 0x81, 0x77, 0x0D, 0xE7, 0x21,
-    0xFF, 0x83, 0x07, 0xFC, 0x01, 0x97, 0x64, 0x7F, 0x05, 0x9F, 0xBB, 0x87, 0x9D, 0xBA, 0xC2, 0xEC,
-    0x42, 0xA3, 0x1C, 0x3B, 0xA3, 0x58, 0x83, 0x12, 0xFD, 0x34, 0x31, 0x95, 0x67, 0xCC, 0x02, 0x6F,
-    0xB8, 0x8E, 0x1A, 0xAE, 0x03, 0xF3, 0xB6, 0x86, 0x8E, 0xC3, 0x5C, 0xFF, 0x15, 0x3E, 0x16, 0x5C,
-    0x13, 0x73, 0x7D, 0x37, 0xAD, 0xD7, 0xEA, 0x36, 0x91, 0x23, 0xAA, 0x2B, 0x75, 0x76, 0xEF, 0xA3,
-    0xC2, 0x94, 0x93, 0x74, 0x6E, 0x65, 0x19, 0xD6, 0x7C, 0x6E, 0x45, 0xB1, 0x4A, 0xE0, 0x22, 0x7C,
-    0x4E, 0xD6, 0xD8, 0xED, 0x48, 0x0E, 0x30, 0x90, 0x35, 0x7C, 0x7F, 0x77, 0xF3, 0xF7, 0x5D, 0x14,
-    0x58, 0x17, 0x52, 0xEA, 0xA7, 0x1C, 0x7D, 0xA4, 0x29, 0x2A, 0x0F, 0x35, 0xD4, 0xF4, 0xA8, 0x7B,
-    0xB9, 0x02, 0x2E, 0x8F, 0x7F, 0xE2, 0x7A, 0x14, 0x53, 0xFA, 0xAC, 0xBA, 0xE8, 0xAC, 0x8B, 0x7E,
-    0x60, 0x62, 0x84, 0xDB, 0xE0, 0xE2, 0xE8, 0x02, 0x5C, 0xE3, 0xA5, 0x14, 0xE6, 0x4D, 0x2D, 0x7B,
-    0xA8, 0x31, 0xC7, 0x05, 0x4F, 0xC4, 0xD9, 0xCE, 0xE1, 0x2C, 0xFD, 0xFF, 0xB8, 0xF4, 0x6C, 0xA4,
-    0x49, 0x9C, 0xAF, 0xE8, 0x1B, 0xBD, 0x58, 0x3D, 0x8C, 0x1B, 0xC7, 0x15, 0x7E, 0xBB, 0x7B, 0xA7,
-    0x75, 0xB4, 0x08, 0xE7, 0x0A, 0x15, 0x12, 0xA4, 0xBB, 0x4D, 0xA1, 0x42, 0xB1, 0x79, 0xDC, 0xE6,
-    0x80, 0xB0, 0xE0, 0xCF, 0x28, 0x07, 0xB8, 0x48, 0x0A, 0x5F, 0x80, 0x28, 0x2E, 0x02, 0xD8, 0x6E,
-    0x23, 0xC0, 0xD1, 0x15, 0x87, 0x80, 0x01, 0x28, 0x71, 0xAD, 0x26, 0x85, 0x1B, 0x19, 0x41, 0xFA,
-    0x2B, 0x52, 0x44, 0x14, 0x10, 0x31, 0xC0, 0x21, 0xD8, 0xC4, 0xD4, 0x71, 0x25, 0x95, 0x69, 0xD6,
-    0x09, 0x8C, 0x14, 0x29, 0xB2, 0x8E, 0x8B, 0xC0, 0x12, 0x02, 0x0F, 0xEC, 0x75, 0xB0, 0x3A, 0x93,
-    0x9C, 0x7C, 0x6F, 0x96, 0xE4, 0xDD, 0xE9, 0xC7, 0xD1, 0x49, 0x94, 0x96, 0xF3, 0x86, 0x3B, 0x3B,
-    0x33, 0xEF, 0xBD, 0x79, 0xF3, 0xFE, 0x66, 0x4E, 0x36, 0x9B, 0xA7, 0x68, 0xE1, 0xCC, 0x99, 0x72,
-    0x79, 0x75, 0x75, 0xB5, 0x5E, 0x6F, 0x34, 0x1A, 0xDF, 0x25, 0x3C, 0x35, 0x2E, 0xB6, 0x4E, 0x85,
-    0x56, 0x81, 0xE4, 0x56, 0x9B, 0x28, 0x3A, 0x50, 0xD0, 0xAC, 0x13, 0x05, 0xE1, 0x3B, 0x9E, 0x56,
-    0xD6, 0x20, 0x2C, 0xC6, 0x4F, 0x1F, 0x7F, 0x4C, 0x34, 0xD0, 0xA1, 0x95, 0x59, 0x64, 0xA7, 0x44,
-    0x76, 0x72, 0x18, 0x5E, 0xDB, 0xFB, 0x2D, 0x35, 0x75, 0x7E, 0xE8, 0x9B, 0xC3, 0x10, 0x13, 0x09,
-    0x49, 0xE8, 0xD3, 0x09, 0x03, 0x30, 0x55, 0x2F, 0x2E, 0x07, 0x7A, 0x28, 0x64, 0xB6, 0x4C, 0xD5,
-    0x32, 0x95, 0x4D, 0xA9, 0x09, 0xDA, 0xF1, 0xEF, 0xE7, 0xF5, 0xC1, 0xBB, 0x4B, 0xF4, 0x4A, 0x0B,
-    0x14, 0xEA, 0x98, 0xE9, 0x93, 0x17, 0x0A, 0x29, 0xC8, 0x8D, 0x2B, 0xC0, 0x55, 0x23, 0x4B, 0x81,
-    0xC9, 0x4C, 0x11, 0x35, 0x12, 0x5A, 0xEC, 0x7C, 0x4C, 0x9E, 0xD6, 0x05, 0x72, 0x41, 0xE6, 0xBD,
-    0x68, 0xD3, 0x0C, 0x6A, 0xD3, 0xE7, 0xAC, 0x59, 0xC1, 0xD9, 0x59, 0x9B, 0x5B, 0x9E, 0x4E, 0x82,
-    0x1B, 0x69, 0xB1, 0xC4, 0x26, 0x86, 0x67, 0x24, 0xB4, 0xAC, 0x79, 0x69, 0x8B, 0x14, 0x4A, 0x9D,
-    0x94, 0xFF, 0xD7, 0xD4, 0xD6, 0x21, 0xF9, 0x09, 0xD9, 0x20, 0xA9, 0xA4, 0xA5, 0x76, 0x6F, 0x24,
-    0xC1, 0x58, 0x1A, 0x5C, 0xB5, 0x95, 0xDA, 0xCA, 0x54, 0x32, 0xA7, 0x31, 0x8A, 0x1E, 0xBC, 0x9E,
-    0xF3, 0x5A, 0x7D, 0x2A, 0xD1, 0x05, 0x27, 0x2E, 0xBB, 0xFA, 0xBD, 0x64, 0x4D, 0x9C, 0x97, 0xBD,
-    0xCD, 0x55, 0xA2, 0xCD, 0x1E, 0x68, 0xAC, 0x31, 0xAD, 0xAA, 0xA9, 0x4C, 0x73, 0x13, 0xA2, 0x5E,
-    0x5B, 0xF3, 0x89, 0x7A, 0x65, 0x4F, 0x87, 0x69, 0x89, 0xAE, 0x3B, 0xB1, 0x1B, 0x82, 0x6D, 0xEB,
-    0x81, 0xD5, 0x87, 0xB8, 0x8D, 0xA8, 0x0A, 0xC9, 0xE7, 0xA7, 0xDE, 0xA5, 0xD2, 0xB1, 0xDF, 0x57,
-    0xDE, 0xAA, 0x96, 0xAA, 0x2B, 0xC1, 0x78, 0x51, 0x52, 0xF8, 0x1D, 0x27, 0xC9, 0xBC, 0xAB, 0x69,
-    0xE0, 0xC5, 0x6D, 0x9F, 0xB2, 0x3A, 0xD5, 0x7C, 0xF2, 0xDD, 0xD8, 0xBB, 0xA3, 0xEC, 0x74, 0x87,
-    0xE4, 0x52, 0xB7, 0xDB, 0xD5, 0x13, 0x61, 0xCC, 0x8A, 0xD7, 0xDD, 0xD6, 0xEA, 0xC2, 0xC6, 0x63,
-    0x79, 0x5E, 0xFC, 0x31, 0x78, 0x16, 0xFA, 0x3C, 0x78, 0x3E, 0x1D, 0xF7, 0x36, 0x85, 0x13, 0x6F,
-    0xF6, 0x50, 0xAD, 0xA5, 0xE2, 0xA7, 0x61, 0x35, 0x15, 0x63, 0xF0, 0x2C, 0x56, 0xC0, 0xB3, 0x10,
-    0x72, 0x6D, 0x4D, 0xB8, 0x71, 0xAF, 0x2C, 0xEC, 0x24, 0x2D, 0x7D, 0x8B, 0x7E, 0xFD, 0x58, 0x9E,
-    0x5F, 0xED, 0x76, 0xAF, 0x61, 0xB3, 0x53, 0x16, 0x73, 0x4E, 0xF5, 0x9F, 0xD3, 0x96, 0x47, 0x3D,
-    0x57, 0xA2, 0x54, 0x05, 0xF9, 0x23, 0xB2, 0xAE, 0x11, 0x95, 0x0B, 0x85, 0x3C, 0x08, 0x03, 0xB0,
-    0x6C, 0xD8, 0xAE, 0x3D, 0xDA, 0xC7, 0xCF, 0xB4, 0xDF, 0x92, 0x41, 0x5E, 0x5D, 0x85, 0xA4, 0x4B,
-    0xC0, 0xB2, 0x63, 0x27, 0x9E, 0x5C, 0xA5, 0xCE, 0xF8, 0xD5, 0xEB, 0x96, 0xA4, 0x20, 0xA7, 0xB5,
-    0x0A, 0xA1, 0x83, 0x96, 0xE9, 0x78, 0x4E, 0xDE, 0x70, 0x5F, 0x00, 0xBB, 0xB7, 0xE8, 0x35, 0xE6,
-    0x48, 0x84, 0x01, 0x34, 0x7D, 0x9B, 0x36, 0xE8, 0x44, 0x46, 0xF5, 0x27, 0x15, 0xB0, 0x3D, 0xA4,
-    0x91, 0xBE, 0xF1, 0x9F, 0xAF, 0xC7, 0xCB, 0x19, 0xB4, 0xEE, 0x70, 0xB1, 0xB5, 0x0E, 0x7D, 0xFD,
-    0xF7, 0xB0, 0xA9, 0xAF, 0x86, 0x1D, 0xC0, 0xE0, 0x21, 0xE0, 0x6F, 0xDC, 0x17, 0x00, 0x3C, 0x00,
-    0xBD, 0x09, 0xB0, 0x9F, 0x02, 0xF8, 0x69, 0x34, 0x1B, 0x0B, 0x25, 0x5A, 0x81, 0xDA, 0xDB, 0xC9,
-    0x9B, 0xF1, 0x2E, 0xBE, 0xD8, 0x4A, 0xA8, 0x5A, 0x8F, 0xD4, 0xA1, 0xDF, 0x3B, 0xE8, 0x70, 0x73,
-    0x5A, 0x79, 0x9B, 0xAA, 0xAE, 0x5C, 0x73, 0x42, 0x94, 0xAA, 0x23, 0xCB, 0x1E, 0x09, 0x08, 0x78,
-    0x83, 0x5E, 0xB1, 0xA9, 0x22, 0x42, 0xB1, 0x9E, 0x40, 0x53, 0x2C, 0xD5, 0xA6, 0xA8, 0x81, 0xDA,
-    0xBD, 0xAD, 0xF0, 0xA5, 0x2E, 0xE4, 0x82, 0x05, 0x6B, 0x82, 0x98, 0x3C, 0x05, 0xE1, 0xD6, 0x15,
-    0x6D, 0xD1, 0x12, 0xE3, 0x24, 0xC5, 0x76, 0xAB, 0x1C, 0x30, 0xA2, 0xD8, 0x88, 0xD4, 0x32, 0x5E,
-    0x55, 0x4D, 0xC4, 0xA4, 0x7A, 0x41, 0x4C, 0x7F, 0x48, 0xBF, 0x17, 0x43, 0x63, 0x3E, 0x8D, 0xC9,
-    0xFD, 0xFE, 0xDD, 0x98, 0x84, 0xBB, 0x1E, 0x13, 0xD4, 0x26, 0xA3, 0xD6, 0xF1, 0x1B, 0x29, 0xA6,
-    0x3B, 0xE0, 0x98, 0xAB, 0x14, 0x48, 0x45, 0x4A, 0x3B, 0x54, 0x4F, 0x29, 0xA5, 0xA5, 0xD4, 0x86,
-    0x13, 0x48, 0xA1, 0x28, 0x94, 0x32, 0xD2, 0x74, 0x95, 0xAB, 0x6A, 0x27, 0xA4, 0xF4, 0x8B, 0x3D,
-    0x45, 0x9F, 0x24, 0xB2, 0x47, 0x40, 0xD9, 0x23, 0x4F, 0x12, 0xF3, 0x04, 0x1C, 0x35, 0x7E, 0xDF,
-    0x22, 0x0C, 0x54, 0xC0, 0x62, 0xC7, 0xF6, 0xDE, 0xB6, 0x1B, 0x3A, 0x5A, 0x15, 0xF6, 0x90, 0x91,
-    0x13, 0xFE, 0xF2, 0x32, 0x79, 0xBC, 0xCF, 0xB0, 0xC2, 0x15, 0x0C, 0x5F, 0xEC, 0x63, 0x9C, 0xC8,
-    0x79, 0x09, 0x15, 0xA6, 0x26, 0xDC, 0x30, 0x25, 0x21, 0x1C, 0xF5, 0xA7, 0xCB, 0xAB, 0x9E, 0xEA,
-    0x64, 0xD5, 0x65, 0x5E, 0x5C, 0x55, 0x91, 0x95, 0xF4, 0xC0, 0xE7, 0xED, 0x58, 0x91, 0xB7, 0xAE,
-    0x47, 0x54, 0xB2, 0xBB, 0x39, 0xAB, 0x17, 0x4B, 0x00, 0xD5, 0x49, 0xE3, 0x0B, 0x50, 0x4E, 0x19,
-    0x4A, 0x0B, 0xAC, 0x46, 0xAC, 0xA9, 0x6D, 0xB2, 0x32, 0x72, 0x13, 0xF2, 0x25, 0x7B, 0x48, 0xF8,
-    0xC9, 0x96, 0xA9, 0x9B, 0xE7, 0x7B, 0xBE, 0xCE, 0xEC, 0xDD, 0xC2, 0x27, 0x34, 0xA8, 0xF0, 0x46,
-    0x6E, 0xCC, 0xEB, 0x2B, 0x54, 0x96, 0xDD, 0x9F, 0x87, 0x77, 0x01, 0xF2, 0x2B, 0x3B, 0xF0, 0xAF,
-    0x2D, 0x76, 0x4B, 0xF0, 0xB6, 0x58, 0x5A, 0xE6, 0x63, 0x0F, 0x84, 0xB4, 0x53, 0x2F, 0x74, 0xEE,
-    0xDD, 0x88, 0x5D, 0x78, 0x47, 0xF1, 0x9B, 0x9F, 0x28, 0xB8, 0x04, 0x05, 0x15, 0x8E, 0xD8, 0x3F,
-    0xB3, 0x47, 0x86, 0xBA, 0x05, 0x05, 0xB2, 0xCB, 0x80, 0x9C, 0x8C, 0xFB, 0x75, 0xE4, 0xFC, 0xF1,
-    0x7B, 0x89, 0x91, 0x2D, 0xB5, 0xD1, 0x93, 0x7A, 0xF3, 0xC5, 0x0F, 0x7D, 0xA3, 0xC1, 0xBA, 0xB4,
-    0xEE, 0xC3, 0x7A, 0xC3, 0xD6, 0xFC, 0x79, 0x6F, 0x61, 0x5B, 0x5A, 0xAB, 0xB3, 0x60, 0x35, 0x37,
-    0xDC, 0x96, 0x2C, 0x70, 0x9C, 0xAB, 0xC2, 0x6F, 0x9F, 0x83, 0x3A, 0xEC, 0x14, 0x78, 0xE7, 0xC2,
-    0x77, 0x60, 0xE2, 0x61, 0xE1, 0x28, 0xA3, 0x9C, 0xD9, 0x56, 0x19, 0x5B, 0x7B, 0x9A, 0x99, 0x15,
-    0x70, 0xED, 0x85, 0x99, 0xD1, 0xAA, 0x07, 0x17, 0xE0, 0xDB, 0xE0, 0xFC, 0x62, 0xE8, 0xDF, 0xB8,
-    0x1B, 0xD2, 0x95, 0x2E, 0x7F, 0xD7, 0x30, 0x3D, 0xB2, 0xBE, 0xBA, 0x90, 0x99, 0x58, 0x9B, 0x19,
-    0xD5, 0xCB, 0xD8, 0xC3, 0x71, 0xED, 0x73, 0x7F, 0xDA, 0x30, 0x75, 0x61, 0x37, 0xFA, 0x9A, 0xA5,
-    0xB5, 0x72, 0x33, 0xBA, 0x06, 0x83, 0x36, 0x82, 0x6B, 0x4C, 0x9C, 0x6B, 0xFB, 0x31, 0x00, 0x89,
-    0x9A, 0x31, 0x7E, 0x58, 0x2C, 0xD7, 0xD6, 0x37, 0x13, 0xBA, 0x04, 0x0E, 0xA6, 0xA1, 0xDD, 0x8A,
-    0x8A, 0xD9, 0x8B, 0xF8, 0x17, 0x86, 0x84, 0x5B, 0xC4, 0x4A, 0xB4, 0xCF, 0x70, 0xB3, 0xA3, 0xB3,
-    0x81, 0xCE, 0xA2, 0xC3, 0x49, 0xC6, 0xAD, 0x0B, 0x1B, 0x03, 0xAD, 0x76, 0xBB, 0xDB, 0x0F, 0x7D,
-    0x8F, 0xD8, 0xBF, 0xF3, 0x78, 0xA3, 0x8A, 0x1C, 0x95, 0x98, 0x83, 0xCD, 0xE7, 0xC3, 0x33, 0x04,
-    0xD7, 0xE4, 0xFD, 0x2A, 0x5E, 0xB6, 0xD2, 0xE7, 0xC1, 0x23, 0xD6, 0x63, 0x6F, 0x3D, 0x2E, 0x34,
-    0xEB, 0x59, 0x91, 0xF4, 0x21, 0x6C, 0x28, 0x06, 0x84, 0x89, 0x0F, 0x29, 0xD2, 0x9A, 0x27, 0xFE,
-    0x2E, 0xA5, 0x86, 0x68, 0x6E, 0x2B, 0x37, 0x2E, 0xD1, 0x53, 0x8F, 0x77, 0x15, 0x3B, 0xC0, 0x7A,
-    0x9D, 0x7A, 0xC6, 0x76, 0x9B, 0x23, 0x0E, 0x86, 0xD8, 0xA7, 0xA7, 0x2C, 0xA7, 0x73, 0x9E, 0xB2,
-    0x9F, 0xD9, 0x34, 0x47, 0x41, 0xEE, 0x24, 0x4F, 0xFE, 0x9D, 0xCE, 0x9B, 0x23, 0x57, 0x7F, 0x06,
-    0xBA, 0xAC, 0xC5, 0x6E, 0x7C, 0x3A, 0x63, 0xED, 0xEB, 0x73, 0xD5, 0xE4, 0xCA, 0xE7, 0x4A, 0x48,
-    0xAE, 0x10, 0x0A, 0x63, 0x0F, 0x31, 0x31, 0xF1, 0x42, 0x8F, 0x9B, 0xD3, 0x0E, 0x7F, 0x36, 0x98,
-    0xA7, 0x41, 0x2F, 0x0B, 0x54, 0xFA, 0x01, 0xC8, 0x2F, 0xC1, 0x61, 0x68, 0x8F, 0x9C, 0x7F, 0x8C,
-    0xE1, 0xEB, 0xA2, 0xA9, 0xFB, 0xDB, 0x1A, 0x40, 0xA6, 0xC8, 0x4C, 0xA3, 0x0F, 0x63, 0x8A, 0xFE,
-    0xA8, 0x28, 0xDA, 0xC9, 0x00, 0x08, 0x6E, 0x3B, 0x4D, 0x8A, 0x22, 0x21, 0xA3, 0xC8, 0x8B, 0xA3,
-    0xC8, 0x49, 0xA3, 0x88, 0x32, 0x40, 0xBF, 0x15, 0x51, 0x03, 0xE0, 0xE3, 0xDD, 0xCB, 0x23, 0x72,
-    0x00, 0x56, 0x5E, 0xEC, 0xA3, 0xE0, 0x60, 0x6B, 0x5C, 0xB5, 0x65, 0xC2, 0xCA, 0xD6, 0xD4, 0x75,
-    0x04, 0x5A, 0x12, 0xDB, 0x09, 0xB9, 0xA9, 0x35, 0xE4, 0x61, 0x0D, 0x36, 0x03, 0x9F, 0xB5, 0x51,
-    0x84, 0x35, 0xD6, 0xCD, 0x36, 0x4F, 0x7C, 0xB4, 0xF2, 0xE2, 0x7A, 0x91, 0x5D, 0x60, 0x30, 0x02,
-    0x45, 0x03, 0x56, 0x63, 0xB1, 0x02, 0xDE, 0x04, 0xFE, 0x4B, 0x3A, 0xA4, 0x83, 0x8F, 0xF1, 0x5A,
-    0x6C, 0x61, 0x6C, 0xA9, 0x08, 0x4A, 0x2F, 0x93, 0xB8, 0x63, 0x1C, 0x0B, 0x32, 0x23, 0x5A, 0xF1,
-    0x39, 0x1D, 0x77, 0xC2, 0x97, 0x43, 0x7C, 0x91, 0xF8, 0x1C, 0xF0, 0x11, 0x44, 0xFE, 0x0B, 0x78,
-    0x11, 0xDA, 0xAE, 0xBC, 0xCC, 0x45, 0x57, 0x38, 0xF3, 0x58, 0x15, 0x87, 0x37, 0xE1, 0x45, 0xD3,
-    0xAD, 0xD2, 0x72, 0x83, 0xDA, 0xE2, 0x3D, 0xE5, 0xFC, 0x3B, 0x26, 0xE4, 0xB5, 0xBB, 0x20, 0x17,
-    0xBA, 0x77, 0x53, 0x9F, 0x72, 0x64, 0x5D, 0x4B, 0x9C, 0x5F, 0x30, 0x04, 0xE3, 0xB7, 0x98, 0x8F,
-    0xE1, 0x94, 0x0F, 0x7B, 0x0C, 0x3E, 0x9C, 0x7F, 0x82, 0x0F, 0xF1, 0x06, 0xF8, 0xA8, 0x30, 0x1F,
-    0x6D, 0x26, 0x0C, 0x87, 0xD0, 0xB6, 0x13, 0x54, 0x2E, 0x6C, 0xA8, 0x2D, 0x98, 0x8F, 0x3A, 0xF3,
-    0x11, 0x31, 0x1F, 0x6A, 0xCA, 0x87, 0xC7, 0x7C, 0xF8, 0xCC, 0xC7, 0xC2, 0x8C, 0x93, 0xE1, 0x44,
-    0xDD, 0x58, 0x00, 0x93, 0xFD, 0x46, 0xE4, 0x52, 0xF9, 0x11, 0x00, 0xA6, 0xA3, 0xFA, 0x80, 0x1A,
-    0xBC, 0x45, 0x20, 0x45, 0x2C, 0xF6, 0x34, 0x96, 0x9C, 0x1F, 0x90, 0x27, 0xDE, 0x1D, 0xF8, 0x59,
-    0x4E, 0xF4, 0x4A, 0xF4, 0x62, 0x68, 0x70, 0x30, 0x6A, 0x26, 0x26, 0x50, 0xDA, 0x61, 0xF9, 0x85,
-    0xD0, 0x30, 0xA7, 0x4C, 0x15, 0xCD, 0xDA, 0xF3, 0x97, 0x53, 0xF6, 0x88, 0x9C, 0x78, 0x4E, 0x1B,
-    0xE3, 0x2B, 0xD8, 0x52, 0x01, 0xE7, 0xE8, 0x41, 0xB7, 0xF8, 0xC4, 0x6B, 0x4F, 0x4F, 0xBC, 0x57,
-    0x30, 0xBE, 0x19, 0x17, 0xEB, 0x3F, 0x70, 0xC2, 0x7D, 0x18, 0x5A, 0xB3, 0xA8, 0x73, 0x4F, 0x22,
-    0x20, 0x45, 0xC7, 0x86, 0x70, 0x80, 0x11, 0xB1, 0x82, 0x98, 0x1A, 0xEF, 0x43, 0x13, 0x90, 0xC2,
-    0x83, 0x21, 0xAA, 0x38, 0x0E, 0x87, 0xD4, 0xFC, 0x3C, 0x83, 0x27, 0xEE, 0x83, 0xBF, 0x1A, 0xA0,
-    0x0D, 0xC0, 0x0F, 0x31, 0x3D, 0x43, 0x56, 0x9B, 0x55, 0x4C, 0x72, 0x83, 0x77, 0xB4, 0x9D, 0x1C,
-    0x3D, 0xBB, 0x00, 0x5F, 0x66, 0x26, 0x45, 0x01, 0x20, 0x10, 0x65, 0x7F, 0x1E, 0x50, 0xD6, 0x19,
-    0xCE, 0xFC, 0x8C, 0x32, 0x4B, 0xAD, 0x4D, 0x57, 0x79, 0x51, 0x0A, 0xAD, 0x4A, 0xE7, 0x73, 0x93,
-    0x5E, 0xF0, 0xC1, 0xDB, 0xD6, 0xC3, 0xE0, 0x5E, 0xFF, 0x32, 0xD5, 0x90, 0x82, 0x83, 0x72, 0xDF,
-    0x1A, 0x76, 0x6E, 0xF6, 0xFD, 0x51, 0x79, 0x32, 0x1F, 0x94, 0x61, 0x93, 0x15, 0x36, 0xA3, 0x67,
-    0x99, 0xCE, 0xC6, 0x26, 0x9D, 0xBB, 0x49, 0x09, 0x27, 0x8B, 0xA3, 0x4E, 0x97, 0x4B, 0x5E, 0xB6,
-    0x56, 0xEA, 0xA8, 0x93, 0x6E, 0xF8, 0x0C, 0xA4, 0xDD, 0x3B, 0x89, 0x7B, 0x75, 0xEA, 0xD2, 0x8F,
-    0x34, 0xF7, 0x04, 0x82, 0x1E, 0xD9, 0x77, 0x43, 0xFB, 0x6A, 0x6C, 0xDD, 0x97, 0x26, 0xE1, 0x3F,
-    0x1A, 0x06, 0xEB, 0x3A, 0xFD, 0x0C, 0x89, 0xDE, 0xDF, 0x74, 0xB2, 0xF2, 0xBA, 0xBE, 0x0A, 0xE9,
-    0x8F, 0xB1, 0x9F, 0x28, 0x35, 0xAE, 0xEA, 0xC7, 0x70, 0x7A, 0x1E, 0x05, 0x9F, 0x8D, 0xBB, 0xBF,
-    0x6B, 0xF3, 0xE7, 0x9C, 0xAB, 0x8C, 0x10, 0xF5, 0x23, 0xA4, 0x49, 0x0B, 0x9D, 0x9B, 0xEF, 0xEF,
-    0xE5, 0xFE, 0xC8, 0x2E, 0x52, 0x27, 0xA6, 0xEB, 0x6A, 0x25, 0x3E, 0xDE, 0x6E, 0xD0, 0xC3, 0x77,
-    0x45, 0x93, 0x8B, 0x22, 0xA8, 0xDC, 0x9E, 0xB2, 0x75, 0x3A, 0xB9, 0x28, 0x82, 0x27, 0x84, 0xB8,
-    0xDE, 0x96, 0xD6, 0xE8, 0xF1, 0xBB, 0xEF, 0xEA, 0x54, 0x7C, 0x90, 0x37, 0xA8, 0x0E, 0x97, 0xD6,
-    0xA6, 0x00, 0xA7, 0xF9, 0xDD, 0x6E, 0x77, 0x1F, 0x9B, 0x5C, 0x10, 0x7B, 0x7D, 0x6B, 0x66, 0x28,
-    0xB0, 0x10, 0xEC, 0xFE, 0xCA, 0xFE, 0xEE, 0x1F, 0x6D, 0xFA, 0x95, 0xC9, 0xEE, 0x1F, 0x9F, 0xEE,
-    0xFE, 0x91, 0xA6, 0xBB, 0x77, 0x52, 0xE7, 0x4E, 0x4A, 0xF4, 0x0C, 0xA4, 0x03, 0xB0, 0x8D, 0xD3,
-    0xC7, 0x36, 0xF6, 0x42, 0x3E, 0x39, 0x7B, 0xE2, 0xF5, 0x79, 0xB1, 0x6F, 0x16, 0x77, 0x02, 0x48,
-    0x9E, 0xF4, 0x63, 0x5E, 0xD2, 0x43, 0x79, 0x1D, 0x4E, 0x24, 0x4F, 0x99, 0xD1, 0xED, 0xE7, 0x72,
-    0xDF, 0xCC, 0x09, 0x9F, 0x56, 0x71, 0xF0, 0x1D, 0xC1, 0x70, 0x03, 0x34, 0x07, 0x29, 0xF6, 0x0E,
-    0x3B, 0x27, 0xF9, 0x10, 0x50, 0x21, 0x6B, 0xF7, 0x0D, 0xBE, 0x58, 0x93, 0x81, 0xEC, 0x20, 0x16,
-    0x89, 0xB0, 0x0D, 0x17, 0x15, 0x21, 0x0C, 0x02, 0xE0, 0x44, 0x3C, 0xFE, 0x26, 0x39, 0x6E, 0x8A,
-    0x7B, 0x1C, 0x01, 0x0B, 0x99, 0x59, 0x72, 0x49, 0x64, 0x9B, 0xAB, 0x03, 0x75, 0xD6, 0x63, 0xFB,
-    0xD9, 0xB8, 0x28, 0xBF, 0xD0, 0x4A, 0xFF, 0x68, 0x38, 0x64, 0x95, 0xAD, 0x7F, 0xC3, 0xAD, 0x8B,
-    0x99, 0xCC, 0xEA, 0xD7, 0x37, 0xB4, 0x89, 0xBC, 0xD9, 0x1E, 0x20, 0x2F, 0xCC, 0x48, 0x7C, 0x70,
-    0xCB, 0x04, 0x69, 0x26, 0x0A, 0x46, 0x0C, 0x03, 0x91, 0x61, 0xC8, 0x03, 0x63, 0x22, 0x44, 0x34,
-    0x44, 0x6F, 0xD3, 0x30, 0x63, 0xE9, 0x74, 0xDF, 0xE5, 0xF2, 0xB1, 0x84, 0x93, 0x3D, 0xF6, 0x93,
-    0xE5, 0x39, 0xE1, 0x6C, 0x72, 0x6E, 0x8E, 0xE3, 0xD0, 0xBF, 0x52, 0x72, 0x65, 0xEB, 0xF9, 0x71,
-    0xCA, 0x05, 0x72, 0x46, 0x67, 0xC8, 0xBB, 0x94, 0xD3, 0xB7, 0xED, 0x74, 0x2E, 0x3C, 0x3A, 0x89,
-    0x32, 0x30, 0x7B, 0x9E, 0x07, 0xDF, 0xC9, 0x49, 0x0E, 0x51, 0x2F, 0x1C, 0x15, 0x3F, 0xDD, 0x6E,
-    0xB7, 0xB8, 0xB1, 0x9B, 0x3E, 0xB5, 0xC9, 0x35, 0xC5, 0xF4, 0xDE, 0xF8, 0xE2, 0x0F, 0x38, 0xA9,
-    0x27, 0xDF, 0xD0, 0x1B, 0x50, 0xCD, 0xFA, 0x5C, 0xB6, 0x9D, 0xBF, 0x84, 0x91, 0xF8, 0x61, 0x18,
-    0x21, 0xAF, 0x89, 0xDA, 0xA0, 0xA7, 0x70, 0x40, 0x48, 0x40, 0x2F, 0x2C, 0xE8, 0x35, 0x40, 0xEF,
-    0xC4, 0x34, 0x16, 0x67, 0x93, 0xC3, 0x28, 0xAB, 0xB1, 0x5B, 0xDC, 0x79, 0x9C, 0x40, 0x22, 0xC9,
-    0x7C, 0xFF, 0x3F, 0xA8, 0xC3, 0x21, 0x61, 0x0D, 0xD2, 0xBF, 0xA7, 0x61, 0xC0, 0xEF, 0xCB, 0x43,
-    0xBA, 0xC0, 0x7A, 0xCF, 0x77, 0x35, 0xCB, 0x34, 0x1F, 0x9C, 0x4D, 0xBC, 0x0E, 0xA0, 0x0B, 0x9F,
-    0x20, 0x99, 0x94, 0xD5, 0xB9, 0xE0, 0xB4, 0xB1, 0x6F, 0xF6, 0x81, 0xBD, 0x7B, 0x6E, 0x1E, 0xD9,
-    0x23, 0x7B, 0x13, 0x1B, 0x38, 0x57, 0x7C, 0xDA, 0xA0, 0x45, 0x1C, 0xAE, 0x78, 0x1E, 0x67, 0xBD,
-    0x15, 0x53, 0x4F, 0x35, 0xC2, 0x89, 0xA1, 0x3B, 0x1F, 0x29, 0xB2, 0x3E, 0x85, 0xAC, 0xBE, 0xC4,
-    0xBC, 0x0F, 0xC3, 0x42, 0xE7, 0x9B, 0x13, 0x1D, 0xA8, 0x99, 0xC4, 0xC5, 0x1C, 0x9F, 0x06, 0xEC,
-    0x37, 0xE4, 0x23, 0xD7, 0xA4, 0xD9, 0x45, 0xF9, 0x5F, 0x18, 0xFE, 0x79, 0x18, 0x7E, 0x3D, 0xA7,
-    0x4A, 0xC6, 0xD7, 0x4B, 0x93, 0x92, 0x53, 0x80, 0xAD, 0x46, 0x74, 0xFA, 0xFA, 0x7E, 0xF6, 0x95,
-    0x4E, 0x1E, 0xBD, 0x62, 0x35, 0x1C, 0xDF, 0x56, 0x06, 0xA6, 0xCF, 0xBC, 0xD9, 0xFD, 0x1F, 0xBD,
-    0x5A, 0x3D, 0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x43, 0x6A, 0x1D, 0x2D, 0xC0, 0x21, 0x10, 0x1A,
-    0x01, 0xC2, 0x58, 0xAB, 0x32, 0x08, 0xC4, 0xBB, 0x14, 0x2A, 0x14, 0xE0, 0x96, 0x3B, 0x09, 0x90,
-    0xB8, 0x30, 0x10, 0x5F, 0x00, 0xD3, 0x5D, 0xA0, 0x26, 0x45, 0xAC, 0xC2, 0x74, 0xA1, 0x82, 0x01,
-    0x8E, 0xBA, 0x05, 0x5C, 0xA4, 0x70, 0x61, 0xA9, 0x50, 0x1D, 0x97, 0x31, 0x83, 0x80, 0x2C, 0x08,
-    0x63, 0x01, 0x1D, 0x79, 0x6B, 0x3B, 0x80, 0x8A, 0x14, 0x59, 0x3B, 0x10, 0x52, 0x18, 0x88, 0x17,
-    0xB0, 0x53, 0x84, 0x29, 0xB2, 0x89, 0xD6, 0xD6, 0x46, 0xB9, 0xBB, 0xC9, 0xF7, 0x66, 0xF7, 0x8E,
-    0x3F, 0x22, 0xC5, 0x3B, 0xF2, 0x98, 0xBD, 0x79, 0xC3, 0xBB, 0xD9, 0xF9, 0xF9, 0xE6, 0xCD, 0x9B,
-    0xF7, 0x33, 0x43, 0xEA, 0x0E, 0x88, 0x98, 0xF8, 0x11, 0x31, 0x91, 0x9B, 0x12, 0xC9, 0x8C, 0xE8,
-    0xCA, 0x36, 0x91, 0xBF, 0x46, 0xD4, 0x68, 0x10, 0x45, 0x4B, 0x44, 0xB9, 0x47, 0x56, 0x26, 0x95,
-    0x9D, 0xBA, 0xA1, 0xD8, 0xFB, 0x5D, 0xEC, 0x68, 0x9D, 0xC8, 0xFB, 0xAF, 0x67, 0x1E, 0x51, 0x56,
-    0x43, 0x0D, 0xD4, 0x6A, 0xB5, 0xD0, 0x22, 0x27, 0xAA, 0xBB, 0x3A, 0x45, 0xE2, 0x0E, 0x6F, 0x29,
-    0xA9, 0xB3, 0xB9, 0x1F, 0x16, 0x78, 0x89, 0x9E, 0x90, 0x6C, 0xDD, 0xAB, 0xEF, 0x75, 0xD6, 0xA9,
-    0x51, 0x50, 0x23, 0xA7, 0x4E, 0xC7, 0xEA, 0xB5, 0x37, 0x3B, 0x5E, 0xFF, 0x1A, 0x57, 0x56, 0xB3,
-    0xE8, 0x6B, 0x8E, 0xA8, 0xDD, 0x2B, 0x51, 0x4C, 0x11, 0xD1, 0x2C, 0x35, 0x5D, 0x4A, 0x85, 0x8E,
-    0x69, 0x97, 0x26, 0xC6, 0x35, 0x25, 0x0C, 0x64, 0x46, 0xA2, 0x2D, 0x10, 0x4F, 0x0E, 0x9D, 0x91,
-    0x06, 0xBD, 0x38, 0x09, 0x98, 0x1B, 0xDC, 0xD6, 0x4A, 0xC8, 0x42, 0x0F, 0x58, 0xB3, 0x85, 0x92,
-    0x49, 0x01, 0x99, 0xA6, 0xDC, 0xA5, 0x1D, 0x97, 0x45, 0x9E, 0xBE, 0x6B, 0x69, 0x9D, 0x39, 0x39,
-    0xDD, 0x95, 0x71, 0x39, 0xF8, 0x72, 0x05, 0xA0, 0x75, 0x0C, 0xF9, 0x54, 0xD6, 0xF1, 0xC2, 0x72,
-    0xAA, 0xB6, 0xDE, 0x4C, 0x68, 0x55, 0x57, 0x9D, 0x81, 0x05, 0x29, 0xC9, 0x90, 0xAE, 0x18, 0x00,
-    0x86, 0x7D, 0x8E, 0xCE, 0xE4, 0xA3, 0xF7, 0x96, 0x4D, 0x8F, 0xE8, 0x20, 0x1A, 0xA6, 0x96, 0xE9,
-    0x0B, 0x5D, 0xC9, 0xA7, 0x99, 0xAD, 0xD3, 0x51, 0x7B, 0x40, 0x93, 0x58, 0xD6, 0x1A, 0x98, 0x72,
-    0xDB, 0x51, 0x17, 0x01, 0xF1, 0x0E, 0x59, 0x5A, 0x89, 0x8F, 0x93, 0x39, 0xC3, 0xE1, 0x09, 0x21,
-    0x02, 0x91, 0x9D, 0x96, 0x44, 0x6A, 0xFA, 0x1C, 0x9C, 0x31, 0xEF, 0x7D, 0xF3, 0xE5, 0x2C, 0xEC,
-    0x5B, 0x73, 0x15, 0xD5, 0xF1, 0xC2, 0x2D, 0x2A, 0x8C, 0x53, 0x67, 0x9F, 0x54, 0x99, 0xF8, 0x4B,
-    0xCC, 0x02, 0xB9, 0x7E, 0x26, 0x88, 0x22, 0x41, 0xF9, 0x57, 0x58, 0xE5, 0x00, 0x3D, 0x7A, 0x25,
-    0x0B, 0xDB, 0x83, 0xBB, 0xD4, 0xD5, 0x7D, 0x8A, 0xAC, 0xAE, 0x8A, 0xC8, 0x4D, 0x22, 0x88, 0x41,
-    0x84, 0xED, 0x82, 0x4E, 0x72, 0x50, 0xC1, 0xFD, 0x55, 0x54, 0x94, 0x65, 0xFC, 0x8E, 0xEB, 0xB8,
-    0x71, 0x44, 0x6D, 0xC5, 0x6D, 0xBB, 0xFA, 0x2E, 0xA3, 0x7B, 0x95, 0xB3, 0x9F, 0x72, 0xF6, 0x73,
-    0xCE, 0x7E, 0x69, 0x10, 0x13, 0xBD, 0x81, 0xCC, 0xD1, 0x9F, 0x2B, 0xF2, 0xEE, 0x69, 0x85, 0xE9,
-    0x07, 0x0A, 0xF0, 0x3C, 0xCE, 0xF0, 0x22, 0x3A, 0x9C, 0x99, 0xB2, 0x06, 0xBF, 0x0D, 0xB8, 0x9E,
-    0xDC, 0x43, 0x0B, 0x5B, 0xBF, 0x53, 0xAD, 0xB6, 0xA3, 0xFF, 0xCE, 0x99, 0x4E, 0xC8, 0x89, 0x17,
-    0x73, 0x64, 0xD4, 0xE1, 0x2C, 0xE0, 0xCC, 0xE3, 0x4C, 0x2A, 0xCE, 0xC2, 0x40, 0xC7, 0x6E, 0xD8,
-    0xD6, 0x89, 0x1B, 0xBA, 0xFC, 0x73, 0xF8, 0xC2, 0x1B, 0x55, 0xE6, 0x66, 0x58, 0x93, 0xB2, 0x2B,
-    0xFD, 0x1F, 0xAA, 0x90, 0x82, 0x02, 0x9D, 0x19, 0xE2, 0xEF, 0x00, 0xCE, 0xB8, 0xBD, 0xFB, 0x5A,
-    0x31, 0x6A, 0x06, 0xCD, 0xF8, 0xA2, 0x03, 0xC4, 0xBF, 0x19, 0x2E, 0xA3, 0x65, 0xB0, 0x43, 0xAC,
-    0x12, 0x1A, 0x06, 0x7D, 0x83, 0xBD, 0x3A, 0xEF, 0xEA, 0x3C, 0x3A, 0xB0, 0x34, 0x48, 0x3B, 0x2B,
-    0xCD, 0xAE, 0xCE, 0x76, 0x37, 0xDE, 0x3B, 0x52, 0x8E, 0xD4, 0x35, 0xF5, 0x5D, 0x9D, 0x8D, 0x74,
-    0xB3, 0xA3, 0x53, 0x79, 0xAF, 0x58, 0x26, 0xBF, 0x41, 0xB5, 0x16, 0xD5, 0xBB, 0x5A, 0xEF, 0x6E,
-    0x6C, 0xEC, 0x2F, 0xB1, 0x9A, 0x91, 0x4F, 0x3B, 0x96, 0x86, 0xCC, 0xD1, 0x0B, 0xA4, 0xE6, 0xAC,
-    0xC4, 0xD5, 0xA1, 0xB5, 0x43, 0x67, 0x1E, 0x7A, 0x96, 0xE6, 0x5D, 0xCA, 0x0E, 0x2A, 0xE1, 0xF1,
-    0x01, 0xD0, 0x3C, 0x81, 0xB5, 0x9C, 0xE6, 0xCF, 0x0E, 0xE0, 0xB8, 0x7D, 0x38, 0x2E, 0x80, 0x33,
-    0x8E, 0x08, 0x7D, 0x0C, 0x75, 0x27, 0x89, 0x13, 0xC4, 0xC2, 0x6A, 0x8E, 0x3D, 0x68, 0x0F, 0xBB,
-    0x81, 0x9B, 0x0B, 0x93, 0x6C, 0x28, 0xCF, 0xD7, 0x00, 0xE3, 0x8A, 0x9D, 0x3A, 0x7F, 0x0C, 0xED,
-    0x81, 0x61, 0xC5, 0x99, 0x51, 0x1D, 0xBF, 0xDF, 0xC7, 0x5E, 0x0B, 0x7E, 0x2C, 0x7C, 0x73, 0xFA,
-    0xE8, 0x08, 0xD2, 0xFC, 0xDD, 0xCA, 0xEA, 0x2C, 0xEA, 0x2F, 0x49, 0xEB, 0x9E, 0x28, 0xE8, 0x17,
-    0xC7, 0xAB, 0xA4, 0x17, 0x5F, 0x6B, 0x51, 0xD0, 0x6F, 0xD1, 0xB7, 0x77, 0xB8, 0x57, 0x5E, 0x0A,
-    0xD4, 0xF1, 0x61, 0x59, 0x7C, 0xF0, 0xC6, 0xB7, 0xF4, 0x3F, 0xFA, 0x54, 0xDF, 0x1F, 0xC2, 0xD8,
-    0x35, 0x1D, 0x92, 0xF8, 0x34, 0x25, 0x57, 0xDD, 0x2E, 0xCB, 0xDE, 0xB0, 0xB0, 0xAD, 0x3E, 0x53,
-    0xBC, 0xE1, 0xC7, 0xDF, 0x39, 0xEF, 0x2A, 0xB3, 0x00, 0x86, 0x3C, 0x58, 0xCD, 0x3B, 0x66, 0x18,
-    0x97, 0x75, 0xCB, 0x02, 0xF4, 0xFD, 0x35, 0x30, 0x58, 0x82, 0x15, 0x76, 0x35, 0xF4, 0x14, 0xE7,
-    0x61, 0xD1, 0x55, 0x08, 0xC0, 0x16, 0x09, 0xDE, 0x73, 0xBB, 0xEA, 0x62, 0xE6, 0x60, 0xF6, 0x44,
-    0x5E, 0xD1, 0xFC, 0xD4, 0xE7, 0x60, 0x76, 0x0B, 0x37, 0xAE, 0xD1, 0x70, 0xE7, 0x5C, 0xC0, 0x1C,
-    0xA6, 0x2D, 0x3F, 0xBC, 0x5B, 0xB6, 0x4B, 0xA7, 0x08, 0x0E, 0x13, 0x59, 0x15, 0xEF, 0x5D, 0x10,
-    0x7C, 0x4C, 0x5A, 0xAA, 0x3A, 0xBE, 0xA8, 0xB9, 0x78, 0x98, 0x40, 0x80, 0x35, 0xCF, 0x59, 0x07,
-    0x2C, 0x95, 0x56, 0x1C, 0x60, 0xA2, 0x13, 0x68, 0x67, 0x65, 0x25, 0xC3, 0x96, 0xC3, 0xAE, 0xDD,
-    0x38, 0xB1, 0xCE, 0x90, 0x8C, 0xBD, 0x62, 0x3B, 0x52, 0x94, 0x4C, 0xD8, 0x72, 0x47, 0x3B, 0x06,
-    0x76, 0xF8, 0x38, 0x7A, 0x9F, 0xC4, 0x67, 0x3A, 0x16, 0xFD, 0x97, 0x33, 0x38, 0x62, 0x19, 0x9C,
-    0xB9, 0x1C, 0xE5, 0xA7, 0x92, 0x13, 0x62, 0x72, 0xEE, 0x28, 0xD3, 0x78, 0x72, 0x93, 0xED, 0x97,
-    0xB9, 0x8F, 0x56, 0x6E, 0x62, 0xCE, 0x5A, 0x93, 0xBB, 0xB7, 0xB1, 0x79, 0xA0, 0xF2, 0xF3, 0xB3,
-    0xCA, 0x22, 0x42, 0x1D, 0x25, 0xA0, 0x74, 0xF4, 0x5B, 0xDE, 0xEC, 0x93, 0xEC, 0x76, 0x43, 0x99,
-    0xBA, 0xB1, 0x8C, 0x45, 0x22, 0x43, 0x90, 0x7A, 0x3E, 0x59, 0x34, 0xEF, 0xA5, 0xE9, 0x0F, 0x74,
-    0xF2, 0xFD, 0x45, 0x65, 0xCC, 0xA3, 0x72, 0x07, 0x66, 0x27, 0x8C, 0x97, 0x2E, 0x0D, 0xB8, 0xC9,
-    0x91, 0x4E, 0xA8, 0x39, 0x6E, 0xF3, 0xB6, 0x6E, 0x43, 0x71, 0x04, 0xFD, 0x7A, 0x21, 0x92, 0x93,
-    0x3F, 0x8B, 0x45, 0xD0, 0x2F, 0x6B, 0x5A, 0xEA, 0xE4, 0x5A, 0x4D, 0x9B, 0xDE, 0x72, 0xD1, 0x57,
-    0x15, 0xFC, 0xE0, 0x4B, 0xBD, 0xE0, 0x05, 0x1C, 0x33, 0x2D, 0x16, 0xDC, 0xE4, 0x48, 0x27, 0x10,
-    0xFB, 0x31, 0x9B, 0xC3, 0x32, 0xA4, 0x52, 0x9D, 0xFC, 0x59, 0x4D, 0x75, 0x6E, 0x25, 0x22, 0x74,
-    0xA1, 0x8B, 0xB1, 0xDB, 0x9A, 0x16, 0x71, 0xA9, 0x85, 0x31, 0x66, 0xE9, 0xE4, 0x56, 0x73, 0xD8,
-    0x64, 0x37, 0x20, 0xF9, 0x41, 0x3C, 0xAB, 0xF6, 0x5B, 0x8C, 0x33, 0x56, 0x33, 0x3F, 0xF8, 0xE8,
-    0x5C, 0x12, 0xDA, 0x70, 0x0F, 0x67, 0xA2, 0x55, 0xB4, 0xE5, 0x3E, 0x78, 0xAF, 0x1A, 0xCD, 0x32,
-    0x03, 0x47, 0xC6, 0xC3, 0x06, 0xBA, 0x7C, 0x17, 0x2A, 0x4D, 0xF9, 0x76, 0xE6, 0x5B, 0xD9, 0x8C,
-    0xF1, 0xFD, 0x17, 0xA8, 0x89, 0xEF, 0xE3, 0x24, 0x1A, 0x25, 0x6C, 0x29, 0xB8, 0x35, 0xDA, 0xC8,
-    0x4E, 0x8F, 0x04, 0x64, 0xEA, 0x95, 0x70, 0x89, 0xD5, 0x8E, 0xD1, 0x41, 0xD1, 0x99, 0x52, 0x4E,
-    0x2F, 0x67, 0x84, 0x0D, 0xB2, 0x31, 0xB4, 0xB7, 0xDC, 0xED, 0xAB, 0xEA, 0x5A, 0x69, 0x6C, 0x9B,
-    0x13, 0xC8, 0x78, 0x99, 0x00, 0xB3, 0x9D, 0x52, 0x3B, 0xC4, 0x6A, 0xB8, 0x61, 0x04, 0x1E, 0x44,
-    0xF0, 0x21, 0x22, 0x94, 0x46, 0x4E, 0x42, 0x11, 0xBB, 0xC9, 0xD0, 0x25, 0x11, 0x58, 0xF2, 0x00,
-    0xD4, 0x05, 0x7B, 0x76, 0xC0, 0xA6, 0x08, 0xCA, 0xD5, 0xBC, 0xB7, 0x51, 0x0F, 0x53, 0x8B, 0xA0,
-    0x91, 0x23, 0xE8, 0x41, 0xF6, 0xD1, 0x0D, 0xAE, 0x59, 0x76, 0x4A, 0x2A, 0x5D, 0xCA, 0xC1, 0xE1,
-    0xD5, 0x63, 0x46, 0x6E, 0xE6, 0x76, 0x96, 0xBB, 0x71, 0x5E, 0xA7, 0xBC, 0xC3, 0x41, 0xC2, 0x13,
-    0x70, 0x2B, 0xA3, 0x5E, 0x87, 0xF2, 0x65, 0xCA, 0xA5, 0xCA, 0x9D, 0x98, 0x2B, 0x50, 0x51, 0xCD,
-    0x2B, 0xE3, 0xF0, 0x16, 0xB3, 0xB4, 0xF8, 0xD7, 0xB0, 0xAD, 0xA7, 0xF2, 0x75, 0xCA, 0x0B, 0x7A,
-    0x02, 0x9E, 0xE4, 0xD4, 0xEF, 0x50, 0x11, 0xA0, 0x6D, 0x98, 0x3B, 0xC9, 0xA8, 0xAD, 0x64, 0x3F,
-    0x9C, 0x81, 0x6C, 0x0D, 0xD5, 0xED, 0x44, 0xFC, 0x1E, 0xFA, 0x46, 0x02, 0xCA, 0xC7, 0xAB, 0x02,
-    0x5D, 0x7F, 0xAC, 0xCF, 0x59, 0x47, 0x32, 0x01, 0x7C, 0xC3, 0x88, 0x08, 0xD4, 0x39, 0xAC, 0xD8,
-    0xB3, 0x0F, 0xCD, 0xD6, 0x1A, 0x37, 0xAE, 0xAE, 0xD1, 0x76, 0xC4, 0xBA, 0x3F, 0x8D, 0xAC, 0x78,
-    0xFC, 0x01, 0xF0, 0x64, 0x79, 0xF2, 0x75, 0x9C, 0xD3, 0xF3, 0x3E, 0xC7, 0x83, 0xB7, 0x28, 0x42,
-    0x10, 0x86, 0x64, 0x9D, 0xD0, 0xF7, 0xD1, 0x7E, 0xD4, 0xD7, 0xD9, 0xD7, 0x59, 0xAE, 0x0E, 0x97,
-    0x3A, 0x1C, 0x6C, 0x9E, 0x44, 0xEF, 0x84, 0xB0, 0x1C, 0x8A, 0x5C, 0x3E, 0x1B, 0x81, 0x2C, 0x41,
-    0x30, 0x69, 0xF1, 0x68, 0x1D, 0x0D, 0x6D, 0x0E, 0x12, 0xF1, 0xA1, 0xCF, 0x1F, 0x44, 0x5F, 0x14,
-    0x5E, 0x12, 0xC4, 0xDF, 0x3C, 0x54, 0x5E, 0x5A, 0x40, 0x38, 0xCA, 0x90, 0xE9, 0xF2, 0xD0, 0xA6,
-    0x2C, 0x81, 0x87, 0x7B, 0xBB, 0x0B, 0xEC, 0x5D, 0x88, 0xF2, 0x83, 0x98, 0xA2, 0x0F, 0x20, 0xCA,
-    0xDB, 0x39, 0xA8, 0x05, 0x0A, 0x10, 0x7F, 0xC2, 0xC4, 0xF3, 0x54, 0x23, 0x91, 0x22, 0x16, 0xCD,
-    0x41, 0x9D, 0x35, 0xC8, 0x39, 0xC8, 0xC3, 0x77, 0x17, 0xB1, 0xA9, 0x00, 0x59, 0x46, 0x3C, 0x39,
-    0xEA, 0x53, 0xEC, 0x10, 0x1B, 0x77, 0xB4, 0x79, 0x4B, 0xFD, 0x5B, 0x67, 0xFA, 0x67, 0xBD, 0x1E,
-    0x9F, 0xD5, 0xF8, 0xF9, 0xC9, 0x69, 0x9A, 0x18, 0x8C, 0x2F, 0x63, 0xE6, 0x57, 0xB9, 0x20, 0x2F,
-    0x4C, 0x82, 0x64, 0x5F, 0xEC, 0xD6, 0xCC, 0x4E, 0x69, 0x96, 0x5D, 0xA6, 0xF0, 0x51, 0x3A, 0xBC,
-    0x14, 0x69, 0xC9, 0xFA, 0xE9, 0xF2, 0x4D, 0x5A, 0x1C, 0xB6, 0x58, 0xBA, 0x0A, 0x5B, 0xC6, 0x47,
-    0x5B, 0xAB, 0x8E, 0x2E, 0x86, 0x3E, 0xE0, 0x36, 0x9A, 0x66, 0x8F, 0x75, 0xA6, 0xF4, 0x8F, 0x0B,
-    0x2C, 0x75, 0x0B, 0x42, 0xD6, 0xC0, 0xE6, 0x39, 0x95, 0x0E, 0xCD, 0x25, 0xA9, 0xE6, 0x52, 0x80,
-    0xD6, 0x41, 0x75, 0x9E, 0x4B, 0x18, 0x41, 0xCF, 0x45, 0xD0, 0x73, 0xC0, 0x5E, 0x60, 0x0E, 0xEB,
-    0xA0, 0x3A, 0x48, 0x56, 0xF3, 0xB0, 0xF9, 0x8C, 0x82, 0xE7, 0x12, 0x95, 0x8E, 0xF6, 0x4F, 0x20,
-    0x64, 0x1C, 0x87, 0x6F, 0x1C, 0x9C, 0x8D, 0x7F, 0x1A, 0xEF, 0x0F, 0x24, 0xD9, 0x23, 0x99, 0x52,
-    0xC0, 0x46, 0x23, 0xD0, 0x95, 0x77, 0x0A, 0x1F, 0x52, 0x11, 0x1F, 0xEB, 0x90, 0x93, 0x5A, 0x3D,
-    0x3E, 0x73, 0x5B, 0x66, 0x63, 0xE5, 0x71, 0x0B, 0x19, 0x36, 0x58, 0xFE, 0xC0, 0x05, 0xE7, 0x98,
-    0xCC, 0x8D, 0x4D, 0x15, 0x53, 0xD9, 0xE3, 0xB3, 0x10, 0x97, 0x3B, 0xB0, 0xF5, 0x26, 0x60, 0xAE,
-    0xEA, 0xB0, 0xF2, 0x0E, 0xD1, 0x31, 0x53, 0x15, 0xF2, 0xC1, 0xEB, 0xCD, 0x49, 0xDE, 0xDB, 0x31,
-    0x83, 0x34, 0x8C, 0x97, 0xCB, 0x96, 0xC1, 0x50, 0xCC, 0x7F, 0xE1, 0xF5, 0x86, 0x00, 0x8A, 0xB7,
-    0x01, 0xC9, 0x3D, 0x44, 0xA4, 0xC3, 0xF3, 0x9E, 0xAB, 0x2C, 0x82, 0x37, 0xF8, 0x20, 0xCF, 0xE3,
-    0x33, 0xCC, 0x4B, 0xA3, 0x98, 0xED, 0x62, 0xF1, 0xDB, 0x88, 0x6E, 0x84, 0x7A, 0x8B, 0xCC, 0xB9,
-    0xD3, 0xAA, 0x3A, 0xFF, 0x3C, 0xCA, 0xB3, 0xAF, 0x5F, 0xF3, 0x99, 0x15, 0x6F, 0xA4, 0x06, 0x3B,
-    0xEA, 0x5B, 0xD7, 0xFF, 0x3F, 0x93, 0x31, 0x0F, 0x0C, 0xA2, 0x9D, 0x62, 0x51, 0xDE, 0x8E, 0xE9,
-    0xB2, 0x43, 0x53, 0x9A, 0x10, 0x80, 0x6B, 0x1D, 0xDA, 0xEC, 0xAB, 0x87, 0x6E, 0x2A, 0xF8, 0xE8,
-    0x3A, 0xE4, 0x63, 0xC3, 0xBA, 0x39, 0x3C, 0xF4, 0x4D, 0xDE, 0x1A, 0xE6, 0x7F, 0x5B, 0xE1, 0x1C,
-    0x1E, 0x3C, 0xF2, 0xA7, 0x1B, 0xFB, 0xE5, 0xA3, 0x9A, 0x65, 0x2B, 0x3E, 0xE3, 0xE6, 0x93, 0x43,
-    0xBB, 0x3C, 0x3B, 0x44, 0xCF, 0x98, 0x89, 0x1E, 0xCD, 0xE5, 0x96, 0xBA, 0x74, 0x17, 0xA8, 0xB3,
-    0x76, 0x9F, 0xBC, 0x7B, 0xFD, 0xBC, 0x8E, 0x40, 0xAA, 0x9E, 0x30, 0x7F, 0xE0, 0xC6, 0xC7, 0x1D,
-    0x62, 0x47, 0x1E, 0x5B, 0x49, 0x6B, 0xCE, 0xF7, 0x36, 0x30, 0x0F, 0x70, 0x93, 0x8F, 0xE4, 0x42,
-    0xDE, 0xDA, 0x9E, 0x09, 0xF6, 0x82, 0x8C, 0x10, 0x5A, 0x15, 0x83, 0xCD, 0xD8, 0xD6, 0x49, 0x7D,
-    0xB4, 0x23, 0x2A, 0xAD, 0x6B, 0xE2, 0x03, 0xD6, 0x04, 0xD5, 0x39, 0x40, 0x7B, 0xA0, 0xD8, 0x14,
-    0xC1, 0x52, 0x0D, 0x9D, 0x12, 0x76, 0x68, 0x3C, 0x50, 0x0D, 0xE4, 0xD3, 0xCE, 0xEB, 0x85, 0x09,
-    0x2F, 0x76, 0x37, 0xD9, 0x81, 0x89, 0x2B, 0x07, 0x26, 0x2F, 0x9D, 0x9E, 0xC3, 0x4E, 0xCC, 0x3A,
-    0x15, 0x76, 0x2A, 0x80, 0xA4, 0xF9, 0xBD, 0x7F, 0xE9, 0x27, 0x8F, 0x06, 0xD0, 0x2B, 0xCF, 0x9A,
-    0xC9, 0x29, 0x8E, 0x57, 0x3A, 0x4D, 0xB5, 0xC3, 0x4E, 0xD3, 0xC2, 0xE5, 0xB0, 0xD1, 0x8E, 0xFD,
-    0xAF, 0x54, 0x10, 0xF2, 0xB9, 0x87, 0x7F, 0x72, 0x2A, 0xDB, 0x2F, 0x99, 0xD6, 0xD7, 0x47, 0xF1,
-    0x3E, 0x34, 0x2C, 0x41, 0xC5, 0x12, 0xEB, 0xD8, 0x52, 0xC9, 0x4E, 0x95, 0x47, 0x0D, 0x27, 0x96,
-    0x37, 0x49, 0x40, 0xD2, 0x4A, 0xBF, 0x65, 0x12, 0xB4, 0x47, 0x6E, 0x0F, 0x6C, 0xFD, 0xA5, 0xA7,
-    0x7B, 0xCB, 0xB4, 0xD0, 0x32, 0x2A, 0xBD, 0x65, 0x82, 0xFC, 0x7A, 0x42, 0x0E, 0x5F, 0x44, 0x61,
-    0x12, 0x85, 0xB1, 0x3C, 0xBE, 0xE1, 0x90, 0xDF, 0xA4, 0x4E, 0x77, 0x33, 0x6F, 0x8F, 0xE4, 0xCC,
-    0xEC, 0x26, 0x56, 0xC1, 0x65, 0x74, 0xF3, 0x3E, 0x44, 0x3D, 0x59, 0xBF, 0x14, 0x97, 0x4E, 0xF6,
-    0x1D, 0xBC, 0x47, 0xB8, 0x0D, 0xD1, 0xF1, 0x12, 0x16, 0x5A, 0x2B, 0x83, 0xD0, 0xEE, 0x6E, 0xC6,
-    0xED, 0xC1, 0xD1, 0x4B, 0x82, 0xCB, 0xC6, 0x47, 0x3C, 0x0F, 0x12, 0xBB, 0xE0, 0xE3, 0x2F, 0x68,
-    0x8D, 0x1B, 0xC6, 0x1F, 0x9F, 0x14, 0xC9, 0x19, 0x87, 0xDE, 0x36, 0xA6, 0xE7, 0x4D, 0x36, 0xFB,
-    0xD6, 0x9B, 0x30, 0x4B, 0x93, 0x8C, 0x9B, 0x9A, 0x5B, 0x23, 0x8C, 0xF4, 0x12, 0x59, 0x2D, 0x3E,
-    0x8C, 0x7C, 0xF6, 0x18, 0xF0, 0x3C, 0x0C, 0x39, 0x22, 0x21, 0x13, 0x31, 0xA4, 0xAB, 0x75, 0x0A,
-    0x65, 0x92, 0x9A, 0xE0, 0x4C, 0x9E, 0x83, 0xE6, 0xAA, 0x68, 0x04, 0xC2, 0x6C, 0x4E, 0x7D, 0xBE,
-    0xC5, 0x8E, 0xA5, 0xE2, 0x48, 0x02, 0xFB, 0x1B, 0xDE, 0xA8, 0x77, 0x1F, 0x63, 0x29, 0xE4, 0x70,
-    0x71, 0x8E, 0x4F, 0x31, 0x89, 0xA7, 0x0A, 0x42, 0xC2, 0x7A, 0xE6, 0x30, 0xAB, 0xCB, 0xAB, 0xC0,
-    0x67, 0xAF, 0x39, 0xA6, 0x06, 0x9E, 0x91, 0x2F, 0x59, 0xD4, 0x10, 0xE1, 0xF5, 0xC9, 0xA0, 0x9E,
-    0x8E, 0x41, 0xEA, 0x81, 0xA1, 0xD3, 0x30, 0x9C, 0xC4, 0xA8, 0xD5, 0x3D, 0x6A, 0xEB, 0x13, 0x47,
-    0xA7, 0x79, 0x8B, 0xEC, 0xC1, 0x1C, 0x89, 0xDF, 0xF4, 0xC8, 0xB1, 0xB6, 0xA9, 0x0A, 0x7B, 0xB3,
-    0x62, 0x02, 0xE2, 0xCB, 0x9F, 0x0E, 0xA8, 0x41, 0x22, 0xA9, 0x2B, 0x19, 0xCB, 0xA7, 0x1A, 0xE2,
-    0x52, 0xF9, 0x15, 0xCD, 0x19, 0x12, 0xFD, 0xEF, 0x90, 0xBB, 0xDA, 0xA3, 0x6F, 0x54, 0xF7, 0x5F,
-    0x0B, 0x50, 0x82, 0x0D, 0x73, 0x28, 0xF7, 0x7C, 0xF2, 0xB1, 0x4C, 0xB0, 0x2D, 0xCA, 0xDB, 0xD3,
-    0xCA, 0xA9, 0xAE, 0x50, 0x6C, 0x3E, 0x5C, 0xAF, 0xFA, 0x9E, 0x26, 0x4E, 0x01, 0x5D, 0x2B, 0xCA,
-    0xC0, 0xEE, 0x5C, 0xF8, 0x2C, 0x35, 0x83, 0xF8, 0xB7, 0xC1, 0xE7, 0x24, 0xD8, 0x7E, 0xE1, 0xD4,
-    0x71, 0xDA, 0x40, 0x27, 0xC2, 0xDB, 0xE0, 0x41, 0x36, 0x72, 0xA3, 0xCE, 0x83, 0xD7, 0xD8, 0xB3,
-    0x00, 0xDB, 0x6D, 0x6B, 0xAB, 0xA4, 0x5F, 0xA5, 0xE5, 0x45, 0xE3, 0xB4, 0xE5, 0x80, 0xC7, 0x69,
-    0x63, 0xE7, 0xA5, 0x18, 0x2B, 0x01, 0x7D, 0x80, 0xEF, 0xB5, 0x29, 0xE0, 0xE7, 0xA7, 0xE3, 0x9B,
-    0xD1, 0xED, 0x4F, 0x52, 0x12, 0x3F, 0xBA, 0x00, 0xEC, 0xFC, 0x14, 0x78, 0xCB, 0xDE, 0xDE, 0x47,
-    0x09, 0x5D, 0x16, 0xE7, 0xC7, 0x3D, 0x1D, 0x7C, 0xBD, 0xCA, 0xA9, 0xCA, 0x9E, 0xF9, 0xC7, 0x84,
-    0xB3, 0x63, 0x7B, 0xA9, 0x72, 0x6C, 0xB6, 0x2B, 0x82, 0x9B, 0x60, 0x16, 0xAF, 0xF2, 0x55, 0x8C,
-    0x17, 0x54, 0x37, 0x71, 0x48, 0xC4, 0x51, 0x9D, 0x95, 0x5C, 0x19, 0xBE, 0x63, 0xEF, 0x96, 0xD6,
-    0xD8, 0x6F, 0xA4, 0xC2, 0x67, 0x63, 0x91, 0x2F, 0x53, 0x2D, 0xB5, 0xB2, 0x3A, 0xF9, 0x99, 0x9D,
-    0x79, 0xD4, 0xC8, 0x45, 0x2A, 0xD5, 0x5A, 0x24, 0x62, 0x19, 0xE6, 0xB0, 0x39, 0x4E, 0x9C, 0x35,
-    0xDC, 0x50, 0x7C, 0x98, 0xD5, 0xA4, 0x12, 0x9F, 0x26, 0x30, 0xC8, 0xF6, 0x17, 0xB1, 0xF4, 0xC8,
-    0x7A, 0x1C, 0xBB, 0x50, 0xDE, 0x4F, 0x42, 0xE7, 0xF7, 0x44, 0xFF, 0x55, 0xB0, 0x4B, 0xD4, 0x65,
-    0xEB, 0x04, 0x4B, 0xC4, 0xD7, 0x3C, 0x7E, 0x79, 0x59, 0x62, 0x9E, 0xBE, 0x51, 0x09, 0x6C, 0x35,
-    0x1E, 0xC6, 0x6C, 0x42, 0xD2, 0xE1, 0x05, 0xC2, 0x02, 0x1B, 0xC2, 0x1D, 0xFE, 0x5F, 0x8F, 0x01,
-    0xB5, 0x7C, 0xEB, 0x9F, 0x14, 0xD5, 0xEC, 0xCF, 0x29, 0xF7, 0xC4, 0xC3, 0x30, 0x93, 0xE2, 0xE3,
-    0x0F, 0x53, 0xF9, 0xCA, 0xDB, 0x1F, 0x25, 0xEE, 0xBB, 0xF6, 0x9F, 0x63, 0xE7, 0x4F, 0x18, 0x50,
-    0xFC, 0x15, 0xE3, 0xD9, 0x3D, 0xEA, 0x2A, 0x38, 0x5C, 0x6D, 0x8E, 0x16, 0x83, 0xCA, 0x1F, 0xC7,
-    0xF4, 0xDB, 0x90, 0xD7, 0x0C, 0xFA, 0x21, 0xBC, 0x56, 0xCD, 0xD3, 0xCA, 0x5A, 0x58, 0x87, 0x1A,
-    0x34, 0x29, 0x1F, 0x51, 0xBA, 0x88, 0x16, 0x44, 0xD2, 0x20, 0xDB, 0x5C, 0x8F, 0x83, 0x35, 0x77,
-    0xD2, 0xCA, 0xCA, 0x84, 0xA7, 0x58, 0x8D, 0xE3, 0x2F, 0xCA, 0x9A, 0x34, 0x6B, 0x2E, 0x2E, 0x1A,
-    0x26, 0x5E, 0xA9, 0x99, 0x7C, 0x18, 0x47, 0x88, 0x18, 0x32, 0xF8, 0x49, 0x46, 0xD6, 0x17, 0xC0,
-    0xF4, 0x18, 0x63, 0x3C, 0x08, 0xCB, 0x3E, 0x82, 0x03, 0xD1, 0x76, 0x54, 0x9E, 0xA3, 0x74, 0x51,
-    0xA5, 0x5B, 0xED, 0x12, 0x2B, 0xDB, 0x36, 0xB4, 0xBF, 0x56, 0x53, 0x9C, 0x03, 0xC7, 0xD6, 0xF0,
-    0x3F, 0x8D, 0xE9, 0x9E, 0x1B, 0x85, 0x31, 0x71, 0xA0, 0xF9, 0x7F, 0x14, 0x38, 0x4E, 0xA8, 0x57,
-    0xE0, 0xAA, 0x7A, 0x7C, 0xB3, 0x71, 0x4A, 0x31, 0xDA, 0x26, 0x4C, 0xE6, 0xC2, 0x24, 0xE1, 0x08,
-    0x62, 0xA9, 0x8A, 0x1F, 0x66, 0x57, 0x9A, 0x75, 0x5D, 0xCC, 0xAE, 0xE4, 0xEC, 0x8B, 0x98, 0x4B,
-    0x7C, 0xF6, 0x74, 0x5A, 0x2C, 0xFC, 0xE8, 0xC0, 0x35, 0x07, 0x89, 0xC1, 0xC6, 0x6F, 0x03, 0x36,
-    0x14, 0xFB, 0x37, 0xF8, 0xE6, 0xFB, 0x34, 0x71, 0xCD, 0x0F, 0xDD, 0xAC, 0xF9, 0x09, 0x41, 0xB1,
-    0xC4, 0x26, 0xFC, 0x2F, 0x48, 0x79, 0xA9, 0x78, 0x65, 0x38, 0x6D, 0x86, 0x21, 0x9E, 0x10, 0x0F,
-    0x63, 0x8E, 0x26, 0x5A, 0x93, 0x62, 0x93, 0xBD, 0x20, 0xEA, 0x50, 0x7E, 0xCA, 0xE7, 0x7F, 0xCD,
-    0x5A, 0x3D, 0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x4B, 0x6A, 0x01, 0x5D, 0x92, 0x75, 0x00, 0xB2,
-    0x91, 0x7F, 0xD6, 0x85, 0x0B, 0xC3, 0xB0, 0xB8, 0x8D, 0x0B, 0x19, 0xB8, 0xBD, 0x5B, 0x3B, 0x40,
-    0x0C, 0x24, 0x85, 0x19, 0x80, 0xA7, 0x26, 0x80, 0xE5, 0xC2, 0x8D, 0x55, 0xC4, 0x29, 0x5C, 0x30,
-    0xC0, 0xC9, 0xDC, 0x38, 0xA5, 0x0B, 0x4B, 0x85, 0x7A, 0x95, 0x32, 0x5D, 0x50, 0x05, 0x13, 0xAC,
-    0xE1, 0x23, 0x6F, 0x61, 0x17, 0x29, 0x52, 0x64, 0x91, 0xC0, 0x48, 0xE1, 0xC2, 0x8B, 0xC4, 0x41,
-    0x10, 0xB9, 0xC8, 0x5A, 0x5E, 0x23, 0x67, 0xF9, 0xC8, 0xC9, 0xF7, 0xBD, 0xD9, 0xBD, 0x93, 0x2C,
-    0x31, 0x96, 0x28, 0xD2, 0xC9, 0x71, 0xE7, 0xED, 0x71, 0x6F, 0x6E, 0xE6, 0xBD, 0x99, 0x37, 0xEF,
-    0xFB, 0xDE, 0x23, 0x45, 0x44, 0x86, 0x12, 0x99, 0x64, 0xE4, 0x18, 0x53, 0xD5, 0x7E, 0xE9, 0x98,
-    0x32, 0x48, 0xA5, 0x9F, 0x46, 0x22, 0xA1, 0xC4, 0x22, 0x41, 0xDA, 0x15, 0xE9, 0xA4, 0x43, 0x88,
-    0x1C, 0xC2, 0xBF, 0x5D, 0x74, 0x72, 0xED, 0xA2, 0x9D, 0xC3, 0x44, 0x7A, 0xD2, 0x29, 0x9D, 0xA9,
-    0xB8, 0x66, 0xAB, 0x12, 0x79, 0xCD, 0xA4, 0xD2, 0xBE, 0x96, 0x74, 0x9A, 0xF3, 0x49, 0xE6, 0x9B,
-    0xBA, 0x0A, 0x2F, 0x8D, 0x8B, 0x1E, 0xBE, 0xD0, 0x95, 0x20, 0x19, 0x62, 0xEC, 0xCC, 0xB6, 0x3C,
-    0xD3, 0x79, 0x3A, 0x69, 0x2C, 0x81, 0x44, 0xD2, 0x97, 0xE0, 0xFA, 0x54, 0xA0, 0xCE, 0x6C, 0x90,
-    0x7A, 0x5B, 0xA4, 0xAA, 0x26, 0x22, 0x9F, 0x97, 0x10, 0x5F, 0xE7, 0x10, 0xFB, 0x02, 0x51, 0xDD,
-    0x8B, 0xC8, 0xC4, 0xA9, 0x64, 0x44, 0xD1, 0x15, 0xAF, 0x94, 0x28, 0xE9, 0xE4, 0x12, 0xDC, 0x34,
-    0x09, 0x66, 0x98, 0xCC, 0x66, 0x90, 0xC5, 0x44, 0x68, 0xCF, 0x92, 0x2C, 0x06, 0x54, 0xEF, 0x35,
-    0x8A, 0x29, 0xC5, 0x45, 0xD5, 0xF6, 0x60, 0x11, 0xD3, 0x7C, 0x28, 0x9D, 0x48, 0x78, 0x1D, 0x83,
-    0xFA, 0xE6, 0xAD, 0x44, 0xEE, 0x78, 0xB9, 0x45, 0xD7, 0xBE, 0xC9, 0x6A, 0x7B, 0xEF, 0x17, 0xF6,
-    0x1E, 0xCC, 0x57, 0x6A, 0x63, 0xFF, 0x22, 0xB6, 0xC3, 0xE4, 0x63, 0xB3, 0x27, 0x7D, 0xDC, 0x33,
-    0x67, 0x9C, 0xB0, 0x03, 0x16, 0x07, 0x9D, 0x23, 0xD8, 0xE1, 0x61, 0x6D, 0x63, 0x6B, 0x0F, 0x4C,
-    0xCB, 0xB0, 0x2E, 0xE2, 0xD2, 0x3E, 0xFC, 0xE2, 0x15, 0xBC, 0x67, 0x1C, 0x4F, 0xEF, 0x91, 0xD8,
-    0xE7, 0xB1, 0xD8, 0x7E, 0x13, 0xD1, 0xEF, 0xA1, 0xBB, 0x8E, 0x83, 0xEE, 0xC2, 0x85, 0xE7, 0xF4,
-    0x99, 0x6C, 0x24, 0xE8, 0x2E, 0xCD, 0xBC, 0xC5, 0xD8, 0x5C, 0xD4, 0xFB, 0x2D, 0xEA, 0x07, 0x49,
-    0x45, 0xED, 0xBC, 0xBF, 0xA8, 0x72, 0x62, 0x44, 0x75, 0xBB, 0x20, 0x56, 0x35, 0x1D, 0x71, 0x71,
-    0xB0, 0xC6, 0x09, 0x42, 0x33, 0xE5, 0x7C, 0x8B, 0x83, 0x89, 0x4E, 0xEF, 0x54, 0xAA, 0x8D, 0x57,
-    0x34, 0xCA, 0xE9, 0xC3, 0xC8, 0xAA, 0xD4, 0xB5, 0x96, 0xD4, 0xFA, 0x75, 0xB7, 0x54, 0x7D, 0xFC,
-    0x5C, 0xD5, 0xC1, 0xB2, 0x72, 0xA2, 0x68, 0xF3, 0xAA, 0x55, 0x66, 0x7A, 0x8B, 0x26, 0xDB, 0x81,
-    0xDE, 0x56, 0x62, 0xBD, 0x05, 0xB5, 0xDE, 0xBC, 0x52, 0x6F, 0xEC, 0xF1, 0x6A, 0x90, 0x0C, 0x06,
-    0x89, 0x6F, 0x3E, 0x49, 0xB0, 0x86, 0xE1, 0x25, 0x93, 0x0C, 0xCE, 0xE5, 0x3D, 0xDD, 0x1E, 0xF8,
-    0x61, 0xC8, 0xFD, 0x1A, 0xB2, 0x67, 0x46, 0x7D, 0x12, 0xA7, 0xD2, 0x9B, 0xAE, 0x1E, 0x06, 0x4B,
-    0xF5, 0x33, 0x2C, 0x46, 0x17, 0x3D, 0xB1, 0x63, 0x7D, 0x7C, 0x0F, 0x13, 0x04, 0xD7, 0xCD, 0xF3,
-    0x37, 0x37, 0x53, 0xD7, 0xBC, 0xF5, 0x3C, 0xC6, 0x6C, 0x34, 0x59, 0x17, 0x59, 0xC9, 0x1E, 0xA0,
-    0x8D, 0x4D, 0xAD, 0x0D, 0x43, 0xB1, 0xC1, 0x9C, 0x1F, 0x8E, 0x30, 0x23, 0xA6, 0x3B, 0x45, 0x9F,
-    0x58, 0xC0, 0xF8, 0xBD, 0xCC, 0xB6, 0x85, 0x4C, 0x17, 0x59, 0x96, 0xD0, 0xE2, 0x7B, 0x6D, 0x18,
-    0x5B, 0x9B, 0x1D, 0x7B, 0xD6, 0x60, 0x55, 0x88, 0xE5, 0x0C, 0xCA, 0xDA, 0x91, 0xBA, 0x93, 0xD7,
-    0x7E, 0xCE, 0x37, 0xD8, 0x0F, 0x27, 0xE1, 0xFB, 0x7B, 0xB8, 0x64, 0x76, 0x05, 0xA9, 0x67, 0xC4,
-    0xDB, 0x83, 0x23, 0xC8, 0xEB, 0x6E, 0x31, 0x86, 0x8E, 0x6E, 0x39, 0x4E, 0x29, 0xDF, 0xCF, 0x29,
-    0x7F, 0x57, 0x51, 0x6E, 0xD7, 0x2A, 0x87, 0x2A, 0xFB, 0x94, 0x59, 0x90, 0x50, 0xE2, 0xDC, 0x43,
-    0x7A, 0x25, 0xA5, 0xD4, 0x2A, 0x47, 0xEB, 0x94, 0x3D, 0x95, 0xA1, 0x3E, 0xE9, 0x4C, 0x28, 0x3D,
-    0x95, 0x0E, 0xA4, 0x9E, 0x26, 0x95, 0xF4, 0x61, 0x71, 0x42, 0xEE, 0x87, 0x67, 0xB8, 0xF5, 0xEE,
-    0x55, 0xBB, 0x33, 0x09, 0xF5, 0xF1, 0x54, 0x1F, 0x48, 0x1E, 0x88, 0x84, 0xFA, 0x88, 0x50, 0x1F,
-    0x27, 0xA1, 0x3E, 0x5E, 0x41, 0x7D, 0x20, 0xFB, 0x94, 0xD4, 0x07, 0x12, 0xFA, 0x40, 0x42, 0x1F,
-    0xBA, 0x6B, 0xAD, 0x72, 0xB4, 0x4E, 0xD9, 0x53, 0x19, 0xEA, 0x93, 0xCE, 0x84, 0xD2, 0x53, 0xE9,
-    0x4C, 0x54, 0x07, 0xB9, 0x53, 0xFA, 0xD4, 0xCA, 0xD1, 0x30, 0xE8, 0xEC, 0x5B, 0xA5, 0xA8, 0x60,
-    0xC5, 0xDF, 0xAB, 0xF6, 0x57, 0x91, 0xD5, 0xF3, 0x89, 0xAC, 0xDE, 0x30, 0x95, 0x53, 0x99, 0x9F,
-    0x4D, 0x9D, 0x0A, 0xF1, 0xC6, 0x41, 0x94, 0x8B, 0x9D, 0xAA, 0xBE, 0x1F, 0xD1, 0x0E, 0x3A, 0x17,
-    0x7A, 0x1C, 0xD4, 0x53, 0x8D, 0x9D, 0xA8, 0x0A, 0xB1, 0xFB, 0x88, 0xDA, 0x01, 0x3E, 0xF5, 0x9B,
-    0x93, 0xED, 0xE1, 0xF3, 0x4E, 0x69, 0x9F, 0x3D, 0x86, 0x00, 0x1B, 0xC3, 0xE3, 0xBA, 0x70, 0x8F,
-    0xEC, 0x34, 0xBC, 0x21, 0xC4, 0x40, 0x41, 0xE2, 0x96, 0x9D, 0xD4, 0xBB, 0xFE, 0x6E, 0xEE, 0x23,
-    0x1C, 0x04, 0x97, 0xCF, 0x72, 0x94, 0x0A, 0xCE, 0x9A, 0xA1, 0xD7, 0x10, 0xA3, 0xC5, 0x35, 0xE3,
-    0x12, 0x46, 0x78, 0xAE, 0x42, 0x68, 0x40, 0x58, 0xA0, 0x27, 0xE0, 0x75, 0x3E, 0x09, 0x4C, 0xF5,
-    0x83, 0xE7, 0x26, 0x8C, 0xFC, 0x74, 0xB8, 0xAE, 0x6B, 0xA6, 0xD1, 0xF5, 0xD1, 0x05, 0xE9, 0x4E,
-    0xA4, 0x5B, 0xCB, 0x68, 0xE4, 0x4C, 0x37, 0xB6, 0x46, 0xE1, 0xDE, 0xD3, 0x56, 0x11, 0x9C, 0x68,
-    0x9C, 0x66, 0x9C, 0x64, 0x55, 0x5B, 0xFA, 0x38, 0xF8, 0x1A, 0xD0, 0xEE, 0xF1, 0x7A, 0x78, 0xC2,
-    0xAF, 0xD8, 0x71, 0x7A, 0x5D, 0x1D, 0x47, 0x2D, 0x74, 0x92, 0x7B, 0x1D, 0xC1, 0xBE, 0xBA, 0x3E,
-    0xB6, 0x2B, 0xE4, 0x59, 0xF4, 0xA7, 0xED, 0x66, 0xE9, 0x2B, 0x52, 0xAC, 0x30, 0x95, 0xF8, 0x84,
-    0x38, 0x04, 0x89, 0x9E, 0xDC, 0x8E, 0x91, 0x77, 0x81, 0xC7, 0xFB, 0xC2, 0x48, 0xF1, 0xD3, 0x6D,
-    0x71, 0xBE, 0x80, 0xF5, 0xF0, 0x56, 0x5D, 0x51, 0xBB, 0x8A, 0x00, 0x93, 0x5A, 0x82, 0x4B, 0x3B,
-    0x3A, 0xE1, 0xDD, 0x31, 0x33, 0x38, 0x10, 0x33, 0x15, 0x72, 0xBE, 0xC4, 0x4C, 0xFD, 0xBC, 0x0D,
-    0x8D, 0x42, 0x18, 0x9D, 0xDC, 0x47, 0x63, 0x80, 0x26, 0x72, 0x02, 0x38, 0x8B, 0x28, 0x09, 0x72,
-    0xC0, 0x26, 0xD4, 0x9F, 0xA3, 0xA6, 0x97, 0xAF, 0x8B, 0x73, 0x03, 0x73, 0x6E, 0xE4, 0x33, 0xBD,
-    0x81, 0xA0, 0xAA, 0xEB, 0xB7, 0x35, 0xE2, 0x26, 0x61, 0x93, 0xA8, 0x39, 0x03, 0xCD, 0xC1, 0x1A,
-    0xC6, 0x9F, 0xEA, 0x5D, 0x5F, 0xE5, 0xEB, 0x16, 0x42, 0x56, 0x1F, 0x3F, 0x72, 0xFD, 0x3D, 0xAC,
-    0x2D, 0x9B, 0x3D, 0x9D, 0xAB, 0xE8, 0x51, 0x61, 0xCD, 0xAA, 0x07, 0xB7, 0xC1, 0x32, 0x16, 0x1B,
-    0x09, 0x3A, 0x78, 0xB4, 0x70, 0xBC, 0x76, 0xE8, 0x89, 0xE7, 0xC9, 0xE1, 0x1E, 0x3F, 0x7A, 0xB4,
-    0xB6, 0x38, 0xC9, 0x82, 0x38, 0x08, 0xBC, 0xB2, 0x81, 0xF1, 0x23, 0xEC, 0xF1, 0xE2, 0x31, 0xDB,
-    0xA2, 0x67, 0xA1, 0xF5, 0x29, 0x9C, 0x85, 0x53, 0xC7, 0xB0, 0x37, 0x13, 0x8B, 0x82, 0x42, 0x1E,
-    0xE1, 0x1C, 0xAF, 0x3D, 0x0A, 0x54, 0x75, 0x33, 0x5F, 0xE7, 0x68, 0x6D, 0x39, 0xF1, 0x0E, 0x88,
-    0x51, 0xF1, 0xAC, 0x8F, 0xE1, 0x47, 0x0A, 0xED, 0x2B, 0x4A, 0x2A, 0xF6, 0x77, 0x37, 0x77, 0x33,
-    0xC6, 0xFA, 0x6E, 0x4F, 0xB2, 0xF0, 0xB3, 0xCA, 0xB7, 0x71, 0x86, 0x07, 0xCA, 0x00, 0x89, 0x06,
-    0x03, 0xBB, 0x08, 0xAF, 0x23, 0xF6, 0x66, 0xF8, 0xD2, 0x43, 0x0B, 0x47, 0x0A, 0x06, 0x1D, 0x53,
-    0x76, 0x34, 0x06, 0x39, 0x92, 0xF8, 0x1F, 0x16, 0xFE, 0x9B, 0xC5, 0x21, 0xF0, 0xC0, 0x6A, 0x3A,
-    0xDE, 0x9B, 0x6B, 0x46, 0x38, 0x75, 0xD3, 0xE3, 0xD1, 0x94, 0x0A, 0x01, 0xB6, 0x9E, 0x3C, 0x04,
-    0x72, 0x85, 0x0A, 0xB1, 0xE1, 0x8C, 0x12, 0x12, 0x2A, 0xC8, 0x9B, 0xC1, 0x9E, 0x31, 0x72, 0xA6,
-    0x3E, 0x50, 0xD5, 0xEA, 0x07, 0xB5, 0x6A, 0x4E, 0xD9, 0x49, 0x2D, 0x65, 0xFD, 0x6A, 0xC0, 0xB4,
-    0x81, 0x7C, 0x32, 0x96, 0xFD, 0xCD, 0x54, 0xDE, 0xD8, 0xE4, 0x73, 0xC3, 0x88, 0xE4, 0x7C, 0x39,
-    0xB0, 0xF1, 0xA3, 0x56, 0xD3, 0x6B, 0x4D, 0x13, 0x6A, 0xA2, 0x08, 0x3E, 0x2F, 0x7B, 0x2A, 0x45,
-    0xB5, 0xEF, 0xB4, 0x01, 0xDF, 0x79, 0x47, 0x5E, 0x85, 0x26, 0x7F, 0x36, 0xC5, 0x63, 0x3F, 0x36,
-    0x6F, 0xD6, 0xCC, 0x8F, 0x46, 0x74, 0x8C, 0x2E, 0x45, 0x7C, 0xC2, 0x18, 0xB3, 0x17, 0xFD, 0x73,
-    0x7F, 0xF3, 0xEA, 0x90, 0x8F, 0x27, 0x14, 0xB5, 0xEC, 0x91, 0xB0, 0x19, 0x59, 0xD8, 0xD8, 0x7A,
-    0xEB, 0xE6, 0x24, 0xDC, 0x73, 0xDB, 0x60, 0xA8, 0xAF, 0x87, 0xCD, 0xA7, 0x9C, 0x67, 0x2A, 0x5E,
-    0x2D, 0xAF, 0x48, 0xA0, 0x86, 0xF2, 0x79, 0xAF, 0x59, 0x32, 0x5D, 0x21, 0x8A, 0xA7, 0xAE, 0x42,
-    0x00, 0x80, 0x87, 0xB2, 0x7C, 0x81, 0xCF, 0x62, 0xFC, 0x9C, 0x1A, 0x03, 0xF4, 0x22, 0xC3, 0xF4,
-    0x22, 0xE6, 0x66, 0xC5, 0x38, 0x11, 0x9F, 0xED, 0x71, 0x79, 0xDA, 0x73, 0xFE, 0xAA, 0x03, 0xDD,
-    0x3F, 0x4E, 0xC8, 0xCF, 0x01, 0x6E, 0x09, 0x99, 0xF9, 0x08, 0x8B, 0x92, 0x35, 0x6D, 0xA4, 0x60,
-    0x17, 0xE8, 0x67, 0xE1, 0x65, 0x3A, 0xFD, 0x1F, 0x13, 0x32, 0x7B, 0x8D, 0x72, 0x21, 0x8C, 0x3E,
-    0xB9, 0x75, 0x71, 0x89, 0xB0, 0x08, 0x05, 0x3B, 0x6D, 0xAA, 0x12, 0xC3, 0x35, 0x82, 0x73, 0x58,
-    0x38, 0x00, 0x88, 0x53, 0xCF, 0xCD, 0x80, 0x15, 0xDE, 0x44, 0x5E, 0x09, 0x1A, 0x8C, 0xEA, 0x35,
-    0x06, 0x0C, 0xB5, 0x2D, 0xAF, 0x51, 0xFB, 0xA1, 0x9C, 0xDA, 0xA1, 0xEE, 0x38, 0x11, 0x31, 0xFA,
-    0xC4, 0x54, 0xDC, 0x27, 0xB9, 0xA2, 0xDA, 0x73, 0xAD, 0x15, 0xA8, 0xDD, 0xBF, 0x15, 0x16, 0xA8,
-    0x7B, 0x73, 0x5B, 0xFC, 0x99, 0x2D, 0x7D, 0xB5, 0x65, 0x78, 0x8B, 0x2D, 0x59, 0x63, 0x0B, 0x73,
-    0x0A, 0x26, 0x14, 0xC8, 0x26, 0x12, 0xD7, 0xBC, 0x9D, 0xD8, 0x08, 0x14, 0xE8, 0xC2, 0x2E, 0xC9,
-    0x1B, 0x3A, 0x4D, 0x07, 0xE9, 0xCE, 0x6C, 0x9E, 0x2F, 0x9A, 0x79, 0x56, 0xDA, 0x84, 0x83, 0xC0,
-    0xCF, 0xE4, 0x69, 0x04, 0x1A, 0x0B, 0x2A, 0x0B, 0x22, 0x97, 0x31, 0x93, 0x89, 0xAD, 0xAF, 0xBD,
-    0x8F, 0x36, 0xDE, 0x11, 0xD9, 0x61, 0xEE, 0xC7, 0x3C, 0x90, 0x9F, 0x6B, 0x7E, 0x38, 0x45, 0x43,
-    0x34, 0xC0, 0xFC, 0x24, 0x0E, 0x0D, 0x55, 0x22, 0x57, 0x22, 0x59, 0x9A, 0x13, 0xA0, 0x86, 0xBD,
-    0xDE, 0xD9, 0x1C, 0x24, 0x48, 0x9D, 0x1C, 0xE1, 0x0D, 0xEF, 0x47, 0xE2, 0xFD, 0xA9, 0x62, 0x26,
-    0x28, 0xDE, 0x27, 0x29, 0x00, 0x14, 0xF7, 0x1B, 0xF8, 0xBD, 0x20, 0x63, 0x8B, 0xD1, 0x42, 0xB1,
-    0x7D, 0xBD, 0xF2, 0xD8, 0xC9, 0x13, 0x63, 0xA8, 0x9B, 0x37, 0x21, 0xC1, 0x0A, 0x57, 0x33, 0xC5,
-    0xB5, 0x07, 0x60, 0x4F, 0x8F, 0xE1, 0xBB, 0x3C, 0xDD, 0x67, 0x9A, 0x46, 0xF6, 0xC4, 0xDA, 0x40,
-    0xDF, 0xB4, 0xE2, 0xB8, 0xCD, 0xDA, 0xE6, 0x71, 0x2E, 0x6E, 0xB3, 0xCD, 0xD9, 0x6B, 0xCC, 0xF2,
-    0x30, 0x23, 0xDB, 0x03, 0x11, 0xC4, 0x83, 0x4C, 0x6C, 0x08, 0x9D, 0x7C, 0x5E, 0x59, 0x42, 0x17,
-    0xCE, 0x62, 0x5A, 0xC2, 0xC6, 0x74, 0x58, 0xB1, 0x46, 0xC9, 0x46, 0xE3, 0xFF, 0x3C, 0x6A, 0x8C,
-    0x14, 0xEF, 0x32, 0xCB, 0x09, 0x53, 0x1B, 0xAA, 0xBD, 0xA6, 0x75, 0xF2, 0xC7, 0xF1, 0xAC, 0xBF,
-    0xB9, 0x8F, 0x31, 0x66, 0xB1, 0x25, 0x70, 0x4A, 0xEF, 0xF7, 0xB9, 0x63, 0x9A, 0x00, 0xB2, 0x3C,
-    0x58, 0xDB, 0x30, 0xD3, 0xE5, 0xC1, 0x84, 0x60, 0x09, 0xE7, 0x0C, 0xF5, 0x39, 0xAC, 0xFC, 0x0A,
-    0x86, 0x16, 0x72, 0xA2, 0x16, 0x1B, 0x54, 0x14, 0xDE, 0xF4, 0xCD, 0x70, 0xD5, 0x99, 0x8C, 0x4D,
-    0x19, 0x69, 0x5E, 0x75, 0xDA, 0xCB, 0x83, 0xB7, 0x99, 0x83, 0x8A, 0x9D, 0x60, 0x55, 0xDF, 0xDC,
-    0xCF, 0x85, 0x93, 0x04, 0x76, 0x03, 0xB2, 0xF1, 0xFF, 0x56, 0x7F, 0xA1, 0x3E, 0xCD, 0x63, 0xA6,
-    0xFF, 0xAA, 0xCD, 0x77, 0x59, 0x71, 0x69, 0x72, 0x86, 0xFF, 0x72, 0xFB, 0xAE, 0x4A, 0x2D, 0xF3,
-    0x52, 0x59, 0xCF, 0x16, 0x5E, 0xA4, 0x3C, 0x96, 0xE8, 0xAE, 0x1B, 0x4C, 0x07, 0x0E, 0x9A, 0x13,
-    0x72, 0x0C, 0xD1, 0x7D, 0xDD, 0xAE, 0xC8, 0x1D, 0x62, 0x89, 0xA2, 0xAB, 0x62, 0x67, 0x70, 0x2E,
-    0xE9, 0x8E, 0x71, 0xE2, 0xBA, 0xBB, 0x9B, 0x5B, 0xCD, 0xB3, 0xBB, 0x8B, 0x4E, 0x3E, 0xC2, 0x56,
-    0x7E, 0x5D, 0x63, 0x5B, 0x6F, 0xA9, 0xD7, 0x5D, 0xDB, 0xA8, 0xE5, 0xB7, 0xA0, 0x50, 0xE3, 0x34,
-    0x4C, 0x76, 0xD9, 0x07, 0x36, 0x21, 0x6C, 0x23, 0x20, 0xB4, 0xCD, 0xCF, 0xAD, 0x6B, 0x84, 0x0D,
-    0x30, 0x00, 0x50, 0x60, 0x7A, 0x16, 0xC2, 0x17, 0x76, 0xE1, 0x71, 0xD8, 0x07, 0x3A, 0x5B, 0x53,
-    0x75, 0xBA, 0xA3, 0x49, 0x8B, 0xFE, 0x5C, 0x6F, 0x66, 0x38, 0xAE, 0xDD, 0x28, 0x96, 0x5D, 0x58,
-    0x74, 0x61, 0xC9, 0x85, 0x05, 0x17, 0x96, 0x5B, 0x58, 0x6C, 0x61, 0xA9, 0x85, 0x85, 0x16, 0x96,
-    0x59, 0x58, 0x64, 0x61, 0x89, 0x85, 0x05, 0x16, 0x96, 0x57, 0x58, 0x5C, 0x61, 0x69, 0x85, 0x85,
-    0x15, 0x96, 0x55, 0x58, 0x54, 0x11, 0xAD, 0x51, 0xF0, 0x90, 0xAD, 0xDB, 0x8C, 0x86, 0x75, 0x92,
-    0x1B, 0x86, 0x35, 0x92, 0x29, 0x89, 0x18, 0xF8, 0xDB, 0x81, 0x97, 0x2D, 0x41, 0x34, 0xA8, 0x46,
-    0x76, 0x4F, 0xAA, 0x78, 0x1A, 0xE3, 0x9C, 0x01, 0xC1, 0x7B, 0xFA, 0x8C, 0xA5, 0x8D, 0x2D, 0x75,
-    0x3C, 0xDD, 0x52, 0x47, 0x04, 0x96, 0x2A, 0x40, 0xA6, 0xD3, 0x81, 0x7B, 0xFA, 0xB9, 0x07, 0xCF,
-    0xEB, 0x80, 0x62, 0xD1, 0x67, 0xF1, 0xC9, 0x24, 0x6E, 0x68, 0xE3, 0x84, 0x16, 0xFB, 0x25, 0x3D,
-    0xFB, 0x09, 0x2D, 0x6C, 0x63, 0xA7, 0x3F, 0xC8, 0x71, 0x39, 0xFF, 0x00, 0x7D, 0x93, 0x43, 0x31,
-    0xDD, 0x79, 0x0D, 0x38, 0x9A, 0x2D, 0xAB, 0xC8, 0x15, 0xF9, 0x5F, 0x30, 0xCA, 0x86, 0xE2, 0x14,
-    0xAD, 0x4A, 0xCA, 0x3B, 0xCE, 0xC8, 0x31, 0x11, 0x4C, 0x6B, 0x70, 0xDC, 0x24, 0xCB, 0x16, 0xF1,
-    0x34, 0x59, 0x8E, 0xF6, 0x5F, 0x22, 0xB4, 0x4E, 0x5B, 0x68, 0x75, 0x01, 0x1F, 0x20, 0x1B, 0xE8,
-    0x1A, 0xBC, 0x08, 0x68, 0x5D, 0x21, 0xB4, 0x0E, 0x89, 0xA5, 0x15, 0x84, 0x8B, 0xFD, 0x1A, 0xFA,
-    0x29, 0x44, 0x40, 0x68, 0x8D, 0x09, 0xAD, 0xF4, 0xEB, 0xB0, 0x6A, 0xA1, 0xB5, 0x43, 0x68, 0x0D,
-    0x09, 0xAD, 0x0B, 0xF3, 0xDA, 0xC8, 0x5D, 0xCE, 0xF9, 0xF9, 0x9F, 0xE0, 0x9C, 0x1B, 0x09, 0x15,
-    0x4D, 0xC7, 0xD2, 0x75, 0xFE, 0x95, 0x0C, 0xBD, 0x3F, 0xA4, 0x59, 0xF0, 0xD3, 0x34, 0xC3, 0x9C,
-    0xD9, 0x10, 0x68, 0x5A, 0x05, 0x69, 0xBF, 0x00, 0x9A, 0xA6, 0x16, 0x4D, 0x7B, 0x58, 0xB4, 0xA5,
-    0x76, 0xD9, 0x3E, 0x2C, 0xB1, 0x29, 0x18, 0xF7, 0x1A, 0x9C, 0xEA, 0xC9, 0x47, 0x8E, 0xBA, 0xC4,
-    0x36, 0xEC, 0xC9, 0x0A, 0x2C, 0x7C, 0x21, 0x75, 0x7F, 0x9D, 0xDF, 0xB7, 0xA3, 0x2D, 0x02, 0x15,
-    0xFB, 0x88, 0xE8, 0xEF, 0xFD, 0x42, 0xE4, 0xE2, 0xC9, 0xA3, 0x55, 0x6D, 0x00, 0xEE, 0x92, 0xFB,
-    0x97, 0xCB, 0x93, 0xF2, 0xF2, 0x21, 0x0E, 0xC0, 0x68, 0x28, 0xF1, 0x8A, 0x04, 0x38, 0x77, 0xCF,
-    0xD3, 0xE3, 0x36, 0x4C, 0x3D, 0x36, 0xB5, 0x22, 0xD7, 0xFC, 0xDA, 0x19, 0xAC, 0x8E, 0x4D, 0xB5,
-    0xBB, 0x79, 0xE5, 0x1B, 0xCF, 0x33, 0x62, 0x23, 0xFB, 0xD3, 0x8D, 0x7A, 0x12, 0x62, 0x79, 0x7E,
-    0x94, 0xBB, 0x79, 0x93, 0x71, 0xFA, 0x38, 0xBF, 0x97, 0x26, 0x3D, 0x89, 0xE1, 0x31, 0x43, 0x89,
-    0x10, 0x4E, 0x77, 0x37, 0x37, 0xB3, 0x96, 0x4C, 0x44, 0xC9, 0x42, 0x70, 0x73, 0xD4, 0xFC, 0x01,
-    0x68, 0x0D, 0x4C, 0x23, 0x0D, 0xCE, 0xE6, 0xDF, 0x93, 0xE2, 0xF0, 0x3A, 0x2C, 0xCF, 0xD6, 0xE1,
-    0x97, 0xF7, 0xAD, 0x80, 0xC2, 0x52, 0x18, 0x24, 0xFE, 0x6F, 0x72, 0x47, 0xF5, 0x07, 0xF3, 0x71,
-    0x0D, 0x73, 0xA7, 0x7B, 0xBC, 0x9C, 0x71, 0xEA, 0x29, 0x00, 0x7C, 0x63, 0x1C, 0x7A, 0xE7, 0x3D,
-    0x8E, 0xB0, 0x2A, 0xD1, 0x54, 0x7E, 0x75, 0x4E, 0x5E, 0xF6, 0x0F, 0x5F, 0x83, 0x9D, 0x0D, 0x72,
-    0xC5, 0x3F, 0x44, 0x01, 0xD6, 0xD5, 0xC0, 0x56, 0x33, 0x02, 0x76, 0xE1, 0x84, 0x72, 0xD2, 0xFF,
-    0xEE, 0x0A, 0xB0, 0x2B, 0xF0, 0x6D, 0x1C, 0x74, 0xF1, 0x3E, 0x80, 0x32, 0xC5, 0x95, 0x07, 0x2F,
-    0xC0, 0x62, 0x29, 0x30, 0x22, 0x29, 0xEA, 0xE9, 0x9F, 0x03, 0x21, 0x9F, 0x69, 0xAB, 0x17, 0xC7,
-    0x6D, 0xCB, 0xB2, 0x28, 0x15, 0xF0, 0x3E, 0xBA, 0x26, 0x9E, 0x3C, 0x73, 0x24, 0x85, 0xE4, 0x11,
-    0x1D, 0x84, 0xEB, 0x03, 0xA8, 0x6F, 0xA2, 0x0F, 0xB8, 0x32, 0xF9, 0x22, 0xB0, 0xDD, 0x69, 0x73,
-    0x4B, 0x52, 0x4C, 0xD2, 0x89, 0x15, 0xB4, 0x58, 0x76, 0xCE, 0x4E, 0xF0, 0x79, 0x21, 0xBB, 0x5B,
-    0xCC, 0x43, 0xF3, 0x26, 0x0F, 0xAD, 0x2D, 0xD5, 0xB8, 0x3D, 0x17, 0xFD, 0x46, 0x64, 0x5B, 0x74,
-    0xAF, 0x04, 0x61, 0x15, 0x5C, 0x58, 0x0D, 0x4A, 0x56, 0x1D, 0xC0, 0x8E, 0x0E, 0xBA, 0x6C, 0x3E,
-    0x94, 0x4A, 0xE7, 0x6C, 0x21, 0xDF, 0x6F, 0x20, 0xF3, 0xA8, 0xF4, 0x5A, 0x5C, 0x8D, 0xA6, 0xEF,
-    0xBD, 0x74, 0xE5, 0x04, 0xA8, 0xC7, 0x53, 0x9F, 0x9B, 0x7F, 0x7F, 0xB4, 0x8F, 0x44, 0xA7, 0xBE,
-    0xE3, 0x47, 0xC1, 0xFB, 0xC5, 0x14, 0xB1, 0x3F, 0xB7, 0x25, 0xBD, 0x6B, 0xCF, 0x1C, 0x4B, 0x49,
-    0x34, 0xA2, 0xC1, 0x2F, 0xE4, 0x8D, 0x77, 0x5E, 0x7B, 0xF0, 0x32, 0x28, 0xB3, 0xBD, 0x71, 0x25,
-    0xCE, 0xDF, 0xD7, 0xC5, 0x4D, 0x1F, 0x39, 0x7A, 0x9D, 0x97, 0xC9, 0x3B, 0x4A, 0x78, 0xE1, 0xB6,
-    0x78, 0xC9, 0x13, 0x47, 0x51, 0xB6, 0x75, 0xCD, 0xA7, 0x48, 0x74, 0x7A, 0xB2, 0x34, 0xD4, 0x08,
-    0x3A, 0x54, 0xA2, 0x1F, 0x15, 0xE2, 0xB3, 0x52, 0x58, 0x8A, 0x3F, 0x51, 0xE2, 0x67, 0xD3, 0xC4,
-    0x78, 0x55, 0x46, 0xE3, 0xAD, 0x7A, 0xC3, 0x1E, 0x8A, 0x25, 0xED, 0xBD, 0xAD, 0x39, 0x43, 0x4A,
-    0x1A, 0x13, 0x99, 0xE2, 0xC2, 0x89, 0x7C, 0x5B, 0x83, 0x37, 0x58, 0x5B, 0x88, 0x24, 0x0E, 0x67,
-    0x32, 0x2C, 0x98, 0x80, 0x3A, 0x15, 0x50, 0x6F, 0x77, 0x2B, 0xDF, 0xB0, 0x7F, 0xB4, 0x5B, 0xB3,
-    0xEB, 0x42, 0x72, 0xE2, 0xD0, 0xB1, 0x4C, 0x69, 0x48, 0x94, 0x42, 0x99, 0xB3, 0xFB, 0xC3, 0xB4,
-    0x76, 0x0B, 0x82, 0x26, 0x4B, 0x78, 0xD4, 0xAA, 0x09, 0xBA, 0xEA, 0xC1, 0x99, 0x52, 0x09, 0x2F,
-    0x63, 0xAE, 0x04, 0xB2, 0x93, 0x1E, 0x70, 0xC1, 0x17, 0x6E, 0x26, 0x8E, 0xAD, 0x46, 0x2C, 0x29,
-    0x4F, 0xBE, 0xD6, 0x18, 0xD8, 0x2C, 0x16, 0xAC, 0xDC, 0x97, 0xD3, 0x80, 0x19, 0xCB, 0xE5, 0xF0,
-    0x1D, 0xBD, 0x47, 0xB6, 0x96, 0xF0, 0x1A, 0xF9, 0x1B, 0x08, 0xC1, 0xC5, 0xA8, 0xE1, 0x7A, 0x7E,
-    0x3E, 0x6F, 0xDA, 0x0F, 0xDF, 0x43, 0x26, 0x80, 0x65, 0x75, 0xC6, 0x85, 0xFE, 0x79, 0xAD, 0x8F,
-    0xA7, 0x0F, 0x59, 0x1E, 0x18, 0x99, 0xF2, 0x51, 0xB7, 0x9E, 0x43, 0x20, 0x98, 0x7A, 0x08, 0xBC,
-    0xCA, 0xDD, 0xBF, 0xDA, 0x5A, 0x74, 0x57, 0xAF, 0x21, 0x8B, 0x03, 0x2E, 0x3F, 0x3A, 0x61, 0xA4,
-    0xFF, 0xA9, 0x3C, 0x7B, 0xCB, 0x9F, 0xA5, 0xF8, 0x5F, 0x10, 0xFC, 0x0F, 0x88, 0xE6, 0xBF, 0x1F,
-    0xD6, 0xD5, 0x9F, 0xEE, 0xDE, 0x76, 0x06, 0x83, 0x0A, 0x0B, 0x0F, 0xEC, 0xDD, 0x3C, 0xB0, 0x4F,
-    0xDB, 0xDA, 0xCA, 0x16, 0xFF, 0x37, 0x40, 0x2B, 0x5B, 0xE5, 0xB7, 0x55, 0xB6, 0xDE, 0x11, 0xEF,
-    0x63, 0x93, 0x7B, 0x7B, 0x2F, 0x54, 0xC8, 0x7F, 0x2A, 0xF4, 0xAF, 0xC9, 0x91, 0xBF, 0xAD, 0xFD,
-    0x07, 0x75, 0x54, 0x31, 0x6F, 0x23, 0x45, 0x14, 0xFE, 0xD6, 0xCE, 0xC6, 0x89, 0xAD, 0x78, 0xA7,
-    0x88, 0x81, 0xCB, 0x91, 0xAC, 0x8B, 0x14, 0x47, 0xEE, 0xEC, 0xDD, 0xC2, 0x48, 0x41, 0x5A, 0xDB,
-    0x23, 0x28, 0x68, 0x57, 0x28, 0xA1, 0xE4, 0x56, 0x94, 0x48, 0x28, 0x5B, 0x04, 0x29, 0x67, 0x85,
-    0x78, 0x28, 0xAE, 0x3D, 0xF9, 0x27, 0x6C, 0x01, 0x08, 0x99, 0xE2, 0xB6, 0xE0, 0x50, 0x40, 0x3E,
-    0xED, 0x20, 0x0A, 0xDA, 0x81, 0x92, 0x02, 0x6D, 0x01, 0x48, 0xD7, 0xB9, 0x30, 0xC2, 0x48, 0x4E,
-    0x86, 0x37, 0xEB, 0x5C, 0x2E, 0xE8, 0xC4, 0xCC, 0x68, 0xEC, 0x99, 0x37, 0x3B, 0xEF, 0x7D, 0xDF,
-    0xF7, 0xDE, 0x00, 0x3D, 0x38, 0xBC, 0x22, 0x2D, 0x05, 0x94, 0xF3, 0x9A, 0x70, 0xB1, 0x0F, 0x6A,
-    0xA5, 0x39, 0x2A, 0x17, 0x70, 0x1C, 0xBE, 0x5F, 0x92, 0x16, 0x98, 0x9B, 0x27, 0x5D, 0xAD, 0xFC,
-    0xDB, 0x3C, 0xBB, 0xCC, 0x2E, 0xC9, 0xDC, 0xD7, 0x8B, 0xBD, 0xF1, 0x57, 0xA1, 0x9D, 0xD6, 0xFB,
-    0x8B, 0x5A, 0xBE, 0x19, 0x04, 0xB4, 0x77, 0xD2, 0x3A, 0x69, 0x01, 0x6F, 0x60, 0x28, 0x4B, 0xB2,
-    0x2C, 0x5D, 0xFE, 0x3A, 0x56, 0x60, 0xA3, 0x2F, 0xD3, 0x3C, 0x49, 0x07, 0xCA, 0xE5, 0x74, 0xA4,
-    0xF2, 0x63, 0xEE, 0xBC, 0x2B, 0x77, 0x1C, 0x74, 0xEE, 0x18, 0x27, 0x41, 0x45, 0x3A, 0xF7, 0x51,
-    0x5E, 0xC0, 0x9A, 0x61, 0x4A, 0xAD, 0x98, 0x8A, 0x3F, 0xA6, 0x4D, 0x4E, 0xD1, 0x6D, 0xC3, 0xA9,
-    0xF1, 0xF2, 0xDB, 0x92, 0x62, 0x93, 0x65, 0xF5, 0xDE, 0xC3, 0xA5, 0x3F, 0x3B, 0xF4, 0x16, 0xDF,
-    0x7D, 0x90, 0xAC, 0xD6, 0xB7, 0xBB, 0xC1, 0x64, 0x1E, 0xB6, 0x7B, 0xC1, 0xE9, 0x71, 0x8A, 0xF9,
-    0xE4, 0x34, 0x68, 0xD5, 0xD1, 0xEE, 0x75, 0x83, 0x93, 0x94, 0xBE, 0xEF, 0xC2, 0x45, 0x45, 0x18,
-    0x5C, 0xE4, 0x86, 0xB7, 0x70, 0x0C, 0x70, 0x4B, 0xDE, 0x95, 0x7D, 0x69, 0x49, 0x70, 0x86, 0x0E,
-    0x7A, 0xA2, 0x2F, 0x3B, 0x60, 0xC8, 0x16, 0x1F, 0x4D, 0x10, 0x2C, 0x7B, 0x39, 0x2F, 0xAB, 0x9A,
-    0x1C, 0xE2, 0x9C, 0x6E, 0x58, 0xEF, 0xC6, 0x71, 0xD7, 0xAE, 0xC2, 0x81, 0xCB, 0xB3, 0x1C, 0xC8,
-    0xF2, 0xA3, 0x91, 0x43, 0x2B, 0xD3, 0x1C, 0x1C, 0x8D, 0xB2, 0xDC, 0x41, 0x15, 0x0D, 0xAE, 0x8B,
-    0x80, 0x29, 0xC2, 0xAB, 0x3E, 0x14, 0x67, 0xB4, 0x9E, 0x5E, 0xF7, 0x8C, 0x7B, 0x9C, 0x9D, 0x9F,
-    0xB3, 0xE7, 0x1C, 0xDD, 0x64, 0xA5, 0xD1, 0x0A, 0x8E, 0xC3, 0x2A, 0xEA, 0x30, 0x12, 0xBC, 0x2A,
-    0x87, 0xDC, 0x42, 0x0D, 0xF7, 0x8A, 0x58, 0x3C, 0x69, 0xF3, 0x82, 0x8D, 0xA1, 0x56, 0x67, 0x5F,
-    0xAB, 0x18, 0x66, 0x30, 0xF0, 0x30, 0x0C, 0xD3, 0x69, 0xDE, 0xD7, 0xD2, 0xB6, 0x8D, 0xDF, 0xEE,
-    0x0D, 0x16, 0xAF, 0x95, 0x73, 0x1D, 0x90, 0x72, 0xDC, 0xFE, 0x2F, 0x61, 0x16, 0xB8, 0xA7, 0xD4,
-    0x03, 0x2D, 0xA3, 0x1D, 0x18, 0x25, 0x87, 0xFA, 0x22, 0xD3, 0x97, 0x8D, 0xC3, 0x03, 0xD2, 0x93,
-    0xE6, 0x6B, 0x61, 0x49, 0x71, 0x2F, 0xCF, 0xDF, 0xD2, 0x32, 0x2E, 0x64, 0x5B, 0x6E, 0x6A, 0x6A,
-    0xD3, 0x62, 0xC2, 0x1A, 0x9E, 0x56, 0x66, 0x7D, 0x71, 0x52, 0x30, 0x91, 0xA3, 0xA4, 0x08, 0x3C,
-    0x71, 0x4D, 0x91, 0x1B, 0x76, 0xB6, 0x49, 0x59, 0x82, 0x0A, 0xA4, 0x86, 0x04, 0xAB, 0x30, 0x96,
-    0xC9, 0xC8, 0x8D, 0x71, 0xA7, 0x30, 0x52, 0x8E, 0x7D, 0x03, 0x84, 0x40, 0x33, 0xD8, 0xD8, 0x08,
-    0x9A, 0x4B, 0x68, 0x34, 0x08, 0x69, 0xE3, 0x90, 0xD3, 0xC8, 0x74, 0x9E, 0x20, 0xA1, 0xF1, 0xFD,
-    0x38, 0x1F, 0x8F, 0x13, 0x42, 0x4A, 0x78, 0x09, 0x35, 0x61, 0x07, 0x3E, 0x51, 0x9E, 0x70, 0xF9,
-    0x40, 0x31, 0xBE, 0xFE, 0x69, 0xBA, 0xDF, 0xAA, 0x9F, 0x86, 0x2F, 0x43, 0xA0, 0xFC, 0x29, 0x32,
-    0xBB, 0x24, 0x28, 0x26, 0xE1, 0xE1, 0x14, 0x09, 0x6E, 0xC2, 0x3F, 0xB8, 0xD8, 0xD9, 0xDE, 0x05,
-    0x9D, 0x9F, 0xE1, 0xC9, 0xDF, 0xF2, 0xDB, 0x9F, 0x24, 0x45, 0x38, 0x9D, 0xFE, 0x63, 0x84, 0x23,
-    0x56, 0x1E, 0x1C, 0x7E, 0x1C, 0x63, 0x83, 0x06, 0x2D, 0x5F, 0xBE, 0xFB, 0x45, 0x9A, 0xEE, 0x89,
-    0xA1, 0xB2, 0x8A, 0x4E, 0x46, 0x6B, 0x9F, 0x7B, 0x53, 0x35, 0xD0, 0xF2, 0xC3, 0xDF, 0x60, 0xF1,
-    0x82, 0x9B, 0x69, 0xC1, 0x00, 0x37, 0x6E, 0x07, 0x85, 0xDB, 0xE5, 0x0E, 0x21, 0xB7, 0x21, 0xBC,
-    0x3F, 0xE5, 0x7E, 0xC6, 0xD9, 0x0A, 0x9C, 0xCF, 0x64, 0x4F, 0x4B, 0xBF, 0x5D, 0xC8, 0xB7, 0x06,
-    0xF7, 0x31, 0x27, 0xB0, 0xD5, 0x2A, 0xAE, 0x12, 0xAD, 0x2F, 0x4D, 0xD2, 0x39, 0xD0, 0xE5, 0x85,
-    0x33, 0x7D, 0x66, 0x7D, 0xBE, 0x9A, 0x1A, 0x6F, 0xB1, 0xB2, 0xBF, 0x40, 0x8C, 0x86, 0x4D, 0x9E,
-    0x22, 0x8C, 0x8C, 0xC7, 0x4D, 0xFC, 0x4C, 0x53, 0xFC, 0x0B, 0xB0, 0xB6, 0x9C, 0xE8, 0xDC, 0x4A,
-    0x4C, 0x0C, 0xBC, 0x66, 0x3C, 0x12, 0x71, 0x07, 0x56, 0x08, 0xB5, 0xFE, 0x25, 0xE2, 0xE2, 0x82,
-    0x3F, 0xAC, 0x03, 0x3B, 0x2D, 0x2E, 0x6D, 0x12, 0x55, 0x15, 0xE9, 0x4A, 0x53, 0xFA, 0x76, 0xAB,
-    0xD3, 0x69, 0xD9, 0xEE, 0x6C, 0x78, 0x91, 0xD6, 0xDF, 0xF9, 0xA1, 0xA2, 0x0C, 0x81, 0x6F, 0x4A,
-    0x8F, 0x0A, 0xBA, 0x27, 0x4D, 0x01, 0x79, 0xA2, 0x0B, 0x4F, 0x58, 0x54, 0x38, 0x1E, 0x3D, 0x1B,
-    0x9E, 0xE8, 0x20, 0x59, 0xC5, 0x99, 0x23, 0x9C, 0x47, 0xF2, 0xEC, 0x9E, 0x4A, 0x3A, 0x49, 0x33,
-    0xA8, 0xD7, 0x83, 0x26, 0x9B, 0x4C, 0x98, 0x09, 0x7E, 0xA8, 0x8E, 0x46, 0x9E, 0x68, 0x2C, 0xD3,
-    0xC8, 0x28, 0x48, 0x79, 0xFF, 0xE4, 0xAF, 0xDC, 0xBB, 0x2F, 0x36, 0xA9, 0x02, 0xFB, 0xF2, 0x15,
-    0x69, 0x1C, 0x50, 0x6D, 0x62, 0xDB, 0xE0, 0x3F, 0xAF, 0xFD, 0x8E, 0xDB, 0xB9, 0x45, 0x59, 0xC6,
-    0xB1, 0x3A, 0x1E, 0xFD, 0xBF, 0x61, 0xA8, 0xF5, 0x45, 0xE3, 0xF0, 0xF0, 0xE0, 0xF9, 0xAF, 0x45,
-    0xF2, 0xD8, 0xAE, 0x7E, 0x86, 0xED, 0xEE, 0xFB, 0x99, 0x9E, 0x47, 0xB0, 0x1E, 0x8F, 0x96, 0x04,
-    0x7A, 0x7A, 0x8E, 0x92, 0x1E, 0x6B, 0xE9, 0x08, 0x94, 0x66, 0xE6, 0xA5, 0x0A, 0x22, 0x53, 0xDC,
-    0xB8, 0x6E, 0x4D, 0xEC, 0x8D, 0xC7, 0xE3, 0xA7, 0x14, 0xA0, 0xD6, 0x97, 0xC5, 0x4E, 0xE7, 0xCA,
-    0xB2, 0x25, 0x30, 0xDA, 0xCA, 0xFD, 0x28, 0xCE, 0x6F, 0xB1, 0x2D, 0xE1, 0x47, 0x83, 0xA9, 0x4F,
-    0xB6, 0x55, 0xD1, 0x44, 0x33, 0xA6, 0xC6, 0x76, 0x44, 0x1C, 0x27, 0x7E, 0xE4, 0x77, 0x92, 0x2A,
-    0x8F, 0x9A, 0x11, 0xFD, 0x8B, 0x62, 0x3F, 0xDD, 0x62, 0x1E, 0x4F, 0x20, 0xA1, 0x48, 0x9F, 0x2D,
-    0x73, 0x8D, 0x0F, 0xBF, 0x9D, 0xC6, 0xE9, 0xC8, 0x4F, 0xC8, 0x5A, 0x65, 0x46, 0xB0, 0x08, 0x03,
-    0x15, 0xC7, 0xC5, 0x17, 0x3E, 0x63, 0x7B, 0xBF, 0x4A, 0x9F, 0x16, 0xFE, 0xD5, 0x60, 0x8C, 0xDD,
-    0xE5, 0x1D, 0xF3, 0x19, 0x75, 0x3A, 0x8E, 0x5D, 0x9C, 0x91, 0x5F, 0xD3, 0xEF, 0xD0, 0x8B, 0x63,
-    0x8E, 0xEC, 0xCA, 0x0D, 0xE1, 0xD0, 0x63, 0xE1, 0x87, 0xB7, 0x64, 0x0D, 0x75, 0xBE, 0x2B, 0x19,
-    0xFB, 0x17, 0xCD, 0x5C, 0x4F, 0x6C, 0x1C, 0xD7, 0x79, 0xFF, 0x66, 0x96, 0xE2, 0xC4, 0x5A, 0x24,
-    0xA3, 0x03, 0x05, 0xD4, 0x7F, 0xA2, 0xF5, 0xC1, 0x07, 0xC7, 0x30, 0x39, 0x3D, 0xE4, 0xD0, 0x00,
-    0x33, 0xBB, 0x63, 0x0B, 0x6D, 0x80, 0xE6, 0x50, 0x06, 0x10, 0xE3, 0x00, 0x46, 0x21, 0x1F, 0x7C,
-    0x68, 0x54, 0x20, 0xCC, 0xC1, 0x07, 0xB6, 0x5D, 0x6A, 0xC7, 0x31, 0xD0, 0x1C, 0x7A, 0x28, 0x7D,
-    0x48, 0x7B, 0xAC, 0x0E, 0x2E, 0x60, 0x53, 0x07, 0xE5, 0xC0, 0xA4, 0xE3, 0x7A, 0xC9, 0x1D, 0xDB,
-    0x87, 0x1C, 0x72, 0xC8, 0x24, 0xA9, 0xD3, 0x43, 0x0F, 0x9E, 0x34, 0x12, 0x92, 0x4A, 0x28, 0x34,
-    0x89, 0x47, 0xF6, 0x4A, 0x5A, 0xEE, 0xF4, 0xF7, 0xFB, 0xDE, 0xEC, 0x72, 0x97, 0xFF, 0x4C, 0x4A,
-    0x74, 0xD0, 0xE5, 0x7C, 0xDF, 0xEE, 0xCE, 0xCE, 0xBC, 0xF9, 0xDE, 0x7B, 0xDF, 0xFF, 0xF7, 0x3D,
-    0x8A, 0x88, 0x93, 0x8A, 0x95, 0x8B, 0xAC, 0x88, 0x3C, 0x21, 0x78, 0x75, 0xCA, 0xA2, 0x57, 0x16,
-    0xB1, 0xC8, 0xE4, 0xB1, 0xB9, 0xB4, 0xD8, 0x2B, 0xF3, 0xAD, 0xF5, 0x2B, 0xBB, 0xCE, 0xE3, 0xE8,
-    0xE9, 0xF5, 0x96, 0x25, 0xF5, 0xEF, 0x25, 0x38, 0xF0, 0xE1, 0x81, 0x1B, 0xE9, 0x95, 0x65, 0x22,
-    0x25, 0x91, 0x74, 0xD9, 0x4A, 0x7B, 0x1F, 0xB4, 0xDA, 0x5B, 0x63, 0xF3, 0x03, 0x7C, 0x92, 0x0E,
-    0xCF, 0x35, 0x42, 0x20, 0x37, 0x02, 0xAA, 0x8F, 0x91, 0xCB, 0x73, 0x1E, 0x7E, 0x7D, 0x66, 0x1B,
-    0xA8, 0x55, 0xE0, 0x3E, 0x25, 0x4B, 0x78, 0x21, 0xCE, 0xFB, 0x22, 0x3F, 0x30, 0x64, 0xE6, 0xA0,
-    0x68, 0x2F, 0x39, 0x87, 0x1F, 0xFA, 0x6A, 0x94, 0x91, 0x55, 0x96, 0x99, 0x53, 0x48, 0x84, 0x36,
-    0xD9, 0xA8, 0x04, 0xA2, 0x2D, 0x2B, 0x9D, 0x9D, 0x72, 0xA8, 0xD0, 0xAE, 0xBE, 0xF3, 0xB7, 0x16,
-    0x6F, 0xC3, 0xB5, 0xF5, 0x4C, 0x16, 0xED, 0xF2, 0x76, 0x26, 0xCB, 0x65, 0x5A, 0xB5, 0x66, 0x97,
-    0xD7, 0x1B, 0xE5, 0xA0, 0x29, 0x73, 0x6D, 0xBD, 0x1C, 0x47, 0x13, 0x6D, 0xA6, 0xE2, 0x0C, 0x31,
-    0x36, 0x99, 0x38, 0x7D, 0x76, 0x97, 0x8D, 0x2C, 0x00, 0x2F, 0x4A, 0xB7, 0x77, 0xAD, 0xE8, 0x94,
-    0x68, 0x4A, 0x56, 0xE2, 0xDD, 0xAF, 0xB9, 0x45, 0xBF, 0xF0, 0x73, 0x36, 0xEA, 0x44, 0xF5, 0x4F,
-    0xFD, 0x93, 0x0D, 0xF4, 0xE8, 0xD3, 0xFF, 0x8A, 0xAF, 0xE6, 0x65, 0xBA, 0xCE, 0x79, 0x02, 0x25,
-    0xC0, 0x18, 0x7E, 0x29, 0x74, 0x92, 0x0A, 0xED, 0x9E, 0xC1, 0xF9, 0x14, 0xEE, 0x0C, 0x43, 0xE2,
-    0xB2, 0xE0, 0x19, 0x6B, 0xA0, 0xE7, 0x9B, 0x16, 0x71, 0xC3, 0xCA, 0x76, 0xB0, 0x9D, 0xF2, 0x7C,
-    0x2D, 0x01, 0x1E, 0x60, 0xE6, 0x71, 0x7D, 0xC9, 0xE1, 0x8B, 0xCE, 0xE8, 0xC0, 0xAC, 0x08, 0x7E,
-    0x01, 0x01, 0x9F, 0x8E, 0xB7, 0xD6, 0xAF, 0xDE, 0x7C, 0x03, 0xA4, 0xE1, 0x15, 0x6E, 0x2E, 0xBD,
-    0xF0, 0xC1, 0xC5, 0x94, 0xE7, 0xED, 0x5C, 0x7F, 0x2D, 0x76, 0x63, 0x4B, 0xCF, 0x3B, 0x19, 0x70,
-    0x59, 0x46, 0xC4, 0x77, 0xE5, 0x81, 0xD8, 0xCF, 0x95, 0x11, 0xBF, 0xD5, 0xC3, 0x29, 0x1E, 0x9C,
-    0x42, 0x7C, 0xD5, 0x32, 0x65, 0x3F, 0x39, 0x87, 0xCF, 0x7F, 0x22, 0x55, 0xEF, 0xEA, 0x61, 0x2C,
-    0x0D, 0xF4, 0x20, 0x00, 0xF4, 0x25, 0xB6, 0x73, 0x89, 0x41, 0x62, 0x8C, 0xEB, 0x36, 0x97, 0x31,
-    0xD0, 0x60, 0xDF, 0xAD, 0x1E, 0x7A, 0x88, 0x07, 0xC4, 0x75, 0x9C, 0x47, 0x1B, 0x98, 0x0C, 0x40,
-    0x17, 0xD0, 0x04, 0xB8, 0xB8, 0x1F, 0x3F, 0x28, 0x69, 0x64, 0x2F, 0x9D, 0x76, 0x70, 0x7B, 0x52,
-    0xB5, 0xAF, 0xBD, 0x05, 0x38, 0x00, 0x17, 0x30, 0xBF, 0x11, 0x4B, 0x1B, 0x90, 0x6F, 0xC4, 0x76,
-    0x56, 0xC4, 0x4E, 0x52, 0xA0, 0xED, 0x22, 0x5E, 0xC0, 0x75, 0x3E, 0xA0, 0x90, 0xE2, 0xED, 0x4C,
-    0x8A, 0x77, 0x30, 0x4A, 0xBD, 0x10, 0x80, 0xFB, 0xBB, 0x9C, 0xDD, 0x97, 0x4E, 0x83, 0x08, 0x34,
-    0xDE, 0x42, 0xC7, 0x67, 0xD7, 0xB4, 0x6D, 0x08, 0x82, 0x0F, 0x86, 0xEC, 0x82, 0xF3, 0x0B, 0x37,
-    0xB4, 0xF2, 0x7A, 0x52, 0x4B, 0x6B, 0xA9, 0x83, 0x11, 0x07, 0xF1, 0x05, 0x86, 0xA5, 0x4B, 0x5E,
-    0x85, 0x3C, 0x78, 0x18, 0x38, 0x17, 0x22, 0x58, 0x07, 0x53, 0xD6, 0xC0, 0xF0, 0x24, 0x17, 0x42,
-    0xEB, 0x82, 0xB5, 0xDD, 0xBE, 0x11, 0xCC, 0x15, 0xB1, 0x30, 0x13, 0x9C, 0x93, 0x07, 0x03, 0xCC,
-    0x9C, 0x02, 0x67, 0x63, 0x0A, 0xC8, 0x18, 0x75, 0x8E, 0x3B, 0x9E, 0x7D, 0x6E, 0x03, 0xF4, 0x60,
-    0x44, 0x7C, 0xD0, 0x14, 0xCF, 0x83, 0xEA, 0x06, 0xEE, 0x74, 0x43, 0x3B, 0xAB, 0x47, 0xB5, 0x9B,
-    0x57, 0x13, 0xA7, 0x2C, 0x53, 0xF7, 0xFB, 0xDF, 0xC8, 0xD1, 0xCB, 0x1C, 0x94, 0x63, 0x38, 0xA4,
-    0x0D, 0xCA, 0x03, 0x50, 0xEE, 0x71, 0xC2, 0xC9, 0xF4, 0xB1, 0xE9, 0xF7, 0x14, 0xF4, 0xC0, 0xE6,
-    0xD0, 0x5D, 0x12, 0x5B, 0xDB, 0xF8, 0xDE, 0x12, 0x33, 0x9F, 0x6E, 0xF5, 0xEE, 0x01, 0x36, 0xF5,
-    0xF7, 0x1E, 0xE4, 0xB5, 0x33, 0x5C, 0xAB, 0xDA, 0xE9, 0x8D, 0xAE, 0x0B, 0x47, 0xD7, 0x6E, 0x2E,
-    0x75, 0xF1, 0x5B, 0x06, 0x3E, 0x66, 0x3B, 0x0D, 0xCE, 0x2B, 0xF8, 0xD2, 0x49, 0x38, 0xBF, 0xB8,
-    0x06, 0x9F, 0xBD, 0xB0, 0x57, 0x6E, 0xEB, 0x35, 0x0F, 0xA8, 0xB7, 0x5A, 0x50, 0x48, 0x06, 0xF9,
-    0x54, 0x24, 0x8A, 0xDA, 0x63, 0xB4, 0x32, 0x8D, 0x62, 0xA2, 0x0D, 0xA2, 0x7C, 0x84, 0xEC, 0x0C,
-    0x08, 0x53, 0xB8, 0xC0, 0x39, 0x5C, 0x50, 0x59, 0xCB, 0x29, 0x6F, 0x39, 0x15, 0xEC, 0x04, 0xDA,
-    0x20, 0x7A, 0x30, 0x13, 0xE0, 0x43, 0x22, 0xEC, 0xCC, 0xC3, 0xB8, 0xD4, 0x12, 0x37, 0xE4, 0x9F,
-    0x83, 0x77, 0x4F, 0xC0, 0x55, 0xA1, 0xAF, 0x9C, 0x06, 0x96, 0x69, 0xBB, 0xCF, 0x63, 0x3E, 0xBD,
-    0x8B, 0xFF, 0x8C, 0xD9, 0x75, 0x4B, 0xEA, 0x41, 0xEF, 0xDA, 0x6D, 0x7C, 0x0E, 0xDC, 0xF3, 0x98,
-    0xEB, 0x3E, 0x18, 0x5A, 0x67, 0xB6, 0x0B, 0x5A, 0xDD, 0xB0, 0x09, 0x62, 0xDD, 0xB0, 0x11, 0x36,
-    0xD0, 0x66, 0x3D, 0x69, 0xB2, 0xE5, 0xAC, 0x2B, 0xE4, 0x58, 0x72, 0xF1, 0xE3, 0x18, 0x4D, 0x0F,
-    0xA3, 0xFA, 0x39, 0x4A, 0x33, 0xE5, 0xD8, 0x80, 0xA8, 0x46, 0x3F, 0x35, 0x80, 0x5E, 0xC8, 0xC4,
-    0xBA, 0xBA, 0x6D, 0xBE, 0xAB, 0x24, 0x3B, 0x89, 0x01, 0x37, 0x39, 0x83, 0x19, 0x69, 0xDD, 0x1A,
-    0xE2, 0xFE, 0xEB, 0x27, 0x2B, 0x6D, 0x6B, 0x7F, 0x84, 0xF1, 0x43, 0x6F, 0x7B, 0xE8, 0xEB, 0x63,
-    0x6B, 0x27, 0xDA, 0xF6, 0x89, 0x69, 0x9C, 0x5E, 0x25, 0x12, 0xD4, 0xFC, 0x05, 0x58, 0x89, 0x90,
-    0xEF, 0x0F, 0x16, 0x21, 0x33, 0x00, 0x6D, 0xEF, 0xE3, 0x71, 0x7E, 0x49, 0x00, 0x0B, 0x52, 0xCB,
-    0x63, 0xE4, 0x6B, 0x39, 0x88, 0xAC, 0x17, 0xBD, 0x08, 0x5D, 0x03, 0xC9, 0xE7, 0x8A, 0x7F, 0x4B,
-    0x65, 0xBE, 0xF8, 0x21, 0x6E, 0x2C, 0x36, 0x72, 0x59, 0x29, 0x62, 0xF4, 0xB3, 0x88, 0xDB, 0x16,
-    0x50, 0x60, 0xA7, 0xE8, 0x65, 0x8D, 0xDD, 0x75, 0x22, 0xA0, 0xBF, 0x40, 0xA7, 0x9D, 0x9F, 0xA2,
-    0xC7, 0xB5, 0xFF, 0x05, 0xB2, 0x41, 0x51, 0x6C, 0xF5, 0x39, 0x58, 0x05, 0x7B, 0x2B, 0x94, 0x92,
-    0x7D, 0x61, 0x73, 0x69, 0x49, 0x75, 0xC6, 0xD6, 0xFA, 0xFA, 0x81, 0xD7, 0x8C, 0xC0, 0x68, 0x6B,
-    0x0F, 0x82, 0x43, 0x9B, 0x2F, 0x4E, 0x66, 0xF7, 0xA9, 0xCA, 0x57, 0xC9, 0x14, 0x4D, 0x9A, 0xE5,
-    0x06, 0xAD, 0x83, 0x1B, 0x8E, 0x51, 0x34, 0x46, 0xE6, 0x9C, 0x5E, 0xE2, 0x91, 0x89, 0xA0, 0xF9,
-    0x56, 0xA1, 0x92, 0x40, 0xA2, 0x5D, 0xC2, 0xB2, 0xC3, 0x07, 0x08, 0x4D, 0xEB, 0x9D, 0x4A, 0x87,
-    0x3D, 0x8C, 0x1E, 0x24, 0xC0, 0xEC, 0x52, 0xEE, 0xAC, 0x01, 0xA6, 0x0B, 0x3A, 0x03, 0x93, 0x0D,
-    0x49, 0xC6, 0x74, 0xE3, 0x4C, 0x8F, 0x4F, 0x08, 0x0F, 0xF3, 0x69, 0xD6, 0x0E, 0xF3, 0x69, 0x76,
-    0xC3, 0x61, 0x3E, 0x0D, 0x7A, 0x92, 0x95, 0x1C, 0xAB, 0xC6, 0x2E, 0x8D, 0x7C, 0x4C, 0x38, 0x49,
-    0x2B, 0x53, 0xBD, 0x8A, 0x11, 0xFA, 0xEB, 0x72, 0x8D, 0xD6, 0x7F, 0x5B, 0xDC, 0xB4, 0x58, 0x8E,
-    0x9A, 0x52, 0x38, 0x29, 0x78, 0x99, 0x1E, 0x43, 0xC1, 0xA1, 0x2C, 0xC4, 0xA0, 0x2E, 0xBF, 0xF2,
-    0x87, 0xAC, 0xC5, 0x4B, 0xF4, 0x62, 0xBD, 0x4D, 0x1B, 0x98, 0x68, 0x4F, 0x16, 0x39, 0x56, 0x16,
-    0xB4, 0x17, 0xF5, 0x4E, 0x3D, 0x72, 0x92, 0x06, 0x54, 0x66, 0xA0, 0x92, 0x2B, 0xAB, 0xB9, 0x3A,
-    0x74, 0x50, 0x1B, 0xA0, 0x0B, 0xD0, 0xC4, 0xF7, 0x98, 0x7A, 0xAA, 0x8D, 0xAB, 0xA1, 0x50, 0x23,
-    0xE8, 0x28, 0xE8, 0x95, 0x40, 0xA8, 0x9D, 0xAC, 0x82, 0x16, 0x51, 0x38, 0x9D, 0x27, 0x84, 0xA8,
-    0xAB, 0x15, 0x85, 0x95, 0x9A, 0x9B, 0x44, 0xA0, 0xDA, 0x4E, 0x7D, 0xD0, 0xB1, 0x1F, 0x80, 0xA2,
-    0xD4, 0x43, 0x90, 0xE0, 0xDE, 0x2B, 0x53, 0xBB, 0xBC, 0x9F, 0xCA, 0x0C, 0x87, 0x77, 0x7F, 0x58,
-    0x41, 0x5B, 0x76, 0x4A, 0x8B, 0x56, 0xFB, 0x4C, 0xB0, 0x7A, 0x77, 0x15, 0x5E, 0x81, 0x23, 0x55,
-    0x4B, 0xA8, 0xCB, 0x9C, 0xCF, 0x04, 0xEB, 0x53, 0xB6, 0x0D, 0x56, 0xBE, 0x09, 0xF6, 0xE0, 0x79,
-    0x2A, 0x68, 0xF5, 0x88, 0x0F, 0x77, 0x0C, 0x06, 0x95, 0xEA, 0xF4, 0x26, 0x9C, 0x82, 0xA6, 0x9E,
-    0x37, 0x8E, 0x41, 0xB8, 0x42, 0xAF, 0x2D, 0x16, 0x7D, 0xF6, 0x01, 0x08, 0xAD, 0x91, 0xA6, 0x02,
-    0x5F, 0xAD, 0x01, 0xCF, 0x35, 0x89, 0x3C, 0xA5, 0x76, 0xFC, 0xA9, 0x59, 0xFD, 0xAA, 0xD7, 0xA1,
-    0x5D, 0x27, 0x59, 0xD9, 0x4F, 0xD8, 0x7B, 0xFB, 0xA8, 0x08, 0x8F, 0x9F, 0xA9, 0x22, 0x60, 0x85,
-    0x55, 0x23, 0x79, 0xB0, 0xAB, 0x74, 0xF7, 0x9F, 0xB4, 0xB6, 0xF8, 0x2D, 0x34, 0xAC, 0x4B, 0xCB,
-    0xA7, 0x73, 0x9D, 0x39, 0xD4, 0x14, 0x94, 0x70, 0x75, 0x6C, 0xF5, 0x5C, 0x32, 0x12, 0xBB, 0x50,
-    0xB6, 0xA4, 0x87, 0xC1, 0xE9, 0x94, 0x6B, 0x3B, 0x72, 0x47, 0x6F, 0x17, 0xDF, 0x63, 0x9C, 0x85,
-    0xDD, 0x81, 0x02, 0xDC, 0x52, 0xEB, 0x82, 0x01, 0x41, 0xA3, 0xF0, 0x6F, 0x60, 0x5C, 0x41, 0x3E,
-    0x38, 0xB2, 0x96, 0x6E, 0x5E, 0x14, 0x9D, 0x6D, 0xE2, 0xAD, 0x6B, 0xC4, 0xB1, 0x6B, 0x70, 0xA8,
-    0x58, 0xAF, 0x34, 0x77, 0xB1, 0x85, 0x90, 0xAD, 0x5D, 0x66, 0xCB, 0xB7, 0xD1, 0x32, 0x9E, 0x32,
-    0x0A, 0xAB, 0x60, 0xDE, 0xC1, 0xB3, 0xA0, 0xF3, 0xBA, 0x9D, 0xB9, 0x11, 0x40, 0x2A, 0x80, 0x8F,
-    0xE1, 0x26, 0x76, 0x56, 0xBB, 0x83, 0xDB, 0xD9, 0x07, 0xEF, 0x6A, 0x26, 0x01, 0xDC, 0x9B, 0xAE,
-    0x9D, 0x59, 0x39, 0xCE, 0x67, 0xF0, 0x0A, 0xF1, 0x7B, 0x03, 0xD7, 0x35, 0x71, 0xBD, 0xF5, 0x16,
-    0x86, 0x23, 0x3B, 0xF7, 0x7C, 0xA1, 0xC3, 0xC7, 0x00, 0x6D, 0xB6, 0x1C, 0x78, 0x37, 0xBB, 0xAB,
-    0xD2, 0xEE, 0x4B, 0x1B, 0x81, 0x50, 0xD7, 0x1A, 0x74, 0xAE, 0xB5, 0x1B, 0xDB, 0xFE, 0xE8, 0xC1,
-    0xA7, 0xA1, 0x77, 0xE0, 0x68, 0x39, 0x77, 0x8D, 0x8C, 0x2D, 0x54, 0x6A, 0xD4, 0x87, 0xCA, 0xFF,
-    0xBB, 0xFB, 0x98, 0x77, 0x28, 0xCE, 0x4D, 0xA1, 0x8B, 0x42, 0xC7, 0xAE, 0xAE, 0xC0, 0x40, 0xC1,
-    0x57, 0x5B, 0xD1, 0xC0, 0x1F, 0xDC, 0x96, 0x9B, 0x03, 0xD8, 0x88, 0x4C, 0x9B, 0x5B, 0xBA, 0x00,
-    0x32, 0xD3, 0xBB, 0x2F, 0xC2, 0xBF, 0xEA, 0xC3, 0xAE, 0x41, 0x21, 0xC1, 0xED, 0xC1, 0x99, 0xC2,
-    0xC2, 0xD7, 0xB6, 0x1E, 0x7D, 0x75, 0xC6, 0xA2, 0xA5, 0x25, 0x5C, 0x19, 0xDE, 0x5D, 0xA2, 0x46,
-    0x3A, 0xFC, 0x90, 0xA5, 0xA5, 0x50, 0x18, 0xED, 0xDC, 0x79, 0x31, 0xB1, 0x32, 0x67, 0x0A, 0xEC,
-    0xD4, 0x00, 0x42, 0x24, 0xFD, 0x73, 0x95, 0xF9, 0xCA, 0x01, 0x84, 0x61, 0x80, 0x5B, 0xFD, 0x11,
-    0xBC, 0x24, 0xF2, 0x94, 0x5C, 0x12, 0xA7, 0xCC, 0x1A, 0xAF, 0xF6, 0x03, 0x3A, 0xCC, 0x01, 0xAC,
-    0x4D, 0x59, 0x0E, 0x71, 0xC4, 0x1A, 0x46, 0xB5, 0x69, 0x23, 0x66, 0xDC, 0x7B, 0x03, 0x5B, 0x05,
-    0x65, 0x4E, 0xCE, 0xC8, 0x22, 0x5C, 0x0F, 0xF8, 0x67, 0xF4, 0x3B, 0xEA, 0x9C, 0x70, 0xCC, 0x28,
-    0x9D, 0x6E, 0x7A, 0xDC, 0x8C, 0x16, 0x0D, 0x82, 0xB5, 0x07, 0x63, 0xC5, 0x9E, 0xE1, 0x09, 0x38,
-    0x1D, 0x0E, 0x7C, 0x37, 0x78, 0x2B, 0x6D, 0xBA, 0x23, 0xA7, 0xDE, 0x82, 0x1B, 0x9B, 0x7E, 0x69,
-    0x16, 0xD7, 0xF5, 0x45, 0x15, 0x5C, 0xAD, 0x84, 0x4E, 0x4E, 0xA1, 0x38, 0x47, 0xF1, 0xF3, 0xA0,
-    0x79, 0xB5, 0xF0, 0x34, 0x44, 0x5E, 0x94, 0xB9, 0x42, 0xB6, 0x0B, 0x6B, 0xBB, 0xA8, 0x6D, 0x17,
-    0xF5, 0xD5, 0xC2, 0x0D, 0x0A, 0x3F, 0x28, 0x56, 0x82, 0x22, 0x0F, 0x3E, 0x4E, 0x83, 0x4F, 0x92,
-    0xA0, 0x0C, 0x83, 0xA1, 0x04, 0x03, 0x09, 0x1E, 0x91, 0x35, 0x17, 0xBD, 0x86, 0x2B, 0xB9, 0x25,
-    0xC7, 0xBA, 0x71, 0x51, 0x2E, 0xC0, 0x50, 0x14, 0xB5, 0xB4, 0xA8, 0x47, 0x08, 0x2B, 0x8A, 0x80,
-    0x5A, 0x01, 0x47, 0xB1, 0xCA, 0x28, 0xA3, 0x70, 0x23, 0xFE, 0x64, 0x71, 0xF2, 0x30, 0xE8, 0x98,
-    0xD4, 0x32, 0xB2, 0x6F, 0x5C, 0x8C, 0xEC, 0xB4, 0xAE, 0x80, 0x61, 0xD8, 0x03, 0x4E, 0x62, 0xE2,
-    0xF3, 0x12, 0x4C, 0xB1, 0x5D, 0x45, 0x90, 0x17, 0x70, 0x0C, 0xC5, 0x1A, 0x94, 0x62, 0x0F, 0xCA,
-    0xB0, 0x36, 0xF8, 0x24, 0xAA, 0x77, 0x3F, 0x4A, 0x5C, 0xFF, 0x77, 0xD9, 0x39, 0x3F, 0xCF, 0x7D,
-    0x3F, 0xDF, 0x00, 0xF8, 0x1B, 0x7E, 0x1E, 0xE4, 0x7E, 0xDE, 0xC8, 0xFC, 0xDC, 0x4D, 0xFC, 0x1C,
-    0x3C, 0xA5, 0xFD, 0xF0, 0x27, 0x0F, 0x9D, 0xC9, 0xC1, 0xAE, 0x93, 0xF4, 0xE0, 0x2E, 0x85, 0x98,
-    0xCB, 0x5C, 0x1A, 0xAF, 0x77, 0xC1, 0x80, 0x9E, 0x86, 0xB7, 0xF4, 0xF8, 0xFA, 0xA0, 0xA0, 0xAF,
-    0x6C, 0xEA, 0x46, 0xF4, 0x9D, 0x7D, 0xF5, 0x66, 0xE0, 0x4B, 0x4F, 0xB2, 0xE8, 0xD2, 0x05, 0xB4,
-    0x79, 0x77, 0xA9, 0xBB, 0xB7, 0xD9, 0x5D, 0xC7, 0xE2, 0xA5, 0xF0, 0x23, 0xF0, 0xEA, 0xD7, 0x07,
-    0x03, 0x59, 0xED, 0xCB, 0x42, 0x21, 0x8D, 0xF1, 0xD1, 0x17, 0x6F, 0x20, 0xCD, 0xA1, 0x74, 0xEF,
-    0xDF, 0x2A, 0xEE, 0x80, 0xBD, 0xF7, 0x32, 0xED, 0xA5, 0x10, 0x04, 0x36, 0x5E, 0x7F, 0xA9, 0xA9,
-    0xB3, 0x1C, 0x2B, 0x03, 0x14, 0x23, 0xC5, 0xA6, 0xCC, 0x06, 0xAA, 0x72, 0xBB, 0xCC, 0x0D, 0x49,
-    0x88, 0x98, 0x96, 0x36, 0x2F, 0xC8, 0x38, 0xAD, 0x72, 0xC0, 0xB1, 0x28, 0xA7, 0x18, 0x88, 0x69,
-    0xC7, 0x02, 0x48, 0x6B, 0x03, 0x63, 0xE1, 0x6A, 0xE8, 0x5E, 0x40, 0xAD, 0xE5, 0x52, 0xFB, 0x19,
-    0xC2, 0x80, 0x5F, 0x43, 0xAD, 0x7C, 0x04, 0xFD, 0xF6, 0x4E, 0x64, 0xFC, 0x9E, 0xD6, 0x84, 0x7F,
-    0x84, 0x87, 0xC3, 0x93, 0x96, 0x1E, 0x2E, 0xE9, 0x51, 0x7D, 0x52, 0x1F, 0xEE, 0x8B, 0x1E, 0xBF,
-    0xC1, 0x6C, 0x0F, 0x58, 0xD5, 0xFD, 0xCD, 0x7F, 0x16, 0xD2, 0xAA, 0xA5, 0x5D, 0x69, 0xD3, 0x01,
-    0xE8, 0xD6, 0x52, 0x68, 0x42, 0x38, 0x0E, 0xD2, 0x27, 0xD2, 0x4F, 0x7A, 0x2E, 0xA8, 0xA5, 0x98,
-    0x8A, 0xF3, 0xB8, 0xAE, 0x7E, 0xFF, 0x56, 0x4E, 0x07, 0x94, 0x41, 0x48, 0x76, 0xC8, 0x33, 0xE6,
-    0xE4, 0x14, 0xE6, 0xA6, 0xA9, 0xBE, 0x27, 0xC2, 0x02, 0xA9, 0xFD, 0x1A, 0x57, 0xDF, 0x4F, 0xD4,
-    0xD1, 0x56, 0xA2, 0xD1, 0x82, 0xFD, 0x51, 0x2A, 0xCE, 0xBB, 0xB9, 0xAA, 0xA0, 0x05, 0xF4, 0xA2,
-    0x8D, 0x2E, 0x83, 0x4F, 0xC6, 0xAE, 0xFC, 0x51, 0x80, 0xA9, 0x12, 0x93, 0x2E, 0xA9, 0x4D, 0x80,
-    0x1D, 0xCD, 0xC9, 0x8C, 0xBA, 0x9C, 0xD5, 0xD1, 0xD6, 0xA3, 0xF5, 0x4F, 0x43, 0x17, 0x0A, 0xF1,
-    0xC2, 0x82, 0x2A, 0xC3, 0xEA, 0x58, 0xC4, 0x33, 0x17, 0x0B, 0x7A, 0xEA, 0xC7, 0x47, 0x34, 0xCC,
-    0x06, 0x69, 0x2B, 0xF4, 0xD4, 0xF0, 0xF7, 0x30, 0x98, 0x8D, 0x95, 0x15, 0x96, 0xCA, 0x05, 0x9D,
-    0xC6, 0xB3, 0xB2, 0x04, 0x1F, 0xAF, 0x07, 0x7E, 0x5B, 0x2A, 0x2A, 0xA7, 0x8F, 0x70, 0x17, 0x92,
-    0xC9, 0x69, 0x81, 0x7E, 0x96, 0x62, 0xF2, 0xCF, 0x66, 0xA3, 0x29, 0x0D, 0x01, 0x6E, 0x9B, 0xA3,
-    0x6E, 0x9A, 0x84, 0x7B, 0x6F, 0x48, 0x1B, 0xC3, 0xD7, 0xBE, 0xFB, 0x42, 0x8E, 0xEF, 0xC5, 0x0E,
-    0x40, 0xCB, 0xE1, 0xB6, 0x36, 0xD3, 0x87, 0x8B, 0xD3, 0xEC, 0x7F, 0x97, 0x76, 0x20, 0x51, 0x3B,
-    0x50, 0x54, 0x87, 0x0D, 0xAD, 0x9F, 0xE2, 0x52, 0x04, 0x8A, 0xC0, 0x2F, 0x2F, 0x47, 0xE4, 0x01,
-    0x3C, 0xD8, 0xCA, 0xBD, 0x92, 0x07, 0xC3, 0x17, 0x38, 0x80, 0x30, 0x6E, 0xF5, 0xE4, 0x5E, 0x2F,
-    0xEC, 0x0D, 0x8C, 0x6A, 0x7B, 0x06, 0x41, 0xA1, 0x0D, 0x45, 0x5B, 0xB8, 0xE9, 0x26, 0x95, 0x14,
-    0xD4, 0x14, 0x39, 0x06, 0xAA, 0x0B, 0x4A, 0x67, 0x50, 0xA1, 0x84, 0xF1, 0x78, 0x84, 0x73, 0xD0,
-    0x60, 0x0B, 0xFC, 0x95, 0xA1, 0x78, 0xE1, 0xDC, 0x43, 0x90, 0x65, 0x55, 0x62, 0x2F, 0x72, 0x76,
-    0x89, 0x5E, 0x74, 0xE8, 0xDE, 0xB8, 0xA8, 0x31, 0xF6, 0x08, 0x5C, 0x78, 0xB4, 0x0E, 0xFD, 0x4D,
-    0xFA, 0x13, 0xB8, 0x91, 0x11, 0xBC, 0x53, 0xC5, 0xF4, 0x4D, 0xE3, 0x78, 0x52, 0x62, 0x62, 0x95,
-    0xA1, 0xD3, 0xDA, 0xD2, 0x71, 0x0C, 0x09, 0x79, 0xFD, 0xBD, 0x0C, 0x87, 0x15, 0x86, 0xC7, 0xBD,
-    0x77, 0x14, 0xE6, 0x9B, 0x7C, 0x5F, 0xB2, 0x13, 0xF6, 0x5F, 0x44, 0x2C, 0xD0, 0xEB, 0x45, 0x2E,
-    0x8C, 0xBF, 0x8B, 0x40, 0xC3, 0x8D, 0xE8, 0xC8, 0x1F, 0x0E, 0xD3, 0x2E, 0x30, 0x7C, 0x92, 0x1A,
-    0xA5, 0x6B, 0xA8, 0x04, 0x36, 0xF5, 0xE1, 0x18, 0xFB, 0xC8, 0x28, 0xC8, 0x23, 0x5B, 0x66, 0xA3,
-    0xE4, 0xD6, 0x76, 0x94, 0x9C, 0x4A, 0x5A, 0xB2, 0xAF, 0x92, 0xB3, 0x69, 0x0B, 0x93, 0xCD, 0x59,
-    0x68, 0x29, 0xDE, 0x0B, 0xCB, 0xE5, 0x5D, 0x87, 0x86, 0xD1, 0x28, 0x83, 0x9C, 0x90, 0x81, 0xC8,
-    0xE1, 0x35, 0xF8, 0x8F, 0xA4, 0x61, 0x26, 0x08, 0x66, 0x64, 0x2E, 0x98, 0x7C, 0x9D, 0x09, 0x57,
-    0xF3, 0xD5, 0xFC, 0x0C, 0xBA, 0x7F, 0x4A, 0xCC, 0xEC, 0xEC, 0xF7, 0x07, 0xB3, 0x4D, 0x8E, 0x3E,
-    0xA3, 0xBC, 0x53, 0x1C, 0xFE, 0x87, 0x18, 0x34, 0xEB, 0x44, 0xEC, 0xAF, 0xAA, 0x3A, 0xB4, 0x0C,
-    0x6B, 0x47, 0x9C, 0xBA, 0x63, 0x5C, 0x4B, 0xDC, 0xB7, 0x42, 0x62, 0x4C, 0x08, 0xF0, 0x52, 0x4F,
-    0x34, 0xDF, 0x63, 0x70, 0xC5, 0x27, 0x8C, 0x89, 0x3C, 0x29, 0xC5, 0x85, 0x03, 0x8E, 0x89, 0x19,
-    0x33, 0x1C, 0xF5, 0x94, 0x2A, 0xA0, 0xBD, 0xA8, 0x2D, 0x2A, 0xBF, 0xE9, 0x70, 0x7D, 0x78, 0xB5,
-    0xE0, 0x39, 0x5A, 0x23, 0x63, 0xDA, 0xDA, 0x44, 0xB0, 0x79, 0x2D, 0xA6, 0xAB, 0x5A, 0x65, 0xB4,
-    0xC3, 0x04, 0xA9, 0xC2, 0x98, 0x09, 0xBE, 0x36, 0xAC, 0x98, 0xC0, 0xA9, 0x98, 0x80, 0x14, 0x57,
-    0x3E, 0xE3, 0x01, 0xA0, 0x1A, 0x22, 0x61, 0xAC, 0x3B, 0x5A, 0x59, 0x38, 0x86, 0x47, 0x60, 0x1C,
-    0xE8, 0x5C, 0x27, 0xF6, 0x8B, 0xC7, 0xF3, 0x3B, 0xEC, 0xF0, 0x25, 0x35, 0x4F, 0xF6, 0x7D, 0xB4,
-    0xF0, 0xED, 0xB0, 0x1A, 0x9D, 0x93, 0x35, 0x65, 0x7B, 0xBD, 0x87, 0xBD, 0x87, 0xF1, 0x27, 0x98,
-    0xA4, 0x32, 0xC7, 0x53, 0x26, 0x27, 0x5E, 0x18, 0xEC, 0x33, 0x57, 0x92, 0x53, 0xB1, 0x28, 0x4E,
-    0xAC, 0x7C, 0x41, 0xB1, 0x87, 0xC0, 0xDB, 0xCE, 0xA1, 0x2B, 0x32, 0x8E, 0xA2, 0x97, 0xD7, 0xE0,
-    0x0B, 0x05, 0x39, 0x5D, 0xCE, 0x36, 0xC2, 0x97, 0x5A, 0xBA, 0xD1, 0x85, 0x7F, 0x94, 0xE5, 0xBE,
-    0x2B, 0xD6, 0xEF, 0xB2, 0x26, 0x06, 0xF7, 0xE3, 0xB4, 0x01, 0x22, 0x3B, 0x89, 0x0B, 0xA9, 0x6A,
-    0x45, 0x4E, 0xC1, 0x50, 0xA3, 0x56, 0x25, 0x67, 0xC0, 0x13, 0xA0, 0x74, 0x05, 0xD4, 0xFB, 0x6D,
-    0x83, 0xF0, 0x87, 0xA9, 0x97, 0x38, 0xA0, 0xB9, 0x5A, 0x90, 0x55, 0x81, 0xCB, 0x59, 0xC2, 0xEF,
-    0x7C, 0xEE, 0x36, 0x7C, 0xBC, 0xD7, 0x7E, 0x72, 0x3E, 0xA9, 0xFD, 0xF8, 0x7B, 0x3F, 0x89, 0xEC,
-    0xDB, 0xB5, 0x0F, 0x45, 0x86, 0xD6, 0x90, 0xE3, 0x3F, 0x18, 0xEB, 0xF4, 0xB3, 0xAA, 0x69, 0xB7,
-    0xE5, 0xD2, 0xBD, 0x37, 0x27, 0xF4, 0xFC, 0x22, 0xD9, 0x65, 0x4D, 0x86, 0xD7, 0x0A, 0x5D, 0xFD,
-    0x28, 0x30, 0x66, 0x05, 0xA4, 0xDC, 0x00, 0x3E, 0x23, 0xA2, 0x63, 0x16, 0xDA, 0x44, 0xD9, 0x63,
-    0xA5, 0xF0, 0xC2, 0x8D, 0x50, 0x83, 0x0C, 0xBE, 0x4F, 0x29, 0x8C, 0x72, 0x18, 0x42, 0x73, 0x66,
-    0xB5, 0xD4, 0x02, 0x37, 0xD0, 0xE4, 0xCB, 0x06, 0x3E, 0xE7, 0x7A, 0x0E, 0xBF, 0x8D, 0xA2, 0x26,
-    0xAB, 0x77, 0x97, 0x5E, 0x18, 0xAC, 0x52, 0x2C, 0xAD, 0xF0, 0x34, 0x30, 0x75, 0x78, 0xAC, 0x09,
-    0xCC, 0x58, 0x99, 0x2F, 0x56, 0xDB, 0xBF, 0xF9, 0xC2, 0x07, 0x4B, 0xA1, 0x06, 0xF9, 0x99, 0x6C,
-    0x5D, 0xBD, 0xB9, 0xBE, 0xA6, 0x99, 0xBD, 0xD1, 0xAF, 0x8C, 0x94, 0xC6, 0x77, 0x99, 0x16, 0xA4,
-    0x13, 0x12, 0x37, 0x86, 0x43, 0x60, 0xBB, 0x0A, 0x73, 0x39, 0xE3, 0xB3, 0x6F, 0x20, 0x2C, 0x1D,
-    0x16, 0xB5, 0x3B, 0xDF, 0x2C, 0x10, 0xD0, 0x15, 0x9C, 0x44, 0x57, 0x25, 0x8B, 0x06, 0xB7, 0xE0,
-    0x67, 0x03, 0x11, 0x13, 0x22, 0xB0, 0x23, 0xC3, 0xAD, 0x42, 0x3A, 0xE6, 0x76, 0xA5, 0x47, 0x27,
-    0xA5, 0xAE, 0xAA, 0x96, 0x89, 0x22, 0xCE, 0x9A, 0x04, 0xCC, 0x04, 0xF9, 0x94, 0x30, 0x46, 0x7A,
-    0xAA, 0x77, 0x35, 0x99, 0x56, 0xFB, 0xF9, 0xAF, 0x72, 0x71, 0xDE, 0xCB, 0x0A, 0xA9, 0x7F, 0x97,
-    0x89, 0x59, 0x3B, 0xF3, 0xC5, 0xB3, 0xB3, 0x05, 0xC6, 0x63, 0x0D, 0x69, 0x93, 0x35, 0xFA, 0x8C,
-    0xC6, 0xA0, 0x9E, 0xA0, 0xDA, 0x98, 0x39, 0x41, 0x6F, 0xFE, 0x86, 0x12, 0x93, 0x6B, 0xC6, 0xCB,
-    0xBE, 0xC7, 0x2C, 0x2D, 0x7C, 0xE4, 0x7F, 0x04, 0x27, 0xB9, 0xB0, 0x3D, 0x2E, 0xB8, 0xC8, 0xAD,
-    0x25, 0x6D, 0xB4, 0x14, 0xBB, 0x56, 0xBE, 0xA2, 0xAB, 0x9B, 0xCC, 0x9D, 0x12, 0x3B, 0x03, 0x62,
-    0x57, 0xB5, 0xAA, 0x6B, 0xB2, 0xDC, 0x9A, 0x65, 0x22, 0x61, 0x9B, 0x4B, 0x9B, 0x2F, 0x26, 0x3A,
-    0x7E, 0x29, 0xC6, 0xEF, 0x3E, 0x64, 0x2A, 0xB6, 0x7F, 0xF5, 0x2B, 0xE6, 0x47, 0xDF, 0xCD, 0x10,
-    0x57, 0xD6, 0xDF, 0xCD, 0xC0, 0x59, 0xEE, 0x73, 0x19, 0xC2, 0x97, 0x06, 0xB3, 0x3C, 0x71, 0xD3,
-    0x42, 0x34, 0x19, 0xFB, 0xC0, 0x51, 0xDC, 0x65, 0xD8, 0xB4, 0x28, 0x67, 0xC9, 0x29, 0x1D, 0xA2,
-    0xFB, 0x18, 0x34, 0x0B, 0x32, 0x56, 0xD8, 0xBF, 0xC0, 0x10, 0xA1, 0x09, 0x8E, 0x9F, 0x3A, 0x19,
-    0xD0, 0x02, 0x8D, 0x79, 0xF0, 0x64, 0x30, 0x0F, 0x96, 0xF1, 0xE7, 0xA1, 0x0E, 0xE2, 0x79, 0xD8,
-    0xD6, 0x7C, 0xBE, 0x1E, 0x7D, 0x9C, 0xCD, 0x53, 0x27, 0xD2, 0x9C, 0x12, 0xC1, 0x9C, 0x30, 0xFC,
-    0xA4, 0x15, 0xE9, 0xB3, 0x17, 0x01, 0xE7, 0xD3, 0xE5, 0x18, 0x72, 0x61, 0x50, 0x97, 0x02, 0xEC,
-    0x7B, 0xE8, 0xBF, 0x93, 0xE4, 0x30, 0xA9, 0x11, 0x65, 0x29, 0xCC, 0x69, 0x7E, 0xE1, 0xF6, 0x2F,
-    0x48, 0xCE, 0x74, 0x12, 0xE4, 0xA9, 0x0D, 0x04, 0xF7, 0x31, 0xB7, 0xF3, 0x53, 0x4B, 0x4B, 0x8B,
-    0x68, 0x38, 0xAF, 0x7F, 0xF0, 0x02, 0x23, 0xDC, 0x88, 0x72, 0x21, 0x41, 0x9B, 0x19, 0x01, 0x8C,
-    0xE1, 0xED, 0xA4, 0xFE, 0xDA, 0xFB, 0x19, 0x86, 0x2E, 0x67, 0x7A, 0x15, 0xCF, 0x6A, 0xB7, 0x6B,
-    0x89, 0x0F, 0x1E, 0x5A, 0x58, 0x81, 0x21, 0x2F, 0x11, 0xA1, 0xD3, 0xDB, 0xAB, 0x22, 0x6E, 0x65,
-    0xF8, 0x18, 0x32, 0xC3, 0x88, 0xBB, 0x61, 0x33, 0x59, 0x55, 0xFF, 0x5E, 0x82, 0x31, 0x7C, 0xE1,
-    0xB6, 0x66, 0xFF, 0xE0, 0x5A, 0x6C, 0xAD, 0x0F, 0x87, 0x9B, 0xE4, 0xD0, 0x2E, 0x3D, 0xDB, 0xA4,
-    0xAB, 0x41, 0x5C, 0x57, 0xE3, 0xB9, 0x6E, 0x0D, 0x98, 0xFE, 0x2D, 0x22, 0x3F, 0xC4, 0xDC, 0x31,
-    0xFC, 0x5F, 0x04, 0x80, 0x01, 0x65, 0x6A, 0xF1, 0x2C, 0xE2, 0xD2, 0xA2, 0xC5, 0xE0, 0xB6, 0xB1,
-    0xF4, 0x62, 0x52, 0x30, 0x8B, 0x56, 0xD8, 0x19, 0xB3, 0xCC, 0x6F, 0x57, 0xC3, 0xA7, 0x6B, 0x7C,
-    0x45, 0xC3, 0xFD, 0x1A, 0xA8, 0x74, 0xCF, 0xA7, 0x85, 0x8F, 0x49, 0x61, 0xF6, 0x3B, 0x2F, 0xD0,
-    0xF9, 0xF8, 0x4E, 0xAE, 0x49, 0xD7, 0x19, 0xC8, 0x18, 0x26, 0xE2, 0x0E, 0x86, 0xAD, 0x95, 0x08,
-    0x5D, 0x1D, 0x0F, 0xFE, 0xD1, 0x39, 0x26, 0x05, 0x35, 0x4B, 0xE1, 0x8C, 0xB3, 0x15, 0x62, 0x6D,
-    0x0A, 0x83, 0x47, 0xFB, 0x1A, 0x59, 0x98, 0xBF, 0x8F, 0xB3, 0x1C, 0xC6, 0xA4, 0x4B, 0x23, 0xB2,
-    0xAE, 0x96, 0xD2, 0x28, 0xAF, 0x43, 0xFE, 0x8C, 0x92, 0x6C, 0x6A, 0x86, 0xA4, 0x8C, 0x66, 0xCB,
-    0x5B, 0xBA, 0xD4, 0xF6, 0x88, 0xBC, 0x5C, 0x3F, 0xDF, 0xB7, 0x6F, 0xE3, 0x04, 0x8C, 0x4B, 0xF6,
-    0xE8, 0xAC, 0x89, 0x49, 0xC8, 0x7C, 0x36, 0xA2, 0x3D, 0x86, 0xA6, 0x7D, 0xBD, 0x13, 0x47, 0xD7,
-    0xD2, 0xD0, 0x74, 0x95, 0xCB, 0x2B, 0x5C, 0x11, 0x69, 0x95, 0x83, 0x53, 0x4B, 0xDF, 0xDC, 0xB0,
-    0x2B, 0xDF, 0x3F, 0xDC, 0x0F, 0xC5, 0xE3, 0xA0, 0xA0, 0x3D, 0x1D, 0x14, 0xB8, 0x88, 0x94, 0x8E,
-    0x12, 0x14, 0xEC, 0x82, 0xB9, 0x5A, 0x3A, 0xE7, 0xD7, 0xD2, 0x00, 0xB0, 0x00, 0x68, 0x54, 0xE0,
-    0x4E, 0x40, 0x03, 0x0F, 0x59, 0x58, 0xC0, 0x35, 0xEE, 0x6B, 0xE9, 0xC0, 0xB9, 0x5F, 0xE6, 0x16,
-    0x3D, 0xB9, 0x71, 0xB2, 0x67, 0x17, 0x98, 0x0C, 0x39, 0x2E, 0xB0, 0xC8, 0xE5, 0x4E, 0x06, 0x55,
-    0x08, 0xF5, 0xC0, 0x20, 0x52, 0xED, 0x10, 0xBE, 0xF8, 0x1C, 0xEF, 0x36, 0x51, 0x87, 0x7C, 0xA4,
-    0xA8, 0xCD, 0xF1, 0xD5, 0x73, 0x7A, 0x89, 0x5E, 0x8C, 0x09, 0x68, 0x32, 0x43, 0xCE, 0xD0, 0xF2,
-    0x5A, 0xCE, 0x0C, 0x79, 0x54, 0x35, 0xAF, 0xD1, 0x29, 0xA2, 0xC4, 0xD7, 0x37, 0x71, 0x85, 0xDA,
-    0xB5, 0x90, 0x76, 0x0D, 0xDC, 0x46, 0x48, 0x26, 0x92, 0x28, 0x78, 0xAC, 0xA7, 0xD1, 0xE9, 0xC8,
-    0x4D, 0xC5, 0x48, 0x7B, 0x08, 0x5D, 0xA5, 0x47, 0x32, 0x72, 0x23, 0x55, 0x0D, 0x12, 0x4E, 0x67,
-    0x43, 0x74, 0x25, 0x9C, 0x4E, 0x07, 0x33, 0xB7, 0xD4, 0x61, 0x10, 0x0B, 0x2B, 0xA7, 0xD6, 0x2A,
-    0x38, 0xD9, 0xDD, 0x15, 0x31, 0xF9, 0x0E, 0x09, 0xA8, 0xD8, 0x1A, 0x44, 0x6E, 0x6A, 0x6C, 0x3E,
-    0xB4, 0xA5, 0xC5, 0xB8, 0x38, 0x6D, 0x6B, 0x3F, 0x69, 0x71, 0xFD, 0x2A, 0x6A, 0x2E, 0x28, 0x97,
-    0x42, 0xC9, 0xA7, 0x0A, 0xA0, 0x2E, 0x90, 0x4F, 0x22, 0x63, 0x54, 0x5B, 0x55, 0x8F, 0xEA, 0xEF,
-    0xA3, 0x19, 0xFB, 0x67, 0x6C, 0x30, 0x7F, 0x05, 0xE8, 0xE9, 0x27, 0xAA, 0x1F, 0x3E, 0x3B, 0x7A,
-    0xD5, 0x31, 0x85, 0x2E, 0x86, 0x9A, 0x94, 0xDA, 0xFB, 0x50, 0xC2, 0xE9, 0x95, 0x4A, 0xEB, 0x3F,
-    0x44, 0x3F, 0x74, 0x01, 0xA3, 0x32, 0x00, 0x1A, 0x11, 0x72, 0x45, 0xC0, 0x51, 0xD3, 0x8C, 0xE9,
-    0xD4, 0xE4, 0x38, 0x97, 0x19, 0xE7, 0xC4, 0xE2, 0x52, 0x48, 0x10, 0x98, 0x59, 0x6F, 0x7A, 0x3A,
-    0x63, 0x54, 0xC1, 0x2A, 0xB2, 0x0B, 0xF5, 0x48, 0x17, 0x52, 0x16, 0x9C, 0x64, 0x41, 0xDF, 0x99,
-    0x81, 0xE6, 0x75, 0x14, 0x7F, 0xDE, 0xC7, 0xA5, 0x45, 0xF5, 0x89, 0x37, 0x72, 0xB6, 0xDB, 0x97,
-    0x55, 0x44, 0x35, 0x29, 0xAC, 0x0D, 0x6C, 0x42, 0x6D, 0xD8, 0x4B, 0xD4, 0x3E, 0x74, 0x86, 0x66,
-    0x9D, 0x7D, 0x27, 0x6C, 0x33, 0xEB, 0xE2, 0x3B, 0x79, 0xDB, 0x6A, 0x7D, 0x1F, 0xE4, 0x57, 0xCE,
-    0x43, 0x2B, 0x52, 0xEE, 0x82, 0x85, 0x59, 0x04, 0x83, 0x71, 0x9D, 0xC1, 0x7D, 0x7D, 0x93, 0xCE,
-    0x07, 0xF8, 0xB7, 0x96, 0x90, 0x0A, 0xA8, 0x19, 0x92, 0x5C, 0x7F, 0x35, 0x37, 0x09, 0xBB, 0x82,
-    0x43, 0x53, 0x4F, 0x62, 0xA6, 0x73, 0xC1, 0x71, 0x81, 0xD6, 0xA0, 0x04, 0x3E, 0x1E, 0xE0, 0xCA,
-    0xB9, 0x15, 0x30, 0x5F, 0x8B, 0x6B, 0xCE, 0xE4, 0xC0, 0x7A, 0xAE, 0x4C, 0x58, 0xC9, 0x48, 0xCD,
-    0xCC, 0x40, 0x55, 0x12, 0xE0, 0x1A, 0x1B, 0xEF, 0x99, 0x2F, 0x03, 0xF3, 0xA6, 0x0C, 0x4B, 0x47,
-    0xDB, 0x1A, 0x68, 0x06, 0x33, 0xA2, 0x48, 0xF5, 0xC5, 0xB9, 0xD3, 0xDF, 0x62, 0xBF, 0x1A, 0x94,
-    0x12, 0x6A, 0x76, 0xCD, 0xCF, 0x0B, 0x87, 0x46, 0x57, 0x11, 0xA6, 0x10, 0x7F, 0x20, 0x3F, 0xD4,
-    0x32, 0xBD, 0x18, 0xB7, 0xB9, 0x91, 0x93, 0xF5, 0x3B, 0xA6, 0x29, 0xC8, 0x69, 0x5A, 0x35, 0xCF,
-    0xC0, 0x54, 0x4E, 0x87, 0xBA, 0x36, 0x41, 0x2B, 0xEA, 0xDE, 0xBE, 0x1D, 0x36, 0x2D, 0x27, 0xF1,
-    0xB5, 0x61, 0x6B, 0x62, 0x15, 0x8C, 0x2D, 0x93, 0xC7, 0x6A, 0x59, 0xE3, 0xCF, 0xEB, 0x09, 0x4C,
-    0x01, 0xDA, 0xEA, 0x9B, 0x91, 0xD6, 0xC5, 0x15, 0x75, 0x3F, 0xAD, 0xF2, 0x2E, 0x59, 0x20, 0x59,
-    0x8E, 0xC6, 0x9D, 0x74, 0xB4, 0xC7, 0x26, 0x04, 0xFA, 0xC2, 0x0E, 0xB7, 0xF4, 0xB2, 0xFA, 0x36,
-    0x9E, 0x48, 0x45, 0xE8, 0x26, 0x67, 0x66, 0x9C, 0x94, 0x53, 0x64, 0xE5, 0x4D, 0x19, 0x31, 0xB1,
-    0x74, 0x4D, 0xD5, 0x85, 0x62, 0x7F, 0x1A, 0xA3, 0x4D, 0x83, 0xDB, 0xE4, 0x24, 0x18, 0x62, 0xE2,
-    0xA2, 0x11, 0xEA, 0xBA, 0x50, 0x5A, 0xC7, 0x5F, 0x8D, 0x36, 0x22, 0x92, 0x5E, 0xDF, 0xDB, 0x96,
-    0xA9, 0x57, 0xED, 0xAE, 0x0E, 0xF2, 0xB5, 0xDF, 0x92, 0x9C, 0x53, 0xDD, 0x1D, 0xA6, 0x50, 0xD7,
-    0xDB, 0x94, 0x40, 0xC9, 0x4B, 0x3B, 0xD7, 0xBF, 0xC5, 0x48, 0xD9, 0x29, 0x43, 0x66, 0xC5, 0xFE,
-    0x5E, 0xBE, 0x3E, 0x50, 0xCD, 0x1F, 0xA8, 0x0D, 0x50, 0x5E, 0xD5, 0x84, 0xBE, 0xA8, 0xA4, 0xCC,
-    0xAB, 0x9F, 0x1D, 0x54, 0xD8, 0x48, 0x11, 0x15, 0x60, 0x87, 0xCC, 0x71, 0xEB, 0xFE, 0x2D, 0x2E,
-    0xF9, 0xBD, 0xBB, 0x93, 0x9B, 0x36, 0x2F, 0x47, 0x55, 0x77, 0xED, 0xFC, 0x57, 0xF9, 0xC5, 0x1A,
-    0x2F, 0x53, 0xFD, 0xE1, 0xFD, 0x67, 0x79, 0x66, 0xFD, 0x0D, 0x88, 0xDA, 0xBF, 0x43, 0xF3, 0x3C,
-    0xF9, 0xE4, 0x93, 0x27, 0xEA, 0x53, 0x9B, 0x4C, 0xFC, 0x1A, 0x7D, 0x63, 0x78, 0x61, 0x57, 0xA8,
-    0x85, 0xBC, 0xCA, 0x86, 0x1E, 0xB6, 0xB6, 0xE8, 0xED, 0xAC, 0x2D, 0x1A, 0xEF, 0x54, 0xE7, 0x32,
-    0xD8, 0x1F, 0x2E, 0xA9, 0xE4, 0x7E, 0x70, 0xA5, 0x39, 0x4A, 0xEA, 0xC5, 0x13, 0x49, 0xC1, 0x40,
-    0x1B, 0x73, 0xEF, 0x25, 0x36, 0x74, 0x13, 0x63, 0xF4, 0xE9, 0x03, 0xBE, 0x82, 0x60, 0xF6, 0x84,
-    0xBA, 0xB6, 0x4F, 0xCD, 0x8B, 0x07, 0x72, 0x74, 0x9C, 0x9E, 0xAA, 0xC9, 0x57, 0xF0, 0xD3, 0x65,
-    0x1A, 0x29, 0x9C, 0xB2, 0x40, 0x42, 0xED, 0x43, 0x34, 0xF2, 0x6A, 0xA2, 0xCA, 0xE5, 0x91, 0xD1,
-    0xE8, 0x59, 0xE9, 0x33, 0x57, 0xB3, 0xCB, 0xEB, 0xD1, 0x53, 0xC2, 0x40, 0xDA, 0x82, 0x7D, 0xBB,
-    0x91, 0xBD, 0x2C, 0x6B, 0x73, 0xED, 0x8D, 0x2F, 0x3F, 0x32, 0xB7, 0xFA, 0xC5, 0x67, 0xC9, 0x52,
-    0x68, 0xF7, 0x72, 0xB9, 0xF6, 0x83, 0x3A, 0x59, 0xE0, 0xD1, 0x91, 0x1C, 0x54, 0x2A, 0x39, 0xFD,
-    0x81, 0x79, 0x0F, 0xB5, 0xEE, 0x69, 0x46, 0x5B, 0xD1, 0x4C, 0x9D, 0xB4, 0x10, 0xAF, 0xFD, 0x0C,
-    0xB7, 0x6C, 0x7C, 0x07, 0xDA, 0x73, 0x71, 0x74, 0xC5, 0xA1, 0x2F, 0xD5, 0xF8, 0x52, 0x86, 0x5F,
-    0xA1, 0x21, 0xB0, 0x7F, 0x99, 0x3C, 0xF9, 0x39, 0xBE, 0x4B, 0xF4, 0xA9, 0x37, 0x5E, 0xAE, 0x86,
-    0x9C, 0x4E, 0xCD, 0xDF, 0x32, 0x71, 0xB1, 0x26, 0xB2, 0xF6, 0xE5, 0xC9, 0x2B, 0xBC, 0x2A, 0x2C,
-    0x19, 0xF1, 0x71, 0xF2, 0x9D, 0xE9, 0x16, 0x4E, 0x99, 0xB7, 0xCF, 0x9B, 0xB7, 0x67, 0xCD, 0x9B,
-    0xCA, 0xF3, 0x77, 0x4C, 0x05, 0xD5, 0x8A, 0xBC, 0x2C, 0x4E, 0xA8, 0xA7, 0x7A, 0xAA, 0x98, 0xED,
-    0xC2, 0xE8, 0xE9, 0xC3, 0xA9, 0xD3, 0x70, 0xC8, 0x49, 0xB9, 0x84, 0x0A, 0xE7, 0xD7, 0xD2, 0x75,
-    0xA5, 0xC7, 0x0E, 0xBD, 0xC3, 0x16, 0x8D, 0xC5, 0xD9, 0x1D, 0x93, 0x17, 0xC1, 0xF3, 0xAD, 0x0C,
-    0xF3, 0xFC, 0xAC, 0x21, 0xE9, 0xF3, 0x63, 0xCA, 0x44, 0x5E, 0x31, 0x6F, 0xE3, 0xBE, 0xC0, 0x09,
-    0xA7, 0x6A, 0xA5, 0x4E, 0xD2, 0xB0, 0xE8, 0xB1, 0x2B, 0x32, 0xBE, 0x90, 0x0E, 0xAF, 0x3D, 0x30,
-    0xB1, 0x04, 0xCC, 0x23, 0xEB, 0x22, 0x3C, 0x88, 0x84, 0xAC, 0x12, 0xF5, 0xDB, 0xD5, 0x22, 0x05,
-    0xD7, 0x92, 0x63, 0x96, 0x00, 0xC4, 0x4C, 0xA3, 0xC7, 0xAB, 0x34, 0x5A, 0x7D, 0xA0, 0x1F, 0xB1,
-    0x00, 0xEE, 0x1D, 0xD6, 0xBC, 0xF5, 0x58, 0x1B, 0xD6, 0xA3, 0x3C, 0x6E, 0x12, 0x55, 0x95, 0x5B,
-    0xC6, 0x26, 0x34, 0x2A, 0x8B, 0x29, 0xF2, 0x25, 0xB8, 0xAC, 0xC6, 0x10, 0xD7, 0x99, 0xFD, 0xED,
-    0x45, 0x95, 0xB1, 0x3E, 0xCB, 0xDA, 0x3A, 0x26, 0x2D, 0xE1, 0xD7, 0xDF, 0x86, 0xAB, 0xFF, 0x53,
-    0x88, 0xA2, 0x2B, 0x39, 0x4C, 0x29, 0x05, 0x3E, 0x87, 0x7D, 0xFA, 0x1D, 0x82, 0x93, 0x4F, 0xD0,
-    0x0F, 0xC4, 0x12, 0x4C, 0xA2, 0xE4, 0x03, 0xAD, 0x82, 0x12, 0x0A, 0x53, 0xBA, 0x93, 0xAE, 0x9D,
-    0x0D, 0xF9, 0x54, 0xAA, 0xEA, 0xE5, 0x9B, 0xA1, 0x74, 0x20, 0x1F, 0x8F, 0x7F, 0x10, 0xEA, 0x77,
-    0x85, 0x0F, 0x00, 0x0C, 0xAE, 0x6E, 0x96, 0x5C, 0x94, 0x40, 0xC8, 0x60, 0x23, 0xB4, 0xB0, 0x2A,
-    0xE0, 0x67, 0x28, 0x5B, 0x68, 0xB0, 0x3A, 0x4C, 0xC1, 0x38, 0x81, 0xA2, 0x49, 0x15, 0x91, 0x6B,
-    0x37, 0x65, 0xEA, 0xDC, 0x14, 0xC0, 0x4E, 0xB0, 0x72, 0x07, 0xDE, 0x0C, 0xB3, 0x68, 0x4C, 0xA2,
-    0xA4, 0x9A, 0xF6, 0xE1, 0x39, 0xFC, 0xD6, 0x99, 0x2A, 0xAA, 0x6A, 0x56, 0xEB, 0xA6, 0x80, 0x19,
-    0xC0, 0x02, 0xBE, 0xBB, 0xA3, 0xB5, 0x53, 0x06, 0x1E, 0xAC, 0x61, 0xFC, 0xE3, 0x7D, 0xD7, 0x60,
-    0x17, 0x2F, 0x85, 0xBF, 0xAF, 0x96, 0x1A, 0x82, 0x7D, 0x96, 0x1A, 0xDC, 0xE6, 0xD0, 0x19, 0xE8,
-    0x52, 0x43, 0xAE, 0x6B, 0x68, 0x4F, 0x4F, 0x65, 0xE1, 0xE4, 0xA9, 0x51, 0x3E, 0x63, 0xA5, 0x53,
-    0xF6, 0x7B, 0x65, 0xFF, 0xD8, 0x05, 0x57, 0x96, 0xF6, 0x56, 0x8F, 0xA5, 0x8B, 0xE1, 0x11, 0xB3,
-    0x7F, 0x8E, 0x8E, 0x67, 0x19, 0x8D, 0xE7, 0x60, 0x17, 0x74, 0x4C, 0x01, 0x98, 0x1C, 0xF4, 0xFB,
-    0x08, 0x4E, 0x31, 0xD6, 0x2B, 0xDC, 0xEF, 0x2F, 0x8E, 0x48, 0x90, 0xE5, 0xF5, 0x50, 0xC7, 0x5C,
-    0x76, 0x1D, 0x5C, 0x90, 0x3D, 0xA8, 0xBC, 0x8D, 0xB0, 0x55, 0xCD, 0x46, 0x77, 0x76, 0xBB, 0x5A,
-    0xBD, 0x76, 0xAB, 0xD2, 0x34, 0x2E, 0xC0, 0x73, 0x71, 0xDE, 0x80, 0xE1, 0x28, 0x2D, 0x8E, 0xD2,
-    0xBC, 0x12, 0x95, 0xF6, 0xCE, 0xF2, 0xD0, 0xEE, 0xEC, 0xE7, 0xF0, 0x3A, 0xCF, 0xF4, 0x1B, 0x69,
-    0x61, 0x8F, 0xD3, 0xD9, 0x71, 0x51, 0x0D, 0x1D, 0x7E, 0xCF, 0x67, 0xC0, 0x17, 0x65, 0xA2, 0x91,
-    0x2E, 0x24, 0xE5, 0x1C, 0x3A, 0xE5, 0xE9, 0xD2, 0xA8, 0xAB, 0x5E, 0x22, 0xC3, 0x20, 0xD6, 0x4F,
-    0x34, 0x18, 0x91, 0xB4, 0x1B, 0x0C, 0xE5, 0xBC, 0x86, 0x56, 0x9B, 0xFC, 0x0B, 0x85, 0xBA, 0xC6,
-    0x45, 0x44, 0x71, 0x6E, 0x6B, 0x12, 0xE2, 0x62, 0xA0, 0x4E, 0x2F, 0x43, 0xBB, 0x2E, 0xAF, 0xC4,
-    0x5D, 0x76, 0xAE, 0x2D, 0xF4, 0xB5, 0xB5, 0x40, 0xE3, 0x89, 0x46, 0xDE, 0x05, 0xAE, 0x1B, 0x83,
-    0x78, 0x10, 0xBE, 0x42, 0x9B, 0xB8, 0xB8, 0xC0, 0x4C, 0x8D, 0x1B, 0x6E, 0x30, 0x43, 0xBC, 0xC1,
-    0xEA, 0xB8, 0x0D, 0x1A, 0x9D, 0x1F, 0xE2, 0x92, 0xC6, 0x3B, 0x8C, 0x17, 0xB9, 0xDA, 0xE2, 0xFF,
-    0x88, 0x19, 0xD9, 0x0D, 0x0C, 0x4C, 0xB6, 0xC1, 0xE8, 0x7C, 0x83, 0xD9, 0xCC, 0x8D, 0xDA, 0x76,
-    0x57, 0x36, 0xAC, 0xE1, 0x58, 0xBE, 0x77, 0xA1, 0x47, 0x4F, 0xB4, 0x28, 0x8D, 0xA5, 0xA6, 0x0E,
-    0xB3, 0xAD, 0x91, 0x01, 0x46, 0xAF, 0x73, 0x68, 0xE2, 0xE8, 0xCB, 0xA7, 0x2B, 0xEA, 0x18, 0x7D,
-    0x41, 0x8F, 0x6D, 0xEA, 0x9D, 0x15, 0x5D, 0x06, 0xF4, 0x4C, 0x41, 0x18, 0x8B, 0xC7, 0xE8, 0x7F,
-    0x61, 0x60, 0xA1, 0xE1, 0x24, 0xEE, 0x6B, 0xB5, 0xB2, 0xBC, 0xC3, 0x84, 0x0B, 0x13, 0x2D, 0x4D,
-    0xD1, 0xC2, 0x32, 0x28, 0x43, 0x48, 0x32, 0xA7, 0x76, 0x95, 0xFC, 0x53, 0xC4, 0x6A, 0x4A, 0x65,
-    0x37, 0xBC, 0xC1, 0xC5, 0x20, 0x3B, 0x63, 0xC6, 0xD4, 0xA3, 0xEF, 0x83, 0xD0, 0x1D, 0xE3, 0x88,
-    0xE3, 0xE3, 0x9C, 0xC5, 0x6B, 0x3C, 0xC9, 0xBC, 0xE9, 0x76, 0x21, 0xC3, 0xC9, 0x45, 0x24, 0x0C,
-    0xDA, 0x14, 0x51, 0xFF, 0x0D, 0xA2, 0x7E, 0x03, 0xA2, 0x10, 0x8B, 0xC6, 0xDB, 0x15, 0x51, 0xF9,
-    0x04, 0x51, 0xB8, 0x39, 0x46, 0xCF, 0xE2, 0xDF, 0x80, 0xA8, 0xAF, 0x8F, 0x89, 0x52, 0x77, 0x9E,
-    0x04, 0x3C, 0x9F, 0xDD, 0xF9, 0xAF, 0xE8, 0x4E, 0x29, 0x77, 0x06, 0x4A, 0x40, 0xCA, 0x03, 0x04,
-    0xF0, 0x2B, 0x4E, 0x7E, 0x18, 0x15, 0xBF, 0xC8, 0xC0, 0xAA, 0x50, 0x9A, 0x1B, 0x54, 0x82, 0xCB,
-    0xBF, 0xAD, 0xA5, 0xBD, 0x81, 0x1B, 0x3D, 0xFE, 0x1F, 0x9E, 0x46, 0x9E, 0xBA, 0x4E, 0xFA, 0xCB,
-    0x5C, 0x6B, 0x10, 0xA8, 0xB0, 0x99, 0x75, 0xAD, 0x23, 0x90, 0xAB, 0x47, 0x4D, 0xAD, 0xF1, 0x81,
-    0xC2, 0xE4, 0x0A, 0xAF, 0xE6, 0x5E, 0x00, 0xDD, 0xD1, 0xE4, 0xF6, 0xB4, 0xDA, 0x62, 0xB4, 0x14,
-    0xC1, 0x4C, 0xFC, 0x82, 0xA9, 0x0D, 0x7D, 0x1E, 0x51, 0xC4, 0x57, 0x71, 0xFE, 0xA2, 0xD0, 0xD4,
-    0x18, 0x58, 0x66, 0x96, 0x3A, 0x31, 0xBF, 0x85, 0x54, 0xBC, 0x4D, 0xCD, 0xDC, 0xF7, 0x0A, 0xBC,
-    0x41, 0x94, 0x9B, 0x9C, 0xD6, 0xAE, 0xE8, 0xF4, 0x68, 0x11, 0x9F, 0x96, 0xEE, 0xEA, 0x0C, 0xC9,
-    0xDB, 0x85, 0x98, 0x39, 0xD2, 0xF1, 0xD0, 0xC1, 0xD1, 0x69, 0xD2, 0x39, 0xD4, 0x89, 0xAA, 0x6E,
-    0xD3, 0x06, 0xC8, 0x5F, 0xA0, 0x21, 0x39, 0x7B, 0x41, 0xE6, 0x7A, 0x03, 0xC9, 0xCF, 0x76, 0x21,
-    0xE4, 0x6D, 0x56, 0x3B, 0xD3, 0xCD, 0x82, 0x98, 0x5E, 0xC6, 0xA5, 0x1D, 0xCA, 0x1F, 0xAB, 0x32,
-    0x03, 0x31, 0xBF, 0xA1, 0x91, 0xB6, 0xD6, 0x79, 0xB7, 0x59, 0x7F, 0x27, 0xF1, 0xA1, 0x88, 0x65,
-    0x78, 0xA2, 0xB5, 0xBB, 0x2C, 0xC4, 0xFB, 0x94, 0x8B, 0xB9, 0x12, 0x62, 0xD0, 0x28, 0xB6, 0xDB,
-    0x85, 0x4E, 0x33, 0xFD, 0x0D, 0x66, 0x6A, 0xEC, 0x81, 0x6A, 0x69, 0x6F, 0xBF, 0xDF, 0x30, 0x9F,
-    0x74, 0x98, 0xAC, 0xDD, 0xB0, 0x06, 0xF2, 0xB5, 0xCA, 0xB6, 0xCC, 0x4F, 0x8C, 0xFC, 0x0A, 0x81,
-    0x4A, 0x6A, 0xC2, 0x86, 0xD2, 0xA3, 0x9F, 0x64, 0x02, 0xE9, 0x02, 0xA4, 0xA2, 0x5D, 0x3F, 0xEC,
-    0x42, 0x1D, 0x0D, 0xB5, 0xB5, 0x6C, 0xFD, 0x48, 0x25, 0xF2, 0x2C, 0x73, 0xBF, 0xAE, 0x98, 0x55,
-    0x80, 0x50, 0x7F, 0x99, 0x96, 0xC8, 0x9B, 0xB2, 0xF8, 0xAE, 0xE2, 0xB6, 0xE2, 0x60, 0x2F, 0x9E,
-    0x08, 0x9F, 0xD5, 0x8D, 0xD3, 0x85, 0x0B, 0x93, 0xE8, 0xD5, 0x68, 0x92, 0x7D, 0x91, 0x51, 0x21,
-    0x00, 0xA9, 0x87, 0xA8, 0xDD, 0x5D, 0xEA, 0xEE, 0xB3, 0x46, 0xD3, 0xFC, 0xAD, 0xE8, 0x02, 0x4C,
-    0x21, 0x41, 0x1D, 0x43, 0xEF, 0x73, 0x15, 0xC4, 0x67, 0x59, 0x8B, 0x4F, 0xF5, 0x5F, 0x2D, 0xD4,
-    0xEC, 0x54, 0xDC, 0xC7, 0x55, 0x79, 0x9D, 0x45, 0xB6, 0xA4, 0x92, 0x82, 0x49, 0x09, 0x27, 0xDC,
-    0xBC, 0xE5, 0x01, 0xCF, 0xF4, 0x4D, 0x98, 0x80, 0x80, 0x06, 0xAE, 0xA1, 0xC7, 0x2A, 0x82, 0x40,
-    0x2E, 0x77, 0xD8, 0x2E, 0x33, 0x0B, 0x05, 0xD3, 0x0C, 0x39, 0xE2, 0x22, 0x8B, 0x48, 0x0C, 0x62,
-    0xCE, 0xA9, 0x60, 0xCE, 0xA9, 0xEB, 0xE2, 0xB6, 0x80, 0x39, 0x27, 0x8F, 0x39, 0x27, 0x2E, 0xEF,
-    0x2E, 0x97, 0xDA, 0xA7, 0xE5, 0xCA, 0xC9, 0xBD, 0x44, 0xAB, 0x8C, 0xC6, 0x5F, 0xE7, 0x10, 0x7C,
-    0x4B, 0x7C, 0xA8, 0xCB, 0x76, 0xFD, 0xC7, 0x69, 0xEC, 0x3E, 0x9F, 0x31, 0x21, 0x4C, 0x68, 0xE3,
-    0xB3, 0xEF, 0xBC, 0x9F, 0x78, 0xB5, 0xDB, 0xA1, 0x0B, 0xFD, 0x6B, 0x93, 0x27, 0x64, 0xF6, 0xCA,
-    0x44, 0x61, 0x65, 0x8E, 0x98, 0x62, 0xED, 0xC1, 0x82, 0x9F, 0x6B, 0x29, 0x48, 0x4A, 0x4C, 0x12,
-    0x21, 0x33, 0x7E, 0x2D, 0xED, 0x11, 0x6D, 0xD5, 0xA9, 0xB0, 0x5A, 0x2F, 0x34, 0xC1, 0x8F, 0x7F,
-    0x60, 0xF0, 0x93, 0xD3, 0x14, 0xCF, 0xAB, 0xA0, 0xD4, 0xF5, 0xE8, 0xB1, 0xA4, 0xE4, 0xE1, 0x0B,
-    0x35, 0x73, 0x03, 0xB2, 0x1B, 0xAE, 0xC8, 0x59, 0xAD, 0xBF, 0x38, 0xBB, 0x79, 0xA1, 0x4A, 0x7C,
-    0xEE, 0x7B, 0xB4, 0x12, 0x1E, 0x93, 0xE1, 0x98, 0x1D, 0xC5, 0x3B, 0x75, 0x91, 0x09, 0x73, 0x43,
-    0xB4, 0xFC, 0xCC, 0x76, 0xB0, 0x36, 0x53, 0x0A, 0x34, 0x7E, 0x39, 0xD3, 0x1B, 0x75, 0x84, 0x0E,
-    0x21, 0x6E, 0xB4, 0x16, 0xD6, 0xDE, 0x67, 0x2D, 0x4C, 0x73, 0x5A, 0x3F, 0xCF, 0xC4, 0xFE, 0x75,
-    0x52, 0xAD, 0x85, 0x85, 0xA6, 0x42, 0xA2, 0x79, 0x70, 0x90, 0x79, 0x2C, 0xBA, 0x58, 0x7D, 0x0A,
-    0x19, 0xAE, 0xB3, 0xDE, 0xFE, 0x61, 0xE8, 0x2A, 0x77, 0xE8, 0x72, 0x21, 0x55, 0xA7, 0x7B, 0x6F,
-    0xEE, 0xA1, 0xEB, 0xD0, 0xAA, 0xD3, 0xD6, 0xAE, 0xAA, 0xD3, 0xFE, 0xEE, 0xAA, 0x53, 0x0A, 0x02,
-    0xDD, 0x12, 0x6B, 0xBF, 0xF0, 0xFA, 0x4B, 0xAC, 0x26, 0xD1, 0x6C, 0x6A, 0xE8, 0x6B, 0x35, 0x89,
-    0xFD, 0xFB, 0xDC, 0x54, 0x93, 0xB4, 0xAA, 0xFC, 0x1F, 0x22, 0x58, 0xEB, 0x23, 0x26, 0xB8, 0x0A,
-    0x2D, 0x79, 0x6E, 0x88, 0x97, 0x06, 0x9A, 0x6E, 0xB4, 0x77, 0x81, 0xB5, 0xD6, 0xD3, 0xBA, 0x4D,
-    0x2E, 0xB0, 0x74, 0xD5, 0x70, 0x9F, 0x38, 0xF6, 0xB4, 0x1E, 0xC5, 0xE0, 0x71, 0xB6, 0x6D, 0x2F,
-    0xB6, 0x23, 0xB0, 0xE6, 0x29, 0xFA, 0xBC, 0x0B, 0x5C, 0xE9, 0x1B, 0xED, 0x76, 0x38, 0x2A, 0xA2,
-    0xCC, 0x18, 0x54, 0xAD, 0x77, 0xED, 0x42, 0xD6, 0x1A, 0xA6, 0x90, 0x85, 0x37, 0x07, 0x42, 0x1F,
-    0x43, 0xB9, 0xF5, 0x5C, 0x2F, 0x01, 0xA5, 0xC9, 0xEC, 0xBD, 0xF3, 0xBB, 0x4A, 0x68, 0x14, 0x06,
-    0x06, 0x4C, 0xD9, 0xE0, 0x04, 0x3C, 0xCD, 0x09, 0xF1, 0xB5, 0x68, 0x77, 0x1A, 0x98, 0x72, 0xF2,
-    0xFE, 0x94, 0xCB, 0xE5, 0x1F, 0x8A, 0xF5, 0xAF, 0x47, 0x13, 0x51, 0x43, 0xA7, 0x33, 0x0D, 0x33,
-    0x80, 0x27, 0x0C, 0xF4, 0x01, 0x5B, 0x7F, 0xB9, 0xAC, 0x74, 0xDA, 0x5B, 0xF0, 0x43, 0xF0, 0x7D,
-    0x0C, 0x33, 0x23, 0xAF, 0xD3, 0x49, 0x40, 0x13, 0x48, 0xA8, 0x8E, 0x27, 0x5C, 0xFF, 0x59, 0x1C,
-    0x5E, 0xEB, 0xDB, 0x25, 0x68, 0xB1, 0xA0, 0x5E, 0x9F, 0xD5, 0x63, 0x06, 0xB4, 0xB8, 0x2B, 0x07,
-    0xC4, 0x18, 0xF1, 0x63, 0xBA, 0x79, 0x4B, 0x7A, 0x37, 0x96, 0x93, 0xEE, 0x44, 0x4C, 0x71, 0x10,
-    0xEC, 0x8E, 0x9B, 0x9E, 0x09, 0x3F, 0xAE, 0x02, 0x3D, 0xBF, 0xCF, 0x4D, 0x3B, 0x07, 0x1E, 0xB2,
-    0x53, 0xCC, 0xAF, 0x75, 0x58, 0xF5, 0xAC, 0x46, 0x37, 0x0A, 0xF6, 0x8C, 0x19, 0xEA, 0xA7, 0x7D,
-    0x6E, 0x12, 0x62, 0xCE, 0xB9, 0x4D, 0xA6, 0x6A, 0x81, 0x93, 0x86, 0x5C, 0xF6, 0x1A, 0x4E, 0x6C,
-    0x09, 0x0B, 0xAA, 0xDA, 0x0E, 0xB3, 0x56, 0x44, 0x0D, 0x3D, 0x47, 0x15, 0xDD, 0xA7, 0xD9, 0xB8,
-    0x5E, 0x35, 0xFF, 0x2D, 0x51, 0x17, 0xB0, 0xF5, 0x7C, 0xF1, 0x54, 0x5B, 0xBA, 0xAF, 0xC4, 0xE2,
-    0xAF, 0xE0, 0xD9, 0x68, 0x6E, 0xFB, 0xF4, 0x70, 0xFD, 0x4D, 0x1D, 0xFC, 0xA2, 0xCA, 0x43, 0x37,
-    0x65, 0x46, 0x1A, 0x5A, 0x48, 0x57, 0x4C, 0xE6, 0x59, 0xA6, 0xE8, 0xD3, 0x64, 0x37, 0xB5, 0xFB,
-    0xC3, 0xD2, 0x97, 0x1D, 0xC4, 0xB1, 0x3B, 0x34, 0x7B, 0xC7, 0xA5, 0x79, 0x0F, 0x87, 0x4A, 0x59,
-    0xF4, 0xB2, 0x83, 0x6B, 0x49, 0xDC, 0x70, 0x39, 0xC3, 0x7D, 0x16, 0xB7, 0xB9, 0x98, 0x84, 0xB5,
-    0xA9, 0xA9, 0x12, 0x79, 0x6C, 0x9C, 0x03, 0xFA, 0x83, 0xEE, 0x03, 0x7A, 0xC4, 0xA2, 0x19, 0xD1,
-    0xF2, 0xE5, 0xDB, 0x4C, 0x67, 0xBF, 0x3D, 0x2E, 0x29, 0x38, 0x89, 0x62, 0xD5, 0xFD, 0x23, 0x26,
-    0xE3, 0x8F, 0xC3, 0xE1, 0x91, 0x77, 0xEE, 0x98, 0x7D, 0x95, 0x5B, 0xDF, 0xA0, 0x6F, 0xDB, 0x40,
-    0x44, 0xED, 0x80, 0xC3, 0xED, 0x6A, 0x43, 0xDC, 0x4E, 0xFA, 0xDD, 0x78, 0xA5, 0x8C, 0x76, 0xE9,
-    0xA5, 0xC3, 0xC2, 0xA8, 0x97, 0xD8, 0xAF, 0xF2, 0x41, 0x7B, 0x22, 0x27, 0x46, 0xD7, 0x11, 0x2B,
-    0xC5, 0x2C, 0xC4, 0xD5, 0x3B, 0x45, 0x99, 0x3B, 0x1E, 0x02, 0xA3, 0xBE, 0xB4, 0xF2, 0xA5, 0x1A,
-    0x74, 0xD7, 0x18, 0x72, 0x6A, 0xD2, 0x5A, 0xFC, 0x69, 0xA4, 0x8B, 0x2F, 0x2B, 0xC6, 0x00, 0xD2,
-    0xB0, 0x10, 0xE5, 0x23, 0x64, 0x11, 0x81, 0x89, 0xB8, 0x4F, 0x80, 0x88, 0xBE, 0xE2, 0xB5, 0x48,
-    0x5A, 0x59, 0x49, 0xD3, 0x73, 0xA6, 0x52, 0xB9, 0xBA, 0x0A, 0x50, 0xED, 0x36, 0x30, 0x99, 0x3B,
-    0x96, 0x07, 0xB1, 0x50, 0xE2, 0xCE, 0xC5, 0x50, 0x30, 0x49, 0x04, 0x4E, 0x96, 0x35, 0x2A, 0xAA,
-    0x49, 0xCD, 0xD4, 0x6B, 0x29, 0x10, 0xCC, 0x54, 0x4F, 0xDC, 0x62, 0xA0, 0x3B, 0x3C, 0x46, 0xDA,
-    0xCB, 0xAE, 0x56, 0x22, 0xED, 0xE8, 0xE4, 0xB6, 0xF9, 0x58, 0x13, 0xED, 0xC2, 0x5E, 0x0E, 0x27,
-    0x47, 0xF8, 0xD4, 0x64, 0xF6, 0x88, 0xBE, 0xBB, 0xBE, 0x76, 0x9D, 0x54, 0xBF, 0xBC, 0x61, 0xF6,
-    0xE9, 0x0A, 0x38, 0x8F, 0x39, 0xAA, 0xD4, 0xEC, 0xDF, 0x3A, 0xF1, 0x48, 0x28, 0x9C, 0x8A, 0x84,
-    0x16, 0xC6, 0xA2, 0xAF, 0x02, 0xF5, 0xE6, 0x83, 0x44, 0x42, 0x79, 0x15, 0x09, 0x4D, 0xE4, 0x08,
-    0x1D, 0xCD, 0x11, 0x3E, 0xBC, 0x3D, 0xEB, 0x54, 0xB0, 0xDB, 0xD7, 0x7D, 0x5A, 0x8E, 0x6F, 0xCF,
-    0xCA, 0x0A, 0xF6, 0x7A, 0x9C, 0xBA, 0x95, 0x4C, 0x74, 0x2F, 0x99, 0xE8, 0x66, 0x32, 0xD1, 0xDD,
-    0x64, 0xA2, 0xDB, 0xC9, 0x44, 0xF7, 0x93, 0x89, 0x6E, 0x28, 0x13, 0xDD, 0x51, 0x26, 0x90, 0x5B,
-    0x62, 0xEE, 0x29, 0x13, 0xDD, 0x54, 0x26, 0xBA, 0xAB, 0x4C, 0x74, 0x5B, 0x99, 0xE8, 0xBE, 0x32,
-    0xD1, 0x8D, 0x65, 0xA2, 0x3B, 0xCB, 0x74, 0xDB, 0x02, 0xB7, 0x0B, 0x17, 0x62, 0xE4, 0xC6, 0xAC,
-    0x2F, 0x9E, 0x9B, 0x08, 0x8E, 0x4C, 0x42, 0xF9, 0xAF, 0x58, 0xAC, 0xBD, 0x28, 0xDB, 0x52, 0xC3,
-    0xF5, 0x06, 0xD5, 0xFB, 0xF2, 0x49, 0xE4, 0xC6, 0x70, 0xE9, 0xCE, 0xAD, 0xC8, 0xEF, 0xD3, 0x60,
-    0x45, 0xF2, 0xDC, 0x27, 0xDA, 0x00, 0x5A, 0xC9, 0x81, 0x82, 0x0C, 0xC8, 0x4B, 0x80, 0xDC, 0xA4,
-    0x13, 0x41, 0x16, 0x3A, 0xAA, 0xBE, 0xC7, 0xCF, 0xD1, 0xC7, 0xCC, 0xCB, 0xD1, 0x35, 0xEC, 0x95,
-    0x47, 0x44, 0x98, 0x9D, 0x9A, 0xD8, 0xB5, 0x7B, 0x52, 0x3B, 0x62, 0x67, 0x65, 0xD1, 0x79, 0x35,
-    0xAF, 0xDD, 0x4A, 0x4D, 0xA9, 0x3C, 0x22, 0x10, 0xB7, 0xCC, 0xBF, 0xF0, 0x5C, 0x5F, 0x27, 0x95,
-    0x4A, 0xC6, 0xAE, 0x36, 0x48, 0xC0, 0x1A, 0xFB, 0xA3, 0x0D, 0x12, 0xDD, 0xC6, 0xF6, 0xB3, 0xE3,
-    0xCD, 0x20, 0x54, 0x29, 0xF3, 0x13, 0xEB, 0x72, 0x27, 0x43, 0x17, 0x55, 0xCD, 0x7B, 0xA9, 0xF3,
-    0xDD, 0x74, 0x5C, 0x32, 0x70, 0x1C, 0xBA, 0x3C, 0x0D, 0xFB, 0x5A, 0xEA, 0xD9, 0x69, 0x6A, 0xC4,
-    0x6C, 0x68, 0x85, 0x66, 0x55, 0x0A, 0x0B, 0xCD, 0xB6, 0x15, 0xAA, 0xC9, 0xEE, 0x2E, 0x85, 0x78,
-    0x1A, 0xFD, 0xCC, 0x40, 0x86, 0xEB, 0x91, 0x5C, 0x5E, 0xE7, 0x79, 0xEA, 0x03, 0xB1, 0xEE, 0xB0,
-    0x3A, 0x18, 0x2A, 0xA4, 0x50, 0xF1, 0x29, 0x34, 0x1D, 0x5A, 0x88, 0x89, 0xEC, 0xB3, 0xA6, 0x62,
-    0xEB, 0x2D, 0x98, 0xDB, 0x46, 0xF9, 0x8B, 0x32, 0x3D, 0xF7, 0x67, 0xE5, 0x77, 0x99, 0x0D, 0xA5,
-    0x5D, 0xED, 0x6A, 0x79, 0x88, 0x04, 0xB3, 0xDC, 0x74, 0xE4, 0xFD, 0x0F, 0xAC, 0x6E, 0x5B, 0x6B,
-    0x7F, 0x44, 0xE3, 0x68, 0x26, 0xB3, 0xEC, 0x52, 0x66, 0x3A, 0xD7, 0xFE, 0xE1, 0x5E, 0xBF, 0xB1,
-    0x3D, 0xF2, 0x17, 0x1E, 0xB1, 0xD6, 0xDC, 0x5A, 0xEA, 0xC0, 0xFC, 0xBD, 0xF5, 0xE0, 0xFF, 0x7A,
-    0xC1, 0x96, 0x97, 0x9C, 0x28, 0xB7, 0xEF, 0xA7, 0x72, 0xD9, 0x94, 0xD3, 0x22, 0xA2, 0xCC, 0xDC,
-    0xD7, 0xFB, 0x4D, 0x6E, 0xAE, 0x5B, 0x68, 0x8B, 0x07, 0xC5, 0x04, 0xB5, 0xB4, 0x13, 0x51, 0x86,
-    0x33, 0xEE, 0xBD, 0xAE, 0x35, 0x2A, 0xC5, 0x95, 0xD9, 0xF2, 0x2E, 0x35, 0x62, 0xF4, 0xA8, 0xC9,
-    0x9F, 0xF6, 0x27, 0x22, 0x59, 0x2A, 0x26, 0x8F, 0xD5, 0x1E, 0xAC, 0x0A, 0x6A, 0x9B, 0x9D, 0x7A,
-    0x0B, 0xBE, 0x56, 0x01, 0x48, 0xDB, 0xA3, 0x9D, 0x4E, 0x9C, 0xBC, 0x36, 0xC4, 0x48, 0x9A, 0x1A,
-    0x55, 0x99, 0xD5, 0xF4, 0xE4, 0x57, 0xB8, 0x02, 0xD7, 0x1D, 0xFD, 0xD3, 0x83, 0x85, 0x5E, 0x39,
-    0xDC, 0x5A, 0xDF, 0x8A, 0x59, 0xAD, 0xE4, 0xC3, 0xB6, 0x36, 0x6E, 0xE5, 0xCE, 0xB8, 0x2E, 0x44,
-    0x36, 0x7C, 0x03, 0x9F, 0x01, 0x31, 0x9C, 0xF2, 0xD7, 0x12, 0x1C, 0xF2, 0x80, 0xB4, 0x91, 0x89,
-    0x56, 0x76, 0xF0, 0xCE, 0xEB, 0x0F, 0xBD, 0xD5, 0xB9, 0x72, 0x71, 0xDC, 0xAA, 0x04, 0xE1, 0x24,
-    0x5D, 0x1C, 0x15, 0xE0, 0x77, 0x73, 0x85, 0x9D, 0xAD, 0x57, 0x27, 0xB7, 0xB3, 0x7A, 0xD7, 0x24,
-    0x1C, 0x6B, 0xFB, 0x0F, 0x64, 0x3A, 0xF4, 0xB4, 0x22, 0xB3, 0x65, 0x9C, 0xD7, 0xD1, 0xFF, 0x61,
-    0xA0, 0x87, 0x3C, 0x60, 0xC9, 0x02, 0x9E, 0x71, 0x75, 0x58, 0xA5, 0x5B, 0x9C, 0x09, 0x93, 0x55,
-    0x4F, 0x9E, 0xC4, 0xB9, 0xD6, 0x3A, 0xE9, 0x28, 0xAA, 0x52, 0xF7, 0x0B, 0x9D, 0x72, 0x70, 0x76,
-    0xA9, 0x6F, 0xCA, 0xE9, 0x29, 0xD1, 0x6D, 0x9A, 0x9E, 0xDA, 0x5D, 0xCD, 0x4C, 0xCD, 0x16, 0x23,
-    0xF1, 0x58, 0xA8, 0x3C, 0x00, 0x69, 0x2F, 0x5A, 0xFD, 0x5E, 0x99, 0xD1, 0x9B, 0xA7, 0x8B, 0x55,
-    0x0E, 0x4E, 0x74, 0x37, 0xB7, 0x0B, 0x45, 0xA8, 0x89, 0xAA, 0xA3, 0x97, 0x0C, 0x1B, 0x86, 0x6C,
-    0x9B, 0x0D, 0xE6, 0xE3, 0x8D, 0x79, 0x27, 0xB4, 0x71, 0xDD, 0x4C, 0xD3, 0xF9, 0x64, 0x5C, 0xA7,
-    0x7D, 0x1C, 0xA2, 0xB4, 0x12, 0x53, 0xE6, 0xDD, 0x29, 0x21, 0x39, 0x52, 0x45, 0x99, 0xB3, 0x0F,
-    0x3A, 0x5A, 0x45, 0x99, 0x16, 0xC7, 0xE5, 0x0A, 0xE3, 0x57, 0x55, 0x65, 0xE6, 0x6A, 0x95, 0x99,
-    0x37, 0xAE, 0x32, 0xAB, 0xB6, 0xE9, 0x55, 0x55, 0x66, 0x6E, 0x14, 0x68, 0x95, 0x59, 0x6B, 0xAA,
-    0xCA, 0xEC, 0xFF, 0x7B, 0x15, 0xDC, 0x43, 0x8E, 0xF3, 0x83, 0xD3, 0x3C, 0x1A, 0xE7, 0x64, 0xEF,
-    0x38, 0x3F, 0x68, 0x3F, 0x5C, 0xEE, 0xFF, 0x74, 0x92, 0x89, 0x1E, 0x9C, 0xE8, 0x7E, 0x55, 0xFF,
-    0x1C, 0x0F, 0xF3, 0x3A, 0xD6, 0xD6, 0x1A, 0x2D, 0x18, 0xA8, 0x6A, 0xA9, 0x4F, 0x72, 0xF7, 0x3A,
-    0xF7, 0xE5, 0x39, 0x65, 0xFE, 0x99, 0xD4, 0xF8, 0x1B, 0x62, 0xA7, 0x8D, 0xE8, 0x49, 0xEF, 0xBC,
-    0x37, 0xF6, 0x61, 0x67, 0xFE, 0x3E, 0x93, 0x3E, 0x30, 0x71, 0xCA, 0x32, 0xE4, 0x73, 0xEE, 0xB8,
-    0x96, 0xF2, 0xC4, 0xFF, 0x83, 0x00, 0x2B, 0xA9, 0xDA, 0xBE, 0xFE, 0x9B, 0x13, 0x3B, 0x49, 0x0F,
-    0xE8, 0x4B, 0x30, 0xD6, 0x1A, 0xA6, 0x2F, 0xF9, 0xA7, 0xF6, 0xC5, 0xDA, 0xD5, 0x97, 0x71, 0xF0,
-    0x3F, 0x76, 0x17, 0x4E, 0x66, 0x8F, 0x7E, 0xE5, 0x21, 0xBF, 0x97, 0x8E, 0x1C, 0x80, 0xA3, 0x6E,
-    0xD6, 0x3B, 0x6E, 0x0D, 0x44, 0x2F, 0xE1, 0xE1, 0x4C, 0x1C, 0x76, 0x74, 0xA4, 0x4D, 0x50, 0xA5,
-    0xE6, 0xBC, 0x27, 0x0B, 0x14, 0x4E, 0x8F, 0x06, 0x21, 0x70, 0x47, 0x68, 0xD2, 0x78, 0x7D, 0x46,
-    0x7B, 0xE7, 0x8D, 0xA9, 0xF4, 0xA7, 0x4C, 0xE5, 0x83, 0xEE, 0xE3, 0x7B, 0xE8, 0xA2, 0x8E, 0x7E,
-    0xB5, 0xA1, 0x62, 0xA5, 0x82, 0xB8, 0x62, 0xD6, 0xF4, 0x88, 0x85, 0x1E, 0x99, 0x46, 0x56, 0xA3,
-    0x83, 0xB5, 0xA9, 0xD1, 0x49, 0x2C, 0x1B, 0x0C, 0xBA, 0xA6, 0x8E, 0x74, 0x22, 0xFF, 0xA7, 0x99,
-    0xEB, 0xEC, 0x01, 0x96, 0x0D, 0xD6, 0xA6, 0x97, 0x0D, 0xC8, 0xAA, 0x2D, 0xBD, 0xE1, 0x30, 0x3A,
-    0x4F, 0x75, 0x6E, 0x84, 0xF0, 0xF5, 0x93, 0xC7, 0x7A, 0x37, 0xA3, 0x43, 0xE8, 0xE4, 0x3F, 0xD5,
-    0xC8, 0xF7, 0xD2, 0x64, 0x36, 0xC6, 0x36, 0x4A, 0xBA, 0x78, 0xE5, 0x3E, 0x34, 0x2D, 0xA8, 0x20,
-    0xFF, 0x1F, 0xC5, 0x59, 0x3F, 0x6C, 0x1B, 0x55, 0x1C, 0xFE, 0xEE, 0xCE, 0xEE, 0x35, 0xB9, 0xC6,
-    0xE7, 0xA1, 0x08, 0x9A, 0xA6, 0x35, 0x43, 0x91, 0x92, 0x92, 0xC6, 0x0C, 0x1D, 0x82, 0x64, 0x27,
-    0x8F, 0x01, 0x31, 0x74, 0x20, 0x20, 0xCA, 0xCC, 0xC0, 0x80, 0x58, 0x92, 0xA1, 0x43, 0x91, 0xDC,
-    0xFA, 0x06, 0xA4, 0x0E, 0x2C, 0xAE, 0x04, 0x33, 0x1D, 0x18, 0x50, 0x18, 0x92, 0xA1, 0xAA, 0x2C,
-    0xE1, 0xD6, 0x27, 0x75, 0x60, 0x75, 0xA9, 0x10, 0xEB, 0x01, 0x9D, 0xC2, 0xC0, 0x55, 0x18, 0x29,
-    0x2A, 0x6E, 0x8E, 0xEF, 0xF7, 0xDE, 0x5D, 0xFA, 0x87, 0x14, 0x9A, 0xF8, 0xEC, 0x5E, 0xEE, 0xBD,
-    0x9C, 0xCF, 0xEF, 0x7E, 0xEF, 0xFB, 0x7E, 0xEF, 0xF7, 0xEF, 0x9D, 0xE1, 0x84, 0x80, 0x17, 0x01,
-    0x7E, 0x0C, 0x9C, 0xBC, 0x0E, 0xD4, 0x2F, 0x02, 0xB5, 0x1A, 0xD0, 0x3E, 0x03, 0xF4, 0x2B, 0xB0,
-    0x62, 0x5F, 0xD9, 0x91, 0x17, 0x38, 0x5B, 0xDF, 0x85, 0x6E, 0x92, 0xF4, 0xFC, 0xAF, 0x3E, 0x8C,
-    0x2B, 0x40, 0xBC, 0xC0, 0x11, 0x1C, 0xD5, 0x68, 0xF0, 0x89, 0x3E, 0x50, 0x85, 0x3E, 0x14, 0xE0,
-    0xF4, 0x4C, 0x93, 0xEB, 0x4F, 0x95, 0x9F, 0xC4, 0xA5, 0xB7, 0xB6, 0x39, 0x8E, 0x42, 0x79, 0xDA,
-    0xC9, 0xA0, 0xBA, 0xD5, 0xB9, 0x84, 0xDA, 0x36, 0x6A, 0x7D, 0x74, 0x3A, 0xD6, 0xA0, 0xB9, 0xD1,
-    0xA9, 0x3C, 0x9C, 0x97, 0x67, 0x8F, 0x9A, 0x21, 0xFA, 0xE2, 0x90, 0x32, 0x80, 0x70, 0x81, 0xED,
-    0x7A, 0x2A, 0x94, 0xF7, 0x2C, 0x7E, 0xCC, 0x0B, 0xF0, 0xC7, 0x40, 0x02, 0xB8, 0x01, 0x3C, 0x85,
-    0x25, 0xE0, 0xAC, 0x26, 0xB0, 0x2F, 0xC4, 0xC0, 0x0A, 0x5B, 0x0C, 0xF7, 0x6E, 0x08, 0xFF, 0xBE,
-    0x41, 0x71, 0x6D, 0xC2, 0x7C, 0x93, 0x9B, 0x5A, 0x85, 0xB2, 0x0F, 0x7C, 0xC2, 0x19, 0x93, 0x32,
-    0x9C, 0x1F, 0x42, 0x4C, 0xE2, 0x1A, 0x52, 0xB0, 0x20, 0x5A, 0x68, 0xB8, 0x82, 0x57, 0x00, 0xB3,
-    0x11, 0x32, 0x88, 0x19, 0x04, 0x0D, 0xA2, 0x06, 0x61, 0x83, 0xB8, 0x41, 0xE0, 0xC8, 0x90, 0xBF,
-    0x64, 0xA4, 0xC2, 0xB9, 0x42, 0xCD, 0xBE, 0x1B, 0x8F, 0x04, 0x7B, 0x59, 0x03, 0x2A, 0x4D, 0x2A,
-    0x6B, 0x39, 0xC4, 0x5F, 0xB1, 0x1D, 0xCC, 0x8A, 0xF0, 0xE9, 0x96, 0x93, 0x0C, 0x9C, 0xD6, 0x65,
-    0xA0, 0xA2, 0x21, 0xF8, 0xE8, 0x26, 0xDE, 0x83, 0x8D, 0x8A, 0xF2, 0x97, 0xE0, 0xD7, 0x51, 0xAD,
-    0xA2, 0x59, 0xF9, 0xFD, 0x0F, 0x37, 0x39, 0xA7, 0xA1, 0x78, 0x01, 0x3B, 0x42, 0xB1, 0x22, 0xB8,
-    0xB7, 0x15, 0x2A, 0xA2, 0xE5, 0xC6, 0x08, 0xB4, 0xCC, 0xE7, 0x8E, 0x53, 0x14, 0xE6, 0x16, 0xA9,
-    0x65, 0xE7, 0x6E, 0x98, 0xEA, 0x78, 0x9F, 0xE6, 0x00, 0x2C, 0x13, 0xF6, 0x8D, 0x87, 0x34, 0x7E,
-    0x31, 0xE2, 0x96, 0x01, 0x26, 0x80, 0x3E, 0xCA, 0x1B, 0x30, 0x9C, 0xFE, 0x9A, 0xD7, 0xED, 0x1D,
-    0xA6, 0xA7, 0xCC, 0x8A, 0x21, 0x3B, 0x3F, 0x1F, 0x18, 0xB3, 0xE0, 0xA9, 0x50, 0x6A, 0x83, 0x83,
-    0x23, 0x2F, 0x6F, 0x9C, 0xFF, 0x8E, 0x0A, 0x3C, 0x6E, 0xC1, 0x4A, 0x94, 0x73, 0xBB, 0x57, 0xC2,
-    0xE6, 0xBE, 0x21, 0x97, 0xF5, 0xA8, 0x86, 0xBE, 0xD0, 0x47, 0x5B, 0x9B, 0x07, 0xDE, 0x7B, 0x1B,
-    0x58, 0x9B, 0xE2, 0x12, 0x0C, 0x80, 0xC9, 0x56, 0xEE, 0x34, 0x68, 0x89, 0x25, 0x14, 0x67, 0x57,
-    0x3C, 0xF4, 0x9C, 0x24, 0x24, 0x83, 0x03, 0xE9, 0xFA, 0x8C, 0x48, 0xC2, 0xA8, 0xC1, 0x8A, 0xA6,
-    0x63, 0x14, 0x4F, 0x0D, 0x09, 0xD6, 0x93, 0x05, 0xE3, 0x02, 0xD9, 0xFC, 0xFF, 0x7E, 0x71, 0x74,
-    0x80, 0x2F, 0x69, 0x9D, 0x9C, 0x14, 0xC0, 0x2E, 0xA2, 0x21, 0x00, 0x2F, 0xBF, 0xF3, 0xC8, 0xFB,
-    0x56, 0x08, 0x78, 0xF3, 0xC4, 0xC8, 0x34, 0x7C, 0x8F, 0xDE, 0x17, 0x4D, 0x1C, 0x52, 0x05, 0xA8,
-    0x83, 0x2B, 0x79, 0x85, 0xC1, 0x7D, 0xB3, 0x64, 0x30, 0x0A, 0xAE, 0x11, 0x7B, 0x5E, 0x11, 0x65,
-    0x0F, 0xB1, 0x93, 0xF4, 0x0E, 0x82, 0x95, 0xDE, 0xD6, 0xD1, 0x67, 0x19, 0xCD, 0xA4, 0xDF, 0x4D,
-    0xFA, 0x6D, 0xED, 0x79, 0xBB, 0xE7, 0xCD, 0xF3, 0x2B, 0xDD, 0x24, 0xBE, 0xB5, 0x7E, 0xED, 0xA9,
-    0xFB, 0x3C, 0xBB, 0x7A, 0x7C, 0x2A, 0xC4, 0xDC, 0x2A, 0xCB, 0xEC, 0x6E, 0x12, 0xF9, 0x57, 0xB7,
-    0x97, 0x50, 0xAF, 0x61, 0xA1, 0x81, 0x6A, 0x37, 0x49, 0x6E, 0xAD, 0xAF, 0xB7, 0x35, 0x9A, 0x3A,
-    0x29, 0xA8, 0x82, 0xFF, 0xA0, 0x63, 0x25, 0x92, 0xDC, 0x50, 0x00, 0x16, 0xF4, 0xC9, 0x8B, 0x6F,
-    0x18, 0x3C, 0xB4, 0xC5, 0x30, 0x7B, 0xD0, 0x74, 0xD6, 0x86, 0x80, 0x34, 0x07, 0x34, 0x43, 0xD8,
-    0xA1, 0x68, 0xBD, 0xA2, 0x30, 0xA3, 0xE5, 0xEF, 0x07, 0x98, 0x85, 0xB2, 0xDF, 0x5F, 0x3B, 0xD3,
-    0x8D, 0xCE, 0xEA, 0x4C, 0x75, 0x40, 0x18, 0xAA, 0xE0, 0x6D, 0x2F, 0x96, 0x9A, 0xF1, 0x8C, 0xDB,
-    0x33, 0xEB, 0xB2, 0x0F, 0xCD, 0x70, 0x55, 0x19, 0x55, 0xDA, 0x17, 0xEC, 0x1D, 0xE5, 0x9D, 0x53,
-    0x13, 0xD6, 0x10, 0x30, 0x4C, 0xAD, 0xA1, 0x30, 0x47, 0xB7, 0x49, 0x3E, 0x80, 0xCD, 0xB2, 0xC6,
-    0x55, 0x8F, 0x6A, 0x0D, 0x82, 0x02, 0x51, 0xB1, 0x58, 0xAA, 0xD3, 0x5A, 0x16, 0x08, 0xA6, 0xCA,
-    0x27, 0x13, 0x10, 0x9A, 0x08, 0xD1, 0x15, 0x08, 0xD1, 0x09, 0x3C, 0x10, 0x1F, 0x32, 0x80, 0x74,
-    0x46, 0x3A, 0x37, 0x57, 0xEC, 0x5C, 0x00, 0xAB, 0x4A, 0xD3, 0xBE, 0x48, 0xB3, 0x6E, 0xBD, 0xA2,
-    0xBF, 0xA3, 0x09, 0x2B, 0x4F, 0x5A, 0x60, 0x72, 0xFD, 0x13, 0xED, 0xA7, 0xF3, 0xE0, 0x77, 0xF0,
-    0xB6, 0xD6, 0xB1, 0xE7, 0xF7, 0xD2, 0xD2, 0xE7, 0x8F, 0xA6, 0x73, 0xFB, 0x93, 0x8A, 0x73, 0x50,
-    0x8B, 0x6D, 0xBA, 0x4F, 0x2F, 0x0D, 0x0C, 0xD3, 0x2D, 0x8D, 0xC5, 0xB9, 0x77, 0x19, 0x7E, 0xE0,
-    0x2B, 0x9F, 0x4F, 0x56, 0xE0, 0x85, 0xD5, 0x24, 0x09, 0xAB, 0xEB, 0xEB, 0x01, 0xAD, 0x4A, 0x6A,
-    0x11, 0x61, 0xCE, 0x90, 0x67, 0xC1, 0xD9, 0xD9, 0xA0, 0x0A, 0x77, 0xD2, 0x98, 0x42, 0x0E, 0x33,
-    0x72, 0xB6, 0xD7, 0xEC, 0x9D, 0xF2, 0xD0, 0x1A, 0xFE, 0x0C, 0xBA, 0xD0, 0x10, 0xEB, 0x9D, 0x9B,
-    0xD5, 0x15, 0x9D, 0xD6, 0x32, 0x86, 0xD7, 0xB2, 0x4E, 0xE4, 0xE1, 0x89, 0x6E, 0x58, 0xA0, 0x41,
-    0x7C, 0x0B, 0xFB, 0x21, 0xF5, 0xAD, 0x0E, 0x0F, 0x05, 0x16, 0x76, 0xFF, 0x0D, 0xB7, 0x1B, 0x15,
-    0x6D, 0x25, 0x8E, 0x92, 0x08, 0x54, 0x37, 0xAB, 0x31, 0xF6, 0x63, 0xA1, 0xC0, 0x80, 0x45, 0x29,
-    0xBC, 0x2B, 0xE1, 0x09, 0x49, 0xD4, 0x39, 0xC5, 0x0F, 0x1E, 0x2C, 0x22, 0x93, 0x80, 0x65, 0xC4,
-    0x64, 0x56, 0x46, 0x1C, 0x2C, 0xA2, 0x4C, 0xAB, 0xE3, 0x11, 0x36, 0xAD, 0xD8, 0x0B, 0x24, 0x35,
-    0x73, 0xB2, 0x88, 0x46, 0xF2, 0xCC, 0xBF, 0xD5, 0x28, 0xE9, 0xBF, 0x86, 0x66, 0xE0, 0x84, 0x4E,
-    0x58, 0xC5, 0xBC, 0x36, 0xF0, 0xFA, 0x33, 0xFF, 0x9E, 0x47, 0x9A, 0x38, 0x9E, 0x5C, 0x5B, 0x28,
-    0xD4, 0xEB, 0x05, 0x1C, 0xAD, 0x3F, 0x7E, 0x98, 0x7B, 0xFA, 0xA8, 0x26, 0x34, 0xEE, 0x84, 0x15,
-    0xBF, 0x1B, 0xB1, 0x9C, 0xF7, 0x03, 0xDA, 0x48, 0x55, 0x4C, 0x97, 0xD4, 0xFC, 0x80, 0xF1, 0xDB,
-    0x0B, 0xC9, 0xD3, 0xDD, 0xA3, 0xF3, 0x42, 0x3D, 0x44, 0x0F, 0xAE, 0xC8, 0x6E, 0xC7, 0x13, 0x01,
-    0x76, 0xB2, 0x41, 0x27, 0x59, 0x4D, 0x82, 0xCC, 0x7E, 0xA4, 0x36, 0xB3, 0xE2, 0xAC, 0xD3, 0x1F,
-    0xB5, 0x41, 0xF6, 0x69, 0x90, 0x37, 0xF5, 0x64, 0x35, 0xE2, 0x6C, 0xD0, 0x7D, 0xDA, 0xA6, 0x85,
-    0xF2, 0xBF, 0x41, 0xC9, 0x75, 0xC6, 0xE2, 0x2A, 0x96, 0xE1, 0x6F, 0x0D, 0x88, 0x30, 0xCD, 0x64,
-    0x82, 0x7A, 0x21, 0x6D, 0x72, 0x6D, 0x8B, 0xE9, 0xD8, 0x37, 0xE5, 0xAB, 0x52, 0x56, 0x0B, 0x41,
-    0x2F, 0x6B, 0x2F, 0x43, 0x30, 0x62, 0x86, 0xC7, 0xA4, 0x46, 0x60, 0x7E, 0xB5, 0x38, 0x21, 0x83,
-    0xBE, 0x8C, 0xC4, 0x54, 0x8A, 0x6E, 0x18, 0xA6, 0x26, 0xC6, 0xC9, 0x26, 0xC2, 0x8E, 0x79, 0xCB,
-    0x1D, 0x50, 0xEE, 0x49, 0x09, 0x79, 0xA7, 0x6C, 0x35, 0x1E, 0x66, 0xB0, 0x94, 0x0E, 0x88, 0xA7,
-    0xA9, 0xD9, 0xE6, 0x97, 0xB0, 0x7E, 0xED, 0x71, 0xBF, 0xBC, 0xF6, 0x58, 0x50, 0x39, 0x18, 0xB3,
-    0x62, 0x56, 0x91, 0xC0, 0xFA, 0x45, 0x6C, 0xE2, 0xE5, 0x81, 0xC4, 0x49, 0x09, 0x96, 0xB3, 0x63,
-    0x62, 0xB6, 0x62, 0x0A, 0x7C, 0x9C, 0x39, 0x4D, 0x34, 0xCD, 0x20, 0x37, 0x66, 0x5C, 0x2A, 0x7D,
-    0xB1, 0x08, 0xF3, 0x96, 0xC1, 0x8E, 0x7B, 0x2F, 0x66, 0xE1, 0xE6, 0x44, 0xAD, 0x9C, 0xCC, 0x55,
-    0x38, 0xCD, 0xBC, 0xDB, 0xFC, 0x3C, 0x47, 0x8A, 0x72, 0x54, 0x7E, 0xE4, 0x54, 0x6F, 0xB2, 0x60,
-    0xC2, 0xAB, 0x62, 0xA4, 0x96, 0x38, 0xA1, 0x2B, 0xCB, 0x58, 0x1A, 0x2F, 0x4F, 0x4E, 0xBD, 0x7D,
-    0x16, 0x0E, 0xEF, 0xDA, 0x92, 0x94, 0xA6, 0x25, 0x0F, 0x04, 0x39, 0x73, 0x75, 0x24, 0x9A, 0x78,
-    0x42, 0xAE, 0x22, 0x36, 0xBA, 0xE8, 0x04, 0x78, 0x61, 0x91, 0x53, 0xEF, 0x47, 0xD8, 0xBA, 0xAC,
-    0x2F, 0xE9, 0x3B, 0xAE, 0xBA, 0x38, 0x3C, 0xC9, 0xA7, 0x23, 0x6A, 0x4A, 0x0E, 0x69, 0x59, 0xA0,
-    0x83, 0xA9, 0x15, 0x9A, 0xBB, 0x0D, 0x21, 0xDD, 0x11, 0xD2, 0x7D, 0x92, 0x66, 0x5E, 0x0C, 0xB0,
-    0x1C, 0x3C, 0x49, 0x3A, 0x68, 0xEC, 0xCD, 0xFC, 0xB9, 0x57, 0x14, 0x4E, 0x2C, 0xA3, 0xCD, 0xAB,
-    0xA4, 0x79, 0x1D, 0x04, 0x1B, 0x24, 0xD8, 0x26, 0xC1, 0xB8, 0x72, 0xB5, 0xDB, 0x5B, 0xA2, 0x80,
-    0xBD, 0x09, 0x7A, 0xFF, 0xB1, 0x8A, 0x52, 0x87, 0x11, 0x08, 0xCC, 0xB6, 0xDE, 0xBC, 0x03, 0x1C,
-    0x13, 0x21, 0x4B, 0x34, 0xD8, 0x49, 0x35, 0xEC, 0xE5, 0x40, 0xC8, 0x96, 0x9D, 0xA7, 0x33, 0xD8,
-    0x4D, 0x77, 0xF3, 0xD9, 0x24, 0x66, 0x99, 0xD4, 0xE8, 0x59, 0xBD, 0x66, 0x1C, 0x4D, 0xE7, 0x3B,
-    0x89, 0xE4, 0xE2, 0x18, 0x33, 0x39, 0x30, 0x2B, 0x8A, 0x95, 0x2F, 0xDF, 0xA1, 0xC4, 0x1B, 0xDC,
-    0xFC, 0xA2, 0xB5, 0x30, 0xA6, 0x55, 0x62, 0xD9, 0xEB, 0x0C, 0x66, 0xE0, 0xAD, 0x6E, 0x63, 0xCA,
-    0x8E, 0x72, 0x31, 0xB9, 0xD1, 0x5B, 0x96, 0x58, 0xB4, 0x1D, 0x67, 0x5D, 0x1A, 0x1F, 0x86, 0xC7,
-    0xFE, 0x54, 0x3C, 0xE0, 0xB6, 0x2A, 0xDE, 0xDE, 0x47, 0x6B, 0x33, 0x5C, 0x71, 0x03, 0x11, 0xD7,
-    0xE0, 0xF4, 0xAA, 0xCA, 0x0F, 0xFD, 0x07, 0xAC, 0xF1, 0xB3, 0x9A, 0x3D, 0xDD, 0x0B, 0xEA, 0x66,
-    0x09, 0xD8, 0xA2, 0xC6, 0xF6, 0x7F, 0xAD, 0x4E, 0x35, 0x10, 0xA7, 0xAA, 0x6C, 0x25, 0xAC, 0xC6,
-    0xBF, 0x50, 0xBB, 0x38, 0x97, 0xD2, 0x26, 0xD7, 0xD3, 0xBC, 0xFD, 0x7A, 0xA4, 0xDF, 0x9D, 0x6B,
-    0x1F, 0xF7, 0x03, 0xF3, 0x56, 0x0C, 0x39, 0x73, 0xD8, 0xAB, 0xDE, 0x3B, 0x62, 0x30, 0x0C, 0xC5,
-    0xE7, 0x51, 0xAC, 0x70, 0xA2, 0xEC, 0x25, 0x75, 0x29, 0xBD, 0xDD, 0x17, 0x06, 0x02, 0xED, 0x7E,
-    0xC4, 0xEE, 0xEF, 0x90, 0xDD, 0x8E, 0x6C, 0x22, 0xE3, 0xE7, 0xE9, 0x84, 0x0D, 0x84, 0x0E, 0xB1,
-    0x51, 0x74, 0x55, 0x31, 0xB8, 0x92, 0x91, 0x7A, 0x7C, 0x97, 0xB7, 0x1B, 0x78, 0x4D, 0x8C, 0xF4,
-    0x4D, 0x58, 0x29, 0x0A, 0x32, 0x3F, 0x20, 0x2D, 0x5F, 0x78, 0xAD, 0x4A, 0x37, 0x90, 0xAE, 0xA5,
-    0x69, 0x3E, 0xBB, 0x13, 0x82, 0x62, 0x59, 0x0A, 0x42, 0x11, 0x4F, 0x72, 0x94, 0x9D, 0x5B, 0xBA,
-    0xDF, 0x34, 0x13, 0x65, 0x19, 0x75, 0x2C, 0x2C, 0xB5, 0x86, 0x4D, 0x66, 0x3B, 0xA9, 0x5F, 0x16,
-    0xA8, 0x11, 0xB0, 0x14, 0x5B, 0xC4, 0x71, 0xED, 0x50, 0xBB, 0x09, 0x5C, 0x2F, 0xA8, 0x37, 0xAE,
-    0x05, 0x3D, 0x86, 0xD4, 0x4C, 0xB5, 0x9D, 0xEA, 0xB7, 0xAD, 0x26, 0x07, 0x4E, 0xC9, 0xAA, 0x16,
-    0x72, 0xE6, 0x5B, 0xA6, 0x33, 0xDB, 0x3B, 0xB4, 0x56, 0xE7, 0x6B, 0xAE, 0xAD, 0x6B, 0x74, 0x3C,
-    0x06, 0x96, 0x8C, 0xDB, 0x70, 0x1E, 0xCE, 0x40, 0x47, 0x6E, 0x4C, 0xD8, 0xD1, 0x68, 0x2C, 0x76,
-    0xE4, 0x3C, 0xAC, 0xDD, 0x12, 0x45, 0x77, 0x56, 0x9A, 0x0D, 0xF3, 0x27, 0xA3, 0x0B, 0xBC, 0xA5,
-    0xDD, 0xAE, 0xF0, 0xB8, 0x47, 0xD6, 0xB3, 0x9F, 0xEF, 0x82, 0xF4, 0x17, 0x10, 0x2B, 0x6E, 0x30,
-    0x00, 0x2E, 0x30, 0x61, 0xF8, 0x94, 0xEA, 0x31, 0x21, 0x39, 0xBD, 0x1A, 0xB3, 0x0D, 0xB7, 0x4E,
-    0x7D, 0x5A, 0xF4, 0xE5, 0xC8, 0x58, 0x58, 0x25, 0x30, 0xCF, 0x3D, 0xAB, 0x65, 0x19, 0xAA, 0x9D,
-    0xCE, 0xE1, 0x65, 0x9B, 0xB0, 0xA2, 0x6A, 0xEB, 0x80, 0x28, 0x29, 0x71, 0x41, 0xF7, 0x59, 0x9A,
-    0x72, 0xC2, 0x18, 0xCE, 0x9D, 0x18, 0xD6, 0x6F, 0xB4, 0xDB, 0x3F, 0x39, 0xC7, 0xF7, 0x81, 0x29,
-    0x7C, 0x97, 0x53, 0x19, 0xB5, 0xF4, 0x27, 0x1A, 0xCA, 0xED, 0x72, 0x48, 0x57, 0xE5, 0x8B, 0x57,
-    0xEF, 0x51, 0xB3, 0xCF, 0xC5, 0x61, 0xB1, 0xCA, 0x0B, 0xA6, 0x8E, 0x4E, 0x29, 0xDD, 0x5E, 0x59,
-    0x63, 0xDD, 0x33, 0x59, 0x4D, 0x22, 0x5F, 0xBD, 0x67, 0x45, 0x9A, 0x93, 0x16, 0x69, 0xD5, 0xB4,
-    0x54, 0x1C, 0x81, 0xEE, 0x51, 0x2E, 0xD0, 0xFF, 0xA7, 0xB4, 0xFB, 0x1F, 0xB2, 0xEE, 0xE5, 0xCB,
-    0x83, 0x4E, 0xEE, 0x6E, 0xCF, 0xD3, 0xFE, 0xFB, 0x38, 0x72, 0xA8, 0x37, 0x12, 0xFC, 0xFF, 0x00,
-    0x9D, 0x57, 0xBD, 0x6F, 0x1B, 0x47, 0x16, 0xFF, 0xED, 0xAE, 0xAC, 0x75, 0xBC, 0x90, 0x56, 0x40,
-    0x6C, 0xC0, 0x40, 0x68, 0x6D, 0x0A, 0x15, 0x8A, 0x43, 0x5A, 0x2E, 0x14, 0x80, 0xC5, 0x92, 0x3B,
-    0x81, 0x8B, 0x14, 0xD7, 0xA8, 0xB0, 0xAE, 0xB9, 0x46, 0x65, 0xD2, 0xC4, 0x2E, 0x54, 0x30, 0x81,
-    0x1C, 0x2E, 0xCE, 0xFF, 0x80, 0xFF, 0x04, 0x02, 0x71, 0x61, 0x08, 0x29, 0x58, 0xC8, 0x80, 0x10,
-    0x30, 0xE6, 0xC4, 0x2E, 0x52, 0xA4, 0xD9, 0x20, 0xC5, 0x15, 0x57, 0xDC, 0xFA, 0x3E, 0x9A, 0x0B,
-    0x70, 0x9E, 0x00, 0x7B, 0x07, 0x3A, 0x91, 0xB4, 0xF9, 0xBD, 0x59, 0xD2, 0xA6, 0x69, 0x5B, 0xE6,
-    0x65, 0xBE, 0xF7, 0xBD, 0x37, 0xEF, 0xBD, 0x99, 0x79, 0xEF, 0xCD, 0x2C, 0xE0, 0x29, 0x64, 0x43,
-    0xD3, 0xCB, 0xBE, 0x44, 0xEF, 0xD4, 0x2C, 0xC9, 0x47, 0x0D, 0xC9, 0xA8, 0xB6, 0xEE, 0xAF, 0xE3,
-    0xF4, 0x8C, 0xFD, 0x5E, 0x69, 0xB6, 0xB7, 0xAA, 0xB6, 0x2C, 0x4B, 0x25, 0x75, 0x7F, 0xFF, 0x6E,
-    0x59, 0x8E, 0xB6, 0x09, 0x96, 0x74, 0xAF, 0x94, 0x74, 0xB4, 0x2D, 0xE9, 0xFA, 0xCB, 0x10, 0xB3,
-    0xFA, 0xFF, 0x66, 0xE0, 0xC2, 0xF6, 0xF5, 0xA4, 0x3C, 0x66, 0x4B, 0x55, 0x39, 0xB8, 0xBC, 0x7F,
-    0x2F, 0x40, 0x88, 0x2B, 0x68, 0x61, 0x0F, 0x03, 0xAC, 0x20, 0xC2, 0x06, 0xC7, 0x31, 0x3A, 0x38,
-    0xE0, 0x57, 0xA8, 0x42, 0x42, 0xAE, 0xF0, 0xBB, 0xC9, 0xAF, 0x01, 0x69, 0x5A, 0x68, 0x60, 0x95,
-    0x33, 0x1C, 0x04, 0x9E, 0x5A, 0x0E, 0xD4, 0x95, 0x10, 0xAD, 0x08, 0x7B, 0x57, 0x30, 0x68, 0x63,
-    0xE5, 0x3C, 0xA2, 0x90, 0x10, 0x45, 0x48, 0xBC, 0x8A, 0x4E, 0x03, 0xFD, 0x18, 0x2B, 0xE4, 0xF2,
-    0x91, 0x0E, 0x03, 0x1D, 0x85, 0x29, 0x89, 0xE3, 0x65, 0x34, 0x2F, 0x61, 0x65, 0x01, 0x87, 0x94,
-    0xD8, 0x46, 0x1C, 0xA1, 0x11, 0x62, 0x35, 0x50, 0xA1, 0xAF, 0x1C, 0x07, 0x28, 0x6C, 0xE9, 0xDB,
-    0x72, 0x13, 0xDD, 0xD2, 0x7C, 0xFE, 0xB5, 0xE1, 0x60, 0x5C, 0xFA, 0x93, 0x72, 0x60, 0x4B, 0x31,
-    0x29, 0x23, 0x5B, 0x2A, 0xE0, 0x4D, 0x7C, 0x72, 0xBF, 0x37, 0x2C, 0x8B, 0x95, 0x9B, 0x5B, 0x63,
-    0x48, 0x85, 0xEA, 0x83, 0x10, 0xC2, 0x89, 0x15, 0x56, 0xCF, 0x50, 0x88, 0xF2, 0xA4, 0xB0, 0xD9,
-    0x04, 0xD9, 0x0E, 0x6E, 0xA1, 0x9B, 0x75, 0x47, 0xDD, 0xBC, 0x8B, 0x5D, 0x39, 0xCD, 0x56, 0xB7,
-    0xBD, 0xC0, 0xAE, 0x8D, 0x22, 0x71, 0x46, 0x6D, 0xA7, 0x58, 0xE0, 0x36, 0x48, 0x6A, 0x3B, 0x26,
-    0x48, 0x13, 0xB7, 0x08, 0x35, 0x81, 0xA1, 0x5E, 0x80, 0xA2, 0xF2, 0xED, 0x44, 0x88, 0x87, 0x45,
-    0x0F, 0xBD, 0x39, 0x0C, 0xA5, 0x3B, 0xC2, 0xFA, 0x1B, 0x33, 0x53, 0x69, 0x26, 0xF9, 0x1C, 0x4E,
-    0xCB, 0x96, 0x36, 0xD7, 0x90, 0x3C, 0x0F, 0xED, 0xD0, 0xE0, 0xAA, 0xE4, 0x79, 0x68, 0x6D, 0x0A,
-    0x73, 0xD4, 0x65, 0xE9, 0x87, 0x34, 0x0E, 0x60, 0xB7, 0x0E, 0xC3, 0xAE, 0x7F, 0xC9, 0xC9, 0xA4,
-    0x5B, 0xF6, 0x34, 0x3B, 0x43, 0x8B, 0xB0, 0x5F, 0x21, 0x2C, 0xAE, 0xBE, 0x91, 0x46, 0x59, 0xA7,
-    0xDE, 0xF9, 0x35, 0xFF, 0xC2, 0xB4, 0x07, 0x3F, 0xE7, 0xC6, 0x34, 0xC3, 0xC7, 0x7F, 0xD7, 0xBB,
-    0x26, 0x86, 0xF7, 0x48, 0xEF, 0xE6, 0x75, 0xF8, 0xD7, 0x74, 0x87, 0x5D, 0xE8, 0xD9, 0xAE, 0xE1,
-    0x5A, 0x5C, 0xEC, 0x64, 0x7D, 0x76, 0x7D, 0xFC, 0xCF, 0x7C, 0x56, 0x38, 0x39, 0xBA, 0x7A, 0x23,
-    0xC7, 0x6C, 0x1A, 0xAB, 0x23, 0x1A, 0x0D, 0x68, 0x9E, 0x36, 0xD1, 0xE4, 0x4C, 0x35, 0xEA, 0xAF,
-    0x3A, 0xE3, 0x29, 0xA6, 0x52, 0xCD, 0x8E, 0x7C, 0x35, 0x1E, 0xAD, 0x86, 0x98, 0xD0, 0x35, 0x36,
-    0xD2, 0x20, 0xF7, 0x0B, 0xCE, 0x8D, 0x87, 0x26, 0x19, 0x85, 0xC7, 0xE4, 0xD7, 0x37, 0x07, 0x9D,
-    0x98, 0x86, 0x19, 0xE6, 0x8F, 0xB3, 0xB8, 0xBF, 0x1A, 0x07, 0x80, 0xFB, 0x30, 0x8B, 0x0D, 0x47,
-    0x0A, 0xFE, 0x9F, 0x39, 0x5A, 0x8E, 0xC9, 0x2B, 0x74, 0x27, 0x30, 0xEE, 0x82, 0xA5, 0x53, 0x74,
-    0x95, 0xBC, 0xB3, 0xDB, 0x88, 0x43, 0xB1, 0xAF, 0xA7, 0xA6, 0x35, 0x88, 0x3E, 0xA5, 0x38, 0x24,
-    0x59, 0x64, 0x82, 0xA3, 0x69, 0xF5, 0x8D, 0x93, 0x7B, 0xDA, 0x57, 0xCB, 0x0C, 0x17, 0x6B, 0xFC,
-    0x3A, 0x74, 0x72, 0xE3, 0x3D, 0xCC, 0xB8, 0x1D, 0xCB, 0x01, 0x6A, 0xCB, 0x58, 0xBB, 0x48, 0xE0,
-    0x41, 0x4C, 0xE8, 0x01, 0xC1, 0xC6, 0xBF, 0xF6, 0x90, 0x08, 0x2F, 0xAD, 0x11, 0xBB, 0x76, 0xF1,
-    0x2C, 0x4F, 0xA0, 0x45, 0x27, 0x0C, 0x94, 0xA7, 0xB9, 0xFD, 0x5B, 0x1D, 0x7E, 0x36, 0x10, 0x12,
-    0xF0, 0x91, 0xE2, 0xBE, 0x3A, 0x19, 0x61, 0x04, 0xC6, 0x84, 0x0A, 0x58, 0xE0, 0x82, 0xB0, 0x18,
-    0x41, 0x6D, 0x59, 0x05, 0xE0, 0x14, 0xF0, 0xBE, 0x82, 0xBF, 0x84, 0xE5, 0x73, 0xB8, 0xE4, 0x21,
-    0xF6, 0xD2, 0x5D, 0x47, 0x23, 0xF5, 0xB2, 0x20, 0xDD, 0xA0, 0xAB, 0x17, 0x5C, 0x4B, 0x84, 0x40,
-    0xBB, 0x39, 0xD4, 0x59, 0x06, 0x81, 0x50, 0x79, 0x99, 0x63, 0x70, 0xE8, 0x18, 0x5F, 0xD3, 0xC7,
-    0xB1, 0x50, 0x2D, 0x64, 0x45, 0x22, 0x45, 0x4C, 0x57, 0x32, 0x11, 0x0E, 0xB8, 0x24, 0x4D, 0x42,
-    0x92, 0xB5, 0x60, 0x59, 0x20, 0xF2, 0x32, 0xAC, 0xF8, 0x7F, 0x53, 0x2B, 0x03, 0xE7, 0x18, 0xA3,
-    0x01, 0x8E, 0x30, 0x5A, 0xF3, 0x9E, 0x60, 0x47, 0xA2, 0x02, 0xFD, 0x8B, 0x94, 0xA4, 0xDA, 0x03,
-    0xA9, 0x22, 0x4E, 0xDC, 0xF1, 0x75, 0x0B, 0x23, 0xC7, 0xAC, 0x91, 0xDF, 0x8E, 0xF0, 0x46, 0xDB,
-    0xCB, 0x9E, 0x95, 0x96, 0xA7, 0x1B, 0x53, 0xA5, 0xEE, 0xE9, 0x9A, 0x3B, 0x2E, 0x63, 0x4B, 0xF0,
-    0xB2, 0xC4, 0xCF, 0xDB, 0x7E, 0x46, 0x87, 0xE4, 0xE7, 0x3B, 0xA5, 0xEA, 0xFE, 0x94, 0xBD, 0x9D,
-    0x19, 0x37, 0x3B, 0xB0, 0xC5, 0xB8, 0x3F, 0x18, 0xF7, 0x3B, 0xED, 0x3E, 0x81, 0x73, 0x04, 0x8A,
-    0xA6, 0x8D, 0x58, 0xF3, 0x95, 0xC4, 0x81, 0x67, 0xE0, 0x52, 0x1F, 0x85, 0xCB, 0xFB, 0xFB, 0x77,
-    0x92, 0xB2, 0xB4, 0x16, 0x74, 0x15, 0xD8, 0xA4, 0x23, 0xF6, 0x43, 0xB8, 0xDA, 0xFB, 0xD7, 0x0D,
-    0xE0, 0x06, 0x57, 0xF5, 0xFE, 0x5D, 0xB8, 0xBF, 0x0C, 0xED, 0x01, 0xD0, 0x08, 0xFB, 0x42, 0x33,
-    0x39, 0x58, 0x2F, 0x05, 0x4D, 0x83, 0x16, 0xB3, 0x04, 0x31, 0xD0, 0xA6, 0x8D, 0x5C, 0x56, 0x8E,
-    0x97, 0xC3, 0xEB, 0x23, 0xD8, 0xC4, 0x52, 0x1D, 0xF5, 0x25, 0x34, 0xCF, 0xE1, 0xA6, 0x2F, 0x33,
-    0xE2, 0x6A, 0xE2, 0x0B, 0xDD, 0x56, 0x6C, 0xB7, 0xF7, 0xC1, 0xAD, 0x07, 0xD6, 0x57, 0xCB, 0x13,
-    0x0B, 0x7D, 0x50, 0x69, 0xFA, 0xC4, 0x9A, 0xB1, 0xF7, 0x9D, 0x5D, 0x75, 0xF8, 0xC8, 0x9A, 0xBC,
-    0xFF, 0xA1, 0x2C, 0xE4, 0x3D, 0xD6, 0x8F, 0x21, 0x9B, 0x2F, 0x4E, 0x1A, 0x57, 0x9D, 0xB8, 0x49,
-    0x13, 0xB7, 0xEA, 0x37, 0xF0, 0x74, 0xF3, 0x9B, 0x61, 0x59, 0xA2, 0x2C, 0x8F, 0x9D, 0xA1, 0xC2,
-    0x99, 0x63, 0x85, 0x5F, 0x15, 0x9C, 0xFF, 0xC0, 0xFD, 0x87, 0x86, 0xF7, 0x7D, 0xEA, 0x3F, 0x34,
-    0x08, 0x6F, 0xF3, 0xF8, 0xD9, 0xF1, 0x40, 0xB8, 0x11, 0xCE, 0xE4, 0x9A, 0xB2, 0xEB, 0x92, 0x55,
-    0x31, 0xFA, 0x57, 0x8C, 0x19, 0x3E, 0xB9, 0x2C, 0xC8, 0xD6, 0xFB, 0x44, 0x89, 0x43, 0x35, 0xAC,
-    0x20, 0x31, 0x2D, 0xBB, 0xAD, 0xE2, 0x77, 0xD3, 0x33, 0x24, 0xA2, 0x4A, 0xA4, 0xA5, 0x83, 0xBF,
-    0x90, 0x5F, 0x07, 0xEB, 0x9A, 0x6E, 0x81, 0x99, 0xDC, 0x2D, 0x5E, 0x09, 0x1B, 0x7B, 0xFD, 0x3B,
-    0x27, 0x18, 0x8E, 0xB8, 0x5B, 0x3F, 0x72, 0x91, 0x6B, 0xEE, 0xCF, 0x2A, 0x52, 0xA2, 0x4C, 0x90,
-    0x4A, 0xEB, 0xA7, 0xE3, 0x31, 0xED, 0x99, 0xCA, 0x06, 0x9A, 0xB1, 0x1E, 0x89, 0x38, 0x01, 0x6D,
-    0x8D, 0xAB, 0xA5, 0x39, 0xD0, 0x7D, 0xA9, 0x77, 0x88, 0x71, 0x3B, 0x9D, 0xAA, 0x49, 0x34, 0x90,
-    0x8D, 0x54, 0x5A, 0x61, 0xAC, 0x26, 0x38, 0x4A, 0x1D, 0x0C, 0xCB, 0x6C, 0xB0, 0xE6, 0x9A, 0x01,
-    0x65, 0x48, 0x3D, 0x64, 0xED, 0x70, 0x52, 0x87, 0x72, 0x3A, 0x94, 0xD2, 0xA1, 0x8C, 0x5D, 0x4A,
-    0xD8, 0x24, 0x67, 0x5B, 0xA7, 0xF8, 0x1E, 0x92, 0xDF, 0x91, 0x54, 0x72, 0xB4, 0xB7, 0x4B, 0x7B,
-    0xB1, 0xCC, 0xDA, 0x51, 0x59, 0xB4, 0xDF, 0x92, 0x5B, 0x15, 0x2D, 0x9E, 0x26, 0xFD, 0x58, 0x5C,
-    0x1C, 0x83, 0x06, 0x2D, 0xB4, 0x41, 0xA6, 0x75, 0xDE, 0xD3, 0x35, 0xEE, 0x53, 0x8D, 0xAC, 0x6B,
-    0xD5, 0x5D, 0x55, 0x79, 0x00, 0x7D, 0x29, 0x21, 0xAB, 0x36, 0x6F, 0x6B, 0xB9, 0xAC, 0x2E, 0x6C,
-    0x6F, 0x2B, 0x5A, 0xB2, 0xBE, 0xB0, 0xFD, 0xA7, 0xF1, 0x21, 0x8D, 0x6D, 0x43, 0x0E, 0x89, 0xC2,
-    0x41, 0x7F, 0xA5, 0xDF, 0x81, 0xFE, 0x5D, 0x1D, 0x12, 0xAF, 0x44, 0xF1, 0xC9, 0x21, 0x8D, 0xFF,
-    0x7E, 0x79, 0x8C, 0xFE, 0xB0, 0x94, 0xAA, 0x58, 0xD3, 0x99, 0xAA, 0x2A, 0xDC, 0x09, 0xEB, 0x08,
-    0xFD, 0xFB, 0x0A, 0x7D, 0xB9, 0x9C, 0xDF, 0x50, 0x6D, 0xA2, 0x4E, 0x01, 0x75, 0xDA, 0x28, 0xFF,
-    0xA2, 0x93, 0xF2, 0x91, 0xEE, 0xB2, 0x0E, 0x67, 0xAA, 0xC0, 0x04, 0x17, 0x95, 0x3F, 0xE9, 0x45,
-    0xD2, 0x8E, 0xA7, 0xD1, 0x74, 0x47, 0xF8, 0x2F, 0xBD, 0x21, 0xE7, 0x09, 0xB3, 0x2A, 0xD6, 0x74,
-    0xA6, 0x0A, 0x0C, 0xBF, 0x50, 0xF7, 0xB1, 0x03, 0x4B, 0x20, 0x92, 0xA5, 0xC5, 0x50, 0xCD, 0x85,
-    0x93, 0xCF, 0x4E, 0xC4, 0x99, 0x8E, 0xE9, 0x44, 0xE2, 0x40, 0xE1, 0xED, 0x3C, 0xB0, 0x11, 0xE0,
-    0x63, 0xEE, 0xD9, 0x91, 0x44, 0xE2, 0x17, 0xD2, 0x9E, 0x7D, 0xF1, 0x30, 0xF4, 0x55, 0xE6, 0x70,
-    0x8A, 0xD7, 0xFF, 0xDE, 0xF4, 0xCA, 0xE8, 0x32, 0x87, 0xBE, 0x73, 0x2E, 0x8B, 0x69, 0xE0, 0xE9,
-    0x23, 0x3F, 0xED, 0x04, 0xF6, 0xF4, 0x1B, 0x76, 0x4A, 0xC7, 0x3E, 0xA2, 0x8C, 0x8D, 0x49, 0x5A,
-    0x1C, 0x83, 0x86, 0x4F, 0xE4, 0x25, 0x22, 0xFD, 0xB4, 0x19, 0xE8, 0x83, 0xC0, 0xEE, 0xF7, 0x79,
-    0x1B, 0x57, 0xCA, 0xA7, 0xA2, 0xDE, 0x1F, 0xCB, 0x7F, 0xBA, 0x59, 0x1D, 0x3C, 0x8A, 0xF4, 0x5D,
-    0x60, 0xF1, 0x1E, 0x70, 0x66, 0x0B, 0x0E, 0x37, 0xD9, 0x4F, 0xFD, 0x94, 0x13, 0x73, 0xEE, 0xC4,
-    0xE6, 0xBB, 0x12, 0xB1, 0x17, 0x61, 0xBD, 0x3E, 0x08, 0x02, 0xF8, 0xDF, 0x37, 0x48, 0xC3, 0x40,
-    0xD1, 0xE5, 0x1D, 0x5E, 0x96, 0xD9, 0xE5, 0xE1, 0xBF, 0x53, 0x79, 0x77, 0xB8, 0x7F, 0xDD, 0x43,
-    0xF0, 0x87, 0x08, 0x4E, 0x70, 0xA6, 0x8A, 0x10, 0x93, 0x54, 0xC0, 0xA1, 0xFD, 0xF5, 0xA6, 0x37,
-    0x88, 0x1E, 0x31, 0xB0, 0x65, 0xF6, 0x6C, 0xE4, 0x7E, 0x18, 0xD9, 0xE7, 0xDF, 0x16, 0xE4, 0xBA,
-    0xE6, 0x55, 0x29, 0x77, 0xE5, 0xB7, 0x59, 0xEE, 0x5F, 0xBB, 0x2D, 0xB7, 0xA5, 0xEF, 0xA9, 0xDA,
-    0x52, 0x75, 0x5F, 0x9E, 0x7D, 0x2E, 0x00, 0x56, 0xC4, 0x8C, 0x90, 0x17, 0xC4, 0x41, 0x51, 0x9A,
-    0x75, 0x65, 0xD7, 0x88, 0xD0, 0x3B, 0xAF, 0xA6, 0xDC, 0x41, 0xE5, 0x2D, 0x15, 0x53, 0x6C, 0x3D,
-    0x3F, 0x14, 0x47, 0xE6, 0x3A, 0xC5, 0xFA, 0xEB, 0xA5, 0x3C, 0x9F, 0x3B, 0x9A, 0x9E, 0x3B, 0x93,
-    0xAC, 0xF0, 0xE7, 0xBA, 0x58, 0xD5, 0xB0, 0x37, 0xD8, 0x9B, 0xA6, 0x69, 0xCA, 0xA7, 0x3C, 0xD2,
-    0x24, 0x22, 0x89, 0x1F, 0x3B, 0x2F, 0xF3, 0x59, 0x87, 0x43, 0x36, 0x1E, 0xB9, 0x58, 0x26, 0xEA,
-    0x25, 0x82, 0xE9, 0xF9, 0x78, 0x76, 0xF2, 0xF1, 0xB8, 0xF1, 0xF2, 0x38, 0xD0, 0x9E, 0x89, 0x43,
-    0xCD, 0xE7, 0x8E, 0xBC, 0xA0, 0xE2, 0x69, 0x6C, 0x22, 0xFF, 0x23, 0xB6, 0x99, 0x41, 0x38, 0x69,
-    0xBC, 0x28, 0x73, 0xC3, 0xD4, 0x36, 0x50, 0xB1, 0x33, 0xC1, 0x72, 0x61, 0x0B, 0x49, 0xD2, 0xB0,
-    0xF1, 0x2A, 0x69, 0x8F, 0xBB, 0x85, 0x57, 0x36, 0x18, 0xE6, 0xD5, 0x33, 0x74, 0xAE, 0xE7, 0xAF,
-    0xD1, 0x57, 0x25, 0xCF, 0xF5, 0xFC, 0xCD, 0x13, 0x1D, 0xF1, 0xF7, 0xE6, 0x1C, 0xDE, 0x4C, 0x7B,
-    0x86, 0xDE, 0xB1, 0x91, 0x26, 0x7A, 0xA2, 0xCB, 0x69, 0xB4, 0x21, 0x3E, 0xD0, 0xBD, 0xDE, 0xE5,
-    0x74, 0x1E, 0xBE, 0x0F, 0x30, 0xEF, 0xDA, 0x7E, 0x03, 0xED, 0x93, 0xB1, 0x6E, 0xD3, 0x50, 0x14,
-    0x86, 0x3F, 0x3B, 0xC5, 0x16, 0xB1, 0xB0, 0x3B, 0x50, 0x84, 0x44, 0x1B, 0x33, 0x42, 0x48, 0x9A,
-    0xC5, 0x83, 0x8B, 0x4C, 0x7C, 0x79, 0x83, 0xA8, 0xEA, 0x86, 0xA0, 0x1D, 0x58, 0x23, 0x75, 0x28,
-    0x12, 0x12, 0x34, 0xC9, 0x23, 0x64, 0xEB, 0xC0, 0xD2, 0x81, 0xA5, 0x20, 0xD1, 0x4B, 0x95, 0x01,
-    0xA9, 0x4D, 0xEA, 0x47, 0xE8, 0x23, 0x64, 0xC8, 0xC2, 0x96, 0xD1, 0x43, 0xD2, 0x70, 0x6E, 0x12,
-    0x04, 0xA8, 0x12, 0xE2, 0x01, 0xB8, 0xFF, 0xB1, 0x7D, 0xEF, 0xB9, 0x57, 0xFF, 0xF9, 0xCF, 0x39,
-    0xD7, 0x28, 0x82, 0x9C, 0x7A, 0x93, 0x38, 0xE0, 0xC0, 0xA3, 0x37, 0x37, 0x99, 0xBC, 0x0D, 0x48,
-    0x4A, 0x84, 0x13, 0x9C, 0x21, 0xE8, 0x55, 0xF4, 0x62, 0x1C, 0x23, 0xE3, 0x3D, 0x4C, 0xB0, 0x27,
-    0xB8, 0x09, 0x7E, 0x42, 0x92, 0xF0, 0xE6, 0x90, 0xD9, 0xAC, 0x43, 0x82, 0xB1, 0x47, 0x72, 0xA2,
-    0x36, 0xAD, 0xEE, 0xC4, 0xC4, 0xA4, 0xF9, 0x5A, 0x8B, 0xC0, 0xA0, 0xD5, 0x7F, 0x30, 0xE4, 0x2E,
-    0xEE, 0x94, 0x50, 0x99, 0x53, 0x91, 0xE2, 0xDD, 0x94, 0xC3, 0x90, 0x03, 0x57, 0x4C, 0x25, 0x01,
-    0xE1, 0x00, 0x67, 0x64, 0xE8, 0xDB, 0x33, 0xD6, 0x76, 0x61, 0x63, 0xCE, 0x16, 0x4B, 0x74, 0x18,
-    0x62, 0x67, 0x14, 0x32, 0x3C, 0x45, 0x51, 0x4E, 0x88, 0xE6, 0x09, 0xCF, 0x4A, 0x46, 0xB3, 0xBC,
-    0x45, 0xBF, 0x2C, 0x93, 0x70, 0x29, 0xBB, 0x3E, 0xE7, 0xB1, 0x14, 0x61, 0x6E, 0x52, 0xD8, 0xF7,
-    0xD0, 0x92, 0x91, 0xF8, 0x2F, 0x29, 0x7E, 0x40, 0xB4, 0x50, 0xA5, 0x9C, 0x13, 0x76, 0x85, 0xC7,
-    0xCA, 0xAC, 0xAC, 0xFC, 0x3D, 0x9D, 0x9A, 0x2F, 0xAA, 0x7C, 0x92, 0x4E, 0xD3, 0xEB, 0xB5, 0x1D,
-    0x48, 0xAF, 0xC1, 0xC1, 0xA7, 0x22, 0xF1, 0x23, 0xF6, 0x97, 0x88, 0x64, 0x55, 0x11, 0xAF, 0xC3,
-    0x9E, 0xCC, 0xD6, 0x65, 0x16, 0xE0, 0xE1, 0x0A, 0x3C, 0x81, 0x2F, 0x9E, 0x58, 0x76, 0x68, 0x9C,
-    0x4E, 0x7A, 0xBE, 0x2E, 0xFE, 0xC4, 0x71, 0x91, 0x7F, 0xA9, 0x31, 0xF6, 0x38, 0x18, 0x27, 0x9A,
-    0xF1, 0x1F, 0xD8, 0xB3, 0x54, 0x2D, 0x8F, 0xAB, 0x42, 0x6E, 0xC4, 0xF4, 0xEC, 0x2B, 0x4F, 0x55,
-    0x69, 0x5F, 0x97, 0x4F, 0x24, 0xBF, 0x5A, 0x4E, 0xB4, 0x89, 0x6C, 0x48, 0xA9, 0x8A, 0x39, 0xDE,
-    0x64, 0x9E, 0xDC, 0xDC, 0x06, 0x7D, 0x9E, 0x18, 0xCE, 0xFF, 0xBD, 0xFA, 0x7B, 0xAF, 0x9C, 0xD1,
-    0xED, 0x97, 0x78, 0xD6, 0x6E, 0xE9, 0x34, 0xF2, 0xA2, 0xA0, 0x7E, 0xEE, 0x3C, 0xB7, 0x47, 0xF8,
-    0xAF, 0x88, 0x5D, 0xB6, 0x5E, 0xA8, 0xFA, 0x27, 0x93, 0x52, 0x45, 0x74, 0x7C, 0xC6, 0xFA, 0x88,
-    0x9D, 0xE3, 0xEF, 0x92, 0x14, 0x3A, 0x91, 0x9D, 0x89, 0xC5, 0x76, 0x56, 0x29, 0x74, 0x82, 0x2F,
-    0x66, 0xEB, 0xA1, 0x43, 0x65, 0x03, 0x3F, 0xA6, 0x30, 0xA4, 0x70, 0x85, 0xAB, 0xD9, 0x10, 0x39,
-    0x3E, 0xAB, 0x16, 0x52, 0xCA, 0xC7, 0x4D, 0x24, 0xA6, 0x84, 0x4E, 0x67, 0x2A, 0x72, 0x89, 0x3D,
-    0x4A, 0x17, 0x58, 0x5D, 0x29, 0x96, 0xC1, 0xD9, 0xA8, 0xDF, 0xD4, 0xBF, 0xDD, 0x97, 0xC6, 0xAD,
-    0x85, 0x5F, 0xDF, 0xD7, 0xFA, 0x2C, 0x3B, 0xE7, 0x52, 0x9D, 0x65, 0xF2, 0xE7, 0x25, 0x8D, 0x15,
-    0xFD, 0x6B, 0x34, 0xB6, 0x87, 0x7D, 0xFA, 0xED, 0xA3, 0x8E, 0xF6, 0xED, 0x4C, 0xDF, 0xB9, 0xF9,
-    0x34, 0x56, 0x50, 0xDB, 0x37, 0x98, 0xB7, 0x87, 0xF4, 0x9B, 0xE8, 0x00, 0xED, 0xCE, 0x4D, 0x6E,
-    0xA2, 0xCF, 0xE0, 0x82, 0xAF, 0x46, 0xCC, 0xD2, 0xBC, 0xD1, 0xD6, 0xEB, 0x88, 0x4D, 0x9C, 0xB1,
-    0xF4, 0x74, 0xFD, 0xE9, 0xB7, 0x7B, 0x6A, 0x45, 0xAA, 0xD5, 0xEA, 0x36, 0x55, 0x85, 0x05, 0xD6,
-    0x09, 0xBA, 0x56, 0xE7, 0x07, 0x95, 0x56, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x1B, 0x7B,
-    0x8B, 0x11, 0x37, 0x14, 0x11, 0x29, 0x8C, 0xBD, 0x0D, 0x0D, 0x60, 0xFB, 0x28, 0x52, 0x18, 0x69,
-    0xD7, 0xB7, 0x52, 0x04, 0x14, 0x48, 0x60, 0x89, 0x44, 0x69, 0x29, 0x68, 0x30, 0xC5, 0xA5, 0xB0,
-    0x84, 0x25, 0x2E, 0xBE, 0x49, 0x28, 0x28, 0x28, 0x30, 0x45, 0x6A, 0x52, 0x50, 0x04, 0x2C, 0xE4,
-    0x2B, 0x82, 0xB4, 0x40, 0xEC, 0x5B, 0x08, 0x12, 0x1D, 0x2C, 0x48, 0x16, 0x12, 0x91, 0xF0, 0x20,
-    0x05, 0x59, 0xBA, 0x14, 0x1E, 0x89, 0x8D, 0x74, 0x0E, 0x7B, 0x37, 0x7C, 0x6F, 0xD6, 0x87, 0x11,
-    0x04, 0x24, 0xD6, 0xFB, 0x7D, 0x9E, 0x99, 0xDD, 0x7B, 0xF3, 0xFE, 0x67, 0x89, 0x88, 0x3C, 0x5B,
-    0x90, 0xB8, 0x97, 0x53, 0x84, 0xF1, 0x22, 0x90, 0x00, 0xB1, 0x77, 0x21, 0x8D, 0x03, 0x5B, 0xC4,
-    0x41, 0x4E, 0x09, 0xD0, 0x04, 0xE4, 0x8F, 0x7B, 0xA9, 0x6F, 0x6D, 0x4E, 0x67, 0xF6, 0x52, 0xC2,
-    0xFC, 0x04, 0x03, 0x45, 0x01, 0x0B, 0x69, 0x10, 0x35, 0x1E, 0x21, 0x6A, 0x8E, 0x09, 0xEF, 0x29,
-    0x59, 0x2D, 0x53, 0x73, 0x7E, 0x89, 0x92, 0xA5, 0xB3, 0xD4, 0x59, 0xBA, 0x44, 0xD9, 0x5A, 0x8F,
-    0xB2, 0x4B, 0x9A, 0x6E, 0xF6, 0x34, 0x65, 0xBA, 0xA0, 0xCE, 0x2F, 0x90, 0xFD, 0x43, 0x4E, 0xAD,
-    0xDB, 0x8A, 0x22, 0x20, 0xB4, 0x87, 0x10, 0x63, 0x29, 0x7C, 0x91, 0x28, 0x84, 0xA8, 0xA9, 0x29,
-    0xAA, 0xAF, 0xEE, 0xC8, 0xAD, 0x8B, 0x62, 0xCA, 0xE9, 0xB8, 0xCC, 0xFA, 0x01, 0x1D, 0x20, 0x6B,
-    0x74, 0x29, 0x93, 0x16, 0xC8, 0x01, 0xAC, 0x01, 0x31, 0x90, 0x00, 0x4D, 0x40, 0xEE, 0x43, 0x3D,
-    0xBB, 0x4B, 0xD4, 0x1F, 0x39, 0x51, 0xC2, 0x5A, 0x89, 0x3B, 0xA5, 0xBF, 0xDF, 0x83, 0x8F, 0xA4,
-    0x1D, 0xC9, 0x6B, 0xE7, 0xEB, 0x29, 0x76, 0xEB, 0xDB, 0x93, 0xA7, 0xEE, 0x8A, 0xC6, 0x90, 0x62,
-    0x15, 0x95, 0x1E, 0x79, 0x9A, 0xC8, 0xFF, 0x0B, 0x5A, 0x76, 0x48, 0x4F, 0x3F, 0xF8, 0xD0, 0x8D,
-    0xCF, 0xFC, 0xBA, 0xE2, 0xE6, 0xFC, 0x3F, 0x28, 0x6A, 0x07, 0xB1, 0x88, 0x96, 0xB5, 0x05, 0x03,
-    0x92, 0x5E, 0x65, 0x71, 0x9A, 0x3D, 0x5F, 0xD0, 0xCA, 0xEA, 0xB9, 0x9F, 0xD2, 0xDF, 0xEC, 0x81,
-    0x35, 0xF6, 0x79, 0xFB, 0x7E, 0x55, 0xD1, 0x2E, 0xC5, 0x43, 0x98, 0x96, 0x94, 0x35, 0xDD, 0x62,
-    0xAA, 0x40, 0x3E, 0x53, 0xC0, 0x24, 0x78, 0xAD, 0xC1, 0x4F, 0xE7, 0x99, 0x62, 0x10, 0xAD, 0xB1,
-    0x48, 0xC3, 0xC4, 0x1B, 0x88, 0x5C, 0x90, 0x2C, 0x24, 0x49, 0x0D, 0x18, 0xE0, 0x26, 0x00, 0xB7,
-    0x6C, 0xEF, 0x6E, 0x5F, 0xEF, 0x5B, 0x6B, 0xA4, 0xC4, 0x5C, 0xBC, 0x0C, 0x33, 0xAD, 0x69, 0x6F,
-    0x1D, 0x5E, 0x97, 0xFE, 0x3E, 0x49, 0xB2, 0xC7, 0xE8, 0x02, 0x2D, 0xA0, 0x49, 0xAD, 0x23, 0x62,
-    0xC5, 0x61, 0x41, 0x1C, 0x1A, 0x4E, 0x8A, 0x92, 0x3D, 0xEF, 0x28, 0x3B, 0xCB, 0xA3, 0x35, 0x90,
-    0xF9, 0x2C, 0x8D, 0xC3, 0x03, 0x9B, 0xB7, 0xEC, 0x97, 0x47, 0x69, 0x6B, 0x44, 0x37, 0x39, 0x38,
-    0x0F, 0xA3, 0x8C, 0x69, 0x63, 0x13, 0xD4, 0xD4, 0xCE, 0xA3, 0xF6, 0x2E, 0x93, 0x65, 0xCD, 0x23,
-    0x05, 0x0A, 0xB1, 0x91, 0x09, 0xF2, 0xD5, 0xD4, 0x04, 0x5F, 0x59, 0x6D, 0x82, 0x6F, 0xBE, 0x57,
-    0x46, 0xBC, 0xAB, 0xE8, 0x7E, 0x5B, 0x28, 0xB2, 0xA3, 0x40, 0xD3, 0x83, 0xA1, 0x3F, 0x22, 0x13,
-    0x53, 0x57, 0x99, 0x45, 0xE4, 0x83, 0x89, 0xC8, 0x37, 0x46, 0xA6, 0x9E, 0x31, 0xE1, 0xD7, 0x3E,
-    0x7E, 0x71, 0x67, 0xAB, 0x30, 0xFE, 0x81, 0xAD, 0x23, 0xB6, 0xE6, 0x6B, 0x41, 0xEB, 0x01, 0xEC,
-    0x8F, 0x1D, 0x85, 0xBD, 0x06, 0xC5, 0x62, 0x6D, 0x8E, 0x16, 0xC4, 0xD2, 0x02, 0xCD, 0xCA, 0xA5,
-    0x79, 0x9A, 0x6B, 0xC4, 0x31, 0x82, 0x6A, 0x6D, 0xBA, 0xDD, 0xEF, 0x8F, 0x53, 0x39, 0x3F, 0xBB,
-    0x44, 0x22, 0x6E, 0xAC, 0x51, 0xD8, 0x69, 0x5C, 0xA2, 0x20, 0x13, 0x3D, 0x0A, 0x4A, 0x61, 0x28,
-    0x30, 0xB0, 0xDF, 0x37, 0xD0, 0x00, 0x54, 0x10, 0xBF, 0x6A, 0xAD, 0x96, 0xC6, 0x2B, 0xA5, 0x41,
-    0xCE, 0x99, 0x47, 0x63, 0x69, 0xD6, 0x19, 0xC9, 0x7F, 0xE0, 0x34, 0x40, 0x8B, 0x40, 0xC7, 0x6C,
-    0x6C, 0x95, 0xA6, 0x6B, 0x37, 0xEB, 0xCC, 0x00, 0x5A, 0xD6, 0x38, 0xF0, 0xF8, 0x75, 0x99, 0x86,
-    0x76, 0x3F, 0x8D, 0xAE, 0xD9, 0x74, 0x99, 0x5A, 0x69, 0x87, 0x22, 0x40, 0xA6, 0xD9, 0x5F, 0xC0,
-    0xF3, 0x18, 0xEB, 0x2D, 0x3C, 0x97, 0x03, 0x8B, 0xAA, 0x7C, 0xF7, 0x38, 0x49, 0x21, 0x01, 0x15,
-    0xCA, 0x70, 0x93, 0x10, 0xF9, 0xDA, 0xB2, 0x9A, 0x46, 0xA4, 0x3C, 0x48, 0x9F, 0xE4, 0xE3, 0xCC,
-    0xDE, 0x79, 0xEA, 0xDA, 0x8A, 0x66, 0xAE, 0xAD, 0x10, 0x5C, 0x8B, 0xB1, 0x71, 0xE0, 0x00, 0xF0,
-    0x3B, 0x3E, 0x67, 0x52, 0xC5, 0xB1, 0x3F, 0x44, 0x55, 0xD7, 0xB2, 0x42, 0xE5, 0xEB, 0x50, 0x85,
-    0x79, 0xA8, 0x22, 0x8C, 0x13, 0x60, 0x48, 0xE1, 0x55, 0x4D, 0xE1, 0x3B, 0x39, 0x85, 0x1F, 0x70,
-    0x69, 0xD8, 0xBC, 0x6D, 0x07, 0x2A, 0xFC, 0x31, 0xAF, 0xD7, 0x55, 0x09, 0x74, 0x80, 0x26, 0x20,
-    0x55, 0xFD, 0x5B, 0x1F, 0x66, 0x5B, 0xCD, 0x39, 0x38, 0x31, 0x9D, 0xE4, 0x73, 0x40, 0x1B, 0x18,
-    0x02, 0xD8, 0xBC, 0x8B, 0xE6, 0x62, 0x5F, 0x26, 0xF1, 0xDE, 0x0E, 0xE6, 0x50, 0xA4, 0xA9, 0xD0,
-    0xA1, 0x52, 0x0A, 0xF7, 0x53, 0xF2, 0xFF, 0xFC, 0xCD, 0xC4, 0xDC, 0x19, 0x76, 0x22, 0x4C, 0x64,
-    0x65, 0x4F, 0x23, 0x73, 0x71, 0xAD, 0x48, 0xD6, 0x97, 0xC3, 0x04, 0xE6, 0x8A, 0xF4, 0x34, 0xDB,
-    0xEE, 0xEB, 0xDA, 0x03, 0x8E, 0x73, 0xCF, 0x78, 0xB0, 0xD6, 0xD7, 0x5D, 0x13, 0xAA, 0xA0, 0x38,
-    0xAA, 0x44, 0x2A, 0x6E, 0xEB, 0x44, 0xA6, 0xF2, 0x5C, 0x8E, 0xD6, 0xB1, 0x11, 0xE6, 0x71, 0x34,
-    0x5D, 0x09, 0x75, 0xAB, 0x89, 0x28, 0xDF, 0x2B, 0x9B, 0x47, 0x24, 0xFB, 0x2C, 0x4F, 0xBA, 0x4D,
-    0xE7, 0x1C, 0x2F, 0x38, 0x4E, 0x1C, 0xC7, 0x8E, 0x3B, 0xC7, 0x4A, 0xF9, 0xE8, 0x14, 0xE1, 0x21,
-    0x3A, 0xC7, 0x0B, 0x8A, 0x24, 0x37, 0x4E, 0x46, 0xA8, 0x48, 0xBC, 0x08, 0x33, 0xDE, 0xC3, 0xF6,
-    0x3F, 0x03, 0xD0, 0xD8, 0x1B, 0xBA, 0xA2, 0xF5, 0xAF, 0xC2, 0x93, 0xB7, 0x2B, 0x92, 0x87, 0x0B,
-    0x34, 0xB7, 0x1B, 0x51, 0x8C, 0x4A, 0x5D, 0x7F, 0x42, 0xA4, 0xEC, 0xF3, 0x93, 0x26, 0x8B, 0xB1,
-    0x0F, 0x37, 0x20, 0xFF, 0x43, 0xD8, 0x2C, 0xD0, 0x61, 0x84, 0xDA, 0x40, 0x04, 0xDB, 0x2B, 0x5C,
-    0xC5, 0x42, 0xC9, 0x54, 0x28, 0x91, 0x6E, 0x0F, 0xB6, 0x75, 0x7B, 0xD0, 0xBF, 0x2E, 0xD4, 0x32,
-    0x7A, 0x7A, 0x85, 0xF7, 0x0A, 0x17, 0xE1, 0x87, 0x81, 0xA8, 0xC7, 0x0E, 0xBC, 0x8B, 0x12, 0xAC,
-    0x82, 0x61, 0xEF, 0x35, 0x99, 0xF7, 0x50, 0xF3, 0x3D, 0xF4, 0xD7, 0x1E, 0x0C, 0xEA, 0xC1, 0x1C,
-    0xC6, 0xA7, 0xE7, 0x3B, 0x68, 0x9E, 0x1D, 0xFA, 0x7C, 0x07, 0xF3, 0x24, 0x01, 0xF0, 0x4E, 0x22,
-    0x55, 0x2F, 0x09, 0xCB, 0x5E, 0xE2, 0xD9, 0xDF, 0x47, 0xD4, 0x84, 0x32, 0x2C, 0x8B, 0x21, 0xB8,
-    0xDD, 0x01, 0x11, 0x1C, 0xBF, 0xCC, 0x3D, 0x03, 0xDD, 0x22, 0xCB, 0x88, 0x86, 0x1D, 0xEE, 0x36,
-    0xD5, 0xC5, 0xFB, 0xED, 0xF3, 0x01, 0x3A, 0xD3, 0x1B, 0x83, 0xED, 0x1B, 0x3C, 0x97, 0x69, 0x50,
-    0x44, 0x14, 0xE8, 0x45, 0xF2, 0x50, 0xD6, 0x54, 0xC2, 0x85, 0xD9, 0xF0, 0xD8, 0x93, 0xBE, 0x2D,
-    0x91, 0xCD, 0x63, 0x9A, 0x86, 0x56, 0x27, 0x61, 0x97, 0x29, 0xB2, 0xA7, 0x58, 0xDD, 0x1A, 0x6F,
-    0xF2, 0x1E, 0xBE, 0x6B, 0xCA, 0xB6, 0x60, 0x4C, 0xCE, 0x2E, 0xFE, 0x1F, 0xA5, 0x5E, 0x2A, 0xC7,
-    0x5C, 0x19, 0xE3, 0xE3, 0xA0, 0x40, 0x9F, 0xC8, 0x6E, 0x7A, 0xF0, 0x55, 0x58, 0xEA, 0x4D, 0x99,
-    0x6B, 0x48, 0xD5, 0xB0, 0x55, 0xC3, 0x56, 0x8D, 0x0D, 0xFF, 0x89, 0x84, 0xEA, 0x77, 0x22, 0xA5,
-    0x49, 0x68, 0xCD, 0x67, 0x5A, 0x41, 0x6D, 0xAE, 0x06, 0xED, 0xE4, 0x79, 0xE9, 0x69, 0x0A, 0xD4,
-    0x12, 0xB0, 0x4E, 0x62, 0x6F, 0x67, 0x05, 0x99, 0x5D, 0xCE, 0xEC, 0x1D, 0xAD, 0x08, 0x95, 0xD1,
-    0x7F, 0xE3, 0x16, 0xD0, 0xBA, 0x21, 0x54, 0x34, 0xA4, 0x93, 0xAB, 0x7B, 0xC4, 0x26, 0x23, 0xC4,
-    0xA2, 0x98, 0x3E, 0xCE, 0x70, 0x97, 0x6E, 0x6E, 0xC4, 0x6E, 0xA5, 0xC0, 0xBD, 0xEE, 0x8E, 0x90,
-    0x19, 0x4E, 0x78, 0xEA, 0xBB, 0xE7, 0xEA, 0xC9, 0x85, 0xB9, 0x30, 0x7F, 0xEB, 0xCE, 0xC1, 0xDB,
-    0xF9, 0x9B, 0xE7, 0xBE, 0xFC, 0x26, 0x6F, 0x05, 0x57, 0xBE, 0x4B, 0xE5, 0xC1, 0xD5, 0x31, 0x05,
-    0x7D, 0x44, 0x37, 0x08, 0xAE, 0xE6, 0xA0, 0x2B, 0x39, 0x4A, 0xDC, 0xE6, 0xFD, 0x49, 0x6B, 0xA0,
-    0xBA, 0x64, 0xDD, 0x9C, 0x4F, 0xD5, 0xFF, 0x81, 0x96, 0x1D, 0x71, 0xC5, 0x5D, 0x46, 0x6D, 0xD2,
-    0x53, 0xDB, 0x37, 0x30, 0xE5, 0xD5, 0x65, 0x7A, 0xAC, 0xA2, 0x96, 0x66, 0xF7, 0x43, 0x65, 0xB4,
-    0x12, 0x74, 0x4B, 0x2E, 0xB6, 0xCC, 0x45, 0xA5, 0x49, 0x7E, 0x71, 0xDC, 0x80, 0x8A, 0x27, 0x28,
-    0xB8, 0x53, 0xA2, 0xC8, 0x53, 0xEA, 0xC2, 0x93, 0x5F, 0x7C, 0x7F, 0x93, 0x82, 0x43, 0xB8, 0x18,
-    0xF6, 0x77, 0x0B, 0xAF, 0x78, 0xA5, 0xF0, 0x8B, 0xA0, 0xFE, 0xCB, 0x83, 0x42, 0x00, 0x11, 0x92,
-    0x64, 0x03, 0xEF, 0x0F, 0x01, 0x75, 0xE2, 0xB0, 0x88, 0x1D, 0xF1, 0x6C, 0xC9, 0x79, 0x17, 0x4F,
-    0xE8, 0xF2, 0xE5, 0x0B, 0x2B, 0xC8, 0x47, 0x7C, 0x7D, 0x4C, 0xED, 0x7E, 0xBC, 0x65, 0xB8, 0x30,
-    0xD7, 0x99, 0xE6, 0x29, 0x3E, 0xFB, 0xCC, 0xE3, 0x94, 0x8C, 0xAA, 0x79, 0x6A, 0x7E, 0xB7, 0x9F,
-    0xE1, 0x83, 0x06, 0xAD, 0x61, 0x97, 0xB3, 0xEC, 0x90, 0x65, 0xBD, 0x90, 0xBB, 0xBA, 0xDD, 0xE1,
-    0x38, 0x54, 0x93, 0x0D, 0xCC, 0xBF, 0xD0, 0xF4, 0x11, 0x7F, 0x34, 0x21, 0x3B, 0xC5, 0xD1, 0x83,
-    0x31, 0xD2, 0xC3, 0x34, 0xD1, 0xA9, 0x8D, 0xC8, 0x63, 0x3E, 0xBD, 0x3A, 0xDC, 0x7A, 0x3A, 0xDC,
-    0x79, 0xB2, 0x9A, 0xE8, 0x1F, 0x14, 0x22, 0x2A, 0x82, 0x3F, 0x68, 0x54, 0x94, 0x0B, 0x15, 0x16,
-    0x42, 0x05, 0xFA, 0x18, 0x18, 0x87, 0xB9, 0x28, 0xDA, 0xCA, 0x22, 0x71, 0xFB, 0xC8, 0xF1, 0x49,
-    0xB1, 0x72, 0x98, 0xDA, 0x83, 0xF4, 0x6F, 0x05, 0x7C, 0x0A, 0x68, 0xCC, 0x72, 0x12, 0x7C, 0xE2,
-    0xE2, 0x09, 0xA7, 0xDB, 0x08, 0x55, 0xF3, 0xED, 0x2C, 0x8E, 0x8D, 0xC6, 0x6C, 0x93, 0x96, 0x1B,
-    0xB3, 0x38, 0xF9, 0x40, 0x69, 0xA7, 0x31, 0x2B, 0x54, 0x4D, 0xA7, 0x4E, 0x79, 0x75, 0xC7, 0x72,
-    0xCD, 0x6B, 0x91, 0x26, 0x99, 0xC6, 0xED, 0x9F, 0xF8, 0x8C, 0x67, 0xED, 0xC6, 0x7C, 0x92, 0x8C,
-    0xC9, 0x9B, 0xA2, 0xF0, 0x25, 0xBE, 0xBB, 0xFC, 0x49, 0xA4, 0xB3, 0xE9, 0x32, 0xA3, 0x2A, 0xA3,
-    0x4E, 0x46, 0xB7, 0x32, 0x2A, 0x77, 0x2E, 0x1A, 0x7C, 0x12, 0xED, 0x6E, 0x1B, 0xB7, 0x18, 0x67,
-    0x94, 0xB8, 0xBB, 0x93, 0x79, 0x55, 0xDF, 0xF2, 0xA3, 0xFA, 0xB7, 0x10, 0x42, 0xAB, 0x38, 0xD5,
-    0x4C, 0x74, 0x6D, 0x73, 0xD9, 0x55, 0x37, 0x77, 0x04, 0xE2, 0x2F, 0x89, 0xCC, 0xDD, 0x58, 0x69,
-    0x41, 0x89, 0x81, 0xF1, 0xAD, 0x9E, 0xE4, 0xA6, 0x59, 0xFD, 0xF8, 0xFA, 0x1F, 0x5B, 0xB5, 0x6A,
-    0xD5, 0xFF, 0xFF, 0xFF, 0x19, 0x18, 0x18, 0x00, 0xAD, 0x91, 0x31, 0x4E, 0x03, 0x31, 0x10, 0x45,
-    0xC7, 0xB6, 0x14, 0x17, 0x5B, 0x50, 0xA6, 0xCC, 0x09, 0xC2, 0x9E, 0x00, 0x61, 0xD2, 0xD0, 0x52,
-    0xE4, 0x3A, 0x89, 0xAF, 0x42, 0x4F, 0x41, 0x43, 0x41, 0x81, 0x60, 0xC4, 0x09, 0x9C, 0x48, 0x51,
-    0xDA, 0x69, 0x52, 0x50, 0x61, 0x25, 0x2E, 0x40, 0x22, 0x6B, 0x66, 0x6C, 0x85, 0xA5, 0x43, 0x01,
-    0x3C, 0xF2, 0xB3, 0xE5, 0xB1, 0xFE, 0x97, 0xBF, 0x01, 0x64, 0xF8, 0xD0, 0x46, 0xD5, 0x85, 0x2E,
-    0x9A, 0xA0, 0x22, 0x18, 0xD4, 0x04, 0x56, 0xD0, 0xAC, 0xCC, 0xC6, 0x3D, 0x65, 0x9F, 0x71, 0xB8,
-    0x1A, 0x6E, 0x9C, 0xFD, 0x6A, 0x1C, 0x85, 0x6A, 0xB1, 0x00, 0xD5, 0xAD, 0xD1, 0x04, 0x8B, 0x06,
-    0x15, 0x37, 0x80, 0xD5, 0x15, 0x8B, 0x5F, 0xB2, 0xB6, 0xC5, 0x63, 0xAA, 0xEA, 0xAD, 0xB1, 0xD7,
-    0xAB, 0xE7, 0x0D, 0xEB, 0xFC, 0x5A, 0xAF, 0x86, 0xE0, 0x24, 0x85, 0x1D, 0x49, 0x0C, 0x9A, 0x4A,
-    0x0E, 0xF5, 0xD1, 0x25, 0x89, 0x8B, 0x12, 0xC5, 0x33, 0x49, 0x16, 0x13, 0x92, 0x73, 0xFD, 0x27,
-    0xF6, 0xBE, 0x5B, 0x12, 0xDF, 0xED, 0x37, 0xDF, 0xC3, 0x1D, 0xF1, 0x9D, 0xD0, 0xFF, 0xFB, 0x36,
-    0xD9, 0xC1, 0xF9, 0x2B, 0xC1, 0x03, 0xFF, 0x77, 0x3A, 0x94, 0x7A, 0xBF, 0x4A, 0x4D, 0x8E, 0x65,
-    0x85, 0x9F, 0xEA, 0x8D, 0xA7, 0xBF, 0x4E, 0xD0, 0x26, 0xE8, 0x87, 0x67, 0x71, 0x95, 0x3F, 0x00,
-    0x4C, 0x38, 0x63, 0xE0, 0xB8, 0x42, 0xDD, 0xE0, 0x7C, 0xDA, 0xE6, 0x65, 0xDE, 0xCF, 0x06, 0xBC,
-    0xBB, 0x03, 0x18, 0xC3, 0xBD, 0x60, 0x2E, 0x18, 0x25, 0x86, 0xCE, 0x8E, 0x2F, 0x8F, 0x02, 0x43,
-    0x13, 0x43, 0xC5, 0x53, 0x70, 0x9A, 0x5A, 0x78, 0xBC, 0xC5, 0x93, 0x17, 0xDF, 0x81, 0xDD, 0x17,
-    0x87, 0x4F, 0x45, 0x8D, 0xC1, 0x0D, 0x80, 0x30, 0x0C, 0x03, 0x23, 0xF2, 0xE4, 0x91, 0x01, 0xD8,
-    0x85, 0xC2, 0x64, 0x88, 0xC9, 0x28, 0x1B, 0x74, 0x04, 0x46, 0xE8, 0x07, 0x09, 0xA1, 0x8A, 0x23,
-    0x11, 0x0F, 0x22, 0xC7, 0x0F, 0x5B, 0xB6, 0x45, 0x54, 0xE2, 0x2C, 0x07, 0xA7, 0x1A, 0x4C, 0x73,
-    0x52, 0x08, 0x79, 0xEA, 0xDD, 0x18, 0xA5, 0x73, 0x83, 0x61, 0x6E, 0x21, 0xEF, 0x88, 0xC1, 0x4A,
-    0x4E, 0x3C, 0x4A, 0xDD, 0xB8, 0x8C, 0x2B, 0x51, 0x1D, 0xC6, 0xB1, 0x91, 0x95, 0x33, 0xC2, 0x10,
-    0x45, 0xE9, 0xC4, 0xB3, 0x56, 0x16, 0xEF, 0xD1, 0xB2, 0x44, 0xFF, 0xDD, 0xFE, 0xAD, 0x6F, 0xB7,
-    0xF3, 0x7F, 0x01,
+static const uint8_t notosans_12_regularBitmaps[24528] = {
+    0xAD, 0x58, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0x4F, 0x26, 0x10, 0x02, 0x9E, 0x2B, 0x14,
+    0x28, 0x91, 0x85, 0x63, 0x93, 0xCA, 0x90, 0x96, 0xAD, 0x0B, 0x72, 0x39, 0x72, 0x11, 0x17, 0x29,
+    0xB2, 0x01, 0xB4, 0x6E, 0xD3, 0xA4, 0xB1, 0x8A, 0xA8, 0x49, 0xB1, 0x05, 0x4F, 0x4B, 0x20, 0x65,
+    0x0A, 0x9F, 0x0A, 0xA7, 0x56, 0x91, 0xC2, 0x39, 0xC3, 0x38, 0x17, 0x9B, 0x84, 0x80, 0xF6, 0x6E,
+    0x47, 0x4E, 0x91, 0xD2, 0x74, 0x82, 0x83, 0x8B, 0x00, 0x31, 0x91, 0xD8, 0x8D, 0x84, 0xC0, 0xB4,
+    0x34, 0xCE, 0x11, 0xBA, 0xBD, 0x9D, 0x7C, 0x6F, 0xC8, 0xBD, 0x3B, 0xDD, 0x8F, 0x2C, 0x59, 0x26,
+    0xE7, 0xF1, 0xB8, 0xC3, 0x99, 0x79, 0x6F, 0xBE, 0xF9, 0xE6, 0xBD, 0x37, 0xD7, 0xEF, 0xF7, 0xFB,
+    0xC9, 0x35, 0x5C, 0x57, 0xAF, 0x5C, 0xB9, 0x42, 0xD4, 0x4F, 0xFB, 0x2B, 0x6E, 0xE9, 0x2B, 0x21,
+    0x43, 0x4A, 0x28, 0xA6, 0x8C, 0x0A, 0xD2, 0xB8, 0x6B, 0xDC, 0xFC, 0xB7, 0xA0, 0x29, 0x6A, 0x13,
+    0x8A, 0x48, 0x90, 0xAF, 0xDC, 0x32, 0xA6, 0x90, 0x84, 0xF4, 0x95, 0x57, 0xBA, 0x95, 0xB3, 0x6C,
+    0x34, 0xC1, 0x6D, 0x3B, 0x39, 0xB5, 0x5B, 0x79, 0x18, 0x2D, 0xC8, 0x43, 0xF4, 0xEA, 0x25, 0x71,
+    0x36, 0xA9, 0x69, 0xF3, 0xAE, 0xA9, 0x87, 0x03, 0xAB, 0x89, 0x70, 0x39, 0x26, 0xA7, 0xC0, 0xD4,
+    0x14, 0xCA, 0x29, 0xC6, 0x65, 0x9D, 0x3D, 0x68, 0x0D, 0x69, 0x04, 0x0D, 0xC5, 0x09, 0xE1, 0x3A,
+    0xFE, 0xC6, 0x5A, 0xB9, 0x6D, 0x08, 0x6B, 0x82, 0x87, 0x9A, 0x5C, 0x53, 0x92, 0xBD, 0x62, 0xE7,
+    0x20, 0x38, 0x48, 0x93, 0x38, 0xA1, 0xF3, 0x6F, 0xAB, 0xB3, 0xA2, 0xD0, 0xCC, 0x69, 0x8D, 0x6E,
+    0xE3, 0x57, 0x08, 0x11, 0xDD, 0xDF, 0x1E, 0x84, 0x9B, 0x14, 0x44, 0x6E, 0x4D, 0x98, 0x62, 0x5B,
+    0x9D, 0xA1, 0xCF, 0xB1, 0x9F, 0xA9, 0x31, 0x8A, 0x05, 0xAF, 0x81, 0xC9, 0xC7, 0x46, 0xBF, 0x01,
+    0x43, 0x60, 0x15, 0x77, 0xC5, 0x73, 0x4A, 0x7E, 0xED, 0x19, 0xE9, 0xCE, 0x6A, 0x7E, 0xE7, 0x31,
+    0x43, 0x5B, 0xFA, 0x39, 0x4D, 0x17, 0x1F, 0xE8, 0xB1, 0xD9, 0xB0, 0xC6, 0x62, 0x50, 0x9A, 0x13,
+    0x79, 0x10, 0x1F, 0xEF, 0x02, 0x3D, 0x63, 0xC8, 0x24, 0x26, 0xA7, 0x8A, 0xC9, 0x53, 0x31, 0x05,
+    0x32, 0x86, 0x8D, 0xB1, 0xBD, 0xC7, 0xC6, 0xD4, 0x2C, 0x56, 0xC3, 0x31, 0x09, 0x4D, 0x83, 0x02,
+    0x1D, 0xD7, 0x6C, 0x69, 0x2D, 0x48, 0x4D, 0x9E, 0x1A, 0x4D, 0x0E, 0x86, 0xEE, 0x13, 0x16, 0x6B,
+    0x69, 0xC0, 0x80, 0xA6, 0xE3, 0x2D, 0x1D, 0x01, 0xF2, 0xEE, 0x8A, 0x1A, 0x80, 0x57, 0x50, 0x50,
+    0xB6, 0x10, 0xF4, 0xBA, 0x61, 0xD9, 0xB4, 0xD1, 0xAC, 0xA2, 0x7B, 0x0F, 0xE6, 0xB4, 0x83, 0x21,
+    0xA6, 0xE8, 0x7D, 0xB4, 0x00, 0xC2, 0x42, 0xCF, 0x4B, 0x10, 0x3C, 0x6C, 0x00, 0x66, 0x0B, 0xFE,
+    0xCC, 0x18, 0x32, 0x90, 0x16, 0xA2, 0xA4, 0x1B, 0x05, 0x40, 0x82, 0x15, 0xE4, 0x56, 0x98, 0x28,
+    0xF0, 0x0A, 0xA0, 0x59, 0xC8, 0xA7, 0x9B, 0xE8, 0x16, 0x5C, 0xAF, 0x6A, 0x01, 0xE6, 0x8B, 0x17,
+    0x54, 0xEC, 0x37, 0xB0, 0x7C, 0x1D, 0xCD, 0x7A, 0xC4, 0x30, 0xD8, 0x05, 0x07, 0x49, 0xFC, 0xBD,
+    0xDA, 0x92, 0xC6, 0xB7, 0xA4, 0x99, 0xE3, 0x5B, 0xB4, 0x24, 0x8B, 0x6C, 0x6D, 0x8B, 0x28, 0x84,
+    0xDD, 0x3E, 0x16, 0x99, 0x96, 0xC3, 0xE5, 0xC2, 0xD4, 0x7D, 0x6A, 0x32, 0x8A, 0x0B, 0xEA, 0x4D,
+    0x28, 0x9C, 0x90, 0x28, 0x28, 0x5A, 0xA7, 0x71, 0xF4, 0xFB, 0xAF, 0x02, 0xF3, 0x4B, 0x1A, 0xAC,
+    0x59, 0xF4, 0x62, 0x36, 0xD8, 0xAD, 0x2F, 0x6F, 0xA9, 0x70, 0xC1, 0x1D, 0x7F, 0x9C, 0xA6, 0x3F,
+    0xEA, 0xC6, 0x60, 0xBE, 0xFE, 0x40, 0x0A, 0x25, 0xD4, 0x2B, 0xF4, 0xF4, 0x25, 0xA4, 0xC0, 0x7C,
+    0xD8, 0xC8, 0x37, 0xDA, 0x8A, 0xD7, 0x16, 0x00, 0xA3, 0xFC, 0x09, 0x13, 0x68, 0x59, 0x30, 0xFF,
+    0x40, 0x51, 0x4A, 0xD4, 0xF0, 0x5C, 0x9D, 0x92, 0x4B, 0x67, 0x5B, 0x45, 0x5E, 0xCD, 0x85, 0x64,
+    0x07, 0x11, 0xCC, 0x16, 0xF8, 0xB9, 0x36, 0x01, 0x44, 0xA3, 0x96, 0x13, 0x05, 0x6C, 0xD3, 0x21,
+    0xBA, 0x0A, 0xE9, 0x56, 0x41, 0xEE, 0x3D, 0xF8, 0x40, 0xF9, 0xC6, 0x94, 0xE2, 0xBD, 0xB7, 0x6B,
+    0x20, 0x59, 0x63, 0xD9, 0x0A, 0xB4, 0xCA, 0x80, 0x66, 0x02, 0x34, 0xA3, 0xF1, 0x62, 0x03, 0x16,
+    0xCC, 0x31, 0x97, 0x19, 0xC4, 0x2E, 0x9D, 0x6C, 0xF7, 0x50, 0x48, 0xDB, 0xC3, 0x29, 0xBE, 0x55,
+    0xB4, 0xB3, 0x79, 0xC0, 0xBF, 0x51, 0x1F, 0xE4, 0x10, 0xD5, 0x8A, 0xC0, 0x7B, 0x2A, 0x67, 0xE6,
+    0xC0, 0xB6, 0xB1, 0x57, 0x68, 0x36, 0x1C, 0xF0, 0xCE, 0xD7, 0xB4, 0x21, 0x94, 0x25, 0x13, 0x73,
+    0xEA, 0x90, 0x26, 0x27, 0x85, 0x57, 0x95, 0xDB, 0x84, 0x79, 0x3B, 0x15, 0xD7, 0x6C, 0x95, 0x74,
+    0xCB, 0xEE, 0x15, 0x6A, 0xED, 0x82, 0x5E, 0x67, 0xC6, 0x7A, 0xCB, 0x02, 0xF3, 0x2E, 0x30, 0x2B,
+    0x90, 0x44, 0x43, 0x1A, 0x48, 0xD1, 0x49, 0xD3, 0xD6, 0xF1, 0x37, 0x6E, 0xC3, 0xB6, 0x8D, 0x3B,
+    0xBB, 0x36, 0xB0, 0x17, 0xF4, 0xCC, 0x70, 0x8F, 0xE3, 0x65, 0x7B, 0x38, 0x98, 0x99, 0x7A, 0x67,
+    0xF3, 0xEE, 0x89, 0xFA, 0x82, 0xA9, 0xC9, 0xED, 0xCF, 0xEC, 0x85, 0x82, 0x2E, 0xE8, 0x88, 0xEE,
+    0xA7, 0x3F, 0x15, 0xDD, 0x22, 0xBD, 0x66, 0xBE, 0x00, 0xB7, 0xE7, 0x5E, 0x43, 0xBF, 0x3A, 0x1B,
+    0x83, 0x1F, 0xDE, 0xC8, 0x28, 0x3D, 0xC8, 0xE8, 0xF2, 0x36, 0xAF, 0x01, 0x30, 0x48, 0xD0, 0x26,
+    0x11, 0x39, 0x25, 0xC0, 0x2D, 0x71, 0xCC, 0xC3, 0x03, 0x8A, 0x4C, 0xC3, 0x43, 0x61, 0x45, 0x79,
+    0xBE, 0x67, 0xCA, 0xF6, 0x70, 0x58, 0x63, 0x1B, 0x61, 0x12, 0x9B, 0xE7, 0xB6, 0x59, 0x0A, 0x26,
+    0x53, 0x81, 0x79, 0xE7, 0xDE, 0xB7, 0x2A, 0xC3, 0x9E, 0xB8, 0x78, 0x8E, 0x5B, 0xBF, 0x55, 0x9B,
+    0x72, 0x13, 0x96, 0x31, 0x13, 0x22, 0xEB, 0xE3, 0x0B, 0xB0, 0xB4, 0xF0, 0x4B, 0x2A, 0xB0, 0x59,
+    0x0B, 0x4C, 0xA7, 0x80, 0xED, 0xF7, 0x20, 0xB3, 0x6D, 0x00, 0x8D, 0xA9, 0x15, 0x98, 0x9A, 0xFD,
+    0x0E, 0x92, 0x17, 0xC4, 0x4C, 0xEB, 0x2F, 0xD9, 0xA4, 0x46, 0x67, 0xC1, 0xF8, 0x8C, 0xD2, 0xAD,
+    0x0E, 0xD8, 0x5F, 0xCF, 0x24, 0x05, 0x7A, 0x96, 0x93, 0xD0, 0xF7, 0x14, 0xAD, 0xE9, 0xBF, 0x94,
+    0x74, 0x4D, 0xFF, 0xA9, 0xA6, 0x58, 0x23, 0x6E, 0x8C, 0x34, 0x78, 0x51, 0xEB, 0x22, 0x73, 0xF0,
+    0x48, 0xDC, 0x52, 0x17, 0x3D, 0x4F, 0xE9, 0x42, 0xF8, 0x39, 0x1E, 0x3F, 0x97, 0xBA, 0xF0, 0x3F,
+    0x01, 0x63, 0xBC, 0xFF, 0xE2, 0xE1, 0xCE, 0xF1, 0x70, 0x1A, 0x26, 0x10, 0xE2, 0xD0, 0x3A, 0xD1,
+    0x6F, 0x66, 0xD0, 0x84, 0x71, 0x0B, 0x0C, 0x5B, 0xFC, 0x19, 0x26, 0x4F, 0x10, 0xCA, 0x26, 0x08,
+    0x6E, 0x93, 0x14, 0x6C, 0xC3, 0xE6, 0x28, 0x40, 0xB0, 0xC2, 0xAB, 0xA0, 0x81, 0xB5, 0x4C, 0x47,
+    0x98, 0x0F, 0x24, 0xC4, 0x7B, 0x00, 0x26, 0x7A, 0x10, 0xA7, 0xE9, 0x3C, 0xA6, 0x91, 0xC4, 0xFB,
+    0x81, 0xFC, 0x0A, 0xEE, 0x15, 0x30, 0xF4, 0x5B, 0xFF, 0x0A, 0x90, 0x44, 0x0E, 0x42, 0x04, 0x2A,
+    0x63, 0x3F, 0x76, 0xFA, 0x11, 0x28, 0xDB, 0xC4, 0x36, 0x0E, 0x25, 0xBA, 0x05, 0x3C, 0x00, 0xB6,
+    0x07, 0xF6, 0xFA, 0xAD, 0xA5, 0x47, 0x1E, 0x2F, 0x24, 0x73, 0xD4, 0x99, 0xC3, 0x00, 0xAC, 0x05,
+    0x9B, 0x40, 0xBD, 0x82, 0x12, 0xD4, 0x80, 0xA3, 0xB3, 0x85, 0x3C, 0x9F, 0xA3, 0xDF, 0x9B, 0x65,
+    0xE9, 0x69, 0xCB, 0x50, 0x4B, 0x36, 0x48, 0x90, 0xAB, 0x59, 0xD5, 0x01, 0x3F, 0x2E, 0xB2, 0xB5,
+    0xBC, 0x7A, 0x60, 0xCB, 0x92, 0x01, 0x51, 0xE7, 0x6F, 0x7A, 0x90, 0x84, 0xB6, 0xDF, 0x6E, 0xD8,
+    0x13, 0xD2, 0xCE, 0x16, 0xB3, 0x45, 0x75, 0x6C, 0x69, 0xB3, 0x88, 0xE3, 0x8C, 0xB1, 0x2E, 0xFA,
+    0x0B, 0x44, 0xE4, 0x3E, 0x5D, 0xCC, 0xEC, 0x96, 0xCA, 0xDA, 0xC0, 0x55, 0x92, 0x0F, 0x3F, 0x8C,
+    0x40, 0xE4, 0x03, 0xFD, 0x75, 0xEB, 0x5C, 0xE0, 0xEB, 0x12, 0x84, 0xB1, 0xD9, 0x16, 0xF6, 0x73,
+    0xDE, 0x86, 0x9D, 0x0A, 0x61, 0xA7, 0x3A, 0x0C, 0xE3, 0xDF, 0x51, 0xE0, 0x6D, 0x47, 0x08, 0xD6,
+    0x0D, 0x80, 0x42, 0xA4, 0x70, 0xE1, 0x57, 0xBD, 0x92, 0x73, 0x9C, 0x20, 0x0F, 0x72, 0xCE, 0x87,
+    0xBC, 0x32, 0x84, 0xAF, 0xEE, 0xC1, 0x23, 0xC1, 0x08, 0x9D, 0xB5, 0x5E, 0x2A, 0x06, 0x42, 0x7D,
+    0x48, 0xC4, 0x3E, 0x5B, 0x59, 0x61, 0x7F, 0x4A, 0xA3, 0x8C, 0x5F, 0x1B, 0x04, 0xAC, 0x92, 0x74,
+    0x9F, 0x7A, 0xC8, 0x8D, 0x22, 0x4A, 0x6A, 0x1E, 0x35, 0xD6, 0x1E, 0xF6, 0xED, 0xA8, 0xF0, 0x94,
+    0xC8, 0x75, 0xEC, 0x2B, 0x5F, 0xD5, 0x31, 0x3C, 0xFA, 0xFD, 0xBA, 0x07, 0x1D, 0x7F, 0x2F, 0x43,
+    0x41, 0xEE, 0x7F, 0x94, 0x80, 0xAF, 0x7F, 0xAC, 0x82, 0x5F, 0x13, 0xED, 0xE5, 0xFE, 0x87, 0x44,
+    0xFB, 0x92, 0xB3, 0x84, 0x99, 0xCD, 0x15, 0x6E, 0x93, 0xDB, 0x58, 0x24, 0x34, 0x71, 0xA6, 0x10,
+    0xB1, 0x9D, 0x92, 0x6D, 0x64, 0xFB, 0x92, 0xD6, 0x93, 0xAE, 0xC3, 0xA6, 0xB4, 0x6C, 0x6D, 0x0A,
+    0x55, 0x6B, 0x63, 0x83, 0x7C, 0xA0, 0xCE, 0xD0, 0xBA, 0x07, 0x0B, 0x39, 0xBF, 0xE3, 0x65, 0xF7,
+    0xAA, 0xA9, 0xF5, 0xB1, 0x87, 0x5F, 0x94, 0x20, 0x1E, 0x8D, 0x47, 0x8D, 0x81, 0x02, 0x7B, 0x61,
+    0xF4, 0xBD, 0x8D, 0xF9, 0xA5, 0xAA, 0x75, 0xEA, 0xCF, 0xC0, 0x30, 0x3A, 0xCC, 0x8B, 0xC0, 0x3E,
+    0xEB, 0x25, 0x39, 0x1A, 0x34, 0x6D, 0x2E, 0xE5, 0x95, 0xDF, 0x5A, 0x8D, 0xBE, 0x25, 0x0B, 0xDD,
+    0x94, 0x88, 0xD7, 0xAF, 0x5E, 0x6F, 0x2C, 0x11, 0x38, 0x2F, 0x72, 0xCD, 0x3C, 0x7A, 0x30, 0x5D,
+    0xA7, 0xB8, 0x01, 0x80, 0x34, 0x9D, 0x3A, 0xF3, 0xF1, 0xD6, 0x34, 0x3C, 0xB8, 0xDA, 0xA6, 0x0F,
+    0x4F, 0x95, 0x9B, 0x72, 0x0F, 0x8C, 0xB8, 0x3E, 0x9F, 0x53, 0xD2, 0x50, 0x4F, 0x53, 0x78, 0x58,
+    0x90, 0x4F, 0xCC, 0xA9, 0x7F, 0x40, 0xD3, 0xFD, 0x87, 0xFA, 0xEB, 0x36, 0x6B, 0xB9, 0x29, 0x91,
+    0x46, 0x88, 0xDD, 0xBB, 0x7D, 0xAB, 0x26, 0x3B, 0xB6, 0xA7, 0x32, 0x6B, 0x25, 0xAC, 0x12, 0x4F,
+    0x6A, 0xB7, 0x8B, 0x85, 0x9C, 0xB9, 0x9C, 0x90, 0x77, 0x90, 0xFD, 0x9A, 0xCF, 0x65, 0x78, 0xC7,
+    0xC8, 0x3E, 0x22, 0x27, 0xB2, 0x53, 0x4E, 0x42, 0x64, 0x71, 0x4C, 0xF8, 0x37, 0xF2, 0x34, 0x99,
+    0xE2, 0xBB, 0x78, 0x80, 0xBC, 0xD0, 0xFC, 0x4E, 0xD2, 0x52, 0x79, 0x25, 0xEE, 0x34, 0x7D, 0x4A,
+    0x90, 0xF5, 0x66, 0x14, 0x81, 0xCB, 0x70, 0xFD, 0x47, 0xCA, 0xE5, 0x8A, 0x78, 0x32, 0x75, 0x4C,
+    0xE7, 0x79, 0x68, 0x5C, 0x3A, 0x8B, 0x12, 0x78, 0x21, 0x4B, 0xC0, 0x66, 0x0A, 0x76, 0xC1, 0x7D,
+    0x79, 0x69, 0x97, 0xDF, 0x9F, 0x5D, 0xE8, 0x1D, 0x07, 0xD9, 0xD0, 0x3F, 0x5F, 0xD0, 0xC8, 0x77,
+    0xE5, 0xD1, 0xDA, 0x86, 0xD8, 0xEC, 0xB7, 0x6D, 0x04, 0x0B, 0x10, 0x7E, 0x4F, 0x22, 0xFE, 0xBA,
+    0xFC, 0x9F, 0xA9, 0xCD, 0x2F, 0x80, 0x38, 0x96, 0x07, 0x09, 0xC8, 0xB9, 0x65, 0x25, 0x49, 0x56,
+    0xE8, 0x62, 0x72, 0xFC, 0xA2, 0x55, 0x7B, 0x54, 0x58, 0x85, 0x92, 0x81, 0x7D, 0x7B, 0xC6, 0xED,
+    0xD4, 0xE3, 0x6A, 0x9C, 0x9F, 0xD4, 0x4E, 0x03, 0xED, 0xD6, 0x3A, 0x50, 0x3A, 0x22, 0x3D, 0xA5,
+    0x6F, 0x6A, 0xDA, 0xAB, 0x08, 0x4E, 0x70, 0x3E, 0xE5, 0x9D, 0xA7, 0x85, 0xD4, 0xBE, 0xE2, 0x06,
+    0xE0, 0xFF, 0xE9, 0x6B, 0x70, 0x53, 0x5E, 0x96, 0x8F, 0xCD, 0xBF, 0x61, 0xFE, 0x4F, 0xF7, 0xEF,
+    0xCC, 0x39, 0xD9, 0xC5, 0x14, 0x32, 0x36, 0xF6, 0x05, 0x1E, 0x18, 0xE5, 0xD1, 0xF3, 0x01, 0x80,
+    0x25, 0xC7, 0x4A, 0x68, 0x12, 0x77, 0xB6, 0xAD, 0x77, 0x8E, 0x2D, 0xF2, 0x36, 0x01, 0x5B, 0x26,
+    0x61, 0x39, 0x56, 0x22, 0x4F, 0x80, 0x7A, 0x04, 0x47, 0x2C, 0x90, 0xC7, 0x3A, 0x1D, 0xF9, 0xA0,
+    0xE5, 0x71, 0xA7, 0x65, 0xFD, 0x4C, 0x62, 0x2F, 0x2C, 0xB1, 0xBF, 0x31, 0xE5, 0x29, 0x84, 0x5E,
+    0x86, 0x01, 0x67, 0xCA, 0xE0, 0xF5, 0xAF, 0xCD, 0xDE, 0xEE, 0x02, 0x81, 0xFF, 0xF4, 0x32, 0x39,
+    0x7F, 0x04, 0x51, 0xCA, 0xF5, 0x57, 0xD4, 0xC4, 0xEE, 0x23, 0x9C, 0xB0, 0x42, 0x3E, 0xA1, 0x49,
+    0xF6, 0x85, 0x48, 0x76, 0x9D, 0x1A, 0x29, 0xEC, 0xCE, 0x96, 0x1A, 0xDB, 0x04, 0xDB, 0x81, 0x03,
+    0x40, 0x2A, 0x9F, 0x53, 0xF8, 0x1E, 0xB3, 0x19, 0x4F, 0x78, 0xCF, 0xB3, 0x8B, 0x22, 0xEF, 0x89,
+    0x74, 0x8C, 0xB4, 0x91, 0xE7, 0x82, 0x85, 0xEE, 0xDB, 0x84, 0x0F, 0x0C, 0x80, 0x51, 0x86, 0x98,
+    0x8E, 0xDF, 0xED, 0xBA, 0x01, 0x5D, 0xE8, 0xA6, 0x1B, 0xDA, 0xA3, 0x85, 0x5D, 0x04, 0x3E, 0xD4,
+    0x48, 0x8D, 0xBD, 0x82, 0x4C, 0xFC, 0x7E, 0x05, 0x0F, 0x5C, 0xB2, 0xFF, 0x85, 0xDF, 0x85, 0x63,
+    0x1A, 0xB3, 0x63, 0x22, 0xBA, 0x01, 0xAD, 0x08, 0x4E, 0xDB, 0x9C, 0x8F, 0x2F, 0x28, 0x4B, 0x9C,
+    0xAF, 0xA8, 0xE8, 0xB9, 0x9F, 0x23, 0x2D, 0xF7, 0xFE, 0x96, 0xD7, 0xC2, 0xFB, 0xEB, 0xFD, 0x4A,
+    0xFC, 0xEC, 0xB7, 0x1F, 0x97, 0xC1, 0xBB, 0xEE, 0x3F, 0x94, 0xFF, 0x09, 0xBA, 0x7B, 0xFF, 0x82,
+    0xF7, 0x46, 0x2A, 0x32, 0x93, 0x08, 0x8F, 0x63, 0x76, 0x78, 0xA9, 0xB5, 0x3C, 0xE2, 0xD3, 0x33,
+    0xEC, 0x03, 0x2F, 0xC9, 0x7D, 0x04, 0x17, 0xB8, 0x0F, 0x4D, 0xA9, 0xB4, 0x5A, 0x68, 0xA6, 0xA0,
+    0x19, 0x47, 0x02, 0x2C, 0xA2, 0xC8, 0x33, 0x7B, 0xAE, 0x48, 0x18, 0xF0, 0xCE, 0xEA, 0xB8, 0xB3,
+    0x3A, 0xB4, 0xB5, 0x2D, 0x75, 0x3C, 0xB6, 0xFA, 0x53, 0x9C, 0x2A, 0x60, 0x35, 0xB1, 0xD5, 0xF7,
+    0xF2, 0x76, 0xAC, 0xB4, 0xF3, 0xB4, 0x71, 0x7B, 0x0E, 0xE3, 0x43, 0xD6, 0x0C, 0x4D, 0x90, 0x64,
+    0xD1, 0x85, 0xE1, 0x00, 0xBB, 0xF9, 0xC2, 0x50, 0xF3, 0x92, 0xC0, 0x45, 0x08, 0x4E, 0x48, 0xD8,
+    0xED, 0xD4, 0xEC, 0x90, 0x81, 0x35, 0xA2, 0x69, 0xBA, 0xF9, 0x7E, 0x8A, 0x43, 0x84, 0x3D, 0xA4,
+    0x74, 0x87, 0x5F, 0xF6, 0x05, 0x57, 0x3B, 0x6F, 0xF4, 0x12, 0x54, 0xDE, 0xDC, 0xFC, 0x83, 0x31,
+    0xCD, 0x70, 0x38, 0xD8, 0xE4, 0xEB, 0x7D, 0xC3, 0xD7, 0x7C, 0xC8, 0xD7, 0x8D, 0x10, 0x8D, 0xF9,
+    0x9F, 0x00, 0x23, 0x04, 0xE4, 0x55, 0x0A, 0x3C, 0xF9, 0x6A, 0x20, 0x7B, 0x38, 0xD4, 0x85, 0x94,
+    0xF5, 0x68, 0xDA, 0xA7, 0xD5, 0x8B, 0x14, 0x0A, 0xD4, 0x48, 0xD4, 0xC4, 0x6B, 0x34, 0xBA, 0x46,
+    0x1F, 0xC5, 0xB4, 0xBA, 0xDA, 0x9D, 0xD1, 0x9C, 0x3A, 0xC8, 0x53, 0x57, 0x0B, 0xD5, 0x77, 0xF0,
+    0x58, 0x21, 0xE9, 0x1C, 0xBA, 0xCE, 0xA8, 0x86, 0xF3, 0x5C, 0xD4, 0x5E, 0x09, 0x18, 0x3C, 0x65,
+    0x67, 0xCD, 0x87, 0xB2, 0x5D, 0xEF, 0x4B, 0x64, 0x5C, 0x63, 0xA3, 0x2E, 0xED, 0x5E, 0xFA, 0x52,
+    0xFA, 0x87, 0x1F, 0x5E, 0xE8, 0xD1, 0xAA, 0xF8, 0x94, 0x9C, 0xC5, 0x67, 0x8A, 0xFF, 0xDF, 0xE1,
+    0x29, 0xC7, 0xC2, 0x15, 0xEC, 0x3A, 0x18, 0xFC, 0x2D, 0x8C, 0xCD, 0x71, 0xFE, 0xF9, 0xEF, 0x76,
+    0xBC, 0xCF, 0xD4, 0xD1, 0x78, 0x6D, 0x7D, 0x80, 0x71, 0xBE, 0xF3, 0x78, 0x2D, 0x08, 0x92, 0x51,
+    0x78, 0x5C, 0x31, 0x0C, 0x6E, 0x65, 0x71, 0x68, 0x27, 0x6D, 0x91, 0xB8, 0x6E, 0xA1, 0xF8, 0xB8,
+    0x62, 0x2C, 0xDE, 0xAC, 0xB8, 0xDE, 0x7D, 0xA9, 0xE7, 0x91, 0xDE, 0x47, 0x15, 0xEB, 0x7D, 0x74,
+    0x4C, 0xEF, 0xB2, 0x0D, 0xEB, 0x7D, 0xB3, 0xFA, 0x7E, 0xF5, 0xFE, 0x1F, 0x95, 0x53, 0x4D, 0x6F,
+    0xD3, 0x40, 0x10, 0x7D, 0x8E, 0x0B, 0x46, 0xB5, 0x14, 0x73, 0xE0, 0x84, 0x9A, 0xF8, 0xD2, 0xA3,
+    0x4D, 0xAE, 0x46, 0x72, 0x13, 0x4B, 0xFC, 0x19, 0x84, 0x38, 0x46, 0x28, 0x95, 0xAC, 0x7A, 0x25,
+    0xFE, 0x00, 0x27, 0xB8, 0xF6, 0xDA, 0x70, 0xC9, 0x21, 0x87, 0x1C, 0xD2, 0xD8, 0x12, 0x07, 0xAE,
+    0x91, 0xF8, 0x03, 0x06, 0xF5, 0xDE, 0x45, 0x0A, 0xC8, 0xB4, 0x24, 0xCB, 0x9B, 0xED, 0x07, 0xA5,
+    0x08, 0x01, 0x9B, 0x99, 0xF1, 0xEE, 0xEC, 0xCC, 0xCE, 0x9B, 0x8F, 0xE4, 0x71, 0x1E, 0xA7, 0x71,
+    0x12, 0x27, 0x3B, 0xC9, 0xCE, 0xEE, 0x3D, 0xF8, 0x4E, 0x85, 0x76, 0x8B, 0xEC, 0x56, 0xE8, 0xB8,
+    0x0A, 0x91, 0xAB, 0xB6, 0x17, 0x6F, 0x8F, 0x42, 0x63, 0x36, 0x18, 0x05, 0xC0, 0xB0, 0x0D, 0x4C,
+    0xC8, 0xBA, 0x83, 0xC2, 0x98, 0x46, 0xD8, 0x59, 0xA6, 0x68, 0x55, 0x09, 0x79, 0x08, 0xB7, 0x9A,
+    0xC0, 0x55, 0x1A, 0x88, 0x84, 0x9C, 0xF2, 0x55, 0x68, 0xBE, 0xF7, 0x9F, 0x3F, 0xCD, 0x23, 0x5C,
+    0xD0, 0x60, 0x0E, 0x7F, 0x93, 0xA1, 0x5C, 0x21, 0x5E, 0x23, 0xEA, 0x21, 0x0A, 0x29, 0xF7, 0xE3,
+    0xE3, 0xC2, 0xAC, 0x1E, 0x2E, 0xB2, 0x0B, 0x2F, 0x3C, 0x80, 0x5D, 0x41, 0xCD, 0x43, 0x7F, 0x86,
+    0x11, 0x86, 0x11, 0x34, 0x26, 0x1D, 0x67, 0xC9, 0xD0, 0xC4, 0xA5, 0xDB, 0x7E, 0xC6, 0x1D, 0xD1,
+    0x4C, 0x3A, 0x51, 0x4F, 0x8D, 0xA2, 0xD1, 0x79, 0xDD, 0x9F, 0x7F, 0xAE, 0x75, 0xF0, 0xF1, 0x93,
+    0x60, 0x78, 0x47, 0xE1, 0x3D, 0xA9, 0x46, 0x08, 0x5C, 0x8A, 0x58, 0x70, 0xA5, 0xCE, 0x72, 0x82,
+    0x09, 0xBE, 0x6A, 0xA7, 0x46, 0x51, 0xE1, 0x7A, 0x39, 0x66, 0x09, 0x78, 0xE7, 0x2B, 0x46, 0x53,
+    0x33, 0x0A, 0xE4, 0x14, 0x19, 0x85, 0xAF, 0x1A, 0xC0, 0xFD, 0xA0, 0xC5, 0x44, 0x51, 0x6C, 0x04,
+    0xD0, 0x69, 0x16, 0x60, 0xE0, 0xD5, 0x5D, 0xE4, 0x4E, 0xB3, 0x87, 0x19, 0x0E, 0x72, 0x8A, 0x70,
+    0x05, 0x26, 0xA5, 0xD1, 0x47, 0xAF, 0x41, 0xEF, 0x7C, 0x7D, 0x00, 0xCF, 0xD4, 0xA1, 0xB2, 0xCF,
+    0xE7, 0x79, 0x9A, 0x24, 0xC9, 0xAE, 0xBC, 0x9A, 0x0A, 0x65, 0xC9, 0xD6, 0x66, 0x7F, 0x53, 0xB2,
+    0x96, 0x6B, 0x38, 0xA7, 0x70, 0xDF, 0x57, 0xC1, 0xCB, 0xDA, 0x67, 0x5E, 0xB0, 0x89, 0xA7, 0x3F,
+    0x69, 0xBC, 0x18, 0x1B, 0x63, 0x6E, 0x6A, 0x84, 0xB8, 0x98, 0xBF, 0xAF, 0x08, 0x14, 0x21, 0x10,
+    0x5B, 0xE5, 0x08, 0x20, 0x7E, 0x8D, 0x56, 0x2D, 0x97, 0x1E, 0xEF, 0x33, 0xB9, 0xEF, 0x02, 0x7B,
+    0xF6, 0x7E, 0x76, 0x95, 0xAC, 0x47, 0x2E, 0xF8, 0xA1, 0x75, 0x91, 0x5D, 0x7D, 0x70, 0x4C, 0x6D,
+    0x58, 0x4B, 0x8A, 0x3C, 0xF8, 0x54, 0xA2, 0xBC, 0xB4, 0xB5, 0xAB, 0x34, 0xE6, 0xD9, 0x78, 0x8C,
+    0x5F, 0x8E, 0x47, 0xB2, 0x3B, 0x24, 0x2F, 0xAE, 0x7D, 0xB9, 0xF1, 0xEB, 0x4B, 0x8D, 0xC4, 0x60,
+    0xF5, 0xCA, 0x4C, 0x6A, 0x63, 0x35, 0x87, 0xD7, 0xF5, 0x2E, 0x4F, 0xC4, 0xC5, 0x18, 0xC6, 0x5A,
+    0xC3, 0x5F, 0xC2, 0x5D, 0x0A, 0x7A, 0x22, 0x26, 0xD2, 0x2E, 0xCA, 0x93, 0x0E, 0x27, 0xEE, 0xAC,
+    0x69, 0x23, 0x0D, 0xB2, 0x61, 0x00, 0x21, 0x1F, 0xC3, 0x2E, 0xA6, 0x3E, 0xA6, 0x31, 0xA6, 0x01,
+    0xA6, 0x1D, 0xAC, 0xDA, 0x18, 0x86, 0x58, 0x75, 0x38, 0x8F, 0x6F, 0x8E, 0x73, 0xA4, 0xEE, 0x26,
+    0xD0, 0x2C, 0xC5, 0x7D, 0x47, 0xFA, 0x67, 0xF3, 0x5C, 0x62, 0x4B, 0x30, 0xBD, 0x9E, 0xDB, 0x58,
+    0xAB, 0xAB, 0xE0, 0x53, 0x56, 0xA9, 0xF9, 0x0F, 0x9E, 0xC1, 0xD1, 0x73, 0x72, 0x4A, 0x94, 0xBD,
+    0x2C, 0xA8, 0x82, 0x33, 0x83, 0x96, 0x69, 0xEC, 0x5B, 0xA6, 0x36, 0xB5, 0xC6, 0xDF, 0x7F, 0x62,
+    0xC7, 0xB8, 0xB9, 0x6D, 0xC6, 0x23, 0x8B, 0x30, 0xC8, 0xA4, 0x49, 0x6C, 0x15, 0x1B, 0xE6, 0x68,
+    0xDB, 0xBC, 0x99, 0x6D, 0xD4, 0x9E, 0x6D, 0x6A, 0x20, 0xC3, 0x47, 0x8B, 0x42, 0x17, 0xFF, 0x12,
+    0x40, 0x5B, 0xBB, 0xB6, 0x64, 0xCA, 0x22, 0x0E, 0x38, 0xDB, 0x2F, 0x58, 0x52, 0xAD, 0xE1, 0x30,
+    0xAE, 0x5B, 0xA5, 0xF0, 0x54, 0x0C, 0x9F, 0xAF, 0xB6, 0x59, 0xE5, 0x98, 0x1A, 0xFE, 0xBB, 0xB2,
+    0x01, 0x47, 0x4B, 0x18, 0x1C, 0xDD, 0x3E, 0x01, 0xB5, 0x14, 0xB6, 0x15, 0x0A, 0x05, 0x49, 0x5B,
+    0x40, 0xDD, 0x24, 0xB7, 0x96, 0x39, 0x91, 0x89, 0xA9, 0x6F, 0x5F, 0xD1, 0x58, 0x5C, 0xE8, 0xE8,
+    0xAB, 0xF4, 0x4F, 0x0B, 0x8F, 0x2D, 0x2E, 0x76, 0xA5, 0xF5, 0xFB, 0x03, 0x4C, 0xBE, 0xA7, 0xD0,
+    0xAB, 0xF8, 0xCC, 0xAD, 0x2B, 0x1A, 0xD3, 0x85, 0x8E, 0x2C, 0xCB, 0x1D, 0xA6, 0x56, 0x7C, 0xF3,
+    0xF0, 0xA5, 0x34, 0xC8, 0xEE, 0x36, 0xF8, 0x01, 0xBD, 0x58, 0x3D, 0x8C, 0x1B, 0xC7, 0x15, 0x7E,
+    0xBB, 0x7B, 0xA7, 0x75, 0xB4, 0x08, 0xE7, 0x0A, 0x15, 0x12, 0xA4, 0xE3, 0xA6, 0x50, 0xA1, 0xD8,
+    0x47, 0x6E, 0x73, 0x40, 0x58, 0xF0, 0x67, 0x94, 0x03, 0x5C, 0x24, 0x85, 0x2F, 0x40, 0x14, 0x17,
+    0x01, 0x6C, 0xB7, 0x11, 0xE0, 0xE8, 0x8A, 0x43, 0xC0, 0x00, 0x94, 0xB8, 0x56, 0x93, 0xC2, 0x8D,
+    0x8C, 0x20, 0xFD, 0x15, 0x29, 0x22, 0x0A, 0x88, 0x18, 0xE0, 0x10, 0x6C, 0x62, 0xEA, 0xB8, 0x92,
+    0xCA, 0x34, 0xEB, 0x04, 0x46, 0x8A, 0x14, 0x59, 0xC7, 0x45, 0x60, 0x09, 0x81, 0x07, 0xF6, 0x3A,
+    0x58, 0x9D, 0x49, 0x4E, 0xBE, 0x37, 0x4B, 0xF2, 0xEE, 0xF4, 0xE3, 0xE8, 0xA4, 0x93, 0x96, 0xFB,
+    0x86, 0xFB, 0x33, 0xF3, 0xDE, 0x37, 0x6F, 0xDE, 0xDF, 0xEC, 0xC9, 0x56, 0xEB, 0x14, 0x2D, 0x9C,
+    0x39, 0xB3, 0xB2, 0x52, 0xA9, 0x54, 0x1A, 0x8D, 0x66, 0xB3, 0xF9, 0x5D, 0xC2, 0x51, 0xE7, 0xD3,
+    0xD6, 0xA9, 0xD0, 0x2A, 0x90, 0x7C, 0xD7, 0x21, 0x8A, 0xF6, 0x9D, 0xB8, 0x6D, 0x10, 0x05, 0xE1,
+    0x3B, 0x9E, 0x56, 0xD6, 0x30, 0x2C, 0xFA, 0xCF, 0x0E, 0x7F, 0x42, 0x34, 0xD4, 0xA1, 0x95, 0x59,
+    0x64, 0xA7, 0x44, 0x76, 0x72, 0x90, 0x5E, 0xDB, 0xFD, 0x2D, 0xB5, 0x74, 0x7E, 0xE0, 0x99, 0xC3,
+    0x14, 0x13, 0x09, 0x49, 0x78, 0xA7, 0x13, 0x26, 0x70, 0xAA, 0x5D, 0x5C, 0x0E, 0xF4, 0x48, 0xC8,
+    0x6C, 0x99, 0x6A, 0x2B, 0xB4, 0x62, 0xCE, 0xBA, 0xA0, 0x6D, 0xFF, 0x7E, 0xDE, 0x18, 0xBE, 0xBB,
+    0x44, 0xAF, 0xB4, 0x21, 0xA1, 0x81, 0x91, 0x3E, 0x79, 0xA1, 0x90, 0x82, 0xDC, 0xB8, 0x0A, 0x5E,
+    0x75, 0xB2, 0x14, 0x40, 0x66, 0x8A, 0xA8, 0x99, 0xD0, 0x62, 0xF7, 0x63, 0xF2, 0xB4, 0x2E, 0x98,
+    0x0B, 0x32, 0xD7, 0xC5, 0x3D, 0xCD, 0xA9, 0x3E, 0x3B, 0xCE, 0x9A, 0x19, 0x9C, 0x9D, 0xDF, 0xF3,
+    0x9D, 0xA7, 0x93, 0xE0, 0x46, 0x5A, 0x4C, 0xB1, 0x85, 0xEE, 0x19, 0x09, 0x2D, 0xEB, 0x5E, 0xDA,
+    0x26, 0x85, 0xB3, 0x41, 0xCA, 0xFF, 0x6B, 0x6A, 0xEB, 0x90, 0xFC, 0x84, 0x6C, 0x88, 0x54, 0xD2,
+    0x52, 0x3B, 0x37, 0x92, 0x60, 0x22, 0x0D, 0xAF, 0x7A, 0xB9, 0x5E, 0x9E, 0x69, 0xE6, 0x34, 0x7A,
+    0xD1, 0x83, 0xD7, 0x73, 0x9E, 0xAB, 0x4F, 0x25, 0xBA, 0xE0, 0xC4, 0x2B, 0xAE, 0x7E, 0x2F, 0x59,
+    0x15, 0xE7, 0x65, 0x7F, 0xA3, 0x42, 0xB4, 0xD1, 0x87, 0x8C, 0x55, 0x96, 0x55, 0x33, 0x8D, 0xB9,
+    0xDD, 0x80, 0xAA, 0x57, 0x57, 0x7D, 0xA2, 0xFE, 0x8A, 0xA7, 0xC3, 0xB4, 0x44, 0xD7, 0x9D, 0xD8,
+    0x0D, 0x01, 0xDB, 0x7A, 0x60, 0x0D, 0xA0, 0x6E, 0xA3, 0xAA, 0x42, 0xF3, 0xF9, 0xA9, 0x77, 0xA9,
+    0x74, 0xEC, 0xF7, 0xD5, 0xB7, 0x6A, 0xA5, 0x5A, 0x39, 0x98, 0x2C, 0x4A, 0x0A, 0xBF, 0xE3, 0x24,
+    0x99, 0x77, 0x35, 0x0D, 0xBC, 0xB8, 0xE3, 0x53, 0xD6, 0xA0, 0xBA, 0x4F, 0xBE, 0x1B, 0x7B, 0x77,
+    0x94, 0x9D, 0x6E, 0x93, 0x5C, 0xEA, 0xF5, 0x7A, 0x7A, 0xAA, 0x8C, 0xF9, 0xE9, 0xF5, 0xB6, 0xB4,
+    0xBA, 0xB0, 0xFE, 0x58, 0xCC, 0x8B, 0x3F, 0x06, 0x66, 0xA1, 0xCF, 0x03, 0xF3, 0xE9, 0xB8, 0xBF,
+    0x21, 0x9C, 0x78, 0xA3, 0x8F, 0x66, 0x35, 0x15, 0x3F, 0x0D, 0x6B, 0xA9, 0x98, 0x00, 0xB3, 0x28,
+    0x03, 0xB3, 0x10, 0x72, 0x75, 0x55, 0xB8, 0x71, 0x7F, 0x45, 0xD8, 0x49, 0x5A, 0xFA, 0x16, 0xFD,
+    0xFA, 0xB1, 0x98, 0x5F, 0xED, 0xF5, 0xAE, 0x61, 0xB1, 0x53, 0x56, 0x73, 0x4E, 0x8D, 0x9F, 0xD3,
+    0xA6, 0x47, 0x7D, 0x57, 0xE2, 0xAC, 0x09, 0xF2, 0xC7, 0x64, 0x5D, 0x23, 0x5A, 0x29, 0x0C, 0x72,
+    0x3F, 0x0D, 0x01, 0xD9, 0xC0, 0xAE, 0x3F, 0xFA, 0x8E, 0x8F, 0xD9, 0x7B, 0x4B, 0x06, 0x79, 0xAD,
+    0x02, 0x4D, 0x97, 0xC0, 0x65, 0xDB, 0x4E, 0x3C, 0x59, 0xA1, 0xEE, 0xE4, 0xD5, 0xEB, 0x96, 0xA4,
+    0x20, 0xA7, 0xD5, 0x2A, 0xE1, 0x05, 0x2D, 0xD3, 0xF1, 0x9C, 0xBC, 0xD1, 0x9E, 0x02, 0x76, 0x6E,
+    0xD1, 0x6B, 0x8C, 0x48, 0x84, 0x01, 0x2C, 0x7D, 0x8B, 0xD6, 0xE9, 0x44, 0x46, 0x8D, 0x27, 0x9D,
+    0x80, 0x3D, 0xA2, 0xB1, 0xBE, 0xF1, 0x9F, 0xAF, 0x27, 0xCB, 0x19, 0xAC, 0xEE, 0xE0, 0x69, 0x6B,
+    0x1D, 0xFA, 0xFA, 0xEF, 0x61, 0x4B, 0x5F, 0x0D, 0xBB, 0xA0, 0xE1, 0x43, 0xC4, 0xCF, 0xF8, 0x5D,
+    0x00, 0xF2, 0x40, 0xF4, 0x26, 0xC8, 0x7E, 0x0A, 0xE2, 0xA3, 0xD9, 0x6A, 0x2E, 0x94, 0xA8, 0x0C,
+    0xB3, 0xB7, 0x93, 0x37, 0xE3, 0x1D, 0x3C, 0xB1, 0x95, 0x50, 0xF5, 0x3E, 0xA9, 0x03, 0xBF, 0x77,
+    0xF0, 0xC2, 0xCD, 0xA9, 0xFC, 0x36, 0xD5, 0x5C, 0xB9, 0xEA, 0x84, 0x38, 0x6B, 0x8E, 0x5C, 0xF1,
+    0x48, 0x40, 0xC1, 0xEB, 0xF4, 0x8A, 0x4D, 0x55, 0x11, 0x8A, 0xB5, 0x04, 0x96, 0x62, 0xA9, 0x0E,
+    0x45, 0x4D, 0xB4, 0xEE, 0x6D, 0x85, 0x27, 0x0D, 0x21, 0x17, 0x2C, 0x78, 0x13, 0xD4, 0xE4, 0x29,
+    0x28, 0xB7, 0xA1, 0x68, 0x93, 0x96, 0x98, 0x27, 0x29, 0xF6, 0x5B, 0xE5, 0x00, 0x88, 0x62, 0x27,
+    0x52, 0xCB, 0xB8, 0x54, 0x75, 0x11, 0x93, 0xEA, 0x07, 0x31, 0xFD, 0x21, 0xFD, 0x5E, 0x0C, 0x8B,
+    0xF9, 0x34, 0x26, 0xF7, 0xFB, 0x77, 0x63, 0x12, 0xEE, 0x5A, 0x4C, 0x30, 0x9B, 0x8C, 0xDA, 0xC7,
+    0x6F, 0xA4, 0x18, 0xEE, 0x00, 0x31, 0x37, 0x29, 0x98, 0x8A, 0x94, 0xB6, 0xA9, 0x91, 0x52, 0x4A,
+    0x4B, 0xA9, 0x8D, 0x20, 0x90, 0xC2, 0x50, 0x28, 0x65, 0xA6, 0x69, 0x85, 0x9B, 0x5A, 0x37, 0xA4,
+    0xF4, 0x8B, 0x5D, 0x45, 0x9F, 0x24, 0xB2, 0x4F, 0x60, 0xD9, 0x27, 0x4F, 0x12, 0x63, 0x02, 0x8F,
+    0x3A, 0x5F, 0x6F, 0x12, 0x3A, 0x2A, 0x70, 0xB1, 0x63, 0x7B, 0x77, 0xCB, 0x0D, 0x1D, 0xAD, 0x0A,
+    0x7F, 0xC8, 0xC8, 0x09, 0x7F, 0x79, 0x99, 0x3C, 0x5E, 0x67, 0x78, 0x61, 0x19, 0xDD, 0x17, 0x07,
+    0xE8, 0x27, 0x72, 0x9E, 0x42, 0x95, 0xA5, 0x09, 0x37, 0x4C, 0x49, 0x08, 0x47, 0xFD, 0xE9, 0x72,
+    0xC5, 0x53, 0xDD, 0xAC, 0xB6, 0xCC, 0x93, 0xAB, 0x29, 0xB2, 0x92, 0x3E, 0x70, 0xDE, 0x8E, 0x15,
+    0x79, 0x6B, 0x7A, 0x4C, 0x25, 0xBB, 0x97, 0xB3, 0x79, 0xB1, 0x06, 0xD0, 0x9C, 0x34, 0xB1, 0x00,
+    0xE7, 0x29, 0x23, 0x69, 0x81, 0xCD, 0x88, 0x2D, 0xB5, 0x43, 0x56, 0x46, 0x6E, 0x42, 0xBE, 0xE4,
+    0x08, 0x89, 0x38, 0xD9, 0x36, 0x6D, 0xEB, 0x7C, 0xDF, 0xD7, 0x99, 0xBD, 0x53, 0xC4, 0x84, 0x26,
+    0x15, 0xD1, 0xC8, 0x8D, 0x79, 0x7E, 0x85, 0xC9, 0x72, 0xF8, 0xF3, 0x70, 0x2D, 0x20, 0xBE, 0xBC,
+    0x8D, 0xF8, 0xDA, 0xE6, 0xB0, 0x84, 0x68, 0x8B, 0xA9, 0x65, 0x3E, 0xD6, 0x40, 0x48, 0x3B, 0xF5,
+    0x42, 0xE7, 0xDE, 0x8D, 0xD8, 0x45, 0x74, 0x14, 0xBF, 0xF9, 0x89, 0x42, 0x48, 0x50, 0x30, 0xE1,
+    0x88, 0xE3, 0x33, 0x47, 0x64, 0x98, 0x5B, 0x50, 0x30, 0xBB, 0x0C, 0xCA, 0xC9, 0x84, 0x5F, 0x47,
+    0x1E, 0x3D, 0x7F, 0x2F, 0x31, 0xBA, 0xA5, 0x0E, 0xDE, 0xA4, 0xDE, 0xD1, 0xF2, 0x87, 0xBD, 0xD1,
+    0x70, 0x4D, 0x5A, 0xF7, 0xE1, 0xBD, 0x61, 0xFB, 0xE8, 0xB1, 0xB7, 0xB1, 0x2C, 0xED, 0xCA, 0x3C,
+    0x59, 0x1D, 0x19, 0x6F, 0x4B, 0x16, 0x3C, 0xCE, 0xD5, 0x10, 0xB7, 0xCF, 0xC1, 0x1C, 0xB6, 0x0B,
+    0xBE, 0x47, 0x82, 0x3B, 0x30, 0xF9, 0xB0, 0x08, 0x94, 0x51, 0xCE, 0xB0, 0x55, 0xC6, 0xDE, 0x9E,
+    0x66, 0x66, 0x06, 0xDC, 0x7A, 0x61, 0x66, 0xAC, 0xEA, 0xC1, 0x05, 0xC4, 0x36, 0x04, 0xBF, 0x18,
+    0xF6, 0x37, 0xE9, 0x85, 0x74, 0xA5, 0xC7, 0xCF, 0x35, 0x5C, 0x8F, 0xAC, 0xAF, 0x2E, 0x64, 0x26,
+    0xD7, 0x66, 0xC6, 0xF4, 0x32, 0x8E, 0x70, 0xDC, 0xFA, 0xFC, 0x3E, 0x6D, 0x9A, 0xB6, 0xF0, 0x1B,
+    0x7D, 0xCD, 0xD2, 0x5A, 0xB9, 0x19, 0x5D, 0x83, 0x43, 0x1B, 0xC5, 0x35, 0xA7, 0xC1, 0xB5, 0xF3,
+    0x18, 0x82, 0x46, 0x4D, 0x1F, 0x3F, 0x2C, 0xA6, 0x6B, 0xEB, 0x9B, 0x09, 0x5D, 0x02, 0x82, 0x59,
+    0x6A, 0xB7, 0xA2, 0x62, 0xF4, 0x22, 0xFE, 0x85, 0x11, 0xE1, 0x16, 0xB9, 0x12, 0xF7, 0x67, 0xF8,
+    0xB6, 0xAB, 0xB3, 0xA1, 0xCE, 0xA2, 0x83, 0x45, 0xC6, 0xAD, 0x0B, 0xEB, 0x43, 0xAD, 0x76, 0x7A,
+    0x5B, 0x0F, 0x3D, 0x8F, 0x38, 0xBE, 0x73, 0x7F, 0x63, 0x8A, 0x9C, 0x95, 0x18, 0xC1, 0xC6, 0xF3,
+    0xF1, 0x19, 0x01, 0x35, 0x79, 0xBF, 0x8A, 0x97, 0xAD, 0xF4, 0x79, 0xF8, 0x88, 0xB5, 0xD8, 0x5B,
+    0x8B, 0x0B, 0xCB, 0x7A, 0x56, 0x26, 0x03, 0x28, 0x1B, 0x86, 0x01, 0x65, 0xE2, 0x41, 0x8A, 0xB2,
+    0xE6, 0x89, 0xBF, 0x4B, 0xA9, 0x11, 0x9A, 0xDB, 0xCA, 0x8D, 0x4B, 0xF4, 0xD4, 0xFD, 0x5D, 0xC5,
+    0x01, 0xB0, 0xD1, 0xA0, 0xBE, 0xF1, 0xDD, 0xD6, 0x98, 0x93, 0x21, 0xD6, 0xE9, 0x29, 0xCF, 0xD3,
+    0x39, 0x0F, 0xD9, 0xAB, 0x6C, 0x5A, 0xE3, 0x20, 0x77, 0x92, 0x27, 0xFF, 0x4E, 0xE7, 0xAD, 0xB1,
+    0xAB, 0x3F, 0x83, 0x5C, 0xB6, 0x62, 0x37, 0x3E, 0x9D, 0xB1, 0xF5, 0x0D, 0xB8, 0x69, 0x71, 0xE3,
+    0x73, 0x23, 0x24, 0x37, 0x48, 0x85, 0xB1, 0x87, 0x9C, 0x98, 0x78, 0xA1, 0xC7, 0xB7, 0xB3, 0x17,
+    0xFE, 0xBC, 0x33, 0x0F, 0x83, 0x5D, 0x16, 0xAC, 0xF4, 0x03, 0x88, 0x5F, 0x42, 0xC0, 0xD0, 0x1E,
+    0x39, 0xFF, 0x98, 0x20, 0xD6, 0x45, 0xB3, 0xF0, 0xB7, 0x39, 0x84, 0x4E, 0x51, 0x99, 0x46, 0x1F,
+    0xC6, 0x14, 0xFD, 0x51, 0x51, 0xB4, 0x9D, 0x81, 0x90, 0xDC, 0xB6, 0x5B, 0x14, 0x45, 0x42, 0x46,
+    0x91, 0x17, 0x47, 0x91, 0x93, 0x46, 0x11, 0x65, 0xA0, 0x41, 0x3B, 0xA2, 0x26, 0xC8, 0xC7, 0xB5,
+    0x97, 0x47, 0xE4, 0x80, 0xAC, 0xBC, 0x58, 0x47, 0xC1, 0xC9, 0xD6, 0x84, 0x6A, 0xCB, 0xA4, 0x95,
+    0xCD, 0x59, 0xE8, 0x08, 0xB4, 0x24, 0xF6, 0x13, 0x72, 0x53, 0x6B, 0xC4, 0xDD, 0x9A, 0xEC, 0x06,
+    0x3E, 0x5B, 0xA3, 0x08, 0xEB, 0x6C, 0x9B, 0x1D, 0x1E, 0xF8, 0x68, 0xE3, 0xC5, 0x8D, 0xA2, 0xBA,
+    0x40, 0x67, 0x24, 0x8A, 0x26, 0xBC, 0xC6, 0x62, 0x03, 0xBC, 0x09, 0xFE, 0x97, 0x74, 0x48, 0xFB,
+    0x0F, 0x13, 0xB5, 0xD8, 0xC3, 0xD8, 0x53, 0x91, 0x94, 0x5E, 0xA6, 0x70, 0xC7, 0x04, 0x16, 0x54,
+    0x46, 0x54, 0xF6, 0xB9, 0x1C, 0x77, 0xC2, 0x97, 0x23, 0x7C, 0x91, 0x78, 0x1F, 0xF0, 0x11, 0x54,
+    0xFE, 0x0B, 0x44, 0x11, 0xDA, 0xAA, 0xBE, 0xCC, 0x49, 0x57, 0xB9, 0xF2, 0xA8, 0x88, 0x83, 0x8B,
+    0xF0, 0xA2, 0xE5, 0xD6, 0x68, 0xB9, 0x49, 0x1D, 0xF1, 0x9E, 0x72, 0xFE, 0x1D, 0x13, 0xEA, 0xDA,
+    0x1D, 0x88, 0x0B, 0xDD, 0xBB, 0xA9, 0x4F, 0x39, 0xAA, 0xAE, 0x25, 0xAE, 0x2F, 0x98, 0x82, 0xC9,
+    0x5B, 0x8C, 0x63, 0x34, 0xC3, 0x61, 0x4F, 0x80, 0xC3, 0xF9, 0x27, 0x70, 0x88, 0x37, 0x80, 0xA3,
+    0xCA, 0x38, 0x3A, 0x2C, 0x18, 0x01, 0xA1, 0x63, 0x27, 0x68, 0x5C, 0xF8, 0x50, 0x47, 0x30, 0x8E,
+    0x06, 0xE3, 0x88, 0x18, 0x87, 0x9A, 0xE1, 0xF0, 0x18, 0x87, 0xCF, 0x38, 0x16, 0xE6, 0x48, 0x46,
+    0x53, 0x73, 0x63, 0x05, 0x4C, 0xD7, 0x1B, 0x99, 0x4B, 0xE5, 0x87, 0x20, 0xB8, 0x8E, 0x1A, 0x80,
+    0xEA, 0x88, 0x16, 0x81, 0x14, 0xB1, 0xD8, 0xD5, 0x98, 0x72, 0xBE, 0x4F, 0x9F, 0xB8, 0x76, 0x10,
+    0x67, 0xB9, 0xD0, 0x2B, 0xD1, 0x8B, 0x91, 0xC1, 0xC9, 0xA8, 0x95, 0x98, 0x44, 0x69, 0x87, 0x2B,
+    0x2F, 0x44, 0x86, 0xD9, 0x65, 0xAA, 0x68, 0x7E, 0x7F, 0xF4, 0x7A, 0xCA, 0x1E, 0xD1, 0x13, 0x8F,
+    0xE9, 0xA0, 0x7F, 0x15, 0x4B, 0x2A, 0x10, 0x1C, 0x3D, 0xD8, 0x16, 0xEF, 0x78, 0xED, 0xD9, 0x8E,
+    0xF7, 0x0A, 0xFA, 0xB7, 0xE2, 0x62, 0xFE, 0xFB, 0x76, 0xB8, 0x0F, 0x53, 0x7B, 0x9E, 0x75, 0xEE,
+    0x49, 0x24, 0xA4, 0xE8, 0xD8, 0x08, 0x01, 0x30, 0x22, 0x36, 0x10, 0xD3, 0xE2, 0x7A, 0x64, 0x12,
+    0x52, 0xB8, 0x3F, 0x45, 0x15, 0xDB, 0xE1, 0x90, 0x5A, 0x9F, 0x67, 0x88, 0xC4, 0x03, 0xE0, 0xAB,
+    0x83, 0x3A, 0x20, 0xFC, 0x90, 0xD3, 0x33, 0x54, 0xB5, 0x59, 0xD5, 0x14, 0x37, 0xB8, 0xC6, 0xBD,
+    0x93, 0xE3, 0xCD, 0x0E, 0xC8, 0x97, 0x99, 0x29, 0x51, 0x40, 0x48, 0x44, 0xD9, 0x9F, 0x87, 0x94,
+    0x75, 0x47, 0xF3, 0x38, 0xA3, 0xCC, 0x54, 0xEB, 0xB3, 0x59, 0x5E, 0x94, 0x42, 0xAB, 0xD2, 0xF9,
+    0xDC, 0x94, 0x17, 0xBC, 0xF1, 0xB6, 0xF5, 0x28, 0xB8, 0x37, 0xB8, 0x4C, 0x75, 0x94, 0xE0, 0x90,
+    0x3C, 0xB0, 0x46, 0xDD, 0x9B, 0x03, 0x7F, 0xBC, 0x32, 0x1D, 0x0F, 0xC9, 0xF0, 0xC9, 0x2A, 0xBB,
+    0xD1, 0xB3, 0x0C, 0x67, 0x67, 0x93, 0xCE, 0xDD, 0xA4, 0x84, 0x9D, 0xC5, 0x61, 0x87, 0xCB, 0x25,
+    0x2F, 0x5B, 0x2D, 0x75, 0xD5, 0x49, 0x37, 0x7C, 0x06, 0xD1, 0xEE, 0x9D, 0xC4, 0xBD, 0x3A, 0x0B,
+    0xE9, 0x87, 0x1A, 0x7B, 0x02, 0x49, 0x8F, 0xEC, 0xBB, 0xA1, 0x7D, 0x35, 0xB6, 0xEE, 0x4B, 0x53,
+    0xF0, 0x1F, 0x8E, 0x83, 0x75, 0x9D, 0x7E, 0x86, 0x42, 0xEF, 0x6F, 0x3A, 0x29, 0xBF, 0xAE, 0xAF,
+    0x42, 0xFB, 0x13, 0xAC, 0x27, 0xCE, 0x3A, 0x37, 0x8D, 0x63, 0xD8, 0x3D, 0x8F, 0x83, 0xCF, 0x26,
+    0xBD, 0xDF, 0x75, 0xF8, 0x71, 0xCE, 0x4D, 0x46, 0xC8, 0xFA, 0x11, 0xCA, 0xA4, 0x85, 0xEE, 0xCD,
+    0xF7, 0x77, 0x73, 0x7F, 0x6C, 0x17, 0xA5, 0x13, 0xCB, 0x75, 0xB5, 0x12, 0x1F, 0x6F, 0x35, 0xE9,
+    0xE1, 0x6F, 0x45, 0xD3, 0x0F, 0x45, 0x30, 0xB9, 0x5D, 0x65, 0xEB, 0x74, 0xFA, 0xA1, 0x08, 0x91,
+    0x10, 0xEA, 0x7A, 0x5B, 0x5A, 0xE3, 0xC7, 0xAF, 0xBE, 0xAB, 0x53, 0xF1, 0x41, 0xDE, 0xA4, 0x06,
+    0x42, 0x5A, 0x87, 0x02, 0xEC, 0xE6, 0x77, 0x7A, 0xBD, 0x3D, 0x6E, 0x72, 0x41, 0xEC, 0x0E, 0xAC,
+    0xB9, 0xA3, 0xC0, 0x43, 0xB0, 0xFA, 0xE5, 0xBD, 0xD5, 0x3F, 0xDC, 0xF0, 0x2B, 0xD3, 0xD5, 0x3F,
+    0x3E, 0x5B, 0xFD, 0x43, 0x0D, 0x77, 0xEF, 0xA4, 0xCE, 0x9D, 0x94, 0xE8, 0x19, 0x44, 0x07, 0x80,
+    0x8D, 0xDD, 0xC7, 0x16, 0xD6, 0x42, 0x3E, 0xB9, 0x7A, 0xE2, 0xF9, 0x79, 0xB1, 0x6F, 0x26, 0x77,
+    0x02, 0x4C, 0x9E, 0xF4, 0x63, 0x2C, 0xE9, 0x81, 0xBA, 0x0E, 0x3B, 0x92, 0xA7, 0xAC, 0xE8, 0xF6,
+    0x6A, 0xB9, 0x6F, 0x46, 0xC2, 0xBB, 0x55, 0x6C, 0x7C, 0xC7, 0x70, 0xDC, 0x00, 0xB7, 0xC3, 0x14,
+    0x6B, 0x87, 0x95, 0x93, 0xBC, 0x09, 0xA8, 0x92, 0xB5, 0xF3, 0x06, 0x7F, 0x58, 0x93, 0x81, 0xEC,
+    0x22, 0x17, 0x89, 0xB0, 0x83, 0x10, 0x15, 0x21, 0x0D, 0x82, 0x10, 0x44, 0x3C, 0x7E, 0x26, 0x39,
+    0x6F, 0x8A, 0x7B, 0x9C, 0x01, 0x0B, 0x9D, 0x59, 0x72, 0x49, 0x64, 0x1B, 0x95, 0xA1, 0x3A, 0xEB,
+    0xB1, 0xFF, 0xAC, 0x5F, 0x94, 0x5F, 0x68, 0xA5, 0x7F, 0x34, 0x1A, 0xB1, 0xC9, 0x36, 0xBE, 0xE1,
+    0xAB, 0x8B, 0x19, 0xCC, 0xE6, 0x37, 0x30, 0xB2, 0x89, 0xBC, 0xF9, 0x1A, 0xA0, 0x2E, 0xCC, 0x48,
+    0x7C, 0x70, 0xCB, 0x24, 0x69, 0x16, 0x0A, 0x20, 0x06, 0x40, 0x64, 0x00, 0x79, 0x00, 0x26, 0x42,
+    0x64, 0x43, 0xBC, 0x6D, 0x19, 0x30, 0x96, 0x4E, 0xF7, 0x42, 0x6E, 0x8B, 0xEB, 0x68, 0x6C, 0x5D,
+    0xFE, 0x95, 0x92, 0x2B, 0xDB, 0xCF, 0xCF, 0x53, 0x2E, 0x90, 0x33, 0x3E, 0x43, 0xDE, 0xA5, 0x9C,
+    0xBE, 0x6D, 0xA7, 0x47, 0x82, 0xD1, 0x49, 0x94, 0xA1, 0xF9, 0xF1, 0x3C, 0xFC, 0x4E, 0x4E, 0xF3,
+    0x7D, 0xA3, 0x08, 0x2A, 0x7C, 0xF4, 0x7A, 0xBD, 0xE2, 0xEB, 0xDA, 0xEC, 0xA8, 0x4F, 0x3F, 0x29,
+    0xCC, 0xBE, 0xF1, 0x5E, 0xFC, 0x01, 0x17, 0xE0, 0xE4, 0x1B, 0x79, 0x43, 0xAA, 0x5B, 0x9F, 0xCB,
+    0x8E, 0xF3, 0x97, 0x30, 0x12, 0x3F, 0x0C, 0x23, 0xD4, 0x20, 0x51, 0x07, 0xF2, 0x14, 0x8A, 0xF9,
+    0x04, 0xF2, 0xC2, 0x42, 0x5E, 0x13, 0xF2, 0x4E, 0xCC, 0xF2, 0x66, 0x36, 0xDD, 0x38, 0xB2, 0xC9,
+    0xB9, 0xC5, 0xF7, 0x89, 0x13, 0x28, 0xFA, 0x18, 0xF7, 0xFF, 0xA3, 0x06, 0x82, 0x07, 0xE6, 0x20,
+    0xFD, 0x7B, 0x1A, 0xCE, 0xF6, 0xBE, 0x9C, 0x63, 0xE4, 0xED, 0x24, 0xDB, 0x28, 0x7F, 0x57, 0x59,
+    0xA6, 0xA3, 0xE1, 0xD9, 0xC2, 0xE5, 0x10, 0xB6, 0xF0, 0x09, 0x0A, 0x3F, 0x59, 0x3B, 0x12, 0x9E,
+    0x36, 0xD6, 0xCD, 0xDE, 0xB7, 0x76, 0xCF, 0x8D, 0x91, 0xA3, 0xA7, 0x17, 0x17, 0x79, 0xFD, 0x5C,
+    0xF1, 0x68, 0x9D, 0x16, 0xB1, 0x11, 0xE2, 0x71, 0x5C, 0xA1, 0x56, 0x4D, 0x3B, 0xB3, 0x08, 0x27,
+    0x86, 0xED, 0x7C, 0xA4, 0xC8, 0xFA, 0x14, 0xBA, 0xFA, 0x12, 0xE3, 0x3E, 0x0C, 0x0B, 0x9B, 0x6F,
+    0x4D, 0x6D, 0xA0, 0x6E, 0x8A, 0x0C, 0xB3, 0xD5, 0x19, 0xB2, 0x8F, 0xCB, 0x47, 0x3E, 0x69, 0x66,
+    0x17, 0xE5, 0x7F, 0xE1, 0xA4, 0xE7, 0xE1, 0xA4, 0x8D, 0x9C, 0xAA, 0x19, 0x7F, 0x0A, 0x9A, 0x9E,
+    0x39, 0x05, 0x58, 0x6A, 0x64, 0x92, 0xAF, 0xEF, 0x67, 0x5F, 0xE9, 0xE4, 0xD1, 0xCF, 0xA1, 0x06,
+    0xF1, 0x6D, 0x65, 0x68, 0x76, 0x1C, 0x35, 0xDC, 0xFF, 0x01, 0xBD, 0x5A, 0x3D, 0x6C, 0x1C, 0xC7,
+    0x15, 0x7E, 0xBB, 0x43, 0x6A, 0x1D, 0x2D, 0xC0, 0x21, 0x10, 0x1A, 0x01, 0xC2, 0x58, 0xAB, 0x32,
+    0x08, 0xC4, 0xBB, 0x14, 0x2A, 0x14, 0xE0, 0x96, 0x3B, 0x09, 0x90, 0xB8, 0x30, 0x10, 0x5F, 0x00,
+    0xD3, 0x5D, 0xA0, 0x26, 0x45, 0xAC, 0xC2, 0x74, 0xA1, 0x82, 0x01, 0x8E, 0xBA, 0x05, 0x5C, 0xA4,
+    0x70, 0x61, 0xA9, 0x50, 0x1D, 0x97, 0x31, 0x83, 0x80, 0x2C, 0x08, 0x63, 0x01, 0x1D, 0x79, 0x6B,
+    0x3B, 0x80, 0x8A, 0x14, 0x59, 0x3B, 0x10, 0x52, 0x18, 0x88, 0x17, 0xB0, 0x53, 0x84, 0x29, 0xB2,
+    0x89, 0xD6, 0xD6, 0x46, 0xB9, 0xBB, 0xC9, 0xF7, 0x66, 0xF7, 0x8E, 0x3F, 0x22, 0xC5, 0x3B, 0xF2,
+    0x98, 0xBD, 0x79, 0xC3, 0xBB, 0xD9, 0xF9, 0xF9, 0xE6, 0xCD, 0x9B, 0xF7, 0x33, 0x43, 0xEA, 0x0E,
+    0x88, 0x98, 0xF8, 0x11, 0x31, 0x91, 0x9B, 0x12, 0xC9, 0x8C, 0xE8, 0xCA, 0x36, 0x91, 0xBF, 0x46,
+    0xD4, 0x68, 0x10, 0x45, 0x4B, 0x44, 0xB9, 0x47, 0x56, 0x26, 0x95, 0x9D, 0xBA, 0xA1, 0xD8, 0xFB,
+    0x5D, 0xEC, 0x68, 0x9D, 0xC8, 0xFB, 0xAF, 0x67, 0x1E, 0x51, 0x56, 0x43, 0x0D, 0xD4, 0x6A, 0xB5,
+    0xD0, 0x22, 0x27, 0xAA, 0xBB, 0x3A, 0x45, 0xE2, 0x0E, 0x6F, 0x29, 0xA9, 0xB3, 0xB9, 0x1F, 0x16,
+    0x78, 0x89, 0x9E, 0x90, 0x6C, 0xDD, 0xAB, 0xEF, 0x75, 0xD6, 0xA9, 0x51, 0x50, 0x23, 0xA7, 0x4E,
+    0xC7, 0xEA, 0xB5, 0x37, 0x3B, 0x5E, 0xFF, 0x1A, 0x57, 0x56, 0xB3, 0xE8, 0x6B, 0x8E, 0xA8, 0xDD,
+    0x2B, 0x51, 0x4C, 0x11, 0xD1, 0x2C, 0x35, 0x5D, 0x4A, 0x85, 0x8E, 0x69, 0x97, 0x26, 0xC6, 0x35,
+    0x25, 0x0C, 0x64, 0x46, 0xA2, 0x2D, 0x10, 0x4F, 0x0E, 0x9D, 0x91, 0x06, 0xBD, 0x38, 0x09, 0x98,
+    0x1B, 0xDC, 0xD6, 0x4A, 0xC8, 0x42, 0x0F, 0x58, 0xB3, 0x85, 0x92, 0x49, 0x01, 0x99, 0xA6, 0xDC,
+    0xA5, 0x1D, 0x97, 0x45, 0x9E, 0xBE, 0x6B, 0x69, 0x9D, 0x39, 0x39, 0xDD, 0x95, 0x71, 0x39, 0xF8,
+    0x72, 0x05, 0xA0, 0x75, 0x0C, 0xF9, 0x54, 0xD6, 0xF1, 0xC2, 0x72, 0xAA, 0xB6, 0xDE, 0x4C, 0x68,
+    0x55, 0x57, 0x9D, 0x81, 0x05, 0x29, 0xC9, 0x90, 0xAE, 0x18, 0x00, 0x86, 0x7D, 0x8E, 0xCE, 0xE4,
+    0xA3, 0xF7, 0x96, 0x4D, 0x8F, 0xE8, 0x20, 0x1A, 0xA6, 0x96, 0xE9, 0x0B, 0x5D, 0xC9, 0xA7, 0x99,
+    0xAD, 0xD3, 0x51, 0x7B, 0x40, 0x93, 0x58, 0xD6, 0x1A, 0x98, 0x72, 0xDB, 0x51, 0x17, 0x01, 0xF1,
+    0x0E, 0x59, 0x5A, 0x89, 0x8F, 0x93, 0x39, 0xC3, 0xE1, 0x09, 0x21, 0x02, 0x91, 0x9D, 0x96, 0x44,
+    0x6A, 0xFA, 0x1C, 0x9C, 0x31, 0xEF, 0x7D, 0xF3, 0xE5, 0x2C, 0xEC, 0x5B, 0x73, 0x15, 0xD5, 0xF1,
+    0xC2, 0x2D, 0x2A, 0x8C, 0x53, 0x67, 0x9F, 0x54, 0x99, 0xF8, 0x4B, 0xCC, 0x02, 0xB9, 0x7E, 0x26,
+    0x88, 0x22, 0x41, 0xF9, 0x57, 0x58, 0xE5, 0x00, 0x3D, 0x7A, 0x25, 0x0B, 0xDB, 0x83, 0xBB, 0xD4,
+    0xD5, 0x7D, 0x8A, 0xAC, 0xAE, 0x8A, 0xC8, 0x4D, 0x22, 0x88, 0x41, 0x84, 0xED, 0x82, 0x4E, 0x72,
+    0x50, 0xC1, 0xFD, 0x55, 0x54, 0x94, 0x65, 0xFC, 0x8E, 0xEB, 0xB8, 0x71, 0x44, 0x6D, 0xC5, 0x6D,
+    0xBB, 0xFA, 0x2E, 0xA3, 0x7B, 0x95, 0xB3, 0x9F, 0x72, 0xF6, 0x73, 0xCE, 0x7E, 0x69, 0x10, 0x13,
+    0xBD, 0x81, 0xCC, 0xD1, 0x9F, 0x2B, 0xF2, 0xEE, 0x69, 0x85, 0xE9, 0x07, 0x0A, 0xF0, 0x3C, 0xCE,
+    0xF0, 0x22, 0x3A, 0x9C, 0x99, 0xB2, 0x06, 0xBF, 0x0D, 0xB8, 0x9E, 0xDC, 0x43, 0x0B, 0x5B, 0xBF,
+    0x53, 0xAD, 0xB6, 0xA3, 0xFF, 0xCE, 0x99, 0x4E, 0xC8, 0x89, 0x17, 0x73, 0x64, 0xD4, 0xE1, 0x2C,
+    0xE0, 0xCC, 0xE3, 0x4C, 0x2A, 0xCE, 0xC2, 0x40, 0xC7, 0x6E, 0xD8, 0xD6, 0x89, 0x1B, 0xBA, 0xFC,
+    0x73, 0xF8, 0xC2, 0x1B, 0x55, 0xE6, 0x66, 0x58, 0x93, 0xB2, 0x2B, 0xFD, 0x1F, 0xAA, 0x90, 0x82,
+    0x02, 0x9D, 0x19, 0xE2, 0xEF, 0x00, 0xCE, 0xB8, 0xBD, 0xFB, 0x5A, 0x31, 0x6A, 0x06, 0xCD, 0xF8,
+    0xA2, 0x03, 0xC4, 0xBF, 0x19, 0x2E, 0xA3, 0x65, 0xB0, 0x43, 0xAC, 0x12, 0x1A, 0x06, 0x7D, 0x83,
+    0xBD, 0x3A, 0xEF, 0xEA, 0x3C, 0x3A, 0xB0, 0x34, 0x48, 0x3B, 0x2B, 0xCD, 0xAE, 0xCE, 0x76, 0x37,
+    0xDE, 0x3B, 0x52, 0x8E, 0xD4, 0x35, 0xF5, 0x5D, 0x9D, 0x8D, 0x74, 0xB3, 0xA3, 0x53, 0x79, 0xAF,
+    0x58, 0x26, 0xBF, 0x41, 0xB5, 0x16, 0xD5, 0xBB, 0x5A, 0xEF, 0x6E, 0x6C, 0xEC, 0x2F, 0xB1, 0x9A,
+    0x91, 0x4F, 0x3B, 0x96, 0x86, 0xCC, 0xD1, 0x0B, 0xA4, 0xE6, 0xAC, 0xC4, 0xD5, 0xA1, 0xB5, 0x43,
+    0x67, 0x1E, 0x7A, 0x96, 0xE6, 0x5D, 0xCA, 0x0E, 0x2A, 0xE1, 0xF1, 0x01, 0xD0, 0x3C, 0x81, 0xB5,
+    0x9C, 0xE6, 0xCF, 0x0E, 0xE0, 0xB8, 0x7D, 0x38, 0x2E, 0x80, 0x33, 0x8E, 0x08, 0x7D, 0x0C, 0x75,
+    0x27, 0x89, 0x13, 0xC4, 0xC2, 0x6A, 0x8E, 0x3D, 0x68, 0x0F, 0xBB, 0x81, 0x9B, 0x0B, 0x93, 0x6C,
+    0x28, 0xCF, 0xD7, 0x00, 0xE3, 0x8A, 0x9D, 0x3A, 0x7F, 0x0C, 0xED, 0x81, 0x61, 0xC5, 0x99, 0x51,
+    0x1D, 0xBF, 0xDF, 0xC7, 0x5E, 0x0B, 0x7E, 0x2C, 0x7C, 0x73, 0xFA, 0xE8, 0x08, 0xD2, 0xFC, 0xDD,
+    0xCA, 0xEA, 0x2C, 0xEA, 0x2F, 0x49, 0xEB, 0x9E, 0x28, 0xE8, 0x17, 0xC7, 0xAB, 0xA4, 0x17, 0x5F,
+    0x6B, 0x51, 0xD0, 0x6F, 0xD1, 0xB7, 0x77, 0xB8, 0x57, 0x5E, 0x0A, 0xD4, 0xF1, 0x61, 0x59, 0x7C,
+    0xF0, 0xC6, 0xB7, 0xF4, 0x3F, 0xFA, 0x54, 0xDF, 0x1F, 0xC2, 0xD8, 0x35, 0x1D, 0x92, 0xF8, 0x34,
+    0x25, 0x57, 0xDD, 0x2E, 0xCB, 0xDE, 0xB0, 0xB0, 0xAD, 0x3E, 0x53, 0xBC, 0xE1, 0xC7, 0xDF, 0x39,
+    0xEF, 0x2A, 0xB3, 0x00, 0x86, 0x3C, 0x58, 0xCD, 0x3B, 0x66, 0x18, 0x97, 0x75, 0xCB, 0x02, 0xF4,
+    0xFD, 0x35, 0x30, 0x58, 0x82, 0x15, 0x76, 0x35, 0xF4, 0x14, 0xE7, 0x61, 0xD1, 0x55, 0x08, 0xC0,
+    0x16, 0x09, 0xDE, 0x73, 0xBB, 0xEA, 0x62, 0xE6, 0x60, 0xF6, 0x44, 0x5E, 0xD1, 0xFC, 0xD4, 0xE7,
+    0x60, 0x76, 0x0B, 0x37, 0xAE, 0xD1, 0x70, 0xE7, 0x5C, 0xC0, 0x1C, 0xA6, 0x2D, 0x3F, 0xBC, 0x5B,
+    0xB6, 0x4B, 0xA7, 0x08, 0x0E, 0x13, 0x59, 0x15, 0xEF, 0x5D, 0x10, 0x7C, 0x4C, 0x5A, 0xAA, 0x3A,
+    0xBE, 0xA8, 0xB9, 0x78, 0x98, 0x40, 0x80, 0x35, 0xCF, 0x59, 0x07, 0x2C, 0x95, 0x56, 0x1C, 0x60,
+    0xA2, 0x13, 0x68, 0x67, 0x65, 0x25, 0xC3, 0x96, 0xC3, 0xAE, 0xDD, 0x38, 0xB1, 0xCE, 0x90, 0x8C,
+    0xBD, 0x62, 0x3B, 0x52, 0x94, 0x4C, 0xD8, 0x72, 0x47, 0x3B, 0x06, 0x76, 0xF8, 0x38, 0x7A, 0x9F,
+    0xC4, 0x67, 0x3A, 0x16, 0xFD, 0x97, 0x33, 0x38, 0x62, 0x19, 0x9C, 0xB9, 0x1C, 0xE5, 0xA7, 0x92,
+    0x13, 0x62, 0x72, 0xEE, 0x28, 0xD3, 0x78, 0x72, 0x93, 0xED, 0x97, 0xB9, 0x8F, 0x56, 0x6E, 0x62,
+    0xCE, 0x5A, 0x93, 0xBB, 0xB7, 0xB1, 0x79, 0xA0, 0xF2, 0xF3, 0xB3, 0xCA, 0x22, 0x42, 0x1D, 0x25,
+    0xA0, 0x74, 0xF4, 0x5B, 0xDE, 0xEC, 0x93, 0xEC, 0x76, 0x43, 0x99, 0xBA, 0xB1, 0x8C, 0x45, 0x22,
+    0x43, 0x90, 0x7A, 0x3E, 0x59, 0x34, 0xEF, 0xA5, 0xE9, 0x0F, 0x74, 0xF2, 0xFD, 0x45, 0x65, 0xCC,
+    0xA3, 0x72, 0x07, 0x66, 0x27, 0x8C, 0x97, 0x2E, 0x0D, 0xB8, 0xC9, 0x91, 0x4E, 0xA8, 0x39, 0x6E,
+    0xF3, 0xB6, 0x6E, 0x43, 0x71, 0x04, 0xFD, 0x7A, 0x21, 0x92, 0x93, 0x3F, 0x8B, 0x45, 0xD0, 0x2F,
+    0x6B, 0x5A, 0xEA, 0xE4, 0x5A, 0x4D, 0x9B, 0xDE, 0x72, 0xD1, 0x57, 0x15, 0xFC, 0xE0, 0x4B, 0xBD,
+    0xE0, 0x05, 0x1C, 0x33, 0x2D, 0x16, 0xDC, 0xE4, 0x48, 0x27, 0x10, 0xFB, 0x31, 0x9B, 0xC3, 0x32,
+    0xA4, 0x52, 0x9D, 0xFC, 0x59, 0x4D, 0x75, 0x6E, 0x25, 0x22, 0x74, 0xA1, 0x8B, 0xB1, 0xDB, 0x9A,
+    0x16, 0x71, 0xA9, 0x85, 0x31, 0x66, 0xE9, 0xE4, 0x56, 0x73, 0xD8, 0x64, 0x37, 0x20, 0xF9, 0x41,
+    0x3C, 0xAB, 0xF6, 0x5B, 0x8C, 0x33, 0x56, 0x33, 0x3F, 0xF8, 0xE8, 0x5C, 0x12, 0xDA, 0x70, 0x0F,
+    0x67, 0xA2, 0x55, 0xB4, 0xE5, 0x3E, 0x78, 0xAF, 0x1A, 0xCD, 0x32, 0x03, 0x47, 0xC6, 0xC3, 0x06,
+    0xBA, 0x7C, 0x17, 0x2A, 0x4D, 0xF9, 0x76, 0xE6, 0x5B, 0xD9, 0x8C, 0xF1, 0xFD, 0x17, 0xA8, 0x89,
+    0xEF, 0xE3, 0x24, 0x1A, 0x25, 0x6C, 0x29, 0xB8, 0x35, 0xDA, 0xC8, 0x4E, 0x8F, 0x04, 0x64, 0xEA,
+    0x95, 0x70, 0x89, 0xD5, 0x8E, 0xD1, 0x41, 0xD1, 0x99, 0x52, 0x4E, 0x2F, 0x67, 0x84, 0x0D, 0xB2,
+    0x31, 0xB4, 0xB7, 0xDC, 0xED, 0xAB, 0xEA, 0x5A, 0x69, 0x6C, 0x9B, 0x13, 0xC8, 0x78, 0x99, 0x00,
+    0xB3, 0x9D, 0x52, 0x3B, 0xC4, 0x6A, 0xB8, 0x61, 0x04, 0x1E, 0x44, 0xF0, 0x21, 0x22, 0x94, 0x46,
+    0x4E, 0x42, 0x11, 0xBB, 0xC9, 0xD0, 0x25, 0x11, 0x58, 0xF2, 0x00, 0xD4, 0x05, 0x7B, 0x76, 0xC0,
+    0xA6, 0x08, 0xCA, 0xD5, 0xBC, 0xB7, 0x51, 0x0F, 0x53, 0x8B, 0xA0, 0x91, 0x23, 0xE8, 0x41, 0xF6,
+    0xD1, 0x0D, 0xAE, 0x59, 0x76, 0x4A, 0x2A, 0x5D, 0xCA, 0xC1, 0xE1, 0xD5, 0x63, 0x46, 0x6E, 0xE6,
+    0x76, 0x96, 0xBB, 0x71, 0x5E, 0xA7, 0xBC, 0xC3, 0x41, 0xC2, 0x13, 0x70, 0x2B, 0xA3, 0x5E, 0x87,
+    0xF2, 0x65, 0xCA, 0xA5, 0xCA, 0x9D, 0x98, 0x2B, 0x50, 0x51, 0xCD, 0x2B, 0xE3, 0xF0, 0x16, 0xB3,
+    0xB4, 0xF8, 0xD7, 0xB0, 0xAD, 0xA7, 0xF2, 0x75, 0xCA, 0x0B, 0x7A, 0x02, 0x9E, 0xE4, 0xD4, 0xEF,
+    0x50, 0x11, 0xA0, 0x6D, 0x98, 0x3B, 0xC9, 0xA8, 0xAD, 0x64, 0x3F, 0x9C, 0x81, 0x6C, 0x0D, 0xD5,
+    0xED, 0x44, 0xFC, 0x1E, 0xFA, 0x46, 0x02, 0xCA, 0xC7, 0xAB, 0x02, 0x5D, 0x7F, 0xAC, 0xCF, 0x59,
+    0x47, 0x32, 0x01, 0x7C, 0xC3, 0x88, 0x08, 0xD4, 0x39, 0xAC, 0xD8, 0xB3, 0x0F, 0xCD, 0xD6, 0x1A,
+    0x37, 0xAE, 0xAE, 0xD1, 0x76, 0xC4, 0xBA, 0x3F, 0x8D, 0xAC, 0x78, 0xFC, 0x01, 0xF0, 0x64, 0x79,
+    0xF2, 0x75, 0x9C, 0xD3, 0xF3, 0x3E, 0xC7, 0x83, 0xB7, 0x28, 0x42, 0x10, 0x86, 0x64, 0x9D, 0xD0,
+    0xF7, 0xD1, 0x7E, 0xD4, 0xD7, 0xD9, 0xD7, 0x59, 0xAE, 0x0E, 0x97, 0x3A, 0x1C, 0x6C, 0x9E, 0x44,
+    0xEF, 0x84, 0xB0, 0x1C, 0x8A, 0x5C, 0x3E, 0x1B, 0x81, 0x2C, 0x41, 0x30, 0x69, 0xF1, 0x68, 0x1D,
+    0x0D, 0x6D, 0x0E, 0x12, 0xF1, 0xA1, 0xCF, 0x1F, 0x44, 0x5F, 0x14, 0x5E, 0x12, 0xC4, 0xDF, 0x3C,
+    0x54, 0x5E, 0x5A, 0x40, 0x38, 0xCA, 0x90, 0xE9, 0xF2, 0xD0, 0xA6, 0x2C, 0x81, 0x87, 0x7B, 0xBB,
+    0x0B, 0xEC, 0x5D, 0x88, 0xF2, 0x83, 0x98, 0xA2, 0x0F, 0x20, 0xCA, 0xDB, 0x39, 0xA8, 0x05, 0x0A,
+    0x10, 0x7F, 0xC2, 0xC4, 0xF3, 0x54, 0x23, 0x91, 0x22, 0x16, 0xCD, 0x41, 0x9D, 0x35, 0xC8, 0x39,
+    0xC8, 0xC3, 0x77, 0x17, 0xB1, 0xA9, 0x00, 0x59, 0x46, 0x3C, 0x39, 0xEA, 0x53, 0xEC, 0x10, 0x1B,
+    0x77, 0xB4, 0x79, 0x4B, 0xFD, 0x5B, 0x67, 0xFA, 0x67, 0xBD, 0x1E, 0x9F, 0xD5, 0xF8, 0xF9, 0xC9,
+    0x69, 0x9A, 0x18, 0x8C, 0x2F, 0x63, 0xE6, 0x57, 0xB9, 0x20, 0x2F, 0x4C, 0x82, 0x64, 0x5F, 0xEC,
+    0xD6, 0xCC, 0x4E, 0x69, 0x96, 0x5D, 0xA6, 0xF0, 0x51, 0x3A, 0xBC, 0x14, 0x69, 0xC9, 0xFA, 0xE9,
+    0xF2, 0x4D, 0x5A, 0x1C, 0xB6, 0x58, 0xBA, 0x0A, 0x5B, 0xC6, 0x47, 0x5B, 0xAB, 0x8E, 0x2E, 0x86,
+    0x3E, 0xE0, 0x36, 0x9A, 0x66, 0x8F, 0x75, 0xA6, 0xF4, 0x8F, 0x0B, 0x2C, 0x75, 0x0B, 0x42, 0xD6,
+    0xC0, 0xE6, 0x39, 0x95, 0x0E, 0xCD, 0x25, 0xA9, 0xE6, 0x52, 0x80, 0xD6, 0x41, 0x75, 0x9E, 0x4B,
+    0x18, 0x41, 0xCF, 0x45, 0xD0, 0x73, 0xC0, 0x5E, 0x60, 0x0E, 0xEB, 0xA0, 0x3A, 0x48, 0x56, 0xF3,
+    0xB0, 0xF9, 0x8C, 0x82, 0xE7, 0x12, 0x95, 0x8E, 0xF6, 0x4F, 0x20, 0x64, 0x1C, 0x87, 0x6F, 0x1C,
+    0x9C, 0x8D, 0x7F, 0x1A, 0xEF, 0x0F, 0x24, 0xD9, 0x23, 0x99, 0x52, 0xC0, 0x46, 0x23, 0xD0, 0x95,
+    0x77, 0x0A, 0x1F, 0x52, 0x11, 0x1F, 0xEB, 0x90, 0x93, 0x5A, 0x3D, 0x3E, 0x73, 0x5B, 0x66, 0x63,
+    0xE5, 0x71, 0x0B, 0x19, 0x36, 0x58, 0xFE, 0xC0, 0x05, 0xE7, 0x98, 0xCC, 0x8D, 0x4D, 0x15, 0x53,
+    0xD9, 0xE3, 0xB3, 0x10, 0x97, 0x3B, 0xB0, 0xF5, 0x26, 0x60, 0xAE, 0xEA, 0xB0, 0xF2, 0x0E, 0xD1,
+    0x31, 0x53, 0x15, 0xF2, 0xC1, 0xEB, 0xCD, 0x49, 0xDE, 0xDB, 0x31, 0x83, 0x34, 0x8C, 0x97, 0xCB,
+    0x96, 0xC1, 0x50, 0xCC, 0x7F, 0xE1, 0xF5, 0x86, 0x00, 0x8A, 0xB7, 0x01, 0xC9, 0x3D, 0x44, 0xA4,
+    0xC3, 0xF3, 0x9E, 0xAB, 0x2C, 0x82, 0x37, 0xF8, 0x20, 0xCF, 0xE3, 0x33, 0xCC, 0x4B, 0xA3, 0x98,
+    0xED, 0x62, 0xF1, 0xDB, 0x88, 0x6E, 0x84, 0x7A, 0x8B, 0xCC, 0xB9, 0xD3, 0xAA, 0x3A, 0xFF, 0x3C,
+    0xCA, 0xB3, 0xAF, 0x5F, 0xF3, 0x99, 0x15, 0x6F, 0xA4, 0x06, 0x3B, 0xEA, 0x5B, 0xD7, 0xFF, 0x3F,
+    0x93, 0x31, 0x0F, 0x0C, 0xA2, 0x9D, 0x62, 0x51, 0xDE, 0x8E, 0xE9, 0xB2, 0x43, 0x53, 0x9A, 0x10,
+    0x80, 0x6B, 0x1D, 0xDA, 0xEC, 0xAB, 0x87, 0x6E, 0x2A, 0xF8, 0xE8, 0x3A, 0xE4, 0x63, 0xC3, 0xBA,
+    0x39, 0x3C, 0xF4, 0x4D, 0xDE, 0x1A, 0xE6, 0x7F, 0x5B, 0xE1, 0x1C, 0x1E, 0x3C, 0xF2, 0xA7, 0x1B,
+    0xFB, 0xE5, 0xA3, 0x9A, 0x65, 0x2B, 0x3E, 0xE3, 0xE6, 0x93, 0x43, 0xBB, 0x3C, 0x3B, 0x44, 0xCF,
+    0x98, 0x89, 0x1E, 0xCD, 0xE5, 0x96, 0xBA, 0x74, 0x17, 0xA8, 0xB3, 0x76, 0x9F, 0xBC, 0x7B, 0xFD,
+    0xBC, 0x8E, 0x40, 0xAA, 0x9E, 0x30, 0x7F, 0xE0, 0xC6, 0xC7, 0x1D, 0x62, 0x47, 0x1E, 0x5B, 0x49,
+    0x6B, 0xCE, 0xF7, 0x36, 0x30, 0x0F, 0x70, 0x93, 0x8F, 0xE4, 0x42, 0xDE, 0xDA, 0x9E, 0x09, 0xF6,
+    0x82, 0x8C, 0x10, 0x5A, 0x15, 0x83, 0xCD, 0xD8, 0xD6, 0x49, 0x7D, 0xB4, 0x23, 0x2A, 0xAD, 0x6B,
+    0xE2, 0x03, 0xD6, 0x04, 0xD5, 0x39, 0x40, 0x7B, 0xA0, 0xD8, 0x14, 0xC1, 0x52, 0x0D, 0x9D, 0x12,
+    0x76, 0x68, 0x3C, 0x50, 0x0D, 0xE4, 0xD3, 0xCE, 0xEB, 0x85, 0x09, 0x2F, 0x76, 0x37, 0xD9, 0x81,
+    0x89, 0x2B, 0x07, 0x26, 0x2F, 0x9D, 0x9E, 0xC3, 0x4E, 0xCC, 0x3A, 0x15, 0x76, 0x2A, 0x80, 0xA4,
+    0xF9, 0xBD, 0x7F, 0xE9, 0x27, 0x8F, 0x06, 0xD0, 0x2B, 0xCF, 0x9A, 0xC9, 0x29, 0x8E, 0x57, 0x3A,
+    0x4D, 0xB5, 0xC3, 0x4E, 0xD3, 0xC2, 0xE5, 0xB0, 0xD1, 0x8E, 0xFD, 0xAF, 0x54, 0x10, 0xF2, 0xB9,
+    0x87, 0x7F, 0x72, 0x2A, 0xDB, 0x2F, 0x99, 0xD6, 0xD7, 0x47, 0xF1, 0x3E, 0x34, 0x2C, 0x41, 0xC5,
+    0x12, 0xEB, 0xD8, 0x52, 0xC9, 0x4E, 0x95, 0x47, 0x0D, 0x27, 0x96, 0x37, 0x49, 0x40, 0xD2, 0x4A,
+    0xBF, 0x65, 0x12, 0xB4, 0x47, 0x6E, 0x0F, 0x6C, 0xFD, 0xA5, 0xA7, 0x7B, 0xCB, 0xB4, 0xD0, 0x32,
+    0x2A, 0xBD, 0x65, 0x82, 0xFC, 0x7A, 0x42, 0x0E, 0x5F, 0x44, 0x61, 0x12, 0x85, 0xB1, 0x3C, 0xBE,
+    0xE1, 0x90, 0xDF, 0xA4, 0x4E, 0x77, 0x33, 0x6F, 0x8F, 0xE4, 0xCC, 0xEC, 0x26, 0x56, 0xC1, 0x65,
+    0x74, 0xF3, 0x3E, 0x44, 0x3D, 0x59, 0xBF, 0x14, 0x97, 0x4E, 0xF6, 0x1D, 0xBC, 0x47, 0xB8, 0x0D,
+    0xD1, 0xF1, 0x12, 0x16, 0x5A, 0x2B, 0x83, 0xD0, 0xEE, 0x6E, 0xC6, 0xED, 0xC1, 0xD1, 0x4B, 0x82,
+    0xCB, 0xC6, 0x47, 0x3C, 0x0F, 0x12, 0xBB, 0xE0, 0xE3, 0x2F, 0x68, 0x8D, 0x1B, 0xC6, 0x1F, 0x9F,
+    0x14, 0xC9, 0x19, 0x87, 0xDE, 0x36, 0xA6, 0xE7, 0x4D, 0x36, 0xFB, 0xD6, 0x9B, 0x30, 0x4B, 0x93,
+    0x8C, 0x9B, 0x9A, 0x5B, 0x23, 0x8C, 0xF4, 0x12, 0x59, 0x2D, 0x3E, 0x8C, 0x7C, 0xF6, 0x18, 0xF0,
+    0x3C, 0x0C, 0x39, 0x22, 0x21, 0x13, 0x31, 0xA4, 0xAB, 0x75, 0x0A, 0x65, 0x92, 0x9A, 0xE0, 0x4C,
+    0x9E, 0x83, 0xE6, 0xAA, 0x68, 0x04, 0xC2, 0x6C, 0x4E, 0x7D, 0xBE, 0xC5, 0x8E, 0xA5, 0xE2, 0x48,
+    0x02, 0xFB, 0x1B, 0xDE, 0xA8, 0x77, 0x1F, 0x63, 0x29, 0xE4, 0x70, 0x71, 0x8E, 0x4F, 0x31, 0x89,
+    0xA7, 0x0A, 0x42, 0xC2, 0x7A, 0xE6, 0x30, 0xAB, 0xCB, 0xAB, 0xC0, 0x67, 0xAF, 0x39, 0xA6, 0x06,
+    0x9E, 0x91, 0x2F, 0x59, 0xD4, 0x10, 0xE1, 0xF5, 0xC9, 0xA0, 0x9E, 0x8E, 0x41, 0xEA, 0x81, 0xA1,
+    0xD3, 0x30, 0x9C, 0xC4, 0xA8, 0xD5, 0x3D, 0x6A, 0xEB, 0x13, 0x47, 0xA7, 0x79, 0x8B, 0xEC, 0xC1,
+    0x1C, 0x89, 0xDF, 0xF4, 0xC8, 0xB1, 0xB6, 0xA9, 0x0A, 0x7B, 0xB3, 0x62, 0x02, 0xE2, 0xCB, 0x9F,
+    0x0E, 0xA8, 0x41, 0x22, 0xA9, 0x2B, 0x19, 0xCB, 0xA7, 0x1A, 0xE2, 0x52, 0xF9, 0x15, 0xCD, 0x19,
+    0x12, 0xFD, 0xEF, 0x90, 0xBB, 0xDA, 0xA3, 0x6F, 0x54, 0xF7, 0x5F, 0x0B, 0x50, 0x82, 0x0D, 0x73,
+    0x28, 0xF7, 0x7C, 0xF2, 0xB1, 0x4C, 0xB0, 0x2D, 0xCA, 0xDB, 0xD3, 0xCA, 0xA9, 0xAE, 0x50, 0x6C,
+    0x3E, 0x5C, 0xAF, 0xFA, 0x9E, 0x26, 0x4E, 0x01, 0x5D, 0x2B, 0xCA, 0xC0, 0xEE, 0x5C, 0xF8, 0x2C,
+    0x35, 0x83, 0xF8, 0xB7, 0xC1, 0xE7, 0x24, 0xD8, 0x7E, 0xE1, 0xD4, 0x71, 0xDA, 0x40, 0x27, 0xC2,
+    0xDB, 0xE0, 0x41, 0x36, 0x72, 0xA3, 0xCE, 0x83, 0xD7, 0xD8, 0xB3, 0x00, 0xDB, 0x6D, 0x6B, 0xAB,
+    0xA4, 0x5F, 0xA5, 0xE5, 0x45, 0xE3, 0xB4, 0xE5, 0x80, 0xC7, 0x69, 0x63, 0xE7, 0xA5, 0x18, 0x2B,
+    0x01, 0x7D, 0x80, 0xEF, 0xB5, 0x29, 0xE0, 0xE7, 0xA7, 0xE3, 0x9B, 0xD1, 0xED, 0x4F, 0x52, 0x12,
+    0x3F, 0xBA, 0x00, 0xEC, 0xFC, 0x14, 0x78, 0xCB, 0xDE, 0xDE, 0x47, 0x09, 0x5D, 0x16, 0xE7, 0xC7,
+    0x3D, 0x1D, 0x7C, 0xBD, 0xCA, 0xA9, 0xCA, 0x9E, 0xF9, 0xC7, 0x84, 0xB3, 0x63, 0x7B, 0xA9, 0x72,
+    0x6C, 0xB6, 0x2B, 0x82, 0x9B, 0x60, 0x16, 0xAF, 0xF2, 0x55, 0x8C, 0x17, 0x54, 0x37, 0x71, 0x48,
+    0xC4, 0x51, 0x9D, 0x95, 0x5C, 0x19, 0xBE, 0x63, 0xEF, 0x96, 0xD6, 0xD8, 0x6F, 0xA4, 0xC2, 0x67,
+    0x63, 0x91, 0x2F, 0x53, 0x2D, 0xB5, 0xB2, 0x3A, 0xF9, 0x99, 0x9D, 0x79, 0xD4, 0xC8, 0x45, 0x2A,
+    0xD5, 0x5A, 0x24, 0x62, 0x19, 0xE6, 0xB0, 0x39, 0x4E, 0x9C, 0x35, 0xDC, 0x50, 0x7C, 0x98, 0xD5,
+    0xA4, 0x12, 0x9F, 0x26, 0x30, 0xC8, 0xF6, 0x17, 0xB1, 0xF4, 0xC8, 0x7A, 0x1C, 0xBB, 0x50, 0xDE,
+    0x4F, 0x42, 0xE7, 0xF7, 0x44, 0xFF, 0x55, 0xB0, 0x4B, 0xD4, 0x65, 0xEB, 0x04, 0x4B, 0xC4, 0xD7,
+    0x3C, 0x7E, 0x79, 0x59, 0x62, 0x9E, 0xBE, 0x51, 0x09, 0x6C, 0x35, 0x1E, 0xC6, 0x6C, 0x42, 0xD2,
+    0xE1, 0x05, 0xC2, 0x02, 0x1B, 0xC2, 0x1D, 0xFE, 0x5F, 0x8F, 0x01, 0xB5, 0x7C, 0xEB, 0x9F, 0x14,
+    0xD5, 0xEC, 0xCF, 0x29, 0xF7, 0xC4, 0xC3, 0x30, 0x93, 0xE2, 0xE3, 0x0F, 0x53, 0xF9, 0xCA, 0xDB,
+    0x1F, 0x25, 0xEE, 0xBB, 0xF6, 0x9F, 0x63, 0xE7, 0x4F, 0x18, 0x50, 0xFC, 0x15, 0xE3, 0xD9, 0x3D,
+    0xEA, 0x2A, 0x38, 0x5C, 0x6D, 0x8E, 0x16, 0x83, 0xCA, 0x1F, 0xC7, 0xF4, 0xDB, 0x90, 0xD7, 0x0C,
+    0xFA, 0x21, 0xBC, 0x56, 0xCD, 0xD3, 0xCA, 0x5A, 0x58, 0x87, 0x1A, 0x34, 0x29, 0x1F, 0x51, 0xBA,
+    0x88, 0x16, 0x44, 0xD2, 0x20, 0xDB, 0x5C, 0x8F, 0x83, 0x35, 0x77, 0xD2, 0xCA, 0xCA, 0x84, 0xA7,
+    0x58, 0x8D, 0xE3, 0x2F, 0xCA, 0x9A, 0x34, 0x6B, 0x2E, 0x2E, 0x1A, 0x26, 0x5E, 0xA9, 0x99, 0x7C,
+    0x18, 0x47, 0x88, 0x18, 0x32, 0xF8, 0x49, 0x46, 0xD6, 0x17, 0xC0, 0xF4, 0x18, 0x63, 0x3C, 0x08,
+    0xCB, 0x3E, 0x82, 0x03, 0xD1, 0x76, 0x54, 0x9E, 0xA3, 0x74, 0x51, 0xA5, 0x5B, 0xED, 0x12, 0x2B,
+    0xDB, 0x36, 0xB4, 0xBF, 0x56, 0x53, 0x9C, 0x03, 0xC7, 0xD6, 0xF0, 0x3F, 0x8D, 0xE9, 0x9E, 0x1B,
+    0x85, 0x31, 0x71, 0xA0, 0xF9, 0x7F, 0x14, 0x38, 0x4E, 0xA8, 0x57, 0xE0, 0xAA, 0x7A, 0x7C, 0xB3,
+    0x71, 0x4A, 0x31, 0xDA, 0x26, 0x4C, 0xE6, 0xC2, 0x24, 0xE1, 0x08, 0x62, 0xA9, 0x8A, 0x1F, 0x66,
+    0x57, 0x9A, 0x75, 0x5D, 0xCC, 0xAE, 0xE4, 0xEC, 0x8B, 0x98, 0x4B, 0x7C, 0xF6, 0x74, 0x5A, 0x2C,
+    0xFC, 0xE8, 0xC0, 0x35, 0x07, 0x89, 0xC1, 0xC6, 0x6F, 0x03, 0x36, 0x14, 0xFB, 0x37, 0xF8, 0xE6,
+    0xFB, 0x34, 0x71, 0xCD, 0x0F, 0xDD, 0xAC, 0xF9, 0x09, 0x41, 0xB1, 0xC4, 0x26, 0xFC, 0x2F, 0x48,
+    0x79, 0xA9, 0x78, 0x65, 0x38, 0x6D, 0x86, 0x21, 0x9E, 0x10, 0x0F, 0x63, 0x8E, 0x26, 0x5A, 0x93,
+    0x62, 0x93, 0xBD, 0x20, 0xEA, 0x50, 0x7E, 0xCA, 0xE7, 0x7F, 0xCD, 0x5A, 0x3D, 0x6C, 0x1C, 0xC7,
+    0x15, 0x7E, 0xBB, 0x4B, 0x6A, 0x01, 0x5D, 0x92, 0x75, 0x00, 0xB2, 0x91, 0x7F, 0xD6, 0x85, 0x0B,
+    0xC3, 0xB0, 0xB8, 0x8D, 0x0B, 0x19, 0xB8, 0xBD, 0x5B, 0x3B, 0x40, 0x0C, 0x24, 0x85, 0x19, 0x80,
+    0xA7, 0x26, 0x80, 0xE5, 0xC2, 0x8D, 0x55, 0xC4, 0x29, 0x5C, 0x30, 0xC0, 0xC9, 0xDC, 0x38, 0xA5,
+    0x0B, 0x4B, 0x85, 0x7A, 0x95, 0x32, 0x5D, 0x50, 0x05, 0x13, 0xAC, 0xE1, 0x23, 0x6F, 0x61, 0x17,
+    0x29, 0x52, 0x64, 0x91, 0xC0, 0x48, 0xE1, 0xC2, 0x8B, 0xC4, 0x41, 0x10, 0xB9, 0xC8, 0x5A, 0x5E,
+    0x23, 0x67, 0xF9, 0xC8, 0xC9, 0xF7, 0xBD, 0xD9, 0xBD, 0x93, 0x2C, 0x31, 0x96, 0x28, 0xD2, 0xC9,
+    0x71, 0xE7, 0xED, 0x71, 0x6F, 0x6E, 0xE6, 0xBD, 0x99, 0x37, 0xEF, 0xFB, 0xDE, 0x23, 0x45, 0x44,
+    0x86, 0x12, 0x99, 0x64, 0xE4, 0x18, 0x53, 0xD5, 0x7E, 0xE9, 0x98, 0x32, 0x48, 0xA5, 0x9F, 0x46,
+    0x22, 0xA1, 0xC4, 0x22, 0x41, 0xDA, 0x15, 0xE9, 0xA4, 0x43, 0x88, 0x1C, 0xC2, 0xBF, 0x5D, 0x74,
+    0x72, 0xED, 0xA2, 0x9D, 0xC3, 0x44, 0x7A, 0xD2, 0x29, 0x9D, 0xA9, 0xB8, 0x66, 0xAB, 0x12, 0x79,
+    0xCD, 0xA4, 0xD2, 0xBE, 0x96, 0x74, 0x9A, 0xF3, 0x49, 0xE6, 0x9B, 0xBA, 0x0A, 0x2F, 0x8D, 0x8B,
+    0x1E, 0xBE, 0xD0, 0x95, 0x20, 0x19, 0x62, 0xEC, 0xCC, 0xB6, 0x3C, 0xD3, 0x79, 0x3A, 0x69, 0x2C,
+    0x81, 0x44, 0xD2, 0x97, 0xE0, 0xFA, 0x54, 0xA0, 0xCE, 0x6C, 0x90, 0x7A, 0x5B, 0xA4, 0xAA, 0x26,
+    0x22, 0x9F, 0x97, 0x10, 0x5F, 0xE7, 0x10, 0xFB, 0x02, 0x51, 0xDD, 0x8B, 0xC8, 0xC4, 0xA9, 0x64,
+    0x44, 0xD1, 0x15, 0xAF, 0x94, 0x28, 0xE9, 0xE4, 0x12, 0xDC, 0x34, 0x09, 0x66, 0x98, 0xCC, 0x66,
+    0x90, 0xC5, 0x44, 0x68, 0xCF, 0x92, 0x2C, 0x06, 0x54, 0xEF, 0x35, 0x8A, 0x29, 0xC5, 0x45, 0xD5,
+    0xF6, 0x60, 0x11, 0xD3, 0x7C, 0x28, 0x9D, 0x48, 0x78, 0x1D, 0x83, 0xFA, 0xE6, 0xAD, 0x44, 0xEE,
+    0x78, 0xB9, 0x45, 0xD7, 0xBE, 0xC9, 0x6A, 0x7B, 0xEF, 0x17, 0xF6, 0x1E, 0xCC, 0x57, 0x6A, 0x63,
+    0xFF, 0x22, 0xB6, 0xC3, 0xE4, 0x63, 0xB3, 0x27, 0x7D, 0xDC, 0x33, 0x67, 0x9C, 0xB0, 0x03, 0x16,
+    0x07, 0x9D, 0x23, 0xD8, 0xE1, 0x61, 0x6D, 0x63, 0x6B, 0x0F, 0x4C, 0xCB, 0xB0, 0x2E, 0xE2, 0xD2,
+    0x3E, 0xFC, 0xE2, 0x15, 0xBC, 0x67, 0x1C, 0x4F, 0xEF, 0x91, 0xD8, 0xE7, 0xB1, 0xD8, 0x7E, 0x13,
+    0xD1, 0xEF, 0xA1, 0xBB, 0x8E, 0x83, 0xEE, 0xC2, 0x85, 0xE7, 0xF4, 0x99, 0x6C, 0x24, 0xE8, 0x2E,
+    0xCD, 0xBC, 0xC5, 0xD8, 0x5C, 0xD4, 0xFB, 0x2D, 0xEA, 0x07, 0x49, 0x45, 0xED, 0xBC, 0xBF, 0xA8,
+    0x72, 0x62, 0x44, 0x75, 0xBB, 0x20, 0x56, 0x35, 0x1D, 0x71, 0x71, 0xB0, 0xC6, 0x09, 0x42, 0x33,
+    0xE5, 0x7C, 0x8B, 0x83, 0x89, 0x4E, 0xEF, 0x54, 0xAA, 0x8D, 0x57, 0x34, 0xCA, 0xE9, 0xC3, 0xC8,
+    0xAA, 0xD4, 0xB5, 0x96, 0xD4, 0xFA, 0x75, 0xB7, 0x54, 0x7D, 0xFC, 0x5C, 0xD5, 0xC1, 0xB2, 0x72,
+    0xA2, 0x68, 0xF3, 0xAA, 0x55, 0x66, 0x7A, 0x8B, 0x26, 0xDB, 0x81, 0xDE, 0x56, 0x62, 0xBD, 0x05,
+    0xB5, 0xDE, 0xBC, 0x52, 0x6F, 0xEC, 0xF1, 0x6A, 0x90, 0x0C, 0x06, 0x89, 0x6F, 0x3E, 0x49, 0xB0,
+    0x86, 0xE1, 0x25, 0x93, 0x0C, 0xCE, 0xE5, 0x3D, 0xDD, 0x1E, 0xF8, 0x61, 0xC8, 0xFD, 0x1A, 0xB2,
+    0x67, 0x46, 0x7D, 0x12, 0xA7, 0xD2, 0x9B, 0xAE, 0x1E, 0x06, 0x4B, 0xF5, 0x33, 0x2C, 0x46, 0x17,
+    0x3D, 0xB1, 0x63, 0x7D, 0x7C, 0x0F, 0x13, 0x04, 0xD7, 0xCD, 0xF3, 0x37, 0x37, 0x53, 0xD7, 0xBC,
+    0xF5, 0x3C, 0xC6, 0x6C, 0x34, 0x59, 0x17, 0x59, 0xC9, 0x1E, 0xA0, 0x8D, 0x4D, 0xAD, 0x0D, 0x43,
+    0xB1, 0xC1, 0x9C, 0x1F, 0x8E, 0x30, 0x23, 0xA6, 0x3B, 0x45, 0x9F, 0x58, 0xC0, 0xF8, 0xBD, 0xCC,
+    0xB6, 0x85, 0x4C, 0x17, 0x59, 0x96, 0xD0, 0xE2, 0x7B, 0x6D, 0x18, 0x5B, 0x9B, 0x1D, 0x7B, 0xD6,
+    0x60, 0x55, 0x88, 0xE5, 0x0C, 0xCA, 0xDA, 0x91, 0xBA, 0x93, 0xD7, 0x7E, 0xCE, 0x37, 0xD8, 0x0F,
+    0x27, 0xE1, 0xFB, 0x7B, 0xB8, 0x64, 0x76, 0x05, 0xA9, 0x67, 0xC4, 0xDB, 0x83, 0x23, 0xC8, 0xEB,
+    0x6E, 0x31, 0x86, 0x8E, 0x6E, 0x39, 0x4E, 0x29, 0xDF, 0xCF, 0x29, 0x7F, 0x57, 0x51, 0x6E, 0xD7,
+    0x2A, 0x87, 0x2A, 0xFB, 0x94, 0x59, 0x90, 0x50, 0xE2, 0xDC, 0x43, 0x7A, 0x25, 0xA5, 0xD4, 0x2A,
+    0x47, 0xEB, 0x94, 0x3D, 0x95, 0xA1, 0x3E, 0xE9, 0x4C, 0x28, 0x3D, 0x95, 0x0E, 0xA4, 0x9E, 0x26,
+    0x95, 0xF4, 0x61, 0x71, 0x42, 0xEE, 0x87, 0x67, 0xB8, 0xF5, 0xEE, 0x55, 0xBB, 0x33, 0x09, 0xF5,
+    0xF1, 0x54, 0x1F, 0x48, 0x1E, 0x88, 0x84, 0xFA, 0x88, 0x50, 0x1F, 0x27, 0xA1, 0x3E, 0x5E, 0x41,
+    0x7D, 0x20, 0xFB, 0x94, 0xD4, 0x07, 0x12, 0xFA, 0x40, 0x42, 0x1F, 0xBA, 0x6B, 0xAD, 0x72, 0xB4,
+    0x4E, 0xD9, 0x53, 0x19, 0xEA, 0x93, 0xCE, 0x84, 0xD2, 0x53, 0xE9, 0x4C, 0x54, 0x07, 0xB9, 0x53,
+    0xFA, 0xD4, 0xCA, 0xD1, 0x30, 0xE8, 0xEC, 0x5B, 0xA5, 0xA8, 0x60, 0xC5, 0xDF, 0xAB, 0xF6, 0x57,
+    0x91, 0xD5, 0xF3, 0x89, 0xAC, 0xDE, 0x30, 0x95, 0x53, 0x99, 0x9F, 0x4D, 0x9D, 0x0A, 0xF1, 0xC6,
+    0x41, 0x94, 0x8B, 0x9D, 0xAA, 0xBE, 0x1F, 0xD1, 0x0E, 0x3A, 0x17, 0x7A, 0x1C, 0xD4, 0x53, 0x8D,
+    0x9D, 0xA8, 0x0A, 0xB1, 0xFB, 0x88, 0xDA, 0x01, 0x3E, 0xF5, 0x9B, 0x93, 0xED, 0xE1, 0xF3, 0x4E,
+    0x69, 0x9F, 0x3D, 0x86, 0x00, 0x1B, 0xC3, 0xE3, 0xBA, 0x70, 0x8F, 0xEC, 0x34, 0xBC, 0x21, 0xC4,
+    0x40, 0x41, 0xE2, 0x96, 0x9D, 0xD4, 0xBB, 0xFE, 0x6E, 0xEE, 0x23, 0x1C, 0x04, 0x97, 0xCF, 0x72,
+    0x94, 0x0A, 0xCE, 0x9A, 0xA1, 0xD7, 0x10, 0xA3, 0xC5, 0x35, 0xE3, 0x12, 0x46, 0x78, 0xAE, 0x42,
+    0x68, 0x40, 0x58, 0xA0, 0x27, 0xE0, 0x75, 0x3E, 0x09, 0x4C, 0xF5, 0x83, 0xE7, 0x26, 0x8C, 0xFC,
+    0x74, 0xB8, 0xAE, 0x6B, 0xA6, 0xD1, 0xF5, 0xD1, 0x05, 0xE9, 0x4E, 0xA4, 0x5B, 0xCB, 0x68, 0xE4,
+    0x4C, 0x37, 0xB6, 0x46, 0xE1, 0xDE, 0xD3, 0x56, 0x11, 0x9C, 0x68, 0x9C, 0x66, 0x9C, 0x64, 0x55,
+    0x5B, 0xFA, 0x38, 0xF8, 0x1A, 0xD0, 0xEE, 0xF1, 0x7A, 0x78, 0xC2, 0xAF, 0xD8, 0x71, 0x7A, 0x5D,
+    0x1D, 0x47, 0x2D, 0x74, 0x92, 0x7B, 0x1D, 0xC1, 0xBE, 0xBA, 0x3E, 0xB6, 0x2B, 0xE4, 0x59, 0xF4,
+    0xA7, 0xED, 0x66, 0xE9, 0x2B, 0x52, 0xAC, 0x30, 0x95, 0xF8, 0x84, 0x38, 0x04, 0x89, 0x9E, 0xDC,
+    0x8E, 0x91, 0x77, 0x81, 0xC7, 0xFB, 0xC2, 0x48, 0xF1, 0xD3, 0x6D, 0x71, 0xBE, 0x80, 0xF5, 0xF0,
+    0x56, 0x5D, 0x51, 0xBB, 0x8A, 0x00, 0x93, 0x5A, 0x82, 0x4B, 0x3B, 0x3A, 0xE1, 0xDD, 0x31, 0x33,
+    0x38, 0x10, 0x33, 0x15, 0x72, 0xBE, 0xC4, 0x4C, 0xFD, 0xBC, 0x0D, 0x8D, 0x42, 0x18, 0x9D, 0xDC,
+    0x47, 0x63, 0x80, 0x26, 0x72, 0x02, 0x38, 0x8B, 0x28, 0x09, 0x72, 0xC0, 0x26, 0xD4, 0x9F, 0xA3,
+    0xA6, 0x97, 0xAF, 0x8B, 0x73, 0x03, 0x73, 0x6E, 0xE4, 0x33, 0xBD, 0x81, 0xA0, 0xAA, 0xEB, 0xB7,
+    0x35, 0xE2, 0x26, 0x61, 0x93, 0xA8, 0x39, 0x03, 0xCD, 0xC1, 0x1A, 0xC6, 0x9F, 0xEA, 0x5D, 0x5F,
+    0xE5, 0xEB, 0x16, 0x42, 0x56, 0x1F, 0x3F, 0x72, 0xFD, 0x3D, 0xAC, 0x2D, 0x9B, 0x3D, 0x9D, 0xAB,
+    0xE8, 0x51, 0x61, 0xCD, 0xAA, 0x07, 0xB7, 0xC1, 0x32, 0x16, 0x1B, 0x09, 0x3A, 0x78, 0xB4, 0x70,
+    0xBC, 0x76, 0xE8, 0x89, 0xE7, 0xC9, 0xE1, 0x1E, 0x3F, 0x7A, 0xB4, 0xB6, 0x38, 0xC9, 0x82, 0x38,
+    0x08, 0xBC, 0xB2, 0x81, 0xF1, 0x23, 0xEC, 0xF1, 0xE2, 0x31, 0xDB, 0xA2, 0x67, 0xA1, 0xF5, 0x29,
+    0x9C, 0x85, 0x53, 0xC7, 0xB0, 0x37, 0x13, 0x8B, 0x82, 0x42, 0x1E, 0xE1, 0x1C, 0xAF, 0x3D, 0x0A,
+    0x54, 0x75, 0x33, 0x5F, 0xE7, 0x68, 0x6D, 0x39, 0xF1, 0x0E, 0x88, 0x51, 0xF1, 0xAC, 0x8F, 0xE1,
+    0x47, 0x0A, 0xED, 0x2B, 0x4A, 0x2A, 0xF6, 0x77, 0x37, 0x77, 0x33, 0xC6, 0xFA, 0x6E, 0x4F, 0xB2,
+    0xF0, 0xB3, 0xCA, 0xB7, 0x71, 0x86, 0x07, 0xCA, 0x00, 0x89, 0x06, 0x03, 0xBB, 0x08, 0xAF, 0x23,
+    0xF6, 0x66, 0xF8, 0xD2, 0x43, 0x0B, 0x47, 0x0A, 0x06, 0x1D, 0x53, 0x76, 0x34, 0x06, 0x39, 0x92,
+    0xF8, 0x1F, 0x16, 0xFE, 0x9B, 0xC5, 0x21, 0xF0, 0xC0, 0x6A, 0x3A, 0xDE, 0x9B, 0x6B, 0x46, 0x38,
+    0x75, 0xD3, 0xE3, 0xD1, 0x94, 0x0A, 0x01, 0xB6, 0x9E, 0x3C, 0x04, 0x72, 0x85, 0x0A, 0xB1, 0xE1,
+    0x8C, 0x12, 0x12, 0x2A, 0xC8, 0x9B, 0xC1, 0x9E, 0x31, 0x72, 0xA6, 0x3E, 0x50, 0xD5, 0xEA, 0x07,
+    0xB5, 0x6A, 0x4E, 0xD9, 0x49, 0x2D, 0x65, 0xFD, 0x6A, 0xC0, 0xB4, 0x81, 0x7C, 0x32, 0x96, 0xFD,
+    0xCD, 0x54, 0xDE, 0xD8, 0xE4, 0x73, 0xC3, 0x88, 0xE4, 0x7C, 0x39, 0xB0, 0xF1, 0xA3, 0x56, 0xD3,
+    0x6B, 0x4D, 0x13, 0x6A, 0xA2, 0x08, 0x3E, 0x2F, 0x7B, 0x2A, 0x45, 0xB5, 0xEF, 0xB4, 0x01, 0xDF,
+    0x79, 0x47, 0x5E, 0x85, 0x26, 0x7F, 0x36, 0xC5, 0x63, 0x3F, 0x36, 0x6F, 0xD6, 0xCC, 0x8F, 0x46,
+    0x74, 0x8C, 0x2E, 0x45, 0x7C, 0xC2, 0x18, 0xB3, 0x17, 0xFD, 0x73, 0x7F, 0xF3, 0xEA, 0x90, 0x8F,
+    0x27, 0x14, 0xB5, 0xEC, 0x91, 0xB0, 0x19, 0x59, 0xD8, 0xD8, 0x7A, 0xEB, 0xE6, 0x24, 0xDC, 0x73,
+    0xDB, 0x60, 0xA8, 0xAF, 0x87, 0xCD, 0xA7, 0x9C, 0x67, 0x2A, 0x5E, 0x2D, 0xAF, 0x48, 0xA0, 0x86,
+    0xF2, 0x79, 0xAF, 0x59, 0x32, 0x5D, 0x21, 0x8A, 0xA7, 0xAE, 0x42, 0x00, 0x80, 0x87, 0xB2, 0x7C,
+    0x81, 0xCF, 0x62, 0xFC, 0x9C, 0x1A, 0x03, 0xF4, 0x22, 0xC3, 0xF4, 0x22, 0xE6, 0x66, 0xC5, 0x38,
+    0x11, 0x9F, 0xED, 0x71, 0x79, 0xDA, 0x73, 0xFE, 0xAA, 0x03, 0xDD, 0x3F, 0x4E, 0xC8, 0xCF, 0x01,
+    0x6E, 0x09, 0x99, 0xF9, 0x08, 0x8B, 0x92, 0x35, 0x6D, 0xA4, 0x60, 0x17, 0xE8, 0x67, 0xE1, 0x65,
+    0x3A, 0xFD, 0x1F, 0x13, 0x32, 0x7B, 0x8D, 0x72, 0x21, 0x8C, 0x3E, 0xB9, 0x75, 0x71, 0x89, 0xB0,
+    0x08, 0x05, 0x3B, 0x6D, 0xAA, 0x12, 0xC3, 0x35, 0x82, 0x73, 0x58, 0x38, 0x00, 0x88, 0x53, 0xCF,
+    0xCD, 0x80, 0x15, 0xDE, 0x44, 0x5E, 0x09, 0x1A, 0x8C, 0xEA, 0x35, 0x06, 0x0C, 0xB5, 0x2D, 0xAF,
+    0x51, 0xFB, 0xA1, 0x9C, 0xDA, 0xA1, 0xEE, 0x38, 0x11, 0x31, 0xFA, 0xC4, 0x54, 0xDC, 0x27, 0xB9,
+    0xA2, 0xDA, 0x73, 0xAD, 0x15, 0xA8, 0xDD, 0xBF, 0x15, 0x16, 0xA8, 0x7B, 0x73, 0x5B, 0xFC, 0x99,
+    0x2D, 0x7D, 0xB5, 0x65, 0x78, 0x8B, 0x2D, 0x59, 0x63, 0x0B, 0x73, 0x0A, 0x26, 0x14, 0xC8, 0x26,
+    0x12, 0xD7, 0xBC, 0x9D, 0xD8, 0x08, 0x14, 0xE8, 0xC2, 0x2E, 0xC9, 0x1B, 0x3A, 0x4D, 0x07, 0xE9,
+    0xCE, 0x6C, 0x9E, 0x2F, 0x9A, 0x79, 0x56, 0xDA, 0x84, 0x83, 0xC0, 0xCF, 0xE4, 0x69, 0x04, 0x1A,
+    0x0B, 0x2A, 0x0B, 0x22, 0x97, 0x31, 0x93, 0x89, 0xAD, 0xAF, 0xBD, 0x8F, 0x36, 0xDE, 0x11, 0xD9,
+    0x61, 0xEE, 0xC7, 0x3C, 0x90, 0x9F, 0x6B, 0x7E, 0x38, 0x45, 0x43, 0x34, 0xC0, 0xFC, 0x24, 0x0E,
+    0x0D, 0x55, 0x22, 0x57, 0x22, 0x59, 0x9A, 0x13, 0xA0, 0x86, 0xBD, 0xDE, 0xD9, 0x1C, 0x24, 0x48,
+    0x9D, 0x1C, 0xE1, 0x0D, 0xEF, 0x47, 0xE2, 0xFD, 0xA9, 0x62, 0x26, 0x28, 0xDE, 0x27, 0x29, 0x00,
+    0x14, 0xF7, 0x1B, 0xF8, 0xBD, 0x20, 0x63, 0x8B, 0xD1, 0x42, 0xB1, 0x7D, 0xBD, 0xF2, 0xD8, 0xC9,
+    0x13, 0x63, 0xA8, 0x9B, 0x37, 0x21, 0xC1, 0x0A, 0x57, 0x33, 0xC5, 0xB5, 0x07, 0x60, 0x4F, 0x8F,
+    0xE1, 0xBB, 0x3C, 0xDD, 0x67, 0x9A, 0x46, 0xF6, 0xC4, 0xDA, 0x40, 0xDF, 0xB4, 0xE2, 0xB8, 0xCD,
+    0xDA, 0xE6, 0x71, 0x2E, 0x6E, 0xB3, 0xCD, 0xD9, 0x6B, 0xCC, 0xF2, 0x30, 0x23, 0xDB, 0x03, 0x11,
+    0xC4, 0x83, 0x4C, 0x6C, 0x08, 0x9D, 0x7C, 0x5E, 0x59, 0x42, 0x17, 0xCE, 0x62, 0x5A, 0xC2, 0xC6,
+    0x74, 0x58, 0xB1, 0x46, 0xC9, 0x46, 0xE3, 0xFF, 0x3C, 0x6A, 0x8C, 0x14, 0xEF, 0x32, 0xCB, 0x09,
+    0x53, 0x1B, 0xAA, 0xBD, 0xA6, 0x75, 0xF2, 0xC7, 0xF1, 0xAC, 0xBF, 0xB9, 0x8F, 0x31, 0x66, 0xB1,
+    0x25, 0x70, 0x4A, 0xEF, 0xF7, 0xB9, 0x63, 0x9A, 0x00, 0xB2, 0x3C, 0x58, 0xDB, 0x30, 0xD3, 0xE5,
+    0xC1, 0x84, 0x60, 0x09, 0xE7, 0x0C, 0xF5, 0x39, 0xAC, 0xFC, 0x0A, 0x86, 0x16, 0x72, 0xA2, 0x16,
+    0x1B, 0x54, 0x14, 0xDE, 0xF4, 0xCD, 0x70, 0xD5, 0x99, 0x8C, 0x4D, 0x19, 0x69, 0x5E, 0x75, 0xDA,
+    0xCB, 0x83, 0xB7, 0x99, 0x83, 0x8A, 0x9D, 0x60, 0x55, 0xDF, 0xDC, 0xCF, 0x85, 0x93, 0x04, 0x76,
+    0x03, 0xB2, 0xF1, 0xFF, 0x56, 0x7F, 0xA1, 0x3E, 0xCD, 0x63, 0xA6, 0xFF, 0xAA, 0xCD, 0x77, 0x59,
+    0x71, 0x69, 0x72, 0x86, 0xFF, 0x72, 0xFB, 0xAE, 0x4A, 0x2D, 0xF3, 0x52, 0x59, 0xCF, 0x16, 0x5E,
+    0xA4, 0x3C, 0x96, 0xE8, 0xAE, 0x1B, 0x4C, 0x07, 0x0E, 0x9A, 0x13, 0x72, 0x0C, 0xD1, 0x7D, 0xDD,
+    0xAE, 0xC8, 0x1D, 0x62, 0x89, 0xA2, 0xAB, 0x62, 0x67, 0x70, 0x2E, 0xE9, 0x8E, 0x71, 0xE2, 0xBA,
+    0xBB, 0x9B, 0x5B, 0xCD, 0xB3, 0xBB, 0x8B, 0x4E, 0x3E, 0xC2, 0x56, 0x7E, 0x5D, 0x63, 0x5B, 0x6F,
+    0xA9, 0xD7, 0x5D, 0xDB, 0xA8, 0xE5, 0xB7, 0xA0, 0x50, 0xE3, 0x34, 0x4C, 0x76, 0xD9, 0x07, 0x36,
+    0x21, 0x6C, 0x23, 0x20, 0xB4, 0xCD, 0xCF, 0xAD, 0x6B, 0x84, 0x0D, 0x30, 0x00, 0x50, 0x60, 0x7A,
+    0x16, 0xC2, 0x17, 0x76, 0xE1, 0x71, 0xD8, 0x07, 0x3A, 0x5B, 0x53, 0x75, 0xBA, 0xA3, 0x49, 0x8B,
+    0xFE, 0x5C, 0x6F, 0x66, 0x38, 0xAE, 0xDD, 0x28, 0x96, 0x5D, 0x58, 0x74, 0x61, 0xC9, 0x85, 0x05,
+    0x17, 0x96, 0x5B, 0x58, 0x6C, 0x61, 0xA9, 0x85, 0x85, 0x16, 0x96, 0x59, 0x58, 0x64, 0x61, 0x89,
+    0x85, 0x05, 0x16, 0x96, 0x57, 0x58, 0x5C, 0x61, 0x69, 0x85, 0x85, 0x15, 0x96, 0x55, 0x58, 0x54,
+    0x11, 0xAD, 0x51, 0xF0, 0x90, 0xAD, 0xDB, 0x8C, 0x86, 0x75, 0x92, 0x1B, 0x86, 0x35, 0x92, 0x29,
+    0x89, 0x18, 0xF8, 0xDB, 0x81, 0x97, 0x2D, 0x41, 0x34, 0xA8, 0x46, 0x76, 0x4F, 0xAA, 0x78, 0x1A,
+    0xE3, 0x9C, 0x01, 0xC1, 0x7B, 0xFA, 0x8C, 0xA5, 0x8D, 0x2D, 0x75, 0x3C, 0xDD, 0x52, 0x47, 0x04,
+    0x96, 0x2A, 0x40, 0xA6, 0xD3, 0x81, 0x7B, 0xFA, 0xB9, 0x07, 0xCF, 0xEB, 0x80, 0x62, 0xD1, 0x67,
+    0xF1, 0xC9, 0x24, 0x6E, 0x68, 0xE3, 0x84, 0x16, 0xFB, 0x25, 0x3D, 0xFB, 0x09, 0x2D, 0x6C, 0x63,
+    0xA7, 0x3F, 0xC8, 0x71, 0x39, 0xFF, 0x00, 0x7D, 0x93, 0x43, 0x31, 0xDD, 0x79, 0x0D, 0x38, 0x9A,
+    0x2D, 0xAB, 0xC8, 0x15, 0xF9, 0x5F, 0x30, 0xCA, 0x86, 0xE2, 0x14, 0xAD, 0x4A, 0xCA, 0x3B, 0xCE,
+    0xC8, 0x31, 0x11, 0x4C, 0x6B, 0x70, 0xDC, 0x24, 0xCB, 0x16, 0xF1, 0x34, 0x59, 0x8E, 0xF6, 0x5F,
+    0x22, 0xB4, 0x4E, 0x5B, 0x68, 0x75, 0x01, 0x1F, 0x20, 0x1B, 0xE8, 0x1A, 0xBC, 0x08, 0x68, 0x5D,
+    0x21, 0xB4, 0x0E, 0x89, 0xA5, 0x15, 0x84, 0x8B, 0xFD, 0x1A, 0xFA, 0x29, 0x44, 0x40, 0x68, 0x8D,
+    0x09, 0xAD, 0xF4, 0xEB, 0xB0, 0x6A, 0xA1, 0xB5, 0x43, 0x68, 0x0D, 0x09, 0xAD, 0x0B, 0xF3, 0xDA,
+    0xC8, 0x5D, 0xCE, 0xF9, 0xF9, 0x9F, 0xE0, 0x9C, 0x1B, 0x09, 0x15, 0x4D, 0xC7, 0xD2, 0x75, 0xFE,
+    0x95, 0x0C, 0xBD, 0x3F, 0xA4, 0x59, 0xF0, 0xD3, 0x34, 0xC3, 0x9C, 0xD9, 0x10, 0x68, 0x5A, 0x05,
+    0x69, 0xBF, 0x00, 0x9A, 0xA6, 0x16, 0x4D, 0x7B, 0x58, 0xB4, 0xA5, 0x76, 0xD9, 0x3E, 0x2C, 0xB1,
+    0x29, 0x18, 0xF7, 0x1A, 0x9C, 0xEA, 0xC9, 0x47, 0x8E, 0xBA, 0xC4, 0x36, 0xEC, 0xC9, 0x0A, 0x2C,
+    0x7C, 0x21, 0x75, 0x7F, 0x9D, 0xDF, 0xB7, 0xA3, 0x2D, 0x02, 0x15, 0xFB, 0x88, 0xE8, 0xEF, 0xFD,
+    0x42, 0xE4, 0xE2, 0xC9, 0xA3, 0x55, 0x6D, 0x00, 0xEE, 0x92, 0xFB, 0x97, 0xCB, 0x93, 0xF2, 0xF2,
+    0x21, 0x0E, 0xC0, 0x68, 0x28, 0xF1, 0x8A, 0x04, 0x38, 0x77, 0xCF, 0xD3, 0xE3, 0x36, 0x4C, 0x3D,
+    0x36, 0xB5, 0x22, 0xD7, 0xFC, 0xDA, 0x19, 0xAC, 0x8E, 0x4D, 0xB5, 0xBB, 0x79, 0xE5, 0x1B, 0xCF,
+    0x33, 0x62, 0x23, 0xFB, 0xD3, 0x8D, 0x7A, 0x12, 0x62, 0x79, 0x7E, 0x94, 0xBB, 0x79, 0x93, 0x71,
+    0xFA, 0x38, 0xBF, 0x97, 0x26, 0x3D, 0x89, 0xE1, 0x31, 0x43, 0x89, 0x10, 0x4E, 0x77, 0x37, 0x37,
+    0xB3, 0x96, 0x4C, 0x44, 0xC9, 0x42, 0x70, 0x73, 0xD4, 0xFC, 0x01, 0x68, 0x0D, 0x4C, 0x23, 0x0D,
+    0xCE, 0xE6, 0xDF, 0x93, 0xE2, 0xF0, 0x3A, 0x2C, 0xCF, 0xD6, 0xE1, 0x97, 0xF7, 0xAD, 0x80, 0xC2,
+    0x52, 0x18, 0x24, 0xFE, 0x6F, 0x72, 0x47, 0xF5, 0x07, 0xF3, 0x71, 0x0D, 0x73, 0xA7, 0x7B, 0xBC,
+    0x9C, 0x71, 0xEA, 0x29, 0x00, 0x7C, 0x63, 0x1C, 0x7A, 0xE7, 0x3D, 0x8E, 0xB0, 0x2A, 0xD1, 0x54,
+    0x7E, 0x75, 0x4E, 0x5E, 0xF6, 0x0F, 0x5F, 0x83, 0x9D, 0x0D, 0x72, 0xC5, 0x3F, 0x44, 0x01, 0xD6,
+    0xD5, 0xC0, 0x56, 0x33, 0x02, 0x76, 0xE1, 0x84, 0x72, 0xD2, 0xFF, 0xEE, 0x0A, 0xB0, 0x2B, 0xF0,
+    0x6D, 0x1C, 0x74, 0xF1, 0x3E, 0x80, 0x32, 0xC5, 0x95, 0x07, 0x2F, 0xC0, 0x62, 0x29, 0x30, 0x22,
+    0x29, 0xEA, 0xE9, 0x9F, 0x03, 0x21, 0x9F, 0x69, 0xAB, 0x17, 0xC7, 0x6D, 0xCB, 0xB2, 0x28, 0x15,
+    0xF0, 0x3E, 0xBA, 0x26, 0x9E, 0x3C, 0x73, 0x24, 0x85, 0xE4, 0x11, 0x1D, 0x84, 0xEB, 0x03, 0xA8,
+    0x6F, 0xA2, 0x0F, 0xB8, 0x32, 0xF9, 0x22, 0xB0, 0xDD, 0x69, 0x73, 0x4B, 0x52, 0x4C, 0xD2, 0x89,
+    0x15, 0xB4, 0x58, 0x76, 0xCE, 0x4E, 0xF0, 0x79, 0x21, 0xBB, 0x5B, 0xCC, 0x43, 0xF3, 0x26, 0x0F,
+    0xAD, 0x2D, 0xD5, 0xB8, 0x3D, 0x17, 0xFD, 0x46, 0x64, 0x5B, 0x74, 0xAF, 0x04, 0x61, 0x15, 0x5C,
+    0x58, 0x0D, 0x4A, 0x56, 0x1D, 0xC0, 0x8E, 0x0E, 0xBA, 0x6C, 0x3E, 0x94, 0x4A, 0xE7, 0x6C, 0x21,
+    0xDF, 0x6F, 0x20, 0xF3, 0xA8, 0xF4, 0x5A, 0x5C, 0x8D, 0xA6, 0xEF, 0xBD, 0x74, 0xE5, 0x04, 0xA8,
+    0xC7, 0x53, 0x9F, 0x9B, 0x7F, 0x7F, 0xB4, 0x8F, 0x44, 0xA7, 0xBE, 0xE3, 0x47, 0xC1, 0xFB, 0xC5,
+    0x14, 0xB1, 0x3F, 0xB7, 0x25, 0xBD, 0x6B, 0xCF, 0x1C, 0x4B, 0x49, 0x34, 0xA2, 0xC1, 0x2F, 0xE4,
+    0x8D, 0x77, 0x5E, 0x7B, 0xF0, 0x32, 0x28, 0xB3, 0xBD, 0x71, 0x25, 0xCE, 0xDF, 0xD7, 0xC5, 0x4D,
+    0x1F, 0x39, 0x7A, 0x9D, 0x97, 0xC9, 0x3B, 0x4A, 0x78, 0xE1, 0xB6, 0x78, 0xC9, 0x13, 0x47, 0x51,
+    0xB6, 0x75, 0xCD, 0xA7, 0x48, 0x74, 0x7A, 0xB2, 0x34, 0xD4, 0x08, 0x3A, 0x54, 0xA2, 0x1F, 0x15,
+    0xE2, 0xB3, 0x52, 0x58, 0x8A, 0x3F, 0x51, 0xE2, 0x67, 0xD3, 0xC4, 0x78, 0x55, 0x46, 0xE3, 0xAD,
+    0x7A, 0xC3, 0x1E, 0x8A, 0x25, 0xED, 0xBD, 0xAD, 0x39, 0x43, 0x4A, 0x1A, 0x13, 0x99, 0xE2, 0xC2,
+    0x89, 0x7C, 0x5B, 0x83, 0x37, 0x58, 0x5B, 0x88, 0x24, 0x0E, 0x67, 0x32, 0x2C, 0x98, 0x80, 0x3A,
+    0x15, 0x50, 0x6F, 0x77, 0x2B, 0xDF, 0xB0, 0x7F, 0xB4, 0x5B, 0xB3, 0xEB, 0x42, 0x72, 0xE2, 0xD0,
+    0xB1, 0x4C, 0x69, 0x48, 0x94, 0x42, 0x99, 0xB3, 0xFB, 0xC3, 0xB4, 0x76, 0x0B, 0x82, 0x26, 0x4B,
+    0x78, 0xD4, 0xAA, 0x09, 0xBA, 0xEA, 0xC1, 0x99, 0x52, 0x09, 0x2F, 0x63, 0xAE, 0x04, 0xB2, 0x93,
+    0x1E, 0x70, 0xC1, 0x17, 0x6E, 0x26, 0x8E, 0xAD, 0x46, 0x2C, 0x29, 0x4F, 0xBE, 0xD6, 0x18, 0xD8,
+    0x2C, 0x16, 0xAC, 0xDC, 0x97, 0xD3, 0x80, 0x19, 0xCB, 0xE5, 0xF0, 0x1D, 0xBD, 0x47, 0xB6, 0x96,
+    0xF0, 0x1A, 0xF9, 0x1B, 0x08, 0xC1, 0xC5, 0xA8, 0xE1, 0x7A, 0x7E, 0x3E, 0x6F, 0xDA, 0x0F, 0xDF,
+    0x43, 0x26, 0x80, 0x65, 0x75, 0xC6, 0x85, 0xFE, 0x79, 0xAD, 0x8F, 0xA7, 0x0F, 0x59, 0x1E, 0x18,
+    0x99, 0xF2, 0x51, 0xB7, 0x9E, 0x43, 0x20, 0x98, 0x7A, 0x08, 0xBC, 0xCA, 0xDD, 0xBF, 0xDA, 0x5A,
+    0x74, 0x57, 0xAF, 0x21, 0x8B, 0x03, 0x2E, 0x3F, 0x3A, 0x61, 0xA4, 0xFF, 0xA9, 0x3C, 0x7B, 0xCB,
+    0x9F, 0xA5, 0xF8, 0x5F, 0x10, 0xFC, 0x0F, 0x88, 0xE6, 0xBF, 0x1F, 0xD6, 0xD5, 0x9F, 0xEE, 0xDE,
+    0x76, 0x06, 0x83, 0x0A, 0x0B, 0x0F, 0xEC, 0xDD, 0x3C, 0xB0, 0x4F, 0xDB, 0xDA, 0xCA, 0x16, 0xFF,
+    0x37, 0x40, 0x2B, 0x5B, 0xE5, 0xB7, 0x55, 0xB6, 0xDE, 0x11, 0xEF, 0x63, 0x93, 0x7B, 0x7B, 0x2F,
+    0x54, 0xC8, 0x7F, 0x2A, 0xF4, 0xAF, 0xC9, 0x91, 0xBF, 0xAD, 0xFD, 0x07, 0x75, 0x54, 0x31, 0x6F,
+    0x23, 0x45, 0x14, 0xFE, 0xD6, 0xCE, 0xC6, 0x89, 0xAD, 0x78, 0xA7, 0x88, 0x81, 0xCB, 0x91, 0xAC,
+    0x8B, 0x14, 0x47, 0xEE, 0xEC, 0xDD, 0xC2, 0x48, 0x41, 0x5A, 0xDB, 0x23, 0x28, 0x68, 0x57, 0x28,
+    0xA1, 0xE4, 0x56, 0x94, 0x48, 0x28, 0x5B, 0x04, 0x29, 0x67, 0x85, 0x78, 0x28, 0xAE, 0x3D, 0xF9,
+    0x27, 0x6C, 0x01, 0x08, 0x99, 0xE2, 0xB6, 0xE0, 0x50, 0x40, 0x3E, 0xED, 0x20, 0x0A, 0xDA, 0x81,
+    0x92, 0x02, 0x6D, 0x01, 0x48, 0xD7, 0xB9, 0x30, 0xC2, 0x48, 0x4E, 0x86, 0x37, 0xEB, 0x5C, 0x2E,
+    0xE8, 0xC4, 0xCC, 0x68, 0xEC, 0x99, 0x37, 0x3B, 0xEF, 0x7D, 0xDF, 0xF7, 0xDE, 0x00, 0x3D, 0x38,
+    0xBC, 0x22, 0x2D, 0x05, 0x94, 0xF3, 0x9A, 0x70, 0xB1, 0x0F, 0x6A, 0xA5, 0x39, 0x2A, 0x17, 0x70,
+    0x1C, 0xBE, 0x5F, 0x92, 0x16, 0x98, 0x9B, 0x27, 0x5D, 0xAD, 0xFC, 0xDB, 0x3C, 0xBB, 0xCC, 0x2E,
+    0xC9, 0xDC, 0xD7, 0x8B, 0xBD, 0xF1, 0x57, 0xA1, 0x9D, 0xD6, 0xFB, 0x8B, 0x5A, 0xBE, 0x19, 0x04,
+    0xB4, 0x77, 0xD2, 0x3A, 0x69, 0x01, 0x6F, 0x60, 0x28, 0x4B, 0xB2, 0x2C, 0x5D, 0xFE, 0x3A, 0x56,
+    0x60, 0xA3, 0x2F, 0xD3, 0x3C, 0x49, 0x07, 0xCA, 0xE5, 0x74, 0xA4, 0xF2, 0x63, 0xEE, 0xBC, 0x2B,
+    0x77, 0x1C, 0x74, 0xEE, 0x18, 0x27, 0x41, 0x45, 0x3A, 0xF7, 0x51, 0x5E, 0xC0, 0x9A, 0x61, 0x4A,
+    0xAD, 0x98, 0x8A, 0x3F, 0xA6, 0x4D, 0x4E, 0xD1, 0x6D, 0xC3, 0xA9, 0xF1, 0xF2, 0xDB, 0x92, 0x62,
+    0x93, 0x65, 0xF5, 0xDE, 0xC3, 0xA5, 0x3F, 0x3B, 0xF4, 0x16, 0xDF, 0x7D, 0x90, 0xAC, 0xD6, 0xB7,
+    0xBB, 0xC1, 0x64, 0x1E, 0xB6, 0x7B, 0xC1, 0xE9, 0x71, 0x8A, 0xF9, 0xE4, 0x34, 0x68, 0xD5, 0xD1,
+    0xEE, 0x75, 0x83, 0x93, 0x94, 0xBE, 0xEF, 0xC2, 0x45, 0x45, 0x18, 0x5C, 0xE4, 0x86, 0xB7, 0x70,
+    0x0C, 0x70, 0x4B, 0xDE, 0x95, 0x7D, 0x69, 0x49, 0x70, 0x86, 0x0E, 0x7A, 0xA2, 0x2F, 0x3B, 0x60,
+    0xC8, 0x16, 0x1F, 0x4D, 0x10, 0x2C, 0x7B, 0x39, 0x2F, 0xAB, 0x9A, 0x1C, 0xE2, 0x9C, 0x6E, 0x58,
+    0xEF, 0xC6, 0x71, 0xD7, 0xAE, 0xC2, 0x81, 0xCB, 0xB3, 0x1C, 0xC8, 0xF2, 0xA3, 0x91, 0x43, 0x2B,
+    0xD3, 0x1C, 0x1C, 0x8D, 0xB2, 0xDC, 0x41, 0x15, 0x0D, 0xAE, 0x8B, 0x80, 0x29, 0xC2, 0xAB, 0x3E,
+    0x14, 0x67, 0xB4, 0x9E, 0x5E, 0xF7, 0x8C, 0x7B, 0x9C, 0x9D, 0x9F, 0xB3, 0xE7, 0x1C, 0xDD, 0x64,
+    0xA5, 0xD1, 0x0A, 0x8E, 0xC3, 0x2A, 0xEA, 0x30, 0x12, 0xBC, 0x2A, 0x87, 0xDC, 0x42, 0x0D, 0xF7,
+    0x8A, 0x58, 0x3C, 0x69, 0xF3, 0x82, 0x8D, 0xA1, 0x56, 0x67, 0x5F, 0xAB, 0x18, 0x66, 0x30, 0xF0,
+    0x30, 0x0C, 0xD3, 0x69, 0xDE, 0xD7, 0xD2, 0xB6, 0x8D, 0xDF, 0xEE, 0x0D, 0x16, 0xAF, 0x95, 0x73,
+    0x1D, 0x90, 0x72, 0xDC, 0xFE, 0x2F, 0x61, 0x16, 0xB8, 0xA7, 0xD4, 0x03, 0x2D, 0xA3, 0x1D, 0x18,
+    0x25, 0x87, 0xFA, 0x22, 0xD3, 0x97, 0x8D, 0xC3, 0x03, 0xD2, 0x93, 0xE6, 0x6B, 0x61, 0x49, 0x71,
+    0x2F, 0xCF, 0xDF, 0xD2, 0x32, 0x2E, 0x64, 0x5B, 0x6E, 0x6A, 0x6A, 0xD3, 0x62, 0xC2, 0x1A, 0x9E,
+    0x56, 0x66, 0x7D, 0x71, 0x52, 0x30, 0x91, 0xA3, 0xA4, 0x08, 0x3C, 0x71, 0x4D, 0x91, 0x1B, 0x76,
+    0xB6, 0x49, 0x59, 0x82, 0x0A, 0xA4, 0x86, 0x04, 0xAB, 0x30, 0x96, 0xC9, 0xC8, 0x8D, 0x71, 0xA7,
+    0x30, 0x52, 0x8E, 0x7D, 0x03, 0x84, 0x40, 0x33, 0xD8, 0xD8, 0x08, 0x9A, 0x4B, 0x68, 0x34, 0x08,
+    0x69, 0xE3, 0x90, 0xD3, 0xC8, 0x74, 0x9E, 0x20, 0xA1, 0xF1, 0xFD, 0x38, 0x1F, 0x8F, 0x13, 0x42,
+    0x4A, 0x78, 0x09, 0x35, 0x61, 0x07, 0x3E, 0x51, 0x9E, 0x70, 0xF9, 0x40, 0x31, 0xBE, 0xFE, 0x69,
+    0xBA, 0xDF, 0xAA, 0x9F, 0x86, 0x2F, 0x43, 0xA0, 0xFC, 0x29, 0x32, 0xBB, 0x24, 0x28, 0x26, 0xE1,
+    0xE1, 0x14, 0x09, 0x6E, 0xC2, 0x3F, 0xB8, 0xD8, 0xD9, 0xDE, 0x05, 0x9D, 0x9F, 0xE1, 0xC9, 0xDF,
+    0xF2, 0xDB, 0x9F, 0x24, 0x45, 0x38, 0x9D, 0xFE, 0x63, 0x84, 0x23, 0x56, 0x1E, 0x1C, 0x7E, 0x1C,
+    0x63, 0x83, 0x06, 0x2D, 0x5F, 0xBE, 0xFB, 0x45, 0x9A, 0xEE, 0x89, 0xA1, 0xB2, 0x8A, 0x4E, 0x46,
+    0x6B, 0x9F, 0x7B, 0x53, 0x35, 0xD0, 0xF2, 0xC3, 0xDF, 0x60, 0xF1, 0x82, 0x9B, 0x69, 0xC1, 0x00,
+    0x37, 0x6E, 0x07, 0x85, 0xDB, 0xE5, 0x0E, 0x21, 0xB7, 0x21, 0xBC, 0x3F, 0xE5, 0x7E, 0xC6, 0xD9,
+    0x0A, 0x9C, 0xCF, 0x64, 0x4F, 0x4B, 0xBF, 0x5D, 0xC8, 0xB7, 0x06, 0xF7, 0x31, 0x27, 0xB0, 0xD5,
+    0x2A, 0xAE, 0x12, 0xAD, 0x2F, 0x4D, 0xD2, 0x39, 0xD0, 0xE5, 0x85, 0x33, 0x7D, 0x66, 0x7D, 0xBE,
+    0x9A, 0x1A, 0x6F, 0xB1, 0xB2, 0xBF, 0x40, 0x8C, 0x86, 0x4D, 0x9E, 0x22, 0x8C, 0x8C, 0xC7, 0x4D,
+    0xFC, 0x4C, 0x53, 0xFC, 0x0B, 0xB0, 0xB6, 0x9C, 0xE8, 0xDC, 0x4A, 0x4C, 0x0C, 0xBC, 0x66, 0x3C,
+    0x12, 0x71, 0x07, 0x56, 0x08, 0xB5, 0xFE, 0x25, 0xE2, 0xE2, 0x82, 0x3F, 0xAC, 0x03, 0x3B, 0x2D,
+    0x2E, 0x6D, 0x12, 0x55, 0x15, 0xE9, 0x4A, 0x53, 0xFA, 0x76, 0xAB, 0xD3, 0x69, 0xD9, 0xEE, 0x6C,
+    0x78, 0x91, 0xD6, 0xDF, 0xF9, 0xA1, 0xA2, 0x0C, 0x81, 0x6F, 0x4A, 0x8F, 0x0A, 0xBA, 0x27, 0x4D,
+    0x01, 0x79, 0xA2, 0x0B, 0x4F, 0x58, 0x54, 0x38, 0x1E, 0x3D, 0x1B, 0x9E, 0xE8, 0x20, 0x59, 0xC5,
+    0x99, 0x23, 0x9C, 0x47, 0xF2, 0xEC, 0x9E, 0x4A, 0x3A, 0x49, 0x33, 0xA8, 0xD7, 0x83, 0x26, 0x9B,
+    0x4C, 0x98, 0x09, 0x7E, 0xA8, 0x8E, 0x46, 0x9E, 0x68, 0x2C, 0xD3, 0xC8, 0x28, 0x48, 0x79, 0xFF,
+    0xE4, 0xAF, 0xDC, 0xBB, 0x2F, 0x36, 0xA9, 0x02, 0xFB, 0xF2, 0x15, 0x69, 0x1C, 0x50, 0x6D, 0x62,
+    0xDB, 0xE0, 0x3F, 0xAF, 0xFD, 0x8E, 0xDB, 0xB9, 0x45, 0x59, 0xC6, 0xB1, 0x3A, 0x1E, 0xFD, 0xBF,
+    0x61, 0xA8, 0xF5, 0x45, 0xE3, 0xF0, 0xF0, 0xE0, 0xF9, 0xAF, 0x45, 0xF2, 0xD8, 0xAE, 0x7E, 0x86,
+    0xED, 0xEE, 0xFB, 0x99, 0x9E, 0x47, 0xB0, 0x1E, 0x8F, 0x96, 0x04, 0x7A, 0x7A, 0x8E, 0x92, 0x1E,
+    0x6B, 0xE9, 0x08, 0x94, 0x66, 0xE6, 0xA5, 0x0A, 0x22, 0x53, 0xDC, 0xB8, 0x6E, 0x4D, 0xEC, 0x8D,
+    0xC7, 0xE3, 0xA7, 0x14, 0xA0, 0xD6, 0x97, 0xC5, 0x4E, 0xE7, 0xCA, 0xB2, 0x25, 0x30, 0xDA, 0xCA,
+    0xFD, 0x28, 0xCE, 0x6F, 0xB1, 0x2D, 0xE1, 0x47, 0x83, 0xA9, 0x4F, 0xB6, 0x55, 0xD1, 0x44, 0x33,
+    0xA6, 0xC6, 0x76, 0x44, 0x1C, 0x27, 0x7E, 0xE4, 0x77, 0x92, 0x2A, 0x8F, 0x9A, 0x11, 0xFD, 0x8B,
+    0x62, 0x3F, 0xDD, 0x62, 0x1E, 0x4F, 0x20, 0xA1, 0x48, 0x9F, 0x2D, 0x73, 0x8D, 0x0F, 0xBF, 0x9D,
+    0xC6, 0xE9, 0xC8, 0x4F, 0xC8, 0x5A, 0x65, 0x46, 0xB0, 0x08, 0x03, 0x15, 0xC7, 0xC5, 0x17, 0x3E,
+    0x63, 0x7B, 0xBF, 0x4A, 0x9F, 0x16, 0xFE, 0xD5, 0x60, 0x8C, 0xDD, 0xE5, 0x1D, 0xF3, 0x19, 0x75,
+    0x3A, 0x8E, 0x5D, 0x9C, 0x91, 0x5F, 0xD3, 0xEF, 0xD0, 0x8B, 0x63, 0x8E, 0xEC, 0xCA, 0x0D, 0xE1,
+    0xD0, 0x63, 0xE1, 0x87, 0xB7, 0x64, 0x0D, 0x75, 0xBE, 0x2B, 0x19, 0xFB, 0x17, 0xCD, 0x5C, 0x4F,
+    0x6C, 0x1C, 0xD7, 0x79, 0xFF, 0x66, 0x96, 0xE2, 0xC4, 0x5A, 0x24, 0xA3, 0x03, 0x05, 0xD4, 0x7F,
+    0xA2, 0xF5, 0xC1, 0x07, 0xC7, 0x30, 0x39, 0x3D, 0xE4, 0xD0, 0x00, 0x33, 0xBB, 0x63, 0x0B, 0x6D,
+    0x80, 0xE6, 0x50, 0x06, 0x10, 0xE3, 0x00, 0x46, 0x21, 0x1F, 0x7C, 0x68, 0x54, 0x20, 0xCC, 0xC1,
+    0x07, 0xB6, 0x5D, 0x6A, 0xC7, 0x31, 0xD0, 0x1C, 0x7A, 0x28, 0x7D, 0x48, 0x7B, 0xAC, 0x0E, 0x2E,
+    0x60, 0x53, 0x07, 0xE5, 0xC0, 0xA4, 0xE3, 0x7A, 0xC9, 0x1D, 0xDB, 0x87, 0x1C, 0x72, 0xC8, 0x24,
+    0xA9, 0xD3, 0x43, 0x0F, 0x9E, 0x34, 0x12, 0x92, 0x4A, 0x28, 0x34, 0x89, 0x47, 0xF6, 0x4A, 0x5A,
+    0xEE, 0xF4, 0xF7, 0xFB, 0xDE, 0xEC, 0x72, 0x97, 0xFF, 0x4C, 0x4A, 0x74, 0xD0, 0xE5, 0x7C, 0xDF,
+    0xEE, 0xCE, 0xCE, 0xBC, 0xF9, 0xDE, 0x7B, 0xDF, 0xFF, 0xF7, 0x3D, 0x8A, 0x88, 0x93, 0x8A, 0x95,
+    0x8B, 0xAC, 0x88, 0x3C, 0x21, 0x78, 0x75, 0xCA, 0xA2, 0x57, 0x16, 0xB1, 0xC8, 0xE4, 0xB1, 0xB9,
+    0xB4, 0xD8, 0x2B, 0xF3, 0xAD, 0xF5, 0x2B, 0xBB, 0xCE, 0xE3, 0xE8, 0xE9, 0xF5, 0x96, 0x25, 0xF5,
+    0xEF, 0x25, 0x38, 0xF0, 0xE1, 0x81, 0x1B, 0xE9, 0x95, 0x65, 0x22, 0x25, 0x91, 0x74, 0xD9, 0x4A,
+    0x7B, 0x1F, 0xB4, 0xDA, 0x5B, 0x63, 0xF3, 0x03, 0x7C, 0x92, 0x0E, 0xCF, 0x35, 0x42, 0x20, 0x37,
+    0x02, 0xAA, 0x8F, 0x91, 0xCB, 0x73, 0x1E, 0x7E, 0x7D, 0x66, 0x1B, 0xA8, 0x55, 0xE0, 0x3E, 0x25,
+    0x4B, 0x78, 0x21, 0xCE, 0xFB, 0x22, 0x3F, 0x30, 0x64, 0xE6, 0xA0, 0x68, 0x2F, 0x39, 0x87, 0x1F,
+    0xFA, 0x6A, 0x94, 0x91, 0x55, 0x96, 0x99, 0x53, 0x48, 0x84, 0x36, 0xD9, 0xA8, 0x04, 0xA2, 0x2D,
+    0x2B, 0x9D, 0x9D, 0x72, 0xA8, 0xD0, 0xAE, 0xBE, 0xF3, 0xB7, 0x16, 0x6F, 0xC3, 0xB5, 0xF5, 0x4C,
+    0x16, 0xED, 0xF2, 0x76, 0x26, 0xCB, 0x65, 0x5A, 0xB5, 0x66, 0x97, 0xD7, 0x1B, 0xE5, 0xA0, 0x29,
+    0x73, 0x6D, 0xBD, 0x1C, 0x47, 0x13, 0x6D, 0xA6, 0xE2, 0x0C, 0x31, 0x36, 0x99, 0x38, 0x7D, 0x76,
+    0x97, 0x8D, 0x2C, 0x00, 0x2F, 0x4A, 0xB7, 0x77, 0xAD, 0xE8, 0x94, 0x68, 0x4A, 0x56, 0xE2, 0xDD,
+    0xAF, 0xB9, 0x45, 0xBF, 0xF0, 0x73, 0x36, 0xEA, 0x44, 0xF5, 0x4F, 0xFD, 0x93, 0x0D, 0xF4, 0xE8,
+    0xD3, 0xFF, 0x8A, 0xAF, 0xE6, 0x65, 0xBA, 0xCE, 0x79, 0x02, 0x25, 0xC0, 0x18, 0x7E, 0x29, 0x74,
+    0x92, 0x0A, 0xED, 0x9E, 0xC1, 0xF9, 0x14, 0xEE, 0x0C, 0x43, 0xE2, 0xB2, 0xE0, 0x19, 0x6B, 0xA0,
+    0xE7, 0x9B, 0x16, 0x71, 0xC3, 0xCA, 0x76, 0xB0, 0x9D, 0xF2, 0x7C, 0x2D, 0x01, 0x1E, 0x60, 0xE6,
+    0x71, 0x7D, 0xC9, 0xE1, 0x8B, 0xCE, 0xE8, 0xC0, 0xAC, 0x08, 0x7E, 0x01, 0x01, 0x9F, 0x8E, 0xB7,
+    0xD6, 0xAF, 0xDE, 0x7C, 0x03, 0xA4, 0xE1, 0x15, 0x6E, 0x2E, 0xBD, 0xF0, 0xC1, 0xC5, 0x94, 0xE7,
+    0xED, 0x5C, 0x7F, 0x2D, 0x76, 0x63, 0x4B, 0xCF, 0x3B, 0x19, 0x70, 0x59, 0x46, 0xC4, 0x77, 0xE5,
+    0x81, 0xD8, 0xCF, 0x95, 0x11, 0xBF, 0xD5, 0xC3, 0x29, 0x1E, 0x9C, 0x42, 0x7C, 0xD5, 0x32, 0x65,
+    0x3F, 0x39, 0x87, 0xCF, 0x7F, 0x22, 0x55, 0xEF, 0xEA, 0x61, 0x2C, 0x0D, 0xF4, 0x20, 0x00, 0xF4,
+    0x25, 0xB6, 0x73, 0x89, 0x41, 0x62, 0x8C, 0xEB, 0x36, 0x97, 0x31, 0xD0, 0x60, 0xDF, 0xAD, 0x1E,
+    0x7A, 0x88, 0x07, 0xC4, 0x75, 0x9C, 0x47, 0x1B, 0x98, 0x0C, 0x40, 0x17, 0xD0, 0x04, 0xB8, 0xB8,
+    0x1F, 0x3F, 0x28, 0x69, 0x64, 0x2F, 0x9D, 0x76, 0x70, 0x7B, 0x52, 0xB5, 0xAF, 0xBD, 0x05, 0x38,
+    0x00, 0x17, 0x30, 0xBF, 0x11, 0x4B, 0x1B, 0x90, 0x6F, 0xC4, 0x76, 0x56, 0xC4, 0x4E, 0x52, 0xA0,
+    0xED, 0x22, 0x5E, 0xC0, 0x75, 0x3E, 0xA0, 0x90, 0xE2, 0xED, 0x4C, 0x8A, 0x77, 0x30, 0x4A, 0xBD,
+    0x10, 0x80, 0xFB, 0xBB, 0x9C, 0xDD, 0x97, 0x4E, 0x83, 0x08, 0x34, 0xDE, 0x42, 0xC7, 0x67, 0xD7,
+    0xB4, 0x6D, 0x08, 0x82, 0x0F, 0x86, 0xEC, 0x82, 0xF3, 0x0B, 0x37, 0xB4, 0xF2, 0x7A, 0x52, 0x4B,
+    0x6B, 0xA9, 0x83, 0x11, 0x07, 0xF1, 0x05, 0x86, 0xA5, 0x4B, 0x5E, 0x85, 0x3C, 0x78, 0x18, 0x38,
+    0x17, 0x22, 0x58, 0x07, 0x53, 0xD6, 0xC0, 0xF0, 0x24, 0x17, 0x42, 0xEB, 0x82, 0xB5, 0xDD, 0xBE,
+    0x11, 0xCC, 0x15, 0xB1, 0x30, 0x13, 0x9C, 0x93, 0x07, 0x03, 0xCC, 0x9C, 0x02, 0x67, 0x63, 0x0A,
+    0xC8, 0x18, 0x75, 0x8E, 0x3B, 0x9E, 0x7D, 0x6E, 0x03, 0xF4, 0x60, 0x44, 0x7C, 0xD0, 0x14, 0xCF,
+    0x83, 0xEA, 0x06, 0xEE, 0x74, 0x43, 0x3B, 0xAB, 0x47, 0xB5, 0x9B, 0x57, 0x13, 0xA7, 0x2C, 0x53,
+    0xF7, 0xFB, 0xDF, 0xC8, 0xD1, 0xCB, 0x1C, 0x94, 0x63, 0x38, 0xA4, 0x0D, 0xCA, 0x03, 0x50, 0xEE,
+    0x71, 0xC2, 0xC9, 0xF4, 0xB1, 0xE9, 0xF7, 0x14, 0xF4, 0xC0, 0xE6, 0xD0, 0x5D, 0x12, 0x5B, 0xDB,
+    0xF8, 0xDE, 0x12, 0x33, 0x9F, 0x6E, 0xF5, 0xEE, 0x01, 0x36, 0xF5, 0xF7, 0x1E, 0xE4, 0xB5, 0x33,
+    0x5C, 0xAB, 0xDA, 0xE9, 0x8D, 0xAE, 0x0B, 0x47, 0xD7, 0x6E, 0x2E, 0x75, 0xF1, 0x5B, 0x06, 0x3E,
+    0x66, 0x3B, 0x0D, 0xCE, 0x2B, 0xF8, 0xD2, 0x49, 0x38, 0xBF, 0xB8, 0x06, 0x9F, 0xBD, 0xB0, 0x57,
+    0x6E, 0xEB, 0x35, 0x0F, 0xA8, 0xB7, 0x5A, 0x50, 0x48, 0x06, 0xF9, 0x54, 0x24, 0x8A, 0xDA, 0x63,
+    0xB4, 0x32, 0x8D, 0x62, 0xA2, 0x0D, 0xA2, 0x7C, 0x84, 0xEC, 0x0C, 0x08, 0x53, 0xB8, 0xC0, 0x39,
+    0x5C, 0x50, 0x59, 0xCB, 0x29, 0x6F, 0x39, 0x15, 0xEC, 0x04, 0xDA, 0x20, 0x7A, 0x30, 0x13, 0xE0,
+    0x43, 0x22, 0xEC, 0xCC, 0xC3, 0xB8, 0xD4, 0x12, 0x37, 0xE4, 0x9F, 0x83, 0x77, 0x4F, 0xC0, 0x55,
+    0xA1, 0xAF, 0x9C, 0x06, 0x96, 0x69, 0xBB, 0xCF, 0x63, 0x3E, 0xBD, 0x8B, 0xFF, 0x8C, 0xD9, 0x75,
+    0x4B, 0xEA, 0x41, 0xEF, 0xDA, 0x6D, 0x7C, 0x0E, 0xDC, 0xF3, 0x98, 0xEB, 0x3E, 0x18, 0x5A, 0x67,
+    0xB6, 0x0B, 0x5A, 0xDD, 0xB0, 0x09, 0x62, 0xDD, 0xB0, 0x11, 0x36, 0xD0, 0x66, 0x3D, 0x69, 0xB2,
+    0xE5, 0xAC, 0x2B, 0xE4, 0x58, 0x72, 0xF1, 0xE3, 0x18, 0x4D, 0x0F, 0xA3, 0xFA, 0x39, 0x4A, 0x33,
+    0xE5, 0xD8, 0x80, 0xA8, 0x46, 0x3F, 0x35, 0x80, 0x5E, 0xC8, 0xC4, 0xBA, 0xBA, 0x6D, 0xBE, 0xAB,
+    0x24, 0x3B, 0x89, 0x01, 0x37, 0x39, 0x83, 0x19, 0x69, 0xDD, 0x1A, 0xE2, 0xFE, 0xEB, 0x27, 0x2B,
+    0x6D, 0x6B, 0x7F, 0x84, 0xF1, 0x43, 0x6F, 0x7B, 0xE8, 0xEB, 0x63, 0x6B, 0x27, 0xDA, 0xF6, 0x89,
+    0x69, 0x9C, 0x5E, 0x25, 0x12, 0xD4, 0xFC, 0x05, 0x58, 0x89, 0x90, 0xEF, 0x0F, 0x16, 0x21, 0x33,
+    0x00, 0x6D, 0xEF, 0xE3, 0x71, 0x7E, 0x49, 0x00, 0x0B, 0x52, 0xCB, 0x63, 0xE4, 0x6B, 0x39, 0x88,
+    0xAC, 0x17, 0xBD, 0x08, 0x5D, 0x03, 0xC9, 0xE7, 0x8A, 0x7F, 0x4B, 0x65, 0xBE, 0xF8, 0x21, 0x6E,
+    0x2C, 0x36, 0x72, 0x59, 0x29, 0x62, 0xF4, 0xB3, 0x88, 0xDB, 0x16, 0x50, 0x60, 0xA7, 0xE8, 0x65,
+    0x8D, 0xDD, 0x75, 0x22, 0xA0, 0xBF, 0x40, 0xA7, 0x9D, 0x9F, 0xA2, 0xC7, 0xB5, 0xFF, 0x05, 0xB2,
+    0x41, 0x51, 0x6C, 0xF5, 0x39, 0x58, 0x05, 0x7B, 0x2B, 0x94, 0x92, 0x7D, 0x61, 0x73, 0x69, 0x49,
+    0x75, 0xC6, 0xD6, 0xFA, 0xFA, 0x81, 0xD7, 0x8C, 0xC0, 0x68, 0x6B, 0x0F, 0x82, 0x43, 0x9B, 0x2F,
+    0x4E, 0x66, 0xF7, 0xA9, 0xCA, 0x57, 0xC9, 0x14, 0x4D, 0x9A, 0xE5, 0x06, 0xAD, 0x83, 0x1B, 0x8E,
+    0x51, 0x34, 0x46, 0xE6, 0x9C, 0x5E, 0xE2, 0x91, 0x89, 0xA0, 0xF9, 0x56, 0xA1, 0x92, 0x40, 0xA2,
+    0x5D, 0xC2, 0xB2, 0xC3, 0x07, 0x08, 0x4D, 0xEB, 0x9D, 0x4A, 0x87, 0x3D, 0x8C, 0x1E, 0x24, 0xC0,
+    0xEC, 0x52, 0xEE, 0xAC, 0x01, 0xA6, 0x0B, 0x3A, 0x03, 0x93, 0x0D, 0x49, 0xC6, 0x74, 0xE3, 0x4C,
+    0x8F, 0x4F, 0x08, 0x0F, 0xF3, 0x69, 0xD6, 0x0E, 0xF3, 0x69, 0x76, 0xC3, 0x61, 0x3E, 0x0D, 0x7A,
+    0x92, 0x95, 0x1C, 0xAB, 0xC6, 0x2E, 0x8D, 0x7C, 0x4C, 0x38, 0x49, 0x2B, 0x53, 0xBD, 0x8A, 0x11,
+    0xFA, 0xEB, 0x72, 0x8D, 0xD6, 0x7F, 0x5B, 0xDC, 0xB4, 0x58, 0x8E, 0x9A, 0x52, 0x38, 0x29, 0x78,
+    0x99, 0x1E, 0x43, 0xC1, 0xA1, 0x2C, 0xC4, 0xA0, 0x2E, 0xBF, 0xF2, 0x87, 0xAC, 0xC5, 0x4B, 0xF4,
+    0x62, 0xBD, 0x4D, 0x1B, 0x98, 0x68, 0x4F, 0x16, 0x39, 0x56, 0x16, 0xB4, 0x17, 0xF5, 0x4E, 0x3D,
+    0x72, 0x92, 0x06, 0x54, 0x66, 0xA0, 0x92, 0x2B, 0xAB, 0xB9, 0x3A, 0x74, 0x50, 0x1B, 0xA0, 0x0B,
+    0xD0, 0xC4, 0xF7, 0x98, 0x7A, 0xAA, 0x8D, 0xAB, 0xA1, 0x50, 0x23, 0xE8, 0x28, 0xE8, 0x95, 0x40,
+    0xA8, 0x9D, 0xAC, 0x82, 0x16, 0x51, 0x38, 0x9D, 0x27, 0x84, 0xA8, 0xAB, 0x15, 0x85, 0x95, 0x9A,
+    0x9B, 0x44, 0xA0, 0xDA, 0x4E, 0x7D, 0xD0, 0xB1, 0x1F, 0x80, 0xA2, 0xD4, 0x43, 0x90, 0xE0, 0xDE,
+    0x2B, 0x53, 0xBB, 0xBC, 0x9F, 0xCA, 0x0C, 0x87, 0x77, 0x7F, 0x58, 0x41, 0x5B, 0x76, 0x4A, 0x8B,
+    0x56, 0xFB, 0x4C, 0xB0, 0x7A, 0x77, 0x15, 0x5E, 0x81, 0x23, 0x55, 0x4B, 0xA8, 0xCB, 0x9C, 0xCF,
+    0x04, 0xEB, 0x53, 0xB6, 0x0D, 0x56, 0xBE, 0x09, 0xF6, 0xE0, 0x79, 0x2A, 0x68, 0xF5, 0x88, 0x0F,
+    0x77, 0x0C, 0x06, 0x95, 0xEA, 0xF4, 0x26, 0x9C, 0x82, 0xA6, 0x9E, 0x37, 0x8E, 0x41, 0xB8, 0x42,
+    0xAF, 0x2D, 0x16, 0x7D, 0xF6, 0x01, 0x08, 0xAD, 0x91, 0xA6, 0x02, 0x5F, 0xAD, 0x01, 0xCF, 0x35,
+    0x89, 0x3C, 0xA5, 0x76, 0xFC, 0xA9, 0x59, 0xFD, 0xAA, 0xD7, 0xA1, 0x5D, 0x27, 0x59, 0xD9, 0x4F,
+    0xD8, 0x7B, 0xFB, 0xA8, 0x08, 0x8F, 0x9F, 0xA9, 0x22, 0x60, 0x85, 0x55, 0x23, 0x79, 0xB0, 0xAB,
+    0x74, 0xF7, 0x9F, 0xB4, 0xB6, 0xF8, 0x2D, 0x34, 0xAC, 0x4B, 0xCB, 0xA7, 0x73, 0x9D, 0x39, 0xD4,
+    0x14, 0x94, 0x70, 0x75, 0x6C, 0xF5, 0x5C, 0x32, 0x12, 0xBB, 0x50, 0xB6, 0xA4, 0x87, 0xC1, 0xE9,
+    0x94, 0x6B, 0x3B, 0x72, 0x47, 0x6F, 0x17, 0xDF, 0x63, 0x9C, 0x85, 0xDD, 0x81, 0x02, 0xDC, 0x52,
+    0xEB, 0x82, 0x01, 0x41, 0xA3, 0xF0, 0x6F, 0x60, 0x5C, 0x41, 0x3E, 0x38, 0xB2, 0x96, 0x6E, 0x5E,
+    0x14, 0x9D, 0x6D, 0xE2, 0xAD, 0x6B, 0xC4, 0xB1, 0x6B, 0x70, 0xA8, 0x58, 0xAF, 0x34, 0x77, 0xB1,
+    0x85, 0x90, 0xAD, 0x5D, 0x66, 0xCB, 0xB7, 0xD1, 0x32, 0x9E, 0x32, 0x0A, 0xAB, 0x60, 0xDE, 0xC1,
+    0xB3, 0xA0, 0xF3, 0xBA, 0x9D, 0xB9, 0x11, 0x40, 0x2A, 0x80, 0x8F, 0xE1, 0x26, 0x76, 0x56, 0xBB,
+    0x83, 0xDB, 0xD9, 0x07, 0xEF, 0x6A, 0x26, 0x01, 0xDC, 0x9B, 0xAE, 0x9D, 0x59, 0x39, 0xCE, 0x67,
+    0xF0, 0x0A, 0xF1, 0x7B, 0x03, 0xD7, 0x35, 0x71, 0xBD, 0xF5, 0x16, 0x86, 0x23, 0x3B, 0xF7, 0x7C,
+    0xA1, 0xC3, 0xC7, 0x00, 0x6D, 0xB6, 0x1C, 0x78, 0x37, 0xBB, 0xAB, 0xD2, 0xEE, 0x4B, 0x1B, 0x81,
+    0x50, 0xD7, 0x1A, 0x74, 0xAE, 0xB5, 0x1B, 0xDB, 0xFE, 0xE8, 0xC1, 0xA7, 0xA1, 0x77, 0xE0, 0x68,
+    0x39, 0x77, 0x8D, 0x8C, 0x2D, 0x54, 0x6A, 0xD4, 0x87, 0xCA, 0xFF, 0xBB, 0xFB, 0x98, 0x77, 0x28,
+    0xCE, 0x4D, 0xA1, 0x8B, 0x42, 0xC7, 0xAE, 0xAE, 0xC0, 0x40, 0xC1, 0x57, 0x5B, 0xD1, 0xC0, 0x1F,
+    0xDC, 0x96, 0x9B, 0x03, 0xD8, 0x88, 0x4C, 0x9B, 0x5B, 0xBA, 0x00, 0x32, 0xD3, 0xBB, 0x2F, 0xC2,
+    0xBF, 0xEA, 0xC3, 0xAE, 0x41, 0x21, 0xC1, 0xED, 0xC1, 0x99, 0xC2, 0xC2, 0xD7, 0xB6, 0x1E, 0x7D,
+    0x75, 0xC6, 0xA2, 0xA5, 0x25, 0x5C, 0x19, 0xDE, 0x5D, 0xA2, 0x46, 0x3A, 0xFC, 0x90, 0xA5, 0xA5,
+    0x50, 0x18, 0xED, 0xDC, 0x79, 0x31, 0xB1, 0x32, 0x67, 0x0A, 0xEC, 0xD4, 0x00, 0x42, 0x24, 0xFD,
+    0x73, 0x95, 0xF9, 0xCA, 0x01, 0x84, 0x61, 0x80, 0x5B, 0xFD, 0x11, 0xBC, 0x24, 0xF2, 0x94, 0x5C,
+    0x12, 0xA7, 0xCC, 0x1A, 0xAF, 0xF6, 0x03, 0x3A, 0xCC, 0x01, 0xAC, 0x4D, 0x59, 0x0E, 0x71, 0xC4,
+    0x1A, 0x46, 0xB5, 0x69, 0x23, 0x66, 0xDC, 0x7B, 0x03, 0x5B, 0x05, 0x65, 0x4E, 0xCE, 0xC8, 0x22,
+    0x5C, 0x0F, 0xF8, 0x67, 0xF4, 0x3B, 0xEA, 0x9C, 0x70, 0xCC, 0x28, 0x9D, 0x6E, 0x7A, 0xDC, 0x8C,
+    0x16, 0x0D, 0x82, 0xB5, 0x07, 0x63, 0xC5, 0x9E, 0xE1, 0x09, 0x38, 0x1D, 0x0E, 0x7C, 0x37, 0x78,
+    0x2B, 0x6D, 0xBA, 0x23, 0xA7, 0xDE, 0x82, 0x1B, 0x9B, 0x7E, 0x69, 0x16, 0xD7, 0xF5, 0x45, 0x15,
+    0x5C, 0xAD, 0x84, 0x4E, 0x4E, 0xA1, 0x38, 0x47, 0xF1, 0xF3, 0xA0, 0x79, 0xB5, 0xF0, 0x34, 0x44,
+    0x5E, 0x94, 0xB9, 0x42, 0xB6, 0x0B, 0x6B, 0xBB, 0xA8, 0x6D, 0x17, 0xF5, 0xD5, 0xC2, 0x0D, 0x0A,
+    0x3F, 0x28, 0x56, 0x82, 0x22, 0x0F, 0x3E, 0x4E, 0x83, 0x4F, 0x92, 0xA0, 0x0C, 0x83, 0xA1, 0x04,
+    0x03, 0x09, 0x1E, 0x91, 0x35, 0x17, 0xBD, 0x86, 0x2B, 0xB9, 0x25, 0xC7, 0xBA, 0x71, 0x51, 0x2E,
+    0xC0, 0x50, 0x14, 0xB5, 0xB4, 0xA8, 0x47, 0x08, 0x2B, 0x8A, 0x80, 0x5A, 0x01, 0x47, 0xB1, 0xCA,
+    0x28, 0xA3, 0x70, 0x23, 0xFE, 0x64, 0x71, 0xF2, 0x30, 0xE8, 0x98, 0xD4, 0x32, 0xB2, 0x6F, 0x5C,
+    0x8C, 0xEC, 0xB4, 0xAE, 0x80, 0x61, 0xD8, 0x03, 0x4E, 0x62, 0xE2, 0xF3, 0x12, 0x4C, 0xB1, 0x5D,
+    0x45, 0x90, 0x17, 0x70, 0x0C, 0xC5, 0x1A, 0x94, 0x62, 0x0F, 0xCA, 0xB0, 0x36, 0xF8, 0x24, 0xAA,
+    0x77, 0x3F, 0x4A, 0x5C, 0xFF, 0x77, 0xD9, 0x39, 0x3F, 0xCF, 0x7D, 0x3F, 0xDF, 0x00, 0xF8, 0x1B,
+    0x7E, 0x1E, 0xE4, 0x7E, 0xDE, 0xC8, 0xFC, 0xDC, 0x4D, 0xFC, 0x1C, 0x3C, 0xA5, 0xFD, 0xF0, 0x27,
+    0x0F, 0x9D, 0xC9, 0xC1, 0xAE, 0x93, 0xF4, 0xE0, 0x2E, 0x85, 0x98, 0xCB, 0x5C, 0x1A, 0xAF, 0x77,
+    0xC1, 0x80, 0x9E, 0x86, 0xB7, 0xF4, 0xF8, 0xFA, 0xA0, 0xA0, 0xAF, 0x6C, 0xEA, 0x46, 0xF4, 0x9D,
+    0x7D, 0xF5, 0x66, 0xE0, 0x4B, 0x4F, 0xB2, 0xE8, 0xD2, 0x05, 0xB4, 0x79, 0x77, 0xA9, 0xBB, 0xB7,
+    0xD9, 0x5D, 0xC7, 0xE2, 0xA5, 0xF0, 0x23, 0xF0, 0xEA, 0xD7, 0x07, 0x03, 0x59, 0xED, 0xCB, 0x42,
+    0x21, 0x8D, 0xF1, 0xD1, 0x17, 0x6F, 0x20, 0xCD, 0xA1, 0x74, 0xEF, 0xDF, 0x2A, 0xEE, 0x80, 0xBD,
+    0xF7, 0x32, 0xED, 0xA5, 0x10, 0x04, 0x36, 0x5E, 0x7F, 0xA9, 0xA9, 0xB3, 0x1C, 0x2B, 0x03, 0x14,
+    0x23, 0xC5, 0xA6, 0xCC, 0x06, 0xAA, 0x72, 0xBB, 0xCC, 0x0D, 0x49, 0x88, 0x98, 0x96, 0x36, 0x2F,
+    0xC8, 0x38, 0xAD, 0x72, 0xC0, 0xB1, 0x28, 0xA7, 0x18, 0x88, 0x69, 0xC7, 0x02, 0x48, 0x6B, 0x03,
+    0x63, 0xE1, 0x6A, 0xE8, 0x5E, 0x40, 0xAD, 0xE5, 0x52, 0xFB, 0x19, 0xC2, 0x80, 0x5F, 0x43, 0xAD,
+    0x7C, 0x04, 0xFD, 0xF6, 0x4E, 0x64, 0xFC, 0x9E, 0xD6, 0x84, 0x7F, 0x84, 0x87, 0xC3, 0x93, 0x96,
+    0x1E, 0x2E, 0xE9, 0x51, 0x7D, 0x52, 0x1F, 0xEE, 0x8B, 0x1E, 0xBF, 0xC1, 0x6C, 0x0F, 0x58, 0xD5,
+    0xFD, 0xCD, 0x7F, 0x16, 0xD2, 0xAA, 0xA5, 0x5D, 0x69, 0xD3, 0x01, 0xE8, 0xD6, 0x52, 0x68, 0x42,
+    0x38, 0x0E, 0xD2, 0x27, 0xD2, 0x4F, 0x7A, 0x2E, 0xA8, 0xA5, 0x98, 0x8A, 0xF3, 0xB8, 0xAE, 0x7E,
+    0xFF, 0x56, 0x4E, 0x07, 0x94, 0x41, 0x48, 0x76, 0xC8, 0x33, 0xE6, 0xE4, 0x14, 0xE6, 0xA6, 0xA9,
+    0xBE, 0x27, 0xC2, 0x02, 0xA9, 0xFD, 0x1A, 0x57, 0xDF, 0x4F, 0xD4, 0xD1, 0x56, 0xA2, 0xD1, 0x82,
+    0xFD, 0x51, 0x2A, 0xCE, 0xBB, 0xB9, 0xAA, 0xA0, 0x05, 0xF4, 0xA2, 0x8D, 0x2E, 0x83, 0x4F, 0xC6,
+    0xAE, 0xFC, 0x51, 0x80, 0xA9, 0x12, 0x93, 0x2E, 0xA9, 0x4D, 0x80, 0x1D, 0xCD, 0xC9, 0x8C, 0xBA,
+    0x9C, 0xD5, 0xD1, 0xD6, 0xA3, 0xF5, 0x4F, 0x43, 0x17, 0x0A, 0xF1, 0xC2, 0x82, 0x2A, 0xC3, 0xEA,
+    0x58, 0xC4, 0x33, 0x17, 0x0B, 0x7A, 0xEA, 0xC7, 0x47, 0x34, 0xCC, 0x06, 0x69, 0x2B, 0xF4, 0xD4,
+    0xF0, 0xF7, 0x30, 0x98, 0x8D, 0x95, 0x15, 0x96, 0xCA, 0x05, 0x9D, 0xC6, 0xB3, 0xB2, 0x04, 0x1F,
+    0xAF, 0x07, 0x7E, 0x5B, 0x2A, 0x2A, 0xA7, 0x8F, 0x70, 0x17, 0x92, 0xC9, 0x69, 0x81, 0x7E, 0x96,
+    0x62, 0xF2, 0xCF, 0x66, 0xA3, 0x29, 0x0D, 0x01, 0x6E, 0x9B, 0xA3, 0x6E, 0x9A, 0x84, 0x7B, 0x6F,
+    0x48, 0x1B, 0xC3, 0xD7, 0xBE, 0xFB, 0x42, 0x8E, 0xEF, 0xC5, 0x0E, 0x40, 0xCB, 0xE1, 0xB6, 0x36,
+    0xD3, 0x87, 0x8B, 0xD3, 0xEC, 0x7F, 0x97, 0x76, 0x20, 0x51, 0x3B, 0x50, 0x54, 0x87, 0x0D, 0xAD,
+    0x9F, 0xE2, 0x52, 0x04, 0x8A, 0xC0, 0x2F, 0x2F, 0x47, 0xE4, 0x01, 0x3C, 0xD8, 0xCA, 0xBD, 0x92,
+    0x07, 0xC3, 0x17, 0x38, 0x80, 0x30, 0x6E, 0xF5, 0xE4, 0x5E, 0x2F, 0xEC, 0x0D, 0x8C, 0x6A, 0x7B,
+    0x06, 0x41, 0xA1, 0x0D, 0x45, 0x5B, 0xB8, 0xE9, 0x26, 0x95, 0x14, 0xD4, 0x14, 0x39, 0x06, 0xAA,
+    0x0B, 0x4A, 0x67, 0x50, 0xA1, 0x84, 0xF1, 0x78, 0x84, 0x73, 0xD0, 0x60, 0x0B, 0xFC, 0x95, 0xA1,
+    0x78, 0xE1, 0xDC, 0x43, 0x90, 0x65, 0x55, 0x62, 0x2F, 0x72, 0x76, 0x89, 0x5E, 0x74, 0xE8, 0xDE,
+    0xB8, 0xA8, 0x31, 0xF6, 0x08, 0x5C, 0x78, 0xB4, 0x0E, 0xFD, 0x4D, 0xFA, 0x13, 0xB8, 0x91, 0x11,
+    0xBC, 0x53, 0xC5, 0xF4, 0x4D, 0xE3, 0x78, 0x52, 0x62, 0x62, 0x95, 0xA1, 0xD3, 0xDA, 0xD2, 0x71,
+    0x0C, 0x09, 0x79, 0xFD, 0xBD, 0x0C, 0x87, 0x15, 0x86, 0xC7, 0xBD, 0x77, 0x14, 0xE6, 0x9B, 0x7C,
+    0x5F, 0xB2, 0x13, 0xF6, 0x5F, 0x44, 0x2C, 0xD0, 0xEB, 0x45, 0x2E, 0x8C, 0xBF, 0x8B, 0x40, 0xC3,
+    0x8D, 0xE8, 0xC8, 0x1F, 0x0E, 0xD3, 0x2E, 0x30, 0x7C, 0x92, 0x1A, 0xA5, 0x6B, 0xA8, 0x04, 0x36,
+    0xF5, 0xE1, 0x18, 0xFB, 0xC8, 0x28, 0xC8, 0x23, 0x5B, 0x66, 0xA3, 0xE4, 0xD6, 0x76, 0x94, 0x9C,
+    0x4A, 0x5A, 0xB2, 0xAF, 0x92, 0xB3, 0x69, 0x0B, 0x93, 0xCD, 0x59, 0x68, 0x29, 0xDE, 0x0B, 0xCB,
+    0xE5, 0x5D, 0x87, 0x86, 0xD1, 0x28, 0x83, 0x9C, 0x90, 0x81, 0xC8, 0xE1, 0x35, 0xF8, 0x8F, 0xA4,
+    0x61, 0x26, 0x08, 0x66, 0x64, 0x2E, 0x98, 0x7C, 0x9D, 0x09, 0x57, 0xF3, 0xD5, 0xFC, 0x0C, 0xBA,
+    0x7F, 0x4A, 0xCC, 0xEC, 0xEC, 0xF7, 0x07, 0xB3, 0x4D, 0x8E, 0x3E, 0xA3, 0xBC, 0x53, 0x1C, 0xFE,
+    0x87, 0x18, 0x34, 0xEB, 0x44, 0xEC, 0xAF, 0xAA, 0x3A, 0xB4, 0x0C, 0x6B, 0x47, 0x9C, 0xBA, 0x63,
+    0x5C, 0x4B, 0xDC, 0xB7, 0x42, 0x62, 0x4C, 0x08, 0xF0, 0x52, 0x4F, 0x34, 0xDF, 0x63, 0x70, 0xC5,
+    0x27, 0x8C, 0x89, 0x3C, 0x29, 0xC5, 0x85, 0x03, 0x8E, 0x89, 0x19, 0x33, 0x1C, 0xF5, 0x94, 0x2A,
+    0xA0, 0xBD, 0xA8, 0x2D, 0x2A, 0xBF, 0xE9, 0x70, 0x7D, 0x78, 0xB5, 0xE0, 0x39, 0x5A, 0x23, 0x63,
+    0xDA, 0xDA, 0x44, 0xB0, 0x79, 0x2D, 0xA6, 0xAB, 0x5A, 0x65, 0xB4, 0xC3, 0x04, 0xA9, 0xC2, 0x98,
+    0x09, 0xBE, 0x36, 0xAC, 0x98, 0xC0, 0xA9, 0x98, 0x80, 0x14, 0x57, 0x3E, 0xE3, 0x01, 0xA0, 0x1A,
+    0x22, 0x61, 0xAC, 0x3B, 0x5A, 0x59, 0x38, 0x86, 0x47, 0x60, 0x1C, 0xE8, 0x5C, 0x27, 0xF6, 0x8B,
+    0xC7, 0xF3, 0x3B, 0xEC, 0xF0, 0x25, 0x35, 0x4F, 0xF6, 0x7D, 0xB4, 0xF0, 0xED, 0xB0, 0x1A, 0x9D,
+    0x93, 0x35, 0x65, 0x7B, 0xBD, 0x87, 0xBD, 0x87, 0xF1, 0x27, 0x98, 0xA4, 0x32, 0xC7, 0x53, 0x26,
+    0x27, 0x5E, 0x18, 0xEC, 0x33, 0x57, 0x92, 0x53, 0xB1, 0x28, 0x4E, 0xAC, 0x7C, 0x41, 0xB1, 0x87,
+    0xC0, 0xDB, 0xCE, 0xA1, 0x2B, 0x32, 0x8E, 0xA2, 0x97, 0xD7, 0xE0, 0x0B, 0x05, 0x39, 0x5D, 0xCE,
+    0x36, 0xC2, 0x97, 0x5A, 0xBA, 0xD1, 0x85, 0x7F, 0x94, 0xE5, 0xBE, 0x2B, 0xD6, 0xEF, 0xB2, 0x26,
+    0x06, 0xF7, 0xE3, 0xB4, 0x01, 0x22, 0x3B, 0x89, 0x0B, 0xA9, 0x6A, 0x45, 0x4E, 0xC1, 0x50, 0xA3,
+    0x56, 0x25, 0x67, 0xC0, 0x13, 0xA0, 0x74, 0x05, 0xD4, 0xFB, 0x6D, 0x83, 0xF0, 0x87, 0xA9, 0x97,
+    0x38, 0xA0, 0xB9, 0x5A, 0x90, 0x55, 0x81, 0xCB, 0x59, 0xC2, 0xEF, 0x7C, 0xEE, 0x36, 0x7C, 0xBC,
+    0xD7, 0x7E, 0x72, 0x3E, 0xA9, 0xFD, 0xF8, 0x7B, 0x3F, 0x89, 0xEC, 0xDB, 0xB5, 0x0F, 0x45, 0x86,
+    0xD6, 0x90, 0xE3, 0x3F, 0x18, 0xEB, 0xF4, 0xB3, 0xAA, 0x69, 0xB7, 0xE5, 0xD2, 0xBD, 0x37, 0x27,
+    0xF4, 0xFC, 0x22, 0xD9, 0x65, 0x4D, 0x86, 0xD7, 0x0A, 0x5D, 0xFD, 0x28, 0x30, 0x66, 0x05, 0xA4,
+    0xDC, 0x00, 0x3E, 0x23, 0xA2, 0x63, 0x16, 0xDA, 0x44, 0xD9, 0x63, 0xA5, 0xF0, 0xC2, 0x8D, 0x50,
+    0x83, 0x0C, 0xBE, 0x4F, 0x29, 0x8C, 0x72, 0x18, 0x42, 0x73, 0x66, 0xB5, 0xD4, 0x02, 0x37, 0xD0,
+    0xE4, 0xCB, 0x06, 0x3E, 0xE7, 0x7A, 0x0E, 0xBF, 0x8D, 0xA2, 0x26, 0xAB, 0x77, 0x97, 0x5E, 0x18,
+    0xAC, 0x52, 0x2C, 0xAD, 0xF0, 0x34, 0x30, 0x75, 0x78, 0xAC, 0x09, 0xCC, 0x58, 0x99, 0x2F, 0x56,
+    0xDB, 0xBF, 0xF9, 0xC2, 0x07, 0x4B, 0xA1, 0x06, 0xF9, 0x99, 0x6C, 0x5D, 0xBD, 0xB9, 0xBE, 0xA6,
+    0x99, 0xBD, 0xD1, 0xAF, 0x8C, 0x94, 0xC6, 0x77, 0x99, 0x16, 0xA4, 0x13, 0x12, 0x37, 0x86, 0x43,
+    0x60, 0xBB, 0x0A, 0x73, 0x39, 0xE3, 0xB3, 0x6F, 0x20, 0x2C, 0x1D, 0x16, 0xB5, 0x3B, 0xDF, 0x2C,
+    0x10, 0xD0, 0x15, 0x9C, 0x44, 0x57, 0x25, 0x8B, 0x06, 0xB7, 0xE0, 0x67, 0x03, 0x11, 0x13, 0x22,
+    0xB0, 0x23, 0xC3, 0xAD, 0x42, 0x3A, 0xE6, 0x76, 0xA5, 0x47, 0x27, 0xA5, 0xAE, 0xAA, 0x96, 0x89,
+    0x22, 0xCE, 0x9A, 0x04, 0xCC, 0x04, 0xF9, 0x94, 0x30, 0x46, 0x7A, 0xAA, 0x77, 0x35, 0x99, 0x56,
+    0xFB, 0xF9, 0xAF, 0x72, 0x71, 0xDE, 0xCB, 0x0A, 0xA9, 0x7F, 0x97, 0x89, 0x59, 0x3B, 0xF3, 0xC5,
+    0xB3, 0xB3, 0x05, 0xC6, 0x63, 0x0D, 0x69, 0x93, 0x35, 0xFA, 0x8C, 0xC6, 0xA0, 0x9E, 0xA0, 0xDA,
+    0x98, 0x39, 0x41, 0x6F, 0xFE, 0x86, 0x12, 0x93, 0x6B, 0xC6, 0xCB, 0xBE, 0xC7, 0x2C, 0x2D, 0x7C,
+    0xE4, 0x7F, 0x04, 0x27, 0xB9, 0xB0, 0x3D, 0x2E, 0xB8, 0xC8, 0xAD, 0x25, 0x6D, 0xB4, 0x14, 0xBB,
+    0x56, 0xBE, 0xA2, 0xAB, 0x9B, 0xCC, 0x9D, 0x12, 0x3B, 0x03, 0x62, 0x57, 0xB5, 0xAA, 0x6B, 0xB2,
+    0xDC, 0x9A, 0x65, 0x22, 0x61, 0x9B, 0x4B, 0x9B, 0x2F, 0x26, 0x3A, 0x7E, 0x29, 0xC6, 0xEF, 0x3E,
+    0x64, 0x2A, 0xB6, 0x7F, 0xF5, 0x2B, 0xE6, 0x47, 0xDF, 0xCD, 0x10, 0x57, 0xD6, 0xDF, 0xCD, 0xC0,
+    0x59, 0xEE, 0x73, 0x19, 0xC2, 0x97, 0x06, 0xB3, 0x3C, 0x71, 0xD3, 0x42, 0x34, 0x19, 0xFB, 0xC0,
+    0x51, 0xDC, 0x65, 0xD8, 0xB4, 0x28, 0x67, 0xC9, 0x29, 0x1D, 0xA2, 0xFB, 0x18, 0x34, 0x0B, 0x32,
+    0x56, 0xD8, 0xBF, 0xC0, 0x10, 0xA1, 0x09, 0x8E, 0x9F, 0x3A, 0x19, 0xD0, 0x02, 0x8D, 0x79, 0xF0,
+    0x64, 0x30, 0x0F, 0x96, 0xF1, 0xE7, 0xA1, 0x0E, 0xE2, 0x79, 0xD8, 0xD6, 0x7C, 0xBE, 0x1E, 0x7D,
+    0x9C, 0xCD, 0x53, 0x27, 0xD2, 0x9C, 0x12, 0xC1, 0x9C, 0x30, 0xFC, 0xA4, 0x15, 0xE9, 0xB3, 0x17,
+    0x01, 0xE7, 0xD3, 0xE5, 0x18, 0x72, 0x61, 0x50, 0x97, 0x02, 0xEC, 0x7B, 0xE8, 0xBF, 0x93, 0xE4,
+    0x30, 0xA9, 0x11, 0x65, 0x29, 0xCC, 0x69, 0x7E, 0xE1, 0xF6, 0x2F, 0x48, 0xCE, 0x74, 0x12, 0xE4,
+    0xA9, 0x0D, 0x04, 0xF7, 0x31, 0xB7, 0xF3, 0x53, 0x4B, 0x4B, 0x8B, 0x68, 0x38, 0xAF, 0x7F, 0xF0,
+    0x02, 0x23, 0xDC, 0x88, 0x72, 0x21, 0x41, 0x9B, 0x19, 0x01, 0x8C, 0xE1, 0xED, 0xA4, 0xFE, 0xDA,
+    0xFB, 0x19, 0x86, 0x2E, 0x67, 0x7A, 0x15, 0xCF, 0x6A, 0xB7, 0x6B, 0x89, 0x0F, 0x1E, 0x5A, 0x58,
+    0x81, 0x21, 0x2F, 0x11, 0xA1, 0xD3, 0xDB, 0xAB, 0x22, 0x6E, 0x65, 0xF8, 0x18, 0x32, 0xC3, 0x88,
+    0xBB, 0x61, 0x33, 0x59, 0x55, 0xFF, 0x5E, 0x82, 0x31, 0x7C, 0xE1, 0xB6, 0x66, 0xFF, 0xE0, 0x5A,
+    0x6C, 0xAD, 0x0F, 0x87, 0x9B, 0xE4, 0xD0, 0x2E, 0x3D, 0xDB, 0xA4, 0xAB, 0x41, 0x5C, 0x57, 0xE3,
+    0xB9, 0x6E, 0x0D, 0x98, 0xFE, 0x2D, 0x22, 0x3F, 0xC4, 0xDC, 0x31, 0xFC, 0x5F, 0x04, 0x80, 0x01,
+    0x65, 0x6A, 0xF1, 0x2C, 0xE2, 0xD2, 0xA2, 0xC5, 0xE0, 0xB6, 0xB1, 0xF4, 0x62, 0x52, 0x30, 0x8B,
+    0x56, 0xD8, 0x19, 0xB3, 0xCC, 0x6F, 0x57, 0xC3, 0xA7, 0x6B, 0x7C, 0x45, 0xC3, 0xFD, 0x1A, 0xA8,
+    0x74, 0xCF, 0xA7, 0x85, 0x8F, 0x49, 0x61, 0xF6, 0x3B, 0x2F, 0xD0, 0xF9, 0xF8, 0x4E, 0xAE, 0x49,
+    0xD7, 0x19, 0xC8, 0x18, 0x26, 0xE2, 0x0E, 0x86, 0xAD, 0x95, 0x08, 0x5D, 0x1D, 0x0F, 0xFE, 0xD1,
+    0x39, 0x26, 0x05, 0x35, 0x4B, 0xE1, 0x8C, 0xB3, 0x15, 0x62, 0x6D, 0x0A, 0x83, 0x47, 0xFB, 0x1A,
+    0x59, 0x98, 0xBF, 0x8F, 0xB3, 0x1C, 0xC6, 0xA4, 0x4B, 0x23, 0xB2, 0xAE, 0x96, 0xD2, 0x28, 0xAF,
+    0x43, 0xFE, 0x8C, 0x92, 0x6C, 0x6A, 0x86, 0xA4, 0x8C, 0x66, 0xCB, 0x5B, 0xBA, 0xD4, 0xF6, 0x88,
+    0xBC, 0x5C, 0x3F, 0xDF, 0xB7, 0x6F, 0xE3, 0x04, 0x8C, 0x4B, 0xF6, 0xE8, 0xAC, 0x89, 0x49, 0xC8,
+    0x7C, 0x36, 0xA2, 0x3D, 0x86, 0xA6, 0x7D, 0xBD, 0x13, 0x47, 0xD7, 0xD2, 0xD0, 0x74, 0x95, 0xCB,
+    0x2B, 0x5C, 0x11, 0x69, 0x95, 0x83, 0x53, 0x4B, 0xDF, 0xDC, 0xB0, 0x2B, 0xDF, 0x3F, 0xDC, 0x0F,
+    0xC5, 0xE3, 0xA0, 0xA0, 0x3D, 0x1D, 0x14, 0xB8, 0x88, 0x94, 0x8E, 0x12, 0x14, 0xEC, 0x82, 0xB9,
+    0x5A, 0x3A, 0xE7, 0xD7, 0xD2, 0x00, 0xB0, 0x00, 0x68, 0x54, 0xE0, 0x4E, 0x40, 0x03, 0x0F, 0x59,
+    0x58, 0xC0, 0x35, 0xEE, 0x6B, 0xE9, 0xC0, 0xB9, 0x5F, 0xE6, 0x16, 0x3D, 0xB9, 0x71, 0xB2, 0x67,
+    0x17, 0x98, 0x0C, 0x39, 0x2E, 0xB0, 0xC8, 0xE5, 0x4E, 0x06, 0x55, 0x08, 0xF5, 0xC0, 0x20, 0x52,
+    0xED, 0x10, 0xBE, 0xF8, 0x1C, 0xEF, 0x36, 0x51, 0x87, 0x7C, 0xA4, 0xA8, 0xCD, 0xF1, 0xD5, 0x73,
+    0x7A, 0x89, 0x5E, 0x8C, 0x09, 0x68, 0x32, 0x43, 0xCE, 0xD0, 0xF2, 0x5A, 0xCE, 0x0C, 0x79, 0x54,
+    0x35, 0xAF, 0xD1, 0x29, 0xA2, 0xC4, 0xD7, 0x37, 0x71, 0x85, 0xDA, 0xB5, 0x90, 0x76, 0x0D, 0xDC,
+    0x46, 0x48, 0x26, 0x92, 0x28, 0x78, 0xAC, 0xA7, 0xD1, 0xE9, 0xC8, 0x4D, 0xC5, 0x48, 0x7B, 0x08,
+    0x5D, 0xA5, 0x47, 0x32, 0x72, 0x23, 0x55, 0x0D, 0x12, 0x4E, 0x67, 0x43, 0x74, 0x25, 0x9C, 0x4E,
+    0x07, 0x33, 0xB7, 0xD4, 0x61, 0x10, 0x0B, 0x2B, 0xA7, 0xD6, 0x2A, 0x38, 0xD9, 0xDD, 0x15, 0x31,
+    0xF9, 0x0E, 0x09, 0xA8, 0xD8, 0x1A, 0x44, 0x6E, 0x6A, 0x6C, 0x3E, 0xB4, 0xA5, 0xC5, 0xB8, 0x38,
+    0x6D, 0x6B, 0x3F, 0x69, 0x71, 0xFD, 0x2A, 0x6A, 0x2E, 0x28, 0x97, 0x42, 0xC9, 0xA7, 0x0A, 0xA0,
+    0x2E, 0x90, 0x4F, 0x22, 0x63, 0x54, 0x5B, 0x55, 0x8F, 0xEA, 0xEF, 0xA3, 0x19, 0xFB, 0x67, 0x6C,
+    0x30, 0x7F, 0x05, 0xE8, 0xE9, 0x27, 0xAA, 0x1F, 0x3E, 0x3B, 0x7A, 0xD5, 0x31, 0x85, 0x2E, 0x86,
+    0x9A, 0x94, 0xDA, 0xFB, 0x50, 0xC2, 0xE9, 0x95, 0x4A, 0xEB, 0x3F, 0x44, 0x3F, 0x74, 0x01, 0xA3,
+    0x32, 0x00, 0x1A, 0x11, 0x72, 0x45, 0xC0, 0x51, 0xD3, 0x8C, 0xE9, 0xD4, 0xE4, 0x38, 0x97, 0x19,
+    0xE7, 0xC4, 0xE2, 0x52, 0x48, 0x10, 0x98, 0x59, 0x6F, 0x7A, 0x3A, 0x63, 0x54, 0xC1, 0x2A, 0xB2,
+    0x0B, 0xF5, 0x48, 0x17, 0x52, 0x16, 0x9C, 0x64, 0x41, 0xDF, 0x99, 0x81, 0xE6, 0x75, 0x14, 0x7F,
+    0xDE, 0xC7, 0xA5, 0x45, 0xF5, 0x89, 0x37, 0x72, 0xB6, 0xDB, 0x97, 0x55, 0x44, 0x35, 0x29, 0xAC,
+    0x0D, 0x6C, 0x42, 0x6D, 0xD8, 0x4B, 0xD4, 0x3E, 0x74, 0x86, 0x66, 0x9D, 0x7D, 0x27, 0x6C, 0x33,
+    0xEB, 0xE2, 0x3B, 0x79, 0xDB, 0x6A, 0x7D, 0x1F, 0xE4, 0x57, 0xCE, 0x43, 0x2B, 0x52, 0xEE, 0x82,
+    0x85, 0x59, 0x04, 0x83, 0x71, 0x9D, 0xC1, 0x7D, 0x7D, 0x93, 0xCE, 0x07, 0xF8, 0xB7, 0x96, 0x90,
+    0x0A, 0xA8, 0x19, 0x92, 0x5C, 0x7F, 0x35, 0x37, 0x09, 0xBB, 0x82, 0x43, 0x53, 0x4F, 0x62, 0xA6,
+    0x73, 0xC1, 0x71, 0x81, 0xD6, 0xA0, 0x04, 0x3E, 0x1E, 0xE0, 0xCA, 0xB9, 0x15, 0x30, 0x5F, 0x8B,
+    0x6B, 0xCE, 0xE4, 0xC0, 0x7A, 0xAE, 0x4C, 0x58, 0xC9, 0x48, 0xCD, 0xCC, 0x40, 0x55, 0x12, 0xE0,
+    0x1A, 0x1B, 0xEF, 0x99, 0x2F, 0x03, 0xF3, 0xA6, 0x0C, 0x4B, 0x47, 0xDB, 0x1A, 0x68, 0x06, 0x33,
+    0xA2, 0x48, 0xF5, 0xC5, 0xB9, 0xD3, 0xDF, 0x62, 0xBF, 0x1A, 0x94, 0x12, 0x6A, 0x76, 0xCD, 0xCF,
+    0x0B, 0x87, 0x46, 0x57, 0x11, 0xA6, 0x10, 0x7F, 0x20, 0x3F, 0xD4, 0x32, 0xBD, 0x18, 0xB7, 0xB9,
+    0x91, 0x93, 0xF5, 0x3B, 0xA6, 0x29, 0xC8, 0x69, 0x5A, 0x35, 0xCF, 0xC0, 0x54, 0x4E, 0x87, 0xBA,
+    0x36, 0x41, 0x2B, 0xEA, 0xDE, 0xBE, 0x1D, 0x36, 0x2D, 0x27, 0xF1, 0xB5, 0x61, 0x6B, 0x62, 0x15,
+    0x8C, 0x2D, 0x93, 0xC7, 0x6A, 0x59, 0xE3, 0xCF, 0xEB, 0x09, 0x4C, 0x01, 0xDA, 0xEA, 0x9B, 0x91,
+    0xD6, 0xC5, 0x15, 0x75, 0x3F, 0xAD, 0xF2, 0x2E, 0x59, 0x20, 0x59, 0x8E, 0xC6, 0x9D, 0x74, 0xB4,
+    0xC7, 0x26, 0x04, 0xFA, 0xC2, 0x0E, 0xB7, 0xF4, 0xB2, 0xFA, 0x36, 0x9E, 0x48, 0x45, 0xE8, 0x26,
+    0x67, 0x66, 0x9C, 0x94, 0x53, 0x64, 0xE5, 0x4D, 0x19, 0x31, 0xB1, 0x74, 0x4D, 0xD5, 0x85, 0x62,
+    0x7F, 0x1A, 0xA3, 0x4D, 0x83, 0xDB, 0xE4, 0x24, 0x18, 0x62, 0xE2, 0xA2, 0x11, 0xEA, 0xBA, 0x50,
+    0x5A, 0xC7, 0x5F, 0x8D, 0x36, 0x22, 0x92, 0x5E, 0xDF, 0xDB, 0x96, 0xA9, 0x57, 0xED, 0xAE, 0x0E,
+    0xF2, 0xB5, 0xDF, 0x92, 0x9C, 0x53, 0xDD, 0x1D, 0xA6, 0x50, 0xD7, 0xDB, 0x94, 0x40, 0xC9, 0x4B,
+    0x3B, 0xD7, 0xBF, 0xC5, 0x48, 0xD9, 0x29, 0x43, 0x66, 0xC5, 0xFE, 0x5E, 0xBE, 0x3E, 0x50, 0xCD,
+    0x1F, 0xA8, 0x0D, 0x50, 0x5E, 0xD5, 0x84, 0xBE, 0xA8, 0xA4, 0xCC, 0xAB, 0x9F, 0x1D, 0x54, 0xD8,
+    0x48, 0x11, 0x15, 0x60, 0x87, 0xCC, 0x71, 0xEB, 0xFE, 0x2D, 0x2E, 0xF9, 0xBD, 0xBB, 0x93, 0x9B,
+    0x36, 0x2F, 0x47, 0x55, 0x77, 0xED, 0xFC, 0x57, 0xF9, 0xC5, 0x1A, 0x2F, 0x53, 0xFD, 0xE1, 0xFD,
+    0x67, 0x79, 0x66, 0xFD, 0x0D, 0x88, 0xDA, 0xBF, 0x43, 0xF3, 0x3C, 0xF9, 0xE4, 0x93, 0x27, 0xEA,
+    0x53, 0x9B, 0x4C, 0xFC, 0x1A, 0x7D, 0x63, 0x78, 0x61, 0x57, 0xA8, 0x85, 0xBC, 0xCA, 0x86, 0x1E,
+    0xB6, 0xB6, 0xE8, 0xED, 0xAC, 0x2D, 0x1A, 0xEF, 0x54, 0xE7, 0x32, 0xD8, 0x1F, 0x2E, 0xA9, 0xE4,
+    0x7E, 0x70, 0xA5, 0x39, 0x4A, 0xEA, 0xC5, 0x13, 0x49, 0xC1, 0x40, 0x1B, 0x73, 0xEF, 0x25, 0x36,
+    0x74, 0x13, 0x63, 0xF4, 0xE9, 0x03, 0xBE, 0x82, 0x60, 0xF6, 0x84, 0xBA, 0xB6, 0x4F, 0xCD, 0x8B,
+    0x07, 0x72, 0x74, 0x9C, 0x9E, 0xAA, 0xC9, 0x57, 0xF0, 0xD3, 0x65, 0x1A, 0x29, 0x9C, 0xB2, 0x40,
+    0x42, 0xED, 0x43, 0x34, 0xF2, 0x6A, 0xA2, 0xCA, 0xE5, 0x91, 0xD1, 0xE8, 0x59, 0xE9, 0x33, 0x57,
+    0xB3, 0xCB, 0xEB, 0xD1, 0x53, 0xC2, 0x40, 0xDA, 0x82, 0x7D, 0xBB, 0x91, 0xBD, 0x2C, 0x6B, 0x73,
+    0xED, 0x8D, 0x2F, 0x3F, 0x32, 0xB7, 0xFA, 0xC5, 0x67, 0xC9, 0x52, 0x68, 0xF7, 0x72, 0xB9, 0xF6,
+    0x83, 0x3A, 0x59, 0xE0, 0xD1, 0x91, 0x1C, 0x54, 0x2A, 0x39, 0xFD, 0x81, 0x79, 0x0F, 0xB5, 0xEE,
+    0x69, 0x46, 0x5B, 0xD1, 0x4C, 0x9D, 0xB4, 0x10, 0xAF, 0xFD, 0x0C, 0xB7, 0x6C, 0x7C, 0x07, 0xDA,
+    0x73, 0x71, 0x74, 0xC5, 0xA1, 0x2F, 0xD5, 0xF8, 0x52, 0x86, 0x5F, 0xA1, 0x21, 0xB0, 0x7F, 0x99,
+    0x3C, 0xF9, 0x39, 0xBE, 0x4B, 0xF4, 0xA9, 0x37, 0x5E, 0xAE, 0x86, 0x9C, 0x4E, 0xCD, 0xDF, 0x32,
+    0x71, 0xB1, 0x26, 0xB2, 0xF6, 0xE5, 0xC9, 0x2B, 0xBC, 0x2A, 0x2C, 0x19, 0xF1, 0x71, 0xF2, 0x9D,
+    0xE9, 0x16, 0x4E, 0x99, 0xB7, 0xCF, 0x9B, 0xB7, 0x67, 0xCD, 0x9B, 0xCA, 0xF3, 0x77, 0x4C, 0x05,
+    0xD5, 0x8A, 0xBC, 0x2C, 0x4E, 0xA8, 0xA7, 0x7A, 0xAA, 0x98, 0xED, 0xC2, 0xE8, 0xE9, 0xC3, 0xA9,
+    0xD3, 0x70, 0xC8, 0x49, 0xB9, 0x84, 0x0A, 0xE7, 0xD7, 0xD2, 0x75, 0xA5, 0xC7, 0x0E, 0xBD, 0xC3,
+    0x16, 0x8D, 0xC5, 0xD9, 0x1D, 0x93, 0x17, 0xC1, 0xF3, 0xAD, 0x0C, 0xF3, 0xFC, 0xAC, 0x21, 0xE9,
+    0xF3, 0x63, 0xCA, 0x44, 0x5E, 0x31, 0x6F, 0xE3, 0xBE, 0xC0, 0x09, 0xA7, 0x6A, 0xA5, 0x4E, 0xD2,
+    0xB0, 0xE8, 0xB1, 0x2B, 0x32, 0xBE, 0x90, 0x0E, 0xAF, 0x3D, 0x30, 0xB1, 0x04, 0xCC, 0x23, 0xEB,
+    0x22, 0x3C, 0x88, 0x84, 0xAC, 0x12, 0xF5, 0xDB, 0xD5, 0x22, 0x05, 0xD7, 0x92, 0x63, 0x96, 0x00,
+    0xC4, 0x4C, 0xA3, 0xC7, 0xAB, 0x34, 0x5A, 0x7D, 0xA0, 0x1F, 0xB1, 0x00, 0xEE, 0x1D, 0xD6, 0xBC,
+    0xF5, 0x58, 0x1B, 0xD6, 0xA3, 0x3C, 0x6E, 0x12, 0x55, 0x95, 0x5B, 0xC6, 0x26, 0x34, 0x2A, 0x8B,
+    0x29, 0xF2, 0x25, 0xB8, 0xAC, 0xC6, 0x10, 0xD7, 0x99, 0xFD, 0xED, 0x45, 0x95, 0xB1, 0x3E, 0xCB,
+    0xDA, 0x3A, 0x26, 0x2D, 0xE1, 0xD7, 0xDF, 0x86, 0xAB, 0xFF, 0x53, 0x88, 0xA2, 0x2B, 0x39, 0x4C,
+    0x29, 0x05, 0x3E, 0x87, 0x7D, 0xFA, 0x1D, 0x82, 0x93, 0x4F, 0xD0, 0x0F, 0xC4, 0x12, 0x4C, 0xA2,
+    0xE4, 0x03, 0xAD, 0x82, 0x12, 0x0A, 0x53, 0xBA, 0x93, 0xAE, 0x9D, 0x0D, 0xF9, 0x54, 0xAA, 0xEA,
+    0xE5, 0x9B, 0xA1, 0x74, 0x20, 0x1F, 0x8F, 0x7F, 0x10, 0xEA, 0x77, 0x85, 0x0F, 0x00, 0x0C, 0xAE,
+    0x6E, 0x96, 0x5C, 0x94, 0x40, 0xC8, 0x60, 0x23, 0xB4, 0xB0, 0x2A, 0xE0, 0x67, 0x28, 0x5B, 0x68,
+    0xB0, 0x3A, 0x4C, 0xC1, 0x38, 0x81, 0xA2, 0x49, 0x15, 0x91, 0x6B, 0x37, 0x65, 0xEA, 0xDC, 0x14,
+    0xC0, 0x4E, 0xB0, 0x72, 0x07, 0xDE, 0x0C, 0xB3, 0x68, 0x4C, 0xA2, 0xA4, 0x9A, 0xF6, 0xE1, 0x39,
+    0xFC, 0xD6, 0x99, 0x2A, 0xAA, 0x6A, 0x56, 0xEB, 0xA6, 0x80, 0x19, 0xC0, 0x02, 0xBE, 0xBB, 0xA3,
+    0xB5, 0x53, 0x06, 0x1E, 0xAC, 0x61, 0xFC, 0xE3, 0x7D, 0xD7, 0x60, 0x17, 0x2F, 0x85, 0xBF, 0xAF,
+    0x96, 0x1A, 0x82, 0x7D, 0x96, 0x1A, 0xDC, 0xE6, 0xD0, 0x19, 0xE8, 0x52, 0x43, 0xAE, 0x6B, 0x68,
+    0x4F, 0x4F, 0x65, 0xE1, 0xE4, 0xA9, 0x51, 0x3E, 0x63, 0xA5, 0x53, 0xF6, 0x7B, 0x65, 0xFF, 0xD8,
+    0x05, 0x57, 0x96, 0xF6, 0x56, 0x8F, 0xA5, 0x8B, 0xE1, 0x11, 0xB3, 0x7F, 0x8E, 0x8E, 0x67, 0x19,
+    0x8D, 0xE7, 0x60, 0x17, 0x74, 0x4C, 0x01, 0x98, 0x1C, 0xF4, 0xFB, 0x08, 0x4E, 0x31, 0xD6, 0x2B,
+    0xDC, 0xEF, 0x2F, 0x8E, 0x48, 0x90, 0xE5, 0xF5, 0x50, 0xC7, 0x5C, 0x76, 0x1D, 0x5C, 0x90, 0x3D,
+    0xA8, 0xBC, 0x8D, 0xB0, 0x55, 0xCD, 0x46, 0x77, 0x76, 0xBB, 0x5A, 0xBD, 0x76, 0xAB, 0xD2, 0x34,
+    0x2E, 0xC0, 0x73, 0x71, 0xDE, 0x80, 0xE1, 0x28, 0x2D, 0x8E, 0xD2, 0xBC, 0x12, 0x95, 0xF6, 0xCE,
+    0xF2, 0xD0, 0xEE, 0xEC, 0xE7, 0xF0, 0x3A, 0xCF, 0xF4, 0x1B, 0x69, 0x61, 0x8F, 0xD3, 0xD9, 0x71,
+    0x51, 0x0D, 0x1D, 0x7E, 0xCF, 0x67, 0xC0, 0x17, 0x65, 0xA2, 0x91, 0x2E, 0x24, 0xE5, 0x1C, 0x3A,
+    0xE5, 0xE9, 0xD2, 0xA8, 0xAB, 0x5E, 0x22, 0xC3, 0x20, 0xD6, 0x4F, 0x34, 0x18, 0x91, 0xB4, 0x1B,
+    0x0C, 0xE5, 0xBC, 0x86, 0x56, 0x9B, 0xFC, 0x0B, 0x85, 0xBA, 0xC6, 0x45, 0x44, 0x71, 0x6E, 0x6B,
+    0x12, 0xE2, 0x62, 0xA0, 0x4E, 0x2F, 0x43, 0xBB, 0x2E, 0xAF, 0xC4, 0x5D, 0x76, 0xAE, 0x2D, 0xF4,
+    0xB5, 0xB5, 0x40, 0xE3, 0x89, 0x46, 0xDE, 0x05, 0xAE, 0x1B, 0x83, 0x78, 0x10, 0xBE, 0x42, 0x9B,
+    0xB8, 0xB8, 0xC0, 0x4C, 0x8D, 0x1B, 0x6E, 0x30, 0x43, 0xBC, 0xC1, 0xEA, 0xB8, 0x0D, 0x1A, 0x9D,
+    0x1F, 0xE2, 0x92, 0xC6, 0x3B, 0x8C, 0x17, 0xB9, 0xDA, 0xE2, 0xFF, 0x88, 0x19, 0xD9, 0x0D, 0x0C,
+    0x4C, 0xB6, 0xC1, 0xE8, 0x7C, 0x83, 0xD9, 0xCC, 0x8D, 0xDA, 0x76, 0x57, 0x36, 0xAC, 0xE1, 0x58,
+    0xBE, 0x77, 0xA1, 0x47, 0x4F, 0xB4, 0x28, 0x8D, 0xA5, 0xA6, 0x0E, 0xB3, 0xAD, 0x91, 0x01, 0x46,
+    0xAF, 0x73, 0x68, 0xE2, 0xE8, 0xCB, 0xA7, 0x2B, 0xEA, 0x18, 0x7D, 0x41, 0x8F, 0x6D, 0xEA, 0x9D,
+    0x15, 0x5D, 0x06, 0xF4, 0x4C, 0x41, 0x18, 0x8B, 0xC7, 0xE8, 0x7F, 0x61, 0x60, 0xA1, 0xE1, 0x24,
+    0xEE, 0x6B, 0xB5, 0xB2, 0xBC, 0xC3, 0x84, 0x0B, 0x13, 0x2D, 0x4D, 0xD1, 0xC2, 0x32, 0x28, 0x43,
+    0x48, 0x32, 0xA7, 0x76, 0x95, 0xFC, 0x53, 0xC4, 0x6A, 0x4A, 0x65, 0x37, 0xBC, 0xC1, 0xC5, 0x20,
+    0x3B, 0x63, 0xC6, 0xD4, 0xA3, 0xEF, 0x83, 0xD0, 0x1D, 0xE3, 0x88, 0xE3, 0xE3, 0x9C, 0xC5, 0x6B,
+    0x3C, 0xC9, 0xBC, 0xE9, 0x76, 0x21, 0xC3, 0xC9, 0x45, 0x24, 0x0C, 0xDA, 0x14, 0x51, 0xFF, 0x0D,
+    0xA2, 0x7E, 0x03, 0xA2, 0x10, 0x8B, 0xC6, 0xDB, 0x15, 0x51, 0xF9, 0x04, 0x51, 0xB8, 0x39, 0x46,
+    0xCF, 0xE2, 0xDF, 0x80, 0xA8, 0xAF, 0x8F, 0x89, 0x52, 0x77, 0x9E, 0x04, 0x3C, 0x9F, 0xDD, 0xF9,
+    0xAF, 0xE8, 0x4E, 0x29, 0x77, 0x06, 0x4A, 0x40, 0xCA, 0x03, 0x04, 0xF0, 0x2B, 0x4E, 0x7E, 0x18,
+    0x15, 0xBF, 0xC8, 0xC0, 0xAA, 0x50, 0x9A, 0x1B, 0x54, 0x82, 0xCB, 0xBF, 0xAD, 0xA5, 0xBD, 0x81,
+    0x1B, 0x3D, 0xFE, 0x1F, 0x9E, 0x46, 0x9E, 0xBA, 0x4E, 0xFA, 0xCB, 0x5C, 0x6B, 0x10, 0xA8, 0xB0,
+    0x99, 0x75, 0xAD, 0x23, 0x90, 0xAB, 0x47, 0x4D, 0xAD, 0xF1, 0x81, 0xC2, 0xE4, 0x0A, 0xAF, 0xE6,
+    0x5E, 0x00, 0xDD, 0xD1, 0xE4, 0xF6, 0xB4, 0xDA, 0x62, 0xB4, 0x14, 0xC1, 0x4C, 0xFC, 0x82, 0xA9,
+    0x0D, 0x7D, 0x1E, 0x51, 0xC4, 0x57, 0x71, 0xFE, 0xA2, 0xD0, 0xD4, 0x18, 0x58, 0x66, 0x96, 0x3A,
+    0x31, 0xBF, 0x85, 0x54, 0xBC, 0x4D, 0xCD, 0xDC, 0xF7, 0x0A, 0xBC, 0x41, 0x94, 0x9B, 0x9C, 0xD6,
+    0xAE, 0xE8, 0xF4, 0x68, 0x11, 0x9F, 0x96, 0xEE, 0xEA, 0x0C, 0xC9, 0xDB, 0x85, 0x98, 0x39, 0xD2,
+    0xF1, 0xD0, 0xC1, 0xD1, 0x69, 0xD2, 0x39, 0xD4, 0x89, 0xAA, 0x6E, 0xD3, 0x06, 0xC8, 0x5F, 0xA0,
+    0x21, 0x39, 0x7B, 0x41, 0xE6, 0x7A, 0x03, 0xC9, 0xCF, 0x76, 0x21, 0xE4, 0x6D, 0x56, 0x3B, 0xD3,
+    0xCD, 0x82, 0x98, 0x5E, 0xC6, 0xA5, 0x1D, 0xCA, 0x1F, 0xAB, 0x32, 0x03, 0x31, 0xBF, 0xA1, 0x91,
+    0xB6, 0xD6, 0x79, 0xB7, 0x59, 0x7F, 0x27, 0xF1, 0xA1, 0x88, 0x65, 0x78, 0xA2, 0xB5, 0xBB, 0x2C,
+    0xC4, 0xFB, 0x94, 0x8B, 0xB9, 0x12, 0x62, 0xD0, 0x28, 0xB6, 0xDB, 0x85, 0x4E, 0x33, 0xFD, 0x0D,
+    0x66, 0x6A, 0xEC, 0x81, 0x6A, 0x69, 0x6F, 0xBF, 0xDF, 0x30, 0x9F, 0x74, 0x98, 0xAC, 0xDD, 0xB0,
+    0x06, 0xF2, 0xB5, 0xCA, 0xB6, 0xCC, 0x4F, 0x8C, 0xFC, 0x0A, 0x81, 0x4A, 0x6A, 0xC2, 0x86, 0xD2,
+    0xA3, 0x9F, 0x64, 0x02, 0xE9, 0x02, 0xA4, 0xA2, 0x5D, 0x3F, 0xEC, 0x42, 0x1D, 0x0D, 0xB5, 0xB5,
+    0x6C, 0xFD, 0x48, 0x25, 0xF2, 0x2C, 0x73, 0xBF, 0xAE, 0x98, 0x55, 0x80, 0x50, 0x7F, 0x99, 0x96,
+    0xC8, 0x9B, 0xB2, 0xF8, 0xAE, 0xE2, 0xB6, 0xE2, 0x60, 0x2F, 0x9E, 0x08, 0x9F, 0xD5, 0x8D, 0xD3,
+    0x85, 0x0B, 0x93, 0xE8, 0xD5, 0x68, 0x92, 0x7D, 0x91, 0x51, 0x21, 0x00, 0xA9, 0x87, 0xA8, 0xDD,
+    0x5D, 0xEA, 0xEE, 0xB3, 0x46, 0xD3, 0xFC, 0xAD, 0xE8, 0x02, 0x4C, 0x21, 0x41, 0x1D, 0x43, 0xEF,
+    0x73, 0x15, 0xC4, 0x67, 0x59, 0x8B, 0x4F, 0xF5, 0x5F, 0x2D, 0xD4, 0xEC, 0x54, 0xDC, 0xC7, 0x55,
+    0x79, 0x9D, 0x45, 0xB6, 0xA4, 0x92, 0x82, 0x49, 0x09, 0x27, 0xDC, 0xBC, 0xE5, 0x01, 0xCF, 0xF4,
+    0x4D, 0x98, 0x80, 0x80, 0x06, 0xAE, 0xA1, 0xC7, 0x2A, 0x82, 0x40, 0x2E, 0x77, 0xD8, 0x2E, 0x33,
+    0x0B, 0x05, 0xD3, 0x0C, 0x39, 0xE2, 0x22, 0x8B, 0x48, 0x0C, 0x62, 0xCE, 0xA9, 0x60, 0xCE, 0xA9,
+    0xEB, 0xE2, 0xB6, 0x80, 0x39, 0x27, 0x8F, 0x39, 0x27, 0x2E, 0xEF, 0x2E, 0x97, 0xDA, 0xA7, 0xE5,
+    0xCA, 0xC9, 0xBD, 0x44, 0xAB, 0x8C, 0xC6, 0x5F, 0xE7, 0x10, 0x7C, 0x4B, 0x7C, 0xA8, 0xCB, 0x76,
+    0xFD, 0xC7, 0x69, 0xEC, 0x3E, 0x9F, 0x31, 0x21, 0x4C, 0x68, 0xE3, 0xB3, 0xEF, 0xBC, 0x9F, 0x78,
+    0xB5, 0xDB, 0xA1, 0x0B, 0xFD, 0x6B, 0x93, 0x27, 0x64, 0xF6, 0xCA, 0x44, 0x61, 0x65, 0x8E, 0x98,
+    0x62, 0xED, 0xC1, 0x82, 0x9F, 0x6B, 0x29, 0x48, 0x4A, 0x4C, 0x12, 0x21, 0x33, 0x7E, 0x2D, 0xED,
+    0x11, 0x6D, 0xD5, 0xA9, 0xB0, 0x5A, 0x2F, 0x34, 0xC1, 0x8F, 0x7F, 0x60, 0xF0, 0x93, 0xD3, 0x14,
+    0xCF, 0xAB, 0xA0, 0xD4, 0xF5, 0xE8, 0xB1, 0xA4, 0xE4, 0xE1, 0x0B, 0x35, 0x73, 0x03, 0xB2, 0x1B,
+    0xAE, 0xC8, 0x59, 0xAD, 0xBF, 0x38, 0xBB, 0x79, 0xA1, 0x4A, 0x7C, 0xEE, 0x7B, 0xB4, 0x12, 0x1E,
+    0x93, 0xE1, 0x98, 0x1D, 0xC5, 0x3B, 0x75, 0x91, 0x09, 0x73, 0x43, 0xB4, 0xFC, 0xCC, 0x76, 0xB0,
+    0x36, 0x53, 0x0A, 0x34, 0x7E, 0x39, 0xD3, 0x1B, 0x75, 0x84, 0x0E, 0x21, 0x6E, 0xB4, 0x16, 0xD6,
+    0xDE, 0x67, 0x2D, 0x4C, 0x73, 0x5A, 0x3F, 0xCF, 0xC4, 0xFE, 0x75, 0x52, 0xAD, 0x85, 0x85, 0xA6,
+    0x42, 0xA2, 0x79, 0x70, 0x90, 0x79, 0x2C, 0xBA, 0x58, 0x7D, 0x0A, 0x19, 0xAE, 0xB3, 0xDE, 0xFE,
+    0x61, 0xE8, 0x2A, 0x77, 0xE8, 0x72, 0x21, 0x55, 0xA7, 0x7B, 0x6F, 0xEE, 0xA1, 0xEB, 0xD0, 0xAA,
+    0xD3, 0xD6, 0xAE, 0xAA, 0xD3, 0xFE, 0xEE, 0xAA, 0x53, 0x0A, 0x02, 0xDD, 0x12, 0x6B, 0xBF, 0xF0,
+    0xFA, 0x4B, 0xAC, 0x26, 0xD1, 0x6C, 0x6A, 0xE8, 0x6B, 0x35, 0x89, 0xFD, 0xFB, 0xDC, 0x54, 0x93,
+    0xB4, 0xAA, 0xFC, 0x1F, 0x22, 0x58, 0xEB, 0x23, 0x26, 0xB8, 0x0A, 0x2D, 0x79, 0x6E, 0x88, 0x97,
+    0x06, 0x9A, 0x6E, 0xB4, 0x77, 0x81, 0xB5, 0xD6, 0xD3, 0xBA, 0x4D, 0x2E, 0xB0, 0x74, 0xD5, 0x70,
+    0x9F, 0x38, 0xF6, 0xB4, 0x1E, 0xC5, 0xE0, 0x71, 0xB6, 0x6D, 0x2F, 0xB6, 0x23, 0xB0, 0xE6, 0x29,
+    0xFA, 0xBC, 0x0B, 0x5C, 0xE9, 0x1B, 0xED, 0x76, 0x38, 0x2A, 0xA2, 0xCC, 0x18, 0x54, 0xAD, 0x77,
+    0xED, 0x42, 0xD6, 0x1A, 0xA6, 0x90, 0x85, 0x37, 0x07, 0x42, 0x1F, 0x43, 0xB9, 0xF5, 0x5C, 0x2F,
+    0x01, 0xA5, 0xC9, 0xEC, 0xBD, 0xF3, 0xBB, 0x4A, 0x68, 0x14, 0x06, 0x06, 0x4C, 0xD9, 0xE0, 0x04,
+    0x3C, 0xCD, 0x09, 0xF1, 0xB5, 0x68, 0x77, 0x1A, 0x98, 0x72, 0xF2, 0xFE, 0x94, 0xCB, 0xE5, 0x1F,
+    0x8A, 0xF5, 0xAF, 0x47, 0x13, 0x51, 0x43, 0xA7, 0x33, 0x0D, 0x33, 0x80, 0x27, 0x0C, 0xF4, 0x01,
+    0x5B, 0x7F, 0xB9, 0xAC, 0x74, 0xDA, 0x5B, 0xF0, 0x43, 0xF0, 0x7D, 0x0C, 0x33, 0x23, 0xAF, 0xD3,
+    0x49, 0x40, 0x13, 0x48, 0xA8, 0x8E, 0x27, 0x5C, 0xFF, 0x59, 0x1C, 0x5E, 0xEB, 0xDB, 0x25, 0x68,
+    0xB1, 0xA0, 0x5E, 0x9F, 0xD5, 0x63, 0x06, 0xB4, 0xB8, 0x2B, 0x07, 0xC4, 0x18, 0xF1, 0x63, 0xBA,
+    0x79, 0x4B, 0x7A, 0x37, 0x96, 0x93, 0xEE, 0x44, 0x4C, 0x71, 0x10, 0xEC, 0x8E, 0x9B, 0x9E, 0x09,
+    0x3F, 0xAE, 0x02, 0x3D, 0xBF, 0xCF, 0x4D, 0x3B, 0x07, 0x1E, 0xB2, 0x53, 0xCC, 0xAF, 0x75, 0x58,
+    0xF5, 0xAC, 0x46, 0x37, 0x0A, 0xF6, 0x8C, 0x19, 0xEA, 0xA7, 0x7D, 0x6E, 0x12, 0x62, 0xCE, 0xB9,
+    0x4D, 0xA6, 0x6A, 0x81, 0x93, 0x86, 0x5C, 0xF6, 0x1A, 0x4E, 0x6C, 0x09, 0x0B, 0xAA, 0xDA, 0x0E,
+    0xB3, 0x56, 0x44, 0x0D, 0x3D, 0x47, 0x15, 0xDD, 0xA7, 0xD9, 0xB8, 0x5E, 0x35, 0xFF, 0x2D, 0x51,
+    0x17, 0xB0, 0xF5, 0x7C, 0xF1, 0x54, 0x5B, 0xBA, 0xAF, 0xC4, 0xE2, 0xAF, 0xE0, 0xD9, 0x68, 0x6E,
+    0xFB, 0xF4, 0x70, 0xFD, 0x4D, 0x1D, 0xFC, 0xA2, 0xCA, 0x43, 0x37, 0x65, 0x46, 0x1A, 0x5A, 0x48,
+    0x57, 0x4C, 0xE6, 0x59, 0xA6, 0xE8, 0xD3, 0x64, 0x37, 0xB5, 0xFB, 0xC3, 0xD2, 0x97, 0x1D, 0xC4,
+    0xB1, 0x3B, 0x34, 0x7B, 0xC7, 0xA5, 0x79, 0x0F, 0x87, 0x4A, 0x59, 0xF4, 0xB2, 0x83, 0x6B, 0x49,
+    0xDC, 0x70, 0x39, 0xC3, 0x7D, 0x16, 0xB7, 0xB9, 0x98, 0x84, 0xB5, 0xA9, 0xA9, 0x12, 0x79, 0x6C,
+    0x9C, 0x03, 0xFA, 0x83, 0xEE, 0x03, 0x7A, 0xC4, 0xA2, 0x19, 0xD1, 0xF2, 0xE5, 0xDB, 0x4C, 0x67,
+    0xBF, 0x3D, 0x2E, 0x29, 0x38, 0x89, 0x62, 0xD5, 0xFD, 0x23, 0x26, 0xE3, 0x8F, 0xC3, 0xE1, 0x91,
+    0x77, 0xEE, 0x98, 0x7D, 0x95, 0x5B, 0xDF, 0xA0, 0x6F, 0xDB, 0x40, 0x44, 0xED, 0x80, 0xC3, 0xED,
+    0x6A, 0x43, 0xDC, 0x4E, 0xFA, 0xDD, 0x78, 0xA5, 0x8C, 0x76, 0xE9, 0xA5, 0xC3, 0xC2, 0xA8, 0x97,
+    0xD8, 0xAF, 0xF2, 0x41, 0x7B, 0x22, 0x27, 0x46, 0xD7, 0x11, 0x2B, 0xC5, 0x2C, 0xC4, 0xD5, 0x3B,
+    0x45, 0x99, 0x3B, 0x1E, 0x02, 0xA3, 0xBE, 0xB4, 0xF2, 0xA5, 0x1A, 0x74, 0xD7, 0x18, 0x72, 0x6A,
+    0xD2, 0x5A, 0xFC, 0x69, 0xA4, 0x8B, 0x2F, 0x2B, 0xC6, 0x00, 0xD2, 0xB0, 0x10, 0xE5, 0x23, 0x64,
+    0x11, 0x81, 0x89, 0xB8, 0x4F, 0x80, 0x88, 0xBE, 0xE2, 0xB5, 0x48, 0x5A, 0x59, 0x49, 0xD3, 0x73,
+    0xA6, 0x52, 0xB9, 0xBA, 0x0A, 0x50, 0xED, 0x36, 0x30, 0x99, 0x3B, 0x96, 0x07, 0xB1, 0x50, 0xE2,
+    0xCE, 0xC5, 0x50, 0x30, 0x49, 0x04, 0x4E, 0x96, 0x35, 0x2A, 0xAA, 0x49, 0xCD, 0xD4, 0x6B, 0x29,
+    0x10, 0xCC, 0x54, 0x4F, 0xDC, 0x62, 0xA0, 0x3B, 0x3C, 0x46, 0xDA, 0xCB, 0xAE, 0x56, 0x22, 0xED,
+    0xE8, 0xE4, 0xB6, 0xF9, 0x58, 0x13, 0xED, 0xC2, 0x5E, 0x0E, 0x27, 0x47, 0xF8, 0xD4, 0x64, 0xF6,
+    0x88, 0xBE, 0xBB, 0xBE, 0x76, 0x9D, 0x54, 0xBF, 0xBC, 0x61, 0xF6, 0xE9, 0x0A, 0x38, 0x8F, 0x39,
+    0xAA, 0xD4, 0xEC, 0xDF, 0x3A, 0xF1, 0x48, 0x28, 0x9C, 0x8A, 0x84, 0x16, 0xC6, 0xA2, 0xAF, 0x02,
+    0xF5, 0xE6, 0x83, 0x44, 0x42, 0x79, 0x15, 0x09, 0x4D, 0xE4, 0x08, 0x1D, 0xCD, 0x11, 0x3E, 0xBC,
+    0x3D, 0xEB, 0x54, 0xB0, 0xDB, 0xD7, 0x7D, 0x5A, 0x8E, 0x6F, 0xCF, 0xCA, 0x0A, 0xF6, 0x7A, 0x9C,
+    0xBA, 0x95, 0x4C, 0x74, 0x2F, 0x99, 0xE8, 0x66, 0x32, 0xD1, 0xDD, 0x64, 0xA2, 0xDB, 0xC9, 0x44,
+    0xF7, 0x93, 0x89, 0x6E, 0x28, 0x13, 0xDD, 0x51, 0x26, 0x90, 0x5B, 0x62, 0xEE, 0x29, 0x13, 0xDD,
+    0x54, 0x26, 0xBA, 0xAB, 0x4C, 0x74, 0x5B, 0x99, 0xE8, 0xBE, 0x32, 0xD1, 0x8D, 0x65, 0xA2, 0x3B,
+    0xCB, 0x74, 0xDB, 0x02, 0xB7, 0x0B, 0x17, 0x62, 0xE4, 0xC6, 0xAC, 0x2F, 0x9E, 0x9B, 0x08, 0x8E,
+    0x4C, 0x42, 0xF9, 0xAF, 0x58, 0xAC, 0xBD, 0x28, 0xDB, 0x52, 0xC3, 0xF5, 0x06, 0xD5, 0xFB, 0xF2,
+    0x49, 0xE4, 0xC6, 0x70, 0xE9, 0xCE, 0xAD, 0xC8, 0xEF, 0xD3, 0x60, 0x45, 0xF2, 0xDC, 0x27, 0xDA,
+    0x00, 0x5A, 0xC9, 0x81, 0x82, 0x0C, 0xC8, 0x4B, 0x80, 0xDC, 0xA4, 0x13, 0x41, 0x16, 0x3A, 0xAA,
+    0xBE, 0xC7, 0xCF, 0xD1, 0xC7, 0xCC, 0xCB, 0xD1, 0x35, 0xEC, 0x95, 0x47, 0x44, 0x98, 0x9D, 0x9A,
+    0xD8, 0xB5, 0x7B, 0x52, 0x3B, 0x62, 0x67, 0x65, 0xD1, 0x79, 0x35, 0xAF, 0xDD, 0x4A, 0x4D, 0xA9,
+    0x3C, 0x22, 0x10, 0xB7, 0xCC, 0xBF, 0xF0, 0x5C, 0x5F, 0x27, 0x95, 0x4A, 0xC6, 0xAE, 0x36, 0x48,
+    0xC0, 0x1A, 0xFB, 0xA3, 0x0D, 0x12, 0xDD, 0xC6, 0xF6, 0xB3, 0xE3, 0xCD, 0x20, 0x54, 0x29, 0xF3,
+    0x13, 0xEB, 0x72, 0x27, 0x43, 0x17, 0x55, 0xCD, 0x7B, 0xA9, 0xF3, 0xDD, 0x74, 0x5C, 0x32, 0x70,
+    0x1C, 0xBA, 0x3C, 0x0D, 0xFB, 0x5A, 0xEA, 0xD9, 0x69, 0x6A, 0xC4, 0x6C, 0x68, 0x85, 0x66, 0x55,
+    0x0A, 0x0B, 0xCD, 0xB6, 0x15, 0xAA, 0xC9, 0xEE, 0x2E, 0x85, 0x78, 0x1A, 0xFD, 0xCC, 0x40, 0x86,
+    0xEB, 0x91, 0x5C, 0x5E, 0xE7, 0x79, 0xEA, 0x03, 0xB1, 0xEE, 0xB0, 0x3A, 0x18, 0x2A, 0xA4, 0x50,
+    0xF1, 0x29, 0x34, 0x1D, 0x5A, 0x88, 0x89, 0xEC, 0xB3, 0xA6, 0x62, 0xEB, 0x2D, 0x98, 0xDB, 0x46,
+    0xF9, 0x8B, 0x32, 0x3D, 0xF7, 0x67, 0xE5, 0x77, 0x99, 0x0D, 0xA5, 0x5D, 0xED, 0x6A, 0x79, 0x88,
+    0x04, 0xB3, 0xDC, 0x74, 0xE4, 0xFD, 0x0F, 0xAC, 0x6E, 0x5B, 0x6B, 0x7F, 0x44, 0xE3, 0x68, 0x26,
+    0xB3, 0xEC, 0x52, 0x66, 0x3A, 0xD7, 0xFE, 0xE1, 0x5E, 0xBF, 0xB1, 0x3D, 0xF2, 0x17, 0x1E, 0xB1,
+    0xD6, 0xDC, 0x5A, 0xEA, 0xC0, 0xFC, 0xBD, 0xF5, 0xE0, 0xFF, 0x7A, 0xC1, 0x96, 0x97, 0x9C, 0x28,
+    0xB7, 0xEF, 0xA7, 0x72, 0xD9, 0x94, 0xD3, 0x22, 0xA2, 0xCC, 0xDC, 0xD7, 0xFB, 0x4D, 0x6E, 0xAE,
+    0x5B, 0x68, 0x8B, 0x07, 0xC5, 0x04, 0xB5, 0xB4, 0x13, 0x51, 0x86, 0x33, 0xEE, 0xBD, 0xAE, 0x35,
+    0x2A, 0xC5, 0x95, 0xD9, 0xF2, 0x2E, 0x35, 0x62, 0xF4, 0xA8, 0xC9, 0x9F, 0xF6, 0x27, 0x22, 0x59,
+    0x2A, 0x26, 0x8F, 0xD5, 0x1E, 0xAC, 0x0A, 0x6A, 0x9B, 0x9D, 0x7A, 0x0B, 0xBE, 0x56, 0x01, 0x48,
+    0xDB, 0xA3, 0x9D, 0x4E, 0x9C, 0xBC, 0x36, 0xC4, 0x48, 0x9A, 0x1A, 0x55, 0x99, 0xD5, 0xF4, 0xE4,
+    0x57, 0xB8, 0x02, 0xD7, 0x1D, 0xFD, 0xD3, 0x83, 0x85, 0x5E, 0x39, 0xDC, 0x5A, 0xDF, 0x8A, 0x59,
+    0xAD, 0xE4, 0xC3, 0xB6, 0x36, 0x6E, 0xE5, 0xCE, 0xB8, 0x2E, 0x44, 0x36, 0x7C, 0x03, 0x9F, 0x01,
+    0x31, 0x9C, 0xF2, 0xD7, 0x12, 0x1C, 0xF2, 0x80, 0xB4, 0x91, 0x89, 0x56, 0x76, 0xF0, 0xCE, 0xEB,
+    0x0F, 0xBD, 0xD5, 0xB9, 0x72, 0x71, 0xDC, 0xAA, 0x04, 0xE1, 0x24, 0x5D, 0x1C, 0x15, 0xE0, 0x77,
+    0x73, 0x85, 0x9D, 0xAD, 0x57, 0x27, 0xB7, 0xB3, 0x7A, 0xD7, 0x24, 0x1C, 0x6B, 0xFB, 0x0F, 0x64,
+    0x3A, 0xF4, 0xB4, 0x22, 0xB3, 0x65, 0x9C, 0xD7, 0xD1, 0xFF, 0x61, 0xA0, 0x87, 0x3C, 0x60, 0xC9,
+    0x02, 0x9E, 0x71, 0x75, 0x58, 0xA5, 0x5B, 0x9C, 0x09, 0x93, 0x55, 0x4F, 0x9E, 0xC4, 0xB9, 0xD6,
+    0x3A, 0xE9, 0x28, 0xAA, 0x52, 0xF7, 0x0B, 0x9D, 0x72, 0x70, 0x76, 0xA9, 0x6F, 0xCA, 0xE9, 0x29,
+    0xD1, 0x6D, 0x9A, 0x9E, 0xDA, 0x5D, 0xCD, 0x4C, 0xCD, 0x16, 0x23, 0xF1, 0x58, 0xA8, 0x3C, 0x00,
+    0x69, 0x2F, 0x5A, 0xFD, 0x5E, 0x99, 0xD1, 0x9B, 0xA7, 0x8B, 0x55, 0x0E, 0x4E, 0x74, 0x37, 0xB7,
+    0x0B, 0x45, 0xA8, 0x89, 0xAA, 0xA3, 0x97, 0x0C, 0x1B, 0x86, 0x6C, 0x9B, 0x0D, 0xE6, 0xE3, 0x8D,
+    0x79, 0x27, 0xB4, 0x71, 0xDD, 0x4C, 0xD3, 0xF9, 0x64, 0x5C, 0xA7, 0x7D, 0x1C, 0xA2, 0xB4, 0x12,
+    0x53, 0xE6, 0xDD, 0x29, 0x21, 0x39, 0x52, 0x45, 0x99, 0xB3, 0x0F, 0x3A, 0x5A, 0x45, 0x99, 0x16,
+    0xC7, 0xE5, 0x0A, 0xE3, 0x57, 0x55, 0x65, 0xE6, 0x6A, 0x95, 0x99, 0x37, 0xAE, 0x32, 0xAB, 0xB6,
+    0xE9, 0x55, 0x55, 0x66, 0x6E, 0x14, 0x68, 0x95, 0x59, 0x6B, 0xAA, 0xCA, 0xEC, 0xFF, 0x7B, 0x15,
+    0xDC, 0x43, 0x8E, 0xF3, 0x83, 0xD3, 0x3C, 0x1A, 0xE7, 0x64, 0xEF, 0x38, 0x3F, 0x68, 0x3F, 0x5C,
+    0xEE, 0xFF, 0x74, 0x92, 0x89, 0x1E, 0x9C, 0xE8, 0x7E, 0x55, 0xFF, 0x1C, 0x0F, 0xF3, 0x3A, 0xD6,
+    0xD6, 0x1A, 0x2D, 0x18, 0xA8, 0x6A, 0xA9, 0x4F, 0x72, 0xF7, 0x3A, 0xF7, 0xE5, 0x39, 0x65, 0xFE,
+    0x99, 0xD4, 0xF8, 0x1B, 0x62, 0xA7, 0x8D, 0xE8, 0x49, 0xEF, 0xBC, 0x37, 0xF6, 0x61, 0x67, 0xFE,
+    0x3E, 0x93, 0x3E, 0x30, 0x71, 0xCA, 0x32, 0xE4, 0x73, 0xEE, 0xB8, 0x96, 0xF2, 0xC4, 0xFF, 0x83,
+    0x00, 0x2B, 0xA9, 0xDA, 0xBE, 0xFE, 0x9B, 0x13, 0x3B, 0x49, 0x0F, 0xE8, 0x4B, 0x30, 0xD6, 0x1A,
+    0xA6, 0x2F, 0xF9, 0xA7, 0xF6, 0xC5, 0xDA, 0xD5, 0x97, 0x71, 0xF0, 0x3F, 0x76, 0x17, 0x4E, 0x66,
+    0x8F, 0x7E, 0xE5, 0x21, 0xBF, 0x97, 0x8E, 0x1C, 0x80, 0xA3, 0x6E, 0xD6, 0x3B, 0x6E, 0x0D, 0x44,
+    0x2F, 0xE1, 0xE1, 0x4C, 0x1C, 0x76, 0x74, 0xA4, 0x4D, 0x50, 0xA5, 0xE6, 0xBC, 0x27, 0x0B, 0x14,
+    0x4E, 0x8F, 0x06, 0x21, 0x70, 0x47, 0x68, 0xD2, 0x78, 0x7D, 0x46, 0x7B, 0xE7, 0x8D, 0xA9, 0xF4,
+    0xA7, 0x4C, 0xE5, 0x83, 0xEE, 0xE3, 0x7B, 0xE8, 0xA2, 0x8E, 0x7E, 0xB5, 0xA1, 0x62, 0xA5, 0x82,
+    0xB8, 0x62, 0xD6, 0xF4, 0x88, 0x85, 0x1E, 0x99, 0x46, 0x56, 0xA3, 0x83, 0xB5, 0xA9, 0xD1, 0x49,
+    0x2C, 0x1B, 0x0C, 0xBA, 0xA6, 0x8E, 0x74, 0x22, 0xFF, 0xA7, 0x99, 0xEB, 0xEC, 0x01, 0x96, 0x0D,
+    0xD6, 0xA6, 0x97, 0x0D, 0xC8, 0xAA, 0x2D, 0xBD, 0xE1, 0x30, 0x3A, 0x4F, 0x75, 0x6E, 0x84, 0xF0,
+    0xF5, 0x93, 0xC7, 0x7A, 0x37, 0xA3, 0x43, 0xE8, 0xE4, 0x3F, 0xD5, 0xC8, 0xF7, 0xD2, 0x64, 0x36,
+    0xC6, 0x36, 0x4A, 0xBA, 0x78, 0xE5, 0x3E, 0x34, 0x2D, 0xA8, 0x20, 0xFF, 0x1F, 0xC5, 0x59, 0x3F,
+    0x6C, 0x1B, 0x55, 0x1C, 0xFE, 0xEE, 0xCE, 0xEE, 0x35, 0xB9, 0xC6, 0xE7, 0xA1, 0x08, 0x9A, 0xA6,
+    0x35, 0x43, 0x91, 0x92, 0x92, 0xC6, 0x0C, 0x1D, 0x82, 0x64, 0x27, 0x8F, 0x01, 0x31, 0x74, 0x20,
+    0x20, 0xCA, 0xCC, 0xC0, 0x80, 0x58, 0x92, 0xA1, 0x43, 0x91, 0xDC, 0xFA, 0x06, 0xA4, 0x0E, 0x2C,
+    0xAE, 0x04, 0x33, 0x1D, 0x18, 0x50, 0x18, 0x92, 0xA1, 0xAA, 0x2C, 0xE1, 0xD6, 0x27, 0x75, 0x60,
+    0x75, 0xA9, 0x10, 0xEB, 0x01, 0x9D, 0xC2, 0xC0, 0x55, 0x18, 0x29, 0x2A, 0x6E, 0x8E, 0xEF, 0xF7,
+    0xDE, 0x5D, 0xFA, 0x87, 0x14, 0x9A, 0xF8, 0xEC, 0x5E, 0xEE, 0xBD, 0x9C, 0xCF, 0xEF, 0x7E, 0xEF,
+    0xFB, 0x7E, 0xEF, 0xF7, 0xEF, 0x9D, 0xE1, 0x84, 0x80, 0x17, 0x01, 0x7E, 0x0C, 0x9C, 0xBC, 0x0E,
+    0xD4, 0x2F, 0x02, 0xB5, 0x1A, 0xD0, 0x3E, 0x03, 0xF4, 0x2B, 0xB0, 0x62, 0x5F, 0xD9, 0x91, 0x17,
+    0x38, 0x5B, 0xDF, 0x85, 0x6E, 0x92, 0xF4, 0xFC, 0xAF, 0x3E, 0x8C, 0x2B, 0x40, 0xBC, 0xC0, 0x11,
+    0x1C, 0xD5, 0x68, 0xF0, 0x89, 0x3E, 0x50, 0x85, 0x3E, 0x14, 0xE0, 0xF4, 0x4C, 0x93, 0xEB, 0x4F,
+    0x95, 0x9F, 0xC4, 0xA5, 0xB7, 0xB6, 0x39, 0x8E, 0x42, 0x79, 0xDA, 0xC9, 0xA0, 0xBA, 0xD5, 0xB9,
+    0x84, 0xDA, 0x36, 0x6A, 0x7D, 0x74, 0x3A, 0xD6, 0xA0, 0xB9, 0xD1, 0xA9, 0x3C, 0x9C, 0x97, 0x67,
+    0x8F, 0x9A, 0x21, 0xFA, 0xE2, 0x90, 0x32, 0x80, 0x70, 0x81, 0xED, 0x7A, 0x2A, 0x94, 0xF7, 0x2C,
+    0x7E, 0xCC, 0x0B, 0xF0, 0xC7, 0x40, 0x02, 0xB8, 0x01, 0x3C, 0x85, 0x25, 0xE0, 0xAC, 0x26, 0xB0,
+    0x2F, 0xC4, 0xC0, 0x0A, 0x5B, 0x0C, 0xF7, 0x6E, 0x08, 0xFF, 0xBE, 0x41, 0x71, 0x6D, 0xC2, 0x7C,
+    0x93, 0x9B, 0x5A, 0x85, 0xB2, 0x0F, 0x7C, 0xC2, 0x19, 0x93, 0x32, 0x9C, 0x1F, 0x42, 0x4C, 0xE2,
+    0x1A, 0x52, 0xB0, 0x20, 0x5A, 0x68, 0xB8, 0x82, 0x57, 0x00, 0xB3, 0x11, 0x32, 0x88, 0x19, 0x04,
+    0x0D, 0xA2, 0x06, 0x61, 0x83, 0xB8, 0x41, 0xE0, 0xC8, 0x90, 0xBF, 0x64, 0xA4, 0xC2, 0xB9, 0x42,
+    0xCD, 0xBE, 0x1B, 0x8F, 0x04, 0x7B, 0x59, 0x03, 0x2A, 0x4D, 0x2A, 0x6B, 0x39, 0xC4, 0x5F, 0xB1,
+    0x1D, 0xCC, 0x8A, 0xF0, 0xE9, 0x96, 0x93, 0x0C, 0x9C, 0xD6, 0x65, 0xA0, 0xA2, 0x21, 0xF8, 0xE8,
+    0x26, 0xDE, 0x83, 0x8D, 0x8A, 0xF2, 0x97, 0xE0, 0xD7, 0x51, 0xAD, 0xA2, 0x59, 0xF9, 0xFD, 0x0F,
+    0x37, 0x39, 0xA7, 0xA1, 0x78, 0x01, 0x3B, 0x42, 0xB1, 0x22, 0xB8, 0xB7, 0x15, 0x2A, 0xA2, 0xE5,
+    0xC6, 0x08, 0xB4, 0xCC, 0xE7, 0x8E, 0x53, 0x14, 0xE6, 0x16, 0xA9, 0x65, 0xE7, 0x6E, 0x98, 0xEA,
+    0x78, 0x9F, 0xE6, 0x00, 0x2C, 0x13, 0xF6, 0x8D, 0x87, 0x34, 0x7E, 0x31, 0xE2, 0x96, 0x01, 0x26,
+    0x80, 0x3E, 0xCA, 0x1B, 0x30, 0x9C, 0xFE, 0x9A, 0xD7, 0xED, 0x1D, 0xA6, 0xA7, 0xCC, 0x8A, 0x21,
+    0x3B, 0x3F, 0x1F, 0x18, 0xB3, 0xE0, 0xA9, 0x50, 0x6A, 0x83, 0x83, 0x23, 0x2F, 0x6F, 0x9C, 0xFF,
+    0x8E, 0x0A, 0x3C, 0x6E, 0xC1, 0x4A, 0x94, 0x73, 0xBB, 0x57, 0xC2, 0xE6, 0xBE, 0x21, 0x97, 0xF5,
+    0xA8, 0x86, 0xBE, 0xD0, 0x47, 0x5B, 0x9B, 0x07, 0xDE, 0x7B, 0x1B, 0x58, 0x9B, 0xE2, 0x12, 0x0C,
+    0x80, 0xC9, 0x56, 0xEE, 0x34, 0x68, 0x89, 0x25, 0x14, 0x67, 0x57, 0x3C, 0xF4, 0x9C, 0x24, 0x24,
+    0x83, 0x03, 0xE9, 0xFA, 0x8C, 0x48, 0xC2, 0xA8, 0xC1, 0x8A, 0xA6, 0x63, 0x14, 0x4F, 0x0D, 0x09,
+    0xD6, 0x93, 0x05, 0xE3, 0x02, 0xD9, 0xFC, 0xFF, 0x7E, 0x71, 0x74, 0x80, 0x2F, 0x69, 0x9D, 0x9C,
+    0x14, 0xC0, 0x2E, 0xA2, 0x21, 0x00, 0x2F, 0xBF, 0xF3, 0xC8, 0xFB, 0x56, 0x08, 0x78, 0xF3, 0xC4,
+    0xC8, 0x34, 0x7C, 0x8F, 0xDE, 0x17, 0x4D, 0x1C, 0x52, 0x05, 0xA8, 0x83, 0x2B, 0x79, 0x85, 0xC1,
+    0x7D, 0xB3, 0x64, 0x30, 0x0A, 0xAE, 0x11, 0x7B, 0x5E, 0x11, 0x65, 0x0F, 0xB1, 0x93, 0xF4, 0x0E,
+    0x82, 0x95, 0xDE, 0xD6, 0xD1, 0x67, 0x19, 0xCD, 0xA4, 0xDF, 0x4D, 0xFA, 0x6D, 0xED, 0x79, 0xBB,
+    0xE7, 0xCD, 0xF3, 0x2B, 0xDD, 0x24, 0xBE, 0xB5, 0x7E, 0xED, 0xA9, 0xFB, 0x3C, 0xBB, 0x7A, 0x7C,
+    0x2A, 0xC4, 0xDC, 0x2A, 0xCB, 0xEC, 0x6E, 0x12, 0xF9, 0x57, 0xB7, 0x97, 0x50, 0xAF, 0x61, 0xA1,
+    0x81, 0x6A, 0x37, 0x49, 0x6E, 0xAD, 0xAF, 0xB7, 0x35, 0x9A, 0x3A, 0x29, 0xA8, 0x82, 0xFF, 0xA0,
+    0x63, 0x25, 0x92, 0xDC, 0x50, 0x00, 0x16, 0xF4, 0xC9, 0x8B, 0x6F, 0x18, 0x3C, 0xB4, 0xC5, 0x30,
+    0x7B, 0xD0, 0x74, 0xD6, 0x86, 0x80, 0x34, 0x07, 0x34, 0x43, 0xD8, 0xA1, 0x68, 0xBD, 0xA2, 0x30,
+    0xA3, 0xE5, 0xEF, 0x07, 0x98, 0x85, 0xB2, 0xDF, 0x5F, 0x3B, 0xD3, 0x8D, 0xCE, 0xEA, 0x4C, 0x75,
+    0x40, 0x18, 0xAA, 0xE0, 0x6D, 0x2F, 0x96, 0x9A, 0xF1, 0x8C, 0xDB, 0x33, 0xEB, 0xB2, 0x0F, 0xCD,
+    0x70, 0x55, 0x19, 0x55, 0xDA, 0x17, 0xEC, 0x1D, 0xE5, 0x9D, 0x53, 0x13, 0xD6, 0x10, 0x30, 0x4C,
+    0xAD, 0xA1, 0x30, 0x47, 0xB7, 0x49, 0x3E, 0x80, 0xCD, 0xB2, 0xC6, 0x55, 0x8F, 0x6A, 0x0D, 0x82,
+    0x02, 0x51, 0xB1, 0x58, 0xAA, 0xD3, 0x5A, 0x16, 0x08, 0xA6, 0xCA, 0x27, 0x13, 0x10, 0x9A, 0x08,
+    0xD1, 0x15, 0x08, 0xD1, 0x09, 0x3C, 0x10, 0x1F, 0x32, 0x80, 0x74, 0x46, 0x3A, 0x37, 0x57, 0xEC,
+    0x5C, 0x00, 0xAB, 0x4A, 0xD3, 0xBE, 0x48, 0xB3, 0x6E, 0xBD, 0xA2, 0xBF, 0xA3, 0x09, 0x2B, 0x4F,
+    0x5A, 0x60, 0x72, 0xFD, 0x13, 0xED, 0xA7, 0xF3, 0xE0, 0x77, 0xF0, 0xB6, 0xD6, 0xB1, 0xE7, 0xF7,
+    0xD2, 0xD2, 0xE7, 0x8F, 0xA6, 0x73, 0xFB, 0x93, 0x8A, 0x73, 0x50, 0x8B, 0x6D, 0xBA, 0x4F, 0x2F,
+    0x0D, 0x0C, 0xD3, 0x2D, 0x8D, 0xC5, 0xB9, 0x77, 0x19, 0x7E, 0xE0, 0x2B, 0x9F, 0x4F, 0x56, 0xE0,
+    0x85, 0xD5, 0x24, 0x09, 0xAB, 0xEB, 0xEB, 0x01, 0xAD, 0x4A, 0x6A, 0x11, 0x61, 0xCE, 0x90, 0x67,
+    0xC1, 0xD9, 0xD9, 0xA0, 0x0A, 0x77, 0xD2, 0x98, 0x42, 0x0E, 0x33, 0x72, 0xB6, 0xD7, 0xEC, 0x9D,
+    0xF2, 0xD0, 0x1A, 0xFE, 0x0C, 0xBA, 0xD0, 0x10, 0xEB, 0x9D, 0x9B, 0xD5, 0x15, 0x9D, 0xD6, 0x32,
+    0x86, 0xD7, 0xB2, 0x4E, 0xE4, 0xE1, 0x89, 0x6E, 0x58, 0xA0, 0x41, 0x7C, 0x0B, 0xFB, 0x21, 0xF5,
+    0xAD, 0x0E, 0x0F, 0x05, 0x16, 0x76, 0xFF, 0x0D, 0xB7, 0x1B, 0x15, 0x6D, 0x25, 0x8E, 0x92, 0x08,
+    0x54, 0x37, 0xAB, 0x31, 0xF6, 0x63, 0xA1, 0xC0, 0x80, 0x45, 0x29, 0xBC, 0x2B, 0xE1, 0x09, 0x49,
+    0xD4, 0x39, 0xC5, 0x0F, 0x1E, 0x2C, 0x22, 0x93, 0x80, 0x65, 0xC4, 0x64, 0x56, 0x46, 0x1C, 0x2C,
+    0xA2, 0x4C, 0xAB, 0xE3, 0x11, 0x36, 0xAD, 0xD8, 0x0B, 0x24, 0x35, 0x73, 0xB2, 0x88, 0x46, 0xF2,
+    0xCC, 0xBF, 0xD5, 0x28, 0xE9, 0xBF, 0x86, 0x66, 0xE0, 0x84, 0x4E, 0x58, 0xC5, 0xBC, 0x36, 0xF0,
+    0xFA, 0x33, 0xFF, 0x9E, 0x47, 0x9A, 0x38, 0x9E, 0x5C, 0x5B, 0x28, 0xD4, 0xEB, 0x05, 0x1C, 0xAD,
+    0x3F, 0x7E, 0x98, 0x7B, 0xFA, 0xA8, 0x26, 0x34, 0xEE, 0x84, 0x15, 0xBF, 0x1B, 0xB1, 0x9C, 0xF7,
+    0x03, 0xDA, 0x48, 0x55, 0x4C, 0x97, 0xD4, 0xFC, 0x80, 0xF1, 0xDB, 0x0B, 0xC9, 0xD3, 0xDD, 0xA3,
+    0xF3, 0x42, 0x3D, 0x44, 0x0F, 0xAE, 0xC8, 0x6E, 0xC7, 0x13, 0x01, 0x76, 0xB2, 0x41, 0x27, 0x59,
+    0x4D, 0x82, 0xCC, 0x7E, 0xA4, 0x36, 0xB3, 0xE2, 0xAC, 0xD3, 0x1F, 0xB5, 0x41, 0xF6, 0x69, 0x90,
+    0x37, 0xF5, 0x64, 0x35, 0xE2, 0x6C, 0xD0, 0x7D, 0xDA, 0xA6, 0x85, 0xF2, 0xBF, 0x41, 0xC9, 0x75,
+    0xC6, 0xE2, 0x2A, 0x96, 0xE1, 0x6F, 0x0D, 0x88, 0x30, 0xCD, 0x64, 0x82, 0x7A, 0x21, 0x6D, 0x72,
+    0x6D, 0x8B, 0xE9, 0xD8, 0x37, 0xE5, 0xAB, 0x52, 0x56, 0x0B, 0x41, 0x2F, 0x6B, 0x2F, 0x43, 0x30,
+    0x62, 0x86, 0xC7, 0xA4, 0x46, 0x60, 0x7E, 0xB5, 0x38, 0x21, 0x83, 0xBE, 0x8C, 0xC4, 0x54, 0x8A,
+    0x6E, 0x18, 0xA6, 0x26, 0xC6, 0xC9, 0x26, 0xC2, 0x8E, 0x79, 0xCB, 0x1D, 0x50, 0xEE, 0x49, 0x09,
+    0x79, 0xA7, 0x6C, 0x35, 0x1E, 0x66, 0xB0, 0x94, 0x0E, 0x88, 0xA7, 0xA9, 0xD9, 0xE6, 0x97, 0xB0,
+    0x7E, 0xED, 0x71, 0xBF, 0xBC, 0xF6, 0x58, 0x50, 0x39, 0x18, 0xB3, 0x62, 0x56, 0x91, 0xC0, 0xFA,
+    0x45, 0x6C, 0xE2, 0xE5, 0x81, 0xC4, 0x49, 0x09, 0x96, 0xB3, 0x63, 0x62, 0xB6, 0x62, 0x0A, 0x7C,
+    0x9C, 0x39, 0x4D, 0x34, 0xCD, 0x20, 0x37, 0x66, 0x5C, 0x2A, 0x7D, 0xB1, 0x08, 0xF3, 0x96, 0xC1,
+    0x8E, 0x7B, 0x2F, 0x66, 0xE1, 0xE6, 0x44, 0xAD, 0x9C, 0xCC, 0x55, 0x38, 0xCD, 0xBC, 0xDB, 0xFC,
+    0x3C, 0x47, 0x8A, 0x72, 0x54, 0x7E, 0xE4, 0x54, 0x6F, 0xB2, 0x60, 0xC2, 0xAB, 0x62, 0xA4, 0x96,
+    0x38, 0xA1, 0x2B, 0xCB, 0x58, 0x1A, 0x2F, 0x4F, 0x4E, 0xBD, 0x7D, 0x16, 0x0E, 0xEF, 0xDA, 0x92,
+    0x94, 0xA6, 0x25, 0x0F, 0x04, 0x39, 0x73, 0x75, 0x24, 0x9A, 0x78, 0x42, 0xAE, 0x22, 0x36, 0xBA,
+    0xE8, 0x04, 0x78, 0x61, 0x91, 0x53, 0xEF, 0x47, 0xD8, 0xBA, 0xAC, 0x2F, 0xE9, 0x3B, 0xAE, 0xBA,
+    0x38, 0x3C, 0xC9, 0xA7, 0x23, 0x6A, 0x4A, 0x0E, 0x69, 0x59, 0xA0, 0x83, 0xA9, 0x15, 0x9A, 0xBB,
+    0x0D, 0x21, 0xDD, 0x11, 0xD2, 0x7D, 0x92, 0x66, 0x5E, 0x0C, 0xB0, 0x1C, 0x3C, 0x49, 0x3A, 0x68,
+    0xEC, 0xCD, 0xFC, 0xB9, 0x57, 0x14, 0x4E, 0x2C, 0xA3, 0xCD, 0xAB, 0xA4, 0x79, 0x1D, 0x04, 0x1B,
+    0x24, 0xD8, 0x26, 0xC1, 0xB8, 0x72, 0xB5, 0xDB, 0x5B, 0xA2, 0x80, 0xBD, 0x09, 0x7A, 0xFF, 0xB1,
+    0x8A, 0x52, 0x87, 0x11, 0x08, 0xCC, 0xB6, 0xDE, 0xBC, 0x03, 0x1C, 0x13, 0x21, 0x4B, 0x34, 0xD8,
+    0x49, 0x35, 0xEC, 0xE5, 0x40, 0xC8, 0x96, 0x9D, 0xA7, 0x33, 0xD8, 0x4D, 0x77, 0xF3, 0xD9, 0x24,
+    0x66, 0x99, 0xD4, 0xE8, 0x59, 0xBD, 0x66, 0x1C, 0x4D, 0xE7, 0x3B, 0x89, 0xE4, 0xE2, 0x18, 0x33,
+    0x39, 0x30, 0x2B, 0x8A, 0x95, 0x2F, 0xDF, 0xA1, 0xC4, 0x1B, 0xDC, 0xFC, 0xA2, 0xB5, 0x30, 0xA6,
+    0x55, 0x62, 0xD9, 0xEB, 0x0C, 0x66, 0xE0, 0xAD, 0x6E, 0x63, 0xCA, 0x8E, 0x72, 0x31, 0xB9, 0xD1,
+    0x5B, 0x96, 0x58, 0xB4, 0x1D, 0x67, 0x5D, 0x1A, 0x1F, 0x86, 0xC7, 0xFE, 0x54, 0x3C, 0xE0, 0xB6,
+    0x2A, 0xDE, 0xDE, 0x47, 0x6B, 0x33, 0x5C, 0x71, 0x03, 0x11, 0xD7, 0xE0, 0xF4, 0xAA, 0xCA, 0x0F,
+    0xFD, 0x07, 0xAC, 0xF1, 0xB3, 0x9A, 0x3D, 0xDD, 0x0B, 0xEA, 0x66, 0x09, 0xD8, 0xA2, 0xC6, 0xF6,
+    0x7F, 0xAD, 0x4E, 0x35, 0x10, 0xA7, 0xAA, 0x6C, 0x25, 0xAC, 0xC6, 0xBF, 0x50, 0xBB, 0x38, 0x97,
+    0xD2, 0x26, 0xD7, 0xD3, 0xBC, 0xFD, 0x7A, 0xA4, 0xDF, 0x9D, 0x6B, 0x1F, 0xF7, 0x03, 0xF3, 0x56,
+    0x0C, 0x39, 0x73, 0xD8, 0xAB, 0xDE, 0x3B, 0x62, 0x30, 0x0C, 0xC5, 0xE7, 0x51, 0xAC, 0x70, 0xA2,
+    0xEC, 0x25, 0x75, 0x29, 0xBD, 0xDD, 0x17, 0x06, 0x02, 0xED, 0x7E, 0xC4, 0xEE, 0xEF, 0x90, 0xDD,
+    0x8E, 0x6C, 0x22, 0xE3, 0xE7, 0xE9, 0x84, 0x0D, 0x84, 0x0E, 0xB1, 0x51, 0x74, 0x55, 0x31, 0xB8,
+    0x92, 0x91, 0x7A, 0x7C, 0x97, 0xB7, 0x1B, 0x78, 0x4D, 0x8C, 0xF4, 0x4D, 0x58, 0x29, 0x0A, 0x32,
+    0x3F, 0x20, 0x2D, 0x5F, 0x78, 0xAD, 0x4A, 0x37, 0x90, 0xAE, 0xA5, 0x69, 0x3E, 0xBB, 0x13, 0x82,
+    0x62, 0x59, 0x0A, 0x42, 0x11, 0x4F, 0x72, 0x94, 0x9D, 0x5B, 0xBA, 0xDF, 0x34, 0x13, 0x65, 0x19,
+    0x75, 0x2C, 0x2C, 0xB5, 0x86, 0x4D, 0x66, 0x3B, 0xA9, 0x5F, 0x16, 0xA8, 0x11, 0xB0, 0x14, 0x5B,
+    0xC4, 0x71, 0xED, 0x50, 0xBB, 0x09, 0x5C, 0x2F, 0xA8, 0x37, 0xAE, 0x05, 0x3D, 0x86, 0xD4, 0x4C,
+    0xB5, 0x9D, 0xEA, 0xB7, 0xAD, 0x26, 0x07, 0x4E, 0xC9, 0xAA, 0x16, 0x72, 0xE6, 0x5B, 0xA6, 0x33,
+    0xDB, 0x3B, 0xB4, 0x56, 0xE7, 0x6B, 0xAE, 0xAD, 0x6B, 0x74, 0x3C, 0x06, 0x96, 0x8C, 0xDB, 0x70,
+    0x1E, 0xCE, 0x40, 0x47, 0x6E, 0x4C, 0xD8, 0xD1, 0x68, 0x2C, 0x76, 0xE4, 0x3C, 0xAC, 0xDD, 0x12,
+    0x45, 0x77, 0x56, 0x9A, 0x0D, 0xF3, 0x27, 0xA3, 0x0B, 0xBC, 0xA5, 0xDD, 0xAE, 0xF0, 0xB8, 0x47,
+    0xD6, 0xB3, 0x9F, 0xEF, 0x82, 0xF4, 0x17, 0x10, 0x2B, 0x6E, 0x30, 0x00, 0x2E, 0x30, 0x61, 0xF8,
+    0x94, 0xEA, 0x31, 0x21, 0x39, 0xBD, 0x1A, 0xB3, 0x0D, 0xB7, 0x4E, 0x7D, 0x5A, 0xF4, 0xE5, 0xC8,
+    0x58, 0x58, 0x25, 0x30, 0xCF, 0x3D, 0xAB, 0x65, 0x19, 0xAA, 0x9D, 0xCE, 0xE1, 0x65, 0x9B, 0xB0,
+    0xA2, 0x6A, 0xEB, 0x80, 0x28, 0x29, 0x71, 0x41, 0xF7, 0x59, 0x9A, 0x72, 0xC2, 0x18, 0xCE, 0x9D,
+    0x18, 0xD6, 0x6F, 0xB4, 0xDB, 0x3F, 0x39, 0xC7, 0xF7, 0x81, 0x29, 0x7C, 0x97, 0x53, 0x19, 0xB5,
+    0xF4, 0x27, 0x1A, 0xCA, 0xED, 0x72, 0x48, 0x57, 0xE5, 0x8B, 0x57, 0xEF, 0x51, 0xB3, 0xCF, 0xC5,
+    0x61, 0xB1, 0xCA, 0x0B, 0xA6, 0x8E, 0x4E, 0x29, 0xDD, 0x5E, 0x59, 0x63, 0xDD, 0x33, 0x59, 0x4D,
+    0x22, 0x5F, 0xBD, 0x67, 0x45, 0x9A, 0x93, 0x16, 0x69, 0xD5, 0xB4, 0x54, 0x1C, 0x81, 0xEE, 0x51,
+    0x2E, 0xD0, 0xFF, 0xA7, 0xB4, 0xFB, 0x1F, 0xB2, 0xEE, 0xE5, 0xCB, 0x83, 0x4E, 0xEE, 0x6E, 0xCF,
+    0xD3, 0xFE, 0xFB, 0x38, 0x72, 0xA8, 0x37, 0x12, 0xFC, 0xFF, 0x00, 0x9D, 0x57, 0xBD, 0x6F, 0x14,
+    0x47, 0x14, 0xFF, 0xED, 0xAE, 0xF1, 0x12, 0x56, 0xF6, 0x5A, 0x4A, 0x90, 0x90, 0x30, 0x3E, 0x0A,
+    0x17, 0x0E, 0xB9, 0xC3, 0x14, 0x8E, 0x74, 0xC5, 0xDE, 0xED, 0x44, 0x14, 0x14, 0x69, 0x5C, 0xE0,
+    0x34, 0x69, 0x5C, 0x92, 0x26, 0x50, 0xB8, 0xB8, 0x44, 0x26, 0xB7, 0x0A, 0xFF, 0x00, 0x7F, 0xC2,
+    0x49, 0x49, 0x81, 0xAC, 0x14, 0x57, 0x18, 0xC9, 0x8A, 0x2E, 0xBE, 0x89, 0x29, 0x28, 0x68, 0x36,
+    0x4A, 0x91, 0x22, 0x45, 0x96, 0x7C, 0x34, 0x41, 0x0A, 0x83, 0x74, 0x89, 0x0E, 0xB0, 0xBD, 0xF9,
+    0xBD, 0xD9, 0x3B, 0x38, 0x0E, 0x30, 0x97, 0xCC, 0xE7, 0xDE, 0x7B, 0x6F, 0xDE, 0xC7, 0xCC, 0x7B,
+    0x6F, 0xE6, 0x00, 0x4F, 0x21, 0xED, 0x9A, 0x56, 0xFA, 0x15, 0x5A, 0x47, 0x56, 0x29, 0x3E, 0xE6,
+    0x11, 0xF7, 0xE7, 0x97, 0xFC, 0x25, 0x1C, 0x5D, 0xB1, 0xD5, 0xCA, 0xCD, 0xDA, 0x6A, 0x31, 0xE6,
+    0x79, 0xAE, 0xA4, 0x6F, 0x49, 0xB9, 0x95, 0x4B, 0xD9, 0x5F, 0x93, 0x72, 0xD9, 0x2C, 0xFC, 0xD7,
+    0x0A, 0x9C, 0x5C, 0xBB, 0x1C, 0xE7, 0x07, 0x1C, 0xA9, 0x0F, 0x3F, 0xCE, 0x6D, 0xDD, 0x0A, 0x10,
+    0xE2, 0x3C, 0x6A, 0xD8, 0x44, 0x07, 0x73, 0x08, 0x55, 0x88, 0x12, 0x7F, 0x47, 0xA8, 0xF2, 0x57,
+    0x87, 0xD0, 0x1A, 0x2A, 0x58, 0x20, 0x8D, 0x83, 0xF0, 0x92, 0x0E, 0x03, 0x5D, 0x0A, 0x93, 0xF3,
+    0x21, 0xA2, 0x59, 0x54, 0xCF, 0x60, 0x6E, 0x0A, 0x3B, 0x5C, 0x59, 0x47, 0x54, 0x42, 0x25, 0xC4,
+    0x42, 0xA0, 0x42, 0x5F, 0x39, 0x0E, 0xD0, 0xB3, 0xAD, 0x6D, 0xDB, 0x35, 0x34, 0x73, 0xF3, 0xF9,
+    0xB7, 0x86, 0x1F, 0x83, 0xD6, 0x1E, 0xB6, 0x6D, 0xDB, 0x7A, 0xC3, 0xD6, 0xB7, 0xAD, 0x00, 0x5E,
+    0xC3, 0x27, 0xB7, 0x5B, 0xDD, 0xBC, 0x37, 0x77, 0x6D, 0x75, 0x00, 0x29, 0x50, 0x6D, 0x10, 0x42,
+    0x38, 0xB1, 0xC2, 0xEA, 0x19, 0x0A, 0xA5, 0x2C, 0xEE, 0xD9, 0x6A, 0x82, 0x74, 0x1D, 0xD7, 0xD1,
+    0x4C, 0x9B, 0xFD, 0x66, 0xD6, 0xC4, 0x86, 0x6C, 0x7D, 0xAD, 0x59, 0x9F, 0xE2, 0x54, 0x47, 0x2F,
+    0x76, 0xFA, 0x75, 0xA7, 0x37, 0x45, 0xE3, 0xEA, 0xB1, 0xC0, 0xBA, 0xBD, 0x16, 0x5A, 0x13, 0x1C,
+    0x5E, 0xB3, 0x8F, 0xA5, 0x37, 0x56, 0x96, 0xDC, 0x0C, 0xEB, 0x09, 0x1C, 0x55, 0x2D, 0x6D, 0xA6,
+    0x21, 0x75, 0x12, 0xDA, 0xAE, 0xC1, 0x05, 0xA9, 0x93, 0xD0, 0xDA, 0x12, 0x66, 0x28, 0x8B, 0xC9,
+    0x3B, 0x68, 0x70, 0xDA, 0x28, 0xC3, 0x70, 0x6A, 0x9F, 0x71, 0x52, 0x99, 0x66, 0x3D, 0xCD, 0xC9,
+    0xCC, 0x06, 0xCA, 0xFE, 0x0A, 0x61, 0x71, 0xE5, 0xE5, 0xA4, 0x94, 0x36, 0xCA, 0x8D, 0xA7, 0xD9,
+    0x17, 0xA6, 0xDE, 0x79, 0x94, 0x19, 0x53, 0x0D, 0xEF, 0xFF, 0xAA, 0x37, 0x4C, 0x04, 0xEF, 0x8E,
+    0xDE, 0xC8, 0xCA, 0xF0, 0x2F, 0xEA, 0x06, 0xA7, 0xD0, 0xB3, 0x53, 0xC5, 0xB5, 0xB8, 0xC8, 0x49,
+    0xDB, 0x9C, 0xDA, 0xF8, 0xC7, 0x7C, 0xD6, 0x73, 0x32, 0x34, 0xF5, 0x72, 0x86, 0xF1, 0x32, 0x50,
+    0x47, 0x34, 0xEA, 0xD0, 0xB7, 0x6C, 0x69, 0x54, 0xAC, 0x52, 0x22, 0x7B, 0xC1, 0x19, 0x2C, 0x31,
+    0x85, 0x6A, 0xF6, 0xCB, 0x57, 0x83, 0xAF, 0x85, 0x10, 0x43, 0xBA, 0xCA, 0x72, 0x12, 0x64, 0x7E,
+    0x8F, 0x6B, 0xA3, 0xAE, 0x89, 0xFB, 0xE1, 0x01, 0xF9, 0xB5, 0xCD, 0x76, 0x23, 0xA2, 0xFF, 0x85,
+    0xD9, 0xFD, 0x34, 0x6A, 0x2F, 0x44, 0x01, 0xE0, 0xEE, 0xA5, 0x91, 0xE1, 0x97, 0x82, 0xFF, 0x25,
+    0xBF, 0x66, 0x23, 0xF2, 0x0A, 0xDD, 0x21, 0x8C, 0xBB, 0x60, 0xE9, 0x14, 0xFD, 0x3C, 0x6B, 0x6C,
+    0x54, 0xA2, 0x50, 0xDC, 0xE8, 0xB1, 0xA9, 0x75, 0x4A, 0x9F, 0x52, 0x1C, 0xE2, 0xB4, 0x64, 0x82,
+    0xFD, 0x51, 0xF5, 0x8D, 0x93, 0x79, 0xDA, 0x57, 0xB3, 0x0C, 0xE1, 0x45, 0xFE, 0xDA, 0x71, 0x32,
+    0xE3, 0xED, 0xA5, 0xDC, 0x8E, 0xD9, 0x00, 0xF3, 0xB3, 0x58, 0x3C, 0x45, 0xE0, 0x76, 0x44, 0xE8,
+    0x36, 0xC1, 0xC6, 0xBF, 0xB8, 0x47, 0x84, 0x97, 0xCC, 0x13, 0xBB, 0x78, 0xEA, 0x38, 0x4F, 0xA0,
+    0xC6, 0x08, 0x0A, 0x94, 0xA7, 0xB9, 0xFD, 0xAB, 0x0D, 0xFE, 0xAC, 0x20, 0x24, 0xE0, 0x92, 0xE2,
+    0xBE, 0x3A, 0x29, 0x61, 0x04, 0x46, 0x84, 0x0A, 0x58, 0xE0, 0x82, 0xB0, 0x18, 0x41, 0xAD, 0x5A,
+    0x05, 0xE0, 0xF4, 0xE0, 0x7D, 0x03, 0x7F, 0x06, 0xB3, 0x27, 0x70, 0xC6, 0x43, 0xE4, 0x25, 0x1B,
+    0x8E, 0x46, 0xE2, 0xA5, 0x41, 0xB2, 0xCC, 0x38, 0xED, 0xD1, 0x96, 0x12, 0x02, 0xED, 0x66, 0x50,
+    0xC7, 0x19, 0xC1, 0xA1, 0xF2, 0x52, 0xC7, 0x60, 0xC7, 0x31, 0xBE, 0x0E, 0x55, 0x0D, 0x53, 0x85,
+    0x21, 0x73, 0x34, 0x74, 0x2E, 0x62, 0xC4, 0x98, 0x12, 0xB6, 0x69, 0x92, 0x26, 0x21, 0xC9, 0x6A,
+    0xB0, 0x2C, 0x50, 0xF2, 0x52, 0xCC, 0xF9, 0xBF, 0xA8, 0xB9, 0x8E, 0x73, 0x80, 0x7E, 0x07, 0xFB,
+    0xE8, 0x2F, 0x7A, 0x0F, 0xB1, 0x2E, 0xC1, 0xCF, 0x30, 0x22, 0x25, 0xA9, 0x36, 0x41, 0xAA, 0x12,
+    0x17, 0xAE, 0xFB, 0xBA, 0x86, 0xBE, 0x63, 0x16, 0xC9, 0x6F, 0x5D, 0x78, 0xA3, 0xEE, 0xA5, 0xCF,
+    0x5A, 0xCD, 0xD3, 0x95, 0x91, 0x56, 0xF6, 0xF4, 0xBC, 0x3B, 0x68, 0x03, 0x4F, 0xF0, 0xD2, 0xD8,
+    0xCF, 0xEA, 0x7E, 0x3A, 0x05, 0x39, 0xE9, 0xD3, 0xB9, 0x6A, 0x3E, 0x48, 0xDF, 0x4E, 0x8D, 0x9B,
+    0x6E, 0xDB, 0x66, 0xDC, 0x1F, 0x8C, 0x7B, 0x57, 0xBB, 0x0F, 0xE1, 0xEC, 0x83, 0xA2, 0xE9, 0x23,
+    0xD6, 0x7D, 0xA5, 0xF0, 0xC3, 0x33, 0x70, 0xA9, 0x8F, 0xC2, 0xB9, 0xAD, 0xAD, 0x9B, 0x71, 0x9E,
+    0x5B, 0x0F, 0xBA, 0x00, 0xAC, 0x30, 0x10, 0xDB, 0x21, 0x5C, 0xED, 0xFD, 0x71, 0x15, 0xB8, 0x4A,
+    0xAB, 0xDE, 0xFB, 0x1A, 0xEE, 0x93, 0xAE, 0x3D, 0x00, 0x3A, 0x61, 0x5B, 0x68, 0x86, 0x07, 0xEB,
+    0x25, 0xA0, 0x6B, 0xD0, 0x63, 0x66, 0x20, 0x0E, 0x5A, 0xB5, 0x09, 0xCA, 0xCA, 0xF1, 0x32, 0x78,
+    0x6D, 0x04, 0x2B, 0x98, 0x29, 0xA3, 0x3C, 0x83, 0xEA, 0x09, 0x5C, 0xF3, 0x65, 0x45, 0x54, 0x2C,
+    0x7C, 0x61, 0x5A, 0x8D, 0xEC, 0xF6, 0xEE, 0x5E, 0xDF, 0xB5, 0xB1, 0x9A, 0x1F, 0x5A, 0xE8, 0x6E,
+    0xA1, 0xE9, 0x43, 0xEB, 0xC6, 0xDE, 0x5D, 0x6B, 0x75, 0x78, 0xC7, 0xBA, 0xBC, 0xFF, 0x81, 0x18,
+    0xF2, 0x2E, 0xFB, 0x15, 0xC8, 0xE6, 0x4B, 0x90, 0x46, 0xC5, 0x24, 0x61, 0x52, 0xC5, 0xF5, 0xF2,
+    0x55, 0x3C, 0x5E, 0xF9, 0xAE, 0x9B, 0xE7, 0xC8, 0xF3, 0x03, 0xA7, 0xAB, 0x70, 0xEC, 0x40, 0xE1,
+    0xA9, 0x82, 0xF3, 0x17, 0xDC, 0xDF, 0x34, 0xBC, 0x7B, 0x89, 0xBF, 0x67, 0x10, 0xDE, 0xE0, 0xF1,
+    0x73, 0xE2, 0x81, 0x70, 0x23, 0x9C, 0xE1, 0xD5, 0x61, 0xED, 0x12, 0xAB, 0x98, 0xBA, 0x0B, 0xC6,
+    0xCC, 0x92, 0x34, 0x0B, 0xB2, 0xF5, 0x3E, 0x51, 0x12, 0x50, 0x15, 0x2B, 0x48, 0x5C, 0xCB, 0x6E,
+    0xAB, 0xC4, 0xDD, 0xE8, 0x0A, 0x49, 0x9C, 0x92, 0x50, 0x19, 0xE0, 0x2F, 0xD4, 0xD7, 0xC1, 0x9A,
+    0xA6, 0xD9, 0xC3, 0x58, 0x6D, 0xF6, 0x5E, 0x09, 0x1B, 0x44, 0xFD, 0xE9, 0x43, 0x74, 0xFB, 0xDC,
+    0xAD, 0x1F, 0x69, 0xE4, 0xA2, 0xFB, 0x48, 0x95, 0x94, 0x28, 0x13, 0x24, 0x32, 0xFA, 0xC9, 0xE0,
+    0x9B, 0xFE, 0x4C, 0x65, 0x03, 0xCD, 0x94, 0x8E, 0x58, 0x82, 0x80, 0xBE, 0x46, 0x6B, 0xE9, 0x0E,
+    0x0C, 0x5F, 0xEA, 0x1D, 0x62, 0x30, 0x8E, 0x96, 0x62, 0x11, 0x1D, 0x64, 0x39, 0x91, 0x51, 0x18,
+    0xAB, 0x21, 0x8E, 0x52, 0x3B, 0xDD, 0x3C, 0xED, 0x2C, 0xBA, 0xA6, 0x43, 0x19, 0xD2, 0x77, 0xD8,
+    0x1B, 0x5C, 0xD4, 0xA0, 0x9C, 0x06, 0xA5, 0x34, 0x28, 0x63, 0x83, 0x12, 0x56, 0xC8, 0xD9, 0xF6,
+    0x11, 0xBE, 0x3B, 0xE4, 0xB7, 0x2F, 0x9D, 0x1C, 0xE7, 0xAC, 0x17, 0x4F, 0xE7, 0x69, 0xBD, 0x94,
+    0xF7, 0xEA, 0x6F, 0xA1, 0x53, 0xE7, 0x61, 0xF2, 0x34, 0x19, 0xC7, 0x12, 0xE2, 0xE8, 0x54, 0xE8,
+    0xA1, 0x15, 0x32, 0x2D, 0x63, 0x99, 0x99, 0x23, 0x62, 0x6F, 0xB0, 0x6F, 0x3C, 0xD3, 0xB3, 0xCE,
+    0x58, 0x8A, 0xC9, 0xAA, 0xCE, 0xAB, 0x56, 0xEE, 0xA4, 0x93, 0x6B, 0x6B, 0x8A, 0x9E, 0xAC, 0x4F,
+    0xAE, 0x7D, 0x3C, 0x38, 0xA4, 0x81, 0x6F, 0xC8, 0x21, 0x51, 0x38, 0x18, 0xAF, 0x8C, 0x3B, 0x30,
+    0xBE, 0x8B, 0x43, 0xE2, 0xCD, 0x27, 0x31, 0xD9, 0xA5, 0xF3, 0xDF, 0xCE, 0x0F, 0xD0, 0xEE, 0xE6,
+    0xD2, 0x15, 0x7B, 0x32, 0xD6, 0x55, 0x81, 0x3B, 0x64, 0xEF, 0xA3, 0x7D, 0x5B, 0xA1, 0x2D, 0x77,
+    0xF0, 0x1B, 0xBA, 0x2D, 0xD4, 0x29, 0xA0, 0x4E, 0xCB, 0xF9, 0x4F, 0x3A, 0xCE, 0xEF, 0xE8, 0x26,
+    0x7B, 0x77, 0xAC, 0x0B, 0x4C, 0x70, 0xA5, 0xFC, 0x81, 0x9E, 0x26, 0xED, 0x60, 0x19, 0x5D, 0xB7,
+    0x8F, 0xBF, 0x19, 0x0D, 0x19, 0x4F, 0x98, 0x5D, 0xB1, 0x27, 0x63, 0x5D, 0x60, 0x78, 0x42, 0xDD,
+    0x07, 0x01, 0x2C, 0x89, 0x48, 0x4C, 0x8B, 0xA0, 0xAA, 0x53, 0x87, 0x9F, 0x1D, 0x4A, 0x30, 0x1D,
+    0x30, 0x88, 0x24, 0x80, 0xC2, 0x1B, 0x59, 0x60, 0x33, 0xC0, 0x15, 0xEE, 0xD9, 0xBE, 0x64, 0xE2,
+    0x17, 0xCA, 0xA6, 0x7D, 0xAE, 0x30, 0xF5, 0x15, 0xEE, 0x70, 0x44, 0xD4, 0xFF, 0xDF, 0xF2, 0xCA,
+    0xEC, 0x32, 0x81, 0xBE, 0x13, 0x9A, 0xC5, 0xD2, 0xF1, 0xF4, 0xBE, 0x9F, 0x34, 0x02, 0x7B, 0xFA,
+    0x15, 0xBB, 0xA4, 0x61, 0xDF, 0x4A, 0xC6, 0xE6, 0x24, 0x2D, 0x81, 0x41, 0xC7, 0x27, 0xF2, 0x0C,
+    0x91, 0x7E, 0x52, 0x0D, 0xF4, 0x76, 0x60, 0xF7, 0xFB, 0x1D, 0x9B, 0x57, 0xF2, 0xC7, 0xA2, 0xDE,
+    0x47, 0xF9, 0xEF, 0x6E, 0x5A, 0x06, 0x8F, 0x22, 0x39, 0x0B, 0x4C, 0xDF, 0x02, 0x8E, 0xAD, 0xC2,
+    0xE1, 0x26, 0xFB, 0x89, 0x9F, 0x70, 0x61, 0xC6, 0x9D, 0x58, 0x39, 0x2B, 0x19, 0x7B, 0x1A, 0x36,
+    0xEA, 0x83, 0x20, 0x80, 0x7F, 0xAF, 0x42, 0x1A, 0x26, 0x8A, 0x26, 0xEF, 0xF0, 0x3C, 0x4F, 0xCF,
+    0x75, 0xFF, 0x4C, 0xE4, 0xDD, 0xE1, 0xFE, 0xBC, 0x89, 0xE0, 0xC3, 0x12, 0x9C, 0xE0, 0x58, 0x91,
+    0x21, 0x86, 0xA5, 0x07, 0x87, 0xFE, 0xD7, 0x1A, 0xDD, 0x20, 0x46, 0x44, 0xC7, 0xB6, 0xF1, 0xB3,
+    0x91, 0xFB, 0xA1, 0x6F, 0x5F, 0x79, 0xAB, 0x90, 0xEB, 0x9A, 0x57, 0xA5, 0xDC, 0x95, 0xDF, 0xA7,
+    0x99, 0x7F, 0xF1, 0x86, 0xDC, 0x96, 0xBE, 0xA7, 0xE6, 0x67, 0x8A, 0xFB, 0xF2, 0xF8, 0x73, 0x01,
+    0xB0, 0x22, 0xC6, 0x84, 0xBC, 0x20, 0x0E, 0x8A, 0xD2, 0x6C, 0x28, 0xBB, 0x46, 0x84, 0xDE, 0x7C,
+    0x35, 0xE5, 0x3A, 0x8A, 0x68, 0x29, 0x98, 0x62, 0xF5, 0xF9, 0xA1, 0x38, 0xB2, 0xD6, 0xE9, 0x2D,
+    0xBD, 0x5E, 0xCA, 0xF3, 0xB5, 0xFD, 0xD1, 0xB5, 0x63, 0xC5, 0x0A, 0x7F, 0xAE, 0x8B, 0x55, 0x0D,
+    0x9B, 0x9D, 0xCD, 0x51, 0x9A, 0xAA, 0xFC, 0x94, 0x47, 0x9A, 0x64, 0x24, 0x89, 0x63, 0xE7, 0x65,
+    0x3E, 0x4B, 0x70, 0xC8, 0xC6, 0x23, 0x17, 0xCB, 0x44, 0xBD, 0x44, 0x30, 0xBA, 0x1E, 0xCF, 0x4E,
+    0x3E, 0x1A, 0x0C, 0x5E, 0x16, 0x05, 0xDA, 0x33, 0x51, 0xA8, 0xF9, 0xDC, 0x91, 0x17, 0x54, 0x34,
+    0x8A, 0x8D, 0xE5, 0xEF, 0x83, 0x1D, 0xC6, 0x10, 0x4E, 0x12, 0x4D, 0xCB, 0xDA, 0x30, 0xB1, 0x03,
+    0x54, 0xE4, 0x0C, 0xB1, 0x34, 0x6C, 0x2A, 0x8E, 0x2B, 0x36, 0x5F, 0xC5, 0xF5, 0xC1, 0x34, 0xF5,
+    0xCA, 0x01, 0xDD, 0xAC, 0x78, 0x86, 0x4E, 0xF4, 0xFC, 0x35, 0xFA, 0x82, 0xD4, 0x89, 0x9E, 0xBF,
+    0x59, 0xAC, 0x4B, 0xFC, 0x6F, 0x72, 0x02, 0x6F, 0xA6, 0x3D, 0xC6, 0xE8, 0x58, 0x4E, 0x62, 0x3D,
+    0xD4, 0xE5, 0x28, 0xDA, 0x10, 0xEF, 0xEB, 0x56, 0xEB, 0x5C, 0x32, 0x09, 0xDF, 0x5D, 0x4C, 0x6A,
+    0xDB, 0xBF, 0xED, 0x93, 0xB1, 0x6E, 0xD3, 0x50, 0x14, 0x86, 0x3F, 0x3B, 0xC5, 0x16, 0xB1, 0xB0,
+    0x3B, 0x50, 0x84, 0x44, 0x1B, 0x33, 0x42, 0x48, 0x9A, 0xC5, 0x83, 0x8B, 0x4C, 0x7C, 0x79, 0x83,
+    0xA8, 0xEA, 0x86, 0xA0, 0x1D, 0x58, 0x23, 0x75, 0x28, 0x12, 0x12, 0x34, 0xC9, 0x23, 0x64, 0xEB,
+    0xC0, 0xD2, 0x81, 0xA5, 0x20, 0xD1, 0x4B, 0x95, 0x01, 0xA9, 0x4D, 0xEA, 0x47, 0xE8, 0x23, 0x64,
+    0xC8, 0xC2, 0x96, 0xD1, 0x43, 0xD2, 0x70, 0x6E, 0x12, 0x04, 0xA8, 0x12, 0xE2, 0x01, 0xB8, 0xFF,
+    0xB1, 0x7D, 0xEF, 0xB9, 0x57, 0xFF, 0xF9, 0xCF, 0x39, 0xD7, 0x28, 0x82, 0x9C, 0x7A, 0x93, 0x38,
+    0xE0, 0xC0, 0xA3, 0x37, 0x37, 0x99, 0xBC, 0x0D, 0x48, 0x4A, 0x84, 0x13, 0x9C, 0x21, 0xE8, 0x55,
+    0xF4, 0x62, 0x1C, 0x23, 0xE3, 0x3D, 0x4C, 0xB0, 0x27, 0xB8, 0x09, 0x7E, 0x42, 0x92, 0xF0, 0xE6,
+    0x90, 0xD9, 0xAC, 0x43, 0x82, 0xB1, 0x47, 0x72, 0xA2, 0x36, 0xAD, 0xEE, 0xC4, 0xC4, 0xA4, 0xF9,
+    0x5A, 0x8B, 0xC0, 0xA0, 0xD5, 0x7F, 0x30, 0xE4, 0x2E, 0xEE, 0x94, 0x50, 0x99, 0x53, 0x91, 0xE2,
+    0xDD, 0x94, 0xC3, 0x90, 0x03, 0x57, 0x4C, 0x25, 0x01, 0xE1, 0x00, 0x67, 0x64, 0xE8, 0xDB, 0x33,
+    0xD6, 0x76, 0x61, 0x63, 0xCE, 0x16, 0x4B, 0x74, 0x18, 0x62, 0x67, 0x14, 0x32, 0x3C, 0x45, 0x51,
+    0x4E, 0x88, 0xE6, 0x09, 0xCF, 0x4A, 0x46, 0xB3, 0xBC, 0x45, 0xBF, 0x2C, 0x93, 0x70, 0x29, 0xBB,
+    0x3E, 0xE7, 0xB1, 0x14, 0x61, 0x6E, 0x52, 0xD8, 0xF7, 0xD0, 0x92, 0x91, 0xF8, 0x2F, 0x29, 0x7E,
+    0x40, 0xB4, 0x50, 0xA5, 0x9C, 0x13, 0x76, 0x85, 0xC7, 0xCA, 0xAC, 0xAC, 0xFC, 0x3D, 0x9D, 0x9A,
+    0x2F, 0xAA, 0x7C, 0x92, 0x4E, 0xD3, 0xEB, 0xB5, 0x1D, 0x48, 0xAF, 0xC1, 0xC1, 0xA7, 0x22, 0xF1,
+    0x23, 0xF6, 0x97, 0x88, 0x64, 0x55, 0x11, 0xAF, 0xC3, 0x9E, 0xCC, 0xD6, 0x65, 0x16, 0xE0, 0xE1,
+    0x0A, 0x3C, 0x81, 0x2F, 0x9E, 0x58, 0x76, 0x68, 0x9C, 0x4E, 0x7A, 0xBE, 0x2E, 0xFE, 0xC4, 0x71,
+    0x91, 0x7F, 0xA9, 0x31, 0xF6, 0x38, 0x18, 0x27, 0x9A, 0xF1, 0x1F, 0xD8, 0xB3, 0x54, 0x2D, 0x8F,
+    0xAB, 0x42, 0x6E, 0xC4, 0xF4, 0xEC, 0x2B, 0x4F, 0x55, 0x69, 0x5F, 0x97, 0x4F, 0x24, 0xBF, 0x5A,
+    0x4E, 0xB4, 0x89, 0x6C, 0x48, 0xA9, 0x8A, 0x39, 0xDE, 0x64, 0x9E, 0xDC, 0xDC, 0x06, 0x7D, 0x9E,
+    0x18, 0xCE, 0xFF, 0xBD, 0xFA, 0x7B, 0xAF, 0x9C, 0xD1, 0xED, 0x97, 0x78, 0xD6, 0x6E, 0xE9, 0x34,
+    0xF2, 0xA2, 0xA0, 0x7E, 0xEE, 0x3C, 0xB7, 0x47, 0xF8, 0xAF, 0x88, 0x5D, 0xB6, 0x5E, 0xA8, 0xFA,
+    0x27, 0x93, 0x52, 0x45, 0x74, 0x7C, 0xC6, 0xFA, 0x88, 0x9D, 0xE3, 0xEF, 0x92, 0x14, 0x3A, 0x91,
+    0x9D, 0x89, 0xC5, 0x76, 0x56, 0x29, 0x74, 0x82, 0x2F, 0x66, 0xEB, 0xA1, 0x43, 0x65, 0x03, 0x3F,
+    0xA6, 0x30, 0xA4, 0x70, 0x85, 0xAB, 0xD9, 0x10, 0x39, 0x3E, 0xAB, 0x16, 0x52, 0xCA, 0xC7, 0x4D,
+    0x24, 0xA6, 0x84, 0x4E, 0x67, 0x2A, 0x72, 0x89, 0x3D, 0x4A, 0x17, 0x58, 0x5D, 0x29, 0x96, 0xC1,
+    0xD9, 0xA8, 0xDF, 0xD4, 0xBF, 0xDD, 0x97, 0xC6, 0xAD, 0x85, 0x5F, 0xDF, 0xD7, 0xFA, 0x2C, 0x3B,
+    0xE7, 0x52, 0x9D, 0x65, 0xF2, 0xE7, 0x25, 0x8D, 0x15, 0xFD, 0x6B, 0x34, 0xB6, 0x87, 0x7D, 0xFA,
+    0xED, 0xA3, 0x8E, 0xF6, 0xED, 0x4C, 0xDF, 0xB9, 0xF9, 0x34, 0x56, 0x50, 0xDB, 0x37, 0x98, 0xB7,
+    0x87, 0xF4, 0x9B, 0xE8, 0x00, 0xED, 0xCE, 0x4D, 0x6E, 0xA2, 0xCF, 0xE0, 0x82, 0xAF, 0x46, 0xCC,
+    0xD2, 0xBC, 0xD1, 0xD6, 0xEB, 0x88, 0x4D, 0x9C, 0xB1, 0xF4, 0x74, 0xFD, 0xE9, 0xB7, 0x7B, 0x6A,
+    0x45, 0xAA, 0xD5, 0xEA, 0x36, 0x55, 0x85, 0x05, 0xD6, 0x09, 0xBA, 0x56, 0xE7, 0x07, 0x95, 0x56,
+    0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x1B, 0x7B, 0x8B, 0x11, 0x37, 0x14, 0x11, 0x29, 0x8C,
+    0xBD, 0x0D, 0x0D, 0x60, 0xFB, 0x28, 0x52, 0x18, 0x69, 0xD7, 0xB7, 0x52, 0x04, 0x14, 0x48, 0x60,
+    0x89, 0x44, 0x69, 0x29, 0x68, 0x30, 0xC5, 0xA5, 0xB0, 0x84, 0x25, 0x2E, 0xBE, 0x49, 0x28, 0x28,
+    0x28, 0x30, 0x45, 0x6A, 0x52, 0x50, 0x04, 0x2C, 0xE4, 0x2B, 0x82, 0xB4, 0x40, 0xEC, 0x5B, 0x08,
+    0x12, 0x1D, 0x2C, 0x48, 0x16, 0x12, 0x91, 0xF0, 0x20, 0x05, 0x59, 0xBA, 0x14, 0x1E, 0x89, 0x8D,
+    0x74, 0x0E, 0x7B, 0x37, 0x7C, 0x6F, 0xD6, 0x87, 0x11, 0x04, 0x24, 0xD6, 0xFB, 0x7D, 0x9E, 0x99,
+    0xDD, 0x7B, 0xF3, 0xFE, 0x67, 0x89, 0x88, 0x3C, 0x5B, 0x90, 0xB8, 0x97, 0x53, 0x84, 0xF1, 0x22,
+    0x90, 0x00, 0xB1, 0x77, 0x21, 0x8D, 0x03, 0x5B, 0xC4, 0x41, 0x4E, 0x09, 0xD0, 0x04, 0xE4, 0x8F,
+    0x7B, 0xA9, 0x6F, 0x6D, 0x4E, 0x67, 0xF6, 0x52, 0xC2, 0xFC, 0x04, 0x03, 0x45, 0x01, 0x0B, 0x69,
+    0x10, 0x35, 0x1E, 0x21, 0x6A, 0x8E, 0x09, 0xEF, 0x29, 0x59, 0x2D, 0x53, 0x73, 0x7E, 0x89, 0x92,
+    0xA5, 0xB3, 0xD4, 0x59, 0xBA, 0x44, 0xD9, 0x5A, 0x8F, 0xB2, 0x4B, 0x9A, 0x6E, 0xF6, 0x34, 0x65,
+    0xBA, 0xA0, 0xCE, 0x2F, 0x90, 0xFD, 0x43, 0x4E, 0xAD, 0xDB, 0x8A, 0x22, 0x20, 0xB4, 0x87, 0x10,
+    0x63, 0x29, 0x7C, 0x91, 0x28, 0x84, 0xA8, 0xA9, 0x29, 0xAA, 0xAF, 0xEE, 0xC8, 0xAD, 0x8B, 0x62,
+    0xCA, 0xE9, 0xB8, 0xCC, 0xFA, 0x01, 0x1D, 0x20, 0x6B, 0x74, 0x29, 0x93, 0x16, 0xC8, 0x01, 0xAC,
+    0x01, 0x31, 0x90, 0x00, 0x4D, 0x40, 0xEE, 0x43, 0x3D, 0xBB, 0x4B, 0xD4, 0x1F, 0x39, 0x51, 0xC2,
+    0x5A, 0x89, 0x3B, 0xA5, 0xBF, 0xDF, 0x83, 0x8F, 0xA4, 0x1D, 0xC9, 0x6B, 0xE7, 0xEB, 0x29, 0x76,
+    0xEB, 0xDB, 0x93, 0xA7, 0xEE, 0x8A, 0xC6, 0x90, 0x62, 0x15, 0x95, 0x1E, 0x79, 0x9A, 0xC8, 0xFF,
+    0x0B, 0x5A, 0x76, 0x48, 0x4F, 0x3F, 0xF8, 0xD0, 0x8D, 0xCF, 0xFC, 0xBA, 0xE2, 0xE6, 0xFC, 0x3F,
+    0x28, 0x6A, 0x07, 0xB1, 0x88, 0x96, 0xB5, 0x05, 0x03, 0x92, 0x5E, 0x65, 0x71, 0x9A, 0x3D, 0x5F,
+    0xD0, 0xCA, 0xEA, 0xB9, 0x9F, 0xD2, 0xDF, 0xEC, 0x81, 0x35, 0xF6, 0x79, 0xFB, 0x7E, 0x55, 0xD1,
+    0x2E, 0xC5, 0x43, 0x98, 0x96, 0x94, 0x35, 0xDD, 0x62, 0xAA, 0x40, 0x3E, 0x53, 0xC0, 0x24, 0x78,
+    0xAD, 0xC1, 0x4F, 0xE7, 0x99, 0x62, 0x10, 0xAD, 0xB1, 0x48, 0xC3, 0xC4, 0x1B, 0x88, 0x5C, 0x90,
+    0x2C, 0x24, 0x49, 0x0D, 0x18, 0xE0, 0x26, 0x00, 0xB7, 0x6C, 0xEF, 0x6E, 0x5F, 0xEF, 0x5B, 0x6B,
+    0xA4, 0xC4, 0x5C, 0xBC, 0x0C, 0x33, 0xAD, 0x69, 0x6F, 0x1D, 0x5E, 0x97, 0xFE, 0x3E, 0x49, 0xB2,
+    0xC7, 0xE8, 0x02, 0x2D, 0xA0, 0x49, 0xAD, 0x23, 0x62, 0xC5, 0x61, 0x41, 0x1C, 0x1A, 0x4E, 0x8A,
+    0x92, 0x3D, 0xEF, 0x28, 0x3B, 0xCB, 0xA3, 0x35, 0x90, 0xF9, 0x2C, 0x8D, 0xC3, 0x03, 0x9B, 0xB7,
+    0xEC, 0x97, 0x47, 0x69, 0x6B, 0x44, 0x37, 0x39, 0x38, 0x0F, 0xA3, 0x8C, 0x69, 0x63, 0x13, 0xD4,
+    0xD4, 0xCE, 0xA3, 0xF6, 0x2E, 0x93, 0x65, 0xCD, 0x23, 0x05, 0x0A, 0xB1, 0x91, 0x09, 0xF2, 0xD5,
+    0xD4, 0x04, 0x5F, 0x59, 0x6D, 0x82, 0x6F, 0xBE, 0x57, 0x46, 0xBC, 0xAB, 0xE8, 0x7E, 0x5B, 0x28,
+    0xB2, 0xA3, 0x40, 0xD3, 0x83, 0xA1, 0x3F, 0x22, 0x13, 0x53, 0x57, 0x99, 0x45, 0xE4, 0x83, 0x89,
+    0xC8, 0x37, 0x46, 0xA6, 0x9E, 0x31, 0xE1, 0xD7, 0x3E, 0x7E, 0x71, 0x67, 0xAB, 0x30, 0xFE, 0x81,
+    0xAD, 0x23, 0xB6, 0xE6, 0x6B, 0x41, 0xEB, 0x01, 0xEC, 0x8F, 0x1D, 0x85, 0xBD, 0x06, 0xC5, 0x62,
+    0x6D, 0x8E, 0x16, 0xC4, 0xD2, 0x02, 0xCD, 0xCA, 0xA5, 0x79, 0x9A, 0x6B, 0xC4, 0x31, 0x82, 0x6A,
+    0x6D, 0xBA, 0xDD, 0xEF, 0x8F, 0x53, 0x39, 0x3F, 0xBB, 0x44, 0x22, 0x6E, 0xAC, 0x51, 0xD8, 0x69,
+    0x5C, 0xA2, 0x20, 0x13, 0x3D, 0x0A, 0x4A, 0x61, 0x28, 0x30, 0xB0, 0xDF, 0x37, 0xD0, 0x00, 0x54,
+    0x10, 0xBF, 0x6A, 0xAD, 0x96, 0xC6, 0x2B, 0xA5, 0x41, 0xCE, 0x99, 0x47, 0x63, 0x69, 0xD6, 0x19,
+    0xC9, 0x7F, 0xE0, 0x34, 0x40, 0x8B, 0x40, 0xC7, 0x6C, 0x6C, 0x95, 0xA6, 0x6B, 0x37, 0xEB, 0xCC,
+    0x00, 0x5A, 0xD6, 0x38, 0xF0, 0xF8, 0x75, 0x99, 0x86, 0x76, 0x3F, 0x8D, 0xAE, 0xD9, 0x74, 0x99,
+    0x5A, 0x69, 0x87, 0x22, 0x40, 0xA6, 0xD9, 0x5F, 0xC0, 0xF3, 0x18, 0xEB, 0x2D, 0x3C, 0x97, 0x03,
+    0x8B, 0xAA, 0x7C, 0xF7, 0x38, 0x49, 0x21, 0x01, 0x15, 0xCA, 0x70, 0x93, 0x10, 0xF9, 0xDA, 0xB2,
+    0x9A, 0x46, 0xA4, 0x3C, 0x48, 0x9F, 0xE4, 0xE3, 0xCC, 0xDE, 0x79, 0xEA, 0xDA, 0x8A, 0x66, 0xAE,
+    0xAD, 0x10, 0x5C, 0x8B, 0xB1, 0x71, 0xE0, 0x00, 0xF0, 0x3B, 0x3E, 0x67, 0x52, 0xC5, 0xB1, 0x3F,
+    0x44, 0x55, 0xD7, 0xB2, 0x42, 0xE5, 0xEB, 0x50, 0x85, 0x79, 0xA8, 0x22, 0x8C, 0x13, 0x60, 0x48,
+    0xE1, 0x55, 0x4D, 0xE1, 0x3B, 0x39, 0x85, 0x1F, 0x70, 0x69, 0xD8, 0xBC, 0x6D, 0x07, 0x2A, 0xFC,
+    0x31, 0xAF, 0xD7, 0x55, 0x09, 0x74, 0x80, 0x26, 0x20, 0x55, 0xFD, 0x5B, 0x1F, 0x66, 0x5B, 0xCD,
+    0x39, 0x38, 0x31, 0x9D, 0xE4, 0x73, 0x40, 0x1B, 0x18, 0x02, 0xD8, 0xBC, 0x8B, 0xE6, 0x62, 0x5F,
+    0x26, 0xF1, 0xDE, 0x0E, 0xE6, 0x50, 0xA4, 0xA9, 0xD0, 0xA1, 0x52, 0x0A, 0xF7, 0x53, 0xF2, 0xFF,
+    0xFC, 0xCD, 0xC4, 0xDC, 0x19, 0x76, 0x22, 0x4C, 0x64, 0x65, 0x4F, 0x23, 0x73, 0x71, 0xAD, 0x48,
+    0xD6, 0x97, 0xC3, 0x04, 0xE6, 0x8A, 0xF4, 0x34, 0xDB, 0xEE, 0xEB, 0xDA, 0x03, 0x8E, 0x73, 0xCF,
+    0x78, 0xB0, 0xD6, 0xD7, 0x5D, 0x13, 0xAA, 0xA0, 0x38, 0xAA, 0x44, 0x2A, 0x6E, 0xEB, 0x44, 0xA6,
+    0xF2, 0x5C, 0x8E, 0xD6, 0xB1, 0x11, 0xE6, 0x71, 0x34, 0x5D, 0x09, 0x75, 0xAB, 0x89, 0x28, 0xDF,
+    0x2B, 0x9B, 0x47, 0x24, 0xFB, 0x2C, 0x4F, 0xBA, 0x4D, 0xE7, 0x1C, 0x2F, 0x38, 0x4E, 0x1C, 0xC7,
+    0x8E, 0x3B, 0xC7, 0x4A, 0xF9, 0xE8, 0x14, 0xE1, 0x21, 0x3A, 0xC7, 0x0B, 0x8A, 0x24, 0x37, 0x4E,
+    0x46, 0xA8, 0x48, 0xBC, 0x08, 0x33, 0xDE, 0xC3, 0xF6, 0x3F, 0x03, 0xD0, 0xD8, 0x1B, 0xBA, 0xA2,
+    0xF5, 0xAF, 0xC2, 0x93, 0xB7, 0x2B, 0x92, 0x87, 0x0B, 0x34, 0xB7, 0x1B, 0x51, 0x8C, 0x4A, 0x5D,
+    0x7F, 0x42, 0xA4, 0xEC, 0xF3, 0x93, 0x26, 0x8B, 0xB1, 0x0F, 0x37, 0x20, 0xFF, 0x43, 0xD8, 0x2C,
+    0xD0, 0x61, 0x84, 0xDA, 0x40, 0x04, 0xDB, 0x2B, 0x5C, 0xC5, 0x42, 0xC9, 0x54, 0x28, 0x91, 0x6E,
+    0x0F, 0xB6, 0x75, 0x7B, 0xD0, 0xBF, 0x2E, 0xD4, 0x32, 0x7A, 0x7A, 0x85, 0xF7, 0x0A, 0x17, 0xE1,
+    0x87, 0x81, 0xA8, 0xC7, 0x0E, 0xBC, 0x8B, 0x12, 0xAC, 0x82, 0x61, 0xEF, 0x35, 0x99, 0xF7, 0x50,
+    0xF3, 0x3D, 0xF4, 0xD7, 0x1E, 0x0C, 0xEA, 0xC1, 0x1C, 0xC6, 0xA7, 0xE7, 0x3B, 0x68, 0x9E, 0x1D,
+    0xFA, 0x7C, 0x07, 0xF3, 0x24, 0x01, 0xF0, 0x4E, 0x22, 0x55, 0x2F, 0x09, 0xCB, 0x5E, 0xE2, 0xD9,
+    0xDF, 0x47, 0xD4, 0x84, 0x32, 0x2C, 0x8B, 0x21, 0xB8, 0xDD, 0x01, 0x11, 0x1C, 0xBF, 0xCC, 0x3D,
+    0x03, 0xDD, 0x22, 0xCB, 0x88, 0x86, 0x1D, 0xEE, 0x36, 0xD5, 0xC5, 0xFB, 0xED, 0xF3, 0x01, 0x3A,
+    0xD3, 0x1B, 0x83, 0xED, 0x1B, 0x3C, 0x97, 0x69, 0x50, 0x44, 0x14, 0xE8, 0x45, 0xF2, 0x50, 0xD6,
+    0x54, 0xC2, 0x85, 0xD9, 0xF0, 0xD8, 0x93, 0xBE, 0x2D, 0x91, 0xCD, 0x63, 0x9A, 0x86, 0x56, 0x27,
+    0x61, 0x97, 0x29, 0xB2, 0xA7, 0x58, 0xDD, 0x1A, 0x6F, 0xF2, 0x1E, 0xBE, 0x6B, 0xCA, 0xB6, 0x60,
+    0x4C, 0xCE, 0x2E, 0xFE, 0x1F, 0xA5, 0x5E, 0x2A, 0xC7, 0x5C, 0x19, 0xE3, 0xE3, 0xA0, 0x40, 0x9F,
+    0xC8, 0x6E, 0x7A, 0xF0, 0x55, 0x58, 0xEA, 0x4D, 0x99, 0x6B, 0x48, 0xD5, 0xB0, 0x55, 0xC3, 0x56,
+    0x8D, 0x0D, 0xFF, 0x89, 0x84, 0xEA, 0x77, 0x22, 0xA5, 0x49, 0x68, 0xCD, 0x67, 0x5A, 0x41, 0x6D,
+    0xAE, 0x06, 0xED, 0xE4, 0x79, 0xE9, 0x69, 0x0A, 0xD4, 0x12, 0xB0, 0x4E, 0x62, 0x6F, 0x67, 0x05,
+    0x99, 0x5D, 0xCE, 0xEC, 0x1D, 0xAD, 0x08, 0x95, 0xD1, 0x7F, 0xE3, 0x16, 0xD0, 0xBA, 0x21, 0x54,
+    0x34, 0xA4, 0x93, 0xAB, 0x7B, 0xC4, 0x26, 0x23, 0xC4, 0xA2, 0x98, 0x3E, 0xCE, 0x70, 0x97, 0x6E,
+    0x6E, 0xC4, 0x6E, 0xA5, 0xC0, 0xBD, 0xEE, 0x8E, 0x90, 0x19, 0x4E, 0x78, 0xEA, 0xBB, 0xE7, 0xEA,
+    0xC9, 0x85, 0xB9, 0x30, 0x7F, 0xEB, 0xCE, 0xC1, 0xDB, 0xF9, 0x9B, 0xE7, 0xBE, 0xFC, 0x26, 0x6F,
+    0x05, 0x57, 0xBE, 0x4B, 0xE5, 0xC1, 0xD5, 0x31, 0x05, 0x7D, 0x44, 0x37, 0x08, 0xAE, 0xE6, 0xA0,
+    0x2B, 0x39, 0x4A, 0xDC, 0xE6, 0xFD, 0x49, 0x6B, 0xA0, 0xBA, 0x64, 0xDD, 0x9C, 0x4F, 0xD5, 0xFF,
+    0x81, 0x96, 0x1D, 0x71, 0xC5, 0x5D, 0x46, 0x6D, 0xD2, 0x53, 0xDB, 0x37, 0x30, 0xE5, 0xD5, 0x65,
+    0x7A, 0xAC, 0xA2, 0x96, 0x66, 0xF7, 0x43, 0x65, 0xB4, 0x12, 0x74, 0x4B, 0x2E, 0xB6, 0xCC, 0x45,
+    0xA5, 0x49, 0x7E, 0x71, 0xDC, 0x80, 0x8A, 0x27, 0x28, 0xB8, 0x53, 0xA2, 0xC8, 0x53, 0xEA, 0xC2,
+    0x93, 0x5F, 0x7C, 0x7F, 0x93, 0x82, 0x43, 0xB8, 0x18, 0xF6, 0x77, 0x0B, 0xAF, 0x78, 0xA5, 0xF0,
+    0x8B, 0xA0, 0xFE, 0xCB, 0x83, 0x42, 0x00, 0x11, 0x92, 0x64, 0x03, 0xEF, 0x0F, 0x01, 0x75, 0xE2,
+    0xB0, 0x88, 0x1D, 0xF1, 0x6C, 0xC9, 0x79, 0x17, 0x4F, 0xE8, 0xF2, 0xE5, 0x0B, 0x2B, 0xC8, 0x47,
+    0x7C, 0x7D, 0x4C, 0xED, 0x7E, 0xBC, 0x65, 0xB8, 0x30, 0xD7, 0x99, 0xE6, 0x29, 0x3E, 0xFB, 0xCC,
+    0xE3, 0x94, 0x8C, 0xAA, 0x79, 0x6A, 0x7E, 0xB7, 0x9F, 0xE1, 0x83, 0x06, 0xAD, 0x61, 0x97, 0xB3,
+    0xEC, 0x90, 0x65, 0xBD, 0x90, 0xBB, 0xBA, 0xDD, 0xE1, 0x38, 0x54, 0x93, 0x0D, 0xCC, 0xBF, 0xD0,
+    0xF4, 0x11, 0x7F, 0x34, 0x21, 0x3B, 0xC5, 0xD1, 0x83, 0x31, 0xD2, 0xC3, 0x34, 0xD1, 0xA9, 0x8D,
+    0xC8, 0x63, 0x3E, 0xBD, 0x3A, 0xDC, 0x7A, 0x3A, 0xDC, 0x79, 0xB2, 0x9A, 0xE8, 0x1F, 0x14, 0x22,
+    0x2A, 0x82, 0x3F, 0x68, 0x54, 0x94, 0x0B, 0x15, 0x16, 0x42, 0x05, 0xFA, 0x18, 0x18, 0x87, 0xB9,
+    0x28, 0xDA, 0xCA, 0x22, 0x71, 0xFB, 0xC8, 0xF1, 0x49, 0xB1, 0x72, 0x98, 0xDA, 0x83, 0xF4, 0x6F,
+    0x05, 0x7C, 0x0A, 0x68, 0xCC, 0x72, 0x12, 0x7C, 0xE2, 0xE2, 0x09, 0xA7, 0xDB, 0x08, 0x55, 0xF3,
+    0xED, 0x2C, 0x8E, 0x8D, 0xC6, 0x6C, 0x93, 0x96, 0x1B, 0xB3, 0x38, 0xF9, 0x40, 0x69, 0xA7, 0x31,
+    0x2B, 0x54, 0x4D, 0xA7, 0x4E, 0x79, 0x75, 0xC7, 0x72, 0xCD, 0x6B, 0x91, 0x26, 0x99, 0xC6, 0xED,
+    0x9F, 0xF8, 0x8C, 0x67, 0xED, 0xC6, 0x7C, 0x92, 0x8C, 0xC9, 0x9B, 0xA2, 0xF0, 0x25, 0xBE, 0xBB,
+    0xFC, 0x49, 0xA4, 0xB3, 0xE9, 0x32, 0xA3, 0x2A, 0xA3, 0x4E, 0x46, 0xB7, 0x32, 0x2A, 0x77, 0x2E,
+    0x1A, 0x7C, 0x12, 0xED, 0x6E, 0x1B, 0xB7, 0x18, 0x67, 0x94, 0xB8, 0xBB, 0x93, 0x79, 0x55, 0xDF,
+    0xF2, 0xA3, 0xFA, 0xB7, 0x10, 0x42, 0xAB, 0x38, 0xD5, 0x4C, 0x74, 0x6D, 0x73, 0xD9, 0x55, 0x37,
+    0x77, 0x04, 0xE2, 0x2F, 0x89, 0xCC, 0xDD, 0x58, 0x69, 0x41, 0x89, 0x81, 0xF1, 0xAD, 0x9E, 0xE4,
+    0xA6, 0x59, 0xFD, 0xF8, 0xFA, 0x1F, 0x5B, 0xB5, 0x6A, 0xD5, 0xFF, 0xFF, 0xFF, 0x19, 0x18, 0x18,
+    0x00, 0x63, 0x60, 0x60, 0x60, 0xE0, 0xFE, 0xEF, 0xC0, 0x60, 0xFF, 0xFE, 0x01, 0xC3, 0x1E, 0xC6,
+    0x0F, 0x0C, 0x5F, 0x60, 0x90, 0xF1, 0x67, 0xC0, 0x17, 0xEE, 0xFF, 0x1F, 0xC0, 0x34, 0x03, 0x21,
+    0xF8, 0x03, 0x88, 0xEB, 0x17, 0x7C, 0x61, 0xD0, 0xFF, 0xC2, 0x80, 0x00, 0xF5, 0x0F, 0x18, 0x18,
+    0x18, 0xFF, 0xFF, 0x61, 0x60, 0x60, 0xBE, 0x60, 0x0B, 0x24, 0x0E, 0xE8, 0x42, 0x08, 0xC6, 0xD5,
+    0x07, 0xEA, 0x42, 0xF4, 0xFF, 0x5F, 0xFA, 0xFF, 0xB7, 0x96, 0x0D, 0xC8, 0xDA, 0xC2, 0xC0, 0xA0,
+    0xCB, 0xB0, 0x03, 0x44, 0xD4, 0x81, 0x08, 0xF9, 0x2F, 0x40, 0x82, 0xE9, 0xBF, 0x03, 0x50, 0xB1,
+    0xFC, 0x05, 0x20, 0xC1, 0xF4, 0x00, 0x48, 0x30, 0x7E, 0xD0, 0x63, 0x70, 0x60, 0x7A, 0xA0, 0xCF,
+    0xB0, 0x6F, 0xFD, 0x01, 0xFE, 0x97, 0xF5, 0xFF, 0x18, 0xD8, 0xFF, 0x82, 0x6D, 0x00, 0x00, 0x45,
+    0x8D, 0xC1, 0x0D, 0x80, 0x30, 0x0C, 0x03, 0x23, 0xF2, 0xE4, 0x91, 0x01, 0xD8, 0x85, 0xC2, 0x64,
+    0x88, 0xC9, 0x28, 0x1B, 0x74, 0x04, 0x46, 0xE8, 0x07, 0x09, 0xA1, 0x8A, 0x23, 0x11, 0x0F, 0x22,
+    0xC7, 0x0F, 0x5B, 0xB6, 0x45, 0x54, 0xE2, 0x2C, 0x07, 0xA7, 0x1A, 0x4C, 0x73, 0x52, 0x08, 0x79,
+    0xEA, 0xDD, 0x18, 0xA5, 0x73, 0x83, 0x61, 0x6E, 0x21, 0xEF, 0x88, 0xC1, 0x4A, 0x4E, 0x3C, 0x4A,
+    0xDD, 0xB8, 0x8C, 0x2B, 0x51, 0x1D, 0xC6, 0xB1, 0x91, 0x95, 0x33, 0xC2, 0x10, 0x45, 0xE9, 0xC4,
+    0xB3, 0x56, 0x16, 0xEF, 0xD1, 0xB2, 0x44, 0xFF, 0xDD, 0xFE, 0xAD, 0x6F, 0xB7, 0xF3, 0x7F, 0x01,
 };
 
 static const EpdGlyph notosans_12_regularGlyphs[] = {
@@ -1546,99 +1549,99 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 4, 19, 108, 1, 18, 19, 0 }, // !
-    { 8, 7, 163, 1, 18, 14, 19 }, // "
-    { 16, 18, 258, 0, 18, 72, 33 }, // #
-    { 12, 21, 229, 1, 19, 63, 105 }, // $
-    { 19, 20, 332, 1, 19, 95, 168 }, // %
-    { 18, 20, 293, 1, 19, 90, 263 }, // &
-    { 3, 7, 90, 1, 18, 6, 353 }, // '
-    { 6, 22, 120, 1, 18, 33, 359 }, // (
-    { 7, 22, 120, 0, 18, 39, 392 }, // )
-    { 12, 12, 220, 1, 19, 36, 431 }, // *
-    { 12, 13, 229, 1, 15, 39, 467 }, // +
-    { 4, 7, 107, 1, 3, 7, 506 }, // ,
-    { 7, 3, 129, 1, 8, 6, 513 }, // -
-    { 4, 5, 107, 1, 4, 5, 519 }, // .
-    { 10, 18, 149, 0, 18, 45, 524 }, // /
-    { 13, 20, 234, 1, 19, 65, 569 }, // 0
-    { 8, 18, 176, 0, 18, 36, 634 }, // 1
-    { 13, 19, 222, 0, 19, 62, 670 }, // 2
-    { 12, 20, 229, 1, 19, 60, 732 }, // 3
-    { 14, 18, 229, 0, 18, 63, 792 }, // 4
-    { 12, 19, 229, 1, 18, 57, 855 }, // 5
-    { 13, 20, 229, 1, 19, 65, 912 }, // 6
-    { 13, 18, 204, 0, 18, 59, 977 }, // 7
-    { 13, 20, 236, 1, 19, 65, 1036 }, // 8
-    { 12, 20, 229, 1, 19, 60, 1101 }, // 9
-    { 4, 15, 107, 1, 14, 15, 1161 }, // :
-    { 5, 18, 107, 0, 14, 23, 1176 }, // ;
-    { 13, 14, 229, 1, 16, 46, 1199 }, // <
-    { 12, 8, 229, 1, 13, 24, 1245 }, // =
-    { 13, 14, 229, 1, 16, 46, 1269 }, // >
-    { 11, 20, 174, 0, 19, 55, 1315 }, // ?
-    { 21, 21, 360, 1, 18, 111, 1370 }, // @
-    { 16, 18, 256, 0, 18, 72, 1481 }, // A
-    { 13, 18, 260, 2, 18, 59, 1553 }, // B
-    { 15, 20, 253, 1, 19, 75, 1612 }, // C
-    { 15, 18, 292, 2, 18, 68, 1687 }, // D
-    { 11, 18, 222, 2, 18, 50, 1755 }, // E
-    { 11, 18, 208, 2, 18, 50, 1805 }, // F
-    { 16, 20, 291, 1, 19, 80, 1855 }, // G
-    { 15, 18, 296, 2, 18, 68, 1935 }, // H
-    { 7, 18, 136, 1, 18, 32, 2003 }, // I
-    { 7, 23, 109, -2, 18, 41, 2035 }, // J
-    { 14, 18, 248, 2, 18, 63, 2076 }, // K
-    { 11, 18, 210, 2, 18, 50, 2139 }, // L
-    { 19, 18, 363, 2, 18, 86, 2189 }, // M
-    { 15, 18, 304, 2, 18, 68, 2275 }, // N
-    { 17, 20, 312, 1, 19, 85, 2343 }, // O
-    { 12, 18, 242, 2, 18, 54, 2428 }, // P
-    { 17, 24, 312, 1, 19, 102, 2482 }, // Q
-    { 14, 18, 249, 2, 18, 63, 2584 }, // R
-    { 12, 20, 220, 1, 19, 60, 2647 }, // S
-    { 14, 18, 222, 0, 18, 63, 2707 }, // T
-    { 14, 19, 292, 2, 18, 67, 2770 }, // U
-    { 15, 18, 240, 0, 18, 68, 2837 }, // V
-    { 23, 18, 372, 0, 18, 104, 2905 }, // W
-    { 15, 18, 234, 0, 18, 68, 3009 }, // X
-    { 15, 18, 226, 0, 18, 68, 3077 }, // Y
-    { 14, 18, 229, 0, 18, 63, 3145 }, // Z
-    { 6, 22, 132, 2, 18, 33, 3208 }, // [
-    { 10, 18, 149, 0, 18, 45, 3241 }, // <backslash>
-    { 7, 22, 132, 0, 18, 39, 3286 }, // ]
-    { 14, 12, 229, 0, 18, 42, 3325 }, // ^
-    { 13, 2, 178, -1, -2, 7, 3367 }, // _
-    { 6, 5, 112, 1, 20, 8, 3374 }, // `
-    { 11, 15, 224, 1, 14, 42, 3382 }, // a
-    { 12, 20, 246, 2, 19, 60, 3424 }, // b
-    { 11, 15, 192, 1, 14, 42, 3484 }, // c
-    { 13, 20, 246, 1, 19, 65, 3526 }, // d
-    { 12, 15, 226, 1, 14, 45, 3591 }, // e
-    { 10, 20, 138, 0, 20, 50, 3636 }, // f
-    { 13, 20, 246, 1, 14, 65, 3686 }, // g
-    { 12, 19, 247, 2, 19, 57, 3751 }, // h
-    { 4, 19, 103, 1, 19, 19, 3808 }, // i
-    { 7, 25, 103, -2, 19, 44, 3827 }, // j
-    { 12, 19, 214, 2, 19, 57, 3871 }, // k
-    { 3, 19, 103, 2, 19, 15, 3928 }, // l
-    { 20, 14, 374, 2, 14, 70, 3943 }, // m
-    { 12, 14, 247, 2, 14, 42, 4013 }, // n
-    { 13, 15, 242, 1, 14, 49, 4055 }, // o
-    { 12, 20, 246, 2, 14, 60, 4104 }, // p
-    { 13, 20, 246, 1, 14, 65, 4164 }, // q
-    { 8, 14, 165, 2, 14, 28, 4229 }, // r
-    { 10, 15, 192, 1, 14, 38, 4257 }, // s
-    { 9, 18, 144, 0, 17, 41, 4295 }, // t
-    { 13, 15, 247, 1, 14, 49, 4336 }, // u
-    { 13, 14, 203, 0, 14, 46, 4385 }, // v
-    { 20, 14, 314, 0, 14, 70, 4431 }, // w
-    { 13, 14, 212, 0, 14, 46, 4501 }, // x
-    { 13, 20, 204, 0, 14, 65, 4547 }, // y
-    { 11, 14, 188, 0, 14, 39, 4612 }, // z
-    { 9, 22, 152, 0, 18, 50, 4651 }, // {
-    { 3, 26, 220, 5, 19, 20, 4701 }, // |
-    { 9, 22, 152, 0, 18, 50, 4721 }, // }
-    { 13, 4, 229, 1, 11, 13, 4771 }, // ~
+    { 8, 7, 163, 1, 18, 14, 0 }, // "
+    { 16, 18, 258, 0, 18, 72, 14 }, // #
+    { 12, 21, 229, 1, 19, 63, 86 }, // $
+    { 19, 20, 332, 1, 19, 95, 149 }, // %
+    { 18, 20, 293, 1, 19, 90, 244 }, // &
+    { 3, 7, 90, 1, 18, 6, 334 }, // '
+    { 6, 22, 120, 1, 18, 33, 19 }, // (
+    { 7, 22, 120, 0, 18, 39, 52 }, // )
+    { 12, 12, 220, 1, 19, 36, 340 }, // *
+    { 12, 13, 229, 1, 15, 39, 376 }, // +
+    { 4, 7, 107, 1, 3, 7, 91 }, // ,
+    { 7, 3, 129, 1, 8, 6, 98 }, // -
+    { 4, 5, 107, 1, 4, 5, 104 }, // .
+    { 10, 18, 149, 0, 18, 45, 415 }, // /
+    { 13, 20, 234, 1, 19, 65, 109 }, // 0
+    { 8, 18, 176, 0, 18, 36, 174 }, // 1
+    { 13, 19, 222, 0, 19, 62, 210 }, // 2
+    { 12, 20, 229, 1, 19, 60, 272 }, // 3
+    { 14, 18, 229, 0, 18, 63, 332 }, // 4
+    { 12, 19, 229, 1, 18, 57, 395 }, // 5
+    { 13, 20, 229, 1, 19, 65, 452 }, // 6
+    { 13, 18, 204, 0, 18, 59, 517 }, // 7
+    { 13, 20, 236, 1, 19, 65, 576 }, // 8
+    { 12, 20, 229, 1, 19, 60, 641 }, // 9
+    { 4, 15, 107, 1, 14, 15, 701 }, // :
+    { 5, 18, 107, 0, 14, 23, 716 }, // ;
+    { 13, 14, 229, 1, 16, 46, 460 }, // <
+    { 12, 8, 229, 1, 13, 24, 506 }, // =
+    { 13, 14, 229, 1, 16, 46, 530 }, // >
+    { 11, 20, 174, 0, 19, 55, 739 }, // ?
+    { 21, 21, 360, 1, 18, 111, 576 }, // @
+    { 16, 18, 256, 0, 18, 72, 794 }, // A
+    { 13, 18, 260, 2, 18, 59, 866 }, // B
+    { 15, 20, 253, 1, 19, 75, 925 }, // C
+    { 15, 18, 292, 2, 18, 68, 1000 }, // D
+    { 11, 18, 222, 2, 18, 50, 1068 }, // E
+    { 11, 18, 208, 2, 18, 50, 1118 }, // F
+    { 16, 20, 291, 1, 19, 80, 1168 }, // G
+    { 15, 18, 296, 2, 18, 68, 1248 }, // H
+    { 7, 18, 136, 1, 18, 32, 1316 }, // I
+    { 7, 23, 109, -2, 18, 41, 1348 }, // J
+    { 14, 18, 248, 2, 18, 63, 1389 }, // K
+    { 11, 18, 210, 2, 18, 50, 1452 }, // L
+    { 19, 18, 363, 2, 18, 86, 1502 }, // M
+    { 15, 18, 304, 2, 18, 68, 1588 }, // N
+    { 17, 20, 312, 1, 19, 85, 1656 }, // O
+    { 12, 18, 242, 2, 18, 54, 1741 }, // P
+    { 17, 24, 312, 1, 19, 102, 1795 }, // Q
+    { 14, 18, 249, 2, 18, 63, 1897 }, // R
+    { 12, 20, 220, 1, 19, 60, 1960 }, // S
+    { 14, 18, 222, 0, 18, 63, 2020 }, // T
+    { 14, 19, 292, 2, 18, 67, 687 }, // U
+    { 15, 18, 240, 0, 18, 68, 2083 }, // V
+    { 23, 18, 372, 0, 18, 104, 2151 }, // W
+    { 15, 18, 234, 0, 18, 68, 2255 }, // X
+    { 15, 18, 226, 0, 18, 68, 2323 }, // Y
+    { 14, 18, 229, 0, 18, 63, 2391 }, // Z
+    { 6, 22, 132, 2, 18, 33, 754 }, // [
+    { 10, 18, 149, 0, 18, 45, 787 }, // <backslash>
+    { 7, 22, 132, 0, 18, 39, 832 }, // ]
+    { 14, 12, 229, 0, 18, 42, 871 }, // ^
+    { 13, 2, 178, -1, -2, 7, 913 }, // _
+    { 6, 5, 112, 1, 20, 8, 920 }, // `
+    { 11, 15, 224, 1, 14, 42, 2454 }, // a
+    { 12, 20, 246, 2, 19, 60, 2496 }, // b
+    { 11, 15, 192, 1, 14, 42, 2556 }, // c
+    { 13, 20, 246, 1, 19, 65, 2598 }, // d
+    { 12, 15, 226, 1, 14, 45, 2663 }, // e
+    { 10, 20, 138, 0, 20, 50, 2708 }, // f
+    { 13, 20, 246, 1, 14, 65, 2758 }, // g
+    { 12, 19, 247, 2, 19, 57, 2823 }, // h
+    { 4, 19, 103, 1, 19, 19, 2880 }, // i
+    { 7, 25, 103, -2, 19, 44, 2899 }, // j
+    { 12, 19, 214, 2, 19, 57, 2943 }, // k
+    { 3, 19, 103, 2, 19, 15, 3000 }, // l
+    { 20, 14, 374, 2, 14, 70, 3015 }, // m
+    { 12, 14, 247, 2, 14, 42, 3085 }, // n
+    { 13, 15, 242, 1, 14, 49, 3127 }, // o
+    { 12, 20, 246, 2, 14, 60, 3176 }, // p
+    { 13, 20, 246, 1, 14, 65, 3236 }, // q
+    { 8, 14, 165, 2, 14, 28, 3301 }, // r
+    { 10, 15, 192, 1, 14, 38, 3329 }, // s
+    { 9, 18, 144, 0, 17, 41, 3367 }, // t
+    { 13, 15, 247, 1, 14, 49, 3408 }, // u
+    { 13, 14, 203, 0, 14, 46, 3457 }, // v
+    { 20, 14, 314, 0, 14, 70, 3503 }, // w
+    { 13, 14, 212, 0, 14, 46, 3573 }, // x
+    { 13, 20, 204, 0, 14, 65, 3619 }, // y
+    { 11, 14, 188, 0, 14, 39, 3684 }, // z
+    { 9, 22, 152, 0, 18, 50, 928 }, // {
+    { 3, 26, 220, 5, 19, 20, 978 }, // |
+    { 9, 22, 152, 0, 18, 50, 998 }, // }
+    { 13, 4, 229, 1, 11, 13, 1048 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 4, 19, 108, 1, 14, 19, 0 }, // U+00A1
     { 11, 20, 229, 2, 19, 55, 19 }, // U+00A2
@@ -1722,19 +1725,19 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 13, 21, 242, 1, 20, 69, 4714 }, // U+00F0
     { 12, 19, 247, 2, 19, 57, 4783 }, // U+00F1
     { 13, 21, 242, 1, 20, 69, 4840 }, // U+00F2
-    { 13, 21, 242, 1, 20, 69, 4909 }, // U+00F3
-    { 13, 21, 242, 1, 20, 69, 4978 }, // U+00F4
-    { 13, 20, 242, 1, 19, 65, 5047 }, // U+00F5
-    { 13, 20, 242, 1, 19, 65, 5112 }, // U+00F6
-    { 13, 12, 229, 1, 15, 39, 5177 }, // U+00F7
-    { 13, 16, 242, 1, 15, 52, 5216 }, // U+00F8
-    { 13, 21, 247, 1, 20, 69, 5268 }, // U+00F9
-    { 13, 21, 247, 1, 20, 69, 5337 }, // U+00FA
-    { 13, 21, 247, 1, 20, 69, 5406 }, // U+00FB
-    { 13, 20, 247, 1, 19, 65, 5475 }, // U+00FC
-    { 13, 26, 204, 0, 20, 85, 5540 }, // U+00FD
-    { 12, 25, 246, 2, 19, 75, 5625 }, // U+00FE
-    { 13, 25, 204, 0, 19, 82, 5700 }, // U+00FF
+    { 13, 21, 242, 1, 20, 69, 3723 }, // U+00F3
+    { 13, 21, 242, 1, 20, 69, 4909 }, // U+00F4
+    { 13, 20, 242, 1, 19, 65, 4978 }, // U+00F5
+    { 13, 20, 242, 1, 19, 65, 5043 }, // U+00F6
+    { 13, 12, 229, 1, 15, 39, 5108 }, // U+00F7
+    { 13, 16, 242, 1, 15, 52, 5147 }, // U+00F8
+    { 13, 21, 247, 1, 20, 69, 5199 }, // U+00F9
+    { 13, 21, 247, 1, 20, 69, 5268 }, // U+00FA
+    { 13, 21, 247, 1, 20, 69, 5337 }, // U+00FB
+    { 13, 20, 247, 1, 19, 65, 5406 }, // U+00FC
+    { 13, 26, 204, 0, 20, 85, 5471 }, // U+00FD
+    { 12, 25, 246, 2, 19, 75, 5556 }, // U+00FE
+    { 13, 25, 204, 0, 19, 82, 5631 }, // U+00FF
     { 16, 21, 256, 0, 21, 84, 0 }, // U+0100
     { 11, 18, 224, 1, 17, 50, 84 }, // U+0101
     { 16, 23, 256, 0, 23, 92, 134 }, // U+0102
@@ -2436,98 +2439,98 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 7, 3, 129, 1, 8, 6, 78 }, // U+2010
     { 7, 3, 129, 1, 8, 6, 84 }, // U+2011
     { 13, 2, 229, 1, 10, 7, 90 }, // U+2012
-    { 11, 3, 200, 1, 8, 9, 97 }, // U+2013
-    { 23, 3, 400, 1, 8, 18, 106 }, // U+2014
-    { 23, 3, 400, 1, 8, 18, 124 }, // U+2015
-    { 8, 26, 220, 3, 19, 52, 142 }, // U+2016
-    { 12, 6, 164, -1, 0, 18, 194 }, // U+2017
-    { 5, 7, 70, 0, 18, 9, 212 }, // U+2018
-    { 5, 7, 70, 0, 18, 9, 221 }, // U+2019
-    { 5, 7, 100, 0, 3, 9, 230 }, // U+201A
-    { 5, 7, 70, 0, 18, 9, 239 }, // U+201B
-    { 9, 7, 144, 0, 18, 16, 248 }, // U+201C
-    { 9, 7, 144, 0, 18, 16, 264 }, // U+201D
-    { 10, 7, 166, 0, 3, 18, 280 }, // U+201E
-    { 9, 7, 144, 0, 18, 16, 298 }, // U+201F
-    { 11, 19, 205, 1, 19, 53, 314 }, // U+2020
-    { 11, 19, 205, 1, 19, 53, 367 }, // U+2021
-    { 7, 7, 150, 1, 13, 13, 420 }, // U+2022
-    { 8, 8, 147, 1, 13, 16, 433 }, // U+2023
-    { 4, 5, 200, 4, 4, 5, 449 }, // U+2024
-    { 11, 5, 214, 1, 4, 14, 454 }, // U+2025
-    { 17, 5, 316, 1, 4, 22, 468 }, // U+2026
-    { 4, 5, 107, 1, 9, 5, 490 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 495 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 495 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 495 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 530 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 565 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 598 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 631 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 664 }, // U+202F
-    { 28, 20, 471, 1, 19, 140, 664 }, // U+2030
-    { 37, 20, 618, 1, 19, 185, 804 }, // U+2031
-    { 7, 7, 93, 0, 18, 13, 989 }, // U+2032
-    { 11, 7, 163, 0, 18, 20, 1002 }, // U+2033
-    { 16, 7, 234, 0, 18, 28, 1022 }, // U+2034
-    { 6, 7, 93, -1, 18, 11, 1050 }, // U+2035
-    { 10, 7, 176, -1, 18, 18, 1061 }, // U+2036
-    { 14, 7, 241, -1, 18, 25, 1079 }, // U+2037
-    { 10, 9, 160, 0, 3, 23, 1104 }, // U+2038
-    { 6, 11, 124, 1, 12, 17, 1127 }, // U+2039
-    { 7, 11, 124, 0, 12, 20, 1144 }, // U+203A
-    { 19, 20, 335, 1, 19, 95, 1164 }, // U+203B
-    { 10, 19, 200, 1, 18, 48, 1259 }, // U+203C
-    { 11, 20, 178, 0, 19, 55, 1307 }, // U+203D
-    { 14, 2, 200, -1, 21, 7, 1362 }, // U+203E
-    { 15, 6, 244, 0, 0, 23, 1369 }, // U+203F
-    { 15, 6, 244, 0, 20, 23, 1392 }, // U+2040
-    { 9, 17, 150, 0, 11, 39, 1415 }, // U+2041
-    { 28, 23, 447, 0, 19, 161, 1454 }, // U+2042
-    { 7, 3, 129, 1, 8, 6, 1615 }, // U+2043
-    { 13, 18, 52, -5, 18, 59, 1621 }, // U+2044
-    { 7, 22, 130, 1, 18, 39, 1680 }, // U+2045
-    { 7, 22, 130, 0, 18, 39, 1719 }, // U+2046
-    { 21, 20, 342, 0, 19, 105, 1758 }, // U+2047
-    { 16, 20, 272, 0, 19, 80, 1863 }, // U+2048
-    { 16, 20, 273, 1, 19, 80, 1943 }, // U+2049
-    { 13, 14, 229, 0, 14, 46, 2023 }, // U+204A
-    { 13, 23, 262, 2, 19, 75, 2069 }, // U+204B
-    { 13, 14, 256, 1, 14, 46, 2144 }, // U+204C
-    { 13, 14, 256, 2, 14, 46, 2190 }, // U+204D
-    { 12, 12, 220, 1, 6, 36, 2236 }, // U+204E
-    { 5, 18, 95, 1, 14, 23, 2272 }, // U+204F
-    { 15, 26, 242, 0, 20, 98, 2295 }, // U+2050
-    { 12, 25, 220, 1, 19, 75, 2393 }, // U+2051
-    { 10, 20, 149, 0, 19, 50, 2468 }, // U+2052
-    { 23, 5, 400, 1, 10, 29, 2518 }, // U+2053
-    { 15, 6, 242, 0, 0, 23, 2547 }, // U+2054
-    { 14, 14, 229, 0, 13, 49, 2570 }, // U+2055
-    { 11, 20, 207, 1, 19, 55, 2619 }, // U+2056
-    { 20, 7, 297, 0, 18, 35, 2674 }, // U+2057
-    { 19, 20, 329, 1, 19, 95, 2709 }, // U+2058
-    { 19, 20, 332, 1, 19, 95, 2804 }, // U+2059
-    { 4, 20, 88, 1, 19, 20, 2899 }, // U+205A
-    { 15, 20, 262, 1, 19, 75, 2919 }, // U+205B
-    { 19, 20, 318, 0, 19, 95, 2994 }, // U+205C
-    { 4, 19, 107, 1, 18, 19, 3089 }, // U+205D
-    { 4, 20, 107, 1, 19, 20, 3108 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 3128 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 3128 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 3128 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 3128 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 3128 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 3128 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 3128 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 3128 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 3128 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 3128 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 3128 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3161 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3194 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3227 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3260 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3293 }, // U+206F
+    { 11, 3, 200, 1, 8, 9, 3792 }, // U+2013
+    { 23, 3, 400, 1, 8, 18, 3801 }, // U+2014
+    { 23, 3, 400, 1, 8, 18, 97 }, // U+2015
+    { 8, 26, 220, 3, 19, 52, 115 }, // U+2016
+    { 12, 6, 164, -1, 0, 18, 167 }, // U+2017
+    { 5, 7, 70, 0, 18, 9, 185 }, // U+2018
+    { 5, 7, 70, 0, 18, 9, 3819 }, // U+2019
+    { 5, 7, 100, 0, 3, 9, 194 }, // U+201A
+    { 5, 7, 70, 0, 18, 9, 203 }, // U+201B
+    { 9, 7, 144, 0, 18, 16, 3828 }, // U+201C
+    { 9, 7, 144, 0, 18, 16, 3844 }, // U+201D
+    { 10, 7, 166, 0, 3, 18, 212 }, // U+201E
+    { 9, 7, 144, 0, 18, 16, 230 }, // U+201F
+    { 11, 19, 205, 1, 19, 53, 246 }, // U+2020
+    { 11, 19, 205, 1, 19, 53, 299 }, // U+2021
+    { 7, 7, 150, 1, 13, 13, 352 }, // U+2022
+    { 8, 8, 147, 1, 13, 16, 365 }, // U+2023
+    { 4, 5, 200, 4, 4, 5, 381 }, // U+2024
+    { 11, 5, 214, 1, 4, 14, 386 }, // U+2025
+    { 17, 5, 316, 1, 4, 22, 3860 }, // U+2026
+    { 4, 5, 107, 1, 9, 5, 400 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 405 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 405 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 405 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 440 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 475 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 508 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 541 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 574 }, // U+202F
+    { 28, 20, 471, 1, 19, 140, 574 }, // U+2030
+    { 37, 20, 618, 1, 19, 185, 714 }, // U+2031
+    { 7, 7, 93, 0, 18, 13, 899 }, // U+2032
+    { 11, 7, 163, 0, 18, 20, 912 }, // U+2033
+    { 16, 7, 234, 0, 18, 28, 932 }, // U+2034
+    { 6, 7, 93, -1, 18, 11, 960 }, // U+2035
+    { 10, 7, 176, -1, 18, 18, 971 }, // U+2036
+    { 14, 7, 241, -1, 18, 25, 989 }, // U+2037
+    { 10, 9, 160, 0, 3, 23, 1014 }, // U+2038
+    { 6, 11, 124, 1, 12, 17, 1037 }, // U+2039
+    { 7, 11, 124, 0, 12, 20, 1054 }, // U+203A
+    { 19, 20, 335, 1, 19, 95, 1074 }, // U+203B
+    { 10, 19, 200, 1, 18, 48, 1169 }, // U+203C
+    { 11, 20, 178, 0, 19, 55, 1217 }, // U+203D
+    { 14, 2, 200, -1, 21, 7, 1272 }, // U+203E
+    { 15, 6, 244, 0, 0, 23, 1279 }, // U+203F
+    { 15, 6, 244, 0, 20, 23, 1302 }, // U+2040
+    { 9, 17, 150, 0, 11, 39, 1325 }, // U+2041
+    { 28, 23, 447, 0, 19, 161, 1364 }, // U+2042
+    { 7, 3, 129, 1, 8, 6, 1525 }, // U+2043
+    { 13, 18, 52, -5, 18, 59, 1531 }, // U+2044
+    { 7, 22, 130, 1, 18, 39, 1590 }, // U+2045
+    { 7, 22, 130, 0, 18, 39, 1629 }, // U+2046
+    { 21, 20, 342, 0, 19, 105, 1668 }, // U+2047
+    { 16, 20, 272, 0, 19, 80, 1773 }, // U+2048
+    { 16, 20, 273, 1, 19, 80, 1853 }, // U+2049
+    { 13, 14, 229, 0, 14, 46, 1933 }, // U+204A
+    { 13, 23, 262, 2, 19, 75, 1979 }, // U+204B
+    { 13, 14, 256, 1, 14, 46, 2054 }, // U+204C
+    { 13, 14, 256, 2, 14, 46, 2100 }, // U+204D
+    { 12, 12, 220, 1, 6, 36, 2146 }, // U+204E
+    { 5, 18, 95, 1, 14, 23, 2182 }, // U+204F
+    { 15, 26, 242, 0, 20, 98, 2205 }, // U+2050
+    { 12, 25, 220, 1, 19, 75, 2303 }, // U+2051
+    { 10, 20, 149, 0, 19, 50, 2378 }, // U+2052
+    { 23, 5, 400, 1, 10, 29, 2428 }, // U+2053
+    { 15, 6, 242, 0, 0, 23, 2457 }, // U+2054
+    { 14, 14, 229, 0, 13, 49, 2480 }, // U+2055
+    { 11, 20, 207, 1, 19, 55, 2529 }, // U+2056
+    { 20, 7, 297, 0, 18, 35, 2584 }, // U+2057
+    { 19, 20, 329, 1, 19, 95, 2619 }, // U+2058
+    { 19, 20, 332, 1, 19, 95, 2714 }, // U+2059
+    { 4, 20, 88, 1, 19, 20, 2809 }, // U+205A
+    { 15, 20, 262, 1, 19, 75, 2829 }, // U+205B
+    { 19, 20, 318, 0, 19, 95, 2904 }, // U+205C
+    { 4, 19, 107, 1, 18, 19, 2999 }, // U+205D
+    { 4, 20, 107, 1, 19, 20, 3018 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 3038 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 3038 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 3038 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 3038 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 3038 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 3038 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 3038 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 3038 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 3038 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 3038 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 3038 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 3071 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 3104 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 3137 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 3170 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3203 }, // U+206F
     { 9, 12, 140, 0, 22, 27, 0 }, // U+2070
     { 2, 12, 67, 1, 19, 6, 27 }, // U+2071
     { 9, 12, 140, 0, 22, 27, 33 }, // U+2074
@@ -2604,13 +2607,13 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 12, 24, 229, 2, 21, 72, 2375 }, // U+20BF
     { 10, 18, 197, 1, 14, 45, 2447 }, // U+20C0
     { 12, 3, 229, 1, 10, 9, 0 }, // U+2212
-    { 19, 20, 275, 0, 20, 95, 0 }, // U+FB00
-    { 14, 20, 241, 0, 20, 70, 95 }, // U+FB01
-    { 13, 20, 241, 0, 20, 65, 165 }, // U+FB02
-    { 22, 20, 378, 0, 20, 110, 230 }, // U+FB03
-    { 22, 20, 378, 0, 20, 110, 340 }, // U+FB04
-    { 15, 21, 269, 2, 20, 79, 450 }, // U+FB05
-    { 20, 21, 336, 1, 20, 105, 529 }, // U+FB06
+    { 19, 20, 275, 0, 20, 95, 3882 }, // U+FB00
+    { 14, 20, 241, 0, 20, 70, 3977 }, // U+FB01
+    { 13, 20, 241, 0, 20, 65, 4047 }, // U+FB02
+    { 22, 20, 378, 0, 20, 110, 4112 }, // U+FB03
+    { 22, 20, 378, 0, 20, 110, 4222 }, // U+FB04
+    { 15, 21, 269, 2, 20, 79, 0 }, // U+FB05
+    { 20, 21, 336, 1, 20, 105, 79 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -2618,8 +2621,7 @@ static const EpdUnicodeInterval notosans_12_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -2627,8 +2629,7 @@ static const EpdUnicodeInterval notosans_12_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -2638,19 +2639,57 @@ static const EpdUnicodeInterval notosans_12_regularIntervals[] = {
 };
 
 static const EpdFontGroup notosans_12_regularGroups[] = {
-    { 0, 2533, 5334, 97, 0 },
-    { 2533, 2330, 6440, 96, 97 },
-    { 4863, 2768, 9849, 128, 193 },
-    { 7631, 2802, 9019, 96, 321 },
-    { 10433, 977, 1484, 112, 417 },
-    { 11410, 7120, 20261, 256, 529 },
-    { 18530, 1822, 8369, 90, 785 },
-    { 20352, 1673, 3716, 111, 875 },
-    { 22025, 524, 1082, 42, 986 },
-    { 22549, 1560, 2719, 33, 1028 },
-    { 24109, 11, 9, 1, 1061 },
-    { 24120, 250, 689, 7, 1062 },
-    { 24370, 97, 138, 1, 1069 },
+    { 0, 2140, 4821, 83, 2 },
+    { 2140, 652, 1205, 26, 0 },
+    { 2792, 2322, 6356, 95, 97 },
+    { 5114, 2768, 9849, 128, 193 },
+    { 7882, 2802, 9019, 96, 321 },
+    { 10684, 977, 1484, 112, 417 },
+    { 11661, 7120, 20261, 256, 529 },
+    { 18781, 1822, 8369, 90, 785 },
+    { 20603, 1607, 3608, 105, 875 },
+    { 22210, 524, 1082, 42, 986 },
+    { 22734, 1560, 2719, 33, 1028 },
+    { 24294, 11, 9, 1, 1061 },
+    { 24305, 126, 189, 2, 1067 },
+    { 24431, 97, 138, 1, 1069 },
+};
+
+static const uint16_t notosans_12_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_12_regularKernLeftClasses[] = {
@@ -3709,18 +3748,81 @@ static const EpdLigaturePair notosans_12_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_12_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 61, 49 }, { 0x0265, 66, 51 }, { 0x0266, 70, 60 }, { 0x0267, 0, 0 }, { 0x0268, 71, 61 }, // U+0450
+    { 0x0269, 72, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 73, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_12_regular = {
     notosans_12_regularBitmaps,
     notosans_12_regularGlyphs,
     notosans_12_regularIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notosans_12_regularGroups,
-    13,
-    nullptr,
+    14,
+    notosans_12_regularGlyphToGroup,
     notosans_12_regularKernLeftClasses,
     notosans_12_regularKernRightClasses,
     notosans_12_regularKernMatrix,
@@ -3730,4 +3832,8 @@ static const EpdFontData notosans_12_regular = {
     76,
     notosans_12_regularLigaturePairs,
     5,
+    notosans_12_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
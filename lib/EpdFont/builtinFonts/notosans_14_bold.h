@@ -3,2039 +3,2045 @@
  * name: notosans_14_bold
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_boldBitmaps[32428] = {
-    0xC5, 0x59, 0x3D, 0x8F, 0xDD, 0xC6, 0x15, 0x9D, 0xF7, 0x68, 0x2D, 0x93, 0x10, 0x01, 0x5D, 0x48,
-    0x30, 0x60, 0x05, 0x61, 0xBF, 0x0D, 0xFF, 0x41, 0x86, 0xB2, 0x11, 0xB8, 0x70, 0xA1, 0x2D, 0xA4,
-    0xA4, 0x50, 0xA1, 0xC6, 0x8D, 0x9D, 0x62, 0x1B, 0xD7, 0x1A, 0xCA, 0x2A, 0x5C, 0xA8, 0xB0, 0x9A,
-    0xF4, 0x2A, 0xE4, 0x20, 0x7E, 0x45, 0x94, 0x22, 0x55, 0x00, 0x6B, 0x68, 0xAB, 0x48, 0x91, 0x42,
-    0x14, 0x16, 0x8E, 0x4B, 0x31, 0x88, 0xEC, 0x20, 0xEB, 0x42, 0x4C, 0xCC, 0x58, 0x5C, 0x69, 0xC8,
-    0xC9, 0x39, 0x77, 0xC8, 0xB7, 0xBB, 0x92, 0x77, 0xBD, 0xB1, 0x02, 0xE4, 0x3D, 0xCE, 0xE5, 0x5B,
-    0x72, 0x3E, 0xEF, 0xC7, 0x99, 0x73, 0x67, 0x4D, 0x6D, 0x1A, 0x5D, 0xAF, 0xBF, 0xD5, 0xFC, 0xCD,
-    0xF1, 0x55, 0xF8, 0x9C, 0x52, 0x1A, 0x35, 0x50, 0xA7, 0xC2, 0xAF, 0xBB, 0x6E, 0xBA, 0xDE, 0x9B,
-    0xAE, 0xFC, 0xB5, 0xFE, 0xD5, 0x73, 0xB7, 0x54, 0xD4, 0xFC, 0x4C, 0xA9, 0xB8, 0xBD, 0xA2, 0x54,
-    0xD2, 0x7C, 0x0C, 0x51, 0x0F, 0x4A, 0xA5, 0x95, 0x0B, 0x22, 0xF3, 0xDE, 0xB7, 0xFB, 0x42, 0xE9,
-    0xA8, 0x55, 0x41, 0x98, 0xB8, 0x51, 0xEF, 0xF8, 0xDB, 0x4F, 0x4A, 0x83, 0x17, 0x95, 0x88, 0xC5,
-    0x90, 0x61, 0x58, 0x07, 0xB1, 0xE8, 0xF3, 0x52, 0x2D, 0xFB, 0xBC, 0x50, 0x51, 0xA7, 0x95, 0x8A,
-    0x5A, 0xAD, 0xC2, 0x27, 0x29, 0xA4, 0x2C, 0xEC, 0x58, 0xA4, 0xE8, 0x4F, 0xA3, 0x18, 0x7F, 0xBB,
-    0xB6, 0xD7, 0x8B, 0x02, 0x45, 0xD9, 0xAF, 0x0A, 0xA5, 0x7D, 0x81, 0x61, 0x3B, 0x15, 0x79, 0xFC,
-    0xD8, 0xF6, 0xB5, 0x4A, 0x30, 0x6E, 0x72, 0xB9, 0x53, 0xC9, 0xF9, 0xFE, 0x56, 0x72, 0xBE, 0xB3,
-    0x8F, 0x7C, 0x6B, 0xBD, 0xAF, 0x51, 0x8A, 0x0D, 0xFB, 0x70, 0xDD, 0xA7, 0xDA, 0x50, 0xF3, 0x67,
-    0x89, 0x96, 0xBA, 0x50, 0x29, 0x1A, 0x5B, 0x85, 0xCE, 0x5A, 0x85, 0x35, 0xE9, 0xBB, 0xDD, 0x12,
-    0xAB, 0xD2, 0xAF, 0xF7, 0xB2, 0x86, 0xD7, 0x5C, 0xDA, 0xC8, 0x8D, 0x73, 0xD6, 0xAF, 0xF5, 0xBA,
-    0x94, 0x77, 0x66, 0xE3, 0xA1, 0xCA, 0xEF, 0x76, 0x83, 0x1E, 0xD1, 0xEE, 0x5F, 0xCE, 0xFA, 0x22,
-    0xF1, 0x3B, 0xDD, 0x98, 0x57, 0x8B, 0x31, 0xF9, 0xA7, 0x4B, 0x51, 0x37, 0xFD, 0xC4, 0xA5, 0x35,
-    0xEA, 0x5E, 0x95, 0x9B, 0x59, 0xC8, 0x6D, 0x94, 0xDB, 0xC2, 0x29, 0xAA, 0x20, 0xEA, 0x94, 0xB7,
-    0x95, 0x4A, 0xA0, 0x2E, 0x8F, 0xFA, 0xB5, 0xCA, 0x86, 0x30, 0xAF, 0x62, 0x9E, 0xA0, 0x19, 0x64,
-    0x96, 0x1E, 0x63, 0xC6, 0x58, 0x0A, 0x2A, 0xED, 0x19, 0x4C, 0x2A, 0x6D, 0x53, 0x91, 0x19, 0x65,
-    0xA7, 0xF1, 0x3C, 0x1E, 0x3C, 0x86, 0x84, 0x2A, 0x50, 0x7F, 0xE1, 0x7B, 0x6A, 0xD0, 0xB7, 0x4B,
-    0xAF, 0x72, 0xEF, 0xA2, 0x41, 0xE9, 0xC7, 0x3E, 0x76, 0xCA, 0x56, 0xFE, 0x5E, 0xAF, 0x7C, 0xA5,
-    0xB1, 0x4E, 0x5F, 0xA5, 0xBE, 0x51, 0xB6, 0x8E, 0xD0, 0xCC, 0xEC, 0x51, 0x7B, 0x50, 0x31, 0x94,
-    0x09, 0x65, 0x3F, 0x1A, 0xD0, 0xC3, 0x18, 0x41, 0x35, 0x0B, 0xCE, 0x63, 0xF2, 0x95, 0x92, 0xDF,
-    0xBC, 0x78, 0xB5, 0x50, 0x77, 0x14, 0xD4, 0x13, 0xF5, 0x9C, 0x36, 0x34, 0x03, 0x07, 0xD2, 0xB8,
-    0x4A, 0x65, 0x0A, 0xEA, 0x10, 0x97, 0x3F, 0x70, 0x85, 0x27, 0x78, 0x85, 0x0A, 0xA8, 0x96, 0xD7,
-    0x6C, 0x82, 0x86, 0x68, 0xBE, 0xC0, 0xD2, 0xDE, 0x56, 0x30, 0x3F, 0xD6, 0x1D, 0x9E, 0xA0, 0x5B,
-    0x3E, 0x9C, 0x5A, 0x16, 0x73, 0xB3, 0xC3, 0x17, 0x87, 0x29, 0x42, 0x1D, 0x54, 0x8E, 0x64, 0x26,
-    0x50, 0x46, 0x56, 0xAB, 0xCD, 0x49, 0x6B, 0x34, 0x17, 0x4B, 0x52, 0x4B, 0xC9, 0xDF, 0xFF, 0x4B,
-    0x8F, 0xB5, 0xB1, 0xB8, 0x53, 0x66, 0x6F, 0x4B, 0x69, 0x18, 0x77, 0x1C, 0x31, 0x9A, 0x29, 0x22,
-    0xA7, 0xAB, 0x45, 0xF7, 0x53, 0xA5, 0x5E, 0x66, 0x10, 0x14, 0x74, 0xE5, 0xE7, 0x0A, 0xDC, 0xA7,
-    0xF3, 0x53, 0x39, 0x73, 0xF9, 0xB3, 0xAD, 0xE7, 0xEB, 0x94, 0xEA, 0xD4, 0x56, 0xDA, 0xC1, 0x26,
-    0x4D, 0x56, 0xE7, 0xD4, 0x94, 0xDA, 0x5C, 0x15, 0xF0, 0xCE, 0x70, 0x1D, 0x8C, 0x2D, 0xCE, 0x7A,
-    0x29, 0xB3, 0x8E, 0xA1, 0xBF, 0x4E, 0x26, 0xDE, 0x88, 0xFE, 0xAA, 0xB0, 0xAA, 0xC5, 0x78, 0xDC,
-    0xFB, 0xB5, 0x57, 0xF4, 0xE2, 0xF4, 0x09, 0x42, 0x29, 0x1B, 0x6D, 0x9B, 0xC3, 0x0F, 0x74, 0x9D,
-    0xF6, 0xBA, 0x4A, 0x7A, 0x53, 0xC5, 0xEE, 0xA8, 0x82, 0xF7, 0x8E, 0xF5, 0xF2, 0x16, 0xB3, 0x85,
-    0x1F, 0xA1, 0x3D, 0xEC, 0x0F, 0xDF, 0xB2, 0xD0, 0x3A, 0x6D, 0x8D, 0x41, 0x73, 0x38, 0x48, 0x1F,
-    0xF9, 0x3E, 0xF3, 0xBD, 0xF9, 0xAA, 0xD7, 0xD7, 0xFB, 0x1F, 0x27, 0x98, 0xC9, 0xC9, 0x2E, 0x99,
-    0xDA, 0x28, 0x8E, 0x9A, 0x13, 0x08, 0x46, 0xDB, 0x27, 0x55, 0xEA, 0x16, 0x0A, 0xBE, 0x27, 0x85,
-    0x75, 0xD2, 0x0E, 0x2E, 0x05, 0xB7, 0x85, 0xDF, 0x33, 0xFA, 0x12, 0x0C, 0x9D, 0xE3, 0x91, 0xAD,
-    0xC3, 0x9F, 0xA8, 0x95, 0x8F, 0xAB, 0x8F, 0x60, 0xAC, 0x71, 0x2E, 0xEC, 0x76, 0x03, 0x2E, 0x0D,
-    0xE8, 0x28, 0x50, 0x6A, 0xFD, 0xA5, 0x6F, 0x7E, 0x20, 0x7D, 0xD0, 0xFD, 0x73, 0x06, 0x67, 0xB5,
-    0xF8, 0x85, 0x2F, 0x96, 0xA8, 0xB3, 0xF4, 0x7B, 0x0C, 0x17, 0x58, 0xC5, 0xF2, 0x7D, 0x17, 0xC6,
-    0x4B, 0xBB, 0x02, 0x83, 0xEC, 0x9D, 0xB3, 0x2D, 0x8C, 0x58, 0xA3, 0x14, 0xDB, 0x0C, 0x91, 0xD3,
-    0xEC, 0x99, 0xED, 0x95, 0xA1, 0x40, 0x3C, 0xA0, 0x6D, 0xC3, 0x48, 0xA3, 0x07, 0x51, 0xE4, 0x8F,
-    0x20, 0x0C, 0xAB, 0x0C, 0x10, 0x4B, 0x07, 0x11, 0xB7, 0x10, 0x69, 0x93, 0xD3, 0xF3, 0x21, 0xCC,
-    0xAE, 0x7D, 0x42, 0x17, 0xF1, 0x41, 0xBC, 0xB3, 0xC2, 0x9F, 0x53, 0xA7, 0x87, 0x44, 0x4A, 0x5B,
-    0x4D, 0x25, 0x67, 0x81, 0x73, 0xCE, 0x45, 0xDF, 0x27, 0x98, 0x0D, 0x8C, 0xC0, 0x12, 0xA5, 0xFE,
-    0xE1, 0x39, 0x4E, 0x3E, 0x5F, 0x4F, 0x3E, 0x94, 0xBC, 0xBD, 0x72, 0x91, 0x20, 0x28, 0x18, 0x5A,
-    0xE4, 0xEB, 0x05, 0x88, 0x76, 0x30, 0x11, 0xDF, 0x2E, 0xA0, 0xF4, 0xD8, 0x7F, 0xB8, 0x95, 0xF6,
-    0x93, 0x6A, 0xD8, 0xF7, 0x27, 0x6F, 0x29, 0xFD, 0x81, 0x2F, 0x8D, 0x95, 0xB6, 0xBD, 0xE9, 0x52,
-    0x67, 0x6A, 0xFA, 0x43, 0x24, 0x45, 0xD7, 0x28, 0x6D, 0xE2, 0xB2, 0xBD, 0xED, 0x1E, 0xFE, 0xD0,
-    0x8A, 0xF2, 0x60, 0x44, 0xFA, 0x03, 0x56, 0x04, 0x5C, 0xF3, 0xC3, 0x54, 0x66, 0x03, 0xCE, 0x4A,
-    0xAF, 0xC5, 0x88, 0x8A, 0x38, 0x81, 0x70, 0x8C, 0xC6, 0x60, 0xE3, 0xF5, 0xE0, 0xED, 0xA1, 0x2A,
-    0xCB, 0xA9, 0x8A, 0x7C, 0xE0, 0x6F, 0x49, 0xD0, 0x45, 0xAB, 0xBB, 0x6D, 0xFA, 0x6E, 0xA7, 0x2B,
-    0x94, 0x06, 0x88, 0xD6, 0x9B, 0x86, 0xEF, 0x96, 0xB0, 0x3B, 0x50, 0x48, 0xEA, 0xE5, 0xBD, 0x6D,
-    0x0D, 0xFC, 0xD6, 0x96, 0xB1, 0xB3, 0x65, 0xE4, 0x78, 0x37, 0x4D, 0xC6, 0x88, 0x6E, 0xA1, 0xD7,
-    0x9A, 0x75, 0x03, 0x56, 0xB1, 0xEF, 0x8E, 0x0E, 0xC8, 0xFD, 0xA8, 0xD2, 0x7B, 0xB6, 0x31, 0x75,
-    0xD6, 0xDA, 0x6A, 0x6E, 0x8B, 0x82, 0x18, 0xC0, 0x33, 0xA7, 0x47, 0xEF, 0x32, 0xFF, 0xD4, 0x25,
-    0xFE, 0x6B, 0xA7, 0x7E, 0xF7, 0x06, 0x26, 0x9D, 0x74, 0x61, 0x6D, 0xBA, 0x79, 0x69, 0x83, 0xE8,
-    0xE8, 0x61, 0x33, 0x27, 0x5B, 0xC3, 0x62, 0x4B, 0x09, 0x0E, 0x4A, 0x14, 0xD7, 0x3F, 0xDA, 0x8F,
-    0xC3, 0x67, 0x76, 0x4E, 0xF4, 0x81, 0xF9, 0x67, 0x7D, 0xDA, 0x2D, 0x6F, 0xA8, 0x43, 0x9F, 0x67,
-    0xF1, 0x61, 0xFA, 0xBC, 0x0B, 0x95, 0x61, 0x54, 0xD3, 0x89, 0xCB, 0x49, 0xE8, 0xD4, 0x02, 0xF9,
-    0x44, 0x7A, 0x4B, 0x45, 0xFA, 0x1B, 0xD8, 0x02, 0x07, 0x82, 0x79, 0x23, 0x4B, 0x93, 0xFA, 0xEA,
-    0x2D, 0x36, 0x7E, 0x67, 0xB5, 0xBA, 0x39, 0xE3, 0x12, 0x7F, 0xCF, 0x9D, 0xFA, 0x03, 0x78, 0x35,
-    0x3F, 0xE3, 0xCB, 0x71, 0x72, 0x71, 0x1A, 0x57, 0xDC, 0x3C, 0x5F, 0xFF, 0xE8, 0x30, 0x48, 0xC7,
-    0xC1, 0x96, 0x12, 0x66, 0x00, 0xA2, 0x2E, 0xD4, 0xBF, 0x79, 0x60, 0x0D, 0x1B, 0x78, 0x08, 0x0F,
-    0x62, 0x29, 0xF5, 0x6F, 0x7C, 0x75, 0x5A, 0xCC, 0x2B, 0x85, 0x26, 0xC6, 0x6E, 0x06, 0x13, 0x67,
-    0x6E, 0x8A, 0xEE, 0x52, 0x40, 0x5C, 0x8D, 0x07, 0x3A, 0x38, 0x2D, 0xF0, 0x07, 0xAB, 0x96, 0x28,
-    0x45, 0x78, 0x2F, 0x1E, 0xBC, 0x3D, 0x86, 0xED, 0x8D, 0x6D, 0xFD, 0x6D, 0x0E, 0x0F, 0x98, 0x87,
-    0x5F, 0x52, 0x9F, 0x49, 0x7B, 0xEA, 0xA3, 0x25, 0xB6, 0x5E, 0xED, 0x1B, 0x97, 0x5F, 0xF5, 0xBE,
-    0xF9, 0x58, 0x47, 0x43, 0xD2, 0x5C, 0x31, 0x71, 0x9B, 0x34, 0xE6, 0x4A, 0xD2, 0x40, 0xDE, 0x49,
-    0xEB, 0x34, 0xC8, 0xFA, 0xCA, 0x9D, 0xB4, 0x49, 0xEB, 0xE1, 0x4A, 0xD2, 0xE6, 0x7F, 0x75, 0x26,
-    0xA2, 0x0E, 0xF4, 0x39, 0xE8, 0xA2, 0xC9, 0xAB, 0xCD, 0x72, 0xB3, 0xE0, 0xB6, 0x10, 0xDC, 0xF4,
-    0x34, 0x96, 0xFE, 0xC5, 0x25, 0xA8, 0x98, 0x41, 0xC1, 0xC5, 0x51, 0xE5, 0xB0, 0x93, 0xE2, 0x26,
-    0x5A, 0x89, 0xAC, 0xD5, 0xA4, 0x77, 0x38, 0x41, 0x4B, 0xF9, 0x94, 0xFA, 0xCC, 0xFF, 0x4E, 0xA0,
-    0xD3, 0x3B, 0x8E, 0xB0, 0x71, 0x97, 0xDB, 0xB3, 0xBD, 0xCA, 0x95, 0xF8, 0x42, 0xD6, 0x36, 0xF9,
-    0xBA, 0xA5, 0x3A, 0x56, 0xE8, 0x08, 0xCB, 0x42, 0x17, 0x89, 0x70, 0xA2, 0x54, 0x24, 0x40, 0x09,
-    0x31, 0x02, 0x25, 0xA5, 0x0E, 0xBE, 0x86, 0x8D, 0x1B, 0x6B, 0x65, 0x68, 0x04, 0x0D, 0x1A, 0xFF,
-    0x0F, 0xC6, 0x5D, 0x83, 0xD2, 0xDB, 0x5D, 0x4B, 0x7F, 0x1D, 0x6C, 0x15, 0x4D, 0x25, 0x71, 0xF6,
-    0x33, 0xDB, 0xE1, 0x5D, 0x89, 0x72, 0x43, 0xEA, 0x84, 0xF7, 0xA0, 0x11, 0x4B, 0x1F, 0xEE, 0xF1,
-    0x88, 0x76, 0xC3, 0x14, 0xBB, 0xE8, 0x67, 0x5C, 0xDB, 0x6F, 0x4F, 0x56, 0x5B, 0x2E, 0x08, 0x80,
-    0xB1, 0xDF, 0x85, 0x83, 0x8F, 0xF0, 0xDF, 0x4C, 0xD6, 0xC3, 0x05, 0x6A, 0xAE, 0x95, 0x06, 0xE5,
-    0x8C, 0x20, 0xAA, 0xF5, 0xAF, 0x7A, 0xFD, 0x96, 0xF5, 0x88, 0x4C, 0x2A, 0x05, 0x4B, 0xC0, 0xBA,
-    0xBE, 0xB0, 0xDC, 0x8A, 0xB8, 0x5F, 0x53, 0x9C, 0xF5, 0x54, 0xC8, 0x19, 0x25, 0xCB, 0xE0, 0xA3,
-    0x9A, 0xA2, 0xA7, 0x18, 0xA1, 0x93, 0xC4, 0x17, 0xB6, 0x5A, 0xF8, 0x0A, 0xDA, 0xB1, 0x35, 0x84,
-    0x69, 0x20, 0xB4, 0x88, 0x76, 0x2D, 0xD6, 0xCF, 0x0C, 0xAB, 0xD8, 0x6A, 0x6A, 0xC1, 0xB6, 0xBB,
-    0xEC, 0x65, 0xEA, 0x8F, 0x3D, 0x4F, 0x0B, 0x3A, 0x50, 0x0A, 0x4E, 0xFA, 0x50, 0xD9, 0x5D, 0xCD,
-    0x5E, 0x1B, 0xCA, 0xB3, 0xEF, 0x43, 0x9D, 0xE2, 0xB9, 0x7E, 0x8E, 0xEB, 0xB3, 0x52, 0x87, 0xFB,
-    0x3C, 0xAA, 0xDF, 0x03, 0x65, 0xE6, 0x9B, 0x23, 0x76, 0x22, 0x7A, 0x04, 0x69, 0x70, 0xE4, 0x9F,
-    0x00, 0x9A, 0x7C, 0xB1, 0x28, 0x18, 0x36, 0x82, 0x98, 0x93, 0x21, 0x82, 0xD2, 0x5F, 0x5D, 0xDD,
-    0x04, 0x54, 0x01, 0xB7, 0x29, 0xB4, 0x08, 0xEC, 0x3A, 0x2D, 0xAA, 0xE4, 0x2D, 0x6C, 0x80, 0x6D,
-    0x7C, 0x80, 0xA0, 0x0D, 0xDA, 0x48, 0x5C, 0xCB, 0x52, 0x9C, 0xE5, 0x18, 0x62, 0x03, 0xF0, 0xAD,
-    0xE6, 0x24, 0x62, 0x77, 0x05, 0x9C, 0xA4, 0x9F, 0x1E, 0x10, 0x27, 0x6D, 0x4B, 0xA1, 0x11, 0x64,
-    0x72, 0xC5, 0xBE, 0x84, 0xEF, 0x9F, 0xE4, 0x8A, 0x48, 0x8D, 0xA6, 0x56, 0xDC, 0x2E, 0x5E, 0xE4,
-    0x82, 0xDE, 0x74, 0xB3, 0x09, 0x5E, 0x40, 0x66, 0xAB, 0xB4, 0xF0, 0x10, 0x43, 0xCF, 0x31, 0x88,
-    0x09, 0x18, 0x8F, 0x11, 0x56, 0xC1, 0xCB, 0x4D, 0x05, 0xCD, 0x99, 0x8A, 0xFB, 0xDB, 0xA7, 0x88,
-    0x52, 0xF3, 0x27, 0x44, 0x86, 0xB9, 0x27, 0x10, 0xC0, 0x34, 0xC5, 0xCB, 0x2F, 0xF8, 0xAF, 0x79,
-    0x0A, 0x4F, 0x36, 0xF7, 0x09, 0x42, 0x15, 0x68, 0xC9, 0xD4, 0x4C, 0x3A, 0x40, 0xC8, 0x62, 0xD3,
-    0xA4, 0xB5, 0xA5, 0x67, 0xC4, 0x2C, 0x6D, 0x6B, 0x5F, 0xB4, 0xEC, 0xAE, 0x6E, 0x4C, 0x89, 0x8A,
-    0x14, 0xD0, 0x3B, 0x2C, 0xC3, 0xC0, 0x27, 0xAC, 0x93, 0xDD, 0xC0, 0x11, 0xB3, 0x21, 0xA9, 0x3A,
-    0x67, 0x6C, 0x11, 0x3D, 0x75, 0xC6, 0x94, 0xD1, 0x63, 0x67, 0xB6, 0xAB, 0xE4, 0x6B, 0x67, 0x2E,
-    0x57, 0xE9, 0xDF, 0x9C, 0xF9, 0xA0, 0x49, 0x77, 0x20, 0xDB, 0xFC, 0xAE, 0x33, 0xEF, 0xB7, 0xFA,
-    0x9A, 0x33, 0xD7, 0x3A, 0xFD, 0x3A, 0x24, 0x80, 0xD0, 0x99, 0xF7, 0xDC, 0x08, 0x79, 0x75, 0x1C,
-    0x20, 0x4B, 0x24, 0x05, 0x90, 0xB6, 0xA7, 0x34, 0x1D, 0xA5, 0x6E, 0x29, 0xF3, 0x06, 0xB2, 0x23,
-    0x35, 0x06, 0xAF, 0xE6, 0xA8, 0x11, 0x07, 0xA5, 0x28, 0x29, 0x80, 0xC9, 0xC6, 0xB0, 0xE2, 0x65,
-    0xB6, 0x79, 0x93, 0x9D, 0x5C, 0x63, 0xAF, 0xEF, 0x79, 0xE9, 0xF4, 0x2E, 0x7B, 0xDB, 0x61, 0x67,
-    0x98, 0x53, 0x99, 0x7D, 0x03, 0x91, 0x60, 0xBE, 0x65, 0x44, 0xC1, 0x99, 0x97, 0x4A, 0x84, 0xA1,
-    0x20, 0x0B, 0x0F, 0x99, 0x9E, 0x64, 0x2B, 0xC4, 0x34, 0x32, 0x37, 0xA6, 0x70, 0x80, 0xA6, 0x9E,
-    0xF8, 0x82, 0xA8, 0x00, 0x1D, 0x8D, 0x47, 0x06, 0x05, 0x94, 0x0E, 0xE7, 0x87, 0xE7, 0x00, 0x8B,
-    0xB0, 0x7B, 0x1C, 0x25, 0x43, 0x9D, 0x50, 0x1F, 0x21, 0x82, 0xB6, 0xA1, 0x9F, 0xC4, 0x7F, 0xE9,
-    0x85, 0x34, 0xD3, 0xD4, 0x32, 0x16, 0xE2, 0x64, 0x4F, 0x05, 0xB0, 0x82, 0xD9, 0x1F, 0xF2, 0x61,
-    0x31, 0x01, 0x2F, 0x60, 0x08, 0x94, 0x03, 0xC6, 0x16, 0xC0, 0x95, 0x02, 0x02, 0x51, 0x99, 0x4E,
-    0xDE, 0x21, 0x70, 0x09, 0xAA, 0x76, 0xF7, 0xC6, 0xB1, 0x46, 0xFD, 0xBF, 0xAF, 0x4E, 0x70, 0xFF,
-    0x15, 0x2F, 0x6C, 0x45, 0xF6, 0x32, 0xC5, 0xCC, 0x11, 0x30, 0xE3, 0xC2, 0xBC, 0xB0, 0xEA, 0x5B,
-    0x53, 0x6D, 0xC1, 0x0D, 0xA0, 0x6B, 0x87, 0x99, 0x67, 0xCC, 0x13, 0x93, 0xC3, 0x02, 0xFB, 0x15,
-    0xF6, 0x9D, 0x76, 0x86, 0xDD, 0x51, 0x4D, 0xE2, 0x13, 0xF4, 0x6E, 0x05, 0xCD, 0x2B, 0x4C, 0x0D,
-    0x5A, 0x63, 0x07, 0x29, 0x5B, 0xC4, 0x84, 0xFB, 0x48, 0xF6, 0x41, 0x1F, 0x94, 0x61, 0x85, 0xCB,
-    0x35, 0x19, 0x09, 0x3C, 0x60, 0xCF, 0xD4, 0x8B, 0x35, 0xAE, 0x12, 0xF3, 0x90, 0x46, 0x0B, 0xE5,
-    0x8E, 0x24, 0x02, 0x31, 0xA7, 0x58, 0x38, 0x50, 0x13, 0x60, 0x31, 0x6B, 0x6F, 0xE2, 0x6E, 0x7F,
-    0x2D, 0xF1, 0x51, 0x71, 0xAB, 0xC9, 0x49, 0x51, 0x4E, 0x0B, 0x0E, 0x0B, 0x00, 0x0B, 0x62, 0x07,
-    0x11, 0x38, 0xE8, 0xFF, 0x5A, 0xC0, 0x65, 0xF3, 0xFA, 0xD0, 0xFE, 0xF4, 0x7D, 0x84, 0x11, 0x01,
-    0x50, 0xA9, 0x35, 0x73, 0xF0, 0x7C, 0xBC, 0xE4, 0x4B, 0xD2, 0x02, 0x1A, 0xCF, 0x71, 0x35, 0x34,
-    0xD4, 0x96, 0x64, 0xBF, 0x09, 0x5C, 0x4E, 0x31, 0xA9, 0x03, 0x2B, 0x15, 0xDC, 0x27, 0xCE, 0xD5,
-    0x60, 0xA8, 0xA4, 0xCA, 0xC1, 0x32, 0x1E, 0x09, 0x2C, 0x68, 0x54, 0x34, 0x80, 0x77, 0x2C, 0xC7,
-    0x88, 0x50, 0x41, 0xD6, 0xE4, 0xDF, 0x60, 0x57, 0xD7, 0x99, 0x68, 0xDD, 0xA3, 0x6A, 0x1F, 0x50,
-    0x83, 0x72, 0x78, 0x40, 0x5B, 0xA4, 0xE1, 0x30, 0xA1, 0x50, 0x42, 0xD8, 0xE6, 0x5C, 0xDA, 0x82,
-    0x16, 0xE0, 0x12, 0x64, 0xAB, 0x96, 0x70, 0x4A, 0x58, 0xAF, 0xE2, 0xC9, 0x01, 0x32, 0x44, 0x52,
-    0xB1, 0xBC, 0x01, 0x45, 0x05, 0x71, 0xCA, 0xDA, 0xE4, 0x69, 0x9B, 0x30, 0xE5, 0x4E, 0xBF, 0x42,
-    0x1A, 0x89, 0xCC, 0x24, 0xFD, 0x1C, 0xD4, 0x16, 0xB3, 0xCD, 0x76, 0x7A, 0x80, 0x71, 0xEC, 0x00,
-    0x3F, 0x48, 0x0F, 0x90, 0x55, 0x7C, 0x8A, 0xE4, 0x82, 0xF7, 0xAB, 0x03, 0xD6, 0xB0, 0x1C, 0x4C,
-    0x31, 0xE2, 0xBE, 0x18, 0xAD, 0xF2, 0x86, 0xEC, 0x10, 0x1E, 0xC2, 0x94, 0x16, 0xF6, 0x36, 0xE4,
-    0x4F, 0xD6, 0xC9, 0x21, 0x08, 0xC0, 0x41, 0x7C, 0x81, 0x38, 0x9E, 0x93, 0x4C, 0xE8, 0x2E, 0x90,
-    0xCA, 0x06, 0x44, 0x05, 0xFE, 0xA5, 0x5B, 0x62, 0x70, 0x0D, 0x4C, 0x67, 0x8E, 0xC0, 0xAC, 0xC2,
-    0x5F, 0x23, 0x8E, 0x3F, 0x10, 0xF2, 0xD8, 0x4D, 0x79, 0x5B, 0x1C, 0x0E, 0x43, 0xCA, 0x69, 0xC9,
-    0x19, 0x9F, 0xC9, 0x5B, 0xFB, 0x67, 0x87, 0x40, 0x7A, 0x1D, 0xC0, 0xE6, 0x11, 0x4F, 0x54, 0x21,
-    0x81, 0x5D, 0x37, 0xDC, 0x53, 0x3B, 0x80, 0x3D, 0x63, 0x1E, 0xAA, 0x46, 0x3E, 0x28, 0xCF, 0x2C,
-    0x55, 0xCD, 0x7A, 0xDC, 0xB2, 0x06, 0xA8, 0x63, 0xE9, 0x99, 0xA1, 0xFA, 0xF3, 0xEC, 0xEA, 0x11,
-    0x75, 0x1B, 0xBA, 0x97, 0x81, 0xC8, 0x2C, 0x39, 0x73, 0xDA, 0xE1, 0x04, 0x82, 0xE7, 0x2D, 0x87,
-    0x05, 0x1B, 0xA7, 0xFB, 0x4C, 0x40, 0x72, 0xD2, 0x4A, 0x49, 0xEA, 0x44, 0x9A, 0x38, 0x39, 0xA3,
-    0xBC, 0x14, 0x46, 0xC6, 0x61, 0xA3, 0xC3, 0x2F, 0xF5, 0x93, 0xD5, 0x6A, 0x3F, 0x26, 0x82, 0xF0,
-    0x4E, 0xBE, 0xEA, 0x44, 0xDF, 0x0B, 0xAC, 0xBB, 0xFA, 0x2D, 0x4F, 0x5F, 0xD6, 0x27, 0x36, 0x2D,
-    0xAF, 0xB8, 0xE7, 0xB1, 0xC4, 0x72, 0xE0, 0x11, 0xC5, 0x74, 0x3E, 0xA3, 0x8F, 0xA9, 0x01, 0x23,
-    0x1A, 0x7C, 0xF1, 0xF3, 0x04, 0xDF, 0x33, 0x52, 0x77, 0xF3, 0x23, 0x15, 0x57, 0xD3, 0xF9, 0x8D,
-    0x64, 0x62, 0x01, 0xAA, 0x34, 0x17, 0x77, 0xC7, 0x40, 0x38, 0x0D, 0x6E, 0xDD, 0xF3, 0xDC, 0xAC,
-    0x4D, 0x6B, 0x24, 0xE2, 0x31, 0x86, 0xAD, 0x23, 0xF8, 0x47, 0xB5, 0x70, 0x9C, 0xCC, 0xA0, 0x36,
-    0x91, 0x16, 0xA9, 0x33, 0x17, 0x2F, 0x82, 0x5C, 0xF8, 0x6A, 0x73, 0xB5, 0x2A, 0x2F, 0x16, 0xCC,
-    0xED, 0x61, 0x44, 0x6A, 0xDC, 0x32, 0x5D, 0x9B, 0x68, 0x98, 0x24, 0xE4, 0x4C, 0x78, 0xA3, 0x1B,
-    0x79, 0xBB, 0x4E, 0xB2, 0xB7, 0x7D, 0x97, 0x32, 0x65, 0xF0, 0xB7, 0xE1, 0x0C, 0x69, 0x87, 0x34,
-    0xB0, 0xF3, 0x65, 0x86, 0xDF, 0xA6, 0x33, 0xF2, 0xFC, 0x71, 0x97, 0xF8, 0x6B, 0x9D, 0xDA, 0x9A,
-    0x52, 0xAD, 0xF2, 0x88, 0x72, 0x1D, 0x74, 0xDE, 0xFA, 0x8A, 0x80, 0xEC, 0xFF, 0x6D, 0xD8, 0x4F,
-    0x8F, 0xD1, 0x9C, 0x2F, 0x59, 0xE2, 0xA9, 0xE0, 0x37, 0x9F, 0xF1, 0x1D, 0xEB, 0xB0, 0xAE, 0xF1,
-    0xD5, 0x98, 0x8E, 0x01, 0x02, 0x04, 0xB1, 0x11, 0xE1, 0x5E, 0x92, 0xD1, 0x32, 0x1F, 0x2E, 0x09,
-    0x50, 0x9A, 0xFA, 0xF9, 0xBD, 0x46, 0x40, 0x94, 0x2E, 0x3E, 0x5C, 0x62, 0xDD, 0x2A, 0x66, 0x12,
-    0x6F, 0x0F, 0x24, 0xC5, 0xB2, 0xFC, 0xE7, 0xCB, 0xC2, 0xEF, 0x0C, 0x89, 0x7F, 0x3C, 0x00, 0x94,
-    0x07, 0xBD, 0xB7, 0x3D, 0xE8, 0x26, 0x19, 0xCC, 0x3A, 0xD9, 0xD8, 0x2F, 0x7C, 0xA6, 0x9B, 0x58,
-    0xEA, 0xB0, 0x6E, 0xE2, 0xBF, 0x19, 0x96, 0xFE, 0xFE, 0xA0, 0x5E, 0xDA, 0x4F, 0xE8, 0xA7, 0x79,
-    0x82, 0x98, 0x66, 0x9D, 0x9E, 0x0E, 0x18, 0xA6, 0x24, 0x24, 0x94, 0x03, 0xF3, 0xC4, 0xBE, 0xF7,
-    0x7B, 0xD6, 0x8D, 0x02, 0x69, 0xAD, 0xC3, 0x7A, 0xB7, 0x94, 0x1C, 0xE9, 0x7A, 0xB2, 0x1C, 0x02,
-    0xE2, 0xA9, 0xF5, 0x4C, 0xC1, 0x22, 0xA0, 0x8A, 0x50, 0x5E, 0x19, 0x2F, 0x1C, 0xB1, 0x9A, 0xA3,
-    0x8B, 0x92, 0x43, 0xD1, 0xFB, 0x98, 0xF7, 0x93, 0x93, 0xAF, 0xB5, 0xCF, 0xA6, 0xB5, 0x3E, 0xC5,
-    0x5A, 0x77, 0xB0, 0x56, 0xF6, 0x14, 0xBB, 0x97, 0x11, 0xA2, 0xF9, 0x87, 0xB6, 0xE7, 0x09, 0x17,
-    0x0F, 0x72, 0x36, 0x02, 0x8D, 0x38, 0xDA, 0x17, 0xDE, 0x44, 0x66, 0x68, 0x7C, 0x23, 0x29, 0xF9,
-    0x9E, 0xE9, 0x7D, 0x9D, 0xBA, 0x7D, 0x5F, 0xF8, 0xEE, 0xC2, 0x63, 0x1C, 0x60, 0x51, 0x93, 0xC9,
-    0x36, 0xCA, 0x5F, 0xC7, 0x7D, 0xC5, 0x18, 0x92, 0x40, 0x93, 0xBE, 0xAE, 0x8F, 0x04, 0xE6, 0x27,
-    0xFF, 0xDD, 0x55, 0xFC, 0x8A, 0x94, 0x88, 0xC6, 0x95, 0xF3, 0x31, 0x15, 0xD2, 0xFA, 0xE3, 0x44,
-    0x32, 0x40, 0x90, 0x05, 0x94, 0x70, 0x53, 0xE4, 0xC5, 0xA0, 0x16, 0xEF, 0x93, 0x28, 0x7C, 0x00,
-    0x6C, 0xB2, 0x56, 0xC8, 0x89, 0x08, 0xFE, 0xC9, 0x8D, 0xDE, 0xEE, 0x10, 0x49, 0x4A, 0xD6, 0x93,
-    0x16, 0x25, 0x62, 0xD1, 0x96, 0x64, 0x10, 0xA5, 0x40, 0xA9, 0x2F, 0x4F, 0xFE, 0x9D, 0xD6, 0x3A,
-    0x26, 0xFE, 0x1C, 0xCF, 0xB7, 0x8D, 0xFF, 0x1C, 0x23, 0x78, 0xF9, 0x28, 0x04, 0x98, 0xFF, 0x25,
-    0x6E, 0x75, 0xE6, 0x00, 0xFB, 0x9E, 0x1C, 0x05, 0xB7, 0x12, 0x90, 0x29, 0xB7, 0xEE, 0x05, 0x6E,
-    0xD3, 0x98, 0x85, 0xD7, 0xDF, 0x66, 0xE3, 0xF8, 0x44, 0x65, 0x26, 0x48, 0x88, 0x87, 0x5A, 0x62,
-    0xA8, 0xCF, 0x1C, 0x7D, 0x10, 0xBE, 0x38, 0x5A, 0x29, 0xCB, 0x39, 0xC1, 0x1F, 0xF9, 0x8C, 0xEF,
-    0x58, 0x87, 0x58, 0x15, 0x09, 0x27, 0xDB, 0x8F, 0x75, 0x9F, 0x00, 0x7B, 0xF4, 0xF7, 0xC0, 0x1E,
-    0xE2, 0xD5, 0x79, 0xB4, 0x2D, 0xB7, 0x8E, 0xF4, 0xE5, 0x17, 0x8B, 0xA3, 0xC7, 0x07, 0xE2, 0xE8,
-    0xC8, 0x48, 0x1D, 0x93, 0xDE, 0xE7, 0xBD, 0xB7, 0x1D, 0x55, 0xD9, 0x71, 0xFF, 0x3B, 0xDE, 0x49,
-    0xE7, 0x93, 0x8D, 0x5C, 0x76, 0x3B, 0x70, 0x8A, 0xF2, 0x27, 0xE2, 0x8C, 0x3C, 0x2B, 0x9B, 0xFF,
-    0x41, 0x24, 0xE7, 0x83, 0xB9, 0x1C, 0xCF, 0x90, 0x70, 0x14, 0x7F, 0x58, 0x08, 0xD5, 0x17, 0x17,
-    0x34, 0xA4, 0x06, 0x17, 0xC2, 0x49, 0x94, 0xE3, 0xFF, 0x65, 0x96, 0xA4, 0xD3, 0xA3, 0xF6, 0x23,
-    0x7A, 0x3B, 0x3B, 0x5C, 0x80, 0x71, 0x9E, 0xBF, 0xF8, 0x5F, 0x07, 0xFF, 0xF3, 0xC8, 0x8F, 0x3C,
-    0xA1, 0x44, 0x96, 0xB4, 0x28, 0xC0, 0x11, 0x7A, 0xF2, 0x84, 0xEF, 0x2C, 0x25, 0x3D, 0x23, 0x73,
-    0xF6, 0x0B, 0xA4, 0x76, 0x40, 0xC5, 0xDC, 0x3F, 0x76, 0x89, 0xFF, 0xD4, 0xF1, 0x1F, 0x10, 0x12,
-    0x72, 0xA6, 0x02, 0x09, 0xD3, 0x35, 0x18, 0x18, 0x72, 0x31, 0x90, 0xFB, 0x16, 0xC3, 0xA5, 0x9D,
-    0x9C, 0xAF, 0x63, 0x4B, 0x8C, 0x1C, 0x28, 0x56, 0x34, 0x60, 0xCB, 0x5D, 0x8C, 0x72, 0xEA, 0x46,
-    0x26, 0x25, 0x34, 0x4A, 0x38, 0x94, 0x10, 0x27, 0xD9, 0x34, 0x49, 0x23, 0x42, 0x20, 0xA1, 0x47,
-    0x24, 0x09, 0xC8, 0x1D, 0x40, 0x36, 0xB1, 0x6F, 0x33, 0x5B, 0xC7, 0xA6, 0x9C, 0xB5, 0xDA, 0xA0,
-    0xFB, 0xB4, 0x35, 0x3A, 0xE2, 0x00, 0x77, 0x34, 0x38, 0x63, 0xD2, 0x0F, 0xF9, 0x75, 0xA4, 0x24,
-    0xCE, 0x65, 0xF7, 0xB0, 0x63, 0x3A, 0x97, 0xDE, 0xE3, 0x68, 0x2E, 0x7D, 0xD0, 0x60, 0xBC, 0x3E,
-    0x79, 0x04, 0xA0, 0x66, 0x92, 0xCF, 0x81, 0xDB, 0x28, 0x1C, 0xB2, 0x0B, 0xC9, 0x32, 0x0D, 0x39,
-    0x8A, 0xC8, 0xBC, 0x65, 0x56, 0xE2, 0x30, 0x32, 0x5C, 0xB4, 0x85, 0xEA, 0x09, 0x1D, 0x72, 0x20,
-    0x2F, 0x33, 0xCC, 0xC7, 0x79, 0x9A, 0x56, 0x6C, 0x21, 0x87, 0x5E, 0x80, 0xAD, 0xC4, 0xC9, 0xB1,
-    0x18, 0xE0, 0x0E, 0x89, 0x28, 0xAC, 0x58, 0x2F, 0x19, 0x60, 0x07, 0xF4, 0xC1, 0x9E, 0x65, 0xC2,
-    0xB3, 0x3E, 0x62, 0x37, 0xEB, 0x63, 0x49, 0x7D, 0xA8, 0x7D, 0x7D, 0x18, 0xEA, 0x43, 0xAF, 0x47,
-    0x4B, 0xDD, 0x5A, 0xF0, 0xDC, 0x2A, 0x9B, 0xB9, 0xD5, 0x26, 0x27, 0xA5, 0x39, 0xFD, 0xC0, 0x37,
-    0x1F, 0xB2, 0xC1, 0x7C, 0x3A, 0x8F, 0x72, 0xE6, 0xA2, 0xAF, 0x84, 0x7B, 0x91, 0x5D, 0x91, 0x5C,
-    0x4D, 0xFF, 0xB5, 0xA0, 0x13, 0xF1, 0x24, 0x9B, 0xD0, 0x9C, 0xED, 0x09, 0xD5, 0xA8, 0xE7, 0xA2,
-    0x36, 0x3A, 0x12, 0x56, 0x38, 0x1F, 0x7E, 0x7B, 0xF5, 0xCC, 0x05, 0xA3, 0x82, 0xDD, 0x22, 0xA7,
-    0xC1, 0xFB, 0xED, 0x41, 0xFA, 0xFE, 0x96, 0x4B, 0x5E, 0xA3, 0x93, 0xC5, 0x4D, 0x75, 0xE7, 0x98,
-    0xCF, 0xDB, 0x7F, 0x94, 0xBA, 0x80, 0xBA, 0xED, 0x8E, 0x67, 0xD7, 0xF1, 0xC1, 0xAB, 0x57, 0xC2,
-    0x55, 0xF1, 0xAE, 0x15, 0x1B, 0x91, 0xB9, 0xC7, 0x87, 0xEB, 0x24, 0x61, 0x9A, 0x2D, 0x67, 0xFA,
-    0x21, 0x62, 0xE8, 0x96, 0xA4, 0x5D, 0xEF, 0x12, 0xC2, 0xF6, 0x6E, 0xFB, 0x0E, 0xB9, 0x80, 0xE4,
-    0x8C, 0xFF, 0x01, 0xCD, 0x5A, 0x3D, 0x8C, 0xDD, 0xC6, 0x11, 0x1E, 0x92, 0x7A, 0xA2, 0x61, 0x22,
-    0x59, 0x17, 0x56, 0x63, 0x03, 0x61, 0x1D, 0x07, 0x11, 0x9B, 0x94, 0xD6, 0x2D, 0x0D, 0x23, 0x48,
-    0xE1, 0xC2, 0x57, 0xE8, 0xE2, 0x42, 0x85, 0x9B, 0x34, 0xAE, 0xAE, 0x4D, 0xE1, 0x78, 0x29, 0x0B,
-    0x88, 0x8B, 0x14, 0x51, 0x9D, 0x34, 0x2A, 0x5C, 0x18, 0x4A, 0x71, 0x29, 0x52, 0xB8, 0x90, 0x1E,
-    0x29, 0xAB, 0x74, 0x43, 0x5B, 0x31, 0x52, 0xA4, 0x30, 0x03, 0xDB, 0x09, 0x20, 0x15, 0x26, 0x2C,
-    0xCA, 0xA2, 0x2C, 0x92, 0x9B, 0xEF, 0xDB, 0xE5, 0x7B, 0x77, 0xBA, 0xE8, 0x17, 0x7E, 0x8E, 0xEE,
-    0x1D, 0x67, 0xF8, 0x1E, 0xB9, 0x9C, 0x9D, 0x9D, 0x9D, 0xF9, 0x66, 0x76, 0x79, 0x69, 0xA1, 0x6B,
-    0xD3, 0xE8, 0x3A, 0x2D, 0x04, 0x9F, 0x17, 0x8A, 0xAC, 0xCA, 0x2A, 0xBD, 0xFF, 0x57, 0xFB, 0x3F,
-    0xD3, 0x98, 0xE6, 0x44, 0xCE, 0x16, 0xA2, 0x0A, 0x4F, 0xBB, 0x77, 0x24, 0xB6, 0xB6, 0x48, 0xAD,
-    0xCD, 0xF5, 0x54, 0x8A, 0x69, 0x02, 0x29, 0x2B, 0x11, 0x5B, 0xCC, 0x94, 0xEF, 0x7F, 0xE7, 0x75,
-    0xD3, 0x1E, 0xCF, 0x35, 0xDA, 0x2A, 0x50, 0x68, 0xAD, 0x48, 0xFA, 0xF7, 0x7D, 0x59, 0x0B, 0xF1,
-    0x9F, 0xD4, 0x9E, 0x97, 0xD2, 0x76, 0x81, 0xB5, 0x6D, 0x64, 0xFF, 0xD4, 0x44, 0xA3, 0x48, 0x3C,
-    0xEC, 0xD3, 0x99, 0x71, 0x47, 0x2C, 0x9E, 0x27, 0xED, 0x4D, 0x17, 0xF3, 0x83, 0xF7, 0x92, 0x1E,
-    0x8F, 0xB7, 0xE8, 0xEB, 0xFA, 0xC5, 0x0F, 0x70, 0x7F, 0x58, 0xD1, 0x33, 0x12, 0xE6, 0x7A, 0xF7,
-    0x9F, 0x35, 0xFA, 0x6E, 0xD0, 0x77, 0xA1, 0x1A, 0x93, 0xA7, 0x55, 0x5A, 0xA4, 0x85, 0xAA, 0x48,
-    0xAA, 0xD6, 0x85, 0x9A, 0x6C, 0x9E, 0x59, 0x5B, 0xB1, 0xCD, 0x4F, 0x16, 0x91, 0xB3, 0x44, 0x59,
-    0x60, 0x08, 0xBA, 0x0A, 0xAD, 0x64, 0xD4, 0x43, 0xB5, 0xE8, 0x24, 0xE9, 0x54, 0x27, 0xD1, 0x80,
-    0x6E, 0xC2, 0x31, 0xAB, 0x31, 0x36, 0x8D, 0x81, 0x95, 0x1C, 0xA9, 0xC6, 0x80, 0x44, 0x53, 0x5D,
-    0xA8, 0xEE, 0x59, 0xF0, 0xE6, 0x9D, 0x6D, 0xA8, 0xD5, 0x89, 0x84, 0x7B, 0xD3, 0x05, 0x7F, 0x2D,
-    0x42, 0x07, 0xFE, 0xDA, 0x01, 0xB6, 0xDC, 0xFF, 0xBC, 0xE5, 0xAC, 0x70, 0xCF, 0x85, 0x13, 0x78,
-    0xB2, 0x4F, 0xED, 0xA8, 0x3F, 0x1B, 0x8C, 0x1C, 0xD3, 0x85, 0xE8, 0x46, 0x14, 0xCD, 0xD8, 0x66,
-    0x9F, 0x0F, 0x3A, 0x18, 0x8D, 0x2C, 0x75, 0xBE, 0xD4, 0xCD, 0xA4, 0xEC, 0x10, 0xDA, 0x4E, 0xB2,
-    0x41, 0xC2, 0x49, 0x64, 0xDA, 0x96, 0xE9, 0x9D, 0x37, 0x46, 0x63, 0xFB, 0xCC, 0xD6, 0x72, 0x5A,
-    0xB2, 0xA0, 0x33, 0xE7, 0x06, 0x1C, 0x27, 0x83, 0x6E, 0x36, 0x76, 0x68, 0x61, 0x32, 0xC9, 0x26,
-    0xCE, 0xD0, 0x28, 0x31, 0x46, 0x06, 0xDD, 0x2E, 0x4B, 0x52, 0xEC, 0xF6, 0x99, 0xA4, 0x81, 0x1D,
-    0x92, 0xE2, 0x54, 0xDC, 0x3C, 0x1F, 0x55, 0x2F, 0xAB, 0x4A, 0xC2, 0xFA, 0xB7, 0x2A, 0x97, 0xA0,
-    0xF9, 0x5B, 0x2A, 0x12, 0xB4, 0xE4, 0xD2, 0xFA, 0xEF, 0xFE, 0xFA, 0xCB, 0x98, 0xC6, 0xB0, 0x7E,
-    0x39, 0xAE, 0x25, 0xAA, 0xB2, 0x08, 0xCF, 0x56, 0x2A, 0x2F, 0xFB, 0x54, 0x62, 0xB8, 0xC5, 0xEF,
-    0x24, 0x18, 0x25, 0x44, 0x67, 0xFA, 0x7A, 0x09, 0xAB, 0x1D, 0xB7, 0x23, 0xBB, 0x9F, 0xE7, 0x3C,
-    0xB1, 0x79, 0x6A, 0xEB, 0x1F, 0xBF, 0xD6, 0x48, 0xD4, 0x26, 0xB6, 0xD5, 0x37, 0x5A, 0x1D, 0xB5,
-    0x3A, 0x69, 0xB5, 0x6D, 0xD3, 0x5B, 0x6D, 0x00, 0xDB, 0x3E, 0x27, 0xB9, 0x2C, 0x83, 0x3E, 0xB0,
-    0xD1, 0x18, 0x8D, 0xAA, 0x57, 0x7D, 0xD6, 0xEA, 0xB6, 0xAC, 0xCA, 0x2B, 0x56, 0x48, 0xFC, 0xAE,
-    0x7A, 0xDD, 0xF2, 0x1E, 0xDB, 0xB0, 0x2D, 0x9F, 0x29, 0xAD, 0xED, 0xEC, 0x4C, 0x27, 0x76, 0xDE,
-    0xE0, 0x3C, 0x1C, 0xA2, 0x60, 0xFB, 0xA5, 0x8B, 0xF0, 0xC9, 0xF9, 0x78, 0x84, 0x55, 0xCE, 0xD9,
-    0x1A, 0x56, 0x89, 0x6C, 0x0F, 0xAB, 0x44, 0xF5, 0x65, 0x58, 0x25, 0xAA, 0x4F, 0xC1, 0x2A, 0xE0,
-    0xB0, 0x4A, 0x54, 0x5F, 0x82, 0x55, 0x22, 0xD8, 0x9F, 0xBC, 0x86, 0x55, 0xA2, 0x4F, 0x5B, 0x58,
-    0x25, 0xAA, 0x7B, 0x58, 0x25, 0xAA, 0xDF, 0xA6, 0x55, 0xEA, 0x2D, 0x58, 0xE5, 0xD5, 0x3A, 0x7D,
-    0x13, 0x56, 0x91, 0x87, 0x5B, 0x05, 0x0E, 0x65, 0xA7, 0x15, 0xE1, 0x67, 0x3C, 0x49, 0x66, 0x2B,
-    0xB3, 0xD7, 0x5C, 0x8E, 0xDA, 0x21, 0xE4, 0xB1, 0x8C, 0x61, 0xA2, 0x3A, 0xB5, 0x45, 0xF0, 0x81,
-    0x7F, 0x0A, 0x93, 0x74, 0x98, 0x2E, 0x96, 0xD7, 0xDF, 0x5F, 0x99, 0x60, 0x67, 0xF7, 0xB3, 0xED,
-    0xFB, 0xB5, 0xE1, 0xC7, 0x1E, 0x30, 0xD5, 0x71, 0xD7, 0x13, 0x44, 0xFF, 0x48, 0xC1, 0xD1, 0x1A,
-    0x49, 0x2B, 0x81, 0xD3, 0x4D, 0x12, 0xF7, 0x92, 0x36, 0x50, 0xAB, 0xF5, 0x07, 0x9A, 0x69, 0x5B,
-    0x65, 0x7B, 0xCD, 0xB1, 0x18, 0xFE, 0xDE, 0x84, 0x65, 0x15, 0x21, 0xAE, 0xF7, 0x38, 0x8B, 0x38,
-    0xB6, 0x76, 0xA9, 0x5C, 0xE6, 0x8D, 0xBA, 0x03, 0xB7, 0x17, 0xD5, 0x23, 0x8E, 0xC4, 0xE4, 0x70,
-    0x45, 0xC4, 0x55, 0x3C, 0xD8, 0x22, 0x79, 0x0C, 0x52, 0x83, 0xAD, 0xD2, 0xC1, 0xDE, 0x32, 0x73,
-    0x38, 0xDF, 0x1E, 0x6C, 0xF9, 0xE9, 0x60, 0x7F, 0x79, 0x00, 0x66, 0x0E, 0x11, 0x3F, 0x80, 0x8F,
-    0x29, 0x01, 0x65, 0x76, 0x7C, 0x47, 0xDB, 0x7E, 0x8B, 0x64, 0xEE, 0x43, 0xBC, 0x9E, 0x81, 0x14,
-    0x08, 0xD3, 0xBE, 0x25, 0xC7, 0x3E, 0xDC, 0x12, 0x79, 0x5C, 0xFA, 0xCD, 0x4F, 0x17, 0xE2, 0x81,
-    0x51, 0x57, 0x0B, 0xC1, 0xCC, 0x36, 0x40, 0x88, 0xE1, 0xD7, 0x83, 0xE9, 0x4D, 0x2D, 0x2F, 0x41,
-    0x1B, 0x04, 0x2E, 0x4C, 0x29, 0x99, 0x91, 0x67, 0x34, 0x26, 0xF4, 0x7E, 0x87, 0x30, 0x56, 0x15,
-    0x2C, 0xF5, 0xE7, 0x56, 0x87, 0xDD, 0x16, 0x8E, 0xA0, 0xC3, 0x17, 0xFD, 0xAB, 0x56, 0xD9, 0x26,
-    0x86, 0xF9, 0x9E, 0xC3, 0xD4, 0x1E, 0x93, 0x0C, 0x0E, 0x08, 0x57, 0xCF, 0xB3, 0xD6, 0x54, 0x74,
-    0x7F, 0xEF, 0xEA, 0xAF, 0x4E, 0xA4, 0x55, 0x48, 0xF0, 0x9E, 0x6B, 0x83, 0xB6, 0x7C, 0x46, 0xDE,
-    0x11, 0x71, 0x50, 0x10, 0x0E, 0xA2, 0x26, 0x4E, 0x8B, 0x9E, 0x24, 0x69, 0xE4, 0xE7, 0x4B, 0x4E,
-    0xA9, 0x2C, 0x39, 0xAB, 0xE0, 0x86, 0x78, 0x23, 0x74, 0xBD, 0x65, 0x38, 0x84, 0x17, 0x64, 0x19,
-    0x75, 0xAA, 0x95, 0x65, 0x02, 0x79, 0xB2, 0x54, 0x95, 0x6E, 0xE5, 0xAD, 0xAC, 0xB8, 0x0B, 0x5C,
-    0x35, 0xE1, 0x4D, 0xF0, 0x29, 0xBA, 0x06, 0x64, 0x1B, 0xD4, 0x39, 0xCC, 0x72, 0x97, 0xFD, 0xE5,
-    0x3B, 0x41, 0x43, 0x80, 0xB9, 0xAA, 0xC9, 0xB3, 0xCA, 0x75, 0x23, 0xE4, 0xAE, 0xF7, 0xB9, 0xFB,
-    0xB9, 0xFF, 0x59, 0x81, 0x95, 0x06, 0xB3, 0x0A, 0xB3, 0x0E, 0xB3, 0x12, 0xD4, 0xE2, 0xC5, 0x0B,
-    0x38, 0x45, 0xB7, 0x18, 0x0F, 0xCB, 0xE4, 0x1B, 0xA6, 0x0A, 0x28, 0x72, 0xA1, 0x14, 0x6A, 0xE2,
-    0xDA, 0x82, 0x18, 0x13, 0x5E, 0x76, 0x30, 0x38, 0x14, 0x8D, 0x80, 0x7C, 0x88, 0xA2, 0xA4, 0x95,
-    0x92, 0xB1, 0x50, 0x23, 0xC5, 0xE4, 0x50, 0x28, 0xE2, 0x49, 0x8B, 0x3B, 0xB9, 0xCF, 0x8B, 0x23,
-    0xC3, 0xDA, 0xC0, 0x57, 0x07, 0xD9, 0xDA, 0xAD, 0xA8, 0x96, 0xAA, 0xA8, 0x15, 0x32, 0x42, 0x25,
-    0xC9, 0x44, 0x9D, 0xD4, 0xC8, 0x2E, 0x16, 0xA6, 0xA0, 0x46, 0xEA, 0xCA, 0xF0, 0xEC, 0xF9, 0x5C,
-    0x5D, 0xEB, 0xD2, 0x66, 0x59, 0x7E, 0xDC, 0xEA, 0xA6, 0xB4, 0xAF, 0xD7, 0xB6, 0x79, 0xB1, 0xCF,
-    0xCE, 0xDE, 0xC5, 0x63, 0x26, 0xFA, 0x1C, 0x7C, 0x52, 0x7F, 0x6C, 0xA0, 0x49, 0x8A, 0x78, 0x89,
-    0x3A, 0xBD, 0xD7, 0x0B, 0x83, 0x13, 0x49, 0xA3, 0x26, 0x87, 0x59, 0x70, 0x5D, 0xE7, 0xE4, 0x2E,
-    0x81, 0xE2, 0x94, 0x75, 0x9E, 0x98, 0xB1, 0x8E, 0xCF, 0x6E, 0xEB, 0xD0, 0xB0, 0x9D, 0xEF, 0x37,
-    0x2E, 0x6B, 0x22, 0xA6, 0xA8, 0x0D, 0x30, 0x0E, 0xC4, 0x24, 0xEA, 0x28, 0x10, 0x7D, 0x6B, 0x97,
-    0xC9, 0xAA, 0x46, 0x42, 0xC3, 0x48, 0x47, 0xFF, 0xEC, 0x62, 0xDB, 0x49, 0x1F, 0x3C, 0x8A, 0xB9,
-    0x4B, 0xA6, 0x58, 0x75, 0x48, 0xB4, 0x5B, 0xF7, 0x12, 0xD9, 0xCA, 0xF1, 0xDA, 0xE1, 0x2F, 0xEF,
-    0x22, 0x9D, 0x90, 0xDF, 0x65, 0x6E, 0xC8, 0xFE, 0x43, 0x04, 0xD4, 0xD7, 0x28, 0xC8, 0x5C, 0xA5,
-    0xF0, 0xF2, 0x2C, 0xC5, 0x21, 0xEF, 0x32, 0xB6, 0x98, 0xD9, 0x21, 0xDE, 0x69, 0x77, 0x11, 0x82,
-    0x90, 0xD8, 0x20, 0x02, 0xF1, 0x06, 0x11, 0xCA, 0xF1, 0xB4, 0x63, 0xB8, 0x43, 0x67, 0xE8, 0x82,
-    0x6C, 0x15, 0xC3, 0x9C, 0x48, 0x0B, 0x93, 0x58, 0x3E, 0x42, 0x4D, 0x76, 0xDC, 0x50, 0x9D, 0xDA,
-    0xA9, 0xCB, 0x46, 0xDA, 0xE1, 0xD0, 0xE4, 0x94, 0x3B, 0x2D, 0x47, 0x45, 0xCF, 0x1D, 0x6F, 0xC9,
-    0x6A, 0xDD, 0x7B, 0xFA, 0x0F, 0xF6, 0x68, 0x5E, 0x99, 0x9C, 0x9A, 0x27, 0x8E, 0x8A, 0x9E, 0xDE,
-    0x73, 0x3A, 0xC5, 0xBE, 0x2C, 0xDD, 0xDF, 0x38, 0x97, 0xB8, 0x94, 0xB2, 0x5F, 0x66, 0xCF, 0xA3,
-    0xA1, 0x67, 0x9A, 0x3B, 0xF9, 0x1F, 0x0D, 0x6B, 0x9E, 0xE6, 0x9D, 0xDC, 0xFB, 0x79, 0xCA, 0x96,
-    0x7C, 0xDE, 0xCF, 0x38, 0xA3, 0x26, 0xBA, 0x41, 0x1D, 0xE2, 0x77, 0xA9, 0x43, 0x7C, 0xB5, 0x59,
-    0x6B, 0xF5, 0xD4, 0x74, 0xCB, 0x5C, 0x2B, 0xCC, 0xAD, 0x3B, 0x95, 0xFE, 0x64, 0xDD, 0x29, 0x9C,
-    0x88, 0x23, 0xBE, 0x32, 0x65, 0x25, 0xEC, 0x4E, 0xAA, 0x73, 0xA7, 0xB4, 0x4D, 0xBF, 0xBB, 0x78,
-    0x1E, 0x99, 0x2A, 0x65, 0x87, 0xA6, 0x72, 0xA7, 0xB2, 0x70, 0x27, 0x7B, 0xBD, 0x6C, 0x39, 0x5E,
-    0x27, 0x2A, 0xF2, 0x27, 0xAF, 0x12, 0x9E, 0x76, 0xD8, 0x04, 0xC2, 0xE3, 0x17, 0xA0, 0x0F, 0x1E,
-    0x40, 0x86, 0x71, 0x27, 0xD8, 0x27, 0x75, 0x8D, 0xF8, 0x39, 0x6E, 0xEF, 0x38, 0xA5, 0x8A, 0x80,
-    0x55, 0x79, 0x6C, 0xAF, 0x5B, 0xC2, 0xFD, 0x42, 0x9C, 0xF3, 0x11, 0xB7, 0x38, 0x18, 0x30, 0x5A,
-    0xCD, 0x38, 0x56, 0xAD, 0xBF, 0xD5, 0xEB, 0xBB, 0x6C, 0x47, 0x3C, 0x24, 0xDA, 0x05, 0xD0, 0xE1,
-    0xAB, 0xD2, 0xE9, 0xE3, 0xC6, 0x09, 0xD0, 0x76, 0xFE, 0x7C, 0x79, 0x8D, 0x11, 0x4E, 0x04, 0x6B,
-    0x97, 0x60, 0xB7, 0x62, 0xC9, 0x8D, 0xF9, 0x82, 0xB9, 0x1C, 0x00, 0x12, 0xFE, 0xA2, 0xC9, 0xD7,
-    0xEF, 0x92, 0xA2, 0x83, 0xC0, 0xBB, 0x3F, 0x35, 0x3C, 0x40, 0xB9, 0x59, 0xA3, 0xE9, 0x4C, 0xD7,
-    0x2F, 0xB2, 0xCD, 0x3E, 0x1D, 0xBE, 0xEF, 0xDB, 0xE4, 0x07, 0xE5, 0x38, 0x20, 0x23, 0x8C, 0x11,
-    0xC4, 0x08, 0x61, 0xD3, 0x3E, 0x7C, 0xFD, 0x20, 0xFD, 0x71, 0x05, 0x06, 0xF7, 0x63, 0x99, 0xA9,
-    0xBE, 0x19, 0x90, 0x58, 0x4A, 0x80, 0xD0, 0xE2, 0x07, 0xEB, 0x2F, 0xA9, 0x2E, 0xA3, 0xE6, 0xB3,
-    0x30, 0xA3, 0xC5, 0xAA, 0xE0, 0xED, 0x75, 0x90, 0xFE, 0x10, 0x7D, 0x61, 0x68, 0x74, 0xFD, 0x1E,
-    0x2B, 0x2B, 0x61, 0x99, 0xB8, 0xF0, 0x45, 0x70, 0xE7, 0x0F, 0x4C, 0x31, 0x82, 0xE7, 0x71, 0x8E,
-    0x88, 0xB5, 0xFC, 0xFC, 0x94, 0x2C, 0x4E, 0xD3, 0xA9, 0xD0, 0x1D, 0xAE, 0xF7, 0xB3, 0x27, 0x7C,
-    0x5F, 0x99, 0x3B, 0xAB, 0x39, 0x80, 0xB6, 0x37, 0x11, 0xA9, 0xC5, 0xFE, 0x1C, 0x28, 0xA6, 0xFC,
-    0x99, 0x02, 0xEB, 0x33, 0xF8, 0x13, 0x13, 0x64, 0x1F, 0x94, 0x73, 0x32, 0x6C, 0xCD, 0xAB, 0x3D,
-    0x8E, 0x93, 0x41, 0xBB, 0x5A, 0x19, 0x7C, 0xAF, 0x01, 0xC4, 0x76, 0x2A, 0x88, 0x3E, 0xA3, 0x83,
-    0xA0, 0xC2, 0xE1, 0x10, 0x0A, 0xD7, 0xB2, 0x03, 0x4B, 0x07, 0x2E, 0x72, 0x47, 0xB0, 0x78, 0x4A,
-    0x06, 0xC4, 0x91, 0xB1, 0x43, 0x64, 0xD7, 0x6C, 0xFA, 0xD9, 0xF4, 0x7E, 0x34, 0xF1, 0x2E, 0x9B,
-    0x24, 0xC3, 0xEA, 0x09, 0x3C, 0x3B, 0xED, 0xB1, 0x5E, 0xF5, 0xF2, 0x9C, 0xE4, 0xF3, 0xB3, 0xAF,
-    0xA8, 0x26, 0x63, 0xE1, 0xB7, 0x64, 0x24, 0x23, 0x34, 0x7B, 0x86, 0xCA, 0xF6, 0x1C, 0x93, 0x62,
-    0x3A, 0x94, 0x70, 0x06, 0x1D, 0x0D, 0x66, 0x22, 0xB3, 0x8E, 0x15, 0x64, 0x35, 0x98, 0x69, 0xC1,
-    0xDE, 0xEC, 0xC0, 0x5E, 0x1B, 0xC0, 0xCE, 0x4D, 0x60, 0xEF, 0x5A, 0xB0, 0xC2, 0x5E, 0x05, 0x33,
-    0xD7, 0xC0, 0xF4, 0x4D, 0xB0, 0xF4, 0x5B, 0xB0, 0xC4, 0x82, 0x45, 0x64, 0x21, 0x99, 0x38, 0x66,
-    0xC8, 0xF4, 0x40, 0x4F, 0xF0, 0xAB, 0x28, 0xB7, 0x3C, 0xC8, 0xF7, 0x6B, 0x8E, 0xA4, 0x3D, 0x54,
-    0x1B, 0x25, 0x6E, 0xFD, 0x57, 0x32, 0xDC, 0x3C, 0x30, 0x26, 0x80, 0xB4, 0x9E, 0xB8, 0x94, 0x22,
-    0xE2, 0x7A, 0xCA, 0xD0, 0x5C, 0xC8, 0x13, 0xB8, 0x60, 0x5A, 0x60, 0x18, 0xE4, 0x3D, 0x88, 0xFB,
-    0x36, 0xBE, 0x3D, 0x3C, 0x11, 0xCF, 0x7A, 0x39, 0x89, 0xFD, 0x37, 0x64, 0x46, 0x6B, 0x28, 0x2F,
-    0x88, 0x71, 0x77, 0xD8, 0xFD, 0x5C, 0x54, 0xEC, 0xF8, 0x64, 0xE8, 0x2C, 0x48, 0x7D, 0x5C, 0x41,
-    0xE8, 0x02, 0xE3, 0xDE, 0x0A, 0xE9, 0x48, 0x68, 0xCB, 0x90, 0xC0, 0xF3, 0x3E, 0x3B, 0xBA, 0xD4,
-    0x73, 0xD3, 0xE5, 0xF8, 0xA2, 0x74, 0x4D, 0x4E, 0x1C, 0x31, 0xDB, 0x3A, 0x4F, 0xC0, 0x32, 0x9E,
-    0xDB, 0x4D, 0x7B, 0x6E, 0xEF, 0x86, 0x76, 0x3E, 0x95, 0x0C, 0xAE, 0x00, 0xC8, 0x8F, 0x94, 0xB6,
-    0xAA, 0xB8, 0xC4, 0xC9, 0xFF, 0x84, 0x8E, 0x9B, 0xD5, 0xE4, 0x49, 0xF1, 0xE1, 0xA1, 0x9A, 0xE9,
-    0x08, 0xE8, 0xB9, 0x90, 0x10, 0xC5, 0x5C, 0x52, 0xE9, 0x3A, 0x6B, 0x54, 0x57, 0x22, 0x0C, 0xA1,
-    0x2A, 0xD5, 0x62, 0x76, 0x2F, 0x11, 0xE5, 0x00, 0x85, 0xA4, 0xC7, 0xE2, 0xB4, 0x41, 0x8B, 0x42,
-    0xD5, 0xCF, 0x4A, 0xB4, 0xB6, 0xF3, 0x79, 0x8E, 0xE0, 0x4E, 0xEF, 0xA4, 0x76, 0x87, 0x47, 0xA0,
-    0xDD, 0x08, 0x4A, 0x8E, 0x00, 0xF5, 0x05, 0xC4, 0x45, 0xDF, 0x72, 0x04, 0xC9, 0xBF, 0xA8, 0x6F,
-    0x7A, 0x85, 0x5C, 0xBF, 0x42, 0xBE, 0xE4, 0x08, 0x3E, 0x19, 0x38, 0x82, 0x2F, 0x3A, 0x8E, 0xE0,
-    0x6E, 0xC3, 0x11, 0xD8, 0x8A, 0x23, 0xB0, 0xF9, 0xA1, 0x11, 0x90, 0x17, 0x92, 0xDC, 0xE0, 0x08,
-    0xC2, 0xEA, 0x80, 0x5F, 0xB8, 0xB8, 0x23, 0x0C, 0x4B, 0x46, 0x47, 0x8E, 0x87, 0x75, 0xCD, 0xB1,
-    0x6A, 0x04, 0x3C, 0xC9, 0x6A, 0xB4, 0xC0, 0x42, 0xF0, 0x7B, 0x30, 0xE3, 0x58, 0x8D, 0xA1, 0xC0,
-    0xD4, 0xB6, 0xCA, 0xA6, 0x33, 0xB6, 0x60, 0x19, 0x48, 0xCD, 0x06, 0x66, 0x58, 0x06, 0x93, 0x03,
-    0xA5, 0x13, 0xE4, 0xA6, 0x11, 0xBF, 0xA3, 0xCA, 0x1D, 0x51, 0x8F, 0x59, 0x8B, 0xFC, 0xE9, 0x28,
-    0x14, 0x10, 0x7D, 0x94, 0xF3, 0x47, 0xB7, 0xB5, 0xBB, 0x5B, 0x03, 0xC3, 0xE3, 0x8E, 0x10, 0x7A,
-    0xFA, 0xA9, 0x28, 0x74, 0x29, 0xE6, 0x4E, 0xAC, 0xE2, 0xE6, 0x04, 0xD9, 0xDB, 0xFC, 0xB9, 0x5F,
-    0xAA, 0xFC, 0x9F, 0x67, 0xCB, 0xE5, 0x19, 0xB7, 0xA6, 0x75, 0x05, 0x2F, 0x81, 0x25, 0xEA, 0x0F,
-    0x26, 0x18, 0xC8, 0xCB, 0x5A, 0x4C, 0xA7, 0x6E, 0x20, 0xAA, 0xAC, 0x50, 0x66, 0xDB, 0x3C, 0x19,
-    0x98, 0xA3, 0x47, 0xCC, 0x6D, 0x68, 0x89, 0x42, 0xF6, 0x75, 0x08, 0x28, 0xBF, 0xE6, 0x9A, 0x9F,
-    0xCB, 0xA1, 0x94, 0x76, 0x56, 0x76, 0x95, 0xBF, 0x9C, 0x0B, 0x3C, 0x9A, 0xDD, 0x5B, 0x6C, 0x9D,
-    0x17, 0x57, 0xA8, 0x59, 0x5B, 0x1B, 0x57, 0xC7, 0x67, 0xBD, 0xA9, 0xD4, 0x60, 0xAA, 0x04, 0x14,
-    0xCF, 0x67, 0x5C, 0xBB, 0x81, 0x7B, 0xA8, 0x07, 0x7C, 0xDB, 0x2F, 0xFF, 0xA7, 0x68, 0x73, 0x25,
-    0x54, 0xC0, 0xD0, 0x51, 0x8C, 0x55, 0xCD, 0xD1, 0x9B, 0x2E, 0x1D, 0x61, 0x13, 0x2E, 0x54, 0x0A,
-    0xF4, 0xCB, 0x7D, 0x3B, 0x30, 0x40, 0x87, 0x2D, 0x60, 0x16, 0xFB, 0x2E, 0xF4, 0xB6, 0xE7, 0x3C,
-    0x43, 0x4E, 0x3E, 0x6B, 0x79, 0xC3, 0xB0, 0xB1, 0x42, 0x03, 0x2C, 0x1A, 0x2A, 0x5C, 0x36, 0x35,
-    0x98, 0xAE, 0xED, 0xEF, 0xA5, 0xAC, 0xED, 0x7B, 0x16, 0xD7, 0xDE, 0xE3, 0x2E, 0xFF, 0x39, 0x57,
-    0xF6, 0x2F, 0xE6, 0x0D, 0x03, 0x9A, 0x42, 0xCF, 0xBB, 0xE7, 0xE1, 0xB0, 0x5A, 0xAC, 0xC1, 0x64,
-    0x0C, 0x70, 0x5B, 0x25, 0x7C, 0x67, 0x70, 0x3E, 0xF3, 0x4B, 0x17, 0xD2, 0xAE, 0xED, 0xA8, 0xA5,
-    0xB6, 0x7B, 0x5D, 0x59, 0xAB, 0xCE, 0xC2, 0xD6, 0xB6, 0x48, 0xF1, 0xDD, 0x74, 0xC6, 0x5D, 0xBF,
-    0xDD, 0x25, 0xF6, 0x5C, 0x37, 0x47, 0x59, 0xEE, 0x3A, 0xE0, 0xB6, 0x49, 0xDC, 0xFB, 0x85, 0xC3,
-    0x42, 0x36, 0x27, 0x9F, 0x2B, 0x13, 0x0D, 0xB9, 0x18, 0x50, 0x38, 0x96, 0x79, 0xD2, 0x66, 0xD5,
-    0x22, 0xF7, 0x55, 0xD0, 0x66, 0xF4, 0x27, 0x4A, 0x85, 0x6D, 0x64, 0x6F, 0x34, 0x90, 0x53, 0xA9,
-    0xB3, 0x36, 0x5F, 0x6C, 0xD0, 0x3E, 0x61, 0x9B, 0xE6, 0x71, 0xAF, 0x2B, 0x52, 0xD8, 0xA4, 0xEB,
-    0xE8, 0xDA, 0x8C, 0x6D, 0x98, 0x82, 0xF1, 0xD8, 0x12, 0x73, 0xDA, 0x9D, 0xF2, 0xC4, 0xEF, 0x5C,
-    0x0E, 0xCE, 0x85, 0xE2, 0xC6, 0x6C, 0x44, 0x51, 0x63, 0xE2, 0xFD, 0xB7, 0x84, 0x2B, 0x72, 0xB1,
-    0x8B, 0x39, 0x89, 0x8A, 0x6C, 0x72, 0x3B, 0x66, 0xA8, 0xB5, 0xDC, 0xA9, 0x93, 0x32, 0x0F, 0xF6,
-    0x78, 0x93, 0xEF, 0xAB, 0x98, 0x2C, 0xF4, 0xC4, 0x9F, 0x05, 0x7B, 0x71, 0x51, 0xEC, 0x4E, 0xF0,
-    0xF3, 0xC1, 0xFD, 0x42, 0xE5, 0xFA, 0x02, 0x22, 0x6C, 0xE2, 0x66, 0xBD, 0xB6, 0x3D, 0xBE, 0x41,
-    0x74, 0xED, 0x12, 0xF3, 0x73, 0x2B, 0x47, 0x25, 0x4E, 0xE4, 0x11, 0x67, 0x07, 0x72, 0xB2, 0xF1,
-    0x8C, 0x5B, 0xF4, 0x72, 0x09, 0x7C, 0x78, 0x05, 0x60, 0x66, 0x47, 0xD7, 0xE3, 0x19, 0xB6, 0xAD,
-    0x50, 0x4D, 0x57, 0x4C, 0x81, 0xFE, 0x6D, 0x59, 0xED, 0x3D, 0x34, 0x40, 0xC7, 0x6F, 0x80, 0xCA,
-    0xDE, 0x09, 0x79, 0x58, 0x84, 0x48, 0x39, 0xCA, 0xDC, 0x6F, 0x9B, 0x75, 0x69, 0xA7, 0x6B, 0x46,
-    0x7C, 0x34, 0x20, 0xDF, 0xEE, 0xD3, 0x81, 0x7E, 0x91, 0x70, 0xFF, 0xAA, 0xDC, 0x1B, 0x38, 0x64,
-    0xCA, 0x92, 0xD8, 0xB6, 0xFD, 0xD0, 0x08, 0xD9, 0x88, 0xFC, 0x87, 0x44, 0xC8, 0x26, 0xE4, 0x3F,
-    0xC8, 0x83, 0x37, 0x21, 0x1B, 0x19, 0x9A, 0x95, 0xD2, 0xE0, 0xE0, 0x1E, 0xAB, 0x0A, 0x97, 0x99,
-    0x81, 0x87, 0x4F, 0x74, 0x60, 0x02, 0xC1, 0xB9, 0x01, 0x54, 0x73, 0x07, 0xDB, 0xA7, 0x52, 0x22,
-    0xE6, 0x93, 0x1C, 0x2C, 0x5F, 0x02, 0xB7, 0xB9, 0x84, 0xC5, 0xE9, 0x17, 0x5C, 0x9C, 0x5A, 0xF8,
-    0xC0, 0x5C, 0xB9, 0x3C, 0xE8, 0x8D, 0xC9, 0x63, 0xD2, 0x56, 0xD8, 0x94, 0x71, 0x87, 0xE3, 0x54,
-    0xD8, 0xCC, 0x7B, 0x75, 0x4F, 0x38, 0x44, 0xF7, 0x39, 0x15, 0x56, 0x62, 0xBE, 0x6E, 0x58, 0x99,
-    0xB9, 0x9C, 0x66, 0x08, 0xFF, 0x70, 0xE0, 0x5F, 0x70, 0xB7, 0x29, 0x41, 0xA9, 0x77, 0x7B, 0xE0,
-    0x12, 0x32, 0xE5, 0xAB, 0xAF, 0x2E, 0x9D, 0x4C, 0x8D, 0xA5, 0x67, 0x15, 0xD9, 0xB2, 0x0A, 0x49,
-    0x13, 0xBE, 0x4F, 0x1A, 0x6B, 0x43, 0xDD, 0xA9, 0x81, 0xF3, 0x80, 0xB6, 0xB5, 0x8B, 0x8D, 0xD9,
-    0x55, 0x82, 0x31, 0xAA, 0x63, 0x7B, 0x83, 0x1B, 0xE3, 0x95, 0x82, 0xAF, 0x2E, 0x18, 0x7F, 0x04,
-    0xC7, 0x04, 0xF9, 0x44, 0xDB, 0xC6, 0xBD, 0xE5, 0xBA, 0x63, 0x7A, 0x5B, 0xF3, 0xD5, 0x12, 0x5F,
-    0x31, 0xC5, 0x8F, 0x45, 0xAE, 0x30, 0xA4, 0x23, 0x10, 0x7C, 0xE8, 0xFF, 0xAE, 0x28, 0x9C, 0x2D,
-    0x8B, 0xFE, 0x23, 0xBF, 0x19, 0xDF, 0x66, 0x7D, 0x3A, 0xE8, 0x26, 0x1E, 0xA9, 0x67, 0xE9, 0x28,
-    0x9C, 0x75, 0x8F, 0xBC, 0xEE, 0xB8, 0xC7, 0x36, 0x44, 0xAD, 0xE8, 0x1E, 0xDD, 0x59, 0xE7, 0x11,
-    0x0D, 0x50, 0xE5, 0x45, 0x83, 0xDF, 0xB3, 0x5F, 0x95, 0x78, 0x9B, 0x90, 0xCF, 0xF8, 0x22, 0x58,
-    0xE1, 0x77, 0x30, 0x99, 0x22, 0xEE, 0x54, 0x13, 0xE4, 0x73, 0x55, 0xB2, 0x11, 0xFD, 0x29, 0x27,
-    0x6F, 0x43, 0x7B, 0x97, 0xB1, 0x51, 0x27, 0x57, 0x90, 0xDB, 0xF9, 0x16, 0x6A, 0x43, 0xF2, 0x83,
-    0x4E, 0x15, 0xD1, 0x90, 0x55, 0x24, 0x7E, 0xDF, 0x8F, 0xDF, 0x0D, 0xE8, 0x1E, 0xB0, 0x66, 0xE3,
-    0xDC, 0xC2, 0xFC, 0x59, 0xC5, 0x25, 0x96, 0x17, 0x7D, 0xCF, 0x0B, 0xE4, 0x9D, 0x6D, 0x87, 0x77,
-    0xF7, 0xB4, 0x73, 0xE3, 0xCE, 0x21, 0xC7, 0xE1, 0x81, 0xD3, 0x01, 0xBE, 0x85, 0xD2, 0x0E, 0x18,
-    0x52, 0x8E, 0xE5, 0x15, 0x3B, 0x95, 0x57, 0xBF, 0x99, 0xCA, 0x8F, 0x3F, 0x9D, 0xCA, 0xCF, 0xAF,
-    0x4E, 0xC6, 0x46, 0xA3, 0x1E, 0xE3, 0x21, 0x1B, 0x33, 0xE7, 0xBB, 0x7C, 0x79, 0x93, 0x22, 0x53,
-    0xC4, 0x2B, 0xDF, 0x75, 0xD1, 0x5B, 0x78, 0x37, 0x60, 0x29, 0xEB, 0x30, 0x7C, 0x46, 0x82, 0x9C,
-    0xCB, 0x27, 0xF8, 0xEB, 0xA3, 0x68, 0x7E, 0x65, 0x5A, 0x7E, 0x55, 0x0E, 0xC8, 0x80, 0x43, 0x66,
-    0x6F, 0x0F, 0x89, 0xFD, 0x68, 0xF0, 0x61, 0x30, 0x63, 0x38, 0x63, 0x91, 0x39, 0x82, 0xE3, 0x58,
-    0x81, 0xC3, 0x26, 0xE4, 0x3B, 0x17, 0x86, 0x5C, 0xCB, 0x1D, 0x1D, 0xCB, 0xAD, 0x1F, 0x60, 0xB8,
-    0x77, 0xE2, 0x4D, 0xC8, 0x8F, 0x9A, 0x0C, 0x6A, 0x9B, 0x82, 0x14, 0x36, 0x27, 0xD7, 0x2E, 0xB0,
-    0x21, 0xDB, 0xEC, 0xAF, 0xB3, 0x8A, 0xFB, 0xAE, 0xB3, 0x08, 0xB1, 0xB9, 0xA9, 0x02, 0xAC, 0x2D,
-    0x6B, 0xFE, 0x57, 0x48, 0xBB, 0xFA, 0xAF, 0x10, 0xD5, 0x01, 0xB7, 0xE2, 0x01, 0x33, 0x76, 0xE0,
-    0x5F, 0x43, 0x26, 0x6E, 0x2F, 0x59, 0xBE, 0x7F, 0x33, 0xE5, 0xEA, 0xFF, 0x43, 0xB2, 0x69, 0xF5,
-    0x7E, 0xCE, 0xB3, 0x4E, 0xFC, 0x0B, 0x40, 0x97, 0x59, 0x5E, 0x72, 0xD9, 0x9B, 0x7D, 0x6B, 0x36,
-    0xD3, 0x5F, 0xCA, 0x23, 0x60, 0xFB, 0x0F, 0x28, 0xA2, 0x4B, 0x94, 0xCA, 0xDC, 0x90, 0xBF, 0x65,
-    0x58, 0xFB, 0xF4, 0x1E, 0xD1, 0x0E, 0xA2, 0x5A, 0xE2, 0x51, 0x8E, 0xF7, 0xD8, 0x86, 0x6D, 0xF9,
-    0xCC, 0xEB, 0x2C, 0xC0, 0xB7, 0x1F, 0x28, 0x3B, 0xE0, 0xEE, 0x08, 0x06, 0x53, 0x7B, 0x26, 0x5D,
-    0x72, 0xE0, 0x15, 0xE5, 0xD3, 0x30, 0xC4, 0x7F, 0x01, 0xCD, 0x5B, 0xBF, 0x8F, 0xDC, 0xC6, 0x15,
-    0x1E, 0x2E, 0x7D, 0x26, 0x60, 0x16, 0x74, 0x71, 0x87, 0x00, 0x56, 0x00, 0x56, 0x01, 0x02, 0xA7,
-    0xE0, 0x5F, 0x90, 0x0C, 0x9D, 0xC0, 0x70, 0xE1, 0xC2, 0x57, 0xDC, 0x56, 0x2A, 0xD4, 0x3B, 0x40,
-    0xEE, 0x1F, 0xB0, 0x42, 0xDA, 0x2E, 0x0C, 0x44, 0x85, 0xD4, 0x24, 0xAD, 0x55, 0x28, 0x40, 0xBC,
-    0x29, 0x94, 0x22, 0x4D, 0x00, 0xCB, 0x43, 0x4B, 0x45, 0x0A, 0x17, 0xA6, 0x21, 0x18, 0x2E, 0x52,
-    0x98, 0x88, 0xED, 0x38, 0x91, 0x0B, 0x11, 0x31, 0x63, 0xF3, 0x24, 0x92, 0x93, 0xEF, 0x7B, 0x43,
-    0xEE, 0xAE, 0x64, 0xE9, 0x74, 0xF2, 0xED, 0x9D, 0xBC, 0xB7, 0xF3, 0xED, 0x1E, 0x39, 0x9C, 0x99,
-    0xF7, 0x66, 0xE6, 0xFD, 0x9C, 0x55, 0xCF, 0x2D, 0xAE, 0x28, 0xA5, 0xB4, 0xED, 0x96, 0xB8, 0x33,
-    0xDF, 0x53, 0xD3, 0xCB, 0xB7, 0x85, 0x60, 0x09, 0x0C, 0x6D, 0x05, 0x8C, 0x6C, 0x4D, 0xBC, 0xDB,
-    0x00, 0x93, 0x2F, 0x5B, 0x3E, 0x75, 0x93, 0x4F, 0x65, 0x37, 0x7A, 0xA0, 0x79, 0xDD, 0x02, 0x6D,
-    0x0A, 0xF4, 0x2C, 0x3E, 0xD5, 0xCC, 0x2A, 0x53, 0xA0, 0x81, 0x05, 0x1A, 0x0A, 0xAC, 0x45, 0x13,
-    0x21, 0xB0, 0x46, 0x33, 0xC4, 0xB8, 0x51, 0x51, 0xAB, 0x34, 0xFE, 0xED, 0x94, 0xAE, 0x54, 0xD0,
-    0xAB, 0xAC, 0x54, 0xFE, 0xA0, 0x2C, 0x1F, 0x51, 0xB3, 0xC5, 0x22, 0xF5, 0xAD, 0xCD, 0x59, 0xBC,
-    0xF9, 0x5C, 0x06, 0x34, 0xB3, 0x03, 0x9F, 0x2D, 0xD0, 0x4A, 0xED, 0x5F, 0x4A, 0x30, 0x96, 0xA8,
-    0x91, 0xB2, 0x6F, 0x1B, 0x5C, 0x6F, 0xB4, 0xBD, 0xDA, 0x98, 0x32, 0x6A, 0x6C, 0x81, 0x92, 0xC7,
-    0xF8, 0x9E, 0x35, 0x99, 0x5C, 0xFF, 0xB6, 0x09, 0xED, 0x9B, 0x8D, 0xDA, 0x45, 0x23, 0xDB, 0x6A,
-    0x07, 0xF8, 0x0B, 0xA5, 0x49, 0xC3, 0xDD, 0x5E, 0xA8, 0x6A, 0x85, 0x4E, 0x52, 0x88, 0xDB, 0x3F,
-    0x0C, 0xFA, 0xB7, 0x52, 0x6F, 0x37, 0x28, 0x83, 0xD2, 0x1F, 0x4C, 0xE1, 0x59, 0x34, 0x96, 0xA1,
-    0x0B, 0x2F, 0xDD, 0x1C, 0x1F, 0x9E, 0x28, 0x75, 0x78, 0x79, 0xAD, 0xF0, 0x58, 0x98, 0x1E, 0x72,
-    0x28, 0x2A, 0x72, 0x28, 0x77, 0x03, 0x41, 0xF5, 0xB7, 0x0D, 0xD1, 0x1B, 0x80, 0xCA, 0x38, 0x57,
-    0x32, 0xE9, 0x52, 0xD0, 0x79, 0x0C, 0xDA, 0x9E, 0xFE, 0x1C, 0x03, 0xE1, 0xE2, 0x0A, 0x49, 0x28,
-    0x5B, 0x56, 0x19, 0xAA, 0xA9, 0x81, 0xDD, 0xEE, 0x4E, 0x0B, 0xE1, 0x69, 0x7B, 0x80, 0xEB, 0x5C,
-    0x88, 0x20, 0x2D, 0x0D, 0xEC, 0x2D, 0xAB, 0xA2, 0x41, 0x6D, 0xA9, 0x58, 0x78, 0xC4, 0x87, 0x34,
-    0xC9, 0xD0, 0x64, 0x65, 0x26, 0x50, 0x2C, 0xBF, 0x95, 0xCB, 0xBB, 0xAC, 0x97, 0x90, 0xB7, 0x51,
-    0xAF, 0x3C, 0xF0, 0xEA, 0x0B, 0x03, 0x4E, 0x58, 0xD0, 0x69, 0x08, 0x67, 0x2C, 0x99, 0xCC, 0xA5,
-    0xA9, 0x76, 0x30, 0xCB, 0x36, 0x27, 0xB3, 0x54, 0x88, 0xFA, 0x49, 0x31, 0x5E, 0x67, 0x73, 0x96,
-    0x9B, 0xA2, 0x00, 0xD1, 0x79, 0xD2, 0x9F, 0x95, 0x36, 0xD9, 0x03, 0xE6, 0xE1, 0x9E, 0xC2, 0xFE,
-    0xD9, 0xA9, 0xEE, 0xCF, 0xB2, 0x6E, 0x81, 0xE9, 0x29, 0x94, 0x19, 0xC6, 0x05, 0x34, 0x97, 0x79,
-    0xCF, 0xC9, 0x6A, 0x3C, 0x9B, 0xFC, 0x03, 0x7D, 0x18, 0x0F, 0xBD, 0xEF, 0x2D, 0x17, 0xFF, 0xE9,
-    0x12, 0xBC, 0x03, 0x46, 0x67, 0xA8, 0x07, 0x01, 0xE4, 0x77, 0xE8, 0xA9, 0x4A, 0x8A, 0x2D, 0xAC,
-    0xFF, 0xCD, 0x11, 0x2C, 0xAF, 0x41, 0x16, 0x92, 0x92, 0xD5, 0x3B, 0xCD, 0xB0, 0x7A, 0x42, 0x33,
-    0x8C, 0x57, 0x5C, 0xBA, 0x07, 0x58, 0xF8, 0x5D, 0x6D, 0x70, 0x86, 0xF7, 0xD8, 0x8B, 0xC1, 0x9F,
-    0x4A, 0xB8, 0x81, 0x43, 0xEE, 0x6B, 0xB7, 0xD1, 0xE7, 0xE9, 0x93, 0x20, 0x98, 0xB2, 0x2C, 0xAA,
-    0xE2, 0xCA, 0xEF, 0x4C, 0xAE, 0xB0, 0x97, 0x55, 0xD6, 0xB9, 0x59, 0xDF, 0x10, 0xC1, 0xDE, 0x2E,
-    0x48, 0x9E, 0x75, 0x3E, 0xC6, 0x6E, 0xCF, 0x91, 0xA7, 0x14, 0x6D, 0x22, 0x47, 0xBC, 0xBD, 0x25,
-    0x5B, 0xFF, 0x23, 0xA3, 0x2A, 0x09, 0x2D, 0x61, 0x40, 0xB3, 0xA1, 0x4D, 0x29, 0x5D, 0x0B, 0x74,
-    0x60, 0x4A, 0x40, 0x56, 0x01, 0xB4, 0x40, 0xBD, 0x84, 0xE5, 0xB5, 0x8C, 0x55, 0x4C, 0x31, 0x3E,
-    0xC1, 0x67, 0x6F, 0xB1, 0x95, 0xB1, 0x3D, 0xB6, 0x7C, 0xB0, 0xA6, 0x3C, 0xFA, 0xA4, 0x14, 0x2C,
-    0x88, 0x3A, 0x15, 0x94, 0xEB, 0x3F, 0x15, 0xE4, 0x3A, 0xBC, 0xD9, 0x73, 0x72, 0xBE, 0x05, 0xC6,
-    0x96, 0xBC, 0xD2, 0x07, 0xFB, 0xC4, 0x2A, 0xEC, 0x49, 0x2F, 0xEB, 0x98, 0x87, 0xA0, 0xBB, 0xAB,
-    0xAB, 0x60, 0xF9, 0x94, 0x6B, 0x21, 0xB4, 0xDF, 0xF4, 0x5C, 0xE6, 0x1F, 0x91, 0xF3, 0x4F, 0x39,
-    0x41, 0x3A, 0xE4, 0x14, 0xCF, 0xBD, 0xC8, 0xE8, 0x5C, 0x04, 0x75, 0xD0, 0x29, 0xD3, 0x00, 0xE2,
-    0x0E, 0x10, 0xF6, 0x80, 0x60, 0x80, 0x00, 0xF4, 0x87, 0xCC, 0x76, 0xBE, 0x5D, 0xC2, 0xF0, 0xB3,
-    0xE1, 0x8A, 0x3F, 0xF0, 0x2E, 0xAB, 0x84, 0xDD, 0xF4, 0x04, 0x9E, 0x1D, 0xAE, 0xA2, 0x95, 0xB1,
-    0x3D, 0x69, 0xF9, 0xD2, 0x8A, 0xEE, 0x11, 0x02, 0xB2, 0x24, 0x1C, 0xD5, 0x42, 0xE5, 0xAE, 0x3D,
-    0x05, 0x98, 0xD9, 0xCF, 0x7A, 0x5C, 0x82, 0xE6, 0x4D, 0xF8, 0xAC, 0x8C, 0x3E, 0xAB, 0x43, 0xEA,
-    0x07, 0xDC, 0x15, 0xF2, 0x1C, 0xF0, 0x5F, 0xB9, 0x96, 0xD5, 0x01, 0xEB, 0x9D, 0x1B, 0x9F, 0x88,
-    0xC8, 0xB1, 0x99, 0xBD, 0xDE, 0x3B, 0x0A, 0x9F, 0x59, 0xBC, 0x83, 0x4B, 0x83, 0x94, 0xAD, 0xD1,
-    0x7A, 0xE1, 0xC2, 0x5E, 0x2B, 0x69, 0x36, 0x2E, 0xA0, 0x65, 0xB9, 0xB5, 0x60, 0x9D, 0x55, 0xB9,
-    0xFF, 0xBE, 0xAB, 0x93, 0xAE, 0xB7, 0xF3, 0x20, 0x83, 0x44, 0x99, 0x5E, 0x8D, 0x8B, 0xB7, 0x4E,
-    0x9A, 0xB8, 0xD1, 0x65, 0xD0, 0x61, 0x6A, 0x3A, 0x2C, 0x87, 0x55, 0x59, 0x5B, 0xBC, 0x49, 0xAB,
-    0xFE, 0xC2, 0xBA, 0x3E, 0x35, 0xA4, 0xE1, 0x8E, 0xDC, 0xC5, 0xFE, 0xD8, 0x4A, 0x63, 0x15, 0xA7,
-    0xD1, 0x1D, 0x0B, 0x9E, 0x61, 0x1F, 0x59, 0x6C, 0xA8, 0x2D, 0x75, 0x62, 0x74, 0x1C, 0x66, 0x58,
-    0x6C, 0x82, 0x1E, 0x79, 0xE9, 0x7C, 0xB5, 0x73, 0xF9, 0x5D, 0x9D, 0x1C, 0x3D, 0xD2, 0x70, 0x54,
-    0x39, 0xED, 0x2D, 0xB6, 0x41, 0xB5, 0xDA, 0x85, 0x1B, 0xA0, 0xE7, 0x64, 0xC6, 0x7C, 0x1E, 0x3C,
-    0xC7, 0x3C, 0xFB, 0xF5, 0x58, 0x70, 0x6D, 0xC6, 0xEB, 0xBF, 0x49, 0x8F, 0x3D, 0xEE, 0x8C, 0xBB,
-    0x6D, 0x7F, 0x34, 0x76, 0xDE, 0x45, 0xA1, 0x69, 0x63, 0x2F, 0xA3, 0x36, 0x55, 0x4D, 0xC5, 0xF5,
-    0x96, 0x14, 0x3A, 0x8F, 0xFE, 0x37, 0xA0, 0x0F, 0xDC, 0xA3, 0x76, 0xD8, 0x49, 0x4F, 0x74, 0xBD,
-    0x85, 0x75, 0x54, 0xCF, 0x7A, 0xDC, 0xA5, 0x5A, 0xD0, 0xE8, 0x73, 0x6B, 0x77, 0x83, 0xEB, 0x8D,
-    0x4A, 0xCD, 0xE3, 0x3F, 0x3E, 0x49, 0x89, 0xBE, 0xEE, 0xB8, 0xE6, 0x0C, 0x35, 0xCF, 0xA4, 0x6C,
-    0x61, 0x40, 0xA6, 0x14, 0x1E, 0x15, 0x06, 0x60, 0x0B, 0xDF, 0xDE, 0x31, 0xE8, 0x32, 0xF5, 0xD2,
-    0x78, 0x69, 0xF5, 0x39, 0x95, 0xE7, 0xD4, 0xDB, 0x73, 0x8B, 0xCB, 0x59, 0x19, 0xDB, 0x5A, 0x40,
-    0x0B, 0x54, 0xA8, 0x85, 0x2A, 0x09, 0x46, 0x09, 0x80, 0xB6, 0x4B, 0x6A, 0x6A, 0x3B, 0x0E, 0x44,
-    0x46, 0x02, 0x38, 0xC3, 0x3E, 0xA4, 0x47, 0x12, 0x47, 0x22, 0xA1, 0x9D, 0x40, 0x74, 0x1A, 0x34,
-    0x71, 0x49, 0x26, 0x88, 0xD1, 0x0B, 0xC9, 0x1C, 0xDA, 0x3B, 0x3D, 0xA5, 0x35, 0x25, 0x1F, 0x65,
-    0x3D, 0x65, 0xB9, 0xB9, 0xAF, 0xF0, 0x1A, 0xA5, 0xBB, 0x6E, 0x63, 0xA9, 0x4B, 0x79, 0x39, 0xA3,
-    0xBE, 0x78, 0x4A, 0x44, 0x6B, 0xF7, 0x2C, 0xCC, 0xEA, 0xE4, 0x8F, 0xA6, 0x4D, 0xC8, 0x38, 0x90,
-    0x24, 0xEA, 0x7C, 0x87, 0x62, 0x23, 0x81, 0x28, 0x81, 0x0D, 0x6F, 0xA9, 0x0B, 0x44, 0xC9, 0x90,
-    0xB0, 0x2D, 0xF5, 0x24, 0x18, 0xE1, 0x81, 0x68, 0xBF, 0xF4, 0x2B, 0xDF, 0x9A, 0x52, 0x71, 0xD5,
-    0xEB, 0x95, 0xA4, 0x39, 0x51, 0x46, 0xAC, 0x64, 0x90, 0x08, 0x20, 0x07, 0x3A, 0x5D, 0x37, 0xF8,
-    0x4E, 0x77, 0x45, 0x88, 0x88, 0xE2, 0xEE, 0x6B, 0x5C, 0x09, 0x57, 0x22, 0xEA, 0xE4, 0x19, 0x71,
-    0xFA, 0xA4, 0xA2, 0x31, 0xB1, 0x16, 0xC9, 0x71, 0xA3, 0x46, 0x09, 0xA4, 0xF6, 0x46, 0xA0, 0xE3,
-    0xE7, 0x83, 0x09, 0x41, 0xED, 0x98, 0x32, 0xCA, 0x82, 0x13, 0x65, 0x84, 0xD8, 0x81, 0x21, 0x2D,
-    0xC2, 0x84, 0x52, 0x36, 0x3B, 0x57, 0x29, 0xAF, 0x0F, 0x1A, 0x67, 0x39, 0x3A, 0xD1, 0x57, 0xA8,
-    0xA4, 0x3A, 0x0A, 0xDC, 0x5A, 0x98, 0x2A, 0xA3, 0x15, 0xB5, 0x06, 0x47, 0x7D, 0x96, 0x30, 0x8A,
-    0xAB, 0x62, 0x12, 0x57, 0x9F, 0x89, 0xB8, 0xB2, 0x53, 0x60, 0x42, 0x5E, 0xA2, 0xD5, 0x1E, 0x0E,
-    0x2F, 0x43, 0x6B, 0xDB, 0xCC, 0x4D, 0x68, 0xA3, 0xEC, 0x41, 0xD6, 0x2A, 0x5B, 0xC2, 0xCF, 0x86,
-    0x87, 0x0C, 0xC8, 0x1F, 0x13, 0x60, 0xD1, 0xCD, 0x06, 0x30, 0x8E, 0x0E, 0xA7, 0x43, 0xCB, 0x57,
-    0xB3, 0x8E, 0xEB, 0x77, 0x83, 0x61, 0xF1, 0xE7, 0x41, 0xAC, 0xC9, 0xFB, 0x70, 0xBD, 0xCE, 0x91,
-    0x51, 0x5E, 0x61, 0x3B, 0x81, 0x15, 0x8D, 0xB4, 0x84, 0xF1, 0xC6, 0x16, 0xC1, 0xB4, 0x2A, 0xBC,
-    0x0B, 0x05, 0xC2, 0x28, 0x43, 0x1A, 0xDA, 0x5F, 0x82, 0x5A, 0x9A, 0x8A, 0xA0, 0x22, 0x1B, 0xA1,
-    0x3D, 0x1A, 0x88, 0xBD, 0x90, 0xE8, 0xE1, 0x3D, 0x63, 0xBB, 0x36, 0x6E, 0x76, 0x45, 0x24, 0x45,
-    0xB6, 0x77, 0x6F, 0x0F, 0x7C, 0x15, 0x3B, 0xFF, 0xD1, 0x6F, 0x30, 0x7D, 0x7A, 0x4A, 0x4C, 0xED,
-    0x26, 0x4A, 0x63, 0x6B, 0xE0, 0x7E, 0x0C, 0xEA, 0x35, 0x8C, 0x68, 0x5B, 0xA5, 0xAB, 0xE9, 0x3C,
-    0x46, 0x79, 0x7E, 0x71, 0x45, 0xDB, 0x16, 0xEF, 0x9D, 0xF9, 0xAE, 0x04, 0xEA, 0x1A, 0xF7, 0x0E,
-    0x60, 0x94, 0x5A, 0x75, 0x94, 0xB7, 0x6F, 0xD3, 0xE5, 0x53, 0xAF, 0x62, 0x83, 0x63, 0x7B, 0xDB,
-    0xDA, 0xB5, 0x86, 0x29, 0x78, 0xAC, 0xF7, 0x9E, 0xDA, 0x7E, 0x57, 0x9D, 0xD7, 0xB7, 0xBB, 0x84,
-    0x03, 0x28, 0x5C, 0xC8, 0xE0, 0x98, 0x43, 0x42, 0x9B, 0x9D, 0x7A, 0x37, 0xBB, 0x0D, 0x1A, 0x21,
-    0x59, 0x72, 0xD7, 0xE6, 0xE3, 0x0E, 0xEC, 0x98, 0x63, 0x60, 0xF4, 0x29, 0x51, 0xEA, 0xB7, 0x4A,
-    0xBD, 0x27, 0xD1, 0x08, 0xDD, 0xA8, 0x67, 0x60, 0x33, 0x25, 0xA5, 0xAE, 0x74, 0x15, 0x4B, 0x64,
-    0x8A, 0xDF, 0x0E, 0xFB, 0x8B, 0x72, 0xAD, 0xAE, 0x29, 0xAC, 0x49, 0x48, 0x4B, 0x3E, 0xCB, 0x20,
-    0x83, 0xEB, 0x48, 0xF5, 0x93, 0x5C, 0x3C, 0xDE, 0x20, 0x6D, 0x7E, 0xF8, 0x1F, 0xAA, 0x84, 0xED,
-    0x0A, 0xD0, 0x49, 0xD8, 0xA2, 0x89, 0xE3, 0x01, 0x06, 0xB0, 0xDE, 0xA8, 0x00, 0x37, 0x0C, 0x81,
-    0xCA, 0xEC, 0x39, 0x43, 0xCD, 0x46, 0xA3, 0x33, 0xE6, 0x82, 0x8D, 0xFB, 0x95, 0x96, 0x4D, 0xCA,
-    0x10, 0xEA, 0x23, 0x6A, 0x59, 0xE2, 0x22, 0xAC, 0x97, 0xEA, 0xA1, 0x8A, 0x9A, 0xE3, 0x94, 0x65,
-    0x00, 0x90, 0xE5, 0x69, 0xF4, 0xCF, 0x10, 0x47, 0xC8, 0x38, 0xE4, 0x30, 0x9A, 0x5F, 0x0C, 0x05,
-    0xC0, 0x4B, 0xEC, 0x4C, 0x1A, 0xD6, 0x49, 0x01, 0xF3, 0xCB, 0x6D, 0xC5, 0xB8, 0xDE, 0x7C, 0xA1,
-    0x0A, 0x85, 0x8E, 0x7C, 0x1E, 0x16, 0x28, 0x03, 0x0F, 0xDA, 0xBA, 0xEE, 0xE5, 0x35, 0x77, 0xA2,
-    0x3E, 0x60, 0x58, 0x14, 0x82, 0x5E, 0xE7, 0xC3, 0x4A, 0xCC, 0xDB, 0xF4, 0xD8, 0x92, 0xC1, 0x95,
-    0x54, 0xFD, 0x1A, 0xC5, 0x58, 0x31, 0xA7, 0x55, 0x56, 0x89, 0x32, 0x33, 0x45, 0x56, 0xCC, 0x68,
-    0xC1, 0x33, 0xF2, 0x5A, 0xC4, 0x94, 0x7B, 0xD0, 0xE1, 0x59, 0x81, 0xD1, 0x64, 0xD7, 0xE9, 0xF5,
-    0xFD, 0x9D, 0x71, 0x98, 0x0F, 0x5B, 0x1A, 0xFD, 0x0C, 0xB9, 0x58, 0xF9, 0xC6, 0xE7, 0x69, 0x3B,
-    0x66, 0x1F, 0xA1, 0xE5, 0xAC, 0x80, 0xDD, 0x36, 0x3E, 0x26, 0x0D, 0x44, 0x94, 0xB2, 0x3E, 0xCD,
-    0x7E, 0x69, 0x59, 0x49, 0x04, 0x79, 0x7A, 0x31, 0x54, 0xA9, 0x64, 0x8A, 0xC5, 0x01, 0x93, 0x60,
-    0xEE, 0xD2, 0xEE, 0x34, 0xF9, 0xE1, 0x40, 0x49, 0x9E, 0xC3, 0xBC, 0x30, 0x79, 0x56, 0x32, 0xD2,
-    0x9C, 0x2B, 0xF3, 0x16, 0xC6, 0x67, 0x2E, 0x62, 0x54, 0x86, 0xEB, 0xCB, 0x58, 0x01, 0xFE, 0xCB,
-    0x41, 0x9A, 0x9B, 0xA4, 0x36, 0x67, 0x3D, 0x79, 0x22, 0xC7, 0x24, 0x98, 0x1C, 0xE3, 0x33, 0x79,
-    0x70, 0x4F, 0x64, 0x8F, 0x41, 0x18, 0x89, 0xA0, 0x3A, 0xFB, 0x4F, 0x4F, 0x21, 0x7E, 0xD4, 0x63,
-    0x97, 0x11, 0xBB, 0xC4, 0xE4, 0xB9, 0xA6, 0xDE, 0x60, 0xA3, 0x17, 0x68, 0xB9, 0xBF, 0x2D, 0xBD,
-    0x55, 0x04, 0x46, 0x47, 0xA9, 0x8A, 0xCC, 0x67, 0x87, 0x76, 0x39, 0x57, 0x12, 0xD7, 0xE6, 0xD6,
-    0x48, 0x2A, 0x67, 0xFB, 0x4C, 0xD1, 0xD4, 0xAC, 0xF8, 0x6E, 0x38, 0xEB, 0xB1, 0xCB, 0xAD, 0xC5,
-    0x25, 0x06, 0x99, 0xA6, 0x42, 0x2B, 0xC2, 0xE6, 0x10, 0x7B, 0xA0, 0x00, 0xE4, 0xED, 0x8C, 0xDB,
-    0xEA, 0xB8, 0xEF, 0x13, 0x19, 0xEA, 0xBA, 0x51, 0x28, 0x25, 0x15, 0x39, 0x3B, 0xAA, 0x8E, 0xEA,
-    0xE8, 0x7F, 0xB2, 0x83, 0x21, 0x8C, 0x13, 0x08, 0xDA, 0x1D, 0xAE, 0xC7, 0x1A, 0xA6, 0x6C, 0x65,
-    0x8A, 0xB8, 0x30, 0xB8, 0x86, 0xB2, 0x89, 0xB1, 0xDA, 0xB7, 0x5A, 0x7B, 0xA1, 0xB6, 0x17, 0x2A,
-    0x7B, 0xB1, 0xB0, 0xBF, 0x4B, 0x31, 0xDF, 0x8F, 0xFB, 0x7E, 0x34, 0x13, 0x0D, 0x8A, 0xCD, 0x5D,
-    0xC9, 0x8E, 0x3C, 0xB0, 0x43, 0x3A, 0xBD, 0x58, 0xD9, 0xAB, 0x35, 0xDF, 0x17, 0xCB, 0x43, 0xAA,
-    0xC1, 0xE2, 0x7A, 0x48, 0x49, 0x45, 0x44, 0x05, 0x58, 0xEC, 0x22, 0xAA, 0x28, 0x1F, 0xB8, 0xE4,
-    0x3B, 0xE7, 0xC8, 0xFE, 0x68, 0xBD, 0xEE, 0xB0, 0x78, 0x87, 0x41, 0xBF, 0xA9, 0xD0, 0xC1, 0x18,
-    0x1E, 0xF2, 0xA6, 0x8E, 0x2B, 0x67, 0x74, 0xD7, 0xCB, 0xC4, 0x2A, 0x3D, 0xA8, 0x78, 0x50, 0xE1,
-    0x83, 0x6A, 0x8E, 0x06, 0x7A, 0x74, 0x4F, 0x12, 0xC6, 0xEB, 0xD7, 0x93, 0x30, 0x50, 0xC9, 0xB3,
-    0x2E, 0x63, 0x86, 0x20, 0x1B, 0x08, 0x56, 0x20, 0x27, 0x94, 0x80, 0xAC, 0x06, 0x9C, 0x6B, 0x00,
-    0x2F, 0x77, 0x80, 0x37, 0x07, 0xC0, 0x1B, 0x16, 0x90, 0xDB, 0x1B, 0x80, 0xEC, 0x26, 0x40, 0x7F,
-    0x0D, 0x88, 0xBF, 0x01, 0x84, 0x16, 0xE0, 0x13, 0x66, 0x04, 0x25, 0x90, 0x11, 0x48, 0xAE, 0xE4,
-    0x5F, 0x8A, 0x55, 0xFE, 0xA5, 0x5C, 0x7A, 0x36, 0x43, 0x68, 0x53, 0xAB, 0x6D, 0x25, 0x86, 0x31,
-    0xCC, 0x6E, 0x5A, 0xDD, 0x34, 0xBA, 0x6D, 0x1E, 0x1C, 0xA9, 0x9C, 0x22, 0x11, 0xAB, 0xD7, 0x32,
-    0xDD, 0xE1, 0xF1, 0xF2, 0x8C, 0xAA, 0xC9, 0xDB, 0xDD, 0x0C, 0x3D, 0xCB, 0x3E, 0xA2, 0x31, 0x8B,
-    0x41, 0x49, 0xAB, 0xC7, 0x2C, 0xC7, 0x98, 0x85, 0x40, 0xF7, 0xC9, 0x27, 0xDD, 0x98, 0x5D, 0x74,
-    0x49, 0xC7, 0xF9, 0x69, 0xCF, 0xE9, 0x61, 0x09, 0x88, 0xE3, 0xF2, 0x40, 0xF4, 0x9E, 0xD8, 0x22,
-    0x8E, 0x0D, 0x14, 0x51, 0x82, 0xA2, 0x1C, 0x93, 0x1B, 0x0D, 0xFA, 0xD2, 0xBF, 0x3A, 0x80, 0xCF,
-    0xB2, 0x43, 0x87, 0x99, 0xE9, 0xCF, 0x8F, 0xB1, 0x9F, 0xA9, 0x46, 0x25, 0x21, 0x0A, 0xB1, 0x06,
-    0xC7, 0x95, 0xD8, 0x7D, 0x0F, 0x5C, 0x63, 0xE1, 0x7D, 0xDC, 0x33, 0xE4, 0xDE, 0x7E, 0x0B, 0x78,
-    0xA5, 0x07, 0xBC, 0x64, 0x85, 0x7B, 0x64, 0x9C, 0x25, 0xE3, 0xB2, 0xFF, 0x02, 0x92, 0x01, 0x10,
-    0x3D, 0x88, 0x71, 0x9A, 0x10, 0x13, 0x22, 0x82, 0xCF, 0xA9, 0x5E, 0xC2, 0xD6, 0x3E, 0xD3, 0xA7,
-    0x56, 0xCC, 0x3E, 0x26, 0x56, 0xD7, 0x34, 0xEE, 0xBD, 0xDC, 0xDC, 0x5F, 0xE3, 0xE6, 0xD1, 0x8A,
-    0xCB, 0xC4, 0xB2, 0x40, 0x18, 0xCC, 0xAE, 0xB6, 0xE0, 0x53, 0x23, 0xA9, 0x79, 0x58, 0x1C, 0xEA,
-    0x99, 0xC5, 0x9F, 0xC8, 0x58, 0x11, 0x3A, 0x0E, 0xB7, 0xD6, 0x8E, 0x2B, 0x84, 0x92, 0xC6, 0x37,
-    0x56, 0x42, 0xA9, 0x56, 0x0C, 0xC2, 0x5B, 0xB8, 0x14, 0xF5, 0xCC, 0xF4, 0x26, 0x2D, 0x6D, 0x43,
-    0x98, 0x32, 0xE0, 0xBB, 0x66, 0x6B, 0xE4, 0xBE, 0x07, 0x2B, 0xE6, 0x21, 0xE8, 0xEA, 0xB8, 0xFA,
-    0xB0, 0x4B, 0xF0, 0xAC, 0x6B, 0x27, 0xB4, 0xFF, 0xB2, 0xAD, 0x72, 0x91, 0x0F, 0xD7, 0x97, 0x3A,
-    0xE3, 0x22, 0x2D, 0x5C, 0xF2, 0xDE, 0x62, 0x01, 0x26, 0xDA, 0x82, 0x45, 0xCD, 0xC7, 0x64, 0x9B,
-    0x61, 0x9C, 0x95, 0xAE, 0xA2, 0xAD, 0x93, 0x36, 0xEE, 0x18, 0xBB, 0x80, 0x15, 0x35, 0x18, 0x29,
-    0x33, 0xEB, 0x8A, 0x3F, 0xF0, 0x1A, 0xEF, 0xB1, 0x0E, 0x93, 0xDA, 0xBE, 0xA4, 0x94, 0xC6, 0x8C,
-    0x9E, 0x84, 0xF6, 0xE0, 0x9F, 0x24, 0xF8, 0x1E, 0xD3, 0x40, 0xC3, 0x40, 0x64, 0x37, 0x4B, 0x78,
-    0x6F, 0x65, 0x67, 0xFD, 0x30, 0xB8, 0x90, 0xAA, 0x5D, 0xBF, 0xF2, 0xEB, 0x99, 0x8B, 0xFB, 0xC1,
-    0xAF, 0x5A, 0x4B, 0xC4, 0x6E, 0x82, 0x1B, 0xDE, 0xDE, 0x8E, 0x38, 0x20, 0xB4, 0xA0, 0xE3, 0x7F,
-    0x72, 0x1D, 0xE8, 0xB7, 0xB8, 0xFF, 0xAE, 0x89, 0xD1, 0xB9, 0xFB, 0xC3, 0xE2, 0x86, 0x9A, 0xC3,
-    0x21, 0xB1, 0x71, 0xED, 0xF7, 0xBA, 0x08, 0x6A, 0x3C, 0xF3, 0x7E, 0xAB, 0xB6, 0x36, 0xC9, 0x8D,
-    0x25, 0xA9, 0x72, 0x06, 0xC3, 0xC8, 0x87, 0x2F, 0x61, 0x9B, 0x8A, 0xD4, 0xE2, 0x23, 0xEA, 0x5D,
-    0xF4, 0xBC, 0x71, 0x19, 0xD4, 0xDA, 0x7D, 0x54, 0xEE, 0x03, 0x5E, 0xCB, 0x9D, 0x05, 0x2D, 0x5A,
-    0x8D, 0xA9, 0xBA, 0xF7, 0x83, 0xF7, 0xD6, 0x6A, 0xD6, 0xEB, 0xAD, 0xB8, 0x63, 0x1D, 0xE8, 0xF5,
-    0x0F, 0xE6, 0xCE, 0xE2, 0xD2, 0xD8, 0xDF, 0xD8, 0x3B, 0x93, 0x91, 0x92, 0xF3, 0xDB, 0x5E, 0xD7,
-    0x43, 0xA6, 0xF7, 0xC0, 0x26, 0xD8, 0x0C, 0x9F, 0x5A, 0x2B, 0x87, 0x44, 0xD0, 0x43, 0x72, 0xB0,
-    0x8F, 0x6E, 0x60, 0xDA, 0x05, 0xB8, 0x54, 0x8B, 0x73, 0x41, 0xA3, 0x8E, 0xCD, 0x35, 0x24, 0x7E,
-    0xFD, 0x43, 0x82, 0x45, 0x52, 0x45, 0x32, 0x9F, 0x9C, 0xFC, 0xE4, 0x20, 0xB1, 0x95, 0x57, 0xBA,
-    0xC6, 0x4A, 0x5F, 0x9A, 0x26, 0x63, 0x3C, 0x4E, 0x02, 0x13, 0xC3, 0xE9, 0x78, 0x9C, 0x42, 0x5C,
-    0x15, 0x69, 0x40, 0x7C, 0x57, 0x49, 0xB8, 0xEF, 0xAC, 0xB2, 0x52, 0x57, 0xC6, 0x79, 0x93, 0x58,
-    0xA6, 0xB9, 0x05, 0x91, 0x03, 0xA3, 0xB2, 0x73, 0xC1, 0xA5, 0x75, 0x80, 0xCF, 0x6B, 0x3E, 0x36,
-    0xF5, 0x94, 0xEE, 0xA5, 0x87, 0x22, 0xF0, 0x3E, 0xFD, 0x2F, 0xC9, 0x22, 0x17, 0x74, 0x26, 0x0A,
-    0x7A, 0x32, 0xF4, 0x96, 0x4C, 0x11, 0x30, 0xCD, 0xEC, 0xCB, 0x49, 0x19, 0x0C, 0x61, 0x6B, 0x8F,
-    0x09, 0x76, 0xB0, 0xD5, 0xA6, 0x90, 0xA3, 0x4E, 0x0B, 0x0F, 0x61, 0x6B, 0x93, 0xD6, 0x9A, 0x86,
-    0x12, 0xB3, 0x61, 0xAD, 0x47, 0x58, 0x97, 0xA7, 0x36, 0xDA, 0xFB, 0x7C, 0x3B, 0x51, 0x6E, 0x51,
-    0x39, 0xA9, 0xB6, 0x71, 0x97, 0xE9, 0x37, 0x06, 0xFD, 0xC1, 0xA0, 0x6F, 0xF7, 0xDA, 0xF6, 0xBA,
-    0x1F, 0x17, 0xC9, 0x21, 0xEF, 0xF1, 0xF4, 0x43, 0xC5, 0x46, 0x92, 0x9C, 0xC6, 0xC2, 0x78, 0x40,
-    0x00, 0x6E, 0x63, 0x44, 0xA5, 0x46, 0xD3, 0xCF, 0xCA, 0x1C, 0x77, 0x6A, 0x75, 0x4A, 0xE0, 0xF4,
-    0xC8, 0xDE, 0x06, 0x65, 0x3A, 0xCF, 0x52, 0x0A, 0x16, 0x1A, 0xC4, 0x33, 0x2E, 0xE4, 0x51, 0x94,
-    0x83, 0x58, 0x05, 0x6A, 0x15, 0xC8, 0xC5, 0x06, 0xE9, 0x25, 0xA1, 0xA1, 0x6B, 0x35, 0xED, 0x92,
-    0x47, 0x96, 0xA5, 0x9B, 0x18, 0xAD, 0xB9, 0x89, 0x93, 0x06, 0xC3, 0x7E, 0x66, 0xA6, 0x1C, 0x7B,
-    0xA7, 0xD4, 0x77, 0xE0, 0x17, 0x94, 0xDE, 0x32, 0xFF, 0x26, 0x7D, 0x0C, 0xB4, 0xA1, 0xC0, 0x21,
-    0x71, 0xD2, 0x69, 0xCD, 0x53, 0xF7, 0x9A, 0x31, 0xF1, 0x19, 0xD7, 0x97, 0xF1, 0x69, 0x7E, 0x2F,
-    0xDE, 0x42, 0xC1, 0xE3, 0x17, 0x09, 0x3D, 0x57, 0x6E, 0x40, 0x9E, 0x6F, 0xA2, 0x87, 0x4A, 0x13,
-    0x85, 0x41, 0x7E, 0xAB, 0x96, 0x7D, 0x32, 0x36, 0x9E, 0x48, 0x2E, 0x0F, 0x1C, 0xC8, 0x7F, 0x2C,
-    0xDE, 0xB8, 0x61, 0x35, 0xB0, 0x2A, 0x16, 0xDA, 0x07, 0x46, 0xCC, 0x19, 0xC4, 0xA0, 0x4D, 0x9C,
-    0xFE, 0x15, 0x9F, 0x6C, 0x9B, 0x3E, 0xB8, 0xA4, 0x19, 0xF7, 0xC6, 0xFD, 0x05, 0x76, 0x7B, 0x50,
-    0x48, 0xC1, 0x01, 0x6C, 0xFC, 0x52, 0xE7, 0xCB, 0xE3, 0x3B, 0x27, 0x45, 0xD3, 0x9C, 0xAA, 0xCF,
-    0xC5, 0x55, 0xE2, 0x2F, 0x5B, 0xB0, 0x71, 0x15, 0x57, 0xD9, 0x08, 0x4D, 0x27, 0x35, 0x76, 0x3D,
-    0xE6, 0xA5, 0x62, 0x97, 0xF7, 0xF5, 0xCE, 0x92, 0x6F, 0x95, 0x1B, 0xCA, 0x26, 0xC6, 0x7E, 0x4D,
-    0x49, 0xFC, 0x52, 0xED, 0x17, 0xB2, 0x55, 0x67, 0xFB, 0xA5, 0x98, 0xDC, 0x94, 0x7C, 0x5B, 0x90,
-    0x86, 0x71, 0x99, 0x14, 0x01, 0xD4, 0xA6, 0x27, 0x31, 0x94, 0x76, 0xB5, 0xBD, 0x4E, 0x68, 0x9E,
-    0x0E, 0xDB, 0x4B, 0x9B, 0x98, 0x27, 0x66, 0x5F, 0x04, 0xD2, 0x25, 0x8C, 0x81, 0xC9, 0x4D, 0x83,
-    0x2F, 0xC7, 0x24, 0x3F, 0xA7, 0xC9, 0x25, 0x6E, 0x29, 0x99, 0xFC, 0x93, 0x61, 0x92, 0x52, 0xDC,
-    0xCA, 0xA4, 0xB7, 0xA3, 0x8F, 0x35, 0xA3, 0x45, 0x30, 0x68, 0x3B, 0x80, 0xB2, 0x33, 0xFD, 0x1E,
-    0xCF, 0xCF, 0x7C, 0xE7, 0x0D, 0xE9, 0xEF, 0xDB, 0x17, 0x7D, 0x0B, 0x4D, 0x35, 0x28, 0x38, 0x3F,
-    0x41, 0xC9, 0x9C, 0xE0, 0xD3, 0x1D, 0x1B, 0x46, 0xB3, 0x9A, 0xCA, 0x55, 0x72, 0x53, 0x7E, 0x1B,
-    0xF0, 0x64, 0x1C, 0x3B, 0xD0, 0x12, 0x5D, 0xE5, 0xEE, 0xDD, 0x5A, 0x9D, 0x6A, 0x3A, 0x2D, 0xFA,
-    0xA7, 0x0E, 0xC7, 0x94, 0xDE, 0x36, 0x23, 0xDA, 0x9D, 0xA3, 0xF7, 0x32, 0x29, 0xA6, 0x25, 0x30,
-    0x28, 0x49, 0x7D, 0xC8, 0x8C, 0x2A, 0x50, 0xEE, 0x02, 0x06, 0x8F, 0x00, 0xE7, 0x54, 0xD8, 0x17,
-    0x09, 0x34, 0x68, 0xAC, 0x68, 0xF9, 0xC1, 0x99, 0x91, 0x0F, 0x22, 0x30, 0x7D, 0xE8, 0x20, 0x03,
-    0x2B, 0x31, 0x8C, 0x09, 0x66, 0x57, 0x87, 0xCB, 0x47, 0x27, 0xF0, 0xD0, 0xD9, 0xD3, 0xB6, 0x73,
-    0xEF, 0x07, 0xCF, 0xDE, 0xD2, 0x9A, 0x4B, 0xD1, 0xAB, 0xBD, 0x5B, 0x8F, 0x67, 0x9F, 0xDE, 0xA7,
-    0x11, 0xE2, 0x4E, 0x61, 0xB9, 0x90, 0x46, 0x52, 0xDE, 0x73, 0x9E, 0xEC, 0xFB, 0x40, 0x26, 0x50,
-    0xC2, 0x52, 0xC5, 0xBE, 0x84, 0xFD, 0x34, 0x9C, 0xB5, 0x39, 0xCD, 0x1F, 0x9A, 0x91, 0x1D, 0xF9,
-    0x55, 0xAE, 0x62, 0x26, 0x5E, 0xEF, 0x97, 0x81, 0xFD, 0x8A, 0xE6, 0x51, 0x11, 0xC1, 0x72, 0xDD,
-    0x52, 0xCF, 0x8E, 0x81, 0x67, 0x98, 0x1C, 0x29, 0xFC, 0xAD, 0x47, 0x95, 0x9C, 0xBE, 0x5B, 0xDC,
-    0x99, 0x2F, 0x0C, 0x7C, 0x4A, 0xDB, 0x25, 0xF6, 0xDB, 0x2E, 0xB4, 0xD7, 0x3B, 0x69, 0xE6, 0xD5,
-    0xC5, 0x25, 0xEA, 0xE9, 0x7A, 0x84, 0xF9, 0x7C, 0xF7, 0x49, 0x90, 0x39, 0x5B, 0x2C, 0xC8, 0xEC,
-    0x94, 0x65, 0x3A, 0x94, 0xB5, 0x11, 0xF2, 0x24, 0x2F, 0xDC, 0x28, 0xA6, 0x11, 0x6E, 0x37, 0xCA,
-    0x09, 0x9C, 0x48, 0xA4, 0xF4, 0xEE, 0x13, 0x99, 0x4F, 0x66, 0x30, 0xC2, 0x22, 0x84, 0xA9, 0x22,
-    0xDE, 0xA5, 0x93, 0xDE, 0xE3, 0xBA, 0xDB, 0x08, 0xC1, 0x62, 0x8C, 0x46, 0x94, 0x6D, 0x09, 0x53,
-    0xF6, 0x3F, 0x8F, 0x26, 0x90, 0x7F, 0xE5, 0x78, 0xF4, 0x94, 0xCE, 0x3C, 0xED, 0xA5, 0x4C, 0x5B,
-    0x82, 0x5A, 0x68, 0xC0, 0xD5, 0xFA, 0x35, 0x57, 0x86, 0xD6, 0x5D, 0xF3, 0xD4, 0xE6, 0x58, 0xB0,
-    0xF3, 0x02, 0x55, 0xCA, 0x07, 0x9C, 0x73, 0xD8, 0xA7, 0xB3, 0x0E, 0x8A, 0x3A, 0xA8, 0xAE, 0x91,
-    0xCD, 0x4F, 0x66, 0xCE, 0xD5, 0x7C, 0x27, 0x85, 0xDF, 0x27, 0x1A, 0x3B, 0xFA, 0x88, 0x51, 0xA4,
-    0x5A, 0x6D, 0x6F, 0x70, 0xCE, 0x4F, 0x89, 0x1A, 0xBA, 0x0D, 0xE7, 0xE8, 0x31, 0xF0, 0x00, 0x3E,
-    0x73, 0xAC, 0x63, 0x1A, 0x26, 0xF9, 0xB7, 0x72, 0x87, 0xF0, 0x55, 0xD0, 0x6E, 0x80, 0x1E, 0x1E,
-    0xF1, 0x8F, 0xD6, 0x8F, 0xF8, 0x77, 0xAB, 0x23, 0xFE, 0x53, 0xC4, 0xD1, 0x1F, 0xBD, 0x1A, 0xF7,
-    0x7B, 0x07, 0x06, 0x26, 0x1B, 0x37, 0xAF, 0x2F, 0xB8, 0xA4, 0xE5, 0xDE, 0xDA, 0x11, 0x16, 0x8A,
-    0x73, 0xDA, 0xCA, 0xB0, 0x38, 0x72, 0x8F, 0xE7, 0xA4, 0x25, 0xED, 0x55, 0xCC, 0xA0, 0x9D, 0xE1,
-    0x2B, 0xF0, 0x84, 0xAA, 0x86, 0xC7, 0x59, 0x42, 0x17, 0x24, 0x70, 0x46, 0x79, 0xA6, 0x36, 0xAE,
-    0xC3, 0xBB, 0x35, 0xFC, 0xCB, 0xA8, 0x8E, 0xBE, 0xAA, 0x61, 0x6D, 0x47, 0x4D, 0xF4, 0x49, 0x03,
-    0xAF, 0x29, 0x6C, 0xE3, 0x9B, 0x2D, 0x2C, 0xBE, 0xA0, 0x4B, 0x6E, 0x74, 0x09, 0x7D, 0x1C, 0x7D,
-    0xBD, 0x83, 0x25, 0x8E, 0xCF, 0xD7, 0x7B, 0x5D, 0xC8, 0x21, 0x31, 0x4C, 0xB3, 0xF2, 0x06, 0xA3,
-    0xAC, 0xB8, 0x3F, 0xB0, 0x88, 0x4C, 0x2A, 0x19, 0xCC, 0x8C, 0xFA, 0xDE, 0x74, 0x92, 0x55, 0x64,
-    0xD4, 0x52, 0x0F, 0xEE, 0xD7, 0x0B, 0x89, 0x44, 0x3D, 0x1A, 0xC7, 0xBF, 0xC9, 0x20, 0x88, 0xFA,
-    0x31, 0xC9, 0xEC, 0x96, 0x88, 0x1C, 0xC2, 0xF1, 0x5B, 0xC9, 0xC9, 0x61, 0x7B, 0xEF, 0xAE, 0x08,
-    0x93, 0xB4, 0x15, 0x2C, 0x3C, 0x3C, 0x60, 0x53, 0x8D, 0x39, 0x03, 0x95, 0x49, 0xA5, 0xAD, 0x07,
-    0xF3, 0xBD, 0xD6, 0x19, 0x68, 0x83, 0x33, 0xAE, 0x41, 0x5A, 0xD4, 0xBC, 0xA7, 0x5F, 0x82, 0x46,
-    0x6C, 0xFB, 0xE4, 0x02, 0x7C, 0xF7, 0xAE, 0x8B, 0x3F, 0x6C, 0x30, 0xEE, 0x2E, 0xFA, 0xB0, 0x56,
-    0x7E, 0xDF, 0x45, 0x9F, 0xC2, 0x76, 0x1D, 0xDA, 0xF0, 0x36, 0xDD, 0x0A, 0x39, 0x0E, 0xA0, 0x18,
-    0xED, 0x67, 0xFE, 0xA2, 0x96, 0x5F, 0x18, 0x64, 0xD5, 0x6C, 0x79, 0x0C, 0x7B, 0xED, 0xF8, 0xCD,
-    0xDB, 0x3C, 0x7E, 0xC3, 0xE3, 0xDA, 0xCB, 0xE3, 0x37, 0x58, 0x4A, 0x49, 0x9D, 0xD1, 0x43, 0xC4,
-    0x2A, 0x82, 0x5B, 0xD6, 0x70, 0x45, 0x74, 0x4C, 0x7F, 0xF7, 0x72, 0x66, 0x98, 0x02, 0xC8, 0xBE,
-    0xC2, 0x5C, 0xDC, 0xED, 0xE9, 0x80, 0x77, 0xEC, 0x7E, 0xC2, 0xA0, 0x9C, 0x77, 0xB3, 0x3A, 0x78,
-    0xFC, 0x08, 0x90, 0xE3, 0x46, 0xC2, 0x36, 0xE1, 0x2D, 0x19, 0xEF, 0xB7, 0xF0, 0x3C, 0xBD, 0x74,
-    0x8A, 0x8A, 0xD3, 0xCF, 0x06, 0x73, 0x30, 0xE3, 0xBA, 0xC4, 0x08, 0x92, 0x5A, 0xF8, 0x11, 0x90,
-    0x1B, 0x21, 0x99, 0x80, 0x29, 0xF5, 0x3B, 0xCC, 0xE7, 0x4C, 0x8E, 0x78, 0xB3, 0x01, 0x37, 0x6D,
-    0x19, 0xE7, 0x4C, 0x98, 0xCF, 0x80, 0x97, 0xCB, 0x66, 0x38, 0x68, 0xC6, 0xD4, 0xB3, 0x38, 0x81,
-    0xCF, 0x73, 0xF0, 0x62, 0xCC, 0xB9, 0xC9, 0xE4, 0xFA, 0x54, 0xE7, 0xF9, 0x43, 0x18, 0xCB, 0xA9,
-    0x12, 0x38, 0xEF, 0x57, 0xEB, 0x0B, 0xF1, 0xD4, 0x98, 0xE3, 0x1C, 0x02, 0x53, 0x8E, 0xBF, 0x92,
-    0x10, 0x0B, 0x4D, 0xD2, 0xB9, 0xCB, 0x98, 0x9A, 0xE6, 0xD6, 0xBE, 0x07, 0x86, 0x7B, 0x32, 0x37,
-    0xE2, 0xE6, 0x72, 0x04, 0x32, 0xF1, 0x41, 0x3F, 0xD9, 0x57, 0x2E, 0xAD, 0x33, 0xE6, 0xB1, 0xDC,
-    0x4F, 0x80, 0x56, 0x37, 0xF5, 0x9D, 0xC5, 0x62, 0x65, 0xEB, 0x39, 0x10, 0x47, 0xC1, 0xE3, 0xEF,
-    0x60, 0xFA, 0xD1, 0x77, 0x5D, 0xFD, 0x0E, 0x86, 0xE7, 0xBA, 0xA6, 0xB2, 0x33, 0x47, 0x6F, 0xEC,
-    0x8C, 0xCD, 0x45, 0xA3, 0x5A, 0x00, 0xC7, 0xE8, 0x36, 0x48, 0x0A, 0x87, 0x72, 0xE0, 0x60, 0x9E,
-    0x6A, 0xFA, 0x36, 0x63, 0x71, 0xAD, 0x04, 0xED, 0xA4, 0xD9, 0x04, 0xFC, 0x66, 0x3D, 0x5A, 0x75,
-    0x8A, 0x74, 0x8E, 0x19, 0xEA, 0x29, 0x48, 0x90, 0xAC, 0x22, 0x2F, 0xC7, 0xA5, 0x73, 0x72, 0x21,
-    0xDA, 0x87, 0xBB, 0x10, 0xA7, 0x46, 0x27, 0xFD, 0xCF, 0xA8, 0x8A, 0xCB, 0xA0, 0x35, 0xDF, 0xF1,
-    0x3F, 0x8F, 0x3D, 0x9F, 0xDB, 0x14, 0xE9, 0xDA, 0x96, 0x19, 0xFC, 0xCF, 0x32, 0x35, 0xCC, 0xD1,
-    0x3F, 0xF6, 0xFB, 0xFF, 0xD5, 0x5B, 0x3D, 0x93, 0xDC, 0xC6, 0x11, 0x1D, 0x2C, 0xB4, 0xDA, 0x32,
-    0x11, 0x2C, 0x83, 0xBB, 0x2A, 0x97, 0x68, 0x17, 0x1C, 0xCA, 0x0E, 0x8C, 0x5F, 0x20, 0x0E, 0x18,
-    0xB8, 0x1C, 0x28, 0xF0, 0x05, 0xB7, 0xE5, 0xC0, 0x81, 0x7E, 0x80, 0x83, 0x8B, 0x5D, 0x65, 0x0B,
-    0x30, 0x19, 0x38, 0xF4, 0x25, 0xCA, 0x19, 0xC8, 0x55, 0xF4, 0x2A, 0xA0, 0x03, 0x07, 0x0E, 0x6C,
-    0x0E, 0x28, 0x06, 0x0A, 0x14, 0x18, 0x14, 0xCB, 0xB1, 0x56, 0x16, 0x65, 0x5B, 0xA7, 0xC0, 0x90,
-    0x04, 0x49, 0x38, 0x12, 0xC0, 0xF8, 0xBD, 0x9E, 0xC1, 0x2E, 0xEE, 0x48, 0x1D, 0x3F, 0x74, 0x14,
-    0xCF, 0xAB, 0x9B, 0x6E, 0x70, 0x17, 0x98, 0x99, 0xEE, 0x99, 0xE9, 0x7E, 0xDD, 0x0D, 0x29, 0x35,
-    0x7C, 0x26, 0x56, 0x45, 0xB6, 0x09, 0x7B, 0x65, 0xAC, 0xBD, 0xD2, 0x4E, 0xAC, 0xB5, 0xF7, 0x9B,
-    0xC8, 0x1E, 0x58, 0x5B, 0xCD, 0x3B, 0x15, 0xDB, 0x22, 0x69, 0xD4, 0xAC, 0x57, 0xBA, 0x52, 0xA1,
-    0x55, 0x7A, 0xC5, 0xDB, 0xB3, 0x52, 0x05, 0x36, 0x5D, 0x53, 0x35, 0xBA, 0x06, 0x75, 0xF7, 0xB8,
-    0xFB, 0x93, 0x9A, 0xCF, 0xB2, 0x9F, 0x16, 0x83, 0xFC, 0xCB, 0x36, 0xF8, 0x12, 0x1D, 0x2B, 0x8E,
-    0x95, 0x2B, 0x75, 0xC1, 0x1E, 0x72, 0x06, 0xDB, 0x7E, 0x26, 0xBB, 0x68, 0x98, 0x07, 0x48, 0xA7,
-    0xB2, 0x3E, 0x6C, 0x71, 0xEF, 0xFB, 0xCD, 0x9C, 0x0F, 0x24, 0x87, 0x7B, 0x36, 0xD7, 0xAB, 0x19,
-    0xBE, 0x2F, 0x38, 0x53, 0x47, 0x30, 0x8C, 0x27, 0xF8, 0xA7, 0xFC, 0x20, 0xB7, 0xE0, 0xE6, 0x56,
-    0xE1, 0xB1, 0x9A, 0x83, 0x61, 0x7A, 0x86, 0x5D, 0x06, 0xA9, 0x1A, 0x7F, 0x02, 0x48, 0x91, 0xAB,
-    0xE4, 0x3D, 0x3E, 0xAC, 0xF4, 0x87, 0x9D, 0xB0, 0x4F, 0x5A, 0x61, 0x98, 0x9F, 0xB0, 0x5C, 0x58,
-    0xAD, 0x84, 0xAD, 0x9E, 0x82, 0x65, 0x9E, 0x95, 0x4A, 0x63, 0x1A, 0xD0, 0x88, 0x2D, 0x94, 0x4A,
-    0xFA, 0x5F, 0x50, 0x74, 0x8A, 0x45, 0x49, 0xAD, 0x6D, 0x39, 0x9F, 0x8C, 0x13, 0xC5, 0x67, 0x67,
-    0x98, 0xE0, 0xB6, 0xCC, 0x17, 0x3D, 0xE0, 0x63, 0x72, 0x9B, 0x46, 0x8D, 0x4D, 0x41, 0x7B, 0x0B,
-    0x6D, 0x47, 0x78, 0x86, 0xB4, 0x22, 0xED, 0xA8, 0xFF, 0xA8, 0x3D, 0x81, 0xE6, 0x73, 0xD2, 0x02,
-    0x4B, 0xA0, 0xCC, 0x47, 0xA6, 0xE5, 0x60, 0x1C, 0x34, 0xB1, 0x9F, 0x83, 0x46, 0xF6, 0x32, 0x27,
-    0x70, 0x7E, 0xAD, 0x99, 0x69, 0x1A, 0xB8, 0x49, 0x44, 0xD5, 0x7C, 0x25, 0x17, 0x61, 0x07, 0x55,
-    0xC9, 0x47, 0xA6, 0xCC, 0x8F, 0x6E, 0x87, 0xBB, 0x77, 0x36, 0x3A, 0xCD, 0xEC, 0xC7, 0xB2, 0xB0,
-    0xAD, 0xA1, 0xDA, 0xFD, 0x45, 0x33, 0x5C, 0xF4, 0xEE, 0xA2, 0x88, 0x2C, 0x24, 0x4B, 0x2A, 0x53,
-    0x04, 0xD4, 0x86, 0x5E, 0x41, 0x57, 0x86, 0x7B, 0xA8, 0xC0, 0x45, 0x26, 0x5B, 0xC7, 0x69, 0x6F,
-    0xE6, 0xD6, 0xA4, 0x52, 0xF3, 0xC6, 0x5F, 0x24, 0x95, 0xFF, 0x09, 0x0A, 0x75, 0x17, 0x6E, 0x89,
-    0xB2, 0x12, 0x3B, 0x8D, 0x17, 0xA6, 0xC0, 0x43, 0x4A, 0x7A, 0xC6, 0x43, 0x4A, 0xC6, 0xD2, 0xDC,
-    0x6C, 0x07, 0x1C, 0xFD, 0xDE, 0xF2, 0x8F, 0x32, 0x1F, 0x28, 0xBE, 0x93, 0x19, 0xBA, 0x8B, 0x43,
-    0x25, 0x17, 0x4E, 0xE9, 0x90, 0xDE, 0xC9, 0x57, 0xE8, 0x5C, 0xC4, 0x99, 0x7F, 0x2A, 0xF3, 0x2E,
-    0xB1, 0x50, 0xAD, 0x92, 0xC7, 0x15, 0xB7, 0x07, 0xC5, 0xE1, 0x12, 0x79, 0x71, 0xFC, 0xA0, 0xD0,
-    0x6B, 0x2E, 0xE2, 0xF8, 0x8B, 0x6C, 0xE5, 0x2F, 0xF4, 0x6A, 0xFB, 0xE7, 0xD6, 0x4B, 0x11, 0x1E,
-    0x93, 0x6B, 0x35, 0x92, 0xAB, 0x70, 0xE2, 0x60, 0xE1, 0x9C, 0x38, 0x3C, 0x0C, 0xD2, 0x33, 0xD7,
-    0x51, 0xC6, 0x8A, 0x6B, 0x2F, 0x8E, 0xFE, 0x62, 0x91, 0x0E, 0xEA, 0x2D, 0x06, 0x71, 0x8A, 0x41,
-    0x1C, 0xD9, 0x36, 0x58, 0xC7, 0x5D, 0xAE, 0xDE, 0xA4, 0x0D, 0x1B, 0x39, 0x53, 0xF6, 0xB5, 0x4A,
-    0xB8, 0xE6, 0xEF, 0xE0, 0x73, 0xEB, 0xCE, 0x5A, 0xB0, 0xEB, 0xB8, 0x9C, 0x8B, 0x3B, 0xDD, 0x0C,
-    0xDD, 0x46, 0xF6, 0x2B, 0xE1, 0x31, 0x54, 0x43, 0xAE, 0x0F, 0xF7, 0xBA, 0x60, 0xB1, 0x57, 0xE9,
-    0x15, 0x37, 0x9C, 0x2E, 0x71, 0xDA, 0xB8, 0xF1, 0x20, 0x1C, 0xB8, 0x3B, 0x82, 0x9D, 0x5B, 0x32,
-    0xF6, 0xDB, 0x38, 0x0E, 0x21, 0xE5, 0x3E, 0x91, 0x6E, 0xD6, 0xC1, 0x36, 0x28, 0xF6, 0x13, 0xDA,
-    0xC5, 0x2E, 0xFB, 0x8D, 0xB0, 0x1F, 0x22, 0xFB, 0xA5, 0xF0, 0x89, 0xBD, 0x2D, 0x5C, 0xBD, 0xE0,
-    0xF7, 0x12, 0x4F, 0x4A, 0x69, 0x86, 0x1D, 0xF2, 0xAC, 0xE8, 0xC1, 0x72, 0x1F, 0x14, 0xDA, 0x3B,
-    0x42, 0xE5, 0x28, 0x3A, 0xCA, 0xFB, 0xD4, 0x5B, 0xA2, 0x4F, 0x23, 0x2B, 0x2D, 0xC6, 0x44, 0x99,
-    0xBB, 0xEA, 0xF8, 0x07, 0x1B, 0xA6, 0xE0, 0xBC, 0xCD, 0x9A, 0xEA, 0xDC, 0x14, 0xEB, 0x3E, 0x94,
-    0x39, 0xF6, 0xEB, 0x53, 0x53, 0xCC, 0x39, 0x93, 0x15, 0x3F, 0x4A, 0x37, 0xE6, 0x22, 0xDB, 0x8C,
-    0xFA, 0x23, 0x99, 0xB9, 0x96, 0x99, 0x6B, 0x99, 0x39, 0xED, 0x19, 0x4F, 0x72, 0x9E, 0x14, 0xB4,
-    0xA8, 0xAE, 0xF1, 0x9A, 0xDF, 0xB1, 0xE9, 0xF2, 0x9B, 0x34, 0xA7, 0x37, 0xDF, 0x5E, 0xC2, 0xE8,
-    0x89, 0x34, 0xA5, 0xE2, 0x46, 0x65, 0xB5, 0x9A, 0xE0, 0x10, 0xE5, 0x59, 0xAB, 0x42, 0x5A, 0xDA,
-    0xAC, 0xF7, 0xDC, 0x0E, 0x3C, 0xF7, 0xBC, 0x74, 0x3C, 0xAB, 0x1C, 0x7F, 0xAD, 0x76, 0xFC, 0xD5,
-    0xD6, 0xF1, 0x2B, 0xBD, 0xE3, 0x97, 0xAD, 0xE3, 0xB9, 0xBD, 0xE5, 0x78, 0x76, 0xC7, 0x71, 0xFD,
-    0xB9, 0xE3, 0xF1, 0x97, 0x8E, 0xD3, 0x60, 0x92, 0x87, 0x9E, 0x4F, 0x3C, 0x57, 0x03, 0xCF, 0x3C,
-    0xD7, 0x9C, 0x9F, 0xB7, 0x75, 0xB9, 0x77, 0x14, 0x72, 0xBE, 0x83, 0xB7, 0xAC, 0xFF, 0x67, 0xEF,
-    0x79, 0xEB, 0x79, 0xA9, 0x1E, 0xFE, 0xB1, 0x4E, 0x5E, 0xBA, 0x45, 0x91, 0x17, 0x5C, 0xE4, 0xBD,
-    0xA1, 0x9C, 0xBC, 0xB4, 0x97, 0xB9, 0xE7, 0x94, 0x17, 0xF7, 0x8B, 0xBC, 0xB8, 0x4F, 0xE4, 0x05,
-    0x17, 0x79, 0xC1, 0x45, 0x5E, 0x70, 0x91, 0x17, 0x5C, 0xE4, 0x25, 0xA7, 0xBC, 0xE4, 0x94, 0x97,
-    0x9C, 0xF2, 0x92, 0x3B, 0x07, 0xE1, 0xE4, 0x25, 0x9F, 0x78, 0xAE, 0x06, 0x9E, 0x79, 0xAE, 0xC9,
-    0xFD, 0x7C, 0x8F, 0xF2, 0xC0, 0x9B, 0x7A, 0x2F, 0xB7, 0xF2, 0x72, 0x2B, 0x2F, 0xB7, 0x32, 0xAB,
-    0xB1, 0x37, 0x15, 0xDB, 0x11, 0xDA, 0x0D, 0x75, 0xDF, 0x0C, 0x9F, 0x1E, 0x96, 0x6B, 0xD2, 0x5B,
-    0x6D, 0x57, 0xA0, 0x70, 0xCC, 0xA0, 0x87, 0x59, 0x03, 0x5A, 0xCE, 0x5B, 0x50, 0x98, 0x37, 0xD0,
-    0x7C, 0xF6, 0xD4, 0x54, 0x60, 0xCC, 0x88, 0x0A, 0x88, 0x08, 0xAE, 0x77, 0xEB, 0x85, 0x0A, 0x6C,
-    0x2D, 0x74, 0x1F, 0x16, 0x71, 0x4A, 0x95, 0xA7, 0x06, 0x34, 0xFE, 0x90, 0x77, 0x44, 0xF2, 0xDB,
-    0xC4, 0x8A, 0x40, 0x8B, 0x0D, 0x4C, 0x08, 0xE5, 0xEC, 0x84, 0xB2, 0xC0, 0x91, 0xFC, 0x3A, 0x27,
-    0x72, 0x51, 0xF3, 0xFB, 0xBC, 0x3F, 0xF9, 0x77, 0xC3, 0xD3, 0x74, 0x47, 0x16, 0xF0, 0x16, 0xFB,
-    0x31, 0xBF, 0xB5, 0xA2, 0x3E, 0x2B, 0xCA, 0x83, 0x1A, 0x9D, 0x2B, 0x0B, 0xED, 0x12, 0x1D, 0xC1,
-    0x86, 0xA2, 0x8B, 0x48, 0xC0, 0x8F, 0x20, 0x1A, 0x05, 0x4B, 0x0E, 0x3B, 0x49, 0x3F, 0xD0, 0x7A,
-    0x77, 0x07, 0xC3, 0x8F, 0x89, 0x5B, 0x3E, 0x22, 0x5E, 0x18, 0x0E, 0xB8, 0x9A, 0x74, 0x38, 0xCD,
-    0x74, 0xBB, 0xF4, 0xB8, 0xDE, 0xD9, 0x4E, 0xB0, 0x16, 0xE8, 0x03, 0xEE, 0xC0, 0x56, 0xE1, 0x3E,
-    0xBC, 0x87, 0x9A, 0xD7, 0xD2, 0xF6, 0x6C, 0x4D, 0xD8, 0xA3, 0xED, 0xF5, 0xDA, 0x94, 0xF3, 0x1A,
-    0x5E, 0xB0, 0xB6, 0x79, 0x8C, 0xEB, 0xAC, 0xCE, 0xE4, 0xFB, 0xAF, 0xEA, 0xC8, 0x5E, 0xA9, 0x09,
-    0x32, 0xB6, 0x30, 0x02, 0x2C, 0x56, 0x3A, 0xFF, 0x0C, 0x9B, 0x12, 0x5E, 0x24, 0xA0, 0x68, 0x5E,
-    0xF8, 0xB9, 0xED, 0xD6, 0x2D, 0xB0, 0x0E, 0xCE, 0x3C, 0x71, 0x83, 0xDA, 0xC6, 0xFD, 0x9C, 0x34,
-    0x9E, 0xDA, 0x18, 0x9F, 0xA7, 0x6B, 0xCE, 0x6D, 0xD3, 0x67, 0x3B, 0x87, 0xAD, 0xC4, 0x5B, 0x2B,
-    0x71, 0xD5, 0x6B, 0x28, 0xE5, 0x30, 0x0D, 0x1D, 0xB8, 0x03, 0x9F, 0x13, 0x59, 0x05, 0x02, 0xDD,
-    0xC6, 0x03, 0xD4, 0x47, 0x02, 0xDD, 0xE0, 0x34, 0x80, 0x2E, 0x80, 0xE8, 0xCE, 0xAC, 0x8E, 0xEA,
-    0xA0, 0x87, 0x85, 0xCC, 0xB0, 0x4D, 0x12, 0x4C, 0x78, 0xBA, 0xEB, 0x4F, 0x55, 0x2F, 0x98, 0x75,
-    0x4E, 0xC8, 0xDB, 0xC4, 0x2D, 0xBD, 0x26, 0x71, 0xAD, 0x91, 0x36, 0xB1, 0xAE, 0x85, 0x3D, 0xBF,
-    0xE3, 0x6F, 0xBC, 0x87, 0x2B, 0x2E, 0x38, 0x97, 0x9E, 0x09, 0x9D, 0x8B, 0xD7, 0x9F, 0xD0, 0x72,
-    0x28, 0x43, 0x7F, 0x2F, 0xCE, 0x5E, 0x3C, 0x7D, 0xB0, 0x3B, 0x00, 0xB5, 0xDC, 0xF9, 0x56, 0x71,
-    0x83, 0x4F, 0x4D, 0x04, 0xDD, 0x42, 0x13, 0x59, 0x29, 0xC8, 0x56, 0x70, 0xAD, 0xA0, 0x5A, 0x87,
-    0x69, 0x1D, 0xA2, 0xDD, 0x71, 0x80, 0x72, 0xBE, 0x8A, 0x57, 0x61, 0x4B, 0x03, 0x84, 0x49, 0xC2,
-    0xF8, 0xA8, 0xED, 0x1D, 0x6F, 0x6C, 0x88, 0x6B, 0xA3, 0xF6, 0x91, 0x0D, 0x18, 0x96, 0x08, 0x96,
-    0xF8, 0x95, 0xE8, 0x35, 0xB1, 0x5F, 0x01, 0x3A, 0xBC, 0xDD, 0x0A, 0x6E, 0x35, 0xDC, 0xA3, 0x5E,
-    0xD9, 0x95, 0x17, 0xF1, 0x95, 0x19, 0xF7, 0x21, 0x01, 0xAC, 0x90, 0x97, 0x27, 0xF9, 0xF3, 0x10,
-    0x1D, 0xA7, 0x3E, 0x1D, 0x9A, 0x9C, 0xDC, 0xEA, 0xA2, 0x0A, 0xEB, 0x4C, 0x9A, 0xDA, 0xFF, 0xEE,
-    0xE9, 0xA9, 0x40, 0x9D, 0x7B, 0x93, 0xD6, 0x68, 0x25, 0xC1, 0x02, 0x56, 0x9A, 0x67, 0x60, 0xF2,
-    0xE6, 0x99, 0xD1, 0x83, 0x52, 0xCB, 0x5C, 0x3C, 0x0A, 0x77, 0xE5, 0x1C, 0x6B, 0x74, 0x2E, 0x7D,
-    0x76, 0xBA, 0xB8, 0x8A, 0xFF, 0xD4, 0x8D, 0x68, 0xC5, 0x08, 0x07, 0xD2, 0x46, 0xFD, 0xB0, 0xF5,
-    0xCF, 0x86, 0x2E, 0xCE, 0xE5, 0xE7, 0x72, 0x91, 0x99, 0xDF, 0x32, 0x3A, 0x99, 0x3E, 0x3B, 0x5D,
-    0x04, 0xCB, 0x35, 0x12, 0x4C, 0xB8, 0x37, 0x66, 0xE2, 0x05, 0xAF, 0x9D, 0x1D, 0x5D, 0x5C, 0xF3,
-    0x71, 0x87, 0x95, 0x98, 0x4B, 0xA9, 0x17, 0xF3, 0x67, 0x78, 0x46, 0x9C, 0xF9, 0xD7, 0x38, 0x8B,
-    0x68, 0xE5, 0x0F, 0x55, 0x46, 0xCF, 0x09, 0x7F, 0xC0, 0xE0, 0x2A, 0x6A, 0x7D, 0x98, 0xEA, 0x5A,
-    0x1E, 0xB5, 0x19, 0x62, 0x48, 0xBD, 0x4A, 0x2A, 0x44, 0x2A, 0x25, 0x3C, 0x6D, 0x1E, 0x30, 0x46,
-    0x0C, 0xA8, 0x49, 0xF1, 0x2D, 0x63, 0xEA, 0x3E, 0xF3, 0x4B, 0x34, 0x3E, 0xC9, 0xAD, 0x66, 0x4D,
-    0x5F, 0xE4, 0x4E, 0x3C, 0x0B, 0x68, 0x02, 0x6A, 0xCF, 0x7D, 0x73, 0x68, 0xB6, 0x4E, 0x54, 0xD8,
-    0xE8, 0x94, 0x4D, 0xED, 0x7C, 0xE7, 0xD4, 0x50, 0x05, 0xF4, 0x21, 0x72, 0x3C, 0xA0, 0x1B, 0xF5,
-    0x1B, 0x8F, 0x89, 0x65, 0x3F, 0x0A, 0x7D, 0x59, 0x9D, 0x0D, 0xDD, 0xB8, 0x09, 0x38, 0xFD, 0x4C,
-    0x96, 0xCB, 0x54, 0xD6, 0x78, 0x8E, 0xA9, 0xF0, 0x5C, 0x90, 0x07, 0xEA, 0xF4, 0xF4, 0xA3, 0xCE,
-    0x2D, 0xFF, 0xE8, 0x20, 0x56, 0x3F, 0x62, 0xD3, 0xC5, 0xEE, 0x08, 0x2C, 0x27, 0x0E, 0x38, 0x64,
-    0x6B, 0xFC, 0x40, 0x66, 0x85, 0x4D, 0xFA, 0x98, 0x7A, 0x09, 0x5B, 0x61, 0x51, 0x23, 0x6C, 0x5E,
-    0x0B, 0x8B, 0xAB, 0xF8, 0xDE, 0x72, 0x1F, 0x61, 0x57, 0x4C, 0xF9, 0xB3, 0x42, 0x98, 0xC9, 0x85,
-    0xD9, 0x03, 0x53, 0x29, 0x8F, 0x78, 0x06, 0x60, 0xE2, 0x34, 0x44, 0x01, 0xF8, 0x38, 0x1A, 0x1E,
-    0xBF, 0x0A, 0xF5, 0xE0, 0x81, 0x0A, 0xE7, 0x97, 0x0C, 0xE6, 0x33, 0x96, 0x9B, 0x96, 0xE8, 0x58,
-    0xD2, 0x3F, 0xE5, 0x88, 0x2D, 0x46, 0x58, 0x79, 0xC2, 0x68, 0x3E, 0xA7, 0x7E, 0x0C, 0xD0, 0x34,
-    0xBB, 0xC6, 0x69, 0x09, 0xF3, 0xA4, 0x9F, 0x50, 0xC1, 0xD0, 0xBE, 0xB0, 0x5A, 0x99, 0x34, 0xB8,
-    0xCE, 0x1F, 0x53, 0xAE, 0x0C, 0x14, 0xAE, 0x7B, 0xFE, 0x33, 0xA7, 0xDE, 0xC4, 0x50, 0x09, 0x43,
-    0x3C, 0xDA, 0xCA, 0xBF, 0x10, 0x28, 0xBD, 0x04, 0x3D, 0xF4, 0xCC, 0xB6, 0x68, 0xDB, 0xE0, 0x0A,
-    0x5D, 0x97, 0x82, 0xE1, 0xCE, 0x13, 0xC2, 0xAE, 0x07, 0xEF, 0x53, 0x6A, 0x6D, 0x25, 0x99, 0x8F,
-    0xD0, 0xDE, 0x43, 0x3F, 0x36, 0x0D, 0xD2, 0x58, 0x76, 0x21, 0x75, 0xA3, 0x85, 0x94, 0xD3, 0x05,
-    0x90, 0x5B, 0x0C, 0xF1, 0xD6, 0x04, 0x10, 0x2C, 0xA9, 0xF4, 0xEA, 0x9C, 0x39, 0xD4, 0x15, 0x16,
-    0x23, 0x21, 0x99, 0xB7, 0xD3, 0x3D, 0xAC, 0x58, 0x9E, 0x54, 0x4E, 0x53, 0x86, 0xE4, 0x02, 0xC7,
-    0x58, 0x27, 0x2A, 0x03, 0x7B, 0xBB, 0xC3, 0x54, 0xEE, 0x31, 0x3F, 0x0A, 0x41, 0x99, 0xD4, 0x50,
-    0x19, 0x33, 0x23, 0xC6, 0xA5, 0x3B, 0x1E, 0x24, 0x19, 0x13, 0x93, 0x72, 0x9F, 0x3C, 0xC1, 0xF4,
-    0x8A, 0x0A, 0xCC, 0x95, 0xCE, 0x27, 0x5E, 0xB8, 0xB1, 0x1C, 0x39, 0x77, 0xBD, 0x4F, 0x7F, 0x9C,
-    0x02, 0x8A, 0x26, 0x1C, 0x36, 0xE1, 0x57, 0x2F, 0x0A, 0x78, 0x24, 0x82, 0x66, 0x92, 0x21, 0x55,
-    0xC4, 0xD0, 0x02, 0xA2, 0x1D, 0x8A, 0xDE, 0xC4, 0x2C, 0x8F, 0xAD, 0x08, 0x9E, 0xA4, 0xF2, 0xA5,
-    0xE5, 0xD5, 0xB1, 0x22, 0x48, 0x98, 0x8B, 0x92, 0x44, 0x1B, 0xE0, 0x6C, 0xC2, 0xF4, 0x6F, 0x52,
-    0x45, 0xF6, 0x23, 0xF3, 0x50, 0x45, 0x4C, 0x1D, 0x8E, 0xAD, 0x80, 0x63, 0x0B, 0xC9, 0x8D, 0xE8,
-    0x6E, 0x8D, 0x63, 0x03, 0xC9, 0xE6, 0xDC, 0xEB, 0x28, 0x2B, 0x85, 0x66, 0xD6, 0x88, 0x99, 0x20,
-    0x73, 0xAC, 0xF1, 0x3B, 0xE2, 0x58, 0xDD, 0xC4, 0x9D, 0xCB, 0x08, 0xDD, 0xEF, 0x26, 0xF6, 0x4E,
-    0xA7, 0x5E, 0xA0, 0x52, 0x66, 0xED, 0x79, 0x1C, 0xD9, 0xE4, 0x0F, 0xA6, 0xA1, 0x2E, 0xA8, 0x0A,
-    0x6A, 0x02, 0x10, 0x77, 0x17, 0xC6, 0x8B, 0xAE, 0xCC, 0xD2, 0xA9, 0x31, 0x4F, 0x0B, 0xA5, 0xAA,
-    0x0D, 0x88, 0x76, 0x79, 0xB4, 0x0C, 0x58, 0x39, 0xCD, 0x0A, 0x49, 0x19, 0x33, 0xF9, 0x50, 0x48,
-    0x36, 0x0A, 0xEA, 0xCC, 0xDE, 0xC6, 0x64, 0xB3, 0x77, 0x08, 0x44, 0xFF, 0xDE, 0xF0, 0x9C, 0xC9,
-    0x61, 0x93, 0x2B, 0x0C, 0x9A, 0xDD, 0x47, 0x57, 0xD9, 0x6D, 0x74, 0x9A, 0x15, 0xA6, 0x1C, 0x1E,
-    0x93, 0x0E, 0x60, 0x3E, 0x30, 0x61, 0x44, 0x05, 0xAE, 0x67, 0xD8, 0x8F, 0x2D, 0x17, 0x78, 0x70,
-    0x51, 0xDC, 0xAA, 0xC0, 0xFA, 0x34, 0x6A, 0x58, 0x97, 0x71, 0x30, 0xE9, 0xD3, 0x0A, 0x8F, 0xA2,
-    0x4C, 0xAE, 0x99, 0x3C, 0x61, 0x92, 0x2F, 0x67, 0x66, 0x1D, 0x96, 0x0E, 0xBF, 0x98, 0xDF, 0xB1,
-    0x6B, 0xF3, 0x7B, 0x89, 0x5D, 0x78, 0x92, 0x3D, 0xD0, 0x35, 0x3E, 0x9A, 0x11, 0x9B, 0x78, 0xC7,
-    0xBA, 0x4C, 0x71, 0xBE, 0x7E, 0x36, 0xE7, 0x92, 0x1B, 0xC9, 0xFE, 0x9A, 0x7C, 0xD6, 0x9F, 0x91,
-    0x18, 0x48, 0x8B, 0x52, 0xFE, 0x26, 0x53, 0x11, 0x07, 0x11, 0x38, 0x37, 0xE1, 0x8C, 0x8A, 0x11,
-    0x7A, 0x21, 0x57, 0xA7, 0x13, 0x0F, 0xCD, 0x68, 0xC3, 0xD1, 0x59, 0xE2, 0x07, 0x66, 0x14, 0xCD,
-    0xD3, 0x30, 0xF9, 0x0F, 0x4D, 0xF1, 0x35, 0x1F, 0xEC, 0x0E, 0x74, 0x6C, 0x87, 0x9F, 0xB3, 0x96,
-    0x92, 0x74, 0xE3, 0x35, 0xDB, 0x11, 0x75, 0x59, 0x0A, 0x97, 0x7C, 0xB9, 0xB0, 0x4F, 0x84, 0xB7,
-    0xCC, 0x31, 0xBF, 0x82, 0x6D, 0x6D, 0x91, 0x4F, 0x45, 0x6B, 0x85, 0x9B, 0x04, 0xB5, 0x46, 0x73,
-    0xCC, 0x5D, 0x34, 0xB9, 0x26, 0xD1, 0xAB, 0x62, 0xF8, 0xAA, 0x24, 0x7E, 0x95, 0x00, 0x56, 0x22,
-    0xD8, 0xCD, 0xE9, 0x8B, 0x89, 0xF1, 0x8E, 0x90, 0xC6, 0x4F, 0x79, 0x22, 0x78, 0x9C, 0x9A, 0x4E,
-    0xEA, 0x41, 0x0A, 0x41, 0x24, 0xAC, 0xD5, 0x28, 0x57, 0x09, 0xB9, 0xD0, 0xBB, 0x92, 0x94, 0xCF,
-    0x40, 0x81, 0x9C, 0xA7, 0xD6, 0x2E, 0xEE, 0xEC, 0xD1, 0x07, 0xE0, 0x16, 0xBD, 0xB1, 0x42, 0xD3,
-    0xF4, 0x21, 0x66, 0x68, 0x14, 0x4E, 0x27, 0x02, 0x01, 0x5D, 0x9B, 0x2E, 0xF6, 0x1A, 0xE5, 0x97,
-    0x89, 0x10, 0x40, 0xA6, 0x20, 0x85, 0x87, 0xDE, 0x79, 0x34, 0x99, 0x03, 0x25, 0xE5, 0x8F, 0x4C,
-    0x20, 0x71, 0x12, 0x6C, 0x61, 0xFF, 0x03, 0x4C, 0x5A, 0x2F, 0x4D, 0xCB, 0xA1, 0xB5, 0x37, 0x43,
-    0xE3, 0x84, 0xC6, 0xEC, 0x81, 0x84, 0x46, 0xFA, 0xCD, 0x93, 0x1A, 0xD2, 0x52, 0xF5, 0x4B, 0xD6,
-    0x02, 0x58, 0xDE, 0xA0, 0x6D, 0x5A, 0xFD, 0x9F, 0x17, 0x59, 0x64, 0xF2, 0xCA, 0x9D, 0xAB, 0x72,
-    0xB8, 0x68, 0x86, 0x0B, 0x67, 0xA1, 0xCE, 0x74, 0x49, 0xC5, 0xE3, 0xD5, 0xEE, 0x49, 0xF8, 0x59,
-    0x29, 0xA9, 0x60, 0x26, 0x0B, 0xE5, 0xCF, 0x9F, 0x20, 0x46, 0x06, 0x5C, 0xAA, 0x3F, 0x52, 0x75,
-    0xFC, 0x56, 0x11, 0x84, 0xCB, 0x02, 0x99, 0x72, 0x93, 0x19, 0xC0, 0xFE, 0x9E, 0xAA, 0x67, 0x8E,
-    0x20, 0xE8, 0xBA, 0x1D, 0x4A, 0xE0, 0x46, 0xFB, 0x7A, 0x16, 0x57, 0xC7, 0xD8, 0xC1, 0x52, 0x18,
-    0xF1, 0xEB, 0x03, 0xEC, 0xA1, 0x0F, 0x6C, 0x58, 0xAE, 0xC9, 0x10, 0x97, 0x32, 0x36, 0xC6, 0x33,
-    0x80, 0x27, 0xD4, 0x33, 0x61, 0xC4, 0xCC, 0x9F, 0x80, 0xE9, 0x80, 0x5E, 0x68, 0x26, 0xB3, 0x9F,
-    0xC1, 0x1C, 0x65, 0x06, 0xAB, 0x97, 0xD9, 0xEB, 0xBD, 0xCA, 0x1A, 0xE2, 0x8E, 0x4A, 0x1C, 0x0D,
-    0x4B, 0xD7, 0xEC, 0x38, 0x2B, 0xE4, 0x2A, 0x70, 0x80, 0xC4, 0xD5, 0xBF, 0x33, 0x6E, 0xEB, 0x8C,
-    0xA5, 0xDE, 0xAC, 0x40, 0x78, 0x0B, 0xA8, 0x03, 0x08, 0xF3, 0x3E, 0xFB, 0x13, 0x6C, 0x43, 0x13,
-    0x27, 0x16, 0x3B, 0xBB, 0x3B, 0xD4, 0x89, 0x4E, 0x26, 0x2E, 0x4F, 0x47, 0xDB, 0xEF, 0x72, 0xEA,
-    0x00, 0xF0, 0xDC, 0x08, 0xC5, 0xA8, 0xA0, 0x2E, 0x55, 0x0E, 0x29, 0x71, 0x48, 0x7D, 0x43, 0x8A,
-    0x1B, 0x52, 0xD9, 0x90, 0xB2, 0x86, 0xD4, 0x34, 0xA4, 0xA0, 0x21, 0xD5, 0x0C, 0x29, 0x65, 0x48,
-    0x1D, 0x43, 0x8A, 0x18, 0x52, 0xC1, 0x90, 0xF2, 0x85, 0xD4, 0x2E, 0xA4, 0x70, 0x21, 0x55, 0x0B,
-    0x29, 0x59, 0x48, 0xBD, 0x42, 0x8A, 0x15, 0x52, 0xA9, 0xE0, 0xEE, 0x0D, 0x68, 0x15, 0x09, 0x6E,
-    0x98, 0x44, 0x9A, 0xB4, 0xFE, 0x9D, 0x01, 0x57, 0x60, 0x60, 0x79, 0x81, 0xC5, 0x05, 0x96, 0x16,
-    0x58, 0x58, 0xE0, 0x11, 0x67, 0x79, 0xE0, 0x71, 0x9A, 0x97, 0xD1, 0x65, 0x49, 0x9C, 0x90, 0x6A,
-    0x54, 0xFE, 0x71, 0xA1, 0xE9, 0xEC, 0x96, 0xE4, 0x50, 0x2E, 0x93, 0x86, 0x9F, 0x94, 0x9B, 0xEF,
-    0x1F, 0x12, 0xB2, 0xB6, 0x9B, 0x90, 0xF5, 0xED, 0x7E, 0x13, 0xB2, 0x72, 0x73, 0x61, 0xC1, 0x00,
-    0xF7, 0xC2, 0x7E, 0x21, 0x21, 0x2B, 0xCD, 0xCC, 0x91, 0x60, 0xF5, 0x70, 0xF1, 0x5A, 0xC3, 0xA3,
-    0xE6, 0x82, 0xD5, 0xE8, 0xC1, 0x60, 0x55, 0x94, 0x20, 0x41, 0x83, 0x2F, 0x3D, 0xD1, 0x80, 0x11,
-    0xD8, 0xFC, 0xF5, 0x15, 0xA5, 0xFE, 0x72, 0x11, 0xA8, 0x01, 0xE0, 0x4A, 0x63, 0x4F, 0xBD, 0xB8,
-    0x7F, 0x62, 0xE0, 0x8A, 0x48, 0xEC, 0xE1, 0x81, 0x6B, 0xF1, 0xB0, 0xC0, 0xD5, 0x19, 0x0F, 0x6F,
-    0x3E, 0xDC, 0x98, 0x83, 0x09, 0xF1, 0x46, 0x64, 0x58, 0x8B, 0xB3, 0x1B, 0xC6, 0x0E, 0x59, 0x67,
-    0x07, 0x32, 0x7D, 0x85, 0x6B, 0xE6, 0x80, 0x95, 0x7F, 0xD7, 0x61, 0x3A, 0x92, 0xE0, 0xF9, 0x05,
-    0xB5, 0x8B, 0x4D, 0x21, 0x2D, 0x6A, 0x36, 0xFB, 0x32, 0x93, 0x7D, 0x39, 0xC4, 0xBD, 0xFB, 0x14,
-    0xFE, 0xB0, 0x11, 0xDD, 0xD6, 0xC7, 0x41, 0xAA, 0x16, 0x90, 0x6A, 0x08, 0x52, 0x03, 0x4B, 0x90,
-    0x1A, 0x7E, 0x49, 0xDB, 0x11, 0x7D, 0x40, 0x48, 0x1A, 0xDF, 0x24, 0xD5, 0x97, 0x48, 0x6F, 0x10,
-    0xA4, 0xDE, 0x66, 0x99, 0x52, 0x7F, 0x58, 0x13, 0xA4, 0xDE, 0x5F, 0x11, 0xA4, 0xDA, 0x82, 0x20,
-    0xD5, 0xA6, 0xC7, 0x40, 0x2A, 0x69, 0xAE, 0xA2, 0x4F, 0xE8, 0x13, 0x27, 0xC5, 0xF6, 0x48, 0x59,
-    0x0B, 0x07, 0x79, 0x68, 0x25, 0x28, 0x2F, 0x4D, 0x84, 0xFB, 0x19, 0x7E, 0xB7, 0xA7, 0xF9, 0xAF,
-    0x04, 0x8E, 0xE2, 0x6C, 0xEA, 0x95, 0x6E, 0x11, 0x5B, 0x75, 0xE6, 0xA6, 0xED, 0xCD, 0xAD, 0xCF,
-    0x7A, 0xF3, 0xEE, 0x7B, 0xBD, 0x79, 0xFF, 0x56, 0x9F, 0x59, 0x98, 0xF2, 0x6E, 0xD6, 0x26, 0x5D,
-    0x42, 0x38, 0xCA, 0xFB, 0xB1, 0x09, 0x80, 0xAE, 0xBC, 0xA5, 0x09, 0x76, 0x16, 0xB2, 0x5C, 0x92,
-    0xE0, 0xEE, 0xC4, 0x06, 0x65, 0xCC, 0xF2, 0xAA, 0xF8, 0xB2, 0xA4, 0x35, 0xD3, 0x9D, 0xB3, 0x91,
-    0x50, 0x5A, 0x4C, 0x77, 0x10, 0xAB, 0x55, 0x92, 0x03, 0x8C, 0x56, 0x70, 0xE5, 0xB5, 0x86, 0x87,
-    0x9D, 0x9E, 0x62, 0x12, 0x49, 0xB6, 0x87, 0xB3, 0x3A, 0xB1, 0x4B, 0xB8, 0x1D, 0x74, 0x12, 0x2D,
-    0x5C, 0x94, 0xED, 0xB1, 0x75, 0x46, 0x12, 0x6B, 0x2C, 0x57, 0x1A, 0x42, 0x19, 0x9B, 0xCE, 0xEE,
-    0x5D, 0x2F, 0xA2, 0x62, 0x56, 0x4C, 0xBD, 0xDB, 0x38, 0x0D, 0x3D, 0x9C, 0xA4, 0x67, 0x9A, 0x8B,
-    0x51, 0x2B, 0xBD, 0x6D, 0xD8, 0xB4, 0x7B, 0x4B, 0x9A, 0x94, 0x62, 0xDD, 0x8E, 0xFF, 0xEE, 0xEE,
-    0xD9, 0x1F, 0xF7, 0x73, 0xD2, 0x78, 0x94, 0x13, 0x7B, 0xBC, 0x90, 0x3D, 0x5E, 0xC7, 0xB5, 0x2E,
-    0x67, 0xD8, 0xE3, 0xE1, 0xD1, 0xA4, 0x72, 0xE1, 0x9C, 0x2A, 0xAB, 0x34, 0x38, 0x9B, 0x7F, 0xE2,
-    0xBD, 0xA1, 0x43, 0x45, 0xA5, 0x40, 0xB0, 0x6D, 0xEA, 0x9B, 0x86, 0x06, 0xB1, 0xE1, 0x81, 0x41,
-    0xCC, 0x1A, 0xA7, 0x5B, 0xDE, 0x20, 0x11, 0xF4, 0x8E, 0x5A, 0x9A, 0xF9, 0xBE, 0xD6, 0xED, 0x60,
-    0xC9, 0x7B, 0x36, 0xED, 0xF8, 0xEF, 0xEE, 0x9E, 0x74, 0xDC, 0xCF, 0x49, 0xEB, 0x73, 0x1A, 0xF2,
-    0x6C, 0x5F, 0xDA, 0x55, 0x09, 0x36, 0xD7, 0xBC, 0xEA, 0x99, 0x6C, 0x86, 0x7F, 0x42, 0x4C, 0xB9,
-    0xE5, 0xFB, 0x77, 0xE8, 0xDA, 0xB5, 0xB8, 0x1F, 0x72, 0xF0, 0x4F, 0xD6, 0xE6, 0xDD, 0x91, 0x7E,
-    0xB6, 0x2F, 0xED, 0x28, 0xFD, 0x0E, 0xC6, 0xFB, 0x00, 0x73, 0xAF, 0x32, 0x44, 0xCC, 0x71, 0xBE,
-    0x1E, 0x8F, 0xA1, 0xCA, 0x37, 0x69, 0x0B, 0x1A, 0x69, 0x6D, 0xEB, 0x6C, 0xD9, 0xB6, 0xEA, 0xD7,
-    0x3B, 0x72, 0xC6, 0x34, 0xF7, 0x23, 0xFF, 0x66, 0x16, 0x70, 0x45, 0x3D, 0xCE, 0x5F, 0xC8, 0xDA,
-    0x83, 0x7F, 0x0A, 0xF6, 0x31, 0xA4, 0x95, 0x6B, 0x93, 0x83, 0xFE, 0xA2, 0x4A, 0xFC, 0x52, 0x63,
-    0x5D, 0x9E, 0xE4, 0x2F, 0xD8, 0xDD, 0x96, 0x40, 0x43, 0x1C, 0xB1, 0x8D, 0x79, 0xC4, 0xF5, 0x4F,
-    0xE5, 0x88, 0xDF, 0x94, 0x44, 0x54, 0xBA, 0x75, 0x96, 0x6A, 0xDF, 0xDB, 0xD8, 0x72, 0xFA, 0xDD,
-    0x46, 0xC5, 0xEF, 0xB5, 0x6A, 0x56, 0xDD, 0x50, 0x41, 0x93, 0xA4, 0x6A, 0x6B, 0x7A, 0x6A, 0xB5,
-    0x6F, 0xEF, 0x73, 0x26, 0xCE, 0xC8, 0xB9, 0x2A, 0xC4, 0x01, 0xC1, 0x89, 0x96, 0x0C, 0xD0, 0xD6,
-    0xC8, 0xBD, 0x9F, 0x01, 0x6D, 0xC8, 0x01, 0x04, 0x68, 0x0E, 0x58, 0x7D, 0xE8, 0xAF, 0x97, 0xB3,
-    0x32, 0x5C, 0x41, 0x88, 0xF4, 0xB4, 0xB4, 0xC1, 0x03, 0x21, 0x27, 0x50, 0x8E, 0xA0, 0x2B, 0xA8,
-    0xE1, 0x50, 0x60, 0xA7, 0x0C, 0xA7, 0x02, 0x76, 0xF2, 0x63, 0xE5, 0xE2, 0x3D, 0xE6, 0x48, 0x54,
-    0x72, 0xCF, 0x30, 0x62, 0x9B, 0x41, 0x0A, 0xC6, 0x1A, 0x63, 0x02, 0xB3, 0x9E, 0x7C, 0xB1, 0xD7,
-    0xF2, 0xBE, 0x9A, 0x24, 0xF7, 0x04, 0xC1, 0x1F, 0xA3, 0x3D, 0x86, 0x7C, 0x73, 0xE2, 0xD6, 0x88,
-    0x1D, 0x50, 0x0D, 0xC0, 0x1D, 0x4C, 0x40, 0xDA, 0x02, 0x44, 0x57, 0xB2, 0xF2, 0xEF, 0x60, 0xE5,
-    0xFF, 0xC9, 0x95, 0x37, 0x47, 0x56, 0x3E, 0x6C, 0x92, 0x15, 0x4C, 0xCB, 0x2A, 0xEC, 0x11, 0x31,
-    0x58, 0xB6, 0x52, 0xFC, 0x07, 0xB1, 0xC4, 0xE3, 0x34, 0xF7, 0x5E, 0x0C, 0x5F, 0x6C, 0x0D, 0xF9,
-    0xA6, 0x4C, 0x84, 0xA0, 0x55, 0xCD, 0x61, 0xCE, 0xD4, 0x74, 0x13, 0xA4, 0xD8, 0x37, 0xFD, 0x02,
-    0x48, 0x08, 0x8A, 0x70, 0x1F, 0xB0, 0x8D, 0x61, 0x92, 0x61, 0xC0, 0x34, 0x26, 0x0C, 0xB4, 0xFF,
-    0x61, 0x2A, 0xE5, 0xD3, 0x2B, 0xCC, 0x16, 0x08, 0xB9, 0x29, 0x09, 0x04, 0x49, 0x21, 0x60, 0xB5,
-    0x4D, 0x91, 0xB0, 0x83, 0x39, 0x9F, 0x98, 0xC9, 0xFB, 0xC8, 0xE2, 0x28, 0x99, 0x83, 0xA3, 0x63,
-    0x8E, 0x6D, 0x0B, 0x97, 0x0C, 0x7F, 0xEC, 0x76, 0x9C, 0xBE, 0xDC, 0xEB, 0x77, 0x7B, 0xFD, 0xDF,
-    0x4E, 0x23, 0x98, 0x95, 0x18, 0x1E, 0x5D, 0x9C, 0xF0, 0x37, 0x85, 0xE5, 0x54, 0xF1, 0x67, 0x0C,
-    0x60, 0x6B, 0x26, 0xA1, 0x5A, 0xBE, 0xD8, 0xF2, 0x3A, 0x04, 0x52, 0xD3, 0xB5, 0x40, 0xDF, 0x6A,
-    0x9D, 0x56, 0x4C, 0xEB, 0x2D, 0x98, 0xD6, 0x4F, 0x3B, 0xB7, 0x8D, 0x46, 0xA6, 0x55, 0x97, 0x93,
-    0x1E, 0xCD, 0x3E, 0xB2, 0x01, 0x57, 0x6A, 0x6C, 0x2D, 0xBE, 0xCA, 0x0D, 0x77, 0x6A, 0xE1, 0xE6,
-    0x2C, 0x0E, 0xAA, 0x91, 0xF4, 0x84, 0xD4, 0xE7, 0x63, 0x09, 0xEE, 0x08, 0x53, 0xFA, 0xB7, 0x2A,
-    0x15, 0xD4, 0xAA, 0xE1, 0xE0, 0x3B, 0xCF, 0xE5, 0x85, 0x05, 0xA6, 0x16, 0xF1, 0x0D, 0x37, 0x14,
-    0xF6, 0x53, 0x3E, 0xCF, 0xA3, 0xB5, 0x6F, 0x3C, 0xAD, 0x62, 0x34, 0x8F, 0x69, 0xE4, 0xF1, 0x89,
-    0xC6, 0x9E, 0x45, 0x64, 0xBF, 0xF6, 0xEB, 0xCC, 0xB2, 0xF0, 0x7D, 0xCD, 0x39, 0xB4, 0x11, 0xBA,
-    0xD0, 0x3D, 0xC7, 0xC6, 0x2A, 0x5D, 0xD2, 0x34, 0x11, 0x84, 0x72, 0x95, 0x09, 0xBE, 0x37, 0x6C,
-    0xE9, 0xB3, 0x55, 0x38, 0x8F, 0xF5, 0x26, 0x38, 0xA0, 0x3F, 0x90, 0x86, 0x29, 0xBF, 0xBE, 0x09,
-    0xCD, 0x98, 0xFE, 0x48, 0x04, 0x23, 0x60, 0xD3, 0xE6, 0xDF, 0x93, 0xBA, 0x83, 0xA9, 0xDD, 0x1B,
-    0xA2, 0xB1, 0x44, 0x11, 0xBD, 0x92, 0xD7, 0x35, 0x25, 0xEE, 0xB5, 0xE9, 0x9F, 0xC1, 0xD9, 0x37,
-    0x6B, 0x0C, 0xB2, 0x32, 0xA3, 0x57, 0x88, 0xA4, 0x8E, 0xDB, 0xFB, 0xCC, 0xF4, 0x8E, 0x8B, 0xF4,
-    0x84, 0xA4, 0x6B, 0xE2, 0x7C, 0xE7, 0xA9, 0x93, 0x51, 0x26, 0xAE, 0x1D, 0xDE, 0x6A, 0x88, 0xC4,
-    0xE4, 0x17, 0x7E, 0xE9, 0xA8, 0x87, 0x96, 0x95, 0x85, 0x09, 0x8D, 0x70, 0xAF, 0x2D, 0xA2, 0x8B,
-    0xFE, 0x42, 0xB7, 0x8B, 0x60, 0xEF, 0xC1, 0xBF, 0x90, 0xEB, 0xFC, 0x93, 0xD0, 0xF6, 0x7C, 0xB9,
-    0x93, 0xF6, 0x58, 0x96, 0x39, 0x29, 0x19, 0xC4, 0x40, 0x7F, 0x7A, 0xAD, 0xD5, 0xC0, 0x0C, 0xD9,
-    0x31, 0x49, 0x13, 0xEA, 0x8F, 0x60, 0x0F, 0xBF, 0xEF, 0xB2, 0x7C, 0x1B, 0x42, 0x64, 0x12, 0x50,
-    0xA7, 0x7B, 0x96, 0xBE, 0x81, 0x6B, 0x26, 0x39, 0xCE, 0xBB, 0x4C, 0x9B, 0x1E, 0xCD, 0x6C, 0x7B,
-    0x22, 0x81, 0x9E, 0x4B, 0x8B, 0xB7, 0xDE, 0x79, 0x19, 0x58, 0x92, 0x3D, 0x67, 0x7C, 0xF8, 0x8A,
-    0x06, 0x5D, 0xC6, 0x8D, 0x23, 0xFF, 0x03, 0x03, 0x5F, 0x5A, 0x84, 0x54, 0x62, 0x84, 0xE7, 0x6F,
-    0xD8, 0x62, 0xB3, 0xE2, 0xD8, 0x3E, 0x13, 0x16, 0xB8, 0x7A, 0xD9, 0x38, 0x04, 0x77, 0xC1, 0x5D,
-    0xD9, 0x52, 0xA5, 0x0B, 0x23, 0xA5, 0x66, 0x56, 0x4A, 0x2A, 0x57, 0x12, 0x4D, 0x56, 0x8A, 0xF6,
-    0xDC, 0xF9, 0x19, 0x66, 0xF9, 0x2B, 0xF7, 0xDE, 0xF8, 0x16, 0x22, 0x2C, 0xA6, 0x57, 0x32, 0xE0,
-    0x5D, 0xFC, 0xCE, 0x84, 0x0B, 0x37, 0x84, 0xCF, 0x01, 0xC8, 0x20, 0xC9, 0xEA, 0x71, 0xC8, 0xC1,
-    0xD2, 0x30, 0x63, 0x6B, 0xC7, 0xE4, 0x71, 0x9F, 0x25, 0x79, 0x8C, 0xAA, 0xA7, 0x7B, 0x53, 0xF7,
-    0xEB, 0xC9, 0xAB, 0x98, 0xB9, 0xCD, 0x5C, 0x4A, 0xB3, 0x56, 0xCC, 0x0E, 0x29, 0xA6, 0x87, 0x94,
-    0xA4, 0x80, 0x6D, 0xFE, 0x84, 0xE4, 0x7F, 0x8D, 0x55, 0xBD, 0x6F, 0x1C, 0x45, 0x14, 0xFF, 0xED,
-    0x6D, 0x2E, 0x17, 0xB2, 0xE0, 0x35, 0xE1, 0x2E, 0x20, 0x45, 0x78, 0x28, 0x28, 0x22, 0x27, 0xF6,
-    0xA6, 0x48, 0x91, 0x48, 0x7B, 0x37, 0x93, 0x8A, 0x82, 0x22, 0x87, 0xE4, 0x03, 0x89, 0x02, 0x5D,
-    0x91, 0x06, 0x0B, 0x12, 0x97, 0x0E, 0x3A, 0xDF, 0xAE, 0xC2, 0x3F, 0x70, 0x7F, 0x82, 0x1B, 0x24,
-    0xE7, 0x90, 0x90, 0x0B, 0x47, 0x72, 0x84, 0x73, 0xBB, 0x52, 0xBA, 0x50, 0x30, 0x22, 0x48, 0x29,
-    0x10, 0x68, 0x25, 0x52, 0x44, 0x72, 0xC1, 0x44, 0xDA, 0x62, 0x05, 0x73, 0x37, 0xBC, 0xD9, 0xBD,
-    0x84, 0xC4, 0x7C, 0x88, 0xF9, 0xDA, 0xF9, 0x78, 0xEF, 0xCD, 0x9B, 0xF7, 0x7E, 0xEF, 0x6D, 0x4B,
-    0x80, 0x2B, 0x78, 0x05, 0x6A, 0x33, 0x20, 0x12, 0xA8, 0x0B, 0xF4, 0xE0, 0x1A, 0x78, 0x1A, 0x2C,
-    0xB3, 0x1B, 0x4D, 0xA0, 0xDC, 0x89, 0x3D, 0x93, 0x05, 0x3F, 0xE5, 0x89, 0x33, 0x5D, 0x43, 0x8B,
-    0xF6, 0xBC, 0x8C, 0x71, 0x33, 0x89, 0xCC, 0x74, 0x9F, 0xE5, 0x5D, 0x88, 0xF5, 0xF1, 0xC8, 0x18,
-    0x45, 0xAD, 0xD7, 0xEB, 0x2E, 0x8F, 0xC7, 0x31, 0x37, 0x26, 0xB5, 0xBD, 0xD5, 0xEB, 0x89, 0x26,
-    0x5A, 0x1D, 0x74, 0xF8, 0x1F, 0x53, 0xDF, 0x14, 0xAE, 0x91, 0xA5, 0x48, 0x9E, 0x46, 0x32, 0x92,
-    0x41, 0x0C, 0x04, 0x4E, 0xCE, 0xEF, 0x6B, 0xFE, 0xA5, 0x66, 0x4E, 0x4E, 0xFB, 0x8A, 0xEB, 0x53,
-    0x1A, 0xDA, 0x2B, 0x7C, 0x79, 0x3C, 0xAE, 0x0B, 0x9E, 0x4F, 0x74, 0xDE, 0xCE, 0xDB, 0x43, 0x1D,
-    0xE4, 0x8E, 0x70, 0xD6, 0x5A, 0xA2, 0xA1, 0x93, 0xD8, 0x7F, 0x3A, 0x43, 0x70, 0xBF, 0xC0, 0xD0,
-    0x23, 0x69, 0x75, 0xC0, 0xAA, 0x14, 0x89, 0x04, 0xC1, 0x43, 0x0D, 0xCF, 0x28, 0xD8, 0x5B, 0xD0,
-    0x23, 0xE5, 0xB7, 0xA8, 0x7C, 0xBA, 0xD6, 0xD2, 0xBC, 0xAA, 0x3B, 0xCB, 0xAD, 0x7A, 0x17, 0xFC,
-    0xBB, 0x02, 0xEC, 0x07, 0x8D, 0x86, 0x9A, 0xC0, 0x29, 0x02, 0x51, 0x8A, 0x18, 0x00, 0x06, 0xCD,
-    0x59, 0xB3, 0x7D, 0x76, 0x10, 0x5C, 0x29, 0x7C, 0xA3, 0x1A, 0x26, 0xB5, 0x9A, 0xF6, 0xD0, 0xA0,
-    0x87, 0x9B, 0x82, 0x8F, 0xF5, 0x00, 0xED, 0x26, 0x9A, 0x8D, 0xCC, 0xCF, 0x98, 0x0C, 0x52, 0x7A,
-    0x41, 0x9C, 0xC4, 0x2D, 0x32, 0x53, 0x90, 0x71, 0x5A, 0x71, 0x11, 0x61, 0x42, 0x1C, 0x89, 0x48,
-    0x62, 0xBB, 0x66, 0xA9, 0x2F, 0xBD, 0xCC, 0x11, 0x47, 0xCF, 0x5B, 0xA5, 0xC5, 0x7D, 0xB2, 0xF8,
-    0x94, 0x2C, 0x0E, 0xD4, 0xAD, 0xA6, 0x8E, 0x89, 0xDD, 0x29, 0xFC, 0x1C, 0x41, 0x5A, 0x5A, 0x17,
-    0x4E, 0x76, 0x3A, 0x4B, 0xB2, 0x0F, 0x33, 0x27, 0x83, 0x00, 0xF6, 0x70, 0x57, 0x24, 0xD9, 0xDD,
-    0xEE, 0x1E, 0x16, 0xE9, 0x2C, 0x99, 0xAD, 0x7F, 0x83, 0xA5, 0xE7, 0x15, 0xEE, 0xB4, 0x41, 0xF6,
-    0x8A, 0x54, 0x22, 0x27, 0x74, 0x5A, 0xE7, 0xF7, 0xF2, 0xFD, 0x68, 0xA9, 0x16, 0xBB, 0xA9, 0x9B,
-    0x9E, 0x7B, 0xC2, 0x35, 0xB0, 0xBC, 0xC3, 0xB5, 0x5D, 0xB9, 0xA9, 0x15, 0x6D, 0xBF, 0x5C, 0x9F,
-    0x7B, 0xE2, 0xA6, 0xB5, 0xD8, 0x9E, 0xD0, 0x65, 0x3B, 0x35, 0x5D, 0xD5, 0x86, 0x8E, 0x48, 0x50,
-    0x14, 0xDF, 0xC6, 0x6C, 0x5E, 0x8D, 0x48, 0x72, 0x9E, 0x33, 0x72, 0x0D, 0x3D, 0x59, 0x72, 0x7A,
-    0xF8, 0xCB, 0x2E, 0x3B, 0xEA, 0x22, 0x3A, 0x95, 0xF6, 0xB1, 0x9C, 0x9E, 0xDA, 0x48, 0xFD, 0xEC,
-    0xB8, 0xC6, 0xF4, 0xB4, 0x8E, 0x34, 0xCF, 0x1C, 0xF8, 0x71, 0x07, 0x07, 0x98, 0xC2, 0xA8, 0x48,
-    0x79, 0xDB, 0x95, 0x73, 0x96, 0xC7, 0x3B, 0xDC, 0xE8, 0x10, 0xE1, 0x25, 0x9C, 0xA7, 0xD6, 0x2C,
-    0xD1, 0xB1, 0x11, 0xBE, 0x76, 0x79, 0x32, 0x60, 0x87, 0x74, 0x2B, 0xF9, 0xB6, 0x5E, 0xFA, 0x96,
-    0xFD, 0x6A, 0x7D, 0x9B, 0x3F, 0xF7, 0xED, 0x8B, 0xA8, 0x8C, 0x4A, 0x54, 0x92, 0x6D, 0xB7, 0xB0,
-    0xC5, 0x0F, 0x35, 0x33, 0x79, 0xA3, 0xC2, 0xD9, 0xDF, 0xBC, 0x37, 0x47, 0xEE, 0x6C, 0x92, 0x18,
-    0x5D, 0x10, 0x72, 0x9D, 0x97, 0x90, 0xDB, 0xA3, 0x6E, 0x68, 0x3A, 0x1E, 0x8F, 0xB7, 0x69, 0x0E,
-    0x9A, 0x0B, 0x9A, 0x5B, 0xAB, 0xE1, 0xD9, 0x7A, 0x7D, 0xBE, 0xF6, 0x72, 0x1F, 0xDC, 0x24, 0xA0,
-    0x10, 0xC0, 0x01, 0x2B, 0xC8, 0x33, 0x02, 0x47, 0x91, 0xDF, 0xB3, 0xA5, 0x9B, 0x10, 0x9B, 0xC9,
-    0xAA, 0x91, 0xB8, 0xC7, 0xE3, 0x51, 0x29, 0x60, 0x03, 0x6E, 0x81, 0x40, 0x3B, 0x46, 0xFA, 0x33,
-    0xF0, 0x1C, 0x4C, 0xE0, 0x18, 0xE6, 0xC5, 0x27, 0x2B, 0xD3, 0x1A, 0x9C, 0xE6, 0x1D, 0xEA, 0xF7,
-    0xA8, 0x5B, 0x47, 0x91, 0x41, 0x6A, 0x8A, 0x5C, 0x98, 0x01, 0x0D, 0x39, 0x27, 0xB3, 0x31, 0x34,
-    0x27, 0xDB, 0xAA, 0xC8, 0x50, 0xCC, 0xC9, 0xD4, 0x5F, 0x64, 0xFE, 0x9C, 0x6C, 0x99, 0x7A, 0x57,
-    0x0F, 0xD9, 0xEA, 0x74, 0xEF, 0x5D, 0xBC, 0x55, 0x19, 0xBD, 0xDD, 0x1B, 0x90, 0x0F, 0x5A, 0xBD,
-    0x35, 0x0B, 0x2E, 0x33, 0xBB, 0xD3, 0xFB, 0x64, 0x17, 0x0B, 0xD4, 0x68, 0xBE, 0x3E, 0xBE, 0x4D,
-    0x9B, 0xE4, 0x89, 0xCB, 0xC3, 0xCF, 0xC8, 0x2B, 0x34, 0x5F, 0x14, 0x77, 0x08, 0xCF, 0x81, 0x88,
-    0xE4, 0x2E, 0x69, 0x81, 0x60, 0x3F, 0x1F, 0xAC, 0xF8, 0xD7, 0x0B, 0xFC, 0x9B, 0xBD, 0xEC, 0xBA,
-    0xC2, 0x3C, 0xE5, 0x14, 0x87, 0xB2, 0x0C, 0x8F, 0xFF, 0x39, 0xCB, 0x58, 0x9B, 0x3E, 0x66, 0x2F,
-    0xD8, 0x34, 0x07, 0x25, 0x16, 0xAC, 0x23, 0x49, 0x6F, 0xA4, 0x7E, 0xCA, 0x04, 0x59, 0xA7, 0x46,
-    0xDA, 0xB0, 0xF7, 0xA6, 0x5B, 0x36, 0x86, 0x0D, 0xF8, 0xF7, 0xCA, 0x80, 0x5D, 0x95, 0xF4, 0x6C,
-    0x92, 0x48, 0x81, 0x43, 0xB0, 0x13, 0x3C, 0xE3, 0x8A, 0x29, 0x2B, 0x2D, 0x32, 0x46, 0x0E, 0xC7,
-    0x5F, 0xCB, 0x4D, 0xD4, 0xCA, 0x7E, 0x0D, 0xCE, 0xE8, 0xBF, 0xB4, 0x7C, 0x29, 0x4F, 0x50, 0xBC,
-    0xAD, 0x67, 0xA8, 0x2A, 0x19, 0xFE, 0xEA, 0x31, 0x36, 0x0D, 0xC9, 0x48, 0x97, 0x12, 0xB5, 0x98,
-    0x09, 0xCB, 0x49, 0x2A, 0x53, 0xB8, 0x25, 0xD6, 0xE8, 0x9E, 0x0C, 0x83, 0xD9, 0x01, 0x37, 0xC5,
-    0xE6, 0x19, 0x85, 0xB3, 0xE5, 0x3E, 0xB5, 0xB3, 0x15, 0x4A, 0x42, 0x82, 0x5F, 0x18, 0xA8, 0x45,
-    0xFB, 0xBA, 0x90, 0x99, 0xA2, 0x1D, 0xA8, 0x26, 0x85, 0xC9, 0x15, 0x34, 0x6E, 0x49, 0x3A, 0xF2,
-    0x0F, 0x55, 0xED, 0x56, 0x5C, 0xEA, 0x72, 0x12, 0x41, 0x1C, 0xC4, 0x3E, 0x6C, 0x8D, 0x6C, 0xC6,
-    0x90, 0xD5, 0xB8, 0x61, 0x0F, 0x69, 0xA4, 0x4C, 0x21, 0xFB, 0x78, 0x70, 0x01, 0x23, 0x9C, 0x10,
-    0xA7, 0x68, 0xEF, 0x55, 0xB8, 0x34, 0xF6, 0xC9, 0xA1, 0xE8, 0xD3, 0xB8, 0x3D, 0x9A, 0x53, 0x92,
-    0xCB, 0x2F, 0xC8, 0x0D, 0xD2, 0x72, 0x51, 0x6E, 0xD8, 0x53, 0x69, 0x69, 0xB6, 0x81, 0x13, 0xA8,
-    0x59, 0x2E, 0xF1, 0x06, 0xF0, 0x8E, 0xF3, 0xE0, 0x22, 0xE2, 0x4A, 0x66, 0xC5, 0xF5, 0x45, 0xBC,
-    0x1C, 0x2F, 0xD3, 0x8D, 0x11, 0x05, 0x39, 0x70, 0x8D, 0x6C, 0xE9, 0x49, 0x26, 0x87, 0x24, 0xDB,
-    0x21, 0xE0, 0x44, 0x14, 0xB8, 0x03, 0x82, 0x23, 0xB3, 0xC6, 0x98, 0x08, 0x4A, 0xB2, 0xEC, 0xB0,
-    0xA0, 0x68, 0x0E, 0x87, 0x21, 0xE5, 0x4D, 0xFB, 0x5C, 0x8B, 0xDD, 0x0B, 0xB1, 0xCD, 0xE9, 0x3C,
-    0xBD, 0x29, 0xC9, 0x71, 0x23, 0x8F, 0xB8, 0x87, 0x60, 0xA9, 0x33, 0xEA, 0xD3, 0xD7, 0x93, 0x9E,
-    0x8C, 0x44, 0x9F, 0x54, 0xE9, 0x0E, 0x6B, 0xCA, 0x7B, 0x98, 0x7B, 0x8F, 0x06, 0xFC, 0xFD, 0xF3,
-    0xFD, 0x85, 0x85, 0x45, 0x92, 0x1C, 0x91, 0x64, 0x46, 0x54, 0x9B, 0xA5, 0x25, 0x28, 0xD5, 0x64,
-    0x55, 0xAA, 0x71, 0xD3, 0x37, 0x7F, 0xE4, 0xDA, 0xCB, 0x7C, 0xF5, 0x4A, 0xBF, 0x02, 0xE2, 0xCD,
-    0xC9, 0xE7, 0xBB, 0xE1, 0x02, 0xB5, 0x36, 0x65, 0x88, 0x47, 0xF9, 0x25, 0x5C, 0x44, 0x94, 0xAD,
-    0x4B, 0x27, 0x75, 0xE2, 0xA1, 0xE5, 0xBD, 0xC7, 0x2D, 0x9B, 0xF6, 0x29, 0xBB, 0xDE, 0x50, 0xAE,
-    0x0D, 0xBA, 0xD4, 0x22, 0x81, 0x96, 0xC7, 0x93, 0x59, 0x8C, 0xFF, 0x43, 0x63, 0x63, 0x74, 0xDB,
-    0xEE, 0x96, 0x30, 0x3A, 0xBA, 0xAC, 0x4A, 0xC3, 0xFC, 0x2E, 0xD0, 0x66, 0xB4, 0x3B, 0xD6, 0xFC,
-    0x37, 0xFA, 0x14, 0x03, 0xD4, 0x13, 0x23, 0x6D, 0x82, 0xB6, 0xA6, 0x68, 0xD9, 0x60, 0x3A, 0x63,
-    0x28, 0x61, 0x39, 0x96, 0x55, 0x34, 0xCC, 0x57, 0x1F, 0x9B, 0x8C, 0x3D, 0xA6, 0xCD, 0x9C, 0x93,
-    0x6B, 0x1C, 0xDD, 0x9C, 0xA3, 0xE8, 0x59, 0x71, 0xCB, 0x74, 0xF1, 0x51, 0x66, 0xC9, 0x4D, 0x91,
-    0x3C, 0xBF, 0xD0, 0x2D, 0xD1, 0xE1, 0xA0, 0x3E, 0xF2, 0x35, 0x56, 0x08, 0x86, 0x2B, 0xED, 0x2D,
-    0xF6, 0x33, 0xA9, 0x2A, 0x86, 0x4A, 0x6D, 0x9A, 0x42, 0xE1, 0x6E, 0x3F, 0x20, 0xCA, 0xDD, 0x7E,
-    0x77, 0xAF, 0x2C, 0xCE, 0x88, 0xE9, 0x70, 0x35, 0x5C, 0x0A, 0x97, 0x56, 0xB7, 0x3C, 0xCA, 0x18,
-    0xCD, 0xBA, 0x9D, 0x53, 0x5D, 0xED, 0x0C, 0xD9, 0x2F, 0xC4, 0x38, 0x0A, 0xD4, 0x80, 0x2C, 0xBD,
-    0x89, 0x4E, 0xBF, 0x8C, 0x94, 0xB7, 0xB1, 0x7A, 0xFC, 0x7A, 0x30, 0xAB, 0x78, 0x3A, 0x43, 0x9F,
-    0x84, 0x2B, 0xAA, 0x4F, 0x63, 0x93, 0xE7, 0xFB, 0x6A, 0xB3, 0xAA, 0xAF, 0x6F, 0x5F, 0xE3, 0x66,
-    0x1A, 0x76, 0x96, 0xC2, 0x15, 0xFF, 0x59, 0x5B, 0xF8, 0x20, 0xFE, 0x36, 0x3D, 0xA0, 0xDF, 0x53,
-    0x55, 0x4F, 0x82, 0x75, 0x79, 0x56, 0xFD, 0x95, 0xFC, 0xAE, 0x97, 0xD9, 0xAB, 0x11, 0x2E, 0x61,
-    0xE5, 0x3C, 0x16, 0x42, 0xF8, 0x7B, 0xF4, 0xC7, 0x85, 0x4B, 0x79, 0xB9, 0xB5, 0x12, 0xFA, 0x79,
-    0x23, 0xF3, 0xD4, 0xD2, 0x20, 0x5C, 0xFD, 0x13, 0xDD, 0x7D, 0x3D, 0x8C, 0x1D, 0x57, 0x96, 0xDE,
-    0xAD, 0xF7, 0x96, 0x7C, 0x18, 0x15, 0xB0, 0xC5, 0x40, 0x34, 0xEC, 0xA1, 0xBD, 0xB5, 0x81, 0x61,
-    0xD8, 0xF2, 0x42, 0x95, 0x38, 0x98, 0x0D, 0x46, 0x55, 0x92, 0xE0, 0x55, 0xA0, 0x40, 0x0D, 0x58,
-    0xAD, 0x01, 0xCC, 0x80, 0x93, 0x38, 0xB0, 0xC6, 0x46, 0x6F, 0xE0, 0x05, 0x1C, 0xEC, 0x6E, 0x95,
-    0xC4, 0x80, 0xC0, 0x2A, 0x20, 0x61, 0x58, 0x3B, 0x80, 0x13, 0x31, 0x60, 0x20, 0x35, 0x01, 0xF7,
-    0x04, 0x1B, 0x0C, 0x8C, 0xB1, 0x6E, 0x91, 0x04, 0xCC, 0x40, 0x81, 0xDE, 0xCC, 0x80, 0xDE, 0x50,
-    0x4F, 0xF6, 0xD0, 0xE3, 0x69, 0x05, 0xAC, 0x91, 0x4A, 0x3B, 0xD5, 0xAD, 0xAA, 0xBA, 0x3E, 0xDF,
-    0x77, 0x6E, 0xBD, 0x57, 0xAF, 0x7F, 0xC8, 0xE6, 0xF0, 0x6F, 0xD7, 0xCD, 0xBE, 0xE7, 0xBE, 0x7E,
-    0x55, 0x75, 0xEB, 0xFE, 0x9C, 0x7B, 0xFE, 0xCF, 0xE5, 0xA9, 0x0D, 0x63, 0xA2, 0xD6, 0x98, 0x89,
-    0x33, 0xC6, 0xD8, 0xCC, 0x98, 0xB8, 0x34, 0x26, 0x90, 0x5A, 0x7E, 0x72, 0xE7, 0x0A, 0x3B, 0x2E,
-    0x72, 0x69, 0xAD, 0xEC, 0x6E, 0x1B, 0xF9, 0x7E, 0x55, 0x0E, 0x5E, 0xD7, 0x7B, 0xD6, 0xDA, 0x08,
-    0x8B, 0x9F, 0x98, 0x78, 0xD1, 0x9B, 0xF8, 0x73, 0x67, 0xA2, 0x79, 0x67, 0x86, 0x9F, 0x27, 0xF1,
-    0x2E, 0x69, 0xD3, 0xB1, 0xE5, 0x03, 0xD0, 0x24, 0x95, 0x39, 0x1A, 0xFE, 0x8D, 0x2B, 0x04, 0x3A,
-    0xD7, 0x10, 0xF6, 0x80, 0x3B, 0x2E, 0x93, 0xAB, 0x81, 0x5C, 0x90, 0x7B, 0xE4, 0x2D, 0x02, 0xF3,
-    0x72, 0xF5, 0xD9, 0x01, 0xFE, 0x11, 0xAF, 0xA2, 0x69, 0x81, 0x1D, 0x61, 0x8D, 0xF6, 0xCE, 0x02,
-    0x6C, 0x66, 0x26, 0x90, 0x36, 0xA6, 0xF2, 0x7D, 0x24, 0xDF, 0x26, 0xA5, 0xFF, 0x9E, 0xBD, 0x99,
-    0xAF, 0x15, 0xB9, 0xF4, 0xA8, 0x45, 0x7F, 0x4E, 0xBB, 0x3D, 0x36, 0x5F, 0x4E, 0x64, 0xC0, 0xD9,
-    0xCC, 0xED, 0x5A, 0x13, 0xF5, 0xE6, 0x94, 0x49, 0xD0, 0xAD, 0x14, 0x63, 0x4D, 0xE7, 0xE8, 0xC0,
-    0xDD, 0xCD, 0x0D, 0xDC, 0x56, 0x8D, 0xC1, 0x7C, 0xB8, 0x9A, 0x2E, 0x30, 0x25, 0x78, 0x22, 0xEE,
-    0x4C, 0x60, 0x42, 0x77, 0x77, 0xC7, 0x4C, 0x39, 0x81, 0x58, 0x00, 0x73, 0x0E, 0xEF, 0x18, 0x86,
-    0x12, 0xD8, 0x4E, 0x6E, 0x70, 0x73, 0x99, 0xB5, 0x32, 0xDD, 0xB7, 0x65, 0x5E, 0x06, 0xD9, 0xB0,
-    0x2C, 0xB9, 0xBC, 0x2F, 0x95, 0xB9, 0x8C, 0xDC, 0x42, 0x9E, 0xEF, 0xF0, 0x78, 0x26, 0x37, 0xE3,
-    0xEA, 0x42, 0x7B, 0x93, 0x54, 0x57, 0xE4, 0x6D, 0xEE, 0x7D, 0x37, 0x97, 0xE6, 0x4B, 0xBC, 0x22,
-    0xC1, 0x04, 0x3E, 0x8F, 0x21, 0xD9, 0x13, 0xFE, 0x43, 0x87, 0xE3, 0x22, 0xDF, 0x2A, 0xE5, 0xF7,
-    0xA5, 0xA8, 0xD0, 0x6E, 0xCD, 0xDA, 0x47, 0xFA, 0x35, 0x71, 0xF5, 0x48, 0xBF, 0x82, 0x1F, 0xE9,
-    0xE2, 0x05, 0x37, 0x4F, 0x65, 0x52, 0x9C, 0x49, 0x1B, 0xF6, 0x29, 0x75, 0x8A, 0x1C, 0x29, 0xD1,
-    0x6C, 0x55, 0xE7, 0x43, 0x5D, 0x44, 0xC7, 0xD5, 0xFD, 0x47, 0xDC, 0xA4, 0x11, 0xD6, 0x49, 0xEB,
-    0xCE, 0xD7, 0x8E, 0x75, 0x33, 0x93, 0x99, 0x95, 0x7D, 0xD5, 0x18, 0x41, 0x48, 0xD6, 0x32, 0x2F,
-    0x6B, 0xB5, 0x2B, 0x26, 0xA8, 0x27, 0xAE, 0xB8, 0xDE, 0x0B, 0x4A, 0xEC, 0x38, 0xE3, 0x5A, 0x59,
-    0x18, 0x41, 0x75, 0x79, 0x79, 0x84, 0x1E, 0xC8, 0x22, 0x49, 0x9D, 0x09, 0xB2, 0x78, 0x24, 0x2D,
-    0x4D, 0xAA, 0xB8, 0x05, 0xA4, 0x78, 0x88, 0x4A, 0x3A, 0x25, 0x18, 0xC2, 0x8A, 0xE8, 0x2D, 0x3F,
-    0x75, 0xBE, 0xBB, 0x6D, 0xF7, 0x5D, 0xCB, 0x5B, 0xC2, 0x8E, 0xD5, 0xB4, 0x3F, 0xA2, 0xD2, 0x6B,
-    0xBB, 0x96, 0x77, 0xE2, 0x39, 0x56, 0x73, 0x56, 0x7B, 0xE6, 0xB7, 0xD8, 0xD7, 0x1F, 0x1F, 0xDA,
-    0xD7, 0xBA, 0x5B, 0x27, 0xBA, 0xAF, 0xC7, 0xBB, 0xFB, 0x81, 0xD0, 0x9C, 0xDD, 0xC0, 0x32, 0xC8,
-    0x18, 0x03, 0xBC, 0x74, 0x2A, 0x78, 0x62, 0x22, 0xEC, 0x95, 0x53, 0xD9, 0x6A, 0xCE, 0xB0, 0x05,
-    0x8C, 0xCB, 0xF2, 0x72, 0xEA, 0xE4, 0xCF, 0xB0, 0x15, 0x10, 0xD7, 0x02, 0x64, 0x53, 0x01, 0xA7,
-    0x4D, 0x7E, 0x43, 0xE6, 0x38, 0xFF, 0xA2, 0x47, 0xDF, 0xDB, 0x25, 0xC0, 0x9F, 0x37, 0x71, 0xA1,
-    0x94, 0xED, 0x91, 0x97, 0x39, 0x6E, 0x4E, 0xF0, 0x58, 0x84, 0x06, 0x66, 0xBD, 0x80, 0x09, 0x1A,
-    0x15, 0xB2, 0x23, 0x40, 0x2E, 0xB3, 0x2B, 0xDC, 0xA3, 0x40, 0x57, 0xED, 0x90, 0x49, 0xB3, 0x51,
-    0x67, 0x70, 0x1F, 0xE6, 0x0F, 0x93, 0x18, 0x00, 0x4C, 0x01, 0x66, 0x00, 0x11, 0x40, 0x7C, 0x4F,
-    0x40, 0xFA, 0xA9, 0x80, 0xFC, 0x0D, 0x01, 0x2E, 0xAA, 0xF3, 0x1B, 0x9D, 0x80, 0x5B, 0xAD, 0x80,
-    0xDB, 0xB5, 0x80, 0x4F, 0x2B, 0x01, 0x9F, 0xCD, 0x05, 0xB8, 0x12, 0x20, 0x03, 0x10, 0x5A, 0x96,
-    0x77, 0x00, 0x2D, 0x40, 0x0D, 0xD2, 0xF6, 0xA6, 0xFC, 0x13, 0x2C, 0xC3, 0x18, 0x2E, 0x76, 0xC0,
-    0x6B, 0x99, 0xED, 0xD0, 0x61, 0x62, 0x36, 0x57, 0xF3, 0x12, 0x36, 0x32, 0x03, 0x51, 0x95, 0x60,
-    0x73, 0xC8, 0x33, 0xB2, 0xD4, 0x1C, 0x59, 0x6B, 0x6C, 0x31, 0x15, 0x24, 0x94, 0x11, 0x04, 0xD2,
-    0x80, 0x7B, 0x55, 0x1A, 0x90, 0x2E, 0x48, 0x2B, 0x9F, 0xC8, 0xE0, 0xE2, 0x7B, 0x95, 0x92, 0x0F,
-    0x25, 0x1B, 0x53, 0x50, 0xE9, 0xA9, 0x4C, 0x93, 0x99, 0xC9, 0x78, 0x9F, 0xDB, 0x69, 0x71, 0xB1,
-    0xF1, 0x77, 0x44, 0xF8, 0xDE, 0x6C, 0xE8, 0xDB, 0x92, 0xC5, 0x63, 0x07, 0x82, 0xC1, 0x0B, 0xA0,
-    0xDB, 0x08, 0x90, 0xB6, 0x1F, 0x04, 0xC1, 0x9B, 0xF8, 0x84, 0xEE, 0x0A, 0x04, 0x39, 0xD5, 0xA9,
-    0x88, 0xB0, 0x75, 0x4D, 0xF4, 0x0D, 0x96, 0x2C, 0xF9, 0x25, 0x36, 0x76, 0xFA, 0x73, 0xAC, 0x5C,
-    0x7E, 0x0B, 0x0F, 0xD9, 0x77, 0xB0, 0x80, 0x2E, 0x73, 0x5C, 0x4A, 0x19, 0xC9, 0x84, 0x9C, 0x6E,
-    0xEA, 0xB6, 0xA5, 0xA1, 0x19, 0xDF, 0x25, 0x54, 0x56, 0x9A, 0x88, 0x08, 0x05, 0xA3, 0x64, 0x4F,
-    0x0B, 0x05, 0x15, 0xF4, 0x90, 0x69, 0x9D, 0x75, 0xA0, 0xDE, 0x98, 0x46, 0x3C, 0x42, 0x72, 0xBE,
-    0x56, 0x0E, 0xB2, 0x0B, 0xF7, 0xAB, 0x81, 0x05, 0xC9, 0x82, 0x62, 0x57, 0x46, 0xB2, 0xED, 0xA6,
-    0x28, 0xBD, 0xD6, 0xB2, 0x0D, 0xB1, 0x07, 0xF5, 0xBA, 0xDC, 0xB7, 0xC7, 0x67, 0x84, 0xFA, 0x2F,
-    0xA4, 0x34, 0x56, 0xAE, 0x59, 0xB9, 0xC7, 0xCA, 0xBD, 0x5A, 0xC2, 0xD6, 0xDE, 0xB1, 0xB5, 0x5C,
-    0x9B, 0xFB, 0xD2, 0xF8, 0xEB, 0xCE, 0x0A, 0xDE, 0x6A, 0x3D, 0x73, 0xF2, 0x5C, 0x27, 0xD7, 0x5A,
-    0x6D, 0xA7, 0x7F, 0x32, 0x6C, 0x30, 0x26, 0x6D, 0x5C, 0x6E, 0xF6, 0x15, 0x14, 0x12, 0x33, 0xC0,
-    0x54, 0x61, 0x79, 0x3F, 0x98, 0x2B, 0x04, 0x72, 0xCA, 0x7A, 0x10, 0x62, 0x86, 0xF5, 0x77, 0xAB,
-    0xDF, 0xBE, 0xEE, 0xAE, 0x5A, 0x92, 0xB6, 0x35, 0x58, 0x80, 0xD7, 0x1F, 0x86, 0x60, 0x96, 0xA7,
-    0x36, 0x9E, 0x84, 0xA8, 0x93, 0x2C, 0x64, 0x03, 0x4D, 0x7A, 0x6C, 0x43, 0x5B, 0x08, 0x1E, 0x84,
-    0xD8, 0x50, 0x82, 0x1B, 0xD2, 0x49, 0x5B, 0xC8, 0x66, 0x13, 0x09, 0xC4, 0x16, 0x20, 0xCB, 0xC2,
-    0x2A, 0x0B, 0x6C, 0x9F, 0x74, 0x61, 0xDF, 0x05, 0xAE, 0xC5, 0x95, 0xC5, 0x66, 0x35, 0x61, 0xEF,
-    0xEE, 0x35, 0xC4, 0x55, 0x32, 0x97, 0x65, 0x0D, 0x74, 0xC3, 0xF7, 0x71, 0x63, 0xDF, 0xEB, 0x28,
-    0x3C, 0xD8, 0x8B, 0x14, 0x15, 0xE7, 0x82, 0xAB, 0xD2, 0x8E, 0xBC, 0xBE, 0x10, 0x52, 0x28, 0xE8,
-    0x26, 0xED, 0x57, 0x26, 0xEC, 0xA4, 0x8E, 0x1B, 0x20, 0xA4, 0xBC, 0xBF, 0x05, 0x6E, 0xCA, 0xC6,
-    0x76, 0x20, 0x55, 0xD2, 0x3F, 0x47, 0xB6, 0x1C, 0x4A, 0x83, 0x5E, 0x3C, 0x9B, 0xA7, 0xDB, 0xAE,
-    0x7A, 0x9E, 0x54, 0x3A, 0xF2, 0x25, 0x5D, 0x04, 0xFF, 0xDA, 0x09, 0xA6, 0xC8, 0x04, 0xB3, 0x60,
-    0xEF, 0x40, 0x82, 0x00, 0x13, 0x1C, 0x4A, 0xDC, 0x7C, 0xBC, 0xE9, 0x2A, 0x8F, 0x87, 0x45, 0x82,
-    0x0E, 0x9E, 0x7D, 0xEA, 0x94, 0xAE, 0x9F, 0xC8, 0xBE, 0x75, 0xAF, 0x91, 0x6E, 0x83, 0x46, 0x71,
-    0x93, 0xBF, 0x69, 0x9E, 0x32, 0xD5, 0x7D, 0x7A, 0xAC, 0x46, 0x18, 0x70, 0x8B, 0xBD, 0xBA, 0x06,
-    0x8A, 0xD0, 0x03, 0xBB, 0x02, 0xD9, 0x00, 0xDC, 0x0A, 0x98, 0x31, 0x08, 0x00, 0x26, 0x00, 0x3B,
-    0xBD, 0x00, 0x69, 0x47, 0x40, 0x03, 0x20, 0xE4, 0xAD, 0xA5, 0xE0, 0x91, 0xCB, 0x92, 0xA6, 0x8D,
-    0x0C, 0xD3, 0x08, 0xFD, 0x11, 0xBC, 0x13, 0xEA, 0xD4, 0x13, 0x3A, 0x21, 0x89, 0x6D, 0x6E, 0xB3,
-    0xE9, 0x37, 0x6D, 0x2E, 0xBB, 0xF2, 0x37, 0xAD, 0x88, 0x7B, 0xE1, 0x57, 0x6D, 0x7E, 0xA1, 0x8C,
-    0xFE, 0x77, 0x9B, 0x5F, 0x5E, 0x44, 0x3F, 0x17, 0x58, 0x25, 0xB7, 0xDA, 0xFC, 0x52, 0x95, 0x5E,
-    0x6C, 0xF3, 0x8B, 0x75, 0xFA, 0xAA, 0xC0, 0x36, 0x9F, 0xB6, 0xF9, 0xBB, 0x6D, 0x2F, 0xF0, 0x9D,
-    0xBE, 0x13, 0x58, 0xB8, 0x16, 0xD0, 0x36, 0x80, 0x79, 0x0D, 0x98, 0x56, 0x80, 0xC9, 0x62, 0x0A,
-    0xA9, 0x23, 0x26, 0xB9, 0xAF, 0x1E, 0x00, 0x84, 0x19, 0x80, 0xB4, 0xBA, 0x31, 0x38, 0xC1, 0x63,
-    0x4B, 0xE0, 0xB1, 0x25, 0xA4, 0x44, 0x68, 0x1D, 0x09, 0x3E, 0x30, 0x3E, 0x74, 0xBB, 0xF2, 0x55,
-    0xD4, 0x99, 0xA4, 0x05, 0x77, 0x97, 0x5D, 0x25, 0x1B, 0x49, 0xF6, 0x72, 0xBA, 0x20, 0x61, 0x9F,
-    0x83, 0x2F, 0x48, 0x03, 0x0A, 0x83, 0xE5, 0x67, 0x7E, 0x9F, 0x72, 0x37, 0xEA, 0xFD, 0xFA, 0xAC,
-    0xB4, 0x13, 0xCB, 0x1C, 0xBB, 0xBF, 0x94, 0x36, 0xA7, 0x64, 0x22, 0xFA, 0x2E, 0x11, 0xE1, 0x29,
-    0x59, 0x3E, 0xAF, 0xD2, 0xA7, 0x3B, 0xC8, 0xD7, 0x20, 0x6E, 0x3D, 0x7E, 0xE0, 0x7E, 0xC1, 0xB7,
-    0xFB, 0xDD, 0x5B, 0xD9, 0x32, 0x11, 0x2E, 0x11, 0xB5, 0xE4, 0x1E, 0x2C, 0x91, 0xFC, 0x9D, 0xD6,
-    0xBC, 0x26, 0xDA, 0x00, 0x29, 0xE0, 0xEE, 0x95, 0xA3, 0xA9, 0xA0, 0x2F, 0xEB, 0x4A, 0x4F, 0x31,
-    0x28, 0x3D, 0xCE, 0x2B, 0x3D, 0xCD, 0x52, 0xE9, 0x01, 0x07, 0xA6, 0x82, 0x43, 0x1E, 0x31, 0x02,
-    0x4B, 0x7D, 0x87, 0xF7, 0x9D, 0x40, 0xE9, 0xA1, 0xC4, 0x09, 0x90, 0x2D, 0x81, 0xD2, 0xA6, 0xC7,
-    0x0D, 0x9E, 0xAE, 0xCC, 0x34, 0xFC, 0x44, 0xD5, 0x12, 0x06, 0x3B, 0xFB, 0x1B, 0x1C, 0x2F, 0xA9,
-    0xB1, 0xAC, 0x08, 0x64, 0x0F, 0x57, 0xC5, 0x9D, 0xF4, 0xA8, 0x4D, 0xAB, 0xA8, 0x0A, 0xDB, 0x74,
-    0x1E, 0x55, 0x90, 0x17, 0x04, 0xF6, 0x80, 0x93, 0x5E, 0x3F, 0xEB, 0xF7, 0x7A, 0x8F, 0xDE, 0xAF,
-    0xCF, 0x4E, 0xD8, 0x8E, 0xB6, 0x89, 0xF6, 0xB3, 0xF5, 0x37, 0x0A, 0x8F, 0xA4, 0x0A, 0x1A, 0x35,
-    0x3A, 0x64, 0x11, 0x71, 0xE6, 0xC2, 0xD3, 0x20, 0x3F, 0x40, 0xC0, 0x75, 0x17, 0x41, 0xBB, 0x3E,
-    0xC1, 0x40, 0xB1, 0x6F, 0x56, 0x63, 0x9C, 0x61, 0x8C, 0x11, 0x3E, 0x25, 0xE0, 0x5D, 0xE9, 0x3D,
-    0xB9, 0xEA, 0xDE, 0x6B, 0x65, 0x7E, 0xA6, 0x60, 0xDA, 0x01, 0x49, 0x91, 0x05, 0x71, 0x4C, 0x2B,
-    0x99, 0xD1, 0xA4, 0x16, 0xDC, 0x89, 0xB0, 0xD9, 0x93, 0x39, 0xB5, 0x96, 0xC5, 0x93, 0x84, 0xD0,
-    0x7C, 0x54, 0x1B, 0xCA, 0xC6, 0xD0, 0x50, 0xDE, 0x3B, 0x1A, 0x6E, 0xA2, 0x16, 0x61, 0xF0, 0xFE,
-    0xA0, 0x00, 0x00, 0x03, 0xB0, 0x8B, 0xC0, 0x63, 0x23, 0xB4, 0x9B, 0x2C, 0x64, 0xF3, 0x3F, 0xB8,
-    0xC6, 0xB6, 0x1E, 0x04, 0x84, 0xD8, 0x0B, 0x29, 0x6E, 0x20, 0xA6, 0x99, 0xE8, 0x29, 0x56, 0xBB,
-    0xD7, 0xDD, 0xF6, 0x4E, 0x43, 0xA9, 0xC9, 0x1D, 0xA8, 0xD8, 0x25, 0xC8, 0x33, 0x90, 0xC0, 0x9E,
-    0x65, 0xCD, 0x3E, 0xF6, 0x85, 0x76, 0x8B, 0x04, 0x69, 0xAD, 0x5E, 0x32, 0xFC, 0xFB, 0xD6, 0x2F,
-    0x88, 0xB8, 0x53, 0x91, 0xCE, 0x1E, 0x84, 0x6B, 0x98, 0xEF, 0xE1, 0xFE, 0x35, 0xAA, 0x0A, 0xBA,
-    0x37, 0x1D, 0xF7, 0x2A, 0xE9, 0x4B, 0x8D, 0xCD, 0x1B, 0xD1, 0x1A, 0x15, 0x51, 0x6B, 0x5D, 0x87,
-    0xC2, 0xB0, 0xE5, 0xD9, 0x1D, 0xC7, 0xFB, 0x3B, 0x42, 0x6E, 0x90, 0x3E, 0x63, 0x3F, 0xA2, 0xEA,
-    0x44, 0x70, 0xF7, 0x3F, 0x03, 0x0A, 0xF2, 0x10, 0x2E, 0x08, 0x6B, 0x5C, 0x95, 0xED, 0x5B, 0x41,
-    0xC0, 0x00, 0x9C, 0x76, 0x2B, 0x38, 0x23, 0x8C, 0xF0, 0xFD, 0xAE, 0x6B, 0x78, 0x7F, 0x45, 0x58,
-    0x02, 0xEE, 0xF9, 0x96, 0x8F, 0x2D, 0xBB, 0xB4, 0x41, 0x01, 0x73, 0xC1, 0x76, 0x1A, 0xBC, 0x07,
-    0x6D, 0x7A, 0x55, 0xA4, 0xD3, 0xCF, 0xB2, 0x4F, 0x77, 0xC1, 0xFE, 0xC9, 0x65, 0xA9, 0x8A, 0x78,
-    0x9A, 0xDF, 0x90, 0x32, 0x17, 0x68, 0x42, 0x64, 0x14, 0x79, 0xBF, 0xB0, 0x33, 0x18, 0x34, 0xC1,
-    0xFE, 0xBC, 0x59, 0x53, 0x88, 0x46, 0xB0, 0xF9, 0x96, 0x48, 0xEF, 0xD8, 0x11, 0x2B, 0x60, 0x68,
-    0x97, 0x53, 0x9D, 0x99, 0xF7, 0xF1, 0x09, 0x61, 0x96, 0x7F, 0xFE, 0x97, 0xB6, 0x59, 0x5A, 0xC4,
-    0x0A, 0x21, 0x26, 0x23, 0x43, 0x97, 0x5F, 0xD3, 0x04, 0x6F, 0x84, 0x75, 0x0D, 0x12, 0x53, 0x08,
-    0x3A, 0x26, 0x42, 0x57, 0xBF, 0x83, 0x8D, 0x94, 0xCA, 0xF2, 0x88, 0xC8, 0x04, 0xC1, 0x4C, 0x54,
-    0x19, 0x11, 0xFC, 0xC1, 0xF8, 0xE4, 0x45, 0x29, 0x66, 0x07, 0xB6, 0xC4, 0x1C, 0x4B, 0x19, 0x1F,
-    0xAC, 0x4A, 0xDA, 0x23, 0x78, 0x27, 0x2B, 0x7D, 0x0E, 0xA2, 0xD7, 0x7C, 0xD9, 0x66, 0xD2, 0x9F,
-    0xC7, 0x1B, 0x22, 0x7D, 0xDF, 0x14, 0x92, 0x39, 0x6E, 0x50, 0xB1, 0x9A, 0xF4, 0xFB, 0xB4, 0x55,
-    0xBA, 0x2A, 0x42, 0xA7, 0x83, 0x14, 0x2D, 0x40, 0x44, 0xB9, 0x14, 0x52, 0xE1, 0x18, 0x08, 0x35,
-    0x15, 0xF5, 0xC6, 0xBD, 0x9F, 0xEB, 0x7D, 0x90, 0xED, 0x4A, 0x60, 0x8B, 0x0C, 0xEC, 0x6B, 0xD2,
-    0xAB, 0x14, 0x72, 0x5F, 0x2A, 0x57, 0x33, 0xAA, 0x41, 0x29, 0xA4, 0xC2, 0x94, 0x94, 0x53, 0xFA,
-    0x42, 0x83, 0x10, 0xE6, 0xBE, 0x87, 0x52, 0x85, 0xEE, 0x2C, 0x7E, 0x37, 0xCB, 0x07, 0x19, 0xBE,
-    0x36, 0x3B, 0x82, 0x2E, 0x32, 0x33, 0xA9, 0xDB, 0xA9, 0xAD, 0x08, 0xB0, 0xAE, 0x40, 0x89, 0x6B,
-    0x59, 0x36, 0xE8, 0x91, 0xF2, 0xFD, 0x2F, 0xEB, 0xD0, 0xBD, 0x5A, 0x9B, 0x33, 0xBE, 0xDB, 0x13,
-    0x5B, 0x83, 0x94, 0x4B, 0x57, 0x9A, 0x99, 0xEB, 0xAF, 0x44, 0xBD, 0xDA, 0x6D, 0xA0, 0xAE, 0xA4,
-    0xB7, 0x45, 0x4F, 0xD8, 0xA1, 0x24, 0xD0, 0xDA, 0xBD, 0xB8, 0xB3, 0x8B, 0x69, 0xAF, 0xBA, 0x24,
-    0x4A, 0xE0, 0xB0, 0x06, 0xA9, 0x10, 0x8A, 0x74, 0x31, 0xED, 0xE2, 0x26, 0x06, 0x7F, 0xA9, 0xA9,
-    0x33, 0xD8, 0x9E, 0x66, 0x6C, 0x5A, 0xB4, 0x64, 0x11, 0x21, 0x55, 0x49, 0x4B, 0x0B, 0xD1, 0x16,
-    0x2A, 0x57, 0xA4, 0x0B, 0xF7, 0x05, 0xEC, 0x8C, 0x9D, 0x5E, 0x7B, 0x07, 0xDF, 0xC7, 0x95, 0x96,
-    0xB4, 0x82, 0xE8, 0xA3, 0x76, 0xC8, 0x3D, 0x41, 0xAD, 0xCE, 0xFF, 0xDE, 0x79, 0x53, 0x96, 0xF2,
-    0x81, 0xBF, 0x86, 0xFB, 0x74, 0x04, 0xDE, 0x12, 0xD0, 0x03, 0x01, 0x57, 0xA0, 0x13, 0x30, 0x59,
-    0x82, 0x29, 0xC4, 0xE1, 0x19, 0xC0, 0x85, 0xBD, 0xB7, 0xDC, 0x06, 0xF5, 0xC7, 0x11, 0xC0, 0x84,
-    0x1E, 0x00, 0x2B, 0x44, 0xB4, 0x1D, 0x58, 0x32, 0x17, 0x20, 0xAD, 0xE2, 0x5A, 0x04, 0x83, 0x06,
-    0x72, 0x01, 0x26, 0xCB, 0xF9, 0xB2, 0x34, 0xC2, 0xC2, 0xD4, 0xBA, 0x17, 0xFC, 0x08, 0xB6, 0xC3,
-    0x19, 0x50, 0xDB, 0xBA, 0x2B, 0x26, 0xD8, 0x00, 0x67, 0x95, 0x19, 0x12, 0x04, 0x9C, 0x35, 0x53,
-    0x08, 0xE3, 0xB3, 0x46, 0x10, 0x64, 0xDA, 0xCD, 0x64, 0x1B, 0xCB, 0xCE, 0x98, 0x41, 0xF2, 0x30,
-    0xF6, 0x76, 0x83, 0x26, 0x52, 0x35, 0xB2, 0xC5, 0xE4, 0xDA, 0xDE, 0x82, 0x06, 0xBD, 0x82, 0x6A,
-    0xE0, 0xA5, 0x06, 0xA6, 0x07, 0x3C, 0x50, 0x99, 0x19, 0x1E, 0x17, 0x1D, 0xB0, 0x99, 0x35, 0x40,
-    0x34, 0x34, 0x2D, 0x32, 0x1C, 0x5F, 0x54, 0xAA, 0xB8, 0xBB, 0x87, 0xC6, 0x32, 0x69, 0xA9, 0xFC,
-    0x5D, 0xCA, 0x5E, 0x5C, 0xEA, 0x32, 0xB8, 0xEE, 0xB2, 0xC0, 0x81, 0x5F, 0xCB, 0x26, 0xD8, 0x84,
-    0x81, 0x2D, 0xA1, 0x71, 0xF8, 0x0F, 0x45, 0x01, 0x84, 0xF9, 0x4F, 0x4A, 0x11, 0x83, 0xAE, 0x89,
-    0x8A, 0x20, 0xDA, 0x65, 0x27, 0x9A, 0xA6, 0x94, 0x54, 0x4A, 0x2E, 0x45, 0xD6, 0xE8, 0xDD, 0xBE,
-    0xB3, 0x17, 0x7F, 0xD3, 0xD9, 0xF7, 0xBE, 0xEA, 0xEC, 0x1B, 0x3F, 0xEF, 0xEC, 0xD6, 0xAD, 0xCE,
-    0xDA, 0x69, 0x67, 0x7B, 0x29, 0xAD, 0x94, 0x46, 0x8A, 0x08, 0x24, 0x82, 0x44, 0xDD, 0xE9, 0xAB,
-    0xCF, 0x15, 0x61, 0x95, 0xCC, 0x49, 0x67, 0xF0, 0x3E, 0x99, 0xCB, 0xC1, 0xEF, 0xF1, 0xA8, 0x6D,
-    0x8B, 0x06, 0xDE, 0x4A, 0x1B, 0xA2, 0xF4, 0x8B, 0x96, 0x2D, 0xEA, 0x3D, 0xAC, 0x3A, 0xD0, 0xB2,
-    0x2D, 0x15, 0xDF, 0x4A, 0xEB, 0x7B, 0xF2, 0xB7, 0x68, 0xD2, 0xD0, 0xA2, 0xA1, 0x41, 0x43, 0x7B,
-    0x86, 0xC6, 0x2C, 0x2A, 0x54, 0x87, 0x3D, 0x69, 0x56, 0x60, 0xD2, 0xBF, 0x35, 0x46, 0x18, 0x05,
-    0xED, 0x80, 0x3A, 0x2B, 0xA0, 0x48, 0xD4, 0xC0, 0x70, 0x54, 0x03, 0x54, 0x00, 0x85, 0x9A, 0x04,
-    0x65, 0x50, 0xB0, 0xEF, 0x8A, 0x36, 0x25, 0xEB, 0x87, 0xB1, 0x26, 0x0E, 0x5B, 0x24, 0x15, 0x68,
-    0x85, 0x5E, 0x18, 0x9B, 0x67, 0x3D, 0x60, 0xD1, 0x0A, 0xBC, 0x70, 0x13, 0xF0, 0x8D, 0x9F, 0x0B,
-    0xBA, 0xD9, 0xD7, 0xBF, 0xAA, 0x04, 0xBE, 0xF6, 0x0D, 0xE0, 0xAB, 0xB2, 0x87, 0x8C, 0x7D, 0x45,
-    0x76, 0x86, 0xB1, 0x2F, 0xCB, 0xBE, 0x11, 0x2D, 0x0F, 0xA6, 0x2A, 0x9B, 0x59, 0x03, 0xF5, 0x5F,
-    0xC4, 0x07, 0xD1, 0xFF, 0x0E, 0x95, 0xDD, 0x9D, 0xD6, 0x5B, 0x7B, 0xF4, 0xF3, 0x51, 0xF7, 0x40,
-    0x6F, 0x64, 0x27, 0x55, 0xE3, 0x07, 0x92, 0x26, 0x75, 0xDC, 0xA6, 0xBA, 0x3C, 0xBA, 0xE3, 0x0B,
-    0x5F, 0xE4, 0x33, 0xBE, 0x4B, 0xE7, 0x22, 0x59, 0xD6, 0xBA, 0xE3, 0x67, 0xA3, 0x1D, 0x6F, 0x55,
-    0x82, 0xD0, 0x72, 0xE7, 0x42, 0xE3, 0xFB, 0x75, 0xE2, 0xC2, 0x6E, 0x84, 0xBD, 0xCC, 0x05, 0x2D,
-    0x58, 0x95, 0xFD, 0x3A, 0x07, 0x15, 0xF3, 0xBA, 0x09, 0x16, 0x76, 0xAA, 0x05, 0x9F, 0xF1, 0x1D,
-    0xAE, 0xED, 0xE5, 0xAA, 0xAF, 0x08, 0xF5, 0xB5, 0xEF, 0x61, 0x2E, 0x36, 0x48, 0x0C, 0x8E, 0x2A,
-    0xDE, 0xF3, 0x53, 0xF8, 0x8D, 0x5B, 0x24, 0xDD, 0x79, 0x6A, 0x1E, 0xB9, 0xDF, 0xA8, 0x6A, 0x54,
-    0x59, 0xE9, 0x36, 0xDC, 0xB8, 0xDD, 0x5B, 0x82, 0xF8, 0xAE, 0x98, 0x81, 0x1D, 0xC1, 0x7B, 0xA2,
-    0xE3, 0xAC, 0x87, 0x72, 0x36, 0xBF, 0xBB, 0xC1, 0x46, 0x1E, 0xA2, 0x80, 0x8C, 0xCF, 0x63, 0x38,
-    0xB3, 0xE8, 0x1E, 0xA0, 0xA6, 0x4E, 0x0C, 0x9A, 0x76, 0x22, 0x77, 0x89, 0xC8, 0x0C, 0xEB, 0x06,
-    0x8C, 0xCA, 0xF6, 0x75, 0xA1, 0x38, 0xF9, 0xA7, 0x20, 0xC8, 0x9F, 0x2D, 0xBC, 0x9D, 0x83, 0x42,
-    0x76, 0xA8, 0x2A, 0x85, 0x19, 0x40, 0x37, 0x58, 0xA1, 0xA1, 0xB6, 0x3C, 0x67, 0xAB, 0xA5, 0x72,
-    0x01, 0xA9, 0x7C, 0xCF, 0xAC, 0xF1, 0xCF, 0x07, 0xC1, 0x64, 0xD0, 0x85, 0x6B, 0x8A, 0x3E, 0xC2,
-    0x68, 0x9A, 0xFC, 0xB6, 0x30, 0x23, 0x61, 0x4C, 0x60, 0x84, 0x69, 0x09, 0xCB, 0x86, 0xF0, 0x22,
-    0xEC, 0x9B, 0x15, 0xE4, 0x37, 0x7A, 0x95, 0x77, 0x16, 0x7C, 0xCA, 0xB7, 0xA0, 0xAD, 0xA1, 0xE5,
-    0xE2, 0x64, 0x7D, 0x50, 0xE9, 0x64, 0x21, 0xA2, 0x41, 0x52, 0x41, 0x14, 0x6C, 0x84, 0x07, 0xCE,
-    0x3A, 0x99, 0x32, 0x61, 0x39, 0x0B, 0xD0, 0x77, 0xDA, 0x50, 0x8D, 0x3A, 0xB7, 0xB0, 0x95, 0xD4,
-    0xB3, 0xC5, 0x0B, 0x82, 0x9F, 0xB0, 0x65, 0xD0, 0x40, 0x0B, 0x8E, 0x8B, 0x06, 0xEC, 0x3C, 0x80,
-    0xB8, 0x2E, 0x04, 0xFC, 0xB7, 0x05, 0xEF, 0x5F, 0xD8, 0xCB, 0x9C, 0x67, 0x67, 0x1E, 0x18, 0x8F,
-    0x55, 0x07, 0x00, 0xCD, 0x97, 0xED, 0x4A, 0x84, 0xD2, 0x92, 0xA2, 0x08, 0x81, 0x4A, 0xFB, 0x9D,
-    0x0E, 0x06, 0xD2, 0x10, 0x2C, 0x70, 0xE7, 0x87, 0x9D, 0x2E, 0xDE, 0x7A, 0x11, 0x62, 0x04, 0x72,
-    0x26, 0x3C, 0xF1, 0x11, 0xE1, 0x9D, 0xAD, 0xAF, 0xBF, 0xD7, 0x51, 0x58, 0x5E, 0x87, 0xBC, 0x6A,
-    0x1E, 0x6F, 0x85, 0x77, 0xF5, 0x99, 0x4A, 0xE6, 0x8B, 0xF5, 0x8A, 0x93, 0x92, 0xDC, 0xA7, 0xC2,
-    0xEA, 0x95, 0x63, 0x70, 0xD6, 0xAE, 0xEC, 0x03, 0xEE, 0x17, 0x6A, 0x5A, 0x50, 0x31, 0x33, 0xDF,
-    0xB5, 0xD5, 0x60, 0x65, 0x8B, 0x06, 0x70, 0x27, 0xAF, 0xFC, 0x55, 0xBD, 0x6F, 0xCF, 0x6F, 0x79,
-    0xEB, 0xAD, 0xA4, 0x87, 0xA0, 0xB4, 0x49, 0xE3, 0xAD, 0x42, 0xC1, 0x56, 0x7B, 0x47, 0x04, 0x8F,
-    0x02, 0x9C, 0x00, 0x30, 0x59, 0xC1, 0x3B, 0x76, 0xB1, 0xBC, 0xC7, 0x01, 0x87, 0xFC, 0xB3, 0x47,
-    0x91, 0x18, 0x77, 0x6D, 0x30, 0xAF, 0xCC, 0xED, 0xAE, 0x90, 0x24, 0x69, 0x01, 0xB3, 0xC3, 0xFA,
-    0x8E, 0xAD, 0xBC, 0x61, 0x3E, 0xB3, 0x6A, 0xFA, 0x31, 0x5B, 0xA4, 0x28, 0x0D, 0x0D, 0x82, 0x7F,
-    0x38, 0xA3, 0xF7, 0x81, 0xC4, 0xE7, 0xF4, 0xB6, 0x83, 0x5C, 0xCB, 0x12, 0x6C, 0x7A, 0x62, 0x24,
-    0x7A, 0xC7, 0xDD, 0x73, 0xD2, 0x5F, 0x0A, 0x4E, 0x78, 0xE6, 0xCA, 0xC8, 0x6A, 0x20, 0x5C, 0xCF,
-    0xC1, 0xCA, 0x9B, 0x38, 0x18, 0x26, 0x68, 0xB6, 0x29, 0xDC, 0xFF, 0x94, 0x5E, 0xBE, 0x0B, 0x13,
-    0xB6, 0x15, 0xA5, 0x5D, 0x76, 0xE8, 0x17, 0x1D, 0xA0, 0x83, 0xBB, 0xC2, 0x43, 0xFD, 0xE6, 0x22,
-    0xE1, 0xBB, 0xB0, 0x64, 0xC9, 0x53, 0xFF, 0x89, 0x3C, 0x91, 0x2D, 0x24, 0xAE, 0xF3, 0x2D, 0x7B,
-    0x43, 0xD5, 0x96, 0xEB, 0x84, 0x74, 0xF6, 0x90, 0xB9, 0xA3, 0x6E, 0xDA, 0xCB, 0xBA, 0xB3, 0x44,
-    0x22, 0xBE, 0x40, 0x2E, 0xC6, 0x35, 0x03, 0xAF, 0x82, 0xBB, 0xD5, 0x4F, 0xDC, 0xB4, 0xC7, 0xBF,
-    0xA8, 0x9D, 0xF6, 0xD8, 0xC2, 0xB9, 0x08, 0x8F, 0xC1, 0xE6, 0x10, 0xEB, 0x20, 0x43, 0x8A, 0xA5,
-    0xD5, 0x59, 0xBD, 0x32, 0x7D, 0x3C, 0x06, 0x79, 0x2A, 0xB8, 0xFA, 0x6D, 0x33, 0x6D, 0x52, 0x61,
-    0x10, 0xB2, 0xD9, 0xEA, 0x34, 0x7B, 0x9C, 0xB2, 0x9A, 0xDA, 0x0A, 0x9B, 0x01, 0x8C, 0x45, 0xCD,
-    0x7E, 0x7C, 0x41, 0x18, 0x59, 0x6D, 0xC2, 0x7D, 0xF9, 0x12, 0x36, 0x00, 0x01, 0x3F, 0x74, 0x22,
-    0x55, 0x88, 0xF0, 0x45, 0xF3, 0x07, 0x8D, 0x47, 0x61, 0x73, 0x32, 0x30, 0x6C, 0x00, 0x6E, 0x05,
-    0x60, 0xC6, 0x75, 0xA5, 0x70, 0xF8, 0x8B, 0x0E, 0x2B, 0xE9, 0xAA, 0x4C, 0xA9, 0xB4, 0x1E, 0x53,
-    0x2D, 0xF8, 0xD8, 0x9B, 0xC0, 0x1F, 0x5A, 0x6E, 0x3E, 0xC8, 0x15, 0xF7, 0x66, 0x2B, 0xAE, 0xB8,
-    0xFB, 0xA1, 0x81, 0x12, 0x8C, 0x22, 0xCD, 0xE9, 0x14, 0x41, 0x60, 0xDC, 0x3B, 0x7D, 0x88, 0x2B,
-    0xD2, 0xE9, 0x2F, 0x5B, 0x2F, 0xA1, 0x75, 0x0E, 0xA8, 0xF3, 0x0F, 0x15, 0xA1, 0x31, 0xA5, 0x72,
-    0x4B, 0x2C, 0x2C, 0x60, 0xA2, 0x9E, 0x21, 0x8F, 0x07, 0x2E, 0xA3, 0xB0, 0x84, 0x6D, 0x48, 0xAB,
-    0xF6, 0xC2, 0x8F, 0x20, 0xCF, 0x1C, 0x58, 0x4D, 0xA6, 0xA8, 0x7D, 0xFF, 0x7F, 0x20, 0xB7, 0x89,
-    0xC9, 0xD3, 0x2C, 0x4D, 0xB3, 0x97, 0x12, 0xB3, 0x5C, 0xA8, 0xB0, 0x7D, 0x88, 0x5F, 0xA3, 0x01,
-    0x38, 0xB0, 0xE7, 0x08, 0xF9, 0x18, 0xD0, 0xC6, 0x0D, 0xDF, 0x3C, 0xDC, 0x6F, 0xF6, 0x03, 0x6C,
-    0x71, 0x20, 0x5D, 0xBE, 0xF0, 0xF8, 0xE1, 0x71, 0x65, 0xA8, 0x02, 0xAA, 0x26, 0xA2, 0x92, 0x4C,
-    0x86, 0x0A, 0x48, 0xD6, 0x4D, 0xB0, 0xB9, 0x59, 0x41, 0xD2, 0x9C, 0xB8, 0xEF, 0xB9, 0x02, 0x95,
-    0x4C, 0xFA, 0xA4, 0xA5, 0xB9, 0x79, 0xDA, 0xF2, 0xAF, 0xF3, 0x52, 0xBD, 0x25, 0x3C, 0xA8, 0xE1,
-    0x9D, 0x34, 0xE9, 0x01, 0xC3, 0xD8, 0xCA, 0x92, 0x20, 0x40, 0x10, 0x38, 0x16, 0xDE, 0xB9, 0xB0,
-    0xB7, 0x61, 0x48, 0x9C, 0xE7, 0x76, 0x65, 0xF7, 0x01, 0xDF, 0x69, 0x66, 0x3D, 0x20, 0xE4, 0x3D,
-    0x0F, 0xF7, 0xCE, 0xE3, 0x1B, 0x6C, 0x11, 0xC0, 0x9A, 0xB0, 0x78, 0x26, 0xDB, 0xE1, 0x2C, 0xD0,
-    0x9F, 0xD6, 0x76, 0xD9, 0xE6, 0xEA, 0xF7, 0x3F, 0x35, 0x68, 0x0D, 0x8F, 0x28, 0xF5, 0x93, 0x32,
-    0x65, 0x47, 0x52, 0xA6, 0x47, 0xD5, 0x48, 0xCC, 0xDB, 0xE6, 0x43, 0x69, 0x65, 0x02, 0x0B, 0xF1,
-    0x5F, 0x0F, 0x86, 0xD3, 0x90, 0x1E, 0xAB, 0xE7, 0xFD, 0x6A, 0x3D, 0x03, 0x79, 0xF0, 0x61, 0x45,
-    0x73, 0x8A, 0xF3, 0x23, 0xF1, 0x9E, 0x9C, 0x7B, 0x5C, 0x48, 0xAD, 0x26, 0xD0, 0x84, 0xF2, 0xF9,
-    0xB8, 0x4A, 0x17, 0xC1, 0x50, 0x65, 0x61, 0x2B, 0x23, 0x1D, 0x2A, 0xD1, 0x3B, 0x10, 0xDB, 0x25,
-    0x43, 0x8E, 0xEB, 0x29, 0xFC, 0x6C, 0xC2, 0x46, 0x58, 0xB5, 0x33, 0x27, 0x93, 0x11, 0x8A, 0x76,
-    0xB1, 0x80, 0x64, 0x11, 0x89, 0x3E, 0x22, 0xCC, 0x23, 0xFE, 0x4C, 0xE8, 0x76, 0xE0, 0x92, 0x4F,
-    0x1B, 0xF8, 0xC5, 0xF2, 0x4B, 0x2D, 0x88, 0x97, 0x7B, 0x55, 0x34, 0x27, 0x99, 0xD1, 0x40, 0x9D,
-    0xCC, 0x86, 0xE6, 0xBA, 0x9E, 0x1E, 0x2C, 0x6A, 0xBF, 0xEA, 0x93, 0x93, 0x55, 0x83, 0xC5, 0xDE,
-    0xF9, 0x2A, 0x13, 0xD5, 0x46, 0x2B, 0x99, 0x26, 0x11, 0x30, 0xC1, 0x99, 0xA0, 0x85, 0x4F, 0x7B,
-    0x18, 0x3D, 0xAB, 0xD0, 0x4D, 0xE1, 0xE6, 0x8B, 0x30, 0xEB, 0xB3, 0x26, 0x71, 0x97, 0x44, 0x27,
-    0x6F, 0x53, 0xFB, 0x89, 0x10, 0xAF, 0xCE, 0xA6, 0x98, 0x7B, 0xD7, 0x71, 0xE2, 0x6D, 0x4B, 0xCB,
-    0x77, 0x5A, 0xD3, 0xB4, 0x8F, 0x78, 0x16, 0x6F, 0xD0, 0x5A, 0x01, 0x3A, 0x94, 0x56, 0x60, 0x7C,
-    0xB5, 0xBF, 0x02, 0x0D, 0xB3, 0xA7, 0x9A, 0x49, 0x4B, 0x10, 0xE6, 0x29, 0xAF, 0xD8, 0x93, 0x00,
-    0xCE, 0xC6, 0xE1, 0x13, 0xEC, 0x4F, 0xD7, 0x71, 0xD5, 0xDF, 0x87, 0x27, 0x7E, 0xE1, 0x23, 0xBF,
-    0x0E, 0xBD, 0xAD, 0x1C, 0x81, 0x03, 0x57, 0xE5, 0xB1, 0x6B, 0x7C, 0x5B, 0xE1, 0xDF, 0x16, 0x8C,
-    0xDE, 0x56, 0xF9, 0x97, 0x3B, 0x7D, 0x11, 0x6E, 0xD9, 0x1B, 0xA9, 0x0C, 0xA1, 0xBC, 0x11, 0x46,
-    0x35, 0xA7, 0xAE, 0x4E, 0x10, 0x78, 0x61, 0x15, 0xBB, 0xA8, 0x92, 0xC6, 0x7C, 0x4B, 0x1D, 0x9E,
-    0xB8, 0xD3, 0x73, 0x2D, 0x95, 0xDE, 0x76, 0xDD, 0xEE, 0x76, 0xA1, 0x76, 0xF7, 0xF9, 0xC1, 0xAA,
-    0xF4, 0x9A, 0x80, 0x1B, 0x3F, 0x50, 0xE6, 0x34, 0xCD, 0x96, 0x69, 0x63, 0x02, 0xC8, 0x78, 0xEE,
-    0x7D, 0xAB, 0x26, 0x3E, 0xBC, 0x28, 0xD0, 0xCA, 0x9B, 0x04, 0x57, 0x9B, 0xC7, 0xC0, 0x70, 0xD1,
-    0x43, 0x4A, 0xA7, 0x78, 0x96, 0xAA, 0x50, 0xB7, 0xF8, 0x07, 0x02, 0x55, 0x9F, 0xF3, 0x53, 0x23,
-    0x64, 0x60, 0x0D, 0xEE, 0xBA, 0xED, 0xAB, 0xC3, 0x55, 0x7F, 0xA7, 0x9D, 0xCF, 0xCC, 0xD0, 0x42,
-    0x44, 0x38, 0x51, 0xEA, 0x4D, 0xEE, 0xC6, 0x2D, 0x3B, 0xF1, 0x1E, 0x7A, 0x86, 0xFD, 0x7C, 0x43,
-    0x12, 0xF7, 0x25, 0xF7, 0xD9, 0xE7, 0xD8, 0x72, 0x49, 0x49, 0x9D, 0xA4, 0xB4, 0x18, 0xC6, 0xFB,
-    0x2A, 0x13, 0x62, 0x84, 0x7E, 0xF5, 0x19, 0xAF, 0x02, 0x1F, 0x29, 0xE0, 0x25, 0x21, 0x8C, 0x75,
-    0x7E, 0xB1, 0x85, 0x89, 0x56, 0x60, 0x5C, 0xE5, 0xEF, 0x88, 0xAA, 0x35, 0xCF, 0xA5, 0x47, 0xA2,
-    0x44, 0x15, 0x98, 0xE9, 0xBC, 0x60, 0x2D, 0x0A, 0x16, 0x3D, 0x47, 0xBA, 0x7D, 0x63, 0x3A, 0x59,
-    0x3E, 0x03, 0x13, 0xBE, 0x8C, 0x50, 0xB4, 0x99, 0x80, 0x5E, 0xE8, 0x61, 0x00, 0x1E, 0x4A, 0x11,
-    0x6C, 0x46, 0x52, 0xFB, 0x65, 0x9B, 0x67, 0xD1, 0x97, 0x22, 0x0A, 0x25, 0x3F, 0x13, 0x90, 0xDE,
-    0x6C, 0xE3, 0x45, 0xFE, 0x6E, 0x1B, 0x55, 0xEE, 0x95, 0x36, 0x84, 0xEB, 0x3A, 0xEA, 0xBC, 0x35,
-    0x55, 0xC3, 0xC6, 0xE8, 0x8E, 0x36, 0xB9, 0x2D, 0xB8, 0xD0, 0x09, 0xFC, 0xD2, 0xA6, 0x8F, 0xB1,
-    0x52, 0x41, 0x17, 0x55, 0x64, 0x3E, 0xA1, 0x54, 0xBB, 0xD7, 0xF7, 0xCE, 0x37, 0xBA, 0x8A, 0xAD,
-    0x56, 0x9D, 0x56, 0xB0, 0x8A, 0xA6, 0xB7, 0x1B, 0xA7, 0x55, 0x2E, 0xBD, 0xB7, 0xAF, 0x35, 0xD0,
-    0x06, 0x61, 0x97, 0x2A, 0xF3, 0x1B, 0x52, 0x49, 0x07, 0x6E, 0xD2, 0xBA, 0x95, 0xDF, 0x6A, 0xA5,
-    0xAA, 0xF3, 0xDB, 0x52, 0xCD, 0x9A, 0xFC, 0x53, 0x01, 0xA2, 0xD4, 0x1B, 0x43, 0xEF, 0xA8, 0x54,
-    0x18, 0x96, 0xCC, 0x34, 0x38, 0x95, 0x99, 0xEE, 0x83, 0xEE, 0x99, 0xB0, 0x42, 0xB8, 0x9D, 0xCC,
-    0x95, 0x7A, 0x03, 0xEF, 0xDA, 0x4C, 0xF9, 0x57, 0xA1, 0x95, 0x74, 0x79, 0xD3, 0xD9, 0x7B, 0x22,
-    0x03, 0x1B, 0x87, 0x3D, 0x6A, 0x83, 0x2E, 0xBD, 0x5D, 0x1B, 0x2B, 0x3B, 0xF7, 0x96, 0x10, 0x00,
-    0xE9, 0xC2, 0x2D, 0xA1, 0xFE, 0x61, 0x9D, 0xDE, 0x10, 0x09, 0x35, 0xAA, 0x44, 0x3F, 0xE5, 0x2C,
-    0xB9, 0x52, 0x21, 0x9D, 0x6B, 0xDC, 0x17, 0x68, 0xBE, 0x00, 0xBD, 0x4D, 0xE7, 0xB0, 0xF6, 0x45,
-    0x35, 0xCC, 0x63, 0xB0, 0x3A, 0x70, 0x03, 0x69, 0x50, 0xC6, 0x7C, 0x08, 0x24, 0xE4, 0xE8, 0x03,
-    0xB7, 0xF3, 0x1B, 0xB8, 0xB8, 0xE2, 0x0A, 0x44, 0x1B, 0xD2, 0xBE, 0xE8, 0x9E, 0xB0, 0xC9, 0xD7,
-    0x71, 0x05, 0xAA, 0x1E, 0x0B, 0xF9, 0x4A, 0x2A, 0xD4, 0xF8, 0x0B, 0x51, 0x03, 0x42, 0xDC, 0x9A,
-    0xD8, 0xD1, 0xA0, 0xE6, 0x88, 0x68, 0x30, 0x22, 0x81, 0x3F, 0xF4, 0x21, 0xC8, 0xFB, 0x07, 0xA0,
-    0xA8, 0xAA, 0x09, 0x41, 0xDF, 0x95, 0x79, 0x9E, 0x61, 0x7A, 0x65, 0x2D, 0x65, 0xFC, 0xB2, 0x96,
-    0x59, 0x72, 0xB3, 0x4D, 0x0B, 0x59, 0xD0, 0xA4, 0x4C, 0x5F, 0x69, 0xE3, 0xB9, 0x9D, 0xB4, 0xD1,
-    0x22, 0xA7, 0x4F, 0x04, 0x7C, 0xD2, 0xEA, 0xD2, 0x94, 0xB9, 0xFF, 0x3B, 0x21, 0xBA, 0x93, 0xB5,
-    0x60, 0x81, 0x4B, 0x12, 0x3D, 0x7C, 0x04, 0x9D, 0xE3, 0x57, 0x9F, 0xC2, 0xD5, 0xB9, 0xBB, 0x6D,
-    0x31, 0xFD, 0x7E, 0x65, 0x7D, 0xEC, 0x60, 0xE6, 0x6B, 0x3C, 0x17, 0xEF, 0x3B, 0x06, 0x2A, 0xA4,
-    0x3F, 0x73, 0x64, 0x55, 0xF9, 0x4D, 0xC7, 0x26, 0x45, 0x73, 0x98, 0xE1, 0x7D, 0xEE, 0x15, 0x50,
-    0x4C, 0x59, 0x68, 0x88, 0xFE, 0x26, 0xBF, 0x29, 0x52, 0x0D, 0x84, 0x96, 0x5B, 0x90, 0x60, 0xA4,
-    0xBE, 0x0D, 0xD9, 0x45, 0xB6, 0xD8, 0x94, 0x41, 0x3A, 0x0C, 0x71, 0xB1, 0xDC, 0x11, 0x56, 0x24,
-    0x2F, 0x69, 0x85, 0x7B, 0x47, 0x06, 0xF8, 0x55, 0xCB, 0x15, 0xAD, 0x09, 0x3B, 0x5D, 0xDD, 0x4C,
-    0x16, 0x17, 0x5E, 0x1F, 0x59, 0xD4, 0xCB, 0x0B, 0x19, 0x6E, 0xFA, 0x5E, 0x65, 0x45, 0xD0, 0xBF,
-    0x54, 0xD9, 0x59, 0x9D, 0x5E, 0x6C, 0x6C, 0x88, 0x70, 0x03, 0x1B, 0x2D, 0xD2, 0x77, 0xB0, 0x15,
-    0xCF, 0x98, 0x49, 0xA3, 0xB3, 0x89, 0x48, 0xB8, 0x1D, 0x38, 0x56, 0xD4, 0x3E, 0x70, 0x05, 0x8B,
-    0xD7, 0x60, 0xED, 0x7A, 0x13, 0xEF, 0x9D, 0x77, 0xD9, 0x73, 0x2A, 0x57, 0x7B, 0x90, 0xA9, 0x54,
-    0xFA, 0xB6, 0x05, 0xB7, 0xC5, 0x22, 0x3B, 0x77, 0x95, 0xD2, 0x34, 0xE5, 0xDA, 0x6C, 0x90, 0xC4,
-    0xD3, 0xA5, 0x60, 0x8E, 0x35, 0x3A, 0xA7, 0x2E, 0x6F, 0x58, 0x66, 0x5B, 0xB4, 0x7C, 0xC5, 0xE4,
-    0x77, 0xB3, 0x35, 0xCF, 0x36, 0x83, 0xC5, 0x30, 0xA0, 0x99, 0x0F, 0x3E, 0x05, 0x39, 0x09, 0xAE,
-    0xCE, 0x04, 0x15, 0x82, 0x36, 0xBD, 0x06, 0x39, 0xD1, 0x5B, 0xF3, 0x17, 0x90, 0xAF, 0x9E, 0xCB,
-    0xC0, 0xB2, 0x67, 0x88, 0xDF, 0xAB, 0x29, 0x12, 0xE7, 0x5C, 0x05, 0x59, 0x9A, 0xAD, 0x46, 0x79,
-    0x3A, 0xB0, 0x33, 0x6E, 0xE1, 0xFF, 0x88, 0xA1, 0xD0, 0xB8, 0x3E, 0xCB, 0xEF, 0x64, 0xD8, 0x37,
-    0x14, 0xE6, 0xE1, 0x80, 0x48, 0xBD, 0xF2, 0x28, 0x5F, 0x81, 0x7A, 0x08, 0xFD, 0xA0, 0x91, 0xE6,
-    0x44, 0x30, 0x57, 0x08, 0x73, 0x4E, 0x99, 0xCE, 0xF1, 0x6D, 0x52, 0xA7, 0x37, 0x1D, 0x03, 0x5D,
-    0x75, 0xD3, 0x70, 0x7A, 0xD0, 0xA1, 0xD3, 0xF6, 0x57, 0x66, 0x98, 0x90, 0x63, 0xA1, 0xA7, 0xD1,
-    0x0F, 0x84, 0x8E, 0xF8, 0x28, 0x14, 0x5C, 0x98, 0xB0, 0x40, 0x86, 0xE0, 0x01, 0x71, 0x08, 0xB3,
-    0x07, 0xC0, 0x02, 0xF7, 0xDB, 0x12, 0xBE, 0xE6, 0x74, 0xCF, 0x6D, 0x75, 0xB4, 0x90, 0x37, 0x94,
-    0x39, 0x19, 0x70, 0xD1, 0x8F, 0xDC, 0xBB, 0x27, 0xE8, 0x8F, 0x19, 0x42, 0xA5, 0xBC, 0x7F, 0x6B,
-    0xC2, 0x2D, 0x14, 0x0A, 0x3B, 0x62, 0x74, 0x95, 0xFC, 0x26, 0x43, 0x48, 0x88, 0x06, 0x7D, 0x00,
-    0xC1, 0xEF, 0x6C, 0x6E, 0xAE, 0xBB, 0x97, 0x3D, 0x04, 0xF9, 0xCF, 0x30, 0x17, 0x0E, 0xF7, 0x07,
-    0xCE, 0x3F, 0x1B, 0xA9, 0xEE, 0xC1, 0x36, 0x7D, 0xC0, 0x17, 0xDF, 0xE5, 0xC3, 0x1C, 0x56, 0x3E,
-    0x2F, 0xB5, 0xCB, 0x96, 0xB4, 0xCB, 0xEE, 0x6D, 0x35, 0xE9, 0x62, 0x46, 0xDB, 0x92, 0xDD, 0xBD,
-    0xDE, 0xCB, 0x03, 0x5A, 0xE4, 0x33, 0x6D, 0x4C, 0x22, 0xD8, 0x24, 0x7B, 0xF4, 0xF4, 0x57, 0x63,
-    0x4F, 0x0C, 0x72, 0x0B, 0x5C, 0xC6, 0x60, 0x46, 0xF0, 0x92, 0x08, 0x5E, 0x18, 0x13, 0xF7, 0x05,
-    0x5D, 0xFC, 0xF0, 0x1C, 0xC1, 0xE1, 0x5F, 0x93, 0xD1, 0x43, 0x5A, 0x02, 0x86, 0x31, 0x6A, 0x1E,
-    0x72, 0xC3, 0x04, 0x52, 0x91, 0x3C, 0xCE, 0x50, 0x5B, 0x86, 0x5C, 0x99, 0xFC, 0x3D, 0x46, 0x75,
-    0x7C, 0xCA, 0xB0, 0x8E, 0xCF, 0x00, 0xE3, 0x7B, 0x73, 0xE3, 0x25, 0x51, 0x0F, 0x75, 0xC3, 0x4C,
-    0x97, 0xF3, 0x09, 0x5F, 0x1E, 0xA2, 0x0B, 0x05, 0x61, 0x45, 0x8A, 0x5B, 0x88, 0xD0, 0xE5, 0x36,
-    0x44, 0xE4, 0x42, 0x2C, 0x15, 0x94, 0x35, 0xE1, 0x06, 0xF2, 0x56, 0xA1, 0x2B, 0xD3, 0x2E, 0x11,
-    0x4E, 0xD9, 0x73, 0xBE, 0x72, 0xF0, 0x4F, 0xF4, 0x7D, 0x65, 0xE9, 0x8B, 0x07, 0x99, 0xF6, 0xD4,
-    0x06, 0x02, 0x5B, 0xC3, 0x5A, 0xA3, 0x80, 0x53, 0x6C, 0xE0, 0x3E, 0xE2, 0xF6, 0x9C, 0xA2, 0x43,
-    0xA7, 0x46, 0xB6, 0x91, 0x67, 0x3A, 0xF8, 0xB3, 0x2F, 0x6F, 0xF8, 0x30, 0xD3, 0xE8, 0xD7, 0xD2,
-    0xD4, 0xB4, 0x86, 0x76, 0xD9, 0x22, 0xD1, 0xE3, 0x79, 0xAF, 0x32, 0x3F, 0xF6, 0xA9, 0x19, 0xFD,
-    0x9C, 0x1B, 0x24, 0x45, 0x8D, 0xA0, 0x31, 0x3E, 0xB8, 0xB0, 0xF4, 0x08, 0xBE, 0xED, 0x4D, 0x73,
-    0x70, 0x30, 0x2A, 0x69, 0x4A, 0x60, 0x34, 0x45, 0xC8, 0xC4, 0x1C, 0x01, 0x85, 0x2D, 0x83, 0xAE,
-    0x11, 0xDD, 0xDA, 0xD2, 0x0E, 0x2A, 0x33, 0x25, 0x9F, 0xA0, 0x98, 0xC0, 0xE1, 0xD4, 0xCD, 0xDA,
-    0x89, 0xFF, 0x84, 0x7F, 0xFA, 0x69, 0x02, 0x66, 0x80, 0xFB, 0x64, 0x2F, 0x4B, 0xEF, 0xF9, 0xAC,
-    0x71, 0x6F, 0x20, 0xEC, 0x03, 0xF3, 0x9B, 0x7F, 0xA6, 0xB3, 0x2E, 0x57, 0x84, 0x59, 0xEB, 0x7B,
-    0xC1, 0xEB, 0x10, 0x20, 0x55, 0x71, 0xF6, 0xB4, 0x7F, 0x91, 0x9A, 0x3A, 0x9C, 0x86, 0xCC, 0xD0,
-    0x74, 0xA0, 0x2E, 0x62, 0x8A, 0x7D, 0xD3, 0x65, 0xEE, 0xCA, 0xAC, 0x5D, 0x46, 0xCD, 0x0C, 0x23,
-    0xA7, 0xB6, 0xA3, 0x5F, 0x51, 0x62, 0xD3, 0x4F, 0xD9, 0xC1, 0xDB, 0x96, 0x9B, 0x2B, 0x9D, 0xAB,
-    0x3F, 0x17, 0x23, 0xB6, 0xDC, 0x66, 0x31, 0x94, 0x94, 0x04, 0x1E, 0x4D, 0x08, 0xE1, 0xB2, 0xE1,
-    0xBA, 0xB0, 0x9D, 0xD0, 0xEB, 0xDB, 0x4F, 0xDB, 0x29, 0x83, 0x61, 0x7A, 0x8C, 0x1E, 0x8A, 0xB9,
-    0x0B, 0xFA, 0xB0, 0xE1, 0x07, 0xE3, 0xA2, 0x4A, 0x03, 0x17, 0xEC, 0x85, 0x4A, 0x63, 0x57, 0xD3,
-    0x9D, 0x39, 0x1F, 0x17, 0x26, 0x20, 0x82, 0x96, 0x34, 0x28, 0x03, 0x29, 0x34, 0x32, 0x00, 0x3D,
-    0x9A, 0x6A, 0xB8, 0x99, 0x76, 0x43, 0x87, 0x07, 0x9C, 0x58, 0x8E, 0x29, 0x1C, 0x3E, 0xC4, 0xF5,
-    0x81, 0xA1, 0xC5, 0x43, 0xE8, 0x43, 0x3C, 0x0C, 0x2C, 0xD6, 0x71, 0x9D, 0x36, 0x4B, 0xCA, 0x7B,
-    0x9A, 0x8C, 0x8B, 0x56, 0xD1, 0x09, 0xA9, 0xE1, 0x8C, 0x52, 0x5A, 0xD4, 0x27, 0x9F, 0x38, 0xDC,
-    0x1E, 0xC0, 0xDF, 0x0A, 0x26, 0x46, 0x37, 0xE3, 0x1C, 0xCC, 0x2A, 0x27, 0x4C, 0x17, 0x87, 0xE0,
-    0x9C, 0xF6, 0xA0, 0xB9, 0xDE, 0x9F, 0xE0, 0xD9, 0x32, 0xEA, 0xE3, 0x4B, 0x88, 0xF4, 0x1A, 0xCC,
-    0xFB, 0xAD, 0x7F, 0x97, 0x0C, 0xA8, 0x5F, 0x51, 0xFF, 0xE7, 0xB2, 0xC1, 0x3B, 0x0E, 0x8D, 0x9D,
-    0xAE, 0xFB, 0x89, 0xD3, 0x74, 0x07, 0x61, 0x79, 0xDF, 0xF4, 0x70, 0x2B, 0x54, 0x1A, 0xE5, 0x38,
-    0xB7, 0xC8, 0x3E, 0x00, 0x58, 0xAC, 0x00, 0x33, 0x12, 0xD2, 0xC5, 0x55, 0x5B, 0xC6, 0x72, 0x73,
-    0x41, 0x55, 0x80, 0x0D, 0x98, 0x2D, 0x18, 0x3B, 0xB8, 0x2F, 0xCD, 0xD5, 0xF1, 0x8A, 0xCE, 0xFC,
-    0x8C, 0x44, 0x8E, 0xA1, 0x4D, 0x60, 0xBD, 0xEC, 0x49, 0xFC, 0xB2, 0x46, 0xAB, 0x9D, 0x4A, 0x83,
-    0xF5, 0xE8, 0x90, 0xD8, 0xD7, 0x43, 0xDE, 0xCA, 0x9F, 0xFB, 0x86, 0xBE, 0xAF, 0x57, 0x7B, 0x13,
-    0xF6, 0xEA, 0x58, 0x40, 0xC8, 0x88, 0x2C, 0x99, 0xE8, 0x07, 0xB2, 0x35, 0xFB, 0x0B, 0xE6, 0xF7,
-    0x2E, 0x88, 0x18, 0xD1, 0x04, 0xDC, 0xE8, 0x1A, 0x4E, 0x08, 0x9D, 0x52, 0x77, 0xB4, 0xD6, 0x70,
-    0x8A, 0x98, 0x95, 0x5E, 0xB4, 0x5E, 0xF3, 0x37, 0x1D, 0x6A, 0x46, 0x41, 0x31, 0x8C, 0x17, 0x94,
-    0xA0, 0xA0, 0x79, 0x1B, 0x61, 0x3A, 0xC0, 0xB6, 0x10, 0x86, 0x93, 0x2F, 0xDC, 0xBE, 0x9A, 0x31,
-    0x35, 0x28, 0xD8, 0xB9, 0x7D, 0xCE, 0xB6, 0x68, 0xA2, 0x39, 0xE7, 0xFB, 0x8C, 0x37, 0xC1, 0xBD,
-    0x9D, 0xA9, 0x66, 0xB8, 0xE7, 0x37, 0x3B, 0xD5, 0x95, 0xAF, 0x89, 0x38, 0xD3, 0x9F, 0xFD, 0xD1,
-    0x8F, 0x56, 0x81, 0x2E, 0x43, 0x35, 0xD1, 0x6A, 0xE6, 0x49, 0x41, 0x36, 0xDE, 0x1D, 0x8D, 0xA8,
-    0xE2, 0x32, 0xA3, 0x6D, 0xC8, 0x25, 0xAB, 0x11, 0x15, 0x9C, 0xEC, 0x7D, 0x3F, 0xF8, 0xA1, 0xD3,
-    0x80, 0x3D, 0x68, 0xD4, 0x94, 0x83, 0xAC, 0xDA, 0x29, 0x6D, 0x19, 0xBC, 0x49, 0x65, 0x8E, 0x86,
-    0x1D, 0xAB, 0x46, 0x1E, 0xAA, 0xE0, 0xC0, 0x32, 0x54, 0x45, 0xBA, 0xB7, 0xE5, 0xBE, 0x47, 0x71,
-    0xC9, 0x6B, 0x2A, 0x09, 0x9D, 0xCE, 0x0D, 0xAD, 0xCC, 0x7E, 0x65, 0xCC, 0xE6, 0xE6, 0xE6, 0x9A,
-    0xCD, 0x8C, 0x03, 0xFC, 0x0F, 0xDF, 0xF9, 0x03, 0x1D, 0xE7, 0xEF, 0x8C, 0x9C, 0x59, 0x7F, 0xEB,
-    0x0C, 0x0E, 0x26, 0xD8, 0xDC, 0xDC, 0x20, 0x1A, 0x52, 0xD8, 0xF3, 0x0B, 0x30, 0xB9, 0x51, 0x2E,
-    0xCC, 0x81, 0x9F, 0xA7, 0x6D, 0x9A, 0xD0, 0x9F, 0x09, 0x10, 0x03, 0xB2, 0x26, 0x75, 0xD2, 0xA9,
-    0x20, 0x95, 0xEC, 0x64, 0x33, 0xC9, 0x48, 0x3F, 0x92, 0x65, 0xA0, 0xA6, 0xA6, 0xA8, 0xAD, 0x83,
-    0xF4, 0x88, 0x40, 0xCD, 0x48, 0x85, 0xE3, 0xBB, 0x6F, 0x63, 0x57, 0xF6, 0x3E, 0xB6, 0x59, 0x29,
-    0xC0, 0xAC, 0x1F, 0xC2, 0x7A, 0x8E, 0x05, 0xEA, 0xB5, 0x93, 0xA9, 0x2A, 0xB1, 0x4B, 0xD3, 0xBD,
-    0xF3, 0xD9, 0xD8, 0x1B, 0x3B, 0x2E, 0xF8, 0x8E, 0xCE, 0xD3, 0xBD, 0xBF, 0x07, 0xDA, 0x81, 0xE9,
-    0xC5, 0xB3, 0x2A, 0xB1, 0x07, 0xC7, 0x14, 0x95, 0xB5, 0xA1, 0xBF, 0xCD, 0xCD, 0x77, 0x42, 0xD9,
-    0x66, 0x17, 0xB8, 0x58, 0x26, 0x20, 0x4F, 0x17, 0xB2, 0xF8, 0x65, 0x7B, 0x66, 0x3A, 0xFF, 0xCE,
-    0x77, 0xC3, 0x42, 0x38, 0xB9, 0xEF, 0x30, 0x0D, 0x01, 0x32, 0x9F, 0xBF, 0x96, 0xA9, 0x9D, 0xFF,
-    0x7D, 0x23, 0x97, 0xCC, 0x6C, 0xBC, 0x6A, 0x7F, 0x9A, 0xC2, 0xB4, 0xDE, 0x7E, 0xBC, 0xB9, 0xF1,
-    0x8F, 0xF5, 0x8B, 0xA4, 0x39, 0xE7, 0x7A, 0xA1, 0x7C, 0xF9, 0x22, 0x3D, 0x83, 0xE0, 0x88, 0x5C,
-    0x96, 0xAF, 0x33, 0x3F, 0x31, 0x69, 0x76, 0x1A, 0xF6, 0x44, 0x70, 0x92, 0x2C, 0x36, 0x9D, 0xB9,
-    0x62, 0x4E, 0x5F, 0x15, 0xC4, 0x29, 0x64, 0x86, 0x3E, 0xBE, 0xD0, 0xFF, 0xC4, 0xFC, 0x57, 0x2C,
-    0xC6, 0xC0, 0x9D, 0x23, 0x3F, 0x1B, 0xE6, 0x0F, 0x86, 0x97, 0x3D, 0x3F, 0x59, 0xC7, 0x96, 0x84,
-    0xE6, 0x92, 0x42, 0x95, 0x63, 0x91, 0x12, 0x4C, 0x50, 0xFE, 0x0B, 0x69, 0xA0, 0xFC, 0x63, 0x11,
-    0xF1, 0xCF, 0x60, 0xE7, 0x9C, 0x31, 0x27, 0xF9, 0x39, 0xAD, 0x16, 0xE2, 0x7F, 0xEB, 0x13, 0xE2,
-    0x44, 0x24, 0xFA, 0x93, 0x7F, 0xCF, 0xDD, 0xFF, 0xD6, 0xFC, 0xFB, 0xDF, 0x52, 0x06, 0x72, 0xC5,
-    0x3C, 0xD4, 0x8F, 0x6A, 0x3A, 0xCB, 0x8E, 0x55, 0xBE, 0x63, 0xC5, 0x1F, 0x0F, 0x37, 0x68, 0xC7,
-    0x06, 0xB2, 0x12, 0x0E, 0xAC, 0xFB, 0xF7, 0x76, 0xFC, 0x87, 0x7F, 0x3A, 0xCD, 0x0E, 0xB6, 0xF9,
-    0x9D, 0xE1, 0xC3, 0x7F, 0x1C, 0x3E, 0x2C, 0x03, 0x6F, 0x94, 0x58, 0x7D, 0xCB, 0x04, 0x9E, 0x86,
-    0x19, 0x11, 0xF7, 0x02, 0x79, 0x3B, 0x16, 0xCA, 0xC4, 0xBA, 0xD6, 0x3E, 0xAC, 0x4C, 0xEE, 0x98,
-    0x70, 0x94, 0x40, 0xD9, 0x62, 0xDC, 0x89, 0xE3, 0x7F, 0x74, 0x51, 0x27, 0xD9, 0x30, 0x3F, 0x7B,
-    0x9E, 0x09, 0x23, 0x99, 0xE8, 0xDF, 0xE9, 0x0C, 0x96, 0x27, 0x9F, 0x1B, 0x0E, 0xFD, 0xF7, 0xA5,
-    0x80, 0xEC, 0xB2, 0x2F, 0x8C, 0x2C, 0xC6, 0x60, 0xFE, 0x94, 0x6E, 0x0E, 0xF3, 0x63, 0xF3, 0xA2,
-    0xBE, 0x55, 0xE8, 0xEB, 0x30, 0x40, 0xE5, 0xE1, 0x41, 0x35, 0x42, 0x60, 0xED, 0xD5, 0xFA, 0x9B,
-    0x27, 0x1F, 0x9A, 0x17, 0x0A, 0xB2, 0x40, 0xCC, 0x7E, 0xD0, 0xFB, 0x70, 0x52, 0x25, 0x96, 0x89,
-    0xBA, 0x18, 0x83, 0x7F, 0x33, 0x1A, 0xB2, 0xBC, 0x8E, 0x36, 0x1F, 0x11, 0x37, 0xB5, 0xCA, 0xB5,
-    0x72, 0xAC, 0x26, 0x5A, 0x4D, 0x7B, 0x56, 0xE1, 0x1E, 0xAB, 0xF8, 0xD7, 0xAC, 0xD2, 0xCF, 0x59,
-    0xD9, 0x9B, 0xAC, 0xDC, 0x2B, 0xA8, 0x2E, 0xF6, 0xB4, 0x68, 0x5F, 0xA2, 0xE1, 0x22, 0xBF, 0x5C,
-    0xB3, 0xDA, 0xAA, 0x58, 0xD9, 0x39, 0x2B, 0xB8, 0x2F, 0x28, 0xA1, 0x4E, 0x60, 0xB9, 0xEB, 0xB4,
-    0x6A, 0x0D, 0x6C, 0x6A, 0x79, 0xA5, 0xAE, 0xA0, 0x21, 0x87, 0x6F, 0x29, 0xF5, 0x68, 0x10, 0xC8,
-    0x10, 0x69, 0xE5, 0xA3, 0xF4, 0xD3, 0x25, 0xF1, 0x8C, 0xE7, 0x01, 0x62, 0x2B, 0x21, 0x1D, 0x8B,
-    0x28, 0x77, 0xAE, 0x25, 0xA1, 0xAD, 0x48, 0x47, 0xB0, 0xC2, 0xC1, 0x2A, 0x8E, 0xDA, 0x66, 0x48,
-    0x79, 0xB1, 0xD9, 0x8C, 0x30, 0x22, 0x4C, 0x08, 0x73, 0x42, 0x07, 0x72, 0xFE, 0x4A, 0x2F, 0xE3,
-    0xB7, 0xAF, 0xB5, 0x80, 0x6F, 0xD4, 0x80, 0x5B, 0x15, 0xA0, 0x70, 0x2D, 0xBA, 0xB5, 0x08, 0xC9,
-    0x99, 0x61, 0xEC, 0x2A, 0x2D, 0x34, 0xF2, 0x02, 0xFE, 0x67, 0x15, 0x32, 0xF2, 0x91, 0xCE, 0xA8,
-    0x76, 0xC2, 0x6E, 0x35, 0x22, 0x59, 0x1F, 0x8E, 0x89, 0x20, 0xE9, 0x3F, 0x34, 0x74, 0x8A, 0x8D,
-    0xC0, 0xEA, 0xEA, 0x0C, 0xB2, 0xCA, 0x6C, 0x90, 0xD1, 0x08, 0x0A, 0xD8, 0xFF, 0xCB, 0x99, 0x0F,
-    0x36, 0x27, 0x5B, 0x50, 0x16, 0x51, 0xCE, 0xFA, 0x1D, 0xFA, 0xDD, 0x78, 0x1F, 0x6D, 0x43, 0x57,
-    0x0E, 0x7A, 0x27, 0x0F, 0xF9, 0x64, 0xDC, 0xA1, 0xAB, 0x07, 0x81, 0xDB, 0xA7, 0x75, 0xA4, 0xF3,
-    0x7E, 0x9A, 0xE6, 0xB4, 0x2B, 0x28, 0xD7, 0x7A, 0x10, 0x78, 0xD9, 0x6B, 0xB8, 0x65, 0x41, 0xB7,
-    0x7C, 0xAE, 0x99, 0x44, 0x0B, 0x66, 0xA9, 0x95, 0x71, 0x03, 0x96, 0x86, 0x5E, 0xE6, 0x37, 0x3E,
-    0x69, 0xF3, 0xDB, 0xF7, 0xDA, 0xFC, 0x96, 0x6B, 0x56, 0x61, 0xA3, 0x72, 0xEF, 0xEE, 0x07, 0x22,
-    0x0E, 0xCC, 0x90, 0xA1, 0x7C, 0x6C, 0x02, 0xB5, 0x8F, 0xFF, 0x29, 0x47, 0xF1, 0x3F, 0x0D, 0x63,
-    0x7D, 0xE8, 0xE2, 0xF1, 0xE5, 0x9D, 0xBF, 0x6E, 0xED, 0x6D, 0xD7, 0xDA, 0x9F, 0xB9, 0xC6, 0x7E,
-    0xED, 0x86, 0xF8, 0x9F, 0xB9, 0xBD, 0x0C, 0xA7, 0xFB, 0xBF, 0x92, 0x12, 0x94, 0xC7, 0xC6, 0xFF,
-    0xC0, 0xAE, 0x32, 0x2A, 0xF9, 0x28, 0x96, 0x47, 0x73, 0x22, 0x8C, 0x79, 0xD4, 0xC2, 0xAC, 0x4B,
-    0xB7, 0xFC, 0x95, 0x66, 0xFD, 0xEF, 0x9D, 0xCD, 0x93, 0x38, 0x64, 0x61, 0xEE, 0x5B, 0x2B, 0xAD,
-    0xE2, 0xC9, 0xB8, 0xE4, 0x14, 0x48, 0xB5, 0xFC, 0xF3, 0x7E, 0x3B, 0x3B, 0xEA, 0x9E, 0x71, 0x89,
-    0xD4, 0xBC, 0xA4, 0xA5, 0xDF, 0xBE, 0xA2, 0xC6, 0x4D, 0x63, 0x2E, 0xEC, 0xBD, 0xB9, 0x74, 0xF0,
-    0xA2, 0x0C, 0xDF, 0x1F, 0x2C, 0x43, 0x74, 0xC5, 0x1A, 0x28, 0x8F, 0xC8, 0xE6, 0x50, 0xCB, 0xFF,
-    0x47, 0x9A, 0x61, 0xBF, 0x4C, 0x57, 0x92, 0x4D, 0x74, 0x77, 0x0B, 0x52, 0x4E, 0xE0, 0x53, 0x9A,
-    0x86, 0xA4, 0x14, 0x26, 0xE3, 0xC4, 0x4B, 0x70, 0x40, 0x02, 0x11, 0xAA, 0x1B, 0x0B, 0xB6, 0x43,
-    0x5C, 0x84, 0xA8, 0x0B, 0xC3, 0x17, 0x55, 0xD6, 0xE7, 0xCD, 0x7A, 0x96, 0x1E, 0xB2, 0xF6, 0xD6,
-    0x02, 0x31, 0x16, 0x34, 0xFA, 0x30, 0x43, 0xEF, 0x0B, 0x37, 0xB8, 0xFA, 0x6A, 0x2D, 0x43, 0xAC,
-    0xD9, 0x30, 0x34, 0x79, 0xE7, 0x2E, 0xE5, 0xA1, 0x92, 0xCE, 0x75, 0xDB, 0x0C, 0x7C, 0x0D, 0x51,
-    0xF9, 0x3C, 0x7F, 0x00, 0x0E, 0xF6, 0x08, 0xC1, 0x7D, 0x54, 0x80, 0x69, 0x6A, 0x12, 0xF2, 0x15,
-    0x38, 0xF5, 0xBA, 0xBC, 0x43, 0x43, 0xAA, 0x49, 0x6F, 0x38, 0x6E, 0xA5, 0xF8, 0xD7, 0xB0, 0x8F,
-    0xC2, 0xCD, 0xE6, 0x38, 0x86, 0x69, 0xEF, 0x88, 0x7B, 0x3E, 0xEE, 0x59, 0x38, 0xA0, 0xE3, 0x24,
-    0x45, 0x5F, 0x3B, 0x1D, 0xE8, 0xE7, 0x8E, 0xD4, 0xCE, 0xCA, 0xF3, 0x34, 0x33, 0xBC, 0x0C, 0xFB,
-    0x29, 0x73, 0x26, 0x40, 0xD2, 0x99, 0xB2, 0x25, 0xB8, 0x1D, 0x53, 0x17, 0x15, 0x2D, 0x15, 0xE2,
-    0xAD, 0x68, 0xB6, 0x88, 0xC0, 0xF5, 0x6E, 0xC4, 0x61, 0xB6, 0x1E, 0xA2, 0xA6, 0x22, 0x0C, 0xB5,
-    0x05, 0x7A, 0xBA, 0xCA, 0xD1, 0x4E, 0xFD, 0xDD, 0x4E, 0xB3, 0x33, 0xD9, 0x97, 0xB8, 0xE2, 0x50,
-    0xA4, 0xC7, 0xB4, 0x82, 0x6B, 0xCC, 0xD3, 0x4C, 0xC6, 0x03, 0x9B, 0x6A, 0xE3, 0x20, 0x06, 0xA6,
-    0x95, 0xA3, 0x47, 0xB9, 0x74, 0x33, 0x98, 0xC2, 0x33, 0x37, 0x71, 0x9B, 0x4C, 0x8C, 0x71, 0x2E,
-    0x42, 0xC6, 0x59, 0xEA, 0x90, 0xE2, 0x8D, 0xC0, 0xC7, 0xB1, 0x7D, 0xED, 0x7E, 0xD5, 0xF6, 0x13,
-    0xCB, 0x53, 0x3C, 0x87, 0x5C, 0x1C, 0x48, 0x29, 0xF2, 0x39, 0x80, 0x89, 0xBF, 0x51, 0x51, 0xF6,
-    0x05, 0xEF, 0xCE, 0x7E, 0xD4, 0xD0, 0xD8, 0xD8, 0xB7, 0x3F, 0xA9, 0x95, 0xDB, 0xC3, 0xA6, 0xE2,
-    0xDB, 0xA7, 0x72, 0x07, 0xEC, 0x57, 0x03, 0xBC, 0xB7, 0xC6, 0xF3, 0x3C, 0x0B, 0xEA, 0x7F, 0xB0,
-    0xF1, 0xDE, 0x1A, 0x52, 0x6B, 0x60, 0x24, 0xD1, 0x04, 0x85, 0xFC, 0x33, 0x98, 0xE6, 0x6F, 0x33,
-    0xB9, 0xC8, 0x99, 0x23, 0xF2, 0x05, 0x1D, 0x43, 0x68, 0x3B, 0xB4, 0x8C, 0xB4, 0x7D, 0x77, 0x44,
-    0x32, 0xF4, 0x01, 0x60, 0x7C, 0x56, 0x60, 0x91, 0xC0, 0xA2, 0x23, 0xA3, 0xA4, 0xF3, 0xCB, 0x21,
-    0xB1, 0x14, 0xF9, 0x3A, 0xC6, 0x7D, 0x50, 0x0D, 0xE6, 0x6F, 0x28, 0x8D, 0xEE, 0x32, 0x94, 0xCD,
-    0x4B, 0xC8, 0x71, 0x7A, 0x57, 0xF1, 0xE3, 0x0E, 0x9D, 0x6C, 0x25, 0xC6, 0x5C, 0x82, 0x11, 0x2D,
-    0x6D, 0xE2, 0x47, 0x81, 0x17, 0x0A, 0xAA, 0xB3, 0x48, 0x1F, 0x32, 0xF6, 0xF6, 0x7B, 0xA2, 0xCD,
-    0xDE, 0x96, 0x06, 0x85, 0x76, 0x57, 0x00, 0x25, 0x40, 0x26, 0x40, 0x9A, 0xB7, 0x9F, 0xC2, 0xCF,
-    0x73, 0xAF, 0x52, 0xB7, 0x87, 0xB1, 0x18, 0xB9, 0xFD, 0x04, 0x4E, 0x9F, 0xDB, 0xCE, 0x2C, 0x6F,
-    0x96, 0x7D, 0x7D, 0x5B, 0xB8, 0xB0, 0xB4, 0x22, 0xBA, 0xD3, 0x0D, 0x91, 0xD8, 0x61, 0x79, 0x81,
-    0x71, 0x4F, 0xFA, 0x22, 0xC3, 0x72, 0x7F, 0x91, 0xD4, 0xEE, 0x72, 0x3E, 0x77, 0x97, 0xA5, 0xA3,
-    0x97, 0x05, 0x09, 0xE5, 0x36, 0x0C, 0x88, 0x1E, 0x58, 0x19, 0x0E, 0x46, 0xE3, 0x2E, 0x0B, 0xCA,
-    0x5F, 0x16, 0x4C, 0xBD, 0x2C, 0xCF, 0x5C, 0x16, 0xFC, 0xFD, 0x8B, 0xB8, 0x91, 0x71, 0xF4, 0x3C,
-    0x33, 0x02, 0x91, 0x34, 0x73, 0x8B, 0xA4, 0x1E, 0x27, 0xE3, 0x95, 0xE7, 0x2E, 0x49, 0x97, 0xF7,
-    0xDF, 0x68, 0x64, 0x2B, 0x24, 0x38, 0x56, 0x42, 0xE6, 0x2B, 0xDE, 0x5F, 0x11, 0x24, 0x05, 0x05,
-    0x32, 0x79, 0xE5, 0x42, 0x95, 0xE2, 0x96, 0x18, 0x37, 0x33, 0x28, 0x67, 0xAA, 0xDE, 0xD5, 0x42,
-    0x1A, 0xB5, 0x70, 0xEF, 0xA7, 0x68, 0xDE, 0x1B, 0x6A, 0xC6, 0x7C, 0x9A, 0xEA, 0x7C, 0xEB, 0xC1,
-    0x70, 0xC1, 0xCE, 0xC1, 0x75, 0xB3, 0x90, 0xA1, 0xE1, 0x08, 0x7F, 0x0C, 0x91, 0x91, 0x85, 0xC0,
-    0x25, 0x13, 0xEE, 0xF1, 0x10, 0x0F, 0x68, 0x5A, 0xDF, 0x90, 0xB3, 0xC3, 0x80, 0xD6, 0x08, 0x56,
-    0x84, 0xA2, 0xD9, 0x0A, 0x90, 0x97, 0x87, 0x08, 0xFB, 0x0E, 0x11, 0xF4, 0x8D, 0xD8, 0x89, 0x05,
-    0x1D, 0x64, 0x05, 0x1D, 0xC8, 0xA0, 0x73, 0x50, 0x2E, 0xA1, 0x07, 0x1B, 0xC5, 0x41, 0x6F, 0x97,
-    0x20, 0x16, 0x2A, 0x1A, 0x2A, 0x1E, 0x2A, 0x22, 0x0E, 0x09, 0x33, 0x58, 0x10, 0xC5, 0x45, 0x45,
-    0x46, 0xEF, 0xBC, 0x25, 0x3A, 0x2A, 0x3E, 0x6A, 0x02, 0x2B, 0xAD, 0x69, 0x86, 0x0E, 0x5B, 0xE2,
-    0x3D, 0x0E, 0x16, 0x59, 0xBD, 0x51, 0x60, 0xB2, 0x30, 0x9B, 0xFA, 0x46, 0x21, 0x99, 0x40, 0x14,
-    0xA6, 0xDF, 0xA7, 0x9F, 0xF2, 0x7C, 0x94, 0x7B, 0x24, 0x89, 0xF7, 0xC8, 0x06, 0xD8, 0x87, 0x94,
-    0xFD, 0x49, 0xE9, 0x2F, 0x86, 0x47, 0x02, 0x10, 0x44, 0x89, 0xD9, 0x14, 0x02, 0x35, 0x0F, 0x33,
-    0x59, 0x3C, 0x0C, 0xC4, 0x39, 0x02, 0x9A, 0x75, 0xB9, 0x0E, 0x1F, 0xF8, 0xAC, 0xA6, 0x98, 0xAE,
-    0x43, 0x8A, 0xA5, 0x27, 0x80, 0x1A, 0xA5, 0x72, 0x1F, 0xC0, 0x18, 0xAB, 0x15, 0xB8, 0x73, 0xFE,
-    0xA8, 0xFB, 0x10, 0x86, 0x33, 0x80, 0x41, 0xD4, 0x3C, 0x0A, 0x4C, 0x3E, 0x64, 0xEF, 0xEA, 0xA3,
-    0xE1, 0xE3, 0x9D, 0x95, 0xA3, 0x20, 0x3A, 0xE8, 0x0E, 0xC2, 0x6E, 0x53, 0xC7, 0x31, 0x40, 0x22,
-    0xFC, 0x1A, 0xC4, 0xA0, 0xD7, 0xEF, 0x39, 0x06, 0xE6, 0x9E, 0x9B, 0xE6, 0x3E, 0x10, 0xF7, 0x50,
-    0x5D, 0x9A, 0x13, 0xD7, 0xDB, 0xD7, 0xB4, 0xD6, 0xC0, 0x04, 0xE3, 0xFD, 0xA6, 0xEA, 0xDD, 0x45,
-    0x7D, 0x67, 0xC7, 0xE9, 0xFD, 0x53, 0xA7, 0xE4, 0x4C, 0xF3, 0xB2, 0x89, 0xDE, 0x5A, 0xA7, 0xF3,
-    0xE3, 0xEA, 0x75, 0x5B, 0xA3, 0x37, 0xDB, 0xFA, 0x64, 0xFC, 0x97, 0x76, 0x9C, 0x3F, 0x95, 0xA6,
-    0xF3, 0x75, 0xED, 0x6B, 0x2F, 0xAB, 0x6E, 0x70, 0x5E, 0xEA, 0x03, 0xF0, 0xCE, 0x85, 0x9A, 0x51,
-    0x49, 0x87, 0x21, 0x98, 0x26, 0xC3, 0x20, 0x08, 0x45, 0x04, 0x8E, 0xF6, 0x1D, 0x05, 0x9F, 0x84,
-    0xA2, 0x8F, 0x08, 0xD2, 0x02, 0x35, 0x52, 0x6A, 0x80, 0x2B, 0xD5, 0x4B, 0x35, 0x2F, 0x9A, 0x9A,
-    0xF7, 0x89, 0xD5, 0x64, 0x02, 0xC6, 0x4F, 0xF3, 0xBA, 0xD9, 0xDC, 0x9C, 0xE3, 0x48, 0xAC, 0x66,
-    0xB7, 0xA2, 0xBB, 0xA1, 0xFB, 0x2F, 0x99, 0x9E, 0x66, 0x65, 0x28, 0x32, 0xCD, 0x85, 0xDA, 0x81,
-    0x89, 0xA7, 0x73, 0xB0, 0xC6, 0x74, 0x9E, 0x7C, 0xC9, 0xC8, 0x80, 0x72, 0x1D, 0xC2, 0xC1, 0xB8,
-    0x84, 0x55, 0xF2, 0x53, 0x64, 0x4D, 0x47, 0x5F, 0x21, 0x6B, 0x3A, 0xA4, 0xFB, 0xEE, 0x0B, 0xF5,
-    0x80, 0xBB, 0xBB, 0xEA, 0xED, 0x2F, 0xA9, 0x9D, 0xC0, 0x77, 0x72, 0xDA, 0xAD, 0x29, 0xC3, 0x90,
-    0xD9, 0x66, 0x9A, 0x6F, 0x07, 0xD6, 0xBC, 0xC7, 0x1C, 0xD6, 0x04, 0xAB, 0x08, 0xC4, 0xBB, 0x81,
-    0x19, 0x79, 0xB7, 0x4D, 0x0B, 0x01, 0x89, 0x68, 0xB1, 0xF2, 0x29, 0xA7, 0x0B, 0x7D, 0xDE, 0x5B,
-    0x93, 0x34, 0x30, 0x8A, 0x7B, 0x4D, 0xCA, 0x95, 0x1A, 0xB0, 0xA1, 0x07, 0x28, 0x99, 0x43, 0xD9,
-    0xCD, 0xC1, 0x7A, 0x76, 0x73, 0xBC, 0x9E, 0xDD, 0x3C, 0x32, 0x9A, 0x95, 0xEB, 0x96, 0xB3, 0x43,
-    0x46, 0x33, 0x66, 0x37, 0xDB, 0xF5, 0xEC, 0x66, 0x20, 0xC1, 0x7F, 0xE7, 0xFA, 0x73, 0x21, 0x0A,
-    0x0F, 0xA6, 0xCB, 0xD0, 0x2E, 0xD1, 0x28, 0x87, 0x60, 0xCD, 0x6C, 0x2D, 0x85, 0xA1, 0xD2, 0xF7,
-    0x1C, 0x6B, 0x34, 0xEB, 0xCE, 0xE3, 0x5E, 0xC4, 0x3A, 0x94, 0x74, 0x35, 0x84, 0xF3, 0x63, 0x05,
-    0xA1, 0xF5, 0xB4, 0x6A, 0x05, 0x8F, 0x21, 0x99, 0x5A, 0xD3, 0x9D, 0xDB, 0x31, 0x18, 0xEB, 0xBF,
-    0x47, 0x00, 0xDD, 0xCB, 0xDD, 0x50, 0xCE, 0x5E, 0xF8, 0xFA, 0xCD, 0xA5, 0xFC, 0x77, 0x6C, 0xF1,
-    0x18, 0x30, 0x94, 0x23, 0x6F, 0x7A, 0xEE, 0x2A, 0x4F, 0x13, 0xC2, 0xA9, 0x0A, 0x0B, 0x75, 0xF9,
-    0xD4, 0x14, 0x89, 0x26, 0x8E, 0x8E, 0x2C, 0xC1, 0x37, 0x30, 0x16, 0xB8, 0xAC, 0x54, 0x1C, 0x81,
-    0xEF, 0x86, 0x7E, 0x1B, 0x0D, 0x23, 0x50, 0xB3, 0x66, 0x77, 0x22, 0x00, 0x8D, 0xA2, 0xA0, 0x59,
-    0x3A, 0x5D, 0xD0, 0x49, 0x20, 0x5F, 0xC6, 0xB5, 0x34, 0x1F, 0x21, 0x47, 0x8B, 0x29, 0x0A, 0xD3,
-    0x4E, 0x18, 0xF0, 0xA4, 0x4F, 0x11, 0x1E, 0x44, 0xCF, 0x9E, 0xEA, 0x2F, 0x99, 0x4F, 0x6A, 0x18,
-    0x79, 0xF6, 0xDA, 0x13, 0x4D, 0xF5, 0x23, 0x8F, 0xED, 0xF4, 0xF5, 0xFE, 0xA3, 0x21, 0x58, 0x73,
-    0x00, 0xB0, 0x6D, 0x3F, 0xE9, 0xB1, 0x45, 0x6E, 0x38, 0x05, 0x8B, 0xE0, 0x14, 0x22, 0x54, 0x0F,
-    0x8C, 0x8D, 0x69, 0xE9, 0x26, 0x59, 0x7A, 0x10, 0xD5, 0xCB, 0x08, 0x97, 0xA1, 0x2A, 0x62, 0xAF,
-    0xA2, 0x41, 0xAB, 0x52, 0x03, 0x49, 0x29, 0x63, 0x1E, 0x35, 0x3F, 0x5D, 0x13, 0xD4, 0xBD, 0x7F,
-    0x56, 0xB9, 0x36, 0x73, 0xD4, 0x55, 0xE8, 0x65, 0x96, 0x3A, 0x7D, 0xBE, 0x19, 0xBD, 0xC0, 0x8E,
-    0xE9, 0x96, 0x74, 0x8D, 0x25, 0xF4, 0x6E, 0xE8, 0x73, 0x0F, 0x08, 0x75, 0x18, 0x02, 0x1E, 0x52,
-    0x24, 0x03, 0x27, 0x35, 0x9D, 0xFC, 0x32, 0xB4, 0x69, 0x1F, 0x23, 0xF0, 0x39, 0x1F, 0xF2, 0x56,
-    0x52, 0xDA, 0xE4, 0xDD, 0x90, 0xB7, 0xC2, 0x14, 0x52, 0xD0, 0xDA, 0x89, 0x63, 0xFE, 0x5E, 0xB4,
-    0xB7, 0x11, 0xB5, 0xA1, 0x13, 0x79, 0x73, 0x2A, 0x22, 0xC6, 0x22, 0xD0, 0x43, 0x8B, 0x8E, 0x03,
-    0xCF, 0x5D, 0xC5, 0x16, 0x8D, 0x98, 0xFE, 0x00, 0x3D, 0x72, 0xBD, 0xC2, 0x3D, 0x4F, 0xAC, 0xDA,
-    0xDF, 0xDE, 0xF1, 0x29, 0x42, 0xBA, 0x68, 0xA3, 0x6A, 0x64, 0xC9, 0x3B, 0x41, 0xC5, 0x9D, 0xFE,
-    0x09, 0xA3, 0xCA, 0x3E, 0x69, 0x3D, 0x3C, 0xEB, 0xEE, 0xBC, 0x4E, 0x66, 0x1F, 0x3E, 0x1C, 0x7C,
-    0xFF, 0xBC, 0x0A, 0x13, 0xAA, 0x3F, 0x2E, 0xA1, 0xD1, 0x90, 0x9A, 0xE3, 0xE1, 0xE4, 0xDA, 0x52,
-    0x7A, 0x79, 0xB8, 0xB3, 0x05, 0xE6, 0x3C, 0x9F, 0x65, 0xEF, 0x07, 0x8E, 0xA7, 0xB4, 0xE8, 0x09,
-    0x6E, 0x74, 0xB9, 0x76, 0x6A, 0xB5, 0x3C, 0x02, 0x12, 0x2B, 0x53, 0xC5, 0xC1, 0x11, 0x3C, 0xA1,
-    0x14, 0x99, 0xAA, 0x16, 0x79, 0x0C, 0xE0, 0xD5, 0x74, 0x71, 0xCE, 0x69, 0xCA, 0x68, 0xA4, 0x0E,
-    0xD3, 0xCF, 0x0F, 0x85, 0x82, 0x8E, 0x81, 0x57, 0xBD, 0x8F, 0x02, 0xDB, 0x29, 0x0C, 0x33, 0xB2,
-    0xD3, 0x92, 0x63, 0xC0, 0x5F, 0xAD, 0x81, 0x0A, 0xA0, 0x47, 0xA4, 0x0A, 0x22, 0x5A, 0x78, 0x5C,
-    0x56, 0xE0, 0xFA, 0x2D, 0xE9, 0x79, 0x0D, 0x3D, 0xE3, 0xAF, 0xD6, 0xC1, 0xF7, 0x69, 0xED, 0xF1,
-    0xE0, 0xC8, 0x11, 0xDD, 0x7C, 0x07, 0x11, 0x64, 0x37, 0x06, 0xF0, 0xCB, 0x7B, 0x7E, 0x58, 0xB1,
-    0x0E, 0xEB, 0x2E, 0x36, 0xED, 0x8D, 0x35, 0xB0, 0x1C, 0xE5, 0x2A, 0x75, 0xE2, 0x78, 0xF0, 0x3F,
-    0x3C, 0x7E, 0xA8, 0x70, 0x61, 0x1D, 0x4C, 0x45, 0x22, 0xBA, 0x2E, 0x0E, 0x38, 0xA1, 0xEF, 0x0F,
-    0x8C, 0x59, 0x25, 0x0E, 0x1E, 0x2A, 0xAF, 0x8B, 0x2A, 0x99, 0x33, 0xA5, 0xB9, 0x76, 0x7B, 0x79,
-    0xE3, 0xE6, 0x51, 0x8B, 0xD8, 0x77, 0xF8, 0x22, 0x4F, 0x52, 0x56, 0xC6, 0xFE, 0xC1, 0xAC, 0x4F,
-    0xDC, 0x61, 0x00, 0xB6, 0x7C, 0xB7, 0xBF, 0xD3, 0xF1, 0x60, 0x11, 0x21, 0xC2, 0x2F, 0x90, 0xB0,
-    0x67, 0xD6, 0x1B, 0x63, 0x68, 0xB2, 0x13, 0xE1, 0x67, 0x7F, 0x7B, 0x9B, 0x87, 0x3A, 0xAE, 0xCE,
-    0x01, 0x9C, 0x87, 0x5A, 0x0D, 0xF8, 0xE4, 0x2D, 0xED, 0x3E, 0x2E, 0x02, 0xEE, 0x99, 0x40, 0x0F,
-    0x2B, 0x89, 0xE9, 0x45, 0x3E, 0xAF, 0xA1, 0x73, 0xE3, 0xEC, 0xE3, 0x89, 0x0A, 0x86, 0x63, 0x63,
-    0xBB, 0xF2, 0x10, 0x43, 0xF9, 0x74, 0x0A, 0x59, 0xEA, 0xD4, 0xAC, 0x43, 0xFC, 0x03, 0x8D, 0x4C,
-    0xA9, 0xB0, 0x1B, 0x5D, 0x37, 0x3D, 0x1D, 0x43, 0x8F, 0xC7, 0xC0, 0x1B, 0xAA, 0x55, 0x07, 0x54,
-    0x72, 0x14, 0x06, 0xF4, 0x8F, 0xD8, 0x42, 0xC7, 0xD6, 0x3A, 0xB6, 0xDC, 0xAC, 0x45, 0xFB, 0x3E,
-    0xB3, 0xC9, 0x98, 0x1C, 0x37, 0x19, 0x8B, 0xD1, 0xEE, 0x3C, 0x41, 0x35, 0xFE, 0x79, 0xD2, 0xD3,
-    0x36, 0xA1, 0x62, 0x71, 0x1C, 0x0C, 0x3E, 0x24, 0xA3, 0xD4, 0xDF, 0x19, 0x8F, 0xA7, 0x3C, 0xC9,
-    0xAF, 0xCC, 0xC7, 0xF2, 0x29, 0xC4, 0xA9, 0x9D, 0xF5, 0x64, 0x89, 0x41, 0x58, 0x26, 0x5E, 0xA8,
-    0x6F, 0x24, 0xD2, 0x45, 0xD2, 0x30, 0x5E, 0x06, 0xB4, 0x8D, 0xBD, 0x6F, 0x7F, 0x67, 0xCE, 0x4C,
-    0x9B, 0x5C, 0x3B, 0x7D, 0x95, 0x3A, 0x35, 0xB9, 0xED, 0x84, 0xB4, 0xCC, 0xF3, 0x71, 0xCF, 0xC4,
-    0xD7, 0x37, 0xC2, 0xD3, 0xCE, 0xE9, 0xF7, 0x67, 0x90, 0x05, 0x0C, 0xCC, 0xEF, 0x87, 0x23, 0xC4,
-    0x96, 0x86, 0x45, 0x1E, 0x3F, 0x06, 0xFB, 0x8A, 0x06, 0xF9, 0xDE, 0xA3, 0x61, 0x11, 0x41, 0xAA,
-    0x43, 0xDC, 0x76, 0x96, 0xDF, 0x3D, 0xCF, 0x63, 0xFF, 0xEC, 0xF2, 0x68, 0x2C, 0x1E, 0x6C, 0xA6,
-    0x86, 0xA6, 0x11, 0x18, 0x50, 0x8E, 0x0A, 0x62, 0x2E, 0x33, 0x77, 0x9D, 0xC1, 0x4B, 0xD2, 0x59,
-    0x5A, 0xA2, 0xA8, 0x7D, 0xE9, 0xE1, 0x00, 0x61, 0x27, 0x4B, 0x28, 0xAA, 0x66, 0xBE, 0x60, 0xAA,
-    0xCD, 0x45, 0x59, 0x52, 0xD8, 0xFC, 0x40, 0x59, 0xF5, 0x04, 0x43, 0xF5, 0xED, 0xDC, 0xB5, 0xAD,
-    0xDE, 0x3B, 0xED, 0x81, 0x0A, 0x56, 0x94, 0x2B, 0xCB, 0x8C, 0xF9, 0xC0, 0x07, 0x43, 0xC9, 0x58,
-    0x5F, 0xB4, 0x2D, 0x85, 0xB5, 0x04, 0x5B, 0xB4, 0x1F, 0x62, 0xB9, 0xFC, 0xA1, 0x2C, 0xF4, 0x06,
-    0xAC, 0x60, 0xB2, 0x80, 0xDE, 0x90, 0xC0, 0x53, 0xA6, 0xFE, 0x32, 0x9C, 0xB5, 0xB1, 0x84, 0x74,
-    0x9E, 0x19, 0x5B, 0xAE, 0x2C, 0x08, 0x2E, 0x1B, 0x41, 0xE8, 0x1C, 0x0C, 0x1B, 0xC1, 0x9B, 0x05,
-    0x9E, 0xEF, 0x64, 0x44, 0x3D, 0x95, 0xC2, 0x9E, 0xA1, 0xBB, 0x9D, 0x06, 0xC2, 0xFC, 0xCE, 0xD2,
-    0xBD, 0xA7, 0xB2, 0x4B, 0x34, 0x62, 0xCD, 0xCA, 0x0A, 0xF2, 0xF9, 0xE8, 0x54, 0xE5, 0x21, 0xA6,
-    0x53, 0xA1, 0xDB, 0x24, 0x34, 0x47, 0x42, 0x38, 0x70, 0x0B, 0x6C, 0x4C, 0x81, 0x53, 0x42, 0xC6,
-    0x85, 0x98, 0x0F, 0xF4, 0x40, 0x59, 0xA1, 0x05, 0xAE, 0x60, 0xF2, 0x42, 0xA6, 0x7E, 0x0A, 0xF4,
-    0xC4, 0x1E, 0xF4, 0x3C, 0x4E, 0xDA, 0x35, 0xFF, 0xE3, 0xA3, 0x1C, 0xAC, 0xF9, 0x10, 0x27, 0x73,
-    0xAA, 0x7A, 0xBB, 0x3C, 0xDF, 0x4B, 0xFA, 0xF7, 0xE2, 0x75, 0x9E, 0xDD, 0x82, 0x63, 0x55, 0xD6,
-    0x9D, 0x36, 0x63, 0x27, 0xDE, 0xB8, 0x0C, 0x87, 0x14, 0xA0, 0xDC, 0x39, 0xDF, 0x1E, 0x77, 0x9F,
-    0xEA, 0x86, 0x74, 0x4D, 0x34, 0xE6, 0xBF, 0xC1, 0x10, 0x4C, 0x4F, 0x8F, 0xBA, 0xB2, 0x87, 0x63,
-    0x47, 0x9F, 0x8E, 0x25, 0xB0, 0x3E, 0x64, 0x09, 0xE4, 0xF2, 0x27, 0xF3, 0x95, 0x26, 0xA0, 0x56,
-    0x1F, 0x75, 0x4C, 0xAF, 0x87, 0xC3, 0x3E, 0x66, 0x4B, 0x20, 0x09, 0x21, 0x33, 0x52, 0x56, 0xCA,
-    0xC1, 0x62, 0xC8, 0xAE, 0x7E, 0xA1, 0x78, 0x90, 0x0C, 0xB7, 0x0E, 0xA0, 0x5E, 0xA5, 0xFD, 0x0F,
-    0xBC, 0x0C, 0x17, 0x8D, 0x64, 0x38, 0x93, 0xAC, 0x01, 0x9F, 0x56, 0xB6, 0x0E, 0xEE, 0xAB, 0xAC,
-    0x78, 0xE9, 0x35, 0x3F, 0xA2, 0xE0, 0x7B, 0x88, 0xAD, 0x20, 0x8A, 0x78, 0xA7, 0xCA, 0xAC, 0x81,
-    0x8F, 0xF0, 0x71, 0xE3, 0x62, 0x0E, 0x97, 0x6D, 0x7F, 0x68, 0xA1, 0xD1, 0x53, 0x0B, 0x8D, 0x1E,
-    0x5B, 0x68, 0xF4, 0xDC, 0x42, 0x8D, 0x40, 0x90, 0x8A, 0x27, 0x17, 0x1A, 0x3D, 0xBA, 0xD0, 0xE8,
-    0xD9, 0x85, 0x46, 0x0F, 0x2F, 0x34, 0x7A, 0x7A, 0xA1, 0xD1, 0xE3, 0x0B, 0x8D, 0x9E, 0x5F, 0x68,
-    0xF4, 0x00, 0x43, 0xA3, 0x27, 0x18, 0x1A, 0x3D, 0xC2, 0xD0, 0xE8, 0x19, 0x86, 0x46, 0x0F, 0x31,
-    0x34, 0x3C, 0xC5, 0xD0, 0x75, 0x3C, 0xC6, 0x10, 0x55, 0x2A, 0x4A, 0x9B, 0x1E, 0x64, 0xE8, 0x7C,
-    0x58, 0xC3, 0x5A, 0x3C, 0x83, 0x9F, 0x85, 0xF5, 0xB0, 0x86, 0xA5, 0xA9, 0xC9, 0xC2, 0xE4, 0x95,
-    0xA1, 0xFF, 0x91, 0x1E, 0x8A, 0x82, 0xE8, 0x4E, 0x9E, 0x14, 0x92, 0xE1, 0xA8, 0x90, 0x14, 0x39,
-    0x2F, 0x79, 0x66, 0x59, 0x95, 0x1D, 0xAA, 0x0B, 0x37, 0x5A, 0x54, 0x6F, 0xFC, 0xAF, 0x06, 0xD5,
-    0xEB, 0x5F, 0xD5, 0xA8, 0x5E, 0xFB, 0xA6, 0x42, 0xF5, 0xAA, 0x5B, 0xA0, 0x7A, 0x45, 0xC8, 0x2D,
-    0x22, 0xC0, 0x41, 0x75, 0x33, 0xCB, 0xFC, 0x75, 0xC4, 0x40, 0x30, 0x78, 0x6A, 0xE4, 0x75, 0xF3,
-    0xCC, 0x7A, 0x2D, 0x24, 0xC3, 0x57, 0xA7, 0xAF, 0x3D, 0xB2, 0x94, 0xA0, 0x42, 0x82, 0x4C, 0x16,
-    0x46, 0xFD, 0x53, 0xE5, 0x7A, 0x1A, 0xF8, 0x50, 0x9B, 0xF5, 0xF3, 0x9D, 0x9E, 0xE9, 0xA9, 0xBD,
-    0x60, 0xF6, 0xD3, 0x06, 0x67, 0x2F, 0x6C, 0x21, 0x0D, 0xAE, 0x24, 0x02, 0xF9, 0x30, 0xED, 0x89,
-    0x9A, 0x09, 0x91, 0x57, 0x51, 0x4D, 0xAF, 0x24, 0xD5, 0xD2, 0x7F, 0xBC, 0x75, 0xE0, 0xC4, 0xA5,
-    0x52, 0x4F, 0x5C, 0xB2, 0xCB, 0x13, 0x97, 0x7E, 0x53, 0x87, 0xEE, 0x62, 0xCD, 0x20, 0xD8, 0x38,
-    0x63, 0xFF, 0x6F, 0xB6, 0x4B, 0x18, 0x67, 0xF5, 0x01, 0x99, 0xF0, 0xD9, 0xCE, 0x40, 0x15, 0x67,
-    0xC8, 0xD7, 0x42, 0x99, 0x2C, 0xE2, 0x35, 0x91, 0xFB, 0x91, 0x47, 0x6F, 0x34, 0x15, 0x89, 0x34,
-    0x56, 0xD3, 0x1D, 0x5C, 0x35, 0xA4, 0xE6, 0x4D, 0x7A, 0x32, 0x51, 0x06, 0xBA, 0x83, 0xB9, 0xAA,
-    0x0B, 0xBD, 0x66, 0x15, 0x57, 0xF1, 0xFE, 0xF6, 0x15, 0x9A, 0x92, 0x49, 0x9B, 0x59, 0xD9, 0x82,
-    0x95, 0xC3, 0x71, 0x10, 0x3E, 0x41, 0x63, 0x10, 0x02, 0x75, 0xB8, 0xE8, 0x1D, 0x1E, 0x87, 0xCF,
-    0x6D, 0x7F, 0xFB, 0x2A, 0x82, 0xFE, 0xF5, 0x88, 0x50, 0x54, 0xEA, 0xC2, 0xAB, 0x96, 0xA3, 0xEB,
-    0x42, 0x0D, 0xCC, 0xB6, 0x82, 0x90, 0xA1, 0x66, 0xB5, 0x4D, 0x8B, 0x44, 0xF3, 0xB3, 0x29, 0x8D,
-    0xB3, 0x39, 0x9B, 0x05, 0x3B, 0x94, 0xC1, 0x69, 0xE6, 0x70, 0x45, 0xDA, 0xE3, 0xCF, 0xC2, 0xCE,
-    0xD5, 0x81, 0x5F, 0xB2, 0x72, 0x45, 0xD2, 0xF2, 0x2F, 0x21, 0x3B, 0xDF, 0x46, 0x40, 0x24, 0xE4,
-    0xBB, 0x14, 0x81, 0x30, 0x48, 0x82, 0x9E, 0x33, 0xAD, 0xE4, 0x0C, 0xB9, 0x21, 0x76, 0x45, 0x5A,
-    0xE4, 0x19, 0x76, 0x44, 0xE4, 0x3A, 0xDD, 0x0D, 0xAB, 0xFF, 0x9F, 0xA0, 0x18, 0x95, 0xEC, 0xF0,
-    0xC9, 0x6D, 0xDB, 0xB8, 0x67, 0x55, 0x8E, 0x3C, 0xDD, 0x6D, 0x3B, 0x1B, 0xB7, 0x33, 0xB9, 0x7A,
-    0xFA, 0x8A, 0xA0, 0xF7, 0x62, 0xDA, 0xE5, 0xF3, 0x83, 0xE8, 0x3D, 0x3A, 0x23, 0x01, 0xC7, 0xFF,
-    0xD4, 0x90, 0xA0, 0x90, 0xF3, 0xB7, 0xC6, 0x99, 0x47, 0x36, 0xE5, 0xA4, 0x31, 0x3F, 0xF2, 0x69,
-    0x26, 0x48, 0xAF, 0x9E, 0x8F, 0x0E, 0xA3, 0xD8, 0xD2, 0x28, 0xF0, 0xE1, 0xA8, 0x77, 0x61, 0x8D,
-    0xFD, 0x36, 0x64, 0xB8, 0x0C, 0x0F, 0x9D, 0x19, 0xC2, 0xDA, 0x35, 0x00, 0x54, 0x03, 0x53, 0x27,
-    0xAA, 0x81, 0x1F, 0x05, 0xF5, 0x74, 0xD5, 0xB4, 0x64, 0xBA, 0x0D, 0x0D, 0x7E, 0x82, 0xC0, 0x31,
-    0x28, 0xE4, 0x70, 0xA2, 0x2A, 0x13, 0xB5, 0xC0, 0x5E, 0x0F, 0x68, 0x8A, 0xA1, 0xA6, 0x7A, 0x65,
-    0x70, 0xD1, 0xFF, 0xB3, 0x65, 0x78, 0x40, 0x48, 0xF9, 0x61, 0x6D, 0x54, 0x05, 0x82, 0x96, 0x90,
-    0xF5, 0x90, 0x54, 0xB1, 0xAA, 0x84, 0x22, 0x86, 0xAA, 0xEA, 0x67, 0x92, 0x97, 0xE9, 0x95, 0xBC,
-    0xD5, 0x2E, 0x61, 0x6C, 0x0E, 0x6E, 0xD8, 0xBF, 0x05, 0xE3, 0x9D, 0x2E, 0x12, 0x84, 0x32, 0x15,
-    0x28, 0x93, 0xC5, 0x8B, 0x6B, 0x39, 0x4C, 0x8F, 0x3C, 0x07, 0x26, 0x2A, 0x7E, 0xA2, 0x6C, 0x6B,
-    0xDE, 0xAF, 0xD5, 0x61, 0xF1, 0xE3, 0x23, 0x82, 0x1E, 0xFF, 0xEE, 0x1C, 0x87, 0xDD, 0x84, 0x25,
-    0x25, 0x67, 0xCA, 0x4A, 0xBE, 0x32, 0x3F, 0x0E, 0x0F, 0x05, 0x78, 0x3E, 0x6D, 0x9D, 0x6E, 0x2A,
-    0x2B, 0x18, 0x56, 0x79, 0x86, 0x32, 0x9D, 0xAF, 0xAF, 0xE6, 0x93, 0x38, 0xBC, 0x7B, 0xB6, 0x78,
-    0x09, 0x49, 0xC8, 0x38, 0x73, 0xF2, 0xC0, 0xFB, 0x1E, 0xFD, 0xAC, 0x38, 0xEA, 0x66, 0x6B, 0xA0,
-    0xF1, 0x47, 0x97, 0x70, 0x09, 0x18, 0x0E, 0x4C, 0xA7, 0x98, 0x5D, 0x0C, 0xCE, 0x46, 0x9F, 0x5A,
-    0x8B, 0x5D, 0x73, 0x6E, 0x7C, 0x8E, 0x24, 0xC1, 0x19, 0xAC, 0xEF, 0x4B, 0x1B, 0x5B, 0xBD, 0x9E,
-    0x89, 0xCD, 0xEC, 0xCA, 0x73, 0x38, 0x64, 0x93, 0x47, 0x41, 0xC8, 0x84, 0xB7, 0x43, 0x39, 0xB5,
-    0x89, 0x84, 0xC9, 0x7C, 0x4E, 0xD9, 0x1B, 0x0E, 0x0C, 0xBC, 0x06, 0x9D, 0xC5, 0xD2, 0x68, 0x4A,
-    0x3E, 0x82, 0xBF, 0x5A, 0xF5, 0x6E, 0x60, 0x7B, 0x4E, 0xBC, 0xB4, 0x39, 0xED, 0x7F, 0x5F, 0x3A,
-    0x96, 0x6E, 0xDB, 0x16, 0xCD, 0x23, 0x99, 0x92, 0x0E, 0xC0, 0x17, 0xB6, 0xAF, 0xFA, 0xF3, 0xC6,
-    0x09, 0xCE, 0x6E, 0x6E, 0x3C, 0xE5, 0xF3, 0xC6, 0x27, 0xDB, 0xDB, 0xF0, 0xFB, 0xE1, 0xA0, 0x96,
-    0x22, 0xD0, 0x14, 0x89, 0x47, 0x3F, 0x9D, 0xE2, 0xA5, 0x09, 0x93, 0xC8, 0x1B, 0x0F, 0x5E, 0x9C,
-    0x2C, 0xD6, 0x83, 0xBB, 0x9F, 0xD2, 0xD0, 0xD6, 0xE5, 0x8E, 0x6C, 0x74, 0x8E, 0xC9, 0xA3, 0x0D,
-    0x4F, 0x69, 0x17, 0x3C, 0xCB, 0x03, 0xDD, 0x3A, 0x4C, 0xB5, 0x8E, 0xC8, 0xF4, 0xC4, 0x59, 0xA6,
-    0x7A, 0x74, 0xB7, 0xD0, 0x70, 0x9C, 0xE2, 0x59, 0xF1, 0x60, 0xEF, 0x85, 0x3F, 0xEA, 0x1B, 0xE6,
-    0x96, 0x63, 0xA0, 0xCF, 0x09, 0xE5, 0xFD, 0x82, 0x71, 0xF2, 0xEC, 0x70, 0x04, 0xF8, 0xFF, 0x71,
-    0xC7, 0x67, 0x7A, 0x06, 0x75, 0x54, 0x4C, 0xDB, 0xA4, 0x44, 0xC1, 0x67, 0xB3, 0x9E, 0xFD, 0xA9,
-    0xA7, 0xF2, 0x35, 0x71, 0x8B, 0x6C, 0x32, 0x3D, 0x95, 0x6F, 0x7C, 0x16, 0x27, 0xFF, 0xCF, 0x88,
-    0x1E, 0xD7, 0x92, 0x23, 0xCE, 0xE1, 0xFC, 0xFF, 0x2F, 0x9F, 0x75, 0x7D, 0x55, 0x7F, 0x7A, 0xE2,
-    0x55, 0x7D, 0xDA, 0xE3, 0x3D, 0xB0, 0xAA, 0x99, 0x79, 0x8C, 0x73, 0x10, 0xCE, 0xFF, 0xCC, 0xE8,
-    0x71, 0x08, 0x04, 0xB3, 0xF2, 0xBB, 0x6B, 0x79, 0x1E, 0x4F, 0xF5, 0x6C, 0xDE, 0x24, 0xA8, 0x0D,
-    0x14, 0x66, 0x94, 0x17, 0x83, 0x7A, 0x24, 0x19, 0x3D, 0x86, 0x03, 0xCE, 0xEE, 0x43, 0x76, 0x9F,
-    0xE6, 0xE1, 0xEC, 0x6F, 0x6F, 0x5F, 0x1D, 0x42, 0x13, 0x01, 0x96, 0xDD, 0x78, 0x16, 0x67, 0x39,
-    0x2A, 0xCD, 0x7E, 0xAD, 0xF1, 0xE0, 0x10, 0xCD, 0x7E, 0x9A, 0xF3, 0xF2, 0x67, 0x53, 0xF8, 0xB5,
-    0x71, 0x5E, 0x12, 0xC1, 0x77, 0xD7, 0xFA, 0xF2, 0x4C, 0x0E, 0xBA, 0x3C, 0xFB, 0x2F, 0xA5, 0x63,
-    0xEE, 0x82, 0xE8, 0x94, 0x1D, 0x0E, 0x4E, 0xA9, 0xAD, 0x5C, 0xB9, 0xD1, 0x8C, 0x72, 0xC2, 0x9F,
-    0xF2, 0x0C, 0x31, 0x55, 0x3D, 0xFE, 0x12, 0x61, 0xD5, 0xB7, 0xB0, 0x64, 0x22, 0x67, 0x06, 0x8D,
-    0x68, 0x07, 0x66, 0xE3, 0xF9, 0x55, 0x72, 0x3C, 0x08, 0x0D, 0x03, 0xCC, 0x27, 0x3E, 0x96, 0x22,
-    0xAA, 0x66, 0x3E, 0x03, 0x7C, 0x06, 0xDF, 0x03, 0x15, 0xE3, 0x09, 0x32, 0xC0, 0xCD, 0x2A, 0x03,
-    0x3C, 0xB7, 0x43, 0x2C, 0x45, 0xD2, 0x2F, 0x43, 0x44, 0xDA, 0xA5, 0xA5, 0x7E, 0x08, 0x4C, 0x7A,
-    0x41, 0xA3, 0x0E, 0x8A, 0xE1, 0xB4, 0xCC, 0x5F, 0x78, 0xD2, 0x24, 0x8D, 0x4A, 0x7B, 0x04, 0x41,
-    0x1D, 0x16, 0xA3, 0x75, 0x7B, 0x6A, 0x67, 0xDF, 0x83, 0xEF, 0x4F, 0x85, 0xE7, 0xA3, 0x04, 0xD5,
-    0x8A, 0xEF, 0x3F, 0xEA, 0x09, 0x9A, 0x3E, 0x2B, 0x65, 0xF8, 0xFF, 0x97, 0x16, 0xBF, 0xD5, 0xFF,
-    0x65, 0xC4, 0xE3, 0xBC, 0xE7, 0xCB, 0xA2, 0xD2, 0xEF, 0x11, 0x85, 0x6C, 0xA6, 0x3D, 0xD1, 0x99,
-    0x7B, 0x30, 0xBF, 0x15, 0x34, 0x58, 0xAF, 0xFF, 0xBE, 0x9D, 0x99, 0x29, 0xF5, 0x36, 0xC8, 0xFC,
-    0x03, 0x1C, 0xCB, 0xE2, 0xCB, 0x30, 0xC2, 0x67, 0x77, 0x90, 0xFC, 0xC0, 0x75, 0x6F, 0xF4, 0x4B,
-    0x78, 0x88, 0xEB, 0x3E, 0xE9, 0x63, 0x37, 0x1F, 0x4B, 0x6A, 0x4C, 0xFF, 0x11, 0x1C, 0x3A, 0xCB,
-    0xB2, 0x86, 0x3A, 0x1F, 0xA8, 0xE5, 0xD8, 0x50, 0x07, 0x99, 0x0F, 0x0E, 0xA7, 0x87, 0x4F, 0x9D,
-    0x19, 0x47, 0xA1, 0x85, 0xAB, 0x12, 0x6C, 0x21, 0xA0, 0x11, 0x62, 0x87, 0x2C, 0xD3, 0x47, 0xDC,
-    0x9E, 0xA2, 0xA2, 0x26, 0xB5, 0x37, 0xC8, 0xE5, 0x43, 0x48, 0x13, 0xCF, 0xCE, 0xF1, 0xFF, 0xDD,
-    0x86, 0xC9, 0x3F, 0x3B, 0x18, 0xD2, 0x34, 0xF3, 0x36, 0xC2, 0x55, 0x48, 0x53, 0xEC, 0x83, 0x4A,
-    0xEA, 0x21, 0x04, 0x2A, 0x60, 0x38, 0x14, 0x42, 0xA3, 0x18, 0xD2, 0x04, 0x95, 0x0C, 0xB6, 0x00,
-    0x68, 0xC6, 0x09, 0x4C, 0x56, 0x4A, 0x32, 0x87, 0xBC, 0x28, 0x85, 0xFC, 0xE6, 0x9F, 0x70, 0x6B,
-    0xA6, 0xFA, 0xBF, 0xD9, 0x69, 0x2A, 0xFF, 0xC0, 0xD1, 0xFD, 0x81, 0xBC, 0x33, 0x1F, 0xD8, 0x34,
-    0x63, 0x7C, 0xD7, 0x2A, 0xB0, 0x29, 0x5F, 0x52, 0x22, 0x3E, 0xB7, 0x3A, 0x90, 0xD7, 0x8D, 0x0E,
-    0xE4, 0x15, 0x85, 0x0A, 0x81, 0x4D, 0x76, 0x3E, 0x39, 0x22, 0xB0, 0x29, 0xD8, 0xA2, 0x62, 0x38,
-    0x37, 0x3A, 0x41, 0xC1, 0x47, 0x3A, 0x41, 0x9C, 0x1F, 0x4E, 0xCF, 0x4C, 0x0F, 0x3A, 0x9C, 0x2C,
-    0xFF, 0x2B, 0x92, 0xCF, 0xFC, 0x89, 0x7A, 0xA7, 0xB6, 0xDC, 0xD7, 0x1B, 0x31, 0xFF, 0x73, 0x94,
-    0x25, 0xF0, 0xFF, 0x15, 0x09, 0x83, 0x66, 0x3F, 0x69, 0x75, 0x46, 0x38, 0x21, 0x4C, 0x48, 0xC7,
-    0x74, 0xD0, 0xDB, 0x51, 0x63, 0x32, 0xDA, 0xFB, 0x8F, 0xED, 0xDB, 0xCE, 0xFD, 0x0A, 0xDA, 0x65,
-    0xA7, 0x40, 0xFE, 0xFC, 0xBF, 0x47, 0x8C, 0x6D, 0x79, 0xD8, 0xF0, 0xC4, 0x65, 0xFF, 0x0F, 0xD5,
-    0x5A, 0xBF, 0x6F, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0x2B, 0x11, 0x11, 0x87, 0xE7, 0x04, 0x12, 0xD0,
-    0xB8, 0x40, 0xB9, 0xB6, 0x06, 0x5A, 0xAE, 0x2D, 0xE0, 0x94, 0x0C, 0x3A, 0x64, 0xB4, 0x06, 0x69,
-    0x28, 0x32, 0x24, 0x43, 0x86, 0xB6, 0x8B, 0xFE, 0x81, 0xA0, 0x64, 0xAA, 0xA1, 0xAB, 0xB7, 0x0E,
-    0x59, 0x02, 0xC4, 0x40, 0x83, 0x0C, 0x55, 0xC6, 0x0E, 0x71, 0xF8, 0x1A, 0x03, 0x2D, 0xD0, 0x2C,
-    0x6C, 0x3A, 0x04, 0xE8, 0x62, 0x06, 0x69, 0x63, 0x20, 0x1E, 0xCC, 0xA0, 0x2C, 0x44, 0x47, 0x24,
-    0x6F, 0xBF, 0xEF, 0xDC, 0xC7, 0xF7, 0xF8, 0x94, 0x1F, 0x72, 0xEA, 0x27, 0xE9, 0xD9, 0x4F, 0x3C,
-    0x34, 0xC9, 0xCB, 0x73, 0xEF, 0xF9, 0xEE, 0xB9, 0xE7, 0xD7, 0xA5, 0x78, 0x66, 0x2A, 0x22, 0x9E,
-    0x29, 0x40, 0x03, 0x53, 0x82, 0x4E, 0x4C, 0x45, 0x7A, 0x52, 0x83, 0x46, 0xF7, 0x1A, 0xD0, 0xF8,
-    0x1F, 0x2D, 0x68, 0x7A, 0xA7, 0x03, 0xCD, 0x5F, 0x33, 0xA0, 0x26, 0x01, 0x75, 0x0C, 0xCE, 0xE2,
-    0x1A, 0xC9, 0xA7, 0x60, 0xF0, 0x36, 0x18, 0xF9, 0xC6, 0x80, 0x45, 0x00, 0x5A, 0x81, 0x0D, 0x69,
-    0x58, 0xCB, 0xA4, 0x91, 0x18, 0x97, 0xAD, 0xC4, 0xA5, 0xF8, 0x9D, 0xA4, 0x85, 0x78, 0xBD, 0x18,
-    0xBE, 0x22, 0xCB, 0xFF, 0x72, 0xA5, 0x60, 0x39, 0xA7, 0xF9, 0xD2, 0x73, 0xD7, 0xF4, 0xE4, 0x3A,
-    0x05, 0xFF, 0xCA, 0xBB, 0x19, 0x61, 0x94, 0x93, 0x5A, 0x8F, 0x03, 0x53, 0xE3, 0x7E, 0x1D, 0x9B,
-    0xA3, 0x3A, 0x2F, 0x26, 0xB5, 0x99, 0xE2, 0xC8, 0x42, 0xFC, 0x3F, 0xAD, 0x53, 0xBD, 0x7F, 0x5C,
-    0x07, 0xE6, 0xB0, 0x96, 0xDD, 0x19, 0xA3, 0x09, 0xC4, 0xE4, 0xEB, 0xCA, 0xA2, 0x1C, 0x77, 0xE1,
-    0x69, 0xBF, 0x16, 0x13, 0x27, 0x2C, 0xB4, 0xB1, 0xD2, 0x94, 0x77, 0xE4, 0xB6, 0x36, 0xFA, 0xE5,
-    0xB8, 0xFD, 0x65, 0xA3, 0x97, 0xA2, 0xBB, 0x14, 0x1D, 0x3C, 0x83, 0xC3, 0xC1, 0x11, 0x34, 0x76,
-    0xC8, 0x5B, 0xC9, 0x4A, 0x31, 0xFB, 0x15, 0x09, 0xF9, 0x3B, 0xE6, 0xB0, 0xA2, 0xC4, 0xFF, 0xCC,
-    0xC0, 0xE6, 0x3E, 0x65, 0x8D, 0x9E, 0xA7, 0x7C, 0x3F, 0xC0, 0x6F, 0x5D, 0x50, 0xB9, 0x9A, 0xB1,
-    0x83, 0x44, 0xE2, 0x1A, 0x13, 0x96, 0x77, 0x6F, 0x60, 0xE0, 0xD0, 0x24, 0xBF, 0x0C, 0x33, 0x71,
-    0x12, 0x27, 0x59, 0x68, 0x93, 0x42, 0x43, 0xDE, 0x95, 0x58, 0x70, 0x14, 0x1D, 0x25, 0xC0, 0x87,
-    0x4F, 0x6B, 0x21, 0x42, 0x42, 0x88, 0x84, 0x18, 0x09, 0x41, 0x12, 0xA2, 0x24, 0xA9, 0x7D, 0x7A,
-    0x5C, 0x8B, 0x02, 0xA5, 0x48, 0x5D, 0x53, 0xD6, 0x31, 0xFB, 0x97, 0xE0, 0xEF, 0x06, 0x67, 0xE7,
-    0x4D, 0x85, 0x61, 0x72, 0x6F, 0x0D, 0xA1, 0xFA, 0xB5, 0x58, 0x9C, 0xD0, 0xDD, 0x1D, 0xB0, 0x72,
-    0x5E, 0xE7, 0x60, 0xC2, 0x0F, 0xD0, 0x7F, 0xEC, 0xA0, 0xE3, 0x6D, 0xFC, 0xEC, 0xBF, 0x88, 0x23,
-    0x33, 0x06, 0xC3, 0xC8, 0x0D, 0x7A, 0xFE, 0xA9, 0x6B, 0xE6, 0x6B, 0x14, 0x64, 0xD3, 0x80, 0xA0,
-    0xBB, 0xC4, 0x33, 0x5F, 0x98, 0x24, 0xE8, 0x70, 0x0F, 0xDD, 0x81, 0x34, 0x0E, 0x2F, 0x7D, 0x93,
-    0xF8, 0xF6, 0xA9, 0x49, 0x13, 0xC9, 0x1B, 0x74, 0xB8, 0x31, 0x5E, 0x73, 0x76, 0x05, 0x6E, 0xD5,
-    0x7A, 0x51, 0x51, 0xAE, 0xDF, 0x15, 0x84, 0xE4, 0xA3, 0x64, 0x4D, 0x61, 0x13, 0x9D, 0x6B, 0x07,
-    0xEA, 0x23, 0x07, 0x38, 0x42, 0xE8, 0x59, 0x23, 0x79, 0xFB, 0x32, 0xB5, 0xCC, 0xAB, 0xC2, 0x6C,
-    0xD0, 0xB1, 0x95, 0xAC, 0x3D, 0xE7, 0x56, 0x00, 0xEA, 0x9B, 0x23, 0x4A, 0xF7, 0x12, 0x65, 0x79,
-    0xCA, 0xB9, 0x45, 0xEE, 0xD7, 0x54, 0xC9, 0x54, 0x76, 0xF7, 0x84, 0xF2, 0x06, 0xC5, 0x7B, 0x7C,
-    0x2A, 0x9B, 0x6B, 0x82, 0x52, 0x94, 0x55, 0x62, 0x4E, 0x4A, 0xE7, 0x63, 0x5C, 0x27, 0x98, 0x71,
-    0x1F, 0xDD, 0x85, 0x00, 0x2D, 0x4D, 0x33, 0xA7, 0x09, 0x0A, 0x49, 0xAC, 0x6D, 0xF9, 0xFF, 0x51,
-    0xBA, 0x37, 0xB2, 0x50, 0xFB, 0x96, 0xD5, 0x74, 0x2E, 0x69, 0xA8, 0xD2, 0xA5, 0x09, 0x67, 0x69,
-    0x5B, 0x76, 0xD6, 0xC8, 0x62, 0x3F, 0x9A, 0xBF, 0xDB, 0x80, 0x58, 0x31, 0x06, 0x63, 0x3A, 0x71,
-    0xBB, 0x3C, 0x09, 0xAA, 0xB0, 0xD8, 0x58, 0xA5, 0x5E, 0x0D, 0xAE, 0x6D, 0xEE, 0x07, 0x8B, 0x51,
-    0xC7, 0xB8, 0x54, 0x7F, 0x17, 0x91, 0x3C, 0x77, 0xFD, 0x47, 0xFA, 0xDF, 0x57, 0x15, 0xAB, 0x56,
-    0xD1, 0x23, 0x62, 0xF2, 0x8B, 0xB5, 0xF1, 0x83, 0x6F, 0x81, 0x0D, 0xBA, 0xF0, 0x4A, 0xF1, 0xFE,
-    0xF2, 0xF3, 0xA9, 0x57, 0x87, 0x53, 0x87, 0x36, 0x29, 0x45, 0x57, 0xCE, 0x0A, 0xFD, 0xA0, 0x63,
-    0x15, 0xB6, 0x51, 0x8E, 0xEF, 0x2A, 0x36, 0xDF, 0x5F, 0x77, 0x6C, 0x68, 0xE3, 0x23, 0x60, 0x10,
-    0xE0, 0xF2, 0xFD, 0xC3, 0xF3, 0xC3, 0x46, 0xF6, 0xAC, 0x36, 0x5B, 0xC5, 0x52, 0xC6, 0x21, 0xC9,
-    0xF5, 0x9F, 0x5C, 0xA7, 0x7C, 0x0A, 0x57, 0x68, 0x1A, 0xB5, 0x65, 0xE5, 0x5A, 0x21, 0xC4, 0x48,
-    0x49, 0x7D, 0x10, 0xE3, 0x9A, 0x42, 0xFC, 0xBF, 0xBE, 0x30, 0xF5, 0x10, 0x2A, 0x38, 0xF4, 0x74,
-    0x8C, 0xAC, 0x56, 0xAA, 0x41, 0x6F, 0xF9, 0x23, 0x6B, 0xDE, 0xAB, 0xBD, 0xA6, 0x35, 0xDF, 0xC2,
-    0x0F, 0x77, 0xB2, 0x48, 0x9F, 0x52, 0x46, 0x47, 0xB1, 0x92, 0x9D, 0x64, 0xCD, 0xAC, 0xF9, 0xE7,
-    0xD6, 0x9A, 0x3B, 0xA5, 0x53, 0x4A, 0xE3, 0x17, 0x08, 0x08, 0xA6, 0x08, 0x0F, 0xAC, 0x4B, 0x5C,
-    0x95, 0x35, 0xDF, 0xD6, 0x00, 0xE1, 0x67, 0xD0, 0x1A, 0xF4, 0x7B, 0xD2, 0xCF, 0xD7, 0x96, 0x6B,
-    0x35, 0x67, 0x5B, 0x9E, 0x34, 0x6B, 0x8E, 0x88, 0x60, 0xD7, 0x2F, 0xFC, 0xD2, 0xEB, 0x73, 0xAE,
-    0xBE, 0x6C, 0xF5, 0xAB, 0x8F, 0xAB, 0x0B, 0x20, 0xC4, 0x95, 0x3D, 0x6C, 0xEA, 0xC2, 0x10, 0x35,
-    0x1B, 0x1D, 0x09, 0xB3, 0x98, 0xA5, 0xE3, 0xB3, 0xB7, 0xD9, 0x66, 0x71, 0x9C, 0x7E, 0x6E, 0xDB,
-    0x24, 0x63, 0x3E, 0x63, 0x81, 0x1D, 0x46, 0x8D, 0x14, 0x76, 0x9C, 0xA8, 0xE5, 0x1D, 0xC0, 0xC1,
-    0x68, 0x21, 0x4F, 0x54, 0x87, 0x75, 0x5C, 0xF8, 0x6D, 0x3A, 0xF5, 0x5A, 0x44, 0x8E, 0x8B, 0x63,
-    0xC6, 0x3B, 0x66, 0x22, 0xD6, 0xC8, 0x3B, 0x6C, 0xEB, 0x11, 0xF0, 0x9C, 0x33, 0x39, 0x13, 0xC8,
-    0x27, 0x14, 0x8D, 0x3D, 0x82, 0x6A, 0x29, 0x45, 0xE3, 0x84, 0x3B, 0x61, 0x69, 0xD7, 0x2D, 0x19,
-    0xBD, 0xB7, 0x48, 0xCB, 0xCE, 0x4D, 0x66, 0x0C, 0x54, 0x22, 0xCC, 0xDB, 0xD3, 0x54, 0x48, 0x74,
-    0xE8, 0xB6, 0xCC, 0x29, 0x70, 0xCE, 0x56, 0x2A, 0xB7, 0xDF, 0x04, 0x59, 0x68, 0x8E, 0x92, 0x18,
-    0x63, 0x7B, 0x2E, 0x68, 0xA1, 0xED, 0xBB, 0xE7, 0x2B, 0x57, 0xEF, 0x96, 0x9E, 0xB9, 0x5F, 0x06,
-    0x1C, 0xFB, 0xF3, 0x06, 0x6B, 0x7B, 0x7B, 0x95, 0xF2, 0xC0, 0x35, 0x7B, 0x8D, 0x6B, 0x5E, 0x28,
-    0x7D, 0xF3, 0xB7, 0x24, 0xBC, 0x5B, 0x49, 0x0C, 0xFF, 0xF9, 0xCA, 0x6C, 0xB2, 0xCE, 0x49, 0xA6,
-    0x2D, 0x92, 0x28, 0xC3, 0x90, 0x7E, 0x83, 0xE7, 0x1D, 0x0C, 0x6C, 0x97, 0x0A, 0x43, 0xF3, 0xE9,
-    0x28, 0xFF, 0xA3, 0x7C, 0x2A, 0x20, 0x57, 0x5F, 0x25, 0x14, 0x51, 0x28, 0xA3, 0x50, 0x48, 0xE6,
-    0x39, 0x4B, 0x64, 0x3A, 0xD4, 0x00, 0x28, 0xAA, 0xCA, 0x6A, 0x5F, 0x53, 0x69, 0xAD, 0xB8, 0x94,
-    0x57, 0xD3, 0xE4, 0x54, 0x57, 0xE3, 0x21, 0x0C, 0x84, 0x6B, 0x33, 0xAA, 0xBB, 0xD4, 0x52, 0x17,
-    0xAB, 0xFA, 0x15, 0xFC, 0x16, 0x5A, 0xBA, 0x4C, 0x12, 0xCB, 0xFF, 0x34, 0x01, 0x02, 0x2A, 0xFA,
-    0x98, 0x7C, 0x55, 0xBB, 0x59, 0xE3, 0xE4, 0x14, 0x67, 0x4D, 0xF1, 0x22, 0xE2, 0x11, 0x7C, 0x88,
-    0x5B, 0xCE, 0xEF, 0x39, 0xD2, 0xC9, 0x47, 0x9A, 0xE2, 0xB5, 0xE3, 0x14, 0x2F, 0xE0, 0x83, 0x98,
-    0x66, 0x16, 0x96, 0x0F, 0x46, 0x09, 0x9A, 0xE0, 0xC1, 0xDC, 0x4D, 0x01, 0x48, 0x4C, 0xDB, 0x64,
-    0xC6, 0x84, 0x06, 0xD5, 0xD7, 0x68, 0xA7, 0x57, 0x0B, 0x96, 0x05, 0xF6, 0x35, 0xA1, 0xD2, 0x82,
-    0x15, 0x4D, 0xED, 0x3C, 0xC7, 0xA3, 0x2D, 0xE2, 0xFA, 0x75, 0x2A, 0xD7, 0xDC, 0x28, 0x7C, 0xF3,
-    0x81, 0x5C, 0x90, 0x1A, 0xA8, 0xFE, 0x71, 0x80, 0x9A, 0xA6, 0x31, 0x1C, 0x89, 0x9A, 0x77, 0xA9,
-    0x10, 0x2F, 0x5F, 0x9C, 0x42, 0xB8, 0xB7, 0xB6, 0x80, 0xC7, 0x1F, 0x65, 0x72, 0xD0, 0xCA, 0x77,
-    0x9D, 0x37, 0x10, 0x8F, 0x25, 0x9A, 0xB4, 0x79, 0x70, 0x50, 0x93, 0xE2, 0xB6, 0x3C, 0x2B, 0x57,
-    0xCF, 0x0F, 0x02, 0xFA, 0xEC, 0x1C, 0xC3, 0xF9, 0x3C, 0x5F, 0x64, 0x60, 0x13, 0xCE, 0xD2, 0x41,
-    0x26, 0x2D, 0x4C, 0xD7, 0xEE, 0xCC, 0xB4, 0x3C, 0xCE, 0x4A, 0x4F, 0x67, 0x2B, 0x7D, 0x9F, 0x9E,
-    0xA0, 0xD0, 0xF0, 0x77, 0xF2, 0x1F, 0xE8, 0x4C, 0x96, 0x23, 0xE9, 0xDA, 0xB9, 0x1C, 0x2F, 0xF4,
-    0x0D, 0xB9, 0xD3, 0x39, 0x7B, 0xA7, 0xA0, 0x23, 0xC0, 0x4F, 0xE5, 0x19, 0x6B, 0x40, 0x39, 0x5D,
-    0x84, 0xA3, 0xCF, 0x62, 0xFA, 0x6B, 0xFE, 0xF9, 0x26, 0x73, 0xB9, 0xBC, 0xCE, 0xFE, 0x83, 0x9F,
-    0x9B, 0xBF, 0xC5, 0x32, 0x5F, 0xDA, 0x3E, 0xD3, 0x3A, 0x6D, 0xD0, 0x4C, 0x0A, 0x06, 0xAC, 0x71,
-    0x79, 0xC6, 0xEF, 0x71, 0x3B, 0x54, 0x57, 0xDB, 0x70, 0x95, 0xE3, 0xCF, 0x6B, 0x66, 0x75, 0xA0,
-    0x82, 0xBC, 0x43, 0xCD, 0x0D, 0xCF, 0x1A, 0x81, 0x5D, 0xFA, 0xDA, 0xBE, 0x98, 0xCF, 0x56, 0xA0,
-    0x51, 0x6D, 0xCE, 0x09, 0x74, 0x35, 0xC2, 0x0A, 0xCC, 0x67, 0xB8, 0x35, 0xE9, 0x24, 0x6C, 0x89,
-    0xB5, 0xDF, 0x33, 0x7C, 0x41, 0x6C, 0x85, 0xF7, 0x31, 0x24, 0x44, 0x5B, 0x98, 0xD8, 0xAF, 0xA3,
-    0xB6, 0x8D, 0x6D, 0x1F, 0xD5, 0x7C, 0xD7, 0xF2, 0x09, 0xCC, 0xA7, 0xE0, 0xE9, 0x99, 0xD9, 0x4A,
-    0xA4, 0xB2, 0x7C, 0xCF, 0x3C, 0xD4, 0x68, 0x7A, 0x14, 0xA6, 0xA4, 0x36, 0x52, 0x9B, 0x2E, 0x68,
-    0x9A, 0x2C, 0x07, 0x74, 0x3D, 0x79, 0x14, 0xAA, 0x29, 0x4D, 0xD8, 0xC6, 0xA5, 0xDF, 0x41, 0x53,
-    0x10, 0xC1, 0xF1, 0x70, 0x8D, 0x3D, 0xBC, 0x9E, 0xF7, 0xF8, 0x8C, 0x6D, 0x18, 0xAF, 0xF1, 0x1D,
-    0xBE, 0x3B, 0xC4, 0x77, 0x12, 0x00, 0x0A, 0x98, 0x12, 0x3D, 0x26, 0xD5, 0x52, 0x17, 0xAA, 0xC7,
-    0x8E, 0xCD, 0x18, 0x5F, 0x54, 0xEA, 0x29, 0x0D, 0xAB, 0x45, 0x19, 0xF1, 0xC7, 0xB2, 0x76, 0xE8,
-    0x9D, 0x19, 0x09, 0xAD, 0x06, 0x39, 0x75, 0xA6, 0x42, 0x5F, 0x62, 0xEE, 0xD4, 0x34, 0xCD, 0x9F,
-    0x82, 0x7F, 0x70, 0x4C, 0xE5, 0x0C, 0x33, 0x7A, 0x9F, 0x67, 0xF1, 0x5B, 0x2F, 0x6C, 0xB6, 0x6E,
-    0x7E, 0x75, 0xE4, 0x31, 0x59, 0x76, 0x34, 0xBD, 0x3A, 0x9A, 0x62, 0xE6, 0x68, 0x20, 0xBE, 0x10,
-    0x07, 0x3A, 0x9A, 0x5E, 0x72, 0x4B, 0x34, 0x31, 0x51, 0x82, 0x4B, 0x7D, 0xA0, 0x4D, 0xB4, 0xB1,
-    0xD6, 0xA5, 0x95, 0x81, 0xB2, 0x52, 0xBC, 0xAE, 0xDA, 0x94, 0x5B, 0x15, 0xD9, 0x2F, 0x55, 0xA1,
-    0xDF, 0xD4, 0x84, 0x28, 0x38, 0x6E, 0xF4, 0x41, 0xB7, 0x7E, 0x80, 0x5D, 0x3B, 0x15, 0x9C, 0xFC,
-    0x61, 0x11, 0x9C, 0x24, 0xA7, 0x82, 0x93, 0x92, 0x36, 0xB4, 0x1B, 0x82, 0x93, 0xD7, 0x8C, 0xA2,
-    0x42, 0xE7, 0x1C, 0x97, 0xC1, 0x8C, 0x44, 0xD5, 0x40, 0x80, 0x14, 0x89, 0x36, 0xD1, 0xC6, 0x5A,
-    0x9D, 0xB6, 0x0C, 0x6C, 0x96, 0x38, 0x4A, 0x21, 0x67, 0xD6, 0x7B, 0xD3, 0x9A, 0xB8, 0x3F, 0xA9,
-    0xB6, 0x95, 0x9C, 0x9F, 0x4F, 0xD6, 0x5E, 0xDB, 0xF6, 0xE6, 0x15, 0x97, 0x97, 0xE6, 0x01, 0xCE,
-    0xED, 0xA5, 0x00, 0xE7, 0xFC, 0xF5, 0x0E, 0x11, 0xBE, 0x97, 0x90, 0xED, 0x03, 0x16, 0x99, 0x5E,
-    0xE7, 0x68, 0x36, 0x6D, 0x94, 0x7B, 0xF5, 0xE6, 0xB0, 0x3F, 0x25, 0x4E, 0xAF, 0x11, 0x63, 0xC9,
-    0xC8, 0x78, 0x33, 0xD9, 0x4C, 0xD6, 0x09, 0xC6, 0x28, 0x7B, 0x07, 0xD2, 0x54, 0xF2, 0xDF, 0xBC,
-    0x90, 0x5D, 0x04, 0x49, 0x88, 0xF5, 0x6C, 0x90, 0x74, 0x34, 0x95, 0x0E, 0x5E, 0x7E, 0x1E, 0x24,
-    0xAD, 0xC2, 0xA8, 0xED, 0x5B, 0xA7, 0x53, 0xCC, 0x0B, 0x85, 0x8C, 0x95, 0x44, 0xA3, 0x25, 0x0E,
-    0x67, 0xE3, 0x89, 0x73, 0x94, 0x0C, 0xB5, 0x22, 0x88, 0x90, 0xF6, 0x98, 0xE4, 0x34, 0xF3, 0xEB,
-    0x49, 0xC9, 0x62, 0xC7, 0x05, 0x38, 0xD0, 0x7D, 0x5B, 0x0C, 0xD0, 0x72, 0x63, 0x63, 0x83, 0x93,
-    0xC5, 0xD8, 0xF6, 0xE6, 0x5B, 0xC6, 0x44, 0x92, 0x8A, 0x6D, 0xCC, 0x61, 0x4B, 0x24, 0x4F, 0x1A,
-    0x22, 0x69, 0x2A, 0x22, 0x60, 0xA6, 0x67, 0x22, 0x29, 0xAB, 0x41, 0x72, 0x87, 0x88, 0x40, 0xC1,
-    0x6C, 0x9C, 0x4A, 0x15, 0x63, 0xE9, 0x62, 0x4F, 0x36, 0x12, 0xCD, 0xA0, 0x98, 0x69, 0xF5, 0x5E,
-    0x8B, 0xF7, 0xEF, 0x36, 0x5A, 0x79, 0x8A, 0x1E, 0x1E, 0x98, 0xEC, 0x91, 0xD7, 0xE6, 0xC3, 0x83,
-    0xAF, 0x59, 0x9B, 0xB3, 0x5A, 0x7E, 0x2B, 0x43, 0xAA, 0x86, 0x87, 0xC9, 0x90, 0x93, 0x2D, 0x00,
-    0x5E, 0x0F, 0x94, 0x9C, 0x7D, 0x1D, 0x4A, 0x32, 0x24, 0x56, 0x3A, 0xD5, 0x80, 0x0A, 0x73, 0xB9,
-    0x77, 0xAE, 0x28, 0x0D, 0x20, 0x64, 0x8B, 0x12, 0xE3, 0x8D, 0x6A, 0xE1, 0x19, 0xAC, 0x5E, 0xE9,
-    0x36, 0xA9, 0xFC, 0x70, 0xCD, 0xF4, 0x4A, 0x47, 0x46, 0x17, 0x15, 0x73, 0x8E, 0x9F, 0xEE, 0x86,
-    0x80, 0x49, 0x93, 0xF3, 0x80, 0x1A, 0xB6, 0x99, 0x5D, 0x00, 0x76, 0xAC, 0x59, 0xB1, 0xBC, 0x7F,
-    0x94, 0xCC, 0x4A, 0x00, 0x5A, 0xB9, 0xA2, 0x9B, 0x4D, 0xD6, 0x0F, 0xAF, 0x3C, 0xA9, 0xF0, 0xF2,
-    0x49, 0x65, 0x65, 0x09, 0xFE, 0x6C, 0xB2, 0x3D, 0x47, 0xBE, 0x73, 0x01, 0x28, 0xAD, 0x19, 0x0E,
-    0x67, 0xA7, 0x40, 0x7B, 0x83, 0xD9, 0x38, 0x57, 0x5C, 0x82, 0xA5, 0xEF, 0x2E, 0x16, 0xC9, 0x74,
-    0x8A, 0x30, 0xBA, 0x40, 0x2E, 0x1E, 0x97, 0x8F, 0x43, 0x52, 0x25, 0x05, 0x70, 0x04, 0x4A, 0x00,
-    0xB8, 0x7F, 0xD1, 0x64, 0x14, 0x81, 0x63, 0xA1, 0xDF, 0x1A, 0x0A, 0x35, 0x5F, 0x1A, 0x4B, 0x33,
-    0x1E, 0x8B, 0x49, 0x82, 0x06, 0x47, 0x7B, 0xE6, 0x91, 0x4D, 0x5A, 0x33, 0x0D, 0xDB, 0xFC, 0xDF,
-    0x79, 0x9B, 0xA2, 0x83, 0xC8, 0x1C, 0xB7, 0x81, 0x79, 0xBF, 0x95, 0x2B, 0x43, 0xEA, 0xC4, 0xBA,
-    0x42, 0x61, 0x8F, 0x68, 0x3A, 0xC2, 0x3A, 0xD2, 0x0D, 0x0B, 0xAE, 0xDD, 0x1D, 0x33, 0x6C, 0x1E,
-    0x38, 0xBA, 0x94, 0xF9, 0xC0, 0x2B, 0x2E, 0x0F, 0x94, 0x14, 0x16, 0x31, 0x6F, 0x46, 0x5F, 0x18,
-    0xD5, 0x4B, 0x5F, 0x18, 0xAD, 0x06, 0x1A, 0xEB, 0xA9, 0x74, 0xEF, 0x82, 0xC2, 0x2B, 0x32, 0x8E,
-    0xF5, 0x58, 0x5E, 0x2D, 0xB2, 0xA4, 0x30, 0x8E, 0x51, 0x18, 0x3E, 0xD4, 0xAD, 0x9B, 0xF8, 0x93,
-    0x4E, 0x4F, 0xF7, 0xB5, 0x26, 0x17, 0xB3, 0x4A, 0xC3, 0x53, 0xA6, 0xA7, 0x5A, 0x59, 0xB1, 0x16,
-    0xF1, 0xAD, 0x4F, 0xE9, 0xEC, 0x54, 0xD8, 0xE9, 0xAA, 0x74, 0x81, 0x28, 0x50, 0xFA, 0xD5, 0x90,
-    0xD1, 0xE0, 0x43, 0x77, 0xA5, 0x66, 0x70, 0xCD, 0x01, 0x9B, 0xC5, 0x78, 0xD9, 0xDC, 0xE7, 0xAA,
-    0x3E, 0x71, 0xB6, 0x77, 0x12, 0x2E, 0x3F, 0xFB, 0x29, 0x59, 0x9E, 0x59, 0xE0, 0x40, 0x7B, 0xEE,
-    0x44, 0x05, 0xA6, 0x55, 0x5A, 0x89, 0x7E, 0x42, 0x43, 0xDA, 0x7E, 0x03, 0xCD, 0xE8, 0xD4, 0x09,
-    0x27, 0x38, 0x01, 0x50, 0x2D, 0xB2, 0xB5, 0xFC, 0x50, 0x87, 0xF1, 0x64, 0x60, 0x7E, 0xCB, 0x81,
-    0x5D, 0x59, 0xC4, 0x49, 0xC3, 0xFA, 0x96, 0xC8, 0x7E, 0xEE, 0x16, 0xD8, 0x6C, 0x47, 0x15, 0x6C,
-    0x6C, 0x14, 0xD6, 0x1A, 0xDA, 0x0D, 0x8D, 0xEA, 0xFC, 0x7E, 0xB4, 0xD1, 0x16, 0x17, 0xB3, 0x55,
-    0xCB, 0x7D, 0xD2, 0xDD, 0x8B, 0x86, 0x76, 0x28, 0x70, 0x5B, 0x05, 0x8D, 0xEC, 0xC0, 0x76, 0x86,
-    0x0F, 0xF3, 0xE4, 0xCB, 0x3A, 0x3C, 0x5F, 0xC6, 0xEB, 0xAE, 0xC3, 0xF3, 0x4F, 0x0B, 0xED, 0x16,
-    0xB8, 0x5D, 0xFC, 0x76, 0xF9, 0x0F, 0xCA, 0x03, 0x13, 0x00, 0xD0, 0xB7, 0x92, 0x4B, 0x02, 0x3D,
-    0xCA, 0x5E, 0x55, 0x35, 0xF8, 0xA2, 0x51, 0xB7, 0xAA, 0xC9, 0x94, 0x47, 0x9B, 0x46, 0x4B, 0xB1,
-    0xF1, 0x04, 0xC1, 0xEC, 0x74, 0xD4, 0x0A, 0xDF, 0x3C, 0x98, 0xCE, 0x3E, 0x47, 0x94, 0x09, 0x5C,
-    0xE8, 0x0E, 0x64, 0xB8, 0x72, 0x49, 0xD0, 0x3E, 0x21, 0xEA, 0x39, 0x78, 0x67, 0x6B, 0x5E, 0x87,
-    0x53, 0x50, 0x9D, 0x12, 0xC5, 0x7E, 0x41, 0x71, 0x29, 0x48, 0x5A, 0x07, 0x6F, 0x6D, 0x94, 0xA5,
-    0x63, 0x97, 0xAF, 0x03, 0xD3, 0x8F, 0x4E, 0x35, 0x56, 0xB6, 0x96, 0x42, 0x6B, 0xBE, 0x1B, 0x33,
-    0x57, 0x07, 0x9C, 0xA2, 0x0A, 0xEE, 0x37, 0x2E, 0x63, 0x62, 0xCE, 0xAF, 0x4F, 0x31, 0x10, 0x96,
-    0xEA, 0x3B, 0x44, 0x64, 0xAE, 0xD1, 0x41, 0xDD, 0xE0, 0x0C, 0x3C, 0x60, 0xCD, 0x4C, 0xF7, 0x1A,
-    0x2D, 0x78, 0x83, 0x9D, 0xF4, 0xBA, 0x47, 0x23, 0xEA, 0xB3, 0x98, 0x9F, 0xDA, 0xD2, 0xB3, 0xA6,
-    0x0F, 0xB6, 0xB2, 0xB4, 0xB3, 0x28, 0x55, 0x73, 0xE7, 0x06, 0x8A, 0x11, 0x17, 0x18, 0x41, 0x54,
-    0xE1, 0xBD, 0x49, 0x85, 0x86, 0x93, 0x3A, 0xE0, 0x36, 0x01, 0xB2, 0x35, 0xAF, 0xC5, 0xCB, 0x6E,
-    0xC7, 0x7C, 0xA9, 0x8F, 0x31, 0x16, 0x03, 0x15, 0x92, 0x34, 0xD7, 0x9C, 0x60, 0xB0, 0x8F, 0x9A,
-    0x8B, 0x5A, 0x52, 0x0F, 0xBD, 0x51, 0x09, 0xAE, 0x71, 0xF0, 0xD4, 0x29, 0x89, 0xD9, 0x2C, 0xFE,
-    0xD7, 0x85, 0x8A, 0x3F, 0x0A, 0xD0, 0xDB, 0xE1, 0x9E, 0xDF, 0x0D, 0x97, 0xE7, 0x2D, 0xFE, 0xC7,
-    0x1D, 0xC4, 0xBF, 0x03, 0xCE, 0xE6, 0x10, 0xA4, 0x87, 0x53, 0x56, 0xF1, 0xE7, 0x3B, 0x4A, 0x94,
-    0x08, 0x5C, 0x36, 0xD2, 0x6C, 0x50, 0x10, 0x32, 0x55, 0xDF, 0xED, 0x0C, 0xDA, 0x7E, 0xC1, 0x58,
-    0x71, 0x07, 0xC0, 0x4A, 0xE4, 0xCC, 0xA3, 0x55, 0xB7, 0x1B, 0xF6, 0x2F, 0xDC, 0x9B, 0x97, 0xA7,
-    0x34, 0xC3, 0x46, 0xD5, 0x75, 0xE6, 0x19, 0x2D, 0x86, 0x87, 0xB4, 0xC3, 0x25, 0x32, 0x92, 0x38,
-    0x97, 0x83, 0x55, 0x9E, 0xD4, 0xF3, 0x7C, 0xB3, 0x14, 0x7F, 0x9A, 0x67, 0x82, 0x7C, 0xF3, 0xF2,
-    0x10, 0xFA, 0x1F, 0xB5, 0x58, 0x3D, 0x6C, 0xE5, 0xC6, 0x11, 0x1E, 0x3E, 0xE6, 0x89, 0x80, 0x08,
-    0x63, 0x55, 0x48, 0x01, 0xAC, 0x03, 0x4C, 0x37, 0x01, 0xE2, 0x07, 0x43, 0x9B, 0x22, 0xC5, 0x15,
-    0xF6, 0x2D, 0xA3, 0x74, 0x69, 0x4E, 0x85, 0x94, 0x36, 0x6D, 0xAC, 0x22, 0x76, 0x91, 0xD2, 0x11,
-    0x29, 0xAB, 0x48, 0xE1, 0x22, 0x02, 0x52, 0xA4, 0x48, 0x73, 0x01, 0x0C, 0xE3, 0xA4, 0x00, 0xAE,
-    0x52, 0x1C, 0x0C, 0xE7, 0xC8, 0x3B, 0x15, 0x6E, 0xF7, 0x7C, 0x40, 0x5C, 0xA4, 0xC8, 0x06, 0x49,
-    0x10, 0x04, 0x29, 0xC2, 0x0B, 0x18, 0x84, 0x87, 0x90, 0xDC, 0x7C, 0xB3, 0x4B, 0xEA, 0xBD, 0xA7,
-    0x93, 0xEF, 0x9E, 0xF3, 0xC3, 0xE5, 0x2C, 0xE7, 0xED, 0xCE, 0x0E, 0x77, 0x67, 0x67, 0xBE, 0x1D,
-    0x3E, 0xA2, 0x20, 0x27, 0x73, 0x78, 0xEF, 0xE3, 0x7B, 0x77, 0xCC, 0x2F, 0xF2, 0x3B, 0xF4, 0xE2,
-    0x42, 0x34, 0x49, 0x63, 0xDA, 0x39, 0xDB, 0xF9, 0x28, 0x5E, 0x9F, 0x7C, 0x87, 0xD6, 0x5F, 0x5C,
-    0x66, 0xE7, 0xA9, 0xB2, 0xC3, 0xBD, 0xC8, 0x5B, 0x6B, 0x9B, 0x91, 0x0E, 0x0E, 0x0E, 0xF6, 0x41,
-    0x04, 0x9E, 0xDB, 0xD3, 0x02, 0x74, 0xE0, 0xAE, 0x7D, 0xEB, 0xAE, 0x76, 0x78, 0x14, 0xFE, 0xF1,
-    0xBC, 0x3E, 0x4C, 0x31, 0xA3, 0x5F, 0xFF, 0xCF, 0xEF, 0x19, 0x7D, 0x7F, 0xEB, 0xE0, 0x00, 0x13,
-    0xB7, 0xE5, 0xEC, 0xFC, 0x3C, 0xC7, 0x5B, 0x68, 0xF1, 0x77, 0x64, 0x62, 0x23, 0xB4, 0x2C, 0x15,
-    0x4A, 0x91, 0x6F, 0x91, 0x30, 0x89, 0x91, 0x1A, 0xBF, 0x72, 0x95, 0x66, 0xB4, 0x49, 0x71, 0x2D,
-    0x2A, 0x51, 0x25, 0x2C, 0x91, 0x2B, 0xDA, 0xA2, 0x2C, 0xCF, 0x20, 0x29, 0xCB, 0x44, 0x0B, 0x13,
-    0x55, 0xC1, 0x5E, 0x64, 0x64, 0x1A, 0x1B, 0x95, 0x0A, 0x9D, 0x91, 0x2C, 0x2D, 0xA9, 0xB2, 0x27,
-    0xF5, 0xB0, 0xA7, 0xE2, 0xA4, 0xA3, 0xAD, 0x60, 0x1F, 0xFA, 0x8A, 0x34, 0x31, 0x36, 0x95, 0x7A,
-    0xE8, 0x3B, 0xEE, 0x48, 0xED, 0xB6, 0x94, 0x85, 0x35, 0x6D, 0x06, 0x7B, 0xD0, 0xAF, 0x4A, 0x51,
-    0x31, 0x65, 0x79, 0x62, 0x0A, 0x4A, 0xA0, 0x43, 0x96, 0x90, 0xF9, 0x56, 0x8B, 0xB7, 0xED, 0x51,
-    0x76, 0x02, 0xD9, 0x87, 0xF8, 0xFD, 0xA0, 0x77, 0xFA, 0x13, 0x5D, 0x40, 0x67, 0x46, 0x51, 0xA5,
-    0xD2, 0x60, 0x6F, 0x4A, 0xEE, 0x2A, 0x9C, 0xED, 0x3C, 0x29, 0xD0, 0x2D, 0xA2, 0xAF, 0x1D, 0x7D,
-    0x97, 0x32, 0xEC, 0x06, 0xD3, 0xE1, 0xD1, 0xA1, 0x6B, 0xBB, 0x24, 0xB5, 0x40, 0xD9, 0x15, 0x2A,
-    0x46, 0x4A, 0xBD, 0xEE, 0x0C, 0x4F, 0x95, 0xCE, 0xE5, 0x25, 0xB1, 0xDE, 0x7C, 0xA4, 0xB9, 0xAE,
-    0xB9, 0xDC, 0x86, 0x0A, 0xE6, 0x32, 0x45, 0x91, 0x2F, 0xBD, 0x8F, 0x65, 0x32, 0xA7, 0x3B, 0x6E,
-    0x48, 0x59, 0x08, 0xC2, 0x6B, 0x72, 0x77, 0x63, 0x53, 0x48, 0xF6, 0x14, 0xD5, 0xDC, 0xFB, 0x0E,
-    0xD1, 0x11, 0x24, 0x35, 0x65, 0x30, 0x00, 0xEB, 0x2A, 0xB3, 0x8E, 0x32, 0xC3, 0x73, 0xFC, 0xA1,
-    0x9B, 0xD8, 0x34, 0x55, 0x5A, 0x55, 0xAA, 0x92, 0x7A, 0x4A, 0x53, 0xF7, 0x2B, 0xA9, 0x32, 0xA3,
-    0x40, 0x12, 0xF6, 0x4C, 0xCC, 0x94, 0x82, 0x94, 0xDB, 0x03, 0xF4, 0x48, 0xE3, 0xFB, 0x94, 0xAB,
-    0xB9, 0x5F, 0x6A, 0x27, 0xE1, 0x64, 0x94, 0xCE, 0x0C, 0xDA, 0xCB, 0x29, 0x1D, 0xDE, 0xFD, 0xF8,
-    0xEE, 0x2A, 0xD1, 0xC4, 0x65, 0x76, 0x36, 0xFB, 0x68, 0x95, 0x38, 0x72, 0x85, 0xB2, 0x6E, 0x5E,
-    0x26, 0xF9, 0x8B, 0x0B, 0x8F, 0x78, 0x87, 0x7C, 0x59, 0x7D, 0x04, 0xBD, 0xE4, 0xCB, 0xAA, 0x23,
-    0xC6, 0x6B, 0x62, 0x53, 0xB7, 0x31, 0x44, 0xC2, 0x6A, 0xB7, 0xFD, 0x44, 0x89, 0xAD, 0xA8, 0x73,
-    0x9C, 0xBA, 0xA8, 0x27, 0xAD, 0xE7, 0xBE, 0xDD, 0x84, 0x95, 0xE7, 0x76, 0x5B, 0x61, 0x46, 0x2E,
-    0x29, 0x07, 0xAE, 0x51, 0xF9, 0x28, 0x97, 0xAD, 0xFD, 0x91, 0x6E, 0x9C, 0x92, 0xBC, 0xA8, 0x3B,
-    0xD5, 0x93, 0x6D, 0xA0, 0xEF, 0xEF, 0x08, 0xF5, 0x5D, 0xDB, 0x53, 0x6C, 0x1F, 0xD7, 0xBD, 0xBC,
-    0x68, 0x0A, 0x0A, 0xFA, 0xF8, 0x49, 0x2B, 0x3E, 0xAD, 0xF8, 0xDD, 0xE2, 0x41, 0x2B, 0x3E, 0x77,
-    0x9C, 0x3A, 0x1E, 0xB9, 0x2C, 0x18, 0xB9, 0x7E, 0xE4, 0x82, 0x96, 0xBA, 0xE4, 0xA2, 0x86, 0x1B,
-    0x20, 0x82, 0x6C, 0xF1, 0xB0, 0xB7, 0xF0, 0xA4, 0x8A, 0x3D, 0x89, 0x21, 0x44, 0x68, 0x4A, 0x10,
-    0x2C, 0xB5, 0x5F, 0x16, 0xA4, 0x69, 0xE9, 0x9A, 0xAF, 0x73, 0x71, 0xA5, 0x8B, 0x6B, 0x5D, 0x5C,
-    0xAD, 0x5F, 0x6F, 0x3D, 0xF2, 0xBB, 0x6D, 0x6C, 0xE6, 0xFC, 0xB0, 0x66, 0xC7, 0xAB, 0xD1, 0x94,
-    0xEA, 0x64, 0x5C, 0xF7, 0x0F, 0x52, 0xAC, 0xBC, 0x97, 0x96, 0x8A, 0x76, 0x62, 0xAB, 0xC4, 0x3E,
-    0xC1, 0xDA, 0x8F, 0x6D, 0x1F, 0xD9, 0x96, 0x57, 0x6F, 0xE5, 0x45, 0x5B, 0x88, 0x27, 0x1D, 0xD6,
-    0x5F, 0x75, 0xE2, 0x71, 0xAD, 0x6E, 0xEB, 0x1E, 0x33, 0x7A, 0xD4, 0x8A, 0x3F, 0x57, 0xEA, 0x27,
-    0xCC, 0xCB, 0xE3, 0x81, 0x2F, 0xBC, 0x15, 0x46, 0xBE, 0xA7, 0x96, 0xE5, 0x59, 0xC6, 0x59, 0xE2,
-    0x71, 0xA3, 0x6E, 0x9B, 0x8E, 0xC2, 0x86, 0x0A, 0xB6, 0x45, 0xF4, 0xAF, 0x16, 0xD0, 0x40, 0x0C,
-    0xD3, 0x5D, 0x08, 0xA3, 0xC3, 0x1E, 0xC2, 0xD9, 0xA3, 0xD0, 0x4B, 0x16, 0xE9, 0x09, 0x6B, 0xC4,
-    0x20, 0x58, 0x4E, 0x94, 0x24, 0x5D, 0x88, 0xBE, 0xC5, 0xED, 0x71, 0x35, 0xC1, 0xC6, 0x86, 0x8D,
-    0x2C, 0x63, 0x58, 0x5B, 0x94, 0xF7, 0xD1, 0xD9, 0x92, 0x9A, 0xD4, 0xF4, 0xD6, 0xE4, 0x8E, 0xEB,
-    0x57, 0x39, 0x4B, 0x14, 0xC4, 0x32, 0x1D, 0x14, 0x30, 0x9A, 0x41, 0x0E, 0x7E, 0x01, 0xC9, 0x58,
-    0xB3, 0x2C, 0x54, 0x42, 0x7A, 0x1B, 0xF6, 0xC8, 0x01, 0x5A, 0xC0, 0x2B, 0x9E, 0xD3, 0xA4, 0x21,
-    0x6A, 0x5D, 0x50, 0xCF, 0x48, 0xBD, 0xD7, 0xA2, 0xA3, 0x67, 0x74, 0x64, 0x24, 0xCB, 0x27, 0x0D,
-    0x86, 0xB0, 0x79, 0x8F, 0xA0, 0x66, 0x16, 0x7C, 0x80, 0xFE, 0x44, 0xB3, 0x84, 0xA8, 0x58, 0x06,
-    0x13, 0x85, 0xD4, 0x71, 0x4B, 0x2C, 0x07, 0xE3, 0x40, 0x12, 0xF3, 0x85, 0x6C, 0x92, 0xB3, 0xF4,
-    0x7A, 0x0E, 0xA0, 0xA6, 0x77, 0x09, 0x5B, 0x18, 0x58, 0x0A, 0x7F, 0x97, 0x47, 0x9F, 0x96, 0xE2,
-    0xC4, 0x24, 0x41, 0x75, 0x8B, 0x9A, 0x37, 0xD0, 0xB1, 0x41, 0x74, 0xDF, 0x75, 0x75, 0x24, 0x00,
-    0x3A, 0x15, 0x15, 0x25, 0xDF, 0x60, 0xF0, 0x33, 0x74, 0xA3, 0x20, 0x00, 0xB1, 0xA9, 0xC3, 0x37,
-    0x74, 0xC9, 0x79, 0x57, 0x8A, 0xDB, 0x0F, 0x94, 0x6E, 0x20, 0x04, 0xA6, 0xA3, 0x3F, 0x05, 0xC0,
-    0xEB, 0x80, 0x44, 0x2A, 0x4D, 0x9C, 0x4B, 0xA0, 0x8C, 0x34, 0xA2, 0x4E, 0x70, 0x8E, 0x84, 0x5D,
-    0x30, 0xC1, 0x3C, 0x6D, 0x0A, 0x8C, 0x23, 0x86, 0x1F, 0x6C, 0x6E, 0x0D, 0x20, 0x9C, 0x86, 0xD6,
-    0x02, 0x8F, 0x72, 0xDB, 0x8A, 0xAA, 0x28, 0x55, 0x25, 0xEA, 0xAC, 0x2C, 0x70, 0xC2, 0xC8, 0x5D,
-    0xDB, 0x45, 0x1A, 0x88, 0x08, 0xFF, 0x24, 0x69, 0x14, 0x36, 0xAB, 0xC8, 0x45, 0x4D, 0x50, 0x82,
-    0x57, 0xC7, 0x4D, 0x9C, 0xE3, 0x04, 0xE1, 0x73, 0x49, 0x27, 0xB9, 0x32, 0xA2, 0x5C, 0x23, 0xA9,
-    0x43, 0xBC, 0x7F, 0x9D, 0x63, 0x44, 0x2B, 0xE3, 0xB0, 0x4D, 0x3B, 0x32, 0x73, 0x82, 0xA2, 0xD2,
-    0x91, 0x9E, 0x13, 0x9F, 0x64, 0x8E, 0x46, 0xF7, 0x1D, 0xB0, 0x53, 0x1A, 0x8F, 0x9D, 0xCA, 0x61,
-    0xE3, 0x74, 0x70, 0x93, 0x35, 0x5B, 0x03, 0x7C, 0x7B, 0x87, 0xE6, 0xAA, 0x2B, 0xCA, 0xAF, 0xB6,
-    0xAA, 0x9C, 0xB4, 0x12, 0xA4, 0xCA, 0xA0, 0x2D, 0xF2, 0x00, 0xD1, 0x17, 0x20, 0xEE, 0x02, 0x6B,
-    0x78, 0xB5, 0x20, 0xE7, 0x5B, 0xF3, 0x0B, 0xFB, 0xC2, 0x6D, 0x30, 0xA1, 0x23, 0xD7, 0xBF, 0x39,
-    0xC4, 0x8A, 0xB5, 0xFD, 0x48, 0xAE, 0xE1, 0x9B, 0x88, 0xCF, 0xF2, 0x0D, 0xA2, 0x28, 0x17, 0x88,
-    0x48, 0x8A, 0x4C, 0xF0, 0x09, 0x06, 0xB0, 0xE6, 0x1B, 0x7D, 0x7A, 0x19, 0xA8, 0xAC, 0x08, 0xD1,
-    0x1A, 0x19, 0xFA, 0x84, 0x20, 0x27, 0x08, 0x23, 0xC2, 0xFC, 0x1B, 0x78, 0xC7, 0xB8, 0xA2, 0x97,
-    0x89, 0xDB, 0xEE, 0x11, 0xD5, 0x14, 0x54, 0x14, 0x6A, 0x8A, 0xE0, 0x82, 0x29, 0x34, 0xD2, 0x9B,
-    0x0B, 0x5E, 0xF2, 0xD7, 0x34, 0xBC, 0x28, 0xE3, 0x13, 0x2D, 0x82, 0x6A, 0x87, 0x6A, 0xF6, 0x92,
-    0x85, 0x2B, 0xAE, 0x06, 0x26, 0x7A, 0x96, 0x19, 0x30, 0x20, 0xF9, 0xE9, 0xEF, 0x3D, 0x4A, 0x48,
-    0x9F, 0xBB, 0x2C, 0x30, 0xD3, 0xB7, 0xBB, 0x7D, 0x2F, 0x24, 0x47, 0x20, 0xC9, 0x46, 0xA4, 0xE9,
-    0x07, 0xAC, 0x08, 0x5B, 0xA9, 0xFD, 0x29, 0x76, 0x4F, 0xA4, 0x2C, 0x8D, 0x38, 0xF9, 0x8A, 0xC3,
-    0x1D, 0x30, 0x1C, 0xDA, 0x78, 0x43, 0xEE, 0x99, 0x8D, 0x24, 0xDF, 0x08, 0x82, 0x26, 0xA0, 0xFB,
-    0xDF, 0xFB, 0x79, 0x15, 0xFD, 0xE9, 0x69, 0x41, 0xC8, 0x98, 0xAA, 0x18, 0x39, 0x13, 0xE7, 0x5D,
-    0x95, 0x60, 0x26, 0x28, 0xFE, 0x01, 0x33, 0xD9, 0x3D, 0x18, 0xAC, 0x62, 0x68, 0x4B, 0xE1, 0x3A,
-    0x18, 0x2A, 0xFF, 0x56, 0xE2, 0x38, 0x85, 0x79, 0xB3, 0xDB, 0x86, 0xE0, 0x72, 0x29, 0xD9, 0x18,
-    0x5E, 0x65, 0x6E, 0x12, 0xBD, 0x12, 0x2E, 0xE0, 0xFF, 0xE1, 0x39, 0x74, 0x0E, 0x37, 0xB9, 0x30,
-    0x45, 0xC8, 0xB9, 0x35, 0x33, 0xC8, 0xB3, 0xAF, 0x30, 0x6A, 0xF2, 0x1A, 0x80, 0x92, 0x1C, 0xC8,
-    0xE1, 0x62, 0x57, 0xEE, 0x33, 0x07, 0xEE, 0x6A, 0x1D, 0x2C, 0x3B, 0xFB, 0x89, 0x85, 0x2E, 0xE4,
-    0x7A, 0x5C, 0xE8, 0x4A, 0xB9, 0xEB, 0x5A, 0xF7, 0xAF, 0xB4, 0xEE, 0x73, 0xEB, 0xF9, 0x5D, 0xD5,
-    0x67, 0x28, 0x41, 0x4F, 0x4B, 0x65, 0xE6, 0x5A, 0xB7, 0xAE, 0xB4, 0x6E, 0xB9, 0xD6, 0xD9, 0xD9,
-    0xB0, 0x1C, 0xE7, 0xB6, 0x3D, 0xE7, 0x3E, 0xB0, 0x92, 0xC1, 0xE3, 0x7D, 0x6B, 0x6B, 0xF5, 0xA1,
-    0xBD, 0x78, 0xFA, 0x76, 0xBB, 0x49, 0xEA, 0xB3, 0x34, 0x6A, 0x39, 0x2C, 0xB1, 0x09, 0x78, 0xC0,
-    0x42, 0x78, 0xD8, 0xD2, 0x05, 0x3C, 0x96, 0x9F, 0x55, 0x94, 0x00, 0x69, 0xAC, 0xC3, 0x87, 0xA8,
-    0xE7, 0x48, 0x44, 0xF0, 0x3A, 0xD7, 0xE5, 0x15, 0xF7, 0xEE, 0x90, 0xB9, 0x72, 0xC1, 0xA5, 0x03,
-    0xEF, 0xDD, 0x49, 0x05, 0xEF, 0x02, 0xEA, 0xD5, 0xCE, 0xDF, 0x81, 0x18, 0x6E, 0x5C, 0x75, 0x29,
-    0x32, 0xCE, 0x2F, 0x70, 0xA9, 0x99, 0xAF, 0x8F, 0x91, 0xF9, 0x7C, 0x68, 0x1F, 0xD8, 0x14, 0x73,
-    0xD3, 0x1C, 0x25, 0xA8, 0x39, 0x40, 0x4A, 0xAE, 0x2D, 0xD7, 0xA1, 0x75, 0xBA, 0x5B, 0xAE, 0x31,
-    0x2B, 0xEB, 0x26, 0x65, 0x69, 0xB8, 0x7B, 0x1F, 0x57, 0xCB, 0xF3, 0xD9, 0x1C, 0x7A, 0x31, 0x1B,
-    0x77, 0x33, 0x8C, 0x0D, 0xF2, 0x9B, 0x97, 0x31, 0x08, 0xF0, 0xB8, 0x81, 0x00, 0xCB, 0x0C, 0xBB,
-    0x2E, 0xDE, 0x0A, 0x4F, 0x52, 0xBA, 0xF8, 0x19, 0xE6, 0xA3, 0x5F, 0xC5, 0x2B, 0x3C, 0x0E, 0x71,
-    0x8D, 0x96, 0x12, 0x36, 0x61, 0x6B, 0xC5, 0x1D, 0xD7, 0x38, 0x52, 0x50, 0xE3, 0x08, 0x05, 0x10,
-    0x58, 0x76, 0x5A, 0xF6, 0x54, 0x06, 0x86, 0xE5, 0x89, 0x00, 0x29, 0xF7, 0x79, 0x3D, 0x21, 0xFB,
-    0xA0, 0x71, 0xE6, 0x75, 0x35, 0x60, 0xA4, 0x73, 0xBD, 0x80, 0x66, 0x78, 0x73, 0x6D, 0x07, 0xC2,
-    0x22, 0x8D, 0x0F, 0x81, 0x2C, 0x77, 0x73, 0x65, 0x31, 0xDE, 0xA6, 0x78, 0xE8, 0xC2, 0x4B, 0x79,
-    0xED, 0xDC, 0x05, 0x64, 0x74, 0x5B, 0xC7, 0xD7, 0xF0, 0x01, 0x62, 0x9E, 0x66, 0xB6, 0x6E, 0x94,
-    0x6D, 0x40, 0xED, 0x73, 0x88, 0x65, 0x0C, 0x28, 0x6F, 0xDE, 0xDC, 0xA0, 0x06, 0xB0, 0xB0, 0x0A,
-    0x7D, 0xF0, 0x1A, 0xA7, 0xC5, 0x7C, 0x86, 0xDB, 0x3E, 0x71, 0xC0, 0xD5, 0xEE, 0x30, 0x65, 0xD7,
-    0xD0, 0xD0, 0x77, 0x0B, 0xC1, 0xE9, 0xE4, 0x11, 0x61, 0x67, 0x03, 0x90, 0xB2, 0x3F, 0xD6, 0xEF,
-    0xA2, 0x13, 0xD4, 0x0D, 0xD4, 0x2F, 0x50, 0x37, 0xF4, 0xB5, 0x2C, 0x07, 0xD2, 0x18, 0x3A, 0x64,
-    0x2C, 0xC6, 0x13, 0x0E, 0x59, 0x26, 0xF9, 0xE3, 0xDF, 0x60, 0x09, 0x96, 0xA9, 0x9D, 0x66, 0x4F,
-    0xF7, 0x48, 0xC1, 0x18, 0x3D, 0x9F, 0xEC, 0x59, 0x1A, 0x32, 0x40, 0xD7, 0xAF, 0x38, 0xFB, 0xB2,
-    0x3D, 0x5D, 0x82, 0xAB, 0xD7, 0xD3, 0xE5, 0xDD, 0xD9, 0xC2, 0xAE, 0xE2, 0x48, 0xC1, 0xA7, 0x4C,
-    0x5C, 0x85, 0xD5, 0xA4, 0x5A, 0x1D, 0x63, 0xFF, 0x0F, 0xD7, 0x0A, 0xF0, 0xFF, 0x1F, 0x1B, 0xE0,
-    0xBF, 0x1B, 0x9B, 0xE1, 0x4B, 0xD0, 0x22, 0xEF, 0xB0, 0xC8, 0x77, 0x0A, 0x64, 0x2E, 0x2F, 0x33,
-    0xC4, 0x2D, 0x82, 0xA3, 0x5C, 0x00, 0xC8, 0xDE, 0x83, 0x36, 0xE3, 0xE7, 0x25, 0x12, 0xEA, 0x4D,
-    0x4A, 0x1E, 0x20, 0x78, 0xDE, 0xC3, 0xE7, 0x0E, 0x82, 0xA8, 0x70, 0x47, 0xE4, 0x06, 0x40, 0xFB,
-    0x2F, 0x78, 0x7E, 0x1D, 0x18, 0xD5, 0xEF, 0x51, 0xAB, 0xDC, 0x67, 0x70, 0x7D, 0x44, 0xDB, 0x78,
-    0xE8, 0x5F, 0x21, 0x3A, 0x8A, 0xF9, 0x49, 0x1A, 0xF0, 0x11, 0x81, 0xCF, 0x20, 0xC0, 0xFA, 0x2F,
-    0x6B, 0x8A, 0x73, 0xFA, 0x11, 0x61, 0x7E, 0x71, 0x0A, 0x20, 0x0F, 0xCB, 0x57, 0x1D, 0xB4, 0x4C,
-    0x4E, 0x89, 0x0F, 0xBB, 0xF0, 0xE4, 0x91, 0x8E, 0xFF, 0xF0, 0x79, 0x35, 0xC1, 0x07, 0x2E, 0xC3,
-    0xF9, 0xAC, 0xE8, 0xCF, 0xA0, 0xBA, 0x63, 0x02, 0x28, 0xF2, 0xCE, 0xE6, 0xD1, 0x3F, 0x7F, 0x6B,
-    0xA2, 0x8B, 0xCF, 0x4C, 0x10, 0xEA, 0x94, 0xC7, 0x78, 0x68, 0x02, 0x74, 0x39, 0xC0, 0x92, 0xC3,
-    0xCA, 0x96, 0xAF, 0x75, 0x87, 0x4B, 0x1C, 0xBF, 0x78, 0x1A, 0x7F, 0x3A, 0x3D, 0x7B, 0xC5, 0xA7,
-    0x7E, 0xBC, 0x1A, 0xF4, 0xAC, 0xE5, 0x84, 0x1C, 0xAE, 0xE0, 0xAC, 0x32, 0x79, 0xD4, 0x73, 0x62,
-    0xA9, 0x4E, 0x5A, 0xCE, 0x2D, 0xB3, 0xC8, 0xA5, 0x97, 0x9D, 0x30, 0xC8, 0x30, 0x8F, 0x9B, 0xA4,
-    0x04, 0xFE, 0x84, 0x95, 0xCF, 0x33, 0x4F, 0x5F, 0xE3, 0x54, 0x73, 0x80, 0xCB, 0xC4, 0x79, 0xA5,
-    0x5C, 0xA8, 0x9F, 0x9D, 0xDB, 0xF2, 0x2C, 0x27, 0xA7, 0x3C, 0x4F, 0xD1, 0xF0, 0x4C, 0x45, 0xCB,
-    0x73, 0x15, 0x0D, 0xCF, 0x36, 0x7A, 0xCE, 0x38, 0x9E, 0xF7, 0xA8, 0x5F, 0x2D, 0xBC, 0x0B, 0xF3,
-    0x77, 0xD9, 0x1E, 0x7F, 0x44, 0x72, 0x0E, 0xE7, 0x75, 0xBA, 0xBA, 0xE1, 0x5D, 0xBF, 0x4C, 0x14,
-    0xAE, 0xB9, 0xD6, 0xF2, 0xEB, 0x75, 0xC6, 0xFA, 0x8B, 0xC7, 0xF0, 0x3C, 0xD7, 0xCC, 0xD2, 0xFC,
-    0x1D, 0xEF, 0xD7, 0xF5, 0xC5, 0x91, 0x3C, 0xC7, 0xDB, 0xF9, 0xC7, 0x2C, 0x05, 0x0D, 0x79, 0x94,
-    0x74, 0xC7, 0x98, 0xE7, 0x5C, 0xDB, 0xF5, 0x86, 0xDB, 0xE6, 0x35, 0xF2, 0x70, 0xEC, 0x31, 0xAC,
-    0x96, 0x21, 0x4B, 0xE4, 0x2F, 0x83, 0x6B, 0xAF, 0xBD, 0x25, 0xCD, 0x5E, 0x7D, 0x3B, 0x76, 0xB8,
-    0xA3, 0xDF, 0xD7, 0x51, 0x25, 0x4A, 0xEC, 0x33, 0xD2, 0x76, 0x5B, 0x8A, 0xD6, 0xD5, 0xE0, 0x8B,
-    0x72, 0x82, 0x24, 0x76, 0x67, 0x49, 0xD2, 0xD7, 0x0B, 0x7F, 0x0C, 0xB5, 0xE3, 0xDF, 0x42, 0x89,
-    0x5E, 0x96, 0x99, 0x9C, 0x8A, 0x72, 0x9B, 0xBC, 0x9E, 0xB9, 0x4E, 0x0B, 0xA7, 0x12, 0x25, 0xFF,
-    0xB3, 0xB0, 0xA8, 0x53, 0x96, 0xEA, 0x8A, 0xBD, 0xB8, 0x05, 0x49, 0xAE, 0x19, 0x5B, 0x82, 0x4B,
-    0x9B, 0xAE, 0x5D, 0xFE, 0x15, 0xC0, 0x3B, 0xBB, 0x9E, 0x32, 0xAF, 0x0C, 0xEF, 0xC8, 0xB6, 0xE7,
-    0x35, 0xF3, 0x48, 0xC0, 0xF5, 0xA8, 0x71, 0xFE, 0x99, 0xFD, 0x25, 0x3E, 0xEA, 0x5F, 0xF2, 0x65,
-    0xD5, 0x11, 0xAA, 0x95, 0x8D, 0xA8, 0x22, 0x1D, 0x96, 0xAB, 0xC8, 0xF3, 0x88, 0x20, 0x0D, 0xCB,
-    0x48, 0xE3, 0xA3, 0xA2, 0x51, 0xED, 0x6A, 0x23, 0x26, 0x79, 0x6C, 0x6E, 0xBE, 0x7E, 0xF3, 0xF5,
-    0xD8, 0xAC, 0xF6, 0x16, 0x3E, 0x9D, 0xBF, 0xDC, 0xCA, 0xFF, 0x0D, 0xED, 0x53, 0xAF, 0x6F, 0x14,
-    0x41, 0x14, 0xFE, 0x76, 0x96, 0xB2, 0x24, 0x1B, 0x32, 0x08, 0x14, 0x66, 0x0D, 0x82, 0x9C, 0x99,
-    0xBF, 0xA0, 0x37, 0x9B, 0x54, 0x54, 0xD4, 0x20, 0x68, 0xF8, 0x17, 0x2E, 0x98, 0xDA, 0x8A, 0x2B,
-    0xBB, 0x29, 0x02, 0x81, 0xA0, 0x0E, 0x81, 0xA9, 0x40, 0x6D, 0x45, 0x2D, 0x82, 0xB9, 0x19, 0x8F,
-    0xE8, 0xFE, 0x07, 0x8C, 0x00, 0x83, 0xE9, 0x88, 0x21, 0xB9, 0x86, 0xBB, 0x7D, 0xBC, 0xB9, 0xFE,
-    0x48, 0x81, 0x86, 0xA0, 0x50, 0xCC, 0x7C, 0xD9, 0xDD, 0x79, 0xEF, 0xCD, 0x7B, 0xDF, 0xFB, 0xB1,
-    0x62, 0x80, 0x24, 0xA7, 0xC8, 0xEB, 0x8F, 0xA1, 0xD9, 0x8C, 0x4D, 0x7E, 0x89, 0x8D, 0xA8, 0x5F,
-    0x05, 0x45, 0x81, 0xB5, 0x39, 0x81, 0xD7, 0x23, 0x33, 0x85, 0xB9, 0x5C, 0x13, 0x3C, 0x68, 0xA1,
-    0x1D, 0xC8, 0x65, 0xAC, 0xFF, 0xE4, 0xE4, 0x6B, 0x57, 0x49, 0xB7, 0x2E, 0x9D, 0xA5, 0xB9, 0xA5,
-    0xC5, 0xB3, 0xE3, 0xCF, 0x90, 0x8E, 0x31, 0xEA, 0xA0, 0xA9, 0x6E, 0xA8, 0x9E, 0x02, 0x7B, 0x80,
-    0x5D, 0xA2, 0xA1, 0x16, 0xCA, 0x9D, 0x6B, 0xBF, 0x35, 0x8E, 0x58, 0x3B, 0x4F, 0xEE, 0xB1, 0xD3,
-    0xE7, 0xD4, 0xCB, 0xE1, 0x80, 0x95, 0x1A, 0xD0, 0x8D, 0x6B, 0x28, 0x30, 0x0B, 0xE6, 0xA2, 0x19,
-    0x6F, 0x99, 0x88, 0x17, 0x54, 0xB3, 0xE1, 0xA8, 0x3B, 0xD4, 0x14, 0x19, 0xC8, 0x03, 0x4A, 0x9F,
-    0x5C, 0xA9, 0x36, 0xDD, 0x99, 0x01, 0x4B, 0x88, 0x05, 0xF2, 0x88, 0x32, 0x40, 0x0C, 0xA8, 0xA8,
-    0xE7, 0x8B, 0x3A, 0x0F, 0xEA, 0xA5, 0xE7, 0x3C, 0x4A, 0x6A, 0xD5, 0xA9, 0x67, 0x6F, 0xCF, 0x45,
-    0xD4, 0x9B, 0x9C, 0x9C, 0x67, 0x09, 0x3B, 0x14, 0x4B, 0xB6, 0x74, 0xFA, 0xD4, 0x37, 0x79, 0x68,
-    0xC4, 0x2A, 0xE2, 0x69, 0xAC, 0xBE, 0xC7, 0x6C, 0x83, 0xFD, 0x87, 0xB5, 0xA6, 0xAF, 0xA8, 0xAE,
-    0xCE, 0x12, 0x47, 0x71, 0x80, 0xBC, 0x4F, 0x78, 0xFA, 0x05, 0xCC, 0xFC, 0xE8, 0xEB, 0xC5, 0x51,
-    0xF4, 0xD8, 0xDE, 0x4E, 0x92, 0xAE, 0x4B, 0x66, 0xFC, 0x41, 0x2B, 0xAA, 0x5D, 0x97, 0x3E, 0x58,
-    0x95, 0x3D, 0x2E, 0x7A, 0xE9, 0xAA, 0x5A, 0x31, 0xCF, 0x31, 0xEF, 0x75, 0xDE, 0xE9, 0xAD, 0x50,
-    0x41, 0xB6, 0xA5, 0x13, 0xFE, 0x09, 0xD7, 0x87, 0x4F, 0x75, 0x3A, 0x95, 0xAE, 0xB8, 0xD8, 0xA5,
-    0x93, 0x4E, 0xF2, 0xAD, 0x31, 0x3E, 0x24, 0xC7, 0xEF, 0xA9, 0xB5, 0xE4, 0x6D, 0x11, 0x4C, 0xFE,
-    0x2B, 0x26, 0xE2, 0x50, 0xFC, 0x75, 0x2F, 0x31, 0x62, 0x92, 0x28, 0x08, 0x8A, 0xD1, 0xE0, 0x4E,
-    0x2A, 0xF8, 0x0D, 0xB8, 0x3D, 0xB0, 0x81, 0xD3, 0xD4, 0xDF, 0x95, 0x5C, 0x66, 0x8F, 0x8A, 0x5B,
-    0xD3, 0x62, 0x40, 0x31, 0x47, 0xE5, 0xB9, 0xB1, 0xE1, 0x1C, 0x6C, 0xA6, 0x39, 0xEE, 0xB1, 0xBF,
-    0x55, 0x04, 0x14, 0x5E, 0x58, 0x8E, 0x52, 0x8B, 0x63, 0x9F, 0xFA, 0x93, 0x87, 0xF1, 0x0E, 0xDB,
-    0xF4, 0x6A, 0x55, 0x8F, 0xFF, 0x53, 0xF3, 0xCF, 0xA7, 0xE6, 0x36, 0xD5, 0x92, 0xFA, 0xB5, 0x55,
-    0x2B, 0x4A, 0x6E, 0xD7, 0x9B, 0x94, 0x99, 0x2E, 0x52, 0xDF, 0xCA, 0x18, 0xB2, 0x21, 0x69, 0xD5,
-    0x7E, 0xD0, 0x59, 0xAA, 0x8D, 0xEE, 0xDE, 0x71, 0x45, 0x54, 0x7B, 0x4F, 0x52, 0xC8, 0xE8, 0x60,
-    0xA5, 0xF5, 0xEA, 0x45, 0xD4, 0x58, 0x5C, 0x41, 0xED, 0x47, 0x16, 0x66, 0x54, 0x9F, 0xD7, 0x43,
-    0x9E, 0xB8, 0x82, 0xBB, 0x3D, 0x20, 0x1F, 0x50, 0x72, 0xC6, 0x27, 0x8E, 0xFD, 0xEF, 0x65, 0xB1,
-    0x5C, 0xCD, 0xCE, 0x7D, 0x9E, 0x08, 0x11, 0x47, 0x47, 0xC9, 0xF9, 0x58, 0xA4, 0xD0, 0x1C, 0x8E,
-    0x8D, 0x27, 0x80, 0xB9, 0x82, 0xAD, 0x2D, 0xF5, 0x76, 0x2B, 0xCC, 0x7E, 0x1B, 0xEA, 0xA9, 0x08,
-    0x3F, 0x59, 0x0A, 0x6F, 0x64, 0x6F, 0x74, 0x6D, 0x96, 0xB0, 0xF3, 0x34, 0x17, 0x33, 0x0D, 0x53,
-    0x39, 0x53, 0xFA, 0x3D, 0x11, 0x27, 0xE6, 0xDA, 0x9A, 0xEE, 0xDA, 0x4D, 0xB6, 0x20, 0x1A, 0x60,
-    0xB7, 0xE6, 0x0D, 0x0C, 0x67, 0x0C, 0x93, 0x7B, 0x75, 0xE3, 0x63, 0x9A, 0x1E, 0xBB, 0x7F, 0xE4,
-    0xB1, 0x3B, 0x63, 0x6F, 0xCE, 0x6E, 0xF9, 0xEB, 0x72, 0x3E, 0xB2, 0xD0, 0xCC, 0xAE, 0x51, 0x04,
-    0x8A, 0xF4, 0x3B, 0xD4, 0xE3, 0x2C, 0xFD, 0x2B, 0xD5, 0x02, 0x69, 0xFC, 0x54, 0xFB, 0x50, 0xB6,
-    0x2C, 0x54, 0x67, 0x28, 0xEA, 0xB2, 0xAD, 0x96, 0x76, 0xA8, 0x5A, 0x79, 0xB9, 0x9D, 0x1C, 0xC4,
-    0xF2, 0x07, 0x95, 0x57, 0xBF, 0x8F, 0x1C, 0x49, 0x15, 0x7E, 0x3D, 0x63, 0x3C, 0xC0, 0x48, 0xD4,
-    0x05, 0x7B, 0xE2, 0x60, 0x25, 0x3A, 0xB5, 0x84, 0x8E, 0xF9, 0x07, 0x7C, 0xDB, 0x7D, 0xB6, 0x84,
-    0x03, 0x07, 0x36, 0x92, 0x17, 0x07, 0x0E, 0x56, 0xA4, 0x0B, 0xBA, 0x0D, 0x20, 0x44, 0x74, 0xDF,
-    0x5E, 0x70, 0x01, 0x01, 0x97, 0xDC, 0x25, 0x17, 0xE0, 0x80, 0xE0, 0x98, 0x0B, 0x36, 0x71, 0x82,
-    0x64, 0xBB, 0xDB, 0x76, 0x78, 0x01, 0x63, 0x83, 0x44, 0x40, 0xE0, 0x5E, 0x6C, 0x04, 0x78, 0x03,
-    0xF7, 0xAD, 0x7A, 0xBD, 0xBD, 0x3B, 0xDD, 0xFD, 0xF8, 0xBE, 0x57, 0x3D, 0x3B, 0x6B, 0x63, 0x74,
-    0xD0, 0xBB, 0xF5, 0xD5, 0x74, 0xFD, 0x78, 0x55, 0xF5, 0xEA, 0xBD, 0xEF, 0xBD, 0x16, 0xE1, 0x93,
-    0x1D, 0x89, 0x0C, 0xB5, 0x13, 0x71, 0xDA, 0x8A, 0x4C, 0x8E, 0x7E, 0x26, 0x12, 0xCD, 0xD0, 0x1E,
-    0xE5, 0x80, 0xE4, 0xDE, 0x74, 0x2A, 0xC9, 0xB6, 0x6A, 0x0F, 0xF7, 0x01, 0xD1, 0x7D, 0x8C, 0x8B,
-    0x5E, 0x00, 0x42, 0xC5, 0xBC, 0x11, 0x41, 0x32, 0xC2, 0x00, 0x45, 0x06, 0x2D, 0xA1, 0x5B, 0x07,
-    0x60, 0xF0, 0x29, 0xF0, 0xCF, 0xF7, 0x42, 0xC0, 0xDB, 0x3F, 0x60, 0x1B, 0x46, 0x47, 0xAA, 0xB9,
-    0xA8, 0x6A, 0x3A, 0xD4, 0x36, 0x8B, 0xC7, 0xDD, 0xAD, 0x3F, 0x88, 0xAB, 0xCB, 0x5B, 0x32, 0x29,
-    0xCB, 0x52, 0xA2, 0x5D, 0xC2, 0xA3, 0xDD, 0x02, 0xF0, 0x08, 0xF0, 0xA7, 0xFB, 0x33, 0x89, 0x9E,
-    0x3C, 0xC8, 0x65, 0x72, 0x08, 0x08, 0xF5, 0xC3, 0x14, 0x7B, 0xBE, 0x9C, 0xCA, 0x58, 0x7F, 0xFB,
-    0x29, 0x8E, 0xC0, 0x35, 0x32, 0xC2, 0x84, 0x92, 0xDF, 0x7E, 0x2F, 0x16, 0x39, 0xFF, 0x0E, 0x16,
-    0x3B, 0x77, 0xAE, 0x5F, 0x7A, 0x55, 0x0B, 0xAC, 0xD5, 0x60, 0x64, 0xED, 0xF4, 0x93, 0x72, 0x52,
-    0xCB, 0x1B, 0x51, 0x81, 0x33, 0xE2, 0xA0, 0x19, 0x8A, 0xBE, 0x7F, 0xF3, 0xB6, 0x5E, 0x38, 0x6C,
-    0xF4, 0x82, 0xD6, 0x28, 0x4F, 0x75, 0x5B, 0x25, 0xDB, 0x6E, 0x25, 0xC3, 0x79, 0x93, 0x47, 0xAD,
-    0x44, 0xFB, 0x2D, 0x16, 0xED, 0x6E, 0x39, 0xD5, 0x0A, 0x32, 0x2A, 0x49, 0x20, 0x4F, 0xAE, 0x52,
-    0x01, 0xCD, 0x4B, 0xA5, 0x11, 0x79, 0xA9, 0xB4, 0xEB, 0xD7, 0xD0, 0x5E, 0x9F, 0x94, 0xBE, 0x7D,
-    0xB5, 0xBD, 0x86, 0xFD, 0xB6, 0x56, 0xF8, 0xFB, 0xF4, 0x1C, 0x7B, 0x42, 0xFD, 0x08, 0x9D, 0x55,
-    0xA0, 0x5A, 0x0E, 0xF5, 0xD3, 0x62, 0xD8, 0x2E, 0xFB, 0x7F, 0xDA, 0x4D, 0xA9, 0x36, 0x2B, 0x7C,
-    0xBF, 0xD1, 0xAE, 0xBF, 0xF4, 0x3E, 0xAE, 0x31, 0xBD, 0xC4, 0xB9, 0x9E, 0x4D, 0x3F, 0x43, 0x5B,
-    0xB3, 0x28, 0x14, 0x7B, 0xD5, 0x84, 0x0F, 0x4B, 0xAB, 0x46, 0x85, 0x55, 0x63, 0xDC, 0x78, 0x37,
-    0xD6, 0x2B, 0x5A, 0x8A, 0x26, 0x18, 0xD8, 0x52, 0x92, 0x09, 0x3C, 0x48, 0xF4, 0x3A, 0xAA, 0x59,
-    0xD8, 0x04, 0x1A, 0x6B, 0xEE, 0x1A, 0x41, 0x95, 0xBA, 0xDA, 0x57, 0xD5, 0xE9, 0x2A, 0xF4, 0x55,
-    0xE4, 0xAB, 0xC4, 0x57, 0x6A, 0xD5, 0xFB, 0xBE, 0xDA, 0xF6, 0xD5, 0x07, 0xCF, 0x59, 0xD9, 0xA2,
-    0x78, 0x5C, 0x6E, 0xD5, 0x24, 0x96, 0xE5, 0xE3, 0xEA, 0xA0, 0x16, 0xD7, 0x0C, 0x00, 0x2D, 0xA1,
-    0x23, 0x28, 0xE1, 0x39, 0xE1, 0xF1, 0x76, 0x2D, 0x5B, 0xCF, 0xF7, 0x3A, 0xDE, 0xB7, 0xC6, 0x5B,
-    0x7B, 0xF3, 0x4E, 0xDC, 0x83, 0xDD, 0x5A, 0x36, 0xFE, 0xF2, 0xA2, 0xF5, 0x6D, 0x06, 0x2E, 0x6F,
-    0x31, 0x38, 0xBF, 0x4B, 0x48, 0x08, 0x11, 0x61, 0x42, 0x08, 0x09, 0x38, 0x45, 0xD6, 0xA5, 0x58,
-    0xCE, 0x6B, 0xC6, 0x2C, 0xC8, 0xAC, 0x51, 0xB8, 0x4B, 0x9A, 0x44, 0x1C, 0xCD, 0x56, 0x0C, 0x6F,
-    0x1B, 0xF2, 0xF0, 0xC9, 0x3D, 0xE0, 0xBB, 0xFA, 0x85, 0x29, 0x34, 0x21, 0x76, 0x11, 0x0C, 0x06,
-    0x36, 0x81, 0xF6, 0x7F, 0x09, 0x31, 0x7E, 0x1D, 0xB6, 0xC4, 0x01, 0xC6, 0xC7, 0x12, 0x18, 0x0A,
-    0xB6, 0x84, 0x27, 0xC0, 0x1E, 0x62, 0x5B, 0xB7, 0x32, 0x6C, 0x97, 0x3B, 0xB9, 0x60, 0x18, 0x63,
-    0xB5, 0x1A, 0x78, 0x49, 0x5B, 0xA0, 0xC3, 0xDC, 0x77, 0xD5, 0x95, 0xE7, 0xF4, 0xF3, 0x2E, 0xA4,
-    0x3D, 0xD7, 0xBC, 0x0B, 0x2D, 0x1C, 0xFA, 0xB4, 0x18, 0x6A, 0xA1, 0x57, 0x4A, 0xC9, 0x1A, 0xBD,
-    0x52, 0x4B, 0xD8, 0xE9, 0xA5, 0x86, 0xBE, 0x77, 0xB1, 0xA5, 0xC8, 0x0B, 0xFA, 0x9D, 0xA0, 0xC3,
-    0xA8, 0x0D, 0xCA, 0xC9, 0x1E, 0x73, 0x0F, 0xD1, 0x5F, 0xD5, 0xEE, 0x7F, 0x45, 0x12, 0x89, 0xD2,
-    0x30, 0x8D, 0xE0, 0x0C, 0x93, 0x34, 0x8A, 0xB3, 0x3C, 0xF2, 0x18, 0x47, 0xA9, 0xCE, 0x22, 0x99,
-    0xA4, 0xF3, 0x22, 0x91, 0x30, 0x3F, 0x24, 0xDE, 0x3B, 0x2C, 0xEF, 0x8A, 0xBB, 0xB7, 0x0F, 0x84,
-    0xE6, 0x8F, 0xBB, 0x94, 0xBA, 0xD6, 0x7C, 0x0B, 0x3F, 0xBB, 0x74, 0xF4, 0xA4, 0xA8, 0x1B, 0x19,
-    0x1D, 0xCE, 0xDA, 0x46, 0x86, 0xC0, 0x5A, 0x86, 0xF3, 0xFC, 0x6E, 0x05, 0xF7, 0xCC, 0x93, 0x12,
-    0x7B, 0x21, 0x06, 0xB0, 0x11, 0x62, 0x4C, 0xEF, 0xD3, 0x78, 0x52, 0xC0, 0x93, 0x8E, 0x65, 0x54,
-    0x41, 0x4E, 0x61, 0xD8, 0x00, 0x3F, 0xBE, 0xD1, 0x02, 0xE3, 0x40, 0x81, 0x3F, 0xBC, 0x49, 0xBC,
-    0x5C, 0x65, 0x1E, 0x2F, 0xFD, 0xCF, 0x68, 0xFF, 0x9B, 0xAE, 0x04, 0xC2, 0x1D, 0x88, 0xD9, 0x2C,
-    0xBB, 0xCC, 0xDD, 0x1A, 0x0A, 0xF1, 0xE9, 0xC2, 0xE6, 0xE8, 0x5F, 0x06, 0x70, 0xD2, 0x19, 0x48,
-    0x05, 0xAA, 0x31, 0xB0, 0xB6, 0x33, 0x80, 0x81, 0x3E, 0x69, 0x61, 0x85, 0xF3, 0x16, 0x0C, 0x83,
-    0x6B, 0x8A, 0x8E, 0xB6, 0x40, 0x0C, 0xE5, 0x18, 0x30, 0x43, 0x6F, 0x96, 0x9F, 0x00, 0x5F, 0xAD,
-    0x2D, 0x29, 0x47, 0x1C, 0xB7, 0xD1, 0xCF, 0x70, 0x7A, 0x48, 0x29, 0xE4, 0xCF, 0x33, 0x8B, 0x55,
-    0x83, 0xF5, 0xF5, 0xAB, 0x5C, 0xA7, 0x92, 0xB3, 0xD3, 0xE9, 0xEF, 0xC8, 0xC7, 0xB0, 0x0A, 0xBC,
-    0xC7, 0xE4, 0x46, 0xBC, 0x1D, 0xDF, 0x81, 0x8E, 0xD2, 0x33, 0x98, 0xB6, 0xD8, 0xE2, 0xF7, 0xBB,
-    0x69, 0xEC, 0x89, 0xD3, 0xC0, 0xE8, 0x62, 0x15, 0xFE, 0xEF, 0x27, 0x18, 0xF8, 0xA3, 0x90, 0x8D,
-    0x03, 0x35, 0xDB, 0x3A, 0x7A, 0x8F, 0x3D, 0x46, 0xF2, 0x1D, 0x1B, 0xD9, 0x1F, 0xC4, 0x62, 0x8E,
-    0xEB, 0x2A, 0xC8, 0x76, 0x34, 0x5F, 0x57, 0xC1, 0x96, 0x5C, 0x05, 0xE2, 0x70, 0x15, 0x62, 0x80,
-    0xAB, 0x32, 0x30, 0x6C, 0x05, 0x79, 0x8E, 0x6C, 0xBF, 0xA3, 0xDD, 0xEF, 0x65, 0xC1, 0x0D, 0x38,
-    0x4C, 0xC7, 0x0E, 0x18, 0x26, 0x86, 0x80, 0x42, 0x31, 0xA3, 0x58, 0xCC, 0x35, 0x29, 0x38, 0x39,
-    0x84, 0x52, 0x32, 0xF6, 0x40, 0x4E, 0x91, 0x57, 0x00, 0x93, 0xCD, 0xD3, 0x6F, 0x72, 0x57, 0x25,
-    0x01, 0x1E, 0xE7, 0x3A, 0xE9, 0x3B, 0xA2, 0xFA, 0x23, 0x1C, 0x7A, 0x5E, 0xCA, 0xE8, 0x39, 0xAE,
-    0x63, 0x70, 0x45, 0x17, 0x1D, 0xF0, 0x5F, 0x9C, 0xA0, 0xE6, 0x3D, 0x01, 0x86, 0xBF, 0xA9, 0xE5,
-    0x44, 0xD4, 0x92, 0x40, 0xC6, 0x76, 0x44, 0xE1, 0x4A, 0x66, 0xE1, 0x51, 0x4F, 0x7E, 0xE1, 0xC7,
-    0x59, 0xD7, 0x5F, 0xB7, 0x69, 0x46, 0xC0, 0x6D, 0xA9, 0xAF, 0x19, 0x07, 0x20, 0xD8, 0x07, 0x3E,
-    0x84, 0x32, 0x8B, 0x82, 0xD0, 0xA4, 0xAF, 0x1B, 0xDF, 0x0E, 0x6D, 0x27, 0xF9, 0xD6, 0x53, 0x19,
-    0x81, 0x3A, 0xEE, 0x63, 0x0D, 0x10, 0xAD, 0x7E, 0xD8, 0xF1, 0x94, 0x03, 0x75, 0x45, 0x14, 0xBB,
-    0x72, 0xD4, 0x85, 0xF0, 0x9E, 0xB0, 0x9C, 0x34, 0x13, 0xD4, 0x93, 0x63, 0xAD, 0x22, 0xFA, 0x11,
-    0x6C, 0x2A, 0xFA, 0xBB, 0xDA, 0x25, 0x24, 0x34, 0x1E, 0x72, 0x7B, 0xE6, 0x39, 0x38, 0xFB, 0x9A,
-    0xDF, 0x51, 0xBF, 0xB1, 0x45, 0x1D, 0xF8, 0x13, 0xC8, 0xA0, 0x8F, 0x07, 0xC3, 0x45, 0x7D, 0xEA,
-    0x98, 0x59, 0x41, 0x35, 0x34, 0xFD, 0xBD, 0x86, 0x07, 0x8C, 0x7E, 0x25, 0xA1, 0xC8, 0xFA, 0x5F,
-    0x21, 0xC1, 0x1D, 0x40, 0xD6, 0xB8, 0x6B, 0x78, 0xEA, 0x9A, 0xA1, 0x97, 0x0B, 0x43, 0xAB, 0x92,
-    0x23, 0xF0, 0x05, 0x05, 0xA4, 0x0C, 0xBF, 0x44, 0xDB, 0x78, 0xAE, 0xA4, 0xD9, 0xBD, 0x46, 0x26,
-    0xD9, 0x03, 0xEC, 0x71, 0x72, 0xB1, 0x93, 0x3B, 0xDF, 0x82, 0x4A, 0x60, 0xAE, 0xEA, 0x95, 0xD4,
-    0xC3, 0xB7, 0x09, 0x09, 0x37, 0x9A, 0x70, 0x57, 0xBC, 0x7A, 0xFD, 0x27, 0x77, 0xA1, 0x8C, 0xC9,
-    0x10, 0xE5, 0x0E, 0xC0, 0xFF, 0xE1, 0xC1, 0x86, 0x0F, 0x24, 0xA9, 0xA7, 0xE3, 0x12, 0x47, 0xD8,
-    0x38, 0xB8, 0xBE, 0x68, 0xEB, 0x76, 0x3A, 0xB4, 0x21, 0x6A, 0xF8, 0x19, 0x34, 0x66, 0x3B, 0x86,
-    0x3B, 0xC2, 0xCD, 0x38, 0x6E, 0xF1, 0x75, 0xD0, 0x3F, 0x91, 0x58, 0x0A, 0x11, 0xD3, 0xB3, 0x48,
-    0x83, 0x9A, 0x23, 0x26, 0x67, 0xB9, 0xD3, 0x5F, 0x05, 0x71, 0xD8, 0xAC, 0xF1, 0xF4, 0x80, 0xC8,
-    0x60, 0x06, 0x48, 0x66, 0xD1, 0xF4, 0x26, 0x40, 0x4B, 0x83, 0xC8, 0xA0, 0x58, 0x9B, 0x94, 0x18,
-    0x32, 0x29, 0x27, 0x15, 0xC0, 0xB5, 0x00, 0xB8, 0x5E, 0x56, 0x32, 0x99, 0x28, 0x19, 0x48, 0x4A,
-    0x24, 0x0D, 0x64, 0x67, 0xAE, 0x26, 0x6B, 0x9E, 0x2A, 0xA9, 0x44, 0x5A, 0x02, 0xED, 0x67, 0x4C,
-    0xE3, 0x31, 0xC3, 0x0D, 0xA9, 0xCE, 0xE8, 0x31, 0xEE, 0x23, 0xFA, 0x23, 0xB6, 0x99, 0xFC, 0xBA,
-    0xB2, 0x40, 0x54, 0x1B, 0x0C, 0x3A, 0x64, 0x45, 0xC3, 0x36, 0xE8, 0x4E, 0xB5, 0x6D, 0x1C, 0xAD,
-    0x67, 0x7F, 0xC6, 0x89, 0xA2, 0x1C, 0x3E, 0x83, 0xED, 0x14, 0xD8, 0x31, 0x4C, 0xCC, 0x95, 0xE6,
-    0x4C, 0x90, 0x3B, 0xF6, 0xF7, 0x1D, 0x64, 0xE6, 0xB6, 0x9E, 0x92, 0x2A, 0x19, 0x1D, 0x67, 0xE0,
-    0xF4, 0xD8, 0x3A, 0xCD, 0x22, 0x60, 0x91, 0x9B, 0xD3, 0x9D, 0x3E, 0x14, 0x6E, 0x66, 0xFA, 0x8C,
-    0x5C, 0x1F, 0xCB, 0x75, 0x05, 0x25, 0x2C, 0x43, 0x21, 0x93, 0x01, 0x59, 0xC0, 0xD7, 0xE1, 0x66,
-    0x3F, 0x6E, 0x28, 0xAF, 0x61, 0xDE, 0xD4, 0x88, 0x4F, 0x65, 0xFA, 0xCC, 0x60, 0x71, 0xD4, 0x11,
-    0x03, 0x12, 0xFC, 0x07, 0x1C, 0xCC, 0xAC, 0x82, 0x69, 0x9E, 0xEB, 0xD6, 0xBE, 0x21, 0x61, 0x7D,
-    0xA2, 0xDD, 0x62, 0xA9, 0xDD, 0x97, 0xC0, 0xDA, 0x7C, 0x2F, 0xC7, 0x41, 0xBB, 0x38, 0x42, 0xBB,
-    0x16, 0x60, 0xC9, 0x2C, 0x3B, 0x9D, 0xAA, 0x85, 0x7A, 0x24, 0xAF, 0x6A, 0x77, 0x85, 0xFB, 0x68,
-    0x10, 0xFF, 0x03, 0xC6, 0xFF, 0x41, 0x03, 0x7B, 0x1F, 0x33, 0x77, 0x89, 0x08, 0x64, 0x8E, 0x66,
-    0xB5, 0xDD, 0x68, 0xAF, 0x8D, 0x1A, 0xF8, 0xDE, 0x57, 0x02, 0x62, 0x51, 0x33, 0xEA, 0x56, 0x46,
-    0xC8, 0xFA, 0xDA, 0x51, 0x33, 0x20, 0x20, 0x3A, 0x5A, 0xD8, 0x5D, 0x52, 0xC5, 0x53, 0x4F, 0x14,
-    0x16, 0x78, 0x3B, 0x5E, 0xEF, 0x5E, 0x63, 0xF4, 0xF9, 0xD6, 0xC2, 0xE9, 0x8C, 0x4F, 0x7B, 0xC6,
-    0x18, 0x58, 0x9C, 0x36, 0x1D, 0x33, 0xD5, 0x2C, 0xA4, 0xF7, 0xC0, 0xDE, 0x1F, 0xF0, 0x22, 0xDF,
-    0x1D, 0x6F, 0x17, 0x6A, 0x94, 0x93, 0xC9, 0xCF, 0xCB, 0xFA, 0x7C, 0x06, 0x5D, 0x54, 0xEF, 0x74,
-    0x12, 0x56, 0x55, 0x64, 0x1A, 0x87, 0x88, 0xC1, 0x9C, 0xBE, 0x32, 0x28, 0x8E, 0x7E, 0x09, 0x91,
-    0x45, 0x75, 0x1E, 0x33, 0xE3, 0x37, 0x56, 0x44, 0x5E, 0xCB, 0x94, 0x27, 0xCF, 0x2B, 0x1D, 0x9B,
-    0x3B, 0xC8, 0x03, 0x4F, 0x91, 0xDF, 0xFF, 0x03, 0xD8, 0x5E, 0xC9, 0xF2, 0x66, 0x76, 0x70, 0x95,
-    0x81, 0x80, 0x54, 0xB6, 0x68, 0x33, 0xDB, 0x83, 0x63, 0xBE, 0x09, 0x86, 0x8A, 0x18, 0x68, 0xF8,
-    0x65, 0x50, 0xFA, 0x79, 0xE3, 0xC6, 0x3B, 0x80, 0x45, 0x16, 0x5A, 0x7E, 0x52, 0xF0, 0x86, 0xD1,
-    0xD9, 0x98, 0xB6, 0x7C, 0x39, 0x0B, 0xFD, 0x65, 0xF6, 0x5D, 0xB1, 0x0A, 0xCB, 0xD5, 0x36, 0x40,
-    0xD9, 0x92, 0x8B, 0x66, 0x48, 0xF0, 0x0C, 0x68, 0x0A, 0x3A, 0xD3, 0x7F, 0xA0, 0x0C, 0x9B, 0xA0,
-    0x1B, 0x36, 0x83, 0x76, 0xD8, 0xF0, 0xCF, 0xD5, 0x98, 0x47, 0xFF, 0x9B, 0xA1, 0xC4, 0x43, 0xEA,
-    0x7A, 0xE5, 0xE4, 0xA2, 0x8C, 0xF8, 0xD6, 0x12, 0xE2, 0x2F, 0x1C, 0xD5, 0x7F, 0xCB, 0x91, 0xBB,
-    0xEF, 0x58, 0x06, 0x49, 0x85, 0x28, 0x79, 0xD6, 0x92, 0x21, 0xEA, 0x38, 0xD8, 0x79, 0x36, 0xFD,
-    0xBC, 0xB1, 0xFC, 0xF2, 0x36, 0x12, 0x96, 0x3C, 0x3D, 0x2F, 0xEE, 0x8B, 0xC3, 0xE2, 0x3C, 0xBD,
-    0xA9, 0x45, 0x4B, 0x9D, 0x20, 0x19, 0x71, 0xC5, 0x5B, 0xDF, 0x4C, 0x61, 0xA6, 0x14, 0x3A, 0xB7,
-    0x6B, 0xFC, 0x89, 0x3E, 0xBB, 0x4D, 0x6A, 0xB5, 0x4B, 0x9D, 0x18, 0x9E, 0xD5, 0x25, 0xE7, 0x3A,
-    0x8B, 0x27, 0x9E, 0x8A, 0xFE, 0x13, 0xCD, 0xC5, 0x56, 0x2D, 0xE8, 0x28, 0x8D, 0x69, 0x68, 0xB9,
-    0x91, 0xD3, 0x9D, 0x17, 0x5A, 0x84, 0x95, 0x2B, 0xE1, 0xE3, 0x33, 0x57, 0x22, 0x58, 0xE6, 0xAE,
-    0x1C, 0xD7, 0x09, 0x70, 0xD4, 0x24, 0x29, 0x99, 0x31, 0xEB, 0x91, 0xDA, 0xFB, 0x6F, 0x38, 0x22,
-    0x19, 0xF1, 0x1B, 0x82, 0x60, 0x3E, 0xA9, 0xF1, 0x08, 0x89, 0x79, 0x4E, 0xAB, 0xCE, 0x2D, 0x36,
-    0xF5, 0xBF, 0x06, 0x9E, 0x73, 0xE9, 0x65, 0x46, 0x0D, 0x64, 0xA3, 0xE3, 0xD8, 0x27, 0x0B, 0x06,
-    0xFC, 0xEA, 0xF0, 0x5F, 0x6D, 0xF6, 0x6B, 0xD9, 0xD1, 0x7F, 0x7E, 0xFC, 0x88, 0x64, 0x10, 0xEC,
-    0xF3, 0xB0, 0x83, 0x79, 0x21, 0xFD, 0x57, 0x15, 0x0F, 0x35, 0xC3, 0xA1, 0xE6, 0x10, 0xE8, 0xBA,
-    0x7D, 0x28, 0x27, 0x3C, 0xD8, 0x47, 0x56, 0x14, 0x7D, 0xB9, 0xFF, 0x37, 0x58, 0xFC, 0xC3, 0xFD,
-    0x5D, 0x58, 0xE6, 0xC3, 0xFD, 0x82, 0x69, 0xB2, 0xC7, 0xDD, 0x19, 0x13, 0x67, 0x63, 0x6C, 0xC3,
-    0x49, 0x71, 0xA2, 0xA6, 0x9E, 0xE1, 0x06, 0xE6, 0x49, 0x81, 0x1E, 0x4F, 0x3F, 0xE3, 0xCD, 0x58,
-    0x9E, 0xB4, 0xC4, 0xE0, 0xE1, 0x4C, 0x82, 0x5D, 0x5F, 0xC8, 0x52, 0x0C, 0x9E, 0x24, 0x25, 0x94,
-    0x3C, 0xC9, 0x59, 0x16, 0x7F, 0x59, 0x9E, 0xEC, 0xE1, 0xB3, 0xC3, 0x02, 0x2C, 0x0B, 0xFB, 0xB2,
-    0x59, 0x92, 0x47, 0xC5, 0xB2, 0x24, 0x05, 0xC6, 0xCC, 0xD0, 0xD7, 0x8F, 0xAB, 0x4E, 0x64, 0x73,
-    0x1D, 0x1F, 0x52, 0x69, 0x76, 0xBC, 0x32, 0xEC, 0xBB, 0xBD, 0xC1, 0xD0, 0x66, 0x5F, 0x87, 0xF6,
-    0x85, 0x98, 0xFA, 0xB2, 0x78, 0xA7, 0xE5, 0x47, 0x47, 0x37, 0x52, 0x7C, 0x07, 0xA7, 0x23, 0xBA,
-    0x33, 0xED, 0x3A, 0xF0, 0xDF, 0x31, 0x9B, 0xD3, 0x29, 0x6F, 0x20, 0x67, 0xE1, 0xFB, 0xBF, 0x01,
-    0xDB, 0xFF, 0xFF, 0xFF, 0x97, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0xD1, 0xD0, 0xD0, 0x00, 0x00,
-    0xB5, 0x92, 0x31, 0x4E, 0xC3, 0x30, 0x18, 0x85, 0xFF, 0x24, 0x54, 0x1D, 0x32, 0x64, 0xEC, 0xC0,
-    0xD0, 0x23, 0xE4, 0x08, 0xC9, 0xC2, 0x9E, 0x21, 0x7B, 0x2F, 0x80, 0xC4, 0x11, 0xEC, 0x4B, 0x70,
-    0x13, 0x76, 0xFB, 0x08, 0x70, 0x83, 0x0E, 0x1C, 0x20, 0x43, 0x86, 0x20, 0xC5, 0x7E, 0x3C, 0xDB,
-    0x49, 0x69, 0x41, 0x02, 0x09, 0x68, 0x86, 0xF7, 0x29, 0xF2, 0xB3, 0xFF, 0x97, 0xE7, 0x88, 0x74,
-    0x92, 0xB5, 0xD2, 0xA0, 0x35, 0x5E, 0x80, 0x02, 0x2E, 0x07, 0xB6, 0x98, 0x0B, 0x6C, 0x4A, 0x77,
-    0x53, 0x38, 0xA9, 0x26, 0x49, 0x5A, 0x62, 0xAE, 0x31, 0x2A, 0xCC, 0x58, 0x75, 0xE7, 0xFB, 0xC3,
-    0x5B, 0x77, 0xEE, 0xF9, 0x8B, 0x0A, 0x93, 0x08, 0x83, 0x1C, 0x8E, 0xCC, 0x51, 0x0F, 0x79, 0x10,
-    0xA6, 0xA8, 0x9E, 0xB9, 0x2C, 0x12, 0x25, 0x44, 0x18, 0xD4, 0x49, 0x38, 0x9F, 0x16, 0x27, 0xBF,
-    0x96, 0x75, 0xE4, 0xC3, 0x70, 0x31, 0xF2, 0xDC, 0x72, 0x8D, 0x91, 0xEC, 0x5B, 0x52, 0xE3, 0x8D,
-    0x4E, 0x9D, 0x2B, 0x9B, 0x5A, 0x57, 0x36, 0xF5, 0xDE, 0xE8, 0xB5, 0x93, 0x95, 0x4B, 0xFB, 0x76,
-    0xE9, 0xFF, 0xC4, 0x74, 0x07, 0xDC, 0x17, 0x7D, 0xD7, 0xE3, 0x65, 0x6E, 0xBE, 0x87, 0xDC, 0xFE,
-    0x73, 0xEE, 0xE8, 0x2F, 0x97, 0x7D, 0x91, 0xDF, 0xE5, 0x76, 0xDD, 0x57, 0xFF, 0x7F, 0x33, 0x86,
-    0xCE, 0x00, 0x2D, 0x15, 0x30, 0x31, 0x3D, 0x66, 0x51, 0xE3, 0xED, 0x2C, 0xC6, 0x16, 0x14, 0x1D,
-    0xA5, 0x84, 0x37, 0xBA, 0x39, 0xC9, 0xCE, 0xF5, 0xCB, 0xC2, 0x0F, 0xE2, 0x82, 0xE0, 0xCE, 0x68,
-    0xB6, 0x60, 0x74, 0x16, 0x44, 0x94, 0x67, 0x49, 0xB1, 0xA9, 0x5E, 0xC2, 0xB3, 0xC7, 0x6B, 0x00,
-    0x00, 0x2A, 0x7D, 0x4C, 0x22, 0x85, 0xCF, 0x22, 0x26, 0xF9, 0xC0, 0x16, 0x8E, 0x07, 0xD8, 0x1A,
-    0x28, 0x09, 0x05, 0xCF, 0xBC, 0xD6, 0xD8, 0xFB, 0x0D, 0x1E, 0x5B, 0xC3, 0xFA, 0x69, 0x31, 0x63,
-    0x04, 0x6F, 0x20, 0x60, 0x8F, 0x31, 0x20, 0x87, 0x8F, 0xA7, 0xD4, 0x88, 0xC8, 0xD1, 0x06, 0x08,
-    0x6F, 0x49, 0xCB, 0x53, 0x46, 0xBC, 0xB4, 0x86, 0xB3, 0x15, 0x0F, 0xE3, 0xA7, 0x37, 0xE1, 0xE8,
-    0x23, 0xFF, 0x26, 0x1B, 0xE3, 0x75, 0xF2, 0x0E, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21, 0x10, 0x85,
-    0xE1, 0x77, 0x43, 0x40, 0x70, 0x01, 0x76, 0x70, 0x25, 0x98, 0x98, 0x43, 0x27, 0xB6, 0x61, 0xE2,
-    0x78, 0x55, 0x58, 0x8B, 0x99, 0x96, 0x40, 0x09, 0xD8, 0x03, 0x01, 0x01, 0xEC, 0x73, 0xF7, 0x18,
-    0x99, 0x81, 0x3F, 0xF8, 0x66, 0x87, 0x05, 0xFE, 0xE7, 0x32, 0x33, 0x8E, 0xD7, 0x31, 0x59, 0x02,
-    0xB3, 0x25, 0xB2, 0x5A, 0xE4, 0x69, 0xE8, 0x32, 0xA2, 0x62, 0xF8, 0x20, 0x28, 0xC6, 0xEF, 0x6B,
-    0x55, 0x24, 0xBB, 0x1F, 0x3A, 0xC5, 0xBE, 0x32, 0x05, 0xB2, 0xEA, 0x64, 0x24, 0xF3, 0x99, 0xF5,
-    0x41, 0xA6, 0x37, 0xDB, 0x46, 0x51, 0x2E, 0x9E, 0xE2, 0xC9, 0x7D, 0xA1, 0xAC, 0x14, 0x40, 0x91,
-    0x0D, 0xD8, 0x34, 0x05, 0xF0, 0xC3, 0x73, 0x07, 0x96, 0xEE, 0xC4, 0xFE, 0xBB, 0xBB, 0x66, 0xD9,
-    0xAE, 0xC5, 0x72, 0x90, 0xA2, 0xCC, 0x3D, 0x6F, 0x33, 0x27, 0xBD, 0x3F,
+static const uint8_t notosans_14_boldBitmaps[32518] = {
+    0xC5, 0x59, 0xBF, 0x8F, 0xDD, 0xC6, 0x11, 0x5E, 0x3E, 0xFA, 0xC4, 0x24, 0x44, 0x40, 0x17, 0x12,
+    0x0C, 0x44, 0x01, 0xD8, 0xAB, 0xE1, 0x9F, 0xB0, 0x54, 0x8C, 0xC0, 0x85, 0x0B, 0x5F, 0xA1, 0x73,
+    0x0A, 0x17, 0x6A, 0xD2, 0x24, 0x29, 0xEE, 0x3F, 0xC8, 0x52, 0xBE, 0xC2, 0x85, 0x0A, 0xA9, 0x49,
+    0xEF, 0x22, 0x0E, 0x90, 0x2B, 0x92, 0x14, 0xA9, 0xBD, 0xB4, 0x54, 0xA4, 0x70, 0x21, 0x0A, 0x87,
+    0xC0, 0xA5, 0x08, 0xC4, 0x76, 0x90, 0x73, 0x21, 0x02, 0x66, 0x2C, 0x9E, 0x6E, 0xC9, 0xCD, 0xF7,
+    0xCD, 0x92, 0xEF, 0xEE, 0x49, 0xBE, 0xF3, 0xC5, 0x67, 0xC3, 0xEF, 0x71, 0x86, 0xEF, 0xC8, 0xD9,
+    0xD9, 0xD9, 0xF9, 0xBD, 0x7B, 0xA6, 0x31, 0xAD, 0x6E, 0xD6, 0xDF, 0x7A, 0xF9, 0x16, 0xF8, 0x2A,
+    0x7C, 0xB6, 0x94, 0x06, 0x05, 0x68, 0xEA, 0x2D, 0xA5, 0x3E, 0x54, 0x2B, 0xA7, 0xE2, 0x41, 0xA5,
+    0x9D, 0xCA, 0x5A, 0x05, 0x02, 0x8D, 0xAB, 0x52, 0xA6, 0x54, 0x56, 0xF1, 0xF2, 0xA7, 0xAE, 0xF0,
+    0x04, 0xAF, 0x40, 0x00, 0xB2, 0xA2, 0xE1, 0x10, 0x0C, 0xC4, 0xF0, 0x68, 0x54, 0xEA, 0x37, 0xAA,
+    0xA8, 0x54, 0xD6, 0xCC, 0x4F, 0xC0, 0x96, 0x0F, 0xE7, 0x91, 0xE5, 0x32, 0x6C, 0xF3, 0xE2, 0x34,
+    0x65, 0xA0, 0x01, 0x71, 0x2C, 0x92, 0x64, 0x9D, 0xCA, 0x1B, 0x75, 0xA3, 0x54, 0x5B, 0xDB, 0x59,
+    0x9F, 0x75, 0x59, 0x9B, 0x37, 0x45, 0xAD, 0x2B, 0xAD, 0x6E, 0xEC, 0x97, 0xDA, 0xCF, 0xD7, 0xC6,
+    0x1A, 0xF8, 0x31, 0x83, 0x8A, 0xBD, 0x2F, 0x53, 0xEF, 0xEB, 0x7C, 0xB2, 0x5D, 0xD1, 0xE5, 0x9D,
+    0x6E, 0xB2, 0x41, 0xD7, 0xE9, 0x60, 0xEA, 0xC4, 0x9D, 0x05, 0x78, 0xEF, 0x48, 0x57, 0x74, 0x98,
+    0xEB, 0xC8, 0x74, 0x18, 0xDF, 0x80, 0x4F, 0xA5, 0x2C, 0x64, 0x8F, 0x4A, 0xA5, 0x92, 0x41, 0x15,
+    0x83, 0xF2, 0x43, 0xEC, 0x87, 0xDC, 0x0F, 0xE6, 0x8B, 0x41, 0xDF, 0x1D, 0x7E, 0x9A, 0x42, 0x5F,
+    0x17, 0xBB, 0x44, 0xB4, 0x49, 0x25, 0x60, 0x5B, 0x78, 0xDF, 0x41, 0xB4, 0x21, 0xAD, 0x33, 0x17,
+    0xA9, 0xC4, 0x29, 0x01, 0xD2, 0x64, 0xBD, 0x52, 0xBA, 0x83, 0x96, 0x6A, 0xB5, 0xF2, 0xA5, 0x4A,
+    0x31, 0x75, 0x81, 0x47, 0xB6, 0x09, 0x7F, 0x82, 0xAA, 0x98, 0xF6, 0xFF, 0xAC, 0xBD, 0x9F, 0x16,
+    0x20, 0xDB, 0x2B, 0x7E, 0x50, 0x06, 0x4B, 0x06, 0x34, 0xFA, 0x73, 0xDF, 0xFE, 0x48, 0x78, 0xE4,
+    0x80, 0xA2, 0x05, 0xBF, 0x3A, 0x7A, 0xDB, 0x97, 0x2B, 0xD0, 0xAC, 0xFC, 0x11, 0xC0, 0xC3, 0xF4,
+    0x96, 0xEF, 0xFB, 0x30, 0x5F, 0xD6, 0x97, 0x98, 0xE4, 0xE8, 0xA6, 0xED, 0x3C, 0xC6, 0x03, 0xCA,
+    0x5D, 0xD0, 0xAA, 0xAB, 0xE4, 0xCC, 0xF1, 0xCA, 0x10, 0x79, 0xA0, 0x15, 0x51, 0x42, 0x94, 0x11,
+    0x15, 0x4F, 0x81, 0x0C, 0x49, 0x46, 0xA0, 0x95, 0x03, 0x4A, 0x3A, 0xA0, 0xAC, 0x2D, 0xE8, 0x3F,
+    0x40, 0xE6, 0xD0, 0x3E, 0x57, 0x16, 0x2C, 0x03, 0xFA, 0xED, 0x3E, 0xFE, 0x9C, 0x99, 0x6E, 0xA0,
+    0x8C, 0xB6, 0x9A, 0xA1, 0x20, 0x34, 0x4A, 0x2D, 0xA0, 0x1F, 0xC3, 0x5D, 0xFC, 0x08, 0xF0, 0x15,
+    0xA0, 0xF9, 0xF1, 0x4D, 0x0A, 0x5F, 0xAC, 0x85, 0x0F, 0x50, 0x74, 0xBF, 0xDF, 0xF1, 0x1D, 0x14,
+    0x50, 0x53, 0x11, 0xC5, 0x7A, 0x01, 0xA2, 0x1D, 0x08, 0xE2, 0xBB, 0x08, 0x4A, 0x4F, 0xFC, 0x07,
+    0xDB, 0xD9, 0x30, 0xAB, 0x86, 0xBC, 0x3F, 0xFA, 0xB5, 0xD2, 0xF7, 0x7C, 0x65, 0xAC, 0x8C, 0x1D,
+    0x4C, 0x9F, 0x39, 0xD3, 0xD0, 0x1F, 0x62, 0x01, 0xDD, 0x00, 0xBA, 0xD4, 0xE5, 0x47, 0xBB, 0x03,
+    0xFC, 0xA1, 0x13, 0xE5, 0xC1, 0x88, 0xF4, 0x07, 0xAC, 0xC8, 0x01, 0xC6, 0x19, 0x16, 0x03, 0x2E,
+    0x4A, 0x6F, 0xC4, 0x88, 0x0A, 0x56, 0x8B, 0xE0, 0xD4, 0xF1, 0x14, 0x6C, 0xBC, 0x9E, 0xBC, 0xDB,
+    0x20, 0x59, 0xCD, 0x24, 0xF2, 0x81, 0xBF, 0xA5, 0x41, 0x17, 0x9D, 0xEE, 0x77, 0xE9, 0xBB, 0xBD,
+    0xAE, 0x01, 0x6D, 0xD6, 0xE5, 0x83, 0x69, 0xF9, 0x6E, 0x05, 0xBB, 0x47, 0x00, 0xFE, 0x2E, 0x06,
+    0xDB, 0x19, 0xF8, 0xAD, 0xAD, 0x12, 0x67, 0xAB, 0xD8, 0xF1, 0x6E, 0xDA, 0x7C, 0x80, 0xAE, 0x3A,
+    0xE8, 0xB5, 0x21, 0xAD, 0xF8, 0xAF, 0xF0, 0xEE, 0xE9, 0x80, 0x8A, 0x7A, 0xD6, 0x47, 0xB6, 0x35,
+    0x4D, 0xDE, 0xD9, 0x7A, 0x19, 0x0B, 0x40, 0x0C, 0xE0, 0x99, 0xD3, 0x93, 0x77, 0xB9, 0x3F, 0x76,
+    0xA9, 0xFF, 0xD2, 0xA9, 0xBF, 0xBC, 0x01, 0xA1, 0xD3, 0x3E, 0xAC, 0x4D, 0xB7, 0xAF, 0x5C, 0xF1,
+    0x35, 0xF8, 0xC2, 0x66, 0x0E, 0xD0, 0xA8, 0x68, 0x9B, 0x8C, 0x75, 0x2D, 0x31, 0xD8, 0xFC, 0x64,
+    0x9E, 0x28, 0x7C, 0x36, 0x63, 0x33, 0x85, 0xFC, 0xF9, 0x90, 0xF5, 0xAB, 0xFB, 0x6A, 0xE3, 0xF3,
+    0x62, 0x74, 0x07, 0xA3, 0xF5, 0x74, 0x69, 0x42, 0xA5, 0xFF, 0xE4, 0xEB, 0xAB, 0xA2, 0x2E, 0x01,
+    0xAA, 0xAC, 0x46, 0x88, 0x43, 0x93, 0x6E, 0x8E, 0x96, 0x4A, 0x52, 0x8B, 0x9A, 0x4E, 0x31, 0xA5,
+    0xF5, 0xF1, 0x2C, 0x42, 0x00, 0x47, 0xD0, 0xB0, 0xBC, 0xE7, 0xB3, 0x98, 0xEE, 0x0F, 0xDC, 0x50,
+    0x20, 0x7A, 0x31, 0x16, 0xD1, 0x11, 0x1F, 0xF7, 0xF4, 0xC5, 0x7F, 0x33, 0x50, 0xF5, 0x81, 0xA3,
+    0xDB, 0x3F, 0x1C, 0xA9, 0xB1, 0x3B, 0x1C, 0xE9, 0x4B, 0xE1, 0x35, 0xDB, 0xCA, 0x72, 0xFA, 0x7D,
+    0x30, 0x82, 0x2E, 0xC1, 0x02, 0x56, 0x00, 0x8B, 0x4C, 0x30, 0x82, 0x0A, 0x36, 0x86, 0x50, 0x99,
+    0x83, 0xAE, 0x54, 0x32, 0x2A, 0xD3, 0xD0, 0xB4, 0x41, 0x62, 0xE3, 0xFF, 0x43, 0xBF, 0x69, 0x01,
+    0x83, 0x3D, 0xB4, 0xD4, 0xF7, 0x68, 0xEB, 0x78, 0x86, 0xD4, 0xD9, 0x7F, 0xDA, 0x1E, 0xEF, 0x2A,
+    0xC0, 0x7D, 0xA1, 0x09, 0xEF, 0xBD, 0x85, 0xC5, 0xC3, 0x3D, 0x99, 0x30, 0x6E, 0x9C, 0x7D, 0x0F,
+    0x7C, 0xA6, 0xB5, 0x93, 0x1F, 0x29, 0x51, 0x56, 0xC4, 0x00, 0x4E, 0xFC, 0x21, 0x0C, 0x34, 0x41,
+    0xFF, 0xB9, 0xAC, 0x87, 0x0B, 0xD4, 0x5C, 0x2B, 0x15, 0x48, 0x89, 0x80, 0xEA, 0xF5, 0xAF, 0x66,
+    0xFD, 0x96, 0x74, 0x8C, 0x2C, 0x95, 0x8D, 0x2A, 0xC2, 0xBA, 0x3E, 0xB3, 0x4C, 0xA5, 0xCC, 0xDA,
+    0x44, 0xD7, 0x3D, 0x15, 0x72, 0x4D, 0xC9, 0x32, 0xF8, 0xA8, 0x21, 0x1A, 0x88, 0x26, 0xE8, 0x24,
+    0xF5, 0xA5, 0xAD, 0x23, 0x5F, 0x43, 0x3B, 0xB6, 0x01, 0x32, 0x2D, 0x90, 0x16, 0xD4, 0xAD, 0xD1,
+    0xFA, 0x99, 0x21, 0x89, 0xAD, 0xE7, 0x11, 0x1C, 0x7B, 0x48, 0x2E, 0x33, 0x3F, 0x72, 0x9E, 0x17,
+    0x74, 0x0A, 0x4A, 0x0A, 0xBD, 0x01, 0x87, 0xFB, 0x8B, 0x97, 0x04, 0x78, 0xF1, 0x7D, 0xA0, 0x29,
+    0x5F, 0xE2, 0x73, 0x1E, 0xCF, 0x5A, 0x6D, 0xF2, 0x3C, 0x8B, 0xEF, 0x29, 0x08, 0x1F, 0x44, 0x1A,
+    0x32, 0x29, 0x3D, 0x02, 0x3A, 0x83, 0xB5, 0x9E, 0x23, 0xB4, 0x7C, 0x19, 0x95, 0x74, 0x53, 0x89,
+    0xF8, 0xD9, 0x10, 0x41, 0xE9, 0x3F, 0xDB, 0x7F, 0x1F, 0xA1, 0x86, 0xBC, 0x43, 0xA4, 0x05, 0x21,
+    0x6B, 0x76, 0x20, 0x29, 0x3A, 0xD8, 0x00, 0x65, 0x68, 0x04, 0xA2, 0x0D, 0xBA, 0x58, 0x5C, 0xCB,
+    0x12, 0x5D, 0xE7, 0x1C, 0x62, 0x03, 0x54, 0xDD, 0xF6, 0x22, 0xE8, 0x70, 0x1F, 0x71, 0x4E, 0x3F,
+    0x3D, 0x85, 0x2E, 0x3A, 0x96, 0x48, 0xFB, 0x3E, 0x5C, 0x89, 0xAF, 0xE0, 0xFB, 0x17, 0xB9, 0x62,
+    0x16, 0xE6, 0x79, 0x14, 0xD3, 0xDD, 0x65, 0x2E, 0xE8, 0x4D, 0xB7, 0x37, 0x50, 0xD7, 0x90, 0xB1,
+    0xBC, 0xD2, 0x52, 0x47, 0x0D, 0x3D, 0xC7, 0x20, 0x26, 0x60, 0x3C, 0x46, 0x58, 0x0D, 0x2F, 0x37,
+    0x35, 0x34, 0x67, 0x6A, 0xE6, 0xE7, 0x07, 0x88, 0x52, 0xF3, 0x0F, 0x44, 0x86, 0x79, 0x34, 0xD0,
+    0x96, 0x1D, 0x91, 0xFC, 0x82, 0xFF, 0x9A, 0x63, 0x78, 0xB2, 0x79, 0x8C, 0xB4, 0x60, 0x6A, 0x94,
+    0xD5, 0x79, 0x98, 0x30, 0x40, 0xC8, 0x22, 0xE9, 0xD3, 0xDA, 0xC2, 0x19, 0x31, 0x4B, 0xDB, 0xDA,
+    0xCB, 0xC2, 0xE1, 0x3E, 0x63, 0xB9, 0x59, 0x00, 0xED, 0x09, 0x96, 0x61, 0xE0, 0x13, 0xD6, 0x19,
+    0xB6, 0x45, 0x8E, 0x05, 0x05, 0x98, 0xAA, 0x73, 0xC6, 0x96, 0xF1, 0xB1, 0x33, 0xA6, 0x8A, 0x9F,
+    0x39, 0xB3, 0x5B, 0xA7, 0x5F, 0x3A, 0x73, 0xBB, 0xCE, 0xFE, 0xE5, 0xCC, 0xBD, 0x36, 0x3B, 0x00,
+    0xEE, 0x8A, 0x87, 0xCE, 0xBC, 0xD7, 0xE9, 0x3D, 0x67, 0xF6, 0x7A, 0xFD, 0x3A, 0xB0, 0x33, 0xA8,
+    0x55, 0xEF, 0xBA, 0x09, 0xF8, 0xCE, 0x34, 0x02, 0x57, 0xDE, 0x11, 0xDB, 0x81, 0xD8, 0xF4, 0xC4,
+    0xBA, 0x23, 0x2E, 0x5A, 0xE0, 0x1E, 0x85, 0x1A, 0x93, 0xC7, 0x9C, 0x35, 0xE6, 0xA4, 0x44, 0x15,
+    0x11, 0x6A, 0x9D, 0x31, 0x24, 0xBC, 0xCD, 0x31, 0x6F, 0x92, 0xC9, 0x1E, 0xB9, 0xBE, 0xEB, 0x85,
+    0xE9, 0x43, 0x72, 0x3B, 0x20, 0x33, 0xC8, 0x54, 0xE5, 0x5F, 0x01, 0xA5, 0x90, 0xB7, 0x8A, 0x89,
+    0x28, 0x79, 0xA5, 0x04, 0x19, 0x22, 0xED, 0xE6, 0x98, 0x48, 0xA9, 0x78, 0xBA, 0x6E, 0xC5, 0xCE,
+    0x03, 0xA6, 0x48, 0x91, 0x9A, 0x06, 0xE6, 0x17, 0x44, 0x05, 0xDA, 0xA9, 0x64, 0x62, 0x50, 0x40,
+    0xE9, 0x70, 0x7E, 0x78, 0x0E, 0x72, 0x11, 0xB2, 0xF5, 0x59, 0x38, 0xD0, 0x04, 0x7A, 0x84, 0x08,
+    0xC6, 0x06, 0x3E, 0xA9, 0xFF, 0xDC, 0x4B, 0xD3, 0x47, 0x53, 0xCB, 0x5C, 0x88, 0x93, 0x23, 0x15,
+    0x92, 0x15, 0xCC, 0xFE, 0x29, 0x1F, 0x96, 0x73, 0xE2, 0x45, 0x1A, 0x42, 0xC9, 0x84, 0xB1, 0x25,
+    0xE1, 0x0A, 0xA0, 0x00, 0xD6, 0xA6, 0x97, 0x77, 0x08, 0x5C, 0x26, 0x55, 0x7B, 0x78, 0xFF, 0x5C,
+    0xA3, 0xFE, 0xE0, 0xAB, 0x93, 0xBC, 0xFF, 0x9A, 0x97, 0x6A, 0x2B, 0xB5, 0x4C, 0x99, 0x4E, 0x1A,
+    0x36, 0x17, 0xE4, 0xC2, 0xAA, 0xFF, 0x38, 0x53, 0x4B, 0xDE, 0x40, 0x76, 0xED, 0x21, 0x39, 0xD8,
+    0x71, 0xC9, 0x1B, 0x08, 0xF5, 0x0A, 0x75, 0xA7, 0x5B, 0xD2, 0xEE, 0xA4, 0x66, 0xF4, 0x11, 0xB8,
+    0x5B, 0xC9, 0xE6, 0x35, 0x44, 0x83, 0xD6, 0xC8, 0x20, 0xE3, 0x88, 0x84, 0xE9, 0x3E, 0x96, 0x3A,
+    0xE8, 0x83, 0x32, 0xAC, 0xF4, 0x22, 0x6D, 0xCE, 0x06, 0x14, 0x69, 0xCF, 0x34, 0xD1, 0x3A, 0xAF,
+    0x32, 0xE7, 0xE9, 0x29, 0xB4, 0x8C, 0xB1, 0x44, 0x20, 0x64, 0x4A, 0x28, 0xB3, 0x6D, 0x43, 0x5A,
+    0xCC, 0xBB, 0xF7, 0x71, 0xB7, 0x7F, 0x90, 0xF8, 0xA8, 0x59, 0x6A, 0x0A, 0x08, 0xCB, 0x6A, 0xCD,
+    0x6C, 0x25, 0xA8, 0x5C, 0xA3, 0xD0, 0x43, 0x7D, 0xD7, 0x08, 0x5B, 0x8F, 0x14, 0x4E, 0xA0, 0xB8,
+    0x4D, 0x40, 0x9F, 0x23, 0x99, 0x98, 0x99, 0xA7, 0x41, 0xCF, 0xC3, 0xE6, 0x2B, 0xE8, 0xCA, 0x97,
+    0xD8, 0x97, 0x20, 0x62, 0x46, 0x74, 0x02, 0xAB, 0x29, 0x66, 0xF0, 0xE2, 0x81, 0xF2, 0x6F, 0x00,
+    0x99, 0xBB, 0x6C, 0xDD, 0x1F, 0x71, 0xB1, 0x4F, 0xB8, 0x26, 0x2E, 0x30, 0xA3, 0x76, 0x32, 0x1A,
+    0x2C, 0xA1, 0xA5, 0xE2, 0xB0, 0xFD, 0x91, 0x3D, 0x8E, 0x45, 0xA1, 0xC6, 0x25, 0xB9, 0xA6, 0x5E,
+    0xC1, 0x4D, 0xA0, 0x4F, 0x34, 0x01, 0x98, 0x31, 0x66, 0x20, 0x22, 0xEF, 0xA2, 0xCF, 0x46, 0xC7,
+    0x98, 0x77, 0xE9, 0x71, 0x97, 0x72, 0x2B, 0x94, 0x7D, 0x81, 0x8D, 0x09, 0x7A, 0xDD, 0xEC, 0x13,
+    0x34, 0x4B, 0x90, 0x36, 0x3F, 0x18, 0x90, 0x1E, 0x13, 0x87, 0x84, 0x80, 0x86, 0x13, 0x7D, 0xEA,
+    0x03, 0xB4, 0xAB, 0xBC, 0xDF, 0x19, 0xB1, 0x86, 0xD5, 0x68, 0xCA, 0x09, 0xF7, 0x68, 0xB2, 0xCA,
+    0x1B, 0xF6, 0x47, 0xB0, 0x99, 0x65, 0x1F, 0x84, 0x7C, 0xC9, 0x8E, 0xC6, 0xA2, 0x3F, 0xE1, 0x1D,
+    0xB9, 0x80, 0xD6, 0x61, 0x66, 0x2D, 0x58, 0xDE, 0x75, 0x1F, 0xDA, 0xAA, 0x16, 0xAD, 0x03, 0x2C,
+    0xAE, 0x3B, 0x66, 0xC5, 0x06, 0x59, 0x96, 0x5D, 0x27, 0xFB, 0x54, 0xBF, 0xC7, 0xCC, 0xFA, 0x84,
+    0x34, 0xB4, 0x52, 0x16, 0xF6, 0x04, 0x35, 0x97, 0x57, 0xCD, 0x4B, 0xCE, 0xF9, 0x4C, 0xDE, 0xDA,
+    0x8F, 0xB1, 0xF7, 0xF3, 0xAF, 0x23, 0xD5, 0x78, 0x78, 0x38, 0x55, 0xC8, 0x54, 0xAB, 0x5B, 0x56,
+    0xB9, 0x1E, 0xE9, 0x97, 0x51, 0x08, 0x55, 0x63, 0x87, 0x21, 0xCF, 0x2C, 0x55, 0x4D, 0x3A, 0x16,
+    0x91, 0x11, 0xEA, 0x58, 0x79, 0xEE, 0x79, 0xFC, 0x5B, 0x64, 0xF5, 0x94, 0xBA, 0x0D, 0xEC, 0x65,
+    0x22, 0x08, 0x9B, 0x50, 0x72, 0xDA, 0xE1, 0x02, 0x48, 0xD3, 0x79, 0x36, 0x10, 0x07, 0x67, 0x27,
+    0xB5, 0x59, 0x76, 0x39, 0xB5, 0x92, 0x66, 0x9C, 0x8D, 0xDB, 0xEC, 0x1E, 0xF2, 0x52, 0x7A, 0x24,
+    0x4E, 0x1B, 0x6F, 0xBE, 0xD4, 0xCF, 0xF7, 0xF7, 0x4F, 0xBC, 0x34, 0xA0, 0xB9, 0x15, 0x90, 0x4D,
+    0x0D, 0x37, 0x0D, 0xF1, 0x7D, 0xB2, 0x98, 0x37, 0x2A, 0xBB, 0xBE, 0xC7, 0x73, 0x14, 0xC6, 0xBF,
+    0x62, 0xF9, 0x59, 0x8F, 0x56, 0xBA, 0xF7, 0x55, 0x8E, 0xDF, 0xA6, 0x37, 0xF2, 0xFC, 0x59, 0x9F,
+    0xFA, 0xBD, 0x5E, 0x6D, 0x87, 0x04, 0xC3, 0x29, 0xBF, 0x16, 0xEE, 0xA2, 0xA5, 0xB4, 0xBE, 0x66,
+    0x52, 0xF0, 0xFF, 0x35, 0xE4, 0x33, 0x60, 0x36, 0xE7, 0x2B, 0x42, 0x32, 0x03, 0x7E, 0xF3, 0x19,
+    0xDF, 0x91, 0x86, 0xB4, 0xC6, 0xD7, 0x53, 0xC6, 0x85, 0xCF, 0x13, 0x18, 0xF8, 0xB4, 0x97, 0x86,
+    0xBE, 0x2A, 0xC6, 0x77, 0x24, 0x58, 0x4D, 0xF3, 0x72, 0xBE, 0x93, 0x40, 0xA6, 0x51, 0xC7, 0x77,
+    0x48, 0x5B, 0x27, 0xDC, 0x08, 0xD9, 0x53, 0x1B, 0x0B, 0x51, 0xF1, 0xCB, 0x10, 0xF9, 0x83, 0x31,
+    0xF5, 0xCF, 0x46, 0x24, 0x86, 0x51, 0x1F, 0xED, 0x8E, 0xBA, 0x4D, 0x47, 0xB3, 0x6E, 0x78, 0x4F,
+    0x80, 0xCF, 0x74, 0x9B, 0x08, 0x0D, 0x69, 0x53, 0xFF, 0xD5, 0xB8, 0xF2, 0x8F, 0x47, 0xF5, 0xCA,
+    0xC9, 0xA6, 0x68, 0x96, 0x13, 0xCD, 0x51, 0xDE, 0xEB, 0x79, 0x93, 0x36, 0x37, 0xC2, 0x01, 0x4E,
+    0xC9, 0x89, 0xDC, 0xFB, 0x37, 0xD2, 0xC6, 0xA1, 0x71, 0x6A, 0xC2, 0x7A, 0xB7, 0xE9, 0x05, 0x08,
+    0x40, 0x56, 0x5A, 0x76, 0x29, 0x5B, 0x6B, 0x49, 0x51, 0xC9, 0xA0, 0x8A, 0x00, 0xAF, 0x4D, 0xB7,
+    0xCE, 0x58, 0xCD, 0xD9, 0xC0, 0x4F, 0x04, 0x79, 0x53, 0xFF, 0xFC, 0xE2, 0x6B, 0x1D, 0xF2, 0x79,
+    0xAD, 0xC7, 0x58, 0xEB, 0x01, 0xD6, 0x4A, 0x4E, 0x89, 0x7B, 0x15, 0x4E, 0x59, 0x7C, 0x60, 0x07,
+    0x9E, 0x12, 0x70, 0x33, 0x7C, 0x25, 0x94, 0xB2, 0xB3, 0x7D, 0xE1, 0x4D, 0xEC, 0x4E, 0x8C, 0x6F,
+    0x61, 0xDF, 0xDE, 0x1F, 0x99, 0xC1, 0x37, 0x99, 0x3B, 0xF1, 0x85, 0x6F, 0x06, 0x6E, 0x85, 0x11,
+    0x7D, 0x6D, 0x2E, 0xA9, 0x9C, 0xBF, 0xCE, 0xFB, 0x8A, 0x31, 0x4A, 0x4E, 0xCC, 0x16, 0x6A, 0x29,
+    0x84, 0x7E, 0x79, 0xF2, 0xFF, 0x5D, 0xE5, 0xEF, 0x58, 0x96, 0x69, 0x5C, 0x39, 0x63, 0x50, 0x61,
+    0x2B, 0x77, 0x1E, 0x4A, 0x47, 0x20, 0x56, 0xA2, 0x0A, 0x6E, 0x8A, 0xBD, 0x19, 0xCA, 0xDB, 0x7B,
+    0x2C, 0x56, 0xF7, 0x98, 0xC4, 0xAD, 0x14, 0x48, 0x41, 0xFC, 0x93, 0xC5, 0xC6, 0x1E, 0x30, 0xE9,
+    0x56, 0xA4, 0x93, 0x11, 0x15, 0x62, 0xD1, 0x56, 0xAC, 0x62, 0x95, 0x24, 0x0F, 0x5F, 0x5D, 0xFC,
+    0x3B, 0xAF, 0x75, 0x4A, 0xFD, 0x4D, 0x4C, 0x02, 0x95, 0x7F, 0x82, 0x19, 0xBC, 0x7C, 0x14, 0x02,
+    0xCC, 0xFF, 0x0A, 0x37, 0x6C, 0x9E, 0x91, 0xE8, 0x3C, 0xEB, 0x24, 0x6E, 0x15, 0x92, 0x84, 0xDC,
+    0xFA, 0x4B, 0xDC, 0xE6, 0x39, 0x4B, 0xAF, 0xBF, 0xCE, 0xC6, 0xC9, 0x85, 0x60, 0x29, 0xD2, 0x88,
+    0x87, 0x46, 0x62, 0x68, 0xC0, 0x26, 0x1F, 0x3E, 0x08, 0x5F, 0x9C, 0xAC, 0xC0, 0x6A, 0xD9, 0x64,
+    0x4E, 0x7C, 0xC6, 0x77, 0xA4, 0x61, 0xAE, 0x8A, 0xA5, 0x2F, 0x38, 0x89, 0x75, 0x9F, 0x22, 0xF7,
+    0xE8, 0x6F, 0x91, 0x7B, 0x98, 0xAF, 0xDE, 0xC2, 0xD8, 0x6A, 0xFB, 0x4C, 0x5F, 0xBE, 0x5C, 0x1C,
+    0x3D, 0x3B, 0x15, 0x47, 0x67, 0x46, 0xEA, 0x94, 0x0E, 0xBE, 0x18, 0xBC, 0xED, 0xA9, 0xCA, 0x9E,
+    0x19, 0xFF, 0x7C, 0x27, 0x5D, 0x76, 0xD7, 0x85, 0xE4, 0x77, 0x54, 0xD1, 0xEA, 0xE7, 0xE2, 0x8C,
+    0xB6, 0x0F, 0xD9, 0x24, 0x07, 0x13, 0x39, 0x63, 0x29, 0xE4, 0x88, 0x80, 0x25, 0xB6, 0xFC, 0x7B,
+    0x24, 0xED, 0xA6, 0xB8, 0xA0, 0x61, 0x31, 0xBC, 0x15, 0x4E, 0x1F, 0x50, 0x0C, 0x1D, 0x8F, 0x43,
+    0x53, 0x9E, 0xDD, 0x4D, 0xE0, 0x76, 0x7D, 0xBC, 0x05, 0xE3, 0xBC, 0x7C, 0xF1, 0xFC, 0xD3, 0xFF,
+    0x32, 0xF6, 0x13, 0x4F, 0x79, 0xD0, 0xA9, 0x47, 0x25, 0xAA, 0xE2, 0xC0, 0xCA, 0xF8, 0x8D, 0x50,
+    0xD1, 0x33, 0x72, 0x67, 0x3F, 0xC3, 0xF6, 0x02, 0x59, 0xB1, 0xF0, 0xCF, 0x5C, 0xEA, 0x1F, 0x38,
+    0xF5, 0xAA, 0x0A, 0x21, 0x67, 0xB0, 0xE3, 0x46, 0x9B, 0x81, 0x9E, 0x03, 0xFB, 0x01, 0x34, 0x98,
+    0x1D, 0xA6, 0xCB, 0x7A, 0x39, 0xA3, 0x44, 0x5F, 0x11, 0x3B, 0x34, 0x15, 0xF1, 0x58, 0xA0, 0x23,
+    0x9D, 0xE4, 0xA4, 0x85, 0xBD, 0x83, 0x34, 0x0E, 0xD2, 0x35, 0x48, 0xAB, 0x20, 0x3D, 0x26, 0x0B,
+    0x67, 0x08, 0x24, 0x70, 0x44, 0xA3, 0x8A, 0xFE, 0xB5, 0x2E, 0x60, 0x5C, 0xD9, 0x31, 0x46, 0x13,
+    0xF8, 0x6A, 0x03, 0xF6, 0x59, 0x67, 0x74, 0xCC, 0x09, 0x3E, 0xD4, 0xE8, 0x92, 0xD2, 0x61, 0x2C,
+    0xEE, 0xA2, 0x2D, 0x76, 0x2E, 0x7F, 0xD4, 0x63, 0x2E, 0x97, 0x3D, 0xE2, 0x6C, 0x2E, 0x7B, 0xD2,
+    0x62, 0xBE, 0x21, 0x7D, 0x8A, 0x44, 0xCD, 0x8D, 0x26, 0x27, 0xEE, 0xE2, 0x70, 0x50, 0x29, 0x6D,
+    0x85, 0x69, 0x59, 0x95, 0x05, 0x17, 0x1D, 0x3B, 0x63, 0x87, 0x99, 0xE1, 0xA2, 0x1D, 0x54, 0xCF,
+    0xD4, 0x21, 0x87, 0x9A, 0x22, 0x61, 0x31, 0x2D, 0x62, 0x5A, 0xB1, 0x85, 0x1C, 0xBC, 0x20, 0x6D,
+    0xA5, 0x4E, 0x8E, 0x66, 0x90, 0xEE, 0xB0, 0x19, 0x82, 0x15, 0x9B, 0x15, 0x03, 0xEC, 0x94, 0x3E,
+    0xC8, 0x59, 0x04, 0x5E, 0xF4, 0x91, 0xB8, 0x45, 0x1F, 0x2B, 0xEA, 0x43, 0x9D, 0xE8, 0xC3, 0x50,
+    0x1F, 0x7A, 0x3D, 0x5B, 0xE6, 0xD6, 0x88, 0x67, 0x27, 0xF9, 0xD2, 0x4D, 0xDC, 0xA0, 0x50, 0x9A,
+    0xE2, 0x87, 0x0E, 0xEB, 0x53, 0x0E, 0x58, 0x4E, 0x38, 0x01, 0xD7, 0x76, 0x7C, 0x2D, 0xDD, 0x06,
+    0xFB, 0x09, 0xB6, 0x13, 0xF3, 0xC9, 0x2F, 0x9D, 0x88, 0xA7, 0x81, 0x4C, 0xCD, 0xF9, 0xD1, 0x4E,
+    0xC9, 0x53, 0xCF, 0x05, 0xB0, 0xA5, 0xD9, 0x0E, 0x25, 0x9A, 0x44, 0x3C, 0x51, 0xC4, 0x44, 0x5B,
+    0xCB, 0xE9, 0xDE, 0xE5, 0x03, 0x7C, 0x67, 0x67, 0x87, 0x29, 0xAD, 0xF4, 0x61, 0xC3, 0x54, 0xEE,
+    0xC8, 0xE7, 0x56, 0xC8, 0x72, 0x6E, 0xBE, 0xD9, 0x70, 0xCB, 0xDA, 0xBC, 0x2D, 0xF8, 0x5F, 0x85,
+    0x4A, 0x97, 0x06, 0xEE, 0x9D, 0xB4, 0x45, 0x99, 0xB6, 0xBA, 0xCC, 0x1A, 0xA3, 0x8A, 0x1A, 0x4A,
+    0xAD, 0xD1, 0xD7, 0x3E, 0x80, 0xAE, 0xF7, 0x46, 0x75, 0x2D, 0xBA, 0x05, 0x51, 0x6D, 0x99, 0xB7,
+    0xBE, 0x2C, 0x9A, 0xF9, 0xDD, 0x1D, 0xF4, 0xBB, 0xBF, 0x40, 0xD1, 0x8D, 0x7B, 0x75, 0x35, 0xDA,
+    0x56, 0x5B, 0x58, 0x48, 0x54, 0xEA, 0xA6, 0x68, 0x73, 0x74, 0x84, 0xBA, 0xD3, 0x82, 0x8B, 0x0E,
+    0x8E, 0xD5, 0xE4, 0xED, 0x96, 0x8A, 0x24, 0x03, 0x6D, 0x13, 0x23, 0xF0, 0x20, 0xB0, 0xF7, 0xD8,
+    0x50, 0xA0, 0x94, 0x27, 0xD8, 0xF1, 0xFA, 0xAD, 0x74, 0x64, 0xE0, 0x43, 0x8F, 0x01, 0xA7, 0xF4,
+    0x7D, 0x34, 0x55, 0x10, 0x7A, 0xC6, 0x28, 0xEC, 0xB7, 0x8F, 0xB6, 0x4F, 0xD3, 0x5C, 0x06, 0x87,
+    0x96, 0x42, 0xFB, 0xDB, 0x3C, 0xEE, 0x29, 0x78, 0x34, 0x0C, 0xFF, 0xF1, 0x5B, 0x59, 0x73, 0xD2,
+    0x76, 0x52, 0x84, 0xCE, 0xAC, 0x11, 0xE6, 0x17, 0x17, 0xFB, 0xD6, 0x68, 0x99, 0x72, 0xB7, 0xDB,
+    0x98, 0xF2, 0x34, 0xC9, 0xF7, 0x31, 0xA5, 0xE4, 0x7D, 0xD1, 0xB8, 0xAE, 0x82, 0xCE, 0xB9, 0x6B,
+    0xA1, 0xD6, 0x79, 0x5C, 0x42, 0xBD, 0xEB, 0x6A, 0xD1, 0xC9, 0x72, 0x9F, 0xB5, 0x5F, 0xCF, 0xFA,
+    0x5F, 0xDF, 0x83, 0x0D, 0x98, 0xBA, 0x49, 0xF7, 0xFD, 0xDD, 0x37, 0xE5, 0xE6, 0x61, 0x0E, 0xE4,
+    0x9E, 0x5E, 0x94, 0x5B, 0xE8, 0xD3, 0x79, 0x9C, 0xDC, 0xCF, 0x93, 0x7B, 0xDC, 0x7E, 0x99, 0xFE,
+    0xBB, 0xBE, 0xFF, 0x0F, 0xA5, 0x54, 0xBD, 0x8E, 0xDC, 0x36, 0x10, 0x1E, 0x49, 0xD8, 0x53, 0xC1,
+    0x42, 0x29, 0x72, 0x8D, 0x8B, 0x6C, 0xBF, 0x8D, 0xDE, 0x20, 0xA4, 0x2F, 0x0F, 0xE0, 0x2B, 0x7C,
+    0x95, 0x0B, 0x37, 0x69, 0xE2, 0xE6, 0x1A, 0xD7, 0x4B, 0x39, 0x4D, 0x0A, 0x37, 0x7E, 0x04, 0x17,
+    0x17, 0x20, 0xDE, 0xE6, 0x7A, 0x03, 0x3E, 0xC9, 0xB8, 0x07, 0x30, 0x01, 0x23, 0xA9, 0x19, 0xC0,
+    0xA9, 0x52, 0x98, 0x09, 0x08, 0x44, 0x17, 0x50, 0x9A, 0x7C, 0x43, 0xDD, 0xDA, 0x4E, 0x1C, 0x1C,
+    0x0C, 0x98, 0x3F, 0x43, 0x42, 0x1C, 0xCE, 0x7C, 0xFC, 0x66, 0x46, 0xFA, 0x32, 0xE9, 0x65, 0x7C,
+    0x7F, 0x3D, 0xDA, 0xA3, 0xF1, 0xD6, 0xED, 0x33, 0xAA, 0xFC, 0xD7, 0x44, 0x75, 0xD8, 0x12, 0x29,
+    0xFF, 0x02, 0xC2, 0x4D, 0x44, 0xCD, 0x90, 0x16, 0xB1, 0x66, 0xE6, 0xF0, 0x5E, 0x90, 0xAE, 0x02,
+    0x2D, 0xC2, 0xD6, 0x9E, 0x1E, 0xF0, 0xF9, 0xDF, 0x9D, 0xC5, 0xC1, 0x90, 0x45, 0x31, 0xAD, 0x07,
+    0xA2, 0x04, 0x51, 0x8C, 0x6D, 0x47, 0xE5, 0xD8, 0x1A, 0xAA, 0xA2, 0x26, 0xAA, 0x02, 0x44, 0x6E,
+    0xCA, 0xE4, 0x59, 0xF4, 0xB3, 0x69, 0x60, 0x4F, 0x63, 0x5A, 0x3E, 0x77, 0xFD, 0x63, 0x63, 0x30,
+    0xA9, 0xFF, 0xDD, 0x90, 0x66, 0x03, 0xB7, 0x91, 0x2A, 0xC6, 0xE6, 0x94, 0x1D, 0x29, 0xF8, 0x55,
+    0xF7, 0x23, 0xA9, 0x3B, 0xE3, 0x99, 0xBA, 0x13, 0xFB, 0xB7, 0x1C, 0x7A, 0x66, 0x87, 0x69, 0x0E,
+    0xFA, 0x37, 0xEF, 0x6C, 0xD2, 0x01, 0xED, 0x5B, 0x89, 0x9B, 0xDA, 0x50, 0x83, 0xCB, 0x3D, 0xC1,
+    0x58, 0x20, 0xBC, 0x49, 0x5F, 0xC6, 0x12, 0xAF, 0xD2, 0xDF, 0x8C, 0xF9, 0x0D, 0x47, 0xA9, 0xF1,
+    0x79, 0x11, 0xCC, 0xFA, 0x68, 0xD4, 0x5D, 0x3E, 0xB3, 0x07, 0x6F, 0xA8, 0xBD, 0x8C, 0x93, 0x9E,
+    0x71, 0xEF, 0xCF, 0xD4, 0xB3, 0x51, 0xFC, 0x3A, 0xCE, 0xED, 0x50, 0xCC, 0xEA, 0x8F, 0xD4, 0x40,
+    0xB7, 0x79, 0x99, 0x1A, 0x07, 0xDD, 0x47, 0x79, 0xB1, 0x45, 0x5E, 0xE6, 0xBC, 0x14, 0x89, 0x84,
+    0x82, 0x2A, 0x12, 0xF7, 0x03, 0x29, 0xD0, 0xC5, 0xD0, 0x77, 0xB4, 0x9E, 0x16, 0x5C, 0x66, 0x0F,
+    0xD0, 0x4E, 0x19, 0x25, 0xC3, 0x67, 0x8D, 0xA7, 0x40, 0xE9, 0xCA, 0x02, 0x54, 0x13, 0x9A, 0x2C,
+    0xD7, 0x22, 0xA3, 0xC6, 0xF7, 0x7A, 0x62, 0xB8, 0x04, 0x15, 0xD0, 0x2F, 0x78, 0x14, 0x06, 0x39,
+    0x94, 0x4C, 0x2D, 0xA7, 0x6A, 0x22, 0xFD, 0x17, 0xD7, 0x89, 0xFA, 0x81, 0x5F, 0x8D, 0xC4, 0x83,
+    0xC6, 0x3B, 0x79, 0x68, 0xD8, 0x53, 0xEF, 0x2A, 0x5C, 0xB3, 0x57, 0xC2, 0x1E, 0x28, 0x06, 0x99,
+    0x20, 0xFB, 0xED, 0x04, 0x0B, 0x73, 0x05, 0x6A, 0x0A, 0xC1, 0xA1, 0x87, 0xDC, 0x3B, 0xE9, 0xAD,
+    0xB9, 0xB5, 0x40, 0x13, 0x4A, 0x64, 0x2A, 0x97, 0x67, 0xFB, 0xC3, 0x2F, 0x23, 0xEE, 0xCB, 0x4C,
+    0x2B, 0x7B, 0x75, 0x4C, 0x1A, 0x04, 0xCE, 0x33, 0x95, 0xC9, 0x9A, 0x2A, 0xE9, 0xA1, 0x88, 0x5F,
+    0x11, 0x7D, 0x81, 0x7B, 0x2B, 0x23, 0xE9, 0xF2, 0xD1, 0x44, 0x88, 0x22, 0x5F, 0xCF, 0xC3, 0xFB,
+    0x3F, 0x1F, 0x7F, 0xAC, 0x03, 0x02, 0x88, 0xA9, 0x9C, 0xA8, 0x4A, 0x54, 0x8F, 0xA4, 0x80, 0x34,
+    0xD0, 0xDA, 0x03, 0x9D, 0x8C, 0xDE, 0xE0, 0xB0, 0x98, 0x6F, 0x3A, 0x7F, 0xDF, 0x1E, 0x82, 0xAD,
+    0x08, 0x6A, 0x23, 0x28, 0xF5, 0x64, 0x67, 0x2C, 0x2E, 0x13, 0x2D, 0xFC, 0xF6, 0xA3, 0xE4, 0xC1,
+    0x13, 0x24, 0xDE, 0x24, 0x14, 0xE2, 0x89, 0x7D, 0x5C, 0xF4, 0xE9, 0x5B, 0xB9, 0xFC, 0x60, 0xB7,
+    0x7B, 0xBA, 0x47, 0x2A, 0xFB, 0xBD, 0x51, 0xFE, 0xE0, 0x05, 0xFB, 0x6F, 0x72, 0x38, 0xCB, 0x19,
+    0xAC, 0xC0, 0x0D, 0xE2, 0x88, 0x4D, 0xFB, 0x6E, 0x13, 0xE1, 0x24, 0x8A, 0xB3, 0x12, 0xF1, 0xB2,
+    0xA0, 0x5B, 0x6E, 0xCE, 0xD7, 0xF7, 0x96, 0x76, 0x3A, 0x2F, 0x81, 0x97, 0x74, 0xE4, 0x73, 0x51,
+    0xE9, 0xC8, 0x3A, 0x3C, 0x11, 0x39, 0xA3, 0xC2, 0xEA, 0x59, 0x89, 0xA4, 0xD4, 0xEC, 0x53, 0xFB,
+    0x88, 0xD9, 0xBF, 0xD0, 0xD5, 0xA4, 0xFC, 0xD6, 0xD6, 0x41, 0x79, 0xBB, 0x55, 0x1E, 0xF2, 0xA2,
+    0x71, 0xCD, 0x22, 0xDD, 0xF6, 0xA2, 0xF1, 0x8D, 0x9B, 0xB6, 0x2A, 0xB4, 0xBF, 0x26, 0x5B, 0x09,
+    0x4E, 0x7D, 0x1B, 0x78, 0x7D, 0x3B, 0x6C, 0xBA, 0x8D, 0x91, 0x60, 0xC2, 0x15, 0x2C, 0x7F, 0x09,
+    0x78, 0xBF, 0xDD, 0x03, 0x0D, 0x28, 0x55, 0xC8, 0x83, 0x9C, 0x76, 0xB4, 0x3A, 0xC6, 0x87, 0x8E,
+    0x5A, 0x87, 0x7C, 0xD5, 0xFE, 0x73, 0x84, 0xCD, 0x02, 0x8C, 0x3B, 0x2D, 0x69, 0xD8, 0xCE, 0xF7,
+    0xB8, 0x43, 0xD6, 0xB1, 0x24, 0x6F, 0x12, 0xAF, 0xE2, 0x0E, 0xDE, 0x38, 0xE5, 0x4E, 0x9F, 0xD4,
+    0xEF, 0x8A, 0xEE, 0xEE, 0x27, 0xC4, 0x19, 0x20, 0x11, 0xF0, 0xD6, 0x49, 0xFC, 0x31, 0x90, 0x0B,
+    0xA0, 0x0B, 0x79, 0x81, 0xEC, 0x80, 0xA2, 0x64, 0x82, 0xBE, 0x41, 0x83, 0xF4, 0x6C, 0xD1, 0xB1,
+    0xFD, 0x84, 0x7E, 0x98, 0x75, 0x37, 0xCF, 0xA8, 0x1E, 0xAE, 0x4B, 0x42, 0xEC, 0x21, 0xB2, 0x49,
+    0x0C, 0x49, 0xE5, 0x5E, 0x58, 0x88, 0x84, 0x3F, 0x4C, 0x39, 0x4A, 0xB9, 0x07, 0x94, 0x78, 0x1D,
+    0x6A, 0xB8, 0x75, 0x28, 0xFD, 0xF5, 0x80, 0xDF, 0x00, 0xC0, 0x4C, 0xB4, 0x41, 0x5E, 0xD1, 0xE1,
+    0xC9, 0x89, 0x41, 0xFD, 0x0C, 0x9B, 0xDD, 0xAE, 0x3B, 0xC1, 0x3B, 0x3C, 0x2A, 0x9B, 0x50, 0xBB,
+    0xF2, 0x67, 0x5A, 0x21, 0x0E, 0x91, 0x74, 0x94, 0x64, 0x04, 0x3F, 0x4C, 0xFF, 0x19, 0xE5, 0x4C,
+    0x16, 0xF5, 0xED, 0xE5, 0xFC, 0x74, 0x42, 0x00, 0x89, 0xFE, 0x67, 0xE4, 0x63, 0x18, 0x29, 0x9E,
+    0xD2, 0xC5, 0x0D, 0xED, 0xBB, 0xE7, 0x59, 0x17, 0x3F, 0x89, 0xD3, 0x28, 0x85, 0x54, 0x7F, 0x38,
+    0x46, 0x81, 0x54, 0xCA, 0x59, 0xA0, 0x3E, 0x54, 0xEC, 0x91, 0x32, 0xF5, 0xBF, 0x75, 0xD4, 0x02,
+    0x33, 0x08, 0xD2, 0x1F, 0x01, 0xFC, 0x4C, 0x82, 0xDA, 0x3D, 0x94, 0x8C, 0xBB, 0x3A, 0xE7, 0xD8,
+    0x15, 0x39, 0xC2, 0xF4, 0x0F, 0xCD, 0x5A, 0x3D, 0x8C, 0xDD, 0xC6, 0x11, 0x1E, 0x92, 0x7A, 0xA2,
+    0x61, 0x22, 0x59, 0x17, 0x56, 0x63, 0x03, 0x61, 0x1D, 0x07, 0x11, 0x9B, 0x94, 0xD6, 0x2D, 0x0D,
+    0x23, 0x48, 0xE1, 0xC2, 0x57, 0xE8, 0xE2, 0x42, 0x85, 0x9B, 0x34, 0xAE, 0xAE, 0x4D, 0xE1, 0x78,
+    0x29, 0x1F, 0x10, 0x17, 0x29, 0xA2, 0x3A, 0x69, 0x54, 0xB8, 0x30, 0x2E, 0xC5, 0xA5, 0x48, 0xE1,
+    0x42, 0x7A, 0xA4, 0xAC, 0xD2, 0x0D, 0x6D, 0xC5, 0x48, 0x91, 0xC2, 0x0C, 0x6C, 0x27, 0x80, 0x54,
+    0x98, 0xB0, 0x28, 0x8B, 0xB2, 0x48, 0x6E, 0xBE, 0x6F, 0x97, 0xEF, 0xDD, 0xE9, 0xA2, 0x5F, 0xF8,
+    0x1C, 0xDD, 0x3B, 0xCE, 0xF0, 0x3D, 0x72, 0x39, 0x3B, 0x3B, 0x3B, 0xF3, 0xCD, 0xEC, 0xF2, 0xD2,
+    0x42, 0xD7, 0xA6, 0xD1, 0x75, 0x5A, 0x08, 0x3E, 0x2F, 0x14, 0x59, 0x95, 0x55, 0x7A, 0xFF, 0xAF,
+    0xF6, 0x7F, 0xA6, 0x31, 0xCD, 0xA9, 0x9C, 0x2D, 0x44, 0x15, 0x9E, 0xB6, 0xEF, 0x48, 0x6C, 0x6D,
+    0x91, 0x5A, 0x9B, 0xEB, 0xA9, 0x14, 0xD3, 0x04, 0x52, 0x56, 0x22, 0xB6, 0x98, 0x29, 0xDF, 0xFF,
+    0xCE, 0xEB, 0xA6, 0x3D, 0x99, 0x6B, 0xB4, 0x55, 0xA0, 0xD0, 0x5A, 0x91, 0xF4, 0xEF, 0xFB, 0xB2,
+    0x16, 0xE2, 0x3F, 0xA9, 0xBD, 0x20, 0xA5, 0xED, 0x02, 0x6B, 0xDB, 0xC8, 0xFE, 0xA9, 0x89, 0x46,
+    0x91, 0x78, 0xD8, 0xA7, 0x73, 0xE3, 0x96, 0x58, 0x3C, 0x4F, 0xDA, 0x9B, 0x76, 0xF3, 0x83, 0xF7,
+    0x92, 0x1E, 0x8F, 0xB7, 0xE8, 0xEB, 0xFA, 0xEE, 0x07, 0xB8, 0x3F, 0xAC, 0xE8, 0x19, 0x09, 0x73,
+    0xBD, 0xFD, 0xCF, 0x1A, 0x7D, 0x37, 0xE8, 0xBB, 0x50, 0x8D, 0xC9, 0xD3, 0x2A, 0x2D, 0xD2, 0x42,
+    0x55, 0x24, 0x55, 0xEB, 0x42, 0x4D, 0x36, 0xCF, 0xAC, 0xAD, 0xD8, 0xE6, 0x27, 0x8B, 0xC8, 0x59,
+    0xA2, 0x2C, 0x30, 0x04, 0x5D, 0x85, 0x56, 0x32, 0xEA, 0xA1, 0x5A, 0x74, 0x92, 0x74, 0xAA, 0x93,
+    0x68, 0x40, 0x37, 0xE1, 0x98, 0xD5, 0x18, 0x9B, 0xC6, 0xC0, 0x4A, 0x8E, 0x54, 0x63, 0x40, 0xA2,
+    0xA9, 0x2E, 0x54, 0xF7, 0x2C, 0x78, 0xF3, 0xCE, 0x26, 0xD4, 0xEA, 0x44, 0xC2, 0xBD, 0xE9, 0xA2,
+    0xBF, 0x16, 0xA1, 0x03, 0x7F, 0xED, 0x00, 0x5B, 0xEE, 0x7F, 0xDE, 0x72, 0x56, 0xB8, 0xE7, 0xC2,
+    0x29, 0x3C, 0xD9, 0xA7, 0x76, 0xD4, 0x9F, 0x0D, 0x46, 0x4E, 0xE8, 0x42, 0x74, 0x23, 0x8A, 0x66,
+    0x6C, 0xB3, 0xCF, 0x07, 0x1D, 0x8C, 0x46, 0x96, 0x3A, 0x5F, 0xEA, 0x66, 0x52, 0x76, 0x08, 0x6D,
+    0x27, 0xD9, 0x20, 0xE1, 0x24, 0x32, 0x6D, 0xCA, 0xF4, 0xCE, 0x1B, 0xA3, 0xB1, 0x7D, 0x66, 0x6B,
+    0x39, 0x2B, 0x59, 0xD0, 0x99, 0x9D, 0x01, 0xC7, 0xE9, 0xA0, 0x9B, 0x8D, 0x1D, 0x5A, 0x98, 0x4C,
+    0xB2, 0x89, 0x33, 0x34, 0x4A, 0x8C, 0x91, 0x41, 0xB7, 0xCB, 0x92, 0x14, 0xDB, 0x7D, 0x26, 0x69,
+    0x60, 0x87, 0xA4, 0x38, 0x13, 0x37, 0xCF, 0x47, 0xD5, 0xCB, 0xAA, 0x92, 0xB0, 0xFE, 0xAD, 0xCA,
+    0x25, 0x68, 0xFE, 0x96, 0x8A, 0x04, 0x2D, 0xB9, 0xB4, 0xFE, 0xBB, 0xBF, 0xFE, 0x32, 0xA6, 0x31,
+    0xAC, 0x5F, 0x8E, 0x6B, 0x89, 0xAA, 0x2C, 0xC2, 0xB3, 0x95, 0xCA, 0xCB, 0x3E, 0x95, 0x18, 0x6E,
+    0xF1, 0x3B, 0x09, 0x46, 0x09, 0xD1, 0x99, 0xBE, 0x5E, 0xC2, 0x6A, 0x27, 0xED, 0xC8, 0xEE, 0xE7,
+    0x39, 0x4F, 0x6C, 0x9E, 0xDA, 0xFA, 0xC7, 0xAF, 0x35, 0x12, 0xB5, 0x89, 0x6D, 0xF5, 0x8D, 0x56,
+    0x47, 0xAD, 0x4E, 0x5A, 0x6D, 0xDB, 0xF4, 0x56, 0x1B, 0xC0, 0xB6, 0xCF, 0x49, 0x2E, 0xCB, 0xA0,
+    0x0F, 0x6C, 0x34, 0x46, 0xA3, 0xEA, 0x55, 0x9F, 0xB5, 0xBA, 0x2D, 0xAB, 0xF2, 0x8A, 0x15, 0x12,
+    0xBF, 0xAB, 0x5E, 0xB7, 0xBC, 0xC7, 0x36, 0x6C, 0xCB, 0x67, 0x4A, 0x6B, 0x3B, 0x3B, 0xD3, 0xA9,
+    0xAD, 0x37, 0x38, 0x0F, 0x87, 0x28, 0xD8, 0x7C, 0x69, 0x17, 0x3E, 0x39, 0x1F, 0x8F, 0xB0, 0xCA,
+    0x8E, 0xAD, 0x61, 0x95, 0xC8, 0xF6, 0xB0, 0x4A, 0x54, 0x5F, 0x86, 0x55, 0xA2, 0xFA, 0x0C, 0xAC,
+    0x02, 0x0E, 0xAB, 0x44, 0xF5, 0x25, 0x58, 0x25, 0x82, 0xFD, 0xC9, 0x6B, 0x58, 0x25, 0xFA, 0xB4,
+    0x85, 0x55, 0xA2, 0xBA, 0x87, 0x55, 0xA2, 0xFA, 0x6D, 0x5A, 0xA5, 0xDE, 0x80, 0x55, 0x5E, 0xAD,
+    0xD3, 0x37, 0x61, 0x15, 0x79, 0xB8, 0x55, 0xE0, 0x50, 0x76, 0x5A, 0x11, 0x7E, 0xC6, 0x93, 0x64,
+    0xB6, 0x32, 0x7B, 0xCD, 0xE5, 0xA8, 0x1D, 0x42, 0x1E, 0xCB, 0x18, 0x26, 0xAA, 0x53, 0x5B, 0x04,
+    0x1F, 0xF8, 0xA7, 0x30, 0x49, 0x87, 0x69, 0xB7, 0xBC, 0xFE, 0xFE, 0xCA, 0x04, 0x5B, 0xDB, 0x9F,
+    0x6D, 0xDE, 0xAF, 0x0D, 0x3F, 0xF6, 0x80, 0xA9, 0x4E, 0xBA, 0x9E, 0x20, 0xFA, 0x47, 0x0A, 0x8E,
+    0xD6, 0x48, 0x5A, 0x09, 0x9C, 0x6E, 0x92, 0xB8, 0x97, 0xB4, 0x81, 0x5A, 0xAD, 0x3F, 0xD0, 0x4C,
+    0xDB, 0x2A, 0xDB, 0x6B, 0x4E, 0xC4, 0xF0, 0xF7, 0x26, 0x2C, 0xAB, 0x08, 0x71, 0xBD, 0xC7, 0x59,
+    0xC4, 0xB1, 0xB1, 0x4D, 0xE5, 0x32, 0x6F, 0xD4, 0x2D, 0xB8, 0xBD, 0xA8, 0x1E, 0x71, 0x24, 0x26,
+    0x87, 0x2B, 0x22, 0xAE, 0xE2, 0xC1, 0x16, 0xC9, 0x63, 0x90, 0x1A, 0x6C, 0x95, 0x0E, 0xF6, 0x96,
+    0x99, 0xC3, 0xF9, 0xF6, 0x60, 0xCB, 0x4F, 0x07, 0xFB, 0xCB, 0x03, 0x30, 0x73, 0x88, 0xF8, 0x01,
+    0x7C, 0x4C, 0x09, 0x28, 0xB3, 0xE3, 0x3B, 0xDA, 0xF6, 0x1B, 0x24, 0x73, 0x1F, 0xE2, 0xF5, 0x0C,
+    0xA4, 0x40, 0x98, 0xF6, 0x0D, 0x39, 0xF1, 0xE1, 0x86, 0xC8, 0xE3, 0xD2, 0x6F, 0x7E, 0xBA, 0x10,
+    0x0F, 0x8C, 0xBA, 0x5A, 0x08, 0x66, 0xB6, 0x01, 0x42, 0x0C, 0xBF, 0x1E, 0x4C, 0x6F, 0x6A, 0x79,
+    0x09, 0xDA, 0x20, 0x70, 0x61, 0x4A, 0xC9, 0x8C, 0x3C, 0xA3, 0x31, 0xA1, 0xF7, 0x3B, 0x84, 0xB1,
+    0xAA, 0x60, 0xA9, 0x3F, 0xB7, 0x3A, 0xEC, 0x36, 0x70, 0x04, 0x1D, 0xBE, 0xE8, 0x5F, 0xB5, 0xCA,
+    0x36, 0x31, 0xCC, 0xF7, 0x1C, 0xA6, 0xF6, 0x84, 0x64, 0x70, 0x40, 0xB8, 0x7A, 0x9E, 0xB5, 0xA6,
+    0xA2, 0xFB, 0x7B, 0x57, 0x7F, 0x75, 0x22, 0xAD, 0x42, 0x82, 0xF7, 0x5C, 0x1B, 0xB4, 0xE5, 0x33,
+    0xF2, 0x8E, 0x88, 0x83, 0x82, 0x70, 0x10, 0x35, 0x71, 0x5A, 0xF4, 0x24, 0x49, 0x23, 0x3F, 0x5F,
+    0x72, 0x4A, 0x65, 0xC9, 0x59, 0x05, 0x37, 0xC4, 0x1B, 0xA1, 0xEB, 0x2D, 0xC3, 0x21, 0xBC, 0x28,
+    0xCB, 0xA8, 0x53, 0xAD, 0x2C, 0x13, 0xC8, 0x93, 0xA5, 0xAA, 0x74, 0x2B, 0x6F, 0x65, 0xC5, 0x5D,
+    0xE0, 0xAA, 0x09, 0x6F, 0x82, 0x4F, 0xD1, 0x35, 0x20, 0xDB, 0xA0, 0x76, 0x30, 0xCB, 0x5D, 0xF6,
+    0x97, 0xEF, 0x04, 0x0D, 0x01, 0xE6, 0xAA, 0x26, 0xCF, 0x2A, 0xD7, 0x8D, 0x90, 0xBB, 0xDE, 0xE7,
+    0xEE, 0xE7, 0xFE, 0x67, 0x05, 0x56, 0x1A, 0xCC, 0x2A, 0xCC, 0x3A, 0xCC, 0x4A, 0x50, 0x8B, 0x17,
+    0x2F, 0xE2, 0x14, 0xDD, 0x62, 0x3C, 0x2C, 0x93, 0x6F, 0x98, 0x2A, 0xA0, 0xC8, 0xC5, 0x52, 0xA8,
+    0x89, 0x6B, 0x0B, 0x62, 0x4C, 0x78, 0xD9, 0xC1, 0xE0, 0x50, 0x34, 0x02, 0xF2, 0x21, 0x8A, 0x92,
+    0x56, 0x4A, 0xC6, 0x42, 0x8D, 0x14, 0x93, 0x43, 0xA1, 0x88, 0x27, 0x2D, 0xEE, 0xE4, 0x3E, 0x2F,
+    0x8E, 0x0C, 0x6B, 0x03, 0x5F, 0x1D, 0x64, 0x63, 0xBB, 0xA2, 0x5A, 0xAA, 0xA2, 0x56, 0xC8, 0x08,
+    0x95, 0x24, 0x13, 0x75, 0x52, 0x23, 0xBB, 0x58, 0x98, 0x82, 0x1A, 0xA9, 0x2B, 0xC3, 0xB3, 0x17,
+    0x72, 0x75, 0xAD, 0x4B, 0x9B, 0x65, 0xF9, 0x71, 0xAB, 0x9B, 0xD2, 0xBE, 0x5E, 0xDB, 0xE6, 0xC5,
+    0x3E, 0x3B, 0x7F, 0x17, 0x8F, 0x99, 0xE8, 0x73, 0xF0, 0x49, 0xFD, 0xB1, 0x81, 0x26, 0x29, 0xE2,
+    0x25, 0xEA, 0xF4, 0x5E, 0x2F, 0x0C, 0x4E, 0x24, 0x8D, 0x9A, 0x1C, 0x66, 0xC1, 0x75, 0x9D, 0x93,
+    0xBB, 0x04, 0x8A, 0x53, 0xD6, 0x79, 0x62, 0xC6, 0x3A, 0x39, 0xBB, 0xAD, 0x43, 0xC3, 0x76, 0xBE,
+    0xDF, 0xB8, 0xAC, 0x89, 0x98, 0xA2, 0x36, 0xC0, 0x38, 0x10, 0x93, 0xA8, 0xA3, 0x40, 0xF4, 0xAD,
+    0x6D, 0x26, 0xAB, 0x1A, 0x09, 0x0D, 0x23, 0x1D, 0xFD, 0xB3, 0x8B, 0x4D, 0x27, 0x7D, 0xF0, 0x28,
+    0xE6, 0x2E, 0x99, 0x62, 0xD5, 0x21, 0xD1, 0x6E, 0xDD, 0x4B, 0x64, 0x2B, 0xC7, 0x6B, 0x87, 0xBF,
+    0xBC, 0x8B, 0x74, 0x42, 0x7E, 0x97, 0xB9, 0x21, 0xFB, 0x0F, 0x11, 0x50, 0x5F, 0xA3, 0x20, 0x73,
+    0x95, 0xC2, 0xCB, 0xF3, 0x14, 0x87, 0xBC, 0xCB, 0xD8, 0x62, 0x66, 0x87, 0x78, 0xA7, 0xDD, 0x2E,
+    0x04, 0x21, 0xB1, 0x41, 0x04, 0xE2, 0x0D, 0x22, 0x94, 0xE3, 0x69, 0xC7, 0x70, 0x87, 0xCE, 0xD0,
+    0x05, 0xD9, 0x2A, 0x86, 0x39, 0x91, 0x16, 0x26, 0xB1, 0x7C, 0x84, 0x9A, 0x6C, 0xB9, 0xA1, 0x3A,
+    0xB5, 0x53, 0x97, 0x8D, 0xB4, 0xC3, 0xA1, 0xC9, 0x29, 0x77, 0x56, 0x8E, 0x8B, 0x9E, 0x5B, 0xDE,
+    0x92, 0xD5, 0xBA, 0xF7, 0xF4, 0x1F, 0xEC, 0xD1, 0xBC, 0x32, 0x39, 0x35, 0x4F, 0x1D, 0x17, 0x3D,
+    0xBD, 0xE7, 0x74, 0x8A, 0x7D, 0x59, 0xBA, 0xBF, 0x71, 0x2E, 0x71, 0x29, 0x65, 0xBF, 0xCC, 0x9E,
+    0xC7, 0x43, 0xCF, 0x34, 0x77, 0xF2, 0x3F, 0x1A, 0xD6, 0x3C, 0xCD, 0x3B, 0xB9, 0xF7, 0xF3, 0x94,
+    0x2D, 0xF9, 0xBC, 0x9F, 0x71, 0x46, 0x4D, 0x74, 0x83, 0x3A, 0xC4, 0xEF, 0x52, 0x87, 0xF8, 0x6A,
+    0xB3, 0xD6, 0xEA, 0xA9, 0xE9, 0x96, 0xB9, 0x56, 0x98, 0x5B, 0x77, 0x2A, 0xFD, 0xC9, 0xBA, 0x53,
+    0x38, 0x11, 0x47, 0x7C, 0x65, 0xCA, 0x4A, 0xD8, 0x9D, 0x54, 0xE7, 0x4E, 0x69, 0x9B, 0x7E, 0xB7,
+    0x7B, 0x01, 0x99, 0x2A, 0x65, 0x87, 0xA6, 0x72, 0xA7, 0xB2, 0x70, 0x27, 0x7B, 0xBD, 0x6C, 0x39,
+    0x5E, 0x27, 0x2A, 0xF2, 0x27, 0xAF, 0x12, 0x9E, 0x76, 0xD8, 0x04, 0xC2, 0xE3, 0x17, 0xA1, 0x0F,
+    0x1E, 0x40, 0x86, 0x71, 0x27, 0xD8, 0x27, 0x75, 0x8D, 0xF8, 0x39, 0x69, 0xEF, 0x38, 0xA5, 0x8A,
+    0x80, 0x55, 0x79, 0x6C, 0xAF, 0x5B, 0xC2, 0xFD, 0x42, 0x9C, 0xF3, 0x11, 0xB7, 0x38, 0x18, 0x30,
+    0x5A, 0xCD, 0x38, 0x56, 0xAD, 0xBF, 0xD5, 0xEB, 0xBB, 0x6C, 0x47, 0x3C, 0x24, 0xDA, 0x05, 0xD0,
+    0xE1, 0xAB, 0xD2, 0xE9, 0xE3, 0xC6, 0x09, 0xD0, 0x76, 0xFE, 0x7C, 0x79, 0x8D, 0x11, 0x4E, 0x04,
+    0x6B, 0x97, 0x60, 0xBB, 0x62, 0xC9, 0x8D, 0xF9, 0x82, 0xB9, 0x1C, 0x00, 0x12, 0xFE, 0xA2, 0xC9,
+    0xD7, 0xEF, 0x92, 0xA2, 0x83, 0xC0, 0xBB, 0x3F, 0x35, 0x3C, 0x40, 0xB9, 0x59, 0xA3, 0xE9, 0x4C,
+    0xD7, 0x77, 0xD9, 0x66, 0x9F, 0x0E, 0xDF, 0xF7, 0x6D, 0xF2, 0x83, 0x72, 0x1C, 0x90, 0x11, 0xC6,
+    0x08, 0x62, 0x84, 0xB0, 0x69, 0x1F, 0xBE, 0x7E, 0x90, 0xFE, 0xB8, 0x02, 0x83, 0xFB, 0xB1, 0xCC,
+    0x54, 0xDF, 0x0C, 0x48, 0x2C, 0x25, 0x40, 0x68, 0xF1, 0x83, 0xF5, 0x97, 0x54, 0x97, 0x51, 0xF3,
+    0x59, 0x98, 0xD1, 0x62, 0x55, 0xF0, 0xF6, 0x3A, 0x48, 0x7F, 0x88, 0xBE, 0x30, 0x34, 0xBA, 0x7E,
+    0x8F, 0x95, 0x95, 0xB0, 0x4C, 0x5C, 0xF8, 0x22, 0xB8, 0xF3, 0x07, 0xA6, 0x18, 0xC1, 0xF3, 0x38,
+    0x47, 0xC4, 0x5A, 0x7E, 0x7E, 0x4A, 0x16, 0x67, 0xE9, 0x54, 0xE8, 0x0E, 0xD7, 0xFB, 0xD9, 0x13,
+    0xBE, 0xAF, 0xCC, 0xAD, 0xD5, 0x1C, 0x40, 0xDB, 0x9B, 0x88, 0xD4, 0x62, 0x7F, 0x0E, 0x14, 0x53,
+    0xFE, 0x4C, 0x81, 0xF5, 0x19, 0xFC, 0x89, 0x09, 0xB2, 0x0F, 0xCA, 0x39, 0x1D, 0xB6, 0xE6, 0xD5,
+    0x1E, 0xC7, 0xE9, 0xA0, 0x5D, 0xAD, 0x0C, 0xBE, 0xD7, 0x00, 0x62, 0x3B, 0x15, 0x44, 0x9F, 0xD1,
+    0x41, 0x50, 0xE1, 0x70, 0x08, 0x85, 0x6B, 0xD9, 0x81, 0xA5, 0x03, 0x17, 0xB9, 0x23, 0x58, 0x3C,
+    0x25, 0x03, 0xE2, 0xC8, 0xD8, 0x21, 0xB2, 0x6B, 0x36, 0xFD, 0x6C, 0x7A, 0x3F, 0x9A, 0x78, 0x97,
+    0x4D, 0x92, 0x61, 0xF5, 0x04, 0x9E, 0x9D, 0xF6, 0x58, 0xAF, 0x7A, 0x79, 0x4E, 0xF2, 0x85, 0xD9,
+    0x57, 0x54, 0x93, 0xB1, 0xF0, 0x5B, 0x32, 0x92, 0x11, 0x9A, 0x3D, 0x43, 0x65, 0x73, 0x8E, 0x49,
+    0x31, 0x1D, 0x4A, 0x38, 0x83, 0x8E, 0x06, 0x33, 0x91, 0x59, 0xC7, 0x0A, 0xB2, 0x1A, 0xCC, 0xB4,
+    0x60, 0x6F, 0x76, 0x60, 0xAF, 0x0D, 0x60, 0x3B, 0x13, 0xD8, 0xBB, 0x16, 0xAC, 0xB0, 0x57, 0xC1,
+    0xCC, 0x35, 0x30, 0x7D, 0x13, 0x2C, 0xFD, 0x16, 0x2C, 0xB1, 0x60, 0x11, 0x59, 0x48, 0x26, 0x8E,
+    0x19, 0x32, 0x3D, 0xD0, 0x13, 0xFC, 0x2A, 0xCA, 0x2D, 0x0F, 0xF2, 0xFD, 0x9A, 0x23, 0x69, 0x0F,
+    0xD5, 0x46, 0x89, 0x5B, 0xFF, 0x95, 0x0C, 0x37, 0x0F, 0x8C, 0x09, 0x20, 0xAD, 0x27, 0x2E, 0xA5,
+    0x88, 0xB8, 0x9E, 0x32, 0x34, 0x17, 0xF2, 0x04, 0x2E, 0x98, 0x16, 0x18, 0x06, 0x79, 0x0F, 0xE2,
+    0xBE, 0x8D, 0x6F, 0x0F, 0x4F, 0xC4, 0xB3, 0x5E, 0x4E, 0x62, 0xFF, 0x0D, 0x99, 0xD1, 0x1A, 0xCA,
+    0x0B, 0x62, 0xDC, 0x1D, 0x76, 0x3F, 0x17, 0x15, 0x5B, 0x3E, 0x19, 0x3A, 0x0B, 0x52, 0x1F, 0x57,
+    0x10, 0xBA, 0xC0, 0xB8, 0xB7, 0x42, 0x3A, 0x16, 0xDA, 0x32, 0x24, 0xF0, 0xBC, 0xCF, 0x8E, 0x2E,
+    0xF5, 0xDC, 0x74, 0x39, 0xBE, 0x28, 0x5D, 0x93, 0x53, 0xC7, 0xCC, 0xB6, 0xCE, 0x13, 0xB0, 0x8C,
+    0xE7, 0x76, 0xD3, 0x9E, 0xDB, 0xBB, 0xA1, 0x9D, 0xCF, 0x24, 0x83, 0x2B, 0x00, 0xF2, 0x63, 0xA5,
+    0xAD, 0x2A, 0x2E, 0x71, 0xF2, 0x3F, 0xA1, 0xE3, 0x66, 0x35, 0x79, 0x52, 0x7C, 0x78, 0xA8, 0x66,
+    0x3A, 0x06, 0x7A, 0x2E, 0x24, 0x44, 0x31, 0x97, 0x54, 0xBA, 0xCE, 0x1A, 0xD5, 0x95, 0x08, 0x43,
+    0xA8, 0x4A, 0xB5, 0x98, 0xDD, 0x4B, 0x44, 0x39, 0x40, 0x21, 0xE9, 0xB1, 0x38, 0x6D, 0xD0, 0xA2,
+    0x50, 0xF5, 0xB3, 0x12, 0xAD, 0xED, 0x7C, 0x81, 0x23, 0xB8, 0xD3, 0x3B, 0xA9, 0xDD, 0xE1, 0x11,
+    0x68, 0x37, 0x82, 0x92, 0x23, 0x40, 0x7D, 0x01, 0x71, 0xD1, 0xB7, 0x1C, 0x41, 0xF2, 0x2F, 0xEA,
+    0x9B, 0x5E, 0x21, 0xD7, 0xAF, 0x90, 0x2F, 0x39, 0x82, 0x4F, 0x06, 0x8E, 0xE0, 0x8B, 0x8E, 0x23,
+    0xB8, 0xDB, 0x70, 0x04, 0xB6, 0xE2, 0x08, 0x6C, 0x7E, 0x68, 0x04, 0xE4, 0x85, 0x24, 0x37, 0x38,
+    0x82, 0xB0, 0x3A, 0xE0, 0x17, 0x2E, 0xEE, 0x08, 0xC3, 0x92, 0xD1, 0x91, 0xE3, 0x61, 0x5D, 0x73,
+    0xAC, 0x1A, 0x01, 0x4F, 0xB2, 0x1A, 0x2D, 0xB0, 0x10, 0xFC, 0x1E, 0xCC, 0x38, 0x56, 0x63, 0x28,
+    0x30, 0xB5, 0xAD, 0xB2, 0xE9, 0x9C, 0x2D, 0x58, 0x06, 0x52, 0xB3, 0x81, 0x19, 0x96, 0xC1, 0xE4,
+    0x40, 0xE9, 0x14, 0xB9, 0x69, 0xC4, 0xEF, 0xA8, 0x72, 0x47, 0xD4, 0x63, 0xD6, 0x22, 0x7F, 0x3A,
+    0x0A, 0x05, 0x44, 0x1F, 0xE5, 0xFC, 0xD1, 0x6D, 0xED, 0x6E, 0xD7, 0xC0, 0xF0, 0xB8, 0x23, 0x84,
+    0x9E, 0x7D, 0x2A, 0x0A, 0x5D, 0x8A, 0xB9, 0x13, 0xAB, 0xB8, 0x39, 0x41, 0xF6, 0x36, 0x7F, 0xEE,
+    0x97, 0x2A, 0xFF, 0xE7, 0xD9, 0x72, 0x79, 0xC6, 0xAD, 0x69, 0x5D, 0xC1, 0x4B, 0x60, 0x89, 0xFA,
+    0x83, 0x09, 0x06, 0xF2, 0xB2, 0x16, 0xD3, 0xA9, 0x1B, 0x88, 0x2A, 0x2B, 0x94, 0xD9, 0x36, 0x4F,
+    0x06, 0xE6, 0xE8, 0x11, 0x73, 0x1B, 0x5A, 0xA2, 0x90, 0x7D, 0x1D, 0x02, 0xCA, 0xAF, 0xB9, 0xE6,
+    0xE7, 0x72, 0x28, 0xA5, 0x9D, 0x95, 0x5D, 0xE5, 0x2F, 0xE7, 0x02, 0x8F, 0x66, 0xF7, 0x16, 0x5B,
+    0x17, 0xC4, 0x15, 0x6A, 0xD6, 0xD6, 0xC6, 0xD5, 0xF1, 0x59, 0x6F, 0x2A, 0x35, 0x98, 0x2A, 0x01,
+    0xC5, 0xF3, 0x19, 0xD7, 0x6E, 0xE0, 0x1E, 0xEA, 0x01, 0xDF, 0xF6, 0xCB, 0xFF, 0x29, 0xDA, 0x5C,
+    0x09, 0x15, 0x30, 0x74, 0x14, 0x63, 0x55, 0x73, 0xF4, 0xA6, 0x4B, 0x47, 0xD8, 0x84, 0x0B, 0x95,
+    0x02, 0xFD, 0x72, 0xDF, 0x0E, 0x0C, 0xD0, 0x61, 0x0B, 0x98, 0xC5, 0xBE, 0x0B, 0xBD, 0xED, 0x8E,
+    0x67, 0xC8, 0xC9, 0xE7, 0x2D, 0x6F, 0x18, 0x36, 0x56, 0x68, 0x80, 0x45, 0x43, 0x85, 0xCB, 0xA6,
+    0x06, 0xD3, 0xB5, 0xFD, 0xBD, 0x94, 0xB5, 0x7D, 0xCF, 0xE2, 0xDA, 0x7B, 0xDC, 0xE5, 0xDF, 0x71,
+    0x65, 0xFF, 0x62, 0xDE, 0x30, 0xA0, 0x29, 0xF4, 0xBC, 0x7B, 0x1E, 0x0E, 0xAB, 0xC5, 0x1A, 0x4C,
+    0xC6, 0x00, 0xB7, 0x55, 0xC2, 0x77, 0x06, 0x17, 0x32, 0xBF, 0x74, 0x21, 0x6D, 0xDB, 0x8E, 0x5A,
+    0x6A, 0xBB, 0xD7, 0x95, 0xB5, 0xEA, 0x2C, 0x6C, 0x6D, 0x8B, 0x14, 0xDF, 0x4D, 0x67, 0xDC, 0xF5,
+    0xDB, 0x5D, 0x62, 0x77, 0xBA, 0x39, 0xCA, 0x72, 0xD7, 0x01, 0xB7, 0x4D, 0xE2, 0xDE, 0x2F, 0x1C,
+    0x16, 0x72, 0x74, 0xF2, 0xB9, 0x32, 0xD1, 0x90, 0x8B, 0x01, 0x85, 0x63, 0x99, 0x27, 0x6D, 0x56,
+    0x2D, 0x72, 0x5F, 0x05, 0x1D, 0x8D, 0xFE, 0x44, 0xA9, 0xB0, 0x8D, 0xEC, 0x8D, 0x06, 0x72, 0x2A,
+    0x75, 0xDE, 0xE6, 0x8B, 0x23, 0xB4, 0x4F, 0xD8, 0xA6, 0x79, 0xDC, 0xEB, 0x8A, 0x14, 0x36, 0xE9,
+    0x3A, 0xBA, 0x8E, 0xC6, 0x36, 0x4C, 0xC1, 0x78, 0x6C, 0x89, 0x39, 0xED, 0xCE, 0x78, 0xE2, 0x77,
+    0x2E, 0x07, 0xE7, 0x42, 0xF1, 0xC8, 0x6C, 0x44, 0x51, 0x63, 0xE2, 0xFD, 0xB7, 0x84, 0x2B, 0x72,
+    0xB1, 0x8B, 0x39, 0x89, 0x8A, 0x6C, 0x72, 0x3B, 0x66, 0xA8, 0xB5, 0xDC, 0xA9, 0x93, 0x32, 0x0F,
+    0xF6, 0x78, 0x93, 0xEF, 0xAB, 0x98, 0x2C, 0xF4, 0xC4, 0x9F, 0x05, 0x7B, 0x71, 0x51, 0xEC, 0x4E,
+    0xF0, 0xF3, 0xC1, 0xFD, 0x42, 0xE5, 0xFA, 0x02, 0x22, 0x6C, 0xE2, 0x66, 0xBD, 0xB6, 0x3D, 0xBE,
+    0x41, 0x74, 0xED, 0x12, 0xF3, 0x73, 0x2B, 0x47, 0x25, 0x4E, 0xE4, 0x11, 0x67, 0x07, 0x72, 0xB2,
+    0xF1, 0x9C, 0x5B, 0xF4, 0x72, 0x09, 0x7C, 0x78, 0x05, 0x60, 0x66, 0x47, 0xD7, 0xE3, 0x39, 0xB6,
+    0xAD, 0x50, 0x4D, 0x57, 0x4C, 0x81, 0xFE, 0x6D, 0x59, 0xED, 0x3D, 0x34, 0x40, 0xC7, 0x6F, 0x80,
+    0xCA, 0xDE, 0x09, 0x79, 0x58, 0x84, 0x48, 0x39, 0xCA, 0xDC, 0x6F, 0x9B, 0x75, 0x69, 0xA7, 0x6B,
+    0x46, 0x7C, 0x34, 0x20, 0xDF, 0xEE, 0xD3, 0x81, 0x7E, 0x91, 0x70, 0xFF, 0xAA, 0xDC, 0x1B, 0x38,
+    0x64, 0xCA, 0x92, 0xD8, 0xB6, 0xF9, 0xD0, 0x08, 0x39, 0x12, 0xF9, 0x0F, 0x89, 0x90, 0xA3, 0x90,
+    0xFF, 0x20, 0x0F, 0x3E, 0x0A, 0xD9, 0xC8, 0xD0, 0xAC, 0x94, 0x06, 0x07, 0xF7, 0x58, 0x55, 0xB8,
+    0xCC, 0x0C, 0x3C, 0x7C, 0xA2, 0x03, 0x13, 0x08, 0xCE, 0x0D, 0xA0, 0x9A, 0x3B, 0xD8, 0x3E, 0x95,
+    0x12, 0x31, 0x9F, 0xE4, 0x60, 0xF9, 0x12, 0xB8, 0xCD, 0x25, 0x2C, 0x4E, 0xBF, 0xE0, 0xE2, 0xD4,
+    0xC2, 0x07, 0xE6, 0xCA, 0xE5, 0x41, 0x6F, 0x4C, 0x1E, 0x93, 0x36, 0xC2, 0xA6, 0x8C, 0x3B, 0x1C,
+    0x67, 0xC2, 0x66, 0xDE, 0xAB, 0x7B, 0xC2, 0x21, 0xBA, 0xCF, 0x99, 0xB0, 0x12, 0xF3, 0x75, 0xC3,
+    0xCA, 0xCC, 0xE5, 0x34, 0x43, 0xF8, 0x87, 0x03, 0xFF, 0x82, 0xBB, 0x4D, 0x09, 0x4A, 0xBD, 0xDB,
+    0x03, 0x97, 0x90, 0x29, 0x5F, 0x7D, 0x75, 0xE9, 0x64, 0x6A, 0x2C, 0x3D, 0xAB, 0xC8, 0x96, 0x55,
+    0x48, 0x9A, 0xF0, 0x7D, 0xD2, 0x58, 0x1B, 0xEA, 0x4E, 0x0D, 0x9C, 0x07, 0xB4, 0xAD, 0x5D, 0x6C,
+    0xCC, 0xAE, 0x12, 0x8C, 0x51, 0x1D, 0xDB, 0x1B, 0xDC, 0x18, 0xAF, 0x14, 0x7C, 0x75, 0xC1, 0xF8,
+    0x23, 0x38, 0x26, 0xC8, 0x27, 0xDA, 0x36, 0xEE, 0x2D, 0xD7, 0x1D, 0xD3, 0xDB, 0x9A, 0xAF, 0x96,
+    0xF8, 0x8A, 0x29, 0x7E, 0x2C, 0x72, 0x85, 0x21, 0x1D, 0x81, 0xE0, 0x43, 0xFF, 0x77, 0x45, 0xE1,
+    0x6C, 0x59, 0xF4, 0x1F, 0xF9, 0xCD, 0xF8, 0x36, 0xEB, 0xD3, 0x41, 0x37, 0xF1, 0x48, 0x3D, 0x4B,
+    0x47, 0xE1, 0xAC, 0x7B, 0xE4, 0x75, 0xC7, 0x3D, 0xB6, 0x21, 0x6A, 0x45, 0x07, 0x75, 0xA7, 0xFF,
+    0x13, 0x4C, 0xF0, 0x3B, 0x98, 0x4C, 0x11, 0x77, 0xAA, 0x09, 0xF2, 0xB9, 0x6A, 0x38, 0x0A, 0xF9,
+    0x4E, 0x4E, 0xDE, 0x86, 0xF6, 0x2E, 0x7D, 0xB7, 0x4E, 0xAE, 0x20, 0xF7, 0xF2, 0x2D, 0xD1, 0x11,
+    0xC9, 0x0F, 0x3A, 0x85, 0x65, 0x7B, 0x56, 0x91, 0xF8, 0x7D, 0x3F, 0xBE, 0x8E, 0x40, 0xF7, 0x80,
+    0x35, 0x15, 0x6D, 0x8F, 0x70, 0xCB, 0x2A, 0x2E, 0x81, 0xBC, 0xE8, 0x7B, 0x5E, 0xF0, 0x6E, 0x6D,
+    0x3A, 0x3C, 0xBA, 0xA7, 0x9D, 0x1B, 0x77, 0x0E, 0x39, 0x2E, 0x5E, 0x9D, 0x0E, 0x98, 0x7B, 0x94,
+    0x5E, 0x88, 0xF1, 0x72, 0x2C, 0xAF, 0xD8, 0xA9, 0xBC, 0xFA, 0xCD, 0x54, 0x7E, 0xFC, 0xE9, 0x54,
+    0x7E, 0x7E, 0x75, 0x32, 0x36, 0x1A, 0xF5, 0x18, 0x0F, 0xD9, 0x98, 0x39, 0xDF, 0xE2, 0xCB, 0x95,
+    0x14, 0x48, 0x1E, 0xAF, 0x7C, 0xCB, 0x45, 0x57, 0xE1, 0x41, 0x9B, 0xA5, 0xA6, 0xC3, 0xD8, 0x39,
+    0x52, 0x73, 0x2E, 0x6F, 0xE0, 0x4F, 0x8F, 0xA2, 0xF9, 0x95, 0x66, 0xF9, 0x55, 0x39, 0x20, 0x43,
+    0x0D, 0x99, 0xBD, 0x3D, 0x24, 0xF6, 0xA3, 0xC1, 0xBB, 0xE9, 0x8C, 0xB1, 0x8C, 0x15, 0x62, 0x38,
+    0xC7, 0xB1, 0x0A, 0xDE, 0xA3, 0x90, 0xCF, 0xA5, 0x84, 0x81, 0x5C, 0xCB, 0x1D, 0x17, 0xCB, 0xAD,
+    0x19, 0x60, 0xAC, 0x5F, 0x47, 0x1C, 0x85, 0xFC, 0xA8, 0xC9, 0xA0, 0xB6, 0x29, 0x48, 0x61, 0x73,
+    0x7A, 0xED, 0x02, 0x47, 0x64, 0x9B, 0xFD, 0x75, 0x50, 0x71, 0xDF, 0x75, 0x10, 0x21, 0x30, 0x37,
+    0x55, 0x80, 0xB5, 0x5F, 0xCD, 0xFF, 0xDA, 0x68, 0x57, 0xFF, 0xB5, 0xA1, 0x3A, 0xE0, 0x4A, 0x3C,
+    0x60, 0xC6, 0x0E, 0xFC, 0xEB, 0xC6, 0xC4, 0xED, 0x1F, 0xCB, 0xF7, 0x63, 0xA6, 0x5C, 0xFD, 0xFF,
+    0x46, 0x36, 0xAD, 0xDE, 0x9F, 0x79, 0xD6, 0x89, 0x7F, 0x41, 0xE7, 0x90, 0xFF, 0x25, 0x97, 0x5D,
+    0xD9, 0xB7, 0x66, 0x33, 0xFD, 0xA5, 0x3C, 0x02, 0x56, 0xFF, 0x80, 0x22, 0xB7, 0x44, 0x29, 0xCB,
+    0x0D, 0xF3, 0x5B, 0x86, 0xB5, 0x49, 0xEF, 0x11, 0xE7, 0x20, 0xEA, 0x24, 0x1E, 0x85, 0x78, 0x8F,
+    0x6D, 0xD8, 0x96, 0xCF, 0xBC, 0xCE, 0x02, 0x79, 0xF3, 0x81, 0xB2, 0x03, 0xEE, 0x5E, 0x60, 0x30,
+    0xB5, 0x67, 0xD2, 0x25, 0x07, 0x5E, 0x21, 0x3E, 0x0D, 0x43, 0xFC, 0x17, 0xCD, 0x5B, 0xBF, 0x8F,
+    0xDC, 0xC6, 0x15, 0x1E, 0x2E, 0x7D, 0x26, 0x60, 0x16, 0x74, 0x71, 0x87, 0x00, 0x56, 0x00, 0x56,
+    0x01, 0x02, 0xA7, 0xE0, 0x5F, 0x90, 0x0C, 0x9D, 0xC0, 0x70, 0xE1, 0xC2, 0x57, 0xDC, 0x56, 0x2A,
+    0xD4, 0x3B, 0x40, 0xEE, 0x1F, 0xB0, 0x42, 0xDA, 0x2E, 0x0C, 0x44, 0x85, 0xD4, 0x24, 0xAD, 0x55,
+    0x28, 0x40, 0xBC, 0x29, 0x94, 0x22, 0x4D, 0x00, 0xCB, 0x43, 0x4B, 0x45, 0x0A, 0x17, 0xA6, 0x21,
+    0x18, 0x2E, 0x52, 0x98, 0x88, 0xED, 0x38, 0x91, 0x0B, 0x11, 0x31, 0x63, 0xF3, 0x24, 0x92, 0x93,
+    0xEF, 0x7B, 0x43, 0xEE, 0xAE, 0x64, 0xE9, 0x74, 0xF2, 0xED, 0x9D, 0xBC, 0xB7, 0xF3, 0xED, 0x1E,
+    0x39, 0x9C, 0x99, 0xF7, 0x66, 0xE6, 0xFD, 0x9C, 0x55, 0xCF, 0x2D, 0xAE, 0x28, 0xA5, 0xB4, 0xED,
+    0x96, 0xB8, 0x33, 0xDF, 0x53, 0xD3, 0xCB, 0xB7, 0x85, 0x60, 0x09, 0x0C, 0x6D, 0x05, 0x8C, 0x6C,
+    0x4D, 0xBC, 0xDB, 0x00, 0x93, 0x2F, 0x5B, 0x3E, 0x75, 0x93, 0x4F, 0x65, 0x37, 0x7A, 0xA0, 0x79,
+    0xDD, 0x02, 0x6D, 0x0A, 0xF4, 0x2C, 0x3E, 0xD5, 0xCC, 0x2A, 0x53, 0xA0, 0x81, 0x05, 0x1A, 0x0A,
+    0xAC, 0x45, 0x13, 0x21, 0xB0, 0x46, 0x33, 0xC4, 0xB8, 0x51, 0x51, 0xAB, 0x34, 0xFE, 0xED, 0x94,
+    0xAE, 0x54, 0xD0, 0xAB, 0xAC, 0x54, 0xFE, 0xA0, 0x2C, 0x1F, 0x51, 0xB3, 0xC5, 0x22, 0xF5, 0xAD,
+    0xCD, 0x59, 0xBC, 0xF9, 0x5C, 0x06, 0x34, 0xB3, 0x03, 0x9F, 0x2D, 0xD0, 0x4A, 0xED, 0x5F, 0x4A,
+    0x30, 0x96, 0xA8, 0x91, 0xB2, 0x6F, 0x1B, 0x5C, 0x6F, 0xB4, 0xBD, 0xDA, 0x98, 0x32, 0x6A, 0x6C,
+    0x81, 0x92, 0xC7, 0xF8, 0x9E, 0x35, 0x99, 0x5C, 0xFF, 0xB6, 0x09, 0xED, 0x9B, 0x8D, 0xDA, 0x45,
+    0x23, 0xDB, 0x6A, 0x07, 0xF8, 0x0B, 0xA5, 0x49, 0xC3, 0xDD, 0x5E, 0xA8, 0x6A, 0x85, 0x4E, 0x52,
+    0x88, 0xDB, 0x3F, 0x0C, 0xFA, 0xB7, 0x52, 0x6F, 0x37, 0x28, 0x83, 0xD2, 0x1F, 0x4C, 0xE1, 0x59,
+    0x34, 0x96, 0xA1, 0x0B, 0x2F, 0xDD, 0x1C, 0x1F, 0x9E, 0x28, 0x75, 0x78, 0x79, 0xAD, 0xF0, 0x58,
+    0x98, 0x1E, 0x72, 0x28, 0x2A, 0x72, 0x28, 0x77, 0x03, 0x41, 0xF5, 0xB7, 0x0D, 0xD1, 0x1B, 0x80,
+    0xCA, 0x38, 0x57, 0x32, 0xE9, 0x52, 0xD0, 0x79, 0x0C, 0xDA, 0x9E, 0xFE, 0x1C, 0x03, 0xE1, 0xE2,
+    0x0A, 0x49, 0x28, 0x5B, 0x56, 0x19, 0xAA, 0xA9, 0x81, 0xDD, 0xEE, 0x4E, 0x0B, 0xE1, 0x69, 0x7B,
+    0x80, 0xEB, 0x5C, 0x88, 0x20, 0x2D, 0x0D, 0xEC, 0x2D, 0xAB, 0xA2, 0x41, 0x6D, 0xA9, 0x58, 0x78,
+    0xC4, 0x87, 0x34, 0xC9, 0xD0, 0x64, 0x65, 0x26, 0x50, 0x2C, 0xBF, 0x95, 0xCB, 0xBB, 0xAC, 0x97,
+    0x90, 0xB7, 0x51, 0xAF, 0x3C, 0xF0, 0xEA, 0x0B, 0x03, 0x4E, 0x58, 0xD0, 0x69, 0x08, 0x67, 0x2C,
+    0x99, 0xCC, 0xA5, 0xA9, 0x76, 0x30, 0xCB, 0x36, 0x27, 0xB3, 0x54, 0x88, 0xFA, 0x49, 0x31, 0x5E,
+    0x67, 0x73, 0x96, 0x9B, 0xA2, 0x00, 0xD1, 0x79, 0xD2, 0x9F, 0x95, 0x36, 0xD9, 0x03, 0xE6, 0xE1,
+    0x9E, 0xC2, 0xFE, 0xD9, 0xA9, 0xEE, 0xCF, 0xB2, 0x6E, 0x81, 0xE9, 0x29, 0x94, 0x19, 0xC6, 0x05,
+    0x34, 0x97, 0x79, 0xCF, 0xC9, 0x6A, 0x3C, 0x9B, 0xFC, 0x03, 0x7D, 0x18, 0x0F, 0xBD, 0xEF, 0x2D,
+    0x17, 0xFF, 0xE9, 0x12, 0xBC, 0x03, 0x46, 0x67, 0xA8, 0x07, 0x01, 0xE4, 0x77, 0xE8, 0xA9, 0x4A,
+    0x8A, 0x2D, 0xAC, 0xFF, 0xCD, 0x11, 0x2C, 0xAF, 0x41, 0x16, 0x92, 0x92, 0xD5, 0x3B, 0xCD, 0xB0,
+    0x7A, 0x42, 0x33, 0x8C, 0x57, 0x5C, 0xBA, 0x07, 0x58, 0xF8, 0x5D, 0x6D, 0x70, 0x86, 0xF7, 0xD8,
+    0x8B, 0xC1, 0x9F, 0x4A, 0xB8, 0x81, 0x43, 0xEE, 0x6B, 0xB7, 0xD1, 0xE7, 0xE9, 0x93, 0x20, 0x98,
+    0xB2, 0x2C, 0xAA, 0xE2, 0xCA, 0xEF, 0x4C, 0xAE, 0xB0, 0x97, 0x55, 0xD6, 0xB9, 0x59, 0xDF, 0x10,
+    0xC1, 0xDE, 0x2E, 0x48, 0x9E, 0x75, 0x3E, 0xC6, 0x6E, 0xCF, 0x91, 0xA7, 0x14, 0x6D, 0x22, 0x47,
+    0xBC, 0xBD, 0x25, 0x5B, 0xFF, 0x23, 0xA3, 0x2A, 0x09, 0x2D, 0x61, 0x40, 0xB3, 0xA1, 0x4D, 0x29,
+    0x5D, 0x0B, 0x74, 0x60, 0x4A, 0x40, 0x56, 0x01, 0xB4, 0x40, 0xBD, 0x84, 0xE5, 0xB5, 0x8C, 0x55,
+    0x4C, 0x31, 0x3E, 0xC1, 0x67, 0x6F, 0xB1, 0x95, 0xB1, 0x3D, 0xB6, 0x7C, 0xB0, 0xA6, 0x3C, 0xFA,
+    0xA4, 0x14, 0x2C, 0x88, 0x3A, 0x15, 0x94, 0xEB, 0x3F, 0x15, 0xE4, 0x3A, 0xBC, 0xD9, 0x73, 0x72,
+    0xBE, 0x05, 0xC6, 0x96, 0xBC, 0xD2, 0x07, 0xFB, 0xC4, 0x2A, 0xEC, 0x49, 0x2F, 0xEB, 0x98, 0x87,
+    0xA0, 0xBB, 0xAB, 0xAB, 0x60, 0xF9, 0x94, 0x6B, 0x21, 0xB4, 0xDF, 0xF4, 0x5C, 0xE6, 0x1F, 0x91,
+    0xF3, 0x4F, 0x39, 0x41, 0x3A, 0xE4, 0x14, 0xCF, 0xBD, 0xC8, 0xE8, 0x5C, 0x04, 0x75, 0xD0, 0x29,
+    0xD3, 0x00, 0xE2, 0x0E, 0x10, 0xF6, 0x80, 0x60, 0x80, 0x00, 0xF4, 0x87, 0xCC, 0x76, 0xBE, 0x5D,
+    0xC2, 0xF0, 0xB3, 0xE1, 0x8A, 0x3F, 0xF0, 0x2E, 0xAB, 0x84, 0xDD, 0xF4, 0x04, 0x9E, 0x1D, 0xAE,
+    0xA2, 0x95, 0xB1, 0x3D, 0x69, 0xF9, 0xD2, 0x8A, 0xEE, 0x11, 0x02, 0xB2, 0x24, 0x1C, 0xD5, 0x42,
+    0xE5, 0xAE, 0x3D, 0x05, 0x98, 0xD9, 0xCF, 0x7A, 0x5C, 0x82, 0xE6, 0x4D, 0xF8, 0xAC, 0x8C, 0x3E,
+    0xAB, 0x43, 0xEA, 0x07, 0xDC, 0x15, 0xF2, 0x1C, 0xF0, 0x5F, 0xB9, 0x96, 0xD5, 0x01, 0xEB, 0x9D,
+    0x1B, 0x9F, 0x88, 0xC8, 0xB1, 0x99, 0xBD, 0xDE, 0x3B, 0x0A, 0x9F, 0x59, 0xBC, 0x83, 0x4B, 0x83,
+    0x94, 0xAD, 0xD1, 0x7A, 0xE1, 0xC2, 0x5E, 0x2B, 0x69, 0x36, 0x2E, 0xA0, 0x65, 0xB9, 0xB5, 0x60,
+    0x9D, 0x55, 0xB9, 0xFF, 0xBE, 0xAB, 0x93, 0xAE, 0xB7, 0xF3, 0x20, 0x83, 0x44, 0x99, 0x5E, 0x8D,
+    0x8B, 0xB7, 0x4E, 0x9A, 0xB8, 0xD1, 0x65, 0xD0, 0x61, 0x6A, 0x3A, 0x2C, 0x87, 0x55, 0x59, 0x5B,
+    0xBC, 0x49, 0xAB, 0xFE, 0xC2, 0xBA, 0x3E, 0x35, 0xA4, 0xE1, 0x8E, 0xDC, 0xC5, 0xFE, 0xD8, 0x4A,
+    0x63, 0x15, 0xA7, 0xD1, 0x1D, 0x0B, 0x9E, 0x61, 0x1F, 0x59, 0x6C, 0xA8, 0x2D, 0x75, 0x62, 0x74,
+    0x1C, 0x66, 0x58, 0x6C, 0x82, 0x1E, 0x79, 0xE9, 0x7C, 0xB5, 0x73, 0xF9, 0x5D, 0x9D, 0x1C, 0x3D,
+    0xD2, 0x70, 0x54, 0x39, 0xED, 0x2D, 0xB6, 0x41, 0xB5, 0xDA, 0x85, 0x1B, 0xA0, 0xE7, 0x64, 0xC6,
+    0x7C, 0x1E, 0x3C, 0xC7, 0x3C, 0xFB, 0xF5, 0x58, 0x70, 0x6D, 0xC6, 0xEB, 0xBF, 0x49, 0x8F, 0x3D,
+    0xEE, 0x8C, 0xBB, 0x6D, 0x7F, 0x34, 0x76, 0xDE, 0x45, 0xA1, 0x69, 0x63, 0x2F, 0xA3, 0x36, 0x55,
+    0x4D, 0xC5, 0xF5, 0x96, 0x14, 0x3A, 0x8F, 0xFE, 0x37, 0xA0, 0x0F, 0xDC, 0xA3, 0x76, 0xD8, 0x49,
+    0x4F, 0x74, 0xBD, 0x85, 0x75, 0x54, 0xCF, 0x7A, 0xDC, 0xA5, 0x5A, 0xD0, 0xE8, 0x73, 0x6B, 0x77,
+    0x83, 0xEB, 0x8D, 0x4A, 0xCD, 0xE3, 0x3F, 0x3E, 0x49, 0x89, 0xBE, 0xEE, 0xB8, 0xE6, 0x0C, 0x35,
+    0xCF, 0xA4, 0x6C, 0x61, 0x40, 0xA6, 0x14, 0x1E, 0x15, 0x06, 0x60, 0x0B, 0xDF, 0xDE, 0x31, 0xE8,
+    0x32, 0xF5, 0xD2, 0x78, 0x69, 0xF5, 0x39, 0x95, 0xE7, 0xD4, 0xDB, 0x73, 0x8B, 0xCB, 0x59, 0x19,
+    0xDB, 0x5A, 0x40, 0x0B, 0x54, 0xA8, 0x85, 0x2A, 0x09, 0x46, 0x09, 0x80, 0xB6, 0x4B, 0x6A, 0x6A,
+    0x3B, 0x0E, 0x44, 0x46, 0x02, 0x38, 0xC3, 0x3E, 0xA4, 0x47, 0x12, 0x47, 0x22, 0xA1, 0x9D, 0x40,
+    0x74, 0x1A, 0x34, 0x71, 0x49, 0x26, 0x88, 0xD1, 0x0B, 0xC9, 0x1C, 0xDA, 0x3B, 0x3D, 0xA5, 0x35,
+    0x25, 0x1F, 0x65, 0x3D, 0x65, 0xB9, 0xB9, 0xAF, 0xF0, 0x1A, 0xA5, 0xBB, 0x6E, 0x63, 0xA9, 0x4B,
+    0x79, 0x39, 0xA3, 0xBE, 0x78, 0x4A, 0x44, 0x6B, 0xF7, 0x2C, 0xCC, 0xEA, 0xE4, 0x8F, 0xA6, 0x4D,
+    0xC8, 0x38, 0x90, 0x24, 0xEA, 0x7C, 0x87, 0x62, 0x23, 0x81, 0x28, 0x81, 0x0D, 0x6F, 0xA9, 0x0B,
+    0x44, 0xC9, 0x90, 0xB0, 0x2D, 0xF5, 0x24, 0x18, 0xE1, 0x81, 0x68, 0xBF, 0xF4, 0x2B, 0xDF, 0x9A,
+    0x52, 0x71, 0xD5, 0xEB, 0x95, 0xA4, 0x39, 0x51, 0x46, 0xAC, 0x64, 0x90, 0x08, 0x20, 0x07, 0x3A,
+    0x5D, 0x37, 0xF8, 0x4E, 0x77, 0x45, 0x88, 0x88, 0xE2, 0xEE, 0x6B, 0x5C, 0x09, 0x57, 0x22, 0xEA,
+    0xE4, 0x19, 0x71, 0xFA, 0xA4, 0xA2, 0x31, 0xB1, 0x16, 0xC9, 0x71, 0xA3, 0x46, 0x09, 0xA4, 0xF6,
+    0x46, 0xA0, 0xE3, 0xE7, 0x83, 0x09, 0x41, 0xED, 0x98, 0x32, 0xCA, 0x82, 0x13, 0x65, 0x84, 0xD8,
+    0x81, 0x21, 0x2D, 0xC2, 0x84, 0x52, 0x36, 0x3B, 0x57, 0x29, 0xAF, 0x0F, 0x1A, 0x67, 0x39, 0x3A,
+    0xD1, 0x57, 0xA8, 0xA4, 0x3A, 0x0A, 0xDC, 0x5A, 0x98, 0x2A, 0xA3, 0x15, 0xB5, 0x06, 0x47, 0x7D,
+    0x96, 0x30, 0x8A, 0xAB, 0x62, 0x12, 0x57, 0x9F, 0x89, 0xB8, 0xB2, 0x53, 0x60, 0x42, 0x5E, 0xA2,
+    0xD5, 0x1E, 0x0E, 0x2F, 0x43, 0x6B, 0xDB, 0xCC, 0x4D, 0x68, 0xA3, 0xEC, 0x41, 0xD6, 0x2A, 0x5B,
+    0xC2, 0xCF, 0x86, 0x87, 0x0C, 0xC8, 0x1F, 0x13, 0x60, 0xD1, 0xCD, 0x06, 0x30, 0x8E, 0x0E, 0xA7,
+    0x43, 0xCB, 0x57, 0xB3, 0x8E, 0xEB, 0x77, 0x83, 0x61, 0xF1, 0xE7, 0x41, 0xAC, 0xC9, 0xFB, 0x70,
+    0xBD, 0xCE, 0x91, 0x51, 0x5E, 0x61, 0x3B, 0x81, 0x15, 0x8D, 0xB4, 0x84, 0xF1, 0xC6, 0x16, 0xC1,
+    0xB4, 0x2A, 0xBC, 0x0B, 0x05, 0xC2, 0x28, 0x43, 0x1A, 0xDA, 0x5F, 0x82, 0x5A, 0x9A, 0x8A, 0xA0,
+    0x22, 0x1B, 0xA1, 0x3D, 0x1A, 0x88, 0xBD, 0x90, 0xE8, 0xE1, 0x3D, 0x63, 0xBB, 0x36, 0x6E, 0x76,
+    0x45, 0x24, 0x45, 0xB6, 0x77, 0x6F, 0x0F, 0x7C, 0x15, 0x3B, 0xFF, 0xD1, 0x6F, 0x30, 0x7D, 0x7A,
+    0x4A, 0x4C, 0xED, 0x26, 0x4A, 0x63, 0x6B, 0xE0, 0x7E, 0x0C, 0xEA, 0x35, 0x8C, 0x68, 0x5B, 0xA5,
+    0xAB, 0xE9, 0x3C, 0x46, 0x79, 0x7E, 0x71, 0x45, 0xDB, 0x16, 0xEF, 0x9D, 0xF9, 0xAE, 0x04, 0xEA,
+    0x1A, 0xF7, 0x0E, 0x60, 0x94, 0x5A, 0x75, 0x94, 0xB7, 0x6F, 0xD3, 0xE5, 0x53, 0xAF, 0x62, 0x83,
+    0x63, 0x7B, 0xDB, 0xDA, 0xB5, 0x86, 0x29, 0x78, 0xAC, 0xF7, 0x9E, 0xDA, 0x7E, 0x57, 0x9D, 0xD7,
+    0xB7, 0xBB, 0x84, 0x03, 0x28, 0x5C, 0xC8, 0xE0, 0x98, 0x43, 0x42, 0x9B, 0x9D, 0x7A, 0x37, 0xBB,
+    0x0D, 0x1A, 0x21, 0x59, 0x72, 0xD7, 0xE6, 0xE3, 0x0E, 0xEC, 0x98, 0x63, 0x60, 0xF4, 0x29, 0x51,
+    0xEA, 0xB7, 0x4A, 0xBD, 0x27, 0xD1, 0x08, 0xDD, 0xA8, 0x67, 0x60, 0x33, 0x25, 0xA5, 0xAE, 0x74,
+    0x15, 0x4B, 0x64, 0x8A, 0xDF, 0x0E, 0xFB, 0x8B, 0x72, 0xAD, 0xAE, 0x29, 0xAC, 0x49, 0x48, 0x4B,
+    0x3E, 0xCB, 0x20, 0x83, 0xEB, 0x48, 0xF5, 0x93, 0x5C, 0x3C, 0xDE, 0x20, 0x6D, 0x7E, 0xF8, 0x1F,
+    0xAA, 0x84, 0xED, 0x0A, 0xD0, 0x49, 0xD8, 0xA2, 0x89, 0xE3, 0x01, 0x06, 0xB0, 0xDE, 0xA8, 0x00,
+    0x37, 0x0C, 0x81, 0xCA, 0xEC, 0x39, 0x43, 0xCD, 0x46, 0xA3, 0x33, 0xE6, 0x82, 0x8D, 0xFB, 0x95,
+    0x96, 0x4D, 0xCA, 0x10, 0xEA, 0x23, 0x6A, 0x59, 0xE2, 0x22, 0xAC, 0x97, 0xEA, 0xA1, 0x8A, 0x9A,
+    0xE3, 0x94, 0x65, 0x00, 0x90, 0xE5, 0x69, 0xF4, 0xCF, 0x10, 0x47, 0xC8, 0x38, 0xE4, 0x30, 0x9A,
+    0x5F, 0x0C, 0x05, 0xC0, 0x4B, 0xEC, 0x4C, 0x1A, 0xD6, 0x49, 0x01, 0xF3, 0xCB, 0x6D, 0xC5, 0xB8,
+    0xDE, 0x7C, 0xA1, 0x0A, 0x85, 0x8E, 0x7C, 0x1E, 0x16, 0x28, 0x03, 0x0F, 0xDA, 0xBA, 0xEE, 0xE5,
+    0x35, 0x77, 0xA2, 0x3E, 0x60, 0x58, 0x14, 0x82, 0x5E, 0xE7, 0xC3, 0x4A, 0xCC, 0xDB, 0xF4, 0xD8,
+    0x92, 0xC1, 0x95, 0x54, 0xFD, 0x1A, 0xC5, 0x58, 0x31, 0xA7, 0x55, 0x56, 0x89, 0x32, 0x33, 0x45,
+    0x56, 0xCC, 0x68, 0xC1, 0x33, 0xF2, 0x5A, 0xC4, 0x94, 0x7B, 0xD0, 0xE1, 0x59, 0x81, 0xD1, 0x64,
+    0xD7, 0xE9, 0xF5, 0xFD, 0x9D, 0x71, 0x98, 0x0F, 0x5B, 0x1A, 0xFD, 0x0C, 0xB9, 0x58, 0xF9, 0xC6,
+    0xE7, 0x69, 0x3B, 0x66, 0x1F, 0xA1, 0xE5, 0xAC, 0x80, 0xDD, 0x36, 0x3E, 0x26, 0x0D, 0x44, 0x94,
+    0xB2, 0x3E, 0xCD, 0x7E, 0x69, 0x59, 0x49, 0x04, 0x79, 0x7A, 0x31, 0x54, 0xA9, 0x64, 0x8A, 0xC5,
+    0x01, 0x93, 0x60, 0xEE, 0xD2, 0xEE, 0x34, 0xF9, 0xE1, 0x40, 0x49, 0x9E, 0xC3, 0xBC, 0x30, 0x79,
+    0x56, 0x32, 0xD2, 0x9C, 0x2B, 0xF3, 0x16, 0xC6, 0x67, 0x2E, 0x62, 0x54, 0x86, 0xEB, 0xCB, 0x58,
+    0x01, 0xFE, 0xCB, 0x41, 0x9A, 0x9B, 0xA4, 0x36, 0x67, 0x3D, 0x79, 0x22, 0xC7, 0x24, 0x98, 0x1C,
+    0xE3, 0x33, 0x79, 0x70, 0x4F, 0x64, 0x8F, 0x41, 0x18, 0x89, 0xA0, 0x3A, 0xFB, 0x4F, 0x4F, 0x21,
+    0x7E, 0xD4, 0x63, 0x97, 0x11, 0xBB, 0xC4, 0xE4, 0xB9, 0xA6, 0xDE, 0x60, 0xA3, 0x17, 0x68, 0xB9,
+    0xBF, 0x2D, 0xBD, 0x55, 0x04, 0x46, 0x47, 0xA9, 0x8A, 0xCC, 0x67, 0x87, 0x76, 0x39, 0x57, 0x12,
+    0xD7, 0xE6, 0xD6, 0x48, 0x2A, 0x67, 0xFB, 0x4C, 0xD1, 0xD4, 0xAC, 0xF8, 0x6E, 0x38, 0xEB, 0xB1,
+    0xCB, 0xAD, 0xC5, 0x25, 0x06, 0x99, 0xA6, 0x42, 0x2B, 0xC2, 0xE6, 0x10, 0x7B, 0xA0, 0x00, 0xE4,
+    0xED, 0x8C, 0xDB, 0xEA, 0xB8, 0xEF, 0x13, 0x19, 0xEA, 0xBA, 0x51, 0x28, 0x25, 0x15, 0x39, 0x3B,
+    0xAA, 0x8E, 0xEA, 0xE8, 0x7F, 0xB2, 0x83, 0x21, 0x8C, 0x13, 0x08, 0xDA, 0x1D, 0xAE, 0xC7, 0x1A,
+    0xA6, 0x6C, 0x65, 0x8A, 0xB8, 0x30, 0xB8, 0x86, 0xB2, 0x89, 0xB1, 0xDA, 0xB7, 0x5A, 0x7B, 0xA1,
+    0xB6, 0x17, 0x2A, 0x7B, 0xB1, 0xB0, 0xBF, 0x4B, 0x31, 0xDF, 0x8F, 0xFB, 0x7E, 0x34, 0x13, 0x0D,
+    0x8A, 0xCD, 0x5D, 0xC9, 0x8E, 0x3C, 0xB0, 0x43, 0x3A, 0xBD, 0x58, 0xD9, 0xAB, 0x35, 0xDF, 0x17,
+    0xCB, 0x43, 0xAA, 0xC1, 0xE2, 0x7A, 0x48, 0x49, 0x45, 0x44, 0x05, 0x58, 0xEC, 0x22, 0xAA, 0x28,
+    0x1F, 0xB8, 0xE4, 0x3B, 0xE7, 0xC8, 0xFE, 0x68, 0xBD, 0xEE, 0xB0, 0x78, 0x87, 0x41, 0xBF, 0xA9,
+    0xD0, 0xC1, 0x18, 0x1E, 0xF2, 0xA6, 0x8E, 0x2B, 0x67, 0x74, 0xD7, 0xCB, 0xC4, 0x2A, 0x3D, 0xA8,
+    0x78, 0x50, 0xE1, 0x83, 0x6A, 0x8E, 0x06, 0x7A, 0x74, 0x4F, 0x12, 0xC6, 0xEB, 0xD7, 0x93, 0x30,
+    0x50, 0xC9, 0xB3, 0x2E, 0x63, 0x86, 0x20, 0x1B, 0x08, 0x56, 0x20, 0x27, 0x94, 0x80, 0xAC, 0x06,
+    0x9C, 0x6B, 0x00, 0x2F, 0x77, 0x80, 0x37, 0x07, 0xC0, 0x1B, 0x16, 0x90, 0xDB, 0x1B, 0x80, 0xEC,
+    0x26, 0x40, 0x7F, 0x0D, 0x88, 0xBF, 0x01, 0x84, 0x16, 0xE0, 0x13, 0x66, 0x04, 0x25, 0x90, 0x11,
+    0x48, 0xAE, 0xE4, 0x5F, 0x8A, 0x55, 0xFE, 0xA5, 0x5C, 0x7A, 0x36, 0x43, 0x68, 0x53, 0xAB, 0x6D,
+    0x25, 0x86, 0x31, 0xCC, 0x6E, 0x5A, 0xDD, 0x34, 0xBA, 0x6D, 0x1E, 0x1C, 0xA9, 0x9C, 0x22, 0x11,
+    0xAB, 0xD7, 0x32, 0xDD, 0xE1, 0xF1, 0xF2, 0x8C, 0xAA, 0xC9, 0xDB, 0xDD, 0x0C, 0x3D, 0xCB, 0x3E,
+    0xA2, 0x31, 0x8B, 0x41, 0x49, 0xAB, 0xC7, 0x2C, 0xC7, 0x98, 0x85, 0x40, 0xF7, 0xC9, 0x27, 0xDD,
+    0x98, 0x5D, 0x74, 0x49, 0xC7, 0xF9, 0x69, 0xCF, 0xE9, 0x61, 0x09, 0x88, 0xE3, 0xF2, 0x40, 0xF4,
+    0x9E, 0xD8, 0x22, 0x8E, 0x0D, 0x14, 0x51, 0x82, 0xA2, 0x1C, 0x93, 0x1B, 0x0D, 0xFA, 0xD2, 0xBF,
+    0x3A, 0x80, 0xCF, 0xB2, 0x43, 0x87, 0x99, 0xE9, 0xCF, 0x8F, 0xB1, 0x9F, 0xA9, 0x46, 0x25, 0x21,
+    0x0A, 0xB1, 0x06, 0xC7, 0x95, 0xD8, 0x7D, 0x0F, 0x5C, 0x63, 0xE1, 0x7D, 0xDC, 0x33, 0xE4, 0xDE,
+    0x7E, 0x0B, 0x78, 0xA5, 0x07, 0xBC, 0x64, 0x85, 0x7B, 0x64, 0x9C, 0x25, 0xE3, 0xB2, 0xFF, 0x02,
+    0x92, 0x01, 0x10, 0x3D, 0x88, 0x71, 0x9A, 0x10, 0x13, 0x22, 0x82, 0xCF, 0xA9, 0x5E, 0xC2, 0xD6,
+    0x3E, 0xD3, 0xA7, 0x56, 0xCC, 0x3E, 0x26, 0x56, 0xD7, 0x34, 0xEE, 0xBD, 0xDC, 0xDC, 0x5F, 0xE3,
+    0xE6, 0xD1, 0x8A, 0xCB, 0xC4, 0xB2, 0x40, 0x18, 0xCC, 0xAE, 0xB6, 0xE0, 0x53, 0x23, 0xA9, 0x79,
+    0x58, 0x1C, 0xEA, 0x99, 0xC5, 0x9F, 0xC8, 0x58, 0x11, 0x3A, 0x0E, 0xB7, 0xD6, 0x8E, 0x2B, 0x84,
+    0x92, 0xC6, 0x37, 0x56, 0x42, 0xA9, 0x56, 0x0C, 0xC2, 0x5B, 0xB8, 0x14, 0xF5, 0xCC, 0xF4, 0x26,
+    0x2D, 0x6D, 0x43, 0x98, 0x32, 0xE0, 0xBB, 0x66, 0x6B, 0xE4, 0xBE, 0x07, 0x2B, 0xE6, 0x21, 0xE8,
+    0xEA, 0xB8, 0xFA, 0xB0, 0x4B, 0xF0, 0xAC, 0x6B, 0x27, 0xB4, 0xFF, 0xB2, 0xAD, 0x72, 0x91, 0x0F,
+    0xD7, 0x97, 0x3A, 0xE3, 0x22, 0x2D, 0x5C, 0xF2, 0xDE, 0x62, 0x01, 0x26, 0xDA, 0x82, 0x45, 0xCD,
+    0xC7, 0x64, 0x9B, 0x61, 0x9C, 0x95, 0xAE, 0xA2, 0xAD, 0x93, 0x36, 0xEE, 0x18, 0xBB, 0x80, 0x15,
+    0x35, 0x18, 0x29, 0x33, 0xEB, 0x8A, 0x3F, 0xF0, 0x1A, 0xEF, 0xB1, 0x0E, 0x93, 0xDA, 0xBE, 0xA4,
+    0x94, 0xC6, 0x8C, 0x9E, 0x84, 0xF6, 0xE0, 0x9F, 0x24, 0xF8, 0x1E, 0xD3, 0x40, 0xC3, 0x40, 0x64,
+    0x37, 0x4B, 0x78, 0x6F, 0x65, 0x67, 0xFD, 0x30, 0xB8, 0x90, 0xAA, 0x5D, 0xBF, 0xF2, 0xEB, 0x99,
+    0x8B, 0xFB, 0xC1, 0xAF, 0x5A, 0x4B, 0xC4, 0x6E, 0x82, 0x1B, 0xDE, 0xDE, 0x8E, 0x38, 0x20, 0xB4,
+    0xA0, 0xE3, 0x7F, 0x72, 0x1D, 0xE8, 0xB7, 0xB8, 0xFF, 0xAE, 0x89, 0xD1, 0xB9, 0xFB, 0xC3, 0xE2,
+    0x86, 0x9A, 0xC3, 0x21, 0xB1, 0x71, 0xED, 0xF7, 0xBA, 0x08, 0x6A, 0x3C, 0xF3, 0x7E, 0xAB, 0xB6,
+    0x36, 0xC9, 0x8D, 0x25, 0xA9, 0x72, 0x06, 0xC3, 0xC8, 0x87, 0x2F, 0x61, 0x9B, 0x8A, 0xD4, 0xE2,
+    0x23, 0xEA, 0x5D, 0xF4, 0xBC, 0x71, 0x19, 0xD4, 0xDA, 0x7D, 0x54, 0xEE, 0x03, 0x5E, 0xCB, 0x9D,
+    0x05, 0x2D, 0x5A, 0x8D, 0xA9, 0xBA, 0xF7, 0x83, 0xF7, 0xD6, 0x6A, 0xD6, 0xEB, 0xAD, 0xB8, 0x63,
+    0x1D, 0xE8, 0xF5, 0x0F, 0xE6, 0xCE, 0xE2, 0xD2, 0xD8, 0xDF, 0xD8, 0x3B, 0x93, 0x91, 0x92, 0xF3,
+    0xDB, 0x5E, 0xD7, 0x43, 0xA6, 0xF7, 0xC0, 0x26, 0xD8, 0x0C, 0x9F, 0x5A, 0x2B, 0x87, 0x44, 0xD0,
+    0x43, 0x72, 0xB0, 0x8F, 0x6E, 0x60, 0xDA, 0x05, 0xB8, 0x54, 0x8B, 0x73, 0x41, 0xA3, 0x8E, 0xCD,
+    0x35, 0x24, 0x7E, 0xFD, 0x43, 0x82, 0x45, 0x52, 0x45, 0x32, 0x9F, 0x9C, 0xFC, 0xE4, 0x20, 0xB1,
+    0x95, 0x57, 0xBA, 0xC6, 0x4A, 0x5F, 0x9A, 0x26, 0x63, 0x3C, 0x4E, 0x02, 0x13, 0xC3, 0xE9, 0x78,
+    0x9C, 0x42, 0x5C, 0x15, 0x69, 0x40, 0x7C, 0x57, 0x49, 0xB8, 0xEF, 0xAC, 0xB2, 0x52, 0x57, 0xC6,
+    0x79, 0x93, 0x58, 0xA6, 0xB9, 0x05, 0x91, 0x03, 0xA3, 0xB2, 0x73, 0xC1, 0xA5, 0x75, 0x80, 0xCF,
+    0x6B, 0x3E, 0x36, 0xF5, 0x94, 0xEE, 0xA5, 0x87, 0x22, 0xF0, 0x3E, 0xFD, 0x2F, 0xC9, 0x22, 0x17,
+    0x74, 0x26, 0x0A, 0x7A, 0x32, 0xF4, 0x96, 0x4C, 0x11, 0x30, 0xCD, 0xEC, 0xCB, 0x49, 0x19, 0x0C,
+    0x61, 0x6B, 0x8F, 0x09, 0x76, 0xB0, 0xD5, 0xA6, 0x90, 0xA3, 0x4E, 0x0B, 0x0F, 0x61, 0x6B, 0x93,
+    0xD6, 0x9A, 0x86, 0x12, 0xB3, 0x61, 0xAD, 0x47, 0x58, 0x97, 0xA7, 0x36, 0xDA, 0xFB, 0x7C, 0x3B,
+    0x51, 0x6E, 0x51, 0x39, 0xA9, 0xB6, 0x71, 0x97, 0xE9, 0x37, 0x06, 0xFD, 0xC1, 0xA0, 0x6F, 0xF7,
+    0xDA, 0xF6, 0xBA, 0x1F, 0x17, 0xC9, 0x21, 0xEF, 0xF1, 0xF4, 0x43, 0xC5, 0x46, 0x92, 0x9C, 0xC6,
+    0xC2, 0x78, 0x40, 0x00, 0x6E, 0x63, 0x44, 0xA5, 0x46, 0xD3, 0xCF, 0xCA, 0x1C, 0x77, 0x6A, 0x75,
+    0x4A, 0xE0, 0xF4, 0xC8, 0xDE, 0x06, 0x65, 0x3A, 0xCF, 0x52, 0x0A, 0x16, 0x1A, 0xC4, 0x33, 0x2E,
+    0xE4, 0x51, 0x94, 0x83, 0x58, 0x05, 0x6A, 0x15, 0xC8, 0xC5, 0x06, 0xE9, 0x25, 0xA1, 0xA1, 0x6B,
+    0x35, 0xED, 0x92, 0x47, 0x96, 0xA5, 0x9B, 0x18, 0xAD, 0xB9, 0x89, 0x93, 0x06, 0xC3, 0x7E, 0x66,
+    0xA6, 0x1C, 0x7B, 0xA7, 0xD4, 0x77, 0xE0, 0x17, 0x94, 0xDE, 0x32, 0xFF, 0x26, 0x7D, 0x0C, 0xB4,
+    0xA1, 0xC0, 0x21, 0x71, 0xD2, 0x69, 0xCD, 0x53, 0xF7, 0x9A, 0x31, 0xF1, 0x19, 0xD7, 0x97, 0xF1,
+    0x69, 0x7E, 0x2F, 0xDE, 0x42, 0xC1, 0xE3, 0x17, 0x09, 0x3D, 0x57, 0x6E, 0x40, 0x9E, 0x6F, 0xA2,
+    0x87, 0x4A, 0x13, 0x85, 0x41, 0x7E, 0xAB, 0x96, 0x7D, 0x32, 0x36, 0x9E, 0x48, 0x2E, 0x0F, 0x1C,
+    0xC8, 0x7F, 0x2C, 0xDE, 0xB8, 0x61, 0x35, 0xB0, 0x2A, 0x16, 0xDA, 0x07, 0x46, 0xCC, 0x19, 0xC4,
+    0xA0, 0x4D, 0x9C, 0xFE, 0x15, 0x9F, 0x6C, 0x9B, 0x3E, 0xB8, 0xA4, 0x19, 0xF7, 0xC6, 0xFD, 0x05,
+    0x76, 0x7B, 0x50, 0x48, 0xC1, 0x01, 0x6C, 0xFC, 0x52, 0xE7, 0xCB, 0xE3, 0x3B, 0x27, 0x45, 0xD3,
+    0x9C, 0xAA, 0xCF, 0xC5, 0x55, 0xE2, 0x2F, 0x5B, 0xB0, 0x71, 0x15, 0x57, 0xD9, 0x08, 0x4D, 0x27,
+    0x35, 0x76, 0x3D, 0xE6, 0xA5, 0x62, 0x97, 0xF7, 0xF5, 0xCE, 0x92, 0x6F, 0x95, 0x1B, 0xCA, 0x26,
+    0xC6, 0x7E, 0x4D, 0x49, 0xFC, 0x52, 0xED, 0x17, 0xB2, 0x55, 0x67, 0xFB, 0xA5, 0x98, 0xDC, 0x94,
+    0x7C, 0x5B, 0x90, 0x86, 0x71, 0x99, 0x14, 0x01, 0xD4, 0xA6, 0x27, 0x31, 0x94, 0x76, 0xB5, 0xBD,
+    0x4E, 0x68, 0x9E, 0x0E, 0xDB, 0x4B, 0x9B, 0x98, 0x27, 0x66, 0x5F, 0x04, 0xD2, 0x25, 0x8C, 0x81,
+    0xC9, 0x4D, 0x83, 0x2F, 0xC7, 0x24, 0x3F, 0xA7, 0xC9, 0x25, 0x6E, 0x29, 0x99, 0xFC, 0x93, 0x61,
+    0x92, 0x52, 0xDC, 0xCA, 0xA4, 0xB7, 0xA3, 0x8F, 0x35, 0xA3, 0x45, 0x30, 0x68, 0x3B, 0x80, 0xB2,
+    0x33, 0xFD, 0x1E, 0xCF, 0xCF, 0x7C, 0xE7, 0x0D, 0xE9, 0xEF, 0xDB, 0x17, 0x7D, 0x0B, 0x4D, 0x35,
+    0x28, 0x38, 0x3F, 0x41, 0xC9, 0x9C, 0xE0, 0xD3, 0x1D, 0x1B, 0x46, 0xB3, 0x9A, 0xCA, 0x55, 0x72,
+    0x53, 0x7E, 0x1B, 0xF0, 0x64, 0x1C, 0x3B, 0xD0, 0x12, 0x5D, 0xE5, 0xEE, 0xDD, 0x5A, 0x9D, 0x6A,
+    0x3A, 0x2D, 0xFA, 0xA7, 0x0E, 0xC7, 0x94, 0xDE, 0x36, 0x23, 0xDA, 0x9D, 0xA3, 0xF7, 0x32, 0x29,
+    0xA6, 0x25, 0x30, 0x28, 0x49, 0x7D, 0xC8, 0x8C, 0x2A, 0x50, 0xEE, 0x02, 0x06, 0x8F, 0x00, 0xE7,
+    0x54, 0xD8, 0x17, 0x09, 0x34, 0x68, 0xAC, 0x68, 0xF9, 0xC1, 0x99, 0x91, 0x0F, 0x22, 0x30, 0x7D,
+    0xE8, 0x20, 0x03, 0x2B, 0x31, 0x8C, 0x09, 0x66, 0x57, 0x87, 0xCB, 0x47, 0x27, 0xF0, 0xD0, 0xD9,
+    0xD3, 0xB6, 0x73, 0xEF, 0x07, 0xCF, 0xDE, 0xD2, 0x9A, 0x4B, 0xD1, 0xAB, 0xBD, 0x5B, 0x8F, 0x67,
+    0x9F, 0xDE, 0xA7, 0x11, 0xE2, 0x4E, 0x61, 0xB9, 0x90, 0x46, 0x52, 0xDE, 0x73, 0x9E, 0xEC, 0xFB,
+    0x40, 0x26, 0x50, 0xC2, 0x52, 0xC5, 0xBE, 0x84, 0xFD, 0x34, 0x9C, 0xB5, 0x39, 0xCD, 0x1F, 0x9A,
+    0x91, 0x1D, 0xF9, 0x55, 0xAE, 0x62, 0x26, 0x5E, 0xEF, 0x97, 0x81, 0xFD, 0x8A, 0xE6, 0x51, 0x11,
+    0xC1, 0x72, 0xDD, 0x52, 0xCF, 0x8E, 0x81, 0x67, 0x98, 0x1C, 0x29, 0xFC, 0xAD, 0x47, 0x95, 0x9C,
+    0xBE, 0x5B, 0xDC, 0x99, 0x2F, 0x0C, 0x7C, 0x4A, 0xDB, 0x25, 0xF6, 0xDB, 0x2E, 0xB4, 0xD7, 0x3B,
+    0x69, 0xE6, 0xD5, 0xC5, 0x25, 0xEA, 0xE9, 0x7A, 0x84, 0xF9, 0x7C, 0xF7, 0x49, 0x90, 0x39, 0x5B,
+    0x2C, 0xC8, 0xEC, 0x94, 0x65, 0x3A, 0x94, 0xB5, 0x11, 0xF2, 0x24, 0x2F, 0xDC, 0x28, 0xA6, 0x11,
+    0x6E, 0x37, 0xCA, 0x09, 0x9C, 0x48, 0xA4, 0xF4, 0xEE, 0x13, 0x99, 0x4F, 0x66, 0x30, 0xC2, 0x22,
+    0x84, 0xA9, 0x22, 0xDE, 0xA5, 0x93, 0xDE, 0xE3, 0xBA, 0xDB, 0x08, 0xC1, 0x62, 0x8C, 0x46, 0x94,
+    0x6D, 0x09, 0x53, 0xF6, 0x3F, 0x8F, 0x26, 0x90, 0x7F, 0xE5, 0x78, 0xF4, 0x94, 0xCE, 0x3C, 0xED,
+    0xA5, 0x4C, 0x5B, 0x82, 0x5A, 0x68, 0xC0, 0xD5, 0xFA, 0x35, 0x57, 0x86, 0xD6, 0x5D, 0xF3, 0xD4,
+    0xE6, 0x58, 0xB0, 0xF3, 0x02, 0x55, 0xCA, 0x07, 0x9C, 0x73, 0xD8, 0xA7, 0xB3, 0x0E, 0x8A, 0x3A,
+    0xA8, 0xAE, 0x91, 0xCD, 0x4F, 0x66, 0xCE, 0xD5, 0x7C, 0x27, 0x85, 0xDF, 0x27, 0x1A, 0x3B, 0xFA,
+    0x88, 0x51, 0xA4, 0x5A, 0x6D, 0x6F, 0x70, 0xCE, 0x4F, 0x89, 0x1A, 0xBA, 0x0D, 0xE7, 0xE8, 0x31,
+    0xF0, 0x00, 0x3E, 0x73, 0xAC, 0x63, 0x1A, 0x26, 0xF9, 0xB7, 0x72, 0x87, 0xF0, 0x55, 0xD0, 0x6E,
+    0x80, 0x1E, 0x1E, 0xF1, 0x8F, 0xD6, 0x8F, 0xF8, 0x77, 0xAB, 0x23, 0xFE, 0x53, 0xC4, 0xD1, 0x1F,
+    0xBD, 0x1A, 0xF7, 0x7B, 0x07, 0x06, 0x26, 0x1B, 0x37, 0xAF, 0x2F, 0xB8, 0xA4, 0xE5, 0xDE, 0xDA,
+    0x11, 0x16, 0x8A, 0x73, 0xDA, 0xCA, 0xB0, 0x38, 0x72, 0x8F, 0xE7, 0xA4, 0x25, 0xED, 0x55, 0xCC,
+    0xA0, 0x9D, 0xE1, 0x2B, 0xF0, 0x84, 0xAA, 0x86, 0xC7, 0x59, 0x42, 0x17, 0x24, 0x70, 0x46, 0x79,
+    0xA6, 0x36, 0xAE, 0xC3, 0xBB, 0x35, 0xFC, 0xCB, 0xA8, 0x8E, 0xBE, 0xAA, 0x61, 0x6D, 0x47, 0x4D,
+    0xF4, 0x49, 0x03, 0xAF, 0x29, 0x6C, 0xE3, 0x9B, 0x2D, 0x2C, 0xBE, 0xA0, 0x4B, 0x6E, 0x74, 0x09,
+    0x7D, 0x1C, 0x7D, 0xBD, 0x83, 0x25, 0x8E, 0xCF, 0xD7, 0x7B, 0x5D, 0xC8, 0x21, 0x31, 0x4C, 0xB3,
+    0xF2, 0x06, 0xA3, 0xAC, 0xB8, 0x3F, 0xB0, 0x88, 0x4C, 0x2A, 0x19, 0xCC, 0x8C, 0xFA, 0xDE, 0x74,
+    0x92, 0x55, 0x64, 0xD4, 0x52, 0x0F, 0xEE, 0xD7, 0x0B, 0x89, 0x44, 0x3D, 0x1A, 0xC7, 0xBF, 0xC9,
+    0x20, 0x88, 0xFA, 0x31, 0xC9, 0xEC, 0x96, 0x88, 0x1C, 0xC2, 0xF1, 0x5B, 0xC9, 0xC9, 0x61, 0x7B,
+    0xEF, 0xAE, 0x08, 0x93, 0xB4, 0x15, 0x2C, 0x3C, 0x3C, 0x60, 0x53, 0x8D, 0x39, 0x03, 0x95, 0x49,
+    0xA5, 0xAD, 0x07, 0xF3, 0xBD, 0xD6, 0x19, 0x68, 0x83, 0x33, 0xAE, 0x41, 0x5A, 0xD4, 0xBC, 0xA7,
+    0x5F, 0x82, 0x46, 0x6C, 0xFB, 0xE4, 0x02, 0x7C, 0xF7, 0xAE, 0x8B, 0x3F, 0x6C, 0x30, 0xEE, 0x2E,
+    0xFA, 0xB0, 0x56, 0x7E, 0xDF, 0x45, 0x9F, 0xC2, 0x76, 0x1D, 0xDA, 0xF0, 0x36, 0xDD, 0x0A, 0x39,
+    0x0E, 0xA0, 0x18, 0xED, 0x67, 0xFE, 0xA2, 0x96, 0x5F, 0x18, 0x64, 0xD5, 0x6C, 0x79, 0x0C, 0x7B,
+    0xED, 0xF8, 0xCD, 0xDB, 0x3C, 0x7E, 0xC3, 0xE3, 0xDA, 0xCB, 0xE3, 0x37, 0x58, 0x4A, 0x49, 0x9D,
+    0xD1, 0x43, 0xC4, 0x2A, 0x82, 0x5B, 0xD6, 0x70, 0x45, 0x74, 0x4C, 0x7F, 0xF7, 0x72, 0x66, 0x98,
+    0x02, 0xC8, 0xBE, 0xC2, 0x5C, 0xDC, 0xED, 0xE9, 0x80, 0x77, 0xEC, 0x7E, 0xC2, 0xA0, 0x9C, 0x77,
+    0xB3, 0x3A, 0x78, 0xFC, 0x08, 0x90, 0xE3, 0x46, 0xC2, 0x36, 0xE1, 0x2D, 0x19, 0xEF, 0xB7, 0xF0,
+    0x3C, 0xBD, 0x74, 0x8A, 0x8A, 0xD3, 0xCF, 0x06, 0x73, 0x30, 0xE3, 0xBA, 0xC4, 0x08, 0x92, 0x5A,
+    0xF8, 0x11, 0x90, 0x1B, 0x21, 0x99, 0x80, 0x29, 0xF5, 0x3B, 0xCC, 0xE7, 0x4C, 0x8E, 0x78, 0xB3,
+    0x01, 0x37, 0x6D, 0x19, 0xE7, 0x4C, 0x98, 0xCF, 0x80, 0x97, 0xCB, 0x66, 0x38, 0x68, 0xC6, 0xD4,
+    0xB3, 0x38, 0x81, 0xCF, 0x73, 0xF0, 0x62, 0xCC, 0xB9, 0xC9, 0xE4, 0xFA, 0x54, 0xE7, 0xF9, 0x43,
+    0x18, 0xCB, 0xA9, 0x12, 0x38, 0xEF, 0x57, 0xEB, 0x0B, 0xF1, 0xD4, 0x98, 0xE3, 0x1C, 0x02, 0x53,
+    0x8E, 0xBF, 0x92, 0x10, 0x0B, 0x4D, 0xD2, 0xB9, 0xCB, 0x98, 0x9A, 0xE6, 0xD6, 0xBE, 0x07, 0x86,
+    0x7B, 0x32, 0x37, 0xE2, 0xE6, 0x72, 0x04, 0x32, 0xF1, 0x41, 0x3F, 0xD9, 0x57, 0x2E, 0xAD, 0x33,
+    0xE6, 0xB1, 0xDC, 0x4F, 0x80, 0x56, 0x37, 0xF5, 0x9D, 0xC5, 0x62, 0x65, 0xEB, 0x39, 0x10, 0x47,
+    0xC1, 0xE3, 0xEF, 0x60, 0xFA, 0xD1, 0x77, 0x5D, 0xFD, 0x0E, 0x86, 0xE7, 0xBA, 0xA6, 0xB2, 0x33,
+    0x47, 0x6F, 0xEC, 0x8C, 0xCD, 0x45, 0xA3, 0x5A, 0x00, 0xC7, 0xE8, 0x36, 0x48, 0x0A, 0x87, 0x72,
+    0xE0, 0x60, 0x9E, 0x6A, 0xFA, 0x36, 0x63, 0x71, 0xAD, 0x04, 0xED, 0xA4, 0xD9, 0x04, 0xFC, 0x66,
+    0x3D, 0x5A, 0x75, 0x8A, 0x74, 0x8E, 0x19, 0xEA, 0x29, 0x48, 0x90, 0xAC, 0x22, 0x2F, 0xC7, 0xA5,
+    0x73, 0x72, 0x21, 0xDA, 0x87, 0xBB, 0x10, 0xA7, 0x46, 0x27, 0xFD, 0xCF, 0xA8, 0x8A, 0xCB, 0xA0,
+    0x35, 0xDF, 0xF1, 0x3F, 0x8F, 0x3D, 0x9F, 0xDB, 0x14, 0xE9, 0xDA, 0x96, 0x19, 0xFC, 0xCF, 0x32,
+    0x35, 0xCC, 0xD1, 0x3F, 0xF6, 0xFB, 0xFF, 0xD5, 0x5B, 0x3D, 0x93, 0xDC, 0xC6, 0x11, 0x1D, 0x2C,
+    0xB4, 0xDA, 0x32, 0x11, 0x2C, 0x83, 0xBB, 0x2A, 0x97, 0x68, 0x17, 0x1C, 0xCA, 0x0E, 0x8C, 0x5F,
+    0x20, 0x0E, 0x18, 0xB8, 0x1C, 0x28, 0xF0, 0x05, 0xB7, 0xE5, 0xC0, 0x81, 0x7E, 0x80, 0x83, 0x8B,
+    0x5D, 0x65, 0x0B, 0x30, 0x19, 0x38, 0xF4, 0x25, 0xCA, 0x19, 0xC8, 0x55, 0xF4, 0x2A, 0xA0, 0x03,
+    0x07, 0x0E, 0x6C, 0x0E, 0x28, 0x06, 0x0A, 0x14, 0x18, 0x14, 0xCB, 0xB1, 0x56, 0x16, 0x65, 0x5B,
+    0xA7, 0xC0, 0x90, 0x04, 0x49, 0x38, 0x12, 0xC0, 0xF8, 0xBD, 0x9E, 0xC1, 0x2E, 0xEE, 0x48, 0x1D,
+    0x3F, 0x74, 0x14, 0xCF, 0xAB, 0x9B, 0x6E, 0x70, 0x17, 0x98, 0x99, 0xEE, 0x99, 0xE9, 0x7E, 0xDD,
+    0x0D, 0x29, 0x35, 0x7C, 0x26, 0x56, 0x45, 0xB6, 0x09, 0x7B, 0x65, 0xAC, 0xBD, 0xD2, 0x4E, 0xAC,
+    0xB5, 0xF7, 0x9B, 0xC8, 0x1E, 0x58, 0x5B, 0xCD, 0x3B, 0x15, 0xDB, 0x22, 0x69, 0xD4, 0xAC, 0x57,
+    0xBA, 0x52, 0xA1, 0x55, 0x7A, 0xC5, 0xDB, 0xB3, 0x52, 0x05, 0x36, 0x5D, 0x53, 0x35, 0xBA, 0x06,
+    0x75, 0xF7, 0xB8, 0xFB, 0x93, 0x9A, 0xCF, 0xB2, 0x9F, 0x16, 0x83, 0xFC, 0xCB, 0x36, 0xF8, 0x12,
+    0x1D, 0x2B, 0x8E, 0x95, 0x2B, 0x75, 0xC1, 0x1E, 0x72, 0x06, 0xDB, 0x7E, 0x26, 0xBB, 0x68, 0x98,
+    0x07, 0x48, 0xA7, 0xB2, 0x3E, 0x6C, 0x71, 0xEF, 0xFB, 0xCD, 0x9C, 0x0F, 0x24, 0x87, 0x7B, 0x36,
+    0xD7, 0xAB, 0x19, 0xBE, 0x2F, 0x38, 0x53, 0x47, 0x30, 0x8C, 0x27, 0xF8, 0xA7, 0xFC, 0x20, 0xB7,
+    0xE0, 0xE6, 0x56, 0xE1, 0xB1, 0x9A, 0x83, 0x61, 0x7A, 0x86, 0x5D, 0x06, 0xA9, 0x1A, 0x7F, 0x02,
+    0x48, 0x91, 0xAB, 0xE4, 0x3D, 0x3E, 0xAC, 0xF4, 0x87, 0x9D, 0xB0, 0x4F, 0x5A, 0x61, 0x98, 0x9F,
+    0xB0, 0x5C, 0x58, 0xAD, 0x84, 0xAD, 0x9E, 0x82, 0x65, 0x9E, 0x95, 0x4A, 0x63, 0x1A, 0xD0, 0x88,
+    0x2D, 0x94, 0x4A, 0xFA, 0x5F, 0x50, 0x74, 0x8A, 0x45, 0x49, 0xAD, 0x6D, 0x39, 0x9F, 0x8C, 0x13,
+    0xC5, 0x67, 0x67, 0x98, 0xE0, 0xB6, 0xCC, 0x17, 0x3D, 0xE0, 0x63, 0x72, 0x9B, 0x46, 0x8D, 0x4D,
+    0x41, 0x7B, 0x0B, 0x6D, 0x47, 0x78, 0x86, 0xB4, 0x22, 0xED, 0xA8, 0xFF, 0xA8, 0x3D, 0x81, 0xE6,
+    0x73, 0xD2, 0x02, 0x4B, 0xA0, 0xCC, 0x47, 0xA6, 0xE5, 0x60, 0x1C, 0x34, 0xB1, 0x9F, 0x83, 0x46,
+    0xF6, 0x32, 0x27, 0x70, 0x7E, 0xAD, 0x99, 0x69, 0x1A, 0xB8, 0x49, 0x44, 0xD5, 0x7C, 0x25, 0x17,
+    0x61, 0x07, 0x55, 0xC9, 0x47, 0xA6, 0xCC, 0x8F, 0x6E, 0x87, 0xBB, 0x77, 0x36, 0x3A, 0xCD, 0xEC,
+    0xC7, 0xB2, 0xB0, 0xAD, 0xA1, 0xDA, 0xFD, 0x45, 0x33, 0x5C, 0xF4, 0xEE, 0xA2, 0x88, 0x2C, 0x24,
+    0x4B, 0x2A, 0x53, 0x04, 0xD4, 0x86, 0x5E, 0x41, 0x57, 0x86, 0x7B, 0xA8, 0xC0, 0x45, 0x26, 0x5B,
+    0xC7, 0x69, 0x6F, 0xE6, 0xD6, 0xA4, 0x52, 0xF3, 0xC6, 0x5F, 0x24, 0x95, 0xFF, 0x09, 0x0A, 0x75,
+    0x17, 0x6E, 0x89, 0xB2, 0x12, 0x3B, 0x8D, 0x17, 0xA6, 0xC0, 0x43, 0x4A, 0x7A, 0xC6, 0x43, 0x4A,
+    0xC6, 0xD2, 0xDC, 0x6C, 0x07, 0x1C, 0xFD, 0xDE, 0xF2, 0x8F, 0x32, 0x1F, 0x28, 0xBE, 0x93, 0x19,
+    0xBA, 0x8B, 0x43, 0x25, 0x17, 0x4E, 0xE9, 0x90, 0xDE, 0xC9, 0x57, 0xE8, 0x5C, 0xC4, 0x99, 0x7F,
+    0x2A, 0xF3, 0x2E, 0xB1, 0x50, 0xAD, 0x92, 0xC7, 0x15, 0xB7, 0x07, 0xC5, 0xE1, 0x12, 0x79, 0x71,
+    0xFC, 0xA0, 0xD0, 0x6B, 0x2E, 0xE2, 0xF8, 0x8B, 0x6C, 0xE5, 0x2F, 0xF4, 0x6A, 0xFB, 0xE7, 0xD6,
+    0x4B, 0x11, 0x1E, 0x93, 0x6B, 0x35, 0x92, 0xAB, 0x70, 0xE2, 0x60, 0xE1, 0x9C, 0x38, 0x3C, 0x0C,
+    0xD2, 0x33, 0xD7, 0x51, 0xC6, 0x8A, 0x6B, 0x2F, 0x8E, 0xFE, 0x62, 0x91, 0x0E, 0xEA, 0x2D, 0x06,
+    0x71, 0x8A, 0x41, 0x1C, 0xD9, 0x36, 0x58, 0xC7, 0x5D, 0xAE, 0xDE, 0xA4, 0x0D, 0x1B, 0x39, 0x53,
+    0xF6, 0xB5, 0x4A, 0xB8, 0xE6, 0xEF, 0xE0, 0x73, 0xEB, 0xCE, 0x5A, 0xB0, 0xEB, 0xB8, 0x9C, 0x8B,
+    0x3B, 0xDD, 0x0C, 0xDD, 0x46, 0xF6, 0x2B, 0xE1, 0x31, 0x54, 0x43, 0xAE, 0x0F, 0xF7, 0xBA, 0x60,
+    0xB1, 0x57, 0xE9, 0x15, 0x37, 0x9C, 0x2E, 0x71, 0xDA, 0xB8, 0xF1, 0x20, 0x1C, 0xB8, 0x3B, 0x82,
+    0x9D, 0x5B, 0x32, 0xF6, 0xDB, 0x38, 0x0E, 0x21, 0xE5, 0x3E, 0x91, 0x6E, 0xD6, 0xC1, 0x36, 0x28,
+    0xF6, 0x13, 0xDA, 0xC5, 0x2E, 0xFB, 0x8D, 0xB0, 0x1F, 0x22, 0xFB, 0xA5, 0xF0, 0x89, 0xBD, 0x2D,
+    0x5C, 0xBD, 0xE0, 0xF7, 0x12, 0x4F, 0x4A, 0x69, 0x86, 0x1D, 0xF2, 0xAC, 0xE8, 0xC1, 0x72, 0x1F,
+    0x14, 0xDA, 0x3B, 0x42, 0xE5, 0x28, 0x3A, 0xCA, 0xFB, 0xD4, 0x5B, 0xA2, 0x4F, 0x23, 0x2B, 0x2D,
+    0xC6, 0x44, 0x99, 0xBB, 0xEA, 0xF8, 0x07, 0x1B, 0xA6, 0xE0, 0xBC, 0xCD, 0x9A, 0xEA, 0xDC, 0x14,
+    0xEB, 0x3E, 0x94, 0x39, 0xF6, 0xEB, 0x53, 0x53, 0xCC, 0x39, 0x93, 0x15, 0x3F, 0x4A, 0x37, 0xE6,
+    0x22, 0xDB, 0x8C, 0xFA, 0x23, 0x99, 0xB9, 0x96, 0x99, 0x6B, 0x99, 0x39, 0xED, 0x19, 0x4F, 0x72,
+    0x9E, 0x14, 0xB4, 0xA8, 0xAE, 0xF1, 0x9A, 0xDF, 0xB1, 0xE9, 0xF2, 0x9B, 0x34, 0xA7, 0x37, 0xDF,
+    0x5E, 0xC2, 0xE8, 0x89, 0x34, 0xA5, 0xE2, 0x46, 0x65, 0xB5, 0x9A, 0xE0, 0x10, 0xE5, 0x59, 0xAB,
+    0x42, 0x5A, 0xDA, 0xAC, 0xF7, 0xDC, 0x0E, 0x3C, 0xF7, 0xBC, 0x74, 0x3C, 0xAB, 0x1C, 0x7F, 0xAD,
+    0x76, 0xFC, 0xD5, 0xD6, 0xF1, 0x2B, 0xBD, 0xE3, 0x97, 0xAD, 0xE3, 0xB9, 0xBD, 0xE5, 0x78, 0x76,
+    0xC7, 0x71, 0xFD, 0xB9, 0xE3, 0xF1, 0x97, 0x8E, 0xD3, 0x60, 0x92, 0x87, 0x9E, 0x4F, 0x3C, 0x57,
+    0x03, 0xCF, 0x3C, 0xD7, 0x9C, 0x9F, 0xB7, 0x75, 0xB9, 0x77, 0x14, 0x72, 0xBE, 0x83, 0xB7, 0xAC,
+    0xFF, 0x67, 0xEF, 0x79, 0xEB, 0x79, 0xA9, 0x1E, 0xFE, 0xB1, 0x4E, 0x5E, 0xBA, 0x45, 0x91, 0x17,
+    0x5C, 0xE4, 0xBD, 0xA1, 0x9C, 0xBC, 0xB4, 0x97, 0xB9, 0xE7, 0x94, 0x17, 0xF7, 0x8B, 0xBC, 0xB8,
+    0x4F, 0xE4, 0x05, 0x17, 0x79, 0xC1, 0x45, 0x5E, 0x70, 0x91, 0x17, 0x5C, 0xE4, 0x25, 0xA7, 0xBC,
+    0xE4, 0x94, 0x97, 0x9C, 0xF2, 0x92, 0x3B, 0x07, 0xE1, 0xE4, 0x25, 0x9F, 0x78, 0xAE, 0x06, 0x9E,
+    0x79, 0xAE, 0xC9, 0xFD, 0x7C, 0x8F, 0xF2, 0xC0, 0x9B, 0x7A, 0x2F, 0xB7, 0xF2, 0x72, 0x2B, 0x2F,
+    0xB7, 0x32, 0xAB, 0xB1, 0x37, 0x15, 0xDB, 0x11, 0xDA, 0x0D, 0x75, 0xDF, 0x0C, 0x9F, 0x1E, 0x96,
+    0x6B, 0xD2, 0x5B, 0x6D, 0x57, 0xA0, 0x70, 0xCC, 0xA0, 0x87, 0x59, 0x03, 0x5A, 0xCE, 0x5B, 0x50,
+    0x98, 0x37, 0xD0, 0x7C, 0xF6, 0xD4, 0x54, 0x60, 0xCC, 0x88, 0x0A, 0x88, 0x08, 0xAE, 0x77, 0xEB,
+    0x85, 0x0A, 0x6C, 0x2D, 0x74, 0x1F, 0x16, 0x71, 0x4A, 0x95, 0xA7, 0x06, 0x34, 0xFE, 0x90, 0x77,
+    0x44, 0xF2, 0xDB, 0xC4, 0x8A, 0x40, 0x8B, 0x0D, 0x4C, 0x08, 0xE5, 0xEC, 0x84, 0xB2, 0xC0, 0x91,
+    0xFC, 0x3A, 0x27, 0x72, 0x51, 0xF3, 0xFB, 0xBC, 0x3F, 0xF9, 0x77, 0xC3, 0xD3, 0x74, 0x47, 0x16,
+    0xF0, 0x16, 0xFB, 0x31, 0xBF, 0xB5, 0xA2, 0x3E, 0x2B, 0xCA, 0x83, 0x1A, 0x9D, 0x2B, 0x0B, 0xED,
+    0x12, 0x1D, 0xC1, 0x86, 0xA2, 0x8B, 0x48, 0xC0, 0x8F, 0x20, 0x1A, 0x05, 0x4B, 0x0E, 0x3B, 0x49,
+    0x3F, 0xD0, 0x7A, 0x77, 0x07, 0xC3, 0x8F, 0x89, 0x5B, 0x3E, 0x22, 0x5E, 0x18, 0x0E, 0xB8, 0x9A,
+    0x74, 0x38, 0xCD, 0x74, 0xBB, 0xF4, 0xB8, 0xDE, 0xD9, 0x4E, 0xB0, 0x16, 0xE8, 0x03, 0xEE, 0xC0,
+    0x56, 0xE1, 0x3E, 0xBC, 0x87, 0x9A, 0xD7, 0xD2, 0xF6, 0x6C, 0x4D, 0xD8, 0xA3, 0xED, 0xF5, 0xDA,
+    0x94, 0xF3, 0x1A, 0x5E, 0xB0, 0xB6, 0x79, 0x8C, 0xEB, 0xAC, 0xCE, 0xE4, 0xFB, 0xAF, 0xEA, 0xC8,
+    0x5E, 0xA9, 0x09, 0x32, 0xB6, 0x30, 0x02, 0x2C, 0x56, 0x3A, 0xFF, 0x0C, 0x9B, 0x12, 0x5E, 0x24,
+    0xA0, 0x68, 0x5E, 0xF8, 0xB9, 0xED, 0xD6, 0x2D, 0xB0, 0x0E, 0xCE, 0x3C, 0x71, 0x83, 0xDA, 0xC6,
+    0xFD, 0x9C, 0x34, 0x9E, 0xDA, 0x18, 0x9F, 0xA7, 0x6B, 0xCE, 0x6D, 0xD3, 0x67, 0x3B, 0x87, 0xAD,
+    0xC4, 0x5B, 0x2B, 0x71, 0xD5, 0x6B, 0x28, 0xE5, 0x30, 0x0D, 0x1D, 0xB8, 0x03, 0x9F, 0x13, 0x59,
+    0x05, 0x02, 0xDD, 0xC6, 0x03, 0xD4, 0x47, 0x02, 0xDD, 0xE0, 0x34, 0x80, 0x2E, 0x80, 0xE8, 0xCE,
+    0xAC, 0x8E, 0xEA, 0xA0, 0x87, 0x85, 0xCC, 0xB0, 0x4D, 0x12, 0x4C, 0x78, 0xBA, 0xEB, 0x4F, 0x55,
+    0x2F, 0x98, 0x75, 0x4E, 0xC8, 0xDB, 0xC4, 0x2D, 0xBD, 0x26, 0x71, 0xAD, 0x91, 0x36, 0xB1, 0xAE,
+    0x85, 0x3D, 0xBF, 0xE3, 0x6F, 0xBC, 0x87, 0x2B, 0x2E, 0x38, 0x97, 0x9E, 0x09, 0x9D, 0x8B, 0xD7,
+    0x9F, 0xD0, 0x72, 0x28, 0x43, 0x7F, 0x2F, 0xCE, 0x5E, 0x3C, 0x7D, 0xB0, 0x3B, 0x00, 0xB5, 0xDC,
+    0xF9, 0x56, 0x71, 0x83, 0x4F, 0x4D, 0x04, 0xDD, 0x42, 0x13, 0x59, 0x29, 0xC8, 0x56, 0x70, 0xAD,
+    0xA0, 0x5A, 0x87, 0x69, 0x1D, 0xA2, 0xDD, 0x71, 0x80, 0x72, 0xBE, 0x8A, 0x57, 0x61, 0x4B, 0x03,
+    0x84, 0x49, 0xC2, 0xF8, 0xA8, 0xED, 0x1D, 0x6F, 0x6C, 0x88, 0x6B, 0xA3, 0xF6, 0x91, 0x0D, 0x18,
+    0x96, 0x08, 0x96, 0xF8, 0x95, 0xE8, 0x35, 0xB1, 0x5F, 0x01, 0x3A, 0xBC, 0xDD, 0x0A, 0x6E, 0x35,
+    0xDC, 0xA3, 0x5E, 0xD9, 0x95, 0x17, 0xF1, 0x95, 0x19, 0xF7, 0x21, 0x01, 0xAC, 0x90, 0x97, 0x27,
+    0xF9, 0xF3, 0x10, 0x1D, 0xA7, 0x3E, 0x1D, 0x9A, 0x9C, 0xDC, 0xEA, 0xA2, 0x0A, 0xEB, 0x4C, 0x9A,
+    0xDA, 0xFF, 0xEE, 0xE9, 0xA9, 0x40, 0x9D, 0x7B, 0x93, 0xD6, 0x68, 0x25, 0xC1, 0x02, 0x56, 0x9A,
+    0x67, 0x60, 0xF2, 0xE6, 0x99, 0xD1, 0x83, 0x52, 0xCB, 0x5C, 0x3C, 0x0A, 0x77, 0xE5, 0x1C, 0x6B,
+    0x74, 0x2E, 0x7D, 0x76, 0xBA, 0xB8, 0x8A, 0xFF, 0xD4, 0x8D, 0x68, 0xC5, 0x08, 0x07, 0xD2, 0x46,
+    0xFD, 0xB0, 0xF5, 0xCF, 0x86, 0x2E, 0xCE, 0xE5, 0xE7, 0x72, 0x91, 0x99, 0xDF, 0x32, 0x3A, 0x99,
+    0x3E, 0x3B, 0x5D, 0x04, 0xCB, 0x35, 0x12, 0x4C, 0xB8, 0x37, 0x66, 0xE2, 0x05, 0xAF, 0x9D, 0x1D,
+    0x5D, 0x5C, 0xF3, 0x71, 0x87, 0x95, 0x98, 0x4B, 0xA9, 0x17, 0xF3, 0x67, 0x78, 0x46, 0x9C, 0xF9,
+    0xD7, 0x38, 0x8B, 0x68, 0xE5, 0x0F, 0x55, 0x46, 0xCF, 0x09, 0x7F, 0xC0, 0xE0, 0x2A, 0x6A, 0x7D,
+    0x98, 0xEA, 0x5A, 0x1E, 0xB5, 0x19, 0x62, 0x48, 0xBD, 0x4A, 0x2A, 0x44, 0x2A, 0x25, 0x3C, 0x6D,
+    0x1E, 0x30, 0x46, 0x0C, 0xA8, 0x49, 0xF1, 0x2D, 0x63, 0xEA, 0x3E, 0xF3, 0x4B, 0x34, 0x3E, 0xC9,
+    0xAD, 0x66, 0x4D, 0x5F, 0xE4, 0x4E, 0x3C, 0x0B, 0x68, 0x02, 0x6A, 0xCF, 0x7D, 0x73, 0x68, 0xB6,
+    0x4E, 0x54, 0xD8, 0xE8, 0x94, 0x4D, 0xED, 0x7C, 0xE7, 0xD4, 0x50, 0x05, 0xF4, 0x21, 0x72, 0x3C,
+    0xA0, 0x1B, 0xF5, 0x1B, 0x8F, 0x89, 0x65, 0x3F, 0x0A, 0x7D, 0x59, 0x9D, 0x0D, 0xDD, 0xB8, 0x09,
+    0x38, 0xFD, 0x4C, 0x96, 0xCB, 0x54, 0xD6, 0x78, 0x8E, 0xA9, 0xF0, 0x5C, 0x90, 0x07, 0xEA, 0xF4,
+    0xF4, 0xA3, 0xCE, 0x2D, 0xFF, 0xE8, 0x20, 0x56, 0x3F, 0x62, 0xD3, 0xC5, 0xEE, 0x08, 0x2C, 0x27,
+    0x0E, 0x38, 0x64, 0x6B, 0xFC, 0x40, 0x66, 0x85, 0x4D, 0xFA, 0x98, 0x7A, 0x09, 0x5B, 0x61, 0x51,
+    0x23, 0x6C, 0x5E, 0x0B, 0x8B, 0xAB, 0xF8, 0xDE, 0x72, 0x1F, 0x61, 0x57, 0x4C, 0xF9, 0xB3, 0x42,
+    0x98, 0xC9, 0x85, 0xD9, 0x03, 0x53, 0x29, 0x8F, 0x78, 0x06, 0x60, 0xE2, 0x34, 0x44, 0x01, 0xF8,
+    0x38, 0x1A, 0x1E, 0xBF, 0x0A, 0xF5, 0xE0, 0x81, 0x0A, 0xE7, 0x97, 0x0C, 0xE6, 0x33, 0x96, 0x9B,
+    0x96, 0xE8, 0x58, 0xD2, 0x3F, 0xE5, 0x88, 0x2D, 0x46, 0x58, 0x79, 0xC2, 0x68, 0x3E, 0xA7, 0x7E,
+    0x0C, 0xD0, 0x34, 0xBB, 0xC6, 0x69, 0x09, 0xF3, 0xA4, 0x9F, 0x50, 0xC1, 0xD0, 0xBE, 0xB0, 0x5A,
+    0x99, 0x34, 0xB8, 0xCE, 0x1F, 0x53, 0xAE, 0x0C, 0x14, 0xAE, 0x7B, 0xFE, 0x33, 0xA7, 0xDE, 0xC4,
+    0x50, 0x09, 0x43, 0x3C, 0xDA, 0xCA, 0xBF, 0x10, 0x28, 0xBD, 0x04, 0x3D, 0xF4, 0xCC, 0xB6, 0x68,
+    0xDB, 0xE0, 0x0A, 0x5D, 0x97, 0x82, 0xE1, 0xCE, 0x13, 0xC2, 0xAE, 0x07, 0xEF, 0x53, 0x6A, 0x6D,
+    0x25, 0x99, 0x8F, 0xD0, 0xDE, 0x43, 0x3F, 0x36, 0x0D, 0xD2, 0x58, 0x76, 0x21, 0x75, 0xA3, 0x85,
+    0x94, 0xD3, 0x05, 0x90, 0x5B, 0x0C, 0xF1, 0xD6, 0x04, 0x10, 0x2C, 0xA9, 0xF4, 0xEA, 0x9C, 0x39,
+    0xD4, 0x15, 0x16, 0x23, 0x21, 0x99, 0xB7, 0xD3, 0x3D, 0xAC, 0x58, 0x9E, 0x54, 0x4E, 0x53, 0x86,
+    0xE4, 0x02, 0xC7, 0x58, 0x27, 0x2A, 0x03, 0x7B, 0xBB, 0xC3, 0x54, 0xEE, 0x31, 0x3F, 0x0A, 0x41,
+    0x99, 0xD4, 0x50, 0x19, 0x33, 0x23, 0xC6, 0xA5, 0x3B, 0x1E, 0x24, 0x19, 0x13, 0x93, 0x72, 0x9F,
+    0x3C, 0xC1, 0xF4, 0x8A, 0x0A, 0xCC, 0x95, 0xCE, 0x27, 0x5E, 0xB8, 0xB1, 0x1C, 0x39, 0x77, 0xBD,
+    0x4F, 0x7F, 0x9C, 0x02, 0x8A, 0x26, 0x1C, 0x36, 0xE1, 0x57, 0x2F, 0x0A, 0x78, 0x24, 0x82, 0x66,
+    0x92, 0x21, 0x55, 0xC4, 0xD0, 0x02, 0xA2, 0x1D, 0x8A, 0xDE, 0xC4, 0x2C, 0x8F, 0xAD, 0x08, 0x9E,
+    0xA4, 0xF2, 0xA5, 0xE5, 0xD5, 0xB1, 0x22, 0x48, 0x98, 0x8B, 0x92, 0x44, 0x1B, 0xE0, 0x6C, 0xC2,
+    0xF4, 0x6F, 0x52, 0x45, 0xF6, 0x23, 0xF3, 0x50, 0x45, 0x4C, 0x1D, 0x8E, 0xAD, 0x80, 0x63, 0x0B,
+    0xC9, 0x8D, 0xE8, 0x6E, 0x8D, 0x63, 0x03, 0xC9, 0xE6, 0xDC, 0xEB, 0x28, 0x2B, 0x85, 0x66, 0xD6,
+    0x88, 0x99, 0x20, 0x73, 0xAC, 0xF1, 0x3B, 0xE2, 0x58, 0xDD, 0xC4, 0x9D, 0xCB, 0x08, 0xDD, 0xEF,
+    0x26, 0xF6, 0x4E, 0xA7, 0x5E, 0xA0, 0x52, 0x66, 0xED, 0x79, 0x1C, 0xD9, 0xE4, 0x0F, 0xA6, 0xA1,
+    0x2E, 0xA8, 0x0A, 0x6A, 0x02, 0x10, 0x77, 0x17, 0xC6, 0x8B, 0xAE, 0xCC, 0xD2, 0xA9, 0x31, 0x4F,
+    0x0B, 0xA5, 0xAA, 0x0D, 0x88, 0x76, 0x79, 0xB4, 0x0C, 0x58, 0x39, 0xCD, 0x0A, 0x49, 0x19, 0x33,
+    0xF9, 0x50, 0x48, 0x36, 0x0A, 0xEA, 0xCC, 0xDE, 0xC6, 0x64, 0xB3, 0x77, 0x08, 0x44, 0xFF, 0xDE,
+    0xF0, 0x9C, 0xC9, 0x61, 0x93, 0x2B, 0x0C, 0x9A, 0xDD, 0x47, 0x57, 0xD9, 0x6D, 0x74, 0x9A, 0x15,
+    0xA6, 0x1C, 0x1E, 0x93, 0x0E, 0x60, 0x3E, 0x30, 0x61, 0x44, 0x05, 0xAE, 0x67, 0xD8, 0x8F, 0x2D,
+    0x17, 0x78, 0x70, 0x51, 0xDC, 0xAA, 0xC0, 0xFA, 0x34, 0x6A, 0x58, 0x97, 0x71, 0x30, 0xE9, 0xD3,
+    0x0A, 0x8F, 0xA2, 0x4C, 0xAE, 0x99, 0x3C, 0x61, 0x92, 0x2F, 0x67, 0x66, 0x1D, 0x96, 0x0E, 0xBF,
+    0x98, 0xDF, 0xB1, 0x6B, 0xF3, 0x7B, 0x89, 0x5D, 0x78, 0x92, 0x3D, 0xD0, 0x35, 0x3E, 0x9A, 0x11,
+    0x9B, 0x78, 0xC7, 0xBA, 0x4C, 0x71, 0xBE, 0x7E, 0x36, 0xE7, 0x92, 0x1B, 0xC9, 0xFE, 0x9A, 0x7C,
+    0xD6, 0x9F, 0x91, 0x18, 0x48, 0x8B, 0x52, 0xFE, 0x26, 0x53, 0x11, 0x07, 0x11, 0x38, 0x37, 0xE1,
+    0x8C, 0x8A, 0x11, 0x7A, 0x21, 0x57, 0xA7, 0x13, 0x0F, 0xCD, 0x68, 0xC3, 0xD1, 0x59, 0xE2, 0x07,
+    0x66, 0x14, 0xCD, 0xD3, 0x30, 0xF9, 0x0F, 0x4D, 0xF1, 0x35, 0x1F, 0xEC, 0x0E, 0x74, 0x6C, 0x87,
+    0x9F, 0xB3, 0x96, 0x92, 0x74, 0xE3, 0x35, 0xDB, 0x11, 0x75, 0x59, 0x0A, 0x97, 0x7C, 0xB9, 0xB0,
+    0x4F, 0x84, 0xB7, 0xCC, 0x31, 0xBF, 0x82, 0x6D, 0x6D, 0x91, 0x4F, 0x45, 0x6B, 0x85, 0x9B, 0x04,
+    0xB5, 0x46, 0x73, 0xCC, 0x5D, 0x34, 0xB9, 0x26, 0xD1, 0xAB, 0x62, 0xF8, 0xAA, 0x24, 0x7E, 0x95,
+    0x00, 0x56, 0x22, 0xD8, 0xCD, 0xE9, 0x8B, 0x89, 0xF1, 0x8E, 0x90, 0xC6, 0x4F, 0x79, 0x22, 0x78,
+    0x9C, 0x9A, 0x4E, 0xEA, 0x41, 0x0A, 0x41, 0x24, 0xAC, 0xD5, 0x28, 0x57, 0x09, 0xB9, 0xD0, 0xBB,
+    0x92, 0x94, 0xCF, 0x40, 0x81, 0x9C, 0xA7, 0xD6, 0x2E, 0xEE, 0xEC, 0xD1, 0x07, 0xE0, 0x16, 0xBD,
+    0xB1, 0x42, 0xD3, 0xF4, 0x21, 0x66, 0x68, 0x14, 0x4E, 0x27, 0x02, 0x01, 0x5D, 0x9B, 0x2E, 0xF6,
+    0x1A, 0xE5, 0x97, 0x89, 0x10, 0x40, 0xA6, 0x20, 0x85, 0x87, 0xDE, 0x79, 0x34, 0x99, 0x03, 0x25,
+    0xE5, 0x8F, 0x4C, 0x20, 0x71, 0x12, 0x6C, 0x61, 0xFF, 0x03, 0x4C, 0x5A, 0x2F, 0x4D, 0xCB, 0xA1,
+    0xB5, 0x37, 0x43, 0xE3, 0x84, 0xC6, 0xEC, 0x81, 0x84, 0x46, 0xFA, 0xCD, 0x93, 0x1A, 0xD2, 0x52,
+    0xF5, 0x4B, 0xD6, 0x02, 0x58, 0xDE, 0xA0, 0x6D, 0x5A, 0xFD, 0x9F, 0x17, 0x59, 0x64, 0xF2, 0xCA,
+    0x9D, 0xAB, 0x72, 0xB8, 0x68, 0x86, 0x0B, 0x67, 0xA1, 0xCE, 0x74, 0x49, 0xC5, 0xE3, 0xD5, 0xEE,
+    0x49, 0xF8, 0x59, 0x29, 0xA9, 0x60, 0x26, 0x0B, 0xE5, 0xCF, 0x9F, 0x20, 0x46, 0x06, 0x5C, 0xAA,
+    0x3F, 0x52, 0x75, 0xFC, 0x56, 0x11, 0x84, 0xCB, 0x02, 0x99, 0x72, 0x93, 0x19, 0xC0, 0xFE, 0x9E,
+    0xAA, 0x67, 0x8E, 0x20, 0xE8, 0xBA, 0x1D, 0x4A, 0xE0, 0x46, 0xFB, 0x7A, 0x16, 0x57, 0xC7, 0xD8,
+    0xC1, 0x52, 0x18, 0xF1, 0xEB, 0x03, 0xEC, 0xA1, 0x0F, 0x6C, 0x58, 0xAE, 0xC9, 0x10, 0x97, 0x32,
+    0x36, 0xC6, 0x33, 0x80, 0x27, 0xD4, 0x33, 0x61, 0xC4, 0xCC, 0x9F, 0x80, 0xE9, 0x80, 0x5E, 0x68,
+    0x26, 0xB3, 0x9F, 0xC1, 0x1C, 0x65, 0x06, 0xAB, 0x97, 0xD9, 0xEB, 0xBD, 0xCA, 0x1A, 0xE2, 0x8E,
+    0x4A, 0x1C, 0x0D, 0x4B, 0xD7, 0xEC, 0x38, 0x2B, 0xE4, 0x2A, 0x70, 0x80, 0xC4, 0xD5, 0xBF, 0x33,
+    0x6E, 0xEB, 0x8C, 0xA5, 0xDE, 0xAC, 0x40, 0x78, 0x0B, 0xA8, 0x03, 0x08, 0xF3, 0x3E, 0xFB, 0x13,
+    0x6C, 0x43, 0x13, 0x27, 0x16, 0x3B, 0xBB, 0x3B, 0xD4, 0x89, 0x4E, 0x26, 0x2E, 0x4F, 0x47, 0xDB,
+    0xEF, 0x72, 0xEA, 0x00, 0xF0, 0xDC, 0x08, 0xC5, 0xA8, 0xA0, 0x2E, 0x55, 0x0E, 0x29, 0x71, 0x48,
+    0x7D, 0x43, 0x8A, 0x1B, 0x52, 0xD9, 0x90, 0xB2, 0x86, 0xD4, 0x34, 0xA4, 0xA0, 0x21, 0xD5, 0x0C,
+    0x29, 0x65, 0x48, 0x1D, 0x43, 0x8A, 0x18, 0x52, 0xC1, 0x90, 0xF2, 0x85, 0xD4, 0x2E, 0xA4, 0x70,
+    0x21, 0x55, 0x0B, 0x29, 0x59, 0x48, 0xBD, 0x42, 0x8A, 0x15, 0x52, 0xA9, 0xE0, 0xEE, 0x0D, 0x68,
+    0x15, 0x09, 0x6E, 0x98, 0x44, 0x9A, 0xB4, 0xFE, 0x9D, 0x01, 0x57, 0x60, 0x60, 0x79, 0x81, 0xC5,
+    0x05, 0x96, 0x16, 0x58, 0x58, 0xE0, 0x11, 0x67, 0x79, 0xE0, 0x71, 0x9A, 0x97, 0xD1, 0x65, 0x49,
+    0x9C, 0x90, 0x6A, 0x54, 0xFE, 0x71, 0xA1, 0xE9, 0xEC, 0x96, 0xE4, 0x50, 0x2E, 0x93, 0x86, 0x9F,
+    0x94, 0x9B, 0xEF, 0x1F, 0x12, 0xB2, 0xB6, 0x9B, 0x90, 0xF5, 0xED, 0x7E, 0x13, 0xB2, 0x72, 0x73,
+    0x61, 0xC1, 0x00, 0xF7, 0xC2, 0x7E, 0x21, 0x21, 0x2B, 0xCD, 0xCC, 0x91, 0x60, 0xF5, 0x70, 0xF1,
+    0x5A, 0xC3, 0xA3, 0xE6, 0x82, 0xD5, 0xE8, 0xC1, 0x60, 0x55, 0x94, 0x20, 0x41, 0x83, 0x2F, 0x3D,
+    0xD1, 0x80, 0x11, 0xD8, 0xFC, 0xF5, 0x15, 0xA5, 0xFE, 0x72, 0x11, 0xA8, 0x01, 0xE0, 0x4A, 0x63,
+    0x4F, 0xBD, 0xB8, 0x7F, 0x62, 0xE0, 0x8A, 0x48, 0xEC, 0xE1, 0x81, 0x6B, 0xF1, 0xB0, 0xC0, 0xD5,
+    0x19, 0x0F, 0x6F, 0x3E, 0xDC, 0x98, 0x83, 0x09, 0xF1, 0x46, 0x64, 0x58, 0x8B, 0xB3, 0x1B, 0xC6,
+    0x0E, 0x59, 0x67, 0x07, 0x32, 0x7D, 0x85, 0x6B, 0xE6, 0x80, 0x95, 0x7F, 0xD7, 0x61, 0x3A, 0x92,
+    0xE0, 0xF9, 0x05, 0xB5, 0x8B, 0x4D, 0x21, 0x2D, 0x6A, 0x36, 0xFB, 0x32, 0x93, 0x7D, 0x39, 0xC4,
+    0xBD, 0xFB, 0x14, 0xFE, 0xB0, 0x11, 0xDD, 0xD6, 0xC7, 0x41, 0xAA, 0x16, 0x90, 0x6A, 0x08, 0x52,
+    0x03, 0x4B, 0x90, 0x1A, 0x7E, 0x49, 0xDB, 0x11, 0x7D, 0x40, 0x48, 0x1A, 0xDF, 0x24, 0xD5, 0x97,
+    0x48, 0x6F, 0x10, 0xA4, 0xDE, 0x66, 0x99, 0x52, 0x7F, 0x58, 0x13, 0xA4, 0xDE, 0x5F, 0x11, 0xA4,
+    0xDA, 0x82, 0x20, 0xD5, 0xA6, 0xC7, 0x40, 0x2A, 0x69, 0xAE, 0xA2, 0x4F, 0xE8, 0x13, 0x27, 0xC5,
+    0xF6, 0x48, 0x59, 0x0B, 0x07, 0x79, 0x68, 0x25, 0x28, 0x2F, 0x4D, 0x84, 0xFB, 0x19, 0x7E, 0xB7,
+    0xA7, 0xF9, 0xAF, 0x04, 0x8E, 0xE2, 0x6C, 0xEA, 0x95, 0x6E, 0x11, 0x5B, 0x75, 0xE6, 0xA6, 0xED,
+    0xCD, 0xAD, 0xCF, 0x7A, 0xF3, 0xEE, 0x7B, 0xBD, 0x79, 0xFF, 0x56, 0x9F, 0x59, 0x98, 0xF2, 0x6E,
+    0xD6, 0x26, 0x5D, 0x42, 0x38, 0xCA, 0xFB, 0xB1, 0x09, 0x80, 0xAE, 0xBC, 0xA5, 0x09, 0x76, 0x16,
+    0xB2, 0x5C, 0x92, 0xE0, 0xEE, 0xC4, 0x06, 0x65, 0xCC, 0xF2, 0xAA, 0xF8, 0xB2, 0xA4, 0x35, 0xD3,
+    0x9D, 0xB3, 0x91, 0x50, 0x5A, 0x4C, 0x77, 0x10, 0xAB, 0x55, 0x92, 0x03, 0x8C, 0x56, 0x70, 0xE5,
+    0xB5, 0x86, 0x87, 0x9D, 0x9E, 0x62, 0x12, 0x49, 0xB6, 0x87, 0xB3, 0x3A, 0xB1, 0x4B, 0xB8, 0x1D,
+    0x74, 0x12, 0x2D, 0x5C, 0x94, 0xED, 0xB1, 0x75, 0x46, 0x12, 0x6B, 0x2C, 0x57, 0x1A, 0x42, 0x19,
+    0x9B, 0xCE, 0xEE, 0x5D, 0x2F, 0xA2, 0x62, 0x56, 0x4C, 0xBD, 0xDB, 0x38, 0x0D, 0x3D, 0x9C, 0xA4,
+    0x67, 0x9A, 0x8B, 0x51, 0x2B, 0xBD, 0x6D, 0xD8, 0xB4, 0x7B, 0x4B, 0x9A, 0x94, 0x62, 0xDD, 0x8E,
+    0xFF, 0xEE, 0xEE, 0xD9, 0x1F, 0xF7, 0x73, 0xD2, 0x78, 0x94, 0x13, 0x7B, 0xBC, 0x90, 0x3D, 0x5E,
+    0xC7, 0xB5, 0x2E, 0x67, 0xD8, 0xE3, 0xE1, 0xD1, 0xA4, 0x72, 0xE1, 0x9C, 0x2A, 0xAB, 0x34, 0x38,
+    0x9B, 0x7F, 0xE2, 0xBD, 0xA1, 0x43, 0x45, 0xA5, 0x40, 0xB0, 0x6D, 0xEA, 0x9B, 0x86, 0x06, 0xB1,
+    0xE1, 0x81, 0x41, 0xCC, 0x1A, 0xA7, 0x5B, 0xDE, 0x20, 0x11, 0xF4, 0x8E, 0x5A, 0x9A, 0xF9, 0xBE,
+    0xD6, 0xED, 0x60, 0xC9, 0x7B, 0x36, 0xED, 0xF8, 0xEF, 0xEE, 0x9E, 0x74, 0xDC, 0xCF, 0x49, 0xEB,
+    0x73, 0x1A, 0xF2, 0x6C, 0x5F, 0xDA, 0x55, 0x09, 0x36, 0xD7, 0xBC, 0xEA, 0x99, 0x6C, 0x86, 0x7F,
+    0x42, 0x4C, 0xB9, 0xE5, 0xFB, 0x77, 0xE8, 0xDA, 0xB5, 0xB8, 0x1F, 0x72, 0xF0, 0x4F, 0xD6, 0xE6,
+    0xDD, 0x91, 0x7E, 0xB6, 0x2F, 0xED, 0x28, 0xFD, 0x0E, 0xC6, 0xFB, 0x00, 0x73, 0xAF, 0x32, 0x44,
+    0xCC, 0x71, 0xBE, 0x1E, 0x8F, 0xA1, 0xCA, 0x37, 0x69, 0x0B, 0x1A, 0x69, 0x6D, 0xEB, 0x6C, 0xD9,
+    0xB6, 0xEA, 0xD7, 0x3B, 0x72, 0xC6, 0x34, 0xF7, 0x23, 0xFF, 0x66, 0x16, 0x70, 0x45, 0x3D, 0xCE,
+    0x5F, 0xC8, 0xDA, 0x83, 0x7F, 0x0A, 0xF6, 0x31, 0xA4, 0x95, 0x6B, 0x93, 0x83, 0xFE, 0xA2, 0x4A,
+    0xFC, 0x52, 0x63, 0x5D, 0x9E, 0xE4, 0x2F, 0xD8, 0xDD, 0x96, 0x40, 0x43, 0x1C, 0xB1, 0x8D, 0x79,
+    0xC4, 0xF5, 0x4F, 0xE5, 0x88, 0xDF, 0x94, 0x44, 0x54, 0xBA, 0x75, 0x96, 0x6A, 0xDF, 0xDB, 0xD8,
+    0x72, 0xFA, 0xDD, 0x46, 0xC5, 0xEF, 0xB5, 0x6A, 0x56, 0xDD, 0x50, 0x41, 0x93, 0xA4, 0x6A, 0x6B,
+    0x7A, 0x6A, 0xB5, 0x6F, 0xEF, 0x73, 0x26, 0xCE, 0xC8, 0xB9, 0x2A, 0xC4, 0x01, 0xC1, 0x89, 0x96,
+    0x0C, 0xD0, 0xD6, 0xC8, 0xBD, 0x9F, 0x01, 0x6D, 0xC8, 0x01, 0x04, 0x68, 0x0E, 0x58, 0x7D, 0xE8,
+    0xAF, 0x97, 0xB3, 0x32, 0x5C, 0x41, 0x88, 0xF4, 0xB4, 0xB4, 0xC1, 0x03, 0x21, 0x27, 0x50, 0x8E,
+    0xA0, 0x2B, 0xA8, 0xE1, 0x50, 0x60, 0xA7, 0x0C, 0xA7, 0x02, 0x76, 0xF2, 0x63, 0xE5, 0xE2, 0x3D,
+    0xE6, 0x48, 0x54, 0x72, 0xCF, 0x30, 0x62, 0x9B, 0x41, 0x0A, 0xC6, 0x1A, 0x63, 0x02, 0xB3, 0x9E,
+    0x7C, 0xB1, 0xD7, 0xF2, 0xBE, 0x9A, 0x24, 0xF7, 0x04, 0xC1, 0x1F, 0xA3, 0x3D, 0x86, 0x7C, 0x73,
+    0xE2, 0xD6, 0x88, 0x1D, 0x50, 0x0D, 0xC0, 0x1D, 0x4C, 0x40, 0xDA, 0x02, 0x44, 0x57, 0xB2, 0xF2,
+    0xEF, 0x60, 0xE5, 0xFF, 0xC9, 0x95, 0x37, 0x47, 0x56, 0x3E, 0x6C, 0x92, 0x15, 0x4C, 0xCB, 0x2A,
+    0xEC, 0x11, 0x31, 0x58, 0xB6, 0x52, 0xFC, 0x07, 0xB1, 0xC4, 0xE3, 0x34, 0xF7, 0x5E, 0x0C, 0x5F,
+    0x6C, 0x0D, 0xF9, 0xA6, 0x4C, 0x84, 0xA0, 0x55, 0xCD, 0x61, 0xCE, 0xD4, 0x74, 0x13, 0xA4, 0xD8,
+    0x37, 0xFD, 0x02, 0x48, 0x08, 0x8A, 0x70, 0x1F, 0xB0, 0x8D, 0x61, 0x92, 0x61, 0xC0, 0x34, 0x26,
+    0x0C, 0xB4, 0xFF, 0x61, 0x2A, 0xE5, 0xD3, 0x2B, 0xCC, 0x16, 0x08, 0xB9, 0x29, 0x09, 0x04, 0x49,
+    0x21, 0x60, 0xB5, 0x4D, 0x91, 0xB0, 0x83, 0x39, 0x9F, 0x98, 0xC9, 0xFB, 0xC8, 0xE2, 0x28, 0x99,
+    0x83, 0xA3, 0x63, 0x8E, 0x6D, 0x0B, 0x97, 0x0C, 0x7F, 0xEC, 0x76, 0x9C, 0xBE, 0xDC, 0xEB, 0x77,
+    0x7B, 0xFD, 0xDF, 0x4E, 0x23, 0x98, 0x95, 0x18, 0x1E, 0x5D, 0x9C, 0xF0, 0x37, 0x85, 0xE5, 0x54,
+    0xF1, 0x67, 0x0C, 0x60, 0x6B, 0x26, 0xA1, 0x5A, 0xBE, 0xD8, 0xF2, 0x3A, 0x04, 0x52, 0xD3, 0xB5,
+    0x40, 0xDF, 0x6A, 0x9D, 0x56, 0x4C, 0xEB, 0x2D, 0x98, 0xD6, 0x4F, 0x3B, 0xB7, 0x8D, 0x46, 0xA6,
+    0x55, 0x97, 0x93, 0x1E, 0xCD, 0x3E, 0xB2, 0x01, 0x57, 0x6A, 0x6C, 0x2D, 0xBE, 0xCA, 0x0D, 0x77,
+    0x6A, 0xE1, 0xE6, 0x2C, 0x0E, 0xAA, 0x91, 0xF4, 0x84, 0xD4, 0xE7, 0x63, 0x09, 0xEE, 0x08, 0x53,
+    0xFA, 0xB7, 0x2A, 0x15, 0xD4, 0xAA, 0xE1, 0xE0, 0x3B, 0xCF, 0xE5, 0x85, 0x05, 0xA6, 0x16, 0xF1,
+    0x0D, 0x37, 0x14, 0xF6, 0x53, 0x3E, 0xCF, 0xA3, 0xB5, 0x6F, 0x3C, 0xAD, 0x62, 0x34, 0x8F, 0x69,
+    0xE4, 0xF1, 0x89, 0xC6, 0x9E, 0x45, 0x64, 0xBF, 0xF6, 0xEB, 0xCC, 0xB2, 0xF0, 0x7D, 0xCD, 0x39,
+    0xB4, 0x11, 0xBA, 0xD0, 0x3D, 0xC7, 0xC6, 0x2A, 0x5D, 0xD2, 0x34, 0x11, 0x84, 0x72, 0x95, 0x09,
+    0xBE, 0x37, 0x6C, 0xE9, 0xB3, 0x55, 0x38, 0x8F, 0xF5, 0x26, 0x38, 0xA0, 0x3F, 0x90, 0x86, 0x29,
+    0xBF, 0xBE, 0x09, 0xCD, 0x98, 0xFE, 0x48, 0x04, 0x23, 0x60, 0xD3, 0xE6, 0xDF, 0x93, 0xBA, 0x83,
+    0xA9, 0xDD, 0x1B, 0xA2, 0xB1, 0x44, 0x11, 0xBD, 0x92, 0xD7, 0x35, 0x25, 0xEE, 0xB5, 0xE9, 0x9F,
+    0xC1, 0xD9, 0x37, 0x6B, 0x0C, 0xB2, 0x32, 0xA3, 0x57, 0x88, 0xA4, 0x8E, 0xDB, 0xFB, 0xCC, 0xF4,
+    0x8E, 0x8B, 0xF4, 0x84, 0xA4, 0x6B, 0xE2, 0x7C, 0xE7, 0xA9, 0x93, 0x51, 0x26, 0xAE, 0x1D, 0xDE,
+    0x6A, 0x88, 0xC4, 0xE4, 0x17, 0x7E, 0xE9, 0xA8, 0x87, 0x96, 0x95, 0x85, 0x09, 0x8D, 0x70, 0xAF,
+    0x2D, 0xA2, 0x8B, 0xFE, 0x42, 0xB7, 0x8B, 0x60, 0xEF, 0xC1, 0xBF, 0x90, 0xEB, 0xFC, 0x93, 0xD0,
+    0xF6, 0x7C, 0xB9, 0x93, 0xF6, 0x58, 0x96, 0x39, 0x29, 0x19, 0xC4, 0x40, 0x7F, 0x7A, 0xAD, 0xD5,
+    0xC0, 0x0C, 0xD9, 0x31, 0x49, 0x13, 0xEA, 0x8F, 0x60, 0x0F, 0xBF, 0xEF, 0xB2, 0x7C, 0x1B, 0x42,
+    0x64, 0x12, 0x50, 0xA7, 0x7B, 0x96, 0xBE, 0x81, 0x6B, 0x26, 0x39, 0xCE, 0xBB, 0x4C, 0x9B, 0x1E,
+    0xCD, 0x6C, 0x7B, 0x22, 0x81, 0x9E, 0x4B, 0x8B, 0xB7, 0xDE, 0x79, 0x19, 0x58, 0x92, 0x3D, 0x67,
+    0x7C, 0xF8, 0x8A, 0x06, 0x5D, 0xC6, 0x8D, 0x23, 0xFF, 0x03, 0x03, 0x5F, 0x5A, 0x84, 0x54, 0x62,
+    0x84, 0xE7, 0x6F, 0xD8, 0x62, 0xB3, 0xE2, 0xD8, 0x3E, 0x13, 0x16, 0xB8, 0x7A, 0xD9, 0x38, 0x04,
+    0x77, 0xC1, 0x5D, 0xD9, 0x52, 0xA5, 0x0B, 0x23, 0xA5, 0x66, 0x56, 0x4A, 0x2A, 0x57, 0x12, 0x4D,
+    0x56, 0x8A, 0xF6, 0xDC, 0xF9, 0x19, 0x66, 0xF9, 0x2B, 0xF7, 0xDE, 0xF8, 0x16, 0x22, 0x2C, 0xA6,
+    0x57, 0x32, 0xE0, 0x5D, 0xFC, 0xCE, 0x84, 0x0B, 0x37, 0x84, 0xCF, 0x01, 0xC8, 0x20, 0xC9, 0xEA,
+    0x71, 0xC8, 0xC1, 0xD2, 0x30, 0x63, 0x6B, 0xC7, 0xE4, 0x71, 0x9F, 0x25, 0x79, 0x8C, 0xAA, 0xA7,
+    0x7B, 0x53, 0xF7, 0xEB, 0xC9, 0xAB, 0x98, 0xB9, 0xCD, 0x5C, 0x4A, 0xB3, 0x56, 0xCC, 0x0E, 0x29,
+    0xA6, 0x87, 0x94, 0xA4, 0x80, 0x6D, 0xFE, 0x84, 0xE4, 0x7F, 0x8D, 0x55, 0xBD, 0x6F, 0x1C, 0x45,
+    0x14, 0xFF, 0xED, 0x6D, 0x2E, 0x17, 0xB2, 0xE0, 0x35, 0xE1, 0x2E, 0x20, 0x45, 0x78, 0x28, 0x28,
+    0x22, 0x27, 0xF6, 0xA6, 0x48, 0x91, 0x48, 0x7B, 0x37, 0x93, 0x8A, 0x82, 0x22, 0x87, 0xE4, 0x03,
+    0x89, 0x02, 0x5D, 0x91, 0x06, 0x0B, 0x12, 0x97, 0x0E, 0x3A, 0xDF, 0xAE, 0xC2, 0x3F, 0x70, 0x7F,
+    0x82, 0x1B, 0x24, 0xE7, 0x90, 0x90, 0x0B, 0x47, 0x72, 0x84, 0x73, 0xBB, 0x52, 0xBA, 0x50, 0x30,
+    0x22, 0x48, 0x29, 0x10, 0x68, 0x25, 0x52, 0x44, 0x72, 0xC1, 0x44, 0xDA, 0x62, 0x05, 0x73, 0x37,
+    0xBC, 0xD9, 0xBD, 0x84, 0xC4, 0x7C, 0x88, 0xF9, 0xDA, 0xF9, 0x78, 0xEF, 0xCD, 0x9B, 0xF7, 0x7E,
+    0xEF, 0x6D, 0x4B, 0x80, 0x2B, 0x78, 0x05, 0x6A, 0x33, 0x20, 0x12, 0xA8, 0x0B, 0xF4, 0xE0, 0x1A,
+    0x78, 0x1A, 0x2C, 0xB3, 0x1B, 0x4D, 0xA0, 0xDC, 0x89, 0x3D, 0x93, 0x05, 0x3F, 0xE5, 0x89, 0x33,
+    0x5D, 0x43, 0x8B, 0xF6, 0xBC, 0x8C, 0x71, 0x33, 0x89, 0xCC, 0x74, 0x9F, 0xE5, 0x5D, 0x88, 0xF5,
+    0xF1, 0xC8, 0x18, 0x45, 0xAD, 0xD7, 0xEB, 0x2E, 0x8F, 0xC7, 0x31, 0x37, 0x26, 0xB5, 0xBD, 0xD5,
+    0xEB, 0x89, 0x26, 0x5A, 0x1D, 0x74, 0xF8, 0x1F, 0x53, 0xDF, 0x14, 0xAE, 0x91, 0xA5, 0x48, 0x9E,
+    0x46, 0x32, 0x92, 0x41, 0x0C, 0x04, 0x4E, 0xCE, 0xEF, 0x6B, 0xFE, 0xA5, 0x66, 0x4E, 0x4E, 0xFB,
+    0x8A, 0xEB, 0x53, 0x1A, 0xDA, 0x2B, 0x7C, 0x79, 0x3C, 0xAE, 0x0B, 0x9E, 0x4F, 0x74, 0xDE, 0xCE,
+    0xDB, 0x43, 0x1D, 0xE4, 0x8E, 0x70, 0xD6, 0x5A, 0xA2, 0xA1, 0x93, 0xD8, 0x7F, 0x3A, 0x43, 0x70,
+    0xBF, 0xC0, 0xD0, 0x23, 0x69, 0x75, 0xC0, 0xAA, 0x14, 0x89, 0x04, 0xC1, 0x43, 0x0D, 0xCF, 0x28,
+    0xD8, 0x5B, 0xD0, 0x23, 0xE5, 0xB7, 0xA8, 0x7C, 0xBA, 0xD6, 0xD2, 0xBC, 0xAA, 0x3B, 0xCB, 0xAD,
+    0x7A, 0x17, 0xFC, 0xBB, 0x02, 0xEC, 0x07, 0x8D, 0x86, 0x9A, 0xC0, 0x29, 0x02, 0x51, 0x8A, 0x18,
+    0x00, 0x06, 0xCD, 0x59, 0xB3, 0x7D, 0x76, 0x10, 0x5C, 0x29, 0x7C, 0xA3, 0x1A, 0x26, 0xB5, 0x9A,
+    0xF6, 0xD0, 0xA0, 0x87, 0x9B, 0x82, 0x8F, 0xF5, 0x00, 0xED, 0x26, 0x9A, 0x8D, 0xCC, 0xCF, 0x98,
+    0x0C, 0x52, 0x7A, 0x41, 0x9C, 0xC4, 0x2D, 0x32, 0x53, 0x90, 0x71, 0x5A, 0x71, 0x11, 0x61, 0x42,
+    0x1C, 0x89, 0x48, 0x62, 0xBB, 0x66, 0xA9, 0x2F, 0xBD, 0xCC, 0x11, 0x47, 0xCF, 0x5B, 0xA5, 0xC5,
+    0x7D, 0xB2, 0xF8, 0x94, 0x2C, 0x0E, 0xD4, 0xAD, 0xA6, 0x8E, 0x89, 0xDD, 0x29, 0xFC, 0x1C, 0x41,
+    0x5A, 0x5A, 0x17, 0x4E, 0x76, 0x3A, 0x4B, 0xB2, 0x0F, 0x33, 0x27, 0x83, 0x00, 0xF6, 0x70, 0x57,
+    0x24, 0xD9, 0xDD, 0xEE, 0x1E, 0x16, 0xE9, 0x2C, 0x99, 0xAD, 0x7F, 0x83, 0xA5, 0xE7, 0x15, 0xEE,
+    0xB4, 0x41, 0xF6, 0x8A, 0x54, 0x22, 0x27, 0x74, 0x5A, 0xE7, 0xF7, 0xF2, 0xFD, 0x68, 0xA9, 0x16,
+    0xBB, 0xA9, 0x9B, 0x9E, 0x7B, 0xC2, 0x35, 0xB0, 0xBC, 0xC3, 0xB5, 0x5D, 0xB9, 0xA9, 0x15, 0x6D,
+    0xBF, 0x5C, 0x9F, 0x7B, 0xE2, 0xA6, 0xB5, 0xD8, 0x9E, 0xD0, 0x65, 0x3B, 0x35, 0x5D, 0xD5, 0x86,
+    0x8E, 0x48, 0x50, 0x14, 0xDF, 0xC6, 0x6C, 0x5E, 0x8D, 0x48, 0x72, 0x9E, 0x33, 0x72, 0x0D, 0x3D,
+    0x59, 0x72, 0x7A, 0xF8, 0xCB, 0x2E, 0x3B, 0xEA, 0x22, 0x3A, 0x95, 0xF6, 0xB1, 0x9C, 0x9E, 0xDA,
+    0x48, 0xFD, 0xEC, 0xB8, 0xC6, 0xF4, 0xB4, 0x8E, 0x34, 0xCF, 0x1C, 0xF8, 0x71, 0x07, 0x07, 0x98,
+    0xC2, 0xA8, 0x48, 0x79, 0xDB, 0x95, 0x73, 0x96, 0xC7, 0x3B, 0xDC, 0xE8, 0x10, 0xE1, 0x25, 0x9C,
+    0xA7, 0xD6, 0x2C, 0xD1, 0xB1, 0x11, 0xBE, 0x76, 0x79, 0x32, 0x60, 0x87, 0x74, 0x2B, 0xF9, 0xB6,
+    0x5E, 0xFA, 0x96, 0xFD, 0x6A, 0x7D, 0x9B, 0x3F, 0xF7, 0xED, 0x8B, 0xA8, 0x8C, 0x4A, 0x54, 0x92,
+    0x6D, 0xB7, 0xB0, 0xC5, 0x0F, 0x35, 0x33, 0x79, 0xA3, 0xC2, 0xD9, 0xDF, 0xBC, 0x37, 0x47, 0xEE,
+    0x6C, 0x92, 0x18, 0x5D, 0x10, 0x72, 0x9D, 0x97, 0x90, 0xDB, 0xA3, 0x6E, 0x68, 0x3A, 0x1E, 0x8F,
+    0xB7, 0x69, 0x0E, 0x9A, 0x0B, 0x9A, 0x5B, 0xAB, 0xE1, 0xD9, 0x7A, 0x7D, 0xBE, 0xF6, 0x72, 0x1F,
+    0xDC, 0x24, 0xA0, 0x10, 0xC0, 0x01, 0x2B, 0xC8, 0x33, 0x02, 0x47, 0x91, 0xDF, 0xB3, 0xA5, 0x9B,
+    0x10, 0x9B, 0xC9, 0xAA, 0x91, 0xB8, 0xC7, 0xE3, 0x51, 0x29, 0x60, 0x03, 0x6E, 0x81, 0x40, 0x3B,
+    0x46, 0xFA, 0x33, 0xF0, 0x1C, 0x4C, 0xE0, 0x18, 0xE6, 0xC5, 0x27, 0x2B, 0xD3, 0x1A, 0x9C, 0xE6,
+    0x1D, 0xEA, 0xF7, 0xA8, 0x5B, 0x47, 0x91, 0x41, 0x6A, 0x8A, 0x5C, 0x98, 0x01, 0x0D, 0x39, 0x27,
+    0xB3, 0x31, 0x34, 0x27, 0xDB, 0xAA, 0xC8, 0x50, 0xCC, 0xC9, 0xD4, 0x5F, 0x64, 0xFE, 0x9C, 0x6C,
+    0x99, 0x7A, 0x57, 0x0F, 0xD9, 0xEA, 0x74, 0xEF, 0x5D, 0xBC, 0x55, 0x19, 0xBD, 0xDD, 0x1B, 0x90,
+    0x0F, 0x5A, 0xBD, 0x35, 0x0B, 0x2E, 0x33, 0xBB, 0xD3, 0xFB, 0x64, 0x17, 0x0B, 0xD4, 0x68, 0xBE,
+    0x3E, 0xBE, 0x4D, 0x9B, 0xE4, 0x89, 0xCB, 0xC3, 0xCF, 0xC8, 0x2B, 0x34, 0x5F, 0x14, 0x77, 0x08,
+    0xCF, 0x81, 0x88, 0xE4, 0x2E, 0x69, 0x81, 0x60, 0x3F, 0x1F, 0xAC, 0xF8, 0xD7, 0x0B, 0xFC, 0x9B,
+    0xBD, 0xEC, 0xBA, 0xC2, 0x3C, 0xE5, 0x14, 0x87, 0xB2, 0x0C, 0x8F, 0xFF, 0x39, 0xCB, 0x58, 0x9B,
+    0x3E, 0x66, 0x2F, 0xD8, 0x34, 0x07, 0x25, 0x16, 0xAC, 0x23, 0x49, 0x6F, 0xA4, 0x7E, 0xCA, 0x04,
+    0x59, 0xA7, 0x46, 0xDA, 0xB0, 0xF7, 0xA6, 0x5B, 0x36, 0x86, 0x0D, 0xF8, 0xF7, 0xCA, 0x80, 0x5D,
+    0x95, 0xF4, 0x6C, 0x92, 0x48, 0x81, 0x43, 0xB0, 0x13, 0x3C, 0xE3, 0x8A, 0x29, 0x2B, 0x2D, 0x32,
+    0x46, 0x0E, 0xC7, 0x5F, 0xCB, 0x4D, 0xD4, 0xCA, 0x7E, 0x0D, 0xCE, 0xE8, 0xBF, 0xB4, 0x7C, 0x29,
+    0x4F, 0x50, 0xBC, 0xAD, 0x67, 0xA8, 0x2A, 0x19, 0xFE, 0xEA, 0x31, 0x36, 0x0D, 0xC9, 0x48, 0x97,
+    0x12, 0xB5, 0x98, 0x09, 0xCB, 0x49, 0x2A, 0x53, 0xB8, 0x25, 0xD6, 0xE8, 0x9E, 0x0C, 0x83, 0xD9,
+    0x01, 0x37, 0xC5, 0xE6, 0x19, 0x85, 0xB3, 0xE5, 0x3E, 0xB5, 0xB3, 0x15, 0x4A, 0x42, 0x82, 0x5F,
+    0x18, 0xA8, 0x45, 0xFB, 0xBA, 0x90, 0x99, 0xA2, 0x1D, 0xA8, 0x26, 0x85, 0xC9, 0x15, 0x34, 0x6E,
+    0x49, 0x3A, 0xF2, 0x0F, 0x55, 0xED, 0x56, 0x5C, 0xEA, 0x72, 0x12, 0x41, 0x1C, 0xC4, 0x3E, 0x6C,
+    0x8D, 0x6C, 0xC6, 0x90, 0xD5, 0xB8, 0x61, 0x0F, 0x69, 0xA4, 0x4C, 0x21, 0xFB, 0x78, 0x70, 0x01,
+    0x23, 0x9C, 0x10, 0xA7, 0x68, 0xEF, 0x55, 0xB8, 0x34, 0xF6, 0xC9, 0xA1, 0xE8, 0xD3, 0xB8, 0x3D,
+    0x9A, 0x53, 0x92, 0xCB, 0x2F, 0xC8, 0x0D, 0xD2, 0x72, 0x51, 0x6E, 0xD8, 0x53, 0x69, 0x69, 0xB6,
+    0x81, 0x13, 0xA8, 0x59, 0x2E, 0xF1, 0x06, 0xF0, 0x8E, 0xF3, 0xE0, 0x22, 0xE2, 0x4A, 0x66, 0xC5,
+    0xF5, 0x45, 0xBC, 0x1C, 0x2F, 0xD3, 0x8D, 0x11, 0x05, 0x39, 0x70, 0x8D, 0x6C, 0xE9, 0x49, 0x26,
+    0x87, 0x24, 0xDB, 0x21, 0xE0, 0x44, 0x14, 0xB8, 0x03, 0x82, 0x23, 0xB3, 0xC6, 0x98, 0x08, 0x4A,
+    0xB2, 0xEC, 0xB0, 0xA0, 0x68, 0x0E, 0x87, 0x21, 0xE5, 0x4D, 0xFB, 0x5C, 0x8B, 0xDD, 0x0B, 0xB1,
+    0xCD, 0xE9, 0x3C, 0xBD, 0x29, 0xC9, 0x71, 0x23, 0x8F, 0xB8, 0x87, 0x60, 0xA9, 0x33, 0xEA, 0xD3,
+    0xD7, 0x93, 0x9E, 0x8C, 0x44, 0x9F, 0x54, 0xE9, 0x0E, 0x6B, 0xCA, 0x7B, 0x98, 0x7B, 0x8F, 0x06,
+    0xFC, 0xFD, 0xF3, 0xFD, 0x85, 0x85, 0x45, 0x92, 0x1C, 0x91, 0x64, 0x46, 0x54, 0x9B, 0xA5, 0x25,
+    0x28, 0xD5, 0x64, 0x55, 0xAA, 0x71, 0xD3, 0x37, 0x7F, 0xE4, 0xDA, 0xCB, 0x7C, 0xF5, 0x4A, 0xBF,
+    0x02, 0xE2, 0xCD, 0xC9, 0xE7, 0xBB, 0xE1, 0x02, 0xB5, 0x36, 0x65, 0x88, 0x47, 0xF9, 0x25, 0x5C,
+    0x44, 0x94, 0xAD, 0x4B, 0x27, 0x75, 0xE2, 0xA1, 0xE5, 0xBD, 0xC7, 0x2D, 0x9B, 0xF6, 0x29, 0xBB,
+    0xDE, 0x50, 0xAE, 0x0D, 0xBA, 0xD4, 0x22, 0x81, 0x96, 0xC7, 0x93, 0x59, 0x8C, 0xFF, 0x43, 0x63,
+    0x63, 0x74, 0xDB, 0xEE, 0x96, 0x30, 0x3A, 0xBA, 0xAC, 0x4A, 0xC3, 0xFC, 0x2E, 0xD0, 0x66, 0xB4,
+    0x3B, 0xD6, 0xFC, 0x37, 0xFA, 0x14, 0x03, 0xD4, 0x13, 0x23, 0x6D, 0x82, 0xB6, 0xA6, 0x68, 0xD9,
+    0x60, 0x3A, 0x63, 0x28, 0x61, 0x39, 0x96, 0x55, 0x34, 0xCC, 0x57, 0x1F, 0x9B, 0x8C, 0x3D, 0xA6,
+    0xCD, 0x9C, 0x93, 0x6B, 0x1C, 0xDD, 0x9C, 0xA3, 0xE8, 0x59, 0x71, 0xCB, 0x74, 0xF1, 0x51, 0x66,
+    0xC9, 0x4D, 0x91, 0x3C, 0xBF, 0xD0, 0x2D, 0xD1, 0xE1, 0xA0, 0x3E, 0xF2, 0x35, 0x56, 0x08, 0x86,
+    0x2B, 0xED, 0x2D, 0xF6, 0x33, 0xA9, 0x2A, 0x86, 0x4A, 0x6D, 0x9A, 0x42, 0xE1, 0x6E, 0x3F, 0x20,
+    0xCA, 0xDD, 0x7E, 0x77, 0xAF, 0x2C, 0xCE, 0x88, 0xE9, 0x70, 0x35, 0x5C, 0x0A, 0x97, 0x56, 0xB7,
+    0x3C, 0xCA, 0x18, 0xCD, 0xBA, 0x9D, 0x53, 0x5D, 0xED, 0x0C, 0xD9, 0x2F, 0xC4, 0x38, 0x0A, 0xD4,
+    0x80, 0x2C, 0xBD, 0x89, 0x4E, 0xBF, 0x8C, 0x94, 0xB7, 0xB1, 0x7A, 0xFC, 0x7A, 0x30, 0xAB, 0x78,
+    0x3A, 0x43, 0x9F, 0x84, 0x2B, 0xAA, 0x4F, 0x63, 0x93, 0xE7, 0xFB, 0x6A, 0xB3, 0xAA, 0xAF, 0x6F,
+    0x5F, 0xE3, 0x66, 0x1A, 0x76, 0x96, 0xC2, 0x15, 0xFF, 0x59, 0x5B, 0xF8, 0x20, 0xFE, 0x36, 0x3D,
+    0xA0, 0xDF, 0x53, 0x55, 0x4F, 0x82, 0x75, 0x79, 0x56, 0xFD, 0x95, 0xFC, 0xAE, 0x97, 0xD9, 0xAB,
+    0x11, 0x2E, 0x61, 0xE5, 0x3C, 0x16, 0x42, 0xF8, 0x7B, 0xF4, 0xC7, 0x85, 0x4B, 0x79, 0xB9, 0xB5,
+    0x12, 0xFA, 0x79, 0x23, 0xF3, 0xD4, 0xD2, 0x20, 0x5C, 0xFD, 0x13, 0xDD, 0x7D, 0x3D, 0x8C, 0x1D,
+    0x57, 0x96, 0xDE, 0xAD, 0xF7, 0x96, 0x7C, 0x18, 0x15, 0xB0, 0xC5, 0x40, 0x34, 0xEC, 0xA1, 0xBD,
+    0xB5, 0x81, 0x61, 0xD8, 0xF2, 0x42, 0x95, 0x38, 0x98, 0x0D, 0x46, 0x55, 0x92, 0xE0, 0x55, 0xA0,
+    0x40, 0x0D, 0x58, 0xAD, 0x01, 0xCC, 0x80, 0x93, 0x38, 0xB0, 0xC6, 0x46, 0x6F, 0xE0, 0x05, 0x1C,
+    0xEC, 0x6E, 0x95, 0xC4, 0x80, 0xC0, 0x2A, 0x20, 0x61, 0x58, 0x3B, 0x80, 0x13, 0x31, 0x60, 0x20,
+    0x35, 0x01, 0xF7, 0x04, 0x1B, 0x0C, 0x8C, 0xB1, 0x6E, 0x91, 0x04, 0xCC, 0x40, 0x81, 0xDE, 0xCC,
+    0x80, 0xDE, 0x50, 0x4F, 0xF6, 0xD0, 0xE3, 0x69, 0x05, 0xAC, 0x91, 0x4A, 0x3B, 0xD5, 0xAD, 0xAA,
+    0xBA, 0x3E, 0xDF, 0x77, 0x6E, 0xBD, 0x57, 0xAF, 0x7F, 0xC8, 0xE6, 0xF0, 0x6F, 0xD7, 0xCD, 0xBE,
+    0xE7, 0xBE, 0x7E, 0x55, 0x75, 0xEB, 0xFE, 0x9C, 0x7B, 0xFE, 0xCF, 0xE5, 0xA9, 0x0D, 0x63, 0xA2,
+    0xD6, 0x98, 0x89, 0x33, 0xC6, 0xD8, 0xCC, 0x98, 0xB8, 0x34, 0x26, 0x90, 0x5A, 0x7E, 0x72, 0xE7,
+    0x0A, 0x3B, 0x2E, 0x72, 0x69, 0xAD, 0xEC, 0x6E, 0x1B, 0xF9, 0x7E, 0x55, 0x0E, 0x5E, 0xD7, 0x7B,
+    0xD6, 0xDA, 0x08, 0x8B, 0x9F, 0x98, 0x78, 0xD1, 0x9B, 0xF8, 0x73, 0x67, 0xA2, 0x79, 0x67, 0x86,
+    0x9F, 0x27, 0xF1, 0x2E, 0x69, 0xD3, 0xB1, 0xE5, 0x03, 0xD0, 0x24, 0x95, 0x39, 0x1A, 0xFE, 0x8D,
+    0x2B, 0x04, 0x3A, 0xD7, 0x10, 0xF6, 0x80, 0x3B, 0x2E, 0x93, 0xAB, 0x81, 0x5C, 0x90, 0x7B, 0xE4,
+    0x2D, 0x02, 0xF3, 0x72, 0xF5, 0xD9, 0x01, 0xFE, 0x11, 0xAF, 0xA2, 0x69, 0x81, 0x1D, 0x61, 0x8D,
+    0xF6, 0xCE, 0x02, 0x6C, 0x66, 0x26, 0x90, 0x36, 0xA6, 0xF2, 0x7D, 0x24, 0xDF, 0x26, 0xA5, 0xFF,
+    0x9E, 0xBD, 0x99, 0xAF, 0x15, 0xB9, 0xF4, 0xA8, 0x45, 0x7F, 0x4E, 0xBB, 0x3D, 0x36, 0x5F, 0x4E,
+    0x64, 0xC0, 0xD9, 0xCC, 0xED, 0x5A, 0x13, 0xF5, 0xE6, 0x94, 0x49, 0xD0, 0xAD, 0x14, 0x63, 0x4D,
+    0xE7, 0xE8, 0xC0, 0xDD, 0xCD, 0x0D, 0xDC, 0x56, 0x8D, 0xC1, 0x7C, 0xB8, 0x9A, 0x2E, 0x30, 0x25,
+    0x78, 0x22, 0xEE, 0x4C, 0x60, 0x42, 0x77, 0x77, 0xC7, 0x4C, 0x39, 0x81, 0x58, 0x00, 0x73, 0x0E,
+    0xEF, 0x18, 0x86, 0x12, 0xD8, 0x4E, 0x6E, 0x70, 0x73, 0x99, 0xB5, 0x32, 0xDD, 0xB7, 0x65, 0x5E,
+    0x06, 0xD9, 0xB0, 0x2C, 0xB9, 0xBC, 0x2F, 0x95, 0xB9, 0x8C, 0xDC, 0x42, 0x9E, 0xEF, 0xF0, 0x78,
+    0x26, 0x37, 0xE3, 0xEA, 0x42, 0x7B, 0x93, 0x54, 0x57, 0xE4, 0x6D, 0xEE, 0x7D, 0x37, 0x97, 0xE6,
+    0x4B, 0xBC, 0x22, 0xC1, 0x04, 0x3E, 0x8F, 0x21, 0xD9, 0x13, 0xFE, 0x43, 0x87, 0xE3, 0x22, 0xDF,
+    0x2A, 0xE5, 0xF7, 0xA5, 0xA8, 0xD0, 0x6E, 0xCD, 0xDA, 0x47, 0xFA, 0x35, 0x71, 0xF5, 0x48, 0xBF,
+    0x82, 0x1F, 0xE9, 0xE2, 0x05, 0x37, 0x4F, 0x65, 0x52, 0x9C, 0x49, 0x1B, 0xF6, 0x29, 0x75, 0x8A,
+    0x1C, 0x29, 0xD1, 0x6C, 0x55, 0xE7, 0x43, 0x5D, 0x44, 0xC7, 0xD5, 0xFD, 0x47, 0xDC, 0xA4, 0x11,
+    0xD6, 0x49, 0xEB, 0xCE, 0xD7, 0x8E, 0x75, 0x33, 0x93, 0x99, 0x95, 0x7D, 0xD5, 0x18, 0x41, 0x48,
+    0xD6, 0x32, 0x2F, 0x6B, 0xB5, 0x2B, 0x26, 0xA8, 0x27, 0xAE, 0xB8, 0xDE, 0x0B, 0x4A, 0xEC, 0x38,
+    0xE3, 0x5A, 0x59, 0x18, 0x41, 0x75, 0x79, 0x79, 0x84, 0x1E, 0xC8, 0x22, 0x49, 0x9D, 0x09, 0xB2,
+    0x78, 0x24, 0x2D, 0x4D, 0xAA, 0xB8, 0x05, 0xA4, 0x78, 0x88, 0x4A, 0x3A, 0x25, 0x18, 0xC2, 0x8A,
+    0xE8, 0x2D, 0x3F, 0x75, 0xBE, 0xBB, 0x6D, 0xF7, 0x5D, 0xCB, 0x5B, 0xC2, 0x8E, 0xD5, 0xB4, 0x3F,
+    0xA2, 0xD2, 0x6B, 0xBB, 0x96, 0x77, 0xE2, 0x39, 0x56, 0x73, 0x56, 0x7B, 0xE6, 0xB7, 0xD8, 0xD7,
+    0x1F, 0x1F, 0xDA, 0xD7, 0xBA, 0x5B, 0x27, 0xBA, 0xAF, 0xC7, 0xBB, 0xFB, 0x81, 0xD0, 0x9C, 0xDD,
+    0xC0, 0x32, 0xC8, 0x18, 0x03, 0xBC, 0x74, 0x2A, 0x78, 0x62, 0x22, 0xEC, 0x95, 0x53, 0xD9, 0x6A,
+    0xCE, 0xB0, 0x05, 0x8C, 0xCB, 0xF2, 0x72, 0xEA, 0xE4, 0xCF, 0xB0, 0x15, 0x10, 0xD7, 0x02, 0x64,
+    0x53, 0x01, 0xA7, 0x4D, 0x7E, 0x43, 0xE6, 0x38, 0xFF, 0xA2, 0x47, 0xDF, 0xDB, 0x25, 0xC0, 0x9F,
+    0x37, 0x71, 0xA1, 0x94, 0xED, 0x91, 0x97, 0x39, 0x6E, 0x4E, 0xF0, 0x58, 0x84, 0x06, 0x66, 0xBD,
+    0x80, 0x09, 0x1A, 0x15, 0xB2, 0x23, 0x40, 0x2E, 0xB3, 0x2B, 0xDC, 0xA3, 0x40, 0x57, 0xED, 0x90,
+    0x49, 0xB3, 0x51, 0x67, 0x70, 0x1F, 0xE6, 0x0F, 0x93, 0x18, 0x00, 0x4C, 0x01, 0x66, 0x00, 0x11,
+    0x40, 0x7C, 0x4F, 0x40, 0xFA, 0xA9, 0x80, 0xFC, 0x0D, 0x01, 0x2E, 0xAA, 0xF3, 0x1B, 0x9D, 0x80,
+    0x5B, 0xAD, 0x80, 0xDB, 0xB5, 0x80, 0x4F, 0x2B, 0x01, 0x9F, 0xCD, 0x05, 0xB8, 0x12, 0x20, 0x03,
+    0x10, 0x5A, 0x96, 0x77, 0x00, 0x2D, 0x40, 0x0D, 0xD2, 0xF6, 0xA6, 0xFC, 0x13, 0x2C, 0xC3, 0x18,
+    0x2E, 0x76, 0xC0, 0x6B, 0x99, 0xED, 0xD0, 0x61, 0x62, 0x36, 0x57, 0xF3, 0x12, 0x36, 0x32, 0x03,
+    0x51, 0x95, 0x60, 0x73, 0xC8, 0x33, 0xB2, 0xD4, 0x1C, 0x59, 0x6B, 0x6C, 0x31, 0x15, 0x24, 0x94,
+    0x11, 0x04, 0xD2, 0x80, 0x7B, 0x55, 0x1A, 0x90, 0x2E, 0x48, 0x2B, 0x9F, 0xC8, 0xE0, 0xE2, 0x7B,
+    0x95, 0x92, 0x0F, 0x25, 0x1B, 0x53, 0x50, 0xE9, 0xA9, 0x4C, 0x93, 0x99, 0xC9, 0x78, 0x9F, 0xDB,
+    0x69, 0x71, 0xB1, 0xF1, 0x77, 0x44, 0xF8, 0xDE, 0x6C, 0xE8, 0xDB, 0x92, 0xC5, 0x63, 0x07, 0x82,
+    0xC1, 0x0B, 0xA0, 0xDB, 0x08, 0x90, 0xB6, 0x1F, 0x04, 0xC1, 0x9B, 0xF8, 0x84, 0xEE, 0x0A, 0x04,
+    0x39, 0xD5, 0xA9, 0x88, 0xB0, 0x75, 0x4D, 0xF4, 0x0D, 0x96, 0x2C, 0xF9, 0x25, 0x36, 0x76, 0xFA,
+    0x73, 0xAC, 0x5C, 0x7E, 0x0B, 0x0F, 0xD9, 0x77, 0xB0, 0x80, 0x2E, 0x73, 0x5C, 0x4A, 0x19, 0xC9,
+    0x84, 0x9C, 0x6E, 0xEA, 0xB6, 0xA5, 0xA1, 0x19, 0xDF, 0x25, 0x54, 0x56, 0x9A, 0x88, 0x08, 0x05,
+    0xA3, 0x64, 0x4F, 0x0B, 0x05, 0x15, 0xF4, 0x90, 0x69, 0x9D, 0x75, 0xA0, 0xDE, 0x98, 0x46, 0x3C,
+    0x42, 0x72, 0xBE, 0x56, 0x0E, 0xB2, 0x0B, 0xF7, 0xAB, 0x81, 0x05, 0xC9, 0x82, 0x62, 0x57, 0x46,
+    0xB2, 0xED, 0xA6, 0x28, 0xBD, 0xD6, 0xB2, 0x0D, 0xB1, 0x07, 0xF5, 0xBA, 0xDC, 0xB7, 0xC7, 0x67,
+    0x84, 0xFA, 0x2F, 0xA4, 0x34, 0x56, 0xAE, 0x59, 0xB9, 0xC7, 0xCA, 0xBD, 0x5A, 0xC2, 0xD6, 0xDE,
+    0xB1, 0xB5, 0x5C, 0x9B, 0xFB, 0xD2, 0xF8, 0xEB, 0xCE, 0x0A, 0xDE, 0x6A, 0x3D, 0x73, 0xF2, 0x5C,
+    0x27, 0xD7, 0x5A, 0x6D, 0xA7, 0x7F, 0x32, 0x6C, 0x30, 0x26, 0x6D, 0x5C, 0x6E, 0xF6, 0x15, 0x14,
+    0x12, 0x33, 0xC0, 0x54, 0x61, 0x79, 0x3F, 0x98, 0x2B, 0x04, 0x72, 0xCA, 0x7A, 0x10, 0x62, 0x86,
+    0xF5, 0x77, 0xAB, 0xDF, 0xBE, 0xEE, 0xAE, 0x5A, 0x92, 0xB6, 0x35, 0x58, 0x80, 0xD7, 0x1F, 0x86,
+    0x60, 0x96, 0xA7, 0x36, 0x9E, 0x84, 0xA8, 0x93, 0x2C, 0x64, 0x03, 0x4D, 0x7A, 0x6C, 0x43, 0x5B,
+    0x08, 0x1E, 0x84, 0xD8, 0x50, 0x82, 0x1B, 0xD2, 0x49, 0x5B, 0xC8, 0x66, 0x13, 0x09, 0xC4, 0x16,
+    0x20, 0xCB, 0xC2, 0x2A, 0x0B, 0x6C, 0x9F, 0x74, 0x61, 0xDF, 0x05, 0xAE, 0xC5, 0x95, 0xC5, 0x66,
+    0x35, 0x61, 0xEF, 0xEE, 0x35, 0xC4, 0x55, 0x32, 0x97, 0x65, 0x0D, 0x74, 0xC3, 0xF7, 0x71, 0x63,
+    0xDF, 0xEB, 0x28, 0x3C, 0xD8, 0x8B, 0x14, 0x15, 0xE7, 0x82, 0xAB, 0xD2, 0x8E, 0xBC, 0xBE, 0x10,
+    0x52, 0x28, 0xE8, 0x26, 0xED, 0x57, 0x26, 0xEC, 0xA4, 0x8E, 0x1B, 0x20, 0xA4, 0xBC, 0xBF, 0x05,
+    0x6E, 0xCA, 0xC6, 0x76, 0x20, 0x55, 0xD2, 0x3F, 0x47, 0xB6, 0x1C, 0x4A, 0x83, 0x5E, 0x3C, 0x9B,
+    0xA7, 0xDB, 0xAE, 0x7A, 0x9E, 0x54, 0x3A, 0xF2, 0x25, 0x5D, 0x04, 0xFF, 0xDA, 0x09, 0xA6, 0xC8,
+    0x04, 0xB3, 0x60, 0xEF, 0x40, 0x82, 0x00, 0x13, 0x1C, 0x4A, 0xDC, 0x7C, 0xBC, 0xE9, 0x2A, 0x8F,
+    0x87, 0x45, 0x82, 0x0E, 0x9E, 0x7D, 0xEA, 0x94, 0xAE, 0x9F, 0xC8, 0xBE, 0x75, 0xAF, 0x91, 0x6E,
+    0x83, 0x46, 0x71, 0x93, 0xBF, 0x69, 0x9E, 0x32, 0xD5, 0x7D, 0x7A, 0xAC, 0x46, 0x18, 0x70, 0x8B,
+    0xBD, 0xBA, 0x06, 0x8A, 0xD0, 0x03, 0xBB, 0x02, 0xD9, 0x00, 0xDC, 0x0A, 0x98, 0x31, 0x08, 0x00,
+    0x26, 0x00, 0x3B, 0xBD, 0x00, 0x69, 0x47, 0x40, 0x03, 0x20, 0xE4, 0xAD, 0xA5, 0xE0, 0x91, 0xCB,
+    0x92, 0xA6, 0x8D, 0x0C, 0xD3, 0x08, 0xFD, 0x11, 0xBC, 0x13, 0xEA, 0xD4, 0x13, 0x3A, 0x21, 0x89,
+    0x6D, 0x6E, 0xB3, 0xE9, 0x37, 0x6D, 0x2E, 0xBB, 0xF2, 0x37, 0xAD, 0x88, 0x7B, 0xE1, 0x57, 0x6D,
+    0x7E, 0xA1, 0x8C, 0xFE, 0x77, 0x9B, 0x5F, 0x5E, 0x44, 0x3F, 0x17, 0x58, 0x25, 0xB7, 0xDA, 0xFC,
+    0x52, 0x95, 0x5E, 0x6C, 0xF3, 0x8B, 0x75, 0xFA, 0xAA, 0xC0, 0x36, 0x9F, 0xB6, 0xF9, 0xBB, 0x6D,
+    0x2F, 0xF0, 0x9D, 0xBE, 0x13, 0x58, 0xB8, 0x16, 0xD0, 0x36, 0x80, 0x79, 0x0D, 0x98, 0x56, 0x80,
+    0xC9, 0x62, 0x0A, 0xA9, 0x23, 0x26, 0xB9, 0xAF, 0x1E, 0x00, 0x84, 0x19, 0x80, 0xB4, 0xBA, 0x31,
+    0x38, 0xC1, 0x63, 0x4B, 0xE0, 0xB1, 0x25, 0xA4, 0x44, 0x68, 0x1D, 0x09, 0x3E, 0x30, 0x3E, 0x74,
+    0xBB, 0xF2, 0x55, 0xD4, 0x99, 0xA4, 0x05, 0x77, 0x97, 0x5D, 0x25, 0x1B, 0x49, 0xF6, 0x72, 0xBA,
+    0x20, 0x61, 0x9F, 0x83, 0x2F, 0x48, 0x03, 0x0A, 0x83, 0xE5, 0x67, 0x7E, 0x9F, 0x72, 0x37, 0xEA,
+    0xFD, 0xFA, 0xAC, 0xB4, 0x13, 0xCB, 0x1C, 0xBB, 0xBF, 0x94, 0x36, 0xA7, 0x64, 0x22, 0xFA, 0x2E,
+    0x11, 0xE1, 0x29, 0x59, 0x3E, 0xAF, 0xD2, 0xA7, 0x3B, 0xC8, 0xD7, 0x20, 0x6E, 0x3D, 0x7E, 0xE0,
+    0x7E, 0xC1, 0xB7, 0xFB, 0xDD, 0x5B, 0xD9, 0x32, 0x11, 0x2E, 0x11, 0xB5, 0xE4, 0x1E, 0x2C, 0x91,
+    0xFC, 0x9D, 0xD6, 0xBC, 0x26, 0xDA, 0x00, 0x29, 0xE0, 0xEE, 0x95, 0xA3, 0xA9, 0xA0, 0x2F, 0xEB,
+    0x4A, 0x4F, 0x31, 0x28, 0x3D, 0xCE, 0x2B, 0x3D, 0xCD, 0x52, 0xE9, 0x01, 0x07, 0xA6, 0x82, 0x43,
+    0x1E, 0x31, 0x02, 0x4B, 0x7D, 0x87, 0xF7, 0x9D, 0x40, 0xE9, 0xA1, 0xC4, 0x09, 0x90, 0x2D, 0x81,
+    0xD2, 0xA6, 0xC7, 0x0D, 0x9E, 0xAE, 0xCC, 0x34, 0xFC, 0x44, 0xD5, 0x12, 0x06, 0x3B, 0xFB, 0x1B,
+    0x1C, 0x2F, 0xA9, 0xB1, 0xAC, 0x08, 0x64, 0x0F, 0x57, 0xC5, 0x9D, 0xF4, 0xA8, 0x4D, 0xAB, 0xA8,
+    0x0A, 0xDB, 0x74, 0x1E, 0x55, 0x90, 0x17, 0x04, 0xF6, 0x80, 0x93, 0x5E, 0x3F, 0xEB, 0xF7, 0x7A,
+    0x8F, 0xDE, 0xAF, 0xCF, 0x4E, 0xD8, 0x8E, 0xB6, 0x89, 0xF6, 0xB3, 0xF5, 0x37, 0x0A, 0x8F, 0xA4,
+    0x0A, 0x1A, 0x35, 0x3A, 0x64, 0x11, 0x71, 0xE6, 0xC2, 0xD3, 0x20, 0x3F, 0x40, 0xC0, 0x75, 0x17,
+    0x41, 0xBB, 0x3E, 0xC1, 0x40, 0xB1, 0x6F, 0x56, 0x63, 0x9C, 0x61, 0x8C, 0x11, 0x3E, 0x25, 0xE0,
+    0x5D, 0xE9, 0x3D, 0xB9, 0xEA, 0xDE, 0x6B, 0x65, 0x7E, 0xA6, 0x60, 0xDA, 0x01, 0x49, 0x91, 0x05,
+    0x71, 0x4C, 0x2B, 0x99, 0xD1, 0xA4, 0x16, 0xDC, 0x89, 0xB0, 0xD9, 0x93, 0x39, 0xB5, 0x96, 0xC5,
+    0x93, 0x84, 0xD0, 0x7C, 0x54, 0x1B, 0xCA, 0xC6, 0xD0, 0x50, 0xDE, 0x3B, 0x1A, 0x6E, 0xA2, 0x16,
+    0x61, 0xF0, 0xFE, 0xA0, 0x00, 0x00, 0x03, 0xB0, 0x8B, 0xC0, 0x63, 0x23, 0xB4, 0x9B, 0x2C, 0x64,
+    0xF3, 0x3F, 0xB8, 0xC6, 0xB6, 0x1E, 0x04, 0x84, 0xD8, 0x0B, 0x29, 0x6E, 0x20, 0xA6, 0x99, 0xE8,
+    0x29, 0x56, 0xBB, 0xD7, 0xDD, 0xF6, 0x4E, 0x43, 0xA9, 0xC9, 0x1D, 0xA8, 0xD8, 0x25, 0xC8, 0x33,
+    0x90, 0xC0, 0x9E, 0x65, 0xCD, 0x3E, 0xF6, 0x85, 0x76, 0x8B, 0x04, 0x69, 0xAD, 0x5E, 0x32, 0xFC,
+    0xFB, 0xD6, 0x2F, 0x88, 0xB8, 0x53, 0x91, 0xCE, 0x1E, 0x84, 0x6B, 0x98, 0xEF, 0xE1, 0xFE, 0x35,
+    0xAA, 0x0A, 0xBA, 0x37, 0x1D, 0xF7, 0x2A, 0xE9, 0x4B, 0x8D, 0xCD, 0x1B, 0xD1, 0x1A, 0x15, 0x51,
+    0x6B, 0x5D, 0x87, 0xC2, 0xB0, 0xE5, 0xD9, 0x1D, 0xC7, 0xFB, 0x3B, 0x42, 0x6E, 0x90, 0x3E, 0x63,
+    0x3F, 0xA2, 0xEA, 0x44, 0x70, 0xF7, 0x3F, 0x03, 0x0A, 0xF2, 0x10, 0x2E, 0x08, 0x6B, 0x5C, 0x95,
+    0xED, 0x5B, 0x41, 0xC0, 0x00, 0x9C, 0x76, 0x2B, 0x38, 0x23, 0x8C, 0xF0, 0xFD, 0xAE, 0x6B, 0x78,
+    0x7F, 0x45, 0x58, 0x02, 0xEE, 0xF9, 0x96, 0x8F, 0x2D, 0xBB, 0xB4, 0x41, 0x01, 0x73, 0xC1, 0x76,
+    0x1A, 0xBC, 0x07, 0x6D, 0x7A, 0x55, 0xA4, 0xD3, 0xCF, 0xB2, 0x4F, 0x77, 0xC1, 0xFE, 0xC9, 0x65,
+    0xA9, 0x8A, 0x78, 0x9A, 0xDF, 0x90, 0x32, 0x17, 0x68, 0x42, 0x64, 0x14, 0x79, 0xBF, 0xB0, 0x33,
+    0x18, 0x34, 0xC1, 0xFE, 0xBC, 0x59, 0x53, 0x88, 0x46, 0xB0, 0xF9, 0x96, 0x48, 0xEF, 0xD8, 0x11,
+    0x2B, 0x60, 0x68, 0x97, 0x53, 0x9D, 0x99, 0xF7, 0xF1, 0x09, 0x61, 0x96, 0x7F, 0xFE, 0x97, 0xB6,
+    0x59, 0x5A, 0xC4, 0x0A, 0x21, 0x26, 0x23, 0x43, 0x97, 0x5F, 0xD3, 0x04, 0x6F, 0x84, 0x75, 0x0D,
+    0x12, 0x53, 0x08, 0x3A, 0x26, 0x42, 0x57, 0xBF, 0x83, 0x8D, 0x94, 0xCA, 0xF2, 0x88, 0xC8, 0x04,
+    0xC1, 0x4C, 0x54, 0x19, 0x11, 0xFC, 0xC1, 0xF8, 0xE4, 0x45, 0x29, 0x66, 0x07, 0xB6, 0xC4, 0x1C,
+    0x4B, 0x19, 0x1F, 0xAC, 0x4A, 0xDA, 0x23, 0x78, 0x27, 0x2B, 0x7D, 0x0E, 0xA2, 0xD7, 0x7C, 0xD9,
+    0x66, 0xD2, 0x9F, 0xC7, 0x1B, 0x22, 0x7D, 0xDF, 0x14, 0x92, 0x39, 0x6E, 0x50, 0xB1, 0x9A, 0xF4,
+    0xFB, 0xB4, 0x55, 0xBA, 0x2A, 0x42, 0xA7, 0x83, 0x14, 0x2D, 0x40, 0x44, 0xB9, 0x14, 0x52, 0xE1,
+    0x18, 0x08, 0x35, 0x15, 0xF5, 0xC6, 0xBD, 0x9F, 0xEB, 0x7D, 0x90, 0xED, 0x4A, 0x60, 0x8B, 0x0C,
+    0xEC, 0x6B, 0xD2, 0xAB, 0x14, 0x72, 0x5F, 0x2A, 0x57, 0x33, 0xAA, 0x41, 0x29, 0xA4, 0xC2, 0x94,
+    0x94, 0x53, 0xFA, 0x42, 0x83, 0x10, 0xE6, 0xBE, 0x87, 0x52, 0x85, 0xEE, 0x2C, 0x7E, 0x37, 0xCB,
+    0x07, 0x19, 0xBE, 0x36, 0x3B, 0x82, 0x2E, 0x32, 0x33, 0xA9, 0xDB, 0xA9, 0xAD, 0x08, 0xB0, 0xAE,
+    0x40, 0x89, 0x6B, 0x59, 0x36, 0xE8, 0x91, 0xF2, 0xFD, 0x2F, 0xEB, 0xD0, 0xBD, 0x5A, 0x9B, 0x33,
+    0xBE, 0xDB, 0x13, 0x5B, 0x83, 0x94, 0x4B, 0x57, 0x9A, 0x99, 0xEB, 0xAF, 0x44, 0xBD, 0xDA, 0x6D,
+    0xA0, 0xAE, 0xA4, 0xB7, 0x45, 0x4F, 0xD8, 0xA1, 0x24, 0xD0, 0xDA, 0xBD, 0xB8, 0xB3, 0x8B, 0x69,
+    0xAF, 0xBA, 0x24, 0x4A, 0xE0, 0xB0, 0x06, 0xA9, 0x10, 0x8A, 0x74, 0x31, 0xED, 0xE2, 0x26, 0x06,
+    0x7F, 0xA9, 0xA9, 0x33, 0xD8, 0x9E, 0x66, 0x6C, 0x5A, 0xB4, 0x64, 0x11, 0x21, 0x55, 0x49, 0x4B,
+    0x0B, 0xD1, 0x16, 0x2A, 0x57, 0xA4, 0x0B, 0xF7, 0x05, 0xEC, 0x8C, 0x9D, 0x5E, 0x7B, 0x07, 0xDF,
+    0xC7, 0x95, 0x96, 0xB4, 0x82, 0xE8, 0xA3, 0x76, 0xC8, 0x3D, 0x41, 0xAD, 0xCE, 0xFF, 0xDE, 0x79,
+    0x53, 0x96, 0xF2, 0x81, 0xBF, 0x86, 0xFB, 0x74, 0x04, 0xDE, 0x12, 0xD0, 0x03, 0x01, 0x57, 0xA0,
+    0x13, 0x30, 0x59, 0x82, 0x29, 0xC4, 0xE1, 0x19, 0xC0, 0x85, 0xBD, 0xB7, 0xDC, 0x06, 0xF5, 0xC7,
+    0x11, 0xC0, 0x84, 0x1E, 0x00, 0x2B, 0x44, 0xB4, 0x1D, 0x58, 0x32, 0x17, 0x20, 0xAD, 0xE2, 0x5A,
+    0x04, 0x83, 0x06, 0x72, 0x01, 0x26, 0xCB, 0xF9, 0xB2, 0x34, 0xC2, 0xC2, 0xD4, 0xBA, 0x17, 0xFC,
+    0x08, 0xB6, 0xC3, 0x19, 0x50, 0xDB, 0xBA, 0x2B, 0x26, 0xD8, 0x00, 0x67, 0x95, 0x19, 0x12, 0x04,
+    0x9C, 0x35, 0x53, 0x08, 0xE3, 0xB3, 0x46, 0x10, 0x64, 0xDA, 0xCD, 0x64, 0x1B, 0xCB, 0xCE, 0x98,
+    0x41, 0xF2, 0x30, 0xF6, 0x76, 0x83, 0x26, 0x52, 0x35, 0xB2, 0xC5, 0xE4, 0xDA, 0xDE, 0x82, 0x06,
+    0xBD, 0x82, 0x6A, 0xE0, 0xA5, 0x06, 0xA6, 0x07, 0x3C, 0x50, 0x99, 0x19, 0x1E, 0x17, 0x1D, 0xB0,
+    0x99, 0x35, 0x40, 0x34, 0x34, 0x2D, 0x32, 0x1C, 0x5F, 0x54, 0xAA, 0xB8, 0xBB, 0x87, 0xC6, 0x32,
+    0x69, 0xA9, 0xFC, 0x5D, 0xCA, 0x5E, 0x5C, 0xEA, 0x32, 0xB8, 0xEE, 0xB2, 0xC0, 0x81, 0x5F, 0xCB,
+    0x26, 0xD8, 0x84, 0x81, 0x2D, 0xA1, 0x71, 0xF8, 0x0F, 0x45, 0x01, 0x84, 0xF9, 0x4F, 0x4A, 0x11,
+    0x83, 0xAE, 0x89, 0x8A, 0x20, 0xDA, 0x65, 0x27, 0x9A, 0xA6, 0x94, 0x54, 0x4A, 0x2E, 0x45, 0xD6,
+    0xE8, 0xDD, 0xBE, 0xB3, 0x17, 0x7F, 0xD3, 0xD9, 0xF7, 0xBE, 0xEA, 0xEC, 0x1B, 0x3F, 0xEF, 0xEC,
+    0xD6, 0xAD, 0xCE, 0xDA, 0x69, 0x67, 0x7B, 0x29, 0xAD, 0x94, 0x46, 0x8A, 0x08, 0x24, 0x82, 0x44,
+    0xDD, 0xE9, 0xAB, 0xCF, 0x15, 0x61, 0x95, 0xCC, 0x49, 0x67, 0xF0, 0x3E, 0x99, 0xCB, 0xC1, 0xEF,
+    0xF1, 0xA8, 0x6D, 0x8B, 0x06, 0xDE, 0x4A, 0x1B, 0xA2, 0xF4, 0x8B, 0x96, 0x2D, 0xEA, 0x3D, 0xAC,
+    0x3A, 0xD0, 0xB2, 0x2D, 0x15, 0xDF, 0x4A, 0xEB, 0x7B, 0xF2, 0xB7, 0x68, 0xD2, 0xD0, 0xA2, 0xA1,
+    0x41, 0x43, 0x7B, 0x86, 0xC6, 0x2C, 0x2A, 0x54, 0x87, 0x3D, 0x69, 0x56, 0x60, 0xD2, 0xBF, 0x35,
+    0x46, 0x18, 0x05, 0xED, 0x80, 0x3A, 0x2B, 0xA0, 0x48, 0xD4, 0xC0, 0x70, 0x54, 0x03, 0x54, 0x00,
+    0x85, 0x9A, 0x04, 0x65, 0x50, 0xB0, 0xEF, 0x8A, 0x36, 0x25, 0xEB, 0x87, 0xB1, 0x26, 0x0E, 0x5B,
+    0x24, 0x15, 0x68, 0x85, 0x5E, 0x18, 0x9B, 0x67, 0x3D, 0x60, 0xD1, 0x0A, 0xBC, 0x70, 0x13, 0xF0,
+    0x8D, 0x9F, 0x0B, 0xBA, 0xD9, 0xD7, 0xBF, 0xAA, 0x04, 0xBE, 0xF6, 0x0D, 0xE0, 0xAB, 0xB2, 0x87,
+    0x8C, 0x7D, 0x45, 0x76, 0x86, 0xB1, 0x2F, 0xCB, 0xBE, 0x11, 0x2D, 0x0F, 0xA6, 0x2A, 0x9B, 0x59,
+    0x03, 0xF5, 0x5F, 0xC4, 0x07, 0xD1, 0xFF, 0x0E, 0x95, 0xDD, 0x9D, 0xD6, 0x5B, 0x7B, 0xF4, 0xF3,
+    0x51, 0xF7, 0x40, 0x6F, 0x64, 0x27, 0x55, 0xE3, 0x07, 0x92, 0x26, 0x75, 0xDC, 0xA6, 0xBA, 0x3C,
+    0xBA, 0xE3, 0x0B, 0x5F, 0xE4, 0x33, 0xBE, 0x4B, 0xE7, 0x22, 0x59, 0xD6, 0xBA, 0xE3, 0x67, 0xA3,
+    0x1D, 0x6F, 0x55, 0x82, 0xD0, 0x72, 0xE7, 0x42, 0xE3, 0xFB, 0x75, 0xE2, 0xC2, 0x6E, 0x84, 0xBD,
+    0xCC, 0x05, 0x2D, 0x58, 0x95, 0xFD, 0x3A, 0x07, 0x15, 0xF3, 0xBA, 0x09, 0x16, 0x76, 0xAA, 0x05,
+    0x9F, 0xF1, 0x1D, 0xAE, 0xED, 0xE5, 0xAA, 0xAF, 0x08, 0xF5, 0xB5, 0xEF, 0x61, 0x2E, 0x36, 0x48,
+    0x0C, 0x8E, 0x2A, 0xDE, 0xF3, 0x53, 0xF8, 0x8D, 0x5B, 0x24, 0xDD, 0x79, 0x6A, 0x1E, 0xB9, 0xDF,
+    0xA8, 0x6A, 0x54, 0x59, 0xE9, 0x36, 0xDC, 0xB8, 0xDD, 0x5B, 0x82, 0xF8, 0xAE, 0x98, 0x81, 0x1D,
+    0xC1, 0x7B, 0xA2, 0xE3, 0xAC, 0x87, 0x72, 0x36, 0xBF, 0xBB, 0xC1, 0x46, 0x1E, 0xA2, 0x80, 0x8C,
+    0xCF, 0x63, 0x38, 0xB3, 0xE8, 0x1E, 0xA0, 0xA6, 0x4E, 0x0C, 0x9A, 0x76, 0x22, 0x77, 0x89, 0xC8,
+    0x0C, 0xEB, 0x06, 0x8C, 0xCA, 0xF6, 0x75, 0xA1, 0x38, 0xF9, 0xA7, 0x20, 0xC8, 0x9F, 0x2D, 0xBC,
+    0x9D, 0x83, 0x42, 0x76, 0xA8, 0x2A, 0x85, 0x19, 0x40, 0x37, 0x58, 0xA1, 0xA1, 0xB6, 0x3C, 0x67,
+    0xAB, 0xA5, 0x72, 0x01, 0xA9, 0x7C, 0xCF, 0xAC, 0xF1, 0xCF, 0x07, 0xC1, 0x64, 0xD0, 0x85, 0x6B,
+    0x8A, 0x3E, 0xC2, 0x68, 0x9A, 0xFC, 0xB6, 0x30, 0x23, 0x61, 0x4C, 0x60, 0x84, 0x69, 0x09, 0xCB,
+    0x86, 0xF0, 0x22, 0xEC, 0x9B, 0x15, 0xE4, 0x37, 0x7A, 0x95, 0x77, 0x16, 0x7C, 0xCA, 0xB7, 0xA0,
+    0xAD, 0xA1, 0xE5, 0xE2, 0x64, 0x7D, 0x50, 0xE9, 0x64, 0x21, 0xA2, 0x41, 0x52, 0x41, 0x14, 0x6C,
+    0x84, 0x07, 0xCE, 0x3A, 0x99, 0x32, 0x61, 0x39, 0x0B, 0xD0, 0x77, 0xDA, 0x50, 0x8D, 0x3A, 0xB7,
+    0xB0, 0x95, 0xD4, 0xB3, 0xC5, 0x0B, 0x82, 0x9F, 0xB0, 0x65, 0xD0, 0x40, 0x0B, 0x8E, 0x8B, 0x06,
+    0xEC, 0x3C, 0x80, 0xB8, 0x2E, 0x04, 0xFC, 0xB7, 0x05, 0xEF, 0x5F, 0xD8, 0xCB, 0x9C, 0x67, 0x67,
+    0x1E, 0x18, 0x8F, 0x55, 0x07, 0x00, 0xCD, 0x97, 0xED, 0x4A, 0x84, 0xD2, 0x92, 0xA2, 0x08, 0x81,
+    0x4A, 0xFB, 0x9D, 0x0E, 0x06, 0xD2, 0x10, 0x2C, 0x70, 0xE7, 0x87, 0x9D, 0x2E, 0xDE, 0x7A, 0x11,
+    0x62, 0x04, 0x72, 0x26, 0x3C, 0xF1, 0x11, 0xE1, 0x9D, 0xAD, 0xAF, 0xBF, 0xD7, 0x51, 0x58, 0x5E,
+    0x87, 0xBC, 0x6A, 0x1E, 0x6F, 0x85, 0x77, 0xF5, 0x99, 0x4A, 0xE6, 0x8B, 0xF5, 0x8A, 0x93, 0x92,
+    0xDC, 0xA7, 0xC2, 0xEA, 0x95, 0x63, 0x70, 0xD6, 0xAE, 0xEC, 0x03, 0xEE, 0x17, 0x6A, 0x5A, 0x50,
+    0x31, 0x33, 0xDF, 0xB5, 0xD5, 0x60, 0x65, 0x8B, 0x06, 0x70, 0x27, 0xAF, 0xFC, 0x55, 0xBD, 0x6F,
+    0xCF, 0x6F, 0x79, 0xEB, 0xAD, 0xA4, 0x87, 0xA0, 0xB4, 0x49, 0xE3, 0xAD, 0x42, 0xC1, 0x56, 0x7B,
+    0x47, 0x04, 0x8F, 0x02, 0x9C, 0x00, 0x30, 0x59, 0xC1, 0x3B, 0x76, 0xB1, 0xBC, 0xC7, 0x01, 0x87,
+    0xFC, 0xB3, 0x47, 0x91, 0x18, 0x77, 0x6D, 0x30, 0xAF, 0xCC, 0xED, 0xAE, 0x90, 0x24, 0x69, 0x01,
+    0xB3, 0xC3, 0xFA, 0x8E, 0xAD, 0xBC, 0x61, 0x3E, 0xB3, 0x6A, 0xFA, 0x31, 0x5B, 0xA4, 0x28, 0x0D,
+    0x0D, 0x82, 0x7F, 0x38, 0xA3, 0xF7, 0x81, 0xC4, 0xE7, 0xF4, 0xB6, 0x83, 0x5C, 0xCB, 0x12, 0x6C,
+    0x7A, 0x62, 0x24, 0x7A, 0xC7, 0xDD, 0x73, 0xD2, 0x5F, 0x0A, 0x4E, 0x78, 0xE6, 0xCA, 0xC8, 0x6A,
+    0x20, 0x5C, 0xCF, 0xC1, 0xCA, 0x9B, 0x38, 0x18, 0x26, 0x68, 0xB6, 0x29, 0xDC, 0xFF, 0x94, 0x5E,
+    0xBE, 0x0B, 0x13, 0xB6, 0x15, 0xA5, 0x5D, 0x76, 0xE8, 0x17, 0x1D, 0xA0, 0x83, 0xBB, 0xC2, 0x43,
+    0xFD, 0xE6, 0x22, 0xE1, 0xBB, 0xB0, 0x64, 0xC9, 0x53, 0xFF, 0x89, 0x3C, 0x91, 0x2D, 0x24, 0xAE,
+    0xF3, 0x2D, 0x7B, 0x43, 0xD5, 0x96, 0xEB, 0x84, 0x74, 0xF6, 0x90, 0xB9, 0xA3, 0x6E, 0xDA, 0xCB,
+    0xBA, 0xB3, 0x44, 0x22, 0xBE, 0x40, 0x2E, 0xC6, 0x35, 0x03, 0xAF, 0x82, 0xBB, 0xD5, 0x4F, 0xDC,
+    0xB4, 0xC7, 0xBF, 0xA8, 0x9D, 0xF6, 0xD8, 0xC2, 0xB9, 0x08, 0x8F, 0xC1, 0xE6, 0x10, 0xEB, 0x20,
+    0x43, 0x8A, 0xA5, 0xD5, 0x59, 0xBD, 0x32, 0x7D, 0x3C, 0x06, 0x79, 0x2A, 0xB8, 0xFA, 0x6D, 0x33,
+    0x6D, 0x52, 0x61, 0x10, 0xB2, 0xD9, 0xEA, 0x34, 0x7B, 0x9C, 0xB2, 0x9A, 0xDA, 0x0A, 0x9B, 0x01,
+    0x8C, 0x45, 0xCD, 0x7E, 0x7C, 0x41, 0x18, 0x59, 0x6D, 0xC2, 0x7D, 0xF9, 0x12, 0x36, 0x00, 0x01,
+    0x3F, 0x74, 0x22, 0x55, 0x88, 0xF0, 0x45, 0xF3, 0x07, 0x8D, 0x47, 0x61, 0x73, 0x32, 0x30, 0x6C,
+    0x00, 0x6E, 0x05, 0x60, 0xC6, 0x75, 0xA5, 0x70, 0xF8, 0x8B, 0x0E, 0x2B, 0xE9, 0xAA, 0x4C, 0xA9,
+    0xB4, 0x1E, 0x53, 0x2D, 0xF8, 0xD8, 0x9B, 0xC0, 0x1F, 0x5A, 0x6E, 0x3E, 0xC8, 0x15, 0xF7, 0x66,
+    0x2B, 0xAE, 0xB8, 0xFB, 0xA1, 0x81, 0x12, 0x8C, 0x22, 0xCD, 0xE9, 0x14, 0x41, 0x60, 0xDC, 0x3B,
+    0x7D, 0x88, 0x2B, 0xD2, 0xE9, 0x2F, 0x5B, 0x2F, 0xA1, 0x75, 0x0E, 0xA8, 0xF3, 0x0F, 0x15, 0xA1,
+    0x31, 0xA5, 0x72, 0x4B, 0x2C, 0x2C, 0x60, 0xA2, 0x9E, 0x21, 0x8F, 0x07, 0x2E, 0xA3, 0xB0, 0x84,
+    0x6D, 0x48, 0xAB, 0xF6, 0xC2, 0x8F, 0x20, 0xCF, 0x1C, 0x58, 0x4D, 0xA6, 0xA8, 0x7D, 0xFF, 0x7F,
+    0x20, 0xB7, 0x89, 0xC9, 0xD3, 0x2C, 0x4D, 0xB3, 0x97, 0x12, 0xB3, 0x5C, 0xA8, 0xB0, 0x7D, 0x88,
+    0x5F, 0xA3, 0x01, 0x38, 0xB0, 0xE7, 0x08, 0xF9, 0x18, 0xD0, 0xC6, 0x0D, 0xDF, 0x3C, 0xDC, 0x6F,
+    0xF6, 0x03, 0x6C, 0x71, 0x20, 0x5D, 0xBE, 0xF0, 0xF8, 0xE1, 0x71, 0x65, 0xA8, 0x02, 0xAA, 0x26,
+    0xA2, 0x92, 0x4C, 0x86, 0x0A, 0x48, 0xD6, 0x4D, 0xB0, 0xB9, 0x59, 0x41, 0xD2, 0x9C, 0xB8, 0xEF,
+    0xB9, 0x02, 0x95, 0x4C, 0xFA, 0xA4, 0xA5, 0xB9, 0x79, 0xDA, 0xF2, 0xAF, 0xF3, 0x52, 0xBD, 0x25,
+    0x3C, 0xA8, 0xE1, 0x9D, 0x34, 0xE9, 0x01, 0xC3, 0xD8, 0xCA, 0x92, 0x20, 0x40, 0x10, 0x38, 0x16,
+    0xDE, 0xB9, 0xB0, 0xB7, 0x61, 0x48, 0x9C, 0xE7, 0x76, 0x65, 0xF7, 0x01, 0xDF, 0x69, 0x66, 0x3D,
+    0x20, 0xE4, 0x3D, 0x0F, 0xF7, 0xCE, 0xE3, 0x1B, 0x6C, 0x11, 0xC0, 0x9A, 0xB0, 0x78, 0x26, 0xDB,
+    0xE1, 0x2C, 0xD0, 0x9F, 0xD6, 0x76, 0xD9, 0xE6, 0xEA, 0xF7, 0x3F, 0x35, 0x68, 0x0D, 0x8F, 0x28,
+    0xF5, 0x93, 0x32, 0x65, 0x47, 0x52, 0xA6, 0x47, 0xD5, 0x48, 0xCC, 0xDB, 0xE6, 0x43, 0x69, 0x65,
+    0x02, 0x0B, 0xF1, 0x5F, 0x0F, 0x86, 0xD3, 0x90, 0x1E, 0xAB, 0xE7, 0xFD, 0x6A, 0x3D, 0x03, 0x79,
+    0xF0, 0x61, 0x45, 0x73, 0x8A, 0xF3, 0x23, 0xF1, 0x9E, 0x9C, 0x7B, 0x5C, 0x48, 0xAD, 0x26, 0xD0,
+    0x84, 0xF2, 0xF9, 0xB8, 0x4A, 0x17, 0xC1, 0x50, 0x65, 0x61, 0x2B, 0x23, 0x1D, 0x2A, 0xD1, 0x3B,
+    0x10, 0xDB, 0x25, 0x43, 0x8E, 0xEB, 0x29, 0xFC, 0x6C, 0xC2, 0x46, 0x58, 0xB5, 0x33, 0x27, 0x93,
+    0x11, 0x8A, 0x76, 0xB1, 0x80, 0x64, 0x11, 0x89, 0x3E, 0x22, 0xCC, 0x23, 0xFE, 0x4C, 0xE8, 0x76,
+    0xE0, 0x92, 0x4F, 0x1B, 0xF8, 0xC5, 0xF2, 0x4B, 0x2D, 0x88, 0x97, 0x7B, 0x55, 0x34, 0x27, 0x99,
+    0xD1, 0x40, 0x9D, 0xCC, 0x86, 0xE6, 0xBA, 0x9E, 0x1E, 0x2C, 0x6A, 0xBF, 0xEA, 0x93, 0x93, 0x55,
+    0x83, 0xC5, 0xDE, 0xF9, 0x2A, 0x13, 0xD5, 0x46, 0x2B, 0x99, 0x26, 0x11, 0x30, 0xC1, 0x99, 0xA0,
+    0x85, 0x4F, 0x7B, 0x18, 0x3D, 0xAB, 0xD0, 0x4D, 0xE1, 0xE6, 0x8B, 0x30, 0xEB, 0xB3, 0x26, 0x71,
+    0x97, 0x44, 0x27, 0x6F, 0x53, 0xFB, 0x89, 0x10, 0xAF, 0xCE, 0xA6, 0x98, 0x7B, 0xD7, 0x71, 0xE2,
+    0x6D, 0x4B, 0xCB, 0x77, 0x5A, 0xD3, 0xB4, 0x8F, 0x78, 0x16, 0x6F, 0xD0, 0x5A, 0x01, 0x3A, 0x94,
+    0x56, 0x60, 0x7C, 0xB5, 0xBF, 0x02, 0x0D, 0xB3, 0xA7, 0x9A, 0x49, 0x4B, 0x10, 0xE6, 0x29, 0xAF,
+    0xD8, 0x93, 0x00, 0xCE, 0xC6, 0xE1, 0x13, 0xEC, 0x4F, 0xD7, 0x71, 0xD5, 0xDF, 0x87, 0x27, 0x7E,
+    0xE1, 0x23, 0xBF, 0x0E, 0xBD, 0xAD, 0x1C, 0x81, 0x03, 0x57, 0xE5, 0xB1, 0x6B, 0x7C, 0x5B, 0xE1,
+    0xDF, 0x16, 0x8C, 0xDE, 0x56, 0xF9, 0x97, 0x3B, 0x7D, 0x11, 0x6E, 0xD9, 0x1B, 0xA9, 0x0C, 0xA1,
+    0xBC, 0x11, 0x46, 0x35, 0xA7, 0xAE, 0x4E, 0x10, 0x78, 0x61, 0x15, 0xBB, 0xA8, 0x92, 0xC6, 0x7C,
+    0x4B, 0x1D, 0x9E, 0xB8, 0xD3, 0x73, 0x2D, 0x95, 0xDE, 0x76, 0xDD, 0xEE, 0x76, 0xA1, 0x76, 0xF7,
+    0xF9, 0xC1, 0xAA, 0xF4, 0x9A, 0x80, 0x1B, 0x3F, 0x50, 0xE6, 0x34, 0xCD, 0x96, 0x69, 0x63, 0x02,
+    0xC8, 0x78, 0xEE, 0x7D, 0xAB, 0x26, 0x3E, 0xBC, 0x28, 0xD0, 0xCA, 0x9B, 0x04, 0x57, 0x9B, 0xC7,
+    0xC0, 0x70, 0xD1, 0x43, 0x4A, 0xA7, 0x78, 0x96, 0xAA, 0x50, 0xB7, 0xF8, 0x07, 0x02, 0x55, 0x9F,
+    0xF3, 0x53, 0x23, 0x64, 0x60, 0x0D, 0xEE, 0xBA, 0xED, 0xAB, 0xC3, 0x55, 0x7F, 0xA7, 0x9D, 0xCF,
+    0xCC, 0xD0, 0x42, 0x44, 0x38, 0x51, 0xEA, 0x4D, 0xEE, 0xC6, 0x2D, 0x3B, 0xF1, 0x1E, 0x7A, 0x86,
+    0xFD, 0x7C, 0x43, 0x12, 0xF7, 0x25, 0xF7, 0xD9, 0xE7, 0xD8, 0x72, 0x49, 0x49, 0x9D, 0xA4, 0xB4,
+    0x18, 0xC6, 0xFB, 0x2A, 0x13, 0x62, 0x84, 0x7E, 0xF5, 0x19, 0xAF, 0x02, 0x1F, 0x29, 0xE0, 0x25,
+    0x21, 0x8C, 0x75, 0x7E, 0xB1, 0x85, 0x89, 0x56, 0x60, 0x5C, 0xE5, 0xEF, 0x88, 0xAA, 0x35, 0xCF,
+    0xA5, 0x47, 0xA2, 0x44, 0x15, 0x98, 0xE9, 0xBC, 0x60, 0x2D, 0x0A, 0x16, 0x3D, 0x47, 0xBA, 0x7D,
+    0x63, 0x3A, 0x59, 0x3E, 0x03, 0x13, 0xBE, 0x8C, 0x50, 0xB4, 0x99, 0x80, 0x5E, 0xE8, 0x61, 0x00,
+    0x1E, 0x4A, 0x11, 0x6C, 0x46, 0x52, 0xFB, 0x65, 0x9B, 0x67, 0xD1, 0x97, 0x22, 0x0A, 0x25, 0x3F,
+    0x13, 0x90, 0xDE, 0x6C, 0xE3, 0x45, 0xFE, 0x6E, 0x1B, 0x55, 0xEE, 0x95, 0x36, 0x84, 0xEB, 0x3A,
+    0xEA, 0xBC, 0x35, 0x55, 0xC3, 0xC6, 0xE8, 0x8E, 0x36, 0xB9, 0x2D, 0xB8, 0xD0, 0x09, 0xFC, 0xD2,
+    0xA6, 0x8F, 0xB1, 0x52, 0x41, 0x17, 0x55, 0x64, 0x3E, 0xA1, 0x54, 0xBB, 0xD7, 0xF7, 0xCE, 0x37,
+    0xBA, 0x8A, 0xAD, 0x56, 0x9D, 0x56, 0xB0, 0x8A, 0xA6, 0xB7, 0x1B, 0xA7, 0x55, 0x2E, 0xBD, 0xB7,
+    0xAF, 0x35, 0xD0, 0x06, 0x61, 0x97, 0x2A, 0xF3, 0x1B, 0x52, 0x49, 0x07, 0x6E, 0xD2, 0xBA, 0x95,
+    0xDF, 0x6A, 0xA5, 0xAA, 0xF3, 0xDB, 0x52, 0xCD, 0x9A, 0xFC, 0x53, 0x01, 0xA2, 0xD4, 0x1B, 0x43,
+    0xEF, 0xA8, 0x54, 0x18, 0x96, 0xCC, 0x34, 0x38, 0x95, 0x99, 0xEE, 0x83, 0xEE, 0x99, 0xB0, 0x42,
+    0xB8, 0x9D, 0xCC, 0x95, 0x7A, 0x03, 0xEF, 0xDA, 0x4C, 0xF9, 0x57, 0xA1, 0x95, 0x74, 0x79, 0xD3,
+    0xD9, 0x7B, 0x22, 0x03, 0x1B, 0x87, 0x3D, 0x6A, 0x83, 0x2E, 0xBD, 0x5D, 0x1B, 0x2B, 0x3B, 0xF7,
+    0x96, 0x10, 0x00, 0xE9, 0xC2, 0x2D, 0xA1, 0xFE, 0x61, 0x9D, 0xDE, 0x10, 0x09, 0x35, 0xAA, 0x44,
+    0x3F, 0xE5, 0x2C, 0xB9, 0x52, 0x21, 0x9D, 0x6B, 0xDC, 0x17, 0x68, 0xBE, 0x00, 0xBD, 0x4D, 0xE7,
+    0xB0, 0xF6, 0x45, 0x35, 0xCC, 0x63, 0xB0, 0x3A, 0x70, 0x03, 0x69, 0x50, 0xC6, 0x7C, 0x08, 0x24,
+    0xE4, 0xE8, 0x03, 0xB7, 0xF3, 0x1B, 0xB8, 0xB8, 0xE2, 0x0A, 0x44, 0x1B, 0xD2, 0xBE, 0xE8, 0x9E,
+    0xB0, 0xC9, 0xD7, 0x71, 0x05, 0xAA, 0x1E, 0x0B, 0xF9, 0x4A, 0x2A, 0xD4, 0xF8, 0x0B, 0x51, 0x03,
+    0x42, 0xDC, 0x9A, 0xD8, 0xD1, 0xA0, 0xE6, 0x88, 0x68, 0x30, 0x22, 0x81, 0x3F, 0xF4, 0x21, 0xC8,
+    0xFB, 0x07, 0xA0, 0xA8, 0xAA, 0x09, 0x41, 0xDF, 0x95, 0x79, 0x9E, 0x61, 0x7A, 0x65, 0x2D, 0x65,
+    0xFC, 0xB2, 0x96, 0x59, 0x72, 0xB3, 0x4D, 0x0B, 0x59, 0xD0, 0xA4, 0x4C, 0x5F, 0x69, 0xE3, 0xB9,
+    0x9D, 0xB4, 0xD1, 0x22, 0xA7, 0x4F, 0x04, 0x7C, 0xD2, 0xEA, 0xD2, 0x94, 0xB9, 0xFF, 0x3B, 0x21,
+    0xBA, 0x93, 0xB5, 0x60, 0x81, 0x4B, 0x12, 0x3D, 0x7C, 0x04, 0x9D, 0xE3, 0x57, 0x9F, 0xC2, 0xD5,
+    0xB9, 0xBB, 0x6D, 0x31, 0xFD, 0x7E, 0x65, 0x7D, 0xEC, 0x60, 0xE6, 0x6B, 0x3C, 0x17, 0xEF, 0x3B,
+    0x06, 0x2A, 0xA4, 0x3F, 0x73, 0x64, 0x55, 0xF9, 0x4D, 0xC7, 0x26, 0x45, 0x73, 0x98, 0xE1, 0x7D,
+    0xEE, 0x15, 0x50, 0x4C, 0x59, 0x68, 0x88, 0xFE, 0x26, 0xBF, 0x29, 0x52, 0x0D, 0x84, 0x96, 0x5B,
+    0x90, 0x60, 0xA4, 0xBE, 0x0D, 0xD9, 0x45, 0xB6, 0xD8, 0x94, 0x41, 0x3A, 0x0C, 0x71, 0xB1, 0xDC,
+    0x11, 0x56, 0x24, 0x2F, 0x69, 0x85, 0x7B, 0x47, 0x06, 0xF8, 0x55, 0xCB, 0x15, 0xAD, 0x09, 0x3B,
+    0x5D, 0xDD, 0x4C, 0x16, 0x17, 0x5E, 0x1F, 0x59, 0xD4, 0xCB, 0x0B, 0x19, 0x6E, 0xFA, 0x5E, 0x65,
+    0x45, 0xD0, 0xBF, 0x54, 0xD9, 0x59, 0x9D, 0x5E, 0x6C, 0x6C, 0x88, 0x70, 0x03, 0x1B, 0x2D, 0xD2,
+    0x77, 0xB0, 0x15, 0xCF, 0x98, 0x49, 0xA3, 0xB3, 0x89, 0x48, 0xB8, 0x1D, 0x38, 0x56, 0xD4, 0x3E,
+    0x70, 0x05, 0x8B, 0xD7, 0x60, 0xED, 0x7A, 0x13, 0xEF, 0x9D, 0x77, 0xD9, 0x73, 0x2A, 0x57, 0x7B,
+    0x90, 0xA9, 0x54, 0xFA, 0xB6, 0x05, 0xB7, 0xC5, 0x22, 0x3B, 0x77, 0x95, 0xD2, 0x34, 0xE5, 0xDA,
+    0x6C, 0x90, 0xC4, 0xD3, 0xA5, 0x60, 0x8E, 0x35, 0x3A, 0xA7, 0x2E, 0x6F, 0x58, 0x66, 0x5B, 0xB4,
+    0x7C, 0xC5, 0xE4, 0x77, 0xB3, 0x35, 0xCF, 0x36, 0x83, 0xC5, 0x30, 0xA0, 0x99, 0x0F, 0x3E, 0x05,
+    0x39, 0x09, 0xAE, 0xCE, 0x04, 0x15, 0x82, 0x36, 0xBD, 0x06, 0x39, 0xD1, 0x5B, 0xF3, 0x17, 0x90,
+    0xAF, 0x9E, 0xCB, 0xC0, 0xB2, 0x67, 0x88, 0xDF, 0xAB, 0x29, 0x12, 0xE7, 0x5C, 0x05, 0x59, 0x9A,
+    0xAD, 0x46, 0x79, 0x3A, 0xB0, 0x33, 0x6E, 0xE1, 0xFF, 0x88, 0xA1, 0xD0, 0xB8, 0x3E, 0xCB, 0xEF,
+    0x64, 0xD8, 0x37, 0x14, 0xE6, 0xE1, 0x80, 0x48, 0xBD, 0xF2, 0x28, 0x5F, 0x81, 0x7A, 0x08, 0xFD,
+    0xA0, 0x91, 0xE6, 0x44, 0x30, 0x57, 0x08, 0x73, 0x4E, 0x99, 0xCE, 0xF1, 0x6D, 0x52, 0xA7, 0x37,
+    0x1D, 0x03, 0x5D, 0x75, 0xD3, 0x70, 0x7A, 0xD0, 0xA1, 0xD3, 0xF6, 0x57, 0x66, 0x98, 0x90, 0x63,
+    0xA1, 0xA7, 0xD1, 0x0F, 0x84, 0x8E, 0xF8, 0x28, 0x14, 0x5C, 0x98, 0xB0, 0x40, 0x86, 0xE0, 0x01,
+    0x71, 0x08, 0xB3, 0x07, 0xC0, 0x02, 0xF7, 0xDB, 0x12, 0xBE, 0xE6, 0x74, 0xCF, 0x6D, 0x75, 0xB4,
+    0x90, 0x37, 0x94, 0x39, 0x19, 0x70, 0xD1, 0x8F, 0xDC, 0xBB, 0x27, 0xE8, 0x8F, 0x19, 0x42, 0xA5,
+    0xBC, 0x7F, 0x6B, 0xC2, 0x2D, 0x14, 0x0A, 0x3B, 0x62, 0x74, 0x95, 0xFC, 0x26, 0x43, 0x48, 0x88,
+    0x06, 0x7D, 0x00, 0xC1, 0xEF, 0x6C, 0x6E, 0xAE, 0xBB, 0x97, 0x3D, 0x04, 0xF9, 0xCF, 0x30, 0x17,
+    0x0E, 0xF7, 0x07, 0xCE, 0x3F, 0x1B, 0xA9, 0xEE, 0xC1, 0x36, 0x7D, 0xC0, 0x17, 0xDF, 0xE5, 0xC3,
+    0x1C, 0x56, 0x3E, 0x2F, 0xB5, 0xCB, 0x96, 0xB4, 0xCB, 0xEE, 0x6D, 0x35, 0xE9, 0x62, 0x46, 0xDB,
+    0x92, 0xDD, 0xBD, 0xDE, 0xCB, 0x03, 0x5A, 0xE4, 0x33, 0x6D, 0x4C, 0x22, 0xD8, 0x24, 0x7B, 0xF4,
+    0xF4, 0x57, 0x63, 0x4F, 0x0C, 0x72, 0x0B, 0x5C, 0xC6, 0x60, 0x46, 0xF0, 0x92, 0x08, 0x5E, 0x18,
+    0x13, 0xF7, 0x05, 0x5D, 0xFC, 0xF0, 0x1C, 0xC1, 0xE1, 0x5F, 0x93, 0xD1, 0x43, 0x5A, 0x02, 0x86,
+    0x31, 0x6A, 0x1E, 0x72, 0xC3, 0x04, 0x52, 0x91, 0x3C, 0xCE, 0x50, 0x5B, 0x86, 0x5C, 0x99, 0xFC,
+    0x3D, 0x46, 0x75, 0x7C, 0xCA, 0xB0, 0x8E, 0xCF, 0x00, 0xE3, 0x7B, 0x73, 0xE3, 0x25, 0x51, 0x0F,
+    0x75, 0xC3, 0x4C, 0x97, 0xF3, 0x09, 0x5F, 0x1E, 0xA2, 0x0B, 0x05, 0x61, 0x45, 0x8A, 0x5B, 0x88,
+    0xD0, 0xE5, 0x36, 0x44, 0xE4, 0x42, 0x2C, 0x15, 0x94, 0x35, 0xE1, 0x06, 0xF2, 0x56, 0xA1, 0x2B,
+    0xD3, 0x2E, 0x11, 0x4E, 0xD9, 0x73, 0xBE, 0x72, 0xF0, 0x4F, 0xF4, 0x7D, 0x65, 0xE9, 0x8B, 0x07,
+    0x99, 0xF6, 0xD4, 0x06, 0x02, 0x5B, 0xC3, 0x5A, 0xA3, 0x80, 0x53, 0x6C, 0xE0, 0x3E, 0xE2, 0xF6,
+    0x9C, 0xA2, 0x43, 0xA7, 0x46, 0xB6, 0x91, 0x67, 0x3A, 0xF8, 0xB3, 0x2F, 0x6F, 0xF8, 0x30, 0xD3,
+    0xE8, 0xD7, 0xD2, 0xD4, 0xB4, 0x86, 0x76, 0xD9, 0x22, 0xD1, 0xE3, 0x79, 0xAF, 0x32, 0x3F, 0xF6,
+    0xA9, 0x19, 0xFD, 0x9C, 0x1B, 0x24, 0x45, 0x8D, 0xA0, 0x31, 0x3E, 0xB8, 0xB0, 0xF4, 0x08, 0xBE,
+    0xED, 0x4D, 0x73, 0x70, 0x30, 0x2A, 0x69, 0x4A, 0x60, 0x34, 0x45, 0xC8, 0xC4, 0x1C, 0x01, 0x85,
+    0x2D, 0x83, 0xAE, 0x11, 0xDD, 0xDA, 0xD2, 0x0E, 0x2A, 0x33, 0x25, 0x9F, 0xA0, 0x98, 0xC0, 0xE1,
+    0xD4, 0xCD, 0xDA, 0x89, 0xFF, 0x84, 0x7F, 0xFA, 0x69, 0x02, 0x66, 0x80, 0xFB, 0x64, 0x2F, 0x4B,
+    0xEF, 0xF9, 0xAC, 0x71, 0x6F, 0x20, 0xEC, 0x03, 0xF3, 0x9B, 0x7F, 0xA6, 0xB3, 0x2E, 0x57, 0x84,
+    0x59, 0xEB, 0x7B, 0xC1, 0xEB, 0x10, 0x20, 0x55, 0x71, 0xF6, 0xB4, 0x7F, 0x91, 0x9A, 0x3A, 0x9C,
+    0x86, 0xCC, 0xD0, 0x74, 0xA0, 0x2E, 0x62, 0x8A, 0x7D, 0xD3, 0x65, 0xEE, 0xCA, 0xAC, 0x5D, 0x46,
+    0xCD, 0x0C, 0x23, 0xA7, 0xB6, 0xA3, 0x5F, 0x51, 0x62, 0xD3, 0x4F, 0xD9, 0xC1, 0xDB, 0x96, 0x9B,
+    0x2B, 0x9D, 0xAB, 0x3F, 0x17, 0x23, 0xB6, 0xDC, 0x66, 0x31, 0x94, 0x94, 0x04, 0x1E, 0x4D, 0x08,
+    0xE1, 0xB2, 0xE1, 0xBA, 0xB0, 0x9D, 0xD0, 0xEB, 0xDB, 0x4F, 0xDB, 0x29, 0x83, 0x61, 0x7A, 0x8C,
+    0x1E, 0x8A, 0xB9, 0x0B, 0xFA, 0xB0, 0xE1, 0x07, 0xE3, 0xA2, 0x4A, 0x03, 0x17, 0xEC, 0x85, 0x4A,
+    0x63, 0x57, 0xD3, 0x9D, 0x39, 0x1F, 0x17, 0x26, 0x20, 0x82, 0x96, 0x34, 0x28, 0x03, 0x29, 0x34,
+    0x32, 0x00, 0x3D, 0x9A, 0x6A, 0xB8, 0x99, 0x76, 0x43, 0x87, 0x07, 0x9C, 0x58, 0x8E, 0x29, 0x1C,
+    0x3E, 0xC4, 0xF5, 0x81, 0xA1, 0xC5, 0x43, 0xE8, 0x43, 0x3C, 0x0C, 0x2C, 0xD6, 0x71, 0x9D, 0x36,
+    0x4B, 0xCA, 0x7B, 0x9A, 0x8C, 0x8B, 0x56, 0xD1, 0x09, 0xA9, 0xE1, 0x8C, 0x52, 0x5A, 0xD4, 0x27,
+    0x9F, 0x38, 0xDC, 0x1E, 0xC0, 0xDF, 0x0A, 0x26, 0x46, 0x37, 0xE3, 0x1C, 0xCC, 0x2A, 0x27, 0x4C,
+    0x17, 0x87, 0xE0, 0x9C, 0xF6, 0xA0, 0xB9, 0xDE, 0x9F, 0xE0, 0xD9, 0x32, 0xEA, 0xE3, 0x4B, 0x88,
+    0xF4, 0x1A, 0xCC, 0xFB, 0xAD, 0x7F, 0x97, 0x0C, 0xA8, 0x5F, 0x51, 0xFF, 0xE7, 0xB2, 0xC1, 0x3B,
+    0x0E, 0x8D, 0x9D, 0xAE, 0xFB, 0x89, 0xD3, 0x74, 0x07, 0x61, 0x79, 0xDF, 0xF4, 0x70, 0x2B, 0x54,
+    0x1A, 0xE5, 0x38, 0xB7, 0xC8, 0x3E, 0x00, 0x58, 0xAC, 0x00, 0x33, 0x12, 0xD2, 0xC5, 0x55, 0x5B,
+    0xC6, 0x72, 0x73, 0x41, 0x55, 0x80, 0x0D, 0x98, 0x2D, 0x18, 0x3B, 0xB8, 0x2F, 0xCD, 0xD5, 0xF1,
+    0x8A, 0xCE, 0xFC, 0x8C, 0x44, 0x8E, 0xA1, 0x4D, 0x60, 0xBD, 0xEC, 0x49, 0xFC, 0xB2, 0x46, 0xAB,
+    0x9D, 0x4A, 0x83, 0xF5, 0xE8, 0x90, 0xD8, 0xD7, 0x43, 0xDE, 0xCA, 0x9F, 0xFB, 0x86, 0xBE, 0xAF,
+    0x57, 0x7B, 0x13, 0xF6, 0xEA, 0x58, 0x40, 0xC8, 0x88, 0x2C, 0x99, 0xE8, 0x07, 0xB2, 0x35, 0xFB,
+    0x0B, 0xE6, 0xF7, 0x2E, 0x88, 0x18, 0xD1, 0x04, 0xDC, 0xE8, 0x1A, 0x4E, 0x08, 0x9D, 0x52, 0x77,
+    0xB4, 0xD6, 0x70, 0x8A, 0x98, 0x95, 0x5E, 0xB4, 0x5E, 0xF3, 0x37, 0x1D, 0x6A, 0x46, 0x41, 0x31,
+    0x8C, 0x17, 0x94, 0xA0, 0xA0, 0x79, 0x1B, 0x61, 0x3A, 0xC0, 0xB6, 0x10, 0x86, 0x93, 0x2F, 0xDC,
+    0xBE, 0x9A, 0x31, 0x35, 0x28, 0xD8, 0xB9, 0x7D, 0xCE, 0xB6, 0x68, 0xA2, 0x39, 0xE7, 0xFB, 0x8C,
+    0x37, 0xC1, 0xBD, 0x9D, 0xA9, 0x66, 0xB8, 0xE7, 0x37, 0x3B, 0xD5, 0x95, 0xAF, 0x89, 0x38, 0xD3,
+    0x9F, 0xFD, 0xD1, 0x8F, 0x56, 0x81, 0x2E, 0x43, 0x35, 0xD1, 0x6A, 0xE6, 0x49, 0x41, 0x36, 0xDE,
+    0x1D, 0x8D, 0xA8, 0xE2, 0x32, 0xA3, 0x6D, 0xC8, 0x25, 0xAB, 0x11, 0x15, 0x9C, 0xEC, 0x7D, 0x3F,
+    0xF8, 0xA1, 0xD3, 0x80, 0x3D, 0x68, 0xD4, 0x94, 0x83, 0xAC, 0xDA, 0x29, 0x6D, 0x19, 0xBC, 0x49,
+    0x65, 0x8E, 0x86, 0x1D, 0xAB, 0x46, 0x1E, 0xAA, 0xE0, 0xC0, 0x32, 0x54, 0x45, 0xBA, 0xB7, 0xE5,
+    0xBE, 0x47, 0x71, 0xC9, 0x6B, 0x2A, 0x09, 0x9D, 0xCE, 0x0D, 0xAD, 0xCC, 0x7E, 0x65, 0xCC, 0xE6,
+    0xE6, 0xE6, 0x9A, 0xCD, 0x8C, 0x03, 0xFC, 0x0F, 0xDF, 0xF9, 0x03, 0x1D, 0xE7, 0xEF, 0x8C, 0x9C,
+    0x59, 0x7F, 0xEB, 0x0C, 0x0E, 0x26, 0xD8, 0xDC, 0xDC, 0x20, 0x1A, 0x52, 0xD8, 0xF3, 0x0B, 0x30,
+    0xB9, 0x51, 0x2E, 0xCC, 0x81, 0x9F, 0xA7, 0x6D, 0x9A, 0xD0, 0x9F, 0x09, 0x10, 0x03, 0xB2, 0x26,
+    0x75, 0xD2, 0xA9, 0x20, 0x95, 0xEC, 0x64, 0x33, 0xC9, 0x48, 0x3F, 0x92, 0x65, 0xA0, 0xA6, 0xA6,
+    0xA8, 0xAD, 0x83, 0xF4, 0x88, 0x40, 0xCD, 0x48, 0x85, 0xE3, 0xBB, 0x6F, 0x63, 0x57, 0xF6, 0x3E,
+    0xB6, 0x59, 0x29, 0xC0, 0xAC, 0x1F, 0xC2, 0x7A, 0x8E, 0x05, 0xEA, 0xB5, 0x93, 0xA9, 0x2A, 0xB1,
+    0x4B, 0xD3, 0xBD, 0xF3, 0xD9, 0xD8, 0x1B, 0x3B, 0x2E, 0xF8, 0x8E, 0xCE, 0xD3, 0xBD, 0xBF, 0x07,
+    0xDA, 0x81, 0xE9, 0xC5, 0xB3, 0x2A, 0xB1, 0x07, 0xC7, 0x14, 0x95, 0xB5, 0xA1, 0xBF, 0xCD, 0xCD,
+    0x77, 0x42, 0xD9, 0x66, 0x17, 0xB8, 0x58, 0x26, 0x20, 0x4F, 0x17, 0xB2, 0xF8, 0x65, 0x7B, 0x66,
+    0x3A, 0xFF, 0xCE, 0x77, 0xC3, 0x42, 0x38, 0xB9, 0xEF, 0x30, 0x0D, 0x01, 0x32, 0x9F, 0xBF, 0x96,
+    0xA9, 0x9D, 0xFF, 0x7D, 0x23, 0x97, 0xCC, 0x6C, 0xBC, 0x6A, 0x7F, 0x9A, 0xC2, 0xB4, 0xDE, 0x7E,
+    0xBC, 0xB9, 0xF1, 0x8F, 0xF5, 0x8B, 0xA4, 0x39, 0xE7, 0x7A, 0xA1, 0x7C, 0xF9, 0x22, 0x3D, 0x83,
+    0xE0, 0x88, 0x5C, 0x96, 0xAF, 0x33, 0x3F, 0x31, 0x69, 0x76, 0x1A, 0xF6, 0x44, 0x70, 0x92, 0x2C,
+    0x36, 0x9D, 0xB9, 0x62, 0x4E, 0x5F, 0x15, 0xC4, 0x29, 0x64, 0x86, 0x3E, 0xBE, 0xD0, 0xFF, 0xC4,
+    0xFC, 0x57, 0x2C, 0xC6, 0xC0, 0x9D, 0x23, 0x3F, 0x1B, 0xE6, 0x0F, 0x86, 0x97, 0x3D, 0x3F, 0x59,
+    0xC7, 0x96, 0x84, 0xE6, 0x92, 0x42, 0x95, 0x63, 0x91, 0x12, 0x4C, 0x50, 0xFE, 0x0B, 0x69, 0xA0,
+    0xFC, 0x63, 0x11, 0xF1, 0xCF, 0x60, 0xE7, 0x9C, 0x31, 0x27, 0xF9, 0x39, 0xAD, 0x16, 0xE2, 0x7F,
+    0xEB, 0x13, 0xE2, 0x44, 0x24, 0xFA, 0x93, 0x7F, 0xCF, 0xDD, 0xFF, 0xD6, 0xFC, 0xFB, 0xDF, 0x52,
+    0x06, 0x72, 0xC5, 0x3C, 0xD4, 0x8F, 0x6A, 0x3A, 0xCB, 0x8E, 0x55, 0xBE, 0x63, 0xC5, 0x1F, 0x0F,
+    0x37, 0x68, 0xC7, 0x06, 0xB2, 0x12, 0x0E, 0xAC, 0xFB, 0xF7, 0x76, 0xFC, 0x87, 0x7F, 0x3A, 0xCD,
+    0x0E, 0xB6, 0xF9, 0x9D, 0xE1, 0xC3, 0x7F, 0x1C, 0x3E, 0x2C, 0x03, 0x6F, 0x94, 0x58, 0x7D, 0xCB,
+    0x04, 0x9E, 0x86, 0x19, 0x11, 0xF7, 0x02, 0x79, 0x3B, 0x16, 0xCA, 0xC4, 0xBA, 0xD6, 0x3E, 0xAC,
+    0x4C, 0xEE, 0x98, 0x70, 0x94, 0x40, 0xD9, 0x62, 0xDC, 0x89, 0xE3, 0x7F, 0x74, 0x51, 0x27, 0xD9,
+    0x30, 0x3F, 0x7B, 0x9E, 0x09, 0x23, 0x99, 0xE8, 0xDF, 0xE9, 0x0C, 0x96, 0x27, 0x9F, 0x1B, 0x0E,
+    0xFD, 0xF7, 0xA5, 0x80, 0xEC, 0xB2, 0x2F, 0x8C, 0x2C, 0xC6, 0x60, 0xFE, 0x94, 0x6E, 0x0E, 0xF3,
+    0x63, 0xF3, 0xA2, 0xBE, 0x55, 0xE8, 0xEB, 0x30, 0x40, 0xE5, 0xE1, 0x41, 0x35, 0x42, 0x60, 0xED,
+    0xD5, 0xFA, 0x9B, 0x27, 0x1F, 0x9A, 0x17, 0x0A, 0xB2, 0x40, 0xCC, 0x7E, 0xD0, 0xFB, 0x70, 0x52,
+    0x25, 0x96, 0x89, 0xBA, 0x18, 0x83, 0x7F, 0x33, 0x1A, 0xB2, 0xBC, 0x8E, 0x36, 0x1F, 0x11, 0x37,
+    0xB5, 0xCA, 0xB5, 0x72, 0xAC, 0x26, 0x5A, 0x4D, 0x7B, 0x56, 0xE1, 0x1E, 0xAB, 0xF8, 0xD7, 0xAC,
+    0xD2, 0xCF, 0x59, 0xD9, 0x9B, 0xAC, 0xDC, 0x2B, 0xA8, 0x2E, 0xF6, 0xB4, 0x68, 0x5F, 0xA2, 0xE1,
+    0x22, 0xBF, 0x5C, 0xB3, 0xDA, 0xAA, 0x58, 0xD9, 0x39, 0x2B, 0xB8, 0x2F, 0x28, 0xA1, 0x4E, 0x60,
+    0xB9, 0xEB, 0xB4, 0x6A, 0x0D, 0x6C, 0x6A, 0x79, 0xA5, 0xAE, 0xA0, 0x21, 0x87, 0x6F, 0x29, 0xF5,
+    0x68, 0x10, 0xC8, 0x10, 0x69, 0xE5, 0xA3, 0xF4, 0xD3, 0x25, 0xF1, 0x8C, 0xE7, 0x01, 0x62, 0x2B,
+    0x21, 0x1D, 0x8B, 0x28, 0x77, 0xAE, 0x25, 0xA1, 0xAD, 0x48, 0x47, 0xB0, 0xC2, 0xC1, 0x2A, 0x8E,
+    0xDA, 0x66, 0x48, 0x79, 0xB1, 0xD9, 0x8C, 0x30, 0x22, 0x4C, 0x08, 0x73, 0x42, 0x07, 0x72, 0xFE,
+    0x4A, 0x2F, 0xE3, 0xB7, 0xAF, 0xB5, 0x80, 0x6F, 0xD4, 0x80, 0x5B, 0x15, 0xA0, 0x70, 0x2D, 0xBA,
+    0xB5, 0x08, 0xC9, 0x99, 0x61, 0xEC, 0x2A, 0x2D, 0x34, 0xF2, 0x02, 0xFE, 0x67, 0x15, 0x32, 0xF2,
+    0x91, 0xCE, 0xA8, 0x76, 0xC2, 0x6E, 0x35, 0x22, 0x59, 0x1F, 0x8E, 0x89, 0x20, 0xE9, 0x3F, 0x34,
+    0x74, 0x8A, 0x8D, 0xC0, 0xEA, 0xEA, 0x0C, 0xB2, 0xCA, 0x6C, 0x90, 0xD1, 0x08, 0x0A, 0xD8, 0xFF,
+    0xCB, 0x99, 0x0F, 0x36, 0x27, 0x5B, 0x50, 0x16, 0x51, 0xCE, 0xFA, 0x1D, 0xFA, 0xDD, 0x78, 0x1F,
+    0x6D, 0x43, 0x57, 0x0E, 0x7A, 0x27, 0x0F, 0xF9, 0x64, 0xDC, 0xA1, 0xAB, 0x07, 0x81, 0xDB, 0xA7,
+    0x75, 0xA4, 0xF3, 0x7E, 0x9A, 0xE6, 0xB4, 0x2B, 0x28, 0xD7, 0x7A, 0x10, 0x78, 0xD9, 0x6B, 0xB8,
+    0x65, 0x41, 0xB7, 0x7C, 0xAE, 0x99, 0x44, 0x0B, 0x66, 0xA9, 0x95, 0x71, 0x03, 0x96, 0x86, 0x5E,
+    0xE6, 0x37, 0x3E, 0x69, 0xF3, 0xDB, 0xF7, 0xDA, 0xFC, 0x96, 0x6B, 0x56, 0x61, 0xA3, 0x72, 0xEF,
+    0xEE, 0x07, 0x22, 0x0E, 0xCC, 0x90, 0xA1, 0x7C, 0x6C, 0x02, 0xB5, 0x8F, 0xFF, 0x29, 0x47, 0xF1,
+    0x3F, 0x0D, 0x63, 0x7D, 0xE8, 0xE2, 0xF1, 0xE5, 0x9D, 0xBF, 0x6E, 0xED, 0x6D, 0xD7, 0xDA, 0x9F,
+    0xB9, 0xC6, 0x7E, 0xED, 0x86, 0xF8, 0x9F, 0xB9, 0xBD, 0x0C, 0xA7, 0xFB, 0xBF, 0x92, 0x12, 0x94,
+    0xC7, 0xC6, 0xFF, 0xC0, 0xAE, 0x32, 0x2A, 0xF9, 0x28, 0x96, 0x47, 0x73, 0x22, 0x8C, 0x79, 0xD4,
+    0xC2, 0xAC, 0x4B, 0xB7, 0xFC, 0x95, 0x66, 0xFD, 0xEF, 0x9D, 0xCD, 0x93, 0x38, 0x64, 0x61, 0xEE,
+    0x5B, 0x2B, 0xAD, 0xE2, 0xC9, 0xB8, 0xE4, 0x14, 0x48, 0xB5, 0xFC, 0xF3, 0x7E, 0x3B, 0x3B, 0xEA,
+    0x9E, 0x71, 0x89, 0xD4, 0xBC, 0xA4, 0xA5, 0xDF, 0xBE, 0xA2, 0xC6, 0x4D, 0x63, 0x2E, 0xEC, 0xBD,
+    0xB9, 0x74, 0xF0, 0xA2, 0x0C, 0xDF, 0x1F, 0x2C, 0x43, 0x74, 0xC5, 0x1A, 0x28, 0x8F, 0xC8, 0xE6,
+    0x50, 0xCB, 0xFF, 0x47, 0x9A, 0x61, 0xBF, 0x4C, 0x57, 0x92, 0x4D, 0x74, 0x77, 0x0B, 0x52, 0x4E,
+    0xE0, 0x53, 0x9A, 0x86, 0xA4, 0x14, 0x26, 0xE3, 0xC4, 0x4B, 0x70, 0x40, 0x02, 0x11, 0xAA, 0x1B,
+    0x0B, 0xB6, 0x43, 0x5C, 0x84, 0xA8, 0x0B, 0xC3, 0x17, 0x55, 0xD6, 0xE7, 0xCD, 0x7A, 0x96, 0x1E,
+    0xB2, 0xF6, 0xD6, 0x02, 0x31, 0x16, 0x34, 0xFA, 0x30, 0x43, 0xEF, 0x0B, 0x37, 0xB8, 0xFA, 0x6A,
+    0x2D, 0x43, 0xAC, 0xD9, 0x30, 0x34, 0x79, 0xE7, 0x2E, 0xE5, 0xA1, 0x92, 0xCE, 0x75, 0xDB, 0x0C,
+    0x7C, 0x0D, 0x51, 0xF9, 0x3C, 0x7F, 0x00, 0x0E, 0xF6, 0x08, 0xC1, 0x7D, 0x54, 0x80, 0x69, 0x6A,
+    0x12, 0xF2, 0x15, 0x38, 0xF5, 0xBA, 0xBC, 0x43, 0x43, 0xAA, 0x49, 0x6F, 0x38, 0x6E, 0xA5, 0xF8,
+    0xD7, 0xB0, 0x8F, 0xC2, 0xCD, 0xE6, 0x38, 0x86, 0x69, 0xEF, 0x88, 0x7B, 0x3E, 0xEE, 0x59, 0x38,
+    0xA0, 0xE3, 0x24, 0x45, 0x5F, 0x3B, 0x1D, 0xE8, 0xE7, 0x8E, 0xD4, 0xCE, 0xCA, 0xF3, 0x34, 0x33,
+    0xBC, 0x0C, 0xFB, 0x29, 0x73, 0x26, 0x40, 0xD2, 0x99, 0xB2, 0x25, 0xB8, 0x1D, 0x53, 0x17, 0x15,
+    0x2D, 0x15, 0xE2, 0xAD, 0x68, 0xB6, 0x88, 0xC0, 0xF5, 0x6E, 0xC4, 0x61, 0xB6, 0x1E, 0xA2, 0xA6,
+    0x22, 0x0C, 0xB5, 0x05, 0x7A, 0xBA, 0xCA, 0xD1, 0x4E, 0xFD, 0xDD, 0x4E, 0xB3, 0x33, 0xD9, 0x97,
+    0xB8, 0xE2, 0x50, 0xA4, 0xC7, 0xB4, 0x82, 0x6B, 0xCC, 0xD3, 0x4C, 0xC6, 0x03, 0x9B, 0x6A, 0xE3,
+    0x20, 0x06, 0xA6, 0x95, 0xA3, 0x47, 0xB9, 0x74, 0x33, 0x98, 0xC2, 0x33, 0x37, 0x71, 0x9B, 0x4C,
+    0x8C, 0x71, 0x2E, 0x42, 0xC6, 0x59, 0xEA, 0x90, 0xE2, 0x8D, 0xC0, 0xC7, 0xB1, 0x7D, 0xED, 0x7E,
+    0xD5, 0xF6, 0x13, 0xCB, 0x53, 0x3C, 0x87, 0x5C, 0x1C, 0x48, 0x29, 0xF2, 0x39, 0x80, 0x89, 0xBF,
+    0x51, 0x51, 0xF6, 0x05, 0xEF, 0xCE, 0x7E, 0xD4, 0xD0, 0xD8, 0xD8, 0xB7, 0x3F, 0xA9, 0x95, 0xDB,
+    0xC3, 0xA6, 0xE2, 0xDB, 0xA7, 0x72, 0x07, 0xEC, 0x57, 0x03, 0xBC, 0xB7, 0xC6, 0xF3, 0x3C, 0x0B,
+    0xEA, 0x7F, 0xB0, 0xF1, 0xDE, 0x1A, 0x52, 0x6B, 0x60, 0x24, 0xD1, 0x04, 0x85, 0xFC, 0x33, 0x98,
+    0xE6, 0x6F, 0x33, 0xB9, 0xC8, 0x99, 0x23, 0xF2, 0x05, 0x1D, 0x43, 0x68, 0x3B, 0xB4, 0x8C, 0xB4,
+    0x7D, 0x77, 0x44, 0x32, 0xF4, 0x01, 0x60, 0x7C, 0x56, 0x60, 0x91, 0xC0, 0xA2, 0x23, 0xA3, 0xA4,
+    0xF3, 0xCB, 0x21, 0xB1, 0x14, 0xF9, 0x3A, 0xC6, 0x7D, 0x50, 0x0D, 0xE6, 0x6F, 0x28, 0x8D, 0xEE,
+    0x32, 0x94, 0xCD, 0x4B, 0xC8, 0x71, 0x7A, 0x57, 0xF1, 0xE3, 0x0E, 0x9D, 0x6C, 0x25, 0xC6, 0x5C,
+    0x82, 0x11, 0x2D, 0x6D, 0xE2, 0x47, 0x81, 0x17, 0x0A, 0xAA, 0xB3, 0x48, 0x1F, 0x32, 0xF6, 0xF6,
+    0x7B, 0xA2, 0xCD, 0xDE, 0x96, 0x06, 0x85, 0x76, 0x57, 0x00, 0x25, 0x40, 0x26, 0x40, 0x9A, 0xB7,
+    0x9F, 0xC2, 0xCF, 0x73, 0xAF, 0x52, 0xB7, 0x87, 0xB1, 0x18, 0xB9, 0xFD, 0x04, 0x4E, 0x9F, 0xDB,
+    0xCE, 0x2C, 0x6F, 0x96, 0x7D, 0x7D, 0x5B, 0xB8, 0xB0, 0xB4, 0x22, 0xBA, 0xD3, 0x0D, 0x91, 0xD8,
+    0x61, 0x79, 0x81, 0x71, 0x4F, 0xFA, 0x22, 0xC3, 0x72, 0x7F, 0x91, 0xD4, 0xEE, 0x72, 0x3E, 0x77,
+    0x97, 0xA5, 0xA3, 0x97, 0x05, 0x09, 0xE5, 0x36, 0x0C, 0x88, 0x1E, 0x58, 0x19, 0x0E, 0x46, 0xE3,
+    0x2E, 0x0B, 0xCA, 0x5F, 0x16, 0x4C, 0xBD, 0x2C, 0xCF, 0x5C, 0x16, 0xFC, 0xFD, 0x8B, 0xB8, 0x91,
+    0x71, 0xF4, 0x3C, 0x33, 0x02, 0x91, 0x34, 0x73, 0x8B, 0xA4, 0x1E, 0x27, 0xE3, 0x95, 0xE7, 0x2E,
+    0x49, 0x97, 0xF7, 0xDF, 0x68, 0x64, 0x2B, 0x24, 0x38, 0x56, 0x42, 0xE6, 0x2B, 0xDE, 0x5F, 0x11,
+    0x24, 0x05, 0x05, 0x32, 0x79, 0xE5, 0x42, 0x95, 0xE2, 0x96, 0x18, 0x37, 0x33, 0x28, 0x67, 0xAA,
+    0xDE, 0xD5, 0x42, 0x1A, 0xB5, 0x70, 0xEF, 0xA7, 0x68, 0xDE, 0x1B, 0x6A, 0xC6, 0x7C, 0x9A, 0xEA,
+    0x7C, 0xEB, 0xC1, 0x70, 0xC1, 0xCE, 0xC1, 0x75, 0xB3, 0x90, 0xA1, 0xE1, 0x08, 0x7F, 0x0C, 0x91,
+    0x91, 0x85, 0xC0, 0x25, 0x13, 0xEE, 0xF1, 0x10, 0x0F, 0x68, 0x5A, 0xDF, 0x90, 0xB3, 0xC3, 0x80,
+    0xD6, 0x08, 0x56, 0x84, 0xA2, 0xD9, 0x0A, 0x90, 0x97, 0x87, 0x08, 0xFB, 0x0E, 0x11, 0xF4, 0x8D,
+    0xD8, 0x89, 0x05, 0x1D, 0x64, 0x05, 0x1D, 0xC8, 0xA0, 0x73, 0x50, 0x2E, 0xA1, 0x07, 0x1B, 0xC5,
+    0x41, 0x6F, 0x97, 0x20, 0x16, 0x2A, 0x1A, 0x2A, 0x1E, 0x2A, 0x22, 0x0E, 0x09, 0x33, 0x58, 0x10,
+    0xC5, 0x45, 0x45, 0x46, 0xEF, 0xBC, 0x25, 0x3A, 0x2A, 0x3E, 0x6A, 0x02, 0x2B, 0xAD, 0x69, 0x86,
+    0x0E, 0x5B, 0xE2, 0x3D, 0x0E, 0x16, 0x59, 0xBD, 0x51, 0x60, 0xB2, 0x30, 0x9B, 0xFA, 0x46, 0x21,
+    0x99, 0x40, 0x14, 0xA6, 0xDF, 0xA7, 0x9F, 0xF2, 0x7C, 0x94, 0x7B, 0x24, 0x89, 0xF7, 0xC8, 0x06,
+    0xD8, 0x87, 0x94, 0xFD, 0x49, 0xE9, 0x2F, 0x86, 0x47, 0x02, 0x10, 0x44, 0x89, 0xD9, 0x14, 0x02,
+    0x35, 0x0F, 0x33, 0x59, 0x3C, 0x0C, 0xC4, 0x39, 0x02, 0x9A, 0x75, 0xB9, 0x0E, 0x1F, 0xF8, 0xAC,
+    0xA6, 0x98, 0xAE, 0x43, 0x8A, 0xA5, 0x27, 0x80, 0x1A, 0xA5, 0x72, 0x1F, 0xC0, 0x18, 0xAB, 0x15,
+    0xB8, 0x73, 0xFE, 0xA8, 0xFB, 0x10, 0x86, 0x33, 0x80, 0x41, 0xD4, 0x3C, 0x0A, 0x4C, 0x3E, 0x64,
+    0xEF, 0xEA, 0xA3, 0xE1, 0xE3, 0x9D, 0x95, 0xA3, 0x20, 0x3A, 0xE8, 0x0E, 0xC2, 0x6E, 0x53, 0xC7,
+    0x31, 0x40, 0x22, 0xFC, 0x1A, 0xC4, 0xA0, 0xD7, 0xEF, 0x39, 0x06, 0xE6, 0x9E, 0x9B, 0xE6, 0x3E,
+    0x10, 0xF7, 0x50, 0x5D, 0x9A, 0x13, 0xD7, 0xDB, 0xD7, 0xB4, 0xD6, 0xC0, 0x04, 0xE3, 0xFD, 0xA6,
+    0xEA, 0xDD, 0x45, 0x7D, 0x67, 0xC7, 0xE9, 0xFD, 0x53, 0xA7, 0xE4, 0x4C, 0xF3, 0xB2, 0x89, 0xDE,
+    0x5A, 0xA7, 0xF3, 0xE3, 0xEA, 0x75, 0x5B, 0xA3, 0x37, 0xDB, 0xFA, 0x64, 0xFC, 0x97, 0x76, 0x9C,
+    0x3F, 0x95, 0xA6, 0xF3, 0x75, 0xED, 0x6B, 0x2F, 0xAB, 0x6E, 0x70, 0x5E, 0xEA, 0x03, 0xF0, 0xCE,
+    0x85, 0x9A, 0x51, 0x49, 0x87, 0x21, 0x98, 0x26, 0xC3, 0x20, 0x08, 0x45, 0x04, 0x8E, 0xF6, 0x1D,
+    0x05, 0x9F, 0x84, 0xA2, 0x8F, 0x08, 0xD2, 0x02, 0x35, 0x52, 0x6A, 0x80, 0x2B, 0xD5, 0x4B, 0x35,
+    0x2F, 0x9A, 0x9A, 0xF7, 0x89, 0xD5, 0x64, 0x02, 0xC6, 0x4F, 0xF3, 0xBA, 0xD9, 0xDC, 0x9C, 0xE3,
+    0x48, 0xAC, 0x66, 0xB7, 0xA2, 0xBB, 0xA1, 0xFB, 0x2F, 0x99, 0x9E, 0x66, 0x65, 0x28, 0x32, 0xCD,
+    0x85, 0xDA, 0x81, 0x89, 0xA7, 0x73, 0xB0, 0xC6, 0x74, 0x9E, 0x7C, 0xC9, 0xC8, 0x80, 0x72, 0x1D,
+    0xC2, 0xC1, 0xB8, 0x84, 0x55, 0xF2, 0x53, 0x64, 0x4D, 0x47, 0x5F, 0x21, 0x6B, 0x3A, 0xA4, 0xFB,
+    0xEE, 0x0B, 0xF5, 0x80, 0xBB, 0xBB, 0xEA, 0xED, 0x2F, 0xA9, 0x9D, 0xC0, 0x77, 0x72, 0xDA, 0xAD,
+    0x29, 0xC3, 0x90, 0xD9, 0x66, 0x9A, 0x6F, 0x07, 0xD6, 0xBC, 0xC7, 0x1C, 0xD6, 0x04, 0xAB, 0x08,
+    0xC4, 0xBB, 0x81, 0x19, 0x79, 0xB7, 0x4D, 0x0B, 0x01, 0x89, 0x68, 0xB1, 0xF2, 0x29, 0xA7, 0x0B,
+    0x7D, 0xDE, 0x5B, 0x93, 0x34, 0x30, 0x8A, 0x7B, 0x4D, 0xCA, 0x95, 0x1A, 0xB0, 0xA1, 0x07, 0x28,
+    0x99, 0x43, 0xD9, 0xCD, 0xC1, 0x7A, 0x76, 0x73, 0xBC, 0x9E, 0xDD, 0x3C, 0x32, 0x9A, 0x95, 0xEB,
+    0x96, 0xB3, 0x43, 0x46, 0x33, 0x66, 0x37, 0xDB, 0xF5, 0xEC, 0x66, 0x20, 0xC1, 0x7F, 0xE7, 0xFA,
+    0x73, 0x21, 0x0A, 0x0F, 0xA6, 0xCB, 0xD0, 0x2E, 0xD1, 0x28, 0x87, 0x60, 0xCD, 0x6C, 0x2D, 0x85,
+    0xA1, 0xD2, 0xF7, 0x1C, 0x6B, 0x34, 0xEB, 0xCE, 0xE3, 0x5E, 0xC4, 0x3A, 0x94, 0x74, 0x35, 0x84,
+    0xF3, 0x63, 0x05, 0xA1, 0xF5, 0xB4, 0x6A, 0x05, 0x8F, 0x21, 0x99, 0x5A, 0xD3, 0x9D, 0xDB, 0x31,
+    0x18, 0xEB, 0xBF, 0x47, 0x00, 0xDD, 0xCB, 0xDD, 0x50, 0xCE, 0x5E, 0xF8, 0xFA, 0xCD, 0xA5, 0xFC,
+    0x77, 0x6C, 0xF1, 0x18, 0x30, 0x94, 0x23, 0x6F, 0x7A, 0xEE, 0x2A, 0x4F, 0x13, 0xC2, 0xA9, 0x0A,
+    0x0B, 0x75, 0xF9, 0xD4, 0x14, 0x89, 0x26, 0x8E, 0x8E, 0x2C, 0xC1, 0x37, 0x30, 0x16, 0xB8, 0xAC,
+    0x54, 0x1C, 0x81, 0xEF, 0x86, 0x7E, 0x1B, 0x0D, 0x23, 0x50, 0xB3, 0x66, 0x77, 0x22, 0x00, 0x8D,
+    0xA2, 0xA0, 0x59, 0x3A, 0x5D, 0xD0, 0x49, 0x20, 0x5F, 0xC6, 0xB5, 0x34, 0x1F, 0x21, 0x47, 0x8B,
+    0x29, 0x0A, 0xD3, 0x4E, 0x18, 0xF0, 0xA4, 0x4F, 0x11, 0x1E, 0x44, 0xCF, 0x9E, 0xEA, 0x2F, 0x99,
+    0x4F, 0x6A, 0x18, 0x79, 0xF6, 0xDA, 0x13, 0x4D, 0xF5, 0x23, 0x8F, 0xED, 0xF4, 0xF5, 0xFE, 0xA3,
+    0x21, 0x58, 0x73, 0x00, 0xB0, 0x6D, 0x3F, 0xE9, 0xB1, 0x45, 0x6E, 0x38, 0x05, 0x8B, 0xE0, 0x14,
+    0x22, 0x54, 0x0F, 0x8C, 0x8D, 0x69, 0xE9, 0x26, 0x59, 0x7A, 0x10, 0xD5, 0xCB, 0x08, 0x97, 0xA1,
+    0x2A, 0x62, 0xAF, 0xA2, 0x41, 0xAB, 0x52, 0x03, 0x49, 0x29, 0x63, 0x1E, 0x35, 0x3F, 0x5D, 0x13,
+    0xD4, 0xBD, 0x7F, 0x56, 0xB9, 0x36, 0x73, 0xD4, 0x55, 0xE8, 0x65, 0x96, 0x3A, 0x7D, 0xBE, 0x19,
+    0xBD, 0xC0, 0x8E, 0xE9, 0x96, 0x74, 0x8D, 0x25, 0xF4, 0x6E, 0xE8, 0x73, 0x0F, 0x08, 0x75, 0x18,
+    0x02, 0x1E, 0x52, 0x24, 0x03, 0x27, 0x35, 0x9D, 0xFC, 0x32, 0xB4, 0x69, 0x1F, 0x23, 0xF0, 0x39,
+    0x1F, 0xF2, 0x56, 0x52, 0xDA, 0xE4, 0xDD, 0x90, 0xB7, 0xC2, 0x14, 0x52, 0xD0, 0xDA, 0x89, 0x63,
+    0xFE, 0x5E, 0xB4, 0xB7, 0x11, 0xB5, 0xA1, 0x13, 0x79, 0x73, 0x2A, 0x22, 0xC6, 0x22, 0xD0, 0x43,
+    0x8B, 0x8E, 0x03, 0xCF, 0x5D, 0xC5, 0x16, 0x8D, 0x98, 0xFE, 0x00, 0x3D, 0x72, 0xBD, 0xC2, 0x3D,
+    0x4F, 0xAC, 0xDA, 0xDF, 0xDE, 0xF1, 0x29, 0x42, 0xBA, 0x68, 0xA3, 0x6A, 0x64, 0xC9, 0x3B, 0x41,
+    0xC5, 0x9D, 0xFE, 0x09, 0xA3, 0xCA, 0x3E, 0x69, 0x3D, 0x3C, 0xEB, 0xEE, 0xBC, 0x4E, 0x66, 0x1F,
+    0x3E, 0x1C, 0x7C, 0xFF, 0xBC, 0x0A, 0x13, 0xAA, 0x3F, 0x2E, 0xA1, 0xD1, 0x90, 0x9A, 0xE3, 0xE1,
+    0xE4, 0xDA, 0x52, 0x7A, 0x79, 0xB8, 0xB3, 0x05, 0xE6, 0x3C, 0x9F, 0x65, 0xEF, 0x07, 0x8E, 0xA7,
+    0xB4, 0xE8, 0x09, 0x6E, 0x74, 0xB9, 0x76, 0x6A, 0xB5, 0x3C, 0x02, 0x12, 0x2B, 0x53, 0xC5, 0xC1,
+    0x11, 0x3C, 0xA1, 0x14, 0x99, 0xAA, 0x16, 0x79, 0x0C, 0xE0, 0xD5, 0x74, 0x71, 0xCE, 0x69, 0xCA,
+    0x68, 0xA4, 0x0E, 0xD3, 0xCF, 0x0F, 0x85, 0x82, 0x8E, 0x81, 0x57, 0xBD, 0x8F, 0x02, 0xDB, 0x29,
+    0x0C, 0x33, 0xB2, 0xD3, 0x92, 0x63, 0xC0, 0x5F, 0xAD, 0x81, 0x0A, 0xA0, 0x47, 0xA4, 0x0A, 0x22,
+    0x5A, 0x78, 0x5C, 0x56, 0xE0, 0xFA, 0x2D, 0xE9, 0x79, 0x0D, 0x3D, 0xE3, 0xAF, 0xD6, 0xC1, 0xF7,
+    0x69, 0xED, 0xF1, 0xE0, 0xC8, 0x11, 0xDD, 0x7C, 0x07, 0x11, 0x64, 0x37, 0x06, 0xF0, 0xCB, 0x7B,
+    0x7E, 0x58, 0xB1, 0x0E, 0xEB, 0x2E, 0x36, 0xED, 0x8D, 0x35, 0xB0, 0x1C, 0xE5, 0x2A, 0x75, 0xE2,
+    0x78, 0xF0, 0x3F, 0x3C, 0x7E, 0xA8, 0x70, 0x61, 0x1D, 0x4C, 0x45, 0x22, 0xBA, 0x2E, 0x0E, 0x38,
+    0xA1, 0xEF, 0x0F, 0x8C, 0x59, 0x25, 0x0E, 0x1E, 0x2A, 0xAF, 0x8B, 0x2A, 0x99, 0x33, 0xA5, 0xB9,
+    0x76, 0x7B, 0x79, 0xE3, 0xE6, 0x51, 0x8B, 0xD8, 0x77, 0xF8, 0x22, 0x4F, 0x52, 0x56, 0xC6, 0xFE,
+    0xC1, 0xAC, 0x4F, 0xDC, 0x61, 0x00, 0xB6, 0x7C, 0xB7, 0xBF, 0xD3, 0xF1, 0x60, 0x11, 0x21, 0xC2,
+    0x2F, 0x90, 0xB0, 0x67, 0xD6, 0x1B, 0x63, 0x68, 0xB2, 0x13, 0xE1, 0x67, 0x7F, 0x7B, 0x9B, 0x87,
+    0x3A, 0xAE, 0xCE, 0x01, 0x9C, 0x87, 0x5A, 0x0D, 0xF8, 0xE4, 0x2D, 0xED, 0x3E, 0x2E, 0x02, 0xEE,
+    0x99, 0x40, 0x0F, 0x2B, 0x89, 0xE9, 0x45, 0x3E, 0xAF, 0xA1, 0x73, 0xE3, 0xEC, 0xE3, 0x89, 0x0A,
+    0x86, 0x63, 0x63, 0xBB, 0xF2, 0x10, 0x43, 0xF9, 0x74, 0x0A, 0x59, 0xEA, 0xD4, 0xAC, 0x43, 0xFC,
+    0x03, 0x8D, 0x4C, 0xA9, 0xB0, 0x1B, 0x5D, 0x37, 0x3D, 0x1D, 0x43, 0x8F, 0xC7, 0xC0, 0x1B, 0xAA,
+    0x55, 0x07, 0x54, 0x72, 0x14, 0x06, 0xF4, 0x8F, 0xD8, 0x42, 0xC7, 0xD6, 0x3A, 0xB6, 0xDC, 0xAC,
+    0x45, 0xFB, 0x3E, 0xB3, 0xC9, 0x98, 0x1C, 0x37, 0x19, 0x8B, 0xD1, 0xEE, 0x3C, 0x41, 0x35, 0xFE,
+    0x79, 0xD2, 0xD3, 0x36, 0xA1, 0x62, 0x71, 0x1C, 0x0C, 0x3E, 0x24, 0xA3, 0xD4, 0xDF, 0x19, 0x8F,
+    0xA7, 0x3C, 0xC9, 0xAF, 0xCC, 0xC7, 0xF2, 0x29, 0xC4, 0xA9, 0x9D, 0xF5, 0x64, 0x89, 0x41, 0x58,
+    0x26, 0x5E, 0xA8, 0x6F, 0x24, 0xD2, 0x45, 0xD2, 0x30, 0x5E, 0x06, 0xB4, 0x8D, 0xBD, 0x6F, 0x7F,
+    0x67, 0xCE, 0x4C, 0x9B, 0x5C, 0x3B, 0x7D, 0x95, 0x3A, 0x35, 0xB9, 0xED, 0x84, 0xB4, 0xCC, 0xF3,
+    0x71, 0xCF, 0xC4, 0xD7, 0x37, 0xC2, 0xD3, 0xCE, 0xE9, 0xF7, 0x67, 0x90, 0x05, 0x0C, 0xCC, 0xEF,
+    0x87, 0x23, 0xC4, 0x96, 0x86, 0x45, 0x1E, 0x3F, 0x06, 0xFB, 0x8A, 0x06, 0xF9, 0xDE, 0xA3, 0x61,
+    0x11, 0x41, 0xAA, 0x43, 0xDC, 0x76, 0x96, 0xDF, 0x3D, 0xCF, 0x63, 0xFF, 0xEC, 0xF2, 0x68, 0x2C,
+    0x1E, 0x6C, 0xA6, 0x86, 0xA6, 0x11, 0x18, 0x50, 0x8E, 0x0A, 0x62, 0x2E, 0x33, 0x77, 0x9D, 0xC1,
+    0x4B, 0xD2, 0x59, 0x5A, 0xA2, 0xA8, 0x7D, 0xE9, 0xE1, 0x00, 0x61, 0x27, 0x4B, 0x28, 0xAA, 0x66,
+    0xBE, 0x60, 0xAA, 0xCD, 0x45, 0x59, 0x52, 0xD8, 0xFC, 0x40, 0x59, 0xF5, 0x04, 0x43, 0xF5, 0xED,
+    0xDC, 0xB5, 0xAD, 0xDE, 0x3B, 0xED, 0x81, 0x0A, 0x56, 0x94, 0x2B, 0xCB, 0x8C, 0xF9, 0xC0, 0x07,
+    0x43, 0xC9, 0x58, 0x5F, 0xB4, 0x2D, 0x85, 0xB5, 0x04, 0x5B, 0xB4, 0x1F, 0x62, 0xB9, 0xFC, 0xA1,
+    0x2C, 0xF4, 0x06, 0xAC, 0x60, 0xB2, 0x80, 0xDE, 0x90, 0xC0, 0x53, 0xA6, 0xFE, 0x32, 0x9C, 0xB5,
+    0xB1, 0x84, 0x74, 0x9E, 0x19, 0x5B, 0xAE, 0x2C, 0x08, 0x2E, 0x1B, 0x41, 0xE8, 0x1C, 0x0C, 0x1B,
+    0xC1, 0x9B, 0x05, 0x9E, 0xEF, 0x64, 0x44, 0x3D, 0x95, 0xC2, 0x9E, 0xA1, 0xBB, 0x9D, 0x06, 0xC2,
+    0xFC, 0xCE, 0xD2, 0xBD, 0xA7, 0xB2, 0x4B, 0x34, 0x62, 0xCD, 0xCA, 0x0A, 0xF2, 0xF9, 0xE8, 0x54,
+    0xE5, 0x21, 0xA6, 0x53, 0xA1, 0xDB, 0x24, 0x34, 0x47, 0x42, 0x38, 0x70, 0x0B, 0x6C, 0x4C, 0x81,
+    0x53, 0x42, 0xC6, 0x85, 0x98, 0x0F, 0xF4, 0x40, 0x59, 0xA1, 0x05, 0xAE, 0x60, 0xF2, 0x42, 0xA6,
+    0x7E, 0x0A, 0xF4, 0xC4, 0x1E, 0xF4, 0x3C, 0x4E, 0xDA, 0x35, 0xFF, 0xE3, 0xA3, 0x1C, 0xAC, 0xF9,
+    0x10, 0x27, 0x73, 0xAA, 0x7A, 0xBB, 0x3C, 0xDF, 0x4B, 0xFA, 0xF7, 0xE2, 0x75, 0x9E, 0xDD, 0x82,
+    0x63, 0x55, 0xD6, 0x9D, 0x36, 0x63, 0x27, 0xDE, 0xB8, 0x0C, 0x87, 0x14, 0xA0, 0xDC, 0x39, 0xDF,
+    0x1E, 0x77, 0x9F, 0xEA, 0x86, 0x74, 0x4D, 0x34, 0xE6, 0xBF, 0xC1, 0x10, 0x4C, 0x4F, 0x8F, 0xBA,
+    0xB2, 0x87, 0x63, 0x47, 0x9F, 0x8E, 0x25, 0xB0, 0x3E, 0x64, 0x09, 0xE4, 0xF2, 0x27, 0xF3, 0x95,
+    0x26, 0xA0, 0x56, 0x1F, 0x75, 0x4C, 0xAF, 0x87, 0xC3, 0x3E, 0x66, 0x4B, 0x20, 0x09, 0x21, 0x33,
+    0x52, 0x56, 0xCA, 0xC1, 0x62, 0xC8, 0xAE, 0x7E, 0xA1, 0x78, 0x90, 0x0C, 0xB7, 0x0E, 0xA0, 0x5E,
+    0xA5, 0xFD, 0x0F, 0xBC, 0x0C, 0x17, 0x8D, 0x64, 0x38, 0x93, 0xAC, 0x01, 0x9F, 0x56, 0xB6, 0x0E,
+    0xEE, 0xAB, 0xAC, 0x78, 0xE9, 0x35, 0x3F, 0xA2, 0xE0, 0x7B, 0x88, 0xAD, 0x20, 0x8A, 0x78, 0xA7,
+    0xCA, 0xAC, 0x81, 0x8F, 0xF0, 0x71, 0xE3, 0x62, 0x0E, 0x97, 0x6D, 0x7F, 0x68, 0xA1, 0xD1, 0x53,
+    0x0B, 0x8D, 0x1E, 0x5B, 0x68, 0xF4, 0xDC, 0x42, 0x8D, 0x40, 0x90, 0x8A, 0x27, 0x17, 0x1A, 0x3D,
+    0xBA, 0xD0, 0xE8, 0xD9, 0x85, 0x46, 0x0F, 0x2F, 0x34, 0x7A, 0x7A, 0xA1, 0xD1, 0xE3, 0x0B, 0x8D,
+    0x9E, 0x5F, 0x68, 0xF4, 0x00, 0x43, 0xA3, 0x27, 0x18, 0x1A, 0x3D, 0xC2, 0xD0, 0xE8, 0x19, 0x86,
+    0x46, 0x0F, 0x31, 0x34, 0x3C, 0xC5, 0xD0, 0x75, 0x3C, 0xC6, 0x10, 0x55, 0x2A, 0x4A, 0x9B, 0x1E,
+    0x64, 0xE8, 0x7C, 0x58, 0xC3, 0x5A, 0x3C, 0x83, 0x9F, 0x85, 0xF5, 0xB0, 0x86, 0xA5, 0xA9, 0xC9,
+    0xC2, 0xE4, 0x95, 0xA1, 0xFF, 0x91, 0x1E, 0x8A, 0x82, 0xE8, 0x4E, 0x9E, 0x14, 0x92, 0xE1, 0xA8,
+    0x90, 0x14, 0x39, 0x2F, 0x79, 0x66, 0x59, 0x95, 0x1D, 0xAA, 0x0B, 0x37, 0x5A, 0x54, 0x6F, 0xFC,
+    0xAF, 0x06, 0xD5, 0xEB, 0x5F, 0xD5, 0xA8, 0x5E, 0xFB, 0xA6, 0x42, 0xF5, 0xAA, 0x5B, 0xA0, 0x7A,
+    0x45, 0xC8, 0x2D, 0x22, 0xC0, 0x41, 0x75, 0x33, 0xCB, 0xFC, 0x75, 0xC4, 0x40, 0x30, 0x78, 0x6A,
+    0xE4, 0x75, 0xF3, 0xCC, 0x7A, 0x2D, 0x24, 0xC3, 0x57, 0xA7, 0xAF, 0x3D, 0xB2, 0x94, 0xA0, 0x42,
+    0x82, 0x4C, 0x16, 0x46, 0xFD, 0x53, 0xE5, 0x7A, 0x1A, 0xF8, 0x50, 0x9B, 0xF5, 0xF3, 0x9D, 0x9E,
+    0xE9, 0xA9, 0xBD, 0x60, 0xF6, 0xD3, 0x06, 0x67, 0x2F, 0x6C, 0x21, 0x0D, 0xAE, 0x24, 0x02, 0xF9,
+    0x30, 0xED, 0x89, 0x9A, 0x09, 0x91, 0x57, 0x51, 0x4D, 0xAF, 0x24, 0xD5, 0xD2, 0x7F, 0xBC, 0x75,
+    0xE0, 0xC4, 0xA5, 0x52, 0x4F, 0x5C, 0xB2, 0xCB, 0x13, 0x97, 0x7E, 0x53, 0x87, 0xEE, 0x62, 0xCD,
+    0x20, 0xD8, 0x38, 0x63, 0xFF, 0x6F, 0xB6, 0x4B, 0x18, 0x67, 0xF5, 0x01, 0x99, 0xF0, 0xD9, 0xCE,
+    0x40, 0x15, 0x67, 0xC8, 0xD7, 0x42, 0x99, 0x2C, 0xE2, 0x35, 0x91, 0xFB, 0x91, 0x47, 0x6F, 0x34,
+    0x15, 0x89, 0x34, 0x56, 0xD3, 0x1D, 0x5C, 0x35, 0xA4, 0xE6, 0x4D, 0x7A, 0x32, 0x51, 0x06, 0xBA,
+    0x83, 0xB9, 0xAA, 0x0B, 0xBD, 0x66, 0x15, 0x57, 0xF1, 0xFE, 0xF6, 0x15, 0x9A, 0x92, 0x49, 0x9B,
+    0x59, 0xD9, 0x82, 0x95, 0xC3, 0x71, 0x10, 0x3E, 0x41, 0x63, 0x10, 0x02, 0x75, 0xB8, 0xE8, 0x1D,
+    0x1E, 0x87, 0xCF, 0x6D, 0x7F, 0xFB, 0x2A, 0x82, 0xFE, 0xF5, 0x88, 0x50, 0x54, 0xEA, 0xC2, 0xAB,
+    0x96, 0xA3, 0xEB, 0x42, 0x0D, 0xCC, 0xB6, 0x82, 0x90, 0xA1, 0x66, 0xB5, 0x4D, 0x8B, 0x44, 0xF3,
+    0xB3, 0x29, 0x8D, 0xB3, 0x39, 0x9B, 0x05, 0x3B, 0x94, 0xC1, 0x69, 0xE6, 0x70, 0x45, 0xDA, 0xE3,
+    0xCF, 0xC2, 0xCE, 0xD5, 0x81, 0x5F, 0xB2, 0x72, 0x45, 0xD2, 0xF2, 0x2F, 0x21, 0x3B, 0xDF, 0x46,
+    0x40, 0x24, 0xE4, 0xBB, 0x14, 0x81, 0x30, 0x48, 0x82, 0x9E, 0x33, 0xAD, 0xE4, 0x0C, 0xB9, 0x21,
+    0x76, 0x45, 0x5A, 0xE4, 0x19, 0x76, 0x44, 0xE4, 0x3A, 0xDD, 0x0D, 0xAB, 0xFF, 0x9F, 0xA0, 0x18,
+    0x95, 0xEC, 0xF0, 0xC9, 0x6D, 0xDB, 0xB8, 0x67, 0x55, 0x8E, 0x3C, 0xDD, 0x6D, 0x3B, 0x1B, 0xB7,
+    0x33, 0xB9, 0x7A, 0xFA, 0x8A, 0xA0, 0xF7, 0x62, 0xDA, 0xE5, 0xF3, 0x83, 0xE8, 0x3D, 0x3A, 0x23,
+    0x01, 0xC7, 0xFF, 0xD4, 0x90, 0xA0, 0x90, 0xF3, 0xB7, 0xC6, 0x99, 0x47, 0x36, 0xE5, 0xA4, 0x31,
+    0x3F, 0xF2, 0x69, 0x26, 0x48, 0xAF, 0x9E, 0x8F, 0x0E, 0xA3, 0xD8, 0xD2, 0x28, 0xF0, 0xE1, 0xA8,
+    0x77, 0x61, 0x8D, 0xFD, 0x36, 0x64, 0xB8, 0x0C, 0x0F, 0x9D, 0x19, 0xC2, 0xDA, 0x35, 0x00, 0x54,
+    0x03, 0x53, 0x27, 0xAA, 0x81, 0x1F, 0x05, 0xF5, 0x74, 0xD5, 0xB4, 0x64, 0xBA, 0x0D, 0x0D, 0x7E,
+    0x82, 0xC0, 0x31, 0x28, 0xE4, 0x70, 0xA2, 0x2A, 0x13, 0xB5, 0xC0, 0x5E, 0x0F, 0x68, 0x8A, 0xA1,
+    0xA6, 0x7A, 0x65, 0x70, 0xD1, 0xFF, 0xB3, 0x65, 0x78, 0x40, 0x48, 0xF9, 0x61, 0x6D, 0x54, 0x05,
+    0x82, 0x96, 0x90, 0xF5, 0x90, 0x54, 0xB1, 0xAA, 0x84, 0x22, 0x86, 0xAA, 0xEA, 0x67, 0x92, 0x97,
+    0xE9, 0x95, 0xBC, 0xD5, 0x2E, 0x61, 0x6C, 0x0E, 0x6E, 0xD8, 0xBF, 0x05, 0xE3, 0x9D, 0x2E, 0x12,
+    0x84, 0x32, 0x15, 0x28, 0x93, 0xC5, 0x8B, 0x6B, 0x39, 0x4C, 0x8F, 0x3C, 0x07, 0x26, 0x2A, 0x7E,
+    0xA2, 0x6C, 0x6B, 0xDE, 0xAF, 0xD5, 0x61, 0xF1, 0xE3, 0x23, 0x82, 0x1E, 0xFF, 0xEE, 0x1C, 0x87,
+    0xDD, 0x84, 0x25, 0x25, 0x67, 0xCA, 0x4A, 0xBE, 0x32, 0x3F, 0x0E, 0x0F, 0x05, 0x78, 0x3E, 0x6D,
+    0x9D, 0x6E, 0x2A, 0x2B, 0x18, 0x56, 0x79, 0x86, 0x32, 0x9D, 0xAF, 0xAF, 0xE6, 0x93, 0x38, 0xBC,
+    0x7B, 0xB6, 0x78, 0x09, 0x49, 0xC8, 0x38, 0x73, 0xF2, 0xC0, 0xFB, 0x1E, 0xFD, 0xAC, 0x38, 0xEA,
+    0x66, 0x6B, 0xA0, 0xF1, 0x47, 0x97, 0x70, 0x09, 0x18, 0x0E, 0x4C, 0xA7, 0x98, 0x5D, 0x0C, 0xCE,
+    0x46, 0x9F, 0x5A, 0x8B, 0x5D, 0x73, 0x6E, 0x7C, 0x8E, 0x24, 0xC1, 0x19, 0xAC, 0xEF, 0x4B, 0x1B,
+    0x5B, 0xBD, 0x9E, 0x89, 0xCD, 0xEC, 0xCA, 0x73, 0x38, 0x64, 0x93, 0x47, 0x41, 0xC8, 0x84, 0xB7,
+    0x43, 0x39, 0xB5, 0x89, 0x84, 0xC9, 0x7C, 0x4E, 0xD9, 0x1B, 0x0E, 0x0C, 0xBC, 0x06, 0x9D, 0xC5,
+    0xD2, 0x68, 0x4A, 0x3E, 0x82, 0xBF, 0x5A, 0xF5, 0x6E, 0x60, 0x7B, 0x4E, 0xBC, 0xB4, 0x39, 0xED,
+    0x7F, 0x5F, 0x3A, 0x96, 0x6E, 0xDB, 0x16, 0xCD, 0x23, 0x99, 0x92, 0x0E, 0xC0, 0x17, 0xB6, 0xAF,
+    0xFA, 0xF3, 0xC6, 0x09, 0xCE, 0x6E, 0x6E, 0x3C, 0xE5, 0xF3, 0xC6, 0x27, 0xDB, 0xDB, 0xF0, 0xFB,
+    0xE1, 0xA0, 0x96, 0x22, 0xD0, 0x14, 0x89, 0x47, 0x3F, 0x9D, 0xE2, 0xA5, 0x09, 0x93, 0xC8, 0x1B,
+    0x0F, 0x5E, 0x9C, 0x2C, 0xD6, 0x83, 0xBB, 0x9F, 0xD2, 0xD0, 0xD6, 0xE5, 0x8E, 0x6C, 0x74, 0x8E,
+    0xC9, 0xA3, 0x0D, 0x4F, 0x69, 0x17, 0x3C, 0xCB, 0x03, 0xDD, 0x3A, 0x4C, 0xB5, 0x8E, 0xC8, 0xF4,
+    0xC4, 0x59, 0xA6, 0x7A, 0x74, 0xB7, 0xD0, 0x70, 0x9C, 0xE2, 0x59, 0xF1, 0x60, 0xEF, 0x85, 0x3F,
+    0xEA, 0x1B, 0xE6, 0x96, 0x63, 0xA0, 0xCF, 0x09, 0xE5, 0xFD, 0x82, 0x71, 0xF2, 0xEC, 0x70, 0x04,
+    0xF8, 0xFF, 0x71, 0xC7, 0x67, 0x7A, 0x06, 0x75, 0x54, 0x4C, 0xDB, 0xA4, 0x44, 0xC1, 0x67, 0xB3,
+    0x9E, 0xFD, 0xA9, 0xA7, 0xF2, 0x35, 0x71, 0x8B, 0x6C, 0x32, 0x3D, 0x95, 0x6F, 0x7C, 0x16, 0x27,
+    0xFF, 0xCF, 0x88, 0x1E, 0xD7, 0x92, 0x23, 0xCE, 0xE1, 0xFC, 0xFF, 0x2F, 0x9F, 0x75, 0x7D, 0x55,
+    0x7F, 0x7A, 0xE2, 0x55, 0x7D, 0xDA, 0xE3, 0x3D, 0xB0, 0xAA, 0x99, 0x79, 0x8C, 0x73, 0x10, 0xCE,
+    0xFF, 0xCC, 0xE8, 0x71, 0x08, 0x04, 0xB3, 0xF2, 0xBB, 0x6B, 0x79, 0x1E, 0x4F, 0xF5, 0x6C, 0xDE,
+    0x24, 0xA8, 0x0D, 0x14, 0x66, 0x94, 0x17, 0x83, 0x7A, 0x24, 0x19, 0x3D, 0x86, 0x03, 0xCE, 0xEE,
+    0x43, 0x76, 0x9F, 0xE6, 0xE1, 0xEC, 0x6F, 0x6F, 0x5F, 0x1D, 0x42, 0x13, 0x01, 0x96, 0xDD, 0x78,
+    0x16, 0x67, 0x39, 0x2A, 0xCD, 0x7E, 0xAD, 0xF1, 0xE0, 0x10, 0xCD, 0x7E, 0x9A, 0xF3, 0xF2, 0x67,
+    0x53, 0xF8, 0xB5, 0x71, 0x5E, 0x12, 0xC1, 0x77, 0xD7, 0xFA, 0xF2, 0x4C, 0x0E, 0xBA, 0x3C, 0xFB,
+    0x2F, 0xA5, 0x63, 0xEE, 0x82, 0xE8, 0x94, 0x1D, 0x0E, 0x4E, 0xA9, 0xAD, 0x5C, 0xB9, 0xD1, 0x8C,
+    0x72, 0xC2, 0x9F, 0xF2, 0x0C, 0x31, 0x55, 0x3D, 0xFE, 0x12, 0x61, 0xD5, 0xB7, 0xB0, 0x64, 0x22,
+    0x67, 0x06, 0x8D, 0x68, 0x07, 0x66, 0xE3, 0xF9, 0x55, 0x72, 0x3C, 0x08, 0x0D, 0x03, 0xCC, 0x27,
+    0x3E, 0x96, 0x22, 0xAA, 0x66, 0x3E, 0x03, 0x7C, 0x06, 0xDF, 0x03, 0x15, 0xE3, 0x09, 0x32, 0xC0,
+    0xCD, 0x2A, 0x03, 0x3C, 0xB7, 0x43, 0x2C, 0x45, 0xD2, 0x2F, 0x43, 0x44, 0xDA, 0xA5, 0xA5, 0x7E,
+    0x08, 0x4C, 0x7A, 0x41, 0xA3, 0x0E, 0x8A, 0xE1, 0xB4, 0xCC, 0x5F, 0x78, 0xD2, 0x24, 0x8D, 0x4A,
+    0x7B, 0x04, 0x41, 0x1D, 0x16, 0xA3, 0x75, 0x7B, 0x6A, 0x67, 0xDF, 0x83, 0xEF, 0x4F, 0x85, 0xE7,
+    0xA3, 0x04, 0xD5, 0x8A, 0xEF, 0x3F, 0xEA, 0x09, 0x9A, 0x3E, 0x2B, 0x65, 0xF8, 0xFF, 0x97, 0x16,
+    0xBF, 0xD5, 0xFF, 0x65, 0xC4, 0xE3, 0xBC, 0xE7, 0xCB, 0xA2, 0xD2, 0xEF, 0x11, 0x85, 0x6C, 0xA6,
+    0x3D, 0xD1, 0x99, 0x7B, 0x30, 0xBF, 0x15, 0x34, 0x58, 0xAF, 0xFF, 0xBE, 0x9D, 0x99, 0x29, 0xF5,
+    0x36, 0xC8, 0xFC, 0x03, 0x1C, 0xCB, 0xE2, 0xCB, 0x30, 0xC2, 0x67, 0x77, 0x90, 0xFC, 0xC0, 0x75,
+    0x6F, 0xF4, 0x4B, 0x78, 0x88, 0xEB, 0x3E, 0xE9, 0x63, 0x37, 0x1F, 0x4B, 0x6A, 0x4C, 0xFF, 0x11,
+    0x1C, 0x3A, 0xCB, 0xB2, 0x86, 0x3A, 0x1F, 0xA8, 0xE5, 0xD8, 0x50, 0x07, 0x99, 0x0F, 0x0E, 0xA7,
+    0x87, 0x4F, 0x9D, 0x19, 0x47, 0xA1, 0x85, 0xAB, 0x12, 0x6C, 0x21, 0xA0, 0x11, 0x62, 0x87, 0x2C,
+    0xD3, 0x47, 0xDC, 0x9E, 0xA2, 0xA2, 0x26, 0xB5, 0x37, 0xC8, 0xE5, 0x43, 0x48, 0x13, 0xCF, 0xCE,
+    0xF1, 0xFF, 0xDD, 0x86, 0xC9, 0x3F, 0x3B, 0x18, 0xD2, 0x34, 0xF3, 0x36, 0xC2, 0x55, 0x48, 0x53,
+    0xEC, 0x83, 0x4A, 0xEA, 0x21, 0x04, 0x2A, 0x60, 0x38, 0x14, 0x42, 0xA3, 0x18, 0xD2, 0x04, 0x95,
+    0x0C, 0xB6, 0x00, 0x68, 0xC6, 0x09, 0x4C, 0x56, 0x4A, 0x32, 0x87, 0xBC, 0x28, 0x85, 0xFC, 0xE6,
+    0x9F, 0x70, 0x6B, 0xA6, 0xFA, 0xBF, 0xD9, 0x69, 0x2A, 0xFF, 0xC0, 0xD1, 0xFD, 0x81, 0xBC, 0x33,
+    0x1F, 0xD8, 0x34, 0x63, 0x7C, 0xD7, 0x2A, 0xB0, 0x29, 0x5F, 0x52, 0x22, 0x3E, 0xB7, 0x3A, 0x90,
+    0xD7, 0x8D, 0x0E, 0xE4, 0x15, 0x85, 0x0A, 0x81, 0x4D, 0x76, 0x3E, 0x39, 0x22, 0xB0, 0x29, 0xD8,
+    0xA2, 0x62, 0x38, 0x37, 0x3A, 0x41, 0xC1, 0x47, 0x3A, 0x41, 0x9C, 0x1F, 0x4E, 0xCF, 0x4C, 0x0F,
+    0x3A, 0x9C, 0x2C, 0xFF, 0x2B, 0x92, 0xCF, 0xFC, 0x89, 0x7A, 0xA7, 0xB6, 0xDC, 0xD7, 0x1B, 0x31,
+    0xFF, 0x73, 0x94, 0x25, 0xF0, 0xFF, 0x15, 0x09, 0x83, 0x66, 0x3F, 0x69, 0x75, 0x46, 0x38, 0x21,
+    0x4C, 0x48, 0xC7, 0x74, 0xD0, 0xDB, 0x51, 0x63, 0x32, 0xDA, 0xFB, 0x8F, 0xED, 0xDB, 0xCE, 0xFD,
+    0x0A, 0xDA, 0x65, 0xA7, 0x40, 0xFE, 0xFC, 0xBF, 0x47, 0x8C, 0x6D, 0x79, 0xD8, 0xF0, 0xC4, 0x65,
+    0xFF, 0x0F, 0xD5, 0x5A, 0xBF, 0x6F, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0x2B, 0x11, 0x11, 0x87, 0xE7,
+    0x04, 0x12, 0xD0, 0xB8, 0x40, 0xB9, 0xB6, 0x06, 0x5A, 0xAE, 0x2D, 0xE0, 0x94, 0x0C, 0x3A, 0x64,
+    0xB4, 0x06, 0x69, 0x28, 0x32, 0x24, 0x43, 0x86, 0xB6, 0x8B, 0xFE, 0x81, 0xA0, 0x64, 0xAA, 0xA1,
+    0xAB, 0xB7, 0x0E, 0x59, 0x02, 0xC4, 0x40, 0x83, 0x0C, 0x55, 0xC6, 0x0E, 0x71, 0xF8, 0x1A, 0x03,
+    0x2D, 0xD0, 0x2C, 0x6C, 0x3A, 0x04, 0xE8, 0x62, 0x06, 0x69, 0x63, 0x20, 0x1E, 0xCC, 0xA0, 0x2C,
+    0x44, 0x47, 0x24, 0x6F, 0xBF, 0xEF, 0xDC, 0xC7, 0xF7, 0xF8, 0x94, 0x1F, 0x72, 0xEA, 0x27, 0xE9,
+    0xD9, 0x4F, 0x3C, 0x34, 0xC9, 0xCB, 0x73, 0xEF, 0xF9, 0xEE, 0xB9, 0xE7, 0xD7, 0xA5, 0x78, 0x66,
+    0x2A, 0x22, 0x9E, 0x29, 0x40, 0x03, 0x53, 0x82, 0x4E, 0x4C, 0x45, 0x7A, 0x52, 0x83, 0x46, 0xF7,
+    0x1A, 0xD0, 0xF8, 0x1F, 0x2D, 0x68, 0x7A, 0xA7, 0x03, 0xCD, 0x5F, 0x33, 0xA0, 0x26, 0x01, 0x75,
+    0x0C, 0xCE, 0xE2, 0x1A, 0xC9, 0xA7, 0x60, 0xF0, 0x36, 0x18, 0xF9, 0xC6, 0x80, 0x45, 0x00, 0x5A,
+    0x81, 0x0D, 0x69, 0x58, 0xCB, 0xA4, 0x91, 0x18, 0x97, 0xAD, 0xC4, 0xA5, 0xF8, 0x9D, 0xA4, 0x85,
+    0x78, 0xBD, 0x18, 0xBE, 0x22, 0xCB, 0xFF, 0x72, 0xA5, 0x60, 0x39, 0xA7, 0xF9, 0xD2, 0x73, 0xD7,
+    0xF4, 0xE4, 0x3A, 0x05, 0xFF, 0xCA, 0xBB, 0x19, 0x61, 0x94, 0x93, 0x5A, 0x8F, 0x03, 0x53, 0xE3,
+    0x7E, 0x1D, 0x9B, 0xA3, 0x3A, 0x2F, 0x26, 0xB5, 0x99, 0xE2, 0xC8, 0x42, 0xFC, 0x3F, 0xAD, 0x53,
+    0xBD, 0x7F, 0x5C, 0x07, 0xE6, 0xB0, 0x96, 0xDD, 0x19, 0xA3, 0x09, 0xC4, 0xE4, 0xEB, 0xCA, 0xA2,
+    0x1C, 0x77, 0xE1, 0x69, 0xBF, 0x16, 0x13, 0x27, 0x2C, 0xB4, 0xB1, 0xD2, 0x94, 0x77, 0xE4, 0xB6,
+    0x36, 0xFA, 0xE5, 0xB8, 0xFD, 0x65, 0xA3, 0x97, 0xA2, 0xBB, 0x14, 0x1D, 0x3C, 0x83, 0xC3, 0xC1,
+    0x11, 0x34, 0x76, 0xC8, 0x5B, 0xC9, 0x4A, 0x31, 0xFB, 0x15, 0x09, 0xF9, 0x3B, 0xE6, 0xB0, 0xA2,
+    0xC4, 0xFF, 0xCC, 0xC0, 0xE6, 0x3E, 0x65, 0x8D, 0x9E, 0xA7, 0x7C, 0x3F, 0xC0, 0x6F, 0x5D, 0x50,
+    0xB9, 0x9A, 0xB1, 0x83, 0x44, 0xE2, 0x1A, 0x13, 0x96, 0x77, 0x6F, 0x60, 0xE0, 0xD0, 0x24, 0xBF,
+    0x0C, 0x33, 0x71, 0x12, 0x27, 0x59, 0x68, 0x93, 0x42, 0x43, 0xDE, 0x95, 0x58, 0x70, 0x14, 0x1D,
+    0x25, 0xC0, 0x87, 0x4F, 0x6B, 0x21, 0x42, 0x42, 0x88, 0x84, 0x18, 0x09, 0x41, 0x12, 0xA2, 0x24,
+    0xA9, 0x7D, 0x7A, 0x5C, 0x8B, 0x02, 0xA5, 0x48, 0x5D, 0x53, 0xD6, 0x31, 0xFB, 0x97, 0xE0, 0xEF,
+    0x06, 0x67, 0xE7, 0x4D, 0x85, 0x61, 0x72, 0x6F, 0x0D, 0xA1, 0xFA, 0xB5, 0x58, 0x9C, 0xD0, 0xDD,
+    0x1D, 0xB0, 0x72, 0x5E, 0xE7, 0x60, 0xC2, 0x0F, 0xD0, 0x7F, 0xEC, 0xA0, 0xE3, 0x6D, 0xFC, 0xEC,
+    0xBF, 0x88, 0x23, 0x33, 0x06, 0xC3, 0xC8, 0x0D, 0x7A, 0xFE, 0xA9, 0x6B, 0xE6, 0x6B, 0x14, 0x64,
+    0xD3, 0x80, 0xA0, 0xBB, 0xC4, 0x33, 0x5F, 0x98, 0x24, 0xE8, 0x70, 0x0F, 0xDD, 0x81, 0x34, 0x0E,
+    0x2F, 0x7D, 0x93, 0xF8, 0xF6, 0xA9, 0x49, 0x13, 0xC9, 0x1B, 0x74, 0xB8, 0x31, 0x5E, 0x73, 0x76,
+    0x05, 0x6E, 0xD5, 0x7A, 0x51, 0x51, 0xAE, 0xDF, 0x15, 0x84, 0xE4, 0xA3, 0x64, 0x4D, 0x61, 0x13,
+    0x9D, 0x6B, 0x07, 0xEA, 0x23, 0x07, 0x38, 0x42, 0xE8, 0x59, 0x23, 0x79, 0xFB, 0x32, 0xB5, 0xCC,
+    0xAB, 0xC2, 0x6C, 0xD0, 0xB1, 0x95, 0xAC, 0x3D, 0xE7, 0x56, 0x00, 0xEA, 0x9B, 0x23, 0x4A, 0xF7,
+    0x12, 0x65, 0x79, 0xCA, 0xB9, 0x45, 0xEE, 0xD7, 0x54, 0xC9, 0x54, 0x76, 0xF7, 0x84, 0xF2, 0x06,
+    0xC5, 0x7B, 0x7C, 0x2A, 0x9B, 0x6B, 0x82, 0x52, 0x94, 0x55, 0x62, 0x4E, 0x4A, 0xE7, 0x63, 0x5C,
+    0x27, 0x98, 0x71, 0x1F, 0xDD, 0x85, 0x00, 0x2D, 0x4D, 0x33, 0xA7, 0x09, 0x0A, 0x49, 0xAC, 0x6D,
+    0xF9, 0xFF, 0x51, 0xBA, 0x37, 0xB2, 0x50, 0xFB, 0x96, 0xD5, 0x74, 0x2E, 0x69, 0xA8, 0xD2, 0xA5,
+    0x09, 0x67, 0x69, 0x5B, 0x76, 0xD6, 0xC8, 0x62, 0x3F, 0x9A, 0xBF, 0xDB, 0x80, 0x58, 0x31, 0x06,
+    0x63, 0x3A, 0x71, 0xBB, 0x3C, 0x09, 0xAA, 0xB0, 0xD8, 0x58, 0xA5, 0x5E, 0x0D, 0xAE, 0x6D, 0xEE,
+    0x07, 0x8B, 0x51, 0xC7, 0xB8, 0x54, 0x7F, 0x17, 0x91, 0x3C, 0x77, 0xFD, 0x47, 0xFA, 0xDF, 0x57,
+    0x15, 0xAB, 0x56, 0xD1, 0x23, 0x62, 0xF2, 0x8B, 0xB5, 0xF1, 0x83, 0x6F, 0x81, 0x0D, 0xBA, 0xF0,
+    0x4A, 0xF1, 0xFE, 0xF2, 0xF3, 0xA9, 0x57, 0x87, 0x53, 0x87, 0x36, 0x29, 0x45, 0x57, 0xCE, 0x0A,
+    0xFD, 0xA0, 0x63, 0x15, 0xB6, 0x51, 0x8E, 0xEF, 0x2A, 0x36, 0xDF, 0x5F, 0x77, 0x6C, 0x68, 0xE3,
+    0x23, 0x60, 0x10, 0xE0, 0xF2, 0xFD, 0xC3, 0xF3, 0xC3, 0x46, 0xF6, 0xAC, 0x36, 0x5B, 0xC5, 0x52,
+    0xC6, 0x21, 0xC9, 0xF5, 0x9F, 0x5C, 0xA7, 0x7C, 0x0A, 0x57, 0x68, 0x1A, 0xB5, 0x65, 0xE5, 0x5A,
+    0x21, 0xC4, 0x48, 0x49, 0x7D, 0x10, 0xE3, 0x9A, 0x42, 0xFC, 0xBF, 0xBE, 0x30, 0xF5, 0x10, 0x2A,
+    0x38, 0xF4, 0x74, 0x8C, 0xAC, 0x56, 0xAA, 0x41, 0x6F, 0xF9, 0x23, 0x6B, 0xDE, 0xAB, 0xBD, 0xA6,
+    0x35, 0xDF, 0xC2, 0x0F, 0x77, 0xB2, 0x48, 0x9F, 0x52, 0x46, 0x47, 0xB1, 0x92, 0x9D, 0x64, 0xCD,
+    0xAC, 0xF9, 0xE7, 0xD6, 0x9A, 0x3B, 0xA5, 0x53, 0x4A, 0xE3, 0x17, 0x08, 0x08, 0xA6, 0x08, 0x0F,
+    0xAC, 0x4B, 0x5C, 0x95, 0x35, 0xDF, 0xD6, 0x00, 0xE1, 0x67, 0xD0, 0x1A, 0xF4, 0x7B, 0xD2, 0xCF,
+    0xD7, 0x96, 0x6B, 0x35, 0x67, 0x5B, 0x9E, 0x34, 0x6B, 0x8E, 0x88, 0x60, 0xD7, 0x2F, 0xFC, 0xD2,
+    0xEB, 0x73, 0xAE, 0xBE, 0x6C, 0xF5, 0xAB, 0x8F, 0xAB, 0x0B, 0x20, 0xC4, 0x95, 0x3D, 0x6C, 0xEA,
+    0xC2, 0x10, 0x35, 0x1B, 0x1D, 0x09, 0xB3, 0x98, 0xA5, 0xE3, 0xB3, 0xB7, 0xD9, 0x66, 0x71, 0x9C,
+    0x7E, 0x6E, 0xDB, 0x24, 0x63, 0x3E, 0x63, 0x81, 0x1D, 0x46, 0x8D, 0x14, 0x76, 0x9C, 0xA8, 0xE5,
+    0x1D, 0xC0, 0xC1, 0x68, 0x21, 0x4F, 0x54, 0x87, 0x75, 0x5C, 0xF8, 0x6D, 0x3A, 0xF5, 0x5A, 0x44,
+    0x8E, 0x8B, 0x63, 0xC6, 0x3B, 0x66, 0x22, 0xD6, 0xC8, 0x3B, 0x6C, 0xEB, 0x11, 0xF0, 0x9C, 0x33,
+    0x39, 0x13, 0xC8, 0x27, 0x14, 0x8D, 0x3D, 0x82, 0x6A, 0x29, 0x45, 0xE3, 0x84, 0x3B, 0x61, 0x69,
+    0xD7, 0x2D, 0x19, 0xBD, 0xB7, 0x48, 0xCB, 0xCE, 0x4D, 0x66, 0x0C, 0x54, 0x22, 0xCC, 0xDB, 0xD3,
+    0x54, 0x48, 0x74, 0xE8, 0xB6, 0xCC, 0x29, 0x70, 0xCE, 0x56, 0x2A, 0xB7, 0xDF, 0x04, 0x59, 0x68,
+    0x8E, 0x92, 0x18, 0x63, 0x7B, 0x2E, 0x68, 0xA1, 0xED, 0xBB, 0xE7, 0x2B, 0x57, 0xEF, 0x96, 0x9E,
+    0xB9, 0x5F, 0x06, 0x1C, 0xFB, 0xF3, 0x06, 0x6B, 0x7B, 0x7B, 0x95, 0xF2, 0xC0, 0x35, 0x7B, 0x8D,
+    0x6B, 0x5E, 0x28, 0x7D, 0xF3, 0xB7, 0x24, 0xBC, 0x5B, 0x49, 0x0C, 0xFF, 0xF9, 0xCA, 0x6C, 0xB2,
+    0xCE, 0x49, 0xA6, 0x2D, 0x92, 0x28, 0xC3, 0x90, 0x7E, 0x83, 0xE7, 0x1D, 0x0C, 0x6C, 0x97, 0x0A,
+    0x43, 0xF3, 0xE9, 0x28, 0xFF, 0xA3, 0x7C, 0x2A, 0x20, 0x57, 0x5F, 0x25, 0x14, 0x51, 0x28, 0xA3,
+    0x50, 0x48, 0xE6, 0x39, 0x4B, 0x64, 0x3A, 0xD4, 0x00, 0x28, 0xAA, 0xCA, 0x6A, 0x5F, 0x53, 0x69,
+    0xAD, 0xB8, 0x94, 0x57, 0xD3, 0xE4, 0x54, 0x57, 0xE3, 0x21, 0x0C, 0x84, 0x6B, 0x33, 0xAA, 0xBB,
+    0xD4, 0x52, 0x17, 0xAB, 0xFA, 0x15, 0xFC, 0x16, 0x5A, 0xBA, 0x4C, 0x12, 0xCB, 0xFF, 0x34, 0x01,
+    0x02, 0x2A, 0xFA, 0x98, 0x7C, 0x55, 0xBB, 0x59, 0xE3, 0xE4, 0x14, 0x67, 0x4D, 0xF1, 0x22, 0xE2,
+    0x11, 0x7C, 0x88, 0x5B, 0xCE, 0xEF, 0x39, 0xD2, 0xC9, 0x47, 0x9A, 0xE2, 0xB5, 0xE3, 0x14, 0x2F,
+    0xE0, 0x83, 0x98, 0x66, 0x16, 0x96, 0x0F, 0x46, 0x09, 0x9A, 0xE0, 0xC1, 0xDC, 0x4D, 0x01, 0x48,
+    0x4C, 0xDB, 0x64, 0xC6, 0x84, 0x06, 0xD5, 0xD7, 0x68, 0xA7, 0x57, 0x0B, 0x96, 0x05, 0xF6, 0x35,
+    0xA1, 0xD2, 0x82, 0x15, 0x4D, 0xED, 0x3C, 0xC7, 0xA3, 0x2D, 0xE2, 0xFA, 0x75, 0x2A, 0xD7, 0xDC,
+    0x28, 0x7C, 0xF3, 0x81, 0x5C, 0x90, 0x1A, 0xA8, 0xFE, 0x71, 0x80, 0x9A, 0xA6, 0x31, 0x1C, 0x89,
+    0x9A, 0x77, 0xA9, 0x10, 0x2F, 0x5F, 0x9C, 0x42, 0xB8, 0xB7, 0xB6, 0x80, 0xC7, 0x1F, 0x65, 0x72,
+    0xD0, 0xCA, 0x77, 0x9D, 0x37, 0x10, 0x8F, 0x25, 0x9A, 0xB4, 0x79, 0x70, 0x50, 0x93, 0xE2, 0xB6,
+    0x3C, 0x2B, 0x57, 0xCF, 0x0F, 0x02, 0xFA, 0xEC, 0x1C, 0xC3, 0xF9, 0x3C, 0x5F, 0x64, 0x60, 0x13,
+    0xCE, 0xD2, 0x41, 0x26, 0x2D, 0x4C, 0xD7, 0xEE, 0xCC, 0xB4, 0x3C, 0xCE, 0x4A, 0x4F, 0x67, 0x2B,
+    0x7D, 0x9F, 0x9E, 0xA0, 0xD0, 0xF0, 0x77, 0xF2, 0x1F, 0xE8, 0x4C, 0x96, 0x23, 0xE9, 0xDA, 0xB9,
+    0x1C, 0x2F, 0xF4, 0x0D, 0xB9, 0xD3, 0x39, 0x7B, 0xA7, 0xA0, 0x23, 0xC0, 0x4F, 0xE5, 0x19, 0x6B,
+    0x40, 0x39, 0x5D, 0x84, 0xA3, 0xCF, 0x62, 0xFA, 0x6B, 0xFE, 0xF9, 0x26, 0x73, 0xB9, 0xBC, 0xCE,
+    0xFE, 0x83, 0x9F, 0x9B, 0xBF, 0xC5, 0x32, 0x5F, 0xDA, 0x3E, 0xD3, 0x3A, 0x6D, 0xD0, 0x4C, 0x0A,
+    0x06, 0xAC, 0x71, 0x79, 0xC6, 0xEF, 0x71, 0x3B, 0x54, 0x57, 0xDB, 0x70, 0x95, 0xE3, 0xCF, 0x6B,
+    0x66, 0x75, 0xA0, 0x82, 0xBC, 0x43, 0xCD, 0x0D, 0xCF, 0x1A, 0x81, 0x5D, 0xFA, 0xDA, 0xBE, 0x98,
+    0xCF, 0x56, 0xA0, 0x51, 0x6D, 0xCE, 0x09, 0x74, 0x35, 0xC2, 0x0A, 0xCC, 0x67, 0xB8, 0x35, 0xE9,
+    0x24, 0x6C, 0x89, 0xB5, 0xDF, 0x33, 0x7C, 0x41, 0x6C, 0x85, 0xF7, 0x31, 0x24, 0x44, 0x5B, 0x98,
+    0xD8, 0xAF, 0xA3, 0xB6, 0x8D, 0x6D, 0x1F, 0xD5, 0x7C, 0xD7, 0xF2, 0x09, 0xCC, 0xA7, 0xE0, 0xE9,
+    0x99, 0xD9, 0x4A, 0xA4, 0xB2, 0x7C, 0xCF, 0x3C, 0xD4, 0x68, 0x7A, 0x14, 0xA6, 0xA4, 0x36, 0x52,
+    0x9B, 0x2E, 0x68, 0x9A, 0x2C, 0x07, 0x74, 0x3D, 0x79, 0x14, 0xAA, 0x29, 0x4D, 0xD8, 0xC6, 0xA5,
+    0xDF, 0x41, 0x53, 0x10, 0xC1, 0xF1, 0x70, 0x8D, 0x3D, 0xBC, 0x9E, 0xF7, 0xF8, 0x8C, 0x6D, 0x18,
+    0xAF, 0xF1, 0x1D, 0xBE, 0x3B, 0xC4, 0x77, 0x12, 0x00, 0x0A, 0x98, 0x12, 0x3D, 0x26, 0xD5, 0x52,
+    0x17, 0xAA, 0xC7, 0x8E, 0xCD, 0x18, 0x5F, 0x54, 0xEA, 0x29, 0x0D, 0xAB, 0x45, 0x19, 0xF1, 0xC7,
+    0xB2, 0x76, 0xE8, 0x9D, 0x19, 0x09, 0xAD, 0x06, 0x39, 0x75, 0xA6, 0x42, 0x5F, 0x62, 0xEE, 0xD4,
+    0x34, 0xCD, 0x9F, 0x82, 0x7F, 0x70, 0x4C, 0xE5, 0x0C, 0x33, 0x7A, 0x9F, 0x67, 0xF1, 0x5B, 0x2F,
+    0x6C, 0xB6, 0x6E, 0x7E, 0x75, 0xE4, 0x31, 0x59, 0x76, 0x34, 0xBD, 0x3A, 0x9A, 0x62, 0xE6, 0x68,
+    0x20, 0xBE, 0x10, 0x07, 0x3A, 0x9A, 0x5E, 0x72, 0x4B, 0x34, 0x31, 0x51, 0x82, 0x4B, 0x7D, 0xA0,
+    0x4D, 0xB4, 0xB1, 0xD6, 0xA5, 0x95, 0x81, 0xB2, 0x52, 0xBC, 0xAE, 0xDA, 0x94, 0x5B, 0x15, 0xD9,
+    0x2F, 0x55, 0xA1, 0xDF, 0xD4, 0x84, 0x28, 0x38, 0x6E, 0xF4, 0x41, 0xB7, 0x7E, 0x80, 0x5D, 0x3B,
+    0x15, 0x9C, 0xFC, 0x61, 0x11, 0x9C, 0x24, 0xA7, 0x82, 0x93, 0x92, 0x36, 0xB4, 0x1B, 0x82, 0x93,
+    0xD7, 0x8C, 0xA2, 0x42, 0xE7, 0x1C, 0x97, 0xC1, 0x8C, 0x44, 0xD5, 0x40, 0x80, 0x14, 0x89, 0x36,
+    0xD1, 0xC6, 0x5A, 0x9D, 0xB6, 0x0C, 0x6C, 0x96, 0x38, 0x4A, 0x21, 0x67, 0xD6, 0x7B, 0xD3, 0x9A,
+    0xB8, 0x3F, 0xA9, 0xB6, 0x95, 0x9C, 0x9F, 0x4F, 0xD6, 0x5E, 0xDB, 0xF6, 0xE6, 0x15, 0x97, 0x97,
+    0xE6, 0x01, 0xCE, 0xED, 0xA5, 0x00, 0xE7, 0xFC, 0xF5, 0x0E, 0x11, 0xBE, 0x97, 0x90, 0xED, 0x03,
+    0x16, 0x99, 0x5E, 0xE7, 0x68, 0x36, 0x6D, 0x94, 0x7B, 0xF5, 0xE6, 0xB0, 0x3F, 0x25, 0x4E, 0xAF,
+    0x11, 0x63, 0xC9, 0xC8, 0x78, 0x33, 0xD9, 0x4C, 0xD6, 0x09, 0xC6, 0x28, 0x7B, 0x07, 0xD2, 0x54,
+    0xF2, 0xDF, 0xBC, 0x90, 0x5D, 0x04, 0x49, 0x88, 0xF5, 0x6C, 0x90, 0x74, 0x34, 0x95, 0x0E, 0x5E,
+    0x7E, 0x1E, 0x24, 0xAD, 0xC2, 0xA8, 0xED, 0x5B, 0xA7, 0x53, 0xCC, 0x0B, 0x85, 0x8C, 0x95, 0x44,
+    0xA3, 0x25, 0x0E, 0x67, 0xE3, 0x89, 0x73, 0x94, 0x0C, 0xB5, 0x22, 0x88, 0x90, 0xF6, 0x98, 0xE4,
+    0x34, 0xF3, 0xEB, 0x49, 0xC9, 0x62, 0xC7, 0x05, 0x38, 0xD0, 0x7D, 0x5B, 0x0C, 0xD0, 0x72, 0x63,
+    0x63, 0x83, 0x93, 0xC5, 0xD8, 0xF6, 0xE6, 0x5B, 0xC6, 0x44, 0x92, 0x8A, 0x6D, 0xCC, 0x61, 0x4B,
+    0x24, 0x4F, 0x1A, 0x22, 0x69, 0x2A, 0x22, 0x60, 0xA6, 0x67, 0x22, 0x29, 0xAB, 0x41, 0x72, 0x87,
+    0x88, 0x40, 0xC1, 0x6C, 0x9C, 0x4A, 0x15, 0x63, 0xE9, 0x62, 0x4F, 0x36, 0x12, 0xCD, 0xA0, 0x98,
+    0x69, 0xF5, 0x5E, 0x8B, 0xF7, 0xEF, 0x36, 0x5A, 0x79, 0x8A, 0x1E, 0x1E, 0x98, 0xEC, 0x91, 0xD7,
+    0xE6, 0xC3, 0x83, 0xAF, 0x59, 0x9B, 0xB3, 0x5A, 0x7E, 0x2B, 0x43, 0xAA, 0x86, 0x87, 0xC9, 0x90,
+    0x93, 0x2D, 0x00, 0x5E, 0x0F, 0x94, 0x9C, 0x7D, 0x1D, 0x4A, 0x32, 0x24, 0x56, 0x3A, 0xD5, 0x80,
+    0x0A, 0x73, 0xB9, 0x77, 0xAE, 0x28, 0x0D, 0x20, 0x64, 0x8B, 0x12, 0xE3, 0x8D, 0x6A, 0xE1, 0x19,
+    0xAC, 0x5E, 0xE9, 0x36, 0xA9, 0xFC, 0x70, 0xCD, 0xF4, 0x4A, 0x47, 0x46, 0x17, 0x15, 0x73, 0x8E,
+    0x9F, 0xEE, 0x86, 0x80, 0x49, 0x93, 0xF3, 0x80, 0x1A, 0xB6, 0x99, 0x5D, 0x00, 0x76, 0xAC, 0x59,
+    0xB1, 0xBC, 0x7F, 0x94, 0xCC, 0x4A, 0x00, 0x5A, 0xB9, 0xA2, 0x9B, 0x4D, 0xD6, 0x0F, 0xAF, 0x3C,
+    0xA9, 0xF0, 0xF2, 0x49, 0x65, 0x65, 0x09, 0xFE, 0x6C, 0xB2, 0x3D, 0x47, 0xBE, 0x73, 0x01, 0x28,
+    0xAD, 0x19, 0x0E, 0x67, 0xA7, 0x40, 0x7B, 0x83, 0xD9, 0x38, 0x57, 0x5C, 0x82, 0xA5, 0xEF, 0x2E,
+    0x16, 0xC9, 0x74, 0x8A, 0x30, 0xBA, 0x40, 0x2E, 0x1E, 0x97, 0x8F, 0x43, 0x52, 0x25, 0x05, 0x70,
+    0x04, 0x4A, 0x00, 0xB8, 0x7F, 0xD1, 0x64, 0x14, 0x81, 0x63, 0xA1, 0xDF, 0x1A, 0x0A, 0x35, 0x5F,
+    0x1A, 0x4B, 0x33, 0x1E, 0x8B, 0x49, 0x82, 0x06, 0x47, 0x7B, 0xE6, 0x91, 0x4D, 0x5A, 0x33, 0x0D,
+    0xDB, 0xFC, 0xDF, 0x79, 0x9B, 0xA2, 0x83, 0xC8, 0x1C, 0xB7, 0x81, 0x79, 0xBF, 0x95, 0x2B, 0x43,
+    0xEA, 0xC4, 0xBA, 0x42, 0x61, 0x8F, 0x68, 0x3A, 0xC2, 0x3A, 0xD2, 0x0D, 0x0B, 0xAE, 0xDD, 0x1D,
+    0x33, 0x6C, 0x1E, 0x38, 0xBA, 0x94, 0xF9, 0xC0, 0x2B, 0x2E, 0x0F, 0x94, 0x14, 0x16, 0x31, 0x6F,
+    0x46, 0x5F, 0x18, 0xD5, 0x4B, 0x5F, 0x18, 0xAD, 0x06, 0x1A, 0xEB, 0xA9, 0x74, 0xEF, 0x82, 0xC2,
+    0x2B, 0x32, 0x8E, 0xF5, 0x58, 0x5E, 0x2D, 0xB2, 0xA4, 0x30, 0x8E, 0x51, 0x18, 0x3E, 0xD4, 0xAD,
+    0x9B, 0xF8, 0x93, 0x4E, 0x4F, 0xF7, 0xB5, 0x26, 0x17, 0xB3, 0x4A, 0xC3, 0x53, 0xA6, 0xA7, 0x5A,
+    0x59, 0xB1, 0x16, 0xF1, 0xAD, 0x4F, 0xE9, 0xEC, 0x54, 0xD8, 0xE9, 0xAA, 0x74, 0x81, 0x28, 0x50,
+    0xFA, 0xD5, 0x90, 0xD1, 0xE0, 0x43, 0x77, 0xA5, 0x66, 0x70, 0xCD, 0x01, 0x9B, 0xC5, 0x78, 0xD9,
+    0xDC, 0xE7, 0xAA, 0x3E, 0x71, 0xB6, 0x77, 0x12, 0x2E, 0x3F, 0xFB, 0x29, 0x59, 0x9E, 0x59, 0xE0,
+    0x40, 0x7B, 0xEE, 0x44, 0x05, 0xA6, 0x55, 0x5A, 0x89, 0x7E, 0x42, 0x43, 0xDA, 0x7E, 0x03, 0xCD,
+    0xE8, 0xD4, 0x09, 0x27, 0x38, 0x01, 0x50, 0x2D, 0xB2, 0xB5, 0xFC, 0x50, 0x87, 0xF1, 0x64, 0x60,
+    0x7E, 0xCB, 0x81, 0x5D, 0x59, 0xC4, 0x49, 0xC3, 0xFA, 0x96, 0xC8, 0x7E, 0xEE, 0x16, 0xD8, 0x6C,
+    0x47, 0x15, 0x6C, 0x6C, 0x14, 0xD6, 0x1A, 0xDA, 0x0D, 0x8D, 0xEA, 0xFC, 0x7E, 0xB4, 0xD1, 0x16,
+    0x17, 0xB3, 0x55, 0xCB, 0x7D, 0xD2, 0xDD, 0x8B, 0x86, 0x76, 0x28, 0x70, 0x5B, 0x05, 0x8D, 0xEC,
+    0xC0, 0x76, 0x86, 0x0F, 0xF3, 0xE4, 0xCB, 0x3A, 0x3C, 0x5F, 0xC6, 0xEB, 0xAE, 0xC3, 0xF3, 0x4F,
+    0x0B, 0xED, 0x16, 0xB8, 0x5D, 0xFC, 0x76, 0xF9, 0x0F, 0xCA, 0x03, 0x13, 0x00, 0xD0, 0xB7, 0x92,
+    0x4B, 0x02, 0x3D, 0xCA, 0x5E, 0x55, 0x35, 0xF8, 0xA2, 0x51, 0xB7, 0xAA, 0xC9, 0x94, 0x47, 0x9B,
+    0x46, 0x4B, 0xB1, 0xF1, 0x04, 0xC1, 0xEC, 0x74, 0xD4, 0x0A, 0xDF, 0x3C, 0x98, 0xCE, 0x3E, 0x47,
+    0x94, 0x09, 0x5C, 0xE8, 0x0E, 0x64, 0xB8, 0x72, 0x49, 0xD0, 0x3E, 0x21, 0xEA, 0x39, 0x78, 0x67,
+    0x6B, 0x5E, 0x87, 0x53, 0x50, 0x9D, 0x12, 0xC5, 0x7E, 0x41, 0x71, 0x29, 0x48, 0x5A, 0x07, 0x6F,
+    0x6D, 0x94, 0xA5, 0x63, 0x97, 0xAF, 0x03, 0xD3, 0x8F, 0x4E, 0x35, 0x56, 0xB6, 0x96, 0x42, 0x6B,
+    0xBE, 0x1B, 0x33, 0x57, 0x07, 0x9C, 0xA2, 0x0A, 0xEE, 0x37, 0x2E, 0x63, 0x62, 0xCE, 0xAF, 0x4F,
+    0x31, 0x10, 0x96, 0xEA, 0x3B, 0x44, 0x64, 0xAE, 0xD1, 0x41, 0xDD, 0xE0, 0x0C, 0x3C, 0x60, 0xCD,
+    0x4C, 0xF7, 0x1A, 0x2D, 0x78, 0x83, 0x9D, 0xF4, 0xBA, 0x47, 0x23, 0xEA, 0xB3, 0x98, 0x9F, 0xDA,
+    0xD2, 0xB3, 0xA6, 0x0F, 0xB6, 0xB2, 0xB4, 0xB3, 0x28, 0x55, 0x73, 0xE7, 0x06, 0x8A, 0x11, 0x17,
+    0x18, 0x41, 0x54, 0xE1, 0xBD, 0x49, 0x85, 0x86, 0x93, 0x3A, 0xE0, 0x36, 0x01, 0xB2, 0x35, 0xAF,
+    0xC5, 0xCB, 0x6E, 0xC7, 0x7C, 0xA9, 0x8F, 0x31, 0x16, 0x03, 0x15, 0x92, 0x34, 0xD7, 0x9C, 0x60,
+    0xB0, 0x8F, 0x9A, 0x8B, 0x5A, 0x52, 0x0F, 0xBD, 0x51, 0x09, 0xAE, 0x71, 0xF0, 0xD4, 0x29, 0x89,
+    0xD9, 0x2C, 0xFE, 0xD7, 0x85, 0x8A, 0x3F, 0x0A, 0xD0, 0xDB, 0xE1, 0x9E, 0xDF, 0x0D, 0x97, 0xE7,
+    0x2D, 0xFE, 0xC7, 0x1D, 0xC4, 0xBF, 0x03, 0xCE, 0xE6, 0x10, 0xA4, 0x87, 0x53, 0x56, 0xF1, 0xE7,
+    0x3B, 0x4A, 0x94, 0x08, 0x5C, 0x36, 0xD2, 0x6C, 0x50, 0x10, 0x32, 0x55, 0xDF, 0xED, 0x0C, 0xDA,
+    0x7E, 0xC1, 0x58, 0x71, 0x07, 0xC0, 0x4A, 0xE4, 0xCC, 0xA3, 0x55, 0xB7, 0x1B, 0xF6, 0x2F, 0xDC,
+    0x9B, 0x97, 0xA7, 0x34, 0xC3, 0x46, 0xD5, 0x75, 0xE6, 0x19, 0x2D, 0x86, 0x87, 0xB4, 0xC3, 0x25,
+    0x32, 0x92, 0x38, 0x97, 0x83, 0x55, 0x9E, 0xD4, 0xF3, 0x7C, 0xB3, 0x14, 0x7F, 0x9A, 0x67, 0x82,
+    0x7C, 0xF3, 0xF2, 0x10, 0xFA, 0x1F, 0xB5, 0x58, 0x3D, 0x6C, 0xE5, 0xC6, 0x11, 0x1E, 0x3E, 0xE6,
+    0x89, 0x80, 0x08, 0x63, 0x55, 0x48, 0x01, 0xAC, 0x03, 0x4C, 0x37, 0x01, 0x62, 0xC1, 0x10, 0x53,
+    0xA4, 0xB8, 0xC2, 0xBE, 0x65, 0x2E, 0x5D, 0x9A, 0x53, 0x21, 0xA5, 0x4D, 0x1B, 0xAB, 0x88, 0x5D,
+    0xA4, 0x74, 0x44, 0xCA, 0x2A, 0x52, 0xB8, 0x88, 0x80, 0x14, 0x29, 0xD2, 0x5C, 0x00, 0xC3, 0x38,
+    0x29, 0x80, 0xAB, 0x14, 0x07, 0xC3, 0x39, 0xF2, 0xAC, 0xC2, 0x2D, 0xCF, 0x07, 0xC4, 0x45, 0x8A,
+    0x6C, 0x90, 0x04, 0x41, 0x90, 0x22, 0x7B, 0x01, 0x83, 0xF0, 0x90, 0x25, 0x37, 0xDF, 0xEC, 0x92,
+    0x7A, 0x7C, 0x3A, 0xD9, 0xF7, 0x9C, 0x1F, 0x92, 0x43, 0xCE, 0xDB, 0x9D, 0x1D, 0xEE, 0xCC, 0xCE,
+    0x7C, 0x3B, 0x7C, 0x44, 0x41, 0x41, 0xEA, 0xF0, 0xFE, 0x87, 0xF7, 0xEF, 0xAA, 0x5F, 0x14, 0x77,
+    0xE9, 0xF9, 0x27, 0xD1, 0x2C, 0x8B, 0x69, 0xF7, 0x6C, 0xF7, 0x83, 0x78, 0x7D, 0xF6, 0x1D, 0x5A,
+    0x7F, 0xFE, 0xB9, 0x73, 0x9E, 0x49, 0x3B, 0x5C, 0x53, 0xDE, 0x5A, 0xDB, 0x8E, 0x74, 0x70, 0x70,
+    0xB0, 0x7F, 0xE0, 0x8E, 0x7D, 0xEB, 0x0E, 0x33, 0x3C, 0x4A, 0xFF, 0xC0, 0x6B, 0x73, 0xFA, 0xF5,
+    0xFF, 0xFC, 0xDA, 0xA1, 0xEF, 0x6F, 0x1D, 0x1C, 0x60, 0x32, 0xB6, 0xDA, 0x39, 0x3F, 0x2F, 0xF0,
+    0x16, 0x9A, 0xFE, 0x8E, 0x54, 0xAC, 0x44, 0x9D, 0x56, 0x12, 0x67, 0x59, 0x6C, 0x51, 0xDC, 0x08,
+    0x2D, 0x74, 0xC2, 0x2D, 0x85, 0xA4, 0x2D, 0xCA, 0x8B, 0x1C, 0x3D, 0x69, 0x95, 0xD4, 0x42, 0x45,
+    0x3A, 0xD8, 0x8B, 0x1B, 0x59, 0x09, 0xCD, 0x94, 0x17, 0x89, 0x2A, 0x29, 0xA9, 0x2C, 0xA5, 0x55,
+    0x47, 0xF2, 0x5B, 0x06, 0xD2, 0x7B, 0x94, 0x9F, 0x18, 0xCA, 0x3F, 0xC6, 0xEF, 0x87, 0x3D, 0xDA,
+    0x2D, 0x25, 0x75, 0x49, 0x42, 0xE5, 0x14, 0x69, 0x99, 0x05, 0x7B, 0x73, 0x72, 0x47, 0xE9, 0x6C,
+    0xF5, 0x24, 0x41, 0xB7, 0x88, 0xBE, 0x76, 0xF4, 0x5D, 0xCA, 0xAD, 0xCD, 0x98, 0x0E, 0x8F, 0x0E,
+    0x5D, 0xDB, 0x25, 0xC9, 0x09, 0xE5, 0x57, 0xA8, 0x1C, 0x29, 0xF3, 0xBA, 0x73, 0x3C, 0x65, 0xB6,
+    0x90, 0x4F, 0x89, 0xF5, 0x16, 0x23, 0x2D, 0x74, 0x2D, 0xE4, 0x36, 0x64, 0xB0, 0x90, 0x29, 0xCB,
+    0x62, 0xE9, 0x7D, 0x2C, 0x93, 0x3B, 0xDD, 0x71, 0x4B, 0xD2, 0x42, 0x30, 0x2B, 0x6D, 0xE1, 0x2E,
+    0x38, 0x91, 0xD2, 0x9E, 0xA2, 0x86, 0x7B, 0xDF, 0x22, 0x3A, 0x82, 0x64, 0x4D, 0x39, 0x1C, 0xC0,
+    0xBA, 0xAA, 0xBC, 0xA3, 0x5C, 0xF1, 0x1C, 0x7F, 0xE8, 0x26, 0x36, 0xCF, 0x64, 0x2D, 0xB5, 0xD4,
+    0x69, 0x3D, 0xA7, 0xB9, 0xFB, 0x95, 0xE8, 0x5C, 0x49, 0x50, 0x0A, 0x7F, 0x26, 0x6A, 0x4E, 0x41,
+    0x36, 0x27, 0x59, 0xE7, 0x0A, 0xAD, 0xD5, 0x9C, 0x0E, 0xEF, 0x7D, 0x78, 0x6F, 0x95, 0x68, 0xE5,
+    0x73, 0xE7, 0x6C, 0xE7, 0x83, 0x55, 0xE2, 0xD4, 0x9D, 0x94, 0x77, 0x8B, 0x73, 0x56, 0x3C, 0xFF,
+    0xE4, 0x11, 0x6F, 0x91, 0x3F, 0x57, 0x1F, 0x41, 0x2F, 0xF8, 0x73, 0xD5, 0x11, 0xE3, 0x31, 0xB3,
+    0x99, 0x73, 0x3A, 0x91, 0xB0, 0xB5, 0x5B, 0x5A, 0xA2, 0xC4, 0x6A, 0xEA, 0x1C, 0x27, 0x2F, 0x9A,
+    0x99, 0xF1, 0xDC, 0xB7, 0xDB, 0x50, 0x7B, 0xEE, 0xB6, 0x11, 0x6A, 0xE4, 0x92, 0x6A, 0xE0, 0x5A,
+    0x59, 0x8C, 0x72, 0xF9, 0xDA, 0x1F, 0xE9, 0xC6, 0x29, 0xA5, 0x17, 0x4D, 0x27, 0x7B, 0xB2, 0x2D,
+    0xF4, 0xFD, 0x1D, 0x69, 0x77, 0xDB, 0xF6, 0x14, 0xDB, 0xC7, 0x4D, 0x9F, 0x5E, 0xB4, 0x25, 0x05,
+    0x7D, 0xFC, 0xC4, 0x88, 0x4F, 0x34, 0xBF, 0x5B, 0x3C, 0x34, 0xE2, 0x33, 0xC7, 0xC9, 0xE3, 0x91,
+    0xCB, 0x83, 0x91, 0xEB, 0x47, 0x2E, 0x30, 0xD4, 0x25, 0x17, 0x0D, 0x96, 0x38, 0x6C, 0xC8, 0x96,
+    0x1F, 0xF7, 0x16, 0x51, 0xA2, 0x39, 0x4A, 0x38, 0x9D, 0x45, 0x4D, 0x09, 0x12, 0xA1, 0xF1, 0x66,
+    0x41, 0x9A, 0x96, 0x8E, 0x85, 0x9D, 0x53, 0x4B, 0xA7, 0xB6, 0x4E, 0xAD, 0xF5, 0xF6, 0x36, 0x23,
+    0x7F, 0xDB, 0xC4, 0x6A, 0xC1, 0x0F, 0x36, 0x3B, 0x5E, 0x8E, 0xAE, 0x94, 0x27, 0xA3, 0xDD, 0x3F,
+    0xC8, 0x60, 0x79, 0x9F, 0x5A, 0x2A, 0xCD, 0xCC, 0xEA, 0xC4, 0x3E, 0x81, 0xED, 0xC7, 0xB6, 0x8F,
+    0xAC, 0x61, 0xEB, 0x6D, 0x7A, 0x61, 0x4A, 0xF1, 0xA4, 0x83, 0xFD, 0xBA, 0x13, 0x8F, 0x1B, 0x79,
+    0xA7, 0xEE, 0x31, 0xA3, 0x47, 0x46, 0xFC, 0x59, 0xCB, 0x9F, 0x30, 0x9F, 0x1E, 0x0F, 0x7C, 0xE9,
+    0xBD, 0x30, 0xF2, 0x3D, 0x19, 0x96, 0x67, 0x19, 0xE7, 0x89, 0xC7, 0xAD, 0xBC, 0xA3, 0x3A, 0x0A,
+    0x5B, 0x2A, 0xD9, 0x17, 0xD1, 0xBF, 0x0C, 0xD2, 0x9E, 0x18, 0x06, 0xBB, 0x10, 0x4E, 0x87, 0x3F,
+    0x84, 0xF3, 0x47, 0x59, 0x2F, 0x79, 0xA4, 0x27, 0xD8, 0x88, 0x41, 0xF0, 0x9C, 0xA8, 0x28, 0x75,
+    0xE9, 0xF7, 0x06, 0xB7, 0xC7, 0x7A, 0x86, 0x85, 0x0D, 0xDB, 0xB4, 0x8A, 0xE1, 0x6D, 0x51, 0x3D,
+    0x40, 0xA7, 0x21, 0x39, 0x6B, 0xE8, 0x8D, 0xD9, 0x5D, 0xD7, 0x2F, 0x0B, 0x96, 0x28, 0x89, 0x65,
+    0x3A, 0x28, 0x80, 0xFD, 0xD0, 0xF1, 0x00, 0x71, 0x01, 0xC9, 0xB8, 0x66, 0x59, 0xA8, 0x84, 0xF4,
+    0x36, 0xFC, 0x51, 0x00, 0x90, 0x80, 0x45, 0x3C, 0xA7, 0x59, 0x4B, 0x64, 0x5C, 0xC2, 0xEE, 0x90,
+    0x7C, 0xC7, 0xA0, 0xA3, 0x27, 0xD6, 0x13, 0xB1, 0xC6, 0x16, 0x43, 0xD8, 0xBD, 0x47, 0x50, 0xB3,
+    0x13, 0xBC, 0x87, 0xFE, 0xA4, 0x66, 0x09, 0xA1, 0x59, 0x06, 0x13, 0x85, 0xD4, 0xB1, 0x21, 0x96,
+    0x83, 0x73, 0x20, 0x89, 0xF9, 0x42, 0x36, 0x29, 0x58, 0x7A, 0xBD, 0xA0, 0x4D, 0xA2, 0xB7, 0x09,
+    0x4B, 0x18, 0x58, 0x0A, 0x7F, 0x57, 0x44, 0x9F, 0x54, 0xE2, 0x44, 0x25, 0x81, 0xBE, 0x45, 0xED,
+    0x6B, 0xE8, 0xD8, 0x20, 0x7A, 0xE0, 0xBA, 0x3A, 0x12, 0x00, 0x14, 0x4D, 0x65, 0xC5, 0x17, 0x18,
+    0xFC, 0x0C, 0xDD, 0x28, 0x08, 0x40, 0x6C, 0xEE, 0xB0, 0x0B, 0x5D, 0xE9, 0xA2, 0x2B, 0xC3, 0xE5,
+    0x07, 0xA6, 0x6E, 0x20, 0x04, 0xE6, 0x63, 0x3C, 0x05, 0xC0, 0xE2, 0x80, 0x44, 0x96, 0xAA, 0xB8,
+    0x48, 0xEB, 0x54, 0xA5, 0x4A, 0x34, 0x09, 0x30, 0x3D, 0xEC, 0x82, 0x19, 0xE6, 0x69, 0x33, 0xE0,
+    0x17, 0xE0, 0x25, 0x45, 0xDC, 0x88, 0x06, 0x20, 0x37, 0x0F, 0xAD, 0x0D, 0x32, 0x59, 0x58, 0x23,
+    0x74, 0x59, 0x49, 0x2D, 0x9A, 0xBC, 0x2A, 0x81, 0xFE, 0xE9, 0x6D, 0xDB, 0x45, 0x35, 0xD0, 0x0E,
+    0xF1, 0x49, 0xA9, 0x92, 0x58, 0xAC, 0xB2, 0x10, 0x0D, 0x41, 0x09, 0x5E, 0x1D, 0xB7, 0x71, 0x61,
+    0xF1, 0x8E, 0xB4, 0x06, 0x7E, 0x15, 0x52, 0x89, 0x6A, 0x8D, 0xD2, 0x3A, 0xC4, 0xFB, 0xD7, 0x39,
+    0x47, 0x6A, 0xC9, 0xE8, 0xA5, 0x1D, 0xD2, 0x81, 0x5F, 0x10, 0x14, 0x55, 0x8E, 0xEA, 0x05, 0xF1,
+    0x2E, 0xE3, 0x68, 0x0C, 0xDF, 0x01, 0x17, 0x53, 0xE5, 0x71, 0x11, 0x3A, 0x2A, 0x46, 0x4B, 0x1F,
+    0x26, 0x6B, 0xB6, 0x01, 0xB0, 0xF6, 0x0E, 0xA9, 0x65, 0x57, 0x56, 0x5F, 0x35, 0xB2, 0x9A, 0x99,
+    0x14, 0x24, 0xAB, 0xC0, 0x94, 0x45, 0x80, 0xEC, 0x0B, 0x90, 0x77, 0x81, 0x55, 0x6C, 0x2D, 0xC8,
+    0xC5, 0xD6, 0xE2, 0xC0, 0xBA, 0x70, 0x1B, 0x5C, 0xE8, 0xC8, 0xF5, 0x6F, 0x0E, 0xB9, 0x62, 0x6D,
+    0x3F, 0x92, 0x6B, 0xF8, 0x26, 0xF2, 0xB3, 0x7A, 0x8D, 0x28, 0x2A, 0x04, 0x32, 0x92, 0x22, 0x15,
+    0x7C, 0x84, 0x01, 0xAC, 0xF9, 0x46, 0x9F, 0x5D, 0x26, 0x2A, 0x2B, 0x42, 0xB6, 0x46, 0x8A, 0x3E,
+    0x22, 0xC8, 0x09, 0xC2, 0x88, 0xB0, 0xF8, 0x06, 0xDE, 0x31, 0x5A, 0xF4, 0x22, 0x71, 0xDB, 0x7D,
+    0xA2, 0x86, 0x02, 0x4D, 0x61, 0x4D, 0x11, 0x42, 0x30, 0x83, 0x46, 0x7A, 0x7D, 0x12, 0x25, 0x7F,
+    0xCD, 0xC2, 0x8B, 0x2A, 0x3E, 0xA9, 0x45, 0xA0, 0x77, 0xA9, 0xE1, 0x28, 0x99, 0x1C, 0xB1, 0x1E,
+    0x98, 0xE8, 0x59, 0x66, 0xC0, 0x80, 0xE4, 0xA7, 0xBF, 0xF7, 0x28, 0x91, 0xFA, 0x3A, 0x62, 0xC2,
+    0xCC, 0xDF, 0xEC, 0xF6, 0xBD, 0x50, 0x3A, 0x02, 0x49, 0x3E, 0x22, 0x4D, 0x3F, 0x60, 0x45, 0x68,
+    0xD2, 0xDA, 0xEF, 0x50, 0xF7, 0x45, 0xC6, 0xD2, 0xC8, 0x93, 0xAF, 0x38, 0xDC, 0x01, 0xC3, 0xA9,
+    0x8D, 0x37, 0x14, 0x9E, 0xD9, 0x48, 0x8A, 0x8D, 0x20, 0x68, 0x03, 0x7A, 0xF0, 0xBD, 0x9F, 0xEB,
+    0xE8, 0x4F, 0x4F, 0x4B, 0x42, 0xF5, 0xA2, 0x63, 0xD4, 0x2F, 0xF0, 0x8E, 0xD5, 0x82, 0x99, 0xA0,
+    0xFC, 0x07, 0xDC, 0x64, 0xF7, 0xE0, 0x30, 0xCD, 0xD0, 0x96, 0x21, 0x74, 0x30, 0x34, 0xFD, 0x5B,
+    0x85, 0xAD, 0x12, 0xEE, 0xCD, 0xEF, 0x28, 0x42, 0xC8, 0x65, 0x64, 0x63, 0x44, 0x95, 0xBA, 0x49,
+    0xF4, 0x52, 0x38, 0xC1, 0xFF, 0xC3, 0x73, 0xE8, 0x1C, 0x2E, 0x72, 0x69, 0x8A, 0x94, 0x73, 0x36,
+    0x33, 0xC8, 0x73, 0xAC, 0x30, 0x6A, 0xB2, 0x0D, 0x40, 0x49, 0x4E, 0xE4, 0x70, 0xDA, 0x55, 0xF8,
+    0xAA, 0x80, 0xBB, 0x8C, 0x83, 0x65, 0xE7, 0x3F, 0x31, 0xE9, 0x42, 0xDD, 0xC5, 0x27, 0x5D, 0x39,
+    0xEF, 0xB9, 0xD6, 0xFD, 0x2B, 0xAD, 0xFB, 0xDC, 0x7A, 0x7E, 0x4F, 0xF6, 0x39, 0xCE, 0xA0, 0xA7,
+    0xA5, 0x73, 0xC7, 0xB5, 0x6E, 0x5D, 0x69, 0xDD, 0x72, 0xAD, 0x3B, 0x67, 0x83, 0x39, 0x2E, 0x6C,
+    0x7B, 0xAE, 0x6B, 0xE0, 0x25, 0x85, 0xC7, 0xBB, 0xD6, 0x36, 0xF2, 0x7D, 0x7B, 0xF1, 0xF4, 0x4D,
+    0xB3, 0x49, 0xF2, 0xD3, 0x2C, 0x32, 0x9C, 0x96, 0x58, 0x04, 0x3C, 0xE0, 0x21, 0x3C, 0x6C, 0xE5,
+    0x12, 0x1E, 0xE6, 0xE7, 0x9A, 0x12, 0x20, 0x8D, 0x75, 0xF8, 0x10, 0xF5, 0x9C, 0x89, 0x48, 0x5E,
+    0x17, 0xBA, 0x6C, 0x71, 0xEF, 0x36, 0x99, 0x2B, 0x07, 0x42, 0x3A, 0xF0, 0xD1, 0x9D, 0x68, 0x44,
+    0x17, 0x50, 0xAF, 0x71, 0xF1, 0x0E, 0xC4, 0x70, 0xE3, 0xF4, 0xA5, 0xC8, 0x38, 0xBF, 0xC0, 0x95,
+    0x5D, 0xFE, 0x7E, 0x8C, 0xAA, 0xE6, 0x7D, 0xFB, 0xD0, 0x66, 0x98, 0x5B, 0xCD, 0x59, 0x82, 0x3B,
+    0x27, 0x48, 0xC5, 0x77, 0xCB, 0xF7, 0xD0, 0x3A, 0xDD, 0x86, 0xEF, 0x98, 0x95, 0x75, 0x93, 0xB2,
+    0x34, 0x5C, 0xBD, 0xCF, 0xAB, 0xE5, 0xF9, 0x6C, 0x0E, 0xBD, 0x98, 0x8D, 0xBB, 0x18, 0xC6, 0x06,
+    0xF9, 0xCD, 0xCB, 0x1C, 0x04, 0x78, 0xDC, 0x40, 0x82, 0xE5, 0x8A, 0x43, 0x17, 0x6F, 0x45, 0x24,
+    0xC9, 0xBA, 0xFC, 0x19, 0xE6, 0x53, 0xBF, 0x8C, 0x57, 0x78, 0x1C, 0xE2, 0x3B, 0x5A, 0x2A, 0xF8,
+    0x84, 0xBD, 0x15, 0x77, 0x7C, 0xC7, 0x96, 0x82, 0x3B, 0xB6, 0x50, 0x00, 0x81, 0xE5, 0xA0, 0xE5,
+    0x48, 0x65, 0x60, 0x58, 0x9E, 0x08, 0x90, 0x72, 0x9F, 0xED, 0x09, 0x39, 0x06, 0x95, 0x73, 0xAF,
+    0xBB, 0x03, 0x46, 0x3A, 0xD7, 0x0B, 0x68, 0x46, 0x34, 0x37, 0x76, 0x20, 0x18, 0xA9, 0x7C, 0x0A,
+    0xE4, 0x85, 0x9B, 0x2B, 0x8B, 0xF1, 0x32, 0xC5, 0x43, 0x17, 0x5E, 0xCA, 0xB6, 0x73, 0x17, 0x90,
+    0xD1, 0x2D, 0x1D, 0x1F, 0x18, 0xCB, 0x85, 0xBF, 0x7A, 0x9A, 0xDB, 0xA6, 0x95, 0xB6, 0x05, 0x99,
+    0x2F, 0x20, 0x96, 0x51, 0xA0, 0xA2, 0x7D, 0x7D, 0x83, 0x5A, 0xC0, 0xC2, 0x2A, 0xF4, 0xDE, 0x2B,
+    0x5C, 0xF2, 0xF2, 0x1E, 0x6E, 0xFB, 0xC4, 0x01, 0x97, 0xD9, 0x65, 0xCA, 0xAF, 0xA1, 0xA1, 0xEF,
+    0x16, 0x92, 0xD3, 0xC9, 0x23, 0xC3, 0xCE, 0x06, 0x20, 0xE5, 0x78, 0x6C, 0xDE, 0x46, 0x27, 0xA8,
+    0x1B, 0xA8, 0x9F, 0x50, 0x37, 0xF4, 0x19, 0x96, 0x03, 0xD5, 0x18, 0x3A, 0x54, 0x2C, 0xCA, 0x13,
+    0x36, 0x59, 0xA6, 0xF4, 0xC7, 0xBF, 0x81, 0x09, 0x96, 0xC9, 0xCC, 0xF3, 0xA7, 0x7B, 0x24, 0xE1,
+    0x8C, 0x9E, 0x77, 0xF6, 0x3C, 0x0B, 0x19, 0xA0, 0x9B, 0x97, 0x9C, 0x7F, 0xD9, 0x9F, 0xAE, 0xC0,
+    0xAD, 0xD7, 0xB3, 0xE5, 0xD5, 0xD9, 0xC2, 0xAA, 0x62, 0x4B, 0xC1, 0x67, 0x46, 0xAC, 0x43, 0x3D,
+    0xD3, 0xAB, 0x63, 0xEC, 0xFF, 0xE1, 0x58, 0x01, 0xFE, 0xFF, 0x63, 0x07, 0xFC, 0x77, 0x63, 0xF3,
+    0x2C, 0x47, 0x1A, 0xA2, 0x88, 0x45, 0xBD, 0x53, 0xA2, 0x72, 0x79, 0x91, 0x21, 0x6E, 0x0A, 0x8E,
+    0xE9, 0x04, 0x20, 0x7B, 0x0F, 0xDA, 0x8C, 0x9F, 0x97, 0x48, 0x58, 0x6F, 0x52, 0xF2, 0x10, 0xC9,
+    0xF3, 0x0E, 0x3E, 0x65, 0x90, 0x44, 0xA5, 0xDB, 0x22, 0x37, 0x00, 0xDA, 0x7F, 0xC1, 0xF3, 0xEB,
+    0xC0, 0xA8, 0x7E, 0x8F, 0x8C, 0x74, 0x9F, 0xA4, 0xCD, 0x11, 0x6D, 0xE3, 0x51, 0xFF, 0x0A, 0xD9,
+    0x51, 0x2E, 0x76, 0xD2, 0x80, 0xB7, 0x08, 0x7C, 0xE2, 0x00, 0xD6, 0x7F, 0xD9, 0x50, 0x5C, 0xD0,
+    0x8F, 0x08, 0xF3, 0x8B, 0x33, 0x00, 0x79, 0x58, 0xBD, 0xEC, 0xA0, 0x65, 0x76, 0x4A, 0xBC, 0xD9,
+    0x85, 0x27, 0x8F, 0xEA, 0xF8, 0x0F, 0x9F, 0xE9, 0x19, 0x3E, 0x36, 0x19, 0xCE, 0x77, 0xCA, 0xFE,
+    0x0C, 0xAA, 0x3B, 0x26, 0x80, 0x22, 0xAF, 0x6C, 0x11, 0xFD, 0xF3, 0xB7, 0x2A, 0xBA, 0xF8, 0x54,
+    0x05, 0x61, 0x9D, 0xF1, 0x18, 0x0F, 0x4D, 0x80, 0x2E, 0x07, 0x58, 0xE9, 0x60, 0xD9, 0xF2, 0xB1,
+    0xEE, 0x70, 0x89, 0xF3, 0x17, 0x4F, 0xE5, 0x77, 0xA7, 0x67, 0x8F, 0xF8, 0xD4, 0x8F, 0x97, 0x83,
+    0x9E, 0xB5, 0x82, 0x50, 0xC3, 0x95, 0x5C, 0x55, 0x26, 0x8F, 0x7A, 0x2E, 0x2C, 0xE5, 0x89, 0xE1,
+    0xDA, 0x32, 0x8F, 0x5C, 0x79, 0xD9, 0x09, 0x85, 0x0A, 0xF3, 0xB8, 0x4D, 0x2A, 0xE0, 0x4F, 0xA8,
+    0x7D, 0x9D, 0x79, 0xFA, 0x0A, 0x97, 0x9A, 0x03, 0x5C, 0x26, 0x2E, 0x2A, 0xD3, 0xC9, 0xFD, 0xD9,
+    0xB9, 0x2D, 0xCF, 0x72, 0x76, 0xCA, 0xF3, 0x14, 0x2D, 0xCF, 0x54, 0x18, 0x9E, 0xAB, 0x68, 0x79,
+    0xB6, 0xD1, 0x17, 0x8C, 0xE3, 0x79, 0x8F, 0xFA, 0xE5, 0xE4, 0x5D, 0x98, 0xBF, 0xAB, 0xF6, 0x50,
+    0xB4, 0xB1, 0xCE, 0xC6, 0xEB, 0x74, 0xF7, 0x96, 0x57, 0xFD, 0xB2, 0x50, 0xB8, 0xE6, 0x58, 0x2B,
+    0xAE, 0xD7, 0x19, 0xD7, 0x9F, 0x3F, 0x86, 0xE7, 0xB9, 0xA6, 0x96, 0xE6, 0xEF, 0x78, 0x6F, 0xD7,
+    0xE7, 0x67, 0xF2, 0x02, 0x6F, 0x17, 0x1F, 0xB3, 0x14, 0xB4, 0xE4, 0x51, 0xD2, 0x6D, 0x63, 0x9E,
+    0x73, 0x6D, 0xD7, 0x3B, 0x6E, 0x9B, 0x6D, 0xE4, 0xE1, 0x58, 0x63, 0x78, 0x2D, 0x47, 0x95, 0xC8,
+    0x5F, 0x06, 0xD7, 0x1E, 0x7B, 0x4B, 0x9A, 0xBD, 0x7A, 0x33, 0x76, 0xB8, 0xAD, 0xDF, 0xDF, 0x23,
+    0x2D, 0x2A, 0xAC, 0x33, 0xCA, 0x76, 0x5B, 0x09, 0xE3, 0xEE, 0xE0, 0xCB, 0x6A, 0x86, 0x22, 0x76,
+    0x77, 0x49, 0xD2, 0xDF, 0x27, 0x7F, 0xD2, 0x98, 0xF1, 0x2F, 0x9A, 0xA4, 0x5E, 0x96, 0x99, 0x9D,
+    0x8A, 0x6A, 0x9B, 0xBC, 0x9E, 0x85, 0x4E, 0x8B, 0xA0, 0x12, 0x15, 0xFF, 0x6B, 0x30, 0xD5, 0x99,
+    0x56, 0xF2, 0x8A, 0xBF, 0xB8, 0x05, 0x45, 0xAE, 0x1A, 0x5B, 0x82, 0x4B, 0x9F, 0xAE, 0x5D, 0xFE,
+    0x15, 0xC0, 0x2B, 0xBB, 0x9E, 0x31, 0x2F, 0x15, 0xAF, 0xC8, 0xB6, 0xE7, 0x6B, 0xE6, 0x51, 0x80,
+    0xD7, 0xA3, 0xC6, 0xC5, 0x67, 0xF6, 0x97, 0xF8, 0xA8, 0x7F, 0xC1, 0x9F, 0xAB, 0x8E, 0x90, 0x26,
+    0x6D, 0x85, 0x8E, 0xEA, 0xB0, 0x5A, 0x45, 0x9E, 0x47, 0x04, 0x59, 0x58, 0x45, 0x35, 0x3E, 0x2A,
+    0x5A, 0x69, 0x56, 0x1B, 0x31, 0x2B, 0x62, 0x75, 0xF3, 0xD5, 0x9B, 0xAF, 0xC6, 0x6A, 0xB5, 0xB7,
+    0xF0, 0xEE, 0xFC, 0xE5, 0x2C, 0xFF, 0x37, 0xED, 0x53, 0xAF, 0x6F, 0x14, 0x41, 0x14, 0xFE, 0x76,
+    0x96, 0xB2, 0x24, 0x1B, 0x32, 0x08, 0x14, 0x66, 0x0D, 0x82, 0x9C, 0x99, 0xBF, 0xA0, 0x37, 0x9B,
+    0x54, 0x54, 0xD4, 0x20, 0x68, 0xF8, 0x17, 0x2E, 0x98, 0xDA, 0x8A, 0x2B, 0xBB, 0x29, 0x02, 0x81,
+    0xA0, 0x0E, 0x81, 0xA9, 0x40, 0x6D, 0x45, 0x2D, 0x82, 0xB9, 0x19, 0x8F, 0xE8, 0xFE, 0x07, 0x8C,
+    0x00, 0x83, 0xE9, 0x88, 0x21, 0xB9, 0x86, 0xBB, 0x7D, 0xBC, 0xB9, 0xFE, 0x48, 0x81, 0x86, 0xA0,
+    0x50, 0xCC, 0x7C, 0xD9, 0xDD, 0x79, 0xEF, 0xCD, 0x7B, 0xDF, 0xFB, 0xB1, 0x62, 0x80, 0x24, 0xA7,
+    0xC8, 0xEB, 0x8F, 0xA1, 0xD9, 0x8C, 0x4D, 0x7E, 0x89, 0x8D, 0xA8, 0x5F, 0x05, 0x45, 0x81, 0xB5,
+    0x39, 0x81, 0xD7, 0x23, 0x33, 0x85, 0xB9, 0x5C, 0x13, 0x3C, 0x68, 0xA1, 0x1D, 0xC8, 0x65, 0xAC,
+    0xFF, 0xE4, 0xE4, 0x6B, 0x57, 0x49, 0xB7, 0x2E, 0x9D, 0xA5, 0xB9, 0xA5, 0xC5, 0xB3, 0xE3, 0xCF,
+    0x90, 0x8E, 0x31, 0xEA, 0xA0, 0xA9, 0x6E, 0xA8, 0x9E, 0x02, 0x7B, 0x80, 0x5D, 0xA2, 0xA1, 0x16,
+    0xCA, 0x9D, 0x6B, 0xBF, 0x35, 0x8E, 0x58, 0x3B, 0x4F, 0xEE, 0xB1, 0xD3, 0xE7, 0xD4, 0xCB, 0xE1,
+    0x80, 0x95, 0x1A, 0xD0, 0x8D, 0x6B, 0x28, 0x30, 0x0B, 0xE6, 0xA2, 0x19, 0x6F, 0x99, 0x88, 0x17,
+    0x54, 0xB3, 0xE1, 0xA8, 0x3B, 0xD4, 0x14, 0x19, 0xC8, 0x03, 0x4A, 0x9F, 0x5C, 0xA9, 0x36, 0xDD,
+    0x99, 0x01, 0x4B, 0x88, 0x05, 0xF2, 0x88, 0x32, 0x40, 0x0C, 0xA8, 0xA8, 0xE7, 0x8B, 0x3A, 0x0F,
+    0xEA, 0xA5, 0xE7, 0x3C, 0x4A, 0x6A, 0xD5, 0xA9, 0x67, 0x6F, 0xCF, 0x45, 0xD4, 0x9B, 0x9C, 0x9C,
+    0x67, 0x09, 0x3B, 0x14, 0x4B, 0xB6, 0x74, 0xFA, 0xD4, 0x37, 0x79, 0x68, 0xC4, 0x2A, 0xE2, 0x69,
+    0xAC, 0xBE, 0xC7, 0x6C, 0x83, 0xFD, 0x87, 0xB5, 0xA6, 0xAF, 0xA8, 0xAE, 0xCE, 0x12, 0x47, 0x71,
+    0x80, 0xBC, 0x4F, 0x78, 0xFA, 0x05, 0xCC, 0xFC, 0xE8, 0xEB, 0xC5, 0x51, 0xF4, 0xD8, 0xDE, 0x4E,
+    0x92, 0xAE, 0x4B, 0x66, 0xFC, 0x41, 0x2B, 0xAA, 0x5D, 0x97, 0x3E, 0x58, 0x95, 0x3D, 0x2E, 0x7A,
+    0xE9, 0xAA, 0x5A, 0x31, 0xCF, 0x31, 0xEF, 0x75, 0xDE, 0xE9, 0xAD, 0x50, 0x41, 0xB6, 0xA5, 0x13,
+    0xFE, 0x09, 0xD7, 0x87, 0x4F, 0x75, 0x3A, 0x95, 0xAE, 0xB8, 0xD8, 0xA5, 0x93, 0x4E, 0xF2, 0xAD,
+    0x31, 0x3E, 0x24, 0xC7, 0xEF, 0xA9, 0xB5, 0xE4, 0x6D, 0x11, 0x4C, 0xFE, 0x2B, 0x26, 0xE2, 0x50,
+    0xFC, 0x75, 0x2F, 0x31, 0x62, 0x92, 0x28, 0x08, 0x8A, 0xD1, 0xE0, 0x4E, 0x2A, 0xF8, 0x0D, 0xB8,
+    0x3D, 0xB0, 0x81, 0xD3, 0xD4, 0xDF, 0x95, 0x5C, 0x66, 0x8F, 0x8A, 0x5B, 0xD3, 0x62, 0x40, 0x31,
+    0x47, 0xE5, 0xB9, 0xB1, 0xE1, 0x1C, 0x6C, 0xA6, 0x39, 0xEE, 0xB1, 0xBF, 0x55, 0x04, 0x14, 0x5E,
+    0x58, 0x8E, 0x52, 0x8B, 0x63, 0x9F, 0xFA, 0x93, 0x87, 0xF1, 0x0E, 0xDB, 0xF4, 0x6A, 0x55, 0x8F,
+    0xFF, 0x53, 0xF3, 0xCF, 0xA7, 0xE6, 0x36, 0xD5, 0x92, 0xFA, 0xB5, 0x55, 0x2B, 0x4A, 0x6E, 0xD7,
+    0x9B, 0x94, 0x99, 0x2E, 0x52, 0xDF, 0xCA, 0x18, 0xB2, 0x21, 0x69, 0xD5, 0x7E, 0xD0, 0x59, 0xAA,
+    0x8D, 0xEE, 0xDE, 0x71, 0x45, 0x54, 0x7B, 0x4F, 0x52, 0xC8, 0xE8, 0x60, 0xA5, 0xF5, 0xEA, 0x45,
+    0xD4, 0x58, 0x5C, 0x41, 0xED, 0x47, 0x16, 0x66, 0x54, 0x9F, 0xD7, 0x43, 0x9E, 0xB8, 0x82, 0xBB,
+    0x3D, 0x20, 0x1F, 0x50, 0x72, 0xC6, 0x27, 0x8E, 0xFD, 0xEF, 0x65, 0xB1, 0x5C, 0xCD, 0xCE, 0x7D,
+    0x9E, 0x08, 0x11, 0x47, 0x47, 0xC9, 0xF9, 0x58, 0xA4, 0xD0, 0x1C, 0x8E, 0x8D, 0x27, 0x80, 0xB9,
+    0x82, 0xAD, 0x2D, 0xF5, 0x76, 0x2B, 0xCC, 0x7E, 0x1B, 0xEA, 0xA9, 0x08, 0x3F, 0x59, 0x0A, 0x6F,
+    0x64, 0x6F, 0x74, 0x6D, 0x96, 0xB0, 0xF3, 0x34, 0x17, 0x33, 0x0D, 0x53, 0x39, 0x53, 0xFA, 0x3D,
+    0x11, 0x27, 0xE6, 0xDA, 0x9A, 0xEE, 0xDA, 0x4D, 0xB6, 0x20, 0x1A, 0x60, 0xB7, 0xE6, 0x0D, 0x0C,
+    0x67, 0x0C, 0x93, 0x7B, 0x75, 0xE3, 0x63, 0x9A, 0x1E, 0xBB, 0x7F, 0xE4, 0xB1, 0x3B, 0x63, 0x6F,
+    0xCE, 0x6E, 0xF9, 0xEB, 0x72, 0x3E, 0xB2, 0xD0, 0xCC, 0xAE, 0x51, 0x04, 0x8A, 0xF4, 0x3B, 0xD4,
+    0xE3, 0x2C, 0xFD, 0x2B, 0xD5, 0x02, 0x69, 0xFC, 0x54, 0xFB, 0x50, 0xB6, 0x2C, 0x54, 0x67, 0x28,
+    0xEA, 0xB2, 0xAD, 0x96, 0x76, 0xA8, 0x5A, 0x79, 0xB9, 0x9D, 0x1C, 0xC4, 0xF2, 0x07, 0x95, 0x57,
+    0xBF, 0x8F, 0x1C, 0x49, 0x15, 0x7E, 0x3D, 0x63, 0x3C, 0xC0, 0x48, 0xD4, 0x05, 0x7B, 0xE2, 0x60,
+    0x25, 0x3A, 0xB5, 0x84, 0x8E, 0xF9, 0x07, 0x7C, 0xDB, 0x7D, 0xB6, 0x84, 0x03, 0x07, 0x36, 0x92,
+    0x17, 0x07, 0x0E, 0x56, 0xA4, 0x0B, 0xBA, 0x0D, 0x20, 0x44, 0x74, 0xDF, 0x5E, 0x70, 0x01, 0x01,
+    0x97, 0xDC, 0x25, 0x17, 0xE0, 0x80, 0xE0, 0x98, 0x0B, 0x36, 0x71, 0x82, 0x64, 0xBB, 0xDB, 0x76,
+    0x78, 0x01, 0x63, 0x83, 0x44, 0x40, 0xE0, 0x5E, 0x6C, 0x04, 0x78, 0x03, 0xF7, 0xAD, 0x7A, 0xBD,
+    0xBD, 0x3B, 0xDD, 0xFD, 0xF8, 0xBE, 0x57, 0x3D, 0x3B, 0x6B, 0x63, 0x74, 0xD0, 0xBB, 0xF5, 0xD5,
+    0x74, 0xFD, 0x78, 0x55, 0xF5, 0xEA, 0xBD, 0xEF, 0xBD, 0x16, 0xE1, 0x93, 0x1D, 0x89, 0x0C, 0xB5,
+    0x13, 0x71, 0xDA, 0x8A, 0x4C, 0x8E, 0x7E, 0x26, 0x12, 0xCD, 0xD0, 0x1E, 0xE5, 0x80, 0xE4, 0xDE,
+    0x74, 0x2A, 0xC9, 0xB6, 0x6A, 0x0F, 0xF7, 0x01, 0xD1, 0x7D, 0x8C, 0x8B, 0x5E, 0x00, 0x42, 0xC5,
+    0xBC, 0x11, 0x41, 0x32, 0xC2, 0x00, 0x45, 0x06, 0x2D, 0xA1, 0x5B, 0x07, 0x60, 0xF0, 0x29, 0xF0,
+    0xCF, 0xF7, 0x42, 0xC0, 0xDB, 0x3F, 0x60, 0x1B, 0x46, 0x47, 0xAA, 0xB9, 0xA8, 0x6A, 0x3A, 0xD4,
+    0x36, 0x8B, 0xC7, 0xDD, 0xAD, 0x3F, 0x88, 0xAB, 0xCB, 0x5B, 0x32, 0x29, 0xCB, 0x52, 0xA2, 0x5D,
+    0xC2, 0xA3, 0xDD, 0x02, 0xF0, 0x08, 0xF0, 0xA7, 0xFB, 0x33, 0x89, 0x9E, 0x3C, 0xC8, 0x65, 0x72,
+    0x08, 0x08, 0xF5, 0xC3, 0x14, 0x7B, 0xBE, 0x9C, 0xCA, 0x58, 0x7F, 0xFB, 0x29, 0x8E, 0xC0, 0x35,
+    0x32, 0xC2, 0x84, 0x92, 0xDF, 0x7E, 0x2F, 0x16, 0x39, 0xFF, 0x0E, 0x16, 0x3B, 0x77, 0xAE, 0x5F,
+    0x7A, 0x55, 0x0B, 0xAC, 0xD5, 0x60, 0x64, 0xED, 0xF4, 0x93, 0x72, 0x52, 0xCB, 0x1B, 0x51, 0x81,
+    0x33, 0xE2, 0xA0, 0x19, 0x8A, 0xBE, 0x7F, 0xF3, 0xB6, 0x5E, 0x38, 0x6C, 0xF4, 0x82, 0xD6, 0x28,
+    0x4F, 0x75, 0x5B, 0x25, 0xDB, 0x6E, 0x25, 0xC3, 0x79, 0x93, 0x47, 0xAD, 0x44, 0xFB, 0x2D, 0x16,
+    0xED, 0x6E, 0x39, 0xD5, 0x0A, 0x32, 0x2A, 0x49, 0x20, 0x4F, 0xAE, 0x52, 0x01, 0xCD, 0x4B, 0xA5,
+    0x11, 0x79, 0xA9, 0xB4, 0xEB, 0xD7, 0xD0, 0x5E, 0x9F, 0x94, 0xBE, 0x7D, 0xB5, 0xBD, 0x86, 0xFD,
+    0xB6, 0x56, 0xF8, 0xFB, 0xF4, 0x1C, 0x7B, 0x42, 0xFD, 0x08, 0x9D, 0x55, 0xA0, 0x5A, 0x0E, 0xF5,
+    0xD3, 0x62, 0xD8, 0x2E, 0xFB, 0x7F, 0xDA, 0x4D, 0xA9, 0x36, 0x2B, 0x7C, 0xBF, 0xD1, 0xAE, 0xBF,
+    0xF4, 0x3E, 0xAE, 0x31, 0xBD, 0xC4, 0xB9, 0x9E, 0x4D, 0x3F, 0x43, 0x5B, 0xB3, 0x28, 0x14, 0x7B,
+    0xD5, 0x84, 0x0F, 0x4B, 0xAB, 0x46, 0x85, 0x55, 0x63, 0xDC, 0x78, 0x37, 0xD6, 0x2B, 0x5A, 0x8A,
+    0x26, 0x18, 0xD8, 0x52, 0x92, 0x09, 0x3C, 0x48, 0xF4, 0x3A, 0xAA, 0x59, 0xD8, 0x04, 0x1A, 0x6B,
+    0xEE, 0x1A, 0x41, 0x95, 0xBA, 0xDA, 0x57, 0xD5, 0xE9, 0x2A, 0xF4, 0x55, 0xE4, 0xAB, 0xC4, 0x57,
+    0x6A, 0xD5, 0xFB, 0xBE, 0xDA, 0xF6, 0xD5, 0x07, 0xCF, 0x59, 0xD9, 0xA2, 0x78, 0x5C, 0x6E, 0xD5,
+    0x24, 0x96, 0xE5, 0xE3, 0xEA, 0xA0, 0x16, 0xD7, 0x0C, 0x00, 0x2D, 0xA1, 0x23, 0x28, 0xE1, 0x39,
+    0xE1, 0xF1, 0x76, 0x2D, 0x5B, 0xCF, 0xF7, 0x3A, 0xDE, 0xB7, 0xC6, 0x5B, 0x7B, 0xF3, 0x4E, 0xDC,
+    0x83, 0xDD, 0x5A, 0x36, 0xFE, 0xF2, 0xA2, 0xF5, 0x6D, 0x06, 0x2E, 0x6F, 0x31, 0x38, 0xBF, 0x4B,
+    0x48, 0x08, 0x11, 0x61, 0x42, 0x08, 0x09, 0x38, 0x45, 0xD6, 0xA5, 0x58, 0xCE, 0x6B, 0xC6, 0x2C,
+    0xC8, 0xAC, 0x51, 0xB8, 0x4B, 0x9A, 0x44, 0x1C, 0xCD, 0x56, 0x0C, 0x6F, 0x1B, 0xF2, 0xF0, 0xC9,
+    0x3D, 0xE0, 0xBB, 0xFA, 0x85, 0x29, 0x34, 0x21, 0x76, 0x11, 0x0C, 0x06, 0x36, 0x81, 0xF6, 0x7F,
+    0x09, 0x31, 0x7E, 0x1D, 0xB6, 0xC4, 0x01, 0xC6, 0xC7, 0x12, 0x18, 0x0A, 0xB6, 0x84, 0x27, 0xC0,
+    0x1E, 0x62, 0x5B, 0xB7, 0x32, 0x6C, 0x97, 0x3B, 0xB9, 0x60, 0x18, 0x63, 0xB5, 0x1A, 0x78, 0x49,
+    0x5B, 0xA0, 0xC3, 0xDC, 0x77, 0xD5, 0x95, 0xE7, 0xF4, 0xF3, 0x2E, 0xA4, 0x3D, 0xD7, 0xBC, 0x0B,
+    0x2D, 0x1C, 0xFA, 0xB4, 0x18, 0x6A, 0xA1, 0x57, 0x4A, 0xC9, 0x1A, 0xBD, 0x52, 0x4B, 0xD8, 0xE9,
+    0xA5, 0x86, 0xBE, 0x77, 0xB1, 0xA5, 0xC8, 0x0B, 0xFA, 0x9D, 0xA0, 0xC3, 0xA8, 0x0D, 0xCA, 0xC9,
+    0x1E, 0x73, 0x0F, 0xD1, 0x5F, 0xD5, 0xEE, 0x7F, 0x45, 0x12, 0x89, 0xD2, 0x30, 0x8D, 0xE0, 0x0C,
+    0x93, 0x34, 0x8A, 0xB3, 0x3C, 0xF2, 0x18, 0x47, 0xA9, 0xCE, 0x22, 0x99, 0xA4, 0xF3, 0x22, 0x91,
+    0x30, 0x3F, 0x24, 0xDE, 0x3B, 0x2C, 0xEF, 0x8A, 0xBB, 0xB7, 0x0F, 0x84, 0xE6, 0x8F, 0xBB, 0x94,
+    0xBA, 0xD6, 0x7C, 0x0B, 0x3F, 0xBB, 0x74, 0xF4, 0xA4, 0xA8, 0x1B, 0x19, 0x1D, 0xCE, 0xDA, 0x46,
+    0x86, 0xC0, 0x5A, 0x86, 0xF3, 0xFC, 0x6E, 0x05, 0xF7, 0xCC, 0x93, 0x12, 0x7B, 0x21, 0x06, 0xB0,
+    0x11, 0x62, 0x4C, 0xEF, 0xD3, 0x78, 0x52, 0xC0, 0x93, 0x8E, 0x65, 0x54, 0x41, 0x4E, 0x61, 0xD8,
+    0x00, 0x3F, 0xBE, 0xD1, 0x02, 0xE3, 0x40, 0x81, 0x3F, 0xBC, 0x49, 0xBC, 0x5C, 0x65, 0x1E, 0x2F,
+    0xFD, 0xCF, 0x68, 0xFF, 0x9B, 0xAE, 0x04, 0xC2, 0x1D, 0x88, 0xD9, 0x2C, 0xBB, 0xCC, 0xDD, 0x1A,
+    0x0A, 0xF1, 0xE9, 0xC2, 0xE6, 0xE8, 0x5F, 0x06, 0x70, 0xD2, 0x19, 0x48, 0x05, 0xAA, 0x31, 0xB0,
+    0xB6, 0x33, 0x80, 0x81, 0x3E, 0x69, 0x61, 0x85, 0xF3, 0x16, 0x0C, 0x83, 0x6B, 0x8A, 0x8E, 0xB6,
+    0x40, 0x0C, 0xE5, 0x18, 0x30, 0x43, 0x6F, 0x96, 0x9F, 0x00, 0x5F, 0xAD, 0x2D, 0x29, 0x47, 0x1C,
+    0xB7, 0xD1, 0xCF, 0x70, 0x7A, 0x48, 0x29, 0xE4, 0xCF, 0x33, 0x8B, 0x55, 0x83, 0xF5, 0xF5, 0xAB,
+    0x5C, 0xA7, 0x92, 0xB3, 0xD3, 0xE9, 0xEF, 0xC8, 0xC7, 0xB0, 0x0A, 0xBC, 0xC7, 0xE4, 0x46, 0xBC,
+    0x1D, 0xDF, 0x81, 0x8E, 0xD2, 0x33, 0x98, 0xB6, 0xD8, 0xE2, 0xF7, 0xBB, 0x69, 0xEC, 0x89, 0xD3,
+    0xC0, 0xE8, 0x62, 0x15, 0xFE, 0xEF, 0x27, 0x18, 0xF8, 0xA3, 0x90, 0x8D, 0x03, 0x35, 0xDB, 0x3A,
+    0x7A, 0x8F, 0x3D, 0x46, 0xF2, 0x1D, 0x1B, 0xD9, 0x1F, 0xC4, 0x62, 0x8E, 0xEB, 0x2A, 0xC8, 0x76,
+    0x34, 0x5F, 0x57, 0xC1, 0x96, 0x5C, 0x05, 0xE2, 0x70, 0x15, 0x62, 0x80, 0xAB, 0x32, 0x30, 0x6C,
+    0x05, 0x79, 0x8E, 0x6C, 0xBF, 0xA3, 0xDD, 0xEF, 0x65, 0xC1, 0x0D, 0x38, 0x4C, 0xC7, 0x0E, 0x18,
+    0x26, 0x86, 0x80, 0x42, 0x31, 0xA3, 0x58, 0xCC, 0x35, 0x29, 0x38, 0x39, 0x84, 0x52, 0x32, 0xF6,
+    0x40, 0x4E, 0x91, 0x57, 0x00, 0x93, 0xCD, 0xD3, 0x6F, 0x72, 0x57, 0x25, 0x01, 0x1E, 0xE7, 0x3A,
+    0xE9, 0x3B, 0xA2, 0xFA, 0x23, 0x1C, 0x7A, 0x5E, 0xCA, 0xE8, 0x39, 0xAE, 0x63, 0x70, 0x45, 0x17,
+    0x1D, 0xF0, 0x5F, 0x9C, 0xA0, 0xE6, 0x3D, 0x01, 0x86, 0xBF, 0xA9, 0xE5, 0x44, 0xD4, 0x92, 0x40,
+    0xC6, 0x76, 0x44, 0xE1, 0x4A, 0x66, 0xE1, 0x51, 0x4F, 0x7E, 0xE1, 0xC7, 0x59, 0xD7, 0x5F, 0xB7,
+    0x69, 0x46, 0xC0, 0x6D, 0xA9, 0xAF, 0x19, 0x07, 0x20, 0xD8, 0x07, 0x3E, 0x84, 0x32, 0x8B, 0x82,
+    0xD0, 0xA4, 0xAF, 0x1B, 0xDF, 0x0E, 0x6D, 0x27, 0xF9, 0xD6, 0x53, 0x19, 0x81, 0x3A, 0xEE, 0x63,
+    0x0D, 0x10, 0xAD, 0x7E, 0xD8, 0xF1, 0x94, 0x03, 0x75, 0x45, 0x14, 0xBB, 0x72, 0xD4, 0x85, 0xF0,
+    0x9E, 0xB0, 0x9C, 0x34, 0x13, 0xD4, 0x93, 0x63, 0xAD, 0x22, 0xFA, 0x11, 0x6C, 0x2A, 0xFA, 0xBB,
+    0xDA, 0x25, 0x24, 0x34, 0x1E, 0x72, 0x7B, 0xE6, 0x39, 0x38, 0xFB, 0x9A, 0xDF, 0x51, 0xBF, 0xB1,
+    0x45, 0x1D, 0xF8, 0x13, 0xC8, 0xA0, 0x8F, 0x07, 0xC3, 0x45, 0x7D, 0xEA, 0x98, 0x59, 0x41, 0x35,
+    0x34, 0xFD, 0xBD, 0x86, 0x07, 0x8C, 0x7E, 0x25, 0xA1, 0xC8, 0xFA, 0x5F, 0x21, 0xC1, 0x1D, 0x40,
+    0xD6, 0xB8, 0x6B, 0x78, 0xEA, 0x9A, 0xA1, 0x97, 0x0B, 0x43, 0xAB, 0x92, 0x23, 0xF0, 0x05, 0x05,
+    0xA4, 0x0C, 0xBF, 0x44, 0xDB, 0x78, 0xAE, 0xA4, 0xD9, 0xBD, 0x46, 0x26, 0xD9, 0x03, 0xEC, 0x71,
+    0x72, 0xB1, 0x93, 0x3B, 0xDF, 0x82, 0x4A, 0x60, 0xAE, 0xEA, 0x95, 0xD4, 0xC3, 0xB7, 0x09, 0x09,
+    0x37, 0x9A, 0x70, 0x57, 0xBC, 0x7A, 0xFD, 0x27, 0x77, 0xA1, 0x8C, 0xC9, 0x10, 0xE5, 0x0E, 0xC0,
+    0xFF, 0xE1, 0xC1, 0x86, 0x0F, 0x24, 0xA9, 0xA7, 0xE3, 0x12, 0x47, 0xD8, 0x38, 0xB8, 0xBE, 0x68,
+    0xEB, 0x76, 0x3A, 0xB4, 0x21, 0x6A, 0xF8, 0x19, 0x34, 0x66, 0x3B, 0x86, 0x3B, 0xC2, 0xCD, 0x38,
+    0x6E, 0xF1, 0x75, 0xD0, 0x3F, 0x91, 0x58, 0x0A, 0x11, 0xD3, 0xB3, 0x48, 0x83, 0x9A, 0x23, 0x26,
+    0x67, 0xB9, 0xD3, 0x5F, 0x05, 0x71, 0xD8, 0xAC, 0xF1, 0xF4, 0x80, 0xC8, 0x60, 0x06, 0x48, 0x66,
+    0xD1, 0xF4, 0x26, 0x40, 0x4B, 0x83, 0xC8, 0xA0, 0x58, 0x9B, 0x94, 0x18, 0x32, 0x29, 0x27, 0x15,
+    0xC0, 0xB5, 0x00, 0xB8, 0x5E, 0x56, 0x32, 0x99, 0x28, 0x19, 0x48, 0x4A, 0x24, 0x0D, 0x64, 0x67,
+    0xAE, 0x26, 0x6B, 0x9E, 0x2A, 0xA9, 0x44, 0x5A, 0x02, 0xED, 0x67, 0x4C, 0xE3, 0x31, 0xC3, 0x0D,
+    0xA9, 0xCE, 0xE8, 0x31, 0xEE, 0x23, 0xFA, 0x23, 0xB6, 0x99, 0xFC, 0xBA, 0xB2, 0x40, 0x54, 0x1B,
+    0x0C, 0x3A, 0x64, 0x45, 0xC3, 0x36, 0xE8, 0x4E, 0xB5, 0x6D, 0x1C, 0xAD, 0x67, 0x7F, 0xC6, 0x89,
+    0xA2, 0x1C, 0x3E, 0x83, 0xED, 0x14, 0xD8, 0x31, 0x4C, 0xCC, 0x95, 0xE6, 0x4C, 0x90, 0x3B, 0xF6,
+    0xF7, 0x1D, 0x64, 0xE6, 0xB6, 0x9E, 0x92, 0x2A, 0x19, 0x1D, 0x67, 0xE0, 0xF4, 0xD8, 0x3A, 0xCD,
+    0x22, 0x60, 0x91, 0x9B, 0xD3, 0x9D, 0x3E, 0x14, 0x6E, 0x66, 0xFA, 0x8C, 0x5C, 0x1F, 0xCB, 0x75,
+    0x05, 0x25, 0x2C, 0x43, 0x21, 0x93, 0x01, 0x59, 0xC0, 0xD7, 0xE1, 0x66, 0x3F, 0x6E, 0x28, 0xAF,
+    0x61, 0xDE, 0xD4, 0x88, 0x4F, 0x65, 0xFA, 0xCC, 0x60, 0x71, 0xD4, 0x11, 0x03, 0x12, 0xFC, 0x07,
+    0x1C, 0xCC, 0xAC, 0x82, 0x69, 0x9E, 0xEB, 0xD6, 0xBE, 0x21, 0x61, 0x7D, 0xA2, 0xDD, 0x62, 0xA9,
+    0xDD, 0x97, 0xC0, 0xDA, 0x7C, 0x2F, 0xC7, 0x41, 0xBB, 0x38, 0x42, 0xBB, 0x16, 0x60, 0xC9, 0x2C,
+    0x3B, 0x9D, 0xAA, 0x85, 0x7A, 0x24, 0xAF, 0x6A, 0x77, 0x85, 0xFB, 0x68, 0x10, 0xFF, 0x03, 0xC6,
+    0xFF, 0x41, 0x03, 0x7B, 0x1F, 0x33, 0x77, 0x89, 0x08, 0x64, 0x8E, 0x66, 0xB5, 0xDD, 0x68, 0xAF,
+    0x8D, 0x1A, 0xF8, 0xDE, 0x57, 0x02, 0x62, 0x51, 0x33, 0xEA, 0x56, 0x46, 0xC8, 0xFA, 0xDA, 0x51,
+    0x33, 0x20, 0x20, 0x3A, 0x5A, 0xD8, 0x5D, 0x52, 0xC5, 0x53, 0x4F, 0x14, 0x16, 0x78, 0x3B, 0x5E,
+    0xEF, 0x5E, 0x63, 0xF4, 0xF9, 0xD6, 0xC2, 0xE9, 0x8C, 0x4F, 0x7B, 0xC6, 0x18, 0x58, 0x9C, 0x36,
+    0x1D, 0x33, 0xD5, 0x2C, 0xA4, 0xF7, 0xC0, 0xDE, 0x1F, 0xF0, 0x22, 0xDF, 0x1D, 0x6F, 0x17, 0x6A,
+    0x94, 0x93, 0xC9, 0xCF, 0xCB, 0xFA, 0x7C, 0x06, 0x5D, 0x54, 0xEF, 0x74, 0x12, 0x56, 0x55, 0x64,
+    0x1A, 0x87, 0x88, 0xC1, 0x9C, 0xBE, 0x32, 0x28, 0x8E, 0x7E, 0x09, 0x91, 0x45, 0x75, 0x1E, 0x33,
+    0xE3, 0x37, 0x56, 0x44, 0x5E, 0xCB, 0x94, 0x27, 0xCF, 0x2B, 0x1D, 0x9B, 0x3B, 0xC8, 0x03, 0x4F,
+    0x91, 0xDF, 0xFF, 0x03, 0xD8, 0x5E, 0xC9, 0xF2, 0x66, 0x76, 0x70, 0x95, 0x81, 0x80, 0x54, 0xB6,
+    0x68, 0x33, 0xDB, 0x83, 0x63, 0xBE, 0x09, 0x86, 0x8A, 0x18, 0x68, 0xF8, 0x65, 0x50, 0xFA, 0x79,
+    0xE3, 0xC6, 0x3B, 0x80, 0x45, 0x16, 0x5A, 0x7E, 0x52, 0xF0, 0x86, 0xD1, 0xD9, 0x98, 0xB6, 0x7C,
+    0x39, 0x0B, 0xFD, 0x65, 0xF6, 0x5D, 0xB1, 0x0A, 0xCB, 0xD5, 0x36, 0x40, 0xD9, 0x92, 0x8B, 0x66,
+    0x48, 0xF0, 0x0C, 0x68, 0x0A, 0x3A, 0xD3, 0x7F, 0xA0, 0x0C, 0x9B, 0xA0, 0x1B, 0x36, 0x83, 0x76,
+    0xD8, 0xF0, 0xCF, 0xD5, 0x98, 0x47, 0xFF, 0x9B, 0xA1, 0xC4, 0x43, 0xEA, 0x7A, 0xE5, 0xE4, 0xA2,
+    0x8C, 0xF8, 0xD6, 0x12, 0xE2, 0x2F, 0x1C, 0xD5, 0x7F, 0xCB, 0x91, 0xBB, 0xEF, 0x58, 0x06, 0x49,
+    0x85, 0x28, 0x79, 0xD6, 0x92, 0x21, 0xEA, 0x38, 0xD8, 0x79, 0x36, 0xFD, 0xBC, 0xB1, 0xFC, 0xF2,
+    0x36, 0x12, 0x96, 0x3C, 0x3D, 0x2F, 0xEE, 0x8B, 0xC3, 0xE2, 0x3C, 0xBD, 0xA9, 0x45, 0x4B, 0x9D,
+    0x20, 0x19, 0x71, 0xC5, 0x5B, 0xDF, 0x4C, 0x61, 0xA6, 0x14, 0x3A, 0xB7, 0x6B, 0xFC, 0x89, 0x3E,
+    0xBB, 0x4D, 0x6A, 0xB5, 0x4B, 0x9D, 0x18, 0x9E, 0xD5, 0x25, 0xE7, 0x3A, 0x8B, 0x27, 0x9E, 0x8A,
+    0xFE, 0x13, 0xCD, 0xC5, 0x56, 0x2D, 0xE8, 0x28, 0x8D, 0x69, 0x68, 0xB9, 0x91, 0xD3, 0x9D, 0x17,
+    0x5A, 0x84, 0x95, 0x2B, 0xE1, 0xE3, 0x33, 0x57, 0x22, 0x58, 0xE6, 0xAE, 0x1C, 0xD7, 0x09, 0x70,
+    0xD4, 0x24, 0x29, 0x99, 0x31, 0xEB, 0x91, 0xDA, 0xFB, 0x6F, 0x38, 0x22, 0x19, 0xF1, 0x1B, 0x82,
+    0x60, 0x3E, 0xA9, 0xF1, 0x08, 0x89, 0x79, 0x4E, 0xAB, 0xCE, 0x2D, 0x36, 0xF5, 0xBF, 0x06, 0x9E,
+    0x73, 0xE9, 0x65, 0x46, 0x0D, 0x64, 0xA3, 0xE3, 0xD8, 0x27, 0x0B, 0x06, 0xFC, 0xEA, 0xF0, 0x5F,
+    0x6D, 0xF6, 0x6B, 0xD9, 0xD1, 0x7F, 0x7E, 0xFC, 0x88, 0x64, 0x10, 0xEC, 0xF3, 0xB0, 0x83, 0x79,
+    0x21, 0xFD, 0x57, 0x15, 0x0F, 0x35, 0xC3, 0xA1, 0xE6, 0x10, 0xE8, 0xBA, 0x7D, 0x28, 0x27, 0x3C,
+    0xD8, 0x47, 0x56, 0x14, 0x7D, 0xB9, 0xFF, 0x37, 0x58, 0xFC, 0xC3, 0xFD, 0x5D, 0x58, 0xE6, 0xC3,
+    0xFD, 0x82, 0x69, 0xB2, 0xC7, 0xDD, 0x19, 0x13, 0x67, 0x63, 0x6C, 0xC3, 0x49, 0x71, 0xA2, 0xA6,
+    0x9E, 0xE1, 0x06, 0xE6, 0x49, 0x81, 0x1E, 0x4F, 0x3F, 0xE3, 0xCD, 0x58, 0x9E, 0xB4, 0xC4, 0xE0,
+    0xE1, 0x4C, 0x82, 0x5D, 0x5F, 0xC8, 0x52, 0x0C, 0x9E, 0x24, 0x25, 0x94, 0x3C, 0xC9, 0x59, 0x16,
+    0x7F, 0x59, 0x9E, 0xEC, 0xE1, 0xB3, 0xC3, 0x02, 0x2C, 0x0B, 0xFB, 0xB2, 0x59, 0x92, 0x47, 0xC5,
+    0xB2, 0x24, 0x05, 0xC6, 0xCC, 0xD0, 0xD7, 0x8F, 0xAB, 0x4E, 0x64, 0x73, 0x1D, 0x1F, 0x52, 0x69,
+    0x76, 0xBC, 0x32, 0xEC, 0xBB, 0xBD, 0xC1, 0xD0, 0x66, 0x5F, 0x87, 0xF6, 0x85, 0x98, 0xFA, 0xB2,
+    0x78, 0xA7, 0xE5, 0x47, 0x47, 0x37, 0x52, 0x7C, 0x07, 0xA7, 0x23, 0xBA, 0x33, 0xED, 0x3A, 0xF0,
+    0xDF, 0x31, 0x9B, 0xD3, 0x29, 0x6F, 0x20, 0x67, 0xE1, 0xFB, 0xBF, 0x01, 0xDB, 0xFF, 0xFF, 0xFF,
+    0x97, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0xD1, 0xD0, 0xD0, 0x00, 0x00, 0x85, 0x8F, 0xB1, 0x11,
+    0xC2, 0x30, 0x10, 0x04, 0x4F, 0xF6, 0x30, 0x04, 0x0A, 0x08, 0x09, 0x08, 0x5C, 0x82, 0x4B, 0x90,
+    0x12, 0x72, 0x02, 0x97, 0x41, 0x0F, 0x52, 0x13, 0x74, 0x42, 0xFE, 0x6A, 0x81, 0x0E, 0x08, 0x28,
+    0xC1, 0x81, 0x03, 0x5B, 0xC7, 0xBF, 0x86, 0x81, 0x10, 0x05, 0xBB, 0x81, 0x7E, 0xEE, 0xEF, 0xE1,
+    0x22, 0xE0, 0xC8, 0x8C, 0x03, 0xB9, 0x20, 0x90, 0x2B, 0xD2, 0x7C, 0x5A, 0x21, 0xA5, 0x57, 0xE4,
+    0x06, 0xCF, 0x2A, 0x39, 0x7C, 0x71, 0xDC, 0xA6, 0xCF, 0xC7, 0x1F, 0x6C, 0x06, 0x9E, 0x25, 0x77,
+    0xA4, 0x64, 0x67, 0x40, 0xAA, 0xD0, 0x85, 0xBA, 0x14, 0x13, 0xEC, 0x0D, 0x7C, 0x99, 0x48, 0x2A,
+    0x75, 0x4E, 0x9B, 0xA0, 0xAF, 0xAE, 0x69, 0xC1, 0x4F, 0x7B, 0x6E, 0x1A, 0x50, 0x46, 0xD2, 0xAB,
+    0x12, 0xAB, 0xF6, 0x2D, 0x52, 0xAE, 0x3B, 0xDE, 0xA2, 0x14, 0xD8, 0x88, 0xCC, 0x4D, 0x81, 0xD1,
+    0x34, 0x70, 0x36, 0x75, 0xAC, 0x2D, 0x65, 0x64, 0x53, 0xC7, 0x68, 0x02, 0xA3, 0x76, 0xB9, 0x3B,
+    0xD5, 0x23, 0x8A, 0xEE, 0x4E, 0x1A, 0xA6, 0xA7, 0x07, 0x8B, 0x7E, 0xC2, 0xB3, 0xB4, 0x7A, 0x17,
+    0xBC, 0x01, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21, 0x10, 0x85, 0xE1, 0x77, 0x43, 0x40, 0x70, 0x01,
+    0x76, 0x70, 0x25, 0x98, 0x98, 0x43, 0x27, 0xB6, 0x61, 0xE2, 0x78, 0x55, 0x58, 0x8B, 0x99, 0x96,
+    0x40, 0x09, 0xD8, 0x03, 0x01, 0x01, 0xEC, 0x73, 0xF7, 0x18, 0x99, 0x81, 0x3F, 0xF8, 0x66, 0x87,
+    0x05, 0xFE, 0xE7, 0x32, 0x33, 0x8E, 0xD7, 0x31, 0x59, 0x02, 0xB3, 0x25, 0xB2, 0x5A, 0xE4, 0x69,
+    0xE8, 0x32, 0xA2, 0x62, 0xF8, 0x20, 0x28, 0xC6, 0xEF, 0x6B, 0x55, 0x24, 0xBB, 0x1F, 0x3A, 0xC5,
+    0xBE, 0x32, 0x05, 0xB2, 0xEA, 0x64, 0x24, 0xF3, 0x99, 0xF5, 0x41, 0xA6, 0x37, 0xDB, 0x46, 0x51,
+    0x2E, 0x9E, 0xE2, 0xC9, 0x7D, 0xA1, 0xAC, 0x14, 0x40, 0x91, 0x0D, 0xD8, 0x34, 0x05, 0xF0, 0xC3,
+    0x73, 0x07, 0x96, 0xEE, 0xC4, 0xFE, 0xBB, 0xBB, 0x66, 0xD9, 0xAE, 0xC5, 0x72, 0x90, 0xA2, 0xCC,
+    0x3D, 0x6F, 0x33, 0x27, 0xBD, 0x3F,
 };
 
 static const EpdGlyph notosans_14_boldGlyphs[] = {
@@ -2043,99 +2049,99 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 6, 22, 132, 1, 21, 33, 0 }, // !
-    { 12, 8, 224, 1, 21, 24, 33 }, // "
-    { 19, 21, 302, 0, 21, 100, 57 }, // #
-    { 15, 25, 267, 1, 23, 94, 157 }, // $
-    { 26, 23, 421, 0, 22, 150, 251 }, // %
-    { 21, 23, 350, 1, 22, 121, 401 }, // &
-    { 5, 8, 124, 1, 21, 10, 522 }, // '
-    { 9, 26, 158, 1, 21, 59, 532 }, // (
-    { 9, 26, 158, 0, 21, 59, 591 }, // )
-    { 15, 15, 253, 0, 23, 57, 650 }, // *
-    { 15, 15, 267, 1, 18, 57, 707 }, // +
-    { 7, 8, 133, 0, 4, 14, 764 }, // ,
-    { 9, 4, 149, 0, 10, 9, 778 }, // -
-    { 6, 6, 131, 1, 5, 9, 787 }, // .
-    { 12, 22, 194, 0, 21, 66, 796 }, // /
-    { 16, 23, 282, 1, 22, 92, 862 }, // 0
-    { 11, 21, 241, 0, 21, 58, 954 }, // 1
-    { 16, 22, 261, 0, 22, 88, 1012 }, // 2
-    { 15, 23, 267, 1, 22, 87, 1100 }, // 3
-    { 17, 21, 271, 0, 21, 90, 1187 }, // 4
-    { 15, 22, 270, 1, 21, 83, 1277 }, // 5
-    { 16, 23, 281, 1, 22, 92, 1360 }, // 6
-    { 16, 21, 249, 0, 21, 84, 1452 }, // 7
-    { 16, 23, 278, 1, 22, 92, 1536 }, // 8
-    { 16, 23, 281, 1, 22, 92, 1628 }, // 9
-    { 6, 18, 131, 1, 17, 27, 1720 }, // :
-    { 7, 21, 133, 0, 17, 37, 1747 }, // ;
-    { 15, 17, 267, 1, 19, 64, 1784 }, // <
-    { 15, 10, 267, 1, 15, 38, 1848 }, // =
-    { 15, 17, 267, 1, 19, 64, 1886 }, // >
-    { 14, 23, 223, 0, 22, 81, 1950 }, // ?
-    { 24, 24, 419, 1, 21, 144, 2031 }, // @
-    { 21, 21, 323, 0, 21, 111, 2175 }, // A
-    { 16, 21, 310, 2, 21, 84, 2286 }, // B
-    { 17, 23, 300, 1, 22, 98, 2370 }, // C
-    { 18, 21, 342, 2, 21, 95, 2468 }, // D
-    { 13, 21, 261, 2, 21, 69, 2563 }, // E
-    { 13, 21, 256, 2, 21, 69, 2632 }, // F
-    { 18, 23, 338, 1, 22, 104, 2701 }, // G
-    { 18, 21, 357, 2, 21, 95, 2805 }, // H
-    { 11, 21, 182, 0, 21, 58, 2900 }, // I
-    { 11, 28, 154, -3, 21, 77, 2958 }, // J
-    { 18, 21, 310, 2, 21, 95, 3035 }, // K
-    { 14, 21, 261, 2, 21, 74, 3130 }, // L
-    { 23, 21, 440, 2, 21, 121, 3204 }, // M
-    { 20, 21, 379, 2, 21, 105, 3325 }, // N
-    { 21, 23, 369, 1, 22, 121, 3430 }, // O
-    { 15, 21, 290, 2, 21, 79, 3551 }, // P
-    { 21, 27, 369, 1, 22, 142, 3630 }, // Q
-    { 18, 21, 306, 2, 21, 95, 3772 }, // R
-    { 14, 23, 257, 1, 22, 81, 3867 }, // S
-    { 17, 21, 269, 0, 21, 90, 3948 }, // T
-    { 18, 22, 353, 2, 21, 99, 4038 }, // U
-    { 19, 21, 303, 0, 21, 100, 4137 }, // V
-    { 29, 21, 451, 0, 21, 153, 4237 }, // W
-    { 20, 21, 313, 0, 21, 105, 4390 }, // X
-    { 19, 21, 292, 0, 21, 100, 4495 }, // Y
-    { 17, 21, 270, 0, 21, 90, 4595 }, // Z
-    { 7, 26, 154, 2, 21, 46, 4685 }, // [
-    { 12, 22, 194, 0, 21, 66, 4731 }, // <backslash>
-    { 8, 26, 154, 0, 21, 52, 4797 }, // ]
-    { 17, 14, 267, 0, 21, 60, 4849 }, // ^
-    { 14, 3, 192, -1, -2, 11, 4909 }, // _
-    { 9, 6, 170, 1, 23, 14, 4920 }, // `
-    { 15, 18, 280, 1, 17, 68, 4934 }, // a
-    { 16, 24, 295, 2, 23, 96, 5002 }, // b
-    { 14, 18, 241, 1, 17, 63, 5098 }, // c
-    { 16, 24, 295, 1, 23, 96, 5161 }, // d
-    { 16, 18, 279, 1, 17, 72, 5257 }, // e
-    { 13, 23, 181, 0, 23, 75, 5329 }, // f
-    { 16, 24, 295, 1, 17, 96, 5404 }, // g
-    { 15, 23, 303, 2, 23, 87, 5500 }, // h
-    { 6, 23, 140, 1, 23, 35, 5587 }, // i
-    { 9, 30, 139, -2, 23, 68, 5622 }, // j
-    { 17, 23, 289, 2, 23, 98, 5690 }, // k
-    { 5, 23, 139, 2, 23, 29, 5788 }, // l
-    { 25, 17, 455, 2, 17, 107, 5817 }, // m
-    { 15, 17, 303, 2, 17, 64, 5924 }, // n
-    { 16, 18, 292, 1, 17, 72, 5988 }, // o
-    { 16, 24, 295, 2, 17, 96, 6060 }, // p
-    { 16, 24, 295, 1, 17, 96, 6156 }, // q
-    { 11, 17, 209, 2, 17, 47, 6252 }, // r
-    { 13, 18, 234, 1, 17, 59, 6299 }, // s
-    { 12, 21, 203, 0, 20, 63, 6358 }, // t
-    { 15, 17, 303, 2, 16, 64, 6421 }, // u
-    { 17, 16, 267, 0, 16, 68, 6485 }, // v
-    { 25, 16, 400, 0, 16, 100, 6553 }, // w
-    { 17, 16, 270, 0, 16, 68, 6653 }, // x
-    { 17, 23, 267, 0, 16, 98, 6721 }, // y
-    { 14, 16, 230, 0, 16, 56, 6819 }, // z
-    { 11, 26, 184, 0, 21, 72, 6875 }, // {
-    { 4, 30, 257, 6, 23, 30, 6947 }, // |
-    { 11, 26, 184, 1, 21, 72, 6977 }, // }
-    { 15, 6, 267, 1, 13, 23, 7049 }, // ~
+    { 12, 8, 224, 1, 21, 24, 0 }, // "
+    { 19, 21, 302, 0, 21, 100, 24 }, // #
+    { 15, 25, 267, 1, 23, 94, 124 }, // $
+    { 26, 23, 421, 0, 22, 150, 218 }, // %
+    { 21, 23, 350, 1, 22, 121, 368 }, // &
+    { 5, 8, 124, 1, 21, 10, 489 }, // '
+    { 9, 26, 158, 1, 21, 59, 33 }, // (
+    { 9, 26, 158, 0, 21, 59, 92 }, // )
+    { 15, 15, 253, 0, 23, 57, 499 }, // *
+    { 15, 15, 267, 1, 18, 57, 556 }, // +
+    { 7, 8, 133, 0, 4, 14, 151 }, // ,
+    { 9, 4, 149, 0, 10, 9, 165 }, // -
+    { 6, 6, 131, 1, 5, 9, 174 }, // .
+    { 12, 22, 194, 0, 21, 66, 613 }, // /
+    { 16, 23, 282, 1, 22, 92, 183 }, // 0
+    { 11, 21, 241, 0, 21, 58, 275 }, // 1
+    { 16, 22, 261, 0, 22, 88, 333 }, // 2
+    { 15, 23, 267, 1, 22, 87, 421 }, // 3
+    { 17, 21, 271, 0, 21, 90, 508 }, // 4
+    { 15, 22, 270, 1, 21, 83, 598 }, // 5
+    { 16, 23, 281, 1, 22, 92, 681 }, // 6
+    { 16, 21, 249, 0, 21, 84, 773 }, // 7
+    { 16, 23, 278, 1, 22, 92, 857 }, // 8
+    { 16, 23, 281, 1, 22, 92, 949 }, // 9
+    { 6, 18, 131, 1, 17, 27, 1041 }, // :
+    { 7, 21, 133, 0, 17, 37, 1068 }, // ;
+    { 15, 17, 267, 1, 19, 64, 679 }, // <
+    { 15, 10, 267, 1, 15, 38, 743 }, // =
+    { 15, 17, 267, 1, 19, 64, 781 }, // >
+    { 14, 23, 223, 0, 22, 81, 1105 }, // ?
+    { 24, 24, 419, 1, 21, 144, 845 }, // @
+    { 21, 21, 323, 0, 21, 111, 1186 }, // A
+    { 16, 21, 310, 2, 21, 84, 1297 }, // B
+    { 17, 23, 300, 1, 22, 98, 1381 }, // C
+    { 18, 21, 342, 2, 21, 95, 1479 }, // D
+    { 13, 21, 261, 2, 21, 69, 1574 }, // E
+    { 13, 21, 256, 2, 21, 69, 1643 }, // F
+    { 18, 23, 338, 1, 22, 104, 1712 }, // G
+    { 18, 21, 357, 2, 21, 95, 1816 }, // H
+    { 11, 21, 182, 0, 21, 58, 1911 }, // I
+    { 11, 28, 154, -3, 21, 77, 1969 }, // J
+    { 18, 21, 310, 2, 21, 95, 2046 }, // K
+    { 14, 21, 261, 2, 21, 74, 2141 }, // L
+    { 23, 21, 440, 2, 21, 121, 2215 }, // M
+    { 20, 21, 379, 2, 21, 105, 2336 }, // N
+    { 21, 23, 369, 1, 22, 121, 2441 }, // O
+    { 15, 21, 290, 2, 21, 79, 2562 }, // P
+    { 21, 27, 369, 1, 22, 142, 2641 }, // Q
+    { 18, 21, 306, 2, 21, 95, 2783 }, // R
+    { 14, 23, 257, 1, 22, 81, 2878 }, // S
+    { 17, 21, 269, 0, 21, 90, 2959 }, // T
+    { 18, 22, 353, 2, 21, 99, 989 }, // U
+    { 19, 21, 303, 0, 21, 100, 3049 }, // V
+    { 29, 21, 451, 0, 21, 153, 3149 }, // W
+    { 20, 21, 313, 0, 21, 105, 3302 }, // X
+    { 19, 21, 292, 0, 21, 100, 3407 }, // Y
+    { 17, 21, 270, 0, 21, 90, 3507 }, // Z
+    { 7, 26, 154, 2, 21, 46, 1088 }, // [
+    { 12, 22, 194, 0, 21, 66, 1134 }, // <backslash>
+    { 8, 26, 154, 0, 21, 52, 1200 }, // ]
+    { 17, 14, 267, 0, 21, 60, 1252 }, // ^
+    { 14, 3, 192, -1, -2, 11, 1312 }, // _
+    { 9, 6, 170, 1, 23, 14, 1323 }, // `
+    { 15, 18, 280, 1, 17, 68, 3597 }, // a
+    { 16, 24, 295, 2, 23, 96, 3665 }, // b
+    { 14, 18, 241, 1, 17, 63, 3761 }, // c
+    { 16, 24, 295, 1, 23, 96, 3824 }, // d
+    { 16, 18, 279, 1, 17, 72, 3920 }, // e
+    { 13, 23, 181, 0, 23, 75, 3992 }, // f
+    { 16, 24, 295, 1, 17, 96, 4067 }, // g
+    { 15, 23, 303, 2, 23, 87, 4163 }, // h
+    { 6, 23, 140, 1, 23, 35, 4250 }, // i
+    { 9, 30, 139, -2, 23, 68, 4285 }, // j
+    { 17, 23, 289, 2, 23, 98, 4353 }, // k
+    { 5, 23, 139, 2, 23, 29, 4451 }, // l
+    { 25, 17, 455, 2, 17, 107, 4480 }, // m
+    { 15, 17, 303, 2, 17, 64, 4587 }, // n
+    { 16, 18, 292, 1, 17, 72, 4651 }, // o
+    { 16, 24, 295, 2, 17, 96, 4723 }, // p
+    { 16, 24, 295, 1, 17, 96, 4819 }, // q
+    { 11, 17, 209, 2, 17, 47, 4915 }, // r
+    { 13, 18, 234, 1, 17, 59, 4962 }, // s
+    { 12, 21, 203, 0, 20, 63, 5021 }, // t
+    { 15, 17, 303, 2, 16, 64, 5084 }, // u
+    { 17, 16, 267, 0, 16, 68, 5148 }, // v
+    { 25, 16, 400, 0, 16, 100, 5216 }, // w
+    { 17, 16, 270, 0, 16, 68, 5316 }, // x
+    { 17, 23, 267, 0, 16, 98, 5384 }, // y
+    { 14, 16, 230, 0, 16, 56, 5482 }, // z
+    { 11, 26, 184, 0, 21, 72, 1337 }, // {
+    { 4, 30, 257, 6, 23, 30, 1409 }, // |
+    { 11, 26, 184, 1, 21, 72, 1439 }, // }
+    { 15, 6, 267, 1, 13, 23, 1511 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 6, 22, 133, 1, 16, 33, 0 }, // U+00A1
     { 13, 23, 267, 2, 22, 75, 33 }, // U+00A2
@@ -2219,19 +2225,19 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 16, 24, 293, 1, 23, 96, 7044 }, // U+00F0
     { 15, 23, 303, 2, 23, 87, 7140 }, // U+00F1
     { 16, 24, 292, 1, 23, 96, 7227 }, // U+00F2
-    { 16, 24, 292, 1, 23, 96, 7323 }, // U+00F3
-    { 16, 24, 292, 1, 23, 96, 7419 }, // U+00F4
-    { 16, 24, 292, 1, 23, 96, 7515 }, // U+00F5
-    { 16, 23, 292, 1, 22, 92, 7611 }, // U+00F6
-    { 15, 15, 267, 1, 18, 57, 7703 }, // U+00F7
-    { 16, 19, 289, 1, 17, 76, 7760 }, // U+00F8
-    { 15, 24, 303, 2, 23, 90, 7836 }, // U+00F9
-    { 15, 24, 303, 2, 23, 90, 7926 }, // U+00FA
-    { 15, 24, 303, 2, 23, 90, 8016 }, // U+00FB
-    { 15, 23, 303, 2, 22, 87, 8106 }, // U+00FC
-    { 17, 30, 267, 0, 23, 128, 8193 }, // U+00FD
-    { 16, 30, 295, 2, 23, 120, 8321 }, // U+00FE
-    { 17, 29, 267, 0, 22, 124, 8441 }, // U+00FF
+    { 16, 24, 292, 1, 23, 96, 5538 }, // U+00F3
+    { 16, 24, 292, 1, 23, 96, 7323 }, // U+00F4
+    { 16, 24, 292, 1, 23, 96, 7419 }, // U+00F5
+    { 16, 23, 292, 1, 22, 92, 7515 }, // U+00F6
+    { 15, 15, 267, 1, 18, 57, 7607 }, // U+00F7
+    { 16, 19, 289, 1, 17, 76, 7664 }, // U+00F8
+    { 15, 24, 303, 2, 23, 90, 7740 }, // U+00F9
+    { 15, 24, 303, 2, 23, 90, 7830 }, // U+00FA
+    { 15, 24, 303, 2, 23, 90, 7920 }, // U+00FB
+    { 15, 23, 303, 2, 22, 87, 8010 }, // U+00FC
+    { 17, 30, 267, 0, 23, 128, 8097 }, // U+00FD
+    { 16, 30, 295, 2, 23, 120, 8225 }, // U+00FE
+    { 17, 29, 267, 0, 22, 124, 8345 }, // U+00FF
     { 21, 26, 323, 0, 26, 137, 0 }, // U+0100
     { 15, 22, 280, 1, 21, 83, 137 }, // U+0101
     { 21, 28, 323, 0, 28, 147, 220 }, // U+0102
@@ -2933,98 +2939,98 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 9, 4, 149, 0, 10, 9, 100 }, // U+2010
     { 9, 4, 149, 0, 10, 9, 109 }, // U+2011
     { 15, 4, 269, 1, 12, 15, 118 }, // U+2012
-    { 13, 4, 233, 1, 10, 13, 133 }, // U+2013
-    { 28, 4, 467, 1, 10, 28, 146 }, // U+2014
-    { 28, 4, 467, 1, 10, 28, 174 }, // U+2015
-    { 12, 30, 257, 2, 23, 90, 202 }, // U+2016
-    { 14, 7, 192, -1, 0, 25, 292 }, // U+2017
-    { 6, 8, 101, 0, 21, 12, 317 }, // U+2018
-    { 6, 8, 101, 0, 21, 12, 329 }, // U+2019
-    { 7, 8, 133, 0, 4, 14, 341 }, // U+201A
-    { 6, 8, 101, 0, 21, 12, 355 }, // U+201B
-    { 13, 8, 208, 0, 21, 26, 367 }, // U+201C
-    { 13, 8, 208, 0, 21, 26, 393 }, // U+201D
-    { 14, 8, 239, 0, 4, 28, 419 }, // U+201E
-    { 13, 8, 208, 0, 21, 26, 447 }, // U+201F
-    { 13, 23, 239, 1, 23, 75, 473 }, // U+2020
-    { 13, 23, 242, 1, 23, 75, 548 }, // U+2021
-    { 9, 10, 175, 1, 16, 23, 623 }, // U+2022
-    { 10, 12, 175, 1, 17, 30, 646 }, // U+2023
-    { 6, 6, 233, 4, 5, 9, 676 }, // U+2024
-    { 15, 6, 268, 1, 5, 23, 685 }, // U+2025
-    { 23, 6, 399, 1, 5, 35, 708 }, // U+2026
-    { 6, 6, 131, 1, 11, 9, 743 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 752 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 752 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 752 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 796 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 840 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 890 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 940 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 990 }, // U+202F
-    { 37, 23, 597, 0, 22, 213, 990 }, // U+2030
-    { 48, 23, 778, 0, 22, 276, 1203 }, // U+2031
-    { 9, 8, 141, 1, 21, 18, 1479 }, // U+2032
-    { 15, 8, 245, 1, 21, 30, 1497 }, // U+2033
-    { 21, 8, 348, 1, 21, 42, 1527 }, // U+2034
-    { 9, 8, 197, 1, 21, 18, 1569 }, // U+2035
-    { 15, 8, 300, 1, 21, 30, 1587 }, // U+2036
-    { 22, 8, 403, 1, 21, 44, 1617 }, // U+2037
-    { 12, 10, 190, 0, 3, 30, 1661 }, // U+2038
-    { 9, 14, 170, 1, 15, 32, 1691 }, // U+2039
-    { 9, 14, 170, 1, 15, 32, 1723 }, // U+203A
-    { 23, 23, 397, 1, 22, 133, 1755 }, // U+203B
-    { 14, 22, 266, 1, 21, 77, 1888 }, // U+203C
-    { 14, 23, 223, 0, 22, 81, 1965 }, // U+203D
-    { 16, 4, 233, -1, 26, 16, 2046 }, // U+203E
-    { 18, 7, 284, 0, 0, 32, 2062 }, // U+203F
-    { 18, 8, 284, 0, 24, 36, 2094 }, // U+2040
-    { 12, 19, 198, 0, 12, 57, 2130 }, // U+2041
-    { 33, 28, 522, 0, 23, 231, 2187 }, // U+2042
-    { 9, 4, 149, 1, 10, 9, 2418 }, // U+2043
-    { 16, 21, 61, -6, 21, 84, 2427 }, // U+2044
-    { 7, 26, 154, 2, 21, 46, 2511 }, // U+2045
-    { 8, 26, 154, 0, 21, 52, 2557 }, // U+2046
-    { 28, 23, 443, 0, 22, 161, 2609 }, // U+2047
-    { 21, 23, 356, 0, 22, 121, 2770 }, // U+2048
-    { 21, 23, 356, 1, 22, 121, 2891 }, // U+2049
-    { 15, 16, 274, 1, 16, 60, 3012 }, // U+204A
-    { 16, 27, 302, 2, 23, 108, 3072 }, // U+204B
-    { 16, 15, 306, 1, 16, 60, 3180 }, // U+204C
-    { 16, 15, 306, 2, 16, 60, 3240 }, // U+204D
-    { 15, 15, 253, 0, 8, 57, 3300 }, // U+204E
-    { 7, 21, 133, 1, 17, 37, 3357 }, // U+204F
-    { 18, 31, 280, 0, 24, 140, 3394 }, // U+2050
-    { 15, 30, 253, 0, 23, 113, 3534 }, // U+2051
-    { 13, 23, 197, 0, 22, 75, 3647 }, // U+2052
-    { 28, 6, 467, 1, 11, 42, 3722 }, // U+2053
-    { 18, 7, 280, 0, 0, 32, 3764 }, // U+2054
-    { 16, 15, 261, 0, 15, 60, 3796 }, // U+2055
-    { 15, 23, 270, 1, 22, 87, 3856 }, // U+2056
-    { 27, 8, 436, 1, 21, 54, 3943 }, // U+2057
-    { 23, 23, 407, 1, 22, 133, 3997 }, // U+2058
-    { 23, 23, 407, 1, 22, 133, 4130 }, // U+2059
-    { 6, 23, 133, 1, 22, 35, 4263 }, // U+205A
-    { 18, 24, 323, 1, 23, 108, 4298 }, // U+205B
-    { 23, 23, 398, 1, 22, 133, 4406 }, // U+205C
-    { 6, 24, 131, 1, 23, 36, 4539 }, // U+205D
-    { 6, 23, 133, 1, 22, 35, 4575 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 4610 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 4610 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 4610 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 4610 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 4610 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 4610 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 4610 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 4610 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 4610 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 4610 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 4610 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4660 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4710 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4760 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4810 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 4860 }, // U+206F
+    { 13, 4, 233, 1, 10, 13, 5634 }, // U+2013
+    { 28, 4, 467, 1, 10, 28, 5647 }, // U+2014
+    { 28, 4, 467, 1, 10, 28, 133 }, // U+2015
+    { 12, 30, 257, 2, 23, 90, 161 }, // U+2016
+    { 14, 7, 192, -1, 0, 25, 251 }, // U+2017
+    { 6, 8, 101, 0, 21, 12, 276 }, // U+2018
+    { 6, 8, 101, 0, 21, 12, 5675 }, // U+2019
+    { 7, 8, 133, 0, 4, 14, 288 }, // U+201A
+    { 6, 8, 101, 0, 21, 12, 302 }, // U+201B
+    { 13, 8, 208, 0, 21, 26, 5687 }, // U+201C
+    { 13, 8, 208, 0, 21, 26, 5713 }, // U+201D
+    { 14, 8, 239, 0, 4, 28, 314 }, // U+201E
+    { 13, 8, 208, 0, 21, 26, 342 }, // U+201F
+    { 13, 23, 239, 1, 23, 75, 368 }, // U+2020
+    { 13, 23, 242, 1, 23, 75, 443 }, // U+2021
+    { 9, 10, 175, 1, 16, 23, 518 }, // U+2022
+    { 10, 12, 175, 1, 17, 30, 541 }, // U+2023
+    { 6, 6, 233, 4, 5, 9, 571 }, // U+2024
+    { 15, 6, 268, 1, 5, 23, 580 }, // U+2025
+    { 23, 6, 399, 1, 5, 35, 5739 }, // U+2026
+    { 6, 6, 131, 1, 11, 9, 603 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 612 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 612 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 612 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 656 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 700 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 750 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 800 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 850 }, // U+202F
+    { 37, 23, 597, 0, 22, 213, 850 }, // U+2030
+    { 48, 23, 778, 0, 22, 276, 1063 }, // U+2031
+    { 9, 8, 141, 1, 21, 18, 1339 }, // U+2032
+    { 15, 8, 245, 1, 21, 30, 1357 }, // U+2033
+    { 21, 8, 348, 1, 21, 42, 1387 }, // U+2034
+    { 9, 8, 197, 1, 21, 18, 1429 }, // U+2035
+    { 15, 8, 300, 1, 21, 30, 1447 }, // U+2036
+    { 22, 8, 403, 1, 21, 44, 1477 }, // U+2037
+    { 12, 10, 190, 0, 3, 30, 1521 }, // U+2038
+    { 9, 14, 170, 1, 15, 32, 1551 }, // U+2039
+    { 9, 14, 170, 1, 15, 32, 1583 }, // U+203A
+    { 23, 23, 397, 1, 22, 133, 1615 }, // U+203B
+    { 14, 22, 266, 1, 21, 77, 1748 }, // U+203C
+    { 14, 23, 223, 0, 22, 81, 1825 }, // U+203D
+    { 16, 4, 233, -1, 26, 16, 1906 }, // U+203E
+    { 18, 7, 284, 0, 0, 32, 1922 }, // U+203F
+    { 18, 8, 284, 0, 24, 36, 1954 }, // U+2040
+    { 12, 19, 198, 0, 12, 57, 1990 }, // U+2041
+    { 33, 28, 522, 0, 23, 231, 2047 }, // U+2042
+    { 9, 4, 149, 1, 10, 9, 2278 }, // U+2043
+    { 16, 21, 61, -6, 21, 84, 2287 }, // U+2044
+    { 7, 26, 154, 2, 21, 46, 2371 }, // U+2045
+    { 8, 26, 154, 0, 21, 52, 2417 }, // U+2046
+    { 28, 23, 443, 0, 22, 161, 2469 }, // U+2047
+    { 21, 23, 356, 0, 22, 121, 2630 }, // U+2048
+    { 21, 23, 356, 1, 22, 121, 2751 }, // U+2049
+    { 15, 16, 274, 1, 16, 60, 2872 }, // U+204A
+    { 16, 27, 302, 2, 23, 108, 2932 }, // U+204B
+    { 16, 15, 306, 1, 16, 60, 3040 }, // U+204C
+    { 16, 15, 306, 2, 16, 60, 3100 }, // U+204D
+    { 15, 15, 253, 0, 8, 57, 3160 }, // U+204E
+    { 7, 21, 133, 1, 17, 37, 3217 }, // U+204F
+    { 18, 31, 280, 0, 24, 140, 3254 }, // U+2050
+    { 15, 30, 253, 0, 23, 113, 3394 }, // U+2051
+    { 13, 23, 197, 0, 22, 75, 3507 }, // U+2052
+    { 28, 6, 467, 1, 11, 42, 3582 }, // U+2053
+    { 18, 7, 280, 0, 0, 32, 3624 }, // U+2054
+    { 16, 15, 261, 0, 15, 60, 3656 }, // U+2055
+    { 15, 23, 270, 1, 22, 87, 3716 }, // U+2056
+    { 27, 8, 436, 1, 21, 54, 3803 }, // U+2057
+    { 23, 23, 407, 1, 22, 133, 3857 }, // U+2058
+    { 23, 23, 407, 1, 22, 133, 3990 }, // U+2059
+    { 6, 23, 133, 1, 22, 35, 4123 }, // U+205A
+    { 18, 24, 323, 1, 23, 108, 4158 }, // U+205B
+    { 23, 23, 398, 1, 22, 133, 4266 }, // U+205C
+    { 6, 24, 131, 1, 23, 36, 4399 }, // U+205D
+    { 6, 23, 133, 1, 22, 35, 4435 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 4470 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 4470 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 4470 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 4470 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 4470 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 4470 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 4470 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 4470 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 4470 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 4470 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 4470 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 4520 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 4570 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4620 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4670 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4720 }, // U+206F
     { 11, 14, 177, 0, 25, 39, 0 }, // U+2070
     { 4, 14, 91, 1, 22, 14, 39 }, // U+2071
     { 11, 13, 177, 0, 25, 36, 53 }, // U+2074
@@ -3101,13 +3107,13 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 14, 27, 267, 2, 24, 95, 3427 }, // U+20BF
     { 14, 23, 245, 1, 17, 81, 3522 }, // U+20C0
     { 15, 4, 271, 1, 12, 15, 0 }, // U+2212
-    { 24, 23, 360, 0, 23, 138, 0 }, // U+FB00
-    { 19, 23, 320, 0, 23, 110, 138 }, // U+FB01
-    { 18, 23, 323, 0, 23, 104, 248 }, // U+FB02
-    { 30, 23, 500, 0, 23, 173, 352 }, // U+FB03
-    { 30, 23, 504, 0, 23, 173, 525 }, // U+FB04
-    { 20, 24, 365, 2, 23, 120, 698 }, // U+FB05
-    { 26, 24, 435, 1, 23, 156, 818 }, // U+FB06
+    { 24, 23, 360, 0, 23, 138, 5774 }, // U+FB00
+    { 19, 23, 320, 0, 23, 110, 5912 }, // U+FB01
+    { 18, 23, 323, 0, 23, 104, 6022 }, // U+FB02
+    { 30, 23, 500, 0, 23, 173, 6126 }, // U+FB03
+    { 30, 23, 504, 0, 23, 173, 6299 }, // U+FB04
+    { 20, 24, 365, 2, 23, 120, 0 }, // U+FB05
+    { 26, 24, 435, 1, 23, 156, 120 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -3115,8 +3121,7 @@ static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3124,8 +3129,7 @@ static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3135,19 +3139,57 @@ static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
 };
 
 static const EpdFontGroup notosans_14_boldGroups[] = {
-    { 0, 3267, 7738, 97, 0 },
-    { 3267, 3014, 9381, 96, 97 },
-    { 6281, 3803, 14606, 128, 193 },
-    { 10084, 3763, 13112, 96, 321 },
-    { 13847, 1329, 2178, 112, 417 },
-    { 15176, 9543, 30173, 256, 529 },
-    { 24719, 2484, 12787, 90, 785 },
-    { 27203, 2168, 5297, 111, 875 },
-    { 29371, 615, 1417, 42, 986 },
-    { 29986, 1982, 3949, 33, 1028 },
-    { 31968, 16, 16, 1, 1061 },
-    { 31984, 312, 1024, 7, 1062 },
-    { 32296, 132, 196, 1, 1069 },
+    { 0, 2756, 7090, 83, 2 },
+    { 2756, 833, 1640, 26, 0 },
+    { 3589, 2999, 9285, 95, 97 },
+    { 6588, 3803, 14606, 128, 193 },
+    { 10391, 3763, 13112, 96, 321 },
+    { 14154, 1329, 2178, 112, 417 },
+    { 15483, 9543, 30173, 256, 529 },
+    { 25026, 2484, 12787, 90, 785 },
+    { 27510, 2097, 5137, 105, 875 },
+    { 29607, 615, 1417, 42, 986 },
+    { 30222, 1982, 3949, 33, 1028 },
+    { 32204, 16, 16, 1, 1061 },
+    { 32220, 166, 288, 2, 1067 },
+    { 32386, 132, 196, 1, 1069 },
+};
+
+static const uint16_t notosans_14_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_14_boldKernLeftClasses[] = {
@@ -4207,18 +4249,81 @@ static const EpdLigaturePair notosans_14_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_14_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 70, 49 }, { 0x0265, 66, 51 }, { 0x0266, 71, 60 }, { 0x0267, 0, 0 }, { 0x0268, 72, 61 }, // U+0450
+    { 0x0269, 73, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 74, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_14_bold = {
     notosans_14_boldBitmaps,
     notosans_14_boldGlyphs,
     notosans_14_boldIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notosans_14_boldGroups,
-    13,
-    nullptr,
+    14,
+    notosans_14_boldGlyphToGroup,
     notosans_14_boldKernLeftClasses,
     notosans_14_boldKernRightClasses,
     notosans_14_boldKernMatrix,
@@ -4228,4 +4333,8 @@ static const EpdFontData notosans_14_bold = {
     76,
     notosans_14_boldLigaturePairs,
     5,
+    notosans_14_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
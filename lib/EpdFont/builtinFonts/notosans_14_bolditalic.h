@@ -3,2393 +3,2398 @@
  * name: notosans_14_bolditalic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_bolditalicBitmaps[38089] = {
-    0x9D, 0x59, 0x3D, 0xB0, 0xDD, 0x46, 0x15, 0xDE, 0x2B, 0xD9, 0xD6, 0x4C, 0x34, 0x8C, 0x52, 0x84,
-    0x9F, 0x49, 0x66, 0x50, 0xCB, 0x98, 0x21, 0x6A, 0x29, 0x80, 0x15, 0xB8, 0x48, 0x41, 0xC1, 0x2B,
-    0xEC, 0x14, 0xB8, 0x30, 0x45, 0x28, 0x92, 0x61, 0xE6, 0x35, 0x29, 0x68, 0xB0, 0x94, 0x49, 0x49,
-    0x11, 0x37, 0x40, 0x41, 0x01, 0x85, 0x99, 0xC9, 0xBC, 0x14, 0x6E, 0x28, 0xC9, 0xDB, 0xB5, 0x5D,
-    0x50, 0xA4, 0x78, 0x4A, 0x32, 0x21, 0x45, 0x0A, 0xCB, 0x89, 0x13, 0x86, 0xB8, 0xF0, 0xC6, 0x56,
-    0x88, 0x9E, 0x2D, 0x69, 0xF9, 0xBE, 0xB3, 0xD2, 0xBD, 0xF7, 0xF9, 0xD9, 0x49, 0x86, 0xEB, 0xAB,
-    0xBD, 0xCF, 0xFA, 0xD9, 0xDD, 0xF3, 0xF7, 0x9D, 0xEF, 0x1C, 0x29, 0x63, 0x95, 0xC7, 0xB7, 0x56,
-    0xBE, 0x5C, 0x79, 0x15, 0xE1, 0x3B, 0xA9, 0x78, 0x54, 0xF1, 0xC0, 0x6F, 0xD2, 0xAB, 0xB4, 0x53,
-    0x99, 0xE3, 0x37, 0x7C, 0x4E, 0x2A, 0xA5, 0xAD, 0x32, 0x0D, 0xBF, 0x55, 0xAD, 0x4E, 0x28, 0x95,
-    0xDD, 0x1C, 0xF3, 0x77, 0x86, 0xFC, 0xDA, 0x50, 0x5C, 0xEF, 0x8B, 0x57, 0x3B, 0x7D, 0xC6, 0xE9,
-    0xD8, 0x9D, 0x8E, 0x2E, 0x29, 0xF5, 0x8F, 0xCC, 0x2A, 0x35, 0x60, 0x58, 0xF5, 0x79, 0xAD, 0xA2,
-    0x4E, 0x97, 0x2A, 0x76, 0x5A, 0xA9, 0xC4, 0x5D, 0x54, 0xA9, 0xF7, 0x7E, 0x58, 0x0F, 0xBD, 0xCA,
-    0x5F, 0xE9, 0x95, 0x2A, 0xCE, 0x74, 0x98, 0x3E, 0x76, 0x4A, 0xE3, 0x5C, 0x53, 0x2D, 0x83, 0x5D,
-    0x0D, 0x39, 0x27, 0x29, 0xB6, 0x27, 0x89, 0x31, 0x89, 0x4A, 0xDB, 0x37, 0xE7, 0x7D, 0xA9, 0x2C,
-    0x1C, 0xA7, 0xFC, 0x2D, 0x3E, 0xAD, 0xBC, 0x1F, 0x23, 0xBF, 0x3F, 0xC4, 0xE3, 0x8F, 0x4E, 0xC4,
-    0xC3, 0x6F, 0x55, 0x3C, 0xFD, 0x1D, 0xB2, 0x41, 0x08, 0x3F, 0x61, 0x05, 0xDF, 0xA8, 0x04, 0xFF,
-    0x89, 0xB0, 0x6E, 0x7C, 0x80, 0xE3, 0xAD, 0xFE, 0xE5, 0xE4, 0xB5, 0xBE, 0xBA, 0xE3, 0x1D, 0x96,
-    0x6B, 0xF1, 0x78, 0x79, 0xCA, 0xDC, 0x52, 0xEA, 0xBB, 0x98, 0xF2, 0x07, 0x38, 0xBE, 0xB7, 0xAC,
-    0xA1, 0xA0, 0xAC, 0xBC, 0x8E, 0xF1, 0xA8, 0x56, 0x99, 0xEF, 0xD4, 0xA8, 0xF2, 0x77, 0xFB, 0xA8,
-    0x57, 0x90, 0x3C, 0xC1, 0xB9, 0x57, 0x7B, 0xC8, 0xAA, 0xCF, 0xF4, 0xD8, 0x62, 0x95, 0x74, 0xFB,
-    0x4A, 0x55, 0xE9, 0x67, 0xC3, 0x6E, 0x5D, 0x5D, 0xF8, 0xE8, 0xAE, 0x77, 0xDA, 0x1F, 0xBC, 0xEF,
-    0xFB, 0xC2, 0xEF, 0xBE, 0x76, 0x6F, 0x48, 0xFA, 0x0A, 0x2A, 0x53, 0x6A, 0x2C, 0xAE, 0x41, 0xCD,
-    0xBD, 0x7E, 0x75, 0x50, 0xA9, 0xC3, 0x83, 0x2A, 0xB7, 0xFA, 0xB9, 0x4E, 0xE9, 0x52, 0xFF, 0xDC,
-    0xA9, 0x89, 0xFB, 0x8C, 0x06, 0x55, 0xF8, 0x1A, 0x93, 0xA7, 0x93, 0x3A, 0xFA, 0x31, 0x50, 0x15,
-    0xA4, 0x18, 0x31, 0xE6, 0x90, 0x17, 0xCA, 0xBB, 0xC9, 0x51, 0xDB, 0xAD, 0xF1, 0x9A, 0x8C, 0x1F,
-    0x0C, 0xBC, 0xEA, 0x3B, 0xB9, 0xB3, 0xE6, 0xA3, 0xA3, 0xF2, 0x2A, 0xF6, 0x1E, 0x96, 0xCE, 0x46,
-    0x8F, 0xC5, 0x0B, 0x57, 0xDD, 0xE8, 0x95, 0x6E, 0x0B, 0x4A, 0xD6, 0x64, 0xF0, 0x07, 0xDD, 0x26,
-    0xBE, 0x54, 0xFA, 0x70, 0x17, 0x63, 0x4E, 0x13, 0x40, 0x5E, 0x2F, 0x2A, 0x1B, 0xF3, 0x5E, 0xBC,
-    0x00, 0xDA, 0x6E, 0xF3, 0x26, 0xB7, 0x85, 0x2D, 0x6A, 0x6C, 0x58, 0x9D, 0x86, 0x49, 0x7A, 0xFA,
-    0x09, 0xDD, 0xA3, 0x5C, 0x4D, 0xE2, 0x3E, 0xE2, 0x3B, 0x79, 0xAB, 0x0A, 0xCB, 0xD3, 0xF0, 0x17,
-    0x53, 0x2A, 0x03, 0x23, 0x1C, 0xFB, 0xE2, 0x64, 0x85, 0xF5, 0x6A, 0xDE, 0x06, 0x5B, 0x3F, 0x51,
-    0x8B, 0x8C, 0x90, 0x1B, 0x73, 0x42, 0x07, 0x2B, 0x7C, 0x21, 0xE9, 0x24, 0xDF, 0xED, 0xE7, 0xE4,
-    0x0C, 0x2E, 0x45, 0x6B, 0x77, 0x15, 0x5F, 0x2D, 0x1A, 0xCE, 0x05, 0x5F, 0x1E, 0x79, 0x2E, 0x6B,
-    0xD5, 0xD3, 0x61, 0x42, 0x15, 0x77, 0xE1, 0xC0, 0xCC, 0xCF, 0x26, 0xAD, 0xD2, 0xB7, 0xE1, 0xC5,
-    0xFE, 0x76, 0x77, 0xCA, 0x43, 0x3D, 0x95, 0xEF, 0x56, 0xBE, 0xDD, 0x49, 0x1F, 0x60, 0xCB, 0x77,
-    0x31, 0xD3, 0x55, 0x2C, 0x5A, 0x52, 0xBF, 0x70, 0xE5, 0x93, 0x25, 0xE4, 0xB5, 0xC7, 0x0E, 0xB8,
-    0x4B, 0xBF, 0x1C, 0xDF, 0xBC, 0xF0, 0xDE, 0xCE, 0xB1, 0x7B, 0x52, 0xF8, 0xED, 0xD9, 0x78, 0x4C,
-    0x86, 0xB4, 0xCB, 0x1C, 0xAC, 0x5B, 0x43, 0x51, 0x7B, 0xA5, 0xF6, 0xB5, 0xF6, 0x65, 0xE5, 0xA1,
-    0x47, 0x6D, 0x4D, 0x63, 0x6C, 0x55, 0x9F, 0xE0, 0xEE, 0x68, 0xAE, 0x15, 0x0D, 0x1D, 0xD3, 0x64,
-    0xD8, 0xB9, 0x0A, 0x81, 0x07, 0x71, 0x24, 0xEC, 0x14, 0xF5, 0x17, 0x6E, 0x7B, 0xE8, 0x0E, 0xE8,
-    0xF8, 0xE1, 0x3B, 0x22, 0x6E, 0x3D, 0x19, 0x8E, 0xDF, 0xB1, 0xF9, 0x24, 0x70, 0x07, 0x0D, 0xAB,
-    0x42, 0xFA, 0xD8, 0xFF, 0x65, 0x48, 0xB0, 0xCF, 0xAC, 0x8F, 0x87, 0xBC, 0x8B, 0xC7, 0xC2, 0xC5,
-    0xA3, 0x6E, 0xE3, 0x41, 0x37, 0xC9, 0x50, 0x59, 0x1E, 0xE9, 0x60, 0x6C, 0xD6, 0xE3, 0xE8, 0x4C,
-    0x9D, 0x3B, 0x63, 0x75, 0x5B, 0x59, 0x8C, 0x9F, 0x50, 0x16, 0x0F, 0xF7, 0x80, 0x05, 0x3C, 0xD6,
-    0x78, 0x2A, 0xC8, 0x00, 0x7F, 0xAD, 0xC6, 0xD8, 0x0F, 0x85, 0x1F, 0xAA, 0x07, 0x83, 0xFE, 0x7D,
-    0xFF, 0x8D, 0x2C, 0x38, 0x03, 0x8C, 0x03, 0xBD, 0xE3, 0xDB, 0x88, 0x4B, 0xC0, 0x59, 0x08, 0x3D,
-    0xDB, 0xE8, 0x13, 0x3E, 0x11, 0x27, 0x2B, 0xE8, 0xDF, 0x9E, 0xEE, 0xED, 0x6F, 0xE3, 0xA6, 0x1F,
-    0x13, 0xA7, 0x9E, 0x54, 0xE2, 0xC4, 0xF8, 0xAF, 0x5A, 0x89, 0x26, 0xF8, 0x44, 0x2A, 0x3E, 0x4E,
-    0x17, 0x47, 0x6C, 0x63, 0x23, 0x34, 0x17, 0x4F, 0x55, 0x8E, 0x77, 0xE1, 0xFE, 0x84, 0xDA, 0x28,
-    0xA6, 0xBD, 0xCB, 0x44, 0x87, 0x9E, 0x86, 0xEB, 0x94, 0xA1, 0x47, 0xCB, 0xE7, 0x19, 0x5F, 0xAF,
-    0x70, 0x26, 0x02, 0x1C, 0xA9, 0x69, 0x77, 0x54, 0x3B, 0x9C, 0x14, 0x28, 0x28, 0x07, 0xE6, 0x5E,
-    0x19, 0x62, 0x52, 0x0D, 0x91, 0x30, 0x25, 0x82, 0x81, 0x02, 0x88, 0x5A, 0x21, 0x14, 0x7E, 0xE1,
-    0xB9, 0xEE, 0xF0, 0x94, 0x6F, 0x19, 0x28, 0xDC, 0xED, 0x2E, 0x40, 0x48, 0x9D, 0x95, 0x99, 0xB9,
-    0x13, 0xD9, 0x4E, 0x2A, 0x31, 0xCA, 0xA1, 0xE2, 0x86, 0x89, 0x43, 0xF1, 0x84, 0xE9, 0xB2, 0x7B,
-    0xD8, 0x67, 0xF1, 0x2E, 0x06, 0xF3, 0x5C, 0x0F, 0xCD, 0x01, 0x6F, 0xE3, 0x5E, 0x74, 0x45, 0x3F,
-    0xBE, 0x6F, 0xEE, 0x0B, 0x18, 0x86, 0xE1, 0xF4, 0x9E, 0xF9, 0xCF, 0x62, 0xC5, 0x4A, 0x8C, 0xBD,
-    0x68, 0xA2, 0xF0, 0x84, 0x0B, 0xE8, 0x1C, 0x0A, 0x33, 0x9E, 0xF1, 0x2D, 0x8E, 0x44, 0x1F, 0xA0,
-    0xA7, 0xC4, 0xB8, 0x94, 0x60, 0x73, 0xC0, 0x5A, 0x17, 0xFD, 0x01, 0xC2, 0xA8, 0xBC, 0x9B, 0x37,
-    0x8F, 0x23, 0x17, 0x01, 0xDE, 0x7C, 0xDE, 0x37, 0xD0, 0x48, 0x6D, 0x70, 0x6F, 0x41, 0x01, 0x9E,
-    0x9A, 0x2D, 0xB1, 0x32, 0x83, 0x98, 0xB7, 0xF2, 0xC3, 0xCA, 0x7F, 0xFC, 0x42, 0x8C, 0xB9, 0xD3,
-    0x3E, 0x88, 0x5F, 0xBC, 0xFD, 0x82, 0xD2, 0x07, 0x74, 0x65, 0x6F, 0xF1, 0x6C, 0x6B, 0x9C, 0x76,
-    0xDE, 0x16, 0xCE, 0x97, 0x39, 0x8E, 0xA2, 0xF5, 0xA5, 0x6E, 0x4C, 0x5D, 0xD9, 0xEA, 0x5F, 0xC1,
-    0x4B, 0x72, 0x4C, 0x93, 0xCC, 0x5E, 0x02, 0x00, 0x02, 0xB2, 0x71, 0x60, 0x06, 0x28, 0x53, 0x31,
-    0x73, 0xB0, 0x53, 0x46, 0xBF, 0x2E, 0x68, 0x1B, 0xEA, 0x99, 0xF9, 0x09, 0x46, 0x2C, 0xB7, 0x4D,
-    0x2D, 0x77, 0x68, 0xDE, 0x51, 0x35, 0xF3, 0x1D, 0x91, 0x3C, 0xCE, 0x3B, 0xB2, 0xB5, 0x33, 0xE8,
-    0x25, 0x6D, 0x41, 0xFD, 0x74, 0xF5, 0x0E, 0xCE, 0x34, 0x44, 0xFE, 0xB9, 0x31, 0x1E, 0xA3, 0x29,
-    0x1E, 0x70, 0xF0, 0x2F, 0x8F, 0x29, 0xE9, 0x0A, 0xB4, 0xB0, 0x09, 0x8A, 0xCA, 0xFB, 0xAA, 0xD5,
-    0x4D, 0xEE, 0x2A, 0x9B, 0x39, 0x53, 0xC3, 0xE5, 0xF1, 0x8B, 0x33, 0x40, 0x71, 0xDF, 0x00, 0x0F,
-    0x4B, 0xA6, 0x8E, 0x80, 0x82, 0x0C, 0x2D, 0x82, 0x92, 0x6F, 0x20, 0x90, 0x4B, 0xA7, 0xDD, 0x2E,
-    0xEB, 0xD2, 0xBE, 0x70, 0xC9, 0x50, 0xB4, 0x09, 0xC2, 0x27, 0xC5, 0x91, 0x0D, 0xDA, 0x15, 0x7D,
-    0x31, 0xF9, 0x1E, 0x28, 0xDA, 0x25, 0xFE, 0x86, 0x53, 0x2F, 0x22, 0x10, 0x18, 0x03, 0xB4, 0x23,
-    0x64, 0xFB, 0xF5, 0x05, 0x4F, 0xFD, 0xE2, 0x70, 0xF0, 0x8F, 0x12, 0xC0, 0x23, 0x9A, 0x9F, 0x62,
-    0x8F, 0x7F, 0xA3, 0xBA, 0xBC, 0x1D, 0xB5, 0x0F, 0x81, 0x06, 0x23, 0x1B, 0x72, 0xF2, 0xDB, 0xA8,
-    0x27, 0x4A, 0xF5, 0xA8, 0xCF, 0xEA, 0xEC, 0x0C, 0x8F, 0x4C, 0xE5, 0x01, 0x8E, 0x4B, 0x75, 0x71,
-    0x7D, 0x19, 0x09, 0x2E, 0x62, 0xFA, 0xED, 0x25, 0xEA, 0x8A, 0x69, 0xF9, 0x51, 0x15, 0xD4, 0x5F,
-    0x1D, 0x32, 0x3E, 0xB0, 0x53, 0xA8, 0x06, 0x6A, 0x84, 0x5A, 0x2B, 0xDC, 0x7B, 0xAA, 0x5F, 0x12,
-    0xE3, 0x4B, 0x7B, 0x7B, 0x97, 0x17, 0x0C, 0x3C, 0x8D, 0xBF, 0x97, 0x49, 0xB7, 0xB1, 0x71, 0x39,
-    0xF7, 0xB2, 0x12, 0x9C, 0x57, 0x55, 0x47, 0x97, 0x2D, 0xB1, 0x0E, 0xDD, 0x0F, 0x7F, 0xAC, 0x18,
-    0x89, 0xCC, 0x2C, 0xA6, 0xE7, 0x62, 0x91, 0x3F, 0x64, 0xDE, 0x93, 0xFB, 0x78, 0xFF, 0xAF, 0xB6,
-    0x64, 0xE1, 0xDE, 0x34, 0x5C, 0x9C, 0xFE, 0x54, 0xFC, 0xD1, 0xAB, 0xEF, 0x48, 0x00, 0xC8, 0x1C,
-    0x4A, 0xD2, 0xA4, 0xC6, 0x34, 0xB8, 0x87, 0x51, 0x47, 0x5F, 0x91, 0x30, 0x6D, 0xB7, 0xD5, 0x17,
-    0x22, 0xC8, 0x34, 0x92, 0xCF, 0x99, 0x95, 0x54, 0x50, 0xE4, 0x29, 0x7F, 0x89, 0x8E, 0xC6, 0xD0,
-    0xCC, 0x24, 0xE7, 0x55, 0xB7, 0xE0, 0x85, 0x9C, 0x36, 0xE9, 0x91, 0x87, 0x90, 0x85, 0x32, 0x97,
-    0xFA, 0x76, 0xCC, 0x2D, 0xCC, 0xB4, 0xAF, 0x5F, 0xF1, 0x17, 0xDA, 0x7D, 0x8D, 0x60, 0x6D, 0x2E,
-    0x56, 0x89, 0xCB, 0xEC, 0xFE, 0x3E, 0x32, 0xA2, 0x1D, 0xF7, 0xB3, 0xA6, 0xA8, 0x87, 0xFD, 0xCC,
-    0xEA, 0x9F, 0x61, 0x6C, 0x0C, 0x98, 0x40, 0xF6, 0xC0, 0x5F, 0x69, 0x2B, 0xD8, 0x1D, 0x51, 0xF0,
-    0xD3, 0x09, 0x2E, 0x5E, 0x08, 0x0E, 0x07, 0x52, 0x95, 0x4C, 0xE5, 0xB7, 0xE9, 0x03, 0x5C, 0x10,
-    0x42, 0x13, 0xAC, 0x56, 0x7B, 0x97, 0x24, 0x59, 0x05, 0xDC, 0xA8, 0xB9, 0x9D, 0x9A, 0xD7, 0x08,
-    0x3C, 0x77, 0xB8, 0xF5, 0x5D, 0x0C, 0x1E, 0x93, 0x44, 0x23, 0x06, 0x00, 0x76, 0x03, 0x9A, 0x86,
-    0x21, 0x77, 0xF4, 0x85, 0x06, 0x43, 0xF5, 0xE9, 0x95, 0x96, 0xC0, 0xE9, 0x38, 0xAF, 0x63, 0xA8,
-    0xC1, 0x21, 0x89, 0x29, 0x74, 0x01, 0xB8, 0x5E, 0xD6, 0x21, 0xB2, 0xB2, 0x0E, 0xCE, 0x87, 0x50,
-    0xD6, 0x8C, 0x76, 0xB2, 0x1E, 0xDA, 0xCC, 0x12, 0x16, 0xF1, 0x6C, 0x0D, 0x87, 0x42, 0x08, 0x63,
-    0x40, 0x10, 0x42, 0x07, 0x95, 0x8D, 0xFC, 0x1B, 0xBE, 0xC4, 0x54, 0x23, 0x43, 0xD7, 0x29, 0xF9,
-    0x2B, 0x41, 0x34, 0x71, 0x0A, 0x5F, 0x02, 0x48, 0x38, 0xAC, 0x18, 0xFA, 0x80, 0x88, 0xFC, 0xBE,
-    0x21, 0x8C, 0xC0, 0xA5, 0xB5, 0x17, 0x83, 0x6D, 0xF8, 0x8B, 0x81, 0x7F, 0xA7, 0x21, 0xDE, 0xB8,
-    0xD0, 0x64, 0x6C, 0xEC, 0x6D, 0x54, 0x6F, 0x42, 0x97, 0xD8, 0xB4, 0x15, 0xFE, 0xBA, 0x59, 0x86,
-    0x6A, 0x3D, 0x84, 0x73, 0x72, 0xB5, 0x43, 0x46, 0xC8, 0xA7, 0x5F, 0x3A, 0xDA, 0xCC, 0x85, 0xAD,
-    0x41, 0x0E, 0x5A, 0x72, 0x87, 0x97, 0xF9, 0x97, 0xAC, 0xBE, 0x2D, 0x5B, 0x45, 0xD9, 0xE0, 0x6E,
-    0xC8, 0x5B, 0x3D, 0x64, 0x4B, 0x45, 0x8A, 0x01, 0xF0, 0x82, 0x61, 0x54, 0xCC, 0x81, 0x18, 0xA0,
-    0xB0, 0xBC, 0x4B, 0xC9, 0x8E, 0xA0, 0xB5, 0xAA, 0xA5, 0x80, 0x36, 0x77, 0xC8, 0x99, 0xF9, 0x7D,
-    0x81, 0x48, 0x4F, 0xCD, 0x21, 0x30, 0xB4, 0xF8, 0xB7, 0xF6, 0x82, 0x30, 0x74, 0x5A, 0x6A, 0xD2,
-    0x48, 0xD2, 0x5A, 0xE0, 0x39, 0x64, 0x76, 0xC9, 0xCA, 0x1E, 0x11, 0x12, 0x33, 0xFB, 0xC4, 0xEB,
-    0xED, 0x4A, 0x92, 0x4E, 0xFB, 0x05, 0xD6, 0x32, 0x61, 0x6A, 0x92, 0xB3, 0xEF, 0xEF, 0xD5, 0x5C,
-    0xC8, 0x6E, 0xCD, 0xBE, 0xFE, 0xB3, 0xFC, 0xAA, 0x85, 0xC4, 0x83, 0x8E, 0x2E, 0x44, 0xE9, 0x1F,
-    0xB9, 0x90, 0xB0, 0x8C, 0xA3, 0xCA, 0x5E, 0x87, 0xF1, 0x25, 0x5A, 0x4B, 0x64, 0x85, 0xD6, 0xA6,
-    0x2B, 0x6D, 0x04, 0x99, 0x2F, 0x25, 0x7E, 0x6D, 0xAD, 0x2D, 0xB0, 0x7E, 0x62, 0xEF, 0xAF, 0xBA,
-    0xCD, 0x41, 0xA1, 0x9B, 0x02, 0xD4, 0x1D, 0x83, 0x85, 0xB5, 0x2A, 0x8B, 0xF9, 0x4C, 0x0D, 0x6B,
-    0x21, 0x1D, 0x40, 0x89, 0xB0, 0xD6, 0x79, 0x2F, 0x05, 0x00, 0x36, 0x19, 0x2C, 0x03, 0xFF, 0x53,
-    0x3B, 0x61, 0x61, 0xF0, 0x17, 0x8C, 0x94, 0xCE, 0x52, 0x0E, 0x63, 0x23, 0x91, 0x8F, 0xBC, 0x00,
-    0xDE, 0x37, 0xCA, 0x38, 0x50, 0x44, 0x68, 0x0D, 0xCA, 0xBC, 0x32, 0x48, 0x22, 0xE9, 0x65, 0x14,
-    0x59, 0x83, 0x42, 0x21, 0x11, 0x4D, 0xD7, 0x52, 0x52, 0x71, 0x75, 0xCE, 0x8A, 0x93, 0xF0, 0xF8,
-    0x30, 0xE2, 0x12, 0xB2, 0x67, 0x58, 0x2A, 0x8C, 0xD8, 0x07, 0xCE, 0xD1, 0x3F, 0xA0, 0xF0, 0x7C,
-    0x5C, 0x92, 0x7B, 0xD0, 0x0E, 0x05, 0xA4, 0xBF, 0x51, 0x35, 0x44, 0x0F, 0xA6, 0x5F, 0x66, 0x5F,
-    0x6A, 0x7E, 0xC6, 0x1E, 0x01, 0x0A, 0x4F, 0x03, 0x85, 0x69, 0x0C, 0x41, 0x53, 0x38, 0x1A, 0xB5,
-    0xFD, 0xB8, 0xC9, 0xAA, 0x47, 0x4F, 0x46, 0xA9, 0xD7, 0x24, 0x64, 0x08, 0x44, 0x4E, 0xD0, 0x6C,
-    0x9E, 0x0A, 0xD1, 0xF9, 0x92, 0xAC, 0x41, 0x9F, 0x16, 0xD8, 0x0C, 0x1F, 0xDD, 0xF0, 0x49, 0x6D,
-    0x53, 0x32, 0x15, 0x2B, 0x88, 0x6A, 0x89, 0xE2, 0xBE, 0x26, 0x7A, 0xF8, 0x33, 0x34, 0x9B, 0xA7,
-    0xDD, 0x56, 0x9E, 0x19, 0x32, 0x9A, 0x78, 0x31, 0x9E, 0xB8, 0x72, 0xEC, 0x03, 0x59, 0x11, 0xBA,
-    0x24, 0x68, 0xC4, 0xDC, 0xC5, 0xE5, 0xB4, 0x30, 0x9D, 0x42, 0x76, 0xCF, 0x0D, 0x60, 0x24, 0x69,
-    0x69, 0x99, 0xAC, 0x75, 0xC3, 0x6D, 0x6A, 0x31, 0xD3, 0x51, 0xED, 0xD8, 0xB5, 0x40, 0x6A, 0xD6,
-    0x4E, 0x34, 0x3D, 0x42, 0xA8, 0x7E, 0x9B, 0x88, 0x04, 0x9F, 0xA7, 0xCB, 0xD3, 0xCD, 0xC5, 0xCB,
-    0x35, 0xAD, 0xDD, 0xF2, 0x87, 0xFC, 0xB2, 0x22, 0x81, 0x80, 0x97, 0x90, 0x92, 0xA0, 0x6C, 0x85,
-    0xA1, 0xC3, 0x8F, 0x86, 0xFE, 0x40, 0xA7, 0x2A, 0x94, 0x1E, 0xE3, 0xA8, 0x26, 0x53, 0x46, 0xE3,
-    0xB8, 0x1A, 0x50, 0xE6, 0x0C, 0x63, 0xDC, 0xF3, 0x67, 0x4A, 0x3E, 0x43, 0x4D, 0xD2, 0xEF, 0x67,
-    0x1F, 0x02, 0xB5, 0xBA, 0xFD, 0xFC, 0x3A, 0x6B, 0xAE, 0x7D, 0x96, 0x5E, 0xC8, 0xF0, 0x15, 0x03,
-    0xDE, 0x55, 0x13, 0x8C, 0x95, 0xB7, 0x15, 0xC8, 0xBA, 0xCA, 0x9B, 0xAA, 0x27, 0x01, 0xB3, 0x95,
-    0x93, 0x9A, 0xA6, 0x6A, 0x09, 0xAD, 0x56, 0x5B, 0xF2, 0x68, 0x78, 0x31, 0xEA, 0x0C, 0x2D, 0xE9,
-    0xB4, 0xE2, 0x93, 0x2C, 0xA9, 0x72, 0x62, 0x19, 0xA9, 0x3A, 0xD9, 0x9A, 0x55, 0x13, 0x9C, 0xDD,
-    0xAE, 0x46, 0xB0, 0x9F, 0x3A, 0x1A, 0x91, 0xB0, 0x6B, 0x70, 0x69, 0x6B, 0xE0, 0xBB, 0x60, 0x45,
-    0x70, 0x8A, 0xCC, 0xC9, 0x88, 0x3D, 0xA5, 0x5D, 0x7A, 0x08, 0xCC, 0x71, 0xC9, 0xC4, 0x99, 0x62,
-    0x8A, 0x84, 0x10, 0x83, 0xEF, 0x36, 0x2B, 0xB8, 0x35, 0xF0, 0x1D, 0x6E, 0xCD, 0x9A, 0x4A, 0x2A,
-    0xAB, 0xCA, 0xAD, 0x49, 0xD9, 0x28, 0x59, 0xCA, 0xCE, 0x71, 0x79, 0xDF, 0x80, 0xC2, 0xD7, 0xF9,
-    0x90, 0x10, 0xC3, 0x60, 0x9D, 0x64, 0x04, 0x8A, 0x92, 0xC6, 0x2B, 0xF2, 0x78, 0x0E, 0xA8, 0x79,
-    0x69, 0xCE, 0x74, 0x40, 0x48, 0x66, 0x32, 0xF4, 0xF8, 0x6F, 0xE1, 0x70, 0x15, 0xCC, 0x06, 0xC0,
-    0x6D, 0x19, 0x97, 0x65, 0xC6, 0x90, 0x14, 0xDC, 0x40, 0x3C, 0xD4, 0x4B, 0x5C, 0xFA, 0xCB, 0x02,
-    0x3C, 0x1B, 0x14, 0x6D, 0x98, 0x21, 0xDA, 0x25, 0x43, 0xE4, 0xCC, 0x92, 0x85, 0x8B, 0x98, 0x2B,
-    0xE2, 0x09, 0x53, 0x09, 0xB9, 0x8B, 0x7D, 0xA0, 0x9D, 0xD0, 0xD6, 0xF4, 0xB7, 0x19, 0x6E, 0x1E,
-    0x8F, 0x39, 0x9B, 0xD2, 0xE4, 0xAB, 0x64, 0x8B, 0x8F, 0xC9, 0xD6, 0x7E, 0x0D, 0xD9, 0x76, 0x45,
-    0xB6, 0x71, 0x2D, 0x1B, 0x49, 0x25, 0x9D, 0x3F, 0x30, 0x45, 0x81, 0x32, 0x49, 0x41, 0xB1, 0x5F,
-    0x67, 0x0D, 0x61, 0xFB, 0xC4, 0xD8, 0xDB, 0xD2, 0x22, 0x61, 0xAB, 0xA4, 0x24, 0x56, 0x60, 0xC7,
-    0x73, 0x46, 0x54, 0x14, 0xF5, 0xFC, 0x26, 0x2D, 0x76, 0x21, 0x72, 0x24, 0x70, 0x32, 0xB0, 0x40,
-    0xC8, 0x9B, 0xBB, 0x10, 0x35, 0xB9, 0x13, 0x40, 0x82, 0xEF, 0x23, 0x64, 0xBC, 0x04, 0x6A, 0x39,
-    0xD3, 0x8E, 0x5B, 0x92, 0xA1, 0x3C, 0xF9, 0xF5, 0xA7, 0x03, 0xAE, 0x3D, 0x19, 0x2F, 0x81, 0x22,
-    0x48, 0x00, 0xF5, 0x30, 0xC5, 0xE8, 0x29, 0x10, 0x81, 0xC8, 0xCF, 0xEC, 0x45, 0xA2, 0xAD, 0xD9,
-    0x41, 0x46, 0xBC, 0xF8, 0x3C, 0x90, 0xD6, 0x93, 0x87, 0xC3, 0x0F, 0x67, 0x7E, 0x0D, 0xDD, 0x8D,
-    0x3C, 0x70, 0x7E, 0xA8, 0x24, 0x11, 0xB7, 0x8F, 0x0D, 0xD0, 0x05, 0xBE, 0xB6, 0x51, 0x67, 0x41,
-    0x9C, 0x74, 0x0B, 0xC0, 0x04, 0x82, 0x05, 0x7B, 0x23, 0x19, 0x60, 0x90, 0x3E, 0x24, 0x4C, 0x0C,
-    0x9D, 0xC0, 0xEE, 0x92, 0x30, 0x75, 0x2B, 0x98, 0x2B, 0xC1, 0x23, 0x88, 0x0B, 0x65, 0xB0, 0x68,
-    0xA4, 0xDF, 0x34, 0xA2, 0x47, 0x7A, 0x0B, 0xBC, 0x1E, 0x44, 0x73, 0x97, 0xD1, 0x1C, 0x74, 0xD7,
-    0x06, 0x9E, 0x29, 0x04, 0x18, 0xCC, 0xAC, 0x40, 0x91, 0xC9, 0x04, 0x42, 0xF5, 0x6B, 0x26, 0x04,
-    0x6D, 0xB1, 0x3F, 0x8D, 0x82, 0x94, 0x18, 0x87, 0xF0, 0x68, 0xA4, 0xDA, 0x87, 0x1B, 0x15, 0x0D,
-    0x5B, 0x07, 0xA8, 0x36, 0x30, 0x40, 0x8A, 0xFC, 0x43, 0x6A, 0xEB, 0x23, 0x22, 0xE6, 0x6D, 0x6E,
-    0xFE, 0x0E, 0x21, 0x8C, 0x9A, 0x24, 0x6C, 0x60, 0x58, 0x2A, 0x32, 0xE2, 0x24, 0x16, 0x62, 0xC5,
-    0xDA, 0x57, 0x35, 0xE6, 0x06, 0x0C, 0x90, 0x8A, 0x14, 0xF8, 0xC9, 0xB0, 0x52, 0xA3, 0xF9, 0xC3,
-    0x1D, 0x80, 0x0F, 0x33, 0xA4, 0x61, 0x05, 0xEE, 0xC2, 0x98, 0x88, 0xFB, 0x98, 0x0C, 0x90, 0x43,
-    0x5F, 0x1D, 0x0C, 0x90, 0x43, 0x5F, 0x1F, 0x0C, 0x65, 0xFE, 0x67, 0x67, 0x20, 0xB0, 0x3E, 0x70,
-    0x86, 0x6D, 0x88, 0x83, 0xC6, 0x60, 0x63, 0xFA, 0x8A, 0xAD, 0xD8, 0xE0, 0x00, 0x1C, 0x88, 0x7B,
-    0x49, 0x11, 0x88, 0xA9, 0x80, 0x1E, 0x44, 0x36, 0x32, 0x6A, 0xFE, 0x74, 0x82, 0x2D, 0x12, 0xE4,
-    0x50, 0x17, 0x94, 0x85, 0x89, 0xD8, 0x7B, 0xE9, 0x22, 0x21, 0xB3, 0xF4, 0xCF, 0x84, 0x11, 0x10,
-    0xBC, 0x9F, 0xE8, 0xDD, 0x08, 0x63, 0x2D, 0xE7, 0x8A, 0x52, 0x11, 0x18, 0xF9, 0x77, 0x27, 0x0C,
-    0xA0, 0x97, 0x1A, 0x5F, 0xEA, 0xA5, 0x07, 0x94, 0x53, 0xDF, 0xA5, 0xC8, 0xE6, 0xAA, 0x58, 0xBB,
-    0x86, 0xED, 0x63, 0x2F, 0xD3, 0x0F, 0x92, 0x10, 0x3B, 0x25, 0xE1, 0x22, 0x95, 0x84, 0xE8, 0x9B,
-    0x16, 0x82, 0xC3, 0x4E, 0x01, 0xEF, 0x17, 0xDE, 0x48, 0xAE, 0x09, 0xD7, 0x49, 0x0E, 0xE9, 0x2B,
-    0x0C, 0x91, 0x98, 0xEB, 0x48, 0x73, 0x6D, 0x25, 0x19, 0x2F, 0x90, 0x91, 0x23, 0x3C, 0x44, 0xAA,
-    0x7A, 0x3A, 0xD5, 0xDC, 0xB7, 0x58, 0x13, 0x1E, 0xC6, 0x97, 0x0B, 0x85, 0xB8, 0x50, 0x33, 0x23,
-    0x79, 0x27, 0x10, 0x5F, 0x3E, 0x93, 0x0F, 0x4B, 0x15, 0xC7, 0xA9, 0x25, 0x62, 0x36, 0x3C, 0x51,
-    0xCE, 0x1B, 0x39, 0x5F, 0x87, 0xD4, 0x3B, 0x9F, 0x9F, 0xF6, 0x5E, 0x97, 0xF2, 0x83, 0xD3, 0x75,
-    0x42, 0x83, 0x83, 0xC9, 0x59, 0x69, 0x14, 0x3E, 0x44, 0x80, 0x26, 0x95, 0xA2, 0x93, 0x29, 0xE9,
-    0x3E, 0xC9, 0x86, 0x31, 0x33, 0xDB, 0x4C, 0xD1, 0x10, 0x0E, 0x72, 0x7E, 0x1E, 0x09, 0xB4, 0x99,
-    0xBA, 0x4D, 0x25, 0x91, 0x61, 0xC9, 0x9C, 0x64, 0x9D, 0xD3, 0xBC, 0x17, 0x02, 0x93, 0x9D, 0x81,
-    0x97, 0x5E, 0xE7, 0x34, 0x06, 0x53, 0x56, 0xA5, 0x2E, 0x35, 0x1C, 0xB6, 0xC0, 0xBF, 0xDC, 0x66,
-    0x4D, 0xD6, 0xE2, 0x9F, 0x4B, 0x5D, 0xE2, 0x92, 0x2E, 0x46, 0x2D, 0x81, 0xD2, 0x73, 0x98, 0xDB,
-    0x01, 0xDA, 0x87, 0x09, 0xB8, 0xF0, 0xB2, 0x78, 0x3C, 0x6C, 0x16, 0x4E, 0xDC, 0xD1, 0xC5, 0x41,
-    0xF3, 0xC3, 0xC2, 0xDB, 0x32, 0x94, 0x47, 0x64, 0xF8, 0xD6, 0x18, 0xFC, 0x80, 0x47, 0xA8, 0xC7,
-    0x7E, 0x12, 0x84, 0x5C, 0xF9, 0xA0, 0x5B, 0xD6, 0x14, 0xD9, 0x01, 0xBC, 0xF2, 0x17, 0xC8, 0xA4,
-    0x69, 0xAB, 0x86, 0xD8, 0x61, 0x4F, 0xD8, 0x5D, 0xD4, 0x65, 0xCD, 0xAA, 0xC7, 0xB4, 0xC3, 0x69,
-    0xA5, 0x5E, 0xFF, 0xE6, 0xB9, 0x73, 0x82, 0x7F, 0xA8, 0xF0, 0xD4, 0xB9, 0x92, 0x34, 0x2E, 0x6B,
-    0x63, 0x27, 0x09, 0x81, 0xCA, 0xDF, 0x5F, 0x79, 0x64, 0x55, 0x20, 0x4C, 0x86, 0x00, 0xCE, 0x7B,
-    0x16, 0xB9, 0x29, 0x60, 0x17, 0x71, 0x64, 0x43, 0xC1, 0x6C, 0x6C, 0xE8, 0x13, 0x81, 0x81, 0x34,
-    0xE6, 0x13, 0x41, 0x28, 0x5B, 0x78, 0x03, 0x6E, 0x82, 0x15, 0xD6, 0x85, 0xEA, 0x06, 0xFD, 0xB7,
-    0x5A, 0x1A, 0x1B, 0x3E, 0x0B, 0x3F, 0x5F, 0x4D, 0x7E, 0x08, 0x54, 0x31, 0xF6, 0x7F, 0x42, 0x2E,
-    0x9F, 0x04, 0x81, 0x38, 0x08, 0x79, 0x07, 0xBC, 0x43, 0x3B, 0x11, 0x07, 0xF1, 0xD5, 0x44, 0x10,
-    0x08, 0xC3, 0x88, 0x78, 0x0A, 0xD5, 0x07, 0x33, 0x59, 0x95, 0xD1, 0xFF, 0xD6, 0xEB, 0x16, 0xD2,
-    0xF2, 0x61, 0xA2, 0x42, 0x80, 0x9F, 0x2F, 0x99, 0x04, 0x08, 0x90, 0x55, 0xB3, 0x01, 0x47, 0x6E,
-    0x45, 0x0E, 0x02, 0xE6, 0xE7, 0xBF, 0xC1, 0x5C, 0x83, 0x74, 0x30, 0x62, 0x86, 0xD7, 0x53, 0x5B,
-    0x14, 0xF9, 0x78, 0x3F, 0x66, 0xED, 0xFF, 0x1A, 0x19, 0x7E, 0xE5, 0x27, 0xC9, 0x83, 0xC0, 0x48,
-    0x42, 0x5D, 0xDE, 0x61, 0x73, 0xD4, 0x15, 0x44, 0x07, 0xD3, 0xA0, 0xB6, 0x14, 0xD5, 0xA5, 0xD8,
-    0x57, 0xC3, 0x40, 0x66, 0x4A, 0xDE, 0x6C, 0x6E, 0x86, 0x0C, 0x88, 0xD0, 0xF4, 0xA8, 0xFA, 0xD2,
-    0x89, 0xE6, 0x5E, 0xAB, 0x8D, 0xBE, 0x0C, 0xD9, 0xC8, 0xEB, 0xB3, 0x91, 0x59, 0x26, 0xED, 0x08,
-    0xB9, 0xFA, 0x6D, 0xE3, 0x42, 0x37, 0x66, 0x52, 0xE6, 0xD3, 0x72, 0xB3, 0xFF, 0x36, 0x55, 0xA1,
-    0x4F, 0x47, 0xD6, 0x7D, 0xB8, 0x34, 0x2F, 0x4E, 0xAA, 0x39, 0x74, 0x53, 0x22, 0x6F, 0xCE, 0x20,
-    0x2B, 0x5C, 0xB9, 0x94, 0x5B, 0xD2, 0x77, 0xF1, 0x92, 0x8B, 0x79, 0x11, 0xAE, 0x75, 0xD2, 0x9F,
-    0x3D, 0x52, 0x5F, 0x3C, 0x2E, 0xAE, 0xBF, 0xA2, 0xBE, 0xB0, 0xA1, 0x97, 0xAE, 0x4E, 0x87, 0x82,
-    0x86, 0xA7, 0xC6, 0xA5, 0xA0, 0x9B, 0xC5, 0x1B, 0x0A, 0x56, 0x52, 0x9A, 0x46, 0x62, 0x7A, 0xFD,
-    0x33, 0xAC, 0x3D, 0x02, 0xAE, 0x32, 0x26, 0x1D, 0xE0, 0x21, 0x0D, 0x8D, 0x85, 0x0B, 0x17, 0xD3,
-    0xDA, 0xC9, 0x9C, 0x74, 0x0A, 0x07, 0x3B, 0x16, 0x87, 0xE0, 0x4A, 0x39, 0x83, 0x3E, 0xF3, 0x77,
-    0xD8, 0xB2, 0x7E, 0x68, 0x61, 0x28, 0xF4, 0xE2, 0x79, 0x29, 0x9F, 0xA4, 0xF6, 0xE8, 0xA5, 0xFD,
-    0xF7, 0x75, 0xBD, 0xB1, 0xA3, 0x37, 0x8E, 0xF4, 0x46, 0xB6, 0xD0, 0xDF, 0xE7, 0x40, 0x47, 0x64,
-    0x52, 0x10, 0x97, 0x4C, 0x7B, 0xD9, 0x1F, 0xF3, 0x21, 0xF7, 0x97, 0x6F, 0xF6, 0xD7, 0x8A, 0xC1,
-    0x99, 0x20, 0x68, 0xEB, 0xCA, 0xE6, 0x81, 0xCA, 0x21, 0x96, 0xA5, 0x46, 0x92, 0x60, 0x0E, 0x2D,
-    0x43, 0x15, 0x5A, 0xA1, 0xB1, 0xBC, 0x88, 0xC1, 0xA3, 0xF8, 0xE2, 0x59, 0xF6, 0x04, 0x3B, 0xE9,
-    0x9F, 0x86, 0x16, 0xEA, 0xD2, 0x3F, 0x55, 0xCB, 0x34, 0xA1, 0x9C, 0x68, 0xD4, 0x66, 0x26, 0xB5,
-    0x61, 0xDE, 0xFE, 0x31, 0xCC, 0xBB, 0xDF, 0x62, 0xDE, 0x2E, 0xD8, 0x48, 0x37, 0x9B, 0xCA, 0x64,
-    0xE6, 0x08, 0xEC, 0xBE, 0xBD, 0xE1, 0x43, 0x6A, 0x66, 0xA9, 0x61, 0x9A, 0xAF, 0xA9, 0x2F, 0xF8,
-    0xDD, 0x0A, 0x0A, 0x42, 0xF9, 0x96, 0x50, 0x1A, 0x2C, 0x07, 0x1A, 0x4C, 0xB6, 0x86, 0x7B, 0x12,
-    0x2F, 0x0D, 0x25, 0xA6, 0x68, 0x3F, 0x2E, 0x4E, 0x76, 0x48, 0x88, 0x76, 0xF4, 0xF9, 0x16, 0xA2,
-    0x20, 0xFD, 0x0A, 0x7F, 0x90, 0x28, 0xE9, 0x97, 0x05, 0xE7, 0xBE, 0xF1, 0xFC, 0xD6, 0x6A, 0xD6,
-    0xD7, 0xF4, 0x65, 0xFA, 0xD2, 0xC7, 0xF4, 0xA5, 0xD4, 0x50, 0x74, 0x48, 0xFE, 0xAB, 0xC1, 0x0C,
-    0x9A, 0x8F, 0xFB, 0xC9, 0x90, 0xB1, 0xBE, 0xEF, 0x3F, 0x27, 0x28, 0x80, 0x31, 0x56, 0x96, 0x40,
-    0x53, 0xB2, 0xF9, 0x0D, 0xED, 0x99, 0x5A, 0x2C, 0xCB, 0x16, 0x07, 0x16, 0xC1, 0x0F, 0x0D, 0xEB,
-    0x05, 0x6D, 0x84, 0xFA, 0xCA, 0xD5, 0xA2, 0x95, 0xAB, 0xB4, 0x32, 0x69, 0x01, 0xEC, 0x9C, 0x0C,
-    0x62, 0x69, 0x09, 0x8C, 0x79, 0x51, 0x2E, 0x39, 0x72, 0xC1, 0x6D, 0x07, 0x8A, 0xFF, 0x7F, 0x07,
-    0x62, 0xA3, 0x8E, 0x48, 0x96, 0x08, 0x12, 0xEC, 0x76, 0x45, 0x07, 0xF2, 0xDB, 0xA6, 0xD2, 0xB1,
-    0xC7, 0xD1, 0x9B, 0x3A, 0xEB, 0xA5, 0x85, 0xB9, 0x74, 0xED, 0x6F, 0x86, 0xE2, 0x2A, 0xF3, 0xEC,
-    0xF3, 0xDD, 0x5A, 0x9A, 0x5F, 0x54, 0x2D, 0xE9, 0x5E, 0xC5, 0x70, 0x64, 0x1F, 0x58, 0xF9, 0x8F,
-    0x85, 0xF5, 0x4A, 0x1D, 0x8E, 0x81, 0x2C, 0x28, 0x42, 0x85, 0x65, 0xB1, 0x21, 0xC3, 0xC1, 0xD7,
-    0x61, 0xC3, 0x64, 0xAC, 0xA9, 0xBF, 0x30, 0xD2, 0x82, 0x50, 0xFB, 0x03, 0x20, 0x49, 0x7E, 0x97,
-    0x66, 0x6C, 0x9F, 0xDC, 0xEE, 0x27, 0x3C, 0xA2, 0x6B, 0xAD, 0x36, 0x99, 0x64, 0x9C, 0xE2, 0x25,
-    0x93, 0x74, 0xEB, 0x4C, 0xD2, 0xAD, 0x33, 0x09, 0xF7, 0x0E, 0x60, 0x94, 0x4C, 0x12, 0xF6, 0x1F,
-    0x32, 0xC9, 0x80, 0xB9, 0xCA, 0x87, 0x2B, 0xCC, 0x71, 0xE3, 0xE7, 0xFC, 0x8C, 0xA8, 0xA4, 0x46,
-    0x63, 0xA1, 0x71, 0x41, 0xFB, 0x58, 0x5C, 0x6F, 0xAB, 0xA2, 0xDE, 0x2A, 0x3E, 0x8B, 0xED, 0x10,
-    0x98, 0x69, 0xF2, 0xD2, 0xB3, 0x8A, 0x43, 0xFF, 0x1C, 0xDA, 0x4C, 0xC2, 0x33, 0x63, 0x68, 0xCE,
-    0x49, 0x36, 0x60, 0xAA, 0xCD, 0xD7, 0x84, 0x5D, 0x5D, 0x86, 0xB7, 0x1B, 0x78, 0xB6, 0x91, 0xD7,
-    0x4A, 0x4D, 0x28, 0xA2, 0xF8, 0xEA, 0x54, 0xD2, 0x30, 0xB8, 0x26, 0x69, 0x39, 0x58, 0xF9, 0xF0,
-    0xCC, 0x78, 0x36, 0x0B, 0xAE, 0xBA, 0x7E, 0x35, 0xD2, 0x2C, 0xAE, 0xFA, 0x76, 0x78, 0x4F, 0x54,
-    0x93, 0xB9, 0xEC, 0x70, 0xBB, 0x74, 0x0E, 0xE6, 0xBA, 0x6D, 0x0F, 0x19, 0xE6, 0x84, 0x07, 0x83,
-    0xD3, 0x39, 0x7A, 0x3A, 0x47, 0xB7, 0x50, 0x6E, 0xCD, 0x01, 0x8C, 0xAE, 0x7A, 0x47, 0xDA, 0x54,
-    0x77, 0x38, 0x5C, 0x00, 0xDF, 0x1B, 0xC9, 0x5E, 0x4A, 0x21, 0xBE, 0xF1, 0x18, 0xFC, 0x04, 0x99,
-    0x03, 0x0C, 0x9D, 0x05, 0x2E, 0x6B, 0x55, 0xBE, 0x3F, 0x2C, 0xAE, 0x4D, 0xF2, 0x5E, 0x22, 0xFF,
-    0x00, 0xB5, 0xCB, 0x0D, 0x27, 0xEC, 0x39, 0x93, 0x17, 0x81, 0x25, 0x8E, 0xC0, 0x9C, 0x75, 0x5D,
-    0x74, 0xAC, 0x6B, 0x75, 0x87, 0x8A, 0xC7, 0x56, 0x1D, 0x67, 0xF1, 0xC8, 0x45, 0xFA, 0xAA, 0x07,
-    0x51, 0xD4, 0xD7, 0x1E, 0xC0, 0x82, 0xFA, 0xFA, 0xBD, 0xCE, 0x94, 0xFA, 0xAD, 0x7B, 0x1D, 0x78,
-    0xF3, 0xC1, 0xBB, 0xFF, 0x45, 0x7C, 0xDC, 0xB8, 0xFE, 0x05, 0xB6, 0x7C, 0xE7, 0xCC, 0x17, 0x40,
-    0x6C, 0xCF, 0xD7, 0xA9, 0xC5, 0xC4, 0xDA, 0xBE, 0x80, 0x27, 0x59, 0x19, 0x41, 0xFC, 0xBB, 0x58,
-    0xB8, 0x2A, 0x5B, 0x18, 0x01, 0x05, 0x5A, 0x76, 0x65, 0x3E, 0x63, 0x36, 0xFA, 0x42, 0x34, 0x4F,
-    0x72, 0xC6, 0xA4, 0xC5, 0x67, 0xE4, 0x4D, 0x56, 0xA0, 0xF6, 0x5A, 0x5A, 0xD5, 0x37, 0x88, 0xFB,
-    0x50, 0x44, 0x42, 0xC8, 0x91, 0x56, 0x9E, 0x26, 0x39, 0x10, 0x81, 0x15, 0x25, 0x5E, 0xF4, 0x44,
-    0x70, 0xB0, 0xA2, 0x70, 0xE0, 0x49, 0x21, 0x95, 0xC3, 0x3B, 0xB8, 0x2F, 0x97, 0xCA, 0xE1, 0xDF,
-    0x9B, 0xCA, 0xA1, 0xE5, 0x92, 0x76, 0x6E, 0xC7, 0x26, 0xEB, 0x37, 0x15, 0xE1, 0xFD, 0xDA, 0xF2,
-    0xAA, 0xE1, 0x74, 0xD8, 0x40, 0x79, 0x24, 0x9D, 0xB1, 0xF4, 0x42, 0x60, 0xF0, 0xFD, 0x92, 0x3A,
-    0x47, 0x6A, 0x8F, 0x85, 0x48, 0x64, 0xF9, 0x3C, 0x31, 0x8D, 0x0F, 0x7A, 0x2B, 0x08, 0xCD, 0x53,
-    0xF9, 0xE1, 0x39, 0xE9, 0xEE, 0x31, 0x59, 0x57, 0xF2, 0x4A, 0xE4, 0xFB, 0xEC, 0x0E, 0x5B, 0x25,
-    0x7E, 0xCB, 0xD6, 0xE9, 0x63, 0xC8, 0x20, 0x2B, 0x1F, 0x1F, 0xAA, 0x59, 0xD4, 0x10, 0xEA, 0x99,
-    0x21, 0xBC, 0xFE, 0x11, 0x5E, 0x39, 0x3C, 0xC4, 0x2B, 0xFB, 0xE0, 0xA9, 0xB1, 0x94, 0x7E, 0xD8,
-    0xEE, 0xD3, 0x58, 0x66, 0xFF, 0x4B, 0x3E, 0x2F, 0xAA, 0x67, 0xCB, 0xB9, 0x65, 0xD5, 0xC9, 0x7B,
-    0x02, 0x99, 0x62, 0xE1, 0xC5, 0xE9, 0xC2, 0x8B, 0xE7, 0x97, 0x62, 0x64, 0xEE, 0x14, 0x27, 0x9D,
-    0xA9, 0xAD, 0x24, 0x92, 0xE3, 0x14, 0x9B, 0xBB, 0xD9, 0xED, 0xC3, 0x3B, 0x3A, 0xA6, 0xAD, 0x17,
-    0x59, 0x0B, 0x5F, 0x56, 0x27, 0x50, 0x7C, 0xFF, 0x90, 0xEC, 0xFD, 0x77, 0xBB, 0xBE, 0xDF, 0x59,
-    0x85, 0x54, 0xF3, 0x3F, 0xC5, 0x5A, 0x3D, 0x90, 0xDD, 0xD4, 0x15, 0x3E, 0x7A, 0xF2, 0x46, 0x03,
-    0x9A, 0x44, 0x14, 0x76, 0x43, 0xC8, 0xA8, 0x49, 0x91, 0x61, 0x12, 0xD4, 0xA6, 0x30, 0x5C, 0x05,
-    0x8A, 0x14, 0x14, 0x6C, 0xB1, 0x9B, 0xCC, 0x84, 0xC2, 0x4D, 0x9A, 0x90, 0xCC, 0x6C, 0x9B, 0x02,
-    0x90, 0x80, 0x92, 0x22, 0x14, 0x99, 0x34, 0x34, 0x29, 0x28, 0x88, 0x5D, 0xB8, 0x49, 0x41, 0x66,
-    0xD8, 0x95, 0xC0, 0x05, 0x85, 0x8B, 0x28, 0x30, 0x0C, 0x45, 0x0A, 0x84, 0x09, 0x21, 0x38, 0x85,
-    0x85, 0x23, 0x06, 0x79, 0x91, 0x74, 0xF3, 0x7D, 0xE7, 0x4A, 0x7A, 0xCF, 0x4B, 0x70, 0xC2, 0xCC,
-    0xFA, 0xE5, 0xF9, 0xE9, 0xBE, 0xB7, 0x7A, 0xBA, 0xE7, 0x9C, 0x7B, 0xEE, 0xF9, 0xF9, 0xCE, 0xB9,
-    0x96, 0xB0, 0x14, 0x53, 0x8B, 0x69, 0xC4, 0x54, 0x12, 0xE7, 0xE2, 0x5E, 0x4F, 0x89, 0x14, 0x22,
-    0x23, 0xDF, 0xDE, 0x20, 0x7E, 0xCF, 0x77, 0xD0, 0x4B, 0xD8, 0x49, 0x84, 0x77, 0x2B, 0x71, 0x23,
-    0x49, 0xC3, 0x49, 0xE7, 0xD2, 0x69, 0x46, 0x27, 0xE2, 0xB5, 0x22, 0xDF, 0x1E, 0x53, 0x29, 0x6C,
-    0xE5, 0x5B, 0x5B, 0x86, 0xF6, 0x52, 0x1A, 0xE3, 0x36, 0x1E, 0x24, 0x6D, 0xC9, 0x4A, 0x10, 0xE5,
-    0x95, 0x4F, 0x17, 0xBE, 0x67, 0xF5, 0x03, 0x62, 0x6C, 0x2F, 0x09, 0xAE, 0xC0, 0xE2, 0xE1, 0x21,
-    0x5D, 0x48, 0xC9, 0xAE, 0xCC, 0xAF, 0xD0, 0xBE, 0x84, 0x67, 0x2D, 0x6E, 0x5A, 0xDB, 0xC8, 0xCA,
-    0xFE, 0xAE, 0x16, 0x1F, 0xC2, 0x51, 0x24, 0xFC, 0xA8, 0x03, 0x26, 0x51, 0x30, 0x01, 0xE7, 0xD6,
-    0x0D, 0x01, 0x9F, 0xF5, 0xB2, 0x8F, 0x52, 0xC7, 0x5E, 0x0C, 0xF8, 0x29, 0xE3, 0x15, 0xA7, 0xC6,
-    0xE3, 0xC5, 0x3F, 0x80, 0xAD, 0x1D, 0xC1, 0xDF, 0x0E, 0x1C, 0x7A, 0xB9, 0x47, 0x56, 0x69, 0x72,
-    0xF0, 0xD7, 0x1A, 0x7F, 0xD4, 0x91, 0xB5, 0x79, 0x54, 0x67, 0x79, 0x54, 0x46, 0x65, 0xAC, 0x23,
-    0xFE, 0x55, 0x49, 0x1E, 0x8E, 0x36, 0xC5, 0xB4, 0x8A, 0xCF, 0x7C, 0x6B, 0xC7, 0x27, 0x4D, 0x89,
-    0x1A, 0x2C, 0x0E, 0xCC, 0x6D, 0x1A, 0xB6, 0x2B, 0x2B, 0x41, 0xA7, 0x0A, 0xC3, 0x0D, 0xBF, 0x87,
-    0xA2, 0x56, 0x03, 0x38, 0x7B, 0x43, 0x01, 0x39, 0x2C, 0x39, 0x5B, 0xCA, 0x5B, 0x40, 0xDE, 0x18,
-    0x4A, 0xA2, 0x08, 0xB9, 0x9C, 0x2B, 0xDE, 0xC5, 0xBD, 0x0C, 0xB2, 0x3D, 0x68, 0xAF, 0x73, 0xA5,
-    0x16, 0x4F, 0xF0, 0x61, 0x0F, 0x5F, 0x9C, 0xBC, 0xAB, 0x81, 0x9C, 0x8E, 0xD6, 0xAF, 0x5F, 0xC8,
-    0x97, 0x6F, 0x9C, 0xA5, 0xAA, 0x6A, 0xD5, 0x94, 0x7D, 0xB9, 0xF1, 0x46, 0xB9, 0xCF, 0x53, 0x8E,
-    0x20, 0x9C, 0x75, 0x24, 0x29, 0xFE, 0x60, 0xCB, 0xA0, 0x31, 0x65, 0x54, 0xC7, 0x65, 0xD4, 0xC4,
-    0x65, 0xD8, 0x99, 0xDC, 0x27, 0x3B, 0x4A, 0x15, 0xF7, 0x13, 0x33, 0x2B, 0x2F, 0x61, 0xE2, 0xD1,
-    0xA5, 0x01, 0x53, 0x5A, 0x39, 0xA0, 0xF6, 0xB1, 0x19, 0xF1, 0xA3, 0xB5, 0xB9, 0xDA, 0x9A, 0x17,
-    0x9B, 0xC4, 0xAF, 0xA6, 0x8D, 0x59, 0x71, 0xCF, 0x24, 0x19, 0xC9, 0x61, 0x90, 0x00, 0x2B, 0xAE,
-    0x45, 0x0E, 0x25, 0xCC, 0x0F, 0xBA, 0x44, 0x62, 0xCF, 0xF6, 0x61, 0xFE, 0x70, 0x50, 0x9F, 0xF5,
-    0xCB, 0xF3, 0x51, 0x29, 0xAB, 0xEA, 0xD7, 0x51, 0x2A, 0x5E, 0xFD, 0xC7, 0x18, 0x0B, 0x6B, 0x38,
-    0x4A, 0xE3, 0xBE, 0xBB, 0xFB, 0xE7, 0xA3, 0x1C, 0xCF, 0x9C, 0x0F, 0x2A, 0xF1, 0xCB, 0xC4, 0xC7,
-    0xDC, 0x32, 0x4A, 0x8B, 0x2E, 0x96, 0xA0, 0xF6, 0xE4, 0x19, 0xDA, 0xE1, 0x0A, 0xCC, 0xCC, 0xF5,
-    0x02, 0xCC, 0xBF, 0x61, 0x55, 0x1D, 0x3B, 0x93, 0x14, 0x5D, 0x1B, 0xD9, 0x06, 0x82, 0x65, 0x7E,
-    0x73, 0xE8, 0xD7, 0x43, 0x50, 0x61, 0xEE, 0x10, 0x97, 0x85, 0xCD, 0xCD, 0xFB, 0xA9, 0x87, 0x27,
-    0xEE, 0x93, 0x54, 0x9E, 0x81, 0x51, 0xD9, 0x1F, 0x0F, 0xFE, 0x18, 0x75, 0x51, 0x6F, 0x1A, 0xD3,
-    0xD8, 0xB2, 0x78, 0xD3, 0x8A, 0x7D, 0x61, 0x94, 0xEC, 0x0D, 0x0B, 0x1B, 0xC1, 0xC6, 0x36, 0x05,
-    0xB4, 0x62, 0xCA, 0xB0, 0x4E, 0x72, 0x4F, 0xCE, 0x70, 0x23, 0xBA, 0xF9, 0x3A, 0xB7, 0xFF, 0x13,
-    0x1A, 0xE6, 0x89, 0x4B, 0xF6, 0x1E, 0xBC, 0x98, 0x1A, 0xF0, 0xB1, 0x69, 0x66, 0xE5, 0xBF, 0x68,
-    0xE5, 0x05, 0x5B, 0x41, 0x2B, 0xBE, 0xED, 0xA0, 0x15, 0xBF, 0x3A, 0x84, 0x56, 0xFC, 0xEA, 0x61,
-    0x68, 0x05, 0x23, 0xB4, 0xE2, 0x57, 0xAF, 0x43, 0x2B, 0x3E, 0x14, 0xCE, 0xB1, 0x82, 0x56, 0xFC,
-    0xB7, 0x1B, 0x68, 0xC5, 0xAF, 0x3A, 0x68, 0xC5, 0xAF, 0x9E, 0xA6, 0x56, 0xAA, 0x47, 0xA0, 0x95,
-    0xC7, 0xAA, 0xF8, 0x02, 0xB4, 0x22, 0x77, 0xD6, 0x0A, 0x4D, 0xAB, 0xE1, 0x45, 0x53, 0xA5, 0xB3,
-    0x8C, 0xB8, 0x53, 0x66, 0x97, 0xEB, 0x43, 0xBF, 0xE9, 0x57, 0x7C, 0x1F, 0xC1, 0x12, 0x6C, 0x15,
-    0xDB, 0xDC, 0x7B, 0x15, 0xB3, 0x60, 0x9F, 0xD8, 0xA4, 0x93, 0xD7, 0x53, 0x97, 0x8F, 0x5F, 0x59,
-    0x54, 0x70, 0xE1, 0xA3, 0xBD, 0xFF, 0xF4, 0x0C, 0x5F, 0x9B, 0xAA, 0x92, 0x03, 0x04, 0x80, 0x0E,
-    0x3B, 0xE8, 0x3D, 0x07, 0x81, 0x34, 0x78, 0xC0, 0x45, 0x4C, 0x09, 0x9B, 0x0A, 0x5B, 0x08, 0xD1,
-    0x1A, 0x0A, 0xD5, 0x78, 0x45, 0x8E, 0x6D, 0x0B, 0x6F, 0xB4, 0x9E, 0x0F, 0x15, 0x35, 0xDE, 0x65,
-    0xCC, 0x92, 0x15, 0xC2, 0x42, 0x54, 0xE1, 0x7D, 0x2B, 0x2B, 0xE1, 0x1A, 0xD9, 0x2D, 0xA5, 0xBE,
-    0x4F, 0x7F, 0x47, 0xE8, 0x49, 0x60, 0xDC, 0x29, 0xCD, 0x1C, 0xD4, 0xD4, 0xEB, 0xE0, 0x5F, 0x45,
-    0x8E, 0x01, 0x7B, 0x57, 0x63, 0x30, 0x15, 0x3C, 0x06, 0x8C, 0x2C, 0x7E, 0x82, 0x25, 0x17, 0xB9,
-    0x3F, 0xC0, 0xFA, 0xC1, 0xDF, 0xA6, 0x41, 0x0F, 0xD7, 0x0C, 0x7B, 0xB0, 0x08, 0xC7, 0x18, 0xC4,
-    0xE8, 0xF5, 0x91, 0x1D, 0x7A, 0xB8, 0x61, 0xD3, 0x93, 0xF0, 0x1C, 0x26, 0x96, 0x58, 0x91, 0xCD,
-    0x01, 0x03, 0xB3, 0x97, 0x9D, 0xB5, 0x3D, 0x66, 0xF6, 0xC6, 0x8E, 0xAF, 0xC3, 0xCB, 0xCE, 0xC3,
-    0x3D, 0xCE, 0xDB, 0x13, 0x17, 0xEF, 0xF1, 0x37, 0x83, 0x2B, 0xC6, 0x15, 0xE0, 0x92, 0xB3, 0xB8,
-    0xE4, 0x7F, 0xBD, 0x5E, 0xF9, 0x9E, 0x97, 0xC6, 0x0D, 0x4D, 0xD4, 0x54, 0x3B, 0x12, 0x96, 0x71,
-    0x1D, 0x74, 0xAB, 0xEE, 0xE5, 0xCE, 0x36, 0xB0, 0xA8, 0x7B, 0x73, 0x08, 0xE6, 0xDB, 0x32, 0x51,
-    0xA3, 0xFB, 0x8E, 0xD1, 0x48, 0xED, 0x82, 0xF5, 0x20, 0x5E, 0x2F, 0xAB, 0x9E, 0x16, 0xB1, 0xE2,
-    0x0A, 0xCB, 0xE4, 0xFD, 0xCA, 0x04, 0xF5, 0xB3, 0x41, 0x7D, 0x18, 0x56, 0x87, 0x51, 0xF5, 0x6C,
-    0x5C, 0x62, 0x4A, 0x8C, 0xC7, 0xB0, 0x9E, 0x5D, 0x2F, 0x0D, 0x34, 0x00, 0x24, 0x55, 0x80, 0x30,
-    0xE5, 0x0F, 0x11, 0x62, 0x17, 0x62, 0xA9, 0x7D, 0xAC, 0xE7, 0x67, 0x30, 0x24, 0x4D, 0xDC, 0x66,
-    0x95, 0xA9, 0x6D, 0x5A, 0xC0, 0x45, 0x12, 0x84, 0xE5, 0x33, 0xF0, 0x23, 0xB9, 0x3F, 0x95, 0x23,
-    0x6A, 0x04, 0xAC, 0x42, 0x9B, 0x62, 0xE7, 0x60, 0xF7, 0x51, 0xCD, 0xD8, 0x92, 0x94, 0xF2, 0x43,
-    0xF8, 0x92, 0x50, 0x10, 0xEC, 0xBB, 0xD7, 0xFB, 0xB0, 0xCC, 0x55, 0x1F, 0x36, 0xF7, 0xE7, 0xAB,
-    0x3E, 0x2E, 0x21, 0x75, 0x67, 0x7E, 0x64, 0x4B, 0xBF, 0x1D, 0x7D, 0x9B, 0x07, 0x37, 0xA1, 0xC8,
-    0x54, 0x60, 0x81, 0x98, 0x10, 0x55, 0x87, 0x18, 0xCD, 0xF3, 0x2D, 0x97, 0xE2, 0x1F, 0xC3, 0x20,
-    0x7B, 0x44, 0x6F, 0x3C, 0xF9, 0x8D, 0x4B, 0x8C, 0xC2, 0x5C, 0x16, 0x88, 0xD3, 0xD0, 0x4F, 0x70,
-    0x6F, 0x94, 0x7B, 0xA5, 0xDC, 0xF3, 0xAF, 0xE0, 0x5E, 0x90, 0xFB, 0x55, 0xDB, 0x80, 0xFB, 0xE3,
-    0xB0, 0x4A, 0x70, 0x7F, 0xAC, 0x07, 0x77, 0xC1, 0xEF, 0x41, 0xC3, 0x37, 0xE6, 0xC7, 0x95, 0x98,
-    0x5C, 0x10, 0xA2, 0x0B, 0x1A, 0x2B, 0x88, 0xC7, 0xC8, 0x30, 0x5C, 0x5A, 0xAD, 0x4B, 0xAB, 0xC1,
-    0x1D, 0x31, 0x1F, 0x06, 0x2B, 0x61, 0x15, 0x22, 0xAD, 0x24, 0x65, 0xF0, 0xCF, 0x0E, 0xCC, 0x3C,
-    0xC8, 0x04, 0x66, 0x7E, 0x0B, 0x62, 0xDE, 0xE5, 0x3A, 0x64, 0x72, 0x92, 0xB8, 0xA4, 0x15, 0x1B,
-    0xE8, 0x38, 0xAC, 0xC7, 0xD5, 0xAB, 0x12, 0x5E, 0xEB, 0xC3, 0xFE, 0x4F, 0x07, 0xEF, 0x35, 0x71,
-    0x57, 0xD8, 0xDF, 0x54, 0x59, 0x9B, 0x0D, 0x49, 0xCE, 0x64, 0x96, 0xF9, 0x9F, 0x23, 0x37, 0xF6,
-    0xD1, 0xD5, 0x06, 0x14, 0x92, 0x27, 0x6A, 0x3C, 0x9F, 0x5D, 0xEE, 0x84, 0x81, 0xAB, 0x17, 0x93,
-    0x5E, 0x2C, 0xFE, 0xC1, 0x5D, 0x4D, 0x4A, 0x6C, 0x29, 0x97, 0xA7, 0x2F, 0x4B, 0x23, 0x4C, 0xC9,
-    0xC6, 0x25, 0x87, 0x9F, 0x2F, 0x49, 0x92, 0x0B, 0x62, 0xB0, 0xA1, 0xAF, 0x21, 0xB1, 0xE2, 0x11,
-    0x78, 0x12, 0xE6, 0x9B, 0x76, 0xCA, 0xBD, 0x39, 0x33, 0xC1, 0x19, 0x29, 0xDE, 0x7D, 0x1D, 0x0B,
-    0x63, 0x30, 0x18, 0x35, 0x5B, 0xB8, 0x97, 0xB7, 0x47, 0x0A, 0x8C, 0x1F, 0x9A, 0x32, 0x68, 0x51,
-    0x13, 0xD3, 0x9D, 0xD9, 0xF8, 0x7D, 0xBA, 0x41, 0xC8, 0xA0, 0x16, 0x71, 0x40, 0x30, 0x01, 0xF1,
-    0x1B, 0xA4, 0x7C, 0x80, 0xC1, 0x72, 0x87, 0x06, 0x0C, 0x48, 0x7A, 0x15, 0xFC, 0x1C, 0x43, 0xDC,
-    0x40, 0x8D, 0xA6, 0xC2, 0x90, 0x5D, 0xBF, 0x0C, 0xF7, 0x44, 0x2C, 0xF2, 0x38, 0xF8, 0x1C, 0x02,
-    0x06, 0x05, 0xA2, 0x89, 0x06, 0xEE, 0x1B, 0xB5, 0xC0, 0x20, 0x51, 0x0B, 0x31, 0x35, 0x91, 0x7B,
-    0xFB, 0x8C, 0x57, 0xC3, 0x94, 0xD2, 0xA7, 0xCC, 0x4D, 0x11, 0xF6, 0x64, 0xEB, 0xB2, 0x28, 0xC2,
-    0xC1, 0x96, 0x0B, 0x23, 0xB3, 0x44, 0xD7, 0x7A, 0x26, 0xEA, 0x91, 0xB9, 0xF6, 0xDC, 0xD6, 0x65,
-    0xD1, 0x57, 0xD0, 0x21, 0x5B, 0x22, 0x6A, 0x51, 0x21, 0x46, 0x11, 0xC5, 0x79, 0xFD, 0xF1, 0xAC,
-    0xA4, 0x72, 0x9B, 0x7A, 0x9C, 0x4C, 0x4E, 0x28, 0x27, 0x95, 0x13, 0xCB, 0xC9, 0xA5, 0x82, 0x39,
-    0xC9, 0x9C, 0x68, 0x4E, 0x36, 0x27, 0x9C, 0x93, 0xCE, 0x89, 0xA7, 0xF2, 0x89, 0x0A, 0x28, 0x2A,
-    0xA1, 0xA8, 0x88, 0x8A, 0x04, 0x1B, 0x51, 0x21, 0x45, 0xA5, 0x94, 0x59, 0xCC, 0xA0, 0x7A, 0x0D,
-    0x6C, 0x6F, 0x0E, 0x93, 0xBA, 0xC2, 0xB2, 0x95, 0x8D, 0xD7, 0x16, 0xB7, 0x4E, 0x1D, 0x06, 0x6B,
-    0x5A, 0x7D, 0xC1, 0xFD, 0xAB, 0xE6, 0x41, 0xFF, 0x14, 0x55, 0xC8, 0x99, 0xED, 0x4B, 0x85, 0x94,
-    0xAC, 0xAC, 0xB3, 0xE9, 0x13, 0x1F, 0xE4, 0xB8, 0xE2, 0x67, 0x4A, 0x4C, 0x9B, 0x39, 0x50, 0xD9,
-    0x69, 0xEA, 0x01, 0x7C, 0x76, 0xD9, 0x27, 0xAB, 0xDC, 0xA7, 0x7D, 0xCE, 0x5E, 0x7C, 0x95, 0x8F,
-    0xAF, 0x98, 0x69, 0xE1, 0xB2, 0x2B, 0xAB, 0x86, 0x89, 0xCC, 0x46, 0x2B, 0x8D, 0xC7, 0x4B, 0xC4,
-    0x97, 0x0E, 0xD0, 0x72, 0xAF, 0xDD, 0x27, 0x45, 0x23, 0x73, 0xA6, 0xD1, 0xD6, 0x81, 0xE6, 0xE8,
-    0xF8, 0x62, 0xAE, 0x58, 0x9E, 0x62, 0x00, 0xCA, 0x27, 0xFC, 0x04, 0x6F, 0xE3, 0xC4, 0xD2, 0x57,
-    0x01, 0x38, 0x1F, 0x92, 0xAE, 0x62, 0x08, 0x3B, 0x16, 0xCC, 0x3C, 0xAB, 0x3C, 0xA0, 0xD5, 0x45,
-    0xA4, 0x1B, 0xB7, 0xE2, 0x10, 0x3E, 0x4D, 0x60, 0x33, 0x83, 0x66, 0xCB, 0xE0, 0xEE, 0xE9, 0xAF,
-    0x2D, 0x12, 0x48, 0x3C, 0xFE, 0xAC, 0x61, 0xF6, 0x55, 0x63, 0x62, 0xA4, 0x22, 0xBA, 0x24, 0x98,
-    0xD1, 0xB8, 0xE5, 0x20, 0xBD, 0xC7, 0xE1, 0xA7, 0x33, 0x4E, 0x76, 0x64, 0x64, 0x5F, 0xE6, 0x4C,
-    0x9C, 0xA9, 0x41, 0x53, 0xC8, 0x88, 0xBF, 0x78, 0xB3, 0xDD, 0x1B, 0x2A, 0x52, 0x87, 0x8C, 0xAA,
-    0x2C, 0x14, 0xD7, 0x2E, 0xF9, 0xDB, 0xCA, 0x8C, 0xA7, 0xED, 0xC5, 0x57, 0x96, 0x3A, 0x61, 0x12,
-    0x23, 0x58, 0x17, 0x11, 0x73, 0x25, 0x41, 0xD3, 0xC6, 0x40, 0x2D, 0xA9, 0x6A, 0xD6, 0xD4, 0x29,
-    0x4C, 0x4A, 0x62, 0xE9, 0x14, 0x32, 0xF5, 0x71, 0x15, 0x68, 0x8E, 0x09, 0x5B, 0x94, 0x65, 0x87,
-    0x75, 0x92, 0xE1, 0x1C, 0xC2, 0x3F, 0xBF, 0x47, 0x5C, 0x88, 0x6A, 0x64, 0xB3, 0x9D, 0x25, 0x72,
-    0x6F, 0x4D, 0x16, 0xAF, 0x7D, 0x88, 0x12, 0x00, 0xA2, 0xA9, 0x18, 0x5E, 0xF3, 0xC8, 0xA6, 0xE3,
-    0x6F, 0x4D, 0x0C, 0x6A, 0x84, 0xCF, 0x21, 0x95, 0x13, 0x20, 0x8B, 0xA2, 0x82, 0x69, 0x67, 0x90,
-    0xD2, 0x99, 0xD0, 0x85, 0x53, 0xE2, 0xC1, 0x91, 0xA2, 0xE1, 0x91, 0x9A, 0x56, 0xAA, 0xB5, 0xB3,
-    0x58, 0xE6, 0x9C, 0x75, 0xD6, 0x54, 0x19, 0xBD, 0x29, 0xE7, 0x06, 0x96, 0x6B, 0x71, 0x64, 0x0A,
-    0x86, 0x17, 0xD9, 0x41, 0x5E, 0x62, 0xA9, 0xCB, 0xC9, 0x00, 0x11, 0xE4, 0xE9, 0xED, 0xDE, 0x45,
-    0x7E, 0xB0, 0x3E, 0x9F, 0xD9, 0x1D, 0x37, 0xCC, 0x5B, 0x8D, 0x8C, 0x00, 0x08, 0x7B, 0x53, 0x6E,
-    0xBC, 0x1B, 0xFC, 0xA2, 0xE7, 0x11, 0x1D, 0xDE, 0xEA, 0xC0, 0xAB, 0x65, 0x11, 0xB8, 0x6C, 0xE8,
-    0xDD, 0xE0, 0x65, 0x18, 0x0E, 0x34, 0xAD, 0x65, 0x24, 0x5B, 0x68, 0xDC, 0xC9, 0x33, 0x22, 0x7C,
-    0x68, 0x18, 0x60, 0xAF, 0xF3, 0x08, 0xE3, 0x15, 0xCB, 0x1B, 0xD4, 0x88, 0x18, 0xBA, 0x08, 0x55,
-    0x47, 0x1B, 0x75, 0xC9, 0xF8, 0xFB, 0xB8, 0x45, 0x60, 0x4B, 0x18, 0x79, 0xB3, 0x9A, 0x05, 0x39,
-    0xEA, 0x83, 0xC0, 0xE6, 0xF1, 0xB1, 0xC2, 0x1D, 0x04, 0x40, 0xD8, 0x07, 0x90, 0x9E, 0xED, 0xD6,
-    0x46, 0x89, 0x6C, 0xAA, 0x31, 0x9F, 0xE5, 0x79, 0x42, 0x8B, 0x94, 0x87, 0xB5, 0xA1, 0xB0, 0x91,
-    0x4D, 0x11, 0xB6, 0x00, 0xEC, 0x8C, 0xA6, 0xBB, 0x4C, 0x53, 0x5F, 0x31, 0x10, 0x20, 0x92, 0x68,
-    0x85, 0xC5, 0x73, 0x7D, 0x23, 0x6A, 0x8F, 0x12, 0x45, 0x7E, 0x9E, 0xE5, 0xAC, 0xF7, 0x51, 0x78,
-    0xF4, 0x18, 0x53, 0xBF, 0x4F, 0x6A, 0x36, 0x04, 0xA2, 0x46, 0xC7, 0x4F, 0x59, 0x00, 0x85, 0xB7,
-    0x50, 0x78, 0x34, 0xC1, 0x48, 0x4A, 0xA8, 0x91, 0x40, 0x69, 0xC5, 0x0E, 0x08, 0x2A, 0x97, 0x8E,
-    0x31, 0x04, 0x76, 0x0F, 0x7A, 0x05, 0xEB, 0x25, 0xC9, 0x9A, 0x19, 0x80, 0x98, 0x75, 0x80, 0x6C,
-    0xB5, 0xE2, 0xDD, 0x44, 0x43, 0x5E, 0x41, 0xE5, 0x4F, 0x4E, 0x00, 0x4D, 0x1D, 0x17, 0x2D, 0x10,
-    0x76, 0xDC, 0x23, 0x4C, 0x87, 0x3D, 0xC2, 0x74, 0x30, 0x20, 0x4C, 0xFB, 0x00, 0xF4, 0x18, 0x40,
-    0x08, 0x43, 0x05, 0x8F, 0xC2, 0x10, 0xF6, 0x08, 0xAD, 0x91, 0x0E, 0x1D, 0xFE, 0x4C, 0x1A, 0xFC,
-    0x9A, 0xD5, 0xA6, 0xF5, 0xA0, 0xB8, 0xF1, 0x49, 0x9B, 0x46, 0xEC, 0x8F, 0xA8, 0x2B, 0x62, 0x37,
-    0xF2, 0xA5, 0x25, 0xE3, 0x22, 0x4E, 0x3D, 0x75, 0x16, 0xB4, 0x63, 0xA0, 0x52, 0x2D, 0x81, 0x78,
-    0xCB, 0x02, 0x29, 0x5C, 0x8C, 0xAC, 0x86, 0x18, 0x9A, 0x17, 0xB2, 0xB3, 0xDF, 0x61, 0xCB, 0xBC,
-    0xDD, 0xD9, 0x0B, 0xB7, 0xAD, 0x21, 0x4D, 0xDC, 0x2F, 0x3D, 0xCD, 0x8E, 0x4F, 0xC7, 0xDC, 0x8B,
-    0xBA, 0xA0, 0x06, 0x0D, 0x2F, 0xDD, 0xF9, 0xFF, 0x68, 0xE8, 0xA1, 0x00, 0xAE, 0x55, 0x3C, 0xC1,
-    0xF0, 0x84, 0x82, 0x06, 0x26, 0x9E, 0x6F, 0xC4, 0xE5, 0xAD, 0xCA, 0x72, 0x06, 0x79, 0xE9, 0x11,
-    0x89, 0x53, 0x78, 0x4A, 0x99, 0x7C, 0x00, 0x7F, 0x86, 0xED, 0xFB, 0xC4, 0x01, 0x60, 0xEF, 0xC1,
-    0xD7, 0xD9, 0x05, 0x8C, 0xFF, 0x85, 0x42, 0x0E, 0x3E, 0x94, 0xA1, 0x00, 0x79, 0x40, 0xEE, 0x5D,
-    0x04, 0xFD, 0x2E, 0x45, 0x3D, 0x24, 0x20, 0xE9, 0x29, 0x2A, 0xFC, 0xFB, 0x56, 0xD1, 0x01, 0xB8,
-    0x25, 0xA8, 0x56, 0xA5, 0xE8, 0x19, 0x1A, 0x06, 0x54, 0xB2, 0x9F, 0x43, 0xD4, 0xE8, 0x43, 0x88,
-    0x9A, 0x5C, 0x81, 0xA8, 0x19, 0x3C, 0xF1, 0x8D, 0x1E, 0xF2, 0x5E, 0x41, 0x6C, 0x30, 0x7F, 0x46,
-    0x58, 0x00, 0xAC, 0x43, 0x75, 0x0D, 0xB7, 0xAD, 0x91, 0x35, 0x37, 0x45, 0x4D, 0x48, 0x33, 0xA3,
-    0xA8, 0x0F, 0x78, 0x6B, 0x2C, 0xAD, 0xB8, 0xA3, 0x28, 0xE7, 0x3A, 0x24, 0xD2, 0x5E, 0x0A, 0x3D,
-    0x71, 0xD9, 0x6B, 0x14, 0xA2, 0x03, 0xA2, 0x92, 0x76, 0x18, 0x30, 0x40, 0x6D, 0x1D, 0x60, 0x41,
-    0xA4, 0x43, 0x8B, 0xD4, 0x15, 0x37, 0x73, 0x54, 0x32, 0x8C, 0x4A, 0xA6, 0xD2, 0x6E, 0x48, 0xCC,
-    0xFE, 0x05, 0x94, 0x8A, 0x52, 0x91, 0x21, 0x0E, 0x0A, 0x64, 0xFF, 0x02, 0x24, 0x4C, 0xC3, 0x56,
-    0xCD, 0x78, 0xD0, 0x73, 0x53, 0xB4, 0x8F, 0xC9, 0x7D, 0x1B, 0xD7, 0x0E, 0xE6, 0x4A, 0x92, 0x72,
-    0xCA, 0x97, 0xCC, 0x72, 0x4E, 0xAA, 0xA5, 0x52, 0xDB, 0xB2, 0x40, 0x4C, 0x7F, 0x92, 0x68, 0xA2,
-    0x65, 0x79, 0x3A, 0x00, 0x7C, 0x84, 0x2D, 0xA0, 0xD9, 0x4E, 0x3A, 0xAB, 0x71, 0xCB, 0x02, 0x3D,
-    0xCD, 0x98, 0x3E, 0x22, 0x98, 0x7A, 0x23, 0xF7, 0xEC, 0xB5, 0x38, 0xDD, 0x30, 0xF7, 0x6D, 0x2B,
-    0x67, 0x77, 0x46, 0xC8, 0x8A, 0xEB, 0xED, 0x54, 0xA8, 0x2F, 0x00, 0x81, 0x56, 0x45, 0x7A, 0x20,
-    0x95, 0xD4, 0x80, 0xE7, 0x71, 0x13, 0xF5, 0x4B, 0xDD, 0xC0, 0x5A, 0x03, 0xA6, 0x17, 0xDC, 0xB2,
-    0xAC, 0x50, 0x08, 0xEF, 0x98, 0xBB, 0x56, 0xF4, 0x17, 0x4F, 0x91, 0x80, 0xC3, 0x4F, 0x6B, 0xE8,
-    0x34, 0xB7, 0x8B, 0x15, 0x96, 0xAA, 0x65, 0xAC, 0xA1, 0xD3, 0x26, 0x3A, 0xD7, 0x32, 0xF0, 0x13,
-    0xB6, 0xA4, 0x5D, 0x57, 0x7D, 0xD0, 0x3A, 0x04, 0x54, 0x56, 0x36, 0x05, 0x15, 0x9B, 0x43, 0x12,
-    0x3B, 0x77, 0xCF, 0x3C, 0x76, 0xCF, 0x90, 0xA9, 0x43, 0x3A, 0x49, 0xC4, 0x3C, 0x1A, 0x31, 0x8F,
-    0xC6, 0xF6, 0x93, 0x09, 0x85, 0x9D, 0xE8, 0x9E, 0xCD, 0x6B, 0xF7, 0xB4, 0x3A, 0xD5, 0x67, 0xB5,
-    0x19, 0x09, 0xBE, 0x4D, 0xD2, 0xD2, 0x99, 0x88, 0xCE, 0xE0, 0x74, 0x64, 0x4D, 0xDD, 0x78, 0x96,
-    0xAE, 0xBF, 0xB2, 0x21, 0x90, 0x81, 0x3F, 0xB2, 0x0D, 0x8D, 0x20, 0xC3, 0x6A, 0xAD, 0xE7, 0x08,
-    0xDF, 0xED, 0xB8, 0x04, 0x46, 0xF8, 0xA8, 0x0B, 0x08, 0x7C, 0x5A, 0x96, 0x75, 0x60, 0x8D, 0xBD,
-    0x48, 0xDC, 0x78, 0x8D, 0x55, 0x82, 0x79, 0x47, 0xA3, 0xD8, 0x3B, 0x84, 0x97, 0xD9, 0x9B, 0x54,
-    0x55, 0x51, 0xEE, 0xCC, 0x5A, 0x52, 0xB8, 0x2E, 0xBF, 0xB4, 0xAE, 0xAE, 0x91, 0xB9, 0xB8, 0x90,
-    0xA2, 0x5A, 0x92, 0xDA, 0x02, 0x1A, 0xA9, 0xB3, 0xA3, 0x35, 0x68, 0x34, 0xCD, 0x91, 0x67, 0xFB,
-    0x11, 0x7B, 0x3B, 0x44, 0xD8, 0xE9, 0x58, 0x1B, 0xC8, 0x21, 0x62, 0x5E, 0xD8, 0xB1, 0xF1, 0xCF,
-    0xA6, 0x71, 0x01, 0x0B, 0xA1, 0x6D, 0x14, 0x65, 0x56, 0x15, 0x7F, 0xB7, 0x25, 0xD1, 0x4B, 0x62,
-    0x8B, 0x32, 0xA4, 0x37, 0xA4, 0x73, 0x87, 0x25, 0x9A, 0x41, 0x62, 0xEE, 0x80, 0xE9, 0xEE, 0x29,
-    0xD2, 0xBF, 0x0D, 0x14, 0xB6, 0xB7, 0x81, 0xC2, 0x53, 0xA1, 0xAF, 0x07, 0x31, 0x6D, 0xCC, 0x24,
-    0x7B, 0x44, 0x4F, 0xEF, 0xE9, 0x58, 0xAD, 0x36, 0x12, 0x65, 0x59, 0x86, 0x90, 0x0F, 0x9D, 0x00,
-    0xCE, 0x44, 0x9F, 0x20, 0x2B, 0x21, 0x2F, 0x21, 0x33, 0x77, 0x4C, 0x42, 0x76, 0x52, 0x68, 0xEB,
-    0x96, 0xCE, 0x44, 0x8E, 0x42, 0x96, 0x0E, 0xF1, 0x91, 0xA9, 0x28, 0x57, 0xC7, 0x56, 0xC1, 0xE7,
-    0x15, 0x40, 0xA3, 0x13, 0xE0, 0xF3, 0x54, 0xD6, 0x74, 0xD6, 0x75, 0xD3, 0x02, 0x14, 0xFA, 0xE1,
-    0x0B, 0x95, 0x5E, 0xFC, 0xCE, 0x7B, 0xDA, 0x65, 0x3E, 0x4D, 0xDD, 0x81, 0xD2, 0xA1, 0xAD, 0x91,
-    0xA2, 0x90, 0xBE, 0x02, 0x16, 0xFB, 0x43, 0x34, 0x1C, 0xD8, 0x47, 0xC7, 0xB8, 0x8D, 0x06, 0xC4,
-    0xA9, 0x9A, 0x11, 0x08, 0xC1, 0xA6, 0x3B, 0xE8, 0x41, 0x17, 0x6E, 0x59, 0x70, 0xCC, 0x0B, 0xA0,
-    0xD7, 0xDF, 0xC2, 0x5E, 0xE8, 0x08, 0xA0, 0xCF, 0xF1, 0x9A, 0xED, 0x3C, 0x9E, 0x3F, 0xC1, 0xAF,
-    0xC0, 0x05, 0x23, 0xF8, 0x18, 0x48, 0x9C, 0x2E, 0x00, 0x2C, 0xB1, 0xB9, 0xC7, 0xFE, 0x29, 0xCF,
-    0xB0, 0xC6, 0x27, 0x53, 0xFA, 0x1C, 0xAD, 0x2E, 0xFB, 0xAA, 0x53, 0xB8, 0xCF, 0x7E, 0xA5, 0xA7,
-    0x70, 0xB1, 0xE6, 0xE2, 0x56, 0x4F, 0xE0, 0x78, 0xDE, 0xE4, 0x69, 0x8B, 0x29, 0x95, 0x7B, 0x0A,
-    0xF6, 0x15, 0xA6, 0xB2, 0x4B, 0xFD, 0xA4, 0x75, 0x71, 0xE5, 0xA4, 0x9F, 0xC4, 0x90, 0x02, 0xF1,
-    0x8F, 0x25, 0x5B, 0x34, 0x44, 0x2D, 0x22, 0x69, 0xCB, 0x18, 0x6A, 0xFE, 0x52, 0x34, 0xD4, 0x09,
-    0x8F, 0xB4, 0x8A, 0xEB, 0xE9, 0xC6, 0xE9, 0x5F, 0xC8, 0x3C, 0xCE, 0x08, 0x01, 0x95, 0xDF, 0x9A,
-    0x4E, 0x2E, 0xB4, 0x98, 0x6A, 0x5D, 0x28, 0x61, 0xA7, 0xB3, 0x5F, 0xC7, 0xCA, 0x53, 0xA1, 0xBF,
-    0x2F, 0x93, 0x9F, 0x20, 0x5E, 0x5C, 0x65, 0xF1, 0xD4, 0xC1, 0x0D, 0xF7, 0x4E, 0x8D, 0x7E, 0xFC,
-    0x68, 0xA3, 0xFE, 0x67, 0xAE, 0xC2, 0x5E, 0xFD, 0xB5, 0xBD, 0x9E, 0x02, 0x6D, 0x44, 0x10, 0x44,
-    0x64, 0xF6, 0x67, 0x0B, 0xDD, 0x97, 0x9D, 0xA9, 0x23, 0xEC, 0xF1, 0x11, 0xB6, 0x76, 0xF0, 0x6B,
-    0xB0, 0x1C, 0xD4, 0xB6, 0xEB, 0x83, 0xDA, 0x84, 0x9D, 0x2A, 0x2D, 0x28, 0x4A, 0x45, 0xCB, 0x01,
-    0x53, 0x1D, 0x8B, 0x97, 0x62, 0x2E, 0x22, 0xBE, 0x2E, 0x11, 0x40, 0x10, 0xB6, 0xBA, 0xDA, 0xE8,
-    0x66, 0x6F, 0xF2, 0xA3, 0xA9, 0x17, 0xFA, 0x35, 0x89, 0x04, 0xD5, 0x6B, 0xD1, 0xA7, 0x03, 0x28,
-    0x04, 0xE5, 0x5C, 0x90, 0x7D, 0x5D, 0x31, 0xB4, 0x73, 0x57, 0x7D, 0x5F, 0x82, 0xE3, 0x01, 0xD9,
-    0xA9, 0x75, 0x3D, 0x6F, 0x6E, 0xEC, 0x8D, 0x46, 0xBE, 0x19, 0xD2, 0x4A, 0x3B, 0x29, 0x3E, 0x44,
-    0xCE, 0x98, 0x8E, 0x6D, 0x5A, 0x03, 0xB4, 0x1A, 0x75, 0x4C, 0x40, 0x70, 0x8D, 0x16, 0x35, 0x65,
-    0xC3, 0x53, 0x3F, 0xA4, 0x72, 0x38, 0xAF, 0x3A, 0x6E, 0x9A, 0x20, 0x74, 0x05, 0xCC, 0xE1, 0x67,
-    0x17, 0x7C, 0x3C, 0xF8, 0x08, 0x0B, 0xF6, 0x06, 0x49, 0x23, 0x93, 0xC4, 0xEC, 0x7E, 0xED, 0xF0,
-    0x28, 0x44, 0x5F, 0x3D, 0xBC, 0xCB, 0xEB, 0x01, 0xA1, 0x57, 0x23, 0xB6, 0xCA, 0xB7, 0xEF, 0x71,
-    0xF0, 0x74, 0x09, 0xC4, 0x17, 0xAC, 0x56, 0x3B, 0x9E, 0xC6, 0xB4, 0xC4, 0x17, 0x0D, 0x06, 0x20,
-    0x54, 0xE2, 0x8B, 0x80, 0x87, 0x4E, 0x1A, 0x17, 0x09, 0x32, 0x96, 0xD3, 0xAC, 0xB5, 0x7F, 0xE9,
-    0xF1, 0x85, 0x1E, 0x67, 0x2C, 0xB2, 0x24, 0x23, 0x8B, 0x89, 0x32, 0x50, 0x1B, 0x3A, 0x68, 0x13,
-    0x14, 0xBD, 0xA6, 0x06, 0x0A, 0x2F, 0xF5, 0xEA, 0x8A, 0x9C, 0x4D, 0x43, 0xC4, 0xA4, 0xDC, 0xC5,
-    0xA3, 0xEC, 0x03, 0x5B, 0xB2, 0x23, 0x12, 0xC1, 0xB6, 0x56, 0xF6, 0x6F, 0x53, 0xB7, 0xF3, 0x0E,
-    0xFE, 0x75, 0x2A, 0xF4, 0x4F, 0xFA, 0x97, 0xBF, 0xF6, 0xAF, 0x53, 0xA1, 0xAF, 0x68, 0xF7, 0x21,
-    0x31, 0xE3, 0xA1, 0xF0, 0x9C, 0xA4, 0x85, 0x4D, 0xCC, 0x29, 0xE8, 0x34, 0xE8, 0x33, 0xC7, 0xA8,
-    0xFF, 0xBE, 0xD8, 0xDC, 0xE6, 0xBF, 0xA7, 0x41, 0xDB, 0x9B, 0x5A, 0x96, 0xEC, 0xAD, 0x6B, 0xC7,
-    0x3D, 0xFF, 0xD2, 0xD9, 0xE9, 0xB9, 0xFD, 0xFD, 0x5D, 0x8D, 0xE3, 0x5F, 0x7E, 0xEE, 0x0C, 0x1B,
-    0xD4, 0x9A, 0x7A, 0x55, 0x14, 0xC6, 0xEA, 0xC7, 0x07, 0x96, 0x68, 0xB4, 0x2E, 0xD4, 0x33, 0x60,
-    0x8C, 0xE1, 0xDA, 0x31, 0xE0, 0xE8, 0xC7, 0x37, 0x31, 0xDC, 0xB8, 0x32, 0x20, 0x13, 0xD0, 0xCE,
-    0x06, 0xE0, 0x8E, 0xB8, 0x4F, 0xB4, 0xEF, 0x5A, 0xB3, 0xE1, 0x9B, 0x8B, 0x29, 0x10, 0x53, 0x7E,
-    0xE0, 0x2D, 0xCB, 0x53, 0x98, 0xAA, 0xCD, 0x35, 0x45, 0x8D, 0x8A, 0x4E, 0xB4, 0x6F, 0xB6, 0xB4,
-    0x34, 0x41, 0x88, 0xB6, 0xEC, 0xB1, 0x07, 0xB3, 0x61, 0xD0, 0x04, 0xCC, 0xCE, 0x96, 0x7B, 0xDA,
-    0x72, 0x47, 0x5B, 0x6E, 0x67, 0xC0, 0x6C, 0x38, 0x64, 0xA8, 0x0A, 0xDF, 0xD6, 0xBE, 0xCB, 0x0D,
-    0x0E, 0x17, 0x60, 0x1B, 0x43, 0x5C, 0x4E, 0xE9, 0xDD, 0x1D, 0x3C, 0x29, 0x63, 0x45, 0x91, 0xDA,
-    0xDB, 0x1D, 0x36, 0xAB, 0xAB, 0xBB, 0xC4, 0x97, 0x1D, 0x5C, 0x86, 0x0B, 0xE1, 0x79, 0x9E, 0x24,
-    0xEF, 0x11, 0x97, 0x32, 0x9F, 0xED, 0xCD, 0xCE, 0x76, 0x77, 0xF8, 0x86, 0xCF, 0x81, 0x11, 0xF1,
-    0x8C, 0x1B, 0xA2, 0x0D, 0x44, 0x73, 0xD7, 0x96, 0xEA, 0x0A, 0xC6, 0xE2, 0x0E, 0x05, 0x63, 0x46,
-    0xA8, 0x4F, 0x53, 0x9E, 0x49, 0x13, 0x55, 0x97, 0x1A, 0x67, 0x31, 0x2D, 0xA9, 0x30, 0x2D, 0x7E,
-    0x1B, 0x61, 0x2F, 0xFE, 0x10, 0x73, 0xA3, 0x8F, 0x29, 0x38, 0x22, 0xAC, 0x62, 0x4D, 0xE8, 0xAF,
-    0x9C, 0x4E, 0x4E, 0xD8, 0xCC, 0x73, 0xC7, 0x76, 0x5A, 0x74, 0xB8, 0xB3, 0xBB, 0x86, 0xFF, 0xA9,
-    0x85, 0x87, 0x29, 0xC4, 0x54, 0x66, 0x98, 0x3B, 0x47, 0x93, 0x23, 0xB7, 0x73, 0x5B, 0xCB, 0xD5,
-    0x11, 0x27, 0x0E, 0x12, 0xAE, 0xF6, 0xCB, 0x7F, 0x86, 0x01, 0x7D, 0xFB, 0x19, 0xE8, 0x20, 0x53,
-    0xBA, 0xE3, 0x7D, 0x77, 0xC6, 0x4F, 0xA9, 0xB1, 0x9E, 0x82, 0x83, 0xCD, 0x19, 0x6E, 0xD3, 0x70,
-    0xE0, 0x19, 0xBF, 0xBD, 0x30, 0x4C, 0xA5, 0xCA, 0x17, 0xD8, 0xDF, 0xF8, 0x26, 0xE6, 0x27, 0xF5,
-    0x7D, 0xB7, 0x51, 0x3F, 0x71, 0xC6, 0xEF, 0x7C, 0xF1, 0x8E, 0xA5, 0xE3, 0xF6, 0xD5, 0xF4, 0x6F,
-    0xCD, 0x5B, 0xBF, 0x93, 0xDD, 0xD4, 0x15, 0xBE, 0xEF, 0x29, 0x8B, 0x66, 0x50, 0xA1, 0x14, 0xDE,
-    0x22, 0x49, 0xA1, 0x9E, 0x02, 0xFD, 0x07, 0x5C, 0x25, 0x14, 0x29, 0x52, 0xB0, 0xC5, 0x6E, 0x32,
-    0x13, 0x0A, 0xFA, 0x90, 0x19, 0xFF, 0x03, 0x09, 0x12, 0x43, 0x97, 0x14, 0xD0, 0xA7, 0x88, 0x0B,
-    0x0A, 0x66, 0x29, 0xFC, 0x0F, 0x60, 0x4B, 0xE0, 0xCC, 0x50, 0x50, 0x20, 0xA0, 0x48, 0x19, 0x91,
-    0x30, 0x49, 0xC6, 0x2E, 0x2C, 0x40, 0x09, 0xB2, 0xD1, 0xD3, 0xCD, 0xF7, 0x9D, 0x73, 0xA5, 0xA7,
-    0x67, 0x7B, 0x9D, 0x75, 0xD8, 0x7D, 0xCE, 0xDA, 0xBA, 0x6B, 0x3F, 0xE9, 0xDD, 0x7B, 0xCE, 0x77,
-    0xCF, 0x3D, 0xBF, 0x65, 0xCC, 0x33, 0xA7, 0xEF, 0x18, 0x13, 0xBB, 0xC1, 0x0F, 0x07, 0x27, 0x47,
-    0x46, 0x7F, 0x02, 0x97, 0x19, 0x13, 0xB9, 0x82, 0x37, 0x30, 0xA4, 0xAE, 0x32, 0xC6, 0xDE, 0xC5,
-    0x50, 0x5E, 0xC5, 0xE0, 0xD2, 0xCA, 0xAC, 0x37, 0x18, 0x82, 0x21, 0xA9, 0x4D, 0xD4, 0x61, 0x48,
-    0xDA, 0xA4, 0x31, 0xB6, 0xC6, 0x90, 0xDF, 0xBE, 0xDE, 0x18, 0xE7, 0x5C, 0xBB, 0xE2, 0x10, 0x70,
-    0x08, 0x07, 0x13, 0xB7, 0x71, 0x8F, 0x21, 0x69, 0x4D, 0xDC, 0xD9, 0x06, 0x43, 0x5E, 0x99, 0xA8,
-    0x37, 0xCF, 0x9E, 0x5E, 0xC3, 0xE4, 0x9D, 0xB1, 0xAE, 0x35, 0x87, 0x7E, 0x75, 0xDB, 0xDE, 0x5C,
-    0xB9, 0x61, 0x0C, 0x9D, 0xDB, 0xC4, 0xE3, 0xD5, 0x21, 0xE9, 0xE3, 0xC1, 0xB6, 0x51, 0x6F, 0xEB,
-    0xA8, 0xCF, 0xAB, 0xB8, 0x2B, 0xAB, 0xB8, 0x2D, 0xAB, 0x04, 0x97, 0x6D, 0xCA, 0x2A, 0xAF, 0xCB,
-    0xBF, 0xBB, 0x2A, 0x77, 0xAE, 0x4A, 0x5D, 0x59, 0x45, 0x1B, 0x5B, 0x98, 0x8C, 0x93, 0x1C, 0x98,
-    0x43, 0x63, 0x92, 0xEC, 0x05, 0x0C, 0xB7, 0x85, 0xBD, 0x9E, 0x4C, 0xD5, 0xB8, 0x73, 0xC5, 0xEC,
-    0x99, 0xC7, 0x43, 0x2C, 0x69, 0xCD, 0x7B, 0xC6, 0xDE, 0xE9, 0x4D, 0x02, 0x3E, 0x43, 0x2E, 0xE4,
-    0xA9, 0xB8, 0x10, 0x5E, 0xF7, 0xC5, 0x08, 0xB0, 0xC4, 0xF4, 0xE6, 0x26, 0xAE, 0x15, 0xFF, 0xB7,
-    0xEE, 0xB8, 0xF8, 0x88, 0xCF, 0x56, 0x5C, 0xD2, 0x94, 0x85, 0x99, 0x7F, 0xBE, 0x33, 0x63, 0x37,
-    0x30, 0x35, 0xE6, 0x8F, 0xB0, 0x65, 0x31, 0x26, 0x8F, 0xEF, 0xE1, 0xDA, 0x60, 0xCD, 0xCD, 0xB4,
-    0xC2, 0x21, 0x79, 0x2F, 0x2B, 0x2E, 0x4E, 0x32, 0xB0, 0xC9, 0x26, 0x6E, 0xB8, 0xF3, 0xD9, 0xF4,
-    0x44, 0x39, 0x66, 0x80, 0x05, 0x88, 0x5B, 0xE7, 0xC0, 0xE5, 0x58, 0x56, 0x81, 0xAB, 0xD6, 0x45,
-    0x38, 0xF2, 0x51, 0x3E, 0x9F, 0x90, 0x81, 0xB4, 0x25, 0xB9, 0xFC, 0xA6, 0xAD, 0xA7, 0x21, 0x9F,
-    0x07, 0xFD, 0x4C, 0xEE, 0x76, 0xE6, 0xFB, 0x26, 0x19, 0x7F, 0x09, 0x50, 0x38, 0x67, 0xC0, 0xC1,
-    0xE4, 0xEE, 0x2D, 0x10, 0x20, 0x72, 0x7B, 0x78, 0xA4, 0x0F, 0x62, 0x0B, 0x48, 0x64, 0xD8, 0x6D,
-    0x49, 0x49, 0x5D, 0x01, 0x7C, 0xB1, 0xBA, 0x2B, 0xE2, 0xF1, 0xE5, 0x2C, 0xED, 0xF4, 0x49, 0x2E,
-    0x90, 0x57, 0xCA, 0x04, 0xB1, 0x93, 0x0B, 0xFF, 0xCE, 0xFF, 0xF5, 0x6B, 0x90, 0x3C, 0x40, 0x58,
-    0x06, 0x2C, 0xD3, 0x79, 0x61, 0x39, 0x38, 0x26, 0xC5, 0x64, 0x3F, 0x07, 0xC3, 0xAB, 0x11, 0x20,
-    0x45, 0x5D, 0x5C, 0x63, 0x91, 0x55, 0xF6, 0x34, 0x18, 0x5E, 0x1D, 0x53, 0xDE, 0xF0, 0x18, 0x18,
-    0x76, 0x49, 0x15, 0xF4, 0x51, 0xBB, 0x3A, 0x52, 0x28, 0x2E, 0x86, 0x61, 0xF9, 0x21, 0x8C, 0x4A,
-    0x7B, 0x4C, 0x91, 0x8B, 0x5A, 0xB3, 0xFC, 0xD9, 0xEF, 0x0E, 0x53, 0xE4, 0x31, 0x69, 0xC8, 0xDD,
-    0xC5, 0xEF, 0xA0, 0xDF, 0x12, 0x72, 0x11, 0x0C, 0x63, 0x91, 0x23, 0x2C, 0x40, 0x16, 0x47, 0x5B,
-    0xE9, 0x36, 0x1B, 0x4B, 0x2E, 0x0E, 0x8E, 0x9E, 0x0A, 0xC3, 0x47, 0xE6, 0xD8, 0x6C, 0xC0, 0x65,
-    0x4E, 0x6D, 0x81, 0x5D, 0x4E, 0x46, 0x2F, 0x85, 0x17, 0xB5, 0xC3, 0xC7, 0xF8, 0x63, 0x46, 0x62,
-    0x6A, 0x5F, 0x6A, 0xBD, 0xE2, 0xA2, 0x48, 0xCD, 0xAB, 0xE0, 0x3B, 0x6F, 0x71, 0x18, 0x49, 0x16,
-    0xEE, 0x96, 0xC2, 0x75, 0x91, 0xB7, 0xC6, 0x65, 0x49, 0x6F, 0x1C, 0x84, 0x02, 0xA7, 0x3F, 0x1A,
-    0xD6, 0x1C, 0x82, 0x91, 0xC3, 0x06, 0x9F, 0x41, 0x19, 0xC4, 0x3D, 0xB6, 0x28, 0xE9, 0xA2, 0x01,
-    0x60, 0x40, 0x72, 0xF2, 0x26, 0xEE, 0x8C, 0x83, 0xC2, 0x09, 0x5D, 0x91, 0xDC, 0xC7, 0x7C, 0xA9,
-    0x83, 0x45, 0x00, 0x88, 0x35, 0x86, 0xC5, 0x3E, 0x9A, 0xFC, 0x16, 0x51, 0xCC, 0x3F, 0x24, 0x8C,
-    0xE5, 0x9B, 0x04, 0xC9, 0xBD, 0x44, 0xDD, 0xE6, 0x9E, 0x35, 0x5E, 0xD3, 0xD8, 0x2F, 0x47, 0xFE,
-    0x6B, 0xC4, 0x48, 0xED, 0x06, 0x8A, 0xA1, 0xDF, 0x08, 0x3C, 0xF1, 0xA7, 0x8E, 0x23, 0xC2, 0x51,
-    0x47, 0x1C, 0xB0, 0xA6, 0xA1, 0xA6, 0x23, 0x0E, 0x89, 0x8C, 0x69, 0xC3, 0x4F, 0x88, 0x52, 0xF9,
-    0xB9, 0xA8, 0x69, 0x72, 0x05, 0x62, 0xA8, 0xAD, 0x23, 0x1E, 0x69, 0xA3, 0x2A, 0xFD, 0x89, 0x18,
-    0x07, 0xB0, 0x1C, 0xFA, 0xB8, 0xCF, 0x5D, 0x17, 0xF7, 0xE9, 0x78, 0xED, 0xC9, 0x19, 0xCF, 0x2B,
-    0xAF, 0x4D, 0x79, 0x5B, 0x06, 0x6C, 0x6F, 0xA7, 0x2C, 0x1F, 0xFC, 0x18, 0x64, 0x94, 0x5F, 0x8D,
-    0x66, 0x4D, 0x7E, 0x21, 0x7E, 0x80, 0x77, 0x93, 0xF8, 0x05, 0x84, 0xD7, 0xBC, 0x82, 0xD4, 0x0A,
-    0xA7, 0x65, 0x21, 0x03, 0xF8, 0x84, 0x6A, 0xAF, 0x95, 0x4B, 0x61, 0x32, 0x75, 0xD7, 0x61, 0x44,
-    0xC6, 0xB4, 0xA0, 0x5C, 0x11, 0xCB, 0xD3, 0x53, 0x5A, 0x2E, 0xE7, 0x87, 0xD5, 0xC9, 0x76, 0xCB,
-    0x21, 0x6A, 0x32, 0x80, 0xF3, 0x8C, 0x9C, 0x8B, 0x4E, 0xC5, 0x40, 0x64, 0xDC, 0xB4, 0x0D, 0x6B,
-    0x77, 0xFA, 0x36, 0xBF, 0xDA, 0xA9, 0xD8, 0xCA, 0xC0, 0x53, 0xA9, 0x86, 0x4A, 0x94, 0x05, 0xE1,
-    0x37, 0xC4, 0xDD, 0x24, 0xF7, 0x4F, 0x0B, 0x72, 0x5E, 0x2D, 0x66, 0x37, 0x3F, 0x84, 0xEF, 0x61,
-    0xE5, 0x28, 0xD1, 0xF7, 0x50, 0xD8, 0x13, 0x2C, 0x02, 0xA8, 0x39, 0x5B, 0xBC, 0x89, 0xBB, 0xA4,
-    0x8D, 0x60, 0x00, 0x61, 0x04, 0x3F, 0x29, 0x5B, 0xEE, 0x43, 0x09, 0x00, 0xCB, 0xDB, 0xD9, 0x56,
-    0xAC, 0x9B, 0x88, 0x93, 0xF1, 0xF8, 0x80, 0xA0, 0x7B, 0x74, 0x3B, 0x40, 0x1E, 0x15, 0x72, 0xD0,
-    0xC0, 0x6A, 0x05, 0x63, 0x99, 0x11, 0x34, 0x42, 0xDB, 0x1B, 0xBD, 0xBB, 0x5F, 0x1E, 0xAF, 0xE0,
-    0x84, 0xFD, 0xD6, 0x60, 0x97, 0xDE, 0xA5, 0x8F, 0xD5, 0xA8, 0x97, 0xE0, 0xB5, 0xC9, 0x45, 0xF0,
-    0xAA, 0x3F, 0x62, 0x77, 0x45, 0xE9, 0xC8, 0x90, 0xD4, 0x4B, 0x1D, 0xBD, 0x37, 0x5E, 0xE5, 0xC7,
-    0x71, 0x26, 0xBD, 0xCC, 0x66, 0x4B, 0xC4, 0x45, 0xF0, 0xBA, 0x3F, 0x46, 0xF8, 0x74, 0xC0, 0xDB,
-    0xF4, 0x7C, 0x4C, 0x22, 0xC3, 0x3F, 0x27, 0x0D, 0x2F, 0x73, 0x5D, 0x0C, 0x63, 0x34, 0x64, 0xAD,
-    0xAE, 0x62, 0x8D, 0xBF, 0xAE, 0x89, 0x59, 0x10, 0x43, 0x0B, 0x41, 0x3E, 0x02, 0x1D, 0xD8, 0xCE,
-    0xF5, 0x00, 0x41, 0x36, 0x4E, 0x9C, 0x8F, 0xCE, 0xFB, 0x3A, 0xFB, 0x16, 0x64, 0xF8, 0xF3, 0x76,
-    0x05, 0x45, 0x94, 0x7E, 0xD4, 0xD1, 0x4A, 0xD4, 0x54, 0xBF, 0x74, 0x3D, 0x4F, 0x96, 0x50, 0x10,
-    0x0B, 0x9D, 0x9E, 0x68, 0x18, 0xC2, 0x61, 0x88, 0x87, 0x21, 0x20, 0x93, 0x2A, 0xA5, 0x36, 0x03,
-    0x26, 0xEA, 0xAF, 0x12, 0x15, 0x81, 0x45, 0x70, 0x11, 0x60, 0x74, 0xCB, 0xBD, 0x7C, 0xCB, 0xFC,
-    0x91, 0x53, 0x93, 0x87, 0xC7, 0x5F, 0xA9, 0xE1, 0x6B, 0x02, 0xB5, 0xD9, 0xD7, 0x51, 0x8B, 0x19,
-    0x79, 0xB5, 0x0A, 0x05, 0x3D, 0x5E, 0x6F, 0xD6, 0x20, 0xEF, 0xAD, 0xD0, 0xCD, 0x46, 0xB9, 0xDF,
-    0x1A, 0x65, 0x44, 0x3C, 0xB6, 0x49, 0x5C, 0x63, 0xEB, 0xD4, 0xD5, 0x39, 0x06, 0x5A, 0x83, 0x5C,
-    0x74, 0x65, 0x01, 0x0B, 0xEA, 0x32, 0xA0, 0xEF, 0x60, 0x6A, 0x5F, 0x76, 0x9C, 0x93, 0xBB, 0xA4,
-    0x46, 0xE0, 0x0B, 0xE3, 0x0F, 0xAE, 0xF8, 0xBD, 0x34, 0xD4, 0x01, 0x35, 0x75, 0xFC, 0x25, 0xAD,
-    0x4E, 0x51, 0xE2, 0x73, 0x22, 0xA4, 0x40, 0x0C, 0x29, 0xF7, 0xC3, 0xD2, 0x42, 0xBB, 0x2C, 0x70,
-    0x7F, 0x70, 0xF0, 0x59, 0x02, 0x6C, 0xFA, 0xB0, 0x1E, 0x81, 0x33, 0x86, 0xA4, 0x85, 0x9D, 0x4C,
-    0xDB, 0x80, 0x3A, 0x3C, 0xF4, 0x8A, 0x3C, 0x6D, 0x61, 0xC4, 0xD3, 0x7B, 0x80, 0x29, 0x11, 0xFC,
-    0xDC, 0xDD, 0x16, 0x8B, 0xA7, 0x5B, 0x2F, 0x42, 0xCC, 0x60, 0x65, 0x5E, 0x7B, 0x19, 0x38, 0xE7,
-    0x4A, 0x14, 0x08, 0xF8, 0x91, 0x1E, 0xBD, 0x63, 0x12, 0x37, 0xAC, 0x69, 0xE4, 0xAE, 0x8B, 0x13,
-    0x51, 0x71, 0x43, 0x8C, 0x99, 0xB5, 0xCD, 0x9E, 0x61, 0x3A, 0xE0, 0xF6, 0xC5, 0x05, 0x44, 0x3A,
-    0xBE, 0x2F, 0x96, 0x7A, 0xE0, 0xB6, 0x92, 0x99, 0x43, 0xF3, 0x14, 0x61, 0x9A, 0x9D, 0x48, 0x13,
-    0xF0, 0x30, 0xD1, 0x95, 0xDC, 0xF1, 0x23, 0xF7, 0x2E, 0x4D, 0x7A, 0x8A, 0xAB, 0xD9, 0x41, 0xE4,
-    0xBF, 0x6C, 0xB6, 0xA3, 0x61, 0x9E, 0x16, 0x4C, 0xFB, 0x07, 0x22, 0x92, 0x60, 0xA3, 0x9D, 0x74,
-    0xAE, 0xE0, 0xA0, 0xE2, 0x22, 0x67, 0x3D, 0x6A, 0xE6, 0x3B, 0xA2, 0x39, 0x78, 0x7B, 0xD6, 0x3E,
-    0xF1, 0x53, 0x80, 0x49, 0x75, 0x9F, 0xA8, 0x41, 0x7C, 0x5F, 0x36, 0x91, 0x2E, 0xEB, 0x6A, 0xC3,
-    0xC8, 0x59, 0xC2, 0x89, 0x69, 0x83, 0x6B, 0x52, 0x8B, 0x91, 0xB3, 0x54, 0x54, 0xC9, 0x65, 0xB5,
-    0x16, 0x55, 0x0D, 0xBA, 0xF0, 0x21, 0x85, 0x11, 0xE3, 0x40, 0x6D, 0x0D, 0xD2, 0xA0, 0xAE, 0xAF,
-    0xD3, 0x4F, 0x27, 0xF8, 0x1C, 0x45, 0x6D, 0xAB, 0xCA, 0x86, 0x86, 0xA6, 0x6B, 0xD9, 0x50, 0x69,
-    0x4B, 0x6A, 0x80, 0xB3, 0xE2, 0x43, 0x08, 0x8E, 0x8E, 0xF4, 0xFC, 0x0A, 0xBF, 0x94, 0x8E, 0xEA,
-    0xCD, 0x4B, 0x20, 0x53, 0x8E, 0x8C, 0xE0, 0xF3, 0x8C, 0xC9, 0x85, 0x0A, 0x91, 0xEB, 0x1C, 0xAB,
-    0x6F, 0x99, 0xCD, 0xE7, 0x4C, 0xC2, 0xC2, 0x8E, 0x00, 0xA4, 0xD5, 0x08, 0xF3, 0xB3, 0xE6, 0xD6,
-    0x05, 0xEE, 0xCF, 0x1C, 0x48, 0xEA, 0x68, 0x48, 0x2F, 0x3D, 0xE1, 0x5E, 0x50, 0xA6, 0xF7, 0x4F,
-    0x94, 0x93, 0x2D, 0xCA, 0x4D, 0x44, 0x1F, 0x95, 0x74, 0xD2, 0x3D, 0xCD, 0x2B, 0x9A, 0x98, 0x25,
-    0x75, 0x02, 0x07, 0xB4, 0x3E, 0xB8, 0x4C, 0x38, 0xB6, 0x3A, 0x62, 0x62, 0xCC, 0x73, 0x5E, 0x38,
-    0xDA, 0x47, 0xC0, 0x91, 0xD2, 0x23, 0x5E, 0xC0, 0x31, 0x81, 0x32, 0xF3, 0x0B, 0x76, 0x21, 0x8A,
-    0x55, 0xEC, 0x2F, 0xB9, 0xE7, 0x60, 0x73, 0xC1, 0xED, 0x1A, 0xCC, 0x62, 0x8D, 0x31, 0x70, 0x9F,
-    0x39, 0x72, 0x1A, 0x6E, 0x56, 0x0E, 0xCE, 0xFE, 0x88, 0xD0, 0x66, 0x43, 0x06, 0xC9, 0x1F, 0xD9,
-    0x23, 0x77, 0x64, 0x8E, 0xBC, 0x29, 0x6B, 0xE2, 0x8D, 0x3D, 0x6F, 0xEC, 0x78, 0x03, 0x86, 0x6E,
-    0x30, 0x1D, 0xA8, 0x38, 0x5A, 0x4D, 0xE7, 0x09, 0xB4, 0x30, 0x8C, 0xC0, 0x5A, 0xCC, 0x23, 0xD0,
-    0xE2, 0x52, 0xD8, 0xF9, 0x35, 0x9E, 0x22, 0xC6, 0x6F, 0x9E, 0x2E, 0x8D, 0xE1, 0x0A, 0xDD, 0x03,
-    0xD0, 0x45, 0x89, 0xE1, 0x15, 0x4A, 0xBC, 0xAF, 0xD3, 0x94, 0x4E, 0xDD, 0x3C, 0x04, 0xFE, 0xA0,
-    0xFF, 0x7A, 0x06, 0x8B, 0x6D, 0x5E, 0x00, 0x18, 0x57, 0x26, 0xB1, 0xF3, 0xDF, 0xA1, 0x9C, 0x21,
-    0x34, 0x13, 0x85, 0x47, 0x9B, 0xCF, 0x8B, 0x66, 0x5F, 0x96, 0xEF, 0xB6, 0xCB, 0xA7, 0x0F, 0x2C,
-    0x2F, 0xFE, 0x79, 0x3A, 0xFB, 0xE7, 0x47, 0x97, 0xC5, 0xC3, 0x33, 0xA7, 0xEF, 0xC4, 0x6E, 0xC0,
-    0x5F, 0x9F, 0xFD, 0x74, 0x7C, 0x0A, 0x44, 0x83, 0x66, 0x90, 0x0C, 0x6A, 0xF1, 0x17, 0xF4, 0x62,
-    0x25, 0x71, 0x28, 0xB8, 0x4C, 0xCA, 0xEC, 0x19, 0xD7, 0xC8, 0x25, 0x93, 0x77, 0xC5, 0xBC, 0x00,
-    0x97, 0xCD, 0xDE, 0xE9, 0x84, 0xDC, 0xA5, 0x8B, 0x7D, 0x09, 0xE4, 0xD2, 0xB0, 0xD1, 0xAE, 0xD1,
-    0xAC, 0x45, 0x6E, 0x50, 0xA3, 0x76, 0xC5, 0x5C, 0x0C, 0xE4, 0x97, 0x21, 0x22, 0x37, 0xD4, 0x97,
-    0x7D, 0x30, 0x91, 0x17, 0x2C, 0xBC, 0x73, 0x18, 0xC4, 0x50, 0xA0, 0x9E, 0x4D, 0x21, 0x16, 0x55,
-    0xA8, 0xAD, 0x40, 0x9D, 0x0B, 0xD4, 0x58, 0x8D, 0xDE, 0x6E, 0xA6, 0xFB, 0xB3, 0x96, 0xFD, 0x09,
-    0x64, 0x7F, 0xD6, 0xD8, 0x9C, 0xDA, 0xA4, 0x19, 0x5D, 0x58, 0xFB, 0x85, 0x49, 0x7B, 0x55, 0xE5,
-    0x53, 0xD2, 0x84, 0x94, 0x29, 0x85, 0x66, 0x5C, 0x1A, 0xDA, 0x8B, 0x67, 0xF6, 0x49, 0x85, 0x07,
-    0x34, 0xE0, 0x53, 0x7C, 0x1D, 0x37, 0x40, 0x07, 0x96, 0x04, 0x25, 0xB8, 0x2D, 0xFA, 0xCA, 0xC4,
-    0x93, 0x5E, 0xC5, 0xD2, 0x7C, 0xA0, 0x30, 0x62, 0xCA, 0xF0, 0x00, 0x17, 0xB7, 0xA2, 0xC2, 0xF3,
-    0x8A, 0x2A, 0xBC, 0x2C, 0x44, 0x85, 0x17, 0x4C, 0x83, 0xBA, 0x2C, 0x14, 0x45, 0x1E, 0xC9, 0x08,
-    0xC5, 0x04, 0x2A, 0x63, 0x09, 0xFF, 0x74, 0x29, 0x19, 0x6B, 0xB1, 0x31, 0xAA, 0x77, 0x35, 0x8B,
-    0xFA, 0xAE, 0x93, 0x5C, 0xAA, 0xFA, 0xEC, 0x1B, 0x19, 0x9B, 0x1D, 0xC7, 0xC4, 0xA4, 0xA2, 0x41,
-    0xEB, 0x94, 0x54, 0x71, 0x6B, 0x8A, 0x78, 0x19, 0xE8, 0x39, 0x55, 0xA5, 0x65, 0x01, 0xAA, 0x40,
-    0xC8, 0x28, 0x66, 0x65, 0xE5, 0xF5, 0x73, 0x48, 0x2B, 0x18, 0xF5, 0xD4, 0xCF, 0x1D, 0xB3, 0x33,
-    0x9D, 0xE8, 0xCE, 0x29, 0x49, 0x91, 0x8A, 0x87, 0x5E, 0x63, 0x76, 0x5B, 0x25, 0x7E, 0xF6, 0x65,
-    0x02, 0x8B, 0xF4, 0x3D, 0x47, 0xE8, 0xAD, 0x24, 0x60, 0x48, 0x9C, 0xFD, 0x62, 0xE1, 0x9C, 0x67,
-    0x3E, 0x77, 0x54, 0xBE, 0xD4, 0x40, 0x96, 0x82, 0x76, 0x69, 0xFB, 0xC2, 0xDD, 0x08, 0x43, 0xAD,
-    0x7B, 0xFB, 0x70, 0x92, 0x2C, 0x3F, 0xC3, 0xF8, 0xF8, 0xF8, 0xC5, 0xE8, 0x89, 0x52, 0xB1, 0x0D,
-    0xE6, 0x38, 0x2C, 0x1A, 0x76, 0x66, 0xB7, 0x98, 0xF3, 0x57, 0x84, 0xAD, 0x14, 0x72, 0xE6, 0xC0,
-    0x7F, 0x91, 0xB2, 0x96, 0xF0, 0x07, 0xE2, 0xF0, 0x15, 0x34, 0x46, 0x71, 0x53, 0xE3, 0x9A, 0x33,
-    0x8E, 0x6E, 0xB0, 0x3C, 0xBA, 0xFD, 0xF6, 0xE8, 0x26, 0xCB, 0xA3, 0xBB, 0x48, 0xB8, 0x81, 0x66,
-    0xCA, 0xF9, 0xBB, 0x4E, 0x0D, 0x2D, 0x57, 0x2E, 0x35, 0xE1, 0xB7, 0x16, 0x71, 0x89, 0x36, 0x7C,
-    0x96, 0x5E, 0x53, 0x59, 0xE5, 0x92, 0xA9, 0x26, 0x95, 0xEE, 0x45, 0x92, 0xE9, 0xE8, 0x51, 0xD1,
-    0xF4, 0x80, 0x84, 0x91, 0x37, 0x83, 0x91, 0x10, 0x04, 0x8C, 0xEA, 0x38, 0x16, 0x92, 0xED, 0x62,
-    0x96, 0x6A, 0xE0, 0x92, 0x30, 0x39, 0x0C, 0x1C, 0x69, 0x5E, 0x40, 0x0E, 0x89, 0xC3, 0x38, 0x90,
-    0x2C, 0xBA, 0xB4, 0xB6, 0x26, 0x0B, 0x2A, 0x9F, 0x3B, 0x3F, 0x6A, 0xA1, 0xD2, 0xCA, 0xCC, 0x5E,
-    0xE6, 0x4D, 0xA3, 0xD1, 0x83, 0x31, 0xE7, 0xF3, 0x04, 0x10, 0xAA, 0xAD, 0x60, 0x10, 0xE1, 0xB7,
-    0x84, 0x3C, 0x62, 0x58, 0x39, 0x18, 0xB0, 0x89, 0xE1, 0x80, 0x67, 0x42, 0xFA, 0x47, 0x91, 0x56,
-    0xB3, 0x36, 0x3E, 0x94, 0x4B, 0xEE, 0xE1, 0x7B, 0x69, 0xCB, 0x04, 0x54, 0x03, 0x8F, 0xD0, 0xD6,
-    0x56, 0x84, 0x8C, 0x29, 0xAB, 0x78, 0xC7, 0xEF, 0xD6, 0x25, 0x33, 0xAF, 0x22, 0x56, 0xC3, 0xE4,
-    0xF4, 0x2D, 0x97, 0x0C, 0x96, 0x4B, 0x06, 0xB2, 0xE4, 0xB7, 0x4F, 0xBE, 0xE4, 0x63, 0x0A, 0x05,
-    0x3B, 0xEA, 0xA6, 0x9A, 0xD5, 0xCD, 0x2C, 0x1C, 0xE3, 0x19, 0xC2, 0xB1, 0xD0, 0xEB, 0x8C, 0x9E,
-    0x19, 0x3C, 0x33, 0x6C, 0xB6, 0xB2, 0x7B, 0x22, 0x75, 0x85, 0x7C, 0x99, 0x87, 0x81, 0x87, 0xF6,
-    0xC0, 0x3C, 0xF1, 0x7A, 0x8F, 0xB3, 0x23, 0x0F, 0x6A, 0xCA, 0xCB, 0xE1, 0x63, 0xD2, 0xE6, 0x7E,
-    0x9E, 0x41, 0x0B, 0x44, 0x53, 0x14, 0x3E, 0xDB, 0x82, 0x88, 0xC9, 0x5F, 0xD1, 0xB8, 0x6A, 0x43,
-    0x9A, 0xC7, 0xD8, 0x90, 0x60, 0x61, 0x43, 0xE6, 0x10, 0x80, 0xDF, 0xAB, 0x28, 0x9E, 0x87, 0xC2,
-    0x09, 0x64, 0xC2, 0x56, 0xA2, 0x68, 0x41, 0x6D, 0xF9, 0x01, 0xB3, 0xA3, 0x6F, 0x34, 0x0F, 0x25,
-    0x38, 0xC6, 0xB3, 0x14, 0xC4, 0x56, 0xF3, 0x3C, 0x26, 0xC1, 0x31, 0x6D, 0xFF, 0xA7, 0x50, 0xFE,
-    0xB7, 0x7A, 0x93, 0x7F, 0x04, 0x15, 0xFD, 0x31, 0x3C, 0xC2, 0xDF, 0x65, 0xFB, 0xD9, 0x8E, 0xB0,
-    0x0B, 0xD4, 0xB7, 0xEC, 0x83, 0x21, 0x6A, 0xCF, 0xBD, 0x1D, 0xE7, 0xDE, 0xE6, 0xA4, 0x0E, 0x71,
-    0x64, 0x78, 0x45, 0x7D, 0x5A, 0xFD, 0x57, 0x7A, 0xA3, 0x07, 0x2C, 0xF1, 0xAC, 0xEC, 0xFE, 0x84,
-    0x07, 0x46, 0x55, 0xAC, 0x8E, 0xE9, 0x68, 0x6C, 0x2F, 0xCF, 0x1A, 0xF3, 0x36, 0xA3, 0x46, 0xD3,
-    0x33, 0x36, 0xE3, 0xE9, 0x35, 0x16, 0x4A, 0x70, 0x22, 0x9B, 0xD8, 0xA9, 0xAB, 0xEA, 0x2D, 0xEF,
-    0x64, 0x7C, 0xBD, 0x28, 0x90, 0x6C, 0x98, 0x3A, 0x4C, 0x16, 0xBA, 0x06, 0xB3, 0x97, 0x50, 0xCC,
-    0x3D, 0x5D, 0x88, 0x1D, 0x11, 0xAA, 0xBD, 0xA9, 0xF4, 0x21, 0x97, 0x38, 0x2F, 0xB2, 0xA3, 0xAA,
-    0x38, 0xE8, 0x63, 0xEC, 0xE8, 0x31, 0x84, 0x9B, 0x51, 0xCB, 0x89, 0x68, 0x32, 0x59, 0x51, 0x35,
-    0x25, 0xC2, 0x12, 0x96, 0x6C, 0x4C, 0x8A, 0x30, 0xC0, 0xF1, 0x6B, 0x23, 0xA2, 0xD2, 0x6A, 0xB5,
-    0x29, 0x8B, 0xBC, 0x58, 0x6F, 0x6C, 0x05, 0x1B, 0x3E, 0x60, 0x44, 0x18, 0x96, 0x36, 0xB0, 0x98,
-    0x7D, 0xDC, 0xCA, 0xF8, 0x25, 0x0C, 0x67, 0x17, 0xDD, 0x63, 0x64, 0x13, 0x8E, 0x9C, 0x29, 0x60,
-    0x1D, 0x05, 0xF4, 0xC2, 0x78, 0xC2, 0x0F, 0xE8, 0xA9, 0x4E, 0x9D, 0xB8, 0x0B, 0x65, 0x2B, 0x9C,
-    0x89, 0x8E, 0x3D, 0x99, 0xAC, 0x96, 0x48, 0xA1, 0x58, 0x3D, 0x09, 0x5A, 0xE7, 0xEC, 0xC7, 0xC0,
-    0x98, 0x6A, 0x00, 0x51, 0x88, 0x35, 0x96, 0x31, 0x55, 0xF0, 0xBF, 0xC6, 0x54, 0x4F, 0x99, 0xE1,
-    0xED, 0x8F, 0x1C, 0x3E, 0x2D, 0x1C, 0x6A, 0x66, 0x5A, 0x63, 0xF6, 0x45, 0xBE, 0xFA, 0xC2, 0x99,
-    0x3F, 0x87, 0x19, 0xA1, 0xE3, 0x9E, 0x91, 0x14, 0xDE, 0x8C, 0xBE, 0x12, 0x2D, 0xC1, 0x02, 0x8B,
-    0x59, 0xAB, 0x70, 0x9E, 0x64, 0xFF, 0x1F, 0xA2, 0x23, 0xE5, 0xE4, 0xA8, 0x65, 0xBF, 0x40, 0x2F,
-    0xE7, 0x78, 0xF0, 0xE9, 0x46, 0x4D, 0x3C, 0x5E, 0x02, 0x7A, 0xAA, 0x3B, 0x87, 0xC9, 0x57, 0x93,
-    0x12, 0xAF, 0x56, 0x14, 0x6E, 0xB5, 0x65, 0x6D, 0x7F, 0xFA, 0xB5, 0xEB, 0x0E, 0xA3, 0x6F, 0x59,
-    0x74, 0x72, 0xAF, 0x60, 0x18, 0xE8, 0x3A, 0x4A, 0x75, 0xEF, 0xAC, 0x09, 0xA5, 0xD8, 0xE6, 0x58,
-    0x83, 0x02, 0x4A, 0x40, 0x0C, 0xB7, 0x56, 0xF4, 0x4E, 0xE9, 0x9E, 0x11, 0xD9, 0xCE, 0x23, 0x0B,
-    0x4C, 0x71, 0xD8, 0x93, 0x7A, 0x17, 0xD9, 0x52, 0x90, 0xCD, 0x89, 0xEC, 0x84, 0x69, 0x0D, 0xDE,
-    0x06, 0x62, 0x1A, 0x28, 0xB2, 0x5D, 0x78, 0x8F, 0xC8, 0x06, 0x23, 0xF9, 0x23, 0x9A, 0x71, 0xBB,
-    0x12, 0x64, 0x0D, 0x30, 0xC5, 0x7C, 0xA5, 0x20, 0x6B, 0x05, 0x59, 0x31, 0xFE, 0xDE, 0xF1, 0x49,
-    0xB6, 0x3E, 0xF7, 0xCF, 0xBD, 0xB7, 0x9D, 0x9D, 0xE9, 0x6D, 0x2B, 0xCA, 0xEE, 0xE2, 0x64, 0x54,
-    0xBD, 0xDE, 0xC9, 0xE1, 0xFD, 0xA1, 0x16, 0x1E, 0xE9, 0x3A, 0x13, 0xFF, 0x54, 0x8E, 0xCB, 0x73,
-    0xA7, 0x4C, 0x71, 0x4B, 0x20, 0xC3, 0xDB, 0x27, 0x93, 0x50, 0xAE, 0x4A, 0x75, 0x6E, 0x2A, 0x9F,
-    0x8B, 0xBB, 0x5F, 0x76, 0x81, 0x2B, 0x92, 0x21, 0x64, 0xC9, 0x35, 0x66, 0xF4, 0x06, 0xF7, 0x26,
-    0xD8, 0x40, 0x57, 0x07, 0x1B, 0xBA, 0x46, 0x1B, 0xAC, 0x10, 0xD2, 0x51, 0x8C, 0x06, 0x78, 0x40,
-    0xB1, 0x0C, 0x3D, 0xFE, 0x9B, 0xB6, 0xB8, 0x9B, 0x37, 0xB6, 0x5B, 0xB9, 0x8A, 0xB9, 0xB8, 0x2C,
-    0x66, 0x1A, 0x4E, 0x0A, 0x03, 0x08, 0x85, 0x0A, 0x9F, 0x8B, 0x7B, 0x54, 0x61, 0x0E, 0x44, 0xB2,
-    0xDE, 0x1C, 0x4A, 0x9D, 0xE3, 0x6A, 0x97, 0x76, 0x98, 0xAF, 0xC1, 0xEC, 0x95, 0x5C, 0x7D, 0x59,
-    0xC4, 0xBC, 0x3A, 0x6E, 0x3D, 0x7B, 0x4A, 0xF2, 0xCF, 0xD5, 0x54, 0xC5, 0x62, 0x26, 0x10, 0x2B,
-    0x7C, 0x6F, 0x37, 0x49, 0xED, 0xAE, 0x37, 0x53, 0x92, 0x7A, 0x5C, 0x26, 0xA9, 0xF7, 0xCB, 0xE8,
-    0xE3, 0x52, 0x07, 0x17, 0xC2, 0xB0, 0x39, 0xE6, 0xA1, 0x05, 0x95, 0x0C, 0xBC, 0x3B, 0x29, 0x62,
-    0x7C, 0xC0, 0x83, 0xF6, 0x5A, 0x48, 0x31, 0xB8, 0x32, 0x37, 0x8E, 0x28, 0xDF, 0xCA, 0xB8, 0x72,
-    0x2E, 0xAC, 0x1B, 0xE1, 0xDD, 0x08, 0xF3, 0x46, 0xB8, 0x37, 0xC2, 0xBE, 0x11, 0xFE, 0x8D, 0x00,
-    0x60, 0x04, 0x01, 0x23, 0x10, 0x18, 0xC1, 0x40, 0x46, 0xCA, 0x9F, 0x8F, 0xDF, 0x11, 0x4D, 0x08,
-    0x0E, 0x92, 0x7D, 0xCD, 0x8C, 0x20, 0xE1, 0xA1, 0xF0, 0x58, 0x78, 0x9E, 0x4F, 0x0E, 0x8E, 0xC0,
-    0x33, 0xC4, 0x94, 0xCA, 0x0C, 0x2A, 0x80, 0xC5, 0x9E, 0x9F, 0x74, 0x4B, 0x3A, 0x53, 0x29, 0xBD,
-    0x63, 0xAA, 0x50, 0x4B, 0x3C, 0x57, 0x81, 0x5B, 0x27, 0xA9, 0x37, 0x2E, 0x5E, 0xE9, 0xD0, 0xB3,
-    0x08, 0x2D, 0x43, 0xA7, 0xAA, 0x80, 0xF8, 0x98, 0xFC, 0xF3, 0xC9, 0xDF, 0x22, 0x44, 0x8A, 0x91,
-    0x07, 0x69, 0x82, 0x40, 0x92, 0x7A, 0x91, 0xA6, 0xFF, 0xAC, 0xCF, 0x02, 0xDE, 0xC7, 0xA7, 0x35,
-    0x61, 0x68, 0xE9, 0x53, 0xC8, 0x19, 0x8A, 0x25, 0xFF, 0x49, 0x24, 0x78, 0x8E, 0xC8, 0xE3, 0xED,
-    0x53, 0xE1, 0x93, 0x0A, 0xA4, 0x96, 0xFA, 0x12, 0xB5, 0x0E, 0x4E, 0xAE, 0xD5, 0xA4, 0x1E, 0x7F,
-    0xC9, 0xA9, 0xD3, 0xFE, 0x81, 0x46, 0x14, 0x9E, 0x6D, 0xC5, 0x5D, 0x24, 0x26, 0xA7, 0x6F, 0xFB,
-    0x04, 0xA4, 0xE4, 0x15, 0xB5, 0x07, 0x43, 0x7E, 0x99, 0x65, 0x22, 0x3E, 0xDD, 0xAC, 0x1D, 0x02,
-    0x11, 0xF7, 0x47, 0x37, 0x84, 0x7C, 0x6C, 0x8C, 0x37, 0xB9, 0x7B, 0xDD, 0x21, 0x80, 0x86, 0x42,
-    0xB0, 0x4D, 0x3C, 0xAC, 0x1D, 0x02, 0x8C, 0xE1, 0x95, 0x4D, 0xC9, 0x74, 0x22, 0x85, 0x03, 0x94,
-    0x63, 0xBC, 0xFF, 0x36, 0xEB, 0xF1, 0x2C, 0xCC, 0x54, 0x2C, 0xEC, 0x01, 0x87, 0xCD, 0xEA, 0x9A,
-    0xB0, 0xD7, 0x24, 0x6E, 0x94, 0xDA, 0x61, 0xCD, 0x6D, 0xB8, 0x62, 0x14, 0xE6, 0xFF, 0xDA, 0x57,
-    0xE5, 0x5B, 0x13, 0x36, 0xC6, 0xD7, 0xFC, 0xEE, 0x30, 0x77, 0x59, 0x94, 0xD5, 0xAC, 0x6D, 0x6B,
-    0xD1, 0xB6, 0x4C, 0x03, 0x54, 0x81, 0x7B, 0x99, 0xC9, 0x70, 0x3C, 0x2C, 0x1B, 0x2E, 0x21, 0xA4,
-    0x44, 0x90, 0x71, 0xCF, 0xA4, 0x69, 0x97, 0xB4, 0x1A, 0x3E, 0x6A, 0x2E, 0xA0, 0x11, 0x71, 0x0A,
-    0x9C, 0x44, 0xAC, 0x99, 0xF6, 0xBD, 0x90, 0x72, 0x3A, 0x85, 0x4E, 0x0B, 0x25, 0x93, 0xBB, 0xBF,
-    0x81, 0x01, 0x03, 0xA7, 0xD0, 0x8D, 0xD2, 0x83, 0x12, 0x48, 0xF8, 0xE7, 0x5D, 0xE2, 0xE1, 0x1C,
-    0x99, 0xAE, 0xFD, 0x31, 0xB1, 0xDD, 0xC0, 0x66, 0xF6, 0x0F, 0xCC, 0x54, 0x9D, 0x9E, 0x1D, 0x46,
-    0xFB, 0x33, 0xC4, 0x87, 0x57, 0x21, 0xAB, 0x65, 0x2B, 0x35, 0x4C, 0xFC, 0xE5, 0x91, 0x99, 0x53,
-    0x02, 0x0B, 0xD7, 0x36, 0x5A, 0xBA, 0xE7, 0xED, 0x14, 0x54, 0xFB, 0x00, 0xBB, 0xF1, 0x3C, 0x66,
-    0x92, 0x78, 0xD3, 0xF9, 0x57, 0x6C, 0xE4, 0x79, 0x7C, 0x63, 0xD1, 0xDE, 0xE0, 0x38, 0x86, 0x9C,
-    0x95, 0x6B, 0xE8, 0x8B, 0x37, 0x5B, 0x29, 0x59, 0xB0, 0xDD, 0x67, 0x75, 0x7C, 0x31, 0x7B, 0xAA,
-    0x5E, 0xAF, 0x1C, 0x2B, 0x09, 0xB4, 0xD3, 0x7A, 0xF2, 0xC5, 0x66, 0x98, 0x9F, 0xE1, 0xB1, 0x97,
-    0xB6, 0x1A, 0x76, 0xB1, 0xAC, 0xDC, 0x6D, 0xE6, 0xF5, 0xCD, 0xF7, 0x7D, 0xE8, 0x26, 0x83, 0x9B,
-    0x7D, 0x32, 0xE9, 0x8F, 0xB1, 0x32, 0x1D, 0xD5, 0xD4, 0x5A, 0x9B, 0x1C, 0xEB, 0x45, 0x5B, 0xD5,
-    0x11, 0x75, 0xDD, 0x6B, 0xB4, 0xE5, 0x02, 0x5B, 0x4E, 0x00, 0x13, 0x31, 0xE4, 0x9A, 0x91, 0x65,
-    0xA8, 0xCF, 0xBA, 0x1A, 0xEE, 0xAD, 0x7D, 0xB1, 0x7D, 0x3A, 0x46, 0xE5, 0x48, 0x0C, 0xAB, 0x88,
-    0x3A, 0xBB, 0x0F, 0x95, 0xB9, 0x8D, 0xB6, 0x71, 0x8A, 0x5F, 0x58, 0x0E, 0x6A, 0x9B, 0x02, 0x95,
-    0x80, 0xB7, 0xA1, 0x7C, 0x98, 0xD0, 0x2F, 0x71, 0x2F, 0x27, 0x75, 0x73, 0xCF, 0xE1, 0xE3, 0x6B,
-    0xC1, 0xFB, 0x65, 0x78, 0xA7, 0x27, 0x30, 0xD5, 0x9E, 0xC0, 0xCC, 0x1F, 0xD9, 0x0B, 0x61, 0xD8,
-    0x73, 0x44, 0x86, 0xC0, 0x0F, 0xD9, 0x21, 0x37, 0xC1, 0x14, 0x68, 0x3A, 0xCF, 0x09, 0x19, 0x21,
-    0x1F, 0x64, 0x43, 0xB8, 0x28, 0xEB, 0x29, 0x5D, 0x46, 0x0E, 0xC8, 0x00, 0xE9, 0x27, 0xF9, 0x42,
-    0xFD, 0x0D, 0xEF, 0xAF, 0xE7, 0x85, 0x64, 0xA7, 0x0E, 0x72, 0x5A, 0x89, 0x4C, 0x83, 0xF7, 0x0B,
-    0xA0, 0x7D, 0xD5, 0xA9, 0x22, 0x15, 0x8D, 0x8A, 0xC3, 0x7F, 0xE8, 0xA8, 0xCE, 0x7D, 0xB3, 0x9E,
-    0xC4, 0x05, 0x71, 0x8D, 0xE8, 0x2C, 0xFC, 0x72, 0xF4, 0x3B, 0xA9, 0xCE, 0xE0, 0x1C, 0x12, 0xEC,
-    0x77, 0x13, 0xA5, 0xED, 0x0F, 0xAE, 0x78, 0xF9, 0x88, 0xB6, 0xBF, 0x0B, 0xD8, 0x44, 0x98, 0x9E,
-    0x0D, 0x2F, 0xAC, 0x3D, 0xF0, 0x7A, 0x38, 0xCF, 0x5E, 0x3D, 0x94, 0x67, 0x7F, 0xB0, 0xA0, 0x11,
-    0x3D, 0x90, 0x15, 0x0D, 0x2B, 0x35, 0x52, 0x0C, 0x20, 0x58, 0x5D, 0xFF, 0x05, 0xAE, 0x92, 0xE4,
-    0xBC, 0xA5, 0x71, 0x9F, 0x95, 0x00, 0x9D, 0x05, 0x13, 0x2C, 0x8B, 0x55, 0x87, 0x1F, 0x6D, 0x8E,
-    0xE3, 0x47, 0x45, 0xF8, 0x0C, 0x82, 0x3E, 0xC9, 0x2C, 0x73, 0x1C, 0xB0, 0x9F, 0x19, 0xDC, 0xA4,
-    0x58, 0xEA, 0x7C, 0x08, 0xE4, 0x30, 0x27, 0xFC, 0x7A, 0x9E, 0x66, 0xB6, 0x2D, 0xB2, 0x6B, 0x91,
-    0x4D, 0x8B, 0xE9, 0xAE, 0x0E, 0xBB, 0x0C, 0xE6, 0xB6, 0x79, 0x6C, 0x68, 0xF0, 0x83, 0x18, 0x44,
-    0xA6, 0xD0, 0xD0, 0x3F, 0x10, 0x89, 0x05, 0x43, 0x00, 0x76, 0x90, 0x0B, 0x3C, 0xCD, 0xDF, 0x89,
-    0x1F, 0x91, 0x26, 0x16, 0x12, 0x3E, 0xC9, 0x64, 0x4F, 0xAD, 0x53, 0x09, 0x3F, 0xEF, 0x86, 0xB0,
-    0x37, 0x86, 0xFE, 0x0D, 0x9D, 0x9B, 0x57, 0xDD, 0x3B, 0x67, 0x57, 0x98, 0x26, 0x9A, 0xE9, 0x4B,
-    0xB0, 0xDC, 0xC3, 0x5C, 0xAF, 0xE5, 0x21, 0x74, 0x59, 0x82, 0xEF, 0xF3, 0x7A, 0xC6, 0x9D, 0x68,
-    0x6A, 0x88, 0x99, 0x62, 0x11, 0x8C, 0x56, 0xAE, 0x49, 0xBF, 0x0B, 0xED, 0xDD, 0x11, 0xE8, 0x6B,
-    0xE4, 0x92, 0xB6, 0xFD, 0x6D, 0x47, 0x70, 0x9E, 0x21, 0x2E, 0x72, 0xDF, 0x4A, 0x17, 0x11, 0x5C,
-    0xCF, 0xF7, 0x99, 0xF5, 0x9E, 0x1D, 0xB9, 0xB9, 0xE6, 0xB0, 0xDE, 0xA9, 0x39, 0x68, 0xE1, 0x61,
-    0xA7, 0xE6, 0x60, 0x1F, 0x51, 0x73, 0x10, 0x47, 0x11, 0x7B, 0x5F, 0x8B, 0xD9, 0xC3, 0x14, 0x16,
-    0x71, 0x33, 0x9C, 0xCE, 0xAB, 0x8C, 0x3D, 0xD5, 0xD4, 0x35, 0x9A, 0x5B, 0x37, 0x5B, 0xD7, 0x39,
-    0xEA, 0x12, 0x06, 0x52, 0x37, 0xBD, 0xFD, 0x7C, 0x8F, 0x87, 0xFA, 0x68, 0xF2, 0xDC, 0xB0, 0x24,
-    0xE3, 0x34, 0xA9, 0xC3, 0x2C, 0x82, 0xB5, 0x6D, 0xF0, 0x4A, 0xCF, 0x99, 0xD4, 0x54, 0x12, 0xAC,
-    0x09, 0x21, 0x96, 0x03, 0x9C, 0xE6, 0xFC, 0x53, 0x69, 0xD2, 0xBC, 0xCB, 0xE1, 0x95, 0x8A, 0x2D,
-    0x97, 0xD5, 0xE4, 0x11, 0x9E, 0x9E, 0x4A, 0xAB, 0x53, 0xE1, 0x23, 0xC8, 0x93, 0x93, 0xA7, 0xC2,
-    0xFE, 0xB3, 0x70, 0x5C, 0xB1, 0xA3, 0x9D, 0x91, 0xE0, 0x65, 0xAE, 0xD1, 0x5E, 0x16, 0xD3, 0x6C,
-    0xB8, 0x5A, 0xB7, 0x21, 0xD4, 0xE9, 0xA8, 0x8D, 0xAA, 0x99, 0xAF, 0x05, 0xCD, 0x7B, 0xB1, 0x5F,
-    0xF6, 0xF9, 0x5E, 0x07, 0x34, 0x0B, 0x6C, 0x47, 0x7A, 0x47, 0x0A, 0x00, 0x54, 0x44, 0xA2, 0x6D,
-    0x27, 0x61, 0xBD, 0x24, 0x20, 0x64, 0x75, 0x69, 0x7E, 0xB1, 0x34, 0x5C, 0xBF, 0x79, 0x7E, 0x1A,
-    0xE4, 0xBF, 0x72, 0xE3, 0x29, 0x41, 0x22, 0x9C, 0x8B, 0xD7, 0x1B, 0xDE, 0x61, 0xAD, 0xE8, 0x8D,
-    0xDA, 0x0F, 0x21, 0x1B, 0x9C, 0xD5, 0x1D, 0xBE, 0x6C, 0x70, 0x24, 0xE4, 0x8D, 0x7B, 0xAE, 0x95,
-    0xFC, 0x55, 0x4A, 0x85, 0x3F, 0xA5, 0x42, 0x1A, 0xA4, 0x97, 0xF2, 0x68, 0x9B, 0x04, 0x94, 0xAE,
-    0x97, 0xA9, 0xC1, 0x43, 0x46, 0x82, 0x63, 0x04, 0x1D, 0x19, 0xBB, 0x33, 0x1B, 0x3C, 0xE2, 0x29,
-    0xA7, 0x33, 0xB7, 0x79, 0x08, 0x4C, 0x73, 0x5F, 0x89, 0x94, 0xDB, 0x88, 0x94, 0x42, 0xA5, 0x58,
-    0x79, 0xB0, 0x14, 0xAD, 0x69, 0x83, 0x0E, 0x7F, 0x7C, 0xC4, 0x0E, 0xF3, 0x0E, 0xEE, 0x21, 0xE3,
-    0xE8, 0x16, 0x56, 0x2A, 0x79, 0xBD, 0xA7, 0xCD, 0xBA, 0xD4, 0xB3, 0xB4, 0x37, 0xA9, 0x90, 0x96,
-    0xA9, 0x94, 0x6B, 0xBE, 0xC6, 0x75, 0x6F, 0xC8, 0xE2, 0xD7, 0x88, 0x42, 0x33, 0x45, 0x44, 0x97,
-    0xC3, 0xE5, 0x8D, 0xE9, 0xFD, 0x24, 0xC9, 0x74, 0x48, 0xA1, 0x3A, 0xBE, 0x4F, 0x82, 0xC6, 0xA9,
-    0x5A, 0xE3, 0x7F, 0xD4, 0xC9, 0x5A, 0x69, 0x12, 0x36, 0x74, 0x9A, 0xA7, 0xFB, 0x5B, 0xAF, 0x95,
-    0x26, 0x1F, 0xA3, 0x2D, 0x8C, 0x4F, 0xB1, 0x22, 0x58, 0x39, 0xEB, 0xDB, 0x71, 0x9B, 0xF3, 0xC5,
-    0x8B, 0x14, 0xBF, 0x62, 0x86, 0xFC, 0x96, 0xBF, 0x40, 0x57, 0x95, 0xB2, 0xF6, 0x6D, 0x2B, 0x3B,
-    0x4A, 0xEA, 0xB1, 0x2C, 0xB1, 0x9C, 0xAD, 0xC6, 0x12, 0xEC, 0xD8, 0xF7, 0x87, 0x12, 0x86, 0xDC,
-    0xDE, 0x1A, 0x4A, 0x32, 0xF2, 0x61, 0x57, 0x82, 0x15, 0xFB, 0x71, 0x5B, 0x22, 0x54, 0xB1, 0x1F,
-    0xD7, 0x25, 0xF3, 0x85, 0xD7, 0xAB, 0x9C, 0x25, 0xA7, 0xB2, 0xC8, 0xC5, 0x91, 0x96, 0x82, 0x07,
-    0xA6, 0xCA, 0x07, 0x89, 0xD9, 0xF2, 0x5E, 0x7F, 0x75, 0x92, 0x27, 0xD6, 0xD4, 0xB7, 0xFA, 0x1E,
-    0xF2, 0xE2, 0x04, 0xBE, 0x20, 0xB9, 0x67, 0x9A, 0xDD, 0xB0, 0xA7, 0x4B, 0x34, 0xFB, 0xDF, 0xB4,
-    0xC3, 0x69, 0xC7, 0xD4, 0x8A, 0xED, 0x10, 0xAE, 0x55, 0x79, 0xC7, 0xBE, 0x21, 0x87, 0x70, 0xCD,
-    0xBE, 0xEF, 0x3A, 0x90, 0xFF, 0xC1, 0xB7, 0x1D, 0xA8, 0xBF, 0xF5, 0x75, 0x57, 0x66, 0xF6, 0xA3,
-    0xAF, 0x3B, 0xD0, 0xFE, 0xF1, 0x67, 0xFF, 0x46, 0xF0, 0xF6, 0x97, 0x5B, 0xDF, 0x60, 0x0F, 0xEE,
-    0xBE, 0xF8, 0x4D, 0x0F, 0x3D, 0x1F, 0xB0, 0xE6, 0x32, 0x06, 0xD8, 0xE0, 0x14, 0xAE, 0x77, 0x25,
-    0x63, 0x61, 0x30, 0xAF, 0x9B, 0x8A, 0x23, 0xD2, 0x8E, 0x26, 0xDD, 0x68, 0x6C, 0x46, 0x93, 0x5E,
-    0xB4, 0x6D, 0x39, 0x9E, 0xA9, 0x90, 0x42, 0x64, 0x06, 0x81, 0xE1, 0xA8, 0x45, 0xE3, 0xE9, 0x45,
-    0x33, 0xBE, 0x9C, 0x86, 0xA3, 0x14, 0xDE, 0x93, 0x77, 0x02, 0x36, 0xDE, 0x15, 0x66, 0x91, 0xC7,
-    0x6F, 0x8F, 0x96, 0x81, 0xCD, 0xB2, 0x26, 0xBF, 0x3E, 0xAB, 0xE4, 0x36, 0xBD, 0x2F, 0x35, 0x6E,
-    0xDF, 0x97, 0xC2, 0xD4, 0xBB, 0xEF, 0x4B, 0xE5, 0x6C, 0x9A, 0x90, 0xAC, 0x91, 0x97, 0x2B, 0xE6,
-    0x72, 0x2A, 0xF1, 0x02, 0xD9, 0xB9, 0x55, 0xB3, 0x96, 0xFB, 0xE9, 0x48, 0x71, 0xE0, 0x19, 0xFE,
-    0x07, 0x5D, 0x9B, 0xBB, 0xCC, 0xFF, 0x50, 0xBA, 0x23, 0xA9, 0x85, 0x6B, 0x59, 0x7C, 0x2A, 0x08,
-    0x69, 0xA9, 0x65, 0xEA, 0x03, 0x78, 0x4E, 0x73, 0x69, 0x93, 0x91, 0x92, 0x4E, 0x03, 0x93, 0x06,
-    0xF4, 0xAD, 0x7E, 0xCF, 0x9C, 0x06, 0xDF, 0x78, 0x79, 0x3E, 0xAC, 0x77, 0x6B, 0x07, 0xFB, 0x02,
-    0xC7, 0x77, 0x11, 0x3F, 0x26, 0xCB, 0x93, 0x33, 0x03, 0x55, 0xFA, 0x81, 0xDD, 0x2D, 0x7C, 0x58,
-    0xDF, 0x34, 0x94, 0xBC, 0xD5, 0xE0, 0xD9, 0x34, 0x5C, 0x5D, 0x55, 0xFE, 0xFC, 0x12, 0x92, 0x7C,
-    0x5E, 0xCA, 0xE7, 0x13, 0x40, 0xFA, 0xF9, 0x78, 0xFA, 0x0E, 0x27, 0xEE, 0x39, 0x5D, 0x67, 0x7C,
-    0x92, 0x4B, 0x82, 0xC6, 0xC1, 0x67, 0x7A, 0x0A, 0x0D, 0xC4, 0xA6, 0x16, 0x32, 0x78, 0xA3, 0x78,
-    0x5C, 0x5E, 0x45, 0x39, 0xC9, 0x25, 0x87, 0x25, 0x6B, 0x11, 0x6E, 0xBA, 0x9A, 0x5C, 0xC8, 0x55,
-    0xC2, 0x2D, 0x3F, 0x4A, 0xEE, 0x9D, 0x48, 0x35, 0x75, 0xF2, 0x56, 0x77, 0xDE, 0x21, 0xEB, 0x1F,
-    0xFD, 0x0E, 0xD9, 0xFE, 0xF8, 0x34, 0x3E, 0x1B, 0xE1, 0x7C, 0x1F, 0x51, 0xB9, 0xE8, 0x9D, 0xF9,
-    0x8E, 0x7C, 0x9E, 0xE3, 0xD5, 0xB1, 0xBD, 0xF1, 0x29, 0xB9, 0x87, 0x94, 0x59, 0x88, 0x98, 0xE7,
-    0x26, 0xD4, 0xF4, 0x44, 0xB5, 0xEC, 0x95, 0x25, 0xBB, 0x8B, 0x77, 0x8C, 0x84, 0x63, 0x89, 0x8C,
-    0x74, 0xDD, 0xCD, 0xB4, 0x53, 0x4A, 0x4F, 0x35, 0x55, 0x32, 0xF9, 0x39, 0x59, 0xD7, 0x8A, 0xB9,
-    0xB4, 0xEB, 0x4F, 0xBB, 0x7C, 0x65, 0x0A, 0x7F, 0xE5, 0xC5, 0x00, 0x7D, 0x03, 0xB6, 0xC9, 0x76,
-    0x7A, 0x48, 0xB2, 0xF3, 0x9F, 0x8F, 0x6D, 0xBD, 0x3E, 0x7E, 0xB8, 0x70, 0xB2, 0x6C, 0x4E, 0xA9,
-    0xFC, 0xC1, 0x7B, 0xD5, 0x4D, 0x86, 0xBD, 0x94, 0xD7, 0xC7, 0xF8, 0xEC, 0x7F, 0x00, 0xDD, 0x5B,
-    0xBF, 0xB3, 0xDC, 0xD6, 0x75, 0xBE, 0x58, 0x68, 0x89, 0x19, 0x6E, 0x01, 0x15, 0x7C, 0x8D, 0xE4,
-    0x19, 0x34, 0x2E, 0x12, 0xCE, 0x78, 0x50, 0xA7, 0x21, 0xA0, 0xA4, 0x74, 0xF3, 0x3C, 0xC3, 0xE7,
-    0x14, 0x2C, 0xD8, 0xA4, 0xC8, 0xA4, 0xE1, 0x5F, 0x60, 0x61, 0x6D, 0x97, 0x29, 0xC2, 0x22, 0xA9,
-    0x52, 0x84, 0x05, 0x8B, 0xCC, 0x63, 0xC1, 0x26, 0x85, 0x33, 0x23, 0x11, 0xB0, 0x59, 0xB8, 0x48,
-    0xE1, 0x95, 0x9D, 0x19, 0x17, 0x29, 0xB2, 0x96, 0xE3, 0xD8, 0x43, 0x15, 0x84, 0x64, 0x68, 0x0C,
-    0x32, 0x00, 0x6E, 0xBE, 0xEF, 0x3B, 0x17, 0xD8, 0x7D, 0xA4, 0xAD, 0xD8, 0xB1, 0xF8, 0x28, 0xFB,
-    0x8D, 0x74, 0xB1, 0xDC, 0xB7, 0x7B, 0xEF, 0xF9, 0x7D, 0xBE, 0x73, 0xCE, 0x7D, 0xCE, 0x1D, 0x7E,
-    0x7C, 0xE9, 0xA2, 0x7A, 0x8C, 0xBC, 0x73, 0x1B, 0xEF, 0xBF, 0x37, 0x39, 0x57, 0x78, 0xFF, 0x3F,
-    0x03, 0xDE, 0x7F, 0x5E, 0xFB, 0xD6, 0xC5, 0x7E, 0x9B, 0xFA, 0xAD, 0x4B, 0x26, 0x97, 0x8C, 0xCE,
-    0xA5, 0x83, 0x8B, 0xF1, 0xC8, 0x3A, 0x3D, 0xF2, 0x56, 0x8F, 0x62, 0x6F, 0x8F, 0x9D, 0x4B, 0x86,
-    0xC3, 0xA3, 0x71, 0x1B, 0x7B, 0xA4, 0x9D, 0xDE, 0xC4, 0x87, 0xF9, 0xC9, 0x6A, 0x8F, 0x47, 0x1B,
-    0xF9, 0x06, 0xBB, 0x4C, 0xB7, 0x71, 0xB6, 0x4B, 0xBD, 0xC7, 0xA1, 0x38, 0xC8, 0x77, 0x24, 0xA7,
-    0xC2, 0x69, 0xFC, 0x29, 0x67, 0xFA, 0xCE, 0x8C, 0x4A, 0x2E, 0x24, 0x32, 0x9F, 0x70, 0x58, 0xE4,
-    0xFD, 0x7F, 0xF6, 0x2E, 0xF1, 0xDE, 0xEF, 0x5D, 0x3A, 0xDE, 0xC1, 0x36, 0x79, 0x97, 0xF6, 0x3C,
-    0x80, 0x87, 0x56, 0x4D, 0x58, 0xF1, 0x4E, 0xBD, 0x4D, 0x6D, 0xED, 0xB8, 0x66, 0x20, 0xA2, 0x6E,
-    0x40, 0x86, 0xAB, 0x7E, 0x42, 0x12, 0xC0, 0xEA, 0x96, 0x14, 0x90, 0x80, 0x95, 0xFF, 0x2F, 0x9E,
-    0xF1, 0x86, 0x7B, 0xE1, 0xA7, 0x6E, 0xE2, 0x01, 0x4C, 0xF8, 0x12, 0x6C, 0xA5, 0x1F, 0x7B, 0x72,
-    0x97, 0xFD, 0x6A, 0x74, 0xD8, 0x3C, 0x07, 0xC5, 0xD8, 0xB7, 0xC0, 0x1E, 0x69, 0xEB, 0x0A, 0x7C,
-    0x1D, 0xFB, 0x57, 0x8D, 0x04, 0xC3, 0x07, 0xCE, 0xA9, 0xB7, 0x62, 0x9E, 0x7C, 0x42, 0x14, 0x64,
-    0xA2, 0x6A, 0xC8, 0x05, 0x76, 0x5D, 0xF1, 0xE1, 0xB7, 0xF1, 0x24, 0x1D, 0x50, 0x82, 0x4E, 0x67,
-    0xF0, 0x4D, 0xD2, 0xEC, 0xEA, 0x4F, 0x6B, 0x90, 0x4B, 0x1A, 0x77, 0x78, 0x64, 0x9E, 0x9B, 0x80,
-    0xE7, 0xDE, 0x5D, 0x24, 0x33, 0x3A, 0xE5, 0xAA, 0x6F, 0x80, 0x1A, 0x6C, 0xE0, 0xF3, 0x76, 0xD3,
-    0x47, 0xBE, 0x6E, 0xD2, 0x7E, 0xE5, 0x3D, 0xDE, 0x8B, 0xF1, 0x9D, 0xB4, 0x95, 0xE2, 0x5A, 0x1E,
-    0x90, 0x4B, 0x4A, 0xC5, 0x4E, 0x12, 0x6B, 0xA4, 0x9F, 0x86, 0x92, 0xA9, 0x9A, 0x42, 0x2B, 0x75,
-    0x54, 0xFD, 0x90, 0xA7, 0x16, 0xFE, 0xA9, 0xD6, 0x7F, 0x02, 0x37, 0xE9, 0x98, 0x35, 0xC7, 0x7A,
-    0x71, 0x6E, 0x5D, 0xAE, 0xC3, 0xBF, 0xD2, 0x7D, 0xDE, 0xD8, 0xAB, 0xF8, 0x53, 0x1F, 0x7E, 0xBB,
-    0xF2, 0xC3, 0x62, 0x62, 0xED, 0xA2, 0xCC, 0xF2, 0x58, 0xB4, 0x85, 0xBF, 0x4B, 0x55, 0x42, 0x7E,
-    0x05, 0x54, 0x10, 0xEB, 0x55, 0xE5, 0x7D, 0xC3, 0x57, 0xA5, 0xAB, 0xA1, 0x5D, 0xBE, 0xA2, 0x40,
-    0xAA, 0x56, 0xC6, 0x07, 0x09, 0x65, 0x24, 0xBA, 0xA3, 0x41, 0x48, 0xB1, 0x7B, 0x1A, 0x05, 0xD8,
-    0xA1, 0x45, 0xAD, 0xF4, 0x2A, 0xC6, 0x17, 0x20, 0x54, 0xBC, 0x4A, 0xC1, 0x31, 0xB8, 0xC6, 0xE7,
-    0x72, 0x7C, 0x81, 0x5A, 0xEC, 0x65, 0x7F, 0xD4, 0x60, 0xE7, 0xA8, 0x7F, 0x7C, 0x28, 0x6F, 0xF9,
-    0x05, 0xFB, 0x15, 0xBF, 0x40, 0x8D, 0xFA, 0x26, 0xA7, 0x38, 0x21, 0x2D, 0x3B, 0xD9, 0x65, 0xCF,
-    0x41, 0x9F, 0x7F, 0x72, 0x7E, 0x17, 0x3A, 0xF7, 0x94, 0x2A, 0x84, 0x43, 0xBD, 0x90, 0xBC, 0x06,
-    0xAF, 0x7A, 0x67, 0xAF, 0xEC, 0xE7, 0xD4, 0xDD, 0xB4, 0x17, 0x63, 0xDC, 0x8B, 0x47, 0x57, 0x65,
-    0x7B, 0xB1, 0x28, 0x5B, 0x21, 0x87, 0x30, 0x7E, 0x27, 0x06, 0xDD, 0xFA, 0xE6, 0xCC, 0x9F, 0x33,
-    0xF6, 0x62, 0xBE, 0x4B, 0xEE, 0x60, 0xDE, 0x3B, 0x31, 0x07, 0xBF, 0x6C, 0xC4, 0xDB, 0xFA, 0xEB,
-    0xB2, 0x17, 0x63, 0xD2, 0x38, 0xA3, 0x47, 0x8A, 0x31, 0xD8, 0x9C, 0xF1, 0x55, 0xED, 0x8C, 0xAD,
-    0x88, 0x66, 0x49, 0xAE, 0x68, 0x61, 0x62, 0x8A, 0x02, 0x14, 0x4F, 0xF4, 0x45, 0xB1, 0x54, 0xFF,
-    0xEC, 0xA6, 0x38, 0x82, 0x12, 0x06, 0x31, 0x14, 0x5E, 0xF4, 0x90, 0x65, 0x30, 0x34, 0xF0, 0x72,
-    0x22, 0xB3, 0xAD, 0x57, 0xA3, 0x9E, 0xC5, 0xDF, 0x91, 0x56, 0xF8, 0x92, 0xF8, 0xF5, 0x65, 0xEA,
-    0xCD, 0x3F, 0xA3, 0x9B, 0xC1, 0x43, 0xA9, 0xD8, 0x8F, 0x27, 0x6C, 0x00, 0x12, 0xA6, 0x09, 0xEC,
-    0xE0, 0x48, 0x3F, 0xF2, 0x99, 0x4E, 0x77, 0x86, 0xE8, 0xCC, 0xEF, 0xB2, 0x2E, 0xA5, 0xC6, 0xCA,
-    0x02, 0x86, 0xCA, 0xD0, 0x52, 0xEC, 0x36, 0x9D, 0x68, 0xA5, 0x31, 0xC2, 0x06, 0x61, 0xBA, 0x5C,
-    0xE4, 0xB0, 0x2B, 0x5A, 0xC2, 0x36, 0xDF, 0x33, 0xFC, 0xD4, 0x4D, 0x25, 0xA3, 0xAD, 0xE1, 0xBC,
-    0xC5, 0xA7, 0x67, 0xA4, 0xB8, 0xA9, 0xC1, 0x46, 0xEE, 0x9F, 0x36, 0x38, 0xC2, 0x6D, 0xA6, 0x62,
-    0xCB, 0xE7, 0x62, 0xA4, 0x70, 0x3D, 0x7A, 0x22, 0x5C, 0x8F, 0xDB, 0xD1, 0x27, 0x21, 0x94, 0xBA,
-    0x51, 0xD0, 0xC3, 0x2B, 0x52, 0x8B, 0x57, 0xF4, 0x44, 0xFC, 0xB7, 0x9A, 0xF4, 0x06, 0xE4, 0x8A,
-    0x57, 0x7C, 0x50, 0x70, 0x89, 0x45, 0xBC, 0x8D, 0xC4, 0x4C, 0x1A, 0xE9, 0x40, 0xA0, 0x92, 0xB1,
-    0x05, 0x44, 0xD2, 0x79, 0x32, 0x7B, 0x40, 0xA8, 0x99, 0xC5, 0xB8, 0xEC, 0xF9, 0xF9, 0x96, 0x11,
-    0x0F, 0xD4, 0xF1, 0x70, 0x58, 0x75, 0xAD, 0x47, 0x19, 0x42, 0x9B, 0x1C, 0x59, 0xA7, 0x3A, 0x77,
-    0xE5, 0x21, 0xFD, 0x1F, 0x6E, 0x3D, 0xD8, 0xA3, 0xB3, 0xC7, 0xD6, 0xFD, 0xBA, 0x9F, 0xDA, 0x38,
-    0xA2, 0xBF, 0x18, 0x0F, 0xE4, 0xE8, 0x91, 0x78, 0xD3, 0xBE, 0xCB, 0xF6, 0x24, 0xD9, 0xCB, 0xE4,
-    0xC9, 0x11, 0x48, 0x26, 0x47, 0x20, 0x39, 0x98, 0x02, 0x7F, 0xCD, 0x87, 0xEC, 0x41, 0x1C, 0x81,
-    0x78, 0x72, 0x94, 0xEF, 0xE7, 0x70, 0x6D, 0x51, 0xC1, 0x59, 0x58, 0x10, 0x47, 0x38, 0x84, 0x1C,
-    0xC9, 0x59, 0xFD, 0x16, 0x87, 0x88, 0x23, 0xE7, 0x0E, 0x5A, 0x5F, 0x4D, 0x16, 0x02, 0x46, 0xBD,
-    0xF7, 0x70, 0x30, 0x2E, 0x7B, 0x7B, 0xB4, 0xF6, 0xC1, 0xC5, 0xFF, 0x11, 0x7E, 0x10, 0x33, 0x1B,
-    0x85, 0xCA, 0x5C, 0x2A, 0xDF, 0x19, 0x03, 0xFA, 0x88, 0xB7, 0x38, 0x59, 0x6F, 0xB1, 0xA7, 0x6C,
-    0x9E, 0x11, 0x32, 0x62, 0xF0, 0xD5, 0x82, 0x77, 0x37, 0x3D, 0x1D, 0xA0, 0x53, 0x6C, 0xA6, 0xE1,
-    0xB7, 0x32, 0x7A, 0x28, 0xA8, 0xD8, 0xD3, 0x88, 0x6C, 0xF7, 0x2C, 0xEC, 0x2E, 0xB5, 0x98, 0xF0,
-    0x24, 0xAC, 0xEB, 0x3C, 0xA9, 0x20, 0xD5, 0x05, 0x89, 0x65, 0xE8, 0x66, 0x50, 0xD9, 0xB4, 0x11,
-    0x8C, 0x91, 0xC1, 0x12, 0x07, 0x54, 0x83, 0x05, 0xCD, 0x7A, 0x74, 0xD9, 0x1E, 0xC7, 0xD0, 0xCE,
-    0x76, 0x0C, 0xAF, 0x1E, 0x1B, 0xE3, 0xB0, 0x09, 0xF6, 0x8B, 0x10, 0x1B, 0x8D, 0xF5, 0xB6, 0x42,
-    0x7A, 0x59, 0x8D, 0x45, 0x83, 0x34, 0xD3, 0xC6, 0x03, 0x9E, 0x65, 0x86, 0x67, 0xBE, 0xF7, 0x10,
-    0x68, 0xD2, 0xA7, 0x2D, 0xBE, 0xC1, 0xE7, 0xC7, 0x66, 0xE9, 0x9B, 0x67, 0x23, 0x2D, 0xBD, 0x4D,
-    0xA6, 0x41, 0x96, 0x1E, 0x43, 0xF7, 0xB0, 0xF4, 0x3D, 0x03, 0xA6, 0x2F, 0x73, 0xF8, 0x60, 0xCF,
-    0x27, 0xD2, 0x45, 0x17, 0xF1, 0x2C, 0x57, 0xC3, 0x09, 0xF8, 0xAC, 0xDA, 0x78, 0x72, 0x47, 0x22,
-    0xB6, 0x90, 0x88, 0x9F, 0xB7, 0x6A, 0xF3, 0xD5, 0x3C, 0x04, 0xDA, 0x3C, 0x84, 0xA2, 0x7C, 0x72,
-    0xBF, 0xE1, 0x67, 0x35, 0x18, 0xBF, 0xD8, 0x48, 0xFC, 0xC2, 0xBB, 0x8C, 0xDF, 0xDE, 0xF8, 0xA5,
-    0x0A, 0xC8, 0x2F, 0x9F, 0x3C, 0x1B, 0xD2, 0x14, 0xBF, 0x59, 0x6B, 0xFC, 0xE6, 0xAD, 0xF1, 0x9B,
-    0xEF, 0x8D, 0xDF, 0x62, 0x67, 0xFC, 0x16, 0x8D, 0xF1, 0x5B, 0x35, 0xC6, 0x6F, 0xDD, 0x18, 0xBF,
-    0x48, 0x69, 0xE2, 0x17, 0xE1, 0x42, 0xFC, 0x7A, 0x27, 0x7E, 0xC1, 0x9F, 0xF8, 0x85, 0xB8, 0xC5,
-    0x2F, 0xF8, 0x13, 0xBF, 0x24, 0x8B, 0xFC, 0x26, 0x21, 0x85, 0x6C, 0xE6, 0x67, 0x88, 0x49, 0xA9,
-    0xDC, 0xC4, 0x5D, 0xAD, 0x8D, 0xDF, 0x8D, 0xDF, 0x87, 0xA7, 0x79, 0xC0, 0x66, 0xBC, 0xC8, 0x6D,
-    0xDC, 0x1F, 0xEF, 0x12, 0x1E, 0x49, 0xF7, 0x82, 0x4C, 0x06, 0x64, 0x09, 0xF0, 0x37, 0x40, 0x00,
-    0xF9, 0x7E, 0x35, 0x91, 0x6F, 0x04, 0xF8, 0x1F, 0x93, 0xA9, 0xD8, 0x47, 0xE4, 0x89, 0x76, 0x08,
-    0x96, 0x64, 0x84, 0x7E, 0xBB, 0x21, 0xD9, 0x60, 0xA8, 0x03, 0xB5, 0x5E, 0xB6, 0x82, 0xB7, 0xA9,
-    0x78, 0x72, 0x03, 0xD2, 0xF1, 0x69, 0x64, 0x5A, 0x9A, 0x29, 0xAC, 0x91, 0x36, 0x4A, 0x31, 0xE2,
-    0x51, 0x41, 0x8A, 0x81, 0x91, 0xC0, 0x47, 0x1A, 0xD4, 0xA6, 0xC7, 0x55, 0x63, 0x26, 0x35, 0x1D,
-    0xA6, 0xE6, 0x31, 0x96, 0xDE, 0xD7, 0x8E, 0x09, 0x37, 0x6B, 0x2A, 0xAC, 0x9B, 0x4F, 0x46, 0xA1,
-    0xA6, 0x4E, 0xDE, 0xB5, 0x7B, 0x21, 0xB9, 0xC6, 0xFA, 0x9A, 0xC9, 0x23, 0xD5, 0x6A, 0x36, 0x51,
-    0x3C, 0xE5, 0x5A, 0xDF, 0x51, 0xE8, 0x66, 0xCE, 0x5E, 0x8D, 0x5C, 0xE3, 0x21, 0xC3, 0x0E, 0x9B,
-    0x8E, 0x6B, 0xD6, 0x52, 0xFD, 0xC5, 0x8E, 0x6B, 0xF5, 0xE4, 0xE1, 0x9E, 0x16, 0x00, 0xBB, 0x8A,
-    0xB4, 0xC6, 0x5A, 0x89, 0x84, 0x5A, 0x65, 0x9F, 0x36, 0x44, 0xBF, 0x42, 0x81, 0x03, 0x91, 0x82,
-    0x8C, 0x9D, 0x30, 0x63, 0x14, 0x25, 0x8C, 0x2F, 0xFB, 0x71, 0x1F, 0xB4, 0x13, 0x93, 0x88, 0xE8,
-    0x6C, 0xF1, 0xFE, 0xF6, 0x11, 0x76, 0x1C, 0x26, 0x62, 0x38, 0xB8, 0x31, 0xF2, 0x82, 0xCB, 0x7A,
-    0x58, 0xB3, 0x32, 0x02, 0x9C, 0x24, 0xE4, 0x82, 0x90, 0x08, 0xB2, 0xD6, 0x50, 0x1B, 0xE3, 0xBF,
-    0xAB, 0xFF, 0x1B, 0x9C, 0x28, 0x87, 0xE6, 0xC0, 0x38, 0xD0, 0x75, 0xB1, 0x0D, 0x01, 0xFF, 0xDA,
-    0xE1, 0xDC, 0xEF, 0x33, 0x3C, 0xF3, 0xDC, 0xE4, 0xE2, 0xB9, 0x15, 0xDF, 0xAB, 0xBD, 0x98, 0x22,
-    0x04, 0x1D, 0x67, 0x25, 0x48, 0x05, 0x8C, 0x76, 0xEE, 0x85, 0x70, 0xC1, 0x48, 0xAB, 0x38, 0x2B,
-    0x2C, 0x77, 0x08, 0x51, 0x8A, 0x79, 0x5A, 0x12, 0xC5, 0x91, 0x65, 0xE3, 0x9A, 0xCA, 0xA0, 0xA6,
-    0xD2, 0xA6, 0xDA, 0x52, 0x4B, 0xD4, 0x51, 0xC4, 0xDF, 0xCC, 0xFA, 0xF1, 0xF6, 0xC5, 0x95, 0x01,
-    0x15, 0x39, 0x33, 0x0D, 0x9D, 0xFF, 0x2B, 0xAD, 0x74, 0x6E, 0xCE, 0x2B, 0x22, 0x26, 0xDF, 0x1B,
-    0x29, 0xA4, 0x44, 0x84, 0x20, 0x25, 0xDF, 0x34, 0x70, 0xE1, 0xAA, 0xDB, 0x7B, 0x03, 0x15, 0x02,
-    0x14, 0x02, 0x13, 0x16, 0x91, 0xEB, 0x51, 0xC8, 0x5A, 0x79, 0xA7, 0x25, 0x96, 0x07, 0x0A, 0xDC,
-    0x66, 0x43, 0x42, 0xF4, 0x00, 0x39, 0x27, 0xA3, 0x30, 0xBC, 0x10, 0xBC, 0xF0, 0xBB, 0x60, 0x7B,
-    0x41, 0xE8, 0x00, 0x11, 0xA7, 0x5A, 0x7A, 0xA1, 0x76, 0x61, 0xF6, 0x02, 0x91, 0xA8, 0xC9, 0xA6,
-    0x5B, 0xCC, 0xF6, 0x86, 0xD4, 0xBA, 0x19, 0xA9, 0x9F, 0xCE, 0x82, 0xAF, 0x22, 0x96, 0x04, 0xFF,
-    0x46, 0xE2, 0x29, 0x81, 0x44, 0x42, 0x5A, 0x04, 0xCF, 0x50, 0x14, 0x91, 0x9E, 0x84, 0xF4, 0x00,
-    0xB3, 0x77, 0x06, 0xD9, 0x85, 0xD8, 0x05, 0xD8, 0x85, 0xD7, 0x05, 0xD7, 0x85, 0xD6, 0x05, 0xD6,
-    0xA5, 0x75, 0x41, 0x75, 0x21, 0x75, 0x01, 0x75, 0xC3, 0xE9, 0x6F, 0x04, 0xE8, 0x7B, 0xEA, 0x56,
-    0xFD, 0x06, 0x42, 0x9A, 0x24, 0x1D, 0x69, 0x82, 0xEE, 0xBD, 0x3E, 0x5D, 0xAA, 0x9B, 0x90, 0x37,
-    0x56, 0x17, 0xF2, 0x86, 0x25, 0x8F, 0xFF, 0x33, 0x6F, 0xE8, 0x7C, 0xBF, 0x15, 0x82, 0x2F, 0x76,
-    0x8C, 0xC2, 0x88, 0x62, 0xE0, 0x05, 0xE6, 0x9A, 0x52, 0x06, 0x89, 0x97, 0xC6, 0x29, 0xFA, 0x88,
-    0xCA, 0x35, 0xCB, 0xDF, 0x82, 0x8C, 0xD4, 0x2C, 0xBF, 0xA5, 0xE5, 0x37, 0x47, 0x82, 0x60, 0x02,
-    0x71, 0x84, 0xE7, 0xA0, 0x01, 0xD4, 0x28, 0x78, 0x30, 0x69, 0x18, 0x34, 0x17, 0x32, 0x17, 0x30,
-    0x17, 0x2E, 0x0F, 0x84, 0x14, 0xAD, 0x81, 0x72, 0x61, 0x72, 0x41, 0xF2, 0xC2, 0xDF, 0x6E, 0x02,
-    0x20, 0x2F, 0x03, 0x92, 0x66, 0xA2, 0xE6, 0x52, 0x87, 0x58, 0xE8, 0xDC, 0x7B, 0x69, 0x69, 0x72,
-    0x89, 0x46, 0x0A, 0xE7, 0xAF, 0xAE, 0x5E, 0x96, 0x48, 0x76, 0xC7, 0x22, 0x49, 0xA8, 0xB3, 0x8D,
-    0x2D, 0x73, 0x58, 0xDE, 0x7C, 0x97, 0xE6, 0xFD, 0x23, 0x48, 0x28, 0x7B, 0x8C, 0x57, 0x57, 0xA2,
-    0xBB, 0xAF, 0x54, 0x38, 0xEE, 0xAD, 0x7B, 0xB3, 0x37, 0xD3, 0x28, 0x57, 0x34, 0x90, 0x15, 0xDF,
-    0xFA, 0x0E, 0x24, 0x14, 0x0D, 0x94, 0xD0, 0xC0, 0x20, 0x72, 0xEF, 0xF5, 0x48, 0xC8, 0xAD, 0xCE,
-    0x8D, 0xF7, 0x10, 0x85, 0x48, 0x8A, 0xFB, 0x53, 0xFE, 0xEB, 0x9B, 0x84, 0x95, 0x8F, 0x89, 0xCB,
-    0xBE, 0xDD, 0x31, 0xA6, 0xBC, 0x5A, 0x31, 0xFD, 0xB5, 0xBB, 0x8F, 0xC3, 0xE9, 0x4C, 0x99, 0xAA,
-    0x62, 0x11, 0xC8, 0x80, 0xF2, 0x5E, 0x76, 0x30, 0xA4, 0xED, 0x6B, 0x33, 0xA4, 0xAB, 0xDB, 0xB7,
-    0x4A, 0x97, 0xEC, 0x47, 0x46, 0x00, 0x46, 0x6C, 0xE5, 0x3C, 0x96, 0x26, 0xE9, 0xE5, 0x5A, 0xD3,
-    0xF5, 0x72, 0xCE, 0x0A, 0x29, 0x29, 0x48, 0xA8, 0xB2, 0xE8, 0x60, 0x4D, 0x39, 0xAD, 0x29, 0x7F,
-    0x7D, 0x62, 0xBA, 0x72, 0xDF, 0x09, 0xF8, 0xE3, 0x9F, 0x72, 0xB7, 0x4A, 0x0E, 0x70, 0xD1, 0x9A,
-    0x1E, 0x5F, 0x82, 0x35, 0x39, 0x11, 0x15, 0x5B, 0x91, 0xDC, 0xC6, 0x77, 0x59, 0xB7, 0x6F, 0x2C,
-    0xCB, 0xAD, 0x1F, 0x0C, 0xAC, 0x33, 0x51, 0xD6, 0xF6, 0xF9, 0x78, 0xBB, 0x03, 0xD4, 0x68, 0x0B,
-    0x70, 0x09, 0x1C, 0xD9, 0xB0, 0xA6, 0xC8, 0x10, 0x27, 0x12, 0x46, 0xB1, 0x6B, 0x86, 0x64, 0xFC,
-    0xB2, 0x26, 0xDE, 0x2F, 0x08, 0x27, 0xD9, 0x7D, 0x87, 0x4C, 0x7D, 0x22, 0xB7, 0xF9, 0x90, 0xEB,
-    0x95, 0xED, 0xBD, 0x2F, 0x06, 0xFE, 0x61, 0xB4, 0x4B, 0x59, 0x8E, 0x86, 0x0E, 0x48, 0xFA, 0xBD,
-    0x4E, 0x82, 0xA7, 0xDC, 0x67, 0xEB, 0x04, 0x00, 0x22, 0xFE, 0xC1, 0x7E, 0x23, 0xD1, 0x0F, 0xC1,
-    0x0F, 0xB1, 0x0F, 0xA1, 0x0F, 0x91, 0x0F, 0x81, 0x0F, 0x71, 0x0F, 0xB5, 0x4F, 0xD4, 0x43, 0xD0,
-    0xC3, 0x6A, 0x97, 0x90, 0x47, 0x88, 0xA7, 0x74, 0x17, 0x62, 0x6B, 0xBA, 0xC4, 0x56, 0xF7, 0x95,
-    0x45, 0xEB, 0x35, 0x97, 0x3F, 0xB9, 0x20, 0x92, 0x8D, 0xF5, 0xBB, 0xB6, 0x41, 0x1E, 0x12, 0x87,
-    0xA4, 0x41, 0x61, 0x48, 0x16, 0x12, 0x85, 0x24, 0x21, 0x41, 0x48, 0x0E, 0x12, 0x83, 0x57, 0x41,
-    0x4F, 0x5D, 0x72, 0x91, 0x08, 0x24, 0x01, 0x09, 0x40, 0xFC, 0x1B, 0xFB, 0x33, 0xF7, 0xE9, 0xDC,
-    0xFF, 0xF9, 0x46, 0x20, 0xE5, 0x91, 0x0B, 0x2A, 0xFD, 0x9C, 0xB8, 0x77, 0xEE, 0x6F, 0xCE, 0x43,
-    0xC5, 0x1B, 0xEA, 0x1D, 0x1F, 0xF0, 0xFF, 0xD9, 0xD9, 0x05, 0x60, 0x9F, 0x87, 0xDE, 0x4C, 0x15,
-    0x9E, 0x5E, 0x8D, 0x26, 0xB6, 0x38, 0xD4, 0x53, 0x4B, 0x06, 0x43, 0x55, 0x69, 0x2F, 0x84, 0x07,
-    0x57, 0x34, 0xCC, 0x5D, 0xED, 0xEC, 0xE9, 0xBF, 0xE9, 0xCF, 0xFF, 0x99, 0x1F, 0xB7, 0x9E, 0x48,
-    0x3C, 0xAE, 0x04, 0x7F, 0xD2, 0x81, 0x86, 0x4D, 0xE0, 0xF5, 0x60, 0xB0, 0x14, 0x6C, 0x0C, 0xD7,
-    0xF6, 0xA4, 0xA8, 0x08, 0xDA, 0xE3, 0xC9, 0x00, 0x26, 0xFB, 0x51, 0xA8, 0xA2, 0xF9, 0x8F, 0x4C,
-    0xB8, 0xAC, 0x55, 0x39, 0xED, 0xAC, 0x43, 0x40, 0x02, 0xAE, 0x9E, 0xDF, 0x57, 0x9F, 0xAF, 0x13,
-    0xC9, 0x5C, 0xD7, 0x67, 0xA7, 0x07, 0xC0, 0xFC, 0xBE, 0xDF, 0x47, 0x7E, 0xC4, 0xE6, 0x6C, 0x7B,
-    0x42, 0x6E, 0xE3, 0x1D, 0xFF, 0xE7, 0x53, 0xD6, 0xA5, 0x63, 0x34, 0x21, 0x6E, 0xF4, 0x84, 0x70,
-    0x69, 0x7F, 0x07, 0xBC, 0x30, 0x2C, 0xD4, 0x5C, 0xB7, 0xC0, 0x50, 0xCF, 0xFF, 0x1E, 0x48, 0xAA,
-    0x50, 0xDB, 0x93, 0x3D, 0xA6, 0xFA, 0x43, 0xDF, 0x47, 0xBB, 0x82, 0x3B, 0xEC, 0x20, 0x4D, 0xAC,
-    0x90, 0x67, 0x01, 0x3E, 0xCB, 0x90, 0x8B, 0x0C, 0x24, 0xDF, 0x65, 0x2F, 0xB8, 0x0F, 0xD8, 0x71,
-    0x7A, 0xB8, 0x67, 0x81, 0x71, 0x57, 0x38, 0x57, 0x15, 0x27, 0x7D, 0x19, 0x62, 0x02, 0x79, 0x38,
-    0xD9, 0x03, 0x22, 0x66, 0x7E, 0x5F, 0x60, 0xBF, 0x1D, 0x60, 0x23, 0xE2, 0xC2, 0xEE, 0xA4, 0xFE,
-    0xF7, 0x02, 0x87, 0xF4, 0xC5, 0xBE, 0xF2, 0x1D, 0xBB, 0xBD, 0x65, 0x36, 0xB2, 0x81, 0xC5, 0x66,
-    0xDE, 0x4A, 0xED, 0xDE, 0x4A, 0x20, 0x6E, 0xE1, 0x2E, 0x65, 0xC4, 0xAC, 0x7C, 0xB5, 0xA5, 0xD4,
-    0xCA, 0xD8, 0xDF, 0xC2, 0x87, 0xC7, 0x78, 0x8E, 0x48, 0xA8, 0x35, 0x59, 0x57, 0xB1, 0x2C, 0x8B,
-    0x19, 0x91, 0x14, 0x96, 0xD4, 0xD5, 0xAB, 0x24, 0x4C, 0x18, 0xA0, 0x7F, 0xDA, 0x62, 0xE7, 0xDB,
-    0xC2, 0xEF, 0xF0, 0xD8, 0xEB, 0x2C, 0x88, 0x0B, 0xEA, 0xE1, 0xBA, 0xFF, 0x85, 0xFB, 0x17, 0x76,
-    0xF8, 0xD8, 0x27, 0xC2, 0x82, 0xF7, 0xDF, 0x36, 0x2B, 0x11, 0x88, 0x9E, 0x18, 0x29, 0x05, 0xA2,
-    0x73, 0xF3, 0x8C, 0x63, 0x10, 0xFD, 0x5B, 0x0B, 0x42, 0x05, 0xC3, 0xD5, 0xF3, 0x7B, 0xC7, 0x82,
-    0x80, 0x7F, 0x49, 0x1A, 0x08, 0xDC, 0x50, 0xC0, 0x9E, 0xD1, 0xBB, 0x63, 0xD9, 0x3B, 0xDD, 0xFA,
-    0x0D, 0x82, 0x50, 0x71, 0x97, 0xEE, 0x60, 0xDD, 0xC9, 0xC7, 0xAC, 0x0A, 0x48, 0xAA, 0xCA, 0x86,
-    0x43, 0x5D, 0x97, 0x99, 0x98, 0x8A, 0x59, 0x4C, 0xFF, 0x88, 0x84, 0x22, 0x31, 0x0D, 0x0A, 0xDC,
-    0x58, 0x4C, 0x4C, 0x8C, 0xDE, 0xB9, 0xA2, 0x77, 0xAB, 0xCE, 0x20, 0x0A, 0xDB, 0xFC, 0x19, 0x6A,
-    0xE5, 0x63, 0x59, 0xE5, 0x17, 0x2B, 0x1C, 0x58, 0xE0, 0xBB, 0xB7, 0xD8, 0x51, 0x32, 0xA2, 0x5E,
-    0x10, 0x13, 0xE4, 0x44, 0x4E, 0x25, 0x28, 0x93, 0x94, 0x89, 0xEA, 0x48, 0x56, 0x4E, 0xC9, 0x89,
-    0xAD, 0x91, 0x91, 0x65, 0x0A, 0x25, 0x53, 0xAB, 0x93, 0xEC, 0xB7, 0xB4, 0x6E, 0xFF, 0x17, 0x6A,
-    0x77, 0x53, 0x6A, 0x91, 0x67, 0x3B, 0x76, 0x35, 0xF1, 0x97, 0xF1, 0xC4, 0xCD, 0x62, 0xF9, 0x61,
-    0x2C, 0xAF, 0x4C, 0xBC, 0x35, 0x66, 0x49, 0x1A, 0xE2, 0x0A, 0xFB, 0xBE, 0x9D, 0xFA, 0x95, 0x64,
-    0x85, 0xAB, 0x1A, 0xD8, 0x89, 0x06, 0x0E, 0xAC, 0x9E, 0x0A, 0x35, 0xD2, 0xA3, 0x53, 0xD4, 0x02,
-    0x71, 0x4F, 0xFC, 0x34, 0x56, 0x5B, 0x2A, 0x7A, 0xAE, 0x04, 0x4E, 0x0E, 0x2E, 0xF4, 0x59, 0xE5,
-    0x1C, 0x3B, 0x4E, 0xF0, 0xAF, 0xC8, 0x6F, 0x57, 0x13, 0xF2, 0x6B, 0x3C, 0xE2, 0xB4, 0x78, 0x80,
-    0xDE, 0x92, 0x81, 0xE3, 0x0F, 0x0B, 0xB4, 0x43, 0x08, 0xB4, 0x29, 0xF3, 0x50, 0xF6, 0x8C, 0x63,
-    0x87, 0x96, 0x75, 0xE8, 0x1E, 0x9A, 0x86, 0xC1, 0x2B, 0x6D, 0x33, 0x0B, 0xA4, 0xFD, 0x65, 0x97,
-    0x61, 0x42, 0x21, 0xEA, 0xCF, 0x17, 0x4B, 0xF8, 0xAF, 0x84, 0x7A, 0x97, 0xBA, 0xD6, 0x1D, 0x95,
-    0x62, 0xAC, 0xC4, 0x58, 0x88, 0xB1, 0x0E, 0x63, 0x19, 0xC6, 0x2A, 0x8C, 0x45, 0x18, 0x6B, 0x30,
-    0x96, 0x60, 0xAC, 0xC0, 0x58, 0x80, 0x31, 0x00, 0xB3, 0xFC, 0x62, 0xF5, 0xC5, 0xE2, 0x4B, 0xB5,
-    0x17, 0xE2, 0xF8, 0x0A, 0xE7, 0x26, 0x7B, 0x43, 0x40, 0xE9, 0x73, 0x88, 0x66, 0x5A, 0xBA, 0x7F,
-    0x44, 0x48, 0xE7, 0xDB, 0x50, 0x06, 0x4B, 0x97, 0x67, 0xB3, 0xFD, 0x7E, 0xE1, 0xA4, 0xF1, 0xD6,
-    0xF9, 0x3D, 0x55, 0x4E, 0xFC, 0xFF, 0x24, 0x50, 0xF9, 0xAA, 0xA5, 0x13, 0x95, 0xB4, 0xD4, 0x0E,
-    0x59, 0x75, 0x35, 0xB0, 0x8F, 0xA3, 0xD9, 0x53, 0xD5, 0x1F, 0x5B, 0x6A, 0x3E, 0x8F, 0x17, 0x2C,
-    0x33, 0x54, 0xF2, 0x0E, 0xF5, 0xB4, 0x14, 0x6A, 0xD8, 0xC0, 0x9C, 0x67, 0x16, 0xCC, 0x17, 0x65,
-    0x68, 0xFC, 0x5D, 0x57, 0xBE, 0x51, 0x5C, 0x52, 0x7F, 0x70, 0x5E, 0xDE, 0xE4, 0x7B, 0x37, 0xDE,
-    0xA9, 0x43, 0x18, 0xD3, 0x9E, 0x99, 0x7F, 0x16, 0xD0, 0x33, 0xA2, 0x0E, 0x08, 0x4A, 0x5A, 0x24,
-    0xFC, 0x78, 0xA8, 0x49, 0x10, 0xBF, 0x56, 0x33, 0xFD, 0x9C, 0x2C, 0x6D, 0xF4, 0xA0, 0x33, 0xD1,
-    0xB2, 0x75, 0x27, 0x7F, 0xB9, 0x04, 0x40, 0x09, 0x54, 0x2E, 0x3C, 0xCD, 0x04, 0xE5, 0xCF, 0x66,
-    0xB4, 0xA5, 0xA2, 0xD4, 0xE5, 0x0B, 0x55, 0xC9, 0xB2, 0xA8, 0x05, 0x87, 0x4F, 0xBF, 0xC9, 0x0D,
-    0xAA, 0x07, 0x88, 0x72, 0x95, 0xED, 0x3E, 0x31, 0xEE, 0xEC, 0x97, 0x01, 0x13, 0x43, 0xA2, 0xDA,
-    0x5D, 0xEA, 0x76, 0xA9, 0xD9, 0x65, 0xBD, 0xAE, 0x43, 0xAB, 0x6B, 0x69, 0xC3, 0xA8, 0x9F, 0x2E,
-    0x32, 0x8C, 0xF1, 0xC3, 0x61, 0xFD, 0x4C, 0x9A, 0x12, 0x71, 0x76, 0xE8, 0xF4, 0x1C, 0x42, 0xE0,
-    0x6E, 0x89, 0x0A, 0x4D, 0x60, 0x48, 0xAD, 0xEA, 0x07, 0xDE, 0x05, 0x6C, 0xAD, 0x0E, 0x6B, 0xBD,
-    0xFB, 0xE3, 0x9C, 0x5A, 0x69, 0x46, 0x65, 0xAC, 0x4D, 0x73, 0xE6, 0x0B, 0x90, 0x4A, 0x33, 0x2A,
-    0x1B, 0x2E, 0x7C, 0x81, 0x67, 0x54, 0x81, 0xE8, 0xE6, 0xE2, 0xB3, 0xDE, 0xBA, 0xA3, 0x79, 0x4B,
-    0x98, 0x21, 0x7F, 0xE1, 0x66, 0x54, 0xA1, 0x59, 0xA5, 0x8E, 0x23, 0x29, 0x8E, 0x64, 0xC2, 0xDD,
-    0xD2, 0x1D, 0xB8, 0x74, 0x20, 0x62, 0xCD, 0xAA, 0x23, 0x87, 0x96, 0x73, 0x94, 0xC2, 0x02, 0xAF,
-    0x0F, 0x88, 0xB0, 0x00, 0x96, 0xDA, 0x6C, 0x7E, 0x0E, 0x86, 0x6C, 0x80, 0x56, 0x37, 0x36, 0x14,
-    0x81, 0xD5, 0x8D, 0xA1, 0xDA, 0x1E, 0x1C, 0xE2, 0x98, 0x06, 0xF5, 0xBE, 0xA4, 0x71, 0xF6, 0x8E,
-    0x4C, 0x9E, 0x3F, 0x64, 0x8D, 0x4B, 0x8B, 0x27, 0x7D, 0x2A, 0x62, 0x38, 0xE3, 0x0B, 0xCF, 0x24,
-    0x00, 0x4B, 0xB5, 0x9F, 0x59, 0xDC, 0x74, 0xD6, 0x86, 0x56, 0x55, 0x47, 0xCC, 0x1E, 0xCA, 0x71,
-    0x3C, 0x8B, 0x4F, 0xE1, 0xBF, 0xF9, 0x3E, 0x44, 0xC5, 0x9D, 0xA1, 0x81, 0xA2, 0x99, 0x47, 0x5D,
-    0x0C, 0x5B, 0xCB, 0xCF, 0x66, 0xCF, 0x98, 0x91, 0xFE, 0x94, 0xBF, 0xCA, 0x9E, 0x52, 0xED, 0xB9,
-    0xE7, 0xC4, 0x2F, 0xEF, 0xE9, 0xBF, 0x84, 0xC6, 0xE4, 0x8C, 0xAB, 0xDD, 0x0B, 0xA8, 0x1B, 0x26,
-    0x0A, 0xE3, 0xC5, 0x97, 0x0C, 0x93, 0x8A, 0x18, 0x9C, 0x03, 0xB5, 0xCC, 0x21, 0xD8, 0x2D, 0x1E,
-    0xD9, 0x4B, 0x8F, 0x47, 0x36, 0x7C, 0x93, 0xD1, 0xAB, 0xDE, 0x64, 0x4C, 0x54, 0x1D, 0x68, 0x4D,
-    0x6F, 0xC5, 0x90, 0x39, 0xD1, 0xD9, 0x54, 0x41, 0xE6, 0x65, 0x62, 0x36, 0x39, 0x07, 0x2F, 0x99,
-    0x7D, 0x44, 0x8D, 0x1E, 0x0B, 0x9A, 0x73, 0xAE, 0x0A, 0x6E, 0x52, 0x5E, 0x64, 0x49, 0x63, 0x23,
-    0x1B, 0x1A, 0xD9, 0xC8, 0x28, 0x0C, 0x8C, 0x6C, 0x5C, 0xA4, 0x61, 0x91, 0x8D, 0x8A, 0x6C, 0x50,
-    0x64, 0x63, 0x22, 0x1B, 0x12, 0xD9, 0x88, 0xC8, 0x06, 0x44, 0x36, 0x1E, 0xB2, 0xE1, 0x90, 0x8D,
-    0x86, 0x6C, 0x30, 0x64, 0x63, 0x30, 0x1B, 0x82, 0x69, 0x24, 0x64, 0x03, 0x21, 0x1B, 0x07, 0x05,
-    0x32, 0x57, 0x7E, 0x21, 0x4F, 0xBD, 0xB2, 0xB4, 0x39, 0x76, 0x16, 0x8E, 0x71, 0x34, 0xC4, 0xD1,
-    0x08, 0x47, 0x03, 0x1C, 0x8D, 0x6F, 0x34, 0xBC, 0xD1, 0xE8, 0x66, 0x73, 0xDC, 0xE7, 0x50, 0x69,
-    0x31, 0x5B, 0xE9, 0x5E, 0xEA, 0x57, 0x9F, 0x83, 0xEC, 0x35, 0xD9, 0xD1, 0xD4, 0xD2, 0x46, 0x36,
-    0x72, 0x86, 0xE3, 0x38, 0x92, 0x28, 0x50, 0x6E, 0xBE, 0xBD, 0x5B, 0xD6, 0xE4, 0x3F, 0x9A, 0xA3,
-    0xDE, 0x83, 0xBA, 0x45, 0x7A, 0x5D, 0x19, 0xE2, 0xA4, 0xF4, 0xA3, 0xC9, 0xBA, 0x0E, 0x5C, 0x37,
-    0x3D, 0xD7, 0x94, 0x09, 0x18, 0x04, 0x70, 0x2D, 0x7E, 0x76, 0x67, 0x3F, 0x47, 0xDE, 0xE3, 0xAE,
-    0xC3, 0x78, 0x76, 0xFB, 0x33, 0xBA, 0x0E, 0x6E, 0x25, 0x98, 0xD0, 0x2F, 0x6A, 0x26, 0x89, 0xFF,
-    0x3A, 0x4F, 0x93, 0xD3, 0xBF, 0xE5, 0x21, 0x71, 0x13, 0x5E, 0xD9, 0x58, 0x64, 0x7C, 0xA5, 0xE3,
-    0x18, 0x77, 0x68, 0x7B, 0xCF, 0xF3, 0xBB, 0x19, 0x7A, 0x15, 0xCD, 0x85, 0x88, 0x7C, 0x08, 0x2C,
-    0x7F, 0x50, 0x05, 0x7B, 0x70, 0x1A, 0x1B, 0xC2, 0x2A, 0x8C, 0xB9, 0x4A, 0x04, 0x8D, 0xE1, 0x1A,
-    0xC8, 0x65, 0x17, 0xEF, 0x96, 0x48, 0x66, 0x8C, 0x68, 0x89, 0xA4, 0x3F, 0xF8, 0xC6, 0x97, 0x89,
-    0xC0, 0xDF, 0x67, 0xB8, 0x50, 0x22, 0x45, 0x16, 0x78, 0x56, 0x23, 0x0E, 0x95, 0xF9, 0x80, 0xC4,
-    0x55, 0x0F, 0x29, 0xE2, 0xE3, 0x08, 0x67, 0xF8, 0x15, 0x10, 0x78, 0xFA, 0x53, 0x20, 0xF0, 0xFC,
-    0x31, 0xC8, 0xAA, 0xE0, 0xBB, 0xDF, 0x1D, 0x00, 0xC3, 0x1F, 0x77, 0x28, 0xCA, 0x7E, 0xB0, 0x47,
-    0x4D, 0xF6, 0x14, 0x16, 0x50, 0x70, 0xA6, 0x8D, 0x02, 0xEB, 0x18, 0x81, 0xE7, 0xDC, 0xB3, 0x22,
-    0x02, 0xFF, 0x52, 0x74, 0x74, 0xCF, 0x47, 0xD9, 0xC4, 0xBF, 0xDC, 0xE2, 0x3E, 0x99, 0x2F, 0x32,
-    0x6D, 0xFC, 0x23, 0xA7, 0x78, 0xAF, 0xCC, 0x1E, 0xFB, 0xAF, 0x8E, 0xAC, 0x07, 0xA8, 0x86, 0x82,
-    0x03, 0x55, 0xD4, 0x72, 0xD9, 0x87, 0xCF, 0xB1, 0xFD, 0xCF, 0x3F, 0xC1, 0xF2, 0xF4, 0x31, 0xF2,
-    0x8A, 0xA7, 0xB3, 0xB2, 0x44, 0x43, 0x22, 0x62, 0x22, 0x81, 0xA7, 0x64, 0x02, 0x64, 0x35, 0xC0,
-    0xE7, 0x57, 0xA2, 0xA3, 0xBB, 0x51, 0x67, 0xCE, 0x60, 0xAD, 0x75, 0xF8, 0x1F, 0x31, 0x54, 0xE4,
-    0xC4, 0xE6, 0xEB, 0xC5, 0x46, 0x2F, 0xA9, 0x2F, 0xB6, 0x3E, 0xBD, 0x89, 0xAF, 0x23, 0x0C, 0xF5,
-    0x15, 0x63, 0xD4, 0xD6, 0xBD, 0x0B, 0x5A, 0xD6, 0x41, 0x4E, 0xA1, 0x1F, 0x96, 0xFC, 0x0E, 0xFD,
-    0xB0, 0xEA, 0xE5, 0x7E, 0x18, 0xF1, 0xBA, 0x2E, 0x5A, 0x58, 0xA5, 0xFA, 0x84, 0xD9, 0xC6, 0xDD,
-    0x20, 0xAF, 0xD7, 0x2E, 0xB9, 0x07, 0x48, 0xDD, 0xC6, 0xBC, 0x9B, 0xC7, 0xF8, 0xFD, 0x11, 0xAA,
-    0x0F, 0x37, 0x80, 0x86, 0x6B, 0x9F, 0x1B, 0xAF, 0x67, 0x9C, 0x83, 0x7B, 0xF5, 0x69, 0xBF, 0xDA,
-    0x86, 0xBE, 0xFF, 0x66, 0xC7, 0xDE, 0x42, 0x79, 0xED, 0x50, 0xB3, 0xD8, 0x4D, 0x15, 0xAB, 0x9F,
-    0x6A, 0x43, 0xE4, 0x87, 0x6A, 0x7F, 0xA9, 0x1A, 0xCE, 0xEF, 0x5B, 0xE9, 0x18, 0x87, 0x48, 0xDB,
-    0x7E, 0x46, 0xD5, 0xC0, 0x78, 0x90, 0xFB, 0x79, 0x1C, 0xA9, 0x65, 0xFD, 0xB5, 0x9B, 0x2E, 0x45,
-    0x75, 0x92, 0x40, 0xB7, 0xAB, 0xBE, 0xE0, 0xD8, 0x6D, 0xEB, 0xAE, 0x05, 0xBD, 0xB2, 0x38, 0xB3,
-    0x7A, 0x00, 0xC5, 0x64, 0xDA, 0x65, 0xED, 0xA6, 0x63, 0x8F, 0xBF, 0xF8, 0xA0, 0x6E, 0xAB, 0x80,
-    0x0B, 0xEB, 0x27, 0xA5, 0x92, 0x30, 0x3D, 0xB6, 0xDA, 0x6F, 0xB8, 0xA9, 0x10, 0xC5, 0x8A, 0x15,
-    0xDA, 0x7A, 0xF1, 0xEA, 0x6A, 0x54, 0x84, 0x82, 0x58, 0x9F, 0xE3, 0xD3, 0xC9, 0x0E, 0x87, 0x44,
-    0xE5, 0xFA, 0x92, 0x79, 0x55, 0xA0, 0xDE, 0x28, 0xD4, 0xB3, 0x6C, 0xEB, 0xDC, 0x7B, 0x51, 0xE7,
-    0x4E, 0x43, 0xA0, 0xFB, 0x1C, 0x78, 0x95, 0x2C, 0x01, 0x0B, 0xE2, 0xAE, 0xA6, 0xC3, 0x96, 0xEE,
-    0xFD, 0x23, 0x59, 0x72, 0x74, 0xCF, 0xE1, 0xA6, 0xCA, 0xD7, 0x31, 0x8C, 0xC9, 0xDB, 0xC3, 0x98,
-    0xBC, 0x78, 0x61, 0x4C, 0xCE, 0x83, 0x48, 0x33, 0xEF, 0xB7, 0x86, 0x89, 0x3B, 0xF1, 0x72, 0x11,
-    0xB6, 0x61, 0x7F, 0xE2, 0xE4, 0x9D, 0xD3, 0xE2, 0xFB, 0x7D, 0xFA, 0xC3, 0x21, 0x69, 0xC7, 0x55,
-    0x57, 0xB8, 0xD3, 0x75, 0xB8, 0x8D, 0x81, 0x3D, 0xB1, 0x65, 0x41, 0xD3, 0xE7, 0x5E, 0x15, 0x61,
-    0xBE, 0xEE, 0x8C, 0x11, 0x4F, 0x02, 0x7E, 0x10, 0x40, 0x8E, 0x44, 0x4B, 0x12, 0xDF, 0x09, 0x77,
-    0xDE, 0xA9, 0x73, 0x5B, 0x7C, 0xD4, 0xBB, 0x6F, 0x1C, 0x19, 0xFB, 0x2B, 0x20, 0x1A, 0x6E, 0x1E,
-    0xF9, 0x2E, 0xF1, 0x43, 0xFA, 0x64, 0xCA, 0xCA, 0x1B, 0xC1, 0xB9, 0xBD, 0x33, 0xCA, 0x62, 0x51,
-    0x96, 0x88, 0x32, 0x83, 0xAF, 0x06, 0x5E, 0x71, 0x58, 0x2E, 0x76, 0x0A, 0xBB, 0x07, 0x07, 0xD6,
-    0x41, 0xC1, 0x8F, 0x18, 0x27, 0x7E, 0x82, 0x25, 0x06, 0x00, 0x70, 0x11, 0xCD, 0xD7, 0xBD, 0xB9,
-    0x7E, 0x1D, 0x77, 0x08, 0x3E, 0x53, 0xF5, 0xBF, 0x6F, 0x4F, 0xE6, 0x8D, 0x05, 0x64, 0xA4, 0x76,
-    0xF1, 0x8B, 0xAD, 0xA9, 0x87, 0x10, 0x7F, 0x1F, 0xB7, 0x6E, 0x31, 0xE0, 0x4B, 0xBE, 0x34, 0xC1,
-    0xBC, 0x68, 0x66, 0x03, 0x4B, 0x7B, 0x40, 0xB3, 0xE9, 0xA1, 0xCA, 0xD3, 0xCF, 0x8D, 0xE1, 0x13,
-    0xC6, 0x8D, 0x82, 0xF7, 0x31, 0x32, 0x0E, 0xFD, 0x36, 0xA6, 0x66, 0x0E, 0x63, 0x4E, 0xAF, 0x1D,
-    0xDD, 0xBF, 0xC5, 0x32, 0xBA, 0x10, 0x37, 0x3E, 0x02, 0xEB, 0xBA, 0xAC, 0xC8, 0x51, 0xA3, 0xF3,
-    0x56, 0x99, 0xA8, 0xD0, 0x62, 0x77, 0xE3, 0x16, 0x2B, 0x3D, 0x3F, 0x1A, 0x23, 0x6A, 0xD3, 0xAA,
-    0x4B, 0x9B, 0xF6, 0x4C, 0xC1, 0xF0, 0x77, 0x6B, 0xD1, 0xDA, 0x34, 0x73, 0xAF, 0x5B, 0x4F, 0xB1,
-    0x57, 0x57, 0xB8, 0x5C, 0xBF, 0x03, 0xE5, 0xFE, 0x12, 0x06, 0xD9, 0x82, 0xBE, 0x8E, 0xF9, 0x2F,
-    0x2B, 0xDD, 0xB5, 0x60, 0x67, 0x23, 0xC0, 0xFE, 0xC8, 0xBA, 0x47, 0x1D, 0x94, 0x6D, 0xAC, 0x76,
-    0x6B, 0xB8, 0x0D, 0x33, 0xFC, 0x36, 0xB7, 0x61, 0x74, 0x01, 0x3A, 0xF7, 0x61, 0x0E, 0x14, 0x4D,
-    0x0F, 0x91, 0xC5, 0xDA, 0x64, 0xC7, 0x4E, 0x5B, 0x79, 0xB9, 0x7C, 0x2E, 0xF1, 0xB1, 0x50, 0x7C,
-    0x6C, 0xDD, 0x70, 0x14, 0x1F, 0x7F, 0x5F, 0x3E, 0xA5, 0xCF, 0x8A, 0x97, 0x6F, 0x35, 0xC4, 0x4D,
-    0x3F, 0x78, 0x59, 0x9F, 0x97, 0x7A, 0xD9, 0x65, 0x4D, 0x6C, 0x95, 0xF4, 0xBA, 0x66, 0xCA, 0xEE,
-    0x80, 0x86, 0xDE, 0x37, 0x36, 0x20, 0x75, 0x46, 0x35, 0xAF, 0x6A, 0xB4, 0xFC, 0x6B, 0x14, 0x1E,
-    0x5F, 0x54, 0xF8, 0xE5, 0xDE, 0xFA, 0x11, 0x92, 0x25, 0xDC, 0xC1, 0xAF, 0x39, 0x5E, 0x07, 0xE0,
-    0x01, 0xE2, 0x79, 0xCF, 0x2D, 0x59, 0xE0, 0x15, 0xCE, 0xD8, 0xAF, 0xC0, 0xDD, 0xD9, 0xB5, 0xF3,
-    0xBC, 0x4C, 0xF9, 0x04, 0x15, 0x8E, 0x7B, 0x53, 0x77, 0xCA, 0x26, 0xC3, 0xDC, 0xEA, 0x96, 0x92,
-    0xA8, 0x62, 0xB2, 0xE0, 0xB7, 0x22, 0xE4, 0x63, 0x4F, 0x42, 0xB6, 0xB5, 0x3B, 0x45, 0xD1, 0xF4,
-    0xEE, 0xD7, 0x85, 0xB0, 0xCA, 0x0A, 0x36, 0x9F, 0x2D, 0x73, 0xF7, 0x70, 0x47, 0x6D, 0xB0, 0x5E,
-    0xD4, 0x86, 0x90, 0xB9, 0x5C, 0xE6, 0xFA, 0x74, 0x90, 0x66, 0xC3, 0x88, 0xD3, 0x27, 0x66, 0xB9,
-    0xA3, 0xE1, 0x4A, 0xB5, 0x68, 0xEB, 0xC1, 0xAE, 0xA3, 0x19, 0x01, 0xEE, 0x3E, 0x84, 0x57, 0xF3,
-    0x8E, 0x2B, 0xAB, 0x03, 0xD2, 0x13, 0xC2, 0x2D, 0x9B, 0x0D, 0xBC, 0x84, 0x99, 0xEE, 0xAD, 0x59,
-    0x7F, 0x62, 0x48, 0x66, 0xE4, 0xFF, 0xA0, 0x67, 0xA8, 0x54, 0xA7, 0xBC, 0x98, 0x20, 0x9B, 0x97,
-    0x12, 0xE4, 0x8B, 0xF7, 0xE8, 0x36, 0xF3, 0x3D, 0xBA, 0x7E, 0xB9, 0x60, 0xB9, 0xDC, 0xB2, 0x64,
-    0xA9, 0xCD, 0x42, 0xE0, 0xDD, 0xB9, 0xE8, 0x5C, 0x6B, 0x46, 0x50, 0x3B, 0x37, 0xF1, 0x7E, 0x52,
-    0xC5, 0x53, 0x87, 0xB7, 0xC7, 0x9B, 0xA9, 0xA5, 0x4E, 0x43, 0x02, 0x96, 0x37, 0x2D, 0x75, 0x7E,
-    0x50, 0xA2, 0x98, 0x2F, 0x18, 0x6A, 0x4B, 0xE3, 0x83, 0x9F, 0xD9, 0x71, 0xCF, 0x6A, 0x11, 0x1C,
-    0x7F, 0xEE, 0xD8, 0x1D, 0x38, 0x02, 0xF1, 0x4C, 0xFD, 0xB5, 0xF4, 0xF9, 0x2D, 0xD0, 0x79, 0xB5,
-    0x0C, 0xDD, 0x47, 0x7F, 0xB8, 0x02, 0xAE, 0xCE, 0x7E, 0xC4, 0x8E, 0x7B, 0xA4, 0xFC, 0x6E, 0x73,
-    0xB0, 0xD8, 0xD7, 0x9C, 0x8F, 0xDD, 0xCD, 0xBA, 0xC3, 0xFD, 0x4F, 0x6B, 0x41, 0xCC, 0x7F, 0xEA,
-    0xE1, 0xE6, 0x62, 0xCF, 0xFA, 0xD2, 0x76, 0x69, 0xBC, 0x9A, 0xE6, 0x19, 0xF2, 0xDB, 0xDE, 0x20,
-    0xBE, 0x1A, 0x02, 0x13, 0x75, 0x77, 0xA3, 0x7C, 0xE9, 0x1A, 0x70, 0x98, 0x66, 0x95, 0x96, 0xF6,
-    0x36, 0xFF, 0x50, 0xEF, 0x5E, 0x6A, 0x89, 0x6B, 0xBC, 0x46, 0x95, 0xEA, 0x72, 0x7A, 0xC2, 0x6F,
-    0x24, 0xDF, 0x9A, 0x16, 0x1E, 0x16, 0x74, 0x69, 0x0D, 0x43, 0xE2, 0xA1, 0x4A, 0xA7, 0xEF, 0x58,
-    0x68, 0x92, 0x00, 0xE4, 0xA3, 0x82, 0x33, 0x81, 0x3F, 0x3B, 0xFE, 0x7B, 0x82, 0x5A, 0xB7, 0xB0,
-    0xEC, 0x6F, 0x09, 0xEC, 0x2F, 0x09, 0x6C, 0xA0, 0x18, 0x1D, 0x0F, 0x14, 0xD9, 0xC7, 0xB3, 0xBF,
-    0x9E, 0x59, 0xBA, 0x63, 0x42, 0xB6, 0xEA, 0x91, 0x95, 0xD6, 0x23, 0xB3, 0x3B, 0xEE, 0xBC, 0xE2,
-    0xEE, 0xCF, 0x1F, 0x0E, 0x6A, 0x95, 0x58, 0x5F, 0xBB, 0x3B, 0x5C, 0xD6, 0x80, 0x12, 0x15, 0xAC,
-    0x9D, 0x1C, 0xDE, 0x7A, 0x7B, 0xE1, 0x6F, 0x75, 0x6C, 0xCD, 0xF5, 0x97, 0x3A, 0x76, 0x94, 0xAD,
-    0x36, 0x50, 0xEC, 0x60, 0x9B, 0x91, 0x0D, 0x14, 0xA7, 0xDF, 0x79, 0xA0, 0xC8, 0x3E, 0xD4, 0x04,
-    0x71, 0xB1, 0x6D, 0x71, 0xD4, 0x87, 0x4A, 0xFE, 0x7F, 0x7D, 0xA8, 0xFF, 0x05, 0xAD, 0x55, 0x31,
-    0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x6C, 0xDF, 0x9D, 0x93, 0x33, 0x30, 0x11, 0xEC, 0x4A, 0x28, 0xC9,
-    0xC5, 0x48, 0x50, 0xC0, 0xE9, 0x36, 0x4E, 0x91, 0xE2, 0x22, 0xED, 0xEE, 0x0C, 0x02, 0x89, 0x76,
-    0x85, 0x6E, 0x95, 0x0E, 0xAE, 0xA0, 0x88, 0x82, 0x50, 0xAE, 0x58, 0x89, 0x0D, 0xEC, 0xAD, 0x0D,
-    0x29, 0x29, 0xD8, 0x82, 0x1F, 0xB0, 0x05, 0x45, 0xB2, 0x5B, 0xB0, 0xC5, 0x16, 0x17, 0xE9, 0xEE,
-    0x6C, 0xAA, 0x48, 0xB9, 0x82, 0x11, 0x0D, 0x48, 0x14, 0x58, 0x22, 0x5D, 0x9A, 0x11, 0xB2, 0x84,
-    0x41, 0xF6, 0x0E, 0x6F, 0xBC, 0xE1, 0x42, 0x28, 0x52, 0x31, 0x1E, 0x7B, 0xD7, 0x33, 0x6F, 0xDE,
-    0xCC, 0x7B, 0xEF, 0xFB, 0x3E, 0xD7, 0x05, 0x4F, 0x99, 0x72, 0x33, 0xAB, 0xC0, 0x0E, 0xBA, 0x70,
-    0x16, 0x60, 0x39, 0x02, 0x89, 0x50, 0xA0, 0x06, 0xA0, 0x2E, 0x2C, 0x9D, 0xBA, 0x5A, 0xF9, 0xBF,
-    0x15, 0xA1, 0x28, 0x77, 0x50, 0xA7, 0x31, 0x78, 0x99, 0x8F, 0x40, 0x1F, 0x23, 0xD4, 0x05, 0x0E,
-    0xFD, 0x0C, 0x1D, 0x4B, 0xE0, 0xFC, 0x64, 0xC4, 0xB5, 0x0A, 0x75, 0x5A, 0xEF, 0x8A, 0xF3, 0x93,
-    0x49, 0xC4, 0xB5, 0x4E, 0xE8, 0x8E, 0xEA, 0xDD, 0x2E, 0x39, 0xDA, 0xD9, 0x47, 0xCE, 0xA7, 0x19,
-    0xD7, 0xA9, 0xA7, 0x23, 0x74, 0xC8, 0x07, 0x8F, 0xE2, 0x44, 0x27, 0xB4, 0x0B, 0xFC, 0x77, 0x52,
-    0xFE, 0x95, 0xA2, 0x7E, 0xD9, 0x95, 0x40, 0x9C, 0xC6, 0xD9, 0x7B, 0xB9, 0x93, 0x05, 0x29, 0x17,
-    0x6F, 0xC1, 0x12, 0x41, 0x36, 0x2C, 0x0E, 0x5A, 0x07, 0xAD, 0x61, 0x11, 0x64, 0x96, 0xB0, 0x76,
-    0xEA, 0xC2, 0x2D, 0xC2, 0x84, 0x29, 0x0D, 0x7E, 0x27, 0xC7, 0x91, 0x27, 0xD1, 0x59, 0x05, 0x1D,
-    0xBD, 0x1E, 0x5A, 0x25, 0x3F, 0xC9, 0x98, 0x96, 0x9E, 0x26, 0x33, 0xAC, 0x0A, 0x96, 0xF8, 0x51,
-    0x20, 0x38, 0x38, 0xDA, 0x18, 0xE2, 0x06, 0xEA, 0xAB, 0x82, 0xB3, 0x64, 0xE8, 0x47, 0xFB, 0xBE,
-    0x38, 0x0A, 0x70, 0x77, 0x13, 0xF5, 0xB7, 0x3B, 0xFC, 0x41, 0xCE, 0x7E, 0x2C, 0x5C, 0x55, 0x5A,
-    0x19, 0x37, 0x9E, 0x06, 0xC0, 0x02, 0xB5, 0xB2, 0xD6, 0xFC, 0xE8, 0xA0, 0x6D, 0xAB, 0xE0, 0xF4,
-    0xBC, 0x3B, 0xF0, 0x4C, 0x3C, 0x2A, 0x9C, 0xAA, 0x43, 0x2B, 0xEB, 0xD0, 0x50, 0x69, 0x17, 0x4E,
-    0xEE, 0x29, 0x5F, 0x71, 0x19, 0x26, 0x75, 0x38, 0xA5, 0x53, 0x78, 0x19, 0x53, 0xBE, 0xE4, 0x09,
-    0xA7, 0x34, 0xE9, 0xEA, 0x8A, 0x11, 0xD2, 0x65, 0xDE, 0xFF, 0x3B, 0x5F, 0x17, 0x61, 0x12, 0x48,
-    0x96, 0x3A, 0x8A, 0x7C, 0x75, 0x61, 0x6B, 0xB8, 0x05, 0x98, 0xA2, 0xBC, 0x2C, 0x73, 0x8C, 0xFE,
-    0xEA, 0x9C, 0xAB, 0xBA, 0x82, 0x02, 0xE5, 0x68, 0x03, 0x8D, 0x0E, 0x57, 0xAD, 0x4E, 0x1F, 0xE7,
-    0xCC, 0x1C, 0xD7, 0xC9, 0xE6, 0x34, 0x81, 0x1B, 0xC1, 0x15, 0xF0, 0x00, 0x56, 0xF5, 0xB3, 0x20,
-    0x47, 0x96, 0x36, 0xBE, 0x9C, 0x12, 0x41, 0x8E, 0x30, 0xC5, 0x71, 0xE5, 0xCB, 0xA5, 0x44, 0xB4,
-    0x28, 0xB6, 0x7D, 0x4A, 0xC5, 0x59, 0xD8, 0x91, 0x93, 0xB8, 0xD1, 0xAD, 0x47, 0x3A, 0x03, 0x36,
-    0xEF, 0xF2, 0xC2, 0x8D, 0x5C, 0xE1, 0x55, 0x76, 0x4E, 0xE2, 0x24, 0x61, 0x7E, 0xEB, 0x91, 0x87,
-    0x75, 0xDC, 0xBC, 0xAB, 0x73, 0x03, 0x00, 0x18, 0x28, 0xC4, 0x30, 0x7D, 0x01, 0xBB, 0x04, 0x2F,
-    0xC0, 0x33, 0x70, 0x89, 0xF5, 0xC8, 0x4F, 0x82, 0x84, 0xA2, 0x89, 0xF8, 0xCF, 0xBC, 0xF0, 0x0B,
-    0xFB, 0x5B, 0xAA, 0x65, 0xC2, 0x53, 0x4E, 0x11, 0x3E, 0x5B, 0x55, 0x4A, 0xBC, 0x3A, 0x2E, 0xB2,
-    0x66, 0xD6, 0x3C, 0x2E, 0xB8, 0xB2, 0xC8, 0x2B, 0xCB, 0x58, 0x1A, 0x54, 0x79, 0x70, 0x52, 0x96,
-    0x51, 0xE4, 0xC5, 0xF5, 0x22, 0xCC, 0x43, 0xE9, 0x28, 0x96, 0x70, 0x53, 0xB3, 0x31, 0xA7, 0x5C,
-    0xE1, 0x49, 0x15, 0x7D, 0x11, 0xC0, 0xD4, 0xD1, 0x54, 0x71, 0x7D, 0x32, 0x81, 0xAF, 0x35, 0x1A,
-    0x14, 0x71, 0x13, 0x97, 0xE8, 0x6E, 0x10, 0xBE, 0x56, 0xCC, 0xE9, 0x67, 0xDB, 0x1B, 0xF7, 0xCB,
-    0x01, 0xFF, 0x95, 0xD6, 0xD1, 0x50, 0x1D, 0xDC, 0x5A, 0x20, 0x38, 0xC9, 0x40, 0x98, 0x80, 0x4B,
-    0x65, 0xB4, 0xBA, 0x15, 0xA0, 0x01, 0xAD, 0xE0, 0x50, 0x70, 0xEC, 0xF7, 0xC2, 0xC0, 0xB0, 0xB2,
-    0xAD, 0xA1, 0xD6, 0x46, 0xC1, 0x1F, 0xE7, 0xBE, 0x56, 0xA6, 0xE4, 0x3B, 0x26, 0x97, 0xAE, 0x96,
-    0xF4, 0xCA, 0xA7, 0x39, 0xA1, 0xB7, 0x56, 0xA1, 0x16, 0x6E, 0xC6, 0x84, 0xAF, 0x63, 0xAA, 0xC0,
-    0x02, 0x03, 0x2F, 0xA7, 0x75, 0x06, 0xFA, 0x63, 0x42, 0x06, 0x75, 0x82, 0x3E, 0xC1, 0x5D, 0xC4,
-    0x5A, 0xCB, 0x9B, 0x44, 0x81, 0x55, 0xFA, 0x4F, 0x47, 0x95, 0x86, 0x0E, 0x66, 0xAD, 0x99, 0x33,
-    0x94, 0xD8, 0xA4, 0x10, 0x4C, 0xB3, 0x73, 0x2F, 0x61, 0xFA, 0xBB, 0xC8, 0x84, 0xD3, 0xF6, 0x4A,
-    0x98, 0x2D, 0x68, 0x4E, 0x84, 0x64, 0x43, 0xB7, 0xE8, 0x12, 0x75, 0xC8, 0x5E, 0xEB, 0x34, 0xAC,
-    0x9E, 0xB1, 0x79, 0x4A, 0x3C, 0x6D, 0x33, 0xB8, 0x39, 0x78, 0x6E, 0xD3, 0x31, 0xA9, 0x2E, 0x29,
-    0x98, 0x58, 0x26, 0x62, 0xD9, 0x18, 0x55, 0x01, 0x01, 0x85, 0x4B, 0x45, 0xA7, 0x76, 0x48, 0xB7,
-    0x65, 0x2A, 0xEA, 0x98, 0xFC, 0x18, 0xAA, 0xFD, 0xCF, 0x16, 0x9B, 0xC6, 0x62, 0x1D, 0x2C, 0x72,
-    0x09, 0x45, 0x1E, 0x95, 0xF1, 0x1A, 0xDE, 0xC4, 0xAB, 0x4D, 0x6C, 0xF5, 0xD1, 0xBC, 0xDF, 0x1D,
-    0x68, 0x9D, 0x77, 0xBB, 0x15, 0xF3, 0x75, 0x71, 0xAD, 0x3B, 0xE8, 0x61, 0x7B, 0x86, 0x5E, 0xAC,
-    0xD5, 0x64, 0x32, 0x36, 0x6E, 0xFE, 0xC8, 0x5B, 0xC3, 0x4F, 0xA8, 0x82, 0xF4, 0x7F, 0x05, 0x8D,
-    0x81, 0x6F, 0x80, 0xA0, 0x7A, 0xAA, 0xCA, 0x53, 0xE6, 0x49, 0x26, 0xBC, 0xC8, 0xA9, 0xFC, 0x9A,
-    0x83, 0x3C, 0x27, 0xB3, 0xA2, 0xFE, 0x2F, 0x41, 0xB3, 0xBA, 0x6E, 0xC9, 0xB2, 0x40, 0xC6, 0xA6,
-    0x9E, 0xFF, 0xAD, 0x9E, 0xBF, 0xAC, 0xDE, 0x4D, 0xC4, 0xC9, 0x87, 0x09, 0x4B, 0x98, 0x20, 0x1D,
-    0xB1, 0xA8, 0x32, 0xEC, 0xCE, 0xA2, 0x0D, 0x7E, 0x92, 0x93, 0xC2, 0x7C, 0x4D, 0x32, 0x73, 0xD9,
-    0x4F, 0x0E, 0x68, 0xC7, 0x6A, 0x3D, 0x41, 0x53, 0x84, 0xA3, 0x50, 0x06, 0xC9, 0x92, 0x85, 0x3A,
-    0x19, 0x4E, 0xA6, 0x51, 0x0F, 0x9E, 0x98, 0x11, 0x1C, 0xC7, 0x14, 0xFD, 0x73, 0x4F, 0x56, 0x09,
-    0x50, 0x9B, 0x45, 0x43, 0x23, 0x40, 0xE2, 0xC6, 0x79, 0x02, 0x63, 0x9C, 0x7E, 0x2C, 0xED, 0xC4,
-    0x44, 0x46, 0x61, 0x5B, 0x1B, 0xB5, 0xA0, 0xE8, 0x0F, 0xB5, 0x9A, 0x69, 0xF9, 0xFE, 0xF7, 0xD5,
-    0x8E, 0xAB, 0x66, 0xD3, 0xAA, 0x63, 0x6D, 0x74, 0xD1, 0x2F, 0x07, 0xAD, 0x38, 0xEB, 0x91, 0xE8,
-    0xCD, 0x61, 0x17, 0x04, 0x20, 0x60, 0x5C, 0xC5, 0x95, 0x6F, 0x31, 0x9D, 0x37, 0xFC, 0xD4, 0x88,
-    0xB3, 0xEC, 0x11, 0x14, 0xE7, 0x61, 0x62, 0x74, 0xF1, 0x0B, 0xE1, 0x7E, 0x29, 0xB9, 0xCE, 0xFD,
-    0x69, 0xEA, 0x3A, 0x4B, 0x58, 0xB8, 0x44, 0xD2, 0x60, 0xC4, 0x88, 0x3A, 0x0D, 0x84, 0x86, 0xBE,
-    0x72, 0xF9, 0xDC, 0x33, 0x93, 0xF4, 0xA4, 0x55, 0x72, 0x17, 0x0F, 0xAF, 0x60, 0x84, 0x33, 0xE2,
-    0x65, 0x1A, 0x7B, 0x01, 0x66, 0xE5, 0x2E, 0x08, 0x9D, 0xBB, 0xF4, 0x1C, 0x8F, 0x9E, 0x58, 0x52,
-    0xF5, 0xAF, 0xC8, 0x3D, 0xAA, 0xFC, 0x39, 0xB9, 0x67, 0x66, 0xA5, 0xB1, 0xA1, 0xE3, 0x9C, 0x81,
-    0x6D, 0x56, 0x89, 0x57, 0x80, 0xD7, 0xAC, 0x87, 0x57, 0x11, 0x2D, 0x7D, 0x2E, 0x57, 0x7D, 0x16,
-    0x6D, 0x46, 0x9B, 0xB4, 0x63, 0x28, 0x49, 0x41, 0x60, 0xF4, 0x89, 0x08, 0x9E, 0x94, 0x88, 0xB0,
-    0x46, 0xBF, 0x6D, 0xA2, 0x73, 0x1B, 0x01, 0xD6, 0x60, 0x1D, 0x0B, 0xA6, 0xD3, 0x60, 0xAA, 0x5A,
-    0xC8, 0xFA, 0xC5, 0x81, 0x55, 0x02, 0x05, 0x2A, 0xF1, 0x7B, 0x23, 0xE2, 0x29, 0xC9, 0x8C, 0x6C,
-    0x99, 0x60, 0x3B, 0x9E, 0xE4, 0xA2, 0x8D, 0x0B, 0x92, 0x8E, 0x45, 0xBE, 0x7C, 0xC2, 0xC7, 0x50,
-    0x8C, 0x31, 0xB2, 0xC4, 0x91, 0x93, 0xFA, 0x0F, 0x14, 0x3B, 0xE9, 0x1D, 0xBF, 0xB4, 0x2D, 0xB7,
-    0x2E, 0x1A, 0x5C, 0x7A, 0xA7, 0xB8, 0x3C, 0xFD, 0xFC, 0x18, 0x28, 0x47, 0xAF, 0x7F, 0xC3, 0x73,
-    0x4F, 0x5E, 0x52, 0x67, 0x46, 0x06, 0xCA, 0xBF, 0x64, 0xB7, 0x8F, 0x06, 0xB3, 0xED, 0x17, 0xA9,
-    0xDF, 0x5E, 0x0C, 0xFC, 0x9F, 0xD4, 0x55, 0xEC, 0x21, 0x96, 0xD3, 0xC4, 0x4E, 0x6C, 0x61, 0x08,
-    0x60, 0xAB, 0xEA, 0xAB, 0x25, 0x83, 0x47, 0x58, 0xD3, 0xC2, 0x23, 0x4E, 0x96, 0xA4, 0xBA, 0xC4,
-    0x4F, 0xE0, 0x82, 0xFE, 0x13, 0x24, 0xB2, 0xC6, 0x86, 0x1B, 0x9B, 0x34, 0xC8, 0x68, 0x2A, 0x7A,
-    0xC6, 0x66, 0xDD, 0xD8, 0x10, 0x3C, 0x26, 0x06, 0x17, 0xBA, 0x22, 0xB8, 0x41, 0x49, 0xD7, 0x50,
-    0xFF, 0x1E, 0x11, 0x7D, 0x41, 0x34, 0x2F, 0x69, 0x60, 0x89, 0x58, 0x12, 0xF3, 0xBF, 0x04, 0x06,
-    0x8C, 0xAC, 0xA6, 0x39, 0x7F, 0x4C, 0x3F, 0x6A, 0x1F, 0x6B, 0xB1, 0x8E, 0x4C, 0x2A, 0xCE, 0xFD,
-    0x43, 0x75, 0x5B, 0x2F, 0x08, 0x6D, 0xB4, 0x38, 0x27, 0x61, 0xA3, 0x26, 0x18, 0xED, 0x11, 0x93,
-    0x32, 0x13, 0x1C, 0xD2, 0x7B, 0xC6, 0x60, 0xFC, 0x54, 0x17, 0x1C, 0x23, 0x52, 0xDD, 0xEB, 0x69,
-    0x25, 0x2D, 0x45, 0x25, 0x2D, 0x15, 0xCD, 0x9C, 0x0A, 0xB0, 0x16, 0xEC, 0x77, 0xFD, 0xB2, 0xD9,
-    0xEC, 0x37, 0xFB, 0xFD, 0xFD, 0x8C, 0xCF, 0x68, 0x64, 0xCC, 0x0E, 0x1B, 0x4D, 0x9E, 0xB7, 0x44,
-    0x6B, 0xD7, 0x57, 0xE6, 0x4B, 0xB3, 0x6E, 0x28, 0x4A, 0xA5, 0x6A, 0xA2, 0x4F, 0x40, 0x9C, 0xC1,
-    0x1A, 0xF9, 0xB9, 0x59, 0xD1, 0x6B, 0xEE, 0x13, 0xD9, 0x88, 0xC0, 0x2B, 0x5B, 0x8D, 0x26, 0x35,
-    0xE3, 0xA1, 0x4D, 0x75, 0xB7, 0x47, 0x81, 0x1A, 0x90, 0xA5, 0xC2, 0xFD, 0xA8, 0xA2, 0x4E, 0xF5,
-    0xBD, 0xB2, 0x3F, 0x00, 0xC9, 0x56, 0x93, 0x9C, 0x34, 0xD1, 0xEB, 0x63, 0x3F, 0x43, 0x30, 0xAB,
-    0x74, 0x8B, 0xAE, 0x4B, 0xBB, 0x41, 0xD1, 0xAA, 0x3C, 0xCC, 0x7B, 0xB3, 0xD9, 0xCA, 0xEE, 0x6E,
-    0xB0, 0x28, 0x5A, 0xAD, 0xA5, 0xCF, 0xFE, 0x7C, 0x3E, 0x9F, 0x99, 0x41, 0x5F, 0x05, 0xA7, 0x87,
-    0x70, 0xC0, 0x3A, 0x5C, 0x6E, 0x54, 0xC7, 0x6A, 0x55, 0x7A, 0xD4, 0xA9, 0xA9, 0xF9, 0x2C, 0xFD,
-    0x34, 0xF9, 0x3C, 0xE2, 0x34, 0xB2, 0x6A, 0x09, 0xF7, 0x07, 0x38, 0x05, 0xAC, 0x0C, 0x0E, 0x7D,
-    0x12, 0x06, 0x68, 0x35, 0xF0, 0x37, 0xD5, 0x7D, 0x4D, 0xAC, 0xDE, 0xD6, 0x99, 0xDE, 0xF9, 0x3E,
-    0x5A, 0x22, 0xC6, 0x04, 0x86, 0x6A, 0x21, 0x15, 0x53, 0x1B, 0x13, 0x76, 0x11, 0x14, 0x81, 0xD1,
-    0x84, 0x9B, 0x59, 0x04, 0x28, 0x26, 0xA4, 0x6D, 0x0C, 0xBC, 0x98, 0x85, 0x34, 0x80, 0x64, 0x03,
-    0xE3, 0x85, 0xB2, 0xC8, 0xA2, 0x4D, 0xA7, 0xBD, 0xB3, 0x19, 0x20, 0x0B, 0xDB, 0xA4, 0xEC, 0x85,
-    0x17, 0x5E, 0x44, 0x40, 0x67, 0xB2, 0xE8, 0x66, 0xBC, 0xF0, 0x14, 0xCE, 0x15, 0x30, 0xEA, 0x62,
-    0x16, 0x29, 0x6A, 0x9B, 0xB4, 0x05, 0xD4, 0x40, 0xB3, 0x30, 0x63, 0xD7, 0xE3, 0x45, 0x16, 0xA6,
-    0xFF, 0x26, 0x13, 0xB9, 0x80, 0x28, 0x8B, 0x8A, 0xA8, 0x2B, 0x92, 0xA7, 0xEF, 0xF3, 0xBC, 0x87,
-    0xFC, 0xF8, 0x5D, 0x5D, 0xC9, 0x76, 0x22, 0x2B, 0xCA, 0x4D, 0xEE, 0xA1, 0x7C, 0x2F, 0x2F, 0x79,
-    0xCE, 0x7B, 0xDE, 0x9F, 0xE7, 0xFD, 0x3B, 0x9F, 0x31, 0xA7, 0x8C, 0x7C, 0x59, 0x0C, 0x59, 0x2E,
-    0x43, 0x5C, 0xCA, 0x10, 0x54, 0x32, 0xAC, 0x52, 0xA3, 0x5F, 0x89, 0xB5, 0xA9, 0xC9, 0xDC, 0x60,
-    0x4C, 0x81, 0xC1, 0xE2, 0x5E, 0xF9, 0x89, 0x59, 0xE1, 0x4F, 0xD7, 0x3A, 0xEC, 0xBE, 0x64, 0x3C,
-    0x6B, 0x1B, 0x1D, 0x7C, 0x0C, 0x41, 0x2F, 0xBF, 0x08, 0x3B, 0x0C, 0x2D, 0x86, 0x46, 0x86, 0x08,
-    0x43, 0xBC, 0xB7, 0x9B, 0xE3, 0xC1, 0x25, 0x86, 0x5C, 0x9F, 0xAE, 0x5F, 0xEB, 0xE6, 0x69, 0x63,
-    0xFC, 0x76, 0x94, 0xA1, 0x91, 0xC1, 0xAB, 0x5F, 0x31, 0x8B, 0xAF, 0xBB, 0x35, 0x17, 0xF9, 0x97,
-    0xD5, 0x21, 0x73, 0x83, 0xCC, 0x25, 0xA9, 0x31, 0x03, 0xD0, 0x26, 0x01, 0x95, 0x32, 0x0C, 0xC5,
-    0xC5, 0xB3, 0xF2, 0x72, 0xFC, 0x56, 0xEE, 0x4B, 0x57, 0x32, 0x94, 0x32, 0x8D, 0xA2, 0x5A, 0x8F,
-    0x72, 0xA7, 0x37, 0x60, 0xE8, 0x65, 0xF0, 0x7B, 0x53, 0x94, 0x41, 0xFF, 0xB8, 0x2D, 0xC3, 0xAE,
-    0xB0, 0x69, 0xD8, 0x16, 0x83, 0xCC, 0xA0, 0xC0, 0x44, 0x0E, 0x71, 0x61, 0xA7, 0x38, 0x7F, 0x19,
-    0xE4, 0x6F, 0xDC, 0xE4, 0xB8, 0x15, 0xC7, 0x16, 0x2B, 0xCF, 0x17, 0xCB, 0xDF, 0x5E, 0x39, 0x37,
-    0x50, 0x97, 0x2F, 0x33, 0xD1, 0x67, 0xE8, 0x80, 0x45, 0xFB, 0x18, 0x82, 0x03, 0x56, 0xAE, 0xCB,
-    0xDF, 0x5E, 0x95, 0x7E, 0xAD, 0x8A, 0x31, 0x35, 0x21, 0xC8, 0x26, 0xAF, 0xAC, 0x8C, 0xDD, 0x3B,
-    0x5F, 0x7A, 0x36, 0x5F, 0xA5, 0x3E, 0x1E, 0x1F, 0xE2, 0x79, 0x11, 0x1E, 0x15, 0x5F, 0x3D, 0x95,
-    0xEA, 0x1D, 0x13, 0xFD, 0x4A, 0x93, 0xBD, 0x2B, 0x3F, 0x23, 0x6D, 0xF4, 0xA1, 0x7C, 0x7C, 0x6B,
-    0x8E, 0x98, 0xC8, 0x3E, 0xDE, 0xE8, 0x33, 0xB9, 0x29, 0xB2, 0x0E, 0x21, 0x9D, 0x39, 0xE1, 0xDE,
-    0xE8, 0xDB, 0x8F, 0xE5, 0xEF, 0x47, 0x21, 0x63, 0xBF, 0xB2, 0x17, 0x7B, 0x4F, 0x16, 0xE3, 0x8D,
-    0xEE, 0xDB, 0x62, 0x47, 0xE5, 0x61, 0x56, 0xD6, 0x90, 0xC8, 0x0F, 0x42, 0x59, 0xF8, 0x5A, 0x5E,
-    0x25, 0x74, 0xD6, 0xB7, 0x24, 0xD5, 0x09, 0x93, 0x55, 0xCF, 0x08, 0x79, 0x41, 0x9C, 0xCC, 0x0E,
-    0xF2, 0x32, 0x79, 0xEF, 0x51, 0x9D, 0x84, 0x4C, 0x46, 0xFE, 0x5F, 0xE4, 0xA0, 0x17, 0xF6, 0x08,
-    0x3C, 0x22, 0xCF, 0x15, 0x02, 0x09, 0x79, 0x84, 0x38, 0xC2, 0x19, 0xC2, 0x17, 0x42, 0x1B, 0xA1,
-    0x87, 0xFC, 0x3F, 0x6E, 0x30, 0x69, 0xFD, 0x3B, 0x7E, 0x3D, 0x9D, 0x18, 0x33, 0x66, 0xA9, 0x7C,
-    0x1B, 0xF3, 0xCA, 0x1F, 0x2F, 0x98, 0xB1, 0x52, 0x9A, 0xE1, 0x3E, 0x79, 0x3A, 0xB7, 0x43, 0x76,
-    0x03, 0xFB, 0x80, 0x6F, 0x6C, 0x05, 0x36, 0x01, 0x7B, 0x80, 0x2D, 0x00, 0x03, 0x82, 0xFF, 0xB0,
-    0x09, 0xD8, 0x03, 0x50, 0x1F, 0xC4, 0x07, 0x85, 0xF0, 0x28, 0x7D, 0x1D, 0xF6, 0x69, 0xBA, 0x8B,
-    0x77, 0x4C, 0x77, 0x55, 0x9B, 0xBB, 0x8A, 0x72, 0x7E, 0x99, 0x99, 0x5E, 0x36, 0xD1, 0x6B, 0xD8,
-    0xBC, 0x2C, 0x58, 0x3C, 0x26, 0x69, 0xCC, 0xAE, 0x90, 0xB0, 0x10, 0xAA, 0x15, 0x10, 0x9C, 0x6E,
-    0x5A, 0x44, 0x64, 0x2D, 0x76, 0xD2, 0xC4, 0xEE, 0x9A, 0x70, 0x6F, 0xB0, 0x3B, 0x7A, 0x2D, 0x72,
-    0x32, 0x88, 0xBC, 0x8B, 0xDB, 0x29, 0xEF, 0x23, 0x9B, 0xC8, 0x3B, 0xB3, 0xFF, 0xAB, 0xFC, 0x56,
-    0x80, 0xD4, 0xF2, 0x5E, 0x6B, 0x75, 0xB1, 0x10, 0x18, 0xCC, 0xC1, 0x3E, 0x21, 0x73, 0x0C, 0x3A,
-    0xB9, 0x53, 0x5E, 0x1A, 0xB6, 0xB8, 0xB3, 0x94, 0xB9, 0x78, 0xBC, 0x26, 0x35, 0xFE, 0x22, 0x97,
-    0x1D, 0xF4, 0xFA, 0xB5, 0x3C, 0xDB, 0x96, 0xFE, 0x78, 0x1E, 0x22, 0x97, 0x06, 0xC2, 0x01, 0x26,
-    0x19, 0x1C, 0xF7, 0xB5, 0x72, 0x1D, 0xD3, 0x25, 0xCD, 0x57, 0x23, 0x65, 0xCF, 0x73, 0x97, 0x81,
-    0x73, 0x24, 0x9F, 0xDB, 0x9C, 0x9C, 0x2E, 0x8F, 0xE8, 0x39, 0x41, 0x90, 0x51, 0xE8, 0x02, 0x12,
-    0xAC, 0x65, 0x52, 0xB2, 0x3E, 0x0F, 0x17, 0x9B, 0xEA, 0x45, 0xDE, 0xB8, 0x5B, 0xEC, 0xD9, 0x3A,
-    0x80, 0x80, 0x26, 0x8D, 0xDC, 0x9D, 0x95, 0x51, 0x23, 0x77, 0x17, 0xB8, 0x34, 0x58, 0x79, 0x23,
-    0xA4, 0x13, 0x7E, 0xAA, 0x65, 0x13, 0xEC, 0xA7, 0xB6, 0x4C, 0x6A, 0x08, 0xB8, 0x10, 0x62, 0x8D,
-    0xB5, 0xCA, 0xCB, 0xAD, 0xB0, 0xF0, 0x97, 0x50, 0x15, 0x2F, 0x6E, 0x54, 0x45, 0x7E, 0x80, 0xAA,
-    0x28, 0x65, 0x15, 0x59, 0xE9, 0x63, 0x90, 0x39, 0x15, 0xB9, 0xCC, 0x08, 0xAA, 0x42, 0x48, 0x1E,
-    0x36, 0x14, 0x6E, 0x73, 0xE8, 0x24, 0xB7, 0x4A, 0x37, 0xA8, 0x9C, 0x35, 0xB7, 0xC7, 0xDD, 0x5C,
-    0x9D, 0x58, 0x50, 0x09, 0xFC, 0x90, 0x94, 0xFE, 0x80, 0xFB, 0x40, 0x87, 0x22, 0x17, 0x0E, 0x10,
-    0x0A, 0x91, 0x75, 0x1E, 0x26, 0x97, 0x82, 0x82, 0x2B, 0xAB, 0x44, 0x2A, 0x1A, 0x88, 0x19, 0x44,
-    0xCA, 0x83, 0x9E, 0x81, 0xC6, 0x2C, 0xC1, 0x44, 0x58, 0x42, 0xD0, 0xE1, 0x4F, 0xC3, 0x16, 0x6C,
-    0x14, 0x36, 0xCA, 0x50, 0x50, 0x01, 0x71, 0x03, 0x72, 0xCB, 0x46, 0x62, 0xBD, 0x95, 0xC7, 0x17,
-    0x52, 0x85, 0x99, 0x43, 0x9C, 0x09, 0x95, 0xCD, 0x34, 0xB7, 0x9E, 0xF3, 0x7A, 0x95, 0xE3, 0xD1,
-    0xCD, 0x3C, 0xCB, 0x35, 0x34, 0x6E, 0xE9, 0x63, 0xCC, 0x43, 0xE8, 0xB5, 0x34, 0x86, 0x62, 0x13,
-    0x32, 0x62, 0x14, 0x62, 0xAD, 0xC6, 0xF5, 0x38, 0x9A, 0xF5, 0xE0, 0xEF, 0x89, 0xB8, 0x0E, 0xE1,
-    0x95, 0x5E, 0x58, 0x2C, 0x7E, 0x07, 0x63, 0xF2, 0x7C, 0x67, 0xFC, 0xCE, 0x06, 0xAD, 0x09, 0x7E,
-    0x35, 0xC8, 0x7E, 0x85, 0xD7, 0x3A, 0x8C, 0x16, 0x7B, 0x17, 0xD9, 0x2A, 0xAA, 0x65, 0x2C, 0xE3,
-    0x4A, 0x38, 0x1B, 0x9B, 0x20, 0x7A, 0x03, 0x63, 0x0F, 0x33, 0x97, 0xB5, 0x94, 0x57, 0xA7, 0x78,
-    0x9A, 0xB0, 0x86, 0xC5, 0x89, 0xE7, 0xC5, 0x9B, 0x62, 0x20, 0xB1, 0x67, 0xB6, 0x93, 0x75, 0xCA,
-    0x26, 0x41, 0x59, 0x60, 0x0E, 0xD0, 0x7F, 0xF2, 0x9F, 0x42, 0x0E, 0xD9, 0x14, 0x6C, 0xB4, 0xA5,
-    0x40, 0x16, 0x29, 0xD6, 0x9E, 0x3D, 0x8B, 0x1D, 0x49, 0x2E, 0xE0, 0x09, 0xC9, 0x4F, 0xB1, 0xF6,
-    0xF8, 0x12, 0x55, 0x2D, 0x84, 0x44, 0x26, 0x57, 0x72, 0xC4, 0x93, 0x03, 0x6E, 0x1D, 0xAD, 0x92,
-    0x89, 0x71, 0xE3, 0xF7, 0x29, 0x70, 0x05, 0x6F, 0x29, 0x78, 0x8B, 0x4A, 0xE9, 0xA1, 0x99, 0xF3,
-    0x2D, 0x76, 0x73, 0x6D, 0x27, 0xF6, 0x17, 0xB6, 0x1F, 0xB0, 0xA7, 0x60, 0x7E, 0x9B, 0xCA, 0x24,
-    0xE5, 0x06, 0x79, 0xDE, 0x9A, 0x9C, 0x2F, 0x33, 0x94, 0x0D, 0x90, 0x1B, 0x64, 0x9E, 0x72, 0x83,
-    0x8C, 0x72, 0x83, 0x88, 0x32, 0xB9, 0x1D, 0x37, 0x60, 0x6C, 0xC1, 0x45, 0x60, 0x75, 0x08, 0x26,
-    0xC4, 0x51, 0x6C, 0xE1, 0x64, 0xFD, 0xDC, 0x48, 0xA6, 0x76, 0x46, 0x43, 0x0D, 0x86, 0x1B, 0x55,
-    0x2D, 0x3C, 0xA0, 0x74, 0xF4, 0x30, 0x5F, 0xEC, 0xA2, 0x2E, 0x31, 0xC6, 0x90, 0x5C, 0x02, 0x55,
-    0x76, 0xC0, 0x70, 0x42, 0xDB, 0xF5, 0x10, 0x55, 0x32, 0x11, 0x19, 0x82, 0x56, 0x86, 0xB0, 0x91,
-    0xFD, 0x89, 0x2B, 0x21, 0x7D, 0x72, 0xF1, 0x7C, 0x03, 0x89, 0x68, 0x20, 0x11, 0x0D, 0x44, 0x13,
-    0x7C, 0x15, 0x36, 0x54, 0xC9, 0xF2, 0xAA, 0xB0, 0x15, 0x1A, 0x07, 0xAD, 0x4C, 0x54, 0xF4, 0xD9,
-    0x64, 0x05, 0xF3, 0xA5, 0x15, 0x4C, 0x97, 0xF6, 0xDF, 0x81, 0x00, 0xD1, 0x19, 0x93, 0xFD, 0x97,
-    0x6D, 0x1B, 0x8B, 0x51, 0x16, 0xEE, 0x0B, 0x79, 0x3A, 0x2A, 0x04, 0x0C, 0x50, 0x44, 0x51, 0x13,
-    0x0C, 0xB2, 0xE6, 0xA2, 0x57, 0xB5, 0xE7, 0x8C, 0xD8, 0x75, 0xAA, 0xC1, 0x8F, 0x37, 0x68, 0x03,
-    0x3A, 0x53, 0xF6, 0xCF, 0x42, 0x86, 0x6C, 0x0A, 0x65, 0x60, 0xA0, 0x0A, 0xB8, 0x19, 0xE7, 0x84,
-    0xFE, 0xD0, 0x06, 0xD3, 0xDB, 0x06, 0xA1, 0xF3, 0x1A, 0x2F, 0x72, 0xB2, 0x2B, 0x83, 0x08, 0x85,
-    0xA8, 0x3D, 0x6B, 0xA2, 0x3D, 0x99, 0x46, 0x4C, 0xF5, 0xA6, 0x6F, 0x83, 0x62, 0xBB, 0x7B, 0x76,
-    0xDD, 0xA7, 0xEE, 0x09, 0x38, 0x86, 0x54, 0xD6, 0x21, 0xE6, 0x62, 0xA2, 0x9A, 0x72, 0x5C, 0xE1,
-    0x49, 0x09, 0x95, 0x85, 0xA8, 0x8C, 0x16, 0xEC, 0x85, 0xE7, 0x70, 0xBD, 0x32, 0x0F, 0x79, 0x1C,
-    0xD8, 0xBD, 0x32, 0xD4, 0x54, 0x86, 0x5A, 0x0A, 0x6C, 0x34, 0xB3, 0x8E, 0xEC, 0x92, 0x4D, 0xEF,
-    0xB7, 0x7B, 0xE7, 0xEC, 0x3F, 0x87, 0x50, 0xAF, 0x7D, 0x84, 0xB1, 0x8B, 0xA9, 0x79, 0x31, 0x99,
-    0xB0, 0xC1, 0x6C, 0xA2, 0x06, 0xD3, 0x89, 0x6B, 0xA8, 0xAF, 0xA4, 0x3E, 0x26, 0x8B, 0x3C, 0x96,
-    0xDE, 0x3D, 0x88, 0x29, 0x4C, 0x67, 0x01, 0x5D, 0x42, 0xDD, 0xC3, 0xD9, 0x3C, 0x89, 0x11, 0x1A,
-    0xD7, 0xB4, 0xD9, 0xDE, 0x10, 0x80, 0xC0, 0x56, 0x58, 0x15, 0x0F, 0x2D, 0x1E, 0xED, 0xA9, 0xCB,
-    0xB3, 0x37, 0x3B, 0x0A, 0x66, 0x72, 0x89, 0xE2, 0x80, 0x6D, 0x1C, 0x9C, 0x99, 0xA4, 0x04, 0x5B,
-    0xBD, 0x7A, 0x76, 0xE7, 0x23, 0xEC, 0x54, 0x30, 0xC6, 0x6F, 0xE3, 0xBE, 0xA8, 0x4F, 0x5E, 0xA7,
-    0x5A, 0x90, 0x55, 0xD3, 0x62, 0x57, 0x59, 0x29, 0x14, 0x13, 0x2C, 0x55, 0xE4, 0x59, 0x05, 0x1D,
-    0x20, 0xE6, 0x44, 0x14, 0x55, 0x0F, 0x0A, 0xD3, 0xDC, 0x59, 0x45, 0x56, 0xF8, 0xDA, 0x11, 0x83,
-    0x4D, 0xFE, 0x5D, 0x53, 0x06, 0xF7, 0x9E, 0x94, 0x27, 0xA5, 0xAB, 0x99, 0xDD, 0xCD, 0x44, 0x97,
-    0x7F, 0x75, 0xBE, 0xC7, 0x44, 0x64, 0x9A, 0x19, 0x38, 0x8A, 0xF6, 0xD8, 0xEC, 0xB4, 0x93, 0x76,
-    0x51, 0x36, 0x21, 0x66, 0xEB, 0xCC, 0xFF, 0x7C, 0x58, 0x40, 0x27, 0xB9, 0xB9, 0x00, 0x55, 0x62,
-    0x32, 0xFB, 0xD1, 0x7B, 0x45, 0x17, 0x9B, 0x62, 0x45, 0x7B, 0x4E, 0xF6, 0x4E, 0x08, 0x48, 0x22,
-    0x92, 0xDD, 0x9C, 0xBC, 0x47, 0x6C, 0xC6, 0x6F, 0xD9, 0xB2, 0x66, 0xD8, 0x39, 0x30, 0x5B, 0xC5,
-    0xB1, 0x34, 0x84, 0x11, 0x46, 0xB1, 0x95, 0x22, 0x2A, 0x20, 0xB0, 0x94, 0xF8, 0xCB, 0x28, 0x7B,
-    0xCB, 0xA3, 0x31, 0x67, 0x22, 0x2F, 0x11, 0x3C, 0xE8, 0x0F, 0x3A, 0x24, 0x58, 0x05, 0x18, 0xA7,
-    0x84, 0xE0, 0x5B, 0xA0, 0x0D, 0x05, 0x4B, 0x97, 0x2C, 0x25, 0x7A, 0x00, 0x43, 0xCA, 0x16, 0x88,
-    0xE8, 0x02, 0xDF, 0x57, 0x33, 0xFD, 0x3B, 0x79, 0x69, 0x0D, 0xAA, 0x78, 0xF2, 0xF3, 0x4C, 0xB4,
-    0x2B, 0xF4, 0x63, 0x4F, 0xC5, 0x2F, 0xBC, 0x1A, 0xE9, 0x25, 0x29, 0xF2, 0xD5, 0x28, 0x84, 0x2B,
-    0xD2, 0xD5, 0x30, 0x98, 0xB1, 0x30, 0xEB, 0x7E, 0x58, 0xF5, 0x82, 0xBB, 0xFB, 0xC1, 0xEB, 0x78,
-    0xF1, 0x2F, 0x8F, 0xB2, 0x15, 0x43, 0xF8, 0xE1, 0x20, 0xDA, 0xFD, 0xB5, 0xF8, 0x82, 0xE0, 0xF0,
-    0xE6, 0xB5, 0xE4, 0x51, 0xA8, 0xFE, 0xD7, 0x0A, 0x5F, 0x94, 0x7F, 0x5D, 0x0C, 0xB2, 0x4F, 0x51,
-    0x5D, 0xF4, 0x72, 0x89, 0xAB, 0xAC, 0x95, 0x3D, 0x4A, 0xCA, 0xAC, 0xD1, 0x0B, 0xF6, 0x2A, 0xC9,
-    0x33, 0x6C, 0x16, 0x26, 0x67, 0xE9, 0x73, 0xD0, 0x34, 0x62, 0xC9, 0x45, 0xBE, 0xA6, 0x0A, 0xC1,
-    0x92, 0x05, 0xEF, 0x0D, 0x50, 0x22, 0x3E, 0x4D, 0x23, 0x0D, 0xE4, 0xEE, 0xF9, 0x8E, 0x58, 0xB0,
-    0x75, 0xA3, 0x6F, 0x9D, 0x2A, 0x91, 0x25, 0xC3, 0x34, 0xD6, 0xA0, 0x03, 0x0C, 0x24, 0x5E, 0x05,
-    0x6A, 0xC8, 0xB3, 0xE3, 0x46, 0x71, 0x2B, 0x75, 0x9D, 0x7B, 0xA1, 0xA2, 0x32, 0x75, 0x98, 0xAE,
-    0x53, 0x9F, 0xE6, 0xBA, 0x45, 0x76, 0x0F, 0xA6, 0x2C, 0x8D, 0x3A, 0xE1, 0x93, 0xA0, 0x97, 0x47,
-    0xFA, 0x7D, 0x04, 0x6B, 0x2C, 0x0F, 0xF1, 0x06, 0x79, 0x86, 0x87, 0xFD, 0xF7, 0x31, 0x04, 0x3D,
-    0xF5, 0x28, 0x86, 0x56, 0xFE, 0x33, 0x6E, 0xE4, 0xB7, 0x02, 0x38, 0xC5, 0x68, 0x94, 0xD1, 0xF8,
-    0x24, 0xE1, 0xF0, 0x08, 0x05, 0xD0, 0x62, 0xF3, 0x73, 0xE7, 0x30, 0x2D, 0x4D, 0xB3, 0x02, 0xCE,
-    0x82, 0xFA, 0x48, 0x96, 0x7A, 0x5B, 0x2C, 0x10, 0x2E, 0xB1, 0x00, 0x17, 0x8C, 0xA5, 0x1E, 0x84,
-    0x05, 0x84, 0xD7, 0xB1, 0xFD, 0xA9, 0xAA, 0xF5, 0x2D, 0xF0, 0x21, 0x6F, 0x3F, 0x8B, 0x61, 0x30,
-    0xB3, 0xC9, 0x2A, 0xC1, 0xFF, 0x15, 0x7D, 0x04, 0x1A, 0x09, 0x0E, 0x64, 0x4A, 0x6F, 0x38, 0x4C,
-    0x03, 0x69, 0x41, 0xE3, 0x01, 0xD6, 0x47, 0x94, 0xEE, 0xF8, 0x77, 0x37, 0x6B, 0xEB, 0xDA, 0xDC,
-    0x84, 0x9A, 0xBF, 0x9C, 0x2B, 0xDA, 0x98, 0x83, 0x61, 0xF7, 0x97, 0x72, 0x45, 0xE5, 0x15, 0x03,
-    0xBE, 0xA1, 0xD6, 0x65, 0x5D, 0xDD, 0xEC, 0x9C, 0xCD, 0x7E, 0x5E, 0x79, 0xB0, 0x9F, 0x77, 0x0B,
-    0xD7, 0x0B, 0xDF, 0xF7, 0x04, 0x7A, 0xDC, 0x68, 0xD8, 0x74, 0x71, 0x79, 0x80, 0xEB, 0x7E, 0xD0,
-    0xD2, 0x36, 0x16, 0xD6, 0x11, 0x04, 0xEB, 0x0E, 0xEC, 0xA3, 0x7D, 0x24, 0xE0, 0xB1, 0xF3, 0x7A,
-    0x59, 0x5B, 0xDC, 0xC0, 0x4B, 0x83, 0xDA, 0x80, 0x42, 0x49, 0xCA, 0xA0, 0xE5, 0x45, 0x14, 0x0B,
-    0x7C, 0x17, 0x81, 0x52, 0x82, 0x09, 0x04, 0xD0, 0xC9, 0xD2, 0xE2, 0x21, 0xAE, 0x0A, 0x38, 0x6D,
-    0x16, 0x3B, 0xCD, 0x87, 0xA5, 0xE4, 0x93, 0x8E, 0x5B, 0xF9, 0xEE, 0x72, 0x0E, 0x4E, 0x78, 0x18,
-    0x81, 0x02, 0x03, 0xC0, 0x10, 0x36, 0xCE, 0x59, 0x94, 0xBF, 0x0A, 0x21, 0x3C, 0x42, 0x3D, 0xE8,
-    0x51, 0x4A, 0x8E, 0xD0, 0x0D, 0x5B, 0xB0, 0xD2, 0x60, 0x11, 0xB8, 0xDE, 0x40, 0xF1, 0xE0, 0xDF,
-    0x2D, 0x4D, 0x61, 0x47, 0x94, 0x43, 0x40, 0x70, 0x83, 0x24, 0xBC, 0x82, 0x7B, 0x8A, 0xD7, 0xB9,
-    0x51, 0x20, 0xB0, 0x2C, 0x05, 0x8F, 0x47, 0x30, 0xC6, 0xC4, 0xAD, 0xA1, 0xA8, 0xC1, 0x35, 0xFE,
-    0xA2, 0xE0, 0xBA, 0x73, 0x02, 0xE5, 0x6D, 0x83, 0xEB, 0xF8, 0xD6, 0xE0, 0x3A, 0xDA, 0x07, 0xAE,
-    0xFF, 0x99, 0xB2, 0xDB, 0xBB, 0x31, 0xB3, 0x4A, 0x18, 0xE7, 0x2B, 0x2D, 0x41, 0xB6, 0x3A, 0x79,
-    0x0F, 0x9C, 0x15, 0x1D, 0x09, 0x9C, 0x8C, 0x47, 0x42, 0x27, 0x09, 0xCD, 0xE9, 0xA6, 0xAA, 0x5F,
-    0x2E, 0x88, 0x74, 0x21, 0x75, 0xD8, 0x21, 0x28, 0x79, 0x30, 0x30, 0xFC, 0xFA, 0xDE, 0xD0, 0x97,
-    0x36, 0x7F, 0x7F, 0xFE, 0x96, 0x18, 0x69, 0x4B, 0x68, 0x18, 0xAB, 0x92, 0x39, 0xD3, 0x2E, 0x14,
-    0xA5, 0xBA, 0xA1, 0xF0, 0xD1, 0x4B, 0x7A, 0xA2, 0xB0, 0x11, 0xC0, 0x27, 0xC0, 0xB4, 0xF4, 0x47,
-    0x61, 0x27, 0x84, 0x01, 0x56, 0x00, 0x87, 0xF2, 0x5A, 0xF0, 0x02, 0xAC, 0x0B, 0x66, 0x00, 0xFB,
-    0xE2, 0x0D, 0xEA, 0xCD, 0xF2, 0xA1, 0x01, 0x54, 0x20, 0x7C, 0xDA, 0xD6, 0x41, 0x63, 0x00, 0x7B,
-    0x3E, 0xC1, 0x00, 0x20, 0x63, 0x26, 0x11, 0xCC, 0x14, 0x78, 0x40, 0x20, 0xE4, 0x6E, 0x01, 0x1B,
-    0x4C, 0x2F, 0x9D, 0xA4, 0x5A, 0x5E, 0x5D, 0x38, 0x2D, 0x07, 0x1F, 0xF6, 0xAA, 0x87, 0x31, 0x3F,
-    0xC3, 0xA7, 0x73, 0x5E, 0xB9, 0x5A, 0x3C, 0xC0, 0xEE, 0x79, 0x7E, 0x83, 0xCA, 0x9B, 0x47, 0xE9,
-    0xDB, 0xCC, 0x2F, 0x70, 0xF3, 0x0B, 0x17, 0xF3, 0xEB, 0x75, 0x7E, 0x9C, 0xE7, 0x3C, 0xBF, 0x5A,
-    0xCD, 0x28, 0x79, 0x94, 0x4F, 0x90, 0xED, 0xC4, 0x3C, 0x2F, 0xBA, 0x79, 0x8D, 0xFB, 0xAE, 0xC3,
-    0xEC, 0x3A, 0x6E, 0x5D, 0x03, 0x17, 0x78, 0x09, 0x1D, 0xC8, 0x13, 0x57, 0x99, 0x38, 0x27, 0x51,
-    0x35, 0x34, 0x0D, 0x37, 0x69, 0xB2, 0x77, 0x29, 0xD6, 0xED, 0x56, 0xAC, 0xF1, 0x71, 0x0D, 0x20,
-    0x94, 0x32, 0x1D, 0x06, 0x42, 0x32, 0x04, 0x10, 0x6C, 0x09, 0xFF, 0x23, 0x0D, 0x10, 0x4D, 0x09,
-    0x30, 0x0D, 0xAA, 0x39, 0x0D, 0xA2, 0x10, 0x7F, 0xD7, 0x7C, 0x22, 0x58, 0x9F, 0xA4, 0x74, 0xA8,
-    0x86, 0x4A, 0x0D, 0x16, 0x14, 0x8A, 0x40, 0xED, 0x1A, 0x62, 0x14, 0x27, 0x40, 0xC5, 0x35, 0xC3,
-    0x15, 0x10, 0xE6, 0x56, 0x2F, 0xD0, 0x05, 0xFE, 0x70, 0x7A, 0xF4, 0xE0, 0x55, 0x79, 0x56, 0x5E,
-    0x0D, 0xBF, 0x0A, 0x5E, 0x9B, 0x08, 0x2E, 0xA2, 0x69, 0xC2, 0x85, 0xB2, 0x50, 0x80, 0x19, 0xA1,
-    0xAB, 0xF8, 0x57, 0x1D, 0x58, 0x57, 0xE6, 0x11, 0x51, 0x89, 0xE7, 0x40, 0xBA, 0x0B, 0xDD, 0xBA,
-    0x8C, 0x91, 0x10, 0xF4, 0xE7, 0xDB, 0x0E, 0xDD, 0x09, 0xC6, 0x6F, 0x88, 0x85, 0x3B, 0xE7, 0x62,
-    0x0D, 0xA7, 0x2D, 0x5F, 0xAD, 0x08, 0x67, 0x72, 0xE8, 0xEC, 0x6D, 0x1C, 0x3A, 0x87, 0xA8, 0x11,
-    0x38, 0x84, 0xC8, 0x91, 0x8C, 0xA0, 0x11, 0x10, 0x35, 0x7D, 0xFE, 0x8D, 0xAD, 0x28, 0xCD, 0xA1,
-    0x53, 0x59, 0xB9, 0x0C, 0x69, 0x62, 0x38, 0x76, 0x0A, 0xF7, 0x69, 0x8C, 0x16, 0xF3, 0xA2, 0xFD,
-    0x89, 0x7B, 0xF3, 0xCC, 0xE3, 0xB2, 0x2D, 0x19, 0xE6, 0x47, 0x6B, 0x18, 0x53, 0xA0, 0x8F, 0x6E,
-    0x05, 0xAD, 0x2B, 0xB3, 0x43, 0xF2, 0x8B, 0x7A, 0x21, 0x4A, 0x2F, 0x43, 0xCE, 0x41, 0x90, 0xE3,
-    0x08, 0xFD, 0x25, 0xB6, 0xB3, 0xF6, 0x09, 0x54, 0x60, 0x2A, 0xE5, 0x15, 0x6B, 0x0C, 0x8A, 0x23,
-    0x19, 0xAD, 0x3C, 0x47, 0xE6, 0xA5, 0x2B, 0x30, 0x5D, 0xD7, 0x34, 0xA8, 0x9D, 0x22, 0x1A, 0xD5,
-    0x48, 0x41, 0x07, 0x26, 0x96, 0x0D, 0x6F, 0xE5, 0xCA, 0x5D, 0x90, 0x21, 0xC2, 0x36, 0xC8, 0xC3,
-    0x33, 0xC4, 0x35, 0x3D, 0xFB, 0x23, 0x40, 0x39, 0x46, 0xB1, 0x08, 0x62, 0x10, 0x29, 0xC5, 0x7A,
-    0x03, 0xDA, 0x97, 0x79, 0xDE, 0x87, 0x27, 0x7B, 0x40, 0xD0, 0x0A, 0x1C, 0x29, 0x6E, 0x2E, 0x8C,
-    0x2D, 0x14, 0x63, 0x04, 0x6D, 0xEF, 0x20, 0xAA, 0x8E, 0x42, 0x74, 0x98, 0xBB, 0xE1, 0x74, 0x47,
-    0x78, 0xAB, 0xE1, 0x36, 0x85, 0xBD, 0x32, 0x06, 0xC0, 0x3B, 0x32, 0x0F, 0x6A, 0x18, 0x3A, 0x7F,
-    0xB6, 0x14, 0xEA, 0x0A, 0x8F, 0x0A, 0xC9, 0x65, 0x66, 0x32, 0x93, 0x88, 0x62, 0x4C, 0xE7, 0x67,
-    0x8A, 0x4A, 0x76, 0x09, 0x80, 0x45, 0x96, 0xAE, 0x15, 0x3A, 0xC8, 0x76, 0xF3, 0xED, 0x61, 0xEB,
-    0x0D, 0xB4, 0x46, 0x2A, 0xCA, 0x53, 0x74, 0x7D, 0xD2, 0x8E, 0x35, 0x18, 0xAC, 0x15, 0xC8, 0x1D,
-    0x83, 0xD0, 0xA1, 0xBD, 0x04, 0x13, 0x74, 0x5C, 0x5E, 0x7C, 0x64, 0xDE, 0x8C, 0xC3, 0x83, 0xBC,
-    0x1A, 0xEA, 0x11, 0x81, 0xCB, 0xEB, 0x2B, 0x71, 0xF3, 0xB1, 0x28, 0xC6, 0x66, 0x9B, 0xD7, 0x4C,
-    0xFC, 0x0B, 0x5B, 0x82, 0x73, 0x92, 0x21, 0x6B, 0x04, 0x69, 0xB6, 0x85, 0x3C, 0x56, 0xD4, 0x9F,
-    0x7E, 0x8B, 0x5A, 0x41, 0x4C, 0x30, 0x2B, 0x93, 0x2A, 0xA9, 0x79, 0x5F, 0x1A, 0x5A, 0x3C, 0x4E,
-    0xD6, 0x77, 0x9F, 0x7B, 0x7C, 0x40, 0x3E, 0x10, 0x39, 0xB1, 0xBD, 0x2F, 0xBE, 0x64, 0xD8, 0x79,
-    0x83, 0xD0, 0xBF, 0x87, 0x0C, 0xC8, 0xFD, 0x67, 0xC1, 0x4E, 0x49, 0x05, 0x6F, 0x10, 0x68, 0x2F,
-    0x6C, 0xE3, 0x26, 0x6A, 0x21, 0xA0, 0xF4, 0x0A, 0x8A, 0x71, 0x93, 0x75, 0xC9, 0x28, 0x76, 0x22,
-    0x96, 0x42, 0x42, 0x84, 0x1F, 0xA9, 0xAF, 0x65, 0x13, 0x03, 0xFE, 0x2C, 0xF7, 0x29, 0xD8, 0x39,
-    0x8C, 0x98, 0x8A, 0x51, 0xE3, 0x63, 0xCD, 0x10, 0x76, 0x2E, 0x4F, 0xCD, 0xFE, 0x09, 0x2A, 0x8D,
-    0x1C, 0x03, 0x6C, 0x1C, 0x78, 0xEE, 0xEB, 0x11, 0xDD, 0xD4, 0x71, 0x8A, 0x2B, 0x80, 0xE4, 0x71,
-    0x0D, 0x66, 0xEB, 0x35, 0x2E, 0x9A, 0x86, 0xA3, 0x10, 0x5B, 0xEC, 0x3E, 0x74, 0x32, 0x15, 0x1E,
-    0x0D, 0xFF, 0xA4, 0xD4, 0x93, 0x8A, 0x36, 0x4E, 0x20, 0x57, 0xDC, 0x66, 0xC4, 0x50, 0xE0, 0x1E,
-    0x1A, 0xD8, 0x6E, 0x89, 0x36, 0x02, 0x22, 0x61, 0xC4, 0x74, 0x3A, 0x6F, 0xF4, 0xFB, 0xA0, 0x17,
-    0x3B, 0xDE, 0x06, 0x5D, 0x7C, 0xB5, 0x68, 0x01, 0xE3, 0x40, 0xBB, 0x64, 0xEF, 0xAC, 0x9A, 0x1D,
-    0x99, 0x7F, 0xDC, 0xFA, 0x39, 0xD0, 0x73, 0x40, 0x55, 0x33, 0x6C, 0xC1, 0x16, 0xE1, 0x14, 0xC0,
-    0x0E, 0x31, 0x6F, 0x75, 0xD0, 0x06, 0x56, 0x84, 0x48, 0x3C, 0x81, 0x18, 0x6C, 0x23, 0xBE, 0x5B,
-    0xF6, 0x31, 0x36, 0x2F, 0xAA, 0xE9, 0x5A, 0xF5, 0xF1, 0x07, 0x96, 0x11, 0x92, 0xEC, 0x17, 0xA3,
-    0x06, 0x3C, 0xA8, 0x86, 0x7D, 0xE7, 0x9C, 0x87, 0xA3, 0xBD, 0xC4, 0x6B, 0x23, 0x5E, 0x3D, 0x75,
-    0x2C, 0x54, 0x97, 0xCC, 0xBC, 0xB4, 0x1E, 0x25, 0xF7, 0x8C, 0xC5, 0x2A, 0x12, 0xF1, 0x1E, 0x91,
-    0x6A, 0xC8, 0xDA, 0xF5, 0x00, 0x6C, 0xA5, 0x5B, 0x9B, 0x3A, 0xC9, 0x20, 0x86, 0x05, 0xA2, 0xAD,
-    0xD6, 0x29, 0x67, 0xAE, 0x4A, 0xEC, 0x1C, 0x72, 0x0B, 0xD7, 0x0D, 0xE7, 0xFE, 0x38, 0xA5, 0x07,
-    0x64, 0x2F, 0xBF, 0x27, 0xBE, 0x2A, 0xE4, 0xA8, 0x40, 0xBC, 0x18, 0x7C, 0x22, 0x7E, 0x2C, 0x16,
-    0x23, 0xFA, 0x72, 0x04, 0x2F, 0x03, 0x3A, 0x89, 0x40, 0xF5, 0x10, 0xA4, 0xA4, 0x16, 0x7F, 0x50,
-    0x78, 0x02, 0x36, 0x5E, 0xFC, 0x9A, 0xA6, 0x28, 0x13, 0xF9, 0x2E, 0xEA, 0xE2, 0x6D, 0x5B, 0x65,
-    0xF6, 0x92, 0xF0, 0xDB, 0x4E, 0x19, 0x0E, 0x71, 0xCE, 0xA9, 0x1C, 0x93, 0x27, 0x65, 0xE2, 0x2C,
-    0xC3, 0x61, 0x82, 0xED, 0x08, 0x60, 0x18, 0xD5, 0x49, 0xBE, 0x13, 0xCF, 0x77, 0x81, 0x69, 0xD1,
-    0x76, 0xDE, 0xC8, 0x54, 0x49, 0x48, 0xEF, 0x19, 0x38, 0xA7, 0xE0, 0x86, 0x03, 0x92, 0x33, 0x8E,
-    0x24, 0xEB, 0x8D, 0x6E, 0xC0, 0xBD, 0xBC, 0xAC, 0x9C, 0x04, 0xBD, 0x02, 0x3F, 0xA9, 0xA4, 0x85,
-    0xA1, 0xD3, 0x04, 0x7C, 0x1E, 0xA8, 0x15, 0xB2, 0x70, 0xB3, 0x65, 0x88, 0x3F, 0x01, 0xF0, 0xAA,
-    0x84, 0x70, 0x72, 0x23, 0x90, 0x06, 0x12, 0x34, 0x29, 0x3D, 0x38, 0xE4, 0x69, 0x90, 0xA6, 0x91,
-    0x3D, 0x90, 0xF7, 0xCA, 0x44, 0x4E, 0xF7, 0xDC, 0x0F, 0x60, 0xB7, 0x86, 0x2E, 0xAE, 0xE7, 0x6C,
-    0x29, 0xDC, 0x50, 0x2B, 0x3C, 0x2A, 0x1C, 0x2A, 0xAA, 0x4D, 0xFE, 0x5F, 0xCB, 0x28, 0x02, 0x22,
-    0xA3, 0x40, 0x65, 0xFF, 0x86, 0x30, 0x49, 0x19, 0x5C, 0x6B, 0x12, 0xD1, 0xB7, 0x57, 0x9A, 0x22,
-    0xCB, 0xC3, 0x2B, 0x97, 0x87, 0x22, 0x8D, 0x3E, 0xBA, 0x22, 0x0E, 0x68, 0xF4, 0xCE, 0x8D, 0x46,
-    0x38, 0xFC, 0x82, 0xAD, 0x85, 0xB1, 0x2F, 0xD8, 0xD7, 0x39, 0x3E, 0x2B, 0x9B, 0xF4, 0x9C, 0x95,
-    0xC7, 0x17, 0x8F, 0x8E, 0x1E, 0x75, 0xAD, 0xF8, 0x91, 0xA3, 0xBA, 0x91, 0xF0, 0x22, 0xE9, 0x44,
-    0x72, 0x90, 0x9F, 0x4E, 0xC6, 0x75, 0xD0, 0x30, 0x5A, 0x74, 0xF5, 0x34, 0x80, 0x20, 0x62, 0x94,
-    0x35, 0x9D, 0x47, 0xFA, 0x8E, 0x74, 0x1D, 0x49, 0x84, 0xA4, 0xDE, 0x08, 0x46, 0x81, 0x59, 0xDB,
-    0xCE, 0xB7, 0x7F, 0xDA, 0x8B, 0x56, 0x1B, 0x64, 0xA3, 0x46, 0xD1, 0x69, 0x23, 0x1C, 0x7E, 0x20,
-    0x28, 0x08, 0x1A, 0xE4, 0x0C, 0x0F, 0x82, 0x94, 0x41, 0xC8, 0x7C, 0x5A, 0xFC, 0x6E, 0x16, 0x8C,
-    0x55, 0x1F, 0xB7, 0xEB, 0xDE, 0x0E, 0xC2, 0x88, 0xA3, 0x67, 0xDF, 0x13, 0x06, 0x5E, 0x59, 0x5F,
-    0x26, 0x18, 0xC8, 0xD4, 0x44, 0xE9, 0x70, 0xF3, 0xB1, 0xF1, 0x54, 0x3E, 0x9B, 0x8D, 0x6F, 0x85,
-    0x16, 0x8D, 0x06, 0xF6, 0x68, 0x99, 0x10, 0xEB, 0xCA, 0x92, 0xD9, 0x89, 0xBB, 0x0A, 0xED, 0x22,
-    0xBE, 0xF5, 0x96, 0x13, 0xC7, 0xE4, 0x04, 0xB1, 0x45, 0x01, 0x38, 0x27, 0x42, 0x3A, 0xC0, 0xEA,
-    0xD8, 0x3F, 0x1D, 0x75, 0xE5, 0xE1, 0x0D, 0xEC, 0xEA, 0x67, 0xD0, 0x46, 0xF5, 0xD1, 0xC9, 0xA2,
-    0x1F, 0x64, 0xD6, 0xE7, 0x78, 0xFA, 0x83, 0xCC, 0x44, 0xD5, 0x50, 0x70, 0xBE, 0x7D, 0xBC, 0x84,
-    0x13, 0x07, 0x1E, 0x81, 0x9A, 0x5B, 0xFA, 0x5B, 0x1B, 0xE5, 0xF0, 0x00, 0xF5, 0x75, 0x80, 0xD0,
-    0xCE, 0x82, 0x06, 0x8E, 0x0C, 0x70, 0x73, 0x7B, 0xDB, 0x27, 0xB4, 0x8C, 0x23, 0xD3, 0x3B, 0xEF,
-    0xC9, 0x4A, 0x44, 0x46, 0xD7, 0xB6, 0x2C, 0x72, 0x7F, 0x80, 0xA9, 0xC9, 0x03, 0x80, 0x16, 0xD1,
-    0x6E, 0x1D, 0x58, 0x28, 0x15, 0xF2, 0xF4, 0x44, 0x9F, 0xDC, 0x4F, 0x18, 0x30, 0x59, 0x28, 0xE8,
-    0xC4, 0x94, 0x2D, 0xAD, 0x0C, 0xC4, 0x84, 0xD0, 0x10, 0x37, 0x11, 0x6E, 0x07, 0x9D, 0xCB, 0x2A,
-    0x69, 0x80, 0x24, 0xA5, 0x6B, 0x4C, 0xC6, 0xC5, 0x9E, 0x9E, 0x81, 0xEB, 0xF0, 0xDC, 0x88, 0x50,
-    0x21, 0x62, 0x2B, 0x3F, 0x85, 0x66, 0x7E, 0x0B, 0x2B, 0xBA, 0x54, 0xB9, 0x80, 0x78, 0xCC, 0x08,
-    0x24, 0xA3, 0xE9, 0xC3, 0x04, 0xC8, 0xA3, 0x19, 0xEC, 0x01, 0x80, 0x9C, 0xA3, 0x6B, 0x49, 0xF0,
-    0xC5, 0xE0, 0xE3, 0xD9, 0x05, 0x8A, 0x50, 0x75, 0xCD, 0x38, 0xB0, 0xC6, 0x80, 0x35, 0x08, 0xEC,
-    0x46, 0xBF, 0xA3, 0xA6, 0xC4, 0xDF, 0x6B, 0x26, 0xCF, 0x6A, 0x50, 0xFA, 0x6F, 0xAF, 0x01, 0x20,
-    0x44, 0x1F, 0x60, 0xC9, 0x71, 0x05, 0xE8, 0x95, 0x08, 0x4D, 0x92, 0x9A, 0x63, 0x95, 0x95, 0xF0,
-    0x20, 0x8A, 0x1C, 0x2E, 0x44, 0xF1, 0x08, 0x34, 0xBE, 0x30, 0x91, 0x89, 0xAE, 0xDB, 0x9D, 0x9E,
-    0x2E, 0x9C, 0xBA, 0x83, 0x40, 0x86, 0x9C, 0xCF, 0xF2, 0xB5, 0x7C, 0xA1, 0x83, 0xB3, 0x37, 0x7B,
-    0x2F, 0xF2, 0x22, 0xE4, 0xD1, 0x28, 0xE4, 0x60, 0x8C, 0x0F, 0xA1, 0x21, 0xAE, 0xC1, 0xC8, 0xDA,
-    0x56, 0x8D, 0x24, 0x62, 0xA0, 0xF8, 0x57, 0xEA, 0x42, 0x7C, 0x09, 0x06, 0x7B, 0x1E, 0x06, 0x3B,
-    0x42, 0x64, 0x02, 0xE9, 0x58, 0x6C, 0x6D, 0x56, 0xCB, 0x8C, 0x7E, 0x0D, 0x95, 0x76, 0x15, 0x71,
-    0x91, 0xC4, 0x1E, 0x1F, 0xC2, 0x41, 0x9E, 0xC2, 0xB8, 0x08, 0xA6, 0x1C, 0xE0, 0xF5, 0xCD, 0xE6,
-    0x6F, 0x22, 0x9A, 0x74, 0xA1, 0x42, 0x0D, 0x1A, 0x08, 0x02, 0x2B, 0x85, 0x79, 0x4A, 0x48, 0x83,
-    0xFC, 0x7D, 0x1E, 0x75, 0xCB, 0x14, 0xEB, 0x94, 0xCF, 0xC5, 0x7C, 0x10, 0xDC, 0xC8, 0x03, 0x2A,
-    0xA5, 0x94, 0xEC, 0x02, 0x97, 0xC1, 0x53, 0x66, 0x22, 0x4F, 0x81, 0x5D, 0xE8, 0x11, 0x29, 0x33,
-    0x55, 0x64, 0xA6, 0x44, 0x99, 0x09, 0x53, 0xA5, 0x13, 0x2A, 0xBF, 0xED, 0xE4, 0x39, 0x45, 0x2D,
-    0xD8, 0xA7, 0xF8, 0x47, 0x61, 0x5A, 0x51, 0x17, 0xF6, 0x7D, 0x7B, 0x03, 0xC8, 0xF5, 0xB8, 0xFD,
-    0xA9, 0x40, 0x18, 0x11, 0xF0, 0xB0, 0x82, 0xF5, 0x39, 0x42, 0x9A, 0x7F, 0x45, 0xAF, 0x1D, 0xF8,
-    0x5A, 0xD8, 0x64, 0x79, 0xED, 0x9B, 0x96, 0xAF, 0x85, 0x07, 0x25, 0xAF, 0x65, 0xBA, 0x55, 0x16,
-    0xAF, 0xFE, 0x8C, 0xE7, 0x2E, 0xBD, 0xEE, 0x57, 0xC6, 0x24, 0x3C, 0x36, 0xF2, 0xD4, 0x22, 0x5D,
-    0x71, 0xCA, 0x68, 0xC0, 0xCA, 0xE5, 0x45, 0xCE, 0x23, 0xDC, 0xB7, 0xB6, 0x1A, 0x92, 0x74, 0xFA,
-    0x13, 0x36, 0x45, 0xE1, 0xEC, 0x1C, 0xD8, 0x42, 0xFA, 0x72, 0xC5, 0xCC, 0x31, 0x08, 0x4D, 0x49,
-    0x34, 0x14, 0x53, 0x19, 0x7D, 0xC2, 0xB3, 0x60, 0x38, 0x09, 0x9F, 0x02, 0x0E, 0x44, 0x0D, 0x53,
-    0x22, 0xAB, 0x1B, 0x05, 0x4E, 0x30, 0x69, 0xCB, 0xB5, 0x09, 0x4C, 0x93, 0xDF, 0xB4, 0xD0, 0x6F,
-    0xB2, 0xA7, 0x82, 0x64, 0x6C, 0x45, 0x27, 0xE8, 0x0C, 0xF0, 0xCD, 0x80, 0xC7, 0x1E, 0x9A, 0x24,
-    0x69, 0xB1, 0x99, 0x1A, 0xB4, 0x91, 0x67, 0x43, 0xCF, 0xE2, 0xB9, 0xF2, 0xD4, 0x4E, 0x54, 0x02,
-    0x39, 0x4C, 0xE8, 0xD9, 0xE3, 0xF9, 0xF8, 0x79, 0xC0, 0x8C, 0xED, 0x38, 0xEB, 0x9F, 0xC3, 0x88,
-    0x65, 0x21, 0xBD, 0x04, 0xD0, 0xF5, 0x08, 0x39, 0x85, 0x46, 0xDF, 0xEC, 0x02, 0xA4, 0x58, 0xA4,
-    0x87, 0xF3, 0xD5, 0x29, 0x17, 0x29, 0x12, 0x3C, 0xF5, 0xBD, 0x68, 0xA0, 0x20, 0x01, 0x08, 0x40,
-    0xE7, 0x9A, 0x74, 0x21, 0xDB, 0x31, 0xA2, 0x7C, 0x2B, 0xFC, 0x95, 0xE8, 0x73, 0xB1, 0x64, 0xC2,
-    0xB7, 0x31, 0xF5, 0x37, 0x56, 0x8F, 0x5D, 0x95, 0xB7, 0x57, 0x02, 0xF1, 0x31, 0x47, 0x1D, 0xDB,
-    0x68, 0x4F, 0x60, 0xA9, 0xF8, 0x54, 0x58, 0x3B, 0x12, 0x2A, 0xB0, 0xA7, 0x04, 0xA6, 0x65, 0x8C,
-    0x2A, 0x88, 0x12, 0xC6, 0x59, 0xBC, 0x43, 0xC5, 0xF6, 0xF7, 0x31, 0xFE, 0x62, 0x11, 0xE0, 0x9E,
-    0xCA, 0x35, 0x8A, 0x8A, 0x0E, 0x5F, 0xC1, 0x01, 0xD5, 0x11, 0x53, 0xFE, 0x09, 0x48, 0x12, 0xF7,
-    0x89, 0x54, 0x22, 0x9B, 0x61, 0x2F, 0x00, 0xE4, 0x32, 0x80, 0x05, 0x1F, 0xAF, 0x83, 0x8D, 0x63,
-    0xB4, 0x1A, 0x79, 0x5E, 0x10, 0x8F, 0xCC, 0x01, 0x3E, 0x49, 0x36, 0x10, 0xF0, 0x4E, 0x00, 0xC0,
-    0xE0, 0x8C, 0x4C, 0xF7, 0x1D, 0xF1, 0x20, 0xE5, 0x3B, 0xBC, 0xD0, 0x98, 0x3B, 0x0D, 0x2E, 0x9D,
-    0xA1, 0x09, 0x74, 0xDF, 0x4B, 0x86, 0x6F, 0xB9, 0x5D, 0x2B, 0x01, 0xDF, 0x49, 0xBB, 0x1E, 0x27,
-    0xFB, 0x7A, 0xC1, 0xFA, 0xB2, 0x37, 0xB0, 0x7B, 0x61, 0x3F, 0x6B, 0xA1, 0xC9, 0xB6, 0xC2, 0x56,
-    0x77, 0x4B, 0x8D, 0xB2, 0x29, 0xEB, 0xC8, 0x2A, 0xF3, 0x10, 0x9D, 0xC8, 0x94, 0x75, 0x2B, 0x40,
-    0xEB, 0x66, 0x75, 0x52, 0xC3, 0x96, 0xB8, 0x07, 0x25, 0x57, 0xC3, 0xA6, 0x08, 0xE6, 0x8E, 0x80,
-    0x7E, 0xE7, 0x84, 0x1C, 0x64, 0x5F, 0xAF, 0x9E, 0x94, 0xA9, 0xF4, 0xEA, 0x7B, 0x7F, 0x72, 0x62,
-    0xA6, 0x4F, 0xD2, 0x7E, 0x8D, 0xF6, 0x35, 0x64, 0xA4, 0x79, 0x61, 0x5F, 0x0B, 0x4A, 0x29, 0xE8,
-    0x22, 0xCA, 0x26, 0xE0, 0x6C, 0xC2, 0x5E, 0xCB, 0x6F, 0x3C, 0x78, 0x14, 0xCC, 0x1E, 0x0E, 0x73,
-    0xA1, 0xCE, 0xC7, 0x3E, 0x8A, 0x40, 0x50, 0x00, 0xD2, 0xAA, 0x52, 0x38, 0x31, 0x65, 0x6C, 0x58,
-    0x7F, 0x23, 0x74, 0x48, 0x67, 0x76, 0xDF, 0x5F, 0x82, 0xD3, 0x6D, 0x97, 0xE0, 0xB0, 0xFE, 0x46,
-    0x4B, 0x70, 0xE8, 0x98, 0x9B, 0xD5, 0xE5, 0xD6, 0xBB, 0xD6, 0x79, 0xD7, 0x5A, 0xEF, 0xC3, 0x66,
-    0xF3, 0x90, 0xD1, 0x3D, 0xC4, 0x9F, 0x1F, 0xD2, 0xBA, 0x87, 0xCC, 0x45, 0x3C, 0xF3, 0xCB, 0xE7,
-    0xB9, 0xCC, 0x71, 0xDC, 0x24, 0xDD, 0x32, 0xAE, 0xCB, 0x12, 0x9A, 0x83, 0x6A, 0x76, 0xA2, 0x65,
-    0xCD, 0xCE, 0xBE, 0x6A, 0x9C, 0x62, 0x13, 0x12, 0x86, 0xA7, 0xCC, 0x58, 0x7C, 0xE7, 0x0C, 0x78,
-    0xA0, 0x95, 0x34, 0xA1, 0x75, 0x41, 0x5C, 0x18, 0x3F, 0x13, 0x7D, 0xE2, 0xE2, 0xD2, 0x2E, 0xE4,
-    0x90, 0xBD, 0x8B, 0x30, 0xA9, 0x18, 0x9E, 0x1E, 0x0F, 0xA3, 0xD3, 0x6D, 0x51, 0x73, 0x22, 0x0C,
-    0xC9, 0x18, 0xCF, 0x6A, 0x64, 0xBE, 0x59, 0x30, 0x28, 0x2C, 0xC0, 0x93, 0xD0, 0xA2, 0x62, 0xAC,
-    0x04, 0x8A, 0x5C, 0x92, 0x7F, 0x08, 0xBE, 0xB4, 0x8C, 0xD4, 0x45, 0xF2, 0xEC, 0xA3, 0xCA, 0x4F,
-    0xBC, 0xC1, 0x10, 0xF3, 0xC8, 0xAA, 0xA8, 0x81, 0x00, 0xDB, 0x9C, 0x7A, 0xF5, 0x87, 0x27, 0x34,
-    0x17, 0x2C, 0x6C, 0xC5, 0x58, 0x6D, 0xEB, 0x72, 0xB6, 0x8D, 0x88, 0x77, 0x0F, 0x55, 0xEA, 0x11,
-    0x7E, 0x02, 0x88, 0x8A, 0xBA, 0xE9, 0x93, 0x52, 0xEE, 0x6D, 0x59, 0xF1, 0x02, 0x74, 0x5F, 0xB0,
-    0x24, 0x67, 0xF2, 0x55, 0x0F, 0x14, 0x23, 0x43, 0x31, 0x5A, 0x8D, 0x07, 0x88, 0x51, 0xFF, 0x45,
-    0xC5, 0x88, 0xA1, 0x61, 0xA6, 0x1C, 0x18, 0x3E, 0x0B, 0x19, 0x13, 0xCB, 0x17, 0x55, 0x71, 0x77,
-    0xDC, 0x4D, 0x81, 0x46, 0x03, 0xA6, 0x21, 0xC6, 0x81, 0x64, 0x66, 0xF3, 0xDB, 0xEE, 0x88, 0xDB,
-    0xB6, 0x3A, 0x21, 0x6F, 0xF0, 0x1B, 0x31, 0xE9, 0x5E, 0x97, 0x20, 0x0F, 0x4C, 0x57, 0xB1, 0x5F,
-    0x54, 0x9B, 0xFC, 0x16, 0x10, 0xE6, 0x6F, 0xBC, 0xB2, 0x87, 0x11, 0x09, 0x53, 0xF3, 0x0F, 0xB8,
-    0x00, 0x73, 0xB0, 0xA6, 0x86, 0x5B, 0x23, 0x42, 0xCE, 0xA0, 0xB0, 0xE0, 0x4E, 0xC6, 0x6A, 0xEA,
-    0x8C, 0x51, 0x84, 0xD2, 0xD5, 0x39, 0xB9, 0x4A, 0xA7, 0x0C, 0x3A, 0x0A, 0x2B, 0x8D, 0x3A, 0xB2,
-    0x79, 0x02, 0x84, 0x23, 0xBF, 0xED, 0x08, 0xC0, 0x6D, 0x07, 0x1C, 0xF8, 0xBA, 0x45, 0x14, 0x31,
-    0xBB, 0x60, 0x7B, 0xC8, 0xF6, 0x7B, 0x37, 0x90, 0x3C, 0x4B, 0xDE, 0xBF, 0x82, 0x8D, 0x4E, 0xEC,
-    0x3B, 0x03, 0x1D, 0xF8, 0x0B, 0xD8, 0xEC, 0xC8, 0x3E, 0x62, 0xA9, 0xA5, 0xD6, 0xC0, 0x16, 0xE1,
-    0x08, 0x37, 0x91, 0x41, 0x5D, 0xD6, 0x1D, 0x84, 0xE2, 0xD5, 0x6B, 0xCA, 0x02, 0xA3, 0x2C, 0xB2,
-    0x04, 0xFA, 0x27, 0x88, 0x10, 0x68, 0x8C, 0x8A, 0x2F, 0xE4, 0x18, 0xC5, 0x90, 0x96, 0x16, 0x91,
-    0x9E, 0x37, 0xAC, 0x00, 0x89, 0xF8, 0x1D, 0x2B, 0x6C, 0x13, 0x7F, 0x7A, 0xE3, 0x0A, 0xF2, 0x9B,
-    0x3F, 0x15, 0xCA, 0x85, 0xF6, 0x79, 0xFA, 0xB3, 0x48, 0x81, 0x06, 0x03, 0xA0, 0x2C, 0x81, 0x8D,
-    0xBC, 0x60, 0xA3, 0x18, 0x62, 0x40, 0x14, 0xFD, 0xAE, 0x57, 0x4E, 0x39, 0xAC, 0xED, 0x1E, 0xB0,
-    0x51, 0x0D, 0xF0, 0x03, 0x78, 0xE4, 0xF7, 0xFE, 0x88, 0xD8, 0x69, 0x88, 0x6F, 0x71, 0x03, 0x01,
-    0x72, 0xC4, 0xAC, 0xF7, 0xC0, 0xF0, 0x8C, 0x15, 0x6D, 0x62, 0x97, 0x3D, 0xD4, 0xFE, 0xAA, 0x47,
-    0x6D, 0x92, 0x48, 0x14, 0x11, 0xC5, 0x7B, 0x1C, 0x57, 0xAA, 0xB7, 0x28, 0xDB, 0x2B, 0xFB, 0xF7,
-    0x29, 0x9E, 0x67, 0x21, 0xC1, 0xF2, 0x0E, 0x44, 0x62, 0x9F, 0xEC, 0xB1, 0xA1, 0xD8, 0x52, 0x8E,
-    0xB2, 0x1B, 0x90, 0x35, 0xCF, 0x02, 0x3A, 0x89, 0x09, 0x45, 0x25, 0x46, 0x66, 0x97, 0xF2, 0xAC,
-    0x22, 0x1D, 0xA3, 0xB6, 0x0D, 0x38, 0xA6, 0xD7, 0x80, 0x25, 0xF0, 0x7C, 0x32, 0x9E, 0x6B, 0x18,
-    0xAE, 0x14, 0x0D, 0x63, 0x1F, 0xD6, 0x38, 0xAD, 0xA7, 0xA0, 0x8F, 0xC8, 0x70, 0x6D, 0xCF, 0x8F,
-    0x5A, 0xA2, 0x31, 0x57, 0xDB, 0x35, 0xD3, 0x45, 0x6C, 0x74, 0x43, 0x8F, 0x81, 0x17, 0x41, 0x54,
-    0xAD, 0x5E, 0x94, 0x47, 0xC5, 0x11, 0xBD, 0x0F, 0x18, 0xD6, 0xFE, 0xE8, 0x15, 0x44, 0xEB, 0x99,
-    0x22, 0xA9, 0x68, 0x4D, 0x90, 0x80, 0x45, 0x31, 0xCE, 0x56, 0x11, 0x00, 0x60, 0x1D, 0x1C, 0x54,
-    0x41, 0x01, 0x10, 0x7F, 0xF1, 0xF9, 0x45, 0xBD, 0xFC, 0xA8, 0xC4, 0xD2, 0x20, 0xBC, 0x4C, 0xBB,
-    0x59, 0x97, 0x01, 0xB1, 0xEA, 0xCB, 0xC8, 0xA6, 0x5D, 0xCF, 0xC4, 0xEA, 0x45, 0x2C, 0x43, 0x61,
-    0x9E, 0x55, 0xDE, 0x14, 0x77, 0x11, 0xC2, 0x59, 0x96, 0x59, 0x2D, 0x94, 0xEF, 0x09, 0x49, 0xAE,
-    0xCF, 0x79, 0xB3, 0x95, 0xE6, 0xED, 0x2B, 0xE7, 0xB2, 0x84, 0xE0, 0xA4, 0xF8, 0xFD, 0xDA, 0xC9,
-    0x9D, 0x3D, 0x8E, 0x24, 0x5E, 0x20, 0x2B, 0x1C, 0x4F, 0x37, 0x1A, 0xF9, 0x24, 0x9D, 0x62, 0x26,
-    0x0E, 0xDF, 0xBF, 0x22, 0x18, 0xFB, 0x2D, 0xE1, 0x18, 0x1B, 0x7D, 0x24, 0xDA, 0x2E, 0x7E, 0x47,
-    0x50, 0x4A, 0xF2, 0x46, 0x1F, 0x76, 0xC9, 0x1B, 0x22, 0x61, 0x32, 0x88, 0x2C, 0x9C, 0x19, 0x45,
-    0xE5, 0x3F, 0x3C, 0x32, 0x8E, 0x6C, 0x90, 0x4B, 0x57, 0x9B, 0xBA, 0x1A, 0x69, 0x82, 0x06, 0xB8,
-    0x2B, 0xD0, 0x5E, 0x8D, 0x56, 0x63, 0x19, 0xAD, 0x8E, 0x01, 0x4E, 0x5F, 0x8F, 0x45, 0x96, 0x7B,
-    0xBD, 0x4D, 0xC4, 0x19, 0x18, 0x85, 0x79, 0x2F, 0x0F, 0xA2, 0xC9, 0xDE, 0x1E, 0xE2, 0x32, 0x7B,
-    0xA3, 0x8F, 0x69, 0x39, 0x13, 0x56, 0xF3, 0x30, 0x09, 0x98, 0x31, 0x23, 0xCF, 0x9C, 0x38, 0x93,
-    0x59, 0xDE, 0xC8, 0x4B, 0x78, 0xB5, 0x67, 0x0E, 0xE7, 0xB2, 0xA6, 0x46, 0x7E, 0x06, 0x90, 0xB7,
-    0x5B, 0xBC, 0x3B, 0xEA, 0x86, 0xB9, 0x8B, 0x9D, 0x2E, 0x02, 0xB3, 0xAE, 0x0F, 0x05, 0xB6, 0xEF,
-    0xB3, 0xBE, 0x90, 0x7D, 0x8B, 0x3F, 0xEA, 0x0B, 0xF1, 0x3D, 0xB2, 0x0B, 0x7D, 0x26, 0x70, 0xDB,
-    0x3E, 0xDF, 0xC9, 0xE5, 0x03, 0x1B, 0x08, 0x4F, 0xC5, 0x1F, 0x8D, 0x10, 0xA5, 0xE4, 0xBD, 0x9E,
-    0x97, 0xB7, 0x3A, 0x5C, 0x0C, 0x9E, 0x97, 0xAE, 0x00, 0x60, 0x52, 0x68, 0x05, 0x46, 0x71, 0x92,
-    0x4B, 0x8C, 0x2A, 0xEC, 0x94, 0x9E, 0x68, 0xBC, 0x08, 0x31, 0x0E, 0x60, 0x5C, 0x8E, 0x9A, 0x40,
-    0x0C, 0xAF, 0x66, 0x97, 0x6C, 0x13, 0xD5, 0xC9, 0xFB, 0xEF, 0x37, 0x71, 0x55, 0xFC, 0xED, 0xCF,
-    0x9B, 0xF8, 0x75, 0x1B, 0xFF, 0xB4, 0x4D, 0x2E, 0x0C, 0xC9, 0x9B, 0x6D, 0xF2, 0x3C, 0xEA, 0x39,
-    0xB2, 0xE3, 0x6D, 0xF6, 0x5C, 0xCF, 0x69, 0x8E, 0xDC, 0x74, 0x9D, 0xF9, 0xC0, 0xAA, 0x99, 0x96,
-    0x85, 0xAA, 0x15, 0x63, 0xEB, 0xA9, 0xD3, 0x9E, 0x2E, 0xB3, 0xCA, 0x9C, 0xAA, 0xFA, 0x1F, 0x0C,
-    0xE5, 0x30, 0xDF, 0x24, 0xBF, 0x7C, 0xAF, 0x07, 0x0C, 0x7E, 0x41, 0x96, 0x65, 0x44, 0x2B, 0x66,
-    0x39, 0xF4, 0x22, 0xA2, 0x1F, 0xD0, 0x81, 0xF0, 0x05, 0x10, 0x45, 0x89, 0xA9, 0x2A, 0xE0, 0x45,
-    0xCB, 0x77, 0x95, 0x30, 0x4D, 0xD0, 0xEB, 0x10, 0x33, 0xD0, 0x55, 0xA3, 0x44, 0xAA, 0x29, 0xC4,
-    0xF4, 0xFE, 0x0A, 0xF2, 0x8A, 0x97, 0x44, 0xB6, 0xDF, 0x6C, 0xA0, 0xE8, 0xC7, 0x22, 0x49, 0xBD,
-    0x0E, 0x1B, 0xD8, 0x8C, 0x49, 0x1E, 0x7E, 0x20, 0x7B, 0x17, 0xCB, 0xDE, 0x95, 0xC9, 0x73, 0x32,
-    0xC0, 0x38, 0x69, 0xCE, 0xAB, 0xD4, 0x9C, 0x57, 0xC6, 0x2B, 0x52, 0x71, 0x9A, 0xEE, 0x17, 0x87,
-    0x95, 0xB0, 0xCE, 0xA6, 0x51, 0xAD, 0xF5, 0x59, 0x98, 0x1E, 0xAB, 0x1C, 0x3A, 0xAA, 0x99, 0xDD,
-    0x73, 0x78, 0x9D, 0xDB, 0x49, 0xB7, 0x87, 0xA5, 0xBB, 0xA2, 0xF2, 0x20, 0xE8, 0xEC, 0xE9, 0x86,
-    0xC2, 0x68, 0x99, 0x8A, 0x4B, 0x3E, 0x70, 0xD7, 0x37, 0x70, 0x15, 0xAF, 0xF8, 0xD9, 0x91, 0x40,
-    0xCA, 0x22, 0x3C, 0x05, 0xFF, 0x9D, 0x42, 0x95, 0xBC, 0x33, 0xE0, 0x4F, 0x85, 0x82, 0x02, 0xBA,
-    0x61, 0x27, 0xC7, 0x80, 0xA9, 0xA8, 0x21, 0xE0, 0x9A, 0x06, 0xE6, 0xF8, 0xC5, 0xD9, 0x43, 0xC5,
-    0x86, 0xEC, 0x2C, 0x4B, 0xFE, 0x3A, 0xF3, 0x9A, 0x90, 0x52, 0x37, 0x46, 0x11, 0x47, 0xAA, 0xE9,
-    0xE1, 0xD2, 0x70, 0x7B, 0x2B, 0x13, 0xD5, 0xD9, 0xE9, 0xB7, 0x50, 0x0D, 0x28, 0x5B, 0x2B, 0xC8,
-    0xED, 0xF5, 0x21, 0x91, 0x4B, 0x72, 0x41, 0x36, 0x57, 0x2E, 0xCF, 0xB7, 0xD9, 0x63, 0xE2, 0x15,
-    0x1F, 0x6F, 0x0A, 0x5F, 0x53, 0x66, 0xE2, 0x08, 0x3F, 0x05, 0xEB, 0x92, 0x10, 0xD6, 0xB2, 0xE4,
-    0x70, 0x54, 0xEC, 0xAC, 0xD5, 0x05, 0x0C, 0x7F, 0x88, 0xA8, 0xF7, 0xE6, 0xFE, 0x9B, 0xEA, 0x9F,
-    0x84, 0x1D, 0x76, 0x99, 0x48, 0x22, 0x4D, 0x34, 0x5D, 0x91, 0x3A, 0x31, 0x5F, 0xD6, 0x08, 0x60,
-    0x80, 0xC0, 0xEF, 0x68, 0xE9, 0x9F, 0xD6, 0x24, 0x47, 0x4C, 0x9A, 0x5C, 0x4F, 0xB7, 0x42, 0x5C,
-    0x58, 0x06, 0x3D, 0x2A, 0x5F, 0x71, 0x1D, 0xB5, 0x86, 0x39, 0x2C, 0x0B, 0x86, 0x5E, 0x5D, 0x5F,
-    0x1D, 0x73, 0xCD, 0x4E, 0x3F, 0x88, 0xB7, 0x65, 0xAE, 0xAC, 0x32, 0x35, 0xDF, 0x5C, 0x6D, 0x25,
-    0xB9, 0x3C, 0xF0, 0x9F, 0xAF, 0x7A, 0x06, 0xAB, 0x7C, 0xB0, 0x9F, 0x0B, 0xFD, 0xB0, 0x36, 0x60,
-    0xEC, 0xF3, 0xAA, 0xCC, 0x90, 0xDA, 0x10, 0xF0, 0x95, 0xFC, 0x72, 0x6A, 0xD8, 0xE0, 0x90, 0x68,
-    0xE6, 0x09, 0x75, 0x3F, 0x73, 0x27, 0x85, 0x98, 0x92, 0xD6, 0xEF, 0x60, 0xD6, 0x82, 0x2E, 0xAA,
-    0x51, 0x5E, 0x14, 0x57, 0xCE, 0xC8, 0xD5, 0xE0, 0x62, 0xD1, 0x7A, 0xF0, 0x19, 0x4B, 0x91, 0xAB,
-    0x1C, 0x41, 0xD8, 0x22, 0xCD, 0x72, 0x8C, 0xF2, 0xBF, 0x5C, 0x10, 0xE8, 0xC3, 0xE2, 0x13, 0xD6,
-    0x36, 0xB0, 0x2E, 0x53, 0x1D, 0x6B, 0x85, 0x8C, 0x46, 0x83, 0xFE, 0xD3, 0xF8, 0xD7, 0x9B, 0x38,
-    0x50, 0x7F, 0x70, 0x1C, 0x68, 0x0A, 0xDE, 0xDF, 0x14, 0xAF, 0xF2, 0x97, 0xE1, 0x23, 0x96, 0x47,
-    0x60, 0x4E, 0xE0, 0x44, 0x40, 0xCD, 0x88, 0xB1, 0x99, 0xB8, 0x86, 0x71, 0x86, 0x64, 0xD1, 0x1C,
-    0xCB, 0x8C, 0x31, 0x26, 0x2C, 0x9E, 0x63, 0xBC, 0x4A, 0x66, 0x0A, 0x89, 0x16, 0xB1, 0x58, 0x43,
-    0x67, 0x23, 0x6A, 0x95, 0x7C, 0x30, 0xEE, 0xB0, 0x40, 0x94, 0x99, 0x1F, 0x4B, 0xF0, 0x4B, 0x62,
-    0x2E, 0x67, 0x18, 0x2C, 0x66, 0x18, 0xDE, 0x54, 0xCC, 0xEA, 0xEA, 0x4D, 0xB4, 0x32, 0xB2, 0xD4,
-    0x14, 0xA2, 0x15, 0xA7, 0x52, 0x34, 0x57, 0xD8, 0x23, 0x0C, 0xC5, 0x4C, 0xDB, 0x80, 0xA4, 0xFF,
-    0x10, 0x5F, 0x3D, 0xF5, 0x04, 0x4A, 0x45, 0x58, 0x2F, 0x82, 0xE8, 0xA3, 0x0C, 0xA8, 0x51, 0xD5,
-    0x72, 0x1E, 0x56, 0x0D, 0x41, 0x0B, 0xD7, 0x28, 0x19, 0x2D, 0xA3, 0xE1, 0x49, 0xE4, 0x8A, 0x54,
-    0x35, 0x6D, 0x55, 0xF2, 0xF0, 0xE5, 0x08, 0x6B, 0x32, 0xC4, 0xDB, 0x84, 0x43, 0xD4, 0x22, 0x88,
-    0x2C, 0xD0, 0xAB, 0xCF, 0x2E, 0x9E, 0xEB, 0x51, 0x38, 0x81, 0x3A, 0x94, 0xE2, 0xE2, 0x79, 0x86,
-    0x35, 0x10, 0xBA, 0xCB, 0x3E, 0x60, 0xEE, 0x29, 0x57, 0x77, 0xED, 0x63, 0xBA, 0xF6, 0x90, 0x30,
-    0xD4, 0x10, 0x25, 0x3D, 0x74, 0x7E, 0x0F, 0xC3, 0xFE, 0xFF, 0x12, 0x41, 0xEB, 0x9A, 0xCB, 0x67,
-    0x55, 0x27, 0x76, 0x5F, 0x86, 0x04, 0x82, 0x86, 0xC2, 0x04, 0x21, 0xA3, 0x48, 0x1E, 0x20, 0xF1,
-    0x87, 0xB0, 0x31, 0x1F, 0x01, 0x32, 0x7D, 0x0A, 0x57, 0x07, 0x15, 0x27, 0xA1, 0x9A, 0xBB, 0xD2,
-    0x95, 0x9B, 0xB0, 0xDA, 0x24, 0x70, 0x29, 0x6D, 0x79, 0xD9, 0xCA, 0xA2, 0xFE, 0x0E, 0xB0, 0x40,
-    0xF8, 0x67, 0x0F, 0xBC, 0xC4, 0x78, 0x62, 0x29, 0x20, 0xE9, 0x8D, 0xD1, 0xA0, 0xD4, 0x2E, 0xFA,
-    0x79, 0x67, 0xA2, 0xF7, 0x1B, 0x3E, 0x08, 0xCF, 0x09, 0x29, 0xF5, 0xFA, 0x90, 0x43, 0x7F, 0x06,
-    0x17, 0xF8, 0x32, 0x64, 0xB0, 0x2D, 0x80, 0x69, 0xE0, 0x88, 0xBD, 0x1A, 0x0A, 0x49, 0x8E, 0xCE,
-    0xE9, 0xAF, 0xBB, 0xB5, 0x9E, 0x63, 0x7F, 0x72, 0x82, 0xF6, 0x20, 0x92, 0x39, 0xFB, 0x75, 0x6F,
-    0xD6, 0xCD, 0x77, 0x64, 0x63, 0x0E, 0xDD, 0x91, 0x75, 0x2E, 0x83, 0xB7, 0xC5, 0xF4, 0xDF, 0xE4,
-    0x2C, 0xB3, 0xEC, 0xB4, 0x10, 0x35, 0xB0, 0x57, 0xB4, 0xAE, 0x8C, 0x3A, 0x8F, 0x34, 0xB9, 0xE1,
-    0x23, 0xB5, 0x8E, 0x2A, 0xD5, 0x3C, 0x44, 0xDC, 0x85, 0x05, 0x17, 0xAC, 0x20, 0x63, 0xDD, 0x32,
-    0xCB, 0xC8, 0x02, 0x84, 0xC5, 0x50, 0x4B, 0x26, 0xFF, 0xD2, 0x92, 0x13, 0x41, 0x93, 0x1D, 0x32,
-    0xA0, 0xA8, 0x2A, 0xF3, 0x3B, 0x78, 0x36, 0x15, 0xD2, 0xA6, 0x60, 0x49, 0xFC, 0x4B, 0xD0, 0x34,
-    0x4B, 0xB9, 0x98, 0x40, 0xB5, 0x5A, 0x03, 0x50, 0xAF, 0x81, 0x35, 0x12, 0x94, 0x9B, 0x11, 0x1D,
-    0xB0, 0xE6, 0x6C, 0x45, 0xE0, 0x6C, 0x19, 0x6E, 0xD7, 0x3C, 0x6E, 0xAB, 0xFA, 0x50, 0x19, 0x97,
-    0xCC, 0x4B, 0xEE, 0x9D, 0xF3, 0xB5, 0xDE, 0x38, 0xC7, 0x66, 0xFA, 0x29, 0xD1, 0x3A, 0xF7, 0x98,
-    0xCC, 0xD9, 0x65, 0x06, 0x6E, 0xDC, 0xBF, 0xAE, 0x6F, 0x97, 0x25, 0x89, 0x0C, 0xA0, 0x36, 0x17,
-    0x1D, 0x54, 0x25, 0x0B, 0x41, 0x28, 0x0D, 0xC8, 0xF7, 0x84, 0xC3, 0x4E, 0xCB, 0x54, 0x76, 0x2C,
-    0xAB, 0x64, 0x95, 0x24, 0x84, 0x23, 0x10, 0x31, 0x61, 0xF9, 0x46, 0xD0, 0x32, 0x4C, 0x10, 0x74,
-    0x7E, 0x07, 0xC7, 0x34, 0x97, 0x55, 0x76, 0xAE, 0x16, 0xC4, 0xBB, 0x3E, 0x6A, 0x15, 0xB3, 0x77,
-    0x03, 0xF0, 0x47, 0x6C, 0x35, 0x75, 0x3E, 0xE4, 0x67, 0xAD, 0x09, 0x51, 0x9B, 0x33, 0x3A, 0x16,
-    0x72, 0xA5, 0xA5, 0x51, 0x71, 0xE2, 0x1C, 0xEF, 0x9B, 0x02, 0xEE, 0x9B, 0xA0, 0xA7, 0xAB, 0x36,
-    0x93, 0xAF, 0xFB, 0xDD, 0x76, 0x29, 0x20, 0x34, 0x73, 0x51, 0xD6, 0xE4, 0x72, 0x61, 0xC3, 0xB9,
-    0xD0, 0xA0, 0xD1, 0x02, 0xB6, 0xD9, 0xEF, 0xCF, 0xA6, 0xD8, 0x3C, 0x00, 0xCB, 0x0B, 0x2F, 0x0C,
-    0x26, 0x80, 0x4A, 0x60, 0x4D, 0x98, 0x75, 0x35, 0x61, 0xF1, 0x54, 0x19, 0xA6, 0xE5, 0xD6, 0x2C,
-    0xB4, 0xC2, 0x6F, 0xE1, 0x2E, 0x8E, 0x53, 0x01, 0x76, 0xC5, 0x52, 0xA3, 0x06, 0xE9, 0xFD, 0xB8,
-    0xFB, 0x5E, 0xC1, 0xD4, 0x9A, 0x1A, 0x21, 0x3A, 0x1A, 0x4C, 0x7B, 0xC6, 0xDC, 0x31, 0x55, 0xBA,
-    0xAB, 0x17, 0x37, 0xA4, 0x56, 0xF0, 0x93, 0xE3, 0x36, 0xA2, 0xD6, 0x5E, 0xB7, 0x3A, 0xBE, 0xFA,
-    0xE1, 0x5C, 0xD6, 0xAE, 0x45, 0x69, 0x48, 0x7F, 0x69, 0x0E, 0x0C, 0x03, 0x3C, 0xB2, 0xD7, 0x03,
-    0xA2, 0x9C, 0x4E, 0x51, 0x4E, 0xA0, 0x05, 0xA8, 0xC3, 0xD4, 0xAB, 0x76, 0x78, 0x6B, 0x47, 0x5D,
-    0xA5, 0x4B, 0xA2, 0xD8, 0xFD, 0x07, 0xAA, 0x85, 0xFF, 0xAC, 0x61, 0x85, 0xC1, 0xCA, 0x51, 0xE9,
-    0xDB, 0x7A, 0x51, 0x31, 0x58, 0xA7, 0xCB, 0x9C, 0x6F, 0xE5, 0xD3, 0xA4, 0xB5, 0x31, 0x4B, 0x95,
-    0x9B, 0xC8, 0xB6, 0x6B, 0xFB, 0x69, 0x1D, 0x16, 0x28, 0xFA, 0x10, 0x4B, 0x4F, 0xA0, 0x2F, 0x04,
-    0x21, 0xBD, 0xBD, 0x91, 0x5A, 0x1C, 0x59, 0x34, 0x5E, 0x68, 0xBF, 0xE5, 0xC2, 0xF5, 0x0F, 0xF0,
-    0x23, 0x44, 0x84, 0x98, 0xD0, 0x82, 0xE7, 0x83, 0x6A, 0xC8, 0x8E, 0x49, 0xAD, 0xA8, 0xD5, 0x2A,
-    0x82, 0x26, 0x86, 0x28, 0x01, 0x74, 0x16, 0xF6, 0x3C, 0xE3, 0x84, 0x0E, 0xF8, 0x32, 0xED, 0x51,
-    0x74, 0x01, 0xCA, 0xE4, 0x56, 0xAE, 0x8A, 0x60, 0xF5, 0xD2, 0x14, 0x62, 0x13, 0x32, 0x3E, 0x06,
-    0x1E, 0xF9, 0xE6, 0x37, 0xFE, 0x0B, 0x7E, 0xF4, 0x0C, 0x67, 0xFE, 0x35, 0x8E, 0x7F, 0xC8, 0xF1,
-    0x1F, 0xF6, 0xD5, 0xDE, 0xC5, 0x02, 0x90, 0x84, 0xC3, 0x07, 0x61, 0x1B, 0xDF, 0xF6, 0x62, 0xEA,
-    0xC3, 0xE1, 0x3F, 0x1C, 0xDE, 0xE9, 0x30, 0x6B, 0x2D, 0x08, 0xF6, 0x21, 0xAA, 0x1C, 0x0F, 0x9D,
-    0xF0, 0x7B, 0xCD, 0x39, 0x21, 0x4F, 0x13, 0x62, 0x64, 0x19, 0x82, 0x58, 0xC1, 0x46, 0x18, 0xF8,
-    0x2A, 0xA3, 0x9C, 0x90, 0x15, 0x7B, 0x85, 0x05, 0x12, 0x39, 0xA4, 0xED, 0x08, 0x26, 0x29, 0xFA,
-    0xF5, 0x14, 0xBA, 0x09, 0xB1, 0x47, 0xA5, 0x5E, 0xF0, 0x5F, 0x7F, 0xF8, 0xFB, 0x21, 0xC3, 0xC0,
-    0xF7, 0x2D, 0xA6, 0x73, 0xEF, 0xF9, 0xE7, 0x82, 0xCF, 0xC4, 0x7F, 0xD4, 0x4A, 0x1F, 0xB3, 0xBE,
-    0x71, 0x43, 0x28, 0xB3, 0x7A, 0xBD, 0xAA, 0xB7, 0xA9, 0xF8, 0x55, 0xFB, 0xF0, 0x53, 0xF0, 0x33,
-    0x55, 0xC0, 0x95, 0xB0, 0xA0, 0x77, 0x2C, 0xC4, 0xFC, 0x94, 0xEB, 0xFC, 0x73, 0xCA, 0x4E, 0xA9,
-    0x24, 0xE7, 0x61, 0xAB, 0xEC, 0x14, 0x2B, 0xFF, 0x6F, 0xA5, 0x1A, 0x00, 0xCF, 0x65, 0xD5, 0xB6,
-    0xDB, 0x1B, 0xC6, 0x03, 0xDA, 0x3B, 0x26, 0x75, 0x1A, 0xB3, 0x65, 0x8C, 0x39, 0x85, 0x70, 0x7C,
-    0x32, 0x8D, 0xDA, 0xED, 0xC6, 0xC1, 0x29, 0x08, 0xA9, 0x65, 0x07, 0xF2, 0xB3, 0xAB, 0xDF, 0x65,
-    0x5D, 0x00, 0xBC, 0x1C, 0xF6, 0x4E, 0x1E, 0x50, 0xC0, 0x3A, 0x25, 0xB6, 0x9C, 0xC6, 0x42, 0x4E,
-    0xAE, 0x32, 0xDF, 0x0E, 0xC4, 0x58, 0x9C, 0x56, 0x50, 0xCD, 0xDC, 0x0F, 0x1E, 0xF0, 0x59, 0x7F,
-    0xC4, 0xAB, 0xBE, 0xFD, 0xC7, 0x81, 0xE0, 0xDF, 0xF7, 0x5D, 0xE5, 0x93, 0x55, 0x60, 0xBB, 0xBE,
-    0x2C, 0x9A, 0xAC, 0xFA, 0x03, 0x13, 0xA0, 0xFE, 0x62, 0x6B, 0x97, 0x04, 0x15, 0x27, 0x76, 0xCC,
-    0x4E, 0x9D, 0xFC, 0x86, 0x2B, 0xE9, 0x69, 0x1F, 0x14, 0x84, 0x24, 0x3F, 0xA9, 0x9F, 0x39, 0x8A,
-    0x20, 0x65, 0x2C, 0x5C, 0xF5, 0xAA, 0x79, 0xCA, 0xC4, 0x29, 0x04, 0x3F, 0x14, 0x6B, 0xEE, 0x37,
-    0x5E, 0x95, 0xA4, 0x5F, 0xA7, 0x84, 0x85, 0xDA, 0x59, 0x67, 0xB2, 0x27, 0xAD, 0x79, 0xDA, 0x50,
-    0xBE, 0xD6, 0x1F, 0x4F, 0x6A, 0x78, 0x32, 0x36, 0xFF, 0x6E, 0x7A, 0xE3, 0xD1, 0xF5, 0x3E, 0x41,
-    0x9B, 0x90, 0x31, 0xD4, 0x3C, 0xF8, 0x6B, 0x55, 0xFE, 0x91, 0x3C, 0xA0, 0xFC, 0x4B, 0x63, 0xD2,
-    0x23, 0x10, 0xE5, 0x23, 0xE6, 0x8B, 0x7C, 0x1D, 0xD6, 0xFC, 0xEB, 0x7F, 0xA4, 0x33, 0x4D, 0xEB,
-    0xFC, 0x57, 0xFF, 0x99, 0xC6, 0xF9, 0xF1, 0xEA, 0xBB, 0xBF, 0xC7, 0x1B, 0xCC, 0x59, 0xF3, 0xA5,
-    0xBE, 0xB4, 0x22, 0x79, 0x9E, 0x58, 0xE3, 0x26, 0x96, 0xFF, 0xE5, 0x74, 0xC3, 0x91, 0x45, 0xB1,
-    0xC9, 0x02, 0x45, 0x7C, 0xED, 0xBC, 0xFB, 0xC7, 0x37, 0xBC, 0x74, 0xFF, 0x33, 0xBF, 0x3D, 0xFD,
-    0xE3, 0x07, 0xD3, 0x3F, 0xA6, 0x06, 0x12, 0xA7, 0x58, 0x7F, 0xCF, 0xAC, 0xF4, 0x1F, 0xA1, 0xF1,
-    0x1A, 0x5A, 0x26, 0xEC, 0x96, 0x20, 0x26, 0x6E, 0xB8, 0x63, 0x40, 0x94, 0xD7, 0x72, 0x95, 0xE0,
-    0xD6, 0x7C, 0x39, 0x89, 0x5B, 0x7F, 0x7D, 0x7D, 0xD2, 0xDB, 0x8E, 0x3E, 0xD7, 0x1D, 0xBB, 0x8A,
-    0xA0, 0x98, 0xBF, 0x50, 0x0A, 0x96, 0x5F, 0x9C, 0x36, 0x5C, 0xFA, 0xBF, 0x91, 0xEF, 0xFF, 0x61,
-    0xDC, 0x5C, 0xE6, 0x8A, 0xD5, 0xA7, 0x40, 0xB5, 0xD4, 0xFC, 0xC4, 0x7C, 0x4B, 0xDF, 0x2A, 0xC2,
-    0x3B, 0x2D, 0x50, 0x8D, 0xCE, 0xAA, 0x59, 0x70, 0xB1, 0xCE, 0x6A, 0xFF, 0x9B, 0x7F, 0x6C, 0x1E,
-    0xCA, 0x91, 0xA5, 0x62, 0x05, 0x5A, 0xAA, 0x05, 0x6E, 0x2C, 0xE1, 0xA3, 0x93, 0xB0, 0x3A, 0xB5,
-    0x68, 0x30, 0x41, 0xCE, 0x45, 0x46, 0x64, 0x63, 0x73, 0x0F, 0xF6, 0x27, 0x65, 0x06, 0x86, 0xE1,
-    0x75, 0xCB, 0xCC, 0xA7, 0x18, 0x44, 0x8D, 0xC9, 0x67, 0xF9, 0x7A, 0xF0, 0xFA, 0x22, 0x85, 0x7B,
-    0x5C, 0xA0, 0xCD, 0x44, 0x10, 0xA8, 0x27, 0xC8, 0x55, 0x74, 0x72, 0x6B, 0x45, 0x7E, 0x82, 0x6B,
-    0x83, 0x28, 0xD9, 0xF0, 0x86, 0xA0, 0x30, 0xB4, 0x99, 0xA0, 0xFA, 0xDE, 0x56, 0xE2, 0x13, 0x47,
-    0x48, 0xE7, 0x74, 0x31, 0xE2, 0x58, 0x6D, 0xC2, 0x5F, 0xB1, 0xD5, 0xB5, 0x32, 0x73, 0xF1, 0x3B,
-    0x6B, 0x26, 0x54, 0x3C, 0x15, 0x5D, 0x29, 0x6D, 0xC3, 0xB9, 0x73, 0x57, 0x94, 0x76, 0x2E, 0x6F,
-    0x40, 0x9C, 0xE2, 0x61, 0x36, 0x4D, 0x0D, 0x53, 0xA1, 0xF8, 0xC9, 0x4D, 0xDF, 0xE2, 0x54, 0x21,
-    0xD9, 0xAD, 0x5D, 0xF1, 0x1C, 0x13, 0xC2, 0x4C, 0x07, 0xC7, 0xDA, 0xF9, 0x0A, 0xE8, 0x58, 0xB2,
-    0xB4, 0x98, 0xC5, 0x2A, 0x09, 0x86, 0x4C, 0x90, 0xE1, 0xDB, 0xCC, 0x52, 0x8A, 0xBA, 0x49, 0xC4,
-    0x26, 0xA6, 0xE1, 0x10, 0xB3, 0x56, 0x72, 0xA3, 0x9D, 0xBA, 0xB9, 0x4F, 0x1D, 0xAF, 0x7C, 0x28,
-    0x9F, 0x93, 0x22, 0x87, 0x8B, 0x8B, 0x70, 0x98, 0x91, 0x57, 0x48, 0x03, 0x4D, 0x64, 0xB8, 0xD8,
-    0xE7, 0x8F, 0xA1, 0xF7, 0x2A, 0xC0, 0x49, 0x04, 0xF8, 0xFC, 0x1E, 0x56, 0xDC, 0x5B, 0x94, 0xAB,
-    0x04, 0xAC, 0x93, 0x73, 0x71, 0xD3, 0x3C, 0xB1, 0x6E, 0xA9, 0x0B, 0x55, 0x95, 0x68, 0xAF, 0x2D,
-    0x3B, 0xC5, 0xE7, 0x1C, 0xCD, 0xBE, 0x9E, 0xEA, 0x68, 0xEF, 0x97, 0x30, 0x7A, 0x39, 0x53, 0x81,
-    0x1F, 0x67, 0xCC, 0x25, 0xE8, 0xB7, 0x78, 0x63, 0x34, 0x99, 0x30, 0x98, 0x9D, 0xC6, 0xF5, 0x13,
-    0xFB, 0xD2, 0x26, 0xB6, 0x46, 0x67, 0x1F, 0xA5, 0xB0, 0x8C, 0xBB, 0xB3, 0xCF, 0x2F, 0x12, 0xE0,
-    0x7D, 0x18, 0x85, 0x70, 0x71, 0x51, 0xCB, 0x34, 0xA9, 0x80, 0x59, 0xFE, 0x35, 0x6A, 0xC0, 0x2F,
-    0x18, 0xFF, 0x3B, 0xB3, 0x4E, 0xAD, 0x32, 0xEA, 0xE7, 0xB4, 0xD5, 0x27, 0xD8, 0xC3, 0x2C, 0xD1,
-    0x16, 0x37, 0xD9, 0xB7, 0x4F, 0xD8, 0x39, 0xC1, 0x3E, 0x12, 0x19, 0x60, 0x52, 0xD7, 0x73, 0xA9,
-    0x8D, 0xD7, 0xDF, 0x87, 0x86, 0xE6, 0xA7, 0x01, 0x5A, 0x0A, 0xF0, 0x49, 0xC6, 0x4A, 0xA3, 0x6E,
-    0xAE, 0xB7, 0x41, 0x9A, 0xEC, 0x5F, 0x12, 0xF7, 0xD7, 0x9F, 0x53, 0x6F, 0xE3, 0xE2, 0xD2, 0x3A,
-    0x24, 0xAE, 0xC6, 0x75, 0xAB, 0xF1, 0xD0, 0xDC, 0xBA, 0xF1, 0xD0, 0x4E, 0x0C, 0x78, 0x60, 0xE3,
-    0xE1, 0x2C, 0xA2, 0x07, 0xAE, 0x7C, 0x6E, 0x1A, 0xE2, 0xDF, 0x2D, 0x6A, 0x30, 0xB4, 0xDD, 0x13,
-    0x55, 0x50, 0x8D, 0x67, 0x77, 0xCF, 0x4E, 0x59, 0x78, 0x7F, 0x5F, 0xEB, 0xC4, 0x4D, 0x0D, 0xF0,
-    0xE5, 0x54, 0xA3, 0xFB, 0x25, 0x26, 0x9F, 0x68, 0xD4, 0x05, 0x79, 0x13, 0x86, 0xF9, 0xC6, 0x97,
-    0x0F, 0x9E, 0x7C, 0x7C, 0xD0, 0xE4, 0x13, 0xD6, 0x46, 0xF4, 0x9A, 0x60, 0xBB, 0xF8, 0x12, 0x1F,
-    0x6D, 0x91, 0xFA, 0x3F, 0x29, 0x3C, 0x36, 0xB8, 0x74, 0x6A, 0x7F, 0x73, 0xDF, 0x47, 0x33, 0x25,
-    0x5E, 0xBE, 0x4C, 0x7B, 0xE7, 0xF8, 0x63, 0x42, 0x9F, 0xDA, 0x75, 0xAD, 0x02, 0x84, 0x8A, 0x5F,
-    0xA3, 0x2D, 0xA4, 0x79, 0xC8, 0x40, 0x02, 0x13, 0x55, 0x2C, 0x2A, 0xAB, 0xE1, 0xD1, 0x54, 0x18,
-    0xCA, 0xCD, 0x13, 0x19, 0x8C, 0x17, 0x9F, 0x62, 0xF5, 0x49, 0xD1, 0x6B, 0x15, 0xEE, 0x7A, 0x03,
-    0xD2, 0xE9, 0x5C, 0xB3, 0x88, 0x7B, 0x9B, 0xF2, 0xB3, 0x20, 0x69, 0x2D, 0x1B, 0x02, 0x15, 0x65,
-    0x74, 0xD5, 0xD6, 0x82, 0x09, 0x9B, 0x18, 0x63, 0x05, 0x40, 0xA5, 0x75, 0x06, 0x1B, 0xD4, 0x61,
-    0xCB, 0xE0, 0x1C, 0xEE, 0x45, 0xDE, 0x18, 0xFD, 0x22, 0x67, 0x27, 0x46, 0x03, 0x0B, 0x57, 0x28,
-    0x13, 0x66, 0x4A, 0x12, 0x99, 0x44, 0x8F, 0xAD, 0x68, 0x7E, 0xA7, 0xC1, 0xF9, 0x00, 0x3E, 0x2A,
-    0x3C, 0x59, 0x78, 0x6E, 0xE8, 0x93, 0x6B, 0x74, 0xFA, 0xD1, 0x67, 0xDA, 0xD1, 0x71, 0xFE, 0xD3,
-    0x7E, 0xDF, 0x41, 0x04, 0x35, 0xC9, 0x54, 0x5C, 0x52, 0x74, 0x9F, 0xBD, 0xC5, 0x04, 0x42, 0x5F,
-    0xFC, 0x90, 0x0D, 0x32, 0x8D, 0x7D, 0x8C, 0xC1, 0xF3, 0x4A, 0x53, 0x10, 0x36, 0x67, 0xE5, 0x0A,
-    0xD2, 0x22, 0x2B, 0xFB, 0xB2, 0x09, 0x59, 0x3C, 0x08, 0xE7, 0x51, 0x7E, 0x2B, 0x18, 0x39, 0x23,
-    0xCA, 0xDD, 0x57, 0x84, 0x3F, 0x45, 0xAC, 0xA6, 0xB2, 0xB8, 0x29, 0x1A, 0x34, 0xF1, 0x6F, 0x72,
-    0xB3, 0x15, 0xF3, 0x50, 0x94, 0x0A, 0x29, 0xB5, 0x95, 0xF8, 0xE1, 0x50, 0x0B, 0x82, 0x3D, 0x23,
-    0x5B, 0xAE, 0x4E, 0x23, 0x90, 0x75, 0x15, 0xEB, 0x8D, 0x9A, 0x82, 0x60, 0x5E, 0x4C, 0x02, 0x9A,
-    0xA3, 0x87, 0xEC, 0x9F, 0xAC, 0x66, 0x83, 0x69, 0x76, 0x02, 0x57, 0x9C, 0x1A, 0xEE, 0xD9, 0x4F,
-    0x07, 0xBE, 0xBB, 0x78, 0x74, 0xD0, 0xA2, 0xD4, 0x47, 0x47, 0x2D, 0x4A, 0x5D, 0xDB, 0x3F, 0x11,
-    0x2A, 0x9C, 0x61, 0x4B, 0x63, 0x32, 0x22, 0xF1, 0x2B, 0x0C, 0x87, 0xA2, 0xD4, 0xA8, 0xD7, 0xA2,
-    0xD4, 0xA9, 0x10, 0xD2, 0x73, 0xEB, 0x71, 0x11, 0x52, 0x17, 0xE5, 0xDA, 0xAC, 0xEB, 0xFE, 0x17,
-    0xEF, 0x76, 0x47, 0x69, 0x84, 0x1D, 0x0D, 0xE7, 0xB3, 0x64, 0x02, 0xF9, 0xFB, 0xF5, 0xF9, 0x4A,
-    0x91, 0xC1, 0x22, 0x58, 0x70, 0x47, 0x4A, 0x6A, 0x91, 0xA2, 0x8D, 0x53, 0x7D, 0x67, 0x54, 0x8A,
-    0xF9, 0xC9, 0x59, 0x56, 0x36, 0x47, 0x18, 0x58, 0xBC, 0x6C, 0x34, 0x5E, 0xAE, 0x2C, 0x2C, 0x6E,
-    0x14, 0x18, 0xF8, 0x0C, 0x31, 0xEC, 0xA3, 0x44, 0xB3, 0x21, 0x8F, 0x8C, 0x70, 0x4D, 0x46, 0xD5,
-    0xD4, 0xAC, 0xE9, 0x59, 0xD5, 0x7E, 0x9A, 0x82, 0x66, 0xC1, 0x1A, 0xA2, 0x0C, 0xC2, 0x38, 0xB8,
-    0x47, 0x18, 0x98, 0x62, 0xAE, 0x95, 0x1A, 0xE1, 0xDE, 0x4B, 0x70, 0x4D, 0x90, 0xFA, 0x11, 0xDF,
-    0x15, 0xF6, 0xD4, 0xB3, 0x37, 0x45, 0x18, 0x93, 0x85, 0x81, 0xD7, 0x03, 0x1C, 0xE6, 0xCA, 0x04,
-    0x34, 0xB0, 0x56, 0x60, 0xDA, 0x7C, 0xBD, 0xC9, 0x65, 0x0F, 0x09, 0x1A, 0x8C, 0x58, 0x28, 0xCF,
-    0xF8, 0x36, 0x43, 0x93, 0x70, 0x9E, 0xD0, 0xD9, 0xA4, 0xB9, 0xEC, 0x86, 0x85, 0x97, 0x62, 0x73,
-    0xC5, 0xDF, 0xB1, 0x29, 0x6A, 0x7F, 0x98, 0xAF, 0x9B, 0x1A, 0xAC, 0x88, 0xE1, 0x69, 0xB6, 0xD7,
-    0xFD, 0xC4, 0x32, 0xEB, 0x97, 0xB5, 0xE3, 0x09, 0xC1, 0x20, 0x80, 0xF9, 0xEC, 0xC2, 0x5B, 0xF0,
-    0x73, 0xDF, 0x2C, 0xD0, 0x8E, 0xF6, 0x02, 0x0B, 0xF1, 0x8E, 0xDB, 0x0D, 0x55, 0x22, 0x56, 0xF4,
-    0x63, 0xEA, 0xDE, 0xA8, 0x4A, 0xE6, 0x16, 0x54, 0xE9, 0x0A, 0x52, 0xC5, 0x92, 0x1E, 0xCC, 0x79,
-    0x5C, 0x86, 0x2C, 0xC7, 0x1F, 0xFC, 0xD7, 0x61, 0x6E, 0x64, 0xAD, 0x5C, 0x2A, 0x14, 0x6D, 0x2B,
-    0xFF, 0x02, 0x45, 0xB5, 0xFF, 0x0B, 0x5D, 0x71, 0x16, 0xED, 0x37, 0xB2, 0x99, 0x32, 0x94, 0x26,
-    0x40, 0xA2, 0x5E, 0x97, 0xC9, 0x90, 0xD4, 0x15, 0x68, 0xED, 0x6B, 0xF8, 0xE3, 0x5F, 0x60, 0xCA,
-    0x3F, 0x47, 0x68, 0xF6, 0x2D, 0x44, 0x7D, 0xFE, 0x0F, 0xF2, 0xF6, 0x68, 0xD9, 0x99, 0xF6, 0xB8,
-    0x42, 0xB0, 0xCC, 0x22, 0x53, 0x1A, 0xD8, 0x2E, 0x43, 0x1C, 0xB8, 0xC3, 0x19, 0x24, 0xF6, 0x1A,
-    0x57, 0xA3, 0xC7, 0x82, 0xC4, 0x5C, 0x4D, 0xA6, 0xAB, 0xB9, 0xDD, 0x1E, 0xB3, 0x63, 0x61, 0xDA,
-    0x63, 0xAD, 0x4F, 0x85, 0xC5, 0x20, 0x6C, 0x9A, 0x5F, 0xE8, 0xD9, 0xE5, 0x69, 0x30, 0xDC, 0x59,
-    0x86, 0x45, 0xC2, 0x79, 0x98, 0x24, 0xEB, 0x37, 0xD9, 0x5C, 0x24, 0x84, 0x50, 0xCE, 0x52, 0x32,
-    0xE8, 0x05, 0xC4, 0x06, 0xFB, 0x99, 0x26, 0xD0, 0xE1, 0x10, 0x82, 0x10, 0xAD, 0x64, 0x15, 0x1B,
-    0xD9, 0x4A, 0xEC, 0x41, 0xC6, 0xA6, 0xF3, 0xE2, 0x02, 0x59, 0xFB, 0x87, 0x4C, 0x2B, 0xEE, 0xD0,
-    0xE1, 0x28, 0xB4, 0x7F, 0x2E, 0x67, 0x0E, 0x99, 0xA2, 0x08, 0x2E, 0x64, 0x4B, 0x2A, 0x34, 0x15,
-    0x03, 0x11, 0xA0, 0x67, 0xD0, 0x85, 0x5A, 0x78, 0xA7, 0x45, 0x78, 0x6C, 0x1F, 0x5E, 0x73, 0x42,
-    0x2B, 0xD6, 0x5E, 0xC9, 0x1B, 0x0B, 0x5B, 0xC9, 0xF4, 0xAC, 0xBC, 0xEF, 0x54, 0x81, 0xD7, 0x15,
-    0x6F, 0x22, 0xDA, 0x06, 0x9D, 0x6C, 0x33, 0x64, 0xA4, 0xB4, 0x39, 0x39, 0xD7, 0xA6, 0x3D, 0xC6,
-    0x64, 0x34, 0x72, 0xAE, 0xDD, 0xB0, 0x01, 0xCA, 0x75, 0xD8, 0xD0, 0xC1, 0x7E, 0xEA, 0x0A, 0x3D,
-    0x81, 0x49, 0xB9, 0xE9, 0xAA, 0xD5, 0x1E, 0x24, 0x90, 0xCB, 0x35, 0xF0, 0xA2, 0x1A, 0xBC, 0x9F,
-    0xDB, 0x78, 0x77, 0xCF, 0x6B, 0xC6, 0x6F, 0xD9, 0xC6, 0xCB, 0x26, 0xBC, 0x88, 0x7D, 0x5B, 0xB1,
-    0x36, 0xF0, 0x4E, 0x6D, 0xBC, 0xD1, 0xDC, 0xC6, 0x7B, 0x31, 0x85, 0xDD, 0xD4, 0xB6, 0x39, 0x24,
-    0x11, 0x8C, 0x4B, 0x97, 0xD8, 0xDB, 0x55, 0xD8, 0x4E, 0xBD, 0x5B, 0x3C, 0xFC, 0x86, 0x65, 0xD1,
-    0x25, 0xB3, 0x0E, 0x38, 0xC9, 0x26, 0x9F, 0x2A, 0xD2, 0xC5, 0x1E, 0xD0, 0x5E, 0x5B, 0x2D, 0xC8,
-    0x92, 0x95, 0x5D, 0x7F, 0x62, 0x50, 0x2B, 0x18, 0x3B, 0xB4, 0x3D, 0xBE, 0x28, 0x0C, 0x6A, 0x91,
-    0x40, 0x44, 0xD2, 0x5D, 0xC1, 0x7E, 0xB2, 0x84, 0x64, 0x2E, 0x9B, 0xC3, 0xF6, 0xC8, 0x5D, 0xA5,
-    0x0A, 0xD0, 0x03, 0x66, 0x99, 0x93, 0x2E, 0x20, 0xB3, 0x5E, 0x94, 0x32, 0x8E, 0x34, 0x4A, 0x1B,
-    0x47, 0x1C, 0x47, 0x1D, 0x47, 0x1E, 0x47, 0x1F, 0x47, 0x20, 0x47, 0x21, 0x47, 0x22, 0x47, 0x23,
-    0x47, 0x24, 0x47, 0x25, 0xD7, 0xED, 0x8C, 0xDF, 0x4F, 0x9D, 0x61, 0x6C, 0x5D, 0x9A, 0xD8, 0x98,
-    0x9C, 0x87, 0x11, 0x5D, 0x67, 0x96, 0xA7, 0xF9, 0xBC, 0x8B, 0x49, 0x14, 0x73, 0xE7, 0xB9, 0xEB,
-    0x18, 0xB2, 0xD6, 0xC5, 0x90, 0x95, 0x12, 0xDB, 0x7D, 0x43, 0xDB, 0x47, 0x4E, 0xB4, 0xEC, 0x89,
-    0x6A, 0xE6, 0xC6, 0xE6, 0xE9, 0xA2, 0xB9, 0x4E, 0xD7, 0xDB, 0x3C, 0x15, 0xFE, 0xB3, 0x19, 0x93,
-    0x15, 0x00, 0xBA, 0xE4, 0x60, 0x73, 0xCA, 0x0F, 0xF8, 0x49, 0xB4, 0xB0, 0xC7, 0xEE, 0x47, 0xDC,
-    0x8D, 0x36, 0x20, 0x9F, 0x21, 0xCB, 0x16, 0x59, 0xCB, 0x2A, 0x66, 0x12, 0xB3, 0x0C, 0x06, 0x36,
-    0x67, 0x92, 0x1F, 0x11, 0xD8, 0x64, 0xAD, 0x8D, 0x37, 0xA2, 0xA1, 0x32, 0x45, 0xD8, 0x10, 0x4D,
-    0x56, 0x03, 0x72, 0x0E, 0x53, 0xE8, 0xD7, 0x45, 0x61, 0x9C, 0xEF, 0x05, 0x39, 0x33, 0xBF, 0xFF,
-    0xF8, 0x54, 0xCE, 0xA5, 0x4D, 0xB9, 0xEA, 0xA2, 0xE9, 0x19, 0x4A, 0xAC, 0xC1, 0x5A, 0xB6, 0xE7,
-    0x33, 0x6D, 0xE6, 0x8D, 0xA8, 0x05, 0x05, 0xBF, 0x80, 0xB1, 0x56, 0xAE, 0x5E, 0xC3, 0xB0, 0x77,
-    0x8E, 0xD5, 0xBC, 0x48, 0x7B, 0xE3, 0x00, 0x94, 0x46, 0xDC, 0xB3, 0x21, 0xEB, 0x90, 0x07, 0x0A,
-    0x05, 0x3D, 0xA0, 0x22, 0x0B, 0x49, 0x31, 0xC4, 0xB9, 0x10, 0xED, 0x82, 0x2F, 0xB3, 0xF4, 0x05,
-    0xF5, 0xBC, 0x08, 0x4C, 0xCA, 0xBB, 0x68, 0x17, 0xA6, 0x6B, 0x34, 0x2E, 0xA0, 0xBD, 0x95, 0x87,
-    0x98, 0xB4, 0x2A, 0xBD, 0x2B, 0x7B, 0xFD, 0x45, 0xAD, 0xC3, 0xF6, 0xC5, 0x95, 0x15, 0x03, 0x19,
-    0xC8, 0xBB, 0xDB, 0x48, 0xFC, 0xD2, 0x26, 0xF9, 0xA8, 0x4F, 0xEA, 0xEC, 0x82, 0xBC, 0x18, 0x27,
-    0x60, 0x08, 0xB6, 0x92, 0x97, 0x5B, 0xCC, 0x00, 0x29, 0xFE, 0x4A, 0x30, 0x9B, 0xE0, 0x14, 0x24,
-    0xB7, 0x0A, 0x24, 0xB7, 0x32, 0xF2, 0xFD, 0xF8, 0x5D, 0x65, 0x32, 0x3D, 0x39, 0xEA, 0x44, 0xD6,
-    0x6C, 0x45, 0xF7, 0x57, 0xF4, 0x98, 0xC4, 0xD3, 0x1D, 0xEF, 0x13, 0x30, 0x16, 0xD7, 0xF2, 0xF7,
-    0x7D, 0x76, 0xC1, 0x0E, 0xC5, 0x85, 0x6E, 0x2C, 0x9E, 0x6F, 0xC6, 0xE2, 0x85, 0x66, 0x28, 0x5E,
-    0xB8, 0xDC, 0x17, 0x6F, 0x5E, 0xE9, 0xB2, 0x77, 0xE8, 0x01, 0xC2, 0x53, 0xEB, 0x09, 0x57, 0x8E,
-    0x6E, 0x44, 0xF0, 0xAB, 0x88, 0xCC, 0x1D, 0x31, 0xD1, 0xF8, 0xE7, 0x37, 0x37, 0x84, 0xAF, 0x49,
-    0xD8, 0x7E, 0x3E, 0xB8, 0x08, 0xBC, 0xF0, 0xEF, 0x89, 0xD1, 0xFA, 0xE9, 0x8F, 0x37, 0x2B, 0xDC,
-    0x0E, 0xCF, 0x4D, 0x25, 0x9A, 0xD9, 0x2D, 0xC3, 0x73, 0x7F, 0x41, 0xBF, 0x21, 0x62, 0x22, 0xA0,
-    0xD5, 0xE0, 0x71, 0xE2, 0x80, 0x4C, 0x9C, 0x9B, 0xFB, 0x0B, 0x4D, 0x23, 0x4D, 0xDE, 0x7E, 0xBC,
-    0xE8, 0x4B, 0x67, 0x33, 0x75, 0x7C, 0xEB, 0xBE, 0x74, 0x73, 0x8B, 0xBE, 0x74, 0x7F, 0x7C, 0x09,
-    0x66, 0x91, 0x25, 0xF8, 0x2C, 0xC3, 0x0F, 0xF7, 0x17, 0x34, 0x4E, 0xDE, 0xD5, 0xE6, 0x0B, 0xED,
-    0x15, 0x83, 0x59, 0x69, 0x7B, 0x85, 0x98, 0x8C, 0x91, 0x40, 0x0D, 0xED, 0x15, 0x25, 0x10, 0x76,
-    0x09, 0x25, 0xB8, 0x42, 0x60, 0x98, 0x87, 0xDE, 0xA0, 0x34, 0x7D, 0xBD, 0xAF, 0x34, 0x7D, 0xD3,
-    0x65, 0x11, 0x4F, 0x5D, 0x16, 0xD0, 0xF9, 0x27, 0xC0, 0xD1, 0x6B, 0x5B, 0x83, 0xA5, 0x57, 0x38,
-    0x15, 0x45, 0x1B, 0xA5, 0x17, 0x68, 0x3B, 0xC9, 0xCD, 0x7C, 0x2A, 0xE1, 0xFE, 0x96, 0xF1, 0x5D,
-    0x2A, 0xA4, 0x9C, 0x2D, 0xCF, 0xEC, 0x3D, 0xE6, 0xB9, 0x19, 0xA8, 0x85, 0xD6, 0x53, 0x14, 0x82,
-    0x16, 0x56, 0xF5, 0xFA, 0x94, 0x59, 0x67, 0xDA, 0x67, 0xAD, 0x21, 0xB7, 0x6A, 0x6E, 0x30, 0x35,
-    0x9F, 0x1B, 0x7B, 0xED, 0xF8, 0x7E, 0x6F, 0x40, 0x14, 0x9C, 0x1D, 0x7B, 0x28, 0xFA, 0x28, 0x99,
-    0x2C, 0xCF, 0x63, 0x97, 0x04, 0x8C, 0x98, 0x04, 0x14, 0x8A, 0xEE, 0x4B, 0x02, 0x22, 0xC5, 0x18,
-    0xDC, 0xEA, 0xD4, 0x37, 0xE7, 0x46, 0xA1, 0x45, 0xA8, 0xE6, 0x81, 0x63, 0xE8, 0x35, 0x16, 0x67,
-    0xDF, 0x83, 0x22, 0x67, 0x6B, 0xB2, 0xFC, 0x74, 0x8D, 0x9E, 0xF7, 0x15, 0x0D, 0x34, 0xAD, 0x94,
-    0xEA, 0x42, 0xFA, 0x3A, 0xAD, 0xE3, 0xBF, 0x87, 0x8A, 0x8B, 0xF9, 0x1C, 0xB8, 0x28, 0x55, 0xE5,
-    0x1C, 0xE4, 0x59, 0xB2, 0x41, 0xD2, 0xD7, 0xA8, 0x02, 0x0F, 0x89, 0x40, 0xF9, 0x2D, 0x42, 0x52,
-    0xF0, 0xC6, 0x04, 0x18, 0xCA, 0x44, 0xD6, 0x3D, 0x4E, 0xF8, 0x11, 0xAD, 0x27, 0x03, 0x88, 0x3D,
-    0x10, 0x32, 0x0D, 0xAE, 0x22, 0x49, 0x3B, 0xEC, 0x8B, 0xC6, 0x01, 0xD6, 0xCC, 0x1D, 0x74, 0x91,
-    0xB3, 0x3A, 0xC2, 0x1C, 0x43, 0xC9, 0xFF, 0xBE, 0x68, 0xC1, 0x4D, 0x0D, 0xFD, 0x74, 0x01, 0xBF,
-    0x68, 0x43, 0x7F, 0xF1, 0x25, 0x1A, 0xFA, 0x2F, 0x1A, 0xC2, 0x1F, 0xC8, 0x9C, 0x30, 0x29, 0x5A,
-    0x4E, 0x6E, 0x6B, 0xC7, 0x83, 0x7E, 0xD9, 0x87, 0x0D, 0x11, 0x0D, 0x7B, 0xCD, 0xD3, 0xC7, 0x4D,
-    0x81, 0xB6, 0x7D, 0x64, 0x70, 0x6F, 0x8C, 0xEE, 0xC5, 0xC4, 0xF0, 0x6B, 0x2D, 0x03, 0x2B, 0x5D,
-    0x1E, 0x39, 0xA6, 0x86, 0x78, 0x1F, 0x79, 0xBA, 0xE3, 0xE3, 0x8B, 0xDE, 0xE8, 0x8B, 0xEF, 0x27,
-    0x5B, 0xD7, 0x88, 0x8F, 0x49, 0x9B, 0x10, 0xDF, 0xDA, 0xA6, 0xE3, 0xF4, 0x27, 0xE0, 0x74, 0x19,
-    0x51, 0xC9, 0xD3, 0x65, 0x18, 0xC1, 0xAC, 0xF1, 0xE2, 0x5C, 0x91, 0x64, 0x79, 0x90, 0x49, 0x49,
-    0x04, 0xA4, 0x87, 0x11, 0x38, 0x1C, 0xE4, 0xCF, 0x38, 0x08, 0x4D, 0xBF, 0x9B, 0xC3, 0x08, 0xC2,
-    0x09, 0x01, 0xE1, 0x60, 0x3B, 0x97, 0xC6, 0xD2, 0xEA, 0xDE, 0x94, 0xE3, 0x2D, 0x30, 0xCE, 0xB0,
-    0xA8, 0xCA, 0xE8, 0x37, 0xA7, 0x4D, 0x8A, 0xBF, 0x6F, 0xAD, 0x60, 0x4F, 0x2B, 0xC8, 0xFF, 0x98,
-    0x3D, 0x99, 0x68, 0x90, 0xCA, 0x1D, 0xEA, 0xE1, 0x80, 0x4F, 0xEA, 0x69, 0x4F, 0x07, 0x0F, 0xBC,
-    0x62, 0x0B, 0x72, 0x20, 0xC3, 0xB0, 0x63, 0x4F, 0x00, 0x05, 0x08, 0x38, 0x6E, 0x11, 0x4E, 0x43,
-    0xA1, 0xED, 0x7D, 0x8E, 0x20, 0xB9, 0x46, 0x72, 0x65, 0x61, 0xB3, 0x38, 0xEF, 0x2A, 0x1C, 0x21,
-    0x18, 0x21, 0x14, 0x89, 0xDC, 0x11, 0x07, 0x1A, 0xE4, 0x70, 0x47, 0x1C, 0x80, 0x26, 0x1A, 0x28,
-    0x83, 0xD0, 0x67, 0xD7, 0x8B, 0xE5, 0x39, 0x07, 0xBE, 0x7D, 0xEF, 0x80, 0x90, 0x54, 0xB8, 0xF7,
-    0x22, 0x22, 0xA2, 0x10, 0x38, 0xEC, 0x4B, 0x62, 0xEB, 0xDB, 0x75, 0xA6, 0xD9, 0xC9, 0xF7, 0xF7,
-    0xBB, 0xA9, 0x12, 0x39, 0x9B, 0x0A, 0x5F, 0xF3, 0xA4, 0x2E, 0xF2, 0xA2, 0x2A, 0xFE, 0x11, 0x85,
-    0xAF, 0xA8, 0xBE, 0x80, 0xC4, 0x16, 0x93, 0xBA, 0x7D, 0x19, 0xDD, 0xB3, 0x66, 0xED, 0xBE, 0xE9,
-    0x8D, 0xFB, 0xAD, 0x26, 0x7F, 0x21, 0xF1, 0x28, 0x5B, 0x7E, 0xE0, 0xAC, 0xAE, 0xB1, 0xDB, 0x5A,
-    0x63, 0xBC, 0x59, 0xE3, 0x07, 0xE8, 0x41, 0x7A, 0xBB, 0x16, 0x55, 0x7A, 0xE1, 0x67, 0xB2, 0xBC,
-    0x77, 0xDE, 0x90, 0xE1, 0x86, 0x75, 0x6B, 0xE4, 0x61, 0x53, 0xBE, 0x85, 0x2F, 0x15, 0x81, 0x7D,
-    0x23, 0xAC, 0xF1, 0x6B, 0x58, 0xE3, 0x37, 0xF1, 0x82, 0x3F, 0xD8, 0x3A, 0xCB, 0x41, 0xF4, 0x61,
-    0xEF, 0x3A, 0x08, 0x3B, 0x1C, 0xE4, 0x95, 0xFD, 0xEF, 0xA8, 0x29, 0x7E, 0x28, 0x8B, 0x78, 0x2B,
-    0x6B, 0x8A, 0x4B, 0x82, 0x3C, 0xD9, 0x21, 0x21, 0x0B, 0x10, 0xB5, 0x66, 0x9E, 0x92, 0x45, 0xFC,
-    0x40, 0x16, 0xF1, 0x0F, 0xCB, 0x18, 0xEB, 0xC6, 0x5C, 0x96, 0x93, 0x83, 0xBA, 0x08, 0x59, 0x31,
-    0x65, 0xC5, 0x6E, 0x15, 0xB5, 0x77, 0x28, 0x66, 0xDD, 0x23, 0x10, 0x4C, 0x88, 0x73, 0x99, 0xAA,
-    0x6F, 0xF6, 0xAD, 0x74, 0x11, 0xB2, 0x9A, 0x4F, 0xAD, 0xD8, 0xE7, 0x36, 0x1D, 0x74, 0x00, 0x80,
-    0x81, 0xB7, 0xB6, 0x1A, 0x5D, 0x31, 0x9F, 0x56, 0xBC, 0xB2, 0xE0, 0x15, 0x7D, 0xE3, 0x0A, 0x9F,
-    0x82, 0x65, 0x64, 0x7B, 0x1F, 0xE0, 0xBE, 0xE9, 0xD0, 0x8C, 0xF9, 0x6B, 0x87, 0xEA, 0x9E, 0x29,
-    0x79, 0xF6, 0xA3, 0x9A, 0x64, 0x84, 0xCA, 0x11, 0xBF, 0xA6, 0xBB, 0xFF, 0x59, 0x11, 0x9D, 0x2E,
-    0xBE, 0x80, 0xA0, 0x79, 0xF2, 0x26, 0x22, 0x47, 0xC9, 0xFB, 0xC3, 0x9F, 0x13, 0x90, 0x28, 0x24,
-    0xD1, 0xF3, 0x78, 0x00, 0x10, 0xA2, 0x9B, 0x0E, 0xC5, 0x53, 0x7B, 0xAD, 0x75, 0x02, 0xBE, 0xFD,
-    0x9B, 0x57, 0x8D, 0x36, 0x41, 0x19, 0x33, 0xA5, 0xE4, 0xDB, 0xED, 0x3A, 0xD6, 0x88, 0x74, 0xD7,
-    0x88, 0x5F, 0x73, 0x2C, 0x14, 0xB5, 0xFF, 0x0C, 0x52, 0x99, 0xAF, 0x81, 0x76, 0x45, 0xF6, 0xB3,
-    0x02, 0x32, 0x68, 0xD1, 0xCE, 0x03, 0x00, 0x75, 0xF1, 0x84, 0xA3, 0x8F, 0x9E, 0x55, 0x50, 0xFB,
-    0x2E, 0xB6, 0x89, 0xFE, 0x0F, 0x99, 0xD2, 0xF5, 0x7D, 0xA7, 0xBD, 0xFC, 0x56, 0xD7, 0x78, 0xAB,
-    0xC6, 0xC0, 0x9B, 0xCA, 0xAD, 0xBE, 0x1A, 0x3A, 0x50, 0x98, 0xC7, 0x29, 0xFC, 0xB1, 0x1E, 0x96,
-    0x91, 0x0F, 0x46, 0x8D, 0x10, 0xD2, 0x62, 0xED, 0xDE, 0x70, 0xB0, 0x69, 0xFE, 0x9C, 0xB3, 0x5D,
-    0x7D, 0xAB, 0xFA, 0xA4, 0xE0, 0x77, 0xB5, 0x5C, 0x4A, 0x58, 0x29, 0x80, 0x09, 0x6B, 0xC5, 0x2C,
-    0x81, 0x75, 0x1D, 0x74, 0x53, 0x3A, 0xE3, 0xD8, 0xD6, 0xC2, 0x7F, 0x67, 0x0E, 0xA4, 0x3B, 0xE5,
-    0xD8, 0xF6, 0xB5, 0xB5, 0x1A, 0x89, 0xE2, 0xB1, 0xA9, 0xC0, 0xA3, 0x71, 0x5B, 0xE8, 0x6A, 0x7B,
-    0x4E, 0x98, 0x7B, 0xB0, 0x77, 0xFF, 0x37, 0x0B, 0x02, 0xD6, 0x13, 0x8F, 0x6B, 0x81, 0x4D, 0x30,
-    0x3C, 0x41, 0x50, 0x63, 0x88, 0x17, 0x1C, 0xCC, 0x99, 0x47, 0x05, 0x3E, 0x2C, 0xFE, 0x63, 0x9E,
-    0xA5, 0x5A, 0x9C, 0xD6, 0x9A, 0x4F, 0x67, 0x65, 0xFE, 0xDD, 0x8E, 0x7A, 0xB6, 0xBD, 0x71, 0xA7,
-    0x33, 0xB8, 0x43, 0x9B, 0x56, 0xE9, 0x17, 0x09, 0x05, 0x3A, 0xAE, 0x9A, 0x82, 0x4C, 0x0D, 0x8E,
-    0x96, 0x9C, 0x54, 0x6F, 0xAD, 0xA7, 0x4E, 0xF3, 0x3C, 0xD9, 0x61, 0x3A, 0x21, 0x77, 0x13, 0xB1,
-    0x15, 0xA2, 0xAC, 0x2E, 0x22, 0xF1, 0x0C, 0xC5, 0xA0, 0xC8, 0xCB, 0x76, 0xCB, 0xF3, 0xB5, 0x2B,
-    0x57, 0xD5, 0xAA, 0xB8, 0x52, 0x83, 0xBA, 0x3C, 0x9A, 0x64, 0x6E, 0x29, 0xD2, 0x66, 0x22, 0x8E,
-    0xDA, 0x4C, 0xD4, 0xE3, 0x1D, 0x41, 0xB7, 0xE9, 0xD5, 0x54, 0x07, 0x15, 0xFD, 0x23, 0x46, 0x55,
-    0x30, 0xCE, 0x10, 0xC2, 0x3B, 0xD1, 0x79, 0xFE, 0xA4, 0x85, 0x3D, 0x66, 0xF2, 0xA4, 0xC6, 0x96,
-    0xC9, 0x16, 0xA2, 0x21, 0x31, 0xBF, 0x6F, 0x8E, 0xC3, 0x2C, 0xD0, 0x89, 0xA2, 0xB5, 0x8D, 0x8B,
-    0xBB, 0xED, 0x73, 0xD5, 0x5A, 0xC4, 0x44, 0x9F, 0x2D, 0x1C, 0x76, 0xEA, 0xB9, 0xE8, 0xD2, 0x9D,
-    0x2B, 0x80, 0x7A, 0x19, 0x36, 0x37, 0x72, 0xEA, 0x68, 0x86, 0x9A, 0x8E, 0x14, 0xC0, 0x0F, 0xC4,
-    0xEF, 0xEE, 0x11, 0x41, 0xEB, 0x18, 0xBE, 0x3F, 0xEA, 0x1A, 0x8C, 0x36, 0xE8, 0xAD, 0x98, 0x81,
-    0xF4, 0x8F, 0xE7, 0x10, 0x55, 0xB5, 0x0C, 0x51, 0xAD, 0xF7, 0x87, 0xA8, 0xD2, 0x2F, 0x1A, 0xA2,
-    0xE2, 0x69, 0x51, 0xCB, 0x93, 0xE6, 0x34, 0xEA, 0xA2, 0x4E, 0x90, 0x86, 0x5E, 0x1C, 0x16, 0x74,
-    0x96, 0x72, 0xBD, 0x4C, 0x04, 0x83, 0x32, 0xBF, 0x24, 0x50, 0xD6, 0x1C, 0x89, 0x96, 0x1E, 0xAB,
-    0x9E, 0x99, 0x18, 0xE8, 0xCB, 0x07, 0xAA, 0x86, 0xD9, 0x6E, 0x2E, 0xD3, 0xC2, 0x2E, 0x30, 0xB3,
-    0xE9, 0x22, 0x12, 0xC1, 0x58, 0x7F, 0xAA, 0x41, 0x8D, 0x54, 0xDB, 0x0E, 0x57, 0x73, 0x7D, 0xDF,
-    0xDD, 0x0B, 0xE4, 0xD9, 0x72, 0x11, 0xC8, 0x23, 0x3A, 0xB4, 0x9B, 0x36, 0x65, 0x85, 0xB1, 0x6A,
-    0x7C, 0xD4, 0xE0, 0xA8, 0xB3, 0xBE, 0x8C, 0xB5, 0xDF, 0xC9, 0x40, 0xDE, 0x8C, 0x6C, 0x67, 0x8E,
-    0xD9, 0x08, 0xDD, 0xFD, 0x2F, 0xDD, 0x39, 0x78, 0xBB, 0x75, 0x8C, 0xD7, 0xFD, 0xE7, 0x9B, 0x6D,
-    0x74, 0x5B, 0x6D, 0xE1, 0xA8, 0x7D, 0xA8, 0x6D, 0x53, 0x3C, 0x75, 0x4B, 0x78, 0x5B, 0x1F, 0x08,
-    0x6F, 0xBF, 0x6F, 0xB5, 0x5F, 0xCC, 0x5A, 0x86, 0x70, 0xA6, 0xDE, 0x2E, 0x6F, 0x02, 0xBA, 0xF2,
-    0x7D, 0xF8, 0x45, 0x8D, 0x89, 0xCC, 0xC7, 0x42, 0xD6, 0x7A, 0x2C, 0x64, 0x75, 0xE0, 0xB1, 0x90,
-    0x66, 0x1C, 0x36, 0xC7, 0x42, 0xA6, 0xFB, 0x8F, 0x85, 0x1C, 0x71, 0x2C, 0xA4, 0xD7, 0xBD, 0x86,
-    0x63, 0x21, 0xFD, 0xF6, 0xB5, 0xC8, 0x1D, 0x0B, 0xF9, 0x1C, 0xBC, 0xFB, 0x22, 0x43, 0x11, 0x45,
-    0x93, 0x8D, 0xF2, 0xD2, 0xA8, 0xCE, 0xD0, 0x64, 0x10, 0x55, 0x59, 0x17, 0xDA, 0x36, 0xC6, 0xB1,
-    0x90, 0xD8, 0x90, 0xAC, 0x8E, 0x10, 0x53, 0x48, 0x4A, 0x77, 0x6C, 0xE8, 0x14, 0x3E, 0xB0, 0x8B,
-    0x62, 0xF4, 0x29, 0xA8, 0xE7, 0xAA, 0x39, 0xE7, 0xE3, 0x56, 0x59, 0x94, 0x83, 0xEC, 0x68, 0xB3,
-    0x42, 0x7E, 0x14, 0x47, 0x8A, 0xAC, 0x71, 0x32, 0x4F, 0xCD, 0xF3, 0x44, 0x2A, 0xEF, 0x46, 0x13,
-    0x5D, 0xAA, 0xFC, 0x6B, 0x6D, 0x22, 0xD4, 0xB9, 0xD6, 0x66, 0xB2, 0xFB, 0x57, 0xDA, 0x01, 0xA7,
-    0x8A, 0xFC, 0x0A, 0x9D, 0x30, 0x1F, 0xDD, 0x68, 0x0B, 0x13, 0xBD, 0x6D, 0x71, 0xAA, 0xC8, 0xDB,
-    0xE8, 0x3B, 0x4F, 0xDE, 0xB0, 0xAF, 0x8B, 0x9B, 0xF7, 0x06, 0xAA, 0xDD, 0xB2, 0x33, 0xD6, 0xB3,
-    0x4B, 0x2C, 0xB4, 0x4C, 0x03, 0xE5, 0x9B, 0x00, 0xF4, 0xEE, 0x57, 0x0A, 0x4E, 0x84, 0x4A, 0x88,
-    0x2E, 0x95, 0xEC, 0x0F, 0x74, 0xD6, 0xB5, 0xD9, 0x87, 0x48, 0x3C, 0x77, 0xBA, 0x20, 0xF3, 0x77,
-    0x1C, 0x63, 0x07, 0x33, 0xC8, 0x55, 0x3B, 0x64, 0x2B, 0x54, 0x7B, 0xAE, 0x07, 0x1E, 0x98, 0x8D,
-    0x03, 0x9D, 0xF5, 0x44, 0x67, 0x24, 0x49, 0x38, 0x37, 0x8C, 0xD9, 0xC5, 0xF3, 0x7A, 0x4E, 0x29,
-    0x0D, 0x8D, 0x6B, 0x02, 0xA3, 0x5C, 0x87, 0x3C, 0x61, 0x93, 0x3D, 0x26, 0x1B, 0xD1, 0xD6, 0xC3,
-    0x9D, 0x65, 0x1E, 0xA7, 0x4C, 0x92, 0x0A, 0xE7, 0xBF, 0x01, 0x86, 0xE9, 0xB4, 0x23, 0xC2, 0x1D,
-    0xA5, 0x95, 0x34, 0xAF, 0x89, 0x97, 0x35, 0xA2, 0xC3, 0x24, 0x1C, 0x77, 0x04, 0x0B, 0x85, 0x7D,
-    0x82, 0xA2, 0x3F, 0xE7, 0xE5, 0xC0, 0xBE, 0x20, 0x33, 0x0E, 0x07, 0x03, 0x96, 0xBD, 0xF8, 0x27,
-    0x9E, 0xE0, 0x20, 0x90, 0x11, 0x9E, 0x4E, 0xA2, 0xDD, 0x97, 0xC6, 0xAF, 0x7E, 0x22, 0xCB, 0xFA,
-    0x0C, 0x64, 0xFD, 0x10, 0xB1, 0x99, 0xB2, 0xDD, 0x97, 0xD3, 0x75, 0x4B, 0x0F, 0xF5, 0x1C, 0x8D,
-    0x03, 0x0E, 0xB1, 0x8E, 0xCB, 0xC5, 0x21, 0xD6, 0x5C, 0x31, 0x17, 0xCC, 0xF5, 0xDE, 0xE2, 0x10,
-    0xEB, 0x66, 0x3A, 0xC4, 0x3A, 0x74, 0x87, 0x58, 0x87, 0xCF, 0x36, 0x26, 0xBE, 0x20, 0x4A, 0xE1,
-    0x4D, 0x61, 0xE0, 0x47, 0x36, 0x50, 0xF8, 0x8E, 0x2C, 0x91, 0x9D, 0x1A, 0xA5, 0x02, 0x41, 0x5E,
-    0xB5, 0x71, 0x48, 0x4F, 0xC0, 0x4F, 0xA7, 0x12, 0x53, 0x26, 0xEB, 0x72, 0x3D, 0x67, 0x50, 0x3D,
-    0xB1, 0xAC, 0x72, 0x99, 0x90, 0x33, 0x76, 0xF7, 0x65, 0xDC, 0xAE, 0xE7, 0xA4, 0xA1, 0x69, 0x98,
-    0xB1, 0xC2, 0x5E, 0x03, 0xA3, 0xD1, 0x78, 0x6E, 0xCA, 0xCE, 0x6B, 0xA0, 0x46, 0xAF, 0x2B, 0x77,
-    0x90, 0xA1, 0xC6, 0x22, 0xA8, 0xAA, 0x42, 0x9C, 0xBF, 0x8C, 0x1E, 0x22, 0xB6, 0x52, 0x34, 0x5A,
-    0x8E, 0x3A, 0x1D, 0xAB, 0x36, 0xAF, 0xF8, 0x55, 0xF4, 0x46, 0x0E, 0xA8, 0x06, 0xE2, 0xA1, 0x79,
-    0x62, 0xC4, 0xED, 0x23, 0x63, 0xD4, 0x86, 0xC3, 0x6A, 0xC4, 0x29, 0x15, 0xAC, 0xF0, 0xEC, 0x76,
-    0x7A, 0xED, 0x40, 0x2C, 0xD8, 0x5B, 0x5C, 0xE4, 0xD1, 0xDE, 0x5F, 0xBB, 0x63, 0x77, 0x85, 0x0E,
-    0x18, 0x3F, 0xB4, 0xDD, 0x4A, 0x0B, 0x62, 0x2B, 0xA1, 0x06, 0x9A, 0xC8, 0x86, 0x04, 0x4D, 0xF7,
-    0xE9, 0xA6, 0xA7, 0x91, 0xC7, 0xBC, 0xF3, 0x94, 0x77, 0x6D, 0xBA, 0x25, 0xFF, 0x1F, 0x4A, 0xF7,
-    0x7D, 0xBA, 0x46, 0xFE, 0x39, 0x65, 0x1A, 0xEE, 0x00, 0xEA, 0x76, 0x79, 0x0A, 0xF5, 0x2D, 0x8B,
-    0x61, 0x40, 0x80, 0x78, 0x3E, 0x80, 0x9A, 0x83, 0x39, 0x96, 0x1E, 0x83, 0xAD, 0x28, 0x0C, 0xFA,
-    0x9C, 0x5C, 0x28, 0xDE, 0xA7, 0xFD, 0x3C, 0x7A, 0xA0, 0x2F, 0x64, 0xE0, 0x0B, 0x01, 0x4F, 0x4D,
-    0xE6, 0x43, 0x7C, 0xA1, 0x29, 0xE2, 0x87, 0x7C, 0xDB, 0xC5, 0x74, 0xDB, 0x17, 0x0A, 0x6E, 0xE7,
-    0x13, 0x3E, 0x88, 0x6C, 0x40, 0xA6, 0x95, 0x30, 0x58, 0xEA, 0x39, 0x91, 0xAF, 0x23, 0x26, 0x9B,
-    0xA3, 0x07, 0xAE, 0x33, 0x53, 0x87, 0xC3, 0xDA, 0xC6, 0xCF, 0xB3, 0xC9, 0xA0, 0x00, 0x2F, 0x16,
-    0x75, 0xDC, 0x69, 0x1E, 0x12, 0x85, 0x27, 0x2B, 0x54, 0x49, 0x89, 0xA6, 0x49, 0xAE, 0x17, 0x83,
-    0x7E, 0x88, 0x44, 0xA0, 0x88, 0x72, 0x58, 0xBE, 0x52, 0x4F, 0x10, 0x40, 0xC9, 0x57, 0xE3, 0x9D,
-    0x85, 0xFF, 0x12, 0x68, 0xAD, 0xC9, 0xA1, 0x73, 0x3D, 0x8E, 0x48, 0x0B, 0x70, 0x40, 0xF8, 0x70,
-    0xBA, 0xD5, 0x0A, 0x13, 0x9E, 0x4A, 0xC3, 0x63, 0xD5, 0x22, 0xC6, 0x3B, 0xDC, 0x27, 0x78, 0x98,
-    0xA7, 0xD1, 0x1A, 0x32, 0x42, 0xDD, 0x70, 0xF8, 0x49, 0xB4, 0x2C, 0x6C, 0xBA, 0xBB, 0x6B, 0x0A,
-    0xCE, 0xB4, 0x8C, 0xF8, 0x42, 0x7C, 0x21, 0xC6, 0x77, 0x74, 0x9D, 0xF3, 0x87, 0xDD, 0x04, 0x97,
-    0xD5, 0x50, 0x85, 0x97, 0xD5, 0x52, 0x51, 0x6D, 0xDD, 0xF4, 0xF5, 0xBB, 0xE3, 0x3A, 0xC6, 0x9E,
-    0x2A, 0xB9, 0xE4, 0x05, 0xA5, 0x58, 0x76, 0x5C, 0xAF, 0xDF, 0xF2, 0xAB, 0x9B, 0x97, 0x75, 0xCF,
-    0xB8, 0x8C, 0xEE, 0x93, 0x88, 0xAC, 0x1B, 0xD6, 0xF5, 0x53, 0xCB, 0x69, 0xDE, 0xDD, 0xC3, 0xD9,
-    0x61, 0x26, 0xD8, 0x15, 0x29, 0x14, 0x8C, 0xBD, 0xEA, 0x8E, 0xD5, 0xCE, 0x9C, 0xD4, 0xED, 0xAF,
-    0x16, 0x1F, 0xE2, 0xA3, 0x07, 0xE5, 0x93, 0x71, 0xE2, 0x29, 0xDE, 0xCF, 0x2A, 0x07, 0xED, 0xD4,
-    0xC6, 0x2F, 0x19, 0x00, 0x7F, 0x88, 0x0A, 0x3F, 0xEC, 0xB7, 0x3F, 0x97, 0x60, 0x10, 0xE1, 0x93,
-    0x9F, 0x7D, 0xE7, 0xE1, 0xA2, 0x5B, 0x1C, 0xC1, 0x19, 0x71, 0x25, 0xC7, 0xCC, 0xD4, 0x31, 0x39,
-    0xBD, 0x28, 0x37, 0xC7, 0x9E, 0xB0, 0xD3, 0x53, 0xE8, 0xDE, 0xD1, 0xE1, 0x1E, 0xA7, 0xB7, 0xC5,
-    0xD7, 0x27, 0x00, 0xA2, 0x51, 0x86, 0x78, 0x7E, 0xA5, 0xBF, 0x4D, 0x3C, 0xB9, 0xFB, 0x08, 0x1E,
-    0x20, 0xE2, 0x5F, 0xAB, 0x7A, 0xA4, 0x4A, 0x78, 0x70, 0xE3, 0x99, 0x98, 0x07, 0x76, 0x5F, 0x9C,
-    0xA3, 0x15, 0x3A, 0x1E, 0x3B, 0x95, 0xDE, 0x1B, 0x87, 0xCA, 0xDF, 0x8F, 0x9E, 0x87, 0x08, 0x66,
-    0x96, 0x94, 0x3D, 0x76, 0xEA, 0xC4, 0x1D, 0xA9, 0xDF, 0xC5, 0x86, 0x5E, 0xC2, 0x70, 0xBA, 0x14,
-    0x33, 0x12, 0x95, 0x53, 0x49, 0xB7, 0x62, 0x0E, 0x9E, 0x1F, 0xE1, 0x44, 0x72, 0xC1, 0x52, 0xF7,
-    0x02, 0x3D, 0xA0, 0x65, 0xA9, 0x62, 0x75, 0x08, 0x1F, 0x59, 0x86, 0x0B, 0xBF, 0x22, 0xA2, 0x7C,
-    0x27, 0x00, 0xD0, 0x43, 0x04, 0xC0, 0x02, 0xCC, 0x3E, 0x1D, 0xE4, 0xFB, 0xDB, 0xF7, 0x16, 0x3D,
-    0xA1, 0x7B, 0xE8, 0x09, 0xCD, 0xA3, 0x5E, 0xBB, 0xF4, 0xD0, 0xA0, 0xB7, 0x7D, 0xBA, 0xFB, 0xB0,
-    0x38, 0xDD, 0x1D, 0x2D, 0x78, 0xEC, 0xBE, 0xDB, 0x9C, 0xEE, 0x9E, 0xCC, 0xA7, 0xBB, 0x1F, 0xD8,
-    0x13, 0x4A, 0x61, 0x17, 0x6C, 0x88, 0xBD, 0x89, 0xBC, 0x7A, 0x3B, 0x8B, 0x3E, 0xF5, 0x89, 0xEE,
-    0xB4, 0xE8, 0x87, 0x63, 0x9F, 0x68, 0xC9, 0xEF, 0x0E, 0xBD, 0x6F, 0xA8, 0x86, 0x62, 0x9F, 0x68,
-    0x79, 0x70, 0x9F, 0xE8, 0xEF, 0x70, 0x8B, 0xAB, 0x31, 0xAF, 0x08, 0x0E, 0x10, 0x58, 0x58, 0x6A,
-    0x9A, 0x72, 0x1F, 0x0E, 0xB8, 0xBB, 0x6B, 0x8A, 0xC5, 0x72, 0x65, 0x3F, 0x64, 0x5F, 0xBA, 0x58,
-    0xB1, 0xF2, 0xE0, 0x2D, 0xFA, 0x35, 0xD7, 0x79, 0x7B, 0x27, 0xE5, 0xEE, 0x1E, 0x61, 0x0C, 0x31,
-    0x80, 0x3C, 0xC0, 0xF9, 0x79, 0x2A, 0xCC, 0x37, 0x76, 0xE7, 0x0E, 0x9C, 0x7C, 0xB6, 0xDA, 0xDD,
-    0xD5, 0x33, 0x0B, 0xCD, 0x54, 0x84, 0xB7, 0x3A, 0x75, 0xEA, 0x9E, 0xFA, 0xC8, 0x25, 0xF3, 0xFD,
-    0xDD, 0x7C, 0x51, 0xC9, 0x66, 0xE6, 0xE9, 0xA1, 0x28, 0x40, 0x0F, 0x0F, 0x77, 0x5A, 0x06, 0x78,
-    0xA7, 0x64, 0xD4, 0x11, 0xF1, 0xBB, 0x0A, 0xF5, 0x72, 0x6F, 0xA3, 0x88, 0x8F, 0x5D, 0xC8, 0xBF,
-    0xD8, 0x74, 0x21, 0xA3, 0xD3, 0x8D, 0x9F, 0xFF, 0xA1, 0x1F, 0x05, 0x82, 0x85, 0xCE, 0x91, 0x22,
-    0x82, 0xD4, 0x84, 0x96, 0x95, 0x06, 0x0F, 0x51, 0xEB, 0x61, 0x53, 0x68, 0xD2, 0xC5, 0xAC, 0xE1,
-    0x44, 0xB8, 0xC0, 0xEB, 0xE1, 0xC8, 0xAF, 0xDA, 0x6F, 0x6D, 0x2B, 0xED, 0x7B, 0x83, 0x66, 0x4F,
-    0x4D, 0x68, 0x9D, 0xA2, 0xBA, 0x4F, 0x4A, 0x7F, 0x1B, 0x84, 0x3B, 0x74, 0x02, 0xDB, 0xC6, 0x7A,
-    0x4A, 0x9C, 0x2A, 0x81, 0xC4, 0x10, 0xD4, 0xFC, 0xBA, 0x43, 0xAD, 0xCD, 0x2A, 0x3D, 0x7A, 0x6F,
-    0x91, 0x6F, 0x75, 0x12, 0x9F, 0x89, 0x14, 0xF2, 0xE0, 0xC9, 0xF8, 0x6D, 0x1E, 0x41, 0xF5, 0x18,
-    0xD6, 0xD7, 0xB3, 0x9A, 0xFA, 0xC4, 0xA1, 0x6D, 0x52, 0x2A, 0x2D, 0x5D, 0x0D, 0x5D, 0xA2, 0xF5,
-    0xF9, 0xA5, 0x86, 0x87, 0x30, 0x5B, 0x12, 0x54, 0x29, 0xAA, 0x24, 0x55, 0x9A, 0x2A, 0x51, 0x5D,
-    0xF7, 0x32, 0xC9, 0xEA, 0x22, 0x3E, 0x24, 0xAC, 0x52, 0x76, 0x2B, 0x88, 0x4A, 0x68, 0xF6, 0x90,
-    0x3A, 0x0D, 0x9C, 0x33, 0xE9, 0x3B, 0x11, 0xD8, 0xAF, 0x5E, 0x71, 0xBE, 0x0A, 0x07, 0xBF, 0xEC,
-    0x96, 0x4C, 0x79, 0xD7, 0x3E, 0xBE, 0x00, 0x6E, 0x22, 0xF8, 0x0E, 0xDF, 0x0B, 0xAE, 0xFB, 0x4D,
-    0xCF, 0xFA, 0xFC, 0x6A, 0x3E, 0xA1, 0x6B, 0xEF, 0xEC, 0x56, 0xDC, 0xD6, 0xDE, 0x2E, 0x70, 0xBB,
-    0x68, 0x4A, 0xBD, 0x5D, 0xF7, 0xC6, 0x01, 0x45, 0x46, 0xF1, 0x1E, 0x3E, 0x5B, 0x2B, 0xE7, 0xA6,
-    0x65, 0xAE, 0x75, 0xC5, 0x8C, 0x9B, 0x53, 0xBA, 0xF0, 0xB7, 0x4C, 0x89, 0x8A, 0x71, 0x25, 0xC5,
-    0xD4, 0xB2, 0xE2, 0x42, 0x5D, 0xDF, 0x45, 0x37, 0xB9, 0x67, 0xF7, 0xE0, 0x67, 0x08, 0x28, 0x5E,
-    0xA4, 0x5F, 0xEE, 0x10, 0xE3, 0x3E, 0xC8, 0x78, 0xB7, 0x0E, 0x16, 0xBD, 0xE3, 0x6D, 0x49, 0x57,
-    0x4F, 0x38, 0x97, 0x20, 0xD6, 0xF3, 0x0A, 0x26, 0x7E, 0xD9, 0x17, 0xE8, 0xFF, 0xB7, 0x54, 0x79,
-    0xD6, 0x6C, 0xEB, 0xBD, 0x5F, 0xA7, 0x7D, 0x49, 0x26, 0x11, 0xBA, 0x12, 0xC1, 0xC8, 0x6E, 0x7F,
-    0x46, 0xE9, 0xBF, 0xA6, 0x1F, 0x57, 0xF2, 0x78, 0xB9, 0xA8, 0x9B, 0xD3, 0x09, 0x5F, 0x79, 0x91,
-    0xD7, 0xDF, 0xB0, 0xC8, 0x8B, 0xE7, 0x60, 0x7C, 0x81, 0x22, 0xAF, 0xD5, 0x0E, 0xD3, 0xFC, 0xEE,
-    0x03, 0x61, 0x6A, 0x8D, 0x27, 0xCC, 0x51, 0x1A, 0x9C, 0xF1, 0xA7, 0x95, 0xF4, 0x35, 0x56, 0xF2,
-    0x99, 0x75, 0xEF, 0x0C, 0xB4, 0x44, 0xBA, 0x76, 0xA7, 0x12, 0x33, 0x10, 0x1C, 0xAA, 0x31, 0x11,
-    0x6A, 0xA3, 0xF1, 0x68, 0x6D, 0x8F, 0xEF, 0xBD, 0xE8, 0x0F, 0x70, 0x62, 0x3A, 0x5F, 0x38, 0xA4,
-    0xF1, 0xEC, 0xBE, 0xD2, 0x52, 0xEE, 0x43, 0x3E, 0xD9, 0x1F, 0x22, 0xAB, 0xF6, 0x16, 0x54, 0x4A,
-    0xB5, 0x5A, 0xEA, 0x96, 0x54, 0x3A, 0x65, 0x65, 0x7F, 0x5C, 0x68, 0xD5, 0x4E, 0xA3, 0xDC, 0xF9,
-    0xA4, 0x1D, 0x84, 0x21, 0xC2, 0x6B, 0xA4, 0x12, 0x26, 0xBF, 0xA1, 0x12, 0xCA, 0x8B, 0xC1, 0x0B,
-    0x21, 0x3F, 0xC1, 0x65, 0xEB, 0xB3, 0x6D, 0x0E, 0x5E, 0x75, 0xEF, 0x56, 0x7D, 0xDE, 0xEE, 0xF1,
-    0x63, 0x8B, 0xF5, 0x93, 0x16, 0x56, 0xE7, 0xED, 0xC5, 0xC5, 0xAA, 0x57, 0x38, 0xE2, 0x4C, 0x56,
-    0x8D, 0xD3, 0x39, 0x51, 0x47, 0x0D, 0xF5, 0xFC, 0xFF, 0x01, 0xD5, 0x9A, 0xBF, 0x8F, 0x1C, 0x67,
-    0x19, 0xC7, 0x9F, 0x99, 0xF1, 0xDE, 0x0A, 0xAF, 0xC4, 0x50, 0xDC, 0x09, 0xB0, 0x04, 0xD3, 0x21,
-    0x63, 0xAC, 0x4C, 0x43, 0x99, 0x78, 0x86, 0x48, 0x28, 0x45, 0x0A, 0xAE, 0xF0, 0x55, 0x14, 0x6E,
-    0xD2, 0x40, 0x73, 0xFF, 0x40, 0xE4, 0x59, 0x68, 0x10, 0x15, 0xEE, 0x28, 0x52, 0xC4, 0x85, 0x85,
-    0xCC, 0x15, 0x98, 0x12, 0xA4, 0xCB, 0xCD, 0x10, 0x57, 0x40, 0xC1, 0x26, 0x0D, 0x05, 0x45, 0x16,
-    0x63, 0x81, 0x64, 0x17, 0x1E, 0xD0, 0xA0, 0x6C, 0xEC, 0x9D, 0x7D, 0xF9, 0x7E, 0x9F, 0xE7, 0x9D,
-    0xD9, 0x3D, 0x07, 0x94, 0x20, 0xED, 0xED, 0xDE, 0x9D, 0xBD, 0xEF, 0xD8, 0xB7, 0xBB, 0xF3, 0xBC,
-    0xCF, 0xE7, 0x7D, 0x7E, 0xBD, 0xCF, 0x3B, 0x22, 0x91, 0xCB, 0x45, 0x46, 0x6E, 0x2C, 0x12, 0x73,
-    0x48, 0x5D, 0x25, 0x92, 0x3D, 0xC3, 0x50, 0x1E, 0x62, 0x70, 0x69, 0x25, 0x61, 0x8B, 0x21, 0x9A,
-    0x27, 0x13, 0x19, 0x35, 0x18, 0x92, 0x3A, 0x99, 0x4A, 0x36, 0xC1, 0x50, 0x3C, 0x79, 0x30, 0x15,
-    0xE7, 0x5C, 0x1D, 0x70, 0x88, 0x38, 0x0C, 0xE7, 0x12, 0xD7, 0xF1, 0x0C, 0x43, 0x52, 0x4B, 0xDC,
-    0x64, 0x53, 0x0C, 0x45, 0x25, 0xA3, 0x99, 0x2C, 0x7F, 0x22, 0xFE, 0x67, 0x34, 0xC7, 0x10, 0x73,
-    0x18, 0x36, 0x2B, 0xEF, 0x49, 0x56, 0x9F, 0x04, 0x6E, 0xBE, 0x18, 0x3A, 0xD7, 0xC6, 0x8B, 0xC3,
-    0x79, 0x32, 0x8B, 0xE7, 0x59, 0x3D, 0x9A, 0x65, 0x93, 0xD1, 0xAC, 0xA8, 0xE2, 0xA6, 0xAC, 0xE2,
-    0xBA, 0xAC, 0x12, 0xBC, 0xB2, 0x69, 0x59, 0x15, 0x93, 0xF2, 0xEF, 0xAE, 0x2A, 0x9C, 0xAB, 0x52,
-    0x57, 0x56, 0xA3, 0x36, 0x1B, 0x4B, 0x6E, 0xB7, 0x09, 0x71, 0xE7, 0xA8, 0xC5, 0xCD, 0x5B, 0x2F,
-    0x6F, 0xE5, 0x87, 0x6A, 0x8A, 0xAB, 0x31, 0xBC, 0xC3, 0x21, 0xE2, 0x00, 0x6D, 0x44, 0x0A, 0x7E,
-    0xF9, 0xED, 0x7E, 0x9A, 0x1B, 0x04, 0x13, 0x42, 0x42, 0xE8, 0x26, 0x12, 0xDC, 0xC2, 0x3C, 0xE2,
-    0x09, 0x64, 0x40, 0x22, 0xA6, 0x2E, 0xF7, 0xD6, 0x4A, 0x45, 0xAE, 0xD9, 0x65, 0xA1, 0x18, 0xDE,
-    0x6F, 0x54, 0xF2, 0x23, 0xE2, 0x18, 0x7D, 0x4C, 0x0A, 0x92, 0x8E, 0xB9, 0x22, 0xB2, 0x27, 0xBB,
-    0xAB, 0xEB, 0xE5, 0xF4, 0xEB, 0x8A, 0xC2, 0xC3, 0xF0, 0x38, 0x3C, 0x10, 0x8F, 0xC4, 0xA0, 0x88,
-    0x61, 0x11, 0x03, 0x23, 0x86, 0x46, 0x0C, 0x8E, 0x18, 0x1E, 0x31, 0x40, 0xA2, 0x88, 0x44, 0x02,
-    0xBB, 0x44, 0x76, 0x51, 0x50, 0x10, 0x33, 0xD3, 0x8B, 0xC2, 0xC2, 0xD7, 0xA6, 0x7A, 0x59, 0xB1,
-    0xA4, 0x23, 0x5B, 0xE4, 0xC0, 0xFD, 0x64, 0x2A, 0x43, 0xF7, 0x87, 0x5C, 0x92, 0xBF, 0xE0, 0x8E,
-    0x45, 0x88, 0x4F, 0xDD, 0x94, 0xFD, 0xA5, 0x31, 0x09, 0xB9, 0x09, 0xC1, 0x09, 0xC9, 0x09, 0xD1,
-    0x09, 0xD9, 0x09, 0xE1, 0x09, 0xE9, 0x09, 0xF1, 0x09, 0xF9, 0x09, 0x01, 0x0A, 0x09, 0x0A, 0x11,
-    0x0A, 0x19, 0x0A, 0x21, 0x8A, 0x52, 0x34, 0x8C, 0x97, 0x95, 0x17, 0xA7, 0x1F, 0xD6, 0x84, 0xF0,
-    0x0B, 0x37, 0xF5, 0xFC, 0x94, 0xDE, 0x92, 0xDD, 0x86, 0x0C, 0xE8, 0x0A, 0x05, 0xE0, 0x86, 0xD1,
-    0x07, 0x90, 0xF2, 0x73, 0x08, 0x21, 0x09, 0x82, 0xE8, 0x38, 0xAC, 0xCB, 0x78, 0xF4, 0x6A, 0xDE,
-    0x1A, 0xAA, 0x99, 0xC8, 0x6F, 0xB8, 0x86, 0x0F, 0xA7, 0x54, 0xF5, 0x11, 0xDE, 0x8D, 0xD5, 0x88,
-    0xD2, 0x1F, 0x71, 0x89, 0x76, 0x21, 0xFE, 0xB4, 0x01, 0x99, 0xFD, 0x98, 0xF9, 0x98, 0xF5, 0x98,
-    0xF1, 0x98, 0xED, 0xA8, 0xE9, 0x98, 0xE5, 0x98, 0xE1, 0x98, 0xDD, 0x98, 0xD9, 0x98, 0xD5, 0x98,
-    0xD1, 0xA8, 0x95, 0x98, 0xC9, 0x98, 0xC5, 0x98, 0xC1, 0x98, 0xBD, 0x98, 0xB9, 0x98, 0xB5, 0xF4,
-    0xC6, 0x32, 0xA0, 0x74, 0x1A, 0x93, 0x0C, 0x38, 0x04, 0x35, 0x8C, 0xFE, 0x67, 0x63, 0x5A, 0x8D,
-    0x74, 0x56, 0x53, 0x9F, 0xB9, 0xD5, 0xC0, 0x95, 0x2F, 0x13, 0x9F, 0xFB, 0x15, 0x27, 0xF3, 0x80,
-    0xFC, 0xBE, 0x18, 0xD2, 0x88, 0xE4, 0x87, 0x63, 0x75, 0x43, 0xF5, 0x95, 0x17, 0x0A, 0xF0, 0xC7,
-    0xE7, 0x0A, 0x60, 0x78, 0xF7, 0x6B, 0x10, 0x7A, 0x2C, 0x49, 0x39, 0x93, 0xAB, 0x3B, 0x77, 0x24,
-    0x38, 0xCA, 0xA1, 0x06, 0xCC, 0xEC, 0xD9, 0x44, 0x0A, 0x04, 0xCF, 0xF5, 0x9A, 0xD9, 0x5E, 0xEE,
-    0x83, 0x73, 0xE4, 0x60, 0x69, 0xF1, 0x23, 0x80, 0x2A, 0xC6, 0x0B, 0xE2, 0xD8, 0xDB, 0x42, 0x5C,
-    0xFE, 0xAC, 0x84, 0x75, 0x90, 0x63, 0x3A, 0x15, 0x26, 0x02, 0x01, 0x7F, 0x6E, 0x64, 0x11, 0xCC,
-    0x81, 0xE3, 0xE6, 0x06, 0x12, 0x59, 0x70, 0x97, 0x13, 0xC1, 0x6A, 0x0E, 0xE2, 0xEF, 0x62, 0x5A,
-    0x57, 0x6F, 0x60, 0x18, 0x1F, 0x93, 0x4B, 0xD3, 0x19, 0xD3, 0xDE, 0xC6, 0x13, 0x19, 0x8C, 0x83,
-    0x91, 0x68, 0xF7, 0xC6, 0xAE, 0xBC, 0xF6, 0xD6, 0xB1, 0xA4, 0xAF, 0x37, 0x4A, 0x66, 0x48, 0xA9,
-    0xFB, 0xA7, 0x12, 0x59, 0xF4, 0x7F, 0x50, 0xC9, 0x3E, 0x4D, 0x45, 0xB3, 0xE2, 0x31, 0x1D, 0xFA,
-    0xB5, 0x01, 0x44, 0x5E, 0x3E, 0xA5, 0x7D, 0xB4, 0x1D, 0xED, 0x43, 0xAC, 0x48, 0x00, 0xF1, 0xBB,
-    0x6F, 0x43, 0xFB, 0xAF, 0x9C, 0xA5, 0xF6, 0x7B, 0x96, 0xA9, 0xA9, 0x1B, 0x34, 0x18, 0x24, 0x34,
-    0x80, 0xEB, 0xE7, 0x01, 0x81, 0x5C, 0x65, 0x6A, 0xA7, 0x9B, 0x88, 0x19, 0xC1, 0xB7, 0xCF, 0x12,
-    0xC3, 0xFD, 0xCB, 0xAA, 0xDA, 0x03, 0xFA, 0xE6, 0xBB, 0xAC, 0x95, 0x76, 0x82, 0x3B, 0x4C, 0xCF,
-    0x72, 0x85, 0x33, 0xC8, 0x6F, 0x6B, 0xAC, 0x9C, 0xEB, 0x67, 0x6A, 0x59, 0xC5, 0xB1, 0xED, 0x78,
-    0xFA, 0xF8, 0xEB, 0x10, 0xFA, 0x9E, 0x24, 0x87, 0x33, 0xB9, 0x14, 0xE4, 0xF2, 0x2A, 0xFE, 0x64,
-    0xDF, 0x41, 0x8E, 0xC1, 0xCA, 0x0D, 0xB9, 0x70, 0xBB, 0x6B, 0xAC, 0xF9, 0x06, 0x54, 0x3B, 0xC9,
-    0x61, 0x1D, 0xC9, 0x93, 0x39, 0x95, 0x9D, 0x75, 0xD6, 0xB1, 0x2B, 0xE7, 0x2F, 0x9E, 0xB2, 0x76,
-    0xCA, 0xE0, 0xD8, 0xD9, 0x53, 0xE2, 0xA8, 0x35, 0xCD, 0xAC, 0x15, 0xC7, 0xFF, 0x88, 0xA7, 0xB0,
-    0xAE, 0xB1, 0x0D, 0xF8, 0x4A, 0x2E, 0xA5, 0x73, 0xDD, 0x2E, 0x41, 0xB3, 0x11, 0xE3, 0xAD, 0xD3,
-    0x24, 0x7D, 0x74, 0x8F, 0x6B, 0xDC, 0x70, 0xA8, 0x6D, 0x18, 0x52, 0x03, 0xD5, 0x2E, 0xD6, 0xA1,
-    0xD1, 0x5A, 0x97, 0xC3, 0xF3, 0xA3, 0x31, 0x60, 0x42, 0x83, 0xE5, 0xDD, 0x57, 0xF7, 0x39, 0x7A,
-    0xE7, 0xAA, 0x1B, 0xCA, 0x53, 0x3B, 0x94, 0x04, 0x72, 0x9D, 0x9B, 0x52, 0x40, 0xDC, 0xC6, 0x4D,
-    0x52, 0x8F, 0x00, 0x12, 0x30, 0x3F, 0x28, 0x6B, 0xEA, 0x54, 0xBA, 0x85, 0x94, 0x4F, 0x72, 0xDD,
-    0x24, 0xA0, 0xCA, 0x90, 0x62, 0x3A, 0xE2, 0xFD, 0xB1, 0x7E, 0x0E, 0x73, 0xFC, 0x84, 0xAB, 0x6E,
-    0x49, 0x82, 0x3A, 0x2E, 0xEC, 0xE5, 0x2B, 0xB6, 0x5E, 0xBC, 0x16, 0xE3, 0xFC, 0xDD, 0x37, 0xF4,
-    0x0D, 0x5D, 0x07, 0x2A, 0x60, 0xC5, 0xBA, 0x6C, 0x03, 0x0C, 0x0D, 0x91, 0xD9, 0x34, 0xE0, 0x1C,
-    0x58, 0xD1, 0x52, 0x3F, 0xDE, 0xE5, 0xEE, 0x5A, 0xA9, 0x70, 0xFF, 0x83, 0xCA, 0x2B, 0x72, 0x4F,
-    0x61, 0xCF, 0x9C, 0x46, 0xFC, 0xBA, 0xE3, 0x9B, 0x5F, 0xDA, 0x86, 0xCE, 0xC9, 0xF4, 0x86, 0x64,
-    0x8B, 0x39, 0xA4, 0xCC, 0xA5, 0x49, 0x6B, 0xD9, 0x0F, 0xD6, 0xAA, 0xEB, 0xE5, 0x3B, 0x5D, 0xAE,
-    0x48, 0x9B, 0x13, 0x9A, 0xD9, 0xFC, 0x1E, 0x83, 0x5A, 0xAB, 0x3B, 0x98, 0x4C, 0x6B, 0xE3, 0x25,
-    0x15, 0x9B, 0x95, 0x8D, 0xAA, 0xBA, 0xE9, 0x6E, 0xCA, 0x9B, 0xF6, 0xAA, 0xBE, 0xE9, 0x6F, 0x00,
-    0x8C, 0x80, 0x69, 0xEF, 0x47, 0x85, 0xE0, 0x1D, 0x3E, 0xB6, 0x51, 0x1D, 0x5C, 0x41, 0x18, 0x09,
-    0x43, 0x71, 0x4A, 0x20, 0x7F, 0x7E, 0x69, 0xB1, 0x21, 0x72, 0x6F, 0x72, 0x65, 0x50, 0x9D, 0xA7,
-    0x7F, 0x82, 0x25, 0x9C, 0x70, 0x83, 0xBE, 0xDF, 0x57, 0xE7, 0x24, 0x43, 0x34, 0x26, 0x8D, 0x70,
-    0x84, 0x74, 0x84, 0x78, 0x84, 0x7C, 0xAC, 0xFE, 0x26, 0x21, 0x45, 0xA4, 0x8C, 0x14, 0x92, 0x52,
-    0x52, 0x4C, 0xCA, 0xC9, 0x40, 0x29, 0xA9, 0x90, 0x05, 0x45, 0xA0, 0x73, 0x3D, 0x4E, 0x31, 0xD9,
-    0xAF, 0x96, 0x73, 0x8F, 0x49, 0x29, 0x2D, 0x21, 0x6D, 0xCA, 0x36, 0xAE, 0xE1, 0x76, 0x09, 0xA6,
-    0x3C, 0x7C, 0xE8, 0xF2, 0xE0, 0x1D, 0x6E, 0x27, 0x40, 0x82, 0x20, 0x3A, 0x0E, 0x6B, 0xB2, 0x0F,
-    0xB5, 0x79, 0x5A, 0x83, 0x3C, 0x10, 0xF3, 0xFB, 0xB4, 0xC1, 0xEC, 0xCA, 0xD9, 0x9D, 0xAD, 0xAA,
-    0xEF, 0x97, 0x45, 0x62, 0x46, 0xA9, 0x1D, 0x7E, 0x4A, 0x1D, 0x36, 0x1E, 0x43, 0x81, 0x9F, 0xD2,
-    0x2C, 0xAA, 0x8D, 0x98, 0x05, 0x0C, 0x21, 0xC4, 0xA7, 0xDC, 0x53, 0xA4, 0xC0, 0x17, 0x0C, 0x4E,
-    0xD5, 0x6F, 0xF1, 0xBB, 0x2B, 0x0C, 0x47, 0x05, 0x94, 0x08, 0xE0, 0xB7, 0x20, 0x74, 0x7B, 0x2B,
-    0x84, 0xC2, 0x3B, 0xD7, 0x25, 0xC1, 0x04, 0x6E, 0x40, 0xB3, 0xAB, 0x3B, 0x63, 0x09, 0x8F, 0x98,
-    0xC4, 0x73, 0x49, 0x3F, 0xAA, 0xE4, 0x64, 0xB8, 0x66, 0x43, 0x19, 0xEC, 0x77, 0xD9, 0xC2, 0x31,
-    0xA5, 0xCC, 0x4B, 0x2E, 0x0D, 0x72, 0xEA, 0xC0, 0xF6, 0xD6, 0xE7, 0x2D, 0x83, 0x1E, 0x88, 0xDF,
-    0x95, 0x4D, 0x24, 0xFB, 0x63, 0x8D, 0x68, 0x3F, 0x03, 0x8C, 0x9B, 0x1B, 0xC9, 0xAC, 0x61, 0x97,
-    0xC3, 0x0E, 0x27, 0xD6, 0xC8, 0x2B, 0x7C, 0x23, 0xCF, 0xD7, 0x38, 0x05, 0x2C, 0xB4, 0x74, 0x2C,
-    0x9A, 0xB0, 0x81, 0x6E, 0x4D, 0x5B, 0xDF, 0xE7, 0x12, 0x84, 0x7F, 0xCD, 0xCB, 0x19, 0xBE, 0x96,
-    0x55, 0xDA, 0xED, 0xD2, 0x89, 0x50, 0x6D, 0xDC, 0x96, 0x00, 0xF9, 0x1A, 0x3A, 0xE2, 0xB6, 0xDB,
-    0x94, 0x5A, 0xCA, 0xE1, 0x63, 0xF8, 0x67, 0x23, 0x5F, 0x46, 0xEC, 0xA4, 0xD9, 0x13, 0xCD, 0x37,
-    0xAD, 0xD5, 0xC9, 0x6F, 0x84, 0x8E, 0xF3, 0x44, 0xD1, 0x03, 0xD2, 0xF8, 0x0B, 0xD4, 0x90, 0xAA,
-    0xFE, 0x41, 0x91, 0x29, 0x6B, 0x39, 0xCA, 0xA3, 0xB8, 0x33, 0x9A, 0x9E, 0x26, 0x84, 0xDA, 0x6E,
-    0x97, 0x34, 0xDE, 0xAF, 0x97, 0xBF, 0x4F, 0x74, 0x2E, 0xFD, 0x2F, 0x6D, 0x2E, 0xC0, 0x8F, 0x3B,
-    0x23, 0xFC, 0x99, 0x0E, 0xAA, 0x80, 0xE9, 0x30, 0xEA, 0x75, 0xA8, 0x7D, 0x52, 0xB1, 0x1C, 0x67,
-    0x5F, 0xCA, 0xF2, 0xE5, 0xBD, 0x83, 0xB2, 0x55, 0xA7, 0x56, 0x0B, 0xAA, 0xC5, 0x3D, 0x2F, 0x9B,
-    0xC8, 0x8D, 0x93, 0xF9, 0x70, 0x81, 0x9B, 0xA0, 0xF6, 0x1C, 0xB6, 0x10, 0x1D, 0xB5, 0xD0, 0x2C,
-    0x6A, 0xA1, 0x1A, 0x86, 0x09, 0x04, 0x60, 0x18, 0xCD, 0x8B, 0x09, 0x8A, 0x53, 0x0E, 0xA8, 0x30,
-    0xA1, 0x3A, 0xDE, 0x2D, 0xA6, 0x59, 0x13, 0xB8, 0x2A, 0x59, 0x7C, 0xDF, 0xE5, 0xB8, 0xE7, 0xC2,
-    0xA7, 0xBE, 0x42, 0xAD, 0xB2, 0x0B, 0x43, 0xA6, 0x05, 0x51, 0xA1, 0x60, 0xED, 0xCA, 0xA9, 0xFE,
-    0x27, 0x5D, 0x70, 0xA3, 0x50, 0x0D, 0xD5, 0xFA, 0x0E, 0x9B, 0xB4, 0xC1, 0xDD, 0xA7, 0x90, 0x55,
-    0xE9, 0x6B, 0x56, 0x8E, 0x63, 0xBE, 0x9A, 0x72, 0x6C, 0x75, 0x6C, 0xF1, 0x57, 0xDD, 0xF8, 0x8C,
-    0x63, 0x08, 0x0B, 0xDD, 0x63, 0x91, 0x4B, 0x2B, 0xD6, 0xE7, 0xFE, 0x6B, 0x5D, 0x37, 0xD4, 0xD4,
-    0x4E, 0xA7, 0x1B, 0xD0, 0xF2, 0x94, 0x46, 0x50, 0x76, 0x35, 0x77, 0x34, 0xD9, 0x1A, 0x98, 0x65,
-    0x71, 0x57, 0xF9, 0xE2, 0x2E, 0xB7, 0x8C, 0x7B, 0x77, 0xAD, 0x68, 0x34, 0x93, 0xAB, 0xAD, 0x0D,
-    0x17, 0xC9, 0x98, 0xFE, 0x4E, 0x47, 0x28, 0x0E, 0xF1, 0xCF, 0x60, 0x4E, 0xB1, 0xC1, 0x7E, 0x90,
-    0x9F, 0x32, 0x0F, 0xC3, 0x60, 0x1C, 0x14, 0x84, 0x28, 0x09, 0x51, 0x14, 0xA2, 0x2C, 0x44, 0x61,
-    0x88, 0xD2, 0x10, 0xC5, 0x21, 0xCA, 0x43, 0x14, 0x88, 0x28, 0x11, 0x1D, 0xD9, 0x1E, 0xE4, 0xC7,
-    0x14, 0x8A, 0x28, 0x15, 0x51, 0x2C, 0xA2, 0x5C, 0x3C, 0x18, 0x4F, 0xA6, 0x47, 0xF3, 0xB9, 0xCA,
-    0x1E, 0xF0, 0x51, 0x40, 0x6C, 0x4A, 0x32, 0xBF, 0x1D, 0x36, 0x42, 0x46, 0x42, 0x48, 0x42, 0x4A,
-    0x1C, 0x66, 0x42, 0x4E, 0x1C, 0x1A, 0x21, 0x29, 0xEB, 0x4C, 0x92, 0x95, 0x45, 0x4F, 0xD2, 0x32,
-    0x5C, 0xC6, 0xEB, 0x07, 0xEA, 0x6E, 0x1A, 0x17, 0xDF, 0xC0, 0x3B, 0x3B, 0xB7, 0x9C, 0x87, 0xA5,
-    0xAC, 0x96, 0xA8, 0x36, 0x6A, 0x2E, 0x9F, 0x59, 0xFB, 0xAC, 0xC9, 0x54, 0xEC, 0x92, 0xE9, 0x52,
-    0x7C, 0x4B, 0x8F, 0x2F, 0xD8, 0x4E, 0xC1, 0x5E, 0x91, 0xF2, 0x9D, 0xB6, 0x32, 0x0E, 0xF3, 0xF3,
-    0x6B, 0x36, 0xD6, 0xD5, 0x3E, 0x5D, 0x20, 0x7D, 0x6F, 0x0C, 0x03, 0xFA, 0xFD, 0x06, 0x0D, 0x48,
-    0x76, 0xF2, 0xB7, 0x00, 0xE1, 0x39, 0x24, 0xDD, 0xE6, 0x31, 0xC8, 0xAF, 0xAF, 0x60, 0x56, 0xE1,
-    0x7D, 0xCE, 0x8C, 0x67, 0x4C, 0x19, 0x9D, 0xBC, 0xDD, 0x9E, 0x29, 0x49, 0x78, 0xF7, 0x3A, 0x66,
-    0x72, 0x2C, 0xAF, 0x60, 0x7D, 0x58, 0x25, 0x05, 0x47, 0xD6, 0xEA, 0x78, 0xB9, 0x4A, 0x5A, 0x8B,
-    0x49, 0x05, 0x07, 0x6A, 0x16, 0x5A, 0x0D, 0x31, 0x27, 0x22, 0xF6, 0x47, 0x33, 0x84, 0x22, 0x28,
-    0xBF, 0x7F, 0x0E, 0xF3, 0xD1, 0xCB, 0x55, 0x52, 0xB4, 0xAC, 0x92, 0xCE, 0x36, 0x4F, 0xED, 0x99,
-    0x29, 0x68, 0xED, 0xED, 0xF7, 0x92, 0xA8, 0x29, 0x97, 0xB3, 0x95, 0xBE, 0xAA, 0xB4, 0xC2, 0xA2,
-    0x6C, 0xF9, 0x21, 0x6C, 0xD5, 0xDF, 0x5F, 0xA8, 0xC3, 0xBD, 0x98, 0xAB, 0xC7, 0x69, 0xFD, 0x38,
-    0x66, 0xCF, 0x0A, 0xF8, 0x98, 0xF7, 0x00, 0x90, 0x9D, 0x1D, 0xF3, 0x3A, 0xEF, 0x76, 0xDE, 0xEF,
-    0xBC, 0xE3, 0xF5, 0x97, 0x4A, 0xDB, 0x4F, 0xB8, 0xE8, 0xE1, 0xE2, 0xA4, 0xAB, 0x6D, 0x0A, 0x96,
-    0x37, 0x35, 0xDD, 0x0F, 0xFE, 0x77, 0x8B, 0x59, 0xD4, 0x1C, 0xB0, 0xF3, 0xC0, 0xCE, 0x05, 0xBB,
-    0x66, 0xD2, 0x40, 0x71, 0x25, 0xFA, 0x56, 0x36, 0xE9, 0x77, 0xC9, 0xD0, 0xF5, 0x80, 0x21, 0x63,
-    0xB9, 0x5B, 0x4E, 0x17, 0x98, 0x04, 0x90, 0x7E, 0x34, 0xA3, 0xFB, 0xC1, 0x53, 0x80, 0x95, 0xC5,
-    0x3A, 0x1D, 0xD0, 0x3C, 0xD0, 0x5C, 0xD0, 0x7C, 0xD0, 0x9C, 0xD0, 0xBC, 0xD0, 0xDC, 0xD0, 0xFC,
-    0xD0, 0x1C, 0xD1, 0x17, 0xC2, 0xEA, 0x8A, 0xDE, 0x17, 0x3B, 0xE0, 0x9E, 0x6C, 0x56, 0xD9, 0x2A,
-    0x4E, 0xFB, 0xC2, 0x8B, 0x2A, 0xF8, 0x0A, 0x74, 0xFF, 0x42, 0xA0, 0xD5, 0x1D, 0x87, 0x1D, 0xDA,
-    0xF9, 0x56, 0x82, 0x37, 0xA0, 0x96, 0x68, 0x65, 0x77, 0xE3, 0x68, 0x57, 0xEB, 0x2B, 0x5F, 0x61,
-    0x75, 0x35, 0x96, 0xDF, 0x8A, 0x58, 0x9D, 0xD5, 0x77, 0x15, 0xFB, 0x5A, 0xEB, 0x9C, 0xDB, 0xF0,
-    0x4A, 0x43, 0x3C, 0xD2, 0x8D, 0x94, 0x56, 0x68, 0x56, 0xA3, 0x69, 0x95, 0xA6, 0x9D, 0x91, 0x03,
-    0xAD, 0xD4, 0xB6, 0x04, 0xBD, 0xC8, 0x1B, 0x95, 0xAB, 0xA7, 0xA3, 0x11, 0xC5, 0x61, 0x21, 0x7E,
-    0xA7, 0x6A, 0x04, 0xF9, 0xA5, 0x0B, 0x84, 0x39, 0x9E, 0xBE, 0x42, 0x6B, 0x59, 0xD0, 0x88, 0x4A,
-    0x3D, 0x9B, 0x68, 0xD2, 0x1A, 0x68, 0xF7, 0x83, 0x6D, 0xA1, 0xBD, 0x18, 0xDC, 0xBA, 0xBC, 0x90,
-    0xD6, 0xAB, 0x97, 0xD3, 0x7B, 0x2B, 0xCB, 0x68, 0xAB, 0x2D, 0xCA, 0x4D, 0x92, 0x2C, 0x4D, 0x68,
-    0xBE, 0xCC, 0x68, 0x8B, 0x53, 0x88, 0x23, 0x02, 0x1E, 0xCE, 0x43, 0x1D, 0x90, 0xED, 0x67, 0x98,
-    0x5A, 0xAC, 0x43, 0x03, 0x5A, 0x49, 0x8D, 0x69, 0xA4, 0xB5, 0x56, 0x63, 0x6C, 0x57, 0x4D, 0x10,
-    0xF8, 0x32, 0x3E, 0x59, 0x50, 0x54, 0xA9, 0xAF, 0xC1, 0xDC, 0x18, 0x0C, 0x5D, 0x9E, 0x4D, 0x70,
-    0x8B, 0xAC, 0xC6, 0x72, 0xA4, 0x7C, 0x2E, 0x21, 0x76, 0x7A, 0x68, 0x44, 0x8F, 0x28, 0x17, 0xEA,
-    0x0E, 0x7D, 0x77, 0xA4, 0x6F, 0x6F, 0xA9, 0x53, 0x17, 0xDD, 0x1B, 0x90, 0xE6, 0x20, 0x1E, 0xB3,
-    0x89, 0x67, 0x98, 0x48, 0xDC, 0x70, 0x0E, 0x75, 0xC4, 0x39, 0xE0, 0xAD, 0x94, 0x54, 0x20, 0x1E,
-    0x13, 0xE1, 0x23, 0x0E, 0x7E, 0x0E, 0x19, 0x07, 0x2C, 0x5C, 0xF1, 0x21, 0x6B, 0x05, 0xF7, 0x8C,
-    0xC3, 0x2D, 0x2C, 0x6C, 0xCB, 0x48, 0xD1, 0x4B, 0xD4, 0x00, 0x4D, 0x43, 0xB0, 0x20, 0x19, 0xCD,
-    0x5F, 0x5A, 0x1D, 0xEB, 0xEE, 0x10, 0xCE, 0x17, 0xCA, 0x6E, 0xDF, 0x11, 0xB4, 0xDD, 0xF9, 0xCF,
-    0xB0, 0xDA, 0x1E, 0xAB, 0x80, 0x4B, 0x1B, 0x68, 0x58, 0x79, 0xB3, 0xEE, 0x1E, 0xEE, 0x61, 0x7B,
-    0x43, 0xDE, 0xD3, 0x83, 0xC6, 0x33, 0x46, 0x77, 0xE0, 0x43, 0xB0, 0x65, 0x96, 0x53, 0x85, 0x90,
-    0xED, 0x4E, 0x56, 0x8E, 0x2E, 0xCB, 0x0A, 0xF2, 0xE2, 0xC6, 0xE5, 0x3C, 0x67, 0xFB, 0x27, 0x09,
-    0x49, 0xF2, 0x71, 0xCB, 0x14, 0x99, 0x3A, 0x6D, 0xEA, 0xB0, 0xF4, 0x24, 0x91, 0xC7, 0xDA, 0xB4,
-    0xA1, 0x12, 0xA9, 0x5D, 0xF8, 0x88, 0xCA, 0x58, 0x3D, 0x91, 0x56, 0x0A, 0xBF, 0xD4, 0xBD, 0x5E,
-    0xA5, 0xD6, 0x5A, 0x56, 0xA1, 0x35, 0xFA, 0x59, 0xA9, 0xE9, 0x0A, 0xE8, 0x45, 0x3B, 0x73, 0x4E,
-    0xDD, 0x42, 0xCA, 0x7F, 0x97, 0xB5, 0xF5, 0xF9, 0xF4, 0x80, 0x48, 0x8F, 0x07, 0x40, 0x73, 0x26,
-    0xAB, 0x9E, 0x10, 0xDC, 0x5C, 0x36, 0xFD, 0xF5, 0x84, 0xC9, 0xBA, 0xAC, 0x58, 0x65, 0x56, 0xC0,
-    0xFB, 0xFD, 0x71, 0x00, 0x49, 0xA6, 0x35, 0x51, 0x96, 0x15, 0x58, 0xB2, 0xC1, 0x86, 0x42, 0x98,
-    0x87, 0x86, 0x1A, 0x5D, 0x88, 0xD3, 0x78, 0x1A, 0x50, 0x23, 0x6A, 0x48, 0x8D, 0xA9, 0x41, 0x35,
-    0xAA, 0x86, 0x15, 0xE3, 0xBB, 0xEC, 0x2C, 0x28, 0xD8, 0xD3, 0x64, 0xBD, 0x43, 0x5A, 0x2E, 0xEB,
-    0xAB, 0x23, 0xCB, 0x6F, 0x2B, 0x56, 0x70, 0xAE, 0xD1, 0x5A, 0x3D, 0x64, 0x95, 0x90, 0x79, 0x56,
-    0x60, 0x95, 0x48, 0xA1, 0x68, 0x07, 0x1B, 0x47, 0xBB, 0x7A, 0x8E, 0xE8, 0x7B, 0xC3, 0xDD, 0x59,
-    0xA2, 0x1D, 0xDA, 0xF9, 0xF3, 0xC4, 0x3E, 0x4C, 0x27, 0x17, 0xC4, 0x86, 0x97, 0x11, 0xC1, 0x87,
-    0x04, 0x8B, 0x09, 0x16, 0x14, 0x2C, 0x2A, 0x20, 0x2C, 0x10, 0xFA, 0xFD, 0x2D, 0x41, 0x0F, 0x5B,
-    0x0D, 0x96, 0x23, 0xA7, 0x4F, 0x2B, 0xC4, 0xA6, 0x46, 0x6A, 0x95, 0xE9, 0xA5, 0xFE, 0x18, 0xF3,
-    0x22, 0x60, 0x1E, 0x4D, 0x53, 0xAD, 0x87, 0x4E, 0x34, 0xEF, 0xF3, 0x16, 0xB3, 0xB4, 0x01, 0xDA,
-    0xFD, 0x20, 0xDF, 0x92, 0x3D, 0x5F, 0x0C, 0x6E, 0xFE, 0xB0, 0xC3, 0xEA, 0x8D, 0x3E, 0xBE, 0x2D,
-    0x5E, 0xD6, 0xC4, 0xDA, 0x0E, 0x5B, 0x21, 0xB9, 0xB0, 0xC3, 0x90, 0xE5, 0xE8, 0xC3, 0xD5, 0x4A,
-    0x34, 0xD3, 0xD6, 0xFD, 0xA8, 0xE9, 0x03, 0x9A, 0x7E, 0x60, 0x77, 0x79, 0x06, 0xC0, 0x2C, 0x8E,
-    0xEF, 0xA6, 0x53, 0x10, 0x4B, 0xEA, 0x78, 0xDE, 0x3F, 0x52, 0xC2, 0xC7, 0x50, 0x50, 0xD9, 0x0C,
-    0x3F, 0x61, 0x6B, 0x41, 0x0F, 0xA4, 0xC8, 0x28, 0xB4, 0x47, 0x89, 0x27, 0xFD, 0x03, 0xDE, 0xCB,
-    0x33, 0x27, 0x0E, 0x8B, 0xAE, 0x38, 0x51, 0x61, 0xCB, 0x33, 0x27, 0xBF, 0x69, 0xD6, 0xA4, 0xA0,
-    0x1B, 0x66, 0xDD, 0x73, 0xDA, 0x66, 0xB9, 0xDB, 0x2A, 0x17, 0x63, 0x7C, 0x53, 0x4B, 0x45, 0x9F,
-    0xDA, 0xD9, 0xAB, 0xAB, 0xF4, 0xD4, 0x04, 0xF3, 0x48, 0x27, 0x10, 0x90, 0x7C, 0x08, 0x01, 0xC9,
-    0xDF, 0xF8, 0x88, 0xCD, 0x3F, 0x70, 0xDB, 0xF8, 0x19, 0x4F, 0x3B, 0xF4, 0xC1, 0x60, 0x96, 0x5F,
-    0xFA, 0x74, 0x0D, 0x0F, 0x46, 0xAC, 0x34, 0x52, 0xE9, 0x7A, 0xCE, 0x45, 0xAA, 0xD7, 0xAC, 0xBC,
-    0xA4, 0xC5, 0xB4, 0xFD, 0x93, 0x19, 0x9B, 0x53, 0xFF, 0xD3, 0x8D, 0xA2, 0xF4, 0xA5, 0x46, 0xD1,
-    0x19, 0xAA, 0xFF, 0xAF, 0x39, 0xD4, 0x7F, 0xD8, 0x42, 0xFD, 0x37, 0x30, 0xB4, 0xD1, 0xAC, 0x4B,
-    0x28, 0x9F, 0xE3, 0x2C, 0x63, 0xBA, 0x79, 0x53, 0x31, 0x50, 0x6D, 0x57, 0xC7, 0x5E, 0x2A, 0xC4,
-    0x3F, 0xF0, 0x16, 0xB6, 0xFE, 0x71, 0x4C, 0xD9, 0x19, 0x6F, 0xCD, 0x68, 0x7C, 0x9F, 0x77, 0xF2,
-    0x2A, 0x0B, 0x5C, 0x6E, 0xE0, 0x10, 0xAE, 0x82, 0x9A, 0x2E, 0x9B, 0x07, 0x5B, 0x62, 0xC5, 0x9D,
-    0xBB, 0xEE, 0xDB, 0x23, 0x06, 0x35, 0xDD, 0xB3, 0x07, 0x7D, 0x28, 0xDB, 0x3C, 0xA1, 0xFF, 0x00,
-    0xB5, 0x58, 0x31, 0x8F, 0xDD, 0xC6, 0x11, 0x1E, 0x92, 0xF7, 0x8E, 0xF0, 0x11, 0x06, 0x55, 0xE8,
-    0x12, 0x49, 0x0E, 0xC2, 0x94, 0xC1, 0x41, 0x11, 0x5D, 0xA4, 0x10, 0x82, 0xE8, 0x96, 0xF6, 0x21,
-    0x30, 0x90, 0x34, 0x57, 0xE8, 0x6A, 0x37, 0x2E, 0x02, 0xA5, 0x90, 0xCB, 0x14, 0x4E, 0x48, 0x49,
-    0x3F, 0xC0, 0x57, 0xB9, 0x8D, 0x02, 0xA8, 0x38, 0x5F, 0x61, 0x35, 0x01, 0xA2, 0x18, 0x56, 0xC8,
-    0x93, 0xCA, 0x14, 0xA2, 0x2C, 0x04, 0x2E, 0x52, 0x64, 0x61, 0x25, 0x95, 0x0A, 0x6F, 0x14, 0x22,
-    0xA2, 0x62, 0x92, 0x9B, 0xEF, 0x5B, 0xF2, 0xBD, 0x7B, 0xE7, 0x9C, 0xAC, 0x33, 0x90, 0xBC, 0x7D,
-    0xC3, 0xB7, 0x24, 0x77, 0x67, 0x67, 0x66, 0x67, 0xBE, 0x99, 0x7D, 0x22, 0x5E, 0x21, 0xFA, 0xCA,
-    0x9D, 0x8F, 0xEF, 0xDC, 0xD4, 0xBF, 0x2D, 0x6E, 0xCA, 0xCB, 0x9B, 0x88, 0x9F, 0x45, 0x72, 0xE1,
-    0xC3, 0x0B, 0x1F, 0x45, 0x6B, 0xFE, 0x4F, 0x65, 0xED, 0xE5, 0x6D, 0x63, 0x3F, 0x53, 0xB6, 0x50,
-    0x36, 0xCB, 0xAD, 0x2C, 0xF7, 0x73, 0x6B, 0x9B, 0xD2, 0x5A, 0x63, 0x41, 0x3B, 0x3B, 0x3B, 0xDB,
-    0xE7, 0xF6, 0xF7, 0xF1, 0xC6, 0x56, 0x24, 0xBC, 0x2B, 0x70, 0x8F, 0xCF, 0x1E, 0x6E, 0xF1, 0xE9,
-    0xA6, 0x9F, 0xDC, 0xFD, 0xB4, 0x5F, 0xF7, 0x0E, 0x22, 0xE6, 0x72, 0xF7, 0x7F, 0xFE, 0xDD, 0x90,
-    0x9F, 0xCF, 0x20, 0x65, 0x6C, 0xAD, 0x5E, 0xDB, 0xDF, 0xDF, 0xC5, 0x2A, 0xB2, 0xBE, 0xB3, 0x93,
-    0x51, 0xDA, 0x8D, 0xFD, 0xFD, 0x4C, 0xEE, 0x7A, 0x5D, 0xD0, 0x46, 0x4D, 0x6C, 0x52, 0xAD, 0xAA,
-    0xF5, 0xCC, 0xEF, 0x83, 0x2E, 0x6A, 0x63, 0x93, 0xD4, 0x69, 0xA5, 0xB2, 0x75, 0xF1, 0x2E, 0x07,
-    0x7D, 0xD8, 0xC5, 0x4D, 0xAC, 0x71, 0x5F, 0x6C, 0x4A, 0xE9, 0x5A, 0x8E, 0xA6, 0xD0, 0x66, 0x22,
-    0x77, 0x43, 0xED, 0x75, 0x71, 0x1D, 0xB4, 0x69, 0x15, 0x19, 0x55, 0xC4, 0xC6, 0x4A, 0xFA, 0xD0,
-    0x8A, 0xBA, 0xDF, 0xCB, 0xFA, 0x1B, 0x97, 0xC5, 0xEF, 0x13, 0x1D, 0x74, 0xAA, 0x8E, 0x1A, 0x55,
-    0xC5, 0xA6, 0xCC, 0x92, 0x1A, 0xEF, 0x0F, 0x3A, 0x51, 0x41, 0x2B, 0xEB, 0xDE, 0x36, 0xF8, 0xCF,
-    0xB6, 0x83, 0x2E, 0xD5, 0x61, 0xCB, 0xF7, 0x79, 0x11, 0x6B, 0xBC, 0xAF, 0x06, 0x51, 0xD7, 0x3B,
-    0xD9, 0xF4, 0x1B, 0xB1, 0x91, 0xB1, 0x51, 0x53, 0x86, 0x4D, 0x8E, 0x6F, 0xD0, 0x28, 0x7C, 0xDF,
-    0x6C, 0x67, 0xB2, 0x4D, 0x3D, 0x24, 0x36, 0x20, 0x0D, 0xAA, 0x41, 0x15, 0xA8, 0x90, 0xB3, 0x6F,
-    0x7F, 0x50, 0xA4, 0x96, 0x7B, 0x65, 0xB3, 0x1F, 0x95, 0xBF, 0x10, 0xD9, 0xC4, 0xB8, 0x5F, 0x81,
-    0x3E, 0x01, 0x75, 0x23, 0x79, 0x20, 0x2C, 0x2F, 0x41, 0x23, 0x12, 0x82, 0x22, 0x33, 0xB1, 0x02,
-    0x25, 0x5A, 0xA6, 0x4F, 0x99, 0x81, 0xF0, 0x3B, 0x2C, 0x26, 0xFA, 0xD8, 0x2C, 0x52, 0xC0, 0xDD,
-    0x0A, 0x30, 0x98, 0xB4, 0x98, 0x5C, 0xCB, 0x2C, 0x3E, 0xC8, 0x12, 0xD8, 0x35, 0x75, 0xDE, 0x50,
-    0x16, 0x92, 0x62, 0x9A, 0x72, 0xFB, 0x2A, 0x62, 0x27, 0xC2, 0x92, 0xBD, 0x24, 0x16, 0x1B, 0x50,
-    0x2D, 0xBE, 0xA9, 0xAD, 0x62, 0x2B, 0x3E, 0x5D, 0x00, 0x9E, 0x47, 0x35, 0xA0, 0x55, 0xDC, 0x61,
-    0x98, 0xA4, 0x1C, 0x90, 0xA9, 0x46, 0xF2, 0x4C, 0x7E, 0x27, 0x02, 0x99, 0x56, 0x33, 0x55, 0xE7,
-    0xBA, 0xAC, 0xF3, 0x6A, 0x06, 0xFB, 0xCF, 0x32, 0x55, 0xA5, 0xB8, 0x53, 0xA6, 0xAC, 0x72, 0x9D,
-    0x17, 0xAA, 0x5A, 0x91, 0xD9, 0xD4, 0x54, 0xC5, 0x56, 0xD6, 0xAE, 0x55, 0x65, 0x05, 0xFF, 0x2C,
-    0xD8, 0x56, 0x84, 0x8D, 0xEF, 0xCB, 0x9A, 0xCF, 0x56, 0xE4, 0xCA, 0xDE, 0xC7, 0x7B, 0x27, 0x89,
-    0x22, 0xB6, 0x8D, 0x0F, 0x37, 0x3E, 0x3A, 0x49, 0xFC, 0xB8, 0x26, 0x79, 0x7F, 0xD8, 0xFC, 0xE2,
-    0xE5, 0x8D, 0x33, 0xDE, 0x95, 0xB1, 0x9D, 0x7C, 0x86, 0xBC, 0x3A, 0xB6, 0x93, 0xCE, 0x58, 0xEC,
-    0x71, 0x25, 0x09, 0x6F, 0x03, 0x6B, 0xDC, 0x46, 0x49, 0x6C, 0x1B, 0xE9, 0xD9, 0x49, 0x1E, 0xB5,
-    0xE3, 0x7E, 0xA4, 0xF7, 0xDB, 0xD0, 0xB0, 0xA3, 0x6E, 0xB4, 0xF4, 0x31, 0x74, 0xB6, 0x5A, 0x95,
-    0xB1, 0x03, 0x97, 0xFC, 0xA3, 0x63, 0x93, 0x47, 0xFF, 0xE8, 0xAE, 0x16, 0xDE, 0x1F, 0x24, 0x7F,
-    0xFB, 0xF1, 0x53, 0x6B, 0x62, 0xBA, 0xDF, 0x83, 0xCF, 0x6C, 0xEB, 0xB6, 0xF6, 0xEA, 0xFB, 0xFF,
-    0xEC, 0xF2, 0xDF, 0xD4, 0x61, 0x9B, 0x27, 0x9F, 0x76, 0x96, 0xAE, 0xDA, 0xA7, 0xF7, 0xBA, 0x1E,
-    0x9D, 0xA0, 0x55, 0x37, 0x7A, 0xC4, 0x0E, 0x7C, 0x48, 0x6D, 0x3D, 0xEF, 0x12, 0x08, 0x53, 0xA9,
-    0xB7, 0xFE, 0xD5, 0xA5, 0x95, 0xA8, 0x4C, 0xFD, 0xEC, 0x69, 0xA7, 0x0A, 0x78, 0x9F, 0xB2, 0x0F,
-    0x2D, 0x9C, 0xA3, 0x83, 0x2B, 0x14, 0xB6, 0x17, 0x08, 0x13, 0xE1, 0x61, 0x33, 0x69, 0xE0, 0xC9,
-    0xD1, 0xCF, 0x5C, 0xA3, 0x65, 0xA5, 0x96, 0xF5, 0x5A, 0x56, 0x6D, 0x59, 0xBB, 0x65, 0x05, 0x97,
-    0x75, 0x5C, 0x56, 0x73, 0x59, 0xD3, 0x48, 0x1F, 0x2A, 0x9B, 0x23, 0x9C, 0x27, 0x7D, 0x0F, 0xEC,
-    0x20, 0x73, 0x95, 0x1F, 0xF5, 0xA5, 0xCC, 0xB5, 0xFE, 0xAC, 0x61, 0x0C, 0x8C, 0x8A, 0xFF, 0xC5,
-    0x94, 0x32, 0xD7, 0xFD, 0xAF, 0xEC, 0x4F, 0xEA, 0x3F, 0xD0, 0x08, 0xB5, 0xC9, 0x02, 0x0F, 0x34,
-    0xA4, 0x9D, 0x8C, 0xF0, 0xFE, 0xE7, 0x9D, 0xCC, 0xED, 0x10, 0x23, 0xF2, 0xE6, 0xA6, 0x08, 0xA1,
-    0xDF, 0xDC, 0x1A, 0xBE, 0x2D, 0x8E, 0x1A, 0x04, 0xA6, 0x03, 0xE7, 0x5E, 0x82, 0x8E, 0x63, 0x60,
-    0x63, 0x58, 0x65, 0x83, 0xCF, 0xAF, 0xF5, 0x52, 0xE2, 0x61, 0x1F, 0x9A, 0x00, 0xA6, 0x0F, 0x4D,
-    0x5A, 0xC5, 0xB5, 0xC2, 0xDB, 0x1E, 0xAF, 0xF7, 0xDC, 0x7B, 0x44, 0x34, 0x46, 0x20, 0x02, 0x31,
-    0x46, 0x55, 0x1C, 0x95, 0x0B, 0xC7, 0x0D, 0x60, 0xA3, 0x80, 0x1D, 0x18, 0x8B, 0xC0, 0xC7, 0xE8,
-    0xD5, 0x5D, 0x44, 0xA5, 0x2A, 0x92, 0x2A, 0xD6, 0xE0, 0xD6, 0x48, 0x2B, 0x7B, 0xF9, 0x9B, 0x9D,
-    0x5B, 0x22, 0xA9, 0x2C, 0x62, 0x58, 0x71, 0x5E, 0x11, 0x34, 0x30, 0x6B, 0x1B, 0xD5, 0xB2, 0xE7,
-    0xDF, 0xC4, 0x7B, 0x30, 0x1E, 0x17, 0xC1, 0x18, 0xA0, 0x10, 0x46, 0x79, 0x9D, 0x1B, 0x07, 0x61,
-    0x31, 0x12, 0x76, 0xC2, 0x58, 0xEC, 0x1B, 0x46, 0xAF, 0x65, 0x54, 0x27, 0x86, 0x55, 0x32, 0x2A,
-    0xF4, 0xFB, 0xCA, 0x7B, 0x5A, 0x05, 0x9F, 0xD6, 0xD1, 0x35, 0x1D, 0x8B, 0xBE, 0x24, 0x46, 0x4E,
-    0x39, 0x6C, 0xB3, 0x59, 0x30, 0x10, 0x2E, 0x94, 0xE1, 0xF6, 0xC3, 0x12, 0x39, 0x1C, 0xA8, 0x96,
-    0xD4, 0x10, 0x98, 0xB0, 0x51, 0x34, 0xC9, 0xB6, 0x33, 0x55, 0x2B, 0x61, 0x27, 0x41, 0x0F, 0x24,
-    0xE3, 0x2C, 0x5C, 0x89, 0x45, 0x8D, 0x28, 0x2D, 0x23, 0x5A, 0xAD, 0x38, 0x0B, 0x66, 0x24, 0x08,
-    0x58, 0x84, 0x75, 0xDC, 0xFA, 0x06, 0xE0, 0xDF, 0x44, 0x6D, 0xD0, 0x07, 0x3A, 0xD5, 0x98, 0xC5,
-    0xA1, 0xAA, 0xF6, 0xB1, 0x57, 0x7C, 0x8C, 0x9D, 0xEC, 0xF1, 0x78, 0x26, 0xC0, 0xDC, 0xCB, 0x48,
-    0x11, 0x83, 0xD7, 0xAB, 0x3A, 0xEE, 0x82, 0x41, 0xD5, 0x69, 0xEF, 0x0F, 0x51, 0x56, 0xDA, 0xEC,
-    0x8E, 0xF8, 0xB8, 0xC5, 0x3E, 0xB7, 0x31, 0xDC, 0x36, 0xD5, 0x10, 0x80, 0x4C, 0x20, 0xC0, 0xE0,
-    0x01, 0xCC, 0x22, 0xA6, 0x9F, 0x26, 0xD2, 0x71, 0x1B, 0x34, 0x7E, 0x81, 0x21, 0x18, 0xEA, 0xD7,
-    0xCE, 0x97, 0xA9, 0x0E, 0x60, 0x0B, 0x3A, 0x59, 0x8E, 0xB7, 0x99, 0x67, 0x3D, 0xC4, 0x82, 0x85,
-    0xE4, 0xFE, 0x00, 0x11, 0x20, 0x14, 0xB7, 0x18, 0xFB, 0xE9, 0x2E, 0x61, 0x1B, 0xB6, 0x12, 0x35,
-    0x51, 0x03, 0xC5, 0x23, 0x6A, 0x1F, 0x9B, 0xA5, 0xD0, 0x20, 0x24, 0x3A, 0x4C, 0x14, 0x02, 0xE2,
-    0x78, 0x21, 0x1C, 0x3A, 0x34, 0x74, 0x1F, 0xDF, 0x62, 0x6F, 0x10, 0x63, 0x48, 0x1E, 0x92, 0xF6,
-    0x56, 0xBE, 0xDD, 0x95, 0x59, 0xD0, 0x82, 0x1A, 0x2B, 0xC1, 0xB3, 0x41, 0x42, 0x78, 0x5F, 0x84,
-    0x31, 0x11, 0xAC, 0x00, 0x7B, 0x2F, 0xF2, 0xCF, 0xE1, 0x0A, 0x5C, 0x00, 0x82, 0xD7, 0x23, 0x81,
-    0xF7, 0x9C, 0x35, 0x5C, 0xD6, 0x1A, 0x12, 0x78, 0xBB, 0x19, 0xEF, 0x8A, 0x7C, 0xE7, 0x87, 0x22,
-    0x17, 0x7F, 0x2C, 0x9E, 0x89, 0xB3, 0xD7, 0xAA, 0x10, 0x91, 0x23, 0xE5, 0xDF, 0xA6, 0xC1, 0x83,
-    0x78, 0x48, 0x22, 0x61, 0xED, 0x99, 0xEF, 0x8A, 0xFC, 0xF2, 0xA2, 0xC8, 0xF9, 0xD7, 0x45, 0xCE,
-    0x4C, 0xAC, 0x6E, 0x61, 0x7F, 0x98, 0x7D, 0x68, 0xD2, 0xCA, 0xF9, 0x87, 0xCB, 0x72, 0xEF, 0x81,
-    0x60, 0x5F, 0x1F, 0xEC, 0xC3, 0x31, 0x19, 0x4A, 0x4A, 0x74, 0x44, 0xFF, 0x59, 0x25, 0xFE, 0x53,
-    0x00, 0xCE, 0x01, 0xD2, 0xCA, 0x35, 0x78, 0x1E, 0x5C, 0x87, 0xEE, 0x73, 0xE4, 0xB3, 0x88, 0xF7,
-    0xC3, 0xCE, 0x64, 0x15, 0xFD, 0xEB, 0x09, 0x50, 0x86, 0xBB, 0x63, 0x07, 0xB2, 0x96, 0x63, 0xBC,
-    0x5D, 0x45, 0x9A, 0x9D, 0x1E, 0x4D, 0x9D, 0xC4, 0xCE, 0x26, 0xA8, 0x28, 0xA7, 0x80, 0xB4, 0xE9,
-    0x14, 0x9B, 0x9F, 0x24, 0x0E, 0x5E, 0xFC, 0xF6, 0x34, 0x9C, 0xBE, 0x70, 0x39, 0xF8, 0x15, 0xAE,
-    0xB6, 0xC2, 0x44, 0xCC, 0xD5, 0x92, 0x2D, 0x83, 0xD5, 0xD0, 0x49, 0x9F, 0x69, 0xAC, 0x06, 0xD7,
-    0x56, 0xF6, 0xDF, 0x48, 0xB7, 0xC3, 0xED, 0x82, 0x79, 0x97, 0xAB, 0xC1, 0xF7, 0xD0, 0x09, 0xB8,
-    0x9A, 0x35, 0x97, 0xDD, 0x6A, 0xC1, 0xD0, 0x72, 0x35, 0x6C, 0x49, 0xD3, 0x61, 0x35, 0x2C, 0x12,
-    0x12, 0x49, 0xEE, 0x12, 0x6A, 0x0B, 0x08, 0x71, 0xC6, 0x6D, 0xD1, 0x3B, 0xA0, 0x57, 0x58, 0xFB,
-    0x64, 0xCC, 0xA7, 0xFC, 0xCE, 0x01, 0x83, 0xC9, 0xDD, 0x49, 0xE0, 0xC6, 0xA5, 0xD5, 0x94, 0xB0,
-    0x1D, 0x5E, 0xB2, 0x4C, 0x70, 0x29, 0x5E, 0x9C, 0xEC, 0xCE, 0x34, 0x2C, 0x08, 0x7C, 0x4E, 0x72,
-    0xC8, 0xC9, 0x55, 0x18, 0x9C, 0x63, 0xB1, 0x70, 0xC8, 0x2C, 0xD2, 0x8B, 0x49, 0x13, 0x02, 0x67,
-    0x4C, 0xFB, 0xF0, 0x83, 0xD1, 0x47, 0x38, 0x85, 0xEC, 0xF2, 0x69, 0xA6, 0x1D, 0x39, 0x7B, 0x58,
-    0xD5, 0x1F, 0x6E, 0xC2, 0x15, 0x0D, 0xB4, 0x84, 0x15, 0x9E, 0x67, 0x47, 0x6B, 0x94, 0xA9, 0xDC,
-    0x21, 0x67, 0x8A, 0xAA, 0xFE, 0x0C, 0x1A, 0x5C, 0x0E, 0x44, 0x16, 0x77, 0x7E, 0x46, 0xAB, 0x8D,
-    0x0F, 0xC9, 0xCC, 0x31, 0x64, 0xC1, 0x33, 0x15, 0x3D, 0x64, 0x16, 0x8E, 0x75, 0x8B, 0x7F, 0x7B,
-    0x5C, 0x23, 0xB4, 0xB5, 0x78, 0x74, 0x93, 0x23, 0x72, 0x65, 0x47, 0xE4, 0xFA, 0x16, 0x63, 0xB6,
-    0x1B, 0x69, 0xFF, 0xD6, 0xC2, 0x69, 0x10, 0x31, 0x5E, 0xD9, 0x32, 0x68, 0x50, 0xF8, 0x30, 0x6E,
-    0xF0, 0x53, 0xA4, 0x1F, 0xD8, 0xF8, 0xEF, 0xB6, 0x3A, 0x23, 0xF6, 0x27, 0x8E, 0x25, 0xB4, 0xC6,
-    0x0F, 0x02, 0x97, 0xF0, 0x04, 0xB8, 0xF6, 0xF9, 0x00, 0xC8, 0x07, 0xB6, 0x58, 0x3D, 0x6F, 0x20,
-    0x04, 0x76, 0x13, 0xAF, 0x50, 0x62, 0x0D, 0x4E, 0x4D, 0x0A, 0x0B, 0x4D, 0xC3, 0xE6, 0x2B, 0xD9,
-    0x8D, 0x11, 0x46, 0x78, 0x02, 0xBB, 0xC4, 0xB8, 0x18, 0x53, 0xC6, 0x71, 0xE5, 0x0F, 0xA2, 0x2D,
-    0xAD, 0x5D, 0xC0, 0xCD, 0x96, 0xE5, 0x13, 0x66, 0xE3, 0xDE, 0x73, 0x25, 0x21, 0x64, 0x80, 0x70,
-    0x40, 0x0F, 0xC8, 0xB6, 0xC5, 0x7D, 0xB4, 0x5B, 0x34, 0x91, 0xE5, 0x7A, 0xD1, 0x00, 0x6C, 0x84,
-    0x5C, 0xC4, 0x34, 0xAB, 0x23, 0x27, 0x15, 0xF1, 0xB3, 0xA3, 0x40, 0xFC, 0x6A, 0x7E, 0x93, 0xFA,
-    0xAB, 0xF2, 0x38, 0x50, 0x61, 0x94, 0x41, 0x1A, 0x28, 0xE1, 0x20, 0x8B, 0xB2, 0x40, 0x27, 0x88,
-    0x72, 0x7A, 0x29, 0x33, 0x73, 0xFB, 0xED, 0x3D, 0xC6, 0xBF, 0xBD, 0x01, 0x24, 0x10, 0xFB, 0x46,
-    0x7F, 0xB5, 0x85, 0x48, 0x45, 0xD4, 0x12, 0x90, 0x71, 0x75, 0xA0, 0x4A, 0x78, 0xCC, 0x91, 0x9D,
-    0x20, 0x3C, 0xB2, 0x0F, 0xC0, 0x06, 0xB8, 0x26, 0x69, 0x03, 0x60, 0xE3, 0x42, 0x90, 0x84, 0xAE,
-    0x6E, 0xC4, 0xFE, 0x97, 0x65, 0x2E, 0x53, 0x12, 0x07, 0xAE, 0x75, 0x38, 0xB8, 0x2B, 0x39, 0x15,
-    0x54, 0x6E, 0x85, 0x19, 0x80, 0xFB, 0xD3, 0xCD, 0x49, 0xC8, 0xCF, 0xB9, 0x13, 0xDD, 0x88, 0x48,
-    0x05, 0x86, 0x7E, 0x3F, 0x3A, 0x0A, 0x71, 0x9A, 0x95, 0xB0, 0x03, 0xB3, 0xF1, 0x55, 0x30, 0x95,
-    0x0F, 0x6A, 0x2C, 0xAE, 0x1B, 0x55, 0xDA, 0xEE, 0x52, 0x62, 0x7B, 0xD0, 0x00, 0xB2, 0xC7, 0x10,
-    0x9F, 0x73, 0x4C, 0x0B, 0xAA, 0x2F, 0x25, 0xA7, 0xE5, 0x52, 0x22, 0x27, 0xA2, 0xEF, 0x9F, 0xA3,
-    0xBD, 0xEC, 0x00, 0x50, 0x19, 0xC0, 0x6A, 0x50, 0xB6, 0xDD, 0x24, 0xE5, 0xC7, 0xD0, 0xFC, 0x1D,
-    0xC7, 0x71, 0x3C, 0x40, 0xA2, 0xB7, 0xC0, 0x70, 0x1C, 0xA9, 0x2A, 0x1E, 0xD1, 0x50, 0x94, 0xB4,
-    0xA0, 0xEE, 0x6B, 0xA8, 0xB5, 0xE3, 0x71, 0xAE, 0x2E, 0xED, 0xF3, 0x09, 0xE9, 0xC6, 0x20, 0x39,
-    0x05, 0xDA, 0x44, 0xE2, 0x56, 0x4F, 0xB0, 0xA3, 0xF6, 0x49, 0xB3, 0x0A, 0xBD, 0xD1, 0x31, 0xF0,
-    0xAA, 0xED, 0xE8, 0x99, 0x91, 0xF4, 0x31, 0x32, 0xCD, 0x3D, 0x6C, 0x54, 0x46, 0xE3, 0xEC, 0x3A,
-    0xBC, 0x88, 0xBA, 0xB8, 0x43, 0xD6, 0xDC, 0x3D, 0xBA, 0x3B, 0x3B, 0x30, 0x21, 0xDB, 0x78, 0x78,
-    0xDA, 0x9C, 0x3F, 0x4E, 0x19, 0xA4, 0x10, 0x54, 0x88, 0xF4, 0x42, 0xA8, 0x17, 0x62, 0xBD, 0x2C,
-    0x81, 0xFD, 0xFF, 0xE1, 0xC3, 0xD4, 0x23, 0xCC, 0x3D, 0xC2, 0xE4, 0x23, 0xCC, 0x3E, 0xE2, 0xD2,
-    0xCF, 0x22, 0xFF, 0xCC, 0x71, 0xCD, 0x5D, 0x08, 0x35, 0x77, 0x58, 0x54, 0xDA, 0xDB, 0x19, 0xA5,
-    0xBD, 0x5D, 0xCB, 0x6B, 0x96, 0x90, 0xC1, 0x4B, 0x68, 0xAF, 0x01, 0xD3, 0xBE, 0xA0, 0x0B, 0xFD,
-    0x89, 0xBE, 0x44, 0x68, 0x99, 0x39, 0x00, 0xF4, 0xE7, 0x69, 0xC4, 0xDD, 0x39, 0xAC, 0xE4, 0x65,
-    0x33, 0xA4, 0x5F, 0x3D, 0xE1, 0x04, 0x58, 0x54, 0x9C, 0x49, 0xD1, 0x6D, 0xC0, 0x4E, 0x6F, 0x4B,
-    0xF4, 0x25, 0x86, 0xA4, 0x4F, 0x11, 0x82, 0x11, 0x0E, 0x89, 0x93, 0x61, 0x65, 0x32, 0x66, 0x9E,
-    0xE5, 0x88, 0xAD, 0x01, 0x84, 0x1A, 0x0E, 0xE7, 0xC3, 0xB3, 0xD3, 0x36, 0x39, 0x2F, 0x5E, 0x00,
-    0xE2, 0xE1, 0xB1, 0x6D, 0xF9, 0x9C, 0xE7, 0xF0, 0xB3, 0x3E, 0x2D, 0xC9, 0x01, 0x60, 0xEA, 0x3A,
-    0x4E, 0xF1, 0x3E, 0x37, 0x83, 0x3A, 0x9F, 0x9A, 0x6B, 0xEC, 0xD9, 0x01, 0x0B, 0xBD, 0x87, 0x93,
-    0xB2, 0xDD, 0xF5, 0xBA, 0xD4, 0x9D, 0xCA, 0x1B, 0x95, 0x9D, 0xC3, 0x8F, 0x46, 0x6E, 0x5D, 0x9D,
-    0x32, 0x1C, 0x0E, 0xAD, 0x8E, 0x72, 0xD6, 0x2F, 0x57, 0xEB, 0xA8, 0x10, 0xF3, 0x03, 0xD8, 0x12,
-    0xF6, 0x3C, 0xFF, 0x3D, 0x06, 0x5A, 0x80, 0x82, 0x2B, 0xD0, 0x59, 0x78, 0xFF, 0x73, 0x13, 0x3F,
-    0x7B, 0xD2, 0x04, 0xB4, 0x12, 0xA6, 0x5E, 0xB1, 0x76, 0x9F, 0x27, 0x7D, 0x12, 0x7C, 0x9B, 0x87,
-    0xC9, 0x2A, 0xFA, 0xF2, 0x0B, 0x13, 0x3D, 0x7A, 0x6C, 0xFC, 0x2D, 0x5D, 0x71, 0x9E, 0xC3, 0x36,
-    0x87, 0x5E, 0x04, 0x32, 0x62, 0x9A, 0xD2, 0x63, 0xFF, 0x68, 0x99, 0x7F, 0x6E, 0x84, 0x40, 0xC9,
-    0xEB, 0x91, 0xD2, 0xE2, 0xB8, 0x6D, 0xA6, 0x45, 0x38, 0xDF, 0xF1, 0xA9, 0x79, 0x70, 0x64, 0x89,
-    0x9F, 0xBF, 0xD5, 0x48, 0x89, 0x53, 0x3A, 0xEB, 0xDB, 0xE4, 0x21, 0xCE, 0x1A, 0x38, 0x9D, 0xDF,
-    0x80, 0x9A, 0xA1, 0xC9, 0x23, 0xC3, 0x12, 0xB7, 0x8B, 0x61, 0xF9, 0xE4, 0x7A, 0xAB, 0x90, 0x8C,
-    0x37, 0xFC, 0x9B, 0x1B, 0xAB, 0xBB, 0x32, 0x47, 0xD4, 0xD4, 0x81, 0x9F, 0xD2, 0x87, 0xD7, 0xF1,
-    0x89, 0x77, 0xAC, 0x9B, 0x51, 0xCA, 0xD5, 0x82, 0x72, 0x26, 0xC6, 0x49, 0xD9, 0xB8, 0xAB, 0xA1,
-    0xB4, 0x51, 0xFD, 0x62, 0xF7, 0x1C, 0xAB, 0x84, 0xE5, 0x55, 0x94, 0x1B, 0x0D, 0xF9, 0x9D, 0x1C,
-    0xA8, 0x19, 0x59, 0xDE, 0x1C, 0xE1, 0x39, 0x3E, 0x79, 0x31, 0xCF, 0xA8, 0x58, 0xE2, 0x66, 0x0E,
-    0xFB, 0x51, 0xF1, 0xE2, 0x39, 0x94, 0x13, 0xB5, 0xBF, 0xE3, 0x7F, 0xB8, 0x4A, 0x62, 0xD6, 0x28,
-    0x4B, 0xC1, 0xE3, 0x73, 0x8E, 0xB7, 0xAA, 0x9A, 0xBD, 0x90, 0xC3, 0x7C, 0xC4, 0xEA, 0x58, 0xB4,
-    0xA1, 0x52, 0x71, 0xC7, 0xB2, 0x79, 0xCF, 0x15, 0x0B, 0xC7, 0x7C, 0x66, 0x93, 0x8E, 0x4E, 0xC5,
-    0x74, 0xBC, 0xB8, 0xDB, 0xD9, 0x8B, 0x4C, 0xED, 0x80, 0x7B, 0xE2, 0xEC, 0x2E, 0x2E, 0x6C, 0xDE,
-    0x71, 0x56, 0x73, 0xC1, 0xE3, 0xAA, 0x91, 0x5B, 0x91, 0x5E, 0xCB, 0x82, 0x3E, 0xD2, 0x0A, 0xF9,
-    0x21, 0xD2, 0xB9, 0x1E, 0xFB, 0x7E, 0x1B, 0x69, 0xB7, 0x27, 0x7A, 0x31, 0xD2, 0x5D, 0xDD, 0xDF,
-    0x53, 0xFD, 0xF2, 0x75, 0x2A, 0x85, 0x96, 0xC6, 0x78, 0x98, 0x9B, 0x38, 0x9E, 0xF9, 0xC8, 0xB3,
-    0x1E, 0xFB, 0xE3, 0xF3, 0xF9, 0xC8, 0x70, 0xF4, 0x95, 0x4A, 0x61, 0x4D, 0x55, 0xAF, 0x65, 0x0B,
-    0x0B, 0xE3, 0x89, 0x32, 0x4A, 0xCF, 0x9F, 0x78, 0x78, 0x92, 0xBB, 0x31, 0xAB, 0xD9, 0x3A, 0x12,
-    0x0F, 0x6B, 0x7F, 0xD6, 0x21, 0x67, 0xA7, 0x3E, 0x2B, 0xA9, 0x0D, 0x77, 0x22, 0xB0, 0xD5, 0x05,
-    0xF4, 0x2F, 0x4C, 0x7D, 0x1E, 0xEC, 0x0E, 0x8F, 0xFE, 0xDF, 0xE0, 0x8F, 0x86, 0x57, 0xC7, 0x76,
-    0xD2, 0x19, 0xAA, 0x4B, 0xDB, 0xD8, 0x84, 0x75, 0x50, 0x9D, 0x64, 0x3C, 0x67, 0x78, 0x59, 0x80,
-    0x2A, 0x3E, 0x36, 0x69, 0xAB, 0xBA, 0x93, 0xCD, 0xF0, 0x8B, 0x48, 0x5F, 0x3C, 0x7F, 0xF1, 0x7C,
-    0xA4, 0x4F, 0xB6, 0x0A, 0x73, 0xF7, 0x37, 0xD3, 0xFC, 0x3F, 0x5D, 0x54, 0x31, 0x8F, 0xDC, 0x44,
-    0x14, 0xFE, 0xEC, 0x11, 0x19, 0x09, 0x4B, 0xCC, 0x0F, 0xA0, 0x98, 0x1A, 0x21, 0x65, 0xFE, 0x40,
-    0x58, 0x3B, 0x49, 0x41, 0x91, 0x02, 0x9A, 0x40, 0x99, 0x0A, 0x8A, 0x6B, 0xD2, 0x82, 0xC4, 0xAD,
-    0x1D, 0xAE, 0xA0, 0x48, 0xC1, 0x76, 0x94, 0xA1, 0x48, 0x71, 0x2C, 0xC5, 0x35, 0x14, 0x29, 0xEE,
-    0xD6, 0x56, 0x28, 0xAE, 0xA0, 0x99, 0xEE, 0x4A, 0x8C, 0xC2, 0xE9, 0x10, 0x14, 0x3B, 0x41, 0x83,
-    0xE2, 0x4B, 0xBC, 0x3B, 0x7C, 0x6F, 0x77, 0xC9, 0x29, 0xD8, 0xCF, 0x92, 0xE7, 0xCD, 0x9B, 0x37,
-    0xF3, 0xBE, 0xEF, 0x7B, 0x83, 0xBA, 0x51, 0x29, 0x14, 0x29, 0x9A, 0x67, 0x83, 0x7B, 0x3A, 0x96,
-    0x07, 0x43, 0x79, 0x9B, 0x16, 0x6B, 0x1D, 0xCA, 0x8F, 0x42, 0x99, 0xBC, 0x4B, 0x4D, 0xB1, 0x02,
-    0x9F, 0x6C, 0xA6, 0x82, 0xF2, 0x80, 0xE9, 0x4C, 0x67, 0x1B, 0x57, 0x95, 0x28, 0x31, 0xC1, 0x3E,
-    0x8E, 0x71, 0xC8, 0xC9, 0x43, 0xE8, 0x11, 0x66, 0x44, 0x39, 0x20, 0xC5, 0xFC, 0x45, 0x2C, 0xCE,
-    0x82, 0x7D, 0x18, 0xCA, 0xA3, 0xA1, 0x4E, 0xE3, 0x5E, 0x3B, 0xC0, 0x76, 0x70, 0x4D, 0x3E, 0xFF,
-    0x5E, 0xCB, 0x66, 0xC1, 0x34, 0x30, 0x15, 0x6C, 0xA2, 0x75, 0xB0, 0x1E, 0x46, 0xEC, 0xBC, 0xEE,
-    0x52, 0x02, 0x63, 0xE5, 0x79, 0x37, 0x66, 0x69, 0xD0, 0xEB, 0xC8, 0x19, 0xD7, 0xA0, 0x6C, 0xBB,
-    0x32, 0x85, 0xFA, 0xC3, 0x50, 0xAB, 0x50, 0xF2, 0x64, 0x8F, 0x7A, 0x2E, 0xD4, 0x6B, 0x09, 0xBC,
-    0x36, 0xFF, 0xC1, 0xA4, 0x95, 0x49, 0x23, 0xD4, 0x80, 0x22, 0x48, 0xAA, 0xB2, 0x41, 0x0B, 0xAC,
-    0xAE, 0x1C, 0xCC, 0x80, 0xB6, 0xE1, 0xD6, 0xE6, 0x22, 0x9A, 0xA7, 0x83, 0x79, 0x16, 0x74, 0xF2,
-    0x3A, 0x55, 0x2E, 0xF9, 0xDA, 0x84, 0x45, 0x11, 0x5A, 0xD3, 0xD7, 0xA9, 0xB3, 0x9B, 0x84, 0x58,
-    0x54, 0x3A, 0xF5, 0xE6, 0x55, 0x74, 0x5F, 0x0F, 0xE5, 0x2D, 0x81, 0xC3, 0x2D, 0xA3, 0x49, 0x31,
-    0xFB, 0x4E, 0x72, 0x7D, 0xD6, 0x76, 0xF5, 0x1A, 0xF5, 0xEF, 0x1B, 0x44, 0x3C, 0xB2, 0x5E, 0x6C,
-    0xEF, 0x65, 0xD5, 0xA6, 0xEE, 0x93, 0xF3, 0x6A, 0x3B, 0xCC, 0x66, 0xB8, 0x7B, 0x17, 0x29, 0x35,
-    0xF3, 0x79, 0xC5, 0x30, 0x66, 0xDE, 0x9B, 0x37, 0xDB, 0x1F, 0x9A, 0xAC, 0xFC, 0x0A, 0x51, 0xF5,
-    0x45, 0x67, 0x2A, 0x4B, 0x08, 0x3F, 0xC0, 0x0D, 0x3A, 0xE4, 0xBD, 0xC1, 0xFF, 0xEB, 0xB0, 0x12,
-    0x11, 0x10, 0xF1, 0x64, 0xE7, 0x96, 0xF7, 0x18, 0x03, 0x62, 0x4E, 0x02, 0x8A, 0xC6, 0x72, 0xB8,
-    0x79, 0xD4, 0x2F, 0x41, 0x2F, 0x47, 0x1D, 0xC6, 0xC2, 0x8F, 0xA6, 0x1B, 0xCC, 0x83, 0xC1, 0xDE,
-    0x8C, 0x2E, 0x0F, 0xA5, 0x0A, 0xEF, 0xE5, 0x33, 0xB4, 0x95, 0x62, 0x1D, 0x29, 0xB8, 0xB3, 0x58,
-    0x1E, 0x44, 0xE1, 0x54, 0xC5, 0x56, 0xB3, 0xD6, 0xD0, 0x5A, 0x29, 0xB7, 0x4C, 0x30, 0x5B, 0xB0,
-    0xAF, 0xCD, 0x50, 0xFB, 0x9C, 0x00, 0xA4, 0x8E, 0x74, 0xBF, 0x53, 0x56, 0xA0, 0xD5, 0x10, 0x14,
-    0xD7, 0x02, 0x64, 0x36, 0x8A, 0xE1, 0xBE, 0x57, 0x69, 0x50, 0x69, 0xCC, 0x1E, 0x6C, 0x5C, 0x8A,
-    0x84, 0x07, 0x94, 0x5D, 0xB6, 0x46, 0x11, 0x51, 0xA6, 0x28, 0x14, 0xA5, 0x80, 0xA3, 0x99, 0x4E,
-    0x51, 0xBD, 0x1A, 0x33, 0xC6, 0xE4, 0x03, 0x8E, 0x42, 0x96, 0xAA, 0xEC, 0xA8, 0x87, 0x0E, 0xB4,
-    0x2F, 0xEF, 0x33, 0xA6, 0x73, 0x5B, 0xA4, 0xF3, 0x8D, 0x6A, 0xEC, 0x4E, 0x35, 0xEA, 0x45, 0x28,
-    0x4E, 0x83, 0xBB, 0xD3, 0xD7, 0x3B, 0xD5, 0xFC, 0x01, 0xF7, 0x7F, 0xD5, 0xD8, 0x0A, 0x2E, 0xD1,
-    0x5E, 0xAB, 0xA6, 0x7B, 0x43, 0x35, 0xEF, 0xC7, 0x3C, 0xC5, 0x62, 0x1D, 0x38, 0x29, 0x45, 0x90,
-    0xAB, 0xD4, 0x53, 0x35, 0x53, 0x15, 0xA6, 0x54, 0xCD, 0x3D, 0x11, 0xB3, 0xDE, 0x88, 0xF9, 0xED,
-    0xF9, 0xA1, 0x4D, 0xA3, 0x13, 0xD5, 0x90, 0xD5, 0x5E, 0xE4, 0xC9, 0x05, 0x6B, 0xE4, 0x74, 0x44,
-    0x29, 0xCB, 0x6D, 0x1C, 0x2C, 0x39, 0x67, 0xC9, 0x97, 0x02, 0xB2, 0x7A, 0x3E, 0xE6, 0x89, 0xB5,
-    0x74, 0x84, 0x74, 0xD7, 0x26, 0xDF, 0x44, 0x27, 0x07, 0x13, 0x6E, 0xB3, 0x45, 0x55, 0x24, 0x6F,
-    0xFF, 0x0A, 0xE5, 0x6D, 0xE2, 0x1F, 0xC5, 0x96, 0xC1, 0x32, 0xFE, 0x8E, 0x24, 0xFF, 0x3C, 0x55,
-    0xED, 0x0A, 0x6D, 0xBF, 0x29, 0xBA, 0x43, 0xEE, 0xC5, 0x7E, 0xFC, 0xB3, 0xA2, 0x46, 0x3E, 0x3D,
-    0xDF, 0x0D, 0xB3, 0xE6, 0x0D, 0xD5, 0xB4, 0x57, 0xAA, 0x69, 0xDA, 0xAD, 0x6A, 0xBE, 0xC8, 0x36,
-    0xFC, 0x1B, 0x38, 0xEA, 0x64, 0x2B, 0x0A, 0x79, 0xFF, 0xD3, 0x0D, 0x44, 0x7B, 0x5B, 0xDD, 0x6C,
-    0x27, 0x9E, 0x88, 0x66, 0xB8, 0xA6, 0xD7, 0x54, 0xDA, 0x75, 0x3A, 0xB8, 0xF9, 0xF0, 0x93, 0x28,
-    0x82, 0x9D, 0xA9, 0xFA, 0xA9, 0xF2, 0x27, 0xBA, 0x3B, 0x36, 0xDD, 0xC2, 0x11, 0xA7, 0xC6, 0x7E,
-    0x5B, 0x65, 0xAD, 0x14, 0xE1, 0x0E, 0xFA, 0x89, 0xF6, 0x64, 0xA9, 0xBD, 0x94, 0x35, 0x8B, 0x8C,
-    0xDC, 0xA2, 0xB8, 0x04, 0x79, 0x36, 0xA4, 0xEE, 0x61, 0xCF, 0xB5, 0xFB, 0xAA, 0x3F, 0xD6, 0xFD,
-    0x71, 0xE1, 0xA7, 0x56, 0x74, 0x54, 0x0C, 0xC8, 0x83, 0x43, 0x1E, 0x4F, 0x28, 0x17, 0x52, 0x21,
-    0x95, 0xD6, 0xD2, 0x74, 0x15, 0x28, 0x2B, 0xE8, 0x0B, 0x0F, 0xFB, 0x33, 0xB5, 0x92, 0x07, 0x8E,
-    0xA5, 0xBD, 0xDE, 0x22, 0xEC, 0x79, 0x20, 0x9E, 0x84, 0x88, 0xE9, 0x26, 0x86, 0xC2, 0xAB, 0x98,
-    0x05, 0x8F, 0x91, 0x31, 0x57, 0xE4, 0x24, 0xD4, 0x45, 0x4F, 0xB1, 0xE9, 0xB8, 0x95, 0xF7, 0x68,
-    0x9A, 0x2B, 0x79, 0x4F, 0x54, 0xCF, 0x48, 0x64, 0x11, 0x12, 0x2B, 0x1C, 0xF2, 0x9B, 0x42, 0xFD,
-    0x36, 0x42, 0x9F, 0x05, 0x14, 0xBF, 0xF2, 0x7E, 0x49, 0xD8, 0x7C, 0x76, 0xD9, 0xC0, 0x19, 0xB2,
-    0xA9, 0x7B, 0x4C, 0x24, 0xF0, 0x71, 0x36, 0x64, 0xD2, 0x49, 0x82, 0x8B, 0x67, 0x0F, 0x76, 0xA6,
-    0xB1, 0x95, 0x5C, 0x67, 0x13, 0xE4, 0xA7, 0xFD, 0x02, 0x6A, 0xF9, 0x92, 0x47, 0x8C, 0xE9, 0x5E,
-    0x53, 0xF8, 0x95, 0x69, 0xB8, 0xB3, 0x6D, 0xA4, 0xB5, 0x2A, 0x7B, 0x2B, 0x3A, 0xC8, 0xFE, 0x90,
-    0x13, 0x30, 0x99, 0xDF, 0x87, 0x3A, 0xED, 0xF5, 0x72, 0x28, 0xFE, 0x79, 0xDD, 0x82, 0x51, 0xA2,
-    0x76, 0x67, 0xF4, 0xF8, 0x7B, 0xC8, 0xD2, 0x2A, 0x1F, 0x6B, 0x71, 0x10, 0x36, 0x4F, 0x5C, 0x4F,
-    0x8A, 0xE7, 0x23, 0x29, 0x30, 0x8F, 0x1A, 0xD1, 0x32, 0x78, 0x89, 0x8A, 0xE5, 0x82, 0x6D, 0xE5,
-    0x6E, 0xCA, 0x55, 0xC5, 0xA6, 0xE4, 0x90, 0xFD, 0xF7, 0x71, 0x0D, 0xAA, 0xA6, 0xE6, 0x85, 0xE2,
-    0x55, 0x67, 0x57, 0xF5, 0xEA, 0xEA, 0xDA, 0x9D, 0xA2, 0x0E, 0xCE, 0xFF, 0x0B, 0x6D, 0x57, 0x3D,
-    0x8C, 0xD5, 0xD8, 0x15, 0x3E, 0xB6, 0x03, 0x5E, 0xAD, 0xA3, 0x98, 0x62, 0x57, 0x48, 0x20, 0xAD,
-    0x9B, 0x54, 0x9B, 0xC2, 0x52, 0xEA, 0x5D, 0xAE, 0xD9, 0x95, 0xB2, 0x05, 0x05, 0x53, 0x80, 0xB6,
-    0xA0, 0xA0, 0xA7, 0xA1, 0x49, 0x91, 0x02, 0xC5, 0xD6, 0x50, 0x6C, 0x31, 0x0D, 0x52, 0xC2, 0xD6,
-    0xDB, 0x6D, 0x96, 0x2D, 0x06, 0x29, 0x5B, 0x44, 0xCA, 0x22, 0x1B, 0xA6, 0x40, 0x0A, 0x8D, 0x03,
-    0x51, 0x50, 0x44, 0x81, 0x41, 0x4B, 0x50, 0x48, 0x31, 0x17, 0x30, 0x60, 0x1E, 0x7E, 0x3E, 0xF9,
-    0xBE, 0x7B, 0xFD, 0xDE, 0x9B, 0x22, 0x6F, 0xF4, 0xCE, 0x9D, 0x67, 0xFB, 0x9E, 0x7B, 0x7E, 0xBE,
-    0xF3, 0x9D, 0x63, 0x11, 0x7E, 0x32, 0x2D, 0x44, 0x54, 0x1B, 0x89, 0x14, 0xFF, 0x25, 0xD3, 0x39,
-    0x5C, 0xEA, 0x71, 0x3D, 0xEF, 0x20, 0x4C, 0x73, 0xED, 0x9A, 0x98, 0x9B, 0xAA, 0x52, 0xDE, 0xD2,
-    0x49, 0xCA, 0x3D, 0x5D, 0x42, 0x8C, 0xB8, 0xF1, 0x74, 0x80, 0x50, 0x1D, 0x24, 0x55, 0xED, 0x25,
-    0x54, 0xB5, 0x22, 0x29, 0xBE, 0x92, 0x72, 0x5F, 0xF6, 0x64, 0x0B, 0x1A, 0xB4, 0xE3, 0x33, 0x2D,
-    0x45, 0x23, 0xF3, 0x27, 0xB0, 0x78, 0x28, 0xBC, 0x8B, 0x3B, 0x17, 0x71, 0x27, 0xE6, 0x3E, 0xA8,
-    0xE9, 0x60, 0x41, 0xDD, 0x84, 0xBA, 0xCC, 0xAA, 0x58, 0x3F, 0xF9, 0x54, 0xD2, 0xF1, 0x77, 0x97,
-    0x60, 0x46, 0xFF, 0x83, 0xE4, 0xCF, 0xB1, 0xC1, 0x3C, 0x7E, 0xD4, 0x89, 0xB9, 0xB7, 0xD7, 0x8A,
-    0xB9, 0xFF, 0x55, 0x23, 0xE6, 0xE1, 0xA9, 0x0A, 0xBB, 0x52, 0x1C, 0x31, 0x7D, 0x84, 0xC3, 0xA6,
-    0x13, 0xD7, 0x69, 0x86, 0xA5, 0x0B, 0x56, 0x02, 0xAA, 0x0B, 0xFF, 0x0D, 0x1F, 0x22, 0x6C, 0x90,
-    0x70, 0xBB, 0x5A, 0x9D, 0x2D, 0xF5, 0x04, 0x0F, 0x79, 0x1B, 0x47, 0xB6, 0xA2, 0x8B, 0x5D, 0x1C,
-    0xD9, 0x04, 0x45, 0xA4, 0xB8, 0x97, 0x8C, 0x34, 0x7E, 0xA0, 0xF1, 0xF6, 0xE3, 0x4C, 0x72, 0x6B,
-    0x4A, 0x31, 0x5D, 0xA9, 0x10, 0xF5, 0x7F, 0xC4, 0xB4, 0x78, 0xC6, 0xB4, 0x13, 0xC4, 0xA3, 0x25,
-    0xC4, 0x0B, 0x88, 0xFC, 0xF5, 0x78, 0x04, 0xE7, 0x4E, 0x96, 0x3A, 0xED, 0x1C, 0x83, 0x52, 0xAF,
-    0xC0, 0xC9, 0x2D, 0x17, 0x58, 0x78, 0x9D, 0x53, 0x98, 0x59, 0x14, 0x52, 0x32, 0x0E, 0x4E, 0xD4,
-    0xB4, 0x8A, 0xA1, 0x17, 0xBD, 0x7A, 0x86, 0x36, 0x8F, 0x54, 0x30, 0xD0, 0x85, 0x5E, 0x22, 0x68,
-    0x97, 0x88, 0x06, 0x1D, 0x5F, 0x42, 0x55, 0x8D, 0x4B, 0xE2, 0xB4, 0x9F, 0x7F, 0xB5, 0x35, 0x87,
-    0x39, 0xB3, 0xAB, 0x1C, 0xCD, 0x9F, 0x84, 0x07, 0x97, 0xAB, 0x27, 0x43, 0xFD, 0xBA, 0x93, 0x08,
-    0xE6, 0x4A, 0x3C, 0xCE, 0xCE, 0x05, 0xBB, 0xD3, 0x77, 0x3C, 0x63, 0xC9, 0x33, 0x46, 0xAF, 0x21,
-    0xB8, 0x08, 0x85, 0x09, 0xCF, 0x4D, 0x78, 0xEE, 0xC6, 0xB4, 0x90, 0x5B, 0xB3, 0xE9, 0xDA, 0x77,
-    0xF4, 0x60, 0xA2, 0xF1, 0x4B, 0x8A, 0xD1, 0xE7, 0x70, 0xCB, 0x2D, 0xA9, 0x4F, 0x6A, 0x56, 0xB8,
-    0xC5, 0xE0, 0x3B, 0xE6, 0x3D, 0x9E, 0x0B, 0xC6, 0x7A, 0x02, 0x62, 0x42, 0x08, 0xD5, 0x2A, 0xD2,
-    0xFB, 0xFA, 0x4A, 0x9B, 0x48, 0x03, 0x6D, 0xCA, 0x26, 0x9A, 0x02, 0x2D, 0xCA, 0x26, 0x1E, 0x43,
-    0xC5, 0x39, 0xC9, 0x80, 0x73, 0xB4, 0x48, 0x7B, 0x38, 0x8C, 0xC5, 0xC2, 0x4C, 0x85, 0x5D, 0xD9,
-    0x18, 0x28, 0x13, 0xC0, 0xBB, 0x79, 0x57, 0xF3, 0xAE, 0xF9, 0xBB, 0xF6, 0x08, 0x88, 0xD9, 0x53,
-    0x0B, 0x87, 0xCA, 0x3B, 0xFB, 0x5C, 0x24, 0xAB, 0xD6, 0x47, 0xE3, 0x73, 0x43, 0x0E, 0x7E, 0x4C,
-    0x9B, 0xB4, 0x52, 0x76, 0x30, 0xB2, 0xA6, 0x50, 0x9B, 0x51, 0xE4, 0x95, 0x4C, 0xD6, 0x14, 0xC1,
-    0xC2, 0x1A, 0xB8, 0xBC, 0xA8, 0xAF, 0x20, 0x4B, 0xDA, 0x1E, 0x5F, 0x2C, 0xA6, 0x2A, 0x7A, 0xDE,
-    0x2F, 0xE5, 0xF8, 0xEB, 0xB7, 0x40, 0x38, 0xAE, 0x15, 0x14, 0x70, 0x71, 0xD1, 0x4B, 0xD6, 0xBC,
-    0xB3, 0x92, 0x57, 0x3A, 0x0B, 0x53, 0xD4, 0x00, 0x90, 0xD4, 0xD0, 0x2E, 0x75, 0x43, 0x0C, 0xBA,
-    0x00, 0x18, 0xC6, 0x8F, 0x0B, 0x73, 0x47, 0x15, 0x0E, 0x70, 0x27, 0x7D, 0x8A, 0x45, 0x4F, 0x6E,
-    0xB9, 0xE5, 0xF3, 0x0E, 0xB9, 0x16, 0x3D, 0xD5, 0x22, 0x3C, 0xA1, 0xA6, 0x58, 0x96, 0xC9, 0x54,
-    0x32, 0x4A, 0x8A, 0x70, 0x01, 0x89, 0xFA, 0x02, 0x3B, 0x51, 0x16, 0x55, 0xC9, 0x62, 0xFC, 0xA3,
-    0xD4, 0x88, 0x33, 0x73, 0xEA, 0xD3, 0x3E, 0x2F, 0x48, 0x4E, 0x06, 0x45, 0x58, 0xF2, 0x16, 0xFA,
-    0x10, 0x17, 0xD8, 0x31, 0x2F, 0xE5, 0xE0, 0x73, 0x44, 0x23, 0xBC, 0x65, 0x35, 0x91, 0xC3, 0xC5,
-    0x65, 0x4F, 0xBD, 0x81, 0xEA, 0xC0, 0x11, 0x60, 0x89, 0xB5, 0x85, 0x2D, 0x53, 0xAE, 0x36, 0x9A,
-    0x22, 0xD8, 0xD2, 0x45, 0xCB, 0x64, 0x59, 0x9F, 0x44, 0xAA, 0xEA, 0x11, 0xE7, 0xB1, 0x44, 0xB5,
-    0x22, 0x3E, 0x2A, 0xF8, 0x8D, 0x32, 0x13, 0xB3, 0x84, 0x11, 0x88, 0x0D, 0x53, 0xA5, 0x45, 0xA8,
-    0x55, 0x66, 0x01, 0x99, 0xBA, 0xC9, 0xBB, 0xB2, 0x92, 0xB2, 0x32, 0x6D, 0xF9, 0x37, 0xE4, 0xD6,
-    0x34, 0xE6, 0x0E, 0x79, 0xA3, 0x31, 0x0F, 0x70, 0x22, 0x7E, 0x3F, 0xF5, 0x01, 0x92, 0x43, 0x40,
-    0x57, 0x1F, 0x0E, 0xC1, 0x10, 0xF5, 0x11, 0xBF, 0x7D, 0x32, 0x44, 0x36, 0xB2, 0xE9, 0x90, 0x74,
-    0x91, 0xCD, 0x86, 0xB4, 0x8D, 0x90, 0xF9, 0xAC, 0x89, 0xEC, 0x89, 0x21, 0xAF, 0x22, 0x7B, 0xA3,
-    0x37, 0x12, 0xD9, 0xB1, 0x2F, 0xE5, 0xF8, 0x62, 0x5A, 0x68, 0x65, 0x88, 0xAA, 0x26, 0x7F, 0xF7,
-    0x4E, 0xA7, 0x2A, 0x7E, 0x7A, 0xF7, 0x65, 0x2F, 0xF1, 0x83, 0x5B, 0x2F, 0x51, 0x83, 0x0F, 0xB7,
-    0xDF, 0x74, 0x92, 0xEC, 0x7F, 0xF6, 0xAE, 0x81, 0xB1, 0xA8, 0x6B, 0x84, 0x2F, 0x24, 0xA3, 0x11,
-    0x6A, 0x28, 0x6C, 0x27, 0x7B, 0x57, 0x59, 0x39, 0xF0, 0x9E, 0xB9, 0x8A, 0xAC, 0x72, 0xB7, 0xB4,
-    0x08, 0x5C, 0x79, 0xF5, 0xA2, 0x35, 0x70, 0x43, 0x92, 0x1E, 0xA1, 0xAF, 0xDF, 0xBF, 0x8C, 0x13,
-    0x65, 0xCA, 0xF7, 0x7A, 0x64, 0x60, 0x99, 0xDF, 0xEE, 0x27, 0x09, 0x96, 0x66, 0xC7, 0x4E, 0x12,
-    0x8E, 0x66, 0xE7, 0x39, 0x8A, 0x68, 0x2C, 0x4F, 0x3F, 0x1E, 0x25, 0x1A, 0xEA, 0x94, 0x4B, 0xAF,
-    0xD9, 0xBD, 0x41, 0x62, 0xCB, 0x1D, 0x92, 0xD8, 0xA5, 0xB9, 0x6D, 0x25, 0x7D, 0x3E, 0x7E, 0x7C,
-    0x1A, 0x0B, 0xEE, 0x23, 0x4F, 0xD9, 0xBD, 0x31, 0x00, 0x5E, 0xF2, 0x3D, 0xA2, 0x4B, 0xF2, 0xDB,
-    0x2E, 0x11, 0x66, 0x47, 0x59, 0xB7, 0xAB, 0x8F, 0xAF, 0x6A, 0x4B, 0x18, 0x4D, 0xB3, 0x28, 0x5D,
-    0xBE, 0x50, 0x98, 0xC1, 0x16, 0xC2, 0x9B, 0x8F, 0x0C, 0xB5, 0x32, 0xEC, 0x08, 0x6E, 0xA4, 0x5F,
-    0x28, 0x1C, 0x44, 0x2A, 0xD3, 0x3E, 0x5C, 0x62, 0x77, 0x88, 0x93, 0x2C, 0xEA, 0x24, 0xEF, 0x9C,
-    0x48, 0x06, 0xFC, 0x04, 0x7C, 0xF2, 0xA1, 0xB4, 0x9E, 0x21, 0x13, 0xFD, 0x2F, 0xC9, 0x61, 0x07,
-    0xC4, 0xF1, 0xC1, 0xEA, 0xD0, 0x0F, 0xCF, 0x9E, 0x25, 0x3A, 0x10, 0x9F, 0x0B, 0x60, 0xFB, 0xB5,
-    0x29, 0xBE, 0x2F, 0x74, 0x64, 0x8B, 0x46, 0xD2, 0xE9, 0x3C, 0x0E, 0xEF, 0x03, 0xD6, 0x15, 0xB1,
-    0x04, 0xA0, 0xBD, 0xAF, 0xCF, 0x2A, 0x2A, 0x6D, 0x3C, 0xD3, 0x39, 0x3C, 0x1D, 0x9D, 0xCE, 0xCC,
-    0x25, 0x50, 0x12, 0x6D, 0x8E, 0x7B, 0x1C, 0x8F, 0xB9, 0xBB, 0x91, 0x7E, 0xED, 0xE8, 0xD9, 0xCE,
-    0x98, 0xCC, 0xD8, 0x1B, 0x64, 0xCB, 0x17, 0x2B, 0x6A, 0xBC, 0xC9, 0x06, 0xE2, 0xC5, 0x42, 0x3D,
-    0x14, 0xEA, 0x36, 0x2C, 0xD0, 0xCF, 0xB1, 0x51, 0xD3, 0x11, 0xDB, 0x10, 0x96, 0x70, 0x42, 0x1C,
-    0x7E, 0xA5, 0xFA, 0x8C, 0x49, 0x53, 0x16, 0xD9, 0x44, 0x60, 0x22, 0xD5, 0x23, 0x6E, 0xA4, 0x3D,
-    0x6C, 0x83, 0xE8, 0x10, 0x08, 0x3C, 0x0C, 0x1E, 0x81, 0xE7, 0x1D, 0x28, 0xDD, 0xB4, 0x29, 0x6B,
-    0x03, 0xEC, 0x92, 0x30, 0xF6, 0x29, 0x05, 0xEB, 0x9E, 0x86, 0x43, 0x7D, 0xC2, 0x8A, 0x49, 0x5F,
-    0xC1, 0xA5, 0x94, 0x1D, 0xCB, 0x39, 0x9E, 0xF3, 0x1A, 0x34, 0xE1, 0xDC, 0xBB, 0xE4, 0xD6, 0x7D,
-    0x78, 0xCF, 0x67, 0xDF, 0xAB, 0x09, 0x62, 0x25, 0x43, 0xF2, 0xB1, 0x4C, 0x5D, 0x61, 0x41, 0xFC,
-    0xDA, 0x39, 0xB8, 0xE6, 0xED, 0x0D, 0x2B, 0xBF, 0x95, 0x99, 0x0F, 0x5A, 0x4F, 0x0F, 0xEA, 0xEA,
-    0x33, 0xBB, 0x5A, 0x4F, 0xFE, 0x89, 0xD8, 0x31, 0x04, 0xB9, 0xA1, 0xF2, 0x2B, 0x63, 0x4B, 0x92,
-    0x60, 0x31, 0x93, 0x87, 0x5D, 0xC0, 0x49, 0x81, 0xAD, 0x57, 0xEE, 0xAE, 0x93, 0x04, 0x9B, 0x8B,
-    0x3F, 0x49, 0x3C, 0x48, 0x7D, 0x0B, 0xF1, 0x86, 0x0F, 0xBA, 0x33, 0x29, 0x71, 0xA0, 0x29, 0x08,
-    0x2E, 0xB5, 0xF1, 0x94, 0x35, 0x06, 0xA5, 0x99, 0x8F, 0x39, 0xD6, 0x7C, 0xA1, 0xBD, 0x69, 0xCA,
-    0xC2, 0x81, 0xFD, 0x89, 0x3A, 0x68, 0x95, 0x8E, 0xD3, 0xAF, 0x48, 0x5D, 0xFB, 0xC2, 0xAC, 0x0F,
-    0x79, 0x8B, 0x66, 0xC3, 0x56, 0x6B, 0xB0, 0xF4, 0x6B, 0x38, 0xFB, 0xB5, 0xF2, 0x2F, 0x1A, 0x36,
-    0x6E, 0x06, 0xF4, 0x2E, 0x61, 0x81, 0x67, 0xCC, 0xBB, 0x79, 0x01, 0x51, 0xDE, 0x5C, 0x89, 0x7A,
-    0xCF, 0x09, 0x3C, 0x5F, 0xDE, 0x61, 0x8B, 0xDC, 0x77, 0x23, 0x41, 0x45, 0xC1, 0x50, 0xE0, 0xE6,
-    0x7B, 0x6C, 0xBC, 0x9F, 0xF0, 0xBF, 0x1B, 0x06, 0xB9, 0x9E, 0x5C, 0x93, 0x7A, 0x03, 0x58, 0xEF,
-    0x3F, 0x46, 0x0B, 0x38, 0xBD, 0xAD, 0xF2, 0xFB, 0x04, 0x21, 0x91, 0x9F, 0x51, 0x08, 0x4B, 0xD9,
-    0x23, 0xEA, 0x1C, 0x6D, 0x73, 0xBC, 0xE6, 0x38, 0x8E, 0x3A, 0x1D, 0xE9, 0xCD, 0x1D, 0x13, 0x37,
-    0x74, 0x17, 0x85, 0x0B, 0x3A, 0x20, 0x52, 0xB5, 0x75, 0x6C, 0x1F, 0x8D, 0x60, 0xCE, 0xA3, 0xCB,
-    0x2F, 0x27, 0x46, 0x03, 0x14, 0x30, 0xED, 0x4E, 0x68, 0x41, 0x65, 0xCF, 0x47, 0x3A, 0x62, 0xA2,
-    0x80, 0x80, 0x3D, 0xF9, 0x13, 0x99, 0xE1, 0x6E, 0xFE, 0x4F, 0xDB, 0x9E, 0x91, 0x1B, 0x59, 0xF1,
-    0x4D, 0xDF, 0x75, 0x51, 0xC3, 0x2E, 0xAA, 0xBA, 0x6F, 0x23, 0x7D, 0x58, 0x6D, 0xC5, 0x9A, 0xA2,
-    0x42, 0xC6, 0x14, 0xFA, 0x86, 0x8C, 0x75, 0x9D, 0x13, 0x53, 0xE6, 0xDA, 0x37, 0xA6, 0x35, 0x6A,
-    0xCB, 0x16, 0x5C, 0x5B, 0x36, 0xB5, 0xB6, 0x65, 0xF3, 0x23, 0x72, 0xD3, 0x0E, 0xC0, 0x7E, 0xD7,
-    0x83, 0x29, 0x5F, 0x81, 0x70, 0x33, 0x7D, 0xED, 0x91, 0xCA, 0xFA, 0x53, 0x1E, 0x01, 0x8B, 0x62,
-    0x1A, 0x93, 0xAC, 0x67, 0x29, 0x89, 0x5D, 0x8A, 0x52, 0xF5, 0xF5, 0xEA, 0xF1, 0xE5, 0xD1, 0xE6,
-    0xA0, 0x54, 0xC3, 0xCE, 0x60, 0x02, 0x9B, 0x01, 0x3E, 0x90, 0x54, 0xE4, 0x7A, 0x0B, 0xF5, 0xE5,
-    0x96, 0xFE, 0x18, 0x32, 0x1F, 0x8B, 0x62, 0x74, 0xF1, 0x19, 0xE5, 0xB0, 0x9E, 0x2D, 0xFF, 0xE1,
-    0xD0, 0xD6, 0x10, 0x63, 0xAE, 0xA0, 0x1C, 0x79, 0x59, 0x0E, 0x1B, 0x28, 0x08, 0x48, 0x00, 0x34,
-    0xEB, 0xD6, 0xF8, 0x6E, 0x19, 0x6D, 0xA6, 0xD6, 0x31, 0xD6, 0xF7, 0x4A, 0x62, 0xF1, 0xC7, 0x7B,
-    0x18, 0x1F, 0xBB, 0xF6, 0xBD, 0x27, 0xED, 0xE6, 0x58, 0xAD, 0x8B, 0xC2, 0x8D, 0x9A, 0x47, 0x75,
-    0x3A, 0x4B, 0xC6, 0x51, 0x8A, 0x69, 0x1E, 0x35, 0x5B, 0x5F, 0x71, 0x5B, 0x92, 0xBF, 0x3D, 0xD7,
-    0xF9, 0x5C, 0xC4, 0x14, 0x01, 0x13, 0x22, 0x41, 0xB1, 0xF6, 0x3A, 0xB4, 0x9B, 0x51, 0xCE, 0xCE,
-    0xA3, 0x9C, 0xEE, 0x63, 0xC2, 0xD8, 0xB9, 0x59, 0xC4, 0xD3, 0x3A, 0xE4, 0xFD, 0x81, 0x90, 0x53,
-    0xFD, 0x09, 0x8A, 0x4F, 0x99, 0xCC, 0x4B, 0x14, 0x3F, 0xF2, 0x27, 0x87, 0xD8, 0x8E, 0xA2, 0xEF,
-    0x8F, 0x20, 0x82, 0x0B, 0x7B, 0x60, 0x8E, 0xF4, 0xA3, 0xDC, 0x26, 0xE4, 0xCE, 0x82, 0xA0, 0x38,
-    0x54, 0x70, 0xF2, 0xC9, 0xD8, 0xF8, 0x51, 0x57, 0xD8, 0xCA, 0x4E, 0x1D, 0xEA, 0x4C, 0x27, 0x6B,
-    0x79, 0x58, 0xBF, 0x04, 0x17, 0x86, 0x13, 0x29, 0x21, 0x5A, 0xB2, 0x66, 0xA2, 0x31, 0x76, 0x94,
-    0x48, 0xBA, 0x49, 0x06, 0x36, 0xF5, 0xB4, 0x67, 0x33, 0x4F, 0xFB, 0xCC, 0xCD, 0xCE, 0x94, 0x28,
-    0xD7, 0x1E, 0xBD, 0xA1, 0x23, 0x33, 0x82, 0xB5, 0x28, 0x9B, 0xD8, 0x0F, 0xCF, 0x1F, 0x1C, 0x60,
-    0x15, 0xC7, 0x1D, 0x31, 0x23, 0xE9, 0x09, 0x58, 0xCC, 0xC4, 0x5C, 0x9B, 0x2E, 0x58, 0xE1, 0x74,
-    0x25, 0x5D, 0x9E, 0xCC, 0xB0, 0x01, 0x88, 0x4B, 0x18, 0x62, 0x6A, 0x37, 0x37, 0x40, 0x8E, 0xC7,
-    0x7E, 0xB3, 0xFD, 0x07, 0x30, 0xCA, 0xC3, 0xFD, 0x97, 0xA3, 0xFC, 0xF9, 0xCD, 0x02, 0xF2, 0xAF,
-    0x8F, 0x9F, 0xBF, 0xEB, 0x31, 0xE6, 0x3F, 0xC2, 0x93, 0xF4, 0xC8, 0x4D, 0x00, 0xF0, 0x25, 0x3D,
-    0x75, 0xBF, 0xA5, 0xC4, 0x18, 0x2E, 0x87, 0x02, 0xC6, 0x24, 0x71, 0x83, 0xD2, 0xCA, 0xF3, 0x99,
-    0x53, 0x37, 0x63, 0x18, 0x51, 0x55, 0x52, 0xD4, 0x2C, 0x90, 0x0B, 0xF5, 0xB3, 0x6F, 0xE6, 0x5C,
-    0xFB, 0x7A, 0x6A, 0xE6, 0xB2, 0x9D, 0x67, 0x61, 0x8F, 0x99, 0x83, 0x25, 0xBE, 0xE1, 0x54, 0x8E,
-    0xA8, 0xA9, 0xFB, 0x62, 0x68, 0xBD, 0xD8, 0xBB, 0x69, 0x3D, 0x27, 0x9F, 0xE1, 0xFB, 0xE1, 0xF9,
-    0xB7, 0x4C, 0xB9, 0x5C, 0x00, 0x60, 0x6A, 0xE8, 0x23, 0xED, 0x3A, 0x36, 0x68, 0xFC, 0x69, 0x2E,
-    0xC4, 0xBD, 0x1F, 0x84, 0xA9, 0xD1, 0xE9, 0x77, 0x44, 0xDF, 0xFA, 0xF2, 0x36, 0xCD, 0x11, 0x29,
-    0x1F, 0x70, 0x73, 0x77, 0x58, 0xA7, 0x82, 0x4D, 0x20, 0xD7, 0xC3, 0x15, 0xC0, 0x57, 0x21, 0xB9,
-    0x05, 0x79, 0xB2, 0xC4, 0xDE, 0x6F, 0x47, 0x99, 0x62, 0xCC, 0xA5, 0x09, 0xA6, 0xD1, 0xB4, 0x4F,
-    0xC6, 0x14, 0x09, 0xCB, 0x5E, 0x6B, 0x07, 0x3B, 0x2A, 0xE3, 0xF8, 0xB4, 0x5B, 0x8D, 0xC7, 0xB3,
-    0xD5, 0xAE, 0x3A, 0x73, 0x00, 0x52, 0x4E, 0x50, 0x18, 0x27, 0xD8, 0x81, 0xB0, 0x45, 0x3B, 0xC6,
-    0xAD, 0x27, 0x7A, 0x06, 0x01, 0x34, 0x07, 0xB9, 0xF4, 0xCB, 0xE2, 0x2F, 0x72, 0x69, 0xD9, 0xFD,
-    0x00, 0x43, 0x5E, 0x59, 0xB0, 0x17, 0x66, 0xAE, 0xE5, 0xCF, 0x3F, 0x2A, 0x9C, 0xAA, 0x8C, 0xA1,
-    0xF8, 0x45, 0xFD, 0x6C, 0xF5, 0x46, 0x95, 0x53, 0xC4, 0xBA, 0x79, 0xBF, 0xC9, 0x5C, 0x8F, 0xC9,
-    0x7D, 0xA7, 0x69, 0x36, 0xB2, 0x74, 0x8F, 0x10, 0x22, 0x78, 0xEB, 0x7A, 0xEB, 0x53, 0xE6, 0x06,
-    0x1F, 0x24, 0x97, 0x68, 0x1D, 0x02, 0xDD, 0x5E, 0xA6, 0x98, 0x23, 0x88, 0xD1, 0x78, 0x8C, 0xF0,
-    0x97, 0x0C, 0x5C, 0xE1, 0x22, 0x56, 0x0C, 0xE6, 0x58, 0x53, 0x7B, 0x68, 0x2B, 0x19, 0x7C, 0x20,
-    0x59, 0xB1, 0x68, 0x33, 0x2E, 0xB0, 0x3C, 0x02, 0xBF, 0x5D, 0xA7, 0x4B, 0x09, 0x14, 0x57, 0xBA,
-    0xAE, 0x8E, 0x08, 0x67, 0xB6, 0xE0, 0x9E, 0x60, 0xEE, 0xD9, 0xE0, 0xAD, 0x6B, 0xF0, 0x41, 0xFD,
-    0x4F, 0x6D, 0x69, 0x44, 0x95, 0x12, 0x2D, 0x10, 0x3F, 0xA1, 0x60, 0xCE, 0xCC, 0xAF, 0x1D, 0xC7,
-    0xF5, 0x4F, 0x74, 0x70, 0x9C, 0x85, 0x7B, 0x05, 0xF2, 0x3D, 0xDA, 0xF7, 0x29, 0xB9, 0xFE, 0x5B,
-    0x08, 0xBE, 0x47, 0x3A, 0x71, 0x98, 0x5C, 0x5F, 0x7B, 0xA2, 0x9C, 0x3C, 0xFC, 0x8C, 0x5E, 0xFE,
-    0x97, 0xD4, 0x4F, 0xBF, 0x02, 0x0E, 0xEE, 0x7C, 0x81, 0x51, 0x29, 0x4D, 0x30, 0x59, 0xA7, 0xE9,
-    0x41, 0x40, 0xAD, 0x45, 0xB8, 0x26, 0x2B, 0x0F, 0x46, 0x58, 0x2C, 0xC7, 0x76, 0x75, 0xE1, 0x38,
-    0xCB, 0x09, 0xFF, 0x2A, 0x80, 0x63, 0xAF, 0xAF, 0x8F, 0x75, 0x2F, 0xB6, 0x4E, 0xAC, 0x98, 0xCF,
-    0xCD, 0x4F, 0xFA, 0x19, 0x45, 0x30, 0x8B, 0x00, 0xE3, 0x34, 0xD4, 0xEF, 0x8E, 0xB4, 0xCC, 0xCD,
-    0x51, 0x95, 0x67, 0x96, 0x78, 0x00, 0x52, 0x93, 0x1E, 0xF0, 0x4D, 0xED, 0x4A, 0xB8, 0x50, 0x65,
-    0x0B, 0xBE, 0x64, 0x90, 0xD0, 0xDC, 0xDB, 0xA2, 0x7B, 0xA5, 0x88, 0xF6, 0x9A, 0x95, 0xB8, 0x8C,
-    0x34, 0xFE, 0x0F, 0xD3, 0x5A, 0xE5, 0x60, 0xFF, 0xBF, 0xC1, 0xFE, 0xBF, 0x43, 0xFD, 0x7F, 0x06,
-    0x00, 0xDD, 0x94, 0x31, 0x6E, 0xDB, 0x40, 0x14, 0x44, 0x87, 0x62, 0x0C, 0x17, 0x2C, 0x78, 0x84,
-    0xED, 0x93, 0x82, 0x47, 0x58, 0x26, 0x41, 0x7A, 0x15, 0xC9, 0x29, 0x52, 0xF8, 0x08, 0x14, 0x0C,
-    0xA4, 0xCF, 0x11, 0x72, 0x13, 0xD2, 0x37, 0xA0, 0x73, 0x02, 0xBA, 0x70, 0xBF, 0x05, 0x0D, 0xA8,
-    0x10, 0xF9, 0x33, 0xFF, 0xFF, 0x15, 0x2D, 0x28, 0xA9, 0x02, 0xA4, 0x89, 0x9A, 0x91, 0xC4, 0xE5,
-    0xEC, 0x9F, 0xE1, 0xE3, 0x02, 0xB8, 0x01, 0xF6, 0xC0, 0x4E, 0x52, 0xB3, 0x02, 0x95, 0x4C, 0x42,
-    0x09, 0xF2, 0x28, 0x27, 0x20, 0xA6, 0x8F, 0xF2, 0x86, 0x32, 0x96, 0xFC, 0x81, 0x6E, 0xB8, 0xA5,
-    0x14, 0xC2, 0xCF, 0x84, 0xDA, 0x25, 0xA8, 0x8C, 0xB8, 0x91, 0x2F, 0x77, 0x2F, 0x2D, 0xAF, 0x21,
-    0x24, 0x7A, 0xAD, 0x68, 0x26, 0xA0, 0x5C, 0x79, 0x27, 0x65, 0x41, 0x1C, 0x28, 0x27, 0x1A, 0x00,
-    0xB4, 0xE8, 0x29, 0xD5, 0x11, 0xFD, 0x01, 0xA8, 0x67, 0x48, 0x4B, 0x49, 0x10, 0x6E, 0x10, 0x52,
-    0xE1, 0x42, 0x03, 0xD0, 0xA2, 0x54, 0xE1, 0xE6, 0x8B, 0xCA, 0x60, 0x33, 0xF4, 0x43, 0x45, 0x79,
-    0x27, 0xF7, 0xFD, 0xCC, 0xFF, 0xA4, 0x14, 0x6E, 0x17, 0x97, 0x92, 0x23, 0x20, 0xFA, 0x7A, 0x58,
-    0x22, 0x58, 0x22, 0x75, 0xAB, 0xE4, 0xC9, 0x4C, 0xE5, 0xA7, 0x4A, 0x93, 0x5A, 0x73, 0x1B, 0x6D,
-    0x89, 0x0E, 0x64, 0x89, 0x34, 0x18, 0x13, 0xA9, 0x77, 0x90, 0xB5, 0x3E, 0xD2, 0x43, 0x3E, 0x73,
-    0x38, 0x4D, 0x54, 0x6B, 0x22, 0x0F, 0xC6, 0x0D, 0x9A, 0xE4, 0x89, 0x26, 0x4B, 0xA4, 0x3E, 0xBC,
-    0x37, 0x7A, 0x22, 0xB5, 0xAB, 0x5F, 0x83, 0x1D, 0x34, 0x8A, 0xE5, 0xCB, 0xC1, 0x9A, 0xC9, 0x24,
-    0x6F, 0x1E, 0x6D, 0x73, 0x6B, 0x03, 0x78, 0xAB, 0xAB, 0x35, 0x91, 0x5F, 0x5A, 0x5C, 0x26, 0xE0,
-    0x3A, 0x51, 0x7B, 0x91, 0xE8, 0xD1, 0x13, 0x7D, 0xB8, 0xA8, 0xA9, 0xB3, 0x9A, 0xFE, 0x55, 0xA2,
-    0xF6, 0xF7, 0x44, 0xBB, 0xBF, 0x4F, 0xB4, 0xCF, 0x99, 0x9A, 0x35, 0x8C, 0x99, 0xBC, 0x98, 0x32,
-    0x7B, 0xBA, 0xD0, 0xE8, 0x0B, 0xC3, 0xC6, 0xDF, 0x99, 0xC0, 0x33, 0x83, 0x9C, 0xCA, 0x29, 0xE4,
-    0x40, 0xCE, 0xA1, 0xC0, 0x49, 0x7C, 0x2F, 0x70, 0x16, 0x75, 0x3A, 0xA3, 0x51, 0x89, 0x32, 0x1E,
-    0xB5, 0x25, 0x23, 0x52, 0x2D, 0x8D, 0x49, 0xB5, 0x34, 0x2A, 0x99, 0xD7, 0xB9, 0xD4, 0x9A, 0x2C,
-    0xAE, 0x7D, 0x51, 0x36, 0xB5, 0x31, 0x8B, 0x1C, 0x52, 0xE6, 0x53, 0x01, 0x37, 0x42, 0x35, 0x7B,
-    0x2E, 0x7F, 0xA3, 0xF4, 0xCC, 0xE9, 0x46, 0xEA, 0xC6, 0xEA, 0x46, 0xEB, 0x25, 0xAF, 0xD7, 0x6D,
-    0xA4, 0xDC, 0x86, 0xEE, 0xE1, 0x6D, 0x8C, 0xB9, 0x8D, 0x78, 0x6E, 0x43, 0x1F, 0x8C, 0x8D, 0xCE,
-    0x2F, 0xFF, 0x5D, 0x1B, 0x85, 0x75, 0x51, 0xF4, 0xF2, 0xDD, 0xDE, 0x5F, 0x3D, 0x89, 0x34, 0x92,
-    0xBD, 0xB8, 0x73, 0x78, 0x3D, 0x8A, 0x38, 0x9C, 0xF9, 0x4A, 0x1B, 0x84, 0xD3, 0x0A, 0x44, 0x66,
-    0x26, 0x65, 0x1F, 0x49, 0xF9, 0xBE, 0x7B, 0xD9, 0x6F, 0x47, 0xD1, 0xE2, 0x47, 0xD1, 0x1F, 0xF9,
-    0x9E, 0xAF, 0x8F, 0xA2, 0x8C, 0xF9, 0x37, 0xCD, 0x44, 0x4F, 0xE3, 0xDB, 0x64, 0x40, 0x5C, 0xED,
-    0xD4, 0x28, 0xDA, 0x33, 0xE6, 0x70, 0xCC, 0xBF, 0x3A, 0xE6, 0xBD, 0x67, 0xE8, 0x33, 0xAE, 0x1B,
-    0xED, 0xBA, 0xDE, 0xB0, 0xD5, 0xC5, 0x7C, 0x4C, 0x47, 0xEB, 0xC0, 0x82, 0xC5, 0xC9, 0x13, 0xB5,
-    0x5A, 0x38, 0x3A, 0x9D, 0x03, 0x9D, 0x1C, 0x1A, 0x49, 0xA5, 0xC8, 0x03, 0xA3, 0xB0, 0x80, 0x7B,
-    0x4A, 0x7D, 0xAC, 0x8A, 0xEE, 0xD9, 0x1E, 0x02, 0xC7, 0xA9, 0x4F, 0x36, 0x4E, 0x45, 0x43, 0x8E,
-    0x53, 0x8A, 0x67, 0xE0, 0xBE, 0x36, 0xFC, 0x6A, 0x52, 0x8A, 0x9D, 0xAA, 0x3B, 0xD1, 0x57, 0xF5,
-    0xC7, 0xED, 0xBA, 0x93, 0x4F, 0xE8, 0xE5, 0x54, 0xB0, 0xC8, 0x9E, 0x37, 0x50, 0x3A, 0xBD, 0x7D,
-    0x31, 0xF6, 0x38, 0xE1, 0x2F, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21, 0x10, 0x85, 0xE1, 0x77, 0x43,
-    0x40, 0x70, 0x01, 0x76, 0x70, 0x25, 0x98, 0x98, 0x43, 0x27, 0xB6, 0x61, 0xE2, 0x78, 0x55, 0x58,
-    0x8B, 0x99, 0x96, 0x40, 0x09, 0xD8, 0x03, 0x01, 0x01, 0xEC, 0x73, 0xF7, 0x18, 0x99, 0x81, 0x3F,
-    0xF8, 0x66, 0x87, 0x05, 0xFE, 0xE7, 0x32, 0x33, 0x8E, 0xD7, 0x31, 0x59, 0x02, 0xB3, 0x25, 0xB2,
-    0x5A, 0xE4, 0x69, 0xE8, 0x32, 0xA2, 0x62, 0xF8, 0x20, 0x28, 0xC6, 0xEF, 0x6B, 0x55, 0x24, 0xBB,
-    0x1F, 0x3A, 0xC5, 0xBE, 0x32, 0x05, 0xB2, 0xEA, 0x64, 0x24, 0xF3, 0x99, 0xF5, 0x41, 0xA6, 0x37,
-    0xDB, 0x46, 0x51, 0x2E, 0x9E, 0xE2, 0xC9, 0x7D, 0xA1, 0xAC, 0x14, 0x40, 0x91, 0x0D, 0xD8, 0x34,
-    0x05, 0xF0, 0xC3, 0x73, 0x07, 0x96, 0xEE, 0xC4, 0xFE, 0xBB, 0xBB, 0x66, 0xD9, 0xAE, 0xC5, 0x72,
-    0x90, 0xA2, 0xCC, 0x3D, 0x6F, 0x33, 0x27, 0xBD, 0x3F,
+static const uint8_t notosans_14_bolditalicBitmaps[38170] = {
+    0xDD, 0x59, 0xBF, 0xAF, 0xE5, 0xC4, 0x15, 0x9E, 0x6B, 0xEF, 0x62, 0x09, 0x2B, 0x32, 0x05, 0x48,
+    0x11, 0x14, 0xEE, 0x37, 0xC5, 0xFC, 0x05, 0xD1, 0x98, 0x50, 0xD0, 0xBE, 0x62, 0xA1, 0xC8, 0x16,
+    0x34, 0xA4, 0x48, 0x14, 0xE9, 0xFD, 0x07, 0xD8, 0x4A, 0xCA, 0x34, 0x34, 0x49, 0x8A, 0x14, 0x49,
+    0xB1, 0x91, 0xD0, 0xA3, 0xD8, 0xBF, 0x80, 0x9D, 0x59, 0xB6, 0x48, 0x91, 0x62, 0xBD, 0x20, 0x85,
+    0x22, 0xC5, 0x1A, 0x12, 0x88, 0x02, 0xC5, 0x1A, 0x30, 0xC1, 0x6F, 0xD7, 0xF6, 0xC9, 0xF7, 0x9D,
+    0xB1, 0xEF, 0xBD, 0xFB, 0x2B, 0x20, 0x94, 0x34, 0xB9, 0xEF, 0x7A, 0xFC, 0x9E, 0x7F, 0xCC, 0xCC,
+    0x39, 0xE7, 0x3B, 0xDF, 0xF9, 0x66, 0x9E, 0xF1, 0xC1, 0x08, 0xBE, 0x8D, 0x91, 0x6A, 0x27, 0x26,
+    0xC1, 0x77, 0x31, 0xE9, 0x6C, 0xD2, 0x89, 0xDF, 0x6C, 0x34, 0xF9, 0x60, 0x8A, 0x9E, 0xDF, 0xF8,
+    0xB9, 0x68, 0x8C, 0x0B, 0xC6, 0xB7, 0xFC, 0xD6, 0x8D, 0xB9, 0x80, 0x4B, 0xE9, 0xC8, 0xDB, 0xBC,
+    0x5A, 0xED, 0x16, 0x7D, 0x4B, 0x5F, 0x29, 0x3B, 0x63, 0x03, 0x2F, 0xE3, 0x31, 0x5F, 0x19, 0x6F,
+    0x8C, 0x3C, 0xF2, 0xC5, 0xC5, 0xBA, 0x32, 0xAE, 0xE1, 0x63, 0x65, 0x30, 0x4F, 0x37, 0x3A, 0x46,
+    0xD6, 0xB3, 0xCF, 0x64, 0x32, 0x3B, 0x7C, 0x67, 0x63, 0x16, 0xFD, 0x1E, 0xBF, 0xA7, 0x57, 0x70,
+    0x2B, 0xD9, 0xCF, 0x52, 0xA7, 0x68, 0x5B, 0xF6, 0x05, 0x13, 0x66, 0x5E, 0x2B, 0x3A, 0xF3, 0x7C,
+    0x63, 0x76, 0x97, 0xD3, 0x39, 0x9B, 0xF2, 0xA1, 0xE8, 0xCB, 0xE0, 0x1A, 0x67, 0x2E, 0x9D, 0x55,
+    0x4E, 0x1A, 0x27, 0x55, 0x2D, 0x30, 0xC6, 0x05, 0xDF, 0xFA, 0x50, 0x37, 0x17, 0xA2, 0x75, 0x19,
+    0xFC, 0xE0, 0xA4, 0x37, 0x22, 0x43, 0x2A, 0xBF, 0x9F, 0x32, 0xBC, 0x59, 0x8C, 0xE9, 0x54, 0x0E,
+    0xE9, 0x6C, 0xFB, 0x74, 0x76, 0x5D, 0x3A, 0xB9, 0x36, 0x9B, 0xEA, 0xC0, 0x23, 0x9F, 0x7C, 0x28,
+    0x46, 0x1C, 0x83, 0x6F, 0xCA, 0xDE, 0x07, 0xD7, 0xD5, 0x01, 0xED, 0x27, 0xEC, 0x5D, 0x4C, 0x21,
+    0x98, 0x9B, 0x74, 0xC6, 0x3C, 0x8B, 0x7E, 0xE1, 0x97, 0x7C, 0x31, 0xF5, 0x9C, 0xCA, 0x64, 0x65,
+    0xAA, 0xEF, 0x4F, 0xEE, 0x57, 0xE3, 0xF7, 0x8A, 0xE8, 0x26, 0x4C, 0xBB, 0x33, 0x0E, 0xDF, 0x56,
+    0x9D, 0x05, 0x37, 0x32, 0x16, 0xC7, 0xE1, 0x88, 0x9F, 0x84, 0x9D, 0x59, 0x81, 0x3F, 0x44, 0xE8,
+    0x85, 0xCF, 0xF0, 0xD0, 0x0F, 0x19, 0xB8, 0x67, 0xD8, 0x18, 0xBE, 0x63, 0xF0, 0x0A, 0xE2, 0xC1,
+    0x37, 0xF2, 0x09, 0x8D, 0x1D, 0x78, 0xBD, 0xC5, 0x25, 0xDE, 0x2C, 0x78, 0xA9, 0xEE, 0xF9, 0x14,
+    0x9E, 0xCF, 0x66, 0x3E, 0xB0, 0x9C, 0x5D, 0x85, 0xC1, 0x32, 0x9A, 0x1A, 0x26, 0x1B, 0x2F, 0xB2,
+    0xC6, 0xF9, 0x05, 0x69, 0x76, 0xB8, 0x92, 0x08, 0xAC, 0x58, 0x4E, 0x67, 0x73, 0xC2, 0x4E, 0x01,
+    0x0B, 0x3D, 0xD0, 0xF7, 0xCE, 0x23, 0xE2, 0xE8, 0xA6, 0xC6, 0x9F, 0x35, 0xF0, 0x43, 0x03, 0x14,
+    0x24, 0x30, 0x0A, 0x67, 0xC4, 0xB4, 0x3F, 0x7F, 0x4A, 0x3A, 0xCC, 0x34, 0x70, 0xB6, 0xA7, 0xF2,
+    0x77, 0x63, 0x2E, 0x6B, 0xCF, 0x9C, 0x89, 0x4E, 0x27, 0xE7, 0x5C, 0x2D, 0x9B, 0x9A, 0x13, 0x16,
+    0x0E, 0xB0, 0xA0, 0xBB, 0xE2, 0x4B, 0xCC, 0xD3, 0xBE, 0x8F, 0xC6, 0xBF, 0x3C, 0xC2, 0x73, 0x00,
+    0x60, 0x3A, 0xAA, 0xAF, 0x18, 0xE1, 0x7B, 0xFE, 0x1E, 0x27, 0x2C, 0xB1, 0xB9, 0x74, 0xE6, 0xFF,
+    0x69, 0x14, 0x91, 0x86, 0x9E, 0x33, 0xF4, 0x5D, 0x1C, 0xC2, 0xA2, 0x3F, 0x87, 0xA3, 0x86, 0xC3,
+    0x3C, 0x0E, 0xD1, 0x20, 0x10, 0x19, 0x44, 0x0C, 0x66, 0xB0, 0x20, 0xD8, 0x12, 0x72, 0x58, 0x9C,
+    0xFC, 0x1A, 0xC6, 0x98, 0x72, 0x58, 0x27, 0x8F, 0xA3, 0x54, 0x03, 0xDE, 0x79, 0x55, 0x5A, 0x78,
+    0xA4, 0xF1, 0x78, 0xD6, 0xD2, 0x80, 0x67, 0xD7, 0x48, 0xEC, 0xFC, 0xA4, 0xE1, 0xAD, 0x65, 0xDA,
+    0xC9, 0xC7, 0xAF, 0xA7, 0xE8, 0x3B, 0x1F, 0xA3, 0xF9, 0xF6, 0xF6, 0xEB, 0xC6, 0xDD, 0x22, 0xB8,
+    0x24, 0xE0, 0xDD, 0xCE, 0xF7, 0xAE, 0x97, 0x60, 0x7B, 0xA9, 0x4A, 0x1C, 0xB6, 0x93, 0xCA, 0xB5,
+    0xBE, 0xA9, 0x43, 0xFD, 0x97, 0x88, 0x92, 0x12, 0xDD, 0x64, 0x2B, 0x4A, 0x52, 0x58, 0xD4, 0x64,
+    0x6C, 0x30, 0x2B, 0xA9, 0x72, 0x0D, 0x73, 0x8C, 0x53, 0x31, 0xD2, 0x57, 0x8C, 0x0D, 0xFD, 0xCC,
+    0x84, 0x45, 0x10, 0xAB, 0xE3, 0x50, 0xEB, 0x13, 0x8E, 0x4F, 0xD4, 0xED, 0xFA, 0x44, 0xA2, 0xAF,
+    0xF3, 0x89, 0x62, 0x0F, 0x06, 0xB7, 0xE5, 0x31, 0xDC, 0x4F, 0xA8, 0x0F, 0x00, 0xD3, 0x94, 0xC8,
+    0xCB, 0x73, 0x3A, 0x27, 0x4B, 0x3A, 0xE1, 0xE0, 0x6F, 0x82, 0x2E, 0x09, 0x05, 0x46, 0xD8, 0x47,
+    0x47, 0x95, 0x63, 0xDD, 0xB9, 0xB6, 0xEC, 0xEB, 0x50, 0xF4, 0xBE, 0x01, 0xE4, 0x71, 0xC6, 0x95,
+    0x1E, 0x46, 0xB4, 0x25, 0x66, 0x9B, 0x00, 0x43, 0x24, 0x07, 0xFD, 0x94, 0x4C, 0x57, 0x69, 0x61,
+    0x50, 0x9F, 0x2F, 0xA7, 0x43, 0x31, 0xE4, 0xA3, 0xED, 0xB3, 0xC9, 0x76, 0x19, 0xD2, 0x27, 0xC7,
+    0x51, 0x4C, 0xAE, 0xB7, 0xA3, 0x5D, 0x64, 0x2C, 0x80, 0xB2, 0x4C, 0xEE, 0xF4, 0xE6, 0xA7, 0x48,
+    0x04, 0xE6, 0x00, 0xE3, 0x08, 0xDB, 0x7E, 0xF2, 0x9A, 0xD0, 0xBF, 0x38, 0x7A, 0xE0, 0xA3, 0x32,
+    0xBB, 0x4A, 0x3D, 0xBF, 0xA4, 0x82, 0x9F, 0xD9, 0x5C, 0x35, 0x47, 0x9F, 0x87, 0xD3, 0x18, 0xCC,
+    0x03, 0x3B, 0xF9, 0x6D, 0xCD, 0xD3, 0x95, 0x79, 0xDC, 0x67, 0x77, 0x79, 0x25, 0x0E, 0x72, 0x5B,
+    0x24, 0xAA, 0xCA, 0xBC, 0x71, 0x48, 0x34, 0x07, 0xC8, 0x30, 0x3E, 0xF6, 0x37, 0x62, 0xBE, 0xAF,
+    0x80, 0xC2, 0xC1, 0xEC, 0x42, 0x1A, 0x1B, 0x07, 0x53, 0xF1, 0x0C, 0x51, 0x4C, 0xDF, 0x2B, 0xEC,
+    0xBB, 0xE3, 0xE9, 0x44, 0x44, 0x82, 0x21, 0x0D, 0xD8, 0x95, 0xFC, 0x67, 0xE2, 0xC4, 0x56, 0xDC,
+    0xE3, 0xEF, 0x82, 0x8D, 0xD5, 0xC4, 0xB9, 0xCB, 0x47, 0x4F, 0xD1, 0x08, 0x66, 0x91, 0xCC, 0x68,
+    0x40, 0x38, 0x2D, 0x78, 0x17, 0x4D, 0xD9, 0xD3, 0x96, 0x16, 0x4D, 0xFD, 0xE9, 0xB5, 0x8E, 0x89,
+    0xDF, 0xEF, 0xD8, 0x10, 0x2A, 0x70, 0x28, 0x73, 0x82, 0x26, 0xC0, 0x75, 0xC5, 0x00, 0x64, 0x14,
+    0x03, 0x9C, 0x07, 0x28, 0x3A, 0xA2, 0x15, 0xD3, 0xAF, 0x98, 0xD6, 0x81, 0x69, 0x8D, 0x77, 0x1B,
+    0x38, 0x04, 0x10, 0x44, 0x03, 0x10, 0xC1, 0x94, 0x3A, 0x24, 0xF2, 0xB6, 0x54, 0xE8, 0x6A, 0x26,
+    0xF4, 0x7A, 0xA3, 0xBF, 0x65, 0x40, 0x03, 0xBB, 0x90, 0x0A, 0x89, 0xC0, 0x66, 0x47, 0xE8, 0x02,
+    0xE2, 0xE5, 0x3D, 0xCF, 0x34, 0x40, 0x48, 0x9C, 0xA8, 0x83, 0x96, 0xBD, 0xC1, 0x1E, 0xF1, 0xC9,
+    0x23, 0x5E, 0x38, 0xD0, 0xE2, 0x43, 0x2A, 0x21, 0x69, 0x0E, 0xD0, 0x63, 0x6E, 0x1D, 0xC1, 0x97,
+    0x51, 0x8E, 0x4D, 0xBD, 0x6F, 0xE2, 0x35, 0xBD, 0x3B, 0x80, 0xD1, 0xCA, 0xE5, 0xC7, 0xB0, 0x69,
+    0x9D, 0x55, 0x4F, 0x8E, 0x79, 0x13, 0x41, 0x3B, 0xE1, 0x6D, 0xFE, 0xA6, 0xA3, 0x1F, 0xDB, 0x56,
+    0xD3, 0xB6, 0x12, 0xD3, 0x46, 0x22, 0xC0, 0xB6, 0x5C, 0xAD, 0x98, 0x90, 0x1E, 0x68, 0x66, 0x43,
+    0x0E, 0x47, 0x03, 0x87, 0x95, 0x03, 0x22, 0x66, 0xE9, 0xB5, 0xBA, 0xA3, 0x81, 0xA1, 0xEC, 0xC1,
+    0xF9, 0xE5, 0x3D, 0x4D, 0x71, 0xA1, 0xE7, 0x40, 0x97, 0x4E, 0x34, 0x99, 0x44, 0x33, 0x84, 0x24,
+    0x47, 0x4F, 0x7A, 0x25, 0xDD, 0x8D, 0x5E, 0xC8, 0x27, 0x91, 0x6D, 0x13, 0x01, 0x85, 0xA6, 0x64,
+    0xCF, 0x74, 0x3F, 0xDD, 0x8C, 0x46, 0x93, 0x12, 0x62, 0x5A, 0x92, 0x52, 0xC8, 0xF3, 0x68, 0xEE,
+    0x9D, 0x35, 0x1C, 0x28, 0x1C, 0xF5, 0xBE, 0xFF, 0xB5, 0xFA, 0xA6, 0x81, 0x14, 0x41, 0x0F, 0x0E,
+    0x44, 0xEB, 0x1F, 0x3B, 0x10, 0x1B, 0xFB, 0xA0, 0xB3, 0xD7, 0x0F, 0x5D, 0x99, 0xAF, 0xB6, 0xC2,
+    0x6B, 0xCB, 0xB5, 0x2E, 0x81, 0xCD, 0x6F, 0x66, 0xB2, 0x8F, 0xD6, 0x11, 0xD9, 0x3C, 0x7D, 0xF6,
+    0x07, 0xD7, 0x95, 0x82, 0xD4, 0xB7, 0xD2, 0xD6, 0x68, 0x02, 0xA2, 0x55, 0x07, 0xF4, 0xE7, 0x1B,
+    0x44, 0x0B, 0x74, 0x06, 0x27, 0x22, 0x5A, 0x57, 0xC4, 0x28, 0x5F, 0xA1, 0x60, 0x68, 0x64, 0x80,
+    0x3F, 0x73, 0x12, 0x07, 0x46, 0xED, 0x47, 0x4B, 0xEB, 0x02, 0xED, 0xF0, 0x21, 0x51, 0xFB, 0x58,
+    0xD7, 0x80, 0xBE, 0x59, 0xDB, 0x89, 0x26, 0xC2, 0x6B, 0x70, 0xE6, 0xB5, 0x49, 0x89, 0x70, 0xD4,
+    0x56, 0x6D, 0x8D, 0x0E, 0x85, 0x45, 0x0C, 0x5D, 0x47, 0x4B, 0x15, 0xEA, 0xEC, 0x15, 0x17, 0x81,
+    0xF8, 0xD8, 0xE2, 0x16, 0xD8, 0x3F, 0x0E, 0x15, 0x5B, 0xCC, 0x03, 0xD7, 0x88, 0x0F, 0x38, 0xBC,
+    0x9C, 0xB7, 0xE2, 0x14, 0xBD, 0x43, 0x03, 0x89, 0x37, 0xBA, 0x86, 0xD9, 0xCA, 0xF2, 0xC1, 0xEA,
+    0x41, 0xCF, 0xAF, 0xB9, 0xCE, 0x83, 0x6E, 0x71, 0x6B, 0x37, 0x9E, 0xA5, 0x94, 0xA4, 0xA1, 0xDE,
+    0x7E, 0x52, 0x67, 0xF5, 0xE3, 0x3B, 0xA3, 0xD5, 0xFB, 0x22, 0x0A, 0x37, 0x13, 0x23, 0xCA, 0x1E,
+    0x6B, 0x57, 0xC8, 0xCE, 0x9F, 0xE9, 0x18, 0xC4, 0x34, 0xDE, 0x1E, 0xD7, 0x70, 0xB9, 0x96, 0x6F,
+    0xBA, 0x90, 0xB3, 0xD2, 0x06, 0xC6, 0x06, 0x44, 0xD7, 0xB1, 0x6B, 0xB2, 0x87, 0xBC, 0xC4, 0xB0,
+    0x09, 0xE3, 0xB6, 0x13, 0x32, 0x7C, 0xB2, 0xF0, 0x66, 0xBA, 0x70, 0xE4, 0x54, 0x62, 0xB1, 0xD5,
+    0x72, 0x4F, 0x1F, 0x18, 0x72, 0x2F, 0x87, 0x73, 0x5A, 0xA9, 0xAD, 0xCE, 0x9E, 0x13, 0x40, 0xCB,
+    0xA2, 0xDB, 0xB1, 0xD8, 0xB8, 0x96, 0xD3, 0x74, 0x1A, 0xA6, 0x07, 0xBD, 0x13, 0xF6, 0x06, 0x99,
+    0xD5, 0x3B, 0xC9, 0xF2, 0x18, 0xA3, 0xC6, 0xE3, 0x42, 0x1A, 0x31, 0x4F, 0xC8, 0x13, 0xE6, 0x8A,
+    0x72, 0xC7, 0x68, 0x77, 0x3C, 0x51, 0x1F, 0xD5, 0x2C, 0x80, 0x40, 0x09, 0x4B, 0x2A, 0x74, 0x28,
+    0x02, 0x1D, 0x4F, 0x0E, 0xFE, 0x83, 0x1C, 0xA8, 0x21, 0x2A, 0xE7, 0xD9, 0x2C, 0xBE, 0x4A, 0xE6,
+    0x79, 0x37, 0x09, 0x86, 0x99, 0xD3, 0x91, 0xA7, 0x25, 0xFB, 0x1C, 0x6A, 0x73, 0xBC, 0x5E, 0x7C,
+    0x04, 0xD6, 0x1A, 0xAE, 0x97, 0x37, 0x27, 0xA8, 0xC0, 0xEB, 0xEE, 0x97, 0x64, 0x45, 0x5F, 0x33,
+    0xE1, 0xFB, 0x7A, 0x41, 0xB0, 0xCA, 0xAE, 0x86, 0xFC, 0x33, 0x65, 0x5B, 0x8F, 0x14, 0x10, 0xA1,
+    0xEE, 0x55, 0xAD, 0xD6, 0x1D, 0xA9, 0x35, 0xB8, 0x50, 0x76, 0xCA, 0x39, 0x50, 0x90, 0x4E, 0xCB,
+    0x41, 0xCD, 0x37, 0x8D, 0x9F, 0x59, 0x46, 0x48, 0x0B, 0x80, 0x92, 0xD0, 0x07, 0x0B, 0xC0, 0x1E,
+    0x76, 0x33, 0xAA, 0x77, 0x93, 0xCC, 0x28, 0x38, 0x0D, 0xB4, 0x60, 0xF0, 0xC0, 0x2E, 0xAA, 0x3A,
+    0x40, 0x51, 0xF4, 0xDA, 0x62, 0x4E, 0xF9, 0x90, 0x9F, 0x83, 0x73, 0xFA, 0x6C, 0x61, 0x4F, 0x29,
+    0x4D, 0x42, 0x8A, 0x01, 0xBB, 0xED, 0x0E, 0xB0, 0x06, 0xBF, 0x03, 0xD6, 0x54, 0xCB, 0xAA, 0x99,
+    0xEB, 0x7E, 0x2F, 0x2A, 0x08, 0xD0, 0x95, 0x1A, 0x90, 0x97, 0xF7, 0x3C, 0x24, 0x68, 0x53, 0x4E,
+    0x19, 0x39, 0x0C, 0xD1, 0xC9, 0x66, 0xB0, 0x28, 0x65, 0xA8, 0xA1, 0x0E, 0x65, 0xD3, 0x1A, 0x96,
+    0x53, 0xDC, 0x45, 0x4A, 0x16, 0xDA, 0x8C, 0xF8, 0xD3, 0xF6, 0xB8, 0x8B, 0xCA, 0x0C, 0xE2, 0x0E,
+    0xCC, 0xCB, 0xAA, 0x60, 0x4A, 0x2A, 0x6F, 0x20, 0x1F, 0x9A, 0x2D, 0x2F, 0xE5, 0xAA, 0x12, 0xCF,
+    0x81, 0x45, 0x5B, 0x56, 0x88, 0x6E, 0xAB, 0x10, 0x25, 0xEA, 0x0C, 0xBA, 0x4A, 0x58, 0x2B, 0xD2,
+    0x05, 0x5D, 0xA9, 0x38, 0x49, 0x25, 0xCA, 0x26, 0x78, 0x6B, 0xF9, 0xE3, 0x4A, 0x37, 0x4F, 0xE6,
+    0x9C, 0x70, 0xA8, 0xB6, 0xDF, 0x60, 0x5B, 0xFA, 0x88, 0x6D, 0xDD, 0xB7, 0xB0, 0xED, 0x54, 0x6D,
+    0x9B, 0xF7, 0xB6, 0x51, 0x14, 0x11, 0xFC, 0x51, 0xE9, 0x28, 0x95, 0x69, 0x09, 0x4A, 0x65, 0x5F,
+    0x35, 0x54, 0xAD, 0x92, 0x63, 0x3F, 0xD3, 0x35, 0x0F, 0xD7, 0x3E, 0x15, 0xB9, 0x02, 0x33, 0x5E,
+    0x2B, 0xA2, 0xA1, 0xA9, 0x57, 0x0E, 0x65, 0x71, 0x88, 0x99, 0xA3, 0x89, 0x53, 0x40, 0xC5, 0xC0,
+    0xDE, 0xB2, 0x8F, 0x59, 0x53, 0xF6, 0x4A, 0x48, 0xC0, 0x3E, 0x52, 0x46, 0x34, 0x51, 0xA3, 0xD8,
+    0x78, 0x0A, 0xF4, 0xC7, 0x0A, 0x25, 0xD4, 0x87, 0x9F, 0x4E, 0xB8, 0xF7, 0x4C, 0xBA, 0x25, 0x8A,
+    0x32, 0x01, 0xDC, 0xC3, 0x12, 0xE3, 0x96, 0x28, 0x04, 0x12, 0x59, 0xD5, 0x82, 0x66, 0x5B, 0x7B,
+    0x82, 0x8A, 0xF8, 0xC6, 0xAB, 0x60, 0x5A, 0xA1, 0x8E, 0x04, 0x0E, 0x57, 0x7D, 0x08, 0xDF, 0xCD,
+    0x3C, 0x70, 0x7D, 0xAA, 0xB5, 0x10, 0x77, 0x4F, 0x4C, 0xD0, 0x8D, 0xBE, 0x8E, 0x59, 0x67, 0x63,
+    0x9C, 0xFC, 0x88, 0xC0, 0xA0, 0x4D, 0x2C, 0x96, 0x2D, 0xA4, 0x74, 0x3A, 0xC4, 0x91, 0xA2, 0x5D,
+    0xC0, 0x1B, 0x0E, 0x4B, 0x1C, 0xB2, 0x0E, 0x00, 0xDB, 0xEA, 0xCA, 0x0A, 0x81, 0xB5, 0x2D, 0x97,
+    0x69, 0xD0, 0xAF, 0x68, 0xD0, 0x6F, 0xF9, 0x11, 0xE7, 0xFF, 0x37, 0x72, 0xD8, 0x67, 0xEC, 0xEE,
+    0x2E, 0x49, 0x85, 0xB6, 0x31, 0x91, 0xD1, 0x6C, 0x1A, 0x9F, 0xCC, 0x85, 0x81, 0xB8, 0x06, 0x1A,
+    0xEB, 0x06, 0x7D, 0x23, 0x31, 0x29, 0x0E, 0x2C, 0x4E, 0x05, 0x46, 0x6A, 0x1D, 0x4F, 0x9C, 0x81,
+    0x5D, 0x18, 0x8F, 0x00, 0xBF, 0x70, 0x16, 0xDE, 0x27, 0x9C, 0xC7, 0xE2, 0x91, 0xCB, 0xEE, 0xC6,
+    0xE4, 0x91, 0xCB, 0xEE, 0xE6, 0xE4, 0xC9, 0xFC, 0x7F, 0x1A, 0x3C, 0xA2, 0xE0, 0x6E, 0xF5, 0x9E,
+    0x4B, 0xBE, 0x5B, 0xAD, 0xC7, 0xC4, 0xDC, 0xB5, 0x50, 0x73, 0x31, 0x89, 0x04, 0xD5, 0x80, 0xEB,
+    0xB2, 0x02, 0x5D, 0x21, 0x9F, 0xC9, 0x35, 0xF5, 0x18, 0x4F, 0x83, 0x66, 0xBB, 0xA6, 0x1D, 0xA2,
+    0x09, 0x17, 0xA2, 0x23, 0xCC, 0xB7, 0x18, 0x12, 0x95, 0x73, 0x44, 0x4C, 0x46, 0x4C, 0x46, 0x3C,
+    0x92, 0x4F, 0x5B, 0xBA, 0x32, 0xD6, 0x62, 0xD5, 0x3C, 0x7E, 0xD2, 0x75, 0xCC, 0xA0, 0x35, 0x79,
+    0xD4, 0x55, 0xA3, 0x2A, 0xF0, 0xFB, 0xB4, 0xD3, 0x7D, 0x41, 0x93, 0xFD, 0x0D, 0xF5, 0x7F, 0x83,
+    0x68, 0xA4, 0xA2, 0xDD, 0x4F, 0x5A, 0xA2, 0x06, 0xA3, 0x00, 0x56, 0x6D, 0xAA, 0xFE, 0x26, 0xB9,
+    0x03, 0x42, 0x4B, 0x64, 0xE0, 0x4D, 0xC9, 0x51, 0xFD, 0x21, 0x98, 0xD9, 0x39, 0xA3, 0x47, 0xD0,
+    0xA6, 0x1C, 0x27, 0x11, 0x5D, 0xBB, 0xA9, 0xBC, 0x6F, 0x1E, 0x51, 0x06, 0xBA, 0x4E, 0x64, 0x98,
+    0x95, 0x88, 0x8F, 0x24, 0x08, 0x11, 0xDF, 0xC7, 0xA5, 0x9D, 0x8A, 0x25, 0xAF, 0x95, 0x20, 0x4A,
+    0x51, 0xBE, 0x53, 0x4E, 0xDB, 0xBA, 0x80, 0x5D, 0x2B, 0x86, 0x0F, 0xCA, 0x4D, 0xAF, 0x7B, 0xBD,
+    0xDE, 0xC4, 0x62, 0xB8, 0x5E, 0x5F, 0xCE, 0xDE, 0x62, 0xC7, 0x23, 0xBB, 0x1B, 0x54, 0x98, 0xAE,
+    0xE5, 0xAA, 0xBF, 0xBE, 0x13, 0x70, 0x33, 0x70, 0x5A, 0x2C, 0xA7, 0x53, 0x39, 0x52, 0xEA, 0xE7,
+    0x48, 0x5E, 0xC4, 0x3E, 0xC4, 0x65, 0x83, 0x0F, 0x71, 0xB5, 0x8C, 0x3A, 0xD6, 0xFA, 0x4F, 0x14,
+    0xE7, 0xC1, 0x8A, 0x47, 0x85, 0xC3, 0xE2, 0x7D, 0x2F, 0xD7, 0x0F, 0x1C, 0x72, 0xB4, 0xB0, 0x3B,
+    0xA8, 0x22, 0xC4, 0x66, 0xB7, 0xC8, 0x14, 0x05, 0x47, 0x2A, 0xBF, 0x45, 0x45, 0x58, 0x54, 0x43,
+    0xB0, 0x51, 0x09, 0x08, 0x92, 0x80, 0x43, 0x13, 0x36, 0xEA, 0xDF, 0x4C, 0x85, 0x1F, 0x9A, 0x19,
+    0x18, 0x88, 0x1A, 0x96, 0x7C, 0x58, 0x17, 0xF4, 0xD9, 0x7E, 0x5C, 0xAB, 0x0B, 0x5F, 0xD2, 0x1D,
+    0x40, 0x79, 0xA5, 0x22, 0x95, 0x30, 0xCD, 0xEA, 0xF6, 0x90, 0x62, 0x9C, 0x8A, 0x1E, 0x4C, 0xBB,
+    0xAF, 0x7E, 0x8E, 0xBE, 0x26, 0x5D, 0xC7, 0xA5, 0x84, 0xC4, 0xB3, 0x47, 0x42, 0xEB, 0xD1, 0x55,
+    0xE9, 0x3E, 0x66, 0x0E, 0x75, 0x62, 0x27, 0x8B, 0xB2, 0x29, 0x6A, 0x05, 0x3C, 0x05, 0x69, 0x8A,
+    0xC9, 0xD1, 0x57, 0x30, 0x1D, 0xF5, 0x8A, 0xDE, 0x32, 0x74, 0x97, 0xE1, 0xEE, 0x02, 0x1A, 0xEA,
+    0x1B, 0xAA, 0x2F, 0xFF, 0x61, 0xE4, 0x51, 0xC0, 0x49, 0xB0, 0x76, 0xC8, 0x17, 0x78, 0xED, 0xE0,
+    0xB6, 0x92, 0x5B, 0x07, 0xD2, 0x51, 0x1D, 0x16, 0x33, 0xB9, 0x2A, 0xC7, 0xC2, 0x00, 0x90, 0xBA,
+    0xED, 0xFB, 0xB8, 0x26, 0x5D, 0x8C, 0xFF, 0xB4, 0x3A, 0xCC, 0xBF, 0xCB, 0x4D, 0xDC, 0xAD, 0xA0,
+    0x76, 0x3B, 0xDF, 0x96, 0x70, 0x17, 0xCD, 0x0A, 0xB7, 0x9C, 0xDC, 0x53, 0x12, 0x18, 0x16, 0x6B,
+    0xE2, 0x55, 0xB4, 0xEB, 0xEA, 0x53, 0x94, 0xD1, 0x79, 0x13, 0x60, 0xB9, 0x28, 0x97, 0x1F, 0x50,
+    0xA9, 0x4F, 0xC2, 0xE2, 0x37, 0xA8, 0x54, 0xF5, 0x15, 0x9A, 0x4B, 0x51, 0x16, 0xF3, 0xD2, 0xBC,
+    0x2D, 0x0B, 0x56, 0xF3, 0x26, 0x4B, 0x3D, 0xEE, 0x18, 0x24, 0x92, 0xF4, 0xEF, 0x10, 0xED, 0x19,
+    0x29, 0x56, 0x60, 0xE9, 0xCA, 0x1C, 0x66, 0xA0, 0x31, 0xB0, 0xED, 0x53, 0x46, 0x3B, 0x5B, 0xB5,
+    0xBE, 0xED, 0x11, 0x47, 0x7B, 0x8E, 0x8A, 0x5B, 0x12, 0xA8, 0x85, 0x80, 0xAA, 0x12, 0x79, 0x68,
+    0x60, 0x38, 0xF4, 0x8D, 0x2B, 0x2A, 0xC2, 0x55, 0xC1, 0x8E, 0xBA, 0x09, 0xF2, 0x6D, 0xD1, 0x38,
+    0x10, 0x8D, 0x33, 0xD1, 0x08, 0x20, 0xCA, 0x07, 0x6C, 0x08, 0x44, 0x12, 0x99, 0x42, 0x32, 0x1F,
+    0x75, 0x7E, 0x5C, 0x8B, 0x70, 0x7E, 0xE5, 0x61, 0x7E, 0x9D, 0x06, 0x9C, 0xA4, 0xC6, 0x58, 0x43,
+    0xE1, 0xC5, 0x44, 0x82, 0x4C, 0x50, 0xA5, 0xCD, 0x0D, 0xAD, 0xF8, 0x11, 0x13, 0x37, 0x84, 0x52,
+    0xDD, 0x9F, 0xC3, 0xAB, 0xF8, 0xE2, 0x5D, 0xEE, 0x8C, 0x0C, 0xBA, 0x8B, 0x14, 0x37, 0x92, 0xB6,
+    0x5D, 0x24, 0xB3, 0x75, 0x13, 0x45, 0x29, 0xCB, 0x44, 0x73, 0xC0, 0xE6, 0x63, 0xCA, 0xC3, 0x03,
+    0xFA, 0x6D, 0x3C, 0xD2, 0x6F, 0x7D, 0x8C, 0x91, 0x6B, 0x0F, 0xFA, 0x76, 0xAD, 0x34, 0xDC, 0x83,
+    0x78, 0x9B, 0x62, 0x75, 0x89, 0x82, 0xD5, 0xB7, 0xDF, 0xD2, 0x5F, 0xC0, 0xDD, 0x0E, 0x0E, 0xC2,
+    0x22, 0x20, 0xA3, 0x35, 0x18, 0x0E, 0x62, 0x8A, 0x35, 0x1F, 0xCF, 0x64, 0xF4, 0x7F, 0x4E, 0x4A,
+    0x2D, 0x64, 0xDE, 0x40, 0x76, 0x8E, 0xF7, 0x6C, 0x4F, 0xCC, 0x77, 0x30, 0x05, 0x25, 0x83, 0x04,
+    0x5A, 0x6A, 0x96, 0x8C, 0xDB, 0x80, 0xEB, 0xEE, 0xD9, 0xBA, 0x99, 0xB9, 0xFA, 0x6B, 0xF9, 0x4F,
+    0xFE, 0x72, 0x8F, 0xF8, 0xCB, 0x98, 0xC9, 0x0E, 0x28, 0x58, 0xBB, 0xC9, 0x4F, 0x8E, 0xAF, 0x63,
+    0x35, 0x4B, 0xDD, 0xF3, 0x81, 0x7C, 0x45, 0x52, 0x80, 0xEE, 0xA8, 0x03, 0x89, 0xA6, 0xE2, 0x16,
+    0x20, 0xBC, 0xE7, 0x1B, 0x8D, 0x2C, 0x17, 0xCA, 0x18, 0x04, 0x27, 0x06, 0x56, 0x94, 0x6D, 0x54,
+    0x40, 0xE9, 0x5D, 0xDB, 0xE9, 0x5D, 0x46, 0x99, 0xA5, 0x0C, 0x71, 0xCE, 0x26, 0x8D, 0xB4, 0x26,
+    0xC6, 0x3A, 0x28, 0x87, 0x9C, 0x39, 0xE0, 0x31, 0x80, 0xD2, 0xEF, 0x0E, 0x20, 0x63, 0xC9, 0x30,
+    0x12, 0x32, 0x65, 0x82, 0xD3, 0xC1, 0x0E, 0x90, 0x50, 0x5D, 0xAE, 0xFB, 0x96, 0x38, 0x46, 0xDF,
+    0x14, 0xA3, 0x6E, 0xE4, 0x6C, 0x7B, 0x97, 0x1F, 0x46, 0x89, 0x5E, 0xC0, 0xFD, 0x09, 0xD7, 0x6F,
+    0x17, 0xF6, 0xB1, 0xA4, 0x68, 0xA8, 0x99, 0x8E, 0xDC, 0x0D, 0x33, 0xF2, 0xB1, 0x6A, 0x27, 0x5D,
+    0xCD, 0xA1, 0x61, 0xE5, 0x4E, 0xA0, 0xD3, 0x03, 0x26, 0xE4, 0xD9, 0x48, 0x13, 0x27, 0x4C, 0xDD,
+    0x93, 0xCB, 0x6B, 0x33, 0x23, 0x08, 0xB7, 0xDF, 0x07, 0x93, 0x94, 0x5F, 0x30, 0x8C, 0xDD, 0x33,
+    0xC7, 0xAB, 0xD2, 0xC7, 0xEC, 0xDD, 0x1D, 0x55, 0x92, 0x79, 0x49, 0xB7, 0x4A, 0x32, 0xEC, 0x2B,
+    0xC9, 0xB0, 0xAF, 0x24, 0x9C, 0x3B, 0x88, 0x51, 0x2B, 0x49, 0x9C, 0x7F, 0xAC, 0x24, 0x13, 0xFA,
+    0xAA, 0x1E, 0x5E, 0xA7, 0xCC, 0x07, 0x9C, 0xF3, 0x33, 0x43, 0x8F, 0xCF, 0x58, 0x8D, 0x2E, 0x91,
+    0xED, 0x53, 0x85, 0xDE, 0xD1, 0xBA, 0xEC, 0x68, 0x09, 0x63, 0x8F, 0x53, 0x60, 0x15, 0x5B, 0xDB,
+    0xCE, 0x47, 0x1A, 0x77, 0x11, 0xE1, 0xCD, 0x2C, 0xBE, 0x33, 0xC7, 0x2D, 0x1E, 0xAD, 0x06, 0x94,
+    0x0A, 0xE5, 0x5E, 0xF6, 0x99, 0xAB, 0x40, 0xBB, 0x07, 0xB2, 0x3D, 0xEE, 0xD5, 0x24, 0xD5, 0x93,
+    0x75, 0x47, 0x5D, 0x77, 0xC2, 0xA1, 0x8F, 0x28, 0xEE, 0xA0, 0xED, 0xA6, 0x17, 0xE6, 0xCB, 0x45,
+    0x84, 0xEA, 0x7E, 0x83, 0xB8, 0xDD, 0xA0, 0x7A, 0x3B, 0xEE, 0x5F, 0x37, 0x14, 0x58, 0x27, 0x9C,
+    0x2E, 0xC1, 0xC1, 0x5A, 0x77, 0x8C, 0x90, 0x69, 0x2D, 0x78, 0x08, 0x38, 0xC1, 0x31, 0x12, 0x1C,
+    0x44, 0x88, 0x2E, 0x95, 0x1D, 0x1B, 0xA8, 0x90, 0xFA, 0x3D, 0xDD, 0xEC, 0xB8, 0xCB, 0xE6, 0x35,
+    0x68, 0x94, 0xB9, 0x0C, 0xB1, 0x92, 0x40, 0xA5, 0xCD, 0x11, 0x27, 0xA8, 0x1C, 0x01, 0xAA, 0x3B,
+    0xF0, 0x07, 0x2B, 0xFE, 0x00, 0x4C, 0xBF, 0xBB, 0xE8, 0xEE, 0x6C, 0xF9, 0x57, 0x28, 0xE0, 0x3B,
+    0xBD, 0x2A, 0x3E, 0x0A, 0x3E, 0x4E, 0xA7, 0x90, 0xA8, 0xF6, 0x5C, 0x63, 0x07, 0xAE, 0x8E, 0xDC,
+    0x00, 0xDD, 0x1C, 0xEA, 0x81, 0xBD, 0x08, 0x6A, 0x91, 0xBB, 0x21, 0x10, 0x37, 0xEE, 0xDD, 0xFB,
+    0x88, 0xA0, 0xBB, 0xF9, 0xE5, 0xE0, 0x2B, 0xF7, 0xE7, 0x2F, 0x07, 0x68, 0xBD, 0x5B, 0xEF, 0xFF,
+    0x0B, 0xF9, 0x71, 0xE7, 0xE6, 0xD7, 0x98, 0xF2, 0xDD, 0x97, 0xBE, 0x06, 0x63, 0x4B, 0x0A, 0xA2,
+    0xB6, 0x0B, 0x57, 0x88, 0x16, 0x48, 0x0A, 0xDA, 0x42, 0xAC, 0x0E, 0xA9, 0xEA, 0x2B, 0x2E, 0x84,
+    0x23, 0x0B, 0x74, 0x5C, 0xDB, 0x7F, 0xCE, 0x6A, 0xF4, 0xB5, 0x7A, 0x7E, 0x34, 0x71, 0xDB, 0x9D,
+    0xEF, 0xE8, 0x7E, 0x7E, 0x94, 0xA3, 0x8E, 0xEE, 0xF6, 0x77, 0xC8, 0xFB, 0x70, 0x44, 0x46, 0xCA,
+    0xD1, 0x0D, 0x21, 0x47, 0x71, 0xA0, 0x06, 0x1B, 0x5A, 0xBC, 0xF9, 0x89, 0xE4, 0x10, 0xD4, 0xE1,
+    0xE0, 0x13, 0xAB, 0x6A, 0xF7, 0x3D, 0x3C, 0x57, 0xAA, 0xDA, 0xFD, 0xC7, 0x41, 0xED, 0x76, 0x1C,
+    0x32, 0xAC, 0x9B, 0x7A, 0xD9, 0x7E, 0xBF, 0x56, 0x13, 0xBB, 0xD8, 0x36, 0x5C, 0x2F, 0xC5, 0x09,
+    0x54, 0x0F, 0x94, 0x33, 0x0A, 0x78, 0x24, 0x06, 0x77, 0xD9, 0xCD, 0x2B, 0x94, 0xA3, 0x18, 0x88,
+    0xE2, 0x8B, 0xEF, 0x93, 0xD3, 0xF8, 0xA2, 0x04, 0x65, 0x68, 0x5E, 0x2A, 0xCF, 0x5F, 0xD1, 0x3D,
+    0x22, 0x16, 0xEB, 0x5A, 0x37, 0x86, 0x2F, 0x5E, 0x8E, 0x1B, 0x6B, 0x04, 0x25, 0xDE, 0x4B, 0xA6,
+    0x75, 0x83, 0xEC, 0xBF, 0x93, 0xFA, 0xCF, 0x9F, 0x9D, 0x71, 0xB5, 0xAE, 0x29, 0x85, 0xF1, 0x1A,
+    0xFC, 0x8D, 0xCF, 0x5B, 0xDC, 0x75, 0xC7, 0xCC, 0xD7, 0x53, 0xAD, 0xA7, 0x31, 0x99, 0xD3, 0x29,
+    0xC7, 0x02, 0xB8, 0x6C, 0x6D, 0x70, 0xD5, 0x73, 0xC6, 0xBC, 0x93, 0x75, 0xBB, 0xA9, 0x68, 0xD3,
+    0xD1, 0x86, 0xBC, 0x87, 0xBA, 0xC7, 0xD2, 0xD8, 0xDE, 0x46, 0x98, 0x6F, 0xCE, 0xE6, 0xB9, 0x17,
+    0x2F, 0x9B, 0x64, 0x2E, 0xF5, 0x1F, 0x29, 0x90, 0x26, 0x4C, 0xE2, 0x8A, 0xAB, 0x09, 0x7B, 0x03,
+    0xBE, 0x4F, 0x47, 0xF3, 0x1C, 0x6C, 0xB8, 0xA8, 0x3F, 0x2B, 0xE8, 0x5A, 0xFD, 0x41, 0x18, 0x30,
+    0x8F, 0x86, 0x3F, 0x17, 0xCC, 0x85, 0xC8, 0x4D, 0x17, 0x35, 0x7F, 0x20, 0x53, 0xAC, 0x16, 0x8C,
+    0x8E, 0x75, 0xA3, 0x94, 0xDB, 0xAC, 0x1C, 0xAE, 0x7F, 0x49, 0x2E, 0xE8, 0x56, 0x86, 0xFE, 0xCF,
+    0x83, 0x6B, 0x19, 0x7A, 0x84, 0xA2, 0xAF, 0x88, 0xA7, 0x92, 0xA7, 0x16, 0xC2, 0xE5, 0x95, 0xD3,
+    0xAF, 0x74, 0xB9, 0x54, 0xAA, 0xD8, 0xD7, 0x34, 0xE7, 0xF2, 0xA7, 0x55, 0xB2, 0x60, 0xB2, 0xA7,
+    0x2A, 0xDD, 0x19, 0x52, 0x56, 0x3D, 0x90, 0x2D, 0x79, 0x4A, 0x37, 0x47, 0x75, 0xFF, 0x47, 0x54,
+    0xC7, 0xEC, 0xE2, 0x49, 0x45, 0xB8, 0xEA, 0x79, 0x1D, 0x5C, 0xA3, 0x1D, 0x74, 0x0E, 0x24, 0x25,
+    0x63, 0x7E, 0x20, 0xBF, 0xF0, 0x0C, 0x99, 0xA2, 0x1B, 0x68, 0x48, 0x89, 0x4A, 0x17, 0x9F, 0x37,
+    0x9B, 0xF8, 0x82, 0x45, 0xBA, 0x6C, 0x92, 0x0F, 0xB5, 0x53, 0x79, 0x4F, 0xFF, 0x51, 0xD2, 0x57,
+    0xF3, 0x61, 0x23, 0x2F, 0x12, 0x10, 0x2C, 0xCA, 0xB4, 0x4C, 0x72, 0xBF, 0x9E, 0x42, 0x8C, 0xB8,
+    0x81, 0x14, 0x23, 0xF0, 0x54, 0xFC, 0x2A, 0xE9, 0xD0, 0xB0, 0x74, 0x51, 0x0E, 0xA3, 0x45, 0x9D,
+    0x5A, 0xC4, 0x7E, 0x74, 0x81, 0xA7, 0x16, 0xB1, 0xBB, 0xE2, 0x60, 0x58, 0xA3, 0xAC, 0x47, 0xFB,
+    0x56, 0xC3, 0x6C, 0xB7, 0x93, 0xC3, 0xE0, 0xEB, 0xC2, 0xDE, 0xEB, 0xE9, 0x52, 0xD4, 0x48, 0x2A,
+    0xD6, 0x56, 0x7C, 0x1F, 0x0B, 0xB6, 0x83, 0x45, 0xD5, 0x91, 0x45, 0xB7, 0xA3, 0x45, 0x3F, 0x3A,
+    0x72, 0x93, 0xD6, 0x8F, 0xFF, 0x99, 0x45, 0xD5, 0xA3, 0x16, 0x25, 0xDF, 0xDD, 0xA2, 0x93, 0xD5,
+    0x26, 0xBB, 0x94, 0xED, 0x8A, 0x3C, 0x66, 0xAB, 0x62, 0x4F, 0xD7, 0xE4, 0x44, 0x5F, 0x19, 0xF6,
+    0xF8, 0xDB, 0x10, 0xB8, 0x61, 0x10, 0xB3, 0x8A, 0x28, 0xC4, 0x84, 0x22, 0x0E, 0xC5, 0x44, 0x24,
+    0xBE, 0x18, 0xEB, 0x55, 0xC9, 0x65, 0x4B, 0x44, 0xE3, 0xBA, 0xC3, 0x16, 0xBD, 0xA4, 0x88, 0xD4,
+    0x7F, 0x5F, 0x4D, 0x6B, 0x97, 0x8A, 0x4A, 0x2A, 0x36, 0xC5, 0xE5, 0x5A, 0xB3, 0x74, 0xEF, 0x3E,
+    0x62, 0x33, 0x6E, 0x50, 0xAE, 0xF0, 0x56, 0x7C, 0x12, 0xE0, 0x8A, 0xD0, 0xA8, 0xE7, 0xD2, 0xD5,
+    0xBE, 0xB0, 0xCE, 0x34, 0xE2, 0x74, 0x8F, 0xD4, 0x3D, 0x56, 0xF7, 0x68, 0x3D, 0xC6, 0xEB, 0xC3,
+    0xDE, 0xE8, 0x57, 0x6F, 0xD8, 0x6E, 0xF3, 0x46, 0xBB, 0x7A, 0xC3, 0x6D, 0xDE, 0x88, 0xBB, 0xA3,
+    0xAA, 0x7F, 0xFE, 0xCF, 0xBC, 0xF1, 0x6F, 0x7D, 0x54, 0x31, 0x73, 0xDD, 0x44, 0x10, 0x5E, 0xE9,
+    0x12, 0xAB, 0x50, 0x71, 0x55, 0x60, 0x86, 0xCC, 0x70, 0x2D, 0x63, 0x86, 0xA8, 0xA5, 0x60, 0x38,
+    0x81, 0x0B, 0x0A, 0x0A, 0xDC, 0xB8, 0x36, 0x6D, 0xD2, 0xBC, 0x26, 0x05, 0x0D, 0x39, 0x65, 0xFC,
+    0x03, 0xE2, 0x1F, 0x91, 0x22, 0xE3, 0x86, 0x86, 0x12, 0x9E, 0x0E, 0x53, 0x52, 0x58, 0x03, 0x93,
+    0xA1, 0xA0, 0x88, 0x32, 0xB8, 0x4B, 0xC1, 0x11, 0x54, 0x9C, 0x27, 0xA7, 0xB7, 0x7C, 0x2B, 0x3D,
+    0x05, 0x3B, 0x06, 0xF4, 0x66, 0xD7, 0xEF, 0x9D, 0xF7, 0x76, 0xF7, 0xFB, 0xBE, 0x5D, 0xE9, 0xE7,
+    0xA3, 0xF9, 0x39, 0x99, 0xD3, 0x54, 0xFD, 0x18, 0xAB, 0xA3, 0xC1, 0xEE, 0x05, 0xAB, 0xC2, 0x6E,
+    0x7E, 0x4C, 0xF4, 0x9D, 0xF6, 0x44, 0x09, 0x2E, 0x8B, 0xA6, 0xA1, 0x7C, 0xB0, 0x35, 0xA9, 0x60,
+    0x89, 0x8A, 0xF0, 0x80, 0x4A, 0x66, 0x4E, 0xAF, 0x5D, 0x24, 0xF3, 0x30, 0x12, 0x55, 0x7B, 0x03,
+    0x11, 0x6E, 0x93, 0xC5, 0x59, 0xE7, 0x16, 0xE7, 0xB3, 0x64, 0x24, 0x49, 0x75, 0x39, 0x89, 0x42,
+    0x12, 0x2A, 0xFB, 0xEF, 0x69, 0xFB, 0xE8, 0xD9, 0x76, 0xF8, 0x5C, 0x6E, 0x13, 0xF3, 0x98, 0xF3,
+    0x3A, 0xA9, 0xF1, 0xA3, 0x1B, 0x2A, 0x7D, 0x45, 0x6A, 0xF3, 0x2D, 0xE5, 0x1C, 0x88, 0x78, 0x83,
+    0x0A, 0xDC, 0x51, 0x81, 0x1F, 0x39, 0xEA, 0xAA, 0x33, 0xD8, 0x4F, 0xF1, 0x7E, 0xF1, 0x28, 0xBA,
+    0x3F, 0x38, 0xA0, 0x5C, 0x8F, 0xEB, 0xF5, 0x4E, 0x7B, 0x4E, 0xF4, 0x2E, 0x52, 0x7E, 0x00, 0x7B,
+    0x6F, 0xA9, 0x41, 0xAD, 0x27, 0xD3, 0x28, 0x5C, 0xB5, 0xA4, 0x79, 0xA0, 0x91, 0xCC, 0x2F, 0x31,
+    0x8F, 0x04, 0xE4, 0x05, 0xCE, 0x8E, 0x22, 0xB0, 0xDA, 0xBD, 0x88, 0x16, 0x5D, 0x31, 0xAC, 0x89,
+    0x5C, 0xF9, 0x67, 0x5A, 0x35, 0xEE, 0xF0, 0xF7, 0x97, 0x1C, 0x2C, 0x9F, 0xFD, 0xCA, 0xB1, 0xE2,
+    0xD5, 0xA3, 0xBF, 0x52, 0x11, 0x1D, 0x28, 0x23, 0x1A, 0xAB, 0xD3, 0x44, 0x2A, 0xDA, 0xA3, 0x44,
+    0x65, 0xC0, 0x45, 0x32, 0xDE, 0x7E, 0x36, 0x90, 0xAD, 0xED, 0xE7, 0x81, 0x36, 0xD2, 0x67, 0x9E,
+    0xA8, 0xE2, 0x06, 0xC9, 0xCB, 0x0D, 0x5D, 0x7D, 0x5A, 0x50, 0x05, 0x14, 0x23, 0xBC, 0x01, 0x5E,
+    0x90, 0xF7, 0x5C, 0xBC, 0xF5, 0x97, 0xFC, 0xE9, 0xE4, 0x7F, 0x4B, 0xF2, 0x5F, 0x1E, 0xA6, 0xC8,
+    0x46, 0xAE, 0x8E, 0xC4, 0xA4, 0x98, 0xF3, 0x0D, 0xE9, 0x91, 0x51, 0xBC, 0x0A, 0xEE, 0x59, 0x24,
+    0xDB, 0x57, 0x82, 0xAC, 0xD3, 0x0C, 0x14, 0x7D, 0xC1, 0x35, 0xD9, 0x8B, 0x15, 0xBC, 0x11, 0x09,
+    0x80, 0x97, 0x27, 0xCA, 0x46, 0x03, 0xA1, 0x6E, 0x4E, 0x8C, 0xF7, 0xA6, 0x33, 0xBE, 0xF2, 0x55,
+    0x83, 0x86, 0x69, 0x77, 0x6E, 0x4B, 0x0D, 0xB3, 0xA1, 0xE5, 0x3B, 0x45, 0x4F, 0xF6, 0x45, 0x47,
+    0x8E, 0x5F, 0x0C, 0x3B, 0x8C, 0xFA, 0x8E, 0x87, 0x8C, 0xFB, 0xFD, 0xF2, 0x55, 0x20, 0xF3, 0x32,
+    0x52, 0xF9, 0x43, 0xA2, 0xAC, 0x16, 0x00, 0x98, 0x95, 0x9B, 0x35, 0x12, 0xFA, 0x6B, 0x06, 0x3D,
+    0xE2, 0x62, 0xB7, 0x0E, 0x9F, 0xEE, 0x5F, 0x8B, 0x29, 0xBD, 0x54, 0x15, 0x9C, 0x99, 0x30, 0xA4,
+    0x04, 0x6B, 0x11, 0xA5, 0xBB, 0x20, 0xA8, 0xBB, 0x89, 0x0C, 0xC1, 0x5C, 0x6F, 0xC3, 0xDE, 0x88,
+    0x30, 0xFD, 0xB5, 0x88, 0x5C, 0x5A, 0x2A, 0xD2, 0xF5, 0x88, 0xCB, 0x0F, 0x66, 0x22, 0x97, 0x89,
+    0x8D, 0xA0, 0xA4, 0xA7, 0x6A, 0xB3, 0xFC, 0x21, 0x87, 0x70, 0x77, 0x41, 0x74, 0x1B, 0x43, 0x46,
+    0x2D, 0x0E, 0x4A, 0x61, 0xDE, 0x21, 0x76, 0x27, 0x2E, 0xB3, 0x74, 0xEF, 0xE4, 0xE4, 0xF1, 0x82,
+    0x6A, 0x17, 0xDF, 0x97, 0xA4, 0x97, 0xD1, 0x2E, 0x67, 0xF7, 0xE5, 0x1C, 0xAD, 0xB9, 0x41, 0x44,
+    0xAC, 0x51, 0x67, 0x10, 0x1D, 0x6B, 0xCA, 0x64, 0x9C, 0x45, 0x8C, 0x36, 0x4A, 0xB1, 0x9C, 0x2F,
+    0x64, 0x54, 0xA6, 0x38, 0x89, 0xFF, 0xF2, 0x75, 0xAB, 0x3B, 0x0C, 0x7E, 0x33, 0x96, 0xC9, 0xD7,
+    0x93, 0x94, 0xEE, 0x1C, 0x8A, 0x67, 0x2C, 0x34, 0x28, 0xDC, 0xCF, 0x92, 0x0E, 0x25, 0xF7, 0xA3,
+    0xF1, 0x8E, 0xC3, 0xDA, 0x3E, 0xE4, 0xC3, 0x7E, 0x6D, 0x55, 0xD4, 0xDD, 0x03, 0x57, 0x04, 0xED,
+    0xD7, 0x6B, 0x08, 0xED, 0xC7, 0xB5, 0xEE, 0xAA, 0x26, 0xAD, 0xB5, 0xB7, 0x9F, 0xC2, 0x77, 0x2D,
+    0x06, 0x5C, 0xBF, 0xE2, 0x6F, 0x7A, 0x57, 0xF0, 0x33, 0x6E, 0xEC, 0x27, 0x9B, 0x62, 0xA4, 0x6A,
+    0x62, 0x69, 0x62, 0x8D, 0x8A, 0x4D, 0xFD, 0xB6, 0x97, 0xB2, 0x28, 0x88, 0xC6, 0x64, 0xF0, 0xB2,
+    0x93, 0x63, 0xA1, 0xB8, 0x56, 0x23, 0x8A, 0x17, 0x29, 0x9F, 0xDC, 0x86, 0xCA, 0xA8, 0x46, 0xD2,
+    0x93, 0x1B, 0x40, 0xBB, 0x09, 0xA5, 0x4C, 0xA4, 0x96, 0x81, 0xD4, 0x83, 0xCC, 0x23, 0x86, 0xD2,
+    0x9B, 0x40, 0xCE, 0x57, 0x01, 0x1B, 0x68, 0x7B, 0x42, 0xBD, 0x0E, 0x79, 0x2C, 0x40, 0x93, 0x0D,
+    0xC5, 0x06, 0xC4, 0xAF, 0x92, 0x80, 0x1B, 0xB0, 0x11, 0xD0, 0x61, 0xE2, 0x1D, 0xB3, 0x25, 0xCD,
+    0x4C, 0x03, 0x5C, 0xA3, 0x83, 0x59, 0x44, 0x8B, 0x3E, 0xAC, 0xD0, 0x29, 0x8A, 0x6F, 0x05, 0x47,
+    0x70, 0x06, 0xCD, 0xB1, 0x6B, 0x93, 0x09, 0x27, 0x62, 0x05, 0x98, 0x2C, 0xC3, 0x8C, 0x47, 0x23,
+    0xA9, 0x86, 0xA0, 0x46, 0xC0, 0x48, 0x9A, 0xA7, 0x30, 0x51, 0x1B, 0xF7, 0xEE, 0x3D, 0x91, 0x34,
+    0x2D, 0x52, 0xBA, 0x1A, 0x9B, 0xD0, 0x58, 0xD9, 0x09, 0x6F, 0xBC, 0xEE, 0x74, 0x8F, 0x4F, 0x28,
+    0x43, 0x11, 0x8A, 0x41, 0x81, 0x6B, 0x95, 0xF2, 0x79, 0x17, 0xE5, 0x1D, 0x34, 0x27, 0x90, 0xC2,
+    0x4B, 0x71, 0x95, 0xFE, 0x29, 0x8C, 0xFD, 0xB9, 0x52, 0xDC, 0x74, 0xDB, 0xC2, 0x97, 0x31, 0xD4,
+    0x57, 0x30, 0xBC, 0x85, 0x34, 0x6D, 0x9A, 0x6D, 0x9E, 0xA9, 0x8F, 0x67, 0x90, 0x22, 0xB5, 0x02,
+    0x07, 0x25, 0x44, 0xD0, 0x67, 0x58, 0xEE, 0x2F, 0x3A, 0x6A, 0xCB, 0x9E, 0x92, 0x0A, 0xE8, 0x09,
+    0xDD, 0xE5, 0x83, 0xEE, 0xB2, 0x88, 0xB4, 0x09, 0x5B, 0xFC, 0xE4, 0xD6, 0xC1, 0x81, 0x4C, 0x62,
+    0x8D, 0x29, 0xA5, 0x83, 0xDA, 0x79, 0x28, 0xD0, 0xE3, 0x9D, 0xBC, 0x4F, 0xF4, 0xBE, 0x08, 0xEA,
+    0x91, 0xAB, 0x11, 0x79, 0xFF, 0xB3, 0xBF, 0xB6, 0x01, 0xE5, 0xF8, 0x29, 0x2F, 0x73, 0xD8, 0xED,
+    0x34, 0xEF, 0xD4, 0x04, 0x35, 0xBD, 0x01, 0x55, 0xB8, 0xDE, 0xB6, 0x97, 0xC1, 0xE8, 0x1D, 0xB4,
+    0xBC, 0xFE, 0x9F, 0xE7, 0x2E, 0xDD, 0x41, 0x14, 0x66, 0x60, 0x4A, 0x5D, 0x6D, 0x53, 0x2C, 0x52,
+    0x95, 0x8B, 0x54, 0xFD, 0xDC, 0x99, 0xBC, 0x35, 0x31, 0x23, 0x40, 0xBE, 0x95, 0xCB, 0xFF, 0xAB,
+    0xEA, 0xD2, 0xCD, 0x0A, 0x69, 0x1C, 0xAE, 0x38, 0x00, 0xB9, 0x2B, 0x5B, 0xF3, 0x98, 0x6E, 0x58,
+    0x3E, 0xFE, 0x50, 0x76, 0xF1, 0xEB, 0x15, 0xC7, 0xFD, 0xAC, 0x95, 0x97, 0x09, 0xFD, 0x0D, 0xC5,
+    0x5A, 0x3D, 0x90, 0xDD, 0xD4, 0x15, 0x3E, 0x7A, 0xF2, 0xA2, 0x01, 0x4D, 0x22, 0x0A, 0xBB, 0x21,
+    0x64, 0xD4, 0xA4, 0xC8, 0x30, 0x09, 0x6A, 0x53, 0x18, 0xAE, 0x02, 0x45, 0x0A, 0x0A, 0xB6, 0xD8,
+    0x4D, 0x66, 0x42, 0xE1, 0x26, 0x4D, 0x48, 0x66, 0xB6, 0x4D, 0x01, 0x48, 0x40, 0x49, 0x11, 0x8A,
+    0x4C, 0x1A, 0x9A, 0x14, 0x14, 0xC4, 0x2E, 0xDC, 0xA4, 0x20, 0x33, 0xEC, 0x4A, 0xE0, 0x82, 0xC2,
+    0x45, 0x14, 0x18, 0x86, 0x22, 0x05, 0xC2, 0x84, 0x10, 0x9C, 0xC2, 0xC2, 0x11, 0x83, 0xBC, 0x48,
+    0xBA, 0x7C, 0xDF, 0xB9, 0x92, 0xDE, 0xF3, 0x12, 0x48, 0x98, 0x59, 0xBF, 0x3C, 0x3F, 0xDD, 0xF7,
+    0x56, 0x4F, 0xF7, 0x9C, 0x73, 0xCF, 0x3D, 0x3F, 0xDF, 0x39, 0xD7, 0x12, 0x96, 0x62, 0x6A, 0x31,
+    0x8D, 0x98, 0x4A, 0xE2, 0x5C, 0xDC, 0xEB, 0x49, 0x91, 0x42, 0x64, 0xE4, 0xDB, 0x1B, 0xC4, 0xEF,
+    0xF9, 0x0E, 0x7A, 0x09, 0x3B, 0x89, 0xF0, 0x6E, 0x25, 0x6E, 0x24, 0x69, 0x38, 0xE9, 0x5C, 0x3A,
+    0xCD, 0xE8, 0x44, 0xBC, 0x56, 0xE4, 0x3B, 0x63, 0x2A, 0x85, 0xAD, 0x7C, 0x6B, 0xCB, 0xD0, 0x5E,
+    0x4A, 0x63, 0xDC, 0xC6, 0x83, 0xA4, 0x2D, 0x59, 0x09, 0xA2, 0xBC, 0xF2, 0xE9, 0xC2, 0xF7, 0xAC,
+    0xBE, 0x5F, 0x8C, 0xED, 0x25, 0xC1, 0x15, 0x58, 0x3C, 0x3C, 0xA4, 0x0B, 0x29, 0xD9, 0x95, 0xF9,
+    0x15, 0xDA, 0x17, 0xF1, 0xAC, 0xC5, 0x4D, 0x6B, 0x1B, 0x59, 0xD9, 0xDF, 0xD7, 0xE2, 0x43, 0x38,
+    0x8A, 0x84, 0x1F, 0x75, 0xC0, 0x24, 0x0A, 0x26, 0xE0, 0xDC, 0xBA, 0x21, 0xE0, 0xB3, 0x5E, 0xF6,
+    0x61, 0xEA, 0xD8, 0x8B, 0x01, 0x3F, 0x65, 0xBC, 0xE2, 0xD4, 0x78, 0xBC, 0xF8, 0x47, 0xB0, 0xB5,
+    0x23, 0xF8, 0xDB, 0x81, 0x43, 0x2F, 0x77, 0xCB, 0x2A, 0x4D, 0x0E, 0xFE, 0x56, 0xE3, 0x8F, 0x3A,
+    0xB2, 0x36, 0x8F, 0xEA, 0x2C, 0x8F, 0xCA, 0xA8, 0x8C, 0x75, 0xC4, 0xBF, 0x2A, 0xC9, 0xC3, 0xD1,
+    0xA6, 0x98, 0x56, 0xF1, 0x99, 0x6F, 0xEF, 0xF8, 0xA4, 0x29, 0x51, 0x83, 0xC5, 0x81, 0xB9, 0x4D,
+    0xC3, 0x76, 0x65, 0x25, 0xE8, 0x54, 0x61, 0xB8, 0xE1, 0xF7, 0x50, 0xD4, 0x6A, 0x00, 0x67, 0x6F,
+    0x28, 0x20, 0x87, 0x25, 0x67, 0x4B, 0x79, 0x0B, 0xC8, 0x1B, 0x43, 0x49, 0x14, 0x21, 0x97, 0x73,
+    0xC5, 0x3B, 0xB8, 0x97, 0x41, 0xB6, 0x07, 0xEC, 0x75, 0xAE, 0xD4, 0xE2, 0x09, 0x3E, 0xEC, 0xE1,
+    0x8B, 0x93, 0x77, 0x35, 0x90, 0xD3, 0xD1, 0xFA, 0xF5, 0x4B, 0xF9, 0xF2, 0x8D, 0xB3, 0x54, 0x55,
+    0xAD, 0x9A, 0xB2, 0x2F, 0x35, 0xDE, 0x28, 0xF7, 0x7A, 0xCA, 0x11, 0x84, 0xB3, 0x8E, 0x24, 0xC5,
+    0x1F, 0x6C, 0x19, 0x34, 0xA6, 0x8C, 0xEA, 0xB8, 0x8C, 0x9A, 0xB8, 0x0C, 0x3B, 0x93, 0xFB, 0x64,
+    0x47, 0xA9, 0xE2, 0x7E, 0x62, 0x66, 0xE5, 0x45, 0x4C, 0x3C, 0xBA, 0x34, 0x60, 0x4A, 0x2B, 0x07,
+    0xD4, 0x3E, 0x36, 0x23, 0x7E, 0xA4, 0x36, 0x57, 0x5B, 0xF3, 0x42, 0x93, 0xF8, 0xD5, 0xB4, 0x31,
+    0x2B, 0xEE, 0x99, 0x24, 0x23, 0x39, 0x0C, 0x12, 0x60, 0xC5, 0xB5, 0xC8, 0xA1, 0x84, 0xF9, 0x41,
+    0x97, 0x48, 0xEC, 0xD9, 0x3E, 0xCC, 0x1F, 0x0A, 0xEA, 0xB3, 0x7E, 0x79, 0x3E, 0x2A, 0x65, 0x55,
+    0xFD, 0x26, 0x4A, 0xC5, 0xAB, 0xFF, 0x14, 0x63, 0x61, 0x0D, 0x47, 0x69, 0xDC, 0x77, 0x77, 0xFF,
+    0x7C, 0x94, 0xE3, 0x99, 0xF3, 0x41, 0x25, 0x7E, 0x99, 0xF8, 0x98, 0x5B, 0x46, 0x69, 0xD1, 0xC5,
+    0x12, 0xD4, 0x9E, 0x3C, 0x4D, 0x3B, 0x5C, 0x81, 0x99, 0xB9, 0x5E, 0x80, 0xF9, 0x5D, 0x56, 0xD5,
+    0xB1, 0x33, 0x49, 0xD1, 0xB5, 0x91, 0x6D, 0x20, 0x58, 0xE6, 0x37, 0x87, 0x7E, 0x3D, 0x04, 0x15,
+    0xE6, 0x0E, 0x71, 0x59, 0xD8, 0xDC, 0xBC, 0x97, 0x7A, 0x78, 0xE2, 0x5E, 0x49, 0xE5, 0x69, 0x18,
+    0x95, 0xFD, 0xC9, 0xE0, 0x8F, 0x51, 0x17, 0xF5, 0xA6, 0x31, 0x8D, 0x2D, 0x8B, 0x37, 0xAC, 0xD8,
+    0xE7, 0x47, 0xC9, 0x5E, 0xB7, 0xB0, 0x11, 0x6C, 0x6C, 0x53, 0x40, 0x2B, 0xA6, 0x0C, 0xEB, 0x24,
+    0xF7, 0xE4, 0x0C, 0x37, 0xA2, 0x9B, 0xAF, 0x73, 0xFB, 0x3F, 0xA5, 0x61, 0x9E, 0xB8, 0x64, 0xEF,
+    0x81, 0x8B, 0xA9, 0x01, 0x1F, 0x9B, 0x66, 0x56, 0xFE, 0x8B, 0x56, 0x9E, 0xB7, 0x15, 0xB4, 0xE2,
+    0xDB, 0x0E, 0x5A, 0xF1, 0xAB, 0x43, 0x68, 0xC5, 0xAF, 0x1E, 0x82, 0x56, 0x30, 0x42, 0x2B, 0x7E,
+    0xF5, 0x1A, 0xB4, 0xE2, 0x43, 0xE1, 0x1C, 0x2B, 0x68, 0xC5, 0x7F, 0xAB, 0x81, 0x56, 0xFC, 0xAA,
+    0x83, 0x56, 0xFC, 0xEA, 0x29, 0x6A, 0xA5, 0x7A, 0x18, 0x5A, 0x79, 0xB4, 0x8A, 0x2F, 0x40, 0x2B,
+    0xF2, 0xF5, 0x5A, 0xA1, 0x69, 0x35, 0xBC, 0x68, 0xAA, 0x74, 0x96, 0x11, 0x77, 0xCA, 0xEC, 0x72,
+    0x7D, 0xE8, 0x37, 0xFD, 0x8A, 0xEF, 0x23, 0x58, 0x82, 0xAD, 0x62, 0x9B, 0x7B, 0xAF, 0x60, 0x16,
+    0xEC, 0x13, 0x9B, 0x74, 0xF2, 0x7A, 0xF2, 0xF2, 0xF1, 0xCB, 0x8B, 0x0A, 0x2E, 0x7C, 0xB8, 0xF7,
+    0x9F, 0x9E, 0xE1, 0x6B, 0x53, 0x55, 0x72, 0x80, 0x00, 0xD0, 0x61, 0x07, 0xBD, 0x67, 0x21, 0x90,
+    0x06, 0x0F, 0xB8, 0x88, 0x29, 0x61, 0x53, 0x61, 0x0B, 0x21, 0x5A, 0x43, 0xA1, 0x1A, 0xAF, 0xC8,
+    0xB1, 0x6D, 0xE1, 0x8D, 0xD6, 0xF3, 0xA1, 0xA2, 0xC6, 0xBB, 0x8C, 0x59, 0xB2, 0x42, 0x58, 0x88,
+    0x2A, 0xBC, 0x6F, 0x65, 0x25, 0x5C, 0x23, 0xBB, 0xA5, 0xD4, 0xF7, 0xE9, 0xEF, 0x08, 0x3D, 0x09,
+    0x8C, 0x3B, 0xA5, 0x99, 0x83, 0x9A, 0x7A, 0x1D, 0xFC, 0xAB, 0xC8, 0x31, 0x60, 0xEF, 0x6A, 0x0C,
+    0xA6, 0x82, 0xC7, 0x80, 0x91, 0xC5, 0x4F, 0xB0, 0xE4, 0x22, 0xF7, 0x07, 0x58, 0x3F, 0xF8, 0xDB,
+    0x34, 0xE8, 0xE1, 0x9A, 0x61, 0x0F, 0x16, 0xE1, 0x18, 0x83, 0x18, 0xBD, 0x3E, 0xB2, 0x43, 0x0F,
+    0x37, 0x6C, 0x7A, 0x12, 0x9E, 0xC3, 0xC4, 0x12, 0x2B, 0xB2, 0x39, 0x60, 0x60, 0xF6, 0xB2, 0xB3,
+    0xB6, 0xC7, 0xCC, 0xDE, 0xD8, 0xF1, 0x35, 0x78, 0xD9, 0x79, 0xB8, 0xC7, 0x79, 0x7B, 0xE2, 0xE2,
+    0x3D, 0xFE, 0x66, 0x70, 0xC5, 0xB8, 0x02, 0x5C, 0x72, 0x16, 0x97, 0xFC, 0xAF, 0xD7, 0xCB, 0xDF,
+    0xF7, 0xD2, 0xB8, 0xA1, 0x89, 0x9A, 0x6A, 0x47, 0xC2, 0x32, 0xAE, 0x83, 0x6E, 0xD5, 0xBD, 0xD4,
+    0xD9, 0x06, 0x16, 0x75, 0x4F, 0x0E, 0xC1, 0x7C, 0x5B, 0x26, 0x6A, 0x74, 0xDF, 0x35, 0x1A, 0xA9,
+    0x5D, 0xB0, 0x1E, 0xC4, 0xEB, 0x65, 0xD5, 0xD3, 0x22, 0x56, 0x5C, 0x61, 0x99, 0xBC, 0x57, 0x99,
+    0xA0, 0x7E, 0x26, 0xA8, 0x0F, 0xC3, 0xEA, 0x30, 0xAA, 0x9E, 0x89, 0x4B, 0x4C, 0x89, 0xF1, 0x18,
+    0xD6, 0xB3, 0xEB, 0xA5, 0x81, 0x06, 0x80, 0xA4, 0x0A, 0x10, 0xA6, 0xFC, 0x21, 0x42, 0xEC, 0x42,
+    0x2C, 0xB5, 0x8F, 0xF6, 0xFC, 0x0C, 0x86, 0xA4, 0x89, 0xDB, 0xAC, 0x32, 0xB5, 0x4D, 0x0B, 0xB8,
+    0x48, 0x82, 0xB0, 0x7C, 0x06, 0x7E, 0x24, 0xF7, 0xA5, 0x72, 0x44, 0x8D, 0x80, 0x55, 0x68, 0x53,
+    0xEC, 0x1C, 0xEC, 0x3E, 0xAA, 0x19, 0x5B, 0x92, 0x52, 0x7E, 0x04, 0x5F, 0x12, 0x0A, 0x82, 0x7D,
+    0xF7, 0x7A, 0x1F, 0x96, 0xB9, 0xEA, 0xC3, 0xE6, 0xBE, 0x7C, 0xD5, 0xC7, 0x25, 0xA4, 0xEE, 0xCC,
+    0x8F, 0x6D, 0xE9, 0xB7, 0xA3, 0x6F, 0xF3, 0xE0, 0x26, 0x14, 0x99, 0x0A, 0x2C, 0x10, 0x13, 0xA2,
+    0xEA, 0x10, 0xA3, 0x79, 0xAE, 0xE5, 0x52, 0xFC, 0x63, 0x18, 0x64, 0x8F, 0xE8, 0x8D, 0x27, 0xEF,
+    0xBA, 0xC4, 0x28, 0xCC, 0x65, 0x81, 0x38, 0x0D, 0xFD, 0x04, 0xF7, 0x46, 0xB9, 0x57, 0xCA, 0x3D,
+    0xFF, 0x0A, 0xEE, 0x05, 0xB9, 0x5F, 0xB5, 0x0D, 0xB8, 0x3F, 0x06, 0xAB, 0x04, 0xF7, 0x47, 0x7B,
+    0x70, 0x17, 0xFC, 0x1E, 0x34, 0x7C, 0x63, 0x7E, 0x5C, 0x89, 0xC9, 0x05, 0x21, 0xBA, 0xA0, 0xB1,
+    0x82, 0x78, 0x8C, 0x0C, 0xC3, 0xA5, 0xD5, 0xBA, 0xB4, 0x1A, 0xDC, 0x11, 0xF3, 0x61, 0xB0, 0x12,
+    0x56, 0x21, 0xD2, 0x4A, 0x52, 0x06, 0xFF, 0xEA, 0xC0, 0xCC, 0x83, 0x4C, 0x60, 0xE6, 0xB7, 0x20,
+    0xE6, 0x5D, 0xAE, 0x43, 0x26, 0x27, 0x89, 0x4B, 0x5A, 0xB1, 0x81, 0x8E, 0xC3, 0x7A, 0x5C, 0xBD,
+    0x22, 0xE1, 0xB5, 0x3E, 0xEC, 0xFF, 0x7C, 0xF0, 0x6E, 0x13, 0x77, 0x85, 0xFD, 0x6D, 0x95, 0xB5,
+    0xD9, 0x90, 0xE4, 0x4C, 0x66, 0x99, 0xFF, 0x19, 0x72, 0x63, 0x1F, 0x5D, 0x6D, 0x40, 0x21, 0x79,
+    0xBC, 0xC6, 0xF3, 0xD9, 0xE5, 0x4E, 0x18, 0xB8, 0x7A, 0x31, 0xE9, 0xC5, 0xE2, 0x9F, 0xDC, 0xD5,
+    0xA4, 0xC4, 0x96, 0x72, 0x79, 0xFA, 0xB2, 0x34, 0xC2, 0x94, 0x6C, 0x5C, 0x72, 0xF8, 0xC5, 0x92,
+    0x24, 0xB9, 0x20, 0x06, 0x1B, 0xFA, 0x1A, 0x12, 0x2B, 0x1E, 0x81, 0x27, 0x61, 0xBE, 0x69, 0xA7,
+    0xDC, 0x9B, 0x33, 0x13, 0x9C, 0x91, 0xE2, 0x9D, 0xD7, 0xB0, 0x30, 0x06, 0x83, 0x51, 0xB3, 0x85,
+    0x7B, 0x79, 0x7B, 0xA4, 0xC0, 0xF8, 0xA1, 0x29, 0x83, 0x16, 0x35, 0x31, 0xDD, 0x99, 0x8D, 0xDF,
+    0xA7, 0x1B, 0x84, 0x0C, 0x6A, 0x11, 0x07, 0x04, 0x13, 0x10, 0xBF, 0x41, 0xCA, 0x07, 0x18, 0x2C,
+    0x77, 0x68, 0xC0, 0x80, 0xA4, 0x57, 0xC1, 0xCF, 0x31, 0xC4, 0x0D, 0xD4, 0x68, 0x2A, 0x0C, 0xD9,
+    0xF5, 0xCB, 0x70, 0x4F, 0xC4, 0x22, 0x8F, 0x83, 0xCF, 0x21, 0x60, 0x50, 0x20, 0x9A, 0x68, 0xE0,
+    0xBE, 0x51, 0x0B, 0x0C, 0x12, 0xB5, 0x10, 0x53, 0x13, 0xB9, 0xB7, 0xCF, 0x78, 0x35, 0x4C, 0x29,
+    0x7D, 0xCA, 0xDC, 0x14, 0x61, 0x4F, 0xB6, 0x2E, 0x8B, 0x22, 0x1C, 0x6C, 0xB9, 0x30, 0x32, 0x4B,
+    0x74, 0xAD, 0x67, 0xA2, 0x1E, 0x99, 0x6B, 0xCF, 0x6D, 0x5D, 0x16, 0x7D, 0x05, 0x1D, 0xB2, 0x25,
+    0xA2, 0x16, 0x15, 0x62, 0x14, 0x51, 0x9C, 0xD7, 0x1F, 0xCF, 0x4A, 0x2A, 0xB7, 0xA9, 0xC7, 0xC9,
+    0xE4, 0x84, 0x72, 0x52, 0x39, 0xB1, 0x9C, 0x5C, 0x2A, 0x98, 0x93, 0xCC, 0x89, 0xE6, 0x64, 0x73,
+    0xC2, 0x39, 0xE9, 0x9C, 0x78, 0x2A, 0x9F, 0xA8, 0x80, 0xA2, 0x12, 0x8A, 0x8A, 0xA8, 0x48, 0xB0,
+    0x11, 0x15, 0x52, 0x54, 0x4A, 0x99, 0xC5, 0x0C, 0xAA, 0x57, 0xC1, 0xF6, 0xE6, 0x30, 0xA9, 0x2B,
+    0x2C, 0x5B, 0xD9, 0x78, 0x6D, 0x71, 0xEB, 0xD4, 0x61, 0xB0, 0xA6, 0xD5, 0xE7, 0xDC, 0xBF, 0x6A,
+    0x1E, 0xF4, 0x4F, 0x51, 0x85, 0x9C, 0xD9, 0xBE, 0x54, 0x48, 0xC9, 0xCA, 0x3A, 0x9B, 0x3E, 0xF1,
+    0x41, 0x8E, 0x2B, 0x7E, 0xA6, 0xC4, 0xB4, 0x99, 0x03, 0x95, 0x9D, 0xA6, 0x1E, 0xC0, 0x67, 0x97,
+    0x7D, 0xB2, 0xCA, 0x7D, 0xDA, 0x67, 0xED, 0xC5, 0x57, 0xF8, 0xF8, 0x8A, 0x99, 0x16, 0x2E, 0xBB,
+    0xB2, 0x6A, 0x98, 0xC8, 0x6C, 0xB4, 0xD2, 0x78, 0xBC, 0x44, 0x7C, 0xE9, 0x00, 0x2D, 0xF7, 0xDA,
+    0x7D, 0x52, 0x34, 0x32, 0x67, 0x1A, 0x6D, 0x1D, 0x68, 0x8E, 0x8E, 0x2F, 0xE6, 0x8A, 0xE5, 0x29,
+    0x06, 0xA0, 0x7C, 0xC2, 0x4F, 0xF0, 0x36, 0x4E, 0x2C, 0x7D, 0x15, 0x80, 0xF3, 0x21, 0xE9, 0x2A,
+    0x86, 0xB0, 0x63, 0xC1, 0xCC, 0xB3, 0xCA, 0x03, 0x5A, 0x5D, 0x44, 0xBA, 0x71, 0x2B, 0x0E, 0xE1,
+    0xD3, 0x04, 0x36, 0x33, 0x68, 0xB6, 0x0C, 0xEE, 0x9E, 0xFE, 0xDA, 0x22, 0x81, 0xC4, 0xE3, 0xCF,
+    0x1B, 0x66, 0x5F, 0x35, 0x26, 0x46, 0x2A, 0xA2, 0x4B, 0x82, 0x19, 0x8D, 0x5B, 0x0E, 0xD2, 0x7B,
+    0x1C, 0x7E, 0x36, 0xE3, 0x64, 0x47, 0x46, 0xF6, 0x65, 0xCE, 0xC4, 0x99, 0x1A, 0x34, 0x85, 0x8C,
+    0xF8, 0x8B, 0x37, 0xDB, 0xBD, 0xA1, 0x22, 0x75, 0xC8, 0xA8, 0xCA, 0x42, 0x71, 0xED, 0x92, 0xBF,
+    0xAD, 0xCC, 0x78, 0xDA, 0x5E, 0x7C, 0x79, 0xA9, 0x13, 0x26, 0x31, 0x82, 0x75, 0x11, 0x31, 0x57,
+    0x12, 0x34, 0x6D, 0x0C, 0xD4, 0x92, 0xAA, 0x66, 0x4D, 0x9D, 0xC2, 0xA4, 0x24, 0x96, 0x4E, 0x21,
+    0x53, 0x1F, 0x57, 0x81, 0xE6, 0x98, 0xB0, 0x45, 0x59, 0x76, 0x58, 0x27, 0x19, 0xCE, 0x21, 0xFC,
+    0xF3, 0x7B, 0xC4, 0x85, 0xA8, 0x46, 0x36, 0xDB, 0x59, 0x22, 0xF7, 0xD6, 0x64, 0xF1, 0xDA, 0x07,
+    0x29, 0x01, 0x20, 0x9A, 0x8A, 0xE1, 0x35, 0x0F, 0x6F, 0x3A, 0xFE, 0xD6, 0xC4, 0xA0, 0x46, 0xF8,
+    0x1C, 0x52, 0x39, 0x01, 0xB2, 0x28, 0x2A, 0x98, 0x76, 0x06, 0x29, 0x9D, 0x09, 0x5D, 0x38, 0x25,
+    0x1E, 0x1C, 0x29, 0x1A, 0x1E, 0xA9, 0x69, 0xA5, 0x5A, 0x3B, 0x8B, 0x65, 0xCE, 0x59, 0x67, 0x4D,
+    0x95, 0xD1, 0x9B, 0x72, 0x6E, 0x60, 0xB9, 0x16, 0x47, 0xA6, 0x60, 0x78, 0x91, 0x1D, 0xE4, 0x25,
+    0x96, 0xBA, 0x9C, 0x0C, 0x10, 0x41, 0x9E, 0xDE, 0xEE, 0x1D, 0xE4, 0x07, 0xEB, 0xF3, 0x99, 0xDD,
+    0x71, 0xC3, 0xBC, 0xD9, 0xC8, 0x08, 0x80, 0xB0, 0x37, 0xE5, 0xC6, 0x3B, 0xC1, 0x2F, 0x7A, 0x0E,
+    0xD1, 0xE1, 0xCD, 0x0E, 0xBC, 0x5A, 0x16, 0x81, 0xCB, 0x86, 0xDE, 0x09, 0x5E, 0x86, 0xE1, 0x40,
+    0xD3, 0x5A, 0x46, 0xB2, 0x85, 0xC6, 0x9D, 0x3C, 0x23, 0xC2, 0x87, 0x86, 0x01, 0xF6, 0x3A, 0x8F,
+    0x30, 0x5E, 0xB1, 0xBC, 0x41, 0x8D, 0x88, 0xA1, 0x8B, 0x50, 0x75, 0xB4, 0x51, 0x97, 0x8C, 0x7F,
+    0x88, 0x5B, 0x04, 0xB6, 0x84, 0x91, 0x37, 0xAB, 0x59, 0x90, 0xA3, 0x3E, 0x08, 0x6C, 0x1E, 0x1F,
+    0x2B, 0xDC, 0x41, 0x00, 0x84, 0x7D, 0x00, 0xE9, 0xD9, 0x6E, 0x6D, 0x94, 0xC8, 0xA6, 0x1A, 0xF3,
+    0x59, 0x9E, 0x27, 0xB4, 0x48, 0x79, 0x48, 0x1B, 0x0A, 0x1B, 0xD9, 0x14, 0x61, 0x0B, 0xC0, 0xCE,
+    0x68, 0xBA, 0xCB, 0x34, 0xF5, 0x15, 0x03, 0x01, 0x22, 0x89, 0x56, 0x58, 0x3C, 0xD7, 0x37, 0xA2,
+    0xF6, 0x28, 0x51, 0xE4, 0xE7, 0x59, 0xCE, 0x7A, 0x1F, 0x85, 0x47, 0x8F, 0x31, 0xF5, 0xFB, 0xA4,
+    0x66, 0x43, 0x20, 0x6A, 0x74, 0xFC, 0x84, 0x05, 0x50, 0x78, 0x0B, 0x85, 0x47, 0x13, 0x8C, 0xA4,
+    0x84, 0x1A, 0x09, 0x94, 0x56, 0xEC, 0x80, 0xA0, 0x72, 0xE9, 0x18, 0x43, 0x60, 0xF7, 0xA0, 0x57,
+    0xB0, 0x5E, 0x92, 0xAC, 0x99, 0x01, 0x88, 0x59, 0x07, 0xC8, 0x56, 0x2B, 0xDE, 0x4D, 0x34, 0xE4,
+    0x15, 0x54, 0xFE, 0xE4, 0x04, 0xD0, 0xD4, 0x71, 0xD1, 0x02, 0x61, 0xC7, 0x3D, 0xC2, 0x74, 0xD8,
+    0x23, 0x4C, 0x07, 0x03, 0xC2, 0xB4, 0x0F, 0x40, 0x8F, 0x01, 0x84, 0x30, 0x54, 0xF0, 0x28, 0x0C,
+    0x61, 0x8F, 0xD0, 0x1A, 0xE9, 0xD0, 0xE1, 0xCF, 0xA4, 0xC1, 0xAF, 0x59, 0x6D, 0x5A, 0x0F, 0x8A,
+    0x1B, 0x9F, 0xB0, 0x69, 0xC4, 0xFE, 0x88, 0xBA, 0x22, 0x76, 0x23, 0x5F, 0x5A, 0x32, 0x2E, 0xE2,
+    0xD4, 0x53, 0x67, 0x41, 0x3B, 0x06, 0x2A, 0xD5, 0x12, 0x88, 0xB7, 0x2C, 0x90, 0xC2, 0xC5, 0xC8,
+    0x6A, 0x88, 0xA1, 0x79, 0x21, 0x3B, 0xFB, 0x1D, 0xB6, 0xCC, 0xDB, 0x9D, 0xBD, 0x70, 0xDB, 0x1A,
+    0xD2, 0xC4, 0xFD, 0xE2, 0x53, 0xEC, 0xF8, 0x74, 0xCC, 0xBD, 0xA8, 0x0B, 0x6A, 0xD0, 0xF0, 0xD2,
+    0x9D, 0xFF, 0x8F, 0x86, 0x1E, 0x0C, 0xE0, 0x5A, 0xC5, 0xE3, 0x0C, 0x4F, 0x28, 0x68, 0x60, 0xE2,
+    0xF9, 0x46, 0x5C, 0xDE, 0xAA, 0x2C, 0x67, 0x90, 0x97, 0x1E, 0x96, 0x38, 0x85, 0xA7, 0x94, 0xC9,
+    0xFB, 0xF0, 0x67, 0xD8, 0xBE, 0x4F, 0x1C, 0x00, 0xF6, 0x1E, 0x7C, 0x9D, 0x5D, 0xC0, 0xF8, 0xDF,
+    0x28, 0xE4, 0xE0, 0x43, 0x19, 0x0A, 0x90, 0xFB, 0xE5, 0x9E, 0x45, 0xD0, 0xEF, 0x51, 0xD4, 0x43,
+    0x02, 0x92, 0x9E, 0xA2, 0xC2, 0xBF, 0x6F, 0x15, 0x1D, 0x80, 0x5B, 0x82, 0x6A, 0x55, 0x8A, 0x9E,
+    0xA1, 0x61, 0x40, 0x25, 0xFB, 0x19, 0x44, 0x8D, 0x3E, 0x80, 0xA8, 0xC9, 0x15, 0x88, 0x9A, 0xC1,
+    0x13, 0x5F, 0xEF, 0x21, 0xEF, 0x15, 0xC4, 0x06, 0xF3, 0x17, 0x84, 0x05, 0xC0, 0x3A, 0x54, 0xD7,
+    0x70, 0xDB, 0x1A, 0x59, 0x73, 0x53, 0xD4, 0x84, 0x34, 0x33, 0x8A, 0x7A, 0xBF, 0xB7, 0xC6, 0xD2,
+    0x8A, 0x3B, 0x8A, 0x72, 0xAE, 0x43, 0x22, 0xED, 0xA5, 0xD0, 0x13, 0x97, 0xBD, 0x46, 0x21, 0x3A,
+    0x20, 0x2A, 0x69, 0x87, 0x01, 0x03, 0xD4, 0xD6, 0x01, 0x16, 0x44, 0x3A, 0xB4, 0x48, 0x5D, 0x71,
+    0x33, 0x47, 0x25, 0xC3, 0xA8, 0x64, 0x2A, 0xED, 0x86, 0xC4, 0xEC, 0x5F, 0x40, 0xA9, 0x28, 0x15,
+    0x19, 0xE2, 0xA0, 0x40, 0xF6, 0x2F, 0x40, 0xC2, 0x34, 0x6C, 0xD5, 0x8C, 0x07, 0x3D, 0x37, 0x45,
+    0xFB, 0x98, 0xDC, 0xB7, 0x71, 0xED, 0x60, 0xAE, 0x24, 0x29, 0xA7, 0x7C, 0xC9, 0x2C, 0xE7, 0xA4,
+    0x5A, 0x2A, 0xB5, 0x2D, 0x0B, 0xC4, 0xF4, 0x27, 0x89, 0x26, 0x5A, 0x96, 0xA7, 0x03, 0xC0, 0x47,
+    0xD8, 0x02, 0x9A, 0xED, 0xA4, 0xB3, 0x1A, 0xB7, 0x2C, 0xD0, 0x53, 0x8C, 0xE9, 0x23, 0x82, 0xA9,
+    0x37, 0x72, 0xCF, 0x5E, 0x8D, 0xD3, 0x0D, 0x73, 0xDF, 0xB6, 0x72, 0x76, 0x67, 0x84, 0xAC, 0xB8,
+    0xDE, 0x4E, 0x85, 0xFA, 0x02, 0x10, 0x68, 0x55, 0xA4, 0x07, 0x52, 0x49, 0x0D, 0x78, 0x1E, 0x37,
+    0x51, 0xBF, 0xD4, 0x0D, 0xAC, 0x35, 0x60, 0x7A, 0xC1, 0x2D, 0xCB, 0x0A, 0x85, 0xF0, 0x8E, 0xB9,
+    0x6B, 0x45, 0x7F, 0xF1, 0x14, 0x09, 0x38, 0xFC, 0xB4, 0x86, 0x4E, 0x73, 0xBB, 0x58, 0x61, 0xA9,
+    0x5A, 0xC6, 0x1A, 0x3A, 0x6D, 0xA2, 0x73, 0x2D, 0x03, 0x3F, 0x66, 0x4B, 0xDA, 0x75, 0xD5, 0x07,
+    0xAD, 0x43, 0x40, 0x65, 0x65, 0x53, 0x50, 0xB1, 0x39, 0x24, 0xB1, 0x73, 0xF7, 0xCC, 0x63, 0xF7,
+    0x0C, 0x99, 0x3A, 0xA4, 0x93, 0x44, 0xCC, 0xA3, 0x11, 0xF3, 0x68, 0x6C, 0x3F, 0x9E, 0x50, 0xD8,
+    0x89, 0xEE, 0xD9, 0xBC, 0x76, 0x4F, 0xAB, 0x53, 0x7D, 0x56, 0x9B, 0x91, 0xE0, 0xDB, 0x24, 0x2D,
+    0x9D, 0x89, 0xE8, 0x0C, 0x4E, 0x47, 0xD6, 0xD4, 0x8D, 0x67, 0xE9, 0xFA, 0x2B, 0x1B, 0x02, 0x19,
+    0xF8, 0x23, 0xDB, 0xD0, 0x08, 0x32, 0xAC, 0xD6, 0x7A, 0x8E, 0xF0, 0xDD, 0x8E, 0x4B, 0x60, 0x84,
+    0x8F, 0xBA, 0x80, 0xC0, 0xA7, 0x65, 0x59, 0x07, 0xD6, 0xD8, 0x8B, 0xC4, 0x8D, 0xD7, 0x58, 0x25,
+    0x98, 0xB7, 0x35, 0x8A, 0xBD, 0x4D, 0x78, 0x99, 0xBD, 0x41, 0x55, 0x15, 0xE5, 0xCE, 0xAC, 0x25,
+    0x85, 0xEB, 0xF2, 0x2B, 0xEB, 0xEA, 0x1A, 0x99, 0x8B, 0x0B, 0x29, 0xAA, 0x25, 0xA9, 0x2D, 0xA0,
+    0x91, 0x3A, 0x3B, 0x5A, 0x83, 0x46, 0xD3, 0x1C, 0x79, 0xB6, 0x1F, 0xB1, 0xB7, 0x43, 0x84, 0x9D,
+    0x8E, 0xB5, 0x81, 0x1C, 0x22, 0xE6, 0x85, 0x1D, 0x1B, 0xFF, 0x6C, 0x1A, 0x17, 0xB0, 0x10, 0xDA,
+    0x46, 0x51, 0x66, 0x55, 0xF1, 0x0F, 0x5B, 0x12, 0xBD, 0x24, 0xB6, 0x28, 0x43, 0x7A, 0x43, 0x3A,
+    0x77, 0x58, 0xA2, 0x19, 0x24, 0xE6, 0x0E, 0x98, 0xEE, 0x9E, 0x22, 0xFD, 0xDB, 0x40, 0x61, 0x7B,
+    0x1B, 0x28, 0x3C, 0x15, 0xFA, 0x7A, 0x10, 0xD3, 0xC6, 0x4C, 0xB2, 0x47, 0xF4, 0xF4, 0x9E, 0x8E,
+    0xD5, 0x6A, 0x23, 0x51, 0x96, 0x65, 0x08, 0xF9, 0xD0, 0x09, 0xE0, 0x4C, 0xF4, 0x09, 0xB2, 0x12,
+    0xF2, 0x12, 0x32, 0x73, 0xC7, 0x24, 0x64, 0x27, 0x85, 0xB6, 0x6E, 0xE9, 0x4C, 0xE4, 0x28, 0x64,
+    0xE9, 0x10, 0x1F, 0x99, 0x8A, 0x72, 0x75, 0x6C, 0x15, 0x7C, 0x5E, 0x01, 0x34, 0x3A, 0x01, 0x3E,
+    0x4F, 0x65, 0x4D, 0x67, 0x5D, 0x37, 0x2D, 0x40, 0xA1, 0x1F, 0x3E, 0x5F, 0xE9, 0xC5, 0xEF, 0xBC,
+    0xA7, 0x5D, 0xE6, 0xD3, 0xD4, 0x1D, 0x28, 0x1D, 0xDA, 0x1A, 0x29, 0x0A, 0xE9, 0x2B, 0x60, 0xB1,
+    0x3F, 0x44, 0xC3, 0x81, 0x7D, 0x64, 0x8C, 0xDB, 0x68, 0x40, 0x9C, 0xAA, 0x19, 0x81, 0x10, 0x6C,
+    0xBA, 0x83, 0x1E, 0x74, 0xE1, 0x96, 0x05, 0xC7, 0xBC, 0x00, 0x7A, 0xFD, 0x1D, 0xEC, 0x85, 0x8E,
+    0x00, 0xFA, 0x1C, 0xAF, 0xD9, 0xCE, 0xE3, 0xF9, 0x13, 0xFC, 0x0A, 0x5C, 0x30, 0x82, 0x8F, 0x81,
+    0xC4, 0xE9, 0x02, 0xC0, 0x12, 0x9B, 0x7B, 0xEC, 0x9F, 0xF2, 0x0C, 0x6B, 0x7C, 0x22, 0xA5, 0xCF,
+    0xD1, 0xEA, 0xB2, 0xAF, 0x3A, 0x85, 0xFB, 0xF4, 0xD7, 0x7A, 0x0A, 0x17, 0x6B, 0x2E, 0x6E, 0xF5,
+    0x04, 0x8E, 0xE7, 0x4D, 0x9E, 0xB6, 0x98, 0x52, 0xB9, 0xBB, 0x60, 0x5F, 0x61, 0x2A, 0xBB, 0xD4,
+    0x4F, 0x5A, 0x17, 0x57, 0x4E, 0xFA, 0x49, 0x0C, 0x29, 0x10, 0xFF, 0x58, 0xB2, 0x45, 0x43, 0xD4,
+    0x22, 0x92, 0xB6, 0x8C, 0xA1, 0xE6, 0xAF, 0x45, 0x43, 0x9D, 0xF0, 0x48, 0xAB, 0xB8, 0x9E, 0x6E,
+    0x9C, 0xFE, 0x85, 0xCC, 0xE3, 0x8C, 0x10, 0x50, 0xF9, 0xAD, 0xE9, 0xE4, 0x42, 0x8B, 0xA9, 0xD6,
+    0x85, 0x12, 0x76, 0x3A, 0xFB, 0x75, 0xAC, 0x3C, 0x15, 0xFA, 0xFB, 0x32, 0xF9, 0x09, 0xE2, 0xC5,
+    0x55, 0x16, 0x4F, 0x1D, 0xDC, 0x70, 0xEF, 0xD4, 0xE8, 0xC7, 0x8F, 0x34, 0xEA, 0x7F, 0xE6, 0x2A,
+    0xEC, 0xD5, 0x5F, 0xDB, 0xEB, 0x29, 0xD0, 0x46, 0x04, 0x41, 0x44, 0x66, 0x7F, 0xB6, 0xD0, 0x7D,
+    0xD9, 0x99, 0x3A, 0xC2, 0x1E, 0x1F, 0x61, 0x6B, 0x07, 0xBF, 0x06, 0xCB, 0x41, 0x6D, 0xBB, 0x3E,
+    0xA8, 0x4D, 0xD8, 0xA9, 0xD2, 0x82, 0xA2, 0x54, 0xB4, 0x1C, 0x30, 0xD5, 0xB1, 0x78, 0x29, 0xE6,
+    0x22, 0xE2, 0x9B, 0x12, 0x01, 0x04, 0x61, 0xAB, 0xAB, 0x8D, 0x6E, 0xF6, 0x26, 0x3F, 0x9A, 0x7A,
+    0xA1, 0xDF, 0x90, 0x48, 0x50, 0xBD, 0x1A, 0x7D, 0x32, 0x80, 0x42, 0x50, 0xCE, 0x05, 0xD9, 0x37,
+    0x15, 0x43, 0x3B, 0x77, 0xD5, 0x0F, 0x24, 0x38, 0x1E, 0x90, 0x9D, 0x5A, 0xD7, 0xF3, 0xE6, 0xC6,
+    0xDE, 0x68, 0xE4, 0x5B, 0x21, 0xAD, 0xB4, 0x93, 0xE2, 0x03, 0xE4, 0x8C, 0xE9, 0xD8, 0xA6, 0x35,
+    0x40, 0xAB, 0x51, 0xC7, 0x04, 0x04, 0xD7, 0x68, 0x51, 0x53, 0x36, 0x3C, 0xF5, 0x43, 0x2A, 0x87,
+    0xF3, 0xAA, 0xE3, 0xA6, 0x09, 0x42, 0x57, 0xC0, 0x1C, 0x7E, 0x76, 0xC1, 0xC7, 0x83, 0x8F, 0xB0,
+    0x60, 0x6F, 0x90, 0x34, 0x32, 0x49, 0xCC, 0xEE, 0xD7, 0x0E, 0x8F, 0x42, 0xF4, 0xD5, 0xC3, 0xBB,
+    0xBC, 0x1E, 0x10, 0x7A, 0x35, 0x62, 0xAB, 0x7C, 0xFB, 0x2E, 0x07, 0x4F, 0x97, 0x40, 0x7C, 0xC1,
+    0x6A, 0xB5, 0xE3, 0x69, 0x4C, 0x4B, 0x7C, 0xD1, 0x60, 0x00, 0x42, 0x25, 0xBE, 0x08, 0x78, 0xE8,
+    0xA4, 0x71, 0x91, 0x20, 0x63, 0x39, 0xCD, 0x5A, 0xFB, 0x97, 0x1E, 0x5F, 0xE8, 0x71, 0xC6, 0x22,
+    0x4B, 0x32, 0xB2, 0x98, 0x28, 0x03, 0xB5, 0xA1, 0x83, 0x36, 0x41, 0xD1, 0x6B, 0x6A, 0xA0, 0xF0,
+    0x52, 0xAF, 0xAE, 0xC8, 0xD9, 0x34, 0x44, 0x4C, 0xCA, 0x5D, 0x3C, 0xCA, 0xDE, 0xB7, 0x25, 0x3B,
+    0x22, 0x11, 0x6C, 0x6B, 0x65, 0xFF, 0x3E, 0x75, 0x3B, 0x4F, 0xDA, 0xBF, 0xBF, 0xB6, 0xFF, 0x53,
+    0xA1, 0xAF, 0x68, 0xF4, 0x41, 0x31, 0xE3, 0xA1, 0xF0, 0x1C, 0xA3, 0xC5, 0x9E, 0xCD, 0x29, 0xE2,
+    0x34, 0xE8, 0x33, 0x07, 0xA8, 0x7F, 0xBD, 0xD0, 0xDC, 0xE6, 0x5F, 0xA7, 0x41, 0xDB, 0x9B, 0x5A,
+    0x8A, 0xEC, 0x7D, 0x6B, 0x47, 0x3C, 0xFF, 0xD2, 0xD9, 0xE6, 0xB9, 0xFD, 0xFD, 0x5D, 0x8D, 0xB3,
+    0x5F, 0x7E, 0xEE, 0x0C, 0x1B, 0xC8, 0x9A, 0x1A, 0x55, 0x14, 0xC6, 0xD2, 0xC7, 0x06, 0x96, 0x50,
+    0xDC, 0x7D, 0xD4, 0x1B, 0x60, 0x8C, 0xE1, 0xDA, 0x31, 0xE0, 0xE2, 0x47, 0x37, 0x31, 0xDC, 0xB8,
+    0x32, 0x20, 0x52, 0xD3, 0x0E, 0x06, 0xE0, 0x82, 0xB8, 0x4F, 0xB4, 0x2F, 0x5A, 0xB3, 0x21, 0x9B,
+    0x8B, 0x29, 0xE0, 0xF3, 0x3F, 0xF4, 0x96, 0xE5, 0x29, 0x8C, 0xD4, 0xE6, 0x97, 0xA2, 0x3A, 0x45,
+    0x0F, 0xDA, 0xD7, 0x5A, 0x5A, 0x8E, 0x20, 0x44, 0x5B, 0xF3, 0xD8, 0x23, 0xD9, 0x30, 0x38, 0x02,
+    0x5A, 0x67, 0x6B, 0x3D, 0x6D, 0xAD, 0xA3, 0xAD, 0xB5, 0x33, 0xA0, 0x35, 0x1C, 0x32, 0x54, 0x6D,
+    0x6F, 0x69, 0x5F, 0xE4, 0x06, 0x87, 0x0B, 0xB0, 0x8D, 0x21, 0x2E, 0xA7, 0xF4, 0xEB, 0x0E, 0x86,
+    0x94, 0xB1, 0xA2, 0x3C, 0xED, 0xBD, 0x0E, 0x9B, 0xD5, 0xCF, 0x1D, 0xE2, 0xCB, 0x0E, 0x2B, 0xDD,
+    0x59, 0x78, 0xDE, 0x26, 0xC9, 0xBB, 0xC4, 0x8D, 0xCC, 0x37, 0x7B, 0xB3, 0x33, 0xDC, 0x19, 0xBE,
+    0xE1, 0xB3, 0x60, 0x44, 0xBC, 0xE1, 0x86, 0x68, 0x03, 0x71, 0xDC, 0xB1, 0xA5, 0xBA, 0x82, 0xAE,
+    0xF8, 0x9A, 0x82, 0x2E, 0x23, 0x14, 0xA7, 0x29, 0xCF, 0xA4, 0x89, 0x7A, 0x4B, 0x8D, 0x83, 0x98,
+    0x96, 0x54, 0x98, 0x16, 0xBF, 0x85, 0xB0, 0x14, 0x7F, 0x80, 0xB9, 0xD1, 0x47, 0x14, 0x1C, 0x11,
+    0x50, 0xB1, 0x20, 0xF4, 0x57, 0x4E, 0x27, 0x1B, 0x6C, 0xB6, 0xB9, 0x63, 0x35, 0x2D, 0x0A, 0xDC,
+    0xD9, 0x5A, 0xC3, 0xFF, 0x74, 0xC2, 0xC3, 0x0E, 0x62, 0x1E, 0x33, 0xCC, 0x9D, 0x9D, 0xC9, 0x91,
+    0xDB, 0xB9, 0xED, 0xE4, 0x70, 0xFE, 0x89, 0x46, 0xFF, 0xD5, 0x7E, 0xF9, 0xCF, 0x2A, 0xA0, 0x6F,
+    0x3F, 0x05, 0x1D, 0x64, 0x32, 0x77, 0xFC, 0xEE, 0xCE, 0xE0, 0x29, 0x35, 0xD6, 0x53, 0x70, 0xB0,
+    0x39, 0xC3, 0x61, 0x1A, 0x0E, 0x3C, 0x83, 0xB7, 0x17, 0x86, 0xA9, 0x94, 0xF8, 0x1C, 0xFB, 0x1B,
+    0xDF, 0xC4, 0xFC, 0xA4, 0xBE, 0xF7, 0x36, 0xEA, 0x27, 0xCE, 0xE0, 0x9D, 0x2F, 0x7E, 0x6D, 0x69,
+    0xB7, 0x7D, 0x35, 0x7D, 0x01, 0xCD, 0x5B, 0xBF, 0x93, 0xDD, 0xD4, 0x15, 0xBE, 0xEF, 0x29, 0x8B,
+    0x66, 0x50, 0xA1, 0x14, 0xDE, 0x22, 0x49, 0xA1, 0x9E, 0x02, 0xFD, 0x07, 0x5C, 0x25, 0x14, 0x29,
+    0x52, 0xB0, 0xC5, 0x6E, 0x32, 0x13, 0x0A, 0xFA, 0x90, 0x19, 0xFF, 0x03, 0x09, 0x12, 0x43, 0x97,
+    0x14, 0xD0, 0xA7, 0x88, 0x0B, 0x0A, 0x66, 0x29, 0xFC, 0x0F, 0x60, 0x4B, 0xE0, 0xCC, 0x50, 0x50,
+    0x20, 0xA0, 0x48, 0x19, 0x91, 0x30, 0x49, 0xC6, 0x2E, 0x2C, 0x40, 0x09, 0xB2, 0xD1, 0xD3, 0xCD,
+    0xF7, 0x9D, 0x73, 0xA5, 0xA7, 0x67, 0x7B, 0x9D, 0x75, 0xD8, 0x7D, 0xCE, 0xDA, 0xBA, 0x6B, 0x3F,
+    0xE9, 0xDD, 0x7B, 0xCE, 0x77, 0xCF, 0x3D, 0xBF, 0x65, 0xCC, 0x33, 0xA7, 0xEF, 0x18, 0x13, 0xBB,
+    0xC1, 0x0F, 0x07, 0x27, 0x47, 0x46, 0x7F, 0x02, 0x97, 0x19, 0x13, 0xB9, 0x82, 0x37, 0x30, 0xA4,
+    0xAE, 0x32, 0xC6, 0xDE, 0xC5, 0x50, 0x5E, 0xC5, 0xE0, 0xD2, 0xCA, 0xAC, 0x37, 0x18, 0x82, 0x21,
+    0xA9, 0x4D, 0xD4, 0x61, 0x48, 0xDA, 0xA4, 0x31, 0xB6, 0xC6, 0x90, 0xDF, 0xBE, 0xDE, 0x18, 0xE7,
+    0x5C, 0xBB, 0xE2, 0x10, 0x70, 0x08, 0x07, 0x13, 0xB7, 0x71, 0x8F, 0x21, 0x69, 0x4D, 0xDC, 0xD9,
+    0x06, 0x43, 0x5E, 0x99, 0xA8, 0x37, 0xCF, 0x9E, 0x5E, 0xC3, 0xE4, 0x9D, 0xB1, 0xAE, 0x35, 0x87,
+    0x7E, 0x75, 0xDB, 0xDE, 0x5C, 0xB9, 0x61, 0x0C, 0x9D, 0xDB, 0xC4, 0xE3, 0xD5, 0x21, 0xE9, 0xE3,
+    0xC1, 0xB6, 0x51, 0x6F, 0xEB, 0xA8, 0xCF, 0xAB, 0xB8, 0x2B, 0xAB, 0xB8, 0x2D, 0xAB, 0x04, 0x97,
+    0x6D, 0xCA, 0x2A, 0xAF, 0xCB, 0xBF, 0xBB, 0x2A, 0x77, 0xAE, 0x4A, 0x5D, 0x59, 0x45, 0x1B, 0x5B,
+    0x98, 0x8C, 0x93, 0x1C, 0x98, 0x43, 0x63, 0x92, 0xEC, 0x05, 0x0C, 0xB7, 0x85, 0xBD, 0x9E, 0x4C,
+    0xD5, 0xB8, 0x73, 0xC5, 0xEC, 0x99, 0xC7, 0x43, 0x2C, 0x69, 0xCD, 0x7B, 0xC6, 0xDE, 0xE9, 0x4D,
+    0x02, 0x3E, 0x43, 0x2E, 0xE4, 0xA9, 0xB8, 0x10, 0x5E, 0xF7, 0xC5, 0x08, 0xB0, 0xC4, 0xF4, 0xE6,
+    0x26, 0xAE, 0x15, 0xFF, 0xB7, 0xEE, 0xB8, 0xF8, 0x88, 0xCF, 0x56, 0x5C, 0xD2, 0x94, 0x85, 0x99,
+    0x7F, 0xBE, 0x33, 0x63, 0x37, 0x30, 0x35, 0xE6, 0x8F, 0xB0, 0x65, 0x31, 0x26, 0x8F, 0xEF, 0xE1,
+    0xDA, 0x60, 0xCD, 0xCD, 0xB4, 0xC2, 0x21, 0x79, 0x2F, 0x2B, 0x2E, 0x4E, 0x32, 0xB0, 0xC9, 0x26,
+    0x6E, 0xB8, 0xF3, 0xD9, 0xF4, 0x44, 0x39, 0x66, 0x80, 0x05, 0x88, 0x5B, 0xE7, 0xC0, 0xE5, 0x58,
+    0x56, 0x81, 0xAB, 0xD6, 0x45, 0x38, 0xF2, 0x51, 0x3E, 0x9F, 0x90, 0x81, 0xB4, 0x25, 0xB9, 0xFC,
+    0xA6, 0xAD, 0xA7, 0x21, 0x9F, 0x07, 0xFD, 0x4C, 0xEE, 0x76, 0xE6, 0xFB, 0x26, 0x19, 0x7F, 0x09,
+    0x50, 0x38, 0x67, 0xC0, 0xC1, 0xE4, 0xEE, 0x2D, 0x10, 0x20, 0x72, 0x7B, 0x78, 0xA4, 0x0F, 0x62,
+    0x0B, 0x48, 0x64, 0xD8, 0x6D, 0x49, 0x49, 0x5D, 0x01, 0x7C, 0xB1, 0xBA, 0x2B, 0xE2, 0xF1, 0xE5,
+    0x2C, 0xED, 0xF4, 0x49, 0x2E, 0x90, 0x57, 0xCA, 0x04, 0xB1, 0x93, 0x0B, 0xFF, 0xCE, 0xFF, 0xF5,
+    0x6B, 0x90, 0x3C, 0x40, 0x58, 0x06, 0x2C, 0xD3, 0x79, 0x61, 0x39, 0x38, 0x26, 0xC5, 0x64, 0x3F,
+    0x07, 0xC3, 0xAB, 0x11, 0x20, 0x45, 0x5D, 0x5C, 0x63, 0x91, 0x55, 0xF6, 0x34, 0x18, 0x5E, 0x1D,
+    0x53, 0xDE, 0xF0, 0x18, 0x18, 0x76, 0x49, 0x15, 0xF4, 0x51, 0xBB, 0x3A, 0x52, 0x28, 0x2E, 0x86,
+    0x61, 0xF9, 0x21, 0x8C, 0x4A, 0x7B, 0x4C, 0x91, 0x8B, 0x5A, 0xB3, 0xFC, 0xD9, 0xEF, 0x0E, 0x53,
+    0xE4, 0x31, 0x69, 0xC8, 0xDD, 0xC5, 0xEF, 0xA0, 0xDF, 0x12, 0x72, 0x11, 0x0C, 0x63, 0x91, 0x23,
+    0x2C, 0x40, 0x16, 0x47, 0x5B, 0xE9, 0x36, 0x1B, 0x4B, 0x2E, 0x0E, 0x8E, 0x9E, 0x0A, 0xC3, 0x47,
+    0xE6, 0xD8, 0x6C, 0xC0, 0x65, 0x4E, 0x6D, 0x81, 0x5D, 0x4E, 0x46, 0x2F, 0x85, 0x17, 0xB5, 0xC3,
+    0xC7, 0xF8, 0x63, 0x46, 0x62, 0x6A, 0x5F, 0x6A, 0xBD, 0xE2, 0xA2, 0x48, 0xCD, 0xAB, 0xE0, 0x3B,
+    0x6F, 0x71, 0x18, 0x49, 0x16, 0xEE, 0x96, 0xC2, 0x75, 0x91, 0xB7, 0xC6, 0x65, 0x49, 0x6F, 0x1C,
+    0x84, 0x02, 0xA7, 0x3F, 0x1A, 0xD6, 0x1C, 0x82, 0x91, 0xC3, 0x06, 0x9F, 0x41, 0x19, 0xC4, 0x3D,
+    0xB6, 0x28, 0xE9, 0xA2, 0x01, 0x60, 0x40, 0x72, 0xF2, 0x26, 0xEE, 0x8C, 0x83, 0xC2, 0x09, 0x5D,
+    0x91, 0xDC, 0xC7, 0x7C, 0xA9, 0x83, 0x45, 0x00, 0x88, 0x35, 0x86, 0xC5, 0x3E, 0x9A, 0xFC, 0x16,
+    0x51, 0xCC, 0x3F, 0x24, 0x8C, 0xE5, 0x9B, 0x04, 0xC9, 0xBD, 0x44, 0xDD, 0xE6, 0x9E, 0x35, 0x5E,
+    0xD3, 0xD8, 0x2F, 0x47, 0xFE, 0x6B, 0xC4, 0x48, 0xED, 0x06, 0x8A, 0xA1, 0xDF, 0x08, 0x3C, 0xF1,
+    0xA7, 0x8E, 0x23, 0xC2, 0x51, 0x47, 0x1C, 0xB0, 0xA6, 0xA1, 0xA6, 0x23, 0x0E, 0x89, 0x8C, 0x69,
+    0xC3, 0x4F, 0x88, 0x52, 0xF9, 0xB9, 0xA8, 0x69, 0x72, 0x05, 0x62, 0xA8, 0xAD, 0x23, 0x1E, 0x69,
+    0xA3, 0x2A, 0xFD, 0x89, 0x18, 0x07, 0xB0, 0x1C, 0xFA, 0xB8, 0xCF, 0x5D, 0x17, 0xF7, 0xE9, 0x78,
+    0xED, 0xC9, 0x19, 0xCF, 0x2B, 0xAF, 0x4D, 0x79, 0x5B, 0x06, 0x6C, 0x6F, 0xA7, 0x2C, 0x1F, 0xFC,
+    0x18, 0x64, 0x94, 0x5F, 0x8D, 0x66, 0x4D, 0x7E, 0x21, 0x7E, 0x80, 0x77, 0x93, 0xF8, 0x05, 0x84,
+    0xD7, 0xBC, 0x82, 0xD4, 0x0A, 0xA7, 0x65, 0x21, 0x03, 0xF8, 0x84, 0x6A, 0xAF, 0x95, 0x4B, 0x61,
+    0x32, 0x75, 0xD7, 0x61, 0x44, 0xC6, 0xB4, 0xA0, 0x5C, 0x11, 0xCB, 0xD3, 0x53, 0x5A, 0x2E, 0xE7,
+    0x87, 0xD5, 0xC9, 0x76, 0xCB, 0x21, 0x6A, 0x32, 0x80, 0xF3, 0x8C, 0x9C, 0x8B, 0x4E, 0xC5, 0x40,
+    0x64, 0xDC, 0xB4, 0x0D, 0x6B, 0x77, 0xFA, 0x36, 0xBF, 0xDA, 0xA9, 0xD8, 0xCA, 0xC0, 0x53, 0xA9,
+    0x86, 0x4A, 0x94, 0x05, 0xE1, 0x37, 0xC4, 0xDD, 0x24, 0xF7, 0x4F, 0x0B, 0x72, 0x5E, 0x2D, 0x66,
+    0x37, 0x3F, 0x84, 0xEF, 0x61, 0xE5, 0x28, 0xD1, 0xF7, 0x50, 0xD8, 0x13, 0x2C, 0x02, 0xA8, 0x39,
+    0x5B, 0xBC, 0x89, 0xBB, 0xA4, 0x8D, 0x60, 0x00, 0x61, 0x04, 0x3F, 0x29, 0x5B, 0xEE, 0x43, 0x09,
+    0x00, 0xCB, 0xDB, 0xD9, 0x56, 0xAC, 0x9B, 0x88, 0x93, 0xF1, 0xF8, 0x80, 0xA0, 0x7B, 0x74, 0x3B,
+    0x40, 0x1E, 0x15, 0x72, 0xD0, 0xC0, 0x6A, 0x05, 0x63, 0x99, 0x11, 0x34, 0x42, 0xDB, 0x1B, 0xBD,
+    0xBB, 0x5F, 0x1E, 0xAF, 0xE0, 0x84, 0xFD, 0xD6, 0x60, 0x97, 0xDE, 0xA5, 0x8F, 0xD5, 0xA8, 0x97,
+    0xE0, 0xB5, 0xC9, 0x45, 0xF0, 0xAA, 0x3F, 0x62, 0x77, 0x45, 0xE9, 0xC8, 0x90, 0xD4, 0x4B, 0x1D,
+    0xBD, 0x37, 0x5E, 0xE5, 0xC7, 0x71, 0x26, 0xBD, 0xCC, 0x66, 0x4B, 0xC4, 0x45, 0xF0, 0xBA, 0x3F,
+    0x46, 0xF8, 0x74, 0xC0, 0xDB, 0xF4, 0x7C, 0x4C, 0x22, 0xC3, 0x3F, 0x27, 0x0D, 0x2F, 0x73, 0x5D,
+    0x0C, 0x63, 0x34, 0x64, 0xAD, 0xAE, 0x62, 0x8D, 0xBF, 0xAE, 0x89, 0x59, 0x10, 0x43, 0x0B, 0x41,
+    0x3E, 0x02, 0x1D, 0xD8, 0xCE, 0xF5, 0x00, 0x41, 0x36, 0x4E, 0x9C, 0x8F, 0xCE, 0xFB, 0x3A, 0xFB,
+    0x16, 0x64, 0xF8, 0xF3, 0x76, 0x05, 0x45, 0x94, 0x7E, 0xD4, 0xD1, 0x4A, 0xD4, 0x54, 0xBF, 0x74,
+    0x3D, 0x4F, 0x96, 0x50, 0x10, 0x0B, 0x9D, 0x9E, 0x68, 0x18, 0xC2, 0x61, 0x88, 0x87, 0x21, 0x20,
+    0x93, 0x2A, 0xA5, 0x36, 0x03, 0x26, 0xEA, 0xAF, 0x12, 0x15, 0x81, 0x45, 0x70, 0x11, 0x60, 0x74,
+    0xCB, 0xBD, 0x7C, 0xCB, 0xFC, 0x91, 0x53, 0x93, 0x87, 0xC7, 0x5F, 0xA9, 0xE1, 0x6B, 0x02, 0xB5,
+    0xD9, 0xD7, 0x51, 0x8B, 0x19, 0x79, 0xB5, 0x0A, 0x05, 0x3D, 0x5E, 0x6F, 0xD6, 0x20, 0xEF, 0xAD,
+    0xD0, 0xCD, 0x46, 0xB9, 0xDF, 0x1A, 0x65, 0x44, 0x3C, 0xB6, 0x49, 0x5C, 0x63, 0xEB, 0xD4, 0xD5,
+    0x39, 0x06, 0x5A, 0x83, 0x5C, 0x74, 0x65, 0x01, 0x0B, 0xEA, 0x32, 0xA0, 0xEF, 0x60, 0x6A, 0x5F,
+    0x76, 0x9C, 0x93, 0xBB, 0xA4, 0x46, 0xE0, 0x0B, 0xE3, 0x0F, 0xAE, 0xF8, 0xBD, 0x34, 0xD4, 0x01,
+    0x35, 0x75, 0xFC, 0x25, 0xAD, 0x4E, 0x51, 0xE2, 0x73, 0x22, 0xA4, 0x40, 0x0C, 0x29, 0xF7, 0xC3,
+    0xD2, 0x42, 0xBB, 0x2C, 0x70, 0x7F, 0x70, 0xF0, 0x59, 0x02, 0x6C, 0xFA, 0xB0, 0x1E, 0x81, 0x33,
+    0x86, 0xA4, 0x85, 0x9D, 0x4C, 0xDB, 0x80, 0x3A, 0x3C, 0xF4, 0x8A, 0x3C, 0x6D, 0x61, 0xC4, 0xD3,
+    0x7B, 0x80, 0x29, 0x11, 0xFC, 0xDC, 0xDD, 0x16, 0x8B, 0xA7, 0x5B, 0x2F, 0x42, 0xCC, 0x60, 0x65,
+    0x5E, 0x7B, 0x19, 0x38, 0xE7, 0x4A, 0x14, 0x08, 0xF8, 0x91, 0x1E, 0xBD, 0x63, 0x12, 0x37, 0xAC,
+    0x69, 0xE4, 0xAE, 0x8B, 0x13, 0x51, 0x71, 0x43, 0x8C, 0x99, 0xB5, 0xCD, 0x9E, 0x61, 0x3A, 0xE0,
+    0xF6, 0xC5, 0x05, 0x44, 0x3A, 0xBE, 0x2F, 0x96, 0x7A, 0xE0, 0xB6, 0x92, 0x99, 0x43, 0xF3, 0x14,
+    0x61, 0x9A, 0x9D, 0x48, 0x13, 0xF0, 0x30, 0xD1, 0x95, 0xDC, 0xF1, 0x23, 0xF7, 0x2E, 0x4D, 0x7A,
+    0x8A, 0xAB, 0xD9, 0x41, 0xE4, 0xBF, 0x6C, 0xB6, 0xA3, 0x61, 0x9E, 0x16, 0x4C, 0xFB, 0x07, 0x22,
+    0x92, 0x60, 0xA3, 0x9D, 0x74, 0xAE, 0xE0, 0xA0, 0xE2, 0x22, 0x67, 0x3D, 0x6A, 0xE6, 0x3B, 0xA2,
+    0x39, 0x78, 0x7B, 0xD6, 0x3E, 0xF1, 0x53, 0x80, 0x49, 0x75, 0x9F, 0xA8, 0x41, 0x7C, 0x5F, 0x36,
+    0x91, 0x2E, 0xEB, 0x6A, 0xC3, 0xC8, 0x59, 0xC2, 0x89, 0x69, 0x83, 0x6B, 0x52, 0x8B, 0x91, 0xB3,
+    0x54, 0x54, 0xC9, 0x65, 0xB5, 0x16, 0x55, 0x0D, 0xBA, 0xF0, 0x21, 0x85, 0x11, 0xE3, 0x40, 0x6D,
+    0x0D, 0xD2, 0xA0, 0xAE, 0xAF, 0xD3, 0x4F, 0x27, 0xF8, 0x1C, 0x45, 0x6D, 0xAB, 0xCA, 0x86, 0x86,
+    0xA6, 0x6B, 0xD9, 0x50, 0x69, 0x4B, 0x6A, 0x80, 0xB3, 0xE2, 0x43, 0x08, 0x8E, 0x8E, 0xF4, 0xFC,
+    0x0A, 0xBF, 0x94, 0x8E, 0xEA, 0xCD, 0x4B, 0x20, 0x53, 0x8E, 0x8C, 0xE0, 0xF3, 0x8C, 0xC9, 0x85,
+    0x0A, 0x91, 0xEB, 0x1C, 0xAB, 0x6F, 0x99, 0xCD, 0xE7, 0x4C, 0xC2, 0xC2, 0x8E, 0x00, 0xA4, 0xD5,
+    0x08, 0xF3, 0xB3, 0xE6, 0xD6, 0x05, 0xEE, 0xCF, 0x1C, 0x48, 0xEA, 0x68, 0x48, 0x2F, 0x3D, 0xE1,
+    0x5E, 0x50, 0xA6, 0xF7, 0x4F, 0x94, 0x93, 0x2D, 0xCA, 0x4D, 0x44, 0x1F, 0x95, 0x74, 0xD2, 0x3D,
+    0xCD, 0x2B, 0x9A, 0x98, 0x25, 0x75, 0x02, 0x07, 0xB4, 0x3E, 0xB8, 0x4C, 0x38, 0xB6, 0x3A, 0x62,
+    0x62, 0xCC, 0x73, 0x5E, 0x38, 0xDA, 0x47, 0xC0, 0x91, 0xD2, 0x23, 0x5E, 0xC0, 0x31, 0x81, 0x32,
+    0xF3, 0x0B, 0x76, 0x21, 0x8A, 0x55, 0xEC, 0x2F, 0xB9, 0xE7, 0x60, 0x73, 0xC1, 0xED, 0x1A, 0xCC,
+    0x62, 0x8D, 0x31, 0x70, 0x9F, 0x39, 0x72, 0x1A, 0x6E, 0x56, 0x0E, 0xCE, 0xFE, 0x88, 0xD0, 0x66,
+    0x43, 0x06, 0xC9, 0x1F, 0xD9, 0x23, 0x77, 0x64, 0x8E, 0xBC, 0x29, 0x6B, 0xE2, 0x8D, 0x3D, 0x6F,
+    0xEC, 0x78, 0x03, 0x86, 0x6E, 0x30, 0x1D, 0xA8, 0x38, 0x5A, 0x4D, 0xE7, 0x09, 0xB4, 0x30, 0x8C,
+    0xC0, 0x5A, 0xCC, 0x23, 0xD0, 0xE2, 0x52, 0xD8, 0xF9, 0x35, 0x9E, 0x22, 0xC6, 0x6F, 0x9E, 0x2E,
+    0x8D, 0xE1, 0x0A, 0xDD, 0x03, 0xD0, 0x45, 0x89, 0xE1, 0x15, 0x4A, 0xBC, 0xAF, 0xD3, 0x94, 0x4E,
+    0xDD, 0x3C, 0x04, 0xFE, 0xA0, 0xFF, 0x7A, 0x06, 0x8B, 0x6D, 0x5E, 0x00, 0x18, 0x57, 0x26, 0xB1,
+    0xF3, 0xDF, 0xA1, 0x9C, 0x21, 0x34, 0x13, 0x85, 0x47, 0x9B, 0xCF, 0x8B, 0x66, 0x5F, 0x96, 0xEF,
+    0xB6, 0xCB, 0xA7, 0x0F, 0x2C, 0x2F, 0xFE, 0x79, 0x3A, 0xFB, 0xE7, 0x47, 0x97, 0xC5, 0xC3, 0x33,
+    0xA7, 0xEF, 0xC4, 0x6E, 0xC0, 0x5F, 0x9F, 0xFD, 0x74, 0x7C, 0x0A, 0x44, 0x83, 0x66, 0x90, 0x0C,
+    0x6A, 0xF1, 0x17, 0xF4, 0x62, 0x25, 0x71, 0x28, 0xB8, 0x4C, 0xCA, 0xEC, 0x19, 0xD7, 0xC8, 0x25,
+    0x93, 0x77, 0xC5, 0xBC, 0x00, 0x97, 0xCD, 0xDE, 0xE9, 0x84, 0xDC, 0xA5, 0x8B, 0x7D, 0x09, 0xE4,
+    0xD2, 0xB0, 0xD1, 0xAE, 0xD1, 0xAC, 0x45, 0x6E, 0x50, 0xA3, 0x76, 0xC5, 0x5C, 0x0C, 0xE4, 0x97,
+    0x21, 0x22, 0x37, 0xD4, 0x97, 0x7D, 0x30, 0x91, 0x17, 0x2C, 0xBC, 0x73, 0x18, 0xC4, 0x50, 0xA0,
+    0x9E, 0x4D, 0x21, 0x16, 0x55, 0xA8, 0xAD, 0x40, 0x9D, 0x0B, 0xD4, 0x58, 0x8D, 0xDE, 0x6E, 0xA6,
+    0xFB, 0xB3, 0x96, 0xFD, 0x09, 0x64, 0x7F, 0xD6, 0xD8, 0x9C, 0xDA, 0xA4, 0x19, 0x5D, 0x58, 0xFB,
+    0x85, 0x49, 0x7B, 0x55, 0xE5, 0x53, 0xD2, 0x84, 0x94, 0x29, 0x85, 0x66, 0x5C, 0x1A, 0xDA, 0x8B,
+    0x67, 0xF6, 0x49, 0x85, 0x07, 0x34, 0xE0, 0x53, 0x7C, 0x1D, 0x37, 0x40, 0x07, 0x96, 0x04, 0x25,
+    0xB8, 0x2D, 0xFA, 0xCA, 0xC4, 0x93, 0x5E, 0xC5, 0xD2, 0x7C, 0xA0, 0x30, 0x62, 0xCA, 0xF0, 0x00,
+    0x17, 0xB7, 0xA2, 0xC2, 0xF3, 0x8A, 0x2A, 0xBC, 0x2C, 0x44, 0x85, 0x17, 0x4C, 0x83, 0xBA, 0x2C,
+    0x14, 0x45, 0x1E, 0xC9, 0x08, 0xC5, 0x04, 0x2A, 0x63, 0x09, 0xFF, 0x74, 0x29, 0x19, 0x6B, 0xB1,
+    0x31, 0xAA, 0x77, 0x35, 0x8B, 0xFA, 0xAE, 0x93, 0x5C, 0xAA, 0xFA, 0xEC, 0x1B, 0x19, 0x9B, 0x1D,
+    0xC7, 0xC4, 0xA4, 0xA2, 0x41, 0xEB, 0x94, 0x54, 0x71, 0x6B, 0x8A, 0x78, 0x19, 0xE8, 0x39, 0x55,
+    0xA5, 0x65, 0x01, 0xAA, 0x40, 0xC8, 0x28, 0x66, 0x65, 0xE5, 0xF5, 0x73, 0x48, 0x2B, 0x18, 0xF5,
+    0xD4, 0xCF, 0x1D, 0xB3, 0x33, 0x9D, 0xE8, 0xCE, 0x29, 0x49, 0x91, 0x8A, 0x87, 0x5E, 0x63, 0x76,
+    0x5B, 0x25, 0x7E, 0xF6, 0x65, 0x02, 0x8B, 0xF4, 0x3D, 0x47, 0xE8, 0xAD, 0x24, 0x60, 0x48, 0x9C,
+    0xFD, 0x62, 0xE1, 0x9C, 0x67, 0x3E, 0x77, 0x54, 0xBE, 0xD4, 0x40, 0x96, 0x82, 0x76, 0x69, 0xFB,
+    0xC2, 0xDD, 0x08, 0x43, 0xAD, 0x7B, 0xFB, 0x70, 0x92, 0x2C, 0x3F, 0xC3, 0xF8, 0xF8, 0xF8, 0xC5,
+    0xE8, 0x89, 0x52, 0xB1, 0x0D, 0xE6, 0x38, 0x2C, 0x1A, 0x76, 0x66, 0xB7, 0x98, 0xF3, 0x57, 0x84,
+    0xAD, 0x14, 0x72, 0xE6, 0xC0, 0x7F, 0x91, 0xB2, 0x96, 0xF0, 0x07, 0xE2, 0xF0, 0x15, 0x34, 0x46,
+    0x71, 0x53, 0xE3, 0x9A, 0x33, 0x8E, 0x6E, 0xB0, 0x3C, 0xBA, 0xFD, 0xF6, 0xE8, 0x26, 0xCB, 0xA3,
+    0xBB, 0x48, 0xB8, 0x81, 0x66, 0xCA, 0xF9, 0xBB, 0x4E, 0x0D, 0x2D, 0x57, 0x2E, 0x35, 0xE1, 0xB7,
+    0x16, 0x71, 0x89, 0x36, 0x7C, 0x96, 0x5E, 0x53, 0x59, 0xE5, 0x92, 0xA9, 0x26, 0x95, 0xEE, 0x45,
+    0x92, 0xE9, 0xE8, 0x51, 0xD1, 0xF4, 0x80, 0x84, 0x91, 0x37, 0x83, 0x91, 0x10, 0x04, 0x8C, 0xEA,
+    0x38, 0x16, 0x92, 0xED, 0x62, 0x96, 0x6A, 0xE0, 0x92, 0x30, 0x39, 0x0C, 0x1C, 0x69, 0x5E, 0x40,
+    0x0E, 0x89, 0xC3, 0x38, 0x90, 0x2C, 0xBA, 0xB4, 0xB6, 0x26, 0x0B, 0x2A, 0x9F, 0x3B, 0x3F, 0x6A,
+    0xA1, 0xD2, 0xCA, 0xCC, 0x5E, 0xE6, 0x4D, 0xA3, 0xD1, 0x83, 0x31, 0xE7, 0xF3, 0x04, 0x10, 0xAA,
+    0xAD, 0x60, 0x10, 0xE1, 0xB7, 0x84, 0x3C, 0x62, 0x58, 0x39, 0x18, 0xB0, 0x89, 0xE1, 0x80, 0x67,
+    0x42, 0xFA, 0x47, 0x91, 0x56, 0xB3, 0x36, 0x3E, 0x94, 0x4B, 0xEE, 0xE1, 0x7B, 0x69, 0xCB, 0x04,
+    0x54, 0x03, 0x8F, 0xD0, 0xD6, 0x56, 0x84, 0x8C, 0x29, 0xAB, 0x78, 0xC7, 0xEF, 0xD6, 0x25, 0x33,
+    0xAF, 0x22, 0x56, 0xC3, 0xE4, 0xF4, 0x2D, 0x97, 0x0C, 0x96, 0x4B, 0x06, 0xB2, 0xE4, 0xB7, 0x4F,
+    0xBE, 0xE4, 0x63, 0x0A, 0x05, 0x3B, 0xEA, 0xA6, 0x9A, 0xD5, 0xCD, 0x2C, 0x1C, 0xE3, 0x19, 0xC2,
+    0xB1, 0xD0, 0xEB, 0x8C, 0x9E, 0x19, 0x3C, 0x33, 0x6C, 0xB6, 0xB2, 0x7B, 0x22, 0x75, 0x85, 0x7C,
+    0x99, 0x87, 0x81, 0x87, 0xF6, 0xC0, 0x3C, 0xF1, 0x7A, 0x8F, 0xB3, 0x23, 0x0F, 0x6A, 0xCA, 0xCB,
+    0xE1, 0x63, 0xD2, 0xE6, 0x7E, 0x9E, 0x41, 0x0B, 0x44, 0x53, 0x14, 0x3E, 0xDB, 0x82, 0x88, 0xC9,
+    0x5F, 0xD1, 0xB8, 0x6A, 0x43, 0x9A, 0xC7, 0xD8, 0x90, 0x60, 0x61, 0x43, 0xE6, 0x10, 0x80, 0xDF,
+    0xAB, 0x28, 0x9E, 0x87, 0xC2, 0x09, 0x64, 0xC2, 0x56, 0xA2, 0x68, 0x41, 0x6D, 0xF9, 0x01, 0xB3,
+    0xA3, 0x6F, 0x34, 0x0F, 0x25, 0x38, 0xC6, 0xB3, 0x14, 0xC4, 0x56, 0xF3, 0x3C, 0x26, 0xC1, 0x31,
+    0x6D, 0xFF, 0xA7, 0x50, 0xFE, 0xB7, 0x7A, 0x93, 0x7F, 0x04, 0x15, 0xFD, 0x31, 0x3C, 0xC2, 0xDF,
+    0x65, 0xFB, 0xD9, 0x8E, 0xB0, 0x0B, 0xD4, 0xB7, 0xEC, 0x83, 0x21, 0x6A, 0xCF, 0xBD, 0x1D, 0xE7,
+    0xDE, 0xE6, 0xA4, 0x0E, 0x71, 0x64, 0x78, 0x45, 0x7D, 0x5A, 0xFD, 0x57, 0x7A, 0xA3, 0x07, 0x2C,
+    0xF1, 0xAC, 0xEC, 0xFE, 0x84, 0x07, 0x46, 0x55, 0xAC, 0x8E, 0xE9, 0x68, 0x6C, 0x2F, 0xCF, 0x1A,
+    0xF3, 0x36, 0xA3, 0x46, 0xD3, 0x33, 0x36, 0xE3, 0xE9, 0x35, 0x16, 0x4A, 0x70, 0x22, 0x9B, 0xD8,
+    0xA9, 0xAB, 0xEA, 0x2D, 0xEF, 0x64, 0x7C, 0xBD, 0x28, 0x90, 0x6C, 0x98, 0x3A, 0x4C, 0x16, 0xBA,
+    0x06, 0xB3, 0x97, 0x50, 0xCC, 0x3D, 0x5D, 0x88, 0x1D, 0x11, 0xAA, 0xBD, 0xA9, 0xF4, 0x21, 0x97,
+    0x38, 0x2F, 0xB2, 0xA3, 0xAA, 0x38, 0xE8, 0x63, 0xEC, 0xE8, 0x31, 0x84, 0x9B, 0x51, 0xCB, 0x89,
+    0x68, 0x32, 0x59, 0x51, 0x35, 0x25, 0xC2, 0x12, 0x96, 0x6C, 0x4C, 0x8A, 0x30, 0xC0, 0xF1, 0x6B,
+    0x23, 0xA2, 0xD2, 0x6A, 0xB5, 0x29, 0x8B, 0xBC, 0x58, 0x6F, 0x6C, 0x05, 0x1B, 0x3E, 0x60, 0x44,
+    0x18, 0x96, 0x36, 0xB0, 0x98, 0x7D, 0xDC, 0xCA, 0xF8, 0x25, 0x0C, 0x67, 0x17, 0xDD, 0x63, 0x64,
+    0x13, 0x8E, 0x9C, 0x29, 0x60, 0x1D, 0x05, 0xF4, 0xC2, 0x78, 0xC2, 0x0F, 0xE8, 0xA9, 0x4E, 0x9D,
+    0xB8, 0x0B, 0x65, 0x2B, 0x9C, 0x89, 0x8E, 0x3D, 0x99, 0xAC, 0x96, 0x48, 0xA1, 0x58, 0x3D, 0x09,
+    0x5A, 0xE7, 0xEC, 0xC7, 0xC0, 0x98, 0x6A, 0x00, 0x51, 0x88, 0x35, 0x96, 0x31, 0x55, 0xF0, 0xBF,
+    0xC6, 0x54, 0x4F, 0x99, 0xE1, 0xED, 0x8F, 0x1C, 0x3E, 0x2D, 0x1C, 0x6A, 0x66, 0x5A, 0x63, 0xF6,
+    0x45, 0xBE, 0xFA, 0xC2, 0x99, 0x3F, 0x87, 0x19, 0xA1, 0xE3, 0x9E, 0x91, 0x14, 0xDE, 0x8C, 0xBE,
+    0x12, 0x2D, 0xC1, 0x02, 0x8B, 0x59, 0xAB, 0x70, 0x9E, 0x64, 0xFF, 0x1F, 0xA2, 0x23, 0xE5, 0xE4,
+    0xA8, 0x65, 0xBF, 0x40, 0x2F, 0xE7, 0x78, 0xF0, 0xE9, 0x46, 0x4D, 0x3C, 0x5E, 0x02, 0x7A, 0xAA,
+    0x3B, 0x87, 0xC9, 0x57, 0x93, 0x12, 0xAF, 0x56, 0x14, 0x6E, 0xB5, 0x65, 0x6D, 0x7F, 0xFA, 0xB5,
+    0xEB, 0x0E, 0xA3, 0x6F, 0x59, 0x74, 0x72, 0xAF, 0x60, 0x18, 0xE8, 0x3A, 0x4A, 0x75, 0xEF, 0xAC,
+    0x09, 0xA5, 0xD8, 0xE6, 0x58, 0x83, 0x02, 0x4A, 0x40, 0x0C, 0xB7, 0x56, 0xF4, 0x4E, 0xE9, 0x9E,
+    0x11, 0xD9, 0xCE, 0x23, 0x0B, 0x4C, 0x71, 0xD8, 0x93, 0x7A, 0x17, 0xD9, 0x52, 0x90, 0xCD, 0x89,
+    0xEC, 0x84, 0x69, 0x0D, 0xDE, 0x06, 0x62, 0x1A, 0x28, 0xB2, 0x5D, 0x78, 0x8F, 0xC8, 0x06, 0x23,
+    0xF9, 0x23, 0x9A, 0x71, 0xBB, 0x12, 0x64, 0x0D, 0x30, 0xC5, 0x7C, 0xA5, 0x20, 0x6B, 0x05, 0x59,
+    0x31, 0xFE, 0xDE, 0xF1, 0x49, 0xB6, 0x3E, 0xF7, 0xCF, 0xBD, 0xB7, 0x9D, 0x9D, 0xE9, 0x6D, 0x2B,
+    0xCA, 0xEE, 0xE2, 0x64, 0x54, 0xBD, 0xDE, 0xC9, 0xE1, 0xFD, 0xA1, 0x16, 0x1E, 0xE9, 0x3A, 0x13,
+    0xFF, 0x54, 0x8E, 0xCB, 0x73, 0xA7, 0x4C, 0x71, 0x4B, 0x20, 0xC3, 0xDB, 0x27, 0x93, 0x50, 0xAE,
+    0x4A, 0x75, 0x6E, 0x2A, 0x9F, 0x8B, 0xBB, 0x5F, 0x76, 0x81, 0x2B, 0x92, 0x21, 0x64, 0xC9, 0x35,
+    0x66, 0xF4, 0x06, 0xF7, 0x26, 0xD8, 0x40, 0x57, 0x07, 0x1B, 0xBA, 0x46, 0x1B, 0xAC, 0x10, 0xD2,
+    0x51, 0x8C, 0x06, 0x78, 0x40, 0xB1, 0x0C, 0x3D, 0xFE, 0x9B, 0xB6, 0xB8, 0x9B, 0x37, 0xB6, 0x5B,
+    0xB9, 0x8A, 0xB9, 0xB8, 0x2C, 0x66, 0x1A, 0x4E, 0x0A, 0x03, 0x08, 0x85, 0x0A, 0x9F, 0x8B, 0x7B,
+    0x54, 0x61, 0x0E, 0x44, 0xB2, 0xDE, 0x1C, 0x4A, 0x9D, 0xE3, 0x6A, 0x97, 0x76, 0x98, 0xAF, 0xC1,
+    0xEC, 0x95, 0x5C, 0x7D, 0x59, 0xC4, 0xBC, 0x3A, 0x6E, 0x3D, 0x7B, 0x4A, 0xF2, 0xCF, 0xD5, 0x54,
+    0xC5, 0x62, 0x26, 0x10, 0x2B, 0x7C, 0x6F, 0x37, 0x49, 0xED, 0xAE, 0x37, 0x53, 0x92, 0x7A, 0x5C,
+    0x26, 0xA9, 0xF7, 0xCB, 0xE8, 0xE3, 0x52, 0x07, 0x17, 0xC2, 0xB0, 0x39, 0xE6, 0xA1, 0x05, 0x95,
+    0x0C, 0xBC, 0x3B, 0x29, 0x62, 0x7C, 0xC0, 0x83, 0xF6, 0x5A, 0x48, 0x31, 0xB8, 0x32, 0x37, 0x8E,
+    0x28, 0xDF, 0xCA, 0xB8, 0x72, 0x2E, 0xAC, 0x1B, 0xE1, 0xDD, 0x08, 0xF3, 0x46, 0xB8, 0x37, 0xC2,
+    0xBE, 0x11, 0xFE, 0x8D, 0x00, 0x60, 0x04, 0x01, 0x23, 0x10, 0x18, 0xC1, 0x40, 0x46, 0xCA, 0x9F,
+    0x8F, 0xDF, 0x11, 0x4D, 0x08, 0x0E, 0x92, 0x7D, 0xCD, 0x8C, 0x20, 0xE1, 0xA1, 0xF0, 0x58, 0x78,
+    0x9E, 0x4F, 0x0E, 0x8E, 0xC0, 0x33, 0xC4, 0x94, 0xCA, 0x0C, 0x2A, 0x80, 0xC5, 0x9E, 0x9F, 0x74,
+    0x4B, 0x3A, 0x53, 0x29, 0xBD, 0x63, 0xAA, 0x50, 0x4B, 0x3C, 0x57, 0x81, 0x5B, 0x27, 0xA9, 0x37,
+    0x2E, 0x5E, 0xE9, 0xD0, 0xB3, 0x08, 0x2D, 0x43, 0xA7, 0xAA, 0x80, 0xF8, 0x98, 0xFC, 0xF3, 0xC9,
+    0xDF, 0x22, 0x44, 0x8A, 0x91, 0x07, 0x69, 0x82, 0x40, 0x92, 0x7A, 0x91, 0xA6, 0xFF, 0xAC, 0xCF,
+    0x02, 0xDE, 0xC7, 0xA7, 0x35, 0x61, 0x68, 0xE9, 0x53, 0xC8, 0x19, 0x8A, 0x25, 0xFF, 0x49, 0x24,
+    0x78, 0x8E, 0xC8, 0xE3, 0xED, 0x53, 0xE1, 0x93, 0x0A, 0xA4, 0x96, 0xFA, 0x12, 0xB5, 0x0E, 0x4E,
+    0xAE, 0xD5, 0xA4, 0x1E, 0x7F, 0xC9, 0xA9, 0xD3, 0xFE, 0x81, 0x46, 0x14, 0x9E, 0x6D, 0xC5, 0x5D,
+    0x24, 0x26, 0xA7, 0x6F, 0xFB, 0x04, 0xA4, 0xE4, 0x15, 0xB5, 0x07, 0x43, 0x7E, 0x99, 0x65, 0x22,
+    0x3E, 0xDD, 0xAC, 0x1D, 0x02, 0x11, 0xF7, 0x47, 0x37, 0x84, 0x7C, 0x6C, 0x8C, 0x37, 0xB9, 0x7B,
+    0xDD, 0x21, 0x80, 0x86, 0x42, 0xB0, 0x4D, 0x3C, 0xAC, 0x1D, 0x02, 0x8C, 0xE1, 0x95, 0x4D, 0xC9,
+    0x74, 0x22, 0x85, 0x03, 0x94, 0x63, 0xBC, 0xFF, 0x36, 0xEB, 0xF1, 0x2C, 0xCC, 0x54, 0x2C, 0xEC,
+    0x01, 0x87, 0xCD, 0xEA, 0x9A, 0xB0, 0xD7, 0x24, 0x6E, 0x94, 0xDA, 0x61, 0xCD, 0x6D, 0xB8, 0x62,
+    0x14, 0xE6, 0xFF, 0xDA, 0x57, 0xE5, 0x5B, 0x13, 0x36, 0xC6, 0xD7, 0xFC, 0xEE, 0x30, 0x77, 0x59,
+    0x94, 0xD5, 0xAC, 0x6D, 0x6B, 0xD1, 0xB6, 0x4C, 0x03, 0x54, 0x81, 0x7B, 0x99, 0xC9, 0x70, 0x3C,
+    0x2C, 0x1B, 0x2E, 0x21, 0xA4, 0x44, 0x90, 0x71, 0xCF, 0xA4, 0x69, 0x97, 0xB4, 0x1A, 0x3E, 0x6A,
+    0x2E, 0xA0, 0x11, 0x71, 0x0A, 0x9C, 0x44, 0xAC, 0x99, 0xF6, 0xBD, 0x90, 0x72, 0x3A, 0x85, 0x4E,
+    0x0B, 0x25, 0x93, 0xBB, 0xBF, 0x81, 0x01, 0x03, 0xA7, 0xD0, 0x8D, 0xD2, 0x83, 0x12, 0x48, 0xF8,
+    0xE7, 0x5D, 0xE2, 0xE1, 0x1C, 0x99, 0xAE, 0xFD, 0x31, 0xB1, 0xDD, 0xC0, 0x66, 0xF6, 0x0F, 0xCC,
+    0x54, 0x9D, 0x9E, 0x1D, 0x46, 0xFB, 0x33, 0xC4, 0x87, 0x57, 0x21, 0xAB, 0x65, 0x2B, 0x35, 0x4C,
+    0xFC, 0xE5, 0x91, 0x99, 0x53, 0x02, 0x0B, 0xD7, 0x36, 0x5A, 0xBA, 0xE7, 0xED, 0x14, 0x54, 0xFB,
+    0x00, 0xBB, 0xF1, 0x3C, 0x66, 0x92, 0x78, 0xD3, 0xF9, 0x57, 0x6C, 0xE4, 0x79, 0x7C, 0x63, 0xD1,
+    0xDE, 0xE0, 0x38, 0x86, 0x9C, 0x95, 0x6B, 0xE8, 0x8B, 0x37, 0x5B, 0x29, 0x59, 0xB0, 0xDD, 0x67,
+    0x75, 0x7C, 0x31, 0x7B, 0xAA, 0x5E, 0xAF, 0x1C, 0x2B, 0x09, 0xB4, 0xD3, 0x7A, 0xF2, 0xC5, 0x66,
+    0x98, 0x9F, 0xE1, 0xB1, 0x97, 0xB6, 0x1A, 0x76, 0xB1, 0xAC, 0xDC, 0x6D, 0xE6, 0xF5, 0xCD, 0xF7,
+    0x7D, 0xE8, 0x26, 0x83, 0x9B, 0x7D, 0x32, 0xE9, 0x8F, 0xB1, 0x32, 0x1D, 0xD5, 0xD4, 0x5A, 0x9B,
+    0x1C, 0xEB, 0x45, 0x5B, 0xD5, 0x11, 0x75, 0xDD, 0x6B, 0xB4, 0xE5, 0x02, 0x5B, 0x4E, 0x00, 0x13,
+    0x31, 0xE4, 0x9A, 0x91, 0x65, 0xA8, 0xCF, 0xBA, 0x1A, 0xEE, 0xAD, 0x7D, 0xB1, 0x7D, 0x3A, 0x46,
+    0xE5, 0x48, 0x0C, 0xAB, 0x88, 0x3A, 0xBB, 0x0F, 0x95, 0xB9, 0x8D, 0xB6, 0x71, 0x8A, 0x5F, 0x58,
+    0x0E, 0x6A, 0x9B, 0x02, 0x95, 0x80, 0xB7, 0xA1, 0x7C, 0x98, 0xD0, 0x2F, 0x71, 0x2F, 0x27, 0x75,
+    0x73, 0xCF, 0xE1, 0xE3, 0x6B, 0xC1, 0xFB, 0x65, 0x78, 0xA7, 0x27, 0x30, 0xD5, 0x9E, 0xC0, 0xCC,
+    0x1F, 0xD9, 0x0B, 0x61, 0xD8, 0x73, 0x44, 0x86, 0xC0, 0x0F, 0xD9, 0x21, 0x37, 0xC1, 0x14, 0x68,
+    0x3A, 0xCF, 0x09, 0x19, 0x21, 0x1F, 0x64, 0x43, 0xB8, 0x28, 0xEB, 0x29, 0x5D, 0x46, 0x0E, 0xC8,
+    0x00, 0xE9, 0x27, 0xF9, 0x42, 0xFD, 0x0D, 0xEF, 0xAF, 0xE7, 0x85, 0x64, 0xA7, 0x0E, 0x72, 0x5A,
+    0x89, 0x4C, 0x83, 0xF7, 0x0B, 0xA0, 0x7D, 0xD5, 0xA9, 0x22, 0x15, 0x8D, 0x8A, 0xC3, 0x7F, 0xE8,
+    0xA8, 0xCE, 0x7D, 0xB3, 0x9E, 0xC4, 0x05, 0x71, 0x8D, 0xE8, 0x2C, 0xFC, 0x72, 0xF4, 0x3B, 0xA9,
+    0xCE, 0xE0, 0x1C, 0x12, 0xEC, 0x77, 0x13, 0xA5, 0xED, 0x0F, 0xAE, 0x78, 0xF9, 0x88, 0xB6, 0xBF,
+    0x0B, 0xD8, 0x44, 0x98, 0x9E, 0x0D, 0x2F, 0xAC, 0x3D, 0xF0, 0x7A, 0x38, 0xCF, 0x5E, 0x3D, 0x94,
+    0x67, 0x7F, 0xB0, 0xA0, 0x11, 0x3D, 0x90, 0x15, 0x0D, 0x2B, 0x35, 0x52, 0x0C, 0x20, 0x58, 0x5D,
+    0xFF, 0x05, 0xAE, 0x92, 0xE4, 0xBC, 0xA5, 0x71, 0x9F, 0x95, 0x00, 0x9D, 0x05, 0x13, 0x2C, 0x8B,
+    0x55, 0x87, 0x1F, 0x6D, 0x8E, 0xE3, 0x47, 0x45, 0xF8, 0x0C, 0x82, 0x3E, 0xC9, 0x2C, 0x73, 0x1C,
+    0xB0, 0x9F, 0x19, 0xDC, 0xA4, 0x58, 0xEA, 0x7C, 0x08, 0xE4, 0x30, 0x27, 0xFC, 0x7A, 0x9E, 0x66,
+    0xB6, 0x2D, 0xB2, 0x6B, 0x91, 0x4D, 0x8B, 0xE9, 0xAE, 0x0E, 0xBB, 0x0C, 0xE6, 0xB6, 0x79, 0x6C,
+    0x68, 0xF0, 0x83, 0x18, 0x44, 0xA6, 0xD0, 0xD0, 0x3F, 0x10, 0x89, 0x05, 0x43, 0x00, 0x76, 0x90,
+    0x0B, 0x3C, 0xCD, 0xDF, 0x89, 0x1F, 0x91, 0x26, 0x16, 0x12, 0x3E, 0xC9, 0x64, 0x4F, 0xAD, 0x53,
+    0x09, 0x3F, 0xEF, 0x86, 0xB0, 0x37, 0x86, 0xFE, 0x0D, 0x9D, 0x9B, 0x57, 0xDD, 0x3B, 0x67, 0x57,
+    0x98, 0x26, 0x9A, 0xE9, 0x4B, 0xB0, 0xDC, 0xC3, 0x5C, 0xAF, 0xE5, 0x21, 0x74, 0x59, 0x82, 0xEF,
+    0xF3, 0x7A, 0xC6, 0x9D, 0x68, 0x6A, 0x88, 0x99, 0x62, 0x11, 0x8C, 0x56, 0xAE, 0x49, 0xBF, 0x0B,
+    0xED, 0xDD, 0x11, 0xE8, 0x6B, 0xE4, 0x92, 0xB6, 0xFD, 0x6D, 0x47, 0x70, 0x9E, 0x21, 0x2E, 0x72,
+    0xDF, 0x4A, 0x17, 0x11, 0x5C, 0xCF, 0xF7, 0x99, 0xF5, 0x9E, 0x1D, 0xB9, 0xB9, 0xE6, 0xB0, 0xDE,
+    0xA9, 0x39, 0x68, 0xE1, 0x61, 0xA7, 0xE6, 0x60, 0x1F, 0x51, 0x73, 0x10, 0x47, 0x11, 0x7B, 0x5F,
+    0x8B, 0xD9, 0xC3, 0x14, 0x16, 0x71, 0x33, 0x9C, 0xCE, 0xAB, 0x8C, 0x3D, 0xD5, 0xD4, 0x35, 0x9A,
+    0x5B, 0x37, 0x5B, 0xD7, 0x39, 0xEA, 0x12, 0x06, 0x52, 0x37, 0xBD, 0xFD, 0x7C, 0x8F, 0x87, 0xFA,
+    0x68, 0xF2, 0xDC, 0xB0, 0x24, 0xE3, 0x34, 0xA9, 0xC3, 0x2C, 0x82, 0xB5, 0x6D, 0xF0, 0x4A, 0xCF,
+    0x99, 0xD4, 0x54, 0x12, 0xAC, 0x09, 0x21, 0x96, 0x03, 0x9C, 0xE6, 0xFC, 0x53, 0x69, 0xD2, 0xBC,
+    0xCB, 0xE1, 0x95, 0x8A, 0x2D, 0x97, 0xD5, 0xE4, 0x11, 0x9E, 0x9E, 0x4A, 0xAB, 0x53, 0xE1, 0x23,
+    0xC8, 0x93, 0x93, 0xA7, 0xC2, 0xFE, 0xB3, 0x70, 0x5C, 0xB1, 0xA3, 0x9D, 0x91, 0xE0, 0x65, 0xAE,
+    0xD1, 0x5E, 0x16, 0xD3, 0x6C, 0xB8, 0x5A, 0xB7, 0x21, 0xD4, 0xE9, 0xA8, 0x8D, 0xAA, 0x99, 0xAF,
+    0x05, 0xCD, 0x7B, 0xB1, 0x5F, 0xF6, 0xF9, 0x5E, 0x07, 0x34, 0x0B, 0x6C, 0x47, 0x7A, 0x47, 0x0A,
+    0x00, 0x54, 0x44, 0xA2, 0x6D, 0x27, 0x61, 0xBD, 0x24, 0x20, 0x64, 0x75, 0x69, 0x7E, 0xB1, 0x34,
+    0x5C, 0xBF, 0x79, 0x7E, 0x1A, 0xE4, 0xBF, 0x72, 0xE3, 0x29, 0x41, 0x22, 0x9C, 0x8B, 0xD7, 0x1B,
+    0xDE, 0x61, 0xAD, 0xE8, 0x8D, 0xDA, 0x0F, 0x21, 0x1B, 0x9C, 0xD5, 0x1D, 0xBE, 0x6C, 0x70, 0x24,
+    0xE4, 0x8D, 0x7B, 0xAE, 0x95, 0xFC, 0x55, 0x4A, 0x85, 0x3F, 0xA5, 0x42, 0x1A, 0xA4, 0x97, 0xF2,
+    0x68, 0x9B, 0x04, 0x94, 0xAE, 0x97, 0xA9, 0xC1, 0x43, 0x46, 0x82, 0x63, 0x04, 0x1D, 0x19, 0xBB,
+    0x33, 0x1B, 0x3C, 0xE2, 0x29, 0xA7, 0x33, 0xB7, 0x79, 0x08, 0x4C, 0x73, 0x5F, 0x89, 0x94, 0xDB,
+    0x88, 0x94, 0x42, 0xA5, 0x58, 0x79, 0xB0, 0x14, 0xAD, 0x69, 0x83, 0x0E, 0x7F, 0x7C, 0xC4, 0x0E,
+    0xF3, 0x0E, 0xEE, 0x21, 0xE3, 0xE8, 0x16, 0x56, 0x2A, 0x79, 0xBD, 0xA7, 0xCD, 0xBA, 0xD4, 0xB3,
+    0xB4, 0x37, 0xA9, 0x90, 0x96, 0xA9, 0x94, 0x6B, 0xBE, 0xC6, 0x75, 0x6F, 0xC8, 0xE2, 0xD7, 0x88,
+    0x42, 0x33, 0x45, 0x44, 0x97, 0xC3, 0xE5, 0x8D, 0xE9, 0xFD, 0x24, 0xC9, 0x74, 0x48, 0xA1, 0x3A,
+    0xBE, 0x4F, 0x82, 0xC6, 0xA9, 0x5A, 0xE3, 0x7F, 0xD4, 0xC9, 0x5A, 0x69, 0x12, 0x36, 0x74, 0x9A,
+    0xA7, 0xFB, 0x5B, 0xAF, 0x95, 0x26, 0x1F, 0xA3, 0x2D, 0x8C, 0x4F, 0xB1, 0x22, 0x58, 0x39, 0xEB,
+    0xDB, 0x71, 0x9B, 0xF3, 0xC5, 0x8B, 0x14, 0xBF, 0x62, 0x86, 0xFC, 0x96, 0xBF, 0x40, 0x57, 0x95,
+    0xB2, 0xF6, 0x6D, 0x2B, 0x3B, 0x4A, 0xEA, 0xB1, 0x2C, 0xB1, 0x9C, 0xAD, 0xC6, 0x12, 0xEC, 0xD8,
+    0xF7, 0x87, 0x12, 0x86, 0xDC, 0xDE, 0x1A, 0x4A, 0x32, 0xF2, 0x61, 0x57, 0x82, 0x15, 0xFB, 0x71,
+    0x5B, 0x22, 0x54, 0xB1, 0x1F, 0xD7, 0x25, 0xF3, 0x85, 0xD7, 0xAB, 0x9C, 0x25, 0xA7, 0xB2, 0xC8,
+    0xC5, 0x91, 0x96, 0x82, 0x07, 0xA6, 0xCA, 0x07, 0x89, 0xD9, 0xF2, 0x5E, 0x7F, 0x75, 0x92, 0x27,
+    0xD6, 0xD4, 0xB7, 0xFA, 0x1E, 0xF2, 0xE2, 0x04, 0xBE, 0x20, 0xB9, 0x67, 0x9A, 0xDD, 0xB0, 0xA7,
+    0x4B, 0x34, 0xFB, 0xDF, 0xB4, 0xC3, 0x69, 0xC7, 0xD4, 0x8A, 0xED, 0x10, 0xAE, 0x55, 0x79, 0xC7,
+    0xBE, 0x21, 0x87, 0x70, 0xCD, 0xBE, 0xEF, 0x3A, 0x90, 0xFF, 0xC1, 0xB7, 0x1D, 0xA8, 0xBF, 0xF5,
+    0x75, 0x57, 0x66, 0xF6, 0xA3, 0xAF, 0x3B, 0xD0, 0xFE, 0xF1, 0x67, 0xFF, 0x46, 0xF0, 0xF6, 0x97,
+    0x5B, 0xDF, 0x60, 0x0F, 0xEE, 0xBE, 0xF8, 0x4D, 0x0F, 0x3D, 0x1F, 0xB0, 0xE6, 0x32, 0x06, 0xD8,
+    0xE0, 0x14, 0xAE, 0x77, 0x25, 0x63, 0x61, 0x30, 0xAF, 0x9B, 0x8A, 0x23, 0xD2, 0x8E, 0x26, 0xDD,
+    0x68, 0x6C, 0x46, 0x93, 0x5E, 0xB4, 0x6D, 0x39, 0x9E, 0xA9, 0x90, 0x42, 0x64, 0x06, 0x81, 0xE1,
+    0xA8, 0x45, 0xE3, 0xE9, 0x45, 0x33, 0xBE, 0x9C, 0x86, 0xA3, 0x14, 0xDE, 0x93, 0x77, 0x02, 0x36,
+    0xDE, 0x15, 0x66, 0x91, 0xC7, 0x6F, 0x8F, 0x96, 0x81, 0xCD, 0xB2, 0x26, 0xBF, 0x3E, 0xAB, 0xE4,
+    0x36, 0xBD, 0x2F, 0x35, 0x6E, 0xDF, 0x97, 0xC2, 0xD4, 0xBB, 0xEF, 0x4B, 0xE5, 0x6C, 0x9A, 0x90,
+    0xAC, 0x91, 0x97, 0x2B, 0xE6, 0x72, 0x2A, 0xF1, 0x02, 0xD9, 0xB9, 0x55, 0xB3, 0x96, 0xFB, 0xE9,
+    0x48, 0x71, 0xE0, 0x19, 0xFE, 0x07, 0x5D, 0x9B, 0xBB, 0xCC, 0xFF, 0x50, 0xBA, 0x23, 0xA9, 0x85,
+    0x6B, 0x59, 0x7C, 0x2A, 0x08, 0x69, 0xA9, 0x65, 0xEA, 0x03, 0x78, 0x4E, 0x73, 0x69, 0x93, 0x91,
+    0x92, 0x4E, 0x03, 0x93, 0x06, 0xF4, 0xAD, 0x7E, 0xCF, 0x9C, 0x06, 0xDF, 0x78, 0x79, 0x3E, 0xAC,
+    0x77, 0x6B, 0x07, 0xFB, 0x02, 0xC7, 0x77, 0x11, 0x3F, 0x26, 0xCB, 0x93, 0x33, 0x03, 0x55, 0xFA,
+    0x81, 0xDD, 0x2D, 0x7C, 0x58, 0xDF, 0x34, 0x94, 0xBC, 0xD5, 0xE0, 0xD9, 0x34, 0x5C, 0x5D, 0x55,
+    0xFE, 0xFC, 0x12, 0x92, 0x7C, 0x5E, 0xCA, 0xE7, 0x13, 0x40, 0xFA, 0xF9, 0x78, 0xFA, 0x0E, 0x27,
+    0xEE, 0x39, 0x5D, 0x67, 0x7C, 0x92, 0x4B, 0x82, 0xC6, 0xC1, 0x67, 0x7A, 0x0A, 0x0D, 0xC4, 0xA6,
+    0x16, 0x32, 0x78, 0xA3, 0x78, 0x5C, 0x5E, 0x45, 0x39, 0xC9, 0x25, 0x87, 0x25, 0x6B, 0x11, 0x6E,
+    0xBA, 0x9A, 0x5C, 0xC8, 0x55, 0xC2, 0x2D, 0x3F, 0x4A, 0xEE, 0x9D, 0x48, 0x35, 0x75, 0xF2, 0x56,
+    0x77, 0xDE, 0x21, 0xEB, 0x1F, 0xFD, 0x0E, 0xD9, 0xFE, 0xF8, 0x34, 0x3E, 0x1B, 0xE1, 0x7C, 0x1F,
+    0x51, 0xB9, 0xE8, 0x9D, 0xF9, 0x8E, 0x7C, 0x9E, 0xE3, 0xD5, 0xB1, 0xBD, 0xF1, 0x29, 0xB9, 0x87,
+    0x94, 0x59, 0x88, 0x98, 0xE7, 0x26, 0xD4, 0xF4, 0x44, 0xB5, 0xEC, 0x95, 0x25, 0xBB, 0x8B, 0x77,
+    0x8C, 0x84, 0x63, 0x89, 0x8C, 0x74, 0xDD, 0xCD, 0xB4, 0x53, 0x4A, 0x4F, 0x35, 0x55, 0x32, 0xF9,
+    0x39, 0x59, 0xD7, 0x8A, 0xB9, 0xB4, 0xEB, 0x4F, 0xBB, 0x7C, 0x65, 0x0A, 0x7F, 0xE5, 0xC5, 0x00,
+    0x7D, 0x03, 0xB6, 0xC9, 0x76, 0x7A, 0x48, 0xB2, 0xF3, 0x9F, 0x8F, 0x6D, 0xBD, 0x3E, 0x7E, 0xB8,
+    0x70, 0xB2, 0x6C, 0x4E, 0xA9, 0xFC, 0xC1, 0x7B, 0xD5, 0x4D, 0x86, 0xBD, 0x94, 0xD7, 0xC7, 0xF8,
+    0xEC, 0x7F, 0x00, 0xDD, 0x5B, 0xBF, 0xB3, 0xDC, 0xD6, 0x75, 0xBE, 0x58, 0x68, 0x89, 0x19, 0x6E,
+    0x01, 0x15, 0x7C, 0x8D, 0xE4, 0x19, 0x34, 0x2E, 0x12, 0xCE, 0x78, 0x50, 0xA7, 0x21, 0xA0, 0xA4,
+    0x74, 0xF3, 0x3C, 0xC3, 0xE7, 0x14, 0x2C, 0xD8, 0xA4, 0xC8, 0xA4, 0xE1, 0x5F, 0x60, 0x61, 0x6D,
+    0x97, 0x29, 0xC2, 0x22, 0xA9, 0x52, 0x84, 0x05, 0x8B, 0xCC, 0x63, 0xC1, 0x26, 0x85, 0x33, 0x23,
+    0x11, 0xB0, 0x59, 0xB8, 0x48, 0xE1, 0x95, 0x9D, 0x19, 0x17, 0x29, 0xB2, 0x96, 0xE3, 0xD8, 0x43,
+    0x15, 0x84, 0x64, 0x68, 0x0C, 0x32, 0x00, 0x6E, 0xBE, 0xEF, 0x3B, 0x17, 0xD8, 0x7D, 0xA4, 0xAD,
+    0xD8, 0xB1, 0xF8, 0x28, 0xFB, 0x8D, 0x74, 0xB1, 0xDC, 0xB7, 0x7B, 0xEF, 0xF9, 0x7D, 0xBE, 0x73,
+    0xCE, 0x7D, 0xCE, 0x1D, 0x7E, 0x7C, 0xE9, 0xA2, 0x7A, 0x8C, 0xBC, 0x73, 0x1B, 0xEF, 0xBF, 0x37,
+    0x39, 0x57, 0x78, 0xFF, 0x3F, 0x03, 0xDE, 0x7F, 0x5E, 0xFB, 0xD6, 0xC5, 0x7E, 0x9B, 0xFA, 0xAD,
+    0x4B, 0x26, 0x97, 0x8C, 0xCE, 0xA5, 0x83, 0x8B, 0xF1, 0xC8, 0x3A, 0x3D, 0xF2, 0x56, 0x8F, 0x62,
+    0x6F, 0x8F, 0x9D, 0x4B, 0x86, 0xC3, 0xA3, 0x71, 0x1B, 0x7B, 0xA4, 0x9D, 0xDE, 0xC4, 0x87, 0xF9,
+    0xC9, 0x6A, 0x8F, 0x47, 0x1B, 0xF9, 0x06, 0xBB, 0x4C, 0xB7, 0x71, 0xB6, 0x4B, 0xBD, 0xC7, 0xA1,
+    0x38, 0xC8, 0x77, 0x24, 0xA7, 0xC2, 0x69, 0xFC, 0x29, 0x67, 0xFA, 0xCE, 0x8C, 0x4A, 0x2E, 0x24,
+    0x32, 0x9F, 0x70, 0x58, 0xE4, 0xFD, 0x7F, 0xF6, 0x2E, 0xF1, 0xDE, 0xEF, 0x5D, 0x3A, 0xDE, 0xC1,
+    0x36, 0x79, 0x97, 0xF6, 0x3C, 0x80, 0x87, 0x56, 0x4D, 0x58, 0xF1, 0x4E, 0xBD, 0x4D, 0x6D, 0xED,
+    0xB8, 0x66, 0x20, 0xA2, 0x6E, 0x40, 0x86, 0xAB, 0x7E, 0x42, 0x12, 0xC0, 0xEA, 0x96, 0x14, 0x90,
+    0x80, 0x95, 0xFF, 0x2F, 0x9E, 0xF1, 0x86, 0x7B, 0xE1, 0xA7, 0x6E, 0xE2, 0x01, 0x4C, 0xF8, 0x12,
+    0x6C, 0xA5, 0x1F, 0x7B, 0x72, 0x97, 0xFD, 0x6A, 0x74, 0xD8, 0x3C, 0x07, 0xC5, 0xD8, 0xB7, 0xC0,
+    0x1E, 0x69, 0xEB, 0x0A, 0x7C, 0x1D, 0xFB, 0x57, 0x8D, 0x04, 0xC3, 0x07, 0xCE, 0xA9, 0xB7, 0x62,
+    0x9E, 0x7C, 0x42, 0x14, 0x64, 0xA2, 0x6A, 0xC8, 0x05, 0x76, 0x5D, 0xF1, 0xE1, 0xB7, 0xF1, 0x24,
+    0x1D, 0x50, 0x82, 0x4E, 0x67, 0xF0, 0x4D, 0xD2, 0xEC, 0xEA, 0x4F, 0x6B, 0x90, 0x4B, 0x1A, 0x77,
+    0x78, 0x64, 0x9E, 0x9B, 0x80, 0xE7, 0xDE, 0x5D, 0x24, 0x33, 0x3A, 0xE5, 0xAA, 0x6F, 0x80, 0x1A,
+    0x6C, 0xE0, 0xF3, 0x76, 0xD3, 0x47, 0xBE, 0x6E, 0xD2, 0x7E, 0xE5, 0x3D, 0xDE, 0x8B, 0xF1, 0x9D,
+    0xB4, 0x95, 0xE2, 0x5A, 0x1E, 0x90, 0x4B, 0x4A, 0xC5, 0x4E, 0x12, 0x6B, 0xA4, 0x9F, 0x86, 0x92,
+    0xA9, 0x9A, 0x42, 0x2B, 0x75, 0x54, 0xFD, 0x90, 0xA7, 0x16, 0xFE, 0xA9, 0xD6, 0x7F, 0x02, 0x37,
+    0xE9, 0x98, 0x35, 0xC7, 0x7A, 0x71, 0x6E, 0x5D, 0xAE, 0xC3, 0xBF, 0xD2, 0x7D, 0xDE, 0xD8, 0xAB,
+    0xF8, 0x53, 0x1F, 0x7E, 0xBB, 0xF2, 0xC3, 0x62, 0x62, 0xED, 0xA2, 0xCC, 0xF2, 0x58, 0xB4, 0x85,
+    0xBF, 0x4B, 0x55, 0x42, 0x7E, 0x05, 0x54, 0x10, 0xEB, 0x55, 0xE5, 0x7D, 0xC3, 0x57, 0xA5, 0xAB,
+    0xA1, 0x5D, 0xBE, 0xA2, 0x40, 0xAA, 0x56, 0xC6, 0x07, 0x09, 0x65, 0x24, 0xBA, 0xA3, 0x41, 0x48,
+    0xB1, 0x7B, 0x1A, 0x05, 0xD8, 0xA1, 0x45, 0xAD, 0xF4, 0x2A, 0xC6, 0x17, 0x20, 0x54, 0xBC, 0x4A,
+    0xC1, 0x31, 0xB8, 0xC6, 0xE7, 0x72, 0x7C, 0x81, 0x5A, 0xEC, 0x65, 0x7F, 0xD4, 0x60, 0xE7, 0xA8,
+    0x7F, 0x7C, 0x28, 0x6F, 0xF9, 0x05, 0xFB, 0x15, 0xBF, 0x40, 0x8D, 0xFA, 0x26, 0xA7, 0x38, 0x21,
+    0x2D, 0x3B, 0xD9, 0x65, 0xCF, 0x41, 0x9F, 0x7F, 0x72, 0x7E, 0x17, 0x3A, 0xF7, 0x94, 0x2A, 0x84,
+    0x43, 0xBD, 0x90, 0xBC, 0x06, 0xAF, 0x7A, 0x67, 0xAF, 0xEC, 0xE7, 0xD4, 0xDD, 0xB4, 0x17, 0x63,
+    0xDC, 0x8B, 0x47, 0x57, 0x65, 0x7B, 0xB1, 0x28, 0x5B, 0x21, 0x87, 0x30, 0x7E, 0x27, 0x06, 0xDD,
+    0xFA, 0xE6, 0xCC, 0x9F, 0x33, 0xF6, 0x62, 0xBE, 0x4B, 0xEE, 0x60, 0xDE, 0x3B, 0x31, 0x07, 0xBF,
+    0x6C, 0xC4, 0xDB, 0xFA, 0xEB, 0xB2, 0x17, 0x63, 0xD2, 0x38, 0xA3, 0x47, 0x8A, 0x31, 0xD8, 0x9C,
+    0xF1, 0x55, 0xED, 0x8C, 0xAD, 0x88, 0x66, 0x49, 0xAE, 0x68, 0x61, 0x62, 0x8A, 0x02, 0x14, 0x4F,
+    0xF4, 0x45, 0xB1, 0x54, 0xFF, 0xEC, 0xA6, 0x38, 0x82, 0x12, 0x06, 0x31, 0x14, 0x5E, 0xF4, 0x90,
+    0x65, 0x30, 0x34, 0xF0, 0x72, 0x22, 0xB3, 0xAD, 0x57, 0xA3, 0x9E, 0xC5, 0xDF, 0x91, 0x56, 0xF8,
+    0x92, 0xF8, 0xF5, 0x65, 0xEA, 0xCD, 0x3F, 0xA3, 0x9B, 0xC1, 0x43, 0xA9, 0xD8, 0x8F, 0x27, 0x6C,
+    0x00, 0x12, 0xA6, 0x09, 0xEC, 0xE0, 0x48, 0x3F, 0xF2, 0x99, 0x4E, 0x77, 0x86, 0xE8, 0xCC, 0xEF,
+    0xB2, 0x2E, 0xA5, 0xC6, 0xCA, 0x02, 0x86, 0xCA, 0xD0, 0x52, 0xEC, 0x36, 0x9D, 0x68, 0xA5, 0x31,
+    0xC2, 0x06, 0x61, 0xBA, 0x5C, 0xE4, 0xB0, 0x2B, 0x5A, 0xC2, 0x36, 0xDF, 0x33, 0xFC, 0xD4, 0x4D,
+    0x25, 0xA3, 0xAD, 0xE1, 0xBC, 0xC5, 0xA7, 0x67, 0xA4, 0xB8, 0xA9, 0xC1, 0x46, 0xEE, 0x9F, 0x36,
+    0x38, 0xC2, 0x6D, 0xA6, 0x62, 0xCB, 0xE7, 0x62, 0xA4, 0x70, 0x3D, 0x7A, 0x22, 0x5C, 0x8F, 0xDB,
+    0xD1, 0x27, 0x21, 0x94, 0xBA, 0x51, 0xD0, 0xC3, 0x2B, 0x52, 0x8B, 0x57, 0xF4, 0x44, 0xFC, 0xB7,
+    0x9A, 0xF4, 0x06, 0xE4, 0x8A, 0x57, 0x7C, 0x50, 0x70, 0x89, 0x45, 0xBC, 0x8D, 0xC4, 0x4C, 0x1A,
+    0xE9, 0x40, 0xA0, 0x92, 0xB1, 0x05, 0x44, 0xD2, 0x79, 0x32, 0x7B, 0x40, 0xA8, 0x99, 0xC5, 0xB8,
+    0xEC, 0xF9, 0xF9, 0x96, 0x11, 0x0F, 0xD4, 0xF1, 0x70, 0x58, 0x75, 0xAD, 0x47, 0x19, 0x42, 0x9B,
+    0x1C, 0x59, 0xA7, 0x3A, 0x77, 0xE5, 0x21, 0xFD, 0x1F, 0x6E, 0x3D, 0xD8, 0xA3, 0xB3, 0xC7, 0xD6,
+    0xFD, 0xBA, 0x9F, 0xDA, 0x38, 0xA2, 0xBF, 0x18, 0x0F, 0xE4, 0xE8, 0x91, 0x78, 0xD3, 0xBE, 0xCB,
+    0xF6, 0x24, 0xD9, 0xCB, 0xE4, 0xC9, 0x11, 0x48, 0x26, 0x47, 0x20, 0x39, 0x98, 0x02, 0x7F, 0xCD,
+    0x87, 0xEC, 0x41, 0x1C, 0x81, 0x78, 0x72, 0x94, 0xEF, 0xE7, 0x70, 0x6D, 0x51, 0xC1, 0x59, 0x58,
+    0x10, 0x47, 0x38, 0x84, 0x1C, 0xC9, 0x59, 0xFD, 0x16, 0x87, 0x88, 0x23, 0xE7, 0x0E, 0x5A, 0x5F,
+    0x4D, 0x16, 0x02, 0x46, 0xBD, 0xF7, 0x70, 0x30, 0x2E, 0x7B, 0x7B, 0xB4, 0xF6, 0xC1, 0xC5, 0xFF,
+    0x11, 0x7E, 0x10, 0x33, 0x1B, 0x85, 0xCA, 0x5C, 0x2A, 0xDF, 0x19, 0x03, 0xFA, 0x88, 0xB7, 0x38,
+    0x59, 0x6F, 0xB1, 0xA7, 0x6C, 0x9E, 0x11, 0x32, 0x62, 0xF0, 0xD5, 0x82, 0x77, 0x37, 0x3D, 0x1D,
+    0xA0, 0x53, 0x6C, 0xA6, 0xE1, 0xB7, 0x32, 0x7A, 0x28, 0xA8, 0xD8, 0xD3, 0x88, 0x6C, 0xF7, 0x2C,
+    0xEC, 0x2E, 0xB5, 0x98, 0xF0, 0x24, 0xAC, 0xEB, 0x3C, 0xA9, 0x20, 0xD5, 0x05, 0x89, 0x65, 0xE8,
+    0x66, 0x50, 0xD9, 0xB4, 0x11, 0x8C, 0x91, 0xC1, 0x12, 0x07, 0x54, 0x83, 0x05, 0xCD, 0x7A, 0x74,
+    0xD9, 0x1E, 0xC7, 0xD0, 0xCE, 0x76, 0x0C, 0xAF, 0x1E, 0x1B, 0xE3, 0xB0, 0x09, 0xF6, 0x8B, 0x10,
+    0x1B, 0x8D, 0xF5, 0xB6, 0x42, 0x7A, 0x59, 0x8D, 0x45, 0x83, 0x34, 0xD3, 0xC6, 0x03, 0x9E, 0x65,
+    0x86, 0x67, 0xBE, 0xF7, 0x10, 0x68, 0xD2, 0xA7, 0x2D, 0xBE, 0xC1, 0xE7, 0xC7, 0x66, 0xE9, 0x9B,
+    0x67, 0x23, 0x2D, 0xBD, 0x4D, 0xA6, 0x41, 0x96, 0x1E, 0x43, 0xF7, 0xB0, 0xF4, 0x3D, 0x03, 0xA6,
+    0x2F, 0x73, 0xF8, 0x60, 0xCF, 0x27, 0xD2, 0x45, 0x17, 0xF1, 0x2C, 0x57, 0xC3, 0x09, 0xF8, 0xAC,
+    0xDA, 0x78, 0x72, 0x47, 0x22, 0xB6, 0x90, 0x88, 0x9F, 0xB7, 0x6A, 0xF3, 0xD5, 0x3C, 0x04, 0xDA,
+    0x3C, 0x84, 0xA2, 0x7C, 0x72, 0xBF, 0xE1, 0x67, 0x35, 0x18, 0xBF, 0xD8, 0x48, 0xFC, 0xC2, 0xBB,
+    0x8C, 0xDF, 0xDE, 0xF8, 0xA5, 0x0A, 0xC8, 0x2F, 0x9F, 0x3C, 0x1B, 0xD2, 0x14, 0xBF, 0x59, 0x6B,
+    0xFC, 0xE6, 0xAD, 0xF1, 0x9B, 0xEF, 0x8D, 0xDF, 0x62, 0x67, 0xFC, 0x16, 0x8D, 0xF1, 0x5B, 0x35,
+    0xC6, 0x6F, 0xDD, 0x18, 0xBF, 0x48, 0x69, 0xE2, 0x17, 0xE1, 0x42, 0xFC, 0x7A, 0x27, 0x7E, 0xC1,
+    0x9F, 0xF8, 0x85, 0xB8, 0xC5, 0x2F, 0xF8, 0x13, 0xBF, 0x24, 0x8B, 0xFC, 0x26, 0x21, 0x85, 0x6C,
+    0xE6, 0x67, 0x88, 0x49, 0xA9, 0xDC, 0xC4, 0x5D, 0xAD, 0x8D, 0xDF, 0x8D, 0xDF, 0x87, 0xA7, 0x79,
+    0xC0, 0x66, 0xBC, 0xC8, 0x6D, 0xDC, 0x1F, 0xEF, 0x12, 0x1E, 0x49, 0xF7, 0x82, 0x4C, 0x06, 0x64,
+    0x09, 0xF0, 0x37, 0x40, 0x00, 0xF9, 0x7E, 0x35, 0x91, 0x6F, 0x04, 0xF8, 0x1F, 0x93, 0xA9, 0xD8,
+    0x47, 0xE4, 0x89, 0x76, 0x08, 0x96, 0x64, 0x84, 0x7E, 0xBB, 0x21, 0xD9, 0x60, 0xA8, 0x03, 0xB5,
+    0x5E, 0xB6, 0x82, 0xB7, 0xA9, 0x78, 0x72, 0x03, 0xD2, 0xF1, 0x69, 0x64, 0x5A, 0x9A, 0x29, 0xAC,
+    0x91, 0x36, 0x4A, 0x31, 0xE2, 0x51, 0x41, 0x8A, 0x81, 0x91, 0xC0, 0x47, 0x1A, 0xD4, 0xA6, 0xC7,
+    0x55, 0x63, 0x26, 0x35, 0x1D, 0xA6, 0xE6, 0x31, 0x96, 0xDE, 0xD7, 0x8E, 0x09, 0x37, 0x6B, 0x2A,
+    0xAC, 0x9B, 0x4F, 0x46, 0xA1, 0xA6, 0x4E, 0xDE, 0xB5, 0x7B, 0x21, 0xB9, 0xC6, 0xFA, 0x9A, 0xC9,
+    0x23, 0xD5, 0x6A, 0x36, 0x51, 0x3C, 0xE5, 0x5A, 0xDF, 0x51, 0xE8, 0x66, 0xCE, 0x5E, 0x8D, 0x5C,
+    0xE3, 0x21, 0xC3, 0x0E, 0x9B, 0x8E, 0x6B, 0xD6, 0x52, 0xFD, 0xC5, 0x8E, 0x6B, 0xF5, 0xE4, 0xE1,
+    0x9E, 0x16, 0x00, 0xBB, 0x8A, 0xB4, 0xC6, 0x5A, 0x89, 0x84, 0x5A, 0x65, 0x9F, 0x36, 0x44, 0xBF,
+    0x42, 0x81, 0x03, 0x91, 0x82, 0x8C, 0x9D, 0x30, 0x63, 0x14, 0x25, 0x8C, 0x2F, 0xFB, 0x71, 0x1F,
+    0xB4, 0x13, 0x93, 0x88, 0xE8, 0x6C, 0xF1, 0xFE, 0xF6, 0x11, 0x76, 0x1C, 0x26, 0x62, 0x38, 0xB8,
+    0x31, 0xF2, 0x82, 0xCB, 0x7A, 0x58, 0xB3, 0x32, 0x02, 0x9C, 0x24, 0xE4, 0x82, 0x90, 0x08, 0xB2,
+    0xD6, 0x50, 0x1B, 0xE3, 0xBF, 0xAB, 0xFF, 0x1B, 0x9C, 0x28, 0x87, 0xE6, 0xC0, 0x38, 0xD0, 0x75,
+    0xB1, 0x0D, 0x01, 0xFF, 0xDA, 0xE1, 0xDC, 0xEF, 0x33, 0x3C, 0xF3, 0xDC, 0xE4, 0xE2, 0xB9, 0x15,
+    0xDF, 0xAB, 0xBD, 0x98, 0x22, 0x04, 0x1D, 0x67, 0x25, 0x48, 0x05, 0x8C, 0x76, 0xEE, 0x85, 0x70,
+    0xC1, 0x48, 0xAB, 0x38, 0x2B, 0x2C, 0x77, 0x08, 0x51, 0x8A, 0x79, 0x5A, 0x12, 0xC5, 0x91, 0x65,
+    0xE3, 0x9A, 0xCA, 0xA0, 0xA6, 0xD2, 0xA6, 0xDA, 0x52, 0x4B, 0xD4, 0x51, 0xC4, 0xDF, 0xCC, 0xFA,
+    0xF1, 0xF6, 0xC5, 0x95, 0x01, 0x15, 0x39, 0x33, 0x0D, 0x9D, 0xFF, 0x2B, 0xAD, 0x74, 0x6E, 0xCE,
+    0x2B, 0x22, 0x26, 0xDF, 0x1B, 0x29, 0xA4, 0x44, 0x84, 0x20, 0x25, 0xDF, 0x34, 0x70, 0xE1, 0xAA,
+    0xDB, 0x7B, 0x03, 0x15, 0x02, 0x14, 0x02, 0x13, 0x16, 0x91, 0xEB, 0x51, 0xC8, 0x5A, 0x79, 0xA7,
+    0x25, 0x96, 0x07, 0x0A, 0xDC, 0x66, 0x43, 0x42, 0xF4, 0x00, 0x39, 0x27, 0xA3, 0x30, 0xBC, 0x10,
+    0xBC, 0xF0, 0xBB, 0x60, 0x7B, 0x41, 0xE8, 0x00, 0x11, 0xA7, 0x5A, 0x7A, 0xA1, 0x76, 0x61, 0xF6,
+    0x02, 0x91, 0xA8, 0xC9, 0xA6, 0x5B, 0xCC, 0xF6, 0x86, 0xD4, 0xBA, 0x19, 0xA9, 0x9F, 0xCE, 0x82,
+    0xAF, 0x22, 0x96, 0x04, 0xFF, 0x46, 0xE2, 0x29, 0x81, 0x44, 0x42, 0x5A, 0x04, 0xCF, 0x50, 0x14,
+    0x91, 0x9E, 0x84, 0xF4, 0x00, 0xB3, 0x77, 0x06, 0xD9, 0x85, 0xD8, 0x05, 0xD8, 0x85, 0xD7, 0x05,
+    0xD7, 0x85, 0xD6, 0x05, 0xD6, 0xA5, 0x75, 0x41, 0x75, 0x21, 0x75, 0x01, 0x75, 0xC3, 0xE9, 0x6F,
+    0x04, 0xE8, 0x7B, 0xEA, 0x56, 0xFD, 0x06, 0x42, 0x9A, 0x24, 0x1D, 0x69, 0x82, 0xEE, 0xBD, 0x3E,
+    0x5D, 0xAA, 0x9B, 0x90, 0x37, 0x56, 0x17, 0xF2, 0x86, 0x25, 0x8F, 0xFF, 0x33, 0x6F, 0xE8, 0x7C,
+    0xBF, 0x15, 0x82, 0x2F, 0x76, 0x8C, 0xC2, 0x88, 0x62, 0xE0, 0x05, 0xE6, 0x9A, 0x52, 0x06, 0x89,
+    0x97, 0xC6, 0x29, 0xFA, 0x88, 0xCA, 0x35, 0xCB, 0xDF, 0x82, 0x8C, 0xD4, 0x2C, 0xBF, 0xA5, 0xE5,
+    0x37, 0x47, 0x82, 0x60, 0x02, 0x71, 0x84, 0xE7, 0xA0, 0x01, 0xD4, 0x28, 0x78, 0x30, 0x69, 0x18,
+    0x34, 0x17, 0x32, 0x17, 0x30, 0x17, 0x2E, 0x0F, 0x84, 0x14, 0xAD, 0x81, 0x72, 0x61, 0x72, 0x41,
+    0xF2, 0xC2, 0xDF, 0x6E, 0x02, 0x20, 0x2F, 0x03, 0x92, 0x66, 0xA2, 0xE6, 0x52, 0x87, 0x58, 0xE8,
+    0xDC, 0x7B, 0x69, 0x69, 0x72, 0x89, 0x46, 0x0A, 0xE7, 0xAF, 0xAE, 0x5E, 0x96, 0x48, 0x76, 0xC7,
+    0x22, 0x49, 0xA8, 0xB3, 0x8D, 0x2D, 0x73, 0x58, 0xDE, 0x7C, 0x97, 0xE6, 0xFD, 0x23, 0x48, 0x28,
+    0x7B, 0x8C, 0x57, 0x57, 0xA2, 0xBB, 0xAF, 0x54, 0x38, 0xEE, 0xAD, 0x7B, 0xB3, 0x37, 0xD3, 0x28,
+    0x57, 0x34, 0x90, 0x15, 0xDF, 0xFA, 0x0E, 0x24, 0x14, 0x0D, 0x94, 0xD0, 0xC0, 0x20, 0x72, 0xEF,
+    0xF5, 0x48, 0xC8, 0xAD, 0xCE, 0x8D, 0xF7, 0x10, 0x85, 0x48, 0x8A, 0xFB, 0x53, 0xFE, 0xEB, 0x9B,
+    0x84, 0x95, 0x8F, 0x89, 0xCB, 0xBE, 0xDD, 0x31, 0xA6, 0xBC, 0x5A, 0x31, 0xFD, 0xB5, 0xBB, 0x8F,
+    0xC3, 0xE9, 0x4C, 0x99, 0xAA, 0x62, 0x11, 0xC8, 0x80, 0xF2, 0x5E, 0x76, 0x30, 0xA4, 0xED, 0x6B,
+    0x33, 0xA4, 0xAB, 0xDB, 0xB7, 0x4A, 0x97, 0xEC, 0x47, 0x46, 0x00, 0x46, 0x6C, 0xE5, 0x3C, 0x96,
+    0x26, 0xE9, 0xE5, 0x5A, 0xD3, 0xF5, 0x72, 0xCE, 0x0A, 0x29, 0x29, 0x48, 0xA8, 0xB2, 0xE8, 0x60,
+    0x4D, 0x39, 0xAD, 0x29, 0x7F, 0x7D, 0x62, 0xBA, 0x72, 0xDF, 0x09, 0xF8, 0xE3, 0x9F, 0x72, 0xB7,
+    0x4A, 0x0E, 0x70, 0xD1, 0x9A, 0x1E, 0x5F, 0x82, 0x35, 0x39, 0x11, 0x15, 0x5B, 0x91, 0xDC, 0xC6,
+    0x77, 0x59, 0xB7, 0x6F, 0x2C, 0xCB, 0xAD, 0x1F, 0x0C, 0xAC, 0x33, 0x51, 0xD6, 0xF6, 0xF9, 0x78,
+    0xBB, 0x03, 0xD4, 0x68, 0x0B, 0x70, 0x09, 0x1C, 0xD9, 0xB0, 0xA6, 0xC8, 0x10, 0x27, 0x12, 0x46,
+    0xB1, 0x6B, 0x86, 0x64, 0xFC, 0xB2, 0x26, 0xDE, 0x2F, 0x08, 0x27, 0xD9, 0x7D, 0x87, 0x4C, 0x7D,
+    0x22, 0xB7, 0xF9, 0x90, 0xEB, 0x95, 0xED, 0xBD, 0x2F, 0x06, 0xFE, 0x61, 0xB4, 0x4B, 0x59, 0x8E,
+    0x86, 0x0E, 0x48, 0xFA, 0xBD, 0x4E, 0x82, 0xA7, 0xDC, 0x67, 0xEB, 0x04, 0x00, 0x22, 0xFE, 0xC1,
+    0x7E, 0x23, 0xD1, 0x0F, 0xC1, 0x0F, 0xB1, 0x0F, 0xA1, 0x0F, 0x91, 0x0F, 0x81, 0x0F, 0x71, 0x0F,
+    0xB5, 0x4F, 0xD4, 0x43, 0xD0, 0xC3, 0x6A, 0x97, 0x90, 0x47, 0x88, 0xA7, 0x74, 0x17, 0x62, 0x6B,
+    0xBA, 0xC4, 0x56, 0xF7, 0x95, 0x45, 0xEB, 0x35, 0x97, 0x3F, 0xB9, 0x20, 0x92, 0x8D, 0xF5, 0xBB,
+    0xB6, 0x41, 0x1E, 0x12, 0x87, 0xA4, 0x41, 0x61, 0x48, 0x16, 0x12, 0x85, 0x24, 0x21, 0x41, 0x48,
+    0x0E, 0x12, 0x83, 0x57, 0x41, 0x4F, 0x5D, 0x72, 0x91, 0x08, 0x24, 0x01, 0x09, 0x40, 0xFC, 0x1B,
+    0xFB, 0x33, 0xF7, 0xE9, 0xDC, 0xFF, 0xF9, 0x46, 0x20, 0xE5, 0x91, 0x0B, 0x2A, 0xFD, 0x9C, 0xB8,
+    0x77, 0xEE, 0x6F, 0xCE, 0x43, 0xC5, 0x1B, 0xEA, 0x1D, 0x1F, 0xF0, 0xFF, 0xD9, 0xD9, 0x05, 0x60,
+    0x9F, 0x87, 0xDE, 0x4C, 0x15, 0x9E, 0x5E, 0x8D, 0x26, 0xB6, 0x38, 0xD4, 0x53, 0x4B, 0x06, 0x43,
+    0x55, 0x69, 0x2F, 0x84, 0x07, 0x57, 0x34, 0xCC, 0x5D, 0xED, 0xEC, 0xE9, 0xBF, 0xE9, 0xCF, 0xFF,
+    0x99, 0x1F, 0xB7, 0x9E, 0x48, 0x3C, 0xAE, 0x04, 0x7F, 0xD2, 0x81, 0x86, 0x4D, 0xE0, 0xF5, 0x60,
+    0xB0, 0x14, 0x6C, 0x0C, 0xD7, 0xF6, 0xA4, 0xA8, 0x08, 0xDA, 0xE3, 0xC9, 0x00, 0x26, 0xFB, 0x51,
+    0xA8, 0xA2, 0xF9, 0x8F, 0x4C, 0xB8, 0xAC, 0x55, 0x39, 0xED, 0xAC, 0x43, 0x40, 0x02, 0xAE, 0x9E,
+    0xDF, 0x57, 0x9F, 0xAF, 0x13, 0xC9, 0x5C, 0xD7, 0x67, 0xA7, 0x07, 0xC0, 0xFC, 0xBE, 0xDF, 0x47,
+    0x7E, 0xC4, 0xE6, 0x6C, 0x7B, 0x42, 0x6E, 0xE3, 0x1D, 0xFF, 0xE7, 0x53, 0xD6, 0xA5, 0x63, 0x34,
+    0x21, 0x6E, 0xF4, 0x84, 0x70, 0x69, 0x7F, 0x07, 0xBC, 0x30, 0x2C, 0xD4, 0x5C, 0xB7, 0xC0, 0x50,
+    0xCF, 0xFF, 0x1E, 0x48, 0xAA, 0x50, 0xDB, 0x93, 0x3D, 0xA6, 0xFA, 0x43, 0xDF, 0x47, 0xBB, 0x82,
+    0x3B, 0xEC, 0x20, 0x4D, 0xAC, 0x90, 0x67, 0x01, 0x3E, 0xCB, 0x90, 0x8B, 0x0C, 0x24, 0xDF, 0x65,
+    0x2F, 0xB8, 0x0F, 0xD8, 0x71, 0x7A, 0xB8, 0x67, 0x81, 0x71, 0x57, 0x38, 0x57, 0x15, 0x27, 0x7D,
+    0x19, 0x62, 0x02, 0x79, 0x38, 0xD9, 0x03, 0x22, 0x66, 0x7E, 0x5F, 0x60, 0xBF, 0x1D, 0x60, 0x23,
+    0xE2, 0xC2, 0xEE, 0xA4, 0xFE, 0xF7, 0x02, 0x87, 0xF4, 0xC5, 0xBE, 0xF2, 0x1D, 0xBB, 0xBD, 0x65,
+    0x36, 0xB2, 0x81, 0xC5, 0x66, 0xDE, 0x4A, 0xED, 0xDE, 0x4A, 0x20, 0x6E, 0xE1, 0x2E, 0x65, 0xC4,
+    0xAC, 0x7C, 0xB5, 0xA5, 0xD4, 0xCA, 0xD8, 0xDF, 0xC2, 0x87, 0xC7, 0x78, 0x8E, 0x48, 0xA8, 0x35,
+    0x59, 0x57, 0xB1, 0x2C, 0x8B, 0x19, 0x91, 0x14, 0x96, 0xD4, 0xD5, 0xAB, 0x24, 0x4C, 0x18, 0xA0,
+    0x7F, 0xDA, 0x62, 0xE7, 0xDB, 0xC2, 0xEF, 0xF0, 0xD8, 0xEB, 0x2C, 0x88, 0x0B, 0xEA, 0xE1, 0xBA,
+    0xFF, 0x85, 0xFB, 0x17, 0x76, 0xF8, 0xD8, 0x27, 0xC2, 0x82, 0xF7, 0xDF, 0x36, 0x2B, 0x11, 0x88,
+    0x9E, 0x18, 0x29, 0x05, 0xA2, 0x73, 0xF3, 0x8C, 0x63, 0x10, 0xFD, 0x5B, 0x0B, 0x42, 0x05, 0xC3,
+    0xD5, 0xF3, 0x7B, 0xC7, 0x82, 0x80, 0x7F, 0x49, 0x1A, 0x08, 0xDC, 0x50, 0xC0, 0x9E, 0xD1, 0xBB,
+    0x63, 0xD9, 0x3B, 0xDD, 0xFA, 0x0D, 0x82, 0x50, 0x71, 0x97, 0xEE, 0x60, 0xDD, 0xC9, 0xC7, 0xAC,
+    0x0A, 0x48, 0xAA, 0xCA, 0x86, 0x43, 0x5D, 0x97, 0x99, 0x98, 0x8A, 0x59, 0x4C, 0xFF, 0x88, 0x84,
+    0x22, 0x31, 0x0D, 0x0A, 0xDC, 0x58, 0x4C, 0x4C, 0x8C, 0xDE, 0xB9, 0xA2, 0x77, 0xAB, 0xCE, 0x20,
+    0x0A, 0xDB, 0xFC, 0x19, 0x6A, 0xE5, 0x63, 0x59, 0xE5, 0x17, 0x2B, 0x1C, 0x58, 0xE0, 0xBB, 0xB7,
+    0xD8, 0x51, 0x32, 0xA2, 0x5E, 0x10, 0x13, 0xE4, 0x44, 0x4E, 0x25, 0x28, 0x93, 0x94, 0x89, 0xEA,
+    0x48, 0x56, 0x4E, 0xC9, 0x89, 0xAD, 0x91, 0x91, 0x65, 0x0A, 0x25, 0x53, 0xAB, 0x93, 0xEC, 0xB7,
+    0xB4, 0x6E, 0xFF, 0x17, 0x6A, 0x77, 0x53, 0x6A, 0x91, 0x67, 0x3B, 0x76, 0x35, 0xF1, 0x97, 0xF1,
+    0xC4, 0xCD, 0x62, 0xF9, 0x61, 0x2C, 0xAF, 0x4C, 0xBC, 0x35, 0x66, 0x49, 0x1A, 0xE2, 0x0A, 0xFB,
+    0xBE, 0x9D, 0xFA, 0x95, 0x64, 0x85, 0xAB, 0x1A, 0xD8, 0x89, 0x06, 0x0E, 0xAC, 0x9E, 0x0A, 0x35,
+    0xD2, 0xA3, 0x53, 0xD4, 0x02, 0x71, 0x4F, 0xFC, 0x34, 0x56, 0x5B, 0x2A, 0x7A, 0xAE, 0x04, 0x4E,
+    0x0E, 0x2E, 0xF4, 0x59, 0xE5, 0x1C, 0x3B, 0x4E, 0xF0, 0xAF, 0xC8, 0x6F, 0x57, 0x13, 0xF2, 0x6B,
+    0x3C, 0xE2, 0xB4, 0x78, 0x80, 0xDE, 0x92, 0x81, 0xE3, 0x0F, 0x0B, 0xB4, 0x43, 0x08, 0xB4, 0x29,
+    0xF3, 0x50, 0xF6, 0x8C, 0x63, 0x87, 0x96, 0x75, 0xE8, 0x1E, 0x9A, 0x86, 0xC1, 0x2B, 0x6D, 0x33,
+    0x0B, 0xA4, 0xFD, 0x65, 0x97, 0x61, 0x42, 0x21, 0xEA, 0xCF, 0x17, 0x4B, 0xF8, 0xAF, 0x84, 0x7A,
+    0x97, 0xBA, 0xD6, 0x1D, 0x95, 0x62, 0xAC, 0xC4, 0x58, 0x88, 0xB1, 0x0E, 0x63, 0x19, 0xC6, 0x2A,
+    0x8C, 0x45, 0x18, 0x6B, 0x30, 0x96, 0x60, 0xAC, 0xC0, 0x58, 0x80, 0x31, 0x00, 0xB3, 0xFC, 0x62,
+    0xF5, 0xC5, 0xE2, 0x4B, 0xB5, 0x17, 0xE2, 0xF8, 0x0A, 0xE7, 0x26, 0x7B, 0x43, 0x40, 0xE9, 0x73,
+    0x88, 0x66, 0x5A, 0xBA, 0x7F, 0x44, 0x48, 0xE7, 0xDB, 0x50, 0x06, 0x4B, 0x97, 0x67, 0xB3, 0xFD,
+    0x7E, 0xE1, 0xA4, 0xF1, 0xD6, 0xF9, 0x3D, 0x55, 0x4E, 0xFC, 0xFF, 0x24, 0x50, 0xF9, 0xAA, 0xA5,
+    0x13, 0x95, 0xB4, 0xD4, 0x0E, 0x59, 0x75, 0x35, 0xB0, 0x8F, 0xA3, 0xD9, 0x53, 0xD5, 0x1F, 0x5B,
+    0x6A, 0x3E, 0x8F, 0x17, 0x2C, 0x33, 0x54, 0xF2, 0x0E, 0xF5, 0xB4, 0x14, 0x6A, 0xD8, 0xC0, 0x9C,
+    0x67, 0x16, 0xCC, 0x17, 0x65, 0x68, 0xFC, 0x5D, 0x57, 0xBE, 0x51, 0x5C, 0x52, 0x7F, 0x70, 0x5E,
+    0xDE, 0xE4, 0x7B, 0x37, 0xDE, 0xA9, 0x43, 0x18, 0xD3, 0x9E, 0x99, 0x7F, 0x16, 0xD0, 0x33, 0xA2,
+    0x0E, 0x08, 0x4A, 0x5A, 0x24, 0xFC, 0x78, 0xA8, 0x49, 0x10, 0xBF, 0x56, 0x33, 0xFD, 0x9C, 0x2C,
+    0x6D, 0xF4, 0xA0, 0x33, 0xD1, 0xB2, 0x75, 0x27, 0x7F, 0xB9, 0x04, 0x40, 0x09, 0x54, 0x2E, 0x3C,
+    0xCD, 0x04, 0xE5, 0xCF, 0x66, 0xB4, 0xA5, 0xA2, 0xD4, 0xE5, 0x0B, 0x55, 0xC9, 0xB2, 0xA8, 0x05,
+    0x87, 0x4F, 0xBF, 0xC9, 0x0D, 0xAA, 0x07, 0x88, 0x72, 0x95, 0xED, 0x3E, 0x31, 0xEE, 0xEC, 0x97,
+    0x01, 0x13, 0x43, 0xA2, 0xDA, 0x5D, 0xEA, 0x76, 0xA9, 0xD9, 0x65, 0xBD, 0xAE, 0x43, 0xAB, 0x6B,
+    0x69, 0xC3, 0xA8, 0x9F, 0x2E, 0x32, 0x8C, 0xF1, 0xC3, 0x61, 0xFD, 0x4C, 0x9A, 0x12, 0x71, 0x76,
+    0xE8, 0xF4, 0x1C, 0x42, 0xE0, 0x6E, 0x89, 0x0A, 0x4D, 0x60, 0x48, 0xAD, 0xEA, 0x07, 0xDE, 0x05,
+    0x6C, 0xAD, 0x0E, 0x6B, 0xBD, 0xFB, 0xE3, 0x9C, 0x5A, 0x69, 0x46, 0x65, 0xAC, 0x4D, 0x73, 0xE6,
+    0x0B, 0x90, 0x4A, 0x33, 0x2A, 0x1B, 0x2E, 0x7C, 0x81, 0x67, 0x54, 0x81, 0xE8, 0xE6, 0xE2, 0xB3,
+    0xDE, 0xBA, 0xA3, 0x79, 0x4B, 0x98, 0x21, 0x7F, 0xE1, 0x66, 0x54, 0xA1, 0x59, 0xA5, 0x8E, 0x23,
+    0x29, 0x8E, 0x64, 0xC2, 0xDD, 0xD2, 0x1D, 0xB8, 0x74, 0x20, 0x62, 0xCD, 0xAA, 0x23, 0x87, 0x96,
+    0x73, 0x94, 0xC2, 0x02, 0xAF, 0x0F, 0x88, 0xB0, 0x00, 0x96, 0xDA, 0x6C, 0x7E, 0x0E, 0x86, 0x6C,
+    0x80, 0x56, 0x37, 0x36, 0x14, 0x81, 0xD5, 0x8D, 0xA1, 0xDA, 0x1E, 0x1C, 0xE2, 0x98, 0x06, 0xF5,
+    0xBE, 0xA4, 0x71, 0xF6, 0x8E, 0x4C, 0x9E, 0x3F, 0x64, 0x8D, 0x4B, 0x8B, 0x27, 0x7D, 0x2A, 0x62,
+    0x38, 0xE3, 0x0B, 0xCF, 0x24, 0x00, 0x4B, 0xB5, 0x9F, 0x59, 0xDC, 0x74, 0xD6, 0x86, 0x56, 0x55,
+    0x47, 0xCC, 0x1E, 0xCA, 0x71, 0x3C, 0x8B, 0x4F, 0xE1, 0xBF, 0xF9, 0x3E, 0x44, 0xC5, 0x9D, 0xA1,
+    0x81, 0xA2, 0x99, 0x47, 0x5D, 0x0C, 0x5B, 0xCB, 0xCF, 0x66, 0xCF, 0x98, 0x91, 0xFE, 0x94, 0xBF,
+    0xCA, 0x9E, 0x52, 0xED, 0xB9, 0xE7, 0xC4, 0x2F, 0xEF, 0xE9, 0xBF, 0x84, 0xC6, 0xE4, 0x8C, 0xAB,
+    0xDD, 0x0B, 0xA8, 0x1B, 0x26, 0x0A, 0xE3, 0xC5, 0x97, 0x0C, 0x93, 0x8A, 0x18, 0x9C, 0x03, 0xB5,
+    0xCC, 0x21, 0xD8, 0x2D, 0x1E, 0xD9, 0x4B, 0x8F, 0x47, 0x36, 0x7C, 0x93, 0xD1, 0xAB, 0xDE, 0x64,
+    0x4C, 0x54, 0x1D, 0x68, 0x4D, 0x6F, 0xC5, 0x90, 0x39, 0xD1, 0xD9, 0x54, 0x41, 0xE6, 0x65, 0x62,
+    0x36, 0x39, 0x07, 0x2F, 0x99, 0x7D, 0x44, 0x8D, 0x1E, 0x0B, 0x9A, 0x73, 0xAE, 0x0A, 0x6E, 0x52,
+    0x5E, 0x64, 0x49, 0x63, 0x23, 0x1B, 0x1A, 0xD9, 0xC8, 0x28, 0x0C, 0x8C, 0x6C, 0x5C, 0xA4, 0x61,
+    0x91, 0x8D, 0x8A, 0x6C, 0x50, 0x64, 0x63, 0x22, 0x1B, 0x12, 0xD9, 0x88, 0xC8, 0x06, 0x44, 0x36,
+    0x1E, 0xB2, 0xE1, 0x90, 0x8D, 0x86, 0x6C, 0x30, 0x64, 0x63, 0x30, 0x1B, 0x82, 0x69, 0x24, 0x64,
+    0x03, 0x21, 0x1B, 0x07, 0x05, 0x32, 0x57, 0x7E, 0x21, 0x4F, 0xBD, 0xB2, 0xB4, 0x39, 0x76, 0x16,
+    0x8E, 0x71, 0x34, 0xC4, 0xD1, 0x08, 0x47, 0x03, 0x1C, 0x8D, 0x6F, 0x34, 0xBC, 0xD1, 0xE8, 0x66,
+    0x73, 0xDC, 0xE7, 0x50, 0x69, 0x31, 0x5B, 0xE9, 0x5E, 0xEA, 0x57, 0x9F, 0x83, 0xEC, 0x35, 0xD9,
+    0xD1, 0xD4, 0xD2, 0x46, 0x36, 0x72, 0x86, 0xE3, 0x38, 0x92, 0x28, 0x50, 0x6E, 0xBE, 0xBD, 0x5B,
+    0xD6, 0xE4, 0x3F, 0x9A, 0xA3, 0xDE, 0x83, 0xBA, 0x45, 0x7A, 0x5D, 0x19, 0xE2, 0xA4, 0xF4, 0xA3,
+    0xC9, 0xBA, 0x0E, 0x5C, 0x37, 0x3D, 0xD7, 0x94, 0x09, 0x18, 0x04, 0x70, 0x2D, 0x7E, 0x76, 0x67,
+    0x3F, 0x47, 0xDE, 0xE3, 0xAE, 0xC3, 0x78, 0x76, 0xFB, 0x33, 0xBA, 0x0E, 0x6E, 0x25, 0x98, 0xD0,
+    0x2F, 0x6A, 0x26, 0x89, 0xFF, 0x3A, 0x4F, 0x93, 0xD3, 0xBF, 0xE5, 0x21, 0x71, 0x13, 0x5E, 0xD9,
+    0x58, 0x64, 0x7C, 0xA5, 0xE3, 0x18, 0x77, 0x68, 0x7B, 0xCF, 0xF3, 0xBB, 0x19, 0x7A, 0x15, 0xCD,
+    0x85, 0x88, 0x7C, 0x08, 0x2C, 0x7F, 0x50, 0x05, 0x7B, 0x70, 0x1A, 0x1B, 0xC2, 0x2A, 0x8C, 0xB9,
+    0x4A, 0x04, 0x8D, 0xE1, 0x1A, 0xC8, 0x65, 0x17, 0xEF, 0x96, 0x48, 0x66, 0x8C, 0x68, 0x89, 0xA4,
+    0x3F, 0xF8, 0xC6, 0x97, 0x89, 0xC0, 0xDF, 0x67, 0xB8, 0x50, 0x22, 0x45, 0x16, 0x78, 0x56, 0x23,
+    0x0E, 0x95, 0xF9, 0x80, 0xC4, 0x55, 0x0F, 0x29, 0xE2, 0xE3, 0x08, 0x67, 0xF8, 0x15, 0x10, 0x78,
+    0xFA, 0x53, 0x20, 0xF0, 0xFC, 0x31, 0xC8, 0xAA, 0xE0, 0xBB, 0xDF, 0x1D, 0x00, 0xC3, 0x1F, 0x77,
+    0x28, 0xCA, 0x7E, 0xB0, 0x47, 0x4D, 0xF6, 0x14, 0x16, 0x50, 0x70, 0xA6, 0x8D, 0x02, 0xEB, 0x18,
+    0x81, 0xE7, 0xDC, 0xB3, 0x22, 0x02, 0xFF, 0x52, 0x74, 0x74, 0xCF, 0x47, 0xD9, 0xC4, 0xBF, 0xDC,
+    0xE2, 0x3E, 0x99, 0x2F, 0x32, 0x6D, 0xFC, 0x23, 0xA7, 0x78, 0xAF, 0xCC, 0x1E, 0xFB, 0xAF, 0x8E,
+    0xAC, 0x07, 0xA8, 0x86, 0x82, 0x03, 0x55, 0xD4, 0x72, 0xD9, 0x87, 0xCF, 0xB1, 0xFD, 0xCF, 0x3F,
+    0xC1, 0xF2, 0xF4, 0x31, 0xF2, 0x8A, 0xA7, 0xB3, 0xB2, 0x44, 0x43, 0x22, 0x62, 0x22, 0x81, 0xA7,
+    0x64, 0x02, 0x64, 0x35, 0xC0, 0xE7, 0x57, 0xA2, 0xA3, 0xBB, 0x51, 0x67, 0xCE, 0x60, 0xAD, 0x75,
+    0xF8, 0x1F, 0x31, 0x54, 0xE4, 0xC4, 0xE6, 0xEB, 0xC5, 0x46, 0x2F, 0xA9, 0x2F, 0xB6, 0x3E, 0xBD,
+    0x89, 0xAF, 0x23, 0x0C, 0xF5, 0x15, 0x63, 0xD4, 0xD6, 0xBD, 0x0B, 0x5A, 0xD6, 0x41, 0x4E, 0xA1,
+    0x1F, 0x96, 0xFC, 0x0E, 0xFD, 0xB0, 0xEA, 0xE5, 0x7E, 0x18, 0xF1, 0xBA, 0x2E, 0x5A, 0x58, 0xA5,
+    0xFA, 0x84, 0xD9, 0xC6, 0xDD, 0x20, 0xAF, 0xD7, 0x2E, 0xB9, 0x07, 0x48, 0xDD, 0xC6, 0xBC, 0x9B,
+    0xC7, 0xF8, 0xFD, 0x11, 0xAA, 0x0F, 0x37, 0x80, 0x86, 0x6B, 0x9F, 0x1B, 0xAF, 0x67, 0x9C, 0x83,
+    0x7B, 0xF5, 0x69, 0xBF, 0xDA, 0x86, 0xBE, 0xFF, 0x66, 0xC7, 0xDE, 0x42, 0x79, 0xED, 0x50, 0xB3,
+    0xD8, 0x4D, 0x15, 0xAB, 0x9F, 0x6A, 0x43, 0xE4, 0x87, 0x6A, 0x7F, 0xA9, 0x1A, 0xCE, 0xEF, 0x5B,
+    0xE9, 0x18, 0x87, 0x48, 0xDB, 0x7E, 0x46, 0xD5, 0xC0, 0x78, 0x90, 0xFB, 0x79, 0x1C, 0xA9, 0x65,
+    0xFD, 0xB5, 0x9B, 0x2E, 0x45, 0x75, 0x92, 0x40, 0xB7, 0xAB, 0xBE, 0xE0, 0xD8, 0x6D, 0xEB, 0xAE,
+    0x05, 0xBD, 0xB2, 0x38, 0xB3, 0x7A, 0x00, 0xC5, 0x64, 0xDA, 0x65, 0xED, 0xA6, 0x63, 0x8F, 0xBF,
+    0xF8, 0xA0, 0x6E, 0xAB, 0x80, 0x0B, 0xEB, 0x27, 0xA5, 0x92, 0x30, 0x3D, 0xB6, 0xDA, 0x6F, 0xB8,
+    0xA9, 0x10, 0xC5, 0x8A, 0x15, 0xDA, 0x7A, 0xF1, 0xEA, 0x6A, 0x54, 0x84, 0x82, 0x58, 0x9F, 0xE3,
+    0xD3, 0xC9, 0x0E, 0x87, 0x44, 0xE5, 0xFA, 0x92, 0x79, 0x55, 0xA0, 0xDE, 0x28, 0xD4, 0xB3, 0x6C,
+    0xEB, 0xDC, 0x7B, 0x51, 0xE7, 0x4E, 0x43, 0xA0, 0xFB, 0x1C, 0x78, 0x95, 0x2C, 0x01, 0x0B, 0xE2,
+    0xAE, 0xA6, 0xC3, 0x96, 0xEE, 0xFD, 0x23, 0x59, 0x72, 0x74, 0xCF, 0xE1, 0xA6, 0xCA, 0xD7, 0x31,
+    0x8C, 0xC9, 0xDB, 0xC3, 0x98, 0xBC, 0x78, 0x61, 0x4C, 0xCE, 0x83, 0x48, 0x33, 0xEF, 0xB7, 0x86,
+    0x89, 0x3B, 0xF1, 0x72, 0x11, 0xB6, 0x61, 0x7F, 0xE2, 0xE4, 0x9D, 0xD3, 0xE2, 0xFB, 0x7D, 0xFA,
+    0xC3, 0x21, 0x69, 0xC7, 0x55, 0x57, 0xB8, 0xD3, 0x75, 0xB8, 0x8D, 0x81, 0x3D, 0xB1, 0x65, 0x41,
+    0xD3, 0xE7, 0x5E, 0x15, 0x61, 0xBE, 0xEE, 0x8C, 0x11, 0x4F, 0x02, 0x7E, 0x10, 0x40, 0x8E, 0x44,
+    0x4B, 0x12, 0xDF, 0x09, 0x77, 0xDE, 0xA9, 0x73, 0x5B, 0x7C, 0xD4, 0xBB, 0x6F, 0x1C, 0x19, 0xFB,
+    0x2B, 0x20, 0x1A, 0x6E, 0x1E, 0xF9, 0x2E, 0xF1, 0x43, 0xFA, 0x64, 0xCA, 0xCA, 0x1B, 0xC1, 0xB9,
+    0xBD, 0x33, 0xCA, 0x62, 0x51, 0x96, 0x88, 0x32, 0x83, 0xAF, 0x06, 0x5E, 0x71, 0x58, 0x2E, 0x76,
+    0x0A, 0xBB, 0x07, 0x07, 0xD6, 0x41, 0xC1, 0x8F, 0x18, 0x27, 0x7E, 0x82, 0x25, 0x06, 0x00, 0x70,
+    0x11, 0xCD, 0xD7, 0xBD, 0xB9, 0x7E, 0x1D, 0x77, 0x08, 0x3E, 0x53, 0xF5, 0xBF, 0x6F, 0x4F, 0xE6,
+    0x8D, 0x05, 0x64, 0xA4, 0x76, 0xF1, 0x8B, 0xAD, 0xA9, 0x87, 0x10, 0x7F, 0x1F, 0xB7, 0x6E, 0x31,
+    0xE0, 0x4B, 0xBE, 0x34, 0xC1, 0xBC, 0x68, 0x66, 0x03, 0x4B, 0x7B, 0x40, 0xB3, 0xE9, 0xA1, 0xCA,
+    0xD3, 0xCF, 0x8D, 0xE1, 0x13, 0xC6, 0x8D, 0x82, 0xF7, 0x31, 0x32, 0x0E, 0xFD, 0x36, 0xA6, 0x66,
+    0x0E, 0x63, 0x4E, 0xAF, 0x1D, 0xDD, 0xBF, 0xC5, 0x32, 0xBA, 0x10, 0x37, 0x3E, 0x02, 0xEB, 0xBA,
+    0xAC, 0xC8, 0x51, 0xA3, 0xF3, 0x56, 0x99, 0xA8, 0xD0, 0x62, 0x77, 0xE3, 0x16, 0x2B, 0x3D, 0x3F,
+    0x1A, 0x23, 0x6A, 0xD3, 0xAA, 0x4B, 0x9B, 0xF6, 0x4C, 0xC1, 0xF0, 0x77, 0x6B, 0xD1, 0xDA, 0x34,
+    0x73, 0xAF, 0x5B, 0x4F, 0xB1, 0x57, 0x57, 0xB8, 0x5C, 0xBF, 0x03, 0xE5, 0xFE, 0x12, 0x06, 0xD9,
+    0x82, 0xBE, 0x8E, 0xF9, 0x2F, 0x2B, 0xDD, 0xB5, 0x60, 0x67, 0x23, 0xC0, 0xFE, 0xC8, 0xBA, 0x47,
+    0x1D, 0x94, 0x6D, 0xAC, 0x76, 0x6B, 0xB8, 0x0D, 0x33, 0xFC, 0x36, 0xB7, 0x61, 0x74, 0x01, 0x3A,
+    0xF7, 0x61, 0x0E, 0x14, 0x4D, 0x0F, 0x91, 0xC5, 0xDA, 0x64, 0xC7, 0x4E, 0x5B, 0x79, 0xB9, 0x7C,
+    0x2E, 0xF1, 0xB1, 0x50, 0x7C, 0x6C, 0xDD, 0x70, 0x14, 0x1F, 0x7F, 0x5F, 0x3E, 0xA5, 0xCF, 0x8A,
+    0x97, 0x6F, 0x35, 0xC4, 0x4D, 0x3F, 0x78, 0x59, 0x9F, 0x97, 0x7A, 0xD9, 0x65, 0x4D, 0x6C, 0x95,
+    0xF4, 0xBA, 0x66, 0xCA, 0xEE, 0x80, 0x86, 0xDE, 0x37, 0x36, 0x20, 0x75, 0x46, 0x35, 0xAF, 0x6A,
+    0xB4, 0xFC, 0x6B, 0x14, 0x1E, 0x5F, 0x54, 0xF8, 0xE5, 0xDE, 0xFA, 0x11, 0x92, 0x25, 0xDC, 0xC1,
+    0xAF, 0x39, 0x5E, 0x07, 0xE0, 0x01, 0xE2, 0x79, 0xCF, 0x2D, 0x59, 0xE0, 0x15, 0xCE, 0xD8, 0xAF,
+    0xC0, 0xDD, 0xD9, 0xB5, 0xF3, 0xBC, 0x4C, 0xF9, 0x04, 0x15, 0x8E, 0x7B, 0x53, 0x77, 0xCA, 0x26,
+    0xC3, 0xDC, 0xEA, 0x96, 0x92, 0xA8, 0x62, 0xB2, 0xE0, 0xB7, 0x22, 0xE4, 0x63, 0x4F, 0x42, 0xB6,
+    0xB5, 0x3B, 0x45, 0xD1, 0xF4, 0xEE, 0xD7, 0x85, 0xB0, 0xCA, 0x0A, 0x36, 0x9F, 0x2D, 0x73, 0xF7,
+    0x70, 0x47, 0x6D, 0xB0, 0x5E, 0xD4, 0x86, 0x90, 0xB9, 0x5C, 0xE6, 0xFA, 0x74, 0x90, 0x66, 0xC3,
+    0x88, 0xD3, 0x27, 0x66, 0xB9, 0xA3, 0xE1, 0x4A, 0xB5, 0x68, 0xEB, 0xC1, 0xAE, 0xA3, 0x19, 0x01,
+    0xEE, 0x3E, 0x84, 0x57, 0xF3, 0x8E, 0x2B, 0xAB, 0x03, 0xD2, 0x13, 0xC2, 0x2D, 0x9B, 0x0D, 0xBC,
+    0x84, 0x99, 0xEE, 0xAD, 0x59, 0x7F, 0x62, 0x48, 0x66, 0xE4, 0xFF, 0xA0, 0x67, 0xA8, 0x54, 0xA7,
+    0xBC, 0x98, 0x20, 0x9B, 0x97, 0x12, 0xE4, 0x8B, 0xF7, 0xE8, 0x36, 0xF3, 0x3D, 0xBA, 0x7E, 0xB9,
+    0x60, 0xB9, 0xDC, 0xB2, 0x64, 0xA9, 0xCD, 0x42, 0xE0, 0xDD, 0xB9, 0xE8, 0x5C, 0x6B, 0x46, 0x50,
+    0x3B, 0x37, 0xF1, 0x7E, 0x52, 0xC5, 0x53, 0x87, 0xB7, 0xC7, 0x9B, 0xA9, 0xA5, 0x4E, 0x43, 0x02,
+    0x96, 0x37, 0x2D, 0x75, 0x7E, 0x50, 0xA2, 0x98, 0x2F, 0x18, 0x6A, 0x4B, 0xE3, 0x83, 0x9F, 0xD9,
+    0x71, 0xCF, 0x6A, 0x11, 0x1C, 0x7F, 0xEE, 0xD8, 0x1D, 0x38, 0x02, 0xF1, 0x4C, 0xFD, 0xB5, 0xF4,
+    0xF9, 0x2D, 0xD0, 0x79, 0xB5, 0x0C, 0xDD, 0x47, 0x7F, 0xB8, 0x02, 0xAE, 0xCE, 0x7E, 0xC4, 0x8E,
+    0x7B, 0xA4, 0xFC, 0x6E, 0x73, 0xB0, 0xD8, 0xD7, 0x9C, 0x8F, 0xDD, 0xCD, 0xBA, 0xC3, 0xFD, 0x4F,
+    0x6B, 0x41, 0xCC, 0x7F, 0xEA, 0xE1, 0xE6, 0x62, 0xCF, 0xFA, 0xD2, 0x76, 0x69, 0xBC, 0x9A, 0xE6,
+    0x19, 0xF2, 0xDB, 0xDE, 0x20, 0xBE, 0x1A, 0x02, 0x13, 0x75, 0x77, 0xA3, 0x7C, 0xE9, 0x1A, 0x70,
+    0x98, 0x66, 0x95, 0x96, 0xF6, 0x36, 0xFF, 0x50, 0xEF, 0x5E, 0x6A, 0x89, 0x6B, 0xBC, 0x46, 0x95,
+    0xEA, 0x72, 0x7A, 0xC2, 0x6F, 0x24, 0xDF, 0x9A, 0x16, 0x1E, 0x16, 0x74, 0x69, 0x0D, 0x43, 0xE2,
+    0xA1, 0x4A, 0xA7, 0xEF, 0x58, 0x68, 0x92, 0x00, 0xE4, 0xA3, 0x82, 0x33, 0x81, 0x3F, 0x3B, 0xFE,
+    0x7B, 0x82, 0x5A, 0xB7, 0xB0, 0xEC, 0x6F, 0x09, 0xEC, 0x2F, 0x09, 0x6C, 0xA0, 0x18, 0x1D, 0x0F,
+    0x14, 0xD9, 0xC7, 0xB3, 0xBF, 0x9E, 0x59, 0xBA, 0x63, 0x42, 0xB6, 0xEA, 0x91, 0x95, 0xD6, 0x23,
+    0xB3, 0x3B, 0xEE, 0xBC, 0xE2, 0xEE, 0xCF, 0x1F, 0x0E, 0x6A, 0x95, 0x58, 0x5F, 0xBB, 0x3B, 0x5C,
+    0xD6, 0x80, 0x12, 0x15, 0xAC, 0x9D, 0x1C, 0xDE, 0x7A, 0x7B, 0xE1, 0x6F, 0x75, 0x6C, 0xCD, 0xF5,
+    0x97, 0x3A, 0x76, 0x94, 0xAD, 0x36, 0x50, 0xEC, 0x60, 0x9B, 0x91, 0x0D, 0x14, 0xA7, 0xDF, 0x79,
+    0xA0, 0xC8, 0x3E, 0xD4, 0x04, 0x71, 0xB1, 0x6D, 0x71, 0xD4, 0x87, 0x4A, 0xFE, 0x7F, 0x7D, 0xA8,
+    0xFF, 0x05, 0xAD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x6C, 0xDF, 0x9D, 0x93, 0x33, 0x30,
+    0x11, 0xEC, 0x4A, 0x28, 0xC9, 0xC5, 0x48, 0x50, 0xC0, 0xE9, 0x36, 0x4E, 0x91, 0xE2, 0x22, 0xED,
+    0xEE, 0x0C, 0x02, 0x89, 0x76, 0x85, 0x6E, 0x95, 0x0E, 0xAE, 0xA0, 0x88, 0x82, 0x50, 0xAE, 0x58,
+    0x89, 0x0D, 0xEC, 0xAD, 0x0D, 0x29, 0x29, 0xD8, 0x82, 0x1F, 0xB0, 0x05, 0x45, 0xB2, 0x5B, 0xB0,
+    0xC5, 0x16, 0x17, 0xE9, 0xEE, 0x6C, 0xAA, 0x48, 0xB9, 0x82, 0x11, 0x0D, 0x48, 0x14, 0x58, 0x22,
+    0x5D, 0x9A, 0x11, 0xB2, 0x84, 0x41, 0xF6, 0x0E, 0x6F, 0xBC, 0xE1, 0x42, 0x28, 0x52, 0x31, 0x1E,
+    0x7B, 0xD7, 0x33, 0x6F, 0xDE, 0xCC, 0x7B, 0xEF, 0xFB, 0x3E, 0xD7, 0x05, 0x4F, 0x99, 0x72, 0x33,
+    0xAB, 0xC0, 0x0E, 0xBA, 0x70, 0x16, 0x60, 0x39, 0x02, 0x89, 0x50, 0xA0, 0x06, 0xA0, 0x2E, 0x2C,
+    0x9D, 0xBA, 0x5A, 0xF9, 0xBF, 0x15, 0xA1, 0x28, 0x77, 0x50, 0xA7, 0x31, 0x78, 0x99, 0x8F, 0x40,
+    0x1F, 0x23, 0xD4, 0x05, 0x0E, 0xFD, 0x0C, 0x1D, 0x4B, 0xE0, 0xFC, 0x64, 0xC4, 0xB5, 0x0A, 0x75,
+    0x5A, 0xEF, 0x8A, 0xF3, 0x93, 0x49, 0xC4, 0xB5, 0x4E, 0xE8, 0x8E, 0xEA, 0xDD, 0x2E, 0x39, 0xDA,
+    0xD9, 0x47, 0xCE, 0xA7, 0x19, 0xD7, 0xA9, 0xA7, 0x23, 0x74, 0xC8, 0x07, 0x8F, 0xE2, 0x44, 0x27,
+    0xB4, 0x0B, 0xFC, 0x77, 0x52, 0xFE, 0x95, 0xA2, 0x7E, 0xD9, 0x95, 0x40, 0x9C, 0xC6, 0xD9, 0x7B,
+    0xB9, 0x93, 0x05, 0x29, 0x17, 0x6F, 0xC1, 0x12, 0x41, 0x36, 0x2C, 0x0E, 0x5A, 0x07, 0xAD, 0x61,
+    0x11, 0x64, 0x96, 0xB0, 0x76, 0xEA, 0xC2, 0x2D, 0xC2, 0x84, 0x29, 0x0D, 0x7E, 0x27, 0xC7, 0x91,
+    0x27, 0xD1, 0x59, 0x05, 0x1D, 0xBD, 0x1E, 0x5A, 0x25, 0x3F, 0xC9, 0x98, 0x96, 0x9E, 0x26, 0x33,
+    0xAC, 0x0A, 0x96, 0xF8, 0x51, 0x20, 0x38, 0x38, 0xDA, 0x18, 0xE2, 0x06, 0xEA, 0xAB, 0x82, 0xB3,
+    0x64, 0xE8, 0x47, 0xFB, 0xBE, 0x38, 0x0A, 0x70, 0x77, 0x13, 0xF5, 0xB7, 0x3B, 0xFC, 0x41, 0xCE,
+    0x7E, 0x2C, 0x5C, 0x55, 0x5A, 0x19, 0x37, 0x9E, 0x06, 0xC0, 0x02, 0xB5, 0xB2, 0xD6, 0xFC, 0xE8,
+    0xA0, 0x6D, 0xAB, 0xE0, 0xF4, 0xBC, 0x3B, 0xF0, 0x4C, 0x3C, 0x2A, 0x9C, 0xAA, 0x43, 0x2B, 0xEB,
+    0xD0, 0x50, 0x69, 0x17, 0x4E, 0xEE, 0x29, 0x5F, 0x71, 0x19, 0x26, 0x75, 0x38, 0xA5, 0x53, 0x78,
+    0x19, 0x53, 0xBE, 0xE4, 0x09, 0xA7, 0x34, 0xE9, 0xEA, 0x8A, 0x11, 0xD2, 0x65, 0xDE, 0xFF, 0x3B,
+    0x5F, 0x17, 0x61, 0x12, 0x48, 0x96, 0x3A, 0x8A, 0x7C, 0x75, 0x61, 0x6B, 0xB8, 0x05, 0x98, 0xA2,
+    0xBC, 0x2C, 0x73, 0x8C, 0xFE, 0xEA, 0x9C, 0xAB, 0xBA, 0x82, 0x02, 0xE5, 0x68, 0x03, 0x8D, 0x0E,
+    0x57, 0xAD, 0x4E, 0x1F, 0xE7, 0xCC, 0x1C, 0xD7, 0xC9, 0xE6, 0x34, 0x81, 0x1B, 0xC1, 0x15, 0xF0,
+    0x00, 0x56, 0xF5, 0xB3, 0x20, 0x47, 0x96, 0x36, 0xBE, 0x9C, 0x12, 0x41, 0x8E, 0x30, 0xC5, 0x71,
+    0xE5, 0xCB, 0xA5, 0x44, 0xB4, 0x28, 0xB6, 0x7D, 0x4A, 0xC5, 0x59, 0xD8, 0x91, 0x93, 0xB8, 0xD1,
+    0xAD, 0x47, 0x3A, 0x03, 0x36, 0xEF, 0xF2, 0xC2, 0x8D, 0x5C, 0xE1, 0x55, 0x76, 0x4E, 0xE2, 0x24,
+    0x61, 0x7E, 0xEB, 0x91, 0x87, 0x75, 0xDC, 0xBC, 0xAB, 0x73, 0x03, 0x00, 0x18, 0x28, 0xC4, 0x30,
+    0x7D, 0x01, 0xBB, 0x04, 0x2F, 0xC0, 0x33, 0x70, 0x89, 0xF5, 0xC8, 0x4F, 0x82, 0x84, 0xA2, 0x89,
+    0xF8, 0xCF, 0xBC, 0xF0, 0x0B, 0xFB, 0x5B, 0xAA, 0x65, 0xC2, 0x53, 0x4E, 0x11, 0x3E, 0x5B, 0x55,
+    0x4A, 0xBC, 0x3A, 0x2E, 0xB2, 0x66, 0xD6, 0x3C, 0x2E, 0xB8, 0xB2, 0xC8, 0x2B, 0xCB, 0x58, 0x1A,
+    0x54, 0x79, 0x70, 0x52, 0x96, 0x51, 0xE4, 0xC5, 0xF5, 0x22, 0xCC, 0x43, 0xE9, 0x28, 0x96, 0x70,
+    0x53, 0xB3, 0x31, 0xA7, 0x5C, 0xE1, 0x49, 0x15, 0x7D, 0x11, 0xC0, 0xD4, 0xD1, 0x54, 0x71, 0x7D,
+    0x32, 0x81, 0xAF, 0x35, 0x1A, 0x14, 0x71, 0x13, 0x97, 0xE8, 0x6E, 0x10, 0xBE, 0x56, 0xCC, 0xE9,
+    0x67, 0xDB, 0x1B, 0xF7, 0xCB, 0x01, 0xFF, 0x95, 0xD6, 0xD1, 0x50, 0x1D, 0xDC, 0x5A, 0x20, 0x38,
+    0xC9, 0x40, 0x98, 0x80, 0x4B, 0x65, 0xB4, 0xBA, 0x15, 0xA0, 0x01, 0xAD, 0xE0, 0x50, 0x70, 0xEC,
+    0xF7, 0xC2, 0xC0, 0xB0, 0xB2, 0xAD, 0xA1, 0xD6, 0x46, 0xC1, 0x1F, 0xE7, 0xBE, 0x56, 0xA6, 0xE4,
+    0x3B, 0x26, 0x97, 0xAE, 0x96, 0xF4, 0xCA, 0xA7, 0x39, 0xA1, 0xB7, 0x56, 0xA1, 0x16, 0x6E, 0xC6,
+    0x84, 0xAF, 0x63, 0xAA, 0xC0, 0x02, 0x03, 0x2F, 0xA7, 0x75, 0x06, 0xFA, 0x63, 0x42, 0x06, 0x75,
+    0x82, 0x3E, 0xC1, 0x5D, 0xC4, 0x5A, 0xCB, 0x9B, 0x44, 0x81, 0x55, 0xFA, 0x4F, 0x47, 0x95, 0x86,
+    0x0E, 0x66, 0xAD, 0x99, 0x33, 0x94, 0xD8, 0xA4, 0x10, 0x4C, 0xB3, 0x73, 0x2F, 0x61, 0xFA, 0xBB,
+    0xC8, 0x84, 0xD3, 0xF6, 0x4A, 0x98, 0x2D, 0x68, 0x4E, 0x84, 0x64, 0x43, 0xB7, 0xE8, 0x12, 0x75,
+    0xC8, 0x5E, 0xEB, 0x34, 0xAC, 0x9E, 0xB1, 0x79, 0x4A, 0x3C, 0x6D, 0x33, 0xB8, 0x39, 0x78, 0x6E,
+    0xD3, 0x31, 0xA9, 0x2E, 0x29, 0x98, 0x58, 0x26, 0x62, 0xD9, 0x18, 0x55, 0x01, 0x01, 0x85, 0x4B,
+    0x45, 0xA7, 0x76, 0x48, 0xB7, 0x65, 0x2A, 0xEA, 0x98, 0xFC, 0x18, 0xAA, 0xFD, 0xCF, 0x16, 0x9B,
+    0xC6, 0x62, 0x1D, 0x2C, 0x72, 0x09, 0x45, 0x1E, 0x95, 0xF1, 0x1A, 0xDE, 0xC4, 0xAB, 0x4D, 0x6C,
+    0xF5, 0xD1, 0xBC, 0xDF, 0x1D, 0x68, 0x9D, 0x77, 0xBB, 0x15, 0xF3, 0x75, 0x71, 0xAD, 0x3B, 0xE8,
+    0x61, 0x7B, 0x86, 0x5E, 0xAC, 0xD5, 0x64, 0x32, 0x36, 0x6E, 0xFE, 0xC8, 0x5B, 0xC3, 0x4F, 0xA8,
+    0x82, 0xF4, 0x7F, 0x05, 0x8D, 0x81, 0x6F, 0x80, 0xA0, 0x7A, 0xAA, 0xCA, 0x53, 0xE6, 0x49, 0x26,
+    0xBC, 0xC8, 0xA9, 0xFC, 0x9A, 0x83, 0x3C, 0x27, 0xB3, 0xA2, 0xFE, 0x2F, 0x41, 0xB3, 0xBA, 0x6E,
+    0xC9, 0xB2, 0x40, 0xC6, 0xA6, 0x9E, 0xFF, 0xAD, 0x9E, 0xBF, 0xAC, 0xDE, 0x4D, 0xC4, 0xC9, 0x87,
+    0x09, 0x4B, 0x98, 0x20, 0x1D, 0xB1, 0xA8, 0x32, 0xEC, 0xCE, 0xA2, 0x0D, 0x7E, 0x92, 0x93, 0xC2,
+    0x7C, 0x4D, 0x32, 0x73, 0xD9, 0x4F, 0x0E, 0x68, 0xC7, 0x6A, 0x3D, 0x41, 0x53, 0x84, 0xA3, 0x50,
+    0x06, 0xC9, 0x92, 0x85, 0x3A, 0x19, 0x4E, 0xA6, 0x51, 0x0F, 0x9E, 0x98, 0x11, 0x1C, 0xC7, 0x14,
+    0xFD, 0x73, 0x4F, 0x56, 0x09, 0x50, 0x9B, 0x45, 0x43, 0x23, 0x40, 0xE2, 0xC6, 0x79, 0x02, 0x63,
+    0x9C, 0x7E, 0x2C, 0xED, 0xC4, 0x44, 0x46, 0x61, 0x5B, 0x1B, 0xB5, 0xA0, 0xE8, 0x0F, 0xB5, 0x9A,
+    0x69, 0xF9, 0xFE, 0xF7, 0xD5, 0x8E, 0xAB, 0x66, 0xD3, 0xAA, 0x63, 0x6D, 0x74, 0xD1, 0x2F, 0x07,
+    0xAD, 0x38, 0xEB, 0x91, 0xE8, 0xCD, 0x61, 0x17, 0x04, 0x20, 0x60, 0x5C, 0xC5, 0x95, 0x6F, 0x31,
+    0x9D, 0x37, 0xFC, 0xD4, 0x88, 0xB3, 0xEC, 0x11, 0x14, 0xE7, 0x61, 0x62, 0x74, 0xF1, 0x0B, 0xE1,
+    0x7E, 0x29, 0xB9, 0xCE, 0xFD, 0x69, 0xEA, 0x3A, 0x4B, 0x58, 0xB8, 0x44, 0xD2, 0x60, 0xC4, 0x88,
+    0x3A, 0x0D, 0x84, 0x86, 0xBE, 0x72, 0xF9, 0xDC, 0x33, 0x93, 0xF4, 0xA4, 0x55, 0x72, 0x17, 0x0F,
+    0xAF, 0x60, 0x84, 0x33, 0xE2, 0x65, 0x1A, 0x7B, 0x01, 0x66, 0xE5, 0x2E, 0x08, 0x9D, 0xBB, 0xF4,
+    0x1C, 0x8F, 0x9E, 0x58, 0x52, 0xF5, 0xAF, 0xC8, 0x3D, 0xAA, 0xFC, 0x39, 0xB9, 0x67, 0x66, 0xA5,
+    0xB1, 0xA1, 0xE3, 0x9C, 0x81, 0x6D, 0x56, 0x89, 0x57, 0x80, 0xD7, 0xAC, 0x87, 0x57, 0x11, 0x2D,
+    0x7D, 0x2E, 0x57, 0x7D, 0x16, 0x6D, 0x46, 0x9B, 0xB4, 0x63, 0x28, 0x49, 0x41, 0x60, 0xF4, 0x89,
+    0x08, 0x9E, 0x94, 0x88, 0xB0, 0x46, 0xBF, 0x6D, 0xA2, 0x73, 0x1B, 0x01, 0xD6, 0x60, 0x1D, 0x0B,
+    0xA6, 0xD3, 0x60, 0xAA, 0x5A, 0xC8, 0xFA, 0xC5, 0x81, 0x55, 0x02, 0x05, 0x2A, 0xF1, 0x7B, 0x23,
+    0xE2, 0x29, 0xC9, 0x8C, 0x6C, 0x99, 0x60, 0x3B, 0x9E, 0xE4, 0xA2, 0x8D, 0x0B, 0x92, 0x8E, 0x45,
+    0xBE, 0x7C, 0xC2, 0xC7, 0x50, 0x8C, 0x31, 0xB2, 0xC4, 0x91, 0x93, 0xFA, 0x0F, 0x14, 0x3B, 0xE9,
+    0x1D, 0xBF, 0xB4, 0x2D, 0xB7, 0x2E, 0x1A, 0x5C, 0x7A, 0xA7, 0xB8, 0x3C, 0xFD, 0xFC, 0x18, 0x28,
+    0x47, 0xAF, 0x7F, 0xC3, 0x73, 0x4F, 0x5E, 0x52, 0x67, 0x46, 0x06, 0xCA, 0xBF, 0x64, 0xB7, 0x8F,
+    0x06, 0xB3, 0xED, 0x17, 0xA9, 0xDF, 0x5E, 0x0C, 0xFC, 0x9F, 0xD4, 0x55, 0xEC, 0x21, 0x96, 0xD3,
+    0xC4, 0x4E, 0x6C, 0x61, 0x08, 0x60, 0xAB, 0xEA, 0xAB, 0x25, 0x83, 0x47, 0x58, 0xD3, 0xC2, 0x23,
+    0x4E, 0x96, 0xA4, 0xBA, 0xC4, 0x4F, 0xE0, 0x82, 0xFE, 0x13, 0x24, 0xB2, 0xC6, 0x86, 0x1B, 0x9B,
+    0x34, 0xC8, 0x68, 0x2A, 0x7A, 0xC6, 0x66, 0xDD, 0xD8, 0x10, 0x3C, 0x26, 0x06, 0x17, 0xBA, 0x22,
+    0xB8, 0x41, 0x49, 0xD7, 0x50, 0xFF, 0x1E, 0x11, 0x7D, 0x41, 0x34, 0x2F, 0x69, 0x60, 0x89, 0x58,
+    0x12, 0xF3, 0xBF, 0x04, 0x06, 0x8C, 0xAC, 0xA6, 0x39, 0x7F, 0x4C, 0x3F, 0x6A, 0x1F, 0x6B, 0xB1,
+    0x8E, 0x4C, 0x2A, 0xCE, 0xFD, 0x43, 0x75, 0x5B, 0x2F, 0x08, 0x6D, 0xB4, 0x38, 0x27, 0x61, 0xA3,
+    0x26, 0x18, 0xED, 0x11, 0x93, 0x32, 0x13, 0x1C, 0xD2, 0x7B, 0xC6, 0x60, 0xFC, 0x54, 0x17, 0x1C,
+    0x23, 0x52, 0xDD, 0xEB, 0x69, 0x25, 0x2D, 0x45, 0x25, 0x2D, 0x15, 0xCD, 0x9C, 0x0A, 0xB0, 0x16,
+    0xEC, 0x77, 0xFD, 0xB2, 0xD9, 0xEC, 0x37, 0xFB, 0xFD, 0xFD, 0x8C, 0xCF, 0x68, 0x64, 0xCC, 0x0E,
+    0x1B, 0x4D, 0x9E, 0xB7, 0x44, 0x6B, 0xD7, 0x57, 0xE6, 0x4B, 0xB3, 0x6E, 0x28, 0x4A, 0xA5, 0x6A,
+    0xA2, 0x4F, 0x40, 0x9C, 0xC1, 0x1A, 0xF9, 0xB9, 0x59, 0xD1, 0x6B, 0xEE, 0x13, 0xD9, 0x88, 0xC0,
+    0x2B, 0x5B, 0x8D, 0x26, 0x35, 0xE3, 0xA1, 0x4D, 0x75, 0xB7, 0x47, 0x81, 0x1A, 0x90, 0xA5, 0xC2,
+    0xFD, 0xA8, 0xA2, 0x4E, 0xF5, 0xBD, 0xB2, 0x3F, 0x00, 0xC9, 0x56, 0x93, 0x9C, 0x34, 0xD1, 0xEB,
+    0x63, 0x3F, 0x43, 0x30, 0xAB, 0x74, 0x8B, 0xAE, 0x4B, 0xBB, 0x41, 0xD1, 0xAA, 0x3C, 0xCC, 0x7B,
+    0xB3, 0xD9, 0xCA, 0xEE, 0x6E, 0xB0, 0x28, 0x5A, 0xAD, 0xA5, 0xCF, 0xFE, 0x7C, 0x3E, 0x9F, 0x99,
+    0x41, 0x5F, 0x05, 0xA7, 0x87, 0x70, 0xC0, 0x3A, 0x5C, 0x6E, 0x54, 0xC7, 0x6A, 0x55, 0x7A, 0xD4,
+    0xA9, 0xA9, 0xF9, 0x2C, 0xFD, 0x34, 0xF9, 0x3C, 0xE2, 0x34, 0xB2, 0x6A, 0x09, 0xF7, 0x07, 0x38,
+    0x05, 0xAC, 0x0C, 0x0E, 0x7D, 0x12, 0x06, 0x68, 0x35, 0xF0, 0x37, 0xD5, 0x7D, 0x4D, 0xAC, 0xDE,
+    0xD6, 0x99, 0xDE, 0xF9, 0x3E, 0x5A, 0x22, 0xC6, 0x04, 0x86, 0x6A, 0x21, 0x15, 0x53, 0x1B, 0x13,
+    0x76, 0x11, 0x14, 0x81, 0xD1, 0x84, 0x9B, 0x59, 0x04, 0x28, 0x26, 0xA4, 0x6D, 0x0C, 0xBC, 0x98,
+    0x85, 0x34, 0x80, 0x64, 0x03, 0xE3, 0x85, 0xB2, 0xC8, 0xA2, 0x4D, 0xA7, 0xBD, 0xB3, 0x19, 0x20,
+    0x0B, 0xDB, 0xA4, 0xEC, 0x85, 0x17, 0x5E, 0x44, 0x40, 0x67, 0xB2, 0xE8, 0x66, 0xBC, 0xF0, 0x14,
+    0xCE, 0x15, 0x30, 0xEA, 0x62, 0x16, 0x29, 0x6A, 0x9B, 0xB4, 0x05, 0xD4, 0x40, 0xB3, 0x30, 0x63,
+    0xD7, 0xE3, 0x45, 0x16, 0xA6, 0xFF, 0x26, 0x13, 0xB9, 0x80, 0x28, 0x8B, 0x8A, 0xA8, 0x2B, 0x92,
+    0xA7, 0xEF, 0xF3, 0xBC, 0x87, 0xFC, 0xF8, 0x5D, 0x5D, 0xC9, 0x76, 0x22, 0x2B, 0xCA, 0x4D, 0xEE,
+    0xA1, 0x7C, 0x2F, 0x2F, 0x79, 0xCE, 0x7B, 0xDE, 0x9F, 0xE7, 0xFD, 0x3B, 0x9F, 0x31, 0xA7, 0x8C,
+    0x7C, 0x59, 0x0C, 0x59, 0x2E, 0x43, 0x5C, 0xCA, 0x10, 0x54, 0x32, 0xAC, 0x52, 0xA3, 0x5F, 0x89,
+    0xB5, 0xA9, 0xC9, 0xDC, 0x60, 0x4C, 0x81, 0xC1, 0xE2, 0x5E, 0xF9, 0x89, 0x59, 0xE1, 0x4F, 0xD7,
+    0x3A, 0xEC, 0xBE, 0x64, 0x3C, 0x6B, 0x1B, 0x1D, 0x7C, 0x0C, 0x41, 0x2F, 0xBF, 0x08, 0x3B, 0x0C,
+    0x2D, 0x86, 0x46, 0x86, 0x08, 0x43, 0xBC, 0xB7, 0x9B, 0xE3, 0xC1, 0x25, 0x86, 0x5C, 0x9F, 0xAE,
+    0x5F, 0xEB, 0xE6, 0x69, 0x63, 0xFC, 0x76, 0x94, 0xA1, 0x91, 0xC1, 0xAB, 0x5F, 0x31, 0x8B, 0xAF,
+    0xBB, 0x35, 0x17, 0xF9, 0x97, 0xD5, 0x21, 0x73, 0x83, 0xCC, 0x25, 0xA9, 0x31, 0x03, 0xD0, 0x26,
+    0x01, 0x95, 0x32, 0x0C, 0xC5, 0xC5, 0xB3, 0xF2, 0x72, 0xFC, 0x56, 0xEE, 0x4B, 0x57, 0x32, 0x94,
+    0x32, 0x8D, 0xA2, 0x5A, 0x8F, 0x72, 0xA7, 0x37, 0x60, 0xE8, 0x65, 0xF0, 0x7B, 0x53, 0x94, 0x41,
+    0xFF, 0xB8, 0x2D, 0xC3, 0xAE, 0xB0, 0x69, 0xD8, 0x16, 0x83, 0xCC, 0xA0, 0xC0, 0x44, 0x0E, 0x71,
+    0x61, 0xA7, 0x38, 0x7F, 0x19, 0xE4, 0x6F, 0xDC, 0xE4, 0xB8, 0x15, 0xC7, 0x16, 0x2B, 0xCF, 0x17,
+    0xCB, 0xDF, 0x5E, 0x39, 0x37, 0x50, 0x97, 0x2F, 0x33, 0xD1, 0x67, 0xE8, 0x80, 0x45, 0xFB, 0x18,
+    0x82, 0x03, 0x56, 0xAE, 0xCB, 0xDF, 0x5E, 0x95, 0x7E, 0xAD, 0x8A, 0x31, 0x35, 0x21, 0xC8, 0x26,
+    0xAF, 0xAC, 0x8C, 0xDD, 0x3B, 0x5F, 0x7A, 0x36, 0x5F, 0xA5, 0x3E, 0x1E, 0x1F, 0xE2, 0x79, 0x11,
+    0x1E, 0x15, 0x5F, 0x3D, 0x95, 0xEA, 0x1D, 0x13, 0xFD, 0x4A, 0x93, 0xBD, 0x2B, 0x3F, 0x23, 0x6D,
+    0xF4, 0xA1, 0x7C, 0x7C, 0x6B, 0x8E, 0x98, 0xC8, 0x3E, 0xDE, 0xE8, 0x33, 0xB9, 0x29, 0xB2, 0x0E,
+    0x21, 0x9D, 0x39, 0xE1, 0xDE, 0xE8, 0xDB, 0x8F, 0xE5, 0xEF, 0x47, 0x21, 0x63, 0xBF, 0xB2, 0x17,
+    0x7B, 0x4F, 0x16, 0xE3, 0x8D, 0xEE, 0xDB, 0x62, 0x47, 0xE5, 0x61, 0x56, 0xD6, 0x90, 0xC8, 0x0F,
+    0x42, 0x59, 0xF8, 0x5A, 0x5E, 0x25, 0x74, 0xD6, 0xB7, 0x24, 0xD5, 0x09, 0x93, 0x55, 0xCF, 0x08,
+    0x79, 0x41, 0x9C, 0xCC, 0x0E, 0xF2, 0x32, 0x79, 0xEF, 0x51, 0x9D, 0x84, 0x4C, 0x46, 0xFE, 0x5F,
+    0xE4, 0xA0, 0x17, 0xF6, 0x08, 0x3C, 0x22, 0xCF, 0x15, 0x02, 0x09, 0x79, 0x84, 0x38, 0xC2, 0x19,
+    0xC2, 0x17, 0x42, 0x1B, 0xA1, 0x87, 0xFC, 0x3F, 0x6E, 0x30, 0x69, 0xFD, 0x3B, 0x7E, 0x3D, 0x9D,
+    0x18, 0x33, 0x66, 0xA9, 0x7C, 0x1B, 0xF3, 0xCA, 0x1F, 0x2F, 0x98, 0xB1, 0x52, 0x9A, 0xE1, 0x3E,
+    0x79, 0x3A, 0xB7, 0x43, 0x76, 0x03, 0xFB, 0x80, 0x6F, 0x6C, 0x05, 0x36, 0x01, 0x7B, 0x80, 0x2D,
+    0x00, 0x03, 0x82, 0xFF, 0xB0, 0x09, 0xD8, 0x03, 0x50, 0x1F, 0xC4, 0x07, 0x85, 0xF0, 0x28, 0x7D,
+    0x1D, 0xF6, 0x69, 0xBA, 0x8B, 0x77, 0x4C, 0x77, 0x55, 0x9B, 0xBB, 0x8A, 0x72, 0x7E, 0x99, 0x99,
+    0x5E, 0x36, 0xD1, 0x6B, 0xD8, 0xBC, 0x2C, 0x58, 0x3C, 0x26, 0x69, 0xCC, 0xAE, 0x90, 0xB0, 0x10,
+    0xAA, 0x15, 0x10, 0x9C, 0x6E, 0x5A, 0x44, 0x64, 0x2D, 0x76, 0xD2, 0xC4, 0xEE, 0x9A, 0x70, 0x6F,
+    0xB0, 0x3B, 0x7A, 0x2D, 0x72, 0x32, 0x88, 0xBC, 0x8B, 0xDB, 0x29, 0xEF, 0x23, 0x9B, 0xC8, 0x3B,
+    0xB3, 0xFF, 0xAB, 0xFC, 0x56, 0x80, 0xD4, 0xF2, 0x5E, 0x6B, 0x75, 0xB1, 0x10, 0x18, 0xCC, 0xC1,
+    0x3E, 0x21, 0x73, 0x0C, 0x3A, 0xB9, 0x53, 0x5E, 0x1A, 0xB6, 0xB8, 0xB3, 0x94, 0xB9, 0x78, 0xBC,
+    0x26, 0x35, 0xFE, 0x22, 0x97, 0x1D, 0xF4, 0xFA, 0xB5, 0x3C, 0xDB, 0x96, 0xFE, 0x78, 0x1E, 0x22,
+    0x97, 0x06, 0xC2, 0x01, 0x26, 0x19, 0x1C, 0xF7, 0xB5, 0x72, 0x1D, 0xD3, 0x25, 0xCD, 0x57, 0x23,
+    0x65, 0xCF, 0x73, 0x97, 0x81, 0x73, 0x24, 0x9F, 0xDB, 0x9C, 0x9C, 0x2E, 0x8F, 0xE8, 0x39, 0x41,
+    0x90, 0x51, 0xE8, 0x02, 0x12, 0xAC, 0x65, 0x52, 0xB2, 0x3E, 0x0F, 0x17, 0x9B, 0xEA, 0x45, 0xDE,
+    0xB8, 0x5B, 0xEC, 0xD9, 0x3A, 0x80, 0x80, 0x26, 0x8D, 0xDC, 0x9D, 0x95, 0x51, 0x23, 0x77, 0x17,
+    0xB8, 0x34, 0x58, 0x79, 0x23, 0xA4, 0x13, 0x7E, 0xAA, 0x65, 0x13, 0xEC, 0xA7, 0xB6, 0x4C, 0x6A,
+    0x08, 0xB8, 0x10, 0x62, 0x8D, 0xB5, 0xCA, 0xCB, 0xAD, 0xB0, 0xF0, 0x97, 0x50, 0x15, 0x2F, 0x6E,
+    0x54, 0x45, 0x7E, 0x80, 0xAA, 0x28, 0x65, 0x15, 0x59, 0xE9, 0x63, 0x90, 0x39, 0x15, 0xB9, 0xCC,
+    0x08, 0xAA, 0x42, 0x48, 0x1E, 0x36, 0x14, 0x6E, 0x73, 0xE8, 0x24, 0xB7, 0x4A, 0x37, 0xA8, 0x9C,
+    0x35, 0xB7, 0xC7, 0xDD, 0x5C, 0x9D, 0x58, 0x50, 0x09, 0xFC, 0x90, 0x94, 0xFE, 0x80, 0xFB, 0x40,
+    0x87, 0x22, 0x17, 0x0E, 0x10, 0x0A, 0x91, 0x75, 0x1E, 0x26, 0x97, 0x82, 0x82, 0x2B, 0xAB, 0x44,
+    0x2A, 0x1A, 0x88, 0x19, 0x44, 0xCA, 0x83, 0x9E, 0x81, 0xC6, 0x2C, 0xC1, 0x44, 0x58, 0x42, 0xD0,
+    0xE1, 0x4F, 0xC3, 0x16, 0x6C, 0x14, 0x36, 0xCA, 0x50, 0x50, 0x01, 0x71, 0x03, 0x72, 0xCB, 0x46,
+    0x62, 0xBD, 0x95, 0xC7, 0x17, 0x52, 0x85, 0x99, 0x43, 0x9C, 0x09, 0x95, 0xCD, 0x34, 0xB7, 0x9E,
+    0xF3, 0x7A, 0x95, 0xE3, 0xD1, 0xCD, 0x3C, 0xCB, 0x35, 0x34, 0x6E, 0xE9, 0x63, 0xCC, 0x43, 0xE8,
+    0xB5, 0x34, 0x86, 0x62, 0x13, 0x32, 0x62, 0x14, 0x62, 0xAD, 0xC6, 0xF5, 0x38, 0x9A, 0xF5, 0xE0,
+    0xEF, 0x89, 0xB8, 0x0E, 0xE1, 0x95, 0x5E, 0x58, 0x2C, 0x7E, 0x07, 0x63, 0xF2, 0x7C, 0x67, 0xFC,
+    0xCE, 0x06, 0xAD, 0x09, 0x7E, 0x35, 0xC8, 0x7E, 0x85, 0xD7, 0x3A, 0x8C, 0x16, 0x7B, 0x17, 0xD9,
+    0x2A, 0xAA, 0x65, 0x2C, 0xE3, 0x4A, 0x38, 0x1B, 0x9B, 0x20, 0x7A, 0x03, 0x63, 0x0F, 0x33, 0x97,
+    0xB5, 0x94, 0x57, 0xA7, 0x78, 0x9A, 0xB0, 0x86, 0xC5, 0x89, 0xE7, 0xC5, 0x9B, 0x62, 0x20, 0xB1,
+    0x67, 0xB6, 0x93, 0x75, 0xCA, 0x26, 0x41, 0x59, 0x60, 0x0E, 0xD0, 0x7F, 0xF2, 0x9F, 0x42, 0x0E,
+    0xD9, 0x14, 0x6C, 0xB4, 0xA5, 0x40, 0x16, 0x29, 0xD6, 0x9E, 0x3D, 0x8B, 0x1D, 0x49, 0x2E, 0xE0,
+    0x09, 0xC9, 0x4F, 0xB1, 0xF6, 0xF8, 0x12, 0x55, 0x2D, 0x84, 0x44, 0x26, 0x57, 0x72, 0xC4, 0x93,
+    0x03, 0x6E, 0x1D, 0xAD, 0x92, 0x89, 0x71, 0xE3, 0xF7, 0x29, 0x70, 0x05, 0x6F, 0x29, 0x78, 0x8B,
+    0x4A, 0xE9, 0xA1, 0x99, 0xF3, 0x2D, 0x76, 0x73, 0x6D, 0x27, 0xF6, 0x17, 0xB6, 0x1F, 0xB0, 0xA7,
+    0x60, 0x7E, 0x9B, 0xCA, 0x24, 0xE5, 0x06, 0x79, 0xDE, 0x9A, 0x9C, 0x2F, 0x33, 0x94, 0x0D, 0x90,
+    0x1B, 0x64, 0x9E, 0x72, 0x83, 0x8C, 0x72, 0x83, 0x88, 0x32, 0xB9, 0x1D, 0x37, 0x60, 0x6C, 0xC1,
+    0x45, 0x60, 0x75, 0x08, 0x26, 0xC4, 0x51, 0x6C, 0xE1, 0x64, 0xFD, 0xDC, 0x48, 0xA6, 0x76, 0x46,
+    0x43, 0x0D, 0x86, 0x1B, 0x55, 0x2D, 0x3C, 0xA0, 0x74, 0xF4, 0x30, 0x5F, 0xEC, 0xA2, 0x2E, 0x31,
+    0xC6, 0x90, 0x5C, 0x02, 0x55, 0x76, 0xC0, 0x70, 0x42, 0xDB, 0xF5, 0x10, 0x55, 0x32, 0x11, 0x19,
+    0x82, 0x56, 0x86, 0xB0, 0x91, 0xFD, 0x89, 0x2B, 0x21, 0x7D, 0x72, 0xF1, 0x7C, 0x03, 0x89, 0x68,
+    0x20, 0x11, 0x0D, 0x44, 0x13, 0x7C, 0x15, 0x36, 0x54, 0xC9, 0xF2, 0xAA, 0xB0, 0x15, 0x1A, 0x07,
+    0xAD, 0x4C, 0x54, 0xF4, 0xD9, 0x64, 0x05, 0xF3, 0xA5, 0x15, 0x4C, 0x97, 0xF6, 0xDF, 0x81, 0x00,
+    0xD1, 0x19, 0x93, 0xFD, 0x97, 0x6D, 0x1B, 0x8B, 0x51, 0x16, 0xEE, 0x0B, 0x79, 0x3A, 0x2A, 0x04,
+    0x0C, 0x50, 0x44, 0x51, 0x13, 0x0C, 0xB2, 0xE6, 0xA2, 0x57, 0xB5, 0xE7, 0x8C, 0xD8, 0x75, 0xAA,
+    0xC1, 0x8F, 0x37, 0x68, 0x03, 0x3A, 0x53, 0xF6, 0xCF, 0x42, 0x86, 0x6C, 0x0A, 0x65, 0x60, 0xA0,
+    0x0A, 0xB8, 0x19, 0xE7, 0x84, 0xFE, 0xD0, 0x06, 0xD3, 0xDB, 0x06, 0xA1, 0xF3, 0x1A, 0x2F, 0x72,
+    0xB2, 0x2B, 0x83, 0x08, 0x85, 0xA8, 0x3D, 0x6B, 0xA2, 0x3D, 0x99, 0x46, 0x4C, 0xF5, 0xA6, 0x6F,
+    0x83, 0x62, 0xBB, 0x7B, 0x76, 0xDD, 0xA7, 0xEE, 0x09, 0x38, 0x86, 0x54, 0xD6, 0x21, 0xE6, 0x62,
+    0xA2, 0x9A, 0x72, 0x5C, 0xE1, 0x49, 0x09, 0x95, 0x85, 0xA8, 0x8C, 0x16, 0xEC, 0x85, 0xE7, 0x70,
+    0xBD, 0x32, 0x0F, 0x79, 0x1C, 0xD8, 0xBD, 0x32, 0xD4, 0x54, 0x86, 0x5A, 0x0A, 0x6C, 0x34, 0xB3,
+    0x8E, 0xEC, 0x92, 0x4D, 0xEF, 0xB7, 0x7B, 0xE7, 0xEC, 0x3F, 0x87, 0x50, 0xAF, 0x7D, 0x84, 0xB1,
+    0x8B, 0xA9, 0x79, 0x31, 0x99, 0xB0, 0xC1, 0x6C, 0xA2, 0x06, 0xD3, 0x89, 0x6B, 0xA8, 0xAF, 0xA4,
+    0x3E, 0x26, 0x8B, 0x3C, 0x96, 0xDE, 0x3D, 0x88, 0x29, 0x4C, 0x67, 0x01, 0x5D, 0x42, 0xDD, 0xC3,
+    0xD9, 0x3C, 0x89, 0x11, 0x1A, 0xD7, 0xB4, 0xD9, 0xDE, 0x10, 0x80, 0xC0, 0x56, 0x58, 0x15, 0x0F,
+    0x2D, 0x1E, 0xED, 0xA9, 0xCB, 0xB3, 0x37, 0x3B, 0x0A, 0x66, 0x72, 0x89, 0xE2, 0x80, 0x6D, 0x1C,
+    0x9C, 0x99, 0xA4, 0x04, 0x5B, 0xBD, 0x7A, 0x76, 0xE7, 0x23, 0xEC, 0x54, 0x30, 0xC6, 0x6F, 0xE3,
+    0xBE, 0xA8, 0x4F, 0x5E, 0xA7, 0x5A, 0x90, 0x55, 0xD3, 0x62, 0x57, 0x59, 0x29, 0x14, 0x13, 0x2C,
+    0x55, 0xE4, 0x59, 0x05, 0x1D, 0x20, 0xE6, 0x44, 0x14, 0x55, 0x0F, 0x0A, 0xD3, 0xDC, 0x59, 0x45,
+    0x56, 0xF8, 0xDA, 0x11, 0x83, 0x4D, 0xFE, 0x5D, 0x53, 0x06, 0xF7, 0x9E, 0x94, 0x27, 0xA5, 0xAB,
+    0x99, 0xDD, 0xCD, 0x44, 0x97, 0x7F, 0x75, 0xBE, 0xC7, 0x44, 0x64, 0x9A, 0x19, 0x38, 0x8A, 0xF6,
+    0xD8, 0xEC, 0xB4, 0x93, 0x76, 0x51, 0x36, 0x21, 0x66, 0xEB, 0xCC, 0xFF, 0x7C, 0x58, 0x40, 0x27,
+    0xB9, 0xB9, 0x00, 0x55, 0x62, 0x32, 0xFB, 0xD1, 0x7B, 0x45, 0x17, 0x9B, 0x62, 0x45, 0x7B, 0x4E,
+    0xF6, 0x4E, 0x08, 0x48, 0x22, 0x92, 0xDD, 0x9C, 0xBC, 0x47, 0x6C, 0xC6, 0x6F, 0xD9, 0xB2, 0x66,
+    0xD8, 0x39, 0x30, 0x5B, 0xC5, 0xB1, 0x34, 0x84, 0x11, 0x46, 0xB1, 0x95, 0x22, 0x2A, 0x20, 0xB0,
+    0x94, 0xF8, 0xCB, 0x28, 0x7B, 0xCB, 0xA3, 0x31, 0x67, 0x22, 0x2F, 0x11, 0x3C, 0xE8, 0x0F, 0x3A,
+    0x24, 0x58, 0x05, 0x18, 0xA7, 0x84, 0xE0, 0x5B, 0xA0, 0x0D, 0x05, 0x4B, 0x97, 0x2C, 0x25, 0x7A,
+    0x00, 0x43, 0xCA, 0x16, 0x88, 0xE8, 0x02, 0xDF, 0x57, 0x33, 0xFD, 0x3B, 0x79, 0x69, 0x0D, 0xAA,
+    0x78, 0xF2, 0xF3, 0x4C, 0xB4, 0x2B, 0xF4, 0x63, 0x4F, 0xC5, 0x2F, 0xBC, 0x1A, 0xE9, 0x25, 0x29,
+    0xF2, 0xD5, 0x28, 0x84, 0x2B, 0xD2, 0xD5, 0x30, 0x98, 0xB1, 0x30, 0xEB, 0x7E, 0x58, 0xF5, 0x82,
+    0xBB, 0xFB, 0xC1, 0xEB, 0x78, 0xF1, 0x2F, 0x8F, 0xB2, 0x15, 0x43, 0xF8, 0xE1, 0x20, 0xDA, 0xFD,
+    0xB5, 0xF8, 0x82, 0xE0, 0xF0, 0xE6, 0xB5, 0xE4, 0x51, 0xA8, 0xFE, 0xD7, 0x0A, 0x5F, 0x94, 0x7F,
+    0x5D, 0x0C, 0xB2, 0x4F, 0x51, 0x5D, 0xF4, 0x72, 0x89, 0xAB, 0xAC, 0x95, 0x3D, 0x4A, 0xCA, 0xAC,
+    0xD1, 0x0B, 0xF6, 0x2A, 0xC9, 0x33, 0x6C, 0x16, 0x26, 0x67, 0xE9, 0x73, 0xD0, 0x34, 0x62, 0xC9,
+    0x45, 0xBE, 0xA6, 0x0A, 0xC1, 0x92, 0x05, 0xEF, 0x0D, 0x50, 0x22, 0x3E, 0x4D, 0x23, 0x0D, 0xE4,
+    0xEE, 0xF9, 0x8E, 0x58, 0xB0, 0x75, 0xA3, 0x6F, 0x9D, 0x2A, 0x91, 0x25, 0xC3, 0x34, 0xD6, 0xA0,
+    0x03, 0x0C, 0x24, 0x5E, 0x05, 0x6A, 0xC8, 0xB3, 0xE3, 0x46, 0x71, 0x2B, 0x75, 0x9D, 0x7B, 0xA1,
+    0xA2, 0x32, 0x75, 0x98, 0xAE, 0x53, 0x9F, 0xE6, 0xBA, 0x45, 0x76, 0x0F, 0xA6, 0x2C, 0x8D, 0x3A,
+    0xE1, 0x93, 0xA0, 0x97, 0x47, 0xFA, 0x7D, 0x04, 0x6B, 0x2C, 0x0F, 0xF1, 0x06, 0x79, 0x86, 0x87,
+    0xFD, 0xF7, 0x31, 0x04, 0x3D, 0xF5, 0x28, 0x86, 0x56, 0xFE, 0x33, 0x6E, 0xE4, 0xB7, 0x02, 0x38,
+    0xC5, 0x68, 0x94, 0xD1, 0xF8, 0x24, 0xE1, 0xF0, 0x08, 0x05, 0xD0, 0x62, 0xF3, 0x73, 0xE7, 0x30,
+    0x2D, 0x4D, 0xB3, 0x02, 0xCE, 0x82, 0xFA, 0x48, 0x96, 0x7A, 0x5B, 0x2C, 0x10, 0x2E, 0xB1, 0x00,
+    0x17, 0x8C, 0xA5, 0x1E, 0x84, 0x05, 0x84, 0xD7, 0xB1, 0xFD, 0xA9, 0xAA, 0xF5, 0x2D, 0xF0, 0x21,
+    0x6F, 0x3F, 0x8B, 0x61, 0x30, 0xB3, 0xC9, 0x2A, 0xC1, 0xFF, 0x15, 0x7D, 0x04, 0x1A, 0x09, 0x0E,
+    0x64, 0x4A, 0x6F, 0x38, 0x4C, 0x03, 0x69, 0x41, 0xE3, 0x01, 0xD6, 0x47, 0x94, 0xEE, 0xF8, 0x77,
+    0x37, 0x6B, 0xEB, 0xDA, 0xDC, 0x84, 0x9A, 0xBF, 0x9C, 0x2B, 0xDA, 0x98, 0x83, 0x61, 0xF7, 0x97,
+    0x72, 0x45, 0xE5, 0x15, 0x03, 0xBE, 0xA1, 0xD6, 0x65, 0x5D, 0xDD, 0xEC, 0x9C, 0xCD, 0x7E, 0x5E,
+    0x79, 0xB0, 0x9F, 0x77, 0x0B, 0xD7, 0x0B, 0xDF, 0xF7, 0x04, 0x7A, 0xDC, 0x68, 0xD8, 0x74, 0x71,
+    0x79, 0x80, 0xEB, 0x7E, 0xD0, 0xD2, 0x36, 0x16, 0xD6, 0x11, 0x04, 0xEB, 0x0E, 0xEC, 0xA3, 0x7D,
+    0x24, 0xE0, 0xB1, 0xF3, 0x7A, 0x59, 0x5B, 0xDC, 0xC0, 0x4B, 0x83, 0xDA, 0x80, 0x42, 0x49, 0xCA,
+    0xA0, 0xE5, 0x45, 0x14, 0x0B, 0x7C, 0x17, 0x81, 0x52, 0x82, 0x09, 0x04, 0xD0, 0xC9, 0xD2, 0xE2,
+    0x21, 0xAE, 0x0A, 0x38, 0x6D, 0x16, 0x3B, 0xCD, 0x87, 0xA5, 0xE4, 0x93, 0x8E, 0x5B, 0xF9, 0xEE,
+    0x72, 0x0E, 0x4E, 0x78, 0x18, 0x81, 0x02, 0x03, 0xC0, 0x10, 0x36, 0xCE, 0x59, 0x94, 0xBF, 0x0A,
+    0x21, 0x3C, 0x42, 0x3D, 0xE8, 0x51, 0x4A, 0x8E, 0xD0, 0x0D, 0x5B, 0xB0, 0xD2, 0x60, 0x11, 0xB8,
+    0xDE, 0x40, 0xF1, 0xE0, 0xDF, 0x2D, 0x4D, 0x61, 0x47, 0x94, 0x43, 0x40, 0x70, 0x83, 0x24, 0xBC,
+    0x82, 0x7B, 0x8A, 0xD7, 0xB9, 0x51, 0x20, 0xB0, 0x2C, 0x05, 0x8F, 0x47, 0x30, 0xC6, 0xC4, 0xAD,
+    0xA1, 0xA8, 0xC1, 0x35, 0xFE, 0xA2, 0xE0, 0xBA, 0x73, 0x02, 0xE5, 0x6D, 0x83, 0xEB, 0xF8, 0xD6,
+    0xE0, 0x3A, 0xDA, 0x07, 0xAE, 0xFF, 0x99, 0xB2, 0xDB, 0xBB, 0x31, 0xB3, 0x4A, 0x18, 0xE7, 0x2B,
+    0x2D, 0x41, 0xB6, 0x3A, 0x79, 0x0F, 0x9C, 0x15, 0x1D, 0x09, 0x9C, 0x8C, 0x47, 0x42, 0x27, 0x09,
+    0xCD, 0xE9, 0xA6, 0xAA, 0x5F, 0x2E, 0x88, 0x74, 0x21, 0x75, 0xD8, 0x21, 0x28, 0x79, 0x30, 0x30,
+    0xFC, 0xFA, 0xDE, 0xD0, 0x97, 0x36, 0x7F, 0x7F, 0xFE, 0x96, 0x18, 0x69, 0x4B, 0x68, 0x18, 0xAB,
+    0x92, 0x39, 0xD3, 0x2E, 0x14, 0xA5, 0xBA, 0xA1, 0xF0, 0xD1, 0x4B, 0x7A, 0xA2, 0xB0, 0x11, 0xC0,
+    0x27, 0xC0, 0xB4, 0xF4, 0x47, 0x61, 0x27, 0x84, 0x01, 0x56, 0x00, 0x87, 0xF2, 0x5A, 0xF0, 0x02,
+    0xAC, 0x0B, 0x66, 0x00, 0xFB, 0xE2, 0x0D, 0xEA, 0xCD, 0xF2, 0xA1, 0x01, 0x54, 0x20, 0x7C, 0xDA,
+    0xD6, 0x41, 0x63, 0x00, 0x7B, 0x3E, 0xC1, 0x00, 0x20, 0x63, 0x26, 0x11, 0xCC, 0x14, 0x78, 0x40,
+    0x20, 0xE4, 0x6E, 0x01, 0x1B, 0x4C, 0x2F, 0x9D, 0xA4, 0x5A, 0x5E, 0x5D, 0x38, 0x2D, 0x07, 0x1F,
+    0xF6, 0xAA, 0x87, 0x31, 0x3F, 0xC3, 0xA7, 0x73, 0x5E, 0xB9, 0x5A, 0x3C, 0xC0, 0xEE, 0x79, 0x7E,
+    0x83, 0xCA, 0x9B, 0x47, 0xE9, 0xDB, 0xCC, 0x2F, 0x70, 0xF3, 0x0B, 0x17, 0xF3, 0xEB, 0x75, 0x7E,
+    0x9C, 0xE7, 0x3C, 0xBF, 0x5A, 0xCD, 0x28, 0x79, 0x94, 0x4F, 0x90, 0xED, 0xC4, 0x3C, 0x2F, 0xBA,
+    0x79, 0x8D, 0xFB, 0xAE, 0xC3, 0xEC, 0x3A, 0x6E, 0x5D, 0x03, 0x17, 0x78, 0x09, 0x1D, 0xC8, 0x13,
+    0x57, 0x99, 0x38, 0x27, 0x51, 0x35, 0x34, 0x0D, 0x37, 0x69, 0xB2, 0x77, 0x29, 0xD6, 0xED, 0x56,
+    0xAC, 0xF1, 0x71, 0x0D, 0x20, 0x94, 0x32, 0x1D, 0x06, 0x42, 0x32, 0x04, 0x10, 0x6C, 0x09, 0xFF,
+    0x23, 0x0D, 0x10, 0x4D, 0x09, 0x30, 0x0D, 0xAA, 0x39, 0x0D, 0xA2, 0x10, 0x7F, 0xD7, 0x7C, 0x22,
+    0x58, 0x9F, 0xA4, 0x74, 0xA8, 0x86, 0x4A, 0x0D, 0x16, 0x14, 0x8A, 0x40, 0xED, 0x1A, 0x62, 0x14,
+    0x27, 0x40, 0xC5, 0x35, 0xC3, 0x15, 0x10, 0xE6, 0x56, 0x2F, 0xD0, 0x05, 0xFE, 0x70, 0x7A, 0xF4,
+    0xE0, 0x55, 0x79, 0x56, 0x5E, 0x0D, 0xBF, 0x0A, 0x5E, 0x9B, 0x08, 0x2E, 0xA2, 0x69, 0xC2, 0x85,
+    0xB2, 0x50, 0x80, 0x19, 0xA1, 0xAB, 0xF8, 0x57, 0x1D, 0x58, 0x57, 0xE6, 0x11, 0x51, 0x89, 0xE7,
+    0x40, 0xBA, 0x0B, 0xDD, 0xBA, 0x8C, 0x91, 0x10, 0xF4, 0xE7, 0xDB, 0x0E, 0xDD, 0x09, 0xC6, 0x6F,
+    0x88, 0x85, 0x3B, 0xE7, 0x62, 0x0D, 0xA7, 0x2D, 0x5F, 0xAD, 0x08, 0x67, 0x72, 0xE8, 0xEC, 0x6D,
+    0x1C, 0x3A, 0x87, 0xA8, 0x11, 0x38, 0x84, 0xC8, 0x91, 0x8C, 0xA0, 0x11, 0x10, 0x35, 0x7D, 0xFE,
+    0x8D, 0xAD, 0x28, 0xCD, 0xA1, 0x53, 0x59, 0xB9, 0x0C, 0x69, 0x62, 0x38, 0x76, 0x0A, 0xF7, 0x69,
+    0x8C, 0x16, 0xF3, 0xA2, 0xFD, 0x89, 0x7B, 0xF3, 0xCC, 0xE3, 0xB2, 0x2D, 0x19, 0xE6, 0x47, 0x6B,
+    0x18, 0x53, 0xA0, 0x8F, 0x6E, 0x05, 0xAD, 0x2B, 0xB3, 0x43, 0xF2, 0x8B, 0x7A, 0x21, 0x4A, 0x2F,
+    0x43, 0xCE, 0x41, 0x90, 0xE3, 0x08, 0xFD, 0x25, 0xB6, 0xB3, 0xF6, 0x09, 0x54, 0x60, 0x2A, 0xE5,
+    0x15, 0x6B, 0x0C, 0x8A, 0x23, 0x19, 0xAD, 0x3C, 0x47, 0xE6, 0xA5, 0x2B, 0x30, 0x5D, 0xD7, 0x34,
+    0xA8, 0x9D, 0x22, 0x1A, 0xD5, 0x48, 0x41, 0x07, 0x26, 0x96, 0x0D, 0x6F, 0xE5, 0xCA, 0x5D, 0x90,
+    0x21, 0xC2, 0x36, 0xC8, 0xC3, 0x33, 0xC4, 0x35, 0x3D, 0xFB, 0x23, 0x40, 0x39, 0x46, 0xB1, 0x08,
+    0x62, 0x10, 0x29, 0xC5, 0x7A, 0x03, 0xDA, 0x97, 0x79, 0xDE, 0x87, 0x27, 0x7B, 0x40, 0xD0, 0x0A,
+    0x1C, 0x29, 0x6E, 0x2E, 0x8C, 0x2D, 0x14, 0x63, 0x04, 0x6D, 0xEF, 0x20, 0xAA, 0x8E, 0x42, 0x74,
+    0x98, 0xBB, 0xE1, 0x74, 0x47, 0x78, 0xAB, 0xE1, 0x36, 0x85, 0xBD, 0x32, 0x06, 0xC0, 0x3B, 0x32,
+    0x0F, 0x6A, 0x18, 0x3A, 0x7F, 0xB6, 0x14, 0xEA, 0x0A, 0x8F, 0x0A, 0xC9, 0x65, 0x66, 0x32, 0x93,
+    0x88, 0x62, 0x4C, 0xE7, 0x67, 0x8A, 0x4A, 0x76, 0x09, 0x80, 0x45, 0x96, 0xAE, 0x15, 0x3A, 0xC8,
+    0x76, 0xF3, 0xED, 0x61, 0xEB, 0x0D, 0xB4, 0x46, 0x2A, 0xCA, 0x53, 0x74, 0x7D, 0xD2, 0x8E, 0x35,
+    0x18, 0xAC, 0x15, 0xC8, 0x1D, 0x83, 0xD0, 0xA1, 0xBD, 0x04, 0x13, 0x74, 0x5C, 0x5E, 0x7C, 0x64,
+    0xDE, 0x8C, 0xC3, 0x83, 0xBC, 0x1A, 0xEA, 0x11, 0x81, 0xCB, 0xEB, 0x2B, 0x71, 0xF3, 0xB1, 0x28,
+    0xC6, 0x66, 0x9B, 0xD7, 0x4C, 0xFC, 0x0B, 0x5B, 0x82, 0x73, 0x92, 0x21, 0x6B, 0x04, 0x69, 0xB6,
+    0x85, 0x3C, 0x56, 0xD4, 0x9F, 0x7E, 0x8B, 0x5A, 0x41, 0x4C, 0x30, 0x2B, 0x93, 0x2A, 0xA9, 0x79,
+    0x5F, 0x1A, 0x5A, 0x3C, 0x4E, 0xD6, 0x77, 0x9F, 0x7B, 0x7C, 0x40, 0x3E, 0x10, 0x39, 0xB1, 0xBD,
+    0x2F, 0xBE, 0x64, 0xD8, 0x79, 0x83, 0xD0, 0xBF, 0x87, 0x0C, 0xC8, 0xFD, 0x67, 0xC1, 0x4E, 0x49,
+    0x05, 0x6F, 0x10, 0x68, 0x2F, 0x6C, 0xE3, 0x26, 0x6A, 0x21, 0xA0, 0xF4, 0x0A, 0x8A, 0x71, 0x93,
+    0x75, 0xC9, 0x28, 0x76, 0x22, 0x96, 0x42, 0x42, 0x84, 0x1F, 0xA9, 0xAF, 0x65, 0x13, 0x03, 0xFE,
+    0x2C, 0xF7, 0x29, 0xD8, 0x39, 0x8C, 0x98, 0x8A, 0x51, 0xE3, 0x63, 0xCD, 0x10, 0x76, 0x2E, 0x4F,
+    0xCD, 0xFE, 0x09, 0x2A, 0x8D, 0x1C, 0x03, 0x6C, 0x1C, 0x78, 0xEE, 0xEB, 0x11, 0xDD, 0xD4, 0x71,
+    0x8A, 0x2B, 0x80, 0xE4, 0x71, 0x0D, 0x66, 0xEB, 0x35, 0x2E, 0x9A, 0x86, 0xA3, 0x10, 0x5B, 0xEC,
+    0x3E, 0x74, 0x32, 0x15, 0x1E, 0x0D, 0xFF, 0xA4, 0xD4, 0x93, 0x8A, 0x36, 0x4E, 0x20, 0x57, 0xDC,
+    0x66, 0xC4, 0x50, 0xE0, 0x1E, 0x1A, 0xD8, 0x6E, 0x89, 0x36, 0x02, 0x22, 0x61, 0xC4, 0x74, 0x3A,
+    0x6F, 0xF4, 0xFB, 0xA0, 0x17, 0x3B, 0xDE, 0x06, 0x5D, 0x7C, 0xB5, 0x68, 0x01, 0xE3, 0x40, 0xBB,
+    0x64, 0xEF, 0xAC, 0x9A, 0x1D, 0x99, 0x7F, 0xDC, 0xFA, 0x39, 0xD0, 0x73, 0x40, 0x55, 0x33, 0x6C,
+    0xC1, 0x16, 0xE1, 0x14, 0xC0, 0x0E, 0x31, 0x6F, 0x75, 0xD0, 0x06, 0x56, 0x84, 0x48, 0x3C, 0x81,
+    0x18, 0x6C, 0x23, 0xBE, 0x5B, 0xF6, 0x31, 0x36, 0x2F, 0xAA, 0xE9, 0x5A, 0xF5, 0xF1, 0x07, 0x96,
+    0x11, 0x92, 0xEC, 0x17, 0xA3, 0x06, 0x3C, 0xA8, 0x86, 0x7D, 0xE7, 0x9C, 0x87, 0xA3, 0xBD, 0xC4,
+    0x6B, 0x23, 0x5E, 0x3D, 0x75, 0x2C, 0x54, 0x97, 0xCC, 0xBC, 0xB4, 0x1E, 0x25, 0xF7, 0x8C, 0xC5,
+    0x2A, 0x12, 0xF1, 0x1E, 0x91, 0x6A, 0xC8, 0xDA, 0xF5, 0x00, 0x6C, 0xA5, 0x5B, 0x9B, 0x3A, 0xC9,
+    0x20, 0x86, 0x05, 0xA2, 0xAD, 0xD6, 0x29, 0x67, 0xAE, 0x4A, 0xEC, 0x1C, 0x72, 0x0B, 0xD7, 0x0D,
+    0xE7, 0xFE, 0x38, 0xA5, 0x07, 0x64, 0x2F, 0xBF, 0x27, 0xBE, 0x2A, 0xE4, 0xA8, 0x40, 0xBC, 0x18,
+    0x7C, 0x22, 0x7E, 0x2C, 0x16, 0x23, 0xFA, 0x72, 0x04, 0x2F, 0x03, 0x3A, 0x89, 0x40, 0xF5, 0x10,
+    0xA4, 0xA4, 0x16, 0x7F, 0x50, 0x78, 0x02, 0x36, 0x5E, 0xFC, 0x9A, 0xA6, 0x28, 0x13, 0xF9, 0x2E,
+    0xEA, 0xE2, 0x6D, 0x5B, 0x65, 0xF6, 0x92, 0xF0, 0xDB, 0x4E, 0x19, 0x0E, 0x71, 0xCE, 0xA9, 0x1C,
+    0x93, 0x27, 0x65, 0xE2, 0x2C, 0xC3, 0x61, 0x82, 0xED, 0x08, 0x60, 0x18, 0xD5, 0x49, 0xBE, 0x13,
+    0xCF, 0x77, 0x81, 0x69, 0xD1, 0x76, 0xDE, 0xC8, 0x54, 0x49, 0x48, 0xEF, 0x19, 0x38, 0xA7, 0xE0,
+    0x86, 0x03, 0x92, 0x33, 0x8E, 0x24, 0xEB, 0x8D, 0x6E, 0xC0, 0xBD, 0xBC, 0xAC, 0x9C, 0x04, 0xBD,
+    0x02, 0x3F, 0xA9, 0xA4, 0x85, 0xA1, 0xD3, 0x04, 0x7C, 0x1E, 0xA8, 0x15, 0xB2, 0x70, 0xB3, 0x65,
+    0x88, 0x3F, 0x01, 0xF0, 0xAA, 0x84, 0x70, 0x72, 0x23, 0x90, 0x06, 0x12, 0x34, 0x29, 0x3D, 0x38,
+    0xE4, 0x69, 0x90, 0xA6, 0x91, 0x3D, 0x90, 0xF7, 0xCA, 0x44, 0x4E, 0xF7, 0xDC, 0x0F, 0x60, 0xB7,
+    0x86, 0x2E, 0xAE, 0xE7, 0x6C, 0x29, 0xDC, 0x50, 0x2B, 0x3C, 0x2A, 0x1C, 0x2A, 0xAA, 0x4D, 0xFE,
+    0x5F, 0xCB, 0x28, 0x02, 0x22, 0xA3, 0x40, 0x65, 0xFF, 0x86, 0x30, 0x49, 0x19, 0x5C, 0x6B, 0x12,
+    0xD1, 0xB7, 0x57, 0x9A, 0x22, 0xCB, 0xC3, 0x2B, 0x97, 0x87, 0x22, 0x8D, 0x3E, 0xBA, 0x22, 0x0E,
+    0x68, 0xF4, 0xCE, 0x8D, 0x46, 0x38, 0xFC, 0x82, 0xAD, 0x85, 0xB1, 0x2F, 0xD8, 0xD7, 0x39, 0x3E,
+    0x2B, 0x9B, 0xF4, 0x9C, 0x95, 0xC7, 0x17, 0x8F, 0x8E, 0x1E, 0x75, 0xAD, 0xF8, 0x91, 0xA3, 0xBA,
+    0x91, 0xF0, 0x22, 0xE9, 0x44, 0x72, 0x90, 0x9F, 0x4E, 0xC6, 0x75, 0xD0, 0x30, 0x5A, 0x74, 0xF5,
+    0x34, 0x80, 0x20, 0x62, 0x94, 0x35, 0x9D, 0x47, 0xFA, 0x8E, 0x74, 0x1D, 0x49, 0x84, 0xA4, 0xDE,
+    0x08, 0x46, 0x81, 0x59, 0xDB, 0xCE, 0xB7, 0x7F, 0xDA, 0x8B, 0x56, 0x1B, 0x64, 0xA3, 0x46, 0xD1,
+    0x69, 0x23, 0x1C, 0x7E, 0x20, 0x28, 0x08, 0x1A, 0xE4, 0x0C, 0x0F, 0x82, 0x94, 0x41, 0xC8, 0x7C,
+    0x5A, 0xFC, 0x6E, 0x16, 0x8C, 0x55, 0x1F, 0xB7, 0xEB, 0xDE, 0x0E, 0xC2, 0x88, 0xA3, 0x67, 0xDF,
+    0x13, 0x06, 0x5E, 0x59, 0x5F, 0x26, 0x18, 0xC8, 0xD4, 0x44, 0xE9, 0x70, 0xF3, 0xB1, 0xF1, 0x54,
+    0x3E, 0x9B, 0x8D, 0x6F, 0x85, 0x16, 0x8D, 0x06, 0xF6, 0x68, 0x99, 0x10, 0xEB, 0xCA, 0x92, 0xD9,
+    0x89, 0xBB, 0x0A, 0xED, 0x22, 0xBE, 0xF5, 0x96, 0x13, 0xC7, 0xE4, 0x04, 0xB1, 0x45, 0x01, 0x38,
+    0x27, 0x42, 0x3A, 0xC0, 0xEA, 0xD8, 0x3F, 0x1D, 0x75, 0xE5, 0xE1, 0x0D, 0xEC, 0xEA, 0x67, 0xD0,
+    0x46, 0xF5, 0xD1, 0xC9, 0xA2, 0x1F, 0x64, 0xD6, 0xE7, 0x78, 0xFA, 0x83, 0xCC, 0x44, 0xD5, 0x50,
+    0x70, 0xBE, 0x7D, 0xBC, 0x84, 0x13, 0x07, 0x1E, 0x81, 0x9A, 0x5B, 0xFA, 0x5B, 0x1B, 0xE5, 0xF0,
+    0x00, 0xF5, 0x75, 0x80, 0xD0, 0xCE, 0x82, 0x06, 0x8E, 0x0C, 0x70, 0x73, 0x7B, 0xDB, 0x27, 0xB4,
+    0x8C, 0x23, 0xD3, 0x3B, 0xEF, 0xC9, 0x4A, 0x44, 0x46, 0xD7, 0xB6, 0x2C, 0x72, 0x7F, 0x80, 0xA9,
+    0xC9, 0x03, 0x80, 0x16, 0xD1, 0x6E, 0x1D, 0x58, 0x28, 0x15, 0xF2, 0xF4, 0x44, 0x9F, 0xDC, 0x4F,
+    0x18, 0x30, 0x59, 0x28, 0xE8, 0xC4, 0x94, 0x2D, 0xAD, 0x0C, 0xC4, 0x84, 0xD0, 0x10, 0x37, 0x11,
+    0x6E, 0x07, 0x9D, 0xCB, 0x2A, 0x69, 0x80, 0x24, 0xA5, 0x6B, 0x4C, 0xC6, 0xC5, 0x9E, 0x9E, 0x81,
+    0xEB, 0xF0, 0xDC, 0x88, 0x50, 0x21, 0x62, 0x2B, 0x3F, 0x85, 0x66, 0x7E, 0x0B, 0x2B, 0xBA, 0x54,
+    0xB9, 0x80, 0x78, 0xCC, 0x08, 0x24, 0xA3, 0xE9, 0xC3, 0x04, 0xC8, 0xA3, 0x19, 0xEC, 0x01, 0x80,
+    0x9C, 0xA3, 0x6B, 0x49, 0xF0, 0xC5, 0xE0, 0xE3, 0xD9, 0x05, 0x8A, 0x50, 0x75, 0xCD, 0x38, 0xB0,
+    0xC6, 0x80, 0x35, 0x08, 0xEC, 0x46, 0xBF, 0xA3, 0xA6, 0xC4, 0xDF, 0x6B, 0x26, 0xCF, 0x6A, 0x50,
+    0xFA, 0x6F, 0xAF, 0x01, 0x20, 0x44, 0x1F, 0x60, 0xC9, 0x71, 0x05, 0xE8, 0x95, 0x08, 0x4D, 0x92,
+    0x9A, 0x63, 0x95, 0x95, 0xF0, 0x20, 0x8A, 0x1C, 0x2E, 0x44, 0xF1, 0x08, 0x34, 0xBE, 0x30, 0x91,
+    0x89, 0xAE, 0xDB, 0x9D, 0x9E, 0x2E, 0x9C, 0xBA, 0x83, 0x40, 0x86, 0x9C, 0xCF, 0xF2, 0xB5, 0x7C,
+    0xA1, 0x83, 0xB3, 0x37, 0x7B, 0x2F, 0xF2, 0x22, 0xE4, 0xD1, 0x28, 0xE4, 0x60, 0x8C, 0x0F, 0xA1,
+    0x21, 0xAE, 0xC1, 0xC8, 0xDA, 0x56, 0x8D, 0x24, 0x62, 0xA0, 0xF8, 0x57, 0xEA, 0x42, 0x7C, 0x09,
+    0x06, 0x7B, 0x1E, 0x06, 0x3B, 0x42, 0x64, 0x02, 0xE9, 0x58, 0x6C, 0x6D, 0x56, 0xCB, 0x8C, 0x7E,
+    0x0D, 0x95, 0x76, 0x15, 0x71, 0x91, 0xC4, 0x1E, 0x1F, 0xC2, 0x41, 0x9E, 0xC2, 0xB8, 0x08, 0xA6,
+    0x1C, 0xE0, 0xF5, 0xCD, 0xE6, 0x6F, 0x22, 0x9A, 0x74, 0xA1, 0x42, 0x0D, 0x1A, 0x08, 0x02, 0x2B,
+    0x85, 0x79, 0x4A, 0x48, 0x83, 0xFC, 0x7D, 0x1E, 0x75, 0xCB, 0x14, 0xEB, 0x94, 0xCF, 0xC5, 0x7C,
+    0x10, 0xDC, 0xC8, 0x03, 0x2A, 0xA5, 0x94, 0xEC, 0x02, 0x97, 0xC1, 0x53, 0x66, 0x22, 0x4F, 0x81,
+    0x5D, 0xE8, 0x11, 0x29, 0x33, 0x55, 0x64, 0xA6, 0x44, 0x99, 0x09, 0x53, 0xA5, 0x13, 0x2A, 0xBF,
+    0xED, 0xE4, 0x39, 0x45, 0x2D, 0xD8, 0xA7, 0xF8, 0x47, 0x61, 0x5A, 0x51, 0x17, 0xF6, 0x7D, 0x7B,
+    0x03, 0xC8, 0xF5, 0xB8, 0xFD, 0xA9, 0x40, 0x18, 0x11, 0xF0, 0xB0, 0x82, 0xF5, 0x39, 0x42, 0x9A,
+    0x7F, 0x45, 0xAF, 0x1D, 0xF8, 0x5A, 0xD8, 0x64, 0x79, 0xED, 0x9B, 0x96, 0xAF, 0x85, 0x07, 0x25,
+    0xAF, 0x65, 0xBA, 0x55, 0x16, 0xAF, 0xFE, 0x8C, 0xE7, 0x2E, 0xBD, 0xEE, 0x57, 0xC6, 0x24, 0x3C,
+    0x36, 0xF2, 0xD4, 0x22, 0x5D, 0x71, 0xCA, 0x68, 0xC0, 0xCA, 0xE5, 0x45, 0xCE, 0x23, 0xDC, 0xB7,
+    0xB6, 0x1A, 0x92, 0x74, 0xFA, 0x13, 0x36, 0x45, 0xE1, 0xEC, 0x1C, 0xD8, 0x42, 0xFA, 0x72, 0xC5,
+    0xCC, 0x31, 0x08, 0x4D, 0x49, 0x34, 0x14, 0x53, 0x19, 0x7D, 0xC2, 0xB3, 0x60, 0x38, 0x09, 0x9F,
+    0x02, 0x0E, 0x44, 0x0D, 0x53, 0x22, 0xAB, 0x1B, 0x05, 0x4E, 0x30, 0x69, 0xCB, 0xB5, 0x09, 0x4C,
+    0x93, 0xDF, 0xB4, 0xD0, 0x6F, 0xB2, 0xA7, 0x82, 0x64, 0x6C, 0x45, 0x27, 0xE8, 0x0C, 0xF0, 0xCD,
+    0x80, 0xC7, 0x1E, 0x9A, 0x24, 0x69, 0xB1, 0x99, 0x1A, 0xB4, 0x91, 0x67, 0x43, 0xCF, 0xE2, 0xB9,
+    0xF2, 0xD4, 0x4E, 0x54, 0x02, 0x39, 0x4C, 0xE8, 0xD9, 0xE3, 0xF9, 0xF8, 0x79, 0xC0, 0x8C, 0xED,
+    0x38, 0xEB, 0x9F, 0xC3, 0x88, 0x65, 0x21, 0xBD, 0x04, 0xD0, 0xF5, 0x08, 0x39, 0x85, 0x46, 0xDF,
+    0xEC, 0x02, 0xA4, 0x58, 0xA4, 0x87, 0xF3, 0xD5, 0x29, 0x17, 0x29, 0x12, 0x3C, 0xF5, 0xBD, 0x68,
+    0xA0, 0x20, 0x01, 0x08, 0x40, 0xE7, 0x9A, 0x74, 0x21, 0xDB, 0x31, 0xA2, 0x7C, 0x2B, 0xFC, 0x95,
+    0xE8, 0x73, 0xB1, 0x64, 0xC2, 0xB7, 0x31, 0xF5, 0x37, 0x56, 0x8F, 0x5D, 0x95, 0xB7, 0x57, 0x02,
+    0xF1, 0x31, 0x47, 0x1D, 0xDB, 0x68, 0x4F, 0x60, 0xA9, 0xF8, 0x54, 0x58, 0x3B, 0x12, 0x2A, 0xB0,
+    0xA7, 0x04, 0xA6, 0x65, 0x8C, 0x2A, 0x88, 0x12, 0xC6, 0x59, 0xBC, 0x43, 0xC5, 0xF6, 0xF7, 0x31,
+    0xFE, 0x62, 0x11, 0xE0, 0x9E, 0xCA, 0x35, 0x8A, 0x8A, 0x0E, 0x5F, 0xC1, 0x01, 0xD5, 0x11, 0x53,
+    0xFE, 0x09, 0x48, 0x12, 0xF7, 0x89, 0x54, 0x22, 0x9B, 0x61, 0x2F, 0x00, 0xE4, 0x32, 0x80, 0x05,
+    0x1F, 0xAF, 0x83, 0x8D, 0x63, 0xB4, 0x1A, 0x79, 0x5E, 0x10, 0x8F, 0xCC, 0x01, 0x3E, 0x49, 0x36,
+    0x10, 0xF0, 0x4E, 0x00, 0xC0, 0xE0, 0x8C, 0x4C, 0xF7, 0x1D, 0xF1, 0x20, 0xE5, 0x3B, 0xBC, 0xD0,
+    0x98, 0x3B, 0x0D, 0x2E, 0x9D, 0xA1, 0x09, 0x74, 0xDF, 0x4B, 0x86, 0x6F, 0xB9, 0x5D, 0x2B, 0x01,
+    0xDF, 0x49, 0xBB, 0x1E, 0x27, 0xFB, 0x7A, 0xC1, 0xFA, 0xB2, 0x37, 0xB0, 0x7B, 0x61, 0x3F, 0x6B,
+    0xA1, 0xC9, 0xB6, 0xC2, 0x56, 0x77, 0x4B, 0x8D, 0xB2, 0x29, 0xEB, 0xC8, 0x2A, 0xF3, 0x10, 0x9D,
+    0xC8, 0x94, 0x75, 0x2B, 0x40, 0xEB, 0x66, 0x75, 0x52, 0xC3, 0x96, 0xB8, 0x07, 0x25, 0x57, 0xC3,
+    0xA6, 0x08, 0xE6, 0x8E, 0x80, 0x7E, 0xE7, 0x84, 0x1C, 0x64, 0x5F, 0xAF, 0x9E, 0x94, 0xA9, 0xF4,
+    0xEA, 0x7B, 0x7F, 0x72, 0x62, 0xA6, 0x4F, 0xD2, 0x7E, 0x8D, 0xF6, 0x35, 0x64, 0xA4, 0x79, 0x61,
+    0x5F, 0x0B, 0x4A, 0x29, 0xE8, 0x22, 0xCA, 0x26, 0xE0, 0x6C, 0xC2, 0x5E, 0xCB, 0x6F, 0x3C, 0x78,
+    0x14, 0xCC, 0x1E, 0x0E, 0x73, 0xA1, 0xCE, 0xC7, 0x3E, 0x8A, 0x40, 0x50, 0x00, 0xD2, 0xAA, 0x52,
+    0x38, 0x31, 0x65, 0x6C, 0x58, 0x7F, 0x23, 0x74, 0x48, 0x67, 0x76, 0xDF, 0x5F, 0x82, 0xD3, 0x6D,
+    0x97, 0xE0, 0xB0, 0xFE, 0x46, 0x4B, 0x70, 0xE8, 0x98, 0x9B, 0xD5, 0xE5, 0xD6, 0xBB, 0xD6, 0x79,
+    0xD7, 0x5A, 0xEF, 0xC3, 0x66, 0xF3, 0x90, 0xD1, 0x3D, 0xC4, 0x9F, 0x1F, 0xD2, 0xBA, 0x87, 0xCC,
+    0x45, 0x3C, 0xF3, 0xCB, 0xE7, 0xB9, 0xCC, 0x71, 0xDC, 0x24, 0xDD, 0x32, 0xAE, 0xCB, 0x12, 0x9A,
+    0x83, 0x6A, 0x76, 0xA2, 0x65, 0xCD, 0xCE, 0xBE, 0x6A, 0x9C, 0x62, 0x13, 0x12, 0x86, 0xA7, 0xCC,
+    0x58, 0x7C, 0xE7, 0x0C, 0x78, 0xA0, 0x95, 0x34, 0xA1, 0x75, 0x41, 0x5C, 0x18, 0x3F, 0x13, 0x7D,
+    0xE2, 0xE2, 0xD2, 0x2E, 0xE4, 0x90, 0xBD, 0x8B, 0x30, 0xA9, 0x18, 0x9E, 0x1E, 0x0F, 0xA3, 0xD3,
+    0x6D, 0x51, 0x73, 0x22, 0x0C, 0xC9, 0x18, 0xCF, 0x6A, 0x64, 0xBE, 0x59, 0x30, 0x28, 0x2C, 0xC0,
+    0x93, 0xD0, 0xA2, 0x62, 0xAC, 0x04, 0x8A, 0x5C, 0x92, 0x7F, 0x08, 0xBE, 0xB4, 0x8C, 0xD4, 0x45,
+    0xF2, 0xEC, 0xA3, 0xCA, 0x4F, 0xBC, 0xC1, 0x10, 0xF3, 0xC8, 0xAA, 0xA8, 0x81, 0x00, 0xDB, 0x9C,
+    0x7A, 0xF5, 0x87, 0x27, 0x34, 0x17, 0x2C, 0x6C, 0xC5, 0x58, 0x6D, 0xEB, 0x72, 0xB6, 0x8D, 0x88,
+    0x77, 0x0F, 0x55, 0xEA, 0x11, 0x7E, 0x02, 0x88, 0x8A, 0xBA, 0xE9, 0x93, 0x52, 0xEE, 0x6D, 0x59,
+    0xF1, 0x02, 0x74, 0x5F, 0xB0, 0x24, 0x67, 0xF2, 0x55, 0x0F, 0x14, 0x23, 0x43, 0x31, 0x5A, 0x8D,
+    0x07, 0x88, 0x51, 0xFF, 0x45, 0xC5, 0x88, 0xA1, 0x61, 0xA6, 0x1C, 0x18, 0x3E, 0x0B, 0x19, 0x13,
+    0xCB, 0x17, 0x55, 0x71, 0x77, 0xDC, 0x4D, 0x81, 0x46, 0x03, 0xA6, 0x21, 0xC6, 0x81, 0x64, 0x66,
+    0xF3, 0xDB, 0xEE, 0x88, 0xDB, 0xB6, 0x3A, 0x21, 0x6F, 0xF0, 0x1B, 0x31, 0xE9, 0x5E, 0x97, 0x20,
+    0x0F, 0x4C, 0x57, 0xB1, 0x5F, 0x54, 0x9B, 0xFC, 0x16, 0x10, 0xE6, 0x6F, 0xBC, 0xB2, 0x87, 0x11,
+    0x09, 0x53, 0xF3, 0x0F, 0xB8, 0x00, 0x73, 0xB0, 0xA6, 0x86, 0x5B, 0x23, 0x42, 0xCE, 0xA0, 0xB0,
+    0xE0, 0x4E, 0xC6, 0x6A, 0xEA, 0x8C, 0x51, 0x84, 0xD2, 0xD5, 0x39, 0xB9, 0x4A, 0xA7, 0x0C, 0x3A,
+    0x0A, 0x2B, 0x8D, 0x3A, 0xB2, 0x79, 0x02, 0x84, 0x23, 0xBF, 0xED, 0x08, 0xC0, 0x6D, 0x07, 0x1C,
+    0xF8, 0xBA, 0x45, 0x14, 0x31, 0xBB, 0x60, 0x7B, 0xC8, 0xF6, 0x7B, 0x37, 0x90, 0x3C, 0x4B, 0xDE,
+    0xBF, 0x82, 0x8D, 0x4E, 0xEC, 0x3B, 0x03, 0x1D, 0xF8, 0x0B, 0xD8, 0xEC, 0xC8, 0x3E, 0x62, 0xA9,
+    0xA5, 0xD6, 0xC0, 0x16, 0xE1, 0x08, 0x37, 0x91, 0x41, 0x5D, 0xD6, 0x1D, 0x84, 0xE2, 0xD5, 0x6B,
+    0xCA, 0x02, 0xA3, 0x2C, 0xB2, 0x04, 0xFA, 0x27, 0x88, 0x10, 0x68, 0x8C, 0x8A, 0x2F, 0xE4, 0x18,
+    0xC5, 0x90, 0x96, 0x16, 0x91, 0x9E, 0x37, 0xAC, 0x00, 0x89, 0xF8, 0x1D, 0x2B, 0x6C, 0x13, 0x7F,
+    0x7A, 0xE3, 0x0A, 0xF2, 0x9B, 0x3F, 0x15, 0xCA, 0x85, 0xF6, 0x79, 0xFA, 0xB3, 0x48, 0x81, 0x06,
+    0x03, 0xA0, 0x2C, 0x81, 0x8D, 0xBC, 0x60, 0xA3, 0x18, 0x62, 0x40, 0x14, 0xFD, 0xAE, 0x57, 0x4E,
+    0x39, 0xAC, 0xED, 0x1E, 0xB0, 0x51, 0x0D, 0xF0, 0x03, 0x78, 0xE4, 0xF7, 0xFE, 0x88, 0xD8, 0x69,
+    0x88, 0x6F, 0x71, 0x03, 0x01, 0x72, 0xC4, 0xAC, 0xF7, 0xC0, 0xF0, 0x8C, 0x15, 0x6D, 0x62, 0x97,
+    0x3D, 0xD4, 0xFE, 0xAA, 0x47, 0x6D, 0x92, 0x48, 0x14, 0x11, 0xC5, 0x7B, 0x1C, 0x57, 0xAA, 0xB7,
+    0x28, 0xDB, 0x2B, 0xFB, 0xF7, 0x29, 0x9E, 0x67, 0x21, 0xC1, 0xF2, 0x0E, 0x44, 0x62, 0x9F, 0xEC,
+    0xB1, 0xA1, 0xD8, 0x52, 0x8E, 0xB2, 0x1B, 0x90, 0x35, 0xCF, 0x02, 0x3A, 0x89, 0x09, 0x45, 0x25,
+    0x46, 0x66, 0x97, 0xF2, 0xAC, 0x22, 0x1D, 0xA3, 0xB6, 0x0D, 0x38, 0xA6, 0xD7, 0x80, 0x25, 0xF0,
+    0x7C, 0x32, 0x9E, 0x6B, 0x18, 0xAE, 0x14, 0x0D, 0x63, 0x1F, 0xD6, 0x38, 0xAD, 0xA7, 0xA0, 0x8F,
+    0xC8, 0x70, 0x6D, 0xCF, 0x8F, 0x5A, 0xA2, 0x31, 0x57, 0xDB, 0x35, 0xD3, 0x45, 0x6C, 0x74, 0x43,
+    0x8F, 0x81, 0x17, 0x41, 0x54, 0xAD, 0x5E, 0x94, 0x47, 0xC5, 0x11, 0xBD, 0x0F, 0x18, 0xD6, 0xFE,
+    0xE8, 0x15, 0x44, 0xEB, 0x99, 0x22, 0xA9, 0x68, 0x4D, 0x90, 0x80, 0x45, 0x31, 0xCE, 0x56, 0x11,
+    0x00, 0x60, 0x1D, 0x1C, 0x54, 0x41, 0x01, 0x10, 0x7F, 0xF1, 0xF9, 0x45, 0xBD, 0xFC, 0xA8, 0xC4,
+    0xD2, 0x20, 0xBC, 0x4C, 0xBB, 0x59, 0x97, 0x01, 0xB1, 0xEA, 0xCB, 0xC8, 0xA6, 0x5D, 0xCF, 0xC4,
+    0xEA, 0x45, 0x2C, 0x43, 0x61, 0x9E, 0x55, 0xDE, 0x14, 0x77, 0x11, 0xC2, 0x59, 0x96, 0x59, 0x2D,
+    0x94, 0xEF, 0x09, 0x49, 0xAE, 0xCF, 0x79, 0xB3, 0x95, 0xE6, 0xED, 0x2B, 0xE7, 0xB2, 0x84, 0xE0,
+    0xA4, 0xF8, 0xFD, 0xDA, 0xC9, 0x9D, 0x3D, 0x8E, 0x24, 0x5E, 0x20, 0x2B, 0x1C, 0x4F, 0x37, 0x1A,
+    0xF9, 0x24, 0x9D, 0x62, 0x26, 0x0E, 0xDF, 0xBF, 0x22, 0x18, 0xFB, 0x2D, 0xE1, 0x18, 0x1B, 0x7D,
+    0x24, 0xDA, 0x2E, 0x7E, 0x47, 0x50, 0x4A, 0xF2, 0x46, 0x1F, 0x76, 0xC9, 0x1B, 0x22, 0x61, 0x32,
+    0x88, 0x2C, 0x9C, 0x19, 0x45, 0xE5, 0x3F, 0x3C, 0x32, 0x8E, 0x6C, 0x90, 0x4B, 0x57, 0x9B, 0xBA,
+    0x1A, 0x69, 0x82, 0x06, 0xB8, 0x2B, 0xD0, 0x5E, 0x8D, 0x56, 0x63, 0x19, 0xAD, 0x8E, 0x01, 0x4E,
+    0x5F, 0x8F, 0x45, 0x96, 0x7B, 0xBD, 0x4D, 0xC4, 0x19, 0x18, 0x85, 0x79, 0x2F, 0x0F, 0xA2, 0xC9,
+    0xDE, 0x1E, 0xE2, 0x32, 0x7B, 0xA3, 0x8F, 0x69, 0x39, 0x13, 0x56, 0xF3, 0x30, 0x09, 0x98, 0x31,
+    0x23, 0xCF, 0x9C, 0x38, 0x93, 0x59, 0xDE, 0xC8, 0x4B, 0x78, 0xB5, 0x67, 0x0E, 0xE7, 0xB2, 0xA6,
+    0x46, 0x7E, 0x06, 0x90, 0xB7, 0x5B, 0xBC, 0x3B, 0xEA, 0x86, 0xB9, 0x8B, 0x9D, 0x2E, 0x02, 0xB3,
+    0xAE, 0x0F, 0x05, 0xB6, 0xEF, 0xB3, 0xBE, 0x90, 0x7D, 0x8B, 0x3F, 0xEA, 0x0B, 0xF1, 0x3D, 0xB2,
+    0x0B, 0x7D, 0x26, 0x70, 0xDB, 0x3E, 0xDF, 0xC9, 0xE5, 0x03, 0x1B, 0x08, 0x4F, 0xC5, 0x1F, 0x8D,
+    0x10, 0xA5, 0xE4, 0xBD, 0x9E, 0x97, 0xB7, 0x3A, 0x5C, 0x0C, 0x9E, 0x97, 0xAE, 0x00, 0x60, 0x52,
+    0x68, 0x05, 0x46, 0x71, 0x92, 0x4B, 0x8C, 0x2A, 0xEC, 0x94, 0x9E, 0x68, 0xBC, 0x08, 0x31, 0x0E,
+    0x60, 0x5C, 0x8E, 0x9A, 0x40, 0x0C, 0xAF, 0x66, 0x97, 0x6C, 0x13, 0xD5, 0xC9, 0xFB, 0xEF, 0x37,
+    0x71, 0x55, 0xFC, 0xED, 0xCF, 0x9B, 0xF8, 0x75, 0x1B, 0xFF, 0xB4, 0x4D, 0x2E, 0x0C, 0xC9, 0x9B,
+    0x6D, 0xF2, 0x3C, 0xEA, 0x39, 0xB2, 0xE3, 0x6D, 0xF6, 0x5C, 0xCF, 0x69, 0x8E, 0xDC, 0x74, 0x9D,
+    0xF9, 0xC0, 0xAA, 0x99, 0x96, 0x85, 0xAA, 0x15, 0x63, 0xEB, 0xA9, 0xD3, 0x9E, 0x2E, 0xB3, 0xCA,
+    0x9C, 0xAA, 0xFA, 0x1F, 0x0C, 0xE5, 0x30, 0xDF, 0x24, 0xBF, 0x7C, 0xAF, 0x07, 0x0C, 0x7E, 0x41,
+    0x96, 0x65, 0x44, 0x2B, 0x66, 0x39, 0xF4, 0x22, 0xA2, 0x1F, 0xD0, 0x81, 0xF0, 0x05, 0x10, 0x45,
+    0x89, 0xA9, 0x2A, 0xE0, 0x45, 0xCB, 0x77, 0x95, 0x30, 0x4D, 0xD0, 0xEB, 0x10, 0x33, 0xD0, 0x55,
+    0xA3, 0x44, 0xAA, 0x29, 0xC4, 0xF4, 0xFE, 0x0A, 0xF2, 0x8A, 0x97, 0x44, 0xB6, 0xDF, 0x6C, 0xA0,
+    0xE8, 0xC7, 0x22, 0x49, 0xBD, 0x0E, 0x1B, 0xD8, 0x8C, 0x49, 0x1E, 0x7E, 0x20, 0x7B, 0x17, 0xCB,
+    0xDE, 0x95, 0xC9, 0x73, 0x32, 0xC0, 0x38, 0x69, 0xCE, 0xAB, 0xD4, 0x9C, 0x57, 0xC6, 0x2B, 0x52,
+    0x71, 0x9A, 0xEE, 0x17, 0x87, 0x95, 0xB0, 0xCE, 0xA6, 0x51, 0xAD, 0xF5, 0x59, 0x98, 0x1E, 0xAB,
+    0x1C, 0x3A, 0xAA, 0x99, 0xDD, 0x73, 0x78, 0x9D, 0xDB, 0x49, 0xB7, 0x87, 0xA5, 0xBB, 0xA2, 0xF2,
+    0x20, 0xE8, 0xEC, 0xE9, 0x86, 0xC2, 0x68, 0x99, 0x8A, 0x4B, 0x3E, 0x70, 0xD7, 0x37, 0x70, 0x15,
+    0xAF, 0xF8, 0xD9, 0x91, 0x40, 0xCA, 0x22, 0x3C, 0x05, 0xFF, 0x9D, 0x42, 0x95, 0xBC, 0x33, 0xE0,
+    0x4F, 0x85, 0x82, 0x02, 0xBA, 0x61, 0x27, 0xC7, 0x80, 0xA9, 0xA8, 0x21, 0xE0, 0x9A, 0x06, 0xE6,
+    0xF8, 0xC5, 0xD9, 0x43, 0xC5, 0x86, 0xEC, 0x2C, 0x4B, 0xFE, 0x3A, 0xF3, 0x9A, 0x90, 0x52, 0x37,
+    0x46, 0x11, 0x47, 0xAA, 0xE9, 0xE1, 0xD2, 0x70, 0x7B, 0x2B, 0x13, 0xD5, 0xD9, 0xE9, 0xB7, 0x50,
+    0x0D, 0x28, 0x5B, 0x2B, 0xC8, 0xED, 0xF5, 0x21, 0x91, 0x4B, 0x72, 0x41, 0x36, 0x57, 0x2E, 0xCF,
+    0xB7, 0xD9, 0x63, 0xE2, 0x15, 0x1F, 0x6F, 0x0A, 0x5F, 0x53, 0x66, 0xE2, 0x08, 0x3F, 0x05, 0xEB,
+    0x92, 0x10, 0xD6, 0xB2, 0xE4, 0x70, 0x54, 0xEC, 0xAC, 0xD5, 0x05, 0x0C, 0x7F, 0x88, 0xA8, 0xF7,
+    0xE6, 0xFE, 0x9B, 0xEA, 0x9F, 0x84, 0x1D, 0x76, 0x99, 0x48, 0x22, 0x4D, 0x34, 0x5D, 0x91, 0x3A,
+    0x31, 0x5F, 0xD6, 0x08, 0x60, 0x80, 0xC0, 0xEF, 0x68, 0xE9, 0x9F, 0xD6, 0x24, 0x47, 0x4C, 0x9A,
+    0x5C, 0x4F, 0xB7, 0x42, 0x5C, 0x58, 0x06, 0x3D, 0x2A, 0x5F, 0x71, 0x1D, 0xB5, 0x86, 0x39, 0x2C,
+    0x0B, 0x86, 0x5E, 0x5D, 0x5F, 0x1D, 0x73, 0xCD, 0x4E, 0x3F, 0x88, 0xB7, 0x65, 0xAE, 0xAC, 0x32,
+    0x35, 0xDF, 0x5C, 0x6D, 0x25, 0xB9, 0x3C, 0xF0, 0x9F, 0xAF, 0x7A, 0x06, 0xAB, 0x7C, 0xB0, 0x9F,
+    0x0B, 0xFD, 0xB0, 0x36, 0x60, 0xEC, 0xF3, 0xAA, 0xCC, 0x90, 0xDA, 0x10, 0xF0, 0x95, 0xFC, 0x72,
+    0x6A, 0xD8, 0xE0, 0x90, 0x68, 0xE6, 0x09, 0x75, 0x3F, 0x73, 0x27, 0x85, 0x98, 0x92, 0xD6, 0xEF,
+    0x60, 0xD6, 0x82, 0x2E, 0xAA, 0x51, 0x5E, 0x14, 0x57, 0xCE, 0xC8, 0xD5, 0xE0, 0x62, 0xD1, 0x7A,
+    0xF0, 0x19, 0x4B, 0x91, 0xAB, 0x1C, 0x41, 0xD8, 0x22, 0xCD, 0x72, 0x8C, 0xF2, 0xBF, 0x5C, 0x10,
+    0xE8, 0xC3, 0xE2, 0x13, 0xD6, 0x36, 0xB0, 0x2E, 0x53, 0x1D, 0x6B, 0x85, 0x8C, 0x46, 0x83, 0xFE,
+    0xD3, 0xF8, 0xD7, 0x9B, 0x38, 0x50, 0x7F, 0x70, 0x1C, 0x68, 0x0A, 0xDE, 0xDF, 0x14, 0xAF, 0xF2,
+    0x97, 0xE1, 0x23, 0x96, 0x47, 0x60, 0x4E, 0xE0, 0x44, 0x40, 0xCD, 0x88, 0xB1, 0x99, 0xB8, 0x86,
+    0x71, 0x86, 0x64, 0xD1, 0x1C, 0xCB, 0x8C, 0x31, 0x26, 0x2C, 0x9E, 0x63, 0xBC, 0x4A, 0x66, 0x0A,
+    0x89, 0x16, 0xB1, 0x58, 0x43, 0x67, 0x23, 0x6A, 0x95, 0x7C, 0x30, 0xEE, 0xB0, 0x40, 0x94, 0x99,
+    0x1F, 0x4B, 0xF0, 0x4B, 0x62, 0x2E, 0x67, 0x18, 0x2C, 0x66, 0x18, 0xDE, 0x54, 0xCC, 0xEA, 0xEA,
+    0x4D, 0xB4, 0x32, 0xB2, 0xD4, 0x14, 0xA2, 0x15, 0xA7, 0x52, 0x34, 0x57, 0xD8, 0x23, 0x0C, 0xC5,
+    0x4C, 0xDB, 0x80, 0xA4, 0xFF, 0x10, 0x5F, 0x3D, 0xF5, 0x04, 0x4A, 0x45, 0x58, 0x2F, 0x82, 0xE8,
+    0xA3, 0x0C, 0xA8, 0x51, 0xD5, 0x72, 0x1E, 0x56, 0x0D, 0x41, 0x0B, 0xD7, 0x28, 0x19, 0x2D, 0xA3,
+    0xE1, 0x49, 0xE4, 0x8A, 0x54, 0x35, 0x6D, 0x55, 0xF2, 0xF0, 0xE5, 0x08, 0x6B, 0x32, 0xC4, 0xDB,
+    0x84, 0x43, 0xD4, 0x22, 0x88, 0x2C, 0xD0, 0xAB, 0xCF, 0x2E, 0x9E, 0xEB, 0x51, 0x38, 0x81, 0x3A,
+    0x94, 0xE2, 0xE2, 0x79, 0x86, 0x35, 0x10, 0xBA, 0xCB, 0x3E, 0x60, 0xEE, 0x29, 0x57, 0x77, 0xED,
+    0x63, 0xBA, 0xF6, 0x90, 0x30, 0xD4, 0x10, 0x25, 0x3D, 0x74, 0x7E, 0x0F, 0xC3, 0xFE, 0xFF, 0x12,
+    0x41, 0xEB, 0x9A, 0xCB, 0x67, 0x55, 0x27, 0x76, 0x5F, 0x86, 0x04, 0x82, 0x86, 0xC2, 0x04, 0x21,
+    0xA3, 0x48, 0x1E, 0x20, 0xF1, 0x87, 0xB0, 0x31, 0x1F, 0x01, 0x32, 0x7D, 0x0A, 0x57, 0x07, 0x15,
+    0x27, 0xA1, 0x9A, 0xBB, 0xD2, 0x95, 0x9B, 0xB0, 0xDA, 0x24, 0x70, 0x29, 0x6D, 0x79, 0xD9, 0xCA,
+    0xA2, 0xFE, 0x0E, 0xB0, 0x40, 0xF8, 0x67, 0x0F, 0xBC, 0xC4, 0x78, 0x62, 0x29, 0x20, 0xE9, 0x8D,
+    0xD1, 0xA0, 0xD4, 0x2E, 0xFA, 0x79, 0x67, 0xA2, 0xF7, 0x1B, 0x3E, 0x08, 0xCF, 0x09, 0x29, 0xF5,
+    0xFA, 0x90, 0x43, 0x7F, 0x06, 0x17, 0xF8, 0x32, 0x64, 0xB0, 0x2D, 0x80, 0x69, 0xE0, 0x88, 0xBD,
+    0x1A, 0x0A, 0x49, 0x8E, 0xCE, 0xE9, 0xAF, 0xBB, 0xB5, 0x9E, 0x63, 0x7F, 0x72, 0x82, 0xF6, 0x20,
+    0x92, 0x39, 0xFB, 0x75, 0x6F, 0xD6, 0xCD, 0x77, 0x64, 0x63, 0x0E, 0xDD, 0x91, 0x75, 0x2E, 0x83,
+    0xB7, 0xC5, 0xF4, 0xDF, 0xE4, 0x2C, 0xB3, 0xEC, 0xB4, 0x10, 0x35, 0xB0, 0x57, 0xB4, 0xAE, 0x8C,
+    0x3A, 0x8F, 0x34, 0xB9, 0xE1, 0x23, 0xB5, 0x8E, 0x2A, 0xD5, 0x3C, 0x44, 0xDC, 0x85, 0x05, 0x17,
+    0xAC, 0x20, 0x63, 0xDD, 0x32, 0xCB, 0xC8, 0x02, 0x84, 0xC5, 0x50, 0x4B, 0x26, 0xFF, 0xD2, 0x92,
+    0x13, 0x41, 0x93, 0x1D, 0x32, 0xA0, 0xA8, 0x2A, 0xF3, 0x3B, 0x78, 0x36, 0x15, 0xD2, 0xA6, 0x60,
+    0x49, 0xFC, 0x4B, 0xD0, 0x34, 0x4B, 0xB9, 0x98, 0x40, 0xB5, 0x5A, 0x03, 0x50, 0xAF, 0x81, 0x35,
+    0x12, 0x94, 0x9B, 0x11, 0x1D, 0xB0, 0xE6, 0x6C, 0x45, 0xE0, 0x6C, 0x19, 0x6E, 0xD7, 0x3C, 0x6E,
+    0xAB, 0xFA, 0x50, 0x19, 0x97, 0xCC, 0x4B, 0xEE, 0x9D, 0xF3, 0xB5, 0xDE, 0x38, 0xC7, 0x66, 0xFA,
+    0x29, 0xD1, 0x3A, 0xF7, 0x98, 0xCC, 0xD9, 0x65, 0x06, 0x6E, 0xDC, 0xBF, 0xAE, 0x6F, 0x97, 0x25,
+    0x89, 0x0C, 0xA0, 0x36, 0x17, 0x1D, 0x54, 0x25, 0x0B, 0x41, 0x28, 0x0D, 0xC8, 0xF7, 0x84, 0xC3,
+    0x4E, 0xCB, 0x54, 0x76, 0x2C, 0xAB, 0x64, 0x95, 0x24, 0x84, 0x23, 0x10, 0x31, 0x61, 0xF9, 0x46,
+    0xD0, 0x32, 0x4C, 0x10, 0x74, 0x7E, 0x07, 0xC7, 0x34, 0x97, 0x55, 0x76, 0xAE, 0x16, 0xC4, 0xBB,
+    0x3E, 0x6A, 0x15, 0xB3, 0x77, 0x03, 0xF0, 0x47, 0x6C, 0x35, 0x75, 0x3E, 0xE4, 0x67, 0xAD, 0x09,
+    0x51, 0x9B, 0x33, 0x3A, 0x16, 0x72, 0xA5, 0xA5, 0x51, 0x71, 0xE2, 0x1C, 0xEF, 0x9B, 0x02, 0xEE,
+    0x9B, 0xA0, 0xA7, 0xAB, 0x36, 0x93, 0xAF, 0xFB, 0xDD, 0x76, 0x29, 0x20, 0x34, 0x73, 0x51, 0xD6,
+    0xE4, 0x72, 0x61, 0xC3, 0xB9, 0xD0, 0xA0, 0xD1, 0x02, 0xB6, 0xD9, 0xEF, 0xCF, 0xA6, 0xD8, 0x3C,
+    0x00, 0xCB, 0x0B, 0x2F, 0x0C, 0x26, 0x80, 0x4A, 0x60, 0x4D, 0x98, 0x75, 0x35, 0x61, 0xF1, 0x54,
+    0x19, 0xA6, 0xE5, 0xD6, 0x2C, 0xB4, 0xC2, 0x6F, 0xE1, 0x2E, 0x8E, 0x53, 0x01, 0x76, 0xC5, 0x52,
+    0xA3, 0x06, 0xE9, 0xFD, 0xB8, 0xFB, 0x5E, 0xC1, 0xD4, 0x9A, 0x1A, 0x21, 0x3A, 0x1A, 0x4C, 0x7B,
+    0xC6, 0xDC, 0x31, 0x55, 0xBA, 0xAB, 0x17, 0x37, 0xA4, 0x56, 0xF0, 0x93, 0xE3, 0x36, 0xA2, 0xD6,
+    0x5E, 0xB7, 0x3A, 0xBE, 0xFA, 0xE1, 0x5C, 0xD6, 0xAE, 0x45, 0x69, 0x48, 0x7F, 0x69, 0x0E, 0x0C,
+    0x03, 0x3C, 0xB2, 0xD7, 0x03, 0xA2, 0x9C, 0x4E, 0x51, 0x4E, 0xA0, 0x05, 0xA8, 0xC3, 0xD4, 0xAB,
+    0x76, 0x78, 0x6B, 0x47, 0x5D, 0xA5, 0x4B, 0xA2, 0xD8, 0xFD, 0x07, 0xAA, 0x85, 0xFF, 0xAC, 0x61,
+    0x85, 0xC1, 0xCA, 0x51, 0xE9, 0xDB, 0x7A, 0x51, 0x31, 0x58, 0xA7, 0xCB, 0x9C, 0x6F, 0xE5, 0xD3,
+    0xA4, 0xB5, 0x31, 0x4B, 0x95, 0x9B, 0xC8, 0xB6, 0x6B, 0xFB, 0x69, 0x1D, 0x16, 0x28, 0xFA, 0x10,
+    0x4B, 0x4F, 0xA0, 0x2F, 0x04, 0x21, 0xBD, 0xBD, 0x91, 0x5A, 0x1C, 0x59, 0x34, 0x5E, 0x68, 0xBF,
+    0xE5, 0xC2, 0xF5, 0x0F, 0xF0, 0x23, 0x44, 0x84, 0x98, 0xD0, 0x82, 0xE7, 0x83, 0x6A, 0xC8, 0x8E,
+    0x49, 0xAD, 0xA8, 0xD5, 0x2A, 0x82, 0x26, 0x86, 0x28, 0x01, 0x74, 0x16, 0xF6, 0x3C, 0xE3, 0x84,
+    0x0E, 0xF8, 0x32, 0xED, 0x51, 0x74, 0x01, 0xCA, 0xE4, 0x56, 0xAE, 0x8A, 0x60, 0xF5, 0xD2, 0x14,
+    0x62, 0x13, 0x32, 0x3E, 0x06, 0x1E, 0xF9, 0xE6, 0x37, 0xFE, 0x0B, 0x7E, 0xF4, 0x0C, 0x67, 0xFE,
+    0x35, 0x8E, 0x7F, 0xC8, 0xF1, 0x1F, 0xF6, 0xD5, 0xDE, 0xC5, 0x02, 0x90, 0x84, 0xC3, 0x07, 0x61,
+    0x1B, 0xDF, 0xF6, 0x62, 0xEA, 0xC3, 0xE1, 0x3F, 0x1C, 0xDE, 0xE9, 0x30, 0x6B, 0x2D, 0x08, 0xF6,
+    0x21, 0xAA, 0x1C, 0x0F, 0x9D, 0xF0, 0x7B, 0xCD, 0x39, 0x21, 0x4F, 0x13, 0x62, 0x64, 0x19, 0x82,
+    0x58, 0xC1, 0x46, 0x18, 0xF8, 0x2A, 0xA3, 0x9C, 0x90, 0x15, 0x7B, 0x85, 0x05, 0x12, 0x39, 0xA4,
+    0xED, 0x08, 0x26, 0x29, 0xFA, 0xF5, 0x14, 0xBA, 0x09, 0xB1, 0x47, 0xA5, 0x5E, 0xF0, 0x5F, 0x7F,
+    0xF8, 0xFB, 0x21, 0xC3, 0xC0, 0xF7, 0x2D, 0xA6, 0x73, 0xEF, 0xF9, 0xE7, 0x82, 0xCF, 0xC4, 0x7F,
+    0xD4, 0x4A, 0x1F, 0xB3, 0xBE, 0x71, 0x43, 0x28, 0xB3, 0x7A, 0xBD, 0xAA, 0xB7, 0xA9, 0xF8, 0x55,
+    0xFB, 0xF0, 0x53, 0xF0, 0x33, 0x55, 0xC0, 0x95, 0xB0, 0xA0, 0x77, 0x2C, 0xC4, 0xFC, 0x94, 0xEB,
+    0xFC, 0x73, 0xCA, 0x4E, 0xA9, 0x24, 0xE7, 0x61, 0xAB, 0xEC, 0x14, 0x2B, 0xFF, 0x6F, 0xA5, 0x1A,
+    0x00, 0xCF, 0x65, 0xD5, 0xB6, 0xDB, 0x1B, 0xC6, 0x03, 0xDA, 0x3B, 0x26, 0x75, 0x1A, 0xB3, 0x65,
+    0x8C, 0x39, 0x85, 0x70, 0x7C, 0x32, 0x8D, 0xDA, 0xED, 0xC6, 0xC1, 0x29, 0x08, 0xA9, 0x65, 0x07,
+    0xF2, 0xB3, 0xAB, 0xDF, 0x65, 0x5D, 0x00, 0xBC, 0x1C, 0xF6, 0x4E, 0x1E, 0x50, 0xC0, 0x3A, 0x25,
+    0xB6, 0x9C, 0xC6, 0x42, 0x4E, 0xAE, 0x32, 0xDF, 0x0E, 0xC4, 0x58, 0x9C, 0x56, 0x50, 0xCD, 0xDC,
+    0x0F, 0x1E, 0xF0, 0x59, 0x7F, 0xC4, 0xAB, 0xBE, 0xFD, 0xC7, 0x81, 0xE0, 0xDF, 0xF7, 0x5D, 0xE5,
+    0x93, 0x55, 0x60, 0xBB, 0xBE, 0x2C, 0x9A, 0xAC, 0xFA, 0x03, 0x13, 0xA0, 0xFE, 0x62, 0x6B, 0x97,
+    0x04, 0x15, 0x27, 0x76, 0xCC, 0x4E, 0x9D, 0xFC, 0x86, 0x2B, 0xE9, 0x69, 0x1F, 0x14, 0x84, 0x24,
+    0x3F, 0xA9, 0x9F, 0x39, 0x8A, 0x20, 0x65, 0x2C, 0x5C, 0xF5, 0xAA, 0x79, 0xCA, 0xC4, 0x29, 0x04,
+    0x3F, 0x14, 0x6B, 0xEE, 0x37, 0x5E, 0x95, 0xA4, 0x5F, 0xA7, 0x84, 0x85, 0xDA, 0x59, 0x67, 0xB2,
+    0x27, 0xAD, 0x79, 0xDA, 0x50, 0xBE, 0xD6, 0x1F, 0x4F, 0x6A, 0x78, 0x32, 0x36, 0xFF, 0x6E, 0x7A,
+    0xE3, 0xD1, 0xF5, 0x3E, 0x41, 0x9B, 0x90, 0x31, 0xD4, 0x3C, 0xF8, 0x6B, 0x55, 0xFE, 0x91, 0x3C,
+    0xA0, 0xFC, 0x4B, 0x63, 0xD2, 0x23, 0x10, 0xE5, 0x23, 0xE6, 0x8B, 0x7C, 0x1D, 0xD6, 0xFC, 0xEB,
+    0x7F, 0xA4, 0x33, 0x4D, 0xEB, 0xFC, 0x57, 0xFF, 0x99, 0xC6, 0xF9, 0xF1, 0xEA, 0xBB, 0xBF, 0xC7,
+    0x1B, 0xCC, 0x59, 0xF3, 0xA5, 0xBE, 0xB4, 0x22, 0x79, 0x9E, 0x58, 0xE3, 0x26, 0x96, 0xFF, 0xE5,
+    0x74, 0xC3, 0x91, 0x45, 0xB1, 0xC9, 0x02, 0x45, 0x7C, 0xED, 0xBC, 0xFB, 0xC7, 0x37, 0xBC, 0x74,
+    0xFF, 0x33, 0xBF, 0x3D, 0xFD, 0xE3, 0x07, 0xD3, 0x3F, 0xA6, 0x06, 0x12, 0xA7, 0x58, 0x7F, 0xCF,
+    0xAC, 0xF4, 0x1F, 0xA1, 0xF1, 0x1A, 0x5A, 0x26, 0xEC, 0x96, 0x20, 0x26, 0x6E, 0xB8, 0x63, 0x40,
+    0x94, 0xD7, 0x72, 0x95, 0xE0, 0xD6, 0x7C, 0x39, 0x89, 0x5B, 0x7F, 0x7D, 0x7D, 0xD2, 0xDB, 0x8E,
+    0x3E, 0xD7, 0x1D, 0xBB, 0x8A, 0xA0, 0x98, 0xBF, 0x50, 0x0A, 0x96, 0x5F, 0x9C, 0x36, 0x5C, 0xFA,
+    0xBF, 0x91, 0xEF, 0xFF, 0x61, 0xDC, 0x5C, 0xE6, 0x8A, 0xD5, 0xA7, 0x40, 0xB5, 0xD4, 0xFC, 0xC4,
+    0x7C, 0x4B, 0xDF, 0x2A, 0xC2, 0x3B, 0x2D, 0x50, 0x8D, 0xCE, 0xAA, 0x59, 0x70, 0xB1, 0xCE, 0x6A,
+    0xFF, 0x9B, 0x7F, 0x6C, 0x1E, 0xCA, 0x91, 0xA5, 0x62, 0x05, 0x5A, 0xAA, 0x05, 0x6E, 0x2C, 0xE1,
+    0xA3, 0x93, 0xB0, 0x3A, 0xB5, 0x68, 0x30, 0x41, 0xCE, 0x45, 0x46, 0x64, 0x63, 0x73, 0x0F, 0xF6,
+    0x27, 0x65, 0x06, 0x86, 0xE1, 0x75, 0xCB, 0xCC, 0xA7, 0x18, 0x44, 0x8D, 0xC9, 0x67, 0xF9, 0x7A,
+    0xF0, 0xFA, 0x22, 0x85, 0x7B, 0x5C, 0xA0, 0xCD, 0x44, 0x10, 0xA8, 0x27, 0xC8, 0x55, 0x74, 0x72,
+    0x6B, 0x45, 0x7E, 0x82, 0x6B, 0x83, 0x28, 0xD9, 0xF0, 0x86, 0xA0, 0x30, 0xB4, 0x99, 0xA0, 0xFA,
+    0xDE, 0x56, 0xE2, 0x13, 0x47, 0x48, 0xE7, 0x74, 0x31, 0xE2, 0x58, 0x6D, 0xC2, 0x5F, 0xB1, 0xD5,
+    0xB5, 0x32, 0x73, 0xF1, 0x3B, 0x6B, 0x26, 0x54, 0x3C, 0x15, 0x5D, 0x29, 0x6D, 0xC3, 0xB9, 0x73,
+    0x57, 0x94, 0x76, 0x2E, 0x6F, 0x40, 0x9C, 0xE2, 0x61, 0x36, 0x4D, 0x0D, 0x53, 0xA1, 0xF8, 0xC9,
+    0x4D, 0xDF, 0xE2, 0x54, 0x21, 0xD9, 0xAD, 0x5D, 0xF1, 0x1C, 0x13, 0xC2, 0x4C, 0x07, 0xC7, 0xDA,
+    0xF9, 0x0A, 0xE8, 0x58, 0xB2, 0xB4, 0x98, 0xC5, 0x2A, 0x09, 0x86, 0x4C, 0x90, 0xE1, 0xDB, 0xCC,
+    0x52, 0x8A, 0xBA, 0x49, 0xC4, 0x26, 0xA6, 0xE1, 0x10, 0xB3, 0x56, 0x72, 0xA3, 0x9D, 0xBA, 0xB9,
+    0x4F, 0x1D, 0xAF, 0x7C, 0x28, 0x9F, 0x93, 0x22, 0x87, 0x8B, 0x8B, 0x70, 0x98, 0x91, 0x57, 0x48,
+    0x03, 0x4D, 0x64, 0xB8, 0xD8, 0xE7, 0x8F, 0xA1, 0xF7, 0x2A, 0xC0, 0x49, 0x04, 0xF8, 0xFC, 0x1E,
+    0x56, 0xDC, 0x5B, 0x94, 0xAB, 0x04, 0xAC, 0x93, 0x73, 0x71, 0xD3, 0x3C, 0xB1, 0x6E, 0xA9, 0x0B,
+    0x55, 0x95, 0x68, 0xAF, 0x2D, 0x3B, 0xC5, 0xE7, 0x1C, 0xCD, 0xBE, 0x9E, 0xEA, 0x68, 0xEF, 0x97,
+    0x30, 0x7A, 0x39, 0x53, 0x81, 0x1F, 0x67, 0xCC, 0x25, 0xE8, 0xB7, 0x78, 0x63, 0x34, 0x99, 0x30,
+    0x98, 0x9D, 0xC6, 0xF5, 0x13, 0xFB, 0xD2, 0x26, 0xB6, 0x46, 0x67, 0x1F, 0xA5, 0xB0, 0x8C, 0xBB,
+    0xB3, 0xCF, 0x2F, 0x12, 0xE0, 0x7D, 0x18, 0x85, 0x70, 0x71, 0x51, 0xCB, 0x34, 0xA9, 0x80, 0x59,
+    0xFE, 0x35, 0x6A, 0xC0, 0x2F, 0x18, 0xFF, 0x3B, 0xB3, 0x4E, 0xAD, 0x32, 0xEA, 0xE7, 0xB4, 0xD5,
+    0x27, 0xD8, 0xC3, 0x2C, 0xD1, 0x16, 0x37, 0xD9, 0xB7, 0x4F, 0xD8, 0x39, 0xC1, 0x3E, 0x12, 0x19,
+    0x60, 0x52, 0xD7, 0x73, 0xA9, 0x8D, 0xD7, 0xDF, 0x87, 0x86, 0xE6, 0xA7, 0x01, 0x5A, 0x0A, 0xF0,
+    0x49, 0xC6, 0x4A, 0xA3, 0x6E, 0xAE, 0xB7, 0x41, 0x9A, 0xEC, 0x5F, 0x12, 0xF7, 0xD7, 0x9F, 0x53,
+    0x6F, 0xE3, 0xE2, 0xD2, 0x3A, 0x24, 0xAE, 0xC6, 0x75, 0xAB, 0xF1, 0xD0, 0xDC, 0xBA, 0xF1, 0xD0,
+    0x4E, 0x0C, 0x78, 0x60, 0xE3, 0xE1, 0x2C, 0xA2, 0x07, 0xAE, 0x7C, 0x6E, 0x1A, 0xE2, 0xDF, 0x2D,
+    0x6A, 0x30, 0xB4, 0xDD, 0x13, 0x55, 0x50, 0x8D, 0x67, 0x77, 0xCF, 0x4E, 0x59, 0x78, 0x7F, 0x5F,
+    0xEB, 0xC4, 0x4D, 0x0D, 0xF0, 0xE5, 0x54, 0xA3, 0xFB, 0x25, 0x26, 0x9F, 0x68, 0xD4, 0x05, 0x79,
+    0x13, 0x86, 0xF9, 0xC6, 0x97, 0x0F, 0x9E, 0x7C, 0x7C, 0xD0, 0xE4, 0x13, 0xD6, 0x46, 0xF4, 0x9A,
+    0x60, 0xBB, 0xF8, 0x12, 0x1F, 0x6D, 0x91, 0xFA, 0x3F, 0x29, 0x3C, 0x36, 0xB8, 0x74, 0x6A, 0x7F,
+    0x73, 0xDF, 0x47, 0x33, 0x25, 0x5E, 0xBE, 0x4C, 0x7B, 0xE7, 0xF8, 0x63, 0x42, 0x9F, 0xDA, 0x75,
+    0xAD, 0x02, 0x84, 0x8A, 0x5F, 0xA3, 0x2D, 0xA4, 0x79, 0xC8, 0x40, 0x02, 0x13, 0x55, 0x2C, 0x2A,
+    0xAB, 0xE1, 0xD1, 0x54, 0x18, 0xCA, 0xCD, 0x13, 0x19, 0x8C, 0x17, 0x9F, 0x62, 0xF5, 0x49, 0xD1,
+    0x6B, 0x15, 0xEE, 0x7A, 0x03, 0xD2, 0xE9, 0x5C, 0xB3, 0x88, 0x7B, 0x9B, 0xF2, 0xB3, 0x20, 0x69,
+    0x2D, 0x1B, 0x02, 0x15, 0x65, 0x74, 0xD5, 0xD6, 0x82, 0x09, 0x9B, 0x18, 0x63, 0x05, 0x40, 0xA5,
+    0x75, 0x06, 0x1B, 0xD4, 0x61, 0xCB, 0xE0, 0x1C, 0xEE, 0x45, 0xDE, 0x18, 0xFD, 0x22, 0x67, 0x27,
+    0x46, 0x03, 0x0B, 0x57, 0x28, 0x13, 0x66, 0x4A, 0x12, 0x99, 0x44, 0x8F, 0xAD, 0x68, 0x7E, 0xA7,
+    0xC1, 0xF9, 0x00, 0x3E, 0x2A, 0x3C, 0x59, 0x78, 0x6E, 0xE8, 0x93, 0x6B, 0x74, 0xFA, 0xD1, 0x67,
+    0xDA, 0xD1, 0x71, 0xFE, 0xD3, 0x7E, 0xDF, 0x41, 0x04, 0x35, 0xC9, 0x54, 0x5C, 0x52, 0x74, 0x9F,
+    0xBD, 0xC5, 0x04, 0x42, 0x5F, 0xFC, 0x90, 0x0D, 0x32, 0x8D, 0x7D, 0x8C, 0xC1, 0xF3, 0x4A, 0x53,
+    0x10, 0x36, 0x67, 0xE5, 0x0A, 0xD2, 0x22, 0x2B, 0xFB, 0xB2, 0x09, 0x59, 0x3C, 0x08, 0xE7, 0x51,
+    0x7E, 0x2B, 0x18, 0x39, 0x23, 0xCA, 0xDD, 0x57, 0x84, 0x3F, 0x45, 0xAC, 0xA6, 0xB2, 0xB8, 0x29,
+    0x1A, 0x34, 0xF1, 0x6F, 0x72, 0xB3, 0x15, 0xF3, 0x50, 0x94, 0x0A, 0x29, 0xB5, 0x95, 0xF8, 0xE1,
+    0x50, 0x0B, 0x82, 0x3D, 0x23, 0x5B, 0xAE, 0x4E, 0x23, 0x90, 0x75, 0x15, 0xEB, 0x8D, 0x9A, 0x82,
+    0x60, 0x5E, 0x4C, 0x02, 0x9A, 0xA3, 0x87, 0xEC, 0x9F, 0xAC, 0x66, 0x83, 0x69, 0x76, 0x02, 0x57,
+    0x9C, 0x1A, 0xEE, 0xD9, 0x4F, 0x07, 0xBE, 0xBB, 0x78, 0x74, 0xD0, 0xA2, 0xD4, 0x47, 0x47, 0x2D,
+    0x4A, 0x5D, 0xDB, 0x3F, 0x11, 0x2A, 0x9C, 0x61, 0x4B, 0x63, 0x32, 0x22, 0xF1, 0x2B, 0x0C, 0x87,
+    0xA2, 0xD4, 0xA8, 0xD7, 0xA2, 0xD4, 0xA9, 0x10, 0xD2, 0x73, 0xEB, 0x71, 0x11, 0x52, 0x17, 0xE5,
+    0xDA, 0xAC, 0xEB, 0xFE, 0x17, 0xEF, 0x76, 0x47, 0x69, 0x84, 0x1D, 0x0D, 0xE7, 0xB3, 0x64, 0x02,
+    0xF9, 0xFB, 0xF5, 0xF9, 0x4A, 0x91, 0xC1, 0x22, 0x58, 0x70, 0x47, 0x4A, 0x6A, 0x91, 0xA2, 0x8D,
+    0x53, 0x7D, 0x67, 0x54, 0x8A, 0xF9, 0xC9, 0x59, 0x56, 0x36, 0x47, 0x18, 0x58, 0xBC, 0x6C, 0x34,
+    0x5E, 0xAE, 0x2C, 0x2C, 0x6E, 0x14, 0x18, 0xF8, 0x0C, 0x31, 0xEC, 0xA3, 0x44, 0xB3, 0x21, 0x8F,
+    0x8C, 0x70, 0x4D, 0x46, 0xD5, 0xD4, 0xAC, 0xE9, 0x59, 0xD5, 0x7E, 0x9A, 0x82, 0x66, 0xC1, 0x1A,
+    0xA2, 0x0C, 0xC2, 0x38, 0xB8, 0x47, 0x18, 0x98, 0x62, 0xAE, 0x95, 0x1A, 0xE1, 0xDE, 0x4B, 0x70,
+    0x4D, 0x90, 0xFA, 0x11, 0xDF, 0x15, 0xF6, 0xD4, 0xB3, 0x37, 0x45, 0x18, 0x93, 0x85, 0x81, 0xD7,
+    0x03, 0x1C, 0xE6, 0xCA, 0x04, 0x34, 0xB0, 0x56, 0x60, 0xDA, 0x7C, 0xBD, 0xC9, 0x65, 0x0F, 0x09,
+    0x1A, 0x8C, 0x58, 0x28, 0xCF, 0xF8, 0x36, 0x43, 0x93, 0x70, 0x9E, 0xD0, 0xD9, 0xA4, 0xB9, 0xEC,
+    0x86, 0x85, 0x97, 0x62, 0x73, 0xC5, 0xDF, 0xB1, 0x29, 0x6A, 0x7F, 0x98, 0xAF, 0x9B, 0x1A, 0xAC,
+    0x88, 0xE1, 0x69, 0xB6, 0xD7, 0xFD, 0xC4, 0x32, 0xEB, 0x97, 0xB5, 0xE3, 0x09, 0xC1, 0x20, 0x80,
+    0xF9, 0xEC, 0xC2, 0x5B, 0xF0, 0x73, 0xDF, 0x2C, 0xD0, 0x8E, 0xF6, 0x02, 0x0B, 0xF1, 0x8E, 0xDB,
+    0x0D, 0x55, 0x22, 0x56, 0xF4, 0x63, 0xEA, 0xDE, 0xA8, 0x4A, 0xE6, 0x16, 0x54, 0xE9, 0x0A, 0x52,
+    0xC5, 0x92, 0x1E, 0xCC, 0x79, 0x5C, 0x86, 0x2C, 0xC7, 0x1F, 0xFC, 0xD7, 0x61, 0x6E, 0x64, 0xAD,
+    0x5C, 0x2A, 0x14, 0x6D, 0x2B, 0xFF, 0x02, 0x45, 0xB5, 0xFF, 0x0B, 0x5D, 0x71, 0x16, 0xED, 0x37,
+    0xB2, 0x99, 0x32, 0x94, 0x26, 0x40, 0xA2, 0x5E, 0x97, 0xC9, 0x90, 0xD4, 0x15, 0x68, 0xED, 0x6B,
+    0xF8, 0xE3, 0x5F, 0x60, 0xCA, 0x3F, 0x47, 0x68, 0xF6, 0x2D, 0x44, 0x7D, 0xFE, 0x0F, 0xF2, 0xF6,
+    0x68, 0xD9, 0x99, 0xF6, 0xB8, 0x42, 0xB0, 0xCC, 0x22, 0x53, 0x1A, 0xD8, 0x2E, 0x43, 0x1C, 0xB8,
+    0xC3, 0x19, 0x24, 0xF6, 0x1A, 0x57, 0xA3, 0xC7, 0x82, 0xC4, 0x5C, 0x4D, 0xA6, 0xAB, 0xB9, 0xDD,
+    0x1E, 0xB3, 0x63, 0x61, 0xDA, 0x63, 0xAD, 0x4F, 0x85, 0xC5, 0x20, 0x6C, 0x9A, 0x5F, 0xE8, 0xD9,
+    0xE5, 0x69, 0x30, 0xDC, 0x59, 0x86, 0x45, 0xC2, 0x79, 0x98, 0x24, 0xEB, 0x37, 0xD9, 0x5C, 0x24,
+    0x84, 0x50, 0xCE, 0x52, 0x32, 0xE8, 0x05, 0xC4, 0x06, 0xFB, 0x99, 0x26, 0xD0, 0xE1, 0x10, 0x82,
+    0x10, 0xAD, 0x64, 0x15, 0x1B, 0xD9, 0x4A, 0xEC, 0x41, 0xC6, 0xA6, 0xF3, 0xE2, 0x02, 0x59, 0xFB,
+    0x87, 0x4C, 0x2B, 0xEE, 0xD0, 0xE1, 0x28, 0xB4, 0x7F, 0x2E, 0x67, 0x0E, 0x99, 0xA2, 0x08, 0x2E,
+    0x64, 0x4B, 0x2A, 0x34, 0x15, 0x03, 0x11, 0xA0, 0x67, 0xD0, 0x85, 0x5A, 0x78, 0xA7, 0x45, 0x78,
+    0x6C, 0x1F, 0x5E, 0x73, 0x42, 0x2B, 0xD6, 0x5E, 0xC9, 0x1B, 0x0B, 0x5B, 0xC9, 0xF4, 0xAC, 0xBC,
+    0xEF, 0x54, 0x81, 0xD7, 0x15, 0x6F, 0x22, 0xDA, 0x06, 0x9D, 0x6C, 0x33, 0x64, 0xA4, 0xB4, 0x39,
+    0x39, 0xD7, 0xA6, 0x3D, 0xC6, 0x64, 0x34, 0x72, 0xAE, 0xDD, 0xB0, 0x01, 0xCA, 0x75, 0xD8, 0xD0,
+    0xC1, 0x7E, 0xEA, 0x0A, 0x3D, 0x81, 0x49, 0xB9, 0xE9, 0xAA, 0xD5, 0x1E, 0x24, 0x90, 0xCB, 0x35,
+    0xF0, 0xA2, 0x1A, 0xBC, 0x9F, 0xDB, 0x78, 0x77, 0xCF, 0x6B, 0xC6, 0x6F, 0xD9, 0xC6, 0xCB, 0x26,
+    0xBC, 0x88, 0x7D, 0x5B, 0xB1, 0x36, 0xF0, 0x4E, 0x6D, 0xBC, 0xD1, 0xDC, 0xC6, 0x7B, 0x31, 0x85,
+    0xDD, 0xD4, 0xB6, 0x39, 0x24, 0x11, 0x8C, 0x4B, 0x97, 0xD8, 0xDB, 0x55, 0xD8, 0x4E, 0xBD, 0x5B,
+    0x3C, 0xFC, 0x86, 0x65, 0xD1, 0x25, 0xB3, 0x0E, 0x38, 0xC9, 0x26, 0x9F, 0x2A, 0xD2, 0xC5, 0x1E,
+    0xD0, 0x5E, 0x5B, 0x2D, 0xC8, 0x92, 0x95, 0x5D, 0x7F, 0x62, 0x50, 0x2B, 0x18, 0x3B, 0xB4, 0x3D,
+    0xBE, 0x28, 0x0C, 0x6A, 0x91, 0x40, 0x44, 0xD2, 0x5D, 0xC1, 0x7E, 0xB2, 0x84, 0x64, 0x2E, 0x9B,
+    0xC3, 0xF6, 0xC8, 0x5D, 0xA5, 0x0A, 0xD0, 0x03, 0x66, 0x99, 0x93, 0x2E, 0x20, 0xB3, 0x5E, 0x94,
+    0x32, 0x8E, 0x34, 0x4A, 0x1B, 0x47, 0x1C, 0x47, 0x1D, 0x47, 0x1E, 0x47, 0x1F, 0x47, 0x20, 0x47,
+    0x21, 0x47, 0x22, 0x47, 0x23, 0x47, 0x24, 0x47, 0x25, 0xD7, 0xED, 0x8C, 0xDF, 0x4F, 0x9D, 0x61,
+    0x6C, 0x5D, 0x9A, 0xD8, 0x98, 0x9C, 0x87, 0x11, 0x5D, 0x67, 0x96, 0xA7, 0xF9, 0xBC, 0x8B, 0x49,
+    0x14, 0x73, 0xE7, 0xB9, 0xEB, 0x18, 0xB2, 0xD6, 0xC5, 0x90, 0x95, 0x12, 0xDB, 0x7D, 0x43, 0xDB,
+    0x47, 0x4E, 0xB4, 0xEC, 0x89, 0x6A, 0xE6, 0xC6, 0xE6, 0xE9, 0xA2, 0xB9, 0x4E, 0xD7, 0xDB, 0x3C,
+    0x15, 0xFE, 0xB3, 0x19, 0x93, 0x15, 0x00, 0xBA, 0xE4, 0x60, 0x73, 0xCA, 0x0F, 0xF8, 0x49, 0xB4,
+    0xB0, 0xC7, 0xEE, 0x47, 0xDC, 0x8D, 0x36, 0x20, 0x9F, 0x21, 0xCB, 0x16, 0x59, 0xCB, 0x2A, 0x66,
+    0x12, 0xB3, 0x0C, 0x06, 0x36, 0x67, 0x92, 0x1F, 0x11, 0xD8, 0x64, 0xAD, 0x8D, 0x37, 0xA2, 0xA1,
+    0x32, 0x45, 0xD8, 0x10, 0x4D, 0x56, 0x03, 0x72, 0x0E, 0x53, 0xE8, 0xD7, 0x45, 0x61, 0x9C, 0xEF,
+    0x05, 0x39, 0x33, 0xBF, 0xFF, 0xF8, 0x54, 0xCE, 0xA5, 0x4D, 0xB9, 0xEA, 0xA2, 0xE9, 0x19, 0x4A,
+    0xAC, 0xC1, 0x5A, 0xB6, 0xE7, 0x33, 0x6D, 0xE6, 0x8D, 0xA8, 0x05, 0x05, 0xBF, 0x80, 0xB1, 0x56,
+    0xAE, 0x5E, 0xC3, 0xB0, 0x77, 0x8E, 0xD5, 0xBC, 0x48, 0x7B, 0xE3, 0x00, 0x94, 0x46, 0xDC, 0xB3,
+    0x21, 0xEB, 0x90, 0x07, 0x0A, 0x05, 0x3D, 0xA0, 0x22, 0x0B, 0x49, 0x31, 0xC4, 0xB9, 0x10, 0xED,
+    0x82, 0x2F, 0xB3, 0xF4, 0x05, 0xF5, 0xBC, 0x08, 0x4C, 0xCA, 0xBB, 0x68, 0x17, 0xA6, 0x6B, 0x34,
+    0x2E, 0xA0, 0xBD, 0x95, 0x87, 0x98, 0xB4, 0x2A, 0xBD, 0x2B, 0x7B, 0xFD, 0x45, 0xAD, 0xC3, 0xF6,
+    0xC5, 0x95, 0x15, 0x03, 0x19, 0xC8, 0xBB, 0xDB, 0x48, 0xFC, 0xD2, 0x26, 0xF9, 0xA8, 0x4F, 0xEA,
+    0xEC, 0x82, 0xBC, 0x18, 0x27, 0x60, 0x08, 0xB6, 0x92, 0x97, 0x5B, 0xCC, 0x00, 0x29, 0xFE, 0x4A,
+    0x30, 0x9B, 0xE0, 0x14, 0x24, 0xB7, 0x0A, 0x24, 0xB7, 0x32, 0xF2, 0xFD, 0xF8, 0x5D, 0x65, 0x32,
+    0x3D, 0x39, 0xEA, 0x44, 0xD6, 0x6C, 0x45, 0xF7, 0x57, 0xF4, 0x98, 0xC4, 0xD3, 0x1D, 0xEF, 0x13,
+    0x30, 0x16, 0xD7, 0xF2, 0xF7, 0x7D, 0x76, 0xC1, 0x0E, 0xC5, 0x85, 0x6E, 0x2C, 0x9E, 0x6F, 0xC6,
+    0xE2, 0x85, 0x66, 0x28, 0x5E, 0xB8, 0xDC, 0x17, 0x6F, 0x5E, 0xE9, 0xB2, 0x77, 0xE8, 0x01, 0xC2,
+    0x53, 0xEB, 0x09, 0x57, 0x8E, 0x6E, 0x44, 0xF0, 0xAB, 0x88, 0xCC, 0x1D, 0x31, 0xD1, 0xF8, 0xE7,
+    0x37, 0x37, 0x84, 0xAF, 0x49, 0xD8, 0x7E, 0x3E, 0xB8, 0x08, 0xBC, 0xF0, 0xEF, 0x89, 0xD1, 0xFA,
+    0xE9, 0x8F, 0x37, 0x2B, 0xDC, 0x0E, 0xCF, 0x4D, 0x25, 0x9A, 0xD9, 0x2D, 0xC3, 0x73, 0x7F, 0x41,
+    0xBF, 0x21, 0x62, 0x22, 0xA0, 0xD5, 0xE0, 0x71, 0xE2, 0x80, 0x4C, 0x9C, 0x9B, 0xFB, 0x0B, 0x4D,
+    0x23, 0x4D, 0xDE, 0x7E, 0xBC, 0xE8, 0x4B, 0x67, 0x33, 0x75, 0x7C, 0xEB, 0xBE, 0x74, 0x73, 0x8B,
+    0xBE, 0x74, 0x7F, 0x7C, 0x09, 0x66, 0x91, 0x25, 0xF8, 0x2C, 0xC3, 0x0F, 0xF7, 0x17, 0x34, 0x4E,
+    0xDE, 0xD5, 0xE6, 0x0B, 0xED, 0x15, 0x83, 0x59, 0x69, 0x7B, 0x85, 0x98, 0x8C, 0x91, 0x40, 0x0D,
+    0xED, 0x15, 0x25, 0x10, 0x76, 0x09, 0x25, 0xB8, 0x42, 0x60, 0x98, 0x87, 0xDE, 0xA0, 0x34, 0x7D,
+    0xBD, 0xAF, 0x34, 0x7D, 0xD3, 0x65, 0x11, 0x4F, 0x5D, 0x16, 0xD0, 0xF9, 0x27, 0xC0, 0xD1, 0x6B,
+    0x5B, 0x83, 0xA5, 0x57, 0x38, 0x15, 0x45, 0x1B, 0xA5, 0x17, 0x68, 0x3B, 0xC9, 0xCD, 0x7C, 0x2A,
+    0xE1, 0xFE, 0x96, 0xF1, 0x5D, 0x2A, 0xA4, 0x9C, 0x2D, 0xCF, 0xEC, 0x3D, 0xE6, 0xB9, 0x19, 0xA8,
+    0x85, 0xD6, 0x53, 0x14, 0x82, 0x16, 0x56, 0xF5, 0xFA, 0x94, 0x59, 0x67, 0xDA, 0x67, 0xAD, 0x21,
+    0xB7, 0x6A, 0x6E, 0x30, 0x35, 0x9F, 0x1B, 0x7B, 0xED, 0xF8, 0x7E, 0x6F, 0x40, 0x14, 0x9C, 0x1D,
+    0x7B, 0x28, 0xFA, 0x28, 0x99, 0x2C, 0xCF, 0x63, 0x97, 0x04, 0x8C, 0x98, 0x04, 0x14, 0x8A, 0xEE,
+    0x4B, 0x02, 0x22, 0xC5, 0x18, 0xDC, 0xEA, 0xD4, 0x37, 0xE7, 0x46, 0xA1, 0x45, 0xA8, 0xE6, 0x81,
+    0x63, 0xE8, 0x35, 0x16, 0x67, 0xDF, 0x83, 0x22, 0x67, 0x6B, 0xB2, 0xFC, 0x74, 0x8D, 0x9E, 0xF7,
+    0x15, 0x0D, 0x34, 0xAD, 0x94, 0xEA, 0x42, 0xFA, 0x3A, 0xAD, 0xE3, 0xBF, 0x87, 0x8A, 0x8B, 0xF9,
+    0x1C, 0xB8, 0x28, 0x55, 0xE5, 0x1C, 0xE4, 0x59, 0xB2, 0x41, 0xD2, 0xD7, 0xA8, 0x02, 0x0F, 0x89,
+    0x40, 0xF9, 0x2D, 0x42, 0x52, 0xF0, 0xC6, 0x04, 0x18, 0xCA, 0x44, 0xD6, 0x3D, 0x4E, 0xF8, 0x11,
+    0xAD, 0x27, 0x03, 0x88, 0x3D, 0x10, 0x32, 0x0D, 0xAE, 0x22, 0x49, 0x3B, 0xEC, 0x8B, 0xC6, 0x01,
+    0xD6, 0xCC, 0x1D, 0x74, 0x91, 0xB3, 0x3A, 0xC2, 0x1C, 0x43, 0xC9, 0xFF, 0xBE, 0x68, 0xC1, 0x4D,
+    0x0D, 0xFD, 0x74, 0x01, 0xBF, 0x68, 0x43, 0x7F, 0xF1, 0x25, 0x1A, 0xFA, 0x2F, 0x1A, 0xC2, 0x1F,
+    0xC8, 0x9C, 0x30, 0x29, 0x5A, 0x4E, 0x6E, 0x6B, 0xC7, 0x83, 0x7E, 0xD9, 0x87, 0x0D, 0x11, 0x0D,
+    0x7B, 0xCD, 0xD3, 0xC7, 0x4D, 0x81, 0xB6, 0x7D, 0x64, 0x70, 0x6F, 0x8C, 0xEE, 0xC5, 0xC4, 0xF0,
+    0x6B, 0x2D, 0x03, 0x2B, 0x5D, 0x1E, 0x39, 0xA6, 0x86, 0x78, 0x1F, 0x79, 0xBA, 0xE3, 0xE3, 0x8B,
+    0xDE, 0xE8, 0x8B, 0xEF, 0x27, 0x5B, 0xD7, 0x88, 0x8F, 0x49, 0x9B, 0x10, 0xDF, 0xDA, 0xA6, 0xE3,
+    0xF4, 0x27, 0xE0, 0x74, 0x19, 0x51, 0xC9, 0xD3, 0x65, 0x18, 0xC1, 0xAC, 0xF1, 0xE2, 0x5C, 0x91,
+    0x64, 0x79, 0x90, 0x49, 0x49, 0x04, 0xA4, 0x87, 0x11, 0x38, 0x1C, 0xE4, 0xCF, 0x38, 0x08, 0x4D,
+    0xBF, 0x9B, 0xC3, 0x08, 0xC2, 0x09, 0x01, 0xE1, 0x60, 0x3B, 0x97, 0xC6, 0xD2, 0xEA, 0xDE, 0x94,
+    0xE3, 0x2D, 0x30, 0xCE, 0xB0, 0xA8, 0xCA, 0xE8, 0x37, 0xA7, 0x4D, 0x8A, 0xBF, 0x6F, 0xAD, 0x60,
+    0x4F, 0x2B, 0xC8, 0xFF, 0x98, 0x3D, 0x99, 0x68, 0x90, 0xCA, 0x1D, 0xEA, 0xE1, 0x80, 0x4F, 0xEA,
+    0x69, 0x4F, 0x07, 0x0F, 0xBC, 0x62, 0x0B, 0x72, 0x20, 0xC3, 0xB0, 0x63, 0x4F, 0x00, 0x05, 0x08,
+    0x38, 0x6E, 0x11, 0x4E, 0x43, 0xA1, 0xED, 0x7D, 0x8E, 0x20, 0xB9, 0x46, 0x72, 0x65, 0x61, 0xB3,
+    0x38, 0xEF, 0x2A, 0x1C, 0x21, 0x18, 0x21, 0x14, 0x89, 0xDC, 0x11, 0x07, 0x1A, 0xE4, 0x70, 0x47,
+    0x1C, 0x80, 0x26, 0x1A, 0x28, 0x83, 0xD0, 0x67, 0xD7, 0x8B, 0xE5, 0x39, 0x07, 0xBE, 0x7D, 0xEF,
+    0x80, 0x90, 0x54, 0xB8, 0xF7, 0x22, 0x22, 0xA2, 0x10, 0x38, 0xEC, 0x4B, 0x62, 0xEB, 0xDB, 0x75,
+    0xA6, 0xD9, 0xC9, 0xF7, 0xF7, 0xBB, 0xA9, 0x12, 0x39, 0x9B, 0x0A, 0x5F, 0xF3, 0xA4, 0x2E, 0xF2,
+    0xA2, 0x2A, 0xFE, 0x11, 0x85, 0xAF, 0xA8, 0xBE, 0x80, 0xC4, 0x16, 0x93, 0xBA, 0x7D, 0x19, 0xDD,
+    0xB3, 0x66, 0xED, 0xBE, 0xE9, 0x8D, 0xFB, 0xAD, 0x26, 0x7F, 0x21, 0xF1, 0x28, 0x5B, 0x7E, 0xE0,
+    0xAC, 0xAE, 0xB1, 0xDB, 0x5A, 0x63, 0xBC, 0x59, 0xE3, 0x07, 0xE8, 0x41, 0x7A, 0xBB, 0x16, 0x55,
+    0x7A, 0xE1, 0x67, 0xB2, 0xBC, 0x77, 0xDE, 0x90, 0xE1, 0x86, 0x75, 0x6B, 0xE4, 0x61, 0x53, 0xBE,
+    0x85, 0x2F, 0x15, 0x81, 0x7D, 0x23, 0xAC, 0xF1, 0x6B, 0x58, 0xE3, 0x37, 0xF1, 0x82, 0x3F, 0xD8,
+    0x3A, 0xCB, 0x41, 0xF4, 0x61, 0xEF, 0x3A, 0x08, 0x3B, 0x1C, 0xE4, 0x95, 0xFD, 0xEF, 0xA8, 0x29,
+    0x7E, 0x28, 0x8B, 0x78, 0x2B, 0x6B, 0x8A, 0x4B, 0x82, 0x3C, 0xD9, 0x21, 0x21, 0x0B, 0x10, 0xB5,
+    0x66, 0x9E, 0x92, 0x45, 0xFC, 0x40, 0x16, 0xF1, 0x0F, 0xCB, 0x18, 0xEB, 0xC6, 0x5C, 0x96, 0x93,
+    0x83, 0xBA, 0x08, 0x59, 0x31, 0x65, 0xC5, 0x6E, 0x15, 0xB5, 0x77, 0x28, 0x66, 0xDD, 0x23, 0x10,
+    0x4C, 0x88, 0x73, 0x99, 0xAA, 0x6F, 0xF6, 0xAD, 0x74, 0x11, 0xB2, 0x9A, 0x4F, 0xAD, 0xD8, 0xE7,
+    0x36, 0x1D, 0x74, 0x00, 0x80, 0x81, 0xB7, 0xB6, 0x1A, 0x5D, 0x31, 0x9F, 0x56, 0xBC, 0xB2, 0xE0,
+    0x15, 0x7D, 0xE3, 0x0A, 0x9F, 0x82, 0x65, 0x64, 0x7B, 0x1F, 0xE0, 0xBE, 0xE9, 0xD0, 0x8C, 0xF9,
+    0x6B, 0x87, 0xEA, 0x9E, 0x29, 0x79, 0xF6, 0xA3, 0x9A, 0x64, 0x84, 0xCA, 0x11, 0xBF, 0xA6, 0xBB,
+    0xFF, 0x59, 0x11, 0x9D, 0x2E, 0xBE, 0x80, 0xA0, 0x79, 0xF2, 0x26, 0x22, 0x47, 0xC9, 0xFB, 0xC3,
+    0x9F, 0x13, 0x90, 0x28, 0x24, 0xD1, 0xF3, 0x78, 0x00, 0x10, 0xA2, 0x9B, 0x0E, 0xC5, 0x53, 0x7B,
+    0xAD, 0x75, 0x02, 0xBE, 0xFD, 0x9B, 0x57, 0x8D, 0x36, 0x41, 0x19, 0x33, 0xA5, 0xE4, 0xDB, 0xED,
+    0x3A, 0xD6, 0x88, 0x74, 0xD7, 0x88, 0x5F, 0x73, 0x2C, 0x14, 0xB5, 0xFF, 0x0C, 0x52, 0x99, 0xAF,
+    0x81, 0x76, 0x45, 0xF6, 0xB3, 0x02, 0x32, 0x68, 0xD1, 0xCE, 0x03, 0x00, 0x75, 0xF1, 0x84, 0xA3,
+    0x8F, 0x9E, 0x55, 0x50, 0xFB, 0x2E, 0xB6, 0x89, 0xFE, 0x0F, 0x99, 0xD2, 0xF5, 0x7D, 0xA7, 0xBD,
+    0xFC, 0x56, 0xD7, 0x78, 0xAB, 0xC6, 0xC0, 0x9B, 0xCA, 0xAD, 0xBE, 0x1A, 0x3A, 0x50, 0x98, 0xC7,
+    0x29, 0xFC, 0xB1, 0x1E, 0x96, 0x91, 0x0F, 0x46, 0x8D, 0x10, 0xD2, 0x62, 0xED, 0xDE, 0x70, 0xB0,
+    0x69, 0xFE, 0x9C, 0xB3, 0x5D, 0x7D, 0xAB, 0xFA, 0xA4, 0xE0, 0x77, 0xB5, 0x5C, 0x4A, 0x58, 0x29,
+    0x80, 0x09, 0x6B, 0xC5, 0x2C, 0x81, 0x75, 0x1D, 0x74, 0x53, 0x3A, 0xE3, 0xD8, 0xD6, 0xC2, 0x7F,
+    0x67, 0x0E, 0xA4, 0x3B, 0xE5, 0xD8, 0xF6, 0xB5, 0xB5, 0x1A, 0x89, 0xE2, 0xB1, 0xA9, 0xC0, 0xA3,
+    0x71, 0x5B, 0xE8, 0x6A, 0x7B, 0x4E, 0x98, 0x7B, 0xB0, 0x77, 0xFF, 0x37, 0x0B, 0x02, 0xD6, 0x13,
+    0x8F, 0x6B, 0x81, 0x4D, 0x30, 0x3C, 0x41, 0x50, 0x63, 0x88, 0x17, 0x1C, 0xCC, 0x99, 0x47, 0x05,
+    0x3E, 0x2C, 0xFE, 0x63, 0x9E, 0xA5, 0x5A, 0x9C, 0xD6, 0x9A, 0x4F, 0x67, 0x65, 0xFE, 0xDD, 0x8E,
+    0x7A, 0xB6, 0xBD, 0x71, 0xA7, 0x33, 0xB8, 0x43, 0x9B, 0x56, 0xE9, 0x17, 0x09, 0x05, 0x3A, 0xAE,
+    0x9A, 0x82, 0x4C, 0x0D, 0x8E, 0x96, 0x9C, 0x54, 0x6F, 0xAD, 0xA7, 0x4E, 0xF3, 0x3C, 0xD9, 0x61,
+    0x3A, 0x21, 0x77, 0x13, 0xB1, 0x15, 0xA2, 0xAC, 0x2E, 0x22, 0xF1, 0x0C, 0xC5, 0xA0, 0xC8, 0xCB,
+    0x76, 0xCB, 0xF3, 0xB5, 0x2B, 0x57, 0xD5, 0xAA, 0xB8, 0x52, 0x83, 0xBA, 0x3C, 0x9A, 0x64, 0x6E,
+    0x29, 0xD2, 0x66, 0x22, 0x8E, 0xDA, 0x4C, 0xD4, 0xE3, 0x1D, 0x41, 0xB7, 0xE9, 0xD5, 0x54, 0x07,
+    0x15, 0xFD, 0x23, 0x46, 0x55, 0x30, 0xCE, 0x10, 0xC2, 0x3B, 0xD1, 0x79, 0xFE, 0xA4, 0x85, 0x3D,
+    0x66, 0xF2, 0xA4, 0xC6, 0x96, 0xC9, 0x16, 0xA2, 0x21, 0x31, 0xBF, 0x6F, 0x8E, 0xC3, 0x2C, 0xD0,
+    0x89, 0xA2, 0xB5, 0x8D, 0x8B, 0xBB, 0xED, 0x73, 0xD5, 0x5A, 0xC4, 0x44, 0x9F, 0x2D, 0x1C, 0x76,
+    0xEA, 0xB9, 0xE8, 0xD2, 0x9D, 0x2B, 0x80, 0x7A, 0x19, 0x36, 0x37, 0x72, 0xEA, 0x68, 0x86, 0x9A,
+    0x8E, 0x14, 0xC0, 0x0F, 0xC4, 0xEF, 0xEE, 0x11, 0x41, 0xEB, 0x18, 0xBE, 0x3F, 0xEA, 0x1A, 0x8C,
+    0x36, 0xE8, 0xAD, 0x98, 0x81, 0xF4, 0x8F, 0xE7, 0x10, 0x55, 0xB5, 0x0C, 0x51, 0xAD, 0xF7, 0x87,
+    0xA8, 0xD2, 0x2F, 0x1A, 0xA2, 0xE2, 0x69, 0x51, 0xCB, 0x93, 0xE6, 0x34, 0xEA, 0xA2, 0x4E, 0x90,
+    0x86, 0x5E, 0x1C, 0x16, 0x74, 0x96, 0x72, 0xBD, 0x4C, 0x04, 0x83, 0x32, 0xBF, 0x24, 0x50, 0xD6,
+    0x1C, 0x89, 0x96, 0x1E, 0xAB, 0x9E, 0x99, 0x18, 0xE8, 0xCB, 0x07, 0xAA, 0x86, 0xD9, 0x6E, 0x2E,
+    0xD3, 0xC2, 0x2E, 0x30, 0xB3, 0xE9, 0x22, 0x12, 0xC1, 0x58, 0x7F, 0xAA, 0x41, 0x8D, 0x54, 0xDB,
+    0x0E, 0x57, 0x73, 0x7D, 0xDF, 0xDD, 0x0B, 0xE4, 0xD9, 0x72, 0x11, 0xC8, 0x23, 0x3A, 0xB4, 0x9B,
+    0x36, 0x65, 0x85, 0xB1, 0x6A, 0x7C, 0xD4, 0xE0, 0xA8, 0xB3, 0xBE, 0x8C, 0xB5, 0xDF, 0xC9, 0x40,
+    0xDE, 0x8C, 0x6C, 0x67, 0x8E, 0xD9, 0x08, 0xDD, 0xFD, 0x2F, 0xDD, 0x39, 0x78, 0xBB, 0x75, 0x8C,
+    0xD7, 0xFD, 0xE7, 0x9B, 0x6D, 0x74, 0x5B, 0x6D, 0xE1, 0xA8, 0x7D, 0xA8, 0x6D, 0x53, 0x3C, 0x75,
+    0x4B, 0x78, 0x5B, 0x1F, 0x08, 0x6F, 0xBF, 0x6F, 0xB5, 0x5F, 0xCC, 0x5A, 0x86, 0x70, 0xA6, 0xDE,
+    0x2E, 0x6F, 0x02, 0xBA, 0xF2, 0x7D, 0xF8, 0x45, 0x8D, 0x89, 0xCC, 0xC7, 0x42, 0xD6, 0x7A, 0x2C,
+    0x64, 0x75, 0xE0, 0xB1, 0x90, 0x66, 0x1C, 0x36, 0xC7, 0x42, 0xA6, 0xFB, 0x8F, 0x85, 0x1C, 0x71,
+    0x2C, 0xA4, 0xD7, 0xBD, 0x86, 0x63, 0x21, 0xFD, 0xF6, 0xB5, 0xC8, 0x1D, 0x0B, 0xF9, 0x1C, 0xBC,
+    0xFB, 0x22, 0x43, 0x11, 0x45, 0x93, 0x8D, 0xF2, 0xD2, 0xA8, 0xCE, 0xD0, 0x64, 0x10, 0x55, 0x59,
+    0x17, 0xDA, 0x36, 0xC6, 0xB1, 0x90, 0xD8, 0x90, 0xAC, 0x8E, 0x10, 0x53, 0x48, 0x4A, 0x77, 0x6C,
+    0xE8, 0x14, 0x3E, 0xB0, 0x8B, 0x62, 0xF4, 0x29, 0xA8, 0xE7, 0xAA, 0x39, 0xE7, 0xE3, 0x56, 0x59,
+    0x94, 0x83, 0xEC, 0x68, 0xB3, 0x42, 0x7E, 0x14, 0x47, 0x8A, 0xAC, 0x71, 0x32, 0x4F, 0xCD, 0xF3,
+    0x44, 0x2A, 0xEF, 0x46, 0x13, 0x5D, 0xAA, 0xFC, 0x6B, 0x6D, 0x22, 0xD4, 0xB9, 0xD6, 0x66, 0xB2,
+    0xFB, 0x57, 0xDA, 0x01, 0xA7, 0x8A, 0xFC, 0x0A, 0x9D, 0x30, 0x1F, 0xDD, 0x68, 0x0B, 0x13, 0xBD,
+    0x6D, 0x71, 0xAA, 0xC8, 0xDB, 0xE8, 0x3B, 0x4F, 0xDE, 0xB0, 0xAF, 0x8B, 0x9B, 0xF7, 0x06, 0xAA,
+    0xDD, 0xB2, 0x33, 0xD6, 0xB3, 0x4B, 0x2C, 0xB4, 0x4C, 0x03, 0xE5, 0x9B, 0x00, 0xF4, 0xEE, 0x57,
+    0x0A, 0x4E, 0x84, 0x4A, 0x88, 0x2E, 0x95, 0xEC, 0x0F, 0x74, 0xD6, 0xB5, 0xD9, 0x87, 0x48, 0x3C,
+    0x77, 0xBA, 0x20, 0xF3, 0x77, 0x1C, 0x63, 0x07, 0x33, 0xC8, 0x55, 0x3B, 0x64, 0x2B, 0x54, 0x7B,
+    0xAE, 0x07, 0x1E, 0x98, 0x8D, 0x03, 0x9D, 0xF5, 0x44, 0x67, 0x24, 0x49, 0x38, 0x37, 0x8C, 0xD9,
+    0xC5, 0xF3, 0x7A, 0x4E, 0x29, 0x0D, 0x8D, 0x6B, 0x02, 0xA3, 0x5C, 0x87, 0x3C, 0x61, 0x93, 0x3D,
+    0x26, 0x1B, 0xD1, 0xD6, 0xC3, 0x9D, 0x65, 0x1E, 0xA7, 0x4C, 0x92, 0x0A, 0xE7, 0xBF, 0x01, 0x86,
+    0xE9, 0xB4, 0x23, 0xC2, 0x1D, 0xA5, 0x95, 0x34, 0xAF, 0x89, 0x97, 0x35, 0xA2, 0xC3, 0x24, 0x1C,
+    0x77, 0x04, 0x0B, 0x85, 0x7D, 0x82, 0xA2, 0x3F, 0xE7, 0xE5, 0xC0, 0xBE, 0x20, 0x33, 0x0E, 0x07,
+    0x03, 0x96, 0xBD, 0xF8, 0x27, 0x9E, 0xE0, 0x20, 0x90, 0x11, 0x9E, 0x4E, 0xA2, 0xDD, 0x97, 0xC6,
+    0xAF, 0x7E, 0x22, 0xCB, 0xFA, 0x0C, 0x64, 0xFD, 0x10, 0xB1, 0x99, 0xB2, 0xDD, 0x97, 0xD3, 0x75,
+    0x4B, 0x0F, 0xF5, 0x1C, 0x8D, 0x03, 0x0E, 0xB1, 0x8E, 0xCB, 0xC5, 0x21, 0xD6, 0x5C, 0x31, 0x17,
+    0xCC, 0xF5, 0xDE, 0xE2, 0x10, 0xEB, 0x66, 0x3A, 0xC4, 0x3A, 0x74, 0x87, 0x58, 0x87, 0xCF, 0x36,
+    0x26, 0xBE, 0x20, 0x4A, 0xE1, 0x4D, 0x61, 0xE0, 0x47, 0x36, 0x50, 0xF8, 0x8E, 0x2C, 0x91, 0x9D,
+    0x1A, 0xA5, 0x02, 0x41, 0x5E, 0xB5, 0x71, 0x48, 0x4F, 0xC0, 0x4F, 0xA7, 0x12, 0x53, 0x26, 0xEB,
+    0x72, 0x3D, 0x67, 0x50, 0x3D, 0xB1, 0xAC, 0x72, 0x99, 0x90, 0x33, 0x76, 0xF7, 0x65, 0xDC, 0xAE,
+    0xE7, 0xA4, 0xA1, 0x69, 0x98, 0xB1, 0xC2, 0x5E, 0x03, 0xA3, 0xD1, 0x78, 0x6E, 0xCA, 0xCE, 0x6B,
+    0xA0, 0x46, 0xAF, 0x2B, 0x77, 0x90, 0xA1, 0xC6, 0x22, 0xA8, 0xAA, 0x42, 0x9C, 0xBF, 0x8C, 0x1E,
+    0x22, 0xB6, 0x52, 0x34, 0x5A, 0x8E, 0x3A, 0x1D, 0xAB, 0x36, 0xAF, 0xF8, 0x55, 0xF4, 0x46, 0x0E,
+    0xA8, 0x06, 0xE2, 0xA1, 0x79, 0x62, 0xC4, 0xED, 0x23, 0x63, 0xD4, 0x86, 0xC3, 0x6A, 0xC4, 0x29,
+    0x15, 0xAC, 0xF0, 0xEC, 0x76, 0x7A, 0xED, 0x40, 0x2C, 0xD8, 0x5B, 0x5C, 0xE4, 0xD1, 0xDE, 0x5F,
+    0xBB, 0x63, 0x77, 0x85, 0x0E, 0x18, 0x3F, 0xB4, 0xDD, 0x4A, 0x0B, 0x62, 0x2B, 0xA1, 0x06, 0x9A,
+    0xC8, 0x86, 0x04, 0x4D, 0xF7, 0xE9, 0xA6, 0xA7, 0x91, 0xC7, 0xBC, 0xF3, 0x94, 0x77, 0x6D, 0xBA,
+    0x25, 0xFF, 0x1F, 0x4A, 0xF7, 0x7D, 0xBA, 0x46, 0xFE, 0x39, 0x65, 0x1A, 0xEE, 0x00, 0xEA, 0x76,
+    0x79, 0x0A, 0xF5, 0x2D, 0x8B, 0x61, 0x40, 0x80, 0x78, 0x3E, 0x80, 0x9A, 0x83, 0x39, 0x96, 0x1E,
+    0x83, 0xAD, 0x28, 0x0C, 0xFA, 0x9C, 0x5C, 0x28, 0xDE, 0xA7, 0xFD, 0x3C, 0x7A, 0xA0, 0x2F, 0x64,
+    0xE0, 0x0B, 0x01, 0x4F, 0x4D, 0xE6, 0x43, 0x7C, 0xA1, 0x29, 0xE2, 0x87, 0x7C, 0xDB, 0xC5, 0x74,
+    0xDB, 0x17, 0x0A, 0x6E, 0xE7, 0x13, 0x3E, 0x88, 0x6C, 0x40, 0xA6, 0x95, 0x30, 0x58, 0xEA, 0x39,
+    0x91, 0xAF, 0x23, 0x26, 0x9B, 0xA3, 0x07, 0xAE, 0x33, 0x53, 0x87, 0xC3, 0xDA, 0xC6, 0xCF, 0xB3,
+    0xC9, 0xA0, 0x00, 0x2F, 0x16, 0x75, 0xDC, 0x69, 0x1E, 0x12, 0x85, 0x27, 0x2B, 0x54, 0x49, 0x89,
+    0xA6, 0x49, 0xAE, 0x17, 0x83, 0x7E, 0x88, 0x44, 0xA0, 0x88, 0x72, 0x58, 0xBE, 0x52, 0x4F, 0x10,
+    0x40, 0xC9, 0x57, 0xE3, 0x9D, 0x85, 0xFF, 0x12, 0x68, 0xAD, 0xC9, 0xA1, 0x73, 0x3D, 0x8E, 0x48,
+    0x0B, 0x70, 0x40, 0xF8, 0x70, 0xBA, 0xD5, 0x0A, 0x13, 0x9E, 0x4A, 0xC3, 0x63, 0xD5, 0x22, 0xC6,
+    0x3B, 0xDC, 0x27, 0x78, 0x98, 0xA7, 0xD1, 0x1A, 0x32, 0x42, 0xDD, 0x70, 0xF8, 0x49, 0xB4, 0x2C,
+    0x6C, 0xBA, 0xBB, 0x6B, 0x0A, 0xCE, 0xB4, 0x8C, 0xF8, 0x42, 0x7C, 0x21, 0xC6, 0x77, 0x74, 0x9D,
+    0xF3, 0x87, 0xDD, 0x04, 0x97, 0xD5, 0x50, 0x85, 0x97, 0xD5, 0x52, 0x51, 0x6D, 0xDD, 0xF4, 0xF5,
+    0xBB, 0xE3, 0x3A, 0xC6, 0x9E, 0x2A, 0xB9, 0xE4, 0x05, 0xA5, 0x58, 0x76, 0x5C, 0xAF, 0xDF, 0xF2,
+    0xAB, 0x9B, 0x97, 0x75, 0xCF, 0xB8, 0x8C, 0xEE, 0x93, 0x88, 0xAC, 0x1B, 0xD6, 0xF5, 0x53, 0xCB,
+    0x69, 0xDE, 0xDD, 0xC3, 0xD9, 0x61, 0x26, 0xD8, 0x15, 0x29, 0x14, 0x8C, 0xBD, 0xEA, 0x8E, 0xD5,
+    0xCE, 0x9C, 0xD4, 0xED, 0xAF, 0x16, 0x1F, 0xE2, 0xA3, 0x07, 0xE5, 0x93, 0x71, 0xE2, 0x29, 0xDE,
+    0xCF, 0x2A, 0x07, 0xED, 0xD4, 0xC6, 0x2F, 0x19, 0x00, 0x7F, 0x88, 0x0A, 0x3F, 0xEC, 0xB7, 0x3F,
+    0x97, 0x60, 0x10, 0xE1, 0x93, 0x9F, 0x7D, 0xE7, 0xE1, 0xA2, 0x5B, 0x1C, 0xC1, 0x19, 0x71, 0x25,
+    0xC7, 0xCC, 0xD4, 0x31, 0x39, 0xBD, 0x28, 0x37, 0xC7, 0x9E, 0xB0, 0xD3, 0x53, 0xE8, 0xDE, 0xD1,
+    0xE1, 0x1E, 0xA7, 0xB7, 0xC5, 0xD7, 0x27, 0x00, 0xA2, 0x51, 0x86, 0x78, 0x7E, 0xA5, 0xBF, 0x4D,
+    0x3C, 0xB9, 0xFB, 0x08, 0x1E, 0x20, 0xE2, 0x5F, 0xAB, 0x7A, 0xA4, 0x4A, 0x78, 0x70, 0xE3, 0x99,
+    0x98, 0x07, 0x76, 0x5F, 0x9C, 0xA3, 0x15, 0x3A, 0x1E, 0x3B, 0x95, 0xDE, 0x1B, 0x87, 0xCA, 0xDF,
+    0x8F, 0x9E, 0x87, 0x08, 0x66, 0x96, 0x94, 0x3D, 0x76, 0xEA, 0xC4, 0x1D, 0xA9, 0xDF, 0xC5, 0x86,
+    0x5E, 0xC2, 0x70, 0xBA, 0x14, 0x33, 0x12, 0x95, 0x53, 0x49, 0xB7, 0x62, 0x0E, 0x9E, 0x1F, 0xE1,
+    0x44, 0x72, 0xC1, 0x52, 0xF7, 0x02, 0x3D, 0xA0, 0x65, 0xA9, 0x62, 0x75, 0x08, 0x1F, 0x59, 0x86,
+    0x0B, 0xBF, 0x22, 0xA2, 0x7C, 0x27, 0x00, 0xD0, 0x43, 0x04, 0xC0, 0x02, 0xCC, 0x3E, 0x1D, 0xE4,
+    0xFB, 0xDB, 0xF7, 0x16, 0x3D, 0xA1, 0x7B, 0xE8, 0x09, 0xCD, 0xA3, 0x5E, 0xBB, 0xF4, 0xD0, 0xA0,
+    0xB7, 0x7D, 0xBA, 0xFB, 0xB0, 0x38, 0xDD, 0x1D, 0x2D, 0x78, 0xEC, 0xBE, 0xDB, 0x9C, 0xEE, 0x9E,
+    0xCC, 0xA7, 0xBB, 0x1F, 0xD8, 0x13, 0x4A, 0x61, 0x17, 0x6C, 0x88, 0xBD, 0x89, 0xBC, 0x7A, 0x3B,
+    0x8B, 0x3E, 0xF5, 0x89, 0xEE, 0xB4, 0xE8, 0x87, 0x63, 0x9F, 0x68, 0xC9, 0xEF, 0x0E, 0xBD, 0x6F,
+    0xA8, 0x86, 0x62, 0x9F, 0x68, 0x79, 0x70, 0x9F, 0xE8, 0xEF, 0x70, 0x8B, 0xAB, 0x31, 0xAF, 0x08,
+    0x0E, 0x10, 0x58, 0x58, 0x6A, 0x9A, 0x72, 0x1F, 0x0E, 0xB8, 0xBB, 0x6B, 0x8A, 0xC5, 0x72, 0x65,
+    0x3F, 0x64, 0x5F, 0xBA, 0x58, 0xB1, 0xF2, 0xE0, 0x2D, 0xFA, 0x35, 0xD7, 0x79, 0x7B, 0x27, 0xE5,
+    0xEE, 0x1E, 0x61, 0x0C, 0x31, 0x80, 0x3C, 0xC0, 0xF9, 0x79, 0x2A, 0xCC, 0x37, 0x76, 0xE7, 0x0E,
+    0x9C, 0x7C, 0xB6, 0xDA, 0xDD, 0xD5, 0x33, 0x0B, 0xCD, 0x54, 0x84, 0xB7, 0x3A, 0x75, 0xEA, 0x9E,
+    0xFA, 0xC8, 0x25, 0xF3, 0xFD, 0xDD, 0x7C, 0x51, 0xC9, 0x66, 0xE6, 0xE9, 0xA1, 0x28, 0x40, 0x0F,
+    0x0F, 0x77, 0x5A, 0x06, 0x78, 0xA7, 0x64, 0xD4, 0x11, 0xF1, 0xBB, 0x0A, 0xF5, 0x72, 0x6F, 0xA3,
+    0x88, 0x8F, 0x5D, 0xC8, 0xBF, 0xD8, 0x74, 0x21, 0xA3, 0xD3, 0x8D, 0x9F, 0xFF, 0xA1, 0x1F, 0x05,
+    0x82, 0x85, 0xCE, 0x91, 0x22, 0x82, 0xD4, 0x84, 0x96, 0x95, 0x06, 0x0F, 0x51, 0xEB, 0x61, 0x53,
+    0x68, 0xD2, 0xC5, 0xAC, 0xE1, 0x44, 0xB8, 0xC0, 0xEB, 0xE1, 0xC8, 0xAF, 0xDA, 0x6F, 0x6D, 0x2B,
+    0xED, 0x7B, 0x83, 0x66, 0x4F, 0x4D, 0x68, 0x9D, 0xA2, 0xBA, 0x4F, 0x4A, 0x7F, 0x1B, 0x84, 0x3B,
+    0x74, 0x02, 0xDB, 0xC6, 0x7A, 0x4A, 0x9C, 0x2A, 0x81, 0xC4, 0x10, 0xD4, 0xFC, 0xBA, 0x43, 0xAD,
+    0xCD, 0x2A, 0x3D, 0x7A, 0x6F, 0x91, 0x6F, 0x75, 0x12, 0x9F, 0x89, 0x14, 0xF2, 0xE0, 0xC9, 0xF8,
+    0x6D, 0x1E, 0x41, 0xF5, 0x18, 0xD6, 0xD7, 0xB3, 0x9A, 0xFA, 0xC4, 0xA1, 0x6D, 0x52, 0x2A, 0x2D,
+    0x5D, 0x0D, 0x5D, 0xA2, 0xF5, 0xF9, 0xA5, 0x86, 0x87, 0x30, 0x5B, 0x12, 0x54, 0x29, 0xAA, 0x24,
+    0x55, 0x9A, 0x2A, 0x51, 0x5D, 0xF7, 0x32, 0xC9, 0xEA, 0x22, 0x3E, 0x24, 0xAC, 0x52, 0x76, 0x2B,
+    0x88, 0x4A, 0x68, 0xF6, 0x90, 0x3A, 0x0D, 0x9C, 0x33, 0xE9, 0x3B, 0x11, 0xD8, 0xAF, 0x5E, 0x71,
+    0xBE, 0x0A, 0x07, 0xBF, 0xEC, 0x96, 0x4C, 0x79, 0xD7, 0x3E, 0xBE, 0x00, 0x6E, 0x22, 0xF8, 0x0E,
+    0xDF, 0x0B, 0xAE, 0xFB, 0x4D, 0xCF, 0xFA, 0xFC, 0x6A, 0x3E, 0xA1, 0x6B, 0xEF, 0xEC, 0x56, 0xDC,
+    0xD6, 0xDE, 0x2E, 0x70, 0xBB, 0x68, 0x4A, 0xBD, 0x5D, 0xF7, 0xC6, 0x01, 0x45, 0x46, 0xF1, 0x1E,
+    0x3E, 0x5B, 0x2B, 0xE7, 0xA6, 0x65, 0xAE, 0x75, 0xC5, 0x8C, 0x9B, 0x53, 0xBA, 0xF0, 0xB7, 0x4C,
+    0x89, 0x8A, 0x71, 0x25, 0xC5, 0xD4, 0xB2, 0xE2, 0x42, 0x5D, 0xDF, 0x45, 0x37, 0xB9, 0x67, 0xF7,
+    0xE0, 0x67, 0x08, 0x28, 0x5E, 0xA4, 0x5F, 0xEE, 0x10, 0xE3, 0x3E, 0xC8, 0x78, 0xB7, 0x0E, 0x16,
+    0xBD, 0xE3, 0x6D, 0x49, 0x57, 0x4F, 0x38, 0x97, 0x20, 0xD6, 0xF3, 0x0A, 0x26, 0x7E, 0xD9, 0x17,
+    0xE8, 0xFF, 0xB7, 0x54, 0x79, 0xD6, 0x6C, 0xEB, 0xBD, 0x5F, 0xA7, 0x7D, 0x49, 0x26, 0x11, 0xBA,
+    0x12, 0xC1, 0xC8, 0x6E, 0x7F, 0x46, 0xE9, 0xBF, 0xA6, 0x1F, 0x57, 0xF2, 0x78, 0xB9, 0xA8, 0x9B,
+    0xD3, 0x09, 0x5F, 0x79, 0x91, 0xD7, 0xDF, 0xB0, 0xC8, 0x8B, 0xE7, 0x60, 0x7C, 0x81, 0x22, 0xAF,
+    0xD5, 0x0E, 0xD3, 0xFC, 0xEE, 0x03, 0x61, 0x6A, 0x8D, 0x27, 0xCC, 0x51, 0x1A, 0x9C, 0xF1, 0xA7,
+    0x95, 0xF4, 0x35, 0x56, 0xF2, 0x99, 0x75, 0xEF, 0x0C, 0xB4, 0x44, 0xBA, 0x76, 0xA7, 0x12, 0x33,
+    0x10, 0x1C, 0xAA, 0x31, 0x11, 0x6A, 0xA3, 0xF1, 0x68, 0x6D, 0x8F, 0xEF, 0xBD, 0xE8, 0x0F, 0x70,
+    0x62, 0x3A, 0x5F, 0x38, 0xA4, 0xF1, 0xEC, 0xBE, 0xD2, 0x52, 0xEE, 0x43, 0x3E, 0xD9, 0x1F, 0x22,
+    0xAB, 0xF6, 0x16, 0x54, 0x4A, 0xB5, 0x5A, 0xEA, 0x96, 0x54, 0x3A, 0x65, 0x65, 0x7F, 0x5C, 0x68,
+    0xD5, 0x4E, 0xA3, 0xDC, 0xF9, 0xA4, 0x1D, 0x84, 0x21, 0xC2, 0x6B, 0xA4, 0x12, 0x26, 0xBF, 0xA1,
+    0x12, 0xCA, 0x8B, 0xC1, 0x0B, 0x21, 0x3F, 0xC1, 0x65, 0xEB, 0xB3, 0x6D, 0x0E, 0x5E, 0x75, 0xEF,
+    0x56, 0x7D, 0xDE, 0xEE, 0xF1, 0x63, 0x8B, 0xF5, 0x93, 0x16, 0x56, 0xE7, 0xED, 0xC5, 0xC5, 0xAA,
+    0x57, 0x38, 0xE2, 0x4C, 0x56, 0x8D, 0xD3, 0x39, 0x51, 0x47, 0x0D, 0xF5, 0xFC, 0xFF, 0x01, 0xD5,
+    0x9A, 0xBF, 0x8F, 0x1C, 0x67, 0x19, 0xC7, 0x9F, 0x99, 0xF1, 0xDE, 0x0A, 0xAF, 0xC4, 0x50, 0xDC,
+    0x09, 0xB0, 0x04, 0xD3, 0x21, 0x63, 0xAC, 0x4C, 0x43, 0x99, 0x78, 0x86, 0x48, 0x28, 0x45, 0x0A,
+    0xAE, 0xF0, 0x55, 0x14, 0x6E, 0xD2, 0x40, 0x73, 0xFF, 0x40, 0xE4, 0x59, 0x68, 0x10, 0x15, 0xEE,
+    0x28, 0x52, 0xC4, 0x85, 0x85, 0xCC, 0x15, 0x98, 0x12, 0xA4, 0xCB, 0xCD, 0x10, 0x57, 0x40, 0xC1,
+    0x26, 0x0D, 0x05, 0x45, 0x16, 0x63, 0x81, 0x64, 0x17, 0x1E, 0xD0, 0xA0, 0x6C, 0xEC, 0x9D, 0x7D,
+    0xF9, 0x7E, 0x9F, 0xE7, 0x9D, 0xD9, 0x3D, 0x07, 0x94, 0x20, 0xED, 0xED, 0xDE, 0x9D, 0xBD, 0xEF,
+    0xD8, 0xB7, 0xBB, 0xF3, 0xBC, 0xCF, 0xE7, 0x7D, 0x7E, 0xBD, 0xCF, 0x3B, 0x22, 0x91, 0xCB, 0x45,
+    0x46, 0x6E, 0x2C, 0x12, 0x73, 0x48, 0x5D, 0x25, 0x92, 0x3D, 0xC3, 0x50, 0x1E, 0x62, 0x70, 0x69,
+    0x25, 0x61, 0x8B, 0x21, 0x9A, 0x27, 0x13, 0x19, 0x35, 0x18, 0x92, 0x3A, 0x99, 0x4A, 0x36, 0xC1,
+    0x50, 0x3C, 0x79, 0x30, 0x15, 0xE7, 0x5C, 0x1D, 0x70, 0x88, 0x38, 0x0C, 0xE7, 0x12, 0xD7, 0xF1,
+    0x0C, 0x43, 0x52, 0x4B, 0xDC, 0x64, 0x53, 0x0C, 0x45, 0x25, 0xA3, 0x99, 0x2C, 0x7F, 0x22, 0xFE,
+    0x67, 0x34, 0xC7, 0x10, 0x73, 0x18, 0x36, 0x2B, 0xEF, 0x49, 0x56, 0x9F, 0x04, 0x6E, 0xBE, 0x18,
+    0x3A, 0xD7, 0xC6, 0x8B, 0xC3, 0x79, 0x32, 0x8B, 0xE7, 0x59, 0x3D, 0x9A, 0x65, 0x93, 0xD1, 0xAC,
+    0xA8, 0xE2, 0xA6, 0xAC, 0xE2, 0xBA, 0xAC, 0x12, 0xBC, 0xB2, 0x69, 0x59, 0x15, 0x93, 0xF2, 0xEF,
+    0xAE, 0x2A, 0x9C, 0xAB, 0x52, 0x57, 0x56, 0xA3, 0x36, 0x1B, 0x4B, 0x6E, 0xB7, 0x09, 0x71, 0xE7,
+    0xA8, 0xC5, 0xCD, 0x5B, 0x2F, 0x6F, 0xE5, 0x87, 0x6A, 0x8A, 0xAB, 0x31, 0xBC, 0xC3, 0x21, 0xE2,
+    0x00, 0x6D, 0x44, 0x0A, 0x7E, 0xF9, 0xED, 0x7E, 0x9A, 0x1B, 0x04, 0x13, 0x42, 0x42, 0xE8, 0x26,
+    0x12, 0xDC, 0xC2, 0x3C, 0xE2, 0x09, 0x64, 0x40, 0x22, 0xA6, 0x2E, 0xF7, 0xD6, 0x4A, 0x45, 0xAE,
+    0xD9, 0x65, 0xA1, 0x18, 0xDE, 0x6F, 0x54, 0xF2, 0x23, 0xE2, 0x18, 0x7D, 0x4C, 0x0A, 0x92, 0x8E,
+    0xB9, 0x22, 0xB2, 0x27, 0xBB, 0xAB, 0xEB, 0xE5, 0xF4, 0xEB, 0x8A, 0xC2, 0xC3, 0xF0, 0x38, 0x3C,
+    0x10, 0x8F, 0xC4, 0xA0, 0x88, 0x61, 0x11, 0x03, 0x23, 0x86, 0x46, 0x0C, 0x8E, 0x18, 0x1E, 0x31,
+    0x40, 0xA2, 0x88, 0x44, 0x02, 0xBB, 0x44, 0x76, 0x51, 0x50, 0x10, 0x33, 0xD3, 0x8B, 0xC2, 0xC2,
+    0xD7, 0xA6, 0x7A, 0x59, 0xB1, 0xA4, 0x23, 0x5B, 0xE4, 0xC0, 0xFD, 0x64, 0x2A, 0x43, 0xF7, 0x87,
+    0x5C, 0x92, 0xBF, 0xE0, 0x8E, 0x45, 0x88, 0x4F, 0xDD, 0x94, 0xFD, 0xA5, 0x31, 0x09, 0xB9, 0x09,
+    0xC1, 0x09, 0xC9, 0x09, 0xD1, 0x09, 0xD9, 0x09, 0xE1, 0x09, 0xE9, 0x09, 0xF1, 0x09, 0xF9, 0x09,
+    0x01, 0x0A, 0x09, 0x0A, 0x11, 0x0A, 0x19, 0x0A, 0x21, 0x8A, 0x52, 0x34, 0x8C, 0x97, 0x95, 0x17,
+    0xA7, 0x1F, 0xD6, 0x84, 0xF0, 0x0B, 0x37, 0xF5, 0xFC, 0x94, 0xDE, 0x92, 0xDD, 0x86, 0x0C, 0xE8,
+    0x0A, 0x05, 0xE0, 0x86, 0xD1, 0x07, 0x90, 0xF2, 0x73, 0x08, 0x21, 0x09, 0x82, 0xE8, 0x38, 0xAC,
+    0xCB, 0x78, 0xF4, 0x6A, 0xDE, 0x1A, 0xAA, 0x99, 0xC8, 0x6F, 0xB8, 0x86, 0x0F, 0xA7, 0x54, 0xF5,
+    0x11, 0xDE, 0x8D, 0xD5, 0x88, 0xD2, 0x1F, 0x71, 0x89, 0x76, 0x21, 0xFE, 0xB4, 0x01, 0x99, 0xFD,
+    0x98, 0xF9, 0x98, 0xF5, 0x98, 0xF1, 0x98, 0xED, 0xA8, 0xE9, 0x98, 0xE5, 0x98, 0xE1, 0x98, 0xDD,
+    0x98, 0xD9, 0x98, 0xD5, 0x98, 0xD1, 0xA8, 0x95, 0x98, 0xC9, 0x98, 0xC5, 0x98, 0xC1, 0x98, 0xBD,
+    0x98, 0xB9, 0x98, 0xB5, 0xF4, 0xC6, 0x32, 0xA0, 0x74, 0x1A, 0x93, 0x0C, 0x38, 0x04, 0x35, 0x8C,
+    0xFE, 0x67, 0x63, 0x5A, 0x8D, 0x74, 0x56, 0x53, 0x9F, 0xB9, 0xD5, 0xC0, 0x95, 0x2F, 0x13, 0x9F,
+    0xFB, 0x15, 0x27, 0xF3, 0x80, 0xFC, 0xBE, 0x18, 0xD2, 0x88, 0xE4, 0x87, 0x63, 0x75, 0x43, 0xF5,
+    0x95, 0x17, 0x0A, 0xF0, 0xC7, 0xE7, 0x0A, 0x60, 0x78, 0xF7, 0x6B, 0x10, 0x7A, 0x2C, 0x49, 0x39,
+    0x93, 0xAB, 0x3B, 0x77, 0x24, 0x38, 0xCA, 0xA1, 0x06, 0xCC, 0xEC, 0xD9, 0x44, 0x0A, 0x04, 0xCF,
+    0xF5, 0x9A, 0xD9, 0x5E, 0xEE, 0x83, 0x73, 0xE4, 0x60, 0x69, 0xF1, 0x23, 0x80, 0x2A, 0xC6, 0x0B,
+    0xE2, 0xD8, 0xDB, 0x42, 0x5C, 0xFE, 0xAC, 0x84, 0x75, 0x90, 0x63, 0x3A, 0x15, 0x26, 0x02, 0x01,
+    0x7F, 0x6E, 0x64, 0x11, 0xCC, 0x81, 0xE3, 0xE6, 0x06, 0x12, 0x59, 0x70, 0x97, 0x13, 0xC1, 0x6A,
+    0x0E, 0xE2, 0xEF, 0x62, 0x5A, 0x57, 0x6F, 0x60, 0x18, 0x1F, 0x93, 0x4B, 0xD3, 0x19, 0xD3, 0xDE,
+    0xC6, 0x13, 0x19, 0x8C, 0x83, 0x91, 0x68, 0xF7, 0xC6, 0xAE, 0xBC, 0xF6, 0xD6, 0xB1, 0xA4, 0xAF,
+    0x37, 0x4A, 0x66, 0x48, 0xA9, 0xFB, 0xA7, 0x12, 0x59, 0xF4, 0x7F, 0x50, 0xC9, 0x3E, 0x4D, 0x45,
+    0xB3, 0xE2, 0x31, 0x1D, 0xFA, 0xB5, 0x01, 0x44, 0x5E, 0x3E, 0xA5, 0x7D, 0xB4, 0x1D, 0xED, 0x43,
+    0xAC, 0x48, 0x00, 0xF1, 0xBB, 0x6F, 0x43, 0xFB, 0xAF, 0x9C, 0xA5, 0xF6, 0x7B, 0x96, 0xA9, 0xA9,
+    0x1B, 0x34, 0x18, 0x24, 0x34, 0x80, 0xEB, 0xE7, 0x01, 0x81, 0x5C, 0x65, 0x6A, 0xA7, 0x9B, 0x88,
+    0x19, 0xC1, 0xB7, 0xCF, 0x12, 0xC3, 0xFD, 0xCB, 0xAA, 0xDA, 0x03, 0xFA, 0xE6, 0xBB, 0xAC, 0x95,
+    0x76, 0x82, 0x3B, 0x4C, 0xCF, 0x72, 0x85, 0x33, 0xC8, 0x6F, 0x6B, 0xAC, 0x9C, 0xEB, 0x67, 0x6A,
+    0x59, 0xC5, 0xB1, 0xED, 0x78, 0xFA, 0xF8, 0xEB, 0x10, 0xFA, 0x9E, 0x24, 0x87, 0x33, 0xB9, 0x14,
+    0xE4, 0xF2, 0x2A, 0xFE, 0x64, 0xDF, 0x41, 0x8E, 0xC1, 0xCA, 0x0D, 0xB9, 0x70, 0xBB, 0x6B, 0xAC,
+    0xF9, 0x06, 0x54, 0x3B, 0xC9, 0x61, 0x1D, 0xC9, 0x93, 0x39, 0x95, 0x9D, 0x75, 0xD6, 0xB1, 0x2B,
+    0xE7, 0x2F, 0x9E, 0xB2, 0x76, 0xCA, 0xE0, 0xD8, 0xD9, 0x53, 0xE2, 0xA8, 0x35, 0xCD, 0xAC, 0x15,
+    0xC7, 0xFF, 0x88, 0xA7, 0xB0, 0xAE, 0xB1, 0x0D, 0xF8, 0x4A, 0x2E, 0xA5, 0x73, 0xDD, 0x2E, 0x41,
+    0xB3, 0x11, 0xE3, 0xAD, 0xD3, 0x24, 0x7D, 0x74, 0x8F, 0x6B, 0xDC, 0x70, 0xA8, 0x6D, 0x18, 0x52,
+    0x03, 0xD5, 0x2E, 0xD6, 0xA1, 0xD1, 0x5A, 0x97, 0xC3, 0xF3, 0xA3, 0x31, 0x60, 0x42, 0x83, 0xE5,
+    0xDD, 0x57, 0xF7, 0x39, 0x7A, 0xE7, 0xAA, 0x1B, 0xCA, 0x53, 0x3B, 0x94, 0x04, 0x72, 0x9D, 0x9B,
+    0x52, 0x40, 0xDC, 0xC6, 0x4D, 0x52, 0x8F, 0x00, 0x12, 0x30, 0x3F, 0x28, 0x6B, 0xEA, 0x54, 0xBA,
+    0x85, 0x94, 0x4F, 0x72, 0xDD, 0x24, 0xA0, 0xCA, 0x90, 0x62, 0x3A, 0xE2, 0xFD, 0xB1, 0x7E, 0x0E,
+    0x73, 0xFC, 0x84, 0xAB, 0x6E, 0x49, 0x82, 0x3A, 0x2E, 0xEC, 0xE5, 0x2B, 0xB6, 0x5E, 0xBC, 0x16,
+    0xE3, 0xFC, 0xDD, 0x37, 0xF4, 0x0D, 0x5D, 0x07, 0x2A, 0x60, 0xC5, 0xBA, 0x6C, 0x03, 0x0C, 0x0D,
+    0x91, 0xD9, 0x34, 0xE0, 0x1C, 0x58, 0xD1, 0x52, 0x3F, 0xDE, 0xE5, 0xEE, 0x5A, 0xA9, 0x70, 0xFF,
+    0x83, 0xCA, 0x2B, 0x72, 0x4F, 0x61, 0xCF, 0x9C, 0x46, 0xFC, 0xBA, 0xE3, 0x9B, 0x5F, 0xDA, 0x86,
+    0xCE, 0xC9, 0xF4, 0x86, 0x64, 0x8B, 0x39, 0xA4, 0xCC, 0xA5, 0x49, 0x6B, 0xD9, 0x0F, 0xD6, 0xAA,
+    0xEB, 0xE5, 0x3B, 0x5D, 0xAE, 0x48, 0x9B, 0x13, 0x9A, 0xD9, 0xFC, 0x1E, 0x83, 0x5A, 0xAB, 0x3B,
+    0x98, 0x4C, 0x6B, 0xE3, 0x25, 0x15, 0x9B, 0x95, 0x8D, 0xAA, 0xBA, 0xE9, 0x6E, 0xCA, 0x9B, 0xF6,
+    0xAA, 0xBE, 0xE9, 0x6F, 0x00, 0x8C, 0x80, 0x69, 0xEF, 0x47, 0x85, 0xE0, 0x1D, 0x3E, 0xB6, 0x51,
+    0x1D, 0x5C, 0x41, 0x18, 0x09, 0x43, 0x71, 0x4A, 0x20, 0x7F, 0x7E, 0x69, 0xB1, 0x21, 0x72, 0x6F,
+    0x72, 0x65, 0x50, 0x9D, 0xA7, 0x7F, 0x82, 0x25, 0x9C, 0x70, 0x83, 0xBE, 0xDF, 0x57, 0xE7, 0x24,
+    0x43, 0x34, 0x26, 0x8D, 0x70, 0x84, 0x74, 0x84, 0x78, 0x84, 0x7C, 0xAC, 0xFE, 0x26, 0x21, 0x45,
+    0xA4, 0x8C, 0x14, 0x92, 0x52, 0x52, 0x4C, 0xCA, 0xC9, 0x40, 0x29, 0xA9, 0x90, 0x05, 0x45, 0xA0,
+    0x73, 0x3D, 0x4E, 0x31, 0xD9, 0xAF, 0x96, 0x73, 0x8F, 0x49, 0x29, 0x2D, 0x21, 0x6D, 0xCA, 0x36,
+    0xAE, 0xE1, 0x76, 0x09, 0xA6, 0x3C, 0x7C, 0xE8, 0xF2, 0xE0, 0x1D, 0x6E, 0x27, 0x40, 0x82, 0x20,
+    0x3A, 0x0E, 0x6B, 0xB2, 0x0F, 0xB5, 0x79, 0x5A, 0x83, 0x3C, 0x10, 0xF3, 0xFB, 0xB4, 0xC1, 0xEC,
+    0xCA, 0xD9, 0x9D, 0xAD, 0xAA, 0xEF, 0x97, 0x45, 0x62, 0x46, 0xA9, 0x1D, 0x7E, 0x4A, 0x1D, 0x36,
+    0x1E, 0x43, 0x81, 0x9F, 0xD2, 0x2C, 0xAA, 0x8D, 0x98, 0x05, 0x0C, 0x21, 0xC4, 0xA7, 0xDC, 0x53,
+    0xA4, 0xC0, 0x17, 0x0C, 0x4E, 0xD5, 0x6F, 0xF1, 0xBB, 0x2B, 0x0C, 0x47, 0x05, 0x94, 0x08, 0xE0,
+    0xB7, 0x20, 0x74, 0x7B, 0x2B, 0x84, 0xC2, 0x3B, 0xD7, 0x25, 0xC1, 0x04, 0x6E, 0x40, 0xB3, 0xAB,
+    0x3B, 0x63, 0x09, 0x8F, 0x98, 0xC4, 0x73, 0x49, 0x3F, 0xAA, 0xE4, 0x64, 0xB8, 0x66, 0x43, 0x19,
+    0xEC, 0x77, 0xD9, 0xC2, 0x31, 0xA5, 0xCC, 0x4B, 0x2E, 0x0D, 0x72, 0xEA, 0xC0, 0xF6, 0xD6, 0xE7,
+    0x2D, 0x83, 0x1E, 0x88, 0xDF, 0x95, 0x4D, 0x24, 0xFB, 0x63, 0x8D, 0x68, 0x3F, 0x03, 0x8C, 0x9B,
+    0x1B, 0xC9, 0xAC, 0x61, 0x97, 0xC3, 0x0E, 0x27, 0xD6, 0xC8, 0x2B, 0x7C, 0x23, 0xCF, 0xD7, 0x38,
+    0x05, 0x2C, 0xB4, 0x74, 0x2C, 0x9A, 0xB0, 0x81, 0x6E, 0x4D, 0x5B, 0xDF, 0xE7, 0x12, 0x84, 0x7F,
+    0xCD, 0xCB, 0x19, 0xBE, 0x96, 0x55, 0xDA, 0xED, 0xD2, 0x89, 0x50, 0x6D, 0xDC, 0x96, 0x00, 0xF9,
+    0x1A, 0x3A, 0xE2, 0xB6, 0xDB, 0x94, 0x5A, 0xCA, 0xE1, 0x63, 0xF8, 0x67, 0x23, 0x5F, 0x46, 0xEC,
+    0xA4, 0xD9, 0x13, 0xCD, 0x37, 0xAD, 0xD5, 0xC9, 0x6F, 0x84, 0x8E, 0xF3, 0x44, 0xD1, 0x03, 0xD2,
+    0xF8, 0x0B, 0xD4, 0x90, 0xAA, 0xFE, 0x41, 0x91, 0x29, 0x6B, 0x39, 0xCA, 0xA3, 0xB8, 0x33, 0x9A,
+    0x9E, 0x26, 0x84, 0xDA, 0x6E, 0x97, 0x34, 0xDE, 0xAF, 0x97, 0xBF, 0x4F, 0x74, 0x2E, 0xFD, 0x2F,
+    0x6D, 0x2E, 0xC0, 0x8F, 0x3B, 0x23, 0xFC, 0x99, 0x0E, 0xAA, 0x80, 0xE9, 0x30, 0xEA, 0x75, 0xA8,
+    0x7D, 0x52, 0xB1, 0x1C, 0x67, 0x5F, 0xCA, 0xF2, 0xE5, 0xBD, 0x83, 0xB2, 0x55, 0xA7, 0x56, 0x0B,
+    0xAA, 0xC5, 0x3D, 0x2F, 0x9B, 0xC8, 0x8D, 0x93, 0xF9, 0x70, 0x81, 0x9B, 0xA0, 0xF6, 0x1C, 0xB6,
+    0x10, 0x1D, 0xB5, 0xD0, 0x2C, 0x6A, 0xA1, 0x1A, 0x86, 0x09, 0x04, 0x60, 0x18, 0xCD, 0x8B, 0x09,
+    0x8A, 0x53, 0x0E, 0xA8, 0x30, 0xA1, 0x3A, 0xDE, 0x2D, 0xA6, 0x59, 0x13, 0xB8, 0x2A, 0x59, 0x7C,
+    0xDF, 0xE5, 0xB8, 0xE7, 0xC2, 0xA7, 0xBE, 0x42, 0xAD, 0xB2, 0x0B, 0x43, 0xA6, 0x05, 0x51, 0xA1,
+    0x60, 0xED, 0xCA, 0xA9, 0xFE, 0x27, 0x5D, 0x70, 0xA3, 0x50, 0x0D, 0xD5, 0xFA, 0x0E, 0x9B, 0xB4,
+    0xC1, 0xDD, 0xA7, 0x90, 0x55, 0xE9, 0x6B, 0x56, 0x8E, 0x63, 0xBE, 0x9A, 0x72, 0x6C, 0x75, 0x6C,
+    0xF1, 0x57, 0xDD, 0xF8, 0x8C, 0x63, 0x08, 0x0B, 0xDD, 0x63, 0x91, 0x4B, 0x2B, 0xD6, 0xE7, 0xFE,
+    0x6B, 0x5D, 0x37, 0xD4, 0xD4, 0x4E, 0xA7, 0x1B, 0xD0, 0xF2, 0x94, 0x46, 0x50, 0x76, 0x35, 0x77,
+    0x34, 0xD9, 0x1A, 0x98, 0x65, 0x71, 0x57, 0xF9, 0xE2, 0x2E, 0xB7, 0x8C, 0x7B, 0x77, 0xAD, 0x68,
+    0x34, 0x93, 0xAB, 0xAD, 0x0D, 0x17, 0xC9, 0x98, 0xFE, 0x4E, 0x47, 0x28, 0x0E, 0xF1, 0xCF, 0x60,
+    0x4E, 0xB1, 0xC1, 0x7E, 0x90, 0x9F, 0x32, 0x0F, 0xC3, 0x60, 0x1C, 0x14, 0x84, 0x28, 0x09, 0x51,
+    0x14, 0xA2, 0x2C, 0x44, 0x61, 0x88, 0xD2, 0x10, 0xC5, 0x21, 0xCA, 0x43, 0x14, 0x88, 0x28, 0x11,
+    0x1D, 0xD9, 0x1E, 0xE4, 0xC7, 0x14, 0x8A, 0x28, 0x15, 0x51, 0x2C, 0xA2, 0x5C, 0x3C, 0x18, 0x4F,
+    0xA6, 0x47, 0xF3, 0xB9, 0xCA, 0x1E, 0xF0, 0x51, 0x40, 0x6C, 0x4A, 0x32, 0xBF, 0x1D, 0x36, 0x42,
+    0x46, 0x42, 0x48, 0x42, 0x4A, 0x1C, 0x66, 0x42, 0x4E, 0x1C, 0x1A, 0x21, 0x29, 0xEB, 0x4C, 0x92,
+    0x95, 0x45, 0x4F, 0xD2, 0x32, 0x5C, 0xC6, 0xEB, 0x07, 0xEA, 0x6E, 0x1A, 0x17, 0xDF, 0xC0, 0x3B,
+    0x3B, 0xB7, 0x9C, 0x87, 0xA5, 0xAC, 0x96, 0xA8, 0x36, 0x6A, 0x2E, 0x9F, 0x59, 0xFB, 0xAC, 0xC9,
+    0x54, 0xEC, 0x92, 0xE9, 0x52, 0x7C, 0x4B, 0x8F, 0x2F, 0xD8, 0x4E, 0xC1, 0x5E, 0x91, 0xF2, 0x9D,
+    0xB6, 0x32, 0x0E, 0xF3, 0xF3, 0x6B, 0x36, 0xD6, 0xD5, 0x3E, 0x5D, 0x20, 0x7D, 0x6F, 0x0C, 0x03,
+    0xFA, 0xFD, 0x06, 0x0D, 0x48, 0x76, 0xF2, 0xB7, 0x00, 0xE1, 0x39, 0x24, 0xDD, 0xE6, 0x31, 0xC8,
+    0xAF, 0xAF, 0x60, 0x56, 0xE1, 0x7D, 0xCE, 0x8C, 0x67, 0x4C, 0x19, 0x9D, 0xBC, 0xDD, 0x9E, 0x29,
+    0x49, 0x78, 0xF7, 0x3A, 0x66, 0x72, 0x2C, 0xAF, 0x60, 0x7D, 0x58, 0x25, 0x05, 0x47, 0xD6, 0xEA,
+    0x78, 0xB9, 0x4A, 0x5A, 0x8B, 0x49, 0x05, 0x07, 0x6A, 0x16, 0x5A, 0x0D, 0x31, 0x27, 0x22, 0xF6,
+    0x47, 0x33, 0x84, 0x22, 0x28, 0xBF, 0x7F, 0x0E, 0xF3, 0xD1, 0xCB, 0x55, 0x52, 0xB4, 0xAC, 0x92,
+    0xCE, 0x36, 0x4F, 0xED, 0x99, 0x29, 0x68, 0xED, 0xED, 0xF7, 0x92, 0xA8, 0x29, 0x97, 0xB3, 0x95,
+    0xBE, 0xAA, 0xB4, 0xC2, 0xA2, 0x6C, 0xF9, 0x21, 0x6C, 0xD5, 0xDF, 0x5F, 0xA8, 0xC3, 0xBD, 0x98,
+    0xAB, 0xC7, 0x69, 0xFD, 0x38, 0x66, 0xCF, 0x0A, 0xF8, 0x98, 0xF7, 0x00, 0x90, 0x9D, 0x1D, 0xF3,
+    0x3A, 0xEF, 0x76, 0xDE, 0xEF, 0xBC, 0xE3, 0xF5, 0x97, 0x4A, 0xDB, 0x4F, 0xB8, 0xE8, 0xE1, 0xE2,
+    0xA4, 0xAB, 0x6D, 0x0A, 0x96, 0x37, 0x35, 0xDD, 0x0F, 0xFE, 0x77, 0x8B, 0x59, 0xD4, 0x1C, 0xB0,
+    0xF3, 0xC0, 0xCE, 0x05, 0xBB, 0x66, 0xD2, 0x40, 0x71, 0x25, 0xFA, 0x56, 0x36, 0xE9, 0x77, 0xC9,
+    0xD0, 0xF5, 0x80, 0x21, 0x63, 0xB9, 0x5B, 0x4E, 0x17, 0x98, 0x04, 0x90, 0x7E, 0x34, 0xA3, 0xFB,
+    0xC1, 0x53, 0x80, 0x95, 0xC5, 0x3A, 0x1D, 0xD0, 0x3C, 0xD0, 0x5C, 0xD0, 0x7C, 0xD0, 0x9C, 0xD0,
+    0xBC, 0xD0, 0xDC, 0xD0, 0xFC, 0xD0, 0x1C, 0xD1, 0x17, 0xC2, 0xEA, 0x8A, 0xDE, 0x17, 0x3B, 0xE0,
+    0x9E, 0x6C, 0x56, 0xD9, 0x2A, 0x4E, 0xFB, 0xC2, 0x8B, 0x2A, 0xF8, 0x0A, 0x74, 0xFF, 0x42, 0xA0,
+    0xD5, 0x1D, 0x87, 0x1D, 0xDA, 0xF9, 0x56, 0x82, 0x37, 0xA0, 0x96, 0x68, 0x65, 0x77, 0xE3, 0x68,
+    0x57, 0xEB, 0x2B, 0x5F, 0x61, 0x75, 0x35, 0x96, 0xDF, 0x8A, 0x58, 0x9D, 0xD5, 0x77, 0x15, 0xFB,
+    0x5A, 0xEB, 0x9C, 0xDB, 0xF0, 0x4A, 0x43, 0x3C, 0xD2, 0x8D, 0x94, 0x56, 0x68, 0x56, 0xA3, 0x69,
+    0x95, 0xA6, 0x9D, 0x91, 0x03, 0xAD, 0xD4, 0xB6, 0x04, 0xBD, 0xC8, 0x1B, 0x95, 0xAB, 0xA7, 0xA3,
+    0x11, 0xC5, 0x61, 0x21, 0x7E, 0xA7, 0x6A, 0x04, 0xF9, 0xA5, 0x0B, 0x84, 0x39, 0x9E, 0xBE, 0x42,
+    0x6B, 0x59, 0xD0, 0x88, 0x4A, 0x3D, 0x9B, 0x68, 0xD2, 0x1A, 0x68, 0xF7, 0x83, 0x6D, 0xA1, 0xBD,
+    0x18, 0xDC, 0xBA, 0xBC, 0x90, 0xD6, 0xAB, 0x97, 0xD3, 0x7B, 0x2B, 0xCB, 0x68, 0xAB, 0x2D, 0xCA,
+    0x4D, 0x92, 0x2C, 0x4D, 0x68, 0xBE, 0xCC, 0x68, 0x8B, 0x53, 0x88, 0x23, 0x02, 0x1E, 0xCE, 0x43,
+    0x1D, 0x90, 0xED, 0x67, 0x98, 0x5A, 0xAC, 0x43, 0x03, 0x5A, 0x49, 0x8D, 0x69, 0xA4, 0xB5, 0x56,
+    0x63, 0x6C, 0x57, 0x4D, 0x10, 0xF8, 0x32, 0x3E, 0x59, 0x50, 0x54, 0xA9, 0xAF, 0xC1, 0xDC, 0x18,
+    0x0C, 0x5D, 0x9E, 0x4D, 0x70, 0x8B, 0xAC, 0xC6, 0x72, 0xA4, 0x7C, 0x2E, 0x21, 0x76, 0x7A, 0x68,
+    0x44, 0x8F, 0x28, 0x17, 0xEA, 0x0E, 0x7D, 0x77, 0xA4, 0x6F, 0x6F, 0xA9, 0x53, 0x17, 0xDD, 0x1B,
+    0x90, 0xE6, 0x20, 0x1E, 0xB3, 0x89, 0x67, 0x98, 0x48, 0xDC, 0x70, 0x0E, 0x75, 0xC4, 0x39, 0xE0,
+    0xAD, 0x94, 0x54, 0x20, 0x1E, 0x13, 0xE1, 0x23, 0x0E, 0x7E, 0x0E, 0x19, 0x07, 0x2C, 0x5C, 0xF1,
+    0x21, 0x6B, 0x05, 0xF7, 0x8C, 0xC3, 0x2D, 0x2C, 0x6C, 0xCB, 0x48, 0xD1, 0x4B, 0xD4, 0x00, 0x4D,
+    0x43, 0xB0, 0x20, 0x19, 0xCD, 0x5F, 0x5A, 0x1D, 0xEB, 0xEE, 0x10, 0xCE, 0x17, 0xCA, 0x6E, 0xDF,
+    0x11, 0xB4, 0xDD, 0xF9, 0xCF, 0xB0, 0xDA, 0x1E, 0xAB, 0x80, 0x4B, 0x1B, 0x68, 0x58, 0x79, 0xB3,
+    0xEE, 0x1E, 0xEE, 0x61, 0x7B, 0x43, 0xDE, 0xD3, 0x83, 0xC6, 0x33, 0x46, 0x77, 0xE0, 0x43, 0xB0,
+    0x65, 0x96, 0x53, 0x85, 0x90, 0xED, 0x4E, 0x56, 0x8E, 0x2E, 0xCB, 0x0A, 0xF2, 0xE2, 0xC6, 0xE5,
+    0x3C, 0x67, 0xFB, 0x27, 0x09, 0x49, 0xF2, 0x71, 0xCB, 0x14, 0x99, 0x3A, 0x6D, 0xEA, 0xB0, 0xF4,
+    0x24, 0x91, 0xC7, 0xDA, 0xB4, 0xA1, 0x12, 0xA9, 0x5D, 0xF8, 0x88, 0xCA, 0x58, 0x3D, 0x91, 0x56,
+    0x0A, 0xBF, 0xD4, 0xBD, 0x5E, 0xA5, 0xD6, 0x5A, 0x56, 0xA1, 0x35, 0xFA, 0x59, 0xA9, 0xE9, 0x0A,
+    0xE8, 0x45, 0x3B, 0x73, 0x4E, 0xDD, 0x42, 0xCA, 0x7F, 0x97, 0xB5, 0xF5, 0xF9, 0xF4, 0x80, 0x48,
+    0x8F, 0x07, 0x40, 0x73, 0x26, 0xAB, 0x9E, 0x10, 0xDC, 0x5C, 0x36, 0xFD, 0xF5, 0x84, 0xC9, 0xBA,
+    0xAC, 0x58, 0x65, 0x56, 0xC0, 0xFB, 0xFD, 0x71, 0x00, 0x49, 0xA6, 0x35, 0x51, 0x96, 0x15, 0x58,
+    0xB2, 0xC1, 0x86, 0x42, 0x98, 0x87, 0x86, 0x1A, 0x5D, 0x88, 0xD3, 0x78, 0x1A, 0x50, 0x23, 0x6A,
+    0x48, 0x8D, 0xA9, 0x41, 0x35, 0xAA, 0x86, 0x15, 0xE3, 0xBB, 0xEC, 0x2C, 0x28, 0xD8, 0xD3, 0x64,
+    0xBD, 0x43, 0x5A, 0x2E, 0xEB, 0xAB, 0x23, 0xCB, 0x6F, 0x2B, 0x56, 0x70, 0xAE, 0xD1, 0x5A, 0x3D,
+    0x64, 0x95, 0x90, 0x79, 0x56, 0x60, 0x95, 0x48, 0xA1, 0x68, 0x07, 0x1B, 0x47, 0xBB, 0x7A, 0x8E,
+    0xE8, 0x7B, 0xC3, 0xDD, 0x59, 0xA2, 0x1D, 0xDA, 0xF9, 0xF3, 0xC4, 0x3E, 0x4C, 0x27, 0x17, 0xC4,
+    0x86, 0x97, 0x11, 0xC1, 0x87, 0x04, 0x8B, 0x09, 0x16, 0x14, 0x2C, 0x2A, 0x20, 0x2C, 0x10, 0xFA,
+    0xFD, 0x2D, 0x41, 0x0F, 0x5B, 0x0D, 0x96, 0x23, 0xA7, 0x4F, 0x2B, 0xC4, 0xA6, 0x46, 0x6A, 0x95,
+    0xE9, 0xA5, 0xFE, 0x18, 0xF3, 0x22, 0x60, 0x1E, 0x4D, 0x53, 0xAD, 0x87, 0x4E, 0x34, 0xEF, 0xF3,
+    0x16, 0xB3, 0xB4, 0x01, 0xDA, 0xFD, 0x20, 0xDF, 0x92, 0x3D, 0x5F, 0x0C, 0x6E, 0xFE, 0xB0, 0xC3,
+    0xEA, 0x8D, 0x3E, 0xBE, 0x2D, 0x5E, 0xD6, 0xC4, 0xDA, 0x0E, 0x5B, 0x21, 0xB9, 0xB0, 0xC3, 0x90,
+    0xE5, 0xE8, 0xC3, 0xD5, 0x4A, 0x34, 0xD3, 0xD6, 0xFD, 0xA8, 0xE9, 0x03, 0x9A, 0x7E, 0x60, 0x77,
+    0x79, 0x06, 0xC0, 0x2C, 0x8E, 0xEF, 0xA6, 0x53, 0x10, 0x4B, 0xEA, 0x78, 0xDE, 0x3F, 0x52, 0xC2,
+    0xC7, 0x50, 0x50, 0xD9, 0x0C, 0x3F, 0x61, 0x6B, 0x41, 0x0F, 0xA4, 0xC8, 0x28, 0xB4, 0x47, 0x89,
+    0x27, 0xFD, 0x03, 0xDE, 0xCB, 0x33, 0x27, 0x0E, 0x8B, 0xAE, 0x38, 0x51, 0x61, 0xCB, 0x33, 0x27,
+    0xBF, 0x69, 0xD6, 0xA4, 0xA0, 0x1B, 0x66, 0xDD, 0x73, 0xDA, 0x66, 0xB9, 0xDB, 0x2A, 0x17, 0x63,
+    0x7C, 0x53, 0x4B, 0x45, 0x9F, 0xDA, 0xD9, 0xAB, 0xAB, 0xF4, 0xD4, 0x04, 0xF3, 0x48, 0x27, 0x10,
+    0x90, 0x7C, 0x08, 0x01, 0xC9, 0xDF, 0xF8, 0x88, 0xCD, 0x3F, 0x70, 0xDB, 0xF8, 0x19, 0x4F, 0x3B,
+    0xF4, 0xC1, 0x60, 0x96, 0x5F, 0xFA, 0x74, 0x0D, 0x0F, 0x46, 0xAC, 0x34, 0x52, 0xE9, 0x7A, 0xCE,
+    0x45, 0xAA, 0xD7, 0xAC, 0xBC, 0xA4, 0xC5, 0xB4, 0xFD, 0x93, 0x19, 0x9B, 0x53, 0xFF, 0xD3, 0x8D,
+    0xA2, 0xF4, 0xA5, 0x46, 0xD1, 0x19, 0xAA, 0xFF, 0xAF, 0x39, 0xD4, 0x7F, 0xD8, 0x42, 0xFD, 0x37,
+    0x30, 0xB4, 0xD1, 0xAC, 0x4B, 0x28, 0x9F, 0xE3, 0x2C, 0x63, 0xBA, 0x79, 0x53, 0x31, 0x50, 0x6D,
+    0x57, 0xC7, 0x5E, 0x2A, 0xC4, 0x3F, 0xF0, 0x16, 0xB6, 0xFE, 0x71, 0x4C, 0xD9, 0x19, 0x6F, 0xCD,
+    0x68, 0x7C, 0x9F, 0x77, 0xF2, 0x2A, 0x0B, 0x5C, 0x6E, 0xE0, 0x10, 0xAE, 0x82, 0x9A, 0x2E, 0x9B,
+    0x07, 0x5B, 0x62, 0xC5, 0x9D, 0xBB, 0xEE, 0xDB, 0x23, 0x06, 0x35, 0xDD, 0xB3, 0x07, 0x7D, 0x28,
+    0xDB, 0x3C, 0xA1, 0xFF, 0x00, 0xB5, 0x58, 0x31, 0x8F, 0xDD, 0xC6, 0x11, 0x1E, 0x92, 0xF7, 0x8E,
+    0xF0, 0x11, 0x06, 0x55, 0x48, 0x89, 0x24, 0x07, 0x61, 0xCA, 0xE0, 0xA0, 0x88, 0x2E, 0x52, 0x08,
+    0x46, 0x74, 0xCB, 0xF8, 0x10, 0x18, 0x48, 0x9A, 0x2B, 0x74, 0xB5, 0x1B, 0x17, 0x81, 0x52, 0xC8,
+    0x65, 0x0A, 0x27, 0xA4, 0xA4, 0x1F, 0xE0, 0xAB, 0xDC, 0x46, 0x06, 0x54, 0x9C, 0xAF, 0xB0, 0x9A,
+    0x00, 0x51, 0x0C, 0x2B, 0xA4, 0xE4, 0x32, 0x85, 0x68, 0x0B, 0x81, 0x8B, 0x14, 0x59, 0x58, 0x49,
+    0xA5, 0xC2, 0x1B, 0x85, 0x88, 0xA8, 0x98, 0xE4, 0xE6, 0xFB, 0x96, 0xE4, 0xBB, 0x77, 0x8E, 0x14,
+    0x9D, 0x81, 0xE4, 0xF1, 0x0D, 0xDF, 0x1E, 0x39, 0x3B, 0x3B, 0x33, 0x3B, 0xF3, 0xCD, 0xEC, 0x89,
+    0x78, 0x85, 0xE8, 0xCB, 0xB7, 0x3F, 0xBA, 0x7D, 0x43, 0xBF, 0x5F, 0xDC, 0x90, 0x17, 0x5F, 0x22,
+    0x7E, 0x16, 0xC9, 0xF9, 0x0F, 0xCE, 0x7F, 0x18, 0x6D, 0xF8, 0x3F, 0x95, 0x8D, 0x17, 0x5F, 0x9B,
+    0x07, 0x99, 0xB2, 0x85, 0xB2, 0x59, 0x6E, 0x65, 0x75, 0x9C, 0x5B, 0xDB, 0x94, 0xD6, 0x1A, 0x0B,
+    0xDA, 0xDD, 0xDD, 0xDD, 0x39, 0x7B, 0xC0, 0xCF, 0xBE, 0xB2, 0xFC, 0x74, 0xD3, 0x4F, 0xEE, 0x7E,
+    0x5A, 0x2C, 0x9B, 0xCB, 0x9D, 0xFF, 0xF9, 0x77, 0x53, 0x7E, 0xBE, 0xC0, 0xCA, 0xB1, 0xB5, 0x7A,
+    0xE3, 0xE0, 0x60, 0x0F, 0xAB, 0xC8, 0xA9, 0xDD, 0x5D, 0xA8, 0x68, 0xAB, 0xCD, 0x83, 0x83, 0x4C,
+    0xEE, 0x78, 0x5D, 0xD0, 0x46, 0x4D, 0x6C, 0x52, 0xAD, 0xAA, 0x53, 0x99, 0x77, 0x29, 0xE8, 0xC3,
+    0x2E, 0x6E, 0x62, 0x9D, 0x56, 0xAA, 0xD8, 0x92, 0xD2, 0x5D, 0x39, 0x2E, 0x85, 0x6B, 0x21, 0xDE,
+    0xA5, 0xC5, 0x4E, 0xD0, 0xA5, 0x3A, 0x6C, 0x55, 0x15, 0x9B, 0xBC, 0x88, 0xB5, 0x95, 0xB4, 0x1A,
+    0x44, 0x5D, 0xEB, 0x64, 0xCB, 0x6F, 0xC4, 0x46, 0xC6, 0x46, 0x4D, 0x19, 0x36, 0x39, 0xBE, 0x41,
+    0xA3, 0xF0, 0x7D, 0xBD, 0x5D, 0xC8, 0x0E, 0xD7, 0x95, 0xD8, 0x80, 0x34, 0xA8, 0x06, 0x55, 0xA0,
+    0x42, 0xCE, 0xBC, 0xF9, 0x5E, 0x91, 0x5A, 0xFA, 0xCB, 0x66, 0xAF, 0x95, 0xBF, 0x10, 0xD9, 0x02,
+    0xDF, 0xAF, 0x40, 0x1F, 0x83, 0xBA, 0x91, 0x3C, 0x50, 0x00, 0xFF, 0x04, 0x8D, 0x48, 0x08, 0x8A,
+    0xCC, 0x24, 0x0A, 0x94, 0x68, 0x99, 0x3E, 0x65, 0x06, 0xC2, 0xEF, 0xB0, 0x9C, 0xE8, 0xC3, 0xB9,
+    0xA4, 0x80, 0xDE, 0x0D, 0xC0, 0x4C, 0x5A, 0x4E, 0xAE, 0x65, 0x11, 0xDF, 0xCD, 0x12, 0xF8, 0x01,
+    0xEB, 0x57, 0xCA, 0x96, 0x85, 0xA4, 0x98, 0xA6, 0xDC, 0x3E, 0x88, 0xD8, 0x89, 0xB0, 0x64, 0x2F,
+    0x89, 0x85, 0xC3, 0xAA, 0xE5, 0x37, 0xB5, 0x55, 0x6C, 0xC5, 0xE7, 0x96, 0x61, 0xF7, 0x69, 0x06,
+    0xAC, 0x8A, 0x3B, 0xB0, 0x49, 0x4A, 0x86, 0x4C, 0x35, 0x92, 0x67, 0xF2, 0x5B, 0x11, 0xE8, 0xB4,
+    0x9E, 0xA9, 0x3A, 0xD7, 0x65, 0x9D, 0x57, 0x0B, 0xF8, 0x6F, 0x91, 0xA9, 0x2A, 0xC5, 0x5F, 0xCA,
+    0x94, 0x55, 0xAE, 0xF3, 0x42, 0x55, 0x6B, 0x7C, 0x2A, 0xAA, 0x2A, 0x6B, 0x5B, 0xE5, 0xC5, 0x9A,
+    0x5C, 0xDE, 0xFF, 0x68, 0xFF, 0x38, 0x51, 0xCA, 0x6B, 0xF3, 0x83, 0xCD, 0x0F, 0x8F, 0x13, 0x9F,
+    0xEE, 0x92, 0xBC, 0x3F, 0xBC, 0xFC, 0xE2, 0xC5, 0x17, 0x67, 0xBC, 0x2D, 0xE3, 0x75, 0xFC, 0x19,
+    0xF2, 0xF2, 0x78, 0x1D, 0x77, 0xC6, 0x72, 0xFF, 0x2A, 0x49, 0xF8, 0x67, 0x60, 0x8D, 0xDB, 0x04,
+    0x89, 0x6D, 0x23, 0x3D, 0x07, 0xC9, 0x83, 0x76, 0xF4, 0x75, 0xFA, 0x49, 0x1B, 0x1A, 0x0E, 0xD4,
+    0xF5, 0x96, 0xF1, 0x83, 0xC1, 0x76, 0xAB, 0x32, 0x0E, 0x10, 0x6E, 0x7F, 0x70, 0x62, 0xF2, 0xE8,
+    0xEF, 0xDD, 0x95, 0xC2, 0xFB, 0xBD, 0xE4, 0x6F, 0x3E, 0x7C, 0x6C, 0x4D, 0xCC, 0xD0, 0xBA, 0xFF,
+    0xB9, 0x6D, 0xDD, 0xB6, 0x5D, 0x79, 0xF7, 0x1F, 0x5D, 0xFE, 0x9B, 0x3A, 0x6C, 0xF3, 0xE4, 0xB3,
+    0xCE, 0x32, 0x0C, 0xFB, 0xF4, 0x5E, 0xD7, 0x63, 0x10, 0xB4, 0xEA, 0x7A, 0xDF, 0x61, 0x10, 0x19,
+    0xB5, 0xFD, 0xB4, 0x4B, 0xA0, 0x4C, 0xA5, 0xDE, 0xF8, 0x67, 0x97, 0x56, 0xA2, 0x32, 0xF5, 0xB3,
+    0xC7, 0x9D, 0x2A, 0x10, 0x59, 0xCA, 0x7E, 0x6A, 0xB1, 0xF1, 0x1D, 0xB6, 0xB9, 0xB0, 0xBD, 0x40,
+    0x99, 0x08, 0x0F, 0x9B, 0xC9, 0x02, 0x4F, 0x8E, 0x7E, 0x66, 0x8B, 0x56, 0x8D, 0x5A, 0xB5, 0x6B,
+    0xD5, 0xB4, 0x55, 0xEB, 0x56, 0x0D, 0x5C, 0xB5, 0x71, 0xD5, 0xCC, 0x55, 0x4B, 0x23, 0x7D, 0x68,
+    0x6C, 0xDE, 0xC9, 0x6C, 0xEF, 0x5D, 0x3B, 0xC8, 0x6C, 0xF2, 0x83, 0xBE, 0x94, 0xD9, 0xEA, 0xCF,
+    0x1B, 0xC6, 0xF7, 0x68, 0xF8, 0x9F, 0x4D, 0x29, 0xB3, 0xED, 0x7F, 0xE1, 0x78, 0x32, 0xFF, 0xBE,
+    0x46, 0x1A, 0x4D, 0x1E, 0xB8, 0xAF, 0xA1, 0xED, 0xE4, 0x84, 0x77, 0xBF, 0xE8, 0x64, 0xF6, 0x43,
+    0x8C, 0xAC, 0x9A, 0x5D, 0x11, 0xC2, 0xBE, 0xD9, 0x1B, 0xBE, 0x2D, 0x8E, 0x3A, 0x04, 0xAE, 0x83,
+    0xE4, 0x5E, 0x82, 0x8E, 0x3C, 0xF0, 0x31, 0xBC, 0xB2, 0xC9, 0xE7, 0x57, 0x7B, 0x29, 0xF1, 0xB0,
+    0x0F, 0x4D, 0x00, 0xD7, 0x87, 0x26, 0xAD, 0xE2, 0x5A, 0xE1, 0x6D, 0x8F, 0xD7, 0xFB, 0xEE, 0x3D,
+    0xB2, 0x15, 0x1C, 0xC8, 0x2E, 0xF0, 0xA8, 0x8A, 0x5C, 0xB9, 0x90, 0x6F, 0x80, 0x18, 0x05, 0x5C,
+    0x00, 0x2F, 0x92, 0x1A, 0xDC, 0xEB, 0x7B, 0xC8, 0x38, 0x55, 0x24, 0x55, 0xAC, 0x21, 0xAD, 0x91,
+    0x56, 0xF6, 0xF3, 0xD7, 0x3B, 0xB7, 0x44, 0x52, 0x59, 0xE4, 0xA7, 0xE2, 0xBC, 0x22, 0x68, 0xE0,
+    0xD6, 0x36, 0xAA, 0x65, 0xDF, 0xBF, 0x81, 0xF7, 0x10, 0x3C, 0x2E, 0x02, 0x1E, 0x20, 0x0C, 0xB8,
+    0xBC, 0xCE, 0xF1, 0x41, 0x59, 0x70, 0xC2, 0x4F, 0xE0, 0xC5, 0xBE, 0x81, 0x7B, 0x23, 0xA3, 0x39,
+    0x31, 0xBC, 0x92, 0xD1, 0xA0, 0xDF, 0x55, 0xDE, 0xE3, 0x2A, 0xF8, 0xAC, 0x8E, 0xAE, 0xEA, 0x58,
+    0xF4, 0x45, 0x31, 0x72, 0xC2, 0xE1, 0x96, 0xCD, 0x82, 0x81, 0x50, 0xA0, 0x0C, 0xB7, 0x1F, 0x9E,
+    0xC8, 0x11, 0x40, 0xB5, 0xA4, 0x86, 0xA0, 0x83, 0x8D, 0xA2, 0x4B, 0x76, 0x9C, 0xAB, 0x5A, 0x09,
+    0x3B, 0x09, 0x7A, 0xA0, 0x14, 0x67, 0xE1, 0x4E, 0x9C, 0x69, 0x44, 0x69, 0x19, 0x91, 0x68, 0xCD,
+    0x79, 0x30, 0x23, 0x41, 0xC1, 0x22, 0xAC, 0xE3, 0xD6, 0x37, 0x00, 0xE6, 0x26, 0x6A, 0x83, 0x3E,
+    0xD0, 0xA9, 0xC6, 0x2C, 0xB2, 0xAA, 0xDA, 0xC7, 0x5E, 0xF1, 0x31, 0x76, 0xB2, 0xC7, 0xE3, 0x85,
+    0x00, 0x4F, 0x2F, 0x01, 0xBE, 0x07, 0xAF, 0x57, 0x75, 0xDC, 0x05, 0x83, 0xAA, 0xD3, 0xDE, 0x1F,
+    0xA2, 0xAC, 0xB4, 0xD9, 0x6D, 0xF1, 0xF1, 0x27, 0xF6, 0xB9, 0x8D, 0x11, 0xB6, 0xA9, 0x86, 0x02,
+    0x14, 0x02, 0x05, 0x06, 0x0F, 0x40, 0x15, 0xB1, 0x14, 0x34, 0x91, 0x8E, 0xDB, 0xA0, 0xF1, 0x0B,
+    0xB0, 0x80, 0xD5, 0xAF, 0x5D, 0x2C, 0xD3, 0x9C, 0xCA, 0xD2, 0x26, 0x4B, 0x7E, 0x9B, 0x79, 0xD6,
+    0x43, 0x2E, 0x58, 0x68, 0xEE, 0x0F, 0x50, 0x01, 0x4A, 0x71, 0x8B, 0xB1, 0x9F, 0xEE, 0x16, 0xB6,
+    0x61, 0x2B, 0x51, 0x13, 0x35, 0x30, 0x3C, 0xA2, 0xF5, 0xB1, 0x59, 0x49, 0x0D, 0x42, 0x1E, 0x30,
+    0x4F, 0x55, 0x52, 0xD6, 0x65, 0x3D, 0xDE, 0xF2, 0x22, 0x2F, 0x60, 0xF5, 0xDA, 0xC8, 0xE1, 0x5B,
+    0xEC, 0x0D, 0x72, 0x0C, 0x85, 0x41, 0xD2, 0xDE, 0xCA, 0xB7, 0xBB, 0x32, 0x0B, 0x5A, 0x50, 0x63,
+    0x25, 0x78, 0x32, 0x48, 0x88, 0xE8, 0x8B, 0xC0, 0x13, 0xC1, 0x0B, 0xF0, 0xF7, 0xB2, 0xB6, 0x1C,
+    0xAE, 0xC0, 0x05, 0xA0, 0x78, 0x3D, 0x12, 0x64, 0xCF, 0xA2, 0x11, 0xB2, 0xD6, 0x90, 0x20, 0xDB,
+    0xCD, 0x78, 0x5B, 0xE4, 0x3B, 0x3F, 0x14, 0xB9, 0xF0, 0x23, 0xF1, 0x4C, 0x9C, 0xBD, 0x52, 0x85,
+    0xC8, 0x1C, 0x29, 0xFF, 0x3A, 0x31, 0x0F, 0xE2, 0xA1, 0x40, 0x84, 0xB5, 0x67, 0xBE, 0x2B, 0xF2,
+    0xCB, 0x0B, 0x22, 0xE7, 0x5E, 0x15, 0x39, 0x3D, 0x89, 0xBA, 0x89, 0xFD, 0x61, 0x65, 0xA1, 0x4B,
+    0x2B, 0x17, 0x1F, 0xAE, 0x82, 0xBD, 0x03, 0x82, 0x7F, 0x7D, 0x88, 0x0F, 0xC7, 0x42, 0x27, 0x29,
+    0xD1, 0x11, 0xE3, 0x27, 0x95, 0xF8, 0x8F, 0x01, 0x38, 0x77, 0x51, 0x32, 0xAE, 0x22, 0xF2, 0x10,
+    0x3A, 0x0C, 0x9F, 0x23, 0x9F, 0x65, 0xBE, 0x1F, 0x0E, 0x26, 0xAF, 0xE8, 0x5F, 0x4F, 0x80, 0x32,
+    0xDC, 0x19, 0x07, 0xD0, 0xB5, 0x1C, 0xF3, 0xED, 0x0A, 0x4A, 0xE8, 0xF4, 0x68, 0x1A, 0x24, 0x76,
+    0x31, 0x41, 0x45, 0x39, 0x25, 0xA4, 0x4D, 0xA7, 0xDC, 0xFC, 0x38, 0x71, 0xF0, 0xE2, 0xB7, 0x27,
+    0x11, 0xF4, 0x85, 0xAB, 0xAF, 0x2F, 0x71, 0xB5, 0x35, 0x16, 0x59, 0xAE, 0x96, 0x6C, 0x1B, 0xAC,
+    0x86, 0x41, 0xFA, 0x44, 0x63, 0x35, 0x84, 0xB6, 0xB2, 0xFF, 0x42, 0x29, 0x1D, 0x6E, 0x15, 0xAC,
+    0xA9, 0x5C, 0x0D, 0xB1, 0x87, 0x41, 0xC0, 0xD5, 0xAC, 0xB9, 0xE4, 0x56, 0x0B, 0x86, 0x96, 0xAB,
+    0x61, 0x4B, 0x9A, 0x0E, 0xAB, 0x61, 0x91, 0x90, 0x48, 0x72, 0x87, 0x50, 0x5B, 0x40, 0x89, 0xD3,
+    0x6E, 0x8B, 0xDE, 0x02, 0xBD, 0xC4, 0x3E, 0x24, 0x63, 0xAD, 0xE4, 0x77, 0x06, 0x0C, 0x16, 0x6E,
+    0xA7, 0x81, 0xE3, 0x4B, 0xAB, 0xA9, 0x18, 0x3B, 0xBC, 0x64, 0x0B, 0xE0, 0xCA, 0xB7, 0x38, 0xDD,
+    0x9D, 0x6B, 0x58, 0xEC, 0x7D, 0x4E, 0x72, 0xC8, 0xC9, 0x55, 0x98, 0x9C, 0x63, 0x23, 0x70, 0x28,
+    0x2C, 0xD2, 0xCB, 0x49, 0x13, 0x02, 0x67, 0x2C, 0xE9, 0x88, 0x83, 0x31, 0x46, 0x38, 0x85, 0xE2,
+    0xF2, 0x69, 0xA6, 0x1D, 0x25, 0x7B, 0x58, 0xD5, 0x1F, 0x6E, 0x20, 0x14, 0x0D, 0xAC, 0x84, 0x17,
+    0x9E, 0x66, 0x47, 0xFB, 0x8F, 0xA9, 0x95, 0xA1, 0x64, 0xAA, 0xAA, 0xFE, 0x04, 0x1A, 0x5C, 0x0D,
+    0x44, 0x15, 0x77, 0x71, 0x46, 0xAF, 0x8D, 0x0F, 0x29, 0xCC, 0x09, 0x64, 0x33, 0x33, 0x35, 0x34,
+    0x14, 0x16, 0x8E, 0x3D, 0x89, 0x7F, 0x6B, 0x5C, 0x23, 0xB4, 0xB5, 0x78, 0x0C, 0x93, 0x23, 0x7A,
+    0x65, 0x47, 0xF4, 0xFA, 0x16, 0x73, 0xB6, 0x1B, 0xE9, 0xE0, 0xE6, 0x32, 0x68, 0x90, 0x31, 0x5E,
+    0xD9, 0x32, 0x69, 0xD0, 0xD4, 0x30, 0x6F, 0xF0, 0x53, 0xA4, 0xEF, 0xD9, 0xF8, 0x6F, 0xB6, 0x3A,
+    0x2D, 0xF6, 0x27, 0x4E, 0x24, 0xAC, 0xC6, 0x0F, 0x12, 0x97, 0xF0, 0x04, 0xB8, 0xF6, 0xF9, 0x00,
+    0xC8, 0x07, 0xB1, 0x58, 0x3D, 0x6F, 0xA0, 0x04, 0x76, 0x13, 0xAF, 0xD0, 0x3E, 0x0D, 0xCE, 0x4C,
+    0x2A, 0x0B, 0x4B, 0xC3, 0xE6, 0x6B, 0xD5, 0x8D, 0x19, 0x46, 0x78, 0x82, 0xB8, 0xC4, 0xB8, 0x1C,
+    0x53, 0xC6, 0x49, 0xE5, 0x0F, 0xB2, 0x2D, 0xAD, 0x5D, 0xC2, 0x2D, 0x56, 0xF5, 0x13, 0x56, 0xE3,
+    0xDE, 0x73, 0xED, 0x1E, 0x74, 0x80, 0x72, 0x40, 0x0F, 0xE8, 0xB6, 0xCD, 0x7D, 0xB4, 0xDB, 0x74,
+    0x91, 0xE5, 0x7A, 0xD1, 0x00, 0x6C, 0x84, 0x5E, 0xC4, 0x34, 0xAB, 0x23, 0xA7, 0x15, 0xF1, 0xB3,
+    0xA3, 0x42, 0xFC, 0x6A, 0x7E, 0x93, 0xFA, 0xEB, 0xFA, 0x38, 0x50, 0x61, 0x96, 0x41, 0x1B, 0x18,
+    0xE1, 0x20, 0x8B, 0xBA, 0xC0, 0x26, 0xA8, 0x72, 0x72, 0xA5, 0x32, 0x73, 0xFB, 0xED, 0x3D, 0xE6,
+    0xBF, 0xBD, 0x0E, 0x24, 0x10, 0xFB, 0xE3, 0xFE, 0x4A, 0x0B, 0x95, 0x8A, 0xA8, 0x25, 0x20, 0xE3,
+    0xEE, 0x40, 0x95, 0xF0, 0x98, 0xA3, 0x3A, 0x41, 0x79, 0x54, 0x1F, 0x80, 0x0D, 0x70, 0x4D, 0xD2,
+    0x06, 0xC0, 0xC6, 0x85, 0xA0, 0x09, 0x43, 0xDD, 0x88, 0xFD, 0x0F, 0xCF, 0x5C, 0xA2, 0x26, 0x0E,
+    0x5C, 0xEB, 0x70, 0x70, 0x77, 0x4A, 0x2A, 0x68, 0xDC, 0x1A, 0x2B, 0x00, 0xF7, 0xA7, 0x9B, 0x49,
+    0x28, 0xCF, 0x85, 0x13, 0xC3, 0x88, 0x48, 0x05, 0x81, 0x7E, 0x3F, 0x06, 0x0A, 0x71, 0x9A, 0x5D,
+    0xAE, 0x03, 0xB3, 0xF1, 0x55, 0x30, 0xB5, 0x0F, 0x6A, 0x6C, 0x9C, 0x1B, 0x55, 0xDA, 0xEE, 0x62,
+    0x62, 0x7B, 0xD0, 0x00, 0xB2, 0xCF, 0x20, 0x3E, 0x27, 0x4F, 0x0B, 0xAA, 0x2F, 0x26, 0x27, 0xE5,
+    0x62, 0x22, 0xC7, 0xA2, 0xEF, 0x9F, 0xA5, 0xBF, 0xEC, 0x00, 0x50, 0x19, 0x20, 0x6A, 0x50, 0xB6,
+    0xDD, 0x22, 0xE5, 0xCF, 0xA0, 0xF9, 0x1D, 0xF9, 0xC8, 0x0F, 0x90, 0xE8, 0x2D, 0x30, 0x1C, 0xC7,
+    0x9B, 0x8A, 0x47, 0x20, 0x34, 0x25, 0x2D, 0xA8, 0xFB, 0x2F, 0xD4, 0xDA, 0xF1, 0xB8, 0x54, 0x97,
+    0xF6, 0xE9, 0x84, 0x74, 0x63, 0x92, 0x9C, 0x00, 0x6D, 0xA1, 0x70, 0xAB, 0x47, 0xD8, 0x51, 0xFB,
+    0xA8, 0x59, 0x87, 0xDD, 0x18, 0x18, 0x44, 0xD5, 0x4E, 0xF4, 0xC4, 0x48, 0xFA, 0x10, 0x95, 0xE6,
+    0x1E, 0x36, 0x2A, 0xA3, 0x73, 0xF6, 0x1C, 0x5E, 0x44, 0x5D, 0xDC, 0xA1, 0x6A, 0xEE, 0x1D, 0xDD,
+    0x9D, 0x5D, 0xB8, 0x90, 0xD7, 0x78, 0xB0, 0xD9, 0x9A, 0x1F, 0xA7, 0x4C, 0x52, 0x28, 0x2A, 0x44,
+    0x7A, 0x21, 0xD4, 0x0B, 0xB1, 0x5E, 0x56, 0xC0, 0xFE, 0xFF, 0xF0, 0x61, 0xE9, 0x11, 0xD6, 0x1E,
+    0x61, 0xF1, 0x11, 0x56, 0x1F, 0x71, 0xE5, 0x67, 0x59, 0x7F, 0x66, 0x5C, 0x73, 0x37, 0x42, 0xCD,
+    0x6D, 0x36, 0x95, 0xF6, 0x56, 0x46, 0x6D, 0x6F, 0xD5, 0xF2, 0x8A, 0x25, 0x64, 0xF0, 0x16, 0xDA,
+    0xAB, 0xC0, 0xB4, 0x2F, 0x19, 0x42, 0x7F, 0x64, 0x2C, 0x11, 0x5A, 0x16, 0x0E, 0x00, 0xFD, 0xB9,
+    0x8C, 0xB8, 0xBF, 0x1C, 0x56, 0xF2, 0xB6, 0x15, 0x32, 0xAE, 0x1E, 0x71, 0x02, 0x3C, 0x2A, 0xCE,
+    0xA5, 0x18, 0x36, 0x10, 0xA7, 0x77, 0x24, 0xFA, 0x0A, 0x2C, 0xE9, 0x63, 0xA4, 0x60, 0x74, 0xB7,
+    0x93, 0xC9, 0xB1, 0x32, 0x39, 0x33, 0xCF, 0x72, 0xE4, 0xD6, 0x00, 0x42, 0x0F, 0x87, 0xB3, 0xDF,
+    0x99, 0x69, 0x9B, 0x5C, 0x14, 0x2F, 0x01, 0xF1, 0xF0, 0x48, 0xB6, 0x7A, 0x86, 0x73, 0xF8, 0x59,
+    0x9F, 0x94, 0xE4, 0x2E, 0x60, 0xEA, 0x1A, 0x4E, 0xC9, 0x3E, 0x37, 0x83, 0x36, 0x9F, 0x98, 0x2D,
+    0xF6, 0xEC, 0x80, 0x85, 0xDE, 0xC1, 0xA9, 0xD5, 0xEE, 0x79, 0x5D, 0xEA, 0x4E, 0xC8, 0x8D, 0xCA,
+    0xCE, 0xE2, 0x47, 0xA3, 0xB6, 0xAE, 0x4F, 0x15, 0xCE, 0xDB, 0x19, 0x29, 0x67, 0xFF, 0x72, 0xA5,
+    0x8E, 0x0A, 0x31, 0x3F, 0x80, 0x2F, 0xE1, 0xCF, 0x73, 0xDF, 0x63, 0xA2, 0x05, 0x68, 0xB8, 0x02,
+    0x9D, 0x85, 0x9F, 0x7C, 0x61, 0xE2, 0x27, 0x8F, 0x9A, 0x80, 0x5E, 0xC2, 0xD4, 0xCB, 0xD6, 0x1E,
+    0xF0, 0xD4, 0x4D, 0x42, 0x6C, 0xF3, 0xA0, 0x58, 0x45, 0x5F, 0x7D, 0x69, 0xA2, 0x07, 0x0F, 0x8D,
+    0xBF, 0xAD, 0x2B, 0xCE, 0x73, 0xD8, 0xE6, 0xD0, 0x8B, 0x40, 0x46, 0x4C, 0x53, 0x7A, 0x1C, 0x1F,
+    0x6D, 0xF3, 0xCF, 0x8E, 0x10, 0x28, 0x79, 0x3D, 0x52, 0x5A, 0x3C, 0x6B, 0x9B, 0xE9, 0x11, 0xCE,
+    0x77, 0x72, 0x6A, 0x1E, 0x0A, 0xD9, 0xE2, 0xE7, 0x6F, 0x34, 0x52, 0xC6, 0xC6, 0xB2, 0xBF, 0x4D,
+    0x3E, 0xC5, 0x59, 0x23, 0xE8, 0xD4, 0x75, 0x98, 0x19, 0x9A, 0x3C, 0x32, 0x6C, 0x71, 0xBB, 0x18,
+    0x9E, 0x4F, 0xAE, 0xB5, 0x0A, 0xC5, 0x78, 0xD3, 0xBF, 0xB1, 0xB9, 0xBE, 0x27, 0x33, 0xA2, 0xA6,
+    0x0E, 0xFC, 0x94, 0x3E, 0xBC, 0x8F, 0x4F, 0xBC, 0x67, 0x86, 0x19, 0xB5, 0x5C, 0x2F, 0xA8, 0x67,
+    0x62, 0x9C, 0x96, 0x8D, 0xBB, 0x1B, 0x6A, 0x1B, 0xD5, 0xCF, 0x0F, 0xCF, 0xB1, 0x4B, 0x58, 0x5D,
+    0x45, 0x39, 0x6E, 0xE8, 0xEF, 0xF4, 0x40, 0xCF, 0xC8, 0xF6, 0xE6, 0x88, 0xCC, 0xF1, 0xC9, 0xF3,
+    0x65, 0x46, 0xC5, 0x8A, 0x34, 0x73, 0x38, 0x8E, 0x8A, 0xE7, 0xCF, 0xA1, 0x9E, 0xE8, 0xFD, 0x9D,
+    0xFC, 0xC3, 0x55, 0x12, 0xB3, 0x41, 0x5D, 0x0A, 0x1E, 0x9F, 0x73, 0xBC, 0x55, 0xD5, 0xE2, 0xB9,
+    0x12, 0x66, 0x8E, 0xF5, 0xB1, 0x69, 0x43, 0xA7, 0xE2, 0x8E, 0x65, 0xF3, 0xC8, 0x35, 0x0B, 0xCF,
+    0xF8, 0x2C, 0x26, 0x1B, 0x9D, 0x89, 0xE9, 0x78, 0x73, 0x7F, 0x2E, 0x9E, 0xE7, 0x6A, 0x07, 0xDC,
+    0x93, 0x64, 0x77, 0x73, 0x69, 0xF3, 0x96, 0xF3, 0x9A, 0x4B, 0x1E, 0xD7, 0x8D, 0xDC, 0x8C, 0xF4,
+    0x46, 0x16, 0xF4, 0x91, 0x56, 0xA8, 0x0F, 0x91, 0xCE, 0xF5, 0x38, 0xF6, 0xDB, 0x48, 0xBB, 0x3D,
+    0xD1, 0x4B, 0x4E, 0x77, 0x77, 0xFF, 0x2A, 0xEA, 0x57, 0xEF, 0x53, 0x2B, 0xB4, 0xC2, 0xE3, 0x61,
+    0x6E, 0xE2, 0x64, 0xE6, 0xA3, 0xCC, 0x7A, 0x1C, 0x8F, 0xCF, 0x67, 0xCE, 0x70, 0x8C, 0x95, 0x4A,
+    0x61, 0x4D, 0x55, 0x6F, 0x64, 0x4B, 0x0F, 0xE3, 0x89, 0x32, 0x4A, 0xCF, 0x4F, 0x3C, 0x3C, 0xC9,
+    0x1D, 0xCF, 0x7A, 0x76, 0x0A, 0x85, 0x87, 0xBD, 0x3F, 0xFB, 0x90, 0x33, 0xD3, 0x98, 0x9D, 0xD4,
+    0xA6, 0x3B, 0x11, 0xD8, 0xEA, 0x3C, 0xC6, 0xE7, 0xA7, 0x31, 0x0F, 0x76, 0x87, 0x47, 0xFF, 0x6F,
+    0xF0, 0x8F, 0x86, 0x97, 0xC7, 0xEB, 0xB8, 0x33, 0x54, 0x97, 0xB6, 0xB1, 0x09, 0xEB, 0xA0, 0x3A,
+    0x0E, 0x3F, 0x67, 0x78, 0x59, 0x80, 0x2E, 0x3E, 0x36, 0x69, 0xAB, 0xBA, 0xE3, 0xCD, 0xF0, 0x8B,
+    0x48, 0x5F, 0x38, 0x77, 0xE1, 0x5C, 0xA4, 0x8F, 0xB7, 0x0A, 0x6B, 0xF7, 0x37, 0xB3, 0xFC, 0xDF,
+    0x5D, 0x54, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0x11, 0x19, 0x09, 0x4B, 0xCC, 0x0F, 0xA0,
+    0x98, 0x1A, 0x21, 0x65, 0xFE, 0x40, 0x58, 0x3B, 0x49, 0x41, 0x91, 0x02, 0x9A, 0x40, 0x99, 0x0A,
+    0x8A, 0x6B, 0xD2, 0x82, 0xC4, 0xAD, 0x1D, 0xAE, 0xA0, 0x48, 0xC1, 0x76, 0x94, 0xA1, 0x48, 0x71,
+    0x2C, 0xC5, 0x35, 0x14, 0x29, 0xEE, 0xD6, 0x56, 0x28, 0xAE, 0xA0, 0x99, 0xEE, 0x4A, 0x8C, 0xC2,
+    0xE9, 0x10, 0x14, 0x3B, 0x41, 0x83, 0xE2, 0x4B, 0xBC, 0x3B, 0x7C, 0x6F, 0x77, 0xC9, 0x29, 0xD8,
+    0xCF, 0x92, 0xE7, 0xCD, 0x9B, 0x37, 0xF3, 0xBE, 0xEF, 0x7B, 0x83, 0xBA, 0x51, 0x29, 0x14, 0x29,
+    0x9A, 0x67, 0x83, 0x7B, 0x3A, 0x96, 0x07, 0x43, 0x79, 0x9B, 0x16, 0x6B, 0x1D, 0xCA, 0x8F, 0x42,
+    0x99, 0xBC, 0x4B, 0x4D, 0xB1, 0x02, 0x9F, 0x6C, 0xA6, 0x82, 0xF2, 0x80, 0xE9, 0x4C, 0x67, 0x1B,
+    0x57, 0x95, 0x28, 0x31, 0xC1, 0x3E, 0x8E, 0x71, 0xC8, 0xC9, 0x43, 0xE8, 0x11, 0x66, 0x44, 0x39,
+    0x20, 0xC5, 0xFC, 0x45, 0x2C, 0xCE, 0x82, 0x7D, 0x18, 0xCA, 0xA3, 0xA1, 0x4E, 0xE3, 0x5E, 0x3B,
+    0xC0, 0x76, 0x70, 0x4D, 0x3E, 0xFF, 0x5E, 0xCB, 0x66, 0xC1, 0x34, 0x30, 0x15, 0x6C, 0xA2, 0x75,
+    0xB0, 0x1E, 0x46, 0xEC, 0xBC, 0xEE, 0x52, 0x02, 0x63, 0xE5, 0x79, 0x37, 0x66, 0x69, 0xD0, 0xEB,
+    0xC8, 0x19, 0xD7, 0xA0, 0x6C, 0xBB, 0x32, 0x85, 0xFA, 0xC3, 0x50, 0xAB, 0x50, 0xF2, 0x64, 0x8F,
+    0x7A, 0x2E, 0xD4, 0x6B, 0x09, 0xBC, 0x36, 0xFF, 0xC1, 0xA4, 0x95, 0x49, 0x23, 0xD4, 0x80, 0x22,
+    0x48, 0xAA, 0xB2, 0x41, 0x0B, 0xAC, 0xAE, 0x1C, 0xCC, 0x80, 0xB6, 0xE1, 0xD6, 0xE6, 0x22, 0x9A,
+    0xA7, 0x83, 0x79, 0x16, 0x74, 0xF2, 0x3A, 0x55, 0x2E, 0xF9, 0xDA, 0x84, 0x45, 0x11, 0x5A, 0xD3,
+    0xD7, 0xA9, 0xB3, 0x9B, 0x84, 0x58, 0x54, 0x3A, 0xF5, 0xE6, 0x55, 0x74, 0x5F, 0x0F, 0xE5, 0x2D,
+    0x81, 0xC3, 0x2D, 0xA3, 0x49, 0x31, 0xFB, 0x4E, 0x72, 0x7D, 0xD6, 0x76, 0xF5, 0x1A, 0xF5, 0xEF,
+    0x1B, 0x44, 0x3C, 0xB2, 0x5E, 0x6C, 0xEF, 0x65, 0xD5, 0xA6, 0xEE, 0x93, 0xF3, 0x6A, 0x3B, 0xCC,
+    0x66, 0xB8, 0x7B, 0x17, 0x29, 0x35, 0xF3, 0x79, 0xC5, 0x30, 0x66, 0xDE, 0x9B, 0x37, 0xDB, 0x1F,
+    0x9A, 0xAC, 0xFC, 0x0A, 0x51, 0xF5, 0x45, 0x67, 0x2A, 0x4B, 0x08, 0x3F, 0xC0, 0x0D, 0x3A, 0xE4,
+    0xBD, 0xC1, 0xFF, 0xEB, 0xB0, 0x12, 0x11, 0x10, 0xF1, 0x64, 0xE7, 0x96, 0xF7, 0x18, 0x03, 0x62,
+    0x4E, 0x02, 0x8A, 0xC6, 0x72, 0xB8, 0x79, 0xD4, 0x2F, 0x41, 0x2F, 0x47, 0x1D, 0xC6, 0xC2, 0x8F,
+    0xA6, 0x1B, 0xCC, 0x83, 0xC1, 0xDE, 0x8C, 0x2E, 0x0F, 0xA5, 0x0A, 0xEF, 0xE5, 0x33, 0xB4, 0x95,
+    0x62, 0x1D, 0x29, 0xB8, 0xB3, 0x58, 0x1E, 0x44, 0xE1, 0x54, 0xC5, 0x56, 0xB3, 0xD6, 0xD0, 0x5A,
+    0x29, 0xB7, 0x4C, 0x30, 0x5B, 0xB0, 0xAF, 0xCD, 0x50, 0xFB, 0x9C, 0x00, 0xA4, 0x8E, 0x74, 0xBF,
+    0x53, 0x56, 0xA0, 0xD5, 0x10, 0x14, 0xD7, 0x02, 0x64, 0x36, 0x8A, 0xE1, 0xBE, 0x57, 0x69, 0x50,
+    0x69, 0xCC, 0x1E, 0x6C, 0x5C, 0x8A, 0x84, 0x07, 0x94, 0x5D, 0xB6, 0x46, 0x11, 0x51, 0xA6, 0x28,
+    0x14, 0xA5, 0x80, 0xA3, 0x99, 0x4E, 0x51, 0xBD, 0x1A, 0x33, 0xC6, 0xE4, 0x03, 0x8E, 0x42, 0x96,
+    0xAA, 0xEC, 0xA8, 0x87, 0x0E, 0xB4, 0x2F, 0xEF, 0x33, 0xA6, 0x73, 0x5B, 0xA4, 0xF3, 0x8D, 0x6A,
+    0xEC, 0x4E, 0x35, 0xEA, 0x45, 0x28, 0x4E, 0x83, 0xBB, 0xD3, 0xD7, 0x3B, 0xD5, 0xFC, 0x01, 0xF7,
+    0x7F, 0xD5, 0xD8, 0x0A, 0x2E, 0xD1, 0x5E, 0xAB, 0xA6, 0x7B, 0x43, 0x35, 0xEF, 0xC7, 0x3C, 0xC5,
+    0x62, 0x1D, 0x38, 0x29, 0x45, 0x90, 0xAB, 0xD4, 0x53, 0x35, 0x53, 0x15, 0xA6, 0x54, 0xCD, 0x3D,
+    0x11, 0xB3, 0xDE, 0x88, 0xF9, 0xED, 0xF9, 0xA1, 0x4D, 0xA3, 0x13, 0xD5, 0x90, 0xD5, 0x5E, 0xE4,
+    0xC9, 0x05, 0x6B, 0xE4, 0x74, 0x44, 0x29, 0xCB, 0x6D, 0x1C, 0x2C, 0x39, 0x67, 0xC9, 0x97, 0x02,
+    0xB2, 0x7A, 0x3E, 0xE6, 0x89, 0xB5, 0x74, 0x84, 0x74, 0xD7, 0x26, 0xDF, 0x44, 0x27, 0x07, 0x13,
+    0x6E, 0xB3, 0x45, 0x55, 0x24, 0x6F, 0xFF, 0x0A, 0xE5, 0x6D, 0xE2, 0x1F, 0xC5, 0x96, 0xC1, 0x32,
+    0xFE, 0x8E, 0x24, 0xFF, 0x3C, 0x55, 0xED, 0x0A, 0x6D, 0xBF, 0x29, 0xBA, 0x43, 0xEE, 0xC5, 0x7E,
+    0xFC, 0xB3, 0xA2, 0x46, 0x3E, 0x3D, 0xDF, 0x0D, 0xB3, 0xE6, 0x0D, 0xD5, 0xB4, 0x57, 0xAA, 0x69,
+    0xDA, 0xAD, 0x6A, 0xBE, 0xC8, 0x36, 0xFC, 0x1B, 0x38, 0xEA, 0x64, 0x2B, 0x0A, 0x79, 0xFF, 0xD3,
+    0x0D, 0x44, 0x7B, 0x5B, 0xDD, 0x6C, 0x27, 0x9E, 0x88, 0x66, 0xB8, 0xA6, 0xD7, 0x54, 0xDA, 0x75,
+    0x3A, 0xB8, 0xF9, 0xF0, 0x93, 0x28, 0x82, 0x9D, 0xA9, 0xFA, 0xA9, 0xF2, 0x27, 0xBA, 0x3B, 0x36,
+    0xDD, 0xC2, 0x11, 0xA7, 0xC6, 0x7E, 0x5B, 0x65, 0xAD, 0x14, 0xE1, 0x0E, 0xFA, 0x89, 0xF6, 0x64,
+    0xA9, 0xBD, 0x94, 0x35, 0x8B, 0x8C, 0xDC, 0xA2, 0xB8, 0x04, 0x79, 0x36, 0xA4, 0xEE, 0x61, 0xCF,
+    0xB5, 0xFB, 0xAA, 0x3F, 0xD6, 0xFD, 0x71, 0xE1, 0xA7, 0x56, 0x74, 0x54, 0x0C, 0xC8, 0x83, 0x43,
+    0x1E, 0x4F, 0x28, 0x17, 0x52, 0x21, 0x95, 0xD6, 0xD2, 0x74, 0x15, 0x28, 0x2B, 0xE8, 0x0B, 0x0F,
+    0xFB, 0x33, 0xB5, 0x92, 0x07, 0x8E, 0xA5, 0xBD, 0xDE, 0x22, 0xEC, 0x79, 0x20, 0x9E, 0x84, 0x88,
+    0xE9, 0x26, 0x86, 0xC2, 0xAB, 0x98, 0x05, 0x8F, 0x91, 0x31, 0x57, 0xE4, 0x24, 0xD4, 0x45, 0x4F,
+    0xB1, 0xE9, 0xB8, 0x95, 0xF7, 0x68, 0x9A, 0x2B, 0x79, 0x4F, 0x54, 0xCF, 0x48, 0x64, 0x11, 0x12,
+    0x2B, 0x1C, 0xF2, 0x9B, 0x42, 0xFD, 0x36, 0x42, 0x9F, 0x05, 0x14, 0xBF, 0xF2, 0x7E, 0x49, 0xD8,
+    0x7C, 0x76, 0xD9, 0xC0, 0x19, 0xB2, 0xA9, 0x7B, 0x4C, 0x24, 0xF0, 0x71, 0x36, 0x64, 0xD2, 0x49,
+    0x82, 0x8B, 0x67, 0x0F, 0x76, 0xA6, 0xB1, 0x95, 0x5C, 0x67, 0x13, 0xE4, 0xA7, 0xFD, 0x02, 0x6A,
+    0xF9, 0x92, 0x47, 0x8C, 0xE9, 0x5E, 0x53, 0xF8, 0x95, 0x69, 0xB8, 0xB3, 0x6D, 0xA4, 0xB5, 0x2A,
+    0x7B, 0x2B, 0x3A, 0xC8, 0xFE, 0x90, 0x13, 0x30, 0x99, 0xDF, 0x87, 0x3A, 0xED, 0xF5, 0x72, 0x28,
+    0xFE, 0x79, 0xDD, 0x82, 0x51, 0xA2, 0x76, 0x67, 0xF4, 0xF8, 0x7B, 0xC8, 0xD2, 0x2A, 0x1F, 0x6B,
+    0x71, 0x10, 0x36, 0x4F, 0x5C, 0x4F, 0x8A, 0xE7, 0x23, 0x29, 0x30, 0x8F, 0x1A, 0xD1, 0x32, 0x78,
+    0x89, 0x8A, 0xE5, 0x82, 0x6D, 0xE5, 0x6E, 0xCA, 0x55, 0xC5, 0xA6, 0xE4, 0x90, 0xFD, 0xF7, 0x71,
+    0x0D, 0xAA, 0xA6, 0xE6, 0x85, 0xE2, 0x55, 0x67, 0x57, 0xF5, 0xEA, 0xEA, 0xDA, 0x9D, 0xA2, 0x0E,
+    0xCE, 0xFF, 0x0B, 0x6D, 0x57, 0x3D, 0x8C, 0xD5, 0xD8, 0x15, 0x3E, 0xB6, 0x03, 0x5E, 0xAD, 0xA3,
+    0x98, 0x62, 0x57, 0x48, 0x20, 0xAD, 0x9B, 0x54, 0x9B, 0xC2, 0x52, 0xEA, 0x5D, 0xAE, 0xD9, 0x95,
+    0xB2, 0x05, 0x05, 0x53, 0x80, 0xB6, 0xA0, 0xA0, 0xA7, 0xA1, 0x49, 0x91, 0x02, 0xC5, 0xD6, 0x50,
+    0x6C, 0x31, 0x0D, 0x52, 0xC2, 0xD6, 0xDB, 0x6D, 0x96, 0x2D, 0x06, 0x29, 0x5B, 0x44, 0xCA, 0x22,
+    0x1B, 0xA6, 0x40, 0x0A, 0x8D, 0x03, 0x51, 0x50, 0x44, 0x81, 0x41, 0x4B, 0x50, 0x48, 0x31, 0x17,
+    0x30, 0x60, 0x1E, 0x7E, 0x3E, 0xF9, 0xBE, 0x7B, 0xFD, 0xDE, 0x9B, 0x22, 0x6F, 0xF4, 0xCE, 0x9D,
+    0x67, 0xFB, 0x9E, 0x7B, 0x7E, 0xBE, 0xF3, 0x9D, 0x63, 0x11, 0x7E, 0x32, 0x2D, 0x44, 0x54, 0x1B,
+    0x89, 0x14, 0xFF, 0x25, 0xD3, 0x39, 0x5C, 0xEA, 0x71, 0x3D, 0xEF, 0x20, 0x4C, 0x73, 0xED, 0x9A,
+    0x98, 0x9B, 0xAA, 0x52, 0xDE, 0xD2, 0x49, 0xCA, 0x3D, 0x5D, 0x42, 0x8C, 0xB8, 0xF1, 0x74, 0x80,
+    0x50, 0x1D, 0x24, 0x55, 0xED, 0x25, 0x54, 0xB5, 0x22, 0x29, 0xBE, 0x92, 0x72, 0x5F, 0xF6, 0x64,
+    0x0B, 0x1A, 0xB4, 0xE3, 0x33, 0x2D, 0x45, 0x23, 0xF3, 0x27, 0xB0, 0x78, 0x28, 0xBC, 0x8B, 0x3B,
+    0x17, 0x71, 0x27, 0xE6, 0x3E, 0xA8, 0xE9, 0x60, 0x41, 0xDD, 0x84, 0xBA, 0xCC, 0xAA, 0x58, 0x3F,
+    0xF9, 0x54, 0xD2, 0xF1, 0x77, 0x97, 0x60, 0x46, 0xFF, 0x83, 0xE4, 0xCF, 0xB1, 0xC1, 0x3C, 0x7E,
+    0xD4, 0x89, 0xB9, 0xB7, 0xD7, 0x8A, 0xB9, 0xFF, 0x55, 0x23, 0xE6, 0xE1, 0xA9, 0x0A, 0xBB, 0x52,
+    0x1C, 0x31, 0x7D, 0x84, 0xC3, 0xA6, 0x13, 0xD7, 0x69, 0x86, 0xA5, 0x0B, 0x56, 0x02, 0xAA, 0x0B,
+    0xFF, 0x0D, 0x1F, 0x22, 0x6C, 0x90, 0x70, 0xBB, 0x5A, 0x9D, 0x2D, 0xF5, 0x04, 0x0F, 0x79, 0x1B,
+    0x47, 0xB6, 0xA2, 0x8B, 0x5D, 0x1C, 0xD9, 0x04, 0x45, 0xA4, 0xB8, 0x97, 0x8C, 0x34, 0x7E, 0xA0,
+    0xF1, 0xF6, 0xE3, 0x4C, 0x72, 0x6B, 0x4A, 0x31, 0x5D, 0xA9, 0x10, 0xF5, 0x7F, 0xC4, 0xB4, 0x78,
+    0xC6, 0xB4, 0x13, 0xC4, 0xA3, 0x25, 0xC4, 0x0B, 0x88, 0xFC, 0xF5, 0x78, 0x04, 0xE7, 0x4E, 0x96,
+    0x3A, 0xED, 0x1C, 0x83, 0x52, 0xAF, 0xC0, 0xC9, 0x2D, 0x17, 0x58, 0x78, 0x9D, 0x53, 0x98, 0x59,
+    0x14, 0x52, 0x32, 0x0E, 0x4E, 0xD4, 0xB4, 0x8A, 0xA1, 0x17, 0xBD, 0x7A, 0x86, 0x36, 0x8F, 0x54,
+    0x30, 0xD0, 0x85, 0x5E, 0x22, 0x68, 0x97, 0x88, 0x06, 0x1D, 0x5F, 0x42, 0x55, 0x8D, 0x4B, 0xE2,
+    0xB4, 0x9F, 0x7F, 0xB5, 0x35, 0x87, 0x39, 0xB3, 0xAB, 0x1C, 0xCD, 0x9F, 0x84, 0x07, 0x97, 0xAB,
+    0x27, 0x43, 0xFD, 0xBA, 0x93, 0x08, 0xE6, 0x4A, 0x3C, 0xCE, 0xCE, 0x05, 0xBB, 0xD3, 0x77, 0x3C,
+    0x63, 0xC9, 0x33, 0x46, 0xAF, 0x21, 0xB8, 0x08, 0x85, 0x09, 0xCF, 0x4D, 0x78, 0xEE, 0xC6, 0xB4,
+    0x90, 0x5B, 0xB3, 0xE9, 0xDA, 0x77, 0xF4, 0x60, 0xA2, 0xF1, 0x4B, 0x8A, 0xD1, 0xE7, 0x70, 0xCB,
+    0x2D, 0xA9, 0x4F, 0x6A, 0x56, 0xB8, 0xC5, 0xE0, 0x3B, 0xE6, 0x3D, 0x9E, 0x0B, 0xC6, 0x7A, 0x02,
+    0x62, 0x42, 0x08, 0xD5, 0x2A, 0xD2, 0xFB, 0xFA, 0x4A, 0x9B, 0x48, 0x03, 0x6D, 0xCA, 0x26, 0x9A,
+    0x02, 0x2D, 0xCA, 0x26, 0x1E, 0x43, 0xC5, 0x39, 0xC9, 0x80, 0x73, 0xB4, 0x48, 0x7B, 0x38, 0x8C,
+    0xC5, 0xC2, 0x4C, 0x85, 0x5D, 0xD9, 0x18, 0x28, 0x13, 0xC0, 0xBB, 0x79, 0x57, 0xF3, 0xAE, 0xF9,
+    0xBB, 0xF6, 0x08, 0x88, 0xD9, 0x53, 0x0B, 0x87, 0xCA, 0x3B, 0xFB, 0x5C, 0x24, 0xAB, 0xD6, 0x47,
+    0xE3, 0x73, 0x43, 0x0E, 0x7E, 0x4C, 0x9B, 0xB4, 0x52, 0x76, 0x30, 0xB2, 0xA6, 0x50, 0x9B, 0x51,
+    0xE4, 0x95, 0x4C, 0xD6, 0x14, 0xC1, 0xC2, 0x1A, 0xB8, 0xBC, 0xA8, 0xAF, 0x20, 0x4B, 0xDA, 0x1E,
+    0x5F, 0x2C, 0xA6, 0x2A, 0x7A, 0xDE, 0x2F, 0xE5, 0xF8, 0xEB, 0xB7, 0x40, 0x38, 0xAE, 0x15, 0x14,
+    0x70, 0x71, 0xD1, 0x4B, 0xD6, 0xBC, 0xB3, 0x92, 0x57, 0x3A, 0x0B, 0x53, 0xD4, 0x00, 0x90, 0xD4,
+    0xD0, 0x2E, 0x75, 0x43, 0x0C, 0xBA, 0x00, 0x18, 0xC6, 0x8F, 0x0B, 0x73, 0x47, 0x15, 0x0E, 0x70,
+    0x27, 0x7D, 0x8A, 0x45, 0x4F, 0x6E, 0xB9, 0xE5, 0xF3, 0x0E, 0xB9, 0x16, 0x3D, 0xD5, 0x22, 0x3C,
+    0xA1, 0xA6, 0x58, 0x96, 0xC9, 0x54, 0x32, 0x4A, 0x8A, 0x70, 0x01, 0x89, 0xFA, 0x02, 0x3B, 0x51,
+    0x16, 0x55, 0xC9, 0x62, 0xFC, 0xA3, 0xD4, 0x88, 0x33, 0x73, 0xEA, 0xD3, 0x3E, 0x2F, 0x48, 0x4E,
+    0x06, 0x45, 0x58, 0xF2, 0x16, 0xFA, 0x10, 0x17, 0xD8, 0x31, 0x2F, 0xE5, 0xE0, 0x73, 0x44, 0x23,
+    0xBC, 0x65, 0x35, 0x91, 0xC3, 0xC5, 0x65, 0x4F, 0xBD, 0x81, 0xEA, 0xC0, 0x11, 0x60, 0x89, 0xB5,
+    0x85, 0x2D, 0x53, 0xAE, 0x36, 0x9A, 0x22, 0xD8, 0xD2, 0x45, 0xCB, 0x64, 0x59, 0x9F, 0x44, 0xAA,
+    0xEA, 0x11, 0xE7, 0xB1, 0x44, 0xB5, 0x22, 0x3E, 0x2A, 0xF8, 0x8D, 0x32, 0x13, 0xB3, 0x84, 0x11,
+    0x88, 0x0D, 0x53, 0xA5, 0x45, 0xA8, 0x55, 0x66, 0x01, 0x99, 0xBA, 0xC9, 0xBB, 0xB2, 0x92, 0xB2,
+    0x32, 0x6D, 0xF9, 0x37, 0xE4, 0xD6, 0x34, 0xE6, 0x0E, 0x79, 0xA3, 0x31, 0x0F, 0x70, 0x22, 0x7E,
+    0x3F, 0xF5, 0x01, 0x92, 0x43, 0x40, 0x57, 0x1F, 0x0E, 0xC1, 0x10, 0xF5, 0x11, 0xBF, 0x7D, 0x32,
+    0x44, 0x36, 0xB2, 0xE9, 0x90, 0x74, 0x91, 0xCD, 0x86, 0xB4, 0x8D, 0x90, 0xF9, 0xAC, 0x89, 0xEC,
+    0x89, 0x21, 0xAF, 0x22, 0x7B, 0xA3, 0x37, 0x12, 0xD9, 0xB1, 0x2F, 0xE5, 0xF8, 0x62, 0x5A, 0x68,
+    0x65, 0x88, 0xAA, 0x26, 0x7F, 0xF7, 0x4E, 0xA7, 0x2A, 0x7E, 0x7A, 0xF7, 0x65, 0x2F, 0xF1, 0x83,
+    0x5B, 0x2F, 0x51, 0x83, 0x0F, 0xB7, 0xDF, 0x74, 0x92, 0xEC, 0x7F, 0xF6, 0xAE, 0x81, 0xB1, 0xA8,
+    0x6B, 0x84, 0x2F, 0x24, 0xA3, 0x11, 0x6A, 0x28, 0x6C, 0x27, 0x7B, 0x57, 0x59, 0x39, 0xF0, 0x9E,
+    0xB9, 0x8A, 0xAC, 0x72, 0xB7, 0xB4, 0x08, 0x5C, 0x79, 0xF5, 0xA2, 0x35, 0x70, 0x43, 0x92, 0x1E,
+    0xA1, 0xAF, 0xDF, 0xBF, 0x8C, 0x13, 0x65, 0xCA, 0xF7, 0x7A, 0x64, 0x60, 0x99, 0xDF, 0xEE, 0x27,
+    0x09, 0x96, 0x66, 0xC7, 0x4E, 0x12, 0x8E, 0x66, 0xE7, 0x39, 0x8A, 0x68, 0x2C, 0x4F, 0x3F, 0x1E,
+    0x25, 0x1A, 0xEA, 0x94, 0x4B, 0xAF, 0xD9, 0xBD, 0x41, 0x62, 0xCB, 0x1D, 0x92, 0xD8, 0xA5, 0xB9,
+    0x6D, 0x25, 0x7D, 0x3E, 0x7E, 0x7C, 0x1A, 0x0B, 0xEE, 0x23, 0x4F, 0xD9, 0xBD, 0x31, 0x00, 0x5E,
+    0xF2, 0x3D, 0xA2, 0x4B, 0xF2, 0xDB, 0x2E, 0x11, 0x66, 0x47, 0x59, 0xB7, 0xAB, 0x8F, 0xAF, 0x6A,
+    0x4B, 0x18, 0x4D, 0xB3, 0x28, 0x5D, 0xBE, 0x50, 0x98, 0xC1, 0x16, 0xC2, 0x9B, 0x8F, 0x0C, 0xB5,
+    0x32, 0xEC, 0x08, 0x6E, 0xA4, 0x5F, 0x28, 0x1C, 0x44, 0x2A, 0xD3, 0x3E, 0x5C, 0x62, 0x77, 0x88,
+    0x93, 0x2C, 0xEA, 0x24, 0xEF, 0x9C, 0x48, 0x06, 0xFC, 0x04, 0x7C, 0xF2, 0xA1, 0xB4, 0x9E, 0x21,
+    0x13, 0xFD, 0x2F, 0xC9, 0x61, 0x07, 0xC4, 0xF1, 0xC1, 0xEA, 0xD0, 0x0F, 0xCF, 0x9E, 0x25, 0x3A,
+    0x10, 0x9F, 0x0B, 0x60, 0xFB, 0xB5, 0x29, 0xBE, 0x2F, 0x74, 0x64, 0x8B, 0x46, 0xD2, 0xE9, 0x3C,
+    0x0E, 0xEF, 0x03, 0xD6, 0x15, 0xB1, 0x04, 0xA0, 0xBD, 0xAF, 0xCF, 0x2A, 0x2A, 0x6D, 0x3C, 0xD3,
+    0x39, 0x3C, 0x1D, 0x9D, 0xCE, 0xCC, 0x25, 0x50, 0x12, 0x6D, 0x8E, 0x7B, 0x1C, 0x8F, 0xB9, 0xBB,
+    0x91, 0x7E, 0xED, 0xE8, 0xD9, 0xCE, 0x98, 0xCC, 0xD8, 0x1B, 0x64, 0xCB, 0x17, 0x2B, 0x6A, 0xBC,
+    0xC9, 0x06, 0xE2, 0xC5, 0x42, 0x3D, 0x14, 0xEA, 0x36, 0x2C, 0xD0, 0xCF, 0xB1, 0x51, 0xD3, 0x11,
+    0xDB, 0x10, 0x96, 0x70, 0x42, 0x1C, 0x7E, 0xA5, 0xFA, 0x8C, 0x49, 0x53, 0x16, 0xD9, 0x44, 0x60,
+    0x22, 0xD5, 0x23, 0x6E, 0xA4, 0x3D, 0x6C, 0x83, 0xE8, 0x10, 0x08, 0x3C, 0x0C, 0x1E, 0x81, 0xE7,
+    0x1D, 0x28, 0xDD, 0xB4, 0x29, 0x6B, 0x03, 0xEC, 0x92, 0x30, 0xF6, 0x29, 0x05, 0xEB, 0x9E, 0x86,
+    0x43, 0x7D, 0xC2, 0x8A, 0x49, 0x5F, 0xC1, 0xA5, 0x94, 0x1D, 0xCB, 0x39, 0x9E, 0xF3, 0x1A, 0x34,
+    0xE1, 0xDC, 0xBB, 0xE4, 0xD6, 0x7D, 0x78, 0xCF, 0x67, 0xDF, 0xAB, 0x09, 0x62, 0x25, 0x43, 0xF2,
+    0xB1, 0x4C, 0x5D, 0x61, 0x41, 0xFC, 0xDA, 0x39, 0xB8, 0xE6, 0xED, 0x0D, 0x2B, 0xBF, 0x95, 0x99,
+    0x0F, 0x5A, 0x4F, 0x0F, 0xEA, 0xEA, 0x33, 0xBB, 0x5A, 0x4F, 0xFE, 0x89, 0xD8, 0x31, 0x04, 0xB9,
+    0xA1, 0xF2, 0x2B, 0x63, 0x4B, 0x92, 0x60, 0x31, 0x93, 0x87, 0x5D, 0xC0, 0x49, 0x81, 0xAD, 0x57,
+    0xEE, 0xAE, 0x93, 0x04, 0x9B, 0x8B, 0x3F, 0x49, 0x3C, 0x48, 0x7D, 0x0B, 0xF1, 0x86, 0x0F, 0xBA,
+    0x33, 0x29, 0x71, 0xA0, 0x29, 0x08, 0x2E, 0xB5, 0xF1, 0x94, 0x35, 0x06, 0xA5, 0x99, 0x8F, 0x39,
+    0xD6, 0x7C, 0xA1, 0xBD, 0x69, 0xCA, 0xC2, 0x81, 0xFD, 0x89, 0x3A, 0x68, 0x95, 0x8E, 0xD3, 0xAF,
+    0x48, 0x5D, 0xFB, 0xC2, 0xAC, 0x0F, 0x79, 0x8B, 0x66, 0xC3, 0x56, 0x6B, 0xB0, 0xF4, 0x6B, 0x38,
+    0xFB, 0xB5, 0xF2, 0x2F, 0x1A, 0x36, 0x6E, 0x06, 0xF4, 0x2E, 0x61, 0x81, 0x67, 0xCC, 0xBB, 0x79,
+    0x01, 0x51, 0xDE, 0x5C, 0x89, 0x7A, 0xCF, 0x09, 0x3C, 0x5F, 0xDE, 0x61, 0x8B, 0xDC, 0x77, 0x23,
+    0x41, 0x45, 0xC1, 0x50, 0xE0, 0xE6, 0x7B, 0x6C, 0xBC, 0x9F, 0xF0, 0xBF, 0x1B, 0x06, 0xB9, 0x9E,
+    0x5C, 0x93, 0x7A, 0x03, 0x58, 0xEF, 0x3F, 0x46, 0x0B, 0x38, 0xBD, 0xAD, 0xF2, 0xFB, 0x04, 0x21,
+    0x91, 0x9F, 0x51, 0x08, 0x4B, 0xD9, 0x23, 0xEA, 0x1C, 0x6D, 0x73, 0xBC, 0xE6, 0x38, 0x8E, 0x3A,
+    0x1D, 0xE9, 0xCD, 0x1D, 0x13, 0x37, 0x74, 0x17, 0x85, 0x0B, 0x3A, 0x20, 0x52, 0xB5, 0x75, 0x6C,
+    0x1F, 0x8D, 0x60, 0xCE, 0xA3, 0xCB, 0x2F, 0x27, 0x46, 0x03, 0x14, 0x30, 0xED, 0x4E, 0x68, 0x41,
+    0x65, 0xCF, 0x47, 0x3A, 0x62, 0xA2, 0x80, 0x80, 0x3D, 0xF9, 0x13, 0x99, 0xE1, 0x6E, 0xFE, 0x4F,
+    0xDB, 0x9E, 0x91, 0x1B, 0x59, 0xF1, 0x4D, 0xDF, 0x75, 0x51, 0xC3, 0x2E, 0xAA, 0xBA, 0x6F, 0x23,
+    0x7D, 0x58, 0x6D, 0xC5, 0x9A, 0xA2, 0x42, 0xC6, 0x14, 0xFA, 0x86, 0x8C, 0x75, 0x9D, 0x13, 0x53,
+    0xE6, 0xDA, 0x37, 0xA6, 0x35, 0x6A, 0xCB, 0x16, 0x5C, 0x5B, 0x36, 0xB5, 0xB6, 0x65, 0xF3, 0x23,
+    0x72, 0xD3, 0x0E, 0xC0, 0x7E, 0xD7, 0x83, 0x29, 0x5F, 0x81, 0x70, 0x33, 0x7D, 0xED, 0x91, 0xCA,
+    0xFA, 0x53, 0x1E, 0x01, 0x8B, 0x62, 0x1A, 0x93, 0xAC, 0x67, 0x29, 0x89, 0x5D, 0x8A, 0x52, 0xF5,
+    0xF5, 0xEA, 0xF1, 0xE5, 0xD1, 0xE6, 0xA0, 0x54, 0xC3, 0xCE, 0x60, 0x02, 0x9B, 0x01, 0x3E, 0x90,
+    0x54, 0xE4, 0x7A, 0x0B, 0xF5, 0xE5, 0x96, 0xFE, 0x18, 0x32, 0x1F, 0x8B, 0x62, 0x74, 0xF1, 0x19,
+    0xE5, 0xB0, 0x9E, 0x2D, 0xFF, 0xE1, 0xD0, 0xD6, 0x10, 0x63, 0xAE, 0xA0, 0x1C, 0x79, 0x59, 0x0E,
+    0x1B, 0x28, 0x08, 0x48, 0x00, 0x34, 0xEB, 0xD6, 0xF8, 0x6E, 0x19, 0x6D, 0xA6, 0xD6, 0x31, 0xD6,
+    0xF7, 0x4A, 0x62, 0xF1, 0xC7, 0x7B, 0x18, 0x1F, 0xBB, 0xF6, 0xBD, 0x27, 0xED, 0xE6, 0x58, 0xAD,
+    0x8B, 0xC2, 0x8D, 0x9A, 0x47, 0x75, 0x3A, 0x4B, 0xC6, 0x51, 0x8A, 0x69, 0x1E, 0x35, 0x5B, 0x5F,
+    0x71, 0x5B, 0x92, 0xBF, 0x3D, 0xD7, 0xF9, 0x5C, 0xC4, 0x14, 0x01, 0x13, 0x22, 0x41, 0xB1, 0xF6,
+    0x3A, 0xB4, 0x9B, 0x51, 0xCE, 0xCE, 0xA3, 0x9C, 0xEE, 0x63, 0xC2, 0xD8, 0xB9, 0x59, 0xC4, 0xD3,
+    0x3A, 0xE4, 0xFD, 0x81, 0x90, 0x53, 0xFD, 0x09, 0x8A, 0x4F, 0x99, 0xCC, 0x4B, 0x14, 0x3F, 0xF2,
+    0x27, 0x87, 0xD8, 0x8E, 0xA2, 0xEF, 0x8F, 0x20, 0x82, 0x0B, 0x7B, 0x60, 0x8E, 0xF4, 0xA3, 0xDC,
+    0x26, 0xE4, 0xCE, 0x82, 0xA0, 0x38, 0x54, 0x70, 0xF2, 0xC9, 0xD8, 0xF8, 0x51, 0x57, 0xD8, 0xCA,
+    0x4E, 0x1D, 0xEA, 0x4C, 0x27, 0x6B, 0x79, 0x58, 0xBF, 0x04, 0x17, 0x86, 0x13, 0x29, 0x21, 0x5A,
+    0xB2, 0x66, 0xA2, 0x31, 0x76, 0x94, 0x48, 0xBA, 0x49, 0x06, 0x36, 0xF5, 0xB4, 0x67, 0x33, 0x4F,
+    0xFB, 0xCC, 0xCD, 0xCE, 0x94, 0x28, 0xD7, 0x1E, 0xBD, 0xA1, 0x23, 0x33, 0x82, 0xB5, 0x28, 0x9B,
+    0xD8, 0x0F, 0xCF, 0x1F, 0x1C, 0x60, 0x15, 0xC7, 0x1D, 0x31, 0x23, 0xE9, 0x09, 0x58, 0xCC, 0xC4,
+    0x5C, 0x9B, 0x2E, 0x58, 0xE1, 0x74, 0x25, 0x5D, 0x9E, 0xCC, 0xB0, 0x01, 0x88, 0x4B, 0x18, 0x62,
+    0x6A, 0x37, 0x37, 0x40, 0x8E, 0xC7, 0x7E, 0xB3, 0xFD, 0x07, 0x30, 0xCA, 0xC3, 0xFD, 0x97, 0xA3,
+    0xFC, 0xF9, 0xCD, 0x02, 0xF2, 0xAF, 0x8F, 0x9F, 0xBF, 0xEB, 0x31, 0xE6, 0x3F, 0xC2, 0x93, 0xF4,
+    0xC8, 0x4D, 0x00, 0xF0, 0x25, 0x3D, 0x75, 0xBF, 0xA5, 0xC4, 0x18, 0x2E, 0x87, 0x02, 0xC6, 0x24,
+    0x71, 0x83, 0xD2, 0xCA, 0xF3, 0x99, 0x53, 0x37, 0x63, 0x18, 0x51, 0x55, 0x52, 0xD4, 0x2C, 0x90,
+    0x0B, 0xF5, 0xB3, 0x6F, 0xE6, 0x5C, 0xFB, 0x7A, 0x6A, 0xE6, 0xB2, 0x9D, 0x67, 0x61, 0x8F, 0x99,
+    0x83, 0x25, 0xBE, 0xE1, 0x54, 0x8E, 0xA8, 0xA9, 0xFB, 0x62, 0x68, 0xBD, 0xD8, 0xBB, 0x69, 0x3D,
+    0x27, 0x9F, 0xE1, 0xFB, 0xE1, 0xF9, 0xB7, 0x4C, 0xB9, 0x5C, 0x00, 0x60, 0x6A, 0xE8, 0x23, 0xED,
+    0x3A, 0x36, 0x68, 0xFC, 0x69, 0x2E, 0xC4, 0xBD, 0x1F, 0x84, 0xA9, 0xD1, 0xE9, 0x77, 0x44, 0xDF,
+    0xFA, 0xF2, 0x36, 0xCD, 0x11, 0x29, 0x1F, 0x70, 0x73, 0x77, 0x58, 0xA7, 0x82, 0x4D, 0x20, 0xD7,
+    0xC3, 0x15, 0xC0, 0x57, 0x21, 0xB9, 0x05, 0x79, 0xB2, 0xC4, 0xDE, 0x6F, 0x47, 0x99, 0x62, 0xCC,
+    0xA5, 0x09, 0xA6, 0xD1, 0xB4, 0x4F, 0xC6, 0x14, 0x09, 0xCB, 0x5E, 0x6B, 0x07, 0x3B, 0x2A, 0xE3,
+    0xF8, 0xB4, 0x5B, 0x8D, 0xC7, 0xB3, 0xD5, 0xAE, 0x3A, 0x73, 0x00, 0x52, 0x4E, 0x50, 0x18, 0x27,
+    0xD8, 0x81, 0xB0, 0x45, 0x3B, 0xC6, 0xAD, 0x27, 0x7A, 0x06, 0x01, 0x34, 0x07, 0xB9, 0xF4, 0xCB,
+    0xE2, 0x2F, 0x72, 0x69, 0xD9, 0xFD, 0x00, 0x43, 0x5E, 0x59, 0xB0, 0x17, 0x66, 0xAE, 0xE5, 0xCF,
+    0x3F, 0x2A, 0x9C, 0xAA, 0x8C, 0xA1, 0xF8, 0x45, 0xFD, 0x6C, 0xF5, 0x46, 0x95, 0x53, 0xC4, 0xBA,
+    0x79, 0xBF, 0xC9, 0x5C, 0x8F, 0xC9, 0x7D, 0xA7, 0x69, 0x36, 0xB2, 0x74, 0x8F, 0x10, 0x22, 0x78,
+    0xEB, 0x7A, 0xEB, 0x53, 0xE6, 0x06, 0x1F, 0x24, 0x97, 0x68, 0x1D, 0x02, 0xDD, 0x5E, 0xA6, 0x98,
+    0x23, 0x88, 0xD1, 0x78, 0x8C, 0xF0, 0x97, 0x0C, 0x5C, 0xE1, 0x22, 0x56, 0x0C, 0xE6, 0x58, 0x53,
+    0x7B, 0x68, 0x2B, 0x19, 0x7C, 0x20, 0x59, 0xB1, 0x68, 0x33, 0x2E, 0xB0, 0x3C, 0x02, 0xBF, 0x5D,
+    0xA7, 0x4B, 0x09, 0x14, 0x57, 0xBA, 0xAE, 0x8E, 0x08, 0x67, 0xB6, 0xE0, 0x9E, 0x60, 0xEE, 0xD9,
+    0xE0, 0xAD, 0x6B, 0xF0, 0x41, 0xFD, 0x4F, 0x6D, 0x69, 0x44, 0x95, 0x12, 0x2D, 0x10, 0x3F, 0xA1,
+    0x60, 0xCE, 0xCC, 0xAF, 0x1D, 0xC7, 0xF5, 0x4F, 0x74, 0x70, 0x9C, 0x85, 0x7B, 0x05, 0xF2, 0x3D,
+    0xDA, 0xF7, 0x29, 0xB9, 0xFE, 0x5B, 0x08, 0xBE, 0x47, 0x3A, 0x71, 0x98, 0x5C, 0x5F, 0x7B, 0xA2,
+    0x9C, 0x3C, 0xFC, 0x8C, 0x5E, 0xFE, 0x97, 0xD4, 0x4F, 0xBF, 0x02, 0x0E, 0xEE, 0x7C, 0x81, 0x51,
+    0x29, 0x4D, 0x30, 0x59, 0xA7, 0xE9, 0x41, 0x40, 0xAD, 0x45, 0xB8, 0x26, 0x2B, 0x0F, 0x46, 0x58,
+    0x2C, 0xC7, 0x76, 0x75, 0xE1, 0x38, 0xCB, 0x09, 0xFF, 0x2A, 0x80, 0x63, 0xAF, 0xAF, 0x8F, 0x75,
+    0x2F, 0xB6, 0x4E, 0xAC, 0x98, 0xCF, 0xCD, 0x4F, 0xFA, 0x19, 0x45, 0x30, 0x8B, 0x00, 0xE3, 0x34,
+    0xD4, 0xEF, 0x8E, 0xB4, 0xCC, 0xCD, 0x51, 0x95, 0x67, 0x96, 0x78, 0x00, 0x52, 0x93, 0x1E, 0xF0,
+    0x4D, 0xED, 0x4A, 0xB8, 0x50, 0x65, 0x0B, 0xBE, 0x64, 0x90, 0xD0, 0xDC, 0xDB, 0xA2, 0x7B, 0xA5,
+    0x88, 0xF6, 0x9A, 0x95, 0xB8, 0x8C, 0x34, 0xFE, 0x0F, 0xD3, 0x5A, 0xE5, 0x60, 0xFF, 0xBF, 0xC1,
+    0xFE, 0xBF, 0x43, 0xFD, 0x7F, 0x06, 0x00, 0x2D, 0x90, 0xB1, 0x71, 0x85, 0x30, 0x10, 0x44, 0x57,
+    0x10, 0xFC, 0x40, 0x01, 0x25, 0x50, 0xC2, 0x2F, 0x41, 0x24, 0xCE, 0xE9, 0xC3, 0x81, 0x4B, 0x10,
+    0xE3, 0x19, 0xE7, 0x2E, 0xC1, 0x9D, 0x08, 0x77, 0xE0, 0x12, 0x48, 0x9C, 0x13, 0xE0, 0x19, 0x02,
+    0x7D, 0xED, 0xDF, 0x3B, 0xAC, 0x40, 0x6F, 0x24, 0xDD, 0xAD, 0xF6, 0x16, 0x40, 0x98, 0xA1, 0x15,
+    0x0A, 0x3F, 0x85, 0x48, 0x56, 0x61, 0x24, 0x1F, 0x42, 0x3A, 0x46, 0x3B, 0xE5, 0xF5, 0x66, 0x28,
+    0x4B, 0x34, 0x70, 0x1A, 0x79, 0x0A, 0x20, 0x0F, 0x04, 0x06, 0x72, 0x47, 0x47, 0xBC, 0xFD, 0xCD,
+    0xE8, 0x1A, 0xEE, 0x1B, 0xD0, 0x3F, 0x90, 0x7E, 0x84, 0xEA, 0x50, 0x6F, 0x5A, 0xA5, 0x7C, 0x4A,
+    0x07, 0x18, 0x0E, 0xE9, 0x38, 0x38, 0x09, 0xBB, 0x63, 0x14, 0x3E, 0x60, 0xBD, 0x24, 0xAC, 0xC9,
+    0xB1, 0x22, 0x35, 0xFB, 0x1C, 0x41, 0x25, 0x65, 0x35, 0x97, 0xE0, 0x62, 0xFB, 0x2B, 0xFD, 0x50,
+    0xDA, 0x85, 0xEA, 0xC8, 0x1B, 0xFE, 0x97, 0xD5, 0x6B, 0xA7, 0x17, 0x0F, 0x34, 0xB7, 0x48, 0xD7,
+    0x60, 0x69, 0xBB, 0x26, 0x9A, 0xA2, 0x5D, 0x66, 0xF3, 0x81, 0xCC, 0xE5, 0xCE, 0xBD, 0x27, 0xBF,
+    0x35, 0x8A, 0x02, 0x78, 0x17, 0x86, 0x33, 0x86, 0xFC, 0x3B, 0xD9, 0xB3, 0xEC, 0x0C, 0xD5, 0xED,
+    0x44, 0x09, 0xCA, 0x4E, 0xCF, 0x6B, 0x06, 0xFD, 0xEB, 0xE6, 0x9B, 0xA3, 0x57, 0x20, 0x92, 0xEC,
+    0x14, 0x08, 0xF0, 0x75, 0x6B, 0x1D, 0x5F, 0x50, 0x58, 0x83, 0x82, 0x2C, 0x6A, 0x10, 0xB2, 0xB5,
+    0x2B, 0xD6, 0xD9, 0x1D, 0x3E, 0x01, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21, 0x10, 0x85, 0xE1, 0x77,
+    0x43, 0x40, 0x70, 0x01, 0x76, 0x70, 0x25, 0x98, 0x98, 0x43, 0x27, 0xB6, 0x61, 0xE2, 0x78, 0x55,
+    0x58, 0x8B, 0x99, 0x96, 0x40, 0x09, 0xD8, 0x03, 0x01, 0x01, 0xEC, 0x73, 0xF7, 0x18, 0x99, 0x81,
+    0x3F, 0xF8, 0x66, 0x87, 0x05, 0xFE, 0xE7, 0x32, 0x33, 0x8E, 0xD7, 0x31, 0x59, 0x02, 0xB3, 0x25,
+    0xB2, 0x5A, 0xE4, 0x69, 0xE8, 0x32, 0xA2, 0x62, 0xF8, 0x20, 0x28, 0xC6, 0xEF, 0x6B, 0x55, 0x24,
+    0xBB, 0x1F, 0x3A, 0xC5, 0xBE, 0x32, 0x05, 0xB2, 0xEA, 0x64, 0x24, 0xF3, 0x99, 0xF5, 0x41, 0xA6,
+    0x37, 0xDB, 0x46, 0x51, 0x2E, 0x9E, 0xE2, 0xC9, 0x7D, 0xA1, 0xAC, 0x14, 0x40, 0x91, 0x0D, 0xD8,
+    0x34, 0x05, 0xF0, 0xC3, 0x73, 0x07, 0x96, 0xEE, 0xC4, 0xFE, 0xBB, 0xBB, 0x66, 0xD9, 0xAE, 0xC5,
+    0x72, 0x90, 0xA2, 0xCC, 0x3D, 0x6F, 0x33, 0x27, 0xBD, 0x3F,
 };
 
 static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
@@ -2397,99 +2402,99 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 10, 22, 134, 0, 21, 55, 0 }, // !
-    { 12, 8, 211, 2, 21, 24, 55 }, // "
-    { 19, 21, 302, 0, 21, 100, 79 }, // #
-    { 16, 25, 257, 0, 23, 100, 179 }, // $
-    { 23, 23, 400, 1, 22, 133, 279 }, // %
-    { 21, 23, 330, 0, 22, 121, 412 }, // &
-    { 6, 8, 119, 2, 21, 12, 533 }, // '
-    { 11, 26, 158, 1, 21, 72, 545 }, // (
-    { 12, 27, 159, -3, 22, 81, 617 }, // )
-    { 15, 15, 255, 2, 23, 57, 698 }, // *
-    { 15, 15, 267, 1, 18, 57, 755 }, // +
-    { 8, 8, 134, -2, 4, 16, 812 }, // ,
-    { 9, 4, 151, 0, 10, 9, 828 }, // -
-    { 6, 6, 134, 0, 5, 9, 837 }, // .
-    { 17, 22, 198, -2, 21, 94, 846 }, // /
-    { 16, 23, 277, 1, 22, 92, 940 }, // 0
-    { 12, 21, 221, 1, 21, 63, 1032 }, // 1
-    { 17, 22, 257, -1, 22, 94, 1095 }, // 2
-    { 16, 23, 257, 0, 22, 92, 1189 }, // 3
-    { 17, 21, 257, -1, 21, 90, 1281 }, // 4
-    { 16, 22, 257, 0, 21, 88, 1371 }, // 5
-    { 16, 23, 266, 1, 22, 92, 1459 }, // 6
-    { 17, 21, 237, 0, 21, 90, 1551 }, // 7
-    { 16, 23, 260, 0, 22, 92, 1641 }, // 8
-    { 15, 23, 260, 1, 22, 87, 1733 }, // 9
-    { 8, 18, 134, 0, 17, 36, 1820 }, // :
-    { 10, 21, 134, -2, 17, 53, 1856 }, // ;
-    { 15, 17, 267, 1, 19, 64, 1909 }, // <
-    { 15, 10, 267, 1, 15, 38, 1973 }, // =
-    { 15, 17, 267, 1, 19, 64, 2011 }, // >
-    { 13, 23, 214, 2, 22, 75, 2075 }, // ?
-    { 24, 24, 400, 1, 21, 144, 2150 }, // @
-    { 19, 21, 293, -2, 21, 100, 2294 }, // A
-    { 18, 21, 289, 0, 21, 95, 2394 }, // B
-    { 19, 23, 286, 1, 22, 110, 2489 }, // C
-    { 19, 21, 316, 0, 21, 100, 2599 }, // D
-    { 17, 21, 253, 0, 21, 90, 2699 }, // E
-    { 17, 21, 249, 0, 21, 90, 2789 }, // F
-    { 19, 23, 322, 1, 22, 110, 2879 }, // G
-    { 21, 21, 327, 0, 21, 111, 2989 }, // H
-    { 14, 21, 179, -1, 21, 74, 3100 }, // I
-    { 15, 28, 156, -5, 21, 105, 3174 }, // J
-    { 21, 21, 286, 0, 21, 111, 3279 }, // K
-    { 14, 21, 242, 0, 21, 74, 3390 }, // L
-    { 26, 21, 411, 0, 21, 137, 3464 }, // M
-    { 23, 21, 354, 0, 21, 121, 3601 }, // N
-    { 20, 23, 341, 1, 22, 115, 3722 }, // O
-    { 18, 21, 285, 0, 21, 95, 3837 }, // P
-    { 20, 27, 341, 1, 22, 135, 3932 }, // Q
-    { 18, 21, 289, 0, 21, 95, 4067 }, // R
-    { 16, 23, 247, 0, 22, 92, 4162 }, // S
-    { 16, 21, 248, 2, 21, 84, 4254 }, // T
-    { 20, 22, 323, 1, 21, 110, 4338 }, // U
-    { 18, 21, 275, 2, 21, 95, 4448 }, // V
-    { 27, 21, 417, 2, 21, 142, 4543 }, // W
-    { 23, 21, 285, -2, 21, 121, 4685 }, // X
-    { 18, 21, 263, 2, 21, 95, 4806 }, // Y
-    { 19, 21, 250, -1, 21, 100, 4901 }, // Z
-    { 13, 26, 154, -1, 21, 85, 5001 }, // [
-    { 8, 22, 198, 3, 21, 44, 5086 }, // <backslash>
-    { 13, 26, 154, -2, 21, 85, 5130 }, // ]
-    { 16, 14, 257, 0, 21, 56, 5215 }, // ^
-    { 13, 3, 187, -3, -2, 10, 5271 }, // _
-    { 7, 6, 151, 4, 23, 11, 5281 }, // `
-    { 16, 18, 276, 1, 17, 72, 5292 }, // a
-    { 17, 24, 278, 0, 23, 102, 5364 }, // b
-    { 14, 18, 226, 1, 17, 63, 5466 }, // c
-    { 18, 24, 277, 1, 23, 108, 5529 }, // d
-    { 15, 18, 260, 1, 17, 68, 5637 }, // e
-    { 19, 30, 175, -4, 23, 143, 5705 }, // f
-    { 17, 24, 278, 0, 17, 102, 5848 }, // g
-    { 17, 23, 282, 0, 23, 98, 5950 }, // h
-    { 10, 23, 140, 0, 23, 58, 6048 }, // i
-    { 14, 30, 140, -4, 23, 105, 6106 }, // j
-    { 18, 23, 265, 0, 23, 104, 6211 }, // k
-    { 10, 23, 140, 0, 23, 58, 6315 }, // l
-    { 25, 17, 422, 0, 17, 107, 6373 }, // m
-    { 17, 17, 282, 0, 17, 73, 6480 }, // n
-    { 15, 18, 273, 1, 17, 68, 6553 }, // o
-    { 18, 24, 278, -1, 17, 108, 6621 }, // p
-    { 16, 24, 277, 1, 17, 96, 6729 }, // q
-    { 14, 17, 197, 0, 17, 60, 6825 }, // r
-    { 14, 18, 222, 0, 17, 63, 6885 }, // s
-    { 12, 21, 191, 1, 20, 63, 6948 }, // t
-    { 17, 17, 282, 1, 16, 73, 7011 }, // u
-    { 16, 16, 239, 1, 16, 64, 7084 }, // v
-    { 24, 16, 368, 1, 16, 96, 7148 }, // w
-    { 19, 16, 249, -2, 16, 76, 7244 }, // x
-    { 20, 23, 242, -3, 16, 115, 7320 }, // y
-    { 15, 16, 219, -1, 16, 60, 7435 }, // z
-    { 14, 26, 166, -1, 21, 91, 7495 }, // {
-    { 4, 30, 257, 6, 23, 30, 7586 }, // |
-    { 13, 26, 166, -2, 21, 85, 7616 }, // }
-    { 15, 6, 267, 1, 13, 23, 7701 }, // ~
+    { 12, 8, 211, 2, 21, 24, 0 }, // "
+    { 19, 21, 302, 0, 21, 100, 24 }, // #
+    { 16, 25, 257, 0, 23, 100, 124 }, // $
+    { 23, 23, 400, 1, 22, 133, 224 }, // %
+    { 21, 23, 330, 0, 22, 121, 357 }, // &
+    { 6, 8, 119, 2, 21, 12, 478 }, // '
+    { 11, 26, 158, 1, 21, 72, 55 }, // (
+    { 12, 27, 159, -3, 22, 81, 127 }, // )
+    { 15, 15, 255, 2, 23, 57, 490 }, // *
+    { 15, 15, 267, 1, 18, 57, 547 }, // +
+    { 8, 8, 134, -2, 4, 16, 208 }, // ,
+    { 9, 4, 151, 0, 10, 9, 224 }, // -
+    { 6, 6, 134, 0, 5, 9, 233 }, // .
+    { 17, 22, 198, -2, 21, 94, 604 }, // /
+    { 16, 23, 277, 1, 22, 92, 242 }, // 0
+    { 12, 21, 221, 1, 21, 63, 334 }, // 1
+    { 17, 22, 257, -1, 22, 94, 397 }, // 2
+    { 16, 23, 257, 0, 22, 92, 491 }, // 3
+    { 17, 21, 257, -1, 21, 90, 583 }, // 4
+    { 16, 22, 257, 0, 21, 88, 673 }, // 5
+    { 16, 23, 266, 1, 22, 92, 761 }, // 6
+    { 17, 21, 237, 0, 21, 90, 853 }, // 7
+    { 16, 23, 260, 0, 22, 92, 943 }, // 8
+    { 15, 23, 260, 1, 22, 87, 1035 }, // 9
+    { 8, 18, 134, 0, 17, 36, 1122 }, // :
+    { 10, 21, 134, -2, 17, 53, 1158 }, // ;
+    { 15, 17, 267, 1, 19, 64, 698 }, // <
+    { 15, 10, 267, 1, 15, 38, 762 }, // =
+    { 15, 17, 267, 1, 19, 64, 800 }, // >
+    { 13, 23, 214, 2, 22, 75, 1211 }, // ?
+    { 24, 24, 400, 1, 21, 144, 864 }, // @
+    { 19, 21, 293, -2, 21, 100, 1286 }, // A
+    { 18, 21, 289, 0, 21, 95, 1386 }, // B
+    { 19, 23, 286, 1, 22, 110, 1481 }, // C
+    { 19, 21, 316, 0, 21, 100, 1591 }, // D
+    { 17, 21, 253, 0, 21, 90, 1691 }, // E
+    { 17, 21, 249, 0, 21, 90, 1781 }, // F
+    { 19, 23, 322, 1, 22, 110, 1871 }, // G
+    { 21, 21, 327, 0, 21, 111, 1981 }, // H
+    { 14, 21, 179, -1, 21, 74, 2092 }, // I
+    { 15, 28, 156, -5, 21, 105, 2166 }, // J
+    { 21, 21, 286, 0, 21, 111, 2271 }, // K
+    { 14, 21, 242, 0, 21, 74, 2382 }, // L
+    { 26, 21, 411, 0, 21, 137, 2456 }, // M
+    { 23, 21, 354, 0, 21, 121, 2593 }, // N
+    { 20, 23, 341, 1, 22, 115, 2714 }, // O
+    { 18, 21, 285, 0, 21, 95, 2829 }, // P
+    { 20, 27, 341, 1, 22, 135, 2924 }, // Q
+    { 18, 21, 289, 0, 21, 95, 3059 }, // R
+    { 16, 23, 247, 0, 22, 92, 3154 }, // S
+    { 16, 21, 248, 2, 21, 84, 3246 }, // T
+    { 20, 22, 323, 1, 21, 110, 1008 }, // U
+    { 18, 21, 275, 2, 21, 95, 3330 }, // V
+    { 27, 21, 417, 2, 21, 142, 3425 }, // W
+    { 23, 21, 285, -2, 21, 121, 3567 }, // X
+    { 18, 21, 263, 2, 21, 95, 3688 }, // Y
+    { 19, 21, 250, -1, 21, 100, 3783 }, // Z
+    { 13, 26, 154, -1, 21, 85, 1118 }, // [
+    { 8, 22, 198, 3, 21, 44, 1203 }, // <backslash>
+    { 13, 26, 154, -2, 21, 85, 1247 }, // ]
+    { 16, 14, 257, 0, 21, 56, 1332 }, // ^
+    { 13, 3, 187, -3, -2, 10, 1388 }, // _
+    { 7, 6, 151, 4, 23, 11, 1398 }, // `
+    { 16, 18, 276, 1, 17, 72, 3883 }, // a
+    { 17, 24, 278, 0, 23, 102, 3955 }, // b
+    { 14, 18, 226, 1, 17, 63, 4057 }, // c
+    { 18, 24, 277, 1, 23, 108, 4120 }, // d
+    { 15, 18, 260, 1, 17, 68, 4228 }, // e
+    { 19, 30, 175, -4, 23, 143, 4296 }, // f
+    { 17, 24, 278, 0, 17, 102, 4439 }, // g
+    { 17, 23, 282, 0, 23, 98, 4541 }, // h
+    { 10, 23, 140, 0, 23, 58, 4639 }, // i
+    { 14, 30, 140, -4, 23, 105, 4697 }, // j
+    { 18, 23, 265, 0, 23, 104, 4802 }, // k
+    { 10, 23, 140, 0, 23, 58, 4906 }, // l
+    { 25, 17, 422, 0, 17, 107, 4964 }, // m
+    { 17, 17, 282, 0, 17, 73, 5071 }, // n
+    { 15, 18, 273, 1, 17, 68, 5144 }, // o
+    { 18, 24, 278, -1, 17, 108, 5212 }, // p
+    { 16, 24, 277, 1, 17, 96, 5320 }, // q
+    { 14, 17, 197, 0, 17, 60, 5416 }, // r
+    { 14, 18, 222, 0, 17, 63, 5476 }, // s
+    { 12, 21, 191, 1, 20, 63, 5539 }, // t
+    { 17, 17, 282, 1, 16, 73, 5602 }, // u
+    { 16, 16, 239, 1, 16, 64, 5675 }, // v
+    { 24, 16, 368, 1, 16, 96, 5739 }, // w
+    { 19, 16, 249, -2, 16, 76, 5835 }, // x
+    { 20, 23, 242, -3, 16, 115, 5911 }, // y
+    { 15, 16, 219, -1, 16, 60, 6026 }, // z
+    { 14, 26, 166, -1, 21, 91, 1409 }, // {
+    { 4, 30, 257, 6, 23, 30, 1500 }, // |
+    { 13, 26, 166, -2, 21, 85, 1530 }, // }
+    { 15, 6, 267, 1, 13, 23, 1615 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 10, 22, 133, -2, 16, 55, 0 }, // U+00A1
     { 14, 23, 257, 2, 22, 81, 55 }, // U+00A2
@@ -2573,19 +2578,19 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 16, 24, 269, 1, 23, 96, 7454 }, // U+00F0
     { 18, 23, 282, 0, 23, 104, 7550 }, // U+00F1
     { 15, 24, 275, 1, 23, 90, 7654 }, // U+00F2
-    { 15, 24, 275, 1, 23, 90, 7744 }, // U+00F3
-    { 15, 24, 275, 1, 23, 90, 7834 }, // U+00F4
-    { 16, 24, 275, 1, 23, 96, 7924 }, // U+00F5
-    { 15, 23, 275, 1, 22, 87, 8020 }, // U+00F6
-    { 15, 15, 267, 1, 18, 57, 8107 }, // U+00F7
-    { 17, 19, 273, 0, 17, 81, 8164 }, // U+00F8
-    { 17, 24, 282, 1, 23, 102, 8245 }, // U+00F9
-    { 17, 24, 282, 1, 23, 102, 8347 }, // U+00FA
-    { 17, 24, 282, 1, 23, 102, 8449 }, // U+00FB
-    { 17, 23, 282, 1, 22, 98, 8551 }, // U+00FC
-    { 20, 30, 242, -3, 23, 150, 8649 }, // U+00FD
-    { 18, 30, 278, -1, 23, 135, 8799 }, // U+00FE
-    { 20, 29, 242, -3, 22, 145, 8934 }, // U+00FF
+    { 15, 24, 275, 1, 23, 90, 6086 }, // U+00F3
+    { 15, 24, 275, 1, 23, 90, 7744 }, // U+00F4
+    { 16, 24, 275, 1, 23, 96, 7834 }, // U+00F5
+    { 15, 23, 275, 1, 22, 87, 7930 }, // U+00F6
+    { 15, 15, 267, 1, 18, 57, 8017 }, // U+00F7
+    { 17, 19, 273, 0, 17, 81, 8074 }, // U+00F8
+    { 17, 24, 282, 1, 23, 102, 8155 }, // U+00F9
+    { 17, 24, 282, 1, 23, 102, 8257 }, // U+00FA
+    { 17, 24, 282, 1, 23, 102, 8359 }, // U+00FB
+    { 17, 23, 282, 1, 22, 98, 8461 }, // U+00FC
+    { 20, 30, 242, -3, 23, 150, 8559 }, // U+00FD
+    { 18, 30, 278, -1, 23, 135, 8709 }, // U+00FE
+    { 20, 29, 242, -3, 22, 145, 8844 }, // U+00FF
     { 20, 26, 293, -2, 26, 130, 0 }, // U+0100
     { 16, 22, 276, 1, 21, 88, 130 }, // U+0101
     { 20, 28, 293, -2, 28, 140, 218 }, // U+0102
@@ -3287,98 +3292,98 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 9, 4, 151, 0, 10, 9, 100 }, // U+2010
     { 9, 4, 151, 0, 10, 9, 109 }, // U+2011
     { 15, 4, 257, 1, 12, 15, 118 }, // U+2012
-    { 14, 4, 224, 0, 10, 14, 133 }, // U+2013
-    { 28, 4, 448, 0, 10, 28, 147 }, // U+2014
-    { 28, 4, 448, 0, 10, 28, 175 }, // U+2015
-    { 12, 30, 257, 2, 23, 90, 203 }, // U+2016
-    { 14, 7, 187, -4, 0, 25, 293 }, // U+2017
-    { 8, 8, 101, 1, 21, 16, 318 }, // U+2018
-    { 8, 8, 101, 1, 21, 16, 334 }, // U+2019
-    { 8, 8, 131, -2, 4, 16, 350 }, // U+201A
-    { 5, 8, 100, 3, 21, 10, 366 }, // U+201B
-    { 14, 8, 202, 1, 21, 28, 376 }, // U+201C
-    { 14, 8, 202, 1, 21, 28, 404 }, // U+201D
-    { 14, 8, 232, -2, 4, 28, 432 }, // U+201E
-    { 11, 8, 202, 3, 21, 22, 460 }, // U+201F
-    { 13, 23, 240, 2, 23, 75, 482 }, // U+2020
-    { 16, 23, 240, 0, 23, 92, 557 }, // U+2021
-    { 10, 10, 175, 1, 16, 25, 649 }, // U+2022
-    { 10, 12, 164, 1, 17, 30, 674 }, // U+2023
-    { 6, 6, 233, 3, 5, 9, 704 }, // U+2024
-    { 14, 6, 268, 0, 5, 21, 713 }, // U+2025
-    { 22, 6, 389, 0, 5, 33, 734 }, // U+2026
-    { 6, 6, 150, 2, 11, 9, 767 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 776 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 776 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 776 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 820 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 864 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 914 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 964 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 1014 }, // U+202F
-    { 34, 23, 569, 1, 22, 196, 1014 }, // U+2030
-    { 45, 23, 737, 1, 22, 259, 1210 }, // U+2031
-    { 10, 8, 132, 1, 21, 20, 1469 }, // U+2032
-    { 16, 8, 239, 1, 21, 32, 1489 }, // U+2033
-    { 23, 8, 347, 1, 21, 46, 1521 }, // U+2034
-    { 8, 8, 132, 2, 21, 16, 1567 }, // U+2035
-    { 14, 8, 239, 2, 21, 28, 1583 }, // U+2036
-    { 21, 8, 347, 2, 21, 42, 1611 }, // U+2037
-    { 11, 10, 164, -3, 3, 28, 1653 }, // U+2038
-    { 9, 14, 152, 1, 15, 32, 1681 }, // U+2039
-    { 9, 14, 151, 0, 15, 32, 1713 }, // U+203A
-    { 24, 23, 395, 0, 22, 138, 1745 }, // U+203B
-    { 18, 22, 262, 0, 21, 99, 1883 }, // U+203C
-    { 13, 23, 215, 2, 22, 75, 1982 }, // U+203D
-    { 15, 4, 233, 2, 26, 15, 2057 }, // U+203E
-    { 16, 7, 250, -2, 0, 28, 2072 }, // U+203F
-    { 16, 8, 250, 2, 24, 32, 2100 }, // U+2040
-    { 15, 19, 179, -3, 12, 72, 2132 }, // U+2041
-    { 33, 27, 538, -1, 23, 223, 2204 }, // U+2042
-    { 9, 5, 151, 0, 10, 12, 2427 }, // U+2043
-    { 20, 21, 58, -8, 21, 105, 2439 }, // U+2044
-    { 13, 26, 154, -1, 21, 85, 2544 }, // U+2045
-    { 13, 26, 154, -2, 21, 85, 2629 }, // U+2046
-    { 26, 23, 423, 2, 22, 150, 2714 }, // U+2047
-    { 21, 23, 351, 2, 22, 121, 2864 }, // U+2048
-    { 23, 23, 348, 0, 22, 133, 2985 }, // U+2049
-    { 15, 16, 248, 1, 16, 60, 3118 }, // U+204A
-    { 16, 27, 290, 2, 23, 108, 3178 }, // U+204B
-    { 16, 15, 299, 1, 16, 60, 3286 }, // U+204C
-    { 16, 15, 299, 2, 16, 60, 3346 }, // U+204D
-    { 15, 15, 253, -1, 8, 57, 3406 }, // U+204E
-    { 8, 21, 133, 1, 17, 42, 3463 }, // U+204F
-    { 20, 31, 250, -2, 24, 155, 3505 }, // U+2050
-    { 18, 30, 253, -1, 23, 135, 3660 }, // U+2051
-    { 13, 23, 197, 0, 22, 75, 3795 }, // U+2052
-    { 28, 7, 467, 1, 12, 49, 3870 }, // U+2053
-    { 16, 7, 250, -3, 0, 28, 3919 }, // U+2054
-    { 16, 16, 268, 0, 15, 64, 3947 }, // U+2055
-    { 14, 23, 261, 1, 22, 81, 4011 }, // U+2056
-    { 27, 8, 413, 1, 21, 54, 4092 }, // U+2057
-    { 23, 23, 397, 1, 22, 133, 4146 }, // U+2058
-    { 23, 23, 398, 1, 22, 133, 4279 }, // U+2059
-    { 6, 23, 128, 1, 22, 35, 4412 }, // U+205A
-    { 19, 24, 333, 1, 23, 114, 4447 }, // U+205B
-    { 24, 23, 386, 0, 22, 138, 4561 }, // U+205C
-    { 6, 24, 131, 1, 23, 36, 4699 }, // U+205D
-    { 5, 23, 133, 2, 22, 29, 4735 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 4764 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2064
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2066
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2067
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2068
-    { 0, 0, 280, 0, 0, 0, 4764 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 4764 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4814 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4864 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4914 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4964 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 5014 }, // U+206F
+    { 14, 4, 224, 0, 10, 14, 6176 }, // U+2013
+    { 28, 4, 448, 0, 10, 28, 6190 }, // U+2014
+    { 28, 4, 448, 0, 10, 28, 133 }, // U+2015
+    { 12, 30, 257, 2, 23, 90, 161 }, // U+2016
+    { 14, 7, 187, -4, 0, 25, 251 }, // U+2017
+    { 8, 8, 101, 1, 21, 16, 276 }, // U+2018
+    { 8, 8, 101, 1, 21, 16, 6218 }, // U+2019
+    { 8, 8, 131, -2, 4, 16, 292 }, // U+201A
+    { 5, 8, 100, 3, 21, 10, 308 }, // U+201B
+    { 14, 8, 202, 1, 21, 28, 6234 }, // U+201C
+    { 14, 8, 202, 1, 21, 28, 6262 }, // U+201D
+    { 14, 8, 232, -2, 4, 28, 318 }, // U+201E
+    { 11, 8, 202, 3, 21, 22, 346 }, // U+201F
+    { 13, 23, 240, 2, 23, 75, 368 }, // U+2020
+    { 16, 23, 240, 0, 23, 92, 443 }, // U+2021
+    { 10, 10, 175, 1, 16, 25, 535 }, // U+2022
+    { 10, 12, 164, 1, 17, 30, 560 }, // U+2023
+    { 6, 6, 233, 3, 5, 9, 590 }, // U+2024
+    { 14, 6, 268, 0, 5, 21, 599 }, // U+2025
+    { 22, 6, 389, 0, 5, 33, 6290 }, // U+2026
+    { 6, 6, 150, 2, 11, 9, 620 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 629 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 629 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 629 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 673 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 717 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 767 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 817 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 867 }, // U+202F
+    { 34, 23, 569, 1, 22, 196, 867 }, // U+2030
+    { 45, 23, 737, 1, 22, 259, 1063 }, // U+2031
+    { 10, 8, 132, 1, 21, 20, 1322 }, // U+2032
+    { 16, 8, 239, 1, 21, 32, 1342 }, // U+2033
+    { 23, 8, 347, 1, 21, 46, 1374 }, // U+2034
+    { 8, 8, 132, 2, 21, 16, 1420 }, // U+2035
+    { 14, 8, 239, 2, 21, 28, 1436 }, // U+2036
+    { 21, 8, 347, 2, 21, 42, 1464 }, // U+2037
+    { 11, 10, 164, -3, 3, 28, 1506 }, // U+2038
+    { 9, 14, 152, 1, 15, 32, 1534 }, // U+2039
+    { 9, 14, 151, 0, 15, 32, 1566 }, // U+203A
+    { 24, 23, 395, 0, 22, 138, 1598 }, // U+203B
+    { 18, 22, 262, 0, 21, 99, 1736 }, // U+203C
+    { 13, 23, 215, 2, 22, 75, 1835 }, // U+203D
+    { 15, 4, 233, 2, 26, 15, 1910 }, // U+203E
+    { 16, 7, 250, -2, 0, 28, 1925 }, // U+203F
+    { 16, 8, 250, 2, 24, 32, 1953 }, // U+2040
+    { 15, 19, 179, -3, 12, 72, 1985 }, // U+2041
+    { 33, 27, 538, -1, 23, 223, 2057 }, // U+2042
+    { 9, 5, 151, 0, 10, 12, 2280 }, // U+2043
+    { 20, 21, 58, -8, 21, 105, 2292 }, // U+2044
+    { 13, 26, 154, -1, 21, 85, 2397 }, // U+2045
+    { 13, 26, 154, -2, 21, 85, 2482 }, // U+2046
+    { 26, 23, 423, 2, 22, 150, 2567 }, // U+2047
+    { 21, 23, 351, 2, 22, 121, 2717 }, // U+2048
+    { 23, 23, 348, 0, 22, 133, 2838 }, // U+2049
+    { 15, 16, 248, 1, 16, 60, 2971 }, // U+204A
+    { 16, 27, 290, 2, 23, 108, 3031 }, // U+204B
+    { 16, 15, 299, 1, 16, 60, 3139 }, // U+204C
+    { 16, 15, 299, 2, 16, 60, 3199 }, // U+204D
+    { 15, 15, 253, -1, 8, 57, 3259 }, // U+204E
+    { 8, 21, 133, 1, 17, 42, 3316 }, // U+204F
+    { 20, 31, 250, -2, 24, 155, 3358 }, // U+2050
+    { 18, 30, 253, -1, 23, 135, 3513 }, // U+2051
+    { 13, 23, 197, 0, 22, 75, 3648 }, // U+2052
+    { 28, 7, 467, 1, 12, 49, 3723 }, // U+2053
+    { 16, 7, 250, -3, 0, 28, 3772 }, // U+2054
+    { 16, 16, 268, 0, 15, 64, 3800 }, // U+2055
+    { 14, 23, 261, 1, 22, 81, 3864 }, // U+2056
+    { 27, 8, 413, 1, 21, 54, 3945 }, // U+2057
+    { 23, 23, 397, 1, 22, 133, 3999 }, // U+2058
+    { 23, 23, 398, 1, 22, 133, 4132 }, // U+2059
+    { 6, 23, 128, 1, 22, 35, 4265 }, // U+205A
+    { 19, 24, 333, 1, 23, 114, 4300 }, // U+205B
+    { 24, 23, 386, 0, 22, 138, 4414 }, // U+205C
+    { 6, 24, 131, 1, 23, 36, 4552 }, // U+205D
+    { 5, 23, 133, 2, 22, 29, 4588 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 4617 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2064
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2066
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2067
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2068
+    { 0, 0, 280, 0, 0, 0, 4617 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 4617 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 4667 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 4717 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4767 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4817 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4867 }, // U+206F
     { 11, 14, 177, 2, 25, 39, 0 }, // U+2070
     { 6, 14, 114, 2, 22, 21, 39 }, // U+2071
     { 12, 13, 177, 1, 25, 39, 60 }, // U+2074
@@ -3454,13 +3459,13 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 20, 24, 286, -1, 24, 120, 3502 }, // U+20BE
     { 17, 27, 257, 0, 24, 115, 3622 }, // U+20BF
     { 9, 4, 151, 0, 10, 9, 0 }, // U+2212
-    { 28, 30, 333, -4, 23, 210, 0 }, // U+FB00
-    { 25, 30, 313, -4, 23, 188, 210 }, // U+FB01
-    { 25, 30, 313, -4, 23, 188, 398 }, // U+FB02
-    { 34, 30, 467, -4, 23, 255, 586 }, // U+FB03
-    { 35, 30, 467, -4, 23, 263, 841 }, // U+FB04
-    { 27, 30, 354, -4, 23, 203, 1104 }, // U+FB05
-    { 27, 24, 412, 0, 23, 162, 1307 }, // U+FB06
+    { 28, 30, 333, -4, 23, 210, 6323 }, // U+FB00
+    { 25, 30, 313, -4, 23, 188, 6533 }, // U+FB01
+    { 25, 30, 313, -4, 23, 188, 6721 }, // U+FB02
+    { 34, 30, 467, -4, 23, 255, 6909 }, // U+FB03
+    { 35, 30, 467, -4, 23, 263, 7164 }, // U+FB04
+    { 27, 30, 354, -4, 23, 203, 0 }, // U+FB05
+    { 27, 24, 412, 0, 23, 162, 203 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -3468,8 +3473,7 @@ static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3477,8 +3481,7 @@ static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3488,19 +3491,57 @@ static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
 };
 
 static const EpdFontGroup notosans_14_bolditalicGroups[] = {
-    { 0, 3972, 8359, 97, 0 },
-    { 3972, 3420, 9631, 96, 97 },
-    { 7392, 4462, 15710, 128, 193 },
-    { 11854, 4511, 13747, 96, 321 },
-    { 16365, 1449, 2300, 112, 417 },
-    { 17814, 11300, 31283, 256, 529 },
-    { 29114, 2758, 13038, 90, 785 },
-    { 31872, 2410, 5437, 111, 875 },
-    { 34282, 931, 1469, 42, 986 },
-    { 35213, 2182, 4021, 32, 1028 },
-    { 37395, 14, 12, 1, 1060 },
-    { 37409, 548, 1548, 7, 1061 },
-    { 37957, 132, 196, 1, 1068 },
+    { 0, 3511, 8010, 83, 2 },
+    { 3511, 952, 1775, 26, 0 },
+    { 4463, 3414, 9535, 95, 97 },
+    { 7877, 4462, 15710, 128, 193 },
+    { 12339, 4511, 13747, 96, 321 },
+    { 16850, 1449, 2300, 112, 417 },
+    { 18299, 11300, 31283, 256, 529 },
+    { 29599, 2758, 13038, 90, 785 },
+    { 32357, 2331, 5277, 105, 875 },
+    { 34688, 931, 1469, 42, 986 },
+    { 35619, 2182, 4021, 32, 1028 },
+    { 37801, 14, 12, 1, 1060 },
+    { 37815, 223, 378, 2, 1066 },
+    { 38038, 132, 196, 1, 1068 },
+};
+
+static const uint16_t notosans_14_bolditalicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_14_bolditalicKernLeftClasses[] = {
@@ -4552,18 +4593,81 @@ static const EpdLigaturePair notosans_14_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_14_bolditalicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 1, 0 }, { 0x0003, 0, 1 }, { 0x0004, 2, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 3, 3 }, { 0x0009, 2, 2 }, // U+0020
+    { 0x000A, 4, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 13, 0 }, { 0x002E, 14, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 15, 0 }, { 0x0033, 10, 10 }, { 0x0034, 16, 0 }, { 0x0035, 0, 13 }, { 0x0036, 17, 14 }, { 0x0037, 18, 15 }, { 0x0038, 19, 16 }, { 0x0039, 19, 16 }, // U+0050
+    { 0x003A, 13, 17 }, { 0x003B, 20, 18 }, { 0x003C, 21, 19 }, { 0x003D, 4, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 22, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 20 }, { 0x0044, 24, 0 }, { 0x0045, 25, 21 }, { 0x0046, 0, 21 }, { 0x0047, 24, 21 }, { 0x0048, 26, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 0, 0 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 27, 0 }, { 0x004E, 0, 0 }, { 0x004F, 0, 25 }, { 0x0050, 0, 25 }, { 0x0051, 24, 21 }, // U+0068
+    { 0x0052, 24, 25 }, { 0x0053, 0, 21 }, { 0x0054, 28, 25 }, { 0x0055, 0, 26 }, { 0x0056, 29, 27 }, { 0x0057, 0, 25 }, { 0x0058, 30, 28 }, { 0x0059, 30, 28 }, // U+0070
+    { 0x005A, 27, 0 }, { 0x005B, 30, 28 }, { 0x005C, 0, 29 }, { 0x005D, 4, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 31, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 32, 30 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 33, 31 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 34, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 32 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 18, 15 }, { 0x009B, 18, 15 }, { 0x009C, 18, 15 }, { 0x009D, 18, 15 }, { 0x009E, 20, 18 }, { 0x009F, 15, 0 }, { 0x00A0, 0, 24 }, // U+00D8
+    { 0x00A1, 23, 21 }, { 0x00A2, 23, 20 }, { 0x00A3, 23, 20 }, { 0x00A4, 23, 20 }, { 0x00A5, 23, 20 }, { 0x00A6, 23, 20 }, { 0x00A7, 24, 20 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 24, 21 }, { 0x00AA, 24, 21 }, { 0x00AB, 24, 21 }, { 0x00AC, 24, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 0, 0 }, { 0x00B0, 35, 0 }, // U+00E8
+    { 0x00B1, 24, 0 }, { 0x00B2, 0, 25 }, { 0x00B3, 24, 21 }, { 0x00B4, 24, 21 }, { 0x00B5, 24, 21 }, { 0x00B6, 24, 21 }, { 0x00B7, 24, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 30, 28 }, { 0x00BF, 24, 0 }, { 0x00C0, 30, 28 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 23, 20 }, { 0x00C3, 7, 9 }, { 0x00C4, 23, 20 }, { 0x00C5, 7, 9 }, { 0x00C6, 23, 20 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 36, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 24, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 24, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 24, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 24, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 24, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 33 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 37, 34 }, { 0x00EB, 0, 0 }, { 0x00EC, 35, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 38, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 24 }, { 0x00F7, 13, 0 }, { 0x00F8, 27, 0 }, // U+0130
+    { 0x00F9, 27, 25 }, { 0x00FA, 14, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 14, 0 }, { 0x00FD, 0, 0 }, { 0x00FE, 14, 0 }, { 0x00FF, 36, 0 }, { 0x0100, 14, 0 }, // U+0138
+    { 0x0101, 0, 0 }, { 0x0102, 14, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 0, 25 }, { 0x0106, 0, 0 }, { 0x0107, 0, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 25 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 25 }, { 0x010D, 10, 10 }, { 0x010E, 24, 21 }, { 0x010F, 10, 10 }, { 0x0110, 24, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 24, 21 }, { 0x0113, 11, 10 }, { 0x0114, 24, 21 }, { 0x0115, 0, 0 }, { 0x0116, 28, 25 }, { 0x0117, 0, 0 }, { 0x0118, 28, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 28, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 26 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 26 }, { 0x0123, 17, 14 }, { 0x0124, 29, 27 }, { 0x0125, 17, 14 }, { 0x0126, 39, 27 }, { 0x0127, 17, 14 }, { 0x0128, 29, 27 }, // U+0160
+    { 0x0129, 18, 15 }, { 0x012A, 0, 25 }, { 0x012B, 18, 15 }, { 0x012C, 0, 25 }, { 0x012D, 18, 15 }, { 0x012E, 0, 25 }, { 0x012F, 18, 15 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 18, 15 }, { 0x0132, 0, 25 }, { 0x0133, 18, 15 }, { 0x0134, 0, 25 }, { 0x0135, 19, 16 }, { 0x0136, 30, 28 }, { 0x0137, 20, 18 }, { 0x0138, 30, 28 }, // U+0170
+    { 0x0139, 20, 18 }, { 0x013A, 21, 19 }, { 0x013B, 0, 29 }, { 0x013C, 21, 19 }, { 0x013D, 0, 29 }, { 0x013E, 21, 19 }, { 0x013F, 0, 29 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 35 }, { 0x0214, 45, 0 }, { 0x0215, 46, 36 }, { 0x0216, 47, 37 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 48, 38 }, { 0x021A, 44, 39 }, { 0x021B, 44, 0 }, { 0x021C, 49, 35 }, { 0x021D, 50, 0 }, { 0x021E, 0, 0 }, { 0x021F, 51, 40 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 52, 41 }, { 0x0222, 53, 0 }, { 0x0223, 54, 0 }, { 0x0224, 45, 0 }, { 0x0225, 55, 42 }, { 0x0226, 0, 0 }, { 0x0227, 50, 43 }, { 0x0228, 54, 44 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 50, 0 }, { 0x022C, 0, 39 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 56, 36 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 57, 0 }, { 0x0232, 46, 36 }, { 0x0233, 45, 35 }, { 0x0234, 51, 40 }, { 0x0235, 58, 45 }, { 0x0236, 50, 43 }, { 0x0237, 55, 0 }, { 0x0238, 0, 46 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 55, 0 }, { 0x023B, 44, 35 }, { 0x023C, 0, 0 }, { 0x023D, 44, 0 }, { 0x023E, 56, 44 }, { 0x023F, 56, 0 }, { 0x0240, 0, 47 }, // U+0428
+    { 0x0241, 59, 48 }, { 0x0242, 60, 49 }, { 0x0243, 61, 48 }, { 0x0244, 62, 50 }, { 0x0245, 63, 51 }, { 0x0246, 62, 48 }, { 0x0247, 64, 52 }, { 0x0248, 61, 50 }, // U+0430
+    { 0x0249, 59, 53 }, { 0x024A, 59, 53 }, { 0x024B, 65, 54 }, { 0x024C, 59, 55 }, { 0x024D, 59, 54 }, { 0x024E, 59, 54 }, { 0x024F, 66, 48 }, { 0x0250, 67, 54 }, // U+0438
+    { 0x0251, 66, 54 }, { 0x0252, 64, 48 }, { 0x0253, 67, 54 }, { 0x0254, 68, 56 }, { 0x0255, 66, 48 }, { 0x0256, 65, 57 }, { 0x0257, 69, 53 }, { 0x0258, 59, 58 }, // U+0440
+    { 0x0259, 59, 53 }, { 0x025A, 69, 53 }, { 0x025B, 70, 59 }, { 0x025C, 59, 53 }, { 0x025D, 70, 53 }, { 0x025E, 66, 52 }, { 0x025F, 66, 54 }, { 0x0260, 59, 60 }, // U+0448
+    { 0x0261, 62, 48 }, { 0x0262, 62, 48 }, { 0x0263, 71, 61 }, { 0x0264, 62, 50 }, { 0x0265, 64, 48 }, { 0x0266, 72, 62 }, { 0x0267, 0, 0 }, { 0x0268, 73, 63 }, // U+0450
+    { 0x0269, 74, 64 }, { 0x026A, 70, 55 }, { 0x026B, 70, 54 }, { 0x026C, 67, 61 }, { 0x026D, 65, 54 }, { 0x026E, 59, 53 }, { 0x026F, 75, 65 }, { 0x0270, 59, 53 }, // U+0458
+};
+
 static const EpdFontData notosans_14_bolditalic = {
     notosans_14_bolditalicBitmaps,
     notosans_14_bolditalicGlyphs,
     notosans_14_bolditalicIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notosans_14_bolditalicGroups,
-    13,
-    nullptr,
+    14,
+    notosans_14_bolditalicGlyphToGroup,
     notosans_14_bolditalicKernLeftClasses,
     notosans_14_bolditalicKernRightClasses,
     notosans_14_bolditalicKernMatrix,
@@ -4573,4 +4677,8 @@ static const EpdFontData notosans_14_bolditalic = {
     83,
     notosans_14_bolditalicLigaturePairs,
     5,
+    notosans_14_bolditalicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
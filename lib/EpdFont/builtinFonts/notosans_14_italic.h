@@ -3,2191 +3,2198 @@
  * name: notosans_14_italic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_italicBitmaps[34990] = {
-    0xA5, 0x59, 0x3B, 0x8C, 0xDC, 0xD6, 0x15, 0xBD, 0x24, 0x2D, 0x11, 0x30, 0x11, 0x3F, 0x17, 0x56,
-    0xE0, 0x64, 0x61, 0x53, 0xA5, 0xE2, 0xD8, 0xCB, 0xD6, 0x01, 0x96, 0x43, 0xCA, 0x2E, 0x52, 0xA8,
-    0xC8, 0x16, 0x5A, 0x07, 0x88, 0x80, 0xA8, 0x49, 0xE1, 0x18, 0x30, 0xD4, 0xB8, 0x50, 0x82, 0x99,
-    0x1D, 0xC6, 0x2E, 0x5C, 0xB8, 0xD0, 0x36, 0xAE, 0xAD, 0x42, 0x85, 0xB1, 0x01, 0x22, 0x17, 0x5B,
-    0x6C, 0x90, 0x59, 0x0D, 0x23, 0x03, 0x49, 0xA1, 0x22, 0x4C, 0x1C, 0x25, 0x45, 0x0A, 0xD3, 0xB6,
-    0x62, 0x03, 0x76, 0x21, 0x3A, 0xA1, 0x20, 0x2A, 0xE2, 0x0C, 0x73, 0xCE, 0x25, 0x39, 0x33, 0xAB,
-    0x4F, 0x6C, 0x23, 0xA3, 0x21, 0xB5, 0xCB, 0xCF, 0x7D, 0xF7, 0x7B, 0xEE, 0xB9, 0x6F, 0x25, 0x12,
-    0xD9, 0x16, 0x39, 0x10, 0x99, 0x88, 0xD4, 0x22, 0x95, 0x48, 0x29, 0x56, 0x21, 0x76, 0x21, 0x4E,
-    0x2E, 0x4E, 0x26, 0x4E, 0x2A, 0x2E, 0xBE, 0x89, 0x78, 0xB1, 0xB4, 0x9F, 0x23, 0x22, 0x78, 0x69,
-    0xAC, 0xDF, 0x27, 0x44, 0xD6, 0xBD, 0x64, 0x60, 0x92, 0xD0, 0xC4, 0x43, 0x23, 0xE7, 0x7D, 0xD9,
-    0x7B, 0x4E, 0xDE, 0x7B, 0x56, 0x2E, 0x9E, 0xC0, 0x83, 0xE7, 0xF1, 0xAE, 0xEC, 0xE1, 0x55, 0x29,
-    0xF8, 0x72, 0x61, 0x44, 0xAC, 0x1C, 0x27, 0x3B, 0x7B, 0x5A, 0xEC, 0x5F, 0x7F, 0x3E, 0x7D, 0xD7,
-    0x6D, 0x9A, 0xA6, 0xB6, 0xCE, 0xBC, 0xFD, 0xDB, 0x4D, 0x31, 0xB2, 0x27, 0x38, 0x15, 0x22, 0x4F,
-    0xF3, 0x14, 0xDA, 0xB9, 0x44, 0xB8, 0x9B, 0xE9, 0xE9, 0x3E, 0x21, 0xBE, 0x40, 0xB5, 0x75, 0x9C,
-    0xD2, 0x8D, 0x4E, 0x29, 0x79, 0x0C, 0xC7, 0x53, 0xB8, 0x77, 0x25, 0x16, 0xBF, 0xA9, 0x65, 0x7C,
-    0xA5, 0x96, 0xEA, 0x3C, 0x2C, 0xD9, 0x83, 0x29, 0xEF, 0xE1, 0x7F, 0x08, 0x9D, 0xE1, 0x18, 0xE7,
-    0x22, 0xFE, 0x0C, 0x6F, 0x36, 0x89, 0x38, 0xD7, 0x60, 0xDE, 0x1B, 0x99, 0xB8, 0x38, 0xBC, 0x17,
-    0xB3, 0xE3, 0xC6, 0xA4, 0xD1, 0xE5, 0x46, 0x82, 0xA6, 0x12, 0x6B, 0x1B, 0x6B, 0x3D, 0x0B, 0x91,
-    0x94, 0x7F, 0xA2, 0x5F, 0xC3, 0x6A, 0x60, 0x94, 0x78, 0x4D, 0x0A, 0x15, 0xCD, 0x8B, 0x29, 0xBC,
-    0xB3, 0xEE, 0x64, 0x5E, 0x22, 0x1B, 0x4E, 0x06, 0x8D, 0x86, 0xAA, 0x0D, 0x8C, 0x2E, 0x45, 0xF6,
-    0xDD, 0xAB, 0x58, 0x68, 0xCF, 0xFB, 0xE1, 0x1F, 0x6E, 0xC8, 0xBE, 0x31, 0x58, 0x71, 0x38, 0x08,
-    0x47, 0x81, 0x44, 0xF5, 0x7E, 0x69, 0xC4, 0x7C, 0x54, 0xD0, 0x0E, 0xE7, 0x2A, 0xBD, 0x61, 0x5E,
-    0xE0, 0xCB, 0xEB, 0x6A, 0x0F, 0x44, 0x84, 0xB0, 0x91, 0x82, 0x9C, 0xCC, 0xC9, 0x4A, 0xF1, 0x12,
-    0xEB, 0x6E, 0x21, 0xB8, 0x3F, 0x4D, 0xA8, 0xC0, 0x23, 0x4B, 0x4D, 0x32, 0x81, 0x22, 0x58, 0xC9,
-    0x4F, 0x10, 0xB5, 0x40, 0x86, 0x22, 0x03, 0x2A, 0x3B, 0x60, 0x1C, 0x07, 0x16, 0xC2, 0xE8, 0x7B,
-    0xD0, 0xC0, 0x34, 0xB0, 0xC3, 0xE0, 0x37, 0x19, 0xC3, 0x78, 0xA7, 0xAA, 0xA4, 0x32, 0xD9, 0xC8,
-    0x2A, 0xFC, 0x38, 0x70, 0xF2, 0x81, 0x98, 0x6B, 0xE9, 0x40, 0xDC, 0x26, 0x1E, 0x88, 0x3D, 0x43,
-    0x50, 0xED, 0x5A, 0x82, 0xC4, 0x6F, 0xF0, 0x56, 0xE3, 0x27, 0x76, 0x53, 0x7A, 0x99, 0xAE, 0xB8,
-    0x3E, 0x08, 0x87, 0xE7, 0xF7, 0xDE, 0xBB, 0xC8, 0x74, 0x30, 0x09, 0x16, 0xE3, 0x6A, 0xA5, 0x38,
-    0x85, 0xB8, 0xB8, 0x90, 0x8A, 0x89, 0x79, 0x6D, 0x80, 0xA8, 0xE9, 0x9D, 0x89, 0x7E, 0xAB, 0x95,
-    0xEF, 0xBE, 0x5E, 0x19, 0xAA, 0x37, 0x9F, 0x13, 0x9A, 0xF3, 0x28, 0xC4, 0x22, 0x9C, 0xC8, 0x2C,
-    0xE4, 0x08, 0x62, 0x8D, 0x74, 0xB3, 0xF4, 0xCB, 0xE0, 0x97, 0x3C, 0x5B, 0xFD, 0x77, 0x91, 0x89,
-    0x5E, 0xCA, 0xD5, 0x7D, 0x5D, 0xA9, 0x55, 0x20, 0xE7, 0x35, 0x7F, 0x19, 0x20, 0x88, 0xE3, 0x15,
-    0x4A, 0x7E, 0xCD, 0x13, 0x69, 0x7E, 0x84, 0xB5, 0xE6, 0x2F, 0xED, 0xC8, 0x18, 0xDE, 0x9A, 0x7E,
-    0x3B, 0x71, 0x3E, 0x8B, 0xC5, 0xBC, 0x9F, 0x4A, 0x04, 0x61, 0xDF, 0x82, 0x58, 0x24, 0xD2, 0x22,
-    0xA3, 0x91, 0x7B, 0xF7, 0x1D, 0x5B, 0x67, 0xB7, 0x62, 0xA4, 0x5F, 0x31, 0x6D, 0x9A, 0xFC, 0x41,
-    0xF7, 0x35, 0xE7, 0x36, 0xED, 0xD2, 0x29, 0xDC, 0xD4, 0x24, 0xBE, 0xAC, 0xCB, 0xF3, 0x48, 0x5A,
-    0x7E, 0x8F, 0x6D, 0x41, 0x66, 0x84, 0x02, 0x19, 0xB3, 0x42, 0xD4, 0x07, 0x5C, 0x0F, 0x0A, 0xAB,
-    0x7E, 0x70, 0x18, 0x3D, 0x26, 0x23, 0xD1, 0x9A, 0xB3, 0x56, 0x6F, 0x25, 0xED, 0x2D, 0xB8, 0x92,
-    0x3E, 0xB3, 0xE0, 0x0B, 0xF8, 0x99, 0x8E, 0x5E, 0xDC, 0x1A, 0xF4, 0x49, 0xE0, 0x22, 0x1D, 0x23,
-    0x24, 0xE3, 0xDC, 0x2D, 0xEC, 0xD2, 0x2E, 0x9C, 0xDC, 0x2A, 0x21, 0xA2, 0xC2, 0x73, 0x95, 0x1F,
-    0x4B, 0x85, 0x67, 0x2B, 0x14, 0x6A, 0x39, 0x80, 0x94, 0x10, 0xEB, 0x8F, 0x20, 0x09, 0x47, 0x3E,
-    0x82, 0xB4, 0x11, 0xE2, 0x16, 0x22, 0x77, 0x22, 0x68, 0x19, 0x24, 0x33, 0x44, 0x1C, 0xEE, 0x84,
-    0x28, 0x55, 0x17, 0xBA, 0x04, 0x99, 0xD5, 0xA4, 0xDE, 0xDD, 0x34, 0xBA, 0x90, 0x3E, 0x05, 0x79,
-    0x50, 0xD8, 0x97, 0x65, 0x90, 0x47, 0x2B, 0x41, 0x5E, 0xA0, 0x85, 0x86, 0x89, 0x7A, 0xF2, 0x63,
-    0xC3, 0xE3, 0xAC, 0xA3, 0xED, 0x93, 0x33, 0x39, 0x4E, 0x80, 0x21, 0x64, 0xE8, 0x31, 0xE8, 0xEC,
-    0xAE, 0x5A, 0xC3, 0x0C, 0x5E, 0x88, 0xE0, 0x8E, 0x59, 0xFB, 0xAB, 0x9F, 0x2A, 0xAC, 0x30, 0x7F,
-    0x99, 0xBE, 0xC1, 0xDB, 0x5B, 0x9B, 0x40, 0x80, 0x7C, 0xCC, 0x08, 0xB4, 0x26, 0x67, 0x88, 0x66,
-    0x25, 0x57, 0xAC, 0x1A, 0x72, 0x47, 0x9D, 0x3C, 0x3A, 0x6B, 0xD8, 0xCA, 0x74, 0x51, 0x2D, 0xC8,
-    0xF9, 0x00, 0x6E, 0x3D, 0x32, 0x86, 0xC3, 0x90, 0xC2, 0x2A, 0x78, 0xF5, 0xF0, 0xB2, 0x1F, 0x48,
-    0x90, 0x42, 0xAE, 0xAC, 0xB1, 0x82, 0x34, 0x42, 0xB4, 0x06, 0xE9, 0x2F, 0x1E, 0x0E, 0x1F, 0xF9,
-    0x3A, 0xC2, 0x8D, 0x0A, 0x26, 0x7D, 0x84, 0x4A, 0xBF, 0x5A, 0x08, 0xAA, 0x45, 0x26, 0x4E, 0x66,
-    0x95, 0x6E, 0xEA, 0x66, 0x1E, 0xA2, 0x6D, 0x12, 0x54, 0x4F, 0x02, 0xBD, 0xE6, 0xC8, 0x8E, 0xD9,
-    0xB1, 0xAD, 0xF1, 0xE9, 0xC3, 0xAA, 0xE0, 0x08, 0x00, 0x43, 0x11, 0x7D, 0xB0, 0x7B, 0x89, 0xD2,
-    0xA9, 0x1D, 0x53, 0x9B, 0xD1, 0x46, 0xC6, 0x8B, 0xF3, 0xF9, 0x25, 0x98, 0x33, 0x17, 0xFB, 0x6D,
-    0xD6, 0x36, 0xCA, 0x48, 0x9D, 0xC7, 0x3C, 0xE0, 0xC1, 0x9F, 0x99, 0x0F, 0x7E, 0xB2, 0x27, 0x53,
-    0x99, 0x42, 0x54, 0xC0, 0x92, 0xDF, 0xEC, 0xEB, 0x7F, 0x5A, 0x22, 0x66, 0x85, 0x44, 0x3B, 0x8F,
-    0xF7, 0xAE, 0xD3, 0x14, 0xE1, 0x1B, 0x4C, 0x2E, 0xBF, 0x92, 0xC1, 0x14, 0xA9, 0x98, 0x05, 0xC9,
-    0x18, 0x57, 0x0F, 0x20, 0x6B, 0x82, 0xF2, 0x98, 0xE8, 0xFF, 0x3C, 0x4C, 0x3C, 0x42, 0x3C, 0xA3,
-    0xF8, 0x00, 0xEE, 0xAA, 0xD4, 0xAD, 0xF4, 0x03, 0x0A, 0xBF, 0xF2, 0x71, 0x1C, 0xD9, 0x7A, 0xE9,
-    0x01, 0x39, 0xD9, 0xA5, 0xEB, 0x6A, 0x26, 0x73, 0xB1, 0x68, 0x19, 0xD1, 0xFE, 0x96, 0x59, 0xB9,
-    0xB5, 0xC8, 0x07, 0x1F, 0xCE, 0x1E, 0x9F, 0xAC, 0xE1, 0x8B, 0x11, 0x9E, 0x0D, 0xBB, 0x63, 0x22,
-    0x13, 0x24, 0x79, 0x74, 0x16, 0x48, 0x32, 0x47, 0xEC, 0x6B, 0x20, 0xD1, 0x38, 0x36, 0x99, 0x49,
-    0xFD, 0xD8, 0xC9, 0x23, 0x58, 0x36, 0xE8, 0x8E, 0x08, 0x16, 0x06, 0xA9, 0x9F, 0x42, 0x47, 0x88,
-    0xAB, 0xDA, 0xAA, 0xE5, 0xC7, 0x43, 0x19, 0xB0, 0xC2, 0x67, 0x6E, 0xE1, 0x14, 0x88, 0x50, 0x26,
-    0x15, 0x54, 0xAB, 0xA1, 0x75, 0x7F, 0xE0, 0x77, 0xA7, 0x72, 0x73, 0x53, 0x3A, 0xCD, 0xBC, 0x90,
-    0xE9, 0xC7, 0x9D, 0x96, 0x84, 0x8B, 0x5E, 0xD3, 0x6D, 0x79, 0xDC, 0x66, 0xB8, 0xE0, 0x52, 0xA4,
-    0x8F, 0xA5, 0xBD, 0xCE, 0x2A, 0x9D, 0xCA, 0x29, 0xED, 0x5C, 0xEE, 0xF9, 0x1C, 0x2A, 0x6D, 0xBE,
-    0x1D, 0x25, 0xCC, 0xE1, 0x75, 0x79, 0xE8, 0x67, 0x53, 0xC1, 0x52, 0xE1, 0xAA, 0x2D, 0x25, 0xA4,
-    0xC9, 0xF3, 0x7A, 0xE7, 0xF1, 0xD6, 0x69, 0x01, 0x20, 0x70, 0xBE, 0xFC, 0x2F, 0xD3, 0x82, 0x50,
-    0xD0, 0xF7, 0xEE, 0xF0, 0x07, 0x5C, 0x70, 0x71, 0x43, 0xCE, 0xE5, 0xED, 0xF3, 0x7C, 0x0F, 0x00,
-    0x87, 0xB2, 0x98, 0xB2, 0x3F, 0xAE, 0x7C, 0xB6, 0xB6, 0x14, 0xB4, 0xF2, 0xDD, 0xDD, 0xDD, 0x9D,
-    0xB8, 0xCB, 0x3A, 0x95, 0x73, 0xFF, 0x0F, 0xED, 0xBA, 0x94, 0x0B, 0xF9, 0x6B, 0x58, 0x10, 0x3D,
-    0x51, 0x9F, 0xEF, 0x3A, 0xFD, 0xD1, 0x66, 0x27, 0x6A, 0xCA, 0xF5, 0x17, 0xEA, 0x1E, 0xBE, 0x87,
-    0x8C, 0x3F, 0xA2, 0x85, 0xD2, 0x0C, 0x12, 0x99, 0x8B, 0x53, 0xD2, 0x87, 0xB0, 0xC8, 0xF4, 0xAB,
-    0x3F, 0xA9, 0xE5, 0x3B, 0x55, 0x42, 0xA1, 0xEE, 0x39, 0x7A, 0x65, 0x87, 0xCB, 0x35, 0x33, 0x5A,
-    0x62, 0x8D, 0xD5, 0x51, 0x88, 0x90, 0xA2, 0x9E, 0x7A, 0x16, 0x15, 0xE5, 0x35, 0xC9, 0xBE, 0x89,
-    0xC7, 0x37, 0xD3, 0xA1, 0x2F, 0x95, 0x9B, 0x6E, 0x84, 0x4E, 0xEE, 0x25, 0x1B, 0x1B, 0x00, 0xD5,
-    0x78, 0x38, 0xF4, 0x62, 0xD0, 0x8A, 0xA1, 0x89, 0xC1, 0x2C, 0xCE, 0x1B, 0x94, 0x58, 0x81, 0x9F,
-    0xB7, 0xED, 0x7C, 0x68, 0x7E, 0x75, 0xD3, 0x4B, 0x37, 0xDC, 0xE6, 0x42, 0x13, 0x87, 0xD6, 0xCC,
-    0xAE, 0x34, 0x43, 0xDB, 0x5C, 0x55, 0x14, 0xD0, 0x26, 0xB9, 0x75, 0x8E, 0xA9, 0xDB, 0xB0, 0x09,
-    0x5A, 0xBB, 0x9B, 0x6D, 0x4C, 0x09, 0x70, 0x34, 0x52, 0xFD, 0x60, 0x58, 0x98, 0x01, 0x0B, 0x36,
-    0xE4, 0xA9, 0xDE, 0x10, 0x05, 0x4B, 0x84, 0x2B, 0x64, 0x45, 0x0D, 0x28, 0x70, 0xC0, 0x8E, 0x15,
-    0x10, 0x6A, 0x1B, 0x5A, 0x82, 0xD3, 0x7C, 0xF7, 0x32, 0xA3, 0xC0, 0x0C, 0x85, 0xF5, 0xEC, 0x80,
-    0x89, 0x0F, 0x90, 0x04, 0x9A, 0x22, 0x9F, 0x46, 0x5A, 0x19, 0xE3, 0x79, 0xC2, 0x87, 0xB1, 0xC6,
-    0xEC, 0xA5, 0x39, 0xBD, 0x1A, 0x71, 0xE9, 0x80, 0xAF, 0x75, 0x27, 0xBC, 0xBB, 0x8D, 0xB6, 0x86,
-    0xAC, 0x73, 0x19, 0x42, 0x8F, 0x5A, 0x9A, 0x74, 0x0D, 0x12, 0x13, 0xBB, 0xA4, 0x53, 0x2B, 0x26,
-    0x4A, 0xCD, 0x95, 0x6B, 0xD8, 0x0D, 0x48, 0x64, 0x15, 0xA0, 0x76, 0xCE, 0x11, 0x02, 0xF1, 0xF0,
-    0xB4, 0xB9, 0xB1, 0xA4, 0x03, 0xC8, 0x12, 0x5F, 0xF5, 0xDB, 0xF9, 0xA9, 0xE2, 0x58, 0xEB, 0x02,
-    0x66, 0x37, 0x20, 0xA4, 0x83, 0xDE, 0xB6, 0x73, 0x8C, 0x3A, 0xB4, 0xD3, 0x5A, 0xBE, 0xEF, 0xA4,
-    0x37, 0x88, 0xD7, 0x8A, 0xCA, 0xE2, 0xE7, 0x47, 0x63, 0xAA, 0x96, 0x60, 0x09, 0xF5, 0x22, 0x2F,
-    0x8E, 0xE7, 0x71, 0x6F, 0xDB, 0x19, 0xB5, 0x6D, 0x1C, 0xC3, 0x36, 0x93, 0xC2, 0x2C, 0x8F, 0x27,
-    0x37, 0x63, 0xC3, 0xCE, 0x49, 0x1E, 0x73, 0x76, 0xF8, 0x1C, 0xFE, 0x70, 0x51, 0xD1, 0x00, 0x5E,
-    0xF6, 0x92, 0x94, 0x09, 0x93, 0xB0, 0x9F, 0xC4, 0x01, 0xD3, 0x05, 0xB6, 0xD1, 0x40, 0xAF, 0x94,
-    0xED, 0xAD, 0x29, 0x6D, 0x63, 0x42, 0x36, 0x4C, 0x9B, 0x31, 0x60, 0x8F, 0xD0, 0x37, 0xDB, 0x3A,
-    0xAD, 0xC8, 0x59, 0xB6, 0xC9, 0xDF, 0xA3, 0x8C, 0xC3, 0xAA, 0x80, 0x6E, 0x74, 0x9D, 0xB9, 0xBE,
-    0xA5, 0xB1, 0x67, 0x6B, 0xF5, 0x65, 0xD9, 0x28, 0x79, 0x6C, 0xE3, 0xF5, 0x5E, 0xD4, 0xD7, 0x92,
-    0xA9, 0xDC, 0x0A, 0x32, 0x79, 0x3C, 0x44, 0xE6, 0xA8, 0xC3, 0xF9, 0xC9, 0xA2, 0xF0, 0xAC, 0xE9,
-    0x9C, 0xD4, 0x13, 0x4D, 0x74, 0xFA, 0xD7, 0x33, 0xA9, 0x3D, 0xFB, 0x1A, 0x31, 0x00, 0xD5, 0x22,
-    0xAE, 0xE3, 0x74, 0x6C, 0x4C, 0xF7, 0x0F, 0x78, 0x1A, 0xB5, 0xC5, 0xB6, 0xCD, 0x07, 0x22, 0xCD,
-    0x02, 0xF4, 0x75, 0xDA, 0x59, 0x74, 0x6E, 0xD1, 0x18, 0x0C, 0xC9, 0xAA, 0xB4, 0x03, 0x6B, 0x0F,
-    0x06, 0x63, 0x2D, 0xF1, 0x94, 0x5D, 0xD8, 0x45, 0x7B, 0x82, 0xFB, 0x73, 0xE5, 0x90, 0xA8, 0x50,
-    0xD2, 0x6C, 0x14, 0x19, 0x4E, 0xF0, 0xD2, 0xD9, 0x44, 0xFB, 0xB9, 0xC2, 0x90, 0xF6, 0x74, 0xED,
-    0xEA, 0x11, 0x4F, 0x03, 0x2E, 0x3E, 0xA2, 0x6C, 0x65, 0x71, 0x6D, 0x7F, 0x8F, 0x88, 0xAE, 0xF3,
-    0x65, 0x43, 0xEA, 0x1B, 0xC2, 0xAA, 0x53, 0xA2, 0x7B, 0xFA, 0xF0, 0x6A, 0xB7, 0x5B, 0xF1, 0x6F,
-    0x40, 0x80, 0x6F, 0x56, 0x89, 0x9A, 0x0A, 0x4A, 0xBA, 0x9E, 0xB5, 0xE2, 0xE1, 0xB0, 0xF3, 0xD1,
-    0xA4, 0x4B, 0xCB, 0xD5, 0xD6, 0xD9, 0x37, 0xF2, 0xAE, 0x49, 0xAE, 0x8A, 0xA2, 0x18, 0xCE, 0x25,
-    0xF0, 0x3D, 0xFA, 0xA3, 0x7C, 0xA7, 0x75, 0x14, 0x9E, 0x9A, 0x30, 0x00, 0x15, 0x7D, 0x5A, 0x5A,
-    0x74, 0x95, 0x4B, 0xC6, 0x89, 0x4B, 0x76, 0x81, 0x4B, 0xCE, 0x47, 0xE4, 0x22, 0x7F, 0xA7, 0xBC,
-    0x0F, 0x29, 0x8C, 0x78, 0x6A, 0x6E, 0x93, 0x9B, 0xFC, 0xBE, 0xA4, 0x9D, 0xE4, 0xD2, 0xD4, 0x24,
-    0xA0, 0x6A, 0x9D, 0xAB, 0xB0, 0x12, 0x29, 0x14, 0xA4, 0x63, 0xED, 0x89, 0x2A, 0x33, 0x5C, 0x61,
-    0x44, 0x8C, 0xC4, 0x92, 0xB8, 0x42, 0x45, 0x02, 0xBF, 0xD2, 0xD7, 0x55, 0x26, 0x35, 0xD0, 0xD4,
-    0x44, 0x42, 0x32, 0x1F, 0xC9, 0x7A, 0x66, 0x32, 0x8D, 0xC5, 0x99, 0x11, 0x87, 0xC1, 0x43, 0xEE,
-    0xE2, 0xE9, 0x89, 0x75, 0x3B, 0x95, 0xF5, 0xCA, 0xC6, 0x79, 0x58, 0x39, 0x9F, 0x80, 0xDD, 0x95,
-    0xCE, 0x07, 0xA9, 0xF5, 0x65, 0x81, 0xB3, 0xF3, 0x97, 0xC2, 0x7D, 0x3F, 0x73, 0xDF, 0xCF, 0xBD,
-    0xAB, 0x99, 0x79, 0x31, 0x33, 0xAF, 0xE7, 0x01, 0xAA, 0xEC, 0x64, 0x1E, 0x82, 0x9F, 0x58, 0xC5,
-    0xBE, 0x97, 0xFA, 0x82, 0x31, 0x23, 0x09, 0xE4, 0x5F, 0xB9, 0x01, 0xC3, 0xBF, 0x8D, 0xDF, 0x43,
-    0x88, 0xE6, 0xAC, 0x00, 0x66, 0x00, 0x65, 0x0F, 0xA0, 0x01, 0x93, 0xA8, 0x65, 0x74, 0xEB, 0x84,
-    0x6D, 0x3C, 0xA0, 0xA7, 0x44, 0x86, 0xD6, 0x5D, 0x58, 0x66, 0xFF, 0x1B, 0xDD, 0xD4, 0xF9, 0x24,
-    0x97, 0xD2, 0xF9, 0x73, 0x61, 0x15, 0x18, 0x49, 0x2C, 0x90, 0xDD, 0x89, 0x5D, 0x78, 0xE9, 0xD0,
-    0xC9, 0x81, 0x8D, 0x4E, 0x66, 0xE2, 0x00, 0x48, 0x2D, 0xE6, 0x14, 0xE4, 0x9B, 0xB7, 0x20, 0xDE,
-    0xFD, 0x13, 0x20, 0xD3, 0xF9, 0x30, 0x06, 0xE7, 0x6C, 0xB0, 0x16, 0x86, 0x26, 0xF8, 0x65, 0xCE,
-    0x21, 0xE0, 0x60, 0xC1, 0x06, 0x6E, 0x10, 0x96, 0x91, 0x0E, 0xCD, 0xC9, 0x69, 0x02, 0x34, 0x36,
-    0x29, 0x5A, 0x0A, 0x1A, 0x34, 0xC0, 0xA2, 0x08, 0x62, 0x6D, 0xF6, 0x6D, 0x6C, 0xEC, 0xE2, 0x80,
-    0xA7, 0x09, 0x63, 0x5E, 0x77, 0x27, 0x37, 0x27, 0x4F, 0xCB, 0x6A, 0x96, 0x16, 0xC3, 0x92, 0x6C,
-    0x33, 0x03, 0xA3, 0x18, 0xEE, 0xF3, 0x73, 0xA0, 0xBA, 0xA7, 0x1D, 0x71, 0xCA, 0x76, 0xB9, 0x80,
-    0xAB, 0x29, 0xAA, 0x67, 0x76, 0x86, 0xC5, 0x52, 0x23, 0x38, 0x23, 0x84, 0x66, 0x80, 0x03, 0x8D,
-    0x46, 0x46, 0x08, 0x50, 0xED, 0xA6, 0x76, 0xE5, 0x5D, 0x3F, 0x97, 0x6B, 0xC5, 0x37, 0x97, 0xBE,
-    0x66, 0xC5, 0xFF, 0x7F, 0x66, 0x38, 0x87, 0xCD, 0xF0, 0x7B, 0x33, 0x44, 0xCD, 0x28, 0x0F, 0x99,
-    0xA1, 0x8E, 0x53, 0xF8, 0x50, 0x34, 0x21, 0x35, 0x66, 0xF3, 0x5D, 0x31, 0x0D, 0xD3, 0xAE, 0x1C,
-    0xC0, 0xB4, 0x41, 0x67, 0xDA, 0x60, 0x69, 0x9A, 0x5B, 0x52, 0x94, 0x41, 0x0B, 0x36, 0x6F, 0x43,
-    0xC7, 0x18, 0xC5, 0x20, 0x4A, 0xFE, 0x60, 0x16, 0x73, 0xDA, 0x24, 0x4C, 0x65, 0x64, 0x72, 0xD6,
-    0x26, 0xB2, 0xD2, 0x6C, 0x8E, 0xDF, 0x35, 0xEC, 0xDA, 0xB7, 0xAA, 0xC3, 0xE4, 0xD9, 0x2E, 0x35,
-    0x51, 0xB1, 0x36, 0x99, 0x13, 0x39, 0x1F, 0x35, 0x1C, 0xC7, 0xAD, 0x6A, 0xA6, 0xAF, 0xC6, 0x94,
-    0x81, 0x79, 0xCD, 0x9A, 0x2A, 0xDE, 0x06, 0x64, 0xEF, 0x9B, 0xDA, 0x41, 0x6B, 0x1E, 0xC7, 0xCE,
-    0x5E, 0x3F, 0xDD, 0x3E, 0xFE, 0x80, 0xDA, 0x1F, 0x7C, 0xBD, 0xDA, 0x77, 0xBA, 0xDA, 0xD7, 0xE1,
-    0x91, 0x75, 0x56, 0x2C, 0xFA, 0x4D, 0xC6, 0x7E, 0x93, 0xB2, 0xDF, 0xA4, 0xAC, 0xB8, 0xA4, 0xEF,
-    0x37, 0x3E, 0xFB, 0x8D, 0x56, 0x71, 0x57, 0xCA, 0x23, 0xE6, 0xBA, 0xF2, 0x9A, 0xC9, 0x02, 0xF0,
-    0x26, 0xAC, 0x5E, 0x8E, 0x4A, 0x60, 0x75, 0x41, 0x4A, 0x40, 0x07, 0x61, 0x61, 0xAF, 0x53, 0xBE,
-    0xB9, 0x41, 0x29, 0x21, 0x63, 0x11, 0xB2, 0x4D, 0x0E, 0xBA, 0xDE, 0xCC, 0xCE, 0xEE, 0xB0, 0xA9,
-    0x03, 0x6B, 0x02, 0x5A, 0xE6, 0xD3, 0x2C, 0x9F, 0x21, 0x23, 0xD1, 0xC6, 0x89, 0x61, 0x3E, 0x49,
-    0x4C, 0x79, 0x83, 0xF4, 0xF8, 0x4D, 0xBA, 0xE9, 0x02, 0x39, 0xD8, 0x87, 0xD2, 0x31, 0x3B, 0xB7,
-    0xEE, 0x89, 0x09, 0x2D, 0x44, 0xB5, 0xC0, 0x26, 0x1F, 0xD8, 0x83, 0x58, 0x47, 0x58, 0xC4, 0xE4,
-    0xDA, 0x18, 0x82, 0x42, 0xF5, 0x1C, 0x14, 0xAA, 0xE9, 0x01, 0x91, 0x7E, 0x22, 0xB7, 0x68, 0xFF,
-    0xC4, 0x2A, 0x50, 0x99, 0x1C, 0x52, 0x50, 0xF3, 0x32, 0x74, 0x53, 0xCC, 0xF8, 0x32, 0x34, 0x49,
-    0xC1, 0x71, 0x1D, 0x48, 0xC0, 0xD9, 0x1C, 0xEC, 0x89, 0xBD, 0x65, 0x43, 0x4A, 0x38, 0x74, 0xB8,
-    0x8F, 0x17, 0x61, 0x51, 0x21, 0xB7, 0xA1, 0x52, 0x88, 0xFF, 0xA0, 0x54, 0x94, 0x29, 0x09, 0x8C,
-    0x52, 0x82, 0x01, 0x93, 0xF1, 0x4A, 0x9B, 0x78, 0x9A, 0x80, 0x3E, 0x03, 0xA3, 0xC4, 0xC4, 0x24,
-    0xE4, 0xB3, 0xA9, 0x47, 0x67, 0x63, 0x19, 0x1B, 0x04, 0x1D, 0x01, 0xA2, 0xF2, 0x77, 0xA9, 0xFC,
-    0x34, 0xED, 0xF9, 0xC3, 0x58, 0x69, 0x2A, 0x7E, 0x72, 0xBE, 0xA0, 0xC9, 0x7F, 0x64, 0x5A, 0x30,
-    0x72, 0xAC, 0x40, 0xA9, 0x2C, 0x1D, 0x1B, 0xAB, 0x16, 0x43, 0x15, 0x52, 0x35, 0x2C, 0x50, 0x75,
-    0x42, 0xC2, 0x43, 0x9F, 0xFA, 0x24, 0x0D, 0x31, 0xE7, 0xAD, 0xA8, 0x9B, 0x61, 0x2A, 0x71, 0x3E,
-    0x28, 0x54, 0x9E, 0x4D, 0xA6, 0xDE, 0x3C, 0x24, 0x4D, 0xEE, 0x99, 0xA3, 0xC8, 0x02, 0x75, 0x4B,
-    0x29, 0x93, 0x67, 0x76, 0x2F, 0xEB, 0x85, 0xB8, 0x63, 0x3A, 0x56, 0xDD, 0x3B, 0xDD, 0x1C, 0xBA,
-    0x2E, 0xCB, 0xEB, 0xD9, 0x83, 0xAF, 0x7B, 0x7A, 0x1D, 0x33, 0x2A, 0x05, 0x17, 0xED, 0x89, 0x63,
-    0x0C, 0xBE, 0xFE, 0xE9, 0xE5, 0xB8, 0xBC, 0x71, 0xB8, 0x39, 0xB4, 0xBB, 0x1A, 0xF9, 0xE1, 0xE6,
-    0xA0, 0x9D, 0x61, 0xD1, 0x1C, 0xA2, 0xD3, 0x12, 0x55, 0xF2, 0xCC, 0x25, 0xD9, 0x43, 0x22, 0xB0,
-    0x1D, 0x6F, 0x40, 0x4E, 0x08, 0x71, 0xEB, 0xDA, 0xB5, 0x8D, 0x36, 0x70, 0x2F, 0xF1, 0x52, 0x54,
-    0x77, 0xEA, 0xA4, 0x0E, 0x09, 0x97, 0xA7, 0xEB, 0x1E, 0x19, 0x7D, 0x93, 0xF5, 0xE4, 0xD0, 0x58,
-    0xBF, 0x21, 0xC7, 0x26, 0xDD, 0xBA, 0xCA, 0xE8, 0xFD, 0x36, 0x13, 0xE4, 0x97, 0xF0, 0x63, 0x49,
-    0x29, 0xFB, 0x62, 0x67, 0x1B, 0xE2, 0xA4, 0xEB, 0x42, 0x56, 0x6E, 0xC4, 0x4B, 0xD6, 0x75, 0x0B,
-    0xCE, 0xCE, 0xF7, 0x75, 0xE3, 0x46, 0xE4, 0xD8, 0xD6, 0x16, 0xC9, 0xA9, 0xBC, 0xB2, 0xBB, 0x2B,
-    0xA7, 0x35, 0x9E, 0x86, 0x2B, 0xC6, 0xB2, 0x96, 0x9F, 0x90, 0x69, 0x3D, 0x74, 0x66, 0x67, 0x2B,
-    0x2F, 0x77, 0x4B, 0x93, 0x02, 0x21, 0x15, 0x20, 0xB9, 0x0D, 0xD5, 0xEE, 0x49, 0x74, 0x83, 0x29,
-    0x8E, 0x20, 0x19, 0x02, 0x51, 0x22, 0xFB, 0x66, 0x1C, 0x34, 0x17, 0xC4, 0x9B, 0xF9, 0x8B, 0x91,
-    0xE4, 0xA1, 0x88, 0x5C, 0x61, 0x20, 0xB9, 0xD5, 0x94, 0xD6, 0xED, 0xBF, 0xD5, 0x00, 0xA4, 0x03,
-    0xA7, 0x06, 0xFA, 0xB5, 0x00, 0x1F, 0x22, 0x05, 0x46, 0xCC, 0x30, 0xD3, 0x0E, 0x85, 0x15, 0xF8,
-    0x75, 0xE1, 0xA7, 0x6E, 0x1E, 0xE4, 0x7E, 0x1A, 0x62, 0x48, 0xDE, 0x08, 0xAA, 0xB6, 0x53, 0x70,
-    0xD4, 0xC2, 0xEF, 0xCE, 0xEC, 0x27, 0x8A, 0xB0, 0xAB, 0xFB, 0x2D, 0xAB, 0x4B, 0xF5, 0xC7, 0x48,
-    0x93, 0xFC, 0x38, 0x20, 0x02, 0xE9, 0x48, 0x84, 0x7B, 0x62, 0x39, 0x85, 0xF9, 0x71, 0x5B, 0x2F,
-    0xAD, 0x84, 0x96, 0xF4, 0x91, 0xD4, 0x50, 0xC8, 0x5A, 0x8E, 0xB7, 0xA7, 0x35, 0xC0, 0xF6, 0xCE,
-    0x59, 0xD6, 0xB7, 0x4B, 0xEE, 0xAC, 0xE8, 0x41, 0xD0, 0x61, 0x98, 0xE8, 0x11, 0x19, 0xB5, 0xC4,
-    0x45, 0x6B, 0xC3, 0xF0, 0x04, 0x0B, 0xE9, 0x16, 0xA1, 0x5F, 0x84, 0x8E, 0x69, 0x3D, 0xD3, 0xBA,
-    0x66, 0xAD, 0x6A, 0x75, 0xBF, 0x13, 0x24, 0x64, 0xD9, 0xFC, 0x17, 0x40, 0x8B, 0x81, 0x75, 0x45,
-    0xF7, 0x4B, 0xC6, 0xA8, 0xEA, 0x83, 0xFB, 0x74, 0x7F, 0x52, 0xB7, 0x4A, 0xDD, 0xA5, 0xEE, 0x4F,
-    0x68, 0x57, 0x4B, 0xBB, 0x7D, 0x43, 0x35, 0x22, 0x38, 0x44, 0x5A, 0xAD, 0xF9, 0x45, 0x51, 0x83,
-    0xE5, 0xC8, 0x9D, 0xCD, 0xB6, 0xE2, 0xB4, 0xE4, 0xDA, 0xA1, 0x54, 0x4F, 0xDA, 0x42, 0x58, 0xE3,
-    0x0A, 0xCF, 0x6D, 0xF1, 0x69, 0x61, 0xE9, 0x68, 0x66, 0x1E, 0xE0, 0x98, 0xC3, 0x63, 0x89, 0xDD,
-    0xEF, 0x56, 0x72, 0xAC, 0xE6, 0x04, 0x59, 0x3D, 0xCA, 0xCE, 0x81, 0x77, 0x9A, 0x1F, 0xCF, 0x71,
-    0x17, 0xCD, 0x07, 0x7E, 0xAA, 0x29, 0xB8, 0xA6, 0xE0, 0x9A, 0x82, 0xC1, 0x92, 0xE3, 0xE5, 0x7C,
-    0xA5, 0xCE, 0x44, 0x08, 0x7D, 0x4E, 0xD2, 0x26, 0xFD, 0x1D, 0xA7, 0xAB, 0xCF, 0x88, 0x17, 0xA7,
-    0xA0, 0xC7, 0xE3, 0x4B, 0x3D, 0x7A, 0x15, 0x7E, 0x61, 0xEB, 0x60, 0x80, 0x35, 0xD7, 0x9A, 0xAF,
-    0x4E, 0xB4, 0x0C, 0x89, 0x56, 0x59, 0xB7, 0xAF, 0x33, 0xD1, 0x86, 0x48, 0xB4, 0x21, 0x96, 0x1B,
-    0x12, 0x81, 0xBB, 0x9D, 0x87, 0xCA, 0xA4, 0x56, 0xC9, 0x24, 0x33, 0x31, 0x12, 0x0D, 0xFE, 0x80,
-    0x42, 0x98, 0x24, 0xDD, 0x34, 0xA4, 0xCE, 0x8F, 0xB0, 0xC9, 0x77, 0x3B, 0x96, 0x97, 0x40, 0x47,
-    0x4B, 0xD2, 0x75, 0x0E, 0x4B, 0x84, 0x53, 0xC3, 0x9D, 0xA5, 0xD8, 0xD7, 0xFE, 0x14, 0xB6, 0xFB,
-    0xBD, 0x4A, 0x37, 0x97, 0x5B, 0xD0, 0x97, 0x96, 0x3B, 0x6E, 0x5F, 0xC9, 0x2F, 0x5B, 0x5E, 0xD7,
-    0x43, 0x01, 0xB4, 0x9C, 0xE6, 0x24, 0x98, 0x0F, 0x34, 0x6F, 0xB2, 0xA0, 0xED, 0xEF, 0x82, 0xEB,
-    0x81, 0xEA, 0x71, 0x9C, 0xE3, 0xF6, 0x0B, 0xD2, 0xF4, 0x63, 0x2C, 0xF4, 0x0F, 0xB4, 0xD4, 0x9B,
-    0xA9, 0x92, 0x63, 0x03, 0x3A, 0x68, 0x5E, 0x2F, 0xB4, 0x3B, 0x91, 0x18, 0x07, 0x3A, 0x3A, 0x04,
-    0x12, 0xB6, 0x53, 0xCE, 0x92, 0xDC, 0x8E, 0xEE, 0xC5, 0xA1, 0xC5, 0x36, 0xE1, 0x21, 0x1C, 0x4A,
-    0xDA, 0x5E, 0xB9, 0x54, 0x5A, 0x2E, 0x22, 0x89, 0x73, 0xF9, 0xB2, 0x29, 0xC6, 0x35, 0x0A, 0xFA,
-    0xD6, 0xAD, 0x2B, 0xF0, 0x74, 0x93, 0x44, 0xC8, 0x8C, 0x06, 0xED, 0x83, 0xC1, 0x8F, 0x20, 0x04,
-    0x03, 0xB1, 0x9B, 0x21, 0xE8, 0xA1, 0x0E, 0x9D, 0x43, 0x9D, 0x3F, 0x27, 0xE8, 0x4C, 0xB8, 0x63,
-    0x62, 0xAC, 0x50, 0xF9, 0x58, 0xC4, 0x2A, 0x03, 0x1D, 0x4A, 0x07, 0x3A, 0x9F, 0x86, 0xA2, 0xF7,
-    0x45, 0xD7, 0xE0, 0x0A, 0x88, 0xE3, 0x3F, 0x6B, 0xD0, 0xD4, 0x1E, 0x30, 0x26, 0x98, 0x0C, 0x6A,
-    0xEE, 0x4F, 0xAC, 0xC6, 0x11, 0x73, 0x3E, 0xC1, 0x2A, 0x8F, 0xC0, 0xED, 0x22, 0xDD, 0x15, 0xC0,
-    0xDD, 0xB5, 0x1B, 0x5D, 0xC1, 0x9D, 0x4B, 0xBD, 0xCC, 0xCD, 0xFD, 0x84, 0xCF, 0x70, 0x1D, 0x6E,
-    0xB4, 0xDA, 0xC5, 0xB0, 0x75, 0x1D, 0x4A, 0xDD, 0xCD, 0x86, 0x58, 0x7B, 0x1B, 0x46, 0x46, 0xF1,
-    0x15, 0x14, 0x56, 0xA5, 0x9B, 0x61, 0xFA, 0x39, 0x41, 0x98, 0xD9, 0xE0, 0xB8, 0x32, 0xBA, 0x35,
-    0xE5, 0xA6, 0x0C, 0x7A, 0xCC, 0x94, 0xDE, 0xA8, 0xBB, 0x36, 0xCB, 0x9C, 0xF6, 0x63, 0xFB, 0x3E,
-    0x6C, 0x80, 0xD4, 0x02, 0xC4, 0xCC, 0xAB, 0x30, 0x61, 0x9A, 0xCB, 0x28, 0x58, 0x73, 0x6A, 0xCE,
-    0x7A, 0xDD, 0x7C, 0x28, 0xE8, 0xF4, 0xBC, 0xF5, 0x1B, 0xE3, 0xF0, 0xB4, 0xC3, 0xE1, 0x77, 0x80,
-    0x36, 0x10, 0x1B, 0xDF, 0x3B, 0xE7, 0xAD, 0xF4, 0xDE, 0x8B, 0x50, 0xFF, 0xCB, 0x46, 0xAC, 0xDB,
-    0x9F, 0x2A, 0x29, 0xB4, 0xEB, 0xC3, 0x93, 0x5A, 0xCF, 0x0B, 0x1F, 0x36, 0x52, 0xCB, 0xB9, 0x1B,
-    0x70, 0x4D, 0x23, 0xDE, 0x8D, 0x57, 0x97, 0xCF, 0x71, 0x5B, 0xB4, 0xEC, 0x49, 0x66, 0xDA, 0x6E,
-    0x5A, 0xE9, 0x1E, 0x4E, 0xBB, 0xE6, 0x0E, 0x16, 0x60, 0x63, 0x1F, 0x2F, 0x36, 0xED, 0x44, 0x5E,
-    0x63, 0x2F, 0x82, 0xCF, 0xD6, 0xFE, 0xB3, 0x33, 0x6D, 0xB2, 0xB5, 0xEB, 0xF1, 0xFD, 0xC5, 0x11,
-    0xAD, 0xD4, 0x07, 0xBE, 0x51, 0x2D, 0x7E, 0x4D, 0x20, 0xB5, 0x77, 0xE4, 0x65, 0xA2, 0x2E, 0x92,
-    0x93, 0x95, 0x8C, 0xE8, 0x5B, 0x6D, 0x15, 0xC7, 0x5A, 0xC5, 0x8B, 0xE8, 0x87, 0xBA, 0xCF, 0xD3,
-    0xB6, 0xA9, 0x6D, 0xB8, 0x27, 0x02, 0x1A, 0x9B, 0xAE, 0x4D, 0xBD, 0x2C, 0xF6, 0xC5, 0x61, 0x17,
-    0xF5, 0x50, 0xD9, 0x22, 0xC9, 0x22, 0x5B, 0x61, 0xA5, 0xCC, 0x9C, 0x5B, 0xC9, 0x01, 0xFF, 0x6E,
-    0xC1, 0xC4, 0x87, 0x2E, 0x26, 0x6C, 0xB7, 0xA1, 0x0C, 0x87, 0xCD, 0x82, 0xA5, 0xFE, 0x5D, 0x39,
-    0x0A, 0xC9, 0x11, 0x58, 0x0F, 0xDD, 0xCF, 0xA9, 0xED, 0x6E, 0x0C, 0x19, 0xF6, 0x17, 0xA0, 0x92,
-    0xA1, 0x73, 0x0D, 0x5C, 0x32, 0x74, 0xAF, 0x25, 0x48, 0x7C, 0x73, 0x0A, 0x65, 0x18, 0xFA, 0xDE,
-    0x1B, 0x99, 0x84, 0xA1, 0xFB, 0x56, 0x2A, 0xE1, 0xD0, 0x05, 0xAB, 0x0C, 0xF7, 0xDC, 0x77, 0xC8,
-    0xE8, 0xDC, 0xDF, 0xC0, 0xB4, 0x9C, 0xC4, 0x32, 0x4A, 0xC9, 0x2C, 0x83, 0x44, 0x59, 0xCB, 0xCB,
-    0xF2, 0x68, 0x2C, 0xD4, 0x0A, 0x9E, 0xE0, 0x6E, 0x37, 0x51, 0xDB, 0xBC, 0x49, 0x3A, 0xFD, 0x21,
-    0x3C, 0xEE, 0xD0, 0xD3, 0xF6, 0x82, 0x8C, 0x72, 0x3F, 0x5C, 0x7C, 0x22, 0xC4, 0x88, 0xB1, 0x42,
-    0x65, 0x21, 0xA6, 0xEA, 0x50, 0x52, 0x5D, 0x6E, 0x80, 0xA9, 0xC1, 0xED, 0x98, 0xAD, 0x23, 0x31,
-    0x6D, 0xEE, 0xC7, 0x64, 0xEE, 0x82, 0x33, 0x52, 0x01, 0xD7, 0xF0, 0x75, 0x67, 0x58, 0xB3, 0x40,
-    0x43, 0x7B, 0x8E, 0x30, 0x3C, 0xEA, 0xD7, 0x60, 0x94, 0xDB, 0x0D, 0x13, 0xFD, 0x1B, 0x82, 0x82,
-    0x74, 0x20, 0xAB, 0x14, 0x6D, 0x5A, 0x48, 0xFF, 0x77, 0xB0, 0x57, 0x76, 0x77, 0x34, 0xEC, 0x5B,
-    0x67, 0xB3, 0x96, 0xA6, 0x0C, 0xDA, 0x4C, 0x6C, 0x77, 0xF7, 0xDB, 0xCE, 0xB5, 0x7A, 0xA9, 0xDF,
-    0x8E, 0xE6, 0x9C, 0xCD, 0x4D, 0x20, 0x79, 0x95, 0x63, 0xB6, 0x77, 0x43, 0x93, 0x42, 0x33, 0x71,
-    0x7D, 0xE5, 0x0F, 0x58, 0x95, 0xAC, 0x15, 0x32, 0x4E, 0xF8, 0x85, 0x2E, 0x0B, 0xE6, 0xD4, 0xFE,
-    0x25, 0x74, 0x01, 0x5A, 0x78, 0x9B, 0x1E, 0xFA, 0x99, 0xC8, 0xF9, 0xFF, 0xF5, 0x11, 0x79, 0x8C,
-    0xB9, 0x9E, 0x77, 0xC6, 0xD1, 0xCA, 0xE2, 0x1E, 0x9A, 0xCA, 0x6D, 0xFF, 0xB4, 0x3B, 0xD4, 0xC6,
-    0x36, 0xDF, 0xB1, 0x80, 0xD6, 0xC8, 0x7A, 0x57, 0x71, 0x1B, 0x87, 0x77, 0x57, 0x58, 0x05, 0xDF,
-    0x2F, 0x5A, 0x86, 0xF6, 0xBD, 0xBE, 0x69, 0x55, 0x72, 0xBC, 0x69, 0x3E, 0x2D, 0xF2, 0x35, 0x42,
-    0xCC, 0xCF, 0xE5, 0xBF, 0xC5, 0x5A, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0xE4, 0x67, 0x99, 0x49,
-    0x08, 0xE4, 0xD3, 0xA0, 0x14, 0x06, 0xDC, 0x98, 0x1E, 0x32, 0xA4, 0x81, 0x2D, 0xAE, 0x1A, 0x74,
-    0x24, 0x93, 0x2E, 0x05, 0x32, 0x44, 0x83, 0xD5, 0x02, 0x1D, 0x9A, 0x8C, 0x01, 0x0A, 0x54, 0x8B,
-    0x07, 0xB7, 0xB8, 0x93, 0xD8, 0x64, 0xC8, 0xD0, 0x21, 0x5E, 0x32, 0xD7, 0x05, 0xB2, 0xD4, 0x8B,
-    0x3C, 0x78, 0x10, 0x50, 0x5A, 0xC7, 0xA4, 0x43, 0xC7, 0xB2, 0x08, 0x32, 0x87, 0x45, 0x93, 0xA1,
-    0x08, 0x0A, 0x33, 0x08, 0xD3, 0xD0, 0x0D, 0x25, 0xF6, 0xF7, 0x7B, 0xE4, 0x9D, 0x4E, 0x8E, 0xD1,
-    0x34, 0xC0, 0x59, 0x3E, 0xDD, 0xF7, 0x49, 0x77, 0xFC, 0xF8, 0xDE, 0xFB, 0xDE, 0xF7, 0xFE, 0xFC,
-    0xDE, 0xA3, 0x64, 0x5D, 0x64, 0x4F, 0xDF, 0x23, 0x19, 0x5E, 0x6F, 0x88, 0xDC, 0x11, 0xA9, 0xF8,
-    0x76, 0x4A, 0x71, 0x0B, 0x31, 0x85, 0x78, 0xB9, 0xF8, 0xB9, 0x58, 0xBC, 0x53, 0x09, 0x12, 0x09,
-    0x13, 0x89, 0x85, 0xEF, 0xE7, 0x86, 0x7B, 0x9C, 0x42, 0xB8, 0x52, 0xFC, 0x7F, 0x8A, 0x4C, 0x3B,
-    0x31, 0x47, 0x3F, 0x17, 0x8B, 0x8F, 0x41, 0xAA, 0xAB, 0x64, 0x82, 0x91, 0x0D, 0xA3, 0x5D, 0x18,
-    0xFC, 0xBC, 0x27, 0xAB, 0x12, 0x7E, 0x53, 0x89, 0xDF, 0x95, 0x22, 0x5F, 0xE1, 0x8B, 0xB2, 0x27,
-    0x27, 0xC9, 0x4C, 0x20, 0x5C, 0xC2, 0xDF, 0x7B, 0xBC, 0x7E, 0xE4, 0xE6, 0xE2, 0x42, 0x34, 0x31,
-    0xF8, 0x20, 0x1E, 0x97, 0x41, 0x34, 0xA1, 0x70, 0x42, 0xD9, 0xFA, 0xC9, 0x74, 0x1D, 0x44, 0xEE,
-    0xBA, 0xBC, 0xE7, 0x2E, 0x11, 0x27, 0xDD, 0xDF, 0x98, 0x53, 0x83, 0xA1, 0x44, 0x2E, 0x7E, 0xBC,
-    0x7D, 0x4D, 0xE2, 0xAE, 0x6B, 0x38, 0xD5, 0x90, 0xC3, 0x91, 0x1B, 0x2F, 0xBD, 0x9A, 0xE0, 0x83,
-    0xD8, 0x8F, 0x8F, 0x24, 0x90, 0xAB, 0xF8, 0xB1, 0xB2, 0x89, 0xC1, 0xDF, 0x97, 0xF0, 0x63, 0xD3,
-    0xB1, 0x84, 0xDD, 0xB1, 0x4C, 0xA6, 0xBF, 0x4F, 0x2F, 0x8B, 0x4B, 0xEE, 0x36, 0xC5, 0x14, 0x52,
-    0x4B, 0x13, 0x8A, 0xD5, 0x80, 0x36, 0xA9, 0x57, 0x94, 0xAE, 0xA6, 0x38, 0x07, 0x21, 0x39, 0x93,
-    0xF5, 0x26, 0x59, 0xC7, 0xB8, 0x68, 0xBB, 0x0E, 0x8A, 0xEC, 0xB8, 0xAF, 0x80, 0x22, 0x71, 0xC5,
-    0x4B, 0xD3, 0xDB, 0xB8, 0x08, 0xDA, 0xF2, 0xDC, 0xE4, 0xDA, 0x4C, 0xD6, 0x6C, 0x26, 0xB0, 0xDC,
-    0x38, 0x79, 0x0D, 0x6A, 0x39, 0xFD, 0xCD, 0x9A, 0xA8, 0x0A, 0xE3, 0xCF, 0x2B, 0xDC, 0xB4, 0xAA,
-    0xF7, 0x50, 0xC5, 0x7B, 0x60, 0x11, 0xD6, 0x38, 0x95, 0x63, 0xC8, 0x15, 0x27, 0x5E, 0x6E, 0x73,
-    0x3F, 0xF7, 0x30, 0xFC, 0xD4, 0x2B, 0x6D, 0xE2, 0x1E, 0xE1, 0x6C, 0xF6, 0x70, 0xDD, 0xAF, 0x87,
-    0x1B, 0x36, 0x95, 0xF5, 0x65, 0xA7, 0x85, 0x2C, 0x15, 0xF6, 0x9A, 0xCE, 0x4E, 0x61, 0x6C, 0x93,
-    0x2C, 0x48, 0x5E, 0x78, 0x7A, 0xF6, 0xD9, 0xED, 0xC8, 0x23, 0xFC, 0x6C, 0x3F, 0xA5, 0x84, 0x6E,
-    0x4D, 0x0D, 0x40, 0xCB, 0x56, 0xC2, 0x4F, 0xAD, 0x3C, 0xEF, 0x74, 0xAD, 0x97, 0x6E, 0x9A, 0x72,
-    0xCD, 0xCD, 0x37, 0x70, 0x3A, 0x4E, 0x71, 0xDD, 0x42, 0x92, 0xF2, 0x8E, 0xC5, 0x3D, 0xD5, 0xE2,
-    0xDC, 0x7F, 0xBF, 0xE1, 0xA7, 0x58, 0xB3, 0x09, 0x9D, 0xB9, 0xF9, 0x55, 0xB7, 0x6B, 0x4D, 0x6E,
-    0x21, 0x96, 0xD5, 0xD3, 0x1D, 0x89, 0x53, 0x8B, 0x03, 0x66, 0xF1, 0x7B, 0x3B, 0x60, 0x71, 0xBE,
-    0x3B, 0x22, 0xFB, 0x95, 0x41, 0x8A, 0x26, 0xB7, 0xFB, 0xF9, 0x55, 0x2F, 0xDD, 0xF0, 0xD2, 0xEB,
-    0x5E, 0x72, 0xC7, 0x17, 0x90, 0xBD, 0x1B, 0x49, 0xF4, 0x2F, 0x09, 0x7E, 0x22, 0xB2, 0xEA, 0x40,
-    0x70, 0x3F, 0x71, 0xAA, 0x50, 0xFC, 0x22, 0x93, 0xF0, 0xE5, 0x5A, 0xEE, 0x79, 0xA5, 0x64, 0x30,
-    0xE5, 0x11, 0xC4, 0x0A, 0x21, 0xB3, 0x7D, 0xA5, 0x02, 0x1B, 0x88, 0x9F, 0xF7, 0x8A, 0xDD, 0xDE,
-    0xDE, 0x4E, 0xBA, 0xAE, 0xAB, 0xA6, 0x18, 0x30, 0xC5, 0x47, 0x0C, 0x81, 0x89, 0x40, 0x3B, 0xF2,
-    0xDC, 0xF6, 0x77, 0xE9, 0xC2, 0xED, 0x6E, 0x42, 0x17, 0xA6, 0x6B, 0xA8, 0x8B, 0x22, 0x83, 0x2E,
-    0x4C, 0x31, 0x82, 0x2E, 0x30, 0x43, 0x17, 0xA6, 0x18, 0x43, 0x0B, 0x06, 0xA6, 0xC7, 0xB9, 0x80,
-    0x2E, 0xCC, 0xDF, 0x2A, 0xE8, 0xC2, 0x14, 0x0D, 0x74, 0x81, 0xAB, 0xD0, 0x85, 0x29, 0x22, 0xE8,
-    0xC2, 0x14, 0xF6, 0xB5, 0xEF, 0xD6, 0x05, 0x4E, 0xAB, 0xCB, 0x63, 0xB5, 0x2A, 0xF1, 0x8E, 0x25,
-    0xD8, 0xCF, 0x37, 0xDD, 0xF2, 0x86, 0x54, 0xFA, 0x2E, 0x47, 0x20, 0xD2, 0xA5, 0xEE, 0x83, 0x7E,
-    0xB9, 0xFD, 0xF6, 0xD8, 0xDE, 0xD9, 0xDE, 0xE2, 0xC6, 0x6F, 0xEF, 0xDF, 0xBE, 0xF5, 0xA8, 0xEB,
-    0xF2, 0x4C, 0xCF, 0x85, 0x6B, 0x38, 0xE4, 0x30, 0xF1, 0xBA, 0xDC, 0x75, 0xCB, 0x21, 0x4E, 0xD0,
-    0x17, 0xE8, 0xEB, 0x50, 0x11, 0x54, 0xBB, 0xCE, 0x48, 0x90, 0x20, 0x18, 0x38, 0x87, 0x30, 0xCC,
-    0xDC, 0xC1, 0x02, 0x2C, 0x33, 0xB9, 0xB3, 0x93, 0x98, 0x56, 0xCD, 0xDE, 0x4B, 0xF1, 0x4E, 0x6C,
-    0x72, 0x38, 0x95, 0x1D, 0x35, 0x71, 0xD9, 0x32, 0x95, 0x9F, 0x07, 0x30, 0xBF, 0x55, 0x91, 0x1F,
-    0x89, 0x9B, 0x62, 0xBB, 0xA0, 0x34, 0x61, 0xE0, 0xC9, 0xE8, 0xD9, 0x98, 0x12, 0xE8, 0x17, 0xF7,
-    0xD6, 0x70, 0x19, 0xF0, 0x89, 0xE8, 0xC8, 0x23, 0x31, 0x55, 0xEF, 0x7B, 0x2D, 0xF4, 0xEE, 0xB6,
-    0x88, 0x0B, 0x5E, 0x23, 0x7E, 0xB5, 0x5E, 0xC3, 0xCF, 0x9A, 0x4A, 0xEC, 0x5E, 0x59, 0x49, 0x70,
-    0x4E, 0x16, 0x7C, 0xED, 0xE1, 0x90, 0x90, 0xCD, 0x0E, 0xD2, 0xE9, 0xBA, 0xD6, 0xC7, 0x08, 0xBA,
-    0xE6, 0x4A, 0x88, 0x11, 0xFF, 0x8F, 0xC1, 0x35, 0x60, 0x70, 0x05, 0x87, 0x7F, 0x45, 0x56, 0x6E,
-    0x5C, 0x11, 0xD9, 0xF8, 0x3F, 0xC7, 0x0B, 0x17, 0x2E, 0x20, 0xEE, 0x4D, 0xE5, 0x10, 0x5E, 0x6B,
-    0x72, 0x2F, 0xF1, 0x4B, 0x04, 0xDB, 0xEA, 0x97, 0x25, 0x9C, 0xF5, 0x96, 0x57, 0x85, 0xD5, 0xAF,
-    0x4B, 0xB7, 0x30, 0xB9, 0xA1, 0x9F, 0xA6, 0x7E, 0x62, 0x35, 0xF6, 0xD0, 0xCA, 0x8E, 0xC4, 0xEE,
-    0x27, 0x57, 0x4D, 0xBA, 0x61, 0xF2, 0xEB, 0x7C, 0xD3, 0xE2, 0x6F, 0x58, 0x89, 0x33, 0x81, 0x4D,
-    0xBB, 0xB2, 0x25, 0x7E, 0x4A, 0x5B, 0x3E, 0x80, 0x2E, 0xC6, 0x50, 0x0F, 0x36, 0xD9, 0x60, 0xCB,
-    0xAD, 0x4D, 0x0D, 0x5C, 0xDF, 0xCF, 0x33, 0x09, 0xA8, 0x2E, 0xA8, 0xF4, 0xBA, 0x1D, 0xF6, 0x7B,
-    0x01, 0xCB, 0x1C, 0xAA, 0xCD, 0x6F, 0xA1, 0xE0, 0x4B, 0x37, 0xA8, 0x9D, 0xBB, 0xD4, 0x49, 0x8D,
-    0x1F, 0xA9, 0x70, 0xB6, 0x08, 0x64, 0x70, 0xDF, 0xD2, 0xCA, 0x2D, 0xB7, 0x18, 0x99, 0xCA, 0xE4,
-    0x07, 0x7E, 0x65, 0x3E, 0xA8, 0x2E, 0x95, 0xE6, 0xED, 0xFC, 0x37, 0xF0, 0x9E, 0xE4, 0x4B, 0x9C,
-    0xB5, 0xF9, 0x73, 0x8E, 0xF8, 0x60, 0x52, 0xA9, 0xC2, 0xFD, 0xD2, 0x14, 0x88, 0x1C, 0xF0, 0x67,
-    0x4B, 0x7D, 0x33, 0x7C, 0xCA, 0xB3, 0x64, 0xC4, 0x7C, 0x42, 0x4E, 0x02, 0x56, 0xB8, 0x0A, 0x5E,
-    0x3C, 0x8E, 0xBB, 0x1A, 0x70, 0x94, 0x5B, 0xCF, 0x4E, 0xF9, 0x91, 0xE1, 0x79, 0x38, 0x52, 0x31,
-    0x82, 0x9B, 0x81, 0xE5, 0x9A, 0x15, 0xF0, 0x04, 0x31, 0x30, 0xA5, 0x91, 0xC1, 0x0C, 0x60, 0x5F,
-    0xEB, 0x7A, 0x70, 0x63, 0x0D, 0xE6, 0x15, 0x69, 0x82, 0x38, 0xF6, 0x8C, 0x3F, 0x6A, 0x9E, 0xB5,
-    0xE9, 0x5A, 0x10, 0xE7, 0xEC, 0x4C, 0x13, 0x98, 0x9A, 0x07, 0x17, 0xB3, 0xE2, 0xC2, 0x0A, 0x47,
-    0x9A, 0x66, 0x0E, 0x98, 0xB3, 0x60, 0x44, 0xCE, 0xEB, 0xA9, 0xC9, 0x55, 0xB9, 0x0C, 0xC7, 0xC9,
-    0x3A, 0xD3, 0x4B, 0x3E, 0x86, 0xF5, 0x99, 0xBC, 0x82, 0xE5, 0xF9, 0x6F, 0x17, 0x71, 0xBA, 0x3B,
-    0xF5, 0xD3, 0x3F, 0x25, 0x61, 0x13, 0xB8, 0x9F, 0xD0, 0x70, 0xBC, 0x77, 0x19, 0x96, 0x9F, 0xC5,
-    0xBE, 0xDC, 0x72, 0xF3, 0x12, 0x93, 0xD0, 0xF1, 0x14, 0x1B, 0x4E, 0x98, 0x73, 0x22, 0x8D, 0xA1,
-    0x10, 0xEC, 0x86, 0x06, 0x8B, 0xEB, 0xBD, 0x8D, 0x1D, 0x71, 0xF3, 0x7D, 0x24, 0xE7, 0xEB, 0x96,
-    0x3A, 0x43, 0x41, 0xCB, 0xDE, 0xE3, 0x15, 0x58, 0x00, 0x92, 0x65, 0xA4, 0x4B, 0x33, 0x7D, 0xEF,
-    0xCA, 0xE5, 0xF8, 0xF3, 0x26, 0xE8, 0x6A, 0xE7, 0x8F, 0xB4, 0xCB, 0x64, 0x96, 0xEF, 0x0C, 0x03,
-    0x90, 0xAA, 0xAB, 0x37, 0xDD, 0x73, 0x73, 0xD3, 0xE5, 0x77, 0x86, 0x1C, 0x7C, 0x4E, 0x96, 0x36,
-    0x1D, 0x72, 0xC9, 0x88, 0x53, 0xBB, 0xC9, 0x15, 0x23, 0xDE, 0x3F, 0x22, 0xA5, 0x88, 0xA9, 0x32,
-    0xA2, 0x9A, 0x42, 0x66, 0x9D, 0x8E, 0xDE, 0x8A, 0xE9, 0xF8, 0xF6, 0x3E, 0xD5, 0x19, 0x24, 0xF0,
-    0x26, 0x9B, 0x68, 0xC2, 0x87, 0x5C, 0x36, 0x45, 0x1E, 0xB5, 0xF9, 0x64, 0x48, 0xB4, 0xCE, 0x16,
-    0x85, 0x29, 0x67, 0x29, 0x57, 0x7D, 0xE9, 0xAE, 0x2C, 0xA6, 0xEC, 0xB3, 0x93, 0x65, 0x8D, 0xEC,
-    0x8E, 0xC9, 0xAD, 0x23, 0xA3, 0xDF, 0x41, 0xA0, 0x11, 0x91, 0xC8, 0xEA, 0x5C, 0x98, 0x33, 0x93,
-    0xC5, 0x49, 0x20, 0x4C, 0x50, 0x83, 0x60, 0x84, 0x90, 0x2E, 0xD7, 0x83, 0xB2, 0xCF, 0x3F, 0x67,
-    0x2D, 0x06, 0x77, 0x6E, 0x7F, 0x5C, 0x0E, 0xD3, 0x8A, 0x33, 0xCF, 0xE0, 0x67, 0x7B, 0x32, 0x07,
-    0x64, 0x74, 0x9F, 0x96, 0x82, 0xB8, 0x20, 0x3E, 0x27, 0xEF, 0x1D, 0x88, 0xE6, 0xF2, 0xB4, 0x18,
-    0xE1, 0xCF, 0x5A, 0x20, 0x64, 0x47, 0x02, 0x9C, 0xB8, 0xFF, 0x75, 0x74, 0x04, 0xF0, 0x07, 0xDA,
-    0xEA, 0x92, 0xE6, 0xEF, 0xEA, 0x50, 0xF6, 0x43, 0x75, 0xAE, 0xE0, 0x15, 0xFD, 0x15, 0x2B, 0xC8,
-    0x94, 0x8C, 0xB9, 0x1C, 0x39, 0xD7, 0x23, 0x66, 0x43, 0x82, 0xE2, 0x2F, 0xBF, 0xB0, 0x1F, 0x23,
-    0xF9, 0x07, 0x9D, 0xC2, 0xA3, 0x21, 0xE5, 0x1E, 0xDE, 0x9E, 0xF6, 0x68, 0x2D, 0xEC, 0xDD, 0x34,
-    0xEE, 0x5D, 0x96, 0xEE, 0x01, 0x89, 0x76, 0xC1, 0x2E, 0x24, 0x8C, 0x6D, 0xE1, 0xDA, 0x90, 0xBA,
-    0x9D, 0x67, 0x9C, 0x07, 0x4A, 0x08, 0xDF, 0xDD, 0xFC, 0x85, 0xB8, 0xFC, 0xDA, 0xAB, 0xFA, 0x5B,
-    0x7A, 0x00, 0xBD, 0x80, 0x61, 0x27, 0xF3, 0x5C, 0xD5, 0x3E, 0x62, 0xD2, 0x0B, 0xBB, 0x2A, 0x39,
-    0xC5, 0x09, 0xCA, 0xF3, 0x89, 0xA8, 0xB4, 0x8E, 0xCA, 0xC7, 0xE8, 0x26, 0xCF, 0x6B, 0x06, 0x4C,
-    0x35, 0xC4, 0x0D, 0x93, 0x43, 0xD0, 0xE2, 0x28, 0x8E, 0xA0, 0x63, 0x2B, 0x32, 0x6E, 0x06, 0x20,
-    0x78, 0xE9, 0x04, 0x5C, 0x50, 0x70, 0x4A, 0x4D, 0xB5, 0xD5, 0xFD, 0xB1, 0x71, 0x29, 0x07, 0xF5,
-    0x44, 0x25, 0x51, 0x43, 0x60, 0x98, 0x50, 0x37, 0x8C, 0x0C, 0x76, 0x80, 0xB7, 0xE1, 0x20, 0x3F,
-    0x07, 0xD5, 0x30, 0x23, 0x85, 0x17, 0x8E, 0x00, 0x68, 0x49, 0x23, 0x1B, 0x57, 0x8F, 0x4E, 0x2C,
-    0xE3, 0xB1, 0xF0, 0x5B, 0x19, 0x94, 0x83, 0x30, 0x6D, 0xFE, 0x41, 0x53, 0xA9, 0x10, 0x3F, 0x57,
-    0x1F, 0xE3, 0xFE, 0x56, 0xA1, 0xE2, 0x5A, 0xE1, 0xA5, 0x9B, 0x6C, 0xCD, 0x9D, 0xF0, 0x71, 0xF0,
-    0x5A, 0x19, 0x6C, 0x86, 0xAA, 0xD4, 0x33, 0xBC, 0x7B, 0xA2, 0x4B, 0x24, 0x51, 0xD9, 0x3B, 0xEE,
-    0xAF, 0xD1, 0x15, 0x38, 0x1E, 0x26, 0x1A, 0x0F, 0x44, 0x47, 0x43, 0x62, 0xC9, 0x06, 0x33, 0x78,
-    0x48, 0xBE, 0xF0, 0x98, 0xE2, 0xCB, 0x90, 0x92, 0xC8, 0x30, 0x1C, 0x6E, 0xA8, 0x4E, 0x12, 0xC0,
-    0x63, 0xE1, 0x47, 0x6F, 0x6D, 0x15, 0xD8, 0x4A, 0xF0, 0x1A, 0xEE, 0x01, 0x4C, 0xD8, 0x1A, 0x18,
-    0x3E, 0x16, 0x7E, 0x74, 0x21, 0xF8, 0x47, 0x08, 0x3E, 0x4F, 0xB9, 0x27, 0xC5, 0xE8, 0xE3, 0xE0,
-    0x15, 0x74, 0x37, 0x45, 0xCB, 0x4A, 0x89, 0x7F, 0xDA, 0x11, 0x06, 0x04, 0x5A, 0x4C, 0xB2, 0x92,
-    0x73, 0x39, 0xE1, 0xA6, 0x86, 0x14, 0x70, 0x6F, 0xF3, 0x83, 0x07, 0xD7, 0xA4, 0x01, 0xFC, 0x74,
-    0xEA, 0xB8, 0xAB, 0xDD, 0x1A, 0xF6, 0x02, 0x50, 0x86, 0x22, 0xBD, 0x64, 0x8D, 0x5E, 0x40, 0x9A,
-    0x20, 0x87, 0x38, 0x7B, 0x90, 0x09, 0x88, 0x26, 0x78, 0x6F, 0xA7, 0xEE, 0xA3, 0x54, 0xD8, 0x7D,
-    0xDA, 0x57, 0x0A, 0x30, 0x89, 0xB8, 0xBC, 0xC3, 0x08, 0x04, 0x4B, 0x2B, 0xF7, 0xF2, 0x85, 0xAC,
-    0x3D, 0x21, 0xA4, 0x9A, 0x52, 0xEC, 0x4E, 0xA7, 0x54, 0xC6, 0xCE, 0x37, 0x80, 0xDE, 0xEE, 0x97,
-    0x85, 0x34, 0xF4, 0x97, 0x1A, 0xF5, 0x89, 0x03, 0x6E, 0xB5, 0x03, 0x90, 0x96, 0xB9, 0x00, 0xEB,
-    0x63, 0x53, 0x22, 0x1E, 0xA3, 0xB2, 0x48, 0xA0, 0x27, 0x00, 0xD5, 0x57, 0x01, 0xDF, 0x91, 0x84,
-    0x43, 0xF1, 0xFE, 0x8A, 0x30, 0x6D, 0x3E, 0x49, 0x46, 0xA8, 0x8D, 0xA0, 0x03, 0xA7, 0xA3, 0x12,
-    0x8E, 0x99, 0x14, 0xEE, 0xCD, 0xB2, 0xB6, 0x86, 0x34, 0x85, 0xE4, 0xFE, 0x3C, 0x20, 0xCD, 0x85,
-    0x71, 0x29, 0xAF, 0xAA, 0xA4, 0x7B, 0x79, 0x9A, 0x22, 0x3F, 0xA0, 0x6E, 0x2D, 0x01, 0x3A, 0x60,
-    0x71, 0xA6, 0x0A, 0x13, 0x4C, 0x31, 0x95, 0xB8, 0xCB, 0xE9, 0x1E, 0xA7, 0x8C, 0x31, 0xB7, 0x1D,
-    0x26, 0xAF, 0xC4, 0xE4, 0x17, 0x2D, 0x2D, 0x34, 0x63, 0xC0, 0xDB, 0xE5, 0xA1, 0xC4, 0x09, 0xC2,
-    0x5C, 0x50, 0x22, 0xCF, 0xF8, 0xEC, 0x10, 0xB0, 0x26, 0x1E, 0x90, 0xD5, 0x10, 0xE5, 0xE2, 0x59,
-    0x2C, 0x55, 0x07, 0xD2, 0xCE, 0xC2, 0x8A, 0x3C, 0x19, 0x81, 0x74, 0xF6, 0x29, 0x06, 0xAB, 0x77,
-    0xC9, 0xC6, 0x84, 0x9A, 0x97, 0xF8, 0xFD, 0xCA, 0x93, 0x11, 0x68, 0x8D, 0x47, 0xD3, 0xBD, 0x05,
-    0xA0, 0xAC, 0x79, 0xF0, 0xB7, 0x1D, 0x91, 0xC6, 0x13, 0x52, 0x8E, 0xBE, 0x32, 0x9A, 0x4E, 0x4B,
-    0x77, 0xBB, 0xFC, 0xF4, 0x22, 0xC2, 0x39, 0x53, 0x59, 0xD6, 0xA0, 0x84, 0x31, 0x2C, 0x25, 0x46,
-    0xAA, 0xB6, 0xF9, 0xAE, 0x98, 0x2F, 0xE0, 0xA8, 0xF4, 0xAC, 0x18, 0x26, 0x0D, 0xE7, 0x72, 0xBE,
-    0xA9, 0x94, 0x64, 0x00, 0x28, 0xB2, 0x0B, 0x92, 0x2F, 0x8A, 0x99, 0xEF, 0xE0, 0x29, 0xD0, 0x69,
-    0x22, 0x52, 0x6C, 0x25, 0x2E, 0xC2, 0x0A, 0xEE, 0xE1, 0x57, 0x2E, 0xCA, 0xDB, 0x06, 0x9E, 0x1F,
-    0xB5, 0x7E, 0x21, 0x6D, 0x66, 0x73, 0xC8, 0x17, 0x24, 0x5E, 0x91, 0x85, 0xA0, 0x81, 0x29, 0x92,
-    0x36, 0x86, 0x89, 0xB6, 0x31, 0x4C, 0xB4, 0x89, 0xBD, 0xC2, 0xAD, 0xE3, 0x00, 0xE5, 0x5D, 0xB8,
-    0x0B, 0x36, 0x01, 0x6A, 0xB8, 0xDC, 0x02, 0x78, 0x24, 0x7E, 0x03, 0x94, 0x15, 0xB0, 0xA9, 0x15,
-    0xB1, 0x83, 0x73, 0x45, 0x4E, 0x72, 0xCF, 0xB5, 0x39, 0x54, 0x18, 0x9D, 0xF6, 0xBF, 0x99, 0x6A,
-    0x51, 0x84, 0xB9, 0xD5, 0xA9, 0xB0, 0x62, 0x18, 0x56, 0xD8, 0x39, 0x42, 0xB0, 0xB3, 0x84, 0x55,
-    0x88, 0x75, 0x00, 0x58, 0x2C, 0x96, 0x42, 0x06, 0xBC, 0x68, 0x98, 0x22, 0x46, 0x90, 0x11, 0x23,
-    0xDE, 0xB8, 0x2F, 0x62, 0x32, 0x06, 0x2D, 0x0D, 0x5F, 0x1A, 0xCD, 0xE2, 0x34, 0xCC, 0xFB, 0xAE,
-    0x97, 0xA7, 0xFD, 0x92, 0xC1, 0x92, 0xB5, 0x89, 0x78, 0x6F, 0x0E, 0x05, 0x89, 0xB6, 0x14, 0xAB,
-    0xCC, 0x2A, 0x9B, 0xB3, 0x16, 0x68, 0x45, 0xD1, 0x53, 0x31, 0xB4, 0xEA, 0xA4, 0x56, 0x7C, 0x42,
-    0x1C, 0x3A, 0x93, 0xE8, 0xCC, 0x35, 0x44, 0xBE, 0xC4, 0xBF, 0x0E, 0x27, 0xB9, 0xB9, 0xB6, 0x68,
-    0xED, 0x4F, 0x40, 0x39, 0x76, 0x68, 0xAC, 0x66, 0xCA, 0x7E, 0x66, 0x38, 0x10, 0x2D, 0x8B, 0x80,
-    0x93, 0x43, 0xDC, 0x1C, 0x10, 0x21, 0x27, 0x60, 0x0D, 0xB3, 0x67, 0xDF, 0xC1, 0xCB, 0x1B, 0x31,
-    0x1F, 0x55, 0x62, 0x3E, 0x67, 0xFC, 0x48, 0x98, 0x0E, 0xFA, 0x40, 0x3B, 0xCB, 0x8A, 0x8B, 0xE8,
-    0xA7, 0x3C, 0x49, 0xAE, 0xA7, 0xB2, 0x67, 0xA3, 0xED, 0x99, 0x04, 0xF1, 0xA7, 0x74, 0x2B, 0x0F,
-    0x9B, 0x76, 0x1A, 0xEC, 0xB9, 0xC5, 0x96, 0x5B, 0xAC, 0x6D, 0x6C, 0xEE, 0xD4, 0xEC, 0x74, 0xD8,
-    0x24, 0x28, 0x82, 0xFB, 0x5D, 0x1A, 0xB2, 0xAF, 0xBB, 0xDD, 0xA7, 0x99, 0xC9, 0x02, 0xA9, 0xD9,
-    0x56, 0x5C, 0x16, 0x69, 0x62, 0xB5, 0x83, 0x16, 0x26, 0x7D, 0xCA, 0x0E, 0x74, 0x5D, 0xA8, 0x2B,
-    0x89, 0xA4, 0x1B, 0x22, 0x0E, 0xA9, 0x7D, 0xEE, 0xB2, 0xA2, 0x4B, 0xBB, 0xD5, 0x44, 0xC1, 0x7D,
-    0xA6, 0x3D, 0x68, 0x9D, 0x0B, 0x02, 0x4A, 0x2F, 0x0F, 0x54, 0x64, 0x53, 0xAB, 0x7A, 0x5A, 0xE9,
-    0xDB, 0x55, 0x34, 0xE4, 0x4C, 0x9D, 0x0C, 0xDF, 0x84, 0x6B, 0x70, 0x6E, 0x3A, 0x24, 0x36, 0x3A,
-    0xB2, 0xAC, 0x1C, 0x26, 0xEA, 0x97, 0xBD, 0x50, 0x7D, 0x3D, 0xA0, 0xD5, 0x88, 0xE2, 0x7F, 0x99,
-    0x16, 0x3A, 0x27, 0x73, 0xB5, 0x53, 0x29, 0x5A, 0x92, 0x54, 0xC3, 0x6E, 0x06, 0x73, 0xBC, 0x58,
-    0xBE, 0x28, 0xD3, 0x76, 0x6C, 0x8E, 0x5E, 0x6F, 0xFC, 0xD2, 0xAB, 0x6D, 0x8E, 0x70, 0xA0, 0x51,
-    0xCE, 0x94, 0x48, 0xC1, 0xE5, 0x04, 0x37, 0x66, 0x7A, 0x0A, 0x8C, 0x68, 0x61, 0x3A, 0x96, 0xBD,
-    0x24, 0x76, 0xEF, 0x27, 0x61, 0xF7, 0xAE, 0xF8, 0x47, 0xC1, 0x90, 0x72, 0x09, 0xFD, 0x59, 0xD2,
-    0x13, 0xCA, 0x44, 0x03, 0x7A, 0x4C, 0x96, 0x48, 0x7F, 0xAD, 0x2F, 0xD3, 0x59, 0xA5, 0xB3, 0x48,
-    0x1F, 0xE1, 0xE4, 0x66, 0x25, 0xFA, 0x32, 0xE8, 0xB3, 0xF6, 0x0E, 0xEA, 0x0D, 0xAD, 0xBC, 0x59,
-    0x78, 0xCF, 0xEA, 0xEE, 0xA5, 0xD0, 0xC6, 0xCC, 0x52, 0x3A, 0xC0, 0x58, 0xAC, 0xA6, 0x97, 0xA2,
-    0x97, 0x83, 0xBE, 0x48, 0x66, 0x79, 0xCC, 0xC1, 0x0A, 0x59, 0x0B, 0xE4, 0xD5, 0xE5, 0xF1, 0xB8,
-    0x58, 0xBC, 0x01, 0x2B, 0xEA, 0x9A, 0xAF, 0xBB, 0xD2, 0x3C, 0xF8, 0x55, 0xF7, 0x4E, 0xE5, 0x97,
-    0xB6, 0x85, 0xAF, 0xE4, 0x7E, 0xC5, 0xBE, 0xB8, 0x57, 0x92, 0x9E, 0x0F, 0x03, 0x1E, 0x31, 0x17,
-    0x25, 0x13, 0xF8, 0x44, 0x0D, 0xA3, 0x64, 0xED, 0x99, 0x69, 0xAD, 0x98, 0xC9, 0x5E, 0x4A, 0x8B,
-    0xE3, 0x03, 0x95, 0x5D, 0xEF, 0x7E, 0x75, 0x3E, 0x89, 0xBB, 0x75, 0xD6, 0x26, 0xCD, 0x26, 0x91,
-    0x70, 0xA2, 0x11, 0xC0, 0x7F, 0x30, 0x7F, 0xF4, 0xE3, 0x0F, 0x76, 0x34, 0xAB, 0x55, 0x16, 0xBD,
-    0x6F, 0x36, 0x26, 0x5A, 0x89, 0x5D, 0x46, 0x80, 0x41, 0x54, 0x60, 0xC2, 0xBC, 0x3B, 0x3C, 0xFA,
-    0x99, 0x95, 0x9E, 0x18, 0xCF, 0x34, 0xAC, 0x62, 0x07, 0x7F, 0x25, 0x41, 0x86, 0x04, 0xCD, 0x0F,
-    0xD5, 0x82, 0x86, 0x9A, 0x9E, 0xEF, 0x83, 0x30, 0x45, 0xCC, 0x49, 0xF9, 0x83, 0x54, 0x99, 0x44,
-    0xCE, 0x21, 0xB0, 0x75, 0x83, 0x91, 0x6A, 0x6E, 0x39, 0xCD, 0xF7, 0x02, 0xF8, 0xB6, 0x88, 0x6B,
-    0xE5, 0x00, 0x45, 0xE9, 0x5E, 0xC1, 0x23, 0xA3, 0xDA, 0x72, 0xE8, 0xB3, 0xAE, 0x26, 0xAE, 0x40,
-    0xAC, 0x09, 0x71, 0x2A, 0x07, 0x48, 0xB8, 0xC9, 0xC0, 0x60, 0x19, 0xF4, 0xCF, 0xC1, 0xDA, 0x23,
-    0x28, 0x27, 0x42, 0xE8, 0xB9, 0xE0, 0x9E, 0x24, 0x87, 0x25, 0xD0, 0x76, 0x12, 0x03, 0x2B, 0x81,
-    0x99, 0x8E, 0x34, 0xDC, 0xBC, 0x2F, 0xB5, 0x53, 0xF3, 0x01, 0x97, 0x29, 0x4D, 0xC1, 0xC7, 0x48,
-    0x00, 0x1C, 0x48, 0x30, 0x81, 0xA6, 0x94, 0x91, 0xEE, 0xD4, 0x68, 0xFB, 0x3F, 0xD0, 0x23, 0xEF,
-    0xCF, 0xE8, 0x7D, 0xC6, 0x78, 0xA4, 0x15, 0x44, 0x78, 0xBC, 0x4D, 0xF9, 0xF0, 0x13, 0x45, 0x04,
-    0xC9, 0x40, 0xAD, 0x25, 0xEA, 0x41, 0xC9, 0x1A, 0x9F, 0x0A, 0x3A, 0x5D, 0xEA, 0x7D, 0x94, 0x07,
-    0x4E, 0xB5, 0xD6, 0x53, 0xF9, 0x9E, 0x44, 0xA0, 0x11, 0xFF, 0x83, 0xCA, 0x7E, 0x58, 0xB9, 0x72,
-    0x73, 0xD0, 0xC6, 0xF7, 0x15, 0x43, 0x1B, 0x43, 0xF9, 0x86, 0x98, 0x7F, 0x13, 0xD3, 0x15, 0x9A,
-    0xB4, 0x82, 0xFB, 0xA9, 0x5C, 0x62, 0x61, 0x60, 0x34, 0x25, 0xC8, 0xC5, 0x3F, 0x54, 0x4E, 0x77,
-    0x54, 0x79, 0x5F, 0xED, 0x54, 0x41, 0xEA, 0xD3, 0x2F, 0xAB, 0x91, 0xA6, 0x07, 0x1D, 0x48, 0x10,
-    0xF4, 0x4F, 0xFA, 0x66, 0x80, 0x0C, 0x73, 0x28, 0xCC, 0x49, 0x6C, 0x43, 0x0F, 0x56, 0x01, 0x21,
-    0xCD, 0x91, 0xE5, 0x83, 0x3B, 0xB8, 0xD1, 0xB3, 0x5E, 0xB3, 0xD0, 0xCD, 0x95, 0x5B, 0x21, 0x38,
-    0x7C, 0x81, 0xF5, 0xCE, 0xD7, 0x9F, 0xB5, 0x2C, 0xA2, 0xEE, 0x89, 0x69, 0x67, 0x55, 0xA1, 0xC7,
-    0x67, 0x1D, 0xC8, 0x07, 0x2D, 0xA5, 0x27, 0xC2, 0xC5, 0xB6, 0x50, 0xF0, 0x69, 0x07, 0xAC, 0xE2,
-    0xC3, 0xC8, 0x12, 0xA6, 0xEC, 0xE9, 0xC4, 0x06, 0x14, 0xFD, 0x66, 0xDE, 0x1F, 0xC8, 0x7B, 0xFB,
-    0x3E, 0xE5, 0x43, 0x9F, 0x0E, 0x76, 0xB2, 0x93, 0xFB, 0x05, 0x70, 0x24, 0x01, 0x25, 0x74, 0x14,
-    0x69, 0xBA, 0x73, 0xAB, 0xF1, 0xC2, 0x6E, 0xC6, 0x42, 0x98, 0x8B, 0xDD, 0x24, 0x87, 0x7C, 0xBA,
-    0x02, 0xC1, 0x8A, 0x59, 0x23, 0xEB, 0x74, 0x3F, 0xC0, 0x59, 0xE8, 0x07, 0x2C, 0x85, 0xFE, 0xE0,
-    0x43, 0x5A, 0xFF, 0xDB, 0xD3, 0xF5, 0xFF, 0x32, 0xE8, 0xB3, 0x32, 0x66, 0x61, 0xCC, 0xBA, 0xB8,
-    0x8A, 0x73, 0xF8, 0xE7, 0xF2, 0x64, 0xE7, 0xA9, 0xB2, 0x8F, 0x40, 0x1F, 0x5D, 0xEC, 0x25, 0x2C,
-    0x83, 0xB6, 0xF6, 0x1C, 0x92, 0x7E, 0x0C, 0x70, 0x71, 0xE1, 0x09, 0x66, 0x39, 0xE7, 0xF5, 0xED,
-    0x75, 0xE7, 0xE4, 0xFC, 0x7F, 0xAE, 0xC2, 0x24, 0x5B, 0x39, 0xFE, 0x19, 0x3B, 0x09, 0x40, 0x53,
-    0x16, 0x48, 0x2A, 0xCA, 0x6C, 0x92, 0x8D, 0xE1, 0x78, 0x59, 0x60, 0x50, 0x76, 0xD8, 0xA4, 0x09,
-    0x23, 0xA9, 0x02, 0x94, 0xFB, 0xB6, 0xF2, 0x0A, 0x0B, 0x29, 0x2D, 0xCC, 0x35, 0x9A, 0xD6, 0xF2,
-    0x43, 0x59, 0x38, 0x7A, 0x82, 0x07, 0x2D, 0x9B, 0xEB, 0x21, 0x80, 0xF7, 0xA6, 0xEC, 0xDE, 0x94,
-    0x37, 0x61, 0x83, 0x19, 0x76, 0xDF, 0x60, 0xF7, 0x40, 0x68, 0x0E, 0x10, 0x9A, 0x5B, 0xB1, 0x55,
-    0x4B, 0x3B, 0x8D, 0xB5, 0xA9, 0xEB, 0xE7, 0x23, 0x6D, 0xD4, 0xF6, 0x19, 0x6C, 0x17, 0x19, 0x2C,
-    0x46, 0x06, 0xB3, 0xDF, 0x46, 0x27, 0x79, 0x9F, 0x51, 0x0E, 0x7A, 0x7B, 0x58, 0x1A, 0xFD, 0x01,
-    0x9D, 0x10, 0x9A, 0xFA, 0x7F, 0xC9, 0x65, 0x1D, 0x0E, 0xB2, 0xDA, 0x33, 0x58, 0x0A, 0x7D, 0x45,
-    0x10, 0x6F, 0x55, 0x8A, 0x22, 0xCE, 0x9F, 0x20, 0x88, 0xE5, 0xC8, 0xDE, 0xD7, 0x4F, 0xBB, 0x33,
-    0xF4, 0xA8, 0x08, 0xF1, 0x54, 0xFD, 0x24, 0x6F, 0x8A, 0x7B, 0x8B, 0x55, 0x6A, 0xD1, 0x3F, 0x4A,
-    0x1D, 0xF1, 0x5F, 0x38, 0x22, 0xE6, 0xBA, 0x88, 0x8E, 0x1A, 0xF2, 0xB6, 0x90, 0x47, 0x17, 0xF0,
-    0x5E, 0xAB, 0x0D, 0x2D, 0xED, 0x68, 0xED, 0x90, 0x12, 0x93, 0x82, 0xAF, 0x5D, 0xE9, 0x7A, 0x06,
-    0x4D, 0xF5, 0x39, 0x94, 0x3E, 0xFA, 0x09, 0x67, 0xAC, 0x15, 0x27, 0x4F, 0x79, 0x71, 0x7A, 0x02,
-    0x90, 0x4E, 0xFF, 0x57, 0x06, 0xB9, 0x9E, 0x7A, 0x04, 0x4B, 0x98, 0x30, 0xDA, 0x43, 0x4A, 0x9C,
-    0x7C, 0x35, 0xE5, 0x7D, 0xB0, 0xCC, 0x29, 0x17, 0xB5, 0xFD, 0x53, 0x5E, 0x9B, 0x38, 0x8C, 0x67,
-    0xAE, 0xC6, 0x33, 0x76, 0xD3, 0x21, 0x1D, 0x31, 0x0F, 0xC3, 0x5F, 0x05, 0x98, 0xE0, 0x37, 0x10,
-    0xC6, 0xEE, 0x03, 0x94, 0xD8, 0x57, 0x19, 0x13, 0xD8, 0x5F, 0xFD, 0xCE, 0x07, 0xBC, 0xD4, 0x49,
-    0x1D, 0xB1, 0xD4, 0xE4, 0x82, 0xAD, 0x0B, 0x8B, 0x8D, 0x83, 0xB3, 0x57, 0xD3, 0x7F, 0x01, 0xC5,
-    0x5B, 0x3F, 0x70, 0xE4, 0x66, 0x15, 0x7F, 0x92, 0xEE, 0x2C, 0x40, 0x33, 0xC8, 0x85, 0x0D, 0x49,
-    0x6E, 0x40, 0x29, 0x52, 0x1C, 0x90, 0x44, 0x0D, 0x05, 0x85, 0x57, 0x2B, 0xA0, 0xA0, 0x48, 0x81,
-    0x8B, 0x73, 0x98, 0x21, 0x33, 0x1C, 0x05, 0x05, 0x03, 0xC3, 0x5C, 0x13, 0x66, 0x8E, 0x19, 0xAD,
-    0x57, 0x03, 0x05, 0x05, 0x45, 0xDC, 0xA4, 0xE6, 0x8A, 0x2B, 0xE0, 0x0A, 0x48, 0x91, 0xC2, 0x0C,
-    0xEB, 0x5B, 0x01, 0x05, 0x05, 0x45, 0x94, 0x49, 0x32, 0x14, 0x14, 0x59, 0xC2, 0x01, 0x05, 0xC5,
-    0x09, 0xD0, 0xCD, 0xC9, 0x44, 0xB6, 0xF8, 0xFD, 0xDE, 0x27, 0x69, 0xD7, 0x77, 0xC6, 0xB9, 0x70,
-    0x6B, 0xDB, 0xB7, 0xFA, 0x76, 0x6F, 0x2D, 0x7D, 0xEF, 0xFD, 0xDE, 0xF7, 0xBE, 0xF7, 0xF7, 0xB3,
-    0x88, 0xDF, 0xE4, 0x22, 0x01, 0x87, 0x8B, 0x5B, 0xB1, 0x98, 0x1F, 0xAB, 0xC4, 0xE0, 0x54, 0x18,
-    0x3C, 0x0E, 0xFE, 0x04, 0x43, 0x98, 0x60, 0x18, 0x70, 0xA8, 0x37, 0x78, 0xC7, 0x00, 0x77, 0x14,
-    0x18, 0xDC, 0x3C, 0xC2, 0x1D, 0x29, 0x86, 0x40, 0x42, 0x91, 0x61, 0xD3, 0x88, 0x4C, 0x39, 0x1C,
-    0xDE, 0xFA, 0xA5, 0xD8, 0x85, 0x04, 0xB1, 0x33, 0x13, 0x3F, 0xF6, 0x33, 0xDC, 0x14, 0xA4, 0x18,
-    0x86, 0xB8, 0x3D, 0x1B, 0x61, 0xEA, 0x4C, 0x69, 0x87, 0xB8, 0x3A, 0xCA, 0x97, 0x66, 0x97, 0x65,
-    0x5A, 0x27, 0xCE, 0xC1, 0xD5, 0xCA, 0x9B, 0xB9, 0xA5, 0x9F, 0x39, 0x45, 0x08, 0x2A, 0x43, 0x71,
-    0x66, 0x11, 0xAE, 0x11, 0x88, 0x4D, 0xF0, 0xDC, 0x04, 0x13, 0x4C, 0x24, 0x4C, 0x13, 0x19, 0xC7,
-    0x43, 0xFB, 0x6E, 0x1C, 0x36, 0xAF, 0x88, 0x77, 0x10, 0x88, 0xE8, 0x2C, 0x1F, 0x91, 0x6F, 0x8A,
-    0x7C, 0xDA, 0x9A, 0x81, 0x4C, 0x93, 0x81, 0xBF, 0x86, 0xDF, 0xAE, 0xCA, 0x19, 0x43, 0x23, 0x17,
-    0x64, 0x82, 0x3C, 0x28, 0x0B, 0x9B, 0xB2, 0x3C, 0x88, 0x67, 0x05, 0x02, 0x72, 0x24, 0xB9, 0x5D,
-    0x92, 0x2C, 0x30, 0xD8, 0x33, 0x0E, 0xF7, 0xF8, 0xDD, 0x21, 0x87, 0xB5, 0x25, 0xE0, 0x21, 0xB3,
-    0x98, 0xD6, 0xE1, 0x52, 0xF1, 0x7A, 0x1B, 0x9F, 0xEB, 0x6E, 0xC5, 0xD6, 0x39, 0x6C, 0x73, 0x20,
-    0x4E, 0x87, 0xE4, 0x3D, 0x4A, 0xE0, 0x42, 0xBF, 0x9C, 0xCD, 0x3E, 0xB5, 0x97, 0x98, 0x76, 0xBE,
-    0x21, 0x36, 0x1F, 0x74, 0xC9, 0xA9, 0x4F, 0xE6, 0x01, 0x07, 0x80, 0x79, 0x5B, 0xC4, 0x61, 0xC4,
-    0x81, 0xA2, 0x92, 0xFA, 0x98, 0x61, 0xD2, 0x93, 0x1A, 0x92, 0x42, 0x30, 0x5B, 0x89, 0xC5, 0x6B,
-    0x9A, 0x14, 0x24, 0xB8, 0x7C, 0x96, 0x0A, 0xFE, 0x62, 0x6C, 0x66, 0x8D, 0x0C, 0x47, 0x0E, 0x76,
-    0x8D, 0xD5, 0x72, 0xE2, 0xED, 0x53, 0xAE, 0xE2, 0x1C, 0x7C, 0x5D, 0x3C, 0xEA, 0x1E, 0xEE, 0x0A,
-    0x5B, 0xCA, 0x24, 0x9C, 0xB4, 0x24, 0xBA, 0x6B, 0xA4, 0x84, 0x9E, 0x06, 0xEF, 0x85, 0x38, 0xCD,
-    0x4C, 0x65, 0xD9, 0x52, 0xF1, 0x09, 0x73, 0x48, 0x14, 0xD5, 0x2E, 0x69, 0x0C, 0x48, 0xE4, 0xC2,
-    0xF9, 0x00, 0xDE, 0x34, 0x7A, 0xE6, 0xE3, 0x89, 0xE8, 0x79, 0x91, 0xD2, 0x8F, 0x25, 0xB6, 0x96,
-    0x0D, 0x58, 0x35, 0x4D, 0x01, 0xAC, 0x74, 0x16, 0xE8, 0x9C, 0xB0, 0x62, 0x3F, 0x40, 0x79, 0xF1,
-    0xC5, 0xCE, 0x9C, 0x8B, 0xA5, 0xE0, 0x54, 0xA1, 0x15, 0x01, 0xEF, 0x9F, 0x74, 0xAB, 0x1B, 0x10,
-    0xC6, 0xC5, 0xF3, 0x01, 0xBB, 0x0A, 0x43, 0xB2, 0x81, 0xFD, 0x16, 0x84, 0x66, 0x71, 0x49, 0xCA,
-    0x8A, 0x97, 0x08, 0x78, 0x93, 0x96, 0xEA, 0xBA, 0x87, 0x67, 0x07, 0x7C, 0x30, 0xA8, 0x3A, 0xC5,
-    0xEE, 0xA8, 0xC8, 0xF8, 0x30, 0x26, 0x1D, 0xFC, 0xE2, 0xE0, 0xA5, 0x43, 0x6E, 0xA7, 0x71, 0x0C,
-    0xBB, 0xE6, 0x67, 0x58, 0x03, 0x8F, 0x83, 0x9B, 0x63, 0xBF, 0x3B, 0x33, 0xEC, 0x31, 0x67, 0x06,
-    0x4E, 0x9D, 0x19, 0xD4, 0xC4, 0xCD, 0x21, 0x0E, 0x2F, 0x07, 0x4B, 0x7E, 0x06, 0x55, 0x84, 0xC5,
-    0x02, 0x6F, 0x31, 0xB8, 0x1B, 0x83, 0x3D, 0xAB, 0xC6, 0xE0, 0x95, 0xB2, 0xBD, 0x35, 0xCD, 0x65,
-    0xDC, 0x1C, 0x72, 0xF6, 0x85, 0x75, 0x94, 0xE0, 0x2B, 0x2A, 0x4A, 0x9F, 0x0C, 0x84, 0x81, 0x0A,
-    0x73, 0x83, 0xE3, 0xE0, 0x69, 0x69, 0x61, 0x5D, 0x9A, 0x11, 0xD0, 0xB4, 0xC6, 0xE8, 0xEC, 0x5F,
-    0x05, 0x67, 0x34, 0x69, 0x5C, 0x02, 0xEA, 0x44, 0xA8, 0x9A, 0x31, 0x54, 0x2B, 0x14, 0xE9, 0x48,
-    0xE3, 0x46, 0x19, 0x50, 0x7F, 0x27, 0xBA, 0x50, 0x34, 0x71, 0x9C, 0x6A, 0x0C, 0x1A, 0x34, 0x73,
-    0x78, 0x0A, 0x86, 0x4E, 0x8C, 0xA9, 0x6B, 0x8D, 0x37, 0x04, 0xB5, 0xC3, 0xEF, 0xC1, 0xDF, 0xF0,
-    0x45, 0xAC, 0x4A, 0x24, 0x41, 0x8E, 0xA9, 0x30, 0xF9, 0x84, 0xFA, 0x37, 0xA1, 0x75, 0xAF, 0x28,
-    0x0F, 0x50, 0xAE, 0x3E, 0xB1, 0x7F, 0x45, 0xAA, 0x61, 0x53, 0x59, 0xE5, 0xB0, 0x29, 0xED, 0x92,
-    0x12, 0x29, 0x3A, 0x89, 0x78, 0x39, 0x08, 0x07, 0x19, 0x84, 0x31, 0x86, 0x24, 0xEC, 0x03, 0x09,
-    0x5E, 0xBD, 0x56, 0x52, 0x85, 0x52, 0xCC, 0x7E, 0x67, 0x01, 0xB7, 0x6A, 0x01, 0xAE, 0x5B, 0xD3,
-    0x1B, 0x22, 0x0D, 0x96, 0x49, 0xB6, 0xB6, 0x63, 0x03, 0x59, 0x11, 0x37, 0x00, 0xEC, 0xEC, 0x63,
-    0x89, 0x14, 0xAE, 0x9F, 0x82, 0x15, 0x05, 0xAB, 0x58, 0x07, 0x1C, 0x14, 0xA9, 0x02, 0x55, 0x9C,
-    0x0A, 0x33, 0x91, 0x69, 0x6C, 0x40, 0x2A, 0x46, 0x03, 0x51, 0x11, 0xBA, 0x4D, 0x09, 0x85, 0x2B,
-    0xE0, 0xD6, 0x8D, 0xD3, 0x1B, 0x37, 0x35, 0x96, 0xA2, 0x96, 0x83, 0xAD, 0x2B, 0x04, 0x45, 0xEF,
-    0xC5, 0x8D, 0xA6, 0x9B, 0x6D, 0x66, 0xAC, 0xA8, 0x0B, 0xAE, 0xA1, 0xA3, 0xB1, 0xFF, 0xCE, 0x96,
-    0x2A, 0x1C, 0x17, 0x89, 0xF3, 0x75, 0x8A, 0xC7, 0x6B, 0x1B, 0x8F, 0x77, 0x53, 0xC1, 0x8F, 0x01,
-    0x36, 0xAE, 0xF5, 0xAD, 0xD6, 0xAF, 0x56, 0x46, 0x69, 0xF7, 0xC3, 0x94, 0xFA, 0xC1, 0x7F, 0x21,
-    0x90, 0x47, 0xD6, 0x6D, 0xDC, 0x56, 0xE9, 0xAD, 0x7B, 0x0F, 0x29, 0xED, 0x13, 0x90, 0x56, 0x0D,
-    0xDA, 0xAD, 0xD2, 0xAE, 0x60, 0x74, 0xE3, 0xEB, 0xD0, 0xE2, 0x02, 0x7B, 0x25, 0x6B, 0x35, 0xF9,
-    0x74, 0xF8, 0x7F, 0xC6, 0x4A, 0x65, 0x03, 0x4E, 0x6F, 0x88, 0x2D, 0xE9, 0x1F, 0xF4, 0xBA, 0xB1,
-    0x14, 0x1C, 0x6A, 0x54, 0xC2, 0xD6, 0x62, 0x3C, 0x39, 0x57, 0x84, 0xD3, 0xC0, 0x41, 0xAB, 0xA9,
-    0x13, 0x31, 0x24, 0xB9, 0x31, 0xA7, 0xB5, 0x0C, 0x1C, 0xA7, 0xC1, 0xAF, 0x9D, 0x9B, 0x9B, 0xE0,
-    0xCC, 0x84, 0xBB, 0x3F, 0xE2, 0x03, 0xB9, 0x31, 0x4B, 0x8F, 0xC5, 0x33, 0x98, 0xFB, 0x64, 0x6A,
-    0x88, 0x6F, 0xB4, 0xE6, 0x64, 0x40, 0x2B, 0x90, 0x99, 0x10, 0x81, 0x1E, 0xDC, 0xC9, 0x12, 0xB1,
-    0xDF, 0x03, 0xF7, 0xD4, 0xAD, 0xB1, 0x9C, 0xAA, 0x7E, 0xAD, 0x62, 0x61, 0x06, 0x78, 0xD2, 0xC7,
-    0xEE, 0xF7, 0xA0, 0x5F, 0x0E, 0x27, 0xDE, 0x5C, 0xA2, 0x8E, 0xE9, 0x64, 0xEA, 0xA1, 0xD4, 0xB6,
-    0x8F, 0x18, 0xA5, 0xD0, 0xC1, 0x59, 0x5D, 0x7C, 0x20, 0xD6, 0x14, 0x16, 0x1E, 0xE6, 0x28, 0x93,
-    0xE9, 0xDB, 0x2F, 0x65, 0xF6, 0xC1, 0x23, 0x78, 0xB4, 0xA0, 0x81, 0x0B, 0x0B, 0x39, 0xAC, 0x8F,
-    0xE9, 0xCC, 0x22, 0x0E, 0x23, 0x72, 0x91, 0xD0, 0xA3, 0x4D, 0xE8, 0xD1, 0x2A, 0x78, 0x34, 0x88,
-    0xC8, 0x55, 0x43, 0xA6, 0x16, 0xBE, 0x8D, 0xCD, 0x7A, 0x8F, 0x47, 0xF1, 0x3A, 0xEF, 0xD1, 0x75,
-    0xC5, 0x05, 0x63, 0xC5, 0x2E, 0xF8, 0x5F, 0xA9, 0x3E, 0x46, 0xC3, 0x01, 0x26, 0x9B, 0xAF, 0x1D,
-    0x8A, 0x5D, 0x59, 0x07, 0xB4, 0x72, 0x35, 0xCD, 0x5A, 0x4D, 0xAE, 0x6A, 0x8A, 0x16, 0xD3, 0xD3,
-    0x0F, 0x85, 0x14, 0xBF, 0x5A, 0xC1, 0x90, 0x5E, 0x10, 0xB1, 0x33, 0x64, 0x99, 0xFD, 0x3A, 0x87,
-    0x61, 0xFB, 0x7B, 0x26, 0x76, 0xF3, 0x02, 0x68, 0xAC, 0x72, 0x25, 0xC4, 0xF8, 0x93, 0x16, 0xC9,
-    0x0F, 0xE8, 0xB8, 0xC7, 0xE4, 0xEC, 0x92, 0xE6, 0x1D, 0xF2, 0x4D, 0x1B, 0x6F, 0xAF, 0x31, 0x68,
-    0x1D, 0x37, 0xBC, 0xAF, 0x5A, 0x74, 0x81, 0x67, 0x2B, 0xA1, 0x15, 0x79, 0x42, 0xD4, 0xBE, 0xA9,
-    0x81, 0x33, 0x16, 0xAE, 0x53, 0xC1, 0xF3, 0x11, 0x8E, 0x1A, 0x3D, 0x7A, 0x55, 0x13, 0xDA, 0xDB,
-    0xE9, 0x91, 0xE8, 0xEF, 0x1C, 0xD4, 0x47, 0x39, 0xD5, 0x69, 0x9F, 0x5C, 0x64, 0xE5, 0x7C, 0x84,
-    0x73, 0xF6, 0x32, 0x90, 0x3E, 0x18, 0xE7, 0x27, 0x9A, 0x48, 0xF9, 0x82, 0xCC, 0xB3, 0x67, 0x5D,
-    0xAD, 0xAC, 0xCB, 0xC1, 0x82, 0x9E, 0xF2, 0xB9, 0xEA, 0xD0, 0xDC, 0x0E, 0x31, 0x8E, 0x95, 0x81,
-    0xDA, 0x21, 0xBF, 0x0B, 0xB9, 0xDB, 0xC8, 0x6E, 0x97, 0xF8, 0x2B, 0x86, 0x55, 0x8C, 0xAD, 0xAC,
-    0x12, 0xF4, 0xED, 0x02, 0xF4, 0x75, 0x40, 0x8C, 0x89, 0xB0, 0x2A, 0x87, 0xB1, 0x74, 0x33, 0x88,
-    0xA4, 0xC9, 0x3C, 0x0E, 0xB0, 0xB4, 0x57, 0x53, 0x06, 0x9A, 0x31, 0xE8, 0x07, 0x44, 0x1B, 0x92,
-    0x89, 0x88, 0x12, 0x8F, 0xC8, 0xC9, 0x88, 0x12, 0x4F, 0x38, 0xFB, 0xC4, 0xCC, 0xAE, 0x42, 0xF4,
-    0x73, 0x13, 0xDD, 0x57, 0x15, 0xA6, 0xDC, 0x58, 0x48, 0xDC, 0x1E, 0x30, 0xD6, 0x8B, 0x91, 0x74,
-    0x05, 0xE8, 0xF7, 0x10, 0xE3, 0xDD, 0x7F, 0xA7, 0xB6, 0x0F, 0x25, 0x41, 0xFA, 0x9B, 0x40, 0x2C,
-    0x09, 0xB8, 0x9A, 0x20, 0xEC, 0xAA, 0x20, 0xBD, 0xCA, 0xCF, 0xAC, 0x12, 0x31, 0x5E, 0xE1, 0xC7,
-    0x36, 0x8C, 0xAC, 0x33, 0x83, 0xE0, 0x90, 0xD7, 0xBB, 0xD9, 0x80, 0xB2, 0x55, 0x80, 0x2D, 0x0F,
-    0x0A, 0x71, 0x7D, 0x7F, 0xEB, 0xC5, 0xFD, 0x18, 0xA9, 0x3E, 0xBC, 0x86, 0x8E, 0xB1, 0x43, 0x98,
-    0xFA, 0xCA, 0x45, 0x81, 0x8A, 0x22, 0x15, 0x85, 0x2A, 0x8A, 0x95, 0x6B, 0x03, 0x67, 0xA1, 0x68,
-    0x0D, 0x5C, 0x83, 0x77, 0xFE, 0x1A, 0xE9, 0x4B, 0x35, 0x89, 0xA3, 0x21, 0xB8, 0x88, 0xCC, 0x9E,
-    0xDE, 0xE2, 0xBC, 0x62, 0xED, 0x6D, 0xB5, 0xC8, 0x9E, 0x4A, 0xA5, 0x6C, 0x4A, 0xEB, 0xFE, 0xDF,
-    0x6A, 0xBB, 0x91, 0x89, 0x7D, 0x1C, 0xB2, 0x94, 0xC8, 0xAC, 0xE3, 0x91, 0x5D, 0x84, 0xEA, 0x85,
-    0xB3, 0x97, 0x75, 0xC1, 0x8B, 0x30, 0xEB, 0xD7, 0x74, 0xD8, 0x30, 0x7F, 0x10, 0x8D, 0xBF, 0xA9,
-    0xB0, 0xBC, 0x1E, 0x74, 0x8B, 0xC3, 0x56, 0xD2, 0x83, 0x45, 0x49, 0x8B, 0x3C, 0xE8, 0x61, 0xC3,
-    0x43, 0x63, 0x9A, 0xAD, 0xF8, 0x82, 0x57, 0x3D, 0x0B, 0x1F, 0xB7, 0xE1, 0x17, 0xAB, 0x26, 0x1A,
-    0xBB, 0xC9, 0x9B, 0x55, 0x55, 0xC4, 0x2E, 0x5A, 0xE1, 0x31, 0xEE, 0xCE, 0x44, 0xAB, 0x25, 0xAD,
-    0xA8, 0x8C, 0x90, 0x48, 0x25, 0x6C, 0x18, 0xCF, 0x65, 0x88, 0x49, 0xE3, 0xD3, 0xE2, 0xD2, 0x6B,
-    0x66, 0x7E, 0x53, 0xB4, 0xF5, 0xB2, 0x0F, 0xCB, 0xDF, 0x9A, 0xEC, 0xC8, 0xB3, 0x08, 0x80, 0x02,
-    0x38, 0x78, 0xEF, 0x50, 0xFA, 0x9A, 0xD4, 0x29, 0xF0, 0x79, 0x51, 0x9E, 0xF1, 0xE1, 0xF6, 0x9A,
-    0x99, 0x0D, 0x5A, 0xC6, 0x3E, 0x7C, 0x58, 0x6E, 0x4F, 0x63, 0x8D, 0xE1, 0x65, 0x98, 0x92, 0xFA,
-    0xAD, 0x75, 0x0B, 0x37, 0x4D, 0x52, 0xAA, 0xD6, 0xCF, 0x52, 0xB3, 0x8A, 0xD7, 0xC7, 0xBA, 0xFD,
-    0xFA, 0x19, 0x9D, 0x78, 0xB4, 0xA0, 0xEC, 0x25, 0xEB, 0x60, 0xE4, 0xFE, 0x01, 0x00, 0xCA, 0x3D,
-    0xAC, 0x22, 0x22, 0xBF, 0xD7, 0x91, 0xE7, 0x8B, 0xEC, 0x6B, 0x80, 0x77, 0xB1, 0x33, 0x9E, 0x55,
-    0x7B, 0x2D, 0x04, 0xC8, 0xA7, 0x00, 0x0F, 0x22, 0x86, 0x65, 0xA3, 0x4D, 0x63, 0xDA, 0xEC, 0x66,
-    0x5E, 0x86, 0x2C, 0x39, 0xF5, 0x63, 0x16, 0xFE, 0x22, 0x4E, 0x02, 0x9A, 0x25, 0x89, 0xC2, 0xF4,
-    0xE7, 0x56, 0x9B, 0x66, 0x7B, 0x4C, 0x6E, 0x91, 0xF3, 0xB1, 0x08, 0x08, 0x5E, 0x02, 0x42, 0x0A,
-    0xC9, 0xCD, 0x90, 0xEC, 0x44, 0x1C, 0x06, 0xB4, 0x0B, 0x09, 0x39, 0x9A, 0x90, 0xA5, 0x8A, 0x3C,
-    0x95, 0xF8, 0x16, 0x3C, 0x24, 0x26, 0x65, 0xB5, 0x69, 0xE5, 0xC1, 0x06, 0x83, 0x47, 0x2D, 0x4E,
-    0xDA, 0x45, 0xE7, 0xD9, 0xBD, 0xBC, 0x2D, 0xC4, 0xFA, 0xD4, 0xB8, 0x95, 0x1D, 0xAD, 0xDE, 0xAD,
-    0x61, 0x9E, 0x11, 0xAE, 0x3D, 0xB9, 0x2C, 0xCF, 0xF4, 0x22, 0xB9, 0x69, 0xDD, 0x10, 0xB0, 0x6F,
-    0x95, 0x8E, 0x42, 0xC0, 0x95, 0x33, 0xD1, 0x75, 0x90, 0xE7, 0xBA, 0x00, 0x02, 0x38, 0xB1, 0x9F,
-    0x05, 0x31, 0xB3, 0x7E, 0x1F, 0x49, 0x7F, 0x00, 0x3E, 0x42, 0xB0, 0x11, 0x81, 0x8B, 0x41, 0x1F,
-    0xAD, 0xB6, 0xF2, 0x21, 0x03, 0x5F, 0x99, 0x99, 0x58, 0x50, 0x6B, 0x95, 0xAA, 0xEC, 0x8C, 0x82,
-    0x8D, 0x9F, 0x88, 0x28, 0xD7, 0xF2, 0x88, 0x9F, 0xD0, 0xFA, 0x63, 0xEB, 0xFF, 0xD2, 0x6E, 0x08,
-    0x7A, 0xE7, 0x13, 0xF6, 0xFE, 0x6E, 0x70, 0x4C, 0x0D, 0x46, 0x2D, 0x61, 0xD9, 0x17, 0x4A, 0x8B,
-    0x23, 0x81, 0x0D, 0xD7, 0xF8, 0xC1, 0xD9, 0x75, 0x62, 0x26, 0x01, 0x63, 0x7A, 0xF5, 0x29, 0x1F,
-    0x7D, 0xD2, 0x98, 0x8D, 0x75, 0xF3, 0x0B, 0x0B, 0x3B, 0xC7, 0x7D, 0x0B, 0x19, 0x3E, 0x66, 0x5C,
-    0xEB, 0x5C, 0xF0, 0xCD, 0x76, 0xF5, 0x8B, 0x63, 0x52, 0x84, 0x4E, 0x89, 0x8E, 0x51, 0xA4, 0x4E,
-    0x89, 0x46, 0x47, 0x15, 0x89, 0x1C, 0x4E, 0xF1, 0xF8, 0xD4, 0x54, 0x03, 0x34, 0xC7, 0x0F, 0xE8,
-    0xA1, 0x11, 0x28, 0x94, 0x16, 0x1D, 0xA5, 0x3B, 0x03, 0x0D, 0x7C, 0x65, 0x17, 0xF8, 0xCA, 0xF9,
-    0x33, 0x9F, 0xF9, 0x23, 0x1E, 0x70, 0xDF, 0x25, 0x31, 0x36, 0x0D, 0xFC, 0xFB, 0x98, 0xC3, 0xFF,
-    0x0D, 0xAB, 0x24, 0x71, 0x45, 0x82, 0x13, 0x51, 0x6D, 0xEB, 0x1C, 0x25, 0x60, 0x8E, 0xC8, 0x52,
-    0x62, 0x8A, 0x07, 0x2A, 0x8E, 0xFE, 0x67, 0xD0, 0xCB, 0x50, 0x85, 0x96, 0x2F, 0xC6, 0xC6, 0x0F,
-    0x79, 0xCB, 0xF9, 0x02, 0xFF, 0x4C, 0xA0, 0x21, 0xF0, 0x18, 0x50, 0xDF, 0x21, 0x30, 0x60, 0x56,
-    0x24, 0x55, 0xCE, 0x9F, 0xE0, 0xD3, 0xEE, 0x66, 0xCA, 0x95, 0xFF, 0x17, 0x68, 0xF3, 0x0F, 0x59,
-    0xDB, 0xAE, 0x94, 0xA3, 0x50, 0x3D, 0x36, 0x75, 0x25, 0x98, 0x87, 0x98, 0x51, 0x2B, 0x8B, 0xD2,
-    0xD8, 0x05, 0x25, 0x7C, 0x73, 0x71, 0xEE, 0xF0, 0xFF, 0x98, 0x7B, 0x8D, 0xEA, 0xE0, 0x70, 0x57,
-    0x51, 0xF6, 0x17, 0xBA, 0xF8, 0xA3, 0xB7, 0x1E, 0x8F, 0x66, 0xFE, 0x22, 0x4D, 0xE6, 0x90, 0xCB,
-    0x69, 0x2A, 0x07, 0x7D, 0xD8, 0xE3, 0x93, 0xCC, 0xE6, 0xE2, 0x79, 0x3C, 0x11, 0x2E, 0xB8, 0xE5,
-    0xE4, 0x11, 0x0C, 0x94, 0x7A, 0xF7, 0x23, 0x16, 0xF6, 0x71, 0x19, 0x13, 0xA3, 0xF8, 0xA0, 0xC8,
-    0x47, 0xD2, 0xAE, 0x96, 0x69, 0x77, 0xB1, 0x86, 0x7B, 0xD4, 0x3E, 0x9A, 0x59, 0x86, 0x1D, 0xF9,
-    0x64, 0x1E, 0xB2, 0x58, 0x3D, 0xDB, 0x4A, 0xDD, 0xFC, 0xE0, 0x03, 0x6C, 0x35, 0x76, 0xE8, 0x73,
-    0x26, 0xC2, 0x4C, 0x70, 0xCB, 0x04, 0x37, 0x54, 0x98, 0x13, 0x1B, 0xD7, 0x2A, 0x3F, 0xF5, 0xA1,
-    0xB7, 0xC0, 0xC3, 0xD5, 0x0B, 0xFE, 0x92, 0x66, 0x0E, 0x77, 0x45, 0xB4, 0xF5, 0x48, 0x8E, 0x92,
-    0xCD, 0xA3, 0x86, 0xB6, 0x98, 0x97, 0x85, 0x1F, 0xA2, 0x93, 0x9A, 0x2B, 0x38, 0x66, 0xAB, 0x9D,
-    0x28, 0xDD, 0x0B, 0x5E, 0x16, 0xF9, 0x78, 0xA5, 0x97, 0x4F, 0x92, 0xEE, 0x49, 0x2B, 0xBC, 0xE9,
-    0xFC, 0xAB, 0x70, 0xFE, 0x52, 0x38, 0x6F, 0xEE, 0x9C, 0xB4, 0xC2, 0xC7, 0xED, 0xFF, 0x49, 0x6B,
-    0xB2, 0x14, 0xDF, 0x6B, 0x62, 0xBD, 0x8F, 0xE9, 0x68, 0x6A, 0xF0, 0xFF, 0x10, 0xF8, 0xC6, 0xC0,
-    0xF7, 0xC9, 0x07, 0xF1, 0xBD, 0xBA, 0x85, 0xE0, 0xA6, 0xD1, 0xEB, 0x24, 0xC6, 0xEE, 0x61, 0x26,
-    0x24, 0x97, 0xE2, 0x96, 0x32, 0xCC, 0x65, 0x9A, 0xC9, 0xA5, 0x4E, 0x89, 0x1E, 0x64, 0xAC, 0x6B,
-    0x75, 0x64, 0x5D, 0x0A, 0x43, 0xAE, 0xAC, 0x23, 0xF5, 0xE1, 0x11, 0x7D, 0xF4, 0x94, 0xB7, 0x37,
-    0x3A, 0xA4, 0xD0, 0x80, 0xF7, 0x61, 0x43, 0xEC, 0x7F, 0x23, 0x72, 0x74, 0xB0, 0x0B, 0x4B, 0xE7,
-    0x4D, 0xEC, 0x54, 0x27, 0x2F, 0xAD, 0xC2, 0xCD, 0x26, 0x76, 0xE1, 0x65, 0x08, 0x2C, 0xFD, 0x34,
-    0x72, 0x72, 0x78, 0x07, 0x38, 0x0C, 0xF1, 0x5F, 0xC8, 0xE0, 0x29, 0x7E, 0x92, 0x86, 0xE2, 0xBE,
-    0x91, 0x46, 0xE2, 0xBC, 0x1B, 0x0F, 0xC8, 0x60, 0x02, 0xD3, 0x4A, 0x7A, 0x87, 0x8C, 0x9A, 0x59,
-    0xE8, 0x90, 0x2B, 0x46, 0x24, 0x5C, 0x62, 0xC2, 0x7E, 0x7E, 0x9E, 0xD3, 0xDC, 0x80, 0x48, 0xFE,
-    0xC9, 0xD0, 0xFC, 0xAF, 0x0C, 0x60, 0xF7, 0x10, 0x9A, 0x8F, 0x58, 0xA8, 0x85, 0x59, 0xAC, 0xA1,
-    0xDD, 0xF5, 0x62, 0x68, 0x1E, 0xC4, 0xDA, 0xFA, 0x9A, 0x0D, 0xC5, 0xE5, 0x85, 0x20, 0x16, 0xBF,
-    0x3D, 0x43, 0x10, 0x47, 0x13, 0xB8, 0xB8, 0x4B, 0xE0, 0x36, 0x64, 0xB1, 0xFD, 0xF9, 0xB8, 0x78,
-    0xFA, 0x9A, 0x72, 0xAB, 0x50, 0xD7, 0x5B, 0xDB, 0x1D, 0x1B, 0x2A, 0xD8, 0x3A, 0x2C, 0x3A, 0x69,
-    0xD5, 0x49, 0xCB, 0x4E, 0xC6, 0xE3, 0x76, 0x81, 0xE6, 0xD9, 0x89, 0xC3, 0x82, 0x31, 0xD2, 0xCE,
-    0xD9, 0x3F, 0x41, 0x7F, 0x9A, 0x9B, 0xC2, 0xD0, 0xFA, 0x52, 0x64, 0xA0, 0x6E, 0xDD, 0x9D, 0x75,
-    0xDA, 0x3B, 0xCF, 0x4E, 0x07, 0x9F, 0xF1, 0x2A, 0xB9, 0x3E, 0x40, 0x90, 0xB5, 0x1A, 0xED, 0x8F,
-    0x63, 0x19, 0xB3, 0x34, 0x3F, 0xA5, 0xF6, 0x1F, 0x52, 0xFF, 0x6B, 0x0E, 0x15, 0x6E, 0x85, 0x35,
-    0x18, 0xD2, 0x18, 0x44, 0x54, 0xB8, 0x11, 0x6D, 0xC2, 0x84, 0xA6, 0xB2, 0x36, 0x03, 0xC9, 0x0B,
-    0xE9, 0x3F, 0xBA, 0xB4, 0x32, 0x04, 0x4D, 0x0F, 0x49, 0x2B, 0xE8, 0xA5, 0xE5, 0xCD, 0xA5, 0x75,
-    0xB7, 0x93, 0x96, 0xCC, 0xA5, 0x35, 0xEA, 0xBA, 0x1F, 0x6A, 0x15, 0x58, 0xC7, 0xD5, 0xF2, 0x90,
-    0x03, 0x72, 0x62, 0x7D, 0x4B, 0xE5, 0x95, 0x1B, 0x79, 0x99, 0xF4, 0xD4, 0xFE, 0xB0, 0xE9, 0xE9,
-    0x11, 0x73, 0x0C, 0x49, 0x5D, 0xD8, 0x36, 0x31, 0x98, 0xB6, 0x83, 0xA6, 0x0C, 0xCE, 0xD8, 0x0B,
-    0x91, 0xAD, 0x2B, 0xAD, 0x92, 0xD8, 0x6C, 0x5E, 0x68, 0x7F, 0xA4, 0xF9, 0xE2, 0x34, 0x75, 0x28,
-    0x0D, 0x0F, 0xCE, 0x64, 0x86, 0x69, 0xB0, 0x1A, 0xB1, 0x76, 0x97, 0x4D, 0x40, 0x62, 0x17, 0x7B,
-    0x1C, 0xD8, 0xAE, 0x29, 0xEA, 0x76, 0x70, 0x67, 0x35, 0x83, 0x4E, 0xCE, 0x9F, 0x31, 0x16, 0x49,
-    0xB7, 0x69, 0x61, 0x86, 0xB1, 0x75, 0x20, 0xC1, 0x0C, 0x0B, 0x84, 0x8C, 0x37, 0x6F, 0xC9, 0xAA,
-    0xA9, 0x09, 0x81, 0xD3, 0x24, 0x6D, 0x6D, 0x71, 0xF4, 0x4E, 0x5B, 0x1C, 0xBD, 0x96, 0x79, 0xB9,
-    0x3B, 0x0B, 0x52, 0x6A, 0x80, 0x5D, 0x44, 0xB8, 0x46, 0xB8, 0x12, 0x13, 0x14, 0xCC, 0xB8, 0x64,
-    0x09, 0x48, 0x6C, 0x63, 0x55, 0x87, 0xF1, 0x6D, 0x84, 0xB8, 0x15, 0x18, 0xEF, 0x7C, 0xD7, 0x8E,
-    0xCD, 0x7D, 0xE1, 0x77, 0xF8, 0x86, 0x47, 0xAA, 0x7E, 0x67, 0x8B, 0xEF, 0x19, 0x24, 0x7D, 0x1B,
-    0x76, 0xA6, 0x38, 0x17, 0x93, 0xBE, 0xA5, 0xE0, 0x94, 0xCD, 0x35, 0x7A, 0x45, 0x76, 0x88, 0x7F,
-    0x84, 0xD5, 0x7C, 0x9E, 0xC9, 0xD5, 0x75, 0x9E, 0x19, 0x58, 0x5D, 0x3D, 0x17, 0xB0, 0xB2, 0xC6,
-    0x18, 0xA4, 0x62, 0x29, 0xA2, 0x00, 0x53, 0xEE, 0x6F, 0xC1, 0xD4, 0xA7, 0x11, 0x99, 0xC8, 0x85,
-    0x3E, 0xC8, 0x27, 0x6E, 0x02, 0x57, 0xE4, 0x42, 0xE8, 0x12, 0x98, 0x8E, 0x97, 0x6E, 0x49, 0x9B,
-    0x5B, 0x12, 0x43, 0x62, 0x1A, 0x72, 0xDD, 0xE6, 0xA4, 0x08, 0x84, 0x32, 0x10, 0x0A, 0x41, 0xA5,
-    0xB0, 0x28, 0x86, 0x1E, 0x6C, 0x43, 0x0F, 0x19, 0x9A, 0xB7, 0x26, 0x1E, 0x6F, 0x6D, 0xB1, 0x7D,
-    0x4E, 0xEF, 0xEB, 0xCD, 0x74, 0xA3, 0x69, 0xF3, 0x8C, 0x3D, 0x4B, 0x7D, 0x1B, 0x1A, 0x2F, 0xBC,
-    0x6D, 0x32, 0x87, 0x3D, 0x36, 0x68, 0x49, 0xCF, 0xE6, 0x1B, 0xC2, 0xC8, 0x7B, 0x5B, 0xB4, 0x1A,
-    0x1A, 0x32, 0xD7, 0x26, 0x2E, 0xAA, 0x4D, 0x16, 0x61, 0x5A, 0x8E, 0x78, 0xCE, 0xF8, 0xCF, 0xD8,
-    0x24, 0x14, 0x33, 0xBA, 0x69, 0xAD, 0xE8, 0x34, 0x0A, 0x51, 0xDF, 0x5A, 0xAD, 0x83, 0xAC, 0xAE,
-    0xC1, 0x23, 0x37, 0x5F, 0x6E, 0x2A, 0xE0, 0x7E, 0xE3, 0xAF, 0xB5, 0x97, 0xC3, 0x4F, 0x0F, 0xB0,
-    0x67, 0x6B, 0x19, 0x00, 0x7A, 0x25, 0x13, 0x62, 0x77, 0xCB, 0x11, 0xA9, 0x63, 0xC5, 0x1D, 0x2C,
-    0xD9, 0x44, 0x3D, 0xE2, 0x44, 0x8D, 0x1D, 0xE2, 0xF7, 0x82, 0xB6, 0x22, 0x60, 0x0F, 0x34, 0xBE,
-    0x5D, 0x5B, 0x3B, 0x90, 0xC1, 0xB4, 0xC9, 0x21, 0x04, 0x96, 0x13, 0x3A, 0xBD, 0xC2, 0x1E, 0xB6,
-    0xAA, 0x63, 0x3D, 0x29, 0xDB, 0xBD, 0x53, 0x18, 0x96, 0x83, 0x97, 0x6A, 0x80, 0xDE, 0x83, 0x7D,
-    0x8B, 0x28, 0x70, 0x5E, 0x6C, 0x30, 0x02, 0x5E, 0xED, 0x66, 0x6E, 0xC9, 0x15, 0xF5, 0x9B, 0x03,
-    0xF1, 0x5F, 0x85, 0xAA, 0xC4, 0x48, 0x47, 0x40, 0x33, 0x84, 0xA0, 0x22, 0x0D, 0xB4, 0xFD, 0x94,
-    0xC9, 0x04, 0x78, 0xC9, 0x4D, 0x2A, 0xA1, 0x15, 0xB7, 0xCC, 0xD8, 0xDF, 0xA4, 0xCD, 0xBD, 0xE2,
-    0xCE, 0xCA, 0xC7, 0xB0, 0x5A, 0x62, 0xDD, 0xFF, 0x9B, 0xC0, 0x6A, 0x69, 0x43, 0xBD, 0x0B, 0xE1,
-    0xBA, 0x94, 0xFB, 0xA4, 0x30, 0xF1, 0x74, 0xF8, 0x5D, 0xC8, 0x7B, 0x12, 0xE3, 0x39, 0xED, 0xB6,
-    0xF7, 0x24, 0x97, 0x91, 0x28, 0x6F, 0x8C, 0x11, 0x31, 0xEC, 0xC3, 0x69, 0x80, 0xA9, 0xE9, 0x3C,
-    0x4C, 0xEB, 0x72, 0xFD, 0x93, 0x42, 0xD0, 0xEE, 0xA7, 0xB5, 0xB1, 0xEA, 0xF6, 0x5F, 0xEF, 0x56,
-    0xE5, 0x24, 0x6F, 0x78, 0x1A, 0x38, 0xD7, 0x40, 0xF6, 0x39, 0x1B, 0x79, 0xD2, 0x57, 0x11, 0x57,
-    0x1E, 0xB6, 0x47, 0x95, 0x36, 0x97, 0xB3, 0x2E, 0xAA, 0x63, 0xF4, 0x52, 0x6E, 0x7B, 0x36, 0x61,
-    0x30, 0x8F, 0x6F, 0xD8, 0x9D, 0x1A, 0x22, 0x76, 0x6E, 0xBE, 0xB8, 0xDB, 0x69, 0x61, 0x77, 0xF1,
-    0x09, 0x8B, 0x01, 0x09, 0x44, 0xAC, 0x1D, 0x2B, 0x12, 0xD7, 0x3E, 0xBD, 0xDF, 0x52, 0xEC, 0x28,
-    0x87, 0xE9, 0xCB, 0xD6, 0x54, 0x53, 0x84, 0x90, 0xCD, 0xAE, 0xCD, 0xEE, 0xDC, 0x0F, 0x65, 0x36,
-    0x32, 0x8B, 0xB1, 0x78, 0xEE, 0xE7, 0xDA, 0x1D, 0xEE, 0x18, 0xF1, 0xEE, 0x7C, 0x6F, 0xCE, 0x37,
-    0xCF, 0x31, 0x95, 0x1D, 0x09, 0x4E, 0x5D, 0xB4, 0x67, 0xB6, 0x4C, 0x4E, 0xB1, 0x03, 0x86, 0xB8,
-    0xC5, 0xC7, 0x4D, 0xBC, 0xD0, 0x7C, 0xE0, 0xFC, 0xF0, 0x43, 0x6C, 0x5C, 0xF9, 0x71, 0xD9, 0xB7,
-    0xAD, 0x4E, 0x0B, 0x13, 0xEB, 0xE6, 0x2C, 0x9B, 0xD3, 0x13, 0x0F, 0x06, 0xA6, 0x66, 0xDE, 0x95,
-    0x42, 0x96, 0x82, 0xE9, 0x94, 0x78, 0xBF, 0xDE, 0x2A, 0xF6, 0x5E, 0x1B, 0x85, 0xE2, 0x5A, 0xC1,
-    0x67, 0xEF, 0xCE, 0x12, 0xF8, 0xC6, 0xF4, 0xF0, 0x94, 0xA6, 0x97, 0x9D, 0x98, 0xE8, 0xF6, 0x29,
-    0x7C, 0x0E, 0x77, 0x16, 0x1B, 0xB8, 0xFF, 0x7A, 0xB8, 0x81, 0x7B, 0x5A, 0x6B, 0xC4, 0x3A, 0xF4,
-    0x75, 0xFC, 0xFE, 0x79, 0x1E, 0xE1, 0xAB, 0x5A, 0xDE, 0xE3, 0xA5, 0xAD, 0xD1, 0xB0, 0x69, 0x6A,
-    0x5E, 0xEB, 0x57, 0xDF, 0xB9, 0xD2, 0x4F, 0x12, 0xB4, 0x06, 0xE4, 0xB8, 0xF2, 0x4B, 0xFD, 0xC1,
-    0x69, 0xB1, 0x83, 0x29, 0xBC, 0xB6, 0xEC, 0xC7, 0x7B, 0x28, 0xD3, 0xEF, 0xE2, 0xF3, 0xED, 0x96,
-    0xED, 0x4F, 0xA9, 0x69, 0x9A, 0xC8, 0xCA, 0xE1, 0xCD, 0xB0, 0x29, 0x57, 0xEE, 0x6D, 0x1E, 0x53,
-    0xAC, 0xE8, 0x0B, 0x06, 0xFA, 0xF2, 0x91, 0x4F, 0x36, 0xB4, 0x93, 0x4E, 0xA6, 0x0A, 0x5B, 0xF2,
-    0xF5, 0xB9, 0x42, 0x86, 0xA9, 0xC9, 0x38, 0x36, 0xF0, 0x60, 0xF0, 0x70, 0x97, 0xFB, 0x34, 0xC0,
-    0x75, 0x75, 0x23, 0x2D, 0xF3, 0x7E, 0x1F, 0x59, 0x04, 0xC2, 0x5D, 0xB9, 0xF4, 0x9F, 0x1D, 0xF8,
-    0xC1, 0x4B, 0xEF, 0xC4, 0x0F, 0x57, 0x4C, 0xFA, 0x5A, 0x87, 0xE9, 0x9C, 0x0C, 0x91, 0x02, 0xD4,
-    0x74, 0x50, 0x8F, 0xC2, 0xDB, 0x67, 0xA7, 0x3F, 0xC7, 0x42, 0x1D, 0xC8, 0xFA, 0xC1, 0x95, 0x47,
-    0xE6, 0xED, 0x7F, 0x0B, 0x17, 0x11, 0xEE, 0xB8, 0x49, 0xFF, 0x97, 0x70, 0xD5, 0xD4, 0xAC, 0x42,
-    0x25, 0xEC, 0xC6, 0x45, 0x48, 0x76, 0x97, 0x8D, 0x06, 0x36, 0x1B, 0xFB, 0xD6, 0xB9, 0xCD, 0x32,
-    0xE0, 0x91, 0xC3, 0x47, 0x2C, 0xCA, 0x82, 0x2E, 0x8F, 0x63, 0x65, 0x5A, 0x7B, 0xE8, 0x8E, 0x63,
-    0x05, 0x71, 0xD8, 0x56, 0x00, 0xDB, 0x32, 0xE0, 0x88, 0x12, 0x48, 0xB8, 0xA1, 0x26, 0x7D, 0xAB,
-    0x4C, 0x0F, 0x39, 0xE9, 0x99, 0xA7, 0x61, 0x1A, 0x66, 0xEC, 0x70, 0xC6, 0xE0, 0xA3, 0xEA, 0xDA,
-    0xB0, 0x56, 0x7C, 0x41, 0xFC, 0x72, 0x43, 0xA2, 0xA6, 0x94, 0x2F, 0x04, 0x33, 0xB0, 0x66, 0xB8,
-    0xD8, 0x91, 0x6F, 0xB3, 0x46, 0x09, 0xF2, 0xCC, 0x3A, 0xE6, 0x6D, 0xA3, 0x58, 0x33, 0x8E, 0x3E,
-    0x43, 0x1B, 0xE8, 0x01, 0x56, 0x73, 0xD8, 0x74, 0xDB, 0xBE, 0x1B, 0x0F, 0x9B, 0x57, 0xC4, 0xEF,
-    0x0E, 0xCF, 0x5A, 0xAC, 0xAD, 0x38, 0x1C, 0xAC, 0x2E, 0xE3, 0x38, 0x63, 0x74, 0x3E, 0xB6, 0x60,
-    0x80, 0xAB, 0xED, 0xE2, 0x2C, 0x07, 0x55, 0xFA, 0x51, 0xC6, 0x12, 0xCF, 0xB5, 0xF8, 0x64, 0x5A,
-    0x2C, 0x9C, 0x2D, 0x3C, 0x63, 0x7C, 0x3C, 0xFA, 0xFC, 0x71, 0xC4, 0x36, 0x3C, 0xDD, 0xED, 0xB0,
-    0x49, 0xBB, 0xBA, 0xBC, 0xD5, 0x93, 0x4B, 0x8C, 0x75, 0xB6, 0x89, 0xAE, 0x78, 0x19, 0xC3, 0xEC,
-    0xF3, 0x74, 0x07, 0xAF, 0x71, 0xBF, 0xE7, 0x32, 0x77, 0xCA, 0x67, 0x8C, 0x58, 0x7E, 0x25, 0xCC,
-    0xAD, 0xC5, 0xFD, 0x32, 0x68, 0xC0, 0x83, 0x38, 0x3F, 0x4E, 0x99, 0x66, 0x2F, 0x17, 0xB9, 0x15,
-    0xC3, 0xB0, 0x79, 0xBF, 0x03, 0xF4, 0x80, 0xFB, 0x7D, 0x83, 0xCE, 0xAF, 0x60, 0x98, 0x17, 0x9F,
-    0xCF, 0x26, 0x95, 0x75, 0x46, 0x45, 0x23, 0x9A, 0xAD, 0x6A, 0x40, 0xEA, 0x30, 0x4E, 0xDE, 0x97,
-    0xF2, 0x85, 0x5C, 0x8B, 0xB8, 0x4D, 0x53, 0x81, 0xC8, 0x69, 0xDA, 0x79, 0xBA, 0x10, 0x06, 0x8C,
-    0xE0, 0xCD, 0xC1, 0xF3, 0x50, 0x8D, 0x13, 0x6F, 0xD2, 0xF2, 0x12, 0x25, 0xC0, 0xC0, 0x32, 0x35,
-    0x67, 0x28, 0x29, 0x04, 0xA1, 0x14, 0x8C, 0x18, 0x54, 0x0E, 0x67, 0x87, 0x52, 0x3B, 0x34, 0x1B,
-    0x5D, 0x5F, 0x47, 0xCB, 0x5C, 0xEC, 0xEB, 0x99, 0xD0, 0x5C, 0x65, 0xF0, 0xF8, 0x0B, 0x7B, 0xE2,
-    0xE9, 0x77, 0xE3, 0xC8, 0x6C, 0x53, 0xA7, 0xD6, 0x6A, 0x5A, 0x77, 0x70, 0x55, 0x76, 0x5D, 0x93,
-    0x73, 0xCD, 0xDB, 0x25, 0xB2, 0x4B, 0x51, 0xB2, 0x2B, 0xE1, 0x51, 0xA2, 0x35, 0xCB, 0x2B, 0x3C,
-    0xF6, 0x11, 0x16, 0x8A, 0x34, 0x2A, 0x14, 0xEB, 0x5E, 0xA1, 0xFD, 0xBA, 0x7B, 0x94, 0xE0, 0xC4,
-    0x2A, 0x0A, 0x10, 0x9D, 0x38, 0x79, 0x01, 0xB1, 0x25, 0x6E, 0x56, 0xB0, 0xCD, 0xE7, 0xA7, 0x05,
-    0xA4, 0x96, 0x04, 0xC2, 0x3F, 0x1E, 0x48, 0x22, 0x61, 0x42, 0x9E, 0x6C, 0x48, 0x09, 0x19, 0x24,
-    0xBB, 0x78, 0x10, 0x22, 0x29, 0xE4, 0x3E, 0x78, 0x1E, 0xE0, 0x2D, 0xD3, 0x7D, 0xC7, 0xFC, 0x6F,
-    0x98, 0xA9, 0x58, 0x10, 0xC4, 0xDE, 0x36, 0x89, 0xED, 0xDE, 0xBC, 0xCA, 0x6B, 0x2A, 0x3D, 0xE6,
-    0xD0, 0xB3, 0x9E, 0x69, 0x37, 0xC9, 0xC8, 0xE2, 0xE1, 0x88, 0xCB, 0xF2, 0x94, 0xAC, 0x40, 0x3E,
-    0xCC, 0x65, 0x79, 0xB0, 0x34, 0xC0, 0x42, 0xBD, 0x1F, 0x0F, 0x65, 0x60, 0xFF, 0x23, 0x1E, 0xC9,
-    0xC0, 0xF9, 0x43, 0x8C, 0x3C, 0xD5, 0xFD, 0x43, 0x5A, 0x22, 0x67, 0x7D, 0xE1, 0x87, 0x85, 0x0C,
-    0x02, 0xEF, 0x47, 0x39, 0xE2, 0x56, 0xF7, 0x27, 0x50, 0x9A, 0xC4, 0x7D, 0x25, 0x95, 0xC1, 0xEB,
-    0xEE, 0x4F, 0xC9, 0x94, 0xFB, 0x0B, 0x50, 0x9A, 0xB9, 0x3C, 0x22, 0x9A, 0x31, 0xEF, 0x08, 0x53,
-    0x2D, 0xD8, 0xE9, 0xE9, 0xEE, 0xDA, 0x88, 0x91, 0x32, 0xDC, 0xF5, 0xD2, 0x4E, 0x7A, 0x60, 0x05,
-    0xC9, 0xAF, 0x55, 0xB1, 0xDF, 0x13, 0xF0, 0x74, 0x71, 0xCC, 0x13, 0x71, 0x43, 0xFD, 0xAB, 0x05,
-    0x37, 0xAB, 0xC4, 0x79, 0x0B, 0x2E, 0xF4, 0x1F, 0x3C, 0x93, 0x12, 0xB3, 0xCA, 0x78, 0xBC, 0x37,
-    0x9E, 0x1D, 0x4D, 0x61, 0x1E, 0xE5, 0x28, 0xFF, 0xB7, 0xC5, 0xBE, 0x61, 0xBA, 0x6E, 0xDA, 0x21,
-    0xD3, 0x2E, 0x6B, 0xDB, 0x35, 0x4B, 0xA8, 0xB2, 0x64, 0x9E, 0x73, 0x07, 0x9C, 0xD8, 0xD7, 0x30,
-    0x51, 0xA3, 0xBC, 0x6B, 0x9C, 0x98, 0x51, 0x8B, 0xA7, 0x87, 0xC4, 0xCB, 0xEE, 0xFC, 0x8B, 0x76,
-    0x19, 0x35, 0x17, 0x0C, 0xBB, 0x13, 0xE0, 0x56, 0xEF, 0x0B, 0xA6, 0xAA, 0x2F, 0x24, 0x1D, 0x61,
-    0xA6, 0x08, 0xF4, 0x9E, 0xB0, 0x17, 0xF3, 0xD1, 0x53, 0x90, 0x40, 0x7B, 0x22, 0x4F, 0xDA, 0x60,
-    0x5D, 0x93, 0x73, 0x3D, 0x3E, 0xD4, 0xD7, 0x62, 0xC2, 0x46, 0x03, 0x67, 0xF8, 0x89, 0xCF, 0xDE,
-    0xFA, 0x65, 0x66, 0xEA, 0x22, 0x0B, 0x8C, 0x3B, 0xFD, 0x51, 0xA7, 0xFE, 0x7B, 0x99, 0x7F, 0x9F,
-    0x1F, 0xFF, 0xBD, 0xA7, 0xDF, 0xBF, 0xBA, 0xB5, 0xC9, 0x89, 0x0B, 0x33, 0x2C, 0x64, 0x3B, 0x6D,
-    0xB1, 0x60, 0x77, 0x9E, 0x90, 0x7E, 0xE7, 0xD6, 0x8E, 0x46, 0xC5, 0x5B, 0x57, 0xF3, 0xF9, 0x1F,
-    0x77, 0x74, 0xDD, 0x80, 0xDC, 0x98, 0x81, 0xE8, 0x68, 0x83, 0x20, 0xD0, 0xE0, 0xB9, 0xD6, 0x60,
-    0xFD, 0x03, 0x4E, 0xB1, 0x9D, 0x1D, 0xC4, 0xB5, 0x36, 0x96, 0xDD, 0xD3, 0xED, 0xD4, 0xFF, 0x3C,
-    0x36, 0xBC, 0xE3, 0x4E, 0xF2, 0x7B, 0x47, 0x3A, 0x35, 0x67, 0x86, 0x91, 0x07, 0x07, 0x98, 0x1B,
-    0x3B, 0xBF, 0xCF, 0x55, 0x17, 0xE5, 0xA0, 0x6D, 0xDE, 0x2C, 0x65, 0x19, 0xD7, 0xA4, 0xFD, 0x6B,
-    0xB1, 0xA0, 0xE9, 0xF4, 0x76, 0xDE, 0xA0, 0x9E, 0x7C, 0x60, 0x93, 0xDF, 0x79, 0xA0, 0xC9, 0x7F,
-    0xB4, 0xD3, 0x1F, 0x3C, 0xDA, 0x11, 0x02, 0xDD, 0xC8, 0xAC, 0xD0, 0x98, 0x9E, 0xFC, 0x7F, 0x01,
-    0xD5, 0x5A, 0x3F, 0x90, 0xDC, 0x56, 0x19, 0xFF, 0xB4, 0xF2, 0x9D, 0xC0, 0x1A, 0x90, 0x99, 0xB1,
-    0x99, 0x24, 0x97, 0xA0, 0x86, 0x22, 0x64, 0x62, 0xAB, 0xA5, 0xB8, 0x95, 0xE4, 0xA4, 0x48, 0x91,
-    0x22, 0x57, 0xF8, 0x86, 0x22, 0x85, 0x29, 0x13, 0xCF, 0x80, 0x9B, 0x14, 0xC9, 0xCC, 0xDE, 0xAD,
-    0x08, 0x05, 0x05, 0x05, 0xA6, 0xA0, 0xB6, 0x8B, 0x14, 0x99, 0x73, 0x61, 0x0A, 0x17, 0xC7, 0xB0,
-    0xE7, 0x55, 0xA0, 0xA0, 0xA0, 0x40, 0x19, 0xE2, 0x49, 0x41, 0x11, 0x05, 0x0E, 0x32, 0x13, 0x0A,
-    0x2B, 0xB0, 0x19, 0xCB, 0x66, 0xF7, 0xC4, 0xEF, 0xF7, 0xBD, 0xA7, 0x5D, 0xDD, 0xC5, 0x97, 0x21,
-    0x93, 0xF3, 0xC5, 0xAC, 0x6F, 0x9F, 0xF6, 0xCE, 0xD2, 0x7B, 0xDF, 0xF7, 0xBD, 0xEF, 0xCF, 0xEF,
-    0xFB, 0xBD, 0x15, 0x69, 0x5F, 0xBD, 0x4A, 0x7A, 0x4D, 0xE9, 0x56, 0x12, 0x35, 0x7B, 0x5E, 0x21,
-    0xCD, 0xF9, 0xF1, 0xD5, 0xCC, 0xAD, 0x25, 0x98, 0x89, 0x5F, 0x8A, 0x57, 0x4A, 0x90, 0x0B, 0xFF,
-    0x33, 0xE5, 0x98, 0xE8, 0xED, 0x9B, 0x3A, 0xEE, 0xE8, 0x38, 0x12, 0xFE, 0x7D, 0xDA, 0x8E, 0xB8,
-    0x1F, 0xA3, 0x5F, 0x70, 0xC4, 0x83, 0xF8, 0xDF, 0x28, 0xE3, 0xFD, 0x78, 0x30, 0x49, 0x9D, 0x99,
-    0x48, 0x58, 0xFA, 0x35, 0x6E, 0x68, 0x9A, 0x02, 0x4B, 0x8F, 0xF7, 0x28, 0x80, 0x93, 0xCA, 0xE2,
-    0xD5, 0x9B, 0x88, 0xCE, 0xB5, 0xB2, 0x8B, 0xA9, 0xC6, 0xCD, 0x4B, 0xB9, 0x7B, 0xEF, 0xF2, 0x1E,
-    0x26, 0xF4, 0x2A, 0x09, 0x33, 0xCA, 0xC1, 0x45, 0x63, 0x0E, 0x1B, 0x1C, 0x06, 0xBC, 0x77, 0x24,
-    0x6E, 0x89, 0x01, 0xC2, 0x0F, 0xB8, 0xE8, 0xA6, 0x84, 0x29, 0x56, 0xBB, 0x05, 0x09, 0x1A, 0xAC,
-    0xD5, 0xD3, 0xA5, 0x0E, 0xBC, 0x46, 0xBD, 0x12, 0x8F, 0x4F, 0xF1, 0x9C, 0xFB, 0xC9, 0xC4, 0x2D,
-    0xC4, 0xFD, 0xA8, 0xF4, 0xA0, 0x67, 0x93, 0xFA, 0xB9, 0x78, 0xBB, 0x9C, 0x05, 0x1F, 0x82, 0x4C,
-    0x7F, 0x52, 0x8E, 0xA1, 0x70, 0xD6, 0x48, 0xF8, 0x13, 0xB7, 0x23, 0x7E, 0x36, 0x44, 0xFA, 0x82,
-    0x75, 0xF9, 0x33, 0x6A, 0x7F, 0x6A, 0x8E, 0x0E, 0x34, 0xD9, 0xA4, 0x78, 0x92, 0x64, 0x11, 0x44,
-    0x08, 0x9B, 0x26, 0xA5, 0x34, 0x35, 0xD7, 0x5F, 0xDA, 0x2F, 0x4E, 0xA8, 0x26, 0x80, 0x6E, 0x57,
-    0xE4, 0x95, 0x98, 0x8A, 0x8C, 0xA6, 0x02, 0x79, 0x9A, 0x92, 0x62, 0xC0, 0x48, 0x41, 0xE6, 0x60,
-    0x9E, 0x20, 0x85, 0xC6, 0xB8, 0x17, 0x52, 0xE3, 0x5E, 0x8E, 0x09, 0xEF, 0x85, 0x18, 0xB8, 0x0B,
-    0x62, 0x40, 0x6A, 0xC8, 0x03, 0x83, 0x43, 0x98, 0x21, 0x66, 0xDC, 0xEC, 0xDD, 0xC1, 0x98, 0x34,
-    0xBF, 0xC0, 0xDC, 0xC1, 0x2C, 0xE4, 0x12, 0x1D, 0x53, 0x9F, 0x90, 0x53, 0xE6, 0x43, 0xC0, 0xB9,
-    0xF9, 0xF2, 0xFE, 0x98, 0x9B, 0x0F, 0x6E, 0x63, 0xEF, 0x71, 0xA6, 0xED, 0xDD, 0x6B, 0x1D, 0x69,
-    0x87, 0x7B, 0x70, 0x86, 0xA6, 0x99, 0x62, 0x7F, 0x6A, 0xF1, 0xF8, 0x61, 0xF6, 0xF2, 0x9E, 0x2C,
-    0x6F, 0x5D, 0xAF, 0xA1, 0x39, 0x17, 0xF6, 0x2A, 0x28, 0x4F, 0x69, 0x82, 0x1C, 0x12, 0x53, 0xB8,
-    0x84, 0x9B, 0x45, 0x59, 0x77, 0x28, 0x37, 0x7E, 0x9C, 0x5A, 0x68, 0xF6, 0x92, 0x06, 0xA2, 0xE5,
-    0x4B, 0x6B, 0x73, 0xDC, 0x93, 0xA4, 0xFA, 0xB9, 0xA0, 0x87, 0xD1, 0xFE, 0x39, 0xEE, 0x35, 0xBB,
-    0x40, 0x63, 0x42, 0x8D, 0x28, 0xE5, 0xDC, 0xD8, 0x82, 0x21, 0xDD, 0x12, 0xEA, 0x43, 0x4C, 0xEC,
-    0x36, 0xED, 0x30, 0xE1, 0xBD, 0xB2, 0xB9, 0x3E, 0x2E, 0xDC, 0x4F, 0xD7, 0x2F, 0xC8, 0xB0, 0xD9,
-    0xA3, 0xAF, 0xCD, 0x20, 0xE9, 0x15, 0x7E, 0x68, 0xD5, 0x49, 0x1D, 0xAB, 0x5F, 0x79, 0xCE, 0xA8,
-    0x23, 0xDB, 0x78, 0x8E, 0xEA, 0x48, 0x02, 0xB3, 0x52, 0x1D, 0x89, 0x72, 0x31, 0xEA, 0x60, 0xAF,
-    0xAC, 0x3A, 0xEA, 0xF1, 0x7E, 0x7E, 0x72, 0xEB, 0x6D, 0xA3, 0x4E, 0x88, 0x09, 0x55, 0x9D, 0xA5,
-    0xF5, 0xCF, 0xA8, 0xE3, 0xB7, 0xEA, 0x44, 0xAD, 0x3A, 0x9B, 0x56, 0x1D, 0xF9, 0x1F, 0xD4, 0xD9,
-    0xB0, 0xEA, 0xC8, 0x5C, 0x1D, 0xEE, 0x91, 0x55, 0x27, 0x53, 0x75, 0x02, 0xF5, 0x27, 0xBE, 0x4E,
-    0xE9, 0xEE, 0x84, 0xE9, 0x2A, 0x0D, 0x8C, 0x19, 0xC3, 0xD0, 0x78, 0x93, 0xAF, 0xEA, 0xC6, 0xE2,
-    0x32, 0xA6, 0xE0, 0x1F, 0x26, 0xD0, 0x06, 0xFA, 0xCC, 0x4A, 0x39, 0xEA, 0x6D, 0x6D, 0xA5, 0x32,
-    0x9E, 0x8E, 0xB0, 0x95, 0xA9, 0x7B, 0xEF, 0x62, 0xED, 0xAC, 0x0F, 0x11, 0xF2, 0xDE, 0x84, 0x4E,
-    0x14, 0xE4, 0x58, 0x10, 0xB6, 0x8C, 0xA8, 0x90, 0x06, 0xBE, 0xD9, 0xA1, 0x98, 0xD7, 0x88, 0x77,
-    0x78, 0xBA, 0x3F, 0x23, 0x28, 0x49, 0x47, 0x1F, 0xF1, 0x89, 0x92, 0xD7, 0x28, 0xA3, 0x36, 0x74,
-    0x40, 0xC4, 0xBC, 0x24, 0x70, 0xC1, 0x11, 0x85, 0x81, 0x13, 0x36, 0x0D, 0x8C, 0x37, 0x0B, 0x1D,
-    0x5E, 0xE7, 0x8E, 0x08, 0x69, 0x3C, 0xCD, 0x13, 0xBE, 0xB1, 0x4B, 0x26, 0x13, 0x5A, 0x87, 0x73,
-    0x86, 0x34, 0xB2, 0x09, 0x78, 0xB3, 0x3E, 0x57, 0x2F, 0xA8, 0x88, 0xA7, 0x2B, 0xD0, 0xAF, 0x46,
-    0xBA, 0x2F, 0x53, 0x3E, 0x87, 0xC7, 0x61, 0x55, 0x3C, 0x08, 0xED, 0x1D, 0x26, 0x0A, 0x93, 0x29,
-    0xF8, 0xA0, 0x19, 0x37, 0xD7, 0x2F, 0x40, 0xE8, 0x61, 0x33, 0xC5, 0x83, 0xE3, 0x66, 0x6A, 0x36,
-    0x94, 0x0F, 0xB6, 0xF1, 0x37, 0xE4, 0x30, 0x9E, 0xE9, 0xA8, 0x26, 0x7B, 0xDC, 0x4A, 0xE9, 0xA8,
-    0x9C, 0xB8, 0x75, 0xA4, 0x23, 0xE4, 0x3C, 0x29, 0xA2, 0x77, 0x38, 0x13, 0xEB, 0x15, 0xF2, 0x3D,
-    0x1D, 0xFB, 0x2A, 0xE7, 0x40, 0xE5, 0x1C, 0xA9, 0x9C, 0xB5, 0xCA, 0x59, 0xAB, 0x9C, 0x13, 0x3E,
-    0x0D, 0xD9, 0x20, 0x27, 0x6E, 0x0E, 0xC5, 0x1A, 0x13, 0x37, 0x43, 0x42, 0xCF, 0x8C, 0x39, 0xE5,
-    0xC4, 0x23, 0x90, 0x33, 0xC8, 0x54, 0x4E, 0x15, 0x42, 0xB7, 0x94, 0x37, 0x8B, 0x26, 0x53, 0xDD,
-    0x4F, 0x6E, 0xBD, 0x6E, 0x71, 0xA4, 0x52, 0x44, 0x6D, 0x9E, 0x8B, 0xE4, 0x34, 0xA6, 0xDA, 0xC0,
-    0x7B, 0x07, 0xE3, 0x77, 0x75, 0xC7, 0xB9, 0x09, 0xB5, 0x73, 0x4D, 0x26, 0xBD, 0xCA, 0xA9, 0xDC,
-    0xAA, 0x57, 0xB9, 0x48, 0xF9, 0x6E, 0xE1, 0x22, 0xED, 0xB9, 0x85, 0x9F, 0x7B, 0x79, 0x90, 0xF9,
-    0x79, 0x90, 0x06, 0x59, 0xC8, 0x37, 0x0C, 0x12, 0x61, 0xC9, 0x18, 0x53, 0xF5, 0x31, 0x0E, 0x30,
-    0x8E, 0xDA, 0x49, 0x44, 0x55, 0xA7, 0xB2, 0x2F, 0x40, 0xD5, 0x06, 0x6A, 0x31, 0x8B, 0xC3, 0x61,
-    0xCF, 0xE1, 0xDF, 0x58, 0xF4, 0x81, 0x86, 0x97, 0xBE, 0xC0, 0x53, 0x07, 0x32, 0x70, 0xFE, 0xC3,
-    0x0D, 0x1E, 0xF5, 0xFE, 0x5D, 0xE0, 0xE1, 0xDA, 0xFD, 0x5B, 0x89, 0xE7, 0x6B, 0xF7, 0x5D, 0xC8,
-    0xE1, 0x20, 0xF5, 0x4E, 0x1C, 0x08, 0xE3, 0xE5, 0xA3, 0x1E, 0x2E, 0x7E, 0x3E, 0x80, 0x58, 0x65,
-    0x90, 0xC5, 0x90, 0xAC, 0x08, 0xD2, 0xC8, 0xCB, 0xBD, 0x22, 0x90, 0xE0, 0xC5, 0xDC, 0xCF, 0x43,
-    0x09, 0x7E, 0x0E, 0xD7, 0x8A, 0xC4, 0xFB, 0x53, 0x86, 0x1B, 0xC4, 0xFD, 0x20, 0x0D, 0xD2, 0x3E,
-    0xF2, 0x29, 0xE4, 0x1C, 0x88, 0xD3, 0x40, 0xD4, 0x11, 0x45, 0x49, 0x64, 0x9B, 0x59, 0x26, 0x36,
-    0xA6, 0xD8, 0x30, 0x17, 0x13, 0xF7, 0xBD, 0xDA, 0x24, 0xB7, 0xCA, 0x5C, 0x74, 0xFF, 0x9D, 0xB7,
-    0xDA, 0xAC, 0x76, 0xDA, 0xE8, 0xB0, 0x61, 0x74, 0xD8, 0x31, 0x3A, 0x3C, 0x6D, 0x74, 0x10, 0xA3,
-    0x83, 0x18, 0x1D, 0xAE, 0xA9, 0x0E, 0x30, 0x23, 0x75, 0x80, 0x25, 0xA9, 0x03, 0x0D, 0x39, 0xE2,
-    0x67, 0xD5, 0x81, 0xE6, 0x8C, 0xF9, 0x59, 0x75, 0xC0, 0x85, 0x3A, 0xD0, 0xAE, 0xD4, 0x21, 0x55,
-    0x1D, 0x68, 0x5D, 0xE8, 0x40, 0x03, 0x43, 0x87, 0xD8, 0xE8, 0x10, 0x1B, 0x1D, 0xFA, 0x46, 0x87,
-    0x81, 0xAD, 0x55, 0xE6, 0x52, 0x9B, 0xCB, 0xC4, 0x78, 0xA4, 0x49, 0xD9, 0x2F, 0x98, 0x8B, 0x51,
-    0x45, 0xF7, 0xC1, 0xBA, 0xEB, 0xC2, 0xB5, 0x51, 0x36, 0xF5, 0x72, 0xF2, 0x60, 0x09, 0xBC, 0x16,
-    0x95, 0x70, 0x5A, 0xF9, 0x04, 0x49, 0x0F, 0xA9, 0xE1, 0xEE, 0xDF, 0xA7, 0x58, 0x0F, 0x92, 0xEC,
-    0xB0, 0x9C, 0x32, 0x01, 0xD5, 0xA6, 0xB4, 0x4E, 0xB4, 0xA6, 0xC3, 0xCF, 0xE1, 0x9F, 0x53, 0x47,
-    0xB3, 0x79, 0x8D, 0xCD, 0x47, 0x56, 0x9E, 0x30, 0x25, 0x64, 0xD4, 0x99, 0x35, 0x09, 0x7B, 0xA8,
-    0x45, 0x09, 0xFF, 0x8F, 0xAA, 0x54, 0x06, 0x7A, 0x29, 0x20, 0x03, 0xAB, 0x93, 0xF1, 0x61, 0xEB,
-    0xC4, 0xD6, 0x8B, 0xDB, 0x2D, 0x52, 0x3F, 0x96, 0x6F, 0x99, 0x2D, 0x4A, 0x8C, 0x7A, 0xC6, 0x95,
-    0xB5, 0x42, 0x69, 0x75, 0xD2, 0xCA, 0xA4, 0x55, 0xC9, 0x54, 0xA4, 0x79, 0x35, 0xD2, 0xF8, 0x73,
-    0x69, 0x1A, 0xC2, 0x0A, 0x09, 0x34, 0xD7, 0xD0, 0x6E, 0x7D, 0x0E, 0xD3, 0x55, 0xDE, 0xD1, 0x27,
-    0xA0, 0xE8, 0x33, 0xC0, 0x62, 0x1A, 0x25, 0xA6, 0x1C, 0x11, 0xEB, 0x62, 0xC3, 0x94, 0x8F, 0x61,
-    0x6F, 0xEB, 0x86, 0xC6, 0x23, 0x0B, 0x6B, 0xC0, 0x64, 0x8C, 0x9D, 0x62, 0xE9, 0x4F, 0x58, 0xC0,
-    0x36, 0x34, 0x35, 0x51, 0x14, 0x4A, 0x42, 0x41, 0x28, 0x87, 0x8A, 0x61, 0xA5, 0x58, 0x29, 0x9F,
-    0x46, 0x1A, 0x1D, 0xB8, 0xB3, 0x8B, 0x35, 0xD3, 0x27, 0x53, 0x27, 0xD3, 0x26, 0x53, 0x16, 0xD3,
-    0x25, 0x53, 0x25, 0xD3, 0x24, 0x53, 0x15, 0xD3, 0xA3, 0xA6, 0x46, 0xA4, 0x45, 0xA6, 0x44, 0x9F,
-    0x55, 0x39, 0x55, 0xE7, 0x5B, 0x93, 0x73, 0xC0, 0x24, 0xC1, 0x4B, 0x99, 0x78, 0x7B, 0x56, 0x25,
-    0x3B, 0x7F, 0xD2, 0xB0, 0x46, 0x69, 0x82, 0xD0, 0x5C, 0xC2, 0x37, 0xF7, 0x96, 0x46, 0x0D, 0xAD,
-    0x39, 0x13, 0x6B, 0xCF, 0xBE, 0x4D, 0xF0, 0x9D, 0x48, 0x75, 0x6C, 0xB4, 0x6A, 0x32, 0xDD, 0x63,
-    0x11, 0x21, 0xFC, 0x38, 0xED, 0x67, 0xDB, 0xEE, 0x9F, 0x4B, 0x07, 0xEE, 0xBD, 0xC7, 0xE5, 0xF9,
-    0x7A, 0x8B, 0xF7, 0xE3, 0x76, 0x22, 0xC2, 0x4A, 0x8B, 0x59, 0xC1, 0x7C, 0x44, 0x24, 0x94, 0x5B,
-    0x24, 0x14, 0xB6, 0xD0, 0x47, 0x77, 0x6D, 0x8D, 0x15, 0xE5, 0x26, 0xE5, 0x58, 0x65, 0xA0, 0x85,
-    0xDC, 0x8C, 0xA0, 0xEC, 0x42, 0xBA, 0x5E, 0xB3, 0xCB, 0xE4, 0x8F, 0x25, 0x80, 0x2B, 0x15, 0x56,
-    0xE6, 0x8A, 0x2A, 0x15, 0x54, 0x2A, 0xA6, 0x54, 0x48, 0xA9, 0x88, 0x52, 0x01, 0xA5, 0xE2, 0xC9,
-    0xA9, 0x1D, 0xBC, 0x52, 0xC1, 0xA4, 0x62, 0x49, 0x85, 0x92, 0x8A, 0x24, 0x15, 0x48, 0x2A, 0x8E,
-    0x34, 0x30, 0x52, 0x51, 0xA4, 0xD3, 0x5A, 0xF1, 0xEC, 0x21, 0x56, 0x5C, 0xD9, 0xE5, 0x6E, 0x0B,
-    0xE0, 0x64, 0x0E, 0x34, 0x59, 0x12, 0x4C, 0xB2, 0xB4, 0x10, 0x4A, 0x12, 0x49, 0x12, 0x48, 0x12,
-    0x47, 0x12, 0x46, 0x12, 0x45, 0x12, 0x44, 0x12, 0x43, 0x12, 0x42, 0x2E, 0x10, 0x24, 0x71, 0x83,
-    0x53, 0xD2, 0xE0, 0xC4, 0x0B, 0x8A, 0x15, 0x14, 0x27, 0xCC, 0xF1, 0x9C, 0xC2, 0x4A, 0x85, 0x01,
-    0x0A, 0x07, 0x08, 0x05, 0x0A, 0xC2, 0x80, 0x5C, 0xD1, 0x8D, 0x02, 0x4A, 0x2D, 0xFD, 0x0A, 0x27,
-    0x15, 0x4D, 0xC6, 0x76, 0x88, 0x0D, 0x94, 0x54, 0x24, 0xA9, 0x28, 0x52, 0x71, 0xA4, 0xC2, 0xC8,
-    0x0D, 0xAD, 0xC0, 0x19, 0x16, 0x52, 0x0C, 0xE9, 0x29, 0x84, 0x5C, 0x32, 0x11, 0x72, 0x5A, 0x02,
-    0x86, 0xE8, 0x1F, 0x0A, 0x48, 0x09, 0x13, 0xB0, 0x78, 0x5D, 0x30, 0x92, 0x00, 0x4A, 0x12, 0x48,
-    0x42, 0x84, 0x1A, 0x12, 0x4C, 0x08, 0x21, 0x09, 0x20, 0xE9, 0xE5, 0x8C, 0xD3, 0x44, 0xE3, 0xC1,
-    0xCF, 0xFB, 0xEA, 0xE3, 0xC6, 0x2D, 0x09, 0x18, 0x09, 0x17, 0x83, 0xD6, 0x2D, 0xE5, 0xD2, 0x96,
-    0xA8, 0xD9, 0x44, 0xD6, 0xD7, 0xDB, 0x98, 0xBB, 0xF2, 0x98, 0xA8, 0xD1, 0xD4, 0x6A, 0x8B, 0x4A,
-    0x7E, 0xCC, 0xAA, 0x3B, 0x80, 0x77, 0x2E, 0x7E, 0x5D, 0xDE, 0x7A, 0xCB, 0x26, 0x3D, 0x4C, 0xFE,
-    0x1C, 0xF6, 0xFE, 0xF9, 0x12, 0x37, 0xA4, 0x47, 0x67, 0x02, 0x79, 0x86, 0xC3, 0x4E, 0x9B, 0x6C,
-    0x58, 0xD3, 0x4D, 0x32, 0x35, 0x76, 0x18, 0x7C, 0xC5, 0x76, 0x10, 0x67, 0x4D, 0x1B, 0x26, 0x05,
-    0x18, 0x40, 0xB3, 0xF2, 0xBA, 0xB5, 0xC5, 0xF3, 0x0F, 0xC1, 0x16, 0xD7, 0x7A, 0xC8, 0x3B, 0xAF,
-    0x13, 0x2D, 0xC5, 0x0C, 0xF8, 0x40, 0x03, 0xBE, 0x38, 0xC4, 0x31, 0xE4, 0x2B, 0x72, 0x0C, 0x44,
-    0x85, 0x9B, 0xA3, 0x9C, 0xFE, 0xAB, 0x32, 0x95, 0x71, 0x28, 0x0B, 0x07, 0x79, 0xB3, 0x3A, 0x7A,
-    0xA3, 0xBC, 0x32, 0xAF, 0x62, 0x5A, 0xD8, 0x7C, 0xFE, 0xB1, 0x97, 0x3E, 0x3A, 0x81, 0x92, 0x2A,
-    0xCE, 0x14, 0xA9, 0x8C, 0x73, 0xC8, 0xB3, 0x0F, 0x2F, 0x58, 0xC6, 0xC8, 0xED, 0xE8, 0xB6, 0xBC,
-    0x5F, 0x8E, 0x2D, 0xF0, 0x08, 0xF2, 0x79, 0xCD, 0x7A, 0xA2, 0xC9, 0x7B, 0x4D, 0x93, 0x07, 0xF7,
-    0x2E, 0x66, 0x51, 0x1A, 0x42, 0x8D, 0x04, 0x42, 0x8F, 0x24, 0x06, 0x2A, 0x4B, 0xD8, 0xE8, 0x32,
-    0x7D, 0x69, 0xAE, 0xEE, 0x31, 0xA2, 0xBD, 0x06, 0xBE, 0xB5, 0xB4, 0xDE, 0x16, 0xFA, 0x65, 0x87,
-    0x93, 0x41, 0x5A, 0x09, 0xDC, 0x7D, 0xED, 0xFC, 0x71, 0x01, 0x00, 0x07, 0xA2, 0x50, 0xA6, 0xE5,
-    0xAD, 0x6B, 0x0B, 0x6F, 0x82, 0x3C, 0x21, 0xC4, 0x59, 0xB2, 0xE5, 0xEE, 0x28, 0x80, 0xC0, 0x03,
-    0xB5, 0x37, 0x48, 0x50, 0x91, 0xCF, 0xB6, 0x3C, 0x0A, 0xDA, 0xAB, 0x1F, 0x4D, 0xED, 0xFB, 0xD4,
-    0xD1, 0xC1, 0x20, 0x62, 0x59, 0xC3, 0x09, 0x99, 0x8B, 0xAC, 0x5F, 0xE8, 0x68, 0x1B, 0x99, 0x06,
-    0x3E, 0x31, 0x97, 0xD9, 0x8C, 0xFF, 0xE9, 0x4C, 0x0C, 0xA8, 0xFF, 0x50, 0x81, 0x63, 0xF0, 0x3B,
-    0x05, 0xC4, 0xE1, 0x73, 0x7A, 0x49, 0xD4, 0xED, 0x65, 0xA4, 0x1E, 0xE3, 0xD4, 0x1E, 0x3B, 0x67,
-    0xB7, 0xD2, 0x06, 0xDA, 0x2F, 0x82, 0xDB, 0xEB, 0xCA, 0xC9, 0x64, 0x66, 0x46, 0xAE, 0x7E, 0x6B,
-    0x6B, 0x6C, 0x80, 0x76, 0x64, 0x38, 0x28, 0x82, 0x2A, 0xD3, 0x95, 0x29, 0xAD, 0x84, 0xE5, 0xD8,
-    0xA4, 0x63, 0xF1, 0x4D, 0x5A, 0x8E, 0x32, 0x84, 0x8A, 0xBC, 0x13, 0x1D, 0xCF, 0xAC, 0xCF, 0xC9,
-    0x95, 0x95, 0xE2, 0x87, 0xE3, 0x54, 0x9A, 0xFA, 0x6E, 0x53, 0xBA, 0xF7, 0x7E, 0xDC, 0xFC, 0xAC,
-    0xF2, 0xCB, 0x00, 0x10, 0x1A, 0xD8, 0x07, 0x0D, 0x03, 0xD0, 0x7F, 0x49, 0xB3, 0xA0, 0xA5, 0x29,
-    0xFA, 0x84, 0x30, 0x29, 0xDA, 0x6D, 0xD8, 0x76, 0xA4, 0x01, 0x33, 0x52, 0xFE, 0x66, 0x24, 0x43,
-    0x65, 0x71, 0x38, 0xF1, 0xA6, 0x77, 0xA7, 0x5A, 0x46, 0x98, 0x9D, 0xC3, 0x9D, 0x41, 0xBD, 0x4A,
-    0x24, 0x98, 0x2E, 0x00, 0x96, 0x33, 0xDE, 0x4B, 0xA9, 0x06, 0x5A, 0xDA, 0xF7, 0x5E, 0xCE, 0x7B,
-    0xAC, 0xFF, 0x5E, 0x65, 0x04, 0xB6, 0xD0, 0x3F, 0x99, 0x63, 0xED, 0x0D, 0xD3, 0x4D, 0x84, 0x0D,
-    0xB6, 0x2D, 0xE2, 0x70, 0x66, 0x93, 0x1B, 0x18, 0x63, 0x78, 0x66, 0x9C, 0x61, 0xCD, 0x06, 0xB0,
-    0x67, 0x7D, 0x06, 0xDC, 0x03, 0x1B, 0x84, 0x25, 0x31, 0xBF, 0xF6, 0xEA, 0x64, 0x1B, 0xCC, 0x8A,
-    0xCB, 0xF5, 0x49, 0xAA, 0x8B, 0xDD, 0xDA, 0xFB, 0xC1, 0x1E, 0xFA, 0x29, 0x00, 0x31, 0xE5, 0xFD,
-    0xE0, 0x22, 0x53, 0xC3, 0x6C, 0x68, 0x7B, 0x1C, 0xA6, 0xDA, 0x86, 0xF7, 0x2A, 0xC3, 0x1F, 0x44,
-    0x04, 0x85, 0x48, 0x65, 0x85, 0x04, 0xEF, 0xDE, 0x45, 0x8E, 0x6B, 0xDE, 0x87, 0x47, 0xED, 0x31,
-    0x2D, 0x28, 0x8E, 0x7D, 0xE2, 0x06, 0x99, 0x2C, 0x2E, 0x74, 0xE6, 0xD6, 0x9A, 0xBC, 0x41, 0x68,
-    0x3D, 0xE4, 0x6F, 0x2B, 0x86, 0xDF, 0x58, 0xA3, 0x67, 0xBC, 0xEE, 0xE3, 0xC6, 0x3E, 0xB5, 0x08,
-    0xD5, 0xDB, 0xF7, 0x81, 0xCC, 0x2F, 0x67, 0x83, 0x61, 0x6B, 0x03, 0x4D, 0x47, 0x30, 0xFA, 0x26,
-    0x6F, 0x38, 0xDC, 0x06, 0xAC, 0x2F, 0x5A, 0x60, 0xA4, 0xF7, 0xD7, 0xAA, 0x6D, 0xBE, 0x86, 0xA6,
-    0x83, 0x6C, 0xB3, 0xD5, 0xDC, 0x4C, 0xCD, 0x03, 0xCD, 0x34, 0xED, 0x98, 0x29, 0xEA, 0x98, 0x09,
-    0x6A, 0x85, 0xEC, 0x7D, 0x82, 0xFC, 0xB7, 0x05, 0xCC, 0xF4, 0x51, 0x0E, 0x50, 0xF7, 0x22, 0xA6,
-    0x3F, 0xA5, 0xAD, 0x9C, 0x36, 0x51, 0x91, 0xD5, 0xE4, 0x8D, 0xDE, 0x01, 0x33, 0x29, 0x34, 0xAD,
-    0xD8, 0x0F, 0x6C, 0x33, 0x0B, 0x24, 0xD5, 0x41, 0x68, 0x0A, 0xCD, 0x98, 0xDF, 0x69, 0x90, 0x9A,
-    0x3A, 0x92, 0x2A, 0x73, 0x26, 0x1E, 0x8B, 0x11, 0xFE, 0xA4, 0x18, 0xDC, 0xFD, 0x10, 0xC6, 0x75,
-    0xDF, 0x87, 0x71, 0xBD, 0x0F, 0x98, 0xB4, 0x89, 0x7B, 0x83, 0xBB, 0xC4, 0x16, 0xEF, 0x28, 0x2B,
-    0x53, 0x33, 0x77, 0x8C, 0xE6, 0xC5, 0x28, 0xE1, 0x00, 0x30, 0x40, 0xBA, 0xC8, 0xF0, 0x31, 0xCA,
-    0xC4, 0xAA, 0x28, 0x94, 0x84, 0x82, 0x50, 0x0E, 0x8A, 0xD1, 0x25, 0x3C, 0x23, 0xBB, 0x19, 0xB1,
-    0xDD, 0x8F, 0x05, 0xB5, 0xF0, 0xB6, 0x4C, 0x5C, 0x84, 0x08, 0x69, 0xC3, 0xC4, 0x00, 0x72, 0x98,
-    0xD8, 0xFD, 0x0B, 0x8A, 0xE3, 0x9D, 0x5C, 0xC5, 0x09, 0xD0, 0x79, 0xB3, 0x88, 0x87, 0x90, 0x85,
-    0xA2, 0x50, 0x12, 0xC3, 0x52, 0xD8, 0x36, 0xF7, 0xF8, 0x3A, 0x0E, 0xAD, 0xF3, 0x67, 0xDB, 0x64,
-    0x28, 0x37, 0x39, 0xFC, 0x46, 0x69, 0xA4, 0xB4, 0xB5, 0xFA, 0x97, 0xED, 0x39, 0x08, 0xE5, 0x4A,
-    0x3A, 0x1B, 0x04, 0x83, 0x7A, 0xDE, 0x7B, 0xC2, 0xD6, 0xDC, 0x96, 0x49, 0x15, 0x42, 0xD3, 0xE4,
-    0x3C, 0x49, 0x3E, 0x4A, 0xBA, 0x47, 0xC8, 0xAC, 0x4C, 0x8C, 0x67, 0xD6, 0x8F, 0xA6, 0xFF, 0xFA,
-    0x3C, 0x5B, 0x3C, 0x10, 0xF2, 0xD9, 0x68, 0x24, 0x67, 0xDA, 0xE0, 0x7D, 0x69, 0x6B, 0xBA, 0xC0,
-    0xC9, 0x89, 0x29, 0x5D, 0x4A, 0xC0, 0x62, 0xB2, 0xE4, 0x9A, 0xE9, 0xB0, 0xCF, 0x0C, 0x73, 0x3D,
-    0xBC, 0x50, 0x2F, 0x6E, 0xDF, 0xFC, 0x3D, 0xC8, 0x77, 0xA1, 0x1A, 0x89, 0xE4, 0xCB, 0x80, 0x2A,
-    0xBA, 0xE6, 0x12, 0xD6, 0xF4, 0xB2, 0x6D, 0x41, 0x13, 0x2D, 0xEC, 0xA2, 0x95, 0x7D, 0xB1, 0x6B,
-    0x5E, 0xDA, 0x7A, 0x5B, 0x0B, 0xC4, 0xA5, 0xEB, 0x13, 0x3D, 0x12, 0xD1, 0x45, 0x62, 0xD3, 0x92,
-    0x73, 0x4A, 0x86, 0x33, 0x12, 0x8C, 0x0C, 0xF1, 0xFB, 0xB7, 0xF9, 0x1C, 0x79, 0xDF, 0xA0, 0x03,
-    0x97, 0x02, 0xDB, 0xE2, 0x13, 0x69, 0x0F, 0x65, 0x77, 0x79, 0xAA, 0xE4, 0x69, 0x44, 0xA2, 0x1A,
-    0xAD, 0xBB, 0xF8, 0x87, 0xAC, 0xCB, 0x0E, 0x5E, 0x5B, 0xFE, 0x6A, 0xD1, 0xF2, 0xAB, 0x1A, 0x85,
-    0xE9, 0x5B, 0xBA, 0x53, 0x77, 0xD9, 0x83, 0x96, 0x39, 0xD8, 0xD8, 0xCF, 0x1E, 0xD0, 0x3C, 0x40,
-    0x74, 0x32, 0x4E, 0xFF, 0xDF, 0x49, 0x7F, 0xA5, 0xF8, 0xC5, 0x32, 0xFC, 0x62, 0x09, 0x7E, 0xB1,
-    0xFC, 0xFE, 0x82, 0xDE, 0x6F, 0xD9, 0xFD, 0x96, 0xDC, 0x6F, 0xB9, 0xFD, 0x56, 0xE8, 0x96, 0xD9,
-    0x6F, 0x89, 0xFD, 0x96, 0xD7, 0x6F, 0x69, 0xFD, 0x56, 0xDE, 0x56, 0xDC, 0x56, 0xDA, 0x96, 0xD2,
-    0x6F, 0x19, 0xFD, 0x96, 0xD0, 0x6F, 0xF9, 0xFC, 0xFD, 0x74, 0x7E, 0xE7, 0x44, 0x68, 0x4E, 0x99,
-    0xB5, 0x9C, 0x59, 0x4B, 0x9A, 0x59, 0xD6, 0xEC, 0x51, 0x63, 0xF3, 0x6D, 0xEC, 0x27, 0xFB, 0x3A,
-    0x66, 0x86, 0x6C, 0xCB, 0x49, 0x1E, 0x77, 0xB1, 0x36, 0x6C, 0x88, 0x1E, 0x2A, 0x32, 0x0E, 0x0D,
-    0x27, 0x6A, 0x98, 0xF3, 0xAF, 0xB0, 0x58, 0x0F, 0xD8, 0x03, 0x8A, 0xAD, 0x96, 0xA2, 0x41, 0xC1,
-    0xB8, 0x65, 0x88, 0x62, 0x11, 0x86, 0x8E, 0x32, 0xAC, 0x27, 0xF5, 0x82, 0x3E, 0xD0, 0x55, 0xF8,
-    0xC4, 0xDB, 0xC8, 0x1A, 0x43, 0x47, 0x32, 0xC5, 0x3E, 0xB3, 0x1A, 0xF6, 0xF6, 0xF6, 0x3A, 0x4D,
-    0x81, 0x45, 0xF5, 0x92, 0x62, 0x60, 0x69, 0x54, 0xE6, 0x36, 0x22, 0xE7, 0x3F, 0xA1, 0x04, 0xB5,
-    0x39, 0x0B, 0xA9, 0x31, 0x13, 0x8C, 0x3A, 0xD3, 0x7A, 0x0D, 0x89, 0xF4, 0x44, 0x23, 0xB2, 0xBC,
-    0xF1, 0x7C, 0x13, 0xBD, 0x37, 0x89, 0x90, 0xAF, 0x42, 0xDE, 0x60, 0xC7, 0x83, 0x57, 0xD3, 0x1A,
-    0x61, 0x6E, 0x8E, 0x16, 0x37, 0xB8, 0x3D, 0x1B, 0xE6, 0xE4, 0xB3, 0xCF, 0x55, 0x06, 0xCC, 0xA4,
-    0xDA, 0x82, 0x2A, 0x61, 0x3C, 0x61, 0x44, 0x00, 0xFC, 0xF1, 0xC0, 0x72, 0x08, 0xF9, 0x7B, 0x3C,
-    0x21, 0x0B, 0x49, 0x25, 0x22, 0x8B, 0x78, 0x77, 0xF4, 0xEC, 0x37, 0x6B, 0xDB, 0x95, 0xB9, 0xA1,
-    0x42, 0xE9, 0x58, 0xCB, 0x0E, 0xFD, 0x8E, 0x43, 0xE9, 0x9D, 0x0A, 0x18, 0x0D, 0xA4, 0xAF, 0xBA,
-    0x3B, 0xA8, 0xB4, 0xBD, 0x92, 0xF6, 0x4A, 0xD9, 0x93, 0xB0, 0x57, 0xBA, 0x5E, 0xC9, 0x7A, 0xA5,
-    0xEA, 0x95, 0xA8, 0x57, 0x9A, 0x5E, 0x49, 0x7A, 0xA5, 0xE8, 0x95, 0xA0, 0x57, 0x7A, 0x5E, 0xC9,
-    0x79, 0xA5, 0xE6, 0x95, 0x98, 0x57, 0x5A, 0x5E, 0x49, 0x79, 0xA5, 0xE4, 0x95, 0x90, 0xDF, 0x36,
-    0xEE, 0xBC, 0x66, 0x59, 0xD5, 0x91, 0x15, 0x2F, 0x58, 0x38, 0x36, 0xD9, 0xF4, 0x4F, 0x9A, 0x9A,
-    0x3C, 0x3A, 0x49, 0x74, 0x32, 0xE8, 0xA4, 0xCF, 0xC9, 0x9D, 0x93, 0x38, 0x27, 0x6B, 0x4E, 0xCA,
-    0x9C, 0x7C, 0x39, 0xC9, 0x72, 0xDB, 0x51, 0xCF, 0xBB, 0xEA, 0x7D, 0x51, 0x10, 0xCF, 0x6B, 0x2A,
-    0x17, 0xF4, 0x18, 0x22, 0xDF, 0xE4, 0x52, 0x4F, 0xFA, 0x18, 0xBE, 0x11, 0xE8, 0x69, 0x2E, 0x07,
-    0x6D, 0x86, 0x98, 0x00, 0x36, 0x0E, 0xEB, 0xF6, 0x72, 0x65, 0x0E, 0x1E, 0xD4, 0xED, 0x05, 0x9F,
-    0xD3, 0xED, 0xE9, 0x41, 0x09, 0xCB, 0x5E, 0xD4, 0x16, 0x78, 0xFC, 0x09, 0x2B, 0xFA, 0x57, 0xD9,
-    0x7E, 0xA7, 0xFA, 0xF6, 0x6E, 0xB0, 0xA5, 0x3A, 0xD2, 0xCE, 0xCF, 0x31, 0xED, 0xAE, 0x5F, 0x74,
-    0x13, 0x60, 0xBF, 0x7B, 0xEA, 0xD1, 0x3D, 0xBE, 0x7E, 0x14, 0xDB, 0x41, 0x9B, 0x73, 0x0C, 0x23,
-    0x16, 0xA5, 0x8B, 0x03, 0xA8, 0xEA, 0x80, 0xF4, 0xC7, 0xD5, 0x20, 0xEA, 0xA8, 0x3E, 0x15, 0xCD,
-    0x8B, 0x45, 0xB5, 0x10, 0xE5, 0x6B, 0x10, 0xBC, 0x8E, 0x4D, 0x8D, 0x4C, 0x8A, 0xA8, 0x82, 0xA7,
-    0xFB, 0x15, 0x36, 0x3F, 0xAC, 0xA1, 0x6E, 0x3C, 0xE5, 0xD7, 0x38, 0x46, 0xAC, 0xE6, 0xA3, 0x30,
-    0xC5, 0x16, 0x46, 0x58, 0x7F, 0x44, 0xC0, 0x3D, 0x4D, 0x10, 0xF2, 0xD3, 0x04, 0x5E, 0x54, 0x27,
-    0x5E, 0xD1, 0x9B, 0x24, 0x0A, 0xE6, 0x36, 0x21, 0x76, 0xC8, 0x8C, 0x89, 0x7C, 0x91, 0xA4, 0x7E,
-    0xDD, 0xDB, 0xA3, 0x3D, 0x91, 0x7D, 0x88, 0x04, 0x9F, 0xED, 0x7E, 0x81, 0xE0, 0xB4, 0x41, 0x5F,
-    0x44, 0x27, 0xF4, 0xB6, 0x50, 0x89, 0x6C, 0x1D, 0x96, 0xEF, 0x9F, 0xC5, 0xB6, 0x4E, 0xD1, 0x5D,
-    0x4E, 0x7A, 0x13, 0x17, 0x75, 0x37, 0x40, 0xE4, 0xC4, 0xA3, 0x20, 0x1D, 0x0D, 0x42, 0x07, 0x62,
-    0xB8, 0x90, 0x02, 0x6D, 0x48, 0x14, 0xA3, 0xBF, 0x40, 0x20, 0x07, 0x95, 0x57, 0x04, 0x80, 0x92,
-    0x01, 0x32, 0x61, 0x3C, 0x9E, 0xC8, 0x93, 0xF3, 0x22, 0x93, 0x92, 0x14, 0x2D, 0x6B, 0x8B, 0x71,
-    0x85, 0x61, 0x21, 0xAB, 0x8C, 0x9C, 0x13, 0xCE, 0x31, 0x73, 0x27, 0x14, 0x85, 0x7D, 0x95, 0x0A,
-    0xC2, 0x09, 0x29, 0x46, 0x2B, 0xC5, 0xD1, 0x44, 0xCE, 0xAB, 0xED, 0x71, 0x66, 0x70, 0x1D, 0x1E,
-    0xFE, 0x94, 0x94, 0x34, 0x65, 0x7A, 0xCC, 0x14, 0x11, 0xA5, 0xF0, 0x20, 0x44, 0x70, 0xBD, 0x50,
-    0x11, 0x5A, 0x09, 0x8E, 0x42, 0xC5, 0xB5, 0xD3, 0x10, 0x12, 0xCB, 0xC0, 0xF1, 0xA4, 0xCF, 0x53,
-    0x28, 0x54, 0x4A, 0xC7, 0xCE, 0x3F, 0x54, 0x48, 0x0A, 0x34, 0x8A, 0x78, 0x3C, 0x70, 0xDA, 0x35,
-    0x87, 0xBE, 0x08, 0x6B, 0x86, 0x11, 0x63, 0xFC, 0x41, 0xD0, 0x37, 0x56, 0xF4, 0x78, 0x61, 0x3E,
-    0x15, 0xF9, 0xBC, 0xE0, 0xA7, 0x68, 0x9C, 0xDE, 0xA9, 0x50, 0xA8, 0x91, 0xFB, 0x2B, 0x58, 0xE9,
-    0xD4, 0x09, 0xBB, 0x65, 0xB5, 0xED, 0x63, 0xA2, 0x0C, 0x59, 0x23, 0xE3, 0x3F, 0x04, 0x46, 0x1A,
-    0x3B, 0xB7, 0xF0, 0x7C, 0xAD, 0x35, 0x75, 0xA7, 0xD3, 0xD3, 0x32, 0xFE, 0x93, 0xF4, 0x31, 0xE1,
-    0x57, 0x45, 0x3C, 0xF6, 0x0E, 0x0A, 0xD5, 0x9F, 0x40, 0x80, 0xE2, 0x17, 0xF7, 0x63, 0x94, 0x4B,
-    0xF9, 0x3E, 0x6A, 0xDC, 0xA9, 0x87, 0xA5, 0x8B, 0x1E, 0x70, 0x03, 0x40, 0x49, 0x7C, 0x23, 0x95,
-    0x9B, 0x6E, 0x26, 0xA7, 0x9C, 0x23, 0xD3, 0x63, 0xE9, 0xFC, 0x9A, 0xF8, 0x48, 0xB1, 0xA8, 0xAC,
-    0x68, 0x39, 0xE0, 0x4E, 0xDB, 0xE7, 0xF0, 0xF7, 0xA5, 0x87, 0x76, 0x6A, 0x79, 0x66, 0x29, 0x4D,
-    0x90, 0x5E, 0x9E, 0x2F, 0xB0, 0x31, 0xBD, 0xE2, 0xA6, 0xA4, 0x6A, 0xB5, 0x93, 0xA9, 0x1E, 0x4C,
-    0x76, 0xBE, 0x9C, 0xD5, 0x6F, 0xBF, 0x8D, 0x35, 0xD5, 0xE9, 0x28, 0xDC, 0xE2, 0x40, 0x53, 0xF9,
-    0x7A, 0x92, 0xCD, 0xE1, 0xF5, 0x5C, 0x56, 0x7B, 0x39, 0x4C, 0x9F, 0x3E, 0x2C, 0x81, 0xE5, 0x71,
-    0xF6, 0xAE, 0xFE, 0xC7, 0x55, 0x20, 0xBF, 0xB6, 0x5F, 0xB7, 0xFA, 0xA2, 0x67, 0xAC, 0x6A, 0xCE,
-    0x84, 0x29, 0x3C, 0x7C, 0x81, 0x82, 0xB1, 0xA2, 0x51, 0x77, 0xB1, 0xDA, 0x1F, 0xF7, 0x19, 0xAB,
-    0xC6, 0xC6, 0xEF, 0x3B, 0x7B, 0x7E, 0xF3, 0x6C, 0x27, 0x36, 0x8E, 0xE2, 0x8C, 0x75, 0xF9, 0x0A,
-    0x35, 0x26, 0xC0, 0xB9, 0xC5, 0xFA, 0x5B, 0xFA, 0x9D, 0xEF, 0x6B, 0x1D, 0xF3, 0x79, 0x32, 0x77,
-    0x8B, 0xAE, 0x12, 0x1D, 0x70, 0x95, 0xA3, 0xD0, 0x13, 0x39, 0x4D, 0x50, 0x7B, 0x65, 0x80, 0xED,
-    0x3E, 0xE7, 0x63, 0xE3, 0xDD, 0x4E, 0x4E, 0x43, 0x8B, 0x34, 0x06, 0xFC, 0x9E, 0xBD, 0x3C, 0x85,
-    0x7B, 0xED, 0x10, 0xC2, 0x13, 0xBF, 0xF3, 0x4D, 0x00, 0x0F, 0x97, 0x99, 0x7A, 0xB9, 0x37, 0xA1,
-    0xB8, 0x01, 0xFA, 0xDC, 0xE0, 0x57, 0x6C, 0x3D, 0x01, 0x0F, 0x08, 0xD1, 0xA1, 0x50, 0xAC, 0xB4,
-    0x58, 0x90, 0xB1, 0xF1, 0x1B, 0x40, 0x5F, 0xCA, 0xC2, 0x58, 0x3D, 0x74, 0xDF, 0xAE, 0xC1, 0x72,
-    0x9F, 0x34, 0xE2, 0xDC, 0xFD, 0x87, 0xA0, 0x6A, 0x4B, 0xCF, 0x52, 0x23, 0xCC, 0x39, 0x6D, 0x34,
-    0x1C, 0x46, 0x1B, 0x98, 0x7E, 0x14, 0xF9, 0x4C, 0x20, 0xAF, 0x7B, 0xBF, 0x16, 0x2F, 0x5B, 0x35,
-    0x14, 0xE9, 0xC3, 0xD1, 0xE3, 0xD0, 0x3D, 0xF9, 0xB2, 0x3A, 0x5C, 0x38, 0xC3, 0x78, 0xD6, 0x3F,
-    0xE9, 0x3D, 0x4A, 0x34, 0xFD, 0xA4, 0xB4, 0x58, 0xE2, 0xF8, 0xCF, 0xED, 0x14, 0x37, 0x00, 0xC1,
-    0xCC, 0x13, 0x6B, 0x07, 0x37, 0x1C, 0xCD, 0xB9, 0xA5, 0x06, 0x1A, 0x29, 0x28, 0xE7, 0x3E, 0xBF,
-    0xDA, 0x94, 0x3F, 0x25, 0xF3, 0x8D, 0x3B, 0xF6, 0x43, 0xEC, 0x57, 0x0D, 0x82, 0x09, 0xFE, 0x59,
-    0xCA, 0x77, 0x80, 0x50, 0x6D, 0xB2, 0x3C, 0xA2, 0x03, 0x7C, 0xD1, 0x8A, 0x95, 0xA0, 0x72, 0x35,
-    0xE7, 0xB7, 0x1D, 0x4B, 0x6C, 0xB5, 0x6F, 0x72, 0x03, 0xFC, 0x62, 0xB2, 0x90, 0xFB, 0xE3, 0xE1,
-    0x02, 0xBD, 0x47, 0x69, 0xA1, 0x20, 0xDF, 0x4F, 0xC8, 0x45, 0xD9, 0x6B, 0xCE, 0x58, 0x0B, 0x6B,
-    0xD4, 0x92, 0x80, 0xED, 0xD7, 0xB3, 0x26, 0x6A, 0x31, 0x65, 0x3A, 0x74, 0x87, 0x2E, 0xEF, 0x22,
-    0xD0, 0x1B, 0xF1, 0x77, 0x7F, 0xB4, 0x70, 0x3A, 0xFA, 0xD3, 0xA4, 0x9D, 0x9E, 0xD3, 0x56, 0x16,
-    0x9C, 0x99, 0x02, 0x72, 0x05, 0xC2, 0x34, 0x98, 0x77, 0xD8, 0x2C, 0x4E, 0x77, 0xB4, 0xF0, 0xF3,
-    0xD6, 0xCC, 0xF4, 0x9A, 0x27, 0x6C, 0xBB, 0xC3, 0xF7, 0x99, 0x8B, 0xB7, 0x2F, 0xEC, 0xE3, 0x09,
-    0xA3, 0x43, 0x98, 0xF5, 0x69, 0xA7, 0x46, 0xB5, 0x60, 0xE2, 0x00, 0x2F, 0xD8, 0xBE, 0x54, 0x53,
-    0x31, 0x5F, 0x23, 0x58, 0xED, 0x74, 0xD8, 0xAF, 0xB1, 0x6B, 0xC0, 0x83, 0x2B, 0xF7, 0xAF, 0x8C,
-    0x9B, 0x62, 0xE5, 0x76, 0xFA, 0xD9, 0x72, 0x95, 0xB4, 0x15, 0x6B, 0x43, 0x7F, 0x92, 0xA9, 0xA0,
-    0x17, 0x30, 0xF6, 0x0F, 0xB4, 0x34, 0xAF, 0x6A, 0x4B, 0xBB, 0xE8, 0x02, 0x2E, 0x43, 0x4F, 0x9F,
-    0x0A, 0x07, 0x05, 0xCC, 0xF2, 0x75, 0xDB, 0x4C, 0xCE, 0x07, 0x8A, 0x69, 0x8E, 0x79, 0xD8, 0xE8,
-    0xAC, 0xCC, 0x44, 0xBF, 0xEC, 0x01, 0x20, 0x3B, 0xA6, 0x89, 0xA3, 0x79, 0x5F, 0xD3, 0x19, 0xB2,
-    0xB6, 0xE9, 0x1A, 0xB6, 0xDF, 0x13, 0xF3, 0x69, 0xDE, 0x31, 0xB7, 0x6E, 0x46, 0xEA, 0x05, 0xDA,
-    0x26, 0xF5, 0xE2, 0x4B, 0x81, 0x1A, 0x03, 0xCD, 0x15, 0x58, 0xB4, 0x96, 0xF8, 0xFC, 0xAC, 0x63,
-    0xBA, 0xBE, 0xA5, 0x87, 0xF1, 0xF8, 0xE5, 0xC2, 0x80, 0x85, 0xAB, 0x85, 0x75, 0x97, 0x6A, 0xBF,
-    0x19, 0xD9, 0xAD, 0x26, 0x99, 0xEE, 0xEA, 0xE5, 0x09, 0x1C, 0x03, 0x09, 0x0F, 0xC5, 0x61, 0xD7,
-    0x7E, 0x2F, 0xB7, 0x3D, 0xB9, 0x3A, 0xA7, 0x4D, 0xA3, 0x82, 0xF0, 0xAA, 0x7B, 0x72, 0xC5, 0xD0,
-    0x36, 0x01, 0xA2, 0x38, 0x85, 0x07, 0x32, 0x8A, 0x0D, 0x14, 0x1D, 0x28, 0x3E, 0x50, 0x84, 0xA0,
-    0x18, 0x81, 0xB4, 0x4F, 0xEE, 0x73, 0x00, 0xF6, 0xBB, 0x98, 0xA9, 0xF1, 0xD5, 0xFC, 0xA1, 0xED,
-    0xF1, 0xED, 0x81, 0x8C, 0x52, 0x33, 0x1B, 0x9C, 0x7B, 0x30, 0x0F, 0xBF, 0x2F, 0x7C, 0x24, 0x33,
-    0x07, 0x37, 0x51, 0x21, 0x9F, 0x92, 0xD6, 0xB8, 0x3D, 0x85, 0x8A, 0x03, 0x77, 0x8A, 0x77, 0x85,
-    0x77, 0x89, 0xA0, 0x2C, 0x34, 0x28, 0xE7, 0xB4, 0x86, 0x06, 0xA6, 0x68, 0x60, 0x22, 0x28, 0x3D,
-    0x04, 0xA5, 0x9F, 0xFF, 0x17, 0x8D, 0x54, 0x31, 0x6F, 0xDB, 0x46, 0x14, 0xFE, 0x48, 0xCA, 0xA6,
-    0x1B, 0xDA, 0x3E, 0xA5, 0x55, 0x8A, 0x24, 0x55, 0xCC, 0x00, 0xF5, 0x20, 0xA8, 0xB2, 0xA9, 0xA2,
-    0x1A, 0xD4, 0x82, 0x14, 0xEF, 0x0F, 0x04, 0xE0, 0x10, 0xA2, 0x43, 0x17, 0x0D, 0x1D, 0x0A, 0x23,
-    0x45, 0x34, 0x68, 0x50, 0x02, 0xC5, 0xBA, 0xA6, 0x63, 0x17, 0x15, 0xC8, 0xD4, 0xC9, 0x43, 0x07,
-    0x47, 0x1E, 0xEC, 0x21, 0x43, 0x8B, 0xDA, 0xD1, 0x75, 0x2A, 0x90, 0x2E, 0xDC, 0x3A, 0x74, 0x28,
-    0x0B, 0xE4, 0x07, 0x70, 0x10, 0x50, 0xA5, 0x90, 0x74, 0x7D, 0x47, 0xC9, 0x4D, 0x91, 0xA9, 0x14,
-    0x49, 0xF1, 0xDE, 0xBB, 0x7B, 0xF7, 0xEE, 0xFB, 0xBE, 0xF7, 0x4A, 0x08, 0xE1, 0xC2, 0x11, 0x56,
-    0x02, 0x8E, 0xC8, 0xCA, 0x9C, 0xC4, 0xE5, 0x3E, 0x8A, 0x40, 0x09, 0x98, 0xC3, 0x52, 0x60, 0xDF,
-    0x88, 0xC0, 0x4A, 0x8A, 0xE0, 0x06, 0x2F, 0x38, 0xD3, 0xB2, 0xAB, 0x66, 0x3E, 0xCB, 0x68, 0x38,
-    0x50, 0x50, 0x0A, 0x71, 0x8C, 0xEA, 0x68, 0x84, 0x01, 0x7D, 0x56, 0x47, 0x4F, 0x71, 0xDB, 0x10,
-    0x3D, 0x5B, 0x84, 0x0A, 0xEE, 0x0C, 0x06, 0x47, 0xE9, 0x7C, 0xF6, 0x39, 0x0C, 0xF8, 0x8C, 0xF7,
-    0x19, 0xDF, 0x5D, 0x43, 0x28, 0x3E, 0x48, 0x8D, 0xD4, 0x4C, 0x43, 0xE1, 0xA3, 0x01, 0x67, 0xD8,
-    0x9A, 0x34, 0xFC, 0x4E, 0xAD, 0xD9, 0x73, 0x33, 0x03, 0x88, 0x4A, 0x56, 0x3A, 0x65, 0x5F, 0xA7,
-    0xFB, 0x8E, 0xE8, 0xED, 0xA0, 0x58, 0xA4, 0x24, 0xB8, 0x6F, 0x4B, 0xD7, 0x03, 0x9B, 0xC1, 0xCE,
-    0x74, 0x3C, 0x80, 0x71, 0xFA, 0x51, 0xC2, 0xFB, 0x08, 0xE0, 0xA3, 0x42, 0x16, 0xB8, 0x8C, 0xEF,
-    0x33, 0xB4, 0x5C, 0x04, 0x1E, 0x2A, 0x37, 0x50, 0x5A, 0x43, 0x8B, 0x09, 0xD7, 0x96, 0xCE, 0xE3,
-    0xD4, 0x92, 0x19, 0x78, 0x11, 0x6D, 0x18, 0x13, 0x7D, 0xDF, 0xFE, 0x56, 0x34, 0x2D, 0x19, 0x2A,
-    0xCE, 0xE6, 0xA0, 0xD3, 0x1A, 0xDF, 0xC3, 0x5D, 0xE0, 0xF0, 0x14, 0x67, 0x36, 0xE7, 0x94, 0x40,
-    0x6A, 0x25, 0xB6, 0x64, 0xC2, 0x43, 0x0B, 0x17, 0xB8, 0x0B, 0x2B, 0xB5, 0x13, 0x26, 0x19, 0xF7,
-    0x68, 0xAB, 0x1E, 0x25, 0xD3, 0x7F, 0x14, 0x04, 0xC1, 0xDE, 0xAD, 0xC2, 0x9B, 0xF6, 0xD2, 0x25,
-    0x82, 0x92, 0x62, 0xDE, 0x35, 0x27, 0x76, 0xCA, 0x44, 0xA0, 0x11, 0x04, 0xB2, 0x77, 0xD3, 0x71,
-    0xF2, 0xA9, 0xB4, 0xA4, 0xCE, 0x7D, 0x07, 0xFB, 0x51, 0x38, 0x09, 0x22, 0x7F, 0xE9, 0x0B, 0x95,
-    0xAC, 0x9E, 0x48, 0x58, 0x02, 0xB6, 0x80, 0xC3, 0xC1, 0xA0, 0xEF, 0xB7, 0xB4, 0x6B, 0x86, 0xA9,
-    0x49, 0x44, 0x84, 0x7C, 0x17, 0x36, 0xDF, 0x47, 0x93, 0xB0, 0xF2, 0x71, 0x8B, 0x1C, 0x06, 0x6D,
-    0x62, 0xC9, 0xFB, 0x2F, 0xC7, 0x13, 0xA0, 0x7A, 0x1C, 0xCE, 0x6C, 0x69, 0x0B, 0x47, 0xC3, 0x02,
-    0x93, 0xEC, 0x83, 0xD9, 0xFD, 0x97, 0x0E, 0x5F, 0xC7, 0xC1, 0xF1, 0x78, 0xAA, 0x6D, 0x98, 0x62,
-    0x62, 0x64, 0x46, 0x66, 0xA6, 0x9F, 0x25, 0x63, 0x79, 0x48, 0x86, 0x16, 0xA5, 0xDC, 0xC7, 0x39,
-    0x7E, 0xC0, 0x05, 0x1F, 0x48, 0x4F, 0xA2, 0x15, 0x06, 0x28, 0x18, 0x08, 0x1C, 0x11, 0x30, 0x51,
-    0x5A, 0xCF, 0x29, 0xE9, 0x34, 0x3B, 0x7E, 0xAF, 0xE7, 0x69, 0x4A, 0x08, 0x6E, 0x97, 0xB6, 0xEE,
-    0x22, 0x82, 0x45, 0xB0, 0x33, 0x69, 0x12, 0x79, 0x27, 0x72, 0x01, 0x4B, 0x32, 0xB2, 0xFB, 0x08,
-    0xB8, 0x27, 0xF5, 0x3C, 0x47, 0x68, 0x62, 0xDC, 0x15, 0x31, 0x15, 0xD2, 0xC2, 0x71, 0xA8, 0x66,
-    0x3D, 0xF8, 0xCF, 0xE0, 0x67, 0xE8, 0x45, 0xF9, 0x91, 0x3B, 0xFE, 0xF6, 0x83, 0x8B, 0xBE, 0xF7,
-    0x47, 0x46, 0xDF, 0x45, 0x44, 0xA4, 0x2A, 0xE6, 0x72, 0x87, 0x44, 0x46, 0xE4, 0x44, 0xC4, 0x3F,
-    0x4C, 0xE2, 0x79, 0x0E, 0xD7, 0xC5, 0xB9, 0x2D, 0x22, 0x83, 0x0F, 0x4D, 0x64, 0x0C, 0xE3, 0x05,
-    0xC2, 0xA9, 0x26, 0x9F, 0xE8, 0x62, 0x0A, 0xE1, 0xA9, 0xE6, 0x30, 0x97, 0x63, 0xC9, 0x9D, 0x34,
-    0x5B, 0x2A, 0xEB, 0x7A, 0x49, 0xD1, 0x20, 0x38, 0xC5, 0x40, 0xF1, 0x6B, 0x31, 0xAE, 0xC5, 0x31,
-    0x69, 0x53, 0x89, 0x03, 0x92, 0xA5, 0xBE, 0x3C, 0x45, 0x40, 0x8F, 0x46, 0x39, 0x4A, 0xE4, 0xCB,
-    0xA5, 0x1A, 0xD3, 0x3F, 0xC9, 0x99, 0x4D, 0x6A, 0x9E, 0x9A, 0x36, 0x5D, 0x92, 0xB3, 0x56, 0xEF,
-    0x58, 0x2D, 0x0E, 0x46, 0xC7, 0x34, 0x27, 0x8E, 0xC7, 0x4A, 0xA9, 0xC5, 0x88, 0xAE, 0xA7, 0x7A,
-    0x99, 0x23, 0x31, 0x10, 0xE6, 0x1C, 0x5E, 0x42, 0x08, 0xA2, 0x80, 0xCB, 0x6B, 0x9F, 0x1E, 0x3F,
-    0xC7, 0x19, 0x06, 0x1D, 0x8A, 0x4A, 0x08, 0xB6, 0xCC, 0x69, 0xFC, 0xD7, 0x35, 0x79, 0xED, 0x72,
-    0xFE, 0xBF, 0xEB, 0xF3, 0x3C, 0x7C, 0x4D, 0xCB, 0x8A, 0x7E, 0xFB, 0xC4, 0x17, 0x08, 0xD4, 0xEB,
-    0x3E, 0x6A, 0x04, 0xE9, 0x8F, 0x71, 0x5F, 0xA9, 0x69, 0x1C, 0x47, 0xB9, 0x88, 0x66, 0x1F, 0xC7,
-    0xFD, 0x2E, 0x9A, 0x67, 0xE8, 0x8E, 0x55, 0x36, 0x1A, 0x1D, 0x69, 0xD2, 0xFE, 0x9A, 0x06, 0x87,
-    0x5F, 0x9E, 0x35, 0xB5, 0x62, 0x0A, 0xD8, 0xEB, 0xBB, 0x19, 0x93, 0x61, 0xD6, 0xCD, 0x72, 0x9D,
-    0x4C, 0x48, 0xBC, 0xDC, 0xC9, 0x75, 0xE4, 0xC8, 0xD6, 0xEA, 0x20, 0x1A, 0xA3, 0x9B, 0xA3, 0x91,
-    0xF8, 0x0F, 0x46, 0x5C, 0xFF, 0x5F, 0x4A, 0xDB, 0xA4, 0xE6, 0x60, 0x44, 0x24, 0x6C, 0xA9, 0x73,
-    0x89, 0xF0, 0x46, 0x2B, 0xA8, 0x22, 0x94, 0xB6, 0xD4, 0x9A, 0xA0, 0xEB, 0x26, 0x2F, 0x84, 0x08,
-    0x1E, 0x9D, 0x3F, 0x9A, 0x4E, 0x77, 0xB3, 0x36, 0x95, 0xC4, 0x0D, 0x52, 0x44, 0x40, 0xA5, 0xEF,
-    0x89, 0xA5, 0xEC, 0x95, 0x6C, 0x8D, 0x4E, 0x44, 0x8F, 0xA4, 0xFD, 0x8C, 0x74, 0x7F, 0x84, 0x2B,
-    0x79, 0x0A, 0xEE, 0x1B, 0x29, 0x84, 0xAB, 0x14, 0x96, 0x05, 0xAE, 0x6B, 0x9C, 0x0A, 0xDC, 0xD5,
-    0x05, 0x7E, 0x2D, 0x1A, 0x64, 0x07, 0x19, 0xB5, 0x91, 0x84, 0x2A, 0xAE, 0x00, 0xE3, 0x4E, 0xC9,
-    0x9D, 0x69, 0x1D, 0x74, 0x54, 0x72, 0xF5, 0xE7, 0x3C, 0xD6, 0x36, 0x9D, 0x08, 0x54, 0x30, 0xEB,
-    0xC3, 0xB2, 0x3B, 0xEF, 0x07, 0xE3, 0x49, 0xD7, 0x49, 0xA8, 0x09, 0x68, 0xC4, 0x97, 0x20, 0xBC,
-    0xDC, 0x62, 0xEA, 0xBC, 0xEC, 0xE8, 0x81, 0x33, 0x6C, 0x78, 0xF3, 0x95, 0x86, 0xF0, 0x15, 0xB7,
-    0x1F, 0x27, 0xA1, 0x9A, 0xBA, 0x27, 0xA9, 0x6D, 0x2D, 0xA1, 0xB1, 0xE1, 0x4A, 0x6F, 0xC8, 0xA8,
-    0x7A, 0xF7, 0x30, 0x90, 0xA1, 0x0C, 0x93, 0xE5, 0xBB, 0xA3, 0x9D, 0xF4, 0x5E, 0xA3, 0x77, 0x1B,
-    0x2F, 0xEA, 0x18, 0x62, 0x83, 0xBF, 0x4D, 0xB6, 0x4D, 0xE8, 0x95, 0x6D, 0xAD, 0xE7, 0x36, 0xBD,
-    0x8F, 0x86, 0xAB, 0x99, 0x44, 0x73, 0x3D, 0xE9, 0x90, 0x0C, 0x8B, 0x49, 0x47, 0x7B, 0xF3, 0x8C,
-    0x88, 0xAE, 0x0D, 0x98, 0x7A, 0x15, 0x7F, 0x07, 0xD4, 0x3D, 0x5F, 0x34, 0x20, 0x96, 0x31, 0x97,
-    0xAB, 0x1E, 0x8A, 0xAA, 0xA8, 0xD2, 0x8E, 0x83, 0x24, 0xA4, 0xF5, 0x29, 0x9E, 0x53, 0x0D, 0xBA,
-    0x72, 0x0E, 0xB1, 0x6A, 0x0C, 0xDD, 0xCB, 0xC6, 0x90, 0xD7, 0x46, 0xEB, 0x54, 0x74, 0x2D, 0x71,
-    0xF5, 0x4F, 0x58, 0x99, 0xBE, 0xA1, 0x35, 0xBF, 0x2B, 0xC2, 0xD4, 0xA5, 0x7C, 0x83, 0x94, 0x06,
-    0x91, 0x6E, 0x2A, 0x2D, 0xBC, 0x97, 0x50, 0x5A, 0x14, 0xCB, 0x25, 0x09, 0x1C, 0x12, 0x03, 0x43,
-    0x83, 0x5F, 0x58, 0xA9, 0xFB, 0x4B, 0xC6, 0x7E, 0xED, 0x3E, 0xDF, 0x6E, 0x26, 0xB5, 0x32, 0x6A,
-    0x3B, 0x0E, 0xDB, 0x9B, 0xE4, 0x0D, 0xDC, 0x12, 0xEF, 0x3F, 0x09, 0xA7, 0x4E, 0xB2, 0x93, 0x6D,
-    0x0C, 0xB5, 0x56, 0x7E, 0x9F, 0x50, 0x15, 0x9F, 0x35, 0xB7, 0xE8, 0x7E, 0xB0, 0xE8, 0xBB, 0xBF,
-    0x65, 0x0D, 0x74, 0x30, 0x4E, 0x4E, 0xA4, 0x29, 0x4D, 0x5E, 0xD3, 0xF0, 0x26, 0x9E, 0x56, 0xA1,
-    0x60, 0x94, 0xF2, 0x73, 0x58, 0x8B, 0xF8, 0x3E, 0x01, 0xAF, 0x4B, 0x92, 0xF2, 0x1C, 0x3D, 0x01,
-    0x9E, 0x69, 0xD8, 0x79, 0x5F, 0xC7, 0x82, 0x47, 0x75, 0x3D, 0x83, 0xF3, 0x77, 0x3C, 0x4E, 0x61,
-    0x50, 0xCD, 0x91, 0x71, 0x7D, 0x14, 0xE5, 0xD3, 0xA7, 0x2A, 0x97, 0x79, 0x1C, 0x91, 0x14, 0x66,
-    0x34, 0x9E, 0x91, 0x1C, 0xEE, 0x42, 0x2B, 0x82, 0x33, 0xF5, 0x8A, 0x5A, 0x50, 0xEB, 0x3B, 0xB5,
-    0x18, 0x93, 0x88, 0xD6, 0xD5, 0x5C, 0x1F, 0x55, 0xF7, 0x58, 0x73, 0xFC, 0x0A, 0xF9, 0xE2, 0x94,
-    0xF6, 0xE5, 0xEB, 0x73, 0xE8, 0x1C, 0x74, 0x43, 0xD7, 0x2D, 0x4A, 0x57, 0x95, 0x99, 0xF7, 0x81,
-    0x8D, 0x9C, 0x5A, 0xEA, 0x2D, 0xB4, 0x85, 0x4A, 0x74, 0x9D, 0x9F, 0xE6, 0xC2, 0xDB, 0x5A, 0xD5,
-    0x83, 0xC1, 0xB7, 0xEF, 0x55, 0xCA, 0xF5, 0x4A, 0xBD, 0x51, 0x3F, 0xF3, 0x3A, 0x7A, 0x7C, 0x2B,
-    0xAD, 0x1F, 0xFD, 0x24, 0x52, 0x22, 0x2C, 0xA4, 0x99, 0x6B, 0x6B, 0x85, 0xCD, 0x72, 0xA5, 0x51,
-    0x6F, 0xD3, 0xC4, 0x2E, 0x4D, 0xD4, 0x53, 0xEB, 0x6E, 0x52, 0x28, 0x94, 0x37, 0x2B, 0xE5, 0xC6,
-    0xEB, 0x65, 0xD1, 0x4E, 0xA4, 0xC1, 0x69, 0xD3, 0x43, 0xCD, 0x56, 0x8B, 0xE9, 0x8A, 0x71, 0x67,
-    0x19, 0xBA, 0xB3, 0x9A, 0x73, 0x85, 0x36, 0xDD, 0x8C, 0x76, 0xEE, 0xD5, 0xCA, 0xBB, 0xD7, 0xEB,
-    0xBB, 0xF5, 0x7A, 0xBB, 0x5E, 0x88, 0xA2, 0xED, 0x87, 0x5F, 0x94, 0xCB, 0xE5, 0x4A, 0x85, 0x22,
-    0x35, 0xEA, 0x64, 0xD3, 0xC6, 0xED, 0x61, 0x99, 0x7A, 0x40, 0x03, 0x75, 0x0A, 0xB6, 0x41, 0x62,
-    0x7C, 0x40, 0x5F, 0xFA, 0xFB, 0x08, 0x1A, 0x49, 0x14, 0xDB, 0xF5, 0x4E, 0xF2, 0xA1, 0xFC, 0x08,
-    0x9F, 0x50, 0xDF, 0x28, 0x14, 0xB6, 0x2A, 0xF6, 0x91, 0x25, 0x1C, 0x59, 0x4E, 0x3A, 0x9D, 0x7F,
-    0x00, 0xD5, 0x7D, 0x4F, 0x8C, 0x1C, 0x55, 0x9A, 0xE7, 0x8B, 0x08, 0xAA, 0x02, 0x88, 0x43, 0x78,
-    0x24, 0x7B, 0x9A, 0xC5, 0x9A, 0x8E, 0x3E, 0xB4, 0xB4, 0x34, 0x4B, 0x3B, 0xF6, 0xB0, 0x87, 0x1E,
-    0xC9, 0x99, 0x11, 0x86, 0x03, 0x07, 0x0E, 0xED, 0x96, 0x5C, 0x20, 0x35, 0xD2, 0x98, 0xC3, 0x1C,
-    0x68, 0x76, 0xB6, 0x6B, 0x0E, 0xBD, 0x12, 0x87, 0xCC, 0xCA, 0xA0, 0x91, 0xB6, 0x0F, 0x7D, 0xA0,
-    0x56, 0xEA, 0xDE, 0x3D, 0xEC, 0x01, 0x1F, 0x7C, 0x80, 0x42, 0x1A, 0xF7, 0x81, 0x83, 0xA7, 0x27,
-    0xAB, 0x32, 0x00, 0x69, 0x39, 0x70, 0xE8, 0x00, 0x96, 0xE9, 0xC3, 0x1C, 0x08, 0x06, 0x5B, 0xB3,
-    0xDB, 0xAD, 0x95, 0x03, 0x08, 0xAF, 0xA3, 0x70, 0x64, 0xC6, 0xFE, 0x7E, 0xDF, 0x17, 0x91, 0x7F,
-    0xCA, 0x65, 0x37, 0x2C, 0x36, 0x66, 0x0B, 0x32, 0xB2, 0xEC, 0xAA, 0x7C, 0xEF, 0xFB, 0xDE, 0xFB,
-    0xFE, 0xFC, 0xBE, 0x3F, 0xEF, 0xD9, 0x98, 0x33, 0xC6, 0x98, 0x21, 0x5E, 0x21, 0x5E, 0x7E, 0x6C,
-    0x8C, 0x93, 0xE2, 0x1B, 0xBC, 0xF3, 0xAF, 0x9A, 0x99, 0x89, 0xF0, 0xEA, 0x6F, 0x9C, 0x91, 0x5F,
-    0x19, 0xB7, 0xAF, 0x0A, 0xAF, 0xD2, 0x18, 0xAB, 0x30, 0xC6, 0x6E, 0x9A, 0xCC, 0x69, 0x9A, 0xD4,
-    0xB9, 0xBC, 0x11, 0x3B, 0x99, 0x31, 0x2E, 0x3E, 0xED, 0xE1, 0xE5, 0xF3, 0x95, 0x18, 0x13, 0x60,
-    0xA4, 0x60, 0x63, 0x03, 0x43, 0x35, 0x32, 0x94, 0x7E, 0x95, 0x27, 0xF1, 0xC2, 0x48, 0xC5, 0xF3,
-    0xA6, 0xFB, 0xBA, 0x03, 0x73, 0xE1, 0xBD, 0x8C, 0xF0, 0x3A, 0x36, 0xDA, 0x38, 0x2D, 0xEC, 0xF5,
-    0xF1, 0xEA, 0xE1, 0x35, 0x68, 0xC7, 0x9E, 0xEE, 0x18, 0xD3, 0x34, 0xB9, 0x69, 0x5E, 0xAB, 0x30,
-    0xFE, 0xD4, 0x2E, 0x4C, 0xDF, 0xC9, 0x4D, 0xC4, 0x97, 0x9B, 0x99, 0x3E, 0xC6, 0x1F, 0x62, 0xFC,
-    0xDA, 0x4F, 0x9C, 0xCA, 0x7F, 0xB4, 0xC9, 0x83, 0x47, 0x1B, 0xCC, 0x72, 0x84, 0xD4, 0x1E, 0xC3,
-    0x6B, 0x17, 0x54, 0x81, 0x32, 0x52, 0xE2, 0xE3, 0x8F, 0xF7, 0x74, 0x7C, 0x4C, 0x31, 0xF9, 0xF4,
-    0x96, 0x7C, 0xE0, 0xE5, 0xF0, 0x95, 0xEB, 0xA7, 0x0F, 0xE5, 0xA3, 0xDD, 0x91, 0xFE, 0x7C, 0x81,
-    0xCC, 0x64, 0x16, 0x1B, 0x0F, 0xEC, 0x9B, 0xE8, 0xD2, 0xF1, 0xD8, 0x70, 0x29, 0x6D, 0x0E, 0xCA,
-    0x91, 0xE4, 0xE3, 0xF2, 0x79, 0xF9, 0x30, 0x39, 0xC7, 0xAF, 0xC9, 0x63, 0x63, 0x23, 0xD6, 0x41,
-    0xE4, 0x11, 0xCD, 0x1F, 0x61, 0xDC, 0x7D, 0xC2, 0xAB, 0xAC, 0x6D, 0x59, 0x5B, 0x63, 0x46, 0x64,
-    0xD0, 0x9C, 0x6E, 0x27, 0x74, 0x9B, 0x4B, 0x18, 0xA4, 0x36, 0xB3, 0x53, 0xAF, 0x5B, 0x55, 0x4B,
-    0x72, 0xFB, 0xB2, 0x4B, 0x2E, 0x1F, 0x5E, 0x23, 0x8C, 0x10, 0xE0, 0x0F, 0x36, 0xE9, 0x19, 0x91,
-    0xF0, 0x96, 0x91, 0x8E, 0xA1, 0x30, 0xF9, 0x99, 0x35, 0xC1, 0xC0, 0x35, 0x88, 0xCA, 0x75, 0xEC,
-    0x50, 0x88, 0xE9, 0x8B, 0xD8, 0x8D, 0xE5, 0xFF, 0x8A, 0x6B, 0x83, 0xC5, 0xC4, 0xCA, 0x60, 0x74,
-    0xAC, 0x0B, 0x96, 0x05, 0xAB, 0x82, 0x31, 0x30, 0x04, 0x96, 0x04, 0x4C, 0x85, 0xDD, 0xE7, 0xF8,
-    0x35, 0xB8, 0x68, 0xC6, 0x95, 0x79, 0xBE, 0xE8, 0x64, 0xE7, 0x2B, 0x0E, 0x38, 0xDF, 0x80, 0x64,
-    0xB1, 0x01, 0xE1, 0xD2, 0x06, 0xF4, 0x5A, 0x15, 0xE1, 0x3E, 0xD6, 0x37, 0xDF, 0x4B, 0x37, 0x5B,
-    0x1D, 0x8A, 0xC3, 0x8C, 0xF0, 0x3F, 0xD6, 0x69, 0x82, 0x5F, 0xFF, 0x57, 0xA2, 0x54, 0x3E, 0x77,
-    0x05, 0x3F, 0xD3, 0xB7, 0x70, 0xE3, 0x6C, 0x22, 0x93, 0x50, 0xF3, 0x30, 0x4F, 0x20, 0xDC, 0xC9,
-    0xC4, 0x98, 0x4D, 0x36, 0xAA, 0x52, 0x1A, 0x4B, 0x33, 0x7A, 0x55, 0xA6, 0x1B, 0x61, 0x19, 0x31,
-    0xDB, 0xDE, 0x85, 0x8A, 0x4C, 0xD5, 0xF8, 0x0F, 0x73, 0x56, 0xA0, 0xCF, 0x4B, 0xC1, 0x30, 0x46,
-    0x4A, 0xF0, 0x4B, 0x3D, 0x0C, 0x88, 0xB7, 0x21, 0x46, 0xC2, 0xEF, 0xD6, 0xF8, 0x6B, 0x27, 0xB3,
-    0xAB, 0x3F, 0xC3, 0xEF, 0x66, 0x67, 0x8B, 0xA8, 0x14, 0x39, 0x8A, 0x32, 0x10, 0xB3, 0xBF, 0x50,
-    0x40, 0x63, 0x2E, 0x2A, 0xBF, 0x95, 0xBE, 0x95, 0xC2, 0x35, 0x99, 0x04, 0x29, 0xB6, 0xBE, 0x89,
-    0xB0, 0x55, 0xC2, 0x2D, 0x7E, 0x4E, 0xE1, 0xB5, 0xF6, 0x37, 0x9E, 0xBE, 0x1C, 0x53, 0x7E, 0x9A,
-    0x06, 0x3F, 0xE0, 0x5B, 0xC3, 0x9F, 0xFB, 0x49, 0x98, 0xE2, 0xE7, 0x41, 0xEC, 0xA5, 0xA0, 0x2F,
-    0xC0, 0xC4, 0x58, 0x96, 0x10, 0x6F, 0xD8, 0x80, 0x3E, 0x68, 0xC5, 0x02, 0x81, 0xC8, 0x14, 0x6B,
-    0x04, 0x22, 0x63, 0xF0, 0xBD, 0xBB, 0x3E, 0x23, 0x0D, 0x1C, 0xA5, 0xCF, 0xB7, 0x44, 0xF4, 0x97,
-    0x52, 0x5C, 0x1A, 0xD1, 0x60, 0x5D, 0x15, 0x59, 0x8C, 0x9E, 0x69, 0xB5, 0x58, 0xB6, 0x04, 0x7A,
-    0x1C, 0xF3, 0x13, 0x20, 0xB8, 0x79, 0xAD, 0x26, 0xC5, 0x7B, 0xA4, 0x37, 0x22, 0x19, 0xF2, 0xE8,
-    0x73, 0x6B, 0x7A, 0x5C, 0xA7, 0x01, 0x37, 0x67, 0xCC, 0xDD, 0xA9, 0xB9, 0xE4, 0x15, 0xF7, 0x88,
-    0x7C, 0x1A, 0x6B, 0xAE, 0x0E, 0xB2, 0xE8, 0x5C, 0x09, 0x8B, 0x4C, 0xB6, 0x96, 0x90, 0x93, 0xCB,
-    0xEA, 0xBA, 0xB9, 0x2C, 0x31, 0x88, 0x8E, 0x38, 0x39, 0xA4, 0x61, 0xCC, 0x35, 0xA9, 0x3C, 0x2C,
-    0x45, 0x09, 0x9D, 0xB2, 0xCA, 0x2D, 0x1A, 0x2A, 0xAA, 0x4B, 0x43, 0xB1, 0xB8, 0xCC, 0xEF, 0xB2,
-    0x31, 0x05, 0xA3, 0x47, 0xC9, 0x88, 0x28, 0x1A, 0x98, 0xD4, 0x4F, 0x44, 0x0A, 0x65, 0x4D, 0x40,
-    0x61, 0xC8, 0x95, 0xED, 0x8B, 0x3D, 0x51, 0x52, 0x74, 0x89, 0x75, 0xF5, 0x8D, 0x79, 0x5D, 0x9E,
-    0x27, 0xE5, 0x79, 0xCF, 0xF2, 0x8E, 0x45, 0xB2, 0x20, 0x0D, 0x9F, 0xD4, 0xC0, 0xA1, 0x71, 0xA7,
-    0x24, 0xCB, 0xDF, 0xE5, 0xB3, 0x3F, 0xE0, 0x5E, 0x8D, 0x31, 0x79, 0x69, 0x15, 0x15, 0x06, 0x77,
-    0x32, 0x6A, 0x84, 0xFF, 0x02, 0x95, 0x22, 0xA4, 0x6A, 0xE4, 0x03, 0x6A, 0x47, 0x56, 0x62, 0x32,
-    0xF7, 0xAD, 0x1C, 0x8B, 0xE4, 0xBD, 0xC3, 0xDD, 0xF2, 0x5F, 0x16, 0x4D, 0xD9, 0x15, 0x4D, 0xA9,
-    0xB8, 0x50, 0x61, 0x21, 0x2A, 0x93, 0xCA, 0x9C, 0xB1, 0xAC, 0x91, 0x93, 0xF9, 0xA4, 0x12, 0x7F,
-    0x61, 0xCD, 0xA8, 0x14, 0xA3, 0x7C, 0x61, 0xAA, 0x48, 0xBD, 0x55, 0x8A, 0xF2, 0x81, 0x03, 0xAC,
-    0x4D, 0xC9, 0xB5, 0xAD, 0xF8, 0xE9, 0x31, 0x09, 0x1E, 0x70, 0xE1, 0x7A, 0xE4, 0xB6, 0xCF, 0xD5,
-    0x0B, 0xA9, 0x35, 0x81, 0x68, 0xDF, 0x26, 0xB7, 0x61, 0x97, 0x3A, 0x59, 0x77, 0xB6, 0xCD, 0xCD,
-    0xE7, 0x5B, 0x13, 0x73, 0x32, 0x7C, 0xC3, 0xF5, 0x35, 0x34, 0x58, 0xE6, 0x68, 0xB7, 0x12, 0x3D,
-    0x1D, 0xB7, 0xCF, 0x19, 0x86, 0xC2, 0xB7, 0x3E, 0x30, 0x49, 0x45, 0x69, 0x20, 0xE7, 0x16, 0x59,
-    0x26, 0x55, 0x19, 0x06, 0x76, 0x53, 0x10, 0xE9, 0x51, 0x46, 0x7D, 0xE1, 0x39, 0x21, 0xCB, 0xB1,
-    0x4F, 0x59, 0x05, 0x25, 0x21, 0xF9, 0x8D, 0xE8, 0x4E, 0xB6, 0x28, 0x87, 0xB4, 0xE9, 0x30, 0x61,
-    0xA2, 0xDE, 0xFA, 0x50, 0x8B, 0x4B, 0xE5, 0xBD, 0x5F, 0x48, 0x90, 0xAD, 0x73, 0x2A, 0xB1, 0xA7,
-    0xFC, 0x09, 0x05, 0x33, 0xA4, 0x88, 0xF6, 0xF8, 0xA8, 0x4F, 0xF2, 0x37, 0x7A, 0xE4, 0xA8, 0x47,
-    0x43, 0xD1, 0xE7, 0x67, 0xFB, 0x34, 0xF3, 0x5C, 0x50, 0x68, 0x8C, 0x99, 0xF0, 0x31, 0xDB, 0xB9,
-    0x40, 0x5A, 0x83, 0x98, 0x0A, 0x14, 0x8B, 0xA9, 0x0A, 0x12, 0x3C, 0x28, 0x35, 0xE9, 0x50, 0x26,
-    0x05, 0x31, 0xB1, 0x7E, 0xA2, 0x0F, 0x57, 0x27, 0x66, 0x49, 0x95, 0x60, 0x6C, 0x5A, 0xCB, 0x24,
-    0x02, 0x6D, 0x7D, 0xFE, 0x2B, 0x71, 0x98, 0xB1, 0x71, 0x3E, 0x17, 0x83, 0xE1, 0x92, 0x6D, 0x10,
-    0x29, 0xC6, 0xC2, 0xE3, 0xC3, 0x4F, 0xF0, 0x47, 0xB1, 0x16, 0x90, 0xC3, 0x1C, 0xAC, 0x8E, 0x64,
-    0x74, 0xD2, 0x73, 0x89, 0xC4, 0xCF, 0xB6, 0x8D, 0x98, 0x7F, 0xD3, 0x7F, 0xB2, 0xE1, 0x44, 0x61,
-    0xA2, 0x9A, 0x23, 0x8F, 0x56, 0x73, 0x22, 0x48, 0xA8, 0x35, 0xE5, 0x44, 0x39, 0x75, 0x1F, 0xB3,
-    0xE5, 0xC7, 0x39, 0x11, 0x7E, 0xEE, 0x52, 0xD1, 0x30, 0xD1, 0x70, 0xFE, 0x99, 0x1A, 0x9F, 0xB1,
-    0xF9, 0xC1, 0xB3, 0x45, 0xE7, 0xA1, 0xF6, 0xEF, 0x94, 0xC7, 0xB4, 0x1B, 0xD5, 0x41, 0x79, 0x5E,
-    0x7E, 0xB2, 0xE4, 0x67, 0x38, 0x92, 0x97, 0x72, 0x2C, 0x78, 0xF4, 0x82, 0x9F, 0xE0, 0x78, 0xA1,
-    0x8C, 0xD8, 0x97, 0x31, 0x7B, 0x32, 0xEA, 0x40, 0xC6, 0x14, 0x92, 0x95, 0x4F, 0x7C, 0x30, 0x34,
-    0xAA, 0xA6, 0xFC, 0x05, 0xD9, 0x3C, 0xDA, 0xA0, 0x88, 0xBF, 0xBB, 0x36, 0xDB, 0xD8, 0xD8, 0x8D,
-    0x7D, 0xDA, 0xBD, 0x3C, 0xE0, 0x33, 0x0B, 0x45, 0x46, 0xFA, 0x22, 0x24, 0x3D, 0x91, 0x12, 0x79,
-    0xC6, 0xCF, 0xAA, 0xB0, 0xDC, 0x09, 0x54, 0xE5, 0x25, 0x76, 0x6E, 0xB6, 0x54, 0xA6, 0x6B, 0xCA,
-    0x37, 0x25, 0xDC, 0x2E, 0xC4, 0xDA, 0x9A, 0xD2, 0x4D, 0xE9, 0xED, 0xC7, 0x5E, 0x4A, 0xC5, 0x1A,
-    0xF8, 0x2F, 0x88, 0x81, 0xF7, 0x1F, 0xA7, 0x5E, 0x05, 0xC1, 0x0F, 0x53, 0xF5, 0x4A, 0x1D, 0x78,
-    0xC1, 0xD7, 0xD6, 0xD6, 0x16, 0x45, 0xA8, 0xEA, 0x85, 0xA2, 0x83, 0x03, 0xD1, 0xCC, 0x74, 0x4C,
-    0x0A, 0xA2, 0xB8, 0xA2, 0x9B, 0xDB, 0x35, 0x15, 0x27, 0xA8, 0x68, 0x59, 0xA0, 0xA0, 0x78, 0x60,
-    0xA1, 0xB8, 0xB4, 0x63, 0xB5, 0xB8, 0xC3, 0x0E, 0x0C, 0x25, 0x10, 0xEC, 0xD2, 0xFC, 0xE5, 0x3A,
-    0xB5, 0x79, 0xAF, 0xDD, 0x9D, 0x7E, 0xEB, 0x4E, 0xA9, 0x4F, 0x30, 0xD3, 0xF8, 0x9D, 0x08, 0xD3,
-    0x1E, 0xDB, 0x4C, 0x74, 0x83, 0xB9, 0x41, 0xCB, 0x9B, 0xEE, 0xE5, 0x3F, 0x03, 0xCC, 0x18, 0x81,
-    0xC2, 0x90, 0x26, 0xFE, 0xE8, 0x5D, 0xB7, 0x7C, 0xE6, 0xFB, 0x86, 0x76, 0xE9, 0x84, 0xF8, 0xC4,
-    0xE0, 0x8A, 0x98, 0x84, 0x99, 0x59, 0xFD, 0xBA, 0xBB, 0x14, 0x7E, 0x7D, 0xCE, 0xCA, 0xA7, 0xE6,
-    0x13, 0xCD, 0x64, 0x04, 0x33, 0x4F, 0xA7, 0x46, 0x9C, 0xBB, 0x11, 0xDF, 0xBE, 0xA4, 0x49, 0xB1,
-    0x68, 0x92, 0x08, 0x78, 0x28, 0x3B, 0xDB, 0x37, 0xEA, 0x98, 0xA9, 0x7C, 0x43, 0xA3, 0xC6, 0x42,
-    0x7D, 0xB3, 0x5A, 0x17, 0x7E, 0xA4, 0x14, 0x46, 0x0A, 0x59, 0xC0, 0xC2, 0x00, 0xBC, 0x60, 0x5A,
-    0x60, 0x17, 0x7A, 0xF5, 0x4C, 0x94, 0xB6, 0x5D, 0x6A, 0x4C, 0x34, 0x01, 0xDF, 0xA9, 0xB1, 0x68,
-    0xBC, 0xF0, 0x23, 0xBC, 0x8D, 0x80, 0xF7, 0xAE, 0x40, 0xE4, 0x60, 0x47, 0xC1, 0xE3, 0x6F, 0x61,
-    0xDE, 0xC0, 0xD1, 0xD5, 0x42, 0xAC, 0x31, 0xDE, 0xB0, 0xF0, 0x56, 0x01, 0xA7, 0x50, 0x63, 0xE4,
-    0xC2, 0xCE, 0x89, 0x68, 0x4A, 0x27, 0x25, 0xA2, 0x29, 0x3D, 0x6E, 0x41, 0x7A, 0x31, 0xB0, 0xE9,
-    0x22, 0x2E, 0xF6, 0xC5, 0x49, 0x0C, 0x06, 0x82, 0x68, 0x06, 0x25, 0xB6, 0xC1, 0x8F, 0x7B, 0x85,
-    0x20, 0x9A, 0x88, 0x88, 0x06, 0x6F, 0xA9, 0xB8, 0x8B, 0x28, 0xC6, 0x5B, 0xDF, 0x9C, 0xE8, 0xC0,
-    0xE3, 0x09, 0x85, 0xA4, 0x02, 0x4A, 0x87, 0x5C, 0x09, 0x01, 0xA6, 0xE2, 0x94, 0x04, 0x9C, 0x12,
-    0x9E, 0x5A, 0xD4, 0x51, 0x22, 0xA7, 0x82, 0xB8, 0x29, 0x87, 0xB6, 0x3F, 0x95, 0x09, 0x50, 0x15,
-    0xA8, 0x2A, 0x60, 0xD5, 0x4F, 0xBA, 0xD5, 0xC7, 0xB8, 0x01, 0x97, 0x30, 0x54, 0xD8, 0xDA, 0x5F,
-    0xC4, 0x06, 0x16, 0xD5, 0x42, 0x34, 0x38, 0xDA, 0xDE, 0x4C, 0x01, 0xCB, 0xBD, 0x1C, 0xF8, 0xDC,
-    0x29, 0x5C, 0x3A, 0x61, 0x8C, 0x62, 0x95, 0x62, 0xC9, 0x48, 0x58, 0x45, 0x77, 0x5D, 0x46, 0x7C,
-    0xF4, 0xB9, 0x0F, 0xDC, 0x00, 0x79, 0xE4, 0xFD, 0x6E, 0xC3, 0x69, 0x2B, 0x42, 0xEE, 0xDE, 0x9E,
-    0xF1, 0x4A, 0xB7, 0x52, 0xDB, 0x6E, 0x46, 0xB3, 0xB8, 0x45, 0x26, 0x9D, 0x37, 0xA4, 0xC1, 0xDE,
-    0xA8, 0xC9, 0x5B, 0xDD, 0xF9, 0x5A, 0x43, 0x5F, 0x6B, 0x2D, 0x7C, 0x6D, 0x21, 0x72, 0x2C, 0x62,
-    0x4C, 0x29, 0xA6, 0xAF, 0xF5, 0x16, 0xBE, 0x36, 0xA1, 0xAF, 0x8D, 0x3B, 0x5F, 0x1B, 0x92, 0xB7,
-    0xFE, 0x92, 0x27, 0x87, 0x03, 0x8A, 0xE9, 0x80, 0x08, 0x12, 0x9E, 0x9E, 0x72, 0x19, 0x47, 0x5C,
-    0xC1, 0xB0, 0x7D, 0x08, 0x98, 0x50, 0x07, 0x04, 0xC3, 0x87, 0x89, 0x20, 0x1E, 0x57, 0x9F, 0x2E,
-    0x69, 0xF2, 0x29, 0x01, 0xFB, 0x37, 0xB8, 0x69, 0x79, 0x48, 0x74, 0x14, 0xB4, 0x0A, 0xBA, 0x12,
-    0x5D, 0x7D, 0xA9, 0xF0, 0x6A, 0x35, 0x94, 0xFA, 0xF2, 0xE1, 0x15, 0xD7, 0x90, 0x80, 0xE2, 0xD8,
-    0xD3, 0x97, 0xCF, 0xDC, 0xD2, 0x91, 0xF5, 0x6F, 0x12, 0x79, 0x94, 0x37, 0xFA, 0xC4, 0xAF, 0x19,
-    0x72, 0x75, 0x5F, 0xD5, 0x1C, 0xFC, 0x98, 0x3F, 0xA7, 0x37, 0xC7, 0x12, 0x62, 0x84, 0xC9, 0xF5,
-    0xEB, 0x40, 0x05, 0x53, 0x27, 0x1B, 0x41, 0x18, 0xDD, 0x94, 0x7B, 0x4D, 0x81, 0xC6, 0x76, 0x63,
-    0xFF, 0x21, 0x5D, 0x09, 0xFD, 0x23, 0x2D, 0x4A, 0x9F, 0x70, 0x2B, 0xE5, 0xBE, 0x13, 0xE5, 0xF0,
-    0x3D, 0x8C, 0x7B, 0x10, 0x3D, 0x3F, 0x1B, 0xC2, 0x67, 0x38, 0xCD, 0x6C, 0x92, 0x13, 0x1B, 0x51,
-    0x14, 0xD6, 0xA7, 0x71, 0x87, 0x6E, 0x3A, 0x5C, 0x2C, 0x91, 0x6A, 0xC0, 0x25, 0x12, 0x30, 0x2F,
-    0x6E, 0xDD, 0xA5, 0xE2, 0x38, 0x19, 0x56, 0x52, 0xC4, 0x9B, 0xD6, 0xD5, 0x98, 0xEB, 0xFC, 0xFD,
-    0x49, 0xC7, 0x10, 0x25, 0x09, 0xCC, 0x30, 0xD9, 0xF1, 0x47, 0x7A, 0xD6, 0xB7, 0x19, 0xA7, 0x72,
-    0x0D, 0x87, 0x5C, 0xD4, 0x4A, 0x44, 0x57, 0x51, 0xD2, 0xD8, 0x48, 0x80, 0xA2, 0xCA, 0xF6, 0xA7,
-    0x50, 0xA6, 0x75, 0x18, 0xCA, 0xCC, 0xBE, 0x00, 0xCA, 0x0C, 0x81, 0x32, 0x4F, 0x87, 0xB4, 0x03,
-    0x51, 0x23, 0xCB, 0xA7, 0xE8, 0x5F, 0x1F, 0x59, 0x87, 0x38, 0xD7, 0x13, 0x31, 0x3B, 0x62, 0x85,
-    0xF1, 0x88, 0x8C, 0x18, 0x1C, 0x30, 0x2E, 0x61, 0xE3, 0x60, 0x55, 0x33, 0xF0, 0x88, 0x09, 0xEF,
-    0xB2, 0x6F, 0x15, 0xBA, 0x25, 0x56, 0x73, 0x7D, 0x31, 0x5C, 0xB6, 0x22, 0xD3, 0xAA, 0x1E, 0x2B,
-    0x9A, 0x11, 0x1A, 0xE0, 0x09, 0x9A, 0x30, 0x31, 0xD2, 0x8C, 0x1E, 0x31, 0xCB, 0x50, 0x23, 0xA8,
-    0xB1, 0x2E, 0xCC, 0x98, 0x1F, 0xAE, 0x65, 0xD5, 0xF1, 0xC0, 0x54, 0xB1, 0x18, 0xB4, 0x00, 0xCB,
-    0x60, 0x13, 0x2F, 0xD9, 0x85, 0xA3, 0x31, 0x98, 0x0C, 0x41, 0x48, 0xC2, 0x01, 0xB2, 0x36, 0x08,
-    0xF3, 0x14, 0x1D, 0xCA, 0x67, 0xC5, 0xC0, 0x71, 0x80, 0x80, 0x24, 0xC3, 0xC8, 0x6D, 0x3C, 0x79,
-    0x75, 0x63, 0x93, 0x4A, 0xD2, 0x08, 0xBE, 0xC1, 0xD7, 0xEC, 0xE6, 0x24, 0x65, 0xB7, 0x22, 0xC9,
-    0xDC, 0x8A, 0xA4, 0x5C, 0x86, 0xB8, 0x81, 0xA4, 0xB4, 0x23, 0xA9, 0x9A, 0x93, 0x14, 0x2B, 0x49,
-    0x67, 0x94, 0xA4, 0x4A, 0x48, 0x6A, 0x4A, 0xB3, 0x24, 0x89, 0xED, 0x9B, 0x5D, 0x98, 0x45, 0xF0,
-    0x66, 0xEC, 0xED, 0x50, 0xC0, 0x7A, 0x8C, 0x00, 0xF6, 0x26, 0xE9, 0x84, 0xD9, 0xAB, 0x8C, 0x5C,
-    0x53, 0xF3, 0xF9, 0x05, 0xC8, 0x8D, 0x5D, 0xD1, 0x8E, 0x81, 0xC6, 0x31, 0x06, 0x18, 0x33, 0xBA,
-    0x07, 0x68, 0xAD, 0x20, 0x3D, 0x85, 0x9F, 0x6E, 0x66, 0xB0, 0xF0, 0x71, 0x40, 0x68, 0x1E, 0x9A,
-    0x56, 0x06, 0x55, 0xB3, 0x8D, 0x18, 0x61, 0x95, 0x45, 0x10, 0x3B, 0x16, 0x62, 0x2A, 0xA3, 0x41,
-    0x0F, 0x48, 0xB1, 0x66, 0xE7, 0x19, 0xFD, 0xE3, 0xD3, 0x10, 0xC6, 0xCF, 0x27, 0xF0, 0x5A, 0x8C,
-    0x06, 0x28, 0x93, 0xC0, 0x1B, 0x90, 0x29, 0xB8, 0x87, 0x98, 0xB9, 0x03, 0x2A, 0xA2, 0x5D, 0x84,
-    0xA2, 0x45, 0x11, 0x2D, 0x33, 0xA2, 0x94, 0xE0, 0xD4, 0x04, 0xE0, 0x95, 0x88, 0x75, 0x00, 0x3E,
-    0x72, 0x0E, 0x7E, 0x98, 0x69, 0x5A, 0x86, 0xAF, 0x98, 0x8D, 0x73, 0x71, 0x26, 0xCE, 0xC3, 0xA0,
-    0x83, 0x73, 0x70, 0x06, 0x8E, 0xCF, 0xD1, 0xA1, 0xF8, 0x59, 0x70, 0x6A, 0x94, 0x2A, 0x12, 0xEE,
-    0xE2, 0xC6, 0x49, 0x23, 0x69, 0x04, 0xAC, 0xE0, 0x25, 0xB1, 0x44, 0x4C, 0xB0, 0x75, 0xD6, 0xD4,
-    0xCC, 0x6D, 0x77, 0xFB, 0x88, 0x34, 0x50, 0xC1, 0xE3, 0xD8, 0xC6, 0x68, 0x6E, 0x7F, 0x05, 0x76,
-    0xD6, 0x82, 0x5D, 0x3B, 0x53, 0xE6, 0x67, 0xE6, 0xAF, 0xAD, 0x09, 0x61, 0xE8, 0xD4, 0x48, 0xEE,
-    0x64, 0x91, 0xDF, 0x6A, 0x47, 0x9E, 0x54, 0x02, 0x5A, 0x18, 0xBD, 0xC0, 0xFE, 0x64, 0x9B, 0x0C,
-    0x59, 0xF6, 0x88, 0x4C, 0xC7, 0x96, 0x44, 0x8E, 0xC4, 0x4C, 0xD4, 0x6F, 0x1A, 0x45, 0x48, 0x15,
-    0xF5, 0x06, 0x26, 0x82, 0x9A, 0x53, 0xD9, 0x4C, 0x53, 0x00, 0x0A, 0xF3, 0xB3, 0x80, 0x70, 0x97,
-    0x37, 0xB9, 0xEA, 0x0E, 0x03, 0x00, 0x78, 0xDF, 0x54, 0x62, 0x06, 0x8F, 0x6F, 0xC0, 0xE1, 0x82,
-    0xA3, 0x52, 0x91, 0xAB, 0x30, 0xE6, 0xE2, 0x62, 0x0E, 0x04, 0x20, 0x25, 0x58, 0x05, 0xC8, 0xA1,
-    0x8F, 0xA5, 0x85, 0x69, 0x34, 0xDD, 0x20, 0xCF, 0xFB, 0x69, 0x72, 0x27, 0x4C, 0xAA, 0xCC, 0x10,
-    0xBF, 0x78, 0x19, 0x76, 0xB5, 0x8D, 0xD6, 0x9C, 0x42, 0x81, 0x58, 0xC0, 0xE0, 0x20, 0xA0, 0x59,
-    0xF0, 0x73, 0x1A, 0x3D, 0xC9, 0x29, 0x91, 0x24, 0x7B, 0x7F, 0x33, 0x86, 0x11, 0x0F, 0xC4, 0x9D,
-    0x73, 0x0D, 0xFB, 0x5C, 0xCD, 0x1E, 0x97, 0x65, 0xC8, 0x65, 0x69, 0x15, 0x25, 0xA4, 0xD1, 0x34,
-    0xC7, 0xF3, 0xEF, 0x9A, 0xA6, 0xBE, 0xE8, 0xEC, 0xFF, 0xB4, 0xF4, 0x32, 0xAF, 0x08, 0xB0, 0x41,
-    0xA1, 0xA0, 0x02, 0x27, 0xA7, 0x7A, 0x51, 0x27, 0xF8, 0xFB, 0x88, 0xDE, 0x92, 0x1A, 0xE6, 0x73,
-    0x0C, 0xB0, 0xB5, 0x65, 0x5F, 0xC1, 0xE2, 0x9F, 0x35, 0xFE, 0xF4, 0xDB, 0x8B, 0x0C, 0x89, 0x39,
-    0x0E, 0x34, 0x85, 0x55, 0x0E, 0xF6, 0x63, 0x66, 0x02, 0xBB, 0x94, 0x21, 0x6D, 0x97, 0xFF, 0x9F,
-    0xA6, 0xF0, 0x33, 0x4D, 0x12, 0xFC, 0x7D, 0x90, 0x85, 0x10, 0xE7, 0x28, 0xB6, 0x21, 0x62, 0x76,
-    0x31, 0xC4, 0x6B, 0xC0, 0x08, 0x83, 0x70, 0x17, 0x73, 0x01, 0x2F, 0x02, 0x79, 0x06, 0x71, 0x44,
-    0x0F, 0xD0, 0xD0, 0xFE, 0x67, 0xEA, 0x6F, 0x8E, 0x57, 0x64, 0xCC, 0x38, 0xFB, 0x9B, 0xA9, 0x2F,
-    0x7E, 0xC4, 0x05, 0x56, 0xE1, 0xEF, 0x86, 0xF1, 0x08, 0x2B, 0xC4, 0x18, 0xA3, 0x5E, 0xDB, 0x23,
-    0x4B, 0x34, 0xD9, 0x92, 0xF7, 0x8A, 0x00, 0x0B, 0x02, 0x8C, 0xE1, 0x72, 0xCF, 0x39, 0xC6, 0xE6,
-    0x25, 0xFA, 0x13, 0x63, 0x5F, 0x66, 0x9A, 0x52, 0x3C, 0x5F, 0x2C, 0xE2, 0x65, 0x43, 0x30, 0x36,
-    0x01, 0x1C, 0xE0, 0x63, 0xFC, 0x5C, 0x05, 0xAE, 0xD3, 0xD0, 0xC8, 0x3C, 0x84, 0x3D, 0x81, 0x27,
-    0xE8, 0xC6, 0x58, 0x83, 0xEC, 0x50, 0x90, 0x66, 0xDC, 0x77, 0xC2, 0x68, 0xA7, 0x0D, 0x56, 0xC4,
-    0x2D, 0xC1, 0xE8, 0xE6, 0x95, 0xD5, 0xD4, 0x95, 0x5B, 0x06, 0x15, 0xEC, 0x7D, 0x89, 0x75, 0x2C,
-    0xFB, 0xC2, 0xA7, 0x53, 0x8C, 0xC1, 0xE3, 0x58, 0xD6, 0x13, 0xA1, 0x14, 0xD6, 0x12, 0x0A, 0x85,
-    0xFF, 0xB0, 0x5C, 0xA0, 0xDD, 0xED, 0x12, 0xCB, 0xC7, 0xCB, 0x8E, 0x4F, 0xA8, 0x08, 0x83, 0x7F,
-    0x1F, 0x6B, 0x11, 0x9A, 0x3E, 0x5C, 0xB0, 0xF2, 0x99, 0xCC, 0xF5, 0x6D, 0xDC, 0xD1, 0x18, 0x3F,
-    0x84, 0x31, 0xAA, 0x39, 0x9F, 0xD6, 0xBE, 0xB9, 0x3F, 0x5E, 0x07, 0x19, 0xF8, 0x6C, 0x58, 0x99,
-    0xB3, 0x99, 0x6F, 0x66, 0xA7, 0x31, 0x77, 0xA0, 0xA0, 0x21, 0xD4, 0x10, 0x8B, 0xC9, 0x6D, 0xBC,
-    0xF5, 0x28, 0xCD, 0x44, 0xA0, 0x89, 0x04, 0xCB, 0xE2, 0x12, 0xF3, 0x3A, 0x10, 0x97, 0x53, 0x05,
-    0xE2, 0x20, 0x4A, 0xBE, 0x05, 0xA7, 0x0A, 0xAE, 0xD6, 0x96, 0x4D, 0xB9, 0x8F, 0x6A, 0x3B, 0x77,
-    0x61, 0x98, 0x61, 0x3F, 0x81, 0xB8, 0xEF, 0xD1, 0xA4, 0x94, 0x35, 0xD9, 0xC6, 0x32, 0x61, 0xB9,
-    0x7F, 0xBD, 0xD7, 0x6A, 0x6D, 0x6B, 0x28, 0x2C, 0xE8, 0x23, 0x48, 0xB3, 0x48, 0x9E, 0x20, 0xAA,
-    0xF1, 0x3C, 0x03, 0xBF, 0x0D, 0x98, 0x4A, 0xC9, 0x1F, 0x71, 0x5E, 0xAC, 0xAC, 0x9D, 0x98, 0x67,
-    0x99, 0x9F, 0x00, 0x51, 0x25, 0xB3, 0x13, 0x78, 0xC1, 0x56, 0xD8, 0x45, 0x20, 0x79, 0x26, 0x27,
-    0xEB, 0x4B, 0x60, 0x02, 0x38, 0x0E, 0xB2, 0xE0, 0xEF, 0xB0, 0x84, 0xA3, 0xB9, 0x28, 0x06, 0x9D,
-    0x28, 0x7E, 0xCF, 0x9C, 0x33, 0x27, 0x68, 0xF5, 0xFF, 0x1B, 0xD0, 0x66, 0x3B, 0xB0, 0xB9, 0x4D,
-    0x63, 0x9F, 0x37, 0x3F, 0x21, 0xC6, 0xB5, 0x0A, 0x42, 0x5B, 0x1F, 0x76, 0x34, 0x92, 0x78, 0xC9,
-    0x7D, 0x8F, 0x19, 0x55, 0x4E, 0x07, 0x4D, 0x7C, 0x11, 0x91, 0xC2, 0xA3, 0x74, 0x3A, 0x95, 0x08,
-    0x63, 0x24, 0xCE, 0x2A, 0xA4, 0x93, 0xC6, 0x1A, 0xEF, 0xEC, 0x6C, 0xAB, 0xB2, 0xDB, 0x9F, 0xBF,
-    0x96, 0x31, 0x2B, 0x93, 0x6A, 0x62, 0xD4, 0x9B, 0x03, 0x7D, 0xFF, 0x10, 0xA0, 0x3F, 0xA4, 0x40,
-    0x8E, 0xB1, 0x68, 0x36, 0xCD, 0x7B, 0x44, 0xAC, 0x1B, 0x25, 0x8A, 0xBC, 0xF0, 0x05, 0x0F, 0xF2,
-    0x70, 0x42, 0xC0, 0x3A, 0x4A, 0x19, 0x00, 0x35, 0x09, 0xA8, 0xB6, 0xAF, 0xC4, 0xCE, 0x87, 0xC6,
-    0xFD, 0xD0, 0x38, 0xEF, 0xC4, 0x88, 0x18, 0xDD, 0x77, 0x92, 0x00, 0xA0, 0xE1, 0xED, 0xA4, 0x07,
-    0x43, 0xF7, 0x62, 0x7A, 0x11, 0xD1, 0xD9, 0x63, 0x6F, 0x40, 0xEB, 0x7C, 0xE7, 0x7D, 0xC8, 0x64,
-    0x60, 0xFF, 0x3E, 0x05, 0xB1, 0xD6, 0x95, 0xB8, 0x14, 0x49, 0x2B, 0x31, 0x5D, 0x8D, 0x15, 0x3C,
-    0x69, 0xE8, 0x8F, 0xC0, 0xF4, 0x83, 0x86, 0x3F, 0x40, 0xD0, 0xC6, 0x94, 0x32, 0xE4, 0x87, 0xD1,
-    0xD0, 0x18, 0x8E, 0xB7, 0x82, 0xD1, 0x2C, 0xF9, 0xA2, 0x5D, 0xF2, 0x61, 0x96, 0xBA, 0xC5, 0x8C,
-    0x24, 0xFF, 0xC1, 0xEC, 0x07, 0xC4, 0x65, 0xAE, 0xBB, 0x67, 0x53, 0x2E, 0x19, 0xCD, 0x57, 0x24,
-    0xD8, 0x4C, 0xF5, 0x7F, 0xBC, 0xD0, 0x0D, 0xB1, 0x33, 0x43, 0xEA, 0x7F, 0x4C, 0xFD, 0xAF, 0x16,
-    0xFA, 0x7F, 0x6E, 0x33, 0x31, 0x9F, 0x36, 0x85, 0x75, 0xFD, 0x1F, 0x2B, 0xC4, 0xD2, 0xB5, 0x53,
-    0x89, 0x55, 0xAE, 0x61, 0x92, 0x65, 0x43, 0xE1, 0x5C, 0x8A, 0x55, 0x1A, 0xDC, 0x65, 0x1A, 0x12,
-    0xF3, 0x90, 0x07, 0xE9, 0x3B, 0xC9, 0x4C, 0xFC, 0xF0, 0xEA, 0x04, 0x56, 0x35, 0x09, 0x09, 0xF1,
-    0xB1, 0xD2, 0x4C, 0x03, 0x5B, 0x74, 0xF4, 0x36, 0xDD, 0xBC, 0xA0, 0x04, 0xC5, 0x08, 0x0C, 0x51,
-    0xE9, 0x03, 0x8C, 0x57, 0xF0, 0xE7, 0x15, 0xBE, 0x87, 0x05, 0xC3, 0xFE, 0x3E, 0x31, 0x23, 0x4E,
-    0x8A, 0x6F, 0x48, 0x47, 0x0F, 0x57, 0x73, 0xD2, 0xE6, 0xF8, 0x7E, 0xCB, 0xF6, 0x8F, 0xE9, 0x83,
-    0xC4, 0x71, 0x45, 0x87, 0xB8, 0xCD, 0x7A, 0x45, 0x95, 0xBF, 0x03, 0x55, 0x2E, 0x16, 0x26, 0xEB,
-    0x5C, 0x98, 0x1C, 0xCF, 0xCD, 0x27, 0x4D, 0x31, 0xA9, 0xAD, 0x6B, 0xFF, 0xE5, 0xFF, 0x5C, 0xDE,
-    0x85, 0xAD, 0x6A, 0xE2, 0x3E, 0xD8, 0x9F, 0x09, 0x8C, 0xAF, 0x4D, 0x9F, 0xDB, 0x60, 0x7A, 0x5C,
-    0x00, 0x33, 0x90, 0xE4, 0xD6, 0x18, 0x1E, 0x36, 0x37, 0xB5, 0x4F, 0xDF, 0x50, 0x31, 0xEF, 0x8E,
-    0x50, 0x9F, 0xB5, 0x01, 0x2C, 0x3A, 0x7F, 0xCE, 0x84, 0x80, 0x93, 0xB3, 0x3E, 0x80, 0xDF, 0x7A,
-    0xC8, 0x58, 0xE7, 0x40, 0xBD, 0xC0, 0x21, 0x49, 0x6C, 0x09, 0x26, 0x95, 0xCA, 0x48, 0x8F, 0x5C,
-    0x8E, 0xF9, 0x60, 0x70, 0xF9, 0x18, 0x93, 0x66, 0x8F, 0xB3, 0xD2, 0xC5, 0x74, 0x91, 0xF7, 0x12,
-    0xF1, 0xE3, 0xDF, 0xD1, 0x4A, 0x8C, 0xBB, 0xAC, 0xA7, 0x33, 0x87, 0xAD, 0xDE, 0x3C, 0x4E, 0x22,
-    0xBF, 0x7F, 0x26, 0xB9, 0x61, 0x5A, 0xC7, 0x51, 0xB2, 0x70, 0xBB, 0xB7, 0x0C, 0xCB, 0xD6, 0x69,
-    0x8D, 0x46, 0xE2, 0xF8, 0xF6, 0x66, 0x58, 0xBC, 0x01, 0x1D, 0xE6, 0xD8, 0x87, 0xC5, 0xAF, 0x5C,
-    0x88, 0x07, 0x82, 0xF0, 0xB1, 0x55, 0xE0, 0x61, 0xC3, 0xC7, 0xD6, 0xF4, 0xB0, 0x80, 0x4B, 0x7E,
-    0x32, 0xA6, 0xDF, 0x85, 0x59, 0xDB, 0x32, 0xE1, 0x3B, 0xFF, 0xBD, 0xA6, 0x3F, 0xA7, 0xD1, 0x99,
-    0xAD, 0xC4, 0x6C, 0x37, 0xAD, 0x20, 0x9C, 0x37, 0x0F, 0xB7, 0x90, 0xBE, 0x47, 0xBF, 0x15, 0x4A,
-    0x7A, 0x50, 0x82, 0xB2, 0x0B, 0xE4, 0x92, 0x59, 0x31, 0xA7, 0x9C, 0x43, 0x0A, 0xF2, 0x1B, 0xC9,
-    0x06, 0xF6, 0x58, 0x0A, 0x53, 0x07, 0x0F, 0xAD, 0x4D, 0x04, 0x96, 0x63, 0xC5, 0x57, 0x8C, 0x4D,
-    0x7A, 0x73, 0x63, 0x33, 0x5C, 0x35, 0x36, 0x49, 0xD4, 0xBC, 0x54, 0x06, 0x53, 0xAF, 0x34, 0xF1,
-    0x3C, 0x01, 0xD6, 0x46, 0x77, 0x06, 0x4A, 0x68, 0x6F, 0x47, 0x92, 0x3A, 0xEE, 0x3E, 0x07, 0x9E,
-    0xE1, 0xFF, 0xC6, 0x88, 0x66, 0xC6, 0x50, 0xFC, 0xD1, 0x05, 0x18, 0xAB, 0x59, 0xDF, 0xAC, 0x6F,
-    0x2F, 0x97, 0x38, 0x2B, 0x7D, 0xB1, 0x14, 0x96, 0x80, 0xCB, 0xEF, 0x11, 0x8A, 0x75, 0xE2, 0xE2,
-    0x2F, 0xC4, 0xA5, 0x9A, 0x8B, 0x0B, 0x7E, 0x1E, 0x76, 0x82, 0x92, 0x3A, 0xAD, 0xB8, 0xB0, 0x44,
-    0xE3, 0xC1, 0x3B, 0x47, 0x31, 0xE7, 0x9D, 0xC4, 0x51, 0xBA, 0xE5, 0x7C, 0x98, 0x5C, 0x4F, 0xA3,
-    0xE6, 0x89, 0x06, 0xA6, 0xA5, 0x76, 0x66, 0x60, 0x3F, 0xA6, 0x07, 0xBB, 0x53, 0xB3, 0xBC, 0x5D,
-    0x73, 0x16, 0xA7, 0x96, 0x59, 0xEA, 0x45, 0xE4, 0xB9, 0x12, 0x0E, 0x9A, 0x87, 0x77, 0x98, 0xA9,
-    0x30, 0xE6, 0xB9, 0xDD, 0xA5, 0x25, 0x10, 0x98, 0x0D, 0xE7, 0x0E, 0x81, 0xB0, 0xF6, 0x1F, 0x67,
-    0x88, 0x5C, 0x93, 0xA2, 0xF6, 0xBD, 0xB2, 0x98, 0xC9, 0x64, 0x78, 0x1E, 0xAA, 0xB3, 0xB0, 0xB7,
-    0xE1, 0x43, 0xB8, 0xE4, 0x3D, 0xBA, 0xC8, 0x01, 0x25, 0x75, 0x4C, 0x21, 0xAD, 0x25, 0x89, 0x15,
-    0x40, 0xAA, 0xCA, 0xB0, 0x81, 0x79, 0x0C, 0x7F, 0x34, 0x21, 0xF9, 0x21, 0x53, 0x27, 0xC1, 0x63,
-    0x7C, 0x70, 0x5F, 0x23, 0xE6, 0x5A, 0xF7, 0x60, 0xCE, 0x1B, 0x96, 0x8D, 0x9B, 0x1C, 0x1F, 0x3A,
-    0xAA, 0xDE, 0xE7, 0x86, 0x24, 0x2E, 0xC7, 0x0B, 0x10, 0xDE, 0x4A, 0xFE, 0xFB, 0x47, 0x13, 0xC3,
-    0x80, 0x98, 0x7A, 0x49, 0x00, 0xD4, 0x3F, 0x04, 0xC0, 0xA8, 0x87, 0x85, 0xA3, 0xFF, 0xF5, 0xB4,
-    0xD5, 0xAD, 0xA0, 0x8D, 0xDB, 0xB0, 0xAC, 0x44, 0xDC, 0xE2, 0xBE, 0x43, 0xB3, 0xB0, 0x33, 0xB5,
-    0x39, 0xE2, 0xB0, 0x82, 0x96, 0x49, 0x0C, 0xD2, 0x7A, 0xB0, 0xE3, 0x97, 0xB8, 0x68, 0x50, 0x0C,
-    0x78, 0xB1, 0xAB, 0xA3, 0x98, 0x7E, 0x8C, 0x5B, 0x44, 0x48, 0xA5, 0xFE, 0x8C, 0x1B, 0xE1, 0x64,
-    0x2E, 0x67, 0xCE, 0xE8, 0xD1, 0x19, 0x12, 0x69, 0xAC, 0xC6, 0x94, 0xB8, 0x1F, 0x8F, 0xC5, 0x3D,
-    0x11, 0xBE, 0x90, 0x46, 0xD6, 0x16, 0x09, 0x61, 0x7A, 0x0A, 0x62, 0x14, 0xC6, 0x58, 0x3B, 0xAF,
-    0x68, 0xE5, 0x78, 0xA7, 0x82, 0x5D, 0xAD, 0xB0, 0xF5, 0x25, 0xE2, 0x10, 0xF1, 0x9A, 0xD6, 0x14,
-    0x7F, 0x9A, 0xC8, 0x72, 0xA7, 0x66, 0x0B, 0x6B, 0x52, 0x4B, 0x7C, 0x93, 0x80, 0x8A, 0x98, 0x75,
-    0xC0, 0x3D, 0x72, 0xB0, 0xD6, 0x86, 0xA6, 0x52, 0x60, 0x2C, 0xDA, 0x02, 0xD8, 0x91, 0x16, 0x65,
-    0x7E, 0x75, 0x88, 0x24, 0x5F, 0x27, 0x30, 0x77, 0x1F, 0x93, 0x3C, 0xE2, 0xCE, 0x01, 0xEC, 0x6D,
-    0x1B, 0xBB, 0x85, 0x3E, 0xF6, 0x64, 0x07, 0x7F, 0xDF, 0x18, 0x6B, 0x77, 0xA3, 0xD5, 0x46, 0x30,
-    0x56, 0x4E, 0x72, 0xEB, 0x5A, 0x83, 0xD0, 0x21, 0xA9, 0x9D, 0x29, 0xDC, 0x58, 0x29, 0xAE, 0x4C,
-    0xDD, 0x29, 0x4C, 0x86, 0x9A, 0x0B, 0xBA, 0xB2, 0x55, 0x73, 0xD1, 0xBF, 0x21, 0x4F, 0x84, 0x49,
-    0xEE, 0x01, 0xD6, 0x0A, 0xA0, 0x0D, 0x01, 0xED, 0xEE, 0x1A, 0xE5, 0x29, 0xD1, 0x9D, 0x27, 0xD4,
-    0xE3, 0xDA, 0xB5, 0xF4, 0xDC, 0x0E, 0xE8, 0x7B, 0x0B, 0x7F, 0x36, 0x82, 0xCF, 0x9A, 0x68, 0x74,
-    0x78, 0x60, 0x6D, 0x0E, 0xF8, 0x33, 0xD0, 0x01, 0xB0, 0x69, 0xBC, 0xAB, 0x3F, 0x5D, 0x68, 0x01,
-    0xDE, 0xDD, 0x79, 0x03, 0x01, 0x55, 0xA4, 0x68, 0xF3, 0x49, 0x1A, 0x50, 0x6E, 0x8B, 0x76, 0x2A,
-    0x46, 0x94, 0xFC, 0xE3, 0x3D, 0x82, 0x9B, 0x1F, 0x32, 0x6A, 0xB6, 0x4B, 0xE6, 0xBC, 0x10, 0x73,
-    0x01, 0x8B, 0x32, 0xF1, 0x23, 0x11, 0x56, 0xCC, 0xAA, 0x5A, 0x9F, 0x9C, 0x9C, 0x8A, 0xED, 0xCF,
-    0x52, 0xE7, 0x5F, 0x52, 0xEB, 0xE7, 0xDD, 0x1E, 0x9F, 0x97, 0xC6, 0x80, 0x42, 0x1A, 0x03, 0xB4,
-    0x2B, 0x80, 0x39, 0x49, 0x49, 0xA9, 0x13, 0x7B, 0x29, 0xEE, 0x6A, 0x53, 0xF7, 0xBD, 0xB6, 0xDC,
-    0x8A, 0x6F, 0xB7, 0x4C, 0x3B, 0xE3, 0xA1, 0x43, 0xA4, 0x87, 0x0C, 0xD1, 0xEF, 0x86, 0x18, 0x2C,
-    0x1A, 0x12, 0x9E, 0x2A, 0x98, 0x41, 0x9B, 0x90, 0x16, 0x02, 0x41, 0x66, 0x6E, 0x25, 0xA3, 0x66,
-    0x7F, 0x7E, 0x21, 0x35, 0x1A, 0x2C, 0x1A, 0x0D, 0x16, 0xC5, 0x45, 0x4A, 0x4A, 0x06, 0x52, 0x78,
-    0x61, 0x9B, 0x1B, 0x16, 0xB2, 0x14, 0x17, 0x88, 0xA5, 0x10, 0xF6, 0x5A, 0x70, 0x28, 0xF9, 0x29,
-    0xC9, 0x00, 0x31, 0x19, 0x10, 0x11, 0x22, 0xC2, 0x00, 0x11, 0x24, 0x32, 0x80, 0x02, 0x4C, 0x74,
-    0xDA, 0x00, 0xFB, 0xA8, 0x90, 0xFE, 0x90, 0x2C, 0xEA, 0x40, 0xD4, 0x6A, 0x2C, 0x2E, 0xA6, 0x12,
-    0x27, 0x23, 0x99, 0x7F, 0x2E, 0xBB, 0x7B, 0xF9, 0xC9, 0xFD, 0x33, 0xF4, 0x9E, 0xB0, 0x26, 0xDE,
-    0x1F, 0x5E, 0x43, 0x14, 0x0F, 0x3B, 0x96, 0x39, 0x84, 0x56, 0x99, 0x48, 0x64, 0xC6, 0x1C, 0x01,
-    0xAD, 0x04, 0x41, 0x92, 0x07, 0xD9, 0x04, 0x13, 0x2C, 0x70, 0x8D, 0xA6, 0xF3, 0x3A, 0xFA, 0xAD,
-    0x34, 0xE0, 0xC1, 0xC4, 0x94, 0x4D, 0x69, 0x5D, 0xFB, 0x63, 0x6D, 0x37, 0x30, 0xC2, 0xB5, 0x61,
-    0x99, 0x63, 0x01, 0x28, 0xA9, 0x01, 0x2D, 0x3A, 0xF7, 0x0F, 0x71, 0x98, 0x18, 0xE1, 0x8C, 0x46,
-    0xF7, 0x74, 0x8C, 0x5C, 0xA7, 0x13, 0x8B, 0x8C, 0xE4, 0x57, 0x45, 0xE7, 0x56, 0xAC, 0xC3, 0x8A,
-    0xC5, 0xB9, 0xD8, 0x16, 0xDC, 0xEF, 0xB9, 0x7D, 0xD1, 0x83, 0x39, 0xB7, 0x0E, 0x82, 0x0B, 0x52,
-    0x3D, 0x65, 0xCE, 0x22, 0xAA, 0x97, 0x16, 0xEC, 0x2E, 0x60, 0xB1, 0xDB, 0xC2, 0xD4, 0xDF, 0xDC,
-    0xD8, 0x13, 0x13, 0xA8, 0xC4, 0x87, 0xF2, 0x83, 0x2A, 0xE2, 0x9B, 0xD4, 0x1C, 0x98, 0x4D, 0x89,
-    0xB4, 0x7D, 0x44, 0xBA, 0x4C, 0x88, 0x65, 0x2C, 0xA6, 0x59, 0xFB, 0x24, 0x9B, 0xF5, 0x70, 0x97,
-    0x45, 0xA2, 0x88, 0x00, 0x8B, 0x3A, 0x1E, 0xD6, 0x52, 0xB9, 0x3A, 0x59, 0x4B, 0x5E, 0xB3, 0x1A,
-    0xB3, 0x78, 0x64, 0x15, 0x74, 0xDC, 0xC1, 0x63, 0xD9, 0x10, 0xE2, 0x12, 0x3C, 0x91, 0xD2, 0x82,
-    0xFB, 0x2F, 0xC5, 0x11, 0x53, 0x1D, 0x57, 0x4C, 0xC8, 0xB2, 0x55, 0x2D, 0x26, 0x11, 0x43, 0xF9,
-    0x9A, 0x21, 0xF7, 0xE7, 0x95, 0x22, 0x60, 0x28, 0xEC, 0xC0, 0x79, 0xA9, 0x6E, 0x94, 0x5C, 0x60,
-    0xAB, 0x45, 0x1E, 0xF2, 0xCC, 0xFA, 0x92, 0x9E, 0xED, 0x4B, 0x1C, 0x06, 0x55, 0x4A, 0x02, 0x6C,
-    0xC2, 0x04, 0xDF, 0x85, 0xD6, 0x75, 0xF0, 0x1E, 0x3A, 0xEF, 0xA4, 0x88, 0x11, 0xFC, 0xC7, 0xDF,
-    0xC4, 0x90, 0x7F, 0xE5, 0xBC, 0x8D, 0x79, 0xC7, 0xCE, 0x95, 0xD8, 0x78, 0x25, 0x4D, 0x97, 0xAA,
-    0xD0, 0x32, 0xEC, 0x62, 0x41, 0x9F, 0x89, 0xCB, 0x27, 0xAF, 0x9E, 0x59, 0xAD, 0x5D, 0x8B, 0x51,
-    0x6D, 0x8C, 0xFF, 0xC1, 0x08, 0xC6, 0xCA, 0xCB, 0xE0, 0x78, 0x33, 0xAA, 0x55, 0x28, 0xEB, 0x21,
-    0x39, 0x8D, 0x64, 0xF8, 0x64, 0x23, 0x99, 0x1F, 0xD6, 0x24, 0xDA, 0xAF, 0x73, 0x21, 0xD9, 0xF8,
-    0x84, 0x39, 0x21, 0xEB, 0xDA, 0xE5, 0x9A, 0x51, 0x3B, 0x67, 0x02, 0x22, 0x1A, 0x18, 0x4D, 0xE9,
-    0x30, 0x6B, 0x5F, 0x4B, 0x72, 0x17, 0x0A, 0x89, 0x3D, 0x6D, 0x9A, 0x82, 0xCE, 0xC4, 0x16, 0x77,
-    0xC2, 0xF2, 0x0F, 0x9F, 0x4C, 0x82, 0x72, 0x33, 0x88, 0x7A, 0x22, 0x1A, 0x74, 0xB6, 0x22, 0x84,
-    0x33, 0xB3, 0xDC, 0xEA, 0x22, 0x6C, 0x6C, 0x62, 0xEA, 0x31, 0x75, 0x97, 0xF1, 0x45, 0x70, 0xF5,
-    0x5B, 0x29, 0x3B, 0x90, 0x62, 0x31, 0xCD, 0xB5, 0x24, 0x3A, 0x45, 0xC8, 0xEC, 0xC2, 0xD5, 0x4C,
-    0xB5, 0x24, 0x92, 0x1D, 0xB5, 0x5C, 0x2E, 0x8D, 0x47, 0xAA, 0x36, 0x24, 0x25, 0x9F, 0x6C, 0x54,
-    0x90, 0x26, 0x06, 0xDA, 0xB1, 0x48, 0x73, 0xF6, 0x6D, 0x5E, 0xAF, 0x45, 0xE4, 0x41, 0xDB, 0x05,
-    0x95, 0x89, 0xE7, 0x70, 0x59, 0x32, 0x19, 0x68, 0xE5, 0x69, 0x4C, 0xF7, 0x92, 0xCD, 0xB3, 0xFD,
-    0xE7, 0xC5, 0x0F, 0x95, 0x58, 0x1D, 0xE2, 0x97, 0xE9, 0x8F, 0x41, 0x01, 0xD3, 0x30, 0xB6, 0x68,
-    0x95, 0x74, 0xA3, 0xA8, 0x74, 0x09, 0x11, 0x92, 0xFA, 0xC6, 0x18, 0xC4, 0x2F, 0x46, 0xE0, 0x32,
-    0x09, 0x18, 0xCB, 0xFC, 0xDA, 0xF2, 0x48, 0x0F, 0xD5, 0x17, 0x1F, 0xD5, 0x53, 0x2F, 0xD5, 0x19,
-    0x13, 0x69, 0x00, 0x92, 0x7A, 0x48, 0xDD, 0x05, 0x00, 0xFE, 0x4F, 0xF9, 0x11, 0xDA, 0x1B, 0xA9,
-    0x8B, 0x33, 0x4B, 0x02, 0x9D, 0x31, 0xDA, 0xF7, 0xE0, 0x31, 0x85, 0xE2, 0xBF, 0xFC, 0x32, 0x74,
-    0xD6, 0x7F, 0x22, 0x35, 0x43, 0x9F, 0xC8, 0x26, 0x60, 0xCF, 0x41, 0x48, 0x5B, 0xD9, 0xA7, 0x6D,
-    0xEF, 0xD1, 0x8A, 0x9E, 0xA4, 0x0E, 0x0C, 0x2C, 0x84, 0xBE, 0x17, 0x69, 0x6E, 0x61, 0x0E, 0x59,
-    0xB9, 0x64, 0xBD, 0xD2, 0x5C, 0xCB, 0x8D, 0xFD, 0x29, 0x3C, 0xCA, 0xBB, 0x10, 0xB0, 0x17, 0x0A,
-    0x41, 0x55, 0x2C, 0x7F, 0x8D, 0x2F, 0x56, 0xA6, 0xAC, 0x20, 0xF6, 0x25, 0x4C, 0x64, 0x31, 0xC0,
-    0x8F, 0x7A, 0x81, 0x9D, 0xF7, 0xFA, 0x14, 0xD8, 0x81, 0x50, 0x3A, 0x16, 0x52, 0x2B, 0xA1, 0xB5,
-    0x24, 0xB1, 0xCC, 0xFC, 0xFF, 0x1D, 0x8D, 0x3B, 0xC8, 0x65, 0x37, 0x98, 0x74, 0x3A, 0xD4, 0x81,
-    0x98, 0x78, 0x3F, 0x76, 0xD5, 0xB8, 0xF3, 0x99, 0xF8, 0x1F, 0x9C, 0x7D, 0xF9, 0x65, 0xC8, 0x21,
-    0xA9, 0x06, 0xF4, 0x04, 0xD9, 0x01, 0xE9, 0xCE, 0x42, 0x21, 0xBC, 0x2F, 0x94, 0xF7, 0x85, 0xF4,
-    0xA1, 0x9F, 0x80, 0xF6, 0x81, 0x10, 0x3F, 0x56, 0xEA, 0xCF, 0x93, 0x7C, 0x10, 0x49, 0xB4, 0x3F,
-    0x01, 0x86, 0xB4, 0x3E, 0x83, 0x73, 0x70, 0x3E, 0x66, 0xDE, 0xF7, 0xCD, 0x1C, 0x32, 0xF1, 0xF3,
-    0x42, 0x76, 0x81, 0x33, 0x41, 0x14, 0xEB, 0xAA, 0x04, 0xED, 0x65, 0xE5, 0x3F, 0x96, 0x17, 0x55,
-    0xE0, 0xBD, 0x51, 0x8C, 0x43, 0xFF, 0xD1, 0x7C, 0xD0, 0xC7, 0x3C, 0x83, 0xDE, 0xD0, 0xC9, 0x7A,
-    0x92, 0x81, 0x2A, 0xBA, 0xE7, 0xD5, 0x8D, 0xB3, 0x99, 0xB0, 0x20, 0xB5, 0x63, 0x09, 0x99, 0x25,
-    0xAB, 0xDB, 0x17, 0x89, 0x0B, 0x45, 0x62, 0xFC, 0x3D, 0x4D, 0x1C, 0x27, 0xB2, 0xDF, 0x34, 0x3D,
-    0x2F, 0xBE, 0xC7, 0x6C, 0xAE, 0x9B, 0xD5, 0xD2, 0xEF, 0x40, 0x33, 0x44, 0xDB, 0x45, 0xF1, 0x60,
-    0x8E, 0xD1, 0x8F, 0xD9, 0x26, 0x17, 0xB0, 0x3A, 0x9D, 0x88, 0xD1, 0x87, 0x18, 0xF6, 0x5A, 0x27,
-    0x60, 0xEE, 0xDF, 0x01, 0x6A, 0x0D, 0xD9, 0x31, 0xE2, 0xEF, 0xBC, 0x56, 0x68, 0x25, 0x80, 0xA9,
-    0x8C, 0xA5, 0x12, 0x12, 0xE1, 0xB0, 0x89, 0x26, 0xF0, 0xC0, 0x55, 0x9F, 0x5A, 0xD5, 0x63, 0x16,
-    0x7D, 0xC0, 0xD2, 0xC1, 0xC0, 0xC5, 0xF2, 0x5D, 0x64, 0x56, 0xB2, 0x74, 0xB2, 0xA1, 0x29, 0xA0,
-    0xE9, 0x03, 0x5B, 0x8A, 0x04, 0x63, 0xE5, 0xA7, 0x02, 0x43, 0x4F, 0xE7, 0xC4, 0x2B, 0x10, 0x76,
-    0x51, 0x22, 0x26, 0x41, 0xC0, 0x57, 0x2D, 0xBD, 0x6A, 0xDA, 0xA5, 0xC8, 0x66, 0x0C, 0x96, 0x8A,
-    0x9A, 0x56, 0x89, 0xB6, 0x55, 0x89, 0xB0, 0x9B, 0x1F, 0x9C, 0x7D, 0xFF, 0x93, 0x9A, 0x54, 0x13,
-    0x9D, 0x83, 0x0D, 0x2E, 0x57, 0xC0, 0xFA, 0x00, 0xCC, 0x05, 0x93, 0xEB, 0x7D, 0xE6, 0x03, 0x68,
-    0xB6, 0xFA, 0x54, 0xC2, 0x3E, 0x1B, 0x57, 0x19, 0x45, 0x0C, 0xC8, 0x67, 0x64, 0xC6, 0xA1, 0x60,
-    0x75, 0x73, 0x5E, 0x78, 0x2C, 0x83, 0x06, 0x01, 0x4C, 0x49, 0x2E, 0xA1, 0x3D, 0x29, 0xC3, 0x30,
-    0x9A, 0x1F, 0x22, 0xF4, 0x9A, 0x54, 0xFC, 0x43, 0x21, 0xB3, 0x4F, 0x39, 0x39, 0x78, 0xC5, 0xCE,
-    0x81, 0x59, 0x6C, 0x26, 0xB8, 0xC5, 0xDE, 0x9D, 0x84, 0x88, 0x08, 0xBF, 0x21, 0x18, 0x86, 0x88,
-    0xC0, 0x32, 0x83, 0x98, 0x1E, 0x11, 0xBE, 0x31, 0x7F, 0x2D, 0x5D, 0x34, 0xEC, 0x01, 0x0D, 0xA8,
-    0x66, 0x1E, 0x3D, 0x02, 0xF3, 0xEB, 0xAC, 0x5D, 0x98, 0x60, 0x3B, 0x4C, 0xE1, 0x4F, 0x5B, 0x90,
-    0xB3, 0xD2, 0x48, 0x25, 0x2E, 0x6A, 0x8F, 0xBF, 0x27, 0xA5, 0x6C, 0xEC, 0xE7, 0xDA, 0xD3, 0xD5,
-    0x6A, 0x0D, 0xE0, 0xC0, 0x83, 0x1A, 0x09, 0x53, 0x6F, 0x36, 0xA1, 0xB5, 0x1E, 0xEB, 0x83, 0xC1,
-    0xFF, 0x8A, 0x97, 0xEB, 0xB1, 0xD1, 0x1F, 0x66, 0x89, 0x76, 0x59, 0x5A, 0x3B, 0x3B, 0x69, 0x57,
-    0x29, 0x87, 0x76, 0xBB, 0x2F, 0x60, 0xC5, 0x3F, 0xBE, 0x24, 0xF5, 0xBF, 0x75, 0x29, 0xCF, 0xC0,
-    0xE3, 0x3E, 0xD5, 0xA5, 0x70, 0x5B, 0x17, 0x76, 0x1C, 0x9B, 0x30, 0x33, 0xB2, 0x11, 0x42, 0xA0,
-    0x14, 0x58, 0xDB, 0x46, 0x1C, 0x30, 0xF1, 0xEF, 0x67, 0x82, 0x8B, 0xA3, 0x5F, 0xA9, 0xC5, 0x17,
-    0xAC, 0x0B, 0x53, 0xAF, 0x5D, 0x34, 0x96, 0xD4, 0x92, 0x3C, 0x29, 0x7A, 0x6A, 0xC6, 0x9F, 0xC9,
-    0x7F, 0xFE, 0x17, 0x1A, 0xDD, 0x87, 0x50, 0x00, 0x5C, 0x5F, 0x30, 0x6A, 0x4F, 0xAA, 0x58, 0x43,
-    0x8C, 0x33, 0x94, 0x16, 0x0D, 0x08, 0x84, 0xC5, 0xB2, 0x36, 0xA3, 0xD2, 0x28, 0x29, 0xB1, 0x94,
-    0x6C, 0x2D, 0x92, 0x24, 0x2D, 0xE9, 0xFB, 0xD6, 0xD5, 0x45, 0x7D, 0x49, 0xD6, 0x50, 0xD7, 0xAF,
-    0x7D, 0xFA, 0x4B, 0x29, 0x16, 0xC9, 0x1A, 0x38, 0xD9, 0x8D, 0xFD, 0x6A, 0x80, 0x95, 0xF6, 0x76,
-    0x60, 0xCE, 0xC1, 0xED, 0x58, 0xAC, 0x52, 0x88, 0xF8, 0xD0, 0xFB, 0xF7, 0x68, 0x1C, 0xA0, 0xDD,
-    0x01, 0x83, 0xE3, 0x90, 0xC9, 0x3F, 0x92, 0x01, 0x6B, 0x5A, 0xC2, 0x33, 0x59, 0x90, 0x94, 0x3E,
-    0xC3, 0xC4, 0x88, 0xB8, 0x2A, 0x7C, 0xEB, 0xBD, 0x5A, 0x7B, 0x3F, 0x6C, 0xA9, 0xCD, 0xDE, 0xAC,
-    0x8E, 0x78, 0xB0, 0xCC, 0x6E, 0x4B, 0xFD, 0x8A, 0x59, 0x99, 0xE6, 0xD4, 0x24, 0xA1, 0xD7, 0x4F,
-    0xBD, 0x1C, 0x8E, 0x8B, 0xAA, 0x56, 0x40, 0xD3, 0xC5, 0x29, 0xD9, 0x05, 0xDB, 0x52, 0x8A, 0x09,
-    0xF5, 0x46, 0x1E, 0xB3, 0x1D, 0x88, 0x2A, 0x5D, 0x5B, 0x5E, 0x33, 0xEB, 0x5E, 0x1B, 0xB5, 0xE8,
-    0x61, 0xB2, 0xC5, 0x1D, 0x8F, 0x62, 0x6B, 0x8A, 0x08, 0xC8, 0x13, 0xB7, 0x9A, 0xB1, 0x90, 0xDF,
-    0xC1, 0xAA, 0xE3, 0xFF, 0x53, 0xAA, 0x4A, 0xAC, 0x1A, 0x78, 0x30, 0x4A, 0x41, 0x42, 0xB6, 0x34,
-    0xF3, 0x38, 0xC2, 0xB0, 0x7C, 0x75, 0x59, 0xF9, 0x81, 0x64, 0x55, 0x16, 0x99, 0x47, 0xBB, 0xF5,
-    0x39, 0x80, 0x80, 0x7E, 0xCE, 0x56, 0x2F, 0xF6, 0xED, 0x4D, 0xB5, 0xEB, 0xA5, 0x6F, 0xA4, 0x00,
-    0x83, 0xE5, 0x17, 0x24, 0x21, 0x45, 0x5C, 0x71, 0x68, 0xE2, 0x55, 0xFC, 0x98, 0xF4, 0x9D, 0x9A,
-    0x23, 0xB5, 0x17, 0x89, 0xD4, 0x7E, 0x29, 0x48, 0x0D, 0x34, 0x79, 0x57, 0x3A, 0x77, 0xA2, 0xD5,
-    0xF6, 0x79, 0x52, 0xE9, 0x59, 0xC0, 0x3F, 0x00, 0xAD, 0x62, 0x80, 0xD1, 0x86, 0x22, 0x19, 0x63,
-    0xBC, 0x2A, 0xCD, 0xBB, 0xB2, 0xE9, 0x06, 0xBB, 0x18, 0xB2, 0x11, 0x04, 0x6B, 0x1B, 0xC0, 0x09,
-    0xF9, 0x43, 0x6D, 0x32, 0xF4, 0x39, 0x11, 0x06, 0x58, 0x23, 0xC7, 0xFE, 0x5B, 0x04, 0x1A, 0xEF,
-    0x4A, 0xA2, 0x9F, 0xFA, 0xF7, 0xFA, 0xF7, 0x19, 0x37, 0x77, 0x1D, 0xA3, 0x5F, 0x1B, 0x2F, 0x67,
-    0x8E, 0x41, 0x27, 0xB0, 0x9B, 0x7D, 0x06, 0x44, 0x4E, 0x6A, 0xDC, 0x37, 0x20, 0xAF, 0xB1, 0xE6,
-    0xE1, 0xBF, 0x2A, 0x9F, 0x66, 0x55, 0x96, 0xBA, 0xA3, 0x03, 0xF2, 0x45, 0x99, 0x32, 0x0A, 0x82,
-    0x7D, 0xD5, 0x8A, 0x5C, 0x5B, 0x19, 0x8C, 0xC8, 0xD7, 0xB3, 0xC6, 0x3E, 0x27, 0x32, 0x36, 0x90,
-    0xF4, 0x30, 0xCB, 0x1F, 0xF8, 0xC1, 0x96, 0x7E, 0x13, 0xC4, 0xBB, 0xDA, 0x10, 0x13, 0x09, 0xAC,
-    0xC2, 0x37, 0x34, 0xCD, 0x94, 0x4A, 0x10, 0x27, 0xB2, 0x07, 0x97, 0x68, 0x44, 0xFE, 0x02, 0x69,
-    0xB2, 0x63, 0x35, 0x4F, 0x1B, 0x96, 0xC2, 0xC4, 0xFF, 0x61, 0x62, 0x44, 0x16, 0xFD, 0xB3, 0x46,
-    0xE5, 0x91, 0x64, 0xAB, 0x4C, 0x8E, 0x8D, 0xCA, 0x25, 0x83, 0x5C, 0x91, 0x4D, 0xB7, 0x68, 0xE5,
-    0xD3, 0xED, 0x80, 0xA9, 0x9F, 0x2E, 0xE5, 0x0D, 0xCC, 0xB2, 0xC6, 0x58, 0x75, 0x57, 0x1C, 0xED,
-    0x58, 0x57, 0x0E, 0x8F, 0x5F, 0x32, 0xDF, 0x63, 0xBC, 0x00, 0x18, 0xC4, 0x1D, 0xA4, 0x84, 0xB3,
-    0xC9, 0xD9, 0xCB, 0x40, 0xA6, 0x34, 0x8D, 0x92, 0xEE, 0x40, 0x4A, 0xDE, 0x81, 0x18, 0x1A, 0xBE,
-    0x33, 0xBF, 0xC9, 0xC4, 0x42, 0x65, 0x58, 0x73, 0x63, 0x18, 0x44, 0xE9, 0xE7, 0xA6, 0x52, 0x03,
-    0xBC, 0x5F, 0xB2, 0x0C, 0x0E, 0x7D, 0xC4, 0xD6, 0x6E, 0x61, 0x39, 0xD8, 0x3E, 0x45, 0x6D, 0x70,
-    0xA6, 0x46, 0x73, 0xF1, 0x82, 0x39, 0x33, 0xDD, 0xE1, 0x45, 0x8D, 0xBB, 0xB5, 0x3C, 0x0B, 0xDB,
-    0x13, 0xB5, 0x94, 0x4F, 0xF5, 0x7D, 0x54, 0xB6, 0x7F, 0xBD, 0x2D, 0x6F, 0xEB, 0x62, 0x1E, 0xA4,
-    0xE8, 0x54, 0x1A, 0x6D, 0x37, 0x6D, 0x26, 0x4D, 0xEA, 0x54, 0x0F, 0x7A, 0x39, 0x76, 0x8B, 0x95,
-    0x6E, 0x88, 0xA5, 0xF8, 0x7C, 0x0E, 0x54, 0x49, 0x65, 0x7B, 0x3C, 0x7F, 0xD4, 0xC4, 0x5C, 0x24,
-    0xA4, 0x90, 0xBD, 0x91, 0x7D, 0xA1, 0x70, 0x70, 0x17, 0xC3, 0x24, 0x3A, 0x15, 0x4F, 0x4C, 0x70,
-    0xE5, 0x5F, 0xEA, 0x16, 0x0D, 0x08, 0x7C, 0x0E, 0xA4, 0xD9, 0xA1, 0xC3, 0xB6, 0xCC, 0xA9, 0x12,
-    0x41, 0x02, 0x33, 0x38, 0xD7, 0x9B, 0xDC, 0x7B, 0xF7, 0xD1, 0x82, 0xEE, 0x98, 0x1D, 0x13, 0x7D,
-    0x9D, 0xAE, 0x62, 0x37, 0x07, 0xDB, 0xC3, 0xC6, 0x2A, 0x29, 0x0C, 0x0E, 0xD2, 0xE8, 0xEC, 0x28,
-    0xF6, 0x1B, 0x36, 0xBA, 0xB6, 0x69, 0x92, 0x07, 0x96, 0x25, 0x71, 0xB4, 0xAD, 0xF2, 0x28, 0x68,
-    0xDD, 0x49, 0x37, 0xB9, 0x22, 0xD6, 0x0F, 0x4F, 0xC5, 0x4B, 0x7B, 0xEB, 0xE8, 0x5B, 0x4B, 0xC7,
-    0xF2, 0xA7, 0xDD, 0x59, 0xBC, 0x59, 0xD2, 0x7F, 0xA4, 0x14, 0xE3, 0xD9, 0xE3, 0x71, 0x39, 0x8A,
-    0x45, 0x95, 0x82, 0xA4, 0x6D, 0xC3, 0xD1, 0x36, 0xA2, 0x54, 0x7C, 0xA4, 0xF4, 0x68, 0x19, 0x89,
-    0x99, 0x4C, 0xDB, 0x14, 0xDC, 0x5A, 0x43, 0x05, 0xB8, 0xD6, 0x69, 0x6C, 0x1D, 0x3B, 0x40, 0xB1,
-    0xF7, 0x4C, 0xE0, 0x49, 0x86, 0x4E, 0xBA, 0x70, 0x6B, 0xAD, 0xF9, 0x32, 0x87, 0x67, 0x97, 0xDC,
-    0xE1, 0x84, 0xCD, 0x97, 0xC9, 0x24, 0x87, 0x3F, 0x93, 0xBE, 0x55, 0x62, 0x8E, 0x8C, 0xCE, 0x1A,
-    0x4E, 0x72, 0x4D, 0x17, 0xEB, 0xBC, 0x60, 0x75, 0xC9, 0xEB, 0xF5, 0x8E, 0x53, 0x14, 0x7F, 0xF0,
-    0xCC, 0xDF, 0x74, 0x25, 0xF6, 0xAE, 0x1F, 0xFD, 0x07, 0x66, 0xDE, 0x2B, 0xBF, 0xF4, 0x75, 0xFC,
-    0x12, 0xDB, 0xA0, 0x9B, 0x2A, 0x60, 0xC6, 0xE8, 0x99, 0xFB, 0x46, 0x31, 0x51, 0xBA, 0x74, 0x33,
-    0x6B, 0x49, 0xBA, 0xE5, 0xC0, 0x13, 0x06, 0x08, 0xD1, 0x4E, 0x08, 0xF9, 0x7D, 0x79, 0x02, 0xD3,
-    0x40, 0x14, 0x99, 0x61, 0xA4, 0x4F, 0xDC, 0x35, 0xD1, 0xA9, 0x29, 0x54, 0x3A, 0x10, 0x2C, 0xEF,
-    0x36, 0xBF, 0x64, 0x2E, 0xF3, 0x88, 0x96, 0xF5, 0x42, 0x3D, 0x46, 0x71, 0xE2, 0xC2, 0x6B, 0x5C,
-    0x9C, 0x7B, 0xEF, 0xB5, 0x0F, 0x90, 0xF1, 0x0D, 0x8E, 0x45, 0x89, 0x4B, 0x5E, 0x61, 0xEE, 0xE7,
-    0x73, 0x86, 0x74, 0x69, 0xF6, 0x6F, 0x57, 0xE8, 0xBE, 0xE3, 0x91, 0x6A, 0xDB, 0x39, 0xB8, 0x2F,
-    0xCD, 0x9B, 0xD0, 0x87, 0xED, 0xBF, 0x32, 0xB6, 0x84, 0x3A, 0xC5, 0xBC, 0xD5, 0x2D, 0x59, 0x69,
-    0x70, 0x5B, 0x74, 0x9A, 0xD7, 0x87, 0x3C, 0xE4, 0x07, 0x5B, 0xA6, 0x6B, 0xB0, 0x92, 0x84, 0xA4,
-    0x47, 0x1D, 0x94, 0xBA, 0xAF, 0x5A, 0xE1, 0x5B, 0xB7, 0x1D, 0xA9, 0x56, 0x1A, 0xC6, 0x74, 0x5E,
-    0x9B, 0xDB, 0x09, 0x97, 0xEA, 0x65, 0xCB, 0xD9, 0xFC, 0x45, 0x7E, 0x11, 0xCE, 0x0A, 0x02, 0xE0,
-    0x52, 0x08, 0x82, 0x2E, 0xA5, 0x7E, 0x48, 0xA7, 0x8D, 0xE9, 0x64, 0x14, 0x7A, 0xF1, 0x03, 0x50,
-    0x30, 0x7A, 0x89, 0x11, 0x9B, 0x91, 0x86, 0x51, 0x29, 0x4E, 0x7F, 0x5A, 0x1F, 0x71, 0xB2, 0x47,
-    0x58, 0x0D, 0x0F, 0x3F, 0x8C, 0xB5, 0x9B, 0x97, 0x86, 0xB6, 0x61, 0xA2, 0x6F, 0x8A, 0x4F, 0x3D,
-    0x20, 0x74, 0x2F, 0x32, 0xC5, 0x8F, 0x3C, 0xB8, 0xB3, 0x3B, 0x6A, 0xEA, 0x41, 0x9B, 0x95, 0x8E,
-    0xCD, 0x66, 0x19, 0xCE, 0xC6, 0xA3, 0xE4, 0x11, 0x26, 0x72, 0xC6, 0xE5, 0xCF, 0xFE, 0xC2, 0x3C,
-    0x34, 0x0A, 0xFE, 0xE2, 0x67, 0xE6, 0xFE, 0x6D, 0x13, 0xCD, 0xE2, 0x8B, 0x9B, 0xF5, 0x6F, 0xAC,
-    0x57, 0xA8, 0x50, 0x97, 0x3A, 0x8B, 0xDF, 0xF5, 0x0B, 0x3F, 0xE2, 0xB6, 0xDF, 0x1C, 0x3D, 0x20,
-    0xBA, 0x61, 0xD2, 0xA6, 0x69, 0xBA, 0x45, 0xB4, 0xD2, 0x7F, 0x87, 0x01, 0xD2, 0xBF, 0xC5, 0x6C,
-    0x47, 0x08, 0x32, 0x8F, 0x98, 0x2F, 0xF2, 0xB5, 0xAE, 0x66, 0xF7, 0x27, 0x26, 0x92, 0x4D, 0x77,
-    0x9A, 0xE4, 0x3F, 0xFE, 0x07, 0xB1, 0x3A, 0x4F, 0x66, 0xCF, 0xDC, 0x27, 0xBF, 0x60, 0xB6, 0xCD,
-    0x97, 0xFA, 0x62, 0x8E, 0x76, 0x89, 0xB0, 0xA2, 0x25, 0x2C, 0xF9, 0xDB, 0xEE, 0x17, 0x8E, 0xAC,
-    0x24, 0x13, 0xBC, 0xD6, 0x0F, 0x98, 0x6F, 0x5F, 0xE8, 0x12, 0x5D, 0x4E, 0x7C, 0x70, 0xCC, 0x1F,
-    0x74, 0xDF, 0xCC, 0xCF, 0x03, 0x96, 0xDD, 0x37, 0xEA, 0x6D, 0xEE, 0xEB, 0x4A, 0x3C, 0x3E, 0xB5,
-    0xC8, 0x62, 0xF3, 0x85, 0xD4, 0x0D, 0x5B, 0x58, 0x2E, 0xFB, 0x48, 0xD3, 0x2E, 0x0D, 0x06, 0x86,
-    0xC2, 0x96, 0xAC, 0x66, 0x34, 0x6E, 0xF6, 0xF5, 0x5D, 0x35, 0x74, 0x71, 0xB7, 0x3E, 0xFB, 0x12,
-    0x54, 0x70, 0xA1, 0x52, 0x49, 0x6D, 0x61, 0x81, 0xD2, 0x2F, 0xBE, 0x36, 0xC2, 0xFA, 0x77, 0xF0,
-    0xFA, 0x4D, 0xD7, 0x3E, 0x2A, 0x67, 0x41, 0xCA, 0x56, 0x7E, 0x47, 0x31, 0xA2, 0xF5, 0x13, 0x3A,
-    0x6B, 0x25, 0x87, 0x06, 0x85, 0xC1, 0xF5, 0xE5, 0x0E, 0x32, 0x7C, 0xD3, 0xD9, 0x08, 0xFB, 0xB0,
-    0x99, 0x6D, 0xB6, 0x16, 0x32, 0xE1, 0x6D, 0xAC, 0x7D, 0x3A, 0x1A, 0x96, 0xBB, 0xA4, 0x2D, 0xA5,
-    0x4B, 0xDC, 0xEC, 0x32, 0x1D, 0x30, 0xA5, 0x49, 0xAB, 0xD9, 0x02, 0xC7, 0x42, 0x7E, 0x74, 0x91,
-    0x05, 0x2F, 0x96, 0x60, 0x4A, 0x44, 0xA7, 0xCE, 0xBB, 0x08, 0xF7, 0x18, 0x9B, 0xA7, 0x21, 0xB3,
-    0x12, 0x03, 0x06, 0x8C, 0xA5, 0xCB, 0xD0, 0xCE, 0x25, 0xA2, 0x81, 0xA3, 0x21, 0x84, 0x38, 0xC1,
-    0x30, 0xB3, 0x2F, 0x36, 0x90, 0x00, 0x91, 0x67, 0x43, 0x4E, 0xB3, 0xCB, 0xBA, 0xD8, 0x93, 0x1E,
-    0xEB, 0xD6, 0xA3, 0x89, 0x0E, 0x2F, 0x30, 0xBE, 0x58, 0x81, 0x33, 0x1D, 0x29, 0x03, 0x78, 0x08,
-    0x84, 0xB9, 0xAF, 0x15, 0x1A, 0xD1, 0x9D, 0x69, 0x7B, 0xE2, 0xCC, 0xB3, 0x30, 0x04, 0xE3, 0xA5,
-    0xC4, 0xA3, 0x66, 0x7A, 0x63, 0x49, 0x3A, 0xE6, 0x5D, 0x89, 0xB3, 0x27, 0xCE, 0x6D, 0x9E, 0x74,
-    0x8C, 0x59, 0x1A, 0xF5, 0xA7, 0x41, 0x61, 0x62, 0x16, 0x36, 0x38, 0x39, 0x25, 0xC0, 0x6F, 0x67,
-    0x3E, 0x3A, 0x37, 0x10, 0x6B, 0xD3, 0xD3, 0x52, 0x8F, 0xE1, 0x59, 0x81, 0x1B, 0x8E, 0x8D, 0x1C,
-    0x48, 0xBD, 0xF9, 0x2B, 0xA9, 0x37, 0x1A, 0x54, 0x84, 0x14, 0x4F, 0x36, 0x5A, 0xEB, 0xE9, 0x52,
-    0x6F, 0x4B, 0xC9, 0xCD, 0xE3, 0xB3, 0x73, 0x12, 0x2E, 0xBA, 0x57, 0xE3, 0x43, 0x0F, 0xFC, 0xCD,
-    0xCD, 0x0F, 0x3E, 0x2F, 0x27, 0x3C, 0x24, 0xBD, 0xE0, 0x77, 0x55, 0x3D, 0xFC, 0x69, 0xB4, 0xDA,
-    0x92, 0xC4, 0xAE, 0xEA, 0x09, 0x54, 0x68, 0xFA, 0x34, 0xBB, 0x16, 0x19, 0xF8, 0xB1, 0x03, 0xB5,
-    0xAF, 0x07, 0x51, 0x8F, 0x20, 0xC8, 0x7F, 0xBD, 0x76, 0xB3, 0xAD, 0xCA, 0xFB, 0x60, 0x94, 0x33,
-    0x82, 0xF6, 0x9B, 0x0B, 0x31, 0x7B, 0xF5, 0x02, 0x63, 0xAF, 0xD4, 0xF9, 0x96, 0xED, 0xE3, 0xA1,
-    0xAD, 0x0E, 0x93, 0xAE, 0xD5, 0x41, 0x7A, 0x1A, 0xAD, 0x03, 0xAD, 0x0E, 0xDA, 0x0C, 0xF9, 0x1B,
-    0x80, 0xC0, 0xE2, 0xEF, 0xB1, 0x40, 0x15, 0x6B, 0x07, 0x17, 0xA4, 0xD5, 0x81, 0x41, 0x7B, 0xFC,
-    0x14, 0xBB, 0x4E, 0x05, 0x50, 0x98, 0xF8, 0xD0, 0xE2, 0xF9, 0x6A, 0xD1, 0xAB, 0x3D, 0x61, 0xCB,
-    0x13, 0x9F, 0x13, 0x29, 0x01, 0x9E, 0x5F, 0xEE, 0x58, 0xB6, 0x6F, 0x71, 0x8A, 0x67, 0xD9, 0x7A,
-    0x1F, 0xCA, 0x9A, 0xE9, 0xA2, 0x5E, 0x6F, 0xB1, 0xE8, 0x3B, 0x17, 0x58, 0xD9, 0x35, 0xD6, 0xD5,
-    0x8D, 0x2F, 0x35, 0x7E, 0x47, 0xE8, 0xCD, 0xE8, 0x5C, 0x16, 0x9B, 0xE3, 0x97, 0x4F, 0x4B, 0x79,
-    0x8B, 0x55, 0xCB, 0xC3, 0xC6, 0xB9, 0x81, 0xCE, 0x9D, 0x1D, 0xA5, 0xE9, 0xF3, 0x9D, 0x1B, 0x68,
-    0x1A, 0x61, 0x5D, 0x27, 0x4D, 0xFA, 0xC5, 0x68, 0x9A, 0x6E, 0x9C, 0x69, 0x8B, 0xF7, 0x37, 0xF2,
-    0xF6, 0x41, 0x2C, 0xD9, 0x28, 0x11, 0x8B, 0x24, 0x4C, 0x21, 0xCA, 0x79, 0x20, 0xD1, 0x0A, 0x71,
-    0x0D, 0xBB, 0xFB, 0xAD, 0x72, 0x88, 0xD7, 0xA0, 0xED, 0xB0, 0x69, 0x8F, 0xD2, 0x64, 0xBA, 0x1A,
-    0x51, 0x7C, 0xD4, 0x9E, 0x49, 0x72, 0x91, 0x27, 0x74, 0x04, 0x4A, 0x29, 0xCD, 0xF1, 0x61, 0x34,
-    0xBB, 0x92, 0x62, 0xC1, 0x5C, 0x6F, 0xCC, 0x24, 0x8D, 0xCB, 0x16, 0xA5, 0x80, 0x15, 0x29, 0x5A,
-    0x88, 0xB6, 0x60, 0xBD, 0xD8, 0xB5, 0x2D, 0xD1, 0x99, 0xFB, 0x3C, 0xD8, 0x1E, 0x16, 0x5D, 0x66,
-    0x73, 0xE9, 0x70, 0x32, 0x01, 0x9F, 0x30, 0x40, 0xA5, 0x1C, 0x03, 0xF0, 0x32, 0x6D, 0x8F, 0x8C,
-    0x25, 0x3D, 0xC7, 0x4C, 0x5E, 0xE5, 0x9F, 0x92, 0x06, 0xB1, 0x40, 0xE0, 0x42, 0x3F, 0x14, 0x98,
-    0x10, 0x86, 0x9A, 0x38, 0xDE, 0xAB, 0xF5, 0xF8, 0xAC, 0x98, 0xC9, 0x68, 0x28, 0x0E, 0xA2, 0x1E,
-    0x6B, 0xE0, 0x29, 0x61, 0x82, 0x97, 0x49, 0xC8, 0x10, 0x26, 0x25, 0xC9, 0xD9, 0x92, 0x16, 0x4D,
-    0xAB, 0xE2, 0x21, 0x28, 0x08, 0xB6, 0x93, 0x3B, 0x57, 0xD9, 0x6A, 0x90, 0x59, 0x4D, 0xC2, 0xCE,
-    0x20, 0xD3, 0x76, 0x5A, 0x06, 0x2B, 0x81, 0x57, 0x1B, 0x76, 0xF5, 0x56, 0xDE, 0x8E, 0xB2, 0x4C,
-    0x7A, 0x3F, 0xD0, 0x13, 0x9C, 0x67, 0x80, 0x40, 0xCC, 0x3A, 0x9B, 0x85, 0xF6, 0xF4, 0x08, 0x63,
-    0x44, 0x57, 0x7A, 0xE9, 0x7A, 0xBE, 0xF4, 0xD2, 0x9D, 0xE4, 0xB4, 0x56, 0x31, 0x08, 0xF5, 0xF8,
-    0xD9, 0x6C, 0xF1, 0xE6, 0xE4, 0xE5, 0x50, 0x24, 0xB7, 0x90, 0x83, 0x60, 0x6F, 0xC8, 0x5B, 0xF8,
-    0x68, 0x4E, 0x72, 0x27, 0x30, 0x3F, 0x30, 0xAB, 0x35, 0xAC, 0x30, 0x0C, 0x0F, 0x4C, 0xB0, 0xD3,
-    0xB6, 0xD4, 0xAD, 0xD2, 0x32, 0x58, 0x79, 0x6B, 0xB5, 0xE1, 0xCC, 0x9D, 0x3B, 0x65, 0xC5, 0xC4,
-    0xC1, 0xB7, 0x8D, 0x1A, 0x58, 0x26, 0xBA, 0xB7, 0x04, 0xC5, 0x4A, 0xD8, 0xFA, 0x95, 0x3B, 0xFD,
-    0x5E, 0x6F, 0x1D, 0xFD, 0x40, 0x5F, 0x6B, 0xA5, 0xE2, 0xC5, 0x35, 0x65, 0xD0, 0x65, 0xCE, 0x3F,
-    0xE0, 0x69, 0xC1, 0x2D, 0x36, 0xDA, 0xF2, 0x6C, 0x94, 0x4B, 0x8F, 0x87, 0xA0, 0xD1, 0x2E, 0x46,
-    0xD2, 0x9F, 0x88, 0xC7, 0xFB, 0xEC, 0x2C, 0xFD, 0x90, 0x0A, 0x4E, 0xD7, 0xEF, 0x7F, 0xC8, 0xE4,
-    0xC7, 0x4B, 0xD4, 0x29, 0x9E, 0x6A, 0xE3, 0xD9, 0x1D, 0x89, 0x7F, 0x24, 0x82, 0x10, 0x33, 0xCC,
-    0x23, 0x02, 0xBF, 0x62, 0x9B, 0x37, 0x01, 0xBC, 0xE4, 0xF4, 0x17, 0x67, 0x25, 0x05, 0x63, 0x58,
-    0x45, 0xD7, 0xBE, 0x8D, 0x10, 0xCA, 0x9C, 0x37, 0xAF, 0x98, 0x92, 0xAD, 0xFC, 0x9E, 0xB4, 0x44,
-    0x4B, 0x87, 0xDA, 0x3F, 0x17, 0xC6, 0xF9, 0x27, 0x82, 0x4D, 0x9D, 0xD4, 0xFF, 0x5D, 0x22, 0xB9,
-    0x10, 0x66, 0x46, 0x02, 0x8B, 0xE5, 0xC4, 0x5D, 0xCE, 0xC4, 0x54, 0x42, 0xBE, 0x9A, 0x30, 0xEC,
-    0xDC, 0xC3, 0xDA, 0x32, 0x7B, 0xD5, 0x82, 0xBD, 0x7F, 0xC8, 0x31, 0x31, 0xBB, 0x76, 0x0B, 0xC2,
-    0xF3, 0x8F, 0x16, 0xEC, 0xD1, 0xD2, 0x11, 0xDA, 0xFA, 0x3C, 0x63, 0xA6, 0xEC, 0x3D, 0x41, 0xF6,
-    0x58, 0x22, 0x0F, 0x7D, 0xB2, 0xE7, 0x2F, 0xB1, 0x97, 0x90, 0xBD, 0xAC, 0x3D, 0xA4, 0x2D, 0xB5,
-    0xD0, 0x1F, 0x55, 0xD6, 0x27, 0xBF, 0xCF, 0xED, 0x4F, 0xAF, 0xC4, 0xCE, 0x67, 0x40, 0xB1, 0x1F,
-    0x97, 0x60, 0x80, 0xE7, 0xA2, 0x14, 0xFC, 0xFA, 0x2F, 0x25, 0x32, 0xA8, 0x7F, 0x16, 0x0C, 0x9C,
-    0x00, 0x03, 0x27, 0x11, 0x7F, 0x3D, 0x14, 0x69, 0x2D, 0x74, 0x4E, 0xE8, 0xDA, 0x34, 0xDE, 0x82,
-    0xD6, 0xBD, 0xC1, 0xF8, 0xEB, 0x6D, 0x12, 0x1A, 0x24, 0x9A, 0xA0, 0x73, 0x3E, 0x62, 0x15, 0xF6,
-    0xF7, 0x74, 0x83, 0x1F, 0x26, 0xDD, 0x3E, 0x5C, 0xB9, 0xC9, 0x3E, 0xF4, 0x99, 0xC8, 0x6D, 0x09,
-    0x0D, 0x56, 0x08, 0x5D, 0x29, 0x16, 0xBF, 0x62, 0xD8, 0x76, 0x62, 0xED, 0x9E, 0xE9, 0xAA, 0x68,
-    0xDC, 0x85, 0x12, 0xBB, 0xC0, 0xA2, 0x73, 0xEC, 0x14, 0xBB, 0xD8, 0x85, 0x03, 0x4C, 0xC8, 0x2E,
-    0x64, 0x07, 0x77, 0x41, 0x98, 0x88, 0x60, 0x82, 0x2B, 0x3C, 0xDC, 0xE2, 0xD8, 0x88, 0x39, 0x07,
-    0x99, 0xBF, 0x47, 0x72, 0x58, 0x73, 0x36, 0x63, 0xAA, 0x6D, 0x1D, 0xB5, 0x69, 0x05, 0xC9, 0xEF,
-    0x5B, 0x5C, 0x6D, 0xFB, 0x1A, 0xF7, 0xEE, 0x63, 0x31, 0x80, 0x15, 0xB5, 0x76, 0x97, 0xDB, 0x18,
-    0x49, 0x08, 0x9E, 0x74, 0x27, 0x38, 0x1C, 0xF6, 0x61, 0x5B, 0x72, 0x9A, 0xAD, 0x36, 0xCF, 0xED,
-    0x98, 0x07, 0x63, 0xC4, 0x2E, 0x5B, 0xE6, 0xB9, 0x3D, 0xD6, 0x28, 0x7A, 0xB4, 0x0B, 0x03, 0x06,
-    0x24, 0x63, 0x5A, 0xC3, 0x69, 0xA5, 0x51, 0x06, 0xE6, 0x20, 0x56, 0xFD, 0x4C, 0xB4, 0x4E, 0x4A,
-    0xD8, 0xBB, 0x46, 0x2B, 0x0C, 0x52, 0xF2, 0x17, 0x8B, 0xC8, 0x66, 0x18, 0xA3, 0x65, 0x9D, 0xC5,
-    0x59, 0x31, 0x0A, 0x89, 0x5C, 0x66, 0x20, 0xD0, 0x4F, 0x0F, 0x55, 0xE5, 0x7A, 0xA4, 0xC2, 0x4D,
-    0x99, 0xAA, 0x4F, 0x59, 0x26, 0x48, 0xFD, 0x0F, 0x36, 0xCE, 0x6A, 0x0B, 0xA9, 0xBF, 0xDA, 0x42,
-    0x1A, 0x2D, 0x9F, 0x44, 0x1B, 0xC6, 0x18, 0x7D, 0xC2, 0x53, 0x7E, 0xCD, 0x0D, 0x79, 0xE1, 0xE5,
-    0x78, 0xEC, 0x18, 0x85, 0xE8, 0xFE, 0x58, 0x4F, 0x76, 0xB0, 0x62, 0xDE, 0x1E, 0xA1, 0x58, 0x20,
-    0x06, 0x56, 0xEA, 0x78, 0x2A, 0xDA, 0xE3, 0xA3, 0x3D, 0x36, 0x31, 0x07, 0x18, 0xF3, 0x5F, 0xEF,
-    0xF3, 0x3C, 0x5E, 0xCF, 0x38, 0xB3, 0x43, 0x90, 0x43, 0x35, 0x7F, 0x9C, 0x96, 0xBF, 0x9E, 0x4C,
-    0xF9, 0xF7, 0x0D, 0xD1, 0xAB, 0xD9, 0x3F, 0xA3, 0x6D, 0x16, 0x7A, 0x8B, 0x83, 0x5E, 0xE4, 0xD0,
-    0xB6, 0x5C, 0x48, 0xD7, 0x85, 0x36, 0x5E, 0xB8, 0xF3, 0x52, 0x23, 0xF8, 0x26, 0xFF, 0xED, 0xED,
-    0x0E, 0xDA, 0x87, 0xA1, 0xAD, 0x18, 0xCB, 0xDD, 0x18, 0x7A, 0x49, 0x84, 0xDE, 0x13, 0x31, 0x58,
-    0xBA, 0x2D, 0x82, 0xBC, 0xEE, 0x6C, 0x1B, 0x71, 0x5A, 0xE4, 0x76, 0x27, 0x11, 0xFA, 0x95, 0xDF,
-    0xEE, 0xA8, 0xA2, 0x9C, 0x6B, 0x15, 0x96, 0x95, 0x67, 0x65, 0x7A, 0x7E, 0x60, 0x91, 0x7E, 0x5A,
-    0xF8, 0x56, 0xC6, 0x75, 0x8D, 0xC8, 0x7A, 0x26, 0x3E, 0x5D, 0xF2, 0xF7, 0x13, 0x7D, 0x9B, 0x6E,
-    0x3C, 0xA5, 0x37, 0x29, 0xD8, 0xDA, 0xED, 0xD2, 0x5A, 0x64, 0x47, 0x4A, 0x99, 0x02, 0x71, 0xE4,
-    0xD8, 0x90, 0xD8, 0x10, 0xE9, 0x90, 0xC1, 0xDB, 0xAF, 0x65, 0xB3, 0x58, 0x21, 0xE1, 0xF1, 0x21,
-    0x96, 0x1B, 0xD8, 0x20, 0x30, 0xE2, 0x66, 0xB3, 0x17, 0x5E, 0x8E, 0xCF, 0x79, 0x3C, 0x7B, 0x30,
-    0x14, 0x18, 0xCD, 0x24, 0x5F, 0x2E, 0x07, 0x95, 0x58, 0x32, 0xE2, 0xF1, 0xB8, 0x7C, 0xA0, 0x09,
-    0x0F, 0x39, 0xAE, 0xD4, 0x26, 0x1F, 0xDB, 0xF4, 0x54, 0xFB, 0x16, 0xA9, 0x53, 0x94, 0xAA, 0xDA,
-    0x69, 0x3D, 0x84, 0x31, 0x52, 0x87, 0x3B, 0x52, 0x7F, 0x69, 0x69, 0xEF, 0xCA, 0x0E, 0x05, 0x9A,
-    0x69, 0x03, 0xC0, 0x85, 0x3D, 0x21, 0xB9, 0x27, 0xCF, 0x81, 0xD0, 0x3D, 0x36, 0x7A, 0x33, 0x85,
-    0xB8, 0x59, 0x39, 0x46, 0x45, 0x90, 0xC2, 0x13, 0x26, 0x29, 0x8B, 0x66, 0x6E, 0xCE, 0xDE, 0x53,
-    0x6D, 0xD4, 0xA5, 0x71, 0x75, 0x33, 0xA6, 0x5D, 0xDD, 0x94, 0x59, 0x58, 0x15, 0xFF, 0xD5, 0x02,
-    0x87, 0xD2, 0xC6, 0x78, 0xD8, 0x3A, 0x25, 0x71, 0x5E, 0x23, 0x7D, 0x13, 0x4D, 0xB6, 0x1A, 0x17,
-    0x51, 0xC1, 0x42, 0x12, 0xDB, 0x6C, 0x9F, 0x6E, 0x0F, 0xE2, 0xE7, 0xD6, 0x1E, 0x8F, 0x5D, 0x35,
-    0x69, 0x68, 0x82, 0x7F, 0xC2, 0x92, 0x44, 0x4E, 0x01, 0x15, 0xA0, 0x31, 0xAF, 0xF9, 0xA8, 0x9C,
-    0x02, 0x90, 0x5B, 0x1F, 0x39, 0x1E, 0x5E, 0xC6, 0xAA, 0x58, 0x3A, 0x06, 0xA1, 0xC9, 0x16, 0x93,
-    0x45, 0x51, 0x5C, 0xD7, 0xB0, 0xE6, 0x13, 0x36, 0xE8, 0x37, 0x1F, 0x11, 0xAA, 0x43, 0xCA, 0xAC,
-    0x47, 0x5B, 0xE8, 0xA0, 0x8D, 0xCD, 0x58, 0xD0, 0xFD, 0x23, 0x98, 0xC5, 0x02, 0x28, 0x8A, 0x00,
-    0xBD, 0x9A, 0xAA, 0x87, 0xB1, 0x07, 0x58, 0x6C, 0x84, 0x38, 0x03, 0xD6, 0x20, 0xF1, 0xAA, 0x06,
-    0xDE, 0x9B, 0x40, 0x0B, 0xBF, 0xCF, 0xA2, 0xC7, 0x9A, 0x04, 0x90, 0xED, 0xB4, 0x9C, 0x73, 0x39,
-    0xEA, 0xE5, 0x77, 0x3C, 0x0D, 0xB3, 0xDE, 0x96, 0xA6, 0x2D, 0x69, 0x0E, 0x94, 0xF4, 0xA3, 0x9B,
-    0x74, 0xD1, 0x9B, 0x14, 0x86, 0x78, 0x01, 0x89, 0x9C, 0xF0, 0xD3, 0x8C, 0x9A, 0xF7, 0xFF, 0x92,
-    0x86, 0xD1, 0x36, 0x2F, 0xE9, 0x34, 0x7A, 0xBE, 0x4D, 0x0C, 0xB6, 0xAF, 0xB5, 0xAA, 0x2D, 0x4F,
-    0x48, 0x89, 0xAC, 0xA9, 0xE5, 0xD4, 0xE3, 0xD9, 0x0F, 0xCE, 0x1C, 0xEC, 0x64, 0xFB, 0x93, 0x27,
-    0x1E, 0x97, 0x6F, 0x01, 0xB8, 0x6A, 0xC4, 0x9C, 0x48, 0x9A, 0xE6, 0x60, 0xB3, 0x6B, 0xD9, 0x32,
-    0x72, 0x2E, 0x4C, 0x48, 0xFF, 0x27, 0x4D, 0x31, 0x82, 0x47, 0xB9, 0xF6, 0x8F, 0x57, 0xAF, 0xEE,
-    0xB1, 0xC7, 0x8C, 0xE8, 0x0F, 0xD8, 0xA4, 0xD1, 0xE0, 0xA7, 0x56, 0x63, 0x56, 0xC9, 0x0D, 0x21,
-    0x6C, 0x59, 0xD5, 0xFB, 0x01, 0x06, 0x46, 0x9B, 0x56, 0x8D, 0x76, 0xAD, 0x1A, 0x69, 0x5B, 0xA5,
-    0x4D, 0x93, 0xBE, 0xD6, 0x70, 0x7E, 0xD3, 0x4A, 0x6A, 0x35, 0xB1, 0xB4, 0x97, 0x4F, 0x0E, 0x43,
-    0x91, 0xED, 0xDB, 0x70, 0x05, 0xB9, 0x9D, 0x91, 0x56, 0x7E, 0xE6, 0x1A, 0x49, 0x40, 0x60, 0x18,
-    0x84, 0x32, 0x8B, 0x17, 0xC9, 0x29, 0x1B, 0x37, 0xAD, 0xC4, 0xF7, 0xF3, 0x58, 0xA2, 0xCD, 0x86,
-    0xB7, 0xE6, 0x26, 0xAB, 0x90, 0x2F, 0x6E, 0x9C, 0xA1, 0x95, 0x60, 0x65, 0x63, 0xE9, 0xFC, 0x8C,
-    0x1C, 0x53, 0xEC, 0x4B, 0x43, 0x18, 0x3C, 0x22, 0x0D, 0x19, 0x13, 0x94, 0xCC, 0x4E, 0x32, 0x35,
-    0xD9, 0x6F, 0x0B, 0x2A, 0x95, 0xF6, 0xDA, 0x79, 0xD9, 0xAD, 0xA3, 0x24, 0x5F, 0x8E, 0x03, 0xB3,
-    0xBE, 0xC1, 0xBB, 0x90, 0xA8, 0xA7, 0xA5, 0x9E, 0xE7, 0x95, 0xA6, 0x0F, 0x2A, 0xB0, 0x61, 0x72,
-    0xD2, 0xF0, 0x30, 0xB5, 0x31, 0x9F, 0xCB, 0x41, 0xCB, 0xAC, 0xCB, 0x13, 0xCD, 0xE5, 0x36, 0xD2,
-    0xE3, 0x57, 0xF5, 0x0D, 0x96, 0x5F, 0x5A, 0xFD, 0x04, 0x77, 0xAD, 0x27, 0xE6, 0x61, 0x8A, 0xA4,
-    0x1C, 0x33, 0x64, 0x0A, 0xDB, 0x2A, 0xBA, 0x89, 0x78, 0xB8, 0x29, 0xF7, 0x13, 0x9D, 0x8D, 0xC7,
-    0x06, 0x0C, 0x4B, 0xD5, 0xC6, 0xFA, 0x84, 0x9F, 0xFB, 0x4C, 0x3C, 0x2B, 0x67, 0x93, 0x44, 0xF5,
-    0xA4, 0x2B, 0x1B, 0x47, 0xEC, 0x95, 0x19, 0x35, 0xE5, 0xCA, 0xB5, 0x18, 0x73, 0x94, 0xA7, 0x16,
-    0xE6, 0x4E, 0x9E, 0x1D, 0xDD, 0xE5, 0x49, 0x8E, 0x11, 0xFB, 0x6B, 0xA2, 0x43, 0x1C, 0x6D, 0x60,
-    0x96, 0x1C, 0xED, 0x2B, 0xE6, 0x41, 0x4A, 0xC8, 0x16, 0xD7, 0xAA, 0x6E, 0xDB, 0xCF, 0xD9, 0x46,
-    0x62, 0x3C, 0x02, 0x5B, 0x67, 0x3A, 0x6F, 0xEC, 0x92, 0x23, 0xF7, 0x75, 0x77, 0xB5, 0xC8, 0x98,
-    0x34, 0xF2, 0x7C, 0x8E, 0xCB, 0xC5, 0xF1, 0x53, 0x4F, 0xE4, 0xF9, 0x66, 0xB8, 0x56, 0x38, 0xB6,
-    0xE4, 0xE8, 0x5C, 0xED, 0x25, 0x7C, 0xFA, 0xC9, 0xC3, 0x17, 0xFE, 0x70, 0x5E, 0x0E, 0xA6, 0x71,
-    0xBB, 0xC5, 0x9F, 0x50, 0x21, 0xBB, 0xB3, 0xAE, 0x46, 0x9C, 0x89, 0x9E, 0x76, 0xE5, 0x1F, 0x6B,
-    0xA3, 0x87, 0x5E, 0xF5, 0xA8, 0xB7, 0x91, 0xAB, 0x76, 0x5A, 0x1F, 0x56, 0x4A, 0x5E, 0x4E, 0xDC,
-    0xB3, 0x3A, 0x30, 0x59, 0x4D, 0xE9, 0xE2, 0xF8, 0x1F, 0xE2, 0xA4, 0xEB, 0xF6, 0x79, 0xA0, 0x73,
-    0x7B, 0xB9, 0x7F, 0x5B, 0x0F, 0x4F, 0x02, 0x7E, 0x3F, 0xBC, 0xB3, 0xB3, 0x9E, 0xC0, 0xD8, 0x7A,
-    0xE9, 0x73, 0x7B, 0xAF, 0x2E, 0x6E, 0x0F, 0xD1, 0x0B, 0x7B, 0xF4, 0x0E, 0x01, 0x56, 0x0B, 0xD5,
-    0xEF, 0xF0, 0x3C, 0x8A, 0x69, 0xAF, 0xBD, 0xB0, 0xF9, 0x70, 0xE9, 0xE3, 0x4E, 0xF0, 0xF0, 0x48,
-    0x05, 0x81, 0x68, 0xB2, 0x51, 0x8C, 0x80, 0xEA, 0xA6, 0x67, 0x00, 0x8E, 0x32, 0x8F, 0x74, 0x82,
-    0x47, 0x69, 0x79, 0x92, 0x96, 0x07, 0x69, 0x79, 0x8E, 0x96, 0x85, 0x02, 0xAD, 0x07, 0x31, 0x84,
-    0x66, 0x2D, 0xC8, 0x06, 0xF8, 0x74, 0xF3, 0x68, 0xA7, 0xC9, 0xC2, 0xA6, 0xC9, 0xEC, 0xDF, 0x3E,
-    0x71, 0x98, 0xCA, 0x9C, 0x66, 0x71, 0x55, 0x5F, 0x9D, 0x8A, 0x2E, 0x07, 0x01, 0x6B, 0x31, 0x9B,
-    0xF8, 0xBB, 0x6E, 0xDE, 0xA1, 0xD4, 0x6D, 0x0E, 0x36, 0xF1, 0xCF, 0xDA, 0x26, 0xFE, 0x83, 0x36,
-    0x50, 0x6C, 0xF8, 0x4D, 0x12, 0x24, 0xB7, 0xE0, 0xC1, 0x8A, 0xAB, 0x9E, 0xFB, 0x42, 0x39, 0xF0,
-    0x4E, 0x15, 0x63, 0x1F, 0x9A, 0xE3, 0x83, 0x87, 0x0B, 0x2D, 0x0F, 0x7B, 0xE0, 0xE1, 0xA4, 0xCF,
-    0x57, 0x62, 0x9E, 0xC7, 0x27, 0x5F, 0x5F, 0x1D, 0xFB, 0x20, 0xAD, 0x83, 0x07, 0x40, 0xEB, 0x23,
-    0x61, 0x5C, 0x9F, 0x04, 0xAD, 0x7F, 0x09, 0x5A, 0x27, 0x7B, 0x26, 0x24, 0xAD, 0xD4, 0x47, 0x96,
-    0x9B, 0x11, 0x98, 0x59, 0xD9, 0xD2, 0x09, 0xF5, 0xC1, 0x2A, 0x0B, 0xAB, 0x69, 0x8C, 0x1F, 0xC7,
-    0xCE, 0x1F, 0x9B, 0xD2, 0x6D, 0xAE, 0xD7, 0xDE, 0x25, 0xB3, 0xC5, 0x4B, 0xA1, 0x6E, 0xBD, 0x07,
-    0x76, 0x31, 0xEE, 0x4E, 0xD7, 0xDE, 0x2C, 0xEF, 0x52, 0x85, 0x99, 0xB9, 0xDA, 0x54, 0xD6, 0xB5,
-    0x0F, 0x6A, 0x58, 0xFA, 0x81, 0x73, 0x58, 0x6F, 0xE9, 0x4D, 0xBA, 0xAB, 0x7B, 0xF3, 0x32, 0x26,
-    0xBD, 0x71, 0x65, 0x5A, 0x77, 0x0C, 0x7F, 0x3C, 0x4A, 0xE8, 0x90, 0x41, 0x9F, 0x5B, 0xB4, 0xD7,
-    0x87, 0x79, 0xE9, 0xF7, 0x44, 0x65, 0x4E, 0x82, 0xC0, 0x28, 0x39, 0x89, 0x05, 0xE0, 0x21, 0xE5,
-    0x0B, 0x92, 0x73, 0x14, 0x57, 0x3B, 0x7B, 0x35, 0x9E, 0xD7, 0xC8, 0x96, 0x9F, 0xE3, 0x25, 0x7F,
-    0xA0, 0x55, 0x52, 0xF8, 0xE7, 0xA2, 0x3B, 0x32, 0x6F, 0xC9, 0x21, 0xBC, 0xB6, 0x1F, 0x74, 0x33,
-    0x17, 0x98, 0xE3, 0x5F, 0xDE, 0x85, 0x70, 0xF4, 0x9F, 0x87, 0x35, 0x2F, 0xC7, 0x66, 0x58, 0x55,
-    0xEB, 0x15, 0xD4, 0x22, 0x67, 0x6E, 0xB1, 0x5B, 0x49, 0xBB, 0x6B, 0x97, 0x9E, 0x9A, 0x73, 0x72,
-    0xBE, 0x35, 0xE8, 0x32, 0x3A, 0xDF, 0x04, 0x6E, 0xB4, 0x28, 0x1C, 0x2C, 0x79, 0xC7, 0x68, 0xC9,
-    0x37, 0x6A, 0xAB, 0xDD, 0x57, 0xE4, 0x55, 0x10, 0x41, 0xB6, 0x9A, 0x8C, 0x5D, 0x93, 0x9B, 0x23,
-    0x34, 0x39, 0x7E, 0x20, 0x5F, 0x78, 0x68, 0x96, 0xF1, 0x10, 0x10, 0xB1, 0x2C, 0xAD, 0xEC, 0x8F,
-    0x1C, 0xC9, 0x05, 0x39, 0xE6, 0xFB, 0x6A, 0xB0, 0x42, 0x15, 0x45, 0xFF, 0x4A, 0xD6, 0x96, 0x70,
-    0x0F, 0xA6, 0xE9, 0xBF, 0x91, 0x17, 0xF2, 0x48, 0xFF, 0x31, 0xA6, 0x97, 0xDA, 0x89, 0xD9, 0xDD,
-    0xD4, 0x0D, 0xD1, 0xED, 0xB4, 0x16, 0x2C, 0xDC, 0xA5, 0x13, 0xA4, 0x87, 0x27, 0x47, 0xDC, 0x1B,
-    0x73, 0x0E, 0xEF, 0xE7, 0xF3, 0xDC, 0xCF, 0xBE, 0xAC, 0x14, 0x7C, 0x5F, 0x16, 0xF0, 0xC6, 0x2C,
-    0x87, 0x20, 0x4D, 0x2F, 0x40, 0xA8, 0xF5, 0xCE, 0x9B, 0xEE, 0xA6, 0x06, 0x9E, 0x9E, 0xD4, 0x8B,
-    0x4A, 0x56, 0x8F, 0x87, 0x0B, 0xCE, 0x0E, 0x52, 0x73, 0xAF, 0x35, 0x81, 0x16, 0x34, 0xD2, 0xEB,
-    0x90, 0x77, 0xA2, 0x79, 0xFE, 0x16, 0xF9, 0x07, 0x69, 0x28, 0x87, 0xD4, 0x66, 0x13, 0xA3, 0x07,
-    0x45, 0x98, 0x96, 0xE7, 0x99, 0x6F, 0x1A, 0xCC, 0xCE, 0xA0, 0x74, 0x0E, 0x22, 0x94, 0x9B, 0x00,
-    0xD7, 0x6C, 0xC6, 0xCA, 0x65, 0x77, 0x50, 0x66, 0xAE, 0x96, 0xD2, 0x05, 0x61, 0x22, 0x46, 0x52,
-    0xD2, 0x0C, 0xA6, 0xB5, 0x93, 0xF6, 0xBA, 0x18, 0xCD, 0x01, 0xC8, 0xFD, 0x12, 0xD2, 0xBA, 0x6B,
-    0xF4, 0x72, 0x09, 0xBD, 0x5D, 0x42, 0xE5, 0x4B, 0xF2, 0x9A, 0x46, 0x2E, 0xD5, 0x30, 0x7A, 0x41,
-    0x84, 0x04, 0x84, 0x46, 0x7B, 0xC8, 0xD5, 0x71, 0xF2, 0xDE, 0xAD, 0xD3, 0x2C, 0xD9, 0x85, 0x25,
-    0x5D, 0x09, 0x3C, 0xD4, 0xD1, 0xEE, 0x60, 0x99, 0xBB, 0xD4, 0x3A, 0xA6, 0x3A, 0xBA, 0xB5, 0xC8,
-    0x2E, 0xAE, 0xFF, 0x96, 0xF8, 0x9C, 0x99, 0x82, 0x3D, 0x04, 0x0A, 0x6C, 0x10, 0x13, 0xD8, 0x2A,
-    0x45, 0x13, 0xAD, 0xE1, 0xCB, 0xED, 0x56, 0xD2, 0x2D, 0xC4, 0x86, 0x7A, 0x81, 0x9D, 0xF8, 0xBF,
-    0x92, 0xB3, 0xF2, 0xBC, 0x8C, 0xA4, 0x04, 0x06, 0x02, 0x96, 0x1D, 0xC5, 0x4E, 0xA3, 0x0A, 0xD4,
-    0x75, 0x0E, 0x5C, 0xEC, 0x1C, 0x7F, 0x07, 0x4C, 0xEE, 0x68, 0xDA, 0x63, 0xA0, 0xE1, 0xFE, 0xF8,
-    0x20, 0xEA, 0xEC, 0xAE, 0x3A, 0xB9, 0xEF, 0x70, 0x01, 0xB8, 0x3D, 0x09, 0x90, 0xBC, 0xCB, 0x02,
-    0x1C, 0x68, 0xC5, 0x23, 0x9A, 0x8D, 0xF7, 0xDA, 0x90, 0x76, 0x29, 0xA2, 0xFD, 0x1A, 0xF3, 0x3F,
-    0x0B, 0x30, 0xDA, 0xEB, 0xAC, 0xBA, 0x68, 0x87, 0x66, 0x41, 0x6F, 0x77, 0xFE, 0x67, 0xBE, 0xF1,
-    0x66, 0x01, 0x4B, 0x33, 0xDD, 0xFD, 0x5B, 0xC1, 0xB0, 0xDE, 0x12, 0x0C, 0x1B, 0xFE, 0x29, 0x18,
-    0x66, 0x6D, 0x1A, 0xB9, 0x02, 0x8A, 0xE1, 0xE1, 0xB2, 0xD1, 0x6F, 0x53, 0xD9, 0xC4, 0xDB, 0xF7,
-    0xC7, 0xD6, 0xB9, 0xD5, 0x93, 0x0E, 0xD2, 0x4D, 0xC1, 0x66, 0xDA, 0x94, 0x9D, 0x14, 0xD1, 0x1F,
-    0xAF, 0xC4, 0x7E, 0x73, 0xD6, 0x58, 0xE7, 0x0F, 0x74, 0x12, 0xB0, 0x38, 0x4C, 0xFC, 0x2D, 0x53,
-    0x1D, 0x88, 0x5C, 0x8F, 0x6A, 0x70, 0x60, 0x4D, 0x79, 0xC2, 0x07, 0x98, 0x1D, 0x6A, 0x86, 0x5F,
-    0xBF, 0x8E, 0xFD, 0x18, 0x5B, 0xD7, 0x52, 0x73, 0xA2, 0xB2, 0xF1, 0x1C, 0x54, 0xCE, 0xC7, 0x58,
-    0xA9, 0xD2, 0x79, 0x3F, 0x45, 0xF4, 0x82, 0xA7, 0xF3, 0x5E, 0xE1, 0xBE, 0x95, 0xB9, 0x6F, 0xE5,
-    0xDE, 0x9B, 0x99, 0xFF, 0x58, 0xE6, 0xFF, 0x3C, 0x47, 0xB0, 0xE6, 0x9F, 0xCA, 0xD9, 0x6C, 0x6B,
-    0x15, 0x17, 0x69, 0x55, 0x8A, 0x82, 0x5D, 0xBC, 0x9F, 0xE6, 0xAC, 0xB6, 0x5C, 0x93, 0xEE, 0xE5,
-    0x26, 0x61, 0x83, 0x0C, 0x0C, 0xE8, 0x69, 0x69, 0x8F, 0x29, 0x28, 0x2C, 0x51, 0xBE, 0xE8, 0x33,
-    0x5A, 0x76, 0xBB, 0xEA, 0x6A, 0x77, 0x3B, 0x95, 0x7E, 0x95, 0xFF, 0xC3, 0xA5, 0x4E, 0x61, 0x78,
-    0x9D, 0xDA, 0xBE, 0x62, 0xBC, 0xB1, 0xFD, 0xA1, 0x09, 0x2E, 0x3A, 0xBF, 0x33, 0x3D, 0x3C, 0xE2,
-    0x41, 0xE9, 0xBE, 0x13, 0x97, 0x85, 0xF7, 0x8B, 0x17, 0x3E, 0x2A, 0xFC, 0xC7, 0x5F, 0x7C, 0x33,
-    0xF7, 0x9D, 0x77, 0x5E, 0xCC, 0x7C, 0xE7, 0x77, 0x08, 0x8B, 0x9C, 0xFF, 0xED, 0xA6, 0x27, 0x1C,
-    0x36, 0x1D, 0xDB, 0xA5, 0x57, 0x9F, 0x84, 0x29, 0x9F, 0x87, 0x19, 0x76, 0xBE, 0x52, 0x12, 0xEE,
-    0x02, 0x9B, 0x3B, 0xE2, 0x84, 0xC5, 0x07, 0xCB, 0xED, 0x6B, 0x01, 0xFD, 0xEF, 0x81, 0xBB, 0xD7,
-    0xBE, 0xAE, 0x8B, 0x18, 0x1F, 0x84, 0x7A, 0xF0, 0x40, 0x8E, 0xFF, 0x5F, 0x73, 0xB5, 0xE8, 0xED,
-    0x29, 0xA4, 0xE3, 0xF9, 0x43, 0x66, 0x52, 0x0F, 0x9C, 0xE9, 0xD9, 0xCA, 0xCB, 0xDD, 0x92, 0xC7,
-    0x5B, 0x43, 0xE9, 0x6B, 0x65, 0x36, 0x6E, 0xF5, 0x4A, 0x8D, 0x71, 0x5B, 0xDF, 0x8E, 0xEC, 0x2B,
-    0x71, 0xD8, 0xBC, 0x64, 0xBC, 0x69, 0xD0, 0xF6, 0x2C, 0x58, 0x7C, 0xF3, 0x1F, 0xCB, 0xDB, 0xC7,
-    0x9A, 0x95, 0xDC, 0x0D, 0x16, 0x49, 0x05, 0xE7, 0x0F, 0xF0, 0x5A, 0x26, 0xE1, 0xB6, 0xB0, 0x48,
-    0xB7, 0x57, 0xB7, 0x59, 0x21, 0x42, 0x3A, 0x16, 0x3B, 0x41, 0xB7, 0xB6, 0x61, 0x7C, 0x24, 0x82,
-    0xE5, 0xBF, 0x29, 0x28, 0x2B, 0x78, 0x54, 0x6B, 0x7E, 0x1A, 0xB2, 0x8F, 0xD5, 0x60, 0x54, 0x6E,
-    0x23, 0xE0, 0x4F, 0xB2, 0x5B, 0x5E, 0x06, 0xDB, 0x27, 0xEE, 0x34, 0xD1, 0x11, 0xA5, 0x9D, 0x7C,
-    0x67, 0xA2, 0xC1, 0xA6, 0x82, 0x26, 0x91, 0x33, 0x5E, 0xEB, 0xAC, 0xF6, 0x7E, 0x0B, 0xD3, 0x85,
-    0x9A, 0x92, 0xD8, 0x32, 0x52, 0x6D, 0x35, 0xC7, 0xB3, 0x67, 0xA0, 0xB9, 0x4D, 0x75, 0xAD, 0xC9,
-    0x9D, 0xFD, 0x9F, 0x36, 0xBF, 0x28, 0xBC, 0xDC, 0x97, 0x8C, 0xA0, 0x57, 0x58, 0xCC, 0x53, 0xE6,
-    0x8E, 0x9C, 0xA1, 0x0F, 0xB2, 0x9E, 0xDC, 0x16, 0x33, 0x94, 0x5C, 0xAC, 0xE0, 0x15, 0x36, 0x85,
-    0xC9, 0x93, 0x7D, 0x31, 0x03, 0x31, 0xAC, 0x5B, 0xEE, 0x95, 0x62, 0x3D, 0x8E, 0x9A, 0x13, 0xCC,
-    0x7D, 0x56, 0x27, 0xA9, 0x04, 0x7A, 0x80, 0xD1, 0x4D, 0xBE, 0x0F, 0xAB, 0x8D, 0x90, 0xF5, 0x7A,
-    0xD9, 0x5E, 0xA8, 0xD5, 0xF6, 0xD5, 0x2C, 0x15, 0x7D, 0x6F, 0x56, 0x30, 0xE7, 0xC1, 0x1E, 0x8E,
-    0x07, 0x66, 0x6F, 0x56, 0x88, 0x26, 0x5F, 0xDD, 0x50, 0x72, 0x17, 0x46, 0x8F, 0x86, 0xF8, 0xE9,
-    0x74, 0xF9, 0x2E, 0x0C, 0xC9, 0x5C, 0x32, 0xC9, 0xB7, 0x1F, 0xB2, 0x0B, 0x42, 0x3A, 0xD4, 0xD9,
-    0xF9, 0xDB, 0xB7, 0xF6, 0xA4, 0xF7, 0x81, 0xF7, 0x94, 0xED, 0xDE, 0x90, 0xE4, 0x7B, 0x60, 0xB5,
-    0x77, 0x41, 0xB1, 0x3B, 0x18, 0xB0, 0x78, 0x64, 0xC2, 0xDA, 0xD7, 0x1C, 0x62, 0x34, 0xBF, 0xF7,
-    0xCC, 0x9F, 0xBB, 0x3A, 0xB7, 0xBB, 0x73, 0x6A, 0x0D, 0x64, 0x6C, 0xC2, 0x51, 0x89, 0xCB, 0x0A,
-    0xF6, 0x29, 0x6C, 0x31, 0xB0, 0xD1, 0xAE, 0x91, 0x2E, 0x45, 0x4C, 0x59, 0xD3, 0xF7, 0xB0, 0x0F,
-    0x01, 0x12, 0x23, 0xB7, 0x91, 0xCE, 0xF4, 0x16, 0xEA, 0x76, 0xC6, 0x09, 0x35, 0x6D, 0x6A, 0xDC,
-    0xFF, 0x3C, 0x69, 0xF3, 0xA2, 0xDD, 0x45, 0xD3, 0x54, 0xC7, 0x26, 0xB5, 0xE9, 0x03, 0xF7, 0xCF,
-    0x26, 0x3C, 0x46, 0xDC, 0x6B, 0x9B, 0x07, 0xFB, 0x76, 0x25, 0x2D, 0x1B, 0x4B, 0xDC, 0xDF, 0x43,
-    0xD8, 0xD1, 0x6B, 0x1F, 0x66, 0x7B, 0xE5, 0x3A, 0xB3, 0xAF, 0x97, 0x1F, 0x11, 0x6E, 0x18, 0x4D,
-    0xF6, 0x3C, 0xDF, 0x6B, 0x2F, 0x00, 0xF8, 0xED, 0xE1, 0x73, 0x69, 0x02, 0xD3, 0x5E, 0xF8, 0x66,
-    0x56, 0xA6, 0xF9, 0x26, 0x87, 0x2A, 0x6D, 0x77, 0xDB, 0x45, 0xF5, 0x61, 0x95, 0xE2, 0xD2, 0x67,
-    0xEE, 0x3D, 0x48, 0xFB, 0xDD, 0x0A, 0x55, 0xE4, 0x01, 0xF9, 0x11, 0x19, 0x5A, 0x12, 0xA1, 0x3B,
-    0x75, 0xE1, 0x29, 0x4F, 0x72, 0x9F, 0x04, 0x51, 0x03, 0xBC, 0xBE, 0xBB, 0xB6, 0x60, 0xFF, 0x36,
-    0x5C, 0xBA, 0x83, 0x6F, 0x66, 0x72, 0x50, 0xF1, 0xB9, 0x9D, 0x5A, 0xE7, 0x97, 0x0E, 0x11, 0x25,
-    0x57, 0xEE, 0xC1, 0xE0, 0x11, 0xB5, 0x73, 0xEA, 0xC7, 0x8F, 0xC9, 0x09, 0xED, 0x6C, 0x29, 0xBD,
-    0x95, 0x77, 0x5D, 0x25, 0x97, 0x20, 0xE3, 0x3C, 0x34, 0xB4, 0xD9, 0x5D, 0xF3, 0xFE, 0xDC, 0xCE,
-    0x2B, 0x62, 0x85, 0x9E, 0x7B, 0xAD, 0x54, 0x98, 0xDD, 0x1D, 0x4E, 0x5F, 0x3A, 0xBD, 0x4B, 0xF5,
-    0x1A, 0xE1, 0xCF, 0x7F, 0x3E, 0x6B, 0xEF, 0x4C, 0xF4, 0x93, 0xD5, 0xEB, 0xE3, 0x17, 0xF7, 0xA8,
-    0x5F, 0xC2, 0x92, 0x32, 0xB5, 0x20, 0xD7, 0x42, 0x4A, 0x6F, 0x09, 0x0D, 0x3E, 0x9F, 0x6B, 0x1B,
-    0xF1, 0x37, 0xE3, 0xDA, 0x55, 0x5F, 0x52, 0x12, 0x79, 0x47, 0xD0, 0x57, 0x68, 0x75, 0x33, 0xFE,
-    0x2A, 0x14, 0x30, 0xFE, 0xA3, 0x12, 0xA7, 0x3C, 0x26, 0x07, 0xFD, 0x57, 0xD1, 0xC0, 0xDD, 0xE6,
-    0x5A, 0x50, 0xC2, 0xCF, 0x0B, 0x21, 0x6E, 0x7D, 0x41, 0xDA, 0xED, 0xE1, 0xFE, 0xC8, 0xDC, 0x0A,
-    0x88, 0x0D, 0x58, 0xB5, 0x00, 0x5F, 0xE6, 0x34, 0xD1, 0x6E, 0x7B, 0x26, 0xC6, 0x59, 0x3A, 0x39,
-    0xF0, 0xE5, 0x4E, 0x13, 0xDD, 0xD3, 0x5A, 0xD1, 0xBE, 0xB7, 0x6A, 0xAD, 0x79, 0xA1, 0xC6, 0x44,
-    0xEF, 0x26, 0xE3, 0xF9, 0x0B, 0x3D, 0x7B, 0xB1, 0xB8, 0xDF, 0x68, 0xB0, 0x74, 0xF7, 0xD7, 0x40,
-    0x4E, 0x2A, 0xDC, 0x78, 0xCA, 0xE8, 0xFF, 0xD3, 0xC3, 0x51, 0xAD, 0x11, 0x2A, 0x4E, 0x1A, 0xE1,
-    0xD3, 0x98, 0xE4, 0xBB, 0xE6, 0xAE, 0xF1, 0x73, 0x4F, 0x77, 0xA7, 0x07, 0xB6, 0xE7, 0x81, 0xA5,
-    0x66, 0xEA, 0xDB, 0xC6, 0xA7, 0x9B, 0xD2, 0x36, 0xBF, 0x41, 0x43, 0xBD, 0xDA, 0x33, 0xFD, 0xF5,
-    0x5E, 0x5C, 0x78, 0xA4, 0xD5, 0x05, 0x36, 0xBB, 0x2D, 0xA9, 0xC3, 0x6D, 0xB9, 0x1D, 0x46, 0xEE,
-    0xB6, 0xB3, 0xC4, 0x91, 0x6F, 0x9C, 0xB9, 0x2B, 0x37, 0xF9, 0x0B, 0x05, 0xF6, 0x0A, 0x05, 0x52,
-    0xDD, 0x64, 0x72, 0x90, 0x17, 0x88, 0xE2, 0xD3, 0x3D, 0x2D, 0x51, 0x89, 0xC5, 0xE3, 0x35, 0xC1,
-    0xF4, 0x27, 0x92, 0x8F, 0x0D, 0xC4, 0xAB, 0x88, 0xE7, 0x58, 0x50, 0x30, 0x6C, 0xCF, 0x89, 0xEA,
-    0xF9, 0x2B, 0x49, 0xF7, 0x09, 0x7E, 0x5B, 0x74, 0x2E, 0x6F, 0x75, 0xE7, 0xAC, 0xE4, 0x8C, 0x95,
-    0x9E, 0xAF, 0xD2, 0x43, 0x73, 0x65, 0xBF, 0x7B, 0x9C, 0x7E, 0xE0, 0xEE, 0xFD, 0xE3, 0x06, 0x2A,
-    0xDA, 0x65, 0xBF, 0xBD, 0xB4, 0x79, 0x95, 0x96, 0xBB, 0xB2, 0x38, 0xD6, 0x69, 0x48, 0xA2, 0xFB,
-    0xAE, 0x1C, 0x0B, 0xE4, 0x45, 0x49, 0x94, 0x32, 0x39, 0x6A, 0x18, 0x1F, 0xB9, 0x3B, 0x2B, 0xA4,
-    0x04, 0xBD, 0xB7, 0x4A, 0xD0, 0xC9, 0x25, 0x82, 0xEE, 0xCA, 0x32, 0x71, 0x72, 0x1A, 0x16, 0x38,
-    0x56, 0xA6, 0x70, 0x93, 0xEF, 0xAC, 0x18, 0x93, 0xAF, 0xEB, 0x2A, 0xDF, 0x23, 0xAD, 0x03, 0xA5,
-    0xCD, 0x58, 0xB2, 0x17, 0x5F, 0xF5, 0x3A, 0xB1, 0x2F, 0xD4, 0xA4, 0x9C, 0xFD, 0xE9, 0x06, 0xEF,
-    0xAD, 0x58, 0xFF, 0xE9, 0x90, 0xC9, 0x61, 0xBD, 0xF4, 0x71, 0xDB, 0x15, 0x7A, 0x8B, 0x86, 0xEA,
-    0x5B, 0x36, 0x91, 0xB3, 0x16, 0x7B, 0x93, 0xDF, 0x6B, 0x41, 0xB4, 0x02, 0x35, 0x71, 0x5E, 0x8E,
-    0x1C, 0x99, 0x3D, 0xE0, 0xC3, 0xEE, 0xF6, 0x6D, 0xBB, 0x6A, 0x88, 0x04, 0xFB, 0x48, 0x77, 0xF3,
-    0x0A, 0x00, 0xBA, 0x23, 0x57, 0x95, 0x69, 0x51, 0x42, 0xFF, 0x21, 0x90, 0x9D, 0x57, 0x97, 0x2F,
-    0x37, 0x5C, 0x74, 0x1D, 0xCD, 0x5B, 0x0C, 0xD6, 0xF7, 0xCF, 0xE8, 0x71, 0x07, 0x0D, 0x55, 0x0E,
-    0xDC, 0x58, 0x7D, 0xE8, 0x2D, 0x7F, 0xFC, 0x58, 0xB8, 0xE8, 0x4C, 0x98, 0x7F, 0x82, 0xFF, 0x76,
-    0x80, 0x6A, 0xCE, 0x4F, 0xDA, 0xBB, 0xDC, 0xB6, 0x79, 0x28, 0xD2, 0x6C, 0xED, 0x24, 0x07, 0xEF,
-    0x18, 0x66, 0xB3, 0x11, 0x5B, 0xBD, 0x0E, 0xFD, 0x27, 0x41, 0xEA, 0xF6, 0x82, 0xBE, 0xA5, 0xD3,
-    0xFC, 0xFF, 0x26, 0xD7, 0x1E, 0x8C, 0x87, 0xBF, 0x9E, 0x96, 0x8F, 0x74, 0xDE, 0xF2, 0xB1, 0x68,
-    0xAB, 0x24, 0xAB, 0x1C, 0x46, 0x7A, 0x39, 0xAC, 0x73, 0x34, 0x48, 0xF7, 0xC7, 0x12, 0xBD, 0x6B,
-    0x83, 0xAC, 0xB4, 0xCA, 0xFA, 0xBF, 0xC8, 0xDA, 0x6E, 0x5A, 0xC9, 0x96, 0x4B, 0x23, 0x98, 0xA6,
-    0xF9, 0xF8, 0x5D, 0xC0, 0x4D, 0x18, 0x8A, 0x24, 0x48, 0x15, 0x46, 0xEA, 0xB7, 0xBC, 0x3E, 0x38,
-    0xD6, 0x7E, 0xE6, 0x8B, 0x2B, 0x7D, 0x1F, 0xFF, 0x9A, 0x0F, 0x39, 0xA8, 0xF3, 0x60, 0xFC, 0x65,
-    0x98, 0x96, 0x33, 0x0A, 0x12, 0xC5, 0x4A, 0xFF, 0x91, 0x30, 0x4D, 0xB5, 0xFA, 0x82, 0x77, 0xA4,
-    0x2F, 0xD8, 0x8A, 0x94, 0xAD, 0xF2, 0x20, 0x5B, 0x16, 0xF3, 0x7D, 0xFA, 0xCF, 0xB3, 0xDC, 0x82,
-    0xAD, 0x8C, 0x6C, 0xE5, 0xE6, 0xFF, 0x02, 0xCD, 0x9A, 0x3F, 0x6C, 0x23, 0xC7, 0x15, 0xC6, 0xDF,
-    0xEE, 0x4A, 0xDA, 0x44, 0x84, 0xBD, 0x82, 0xA1, 0x00, 0x87, 0x38, 0x3A, 0x06, 0x81, 0x0B, 0xDB,
-    0xC9, 0xDD, 0xA6, 0x48, 0xE1, 0x42, 0x24, 0x37, 0x49, 0x91, 0x2E, 0x16, 0x10, 0xBB, 0xBE, 0x94,
-    0xEE, 0xAE, 0x71, 0x71, 0x05, 0x29, 0x6D, 0x9F, 0xE2, 0xAE, 0x4B, 0x69, 0x15, 0x2E, 0x92, 0x34,
-    0xA7, 0xE2, 0x8A, 0x2B, 0x28, 0x91, 0x01, 0xD2, 0x87, 0x80, 0x91, 0x7E, 0x93, 0x1C, 0x90, 0x22,
-    0x85, 0x36, 0x00, 0x03, 0xD0, 0x08, 0xC9, 0xCD, 0xF7, 0xBD, 0x37, 0xBB, 0x5C, 0xE9, 0x5A, 0x2E,
-    0xC9, 0x3D, 0x71, 0x8E, 0x94, 0x96, 0x33, 0xEF, 0xFD, 0xE6, 0xCD, 0xFB, 0x33, 0xB3, 0x22, 0xDE,
-    0x54, 0x44, 0x82, 0x19, 0x9A, 0x16, 0x9B, 0x68, 0x88, 0x26, 0xEE, 0xA3, 0xE9, 0xB0, 0x99, 0x9F,
-    0x0A, 0xEE, 0xE8, 0xE0, 0x8E, 0x1C, 0x4D, 0x38, 0xE9, 0xE2, 0x8E, 0x14, 0x4D, 0x5B, 0x62, 0x91,
-    0x5E, 0x51, 0x88, 0x8C, 0xD8, 0x2C, 0xFF, 0xF4, 0x52, 0xFC, 0x5C, 0xDA, 0x49, 0x90, 0x49, 0x94,
-    0x44, 0x63, 0xDC, 0xD4, 0x4E, 0xD1, 0xF4, 0x70, 0xFB, 0x78, 0x80, 0xAE, 0xC7, 0xB2, 0xBA, 0x42,
-    0x7E, 0x68, 0x4D, 0xCA, 0x77, 0x7A, 0xBD, 0x9F, 0x7D, 0x28, 0xA3, 0x79, 0x3F, 0x58, 0x3C, 0x99,
-    0xB5, 0xB2, 0x70, 0x1A, 0x8D, 0x83, 0x3C, 0xC6, 0x98, 0x3D, 0x09, 0xB2, 0x2E, 0x5E, 0x03, 0x0C,
-    0x3D, 0x44, 0x2F, 0x43, 0x74, 0x37, 0x94, 0x38, 0xED, 0xCB, 0x45, 0xD2, 0xF3, 0x6F, 0x93, 0xB8,
-    0x78, 0x2E, 0xAD, 0x45, 0x5B, 0x24, 0x71, 0xFD, 0xE4, 0x22, 0x3E, 0x14, 0xF2, 0xF2, 0x6A, 0xB4,
-    0x3F, 0xB2, 0x29, 0x38, 0x50, 0x30, 0x2E, 0x87, 0xBC, 0xE0, 0xED, 0xAF, 0xDC, 0xFD, 0x76, 0x6D,
-    0x0C, 0xC3, 0x12, 0xDD, 0xBD, 0x1C, 0x9B, 0x34, 0xFC, 0x3C, 0x72, 0x52, 0x5C, 0xAE, 0x15, 0x04,
-    0x04, 0xA0, 0x16, 0x29, 0x9A, 0xC5, 0x23, 0x34, 0x7E, 0x71, 0x44, 0xD5, 0x7E, 0xC7, 0x5F, 0x74,
-    0xFC, 0xFA, 0x6C, 0x54, 0xCA, 0x9B, 0xF6, 0xA6, 0xBE, 0xE9, 0x6F, 0x00, 0x8C, 0x80, 0x22, 0x30,
-    0x06, 0x06, 0xC1, 0x28, 0x18, 0x06, 0xE3, 0x60, 0x20, 0x8C, 0x84, 0xA2, 0x30, 0x16, 0xA2, 0x30,
-    0x44, 0x69, 0x88, 0xE2, 0x10, 0xE5, 0x21, 0x95, 0x5D, 0xF8, 0x2F, 0xC4, 0xDE, 0x5E, 0x3F, 0xA6,
-    0xA4, 0x1F, 0xE0, 0xC3, 0x5F, 0xA1, 0xC7, 0x23, 0xCA, 0x79, 0x54, 0x4D, 0x2D, 0xC9, 0x10, 0x8D,
-    0x90, 0x8D, 0x10, 0x8E, 0x90, 0x8E, 0x10, 0x8F, 0x90, 0x8F, 0x10, 0x90, 0x90, 0x90, 0x10, 0x91,
-    0x90, 0x91, 0x10, 0x92, 0x90, 0x92, 0x10, 0x93, 0x90, 0x93, 0x81, 0xB2, 0x7E, 0xD5, 0x26, 0x7C,
-    0xDA, 0xA2, 0x5C, 0x2D, 0xD0, 0xBC, 0x57, 0x94, 0x98, 0xEE, 0x51, 0xDA, 0x90, 0x7D, 0xF8, 0xA9,
-    0x13, 0x27, 0xBF, 0x16, 0xF9, 0x51, 0x61, 0x24, 0x08, 0xA2, 0xE4, 0xB0, 0xAE, 0x85, 0xA2, 0x57,
-    0xCF, 0x18, 0xA4, 0x3A, 0xEF, 0x7C, 0xBF, 0xF8, 0x44, 0x6D, 0x45, 0x76, 0xD7, 0x56, 0x4C, 0xEE,
-    0x4A, 0xEC, 0x10, 0x52, 0x5F, 0x77, 0x9C, 0x7D, 0x6F, 0xCC, 0x6A, 0xE0, 0x63, 0xDE, 0x81, 0x58,
-    0x05, 0x14, 0xFF, 0x41, 0x6B, 0x5A, 0x4A, 0xB5, 0x28, 0xD9, 0x6D, 0xD1, 0x7E, 0xC4, 0xBF, 0xFC,
-    0xAE, 0x44, 0xCB, 0xBE, 0x9C, 0xB4, 0xA7, 0x72, 0x4C, 0x69, 0xAF, 0x4D, 0xA8, 0x66, 0xEC, 0xE8,
-    0x98, 0x0D, 0x3D, 0x5A, 0x40, 0xBD, 0x23, 0xD3, 0x7B, 0x52, 0xE7, 0xBF, 0x1B, 0xE1, 0x45, 0x05,
-    0x5D, 0x9A, 0x98, 0x94, 0xB2, 0x13, 0x4C, 0xD6, 0xBE, 0xA2, 0xDE, 0x0E, 0x3D, 0x3E, 0x9D, 0x70,
-    0x8B, 0x66, 0xFA, 0x10, 0xAF, 0x07, 0x47, 0xBF, 0xC5, 0x1B, 0x2F, 0xA3, 0xE1, 0x40, 0x30, 0x7F,
-    0x29, 0xDB, 0xB0, 0x0F, 0xF1, 0x2E, 0x0D, 0x0C, 0x44, 0xDA, 0xFB, 0xE0, 0x4C, 0x4E, 0x20, 0x50,
-    0x74, 0x3B, 0x96, 0x90, 0x13, 0x78, 0xB6, 0xC6, 0x18, 0xA4, 0x9E, 0xD5, 0xD3, 0x30, 0xF4, 0x25,
-    0xB5, 0x3F, 0xBE, 0xA3, 0x7D, 0xB0, 0x1D, 0xED, 0xE9, 0x5E, 0x55, 0xA6, 0x2B, 0x68, 0x7F, 0xDC,
-    0xA0, 0xF6, 0x74, 0x58, 0xE8, 0x2A, 0x71, 0x2E, 0x4A, 0xE8, 0xF8, 0x1E, 0xFC, 0x70, 0x27, 0x0C,
-    0xE0, 0x23, 0x74, 0xF7, 0xD4, 0xC9, 0x85, 0x78, 0xBB, 0xF7, 0xD3, 0x06, 0x31, 0xF8, 0x6F, 0x4E,
-    0x9C, 0x9F, 0xFC, 0x49, 0xAB, 0x5C, 0x17, 0x0F, 0x64, 0x27, 0x2C, 0xE1, 0xF2, 0x1D, 0xF5, 0x93,
-    0x8F, 0xE8, 0x27, 0xBD, 0x44, 0xF6, 0xA4, 0x8E, 0x21, 0xA1, 0x0B, 0x5B, 0x1F, 0x86, 0xEF, 0xDC,
-    0x55, 0x59, 0xFB, 0x2F, 0x07, 0xD8, 0x15, 0x17, 0x49, 0x19, 0x29, 0x22, 0x25, 0x54, 0x01, 0xCF,
-    0x9A, 0xCD, 0xCC, 0x2F, 0x8A, 0x39, 0x24, 0x9F, 0xCB, 0xE2, 0xF3, 0xCF, 0x64, 0x6A, 0x10, 0xFC,
-    0xDC, 0x5E, 0x4C, 0x5E, 0xE1, 0xA0, 0x21, 0x46, 0x91, 0xB6, 0x8A, 0x22, 0x89, 0xFE, 0xF6, 0xB9,
-    0xA6, 0xB2, 0xC8, 0x0C, 0x84, 0x31, 0x38, 0x76, 0x0B, 0x8A, 0xAF, 0x73, 0x7C, 0xBD, 0xEC, 0xAA,
-    0xBA, 0xD8, 0xDF, 0xAC, 0x96, 0xDD, 0xBF, 0x3F, 0x23, 0x25, 0x09, 0xBE, 0x8D, 0xD3, 0xD6, 0x24,
-    0x4A, 0xF9, 0x2F, 0x06, 0xAA, 0xAE, 0x77, 0x83, 0xEF, 0xCE, 0xF0, 0x4A, 0x19, 0x26, 0x65, 0xE8,
-    0x5E, 0x03, 0x4D, 0x8D, 0x1E, 0x48, 0x1B, 0x7D, 0x86, 0x45, 0xE6, 0xC2, 0x9C, 0xC9, 0x7E, 0xD7,
-    0xC5, 0x7F, 0x0C, 0x89, 0x2E, 0x26, 0xE6, 0x53, 0xE8, 0xED, 0x91, 0x35, 0x08, 0x73, 0x9F, 0x9F,
-    0x35, 0xA7, 0xA3, 0x0F, 0x5D, 0x7C, 0x16, 0x0D, 0x91, 0xE6, 0x52, 0xE2, 0xCD, 0x2D, 0x63, 0x2C,
-    0xD3, 0x8D, 0xB5, 0xE8, 0x7A, 0xB6, 0x2F, 0xE1, 0xFC, 0x5D, 0x89, 0x46, 0x73, 0x2C, 0xDC, 0x29,
-    0x16, 0x47, 0xD2, 0x98, 0x3E, 0xFB, 0x58, 0x08, 0xBD, 0x49, 0x8E, 0x0F, 0x99, 0x64, 0x17, 0xA9,
-    0x24, 0x7B, 0x6B, 0x9D, 0x33, 0x5D, 0x5B, 0x90, 0xAB, 0xF7, 0x29, 0x04, 0x29, 0xFE, 0x82, 0x0F,
-    0xDF, 0x4C, 0xC8, 0xEE, 0xAA, 0xEE, 0x74, 0x28, 0x8C, 0x49, 0x43, 0xCD, 0xF4, 0x3B, 0xBA, 0x28,
-    0xA9, 0x98, 0x35, 0x5A, 0x4F, 0x05, 0xBA, 0x62, 0xA0, 0xA0, 0x50, 0x43, 0xA1, 0x8A, 0x56, 0x62,
-    0x51, 0x49, 0xD5, 0x52, 0xD5, 0x54, 0x1D, 0xAD, 0xA1, 0xA6, 0xB5, 0xDE, 0x71, 0x1D, 0xA6, 0x6E,
-    0xDA, 0xA6, 0x58, 0xDC, 0xE1, 0x1C, 0x95, 0x4F, 0x1B, 0x4E, 0x58, 0x9E, 0x31, 0xFD, 0x5E, 0xE5,
-    0xE6, 0x54, 0x9E, 0xDA, 0xAB, 0xFA, 0x42, 0xFD, 0x85, 0x00, 0x84, 0x04, 0x84, 0x08, 0x94, 0x81,
-    0x42, 0x50, 0x0A, 0x8A, 0xC0, 0x9A, 0x81, 0x38, 0x12, 0x8A, 0xC2, 0x58, 0x28, 0x0C, 0x8D, 0x7B,
-    0x2C, 0x7A, 0x4F, 0x91, 0xF6, 0xEF, 0x61, 0x95, 0x93, 0x44, 0x1D, 0x44, 0x03, 0xB3, 0x7B, 0xE8,
-    0x12, 0x20, 0xFF, 0xCF, 0xE8, 0xEC, 0xF7, 0x73, 0x53, 0x96, 0xBA, 0x26, 0xEB, 0x5D, 0x99, 0x5A,
-    0x86, 0xE8, 0x02, 0xA0, 0x92, 0x07, 0x78, 0xD7, 0xFB, 0xB5, 0x2B, 0xFB, 0xB7, 0x3C, 0xDF, 0x65,
-    0x61, 0x10, 0x69, 0x16, 0xE8, 0x4D, 0x5F, 0x63, 0xD2, 0x93, 0x46, 0x30, 0x78, 0xDF, 0x22, 0xA2,
-    0x07, 0xC5, 0x2D, 0x88, 0xFB, 0xF3, 0x3B, 0x15, 0x1E, 0xAD, 0x64, 0xAB, 0x18, 0x0E, 0x5E, 0x7C,
-    0x28, 0xF1, 0xE2, 0x95, 0x7C, 0xF2, 0x34, 0x93, 0x23, 0xCF, 0x46, 0x09, 0x9B, 0xB2, 0x86, 0x7D,
-    0xA7, 0x36, 0x2D, 0xFC, 0x9F, 0x0C, 0x86, 0x39, 0xFC, 0xD7, 0xD1, 0xC6, 0x63, 0x0E, 0xE3, 0x27,
-    0xE7, 0xA1, 0x85, 0xD9, 0x8F, 0xD1, 0xC3, 0x6B, 0xAC, 0x83, 0xC4, 0x4B, 0x9A, 0x8D, 0x47, 0x7F,
-    0xC0, 0x07, 0xC6, 0x6E, 0xAE, 0x39, 0x7A, 0x94, 0x1B, 0x5B, 0x11, 0xDE, 0xC4, 0x59, 0x03, 0x3C,
-    0xCA, 0xC5, 0x92, 0x59, 0x84, 0x25, 0x04, 0x7C, 0xDD, 0x57, 0xB2, 0xE7, 0x94, 0x64, 0xD9, 0xDE,
-    0x77, 0x02, 0xCC, 0x9C, 0x7E, 0x35, 0x5E, 0xF1, 0x92, 0x38, 0x79, 0x7F, 0x2A, 0x3F, 0xCE, 0xE8,
-    0x5C, 0x40, 0x0F, 0xEF, 0x4F, 0xCB, 0xE0, 0xF7, 0x35, 0xBF, 0x82, 0x6F, 0xE0, 0x66, 0xFC, 0x04,
-    0xFA, 0x77, 0x64, 0x1B, 0x18, 0xD2, 0xAA, 0x7B, 0x8C, 0xD9, 0xD6, 0x11, 0xBB, 0x36, 0x56, 0x13,
-    0xB2, 0xB9, 0x8B, 0x34, 0xE8, 0x1D, 0xA2, 0xAA, 0x28, 0xD5, 0xCF, 0xF8, 0x39, 0x2C, 0x6F, 0xF9,
-    0x48, 0x3B, 0x1D, 0x68, 0x97, 0x43, 0xED, 0x74, 0x4A, 0xAC, 0x94, 0xFC, 0x9E, 0xF0, 0xE9, 0xAA,
-    0x9B, 0xC7, 0x2A, 0x51, 0xA7, 0xB6, 0xA2, 0xFC, 0xE2, 0x0D, 0x86, 0x2F, 0x30, 0x7E, 0xF1, 0xF3,
-    0x51, 0x8A, 0x9C, 0x2E, 0x1A, 0xB7, 0x32, 0x09, 0x33, 0x0C, 0x85, 0xB4, 0x29, 0xD1, 0xBC, 0x09,
-    0x9D, 0x9E, 0xB3, 0x61, 0x61, 0x9E, 0x0F, 0x99, 0xD7, 0xCD, 0x5D, 0x13, 0x66, 0xB4, 0x97, 0xC9,
-    0x5C, 0x34, 0x97, 0x42, 0x32, 0x71, 0xCE, 0x01, 0x7A, 0x89, 0xB7, 0x90, 0x76, 0x86, 0xDC, 0x10,
-    0x76, 0x09, 0x38, 0x23, 0x26, 0xCC, 0x5E, 0x15, 0x2B, 0xDA, 0xD5, 0x86, 0xC8, 0xE3, 0x55, 0xF8,
-    0x78, 0xE3, 0xEC, 0xEB, 0xE9, 0xB8, 0x35, 0x09, 0xB3, 0x76, 0xCA, 0x9C, 0xCD, 0xCF, 0xBB, 0x78,
-    0x0D, 0xF0, 0xEA, 0x63, 0xB8, 0x21, 0xB4, 0x1A, 0x02, 0x76, 0x1F, 0x63, 0x9D, 0xC3, 0xF6, 0x7A,
-    0xC9, 0x0D, 0x52, 0xBF, 0x19, 0x34, 0x98, 0xAC, 0xD4, 0x79, 0xCD, 0xFC, 0xD3, 0x05, 0x51, 0xBD,
-    0x0E, 0xB8, 0x4B, 0xD9, 0x52, 0xAB, 0x57, 0xB5, 0x99, 0xEB, 0x04, 0xFC, 0x6B, 0x48, 0x7F, 0xD0,
-    0xDA, 0x0E, 0x06, 0x8F, 0xFE, 0xF5, 0x65, 0x62, 0x42, 0x70, 0x72, 0x96, 0x2E, 0x0E, 0x4C, 0xD6,
-    0x4A, 0x43, 0x7D, 0x9C, 0x9A, 0x5D, 0xF8, 0x77, 0xF6, 0xDE, 0xFE, 0x2F, 0x07, 0xEF, 0xF7, 0x75,
-    0x03, 0xF1, 0xE4, 0xDE, 0x2E, 0x99, 0x12, 0x30, 0x04, 0xCA, 0x40, 0x14, 0x82, 0x28, 0x05, 0x51,
-    0x0C, 0xA2, 0x1C, 0x44, 0x41, 0x88, 0x92, 0xD0, 0xAD, 0x9A, 0x5C, 0x94, 0x85, 0xCC, 0xCB, 0x16,
-    0xF7, 0x2B, 0x0E, 0x51, 0x1E, 0xA2, 0x40, 0x44, 0x89, 0x18, 0x12, 0x63, 0xE2, 0xA0, 0x18, 0x95,
-    0xCA, 0x3A, 0x0E, 0x34, 0xD9, 0xC0, 0x87, 0x19, 0x26, 0x2A, 0x58, 0xA0, 0x08, 0x89, 0x9E, 0x30,
-    0xD9, 0x08, 0x35, 0xD9, 0x48, 0x6A, 0xD6, 0xE2, 0x92, 0x8D, 0xA7, 0x10, 0x11, 0x88, 0x84, 0x8C,
-    0x84, 0x90, 0x84, 0x94, 0x84, 0x98, 0x84, 0x9C, 0x84, 0xA0, 0x84, 0xA4, 0x84, 0xA8, 0x84, 0xAC,
-    0x84, 0xB0, 0x94, 0x56, 0x1D, 0xD7, 0xA9, 0xB8, 0xA0, 0x27, 0xE1, 0xAF, 0xE8, 0x81, 0x9E, 0x4C,
-    0x1D, 0xAC, 0x7B, 0xAC, 0x36, 0x6A, 0x2A, 0x87, 0xCE, 0x52, 0xBD, 0x09, 0x84, 0xFD, 0xCD, 0xC2,
-    0x70, 0x90, 0x46, 0x09, 0x63, 0x5D, 0x0B, 0x47, 0x2C, 0x4F, 0x47, 0xD9, 0xCB, 0xE6, 0x19, 0x46,
-    0xFD, 0x07, 0xFE, 0xDA, 0xDE, 0x05, 0x06, 0xE5, 0x75, 0x23, 0xE5, 0x8A, 0xE5, 0x2C, 0xCD, 0x9E,
-    0xD1, 0x40, 0x8E, 0x36, 0x68, 0x20, 0x10, 0x14, 0xC9, 0xC8, 0xE8, 0x7F, 0xF8, 0x05, 0xD3, 0x7E,
-    0x57, 0x98, 0xEA, 0xC2, 0x5A, 0x61, 0x7A, 0xB8, 0x3D, 0x4C, 0x07, 0x2F, 0x10, 0x70, 0x17, 0xAF,
-    0xE5, 0x34, 0xCE, 0x91, 0xB3, 0x24, 0x1A, 0x13, 0x82, 0xCA, 0x64, 0xD2, 0xF5, 0x9A, 0x8C, 0x8E,
-    0xA8, 0x3B, 0x24, 0x31, 0x95, 0x1F, 0x52, 0xF9, 0xEC, 0x21, 0x7F, 0xBF, 0xBF, 0x5B, 0x91, 0xA5,
-    0xCC, 0x6A, 0x42, 0xDC, 0xDA, 0x86, 0xE1, 0xF4, 0x11, 0x15, 0xCF, 0xD6, 0xBC, 0x78, 0xDE, 0x8A,
-    0x3A, 0xF2, 0x3D, 0x6D, 0xAF, 0x6B, 0xC7, 0x0F, 0x7A, 0xBB, 0x05, 0xE2, 0xBD, 0x92, 0x10, 0xC2,
-    0x75, 0x91, 0xD1, 0x2C, 0x8B, 0x25, 0xCC, 0x0F, 0x98, 0xBE, 0x52, 0x4E, 0x8B, 0x0D, 0x7B, 0x5D,
-    0xFD, 0x4F, 0x8B, 0x91, 0xB8, 0x0C, 0x18, 0x96, 0xA0, 0x25, 0xBE, 0x16, 0xA3, 0x39, 0x40, 0xA1,
-    0xFB, 0x51, 0xF1, 0xE9, 0x18, 0xA8, 0x96, 0x5C, 0x4F, 0xF9, 0x3A, 0xD6, 0xD3, 0x67, 0x52, 0xD5,
-    0x80, 0x2E, 0x27, 0x69, 0x57, 0xD9, 0xCF, 0x6A, 0x5A, 0x77, 0x84, 0xD2, 0x7E, 0x55, 0xB1, 0xE9,
-    0x0E, 0x94, 0xEE, 0x94, 0xDB, 0x84, 0x1F, 0x35, 0x4B, 0x49, 0x33, 0x18, 0x97, 0xC2, 0x38, 0x4C,
-    0x1A, 0xAA, 0x34, 0x8B, 0xB1, 0x34, 0xA6, 0xCA, 0x63, 0x76, 0x84, 0x95, 0xE6, 0x37, 0x9A, 0xE0,
-    0x98, 0x7C, 0x6A, 0xF6, 0xCB, 0xB2, 0xD8, 0x95, 0x49, 0xB3, 0xC0, 0xD4, 0xF7, 0xF9, 0x05, 0x23,
-    0x42, 0x70, 0xAB, 0xA7, 0x5B, 0xFE, 0x42, 0x57, 0xDD, 0xD1, 0x8E, 0x19, 0x14, 0xE4, 0x89, 0xB3,
-    0x2B, 0x66, 0xFE, 0x58, 0x6D, 0x79, 0x0F, 0x66, 0x95, 0x78, 0xCD, 0xA2, 0x91, 0x1D, 0xF3, 0x3C,
-    0x35, 0x9B, 0x3E, 0x5F, 0x59, 0xF6, 0x3D, 0x59, 0x1B, 0x27, 0x92, 0x97, 0xA3, 0xAC, 0xCA, 0x52,
-    0x2C, 0x6F, 0x3F, 0x67, 0x15, 0x95, 0xC3, 0x71, 0x07, 0x19, 0x96, 0x7C, 0x30, 0x41, 0x2D, 0x15,
-    0x8E, 0x99, 0x12, 0x8F, 0x6D, 0x73, 0x2B, 0xE1, 0x8E, 0x35, 0xB3, 0xD5, 0x98, 0x8E, 0xB3, 0xEB,
-    0x9A, 0x2E, 0x6B, 0xB2, 0x0E, 0x9D, 0x68, 0xDF, 0x4A, 0x33, 0x2D, 0xCE, 0x86, 0x0C, 0x03, 0x03,
-    0xC5, 0x99, 0xC6, 0x63, 0xD4, 0xC5, 0xA8, 0x79, 0x43, 0xCA, 0x22, 0xFB, 0x77, 0x39, 0x5C, 0x97,
-    0x1E, 0x58, 0xDC, 0x73, 0x06, 0x5F, 0xF0, 0x98, 0x17, 0xE3, 0xCF, 0x30, 0xFC, 0x34, 0x4A, 0xBD,
-    0x3C, 0x4A, 0xFC, 0x9C, 0x9B, 0xE6, 0x31, 0xE4, 0xEA, 0xE9, 0xF6, 0x7A, 0x6B, 0xDC, 0xD1, 0x2D,
-    0x73, 0xDB, 0xCB, 0x3E, 0xF7, 0x6F, 0x93, 0x5E, 0xF1, 0x1C, 0x93, 0xB9, 0xDA, 0xCB, 0x7E, 0xBB,
-    0xEE, 0xFE, 0xBE, 0x26, 0xDA, 0xFA, 0xF1, 0x55, 0xE9, 0xC9, 0x5A, 0x99, 0x3B, 0xF8, 0x93, 0x93,
-    0x2D, 0x61, 0xB8, 0xA9, 0x3D, 0x6A, 0x42, 0x37, 0x7B, 0x61, 0x07, 0x5F, 0xEE, 0x51, 0x93, 0x35,
-    0xD1, 0xB0, 0xBD, 0x88, 0x79, 0x65, 0x5B, 0x5A, 0xC0, 0xBB, 0xD4, 0xBF, 0x8A, 0xCD, 0x32, 0x54,
-    0xDD, 0xE7, 0x54, 0xFE, 0x3F, 0x53, 0x6A, 0xFF, 0x2F, 0x55, 0xBF, 0x48, 0xA8, 0xFF, 0x1B, 0x2D,
-    0x8D, 0xAC, 0xB6, 0xD6, 0xF2, 0x9A, 0x87, 0xFF, 0x5A, 0xB8, 0xC4, 0xE5, 0x0E, 0x81, 0xB5, 0x5D,
-    0x31, 0x0E, 0x06, 0xC2, 0xD5, 0xEA, 0x56, 0xAE, 0x2B, 0x0B, 0x98, 0x26, 0x60, 0x90, 0x06, 0xB3,
-    0x6D, 0xE2, 0x80, 0x75, 0xCE, 0x64, 0x65, 0x17, 0xDE, 0x59, 0x95, 0x65, 0xDA, 0x16, 0x96, 0xED,
-    0x57, 0x69, 0xCA, 0x41, 0x85, 0xDA, 0x89, 0x55, 0x7A, 0x64, 0xD3, 0xD5, 0x47, 0x02, 0xE6, 0x24,
-    0x57, 0x64, 0x14, 0x6F, 0xC9, 0xEF, 0x70, 0xCE, 0x49, 0x49, 0xEC, 0xA8, 0x85, 0xCF, 0x11, 0x64,
-    0x5C, 0x9C, 0xD4, 0xBA, 0xAB, 0x9B, 0x16, 0x1D, 0x8D, 0x6B, 0x03, 0x3D, 0x0B, 0xD0, 0x47, 0x08,
-    0x84, 0xD4, 0xB8, 0xC1, 0xF1, 0x9C, 0xA3, 0xEA, 0x53, 0x04, 0xA5, 0x25, 0x9D, 0xAD, 0xE0, 0xDD,
-    0x8D, 0xD9, 0x89, 0xDB, 0xA6, 0xD8, 0x25, 0x7A, 0xE6, 0x65, 0x6C, 0x7A, 0x83, 0xBC, 0xDA, 0x5D,
-    0x2F, 0x17, 0xD8, 0xDE, 0xC6, 0xE9, 0xE9, 0x5E, 0xBA, 0x95, 0x0B, 0xE5, 0x14, 0xEA, 0xEA, 0xD3,
-    0x95, 0x27, 0xEF, 0x4A, 0x7D, 0xED, 0xED, 0x8A, 0x05, 0x6A, 0xD9, 0xA5, 0xAB, 0xD2, 0x1D, 0x91,
-    0xBB, 0x23, 0xB8, 0x8B, 0x95, 0xF8, 0x58, 0x9F, 0x1B, 0xB7, 0x43, 0x9A, 0x9A, 0xBF, 0x64, 0x90,
-    0x0F, 0xF5, 0x91, 0x9C, 0x28, 0x98, 0xD7, 0x83, 0xFC, 0xCE, 0x58, 0xE0, 0xB1, 0x4E, 0x38, 0x9F,
-    0x52, 0xEA, 0x32, 0xCC, 0xCB, 0x97, 0xBC, 0x93, 0x7B, 0xCA, 0x9B, 0x26, 0x26, 0x3B, 0x66, 0x57,
-    0x35, 0x17, 0x72, 0x2D, 0x77, 0xA2, 0x5E, 0xFD, 0xDA, 0x0A, 0x25, 0x5D, 0x9F, 0xBA, 0x37, 0x5E,
-    0xDB, 0x1D, 0x77, 0x92, 0xD3, 0x09, 0xB3, 0x53, 0x2D, 0xE8, 0xF2, 0xEA, 0x54, 0x1C, 0x8A, 0x0C,
-    0xBB, 0xF8, 0x0E, 0x4F, 0x9A, 0xDB, 0x3C, 0xFF, 0x4A, 0xB8, 0x47, 0xDE, 0xD3, 0x73, 0xE6, 0x70,
-    0x3C, 0x93, 0xE0, 0x9B, 0x5C, 0x82, 0x7F, 0x8F, 0xC1, 0x20, 0x11, 0xAF, 0x70, 0x2E, 0xB4, 0xDC,
-    0x09, 0xAE, 0xEF, 0xE8, 0x67, 0xAB, 0x0D, 0x65, 0x57, 0x21, 0x0D, 0x2A, 0xAF, 0x1F, 0xAD, 0x56,
-    0x5F, 0x29, 0xEE, 0x17, 0xE2, 0x5F, 0x42, 0x29, 0x7C, 0x65, 0x40, 0x2D, 0x3B, 0x7A, 0xDC, 0xC6,
-    0xD4, 0xAB, 0x4B, 0x9E, 0x31, 0x87, 0x88, 0x95, 0x0D, 0x3B, 0x8E, 0x74, 0x8B, 0x5A, 0xF7, 0xA8,
-    0xF9, 0x3C, 0x45, 0x34, 0x28, 0x0B, 0x8B, 0x50, 0x77, 0x44, 0xF3, 0xD2, 0x59, 0x6A, 0xA0, 0x89,
-    0xCB, 0xAC, 0x8C, 0xE7, 0xB5, 0x32, 0xE2, 0x1F, 0x47, 0x69, 0x63, 0x9A, 0xBA, 0x13, 0x31, 0x6E,
-    0x9D, 0xA7, 0x65, 0x2C, 0x6E, 0x56, 0x3D, 0x56, 0x99, 0xE7, 0xE8, 0xD3, 0x9B, 0x63, 0xD4, 0x95,
-    0x7A, 0xE2, 0x7F, 0x6D, 0xDB, 0x26, 0x9A, 0x09, 0x3D, 0xB6, 0xCD, 0x03, 0xFA, 0x3D, 0x7B, 0xE8,
-    0xB0, 0x21, 0xF5, 0x23, 0x06, 0x80, 0xC3, 0x79, 0x95, 0x02, 0x0F, 0xCB, 0xA0, 0xA0, 0x24, 0x0E,
-    0x65, 0x6B, 0xB3, 0xED, 0x4E, 0xBB, 0xAF, 0xDC, 0x69, 0xF7, 0xB8, 0x34, 0xBC, 0x66, 0x30, 0xF0,
-    0xB9, 0x16, 0xAF, 0xF8, 0x65, 0xCA, 0xC2, 0x0D, 0x99, 0xE1, 0x2F, 0x96, 0x4C, 0x29, 0x8E, 0xB6,
-    0xA6, 0xFC, 0xFF, 0x01, 0xB5, 0x58, 0x3F, 0x6C, 0xDC, 0xD6, 0x19, 0xFF, 0x91, 0x4F, 0x2A, 0x53,
-    0xB3, 0xF6, 0xF3, 0x70, 0x2E, 0x9C, 0xA2, 0x06, 0x3B, 0x78, 0x08, 0x0C, 0xF9, 0xAE, 0x83, 0x07,
-    0x05, 0xB8, 0x3B, 0xB2, 0xF2, 0x10, 0xA0, 0x4B, 0x3C, 0xD8, 0x1D, 0xD2, 0x25, 0x4B, 0x81, 0xD6,
-    0x43, 0x93, 0x41, 0x83, 0x02, 0x9C, 0x7C, 0x2F, 0xF6, 0xD8, 0x45, 0x4B, 0xC6, 0x02, 0x2A, 0xE0,
-    0xC1, 0xD6, 0x90, 0x6A, 0xD0, 0x70, 0x30, 0x4E, 0x12, 0xED, 0xA0, 0xCD, 0xD0, 0xC1, 0x6C, 0x33,
-    0x74, 0xC8, 0x10, 0xA6, 0x09, 0x50, 0xA0, 0x4B, 0x38, 0xB0, 0x01, 0xE5, 0xF0, 0x8E, 0xFD, 0x7D,
-    0x8F, 0x3C, 0x9D, 0x94, 0xD8, 0x95, 0x3C, 0x84, 0xBC, 0xF7, 0x48, 0x3E, 0xBE, 0xF7, 0xFD, 0x7B,
-    0xDF, 0xF7, 0xFB, 0x3E, 0x1E, 0xE0, 0x18, 0xA4, 0xB7, 0x47, 0x8F, 0x46, 0x9B, 0xE9, 0x9F, 0xCC,
-    0x26, 0x4E, 0x3E, 0x01, 0x37, 0xF2, 0xD1, 0x7E, 0xD8, 0xFE, 0xD0, 0x3F, 0xE3, 0xFE, 0x12, 0x67,
-    0x4E, 0x3E, 0xC3, 0x0A, 0xFC, 0x5D, 0xB8, 0x85, 0xC3, 0x9B, 0x9F, 0x6C, 0x6D, 0x6D, 0x86, 0x55,
-    0x95, 0x5D, 0xE1, 0x95, 0x04, 0x39, 0x5A, 0xC5, 0x6C, 0xE6, 0xC2, 0xAD, 0x5B, 0x68, 0x0E, 0x3E,
-    0xF2, 0x28, 0xEB, 0x4B, 0xC1, 0x17, 0x3C, 0x6E, 0x9C, 0xF0, 0x6E, 0x47, 0xC5, 0xDF, 0xC7, 0x6F,
-    0xCE, 0xD5, 0x50, 0xE0, 0x48, 0xEE, 0x45, 0xD0, 0xFD, 0xAA, 0xC2, 0x2D, 0x11, 0x78, 0xC7, 0xC9,
-    0x54, 0xEA, 0xC5, 0xDA, 0x74, 0xA2, 0x10, 0x2D, 0x38, 0xB9, 0xE2, 0xB3, 0x1F, 0xEB, 0x28, 0x40,
-    0x97, 0xCF, 0xB8, 0xA1, 0x32, 0xAF, 0x79, 0xEE, 0x61, 0x19, 0xE3, 0xF1, 0x78, 0xD0, 0xED, 0x76,
-    0x17, 0xB0, 0x73, 0xCE, 0xC9, 0x7A, 0x2A, 0x1D, 0x78, 0x71, 0xAE, 0xEF, 0x66, 0x9D, 0xEB, 0x69,
-    0xE8, 0x27, 0xAD, 0xC5, 0xC8, 0xC9, 0xFB, 0x2A, 0xDB, 0x55, 0x69, 0xE9, 0x3F, 0xCE, 0xF5, 0x4A,
-    0x16, 0xA8, 0xB8, 0xEB, 0x9B, 0xD6, 0x22, 0xE9, 0x5C, 0xE0, 0xB8, 0x37, 0x1F, 0x4F, 0x7A, 0xBE,
-    0x59, 0xF6, 0x31, 0x6A, 0xA3, 0xEC, 0x60, 0xDC, 0xC1, 0x80, 0xFC, 0x74, 0xF3, 0x5B, 0x70, 0x6A,
-    0x99, 0x81, 0x3E, 0xC8, 0x95, 0x82, 0x90, 0xF3, 0x6F, 0xDE, 0xFB, 0xED, 0x7E, 0x55, 0x3C, 0x7A,
-    0xB6, 0x83, 0x0C, 0x48, 0xE1, 0x24, 0x70, 0x13, 0x50, 0x3F, 0xFE, 0xBC, 0x18, 0xBE, 0x81, 0x8E,
-    0x10, 0x44, 0xE8, 0xD8, 0x75, 0xFC, 0xDD, 0x99, 0x6D, 0xC6, 0xB8, 0x69, 0x05, 0x5B, 0x66, 0x9B,
-    0xCB, 0xDD, 0x53, 0x6C, 0x8E, 0x4B, 0xF3, 0x88, 0x89, 0x48, 0x00, 0x3E, 0x9B, 0x36, 0x10, 0x32,
-    0xD0, 0x34, 0xD2, 0xB9, 0x45, 0x74, 0x68, 0xA4, 0x70, 0x6F, 0x6A, 0x05, 0xB0, 0x6D, 0xC0, 0x56,
-    0x36, 0xA4, 0xA0, 0xF3, 0xB0, 0xE4, 0x39, 0x09, 0xCB, 0x4E, 0xE9, 0xA7, 0x1C, 0xF8, 0xA1, 0x25,
-    0xA0, 0x73, 0xE8, 0x29, 0x82, 0x2A, 0xEE, 0x4C, 0x11, 0x26, 0x78, 0xDD, 0xCA, 0xD0, 0xDA, 0x9B,
-    0x4E, 0xCE, 0x2F, 0xA2, 0x15, 0x62, 0x6F, 0x88, 0xE9, 0x10, 0x65, 0x0B, 0xF2, 0x88, 0xCB, 0x1C,
-    0x40, 0xC9, 0x21, 0x87, 0xDD, 0xC4, 0x91, 0x61, 0xDC, 0x20, 0x63, 0x13, 0x9A, 0x10, 0x0B, 0xB8,
-    0xFD, 0xE0, 0xD1, 0x83, 0xD3, 0xB8, 0xB5, 0x9C, 0x57, 0x1E, 0x5E, 0xF9, 0xF0, 0x34, 0x0E, 0x6D,
-    0x4F, 0x0C, 0x27, 0xF3, 0xD3, 0x35, 0x27, 0x9F, 0xB2, 0xE2, 0x5D, 0xD4, 0xE7, 0xE9, 0x57, 0xE0,
-    0x6C, 0x7D, 0x9E, 0x76, 0x45, 0x7D, 0x38, 0x15, 0xB0, 0xC6, 0xAB, 0x5F, 0xC5, 0x76, 0xC3, 0xF4,
-    0xF5, 0x58, 0x25, 0xBC, 0xB6, 0x55, 0xE2, 0xCB, 0xA4, 0xAE, 0x4A, 0x02, 0x99, 0x37, 0xA0, 0x73,
-    0xC9, 0x75, 0x4D, 0xC5, 0xB9, 0x5C, 0x47, 0xDE, 0x13, 0xD9, 0x06, 0xEC, 0xF8, 0x6F, 0xFC, 0xF5,
-    0x4B, 0xFC, 0x1E, 0x23, 0xAD, 0x83, 0x89, 0xAA, 0xE2, 0x41, 0xBF, 0xB7, 0xDE, 0xF1, 0x3F, 0x4E,
-    0xC2, 0x72, 0x94, 0xEB, 0xC0, 0x4D, 0xF5, 0xE7, 0x59, 0xA6, 0xDB, 0x6E, 0x0A, 0xF5, 0x24, 0xD5,
-    0x5D, 0x7A, 0x91, 0x5E, 0x49, 0x02, 0x12, 0x15, 0x06, 0x6D, 0x12, 0x15, 0xC2, 0xBD, 0x35, 0xFA,
-    0x44, 0x46, 0x06, 0x6B, 0x7E, 0xA4, 0x12, 0x95, 0xE4, 0xF4, 0x4F, 0xDF, 0x38, 0xDF, 0x64, 0xE1,
-    0x2E, 0xC8, 0x7C, 0xDF, 0x04, 0x96, 0xE5, 0x02, 0x9C, 0x08, 0xF3, 0x63, 0x26, 0xF9, 0x5C, 0xF6,
-    0xB9, 0xF4, 0x73, 0xF9, 0xE7, 0x1A, 0xCC, 0x75, 0x98, 0x6B, 0x31, 0xD7, 0x63, 0xAE, 0x89, 0xBF,
-    0x31, 0xD3, 0x65, 0x98, 0xCF, 0xB4, 0xC9, 0xC7, 0x8D, 0x3E, 0x5F, 0xA4, 0xDD, 0x46, 0xA3, 0x2F,
-    0x48, 0xAB, 0xD6, 0xE9, 0x9F, 0xA6, 0xDB, 0x68, 0xF5, 0xA9, 0x19, 0x34, 0x7A, 0x3D, 0x8D, 0xD6,
-    0x1A, 0xCD, 0x9E, 0x46, 0x3B, 0x8D, 0x6E, 0x6F, 0x46, 0x59, 0xA3, 0x9D, 0xBF, 0x92, 0x36, 0xFA,
-    0x79, 0x5F, 0xC5, 0x8D, 0x86, 0x6E, 0xD5, 0xE8, 0x08, 0xBA, 0x25, 0x9D, 0xBF, 0x20, 0x56, 0x24,
-    0x9E, 0xD1, 0xB8, 0x84, 0xD7, 0x20, 0x11, 0x8B, 0xA2, 0x0F, 0x27, 0x1B, 0x83, 0x14, 0xE0, 0xDD,
-    0x4D, 0xA1, 0x69, 0xBC, 0x4B, 0x5E, 0x84, 0xD7, 0xCE, 0x88, 0x6A, 0x01, 0x43, 0xAA, 0xE8, 0xEB,
-    0x88, 0x33, 0x3A, 0x32, 0xA5, 0x2B, 0x73, 0x46, 0x32, 0x29, 0xE3, 0xAC, 0x95, 0x84, 0xD3, 0xB8,
-    0xE9, 0x3D, 0x06, 0x79, 0xC0, 0x88, 0xD3, 0xA0, 0xA5, 0xE9, 0x05, 0xBD, 0x00, 0xFD, 0x00, 0x81,
-    0x8E, 0xB4, 0x6F, 0xB4, 0x67, 0x7C, 0x9A, 0xEF, 0x6E, 0xEC, 0xBE, 0xCF, 0x71, 0x1D, 0xF5, 0x03,
-    0x6D, 0x02, 0xFD, 0x46, 0xAC, 0xFD, 0x7B, 0xB1, 0xF6, 0xEE, 0xC5, 0xFE, 0xF5, 0x27, 0x89, 0xBA,
-    0xFB, 0x38, 0xE5, 0xEB, 0x0D, 0x91, 0xD2, 0x27, 0x04, 0xC4, 0xE8, 0xC7, 0xD8, 0x4E, 0x9C, 0x24,
-    0x55, 0xF1, 0xB6, 0xC6, 0xBB, 0x57, 0x71, 0x6D, 0x99, 0xC1, 0x7B, 0x1E, 0x03, 0x27, 0xF3, 0x92,
-    0x20, 0xBA, 0x43, 0x30, 0xE8, 0x11, 0x26, 0x74, 0xE4, 0x1B, 0x89, 0x7D, 0x17, 0x72, 0x55, 0xA9,
-    0x93, 0x31, 0xAC, 0xC7, 0x4E, 0x21, 0x73, 0x7A, 0x58, 0x3D, 0xDC, 0xD3, 0x05, 0x41, 0x04, 0x8E,
-    0x04, 0x86, 0x9B, 0x16, 0x05, 0x91, 0x36, 0x5E, 0xE2, 0x50, 0x66, 0x27, 0xB7, 0x38, 0xB0, 0x0E,
-    0xC5, 0xCD, 0x92, 0x61, 0xC2, 0x48, 0xD2, 0x17, 0x27, 0xC8, 0x0B, 0x41, 0xAD, 0x61, 0xAA, 0xD2,
-    0x3D, 0x8A, 0xA3, 0xB2, 0x75, 0xE2, 0x80, 0xCA, 0x5A, 0x38, 0xC8, 0x11, 0x71, 0xF6, 0xBA, 0x38,
-    0x85, 0x21, 0x54, 0x91, 0x88, 0x97, 0x08, 0x11, 0x92, 0x12, 0x22, 0xEB, 0x1C, 0x26, 0xCE, 0x46,
-    0xB4, 0x87, 0xF1, 0xE2, 0x8B, 0xEC, 0x99, 0xDE, 0xB0, 0x68, 0xA1, 0xD0, 0x29, 0x70, 0xC7, 0xCD,
-    0xB1, 0xEB, 0x66, 0x18, 0xAB, 0x0C, 0x25, 0xE7, 0x17, 0x6C, 0x39, 0x65, 0xC9, 0xFC, 0xD8, 0xCD,
-    0x34, 0x35, 0xD0, 0x94, 0x50, 0x47, 0x8A, 0xBB, 0xE7, 0x49, 0x33, 0x6D, 0xDA, 0xA3, 0x77, 0xA8,
-    0xC7, 0x22, 0xDE, 0x26, 0x99, 0x12, 0x43, 0x97, 0x8D, 0xE4, 0x5A, 0xB0, 0x19, 0xE9, 0x07, 0x92,
-    0xBC, 0xF2, 0xF6, 0x41, 0xE9, 0xE4, 0x63, 0x37, 0x1B, 0xF0, 0x47, 0xF0, 0x56, 0x7F, 0xCF, 0xD5,
-    0xDF, 0x52, 0xEF, 0x2B, 0xE3, 0x4F, 0xE0, 0x13, 0xCF, 0x62, 0xB1, 0x81, 0x9E, 0x51, 0xBA, 0xC8,
-    0xD0, 0xA6, 0x83, 0x00, 0xBB, 0x90, 0x0C, 0x21, 0x47, 0xA7, 0xCE, 0x81, 0x36, 0x16, 0x7E, 0x0E,
-    0xFC, 0xE8, 0x1A, 0x11, 0x7B, 0x89, 0x50, 0xAB, 0x29, 0x8A, 0xF7, 0x9F, 0x3D, 0xCE, 0x6E, 0x3C,
-    0x9A, 0xA0, 0xE8, 0x1C, 0xFC, 0x3A, 0xF6, 0x0C, 0xB2, 0x4B, 0xC0, 0x35, 0xCE, 0x5B, 0x7A, 0xDB,
-    0x52, 0x14, 0x55, 0x15, 0x9B, 0xCF, 0x49, 0x97, 0x1A, 0xB8, 0xDD, 0x86, 0x20, 0x3D, 0x04, 0xA5,
-    0xE9, 0x54, 0x38, 0xC7, 0xC7, 0xAB, 0xB0, 0x19, 0x01, 0x04, 0x65, 0xE7, 0x53, 0xAE, 0xF8, 0x03,
-    0x57, 0x78, 0x7C, 0xC5, 0xF7, 0x5D, 0x2E, 0x5F, 0x55, 0x06, 0x47, 0x8F, 0xC1, 0xB7, 0xAE, 0x23,
-    0xDB, 0x7B, 0xF4, 0x7F, 0x1B, 0xA4, 0xF9, 0x76, 0x1D, 0xB6, 0xFB, 0xFF, 0xFD, 0x5D, 0xFD, 0xA2,
-    0x9A, 0xD4, 0x2F, 0x9A, 0xE7, 0xF6, 0x5A, 0x93, 0x42, 0xEA, 0x18, 0x75, 0xB3, 0xC6, 0x9C, 0x49,
-    0xC7, 0x3E, 0x8A, 0x4D, 0x36, 0xEA, 0xEC, 0x81, 0xBC, 0xB9, 0x66, 0x38, 0x4F, 0x2F, 0x5C, 0xE0,
-    0x75, 0x9D, 0xAA, 0xE8, 0xF7, 0x13, 0xEC, 0x7F, 0x46, 0xFF, 0x78, 0x16, 0xD3, 0xD2, 0x55, 0x8A,
-    0x61, 0x55, 0x22, 0xDC, 0x4F, 0x88, 0x0F, 0x25, 0xBE, 0xA1, 0x4E, 0xED, 0x14, 0xDE, 0x27, 0x5C,
-    0x57, 0x64, 0x08, 0xEE, 0x31, 0x99, 0x65, 0x23, 0x74, 0x88, 0x4C, 0x5E, 0x3C, 0xC0, 0x2B, 0xF4,
-    0x48, 0x27, 0x12, 0x8F, 0x22, 0x0F, 0x5C, 0x46, 0x38, 0x0D, 0x27, 0x17, 0x6E, 0x0A, 0x5F, 0x81,
-    0x13, 0x49, 0x57, 0xB0, 0x20, 0x62, 0x65, 0x2A, 0xAC, 0x78, 0x68, 0x84, 0x90, 0x1C, 0x86, 0xF6,
-    0xA1, 0xE2, 0x32, 0x6E, 0x31, 0xC8, 0xC2, 0x8F, 0x5D, 0x64, 0x15, 0x12, 0xBC, 0x71, 0xD3, 0xC3,
-    0x45, 0x87, 0xC4, 0x6A, 0x2B, 0x31, 0x8B, 0x49, 0x22, 0xBB, 0x29, 0x29, 0xF5, 0x30, 0x0F, 0x0F,
-    0x6C, 0x2E, 0x2D, 0x64, 0x2D, 0xBD, 0xD6, 0xA9, 0x62, 0xB7, 0xA2, 0xE7, 0x09, 0x75, 0x49, 0xC2,
-    0xB1, 0x4D, 0x80, 0x91, 0x4D, 0xC5, 0xB0, 0xA9, 0xF8, 0x26, 0xC2, 0x02, 0x57, 0xEE, 0x93, 0xB5,
-    0xA5, 0xB6, 0xB8, 0xFE, 0x1D, 0x2A, 0x99, 0xFC, 0x04, 0x8C, 0x53, 0xA7, 0x4A, 0x48, 0xF0, 0x08,
-    0x15, 0x34, 0x54, 0x66, 0xDC, 0x2F, 0x8C, 0x67, 0xD4, 0x50, 0xBB, 0xEE, 0x86, 0x5B, 0xA5, 0xF4,
-    0xDE, 0xA0, 0x2A, 0xDB, 0x2B, 0xA5, 0xFE, 0xC5, 0xC4, 0x92, 0xED, 0x5B, 0xFA, 0xA1, 0xED, 0xFB,
-    0x36, 0x5F, 0xF7, 0x6C, 0xB0, 0x96, 0x60, 0x96, 0x56, 0x39, 0x93, 0x2B, 0x82, 0x44, 0x1C, 0x68,
-    0x28, 0x4F, 0x8C, 0x04, 0x4A, 0x4E, 0x15, 0xC8, 0x90, 0x37, 0xBA, 0x31, 0xD2, 0xFC, 0xB8, 0x68,
-    0x43, 0x90, 0x0E, 0x1F, 0x46, 0xE2, 0xF3, 0xEC, 0x77, 0x2D, 0xF5, 0x96, 0x40, 0xC3, 0x5C, 0x90,
-    0x9C, 0x72, 0xA8, 0x8C, 0x62, 0x30, 0x3A, 0x19, 0xA2, 0xB4, 0xEA, 0x40, 0x82, 0xDB, 0x76, 0x25,
-    0x55, 0x72, 0x72, 0x46, 0x91, 0xCF, 0x18, 0x25, 0x7F, 0xB2, 0xA2, 0x61, 0xAD, 0x2C, 0xC2, 0xB3,
-    0x2D, 0xBC, 0x7B, 0xC2, 0xBA, 0x7B, 0x9C, 0xEF, 0x0D, 0xB2, 0x75, 0x0B, 0x72, 0x55, 0x25, 0x99,
-    0x32, 0xFC, 0xC9, 0xF3, 0x30, 0xDD, 0x84, 0xD8, 0xA7, 0x01, 0xEF, 0x78, 0xAC, 0x51, 0xB0, 0xAB,
-    0x92, 0xD0, 0x88, 0xEE, 0xE4, 0x51, 0xDA, 0xBE, 0xB0, 0x7D, 0x2E, 0xAE, 0x40, 0xF3, 0x72, 0xB2,
-    0x38, 0xC7, 0x44, 0xF4, 0x24, 0x57, 0xEE, 0x56, 0x60, 0x0B, 0xA7, 0xBE, 0xDD, 0x7A, 0xCE, 0xF5,
-    0x8C, 0xCC, 0xF2, 0x23, 0x37, 0x3D, 0xA6, 0x3B, 0x35, 0x97, 0xFC, 0x16, 0x42, 0x27, 0x62, 0x82,
-    0xA6, 0x8F, 0x45, 0x79, 0x29, 0xD1, 0x58, 0x50, 0x3E, 0x60, 0xD4, 0x97, 0x2C, 0x28, 0x8B, 0xDA,
-    0xFD, 0xC4, 0xCB, 0xE4, 0xBD, 0xF8, 0x58, 0xBF, 0xAE, 0xBB, 0xC4, 0xF4, 0x62, 0x8E, 0x59, 0x7D,
-    0x45, 0xD3, 0x61, 0x7D, 0x56, 0x43, 0x01, 0x15, 0x43, 0x8E, 0x85, 0xB0, 0xC9, 0x86, 0x55, 0xC2,
-    0x96, 0x35, 0x2D, 0x7F, 0x4E, 0x93, 0xF1, 0x94, 0x2D, 0xCE, 0x86, 0x53, 0x64, 0xAB, 0x11, 0x1B,
-    0x4E, 0xD5, 0x36, 0x2F, 0x93, 0xD1, 0xED, 0xAD, 0x07, 0xAC, 0xF9, 0x4A, 0x5D, 0x1D, 0x0C, 0x3A,
-    0x55, 0xBE, 0xC4, 0xED, 0x5A, 0x1A, 0x3E, 0xA7, 0x85, 0x4D, 0x0B, 0xD8, 0x7C, 0xCE, 0x67, 0xA5,
-    0x5C, 0xDE, 0xDE, 0xBA, 0xCF, 0xC0, 0xAD, 0xCC, 0x7B, 0xE4, 0xBF, 0xCA, 0x97, 0x6C, 0x05, 0x5B,
-    0xF9, 0x82, 0x26, 0xEF, 0x29, 0x26, 0x93, 0x75, 0x75, 0x80, 0x06, 0x38, 0xEA, 0x40, 0xA3, 0x79,
-    0xAE, 0xD2, 0xEC, 0xE1, 0x27, 0x86, 0x00, 0xF0, 0xC1, 0x26, 0xAB, 0xC4, 0x0C, 0xE1, 0x5F, 0x36,
-    0xF1, 0x35, 0x2B, 0xD9, 0xCF, 0xE9, 0x82, 0x4C, 0x8C, 0x9E, 0x35, 0xCC, 0x68, 0x56, 0x50, 0xE4,
-    0xAA, 0x50, 0xF9, 0xB7, 0x77, 0x85, 0xD5, 0x29, 0xAD, 0x5B, 0x9F, 0x6D, 0x9E, 0x97, 0x66, 0xC3,
-    0x1D, 0x81, 0x45, 0xC2, 0x2B, 0x04, 0x5F, 0x65, 0xF8, 0x1A, 0x04, 0x61, 0x51, 0x43, 0xEC, 0xF7,
-    0x75, 0x08, 0xE0, 0x0B, 0x9F, 0x65, 0x08, 0xE4, 0x43, 0x30, 0x1F, 0x16, 0xF4, 0x0F, 0x51, 0x7F,
-    0x86, 0x3A, 0x16, 0x36, 0x09, 0xE1, 0x4E, 0xC2, 0x99, 0x6A, 0x22, 0xEE, 0x3E, 0x3C, 0x78, 0x2B,
-    0x22, 0x8E, 0x30, 0x75, 0xB8, 0xE5, 0x5B, 0xF4, 0x90, 0x3F, 0x8A, 0x6B, 0x0B, 0x14, 0x95, 0x02,
-    0x62, 0xD7, 0x2C, 0xCC, 0x79, 0xC7, 0x22, 0xD2, 0x82, 0x95, 0x1D, 0x27, 0xD0, 0x62, 0x55, 0x12,
-    0x46, 0xF5, 0xA6, 0x70, 0x98, 0xFE, 0x8A, 0x40, 0x49, 0x37, 0x22, 0xDF, 0x1F, 0x1B, 0xA8, 0x7F,
-    0x4B, 0x21, 0xFF, 0x11, 0xE7, 0x85, 0xE2, 0x95, 0x67, 0x2D, 0x3A, 0x3A, 0x47, 0x2C, 0xB9, 0x8E,
-    0x9D, 0x3D, 0x64, 0xBB, 0x6E, 0xDA, 0x6A, 0xD0, 0xCB, 0x34, 0x88, 0xD3, 0xB3, 0xD0, 0x31, 0x12,
-    0x5D, 0x18, 0x15, 0xCA, 0x7E, 0x65, 0xCC, 0x5F, 0x3A, 0x79, 0xD7, 0x2D, 0x46, 0x8E, 0xAD, 0xD5,
-    0xF6, 0x05, 0x8A, 0x12, 0x86, 0xE0, 0x97, 0x4C, 0x52, 0x41, 0xF4, 0x4E, 0x75, 0x3F, 0x60, 0xE1,
-    0x85, 0x77, 0xAA, 0x29, 0xAC, 0xCB, 0xF1, 0xFB, 0xD0, 0xB9, 0x21, 0xD9, 0x31, 0x72, 0x0E, 0xF8,
-    0x15, 0x65, 0xB0, 0xCD, 0x3D, 0x59, 0xA6, 0xA9, 0x7E, 0xFA, 0x33, 0xE0, 0x15, 0x9B, 0xF3, 0x98,
-    0xDC, 0xD4, 0x4A, 0x9C, 0xAA, 0x7F, 0x7C, 0x94, 0xE2, 0xEB, 0xA7, 0x86, 0x28, 0x4F, 0x36, 0x13,
-    0xF9, 0x5E, 0x9B, 0x5E, 0xF9, 0xF3, 0xF4, 0x21, 0x42, 0x82, 0xDA, 0xB3, 0xCF, 0x22, 0xF5, 0xAF,
-    0x8F, 0x13, 0xEF, 0xEE, 0xE3, 0xFA, 0x93, 0xC5, 0x8D, 0x8F, 0x98, 0xA3, 0x23, 0x01, 0x6A, 0xEA,
-    0xEB, 0xF3, 0x0F, 0x09, 0x44, 0xE2, 0x97, 0xFD, 0x22, 0x5A, 0x78, 0xE1, 0x2E, 0xCA, 0x06, 0xCD,
-    0xE8, 0x2C, 0xDA, 0xEA, 0xED, 0x49, 0x26, 0xE5, 0xDB, 0x75, 0x56, 0x18, 0xE3, 0x36, 0x6B, 0x24,
-    0x16, 0x70, 0x5A, 0x2A, 0xB8, 0x9D, 0xAB, 0xB6, 0x84, 0xEB, 0x4A, 0x0D, 0x17, 0x6F, 0x4B, 0x11,
-    0x17, 0x6D, 0x1C, 0x93, 0xC6, 0x82, 0xE4, 0x6C, 0xB7, 0x4F, 0x71, 0xF4, 0xEC, 0x7E, 0x8A, 0x84,
-    0x3A, 0x11, 0x19, 0xF9, 0x21, 0x29, 0x5B, 0x75, 0xE2, 0xBA, 0xBA, 0x84, 0x6E, 0x78, 0x45, 0x35,
-    0x5C, 0x1D, 0xD5, 0xD9, 0x4B, 0x84, 0xA6, 0x9F, 0xD6, 0xF7, 0x27, 0x51, 0x5B, 0x38, 0x2A, 0xBF,
-    0x75, 0xB8, 0x20, 0x7A, 0x79, 0xF9, 0x6D, 0x1F, 0x5B, 0xF9, 0x23, 0xF4, 0x87, 0x77, 0x5A, 0xC7,
-    0x79, 0xF4, 0x87, 0xFD, 0x85, 0x3A, 0x7F, 0xAB, 0x6C, 0xD6, 0x39, 0x1B, 0xFF, 0x87, 0x76, 0x4B,
-    0x94, 0x1A, 0x8A, 0x5C, 0x92, 0x81, 0x4C, 0x7F, 0xA6, 0xF5, 0x0B, 0x8E, 0xE8, 0x18, 0x65, 0xDB,
-    0xE1, 0x88, 0x65, 0xDA, 0x87, 0x3D, 0xBF, 0x08, 0x98, 0x1D, 0xFC, 0xB4, 0xED, 0x4A, 0x5A, 0x6C,
-    0x33, 0x0B, 0xBA, 0xAC, 0x17, 0x37, 0x8F, 0xCD, 0xA9, 0xFB, 0xDB, 0x5B, 0xFB, 0x5B, 0x5B, 0xC6,
-    0xFE, 0x5B, 0x11, 0x6F, 0xD9, 0xFB, 0xEF, 0xCE, 0x71, 0xA2, 0x36, 0x93, 0x95, 0x47, 0x6A, 0x96,
-    0xA6, 0x2A, 0x84, 0xBE, 0x64, 0x94, 0x63, 0x33, 0x5F, 0x65, 0x3B, 0xBF, 0x3B, 0xDD, 0xBB, 0x6C,
-    0x0B, 0x93, 0xE9, 0x74, 0xD0, 0x7C, 0x19, 0xEF, 0xB6, 0x24, 0x2B, 0x0C, 0x79, 0x5E, 0xB5, 0xFB,
-    0x20, 0xF7, 0xA1, 0x9D, 0x6D, 0xEF, 0xA3, 0xD0, 0x82, 0xD7, 0xAB, 0xCD, 0xBD, 0xEC, 0xD3, 0xFC,
-    0x7B, 0xF2, 0x25, 0xBE, 0x5E, 0xCF, 0xD6, 0xE7, 0x69, 0x57, 0xF0, 0xB3, 0xBE, 0xD0, 0xFC, 0x62,
-    0x50, 0xF1, 0x69, 0xE6, 0xCB, 0x0A, 0x87, 0xB5, 0xB7, 0x97, 0xE8, 0xAC, 0x53, 0x84, 0xE5, 0xE9,
-    0x56, 0xB8, 0xC6, 0x4F, 0x97, 0x97, 0x96, 0x97, 0xFC, 0xF4, 0x74, 0x5C, 0xA8, 0x87, 0x79, 0x39,
-    0xCD, 0xFF, 0x07, 0x75, 0x54, 0x31, 0x6F, 0x23, 0x45, 0x14, 0xFE, 0x66, 0x06, 0x6E, 0xC4, 0x8D,
-    0xD8, 0xA1, 0xB8, 0x6B, 0x0E, 0xBC, 0x6E, 0xAF, 0xB0, 0xB3, 0xCD, 0x15, 0x16, 0x5A, 0xC7, 0x73,
-    0x20, 0x41, 0x41, 0x83, 0x84, 0x2C, 0x8A, 0x20, 0xDD, 0xFD, 0x02, 0x92, 0x62, 0x0B, 0x93, 0x8B,
-    0x92, 0xE1, 0x8A, 0x6B, 0x28, 0x70, 0x4F, 0x81, 0x1B, 0xA4, 0x23, 0x48, 0x64, 0x0B, 0x17, 0x41,
-    0x01, 0xEF, 0x88, 0x16, 0x09, 0x4D, 0x43, 0xBF, 0x42, 0x42, 0x14, 0x48, 0x97, 0x2D, 0x2C, 0x61,
-    0x41, 0x9C, 0xE5, 0xCD, 0x38, 0x86, 0x8A, 0x9D, 0x27, 0x79, 0xC6, 0xF3, 0xED, 0x7B, 0xDF, 0xFB,
-    0xDE, 0x7B, 0x8B, 0xCA, 0x88, 0xD6, 0xA9, 0x1F, 0x6B, 0x8D, 0x26, 0x45, 0xD3, 0x47, 0x93, 0xB3,
-    0x3A, 0xE7, 0x3E, 0x17, 0x8E, 0x6C, 0xA8, 0x4D, 0x77, 0x01, 0xB5, 0x42, 0x7C, 0x84, 0xE3, 0x06,
-    0x90, 0xD0, 0x48, 0xF0, 0x2A, 0xDE, 0x40, 0x0F, 0x39, 0x06, 0x28, 0xF0, 0x18, 0xE0, 0x53, 0x28,
-    0x87, 0xAE, 0xC3, 0x13, 0x87, 0x3F, 0xAD, 0xF8, 0xC9, 0x68, 0x8D, 0xBE, 0xC6, 0x71, 0x35, 0xAD,
-    0x5A, 0x8F, 0x3E, 0x08, 0x49, 0x50, 0x9C, 0xCE, 0x78, 0x5B, 0x0B, 0x07, 0x61, 0x21, 0x0D, 0xF4,
-    0x1A, 0xAA, 0x32, 0x90, 0x74, 0x8E, 0xA6, 0xCC, 0x6E, 0x85, 0x6C, 0x19, 0x63, 0xED, 0x5B, 0xA2,
-    0xA5, 0xED, 0xCD, 0xAB, 0x87, 0x57, 0x58, 0xEC, 0x63, 0x45, 0x1C, 0xA3, 0xCD, 0x53, 0x1C, 0x5F,
-    0xA1, 0x5B, 0x07, 0xE0, 0xED, 0xD3, 0x69, 0x46, 0x21, 0xC8, 0x89, 0x06, 0x76, 0x22, 0x7A, 0x09,
-    0xD6, 0x44, 0x7F, 0x16, 0x5D, 0x60, 0x08, 0x4C, 0x08, 0x17, 0xF2, 0xF4, 0xEA, 0xD3, 0x5A, 0xB3,
-    0x5A, 0x3D, 0xF5, 0xE2, 0xD2, 0x88, 0x35, 0xBA, 0x8F, 0x90, 0x4B, 0x3B, 0x11, 0x6E, 0xA2, 0xEC,
-    0xE8, 0x6C, 0x9B, 0xE7, 0x02, 0x21, 0xF4, 0x53, 0x4F, 0xC8, 0x94, 0x8C, 0xD7, 0x7A, 0xCF, 0x2B,
-    0x0A, 0xF1, 0x41, 0x60, 0x88, 0x0C, 0x6F, 0x5E, 0x61, 0xE4, 0x03, 0x90, 0x59, 0xEE, 0xB8, 0xFB,
-    0xF0, 0x97, 0xB6, 0x25, 0x65, 0x68, 0x31, 0x33, 0x1E, 0xB7, 0x6D, 0xB8, 0x69, 0xDB, 0xF1, 0x98,
-    0x42, 0x5E, 0x57, 0xD7, 0x74, 0x98, 0xF3, 0x5A, 0x3A, 0x8D, 0x94, 0x98, 0xE4, 0x44, 0x65, 0x82,
-    0x39, 0xAD, 0x82, 0x7E, 0x73, 0x52, 0xF0, 0xA5, 0xE0, 0xC7, 0xA3, 0xA1, 0x35, 0xBF, 0x59, 0x25,
-    0x1A, 0xD6, 0x70, 0x2F, 0x9C, 0x32, 0x29, 0x61, 0xDE, 0xC7, 0x2B, 0x99, 0x4D, 0x7E, 0xF7, 0xDD,
-    0x87, 0xF5, 0x0E, 0xF3, 0x39, 0x77, 0x03, 0xE2, 0x2B, 0x6C, 0x21, 0x4D, 0xA9, 0x30, 0xBB, 0x15,
-    0xF8, 0x4A, 0xE2, 0xFB, 0xB6, 0x4B, 0xB9, 0x1F, 0x52, 0xE1, 0xB8, 0x3F, 0x12, 0x3E, 0xE4, 0x14,
-    0xD3, 0xCA, 0xBB, 0x18, 0xAD, 0xA1, 0x37, 0xA2, 0xDE, 0xE7, 0x2B, 0xBD, 0x1C, 0xCE, 0x43, 0x34,
-    0x56, 0x87, 0x08, 0xC2, 0x49, 0x27, 0x2D, 0x65, 0x75, 0x42, 0x72, 0xD7, 0xDC, 0x34, 0x40, 0x34,
-    0xEE, 0x83, 0x78, 0xA4, 0xE6, 0x39, 0x84, 0x87, 0x36, 0x18, 0xB5, 0xEE, 0xA4, 0xB5, 0xA8, 0x02,
-    0x8C, 0x61, 0x0B, 0xDB, 0x73, 0x8C, 0x12, 0x54, 0x9B, 0xFA, 0xF9, 0xD7, 0xA4, 0xDB, 0x3D, 0x33,
-    0xD9, 0x3A, 0x86, 0xE2, 0x16, 0xDA, 0x21, 0xA3, 0x86, 0xB0, 0xEC, 0x0F, 0x23, 0x3E, 0x07, 0x35,
-    0x44, 0x9E, 0x62, 0x51, 0xD9, 0xB6, 0x75, 0xA1, 0x48, 0x79, 0x28, 0x0B, 0x3F, 0x0D, 0x65, 0x0E,
-    0xAD, 0x80, 0x60, 0xDD, 0x15, 0xD2, 0x2A, 0xEE, 0x88, 0x92, 0x82, 0xE9, 0xE2, 0xAF, 0x35, 0x4E,
-    0x62, 0x99, 0xF1, 0xBA, 0x67, 0xAD, 0x97, 0x3E, 0x5C, 0xA6, 0x54, 0xD4, 0x6B, 0x8C, 0xBE, 0xB4,
-    0xD4, 0xA1, 0x47, 0xC2, 0x0D, 0xA4, 0xCD, 0xB5, 0xC9, 0xB6, 0x7D, 0x7A, 0xEB, 0x74, 0xA6, 0xDB,
-    0x98, 0xC2, 0xFF, 0xF7, 0x44, 0x1F, 0x5B, 0xD9, 0xDE, 0xF2, 0x9A, 0x7B, 0x4D, 0x3A, 0x5C, 0x42,
-    0x5E, 0x21, 0xDB, 0xC7, 0x44, 0x99, 0xB9, 0xB2, 0x73, 0x6D, 0x8E, 0xAB, 0xC0, 0x27, 0x94, 0xE7,
-    0x3B, 0x42, 0x5A, 0xC2, 0xF4, 0xA3, 0xBA, 0x14, 0x34, 0x7B, 0xE4, 0xF4, 0xDF, 0x8E, 0xBD, 0x6B,
-    0x83, 0xFF, 0x21, 0xBE, 0x59, 0x91, 0x30, 0x91, 0xE4, 0x14, 0xF0, 0xC1, 0xEE, 0xFE, 0x66, 0x46,
-    0x24, 0x57, 0x7D, 0x73, 0x84, 0xC1, 0xDD, 0x71, 0xFC, 0x27, 0x3E, 0xB4, 0xA1, 0xE3, 0x66, 0x33,
-    0x6A, 0xC3, 0xA6, 0x09, 0xC5, 0xA6, 0x89, 0x89, 0x0D, 0x12, 0xEB, 0x13, 0x57, 0x49, 0x6D, 0x92,
-    0xE3, 0x4E, 0x78, 0x67, 0xB3, 0xFD, 0x6F, 0x45, 0x18, 0xAB, 0x37, 0x4D, 0x72, 0x07, 0xEC, 0xF9,
-    0x63, 0xF5, 0xA2, 0x4E, 0x45, 0xE8, 0x8F, 0x82, 0xBB, 0x52, 0xD8, 0x52, 0xDA, 0x52, 0x9B, 0xE1,
-    0x13, 0x74, 0x9F, 0x85, 0x0C, 0xD4, 0x19, 0x3A, 0xD2, 0xE4, 0x0A, 0x87, 0x3F, 0x60, 0x31, 0x25,
-    0x77, 0xE4, 0x0F, 0xC3, 0x8F, 0x82, 0x66, 0xEC, 0x39, 0xD4, 0xA5, 0xE9, 0x90, 0x90, 0xCC, 0x15,
-    0xCC, 0x95, 0xE1, 0x75, 0x57, 0x28, 0x33, 0xFC, 0x18, 0x6A, 0x09, 0x6E, 0xEE, 0xD3, 0x1F, 0xF8,
-    0xD5, 0xE3, 0xC2, 0x84, 0x59, 0x3A, 0x02, 0x7B, 0x01, 0xF1, 0x19, 0xB4, 0xB0, 0x3D, 0xE6, 0xF8,
-    0x39, 0x92, 0x33, 0x84, 0x79, 0x26, 0x6D, 0xF7, 0x9C, 0x6A, 0x6D, 0x5F, 0x9A, 0x81, 0xC6, 0xF0,
-    0x08, 0xBA, 0x06, 0x33, 0xF1, 0x86, 0x46, 0x9C, 0x2A, 0x7A, 0xCF, 0x24, 0x17, 0x5E, 0x9B, 0x3A,
-    0x85, 0xEF, 0x6D, 0xFB, 0xB8, 0x08, 0x3C, 0xCD, 0x4C, 0xDE, 0x20, 0xE5, 0x06, 0xC9, 0x6C, 0xA2,
-    0x4C, 0xD2, 0x47, 0x67, 0x8E, 0x1D, 0x8F, 0xDD, 0x06, 0x83, 0x02, 0x45, 0x8E, 0xB2, 0x8F, 0x59,
-    0x42, 0x48, 0x61, 0x85, 0x91, 0xD4, 0x1E, 0xE1, 0x33, 0xD4, 0xF9, 0xF7, 0x23, 0x74, 0x40, 0x39,
-    0xBD, 0x7C, 0x8F, 0xCF, 0x92, 0x8B, 0x9F, 0xBF, 0xD7, 0x0F, 0x97, 0x3D, 0x1A, 0xDD, 0x5E, 0x8F,
-    0xBB, 0x9C, 0xCA, 0x35, 0x18, 0x08, 0xFB, 0x80, 0xE6, 0xE5, 0xE0, 0x40, 0xA1, 0x2C, 0x6F, 0x63,
-    0xC6, 0xDF, 0x9B, 0x8A, 0x45, 0x23, 0x7D, 0xA1, 0x6C, 0xA1, 0x51, 0x26, 0x68, 0x3A, 0xA8, 0xFB,
-    0x1B, 0x52, 0x34, 0xC8, 0xEF, 0x58, 0x71, 0xB8, 0xB9, 0xA5, 0x4C, 0x8A, 0x24, 0x58, 0x43, 0xEE,
-    0xB2, 0x2F, 0xDC, 0xE0, 0x3A, 0x7C, 0xC5, 0x8A, 0x50, 0x8E, 0x30, 0x01, 0xFC, 0x6B, 0xFD, 0x6D,
-    0x8F, 0x38, 0x68, 0xCB, 0x96, 0xA1, 0x2A, 0x5F, 0x9D, 0x9F, 0x78, 0x4E, 0x29, 0x64, 0xB3, 0xFD,
-    0xD9, 0x96, 0xD9, 0x03, 0x82, 0x7F, 0x62, 0x32, 0xF3, 0x0F, 0x6D, 0x57, 0x4D, 0x8F, 0x14, 0xD7,
-    0x15, 0xBD, 0x55, 0x05, 0x5D, 0x12, 0xA5, 0xF0, 0xD8, 0x20, 0xE4, 0xA0, 0xA1, 0x36, 0x5E, 0xA0,
-    0x10, 0x53, 0x1B, 0x4B, 0x41, 0x4A, 0x77, 0x55, 0x61, 0x4B, 0x66, 0x91, 0x0D, 0x91, 0xD2, 0xF2,
-    0x02, 0x29, 0x64, 0x19, 0x39, 0x71, 0x58, 0x24, 0x92, 0x59, 0xF4, 0x4C, 0x17, 0xB2, 0x9C, 0x4D,
-    0x16, 0x1E, 0x65, 0x91, 0x4D, 0x24, 0x87, 0x45, 0x22, 0x25, 0xC3, 0x62, 0x58, 0x20, 0x05, 0x85,
-    0x86, 0x7E, 0xB6, 0x7F, 0x80, 0x0B, 0x59, 0xB0, 0xB1, 0x14, 0xCA, 0xE2, 0x23, 0x09, 0x2C, 0x5C,
-    0x68, 0x6A, 0x42, 0x0D, 0x53, 0xDD, 0x2F, 0xE7, 0xBC, 0xD7, 0x33, 0xC3, 0x24, 0xE9, 0x51, 0xDF,
-    0xD6, 0xBC, 0x7A, 0x1F, 0xF7, 0x9E, 0x7B, 0xEE, 0xB9, 0xAF, 0x44, 0xF0, 0x19, 0xB7, 0x12, 0x98,
-    0x4E, 0x54, 0x79, 0x40, 0xE2, 0x5C, 0x24, 0xC3, 0xD0, 0x32, 0xBE, 0x13, 0x7F, 0xED, 0x6A, 0x17,
-    0x98, 0xA6, 0x0D, 0xEF, 0x9D, 0x6F, 0x23, 0x2D, 0x9D, 0x2A, 0xE4, 0xB6, 0xCA, 0x25, 0x5B, 0x5F,
-    0xCB, 0x95, 0x31, 0x85, 0x8C, 0x87, 0x22, 0x29, 0x26, 0x0E, 0xF0, 0x1D, 0x71, 0x01, 0xBE, 0xD3,
-    0xB9, 0x88, 0x99, 0xCB, 0xE2, 0xA3, 0x14, 0xCC, 0xD2, 0x12, 0xCF, 0xC0, 0xC3, 0xD0, 0x18, 0xEC,
-    0xBE, 0x05, 0x33, 0xAF, 0x6B, 0x09, 0x9E, 0xDF, 0x2D, 0x25, 0xFA, 0xF2, 0x73, 0x2D, 0xEA, 0xC3,
-    0x0F, 0x0B, 0x49, 0xA2, 0x08, 0x5B, 0x73, 0x41, 0xCA, 0x05, 0x83, 0x7E, 0x1F, 0x5E, 0x5C, 0x3E,
-    0x03, 0x73, 0xFD, 0x06, 0xC6, 0xB0, 0x40, 0x32, 0x2C, 0x90, 0x04, 0x0B, 0x44, 0xFD, 0xE3, 0xD7,
-    0xB9, 0x44, 0xF4, 0x41, 0xF1, 0xC0, 0xA5, 0x13, 0x38, 0x81, 0x0B, 0xE4, 0xF5, 0xD7, 0x77, 0x8E,
-    0xF6, 0xA6, 0xAD, 0xC0, 0x4B, 0x19, 0x97, 0xEF, 0xCB, 0x4C, 0x24, 0x68, 0x70, 0x7E, 0x85, 0x95,
-    0x5C, 0x8D, 0x20, 0x13, 0xF9, 0x6D, 0x93, 0xF9, 0x0F, 0x9A, 0xD4, 0x9F, 0x9F, 0x4F, 0xF1, 0x70,
-    0x10, 0x54, 0x32, 0x08, 0xB5, 0x0C, 0x10, 0x68, 0x8A, 0x40, 0x33, 0x4C, 0x8A, 0x3F, 0xC6, 0x5C,
-    0xD3, 0x03, 0x38, 0xC6, 0x05, 0xE6, 0xE5, 0x36, 0x08, 0xBD, 0x38, 0xFA, 0xDE, 0x30, 0xB7, 0x7B,
-    0x49, 0x2C, 0x3B, 0x26, 0xA1, 0x21, 0x26, 0x16, 0x14, 0x0B, 0xA3, 0x4C, 0x0D, 0xCE, 0x36, 0x06,
-    0x01, 0xB4, 0xFC, 0xB7, 0xA1, 0x73, 0xF8, 0x47, 0x4E, 0xBD, 0xBC, 0x0A, 0x5C, 0x0C, 0x9C, 0x3A,
-    0xF6, 0x18, 0xBB, 0x04, 0x08, 0x4E, 0xE0, 0x81, 0x48, 0xA4, 0x65, 0xF7, 0x13, 0x99, 0x7C, 0x31,
-    0x69, 0xE6, 0x6B, 0xF1, 0xB9, 0x0E, 0x9E, 0x62, 0xE2, 0xBE, 0xD9, 0xDE, 0xFA, 0xD3, 0xAB, 0x74,
-    0xB3, 0x12, 0xEF, 0xD2, 0x30, 0x77, 0x6E, 0x78, 0xE3, 0xA1, 0xC5, 0x48, 0x4B, 0xEF, 0xCE, 0x5A,
-    0xEE, 0x32, 0x64, 0x3D, 0xB0, 0x9B, 0x1C, 0xBF, 0x37, 0xFC, 0x91, 0x64, 0xC6, 0xB4, 0x34, 0x8D,
-    0x3D, 0xEA, 0xA0, 0xB5, 0x27, 0xAC, 0xED, 0x5B, 0x0B, 0xE0, 0xAF, 0x26, 0x57, 0xB6, 0x2B, 0x79,
-    0x6E, 0x36, 0x4C, 0xE7, 0xBD, 0xB8, 0x6F, 0x36, 0xEF, 0xF8, 0x73, 0x31, 0x45, 0xE6, 0xB7, 0x62,
-    0x24, 0x09, 0x6A, 0xE9, 0x24, 0x83, 0x3F, 0xAD, 0xA4, 0x61, 0x49, 0x14, 0x23, 0x1D, 0xD6, 0x32,
-    0x52, 0x5A, 0xD5, 0x32, 0x51, 0x45, 0x82, 0x27, 0x2A, 0x1F, 0x97, 0xD2, 0xC6, 0xF2, 0x42, 0x7B,
-    0x4D, 0xE2, 0x7F, 0xA5, 0xFD, 0x3A, 0x0D, 0xBF, 0x80, 0x1D, 0x28, 0x55, 0x60, 0xE5, 0xE9, 0x57,
-    0x8E, 0xAB, 0xF7, 0xC2, 0x96, 0x24, 0x07, 0x13, 0xB2, 0xC2, 0x1A, 0x20, 0x3B, 0xD6, 0x98, 0x78,
-    0x4B, 0x03, 0xD4, 0x17, 0x1A, 0x93, 0x37, 0xF4, 0x48, 0x0E, 0x6D, 0x3F, 0x9D, 0x17, 0xB1, 0x41,
-    0x26, 0x7A, 0x4F, 0x1E, 0x6F, 0x4A, 0x70, 0xB7, 0xAA, 0xE5, 0xD8, 0x93, 0x7F, 0x6F, 0x02, 0x2D,
-    0xE4, 0xEB, 0xD2, 0xD3, 0xED, 0x7F, 0x49, 0x54, 0x6C, 0x94, 0xC8, 0xD0, 0x5F, 0x41, 0x31, 0x99,
-    0x6A, 0x64, 0x68, 0x0C, 0x9E, 0xC9, 0x38, 0xC7, 0xA9, 0x59, 0x8E, 0x0C, 0x91, 0xE9, 0xC9, 0x16,
-    0x8F, 0xCB, 0x90, 0x4F, 0x91, 0x95, 0x4B, 0x84, 0x76, 0x14, 0xD0, 0x91, 0x89, 0xD7, 0x58, 0xBC,
-    0x68, 0x1B, 0xAF, 0x39, 0x83, 0x9C, 0x79, 0xF5, 0x0D, 0x80, 0x17, 0x3C, 0x6F, 0x24, 0xA8, 0xD5,
-    0x37, 0x46, 0x07, 0x8F, 0xA7, 0xEB, 0xA6, 0x08, 0xCC, 0x0C, 0x71, 0x84, 0x66, 0x15, 0x09, 0x44,
-    0x2E, 0x90, 0x13, 0xD0, 0x87, 0x16, 0xE8, 0x17, 0x2C, 0x28, 0xFC, 0x1B, 0x5B, 0xD2, 0x25, 0xD6,
-    0x82, 0x1D, 0xAA, 0x23, 0x3D, 0xC2, 0xCE, 0x46, 0xCA, 0x8A, 0x5B, 0xF8, 0xA0, 0x77, 0x7D, 0x98,
-    0x58, 0x1F, 0x3A, 0xCB, 0x93, 0x16, 0xC0, 0x3D, 0x82, 0x0F, 0x35, 0x52, 0x50, 0xFB, 0x1B, 0xCD,
-    0x4F, 0xFD, 0x3A, 0x7C, 0x58, 0x82, 0x06, 0xF1, 0xE7, 0x25, 0x93, 0x8E, 0xD3, 0x03, 0xD3, 0x02,
-    0xFD, 0xF0, 0x7E, 0x2D, 0x73, 0xF8, 0xD0, 0x10, 0xB8, 0x02, 0xF4, 0x2F, 0x55, 0xDE, 0xC1, 0xD7,
-    0x18, 0x95, 0xE9, 0xC3, 0x8E, 0xB0, 0x26, 0x91, 0xC1, 0x4F, 0xA2, 0x32, 0x95, 0x74, 0x6C, 0x80,
-    0x66, 0x96, 0xCC, 0x17, 0x3E, 0xF8, 0x65, 0xA8, 0x55, 0x1E, 0x94, 0x48, 0x1D, 0x98, 0x18, 0x03,
-    0xEE, 0x40, 0x27, 0x98, 0x11, 0xE8, 0x0C, 0x58, 0x07, 0xFA, 0x03, 0x7D, 0x13, 0x76, 0x03, 0x7B,
-    0x07, 0xFA, 0xE1, 0xA7, 0xB5, 0x84, 0x9F, 0x7D, 0xF9, 0x59, 0x25, 0xA7, 0x9E, 0x3D, 0x7B, 0xF6,
-    0x88, 0x0C, 0x02, 0x8F, 0x8E, 0x3F, 0xF8, 0xFD, 0x83, 0x55, 0x89, 0x3E, 0x0E, 0x51, 0x35, 0xD1,
-    0x27, 0xE1, 0x27, 0xB0, 0x3F, 0x0F, 0xDF, 0x87, 0x1D, 0x85, 0xA0, 0x5E, 0x74, 0x23, 0xBC, 0x09,
-    0x5B, 0x47, 0x88, 0x48, 0x55, 0xD6, 0x96, 0x91, 0xAD, 0x47, 0xCB, 0xF6, 0xC4, 0x90, 0x0A, 0x99,
-    0x99, 0x01, 0x98, 0x01, 0x32, 0xD4, 0x87, 0xB3, 0xAA, 0x18, 0xC9, 0x4D, 0x20, 0x39, 0x91, 0xE6,
-    0xB5, 0x50, 0x23, 0x13, 0x69, 0xA8, 0x81, 0xC2, 0x20, 0x2A, 0x6A, 0xBF, 0xEE, 0xAB, 0xB3, 0xB5,
-    0x5F, 0x8D, 0xD4, 0x5B, 0x55, 0x50, 0xDE, 0x8C, 0x83, 0x2A, 0xD0, 0x6D, 0x12, 0x20, 0x86, 0xE6,
-    0x74, 0xA8, 0xA3, 0x4F, 0x31, 0x49, 0xAB, 0x2B, 0x75, 0x3F, 0x2A, 0x30, 0xE1, 0xA4, 0xCA, 0x15,
-    0x72, 0x13, 0x4B, 0x1C, 0xA0, 0xB6, 0x05, 0x13, 0xFC, 0x4E, 0xD2, 0x88, 0x15, 0x39, 0x50, 0x66,
-    0x9E, 0xEF, 0x72, 0x6E, 0xB7, 0xA6, 0xBE, 0xB3, 0xFE, 0x4F, 0xA6, 0x03, 0xF9, 0x39, 0x7A, 0x71,
-    0xD5, 0x95, 0x76, 0xAF, 0x4D, 0x38, 0x04, 0x33, 0x3F, 0x37, 0x17, 0xBF, 0xF5, 0x66, 0xAC, 0xC3,
-    0x8E, 0x19, 0xEF, 0x28, 0x2A, 0x2D, 0x53, 0xDB, 0x22, 0xDD, 0xA0, 0x4D, 0xC2, 0x12, 0x4B, 0x00,
-    0x3C, 0x0C, 0x62, 0x8C, 0x25, 0x01, 0x0B, 0xF5, 0x2D, 0xD0, 0xC3, 0x3C, 0x44, 0x0D, 0x9B, 0x73,
-    0x38, 0xE2, 0xC8, 0xCE, 0xA1, 0x47, 0x87, 0x43, 0x4A, 0x04, 0x14, 0xE6, 0xBD, 0xB5, 0xBF, 0xFC,
-    0x77, 0xD9, 0x97, 0xE2, 0xCF, 0x30, 0x9B, 0xC2, 0x65, 0x95, 0x6B, 0x4F, 0x5F, 0x0E, 0xDE, 0xA6,
-    0xF8, 0xB0, 0xBA, 0x0F, 0xCD, 0x51, 0xDD, 0x96, 0x28, 0xB6, 0xB0, 0xAD, 0xDB, 0xD6, 0xF8, 0xBB,
-    0x63, 0x96, 0xCA, 0x4E, 0x7D, 0xEE, 0xC8, 0x79, 0x3E, 0xAE, 0x78, 0x04, 0xC3, 0x3D, 0x62, 0xC3,
-    0xB3, 0x4E, 0xE3, 0x94, 0x54, 0xE2, 0x02, 0xF8, 0xAF, 0x40, 0xB9, 0x3C, 0x4C, 0x9F, 0xF0, 0xE0,
-    0x09, 0x86, 0xA4, 0xC5, 0x90, 0x6C, 0x62, 0xE8, 0xB8, 0x79, 0xF9, 0x67, 0x26, 0xBC, 0x93, 0x63,
-    0xB3, 0xD9, 0x79, 0xC4, 0xB8, 0x4C, 0xE5, 0x4A, 0x89, 0x5B, 0x42, 0x2D, 0x02, 0xD9, 0x55, 0xA1,
-    0x58, 0x03, 0x40, 0x33, 0xCE, 0x81, 0x41, 0xEC, 0xD0, 0x10, 0x2B, 0xC7, 0xC6, 0x99, 0x83, 0xEF,
-    0x6E, 0x22, 0xEA, 0x60, 0x4F, 0xCD, 0xEE, 0x22, 0xB8, 0xE8, 0x01, 0x0D, 0x09, 0xA9, 0xF8, 0x20,
-    0xC1, 0xB1, 0xBE, 0x79, 0x87, 0x12, 0x8C, 0xD5, 0x27, 0x32, 0xBA, 0x9F, 0x95, 0x36, 0x84, 0x45,
-    0xED, 0x64, 0x34, 0x97, 0x69, 0x8E, 0xEC, 0x57, 0xD6, 0xC5, 0xE7, 0xB8, 0x69, 0x5D, 0x5D, 0xD9,
-    0xE2, 0x7E, 0x23, 0xBF, 0xE4, 0x9E, 0xF9, 0xAD, 0xD3, 0xE7, 0xDB, 0x62, 0xFB, 0x96, 0x55, 0xEB,
-    0x89, 0x43, 0xB6, 0x75, 0x2A, 0xDE, 0xDA, 0x3E, 0x88, 0xFD, 0xF8, 0xE3, 0xD5, 0x76, 0xD0, 0x06,
-    0xF1, 0x5E, 0x0E, 0x77, 0x33, 0xDF, 0xD4, 0xE0, 0x53, 0x1A, 0x3D, 0xE9, 0x40, 0x96, 0x89, 0xCA,
-    0x47, 0xA1, 0xF6, 0x40, 0x8F, 0x11, 0xC5, 0x2F, 0x85, 0xFA, 0x15, 0x2C, 0x9C, 0x89, 0xFA, 0x9D,
-    0x91, 0x15, 0xBF, 0x89, 0xE1, 0x04, 0xF4, 0x3B, 0x01, 0xCF, 0xA6, 0xD6, 0x0F, 0x69, 0x5D, 0xEE,
-    0x9D, 0xE8, 0x2E, 0xFC, 0xF5, 0x17, 0x3F, 0x95, 0xFD, 0x09, 0x16, 0x3F, 0xE5, 0x5E, 0x2C, 0x53,
-    0x8B, 0x46, 0x45, 0xA8, 0x30, 0x15, 0x25, 0x00, 0x5C, 0xCE, 0xD2, 0x78, 0x2C, 0x22, 0xCE, 0x54,
-    0x64, 0xAE, 0x62, 0x3F, 0x52, 0xBF, 0x20, 0x86, 0xEC, 0xC6, 0x11, 0x0F, 0xB1, 0xEC, 0xE1, 0xC3,
-    0x93, 0xA4, 0xD0, 0x88, 0x18, 0x76, 0x7F, 0xAB, 0xB0, 0xDB, 0x73, 0x94, 0xF1, 0x17, 0xA8, 0x65,
-    0x15, 0xE5, 0x28, 0x85, 0x9E, 0xD3, 0xDF, 0x5D, 0xB3, 0x47, 0x29, 0x6E, 0xE0, 0x53, 0x9C, 0x7C,
-    0x26, 0x67, 0x4A, 0xB1, 0x22, 0xF1, 0x64, 0xEB, 0x42, 0x0D, 0xE6, 0x60, 0xDE, 0xA9, 0x97, 0x6B,
-    0xF3, 0x9C, 0x2A, 0x40, 0x78, 0xA0, 0x10, 0x25, 0xC6, 0x7E, 0xF6, 0xF4, 0xDA, 0x16, 0xA6, 0xA1,
-    0xA2, 0x21, 0x29, 0xE4, 0xC3, 0x98, 0x7C, 0x45, 0x27, 0x8E, 0x19, 0xC5, 0x5E, 0x9F, 0xDC, 0x6B,
-    0x96, 0x23, 0x59, 0xDC, 0x21, 0x1C, 0x53, 0x77, 0x8A, 0xB2, 0x60, 0x2F, 0x9F, 0x73, 0x1D, 0xCE,
-    0x9C, 0x3E, 0xB8, 0xA0, 0xFD, 0x19, 0x7A, 0x54, 0x58, 0x2F, 0xB1, 0x24, 0xBE, 0x8B, 0xF1, 0xA2,
-    0xCF, 0x3B, 0x4B, 0x9F, 0x5B, 0x5D, 0x66, 0xCB, 0xBD, 0xC1, 0x5D, 0x40, 0xB2, 0xCE, 0x99, 0xCD,
-    0x31, 0x74, 0xB4, 0x4A, 0xA5, 0xF3, 0xCB, 0x65, 0xE8, 0x2A, 0xD4, 0x6C, 0x25, 0x80, 0xA6, 0x64,
-    0xE7, 0xA0, 0x90, 0xF1, 0xB3, 0xB3, 0x0D, 0x3B, 0x7A, 0xCD, 0x12, 0x5C, 0x75, 0x37, 0x03, 0xD7,
-    0x01, 0x0F, 0xB8, 0xEC, 0x10, 0xBF, 0x80, 0xEE, 0x44, 0xED, 0x0E, 0xA6, 0x09, 0xFD, 0x1C, 0xD0,
-    0x74, 0x7D, 0xCE, 0x18, 0x00, 0x1B, 0x84, 0x09, 0x21, 0xE6, 0x1D, 0x4A, 0xA7, 0xAC, 0xA7, 0x84,
-    0x9B, 0x9A, 0x86, 0x5C, 0x6F, 0x2C, 0x9B, 0x80, 0xA3, 0x22, 0x38, 0x90, 0x22, 0x62, 0x11, 0xB3,
-    0x4A, 0x32, 0xD6, 0xCB, 0xF2, 0x5E, 0xBB, 0xEF, 0x11, 0x98, 0x98, 0x95, 0xAB, 0x7E, 0x68, 0x2C,
-    0x71, 0xED, 0xB5, 0x22, 0xDF, 0x31, 0x99, 0x1C, 0x5A, 0x5B, 0x9B, 0x16, 0xDC, 0x54, 0x1F, 0x1C,
-    0x9A, 0xC7, 0x24, 0x78, 0x2E, 0x47, 0xCD, 0xD6, 0xD0, 0x2A, 0xB0, 0x24, 0x4F, 0x21, 0x20, 0xAA,
-    0xD8, 0xB7, 0x86, 0xB5, 0x0B, 0xBD, 0xED, 0x69, 0x77, 0x6F, 0x41, 0x94, 0xB9, 0xBB, 0xC6, 0xEC,
-    0x43, 0x77, 0xCB, 0xA2, 0x8B, 0xA7, 0x7F, 0xF8, 0xB1, 0xF8, 0xDD, 0xE1, 0x7D, 0xE8, 0xE6, 0xFF,
-    0x0F, 0xDD, 0xEB, 0x08, 0x9E, 0x24, 0xE9, 0xA4, 0x62, 0x97, 0xA2, 0xF1, 0x4B, 0x76, 0x2D, 0x1C,
-    0xB1, 0x42, 0x93, 0xBD, 0x8D, 0x8D, 0xE3, 0x67, 0xEF, 0x2C, 0x6E, 0x69, 0x48, 0x20, 0x79, 0x29,
-    0xFB, 0xD1, 0xE5, 0x67, 0x89, 0x7B, 0xF5, 0xB9, 0xD7, 0x04, 0x18, 0xF5, 0xE6, 0xD7, 0x5E, 0xAE,
-    0x26, 0x08, 0xA6, 0xEC, 0x6D, 0x5E, 0xB8, 0x07, 0xD4, 0x80, 0x0D, 0x7A, 0x2D, 0x4C, 0x85, 0xC0,
-    0xD0, 0x97, 0x72, 0x10, 0x39, 0x26, 0x64, 0xEC, 0xA5, 0xC4, 0x5A, 0x15, 0x03, 0xA6, 0x6D, 0x99,
-    0xA8, 0x8F, 0xC8, 0xAB, 0x65, 0x7A, 0x0A, 0x65, 0x80, 0x94, 0xB5, 0x8B, 0xF6, 0xBA, 0x5B, 0x43,
-    0x64, 0x2E, 0x70, 0xC0, 0x50, 0xFC, 0xE8, 0xE2, 0x0E, 0xC0, 0x54, 0xBB, 0x9D, 0xAB, 0xDA, 0xC2,
-    0x8E, 0xAD, 0xCD, 0x6C, 0x5E, 0x94, 0xAD, 0x53, 0xDF, 0xB8, 0x07, 0x76, 0x28, 0xB2, 0x35, 0x82,
-    0x86, 0xFB, 0xED, 0x43, 0xBD, 0x2B, 0x8D, 0x7C, 0xFF, 0xD6, 0xDF, 0xBF, 0x6E, 0xE4, 0x97, 0x77,
-    0x2B, 0xD8, 0xEF, 0x5D, 0xD1, 0x0F, 0x21, 0x14, 0x6F, 0xE9, 0x6F, 0x20, 0xF9, 0xDB, 0xF7, 0x71,
-    0x54, 0x64, 0xAF, 0x7F, 0x87, 0xC3, 0x77, 0x01, 0xC8, 0xB7, 0xC2, 0xA0, 0x60, 0xF0, 0x9E, 0x55,
-    0x78, 0x33, 0x43, 0x2A, 0x67, 0x07, 0x87, 0xB8, 0x88, 0x51, 0xD0, 0x87, 0xC3, 0xF3, 0xBC, 0x8F,
-    0xD9, 0xEB, 0x18, 0xB3, 0x48, 0x2E, 0xC6, 0x0B, 0xC9, 0xCF, 0xE4, 0x7F, 0x6F, 0xDA, 0x9D, 0x2B,
-    0x14, 0x52, 0x94, 0x55, 0xCA, 0x2F, 0x38, 0xD8, 0x86, 0xEC, 0xC5, 0xEC, 0xAC, 0xB6, 0x74, 0xAD,
-    0xE8, 0x56, 0xB1, 0xBD, 0x19, 0x36, 0x4E, 0x71, 0x63, 0x0D, 0xBA, 0x60, 0xCB, 0x3F, 0xBA, 0x2D,
-    0x79, 0x04, 0x8F, 0x23, 0x0B, 0x83, 0xBD, 0x65, 0x6E, 0xFF, 0xE5, 0x05, 0x8F, 0x12, 0xEB, 0xC7,
-    0x11, 0x49, 0x7B, 0x35, 0x16, 0xAF, 0xCA, 0xF4, 0x91, 0xC4, 0x28, 0xE5, 0xD3, 0x14, 0xC0, 0x2D,
-    0x53, 0x78, 0xE6, 0x91, 0x24, 0x58, 0x33, 0xAD, 0xE5, 0xC0, 0xDB, 0xB5, 0xA4, 0xD8, 0x67, 0x19,
-    0xF2, 0x3F, 0xC1, 0x53, 0xBC, 0x38, 0x20, 0x81, 0x45, 0x5C, 0xAA, 0x8F, 0x4C, 0x1E, 0xA3, 0xFE,
-    0x13, 0xD6, 0xD9, 0x6E, 0x9B, 0x23, 0xB8, 0x09, 0xA3, 0xE9, 0xF3, 0x22, 0xF8, 0x2B, 0x92, 0xE3,
-    0xF2, 0x1B, 0x0C, 0x76, 0x05, 0x6D, 0x91, 0x44, 0xD0, 0xBD, 0xF9, 0xDA, 0x7A, 0x4D, 0xEA, 0xDD,
-    0x20, 0xF5, 0xDE, 0x24, 0x53, 0xCE, 0xC8, 0xF3, 0xAF, 0xCB, 0x37, 0x65, 0x7B, 0xBB, 0xBE, 0xEE,
-    0xCD, 0x56, 0x56, 0x6A, 0xAF, 0x39, 0x19, 0x6B, 0xAB, 0x72, 0x09, 0x9D, 0x3F, 0x63, 0xD3, 0x33,
-    0xB3, 0x17, 0x2B, 0x72, 0x5E, 0x59, 0xD9, 0x75, 0xA2, 0xEB, 0xAE, 0x9B, 0x56, 0x73, 0x9C, 0xE8,
-    0x38, 0xD5, 0x71, 0xB2, 0x63, 0x43, 0x96, 0xA3, 0x33, 0x77, 0xCB, 0x6F, 0xC5, 0x95, 0x95, 0xCC,
-    0xFD, 0x3A, 0xC9, 0xBD, 0x16, 0x14, 0x44, 0x28, 0x41, 0x05, 0x95, 0x2F, 0xC3, 0x32, 0xD2, 0xEE,
-    0x4F, 0xB9, 0xBF, 0xC2, 0xFE, 0x31, 0x63, 0x79, 0x9C, 0x3B, 0x05, 0x20, 0x62, 0x99, 0xCD, 0x5D,
-    0xEA, 0x8E, 0x0C, 0xCD, 0x96, 0xB8, 0x0B, 0xB9, 0xBA, 0x87, 0x56, 0x84, 0xEB, 0x6F, 0xB3, 0x73,
-    0x5F, 0x80, 0xC9, 0x68, 0x52, 0xC2, 0x3F, 0xA0, 0xE0, 0x8E, 0x24, 0xD1, 0x87, 0xE6, 0xD7, 0x0C,
-    0x0B, 0x13, 0x44, 0x9B, 0xFF, 0xE9, 0xD5, 0xFE, 0x96, 0xD1, 0xB9, 0x31, 0xCD, 0xDE, 0xBB, 0x40,
-    0xF4, 0xEA, 0x9B, 0x43, 0x85, 0x61, 0xAF, 0xA4, 0xE1, 0x2B, 0x53, 0x40, 0x61, 0x19, 0x43, 0x58,
-    0x7C, 0xF3, 0x15, 0x6E, 0x2C, 0xDB, 0xA8, 0xCD, 0xE4, 0x37, 0x21, 0xDF, 0xB6, 0x22, 0x44, 0xCE,
-    0x57, 0xAE, 0xF6, 0xF0, 0x61, 0x1C, 0x8F, 0xF7, 0x2E, 0xF7, 0x82, 0xB1, 0xDF, 0xF8, 0xBB, 0xDD,
-    0xC0, 0x09, 0xF3, 0x6D, 0x77, 0x3F, 0x07, 0x65, 0x2F, 0xEE, 0x48, 0x0F, 0x0C, 0x5F, 0x8F, 0xD0,
-    0xC5, 0x7D, 0xBC, 0x9E, 0x05, 0xF8, 0x8E, 0x01, 0xFA, 0x14, 0xE7, 0xCE, 0x2E, 0x40, 0x00, 0xBD,
-    0x0E, 0xB1, 0x75, 0xD8, 0x87, 0x35, 0xDE, 0x05, 0x95, 0xD7, 0x04, 0xB8, 0xFC, 0xB1, 0x12, 0x23,
-    0xDB, 0x1F, 0x2E, 0x01, 0xBC, 0xA8, 0xA4, 0x40, 0xC6, 0xF6, 0x8A, 0x1A, 0x40, 0xAE, 0x43, 0x5C,
-    0x2A, 0x94, 0x5E, 0xF6, 0xA6, 0xF9, 0x18, 0x73, 0xA6, 0xB8, 0xAC, 0x84, 0x3F, 0x40, 0x80, 0x70,
-    0x16, 0xBE, 0xCA, 0x7F, 0x00, 0xB3, 0xFF, 0xCF, 0x60, 0xFF, 0x9F, 0x41, 0x34, 0x94, 0x01, 0x00,
-    0xB5, 0x94, 0x3D, 0x6E, 0xDC, 0x30, 0x10, 0x46, 0x87, 0x52, 0x36, 0x2A, 0x54, 0xD0, 0x45, 0xAA,
-    0x34, 0x3A, 0x82, 0x4E, 0x20, 0x2D, 0x91, 0x36, 0x8D, 0x0B, 0xE7, 0x18, 0x81, 0x2F, 0xB0, 0x0B,
-    0xE9, 0x08, 0x39, 0x82, 0x4B, 0x23, 0x4D, 0x2E, 0xA0, 0xC0, 0x4C, 0x95, 0x76, 0x8F, 0xB0, 0x85,
-    0x1B, 0x77, 0x34, 0xC0, 0x42, 0x01, 0x1C, 0x4D, 0xE6, 0x1B, 0x52, 0x1B, 0xFF, 0x00, 0xA9, 0xE2,
-    0x86, 0x03, 0xAF, 0x67, 0xC9, 0xF7, 0x0D, 0x1F, 0x97, 0x88, 0xDE, 0x91, 0x21, 0xA2, 0x82, 0xFD,
-    0x4D, 0x20, 0xB2, 0xFC, 0x81, 0xA5, 0x34, 0xAE, 0x3C, 0xCA, 0x87, 0x2D, 0x55, 0x5E, 0x4A, 0x4F,
-    0x35, 0xCA, 0x9E, 0xEC, 0x48, 0x64, 0x96, 0xAF, 0xDF, 0xEE, 0xA4, 0x83, 0x99, 0x17, 0xA2, 0xCD,
-    0xAF, 0x4F, 0x97, 0x17, 0xF2, 0xBF, 0x48, 0x5B, 0x59, 0x4D, 0x90, 0x5E, 0xD9, 0x2B, 0x50, 0x97,
-    0xCA, 0x4E, 0x8A, 0xEC, 0x34, 0xA1, 0x1C, 0x68, 0x96, 0x22, 0x1B, 0xA2, 0xD4, 0xDE, 0x44, 0x29,
-    0xD6, 0xCB, 0x57, 0xA4, 0x8C, 0x85, 0x96, 0x74, 0x6A, 0x83, 0xDE, 0xE7, 0x87, 0xF7, 0xD2, 0x7B,
-    0x62, 0x90, 0x0D, 0x1B, 0x27, 0x07, 0xCC, 0x6F, 0x06, 0xF9, 0x63, 0x08, 0xF6, 0x41, 0xCA, 0x76,
-    0xB4, 0xF8, 0x36, 0x21, 0x91, 0x06, 0xFA, 0xE1, 0x90, 0xE7, 0xA3, 0x47, 0x1C, 0x7C, 0xB9, 0xA5,
-    0xB7, 0x8E, 0x14, 0x10, 0xFB, 0x00, 0x77, 0xB9, 0x7A, 0x8F, 0x24, 0xA1, 0x47, 0x90, 0xF3, 0x5E,
-    0x73, 0x74, 0x1A, 0x63, 0xA7, 0xF8, 0x93, 0xAE, 0xB3, 0x66, 0x88, 0x88, 0x00, 0xE8, 0xCA, 0x03,
-    0xB6, 0xD6, 0xD5, 0x7A, 0x10, 0xDB, 0x11, 0xC0, 0xD6, 0x81, 0xB7, 0x51, 0xDC, 0x56, 0x69, 0xD3,
-    0x51, 0x8F, 0x0E, 0xD4, 0x41, 0x08, 0x36, 0x29, 0x35, 0x29, 0x34, 0x3D, 0x61, 0xFE, 0xE9, 0x9F,
-    0x33, 0x23, 0xAF, 0x84, 0x77, 0xD8, 0xA2, 0x51, 0xE6, 0xF6, 0x05, 0xF3, 0xFE, 0x9F, 0xCC, 0xE1,
-    0x2F, 0x73, 0xF9, 0x9F, 0x99, 0x0D, 0xAD, 0xEA, 0x9C, 0x27, 0x77, 0xEE, 0x63, 0x92, 0xA7, 0x88,
-    0xF9, 0x02, 0xAF, 0x4E, 0x37, 0xB8, 0xDE, 0x9D, 0x0A, 0x54, 0x8C, 0xC9, 0x20, 0xE9, 0x50, 0x85,
-    0xD0, 0x01, 0x87, 0xA4, 0x43, 0x25, 0x92, 0xBC, 0x6A, 0x51, 0x93, 0x35, 0x6A, 0xB3, 0x47, 0xDB,
-    0x2C, 0x52, 0x9F, 0x4D, 0xEA, 0xB2, 0x4A, 0xBB, 0xEC, 0xD2, 0x94, 0x65, 0x7A, 0xC8, 0x36, 0xCD,
-    0x49, 0x27, 0x93, 0x71, 0x30, 0x8B, 0x15, 0x27, 0x1B, 0xB5, 0x62, 0x65, 0xA7, 0x56, 0xA9, 0x56,
-    0xAB, 0x1E, 0x69, 0xF5, 0x24, 0xEF, 0x9C, 0xDF, 0x4A, 0xCE, 0x8B, 0x8D, 0xDB, 0x3C, 0x66, 0x1C,
-    0x80, 0x11, 0xEF, 0xD3, 0x90, 0x35, 0x6F, 0x75, 0x48, 0x79, 0xEB, 0x57, 0xCA, 0x3B, 0xBF, 0x4E,
-    0x5E, 0xBC, 0x5B, 0xC6, 0x63, 0xB4, 0x0C, 0x01, 0xB6, 0xF4, 0x5D, 0xD6, 0x4E, 0xF5, 0x98, 0xF4,
-    0x8D, 0x4F, 0xFA, 0xC4, 0xE7, 0x62, 0xB9, 0x96, 0x3C, 0x8D, 0x34, 0x99, 0x20, 0x56, 0x4A, 0x06,
-    0x10, 0x94, 0x01, 0xE3, 0x10, 0x19, 0xB0, 0x1E, 0x30, 0x92, 0xCA, 0xC3, 0xBA, 0xDA, 0x57, 0x70,
-    0xCF, 0x83, 0xCB, 0x8E, 0x36, 0xC9, 0x3E, 0x82, 0x1C, 0xEB, 0x49, 0x79, 0xC6, 0x51, 0x25, 0xAB,
-    0x87, 0x67, 0xD9, 0x43, 0x52, 0x46, 0xFD, 0x09, 0xA1, 0x4A, 0x6D, 0xBC, 0x39, 0xE8, 0xEA, 0x32,
-    0xF3, 0x26, 0xDD, 0xD0, 0x51, 0x99, 0xD1, 0xDC, 0xB8, 0x41, 0xC3, 0xB7, 0x27, 0xF2, 0x0E, 0xE4,
-    0x97, 0x8B, 0xE1, 0xEB, 0x82, 0x59, 0x9A, 0xEA, 0xDB, 0xCF, 0x9B, 0xDF, 0x17, 0xC0, 0x98, 0xF5,
-    0xE8, 0x88, 0x41, 0xC9, 0xE4, 0xAA, 0x88, 0xBB, 0x28, 0x16, 0xC2, 0xAB, 0x19, 0xF4, 0x4A, 0xEB,
-    0x00, 0x7E, 0x13, 0xF5, 0x97, 0x69, 0xD6, 0xB9, 0x46, 0x59, 0xBF, 0x94, 0x41, 0x56, 0xE6, 0x63,
-    0xC5, 0x6E, 0x60, 0x57, 0xB0, 0x33, 0x0E, 0xE3, 0xFB, 0x03, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21,
+static const uint8_t notosans_14_italicBitmaps[35102] = {
+    0xB5, 0x58, 0x3B, 0x8C, 0xDC, 0xD6, 0x15, 0xBD, 0x24, 0xBD, 0x22, 0x60, 0x02, 0x79, 0x2A, 0x56,
+    0x80, 0xE3, 0x45, 0x40, 0x17, 0x29, 0x8C, 0x00, 0x11, 0x5B, 0x07, 0x58, 0x7E, 0x64, 0x97, 0x6A,
+    0xB6, 0xD0, 0x3A, 0x40, 0x0C, 0x44, 0xAD, 0x11, 0x20, 0x50, 0xE3, 0x26, 0xC0, 0xCC, 0x0E, 0x61,
+    0x17, 0x2E, 0x52, 0x78, 0x1B, 0xD7, 0x56, 0xA1, 0x22, 0x50, 0x11, 0x35, 0x2E, 0x04, 0x64, 0x56,
+    0x43, 0xDB, 0x85, 0x0B, 0x17, 0x61, 0xE2, 0x28, 0x29, 0x52, 0x88, 0x8E, 0x95, 0x04, 0x89, 0x0B,
+    0x53, 0x09, 0x05, 0x51, 0x11, 0x67, 0x98, 0x73, 0xEE, 0x23, 0x77, 0x66, 0x57, 0x56, 0xAC, 0x20,
+    0xCE, 0x68, 0xC8, 0xD5, 0xF0, 0x73, 0xBF, 0xE7, 0xDE, 0x7B, 0xDE, 0x93, 0x54, 0xE4, 0x40, 0xE4,
+    0x48, 0x64, 0x2E, 0xD2, 0x89, 0xB4, 0x22, 0x8D, 0x38, 0xB5, 0xB8, 0xB5, 0x78, 0x95, 0x78, 0xA5,
+    0x78, 0x85, 0xF8, 0xF8, 0xE6, 0x12, 0x64, 0x62, 0x3F, 0x5B, 0x22, 0x78, 0x69, 0xA6, 0xDF, 0x6D,
+    0xFC, 0xC6, 0x43, 0x26, 0x97, 0x48, 0x64, 0xC2, 0x77, 0xBD, 0x5A, 0x7C, 0x5C, 0x28, 0xC4, 0x64,
+    0xBC, 0x96, 0x88, 0xC4, 0x7A, 0x67, 0xAE, 0xDF, 0x76, 0xE3, 0x7B, 0x53, 0xAF, 0xE0, 0xD6, 0xAE,
+    0xC8, 0xF7, 0x45, 0x42, 0x91, 0x67, 0x21, 0x0D, 0x6A, 0xA0, 0x0F, 0x5A, 0xDD, 0x8A, 0x46, 0x38,
+    0xFA, 0x95, 0x9A, 0xA2, 0x65, 0xFC, 0xB9, 0x69, 0x5F, 0x50, 0x50, 0x7B, 0xA8, 0x9A, 0xAC, 0x01,
+    0x15, 0xAF, 0xE1, 0xC2, 0x8B, 0x90, 0xB6, 0xE7, 0x36, 0x5E, 0xED, 0x17, 0x26, 0x0F, 0xE5, 0xBC,
+    0xBC, 0x24, 0x69, 0xCF, 0xEF, 0xB9, 0x7D, 0xF8, 0x90, 0xC2, 0xFC, 0x99, 0xDA, 0x8F, 0x8F, 0xDF,
+    0xC3, 0xA7, 0xBE, 0x90, 0x95, 0x5F, 0xBB, 0x8D, 0x5B, 0x7B, 0x95, 0xD3, 0x40, 0x46, 0x0B, 0xC1,
+    0x6D, 0x98, 0x49, 0x0B, 0x3F, 0x5A, 0xB8, 0xDC, 0x24, 0xE2, 0x34, 0x31, 0x54, 0x4F, 0xE1, 0x25,
+    0x8E, 0x6A, 0x0A, 0x57, 0xA7, 0xF0, 0x35, 0x96, 0x30, 0x4F, 0x21, 0x31, 0xCA, 0x97, 0x62, 0x7A,
+    0x98, 0x00, 0x51, 0x36, 0x34, 0x95, 0x44, 0xA5, 0xD3, 0x17, 0xC1, 0xA3, 0x22, 0x7D, 0xA7, 0xF8,
+    0x0E, 0xE4, 0x21, 0x2A, 0x30, 0xED, 0x38, 0x30, 0xD3, 0x8D, 0xC0, 0x1C, 0xC7, 0x5D, 0x5D, 0x43,
+    0x10, 0xF5, 0xE3, 0xF6, 0xA5, 0x44, 0x7D, 0x2B, 0x07, 0x17, 0x96, 0xF2, 0x02, 0x53, 0xC5, 0xE0,
+    0xEB, 0x01, 0x09, 0x7C, 0x9F, 0xAF, 0xE2, 0x15, 0x31, 0x78, 0x21, 0x45, 0x8E, 0x96, 0xF6, 0x67,
+    0x58, 0x68, 0x82, 0x1C, 0xDC, 0x0D, 0x2A, 0x68, 0x7C, 0x77, 0x7F, 0x2F, 0xED, 0xFB, 0x6A, 0x86,
+    0x63, 0x70, 0xB9, 0x94, 0x19, 0xE4, 0xDE, 0x72, 0x3A, 0xC8, 0x9D, 0x0E, 0xF2, 0x60, 0x12, 0xA3,
+    0x48, 0x99, 0x7E, 0x2D, 0x61, 0x8F, 0x1C, 0x02, 0x14, 0x5B, 0xB3, 0x1C, 0x52, 0x4A, 0x2B, 0x78,
+    0xF3, 0x08, 0xCA, 0x1F, 0x48, 0x54, 0x40, 0xAE, 0xEC, 0xC0, 0xED, 0x21, 0x9A, 0xF0, 0xC6, 0xC5,
+    0x4B, 0x01, 0x8E, 0x10, 0x39, 0x9E, 0xE2, 0x46, 0x0B, 0x97, 0x3E, 0xAB, 0xC5, 0x7C, 0x58, 0x4B,
+    0x04, 0xDF, 0xE6, 0x5E, 0xE9, 0x34, 0x7E, 0xE1, 0x97, 0x01, 0x32, 0x63, 0xF2, 0x04, 0x19, 0x84,
+    0x5D, 0xAB, 0x45, 0xDF, 0x2F, 0xCF, 0xED, 0xCF, 0x2E, 0x9D, 0x34, 0x05, 0x47, 0xD4, 0x77, 0x48,
+    0x0F, 0x62, 0x70, 0xFD, 0x1A, 0xA5, 0xD3, 0x3A, 0xC2, 0x81, 0xC0, 0x00, 0x4A, 0xC4, 0xFB, 0xFB,
+    0x35, 0xB8, 0xB3, 0x12, 0xF7, 0xDD, 0x05, 0xEC, 0x04, 0xF4, 0x34, 0x78, 0x5E, 0x65, 0x0F, 0xFE,
+    0x1F, 0xC9, 0x44, 0x8A, 0xDE, 0x97, 0x85, 0x2C, 0x20, 0x2A, 0x82, 0xEB, 0xB2, 0x37, 0xA0, 0xD9,
+    0x59, 0x34, 0xC8, 0x59, 0x2D, 0xE9, 0xE1, 0xD9, 0x31, 0x74, 0x7C, 0x83, 0x52, 0x90, 0x7A, 0x89,
+    0xC2, 0x56, 0x92, 0x05, 0x60, 0x53, 0x46, 0xF9, 0x0C, 0x57, 0x8F, 0x20, 0x6B, 0x0E, 0x84, 0xCE,
+    0xF5, 0x2F, 0x0F, 0x93, 0x4D, 0x91, 0xCF, 0x34, 0x3B, 0x42, 0xB8, 0x5A, 0x0D, 0x2B, 0xE3, 0x60,
+    0xFA, 0xBE, 0x0D, 0x71, 0x6C, 0xED, 0xBF, 0x5A, 0x5B, 0x3B, 0x68, 0x03, 0x00, 0xC0, 0xDC, 0x6B,
+    0xB8, 0x11, 0x1E, 0x77, 0xE3, 0x16, 0x95, 0xA5, 0xEB, 0x8C, 0x8E, 0xB7, 0xCC, 0xC6, 0xAD, 0x63,
+    0x3C, 0x84, 0x08, 0xF6, 0xEC, 0x42, 0x87, 0x58, 0x4C, 0xF1, 0x6C, 0x3C, 0x1C, 0x73, 0x99, 0x3B,
+    0x8D, 0xA4, 0x97, 0x51, 0x7D, 0x2B, 0xE4, 0xBE, 0x13, 0x77, 0x39, 0xCB, 0x4C, 0x69, 0x8A, 0x30,
+    0xF3, 0xAA, 0x14, 0x9E, 0x25, 0xC3, 0x91, 0xC2, 0xC3, 0xA8, 0x08, 0x0B, 0xD8, 0x08, 0x71, 0xAD,
+    0x56, 0xB4, 0x7E, 0x02, 0x94, 0xC1, 0x0C, 0xF2, 0x97, 0x7E, 0xED, 0xD5, 0xC8, 0x50, 0x29, 0x2D,
+    0x4C, 0xEB, 0x60, 0xF5, 0x78, 0xE0, 0xB7, 0xD7, 0xFA, 0x95, 0x69, 0xBC, 0x7E, 0x55, 0xCB, 0xE2,
+    0x4F, 0x83, 0x95, 0x7E, 0xB1, 0xB6, 0xF4, 0x40, 0xCE, 0xBA, 0x4C, 0x17, 0x42, 0x0A, 0xF8, 0x38,
+    0xDA, 0x35, 0x9C, 0xC6, 0x6B, 0xBD, 0xC6, 0xAD, 0xE4, 0xD4, 0xE7, 0x64, 0x19, 0xE2, 0xED, 0x34,
+    0x27, 0x86, 0xCF, 0xCB, 0x13, 0x3F, 0x7B, 0xDA, 0x60, 0xB4, 0xC4, 0x6D, 0x29, 0x01, 0x26, 0x2F,
+    0xE9, 0x9D, 0x33, 0xFD, 0x61, 0xDA, 0x37, 0xE7, 0x5F, 0xEE, 0xC6, 0xB6, 0x32, 0x61, 0x8C, 0x11,
+    0x11, 0xC0, 0x3F, 0xCA, 0x65, 0x25, 0x5E, 0x43, 0x3B, 0xF1, 0x96, 0x19, 0x85, 0x3D, 0xA7, 0x25,
+    0xB2, 0xD0, 0xF6, 0xB7, 0x6D, 0xED, 0x64, 0xD1, 0x12, 0x5E, 0x01, 0x4F, 0x86, 0x60, 0x8B, 0x08,
+    0xC2, 0x98, 0xA7, 0x6E, 0x57, 0xB4, 0x01, 0xC0, 0x84, 0x98, 0x28, 0x49, 0x98, 0xD0, 0x84, 0x9D,
+    0x2B, 0x62, 0xFB, 0x40, 0xF0, 0x16, 0x3C, 0xAD, 0xAE, 0xDF, 0x60, 0xFA, 0x18, 0x75, 0x68, 0x63,
+    0x27, 0xCC, 0x43, 0x14, 0x3E, 0x3A, 0x04, 0x62, 0x34, 0xD5, 0x6C, 0xCF, 0x56, 0x39, 0x1F, 0x86,
+    0x8E, 0xE5, 0xAB, 0x2B, 0xE6, 0x3B, 0xA5, 0xEA, 0x88, 0xAF, 0x0D, 0x27, 0xBC, 0x7B, 0x80, 0xF6,
+    0x86, 0x48, 0xFA, 0x3D, 0x32, 0x12, 0xF4, 0x88, 0xA5, 0x29, 0x76, 0x20, 0x31, 0x77, 0x1B, 0x3A,
+    0xD1, 0xD2, 0xF9, 0x8E, 0x9A, 0x3B, 0x94, 0x0B, 0xCA, 0x9C, 0x99, 0x05, 0x1E, 0xAE, 0xB0, 0xAC,
+    0xF1, 0xF0, 0xA2, 0xBF, 0x3B, 0xBA, 0xE9, 0xF4, 0x0F, 0x61, 0xA4, 0xDA, 0x77, 0xF8, 0x63, 0xAD,
+    0x4D, 0x16, 0xB7, 0xCD, 0x18, 0xCA, 0x62, 0x68, 0x27, 0x5A, 0x74, 0x0A, 0x3F, 0xAD, 0x31, 0xE2,
+    0xF3, 0xB1, 0x93, 0xDE, 0x60, 0x0F, 0xD2, 0x4E, 0x23, 0x61, 0x75, 0x26, 0xA3, 0x69, 0x39, 0x54,
+    0x40, 0xA5, 0x4D, 0xF6, 0x6C, 0x95, 0x8D, 0xBE, 0xBD, 0xA6, 0xBE, 0xCD, 0x32, 0xF8, 0x66, 0x0A,
+    0xB8, 0x15, 0xF0, 0xE4, 0x97, 0x6C, 0xDC, 0x15, 0x47, 0x4B, 0xC5, 0x4E, 0x5F, 0x21, 0x1E, 0x3E,
+    0x50, 0x8A, 0x66, 0xC2, 0xFE, 0x58, 0x30, 0x41, 0x39, 0x7B, 0x64, 0x16, 0x31, 0x3D, 0xF0, 0x8D,
+    0x0E, 0x06, 0x8D, 0x1C, 0xEC, 0x2F, 0xE8, 0xDB, 0x8A, 0xD2, 0x0F, 0xA9, 0x08, 0xA5, 0xCC, 0x72,
+    0x5E, 0xEE, 0x5F, 0xD2, 0x6E, 0xD0, 0xD8, 0xAA, 0x19, 0x2B, 0x07, 0x0A, 0x18, 0xBB, 0x9C, 0xA1,
+    0x33, 0xB7, 0xF7, 0xB5, 0xF6, 0x20, 0x9B, 0x61, 0xD3, 0x1A, 0x4C, 0x86, 0xE3, 0x00, 0xAF, 0x8F,
+    0xA2, 0x9E, 0x4A, 0x26, 0xFB, 0x09, 0x65, 0xF2, 0x78, 0x82, 0xCC, 0xE9, 0xD0, 0xBB, 0xE6, 0xC7,
+    0xB8, 0x75, 0x16, 0x08, 0x0B, 0x72, 0x50, 0xC8, 0xE2, 0x77, 0xAF, 0x15, 0xEE, 0xF2, 0x29, 0x72,
+    0x10, 0xF6, 0xCC, 0x2F, 0x4F, 0xE7, 0x66, 0x0C, 0x7F, 0xC2, 0xD3, 0xD4, 0x82, 0xFB, 0x80, 0x0F,
+    0xA4, 0x8A, 0x02, 0xCC, 0x2A, 0xFA, 0x59, 0x0F, 0x61, 0xD1, 0x1C, 0x4C, 0x38, 0x5D, 0x75, 0xAA,
+    0xE8, 0x5C, 0x69, 0xE1, 0x08, 0x9E, 0x72, 0x6B, 0xB7, 0xB6, 0x27, 0x84, 0x9F, 0xC3, 0x13, 0xEE,
+    0xA0, 0x0B, 0xF7, 0xB0, 0x2A, 0xE0, 0x09, 0x51, 0xBA, 0x9C, 0xEB, 0x8C, 0xD2, 0xD2, 0xD2, 0x39,
+    0xA5, 0x93, 0x2A, 0xE5, 0x29, 0xA1, 0xF2, 0x29, 0x65, 0xEB, 0x34, 0xB7, 0x33, 0x2B, 0x65, 0xC7,
+    0x58, 0xAD, 0x9B, 0xEC, 0xD8, 0xE4, 0x36, 0x83, 0x92, 0x9E, 0x9A, 0x2D, 0x9B, 0x1D, 0x7C, 0x23,
+    0xBE, 0x11, 0x9B, 0x56, 0xAF, 0xA3, 0x69, 0x53, 0x50, 0x3E, 0xF4, 0xE1, 0x8D, 0x08, 0xC7, 0x43,
+    0x8C, 0xE6, 0x03, 0x2C, 0x37, 0xC7, 0xC1, 0x38, 0x9C, 0x86, 0xC6, 0xBF, 0x29, 0x8A, 0x62, 0xC8,
+    0x5A, 0x10, 0x7B, 0xF4, 0x7C, 0xF9, 0xB6, 0x0D, 0x14, 0x9E, 0x9A, 0x33, 0x01, 0x2D, 0x63, 0xDA,
+    0x38, 0x0C, 0x95, 0x4F, 0xE6, 0x81, 0x4B, 0x6E, 0x8D, 0x4B, 0xDE, 0x67, 0x9C, 0xAF, 0x7F, 0xA0,
+    0xBC, 0x3B, 0x14, 0xC6, 0xFE, 0x6E, 0x1E, 0x70, 0xDE, 0x7E, 0xD0, 0xD0, 0xCF, 0x96, 0x8E, 0xCE,
+    0x69, 0x5C, 0x72, 0x1C, 0x2A, 0x68, 0x22, 0x2D, 0x80, 0x74, 0xE8, 0x9E, 0xAB, 0x31, 0x93, 0x8D,
+    0x29, 0xCF, 0x4C, 0xAC, 0x09, 0x0C, 0x4C, 0x64, 0x33, 0x53, 0x1A, 0xB3, 0xC9, 0x0E, 0x12, 0x85,
+    0x26, 0x00, 0x49, 0x3C, 0x72, 0x92, 0x2F, 0x65, 0x91, 0x89, 0xB7, 0x14, 0x94, 0x1B, 0x66, 0xEB,
+    0x23, 0x3C, 0x3D, 0x77, 0x1E, 0x14, 0x72, 0xBE, 0x75, 0x71, 0x9E, 0xB4, 0xDE, 0xE7, 0x60, 0x2C,
+    0x8D, 0xF7, 0x69, 0xE1, 0xDC, 0xAB, 0x71, 0xF6, 0x7E, 0x5B, 0xFB, 0x1F, 0x95, 0xFE, 0x47, 0x55,
+    0xF0, 0x61, 0x69, 0x5E, 0x29, 0xCD, 0x9B, 0x55, 0x84, 0x2A, 0xBB, 0x50, 0xC5, 0x98, 0xB9, 0x4E,
+    0x7D, 0x33, 0x28, 0x42, 0xA9, 0x6B, 0x93, 0x47, 0xF2, 0x8F, 0xCA, 0x64, 0x89, 0x3C, 0xC0, 0xEF,
+    0x18, 0xA2, 0x23, 0x58, 0x8A, 0x69, 0x07, 0x63, 0x8F, 0x60, 0x01, 0x41, 0x64, 0x59, 0xCA, 0x79,
+    0xB6, 0x49, 0x3C, 0xA0, 0xA7, 0x5C, 0x26, 0xCE, 0x23, 0x78, 0xE6, 0xFE, 0x13, 0x13, 0xC2, 0xFB,
+    0xBC, 0x92, 0xC6, 0xFB, 0x4D, 0xED, 0xD4, 0x5E, 0xD9, 0x38, 0x20, 0x5B, 0x73, 0xB7, 0x0E, 0x8A,
+    0x89, 0x57, 0xA1, 0x37, 0x7A, 0xA5, 0xC9, 0x22, 0xD0, 0x2F, 0x31, 0x17, 0x21, 0xDF, 0xFC, 0x1C,
+    0xE2, 0xFD, 0x5F, 0xA3, 0x65, 0x7A, 0x77, 0x32, 0xF0, 0xA8, 0x1E, 0xBA, 0x9C, 0x9E, 0x71, 0x59,
+    0x91, 0x0C, 0x1E, 0x1D, 0x4F, 0xB8, 0xBB, 0x1C, 0xF9, 0x80, 0x43, 0x7F, 0x61, 0x91, 0xA3, 0x1B,
+    0x9B, 0x02, 0x2D, 0x1C, 0x43, 0x07, 0xCD, 0xA2, 0x8E, 0x32, 0x1D, 0x60, 0x36, 0x37, 0x6E, 0x7D,
+    0xC4, 0xD3, 0x9C, 0x39, 0xEF, 0x86, 0x93, 0x5F, 0x91, 0x7B, 0x94, 0x1D, 0x4B, 0x8B, 0x69, 0xC9,
+    0x0F, 0x88, 0xC0, 0x34, 0x43, 0xF8, 0xC2, 0x0A, 0x5D, 0x3D, 0x60, 0x3B, 0x95, 0xC5, 0x4A, 0x36,
+    0xDA, 0xD5, 0x02, 0xD5, 0xB3, 0x7C, 0x8D, 0xC5, 0xD2, 0x21, 0x39, 0x53, 0xA4, 0x26, 0xC1, 0x11,
+    0x23, 0x3F, 0x53, 0x24, 0xA8, 0xF3, 0x0B, 0xB7, 0x0D, 0x6E, 0x5F, 0xA9, 0xB4, 0xE2, 0xFB, 0x6B,
+    0x4F, 0x59, 0xF1, 0xFF, 0x9B, 0x1B, 0xDE, 0x49, 0x37, 0xC2, 0xD1, 0x0D, 0x51, 0x37, 0x9A, 0x13,
+    0x6E, 0x68, 0xE0, 0xB4, 0x7D, 0x68, 0x37, 0x21, 0xDD, 0xE3, 0xB0, 0xDB, 0x70, 0xAD, 0x83, 0x6B,
+    0x47, 0x70, 0x2D, 0x19, 0x5C, 0x4B, 0xD6, 0xAE, 0xF9, 0x0D, 0x45, 0x99, 0x1E, 0xCC, 0xF5, 0x5D,
+    0xD8, 0x98, 0xA1, 0x18, 0x44, 0x09, 0x0D, 0xDC, 0x22, 0xA6, 0x4D, 0x4E, 0x28, 0x03, 0xC9, 0xA5,
+    0x05, 0xB2, 0x52, 0xC7, 0x0A, 0x85, 0xDF, 0xC1, 0xAF, 0x9B, 0x4E, 0x7B, 0x92, 0x10, 0xBA, 0x8D,
+    0x02, 0x15, 0xBA, 0xC9, 0x06, 0xC8, 0x63, 0x68, 0xE1, 0x2C, 0xB3, 0xA6, 0x99, 0xB1, 0x1A, 0x0B,
+    0x26, 0xE6, 0x0D, 0x67, 0xA1, 0xFD, 0x36, 0x22, 0x23, 0xDD, 0xD3, 0x09, 0xDA, 0xF1, 0x38, 0x77,
+    0xF9, 0xF6, 0x25, 0xFB, 0xF8, 0x57, 0xD4, 0x7E, 0xF2, 0x74, 0xB5, 0xEF, 0x0D, 0xB5, 0xBF, 0x4B,
+    0x09, 0x31, 0xA3, 0x13, 0x73, 0x70, 0x25, 0xC3, 0xB4, 0xE4, 0xAC, 0xF5, 0x38, 0x66, 0x51, 0xFD,
+    0x11, 0x75, 0x85, 0x54, 0x14, 0x32, 0x88, 0xA4, 0x73, 0x38, 0x31, 0xF0, 0x17, 0x58, 0xE5, 0x6F,
+    0x91, 0x84, 0xBD, 0x4D, 0xC3, 0xDF, 0x21, 0x09, 0xBE, 0x43, 0xFF, 0xE9, 0x93, 0xDF, 0x8D, 0x54,
+    0x81, 0x3A, 0x81, 0x5F, 0xA8, 0x0D, 0xD1, 0x0D, 0x10, 0xFD, 0x14, 0x4A, 0x4C, 0xA5, 0xAD, 0x3A,
+    0xAA, 0xB5, 0x55, 0x26, 0xB5, 0xF2, 0xB3, 0x23, 0xF6, 0xDE, 0xB9, 0xDC, 0xAF, 0xC9, 0x81, 0x9D,
+    0x1A, 0xB5, 0x42, 0x2A, 0x8C, 0x2A, 0x94, 0x89, 0x5F, 0xD4, 0xB0, 0x60, 0x62, 0xF2, 0x9A, 0x0B,
+    0x29, 0xD4, 0x26, 0x57, 0x4D, 0x89, 0x10, 0x14, 0x93, 0x5D, 0x69, 0xE0, 0xE2, 0xE4, 0x26, 0x5E,
+    0x84, 0x47, 0xB5, 0x3C, 0x80, 0x49, 0x31, 0xFE, 0xC0, 0xA8, 0xB4, 0x64, 0x35, 0x4A, 0x5A, 0xB0,
+    0x3C, 0x09, 0x8F, 0x5B, 0x16, 0x0A, 0x0A, 0x89, 0x90, 0xA1, 0x52, 0xAA, 0x60, 0x72, 0xB2, 0xA6,
+    0x02, 0xB1, 0xF7, 0x4A, 0xA8, 0x71, 0x41, 0x03, 0x11, 0x32, 0x1A, 0xFF, 0x88, 0xC6, 0x2F, 0x8A,
+    0x71, 0xA2, 0xCF, 0xF8, 0x1E, 0x47, 0xB9, 0xF7, 0x05, 0x5D, 0xFE, 0x98, 0x89, 0x62, 0x2C, 0x59,
+    0x13, 0xD2, 0x3A, 0xBA, 0x38, 0x69, 0x6D, 0x57, 0xD3, 0x26, 0xA7, 0x7D, 0x0A, 0xA6, 0xCE, 0x49,
+    0x41, 0x18, 0xD3, 0x90, 0x63, 0x3C, 0x23, 0xAB, 0x4F, 0x07, 0xA6, 0xDC, 0x8A, 0xF7, 0x69, 0xAD,
+    0xF2, 0x5C, 0xF2, 0xC1, 0xFE, 0x09, 0x89, 0x3B, 0xC5, 0xD6, 0x81, 0x0A, 0x45, 0x19, 0x50, 0xFE,
+    0xBD, 0xEB, 0x37, 0xF4, 0x42, 0x36, 0x70, 0x0F, 0xA7, 0x1B, 0x83, 0x6E, 0x4E, 0x5C, 0x97, 0xF5,
+    0xF5, 0xF2, 0xAB, 0xAF, 0x07, 0x7A, 0x1D, 0x2B, 0x21, 0x0A, 0xAE, 0xED, 0x49, 0x76, 0xAA, 0x17,
+    0x65, 0xD1, 0x4D, 0xBC, 0xE5, 0xE5, 0x36, 0xA8, 0xFC, 0xC6, 0x14, 0xA8, 0x4E, 0x2D, 0x4E, 0xAF,
+    0x4A, 0x86, 0x35, 0xDE, 0x40, 0xF4, 0x71, 0x44, 0xF9, 0x04, 0x68, 0x4E, 0xDD, 0x2F, 0xB3, 0xA8,
+    0x7F, 0x47, 0x82, 0x25, 0x42, 0x3C, 0x2E, 0x8B, 0x9F, 0xD4, 0x0D, 0x5A, 0x90, 0xCF, 0xFB, 0x7D,
+    0xE3, 0x3C, 0xF8, 0x7D, 0x87, 0x62, 0x38, 0xF2, 0x3A, 0x54, 0x9E, 0x6D, 0x2E, 0x31, 0x9C, 0x9D,
+    0x32, 0x96, 0xC6, 0x92, 0x6C, 0xAC, 0x37, 0x31, 0x77, 0x0A, 0xBF, 0x8A, 0xAA, 0xB0, 0x88, 0xB1,
+    0xE8, 0xD8, 0x8D, 0x5A, 0xDB, 0xA5, 0x82, 0x87, 0x9C, 0xEE, 0x68, 0xFE, 0x3F, 0xD2, 0xEA, 0x1E,
+    0x97, 0x11, 0xA7, 0x55, 0x8D, 0xC7, 0x54, 0xD3, 0xF9, 0x02, 0x18, 0x04, 0x02, 0xCF, 0xEA, 0xDA,
+    0x5E, 0x13, 0xE8, 0x30, 0xB3, 0xC8, 0xB0, 0x12, 0x2C, 0xE1, 0xE0, 0x40, 0xA5, 0x90, 0x9D, 0x0A,
+    0x6F, 0x2F, 0x3A, 0x14, 0xFA, 0xC3, 0xCB, 0x44, 0xB2, 0x4F, 0xDE, 0xA6, 0x75, 0x82, 0x13, 0x03,
+    0x42, 0x92, 0x49, 0x60, 0xEB, 0xD0, 0x54, 0x14, 0x18, 0x9E, 0xE0, 0x21, 0xC3, 0x22, 0x8C, 0x8B,
+    0x30, 0x30, 0x36, 0x32, 0x36, 0x34, 0x3B, 0xAD, 0xB5, 0xFD, 0x61, 0x94, 0x93, 0xE1, 0xF1, 0x5F,
+    0x04, 0x2B, 0x12, 0xE7, 0x96, 0xAE, 0x3F, 0x67, 0xC0, 0xEF, 0xD1, 0x63, 0xB6, 0x3F, 0x07, 0xDB,
+    0x3B, 0x6D, 0x34, 0x83, 0xED, 0xDB, 0xDA, 0x51, 0xD9, 0x14, 0x88, 0x4E, 0x75, 0x22, 0x3A, 0x41,
+    0x98, 0x9C, 0xD5, 0x55, 0x51, 0x87, 0x65, 0xEB, 0xE1, 0x9E, 0xC5, 0x96, 0x82, 0x4B, 0xD1, 0x65,
+    0x4F, 0xDA, 0xBE, 0x88, 0x66, 0x6D, 0x0D, 0x16, 0x66, 0x0A, 0x21, 0xC6, 0x53, 0xBB, 0xFA, 0xE9,
+    0xC0, 0x9C, 0xA4, 0xC4, 0x2E, 0x31, 0x3B, 0xA3, 0xA4, 0x34, 0xD7, 0x15, 0x47, 0xFB, 0x2C, 0xBB,
+    0x16, 0xDE, 0xE9, 0x7F, 0x88, 0xD5, 0x67, 0x8B, 0xC6, 0x87, 0x38, 0x75, 0x14, 0xDC, 0x51, 0x70,
+    0x47, 0xC1, 0x60, 0x68, 0xD9, 0x9A, 0xDB, 0x6B, 0x30, 0x91, 0x42, 0x2C, 0x19, 0xB8, 0x49, 0xF2,
+    0x2B, 0x32, 0xFB, 0xBF, 0xB2, 0x32, 0x2E, 0xC2, 0x8E, 0xB3, 0x6B, 0x3B, 0x46, 0x13, 0x7E, 0xE6,
+    0x2A, 0x29, 0x25, 0x4C, 0xFB, 0xAF, 0x07, 0x5A, 0x09, 0xA0, 0xB5, 0xCE, 0x83, 0xDB, 0x04, 0xDA,
+    0x04, 0x40, 0x9B, 0x40, 0xDD, 0x84, 0xBD, 0x66, 0x58, 0xC9, 0xB5, 0xA6, 0x70, 0x1A, 0x82, 0xCC,
+    0x64, 0x00, 0x1A, 0xE2, 0x01, 0x83, 0xB0, 0x8A, 0xF1, 0x8B, 0x98, 0x36, 0x3F, 0xC3, 0x01, 0xA3,
+    0xBB, 0x26, 0x22, 0xD7, 0x40, 0x85, 0x1A, 0x52, 0x45, 0x12, 0x75, 0x36, 0x0E, 0xC3, 0x95, 0x7A,
+    0x16, 0xEA, 0x48, 0x20, 0x5C, 0x9E, 0x11, 0x4B, 0x75, 0x86, 0xE7, 0xF5, 0x95, 0xE3, 0x1D, 0x8C,
+    0xAF, 0xE5, 0x36, 0x96, 0x53, 0x8C, 0x9C, 0x08, 0x56, 0x2E, 0x2A, 0x92, 0x9B, 0xAF, 0x74, 0x6F,
+    0x7E, 0x4C, 0x19, 0x7F, 0x01, 0x9E, 0x01, 0x9A, 0xC1, 0xA5, 0x04, 0x97, 0xB3, 0x80, 0x29, 0xD6,
+    0x9F, 0xDE, 0x1F, 0xB1, 0x7C, 0xF8, 0xB2, 0x50, 0x62, 0x66, 0x40, 0x45, 0xCC, 0x9B, 0xB5, 0xF6,
+    0x61, 0x92, 0xB2, 0x48, 0x69, 0x6B, 0x24, 0xB1, 0x65, 0xD8, 0x6B, 0x62, 0x35, 0x3D, 0x49, 0xC8,
+    0x36, 0xB6, 0x5D, 0xD6, 0x46, 0xE7, 0xBA, 0xAF, 0x74, 0xD2, 0x68, 0xB9, 0x0A, 0x10, 0x57, 0x72,
+    0xAF, 0xAF, 0x67, 0x1D, 0x0A, 0xFA, 0xFE, 0xFD, 0x5B, 0x88, 0x74, 0x9F, 0xA7, 0x40, 0x46, 0x8F,
+    0x46, 0xC9, 0xE4, 0xA7, 0x10, 0x82, 0xC5, 0x98, 0x5F, 0x22, 0xE9, 0xB1, 0x2E, 0x78, 0x26, 0xBA,
+    0xF6, 0x99, 0xA3, 0x07, 0xE3, 0x8E, 0xC9, 0xA0, 0xA1, 0x0D, 0xA1, 0xC4, 0x69, 0x22, 0x5D, 0x10,
+    0x25, 0xBA, 0x36, 0x8A, 0x45, 0xEF, 0x8B, 0xEA, 0xA0, 0x06, 0xE4, 0xF1, 0xCF, 0x1D, 0x28, 0xD2,
+    0xD8, 0x30, 0xE6, 0x60, 0xA5, 0x1D, 0xF2, 0xD8, 0x6D, 0xE6, 0x11, 0x6B, 0x4C, 0x36, 0x2B, 0xAC,
+    0xEE, 0x7D, 0x1E, 0xC8, 0x25, 0xEE, 0xEE, 0xDC, 0x1D, 0x0A, 0xEE, 0x4A, 0x11, 0x94, 0x7E, 0x15,
+    0xE6, 0x7C, 0x86, 0x7A, 0xB8, 0x71, 0xE5, 0xD6, 0x13, 0x1B, 0x3A, 0x94, 0xBA, 0x5F, 0x4E, 0xA0,
+    0xFB, 0x00, 0x4E, 0xA6, 0xD9, 0x2D, 0x14, 0x56, 0xAB, 0x9B, 0x0B, 0xFA, 0x79, 0x91, 0x6D, 0x66,
+    0x97, 0x54, 0x79, 0x7A, 0x1F, 0x93, 0x65, 0x91, 0xA3, 0x9B, 0x2E, 0x18, 0x8D, 0x6E, 0x18, 0x28,
+    0xC4, 0x74, 0x98, 0xB9, 0x8F, 0xF5, 0x06, 0x48, 0xAD, 0x41, 0x0A, 0x82, 0x16, 0xAB, 0x1B, 0x73,
+    0x03, 0x05, 0x6B, 0x2E, 0xAE, 0x58, 0xAF, 0x7B, 0x4F, 0x6C, 0x3A, 0x23, 0x67, 0xFA, 0xAF, 0xFB,
+    0xF0, 0x62, 0xE8, 0xC3, 0xEF, 0xA1, 0xDB, 0x40, 0x6C, 0x76, 0x7A, 0x8D, 0xB1, 0x31, 0x65, 0xAE,
+    0xC2, 0xFC, 0x7B, 0xBD, 0x38, 0x0F, 0xFE, 0xA2, 0x84, 0xC4, 0xED, 0x4E, 0xAE, 0x12, 0x46, 0x4E,
+    0xF2, 0xA4, 0xE5, 0x9C, 0x5C, 0xB9, 0x8B, 0xD0, 0xF4, 0x12, 0xDC, 0xFD, 0xE9, 0xFA, 0x39, 0x6E,
+    0x33, 0x35, 0x23, 0xC1, 0xE1, 0xB0, 0xAC, 0x87, 0xFD, 0x03, 0xAB, 0xF3, 0x10, 0x0A, 0x38, 0xC2,
+    0x66, 0xC7, 0x9B, 0x20, 0x22, 0x6F, 0x70, 0x0B, 0x13, 0x31, 0xDB, 0xF9, 0xD7, 0xE1, 0xA2, 0x2F,
+    0x77, 0x6E, 0x67, 0x8F, 0x17, 0x47, 0xBA, 0x51, 0x1F, 0xF8, 0xA6, 0x9D, 0x84, 0x1D, 0x1B, 0xA9,
+    0x7B, 0x28, 0xAF, 0xB3, 0xEB, 0x02, 0x9C, 0xAC, 0x64, 0x64, 0xDF, 0xB1, 0x55, 0x9C, 0x69, 0x15,
+    0x1F, 0x67, 0x3F, 0xD6, 0x3D, 0x06, 0x3B, 0xA6, 0x0E, 0x10, 0x9E, 0x14, 0xDD, 0xD8, 0x0C, 0x63,
+    0xEA, 0x75, 0x71, 0xAF, 0x4E, 0x86, 0xAC, 0xC7, 0xCA, 0x8B, 0x48, 0x8B, 0x38, 0xC4, 0x5B, 0x65,
+    0x85, 0xDC, 0x9A, 0x8B, 0xB8, 0x77, 0x4A, 0xE0, 0xC3, 0x16, 0x13, 0xDB, 0x2D, 0x10, 0xC3, 0x85,
+    0x4E, 0xCD, 0x52, 0x7F, 0x5E, 0xCE, 0x40, 0x72, 0x8A, 0xF9, 0xCE, 0xF0, 0x73, 0xC5, 0xF0, 0x28,
+    0x83, 0x0C, 0xF7, 0x0B, 0x90, 0xA6, 0xD8, 0xFB, 0x04, 0xAC, 0x29, 0xF6, 0x3F, 0xC9, 0x01, 0x7C,
+    0x73, 0x11, 0x65, 0x18, 0x87, 0xC1, 0x5B, 0xA5, 0xC4, 0xB1, 0xFF, 0xF3, 0x42, 0xE2, 0x89, 0x0F,
+    0xFE, 0x14, 0xBF, 0xEF, 0xBF, 0x47, 0xEE, 0xE2, 0xFF, 0x12, 0xAE, 0x55, 0xA4, 0x50, 0x69, 0x41,
+    0x0E, 0x15, 0xE5, 0x3A, 0x9F, 0x5F, 0x97, 0x67, 0x33, 0xA1, 0x55, 0x88, 0x04, 0x77, 0x0F, 0xD9,
+    0xB5, 0xCD, 0xDB, 0xA4, 0x72, 0x77, 0x10, 0x71, 0x8F, 0x91, 0x76, 0x8F, 0x69, 0x17, 0xF7, 0x17,
+    0x25, 0x64, 0x87, 0x98, 0x32, 0x57, 0xA8, 0x2C, 0xE4, 0x54, 0x03, 0x4A, 0x52, 0xC7, 0xCD, 0x17,
+    0x75, 0xD8, 0x2E, 0xF1, 0x74, 0x39, 0x46, 0x9F, 0xC7, 0x25, 0x1A, 0x77, 0x15, 0x99, 0xA9, 0x88,
+    0x3A, 0x42, 0xDD, 0x69, 0x53, 0x14, 0x68, 0x6A, 0xAF, 0xB0, 0x0D, 0x4F, 0x47, 0x1D, 0xCC, 0xB2,
+    0x5D, 0xAC, 0xEB, 0x9E, 0xAC, 0x36, 0xE9, 0x48, 0x36, 0xC9, 0xC8, 0x42, 0x49, 0x94, 0xB6, 0x98,
+    0x9F, 0x5C, 0x3F, 0xD4, 0xB4, 0xEF, 0x5F, 0x2E, 0xED, 0xBA, 0x3E, 0xB1, 0x48, 0xB4, 0xBB, 0xA5,
+    0x76, 0x72, 0x6D, 0x5E, 0x1A, 0xB7, 0xF7, 0xB8, 0xC6, 0xE3, 0x06, 0x84, 0x62, 0x45, 0xF9, 0xB1,
+    0x45, 0xB2, 0x8E, 0xB0, 0x01, 0x3E, 0xDF, 0x44, 0x61, 0x8B, 0xF2, 0x6C, 0x6E, 0xD9, 0xE6, 0xE7,
+    0xF6, 0xF7, 0x37, 0x2E, 0xF5, 0x96, 0x7D, 0xE3, 0xD3, 0xE2, 0x06, 0x3E, 0x7B, 0x0E, 0xBA, 0x2D,
+    0x77, 0x67, 0xD8, 0xF6, 0x77, 0x39, 0x80, 0xDF, 0xFF, 0x96, 0x53, 0x83, 0xB7, 0x80, 0xAB, 0x36,
+    0xE8, 0xB2, 0xD1, 0x2B, 0x55, 0x1A, 0x94, 0xDB, 0x5B, 0xE8, 0x04, 0x89, 0x57, 0x1F, 0x61, 0xC1,
+    0x12, 0x7C, 0xD0, 0x98, 0x97, 0xEB, 0xD0, 0x2B, 0x76, 0x83, 0x7C, 0x7B, 0x4B, 0xB6, 0xF0, 0xCE,
+    0x77, 0x53, 0x30, 0xD2, 0x6E, 0x26, 0x2B, 0x07, 0xA7, 0xA5, 0xD3, 0x6D, 0xCB, 0x59, 0xDD, 0x79,
+    0xDD, 0x16, 0xC7, 0x0E, 0x74, 0x86, 0xCE, 0xF4, 0x2F, 0x73, 0xC2, 0xE9, 0x86, 0x19, 0x1D, 0xD7,
+    0xE9, 0x9C, 0xD8, 0xF9, 0x3C, 0xD5, 0x78, 0x3B, 0xAB, 0xEB, 0x37, 0xFE, 0xA6, 0x7B, 0x58, 0x5C,
+    0x4F, 0x6D, 0x3D, 0xDC, 0xBF, 0x72, 0x49, 0x8B, 0x2C, 0xB5, 0x43, 0x3E, 0xB1, 0x13, 0x3E, 0xB6,
+    0x7F, 0x26, 0x76, 0xD4, 0xCF, 0xED, 0xB0, 0x6F, 0xED, 0xB8, 0x57, 0xC4, 0x14, 0x5A, 0x9F, 0x68,
+    0x9E, 0x4A, 0x12, 0x73, 0x25, 0x05, 0xC6, 0x6A, 0x0D, 0x2D, 0x31, 0x38, 0xA9, 0x3C, 0xB1, 0xF4,
+    0xC0, 0xDA, 0x60, 0x29, 0x2F, 0xC6, 0xFC, 0x33, 0x33, 0xA5, 0x01, 0xA6, 0x53, 0x22, 0x60, 0x86,
+    0x4D, 0xCD, 0x6D, 0xBB, 0xE6, 0xFB, 0x80, 0xE9, 0xD3, 0x69, 0x1E, 0x66, 0x36, 0x8D, 0x67, 0x86,
+    0x8C, 0x0F, 0x44, 0x02, 0x3C, 0xE5, 0x79, 0x25, 0x2A, 0x89, 0x32, 0x95, 0x44, 0xFD, 0x88, 0xD5,
+    0x8D, 0x89, 0x9A, 0x3F, 0xD7, 0x73, 0xAB, 0x3E, 0x34, 0x74, 0x81, 0x46, 0xFB, 0x1C, 0x21, 0x76,
+    0xFF, 0x8C, 0x94, 0x4C, 0x39, 0x20, 0x0D, 0x36, 0x19, 0xED, 0x0D, 0xD5, 0x5C, 0x5D, 0xC8, 0x0C,
+    0xAA, 0x36, 0x14, 0xDA, 0xF6, 0xAA, 0xDC, 0xC5, 0x92, 0x97, 0x81, 0xBD, 0xAC, 0x6D, 0xFE, 0xB8,
+    0x38, 0x6D, 0xB3, 0x51, 0xE0, 0xB2, 0x15, 0x4E, 0xD9, 0x97, 0x60, 0x73, 0xF4, 0x98, 0xCD, 0xD3,
+    0xFF, 0x68, 0x73, 0xBD, 0xB6, 0xD9, 0xFB, 0x86, 0x6D, 0x76, 0x64, 0x84, 0xCE, 0x9E, 0xC5, 0xCE,
+    0xBD, 0xC6, 0x82, 0x87, 0x8B, 0x4F, 0x4D, 0xE0, 0xD5, 0xE3, 0x0C, 0x8E, 0xB9, 0x53, 0x00, 0xB9,
+    0xB9, 0x45, 0x10, 0x9E, 0x50, 0x08, 0xF1, 0x09, 0x62, 0x08, 0x4F, 0x28, 0x88, 0x4C, 0x66, 0x51,
+    0x14, 0x0E, 0x30, 0x8A, 0x06, 0x1C, 0xA5, 0x03, 0x90, 0x92, 0x01, 0x49, 0xF1, 0x00, 0xA5, 0xC9,
+    0x80, 0xA5, 0xF9, 0x00, 0xA6, 0x6E, 0x40, 0x53, 0x6B, 0xE1, 0xE4, 0x0C, 0xE6, 0x30, 0x16, 0xA3,
+    0x39, 0x03, 0xA2, 0x46, 0xB3, 0x06, 0x4C, 0x8D, 0xA0, 0x1A, 0x51, 0xB5, 0x01, 0xAB, 0x13, 0xFE,
+    0xB6, 0x43, 0xAD, 0x0C, 0xFE, 0x52, 0x70, 0x34, 0x84, 0x99, 0x0A, 0x18, 0xE2, 0xA9, 0x0D, 0xB2,
+    0xFA, 0xEB, 0x97, 0xD6, 0xDF, 0xE0, 0xFF, 0xE4, 0x6F, 0xFB, 0x8D, 0xFB, 0xFB, 0x6F, 0x95, 0x54,
+    0x31, 0x8F, 0xE3, 0x44, 0x14, 0xFE, 0xEC, 0xE1, 0x70, 0x31, 0x82, 0xA1, 0x39, 0x9A, 0x15, 0xE7,
+    0x2B, 0x0F, 0x38, 0x92, 0x3F, 0x10, 0xDB, 0x23, 0xAE, 0xA0, 0xE4, 0x8A, 0x0D, 0x0D, 0x05, 0x0D,
+    0x0D, 0x48, 0xE8, 0x1A, 0x8A, 0x08, 0x39, 0x97, 0x41, 0xFC, 0x00, 0xB6, 0xA1, 0xBF, 0x82, 0xE2,
+    0x14, 0x0A, 0xB6, 0x48, 0x11, 0xA4, 0xD5, 0x66, 0x74, 0x48, 0x34, 0xD7, 0xF8, 0x27, 0x18, 0xE9,
+    0x04, 0x12, 0xCD, 0xB9, 0x48, 0x61, 0x44, 0xB2, 0xC3, 0xF7, 0xC6, 0x59, 0x76, 0xA5, 0x45, 0x48,
+    0x38, 0x9E, 0x17, 0x27, 0x6F, 0xE6, 0x7D, 0xDF, 0xFB, 0xDE, 0x7B, 0x1E, 0x69, 0x57, 0x1A, 0x57,
+    0x18, 0x5B, 0x1B, 0xCC, 0x72, 0xAC, 0xDE, 0xC3, 0xE9, 0x7D, 0x3C, 0xB9, 0x07, 0x60, 0xA6, 0x3C,
+    0xB0, 0xCA, 0x1C, 0xD0, 0x69, 0x4B, 0x63, 0x80, 0xA4, 0xA5, 0x49, 0x9B, 0x3B, 0x48, 0x7F, 0xF8,
+    0x63, 0xF3, 0x34, 0x0B, 0x21, 0xEC, 0x92, 0x8F, 0xBF, 0xFB, 0xE9, 0x21, 0x0C, 0x56, 0xA0, 0xE9,
+    0x80, 0x3B, 0x62, 0x8A, 0xB4, 0x45, 0x45, 0x6F, 0x13, 0xCD, 0x8D, 0x20, 0x39, 0xA0, 0x9A, 0x11,
+    0x8D, 0x9F, 0xE0, 0x70, 0xBD, 0xCE, 0xF5, 0x16, 0x7D, 0xE7, 0x16, 0x79, 0xD8, 0x61, 0x71, 0xBE,
+    0x43, 0x3F, 0x43, 0xD2, 0xAD, 0x90, 0x76, 0xA7, 0xFC, 0x66, 0xD0, 0x3D, 0xD7, 0xA2, 0x05, 0xF2,
+    0x3D, 0x4F, 0x06, 0x07, 0xF5, 0xBC, 0x81, 0xFA, 0xA6, 0x41, 0xC6, 0xA5, 0x1F, 0x34, 0x77, 0x8D,
+    0xF1, 0xD5, 0x8F, 0x01, 0xE3, 0xD0, 0x23, 0x79, 0x4C, 0xAC, 0xFB, 0x0C, 0x29, 0xF1, 0xEF, 0x5D,
+    0x62, 0x24, 0x81, 0x49, 0x41, 0x07, 0x4F, 0x8A, 0xE6, 0x81, 0x57, 0x0D, 0x46, 0xAA, 0xD1, 0x0E,
+    0x13, 0xD5, 0x90, 0x51, 0x1D, 0xD9, 0x30, 0xE9, 0x2D, 0xB0, 0xCE, 0x9E, 0x11, 0x68, 0xA5, 0x3F,
+    0xF8, 0xE5, 0x05, 0xD6, 0xC6, 0x10, 0xB1, 0x2E, 0x8B, 0xF9, 0x18, 0xD5, 0x6E, 0xBD, 0x35, 0x30,
+    0xBF, 0x76, 0x92, 0x87, 0x7A, 0x26, 0x6A, 0x98, 0xF7, 0xE5, 0xF0, 0x28, 0xE6, 0xC3, 0x10, 0x05,
+    0x73, 0x94, 0x40, 0xAA, 0x51, 0xCD, 0x16, 0xDA, 0x25, 0x7F, 0x75, 0xA0, 0x7F, 0xE3, 0x84, 0xC0,
+    0x2B, 0x57, 0x4C, 0x1A, 0x90, 0x08, 0x91, 0x72, 0xB7, 0x03, 0xC6, 0xA8, 0x81, 0x52, 0xC8, 0x96,
+    0x38, 0xA3, 0x49, 0x7A, 0x3A, 0x34, 0x19, 0x98, 0xC0, 0x3C, 0x0C, 0x7F, 0x61, 0xC1, 0xE4, 0x55,
+    0xDF, 0xA3, 0x37, 0xCD, 0x3C, 0xE9, 0x72, 0x3B, 0x56, 0x6D, 0x09, 0xF3, 0xDC, 0x97, 0xC8, 0x82,
+    0x2D, 0x91, 0xEE, 0x51, 0x21, 0xDD, 0x61, 0xEC, 0xF2, 0xC0, 0x53, 0x21, 0x77, 0x69, 0xD8, 0xEA,
+    0x26, 0x22, 0x8E, 0xCA, 0xA2, 0x9E, 0xAD, 0x4E, 0x9F, 0x44, 0xE4, 0x8C, 0x35, 0xD5, 0xB2, 0x2C,
+    0xBE, 0xD4, 0x40, 0xF8, 0x90, 0x48, 0x17, 0x1F, 0x9D, 0x60, 0x41, 0x46, 0x9B, 0x37, 0x9D, 0xFA,
+    0xDD, 0xC2, 0xFC, 0xEC, 0x51, 0x51, 0x9C, 0xD7, 0xD2, 0x4E, 0x8A, 0x35, 0x30, 0xBE, 0x05, 0xA9,
+    0xEF, 0x8D, 0x35, 0xFD, 0x64, 0x6A, 0x59, 0xE2, 0x6E, 0x13, 0x42, 0xFB, 0x6F, 0xFE, 0x58, 0x57,
+    0x80, 0x19, 0x48, 0x30, 0xD5, 0x0E, 0xE0, 0xC6, 0x4A, 0xCE, 0xC0, 0x9C, 0x8B, 0xE9, 0x27, 0xD7,
+    0x5D, 0x6E, 0x70, 0x51, 0x47, 0x91, 0x22, 0xA1, 0x44, 0x8A, 0xEE, 0xAC, 0xB9, 0x72, 0x95, 0x03,
+    0xA3, 0x37, 0x86, 0x98, 0xE3, 0x16, 0xE9, 0xC5, 0xD5, 0x17, 0xF7, 0xB1, 0x3D, 0xA2, 0xDE, 0xFA,
+    0x4F, 0x79, 0xE0, 0x1F, 0x19, 0x1D, 0x78, 0xD4, 0x0E, 0xFB, 0xE5, 0x1C, 0xF3, 0x26, 0xDF, 0x8D,
+    0xB4, 0xE6, 0xB5, 0x6B, 0x3A, 0x8D, 0xB9, 0xB4, 0xCB, 0xE5, 0xF2, 0xC4, 0x0E, 0xA4, 0x87, 0x38,
+    0x37, 0x1F, 0x06, 0x5C, 0x89, 0xCB, 0xF8, 0x47, 0x04, 0x64, 0x3B, 0xC6, 0xFD, 0x36, 0x46, 0x7A,
+    0xF5, 0xFC, 0x44, 0x76, 0x86, 0xBD, 0x90, 0x48, 0x16, 0x0E, 0x95, 0x95, 0x0C, 0x62, 0xAA, 0xA9,
+    0x08, 0xBA, 0xCD, 0xBC, 0x0E, 0x6E, 0x6D, 0xEC, 0xE2, 0xA5, 0xAF, 0x73, 0xF4, 0x99, 0x9F, 0x14,
+    0xAA, 0xD5, 0x6E, 0x32, 0xC9, 0x3C, 0x27, 0xB1, 0xD6, 0x96, 0xC3, 0x58, 0x1B, 0xCB, 0x79, 0x9C,
+    0x19, 0x26, 0xDC, 0xF1, 0xF9, 0x71, 0xDA, 0xD6, 0xE6, 0xEB, 0x97, 0xDA, 0x4F, 0xB2, 0xF0, 0x6D,
+    0xB0, 0x45, 0xB2, 0x4F, 0xFB, 0xA8, 0xC7, 0xA0, 0x0C, 0xD3, 0xEC, 0x86, 0xD6, 0x9A, 0x3E, 0x12,
+    0xA1, 0x82, 0xB4, 0x4E, 0xB2, 0x7C, 0xC8, 0xAC, 0x29, 0x4D, 0x47, 0x7D, 0x55, 0xC7, 0xA2, 0xAA,
+    0x96, 0x1D, 0xC0, 0xAE, 0xF7, 0xEC, 0x04, 0xE3, 0x29, 0x39, 0xCF, 0x1A, 0xC7, 0x82, 0x18, 0xC7,
+    0x36, 0x65, 0x5F, 0x89, 0xC6, 0xE5, 0xC1, 0x94, 0x52, 0xA1, 0x42, 0x9A, 0xB3, 0x96, 0x62, 0x9C,
+    0x89, 0xE9, 0x69, 0x58, 0x95, 0xB9, 0x94, 0xA5, 0x72, 0x63, 0xCF, 0x71, 0x25, 0x52, 0x16, 0xFA,
+    0x43, 0x93, 0xC0, 0x5C, 0xC8, 0x9D, 0x1F, 0x0B, 0xB7, 0x32, 0x16, 0x72, 0x22, 0xE7, 0x87, 0xB3,
+    0xD8, 0x4A, 0xB5, 0x79, 0x93, 0x94, 0x50, 0x6A, 0xA4, 0x21, 0x49, 0x46, 0x58, 0x58, 0xB9, 0xF3,
+    0x58, 0xE3, 0xEA, 0x18, 0x55, 0x8F, 0x77, 0xBE, 0xE7, 0x5B, 0x65, 0xCD, 0xB3, 0x35, 0x43, 0x14,
+    0xFC, 0x94, 0x18, 0x71, 0x43, 0xCE, 0xC6, 0x32, 0xD6, 0x58, 0xED, 0xB4, 0xCF, 0xF8, 0x51, 0x9C,
+    0x64, 0xC6, 0xD2, 0x11, 0xF7, 0xD6, 0xFC, 0xFF, 0xE0, 0xE1, 0x80, 0x77, 0xC9, 0xF3, 0xF6, 0xD9,
+    0x01, 0x37, 0xF6, 0x6E, 0x4E, 0x1D, 0x2B, 0xF6, 0xE4, 0x57, 0x2C, 0xD9, 0x56, 0xA2, 0xAC, 0xF9,
+    0xEE, 0xE3, 0x68, 0xFB, 0x11, 0xA4, 0x40, 0x86, 0xE3, 0x3D, 0x8A, 0xEF, 0xB0, 0xB4, 0x5D, 0x03,
+    0x51, 0xFD, 0xDB, 0xD3, 0x29, 0x47, 0x29, 0xE0, 0xF3, 0xE5, 0x12, 0xC7, 0x14, 0x89, 0x33, 0x2A,
+    0x88, 0x2C, 0xC5, 0x17, 0x50, 0x7B, 0xE8, 0x17, 0x11, 0x39, 0xC2, 0x8E, 0x2E, 0x61, 0x6B, 0x21,
+    0x7A, 0xD4, 0x81, 0x7D, 0xC2, 0x9B, 0x7D, 0xF2, 0x0F, 0x57, 0xE5, 0xAF, 0xD1, 0x75, 0x72, 0x5A,
+    0x31, 0xA5, 0x4F, 0xF9, 0x96, 0xFA, 0xAF, 0x8B, 0x43, 0x47, 0xBC, 0xBC, 0x3D, 0x74, 0x04, 0x27,
+    0x48, 0xB8, 0xC9, 0x90, 0x5D, 0xCE, 0x20, 0x43, 0x4B, 0xEC, 0x61, 0xC9, 0x9E, 0x0D, 0xE2, 0xF4,
+    0x10, 0x40, 0x98, 0x09, 0xB5, 0x38, 0x80, 0xF2, 0xF6, 0xAC, 0x87, 0x41, 0x14, 0x2D, 0x65, 0x18,
+    0xDF, 0xED, 0x06, 0x4D, 0xDE, 0x3E, 0x0C, 0xCD, 0xB8, 0xC7, 0xDD, 0x10, 0x7E, 0xEB, 0xDA, 0x23,
+    0x19, 0xA6, 0xCF, 0xF0, 0x37, 0xC5, 0x5A, 0x31, 0x8C, 0xDC, 0xC6, 0x15, 0xFD, 0xE4, 0xE8, 0x44,
+    0xDB, 0x04, 0x3C, 0x57, 0x9C, 0x03, 0x01, 0x8A, 0x45, 0x15, 0x2E, 0x1C, 0x43, 0x3A, 0xB6, 0x2A,
+    0x6E, 0x97, 0x63, 0xA7, 0x09, 0xE0, 0xC2, 0x2A, 0x74, 0x09, 0x90, 0x22, 0x76, 0x69, 0x20, 0x40,
+    0xAE, 0x51, 0xA1, 0x04, 0xBB, 0x77, 0x8C, 0x5D, 0xB8, 0x48, 0x61, 0x35, 0xAE, 0xA3, 0x00, 0x6E,
+    0xA2, 0xE6, 0x54, 0xA8, 0x38, 0x20, 0xD4, 0x2D, 0xED, 0x14, 0x29, 0xC3, 0xC0, 0x70, 0x6D, 0x06,
+    0xB1, 0x8B, 0xC0, 0x08, 0x44, 0xC3, 0x74, 0x4C, 0xC5, 0xBC, 0x63, 0xDE, 0xFB, 0xE4, 0xEE, 0xED,
+    0xC9, 0x42, 0x1C, 0x03, 0xA7, 0xD3, 0xDE, 0xCE, 0xDC, 0xED, 0x72, 0x38, 0xFF, 0xCF, 0x9F, 0xFF,
+    0xDF, 0x7F, 0x7F, 0x78, 0xB2, 0x2E, 0xB2, 0xA3, 0xEF, 0x91, 0x0C, 0xAF, 0x37, 0x44, 0xEE, 0x88,
+    0x54, 0x7C, 0x7B, 0xA5, 0xF8, 0x85, 0x98, 0x42, 0x82, 0x5C, 0xC2, 0x5C, 0x2C, 0xDE, 0xA9, 0x44,
+    0x4E, 0x62, 0x27, 0x89, 0xF0, 0xFD, 0xDC, 0x70, 0x8F, 0x57, 0x08, 0x47, 0x4A, 0xF8, 0x4F, 0x91,
+    0x59, 0x27, 0xE6, 0xE0, 0xE7, 0x62, 0xF1, 0x31, 0x4A, 0x75, 0x94, 0x4C, 0xD1, 0xB2, 0xA1, 0xB5,
+    0x4B, 0x8D, 0x9F, 0x77, 0x64, 0x55, 0xE2, 0x6F, 0x2A, 0x09, 0xBB, 0x52, 0xE4, 0x2B, 0x7C, 0x51,
+    0xF6, 0xD3, 0x89, 0x9B, 0x2B, 0x84, 0x4B, 0xF8, 0x7B, 0x87, 0xD7, 0x0F, 0xFC, 0x5C, 0x7C, 0xA8,
+    0x26, 0x06, 0x1F, 0x24, 0xE0, 0x30, 0xA8, 0x26, 0x54, 0x4E, 0xA8, 0x5B, 0xDF, 0x99, 0xAE, 0x83,
+    0xCA, 0x5D, 0x97, 0xF7, 0xD2, 0x65, 0xCC, 0x4E, 0xD7, 0x37, 0x61, 0xD7, 0xA0, 0xE9, 0x24, 0xE7,
+    0x3F, 0xDE, 0xBC, 0x26, 0x49, 0xD7, 0x35, 0xEC, 0x6A, 0xE8, 0xE1, 0xC9, 0x8D, 0x97, 0x5E, 0x75,
+    0xF8, 0x20, 0xF6, 0xE3, 0x03, 0x89, 0xE4, 0x32, 0x7E, 0xAC, 0x6C, 0xA0, 0xF1, 0xF7, 0x05, 0xFC,
+    0xD8, 0x74, 0x22, 0x71, 0x77, 0x28, 0xD3, 0xD9, 0xEF, 0xD3, 0x8B, 0xE2, 0x53, 0xBA, 0x4D, 0xD1,
+    0xC5, 0xB4, 0xD2, 0x94, 0x6A, 0x35, 0x98, 0x9B, 0xB3, 0x57, 0xD4, 0xAE, 0xA6, 0x3A, 0x7B, 0x31,
+    0x25, 0x53, 0xF4, 0x06, 0x45, 0x27, 0xB8, 0x68, 0xBB, 0x0E, 0x86, 0xEC, 0xB8, 0xAE, 0x88, 0x2A,
+    0x71, 0xC4, 0x4B, 0xB3, 0xDB, 0xB8, 0x88, 0xB9, 0xE5, 0xB9, 0xE9, 0xB5, 0xB9, 0xAE, 0xD9, 0x5C,
+    0x61, 0xB9, 0x71, 0xF4, 0x1A, 0xCC, 0x72, 0xFC, 0x9B, 0x35, 0x51, 0x13, 0x26, 0x9F, 0x57, 0xB8,
+    0x69, 0x55, 0xEF, 0xA1, 0x89, 0x77, 0x20, 0x22, 0xAE, 0xB1, 0x2B, 0x87, 0xD0, 0x2B, 0x71, 0x41,
+    0x6E, 0xF3, 0x30, 0x0F, 0xD0, 0xC2, 0x34, 0x28, 0xAD, 0xF3, 0x0F, 0xB0, 0x37, 0x3B, 0xB8, 0x1E,
+    0xD6, 0xC3, 0x0D, 0x1B, 0x2A, 0xFA, 0xA2, 0xD7, 0x42, 0x97, 0x0A, 0x6B, 0x4D, 0xE7, 0xBB, 0x30,
+    0xB1, 0x2E, 0x8B, 0xDC, 0x0B, 0x4F, 0xCF, 0x3F, 0xFB, 0x1D, 0x65, 0xC4, 0x9F, 0xED, 0xA6, 0xD4,
+    0xD0, 0xAF, 0x69, 0x01, 0x58, 0xD9, 0x4A, 0xFC, 0xA9, 0x95, 0xE7, 0xBD, 0xAE, 0x0D, 0xD2, 0x0D,
+    0x53, 0xAE, 0xF9, 0xF9, 0x15, 0xEC, 0x8E, 0x57, 0x5C, 0xB7, 0xD0, 0xA4, 0xBC, 0x63, 0x71, 0x4F,
+    0xB5, 0xDC, 0xF7, 0xDF, 0x5F, 0x09, 0x53, 0x8C, 0xD9, 0x80, 0xCD, 0xFC, 0xFC, 0xB2, 0xDF, 0xB5,
+    0x26, 0xB7, 0x50, 0xCB, 0xEA, 0xEE, 0x8E, 0xC4, 0xAB, 0xC5, 0x83, 0xB0, 0xE4, 0xBD, 0x2D, 0x88,
+    0x38, 0xDB, 0x1D, 0x50, 0xFC, 0xCA, 0xA0, 0x45, 0x93, 0xDB, 0xDD, 0xFC, 0x72, 0x90, 0x5E, 0x09,
+    0xD2, 0xEB, 0x81, 0xBB, 0x13, 0x0A, 0xA6, 0xBD, 0x3B, 0x96, 0xF1, 0xBF, 0x24, 0xFA, 0x89, 0xC8,
+    0xAA, 0x07, 0xC5, 0x43, 0xE7, 0x55, 0xB1, 0x84, 0x45, 0x26, 0xF1, 0xCB, 0xB5, 0xDC, 0x0B, 0x4A,
+    0xC9, 0xE0, 0xCA, 0x23, 0xA8, 0x15, 0x43, 0x67, 0xFB, 0x4A, 0x05, 0x31, 0x50, 0x3F, 0xEF, 0x0D,
+    0xBB, 0xB9, 0xB9, 0xE9, 0xBA, 0xAE, 0xAB, 0x66, 0x68, 0x70, 0xC5, 0x47, 0x34, 0x81, 0x8B, 0xC0,
+    0x3A, 0xF2, 0xDC, 0xE6, 0x77, 0xD9, 0xC2, 0xEF, 0x6E, 0xC2, 0x16, 0xA6, 0x6B, 0x68, 0x8B, 0x22,
+    0x83, 0x2D, 0x4C, 0x31, 0x82, 0x2D, 0xD0, 0xC3, 0x16, 0xA6, 0x98, 0xC0, 0x0A, 0x06, 0xAE, 0xC7,
+    0xBE, 0x80, 0x2D, 0xCC, 0xDF, 0x2A, 0xD8, 0xC2, 0x14, 0x0D, 0x6C, 0x81, 0xAB, 0xB0, 0x85, 0x29,
+    0xC6, 0xB0, 0x85, 0x29, 0xEC, 0x6B, 0xDF, 0x6D, 0x0B, 0xEC, 0x56, 0x97, 0x27, 0xEA, 0x55, 0x12,
+    0x1C, 0x4A, 0xB4, 0x9B, 0x6F, 0xF8, 0xE5, 0x0D, 0xA9, 0xF4, 0x5D, 0x8E, 0x30, 0x49, 0x97, 0xFA,
+    0x0F, 0xFA, 0xE1, 0xF6, 0xDB, 0x6D, 0x73, 0x6B, 0xF3, 0x2A, 0x17, 0x7E, 0x7B, 0xF7, 0xF6, 0xAD,
+    0x47, 0x5D, 0x97, 0x67, 0x7A, 0x29, 0x1C, 0xC3, 0x26, 0xFB, 0x2E, 0xE8, 0x72, 0xDF, 0x2F, 0x07,
+    0x9C, 0x60, 0x2C, 0x30, 0xD6, 0x61, 0x22, 0x98, 0x76, 0x9D, 0x48, 0xE0, 0x00, 0x06, 0xDE, 0x3E,
+    0x1C, 0x33, 0xF7, 0x30, 0x00, 0xC3, 0x4C, 0xEE, 0x6D, 0x39, 0xD3, 0xAA, 0xDB, 0x07, 0x29, 0xDE,
+    0xCE, 0xBA, 0xFD, 0x99, 0x6C, 0xA9, 0x8B, 0xCB, 0x55, 0x53, 0x85, 0x79, 0x04, 0xF7, 0x5B, 0x15,
+    0xF9, 0x91, 0xF8, 0x29, 0x96, 0x8B, 0x99, 0xA6, 0x04, 0x9E, 0x8C, 0x91, 0x8D, 0xCE, 0xC1, 0xBE,
+    0xB8, 0xB7, 0x46, 0xC8, 0x40, 0xCE, 0x98, 0x81, 0x3C, 0x12, 0x53, 0xF5, 0xB1, 0xD7, 0xC2, 0xEE,
+    0x7E, 0x0B, 0x5C, 0x08, 0x1A, 0x09, 0xAB, 0xF5, 0x1A, 0x71, 0xD6, 0x54, 0x62, 0x77, 0xCA, 0x4A,
+    0xA2, 0x33, 0xB2, 0x14, 0x6B, 0x0F, 0x43, 0x42, 0x36, 0xDF, 0x48, 0xAF, 0xEB, 0xDA, 0x10, 0x2D,
+    0xEA, 0x9A, 0x4B, 0x31, 0x5A, 0xF2, 0x3F, 0x1A, 0xC7, 0x40, 0xC0, 0x25, 0x6C, 0xFE, 0x25, 0x59,
+    0xB9, 0x71, 0x49, 0xE4, 0xCA, 0xFF, 0xD9, 0x5E, 0x38, 0x77, 0x0E, 0xB8, 0x37, 0x93, 0x7D, 0x44,
+    0xAD, 0xC9, 0x03, 0x17, 0x96, 0x00, 0xDB, 0xEA, 0x97, 0x25, 0x82, 0xF5, 0x56, 0x50, 0xC5, 0xD5,
+    0xAF, 0x4B, 0xBF, 0x30, 0xB9, 0x61, 0x9C, 0xA6, 0xA1, 0xB3, 0x8A, 0x3D, 0xF4, 0xB2, 0x03, 0xB1,
+    0xBB, 0xEE, 0xB2, 0x49, 0xAF, 0x98, 0xFC, 0x3A, 0xDF, 0xF4, 0xF8, 0x1B, 0x56, 0x92, 0x4C, 0xE0,
+    0xD3, 0xBE, 0x5C, 0x95, 0x30, 0xA5, 0x2F, 0xEF, 0xC1, 0x16, 0x13, 0x98, 0x07, 0x8B, 0x6C, 0xB0,
+    0xE4, 0xD6, 0xA6, 0x06, 0xA1, 0x1F, 0xE6, 0x99, 0x44, 0x34, 0x17, 0x4C, 0x7A, 0xDD, 0x0E, 0xEB,
+    0x3D, 0x87, 0x61, 0x1E, 0xCD, 0x16, 0xB6, 0x30, 0xF0, 0x85, 0x1B, 0xB4, 0xCE, 0x5D, 0xDA, 0xA4,
+    0xC6, 0x8F, 0x54, 0xD8, 0x5B, 0x00, 0x19, 0xC2, 0xB7, 0xB4, 0x72, 0xCB, 0x2F, 0x46, 0xA6, 0x32,
+    0xF9, 0x5E, 0x58, 0x99, 0x0F, 0xAA, 0x0B, 0xA5, 0x79, 0x3B, 0xFF, 0x0D, 0xA2, 0xC7, 0x7D, 0x89,
+    0xBD, 0x36, 0x7F, 0xCE, 0x81, 0x0F, 0x26, 0x95, 0x2A, 0xDE, 0x2D, 0x4D, 0x01, 0xE4, 0x40, 0x3C,
+    0x5B, 0xDA, 0x9B, 0xF0, 0x29, 0xCF, 0x52, 0x10, 0xF3, 0x09, 0x25, 0x09, 0x44, 0xE1, 0x2A, 0x64,
+    0x71, 0x3B, 0xEE, 0x2A, 0xE0, 0xA8, 0xB4, 0x5E, 0x9C, 0xCA, 0xA3, 0xC0, 0xB3, 0x08, 0xA4, 0x62,
+    0x84, 0x30, 0x83, 0xC8, 0x35, 0x2B, 0x90, 0x89, 0xC9, 0x20, 0x94, 0x4E, 0x06, 0x37, 0x80, 0x7F,
+    0xAD, 0xEB, 0xC6, 0x4D, 0x14, 0xCC, 0x2B, 0xCE, 0x89, 0xC9, 0xB1, 0x66, 0xFC, 0x51, 0x73, 0xAF,
+    0x4D, 0xD7, 0x62, 0x72, 0xF6, 0xDE, 0xCC, 0xC1, 0xD5, 0x02, 0x84, 0x98, 0x15, 0x1F, 0x5E, 0x38,
+    0xD2, 0x34, 0xB3, 0xC7, 0x9C, 0x05, 0x27, 0xF2, 0x5E, 0x4F, 0x4D, 0xAE, 0xC6, 0x25, 0x1C, 0xBB,
+    0x75, 0xA6, 0x97, 0x7C, 0x02, 0xEF, 0x33, 0x79, 0x05, 0xCF, 0x0B, 0xDF, 0x2E, 0x92, 0x74, 0x7B,
+    0x16, 0xA6, 0x7F, 0x72, 0x71, 0x13, 0xF9, 0x9F, 0xD0, 0x71, 0x82, 0x77, 0x09, 0xCB, 0xCF, 0x62,
+    0x5D, 0x7E, 0xB9, 0x71, 0x81, 0x49, 0xE8, 0x70, 0x86, 0x05, 0x3B, 0xE6, 0x9C, 0xB1, 0x62, 0x28,
+    0x14, 0xBB, 0xA1, 0x60, 0x71, 0xBD, 0xF7, 0xB1, 0x03, 0x2E, 0xBE, 0x47, 0x72, 0xBE, 0x6E, 0x69,
+    0x30, 0x14, 0xF4, 0xEC, 0x1D, 0x5E, 0x81, 0x07, 0x20, 0x59, 0x8E, 0x75, 0x68, 0xA6, 0xEF, 0x6D,
+    0xB9, 0x98, 0x7C, 0xDE, 0x44, 0x5D, 0xED, 0xFD, 0x91, 0x7E, 0xE9, 0xE6, 0xF9, 0xCE, 0x10, 0x80,
+    0xD4, 0x5C, 0xBD, 0xEB, 0x9E, 0x59, 0xB8, 0x2E, 0xBF, 0x33, 0x94, 0x10, 0xB2, 0xB3, 0xF4, 0xE9,
+    0x98, 0x43, 0x46, 0xEC, 0xDA, 0x0D, 0x8E, 0x18, 0xF1, 0xFE, 0x11, 0x67, 0x1A, 0x33, 0x55, 0x8E,
+    0x69, 0xA6, 0x98, 0x59, 0xA7, 0x63, 0xB4, 0xA2, 0x3B, 0xBC, 0xBD, 0x4B, 0x73, 0x46, 0x0E, 0xD1,
+    0x64, 0x9D, 0x26, 0x7C, 0xE8, 0x65, 0x53, 0xE4, 0x51, 0x9B, 0x4F, 0x87, 0x44, 0xEB, 0x5D, 0xA5,
+    0x32, 0xE5, 0x3C, 0xE5, 0x6A, 0x2C, 0xDD, 0x95, 0xE5, 0x94, 0x7D, 0x7A, 0xBA, 0xAC, 0x51, 0xDC,
+    0x21, 0xA5, 0x75, 0x14, 0xF4, 0x3B, 0x28, 0x34, 0x22, 0x13, 0x59, 0x5D, 0x28, 0x73, 0x6A, 0xBA,
+    0x78, 0x0E, 0xCA, 0x44, 0x35, 0x26, 0x1C, 0x03, 0xD2, 0xE5, 0x7A, 0x54, 0xF6, 0xF9, 0xE7, 0xB4,
+    0xD5, 0xE0, 0xCA, 0xED, 0x8F, 0xCB, 0xA1, 0x5B, 0xF1, 0x16, 0x19, 0xFC, 0x74, 0x77, 0x66, 0x8F,
+    0x82, 0xEE, 0xD3, 0x53, 0x80, 0x0B, 0x12, 0xB2, 0x0B, 0xDE, 0x81, 0x6A, 0x3E, 0x77, 0x8B, 0x08,
+    0x7F, 0xDA, 0x0A, 0x21, 0x3B, 0x92, 0xE0, 0x24, 0xFD, 0xAF, 0x83, 0x03, 0x90, 0x3F, 0xCC, 0xAD,
+    0x21, 0x69, 0xFE, 0xAE, 0x01, 0x65, 0x3F, 0xD4, 0xE0, 0x8A, 0x5E, 0xD1, 0x5F, 0x89, 0x92, 0x4C,
+    0xC9, 0x98, 0xCB, 0x91, 0x73, 0x03, 0x72, 0x36, 0x24, 0x28, 0xFE, 0x0A, 0x0B, 0xFB, 0x31, 0x92,
+    0x7F, 0xD4, 0x29, 0x3D, 0x1A, 0x52, 0xEE, 0xFE, 0xED, 0x59, 0xCF, 0xD6, 0xE2, 0x3E, 0x4C, 0x93,
+    0x3E, 0x64, 0x19, 0x1E, 0xD0, 0x68, 0x1B, 0xE2, 0x62, 0xD2, 0xD8, 0x16, 0xA1, 0x0D, 0xAD, 0xDB,
+    0x45, 0xC6, 0x79, 0xA0, 0x13, 0xE1, 0xBB, 0x9B, 0xBF, 0x10, 0x9F, 0x5F, 0x07, 0x55, 0x7F, 0x4B,
+    0x4F, 0xA0, 0x97, 0x38, 0xEC, 0x74, 0x91, 0xAB, 0xDA, 0x47, 0x74, 0x7A, 0x61, 0x5B, 0x35, 0xA7,
+    0x3A, 0x51, 0x79, 0xD6, 0x89, 0x6A, 0xEB, 0xA9, 0x7E, 0x44, 0x37, 0x79, 0x5E, 0x33, 0x60, 0xAA,
+    0x10, 0x37, 0x74, 0x1E, 0x49, 0x8B, 0xA7, 0x3C, 0x82, 0x81, 0xAD, 0xCC, 0xB8, 0x19, 0x88, 0xE0,
+    0x85, 0x23, 0x72, 0x41, 0xC5, 0xA9, 0x35, 0xCD, 0x56, 0xF7, 0xDB, 0xC6, 0xA1, 0x6C, 0xB4, 0x13,
+    0x8D, 0x44, 0x0B, 0x41, 0xA0, 0xA3, 0x6D, 0x88, 0x0C, 0x76, 0xA0, 0xB7, 0xF1, 0xA0, 0x3F, 0x1B,
+    0xCD, 0x30, 0x9F, 0x0A, 0x2F, 0x6C, 0x01, 0xD8, 0x92, 0x22, 0x1B, 0x47, 0x8F, 0x8E, 0x3C, 0xE3,
+    0xB1, 0xC8, 0x5B, 0x19, 0x8C, 0x03, 0x98, 0x36, 0xFF, 0xA0, 0xAB, 0x54, 0xC0, 0xCF, 0xD5, 0xC7,
+    0xB8, 0xBE, 0x55, 0x98, 0xB8, 0x56, 0x7A, 0xE9, 0xBB, 0xAB, 0x8B, 0x20, 0x7C, 0x1C, 0xB2, 0x56,
+    0x06, 0x9F, 0xA1, 0x29, 0x75, 0x0F, 0xEF, 0x1E, 0xD9, 0x12, 0x49, 0x54, 0x76, 0x0E, 0xFB, 0x6B,
+    0x0C, 0x05, 0xB6, 0x87, 0x27, 0x4D, 0x86, 0x49, 0x47, 0x43, 0x62, 0xC9, 0x06, 0x37, 0x78, 0x48,
+    0xBF, 0xF8, 0x90, 0xEA, 0xCB, 0x90, 0x92, 0x28, 0x30, 0x1E, 0x6E, 0xA8, 0x8E, 0x12, 0xC0, 0x63,
+    0x91, 0xC7, 0x68, 0x6D, 0x95, 0xD8, 0x4A, 0xF4, 0x1A, 0xEE, 0x01, 0x4D, 0xB8, 0x3A, 0x08, 0x7C,
+    0x2C, 0xF2, 0x18, 0x42, 0x88, 0x8F, 0x18, 0x72, 0x9E, 0xF2, 0x8F, 0x8A, 0xD1, 0xC7, 0x21, 0x2B,
+    0xEA, 0x6E, 0x8A, 0x96, 0x95, 0x92, 0xFC, 0xB4, 0x23, 0x0D, 0x88, 0xB4, 0x98, 0x64, 0x25, 0xE7,
+    0xB3, 0xC3, 0x4D, 0x0D, 0x67, 0xC0, 0xBD, 0xCD, 0x0F, 0x1E, 0x5C, 0x93, 0x06, 0xF4, 0xD3, 0xAB,
+    0x93, 0xAE, 0xF6, 0x6B, 0xF8, 0x0B, 0x48, 0x19, 0x8A, 0xF4, 0x92, 0x35, 0x7A, 0x01, 0x6D, 0xA2,
+    0x1C, 0xEA, 0xEC, 0x40, 0x27, 0x30, 0x9A, 0xE8, 0xBD, 0xAD, 0xBA, 0x47, 0xA9, 0xB8, 0xFB, 0xB4,
+    0xAF, 0x14, 0xE0, 0x12, 0x49, 0x79, 0x87, 0x08, 0x04, 0x4F, 0x2B, 0x77, 0xF2, 0xA5, 0xAC, 0x3D,
+    0x25, 0xA5, 0x9A, 0x51, 0xED, 0x4E, 0xBB, 0x54, 0x26, 0xDE, 0x37, 0xA0, 0xDE, 0xFE, 0x97, 0x85,
+    0x34, 0x8C, 0x97, 0x1A, 0xF5, 0x89, 0x07, 0x69, 0xB5, 0x07, 0x92, 0x96, 0xF9, 0x20, 0xEB, 0x13,
+    0x53, 0x02, 0x8F, 0x51, 0x59, 0x38, 0xD8, 0x09, 0x44, 0xF5, 0x55, 0xD0, 0x77, 0x24, 0xE1, 0x58,
+    0x82, 0xBF, 0x02, 0xA6, 0xCD, 0x27, 0x6E, 0x84, 0xDA, 0x08, 0x36, 0xF0, 0x3A, 0x1A, 0xE1, 0x90,
+    0x49, 0xE1, 0xDE, 0x3C, 0x6B, 0x2B, 0xA4, 0x29, 0x25, 0x0F, 0x17, 0x80, 0xB4, 0x50, 0xC6, 0xA7,
+    0xBE, 0x6A, 0x92, 0xEE, 0xE5, 0x59, 0x8A, 0xFC, 0x80, 0xBA, 0xB5, 0x04, 0xE9, 0x80, 0xC7, 0x99,
+    0x2A, 0x76, 0xE8, 0x12, 0x1A, 0x71, 0x9B, 0xDD, 0x3D, 0x76, 0x19, 0x31, 0xB7, 0x1D, 0xBA, 0xA0,
+    0x44, 0x17, 0x16, 0x2D, 0x3D, 0x34, 0x23, 0xE0, 0x6D, 0x73, 0x53, 0x12, 0x07, 0x98, 0x8B, 0x4A,
+    0xE4, 0x99, 0x90, 0x27, 0x04, 0xAC, 0x89, 0x07, 0x66, 0x35, 0xA0, 0x5C, 0x32, 0xC7, 0x52, 0x0D,
+    0x20, 0x3D, 0x59, 0x58, 0x91, 0x27, 0xA3, 0x90, 0xF6, 0x21, 0xD5, 0x60, 0xF5, 0x2E, 0xD9, 0x84,
+    0x54, 0xF3, 0x02, 0xBF, 0x5F, 0x79, 0x32, 0x0A, 0xAD, 0x71, 0x6B, 0xBA, 0xB7, 0x40, 0x94, 0x35,
+    0x0F, 0xFE, 0xB6, 0x23, 0xD3, 0x78, 0x42, 0xC6, 0xD1, 0x57, 0x46, 0xD7, 0x69, 0x19, 0x6E, 0x17,
+    0x9F, 0x5E, 0x66, 0x38, 0xA7, 0xAA, 0xCB, 0x1A, 0x8C, 0x30, 0x81, 0xA7, 0x24, 0x48, 0xD5, 0x36,
+    0xDF, 0x16, 0xF3, 0x05, 0x02, 0x95, 0x91, 0x95, 0xC0, 0xA5, 0x11, 0x5C, 0xDE, 0x37, 0x95, 0x4E,
+    0x19, 0x81, 0x8A, 0x6C, 0x63, 0xCA, 0x17, 0xC5, 0x2C, 0x56, 0xF0, 0x14, 0xE6, 0x69, 0xC6, 0x9C,
+    0xB1, 0x95, 0xA4, 0x88, 0x2B, 0x84, 0x47, 0x58, 0xF9, 0x28, 0x6F, 0x1B, 0x44, 0xFE, 0xB8, 0x0D,
+    0x0B, 0x69, 0x33, 0x9B, 0x43, 0xBF, 0xC8, 0x05, 0x45, 0x16, 0x63, 0x0E, 0x74, 0x63, 0x69, 0x13,
+    0xB8, 0x68, 0x9B, 0xC0, 0x45, 0x9B, 0x24, 0x28, 0xFC, 0x3A, 0x89, 0x50, 0xDE, 0xC5, 0xDB, 0x10,
+    0x13, 0xA1, 0x86, 0xCB, 0x2D, 0x88, 0x87, 0x0B, 0x1B, 0xB0, 0xAC, 0x88, 0x87, 0x5A, 0x63, 0x9E,
+    0xE0, 0x5C, 0x92, 0xA3, 0xDC, 0x73, 0x6D, 0x41, 0x15, 0x46, 0xC7, 0xE3, 0x6F, 0x6E, 0x5A, 0x14,
+    0x61, 0x7E, 0x75, 0x0C, 0x56, 0x0C, 0x61, 0x85, 0x27, 0x47, 0x00, 0x3B, 0x4B, 0x5A, 0x05, 0xAC,
+    0x03, 0xC1, 0x62, 0xB1, 0x14, 0x13, 0xF0, 0xC6, 0x43, 0x37, 0x26, 0x82, 0x8C, 0x88, 0x78, 0x93,
+    0xBE, 0x88, 0xC9, 0x08, 0x5A, 0x0A, 0x5F, 0x8A, 0x66, 0x49, 0x1A, 0xE7, 0xFD, 0xA9, 0x57, 0xA0,
+    0xE7, 0x25, 0x83, 0x27, 0xEB, 0x21, 0xE2, 0xBD, 0x05, 0x15, 0x24, 0xDB, 0x52, 0xAE, 0x32, 0xAF,
+    0x6C, 0x4E, 0x5B, 0xA1, 0x15, 0x65, 0x4F, 0xC5, 0x70, 0x54, 0x27, 0xB5, 0xF2, 0x13, 0xF2, 0xD0,
+    0xB9, 0x46, 0xA7, 0x6E, 0x21, 0xCA, 0x25, 0xFF, 0xF5, 0xD8, 0xC9, 0xCD, 0xB5, 0x65, 0x6F, 0x7F,
+    0x02, 0xC6, 0xB1, 0xC3, 0xC1, 0x6A, 0xA6, 0xE2, 0xE7, 0x8E, 0x03, 0xD5, 0xB2, 0x31, 0x78, 0x72,
+    0x8C, 0x9B, 0x23, 0x32, 0x64, 0x07, 0xD1, 0x70, 0x7B, 0x9E, 0x3B, 0x04, 0x79, 0x23, 0xE6, 0xA3,
+    0x4A, 0xCC, 0xE7, 0xC4, 0x0F, 0xC7, 0x74, 0xD0, 0x03, 0xED, 0x3C, 0x2B, 0x2E, 0xB3, 0x9F, 0xF2,
+    0x28, 0xB9, 0x1E, 0xCB, 0x9E, 0x8D, 0x1E, 0xCF, 0x38, 0xE0, 0x4F, 0xE9, 0x57, 0x01, 0x16, 0xED,
+    0x35, 0x58, 0x73, 0x8B, 0x25, 0xB7, 0x18, 0xDB, 0xD8, 0xDC, 0xAB, 0x79, 0xD2, 0x61, 0x5D, 0x54,
+    0x44, 0xF7, 0xBB, 0x34, 0xE6, 0xB9, 0xEE, 0x66, 0x9F, 0x66, 0xA6, 0x4B, 0x53, 0xCD, 0x97, 0xE2,
+    0xB3, 0x48, 0x13, 0xAB, 0x27, 0x68, 0xB1, 0xEB, 0x53, 0x76, 0xA4, 0xE3, 0x62, 0x1D, 0x49, 0x26,
+    0xDD, 0x90, 0x71, 0x48, 0x1D, 0x72, 0x95, 0x15, 0x43, 0xDA, 0xAF, 0xA6, 0x4A, 0xEE, 0x33, 0x3D,
+    0x83, 0xD6, 0xBE, 0x20, 0xA1, 0x0C, 0xF2, 0x48, 0x55, 0x36, 0xB5, 0x9A, 0xA7, 0x95, 0xFE, 0xB8,
+    0x8A, 0x8E, 0x9C, 0x69, 0x90, 0xE1, 0x9B, 0x78, 0x0D, 0xC1, 0xCD, 0x80, 0xC4, 0x42, 0x47, 0x96,
+    0x95, 0xC3, 0x54, 0xE3, 0xB2, 0x57, 0xAA, 0xAF, 0x07, 0xB4, 0x1A, 0x51, 0xFE, 0x2F, 0xB3, 0x42,
+    0x7B, 0xB7, 0x30, 0x3B, 0x8D, 0xA2, 0x25, 0x49, 0x35, 0xAC, 0x66, 0x70, 0xC7, 0xF3, 0xE5, 0x8B,
+    0x32, 0x6B, 0x27, 0xE6, 0xE0, 0xF5, 0x26, 0x2C, 0x83, 0xDA, 0xE6, 0x80, 0x03, 0x45, 0x39, 0x53,
+    0x22, 0x05, 0x97, 0x53, 0xDC, 0x98, 0xE9, 0x2E, 0x10, 0xD1, 0xE2, 0x74, 0x22, 0x3B, 0x2E, 0xF1,
+    0xEF, 0xBB, 0xB8, 0x7B, 0x57, 0xC2, 0x83, 0x68, 0x48, 0xB9, 0xA4, 0xFE, 0x2C, 0xE9, 0x49, 0x65,
+    0xC6, 0x03, 0x7B, 0x74, 0x27, 0x38, 0xFF, 0x5A, 0x5F, 0xA6, 0xB3, 0x4A, 0x67, 0x91, 0x3E, 0xC2,
+    0xCE, 0xCD, 0x4B, 0xF4, 0x93, 0x98, 0x9F, 0xB5, 0x77, 0x54, 0x5F, 0xD1, 0xCA, 0x9B, 0x85, 0xF7,
+    0xBC, 0xEE, 0x3E, 0x91, 0xB9, 0xD1, 0xB3, 0x94, 0x8E, 0xD0, 0x96, 0xAB, 0xE9, 0x13, 0xB1, 0xCB,
+    0x5E, 0x5F, 0x24, 0xB3, 0x3C, 0x66, 0x63, 0x85, 0xAC, 0x05, 0xF2, 0xEA, 0xC9, 0xC9, 0x38, 0x5F,
+    0xBC, 0x01, 0x2F, 0xEA, 0x9A, 0xAF, 0xBB, 0xD2, 0x3C, 0xF8, 0x55, 0xF7, 0x4E, 0x15, 0x96, 0xB6,
+    0x45, 0xAC, 0xE4, 0x61, 0xC5, 0x73, 0xF1, 0xA0, 0xE4, 0x7C, 0x21, 0x1C, 0x78, 0xC4, 0x5C, 0xE4,
+    0xA6, 0x88, 0x89, 0x1A, 0x4E, 0xC9, 0xDA, 0x33, 0xD3, 0x5A, 0x31, 0x93, 0x9D, 0x94, 0x1E, 0xC7,
+    0x07, 0x2A, 0xDB, 0xC1, 0xFD, 0xEA, 0xAC, 0x4B, 0xBA, 0x75, 0xD6, 0x26, 0xCD, 0x06, 0x99, 0xB0,
+    0x53, 0x04, 0x08, 0x1F, 0x2C, 0x1E, 0xFD, 0x84, 0x83, 0x1F, 0xCD, 0x6B, 0x95, 0xE5, 0xE8, 0x9B,
+    0xB7, 0xA9, 0x56, 0x62, 0x17, 0x01, 0x30, 0x40, 0x05, 0x26, 0xCC, 0xBB, 0xC3, 0xA3, 0x9F, 0x79,
+    0xE9, 0x89, 0xF6, 0x4C, 0xC3, 0x2A, 0x76, 0x88, 0x57, 0x4E, 0x48, 0x48, 0xD0, 0xFC, 0x50, 0x2D,
+    0x59, 0xA8, 0xE9, 0xE5, 0x3E, 0x88, 0x53, 0x60, 0x4E, 0xCA, 0x1F, 0xA4, 0x4A, 0x37, 0xF6, 0xF6,
+    0xC1, 0xAD, 0x1B, 0xB4, 0x54, 0x73, 0xCB, 0x71, 0xB9, 0xE7, 0x20, 0xB7, 0x05, 0xAE, 0x95, 0x03,
+    0x15, 0x65, 0x78, 0x45, 0x8F, 0x44, 0xB5, 0x93, 0x99, 0x9F, 0x75, 0x35, 0x79, 0x05, 0xB0, 0x26,
+    0xC6, 0xAE, 0xEC, 0x21, 0xE1, 0xBA, 0x41, 0xC0, 0x49, 0xCC, 0x7F, 0x06, 0xDE, 0x3E, 0x86, 0x71,
+    0xC6, 0x80, 0x9E, 0x73, 0xFE, 0x51, 0x72, 0x38, 0x81, 0xB9, 0x3D, 0x67, 0xE0, 0x25, 0x70, 0xD3,
+    0x91, 0xC2, 0xCD, 0xFB, 0x52, 0x7B, 0x35, 0x1F, 0x70, 0x99, 0xD2, 0x14, 0x7C, 0x8C, 0x04, 0xC2,
+    0x81, 0x04, 0x13, 0x69, 0x4A, 0x19, 0xE9, 0x4A, 0x8D, 0x1E, 0xFF, 0x47, 0xBA, 0xE5, 0xFD, 0x1E,
+    0xBD, 0x4F, 0x8C, 0x47, 0x5A, 0x01, 0xC2, 0xE3, 0x6D, 0xCA, 0x87, 0x9F, 0x28, 0x02, 0x24, 0x23,
+    0xF5, 0x96, 0x71, 0x4F, 0x4A, 0xD6, 0xF8, 0x54, 0xD0, 0xEB, 0xD2, 0xE0, 0xA3, 0x3C, 0xF2, 0xAA,
+    0xB5, 0x7E, 0x96, 0xEF, 0x39, 0x09, 0x2C, 0x12, 0x7E, 0x50, 0xD9, 0x0F, 0x2B, 0x5F, 0x6E, 0x0E,
+    0xD6, 0xF8, 0xBE, 0x6A, 0xE8, 0xC1, 0x50, 0x7E, 0x45, 0xCC, 0xBF, 0xC9, 0xE9, 0x0A, 0x4D, 0x5A,
+    0xD1, 0xFD, 0x54, 0x2E, 0xB0, 0x30, 0x30, 0x9A, 0x12, 0xE4, 0xFC, 0x1F, 0x2A, 0xAF, 0x3B, 0xA8,
+    0x82, 0xAF, 0xB6, 0xAA, 0x28, 0x0D, 0x19, 0x97, 0xD5, 0x48, 0xD3, 0x83, 0x36, 0x24, 0x08, 0xC6,
+    0x27, 0x63, 0x33, 0x42, 0x86, 0xD9, 0x17, 0xE6, 0x24, 0x1E, 0x43, 0x0F, 0x5E, 0x01, 0x25, 0xCD,
+    0x81, 0xE5, 0x83, 0x3B, 0x84, 0xD1, 0xB3, 0x41, 0xB3, 0x74, 0x9A, 0x2B, 0xB7, 0x62, 0x48, 0xF8,
+    0x02, 0xE3, 0xBD, 0xAF, 0x3F, 0x6B, 0x59, 0x44, 0xDD, 0x13, 0xD3, 0xCE, 0xAB, 0xC2, 0x80, 0xCF,
+    0x3A, 0x90, 0x0F, 0x5A, 0x6A, 0x4F, 0x86, 0x8B, 0x65, 0xA1, 0xE0, 0xD3, 0x13, 0xB0, 0x8A, 0x0F,
+    0x23, 0x4B, 0xB8, 0x72, 0xA0, 0x1D, 0x0F, 0xA0, 0x18, 0x37, 0x8B, 0xF3, 0x81, 0xBC, 0xF7, 0xEF,
+    0x63, 0x31, 0xF4, 0xE9, 0xE0, 0x27, 0x5B, 0x79, 0x58, 0x80, 0x47, 0x92, 0x50, 0xC2, 0x46, 0x63,
+    0x4D, 0x77, 0x7E, 0x35, 0x59, 0x5A, 0xCD, 0x44, 0x48, 0x73, 0xB1, 0x1A, 0xB7, 0xCF, 0xA7, 0x2B,
+    0x50, 0xAC, 0x18, 0x14, 0x1E, 0x7C, 0x5C, 0xEB, 0x73, 0x7B, 0xBC, 0x3E, 0x3F, 0x89, 0xF9, 0x59,
+    0xB9, 0xB2, 0x70, 0x65, 0xDD, 0x5A, 0x25, 0x39, 0xE2, 0xE7, 0xE4, 0x74, 0xA7, 0xD5, 0x59, 0xE7,
+    0x33, 0x86, 0x96, 0x6B, 0xFD, 0x93, 0x98, 0x5B, 0xCF, 0x04, 0x5C, 0xDF, 0x06, 0x3A, 0xB7, 0xF4,
+    0x84, 0xB1, 0x5C, 0xC8, 0xFA, 0xF6, 0xB8, 0x33, 0x72, 0xF6, 0x3F, 0x97, 0xE1, 0x32, 0xAD, 0x1C,
+    0xFE, 0x8C, 0x95, 0x3E, 0xD8, 0x8E, 0x05, 0xD3, 0x19, 0x67, 0xD6, 0x65, 0x13, 0x04, 0x46, 0x16,
+    0x19, 0x94, 0x05, 0xD6, 0x35, 0xF1, 0x58, 0xAA, 0x08, 0xE5, 0xB8, 0xAD, 0x82, 0xC2, 0x42, 0x4B,
+    0x0B, 0x77, 0x1A, 0xCF, 0x6A, 0xF9, 0xE1, 0xE2, 0x8C, 0xD5, 0xF5, 0xC9, 0x5D, 0xCB, 0xDA, 0x7A,
+    0x00, 0xD8, 0xDE, 0xD5, 0xFC, 0x9B, 0xF2, 0x26, 0x7C, 0x24, 0xC3, 0xEA, 0x1B, 0xAC, 0x1E, 0x0C,
+    0xCA, 0x03, 0x83, 0xF2, 0x2B, 0x1E, 0xA5, 0xD2, 0x8F, 0x12, 0x3D, 0x74, 0x0D, 0xF3, 0x91, 0x1E,
+    0xA4, 0xF6, 0x19, 0x66, 0x1B, 0x19, 0x26, 0x41, 0x86, 0xB1, 0xDF, 0x66, 0x0F, 0x79, 0x8F, 0xF8,
+    0x7B, 0xBD, 0x3F, 0x9C, 0xD8, 0xFC, 0x03, 0x7B, 0x20, 0x75, 0x0C, 0xFF, 0x92, 0xCB, 0x3A, 0x1C,
+    0x78, 0xB5, 0x17, 0x70, 0x22, 0xF3, 0x6B, 0x86, 0x7F, 0xAB, 0xD2, 0x2C, 0x7F, 0xF6, 0x28, 0xC3,
+    0x9F, 0x8C, 0xEE, 0x7D, 0x7D, 0xB3, 0x3D, 0x67, 0x77, 0xCA, 0xE0, 0x8E, 0xD5, 0x37, 0xF2, 0xA6,
+    0xF8, 0xB7, 0x58, 0x45, 0x16, 0xFD, 0xA3, 0xCE, 0x11, 0xFF, 0xC5, 0x62, 0xCC, 0x5C, 0x34, 0x26,
+    0x86, 0xC6, 0xBC, 0x2D, 0xE6, 0xD6, 0x45, 0xBC, 0xD7, 0xEA, 0x81, 0x93, 0x9E, 0x38, 0x6D, 0x71,
+    0x26, 0x82, 0x76, 0xA8, 0xA7, 0xC6, 0xF5, 0x9C, 0x3A, 0xEA, 0x73, 0x22, 0x7D, 0x34, 0x13, 0xCF,
+    0x45, 0x2B, 0x8F, 0x9D, 0xF1, 0xE2, 0xEC, 0x88, 0xC0, 0x1C, 0xFF, 0xAF, 0x09, 0x4A, 0x3D, 0xF6,
+    0x88, 0x94, 0x69, 0x7C, 0xB4, 0x83, 0x94, 0x35, 0xFD, 0x6A, 0xC6, 0xFB, 0xE0, 0x99, 0x33, 0x0E,
+    0x6A, 0xFB, 0xA7, 0xB0, 0xD6, 0x79, 0xC4, 0x1B, 0x5F, 0xF1, 0x86, 0xA7, 0xDD, 0xD0, 0x8E, 0x9C,
+    0x84, 0xF0, 0x54, 0x21, 0x8D, 0x87, 0x0D, 0x94, 0xB1, 0xBB, 0x20, 0x0D, 0xF6, 0x55, 0x62, 0x02,
+    0xCF, 0x3F, 0xBF, 0xF3, 0x01, 0x2C, 0x6D, 0x52, 0x8F, 0x59, 0x0A, 0x72, 0xC0, 0xD5, 0x73, 0xCB,
+    0x85, 0xFD, 0xE9, 0x9B, 0xE9, 0xBF, 0xC5, 0x5B, 0x3F, 0x70, 0xE4, 0x66, 0x15, 0x7F, 0x92, 0xEE,
+    0x2C, 0x40, 0x33, 0xC8, 0x85, 0x0D, 0x49, 0x6E, 0x40, 0x29, 0x52, 0x1C, 0x90, 0x44, 0x0D, 0x05,
+    0x85, 0x57, 0x2B, 0xA0, 0xA0, 0x48, 0x81, 0x8B, 0x73, 0x98, 0x21, 0x33, 0x1C, 0x05, 0x05, 0x03,
+    0xC3, 0x5C, 0x13, 0x66, 0x8E, 0x19, 0xAD, 0x57, 0x03, 0x05, 0x05, 0x45, 0xDC, 0xA4, 0xE6, 0x8A,
+    0x2B, 0xE0, 0x0A, 0x48, 0x91, 0xC2, 0x0C, 0xEB, 0x5B, 0x01, 0x05, 0x05, 0x45, 0x94, 0x49, 0x32,
+    0x14, 0x14, 0x59, 0xC2, 0x01, 0x05, 0xC5, 0x09, 0xD0, 0xCD, 0xC9, 0x44, 0xB6, 0xF8, 0xFD, 0xDE,
+    0x27, 0x69, 0xD7, 0x77, 0xC6, 0xB9, 0x70, 0x6B, 0xDB, 0xB7, 0xFA, 0x76, 0x6F, 0x2D, 0x7D, 0xEF,
+    0xFD, 0xDE, 0xF7, 0xBE, 0xF7, 0xF7, 0xB3, 0x88, 0xDF, 0xE4, 0x22, 0x01, 0x87, 0x8B, 0x5B, 0xB1,
+    0x98, 0x1F, 0xAB, 0xC4, 0xE0, 0x54, 0x18, 0x3C, 0x0E, 0xFE, 0x04, 0x43, 0x98, 0x60, 0x18, 0x70,
+    0xA8, 0x37, 0x78, 0xC7, 0x00, 0x77, 0x14, 0x18, 0xDC, 0x3C, 0xC2, 0x1D, 0x29, 0x86, 0x40, 0x42,
+    0x91, 0x61, 0xD3, 0x88, 0x4C, 0x39, 0x1C, 0xDE, 0xFA, 0xA5, 0xD8, 0x85, 0x04, 0xB1, 0x33, 0x13,
+    0x3F, 0xF6, 0x33, 0xDC, 0x14, 0xA4, 0x18, 0x86, 0xB8, 0x3D, 0x1B, 0x61, 0xEA, 0x4C, 0x69, 0x87,
+    0xB8, 0x3A, 0xCA, 0x97, 0x66, 0x97, 0x65, 0x5A, 0x27, 0xCE, 0xC1, 0xD5, 0xCA, 0x9B, 0xB9, 0xA5,
+    0x9F, 0x39, 0x45, 0x08, 0x2A, 0x43, 0x71, 0x66, 0x11, 0xAE, 0x11, 0x88, 0x4D, 0xF0, 0xDC, 0x04,
+    0x13, 0x4C, 0x24, 0x4C, 0x13, 0x19, 0xC7, 0x43, 0xFB, 0x6E, 0x1C, 0x36, 0xAF, 0x88, 0x77, 0x10,
+    0x88, 0xE8, 0x2C, 0x1F, 0x91, 0x6F, 0x8A, 0x7C, 0xDA, 0x9A, 0x81, 0x4C, 0x93, 0x81, 0xBF, 0x86,
+    0xDF, 0xAE, 0xCA, 0x19, 0x43, 0x23, 0x17, 0x64, 0x82, 0x3C, 0x28, 0x0B, 0x9B, 0xB2, 0x3C, 0x88,
+    0x67, 0x05, 0x02, 0x72, 0x24, 0xB9, 0x5D, 0x92, 0x2C, 0x30, 0xD8, 0x33, 0x0E, 0xF7, 0xF8, 0xDD,
+    0x21, 0x87, 0xB5, 0x25, 0xE0, 0x21, 0xB3, 0x98, 0xD6, 0xE1, 0x52, 0xF1, 0x7A, 0x1B, 0x9F, 0xEB,
+    0x6E, 0xC5, 0xD6, 0x39, 0x6C, 0x73, 0x20, 0x4E, 0x87, 0xE4, 0x3D, 0x4A, 0xE0, 0x42, 0xBF, 0x9C,
+    0xCD, 0x3E, 0xB5, 0x97, 0x98, 0x76, 0xBE, 0x21, 0x36, 0x1F, 0x74, 0xC9, 0xA9, 0x4F, 0xE6, 0x01,
+    0x07, 0x80, 0x79, 0x5B, 0xC4, 0x61, 0xC4, 0x81, 0xA2, 0x92, 0xFA, 0x98, 0x61, 0xD2, 0x93, 0x1A,
+    0x92, 0x42, 0x30, 0x5B, 0x89, 0xC5, 0x6B, 0x9A, 0x14, 0x24, 0xB8, 0x7C, 0x96, 0x0A, 0xFE, 0x62,
+    0x6C, 0x66, 0x8D, 0x0C, 0x47, 0x0E, 0x76, 0x8D, 0xD5, 0x72, 0xE2, 0xED, 0x53, 0xAE, 0xE2, 0x1C,
+    0x7C, 0x5D, 0x3C, 0xEA, 0x1E, 0xEE, 0x0A, 0x5B, 0xCA, 0x24, 0x9C, 0xB4, 0x24, 0xBA, 0x6B, 0xA4,
+    0x84, 0x9E, 0x06, 0xEF, 0x85, 0x38, 0xCD, 0x4C, 0x65, 0xD9, 0x52, 0xF1, 0x09, 0x73, 0x48, 0x14,
+    0xD5, 0x2E, 0x69, 0x0C, 0x48, 0xE4, 0xC2, 0xF9, 0x00, 0xDE, 0x34, 0x7A, 0xE6, 0xE3, 0x89, 0xE8,
+    0x79, 0x91, 0xD2, 0x8F, 0x25, 0xB6, 0x96, 0x0D, 0x58, 0x35, 0x4D, 0x01, 0xAC, 0x74, 0x16, 0xE8,
+    0x9C, 0xB0, 0x62, 0x3F, 0x40, 0x79, 0xF1, 0xC5, 0xCE, 0x9C, 0x8B, 0xA5, 0xE0, 0x54, 0xA1, 0x15,
+    0x01, 0xEF, 0x9F, 0x74, 0xAB, 0x1B, 0x10, 0xC6, 0xC5, 0xF3, 0x01, 0xBB, 0x0A, 0x43, 0xB2, 0x81,
+    0xFD, 0x16, 0x84, 0x66, 0x71, 0x49, 0xCA, 0x8A, 0x97, 0x08, 0x78, 0x93, 0x96, 0xEA, 0xBA, 0x87,
+    0x67, 0x07, 0x7C, 0x30, 0xA8, 0x3A, 0xC5, 0xEE, 0xA8, 0xC8, 0xF8, 0x30, 0x26, 0x1D, 0xFC, 0xE2,
+    0xE0, 0xA5, 0x43, 0x6E, 0xA7, 0x71, 0x0C, 0xBB, 0xE6, 0x67, 0x58, 0x03, 0x8F, 0x83, 0x9B, 0x63,
+    0xBF, 0x3B, 0x33, 0xEC, 0x31, 0x67, 0x06, 0x4E, 0x9D, 0x19, 0xD4, 0xC4, 0xCD, 0x21, 0x0E, 0x2F,
+    0x07, 0x4B, 0x7E, 0x06, 0x55, 0x84, 0xC5, 0x02, 0x6F, 0x31, 0xB8, 0x1B, 0x83, 0x3D, 0xAB, 0xC6,
+    0xE0, 0x95, 0xB2, 0xBD, 0x35, 0xCD, 0x65, 0xDC, 0x1C, 0x72, 0xF6, 0x85, 0x75, 0x94, 0xE0, 0x2B,
+    0x2A, 0x4A, 0x9F, 0x0C, 0x84, 0x81, 0x0A, 0x73, 0x83, 0xE3, 0xE0, 0x69, 0x69, 0x61, 0x5D, 0x9A,
+    0x11, 0xD0, 0xB4, 0xC6, 0xE8, 0xEC, 0x5F, 0x05, 0x67, 0x34, 0x69, 0x5C, 0x02, 0xEA, 0x44, 0xA8,
+    0x9A, 0x31, 0x54, 0x2B, 0x14, 0xE9, 0x48, 0xE3, 0x46, 0x19, 0x50, 0x7F, 0x27, 0xBA, 0x50, 0x34,
+    0x71, 0x9C, 0x6A, 0x0C, 0x1A, 0x34, 0x73, 0x78, 0x0A, 0x86, 0x4E, 0x8C, 0xA9, 0x6B, 0x8D, 0x37,
+    0x04, 0xB5, 0xC3, 0xEF, 0xC1, 0xDF, 0xF0, 0x45, 0xAC, 0x4A, 0x24, 0x41, 0x8E, 0xA9, 0x30, 0xF9,
+    0x84, 0xFA, 0x37, 0xA1, 0x75, 0xAF, 0x28, 0x0F, 0x50, 0xAE, 0x3E, 0xB1, 0x7F, 0x45, 0xAA, 0x61,
+    0x53, 0x59, 0xE5, 0xB0, 0x29, 0xED, 0x92, 0x12, 0x29, 0x3A, 0x89, 0x78, 0x39, 0x08, 0x07, 0x19,
+    0x84, 0x31, 0x86, 0x24, 0xEC, 0x03, 0x09, 0x5E, 0xBD, 0x56, 0x52, 0x85, 0x52, 0xCC, 0x7E, 0x67,
+    0x01, 0xB7, 0x6A, 0x01, 0xAE, 0x5B, 0xD3, 0x1B, 0x22, 0x0D, 0x96, 0x49, 0xB6, 0xB6, 0x63, 0x03,
+    0x59, 0x11, 0x37, 0x00, 0xEC, 0xEC, 0x63, 0x89, 0x14, 0xAE, 0x9F, 0x82, 0x15, 0x05, 0xAB, 0x58,
+    0x07, 0x1C, 0x14, 0xA9, 0x02, 0x55, 0x9C, 0x0A, 0x33, 0x91, 0x69, 0x6C, 0x40, 0x2A, 0x46, 0x03,
+    0x51, 0x11, 0xBA, 0x4D, 0x09, 0x85, 0x2B, 0xE0, 0xD6, 0x8D, 0xD3, 0x1B, 0x37, 0x35, 0x96, 0xA2,
+    0x96, 0x83, 0xAD, 0x2B, 0x04, 0x45, 0xEF, 0xC5, 0x8D, 0xA6, 0x9B, 0x6D, 0x66, 0xAC, 0xA8, 0x0B,
+    0xAE, 0xA1, 0xA3, 0xB1, 0xFF, 0xCE, 0x96, 0x2A, 0x1C, 0x17, 0x89, 0xF3, 0x75, 0x8A, 0xC7, 0x6B,
+    0x1B, 0x8F, 0x77, 0x53, 0xC1, 0x8F, 0x01, 0x36, 0xAE, 0xF5, 0xAD, 0xD6, 0xAF, 0x56, 0x46, 0x69,
+    0xF7, 0xC3, 0x94, 0xFA, 0xC1, 0x7F, 0x21, 0x90, 0x47, 0xD6, 0x6D, 0xDC, 0x56, 0xE9, 0xAD, 0x7B,
+    0x0F, 0x29, 0xED, 0x13, 0x90, 0x56, 0x0D, 0xDA, 0xAD, 0xD2, 0xAE, 0x60, 0x74, 0xE3, 0xEB, 0xD0,
+    0xE2, 0x02, 0x7B, 0x25, 0x6B, 0x35, 0xF9, 0x74, 0xF8, 0x7F, 0xC6, 0x4A, 0x65, 0x03, 0x4E, 0x6F,
+    0x88, 0x2D, 0xE9, 0x1F, 0xF4, 0xBA, 0xB1, 0x14, 0x1C, 0x6A, 0x54, 0xC2, 0xD6, 0x62, 0x3C, 0x39,
+    0x57, 0x84, 0xD3, 0xC0, 0x41, 0xAB, 0xA9, 0x13, 0x31, 0x24, 0xB9, 0x31, 0xA7, 0xB5, 0x0C, 0x1C,
+    0xA7, 0xC1, 0xAF, 0x9D, 0x9B, 0x9B, 0xE0, 0xCC, 0x84, 0xBB, 0x3F, 0xE2, 0x03, 0xB9, 0x31, 0x4B,
+    0x8F, 0xC5, 0x33, 0x98, 0xFB, 0x64, 0x6A, 0x88, 0x6F, 0xB4, 0xE6, 0x64, 0x40, 0x2B, 0x90, 0x99,
+    0x10, 0x81, 0x1E, 0xDC, 0xC9, 0x12, 0xB1, 0xDF, 0x03, 0xF7, 0xD4, 0xAD, 0xB1, 0x9C, 0xAA, 0x7E,
+    0xAD, 0x62, 0x61, 0x06, 0x78, 0xD2, 0xC7, 0xEE, 0xF7, 0xA0, 0x5F, 0x0E, 0x27, 0xDE, 0x5C, 0xA2,
+    0x8E, 0xE9, 0x64, 0xEA, 0xA1, 0xD4, 0xB6, 0x8F, 0x18, 0xA5, 0xD0, 0xC1, 0x59, 0x5D, 0x7C, 0x20,
+    0xD6, 0x14, 0x16, 0x1E, 0xE6, 0x28, 0x93, 0xE9, 0xDB, 0x2F, 0x65, 0xF6, 0xC1, 0x23, 0x78, 0xB4,
+    0xA0, 0x81, 0x0B, 0x0B, 0x39, 0xAC, 0x8F, 0xE9, 0xCC, 0x22, 0x0E, 0x23, 0x72, 0x91, 0xD0, 0xA3,
+    0x4D, 0xE8, 0xD1, 0x2A, 0x78, 0x34, 0x88, 0xC8, 0x55, 0x43, 0xA6, 0x16, 0xBE, 0x8D, 0xCD, 0x7A,
+    0x8F, 0x47, 0xF1, 0x3A, 0xEF, 0xD1, 0x75, 0xC5, 0x05, 0x63, 0xC5, 0x2E, 0xF8, 0x5F, 0xA9, 0x3E,
+    0x46, 0xC3, 0x01, 0x26, 0x9B, 0xAF, 0x1D, 0x8A, 0x5D, 0x59, 0x07, 0xB4, 0x72, 0x35, 0xCD, 0x5A,
+    0x4D, 0xAE, 0x6A, 0x8A, 0x16, 0xD3, 0xD3, 0x0F, 0x85, 0x14, 0xBF, 0x5A, 0xC1, 0x90, 0x5E, 0x10,
+    0xB1, 0x33, 0x64, 0x99, 0xFD, 0x3A, 0x87, 0x61, 0xFB, 0x7B, 0x26, 0x76, 0xF3, 0x02, 0x68, 0xAC,
+    0x72, 0x25, 0xC4, 0xF8, 0x93, 0x16, 0xC9, 0x0F, 0xE8, 0xB8, 0xC7, 0xE4, 0xEC, 0x92, 0xE6, 0x1D,
+    0xF2, 0x4D, 0x1B, 0x6F, 0xAF, 0x31, 0x68, 0x1D, 0x37, 0xBC, 0xAF, 0x5A, 0x74, 0x81, 0x67, 0x2B,
+    0xA1, 0x15, 0x79, 0x42, 0xD4, 0xBE, 0xA9, 0x81, 0x33, 0x16, 0xAE, 0x53, 0xC1, 0xF3, 0x11, 0x8E,
+    0x1A, 0x3D, 0x7A, 0x55, 0x13, 0xDA, 0xDB, 0xE9, 0x91, 0xE8, 0xEF, 0x1C, 0xD4, 0x47, 0x39, 0xD5,
+    0x69, 0x9F, 0x5C, 0x64, 0xE5, 0x7C, 0x84, 0x73, 0xF6, 0x32, 0x90, 0x3E, 0x18, 0xE7, 0x27, 0x9A,
+    0x48, 0xF9, 0x82, 0xCC, 0xB3, 0x67, 0x5D, 0xAD, 0xAC, 0xCB, 0xC1, 0x82, 0x9E, 0xF2, 0xB9, 0xEA,
+    0xD0, 0xDC, 0x0E, 0x31, 0x8E, 0x95, 0x81, 0xDA, 0x21, 0xBF, 0x0B, 0xB9, 0xDB, 0xC8, 0x6E, 0x97,
+    0xF8, 0x2B, 0x86, 0x55, 0x8C, 0xAD, 0xAC, 0x12, 0xF4, 0xED, 0x02, 0xF4, 0x75, 0x40, 0x8C, 0x89,
+    0xB0, 0x2A, 0x87, 0xB1, 0x74, 0x33, 0x88, 0xA4, 0xC9, 0x3C, 0x0E, 0xB0, 0xB4, 0x57, 0x53, 0x06,
+    0x9A, 0x31, 0xE8, 0x07, 0x44, 0x1B, 0x92, 0x89, 0x88, 0x12, 0x8F, 0xC8, 0xC9, 0x88, 0x12, 0x4F,
+    0x38, 0xFB, 0xC4, 0xCC, 0xAE, 0x42, 0xF4, 0x73, 0x13, 0xDD, 0x57, 0x15, 0xA6, 0xDC, 0x58, 0x48,
+    0xDC, 0x1E, 0x30, 0xD6, 0x8B, 0x91, 0x74, 0x05, 0xE8, 0xF7, 0x10, 0xE3, 0xDD, 0x7F, 0xA7, 0xB6,
+    0x0F, 0x25, 0x41, 0xFA, 0x9B, 0x40, 0x2C, 0x09, 0xB8, 0x9A, 0x20, 0xEC, 0xAA, 0x20, 0xBD, 0xCA,
+    0xCF, 0xAC, 0x12, 0x31, 0x5E, 0xE1, 0xC7, 0x36, 0x8C, 0xAC, 0x33, 0x83, 0xE0, 0x90, 0xD7, 0xBB,
+    0xD9, 0x80, 0xB2, 0x55, 0x80, 0x2D, 0x0F, 0x0A, 0x71, 0x7D, 0x7F, 0xEB, 0xC5, 0xFD, 0x18, 0xA9,
+    0x3E, 0xBC, 0x86, 0x8E, 0xB1, 0x43, 0x98, 0xFA, 0xCA, 0x45, 0x81, 0x8A, 0x22, 0x15, 0x85, 0x2A,
+    0x8A, 0x95, 0x6B, 0x03, 0x67, 0xA1, 0x68, 0x0D, 0x5C, 0x83, 0x77, 0xFE, 0x1A, 0xE9, 0x4B, 0x35,
+    0x89, 0xA3, 0x21, 0xB8, 0x88, 0xCC, 0x9E, 0xDE, 0xE2, 0xBC, 0x62, 0xED, 0x6D, 0xB5, 0xC8, 0x9E,
+    0x4A, 0xA5, 0x6C, 0x4A, 0xEB, 0xFE, 0xDF, 0x6A, 0xBB, 0x91, 0x89, 0x7D, 0x1C, 0xB2, 0x94, 0xC8,
+    0xAC, 0xE3, 0x91, 0x5D, 0x84, 0xEA, 0x85, 0xB3, 0x97, 0x75, 0xC1, 0x8B, 0x30, 0xEB, 0xD7, 0x74,
+    0xD8, 0x30, 0x7F, 0x10, 0x8D, 0xBF, 0xA9, 0xB0, 0xBC, 0x1E, 0x74, 0x8B, 0xC3, 0x56, 0xD2, 0x83,
+    0x45, 0x49, 0x8B, 0x3C, 0xE8, 0x61, 0xC3, 0x43, 0x63, 0x9A, 0xAD, 0xF8, 0x82, 0x57, 0x3D, 0x0B,
+    0x1F, 0xB7, 0xE1, 0x17, 0xAB, 0x26, 0x1A, 0xBB, 0xC9, 0x9B, 0x55, 0x55, 0xC4, 0x2E, 0x5A, 0xE1,
+    0x31, 0xEE, 0xCE, 0x44, 0xAB, 0x25, 0xAD, 0xA8, 0x8C, 0x90, 0x48, 0x25, 0x6C, 0x18, 0xCF, 0x65,
+    0x88, 0x49, 0xE3, 0xD3, 0xE2, 0xD2, 0x6B, 0x66, 0x7E, 0x53, 0xB4, 0xF5, 0xB2, 0x0F, 0xCB, 0xDF,
+    0x9A, 0xEC, 0xC8, 0xB3, 0x08, 0x80, 0x02, 0x38, 0x78, 0xEF, 0x50, 0xFA, 0x9A, 0xD4, 0x29, 0xF0,
+    0x79, 0x51, 0x9E, 0xF1, 0xE1, 0xF6, 0x9A, 0x99, 0x0D, 0x5A, 0xC6, 0x3E, 0x7C, 0x58, 0x6E, 0x4F,
+    0x63, 0x8D, 0xE1, 0x65, 0x98, 0x92, 0xFA, 0xAD, 0x75, 0x0B, 0x37, 0x4D, 0x52, 0xAA, 0xD6, 0xCF,
+    0x52, 0xB3, 0x8A, 0xD7, 0xC7, 0xBA, 0xFD, 0xFA, 0x19, 0x9D, 0x78, 0xB4, 0xA0, 0xEC, 0x25, 0xEB,
+    0x60, 0xE4, 0xFE, 0x01, 0x00, 0xCA, 0x3D, 0xAC, 0x22, 0x22, 0xBF, 0xD7, 0x91, 0xE7, 0x8B, 0xEC,
+    0x6B, 0x80, 0x77, 0xB1, 0x33, 0x9E, 0x55, 0x7B, 0x2D, 0x04, 0xC8, 0xA7, 0x00, 0x0F, 0x22, 0x86,
+    0x65, 0xA3, 0x4D, 0x63, 0xDA, 0xEC, 0x66, 0x5E, 0x86, 0x2C, 0x39, 0xF5, 0x63, 0x16, 0xFE, 0x22,
+    0x4E, 0x02, 0x9A, 0x25, 0x89, 0xC2, 0xF4, 0xE7, 0x56, 0x9B, 0x66, 0x7B, 0x4C, 0x6E, 0x91, 0xF3,
+    0xB1, 0x08, 0x08, 0x5E, 0x02, 0x42, 0x0A, 0xC9, 0xCD, 0x90, 0xEC, 0x44, 0x1C, 0x06, 0xB4, 0x0B,
+    0x09, 0x39, 0x9A, 0x90, 0xA5, 0x8A, 0x3C, 0x95, 0xF8, 0x16, 0x3C, 0x24, 0x26, 0x65, 0xB5, 0x69,
+    0xE5, 0xC1, 0x06, 0x83, 0x47, 0x2D, 0x4E, 0xDA, 0x45, 0xE7, 0xD9, 0xBD, 0xBC, 0x2D, 0xC4, 0xFA,
+    0xD4, 0xB8, 0x95, 0x1D, 0xAD, 0xDE, 0xAD, 0x61, 0x9E, 0x11, 0xAE, 0x3D, 0xB9, 0x2C, 0xCF, 0xF4,
+    0x22, 0xB9, 0x69, 0xDD, 0x10, 0xB0, 0x6F, 0x95, 0x8E, 0x42, 0xC0, 0x95, 0x33, 0xD1, 0x75, 0x90,
+    0xE7, 0xBA, 0x00, 0x02, 0x38, 0xB1, 0x9F, 0x05, 0x31, 0xB3, 0x7E, 0x1F, 0x49, 0x7F, 0x00, 0x3E,
+    0x42, 0xB0, 0x11, 0x81, 0x8B, 0x41, 0x1F, 0xAD, 0xB6, 0xF2, 0x21, 0x03, 0x5F, 0x99, 0x99, 0x58,
+    0x50, 0x6B, 0x95, 0xAA, 0xEC, 0x8C, 0x82, 0x8D, 0x9F, 0x88, 0x28, 0xD7, 0xF2, 0x88, 0x9F, 0xD0,
+    0xFA, 0x63, 0xEB, 0xFF, 0xD2, 0x6E, 0x08, 0x7A, 0xE7, 0x13, 0xF6, 0xFE, 0x6E, 0x70, 0x4C, 0x0D,
+    0x46, 0x2D, 0x61, 0xD9, 0x17, 0x4A, 0x8B, 0x23, 0x81, 0x0D, 0xD7, 0xF8, 0xC1, 0xD9, 0x75, 0x62,
+    0x26, 0x01, 0x63, 0x7A, 0xF5, 0x29, 0x1F, 0x7D, 0xD2, 0x98, 0x8D, 0x75, 0xF3, 0x0B, 0x0B, 0x3B,
+    0xC7, 0x7D, 0x0B, 0x19, 0x3E, 0x66, 0x5C, 0xEB, 0x5C, 0xF0, 0xCD, 0x76, 0xF5, 0x8B, 0x63, 0x52,
+    0x84, 0x4E, 0x89, 0x8E, 0x51, 0xA4, 0x4E, 0x89, 0x46, 0x47, 0x15, 0x89, 0x1C, 0x4E, 0xF1, 0xF8,
+    0xD4, 0x54, 0x03, 0x34, 0xC7, 0x0F, 0xE8, 0xA1, 0x11, 0x28, 0x94, 0x16, 0x1D, 0xA5, 0x3B, 0x03,
+    0x0D, 0x7C, 0x65, 0x17, 0xF8, 0xCA, 0xF9, 0x33, 0x9F, 0xF9, 0x23, 0x1E, 0x70, 0xDF, 0x25, 0x31,
+    0x36, 0x0D, 0xFC, 0xFB, 0x98, 0xC3, 0xFF, 0x0D, 0xAB, 0x24, 0x71, 0x45, 0x82, 0x13, 0x51, 0x6D,
+    0xEB, 0x1C, 0x25, 0x60, 0x8E, 0xC8, 0x52, 0x62, 0x8A, 0x07, 0x2A, 0x8E, 0xFE, 0x67, 0xD0, 0xCB,
+    0x50, 0x85, 0x96, 0x2F, 0xC6, 0xC6, 0x0F, 0x79, 0xCB, 0xF9, 0x02, 0xFF, 0x4C, 0xA0, 0x21, 0xF0,
+    0x18, 0x50, 0xDF, 0x21, 0x30, 0x60, 0x56, 0x24, 0x55, 0xCE, 0x9F, 0xE0, 0xD3, 0xEE, 0x66, 0xCA,
+    0x95, 0xFF, 0x17, 0x68, 0xF3, 0x0F, 0x59, 0xDB, 0xAE, 0x94, 0xA3, 0x50, 0x3D, 0x36, 0x75, 0x25,
+    0x98, 0x87, 0x98, 0x51, 0x2B, 0x8B, 0xD2, 0xD8, 0x05, 0x25, 0x7C, 0x73, 0x71, 0xEE, 0xF0, 0xFF,
+    0x98, 0x7B, 0x8D, 0xEA, 0xE0, 0x70, 0x57, 0x51, 0xF6, 0x17, 0xBA, 0xF8, 0xA3, 0xB7, 0x1E, 0x8F,
+    0x66, 0xFE, 0x22, 0x4D, 0xE6, 0x90, 0xCB, 0x69, 0x2A, 0x07, 0x7D, 0xD8, 0xE3, 0x93, 0xCC, 0xE6,
+    0xE2, 0x79, 0x3C, 0x11, 0x2E, 0xB8, 0xE5, 0xE4, 0x11, 0x0C, 0x94, 0x7A, 0xF7, 0x23, 0x16, 0xF6,
+    0x71, 0x19, 0x13, 0xA3, 0xF8, 0xA0, 0xC8, 0x47, 0xD2, 0xAE, 0x96, 0x69, 0x77, 0xB1, 0x86, 0x7B,
+    0xD4, 0x3E, 0x9A, 0x59, 0x86, 0x1D, 0xF9, 0x64, 0x1E, 0xB2, 0x58, 0x3D, 0xDB, 0x4A, 0xDD, 0xFC,
+    0xE0, 0x03, 0x6C, 0x35, 0x76, 0xE8, 0x73, 0x26, 0xC2, 0x4C, 0x70, 0xCB, 0x04, 0x37, 0x54, 0x98,
+    0x13, 0x1B, 0xD7, 0x2A, 0x3F, 0xF5, 0xA1, 0xB7, 0xC0, 0xC3, 0xD5, 0x0B, 0xFE, 0x92, 0x66, 0x0E,
+    0x77, 0x45, 0xB4, 0xF5, 0x48, 0x8E, 0x92, 0xCD, 0xA3, 0x86, 0xB6, 0x98, 0x97, 0x85, 0x1F, 0xA2,
+    0x93, 0x9A, 0x2B, 0x38, 0x66, 0xAB, 0x9D, 0x28, 0xDD, 0x0B, 0x5E, 0x16, 0xF9, 0x78, 0xA5, 0x97,
+    0x4F, 0x92, 0xEE, 0x49, 0x2B, 0xBC, 0xE9, 0xFC, 0xAB, 0x70, 0xFE, 0x52, 0x38, 0x6F, 0xEE, 0x9C,
+    0xB4, 0xC2, 0xC7, 0xED, 0xFF, 0x49, 0x6B, 0xB2, 0x14, 0xDF, 0x6B, 0x62, 0xBD, 0x8F, 0xE9, 0x68,
+    0x6A, 0xF0, 0xFF, 0x10, 0xF8, 0xC6, 0xC0, 0xF7, 0xC9, 0x07, 0xF1, 0xBD, 0xBA, 0x85, 0xE0, 0xA6,
+    0xD1, 0xEB, 0x24, 0xC6, 0xEE, 0x61, 0x26, 0x24, 0x97, 0xE2, 0x96, 0x32, 0xCC, 0x65, 0x9A, 0xC9,
+    0xA5, 0x4E, 0x89, 0x1E, 0x64, 0xAC, 0x6B, 0x75, 0x64, 0x5D, 0x0A, 0x43, 0xAE, 0xAC, 0x23, 0xF5,
+    0xE1, 0x11, 0x7D, 0xF4, 0x94, 0xB7, 0x37, 0x3A, 0xA4, 0xD0, 0x80, 0xF7, 0x61, 0x43, 0xEC, 0x7F,
+    0x23, 0x72, 0x74, 0xB0, 0x0B, 0x4B, 0xE7, 0x4D, 0xEC, 0x54, 0x27, 0x2F, 0xAD, 0xC2, 0xCD, 0x26,
+    0x76, 0xE1, 0x65, 0x08, 0x2C, 0xFD, 0x34, 0x72, 0x72, 0x78, 0x07, 0x38, 0x0C, 0xF1, 0x5F, 0xC8,
+    0xE0, 0x29, 0x7E, 0x92, 0x86, 0xE2, 0xBE, 0x91, 0x46, 0xE2, 0xBC, 0x1B, 0x0F, 0xC8, 0x60, 0x02,
+    0xD3, 0x4A, 0x7A, 0x87, 0x8C, 0x9A, 0x59, 0xE8, 0x90, 0x2B, 0x46, 0x24, 0x5C, 0x62, 0xC2, 0x7E,
+    0x7E, 0x9E, 0xD3, 0xDC, 0x80, 0x48, 0xFE, 0xC9, 0xD0, 0xFC, 0xAF, 0x0C, 0x60, 0xF7, 0x10, 0x9A,
+    0x8F, 0x58, 0xA8, 0x85, 0x59, 0xAC, 0xA1, 0xDD, 0xF5, 0x62, 0x68, 0x1E, 0xC4, 0xDA, 0xFA, 0x9A,
+    0x0D, 0xC5, 0xE5, 0x85, 0x20, 0x16, 0xBF, 0x3D, 0x43, 0x10, 0x47, 0x13, 0xB8, 0xB8, 0x4B, 0xE0,
+    0x36, 0x64, 0xB1, 0xFD, 0xF9, 0xB8, 0x78, 0xFA, 0x9A, 0x72, 0xAB, 0x50, 0xD7, 0x5B, 0xDB, 0x1D,
+    0x1B, 0x2A, 0xD8, 0x3A, 0x2C, 0x3A, 0x69, 0xD5, 0x49, 0xCB, 0x4E, 0xC6, 0xE3, 0x76, 0x81, 0xE6,
+    0xD9, 0x89, 0xC3, 0x82, 0x31, 0xD2, 0xCE, 0xD9, 0x3F, 0x41, 0x7F, 0x9A, 0x9B, 0xC2, 0xD0, 0xFA,
+    0x52, 0x64, 0xA0, 0x6E, 0xDD, 0x9D, 0x75, 0xDA, 0x3B, 0xCF, 0x4E, 0x07, 0x9F, 0xF1, 0x2A, 0xB9,
+    0x3E, 0x40, 0x90, 0xB5, 0x1A, 0xED, 0x8F, 0x63, 0x19, 0xB3, 0x34, 0x3F, 0xA5, 0xF6, 0x1F, 0x52,
+    0xFF, 0x6B, 0x0E, 0x15, 0x6E, 0x85, 0x35, 0x18, 0xD2, 0x18, 0x44, 0x54, 0xB8, 0x11, 0x6D, 0xC2,
+    0x84, 0xA6, 0xB2, 0x36, 0x03, 0xC9, 0x0B, 0xE9, 0x3F, 0xBA, 0xB4, 0x32, 0x04, 0x4D, 0x0F, 0x49,
+    0x2B, 0xE8, 0xA5, 0xE5, 0xCD, 0xA5, 0x75, 0xB7, 0x93, 0x96, 0xCC, 0xA5, 0x35, 0xEA, 0xBA, 0x1F,
+    0x6A, 0x15, 0x58, 0xC7, 0xD5, 0xF2, 0x90, 0x03, 0x72, 0x62, 0x7D, 0x4B, 0xE5, 0x95, 0x1B, 0x79,
+    0x99, 0xF4, 0xD4, 0xFE, 0xB0, 0xE9, 0xE9, 0x11, 0x73, 0x0C, 0x49, 0x5D, 0xD8, 0x36, 0x31, 0x98,
+    0xB6, 0x83, 0xA6, 0x0C, 0xCE, 0xD8, 0x0B, 0x91, 0xAD, 0x2B, 0xAD, 0x92, 0xD8, 0x6C, 0x5E, 0x68,
+    0x7F, 0xA4, 0xF9, 0xE2, 0x34, 0x75, 0x28, 0x0D, 0x0F, 0xCE, 0x64, 0x86, 0x69, 0xB0, 0x1A, 0xB1,
+    0x76, 0x97, 0x4D, 0x40, 0x62, 0x17, 0x7B, 0x1C, 0xD8, 0xAE, 0x29, 0xEA, 0x76, 0x70, 0x67, 0x35,
+    0x83, 0x4E, 0xCE, 0x9F, 0x31, 0x16, 0x49, 0xB7, 0x69, 0x61, 0x86, 0xB1, 0x75, 0x20, 0xC1, 0x0C,
+    0x0B, 0x84, 0x8C, 0x37, 0x6F, 0xC9, 0xAA, 0xA9, 0x09, 0x81, 0xD3, 0x24, 0x6D, 0x6D, 0x71, 0xF4,
+    0x4E, 0x5B, 0x1C, 0xBD, 0x96, 0x79, 0xB9, 0x3B, 0x0B, 0x52, 0x6A, 0x80, 0x5D, 0x44, 0xB8, 0x46,
+    0xB8, 0x12, 0x13, 0x14, 0xCC, 0xB8, 0x64, 0x09, 0x48, 0x6C, 0x63, 0x55, 0x87, 0xF1, 0x6D, 0x84,
+    0xB8, 0x15, 0x18, 0xEF, 0x7C, 0xD7, 0x8E, 0xCD, 0x7D, 0xE1, 0x77, 0xF8, 0x86, 0x47, 0xAA, 0x7E,
+    0x67, 0x8B, 0xEF, 0x19, 0x24, 0x7D, 0x1B, 0x76, 0xA6, 0x38, 0x17, 0x93, 0xBE, 0xA5, 0xE0, 0x94,
+    0xCD, 0x35, 0x7A, 0x45, 0x76, 0x88, 0x7F, 0x84, 0xD5, 0x7C, 0x9E, 0xC9, 0xD5, 0x75, 0x9E, 0x19,
+    0x58, 0x5D, 0x3D, 0x17, 0xB0, 0xB2, 0xC6, 0x18, 0xA4, 0x62, 0x29, 0xA2, 0x00, 0x53, 0xEE, 0x6F,
+    0xC1, 0xD4, 0xA7, 0x11, 0x99, 0xC8, 0x85, 0x3E, 0xC8, 0x27, 0x6E, 0x02, 0x57, 0xE4, 0x42, 0xE8,
+    0x12, 0x98, 0x8E, 0x97, 0x6E, 0x49, 0x9B, 0x5B, 0x12, 0x43, 0x62, 0x1A, 0x72, 0xDD, 0xE6, 0xA4,
+    0x08, 0x84, 0x32, 0x10, 0x0A, 0x41, 0xA5, 0xB0, 0x28, 0x86, 0x1E, 0x6C, 0x43, 0x0F, 0x19, 0x9A,
+    0xB7, 0x26, 0x1E, 0x6F, 0x6D, 0xB1, 0x7D, 0x4E, 0xEF, 0xEB, 0xCD, 0x74, 0xA3, 0x69, 0xF3, 0x8C,
+    0x3D, 0x4B, 0x7D, 0x1B, 0x1A, 0x2F, 0xBC, 0x6D, 0x32, 0x87, 0x3D, 0x36, 0x68, 0x49, 0xCF, 0xE6,
+    0x1B, 0xC2, 0xC8, 0x7B, 0x5B, 0xB4, 0x1A, 0x1A, 0x32, 0xD7, 0x26, 0x2E, 0xAA, 0x4D, 0x16, 0x61,
+    0x5A, 0x8E, 0x78, 0xCE, 0xF8, 0xCF, 0xD8, 0x24, 0x14, 0x33, 0xBA, 0x69, 0xAD, 0xE8, 0x34, 0x0A,
+    0x51, 0xDF, 0x5A, 0xAD, 0x83, 0xAC, 0xAE, 0xC1, 0x23, 0x37, 0x5F, 0x6E, 0x2A, 0xE0, 0x7E, 0xE3,
+    0xAF, 0xB5, 0x97, 0xC3, 0x4F, 0x0F, 0xB0, 0x67, 0x6B, 0x19, 0x00, 0x7A, 0x25, 0x13, 0x62, 0x77,
+    0xCB, 0x11, 0xA9, 0x63, 0xC5, 0x1D, 0x2C, 0xD9, 0x44, 0x3D, 0xE2, 0x44, 0x8D, 0x1D, 0xE2, 0xF7,
+    0x82, 0xB6, 0x22, 0x60, 0x0F, 0x34, 0xBE, 0x5D, 0x5B, 0x3B, 0x90, 0xC1, 0xB4, 0xC9, 0x21, 0x04,
+    0x96, 0x13, 0x3A, 0xBD, 0xC2, 0x1E, 0xB6, 0xAA, 0x63, 0x3D, 0x29, 0xDB, 0xBD, 0x53, 0x18, 0x96,
+    0x83, 0x97, 0x6A, 0x80, 0xDE, 0x83, 0x7D, 0x8B, 0x28, 0x70, 0x5E, 0x6C, 0x30, 0x02, 0x5E, 0xED,
+    0x66, 0x6E, 0xC9, 0x15, 0xF5, 0x9B, 0x03, 0xF1, 0x5F, 0x85, 0xAA, 0xC4, 0x48, 0x47, 0x40, 0x33,
+    0x84, 0xA0, 0x22, 0x0D, 0xB4, 0xFD, 0x94, 0xC9, 0x04, 0x78, 0xC9, 0x4D, 0x2A, 0xA1, 0x15, 0xB7,
+    0xCC, 0xD8, 0xDF, 0xA4, 0xCD, 0xBD, 0xE2, 0xCE, 0xCA, 0xC7, 0xB0, 0x5A, 0x62, 0xDD, 0xFF, 0x9B,
+    0xC0, 0x6A, 0x69, 0x43, 0xBD, 0x0B, 0xE1, 0xBA, 0x94, 0xFB, 0xA4, 0x30, 0xF1, 0x74, 0xF8, 0x5D,
+    0xC8, 0x7B, 0x12, 0xE3, 0x39, 0xED, 0xB6, 0xF7, 0x24, 0x97, 0x91, 0x28, 0x6F, 0x8C, 0x11, 0x31,
+    0xEC, 0xC3, 0x69, 0x80, 0xA9, 0xE9, 0x3C, 0x4C, 0xEB, 0x72, 0xFD, 0x93, 0x42, 0xD0, 0xEE, 0xA7,
+    0xB5, 0xB1, 0xEA, 0xF6, 0x5F, 0xEF, 0x56, 0xE5, 0x24, 0x6F, 0x78, 0x1A, 0x38, 0xD7, 0x40, 0xF6,
+    0x39, 0x1B, 0x79, 0xD2, 0x57, 0x11, 0x57, 0x1E, 0xB6, 0x47, 0x95, 0x36, 0x97, 0xB3, 0x2E, 0xAA,
+    0x63, 0xF4, 0x52, 0x6E, 0x7B, 0x36, 0x61, 0x30, 0x8F, 0x6F, 0xD8, 0x9D, 0x1A, 0x22, 0x76, 0x6E,
+    0xBE, 0xB8, 0xDB, 0x69, 0x61, 0x77, 0xF1, 0x09, 0x8B, 0x01, 0x09, 0x44, 0xAC, 0x1D, 0x2B, 0x12,
+    0xD7, 0x3E, 0xBD, 0xDF, 0x52, 0xEC, 0x28, 0x87, 0xE9, 0xCB, 0xD6, 0x54, 0x53, 0x84, 0x90, 0xCD,
+    0xAE, 0xCD, 0xEE, 0xDC, 0x0F, 0x65, 0x36, 0x32, 0x8B, 0xB1, 0x78, 0xEE, 0xE7, 0xDA, 0x1D, 0xEE,
+    0x18, 0xF1, 0xEE, 0x7C, 0x6F, 0xCE, 0x37, 0xCF, 0x31, 0x95, 0x1D, 0x09, 0x4E, 0x5D, 0xB4, 0x67,
+    0xB6, 0x4C, 0x4E, 0xB1, 0x03, 0x86, 0xB8, 0xC5, 0xC7, 0x4D, 0xBC, 0xD0, 0x7C, 0xE0, 0xFC, 0xF0,
+    0x43, 0x6C, 0x5C, 0xF9, 0x71, 0xD9, 0xB7, 0xAD, 0x4E, 0x0B, 0x13, 0xEB, 0xE6, 0x2C, 0x9B, 0xD3,
+    0x13, 0x0F, 0x06, 0xA6, 0x66, 0xDE, 0x95, 0x42, 0x96, 0x82, 0xE9, 0x94, 0x78, 0xBF, 0xDE, 0x2A,
+    0xF6, 0x5E, 0x1B, 0x85, 0xE2, 0x5A, 0xC1, 0x67, 0xEF, 0xCE, 0x12, 0xF8, 0xC6, 0xF4, 0xF0, 0x94,
+    0xA6, 0x97, 0x9D, 0x98, 0xE8, 0xF6, 0x29, 0x7C, 0x0E, 0x77, 0x16, 0x1B, 0xB8, 0xFF, 0x7A, 0xB8,
+    0x81, 0x7B, 0x5A, 0x6B, 0xC4, 0x3A, 0xF4, 0x75, 0xFC, 0xFE, 0x79, 0x1E, 0xE1, 0xAB, 0x5A, 0xDE,
+    0xE3, 0xA5, 0xAD, 0xD1, 0xB0, 0x69, 0x6A, 0x5E, 0xEB, 0x57, 0xDF, 0xB9, 0xD2, 0x4F, 0x12, 0xB4,
+    0x06, 0xE4, 0xB8, 0xF2, 0x4B, 0xFD, 0xC1, 0x69, 0xB1, 0x83, 0x29, 0xBC, 0xB6, 0xEC, 0xC7, 0x7B,
+    0x28, 0xD3, 0xEF, 0xE2, 0xF3, 0xED, 0x96, 0xED, 0x4F, 0xA9, 0x69, 0x9A, 0xC8, 0xCA, 0xE1, 0xCD,
+    0xB0, 0x29, 0x57, 0xEE, 0x6D, 0x1E, 0x53, 0xAC, 0xE8, 0x0B, 0x06, 0xFA, 0xF2, 0x91, 0x4F, 0x36,
+    0xB4, 0x93, 0x4E, 0xA6, 0x0A, 0x5B, 0xF2, 0xF5, 0xB9, 0x42, 0x86, 0xA9, 0xC9, 0x38, 0x36, 0xF0,
+    0x60, 0xF0, 0x70, 0x97, 0xFB, 0x34, 0xC0, 0x75, 0x75, 0x23, 0x2D, 0xF3, 0x7E, 0x1F, 0x59, 0x04,
+    0xC2, 0x5D, 0xB9, 0xF4, 0x9F, 0x1D, 0xF8, 0xC1, 0x4B, 0xEF, 0xC4, 0x0F, 0x57, 0x4C, 0xFA, 0x5A,
+    0x87, 0xE9, 0x9C, 0x0C, 0x91, 0x02, 0xD4, 0x74, 0x50, 0x8F, 0xC2, 0xDB, 0x67, 0xA7, 0x3F, 0xC7,
+    0x42, 0x1D, 0xC8, 0xFA, 0xC1, 0x95, 0x47, 0xE6, 0xED, 0x7F, 0x0B, 0x17, 0x11, 0xEE, 0xB8, 0x49,
+    0xFF, 0x97, 0x70, 0xD5, 0xD4, 0xAC, 0x42, 0x25, 0xEC, 0xC6, 0x45, 0x48, 0x76, 0x97, 0x8D, 0x06,
+    0x36, 0x1B, 0xFB, 0xD6, 0xB9, 0xCD, 0x32, 0xE0, 0x91, 0xC3, 0x47, 0x2C, 0xCA, 0x82, 0x2E, 0x8F,
+    0x63, 0x65, 0x5A, 0x7B, 0xE8, 0x8E, 0x63, 0x05, 0x71, 0xD8, 0x56, 0x00, 0xDB, 0x32, 0xE0, 0x88,
+    0x12, 0x48, 0xB8, 0xA1, 0x26, 0x7D, 0xAB, 0x4C, 0x0F, 0x39, 0xE9, 0x99, 0xA7, 0x61, 0x1A, 0x66,
+    0xEC, 0x70, 0xC6, 0xE0, 0xA3, 0xEA, 0xDA, 0xB0, 0x56, 0x7C, 0x41, 0xFC, 0x72, 0x43, 0xA2, 0xA6,
+    0x94, 0x2F, 0x04, 0x33, 0xB0, 0x66, 0xB8, 0xD8, 0x91, 0x6F, 0xB3, 0x46, 0x09, 0xF2, 0xCC, 0x3A,
+    0xE6, 0x6D, 0xA3, 0x58, 0x33, 0x8E, 0x3E, 0x43, 0x1B, 0xE8, 0x01, 0x56, 0x73, 0xD8, 0x74, 0xDB,
+    0xBE, 0x1B, 0x0F, 0x9B, 0x57, 0xC4, 0xEF, 0x0E, 0xCF, 0x5A, 0xAC, 0xAD, 0x38, 0x1C, 0xAC, 0x2E,
+    0xE3, 0x38, 0x63, 0x74, 0x3E, 0xB6, 0x60, 0x80, 0xAB, 0xED, 0xE2, 0x2C, 0x07, 0x55, 0xFA, 0x51,
+    0xC6, 0x12, 0xCF, 0xB5, 0xF8, 0x64, 0x5A, 0x2C, 0x9C, 0x2D, 0x3C, 0x63, 0x7C, 0x3C, 0xFA, 0xFC,
+    0x71, 0xC4, 0x36, 0x3C, 0xDD, 0xED, 0xB0, 0x49, 0xBB, 0xBA, 0xBC, 0xD5, 0x93, 0x4B, 0x8C, 0x75,
+    0xB6, 0x89, 0xAE, 0x78, 0x19, 0xC3, 0xEC, 0xF3, 0x74, 0x07, 0xAF, 0x71, 0xBF, 0xE7, 0x32, 0x77,
+    0xCA, 0x67, 0x8C, 0x58, 0x7E, 0x25, 0xCC, 0xAD, 0xC5, 0xFD, 0x32, 0x68, 0xC0, 0x83, 0x38, 0x3F,
+    0x4E, 0x99, 0x66, 0x2F, 0x17, 0xB9, 0x15, 0xC3, 0xB0, 0x79, 0xBF, 0x03, 0xF4, 0x80, 0xFB, 0x7D,
+    0x83, 0xCE, 0xAF, 0x60, 0x98, 0x17, 0x9F, 0xCF, 0x26, 0x95, 0x75, 0x46, 0x45, 0x23, 0x9A, 0xAD,
+    0x6A, 0x40, 0xEA, 0x30, 0x4E, 0xDE, 0x97, 0xF2, 0x85, 0x5C, 0x8B, 0xB8, 0x4D, 0x53, 0x81, 0xC8,
+    0x69, 0xDA, 0x79, 0xBA, 0x10, 0x06, 0x8C, 0xE0, 0xCD, 0xC1, 0xF3, 0x50, 0x8D, 0x13, 0x6F, 0xD2,
+    0xF2, 0x12, 0x25, 0xC0, 0xC0, 0x32, 0x35, 0x67, 0x28, 0x29, 0x04, 0xA1, 0x14, 0x8C, 0x18, 0x54,
+    0x0E, 0x67, 0x87, 0x52, 0x3B, 0x34, 0x1B, 0x5D, 0x5F, 0x47, 0xCB, 0x5C, 0xEC, 0xEB, 0x99, 0xD0,
+    0x5C, 0x65, 0xF0, 0xF8, 0x0B, 0x7B, 0xE2, 0xE9, 0x77, 0xE3, 0xC8, 0x6C, 0x53, 0xA7, 0xD6, 0x6A,
+    0x5A, 0x77, 0x70, 0x55, 0x76, 0x5D, 0x93, 0x73, 0xCD, 0xDB, 0x25, 0xB2, 0x4B, 0x51, 0xB2, 0x2B,
+    0xE1, 0x51, 0xA2, 0x35, 0xCB, 0x2B, 0x3C, 0xF6, 0x11, 0x16, 0x8A, 0x34, 0x2A, 0x14, 0xEB, 0x5E,
+    0xA1, 0xFD, 0xBA, 0x7B, 0x94, 0xE0, 0xC4, 0x2A, 0x0A, 0x10, 0x9D, 0x38, 0x79, 0x01, 0xB1, 0x25,
+    0x6E, 0x56, 0xB0, 0xCD, 0xE7, 0xA7, 0x05, 0xA4, 0x96, 0x04, 0xC2, 0x3F, 0x1E, 0x48, 0x22, 0x61,
+    0x42, 0x9E, 0x6C, 0x48, 0x09, 0x19, 0x24, 0xBB, 0x78, 0x10, 0x22, 0x29, 0xE4, 0x3E, 0x78, 0x1E,
+    0xE0, 0x2D, 0xD3, 0x7D, 0xC7, 0xFC, 0x6F, 0x98, 0xA9, 0x58, 0x10, 0xC4, 0xDE, 0x36, 0x89, 0xED,
+    0xDE, 0xBC, 0xCA, 0x6B, 0x2A, 0x3D, 0xE6, 0xD0, 0xB3, 0x9E, 0x69, 0x37, 0xC9, 0xC8, 0xE2, 0xE1,
+    0x88, 0xCB, 0xF2, 0x94, 0xAC, 0x40, 0x3E, 0xCC, 0x65, 0x79, 0xB0, 0x34, 0xC0, 0x42, 0xBD, 0x1F,
+    0x0F, 0x65, 0x60, 0xFF, 0x23, 0x1E, 0xC9, 0xC0, 0xF9, 0x43, 0x8C, 0x3C, 0xD5, 0xFD, 0x43, 0x5A,
+    0x22, 0x67, 0x7D, 0xE1, 0x87, 0x85, 0x0C, 0x02, 0xEF, 0x47, 0x39, 0xE2, 0x56, 0xF7, 0x27, 0x50,
+    0x9A, 0xC4, 0x7D, 0x25, 0x95, 0xC1, 0xEB, 0xEE, 0x4F, 0xC9, 0x94, 0xFB, 0x0B, 0x50, 0x9A, 0xB9,
+    0x3C, 0x22, 0x9A, 0x31, 0xEF, 0x08, 0x53, 0x2D, 0xD8, 0xE9, 0xE9, 0xEE, 0xDA, 0x88, 0x91, 0x32,
+    0xDC, 0xF5, 0xD2, 0x4E, 0x7A, 0x60, 0x05, 0xC9, 0xAF, 0x55, 0xB1, 0xDF, 0x13, 0xF0, 0x74, 0x71,
+    0xCC, 0x13, 0x71, 0x43, 0xFD, 0xAB, 0x05, 0x37, 0xAB, 0xC4, 0x79, 0x0B, 0x2E, 0xF4, 0x1F, 0x3C,
+    0x93, 0x12, 0xB3, 0xCA, 0x78, 0xBC, 0x37, 0x9E, 0x1D, 0x4D, 0x61, 0x1E, 0xE5, 0x28, 0xFF, 0xB7,
+    0xC5, 0xBE, 0x61, 0xBA, 0x6E, 0xDA, 0x21, 0xD3, 0x2E, 0x6B, 0xDB, 0x35, 0x4B, 0xA8, 0xB2, 0x64,
+    0x9E, 0x73, 0x07, 0x9C, 0xD8, 0xD7, 0x30, 0x51, 0xA3, 0xBC, 0x6B, 0x9C, 0x98, 0x51, 0x8B, 0xA7,
+    0x87, 0xC4, 0xCB, 0xEE, 0xFC, 0x8B, 0x76, 0x19, 0x35, 0x17, 0x0C, 0xBB, 0x13, 0xE0, 0x56, 0xEF,
+    0x0B, 0xA6, 0xAA, 0x2F, 0x24, 0x1D, 0x61, 0xA6, 0x08, 0xF4, 0x9E, 0xB0, 0x17, 0xF3, 0xD1, 0x53,
+    0x90, 0x40, 0x7B, 0x22, 0x4F, 0xDA, 0x60, 0x5D, 0x93, 0x73, 0x3D, 0x3E, 0xD4, 0xD7, 0x62, 0xC2,
+    0x46, 0x03, 0x67, 0xF8, 0x89, 0xCF, 0xDE, 0xFA, 0x65, 0x66, 0xEA, 0x22, 0x0B, 0x8C, 0x3B, 0xFD,
+    0x51, 0xA7, 0xFE, 0x7B, 0x99, 0x7F, 0x9F, 0x1F, 0xFF, 0xBD, 0xA7, 0xDF, 0xBF, 0xBA, 0xB5, 0xC9,
+    0x89, 0x0B, 0x33, 0x2C, 0x64, 0x3B, 0x6D, 0xB1, 0x60, 0x77, 0x9E, 0x90, 0x7E, 0xE7, 0xD6, 0x8E,
+    0x46, 0xC5, 0x5B, 0x57, 0xF3, 0xF9, 0x1F, 0x77, 0x74, 0xDD, 0x80, 0xDC, 0x98, 0x81, 0xE8, 0x68,
+    0x83, 0x20, 0xD0, 0xE0, 0xB9, 0xD6, 0x60, 0xFD, 0x03, 0x4E, 0xB1, 0x9D, 0x1D, 0xC4, 0xB5, 0x36,
+    0x96, 0xDD, 0xD3, 0xED, 0xD4, 0xFF, 0x3C, 0x36, 0xBC, 0xE3, 0x4E, 0xF2, 0x7B, 0x47, 0x3A, 0x35,
+    0x67, 0x86, 0x91, 0x07, 0x07, 0x98, 0x1B, 0x3B, 0xBF, 0xCF, 0x55, 0x17, 0xE5, 0xA0, 0x6D, 0xDE,
+    0x2C, 0x65, 0x19, 0xD7, 0xA4, 0xFD, 0x6B, 0xB1, 0xA0, 0xE9, 0xF4, 0x76, 0xDE, 0xA0, 0x9E, 0x7C,
+    0x60, 0x93, 0xDF, 0x79, 0xA0, 0xC9, 0x7F, 0xB4, 0xD3, 0x1F, 0x3C, 0xDA, 0x11, 0x02, 0xDD, 0xC8,
+    0xAC, 0xD0, 0x98, 0x9E, 0xFC, 0x7F, 0x01, 0xD5, 0x5A, 0x3F, 0x90, 0xDC, 0x56, 0x19, 0xFF, 0xB4,
+    0xF2, 0x9D, 0xC0, 0x1A, 0x90, 0x99, 0xB1, 0x99, 0x24, 0x97, 0xA0, 0x86, 0x22, 0x64, 0x62, 0xAB,
+    0xA5, 0xB8, 0x95, 0xE4, 0xA4, 0x48, 0x91, 0x22, 0x57, 0xF8, 0x86, 0x22, 0x85, 0x29, 0x13, 0xCF,
+    0x80, 0x9B, 0x14, 0xC9, 0xCC, 0xDE, 0xAD, 0x08, 0x05, 0x05, 0x05, 0xA6, 0xA0, 0xB6, 0x8B, 0x14,
+    0x99, 0x73, 0x61, 0x0A, 0x17, 0xC7, 0xB0, 0xE7, 0x55, 0xA0, 0xA0, 0xA0, 0x40, 0x19, 0xE2, 0x49,
+    0x41, 0x11, 0x05, 0x0E, 0x32, 0x13, 0x0A, 0x2B, 0xB0, 0x19, 0xCB, 0x66, 0xF7, 0xC4, 0xEF, 0xF7,
+    0xBD, 0xA7, 0x5D, 0xDD, 0xC5, 0x97, 0x21, 0x93, 0xF3, 0xC5, 0xAC, 0x6F, 0x9F, 0xF6, 0xCE, 0xD2,
+    0x7B, 0xDF, 0xF7, 0xBD, 0xEF, 0xCF, 0xEF, 0xFB, 0xBD, 0x15, 0x69, 0x5F, 0xBD, 0x4A, 0x7A, 0x4D,
+    0xE9, 0x56, 0x12, 0x35, 0x7B, 0x5E, 0x21, 0xCD, 0xF9, 0xF1, 0xD5, 0xCC, 0xAD, 0x25, 0x98, 0x89,
+    0x5F, 0x8A, 0x57, 0x4A, 0x90, 0x0B, 0xFF, 0x33, 0xE5, 0x98, 0xE8, 0xED, 0x9B, 0x3A, 0xEE, 0xE8,
+    0x38, 0x12, 0xFE, 0x7D, 0xDA, 0x8E, 0xB8, 0x1F, 0xA3, 0x5F, 0x70, 0xC4, 0x83, 0xF8, 0xDF, 0x28,
+    0xE3, 0xFD, 0x78, 0x30, 0x49, 0x9D, 0x99, 0x48, 0x58, 0xFA, 0x35, 0x6E, 0x68, 0x9A, 0x02, 0x4B,
+    0x8F, 0xF7, 0x28, 0x80, 0x93, 0xCA, 0xE2, 0xD5, 0x9B, 0x88, 0xCE, 0xB5, 0xB2, 0x8B, 0xA9, 0xC6,
+    0xCD, 0x4B, 0xB9, 0x7B, 0xEF, 0xF2, 0x1E, 0x26, 0xF4, 0x2A, 0x09, 0x33, 0xCA, 0xC1, 0x45, 0x63,
+    0x0E, 0x1B, 0x1C, 0x06, 0xBC, 0x77, 0x24, 0x6E, 0x89, 0x01, 0xC2, 0x0F, 0xB8, 0xE8, 0xA6, 0x84,
+    0x29, 0x56, 0xBB, 0x05, 0x09, 0x1A, 0xAC, 0xD5, 0xD3, 0xA5, 0x0E, 0xBC, 0x46, 0xBD, 0x12, 0x8F,
+    0x4F, 0xF1, 0x9C, 0xFB, 0xC9, 0xC4, 0x2D, 0xC4, 0xFD, 0xA8, 0xF4, 0xA0, 0x67, 0x93, 0xFA, 0xB9,
+    0x78, 0xBB, 0x9C, 0x05, 0x1F, 0x82, 0x4C, 0x7F, 0x52, 0x8E, 0xA1, 0x70, 0xD6, 0x48, 0xF8, 0x13,
+    0xB7, 0x23, 0x7E, 0x36, 0x44, 0xFA, 0x82, 0x75, 0xF9, 0x33, 0x6A, 0x7F, 0x6A, 0x8E, 0x0E, 0x34,
+    0xD9, 0xA4, 0x78, 0x92, 0x64, 0x11, 0x44, 0x08, 0x9B, 0x26, 0xA5, 0x34, 0x35, 0xD7, 0x5F, 0xDA,
+    0x2F, 0x4E, 0xA8, 0x26, 0x80, 0x6E, 0x57, 0xE4, 0x95, 0x98, 0x8A, 0x8C, 0xA6, 0x02, 0x79, 0x9A,
+    0x92, 0x62, 0xC0, 0x48, 0x41, 0xE6, 0x60, 0x9E, 0x20, 0x85, 0xC6, 0xB8, 0x17, 0x52, 0xE3, 0x5E,
+    0x8E, 0x09, 0xEF, 0x85, 0x18, 0xB8, 0x0B, 0x62, 0x40, 0x6A, 0xC8, 0x03, 0x83, 0x43, 0x98, 0x21,
+    0x66, 0xDC, 0xEC, 0xDD, 0xC1, 0x98, 0x34, 0xBF, 0xC0, 0xDC, 0xC1, 0x2C, 0xE4, 0x12, 0x1D, 0x53,
+    0x9F, 0x90, 0x53, 0xE6, 0x43, 0xC0, 0xB9, 0xF9, 0xF2, 0xFE, 0x98, 0x9B, 0x0F, 0x6E, 0x63, 0xEF,
+    0x71, 0xA6, 0xED, 0xDD, 0x6B, 0x1D, 0x69, 0x87, 0x7B, 0x70, 0x86, 0xA6, 0x99, 0x62, 0x7F, 0x6A,
+    0xF1, 0xF8, 0x61, 0xF6, 0xF2, 0x9E, 0x2C, 0x6F, 0x5D, 0xAF, 0xA1, 0x39, 0x17, 0xF6, 0x2A, 0x28,
+    0x4F, 0x69, 0x82, 0x1C, 0x12, 0x53, 0xB8, 0x84, 0x9B, 0x45, 0x59, 0x77, 0x28, 0x37, 0x7E, 0x9C,
+    0x5A, 0x68, 0xF6, 0x92, 0x06, 0xA2, 0xE5, 0x4B, 0x6B, 0x73, 0xDC, 0x93, 0xA4, 0xFA, 0xB9, 0xA0,
+    0x87, 0xD1, 0xFE, 0x39, 0xEE, 0x35, 0xBB, 0x40, 0x63, 0x42, 0x8D, 0x28, 0xE5, 0xDC, 0xD8, 0x82,
+    0x21, 0xDD, 0x12, 0xEA, 0x43, 0x4C, 0xEC, 0x36, 0xED, 0x30, 0xE1, 0xBD, 0xB2, 0xB9, 0x3E, 0x2E,
+    0xDC, 0x4F, 0xD7, 0x2F, 0xC8, 0xB0, 0xD9, 0xA3, 0xAF, 0xCD, 0x20, 0xE9, 0x15, 0x7E, 0x68, 0xD5,
+    0x49, 0x1D, 0xAB, 0x5F, 0x79, 0xCE, 0xA8, 0x23, 0xDB, 0x78, 0x8E, 0xEA, 0x48, 0x02, 0xB3, 0x52,
+    0x1D, 0x89, 0x72, 0x31, 0xEA, 0x60, 0xAF, 0xAC, 0x3A, 0xEA, 0xF1, 0x7E, 0x7E, 0x72, 0xEB, 0x6D,
+    0xA3, 0x4E, 0x88, 0x09, 0x55, 0x9D, 0xA5, 0xF5, 0xCF, 0xA8, 0xE3, 0xB7, 0xEA, 0x44, 0xAD, 0x3A,
+    0x9B, 0x56, 0x1D, 0xF9, 0x1F, 0xD4, 0xD9, 0xB0, 0xEA, 0xC8, 0x5C, 0x1D, 0xEE, 0x91, 0x55, 0x27,
+    0x53, 0x75, 0x02, 0xF5, 0x27, 0xBE, 0x4E, 0xE9, 0xEE, 0x84, 0xE9, 0x2A, 0x0D, 0x8C, 0x19, 0xC3,
+    0xD0, 0x78, 0x93, 0xAF, 0xEA, 0xC6, 0xE2, 0x32, 0xA6, 0xE0, 0x1F, 0x26, 0xD0, 0x06, 0xFA, 0xCC,
+    0x4A, 0x39, 0xEA, 0x6D, 0x6D, 0xA5, 0x32, 0x9E, 0x8E, 0xB0, 0x95, 0xA9, 0x7B, 0xEF, 0x62, 0xED,
+    0xAC, 0x0F, 0x11, 0xF2, 0xDE, 0x84, 0x4E, 0x14, 0xE4, 0x58, 0x10, 0xB6, 0x8C, 0xA8, 0x90, 0x06,
+    0xBE, 0xD9, 0xA1, 0x98, 0xD7, 0x88, 0x77, 0x78, 0xBA, 0x3F, 0x23, 0x28, 0x49, 0x47, 0x1F, 0xF1,
+    0x89, 0x92, 0xD7, 0x28, 0xA3, 0x36, 0x74, 0x40, 0xC4, 0xBC, 0x24, 0x70, 0xC1, 0x11, 0x85, 0x81,
+    0x13, 0x36, 0x0D, 0x8C, 0x37, 0x0B, 0x1D, 0x5E, 0xE7, 0x8E, 0x08, 0x69, 0x3C, 0xCD, 0x13, 0xBE,
+    0xB1, 0x4B, 0x26, 0x13, 0x5A, 0x87, 0x73, 0x86, 0x34, 0xB2, 0x09, 0x78, 0xB3, 0x3E, 0x57, 0x2F,
+    0xA8, 0x88, 0xA7, 0x2B, 0xD0, 0xAF, 0x46, 0xBA, 0x2F, 0x53, 0x3E, 0x87, 0xC7, 0x61, 0x55, 0x3C,
+    0x08, 0xED, 0x1D, 0x26, 0x0A, 0x93, 0x29, 0xF8, 0xA0, 0x19, 0x37, 0xD7, 0x2F, 0x40, 0xE8, 0x61,
+    0x33, 0xC5, 0x83, 0xE3, 0x66, 0x6A, 0x36, 0x94, 0x0F, 0xB6, 0xF1, 0x37, 0xE4, 0x30, 0x9E, 0xE9,
+    0xA8, 0x26, 0x7B, 0xDC, 0x4A, 0xE9, 0xA8, 0x9C, 0xB8, 0x75, 0xA4, 0x23, 0xE4, 0x3C, 0x29, 0xA2,
+    0x77, 0x38, 0x13, 0xEB, 0x15, 0xF2, 0x3D, 0x1D, 0xFB, 0x2A, 0xE7, 0x40, 0xE5, 0x1C, 0xA9, 0x9C,
+    0xB5, 0xCA, 0x59, 0xAB, 0x9C, 0x13, 0x3E, 0x0D, 0xD9, 0x20, 0x27, 0x6E, 0x0E, 0xC5, 0x1A, 0x13,
+    0x37, 0x43, 0x42, 0xCF, 0x8C, 0x39, 0xE5, 0xC4, 0x23, 0x90, 0x33, 0xC8, 0x54, 0x4E, 0x15, 0x42,
+    0xB7, 0x94, 0x37, 0x8B, 0x26, 0x53, 0xDD, 0x4F, 0x6E, 0xBD, 0x6E, 0x71, 0xA4, 0x52, 0x44, 0x6D,
+    0x9E, 0x8B, 0xE4, 0x34, 0xA6, 0xDA, 0xC0, 0x7B, 0x07, 0xE3, 0x77, 0x75, 0xC7, 0xB9, 0x09, 0xB5,
+    0x73, 0x4D, 0x26, 0xBD, 0xCA, 0xA9, 0xDC, 0xAA, 0x57, 0xB9, 0x48, 0xF9, 0x6E, 0xE1, 0x22, 0xED,
+    0xB9, 0x85, 0x9F, 0x7B, 0x79, 0x90, 0xF9, 0x79, 0x90, 0x06, 0x59, 0xC8, 0x37, 0x0C, 0x12, 0x61,
+    0xC9, 0x18, 0x53, 0xF5, 0x31, 0x0E, 0x30, 0x8E, 0xDA, 0x49, 0x44, 0x55, 0xA7, 0xB2, 0x2F, 0x40,
+    0xD5, 0x06, 0x6A, 0x31, 0x8B, 0xC3, 0x61, 0xCF, 0xE1, 0xDF, 0x58, 0xF4, 0x81, 0x86, 0x97, 0xBE,
+    0xC0, 0x53, 0x07, 0x32, 0x70, 0xFE, 0xC3, 0x0D, 0x1E, 0xF5, 0xFE, 0x5D, 0xE0, 0xE1, 0xDA, 0xFD,
+    0x5B, 0x89, 0xE7, 0x6B, 0xF7, 0x5D, 0xC8, 0xE1, 0x20, 0xF5, 0x4E, 0x1C, 0x08, 0xE3, 0xE5, 0xA3,
+    0x1E, 0x2E, 0x7E, 0x3E, 0x80, 0x58, 0x65, 0x90, 0xC5, 0x90, 0xAC, 0x08, 0xD2, 0xC8, 0xCB, 0xBD,
+    0x22, 0x90, 0xE0, 0xC5, 0xDC, 0xCF, 0x43, 0x09, 0x7E, 0x0E, 0xD7, 0x8A, 0xC4, 0xFB, 0x53, 0x86,
+    0x1B, 0xC4, 0xFD, 0x20, 0x0D, 0xD2, 0x3E, 0xF2, 0x29, 0xE4, 0x1C, 0x88, 0xD3, 0x40, 0xD4, 0x11,
+    0x45, 0x49, 0x64, 0x9B, 0x59, 0x26, 0x36, 0xA6, 0xD8, 0x30, 0x17, 0x13, 0xF7, 0xBD, 0xDA, 0x24,
+    0xB7, 0xCA, 0x5C, 0x74, 0xFF, 0x9D, 0xB7, 0xDA, 0xAC, 0x76, 0xDA, 0xE8, 0xB0, 0x61, 0x74, 0xD8,
+    0x31, 0x3A, 0x3C, 0x6D, 0x74, 0x10, 0xA3, 0x83, 0x18, 0x1D, 0xAE, 0xA9, 0x0E, 0x30, 0x23, 0x75,
+    0x80, 0x25, 0xA9, 0x03, 0x0D, 0x39, 0xE2, 0x67, 0xD5, 0x81, 0xE6, 0x8C, 0xF9, 0x59, 0x75, 0xC0,
+    0x85, 0x3A, 0xD0, 0xAE, 0xD4, 0x21, 0x55, 0x1D, 0x68, 0x5D, 0xE8, 0x40, 0x03, 0x43, 0x87, 0xD8,
+    0xE8, 0x10, 0x1B, 0x1D, 0xFA, 0x46, 0x87, 0x81, 0xAD, 0x55, 0xE6, 0x52, 0x9B, 0xCB, 0xC4, 0x78,
+    0xA4, 0x49, 0xD9, 0x2F, 0x98, 0x8B, 0x51, 0x45, 0xF7, 0xC1, 0xBA, 0xEB, 0xC2, 0xB5, 0x51, 0x36,
+    0xF5, 0x72, 0xF2, 0x60, 0x09, 0xBC, 0x16, 0x95, 0x70, 0x5A, 0xF9, 0x04, 0x49, 0x0F, 0xA9, 0xE1,
+    0xEE, 0xDF, 0xA7, 0x58, 0x0F, 0x92, 0xEC, 0xB0, 0x9C, 0x32, 0x01, 0xD5, 0xA6, 0xB4, 0x4E, 0xB4,
+    0xA6, 0xC3, 0xCF, 0xE1, 0x9F, 0x53, 0x47, 0xB3, 0x79, 0x8D, 0xCD, 0x47, 0x56, 0x9E, 0x30, 0x25,
+    0x64, 0xD4, 0x99, 0x35, 0x09, 0x7B, 0xA8, 0x45, 0x09, 0xFF, 0x8F, 0xAA, 0x54, 0x06, 0x7A, 0x29,
+    0x20, 0x03, 0xAB, 0x93, 0xF1, 0x61, 0xEB, 0xC4, 0xD6, 0x8B, 0xDB, 0x2D, 0x52, 0x3F, 0x96, 0x6F,
+    0x99, 0x2D, 0x4A, 0x8C, 0x7A, 0xC6, 0x95, 0xB5, 0x42, 0x69, 0x75, 0xD2, 0xCA, 0xA4, 0x55, 0xC9,
+    0x54, 0xA4, 0x79, 0x35, 0xD2, 0xF8, 0x73, 0x69, 0x1A, 0xC2, 0x0A, 0x09, 0x34, 0xD7, 0xD0, 0x6E,
+    0x7D, 0x0E, 0xD3, 0x55, 0xDE, 0xD1, 0x27, 0xA0, 0xE8, 0x33, 0xC0, 0x62, 0x1A, 0x25, 0xA6, 0x1C,
+    0x11, 0xEB, 0x62, 0xC3, 0x94, 0x8F, 0x61, 0x6F, 0xEB, 0x86, 0xC6, 0x23, 0x0B, 0x6B, 0xC0, 0x64,
+    0x8C, 0x9D, 0x62, 0xE9, 0x4F, 0x58, 0xC0, 0x36, 0x34, 0x35, 0x51, 0x14, 0x4A, 0x42, 0x41, 0x28,
+    0x87, 0x8A, 0x61, 0xA5, 0x58, 0x29, 0x9F, 0x46, 0x1A, 0x1D, 0xB8, 0xB3, 0x8B, 0x35, 0xD3, 0x27,
+    0x53, 0x27, 0xD3, 0x26, 0x53, 0x16, 0xD3, 0x25, 0x53, 0x25, 0xD3, 0x24, 0x53, 0x15, 0xD3, 0xA3,
+    0xA6, 0x46, 0xA4, 0x45, 0xA6, 0x44, 0x9F, 0x55, 0x39, 0x55, 0xE7, 0x5B, 0x93, 0x73, 0xC0, 0x24,
+    0xC1, 0x4B, 0x99, 0x78, 0x7B, 0x56, 0x25, 0x3B, 0x7F, 0xD2, 0xB0, 0x46, 0x69, 0x82, 0xD0, 0x5C,
+    0xC2, 0x37, 0xF7, 0x96, 0x46, 0x0D, 0xAD, 0x39, 0x13, 0x6B, 0xCF, 0xBE, 0x4D, 0xF0, 0x9D, 0x48,
+    0x75, 0x6C, 0xB4, 0x6A, 0x32, 0xDD, 0x63, 0x11, 0x21, 0xFC, 0x38, 0xED, 0x67, 0xDB, 0xEE, 0x9F,
+    0x4B, 0x07, 0xEE, 0xBD, 0xC7, 0xE5, 0xF9, 0x7A, 0x8B, 0xF7, 0xE3, 0x76, 0x22, 0xC2, 0x4A, 0x8B,
+    0x59, 0xC1, 0x7C, 0x44, 0x24, 0x94, 0x5B, 0x24, 0x14, 0xB6, 0xD0, 0x47, 0x77, 0x6D, 0x8D, 0x15,
+    0xE5, 0x26, 0xE5, 0x58, 0x65, 0xA0, 0x85, 0xDC, 0x8C, 0xA0, 0xEC, 0x42, 0xBA, 0x5E, 0xB3, 0xCB,
+    0xE4, 0x8F, 0x25, 0x80, 0x2B, 0x15, 0x56, 0xE6, 0x8A, 0x2A, 0x15, 0x54, 0x2A, 0xA6, 0x54, 0x48,
+    0xA9, 0x88, 0x52, 0x01, 0xA5, 0xE2, 0xC9, 0xA9, 0x1D, 0xBC, 0x52, 0xC1, 0xA4, 0x62, 0x49, 0x85,
+    0x92, 0x8A, 0x24, 0x15, 0x48, 0x2A, 0x8E, 0x34, 0x30, 0x52, 0x51, 0xA4, 0xD3, 0x5A, 0xF1, 0xEC,
+    0x21, 0x56, 0x5C, 0xD9, 0xE5, 0x6E, 0x0B, 0xE0, 0x64, 0x0E, 0x34, 0x59, 0x12, 0x4C, 0xB2, 0xB4,
+    0x10, 0x4A, 0x12, 0x49, 0x12, 0x48, 0x12, 0x47, 0x12, 0x46, 0x12, 0x45, 0x12, 0x44, 0x12, 0x43,
+    0x12, 0x42, 0x2E, 0x10, 0x24, 0x71, 0x83, 0x53, 0xD2, 0xE0, 0xC4, 0x0B, 0x8A, 0x15, 0x14, 0x27,
+    0xCC, 0xF1, 0x9C, 0xC2, 0x4A, 0x85, 0x01, 0x0A, 0x07, 0x08, 0x05, 0x0A, 0xC2, 0x80, 0x5C, 0xD1,
+    0x8D, 0x02, 0x4A, 0x2D, 0xFD, 0x0A, 0x27, 0x15, 0x4D, 0xC6, 0x76, 0x88, 0x0D, 0x94, 0x54, 0x24,
+    0xA9, 0x28, 0x52, 0x71, 0xA4, 0xC2, 0xC8, 0x0D, 0xAD, 0xC0, 0x19, 0x16, 0x52, 0x0C, 0xE9, 0x29,
+    0x84, 0x5C, 0x32, 0x11, 0x72, 0x5A, 0x02, 0x86, 0xE8, 0x1F, 0x0A, 0x48, 0x09, 0x13, 0xB0, 0x78,
+    0x5D, 0x30, 0x92, 0x00, 0x4A, 0x12, 0x48, 0x42, 0x84, 0x1A, 0x12, 0x4C, 0x08, 0x21, 0x09, 0x20,
+    0xE9, 0xE5, 0x8C, 0xD3, 0x44, 0xE3, 0xC1, 0xCF, 0xFB, 0xEA, 0xE3, 0xC6, 0x2D, 0x09, 0x18, 0x09,
+    0x17, 0x83, 0xD6, 0x2D, 0xE5, 0xD2, 0x96, 0xA8, 0xD9, 0x44, 0xD6, 0xD7, 0xDB, 0x98, 0xBB, 0xF2,
+    0x98, 0xA8, 0xD1, 0xD4, 0x6A, 0x8B, 0x4A, 0x7E, 0xCC, 0xAA, 0x3B, 0x80, 0x77, 0x2E, 0x7E, 0x5D,
+    0xDE, 0x7A, 0xCB, 0x26, 0x3D, 0x4C, 0xFE, 0x1C, 0xF6, 0xFE, 0xF9, 0x12, 0x37, 0xA4, 0x47, 0x67,
+    0x02, 0x79, 0x86, 0xC3, 0x4E, 0x9B, 0x6C, 0x58, 0xD3, 0x4D, 0x32, 0x35, 0x76, 0x18, 0x7C, 0xC5,
+    0x76, 0x10, 0x67, 0x4D, 0x1B, 0x26, 0x05, 0x18, 0x40, 0xB3, 0xF2, 0xBA, 0xB5, 0xC5, 0xF3, 0x0F,
+    0xC1, 0x16, 0xD7, 0x7A, 0xC8, 0x3B, 0xAF, 0x13, 0x2D, 0xC5, 0x0C, 0xF8, 0x40, 0x03, 0xBE, 0x38,
+    0xC4, 0x31, 0xE4, 0x2B, 0x72, 0x0C, 0x44, 0x85, 0x9B, 0xA3, 0x9C, 0xFE, 0xAB, 0x32, 0x95, 0x71,
+    0x28, 0x0B, 0x07, 0x79, 0xB3, 0x3A, 0x7A, 0xA3, 0xBC, 0x32, 0xAF, 0x62, 0x5A, 0xD8, 0x7C, 0xFE,
+    0xB1, 0x97, 0x3E, 0x3A, 0x81, 0x92, 0x2A, 0xCE, 0x14, 0xA9, 0x8C, 0x73, 0xC8, 0xB3, 0x0F, 0x2F,
+    0x58, 0xC6, 0xC8, 0xED, 0xE8, 0xB6, 0xBC, 0x5F, 0x8E, 0x2D, 0xF0, 0x08, 0xF2, 0x79, 0xCD, 0x7A,
+    0xA2, 0xC9, 0x7B, 0x4D, 0x93, 0x07, 0xF7, 0x2E, 0x66, 0x51, 0x1A, 0x42, 0x8D, 0x04, 0x42, 0x8F,
+    0x24, 0x06, 0x2A, 0x4B, 0xD8, 0xE8, 0x32, 0x7D, 0x69, 0xAE, 0xEE, 0x31, 0xA2, 0xBD, 0x06, 0xBE,
+    0xB5, 0xB4, 0xDE, 0x16, 0xFA, 0x65, 0x87, 0x93, 0x41, 0x5A, 0x09, 0xDC, 0x7D, 0xED, 0xFC, 0x71,
+    0x01, 0x00, 0x07, 0xA2, 0x50, 0xA6, 0xE5, 0xAD, 0x6B, 0x0B, 0x6F, 0x82, 0x3C, 0x21, 0xC4, 0x59,
+    0xB2, 0xE5, 0xEE, 0x28, 0x80, 0xC0, 0x03, 0xB5, 0x37, 0x48, 0x50, 0x91, 0xCF, 0xB6, 0x3C, 0x0A,
+    0xDA, 0xAB, 0x1F, 0x4D, 0xED, 0xFB, 0xD4, 0xD1, 0xC1, 0x20, 0x62, 0x59, 0xC3, 0x09, 0x99, 0x8B,
+    0xAC, 0x5F, 0xE8, 0x68, 0x1B, 0x99, 0x06, 0x3E, 0x31, 0x97, 0xD9, 0x8C, 0xFF, 0xE9, 0x4C, 0x0C,
+    0xA8, 0xFF, 0x50, 0x81, 0x63, 0xF0, 0x3B, 0x05, 0xC4, 0xE1, 0x73, 0x7A, 0x49, 0xD4, 0xED, 0x65,
+    0xA4, 0x1E, 0xE3, 0xD4, 0x1E, 0x3B, 0x67, 0xB7, 0xD2, 0x06, 0xDA, 0x2F, 0x82, 0xDB, 0xEB, 0xCA,
+    0xC9, 0x64, 0x66, 0x46, 0xAE, 0x7E, 0x6B, 0x6B, 0x6C, 0x80, 0x76, 0x64, 0x38, 0x28, 0x82, 0x2A,
+    0xD3, 0x95, 0x29, 0xAD, 0x84, 0xE5, 0xD8, 0xA4, 0x63, 0xF1, 0x4D, 0x5A, 0x8E, 0x32, 0x84, 0x8A,
+    0xBC, 0x13, 0x1D, 0xCF, 0xAC, 0xCF, 0xC9, 0x95, 0x95, 0xE2, 0x87, 0xE3, 0x54, 0x9A, 0xFA, 0x6E,
+    0x53, 0xBA, 0xF7, 0x7E, 0xDC, 0xFC, 0xAC, 0xF2, 0xCB, 0x00, 0x10, 0x1A, 0xD8, 0x07, 0x0D, 0x03,
+    0xD0, 0x7F, 0x49, 0xB3, 0xA0, 0xA5, 0x29, 0xFA, 0x84, 0x30, 0x29, 0xDA, 0x6D, 0xD8, 0x76, 0xA4,
+    0x01, 0x33, 0x52, 0xFE, 0x66, 0x24, 0x43, 0x65, 0x71, 0x38, 0xF1, 0xA6, 0x77, 0xA7, 0x5A, 0x46,
+    0x98, 0x9D, 0xC3, 0x9D, 0x41, 0xBD, 0x4A, 0x24, 0x98, 0x2E, 0x00, 0x96, 0x33, 0xDE, 0x4B, 0xA9,
+    0x06, 0x5A, 0xDA, 0xF7, 0x5E, 0xCE, 0x7B, 0xAC, 0xFF, 0x5E, 0x65, 0x04, 0xB6, 0xD0, 0x3F, 0x99,
+    0x63, 0xED, 0x0D, 0xD3, 0x4D, 0x84, 0x0D, 0xB6, 0x2D, 0xE2, 0x70, 0x66, 0x93, 0x1B, 0x18, 0x63,
+    0x78, 0x66, 0x9C, 0x61, 0xCD, 0x06, 0xB0, 0x67, 0x7D, 0x06, 0xDC, 0x03, 0x1B, 0x84, 0x25, 0x31,
+    0xBF, 0xF6, 0xEA, 0x64, 0x1B, 0xCC, 0x8A, 0xCB, 0xF5, 0x49, 0xAA, 0x8B, 0xDD, 0xDA, 0xFB, 0xC1,
+    0x1E, 0xFA, 0x29, 0x00, 0x31, 0xE5, 0xFD, 0xE0, 0x22, 0x53, 0xC3, 0x6C, 0x68, 0x7B, 0x1C, 0xA6,
+    0xDA, 0x86, 0xF7, 0x2A, 0xC3, 0x1F, 0x44, 0x04, 0x85, 0x48, 0x65, 0x85, 0x04, 0xEF, 0xDE, 0x45,
+    0x8E, 0x6B, 0xDE, 0x87, 0x47, 0xED, 0x31, 0x2D, 0x28, 0x8E, 0x7D, 0xE2, 0x06, 0x99, 0x2C, 0x2E,
+    0x74, 0xE6, 0xD6, 0x9A, 0xBC, 0x41, 0x68, 0x3D, 0xE4, 0x6F, 0x2B, 0x86, 0xDF, 0x58, 0xA3, 0x67,
+    0xBC, 0xEE, 0xE3, 0xC6, 0x3E, 0xB5, 0x08, 0xD5, 0xDB, 0xF7, 0x81, 0xCC, 0x2F, 0x67, 0x83, 0x61,
+    0x6B, 0x03, 0x4D, 0x47, 0x30, 0xFA, 0x26, 0x6F, 0x38, 0xDC, 0x06, 0xAC, 0x2F, 0x5A, 0x60, 0xA4,
+    0xF7, 0xD7, 0xAA, 0x6D, 0xBE, 0x86, 0xA6, 0x83, 0x6C, 0xB3, 0xD5, 0xDC, 0x4C, 0xCD, 0x03, 0xCD,
+    0x34, 0xED, 0x98, 0x29, 0xEA, 0x98, 0x09, 0x6A, 0x85, 0xEC, 0x7D, 0x82, 0xFC, 0xB7, 0x05, 0xCC,
+    0xF4, 0x51, 0x0E, 0x50, 0xF7, 0x22, 0xA6, 0x3F, 0xA5, 0xAD, 0x9C, 0x36, 0x51, 0x91, 0xD5, 0xE4,
+    0x8D, 0xDE, 0x01, 0x33, 0x29, 0x34, 0xAD, 0xD8, 0x0F, 0x6C, 0x33, 0x0B, 0x24, 0xD5, 0x41, 0x68,
+    0x0A, 0xCD, 0x98, 0xDF, 0x69, 0x90, 0x9A, 0x3A, 0x92, 0x2A, 0x73, 0x26, 0x1E, 0x8B, 0x11, 0xFE,
+    0xA4, 0x18, 0xDC, 0xFD, 0x10, 0xC6, 0x75, 0xDF, 0x87, 0x71, 0xBD, 0x0F, 0x98, 0xB4, 0x89, 0x7B,
+    0x83, 0xBB, 0xC4, 0x16, 0xEF, 0x28, 0x2B, 0x53, 0x33, 0x77, 0x8C, 0xE6, 0xC5, 0x28, 0xE1, 0x00,
+    0x30, 0x40, 0xBA, 0xC8, 0xF0, 0x31, 0xCA, 0xC4, 0xAA, 0x28, 0x94, 0x84, 0x82, 0x50, 0x0E, 0x8A,
+    0xD1, 0x25, 0x3C, 0x23, 0xBB, 0x19, 0xB1, 0xDD, 0x8F, 0x05, 0xB5, 0xF0, 0xB6, 0x4C, 0x5C, 0x84,
+    0x08, 0x69, 0xC3, 0xC4, 0x00, 0x72, 0x98, 0xD8, 0xFD, 0x0B, 0x8A, 0xE3, 0x9D, 0x5C, 0xC5, 0x09,
+    0xD0, 0x79, 0xB3, 0x88, 0x87, 0x90, 0x85, 0xA2, 0x50, 0x12, 0xC3, 0x52, 0xD8, 0x36, 0xF7, 0xF8,
+    0x3A, 0x0E, 0xAD, 0xF3, 0x67, 0xDB, 0x64, 0x28, 0x37, 0x39, 0xFC, 0x46, 0x69, 0xA4, 0xB4, 0xB5,
+    0xFA, 0x97, 0xED, 0x39, 0x08, 0xE5, 0x4A, 0x3A, 0x1B, 0x04, 0x83, 0x7A, 0xDE, 0x7B, 0xC2, 0xD6,
+    0xDC, 0x96, 0x49, 0x15, 0x42, 0xD3, 0xE4, 0x3C, 0x49, 0x3E, 0x4A, 0xBA, 0x47, 0xC8, 0xAC, 0x4C,
+    0x8C, 0x67, 0xD6, 0x8F, 0xA6, 0xFF, 0xFA, 0x3C, 0x5B, 0x3C, 0x10, 0xF2, 0xD9, 0x68, 0x24, 0x67,
+    0xDA, 0xE0, 0x7D, 0x69, 0x6B, 0xBA, 0xC0, 0xC9, 0x89, 0x29, 0x5D, 0x4A, 0xC0, 0x62, 0xB2, 0xE4,
+    0x9A, 0xE9, 0xB0, 0xCF, 0x0C, 0x73, 0x3D, 0xBC, 0x50, 0x2F, 0x6E, 0xDF, 0xFC, 0x3D, 0xC8, 0x77,
+    0xA1, 0x1A, 0x89, 0xE4, 0xCB, 0x80, 0x2A, 0xBA, 0xE6, 0x12, 0xD6, 0xF4, 0xB2, 0x6D, 0x41, 0x13,
+    0x2D, 0xEC, 0xA2, 0x95, 0x7D, 0xB1, 0x6B, 0x5E, 0xDA, 0x7A, 0x5B, 0x0B, 0xC4, 0xA5, 0xEB, 0x13,
+    0x3D, 0x12, 0xD1, 0x45, 0x62, 0xD3, 0x92, 0x73, 0x4A, 0x86, 0x33, 0x12, 0x8C, 0x0C, 0xF1, 0xFB,
+    0xB7, 0xF9, 0x1C, 0x79, 0xDF, 0xA0, 0x03, 0x97, 0x02, 0xDB, 0xE2, 0x13, 0x69, 0x0F, 0x65, 0x77,
+    0x79, 0xAA, 0xE4, 0x69, 0x44, 0xA2, 0x1A, 0xAD, 0xBB, 0xF8, 0x87, 0xAC, 0xCB, 0x0E, 0x5E, 0x5B,
+    0xFE, 0x6A, 0xD1, 0xF2, 0xAB, 0x1A, 0x85, 0xE9, 0x5B, 0xBA, 0x53, 0x77, 0xD9, 0x83, 0x96, 0x39,
+    0xD8, 0xD8, 0xCF, 0x1E, 0xD0, 0x3C, 0x40, 0x74, 0x32, 0x4E, 0xFF, 0xDF, 0x49, 0x7F, 0xA5, 0xF8,
+    0xC5, 0x32, 0xFC, 0x62, 0x09, 0x7E, 0xB1, 0xFC, 0xFE, 0x82, 0xDE, 0x6F, 0xD9, 0xFD, 0x96, 0xDC,
+    0x6F, 0xB9, 0xFD, 0x56, 0xE8, 0x96, 0xD9, 0x6F, 0x89, 0xFD, 0x96, 0xD7, 0x6F, 0x69, 0xFD, 0x56,
+    0xDE, 0x56, 0xDC, 0x56, 0xDA, 0x96, 0xD2, 0x6F, 0x19, 0xFD, 0x96, 0xD0, 0x6F, 0xF9, 0xFC, 0xFD,
+    0x74, 0x7E, 0xE7, 0x44, 0x68, 0x4E, 0x99, 0xB5, 0x9C, 0x59, 0x4B, 0x9A, 0x59, 0xD6, 0xEC, 0x51,
+    0x63, 0xF3, 0x6D, 0xEC, 0x27, 0xFB, 0x3A, 0x66, 0x86, 0x6C, 0xCB, 0x49, 0x1E, 0x77, 0xB1, 0x36,
+    0x6C, 0x88, 0x1E, 0x2A, 0x32, 0x0E, 0x0D, 0x27, 0x6A, 0x98, 0xF3, 0xAF, 0xB0, 0x58, 0x0F, 0xD8,
+    0x03, 0x8A, 0xAD, 0x96, 0xA2, 0x41, 0xC1, 0xB8, 0x65, 0x88, 0x62, 0x11, 0x86, 0x8E, 0x32, 0xAC,
+    0x27, 0xF5, 0x82, 0x3E, 0xD0, 0x55, 0xF8, 0xC4, 0xDB, 0xC8, 0x1A, 0x43, 0x47, 0x32, 0xC5, 0x3E,
+    0xB3, 0x1A, 0xF6, 0xF6, 0xF6, 0x3A, 0x4D, 0x81, 0x45, 0xF5, 0x92, 0x62, 0x60, 0x69, 0x54, 0xE6,
+    0x36, 0x22, 0xE7, 0x3F, 0xA1, 0x04, 0xB5, 0x39, 0x0B, 0xA9, 0x31, 0x13, 0x8C, 0x3A, 0xD3, 0x7A,
+    0x0D, 0x89, 0xF4, 0x44, 0x23, 0xB2, 0xBC, 0xF1, 0x7C, 0x13, 0xBD, 0x37, 0x89, 0x90, 0xAF, 0x42,
+    0xDE, 0x60, 0xC7, 0x83, 0x57, 0xD3, 0x1A, 0x61, 0x6E, 0x8E, 0x16, 0x37, 0xB8, 0x3D, 0x1B, 0xE6,
+    0xE4, 0xB3, 0xCF, 0x55, 0x06, 0xCC, 0xA4, 0xDA, 0x82, 0x2A, 0x61, 0x3C, 0x61, 0x44, 0x00, 0xFC,
+    0xF1, 0xC0, 0x72, 0x08, 0xF9, 0x7B, 0x3C, 0x21, 0x0B, 0x49, 0x25, 0x22, 0x8B, 0x78, 0x77, 0xF4,
+    0xEC, 0x37, 0x6B, 0xDB, 0x95, 0xB9, 0xA1, 0x42, 0xE9, 0x58, 0xCB, 0x0E, 0xFD, 0x8E, 0x43, 0xE9,
+    0x9D, 0x0A, 0x18, 0x0D, 0xA4, 0xAF, 0xBA, 0x3B, 0xA8, 0xB4, 0xBD, 0x92, 0xF6, 0x4A, 0xD9, 0x93,
+    0xB0, 0x57, 0xBA, 0x5E, 0xC9, 0x7A, 0xA5, 0xEA, 0x95, 0xA8, 0x57, 0x9A, 0x5E, 0x49, 0x7A, 0xA5,
+    0xE8, 0x95, 0xA0, 0x57, 0x7A, 0x5E, 0xC9, 0x79, 0xA5, 0xE6, 0x95, 0x98, 0x57, 0x5A, 0x5E, 0x49,
+    0x79, 0xA5, 0xE4, 0x95, 0x90, 0xDF, 0x36, 0xEE, 0xBC, 0x66, 0x59, 0xD5, 0x91, 0x15, 0x2F, 0x58,
+    0x38, 0x36, 0xD9, 0xF4, 0x4F, 0x9A, 0x9A, 0x3C, 0x3A, 0x49, 0x74, 0x32, 0xE8, 0xA4, 0xCF, 0xC9,
+    0x9D, 0x93, 0x38, 0x27, 0x6B, 0x4E, 0xCA, 0x9C, 0x7C, 0x39, 0xC9, 0x72, 0xDB, 0x51, 0xCF, 0xBB,
+    0xEA, 0x7D, 0x51, 0x10, 0xCF, 0x6B, 0x2A, 0x17, 0xF4, 0x18, 0x22, 0xDF, 0xE4, 0x52, 0x4F, 0xFA,
+    0x18, 0xBE, 0x11, 0xE8, 0x69, 0x2E, 0x07, 0x6D, 0x86, 0x98, 0x00, 0x36, 0x0E, 0xEB, 0xF6, 0x72,
+    0x65, 0x0E, 0x1E, 0xD4, 0xED, 0x05, 0x9F, 0xD3, 0xED, 0xE9, 0x41, 0x09, 0xCB, 0x5E, 0xD4, 0x16,
+    0x78, 0xFC, 0x09, 0x2B, 0xFA, 0x57, 0xD9, 0x7E, 0xA7, 0xFA, 0xF6, 0x6E, 0xB0, 0xA5, 0x3A, 0xD2,
+    0xCE, 0xCF, 0x31, 0xED, 0xAE, 0x5F, 0x74, 0x13, 0x60, 0xBF, 0x7B, 0xEA, 0xD1, 0x3D, 0xBE, 0x7E,
+    0x14, 0xDB, 0x41, 0x9B, 0x73, 0x0C, 0x23, 0x16, 0xA5, 0x8B, 0x03, 0xA8, 0xEA, 0x80, 0xF4, 0xC7,
+    0xD5, 0x20, 0xEA, 0xA8, 0x3E, 0x15, 0xCD, 0x8B, 0x45, 0xB5, 0x10, 0xE5, 0x6B, 0x10, 0xBC, 0x8E,
+    0x4D, 0x8D, 0x4C, 0x8A, 0xA8, 0x82, 0xA7, 0xFB, 0x15, 0x36, 0x3F, 0xAC, 0xA1, 0x6E, 0x3C, 0xE5,
+    0xD7, 0x38, 0x46, 0xAC, 0xE6, 0xA3, 0x30, 0xC5, 0x16, 0x46, 0x58, 0x7F, 0x44, 0xC0, 0x3D, 0x4D,
+    0x10, 0xF2, 0xD3, 0x04, 0x5E, 0x54, 0x27, 0x5E, 0xD1, 0x9B, 0x24, 0x0A, 0xE6, 0x36, 0x21, 0x76,
+    0xC8, 0x8C, 0x89, 0x7C, 0x91, 0xA4, 0x7E, 0xDD, 0xDB, 0xA3, 0x3D, 0x91, 0x7D, 0x88, 0x04, 0x9F,
+    0xED, 0x7E, 0x81, 0xE0, 0xB4, 0x41, 0x5F, 0x44, 0x27, 0xF4, 0xB6, 0x50, 0x89, 0x6C, 0x1D, 0x96,
+    0xEF, 0x9F, 0xC5, 0xB6, 0x4E, 0xD1, 0x5D, 0x4E, 0x7A, 0x13, 0x17, 0x75, 0x37, 0x40, 0xE4, 0xC4,
+    0xA3, 0x20, 0x1D, 0x0D, 0x42, 0x07, 0x62, 0xB8, 0x90, 0x02, 0x6D, 0x48, 0x14, 0xA3, 0xBF, 0x40,
+    0x20, 0x07, 0x95, 0x57, 0x04, 0x80, 0x92, 0x01, 0x32, 0x61, 0x3C, 0x9E, 0xC8, 0x93, 0xF3, 0x22,
+    0x93, 0x92, 0x14, 0x2D, 0x6B, 0x8B, 0x71, 0x85, 0x61, 0x21, 0xAB, 0x8C, 0x9C, 0x13, 0xCE, 0x31,
+    0x73, 0x27, 0x14, 0x85, 0x7D, 0x95, 0x0A, 0xC2, 0x09, 0x29, 0x46, 0x2B, 0xC5, 0xD1, 0x44, 0xCE,
+    0xAB, 0xED, 0x71, 0x66, 0x70, 0x1D, 0x1E, 0xFE, 0x94, 0x94, 0x34, 0x65, 0x7A, 0xCC, 0x14, 0x11,
+    0xA5, 0xF0, 0x20, 0x44, 0x70, 0xBD, 0x50, 0x11, 0x5A, 0x09, 0x8E, 0x42, 0xC5, 0xB5, 0xD3, 0x10,
+    0x12, 0xCB, 0xC0, 0xF1, 0xA4, 0xCF, 0x53, 0x28, 0x54, 0x4A, 0xC7, 0xCE, 0x3F, 0x54, 0x48, 0x0A,
+    0x34, 0x8A, 0x78, 0x3C, 0x70, 0xDA, 0x35, 0x87, 0xBE, 0x08, 0x6B, 0x86, 0x11, 0x63, 0xFC, 0x41,
+    0xD0, 0x37, 0x56, 0xF4, 0x78, 0x61, 0x3E, 0x15, 0xF9, 0xBC, 0xE0, 0xA7, 0x68, 0x9C, 0xDE, 0xA9,
+    0x50, 0xA8, 0x91, 0xFB, 0x2B, 0x58, 0xE9, 0xD4, 0x09, 0xBB, 0x65, 0xB5, 0xED, 0x63, 0xA2, 0x0C,
+    0x59, 0x23, 0xE3, 0x3F, 0x04, 0x46, 0x1A, 0x3B, 0xB7, 0xF0, 0x7C, 0xAD, 0x35, 0x75, 0xA7, 0xD3,
+    0xD3, 0x32, 0xFE, 0x93, 0xF4, 0x31, 0xE1, 0x57, 0x45, 0x3C, 0xF6, 0x0E, 0x0A, 0xD5, 0x9F, 0x40,
+    0x80, 0xE2, 0x17, 0xF7, 0x63, 0x94, 0x4B, 0xF9, 0x3E, 0x6A, 0xDC, 0xA9, 0x87, 0xA5, 0x8B, 0x1E,
+    0x70, 0x03, 0x40, 0x49, 0x7C, 0x23, 0x95, 0x9B, 0x6E, 0x26, 0xA7, 0x9C, 0x23, 0xD3, 0x63, 0xE9,
+    0xFC, 0x9A, 0xF8, 0x48, 0xB1, 0xA8, 0xAC, 0x68, 0x39, 0xE0, 0x4E, 0xDB, 0xE7, 0xF0, 0xF7, 0xA5,
+    0x87, 0x76, 0x6A, 0x79, 0x66, 0x29, 0x4D, 0x90, 0x5E, 0x9E, 0x2F, 0xB0, 0x31, 0xBD, 0xE2, 0xA6,
+    0xA4, 0x6A, 0xB5, 0x93, 0xA9, 0x1E, 0x4C, 0x76, 0xBE, 0x9C, 0xD5, 0x6F, 0xBF, 0x8D, 0x35, 0xD5,
+    0xE9, 0x28, 0xDC, 0xE2, 0x40, 0x53, 0xF9, 0x7A, 0x92, 0xCD, 0xE1, 0xF5, 0x5C, 0x56, 0x7B, 0x39,
+    0x4C, 0x9F, 0x3E, 0x2C, 0x81, 0xE5, 0x71, 0xF6, 0xAE, 0xFE, 0xC7, 0x55, 0x20, 0xBF, 0xB6, 0x5F,
+    0xB7, 0xFA, 0xA2, 0x67, 0xAC, 0x6A, 0xCE, 0x84, 0x29, 0x3C, 0x7C, 0x81, 0x82, 0xB1, 0xA2, 0x51,
+    0x77, 0xB1, 0xDA, 0x1F, 0xF7, 0x19, 0xAB, 0xC6, 0xC6, 0xEF, 0x3B, 0x7B, 0x7E, 0xF3, 0x6C, 0x27,
+    0x36, 0x8E, 0xE2, 0x8C, 0x75, 0xF9, 0x0A, 0x35, 0x26, 0xC0, 0xB9, 0xC5, 0xFA, 0x5B, 0xFA, 0x9D,
+    0xEF, 0x6B, 0x1D, 0xF3, 0x79, 0x32, 0x77, 0x8B, 0xAE, 0x12, 0x1D, 0x70, 0x95, 0xA3, 0xD0, 0x13,
+    0x39, 0x4D, 0x50, 0x7B, 0x65, 0x80, 0xED, 0x3E, 0xE7, 0x63, 0xE3, 0xDD, 0x4E, 0x4E, 0x43, 0x8B,
+    0x34, 0x06, 0xFC, 0x9E, 0xBD, 0x3C, 0x85, 0x7B, 0xED, 0x10, 0xC2, 0x13, 0xBF, 0xF3, 0x4D, 0x00,
+    0x0F, 0x97, 0x99, 0x7A, 0xB9, 0x37, 0xA1, 0xB8, 0x01, 0xFA, 0xDC, 0xE0, 0x57, 0x6C, 0x3D, 0x01,
+    0x0F, 0x08, 0xD1, 0xA1, 0x50, 0xAC, 0xB4, 0x58, 0x90, 0xB1, 0xF1, 0x1B, 0x40, 0x5F, 0xCA, 0xC2,
+    0x58, 0x3D, 0x74, 0xDF, 0xAE, 0xC1, 0x72, 0x9F, 0x34, 0xE2, 0xDC, 0xFD, 0x87, 0xA0, 0x6A, 0x4B,
+    0xCF, 0x52, 0x23, 0xCC, 0x39, 0x6D, 0x34, 0x1C, 0x46, 0x1B, 0x98, 0x7E, 0x14, 0xF9, 0x4C, 0x20,
+    0xAF, 0x7B, 0xBF, 0x16, 0x2F, 0x5B, 0x35, 0x14, 0xE9, 0xC3, 0xD1, 0xE3, 0xD0, 0x3D, 0xF9, 0xB2,
+    0x3A, 0x5C, 0x38, 0xC3, 0x78, 0xD6, 0x3F, 0xE9, 0x3D, 0x4A, 0x34, 0xFD, 0xA4, 0xB4, 0x58, 0xE2,
+    0xF8, 0xCF, 0xED, 0x14, 0x37, 0x00, 0xC1, 0xCC, 0x13, 0x6B, 0x07, 0x37, 0x1C, 0xCD, 0xB9, 0xA5,
+    0x06, 0x1A, 0x29, 0x28, 0xE7, 0x3E, 0xBF, 0xDA, 0x94, 0x3F, 0x25, 0xF3, 0x8D, 0x3B, 0xF6, 0x43,
+    0xEC, 0x57, 0x0D, 0x82, 0x09, 0xFE, 0x59, 0xCA, 0x77, 0x80, 0x50, 0x6D, 0xB2, 0x3C, 0xA2, 0x03,
+    0x7C, 0xD1, 0x8A, 0x95, 0xA0, 0x72, 0x35, 0xE7, 0xB7, 0x1D, 0x4B, 0x6C, 0xB5, 0x6F, 0x72, 0x03,
+    0xFC, 0x62, 0xB2, 0x90, 0xFB, 0xE3, 0xE1, 0x02, 0xBD, 0x47, 0x69, 0xA1, 0x20, 0xDF, 0x4F, 0xC8,
+    0x45, 0xD9, 0x6B, 0xCE, 0x58, 0x0B, 0x6B, 0xD4, 0x92, 0x80, 0xED, 0xD7, 0xB3, 0x26, 0x6A, 0x31,
+    0x65, 0x3A, 0x74, 0x87, 0x2E, 0xEF, 0x22, 0xD0, 0x1B, 0xF1, 0x77, 0x7F, 0xB4, 0x70, 0x3A, 0xFA,
+    0xD3, 0xA4, 0x9D, 0x9E, 0xD3, 0x56, 0x16, 0x9C, 0x99, 0x02, 0x72, 0x05, 0xC2, 0x34, 0x98, 0x77,
+    0xD8, 0x2C, 0x4E, 0x77, 0xB4, 0xF0, 0xF3, 0xD6, 0xCC, 0xF4, 0x9A, 0x27, 0x6C, 0xBB, 0xC3, 0xF7,
+    0x99, 0x8B, 0xB7, 0x2F, 0xEC, 0xE3, 0x09, 0xA3, 0x43, 0x98, 0xF5, 0x69, 0xA7, 0x46, 0xB5, 0x60,
+    0xE2, 0x00, 0x2F, 0xD8, 0xBE, 0x54, 0x53, 0x31, 0x5F, 0x23, 0x58, 0xED, 0x74, 0xD8, 0xAF, 0xB1,
+    0x6B, 0xC0, 0x83, 0x2B, 0xF7, 0xAF, 0x8C, 0x9B, 0x62, 0xE5, 0x76, 0xFA, 0xD9, 0x72, 0x95, 0xB4,
+    0x15, 0x6B, 0x43, 0x7F, 0x92, 0xA9, 0xA0, 0x17, 0x30, 0xF6, 0x0F, 0xB4, 0x34, 0xAF, 0x6A, 0x4B,
+    0xBB, 0xE8, 0x02, 0x2E, 0x43, 0x4F, 0x9F, 0x0A, 0x07, 0x05, 0xCC, 0xF2, 0x75, 0xDB, 0x4C, 0xCE,
+    0x07, 0x8A, 0x69, 0x8E, 0x79, 0xD8, 0xE8, 0xAC, 0xCC, 0x44, 0xBF, 0xEC, 0x01, 0x20, 0x3B, 0xA6,
+    0x89, 0xA3, 0x79, 0x5F, 0xD3, 0x19, 0xB2, 0xB6, 0xE9, 0x1A, 0xB6, 0xDF, 0x13, 0xF3, 0x69, 0xDE,
+    0x31, 0xB7, 0x6E, 0x46, 0xEA, 0x05, 0xDA, 0x26, 0xF5, 0xE2, 0x4B, 0x81, 0x1A, 0x03, 0xCD, 0x15,
+    0x58, 0xB4, 0x96, 0xF8, 0xFC, 0xAC, 0x63, 0xBA, 0xBE, 0xA5, 0x87, 0xF1, 0xF8, 0xE5, 0xC2, 0x80,
+    0x85, 0xAB, 0x85, 0x75, 0x97, 0x6A, 0xBF, 0x19, 0xD9, 0xAD, 0x26, 0x99, 0xEE, 0xEA, 0xE5, 0x09,
+    0x1C, 0x03, 0x09, 0x0F, 0xC5, 0x61, 0xD7, 0x7E, 0x2F, 0xB7, 0x3D, 0xB9, 0x3A, 0xA7, 0x4D, 0xA3,
+    0x82, 0xF0, 0xAA, 0x7B, 0x72, 0xC5, 0xD0, 0x36, 0x01, 0xA2, 0x38, 0x85, 0x07, 0x32, 0x8A, 0x0D,
+    0x14, 0x1D, 0x28, 0x3E, 0x50, 0x84, 0xA0, 0x18, 0x81, 0xB4, 0x4F, 0xEE, 0x73, 0x00, 0xF6, 0xBB,
+    0x98, 0xA9, 0xF1, 0xD5, 0xFC, 0xA1, 0xED, 0xF1, 0xED, 0x81, 0x8C, 0x52, 0x33, 0x1B, 0x9C, 0x7B,
+    0x30, 0x0F, 0xBF, 0x2F, 0x7C, 0x24, 0x33, 0x07, 0x37, 0x51, 0x21, 0x9F, 0x92, 0xD6, 0xB8, 0x3D,
+    0x85, 0x8A, 0x03, 0x77, 0x8A, 0x77, 0x85, 0x77, 0x89, 0xA0, 0x2C, 0x34, 0x28, 0xE7, 0xB4, 0x86,
+    0x06, 0xA6, 0x68, 0x60, 0x22, 0x28, 0x3D, 0x04, 0xA5, 0x9F, 0xFF, 0x17, 0x8D, 0x54, 0x31, 0x6F,
+    0xDB, 0x46, 0x14, 0xFE, 0x48, 0xCA, 0xA6, 0x1B, 0xDA, 0x3E, 0xA5, 0x55, 0x8A, 0x24, 0x55, 0xCC,
+    0x00, 0xF5, 0x20, 0xA8, 0xB2, 0xA9, 0xA2, 0x1A, 0xD4, 0x82, 0x14, 0xEF, 0x0F, 0x04, 0xE0, 0x10,
+    0xA2, 0x43, 0x17, 0x0D, 0x1D, 0x0A, 0x23, 0x45, 0x34, 0x68, 0x50, 0x02, 0xC5, 0xBA, 0xA6, 0x63,
+    0x17, 0x15, 0xC8, 0xD4, 0xC9, 0x43, 0x07, 0x47, 0x1E, 0xEC, 0x21, 0x43, 0x8B, 0xDA, 0xD1, 0x75,
+    0x2A, 0x90, 0x2E, 0xDC, 0x3A, 0x74, 0x28, 0x0B, 0xE4, 0x07, 0x70, 0x10, 0x50, 0xA5, 0x90, 0x74,
+    0x7D, 0x47, 0xC9, 0x4D, 0x91, 0xA9, 0x14, 0x49, 0xF1, 0xDE, 0xBB, 0x7B, 0xF7, 0xEE, 0xFB, 0xBE,
+    0xF7, 0x4A, 0x08, 0xE1, 0xC2, 0x11, 0x56, 0x02, 0x8E, 0xC8, 0xCA, 0x9C, 0xC4, 0xE5, 0x3E, 0x8A,
+    0x40, 0x09, 0x98, 0xC3, 0x52, 0x60, 0xDF, 0x88, 0xC0, 0x4A, 0x8A, 0xE0, 0x06, 0x2F, 0x38, 0xD3,
+    0xB2, 0xAB, 0x66, 0x3E, 0xCB, 0x68, 0x38, 0x50, 0x50, 0x0A, 0x71, 0x8C, 0xEA, 0x68, 0x84, 0x01,
+    0x7D, 0x56, 0x47, 0x4F, 0x71, 0xDB, 0x10, 0x3D, 0x5B, 0x84, 0x0A, 0xEE, 0x0C, 0x06, 0x47, 0xE9,
+    0x7C, 0xF6, 0x39, 0x0C, 0xF8, 0x8C, 0xF7, 0x19, 0xDF, 0x5D, 0x43, 0x28, 0x3E, 0x48, 0x8D, 0xD4,
+    0x4C, 0x43, 0xE1, 0xA3, 0x01, 0x67, 0xD8, 0x9A, 0x34, 0xFC, 0x4E, 0xAD, 0xD9, 0x73, 0x33, 0x03,
+    0x88, 0x4A, 0x56, 0x3A, 0x65, 0x5F, 0xA7, 0xFB, 0x8E, 0xE8, 0xED, 0xA0, 0x58, 0xA4, 0x24, 0xB8,
+    0x6F, 0x4B, 0xD7, 0x03, 0x9B, 0xC1, 0xCE, 0x74, 0x3C, 0x80, 0x71, 0xFA, 0x51, 0xC2, 0xFB, 0x08,
+    0xE0, 0xA3, 0x42, 0x16, 0xB8, 0x8C, 0xEF, 0x33, 0xB4, 0x5C, 0x04, 0x1E, 0x2A, 0x37, 0x50, 0x5A,
+    0x43, 0x8B, 0x09, 0xD7, 0x96, 0xCE, 0xE3, 0xD4, 0x92, 0x19, 0x78, 0x11, 0x6D, 0x18, 0x13, 0x7D,
+    0xDF, 0xFE, 0x56, 0x34, 0x2D, 0x19, 0x2A, 0xCE, 0xE6, 0xA0, 0xD3, 0x1A, 0xDF, 0xC3, 0x5D, 0xE0,
+    0xF0, 0x14, 0x67, 0x36, 0xE7, 0x94, 0x40, 0x6A, 0x25, 0xB6, 0x64, 0xC2, 0x43, 0x0B, 0x17, 0xB8,
+    0x0B, 0x2B, 0xB5, 0x13, 0x26, 0x19, 0xF7, 0x68, 0xAB, 0x1E, 0x25, 0xD3, 0x7F, 0x14, 0x04, 0xC1,
+    0xDE, 0xAD, 0xC2, 0x9B, 0xF6, 0xD2, 0x25, 0x82, 0x92, 0x62, 0xDE, 0x35, 0x27, 0x76, 0xCA, 0x44,
+    0xA0, 0x11, 0x04, 0xB2, 0x77, 0xD3, 0x71, 0xF2, 0xA9, 0xB4, 0xA4, 0xCE, 0x7D, 0x07, 0xFB, 0x51,
+    0x38, 0x09, 0x22, 0x7F, 0xE9, 0x0B, 0x95, 0xAC, 0x9E, 0x48, 0x58, 0x02, 0xB6, 0x80, 0xC3, 0xC1,
+    0xA0, 0xEF, 0xB7, 0xB4, 0x6B, 0x86, 0xA9, 0x49, 0x44, 0x84, 0x7C, 0x17, 0x36, 0xDF, 0x47, 0x93,
+    0xB0, 0xF2, 0x71, 0x8B, 0x1C, 0x06, 0x6D, 0x62, 0xC9, 0xFB, 0x2F, 0xC7, 0x13, 0xA0, 0x7A, 0x1C,
+    0xCE, 0x6C, 0x69, 0x0B, 0x47, 0xC3, 0x02, 0x93, 0xEC, 0x83, 0xD9, 0xFD, 0x97, 0x0E, 0x5F, 0xC7,
+    0xC1, 0xF1, 0x78, 0xAA, 0x6D, 0x98, 0x62, 0x62, 0x64, 0x46, 0x66, 0xA6, 0x9F, 0x25, 0x63, 0x79,
+    0x48, 0x86, 0x16, 0xA5, 0xDC, 0xC7, 0x39, 0x7E, 0xC0, 0x05, 0x1F, 0x48, 0x4F, 0xA2, 0x15, 0x06,
+    0x28, 0x18, 0x08, 0x1C, 0x11, 0x30, 0x51, 0x5A, 0xCF, 0x29, 0xE9, 0x34, 0x3B, 0x7E, 0xAF, 0xE7,
+    0x69, 0x4A, 0x08, 0x6E, 0x97, 0xB6, 0xEE, 0x22, 0x82, 0x45, 0xB0, 0x33, 0x69, 0x12, 0x79, 0x27,
+    0x72, 0x01, 0x4B, 0x32, 0xB2, 0xFB, 0x08, 0xB8, 0x27, 0xF5, 0x3C, 0x47, 0x68, 0x62, 0xDC, 0x15,
+    0x31, 0x15, 0xD2, 0xC2, 0x71, 0xA8, 0x66, 0x3D, 0xF8, 0xCF, 0xE0, 0x67, 0xE8, 0x45, 0xF9, 0x91,
+    0x3B, 0xFE, 0xF6, 0x83, 0x8B, 0xBE, 0xF7, 0x47, 0x46, 0xDF, 0x45, 0x44, 0xA4, 0x2A, 0xE6, 0x72,
+    0x87, 0x44, 0x46, 0xE4, 0x44, 0xC4, 0x3F, 0x4C, 0xE2, 0x79, 0x0E, 0xD7, 0xC5, 0xB9, 0x2D, 0x22,
+    0x83, 0x0F, 0x4D, 0x64, 0x0C, 0xE3, 0x05, 0xC2, 0xA9, 0x26, 0x9F, 0xE8, 0x62, 0x0A, 0xE1, 0xA9,
+    0xE6, 0x30, 0x97, 0x63, 0xC9, 0x9D, 0x34, 0x5B, 0x2A, 0xEB, 0x7A, 0x49, 0xD1, 0x20, 0x38, 0xC5,
+    0x40, 0xF1, 0x6B, 0x31, 0xAE, 0xC5, 0x31, 0x69, 0x53, 0x89, 0x03, 0x92, 0xA5, 0xBE, 0x3C, 0x45,
+    0x40, 0x8F, 0x46, 0x39, 0x4A, 0xE4, 0xCB, 0xA5, 0x1A, 0xD3, 0x3F, 0xC9, 0x99, 0x4D, 0x6A, 0x9E,
+    0x9A, 0x36, 0x5D, 0x92, 0xB3, 0x56, 0xEF, 0x58, 0x2D, 0x0E, 0x46, 0xC7, 0x34, 0x27, 0x8E, 0xC7,
+    0x4A, 0xA9, 0xC5, 0x88, 0xAE, 0xA7, 0x7A, 0x99, 0x23, 0x31, 0x10, 0xE6, 0x1C, 0x5E, 0x42, 0x08,
+    0xA2, 0x80, 0xCB, 0x6B, 0x9F, 0x1E, 0x3F, 0xC7, 0x19, 0x06, 0x1D, 0x8A, 0x4A, 0x08, 0xB6, 0xCC,
+    0x69, 0xFC, 0xD7, 0x35, 0x79, 0xED, 0x72, 0xFE, 0xBF, 0xEB, 0xF3, 0x3C, 0x7C, 0x4D, 0xCB, 0x8A,
+    0x7E, 0xFB, 0xC4, 0x17, 0x08, 0xD4, 0xEB, 0x3E, 0x6A, 0x04, 0xE9, 0x8F, 0x71, 0x5F, 0xA9, 0x69,
+    0x1C, 0x47, 0xB9, 0x88, 0x66, 0x1F, 0xC7, 0xFD, 0x2E, 0x9A, 0x67, 0xE8, 0x8E, 0x55, 0x36, 0x1A,
+    0x1D, 0x69, 0xD2, 0xFE, 0x9A, 0x06, 0x87, 0x5F, 0x9E, 0x35, 0xB5, 0x62, 0x0A, 0xD8, 0xEB, 0xBB,
+    0x19, 0x93, 0x61, 0xD6, 0xCD, 0x72, 0x9D, 0x4C, 0x48, 0xBC, 0xDC, 0xC9, 0x75, 0xE4, 0xC8, 0xD6,
+    0xEA, 0x20, 0x1A, 0xA3, 0x9B, 0xA3, 0x91, 0xF8, 0x0F, 0x46, 0x5C, 0xFF, 0x5F, 0x4A, 0xDB, 0xA4,
+    0xE6, 0x60, 0x44, 0x24, 0x6C, 0xA9, 0x73, 0x89, 0xF0, 0x46, 0x2B, 0xA8, 0x22, 0x94, 0xB6, 0xD4,
+    0x9A, 0xA0, 0xEB, 0x26, 0x2F, 0x84, 0x08, 0x1E, 0x9D, 0x3F, 0x9A, 0x4E, 0x77, 0xB3, 0x36, 0x95,
+    0xC4, 0x0D, 0x52, 0x44, 0x40, 0xA5, 0xEF, 0x89, 0xA5, 0xEC, 0x95, 0x6C, 0x8D, 0x4E, 0x44, 0x8F,
+    0xA4, 0xFD, 0x8C, 0x74, 0x7F, 0x84, 0x2B, 0x79, 0x0A, 0xEE, 0x1B, 0x29, 0x84, 0xAB, 0x14, 0x96,
+    0x05, 0xAE, 0x6B, 0x9C, 0x0A, 0xDC, 0xD5, 0x05, 0x7E, 0x2D, 0x1A, 0x64, 0x07, 0x19, 0xB5, 0x91,
+    0x84, 0x2A, 0xAE, 0x00, 0xE3, 0x4E, 0xC9, 0x9D, 0x69, 0x1D, 0x74, 0x54, 0x72, 0xF5, 0xE7, 0x3C,
+    0xD6, 0x36, 0x9D, 0x08, 0x54, 0x30, 0xEB, 0xC3, 0xB2, 0x3B, 0xEF, 0x07, 0xE3, 0x49, 0xD7, 0x49,
+    0xA8, 0x09, 0x68, 0xC4, 0x97, 0x20, 0xBC, 0xDC, 0x62, 0xEA, 0xBC, 0xEC, 0xE8, 0x81, 0x33, 0x6C,
+    0x78, 0xF3, 0x95, 0x86, 0xF0, 0x15, 0xB7, 0x1F, 0x27, 0xA1, 0x9A, 0xBA, 0x27, 0xA9, 0x6D, 0x2D,
+    0xA1, 0xB1, 0xE1, 0x4A, 0x6F, 0xC8, 0xA8, 0x7A, 0xF7, 0x30, 0x90, 0xA1, 0x0C, 0x93, 0xE5, 0xBB,
+    0xA3, 0x9D, 0xF4, 0x5E, 0xA3, 0x77, 0x1B, 0x2F, 0xEA, 0x18, 0x62, 0x83, 0xBF, 0x4D, 0xB6, 0x4D,
+    0xE8, 0x95, 0x6D, 0xAD, 0xE7, 0x36, 0xBD, 0x8F, 0x86, 0xAB, 0x99, 0x44, 0x73, 0x3D, 0xE9, 0x90,
+    0x0C, 0x8B, 0x49, 0x47, 0x7B, 0xF3, 0x8C, 0x88, 0xAE, 0x0D, 0x98, 0x7A, 0x15, 0x7F, 0x07, 0xD4,
+    0x3D, 0x5F, 0x34, 0x20, 0x96, 0x31, 0x97, 0xAB, 0x1E, 0x8A, 0xAA, 0xA8, 0xD2, 0x8E, 0x83, 0x24,
+    0xA4, 0xF5, 0x29, 0x9E, 0x53, 0x0D, 0xBA, 0x72, 0x0E, 0xB1, 0x6A, 0x0C, 0xDD, 0xCB, 0xC6, 0x90,
+    0xD7, 0x46, 0xEB, 0x54, 0x74, 0x2D, 0x71, 0xF5, 0x4F, 0x58, 0x99, 0xBE, 0xA1, 0x35, 0xBF, 0x2B,
+    0xC2, 0xD4, 0xA5, 0x7C, 0x83, 0x94, 0x06, 0x91, 0x6E, 0x2A, 0x2D, 0xBC, 0x97, 0x50, 0x5A, 0x14,
+    0xCB, 0x25, 0x09, 0x1C, 0x12, 0x03, 0x43, 0x83, 0x5F, 0x58, 0xA9, 0xFB, 0x4B, 0xC6, 0x7E, 0xED,
+    0x3E, 0xDF, 0x6E, 0x26, 0xB5, 0x32, 0x6A, 0x3B, 0x0E, 0xDB, 0x9B, 0xE4, 0x0D, 0xDC, 0x12, 0xEF,
+    0x3F, 0x09, 0xA7, 0x4E, 0xB2, 0x93, 0x6D, 0x0C, 0xB5, 0x56, 0x7E, 0x9F, 0x50, 0x15, 0x9F, 0x35,
+    0xB7, 0xE8, 0x7E, 0xB0, 0xE8, 0xBB, 0xBF, 0x65, 0x0D, 0x74, 0x30, 0x4E, 0x4E, 0xA4, 0x29, 0x4D,
+    0x5E, 0xD3, 0xF0, 0x26, 0x9E, 0x56, 0xA1, 0x60, 0x94, 0xF2, 0x73, 0x58, 0x8B, 0xF8, 0x3E, 0x01,
+    0xAF, 0x4B, 0x92, 0xF2, 0x1C, 0x3D, 0x01, 0x9E, 0x69, 0xD8, 0x79, 0x5F, 0xC7, 0x82, 0x47, 0x75,
+    0x3D, 0x83, 0xF3, 0x77, 0x3C, 0x4E, 0x61, 0x50, 0xCD, 0x91, 0x71, 0x7D, 0x14, 0xE5, 0xD3, 0xA7,
+    0x2A, 0x97, 0x79, 0x1C, 0x91, 0x14, 0x66, 0x34, 0x9E, 0x91, 0x1C, 0xEE, 0x42, 0x2B, 0x82, 0x33,
+    0xF5, 0x8A, 0x5A, 0x50, 0xEB, 0x3B, 0xB5, 0x18, 0x93, 0x88, 0xD6, 0xD5, 0x5C, 0x1F, 0x55, 0xF7,
+    0x58, 0x73, 0xFC, 0x0A, 0xF9, 0xE2, 0x94, 0xF6, 0xE5, 0xEB, 0x73, 0xE8, 0x1C, 0x74, 0x43, 0xD7,
+    0x2D, 0x4A, 0x57, 0x95, 0x99, 0xF7, 0x81, 0x8D, 0x9C, 0x5A, 0xEA, 0x2D, 0xB4, 0x85, 0x4A, 0x74,
+    0x9D, 0x9F, 0xE6, 0xC2, 0xDB, 0x5A, 0xD5, 0x83, 0xC1, 0xB7, 0xEF, 0x55, 0xCA, 0xF5, 0x4A, 0xBD,
+    0x51, 0x3F, 0xF3, 0x3A, 0x7A, 0x7C, 0x2B, 0xAD, 0x1F, 0xFD, 0x24, 0x52, 0x22, 0x2C, 0xA4, 0x99,
+    0x6B, 0x6B, 0x85, 0xCD, 0x72, 0xA5, 0x51, 0x6F, 0xD3, 0xC4, 0x2E, 0x4D, 0xD4, 0x53, 0xEB, 0x6E,
+    0x52, 0x28, 0x94, 0x37, 0x2B, 0xE5, 0xC6, 0xEB, 0x65, 0xD1, 0x4E, 0xA4, 0xC1, 0x69, 0xD3, 0x43,
+    0xCD, 0x56, 0x8B, 0xE9, 0x8A, 0x71, 0x67, 0x19, 0xBA, 0xB3, 0x9A, 0x73, 0x85, 0x36, 0xDD, 0x8C,
+    0x76, 0xEE, 0xD5, 0xCA, 0xBB, 0xD7, 0xEB, 0xBB, 0xF5, 0x7A, 0xBB, 0x5E, 0x88, 0xA2, 0xED, 0x87,
+    0x5F, 0x94, 0xCB, 0xE5, 0x4A, 0x85, 0x22, 0x35, 0xEA, 0x64, 0xD3, 0xC6, 0xED, 0x61, 0x99, 0x7A,
+    0x40, 0x03, 0x75, 0x0A, 0xB6, 0x41, 0x62, 0x7C, 0x40, 0x5F, 0xFA, 0xFB, 0x08, 0x1A, 0x49, 0x14,
+    0xDB, 0xF5, 0x4E, 0xF2, 0xA1, 0xFC, 0x08, 0x9F, 0x50, 0xDF, 0x28, 0x14, 0xB6, 0x2A, 0xF6, 0x91,
+    0x25, 0x1C, 0x59, 0x4E, 0x3A, 0x9D, 0x7F, 0x00, 0xD5, 0x7D, 0x4F, 0x8C, 0x1C, 0x55, 0x9A, 0xE7,
+    0x8B, 0x08, 0xAA, 0x02, 0x88, 0x43, 0x78, 0x24, 0x7B, 0x9A, 0xC5, 0x9A, 0x8E, 0x3E, 0xB4, 0xB4,
+    0x34, 0x4B, 0x3B, 0xF6, 0xB0, 0x87, 0x1E, 0xC9, 0x99, 0x11, 0x86, 0x03, 0x07, 0x0E, 0xED, 0x96,
+    0x5C, 0x20, 0x35, 0xD2, 0x98, 0xC3, 0x1C, 0x68, 0x76, 0xB6, 0x6B, 0x0E, 0xBD, 0x12, 0x87, 0xCC,
+    0xCA, 0xA0, 0x91, 0xB6, 0x0F, 0x7D, 0xA0, 0x56, 0xEA, 0xDE, 0x3D, 0xEC, 0x01, 0x1F, 0x7C, 0x80,
+    0x42, 0x1A, 0xF7, 0x81, 0x83, 0xA7, 0x27, 0xAB, 0x32, 0x00, 0x69, 0x39, 0x70, 0xE8, 0x00, 0x96,
+    0xE9, 0xC3, 0x1C, 0x08, 0x06, 0x5B, 0xB3, 0xDB, 0xAD, 0x95, 0x03, 0x08, 0xAF, 0xA3, 0x70, 0x64,
+    0xC6, 0xFE, 0x7E, 0xDF, 0x17, 0x91, 0x7F, 0xCA, 0x65, 0x37, 0x2C, 0x36, 0x66, 0x0B, 0x32, 0xB2,
+    0xEC, 0xAA, 0x7C, 0xEF, 0xFB, 0xDE, 0xFB, 0xFE, 0xFC, 0xBE, 0x3F, 0xEF, 0xD9, 0x98, 0x33, 0xC6,
+    0x98, 0x21, 0x5E, 0x21, 0x5E, 0x7E, 0x6C, 0x8C, 0x93, 0xE2, 0x1B, 0xBC, 0xF3, 0xAF, 0x9A, 0x99,
+    0x89, 0xF0, 0xEA, 0x6F, 0x9C, 0x91, 0x5F, 0x19, 0xB7, 0xAF, 0x0A, 0xAF, 0xD2, 0x18, 0xAB, 0x30,
+    0xC6, 0x6E, 0x9A, 0xCC, 0x69, 0x9A, 0xD4, 0xB9, 0xBC, 0x11, 0x3B, 0x99, 0x31, 0x2E, 0x3E, 0xED,
+    0xE1, 0xE5, 0xF3, 0x95, 0x18, 0x13, 0x60, 0xA4, 0x60, 0x63, 0x03, 0x43, 0x35, 0x32, 0x94, 0x7E,
+    0x95, 0x27, 0xF1, 0xC2, 0x48, 0xC5, 0xF3, 0xA6, 0xFB, 0xBA, 0x03, 0x73, 0xE1, 0xBD, 0x8C, 0xF0,
+    0x3A, 0x36, 0xDA, 0x38, 0x2D, 0xEC, 0xF5, 0xF1, 0xEA, 0xE1, 0x35, 0x68, 0xC7, 0x9E, 0xEE, 0x18,
+    0xD3, 0x34, 0xB9, 0x69, 0x5E, 0xAB, 0x30, 0xFE, 0xD4, 0x2E, 0x4C, 0xDF, 0xC9, 0x4D, 0xC4, 0x97,
+    0x9B, 0x99, 0x3E, 0xC6, 0x1F, 0x62, 0xFC, 0xDA, 0x4F, 0x9C, 0xCA, 0x7F, 0xB4, 0xC9, 0x83, 0x47,
+    0x1B, 0xCC, 0x72, 0x84, 0xD4, 0x1E, 0xC3, 0x6B, 0x17, 0x54, 0x81, 0x32, 0x52, 0xE2, 0xE3, 0x8F,
+    0xF7, 0x74, 0x7C, 0x4C, 0x31, 0xF9, 0xF4, 0x96, 0x7C, 0xE0, 0xE5, 0xF0, 0x95, 0xEB, 0xA7, 0x0F,
+    0xE5, 0xA3, 0xDD, 0x91, 0xFE, 0x7C, 0x81, 0xCC, 0x64, 0x16, 0x1B, 0x0F, 0xEC, 0x9B, 0xE8, 0xD2,
+    0xF1, 0xD8, 0x70, 0x29, 0x6D, 0x0E, 0xCA, 0x91, 0xE4, 0xE3, 0xF2, 0x79, 0xF9, 0x30, 0x39, 0xC7,
+    0xAF, 0xC9, 0x63, 0x63, 0x23, 0xD6, 0x41, 0xE4, 0x11, 0xCD, 0x1F, 0x61, 0xDC, 0x7D, 0xC2, 0xAB,
+    0xAC, 0x6D, 0x59, 0x5B, 0x63, 0x46, 0x64, 0xD0, 0x9C, 0x6E, 0x27, 0x74, 0x9B, 0x4B, 0x18, 0xA4,
+    0x36, 0xB3, 0x53, 0xAF, 0x5B, 0x55, 0x4B, 0x72, 0xFB, 0xB2, 0x4B, 0x2E, 0x1F, 0x5E, 0x23, 0x8C,
+    0x10, 0xE0, 0x0F, 0x36, 0xE9, 0x19, 0x91, 0xF0, 0x96, 0x91, 0x8E, 0xA1, 0x30, 0xF9, 0x99, 0x35,
+    0xC1, 0xC0, 0x35, 0x88, 0xCA, 0x75, 0xEC, 0x50, 0x88, 0xE9, 0x8B, 0xD8, 0x8D, 0xE5, 0xFF, 0x8A,
+    0x6B, 0x83, 0xC5, 0xC4, 0xCA, 0x60, 0x74, 0xAC, 0x0B, 0x96, 0x05, 0xAB, 0x82, 0x31, 0x30, 0x04,
+    0x96, 0x04, 0x4C, 0x85, 0xDD, 0xE7, 0xF8, 0x35, 0xB8, 0x68, 0xC6, 0x95, 0x79, 0xBE, 0xE8, 0x64,
+    0xE7, 0x2B, 0x0E, 0x38, 0xDF, 0x80, 0x64, 0xB1, 0x01, 0xE1, 0xD2, 0x06, 0xF4, 0x5A, 0x15, 0xE1,
+    0x3E, 0xD6, 0x37, 0xDF, 0x4B, 0x37, 0x5B, 0x1D, 0x8A, 0xC3, 0x8C, 0xF0, 0x3F, 0xD6, 0x69, 0x82,
+    0x5F, 0xFF, 0x57, 0xA2, 0x54, 0x3E, 0x77, 0x05, 0x3F, 0xD3, 0xB7, 0x70, 0xE3, 0x6C, 0x22, 0x93,
+    0x50, 0xF3, 0x30, 0x4F, 0x20, 0xDC, 0xC9, 0xC4, 0x98, 0x4D, 0x36, 0xAA, 0x52, 0x1A, 0x4B, 0x33,
+    0x7A, 0x55, 0xA6, 0x1B, 0x61, 0x19, 0x31, 0xDB, 0xDE, 0x85, 0x8A, 0x4C, 0xD5, 0xF8, 0x0F, 0x73,
+    0x56, 0xA0, 0xCF, 0x4B, 0xC1, 0x30, 0x46, 0x4A, 0xF0, 0x4B, 0x3D, 0x0C, 0x88, 0xB7, 0x21, 0x46,
+    0xC2, 0xEF, 0xD6, 0xF8, 0x6B, 0x27, 0xB3, 0xAB, 0x3F, 0xC3, 0xEF, 0x66, 0x67, 0x8B, 0xA8, 0x14,
+    0x39, 0x8A, 0x32, 0x10, 0xB3, 0xBF, 0x50, 0x40, 0x63, 0x2E, 0x2A, 0xBF, 0x95, 0xBE, 0x95, 0xC2,
+    0x35, 0x99, 0x04, 0x29, 0xB6, 0xBE, 0x89, 0xB0, 0x55, 0xC2, 0x2D, 0x7E, 0x4E, 0xE1, 0xB5, 0xF6,
+    0x37, 0x9E, 0xBE, 0x1C, 0x53, 0x7E, 0x9A, 0x06, 0x3F, 0xE0, 0x5B, 0xC3, 0x9F, 0xFB, 0x49, 0x98,
+    0xE2, 0xE7, 0x41, 0xEC, 0xA5, 0xA0, 0x2F, 0xC0, 0xC4, 0x58, 0x96, 0x10, 0x6F, 0xD8, 0x80, 0x3E,
+    0x68, 0xC5, 0x02, 0x81, 0xC8, 0x14, 0x6B, 0x04, 0x22, 0x63, 0xF0, 0xBD, 0xBB, 0x3E, 0x23, 0x0D,
+    0x1C, 0xA5, 0xCF, 0xB7, 0x44, 0xF4, 0x97, 0x52, 0x5C, 0x1A, 0xD1, 0x60, 0x5D, 0x15, 0x59, 0x8C,
+    0x9E, 0x69, 0xB5, 0x58, 0xB6, 0x04, 0x7A, 0x1C, 0xF3, 0x13, 0x20, 0xB8, 0x79, 0xAD, 0x26, 0xC5,
+    0x7B, 0xA4, 0x37, 0x22, 0x19, 0xF2, 0xE8, 0x73, 0x6B, 0x7A, 0x5C, 0xA7, 0x01, 0x37, 0x67, 0xCC,
+    0xDD, 0xA9, 0xB9, 0xE4, 0x15, 0xF7, 0x88, 0x7C, 0x1A, 0x6B, 0xAE, 0x0E, 0xB2, 0xE8, 0x5C, 0x09,
+    0x8B, 0x4C, 0xB6, 0x96, 0x90, 0x93, 0xCB, 0xEA, 0xBA, 0xB9, 0x2C, 0x31, 0x88, 0x8E, 0x38, 0x39,
+    0xA4, 0x61, 0xCC, 0x35, 0xA9, 0x3C, 0x2C, 0x45, 0x09, 0x9D, 0xB2, 0xCA, 0x2D, 0x1A, 0x2A, 0xAA,
+    0x4B, 0x43, 0xB1, 0xB8, 0xCC, 0xEF, 0xB2, 0x31, 0x05, 0xA3, 0x47, 0xC9, 0x88, 0x28, 0x1A, 0x98,
+    0xD4, 0x4F, 0x44, 0x0A, 0x65, 0x4D, 0x40, 0x61, 0xC8, 0x95, 0xED, 0x8B, 0x3D, 0x51, 0x52, 0x74,
+    0x89, 0x75, 0xF5, 0x8D, 0x79, 0x5D, 0x9E, 0x27, 0xE5, 0x79, 0xCF, 0xF2, 0x8E, 0x45, 0xB2, 0x20,
+    0x0D, 0x9F, 0xD4, 0xC0, 0xA1, 0x71, 0xA7, 0x24, 0xCB, 0xDF, 0xE5, 0xB3, 0x3F, 0xE0, 0x5E, 0x8D,
+    0x31, 0x79, 0x69, 0x15, 0x15, 0x06, 0x77, 0x32, 0x6A, 0x84, 0xFF, 0x02, 0x95, 0x22, 0xA4, 0x6A,
+    0xE4, 0x03, 0x6A, 0x47, 0x56, 0x62, 0x32, 0xF7, 0xAD, 0x1C, 0x8B, 0xE4, 0xBD, 0xC3, 0xDD, 0xF2,
+    0x5F, 0x16, 0x4D, 0xD9, 0x15, 0x4D, 0xA9, 0xB8, 0x50, 0x61, 0x21, 0x2A, 0x93, 0xCA, 0x9C, 0xB1,
+    0xAC, 0x91, 0x93, 0xF9, 0xA4, 0x12, 0x7F, 0x61, 0xCD, 0xA8, 0x14, 0xA3, 0x7C, 0x61, 0xAA, 0x48,
+    0xBD, 0x55, 0x8A, 0xF2, 0x81, 0x03, 0xAC, 0x4D, 0xC9, 0xB5, 0xAD, 0xF8, 0xE9, 0x31, 0x09, 0x1E,
+    0x70, 0xE1, 0x7A, 0xE4, 0xB6, 0xCF, 0xD5, 0x0B, 0xA9, 0x35, 0x81, 0x68, 0xDF, 0x26, 0xB7, 0x61,
+    0x97, 0x3A, 0x59, 0x77, 0xB6, 0xCD, 0xCD, 0xE7, 0x5B, 0x13, 0x73, 0x32, 0x7C, 0xC3, 0xF5, 0x35,
+    0x34, 0x58, 0xE6, 0x68, 0xB7, 0x12, 0x3D, 0x1D, 0xB7, 0xCF, 0x19, 0x86, 0xC2, 0xB7, 0x3E, 0x30,
+    0x49, 0x45, 0x69, 0x20, 0xE7, 0x16, 0x59, 0x26, 0x55, 0x19, 0x06, 0x76, 0x53, 0x10, 0xE9, 0x51,
+    0x46, 0x7D, 0xE1, 0x39, 0x21, 0xCB, 0xB1, 0x4F, 0x59, 0x05, 0x25, 0x21, 0xF9, 0x8D, 0xE8, 0x4E,
+    0xB6, 0x28, 0x87, 0xB4, 0xE9, 0x30, 0x61, 0xA2, 0xDE, 0xFA, 0x50, 0x8B, 0x4B, 0xE5, 0xBD, 0x5F,
+    0x48, 0x90, 0xAD, 0x73, 0x2A, 0xB1, 0xA7, 0xFC, 0x09, 0x05, 0x33, 0xA4, 0x88, 0xF6, 0xF8, 0xA8,
+    0x4F, 0xF2, 0x37, 0x7A, 0xE4, 0xA8, 0x47, 0x43, 0xD1, 0xE7, 0x67, 0xFB, 0x34, 0xF3, 0x5C, 0x50,
+    0x68, 0x8C, 0x99, 0xF0, 0x31, 0xDB, 0xB9, 0x40, 0x5A, 0x83, 0x98, 0x0A, 0x14, 0x8B, 0xA9, 0x0A,
+    0x12, 0x3C, 0x28, 0x35, 0xE9, 0x50, 0x26, 0x05, 0x31, 0xB1, 0x7E, 0xA2, 0x0F, 0x57, 0x27, 0x66,
+    0x49, 0x95, 0x60, 0x6C, 0x5A, 0xCB, 0x24, 0x02, 0x6D, 0x7D, 0xFE, 0x2B, 0x71, 0x98, 0xB1, 0x71,
+    0x3E, 0x17, 0x83, 0xE1, 0x92, 0x6D, 0x10, 0x29, 0xC6, 0xC2, 0xE3, 0xC3, 0x4F, 0xF0, 0x47, 0xB1,
+    0x16, 0x90, 0xC3, 0x1C, 0xAC, 0x8E, 0x64, 0x74, 0xD2, 0x73, 0x89, 0xC4, 0xCF, 0xB6, 0x8D, 0x98,
+    0x7F, 0xD3, 0x7F, 0xB2, 0xE1, 0x44, 0x61, 0xA2, 0x9A, 0x23, 0x8F, 0x56, 0x73, 0x22, 0x48, 0xA8,
+    0x35, 0xE5, 0x44, 0x39, 0x75, 0x1F, 0xB3, 0xE5, 0xC7, 0x39, 0x11, 0x7E, 0xEE, 0x52, 0xD1, 0x30,
+    0xD1, 0x70, 0xFE, 0x99, 0x1A, 0x9F, 0xB1, 0xF9, 0xC1, 0xB3, 0x45, 0xE7, 0xA1, 0xF6, 0xEF, 0x94,
+    0xC7, 0xB4, 0x1B, 0xD5, 0x41, 0x79, 0x5E, 0x7E, 0xB2, 0xE4, 0x67, 0x38, 0x92, 0x97, 0x72, 0x2C,
+    0x78, 0xF4, 0x82, 0x9F, 0xE0, 0x78, 0xA1, 0x8C, 0xD8, 0x97, 0x31, 0x7B, 0x32, 0xEA, 0x40, 0xC6,
+    0x14, 0x92, 0x95, 0x4F, 0x7C, 0x30, 0x34, 0xAA, 0xA6, 0xFC, 0x05, 0xD9, 0x3C, 0xDA, 0xA0, 0x88,
+    0xBF, 0xBB, 0x36, 0xDB, 0xD8, 0xD8, 0x8D, 0x7D, 0xDA, 0xBD, 0x3C, 0xE0, 0x33, 0x0B, 0x45, 0x46,
+    0xFA, 0x22, 0x24, 0x3D, 0x91, 0x12, 0x79, 0xC6, 0xCF, 0xAA, 0xB0, 0xDC, 0x09, 0x54, 0xE5, 0x25,
+    0x76, 0x6E, 0xB6, 0x54, 0xA6, 0x6B, 0xCA, 0x37, 0x25, 0xDC, 0x2E, 0xC4, 0xDA, 0x9A, 0xD2, 0x4D,
+    0xE9, 0xED, 0xC7, 0x5E, 0x4A, 0xC5, 0x1A, 0xF8, 0x2F, 0x88, 0x81, 0xF7, 0x1F, 0xA7, 0x5E, 0x05,
+    0xC1, 0x0F, 0x53, 0xF5, 0x4A, 0x1D, 0x78, 0xC1, 0xD7, 0xD6, 0xD6, 0x16, 0x45, 0xA8, 0xEA, 0x85,
+    0xA2, 0x83, 0x03, 0xD1, 0xCC, 0x74, 0x4C, 0x0A, 0xA2, 0xB8, 0xA2, 0x9B, 0xDB, 0x35, 0x15, 0x27,
+    0xA8, 0x68, 0x59, 0xA0, 0xA0, 0x78, 0x60, 0xA1, 0xB8, 0xB4, 0x63, 0xB5, 0xB8, 0xC3, 0x0E, 0x0C,
+    0x25, 0x10, 0xEC, 0xD2, 0xFC, 0xE5, 0x3A, 0xB5, 0x79, 0xAF, 0xDD, 0x9D, 0x7E, 0xEB, 0x4E, 0xA9,
+    0x4F, 0x30, 0xD3, 0xF8, 0x9D, 0x08, 0xD3, 0x1E, 0xDB, 0x4C, 0x74, 0x83, 0xB9, 0x41, 0xCB, 0x9B,
+    0xEE, 0xE5, 0x3F, 0x03, 0xCC, 0x18, 0x81, 0xC2, 0x90, 0x26, 0xFE, 0xE8, 0x5D, 0xB7, 0x7C, 0xE6,
+    0xFB, 0x86, 0x76, 0xE9, 0x84, 0xF8, 0xC4, 0xE0, 0x8A, 0x98, 0x84, 0x99, 0x59, 0xFD, 0xBA, 0xBB,
+    0x14, 0x7E, 0x7D, 0xCE, 0xCA, 0xA7, 0xE6, 0x13, 0xCD, 0x64, 0x04, 0x33, 0x4F, 0xA7, 0x46, 0x9C,
+    0xBB, 0x11, 0xDF, 0xBE, 0xA4, 0x49, 0xB1, 0x68, 0x92, 0x08, 0x78, 0x28, 0x3B, 0xDB, 0x37, 0xEA,
+    0x98, 0xA9, 0x7C, 0x43, 0xA3, 0xC6, 0x42, 0x7D, 0xB3, 0x5A, 0x17, 0x7E, 0xA4, 0x14, 0x46, 0x0A,
+    0x59, 0xC0, 0xC2, 0x00, 0xBC, 0x60, 0x5A, 0x60, 0x17, 0x7A, 0xF5, 0x4C, 0x94, 0xB6, 0x5D, 0x6A,
+    0x4C, 0x34, 0x01, 0xDF, 0xA9, 0xB1, 0x68, 0xBC, 0xF0, 0x23, 0xBC, 0x8D, 0x80, 0xF7, 0xAE, 0x40,
+    0xE4, 0x60, 0x47, 0xC1, 0xE3, 0x6F, 0x61, 0xDE, 0xC0, 0xD1, 0xD5, 0x42, 0xAC, 0x31, 0xDE, 0xB0,
+    0xF0, 0x56, 0x01, 0xA7, 0x50, 0x63, 0xE4, 0xC2, 0xCE, 0x89, 0x68, 0x4A, 0x27, 0x25, 0xA2, 0x29,
+    0x3D, 0x6E, 0x41, 0x7A, 0x31, 0xB0, 0xE9, 0x22, 0x2E, 0xF6, 0xC5, 0x49, 0x0C, 0x06, 0x82, 0x68,
+    0x06, 0x25, 0xB6, 0xC1, 0x8F, 0x7B, 0x85, 0x20, 0x9A, 0x88, 0x88, 0x06, 0x6F, 0xA9, 0xB8, 0x8B,
+    0x28, 0xC6, 0x5B, 0xDF, 0x9C, 0xE8, 0xC0, 0xE3, 0x09, 0x85, 0xA4, 0x02, 0x4A, 0x87, 0x5C, 0x09,
+    0x01, 0xA6, 0xE2, 0x94, 0x04, 0x9C, 0x12, 0x9E, 0x5A, 0xD4, 0x51, 0x22, 0xA7, 0x82, 0xB8, 0x29,
+    0x87, 0xB6, 0x3F, 0x95, 0x09, 0x50, 0x15, 0xA8, 0x2A, 0x60, 0xD5, 0x4F, 0xBA, 0xD5, 0xC7, 0xB8,
+    0x01, 0x97, 0x30, 0x54, 0xD8, 0xDA, 0x5F, 0xC4, 0x06, 0x16, 0xD5, 0x42, 0x34, 0x38, 0xDA, 0xDE,
+    0x4C, 0x01, 0xCB, 0xBD, 0x1C, 0xF8, 0xDC, 0x29, 0x5C, 0x3A, 0x61, 0x8C, 0x62, 0x95, 0x62, 0xC9,
+    0x48, 0x58, 0x45, 0x77, 0x5D, 0x46, 0x7C, 0xF4, 0xB9, 0x0F, 0xDC, 0x00, 0x79, 0xE4, 0xFD, 0x6E,
+    0xC3, 0x69, 0x2B, 0x42, 0xEE, 0xDE, 0x9E, 0xF1, 0x4A, 0xB7, 0x52, 0xDB, 0x6E, 0x46, 0xB3, 0xB8,
+    0x45, 0x26, 0x9D, 0x37, 0xA4, 0xC1, 0xDE, 0xA8, 0xC9, 0x5B, 0xDD, 0xF9, 0x5A, 0x43, 0x5F, 0x6B,
+    0x2D, 0x7C, 0x6D, 0x21, 0x72, 0x2C, 0x62, 0x4C, 0x29, 0xA6, 0xAF, 0xF5, 0x16, 0xBE, 0x36, 0xA1,
+    0xAF, 0x8D, 0x3B, 0x5F, 0x1B, 0x92, 0xB7, 0xFE, 0x92, 0x27, 0x87, 0x03, 0x8A, 0xE9, 0x80, 0x08,
+    0x12, 0x9E, 0x9E, 0x72, 0x19, 0x47, 0x5C, 0xC1, 0xB0, 0x7D, 0x08, 0x98, 0x50, 0x07, 0x04, 0xC3,
+    0x87, 0x89, 0x20, 0x1E, 0x57, 0x9F, 0x2E, 0x69, 0xF2, 0x29, 0x01, 0xFB, 0x37, 0xB8, 0x69, 0x79,
+    0x48, 0x74, 0x14, 0xB4, 0x0A, 0xBA, 0x12, 0x5D, 0x7D, 0xA9, 0xF0, 0x6A, 0x35, 0x94, 0xFA, 0xF2,
+    0xE1, 0x15, 0xD7, 0x90, 0x80, 0xE2, 0xD8, 0xD3, 0x97, 0xCF, 0xDC, 0xD2, 0x91, 0xF5, 0x6F, 0x12,
+    0x79, 0x94, 0x37, 0xFA, 0xC4, 0xAF, 0x19, 0x72, 0x75, 0x5F, 0xD5, 0x1C, 0xFC, 0x98, 0x3F, 0xA7,
+    0x37, 0xC7, 0x12, 0x62, 0x84, 0xC9, 0xF5, 0xEB, 0x40, 0x05, 0x53, 0x27, 0x1B, 0x41, 0x18, 0xDD,
+    0x94, 0x7B, 0x4D, 0x81, 0xC6, 0x76, 0x63, 0xFF, 0x21, 0x5D, 0x09, 0xFD, 0x23, 0x2D, 0x4A, 0x9F,
+    0x70, 0x2B, 0xE5, 0xBE, 0x13, 0xE5, 0xF0, 0x3D, 0x8C, 0x7B, 0x10, 0x3D, 0x3F, 0x1B, 0xC2, 0x67,
+    0x38, 0xCD, 0x6C, 0x92, 0x13, 0x1B, 0x51, 0x14, 0xD6, 0xA7, 0x71, 0x87, 0x6E, 0x3A, 0x5C, 0x2C,
+    0x91, 0x6A, 0xC0, 0x25, 0x12, 0x30, 0x2F, 0x6E, 0xDD, 0xA5, 0xE2, 0x38, 0x19, 0x56, 0x52, 0xC4,
+    0x9B, 0xD6, 0xD5, 0x98, 0xEB, 0xFC, 0xFD, 0x49, 0xC7, 0x10, 0x25, 0x09, 0xCC, 0x30, 0xD9, 0xF1,
+    0x47, 0x7A, 0xD6, 0xB7, 0x19, 0xA7, 0x72, 0x0D, 0x87, 0x5C, 0xD4, 0x4A, 0x44, 0x57, 0x51, 0xD2,
+    0xD8, 0x48, 0x80, 0xA2, 0xCA, 0xF6, 0xA7, 0x50, 0xA6, 0x75, 0x18, 0xCA, 0xCC, 0xBE, 0x00, 0xCA,
+    0x0C, 0x81, 0x32, 0x4F, 0x87, 0xB4, 0x03, 0x51, 0x23, 0xCB, 0xA7, 0xE8, 0x5F, 0x1F, 0x59, 0x87,
+    0x38, 0xD7, 0x13, 0x31, 0x3B, 0x62, 0x85, 0xF1, 0x88, 0x8C, 0x18, 0x1C, 0x30, 0x2E, 0x61, 0xE3,
+    0x60, 0x55, 0x33, 0xF0, 0x88, 0x09, 0xEF, 0xB2, 0x6F, 0x15, 0xBA, 0x25, 0x56, 0x73, 0x7D, 0x31,
+    0x5C, 0xB6, 0x22, 0xD3, 0xAA, 0x1E, 0x2B, 0x9A, 0x11, 0x1A, 0xE0, 0x09, 0x9A, 0x30, 0x31, 0xD2,
+    0x8C, 0x1E, 0x31, 0xCB, 0x50, 0x23, 0xA8, 0xB1, 0x2E, 0xCC, 0x98, 0x1F, 0xAE, 0x65, 0xD5, 0xF1,
+    0xC0, 0x54, 0xB1, 0x18, 0xB4, 0x00, 0xCB, 0x60, 0x13, 0x2F, 0xD9, 0x85, 0xA3, 0x31, 0x98, 0x0C,
+    0x41, 0x48, 0xC2, 0x01, 0xB2, 0x36, 0x08, 0xF3, 0x14, 0x1D, 0xCA, 0x67, 0xC5, 0xC0, 0x71, 0x80,
+    0x80, 0x24, 0xC3, 0xC8, 0x6D, 0x3C, 0x79, 0x75, 0x63, 0x93, 0x4A, 0xD2, 0x08, 0xBE, 0xC1, 0xD7,
+    0xEC, 0xE6, 0x24, 0x65, 0xB7, 0x22, 0xC9, 0xDC, 0x8A, 0xA4, 0x5C, 0x86, 0xB8, 0x81, 0xA4, 0xB4,
+    0x23, 0xA9, 0x9A, 0x93, 0x14, 0x2B, 0x49, 0x67, 0x94, 0xA4, 0x4A, 0x48, 0x6A, 0x4A, 0xB3, 0x24,
+    0x89, 0xED, 0x9B, 0x5D, 0x98, 0x45, 0xF0, 0x66, 0xEC, 0xED, 0x50, 0xC0, 0x7A, 0x8C, 0x00, 0xF6,
+    0x26, 0xE9, 0x84, 0xD9, 0xAB, 0x8C, 0x5C, 0x53, 0xF3, 0xF9, 0x05, 0xC8, 0x8D, 0x5D, 0xD1, 0x8E,
+    0x81, 0xC6, 0x31, 0x06, 0x18, 0x33, 0xBA, 0x07, 0x68, 0xAD, 0x20, 0x3D, 0x85, 0x9F, 0x6E, 0x66,
+    0xB0, 0xF0, 0x71, 0x40, 0x68, 0x1E, 0x9A, 0x56, 0x06, 0x55, 0xB3, 0x8D, 0x18, 0x61, 0x95, 0x45,
+    0x10, 0x3B, 0x16, 0x62, 0x2A, 0xA3, 0x41, 0x0F, 0x48, 0xB1, 0x66, 0xE7, 0x19, 0xFD, 0xE3, 0xD3,
+    0x10, 0xC6, 0xCF, 0x27, 0xF0, 0x5A, 0x8C, 0x06, 0x28, 0x93, 0xC0, 0x1B, 0x90, 0x29, 0xB8, 0x87,
+    0x98, 0xB9, 0x03, 0x2A, 0xA2, 0x5D, 0x84, 0xA2, 0x45, 0x11, 0x2D, 0x33, 0xA2, 0x94, 0xE0, 0xD4,
+    0x04, 0xE0, 0x95, 0x88, 0x75, 0x00, 0x3E, 0x72, 0x0E, 0x7E, 0x98, 0x69, 0x5A, 0x86, 0xAF, 0x98,
+    0x8D, 0x73, 0x71, 0x26, 0xCE, 0xC3, 0xA0, 0x83, 0x73, 0x70, 0x06, 0x8E, 0xCF, 0xD1, 0xA1, 0xF8,
+    0x59, 0x70, 0x6A, 0x94, 0x2A, 0x12, 0xEE, 0xE2, 0xC6, 0x49, 0x23, 0x69, 0x04, 0xAC, 0xE0, 0x25,
+    0xB1, 0x44, 0x4C, 0xB0, 0x75, 0xD6, 0xD4, 0xCC, 0x6D, 0x77, 0xFB, 0x88, 0x34, 0x50, 0xC1, 0xE3,
+    0xD8, 0xC6, 0x68, 0x6E, 0x7F, 0x05, 0x76, 0xD6, 0x82, 0x5D, 0x3B, 0x53, 0xE6, 0x67, 0xE6, 0xAF,
+    0xAD, 0x09, 0x61, 0xE8, 0xD4, 0x48, 0xEE, 0x64, 0x91, 0xDF, 0x6A, 0x47, 0x9E, 0x54, 0x02, 0x5A,
+    0x18, 0xBD, 0xC0, 0xFE, 0x64, 0x9B, 0x0C, 0x59, 0xF6, 0x88, 0x4C, 0xC7, 0x96, 0x44, 0x8E, 0xC4,
+    0x4C, 0xD4, 0x6F, 0x1A, 0x45, 0x48, 0x15, 0xF5, 0x06, 0x26, 0x82, 0x9A, 0x53, 0xD9, 0x4C, 0x53,
+    0x00, 0x0A, 0xF3, 0xB3, 0x80, 0x70, 0x97, 0x37, 0xB9, 0xEA, 0x0E, 0x03, 0x00, 0x78, 0xDF, 0x54,
+    0x62, 0x06, 0x8F, 0x6F, 0xC0, 0xE1, 0x82, 0xA3, 0x52, 0x91, 0xAB, 0x30, 0xE6, 0xE2, 0x62, 0x0E,
+    0x04, 0x20, 0x25, 0x58, 0x05, 0xC8, 0xA1, 0x8F, 0xA5, 0x85, 0x69, 0x34, 0xDD, 0x20, 0xCF, 0xFB,
+    0x69, 0x72, 0x27, 0x4C, 0xAA, 0xCC, 0x10, 0xBF, 0x78, 0x19, 0x76, 0xB5, 0x8D, 0xD6, 0x9C, 0x42,
+    0x81, 0x58, 0xC0, 0xE0, 0x20, 0xA0, 0x59, 0xF0, 0x73, 0x1A, 0x3D, 0xC9, 0x29, 0x91, 0x24, 0x7B,
+    0x7F, 0x33, 0x86, 0x11, 0x0F, 0xC4, 0x9D, 0x73, 0x0D, 0xFB, 0x5C, 0xCD, 0x1E, 0x97, 0x65, 0xC8,
+    0x65, 0x69, 0x15, 0x25, 0xA4, 0xD1, 0x34, 0xC7, 0xF3, 0xEF, 0x9A, 0xA6, 0xBE, 0xE8, 0xEC, 0xFF,
+    0xB4, 0xF4, 0x32, 0xAF, 0x08, 0xB0, 0x41, 0xA1, 0xA0, 0x02, 0x27, 0xA7, 0x7A, 0x51, 0x27, 0xF8,
+    0xFB, 0x88, 0xDE, 0x92, 0x1A, 0xE6, 0x73, 0x0C, 0xB0, 0xB5, 0x65, 0x5F, 0xC1, 0xE2, 0x9F, 0x35,
+    0xFE, 0xF4, 0xDB, 0x8B, 0x0C, 0x89, 0x39, 0x0E, 0x34, 0x85, 0x55, 0x0E, 0xF6, 0x63, 0x66, 0x02,
+    0xBB, 0x94, 0x21, 0x6D, 0x97, 0xFF, 0x9F, 0xA6, 0xF0, 0x33, 0x4D, 0x12, 0xFC, 0x7D, 0x90, 0x85,
+    0x10, 0xE7, 0x28, 0xB6, 0x21, 0x62, 0x76, 0x31, 0xC4, 0x6B, 0xC0, 0x08, 0x83, 0x70, 0x17, 0x73,
+    0x01, 0x2F, 0x02, 0x79, 0x06, 0x71, 0x44, 0x0F, 0xD0, 0xD0, 0xFE, 0x67, 0xEA, 0x6F, 0x8E, 0x57,
+    0x64, 0xCC, 0x38, 0xFB, 0x9B, 0xA9, 0x2F, 0x7E, 0xC4, 0x05, 0x56, 0xE1, 0xEF, 0x86, 0xF1, 0x08,
+    0x2B, 0xC4, 0x18, 0xA3, 0x5E, 0xDB, 0x23, 0x4B, 0x34, 0xD9, 0x92, 0xF7, 0x8A, 0x00, 0x0B, 0x02,
+    0x8C, 0xE1, 0x72, 0xCF, 0x39, 0xC6, 0xE6, 0x25, 0xFA, 0x13, 0x63, 0x5F, 0x66, 0x9A, 0x52, 0x3C,
+    0x5F, 0x2C, 0xE2, 0x65, 0x43, 0x30, 0x36, 0x01, 0x1C, 0xE0, 0x63, 0xFC, 0x5C, 0x05, 0xAE, 0xD3,
+    0xD0, 0xC8, 0x3C, 0x84, 0x3D, 0x81, 0x27, 0xE8, 0xC6, 0x58, 0x83, 0xEC, 0x50, 0x90, 0x66, 0xDC,
+    0x77, 0xC2, 0x68, 0xA7, 0x0D, 0x56, 0xC4, 0x2D, 0xC1, 0xE8, 0xE6, 0x95, 0xD5, 0xD4, 0x95, 0x5B,
+    0x06, 0x15, 0xEC, 0x7D, 0x89, 0x75, 0x2C, 0xFB, 0xC2, 0xA7, 0x53, 0x8C, 0xC1, 0xE3, 0x58, 0xD6,
+    0x13, 0xA1, 0x14, 0xD6, 0x12, 0x0A, 0x85, 0xFF, 0xB0, 0x5C, 0xA0, 0xDD, 0xED, 0x12, 0xCB, 0xC7,
+    0xCB, 0x8E, 0x4F, 0xA8, 0x08, 0x83, 0x7F, 0x1F, 0x6B, 0x11, 0x9A, 0x3E, 0x5C, 0xB0, 0xF2, 0x99,
+    0xCC, 0xF5, 0x6D, 0xDC, 0xD1, 0x18, 0x3F, 0x84, 0x31, 0xAA, 0x39, 0x9F, 0xD6, 0xBE, 0xB9, 0x3F,
+    0x5E, 0x07, 0x19, 0xF8, 0x6C, 0x58, 0x99, 0xB3, 0x99, 0x6F, 0x66, 0xA7, 0x31, 0x77, 0xA0, 0xA0,
+    0x21, 0xD4, 0x10, 0x8B, 0xC9, 0x6D, 0xBC, 0xF5, 0x28, 0xCD, 0x44, 0xA0, 0x89, 0x04, 0xCB, 0xE2,
+    0x12, 0xF3, 0x3A, 0x10, 0x97, 0x53, 0x05, 0xE2, 0x20, 0x4A, 0xBE, 0x05, 0xA7, 0x0A, 0xAE, 0xD6,
+    0x96, 0x4D, 0xB9, 0x8F, 0x6A, 0x3B, 0x77, 0x61, 0x98, 0x61, 0x3F, 0x81, 0xB8, 0xEF, 0xD1, 0xA4,
+    0x94, 0x35, 0xD9, 0xC6, 0x32, 0x61, 0xB9, 0x7F, 0xBD, 0xD7, 0x6A, 0x6D, 0x6B, 0x28, 0x2C, 0xE8,
+    0x23, 0x48, 0xB3, 0x48, 0x9E, 0x20, 0xAA, 0xF1, 0x3C, 0x03, 0xBF, 0x0D, 0x98, 0x4A, 0xC9, 0x1F,
+    0x71, 0x5E, 0xAC, 0xAC, 0x9D, 0x98, 0x67, 0x99, 0x9F, 0x00, 0x51, 0x25, 0xB3, 0x13, 0x78, 0xC1,
+    0x56, 0xD8, 0x45, 0x20, 0x79, 0x26, 0x27, 0xEB, 0x4B, 0x60, 0x02, 0x38, 0x0E, 0xB2, 0xE0, 0xEF,
+    0xB0, 0x84, 0xA3, 0xB9, 0x28, 0x06, 0x9D, 0x28, 0x7E, 0xCF, 0x9C, 0x33, 0x27, 0x68, 0xF5, 0xFF,
+    0x1B, 0xD0, 0x66, 0x3B, 0xB0, 0xB9, 0x4D, 0x63, 0x9F, 0x37, 0x3F, 0x21, 0xC6, 0xB5, 0x0A, 0x42,
+    0x5B, 0x1F, 0x76, 0x34, 0x92, 0x78, 0xC9, 0x7D, 0x8F, 0x19, 0x55, 0x4E, 0x07, 0x4D, 0x7C, 0x11,
+    0x91, 0xC2, 0xA3, 0x74, 0x3A, 0x95, 0x08, 0x63, 0x24, 0xCE, 0x2A, 0xA4, 0x93, 0xC6, 0x1A, 0xEF,
+    0xEC, 0x6C, 0xAB, 0xB2, 0xDB, 0x9F, 0xBF, 0x96, 0x31, 0x2B, 0x93, 0x6A, 0x62, 0xD4, 0x9B, 0x03,
+    0x7D, 0xFF, 0x10, 0xA0, 0x3F, 0xA4, 0x40, 0x8E, 0xB1, 0x68, 0x36, 0xCD, 0x7B, 0x44, 0xAC, 0x1B,
+    0x25, 0x8A, 0xBC, 0xF0, 0x05, 0x0F, 0xF2, 0x70, 0x42, 0xC0, 0x3A, 0x4A, 0x19, 0x00, 0x35, 0x09,
+    0xA8, 0xB6, 0xAF, 0xC4, 0xCE, 0x87, 0xC6, 0xFD, 0xD0, 0x38, 0xEF, 0xC4, 0x88, 0x18, 0xDD, 0x77,
+    0x92, 0x00, 0xA0, 0xE1, 0xED, 0xA4, 0x07, 0x43, 0xF7, 0x62, 0x7A, 0x11, 0xD1, 0xD9, 0x63, 0x6F,
+    0x40, 0xEB, 0x7C, 0xE7, 0x7D, 0xC8, 0x64, 0x60, 0xFF, 0x3E, 0x05, 0xB1, 0xD6, 0x95, 0xB8, 0x14,
+    0x49, 0x2B, 0x31, 0x5D, 0x8D, 0x15, 0x3C, 0x69, 0xE8, 0x8F, 0xC0, 0xF4, 0x83, 0x86, 0x3F, 0x40,
+    0xD0, 0xC6, 0x94, 0x32, 0xE4, 0x87, 0xD1, 0xD0, 0x18, 0x8E, 0xB7, 0x82, 0xD1, 0x2C, 0xF9, 0xA2,
+    0x5D, 0xF2, 0x61, 0x96, 0xBA, 0xC5, 0x8C, 0x24, 0xFF, 0xC1, 0xEC, 0x07, 0xC4, 0x65, 0xAE, 0xBB,
+    0x67, 0x53, 0x2E, 0x19, 0xCD, 0x57, 0x24, 0xD8, 0x4C, 0xF5, 0x7F, 0xBC, 0xD0, 0x0D, 0xB1, 0x33,
+    0x43, 0xEA, 0x7F, 0x4C, 0xFD, 0xAF, 0x16, 0xFA, 0x7F, 0x6E, 0x33, 0x31, 0x9F, 0x36, 0x85, 0x75,
+    0xFD, 0x1F, 0x2B, 0xC4, 0xD2, 0xB5, 0x53, 0x89, 0x55, 0xAE, 0x61, 0x92, 0x65, 0x43, 0xE1, 0x5C,
+    0x8A, 0x55, 0x1A, 0xDC, 0x65, 0x1A, 0x12, 0xF3, 0x90, 0x07, 0xE9, 0x3B, 0xC9, 0x4C, 0xFC, 0xF0,
+    0xEA, 0x04, 0x56, 0x35, 0x09, 0x09, 0xF1, 0xB1, 0xD2, 0x4C, 0x03, 0x5B, 0x74, 0xF4, 0x36, 0xDD,
+    0xBC, 0xA0, 0x04, 0xC5, 0x08, 0x0C, 0x51, 0xE9, 0x03, 0x8C, 0x57, 0xF0, 0xE7, 0x15, 0xBE, 0x87,
+    0x05, 0xC3, 0xFE, 0x3E, 0x31, 0x23, 0x4E, 0x8A, 0x6F, 0x48, 0x47, 0x0F, 0x57, 0x73, 0xD2, 0xE6,
+    0xF8, 0x7E, 0xCB, 0xF6, 0x8F, 0xE9, 0x83, 0xC4, 0x71, 0x45, 0x87, 0xB8, 0xCD, 0x7A, 0x45, 0x95,
+    0xBF, 0x03, 0x55, 0x2E, 0x16, 0x26, 0xEB, 0x5C, 0x98, 0x1C, 0xCF, 0xCD, 0x27, 0x4D, 0x31, 0xA9,
+    0xAD, 0x6B, 0xFF, 0xE5, 0xFF, 0x5C, 0xDE, 0x85, 0xAD, 0x6A, 0xE2, 0x3E, 0xD8, 0x9F, 0x09, 0x8C,
+    0xAF, 0x4D, 0x9F, 0xDB, 0x60, 0x7A, 0x5C, 0x00, 0x33, 0x90, 0xE4, 0xD6, 0x18, 0x1E, 0x36, 0x37,
+    0xB5, 0x4F, 0xDF, 0x50, 0x31, 0xEF, 0x8E, 0x50, 0x9F, 0xB5, 0x01, 0x2C, 0x3A, 0x7F, 0xCE, 0x84,
+    0x80, 0x93, 0xB3, 0x3E, 0x80, 0xDF, 0x7A, 0xC8, 0x58, 0xE7, 0x40, 0xBD, 0xC0, 0x21, 0x49, 0x6C,
+    0x09, 0x26, 0x95, 0xCA, 0x48, 0x8F, 0x5C, 0x8E, 0xF9, 0x60, 0x70, 0xF9, 0x18, 0x93, 0x66, 0x8F,
+    0xB3, 0xD2, 0xC5, 0x74, 0x91, 0xF7, 0x12, 0xF1, 0xE3, 0xDF, 0xD1, 0x4A, 0x8C, 0xBB, 0xAC, 0xA7,
+    0x33, 0x87, 0xAD, 0xDE, 0x3C, 0x4E, 0x22, 0xBF, 0x7F, 0x26, 0xB9, 0x61, 0x5A, 0xC7, 0x51, 0xB2,
+    0x70, 0xBB, 0xB7, 0x0C, 0xCB, 0xD6, 0x69, 0x8D, 0x46, 0xE2, 0xF8, 0xF6, 0x66, 0x58, 0xBC, 0x01,
+    0x1D, 0xE6, 0xD8, 0x87, 0xC5, 0xAF, 0x5C, 0x88, 0x07, 0x82, 0xF0, 0xB1, 0x55, 0xE0, 0x61, 0xC3,
+    0xC7, 0xD6, 0xF4, 0xB0, 0x80, 0x4B, 0x7E, 0x32, 0xA6, 0xDF, 0x85, 0x59, 0xDB, 0x32, 0xE1, 0x3B,
+    0xFF, 0xBD, 0xA6, 0x3F, 0xA7, 0xD1, 0x99, 0xAD, 0xC4, 0x6C, 0x37, 0xAD, 0x20, 0x9C, 0x37, 0x0F,
+    0xB7, 0x90, 0xBE, 0x47, 0xBF, 0x15, 0x4A, 0x7A, 0x50, 0x82, 0xB2, 0x0B, 0xE4, 0x92, 0x59, 0x31,
+    0xA7, 0x9C, 0x43, 0x0A, 0xF2, 0x1B, 0xC9, 0x06, 0xF6, 0x58, 0x0A, 0x53, 0x07, 0x0F, 0xAD, 0x4D,
+    0x04, 0x96, 0x63, 0xC5, 0x57, 0x8C, 0x4D, 0x7A, 0x73, 0x63, 0x33, 0x5C, 0x35, 0x36, 0x49, 0xD4,
+    0xBC, 0x54, 0x06, 0x53, 0xAF, 0x34, 0xF1, 0x3C, 0x01, 0xD6, 0x46, 0x77, 0x06, 0x4A, 0x68, 0x6F,
+    0x47, 0x92, 0x3A, 0xEE, 0x3E, 0x07, 0x9E, 0xE1, 0xFF, 0xC6, 0x88, 0x66, 0xC6, 0x50, 0xFC, 0xD1,
+    0x05, 0x18, 0xAB, 0x59, 0xDF, 0xAC, 0x6F, 0x2F, 0x97, 0x38, 0x2B, 0x7D, 0xB1, 0x14, 0x96, 0x80,
+    0xCB, 0xEF, 0x11, 0x8A, 0x75, 0xE2, 0xE2, 0x2F, 0xC4, 0xA5, 0x9A, 0x8B, 0x0B, 0x7E, 0x1E, 0x76,
+    0x82, 0x92, 0x3A, 0xAD, 0xB8, 0xB0, 0x44, 0xE3, 0xC1, 0x3B, 0x47, 0x31, 0xE7, 0x9D, 0xC4, 0x51,
+    0xBA, 0xE5, 0x7C, 0x98, 0x5C, 0x4F, 0xA3, 0xE6, 0x89, 0x06, 0xA6, 0xA5, 0x76, 0x66, 0x60, 0x3F,
+    0xA6, 0x07, 0xBB, 0x53, 0xB3, 0xBC, 0x5D, 0x73, 0x16, 0xA7, 0x96, 0x59, 0xEA, 0x45, 0xE4, 0xB9,
+    0x12, 0x0E, 0x9A, 0x87, 0x77, 0x98, 0xA9, 0x30, 0xE6, 0xB9, 0xDD, 0xA5, 0x25, 0x10, 0x98, 0x0D,
+    0xE7, 0x0E, 0x81, 0xB0, 0xF6, 0x1F, 0x67, 0x88, 0x5C, 0x93, 0xA2, 0xF6, 0xBD, 0xB2, 0x98, 0xC9,
+    0x64, 0x78, 0x1E, 0xAA, 0xB3, 0xB0, 0xB7, 0xE1, 0x43, 0xB8, 0xE4, 0x3D, 0xBA, 0xC8, 0x01, 0x25,
+    0x75, 0x4C, 0x21, 0xAD, 0x25, 0x89, 0x15, 0x40, 0xAA, 0xCA, 0xB0, 0x81, 0x79, 0x0C, 0x7F, 0x34,
+    0x21, 0xF9, 0x21, 0x53, 0x27, 0xC1, 0x63, 0x7C, 0x70, 0x5F, 0x23, 0xE6, 0x5A, 0xF7, 0x60, 0xCE,
+    0x1B, 0x96, 0x8D, 0x9B, 0x1C, 0x1F, 0x3A, 0xAA, 0xDE, 0xE7, 0x86, 0x24, 0x2E, 0xC7, 0x0B, 0x10,
+    0xDE, 0x4A, 0xFE, 0xFB, 0x47, 0x13, 0xC3, 0x80, 0x98, 0x7A, 0x49, 0x00, 0xD4, 0x3F, 0x04, 0xC0,
+    0xA8, 0x87, 0x85, 0xA3, 0xFF, 0xF5, 0xB4, 0xD5, 0xAD, 0xA0, 0x8D, 0xDB, 0xB0, 0xAC, 0x44, 0xDC,
+    0xE2, 0xBE, 0x43, 0xB3, 0xB0, 0x33, 0xB5, 0x39, 0xE2, 0xB0, 0x82, 0x96, 0x49, 0x0C, 0xD2, 0x7A,
+    0xB0, 0xE3, 0x97, 0xB8, 0x68, 0x50, 0x0C, 0x78, 0xB1, 0xAB, 0xA3, 0x98, 0x7E, 0x8C, 0x5B, 0x44,
+    0x48, 0xA5, 0xFE, 0x8C, 0x1B, 0xE1, 0x64, 0x2E, 0x67, 0xCE, 0xE8, 0xD1, 0x19, 0x12, 0x69, 0xAC,
+    0xC6, 0x94, 0xB8, 0x1F, 0x8F, 0xC5, 0x3D, 0x11, 0xBE, 0x90, 0x46, 0xD6, 0x16, 0x09, 0x61, 0x7A,
+    0x0A, 0x62, 0x14, 0xC6, 0x58, 0x3B, 0xAF, 0x68, 0xE5, 0x78, 0xA7, 0x82, 0x5D, 0xAD, 0xB0, 0xF5,
+    0x25, 0xE2, 0x10, 0xF1, 0x9A, 0xD6, 0x14, 0x7F, 0x9A, 0xC8, 0x72, 0xA7, 0x66, 0x0B, 0x6B, 0x52,
+    0x4B, 0x7C, 0x93, 0x80, 0x8A, 0x98, 0x75, 0xC0, 0x3D, 0x72, 0xB0, 0xD6, 0x86, 0xA6, 0x52, 0x60,
+    0x2C, 0xDA, 0x02, 0xD8, 0x91, 0x16, 0x65, 0x7E, 0x75, 0x88, 0x24, 0x5F, 0x27, 0x30, 0x77, 0x1F,
+    0x93, 0x3C, 0xE2, 0xCE, 0x01, 0xEC, 0x6D, 0x1B, 0xBB, 0x85, 0x3E, 0xF6, 0x64, 0x07, 0x7F, 0xDF,
+    0x18, 0x6B, 0x77, 0xA3, 0xD5, 0x46, 0x30, 0x56, 0x4E, 0x72, 0xEB, 0x5A, 0x83, 0xD0, 0x21, 0xA9,
+    0x9D, 0x29, 0xDC, 0x58, 0x29, 0xAE, 0x4C, 0xDD, 0x29, 0x4C, 0x86, 0x9A, 0x0B, 0xBA, 0xB2, 0x55,
+    0x73, 0xD1, 0xBF, 0x21, 0x4F, 0x84, 0x49, 0xEE, 0x01, 0xD6, 0x0A, 0xA0, 0x0D, 0x01, 0xED, 0xEE,
+    0x1A, 0xE5, 0x29, 0xD1, 0x9D, 0x27, 0xD4, 0xE3, 0xDA, 0xB5, 0xF4, 0xDC, 0x0E, 0xE8, 0x7B, 0x0B,
+    0x7F, 0x36, 0x82, 0xCF, 0x9A, 0x68, 0x74, 0x78, 0x60, 0x6D, 0x0E, 0xF8, 0x33, 0xD0, 0x01, 0xB0,
+    0x69, 0xBC, 0xAB, 0x3F, 0x5D, 0x68, 0x01, 0xDE, 0xDD, 0x79, 0x03, 0x01, 0x55, 0xA4, 0x68, 0xF3,
+    0x49, 0x1A, 0x50, 0x6E, 0x8B, 0x76, 0x2A, 0x46, 0x94, 0xFC, 0xE3, 0x3D, 0x82, 0x9B, 0x1F, 0x32,
+    0x6A, 0xB6, 0x4B, 0xE6, 0xBC, 0x10, 0x73, 0x01, 0x8B, 0x32, 0xF1, 0x23, 0x11, 0x56, 0xCC, 0xAA,
+    0x5A, 0x9F, 0x9C, 0x9C, 0x8A, 0xED, 0xCF, 0x52, 0xE7, 0x5F, 0x52, 0xEB, 0xE7, 0xDD, 0x1E, 0x9F,
+    0x97, 0xC6, 0x80, 0x42, 0x1A, 0x03, 0xB4, 0x2B, 0x80, 0x39, 0x49, 0x49, 0xA9, 0x13, 0x7B, 0x29,
+    0xEE, 0x6A, 0x53, 0xF7, 0xBD, 0xB6, 0xDC, 0x8A, 0x6F, 0xB7, 0x4C, 0x3B, 0xE3, 0xA1, 0x43, 0xA4,
+    0x87, 0x0C, 0xD1, 0xEF, 0x86, 0x18, 0x2C, 0x1A, 0x12, 0x9E, 0x2A, 0x98, 0x41, 0x9B, 0x90, 0x16,
+    0x02, 0x41, 0x66, 0x6E, 0x25, 0xA3, 0x66, 0x7F, 0x7E, 0x21, 0x35, 0x1A, 0x2C, 0x1A, 0x0D, 0x16,
+    0xC5, 0x45, 0x4A, 0x4A, 0x06, 0x52, 0x78, 0x61, 0x9B, 0x1B, 0x16, 0xB2, 0x14, 0x17, 0x88, 0xA5,
+    0x10, 0xF6, 0x5A, 0x70, 0x28, 0xF9, 0x29, 0xC9, 0x00, 0x31, 0x19, 0x10, 0x11, 0x22, 0xC2, 0x00,
+    0x11, 0x24, 0x32, 0x80, 0x02, 0x4C, 0x74, 0xDA, 0x00, 0xFB, 0xA8, 0x90, 0xFE, 0x90, 0x2C, 0xEA,
+    0x40, 0xD4, 0x6A, 0x2C, 0x2E, 0xA6, 0x12, 0x27, 0x23, 0x99, 0x7F, 0x2E, 0xBB, 0x7B, 0xF9, 0xC9,
+    0xFD, 0x33, 0xF4, 0x9E, 0xB0, 0x26, 0xDE, 0x1F, 0x5E, 0x43, 0x14, 0x0F, 0x3B, 0x96, 0x39, 0x84,
+    0x56, 0x99, 0x48, 0x64, 0xC6, 0x1C, 0x01, 0xAD, 0x04, 0x41, 0x92, 0x07, 0xD9, 0x04, 0x13, 0x2C,
+    0x70, 0x8D, 0xA6, 0xF3, 0x3A, 0xFA, 0xAD, 0x34, 0xE0, 0xC1, 0xC4, 0x94, 0x4D, 0x69, 0x5D, 0xFB,
+    0x63, 0x6D, 0x37, 0x30, 0xC2, 0xB5, 0x61, 0x99, 0x63, 0x01, 0x28, 0xA9, 0x01, 0x2D, 0x3A, 0xF7,
+    0x0F, 0x71, 0x98, 0x18, 0xE1, 0x8C, 0x46, 0xF7, 0x74, 0x8C, 0x5C, 0xA7, 0x13, 0x8B, 0x8C, 0xE4,
+    0x57, 0x45, 0xE7, 0x56, 0xAC, 0xC3, 0x8A, 0xC5, 0xB9, 0xD8, 0x16, 0xDC, 0xEF, 0xB9, 0x7D, 0xD1,
+    0x83, 0x39, 0xB7, 0x0E, 0x82, 0x0B, 0x52, 0x3D, 0x65, 0xCE, 0x22, 0xAA, 0x97, 0x16, 0xEC, 0x2E,
+    0x60, 0xB1, 0xDB, 0xC2, 0xD4, 0xDF, 0xDC, 0xD8, 0x13, 0x13, 0xA8, 0xC4, 0x87, 0xF2, 0x83, 0x2A,
+    0xE2, 0x9B, 0xD4, 0x1C, 0x98, 0x4D, 0x89, 0xB4, 0x7D, 0x44, 0xBA, 0x4C, 0x88, 0x65, 0x2C, 0xA6,
+    0x59, 0xFB, 0x24, 0x9B, 0xF5, 0x70, 0x97, 0x45, 0xA2, 0x88, 0x00, 0x8B, 0x3A, 0x1E, 0xD6, 0x52,
+    0xB9, 0x3A, 0x59, 0x4B, 0x5E, 0xB3, 0x1A, 0xB3, 0x78, 0x64, 0x15, 0x74, 0xDC, 0xC1, 0x63, 0xD9,
+    0x10, 0xE2, 0x12, 0x3C, 0x91, 0xD2, 0x82, 0xFB, 0x2F, 0xC5, 0x11, 0x53, 0x1D, 0x57, 0x4C, 0xC8,
+    0xB2, 0x55, 0x2D, 0x26, 0x11, 0x43, 0xF9, 0x9A, 0x21, 0xF7, 0xE7, 0x95, 0x22, 0x60, 0x28, 0xEC,
+    0xC0, 0x79, 0xA9, 0x6E, 0x94, 0x5C, 0x60, 0xAB, 0x45, 0x1E, 0xF2, 0xCC, 0xFA, 0x92, 0x9E, 0xED,
+    0x4B, 0x1C, 0x06, 0x55, 0x4A, 0x02, 0x6C, 0xC2, 0x04, 0xDF, 0x85, 0xD6, 0x75, 0xF0, 0x1E, 0x3A,
+    0xEF, 0xA4, 0x88, 0x11, 0xFC, 0xC7, 0xDF, 0xC4, 0x90, 0x7F, 0xE5, 0xBC, 0x8D, 0x79, 0xC7, 0xCE,
+    0x95, 0xD8, 0x78, 0x25, 0x4D, 0x97, 0xAA, 0xD0, 0x32, 0xEC, 0x62, 0x41, 0x9F, 0x89, 0xCB, 0x27,
+    0xAF, 0x9E, 0x59, 0xAD, 0x5D, 0x8B, 0x51, 0x6D, 0x8C, 0xFF, 0xC1, 0x08, 0xC6, 0xCA, 0xCB, 0xE0,
+    0x78, 0x33, 0xAA, 0x55, 0x28, 0xEB, 0x21, 0x39, 0x8D, 0x64, 0xF8, 0x64, 0x23, 0x99, 0x1F, 0xD6,
+    0x24, 0xDA, 0xAF, 0x73, 0x21, 0xD9, 0xF8, 0x84, 0x39, 0x21, 0xEB, 0xDA, 0xE5, 0x9A, 0x51, 0x3B,
+    0x67, 0x02, 0x22, 0x1A, 0x18, 0x4D, 0xE9, 0x30, 0x6B, 0x5F, 0x4B, 0x72, 0x17, 0x0A, 0x89, 0x3D,
+    0x6D, 0x9A, 0x82, 0xCE, 0xC4, 0x16, 0x77, 0xC2, 0xF2, 0x0F, 0x9F, 0x4C, 0x82, 0x72, 0x33, 0x88,
+    0x7A, 0x22, 0x1A, 0x74, 0xB6, 0x22, 0x84, 0x33, 0xB3, 0xDC, 0xEA, 0x22, 0x6C, 0x6C, 0x62, 0xEA,
+    0x31, 0x75, 0x97, 0xF1, 0x45, 0x70, 0xF5, 0x5B, 0x29, 0x3B, 0x90, 0x62, 0x31, 0xCD, 0xB5, 0x24,
+    0x3A, 0x45, 0xC8, 0xEC, 0xC2, 0xD5, 0x4C, 0xB5, 0x24, 0x92, 0x1D, 0xB5, 0x5C, 0x2E, 0x8D, 0x47,
+    0xAA, 0x36, 0x24, 0x25, 0x9F, 0x6C, 0x54, 0x90, 0x26, 0x06, 0xDA, 0xB1, 0x48, 0x73, 0xF6, 0x6D,
+    0x5E, 0xAF, 0x45, 0xE4, 0x41, 0xDB, 0x05, 0x95, 0x89, 0xE7, 0x70, 0x59, 0x32, 0x19, 0x68, 0xE5,
+    0x69, 0x4C, 0xF7, 0x92, 0xCD, 0xB3, 0xFD, 0xE7, 0xC5, 0x0F, 0x95, 0x58, 0x1D, 0xE2, 0x97, 0xE9,
+    0x8F, 0x41, 0x01, 0xD3, 0x30, 0xB6, 0x68, 0x95, 0x74, 0xA3, 0xA8, 0x74, 0x09, 0x11, 0x92, 0xFA,
+    0xC6, 0x18, 0xC4, 0x2F, 0x46, 0xE0, 0x32, 0x09, 0x18, 0xCB, 0xFC, 0xDA, 0xF2, 0x48, 0x0F, 0xD5,
+    0x17, 0x1F, 0xD5, 0x53, 0x2F, 0xD5, 0x19, 0x13, 0x69, 0x00, 0x92, 0x7A, 0x48, 0xDD, 0x05, 0x00,
+    0xFE, 0x4F, 0xF9, 0x11, 0xDA, 0x1B, 0xA9, 0x8B, 0x33, 0x4B, 0x02, 0x9D, 0x31, 0xDA, 0xF7, 0xE0,
+    0x31, 0x85, 0xE2, 0xBF, 0xFC, 0x32, 0x74, 0xD6, 0x7F, 0x22, 0x35, 0x43, 0x9F, 0xC8, 0x26, 0x60,
+    0xCF, 0x41, 0x48, 0x5B, 0xD9, 0xA7, 0x6D, 0xEF, 0xD1, 0x8A, 0x9E, 0xA4, 0x0E, 0x0C, 0x2C, 0x84,
+    0xBE, 0x17, 0x69, 0x6E, 0x61, 0x0E, 0x59, 0xB9, 0x64, 0xBD, 0xD2, 0x5C, 0xCB, 0x8D, 0xFD, 0x29,
+    0x3C, 0xCA, 0xBB, 0x10, 0xB0, 0x17, 0x0A, 0x41, 0x55, 0x2C, 0x7F, 0x8D, 0x2F, 0x56, 0xA6, 0xAC,
+    0x20, 0xF6, 0x25, 0x4C, 0x64, 0x31, 0xC0, 0x8F, 0x7A, 0x81, 0x9D, 0xF7, 0xFA, 0x14, 0xD8, 0x81,
+    0x50, 0x3A, 0x16, 0x52, 0x2B, 0xA1, 0xB5, 0x24, 0xB1, 0xCC, 0xFC, 0xFF, 0x1D, 0x8D, 0x3B, 0xC8,
+    0x65, 0x37, 0x98, 0x74, 0x3A, 0xD4, 0x81, 0x98, 0x78, 0x3F, 0x76, 0xD5, 0xB8, 0xF3, 0x99, 0xF8,
+    0x1F, 0x9C, 0x7D, 0xF9, 0x65, 0xC8, 0x21, 0xA9, 0x06, 0xF4, 0x04, 0xD9, 0x01, 0xE9, 0xCE, 0x42,
+    0x21, 0xBC, 0x2F, 0x94, 0xF7, 0x85, 0xF4, 0xA1, 0x9F, 0x80, 0xF6, 0x81, 0x10, 0x3F, 0x56, 0xEA,
+    0xCF, 0x93, 0x7C, 0x10, 0x49, 0xB4, 0x3F, 0x01, 0x86, 0xB4, 0x3E, 0x83, 0x73, 0x70, 0x3E, 0x66,
+    0xDE, 0xF7, 0xCD, 0x1C, 0x32, 0xF1, 0xF3, 0x42, 0x76, 0x81, 0x33, 0x41, 0x14, 0xEB, 0xAA, 0x04,
+    0xED, 0x65, 0xE5, 0x3F, 0x96, 0x17, 0x55, 0xE0, 0xBD, 0x51, 0x8C, 0x43, 0xFF, 0xD1, 0x7C, 0xD0,
+    0xC7, 0x3C, 0x83, 0xDE, 0xD0, 0xC9, 0x7A, 0x92, 0x81, 0x2A, 0xBA, 0xE7, 0xD5, 0x8D, 0xB3, 0x99,
+    0xB0, 0x20, 0xB5, 0x63, 0x09, 0x99, 0x25, 0xAB, 0xDB, 0x17, 0x89, 0x0B, 0x45, 0x62, 0xFC, 0x3D,
+    0x4D, 0x1C, 0x27, 0xB2, 0xDF, 0x34, 0x3D, 0x2F, 0xBE, 0xC7, 0x6C, 0xAE, 0x9B, 0xD5, 0xD2, 0xEF,
+    0x40, 0x33, 0x44, 0xDB, 0x45, 0xF1, 0x60, 0x8E, 0xD1, 0x8F, 0xD9, 0x26, 0x17, 0xB0, 0x3A, 0x9D,
+    0x88, 0xD1, 0x87, 0x18, 0xF6, 0x5A, 0x27, 0x60, 0xEE, 0xDF, 0x01, 0x6A, 0x0D, 0xD9, 0x31, 0xE2,
+    0xEF, 0xBC, 0x56, 0x68, 0x25, 0x80, 0xA9, 0x8C, 0xA5, 0x12, 0x12, 0xE1, 0xB0, 0x89, 0x26, 0xF0,
+    0xC0, 0x55, 0x9F, 0x5A, 0xD5, 0x63, 0x16, 0x7D, 0xC0, 0xD2, 0xC1, 0xC0, 0xC5, 0xF2, 0x5D, 0x64,
+    0x56, 0xB2, 0x74, 0xB2, 0xA1, 0x29, 0xA0, 0xE9, 0x03, 0x5B, 0x8A, 0x04, 0x63, 0xE5, 0xA7, 0x02,
+    0x43, 0x4F, 0xE7, 0xC4, 0x2B, 0x10, 0x76, 0x51, 0x22, 0x26, 0x41, 0xC0, 0x57, 0x2D, 0xBD, 0x6A,
+    0xDA, 0xA5, 0xC8, 0x66, 0x0C, 0x96, 0x8A, 0x9A, 0x56, 0x89, 0xB6, 0x55, 0x89, 0xB0, 0x9B, 0x1F,
+    0x9C, 0x7D, 0xFF, 0x93, 0x9A, 0x54, 0x13, 0x9D, 0x83, 0x0D, 0x2E, 0x57, 0xC0, 0xFA, 0x00, 0xCC,
+    0x05, 0x93, 0xEB, 0x7D, 0xE6, 0x03, 0x68, 0xB6, 0xFA, 0x54, 0xC2, 0x3E, 0x1B, 0x57, 0x19, 0x45,
+    0x0C, 0xC8, 0x67, 0x64, 0xC6, 0xA1, 0x60, 0x75, 0x73, 0x5E, 0x78, 0x2C, 0x83, 0x06, 0x01, 0x4C,
+    0x49, 0x2E, 0xA1, 0x3D, 0x29, 0xC3, 0x30, 0x9A, 0x1F, 0x22, 0xF4, 0x9A, 0x54, 0xFC, 0x43, 0x21,
+    0xB3, 0x4F, 0x39, 0x39, 0x78, 0xC5, 0xCE, 0x81, 0x59, 0x6C, 0x26, 0xB8, 0xC5, 0xDE, 0x9D, 0x84,
+    0x88, 0x08, 0xBF, 0x21, 0x18, 0x86, 0x88, 0xC0, 0x32, 0x83, 0x98, 0x1E, 0x11, 0xBE, 0x31, 0x7F,
+    0x2D, 0x5D, 0x34, 0xEC, 0x01, 0x0D, 0xA8, 0x66, 0x1E, 0x3D, 0x02, 0xF3, 0xEB, 0xAC, 0x5D, 0x98,
+    0x60, 0x3B, 0x4C, 0xE1, 0x4F, 0x5B, 0x90, 0xB3, 0xD2, 0x48, 0x25, 0x2E, 0x6A, 0x8F, 0xBF, 0x27,
+    0xA5, 0x6C, 0xEC, 0xE7, 0xDA, 0xD3, 0xD5, 0x6A, 0x0D, 0xE0, 0xC0, 0x83, 0x1A, 0x09, 0x53, 0x6F,
+    0x36, 0xA1, 0xB5, 0x1E, 0xEB, 0x83, 0xC1, 0xFF, 0x8A, 0x97, 0xEB, 0xB1, 0xD1, 0x1F, 0x66, 0x89,
+    0x76, 0x59, 0x5A, 0x3B, 0x3B, 0x69, 0x57, 0x29, 0x87, 0x76, 0xBB, 0x2F, 0x60, 0xC5, 0x3F, 0xBE,
+    0x24, 0xF5, 0xBF, 0x75, 0x29, 0xCF, 0xC0, 0xE3, 0x3E, 0xD5, 0xA5, 0x70, 0x5B, 0x17, 0x76, 0x1C,
+    0x9B, 0x30, 0x33, 0xB2, 0x11, 0x42, 0xA0, 0x14, 0x58, 0xDB, 0x46, 0x1C, 0x30, 0xF1, 0xEF, 0x67,
+    0x82, 0x8B, 0xA3, 0x5F, 0xA9, 0xC5, 0x17, 0xAC, 0x0B, 0x53, 0xAF, 0x5D, 0x34, 0x96, 0xD4, 0x92,
+    0x3C, 0x29, 0x7A, 0x6A, 0xC6, 0x9F, 0xC9, 0x7F, 0xFE, 0x17, 0x1A, 0xDD, 0x87, 0x50, 0x00, 0x5C,
+    0x5F, 0x30, 0x6A, 0x4F, 0xAA, 0x58, 0x43, 0x8C, 0x33, 0x94, 0x16, 0x0D, 0x08, 0x84, 0xC5, 0xB2,
+    0x36, 0xA3, 0xD2, 0x28, 0x29, 0xB1, 0x94, 0x6C, 0x2D, 0x92, 0x24, 0x2D, 0xE9, 0xFB, 0xD6, 0xD5,
+    0x45, 0x7D, 0x49, 0xD6, 0x50, 0xD7, 0xAF, 0x7D, 0xFA, 0x4B, 0x29, 0x16, 0xC9, 0x1A, 0x38, 0xD9,
+    0x8D, 0xFD, 0x6A, 0x80, 0x95, 0xF6, 0x76, 0x60, 0xCE, 0xC1, 0xED, 0x58, 0xAC, 0x52, 0x88, 0xF8,
+    0xD0, 0xFB, 0xF7, 0x68, 0x1C, 0xA0, 0xDD, 0x01, 0x83, 0xE3, 0x90, 0xC9, 0x3F, 0x92, 0x01, 0x6B,
+    0x5A, 0xC2, 0x33, 0x59, 0x90, 0x94, 0x3E, 0xC3, 0xC4, 0x88, 0xB8, 0x2A, 0x7C, 0xEB, 0xBD, 0x5A,
+    0x7B, 0x3F, 0x6C, 0xA9, 0xCD, 0xDE, 0xAC, 0x8E, 0x78, 0xB0, 0xCC, 0x6E, 0x4B, 0xFD, 0x8A, 0x59,
+    0x99, 0xE6, 0xD4, 0x24, 0xA1, 0xD7, 0x4F, 0xBD, 0x1C, 0x8E, 0x8B, 0xAA, 0x56, 0x40, 0xD3, 0xC5,
+    0x29, 0xD9, 0x05, 0xDB, 0x52, 0x8A, 0x09, 0xF5, 0x46, 0x1E, 0xB3, 0x1D, 0x88, 0x2A, 0x5D, 0x5B,
+    0x5E, 0x33, 0xEB, 0x5E, 0x1B, 0xB5, 0xE8, 0x61, 0xB2, 0xC5, 0x1D, 0x8F, 0x62, 0x6B, 0x8A, 0x08,
+    0xC8, 0x13, 0xB7, 0x9A, 0xB1, 0x90, 0xDF, 0xC1, 0xAA, 0xE3, 0xFF, 0x53, 0xAA, 0x4A, 0xAC, 0x1A,
+    0x78, 0x30, 0x4A, 0x41, 0x42, 0xB6, 0x34, 0xF3, 0x38, 0xC2, 0xB0, 0x7C, 0x75, 0x59, 0xF9, 0x81,
+    0x64, 0x55, 0x16, 0x99, 0x47, 0xBB, 0xF5, 0x39, 0x80, 0x80, 0x7E, 0xCE, 0x56, 0x2F, 0xF6, 0xED,
+    0x4D, 0xB5, 0xEB, 0xA5, 0x6F, 0xA4, 0x00, 0x83, 0xE5, 0x17, 0x24, 0x21, 0x45, 0x5C, 0x71, 0x68,
+    0xE2, 0x55, 0xFC, 0x98, 0xF4, 0x9D, 0x9A, 0x23, 0xB5, 0x17, 0x89, 0xD4, 0x7E, 0x29, 0x48, 0x0D,
+    0x34, 0x79, 0x57, 0x3A, 0x77, 0xA2, 0xD5, 0xF6, 0x79, 0x52, 0xE9, 0x59, 0xC0, 0x3F, 0x00, 0xAD,
+    0x62, 0x80, 0xD1, 0x86, 0x22, 0x19, 0x63, 0xBC, 0x2A, 0xCD, 0xBB, 0xB2, 0xE9, 0x06, 0xBB, 0x18,
+    0xB2, 0x11, 0x04, 0x6B, 0x1B, 0xC0, 0x09, 0xF9, 0x43, 0x6D, 0x32, 0xF4, 0x39, 0x11, 0x06, 0x58,
+    0x23, 0xC7, 0xFE, 0x5B, 0x04, 0x1A, 0xEF, 0x4A, 0xA2, 0x9F, 0xFA, 0xF7, 0xFA, 0xF7, 0x19, 0x37,
+    0x77, 0x1D, 0xA3, 0x5F, 0x1B, 0x2F, 0x67, 0x8E, 0x41, 0x27, 0xB0, 0x9B, 0x7D, 0x06, 0x44, 0x4E,
+    0x6A, 0xDC, 0x37, 0x20, 0xAF, 0xB1, 0xE6, 0xE1, 0xBF, 0x2A, 0x9F, 0x66, 0x55, 0x96, 0xBA, 0xA3,
+    0x03, 0xF2, 0x45, 0x99, 0x32, 0x0A, 0x82, 0x7D, 0xD5, 0x8A, 0x5C, 0x5B, 0x19, 0x8C, 0xC8, 0xD7,
+    0xB3, 0xC6, 0x3E, 0x27, 0x32, 0x36, 0x90, 0xF4, 0x30, 0xCB, 0x1F, 0xF8, 0xC1, 0x96, 0x7E, 0x13,
+    0xC4, 0xBB, 0xDA, 0x10, 0x13, 0x09, 0xAC, 0xC2, 0x37, 0x34, 0xCD, 0x94, 0x4A, 0x10, 0x27, 0xB2,
+    0x07, 0x97, 0x68, 0x44, 0xFE, 0x02, 0x69, 0xB2, 0x63, 0x35, 0x4F, 0x1B, 0x96, 0xC2, 0xC4, 0xFF,
+    0x61, 0x62, 0x44, 0x16, 0xFD, 0xB3, 0x46, 0xE5, 0x91, 0x64, 0xAB, 0x4C, 0x8E, 0x8D, 0xCA, 0x25,
+    0x83, 0x5C, 0x91, 0x4D, 0xB7, 0x68, 0xE5, 0xD3, 0xED, 0x80, 0xA9, 0x9F, 0x2E, 0xE5, 0x0D, 0xCC,
+    0xB2, 0xC6, 0x58, 0x75, 0x57, 0x1C, 0xED, 0x58, 0x57, 0x0E, 0x8F, 0x5F, 0x32, 0xDF, 0x63, 0xBC,
+    0x00, 0x18, 0xC4, 0x1D, 0xA4, 0x84, 0xB3, 0xC9, 0xD9, 0xCB, 0x40, 0xA6, 0x34, 0x8D, 0x92, 0xEE,
+    0x40, 0x4A, 0xDE, 0x81, 0x18, 0x1A, 0xBE, 0x33, 0xBF, 0xC9, 0xC4, 0x42, 0x65, 0x58, 0x73, 0x63,
+    0x18, 0x44, 0xE9, 0xE7, 0xA6, 0x52, 0x03, 0xBC, 0x5F, 0xB2, 0x0C, 0x0E, 0x7D, 0xC4, 0xD6, 0x6E,
+    0x61, 0x39, 0xD8, 0x3E, 0x45, 0x6D, 0x70, 0xA6, 0x46, 0x73, 0xF1, 0x82, 0x39, 0x33, 0xDD, 0xE1,
+    0x45, 0x8D, 0xBB, 0xB5, 0x3C, 0x0B, 0xDB, 0x13, 0xB5, 0x94, 0x4F, 0xF5, 0x7D, 0x54, 0xB6, 0x7F,
+    0xBD, 0x2D, 0x6F, 0xEB, 0x62, 0x1E, 0xA4, 0xE8, 0x54, 0x1A, 0x6D, 0x37, 0x6D, 0x26, 0x4D, 0xEA,
+    0x54, 0x0F, 0x7A, 0x39, 0x76, 0x8B, 0x95, 0x6E, 0x88, 0xA5, 0xF8, 0x7C, 0x0E, 0x54, 0x49, 0x65,
+    0x7B, 0x3C, 0x7F, 0xD4, 0xC4, 0x5C, 0x24, 0xA4, 0x90, 0xBD, 0x91, 0x7D, 0xA1, 0x70, 0x70, 0x17,
+    0xC3, 0x24, 0x3A, 0x15, 0x4F, 0x4C, 0x70, 0xE5, 0x5F, 0xEA, 0x16, 0x0D, 0x08, 0x7C, 0x0E, 0xA4,
+    0xD9, 0xA1, 0xC3, 0xB6, 0xCC, 0xA9, 0x12, 0x41, 0x02, 0x33, 0x38, 0xD7, 0x9B, 0xDC, 0x7B, 0xF7,
+    0xD1, 0x82, 0xEE, 0x98, 0x1D, 0x13, 0x7D, 0x9D, 0xAE, 0x62, 0x37, 0x07, 0xDB, 0xC3, 0xC6, 0x2A,
+    0x29, 0x0C, 0x0E, 0xD2, 0xE8, 0xEC, 0x28, 0xF6, 0x1B, 0x36, 0xBA, 0xB6, 0x69, 0x92, 0x07, 0x96,
+    0x25, 0x71, 0xB4, 0xAD, 0xF2, 0x28, 0x68, 0xDD, 0x49, 0x37, 0xB9, 0x22, 0xD6, 0x0F, 0x4F, 0xC5,
+    0x4B, 0x7B, 0xEB, 0xE8, 0x5B, 0x4B, 0xC7, 0xF2, 0xA7, 0xDD, 0x59, 0xBC, 0x59, 0xD2, 0x7F, 0xA4,
+    0x14, 0xE3, 0xD9, 0xE3, 0x71, 0x39, 0x8A, 0x45, 0x95, 0x82, 0xA4, 0x6D, 0xC3, 0xD1, 0x36, 0xA2,
+    0x54, 0x7C, 0xA4, 0xF4, 0x68, 0x19, 0x89, 0x99, 0x4C, 0xDB, 0x14, 0xDC, 0x5A, 0x43, 0x05, 0xB8,
+    0xD6, 0x69, 0x6C, 0x1D, 0x3B, 0x40, 0xB1, 0xF7, 0x4C, 0xE0, 0x49, 0x86, 0x4E, 0xBA, 0x70, 0x6B,
+    0xAD, 0xF9, 0x32, 0x87, 0x67, 0x97, 0xDC, 0xE1, 0x84, 0xCD, 0x97, 0xC9, 0x24, 0x87, 0x3F, 0x93,
+    0xBE, 0x55, 0x62, 0x8E, 0x8C, 0xCE, 0x1A, 0x4E, 0x72, 0x4D, 0x17, 0xEB, 0xBC, 0x60, 0x75, 0xC9,
+    0xEB, 0xF5, 0x8E, 0x53, 0x14, 0x7F, 0xF0, 0xCC, 0xDF, 0x74, 0x25, 0xF6, 0xAE, 0x1F, 0xFD, 0x07,
+    0x66, 0xDE, 0x2B, 0xBF, 0xF4, 0x75, 0xFC, 0x12, 0xDB, 0xA0, 0x9B, 0x2A, 0x60, 0xC6, 0xE8, 0x99,
+    0xFB, 0x46, 0x31, 0x51, 0xBA, 0x74, 0x33, 0x6B, 0x49, 0xBA, 0xE5, 0xC0, 0x13, 0x06, 0x08, 0xD1,
+    0x4E, 0x08, 0xF9, 0x7D, 0x79, 0x02, 0xD3, 0x40, 0x14, 0x99, 0x61, 0xA4, 0x4F, 0xDC, 0x35, 0xD1,
+    0xA9, 0x29, 0x54, 0x3A, 0x10, 0x2C, 0xEF, 0x36, 0xBF, 0x64, 0x2E, 0xF3, 0x88, 0x96, 0xF5, 0x42,
+    0x3D, 0x46, 0x71, 0xE2, 0xC2, 0x6B, 0x5C, 0x9C, 0x7B, 0xEF, 0xB5, 0x0F, 0x90, 0xF1, 0x0D, 0x8E,
+    0x45, 0x89, 0x4B, 0x5E, 0x61, 0xEE, 0xE7, 0x73, 0x86, 0x74, 0x69, 0xF6, 0x6F, 0x57, 0xE8, 0xBE,
+    0xE3, 0x91, 0x6A, 0xDB, 0x39, 0xB8, 0x2F, 0xCD, 0x9B, 0xD0, 0x87, 0xED, 0xBF, 0x32, 0xB6, 0x84,
+    0x3A, 0xC5, 0xBC, 0xD5, 0x2D, 0x59, 0x69, 0x70, 0x5B, 0x74, 0x9A, 0xD7, 0x87, 0x3C, 0xE4, 0x07,
+    0x5B, 0xA6, 0x6B, 0xB0, 0x92, 0x84, 0xA4, 0x47, 0x1D, 0x94, 0xBA, 0xAF, 0x5A, 0xE1, 0x5B, 0xB7,
+    0x1D, 0xA9, 0x56, 0x1A, 0xC6, 0x74, 0x5E, 0x9B, 0xDB, 0x09, 0x97, 0xEA, 0x65, 0xCB, 0xD9, 0xFC,
+    0x45, 0x7E, 0x11, 0xCE, 0x0A, 0x02, 0xE0, 0x52, 0x08, 0x82, 0x2E, 0xA5, 0x7E, 0x48, 0xA7, 0x8D,
+    0xE9, 0x64, 0x14, 0x7A, 0xF1, 0x03, 0x50, 0x30, 0x7A, 0x89, 0x11, 0x9B, 0x91, 0x86, 0x51, 0x29,
+    0x4E, 0x7F, 0x5A, 0x1F, 0x71, 0xB2, 0x47, 0x58, 0x0D, 0x0F, 0x3F, 0x8C, 0xB5, 0x9B, 0x97, 0x86,
+    0xB6, 0x61, 0xA2, 0x6F, 0x8A, 0x4F, 0x3D, 0x20, 0x74, 0x2F, 0x32, 0xC5, 0x8F, 0x3C, 0xB8, 0xB3,
+    0x3B, 0x6A, 0xEA, 0x41, 0x9B, 0x95, 0x8E, 0xCD, 0x66, 0x19, 0xCE, 0xC6, 0xA3, 0xE4, 0x11, 0x26,
+    0x72, 0xC6, 0xE5, 0xCF, 0xFE, 0xC2, 0x3C, 0x34, 0x0A, 0xFE, 0xE2, 0x67, 0xE6, 0xFE, 0x6D, 0x13,
+    0xCD, 0xE2, 0x8B, 0x9B, 0xF5, 0x6F, 0xAC, 0x57, 0xA8, 0x50, 0x97, 0x3A, 0x8B, 0xDF, 0xF5, 0x0B,
+    0x3F, 0xE2, 0xB6, 0xDF, 0x1C, 0x3D, 0x20, 0xBA, 0x61, 0xD2, 0xA6, 0x69, 0xBA, 0x45, 0xB4, 0xD2,
+    0x7F, 0x87, 0x01, 0xD2, 0xBF, 0xC5, 0x6C, 0x47, 0x08, 0x32, 0x8F, 0x98, 0x2F, 0xF2, 0xB5, 0xAE,
+    0x66, 0xF7, 0x27, 0x26, 0x92, 0x4D, 0x77, 0x9A, 0xE4, 0x3F, 0xFE, 0x07, 0xB1, 0x3A, 0x4F, 0x66,
+    0xCF, 0xDC, 0x27, 0xBF, 0x60, 0xB6, 0xCD, 0x97, 0xFA, 0x62, 0x8E, 0x76, 0x89, 0xB0, 0xA2, 0x25,
+    0x2C, 0xF9, 0xDB, 0xEE, 0x17, 0x8E, 0xAC, 0x24, 0x13, 0xBC, 0xD6, 0x0F, 0x98, 0x6F, 0x5F, 0xE8,
+    0x12, 0x5D, 0x4E, 0x7C, 0x70, 0xCC, 0x1F, 0x74, 0xDF, 0xCC, 0xCF, 0x03, 0x96, 0xDD, 0x37, 0xEA,
+    0x6D, 0xEE, 0xEB, 0x4A, 0x3C, 0x3E, 0xB5, 0xC8, 0x62, 0xF3, 0x85, 0xD4, 0x0D, 0x5B, 0x58, 0x2E,
+    0xFB, 0x48, 0xD3, 0x2E, 0x0D, 0x06, 0x86, 0xC2, 0x96, 0xAC, 0x66, 0x34, 0x6E, 0xF6, 0xF5, 0x5D,
+    0x35, 0x74, 0x71, 0xB7, 0x3E, 0xFB, 0x12, 0x54, 0x70, 0xA1, 0x52, 0x49, 0x6D, 0x61, 0x81, 0xD2,
+    0x2F, 0xBE, 0x36, 0xC2, 0xFA, 0x77, 0xF0, 0xFA, 0x4D, 0xD7, 0x3E, 0x2A, 0x67, 0x41, 0xCA, 0x56,
+    0x7E, 0x47, 0x31, 0xA2, 0xF5, 0x13, 0x3A, 0x6B, 0x25, 0x87, 0x06, 0x85, 0xC1, 0xF5, 0xE5, 0x0E,
+    0x32, 0x7C, 0xD3, 0xD9, 0x08, 0xFB, 0xB0, 0x99, 0x6D, 0xB6, 0x16, 0x32, 0xE1, 0x6D, 0xAC, 0x7D,
+    0x3A, 0x1A, 0x96, 0xBB, 0xA4, 0x2D, 0xA5, 0x4B, 0xDC, 0xEC, 0x32, 0x1D, 0x30, 0xA5, 0x49, 0xAB,
+    0xD9, 0x02, 0xC7, 0x42, 0x7E, 0x74, 0x91, 0x05, 0x2F, 0x96, 0x60, 0x4A, 0x44, 0xA7, 0xCE, 0xBB,
+    0x08, 0xF7, 0x18, 0x9B, 0xA7, 0x21, 0xB3, 0x12, 0x03, 0x06, 0x8C, 0xA5, 0xCB, 0xD0, 0xCE, 0x25,
+    0xA2, 0x81, 0xA3, 0x21, 0x84, 0x38, 0xC1, 0x30, 0xB3, 0x2F, 0x36, 0x90, 0x00, 0x91, 0x67, 0x43,
+    0x4E, 0xB3, 0xCB, 0xBA, 0xD8, 0x93, 0x1E, 0xEB, 0xD6, 0xA3, 0x89, 0x0E, 0x2F, 0x30, 0xBE, 0x58,
+    0x81, 0x33, 0x1D, 0x29, 0x03, 0x78, 0x08, 0x84, 0xB9, 0xAF, 0x15, 0x1A, 0xD1, 0x9D, 0x69, 0x7B,
+    0xE2, 0xCC, 0xB3, 0x30, 0x04, 0xE3, 0xA5, 0xC4, 0xA3, 0x66, 0x7A, 0x63, 0x49, 0x3A, 0xE6, 0x5D,
+    0x89, 0xB3, 0x27, 0xCE, 0x6D, 0x9E, 0x74, 0x8C, 0x59, 0x1A, 0xF5, 0xA7, 0x41, 0x61, 0x62, 0x16,
+    0x36, 0x38, 0x39, 0x25, 0xC0, 0x6F, 0x67, 0x3E, 0x3A, 0x37, 0x10, 0x6B, 0xD3, 0xD3, 0x52, 0x8F,
+    0xE1, 0x59, 0x81, 0x1B, 0x8E, 0x8D, 0x1C, 0x48, 0xBD, 0xF9, 0x2B, 0xA9, 0x37, 0x1A, 0x54, 0x84,
+    0x14, 0x4F, 0x36, 0x5A, 0xEB, 0xE9, 0x52, 0x6F, 0x4B, 0xC9, 0xCD, 0xE3, 0xB3, 0x73, 0x12, 0x2E,
+    0xBA, 0x57, 0xE3, 0x43, 0x0F, 0xFC, 0xCD, 0xCD, 0x0F, 0x3E, 0x2F, 0x27, 0x3C, 0x24, 0xBD, 0xE0,
+    0x77, 0x55, 0x3D, 0xFC, 0x69, 0xB4, 0xDA, 0x92, 0xC4, 0xAE, 0xEA, 0x09, 0x54, 0x68, 0xFA, 0x34,
+    0xBB, 0x16, 0x19, 0xF8, 0xB1, 0x03, 0xB5, 0xAF, 0x07, 0x51, 0x8F, 0x20, 0xC8, 0x7F, 0xBD, 0x76,
+    0xB3, 0xAD, 0xCA, 0xFB, 0x60, 0x94, 0x33, 0x82, 0xF6, 0x9B, 0x0B, 0x31, 0x7B, 0xF5, 0x02, 0x63,
+    0xAF, 0xD4, 0xF9, 0x96, 0xED, 0xE3, 0xA1, 0xAD, 0x0E, 0x93, 0xAE, 0xD5, 0x41, 0x7A, 0x1A, 0xAD,
+    0x03, 0xAD, 0x0E, 0xDA, 0x0C, 0xF9, 0x1B, 0x80, 0xC0, 0xE2, 0xEF, 0xB1, 0x40, 0x15, 0x6B, 0x07,
+    0x17, 0xA4, 0xD5, 0x81, 0x41, 0x7B, 0xFC, 0x14, 0xBB, 0x4E, 0x05, 0x50, 0x98, 0xF8, 0xD0, 0xE2,
+    0xF9, 0x6A, 0xD1, 0xAB, 0x3D, 0x61, 0xCB, 0x13, 0x9F, 0x13, 0x29, 0x01, 0x9E, 0x5F, 0xEE, 0x58,
+    0xB6, 0x6F, 0x71, 0x8A, 0x67, 0xD9, 0x7A, 0x1F, 0xCA, 0x9A, 0xE9, 0xA2, 0x5E, 0x6F, 0xB1, 0xE8,
+    0x3B, 0x17, 0x58, 0xD9, 0x35, 0xD6, 0xD5, 0x8D, 0x2F, 0x35, 0x7E, 0x47, 0xE8, 0xCD, 0xE8, 0x5C,
+    0x16, 0x9B, 0xE3, 0x97, 0x4F, 0x4B, 0x79, 0x8B, 0x55, 0xCB, 0xC3, 0xC6, 0xB9, 0x81, 0xCE, 0x9D,
+    0x1D, 0xA5, 0xE9, 0xF3, 0x9D, 0x1B, 0x68, 0x1A, 0x61, 0x5D, 0x27, 0x4D, 0xFA, 0xC5, 0x68, 0x9A,
+    0x6E, 0x9C, 0x69, 0x8B, 0xF7, 0x37, 0xF2, 0xF6, 0x41, 0x2C, 0xD9, 0x28, 0x11, 0x8B, 0x24, 0x4C,
+    0x21, 0xCA, 0x79, 0x20, 0xD1, 0x0A, 0x71, 0x0D, 0xBB, 0xFB, 0xAD, 0x72, 0x88, 0xD7, 0xA0, 0xED,
+    0xB0, 0x69, 0x8F, 0xD2, 0x64, 0xBA, 0x1A, 0x51, 0x7C, 0xD4, 0x9E, 0x49, 0x72, 0x91, 0x27, 0x74,
+    0x04, 0x4A, 0x29, 0xCD, 0xF1, 0x61, 0x34, 0xBB, 0x92, 0x62, 0xC1, 0x5C, 0x6F, 0xCC, 0x24, 0x8D,
+    0xCB, 0x16, 0xA5, 0x80, 0x15, 0x29, 0x5A, 0x88, 0xB6, 0x60, 0xBD, 0xD8, 0xB5, 0x2D, 0xD1, 0x99,
+    0xFB, 0x3C, 0xD8, 0x1E, 0x16, 0x5D, 0x66, 0x73, 0xE9, 0x70, 0x32, 0x01, 0x9F, 0x30, 0x40, 0xA5,
+    0x1C, 0x03, 0xF0, 0x32, 0x6D, 0x8F, 0x8C, 0x25, 0x3D, 0xC7, 0x4C, 0x5E, 0xE5, 0x9F, 0x92, 0x06,
+    0xB1, 0x40, 0xE0, 0x42, 0x3F, 0x14, 0x98, 0x10, 0x86, 0x9A, 0x38, 0xDE, 0xAB, 0xF5, 0xF8, 0xAC,
+    0x98, 0xC9, 0x68, 0x28, 0x0E, 0xA2, 0x1E, 0x6B, 0xE0, 0x29, 0x61, 0x82, 0x97, 0x49, 0xC8, 0x10,
+    0x26, 0x25, 0xC9, 0xD9, 0x92, 0x16, 0x4D, 0xAB, 0xE2, 0x21, 0x28, 0x08, 0xB6, 0x93, 0x3B, 0x57,
+    0xD9, 0x6A, 0x90, 0x59, 0x4D, 0xC2, 0xCE, 0x20, 0xD3, 0x76, 0x5A, 0x06, 0x2B, 0x81, 0x57, 0x1B,
+    0x76, 0xF5, 0x56, 0xDE, 0x8E, 0xB2, 0x4C, 0x7A, 0x3F, 0xD0, 0x13, 0x9C, 0x67, 0x80, 0x40, 0xCC,
+    0x3A, 0x9B, 0x85, 0xF6, 0xF4, 0x08, 0x63, 0x44, 0x57, 0x7A, 0xE9, 0x7A, 0xBE, 0xF4, 0xD2, 0x9D,
+    0xE4, 0xB4, 0x56, 0x31, 0x08, 0xF5, 0xF8, 0xD9, 0x6C, 0xF1, 0xE6, 0xE4, 0xE5, 0x50, 0x24, 0xB7,
+    0x90, 0x83, 0x60, 0x6F, 0xC8, 0x5B, 0xF8, 0x68, 0x4E, 0x72, 0x27, 0x30, 0x3F, 0x30, 0xAB, 0x35,
+    0xAC, 0x30, 0x0C, 0x0F, 0x4C, 0xB0, 0xD3, 0xB6, 0xD4, 0xAD, 0xD2, 0x32, 0x58, 0x79, 0x6B, 0xB5,
+    0xE1, 0xCC, 0x9D, 0x3B, 0x65, 0xC5, 0xC4, 0xC1, 0xB7, 0x8D, 0x1A, 0x58, 0x26, 0xBA, 0xB7, 0x04,
+    0xC5, 0x4A, 0xD8, 0xFA, 0x95, 0x3B, 0xFD, 0x5E, 0x6F, 0x1D, 0xFD, 0x40, 0x5F, 0x6B, 0xA5, 0xE2,
+    0xC5, 0x35, 0x65, 0xD0, 0x65, 0xCE, 0x3F, 0xE0, 0x69, 0xC1, 0x2D, 0x36, 0xDA, 0xF2, 0x6C, 0x94,
+    0x4B, 0x8F, 0x87, 0xA0, 0xD1, 0x2E, 0x46, 0xD2, 0x9F, 0x88, 0xC7, 0xFB, 0xEC, 0x2C, 0xFD, 0x90,
+    0x0A, 0x4E, 0xD7, 0xEF, 0x7F, 0xC8, 0xE4, 0xC7, 0x4B, 0xD4, 0x29, 0x9E, 0x6A, 0xE3, 0xD9, 0x1D,
+    0x89, 0x7F, 0x24, 0x82, 0x10, 0x33, 0xCC, 0x23, 0x02, 0xBF, 0x62, 0x9B, 0x37, 0x01, 0xBC, 0xE4,
+    0xF4, 0x17, 0x67, 0x25, 0x05, 0x63, 0x58, 0x45, 0xD7, 0xBE, 0x8D, 0x10, 0xCA, 0x9C, 0x37, 0xAF,
+    0x98, 0x92, 0xAD, 0xFC, 0x9E, 0xB4, 0x44, 0x4B, 0x87, 0xDA, 0x3F, 0x17, 0xC6, 0xF9, 0x27, 0x82,
+    0x4D, 0x9D, 0xD4, 0xFF, 0x5D, 0x22, 0xB9, 0x10, 0x66, 0x46, 0x02, 0x8B, 0xE5, 0xC4, 0x5D, 0xCE,
+    0xC4, 0x54, 0x42, 0xBE, 0x9A, 0x30, 0xEC, 0xDC, 0xC3, 0xDA, 0x32, 0x7B, 0xD5, 0x82, 0xBD, 0x7F,
+    0xC8, 0x31, 0x31, 0xBB, 0x76, 0x0B, 0xC2, 0xF3, 0x8F, 0x16, 0xEC, 0xD1, 0xD2, 0x11, 0xDA, 0xFA,
+    0x3C, 0x63, 0xA6, 0xEC, 0x3D, 0x41, 0xF6, 0x58, 0x22, 0x0F, 0x7D, 0xB2, 0xE7, 0x2F, 0xB1, 0x97,
+    0x90, 0xBD, 0xAC, 0x3D, 0xA4, 0x2D, 0xB5, 0xD0, 0x1F, 0x55, 0xD6, 0x27, 0xBF, 0xCF, 0xED, 0x4F,
+    0xAF, 0xC4, 0xCE, 0x67, 0x40, 0xB1, 0x1F, 0x97, 0x60, 0x80, 0xE7, 0xA2, 0x14, 0xFC, 0xFA, 0x2F,
+    0x25, 0x32, 0xA8, 0x7F, 0x16, 0x0C, 0x9C, 0x00, 0x03, 0x27, 0x11, 0x7F, 0x3D, 0x14, 0x69, 0x2D,
+    0x74, 0x4E, 0xE8, 0xDA, 0x34, 0xDE, 0x82, 0xD6, 0xBD, 0xC1, 0xF8, 0xEB, 0x6D, 0x12, 0x1A, 0x24,
+    0x9A, 0xA0, 0x73, 0x3E, 0x62, 0x15, 0xF6, 0xF7, 0x74, 0x83, 0x1F, 0x26, 0xDD, 0x3E, 0x5C, 0xB9,
+    0xC9, 0x3E, 0xF4, 0x99, 0xC8, 0x6D, 0x09, 0x0D, 0x56, 0x08, 0x5D, 0x29, 0x16, 0xBF, 0x62, 0xD8,
+    0x76, 0x62, 0xED, 0x9E, 0xE9, 0xAA, 0x68, 0xDC, 0x85, 0x12, 0xBB, 0xC0, 0xA2, 0x73, 0xEC, 0x14,
+    0xBB, 0xD8, 0x85, 0x03, 0x4C, 0xC8, 0x2E, 0x64, 0x07, 0x77, 0x41, 0x98, 0x88, 0x60, 0x82, 0x2B,
+    0x3C, 0xDC, 0xE2, 0xD8, 0x88, 0x39, 0x07, 0x99, 0xBF, 0x47, 0x72, 0x58, 0x73, 0x36, 0x63, 0xAA,
+    0x6D, 0x1D, 0xB5, 0x69, 0x05, 0xC9, 0xEF, 0x5B, 0x5C, 0x6D, 0xFB, 0x1A, 0xF7, 0xEE, 0x63, 0x31,
+    0x80, 0x15, 0xB5, 0x76, 0x97, 0xDB, 0x18, 0x49, 0x08, 0x9E, 0x74, 0x27, 0x38, 0x1C, 0xF6, 0x61,
+    0x5B, 0x72, 0x9A, 0xAD, 0x36, 0xCF, 0xED, 0x98, 0x07, 0x63, 0xC4, 0x2E, 0x5B, 0xE6, 0xB9, 0x3D,
+    0xD6, 0x28, 0x7A, 0xB4, 0x0B, 0x03, 0x06, 0x24, 0x63, 0x5A, 0xC3, 0x69, 0xA5, 0x51, 0x06, 0xE6,
+    0x20, 0x56, 0xFD, 0x4C, 0xB4, 0x4E, 0x4A, 0xD8, 0xBB, 0x46, 0x2B, 0x0C, 0x52, 0xF2, 0x17, 0x8B,
+    0xC8, 0x66, 0x18, 0xA3, 0x65, 0x9D, 0xC5, 0x59, 0x31, 0x0A, 0x89, 0x5C, 0x66, 0x20, 0xD0, 0x4F,
+    0x0F, 0x55, 0xE5, 0x7A, 0xA4, 0xC2, 0x4D, 0x99, 0xAA, 0x4F, 0x59, 0x26, 0x48, 0xFD, 0x0F, 0x36,
+    0xCE, 0x6A, 0x0B, 0xA9, 0xBF, 0xDA, 0x42, 0x1A, 0x2D, 0x9F, 0x44, 0x1B, 0xC6, 0x18, 0x7D, 0xC2,
+    0x53, 0x7E, 0xCD, 0x0D, 0x79, 0xE1, 0xE5, 0x78, 0xEC, 0x18, 0x85, 0xE8, 0xFE, 0x58, 0x4F, 0x76,
+    0xB0, 0x62, 0xDE, 0x1E, 0xA1, 0x58, 0x20, 0x06, 0x56, 0xEA, 0x78, 0x2A, 0xDA, 0xE3, 0xA3, 0x3D,
+    0x36, 0x31, 0x07, 0x18, 0xF3, 0x5F, 0xEF, 0xF3, 0x3C, 0x5E, 0xCF, 0x38, 0xB3, 0x43, 0x90, 0x43,
+    0x35, 0x7F, 0x9C, 0x96, 0xBF, 0x9E, 0x4C, 0xF9, 0xF7, 0x0D, 0xD1, 0xAB, 0xD9, 0x3F, 0xA3, 0x6D,
+    0x16, 0x7A, 0x8B, 0x83, 0x5E, 0xE4, 0xD0, 0xB6, 0x5C, 0x48, 0xD7, 0x85, 0x36, 0x5E, 0xB8, 0xF3,
+    0x52, 0x23, 0xF8, 0x26, 0xFF, 0xED, 0xED, 0x0E, 0xDA, 0x87, 0xA1, 0xAD, 0x18, 0xCB, 0xDD, 0x18,
+    0x7A, 0x49, 0x84, 0xDE, 0x13, 0x31, 0x58, 0xBA, 0x2D, 0x82, 0xBC, 0xEE, 0x6C, 0x1B, 0x71, 0x5A,
+    0xE4, 0x76, 0x27, 0x11, 0xFA, 0x95, 0xDF, 0xEE, 0xA8, 0xA2, 0x9C, 0x6B, 0x15, 0x96, 0x95, 0x67,
+    0x65, 0x7A, 0x7E, 0x60, 0x91, 0x7E, 0x5A, 0xF8, 0x56, 0xC6, 0x75, 0x8D, 0xC8, 0x7A, 0x26, 0x3E,
+    0x5D, 0xF2, 0xF7, 0x13, 0x7D, 0x9B, 0x6E, 0x3C, 0xA5, 0x37, 0x29, 0xD8, 0xDA, 0xED, 0xD2, 0x5A,
+    0x64, 0x47, 0x4A, 0x99, 0x02, 0x71, 0xE4, 0xD8, 0x90, 0xD8, 0x10, 0xE9, 0x90, 0xC1, 0xDB, 0xAF,
+    0x65, 0xB3, 0x58, 0x21, 0xE1, 0xF1, 0x21, 0x96, 0x1B, 0xD8, 0x20, 0x30, 0xE2, 0x66, 0xB3, 0x17,
+    0x5E, 0x8E, 0xCF, 0x79, 0x3C, 0x7B, 0x30, 0x14, 0x18, 0xCD, 0x24, 0x5F, 0x2E, 0x07, 0x95, 0x58,
+    0x32, 0xE2, 0xF1, 0xB8, 0x7C, 0xA0, 0x09, 0x0F, 0x39, 0xAE, 0xD4, 0x26, 0x1F, 0xDB, 0xF4, 0x54,
+    0xFB, 0x16, 0xA9, 0x53, 0x94, 0xAA, 0xDA, 0x69, 0x3D, 0x84, 0x31, 0x52, 0x87, 0x3B, 0x52, 0x7F,
+    0x69, 0x69, 0xEF, 0xCA, 0x0E, 0x05, 0x9A, 0x69, 0x03, 0xC0, 0x85, 0x3D, 0x21, 0xB9, 0x27, 0xCF,
+    0x81, 0xD0, 0x3D, 0x36, 0x7A, 0x33, 0x85, 0xB8, 0x59, 0x39, 0x46, 0x45, 0x90, 0xC2, 0x13, 0x26,
+    0x29, 0x8B, 0x66, 0x6E, 0xCE, 0xDE, 0x53, 0x6D, 0xD4, 0xA5, 0x71, 0x75, 0x33, 0xA6, 0x5D, 0xDD,
+    0x94, 0x59, 0x58, 0x15, 0xFF, 0xD5, 0x02, 0x87, 0xD2, 0xC6, 0x78, 0xD8, 0x3A, 0x25, 0x71, 0x5E,
+    0x23, 0x7D, 0x13, 0x4D, 0xB6, 0x1A, 0x17, 0x51, 0xC1, 0x42, 0x12, 0xDB, 0x6C, 0x9F, 0x6E, 0x0F,
+    0xE2, 0xE7, 0xD6, 0x1E, 0x8F, 0x5D, 0x35, 0x69, 0x68, 0x82, 0x7F, 0xC2, 0x92, 0x44, 0x4E, 0x01,
+    0x15, 0xA0, 0x31, 0xAF, 0xF9, 0xA8, 0x9C, 0x02, 0x90, 0x5B, 0x1F, 0x39, 0x1E, 0x5E, 0xC6, 0xAA,
+    0x58, 0x3A, 0x06, 0xA1, 0xC9, 0x16, 0x93, 0x45, 0x51, 0x5C, 0xD7, 0xB0, 0xE6, 0x13, 0x36, 0xE8,
+    0x37, 0x1F, 0x11, 0xAA, 0x43, 0xCA, 0xAC, 0x47, 0x5B, 0xE8, 0xA0, 0x8D, 0xCD, 0x58, 0xD0, 0xFD,
+    0x23, 0x98, 0xC5, 0x02, 0x28, 0x8A, 0x00, 0xBD, 0x9A, 0xAA, 0x87, 0xB1, 0x07, 0x58, 0x6C, 0x84,
+    0x38, 0x03, 0xD6, 0x20, 0xF1, 0xAA, 0x06, 0xDE, 0x9B, 0x40, 0x0B, 0xBF, 0xCF, 0xA2, 0xC7, 0x9A,
+    0x04, 0x90, 0xED, 0xB4, 0x9C, 0x73, 0x39, 0xEA, 0xE5, 0x77, 0x3C, 0x0D, 0xB3, 0xDE, 0x96, 0xA6,
+    0x2D, 0x69, 0x0E, 0x94, 0xF4, 0xA3, 0x9B, 0x74, 0xD1, 0x9B, 0x14, 0x86, 0x78, 0x01, 0x89, 0x9C,
+    0xF0, 0xD3, 0x8C, 0x9A, 0xF7, 0xFF, 0x92, 0x86, 0xD1, 0x36, 0x2F, 0xE9, 0x34, 0x7A, 0xBE, 0x4D,
+    0x0C, 0xB6, 0xAF, 0xB5, 0xAA, 0x2D, 0x4F, 0x48, 0x89, 0xAC, 0xA9, 0xE5, 0xD4, 0xE3, 0xD9, 0x0F,
+    0xCE, 0x1C, 0xEC, 0x64, 0xFB, 0x93, 0x27, 0x1E, 0x97, 0x6F, 0x01, 0xB8, 0x6A, 0xC4, 0x9C, 0x48,
+    0x9A, 0xE6, 0x60, 0xB3, 0x6B, 0xD9, 0x32, 0x72, 0x2E, 0x4C, 0x48, 0xFF, 0x27, 0x4D, 0x31, 0x82,
+    0x47, 0xB9, 0xF6, 0x8F, 0x57, 0xAF, 0xEE, 0xB1, 0xC7, 0x8C, 0xE8, 0x0F, 0xD8, 0xA4, 0xD1, 0xE0,
+    0xA7, 0x56, 0x63, 0x56, 0xC9, 0x0D, 0x21, 0x6C, 0x59, 0xD5, 0xFB, 0x01, 0x06, 0x46, 0x9B, 0x56,
+    0x8D, 0x76, 0xAD, 0x1A, 0x69, 0x5B, 0xA5, 0x4D, 0x93, 0xBE, 0xD6, 0x70, 0x7E, 0xD3, 0x4A, 0x6A,
+    0x35, 0xB1, 0xB4, 0x97, 0x4F, 0x0E, 0x43, 0x91, 0xED, 0xDB, 0x70, 0x05, 0xB9, 0x9D, 0x91, 0x56,
+    0x7E, 0xE6, 0x1A, 0x49, 0x40, 0x60, 0x18, 0x84, 0x32, 0x8B, 0x17, 0xC9, 0x29, 0x1B, 0x37, 0xAD,
+    0xC4, 0xF7, 0xF3, 0x58, 0xA2, 0xCD, 0x86, 0xB7, 0xE6, 0x26, 0xAB, 0x90, 0x2F, 0x6E, 0x9C, 0xA1,
+    0x95, 0x60, 0x65, 0x63, 0xE9, 0xFC, 0x8C, 0x1C, 0x53, 0xEC, 0x4B, 0x43, 0x18, 0x3C, 0x22, 0x0D,
+    0x19, 0x13, 0x94, 0xCC, 0x4E, 0x32, 0x35, 0xD9, 0x6F, 0x0B, 0x2A, 0x95, 0xF6, 0xDA, 0x79, 0xD9,
+    0xAD, 0xA3, 0x24, 0x5F, 0x8E, 0x03, 0xB3, 0xBE, 0xC1, 0xBB, 0x90, 0xA8, 0xA7, 0xA5, 0x9E, 0xE7,
+    0x95, 0xA6, 0x0F, 0x2A, 0xB0, 0x61, 0x72, 0xD2, 0xF0, 0x30, 0xB5, 0x31, 0x9F, 0xCB, 0x41, 0xCB,
+    0xAC, 0xCB, 0x13, 0xCD, 0xE5, 0x36, 0xD2, 0xE3, 0x57, 0xF5, 0x0D, 0x96, 0x5F, 0x5A, 0xFD, 0x04,
+    0x77, 0xAD, 0x27, 0xE6, 0x61, 0x8A, 0xA4, 0x1C, 0x33, 0x64, 0x0A, 0xDB, 0x2A, 0xBA, 0x89, 0x78,
+    0xB8, 0x29, 0xF7, 0x13, 0x9D, 0x8D, 0xC7, 0x06, 0x0C, 0x4B, 0xD5, 0xC6, 0xFA, 0x84, 0x9F, 0xFB,
+    0x4C, 0x3C, 0x2B, 0x67, 0x93, 0x44, 0xF5, 0xA4, 0x2B, 0x1B, 0x47, 0xEC, 0x95, 0x19, 0x35, 0xE5,
+    0xCA, 0xB5, 0x18, 0x73, 0x94, 0xA7, 0x16, 0xE6, 0x4E, 0x9E, 0x1D, 0xDD, 0xE5, 0x49, 0x8E, 0x11,
+    0xFB, 0x6B, 0xA2, 0x43, 0x1C, 0x6D, 0x60, 0x96, 0x1C, 0xED, 0x2B, 0xE6, 0x41, 0x4A, 0xC8, 0x16,
+    0xD7, 0xAA, 0x6E, 0xDB, 0xCF, 0xD9, 0x46, 0x62, 0x3C, 0x02, 0x5B, 0x67, 0x3A, 0x6F, 0xEC, 0x92,
+    0x23, 0xF7, 0x75, 0x77, 0xB5, 0xC8, 0x98, 0x34, 0xF2, 0x7C, 0x8E, 0xCB, 0xC5, 0xF1, 0x53, 0x4F,
+    0xE4, 0xF9, 0x66, 0xB8, 0x56, 0x38, 0xB6, 0xE4, 0xE8, 0x5C, 0xED, 0x25, 0x7C, 0xFA, 0xC9, 0xC3,
+    0x17, 0xFE, 0x70, 0x5E, 0x0E, 0xA6, 0x71, 0xBB, 0xC5, 0x9F, 0x50, 0x21, 0xBB, 0xB3, 0xAE, 0x46,
+    0x9C, 0x89, 0x9E, 0x76, 0xE5, 0x1F, 0x6B, 0xA3, 0x87, 0x5E, 0xF5, 0xA8, 0xB7, 0x91, 0xAB, 0x76,
+    0x5A, 0x1F, 0x56, 0x4A, 0x5E, 0x4E, 0xDC, 0xB3, 0x3A, 0x30, 0x59, 0x4D, 0xE9, 0xE2, 0xF8, 0x1F,
+    0xE2, 0xA4, 0xEB, 0xF6, 0x79, 0xA0, 0x73, 0x7B, 0xB9, 0x7F, 0x5B, 0x0F, 0x4F, 0x02, 0x7E, 0x3F,
+    0xBC, 0xB3, 0xB3, 0x9E, 0xC0, 0xD8, 0x7A, 0xE9, 0x73, 0x7B, 0xAF, 0x2E, 0x6E, 0x0F, 0xD1, 0x0B,
+    0x7B, 0xF4, 0x0E, 0x01, 0x56, 0x0B, 0xD5, 0xEF, 0xF0, 0x3C, 0x8A, 0x69, 0xAF, 0xBD, 0xB0, 0xF9,
+    0x70, 0xE9, 0xE3, 0x4E, 0xF0, 0xF0, 0x48, 0x05, 0x81, 0x68, 0xB2, 0x51, 0x8C, 0x80, 0xEA, 0xA6,
+    0x67, 0x00, 0x8E, 0x32, 0x8F, 0x74, 0x82, 0x47, 0x69, 0x79, 0x92, 0x96, 0x07, 0x69, 0x79, 0x8E,
+    0x96, 0x85, 0x02, 0xAD, 0x07, 0x31, 0x84, 0x66, 0x2D, 0xC8, 0x06, 0xF8, 0x74, 0xF3, 0x68, 0xA7,
+    0xC9, 0xC2, 0xA6, 0xC9, 0xEC, 0xDF, 0x3E, 0x71, 0x98, 0xCA, 0x9C, 0x66, 0x71, 0x55, 0x5F, 0x9D,
+    0x8A, 0x2E, 0x07, 0x01, 0x6B, 0x31, 0x9B, 0xF8, 0xBB, 0x6E, 0xDE, 0xA1, 0xD4, 0x6D, 0x0E, 0x36,
+    0xF1, 0xCF, 0xDA, 0x26, 0xFE, 0x83, 0x36, 0x50, 0x6C, 0xF8, 0x4D, 0x12, 0x24, 0xB7, 0xE0, 0xC1,
+    0x8A, 0xAB, 0x9E, 0xFB, 0x42, 0x39, 0xF0, 0x4E, 0x15, 0x63, 0x1F, 0x9A, 0xE3, 0x83, 0x87, 0x0B,
+    0x2D, 0x0F, 0x7B, 0xE0, 0xE1, 0xA4, 0xCF, 0x57, 0x62, 0x9E, 0xC7, 0x27, 0x5F, 0x5F, 0x1D, 0xFB,
+    0x20, 0xAD, 0x83, 0x07, 0x40, 0xEB, 0x23, 0x61, 0x5C, 0x9F, 0x04, 0xAD, 0x7F, 0x09, 0x5A, 0x27,
+    0x7B, 0x26, 0x24, 0xAD, 0xD4, 0x47, 0x96, 0x9B, 0x11, 0x98, 0x59, 0xD9, 0xD2, 0x09, 0xF5, 0xC1,
+    0x2A, 0x0B, 0xAB, 0x69, 0x8C, 0x1F, 0xC7, 0xCE, 0x1F, 0x9B, 0xD2, 0x6D, 0xAE, 0xD7, 0xDE, 0x25,
+    0xB3, 0xC5, 0x4B, 0xA1, 0x6E, 0xBD, 0x07, 0x76, 0x31, 0xEE, 0x4E, 0xD7, 0xDE, 0x2C, 0xEF, 0x52,
+    0x85, 0x99, 0xB9, 0xDA, 0x54, 0xD6, 0xB5, 0x0F, 0x6A, 0x58, 0xFA, 0x81, 0x73, 0x58, 0x6F, 0xE9,
+    0x4D, 0xBA, 0xAB, 0x7B, 0xF3, 0x32, 0x26, 0xBD, 0x71, 0x65, 0x5A, 0x77, 0x0C, 0x7F, 0x3C, 0x4A,
+    0xE8, 0x90, 0x41, 0x9F, 0x5B, 0xB4, 0xD7, 0x87, 0x79, 0xE9, 0xF7, 0x44, 0x65, 0x4E, 0x82, 0xC0,
+    0x28, 0x39, 0x89, 0x05, 0xE0, 0x21, 0xE5, 0x0B, 0x92, 0x73, 0x14, 0x57, 0x3B, 0x7B, 0x35, 0x9E,
+    0xD7, 0xC8, 0x96, 0x9F, 0xE3, 0x25, 0x7F, 0xA0, 0x55, 0x52, 0xF8, 0xE7, 0xA2, 0x3B, 0x32, 0x6F,
+    0xC9, 0x21, 0xBC, 0xB6, 0x1F, 0x74, 0x33, 0x17, 0x98, 0xE3, 0x5F, 0xDE, 0x85, 0x70, 0xF4, 0x9F,
+    0x87, 0x35, 0x2F, 0xC7, 0x66, 0x58, 0x55, 0xEB, 0x15, 0xD4, 0x22, 0x67, 0x6E, 0xB1, 0x5B, 0x49,
+    0xBB, 0x6B, 0x97, 0x9E, 0x9A, 0x73, 0x72, 0xBE, 0x35, 0xE8, 0x32, 0x3A, 0xDF, 0x04, 0x6E, 0xB4,
+    0x28, 0x1C, 0x2C, 0x79, 0xC7, 0x68, 0xC9, 0x37, 0x6A, 0xAB, 0xDD, 0x57, 0xE4, 0x55, 0x10, 0x41,
+    0xB6, 0x9A, 0x8C, 0x5D, 0x93, 0x9B, 0x23, 0x34, 0x39, 0x7E, 0x20, 0x5F, 0x78, 0x68, 0x96, 0xF1,
+    0x10, 0x10, 0xB1, 0x2C, 0xAD, 0xEC, 0x8F, 0x1C, 0xC9, 0x05, 0x39, 0xE6, 0xFB, 0x6A, 0xB0, 0x42,
+    0x15, 0x45, 0xFF, 0x4A, 0xD6, 0x96, 0x70, 0x0F, 0xA6, 0xE9, 0xBF, 0x91, 0x17, 0xF2, 0x48, 0xFF,
+    0x31, 0xA6, 0x97, 0xDA, 0x89, 0xD9, 0xDD, 0xD4, 0x0D, 0xD1, 0xED, 0xB4, 0x16, 0x2C, 0xDC, 0xA5,
+    0x13, 0xA4, 0x87, 0x27, 0x47, 0xDC, 0x1B, 0x73, 0x0E, 0xEF, 0xE7, 0xF3, 0xDC, 0xCF, 0xBE, 0xAC,
+    0x14, 0x7C, 0x5F, 0x16, 0xF0, 0xC6, 0x2C, 0x87, 0x20, 0x4D, 0x2F, 0x40, 0xA8, 0xF5, 0xCE, 0x9B,
+    0xEE, 0xA6, 0x06, 0x9E, 0x9E, 0xD4, 0x8B, 0x4A, 0x56, 0x8F, 0x87, 0x0B, 0xCE, 0x0E, 0x52, 0x73,
+    0xAF, 0x35, 0x81, 0x16, 0x34, 0xD2, 0xEB, 0x90, 0x77, 0xA2, 0x79, 0xFE, 0x16, 0xF9, 0x07, 0x69,
+    0x28, 0x87, 0xD4, 0x66, 0x13, 0xA3, 0x07, 0x45, 0x98, 0x96, 0xE7, 0x99, 0x6F, 0x1A, 0xCC, 0xCE,
+    0xA0, 0x74, 0x0E, 0x22, 0x94, 0x9B, 0x00, 0xD7, 0x6C, 0xC6, 0xCA, 0x65, 0x77, 0x50, 0x66, 0xAE,
+    0x96, 0xD2, 0x05, 0x61, 0x22, 0x46, 0x52, 0xD2, 0x0C, 0xA6, 0xB5, 0x93, 0xF6, 0xBA, 0x18, 0xCD,
+    0x01, 0xC8, 0xFD, 0x12, 0xD2, 0xBA, 0x6B, 0xF4, 0x72, 0x09, 0xBD, 0x5D, 0x42, 0xE5, 0x4B, 0xF2,
+    0x9A, 0x46, 0x2E, 0xD5, 0x30, 0x7A, 0x41, 0x84, 0x04, 0x84, 0x46, 0x7B, 0xC8, 0xD5, 0x71, 0xF2,
+    0xDE, 0xAD, 0xD3, 0x2C, 0xD9, 0x85, 0x25, 0x5D, 0x09, 0x3C, 0xD4, 0xD1, 0xEE, 0x60, 0x99, 0xBB,
+    0xD4, 0x3A, 0xA6, 0x3A, 0xBA, 0xB5, 0xC8, 0x2E, 0xAE, 0xFF, 0x96, 0xF8, 0x9C, 0x99, 0x82, 0x3D,
+    0x04, 0x0A, 0x6C, 0x10, 0x13, 0xD8, 0x2A, 0x45, 0x13, 0xAD, 0xE1, 0xCB, 0xED, 0x56, 0xD2, 0x2D,
+    0xC4, 0x86, 0x7A, 0x81, 0x9D, 0xF8, 0xBF, 0x92, 0xB3, 0xF2, 0xBC, 0x8C, 0xA4, 0x04, 0x06, 0x02,
+    0x96, 0x1D, 0xC5, 0x4E, 0xA3, 0x0A, 0xD4, 0x75, 0x0E, 0x5C, 0xEC, 0x1C, 0x7F, 0x07, 0x4C, 0xEE,
+    0x68, 0xDA, 0x63, 0xA0, 0xE1, 0xFE, 0xF8, 0x20, 0xEA, 0xEC, 0xAE, 0x3A, 0xB9, 0xEF, 0x70, 0x01,
+    0xB8, 0x3D, 0x09, 0x90, 0xBC, 0xCB, 0x02, 0x1C, 0x68, 0xC5, 0x23, 0x9A, 0x8D, 0xF7, 0xDA, 0x90,
+    0x76, 0x29, 0xA2, 0xFD, 0x1A, 0xF3, 0x3F, 0x0B, 0x30, 0xDA, 0xEB, 0xAC, 0xBA, 0x68, 0x87, 0x66,
+    0x41, 0x6F, 0x77, 0xFE, 0x67, 0xBE, 0xF1, 0x66, 0x01, 0x4B, 0x33, 0xDD, 0xFD, 0x5B, 0xC1, 0xB0,
+    0xDE, 0x12, 0x0C, 0x1B, 0xFE, 0x29, 0x18, 0x66, 0x6D, 0x1A, 0xB9, 0x02, 0x8A, 0xE1, 0xE1, 0xB2,
+    0xD1, 0x6F, 0x53, 0xD9, 0xC4, 0xDB, 0xF7, 0xC7, 0xD6, 0xB9, 0xD5, 0x93, 0x0E, 0xD2, 0x4D, 0xC1,
+    0x66, 0xDA, 0x94, 0x9D, 0x14, 0xD1, 0x1F, 0xAF, 0xC4, 0x7E, 0x73, 0xD6, 0x58, 0xE7, 0x0F, 0x74,
+    0x12, 0xB0, 0x38, 0x4C, 0xFC, 0x2D, 0x53, 0x1D, 0x88, 0x5C, 0x8F, 0x6A, 0x70, 0x60, 0x4D, 0x79,
+    0xC2, 0x07, 0x98, 0x1D, 0x6A, 0x86, 0x5F, 0xBF, 0x8E, 0xFD, 0x18, 0x5B, 0xD7, 0x52, 0x73, 0xA2,
+    0xB2, 0xF1, 0x1C, 0x54, 0xCE, 0xC7, 0x58, 0xA9, 0xD2, 0x79, 0x3F, 0x45, 0xF4, 0x82, 0xA7, 0xF3,
+    0x5E, 0xE1, 0xBE, 0x95, 0xB9, 0x6F, 0xE5, 0xDE, 0x9B, 0x99, 0xFF, 0x58, 0xE6, 0xFF, 0x3C, 0x47,
+    0xB0, 0xE6, 0x9F, 0xCA, 0xD9, 0x6C, 0x6B, 0x15, 0x17, 0x69, 0x55, 0x8A, 0x82, 0x5D, 0xBC, 0x9F,
+    0xE6, 0xAC, 0xB6, 0x5C, 0x93, 0xEE, 0xE5, 0x26, 0x61, 0x83, 0x0C, 0x0C, 0xE8, 0x69, 0x69, 0x8F,
+    0x29, 0x28, 0x2C, 0x51, 0xBE, 0xE8, 0x33, 0x5A, 0x76, 0xBB, 0xEA, 0x6A, 0x77, 0x3B, 0x95, 0x7E,
+    0x95, 0xFF, 0xC3, 0xA5, 0x4E, 0x61, 0x78, 0x9D, 0xDA, 0xBE, 0x62, 0xBC, 0xB1, 0xFD, 0xA1, 0x09,
+    0x2E, 0x3A, 0xBF, 0x33, 0x3D, 0x3C, 0xE2, 0x41, 0xE9, 0xBE, 0x13, 0x97, 0x85, 0xF7, 0x8B, 0x17,
+    0x3E, 0x2A, 0xFC, 0xC7, 0x5F, 0x7C, 0x33, 0xF7, 0x9D, 0x77, 0x5E, 0xCC, 0x7C, 0xE7, 0x77, 0x08,
+    0x8B, 0x9C, 0xFF, 0xED, 0xA6, 0x27, 0x1C, 0x36, 0x1D, 0xDB, 0xA5, 0x57, 0x9F, 0x84, 0x29, 0x9F,
+    0x87, 0x19, 0x76, 0xBE, 0x52, 0x12, 0xEE, 0x02, 0x9B, 0x3B, 0xE2, 0x84, 0xC5, 0x07, 0xCB, 0xED,
+    0x6B, 0x01, 0xFD, 0xEF, 0x81, 0xBB, 0xD7, 0xBE, 0xAE, 0x8B, 0x18, 0x1F, 0x84, 0x7A, 0xF0, 0x40,
+    0x8E, 0xFF, 0x5F, 0x73, 0xB5, 0xE8, 0xED, 0x29, 0xA4, 0xE3, 0xF9, 0x43, 0x66, 0x52, 0x0F, 0x9C,
+    0xE9, 0xD9, 0xCA, 0xCB, 0xDD, 0x92, 0xC7, 0x5B, 0x43, 0xE9, 0x6B, 0x65, 0x36, 0x6E, 0xF5, 0x4A,
+    0x8D, 0x71, 0x5B, 0xDF, 0x8E, 0xEC, 0x2B, 0x71, 0xD8, 0xBC, 0x64, 0xBC, 0x69, 0xD0, 0xF6, 0x2C,
+    0x58, 0x7C, 0xF3, 0x1F, 0xCB, 0xDB, 0xC7, 0x9A, 0x95, 0xDC, 0x0D, 0x16, 0x49, 0x05, 0xE7, 0x0F,
+    0xF0, 0x5A, 0x26, 0xE1, 0xB6, 0xB0, 0x48, 0xB7, 0x57, 0xB7, 0x59, 0x21, 0x42, 0x3A, 0x16, 0x3B,
+    0x41, 0xB7, 0xB6, 0x61, 0x7C, 0x24, 0x82, 0xE5, 0xBF, 0x29, 0x28, 0x2B, 0x78, 0x54, 0x6B, 0x7E,
+    0x1A, 0xB2, 0x8F, 0xD5, 0x60, 0x54, 0x6E, 0x23, 0xE0, 0x4F, 0xB2, 0x5B, 0x5E, 0x06, 0xDB, 0x27,
+    0xEE, 0x34, 0xD1, 0x11, 0xA5, 0x9D, 0x7C, 0x67, 0xA2, 0xC1, 0xA6, 0x82, 0x26, 0x91, 0x33, 0x5E,
+    0xEB, 0xAC, 0xF6, 0x7E, 0x0B, 0xD3, 0x85, 0x9A, 0x92, 0xD8, 0x32, 0x52, 0x6D, 0x35, 0xC7, 0xB3,
+    0x67, 0xA0, 0xB9, 0x4D, 0x75, 0xAD, 0xC9, 0x9D, 0xFD, 0x9F, 0x36, 0xBF, 0x28, 0xBC, 0xDC, 0x97,
+    0x8C, 0xA0, 0x57, 0x58, 0xCC, 0x53, 0xE6, 0x8E, 0x9C, 0xA1, 0x0F, 0xB2, 0x9E, 0xDC, 0x16, 0x33,
+    0x94, 0x5C, 0xAC, 0xE0, 0x15, 0x36, 0x85, 0xC9, 0x93, 0x7D, 0x31, 0x03, 0x31, 0xAC, 0x5B, 0xEE,
+    0x95, 0x62, 0x3D, 0x8E, 0x9A, 0x13, 0xCC, 0x7D, 0x56, 0x27, 0xA9, 0x04, 0x7A, 0x80, 0xD1, 0x4D,
+    0xBE, 0x0F, 0xAB, 0x8D, 0x90, 0xF5, 0x7A, 0xD9, 0x5E, 0xA8, 0xD5, 0xF6, 0xD5, 0x2C, 0x15, 0x7D,
+    0x6F, 0x56, 0x30, 0xE7, 0xC1, 0x1E, 0x8E, 0x07, 0x66, 0x6F, 0x56, 0x88, 0x26, 0x5F, 0xDD, 0x50,
+    0x72, 0x17, 0x46, 0x8F, 0x86, 0xF8, 0xE9, 0x74, 0xF9, 0x2E, 0x0C, 0xC9, 0x5C, 0x32, 0xC9, 0xB7,
+    0x1F, 0xB2, 0x0B, 0x42, 0x3A, 0xD4, 0xD9, 0xF9, 0xDB, 0xB7, 0xF6, 0xA4, 0xF7, 0x81, 0xF7, 0x94,
+    0xED, 0xDE, 0x90, 0xE4, 0x7B, 0x60, 0xB5, 0x77, 0x41, 0xB1, 0x3B, 0x18, 0xB0, 0x78, 0x64, 0xC2,
+    0xDA, 0xD7, 0x1C, 0x62, 0x34, 0xBF, 0xF7, 0xCC, 0x9F, 0xBB, 0x3A, 0xB7, 0xBB, 0x73, 0x6A, 0x0D,
+    0x64, 0x6C, 0xC2, 0x51, 0x89, 0xCB, 0x0A, 0xF6, 0x29, 0x6C, 0x31, 0xB0, 0xD1, 0xAE, 0x91, 0x2E,
+    0x45, 0x4C, 0x59, 0xD3, 0xF7, 0xB0, 0x0F, 0x01, 0x12, 0x23, 0xB7, 0x91, 0xCE, 0xF4, 0x16, 0xEA,
+    0x76, 0xC6, 0x09, 0x35, 0x6D, 0x6A, 0xDC, 0xFF, 0x3C, 0x69, 0xF3, 0xA2, 0xDD, 0x45, 0xD3, 0x54,
+    0xC7, 0x26, 0xB5, 0xE9, 0x03, 0xF7, 0xCF, 0x26, 0x3C, 0x46, 0xDC, 0x6B, 0x9B, 0x07, 0xFB, 0x76,
+    0x25, 0x2D, 0x1B, 0x4B, 0xDC, 0xDF, 0x43, 0xD8, 0xD1, 0x6B, 0x1F, 0x66, 0x7B, 0xE5, 0x3A, 0xB3,
+    0xAF, 0x97, 0x1F, 0x11, 0x6E, 0x18, 0x4D, 0xF6, 0x3C, 0xDF, 0x6B, 0x2F, 0x00, 0xF8, 0xED, 0xE1,
+    0x73, 0x69, 0x02, 0xD3, 0x5E, 0xF8, 0x66, 0x56, 0xA6, 0xF9, 0x26, 0x87, 0x2A, 0x6D, 0x77, 0xDB,
+    0x45, 0xF5, 0x61, 0x95, 0xE2, 0xD2, 0x67, 0xEE, 0x3D, 0x48, 0xFB, 0xDD, 0x0A, 0x55, 0xE4, 0x01,
+    0xF9, 0x11, 0x19, 0x5A, 0x12, 0xA1, 0x3B, 0x75, 0xE1, 0x29, 0x4F, 0x72, 0x9F, 0x04, 0x51, 0x03,
+    0xBC, 0xBE, 0xBB, 0xB6, 0x60, 0xFF, 0x36, 0x5C, 0xBA, 0x83, 0x6F, 0x66, 0x72, 0x50, 0xF1, 0xB9,
+    0x9D, 0x5A, 0xE7, 0x97, 0x0E, 0x11, 0x25, 0x57, 0xEE, 0xC1, 0xE0, 0x11, 0xB5, 0x73, 0xEA, 0xC7,
+    0x8F, 0xC9, 0x09, 0xED, 0x6C, 0x29, 0xBD, 0x95, 0x77, 0x5D, 0x25, 0x97, 0x20, 0xE3, 0x3C, 0x34,
+    0xB4, 0xD9, 0x5D, 0xF3, 0xFE, 0xDC, 0xCE, 0x2B, 0x62, 0x85, 0x9E, 0x7B, 0xAD, 0x54, 0x98, 0xDD,
+    0x1D, 0x4E, 0x5F, 0x3A, 0xBD, 0x4B, 0xF5, 0x1A, 0xE1, 0xCF, 0x7F, 0x3E, 0x6B, 0xEF, 0x4C, 0xF4,
+    0x93, 0xD5, 0xEB, 0xE3, 0x17, 0xF7, 0xA8, 0x5F, 0xC2, 0x92, 0x32, 0xB5, 0x20, 0xD7, 0x42, 0x4A,
+    0x6F, 0x09, 0x0D, 0x3E, 0x9F, 0x6B, 0x1B, 0xF1, 0x37, 0xE3, 0xDA, 0x55, 0x5F, 0x52, 0x12, 0x79,
+    0x47, 0xD0, 0x57, 0x68, 0x75, 0x33, 0xFE, 0x2A, 0x14, 0x30, 0xFE, 0xA3, 0x12, 0xA7, 0x3C, 0x26,
+    0x07, 0xFD, 0x57, 0xD1, 0xC0, 0xDD, 0xE6, 0x5A, 0x50, 0xC2, 0xCF, 0x0B, 0x21, 0x6E, 0x7D, 0x41,
+    0xDA, 0xED, 0xE1, 0xFE, 0xC8, 0xDC, 0x0A, 0x88, 0x0D, 0x58, 0xB5, 0x00, 0x5F, 0xE6, 0x34, 0xD1,
+    0x6E, 0x7B, 0x26, 0xC6, 0x59, 0x3A, 0x39, 0xF0, 0xE5, 0x4E, 0x13, 0xDD, 0xD3, 0x5A, 0xD1, 0xBE,
+    0xB7, 0x6A, 0xAD, 0x79, 0xA1, 0xC6, 0x44, 0xEF, 0x26, 0xE3, 0xF9, 0x0B, 0x3D, 0x7B, 0xB1, 0xB8,
+    0xDF, 0x68, 0xB0, 0x74, 0xF7, 0xD7, 0x40, 0x4E, 0x2A, 0xDC, 0x78, 0xCA, 0xE8, 0xFF, 0xD3, 0xC3,
+    0x51, 0xAD, 0x11, 0x2A, 0x4E, 0x1A, 0xE1, 0xD3, 0x98, 0xE4, 0xBB, 0xE6, 0xAE, 0xF1, 0x73, 0x4F,
+    0x77, 0xA7, 0x07, 0xB6, 0xE7, 0x81, 0xA5, 0x66, 0xEA, 0xDB, 0xC6, 0xA7, 0x9B, 0xD2, 0x36, 0xBF,
+    0x41, 0x43, 0xBD, 0xDA, 0x33, 0xFD, 0xF5, 0x5E, 0x5C, 0x78, 0xA4, 0xD5, 0x05, 0x36, 0xBB, 0x2D,
+    0xA9, 0xC3, 0x6D, 0xB9, 0x1D, 0x46, 0xEE, 0xB6, 0xB3, 0xC4, 0x91, 0x6F, 0x9C, 0xB9, 0x2B, 0x37,
+    0xF9, 0x0B, 0x05, 0xF6, 0x0A, 0x05, 0x52, 0xDD, 0x64, 0x72, 0x90, 0x17, 0x88, 0xE2, 0xD3, 0x3D,
+    0x2D, 0x51, 0x89, 0xC5, 0xE3, 0x35, 0xC1, 0xF4, 0x27, 0x92, 0x8F, 0x0D, 0xC4, 0xAB, 0x88, 0xE7,
+    0x58, 0x50, 0x30, 0x6C, 0xCF, 0x89, 0xEA, 0xF9, 0x2B, 0x49, 0xF7, 0x09, 0x7E, 0x5B, 0x74, 0x2E,
+    0x6F, 0x75, 0xE7, 0xAC, 0xE4, 0x8C, 0x95, 0x9E, 0xAF, 0xD2, 0x43, 0x73, 0x65, 0xBF, 0x7B, 0x9C,
+    0x7E, 0xE0, 0xEE, 0xFD, 0xE3, 0x06, 0x2A, 0xDA, 0x65, 0xBF, 0xBD, 0xB4, 0x79, 0x95, 0x96, 0xBB,
+    0xB2, 0x38, 0xD6, 0x69, 0x48, 0xA2, 0xFB, 0xAE, 0x1C, 0x0B, 0xE4, 0x45, 0x49, 0x94, 0x32, 0x39,
+    0x6A, 0x18, 0x1F, 0xB9, 0x3B, 0x2B, 0xA4, 0x04, 0xBD, 0xB7, 0x4A, 0xD0, 0xC9, 0x25, 0x82, 0xEE,
+    0xCA, 0x32, 0x71, 0x72, 0x1A, 0x16, 0x38, 0x56, 0xA6, 0x70, 0x93, 0xEF, 0xAC, 0x18, 0x93, 0xAF,
+    0xEB, 0x2A, 0xDF, 0x23, 0xAD, 0x03, 0xA5, 0xCD, 0x58, 0xB2, 0x17, 0x5F, 0xF5, 0x3A, 0xB1, 0x2F,
+    0xD4, 0xA4, 0x9C, 0xFD, 0xE9, 0x06, 0xEF, 0xAD, 0x58, 0xFF, 0xE9, 0x90, 0xC9, 0x61, 0xBD, 0xF4,
+    0x71, 0xDB, 0x15, 0x7A, 0x8B, 0x86, 0xEA, 0x5B, 0x36, 0x91, 0xB3, 0x16, 0x7B, 0x93, 0xDF, 0x6B,
+    0x41, 0xB4, 0x02, 0x35, 0x71, 0x5E, 0x8E, 0x1C, 0x99, 0x3D, 0xE0, 0xC3, 0xEE, 0xF6, 0x6D, 0xBB,
+    0x6A, 0x88, 0x04, 0xFB, 0x48, 0x77, 0xF3, 0x0A, 0x00, 0xBA, 0x23, 0x57, 0x95, 0x69, 0x51, 0x42,
+    0xFF, 0x21, 0x90, 0x9D, 0x57, 0x97, 0x2F, 0x37, 0x5C, 0x74, 0x1D, 0xCD, 0x5B, 0x0C, 0xD6, 0xF7,
+    0xCF, 0xE8, 0x71, 0x07, 0x0D, 0x55, 0x0E, 0xDC, 0x58, 0x7D, 0xE8, 0x2D, 0x7F, 0xFC, 0x58, 0xB8,
+    0xE8, 0x4C, 0x98, 0x7F, 0x82, 0xFF, 0x76, 0x80, 0x6A, 0xCE, 0x4F, 0xDA, 0xBB, 0xDC, 0xB6, 0x79,
+    0x28, 0xD2, 0x6C, 0xED, 0x24, 0x07, 0xEF, 0x18, 0x66, 0xB3, 0x11, 0x5B, 0xBD, 0x0E, 0xFD, 0x27,
+    0x41, 0xEA, 0xF6, 0x82, 0xBE, 0xA5, 0xD3, 0xFC, 0xFF, 0x26, 0xD7, 0x1E, 0x8C, 0x87, 0xBF, 0x9E,
+    0x96, 0x8F, 0x74, 0xDE, 0xF2, 0xB1, 0x68, 0xAB, 0x24, 0xAB, 0x1C, 0x46, 0x7A, 0x39, 0xAC, 0x73,
+    0x34, 0x48, 0xF7, 0xC7, 0x12, 0xBD, 0x6B, 0x83, 0xAC, 0xB4, 0xCA, 0xFA, 0xBF, 0xC8, 0xDA, 0x6E,
+    0x5A, 0xC9, 0x96, 0x4B, 0x23, 0x98, 0xA6, 0xF9, 0xF8, 0x5D, 0xC0, 0x4D, 0x18, 0x8A, 0x24, 0x48,
+    0x15, 0x46, 0xEA, 0xB7, 0xBC, 0x3E, 0x38, 0xD6, 0x7E, 0xE6, 0x8B, 0x2B, 0x7D, 0x1F, 0xFF, 0x9A,
+    0x0F, 0x39, 0xA8, 0xF3, 0x60, 0xFC, 0x65, 0x98, 0x96, 0x33, 0x0A, 0x12, 0xC5, 0x4A, 0xFF, 0x91,
+    0x30, 0x4D, 0xB5, 0xFA, 0x82, 0x77, 0xA4, 0x2F, 0xD8, 0x8A, 0x94, 0xAD, 0xF2, 0x20, 0x5B, 0x16,
+    0xF3, 0x7D, 0xFA, 0xCF, 0xB3, 0xDC, 0x82, 0xAD, 0x8C, 0x6C, 0xE5, 0xE6, 0xFF, 0x02, 0xCD, 0x9A,
+    0x3F, 0x6C, 0x23, 0xC7, 0x15, 0xC6, 0xDF, 0xEE, 0x4A, 0xDA, 0x44, 0x84, 0xBD, 0x82, 0xA1, 0x00,
+    0x87, 0x38, 0x3A, 0x06, 0x81, 0x0B, 0xDB, 0xC9, 0xDD, 0xA6, 0x48, 0xE1, 0x42, 0x24, 0x37, 0x49,
+    0x91, 0x2E, 0x16, 0x10, 0xBB, 0xBE, 0x94, 0xEE, 0xAE, 0x71, 0x71, 0x05, 0x29, 0x6D, 0x9F, 0xE2,
+    0xAE, 0x4B, 0x69, 0x15, 0x2E, 0x92, 0x34, 0xA7, 0xE2, 0x8A, 0x2B, 0x28, 0x91, 0x01, 0xD2, 0x87,
+    0x80, 0x91, 0x7E, 0x93, 0x1C, 0x90, 0x22, 0x85, 0x36, 0x00, 0x03, 0xD0, 0x08, 0xC9, 0xCD, 0xF7,
+    0xBD, 0x37, 0xBB, 0x5C, 0xE9, 0x5A, 0x2E, 0xC9, 0x3D, 0x71, 0x8E, 0x94, 0x96, 0x33, 0xEF, 0xFD,
+    0xE6, 0xCD, 0xFB, 0x33, 0xB3, 0x22, 0xDE, 0x54, 0x44, 0x82, 0x19, 0x9A, 0x16, 0x9B, 0x68, 0x88,
+    0x26, 0xEE, 0xA3, 0xE9, 0xB0, 0x99, 0x9F, 0x0A, 0xEE, 0xE8, 0xE0, 0x8E, 0x1C, 0x4D, 0x38, 0xE9,
+    0xE2, 0x8E, 0x14, 0x4D, 0x5B, 0x62, 0x91, 0x5E, 0x51, 0x88, 0x8C, 0xD8, 0x2C, 0xFF, 0xF4, 0x52,
+    0xFC, 0x5C, 0xDA, 0x49, 0x90, 0x49, 0x94, 0x44, 0x63, 0xDC, 0xD4, 0x4E, 0xD1, 0xF4, 0x70, 0xFB,
+    0x78, 0x80, 0xAE, 0xC7, 0xB2, 0xBA, 0x42, 0x7E, 0x68, 0x4D, 0xCA, 0x77, 0x7A, 0xBD, 0x9F, 0x7D,
+    0x28, 0xA3, 0x79, 0x3F, 0x58, 0x3C, 0x99, 0xB5, 0xB2, 0x70, 0x1A, 0x8D, 0x83, 0x3C, 0xC6, 0x98,
+    0x3D, 0x09, 0xB2, 0x2E, 0x5E, 0x03, 0x0C, 0x3D, 0x44, 0x2F, 0x43, 0x74, 0x37, 0x94, 0x38, 0xED,
+    0xCB, 0x45, 0xD2, 0xF3, 0x6F, 0x93, 0xB8, 0x78, 0x2E, 0xAD, 0x45, 0x5B, 0x24, 0x71, 0xFD, 0xE4,
+    0x22, 0x3E, 0x14, 0xF2, 0xF2, 0x6A, 0xB4, 0x3F, 0xB2, 0x29, 0x38, 0x50, 0x30, 0x2E, 0x87, 0xBC,
+    0xE0, 0xED, 0xAF, 0xDC, 0xFD, 0x76, 0x6D, 0x0C, 0xC3, 0x12, 0xDD, 0xBD, 0x1C, 0x9B, 0x34, 0xFC,
+    0x3C, 0x72, 0x52, 0x5C, 0xAE, 0x15, 0x04, 0x04, 0xA0, 0x16, 0x29, 0x9A, 0xC5, 0x23, 0x34, 0x7E,
+    0x71, 0x44, 0xD5, 0x7E, 0xC7, 0x5F, 0x74, 0xFC, 0xFA, 0x6C, 0x54, 0xCA, 0x9B, 0xF6, 0xA6, 0xBE,
+    0xE9, 0x6F, 0x00, 0x8C, 0x80, 0x22, 0x30, 0x06, 0x06, 0xC1, 0x28, 0x18, 0x06, 0xE3, 0x60, 0x20,
+    0x8C, 0x84, 0xA2, 0x30, 0x16, 0xA2, 0x30, 0x44, 0x69, 0x88, 0xE2, 0x10, 0xE5, 0x21, 0x95, 0x5D,
+    0xF8, 0x2F, 0xC4, 0xDE, 0x5E, 0x3F, 0xA6, 0xA4, 0x1F, 0xE0, 0xC3, 0x5F, 0xA1, 0xC7, 0x23, 0xCA,
+    0x79, 0x54, 0x4D, 0x2D, 0xC9, 0x10, 0x8D, 0x90, 0x8D, 0x10, 0x8E, 0x90, 0x8E, 0x10, 0x8F, 0x90,
+    0x8F, 0x10, 0x90, 0x90, 0x90, 0x10, 0x91, 0x90, 0x91, 0x10, 0x92, 0x90, 0x92, 0x10, 0x93, 0x90,
+    0x93, 0x81, 0xB2, 0x7E, 0xD5, 0x26, 0x7C, 0xDA, 0xA2, 0x5C, 0x2D, 0xD0, 0xBC, 0x57, 0x94, 0x98,
+    0xEE, 0x51, 0xDA, 0x90, 0x7D, 0xF8, 0xA9, 0x13, 0x27, 0xBF, 0x16, 0xF9, 0x51, 0x61, 0x24, 0x08,
+    0xA2, 0xE4, 0xB0, 0xAE, 0x85, 0xA2, 0x57, 0xCF, 0x18, 0xA4, 0x3A, 0xEF, 0x7C, 0xBF, 0xF8, 0x44,
+    0x6D, 0x45, 0x76, 0xD7, 0x56, 0x4C, 0xEE, 0x4A, 0xEC, 0x10, 0x52, 0x5F, 0x77, 0x9C, 0x7D, 0x6F,
+    0xCC, 0x6A, 0xE0, 0x63, 0xDE, 0x81, 0x58, 0x05, 0x14, 0xFF, 0x41, 0x6B, 0x5A, 0x4A, 0xB5, 0x28,
+    0xD9, 0x6D, 0xD1, 0x7E, 0xC4, 0xBF, 0xFC, 0xAE, 0x44, 0xCB, 0xBE, 0x9C, 0xB4, 0xA7, 0x72, 0x4C,
+    0x69, 0xAF, 0x4D, 0xA8, 0x66, 0xEC, 0xE8, 0x98, 0x0D, 0x3D, 0x5A, 0x40, 0xBD, 0x23, 0xD3, 0x7B,
+    0x52, 0xE7, 0xBF, 0x1B, 0xE1, 0x45, 0x05, 0x5D, 0x9A, 0x98, 0x94, 0xB2, 0x13, 0x4C, 0xD6, 0xBE,
+    0xA2, 0xDE, 0x0E, 0x3D, 0x3E, 0x9D, 0x70, 0x8B, 0x66, 0xFA, 0x10, 0xAF, 0x07, 0x47, 0xBF, 0xC5,
+    0x1B, 0x2F, 0xA3, 0xE1, 0x40, 0x30, 0x7F, 0x29, 0xDB, 0xB0, 0x0F, 0xF1, 0x2E, 0x0D, 0x0C, 0x44,
+    0xDA, 0xFB, 0xE0, 0x4C, 0x4E, 0x20, 0x50, 0x74, 0x3B, 0x96, 0x90, 0x13, 0x78, 0xB6, 0xC6, 0x18,
+    0xA4, 0x9E, 0xD5, 0xD3, 0x30, 0xF4, 0x25, 0xB5, 0x3F, 0xBE, 0xA3, 0x7D, 0xB0, 0x1D, 0xED, 0xE9,
+    0x5E, 0x55, 0xA6, 0x2B, 0x68, 0x7F, 0xDC, 0xA0, 0xF6, 0x74, 0x58, 0xE8, 0x2A, 0x71, 0x2E, 0x4A,
+    0xE8, 0xF8, 0x1E, 0xFC, 0x70, 0x27, 0x0C, 0xE0, 0x23, 0x74, 0xF7, 0xD4, 0xC9, 0x85, 0x78, 0xBB,
+    0xF7, 0xD3, 0x06, 0x31, 0xF8, 0x6F, 0x4E, 0x9C, 0x9F, 0xFC, 0x49, 0xAB, 0x5C, 0x17, 0x0F, 0x64,
+    0x27, 0x2C, 0xE1, 0xF2, 0x1D, 0xF5, 0x93, 0x8F, 0xE8, 0x27, 0xBD, 0x44, 0xF6, 0xA4, 0x8E, 0x21,
+    0xA1, 0x0B, 0x5B, 0x1F, 0x86, 0xEF, 0xDC, 0x55, 0x59, 0xFB, 0x2F, 0x07, 0xD8, 0x15, 0x17, 0x49,
+    0x19, 0x29, 0x22, 0x25, 0x54, 0x01, 0xCF, 0x9A, 0xCD, 0xCC, 0x2F, 0x8A, 0x39, 0x24, 0x9F, 0xCB,
+    0xE2, 0xF3, 0xCF, 0x64, 0x6A, 0x10, 0xFC, 0xDC, 0x5E, 0x4C, 0x5E, 0xE1, 0xA0, 0x21, 0x46, 0x91,
+    0xB6, 0x8A, 0x22, 0x89, 0xFE, 0xF6, 0xB9, 0xA6, 0xB2, 0xC8, 0x0C, 0x84, 0x31, 0x38, 0x76, 0x0B,
+    0x8A, 0xAF, 0x73, 0x7C, 0xBD, 0xEC, 0xAA, 0xBA, 0xD8, 0xDF, 0xAC, 0x96, 0xDD, 0xBF, 0x3F, 0x23,
+    0x25, 0x09, 0xBE, 0x8D, 0xD3, 0xD6, 0x24, 0x4A, 0xF9, 0x2F, 0x06, 0xAA, 0xAE, 0x77, 0x83, 0xEF,
+    0xCE, 0xF0, 0x4A, 0x19, 0x26, 0x65, 0xE8, 0x5E, 0x03, 0x4D, 0x8D, 0x1E, 0x48, 0x1B, 0x7D, 0x86,
+    0x45, 0xE6, 0xC2, 0x9C, 0xC9, 0x7E, 0xD7, 0xC5, 0x7F, 0x0C, 0x89, 0x2E, 0x26, 0xE6, 0x53, 0xE8,
+    0xED, 0x91, 0x35, 0x08, 0x73, 0x9F, 0x9F, 0x35, 0xA7, 0xA3, 0x0F, 0x5D, 0x7C, 0x16, 0x0D, 0x91,
+    0xE6, 0x52, 0xE2, 0xCD, 0x2D, 0x63, 0x2C, 0xD3, 0x8D, 0xB5, 0xE8, 0x7A, 0xB6, 0x2F, 0xE1, 0xFC,
+    0x5D, 0x89, 0x46, 0x73, 0x2C, 0xDC, 0x29, 0x16, 0x47, 0xD2, 0x98, 0x3E, 0xFB, 0x58, 0x08, 0xBD,
+    0x49, 0x8E, 0x0F, 0x99, 0x64, 0x17, 0xA9, 0x24, 0x7B, 0x6B, 0x9D, 0x33, 0x5D, 0x5B, 0x90, 0xAB,
+    0xF7, 0x29, 0x04, 0x29, 0xFE, 0x82, 0x0F, 0xDF, 0x4C, 0xC8, 0xEE, 0xAA, 0xEE, 0x74, 0x28, 0x8C,
+    0x49, 0x43, 0xCD, 0xF4, 0x3B, 0xBA, 0x28, 0xA9, 0x98, 0x35, 0x5A, 0x4F, 0x05, 0xBA, 0x62, 0xA0,
+    0xA0, 0x50, 0x43, 0xA1, 0x8A, 0x56, 0x62, 0x51, 0x49, 0xD5, 0x52, 0xD5, 0x54, 0x1D, 0xAD, 0xA1,
+    0xA6, 0xB5, 0xDE, 0x71, 0x1D, 0xA6, 0x6E, 0xDA, 0xA6, 0x58, 0xDC, 0xE1, 0x1C, 0x95, 0x4F, 0x1B,
+    0x4E, 0x58, 0x9E, 0x31, 0xFD, 0x5E, 0xE5, 0xE6, 0x54, 0x9E, 0xDA, 0xAB, 0xFA, 0x42, 0xFD, 0x85,
+    0x00, 0x84, 0x04, 0x84, 0x08, 0x94, 0x81, 0x42, 0x50, 0x0A, 0x8A, 0xC0, 0x9A, 0x81, 0x38, 0x12,
+    0x8A, 0xC2, 0x58, 0x28, 0x0C, 0x8D, 0x7B, 0x2C, 0x7A, 0x4F, 0x91, 0xF6, 0xEF, 0x61, 0x95, 0x93,
+    0x44, 0x1D, 0x44, 0x03, 0xB3, 0x7B, 0xE8, 0x12, 0x20, 0xFF, 0xCF, 0xE8, 0xEC, 0xF7, 0x73, 0x53,
+    0x96, 0xBA, 0x26, 0xEB, 0x5D, 0x99, 0x5A, 0x86, 0xE8, 0x02, 0xA0, 0x92, 0x07, 0x78, 0xD7, 0xFB,
+    0xB5, 0x2B, 0xFB, 0xB7, 0x3C, 0xDF, 0x65, 0x61, 0x10, 0x69, 0x16, 0xE8, 0x4D, 0x5F, 0x63, 0xD2,
+    0x93, 0x46, 0x30, 0x78, 0xDF, 0x22, 0xA2, 0x07, 0xC5, 0x2D, 0x88, 0xFB, 0xF3, 0x3B, 0x15, 0x1E,
+    0xAD, 0x64, 0xAB, 0x18, 0x0E, 0x5E, 0x7C, 0x28, 0xF1, 0xE2, 0x95, 0x7C, 0xF2, 0x34, 0x93, 0x23,
+    0xCF, 0x46, 0x09, 0x9B, 0xB2, 0x86, 0x7D, 0xA7, 0x36, 0x2D, 0xFC, 0x9F, 0x0C, 0x86, 0x39, 0xFC,
+    0xD7, 0xD1, 0xC6, 0x63, 0x0E, 0xE3, 0x27, 0xE7, 0xA1, 0x85, 0xD9, 0x8F, 0xD1, 0xC3, 0x6B, 0xAC,
+    0x83, 0xC4, 0x4B, 0x9A, 0x8D, 0x47, 0x7F, 0xC0, 0x07, 0xC6, 0x6E, 0xAE, 0x39, 0x7A, 0x94, 0x1B,
+    0x5B, 0x11, 0xDE, 0xC4, 0x59, 0x03, 0x3C, 0xCA, 0xC5, 0x92, 0x59, 0x84, 0x25, 0x04, 0x7C, 0xDD,
+    0x57, 0xB2, 0xE7, 0x94, 0x64, 0xD9, 0xDE, 0x77, 0x02, 0xCC, 0x9C, 0x7E, 0x35, 0x5E, 0xF1, 0x92,
+    0x38, 0x79, 0x7F, 0x2A, 0x3F, 0xCE, 0xE8, 0x5C, 0x40, 0x0F, 0xEF, 0x4F, 0xCB, 0xE0, 0xF7, 0x35,
+    0xBF, 0x82, 0x6F, 0xE0, 0x66, 0xFC, 0x04, 0xFA, 0x77, 0x64, 0x1B, 0x18, 0xD2, 0xAA, 0x7B, 0x8C,
+    0xD9, 0xD6, 0x11, 0xBB, 0x36, 0x56, 0x13, 0xB2, 0xB9, 0x8B, 0x34, 0xE8, 0x1D, 0xA2, 0xAA, 0x28,
+    0xD5, 0xCF, 0xF8, 0x39, 0x2C, 0x6F, 0xF9, 0x48, 0x3B, 0x1D, 0x68, 0x97, 0x43, 0xED, 0x74, 0x4A,
+    0xAC, 0x94, 0xFC, 0x9E, 0xF0, 0xE9, 0xAA, 0x9B, 0xC7, 0x2A, 0x51, 0xA7, 0xB6, 0xA2, 0xFC, 0xE2,
+    0x0D, 0x86, 0x2F, 0x30, 0x7E, 0xF1, 0xF3, 0x51, 0x8A, 0x9C, 0x2E, 0x1A, 0xB7, 0x32, 0x09, 0x33,
+    0x0C, 0x85, 0xB4, 0x29, 0xD1, 0xBC, 0x09, 0x9D, 0x9E, 0xB3, 0x61, 0x61, 0x9E, 0x0F, 0x99, 0xD7,
+    0xCD, 0x5D, 0x13, 0x66, 0xB4, 0x97, 0xC9, 0x5C, 0x34, 0x97, 0x42, 0x32, 0x71, 0xCE, 0x01, 0x7A,
+    0x89, 0xB7, 0x90, 0x76, 0x86, 0xDC, 0x10, 0x76, 0x09, 0x38, 0x23, 0x26, 0xCC, 0x5E, 0x15, 0x2B,
+    0xDA, 0xD5, 0x86, 0xC8, 0xE3, 0x55, 0xF8, 0x78, 0xE3, 0xEC, 0xEB, 0xE9, 0xB8, 0x35, 0x09, 0xB3,
+    0x76, 0xCA, 0x9C, 0xCD, 0xCF, 0xBB, 0x78, 0x0D, 0xF0, 0xEA, 0x63, 0xB8, 0x21, 0xB4, 0x1A, 0x02,
+    0x76, 0x1F, 0x63, 0x9D, 0xC3, 0xF6, 0x7A, 0xC9, 0x0D, 0x52, 0xBF, 0x19, 0x34, 0x98, 0xAC, 0xD4,
+    0x79, 0xCD, 0xFC, 0xD3, 0x05, 0x51, 0xBD, 0x0E, 0xB8, 0x4B, 0xD9, 0x52, 0xAB, 0x57, 0xB5, 0x99,
+    0xEB, 0x04, 0xFC, 0x6B, 0x48, 0x7F, 0xD0, 0xDA, 0x0E, 0x06, 0x8F, 0xFE, 0xF5, 0x65, 0x62, 0x42,
+    0x70, 0x72, 0x96, 0x2E, 0x0E, 0x4C, 0xD6, 0x4A, 0x43, 0x7D, 0x9C, 0x9A, 0x5D, 0xF8, 0x77, 0xF6,
+    0xDE, 0xFE, 0x2F, 0x07, 0xEF, 0xF7, 0x75, 0x03, 0xF1, 0xE4, 0xDE, 0x2E, 0x99, 0x12, 0x30, 0x04,
+    0xCA, 0x40, 0x14, 0x82, 0x28, 0x05, 0x51, 0x0C, 0xA2, 0x1C, 0x44, 0x41, 0x88, 0x92, 0xD0, 0xAD,
+    0x9A, 0x5C, 0x94, 0x85, 0xCC, 0xCB, 0x16, 0xF7, 0x2B, 0x0E, 0x51, 0x1E, 0xA2, 0x40, 0x44, 0x89,
+    0x18, 0x12, 0x63, 0xE2, 0xA0, 0x18, 0x95, 0xCA, 0x3A, 0x0E, 0x34, 0xD9, 0xC0, 0x87, 0x19, 0x26,
+    0x2A, 0x58, 0xA0, 0x08, 0x89, 0x9E, 0x30, 0xD9, 0x08, 0x35, 0xD9, 0x48, 0x6A, 0xD6, 0xE2, 0x92,
+    0x8D, 0xA7, 0x10, 0x11, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x84, 0x94, 0x84, 0x98, 0x84, 0x9C, 0x84,
+    0xA0, 0x84, 0xA4, 0x84, 0xA8, 0x84, 0xAC, 0x84, 0xB0, 0x94, 0x56, 0x1D, 0xD7, 0xA9, 0xB8, 0xA0,
+    0x27, 0xE1, 0xAF, 0xE8, 0x81, 0x9E, 0x4C, 0x1D, 0xAC, 0x7B, 0xAC, 0x36, 0x6A, 0x2A, 0x87, 0xCE,
+    0x52, 0xBD, 0x09, 0x84, 0xFD, 0xCD, 0xC2, 0x70, 0x90, 0x46, 0x09, 0x63, 0x5D, 0x0B, 0x47, 0x2C,
+    0x4F, 0x47, 0xD9, 0xCB, 0xE6, 0x19, 0x46, 0xFD, 0x07, 0xFE, 0xDA, 0xDE, 0x05, 0x06, 0xE5, 0x75,
+    0x23, 0xE5, 0x8A, 0xE5, 0x2C, 0xCD, 0x9E, 0xD1, 0x40, 0x8E, 0x36, 0x68, 0x20, 0x10, 0x14, 0xC9,
+    0xC8, 0xE8, 0x7F, 0xF8, 0x05, 0xD3, 0x7E, 0x57, 0x98, 0xEA, 0xC2, 0x5A, 0x61, 0x7A, 0xB8, 0x3D,
+    0x4C, 0x07, 0x2F, 0x10, 0x70, 0x17, 0xAF, 0xE5, 0x34, 0xCE, 0x91, 0xB3, 0x24, 0x1A, 0x13, 0x82,
+    0xCA, 0x64, 0xD2, 0xF5, 0x9A, 0x8C, 0x8E, 0xA8, 0x3B, 0x24, 0x31, 0x95, 0x1F, 0x52, 0xF9, 0xEC,
+    0x21, 0x7F, 0xBF, 0xBF, 0x5B, 0x91, 0xA5, 0xCC, 0x6A, 0x42, 0xDC, 0xDA, 0x86, 0xE1, 0xF4, 0x11,
+    0x15, 0xCF, 0xD6, 0xBC, 0x78, 0xDE, 0x8A, 0x3A, 0xF2, 0x3D, 0x6D, 0xAF, 0x6B, 0xC7, 0x0F, 0x7A,
+    0xBB, 0x05, 0xE2, 0xBD, 0x92, 0x10, 0xC2, 0x75, 0x91, 0xD1, 0x2C, 0x8B, 0x25, 0xCC, 0x0F, 0x98,
+    0xBE, 0x52, 0x4E, 0x8B, 0x0D, 0x7B, 0x5D, 0xFD, 0x4F, 0x8B, 0x91, 0xB8, 0x0C, 0x18, 0x96, 0xA0,
+    0x25, 0xBE, 0x16, 0xA3, 0x39, 0x40, 0xA1, 0xFB, 0x51, 0xF1, 0xE9, 0x18, 0xA8, 0x96, 0x5C, 0x4F,
+    0xF9, 0x3A, 0xD6, 0xD3, 0x67, 0x52, 0xD5, 0x80, 0x2E, 0x27, 0x69, 0x57, 0xD9, 0xCF, 0x6A, 0x5A,
+    0x77, 0x84, 0xD2, 0x7E, 0x55, 0xB1, 0xE9, 0x0E, 0x94, 0xEE, 0x94, 0xDB, 0x84, 0x1F, 0x35, 0x4B,
+    0x49, 0x33, 0x18, 0x97, 0xC2, 0x38, 0x4C, 0x1A, 0xAA, 0x34, 0x8B, 0xB1, 0x34, 0xA6, 0xCA, 0x63,
+    0x76, 0x84, 0x95, 0xE6, 0x37, 0x9A, 0xE0, 0x98, 0x7C, 0x6A, 0xF6, 0xCB, 0xB2, 0xD8, 0x95, 0x49,
+    0xB3, 0xC0, 0xD4, 0xF7, 0xF9, 0x05, 0x23, 0x42, 0x70, 0xAB, 0xA7, 0x5B, 0xFE, 0x42, 0x57, 0xDD,
+    0xD1, 0x8E, 0x19, 0x14, 0xE4, 0x89, 0xB3, 0x2B, 0x66, 0xFE, 0x58, 0x6D, 0x79, 0x0F, 0x66, 0x95,
+    0x78, 0xCD, 0xA2, 0x91, 0x1D, 0xF3, 0x3C, 0x35, 0x9B, 0x3E, 0x5F, 0x59, 0xF6, 0x3D, 0x59, 0x1B,
+    0x27, 0x92, 0x97, 0xA3, 0xAC, 0xCA, 0x52, 0x2C, 0x6F, 0x3F, 0x67, 0x15, 0x95, 0xC3, 0x71, 0x07,
+    0x19, 0x96, 0x7C, 0x30, 0x41, 0x2D, 0x15, 0x8E, 0x99, 0x12, 0x8F, 0x6D, 0x73, 0x2B, 0xE1, 0x8E,
+    0x35, 0xB3, 0xD5, 0x98, 0x8E, 0xB3, 0xEB, 0x9A, 0x2E, 0x6B, 0xB2, 0x0E, 0x9D, 0x68, 0xDF, 0x4A,
+    0x33, 0x2D, 0xCE, 0x86, 0x0C, 0x03, 0x03, 0xC5, 0x99, 0xC6, 0x63, 0xD4, 0xC5, 0xA8, 0x79, 0x43,
+    0xCA, 0x22, 0xFB, 0x77, 0x39, 0x5C, 0x97, 0x1E, 0x58, 0xDC, 0x73, 0x06, 0x5F, 0xF0, 0x98, 0x17,
+    0xE3, 0xCF, 0x30, 0xFC, 0x34, 0x4A, 0xBD, 0x3C, 0x4A, 0xFC, 0x9C, 0x9B, 0xE6, 0x31, 0xE4, 0xEA,
+    0xE9, 0xF6, 0x7A, 0x6B, 0xDC, 0xD1, 0x2D, 0x73, 0xDB, 0xCB, 0x3E, 0xF7, 0x6F, 0x93, 0x5E, 0xF1,
+    0x1C, 0x93, 0xB9, 0xDA, 0xCB, 0x7E, 0xBB, 0xEE, 0xFE, 0xBE, 0x26, 0xDA, 0xFA, 0xF1, 0x55, 0xE9,
+    0xC9, 0x5A, 0x99, 0x3B, 0xF8, 0x93, 0x93, 0x2D, 0x61, 0xB8, 0xA9, 0x3D, 0x6A, 0x42, 0x37, 0x7B,
+    0x61, 0x07, 0x5F, 0xEE, 0x51, 0x93, 0x35, 0xD1, 0xB0, 0xBD, 0x88, 0x79, 0x65, 0x5B, 0x5A, 0xC0,
+    0xBB, 0xD4, 0xBF, 0x8A, 0xCD, 0x32, 0x54, 0xDD, 0xE7, 0x54, 0xFE, 0x3F, 0x53, 0x6A, 0xFF, 0x2F,
+    0x55, 0xBF, 0x48, 0xA8, 0xFF, 0x1B, 0x2D, 0x8D, 0xAC, 0xB6, 0xD6, 0xF2, 0x9A, 0x87, 0xFF, 0x5A,
+    0xB8, 0xC4, 0xE5, 0x0E, 0x81, 0xB5, 0x5D, 0x31, 0x0E, 0x06, 0xC2, 0xD5, 0xEA, 0x56, 0xAE, 0x2B,
+    0x0B, 0x98, 0x26, 0x60, 0x90, 0x06, 0xB3, 0x6D, 0xE2, 0x80, 0x75, 0xCE, 0x64, 0x65, 0x17, 0xDE,
+    0x59, 0x95, 0x65, 0xDA, 0x16, 0x96, 0xED, 0x57, 0x69, 0xCA, 0x41, 0x85, 0xDA, 0x89, 0x55, 0x7A,
+    0x64, 0xD3, 0xD5, 0x47, 0x02, 0xE6, 0x24, 0x57, 0x64, 0x14, 0x6F, 0xC9, 0xEF, 0x70, 0xCE, 0x49,
+    0x49, 0xEC, 0xA8, 0x85, 0xCF, 0x11, 0x64, 0x5C, 0x9C, 0xD4, 0xBA, 0xAB, 0x9B, 0x16, 0x1D, 0x8D,
+    0x6B, 0x03, 0x3D, 0x0B, 0xD0, 0x47, 0x08, 0x84, 0xD4, 0xB8, 0xC1, 0xF1, 0x9C, 0xA3, 0xEA, 0x53,
+    0x04, 0xA5, 0x25, 0x9D, 0xAD, 0xE0, 0xDD, 0x8D, 0xD9, 0x89, 0xDB, 0xA6, 0xD8, 0x25, 0x7A, 0xE6,
+    0x65, 0x6C, 0x7A, 0x83, 0xBC, 0xDA, 0x5D, 0x2F, 0x17, 0xD8, 0xDE, 0xC6, 0xE9, 0xE9, 0x5E, 0xBA,
+    0x95, 0x0B, 0xE5, 0x14, 0xEA, 0xEA, 0xD3, 0x95, 0x27, 0xEF, 0x4A, 0x7D, 0xED, 0xED, 0x8A, 0x05,
+    0x6A, 0xD9, 0xA5, 0xAB, 0xD2, 0x1D, 0x91, 0xBB, 0x23, 0xB8, 0x8B, 0x95, 0xF8, 0x58, 0x9F, 0x1B,
+    0xB7, 0x43, 0x9A, 0x9A, 0xBF, 0x64, 0x90, 0x0F, 0xF5, 0x91, 0x9C, 0x28, 0x98, 0xD7, 0x83, 0xFC,
+    0xCE, 0x58, 0xE0, 0xB1, 0x4E, 0x38, 0x9F, 0x52, 0xEA, 0x32, 0xCC, 0xCB, 0x97, 0xBC, 0x93, 0x7B,
+    0xCA, 0x9B, 0x26, 0x26, 0x3B, 0x66, 0x57, 0x35, 0x17, 0x72, 0x2D, 0x77, 0xA2, 0x5E, 0xFD, 0xDA,
+    0x0A, 0x25, 0x5D, 0x9F, 0xBA, 0x37, 0x5E, 0xDB, 0x1D, 0x77, 0x92, 0xD3, 0x09, 0xB3, 0x53, 0x2D,
+    0xE8, 0xF2, 0xEA, 0x54, 0x1C, 0x8A, 0x0C, 0xBB, 0xF8, 0x0E, 0x4F, 0x9A, 0xDB, 0x3C, 0xFF, 0x4A,
+    0xB8, 0x47, 0xDE, 0xD3, 0x73, 0xE6, 0x70, 0x3C, 0x93, 0xE0, 0x9B, 0x5C, 0x82, 0x7F, 0x8F, 0xC1,
+    0x20, 0x11, 0xAF, 0x70, 0x2E, 0xB4, 0xDC, 0x09, 0xAE, 0xEF, 0xE8, 0x67, 0xAB, 0x0D, 0x65, 0x57,
+    0x21, 0x0D, 0x2A, 0xAF, 0x1F, 0xAD, 0x56, 0x5F, 0x29, 0xEE, 0x17, 0xE2, 0x5F, 0x42, 0x29, 0x7C,
+    0x65, 0x40, 0x2D, 0x3B, 0x7A, 0xDC, 0xC6, 0xD4, 0xAB, 0x4B, 0x9E, 0x31, 0x87, 0x88, 0x95, 0x0D,
+    0x3B, 0x8E, 0x74, 0x8B, 0x5A, 0xF7, 0xA8, 0xF9, 0x3C, 0x45, 0x34, 0x28, 0x0B, 0x8B, 0x50, 0x77,
+    0x44, 0xF3, 0xD2, 0x59, 0x6A, 0xA0, 0x89, 0xCB, 0xAC, 0x8C, 0xE7, 0xB5, 0x32, 0xE2, 0x1F, 0x47,
+    0x69, 0x63, 0x9A, 0xBA, 0x13, 0x31, 0x6E, 0x9D, 0xA7, 0x65, 0x2C, 0x6E, 0x56, 0x3D, 0x56, 0x99,
+    0xE7, 0xE8, 0xD3, 0x9B, 0x63, 0xD4, 0x95, 0x7A, 0xE2, 0x7F, 0x6D, 0xDB, 0x26, 0x9A, 0x09, 0x3D,
+    0xB6, 0xCD, 0x03, 0xFA, 0x3D, 0x7B, 0xE8, 0xB0, 0x21, 0xF5, 0x23, 0x06, 0x80, 0xC3, 0x79, 0x95,
+    0x02, 0x0F, 0xCB, 0xA0, 0xA0, 0x24, 0x0E, 0x65, 0x6B, 0xB3, 0xED, 0x4E, 0xBB, 0xAF, 0xDC, 0x69,
+    0xF7, 0xB8, 0x34, 0xBC, 0x66, 0x30, 0xF0, 0xB9, 0x16, 0xAF, 0xF8, 0x65, 0xCA, 0xC2, 0x0D, 0x99,
+    0xE1, 0x2F, 0x96, 0x4C, 0x29, 0x8E, 0xB6, 0xA6, 0xFC, 0xFF, 0x01, 0xB5, 0x58, 0x3F, 0x6C, 0xDC,
+    0xD6, 0x19, 0xFF, 0x91, 0x4F, 0x2A, 0x53, 0xB3, 0xCE, 0xF3, 0x70, 0x2E, 0x9C, 0xA2, 0x06, 0x3B,
+    0x78, 0x08, 0x0C, 0xF9, 0xAE, 0x83, 0x07, 0x05, 0xB8, 0x3B, 0xB2, 0xF2, 0x10, 0xA0, 0x4B, 0x34,
+    0x38, 0x1D, 0xD2, 0x25, 0x4B, 0x81, 0xD6, 0x43, 0x93, 0x41, 0x83, 0x02, 0x9C, 0x7C, 0x2F, 0xF6,
+    0xD8, 0x45, 0x4B, 0xC6, 0x02, 0x2A, 0xE0, 0xC1, 0xD6, 0x90, 0x6A, 0xD0, 0x70, 0x30, 0x4E, 0x12,
+    0xED, 0xA0, 0xCD, 0xD0, 0xC1, 0x6C, 0x33, 0x74, 0xC8, 0x10, 0xA6, 0x09, 0x50, 0xA0, 0x4B, 0x38,
+    0xB0, 0x01, 0xE5, 0xF0, 0x8E, 0xFD, 0x7D, 0x8F, 0x3C, 0x9D, 0x94, 0xD8, 0x95, 0x3C, 0x84, 0x8F,
+    0xEF, 0x91, 0x47, 0xBE, 0xF7, 0xFD, 0x7B, 0xDF, 0xF7, 0xFB, 0x3E, 0x1E, 0xE0, 0x18, 0xA4, 0xB7,
+    0x46, 0x0F, 0x47, 0x5B, 0xE9, 0x9F, 0xCC, 0x16, 0x4E, 0x6F, 0x80, 0x1B, 0xF9, 0x68, 0x3F, 0x68,
+    0x7F, 0xE8, 0x9F, 0x73, 0x7F, 0x89, 0x73, 0xA7, 0xB7, 0xB0, 0x02, 0xCF, 0x8B, 0x6F, 0xE2, 0xE8,
+    0xE6, 0x27, 0xDB, 0xDB, 0x5B, 0x61, 0x55, 0x65, 0x57, 0x79, 0x45, 0x7D, 0xF0, 0x27, 0x8F, 0xB2,
+    0xBE, 0x14, 0x17, 0xDF, 0x94, 0x63, 0x95, 0xCF, 0x77, 0x55, 0xFC, 0x7D, 0x9C, 0x73, 0xAE, 0x86,
+    0x42, 0x44, 0x72, 0x4F, 0x9E, 0x38, 0xA8, 0x2A, 0x90, 0x31, 0xD9, 0x3A, 0x99, 0x4A, 0xBD, 0x58,
+    0x9B, 0x4E, 0x14, 0xA2, 0x05, 0xAC, 0xAA, 0xCC, 0x4B, 0xFD, 0x58, 0x47, 0x01, 0x7A, 0x58, 0xC6,
+    0x78, 0x3C, 0x1E, 0x74, 0xBB, 0xDD, 0x05, 0xAC, 0x5E, 0x54, 0xD9, 0x9E, 0x97, 0x96, 0xFE, 0xA3,
+    0x5C, 0xAF, 0x64, 0x81, 0x4A, 0x7A, 0xBE, 0x59, 0xF6, 0x31, 0x6A, 0xA3, 0xEC, 0x60, 0xDC, 0xC1,
+    0x20, 0x40, 0x57, 0x37, 0xE7, 0x82, 0x53, 0xF3, 0x04, 0xFA, 0x20, 0x15, 0x74, 0x41, 0x4A, 0xBF,
+    0x79, 0xEF, 0xB7, 0x07, 0x55, 0xF1, 0xF0, 0xE9, 0x2E, 0x32, 0x20, 0x85, 0x93, 0xC0, 0x4D, 0x40,
+    0xF9, 0x78, 0x7A, 0x31, 0x7C, 0x03, 0x1D, 0x21, 0x88, 0xD0, 0xB1, 0xEB, 0x78, 0xDE, 0x6E, 0x24,
+    0xC7, 0xB8, 0xE9, 0x05, 0x7B, 0x66, 0xBB, 0x4B, 0x8B, 0x2A, 0x76, 0xC7, 0xA5, 0x7A, 0xA2, 0x22,
+    0x09, 0xC0, 0x67, 0xD7, 0x06, 0x42, 0x06, 0x9A, 0x4A, 0xBE, 0xBC, 0x88, 0x0E, 0x95, 0x0C, 0xF7,
+    0xA7, 0x56, 0x00, 0xDB, 0x07, 0xEC, 0x65, 0x43, 0x0A, 0x3A, 0x0F, 0x4B, 0xB6, 0x49, 0x58, 0x76,
+    0x4A, 0x3F, 0xE5, 0x83, 0x1F, 0x5A, 0x02, 0x3A, 0x87, 0x9E, 0x22, 0xA8, 0xE2, 0xCE, 0x14, 0x61,
+    0x82, 0xD7, 0xAC, 0x0C, 0xAD, 0xFD, 0xE9, 0xE4, 0xC2, 0x22, 0x5A, 0x21, 0xF6, 0x87, 0x98, 0x0E,
+    0x51, 0xB6, 0xC0, 0x9F, 0x1D, 0x13, 0x9A, 0x10, 0x0B, 0xB8, 0x75, 0xFF, 0xE1, 0xFD, 0xB3, 0x78,
+    0x94, 0xB4, 0xAB, 0x0F, 0xAE, 0x7E, 0x78, 0x16, 0x5F, 0xB2, 0x0D, 0xC3, 0xC9, 0xBC, 0xB9, 0xE6,
+    0xF4, 0x26, 0x2B, 0xDE, 0x45, 0xDD, 0xCE, 0xBE, 0x02, 0xE7, 0xEB, 0x76, 0xD6, 0x15, 0xF5, 0xE1,
+    0x54, 0xC0, 0x3A, 0xAF, 0x7E, 0x15, 0xDB, 0x7D, 0xD1, 0x37, 0x62, 0x95, 0xF0, 0xDA, 0x56, 0x89,
+    0x2F, 0x93, 0xBA, 0x2A, 0x09, 0x64, 0xDE, 0x40, 0xC5, 0x62, 0x7B, 0xAC, 0xAB, 0x38, 0x97, 0xEB,
+    0xC8, 0x7B, 0x2C, 0xD6, 0xC6, 0xAE, 0xFF, 0xFA, 0x5F, 0xBF, 0xC4, 0xEF, 0x31, 0xD2, 0x3A, 0x98,
+    0xA8, 0x2A, 0x1E, 0xF4, 0x7B, 0x1B, 0x1D, 0xFF, 0xE3, 0x24, 0x2C, 0x47, 0xB9, 0x0E, 0xDC, 0x54,
+    0x7F, 0x9E, 0x65, 0xBA, 0xED, 0xA6, 0x50, 0x8F, 0x53, 0xDD, 0xA5, 0xB3, 0xE8, 0x95, 0x24, 0x20,
+    0x51, 0x61, 0xD0, 0x26, 0x51, 0x21, 0xDC, 0x5B, 0xE7, 0xD6, 0x67, 0x64, 0xB0, 0xEE, 0x47, 0x2A,
+    0x51, 0x49, 0x4E, 0x37, 0xF4, 0x8D, 0xF3, 0x4D, 0x16, 0xEE, 0x81, 0xCC, 0x0F, 0x4C, 0x60, 0x59,
+    0x2E, 0xC0, 0x89, 0x30, 0x3F, 0x66, 0x92, 0xCF, 0x65, 0x9F, 0x4B, 0x3F, 0x97, 0x7F, 0xAE, 0xC1,
+    0x5C, 0x87, 0xB9, 0x16, 0x73, 0x3D, 0xE6, 0x9A, 0xF8, 0x9B, 0x33, 0x5D, 0x86, 0xF9, 0x4C, 0x9B,
+    0x7C, 0xDC, 0xE8, 0xF3, 0x45, 0xDA, 0x6D, 0x34, 0xFA, 0x82, 0xB4, 0x6A, 0x9D, 0xFE, 0x69, 0xBA,
+    0x8D, 0x56, 0x9F, 0x9A, 0x41, 0xA3, 0xD7, 0x93, 0x68, 0xBD, 0xD1, 0xEC, 0x49, 0xB4, 0xDB, 0xE8,
+    0xF6, 0x46, 0x94, 0x35, 0xDA, 0xF9, 0x2B, 0x69, 0xA3, 0x9F, 0xF7, 0x55, 0xDC, 0x68, 0xE8, 0x56,
+    0x8D, 0x8E, 0xC0, 0x05, 0xF1, 0xF1, 0x82, 0x21, 0x9D, 0x78, 0x46, 0xE3, 0x32, 0x5E, 0x85, 0x04,
+    0x26, 0x8A, 0x3E, 0x9C, 0x6C, 0x0C, 0x52, 0x80, 0x77, 0x27, 0x85, 0xA6, 0xF1, 0x2E, 0x7B, 0x11,
+    0x5E, 0x3D, 0x27, 0xAA, 0x05, 0x8C, 0x9C, 0xA2, 0xAF, 0x23, 0xCE, 0xE8, 0xC8, 0x94, 0xAE, 0xCC,
+    0x19, 0xC9, 0xA4, 0x8C, 0xB3, 0x56, 0x12, 0x4E, 0xE3, 0xA6, 0xF7, 0x18, 0xCB, 0x01, 0x03, 0x4B,
+    0x83, 0x96, 0xA6, 0x17, 0xF4, 0x02, 0xF4, 0x03, 0x04, 0x3A, 0xD2, 0xBE, 0xD1, 0x9E, 0xF1, 0x69,
+    0xBE, 0x3B, 0xB1, 0xFB, 0x3E, 0x9F, 0xEB, 0xA8, 0x1F, 0x68, 0x13, 0xE8, 0xD7, 0x63, 0xED, 0xDF,
+    0x8D, 0xB5, 0x77, 0x37, 0xF6, 0x6F, 0x3C, 0x4E, 0xD4, 0x9D, 0x47, 0x29, 0x5F, 0x6F, 0x8A, 0x94,
+    0x3E, 0x23, 0x3D, 0x46, 0x3F, 0xC6, 0x4E, 0xE2, 0x24, 0xA9, 0x8A, 0x77, 0x34, 0xDE, 0xBD, 0x86,
+    0xEB, 0xCB, 0x8C, 0xD1, 0x0B, 0x18, 0x38, 0x99, 0x97, 0x04, 0xD1, 0x6D, 0xC6, 0x7C, 0x8F, 0x68,
+    0xA0, 0x23, 0xDF, 0x48, 0x88, 0xBB, 0x90, 0xAB, 0x4A, 0x9D, 0x8C, 0xD1, 0x3B, 0x76, 0x0A, 0x99,
+    0xD3, 0xC3, 0xDA, 0xD1, 0x9E, 0x2E, 0x48, 0xE0, 0xF3, 0x49, 0x60, 0xB8, 0x69, 0x51, 0x10, 0x69,
+    0xE3, 0x25, 0x0E, 0x65, 0x76, 0x72, 0x1B, 0xEE, 0x1B, 0x50, 0xDC, 0x2C, 0x79, 0x4C, 0xB4, 0x48,
+    0xFA, 0xE2, 0x04, 0x79, 0x21, 0xE0, 0x34, 0x4C, 0x55, 0xBA, 0x4F, 0x71, 0x54, 0xB6, 0xC1, 0x70,
+    0x57, 0x59, 0x0B, 0x87, 0x39, 0x22, 0xCE, 0xDE, 0x10, 0xA7, 0x30, 0x44, 0x24, 0x12, 0xF1, 0x12,
+    0x21, 0x42, 0x52, 0x42, 0x64, 0x83, 0x8F, 0x09, 0x8F, 0x11, 0xED, 0x61, 0xBC, 0xF8, 0x12, 0x47,
+    0x66, 0x16, 0x2C, 0x5A, 0xC4, 0x73, 0x0A, 0xDC, 0x76, 0x73, 0xEC, 0xB9, 0x19, 0xC6, 0x2A, 0x43,
+    0xC9, 0xF9, 0x05, 0x7B, 0x4E, 0x59, 0x32, 0x3F, 0x76, 0x33, 0x4D, 0x0D, 0x34, 0x25, 0xD4, 0x91,
+    0xE2, 0xEE, 0x79, 0xD2, 0x4D, 0x9B, 0xF6, 0xE8, 0x1D, 0xE9, 0xB1, 0x88, 0xB7, 0x49, 0xA6, 0xC4,
+    0xD0, 0x65, 0x27, 0xB9, 0x16, 0x24, 0x39, 0xE0, 0x07, 0x55, 0x1C, 0x56, 0x79, 0xFB, 0xB0, 0x74,
+    0xF2, 0xB1, 0x9B, 0x0D, 0x78, 0xAA, 0xB4, 0x54, 0x7F, 0xCF, 0xD5, 0xDF, 0x52, 0xEF, 0x2B, 0xE3,
+    0x4F, 0xE0, 0x13, 0xB6, 0x62, 0xB1, 0x81, 0x9E, 0x51, 0xBA, 0xC4, 0xD0, 0xA6, 0x83, 0x00, 0x7B,
+    0x10, 0x60, 0x97, 0x83, 0x80, 0x48, 0x32, 0x95, 0x8D, 0x85, 0x9F, 0x03, 0x3F, 0xBA, 0x4E, 0x60,
+    0x5E, 0x22, 0xA2, 0x6A, 0x8A, 0xE2, 0xFD, 0x67, 0x9F, 0xB3, 0x1B, 0x8F, 0x26, 0xF6, 0x39, 0x87,
+    0xBF, 0x8E, 0x3D, 0x83, 0xEC, 0x32, 0x70, 0x9D, 0xF3, 0x96, 0xDE, 0xB6, 0x14, 0x45, 0x55, 0xC5,
+    0xEE, 0x73, 0xD2, 0xE5, 0x06, 0x55, 0x77, 0x20, 0x80, 0x0E, 0x01, 0x63, 0x3A, 0x15, 0x5E, 0xE6,
+    0xCF, 0x6B, 0xB0, 0xC0, 0x0F, 0x62, 0xAF, 0xF3, 0x29, 0x57, 0xFC, 0x81, 0x2B, 0x3C, 0xBE, 0xE2,
+    0xFB, 0x2E, 0x97, 0xAF, 0x29, 0x83, 0xE3, 0xC7, 0xE0, 0x5B, 0xD7, 0x91, 0x1D, 0x3D, 0xFA, 0xBF,
+    0x0D, 0xD2, 0x7C, 0xA7, 0x0E, 0xDB, 0x83, 0xFF, 0xFE, 0xAE, 0x7E, 0x51, 0x4D, 0xEA, 0x17, 0xCD,
+    0xEF, 0xF6, 0x7A, 0x93, 0x29, 0xEA, 0x18, 0x75, 0xB3, 0xC6, 0x9C, 0x49, 0xC7, 0xFE, 0x14, 0x9B,
+    0x6C, 0xD6, 0x49, 0x02, 0x79, 0x73, 0xCD, 0x70, 0x81, 0x5E, 0xB8, 0xC0, 0xEB, 0x06, 0x55, 0xD1,
+    0xEF, 0x27, 0x38, 0xF8, 0x8C, 0xFE, 0xF1, 0x34, 0xA6, 0xA5, 0xAB, 0x14, 0xC3, 0xAA, 0x44, 0x78,
+    0x90, 0x10, 0x1F, 0x4A, 0x7C, 0x43, 0x9D, 0xDA, 0x29, 0xBC, 0x4F, 0xB8, 0xAE, 0xC8, 0x10, 0xDC,
+    0x65, 0xCE, 0xCA, 0x46, 0xE8, 0x10, 0x99, 0xBC, 0x78, 0x80, 0x97, 0xE8, 0x91, 0x4E, 0x24, 0x1E,
+    0x45, 0x1E, 0xB8, 0x82, 0x70, 0x1A, 0x4E, 0x2E, 0xDE, 0x14, 0xBE, 0x02, 0x27, 0x92, 0x95, 0x60,
+    0x41, 0xC4, 0xCA, 0x54, 0x58, 0xF1, 0xD0, 0x08, 0x21, 0xA9, 0x0A, 0xED, 0x23, 0xC5, 0xE5, 0xB9,
+    0xC5, 0x20, 0x0B, 0x3F, 0x76, 0x91, 0x55, 0x48, 0xF0, 0xC6, 0x4D, 0x8F, 0x16, 0x1D, 0x11, 0xAB,
+    0xAD, 0xC4, 0x64, 0x25, 0xF9, 0xEA, 0xA6, 0x64, 0xCE, 0xA3, 0x74, 0x3B, 0xB0, 0x29, 0xB3, 0x90,
+    0xB5, 0xF4, 0x5A, 0xA7, 0x8A, 0xDD, 0x8A, 0x9E, 0x27, 0xD4, 0x25, 0xD7, 0xC6, 0x36, 0xCF, 0x45,
+    0x36, 0xE3, 0xC2, 0x66, 0xDC, 0x9B, 0x08, 0x0B, 0x5C, 0xBD, 0x47, 0xD6, 0x96, 0xDA, 0xE2, 0xC6,
+    0x77, 0xA8, 0x64, 0x72, 0x0A, 0x18, 0xA7, 0x4E, 0x95, 0x90, 0xE0, 0x31, 0x2A, 0x68, 0xA8, 0xCC,
+    0xB8, 0x5F, 0x1C, 0xCF, 0xA8, 0xA1, 0x76, 0xDD, 0x4D, 0xB7, 0x4A, 0xE9, 0xBD, 0x41, 0x55, 0xB6,
+    0x57, 0x4A, 0xFD, 0x8B, 0x89, 0x25, 0xDB, 0xB7, 0xF4, 0x43, 0x3B, 0xF6, 0x6D, 0x5A, 0xEE, 0xD9,
+    0x60, 0x2D, 0xC1, 0x64, 0xAC, 0x72, 0x26, 0x57, 0x04, 0x89, 0x38, 0xD0, 0x50, 0x7E, 0x31, 0x12,
+    0x28, 0x39, 0x55, 0x20, 0x43, 0xDE, 0xE8, 0xC6, 0x48, 0xF3, 0xE3, 0x92, 0x0D, 0x41, 0x3A, 0x7C,
+    0x18, 0x89, 0xCF, 0x73, 0xDC, 0xB3, 0xD4, 0x5B, 0x02, 0x0D, 0x73, 0x41, 0x72, 0xCA, 0xA1, 0x32,
+    0x8A, 0xC1, 0xE8, 0x64, 0x88, 0xD2, 0xAA, 0x03, 0x09, 0x6E, 0x3B, 0x94, 0x54, 0xC9, 0xC9, 0x19,
+    0x45, 0x3E, 0x63, 0x94, 0xFC, 0xC9, 0x8A, 0x86, 0xB5, 0xB2, 0x08, 0xCF, 0xB6, 0xF0, 0xEE, 0x09,
+    0xEB, 0xEE, 0x49, 0xBE, 0xAB, 0x64, 0xEB, 0x16, 0xE4, 0xAA, 0x4A, 0x32, 0x65, 0xF8, 0x93, 0xE7,
+    0x51, 0xBA, 0x09, 0x71, 0x40, 0x03, 0xDE, 0xF6, 0x58, 0x8A, 0x60, 0x4F, 0x25, 0xA1, 0x11, 0xDD,
+    0xC9, 0xA3, 0xB4, 0x63, 0x61, 0xC7, 0x5C, 0x5C, 0x81, 0xE6, 0xE5, 0x64, 0x71, 0x8E, 0x89, 0xE8,
+    0x49, 0xAE, 0xDC, 0xAD, 0xC0, 0xD6, 0x47, 0x7D, 0xBB, 0xF5, 0x9C, 0xEB, 0x19, 0x99, 0xE5, 0x47,
+    0x6E, 0x7A, 0x42, 0x77, 0x6A, 0x2E, 0xF9, 0x2D, 0x84, 0x4E, 0xC4, 0x04, 0xCD, 0x18, 0x8B, 0xF2,
+    0x52, 0x89, 0xB1, 0xEE, 0xBB, 0xCF, 0xA8, 0x2F, 0x59, 0xF7, 0x15, 0xB5, 0xFB, 0x89, 0x97, 0xC9,
+    0x7B, 0xF1, 0xB1, 0x7E, 0x5D, 0x5E, 0x89, 0xE9, 0xC5, 0x1C, 0xB3, 0x32, 0x8A, 0xA6, 0xC3, 0xC6,
+    0xAC, 0x54, 0x02, 0x2A, 0x86, 0x1C, 0xEB, 0x55, 0x93, 0x0D, 0xAB, 0x84, 0x3D, 0x6B, 0x7A, 0xFE,
+    0x8C, 0x2E, 0xCF, 0x53, 0xF6, 0x38, 0x1B, 0x4E, 0x91, 0xAD, 0x45, 0xEC, 0x38, 0x53, 0xDF, 0xBA,
+    0x42, 0x46, 0xB7, 0xB6, 0xEF, 0xB3, 0xB4, 0x2B, 0x75, 0x75, 0x38, 0xE8, 0x54, 0xF9, 0x12, 0xB7,
+    0x6B, 0x69, 0xF8, 0x8C, 0x1E, 0x36, 0x3D, 0x60, 0xF7, 0x39, 0x9F, 0x05, 0x6D, 0x79, 0x6B, 0xFB,
+    0x1E, 0x03, 0xB7, 0x32, 0xEF, 0x91, 0xFF, 0x1A, 0x5F, 0xB2, 0x17, 0xEC, 0xE5, 0x73, 0xBA, 0xBC,
+    0xA7, 0x98, 0x4C, 0xD6, 0xD5, 0x21, 0x1A, 0xE0, 0xA8, 0x03, 0x8D, 0xE6, 0xB9, 0x46, 0xB3, 0x87,
+    0x9F, 0x18, 0x02, 0xC0, 0x07, 0x5B, 0x2C, 0x06, 0x33, 0x84, 0x7F, 0xD9, 0xC2, 0xD7, 0x2C, 0x58,
+    0x3F, 0xA7, 0x0B, 0x32, 0x31, 0x7A, 0xD6, 0x30, 0xA3, 0x59, 0x41, 0x91, 0xAB, 0x42, 0xE5, 0xDF,
+    0xDE, 0x15, 0x16, 0xA1, 0xB4, 0x6E, 0xDD, 0xDA, 0x6C, 0x97, 0x67, 0x8F, 0x3B, 0x02, 0x8B, 0x84,
+    0x57, 0x08, 0xBE, 0xCA, 0xE3, 0xEB, 0x10, 0x84, 0x45, 0x0D, 0xB1, 0xDF, 0xD7, 0x21, 0x80, 0x2F,
+    0x7C, 0x96, 0x21, 0x90, 0x0F, 0xC1, 0x7C, 0x58, 0xD0, 0x3F, 0x42, 0xFD, 0x19, 0xEA, 0x58, 0xD8,
+    0x24, 0x84, 0x3B, 0x09, 0x67, 0xAA, 0x89, 0xB8, 0xFB, 0xF0, 0xF0, 0xAD, 0x88, 0x38, 0xC2, 0xD4,
+    0xE1, 0x96, 0x6F, 0xD1, 0x43, 0xFE, 0x28, 0xAE, 0x2D, 0x50, 0x54, 0x0A, 0x88, 0x5D, 0xB7, 0x30,
+    0xE7, 0x9D, 0x88, 0x48, 0x0B, 0x56, 0xF6, 0x39, 0x81, 0x16, 0x6B, 0x92, 0x30, 0xAA, 0x37, 0x84,
+    0xC3, 0xF4, 0x57, 0x04, 0x4A, 0xBA, 0x11, 0xF9, 0xFE, 0xD8, 0x40, 0xFD, 0x5B, 0xEA, 0xF5, 0x8F,
+    0x38, 0x2F, 0x14, 0xAF, 0x3C, 0x6F, 0xD1, 0xD1, 0x39, 0x66, 0xC9, 0x0D, 0xEC, 0xEE, 0x23, 0xDB,
+    0x73, 0xD3, 0x56, 0x83, 0x5E, 0xA6, 0x41, 0x9C, 0x9E, 0x85, 0x8E, 0x91, 0xE8, 0xC2, 0xA8, 0x50,
+    0xF6, 0x63, 0x62, 0xFE, 0xD2, 0xC9, 0xBB, 0x6E, 0x31, 0x72, 0x6C, 0xAD, 0x76, 0x20, 0x50, 0x94,
+    0x30, 0x04, 0xBF, 0x64, 0x92, 0x0A, 0xA2, 0x77, 0xAA, 0x7B, 0x01, 0x0B, 0x2F, 0xBC, 0x53, 0x4D,
+    0x61, 0x5D, 0x8E, 0x9F, 0x66, 0xCE, 0xAA, 0x64, 0xC7, 0xC8, 0x39, 0xE4, 0xC7, 0x8F, 0xC1, 0x0E,
+    0xF7, 0x64, 0x99, 0xA6, 0xFA, 0xE9, 0xCF, 0x80, 0x97, 0x6C, 0xCE, 0x63, 0x72, 0x53, 0x2B, 0x71,
+    0xAA, 0xFE, 0xF1, 0x51, 0x8A, 0xAF, 0x9F, 0x18, 0xA2, 0x3C, 0xD9, 0x4C, 0xE4, 0xB3, 0x6A, 0x7A,
+    0xF5, 0xCF, 0xD3, 0x07, 0x08, 0x09, 0x6A, 0x4F, 0x3F, 0x8B, 0xD4, 0xBF, 0x3E, 0x4E, 0xBC, 0x3B,
+    0x8F, 0xEA, 0x2F, 0x13, 0x37, 0x3E, 0x66, 0x8E, 0x8E, 0x04, 0xA8, 0xA9, 0xAF, 0xCF, 0x3E, 0x24,
+    0x10, 0x89, 0x5F, 0xF6, 0xC3, 0x67, 0xE1, 0xB9, 0xBB, 0x28, 0x1B, 0x34, 0xA3, 0xB3, 0x68, 0xAB,
+    0xB7, 0xC7, 0x99, 0x94, 0x6F, 0x37, 0x58, 0x61, 0x8C, 0xDB, 0xAC, 0x91, 0x58, 0xC0, 0x69, 0xA9,
+    0xE0, 0x76, 0xAF, 0xD9, 0x12, 0xAE, 0x2B, 0x35, 0x5C, 0xBC, 0x23, 0x45, 0x5C, 0xB4, 0x79, 0x42,
+    0x1A, 0x0B, 0x92, 0xB3, 0xDD, 0x3E, 0xC3, 0xD1, 0xB3, 0xFB, 0x29, 0x12, 0xEA, 0x44, 0x64, 0xF4,
+    0x13, 0xA9, 0x2A, 0x9C, 0x53, 0xD7, 0xD5, 0x25, 0x74, 0xC3, 0x2B, 0xAA, 0xE1, 0xEA, 0xB8, 0xCE,
+    0x5E, 0x22, 0x34, 0xFD, 0xB4, 0xBE, 0x3F, 0x8D, 0xDA, 0xC2, 0x71, 0xF9, 0xAD, 0xC3, 0x05, 0xD1,
+    0x8B, 0xCB, 0x6F, 0xC7, 0xD8, 0xCA, 0x1F, 0xA1, 0x3F, 0xBC, 0xDD, 0x3A, 0xC9, 0xA3, 0x3F, 0xEC,
+    0x2F, 0xD4, 0xF9, 0x5B, 0x65, 0xB3, 0xC1, 0xD9, 0xFC, 0x3F, 0xB4, 0x5B, 0xA2, 0xD4, 0x50, 0xE4,
+    0x92, 0x0C, 0x64, 0xFA, 0x33, 0xAD, 0x9F, 0x73, 0x44, 0x27, 0x28, 0xDB, 0x01, 0xC7, 0x2C, 0xD3,
+    0x3E, 0x1A, 0xF9, 0x45, 0xC0, 0xEC, 0xE0, 0xA7, 0x6D, 0x57, 0xD2, 0x62, 0x9B, 0x59, 0xD0, 0x65,
+    0xBD, 0xB8, 0x75, 0x62, 0x4E, 0x3D, 0xDE, 0xDA, 0x3E, 0xD8, 0xDE, 0x36, 0xF6, 0x4F, 0x85, 0x78,
+    0xDB, 0xDE, 0x7F, 0x77, 0x8E, 0x13, 0xB5, 0x99, 0xAC, 0x3C, 0x52, 0xB3, 0x34, 0x55, 0x21, 0xF4,
+    0x25, 0xA3, 0x9C, 0x98, 0xF9, 0x0A, 0xFB, 0x85, 0xBD, 0xE9, 0xFE, 0x15, 0x5B, 0x98, 0x4C, 0xA7,
+    0x83, 0xE6, 0x03, 0x78, 0xAF, 0x25, 0x59, 0x61, 0xC8, 0x76, 0xCD, 0xEE, 0x83, 0xDC, 0x87, 0x76,
+    0xB6, 0xBD, 0x8F, 0x42, 0x0B, 0x5E, 0xAF, 0x34, 0xF7, 0xB2, 0x4F, 0xF3, 0xEF, 0xC9, 0x17, 0xF8,
+    0x7A, 0x3D, 0x5F, 0xB7, 0xB3, 0xAE, 0xE0, 0xD7, 0x7B, 0xA1, 0xF9, 0xC5, 0xA0, 0xE2, 0xB3, 0xCC,
+    0x97, 0x15, 0x0E, 0x6B, 0x6F, 0x2F, 0xD1, 0x59, 0xA7, 0x08, 0xCB, 0xB3, 0xAD, 0x70, 0x8D, 0x9F,
+    0x2E, 0x2F, 0x2D, 0x2F, 0xF9, 0xE9, 0xD9, 0xB8, 0x50, 0x0F, 0xF3, 0x62, 0x9A, 0xFF, 0x0F, 0x75,
+    0x54, 0x31, 0x6F, 0x23, 0x45, 0x14, 0xFE, 0x66, 0x06, 0x6E, 0xC4, 0x8D, 0xD8, 0xA1, 0xB8, 0x6B,
+    0x0E, 0xBC, 0x6E, 0xAF, 0xB0, 0xB3, 0xCD, 0x15, 0x16, 0x5A, 0xC7, 0x73, 0x20, 0x41, 0x41, 0x83,
+    0x84, 0x2C, 0x8A, 0x20, 0xDD, 0xFD, 0x02, 0x92, 0x62, 0x0B, 0x93, 0x8B, 0x92, 0xE1, 0x8A, 0x6B,
+    0x28, 0x70, 0x4F, 0x81, 0x1B, 0xA4, 0x23, 0x48, 0x64, 0x0B, 0x17, 0x41, 0x01, 0xEF, 0x88, 0x16,
+    0x09, 0x4D, 0x43, 0xBF, 0x42, 0x42, 0x14, 0x48, 0x97, 0x2D, 0x2C, 0x61, 0x41, 0x9C, 0xE5, 0xCD,
+    0x38, 0x86, 0x8A, 0x9D, 0x27, 0x79, 0xC6, 0xF3, 0xED, 0x7B, 0xDF, 0xFB, 0xDE, 0x7B, 0x8B, 0xCA,
+    0x88, 0xD6, 0xA9, 0x1F, 0x6B, 0x8D, 0x26, 0x45, 0xD3, 0x47, 0x93, 0xB3, 0x3A, 0xE7, 0x3E, 0x17,
+    0x8E, 0x6C, 0xA8, 0x4D, 0x77, 0x01, 0xB5, 0x42, 0x7C, 0x84, 0xE3, 0x06, 0x90, 0xD0, 0x48, 0xF0,
+    0x2A, 0xDE, 0x40, 0x0F, 0x39, 0x06, 0x28, 0xF0, 0x18, 0xE0, 0x53, 0x28, 0x87, 0xAE, 0xC3, 0x13,
+    0x87, 0x3F, 0xAD, 0xF8, 0xC9, 0x68, 0x8D, 0xBE, 0xC6, 0x71, 0x35, 0xAD, 0x5A, 0x8F, 0x3E, 0x08,
+    0x49, 0x50, 0x9C, 0xCE, 0x78, 0x5B, 0x0B, 0x07, 0x61, 0x21, 0x0D, 0xF4, 0x1A, 0xAA, 0x32, 0x90,
+    0x74, 0x8E, 0xA6, 0xCC, 0x6E, 0x85, 0x6C, 0x19, 0x63, 0xED, 0x5B, 0xA2, 0xA5, 0xED, 0xCD, 0xAB,
+    0x87, 0x57, 0x58, 0xEC, 0x63, 0x45, 0x1C, 0xA3, 0xCD, 0x53, 0x1C, 0x5F, 0xA1, 0x5B, 0x07, 0xE0,
+    0xED, 0xD3, 0x69, 0x46, 0x21, 0xC8, 0x89, 0x06, 0x76, 0x22, 0x7A, 0x09, 0xD6, 0x44, 0x7F, 0x16,
+    0x5D, 0x60, 0x08, 0x4C, 0x08, 0x17, 0xF2, 0xF4, 0xEA, 0xD3, 0x5A, 0xB3, 0x5A, 0x3D, 0xF5, 0xE2,
+    0xD2, 0x88, 0x35, 0xBA, 0x8F, 0x90, 0x4B, 0x3B, 0x11, 0x6E, 0xA2, 0xEC, 0xE8, 0x6C, 0x9B, 0xE7,
+    0x02, 0x21, 0xF4, 0x53, 0x4F, 0xC8, 0x94, 0x8C, 0xD7, 0x7A, 0xCF, 0x2B, 0x0A, 0xF1, 0x41, 0x60,
+    0x88, 0x0C, 0x6F, 0x5E, 0x61, 0xE4, 0x03, 0x90, 0x59, 0xEE, 0xB8, 0xFB, 0xF0, 0x97, 0xB6, 0x25,
+    0x65, 0x68, 0x31, 0x33, 0x1E, 0xB7, 0x6D, 0xB8, 0x69, 0xDB, 0xF1, 0x98, 0x42, 0x5E, 0x57, 0xD7,
+    0x74, 0x98, 0xF3, 0x5A, 0x3A, 0x8D, 0x94, 0x98, 0xE4, 0x44, 0x65, 0x82, 0x39, 0xAD, 0x82, 0x7E,
+    0x73, 0x52, 0xF0, 0xA5, 0xE0, 0xC7, 0xA3, 0xA1, 0x35, 0xBF, 0x59, 0x25, 0x1A, 0xD6, 0x70, 0x2F,
+    0x9C, 0x32, 0x29, 0x61, 0xDE, 0xC7, 0x2B, 0x99, 0x4D, 0x7E, 0xF7, 0xDD, 0x87, 0xF5, 0x0E, 0xF3,
+    0x39, 0x77, 0x03, 0xE2, 0x2B, 0x6C, 0x21, 0x4D, 0xA9, 0x30, 0xBB, 0x15, 0xF8, 0x4A, 0xE2, 0xFB,
+    0xB6, 0x4B, 0xB9, 0x1F, 0x52, 0xE1, 0xB8, 0x3F, 0x12, 0x3E, 0xE4, 0x14, 0xD3, 0xCA, 0xBB, 0x18,
+    0xAD, 0xA1, 0x37, 0xA2, 0xDE, 0xE7, 0x2B, 0xBD, 0x1C, 0xCE, 0x43, 0x34, 0x56, 0x87, 0x08, 0xC2,
+    0x49, 0x27, 0x2D, 0x65, 0x75, 0x42, 0x72, 0xD7, 0xDC, 0x34, 0x40, 0x34, 0xEE, 0x83, 0x78, 0xA4,
+    0xE6, 0x39, 0x84, 0x87, 0x36, 0x18, 0xB5, 0xEE, 0xA4, 0xB5, 0xA8, 0x02, 0x8C, 0x61, 0x0B, 0xDB,
+    0x73, 0x8C, 0x12, 0x54, 0x9B, 0xFA, 0xF9, 0xD7, 0xA4, 0xDB, 0x3D, 0x33, 0xD9, 0x3A, 0x86, 0xE2,
+    0x16, 0xDA, 0x21, 0xA3, 0x86, 0xB0, 0xEC, 0x0F, 0x23, 0x3E, 0x07, 0x35, 0x44, 0x9E, 0x62, 0x51,
+    0xD9, 0xB6, 0x75, 0xA1, 0x48, 0x79, 0x28, 0x0B, 0x3F, 0x0D, 0x65, 0x0E, 0xAD, 0x80, 0x60, 0xDD,
+    0x15, 0xD2, 0x2A, 0xEE, 0x88, 0x92, 0x82, 0xE9, 0xE2, 0xAF, 0x35, 0x4E, 0x62, 0x99, 0xF1, 0xBA,
+    0x67, 0xAD, 0x97, 0x3E, 0x5C, 0xA6, 0x54, 0xD4, 0x6B, 0x8C, 0xBE, 0xB4, 0xD4, 0xA1, 0x47, 0xC2,
+    0x0D, 0xA4, 0xCD, 0xB5, 0xC9, 0xB6, 0x7D, 0x7A, 0xEB, 0x74, 0xA6, 0xDB, 0x98, 0xC2, 0xFF, 0xF7,
+    0x44, 0x1F, 0x5B, 0xD9, 0xDE, 0xF2, 0x9A, 0x7B, 0x4D, 0x3A, 0x5C, 0x42, 0x5E, 0x21, 0xDB, 0xC7,
+    0x44, 0x99, 0xB9, 0xB2, 0x73, 0x6D, 0x8E, 0xAB, 0xC0, 0x27, 0x94, 0xE7, 0x3B, 0x42, 0x5A, 0xC2,
+    0xF4, 0xA3, 0xBA, 0x14, 0x34, 0x7B, 0xE4, 0xF4, 0xDF, 0x8E, 0xBD, 0x6B, 0x83, 0xFF, 0x21, 0xBE,
+    0x59, 0x91, 0x30, 0x91, 0xE4, 0x14, 0xF0, 0xC1, 0xEE, 0xFE, 0x66, 0x46, 0x24, 0x57, 0x7D, 0x73,
+    0x84, 0xC1, 0xDD, 0x71, 0xFC, 0x27, 0x3E, 0xB4, 0xA1, 0xE3, 0x66, 0x33, 0x6A, 0xC3, 0xA6, 0x09,
+    0xC5, 0xA6, 0x89, 0x89, 0x0D, 0x12, 0xEB, 0x13, 0x57, 0x49, 0x6D, 0x92, 0xE3, 0x4E, 0x78, 0x67,
+    0xB3, 0xFD, 0x6F, 0x45, 0x18, 0xAB, 0x37, 0x4D, 0x72, 0x07, 0xEC, 0xF9, 0x63, 0xF5, 0xA2, 0x4E,
+    0x45, 0xE8, 0x8F, 0x82, 0xBB, 0x52, 0xD8, 0x52, 0xDA, 0x52, 0x9B, 0xE1, 0x13, 0x74, 0x9F, 0x85,
+    0x0C, 0xD4, 0x19, 0x3A, 0xD2, 0xE4, 0x0A, 0x87, 0x3F, 0x60, 0x31, 0x25, 0x77, 0xE4, 0x0F, 0xC3,
+    0x8F, 0x82, 0x66, 0xEC, 0x39, 0xD4, 0xA5, 0xE9, 0x90, 0x90, 0xCC, 0x15, 0xCC, 0x95, 0xE1, 0x75,
+    0x57, 0x28, 0x33, 0xFC, 0x18, 0x6A, 0x09, 0x6E, 0xEE, 0xD3, 0x1F, 0xF8, 0xD5, 0xE3, 0xC2, 0x84,
+    0x59, 0x3A, 0x02, 0x7B, 0x01, 0xF1, 0x19, 0xB4, 0xB0, 0x3D, 0xE6, 0xF8, 0x39, 0x92, 0x33, 0x84,
+    0x79, 0x26, 0x6D, 0xF7, 0x9C, 0x6A, 0x6D, 0x5F, 0x9A, 0x81, 0xC6, 0xF0, 0x08, 0xBA, 0x06, 0x33,
+    0xF1, 0x86, 0x46, 0x9C, 0x2A, 0x7A, 0xCF, 0x24, 0x17, 0x5E, 0x9B, 0x3A, 0x85, 0xEF, 0x6D, 0xFB,
+    0xB8, 0x08, 0x3C, 0xCD, 0x4C, 0xDE, 0x20, 0xE5, 0x06, 0xC9, 0x6C, 0xA2, 0x4C, 0xD2, 0x47, 0x67,
+    0x8E, 0x1D, 0x8F, 0xDD, 0x06, 0x83, 0x02, 0x45, 0x8E, 0xB2, 0x8F, 0x59, 0x42, 0x48, 0x61, 0x85,
+    0x91, 0xD4, 0x1E, 0xE1, 0x33, 0xD4, 0xF9, 0xF7, 0x23, 0x74, 0x40, 0x39, 0xBD, 0x7C, 0x8F, 0xCF,
+    0x92, 0x8B, 0x9F, 0xBF, 0xD7, 0x0F, 0x97, 0x3D, 0x1A, 0xDD, 0x5E, 0x8F, 0xBB, 0x9C, 0xCA, 0x35,
+    0x18, 0x08, 0xFB, 0x80, 0xE6, 0xE5, 0xE0, 0x40, 0xA1, 0x2C, 0x6F, 0x63, 0xC6, 0xDF, 0x9B, 0x8A,
+    0x45, 0x23, 0x7D, 0xA1, 0x6C, 0xA1, 0x51, 0x26, 0x68, 0x3A, 0xA8, 0xFB, 0x1B, 0x52, 0x34, 0xC8,
+    0xEF, 0x58, 0x71, 0xB8, 0xB9, 0xA5, 0x4C, 0x8A, 0x24, 0x58, 0x43, 0xEE, 0xB2, 0x2F, 0xDC, 0xE0,
+    0x3A, 0x7C, 0xC5, 0x8A, 0x50, 0x8E, 0x30, 0x01, 0xFC, 0x6B, 0xFD, 0x6D, 0x8F, 0x38, 0x68, 0xCB,
+    0x96, 0xA1, 0x2A, 0x5F, 0x9D, 0x9F, 0x78, 0x4E, 0x29, 0x64, 0xB3, 0xFD, 0xD9, 0x96, 0xD9, 0x03,
+    0x82, 0x7F, 0x62, 0x32, 0xF3, 0x0F, 0x6D, 0x57, 0x4D, 0x8F, 0x14, 0xD7, 0x15, 0xBD, 0x55, 0x05,
+    0x5D, 0x12, 0xA5, 0xF0, 0xD8, 0x20, 0xE4, 0xA0, 0xA1, 0x36, 0x5E, 0xA0, 0x10, 0x53, 0x1B, 0x4B,
+    0x41, 0x4A, 0x77, 0x55, 0x61, 0x4B, 0x66, 0x91, 0x0D, 0x91, 0xD2, 0xF2, 0x02, 0x29, 0x64, 0x19,
+    0x39, 0x71, 0x58, 0x24, 0x92, 0x59, 0xF4, 0x4C, 0x17, 0xB2, 0x9C, 0x4D, 0x16, 0x1E, 0x65, 0x91,
+    0x4D, 0x24, 0x87, 0x45, 0x22, 0x25, 0xC3, 0x62, 0x58, 0x20, 0x05, 0x85, 0x86, 0x7E, 0xB6, 0x7F,
+    0x80, 0x0B, 0x59, 0xB0, 0xB1, 0x14, 0xCA, 0xE2, 0x23, 0x09, 0x2C, 0x5C, 0x68, 0x6A, 0x42, 0x0D,
+    0x53, 0xDD, 0x2F, 0xE7, 0xBC, 0xD7, 0x33, 0xC3, 0x24, 0xE9, 0x51, 0xDF, 0xD6, 0xBC, 0x7A, 0x1F,
+    0xF7, 0x9E, 0x7B, 0xEE, 0xB9, 0xAF, 0x44, 0xF0, 0x19, 0xB7, 0x12, 0x98, 0x4E, 0x54, 0x79, 0x40,
+    0xE2, 0x5C, 0x24, 0xC3, 0xD0, 0x32, 0xBE, 0x13, 0x7F, 0xED, 0x6A, 0x17, 0x98, 0xA6, 0x0D, 0xEF,
+    0x9D, 0x6F, 0x23, 0x2D, 0x9D, 0x2A, 0xE4, 0xB6, 0xCA, 0x25, 0x5B, 0x5F, 0xCB, 0x95, 0x31, 0x85,
+    0x8C, 0x87, 0x22, 0x29, 0x26, 0x0E, 0xF0, 0x1D, 0x71, 0x01, 0xBE, 0xD3, 0xB9, 0x88, 0x99, 0xCB,
+    0xE2, 0xA3, 0x14, 0xCC, 0xD2, 0x12, 0xCF, 0xC0, 0xC3, 0xD0, 0x18, 0xEC, 0xBE, 0x05, 0x33, 0xAF,
+    0x6B, 0x09, 0x9E, 0xDF, 0x2D, 0x25, 0xFA, 0xF2, 0x73, 0x2D, 0xEA, 0xC3, 0x0F, 0x0B, 0x49, 0xA2,
+    0x08, 0x5B, 0x73, 0x41, 0xCA, 0x05, 0x83, 0x7E, 0x1F, 0x5E, 0x5C, 0x3E, 0x03, 0x73, 0xFD, 0x06,
+    0xC6, 0xB0, 0x40, 0x32, 0x2C, 0x90, 0x04, 0x0B, 0x44, 0xFD, 0xE3, 0xD7, 0xB9, 0x44, 0xF4, 0x41,
+    0xF1, 0xC0, 0xA5, 0x13, 0x38, 0x81, 0x0B, 0xE4, 0xF5, 0xD7, 0x77, 0x8E, 0xF6, 0xA6, 0xAD, 0xC0,
+    0x4B, 0x19, 0x97, 0xEF, 0xCB, 0x4C, 0x24, 0x68, 0x70, 0x7E, 0x85, 0x95, 0x5C, 0x8D, 0x20, 0x13,
+    0xF9, 0x6D, 0x93, 0xF9, 0x0F, 0x9A, 0xD4, 0x9F, 0x9F, 0x4F, 0xF1, 0x70, 0x10, 0x54, 0x32, 0x08,
+    0xB5, 0x0C, 0x10, 0x68, 0x8A, 0x40, 0x33, 0x4C, 0x8A, 0x3F, 0xC6, 0x5C, 0xD3, 0x03, 0x38, 0xC6,
+    0x05, 0xE6, 0xE5, 0x36, 0x08, 0xBD, 0x38, 0xFA, 0xDE, 0x30, 0xB7, 0x7B, 0x49, 0x2C, 0x3B, 0x26,
+    0xA1, 0x21, 0x26, 0x16, 0x14, 0x0B, 0xA3, 0x4C, 0x0D, 0xCE, 0x36, 0x06, 0x01, 0xB4, 0xFC, 0xB7,
+    0xA1, 0x73, 0xF8, 0x47, 0x4E, 0xBD, 0xBC, 0x0A, 0x5C, 0x0C, 0x9C, 0x3A, 0xF6, 0x18, 0xBB, 0x04,
+    0x08, 0x4E, 0xE0, 0x81, 0x48, 0xA4, 0x65, 0xF7, 0x13, 0x99, 0x7C, 0x31, 0x69, 0xE6, 0x6B, 0xF1,
+    0xB9, 0x0E, 0x9E, 0x62, 0xE2, 0xBE, 0xD9, 0xDE, 0xFA, 0xD3, 0xAB, 0x74, 0xB3, 0x12, 0xEF, 0xD2,
+    0x30, 0x77, 0x6E, 0x78, 0xE3, 0xA1, 0xC5, 0x48, 0x4B, 0xEF, 0xCE, 0x5A, 0xEE, 0x32, 0x64, 0x3D,
+    0xB0, 0x9B, 0x1C, 0xBF, 0x37, 0xFC, 0x91, 0x64, 0xC6, 0xB4, 0x34, 0x8D, 0x3D, 0xEA, 0xA0, 0xB5,
+    0x27, 0xAC, 0xED, 0x5B, 0x0B, 0xE0, 0xAF, 0x26, 0x57, 0xB6, 0x2B, 0x79, 0x6E, 0x36, 0x4C, 0xE7,
+    0xBD, 0xB8, 0x6F, 0x36, 0xEF, 0xF8, 0x73, 0x31, 0x45, 0xE6, 0xB7, 0x62, 0x24, 0x09, 0x6A, 0xE9,
+    0x24, 0x83, 0x3F, 0xAD, 0xA4, 0x61, 0x49, 0x14, 0x23, 0x1D, 0xD6, 0x32, 0x52, 0x5A, 0xD5, 0x32,
+    0x51, 0x45, 0x82, 0x27, 0x2A, 0x1F, 0x97, 0xD2, 0xC6, 0xF2, 0x42, 0x7B, 0x4D, 0xE2, 0x7F, 0xA5,
+    0xFD, 0x3A, 0x0D, 0xBF, 0x80, 0x1D, 0x28, 0x55, 0x60, 0xE5, 0xE9, 0x57, 0x8E, 0xAB, 0xF7, 0xC2,
+    0x96, 0x24, 0x07, 0x13, 0xB2, 0xC2, 0x1A, 0x20, 0x3B, 0xD6, 0x98, 0x78, 0x4B, 0x03, 0xD4, 0x17,
+    0x1A, 0x93, 0x37, 0xF4, 0x48, 0x0E, 0x6D, 0x3F, 0x9D, 0x17, 0xB1, 0x41, 0x26, 0x7A, 0x4F, 0x1E,
+    0x6F, 0x4A, 0x70, 0xB7, 0xAA, 0xE5, 0xD8, 0x93, 0x7F, 0x6F, 0x02, 0x2D, 0xE4, 0xEB, 0xD2, 0xD3,
+    0xED, 0x7F, 0x49, 0x54, 0x6C, 0x94, 0xC8, 0xD0, 0x5F, 0x41, 0x31, 0x99, 0x6A, 0x64, 0x68, 0x0C,
+    0x9E, 0xC9, 0x38, 0xC7, 0xA9, 0x59, 0x8E, 0x0C, 0x91, 0xE9, 0xC9, 0x16, 0x8F, 0xCB, 0x90, 0x4F,
+    0x91, 0x95, 0x4B, 0x84, 0x76, 0x14, 0xD0, 0x91, 0x89, 0xD7, 0x58, 0xBC, 0x68, 0x1B, 0xAF, 0x39,
+    0x83, 0x9C, 0x79, 0xF5, 0x0D, 0x80, 0x17, 0x3C, 0x6F, 0x24, 0xA8, 0xD5, 0x37, 0x46, 0x07, 0x8F,
+    0xA7, 0xEB, 0xA6, 0x08, 0xCC, 0x0C, 0x71, 0x84, 0x66, 0x15, 0x09, 0x44, 0x2E, 0x90, 0x13, 0xD0,
+    0x87, 0x16, 0xE8, 0x17, 0x2C, 0x28, 0xFC, 0x1B, 0x5B, 0xD2, 0x25, 0xD6, 0x82, 0x1D, 0xAA, 0x23,
+    0x3D, 0xC2, 0xCE, 0x46, 0xCA, 0x8A, 0x5B, 0xF8, 0xA0, 0x77, 0x7D, 0x98, 0x58, 0x1F, 0x3A, 0xCB,
+    0x93, 0x16, 0xC0, 0x3D, 0x82, 0x0F, 0x35, 0x52, 0x50, 0xFB, 0x1B, 0xCD, 0x4F, 0xFD, 0x3A, 0x7C,
+    0x58, 0x82, 0x06, 0xF1, 0xE7, 0x25, 0x93, 0x8E, 0xD3, 0x03, 0xD3, 0x02, 0xFD, 0xF0, 0x7E, 0x2D,
+    0x73, 0xF8, 0xD0, 0x10, 0xB8, 0x02, 0xF4, 0x2F, 0x55, 0xDE, 0xC1, 0xD7, 0x18, 0x95, 0xE9, 0xC3,
+    0x8E, 0xB0, 0x26, 0x91, 0xC1, 0x4F, 0xA2, 0x32, 0x95, 0x74, 0x6C, 0x80, 0x66, 0x96, 0xCC, 0x17,
+    0x3E, 0xF8, 0x65, 0xA8, 0x55, 0x1E, 0x94, 0x48, 0x1D, 0x98, 0x18, 0x03, 0xEE, 0x40, 0x27, 0x98,
+    0x11, 0xE8, 0x0C, 0x58, 0x07, 0xFA, 0x03, 0x7D, 0x13, 0x76, 0x03, 0x7B, 0x07, 0xFA, 0xE1, 0xA7,
+    0xB5, 0x84, 0x9F, 0x7D, 0xF9, 0x59, 0x25, 0xA7, 0x9E, 0x3D, 0x7B, 0xF6, 0x88, 0x0C, 0x02, 0x8F,
+    0x8E, 0x3F, 0xF8, 0xFD, 0x83, 0x55, 0x89, 0x3E, 0x0E, 0x51, 0x35, 0xD1, 0x27, 0xE1, 0x27, 0xB0,
+    0x3F, 0x0F, 0xDF, 0x87, 0x1D, 0x85, 0xA0, 0x5E, 0x74, 0x23, 0xBC, 0x09, 0x5B, 0x47, 0x88, 0x48,
+    0x55, 0xD6, 0x96, 0x91, 0xAD, 0x47, 0xCB, 0xF6, 0xC4, 0x90, 0x0A, 0x99, 0x99, 0x01, 0x98, 0x01,
+    0x32, 0xD4, 0x87, 0xB3, 0xAA, 0x18, 0xC9, 0x4D, 0x20, 0x39, 0x91, 0xE6, 0xB5, 0x50, 0x23, 0x13,
+    0x69, 0xA8, 0x81, 0xC2, 0x20, 0x2A, 0x6A, 0xBF, 0xEE, 0xAB, 0xB3, 0xB5, 0x5F, 0x8D, 0xD4, 0x5B,
+    0x55, 0x50, 0xDE, 0x8C, 0x83, 0x2A, 0xD0, 0x6D, 0x12, 0x20, 0x86, 0xE6, 0x74, 0xA8, 0xA3, 0x4F,
+    0x31, 0x49, 0xAB, 0x2B, 0x75, 0x3F, 0x2A, 0x30, 0xE1, 0xA4, 0xCA, 0x15, 0x72, 0x13, 0x4B, 0x1C,
+    0xA0, 0xB6, 0x05, 0x13, 0xFC, 0x4E, 0xD2, 0x88, 0x15, 0x39, 0x50, 0x66, 0x9E, 0xEF, 0x72, 0x6E,
+    0xB7, 0xA6, 0xBE, 0xB3, 0xFE, 0x4F, 0xA6, 0x03, 0xF9, 0x39, 0x7A, 0x71, 0xD5, 0x95, 0x76, 0xAF,
+    0x4D, 0x38, 0x04, 0x33, 0x3F, 0x37, 0x17, 0xBF, 0xF5, 0x66, 0xAC, 0xC3, 0x8E, 0x19, 0xEF, 0x28,
+    0x2A, 0x2D, 0x53, 0xDB, 0x22, 0xDD, 0xA0, 0x4D, 0xC2, 0x12, 0x4B, 0x00, 0x3C, 0x0C, 0x62, 0x8C,
+    0x25, 0x01, 0x0B, 0xF5, 0x2D, 0xD0, 0xC3, 0x3C, 0x44, 0x0D, 0x9B, 0x73, 0x38, 0xE2, 0xC8, 0xCE,
+    0xA1, 0x47, 0x87, 0x43, 0x4A, 0x04, 0x14, 0xE6, 0xBD, 0xB5, 0xBF, 0xFC, 0x77, 0xD9, 0x97, 0xE2,
+    0xCF, 0x30, 0x9B, 0xC2, 0x65, 0x95, 0x6B, 0x4F, 0x5F, 0x0E, 0xDE, 0xA6, 0xF8, 0xB0, 0xBA, 0x0F,
+    0xCD, 0x51, 0xDD, 0x96, 0x28, 0xB6, 0xB0, 0xAD, 0xDB, 0xD6, 0xF8, 0xBB, 0x63, 0x96, 0xCA, 0x4E,
+    0x7D, 0xEE, 0xC8, 0x79, 0x3E, 0xAE, 0x78, 0x04, 0xC3, 0x3D, 0x62, 0xC3, 0xB3, 0x4E, 0xE3, 0x94,
+    0x54, 0xE2, 0x02, 0xF8, 0xAF, 0x40, 0xB9, 0x3C, 0x4C, 0x9F, 0xF0, 0xE0, 0x09, 0x86, 0xA4, 0xC5,
+    0x90, 0x6C, 0x62, 0xE8, 0xB8, 0x79, 0xF9, 0x67, 0x26, 0xBC, 0x93, 0x63, 0xB3, 0xD9, 0x79, 0xC4,
+    0xB8, 0x4C, 0xE5, 0x4A, 0x89, 0x5B, 0x42, 0x2D, 0x02, 0xD9, 0x55, 0xA1, 0x58, 0x03, 0x40, 0x33,
+    0xCE, 0x81, 0x41, 0xEC, 0xD0, 0x10, 0x2B, 0xC7, 0xC6, 0x99, 0x83, 0xEF, 0x6E, 0x22, 0xEA, 0x60,
+    0x4F, 0xCD, 0xEE, 0x22, 0xB8, 0xE8, 0x01, 0x0D, 0x09, 0xA9, 0xF8, 0x20, 0xC1, 0xB1, 0xBE, 0x79,
+    0x87, 0x12, 0x8C, 0xD5, 0x27, 0x32, 0xBA, 0x9F, 0x95, 0x36, 0x84, 0x45, 0xED, 0x64, 0x34, 0x97,
+    0x69, 0x8E, 0xEC, 0x57, 0xD6, 0xC5, 0xE7, 0xB8, 0x69, 0x5D, 0x5D, 0xD9, 0xE2, 0x7E, 0x23, 0xBF,
+    0xE4, 0x9E, 0xF9, 0xAD, 0xD3, 0xE7, 0xDB, 0x62, 0xFB, 0x96, 0x55, 0xEB, 0x89, 0x43, 0xB6, 0x75,
+    0x2A, 0xDE, 0xDA, 0x3E, 0x88, 0xFD, 0xF8, 0xE3, 0xD5, 0x76, 0xD0, 0x06, 0xF1, 0x5E, 0x0E, 0x77,
+    0x33, 0xDF, 0xD4, 0xE0, 0x53, 0x1A, 0x3D, 0xE9, 0x40, 0x96, 0x89, 0xCA, 0x47, 0xA1, 0xF6, 0x40,
+    0x8F, 0x11, 0xC5, 0x2F, 0x85, 0xFA, 0x15, 0x2C, 0x9C, 0x89, 0xFA, 0x9D, 0x91, 0x15, 0xBF, 0x89,
+    0xE1, 0x04, 0xF4, 0x3B, 0x01, 0xCF, 0xA6, 0xD6, 0x0F, 0x69, 0x5D, 0xEE, 0x9D, 0xE8, 0x2E, 0xFC,
+    0xF5, 0x17, 0x3F, 0x95, 0xFD, 0x09, 0x16, 0x3F, 0xE5, 0x5E, 0x2C, 0x53, 0x8B, 0x46, 0x45, 0xA8,
+    0x30, 0x15, 0x25, 0x00, 0x5C, 0xCE, 0xD2, 0x78, 0x2C, 0x22, 0xCE, 0x54, 0x64, 0xAE, 0x62, 0x3F,
+    0x52, 0xBF, 0x20, 0x86, 0xEC, 0xC6, 0x11, 0x0F, 0xB1, 0xEC, 0xE1, 0xC3, 0x93, 0xA4, 0xD0, 0x88,
+    0x18, 0x76, 0x7F, 0xAB, 0xB0, 0xDB, 0x73, 0x94, 0xF1, 0x17, 0xA8, 0x65, 0x15, 0xE5, 0x28, 0x85,
+    0x9E, 0xD3, 0xDF, 0x5D, 0xB3, 0x47, 0x29, 0x6E, 0xE0, 0x53, 0x9C, 0x7C, 0x26, 0x67, 0x4A, 0xB1,
+    0x22, 0xF1, 0x64, 0xEB, 0x42, 0x0D, 0xE6, 0x60, 0xDE, 0xA9, 0x97, 0x6B, 0xF3, 0x9C, 0x2A, 0x40,
+    0x78, 0xA0, 0x10, 0x25, 0xC6, 0x7E, 0xF6, 0xF4, 0xDA, 0x16, 0xA6, 0xA1, 0xA2, 0x21, 0x29, 0xE4,
+    0xC3, 0x98, 0x7C, 0x45, 0x27, 0x8E, 0x19, 0xC5, 0x5E, 0x9F, 0xDC, 0x6B, 0x96, 0x23, 0x59, 0xDC,
+    0x21, 0x1C, 0x53, 0x77, 0x8A, 0xB2, 0x60, 0x2F, 0x9F, 0x73, 0x1D, 0xCE, 0x9C, 0x3E, 0xB8, 0xA0,
+    0xFD, 0x19, 0x7A, 0x54, 0x58, 0x2F, 0xB1, 0x24, 0xBE, 0x8B, 0xF1, 0xA2, 0xCF, 0x3B, 0x4B, 0x9F,
+    0x5B, 0x5D, 0x66, 0xCB, 0xBD, 0xC1, 0x5D, 0x40, 0xB2, 0xCE, 0x99, 0xCD, 0x31, 0x74, 0xB4, 0x4A,
+    0xA5, 0xF3, 0xCB, 0x65, 0xE8, 0x2A, 0xD4, 0x6C, 0x25, 0x80, 0xA6, 0x64, 0xE7, 0xA0, 0x90, 0xF1,
+    0xB3, 0xB3, 0x0D, 0x3B, 0x7A, 0xCD, 0x12, 0x5C, 0x75, 0x37, 0x03, 0xD7, 0x01, 0x0F, 0xB8, 0xEC,
+    0x10, 0xBF, 0x80, 0xEE, 0x44, 0xED, 0x0E, 0xA6, 0x09, 0xFD, 0x1C, 0xD0, 0x74, 0x7D, 0xCE, 0x18,
+    0x00, 0x1B, 0x84, 0x09, 0x21, 0xE6, 0x1D, 0x4A, 0xA7, 0xAC, 0xA7, 0x84, 0x9B, 0x9A, 0x86, 0x5C,
+    0x6F, 0x2C, 0x9B, 0x80, 0xA3, 0x22, 0x38, 0x90, 0x22, 0x62, 0x11, 0xB3, 0x4A, 0x32, 0xD6, 0xCB,
+    0xF2, 0x5E, 0xBB, 0xEF, 0x11, 0x98, 0x98, 0x95, 0xAB, 0x7E, 0x68, 0x2C, 0x71, 0xED, 0xB5, 0x22,
+    0xDF, 0x31, 0x99, 0x1C, 0x5A, 0x5B, 0x9B, 0x16, 0xDC, 0x54, 0x1F, 0x1C, 0x9A, 0xC7, 0x24, 0x78,
+    0x2E, 0x47, 0xCD, 0xD6, 0xD0, 0x2A, 0xB0, 0x24, 0x4F, 0x21, 0x20, 0xAA, 0xD8, 0xB7, 0x86, 0xB5,
+    0x0B, 0xBD, 0xED, 0x69, 0x77, 0x6F, 0x41, 0x94, 0xB9, 0xBB, 0xC6, 0xEC, 0x43, 0x77, 0xCB, 0xA2,
+    0x8B, 0xA7, 0x7F, 0xF8, 0xB1, 0xF8, 0xDD, 0xE1, 0x7D, 0xE8, 0xE6, 0xFF, 0x0F, 0xDD, 0xEB, 0x08,
+    0x9E, 0x24, 0xE9, 0xA4, 0x62, 0x97, 0xA2, 0xF1, 0x4B, 0x76, 0x2D, 0x1C, 0xB1, 0x42, 0x93, 0xBD,
+    0x8D, 0x8D, 0xE3, 0x67, 0xEF, 0x2C, 0x6E, 0x69, 0x48, 0x20, 0x79, 0x29, 0xFB, 0xD1, 0xE5, 0x67,
+    0x89, 0x7B, 0xF5, 0xB9, 0xD7, 0x04, 0x18, 0xF5, 0xE6, 0xD7, 0x5E, 0xAE, 0x26, 0x08, 0xA6, 0xEC,
+    0x6D, 0x5E, 0xB8, 0x07, 0xD4, 0x80, 0x0D, 0x7A, 0x2D, 0x4C, 0x85, 0xC0, 0xD0, 0x97, 0x72, 0x10,
+    0x39, 0x26, 0x64, 0xEC, 0xA5, 0xC4, 0x5A, 0x15, 0x03, 0xA6, 0x6D, 0x99, 0xA8, 0x8F, 0xC8, 0xAB,
+    0x65, 0x7A, 0x0A, 0x65, 0x80, 0x94, 0xB5, 0x8B, 0xF6, 0xBA, 0x5B, 0x43, 0x64, 0x2E, 0x70, 0xC0,
+    0x50, 0xFC, 0xE8, 0xE2, 0x0E, 0xC0, 0x54, 0xBB, 0x9D, 0xAB, 0xDA, 0xC2, 0x8E, 0xAD, 0xCD, 0x6C,
+    0x5E, 0x94, 0xAD, 0x53, 0xDF, 0xB8, 0x07, 0x76, 0x28, 0xB2, 0x35, 0x82, 0x86, 0xFB, 0xED, 0x43,
+    0xBD, 0x2B, 0x8D, 0x7C, 0xFF, 0xD6, 0xDF, 0xBF, 0x6E, 0xE4, 0x97, 0x77, 0x2B, 0xD8, 0xEF, 0x5D,
+    0xD1, 0x0F, 0x21, 0x14, 0x6F, 0xE9, 0x6F, 0x20, 0xF9, 0xDB, 0xF7, 0x71, 0x54, 0x64, 0xAF, 0x7F,
+    0x87, 0xC3, 0x77, 0x01, 0xC8, 0xB7, 0xC2, 0xA0, 0x60, 0xF0, 0x9E, 0x55, 0x78, 0x33, 0x43, 0x2A,
+    0x67, 0x07, 0x87, 0xB8, 0x88, 0x51, 0xD0, 0x87, 0xC3, 0xF3, 0xBC, 0x8F, 0xD9, 0xEB, 0x18, 0xB3,
+    0x48, 0x2E, 0xC6, 0x0B, 0xC9, 0xCF, 0xE4, 0x7F, 0x6F, 0xDA, 0x9D, 0x2B, 0x14, 0x52, 0x94, 0x55,
+    0xCA, 0x2F, 0x38, 0xD8, 0x86, 0xEC, 0xC5, 0xEC, 0xAC, 0xB6, 0x74, 0xAD, 0xE8, 0x56, 0xB1, 0xBD,
+    0x19, 0x36, 0x4E, 0x71, 0x63, 0x0D, 0xBA, 0x60, 0xCB, 0x3F, 0xBA, 0x2D, 0x79, 0x04, 0x8F, 0x23,
+    0x0B, 0x83, 0xBD, 0x65, 0x6E, 0xFF, 0xE5, 0x05, 0x8F, 0x12, 0xEB, 0xC7, 0x11, 0x49, 0x7B, 0x35,
+    0x16, 0xAF, 0xCA, 0xF4, 0x91, 0xC4, 0x28, 0xE5, 0xD3, 0x14, 0xC0, 0x2D, 0x53, 0x78, 0xE6, 0x91,
+    0x24, 0x58, 0x33, 0xAD, 0xE5, 0xC0, 0xDB, 0xB5, 0xA4, 0xD8, 0x67, 0x19, 0xF2, 0x3F, 0xC1, 0x53,
+    0xBC, 0x38, 0x20, 0x81, 0x45, 0x5C, 0xAA, 0x8F, 0x4C, 0x1E, 0xA3, 0xFE, 0x13, 0xD6, 0xD9, 0x6E,
+    0x9B, 0x23, 0xB8, 0x09, 0xA3, 0xE9, 0xF3, 0x22, 0xF8, 0x2B, 0x92, 0xE3, 0xF2, 0x1B, 0x0C, 0x76,
+    0x05, 0x6D, 0x91, 0x44, 0xD0, 0xBD, 0xF9, 0xDA, 0x7A, 0x4D, 0xEA, 0xDD, 0x20, 0xF5, 0xDE, 0x24,
+    0x53, 0xCE, 0xC8, 0xF3, 0xAF, 0xCB, 0x37, 0x65, 0x7B, 0xBB, 0xBE, 0xEE, 0xCD, 0x56, 0x56, 0x6A,
+    0xAF, 0x39, 0x19, 0x6B, 0xAB, 0x72, 0x09, 0x9D, 0x3F, 0x63, 0xD3, 0x33, 0xB3, 0x17, 0x2B, 0x72,
+    0x5E, 0x59, 0xD9, 0x75, 0xA2, 0xEB, 0xAE, 0x9B, 0x56, 0x73, 0x9C, 0xE8, 0x38, 0xD5, 0x71, 0xB2,
+    0x63, 0x43, 0x96, 0xA3, 0x33, 0x77, 0xCB, 0x6F, 0xC5, 0x95, 0x95, 0xCC, 0xFD, 0x3A, 0xC9, 0xBD,
+    0x16, 0x14, 0x44, 0x28, 0x41, 0x05, 0x95, 0x2F, 0xC3, 0x32, 0xD2, 0xEE, 0x4F, 0xB9, 0xBF, 0xC2,
+    0xFE, 0x31, 0x63, 0x79, 0x9C, 0x3B, 0x05, 0x20, 0x62, 0x99, 0xCD, 0x5D, 0xEA, 0x8E, 0x0C, 0xCD,
+    0x96, 0xB8, 0x0B, 0xB9, 0xBA, 0x87, 0x56, 0x84, 0xEB, 0x6F, 0xB3, 0x73, 0x5F, 0x80, 0xC9, 0x68,
+    0x52, 0xC2, 0x3F, 0xA0, 0xE0, 0x8E, 0x24, 0xD1, 0x87, 0xE6, 0xD7, 0x0C, 0x0B, 0x13, 0x44, 0x9B,
+    0xFF, 0xE9, 0xD5, 0xFE, 0x96, 0xD1, 0xB9, 0x31, 0xCD, 0xDE, 0xBB, 0x40, 0xF4, 0xEA, 0x9B, 0x43,
+    0x85, 0x61, 0xAF, 0xA4, 0xE1, 0x2B, 0x53, 0x40, 0x61, 0x19, 0x43, 0x58, 0x7C, 0xF3, 0x15, 0x6E,
+    0x2C, 0xDB, 0xA8, 0xCD, 0xE4, 0x37, 0x21, 0xDF, 0xB6, 0x22, 0x44, 0xCE, 0x57, 0xAE, 0xF6, 0xF0,
+    0x61, 0x1C, 0x8F, 0xF7, 0x2E, 0xF7, 0x82, 0xB1, 0xDF, 0xF8, 0xBB, 0xDD, 0xC0, 0x09, 0xF3, 0x6D,
+    0x77, 0x3F, 0x07, 0x65, 0x2F, 0xEE, 0x48, 0x0F, 0x0C, 0x5F, 0x8F, 0xD0, 0xC5, 0x7D, 0xBC, 0x9E,
+    0x05, 0xF8, 0x8E, 0x01, 0xFA, 0x14, 0xE7, 0xCE, 0x2E, 0x40, 0x00, 0xBD, 0x0E, 0xB1, 0x75, 0xD8,
+    0x87, 0x35, 0xDE, 0x05, 0x95, 0xD7, 0x04, 0xB8, 0xFC, 0xB1, 0x12, 0x23, 0xDB, 0x1F, 0x2E, 0x01,
+    0xBC, 0xA8, 0xA4, 0x40, 0xC6, 0xF6, 0x8A, 0x1A, 0x40, 0xAE, 0x43, 0x5C, 0x2A, 0x94, 0x5E, 0xF6,
+    0xA6, 0xF9, 0x18, 0x73, 0xA6, 0xB8, 0xAC, 0x84, 0x3F, 0x40, 0x80, 0x70, 0x16, 0xBE, 0xCA, 0x7F,
+    0x00, 0xB3, 0xFF, 0xCF, 0x60, 0xFF, 0x9F, 0x41, 0x34, 0x94, 0x01, 0x00, 0x3D, 0xD0, 0xB1, 0x6D,
+    0xC3, 0x30, 0x10, 0x05, 0xD0, 0x4F, 0x12, 0x02, 0x0B, 0x15, 0x4A, 0x91, 0x5E, 0x23, 0x78, 0x02,
+    0x3B, 0x1C, 0x21, 0x85, 0xD7, 0x08, 0xB2, 0x40, 0x0C, 0x79, 0x84, 0x8C, 0xE1, 0x21, 0x12, 0x84,
+    0x23, 0x68, 0x04, 0x15, 0x19, 0x80, 0x05, 0x0B, 0x19, 0xB0, 0x75, 0xF9, 0x9F, 0x06, 0x72, 0xC5,
+    0x63, 0x73, 0xE4, 0xFD, 0x23, 0x80, 0x67, 0xB0, 0x82, 0xCD, 0x74, 0xB0, 0x95, 0xBE, 0xE0, 0x9B,
+    0xEE, 0x71, 0xA0, 0x5F, 0x3C, 0xE5, 0x07, 0x5D, 0xFD, 0x76, 0x01, 0xEA, 0xC8, 0x26, 0x57, 0xBA,
+    0xEB, 0x2B, 0x7C, 0x71, 0x95, 0x57, 0x8B, 0x2F, 0x74, 0x69, 0xCE, 0x61, 0x01, 0x62, 0x0E, 0x7C,
+    0xAD, 0xCF, 0x91, 0x0E, 0xB9, 0xCF, 0xF4, 0x3C, 0xD0, 0x31, 0x0D, 0x67, 0x0A, 0xB9, 0x6B, 0x1E,
+    0x38, 0x52, 0xA3, 0x02, 0x3D, 0x01, 0x4F, 0x1A, 0xA5, 0xBA, 0x35, 0x15, 0x06, 0xB1, 0xC8, 0x9F,
+    0xB9, 0x99, 0xF0, 0xA8, 0x4E, 0x78, 0x5B, 0x5A, 0x66, 0x35, 0x8F, 0x69, 0x82, 0x9E, 0xDB, 0xFD,
+    0x27, 0xDF, 0x2B, 0xF9, 0xFB, 0xE6, 0xEC, 0xE2, 0xCD, 0xD8, 0xD4, 0xFF, 0xBE, 0x75, 0xF7, 0xA3,
+    0x62, 0xAC, 0x6D, 0x74, 0x65, 0x34, 0xEE, 0x81, 0x58, 0xB9, 0x07, 0xFC, 0xC6, 0x3D, 0x80, 0x29,
+    0x2B, 0x7F, 0x5F, 0x94, 0xDF, 0xD5, 0x98, 0x15, 0x42, 0xF9, 0x51, 0xE9, 0x67, 0x28, 0xD4, 0x6C,
+    0x89, 0x96, 0x26, 0x4B, 0xDE, 0x92, 0x4B, 0xFA, 0xBE, 0x3F, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21,
     0x10, 0x85, 0xE1, 0x77, 0x43, 0x40, 0x70, 0x01, 0x76, 0x70, 0x25, 0x98, 0x98, 0x43, 0x27, 0xB6,
     0x61, 0xE2, 0x78, 0x55, 0x58, 0x8B, 0x99, 0x96, 0x40, 0x09, 0xD8, 0x03, 0x01, 0x01, 0xEC, 0x73,
     0xF7, 0x18, 0x99, 0x81, 0x3F, 0xF8, 0x66, 0x87, 0x05, 0xFE, 0xE7, 0x32, 0x33, 0x8E, 0xD7, 0x31,
@@ -2203,99 +2210,99 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 9, 22, 122, 0, 21, 50, 0 }, // !
-    { 10, 8, 183, 3, 21, 20, 50 }, // "
-    { 20, 21, 302, 0, 21, 105, 70 }, // #
-    { 16, 25, 257, 0, 23, 100, 175 }, // $
-    { 21, 23, 373, 2, 22, 121, 275 }, // %
-    { 19, 23, 314, 0, 22, 110, 396 }, // &
-    { 4, 8, 103, 3, 21, 8, 506 }, // '
-    { 10, 26, 135, 1, 21, 65, 514 }, // (
-    { 11, 26, 135, -3, 21, 72, 579 }, // )
-    { 14, 15, 257, 3, 23, 53, 651 }, // *
-    { 14, 15, 267, 2, 18, 53, 704 }, // +
-    { 7, 8, 119, -2, 4, 14, 757 }, // ,
-    { 9, 3, 146, 0, 9, 7, 771 }, // -
-    { 5, 5, 119, 0, 4, 7, 778 }, // .
-    { 15, 21, 166, -2, 21, 79, 785 }, // /
-    { 15, 23, 261, 1, 22, 87, 864 }, // 0
-    { 10, 21, 213, 2, 21, 53, 951 }, // 1
-    { 16, 22, 257, -1, 22, 88, 1004 }, // 2
-    { 16, 23, 257, -1, 22, 92, 1092 }, // 3
-    { 16, 21, 257, 0, 21, 84, 1184 }, // 4
-    { 15, 22, 257, 0, 21, 83, 1268 }, // 5
-    { 15, 23, 257, 1, 22, 87, 1351 }, // 6
-    { 15, 21, 223, 1, 21, 79, 1438 }, // 7
-    { 16, 23, 258, 0, 22, 92, 1517 }, // 8
-    { 15, 23, 257, 0, 22, 87, 1609 }, // 9
-    { 7, 18, 119, 0, 17, 32, 1696 }, // :
-    { 9, 21, 119, -2, 17, 48, 1728 }, // ;
-    { 14, 15, 267, 2, 18, 53, 1776 }, // <
-    { 14, 9, 267, 2, 15, 32, 1829 }, // =
-    { 14, 15, 267, 2, 18, 53, 1861 }, // >
-    { 12, 23, 201, 2, 22, 69, 1914 }, // ?
-    { 23, 24, 396, 1, 21, 138, 1983 }, // @
-    { 17, 21, 262, -2, 21, 90, 2121 }, // A
-    { 17, 21, 280, 1, 21, 90, 2211 }, // B
-    { 17, 23, 274, 2, 22, 98, 2301 }, // C
-    { 18, 21, 311, 1, 21, 95, 2399 }, // D
-    { 16, 21, 240, 1, 21, 84, 2494 }, // E
-    { 16, 21, 223, 1, 21, 84, 2578 }, // F
-    { 18, 23, 316, 2, 22, 104, 2662 }, // G
-    { 19, 21, 317, 1, 21, 100, 2766 }, // H
-    { 13, 21, 151, -1, 21, 69, 2866 }, // I
-    { 14, 27, 127, -5, 21, 95, 2935 }, // J
-    { 18, 21, 262, 1, 21, 95, 3030 }, // K
-    { 12, 21, 223, 1, 21, 63, 3125 }, // L
-    { 24, 21, 393, 1, 21, 126, 3188 }, // M
-    { 20, 21, 330, 1, 21, 105, 3314 }, // N
-    { 19, 23, 337, 2, 22, 110, 3419 }, // O
-    { 16, 21, 265, 1, 21, 84, 3529 }, // P
-    { 19, 27, 337, 2, 22, 129, 3613 }, // Q
-    { 16, 21, 267, 1, 21, 84, 3742 }, // R
-    { 16, 23, 236, 0, 22, 92, 3826 }, // S
-    { 16, 21, 234, 2, 21, 84, 3918 }, // T
-    { 19, 22, 316, 2, 21, 105, 4002 }, // U
-    { 17, 21, 258, 2, 21, 90, 4107 }, // V
-    { 25, 21, 400, 3, 21, 132, 4197 }, // W
-    { 20, 21, 246, -2, 21, 105, 4329 }, // X
-    { 16, 21, 238, 2, 21, 84, 4434 }, // Y
-    { 18, 21, 248, -1, 21, 95, 4518 }, // Z
-    { 12, 26, 135, -1, 21, 78, 4613 }, // [
-    { 6, 21, 166, 3, 21, 32, 4691 }, // <backslash>
-    { 12, 26, 135, -3, 21, 78, 4723 }, // ]
-    { 15, 14, 267, 1, 21, 53, 4801 }, // ^
-    { 13, 3, 184, -3, -2, 10, 4854 }, // _
-    { 6, 6, 130, 4, 23, 9, 4864 }, // `
-    { 16, 17, 265, 1, 16, 68, 4873 }, // a
-    { 16, 24, 270, 0, 23, 96, 4941 }, // b
-    { 13, 17, 211, 1, 16, 56, 5037 }, // c
-    { 17, 24, 270, 1, 23, 102, 5093 }, // d
-    { 13, 17, 233, 1, 16, 56, 5195 }, // e
-    { 17, 30, 148, -4, 23, 128, 5251 }, // f
-    { 17, 23, 270, 0, 16, 98, 5379 }, // g
-    { 16, 23, 270, 0, 23, 92, 5477 }, // h
-    { 8, 22, 120, 0, 22, 44, 5569 }, // i
-    { 12, 29, 120, -4, 22, 87, 5613 }, // j
-    { 16, 23, 231, 0, 23, 92, 5700 }, // k
-    { 9, 23, 120, 0, 23, 52, 5792 }, // l
-    { 24, 16, 408, 0, 16, 96, 5844 }, // m
-    { 16, 17, 270, 0, 17, 68, 5940 }, // n
-    { 15, 17, 263, 1, 16, 64, 6008 }, // o
-    { 17, 23, 270, -1, 16, 98, 6072 }, // p
-    { 16, 23, 270, 1, 16, 92, 6170 }, // q
-    { 13, 16, 186, 0, 16, 52, 6262 }, // r
-    { 13, 17, 202, 0, 16, 56, 6314 }, // s
-    { 10, 21, 155, 1, 20, 53, 6370 }, // t
-    { 16, 17, 270, 1, 16, 68, 6423 }, // u
-    { 15, 16, 218, 1, 16, 60, 6491 }, // v
-    { 22, 16, 337, 1, 16, 88, 6551 }, // w
-    { 17, 16, 225, -2, 16, 68, 6639 }, // x
-    { 19, 23, 218, -3, 16, 110, 6707 }, // y
-    { 14, 16, 208, -1, 16, 56, 6817 }, // z
-    { 12, 26, 163, 0, 21, 78, 6873 }, // {
-    { 3, 31, 257, 7, 23, 24, 6951 }, // |
-    { 13, 26, 163, -2, 21, 85, 6975 }, // }
-    { 14, 5, 267, 2, 13, 18, 7060 }, // ~
+    { 10, 8, 183, 3, 21, 20, 0 }, // "
+    { 20, 21, 302, 0, 21, 105, 20 }, // #
+    { 16, 25, 257, 0, 23, 100, 125 }, // $
+    { 21, 23, 373, 2, 22, 121, 225 }, // %
+    { 19, 23, 314, 0, 22, 110, 346 }, // &
+    { 4, 8, 103, 3, 21, 8, 456 }, // '
+    { 10, 26, 135, 1, 21, 65, 50 }, // (
+    { 11, 26, 135, -3, 21, 72, 115 }, // )
+    { 14, 15, 257, 3, 23, 53, 464 }, // *
+    { 14, 15, 267, 2, 18, 53, 517 }, // +
+    { 7, 8, 119, -2, 4, 14, 187 }, // ,
+    { 9, 3, 146, 0, 9, 7, 201 }, // -
+    { 5, 5, 119, 0, 4, 7, 208 }, // .
+    { 15, 21, 166, -2, 21, 79, 570 }, // /
+    { 15, 23, 261, 1, 22, 87, 215 }, // 0
+    { 10, 21, 213, 2, 21, 53, 302 }, // 1
+    { 16, 22, 257, -1, 22, 88, 355 }, // 2
+    { 16, 23, 257, -1, 22, 92, 443 }, // 3
+    { 16, 21, 257, 0, 21, 84, 535 }, // 4
+    { 15, 22, 257, 0, 21, 83, 619 }, // 5
+    { 15, 23, 257, 1, 22, 87, 702 }, // 6
+    { 15, 21, 223, 1, 21, 79, 789 }, // 7
+    { 16, 23, 258, 0, 22, 92, 868 }, // 8
+    { 15, 23, 257, 0, 22, 87, 960 }, // 9
+    { 7, 18, 119, 0, 17, 32, 1047 }, // :
+    { 9, 21, 119, -2, 17, 48, 1079 }, // ;
+    { 14, 15, 267, 2, 18, 53, 649 }, // <
+    { 14, 9, 267, 2, 15, 32, 702 }, // =
+    { 14, 15, 267, 2, 18, 53, 734 }, // >
+    { 12, 23, 201, 2, 22, 69, 1127 }, // ?
+    { 23, 24, 396, 1, 21, 138, 787 }, // @
+    { 17, 21, 262, -2, 21, 90, 1196 }, // A
+    { 17, 21, 280, 1, 21, 90, 1286 }, // B
+    { 17, 23, 274, 2, 22, 98, 1376 }, // C
+    { 18, 21, 311, 1, 21, 95, 1474 }, // D
+    { 16, 21, 240, 1, 21, 84, 1569 }, // E
+    { 16, 21, 223, 1, 21, 84, 1653 }, // F
+    { 18, 23, 316, 2, 22, 104, 1737 }, // G
+    { 19, 21, 317, 1, 21, 100, 1841 }, // H
+    { 13, 21, 151, -1, 21, 69, 1941 }, // I
+    { 14, 27, 127, -5, 21, 95, 2010 }, // J
+    { 18, 21, 262, 1, 21, 95, 2105 }, // K
+    { 12, 21, 223, 1, 21, 63, 2200 }, // L
+    { 24, 21, 393, 1, 21, 126, 2263 }, // M
+    { 20, 21, 330, 1, 21, 105, 2389 }, // N
+    { 19, 23, 337, 2, 22, 110, 2494 }, // O
+    { 16, 21, 265, 1, 21, 84, 2604 }, // P
+    { 19, 27, 337, 2, 22, 129, 2688 }, // Q
+    { 16, 21, 267, 1, 21, 84, 2817 }, // R
+    { 16, 23, 236, 0, 22, 92, 2901 }, // S
+    { 16, 21, 234, 2, 21, 84, 2993 }, // T
+    { 19, 22, 316, 2, 21, 105, 925 }, // U
+    { 17, 21, 258, 2, 21, 90, 3077 }, // V
+    { 25, 21, 400, 3, 21, 132, 3167 }, // W
+    { 20, 21, 246, -2, 21, 105, 3299 }, // X
+    { 16, 21, 238, 2, 21, 84, 3404 }, // Y
+    { 18, 21, 248, -1, 21, 95, 3488 }, // Z
+    { 12, 26, 135, -1, 21, 78, 1030 }, // [
+    { 6, 21, 166, 3, 21, 32, 1108 }, // <backslash>
+    { 12, 26, 135, -3, 21, 78, 1140 }, // ]
+    { 15, 14, 267, 1, 21, 53, 1218 }, // ^
+    { 13, 3, 184, -3, -2, 10, 1271 }, // _
+    { 6, 6, 130, 4, 23, 9, 1281 }, // `
+    { 16, 17, 265, 1, 16, 68, 3583 }, // a
+    { 16, 24, 270, 0, 23, 96, 3651 }, // b
+    { 13, 17, 211, 1, 16, 56, 3747 }, // c
+    { 17, 24, 270, 1, 23, 102, 3803 }, // d
+    { 13, 17, 233, 1, 16, 56, 3905 }, // e
+    { 17, 30, 148, -4, 23, 128, 3961 }, // f
+    { 17, 23, 270, 0, 16, 98, 4089 }, // g
+    { 16, 23, 270, 0, 23, 92, 4187 }, // h
+    { 8, 22, 120, 0, 22, 44, 4279 }, // i
+    { 12, 29, 120, -4, 22, 87, 4323 }, // j
+    { 16, 23, 231, 0, 23, 92, 4410 }, // k
+    { 9, 23, 120, 0, 23, 52, 4502 }, // l
+    { 24, 16, 408, 0, 16, 96, 4554 }, // m
+    { 16, 17, 270, 0, 17, 68, 4650 }, // n
+    { 15, 17, 263, 1, 16, 64, 4718 }, // o
+    { 17, 23, 270, -1, 16, 98, 4782 }, // p
+    { 16, 23, 270, 1, 16, 92, 4880 }, // q
+    { 13, 16, 186, 0, 16, 52, 4972 }, // r
+    { 13, 17, 202, 0, 16, 56, 5024 }, // s
+    { 10, 21, 155, 1, 20, 53, 5080 }, // t
+    { 16, 17, 270, 1, 16, 68, 5133 }, // u
+    { 15, 16, 218, 1, 16, 60, 5201 }, // v
+    { 22, 16, 337, 1, 16, 88, 5261 }, // w
+    { 17, 16, 225, -2, 16, 68, 5349 }, // x
+    { 19, 23, 218, -3, 16, 110, 5417 }, // y
+    { 14, 16, 208, -1, 16, 56, 5527 }, // z
+    { 12, 26, 163, 0, 21, 78, 1290 }, // {
+    { 3, 31, 257, 7, 23, 24, 1368 }, // |
+    { 13, 26, 163, -2, 21, 85, 1392 }, // }
+    { 14, 5, 267, 2, 13, 18, 1477 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 9, 22, 122, -1, 16, 50, 0 }, // U+00A1
     { 13, 23, 257, 3, 22, 75, 50 }, // U+00A2
@@ -2379,19 +2386,19 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 16, 24, 266, 1, 23, 96, 6868 }, // U+00F0
     { 17, 22, 270, 0, 22, 94, 6964 }, // U+00F1
     { 15, 24, 263, 1, 23, 90, 7058 }, // U+00F2
-    { 15, 24, 263, 1, 23, 90, 7148 }, // U+00F3
-    { 15, 24, 263, 1, 23, 90, 7238 }, // U+00F4
-    { 15, 23, 263, 1, 22, 87, 7328 }, // U+00F5
-    { 15, 23, 263, 1, 22, 87, 7415 }, // U+00F6
-    { 14, 14, 267, 2, 17, 49, 7502 }, // U+00F7
-    { 16, 19, 263, 0, 17, 76, 7551 }, // U+00F8
-    { 16, 24, 270, 1, 23, 96, 7627 }, // U+00F9
-    { 16, 24, 270, 1, 23, 96, 7723 }, // U+00FA
-    { 16, 24, 270, 1, 23, 96, 7819 }, // U+00FB
-    { 16, 23, 270, 1, 22, 92, 7915 }, // U+00FC
-    { 19, 30, 218, -3, 23, 143, 8007 }, // U+00FD
-    { 17, 30, 270, -1, 23, 128, 8150 }, // U+00FE
-    { 19, 29, 218, -3, 22, 138, 8278 }, // U+00FF
+    { 15, 24, 263, 1, 23, 90, 5583 }, // U+00F3
+    { 15, 24, 263, 1, 23, 90, 7148 }, // U+00F4
+    { 15, 23, 263, 1, 22, 87, 7238 }, // U+00F5
+    { 15, 23, 263, 1, 22, 87, 7325 }, // U+00F6
+    { 14, 14, 267, 2, 17, 49, 7412 }, // U+00F7
+    { 16, 19, 263, 0, 17, 76, 7461 }, // U+00F8
+    { 16, 24, 270, 1, 23, 96, 7537 }, // U+00F9
+    { 16, 24, 270, 1, 23, 96, 7633 }, // U+00FA
+    { 16, 24, 270, 1, 23, 96, 7729 }, // U+00FB
+    { 16, 23, 270, 1, 22, 92, 7825 }, // U+00FC
+    { 19, 30, 218, -3, 23, 143, 7917 }, // U+00FD
+    { 17, 30, 270, -1, 23, 128, 8060 }, // U+00FE
+    { 19, 29, 218, -3, 22, 138, 8188 }, // U+00FF
     { 18, 25, 262, -2, 25, 113, 0 }, // U+0100
     { 16, 21, 265, 1, 20, 84, 113 }, // U+0101
     { 19, 27, 262, -2, 27, 129, 197 }, // U+0102
@@ -3093,98 +3100,98 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 9, 3, 146, 0, 9, 7, 100 }, // U+2010
     { 9, 3, 146, 0, 9, 7, 107 }, // U+2011
     { 15, 3, 257, 1, 12, 12, 114 }, // U+2012
-    { 14, 4, 224, 0, 10, 14, 126 }, // U+2013
-    { 28, 4, 448, 0, 10, 28, 140 }, // U+2014
-    { 28, 4, 448, 0, 10, 28, 168 }, // U+2015
-    { 9, 31, 257, 4, 23, 70, 196 }, // U+2016
-    { 13, 7, 184, -3, 0, 23, 266 }, // U+2017
-    { 7, 8, 81, 1, 21, 14, 289 }, // U+2018
-    { 7, 8, 81, 1, 21, 14, 303 }, // U+2019
-    { 7, 8, 113, -2, 4, 14, 317 }, // U+201A
-    { 4, 8, 81, 3, 21, 8, 331 }, // U+201B
-    { 12, 8, 167, 1, 21, 24, 339 }, // U+201C
-    { 12, 8, 167, 1, 21, 24, 363 }, // U+201D
-    { 12, 8, 199, -2, 4, 24, 387 }, // U+201E
-    { 9, 8, 167, 3, 21, 18, 411 }, // U+201F
-    { 11, 23, 219, 3, 23, 64, 429 }, // U+2020
-    { 15, 23, 219, 0, 23, 87, 493 }, // U+2021
-    { 8, 8, 175, 2, 15, 16, 580 }, // U+2022
-    { 10, 10, 172, 1, 16, 25, 596 }, // U+2023
-    { 4, 5, 233, 4, 4, 5, 621 }, // U+2024
-    { 12, 5, 237, 0, 4, 15, 626 }, // U+2025
-    { 20, 5, 359, 0, 4, 25, 641 }, // U+2026
-    { 5, 5, 119, 1, 10, 7, 666 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 673 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 673 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 673 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 717 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 761 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 811 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 861 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 911 }, // U+202F
-    { 30, 23, 526, 2, 22, 173, 911 }, // U+2030
-    { 40, 23, 678, 2, 22, 230, 1084 }, // U+2031
-    { 8, 8, 103, 1, 21, 16, 1314 }, // U+2032
-    { 13, 8, 182, 1, 21, 26, 1330 }, // U+2033
-    { 18, 8, 260, 1, 21, 36, 1356 }, // U+2034
-    { 5, 8, 126, 3, 21, 10, 1392 }, // U+2035
-    { 10, 8, 198, 3, 21, 20, 1402 }, // U+2036
-    { 14, 8, 270, 3, 21, 28, 1422 }, // U+2037
-    { 11, 10, 186, -3, 3, 28, 1450 }, // U+2038
-    { 8, 13, 134, 1, 14, 26, 1478 }, // U+2039
-    { 8, 13, 134, 0, 14, 26, 1504 }, // U+203A
-    { 22, 23, 391, 1, 22, 127, 1530 }, // U+203B
-    { 15, 22, 231, 0, 21, 83, 1657 }, // U+203C
-    { 12, 23, 201, 2, 22, 69, 1740 }, // U+203D
-    { 13, 3, 183, 2, 25, 10, 1809 }, // U+203E
-    { 16, 7, 253, -2, 0, 28, 1819 }, // U+203F
-    { 16, 7, 253, 2, 24, 28, 1847 }, // U+2040
-    { 14, 19, 159, -3, 12, 67, 1875 }, // U+2041
-    { 31, 27, 522, 0, 23, 210, 1942 }, // U+2042
-    { 8, 3, 133, 0, 9, 6, 2152 }, // U+2043
-    { 18, 21, 61, -7, 21, 95, 2158 }, // U+2044
-    { 12, 26, 135, -1, 21, 78, 2253 }, // U+2045
-    { 12, 26, 135, -3, 21, 78, 2331 }, // U+2046
-    { 24, 23, 401, 2, 22, 138, 2409 }, // U+2047
-    { 19, 23, 323, 2, 22, 110, 2547 }, // U+2048
-    { 21, 23, 323, 0, 22, 121, 2657 }, // U+2049
-    { 15, 16, 243, 1, 16, 60, 2778 }, // U+204A
-    { 15, 27, 280, 3, 23, 102, 2838 }, // U+204B
-    { 16, 15, 298, 1, 16, 60, 2940 }, // U+204C
-    { 16, 15, 298, 2, 16, 60, 3000 }, // U+204D
-    { 15, 15, 257, -1, 8, 57, 3060 }, // U+204E
-    { 7, 21, 119, 0, 17, 37, 3117 }, // U+204F
-    { 20, 31, 253, -2, 24, 155, 3154 }, // U+2050
-    { 17, 30, 257, 0, 23, 128, 3309 }, // U+2051
-    { 11, 23, 174, 0, 22, 64, 3437 }, // U+2052
-    { 26, 5, 467, 2, 11, 33, 3501 }, // U+2053
-    { 16, 7, 253, -3, 0, 28, 3534 }, // U+2054
-    { 16, 16, 267, 0, 15, 64, 3562 }, // U+2055
-    { 13, 23, 241, 1, 22, 75, 3626 }, // U+2056
-    { 23, 8, 338, 1, 21, 46, 3701 }, // U+2057
-    { 22, 23, 384, 1, 22, 127, 3747 }, // U+2058
-    { 22, 23, 387, 1, 22, 127, 3874 }, // U+2059
-    { 4, 23, 103, 1, 22, 23, 4001 }, // U+205A
-    { 17, 23, 305, 1, 22, 98, 4024 }, // U+205B
-    { 22, 23, 372, 1, 22, 127, 4122 }, // U+205C
-    { 4, 22, 125, 2, 21, 22, 4249 }, // U+205D
-    { 5, 23, 125, 2, 22, 29, 4271 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 4300 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2064
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2066
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2067
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2068
-    { 0, 0, 280, 0, 0, 0, 4300 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 4300 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4350 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4400 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4450 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4500 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 4550 }, // U+206F
+    { 14, 4, 224, 0, 10, 14, 5673 }, // U+2013
+    { 28, 4, 448, 0, 10, 28, 5687 }, // U+2014
+    { 28, 4, 448, 0, 10, 28, 126 }, // U+2015
+    { 9, 31, 257, 4, 23, 70, 154 }, // U+2016
+    { 13, 7, 184, -3, 0, 23, 224 }, // U+2017
+    { 7, 8, 81, 1, 21, 14, 247 }, // U+2018
+    { 7, 8, 81, 1, 21, 14, 5715 }, // U+2019
+    { 7, 8, 113, -2, 4, 14, 261 }, // U+201A
+    { 4, 8, 81, 3, 21, 8, 275 }, // U+201B
+    { 12, 8, 167, 1, 21, 24, 5729 }, // U+201C
+    { 12, 8, 167, 1, 21, 24, 5753 }, // U+201D
+    { 12, 8, 199, -2, 4, 24, 283 }, // U+201E
+    { 9, 8, 167, 3, 21, 18, 307 }, // U+201F
+    { 11, 23, 219, 3, 23, 64, 325 }, // U+2020
+    { 15, 23, 219, 0, 23, 87, 389 }, // U+2021
+    { 8, 8, 175, 2, 15, 16, 476 }, // U+2022
+    { 10, 10, 172, 1, 16, 25, 492 }, // U+2023
+    { 4, 5, 233, 4, 4, 5, 517 }, // U+2024
+    { 12, 5, 237, 0, 4, 15, 522 }, // U+2025
+    { 20, 5, 359, 0, 4, 25, 5777 }, // U+2026
+    { 5, 5, 119, 1, 10, 7, 537 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 544 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 544 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 544 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 588 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 632 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 682 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 732 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 782 }, // U+202F
+    { 30, 23, 526, 2, 22, 173, 782 }, // U+2030
+    { 40, 23, 678, 2, 22, 230, 955 }, // U+2031
+    { 8, 8, 103, 1, 21, 16, 1185 }, // U+2032
+    { 13, 8, 182, 1, 21, 26, 1201 }, // U+2033
+    { 18, 8, 260, 1, 21, 36, 1227 }, // U+2034
+    { 5, 8, 126, 3, 21, 10, 1263 }, // U+2035
+    { 10, 8, 198, 3, 21, 20, 1273 }, // U+2036
+    { 14, 8, 270, 3, 21, 28, 1293 }, // U+2037
+    { 11, 10, 186, -3, 3, 28, 1321 }, // U+2038
+    { 8, 13, 134, 1, 14, 26, 1349 }, // U+2039
+    { 8, 13, 134, 0, 14, 26, 1375 }, // U+203A
+    { 22, 23, 391, 1, 22, 127, 1401 }, // U+203B
+    { 15, 22, 231, 0, 21, 83, 1528 }, // U+203C
+    { 12, 23, 201, 2, 22, 69, 1611 }, // U+203D
+    { 13, 3, 183, 2, 25, 10, 1680 }, // U+203E
+    { 16, 7, 253, -2, 0, 28, 1690 }, // U+203F
+    { 16, 7, 253, 2, 24, 28, 1718 }, // U+2040
+    { 14, 19, 159, -3, 12, 67, 1746 }, // U+2041
+    { 31, 27, 522, 0, 23, 210, 1813 }, // U+2042
+    { 8, 3, 133, 0, 9, 6, 2023 }, // U+2043
+    { 18, 21, 61, -7, 21, 95, 2029 }, // U+2044
+    { 12, 26, 135, -1, 21, 78, 2124 }, // U+2045
+    { 12, 26, 135, -3, 21, 78, 2202 }, // U+2046
+    { 24, 23, 401, 2, 22, 138, 2280 }, // U+2047
+    { 19, 23, 323, 2, 22, 110, 2418 }, // U+2048
+    { 21, 23, 323, 0, 22, 121, 2528 }, // U+2049
+    { 15, 16, 243, 1, 16, 60, 2649 }, // U+204A
+    { 15, 27, 280, 3, 23, 102, 2709 }, // U+204B
+    { 16, 15, 298, 1, 16, 60, 2811 }, // U+204C
+    { 16, 15, 298, 2, 16, 60, 2871 }, // U+204D
+    { 15, 15, 257, -1, 8, 57, 2931 }, // U+204E
+    { 7, 21, 119, 0, 17, 37, 2988 }, // U+204F
+    { 20, 31, 253, -2, 24, 155, 3025 }, // U+2050
+    { 17, 30, 257, 0, 23, 128, 3180 }, // U+2051
+    { 11, 23, 174, 0, 22, 64, 3308 }, // U+2052
+    { 26, 5, 467, 2, 11, 33, 3372 }, // U+2053
+    { 16, 7, 253, -3, 0, 28, 3405 }, // U+2054
+    { 16, 16, 267, 0, 15, 64, 3433 }, // U+2055
+    { 13, 23, 241, 1, 22, 75, 3497 }, // U+2056
+    { 23, 8, 338, 1, 21, 46, 3572 }, // U+2057
+    { 22, 23, 384, 1, 22, 127, 3618 }, // U+2058
+    { 22, 23, 387, 1, 22, 127, 3745 }, // U+2059
+    { 4, 23, 103, 1, 22, 23, 3872 }, // U+205A
+    { 17, 23, 305, 1, 22, 98, 3895 }, // U+205B
+    { 22, 23, 372, 1, 22, 127, 3993 }, // U+205C
+    { 4, 22, 125, 2, 21, 22, 4120 }, // U+205D
+    { 5, 23, 125, 2, 22, 29, 4142 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 4171 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2064
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2066
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2067
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2068
+    { 0, 0, 280, 0, 0, 0, 4171 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 4171 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 4221 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 4271 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4321 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4371 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4421 }, // U+206F
     { 10, 14, 165, 2, 25, 35, 0 }, // U+2070
     { 5, 14, 104, 2, 22, 18, 35 }, // U+2071
     { 10, 13, 165, 2, 25, 33, 53 }, // U+2074
@@ -3260,13 +3267,13 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 20, 24, 274, -1, 24, 120, 3289 }, // U+20BE
     { 16, 27, 257, 1, 24, 108, 3409 }, // U+20BF
     { 9, 3, 146, 0, 9, 7, 0 }, // U+2212
-    { 27, 30, 298, -4, 23, 203, 0 }, // U+FB00
-    { 22, 30, 269, -4, 23, 165, 203 }, // U+FB01
-    { 22, 30, 269, -4, 23, 165, 368 }, // U+FB02
-    { 31, 30, 418, -4, 23, 233, 533 }, // U+FB03
-    { 31, 30, 418, -4, 23, 233, 766 }, // U+FB04
-    { 23, 30, 287, -4, 23, 173, 999 }, // U+FB05
-    { 24, 24, 357, 0, 23, 144, 1172 }, // U+FB06
+    { 27, 30, 298, -4, 23, 203, 5802 }, // U+FB00
+    { 22, 30, 269, -4, 23, 165, 6005 }, // U+FB01
+    { 22, 30, 269, -4, 23, 165, 6170 }, // U+FB02
+    { 31, 30, 418, -4, 23, 233, 6335 }, // U+FB03
+    { 31, 30, 418, -4, 23, 233, 6568 }, // U+FB04
+    { 23, 30, 287, -4, 23, 173, 0 }, // U+FB05
+    { 24, 24, 357, 0, 23, 144, 173 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -3274,8 +3281,7 @@ static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3283,8 +3289,7 @@ static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3294,19 +3299,57 @@ static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
 };
 
 static const EpdFontGroup notosans_14_italicGroups[] = {
-    { 0, 3684, 7646, 97, 0 },
-    { 3684, 3179, 9086, 96, 97 },
-    { 6863, 4081, 14239, 128, 193 },
-    { 10944, 4005, 12390, 96, 321 },
-    { 14949, 1340, 2019, 112, 417 },
-    { 16289, 10390, 28319, 256, 529 },
-    { 26679, 2365, 11884, 90, 785 },
-    { 29044, 2207, 4899, 111, 875 },
-    { 31251, 903, 1385, 42, 986 },
-    { 32154, 2155, 3768, 32, 1028 },
-    { 34309, 11, 9, 1, 1060 },
-    { 34320, 538, 1374, 7, 1061 },
-    { 34858, 132, 196, 1, 1068 },
+    { 0, 3294, 7310, 83, 2 },
+    { 3294, 903, 1615, 26, 0 },
+    { 4197, 3169, 8990, 95, 97 },
+    { 7366, 4081, 14239, 128, 193 },
+    { 11447, 4005, 12390, 96, 321 },
+    { 15452, 1340, 2019, 112, 417 },
+    { 16792, 10390, 28319, 256, 529 },
+    { 27182, 2365, 11884, 90, 785 },
+    { 29547, 2148, 4766, 105, 875 },
+    { 31695, 903, 1385, 42, 986 },
+    { 32598, 2155, 3768, 32, 1028 },
+    { 34753, 11, 9, 1, 1060 },
+    { 34764, 206, 324, 2, 1066 },
+    { 34970, 132, 196, 1, 1068 },
+};
+
+static const uint16_t notosans_14_italicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_14_italicKernLeftClasses[] = {
@@ -4358,18 +4401,81 @@ static const EpdLigaturePair notosans_14_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_14_italicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 1, 0 }, { 0x0003, 0, 1 }, { 0x0004, 2, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 3, 3 }, { 0x0009, 2, 2 }, // U+0020
+    { 0x000A, 4, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 13, 0 }, { 0x002E, 14, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 15, 0 }, { 0x0033, 10, 10 }, { 0x0034, 16, 0 }, { 0x0035, 0, 13 }, { 0x0036, 17, 14 }, { 0x0037, 18, 15 }, { 0x0038, 19, 16 }, { 0x0039, 19, 16 }, // U+0050
+    { 0x003A, 13, 17 }, { 0x003B, 20, 18 }, { 0x003C, 21, 19 }, { 0x003D, 4, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 22, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 20 }, { 0x0044, 24, 0 }, { 0x0045, 25, 21 }, { 0x0046, 0, 21 }, { 0x0047, 24, 21 }, { 0x0048, 26, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 0, 0 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 27, 0 }, { 0x004E, 0, 0 }, { 0x004F, 0, 25 }, { 0x0050, 0, 25 }, { 0x0051, 24, 21 }, // U+0068
+    { 0x0052, 24, 25 }, { 0x0053, 0, 21 }, { 0x0054, 28, 25 }, { 0x0055, 0, 26 }, { 0x0056, 29, 27 }, { 0x0057, 0, 25 }, { 0x0058, 30, 28 }, { 0x0059, 30, 28 }, // U+0070
+    { 0x005A, 27, 0 }, { 0x005B, 30, 28 }, { 0x005C, 0, 29 }, { 0x005D, 4, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 31, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 32, 30 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 33, 31 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 34, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 32 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 18, 15 }, { 0x009B, 18, 15 }, { 0x009C, 18, 15 }, { 0x009D, 18, 15 }, { 0x009E, 20, 18 }, { 0x009F, 15, 0 }, { 0x00A0, 0, 24 }, // U+00D8
+    { 0x00A1, 23, 21 }, { 0x00A2, 23, 20 }, { 0x00A3, 23, 20 }, { 0x00A4, 23, 20 }, { 0x00A5, 23, 20 }, { 0x00A6, 23, 20 }, { 0x00A7, 24, 20 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 24, 21 }, { 0x00AA, 24, 21 }, { 0x00AB, 24, 21 }, { 0x00AC, 24, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 0, 0 }, { 0x00B0, 35, 0 }, // U+00E8
+    { 0x00B1, 24, 0 }, { 0x00B2, 0, 25 }, { 0x00B3, 24, 21 }, { 0x00B4, 24, 21 }, { 0x00B5, 24, 21 }, { 0x00B6, 24, 21 }, { 0x00B7, 24, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 30, 28 }, { 0x00BF, 24, 0 }, { 0x00C0, 30, 28 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 23, 20 }, { 0x00C3, 7, 9 }, { 0x00C4, 23, 20 }, { 0x00C5, 7, 9 }, { 0x00C6, 23, 20 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 36, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 24, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 24, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 24, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 24, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 24, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 33 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 37, 34 }, { 0x00EB, 0, 0 }, { 0x00EC, 35, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 38, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 24 }, { 0x00F7, 13, 0 }, { 0x00F8, 27, 0 }, // U+0130
+    { 0x00F9, 27, 25 }, { 0x00FA, 14, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 14, 0 }, { 0x00FD, 0, 0 }, { 0x00FE, 14, 0 }, { 0x00FF, 36, 0 }, { 0x0100, 14, 0 }, // U+0138
+    { 0x0101, 0, 0 }, { 0x0102, 14, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 0, 25 }, { 0x0106, 0, 0 }, { 0x0107, 0, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 25 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 25 }, { 0x010D, 10, 10 }, { 0x010E, 24, 21 }, { 0x010F, 10, 10 }, { 0x0110, 24, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 24, 21 }, { 0x0113, 11, 10 }, { 0x0114, 24, 21 }, { 0x0115, 0, 0 }, { 0x0116, 28, 25 }, { 0x0117, 0, 0 }, { 0x0118, 28, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 28, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 26 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 26 }, { 0x0123, 17, 14 }, { 0x0124, 29, 27 }, { 0x0125, 17, 14 }, { 0x0126, 39, 27 }, { 0x0127, 17, 14 }, { 0x0128, 29, 27 }, // U+0160
+    { 0x0129, 18, 15 }, { 0x012A, 0, 25 }, { 0x012B, 18, 15 }, { 0x012C, 0, 25 }, { 0x012D, 18, 15 }, { 0x012E, 0, 25 }, { 0x012F, 18, 15 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 18, 15 }, { 0x0132, 0, 25 }, { 0x0133, 18, 15 }, { 0x0134, 0, 25 }, { 0x0135, 19, 16 }, { 0x0136, 30, 28 }, { 0x0137, 20, 18 }, { 0x0138, 30, 28 }, // U+0170
+    { 0x0139, 20, 18 }, { 0x013A, 21, 19 }, { 0x013B, 0, 29 }, { 0x013C, 21, 19 }, { 0x013D, 0, 29 }, { 0x013E, 21, 19 }, { 0x013F, 0, 29 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 35 }, { 0x0214, 45, 0 }, { 0x0215, 46, 36 }, { 0x0216, 47, 37 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 48, 38 }, { 0x021A, 44, 39 }, { 0x021B, 44, 0 }, { 0x021C, 49, 35 }, { 0x021D, 50, 0 }, { 0x021E, 0, 0 }, { 0x021F, 51, 40 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 52, 41 }, { 0x0222, 53, 0 }, { 0x0223, 54, 0 }, { 0x0224, 45, 0 }, { 0x0225, 55, 42 }, { 0x0226, 0, 0 }, { 0x0227, 50, 43 }, { 0x0228, 54, 44 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 50, 0 }, { 0x022C, 0, 39 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 56, 36 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 57, 0 }, { 0x0232, 46, 36 }, { 0x0233, 45, 35 }, { 0x0234, 51, 40 }, { 0x0235, 58, 45 }, { 0x0236, 50, 43 }, { 0x0237, 55, 0 }, { 0x0238, 0, 46 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 55, 0 }, { 0x023B, 44, 35 }, { 0x023C, 0, 0 }, { 0x023D, 44, 0 }, { 0x023E, 56, 44 }, { 0x023F, 56, 0 }, { 0x0240, 0, 47 }, // U+0428
+    { 0x0241, 59, 48 }, { 0x0242, 60, 49 }, { 0x0243, 61, 48 }, { 0x0244, 62, 50 }, { 0x0245, 63, 51 }, { 0x0246, 62, 48 }, { 0x0247, 64, 52 }, { 0x0248, 61, 50 }, // U+0430
+    { 0x0249, 59, 53 }, { 0x024A, 59, 53 }, { 0x024B, 65, 54 }, { 0x024C, 59, 55 }, { 0x024D, 59, 54 }, { 0x024E, 59, 54 }, { 0x024F, 66, 48 }, { 0x0250, 67, 54 }, // U+0438
+    { 0x0251, 66, 54 }, { 0x0252, 64, 48 }, { 0x0253, 67, 54 }, { 0x0254, 68, 56 }, { 0x0255, 66, 48 }, { 0x0256, 65, 57 }, { 0x0257, 69, 53 }, { 0x0258, 59, 58 }, // U+0440
+    { 0x0259, 59, 53 }, { 0x025A, 69, 53 }, { 0x025B, 70, 59 }, { 0x025C, 59, 53 }, { 0x025D, 70, 53 }, { 0x025E, 66, 52 }, { 0x025F, 66, 54 }, { 0x0260, 59, 60 }, // U+0448
+    { 0x0261, 62, 48 }, { 0x0262, 62, 48 }, { 0x0263, 71, 61 }, { 0x0264, 62, 50 }, { 0x0265, 64, 48 }, { 0x0266, 72, 62 }, { 0x0267, 0, 0 }, { 0x0268, 73, 63 }, // U+0450
+    { 0x0269, 74, 64 }, { 0x026A, 70, 55 }, { 0x026B, 70, 54 }, { 0x026C, 67, 61 }, { 0x026D, 65, 54 }, { 0x026E, 59, 53 }, { 0x026F, 75, 65 }, { 0x0270, 59, 53 }, // U+0458
+};
+
 static const EpdFontData notosans_14_italic = {
     notosans_14_italicBitmaps,
     notosans_14_italicGlyphs,
     notosans_14_italicIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notosans_14_italicGroups,
-    13,
-    nullptr,
+    14,
+    notosans_14_italicGlyphToGroup,
     notosans_14_italicKernLeftClasses,
     notosans_14_italicKernRightClasses,
     notosans_14_italicKernMatrix,
@@ -4379,4 +4485,8 @@ static const EpdFontData notosans_14_italic = {
     83,
     notosans_14_italicLigaturePairs,
     5,
+    notosans_14_italicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,1897 +3,1901 @@
  * name: notosans_14_regular
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_regularBitmaps[30158] = {
-    0xBD, 0x59, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0x61, 0x13, 0x08, 0x81, 0xB2, 0x83, 0xDD,
-    0x06, 0x31, 0x1A, 0x76, 0xF0, 0xD0, 0x1A, 0xB1, 0xB8, 0xB6, 0x80, 0xF8, 0x93, 0x66, 0xF0, 0x18,
-    0x0D, 0x7E, 0x09, 0x50, 0x0F, 0xEE, 0xE0, 0x21, 0x48, 0x51, 0x68, 0x75, 0x8B, 0x27, 0x3D, 0xA2,
-    0x19, 0x3A, 0x74, 0xA8, 0x86, 0x66, 0xF7, 0xE0, 0xC1, 0x50, 0x07, 0x67, 0xF0, 0xA0, 0xB4, 0x7C,
-    0x22, 0xD3, 0x0C, 0x19, 0xC3, 0x36, 0xE8, 0xD4, 0x21, 0x44, 0x23, 0xB7, 0x40, 0x16, 0xB3, 0x08,
-    0x0D, 0xD3, 0x09, 0xF5, 0x6E, 0xBF, 0xEF, 0x90, 0x4F, 0x92, 0x13, 0x59, 0x56, 0x90, 0xA0, 0x14,
-    0xCF, 0x31, 0xDF, 0xE5, 0xE5, 0xB9, 0xF7, 0xDC, 0xF3, 0x73, 0xBF, 0x73, 0x3D, 0x9F, 0xCF, 0x37,
-    0x36, 0xA6, 0xD3, 0xE9, 0xEA, 0x70, 0x89, 0x9C, 0xDB, 0x5D, 0xCC, 0xCF, 0xC5, 0x5E, 0x89, 0x3B,
-    0xE2, 0x9D, 0x45, 0x6E, 0x76, 0xD9, 0xCD, 0x5E, 0x72, 0xB3, 0xE7, 0xED, 0x54, 0xEC, 0xF2, 0x07,
-    0x22, 0x4E, 0x79, 0x99, 0x0C, 0x9D, 0xDD, 0x0C, 0xCC, 0xCB, 0x6E, 0x8A, 0xF8, 0xE9, 0x4D, 0x79,
-    0xEE, 0xEE, 0xF6, 0xE2, 0x96, 0x6F, 0x8C, 0x69, 0xCE, 0xAC, 0x4F, 0x1E, 0xAE, 0xC9, 0x8A, 0xD5,
-    0x88, 0x5C, 0xB6, 0x6A, 0x91, 0x55, 0xBB, 0x02, 0x73, 0x4A, 0x99, 0xE1, 0x6D, 0x99, 0x90, 0xC9,
-    0x3D, 0x37, 0x13, 0x69, 0xBC, 0x14, 0xCC, 0x97, 0x81, 0x59, 0x75, 0x20, 0x62, 0x57, 0x2F, 0xCA,
-    0x70, 0xF1, 0x1D, 0xE9, 0xFA, 0x6D, 0x71, 0xF1, 0x45, 0x60, 0x8A, 0x32, 0xF1, 0x5E, 0x4E, 0x23,
-    0xB4, 0x91, 0x12, 0x50, 0xF8, 0xCF, 0x54, 0x3C, 0x93, 0x89, 0x65, 0xF6, 0x31, 0x07, 0x3C, 0x78,
-    0xD7, 0x6B, 0xF1, 0x5E, 0x69, 0xC4, 0x7B, 0x19, 0xF4, 0xB3, 0xE6, 0xA2, 0x77, 0xA5, 0x4E, 0x1E,
-    0x70, 0xC8, 0x85, 0x58, 0xEB, 0x5B, 0x87, 0x32, 0xCF, 0xCA, 0x72, 0x90, 0x0E, 0xC3, 0x4A, 0x50,
-    0x88, 0x53, 0x49, 0xE4, 0xA7, 0x5E, 0x26, 0x53, 0x37, 0xC3, 0x5C, 0x6E, 0x3A, 0xE5, 0x8A, 0xC8,
-    0x8E, 0xAA, 0x09, 0xBE, 0x43, 0xFE, 0x5E, 0xC3, 0xF6, 0xF7, 0xFF, 0xB6, 0x23, 0xAB, 0xEE, 0xEF,
-    0x3E, 0x30, 0x69, 0xE4, 0xBF, 0xFA, 0xEA, 0x15, 0xCC, 0x6B, 0xE5, 0x45, 0xA7, 0x72, 0xBB, 0x55,
-    0x55, 0x75, 0x27, 0xA2, 0xD6, 0x0D, 0xB9, 0x5D, 0x93, 0xBB, 0x25, 0xDB, 0xFD, 0x74, 0xC5, 0xC6,
-    0x30, 0xE2, 0x63, 0x11, 0x22, 0xF1, 0x1F, 0x94, 0xB2, 0x23, 0x8E, 0xD1, 0x19, 0x7C, 0x77, 0x39,
-    0x95, 0x59, 0x07, 0x66, 0x19, 0xB6, 0x3A, 0x4D, 0x88, 0xD5, 0x71, 0x4B, 0xBF, 0x24, 0xF7, 0xCA,
-    0xE5, 0xB3, 0x53, 0x07, 0x98, 0xBC, 0xD5, 0xEE, 0xB2, 0x7F, 0xD1, 0xE9, 0x57, 0x58, 0x5A, 0xB1,
-    0x4D, 0x25, 0x57, 0xC5, 0xFF, 0xA4, 0x93, 0x5E, 0xC2, 0x6C, 0x21, 0xAD, 0x24, 0x92, 0xFC, 0xB6,
-    0x91, 0x0D, 0xB4, 0xD5, 0x32, 0xC5, 0x50, 0x25, 0x9E, 0xC5, 0x60, 0xD5, 0xC0, 0x33, 0x09, 0xAB,
-    0x0B, 0x06, 0x93, 0x32, 0xE6, 0xAF, 0x1D, 0xBE, 0xDD, 0x17, 0xC8, 0x3B, 0x43, 0x61, 0x71, 0x1C,
-    0x45, 0xD1, 0xE5, 0x97, 0x9E, 0x97, 0x7B, 0x76, 0xE3, 0x54, 0x5E, 0xE9, 0xA7, 0xA1, 0xC4, 0x98,
-    0xF0, 0x54, 0x72, 0xFC, 0xF5, 0xE3, 0x1F, 0x9F, 0x37, 0xD0, 0x9A, 0x48, 0x28, 0x7E, 0xE6, 0x95,
-    0x4E, 0x05, 0x3D, 0x6F, 0xAC, 0x40, 0x49, 0x3E, 0xDB, 0x8D, 0xD5, 0x4A, 0x87, 0x2E, 0x53, 0xED,
-    0x14, 0x8F, 0x7F, 0x11, 0x7E, 0x51, 0x4C, 0x67, 0xB5, 0x8E, 0xCA, 0x0E, 0xE4, 0xC7, 0x83, 0xDE,
-    0x54, 0x09, 0x86, 0x17, 0x7F, 0xA0, 0x5F, 0xFB, 0x67, 0xEB, 0xE2, 0x81, 0xA9, 0x7F, 0x69, 0x16,
-    0x5B, 0x92, 0x40, 0xE9, 0xBF, 0xD4, 0x62, 0xFD, 0xB7, 0xC5, 0x9A, 0xF4, 0xE2, 0x55, 0x9B, 0x62,
-    0x65, 0x17, 0x87, 0xD9, 0x2E, 0x6D, 0x79, 0x84, 0xCE, 0x5F, 0x7F, 0x7B, 0xAD, 0x80, 0x03, 0xC2,
-    0xCF, 0x9A, 0xE3, 0xDE, 0x93, 0xCE, 0x60, 0xC0, 0x10, 0x73, 0xA7, 0x56, 0x37, 0xE5, 0x1D, 0x31,
-    0xBD, 0xE9, 0x27, 0x57, 0xD5, 0xEF, 0x05, 0x0B, 0x07, 0x55, 0x9C, 0x9A, 0xDE, 0x80, 0x55, 0xF7,
-    0x33, 0x4E, 0x2C, 0x14, 0xF4, 0x45, 0x67, 0x28, 0x85, 0xF7, 0xB6, 0xBE, 0x77, 0x4B, 0x7D, 0x9F,
-    0xF2, 0x7D, 0xAC, 0xEF, 0xF3, 0xD1, 0x8A, 0x05, 0x66, 0x0A, 0x6F, 0xF3, 0xEA, 0x30, 0xE3, 0xDA,
-    0x84, 0xE8, 0x1D, 0xE3, 0xA3, 0x08, 0x82, 0x41, 0x2D, 0xC4, 0x7C, 0x85, 0xD8, 0xCE, 0xF7, 0xEC,
-    0xC7, 0xFE, 0x7E, 0xEA, 0x56, 0x5E, 0x15, 0x94, 0x0E, 0x7D, 0x81, 0x56, 0xB6, 0xB8, 0x32, 0xA9,
-    0xCC, 0x52, 0xDB, 0xA4, 0xFE, 0xC7, 0x69, 0xF2, 0x6A, 0xFA, 0x12, 0x7E, 0x7E, 0xAD, 0x5B, 0x9D,
-    0xA4, 0x96, 0x10, 0xC6, 0x9E, 0xA5, 0xB3, 0xF4, 0x22, 0x75, 0xA3, 0x0A, 0x07, 0xC4, 0xDF, 0xB4,
-    0x04, 0x1C, 0x84, 0xBA, 0xD8, 0x2D, 0x9A, 0xE1, 0x5A, 0x21, 0x9A, 0xE6, 0x4F, 0xFE, 0xDC, 0x9D,
-    0x4C, 0xD6, 0x18, 0xE5, 0xA4, 0x41, 0x6E, 0x0B, 0xB9, 0x46, 0x92, 0x74, 0x3D, 0x3B, 0xA7, 0xB2,
-    0xDC, 0x6A, 0x24, 0xCA, 0x05, 0xCD, 0xE0, 0xD6, 0x74, 0x34, 0xA8, 0x32, 0x29, 0xB2, 0x41, 0x92,
-    0x83, 0x6F, 0xED, 0x91, 0xF8, 0xEC, 0xD6, 0xB7, 0x25, 0x2C, 0x61, 0x3C, 0xC8, 0x42, 0xBF, 0x73,
-    0x94, 0xCC, 0x6F, 0xD1, 0x48, 0x2F, 0x27, 0xFB, 0x02, 0xCC, 0xFE, 0x0F, 0xE5, 0x7F, 0x40, 0xC1,
-    0x57, 0xC0, 0x62, 0x0E, 0x31, 0x25, 0x6B, 0xC0, 0x9C, 0x5A, 0xED, 0x02, 0x16, 0x70, 0xEC, 0x88,
-    0x8C, 0x29, 0x67, 0x60, 0xE7, 0x27, 0xD7, 0xFE, 0x21, 0xC3, 0xA4, 0x9E, 0x64, 0x88, 0x83, 0x14,
-    0x94, 0xF9, 0xDB, 0xDB, 0xE9, 0xE8, 0x84, 0xEA, 0x90, 0x4B, 0x0A, 0xEF, 0x6E, 0x61, 0x52, 0x0B,
-    0x79, 0xEE, 0x6D, 0x4E, 0xDE, 0xFF, 0xD2, 0xE4, 0x55, 0x81, 0x9A, 0x4A, 0xFD, 0x04, 0x73, 0x45,
-    0x72, 0x93, 0x00, 0x0B, 0x32, 0x28, 0x40, 0x2F, 0x45, 0xB8, 0x15, 0x26, 0xB3, 0xF7, 0xA9, 0xE2,
-    0xB8, 0xCC, 0xA2, 0x4E, 0x45, 0xC7, 0x91, 0x28, 0xE8, 0x24, 0xC2, 0xF8, 0xB3, 0x2A, 0xA8, 0x66,
-    0x90, 0xBB, 0x09, 0x79, 0x53, 0xF5, 0x07, 0xF5, 0x0B, 0xF8, 0x83, 0xDD, 0x04, 0xA9, 0x53, 0x8F,
-    0xFE, 0x90, 0x4A, 0x01, 0x41, 0x16, 0xFE, 0x19, 0x0D, 0xF0, 0xE6, 0xF6, 0x9F, 0xC6, 0xF1, 0xDD,
-    0x2F, 0x19, 0x11, 0xF1, 0x8E, 0x58, 0xA5, 0xCB, 0x1E, 0x4E, 0x71, 0xEC, 0xC2, 0xC1, 0x8F, 0x74,
-    0x41, 0xBC, 0xAA, 0x46, 0x32, 0x66, 0x15, 0x97, 0xEB, 0x81, 0xF1, 0x02, 0x7C, 0x14, 0x32, 0x17,
-    0x81, 0x38, 0x07, 0x1F, 0x39, 0xC8, 0xE9, 0x66, 0xC8, 0x20, 0xDD, 0xD0, 0xEF, 0x61, 0x91, 0xFA,
-    0x99, 0x5F, 0x25, 0x78, 0x1F, 0x8D, 0xBE, 0x0C, 0x91, 0xAD, 0xFA, 0x71, 0xE6, 0xD5, 0x58, 0xD3,
-    0x52, 0x33, 0xB3, 0x95, 0x8E, 0xB2, 0x11, 0x38, 0xF8, 0x0D, 0x4D, 0xD3, 0x04, 0x93, 0x89, 0x10,
-    0x66, 0x53, 0xF4, 0xCD, 0xA1, 0x27, 0x89, 0xCF, 0xB1, 0xB8, 0xF8, 0x36, 0x68, 0x7C, 0xB3, 0x68,
-    0x6C, 0xF3, 0xAF, 0x23, 0xEB, 0xBB, 0x74, 0x26, 0xB8, 0xA0, 0xB5, 0x80, 0xCD, 0x3A, 0x4D, 0xF8,
-    0xB2, 0x46, 0x3D, 0x16, 0x8B, 0xE9, 0x32, 0x8B, 0x8E, 0x81, 0x8C, 0x7C, 0x59, 0xFB, 0xB5, 0x5A,
-    0xF8, 0x89, 0xEB, 0x4C, 0x4A, 0x2D, 0xFC, 0x2C, 0xC0, 0x22, 0x44, 0xF2, 0xA3, 0x31, 0x01, 0x33,
-    0x67, 0x07, 0x0D, 0xBC, 0x14, 0x01, 0xDD, 0x52, 0xBC, 0x04, 0x18, 0x91, 0x59, 0x76, 0x86, 0x4D,
-    0xC3, 0xDD, 0xE7, 0x43, 0x4D, 0x4F, 0x87, 0x22, 0x61, 0x33, 0xF4, 0x1F, 0x12, 0xF7, 0x6C, 0x99,
-    0x6D, 0x8E, 0x5C, 0xE7, 0x11, 0x20, 0x6C, 0xBB, 0xB4, 0xBD, 0x7D, 0x8B, 0x9A, 0xEF, 0xB0, 0x5F,
-    0xA6, 0x7B, 0xCD, 0xF0, 0xE0, 0x1E, 0x3C, 0x0C, 0xE3, 0x52, 0x2E, 0xE4, 0x7B, 0x8B, 0x21, 0x9D,
-    0xBF, 0x8B, 0xB7, 0xE9, 0xD2, 0x7B, 0xAA, 0x99, 0xE9, 0x22, 0x6B, 0x5F, 0xBD, 0x25, 0xD4, 0x3B,
-    0xA6, 0xE1, 0xAC, 0x0E, 0x29, 0x06, 0xB9, 0x9E, 0x36, 0x84, 0xFC, 0x46, 0xEF, 0xE1, 0x5A, 0x13,
-    0xAB, 0x17, 0xBB, 0x27, 0xD7, 0xD5, 0x79, 0xE1, 0xF3, 0x94, 0x53, 0xA7, 0xD1, 0xC2, 0x3D, 0xAB,
-    0xD0, 0x78, 0xF6, 0xCB, 0xC1, 0x75, 0x75, 0x81, 0x5A, 0x3F, 0x0D, 0x4C, 0x36, 0x0D, 0xA4, 0xB8,
-    0x5B, 0x62, 0x17, 0x6B, 0xB1, 0xC1, 0xAF, 0x3A, 0x95, 0xF2, 0x12, 0xDB, 0x20, 0xC2, 0x0B, 0x9B,
-    0xD8, 0x01, 0xF7, 0xCA, 0x55, 0xB4, 0xFB, 0xE5, 0x74, 0xD5, 0x69, 0x56, 0x2A, 0x38, 0xA9, 0x69,
-    0x0D, 0xDC, 0x24, 0xCC, 0x56, 0xD2, 0x21, 0xCF, 0x30, 0xF2, 0x21, 0xBB, 0xD3, 0x15, 0x2A, 0xDE,
-    0xBE, 0xD6, 0x50, 0x0D, 0xE4, 0x1E, 0x91, 0x9F, 0xFF, 0x91, 0x6F, 0x74, 0x9B, 0xA3, 0x67, 0x3A,
-    0x5C, 0x57, 0xE7, 0x01, 0xD5, 0xFC, 0x90, 0x61, 0xF7, 0x07, 0x7A, 0x2F, 0x7D, 0x34, 0x41, 0xFA,
-    0x95, 0x88, 0x2E, 0x99, 0x73, 0xA5, 0x3B, 0xFC, 0xC1, 0x47, 0x73, 0x2A, 0xB1, 0x8F, 0xEC, 0x8A,
-    0x50, 0x74, 0x3F, 0xDD, 0x2E, 0xE8, 0x0D, 0x98, 0x39, 0xD2, 0x1B, 0xB2, 0x2C, 0x46, 0x8D, 0xE9,
-    0x27, 0x53, 0x6A, 0xA5, 0x3E, 0x9D, 0x98, 0x3D, 0x41, 0x34, 0x96, 0xF1, 0xE4, 0x2E, 0xBC, 0xD3,
-    0x61, 0x44, 0x75, 0x87, 0xC4, 0x8C, 0xEC, 0xD5, 0xC0, 0x05, 0x29, 0x29, 0x96, 0x6B, 0xCC, 0xCE,
-    0x3D, 0xF3, 0x38, 0x68, 0x63, 0xA4, 0x9C, 0x6D, 0x78, 0x07, 0x59, 0xA6, 0x4A, 0xE8, 0xC9, 0x7A,
-    0x9D, 0x35, 0x8F, 0x85, 0xA2, 0x53, 0xCB, 0x6C, 0xAD, 0x43, 0xB2, 0x0C, 0x49, 0x41, 0x82, 0x4C,
-    0x86, 0x0C, 0xA9, 0xC1, 0xA5, 0xE1, 0x7D, 0x2C, 0x4B, 0x0E, 0x98, 0x7E, 0xA1, 0x59, 0x8E, 0x9E,
-    0x20, 0xF6, 0x22, 0x7D, 0x01, 0x4B, 0x06, 0xFD, 0xB0, 0x62, 0x1C, 0xED, 0x3C, 0xC7, 0xD9, 0xD3,
-    0xC1, 0x4A, 0x81, 0x22, 0x2D, 0x7C, 0x16, 0xBE, 0x10, 0x31, 0xA5, 0x46, 0xFC, 0x3C, 0xE2, 0xE7,
-    0x91, 0x68, 0x30, 0x61, 0x09, 0x0E, 0x58, 0xFD, 0xC4, 0x4F, 0x7D, 0xAB, 0xFD, 0xF4, 0x8B, 0xD9,
-    0x20, 0x25, 0x9E, 0xAC, 0xB7, 0x83, 0xE4, 0x84, 0xBE, 0x41, 0x85, 0x48, 0xF1, 0x64, 0x42, 0xD9,
-    0xC7, 0x12, 0xB3, 0x1B, 0x29, 0x9E, 0x5C, 0x7D, 0x6A, 0x1F, 0x7E, 0xBF, 0x94, 0x75, 0x1A, 0x99,
-    0xF1, 0x51, 0xB9, 0x4F, 0xE9, 0x73, 0x94, 0x86, 0xCB, 0x86, 0xD5, 0xB8, 0xEB, 0xD4, 0x62, 0xB6,
-    0x2E, 0x20, 0x2B, 0xD1, 0x89, 0xEA, 0x83, 0x2D, 0xE3, 0x58, 0x1B, 0x38, 0xA6, 0x19, 0x99, 0xF5,
-    0x5A, 0x93, 0x88, 0x6E, 0xB6, 0xCC, 0xAE, 0x19, 0x18, 0xEC, 0x87, 0x60, 0xE0, 0xEE, 0x0E, 0x1B,
-    0x9C, 0x6D, 0x64, 0x00, 0x10, 0xC6, 0x6C, 0x29, 0xD4, 0xE0, 0x12, 0x1E, 0x2C, 0xF5, 0xB3, 0x58,
-    0x72, 0x80, 0x71, 0xA1, 0xF5, 0xF5, 0xF2, 0xB4, 0x9F, 0x29, 0x2B, 0x16, 0xC5, 0xC2, 0xAD, 0x9E,
-    0xF5, 0x57, 0xEC, 0xC3, 0x43, 0xE0, 0xF7, 0xDF, 0xF0, 0x0E, 0xE9, 0x09, 0x33, 0xE0, 0x81, 0x56,
-    0x5E, 0x48, 0xA9, 0xE3, 0x1C, 0x0C, 0x61, 0x1B, 0x71, 0xA3, 0x8A, 0xE8, 0x9B, 0x84, 0x78, 0x60,
-    0xFD, 0x18, 0x8C, 0x11, 0x17, 0x37, 0xE2, 0xBA, 0x46, 0xBB, 0x6A, 0x34, 0xEE, 0x34, 0x1F, 0x33,
-    0x5E, 0xE9, 0xBD, 0x11, 0x23, 0x3E, 0x92, 0x7D, 0x59, 0x7E, 0x16, 0x70, 0x07, 0xF6, 0x28, 0xCA,
-    0xA1, 0xDF, 0x42, 0x0C, 0xD8, 0xE6, 0x33, 0xED, 0x7B, 0x5A, 0x1A, 0xFD, 0x2C, 0x53, 0x62, 0xE6,
-    0xA8, 0x09, 0x16, 0xC3, 0x3A, 0x81, 0x1B, 0x24, 0x75, 0xDC, 0x30, 0x65, 0x47, 0x88, 0xCD, 0x47,
-    0xF5, 0x2A, 0xD2, 0xC7, 0x67, 0xF5, 0x2A, 0xB6, 0x97, 0x4F, 0xEA, 0x55, 0xCC, 0xE6, 0xA3, 0x3A,
-    0x0A, 0xC5, 0x7D, 0xBF, 0x8E, 0x80, 0xC7, 0xDF, 0xAA, 0x23, 0x6C, 0x61, 0x4E, 0x8D, 0x62, 0x27,
-    0x04, 0x77, 0xAA, 0x88, 0xBC, 0x9E, 0x3A, 0x04, 0xEF, 0x3B, 0xE0, 0xD2, 0xB6, 0xE4, 0xF3, 0x86,
-    0x7C, 0x56, 0x93, 0x27, 0x25, 0x79, 0x98, 0x91, 0xFB, 0xD8, 0x17, 0xA1, 0xAD, 0x53, 0x61, 0x0A,
-    0x60, 0x15, 0x19, 0x10, 0x62, 0x15, 0x75, 0x60, 0xAB, 0x73, 0xB2, 0x84, 0x2C, 0xC8, 0xC0, 0xB0,
-    0x7D, 0x42, 0x3E, 0xD0, 0x6F, 0x64, 0x75, 0x60, 0xD2, 0x93, 0x25, 0x64, 0xE1, 0x2B, 0x60, 0xFE,
-    0xFB, 0x60, 0xEE, 0x67, 0x60, 0xF6, 0x23, 0x86, 0xAD, 0x21, 0x9B, 0x91, 0x85, 0x64, 0x9A, 0x63,
-    0x74, 0x4F, 0x68, 0x75, 0xDF, 0x49, 0xE1, 0xAA, 0xEB, 0x15, 0x96, 0xDE, 0x6D, 0x60, 0x18, 0xAB,
-    0x63, 0x32, 0xE9, 0xB9, 0xB5, 0x6F, 0x24, 0x0A, 0xE5, 0x69, 0xA2, 0xE3, 0x98, 0xBE, 0x65, 0xBF,
-    0x4D, 0x42, 0x85, 0x9C, 0xDF, 0xF6, 0x90, 0xE2, 0xC0, 0xF5, 0x31, 0x10, 0x91, 0x05, 0x8B, 0x2A,
-    0x46, 0xD4, 0x39, 0x1A, 0xF9, 0xD6, 0x10, 0x99, 0xAF, 0x15, 0x25, 0xAD, 0x19, 0xE9, 0x5E, 0x6F,
-    0x1F, 0x21, 0xFE, 0xF6, 0xAA, 0x18, 0xC0, 0x8E, 0x55, 0x56, 0x82, 0x90, 0x39, 0x5D, 0x04, 0xFF,
-    0xFF, 0xD4, 0xF8, 0x9E, 0x16, 0x4A, 0x0B, 0xCD, 0xBA, 0x9A, 0x70, 0x99, 0x28, 0x5C, 0x24, 0xF5,
-    0xDB, 0xCF, 0x52, 0xAD, 0xA6, 0x17, 0x0F, 0xC9, 0xA9, 0x45, 0xBF, 0x56, 0x83, 0x21, 0xD2, 0x6A,
-    0x26, 0x4C, 0x23, 0x8D, 0x5A, 0x77, 0xFC, 0x4E, 0x7A, 0x8D, 0x20, 0xEE, 0x6D, 0xC5, 0x82, 0xA9,
-    0xA3, 0x0C, 0xAA, 0x6B, 0x59, 0xB2, 0x84, 0x79, 0xCB, 0x44, 0x97, 0x0E, 0xD0, 0xC2, 0x65, 0xEC,
-    0x14, 0x04, 0xD5, 0x66, 0x44, 0xB7, 0x0A, 0x2B, 0xEB, 0x43, 0xF2, 0xAA, 0x77, 0x65, 0x7D, 0xC4,
-    0xC3, 0x03, 0x9C, 0xC4, 0xB3, 0x21, 0x4D, 0xAE, 0xDD, 0x9F, 0xB0, 0x40, 0xF9, 0x36, 0x68, 0x4A,
-    0x40, 0xB8, 0xF1, 0xAD, 0x30, 0x7A, 0x28, 0x60, 0x9D, 0x10, 0x0A, 0x20, 0x01, 0xF8, 0x7B, 0x80,
-    0x20, 0xD8, 0xAB, 0xD5, 0xC8, 0x99, 0xC2, 0x12, 0x02, 0x15, 0xB7, 0xCA, 0xB9, 0x1F, 0xC5, 0xFC,
-    0x22, 0x21, 0x58, 0x0D, 0x58, 0x93, 0x02, 0x94, 0xC6, 0x44, 0xA7, 0x53, 0x82, 0x87, 0x9E, 0xFA,
-    0x77, 0x4C, 0xC5, 0x40, 0x64, 0x2D, 0x13, 0x4F, 0xC7, 0xD9, 0xE6, 0x44, 0x06, 0x11, 0xE1, 0x6B,
-    0x42, 0x83, 0x87, 0x34, 0xBD, 0xBF, 0x49, 0xC6, 0x55, 0x77, 0x15, 0x50, 0xD0, 0xD0, 0x04, 0x36,
-    0x53, 0xC5, 0xB5, 0xDD, 0x06, 0x71, 0x86, 0x45, 0x3C, 0xBA, 0x40, 0x73, 0xC2, 0x8A, 0x5B, 0xD1,
-    0xEC, 0xC7, 0x43, 0x91, 0xF5, 0x21, 0xEA, 0x2C, 0xD4, 0x68, 0xBF, 0x47, 0x99, 0x86, 0x52, 0xF7,
-    0x0A, 0x30, 0x8D, 0x5B, 0x06, 0x0E, 0x9A, 0x9C, 0x2A, 0x64, 0xA5, 0x8D, 0xCA, 0xCD, 0x56, 0x00,
-    0x1E, 0xB1, 0x36, 0x23, 0x3E, 0x25, 0x78, 0x68, 0x51, 0xDB, 0xB2, 0x18, 0x6C, 0x65, 0x0A, 0x55,
-    0xE6, 0x8D, 0x20, 0xD4, 0x65, 0xB3, 0x91, 0xB8, 0x65, 0xDE, 0x21, 0x9C, 0x63, 0xD5, 0xEA, 0x37,
-    0x5A, 0xB9, 0xD0, 0xD5, 0xE0, 0xD0, 0x28, 0x78, 0x62, 0xE2, 0x7E, 0x6C, 0x4C, 0x31, 0xB7, 0xA8,
-    0x1E, 0x6E, 0x63, 0x71, 0xB7, 0xA1, 0xA5, 0x7B, 0x2A, 0xB6, 0xA1, 0x3A, 0xD1, 0x45, 0xFC, 0x5E,
-    0xBD, 0x93, 0xEA, 0xB4, 0xCB, 0x9F, 0xC1, 0xE6, 0xD2, 0xD9, 0xD5, 0xCF, 0x5B, 0xAC, 0x92, 0x53,
-    0x43, 0x51, 0x7C, 0xD9, 0x31, 0x95, 0xCF, 0x99, 0x71, 0x13, 0xD6, 0x6D, 0x41, 0x46, 0x86, 0x34,
-    0xAB, 0xD5, 0x39, 0x5A, 0xB0, 0x60, 0x80, 0x8A, 0xA5, 0x96, 0xAD, 0x18, 0xCD, 0x6E, 0x38, 0x5A,
-    0xC7, 0x65, 0xCC, 0xB5, 0x0C, 0x60, 0x0D, 0x10, 0x70, 0x0C, 0xBF, 0x5D, 0xC2, 0x10, 0x4E, 0xEA,
-    0x14, 0x8C, 0x7B, 0x24, 0xFC, 0xB1, 0x1D, 0x4A, 0x10, 0xD6, 0x74, 0x0C, 0x5D, 0x7A, 0xFC, 0x7C,
-    0x40, 0x79, 0xCE, 0xD8, 0xEC, 0x9F, 0xDC, 0x3C, 0xD6, 0x93, 0x1D, 0xA9, 0xE8, 0x8A, 0x7E, 0xBE,
-    0x96, 0xCB, 0xE9, 0xFE, 0xE6, 0x57, 0x8B, 0xFE, 0xCD, 0x3B, 0x53, 0x0D, 0x2F, 0x5D, 0x5F, 0x56,
-    0xBA, 0xD0, 0x4F, 0x4B, 0x41, 0x75, 0x84, 0x56, 0x47, 0x1C, 0x7A, 0x24, 0x43, 0x8F, 0x4C, 0x7B,
-    0x54, 0x07, 0x3D, 0x92, 0x7E, 0xB6, 0x7F, 0x7E, 0x43, 0x4E, 0xF9, 0x77, 0x7E, 0x3E, 0xDB, 0xBF,
-    0x74, 0x67, 0x28, 0x11, 0x33, 0xB5, 0xB4, 0xFC, 0x06, 0x6B, 0xD1, 0xC2, 0x55, 0x9B, 0x1D, 0xB1,
-    0xAB, 0x55, 0xE1, 0xC1, 0x91, 0x87, 0x3A, 0xD2, 0x07, 0x66, 0x58, 0xD1, 0x73, 0x32, 0xBB, 0xDE,
-    0x19, 0xE1, 0x39, 0x2B, 0x83, 0x64, 0xAC, 0x0C, 0xAE, 0xC2, 0x48, 0x61, 0x0A, 0xCB, 0xD4, 0x08,
-    0x8D, 0xBB, 0x7B, 0xC8, 0x04, 0x48, 0x1B, 0x5B, 0xB3, 0x74, 0xC0, 0x30, 0x63, 0x59, 0x6E, 0x5D,
-    0x2B, 0x6D, 0xA6, 0x92, 0xC7, 0xD7, 0x4A, 0x56, 0x4C, 0xB9, 0x92, 0x0F, 0x0A, 0xCA, 0x4D, 0xA4,
-    0x8D, 0xC4, 0x3C, 0x2A, 0x3D, 0xF3, 0x56, 0xB9, 0x3C, 0x44, 0xCA, 0x9F, 0x46, 0xE1, 0x9E, 0xE4,
-    0x48, 0x25, 0xC5, 0x1E, 0x52, 0x0A, 0x16, 0x7F, 0x17, 0x46, 0x98, 0x1F, 0x56, 0x5E, 0xED, 0x21,
-    0xD9, 0x68, 0x77, 0x9A, 0x02, 0xFE, 0x59, 0x94, 0x41, 0xF9, 0x67, 0x24, 0xD1, 0x7B, 0xB3, 0x7E,
-    0xA8, 0xE0, 0xC2, 0xC7, 0x04, 0xE0, 0xE2, 0x3D, 0xFC, 0xD5, 0x81, 0xA1, 0xE3, 0xB1, 0x88, 0x3C,
-    0x4A, 0xF1, 0x88, 0xBD, 0x08, 0xC2, 0xFC, 0xEA, 0x2C, 0xAB, 0x49, 0x59, 0x56, 0xAD, 0xE3, 0xD5,
-    0x1E, 0x4B, 0xEB, 0x55, 0xEB, 0x98, 0xBE, 0xF5, 0xF7, 0xD6, 0xDB, 0x20, 0x43, 0x7A, 0x16, 0x1B,
-    0x91, 0x6B, 0x69, 0x45, 0x79, 0x94, 0x18, 0x82, 0x09, 0xDA, 0x11, 0xC7, 0xAD, 0x5F, 0xF9, 0x2D,
-    0x2A, 0xCA, 0xD6, 0x32, 0xED, 0x3D, 0x3D, 0x13, 0x5A, 0xDF, 0x23, 0x32, 0x14, 0x6F, 0x6F, 0x3D,
-    0x0B, 0xB0, 0xB6, 0x89, 0x9E, 0xBE, 0xA0, 0xAA, 0x9E, 0xBC, 0xAE, 0x55, 0xDA, 0x0C, 0xEB, 0xBE,
-    0xB1, 0xC4, 0xB2, 0xCB, 0x39, 0xD6, 0x56, 0x86, 0x3C, 0xC5, 0x1D, 0x23, 0xD3, 0x39, 0x82, 0xC2,
-    0x5E, 0x4C, 0x6F, 0x75, 0x7A, 0xD8, 0xA3, 0xB7, 0xF7, 0xF9, 0x56, 0x61, 0xEA, 0xEF, 0x3F, 0x4C,
-    0x9D, 0x65, 0xCB, 0xC9, 0x37, 0x94, 0xB9, 0xA1, 0xCA, 0xDC, 0x3F, 0xA5, 0x32, 0x29, 0x95, 0xF1,
-    0x96, 0xCA, 0xB4, 0x50, 0x66, 0x5C, 0x18, 0x4B, 0xCF, 0x47, 0xBE, 0xB3, 0x16, 0x54, 0x3C, 0xA6,
-    0x38, 0xAB, 0x1B, 0xDA, 0x09, 0x86, 0xBE, 0xD0, 0xD1, 0xD0, 0x69, 0x71, 0x1F, 0x86, 0x4E, 0xD5,
-    0xD0, 0x35, 0x0C, 0x5A, 0xE7, 0xA7, 0xA4, 0x73, 0x79, 0x8E, 0x9A, 0xF8, 0x8D, 0xFC, 0xC9, 0x0B,
-    0xBB, 0x0F, 0xC3, 0x4D, 0xAB, 0x65, 0x79, 0xE3, 0x74, 0xC1, 0x69, 0x75, 0x45, 0xC3, 0x12, 0xF7,
-    0x84, 0xB9, 0x02, 0x76, 0xE6, 0x9A, 0xB5, 0x7A, 0xC9, 0xB1, 0x66, 0x4C, 0x6D, 0x39, 0xAC, 0x92,
-    0xC3, 0xDF, 0x76, 0x41, 0xD8, 0x46, 0xA5, 0x80, 0x85, 0xB4, 0x9D, 0xEF, 0x2D, 0x9E, 0x2A, 0xCE,
-    0x65, 0xF8, 0x86, 0x8D, 0xC7, 0x5E, 0x37, 0xC2, 0x3D, 0x20, 0x8A, 0xDC, 0x2C, 0x02, 0x53, 0x17,
-    0xF7, 0x67, 0xF3, 0xD7, 0xDB, 0x82, 0xD9, 0xB8, 0xDB, 0x65, 0xD2, 0xE9, 0xE7, 0x8C, 0xAA, 0x3C,
-    0xFF, 0x06, 0xFC, 0x46, 0x30, 0x2E, 0xF1, 0x61, 0x2C, 0x7D, 0xAD, 0x25, 0x96, 0xB0, 0x65, 0x1C,
-    0xA5, 0xDE, 0xC3, 0xF5, 0x0A, 0xA8, 0xB0, 0x49, 0x74, 0x87, 0x92, 0x1E, 0xEE, 0x90, 0x1F, 0x25,
-    0xB6, 0x61, 0x35, 0xBA, 0x20, 0x65, 0x79, 0xE2, 0xD5, 0xF0, 0xD1, 0x6C, 0x19, 0x47, 0x37, 0x82,
-    0xA7, 0xC6, 0x73, 0x7B, 0x52, 0x3C, 0xEF, 0x62, 0xDC, 0x1C, 0xF1, 0x9C, 0x43, 0xC6, 0xD3, 0xCC,
-    0x72, 0xE0, 0xBA, 0x7B, 0x5F, 0xC7, 0x75, 0xFD, 0x63, 0x5C, 0xF7, 0xAB, 0x74, 0xE3, 0x42, 0xB5,
-    0x53, 0x54, 0xBB, 0x8F, 0xD3, 0x02, 0xAA, 0xE8, 0x86, 0x90, 0x9F, 0x78, 0xDB, 0xE6, 0x56, 0x60,
-    0xFA, 0xE4, 0x65, 0x6E, 0xB8, 0x53, 0x16, 0x0F, 0xC0, 0xF7, 0xE2, 0xA1, 0xF2, 0x2B, 0x1A, 0xDD,
-    0xF1, 0xE7, 0x9A, 0x6E, 0xE2, 0x1B, 0x32, 0x9F, 0x99, 0x2E, 0x44, 0x0C, 0xAF, 0x29, 0x00, 0x23,
-    0x0A, 0xE7, 0x1D, 0x7C, 0x8A, 0xA8, 0x6D, 0x2E, 0xDC, 0x5F, 0x43, 0xBA, 0x7F, 0xDA, 0xCD, 0x9E,
-    0x3C, 0x81, 0x69, 0x28, 0xD3, 0x82, 0x77, 0xDB, 0x5B, 0xF9, 0xA9, 0xAD, 0xE9, 0xC2, 0xF2, 0x7E,
-    0x9D, 0xA4, 0x49, 0x1D, 0x9A, 0x2F, 0x6A, 0xD7, 0xFC, 0xBD, 0x26, 0x50, 0xBB, 0x23, 0x72, 0x3B,
-    0x1F, 0x70, 0x07, 0x41, 0x47, 0xCD, 0xC3, 0x48, 0x14, 0x19, 0x04, 0x19, 0x40, 0x1C, 0x87, 0x27,
-    0xC2, 0x02, 0xFB, 0x48, 0x87, 0x80, 0xDE, 0x20, 0x66, 0x20, 0x60, 0xE0, 0x1E, 0x5A, 0x62, 0x0E,
-    0xCF, 0x65, 0x72, 0x7B, 0x03, 0x8F, 0x94, 0x11, 0xD6, 0x94, 0x12, 0x37, 0x3C, 0x8B, 0x5B, 0x45,
-    0xED, 0x10, 0xA4, 0x79, 0x4B, 0x79, 0x5D, 0x4E, 0xD8, 0xD2, 0x4C, 0xFD, 0xCC, 0x7D, 0xAF, 0x89,
-    0x50, 0x87, 0x7C, 0x54, 0xAF, 0x04, 0xE2, 0x7C, 0x52, 0x05, 0x80, 0x2C, 0x8F, 0x4A, 0x1F, 0x36,
-    0xFB, 0x22, 0xF3, 0x73, 0x9E, 0xFA, 0x7B, 0x58, 0x2A, 0xA3, 0xE8, 0x68, 0x97, 0xA0, 0xE2, 0x92,
-    0x58, 0xB7, 0x80, 0x6E, 0x1A, 0x7E, 0xCF, 0x93, 0x3D, 0xAB, 0x8B, 0x87, 0xA8, 0x4B, 0xDA, 0x01,
-    0x1C, 0x93, 0xF8, 0x8C, 0x36, 0xBE, 0x63, 0x1F, 0xF6, 0xE5, 0x37, 0x90, 0xDA, 0x1D, 0xD5, 0x2F,
-    0xD4, 0xFF, 0x93, 0x50, 0x1C, 0x45, 0xFD, 0x00, 0x9D, 0x02, 0xD5, 0x9A, 0xA7, 0xDD, 0xD2, 0xC1,
-    0x66, 0x39, 0xAB, 0xC2, 0x76, 0x38, 0x36, 0x23, 0xF2, 0xF5, 0xC7, 0x63, 0x3C, 0x9E, 0x15, 0x8D,
-    0x87, 0xA0, 0x3C, 0x0C, 0xC2, 0xE2, 0x0B, 0x4F, 0x57, 0x2F, 0x6D, 0xDF, 0x99, 0x99, 0xFD, 0xF3,
-    0x13, 0x8E, 0xAC, 0x89, 0xB7, 0x24, 0xBE, 0x61, 0x2C, 0xF0, 0x08, 0x08, 0xD1, 0x83, 0x6F, 0x43,
-    0xDD, 0x68, 0x8C, 0x59, 0xF0, 0x24, 0xC8, 0x7A, 0x87, 0x90, 0x2B, 0xD9, 0x62, 0xD3, 0x57, 0x1D,
-    0xA8, 0x23, 0xA2, 0x01, 0xE8, 0x47, 0x61, 0xC6, 0x23, 0xEC, 0xFE, 0xB8, 0x3E, 0x1B, 0x8A, 0xDB,
-    0x08, 0xD8, 0x7E, 0x21, 0xAB, 0x27, 0x5D, 0xF2, 0x53, 0xA1, 0xA0, 0x0B, 0x7A, 0x24, 0x75, 0xCC,
-    0x9D, 0x2B, 0xBE, 0xF7, 0x5A, 0x9E, 0x21, 0x6E, 0x8E, 0xC3, 0x7F, 0xE9, 0x86, 0x0E, 0x58, 0x08,
-    0xA0, 0x86, 0x8B, 0xE3, 0xFF, 0x7D, 0xEC, 0xCB, 0x0F, 0x67, 0xE6, 0xDF, 0xCD, 0x3B, 0x1E, 0x0F,
-    0xC8, 0xDE, 0x4C, 0xFF, 0x07, 0xC5, 0x59, 0x31, 0x70, 0xDC, 0xC6, 0x15, 0xFD, 0x00, 0x44, 0xC2,
-    0x19, 0x4C, 0xB4, 0x2C, 0xA8, 0x89, 0x12, 0xC5, 0x42, 0x0A, 0x15, 0x9E, 0x8C, 0x4C, 0x34, 0x29,
-    0x54, 0xDC, 0x1D, 0x60, 0xBB, 0x48, 0x91, 0xC2, 0x2C, 0xC4, 0x64, 0x26, 0x2E, 0xE4, 0xC2, 0x85,
-    0xC7, 0x9E, 0x84, 0x29, 0x54, 0xA8, 0xB8, 0xE3, 0xC1, 0x93, 0x32, 0x45, 0xD8, 0xB8, 0x4D, 0x94,
-    0x19, 0x17, 0x89, 0x5C, 0xD0, 0x85, 0x0A, 0x26, 0x01, 0x89, 0x9D, 0xA4, 0x70, 0x19, 0x38, 0x33,
-    0xEA, 0x91, 0x84, 0x9E, 0xCC, 0xA8, 0x88, 0x91, 0xC9, 0x69, 0x0C, 0xCA, 0xC7, 0xDB, 0xBC, 0xB7,
-    0xC0, 0xDD, 0x51, 0x14, 0x6D, 0xCB, 0xC9, 0x89, 0xC2, 0x61, 0x3F, 0x48, 0x60, 0xF1, 0xFF, 0xDF,
-    0xBF, 0xFF, 0xBF, 0xFF, 0x77, 0xD1, 0x9F, 0x4C, 0x06, 0x22, 0x57, 0x3A, 0x3C, 0xFA, 0x3C, 0xF6,
-    0x70, 0xAC, 0x0A, 0x8F, 0x20, 0x69, 0x5A, 0x78, 0x20, 0xAE, 0x31, 0x12, 0x1C, 0xFE, 0x54, 0x42,
-    0x2D, 0x12, 0xE3, 0x51, 0x0F, 0xAD, 0x8B, 0x36, 0x38, 0xD6, 0xBA, 0xED, 0xFD, 0x08, 0x4D, 0x15,
-    0x8E, 0xF8, 0x78, 0xC7, 0x31, 0x13, 0xFC, 0xB3, 0x3D, 0xE7, 0xE5, 0x48, 0x73, 0xF8, 0xA6, 0x90,
-    0xC8, 0xD4, 0xB2, 0x25, 0x77, 0x65, 0x8C, 0xFF, 0x6B, 0xB4, 0xD1, 0xA3, 0xED, 0xC2, 0xE1, 0x86,
-    0xC4, 0xC6, 0x24, 0xDF, 0x9D, 0xDC, 0x79, 0xEC, 0x99, 0x53, 0x89, 0x78, 0x25, 0x54, 0xBB, 0xB7,
-    0x71, 0x1D, 0x7D, 0x26, 0x6C, 0x17, 0x45, 0xD2, 0xDE, 0xE6, 0x3F, 0xCA, 0xD0, 0x18, 0x1D, 0x14,
-    0x91, 0xA8, 0x24, 0x48, 0x95, 0x78, 0xFA, 0x72, 0xDB, 0x94, 0xF8, 0x3A, 0xD0, 0x2A, 0x51, 0x0F,
-    0xF3, 0x34, 0xCE, 0x3F, 0x2B, 0xAE, 0x2E, 0xBD, 0x54, 0x48, 0xA3, 0x7B, 0xC4, 0x41, 0xF5, 0x24,
-    0x4C, 0x24, 0x13, 0xA5, 0x21, 0xC0, 0x2F, 0xDC, 0x4A, 0xBC, 0xCA, 0x43, 0x87, 0x51, 0x80, 0x31,
-    0x67, 0x0A, 0xBA, 0x77, 0x39, 0xB2, 0xA8, 0xCF, 0xE1, 0xD5, 0x1C, 0x81, 0xA9, 0x1A, 0x62, 0x35,
-    0xB1, 0xC4, 0x7D, 0xFF, 0xE1, 0xED, 0x93, 0xF7, 0x8E, 0x91, 0xCE, 0xFC, 0x68, 0xCD, 0xF0, 0xC8,
-    0x9D, 0x25, 0x32, 0x3D, 0x92, 0xF0, 0xFE, 0x11, 0xD4, 0x39, 0x67, 0xED, 0x49, 0x5B, 0x87, 0x25,
-    0xEF, 0x27, 0x12, 0x80, 0x6D, 0xE4, 0x8E, 0x71, 0x3F, 0x96, 0x8E, 0x84, 0xD0, 0x57, 0x49, 0x94,
-    0x46, 0x98, 0x97, 0x4C, 0x24, 0x87, 0x51, 0x02, 0x1A, 0x72, 0xAB, 0x9D, 0x81, 0x48, 0xDE, 0xC0,
-    0xDF, 0x43, 0x33, 0x86, 0x99, 0xED, 0x30, 0x65, 0xC5, 0x0E, 0x03, 0xE7, 0x95, 0xE5, 0x56, 0x3A,
-    0xA6, 0x95, 0x76, 0x8F, 0x3E, 0xDE, 0x49, 0x39, 0x03, 0xEE, 0x48, 0x38, 0xE0, 0x2E, 0xF9, 0x1E,
-    0x28, 0x79, 0xDE, 0x31, 0x63, 0x3F, 0xED, 0x78, 0xE5, 0xAA, 0xAB, 0xAF, 0xC1, 0x08, 0x4E, 0x71,
-    0x93, 0x56, 0x28, 0x3F, 0x50, 0x78, 0xA7, 0x3A, 0x4E, 0x9B, 0xFB, 0xD7, 0x82, 0x14, 0x7D, 0x3A,
-    0x7E, 0x21, 0xAE, 0x7E, 0xD1, 0x35, 0x63, 0x5A, 0x7C, 0x38, 0xA2, 0xD5, 0xC9, 0xD3, 0x19, 0x89,
-    0x03, 0x61, 0xF1, 0xBB, 0x9B, 0x10, 0xB1, 0x8C, 0x61, 0x8A, 0x1D, 0xB0, 0xF5, 0xB3, 0x89, 0x9C,
-    0xFF, 0x75, 0x8A, 0x19, 0xC2, 0x19, 0x18, 0xBD, 0xF6, 0x8A, 0xEE, 0x78, 0xBA, 0xE3, 0xEB, 0x28,
-    0xD7, 0xC1, 0xDF, 0x52, 0x59, 0x41, 0xB7, 0x5A, 0x25, 0x5E, 0xD5, 0x93, 0x40, 0x8F, 0x25, 0x7C,
-    0xB9, 0x92, 0x41, 0x50, 0x60, 0x2C, 0x5A, 0x62, 0x98, 0x55, 0xBD, 0xC3, 0xE9, 0xDA, 0x83, 0x00,
-    0x0C, 0xFB, 0x2E, 0x35, 0x81, 0xEB, 0x6C, 0x6C, 0xAC, 0xE7, 0x98, 0x86, 0xA1, 0x9D, 0x0A, 0x39,
-    0xAD, 0xAD, 0x98, 0xB1, 0x19, 0x6F, 0x5C, 0xFF, 0x12, 0x43, 0xB8, 0x66, 0x1B, 0x86, 0xF0, 0x4C,
-    0x4D, 0x43, 0x14, 0x19, 0x0C, 0xE1, 0x15, 0x5D, 0x18, 0x02, 0x14, 0x86, 0xF0, 0x8A, 0x3E, 0x4C,
-    0xE0, 0x99, 0x91, 0xA5, 0x05, 0x0C, 0xE1, 0x7D, 0x54, 0xC1, 0x10, 0x5E, 0x51, 0xC3, 0x10, 0x78,
-    0x0A, 0x43, 0x78, 0x45, 0x0F, 0x86, 0xF0, 0x0A, 0xF5, 0xEA, 0x97, 0x1B, 0x42, 0xA6, 0xAE, 0xCC,
-    0x00, 0x99, 0x48, 0xB8, 0xA3, 0x3B, 0x6E, 0x79, 0x4B, 0x2A, 0x7B, 0x96, 0x5D, 0x30, 0x31, 0xA9,
-    0x7B, 0xD8, 0x74, 0x9F, 0x06, 0xD4, 0xB1, 0x76, 0xE1, 0xC6, 0xBB, 0x76, 0xD4, 0x6F, 0xED, 0xDC,
-    0xBF, 0x7D, 0xDA, 0x73, 0x69, 0xE7, 0x9D, 0x7D, 0xD8, 0x96, 0x6B, 0x08, 0x4C, 0x5E, 0x08, 0x74,
-    0x63, 0x7A, 0x76, 0x09, 0x45, 0xFA, 0x0C, 0x2E, 0xA8, 0x8A, 0x3F, 0x87, 0x46, 0xE3, 0x0C, 0x0E,
-    0xD9, 0xED, 0x8A, 0x6F, 0xFB, 0xF8, 0xDA, 0xD9, 0x94, 0x00, 0x4A, 0x03, 0x09, 0x60, 0x23, 0x9E,
-    0x7A, 0x7F, 0x27, 0x8D, 0xEC, 0x30, 0x9C, 0xF5, 0xA0, 0x54, 0x69, 0x0C, 0x16, 0xEB, 0xF2, 0xA6,
-    0xB8, 0xDB, 0x19, 0xDC, 0xFE, 0xC9, 0x9A, 0x5F, 0xEE, 0x89, 0x2A, 0xF3, 0x24, 0x2A, 0x73, 0xF3,
-    0xB0, 0xDC, 0x33, 0x1F, 0x95, 0xD9, 0x39, 0xB8, 0xAB, 0x9C, 0xDE, 0xAC, 0x2C, 0x63, 0xC6, 0x81,
-    0x39, 0xEC, 0x87, 0x66, 0x74, 0x35, 0x6E, 0xDB, 0xF0, 0x44, 0x9B, 0xDE, 0x8F, 0xD0, 0x14, 0x9A,
-    0x8B, 0x26, 0xE7, 0x6E, 0x5E, 0x15, 0x79, 0xD2, 0xF6, 0x9D, 0x8B, 0xAB, 0xFB, 0x93, 0xBD, 0xD5,
-    0x00, 0x21, 0x11, 0x94, 0xF0, 0x9B, 0xEA, 0xED, 0x2A, 0x4F, 0x9D, 0xDB, 0x41, 0xD5, 0xAB, 0xEE,
-    0x56, 0xF2, 0xF8, 0x0F, 0x9E, 0x34, 0x11, 0xF5, 0xBE, 0x7E, 0xD1, 0x29, 0x3B, 0x52, 0xCD, 0xCE,
-    0x35, 0xB7, 0x54, 0x9F, 0x68, 0xE7, 0xF7, 0xB2, 0xE2, 0x32, 0x08, 0xD3, 0xB9, 0xE3, 0x96, 0x83,
-    0xC6, 0x71, 0xC7, 0x2A, 0xF5, 0xAA, 0x78, 0xE6, 0xE0, 0x3D, 0x44, 0xD1, 0xAD, 0x20, 0x69, 0x86,
-    0x8A, 0x21, 0xDF, 0x15, 0x6F, 0xCC, 0x79, 0x01, 0xFA, 0x60, 0x12, 0xAE, 0x76, 0x04, 0xB1, 0x66,
-    0x41, 0x80, 0xB4, 0x6B, 0xE9, 0x2D, 0x4B, 0xA9, 0x42, 0xC7, 0x2D, 0xBE, 0x09, 0xEA, 0x6B, 0xA0,
-    0x71, 0x47, 0x25, 0xF0, 0xA6, 0xCE, 0x9A, 0xFB, 0x2F, 0x91, 0x17, 0x3A, 0xFE, 0xAF, 0x84, 0x31,
-    0xB2, 0x46, 0x00, 0xBD, 0x0A, 0xEA, 0xE9, 0x5B, 0xA0, 0x41, 0xFA, 0x30, 0xDF, 0xC6, 0x08, 0x0D,
-    0x5C, 0xB8, 0x6B, 0xD1, 0x03, 0x18, 0xB7, 0x66, 0xC3, 0x64, 0x8D, 0x68, 0xEB, 0x16, 0xE2, 0xD7,
-    0x74, 0x89, 0x68, 0x17, 0xA0, 0x2A, 0xD7, 0x6E, 0xF1, 0xB6, 0xEC, 0x4A, 0xC7, 0xD2, 0xBB, 0xA4,
-    0xC4, 0x63, 0xD9, 0x85, 0x6A, 0xA0, 0xC1, 0x3B, 0xBF, 0x03, 0x55, 0x21, 0x20, 0x6B, 0xB7, 0xFB,
-    0x3C, 0x5E, 0xDB, 0xB5, 0x4A, 0xBF, 0x51, 0x91, 0xBA, 0xA5, 0x34, 0x8E, 0x04, 0xE0, 0x00, 0x2F,
-    0x88, 0xBB, 0x6C, 0x01, 0xBD, 0x63, 0x23, 0xCE, 0xF2, 0x07, 0xAF, 0xD8, 0x68, 0xFC, 0x0B, 0xDA,
-    0x18, 0xE0, 0xD2, 0x11, 0xBB, 0x0D, 0x77, 0x12, 0x74, 0x5B, 0xC1, 0xEB, 0x77, 0xA9, 0x39, 0x45,
-    0x06, 0x29, 0x38, 0x2D, 0xEF, 0xD3, 0x1A, 0x00, 0x11, 0x62, 0x51, 0xA0, 0x69, 0x0D, 0x4F, 0xF7,
-    0x97, 0x13, 0x70, 0xAC, 0x54, 0xBA, 0xEE, 0xFF, 0xA9, 0x8C, 0xD3, 0xDC, 0x7C, 0x5F, 0xFF, 0x31,
-    0xBD, 0x04, 0x18, 0xF9, 0x27, 0x0C, 0x77, 0xD9, 0xFB, 0x90, 0xE6, 0x0B, 0x7C, 0xD0, 0xDD, 0xCB,
-    0xA0, 0x4E, 0xD5, 0xDB, 0x39, 0x40, 0xFF, 0x18, 0x30, 0x40, 0x5E, 0x56, 0x3D, 0xDC, 0x7F, 0xD1,
-    0x52, 0xDA, 0x9A, 0x89, 0x8F, 0x0D, 0x73, 0x37, 0x3B, 0x96, 0x19, 0x56, 0xA9, 0x1D, 0x87, 0x9D,
-    0x09, 0x40, 0xAF, 0x8B, 0xC8, 0x0E, 0x98, 0x97, 0xD2, 0x79, 0x8E, 0xEC, 0xB7, 0xD7, 0x58, 0xBE,
-    0x26, 0xE1, 0x43, 0x03, 0x2C, 0xC7, 0x8C, 0xBC, 0x95, 0xB4, 0x51, 0xAF, 0x38, 0x46, 0x9F, 0xD9,
-    0xC1, 0x61, 0x6E, 0xB3, 0xBD, 0x01, 0xFE, 0xD3, 0x83, 0xB0, 0xE4, 0x10, 0xD7, 0x3D, 0x46, 0x98,
-    0xF7, 0x09, 0x87, 0xF8, 0x17, 0xBE, 0xF6, 0x4B, 0x2A, 0xC5, 0xD4, 0x14, 0x5B, 0xA8, 0xF2, 0x60,
-    0x8D, 0x8C, 0x26, 0xA9, 0xF1, 0x03, 0xA7, 0x8C, 0x29, 0xFB, 0x48, 0x3C, 0x82, 0x89, 0x7F, 0xFF,
-    0x4E, 0x4E, 0x39, 0x2A, 0x41, 0x82, 0x53, 0x1A, 0xF3, 0xEB, 0x17, 0x3D, 0xA6, 0x24, 0xC8, 0x72,
-    0xAB, 0x71, 0x23, 0xD9, 0x49, 0xA6, 0xCA, 0x44, 0x49, 0xAB, 0xB0, 0x4D, 0xB6, 0x92, 0x9C, 0xBD,
-    0x2E, 0xEB, 0x8C, 0xA3, 0xB1, 0xAD, 0x12, 0x98, 0xFF, 0x5E, 0x25, 0x6E, 0xC2, 0x71, 0x90, 0xC1,
-    0xD6, 0xCF, 0x5A, 0x97, 0x25, 0x41, 0x2D, 0x14, 0x97, 0xDF, 0x13, 0xF9, 0x03, 0x53, 0x49, 0x19,
-    0x81, 0x69, 0xE2, 0x9C, 0xB9, 0x49, 0xAC, 0x43, 0x44, 0x64, 0x15, 0x03, 0x19, 0xE4, 0x39, 0x67,
-    0x3E, 0x2B, 0x67, 0xA9, 0x86, 0xB3, 0xCB, 0x49, 0x21, 0x7B, 0xE5, 0x43, 0x83, 0xF3, 0x1E, 0x23,
-    0xE0, 0x07, 0x14, 0x39, 0x39, 0x2B, 0xDF, 0x40, 0x75, 0x45, 0x58, 0x50, 0xED, 0x65, 0xE7, 0xDE,
-    0x06, 0x74, 0x88, 0x9A, 0xB0, 0xEC, 0x36, 0x97, 0xAC, 0xB9, 0xD4, 0xF6, 0xE2, 0x56, 0xF6, 0xE2,
-    0x95, 0xF6, 0x82, 0xFA, 0x0F, 0x15, 0x25, 0xA2, 0xD8, 0x5E, 0x50, 0x23, 0xDE, 0xDB, 0xB0, 0x59,
-    0x97, 0xCF, 0x86, 0xCD, 0x65, 0x72, 0x87, 0x45, 0x00, 0x44, 0xF1, 0x05, 0xA8, 0xCB, 0x0B, 0x6C,
-    0xCE, 0x0B, 0x75, 0x83, 0x3C, 0x6A, 0x07, 0xE9, 0xB1, 0xD5, 0xA2, 0x85, 0xA8, 0x65, 0x73, 0x68,
-    0x19, 0x25, 0x8E, 0xD9, 0xDE, 0x14, 0x6F, 0x64, 0x6B, 0x60, 0x69, 0x80, 0xA0, 0x89, 0x28, 0x96,
-    0x72, 0x16, 0x13, 0x4E, 0x25, 0xF1, 0x8C, 0xD8, 0x37, 0x1A, 0x54, 0x68, 0xF2, 0x49, 0xF2, 0x2D,
-    0xA6, 0x6C, 0x18, 0x38, 0xB0, 0xC5, 0x82, 0x8D, 0x4C, 0x82, 0xBD, 0x0C, 0x6D, 0xF1, 0xC4, 0xEE,
-    0xAC, 0x2C, 0x5C, 0xC0, 0xA3, 0xB5, 0xBE, 0x83, 0x20, 0x61, 0x85, 0x61, 0x53, 0x65, 0xD4, 0x76,
-    0x69, 0x1D, 0x86, 0x1A, 0xB2, 0xF5, 0x36, 0x36, 0x2C, 0xA3, 0xD3, 0x1A, 0x9E, 0xDB, 0xD6, 0x43,
-    0x75, 0xF4, 0x79, 0x7D, 0xF8, 0xFE, 0x94, 0x97, 0xC8, 0xF5, 0x66, 0xEE, 0x39, 0xB7, 0x9C, 0xE9,
-    0x70, 0x8E, 0x60, 0x4F, 0x45, 0x1E, 0x71, 0x33, 0xC6, 0x98, 0x4C, 0x29, 0xEE, 0xBF, 0x47, 0x16,
-    0xF2, 0x97, 0xDA, 0x12, 0xEA, 0xE9, 0x8C, 0x6F, 0x05, 0xA9, 0xA1, 0xA9, 0x53, 0x9C, 0xF4, 0xCA,
-    0x2C, 0xE8, 0x9E, 0x86, 0xAC, 0xEB, 0x48, 0x22, 0x51, 0x12, 0x68, 0xA0, 0x1D, 0x66, 0x31, 0x9F,
-    0xE4, 0x13, 0xBF, 0xF8, 0xB2, 0x5F, 0x7E, 0x04, 0xE7, 0xB8, 0x60, 0xDD, 0x61, 0x2C, 0xAE, 0xCD,
-    0xB2, 0x0D, 0x40, 0xE5, 0x13, 0x9E, 0xF0, 0xDD, 0xAF, 0x7A, 0xE6, 0x47, 0x42, 0x7F, 0x5B, 0x67,
-    0xD1, 0x81, 0xBC, 0x1A, 0x85, 0x49, 0xE6, 0x15, 0xEB, 0x16, 0x7C, 0x23, 0x93, 0xE2, 0x24, 0x14,
-    0x7C, 0xC5, 0x33, 0xE2, 0x00, 0x91, 0x69, 0xA5, 0x1B, 0xE8, 0x5E, 0xA0, 0x2F, 0xBA, 0x2D, 0x82,
-    0xFD, 0x9F, 0x0C, 0x3D, 0x33, 0x49, 0x88, 0x1E, 0xB5, 0x78, 0x0F, 0x7E, 0x6C, 0x12, 0x94, 0x55,
-    0x51, 0x01, 0xE2, 0x57, 0x20, 0x4E, 0xCD, 0x55, 0xD7, 0x98, 0x24, 0x23, 0x19, 0x7C, 0xE3, 0xC1,
-    0x75, 0x19, 0xC4, 0x58, 0x12, 0x6D, 0x31, 0xD1, 0x0F, 0xEC, 0xBD, 0xD9, 0xD3, 0xF1, 0xF4, 0x0D,
-    0xFB, 0x6E, 0x58, 0x78, 0x1F, 0xFF, 0x10, 0xFC, 0x50, 0x65, 0x92, 0x7D, 0xCA, 0x6C, 0x8D, 0x05,
-    0x54, 0x5C, 0xDC, 0x14, 0xF9, 0xCC, 0x66, 0x82, 0xF8, 0x78, 0x26, 0x40, 0xE4, 0xA2, 0x7A, 0x48,
-    0x49, 0x58, 0x14, 0xC7, 0x98, 0x85, 0xA2, 0x0B, 0x9D, 0x8A, 0xCE, 0x1E, 0x49, 0x4C, 0x12, 0xA6,
-    0x20, 0x0A, 0x85, 0x4D, 0x97, 0x0B, 0xCB, 0x2E, 0x64, 0x61, 0x11, 0x31, 0x26, 0x89, 0x49, 0xA2,
-    0x57, 0x40, 0xD4, 0x9F, 0x41, 0xFC, 0xFF, 0x80, 0xB8, 0x9F, 0x82, 0x88, 0x21, 0x19, 0x92, 0x44,
-    0x24, 0x80, 0x14, 0x46, 0xB7, 0x8D, 0xB4, 0x06, 0xF5, 0xED, 0xCA, 0xDB, 0x56, 0x3E, 0xB3, 0xA5,
-    0x35, 0x70, 0x62, 0x64, 0xD1, 0x2C, 0x01, 0x76, 0x6C, 0x16, 0x40, 0x11, 0xBF, 0x02, 0x9E, 0x38,
-    0x35, 0x91, 0x65, 0x4C, 0x40, 0x18, 0xD8, 0x25, 0x3C, 0x71, 0x27, 0x3E, 0x8D, 0xD8, 0xA7, 0xEC,
-    0xB7, 0x05, 0xA4, 0xB3, 0xEB, 0x2C, 0x67, 0xEC, 0x73, 0x39, 0x8C, 0xDA, 0x16, 0xF9, 0x2F, 0x37,
-    0x76, 0x31, 0x4A, 0xE9, 0xCD, 0x3E, 0x81, 0xD5, 0x88, 0x88, 0xC7, 0xD4, 0xD4, 0x54, 0x48, 0xDD,
-    0x76, 0xC1, 0xF9, 0x4C, 0x14, 0xBA, 0x60, 0x9D, 0x9F, 0x9B, 0x0D, 0x44, 0x67, 0xEF, 0xEF, 0x15,
-    0x4B, 0xB4, 0x8C, 0x98, 0x74, 0xEE, 0x99, 0x28, 0xE4, 0x24, 0x4B, 0xDC, 0x32, 0x38, 0x0F, 0x64,
-    0x44, 0x64, 0xA1, 0xEE, 0xAC, 0x69, 0x9B, 0xE4, 0xD9, 0xE8, 0x62, 0x45, 0xEA, 0x51, 0x4B, 0xDC,
-    0xE4, 0xF5, 0xE3, 0x75, 0xC4, 0x99, 0xEA, 0x82, 0xC9, 0x48, 0x7A, 0x08, 0x8C, 0x30, 0x55, 0xDA,
-    0x2F, 0x63, 0x88, 0x41, 0x0E, 0x19, 0x56, 0x4D, 0x9D, 0x1D, 0x23, 0x22, 0x27, 0x08, 0xA0, 0x6A,
-    0x0B, 0xB9, 0x30, 0xC4, 0x9A, 0xD2, 0x2F, 0xBE, 0x2D, 0x8E, 0x9E, 0x2A, 0xBA, 0x02, 0x36, 0x07,
-    0x23, 0xAA, 0x0A, 0xD6, 0xC9, 0x90, 0xAA, 0x2A, 0xAA, 0x1A, 0x51, 0xD5, 0x3E, 0x55, 0x1D, 0x41,
-    0x55, 0xAF, 0xEC, 0x71, 0xCF, 0x20, 0xE6, 0xCE, 0x0E, 0x48, 0x8F, 0x5A, 0x66, 0x20, 0x5C, 0x61,
-    0x70, 0x05, 0xD6, 0x8B, 0xF0, 0xCA, 0x56, 0x78, 0x83, 0xAA, 0x1E, 0x51, 0x55, 0x0A, 0xF4, 0xA8,
-    0x2A, 0xAB, 0x8C, 0x44, 0xFD, 0x02, 0xAA, 0xBA, 0xD6, 0x6C, 0xD6, 0xA5, 0xA2, 0x59, 0x89, 0x6C,
-    0x77, 0x73, 0x9A, 0xF2, 0x78, 0xEA, 0xE4, 0x7D, 0x7A, 0xFE, 0x60, 0x21, 0x84, 0x81, 0x9E, 0xC4,
-    0xCC, 0xDD, 0x11, 0x56, 0x8A, 0xA2, 0x0E, 0x5C, 0x8B, 0x41, 0x76, 0x6A, 0xD2, 0x36, 0xDE, 0x64,
-    0x89, 0xCA, 0x44, 0xE9, 0xB4, 0x7E, 0x60, 0xE9, 0xE5, 0xDA, 0x55, 0x44, 0xF2, 0x6C, 0x14, 0xB2,
-    0xB8, 0xE4, 0x73, 0x6A, 0xD5, 0xD1, 0xD4, 0x0B, 0x6A, 0xD6, 0x25, 0xC9, 0xD4, 0xD3, 0xCF, 0xDA,
-    0x42, 0x74, 0xF5, 0x3E, 0xD1, 0x68, 0x40, 0xB2, 0xEA, 0x1E, 0x77, 0xF4, 0x33, 0x9F, 0xAD, 0x59,
-    0x79, 0xB7, 0x37, 0xF5, 0x1C, 0x96, 0xC3, 0x73, 0xCC, 0xCE, 0x58, 0x36, 0x6D, 0xB1, 0x4F, 0xC4,
-    0x7F, 0xA0, 0x31, 0x56, 0xA2, 0x9A, 0xD9, 0xBC, 0x84, 0xB3, 0xB9, 0x15, 0xEB, 0x2A, 0x5B, 0xD0,
-    0x66, 0x34, 0x6C, 0x4C, 0xD4, 0x0F, 0x39, 0xE7, 0x6A, 0x34, 0x2D, 0x14, 0x4F, 0xDB, 0x70, 0x3C,
-    0x85, 0x3C, 0x52, 0x79, 0xD8, 0x0A, 0xA5, 0xB6, 0xD5, 0x47, 0x57, 0x36, 0x99, 0x7A, 0xAA, 0x2E,
-    0x42, 0x00, 0xD9, 0xA7, 0x6D, 0xFC, 0xDB, 0x2B, 0xBB, 0x08, 0xC9, 0x78, 0x87, 0xF9, 0xB6, 0x46,
-    0xB5, 0x92, 0x3C, 0x56, 0xC1, 0x70, 0x78, 0xDC, 0x41, 0x0B, 0x59, 0xC5, 0x24, 0xA1, 0x1E, 0xA0,
-    0x20, 0xED, 0xA3, 0x71, 0x33, 0x35, 0x43, 0xD8, 0x64, 0x72, 0x84, 0x1C, 0x5B, 0x49, 0x86, 0x04,
-    0x61, 0x1B, 0xB2, 0x45, 0xE6, 0x4C, 0x30, 0xCE, 0x21, 0x9E, 0x07, 0x15, 0xEA, 0xAA, 0x1A, 0x06,
-    0xC8, 0xD0, 0xFA, 0xF6, 0xBA, 0x2A, 0xE3, 0x2C, 0x32, 0x55, 0x16, 0x12, 0xC0, 0x57, 0x1A, 0x1B,
-    0x4E, 0x37, 0x37, 0xC3, 0xB6, 0xDE, 0x9D, 0xBA, 0x15, 0x16, 0xEE, 0x01, 0xAA, 0x95, 0x60, 0x7B,
-    0x98, 0x34, 0xD1, 0x19, 0x34, 0xCD, 0x79, 0x4D, 0x63, 0x69, 0xA1, 0xC3, 0xC3, 0xD7, 0x34, 0xF7,
-    0x55, 0x32, 0xDB, 0xA8, 0x4F, 0xA8, 0xB7, 0x20, 0x37, 0x36, 0x9F, 0xEA, 0xC0, 0xFC, 0x5C, 0x37,
-    0x01, 0xBC, 0xDA, 0x08, 0x70, 0x47, 0x4D, 0x12, 0xE3, 0x8A, 0x7E, 0x9A, 0x2B, 0x16, 0xC1, 0x9F,
-    0xD3, 0x1F, 0xE1, 0xB5, 0xBC, 0x42, 0xE5, 0xC2, 0xAD, 0x94, 0x1E, 0x66, 0x7E, 0x69, 0x71, 0xFC,
-    0xD7, 0x1D, 0xAC, 0xC0, 0xFC, 0x24, 0xD8, 0x31, 0x72, 0xDE, 0x3D, 0x82, 0xEA, 0x2B, 0x8B, 0xE3,
-    0x9D, 0x34, 0x2B, 0x30, 0xAF, 0x82, 0xCF, 0xA5, 0xAB, 0xF3, 0x10, 0x5A, 0x04, 0x6F, 0xE6, 0x95,
-    0x7D, 0x16, 0x53, 0xA8, 0xAA, 0xB8, 0xC6, 0x1E, 0x7D, 0xC0, 0x12, 0x6B, 0xBE, 0x1F, 0xBA, 0x00,
-    0x19, 0x4E, 0x5E, 0x22, 0xDF, 0x2A, 0x33, 0x46, 0x34, 0xAA, 0xED, 0xFC, 0xE8, 0x12, 0xD8, 0x87,
-    0x15, 0x0B, 0x28, 0xA5, 0xB9, 0x9E, 0x04, 0xD7, 0x5A, 0x96, 0x6E, 0xDC, 0xDB, 0xA8, 0xC1, 0x11,
-    0x75, 0x64, 0x78, 0x78, 0xE3, 0xFE, 0x9D, 0xF7, 0x62, 0x2B, 0x2D, 0x7B, 0x84, 0x46, 0x25, 0x1D,
-    0x70, 0xAF, 0x96, 0x9F, 0xC5, 0xDC, 0x3F, 0xAD, 0x02, 0x93, 0x86, 0xA6, 0x68, 0xDD, 0x33, 0x3A,
-    0x6C, 0xBE, 0x91, 0x3C, 0xF8, 0x89, 0x1D, 0xD4, 0xF4, 0x1B, 0xC9, 0xE0, 0x44, 0xEB, 0xB5, 0x30,
-    0xC0, 0x54, 0xA2, 0x8A, 0x65, 0xFB, 0x8D, 0x84, 0xE5, 0xB6, 0xDD, 0x9E, 0x65, 0x15, 0x77, 0xA9,
-    0x9C, 0xEF, 0x51, 0xBF, 0x8D, 0xBF, 0xF3, 0xF4, 0x84, 0xF7, 0x27, 0x8F, 0x7A, 0xFF, 0x26, 0xBF,
-    0xCD, 0xC0, 0x42, 0x07, 0x9B, 0x69, 0x88, 0x75, 0x83, 0xCD, 0x79, 0xCC, 0x9A, 0x1B, 0x3F, 0xB2,
-    0x9B, 0xDF, 0xC3, 0x3B, 0x77, 0x6E, 0x0F, 0x66, 0xFB, 0x4F, 0xAD, 0xDC, 0xD2, 0x41, 0xD9, 0x6C,
-    0x98, 0x8E, 0xD3, 0x26, 0x5D, 0x1C, 0xF3, 0x7E, 0xEF, 0x84, 0xF7, 0x2F, 0x82, 0xFF, 0xD4, 0xFB,
-    0x87, 0xF4, 0x7E, 0x80, 0x63, 0xB1, 0x36, 0xF7, 0xFE, 0x45, 0xF0, 0x4F, 0x64, 0x86, 0x57, 0xB2,
-    0x7D, 0xCC, 0x43, 0x17, 0xC0, 0xFB, 0x02, 0xEE, 0xA2, 0x64, 0x2F, 0x81, 0xD8, 0x60, 0xEC, 0xDC,
-    0x76, 0xAB, 0x2F, 0xFA, 0x39, 0xEB, 0x7E, 0xC9, 0x7D, 0x8B, 0xBE, 0x9D, 0xB2, 0x37, 0xE1, 0x33,
-    0x5F, 0xF4, 0x23, 0xC7, 0x09, 0x52, 0x45, 0xA2, 0x3E, 0x2C, 0xD6, 0x9C, 0xD1, 0x6A, 0x13, 0xB4,
-    0x6F, 0xDA, 0x5C, 0xF0, 0xE4, 0x27, 0x17, 0x54, 0xE9, 0x40, 0xE9, 0x59, 0x7E, 0x73, 0x6E, 0x73,
-    0x11, 0xF8, 0xE4, 0xA7, 0x3D, 0xAE, 0xB9, 0x5A, 0x86, 0x3B, 0x9A, 0xAB, 0x3D, 0x51, 0x70, 0x85,
-    0x1C, 0x8B, 0xC9, 0x11, 0x1D, 0x99, 0x01, 0x87, 0xE1, 0xBF, 0xFD, 0x9B, 0x0A, 0xA6, 0x1C, 0xA9,
-    0x8F, 0x6F, 0xD4, 0x51, 0xE2, 0x8E, 0xE1, 0xC6, 0x63, 0x98, 0x2D, 0xEB, 0xB7, 0x0D, 0x66, 0xCC,
-    0x70, 0xAF, 0x8E, 0xC4, 0xA9, 0x54, 0xE1, 0x97, 0x3E, 0xF7, 0x45, 0xE8, 0xD6, 0x9C, 0x1E, 0x82,
-    0xD3, 0x91, 0x2F, 0x2A, 0x37, 0xF2, 0x75, 0x7F, 0x3C, 0x03, 0xA7, 0x37, 0xC2, 0x5A, 0x32, 0x24,
-    0x8C, 0xFC, 0x60, 0x53, 0xE7, 0x12, 0x14, 0xFB, 0x90, 0xB3, 0xF7, 0xC4, 0x1F, 0x0C, 0xA0, 0x13,
-    0xBF, 0xDD, 0xEC, 0x4F, 0xB7, 0x38, 0x74, 0x5B, 0xFE, 0xB4, 0x1B, 0x84, 0xD1, 0x88, 0xE1, 0x98,
-    0x04, 0x0F, 0x36, 0x51, 0x5E, 0x72, 0x63, 0xDD, 0x19, 0x51, 0xE7, 0x41, 0xAB, 0xEB, 0x60, 0xAE,
-    0xF3, 0x18, 0x53, 0x5F, 0x87, 0x89, 0x0B, 0xBD, 0x83, 0xD2, 0xAE, 0xF4, 0xA6, 0x7A, 0xDB, 0xA2,
-    0x6F, 0xAB, 0x0D, 0x8D, 0xAA, 0x09, 0xBB, 0x69, 0xBE, 0x5E, 0x04, 0x7F, 0xC7, 0xFA, 0x1B, 0x7C,
-    0x6F, 0x64, 0x7B, 0xBB, 0x65, 0x98, 0x38, 0x49, 0x5B, 0xBE, 0x2D, 0x82, 0xFF, 0x2A, 0x96, 0xA7,
-    0xE6, 0x65, 0xED, 0x7D, 0x62, 0x52, 0xFF, 0x25, 0x33, 0x2F, 0x35, 0x16, 0x62, 0x1B, 0xE0, 0x03,
-    0x3F, 0x5B, 0xB0, 0xBD, 0xFE, 0xDC, 0x3C, 0xE4, 0x16, 0xC1, 0xDB, 0x6E, 0xA7, 0xEB, 0x06, 0xEF,
-    0x5B, 0x94, 0x38, 0xF1, 0x3D, 0xAF, 0x39, 0x54, 0x3A, 0xEF, 0x37, 0x9B, 0x97, 0x83, 0x11, 0xE4,
-    0x57, 0x8D, 0x7C, 0x05, 0xF9, 0x11, 0xE4, 0xF7, 0xEB, 0x81, 0x8C, 0x32, 0xAC, 0xF4, 0xB3, 0x01,
-    0xF2, 0xC4, 0x20, 0x94, 0xAC, 0x8B, 0x85, 0x77, 0x5C, 0x43, 0x3E, 0x82, 0x56, 0x95, 0x41, 0xA9,
-    0x20, 0x3F, 0x82, 0x7C, 0xEE, 0xAB, 0xCE, 0xB6, 0xCF, 0xF6, 0x1E, 0xDF, 0x3E, 0xFB, 0x5F, 0x3E,
-    0x6A, 0xC5, 0x49, 0x5C, 0x46, 0xE6, 0x33, 0xC4, 0xC4, 0x5F, 0xCB, 0x66, 0x7D, 0x7A, 0xBD, 0xF1,
-    0x29, 0xAF, 0xF5, 0x29, 0x35, 0xDF, 0x2E, 0x5B, 0x08, 0x7F, 0xBB, 0x3D, 0xC6, 0x62, 0x83, 0xDB,
-    0x63, 0x2C, 0x36, 0xE6, 0xDB, 0x63, 0x0B, 0xE1, 0x3F, 0x2D, 0x08, 0x4E, 0x6C, 0x87, 0x2D, 0xC6,
-    0x36, 0x8C, 0xB9, 0xA3, 0x66, 0xA7, 0x97, 0xD5, 0x6A, 0x90, 0xCE, 0x7C, 0xE0, 0xB7, 0x22, 0xEF,
-    0x65, 0xD6, 0x9F, 0xDC, 0x2A, 0xC2, 0xC3, 0x30, 0xF1, 0x0B, 0x95, 0x06, 0xFC, 0xA4, 0x9F, 0x62,
-    0x11, 0x89, 0xBB, 0xF0, 0x36, 0xA6, 0x80, 0x9A, 0x88, 0x84, 0x09, 0xEC, 0x82, 0x47, 0x54, 0x35,
-    0xDF, 0xCF, 0x55, 0xEB, 0x27, 0xF4, 0xAD, 0xA8, 0xC9, 0xC3, 0xDC, 0xB1, 0x44, 0x3D, 0x66, 0x33,
-    0xAC, 0xC8, 0xE7, 0x7F, 0x6C, 0xCC, 0xC2, 0x03, 0xE2, 0x94, 0x1C, 0xC3, 0xA9, 0x6A, 0x0F, 0xD2,
-    0xA0, 0x0B, 0xDB, 0x68, 0xDE, 0xDC, 0x8A, 0xCF, 0x72, 0x8C, 0x2D, 0xD7, 0xA1, 0xDE, 0x47, 0x1C,
-    0x64, 0xC3, 0x31, 0x0A, 0xDD, 0xE4, 0xF3, 0x3F, 0x64, 0xCE, 0x52, 0x17, 0x14, 0xDA, 0xBE, 0x38,
-    0xB3, 0xE5, 0xD3, 0x1C, 0xEB, 0x7F, 0x01, 0xC5, 0x5B, 0xBF, 0x6F, 0xDC, 0xD6, 0x1D, 0xFF, 0x92,
-    0xB4, 0xC4, 0xC6, 0x44, 0x4B, 0x03, 0x95, 0xD1, 0xD6, 0x2E, 0xCC, 0x8C, 0x41, 0x61, 0x8B, 0x4B,
-    0x87, 0x0C, 0xBE, 0x23, 0xD3, 0x0C, 0x59, 0x6F, 0xF0, 0x25, 0x40, 0x3D, 0xB8, 0x83, 0x07, 0x23,
-    0x40, 0xA1, 0x0C, 0x1D, 0x3A, 0xE8, 0x74, 0x04, 0x32, 0x66, 0xA8, 0x86, 0xFE, 0x01, 0x1E, 0x3C,
-    0xA4, 0xF2, 0xE0, 0x0C, 0x19, 0xDC, 0x82, 0xF2, 0xB1, 0xC8, 0xE0, 0x31, 0x4C, 0x83, 0xCE, 0x26,
-    0x50, 0x69, 0xF1, 0x12, 0x06, 0xA5, 0x11, 0xBA, 0xBE, 0x3B, 0xF6, 0xF3, 0x79, 0x8F, 0xBC, 0x3B,
-    0xC9, 0x92, 0x2C, 0xD9, 0x77, 0x97, 0x3B, 0xBE, 0xAF, 0x7C, 0x24, 0xDF, 0xF7, 0x7D, 0x7F, 0xBC,
-    0xF7, 0xFD, 0xF5, 0x9E, 0x25, 0xA8, 0x52, 0x91, 0xA0, 0xCA, 0x44, 0x2E, 0x76, 0x43, 0xA9, 0x3F,
-    0x25, 0x9A, 0x31, 0x04, 0xB0, 0x46, 0x04, 0xDF, 0x01, 0x38, 0x5F, 0x03, 0xB8, 0x7F, 0x89, 0x44,
-    0x3C, 0x27, 0x41, 0x0F, 0x0B, 0xDD, 0x5A, 0x56, 0x2E, 0x12, 0x1B, 0x39, 0x3B, 0x94, 0x62, 0x14,
-    0x12, 0x8B, 0x59, 0x55, 0x23, 0xB1, 0xAA, 0x6A, 0x2C, 0xF6, 0xD3, 0x9D, 0x81, 0xB8, 0x89, 0xB8,
-    0xA1, 0x17, 0xE2, 0xAF, 0x2F, 0x62, 0xA7, 0x6D, 0x20, 0xCB, 0x36, 0x45, 0xCC, 0x1C, 0xC8, 0x8D,
-    0xC2, 0x52, 0xEF, 0x8E, 0xC5, 0xE8, 0xDE, 0xD0, 0xE3, 0x3E, 0xD8, 0x13, 0x07, 0xBF, 0x9D, 0xED,
-    0x3E, 0x48, 0x41, 0x5F, 0x71, 0x74, 0x33, 0x6E, 0x26, 0x40, 0x9C, 0x78, 0xCF, 0x6F, 0x26, 0x01,
-    0x7E, 0xC7, 0xAA, 0xB9, 0x68, 0x5E, 0xB2, 0x25, 0xFD, 0x24, 0xA8, 0x7E, 0x48, 0x9C, 0xEA, 0xD3,
-    0x44, 0x2E, 0x00, 0xC7, 0xDB, 0xB2, 0x2D, 0xF2, 0xAE, 0x01, 0x86, 0xFC, 0x8A, 0xBD, 0x2B, 0x22,
-    0xEE, 0xC8, 0x92, 0x59, 0x33, 0xE5, 0x2D, 0xB1, 0xA2, 0x2B, 0xE8, 0x84, 0x9F, 0x03, 0xA0, 0x59,
-    0x91, 0xF9, 0xB1, 0xB8, 0x2C, 0x26, 0x80, 0xD1, 0x04, 0x1A, 0xB1, 0x23, 0xE2, 0x96, 0x09, 0xF8,
-    0x2B, 0xC7, 0x2B, 0xB5, 0x5C, 0xDF, 0x98, 0x1F, 0x22, 0xBF, 0x02, 0x54, 0xD7, 0xEB, 0xD6, 0x86,
-    0xAE, 0x3C, 0x68, 0xCF, 0x00, 0x3E, 0x83, 0x7A, 0x23, 0x13, 0x0A, 0xB3, 0x78, 0x61, 0xFD, 0x8E,
-    0x96, 0x02, 0x3F, 0xAB, 0xD5, 0x73, 0x4E, 0xDF, 0x2A, 0x34, 0xAA, 0xED, 0x0D, 0xB1, 0x48, 0xB2,
-    0x4B, 0x92, 0x3D, 0x92, 0xEC, 0xF3, 0xFD, 0x80, 0xAF, 0xB5, 0x8F, 0x03, 0xC1, 0x04, 0xA8, 0x1E,
-    0x6A, 0x18, 0x9B, 0x03, 0x9A, 0xE3, 0xF0, 0x12, 0x34, 0x07, 0xD6, 0xC0, 0x1F, 0xA5, 0x7C, 0x91,
-    0x2F, 0xAD, 0xA1, 0x41, 0x34, 0x26, 0xC6, 0xA1, 0x80, 0x5D, 0x0C, 0x70, 0xAE, 0xA6, 0xC4, 0x7F,
-    0x4E, 0xE1, 0x8A, 0xF3, 0xEC, 0x8F, 0x0A, 0x55, 0x50, 0x8F, 0xD0, 0x3B, 0xD4, 0xDA, 0xF5, 0x78,
-    0xA4, 0xCD, 0x4D, 0x57, 0xC5, 0x46, 0x1F, 0x19, 0x8C, 0x34, 0xBF, 0x0A, 0xBF, 0x70, 0xC6, 0x9A,
-    0x15, 0x70, 0xD8, 0x5F, 0x41, 0x0E, 0x1E, 0xB5, 0xBD, 0xA6, 0x9F, 0x2C, 0x9D, 0x61, 0xCE, 0x5A,
-    0x1F, 0xAF, 0xF4, 0x73, 0x4C, 0x87, 0x21, 0x78, 0x5E, 0x17, 0xA3, 0x99, 0xCA, 0xF3, 0x63, 0x98,
-    0xAF, 0xC9, 0x16, 0xC1, 0x3B, 0x32, 0xFB, 0x59, 0x3E, 0xAF, 0x6E, 0xA4, 0xDB, 0xF9, 0x19, 0x2A,
-    0xE6, 0xC1, 0xA7, 0xD2, 0x9F, 0xD2, 0xA4, 0x43, 0x9D, 0x2A, 0xED, 0x2A, 0x3D, 0x4F, 0xF4, 0xBA,
-    0x5C, 0x66, 0xA9, 0x44, 0xA5, 0x4C, 0x28, 0x95, 0xCA, 0x55, 0x4A, 0x5E, 0x99, 0x23, 0xC3, 0x21,
-    0xBE, 0x52, 0xD8, 0xC0, 0xDA, 0xF6, 0x49, 0x0D, 0x8D, 0x95, 0x4D, 0x9E, 0x8C, 0xC6, 0x14, 0x07,
-    0xD5, 0x9E, 0xE2, 0x37, 0x91, 0x76, 0xF7, 0x41, 0x21, 0x2D, 0x31, 0x46, 0x00, 0xD2, 0x27, 0xF0,
-    0xA2, 0x16, 0x39, 0x68, 0xD1, 0x92, 0xB4, 0x68, 0x98, 0x26, 0x20, 0x3B, 0xF0, 0x53, 0x3D, 0x55,
-    0xEF, 0xA9, 0x1E, 0x7D, 0x8D, 0xA5, 0xDD, 0xDD, 0x28, 0x34, 0xE6, 0xA0, 0x2A, 0xA7, 0x7A, 0x2C,
-    0x62, 0x02, 0xDE, 0x28, 0x28, 0x96, 0x22, 0x23, 0xA0, 0xA8, 0x40, 0xD6, 0x46, 0x5A, 0xC0, 0x2A,
-    0x0E, 0x0B, 0x71, 0xF7, 0xD0, 0xD7, 0x8B, 0x40, 0x6A, 0xC0, 0x55, 0xDE, 0xA6, 0x15, 0xEC, 0xF1,
-    0x95, 0x43, 0xA0, 0x45, 0x10, 0xF0, 0xA9, 0x4F, 0x5D, 0xB9, 0xA9, 0x5B, 0x40, 0x00, 0xA3, 0x42,
-    0x8C, 0xAA, 0xF8, 0x52, 0x8B, 0x12, 0x9E, 0x2D, 0xA4, 0xA9, 0x2D, 0xC5, 0x7A, 0xF6, 0xFB, 0x2A,
-    0xB4, 0x32, 0xF1, 0x53, 0x00, 0x3B, 0x07, 0x30, 0x4A, 0x00, 0x19, 0x12, 0xC4, 0x04, 0xBD, 0x5F,
-    0x3C, 0xBB, 0x21, 0xBD, 0x00, 0xCE, 0x62, 0x8B, 0x34, 0xF7, 0xD4, 0xBD, 0xC9, 0xD3, 0x61, 0xD3,
-    0x43, 0xF5, 0xF5, 0x52, 0x6B, 0xFF, 0x43, 0xE0, 0xAB, 0xF0, 0x36, 0x40, 0x34, 0x65, 0xB0, 0x06,
-    0xE7, 0x77, 0x30, 0xB0, 0xC7, 0x27, 0x2B, 0xDD, 0xE7, 0xF5, 0xBD, 0x8D, 0xED, 0x86, 0xC1, 0x67,
-    0xAF, 0xC9, 0xA0, 0xF3, 0x12, 0x83, 0x36, 0x08, 0x60, 0x6B, 0xDC, 0x37, 0x27, 0x2F, 0x5B, 0xBB,
-    0xDB, 0x65, 0xF7, 0x23, 0x1B, 0x9E, 0xAB, 0xD6, 0x46, 0x9F, 0xE3, 0xDE, 0x61, 0xFF, 0x06, 0xD7,
-    0x4B, 0x21, 0xC2, 0xC6, 0x1E, 0x26, 0x27, 0xFC, 0xCD, 0xDE, 0x46, 0xE4, 0x85, 0x0E, 0x7C, 0x8B,
-    0x95, 0xB5, 0xE1, 0x22, 0xB6, 0xBA, 0x1F, 0xE5, 0xFD, 0xAA, 0xCA, 0xFB, 0x3B, 0x3B, 0x77, 0x7B,
-    0xCD, 0x58, 0xCD, 0xE4, 0xCC, 0x8C, 0x08, 0x82, 0x4A, 0xB1, 0x06, 0x22, 0x4E, 0xCE, 0x55, 0xF9,
-    0x89, 0xD8, 0xE1, 0x55, 0xE0, 0xC5, 0x64, 0x60, 0xE4, 0xB3, 0x22, 0x0B, 0xA3, 0xDF, 0xE4, 0x42,
-    0x3B, 0x2A, 0x0E, 0x98, 0x03, 0x1F, 0x0A, 0x17, 0x7D, 0x22, 0x1F, 0xCE, 0x58, 0xAC, 0x45, 0xF0,
-    0x01, 0x8B, 0x51, 0x5B, 0x47, 0x2C, 0xE9, 0xD5, 0x19, 0xEB, 0x38, 0x07, 0x3E, 0x16, 0x42, 0xAF,
-    0x8A, 0x13, 0x30, 0x51, 0x19, 0xFD, 0x30, 0x18, 0x34, 0x9E, 0xD1, 0xE2, 0x86, 0xCA, 0xFA, 0xBD,
-    0x19, 0xCD, 0x88, 0x6D, 0x6E, 0xC9, 0x04, 0xBF, 0x6A, 0xBB, 0x78, 0x23, 0xA0, 0x05, 0x0D, 0x57,
-    0xA0, 0x14, 0x5A, 0x25, 0xF3, 0xFB, 0x42, 0xCF, 0xAD, 0x20, 0x5A, 0xE8, 0xFC, 0xD2, 0x86, 0xDC,
-    0x3F, 0xDA, 0x90, 0xCF, 0x63, 0x8E, 0x69, 0x64, 0x81, 0xF2, 0x57, 0x70, 0x47, 0x8A, 0x2F, 0x27,
-    0xEA, 0xF1, 0x7E, 0x13, 0xF9, 0x98, 0x34, 0x74, 0x7E, 0x05, 0x6E, 0xAB, 0xED, 0xCB, 0x89, 0x45,
-    0x0B, 0xEB, 0x64, 0x8D, 0x0B, 0x3A, 0xDA, 0x73, 0x59, 0x55, 0x5E, 0x03, 0xE3, 0xC3, 0x3C, 0x60,
-    0xC0, 0xE9, 0x13, 0xC0, 0xDD, 0x98, 0x39, 0xBC, 0x9E, 0x99, 0xC3, 0x3E, 0x99, 0x39, 0x3C, 0xD7,
-    0x6A, 0x2E, 0x24, 0x15, 0x9E, 0xAB, 0xDA, 0xD6, 0xB4, 0xAC, 0x00, 0xA1, 0xC7, 0x9C, 0x05, 0x84,
-    0x94, 0x31, 0x58, 0xF2, 0x30, 0x37, 0x8D, 0x9A, 0xE1, 0xF4, 0x36, 0x8D, 0x9C, 0xBB, 0xBF, 0x51,
-    0xD0, 0xC4, 0xD1, 0xC2, 0xD1, 0xC0, 0xD1, 0xA0, 0xCD, 0x36, 0xDA, 0x36, 0x9A, 0x36, 0x3F, 0xB4,
-    0x0A, 0x1A, 0x36, 0xDA, 0x35, 0x98, 0xB5, 0x02, 0xF8, 0x0B, 0x6D, 0x2E, 0x39, 0x6B, 0xAC, 0xFC,
-    0x67, 0x1D, 0x2F, 0x75, 0x21, 0xE4, 0x55, 0x1A, 0x0A, 0x5A, 0x0D, 0x71, 0x60, 0x36, 0xB4, 0xDD,
-    0x30, 0xA8, 0xDC, 0x89, 0xA4, 0x97, 0x2B, 0x03, 0x23, 0x5C, 0x15, 0x33, 0x41, 0x2C, 0x4E, 0x77,
-    0xDE, 0x2F, 0xEA, 0x50, 0x6A, 0xC1, 0xFC, 0x6B, 0x5E, 0x7D, 0x69, 0xF8, 0x39, 0x7F, 0x20, 0x54,
-    0x5B, 0xEE, 0x1C, 0xA0, 0xBA, 0x99, 0x67, 0x10, 0xBB, 0x19, 0xCE, 0x18, 0xA3, 0x45, 0xF2, 0xBF,
-    0x7C, 0x36, 0xF5, 0x87, 0x49, 0x06, 0x62, 0x47, 0x7C, 0xD6, 0xE5, 0x40, 0xFE, 0xC3, 0x04, 0x09,
-    0x0B, 0xC1, 0xAA, 0x93, 0x2E, 0x37, 0x9A, 0x59, 0xF9, 0x8B, 0x14, 0x84, 0x4A, 0xCA, 0xF8, 0x0F,
-    0x97, 0xD1, 0xA4, 0x4F, 0x0F, 0xF4, 0xD0, 0x4E, 0x79, 0xBF, 0x56, 0x05, 0x23, 0xB3, 0x49, 0x04,
-    0xF7, 0x2A, 0x00, 0x2B, 0x56, 0x69, 0x00, 0xBB, 0x76, 0x2B, 0x39, 0x6D, 0x37, 0x05, 0x74, 0xF4,
-    0x3C, 0x56, 0xC1, 0x16, 0xC6, 0x76, 0x1E, 0x83, 0x8A, 0x75, 0xE6, 0xAD, 0x6B, 0xD3, 0x0C, 0x51,
-    0x7D, 0xE2, 0x93, 0xC1, 0x65, 0x70, 0x13, 0xD3, 0x6B, 0x0C, 0xF6, 0x37, 0x12, 0x19, 0x84, 0x4E,
-    0x2A, 0x8F, 0x60, 0x59, 0x64, 0x97, 0x20, 0x3E, 0x2B, 0x60, 0x66, 0xF8, 0x50, 0xE5, 0x87, 0xC3,
-    0x1A, 0x7E, 0xB4, 0xDF, 0xED, 0x8E, 0xC2, 0x8A, 0x9F, 0x4C, 0xC1, 0x74, 0xF6, 0x69, 0x0D, 0xAB,
-    0x3A, 0xA0, 0x23, 0xC4, 0xFB, 0x87, 0x9E, 0x9E, 0x1A, 0x8A, 0x4C, 0x72, 0x70, 0xD9, 0x78, 0xFA,
-    0x39, 0x0C, 0xF9, 0x50, 0x6E, 0xFE, 0xFB, 0x46, 0x7D, 0x6F, 0x0D, 0x42, 0xAA, 0x32, 0xE7, 0x49,
-    0x55, 0x3A, 0x43, 0x19, 0x3A, 0xB9, 0xF4, 0xC0, 0x6B, 0x1B, 0xCF, 0x4E, 0xD5, 0x8C, 0xF0, 0x9C,
-    0x57, 0x5C, 0x6D, 0x57, 0xC3, 0xDF, 0x7A, 0xF9, 0x05, 0xA5, 0x6D, 0x07, 0xC8, 0xB0, 0x1A, 0x7A,
-    0x72, 0xD6, 0xCB, 0xA9, 0x30, 0xA3, 0xB2, 0x06, 0x61, 0xF9, 0x09, 0x11, 0xAA, 0xCF, 0x1D, 0xA5,
-    0x94, 0x53, 0x5F, 0xFD, 0x2A, 0xE9, 0x57, 0xA9, 0xAE, 0x5D, 0xF9, 0x55, 0x84, 0x0B, 0xFA, 0x3F,
-    0xEB, 0xE5, 0xD3, 0x99, 0x46, 0x40, 0x05, 0xEF, 0xAE, 0x51, 0x19, 0x77, 0xB1, 0x28, 0xCF, 0x70,
-    0xFD, 0x41, 0xB6, 0xFF, 0x64, 0xA6, 0x41, 0x95, 0xB8, 0xE3, 0xBA, 0xDA, 0xF4, 0x86, 0xC4, 0x74,
-    0x24, 0xFA, 0xC2, 0xC2, 0xBA, 0x88, 0xBC, 0x06, 0xE1, 0x59, 0x49, 0x1A, 0x8C, 0x07, 0x63, 0x3B,
-    0x7D, 0xD5, 0x77, 0x30, 0x42, 0x84, 0xF0, 0xA5, 0x91, 0x59, 0x09, 0xBE, 0xFB, 0xE6, 0x58, 0xD6,
-    0x0C, 0x84, 0x0A, 0x4E, 0x62, 0xAA, 0xBC, 0x62, 0x35, 0xE2, 0xBF, 0x4F, 0xF8, 0x86, 0x57, 0x60,
-    0x90, 0xAE, 0x4B, 0xBB, 0xE3, 0x43, 0x97, 0x46, 0x48, 0x8C, 0xBA, 0xE7, 0xE9, 0x47, 0xBF, 0x13,
-    0x1F, 0xFC, 0x0C, 0xC6, 0x46, 0xCE, 0x66, 0xA7, 0x6F, 0xDE, 0x06, 0x23, 0x23, 0xAF, 0xC6, 0x2A,
-    0x06, 0xCC, 0x69, 0x75, 0x99, 0x41, 0x22, 0x67, 0x49, 0xD0, 0x10, 0xD2, 0xDE, 0x83, 0x9D, 0xE8,
-    0xC4, 0x8C, 0x22, 0x86, 0xEF, 0x40, 0x83, 0xF5, 0xF4, 0xBB, 0xA7, 0xEE, 0x9C, 0xF6, 0x92, 0xE9,
-    0x55, 0xC8, 0xFB, 0x39, 0x63, 0x3E, 0x26, 0x5E, 0x2A, 0x1E, 0x1C, 0x64, 0xE6, 0xF7, 0xA5, 0x9D,
-    0xB4, 0x56, 0xB4, 0x5D, 0x86, 0xA1, 0x7C, 0xC3, 0xCB, 0x67, 0x8E, 0xDB, 0x1F, 0xD1, 0xE7, 0x5F,
-    0x52, 0x55, 0x05, 0xD8, 0x3E, 0x58, 0x3E, 0xF7, 0x71, 0x0A, 0xAB, 0x57, 0xDB, 0xBC, 0x33, 0xAE,
-    0x9F, 0xD9, 0xCB, 0x28, 0x99, 0xA2, 0xF4, 0x23, 0x1A, 0xF0, 0x5D, 0x00, 0xB3, 0x04, 0x80, 0xC0,
-    0x5A, 0xAC, 0x03, 0xB4, 0xE8, 0xDA, 0x5A, 0x34, 0x30, 0xAA, 0xAC, 0xD8, 0xA2, 0xCB, 0x6B, 0xD1,
-    0xDB, 0xB5, 0x1E, 0xA9, 0xB8, 0x95, 0x21, 0xF0, 0x13, 0x56, 0x1E, 0x59, 0x74, 0x68, 0xA1, 0x2B,
-    0x5E, 0x1E, 0x49, 0xD3, 0xCD, 0x4B, 0x00, 0x1C, 0xA2, 0xB2, 0x54, 0x6E, 0x39, 0x24, 0xD8, 0x9A,
-    0x35, 0xD1, 0x96, 0xAA, 0x34, 0xD2, 0x8F, 0x3A, 0x61, 0x53, 0x69, 0x3C, 0x37, 0x63, 0xBE, 0x8F,
-    0x6E, 0x97, 0xC2, 0x18, 0x03, 0x40, 0x81, 0xC8, 0x94, 0x73, 0x89, 0x41, 0x54, 0x8C, 0xF1, 0x62,
-    0x50, 0xF9, 0x88, 0x09, 0x17, 0xD6, 0xCE, 0x00, 0x6E, 0x59, 0xDD, 0xE7, 0x73, 0x70, 0x18, 0x83,
-    0x35, 0xDD, 0x47, 0x39, 0x6D, 0xFD, 0x69, 0xD7, 0x8E, 0xF5, 0x21, 0x5A, 0xAE, 0x5D, 0xEB, 0x9D,
-    0xC3, 0xB8, 0x61, 0x28, 0x63, 0xE2, 0x02, 0xD5, 0xBB, 0xC4, 0xCD, 0x6A, 0xC7, 0xAD, 0x48, 0x76,
-    0x79, 0xFF, 0x08, 0xDC, 0x2C, 0x74, 0x50, 0x50, 0x1C, 0xC5, 0xAB, 0xF3, 0x91, 0xC6, 0x29, 0xB5,
-    0xE6, 0xD4, 0xEA, 0x4C, 0x20, 0x62, 0x33, 0x3A, 0x76, 0xC6, 0x32, 0xEE, 0x66, 0x5D, 0xEC, 0x8E,
-    0xCF, 0xF0, 0x5D, 0x04, 0x3D, 0x07, 0xE2, 0x17, 0xAF, 0x8E, 0x5E, 0x26, 0x42, 0xF0, 0xCF, 0xF0,
-    0xD5, 0x48, 0x3C, 0x20, 0xB8, 0x8E, 0xCE, 0x2D, 0xFC, 0x1B, 0x8D, 0x73, 0x0A, 0xED, 0x1A, 0xDA,
-    0xBB, 0x73, 0xA0, 0x35, 0x6E, 0xC7, 0xAD, 0xF8, 0x7A, 0xFC, 0xA7, 0xB8, 0x33, 0x0F, 0x69, 0x75,
-    0xD0, 0xB0, 0x76, 0x0C, 0xAE, 0x9F, 0xBB, 0xA7, 0xA5, 0xE0, 0xE5, 0xEF, 0x05, 0x58, 0xC3, 0x61,
-    0x7C, 0xFB, 0xE5, 0x27, 0x5C, 0x2B, 0x27, 0xB6, 0x6F, 0x72, 0xB1, 0xBE, 0xCB, 0x55, 0x54, 0x64,
-    0x63, 0x25, 0x06, 0x88, 0x51, 0xFB, 0xB8, 0xFF, 0xF3, 0xC3, 0xEF, 0xED, 0x77, 0x3B, 0xAC, 0x50,
-    0xA9, 0x2A, 0x95, 0x1C, 0xEF, 0x4C, 0xBE, 0x47, 0xE0, 0x1B, 0x9A, 0x15, 0xA3, 0x3E, 0x3F, 0x97,
-    0xE0, 0x78, 0x9F, 0xA3, 0xD3, 0x33, 0xBD, 0xB2, 0x82, 0x49, 0x69, 0x37, 0xAF, 0xA3, 0x55, 0xA9,
-    0x4B, 0x94, 0x56, 0x8A, 0x7C, 0x12, 0x20, 0x25, 0x00, 0x95, 0x69, 0xAB, 0x04, 0xB8, 0xBE, 0x4B,
-    0x10, 0x10, 0x78, 0x11, 0x80, 0x9B, 0xE0, 0x81, 0x95, 0x03, 0x18, 0x25, 0x80, 0x0C, 0x09, 0x02,
-    0x02, 0xFF, 0x7D, 0x00, 0xF7, 0x2B, 0x00, 0xFB, 0xBF, 0x00, 0xE6, 0x0F, 0xAC, 0x05, 0x56, 0x04,
-    0x7D, 0x02, 0x9F, 0x80, 0xB5, 0xD3, 0x1B, 0xBA, 0x5A, 0xCF, 0x55, 0x48, 0xC3, 0xE2, 0x4E, 0x2D,
-    0xCA, 0x6D, 0xAF, 0x54, 0x01, 0xDF, 0x60, 0x6F, 0x23, 0x19, 0x88, 0x93, 0x32, 0xDA, 0x63, 0xB0,
-    0x17, 0x9F, 0xB2, 0x2D, 0x91, 0x89, 0x43, 0x41, 0x6C, 0xD1, 0x08, 0x54, 0xED, 0xCC, 0x30, 0xF1,
-    0x7B, 0x53, 0x5E, 0xA6, 0x0B, 0x35, 0x9A, 0x2E, 0xD6, 0xAB, 0x75, 0x69, 0xBA, 0x43, 0x6B, 0xB2,
-    0xC9, 0x97, 0x7C, 0x3E, 0x76, 0x54, 0xAC, 0x3D, 0x9C, 0xDD, 0x52, 0x5B, 0x9A, 0x28, 0xE8, 0x45,
-    0x6D, 0x96, 0x56, 0x72, 0xCC, 0xD5, 0x41, 0x56, 0x57, 0x5C, 0xE6, 0xA3, 0x4F, 0xB5, 0xB3, 0xE4,
-    0x4F, 0x2A, 0xE8, 0x5C, 0x9D, 0x30, 0xA4, 0x74, 0x08, 0xB7, 0x91, 0x1B, 0x14, 0x9B, 0x40, 0xDD,
-    0xE9, 0x03, 0xB7, 0xF4, 0x11, 0xE2, 0xC0, 0x6F, 0x59, 0x0C, 0x79, 0x01, 0x36, 0xCF, 0x0A, 0x4E,
-    0x2D, 0x2D, 0x27, 0x3D, 0x28, 0xAD, 0xDD, 0x89, 0xB4, 0xDC, 0x4F, 0x01, 0x9C, 0x6F, 0x01, 0x2C,
-    0x4A, 0x4B, 0x5E, 0x4C, 0x04, 0x15, 0x68, 0x41, 0xA9, 0xEA, 0xF8, 0x01, 0x8F, 0xAA, 0x7C, 0x10,
-    0x3D, 0xB4, 0xC7, 0x8C, 0x6D, 0x75, 0x7B, 0x2A, 0xAF, 0x7D, 0xCA, 0xCB, 0x7E, 0x8D, 0x39, 0x73,
-    0xB8, 0xC1, 0x0B, 0x9A, 0x2C, 0x8D, 0xA9, 0x5D, 0x06, 0x28, 0xC8, 0x25, 0x58, 0xE9, 0x36, 0xB3,
-    0xC4, 0xA9, 0x30, 0x71, 0xFB, 0x2C, 0x88, 0x8E, 0xC3, 0x8D, 0x14, 0x21, 0x82, 0x9D, 0x83, 0x28,
-    0xA3, 0xE4, 0x06, 0xC3, 0x90, 0x82, 0xEF, 0xA9, 0x6D, 0x06, 0xB5, 0xA7, 0x70, 0x14, 0x50, 0x4F,
-    0xF9, 0xDE, 0x16, 0x55, 0x45, 0x7F, 0x6E, 0x0C, 0x81, 0xC5, 0x42, 0xE2, 0x8C, 0xF9, 0x01, 0x67,
-    0x0C, 0xEE, 0xD4, 0xB8, 0x9C, 0xB5, 0x46, 0x55, 0xA9, 0x1D, 0x0C, 0x81, 0x81, 0xD5, 0x3B, 0x1A,
-    0x05, 0x7F, 0x87, 0xCE, 0xB3, 0x8D, 0x14, 0xC2, 0xCD, 0x99, 0xF2, 0x02, 0xEB, 0x10, 0xC6, 0x29,
-    0x9E, 0x6D, 0xBC, 0x87, 0x81, 0x4A, 0x2F, 0x64, 0x6A, 0xEE, 0x64, 0xAA, 0xBA, 0xDE, 0xEC, 0x68,
-    0xBC, 0x25, 0xBF, 0xA4, 0x09, 0xF9, 0x33, 0x79, 0x61, 0x2C, 0xC9, 0x6A, 0xD8, 0x74, 0xF7, 0x66,
-    0xB9, 0xFC, 0x45, 0x26, 0x96, 0xBF, 0x83, 0x35, 0x02, 0x69, 0xF7, 0xCB, 0x69, 0xFD, 0x67, 0x1E,
-    0x7C, 0x4A, 0x67, 0x8D, 0x9E, 0x60, 0x97, 0x93, 0x08, 0x3C, 0xB9, 0xBF, 0x83, 0x72, 0xD7, 0xB9,
-    0x49, 0xBB, 0x66, 0xFC, 0x28, 0xCC, 0xCA, 0x45, 0xB8, 0x94, 0x2D, 0x18, 0x1F, 0x60, 0x36, 0x72,
-    0xAC, 0xA1, 0x24, 0x17, 0x43, 0xE6, 0xC9, 0x70, 0xC3, 0x54, 0xA5, 0x2A, 0x00, 0xEA, 0x0F, 0x18,
-    0xEB, 0x63, 0xF2, 0x80, 0x28, 0x5F, 0x2F, 0x1F, 0x5F, 0xEF, 0xAB, 0xF9, 0xDA, 0x4C, 0xF8, 0xDA,
-    0x50, 0xF8, 0x3A, 0x72, 0x6C, 0xFE, 0xB0, 0x6C, 0x3B, 0xFD, 0xD3, 0xBD, 0xD1, 0x3C, 0xAB, 0xDF,
-    0xAC, 0xFB, 0xE9, 0x30, 0xBE, 0xC1, 0x59, 0x8F, 0x00, 0xC6, 0x03, 0x4E, 0x56, 0x3D, 0x7A, 0x43,
-    0x4B, 0x3D, 0xBD, 0xFC, 0x3D, 0x19, 0x6C, 0x93, 0x4F, 0x6E, 0xB6, 0x38, 0x7B, 0x1B, 0x5F, 0x7F,
-    0xF3, 0x08, 0x58, 0xEC, 0x0A, 0x20, 0x10, 0x73, 0x08, 0xBB, 0xDD, 0xE6, 0x69, 0x00, 0x27, 0x01,
-    0xAB, 0xA3, 0xEE, 0x2D, 0xFE, 0x61, 0x39, 0x05, 0x7F, 0xC6, 0x3B, 0x3B, 0x2C, 0xD5, 0x96, 0xDA,
-    0xA4, 0x0D, 0x15, 0x9D, 0xEA, 0xDC, 0x80, 0x2F, 0xD6, 0x58, 0x6D, 0x30, 0xBA, 0x4F, 0xA2, 0x55,
-    0x6E, 0x25, 0x7D, 0xA0, 0x78, 0x2F, 0x55, 0xC4, 0x6C, 0xD4, 0x72, 0x39, 0xDE, 0x7D, 0x06, 0xD5,
-    0x3D, 0x5D, 0xA5, 0xFE, 0x70, 0x90, 0x30, 0xAC, 0x87, 0x29, 0xCA, 0x69, 0x98, 0xA7, 0xCD, 0xCA,
-    0x18, 0xF3, 0xEB, 0x6A, 0x76, 0x81, 0xF7, 0x0A, 0x95, 0x3A, 0xB4, 0x30, 0x3E, 0xCC, 0x3D, 0xE3,
-    0xB7, 0xA4, 0xA5, 0x36, 0xF3, 0xD8, 0x4F, 0x86, 0x2A, 0xDF, 0x58, 0xE1, 0x31, 0x04, 0x0A, 0x2B,
-    0x56, 0x0E, 0x4E, 0x69, 0xE6, 0xF6, 0xE5, 0xF4, 0xE1, 0x20, 0x7D, 0xF4, 0x3C, 0x1C, 0x40, 0x5F,
-    0x7C, 0xE9, 0x15, 0x39, 0xCC, 0x42, 0x08, 0x9B, 0xCD, 0x50, 0x28, 0x08, 0xE6, 0x27, 0xB5, 0x30,
-    0x7E, 0xB5, 0x5A, 0xAC, 0xFB, 0x85, 0xFF, 0x08, 0xE9, 0x2F, 0x2B, 0xEF, 0x7E, 0x58, 0x6B, 0xF9,
-    0xB8, 0x6B, 0x12, 0x11, 0xC3, 0xC7, 0x5E, 0x53, 0xE1, 0xF0, 0x05, 0xFA, 0x30, 0x3A, 0xB6, 0xF6,
-    0x91, 0x8E, 0x6D, 0x11, 0x0C, 0xC1, 0xA7, 0x6F, 0x5A, 0x29, 0xFC, 0x39, 0xBC, 0x39, 0x7D, 0x79,
-    0xE7, 0x75, 0x24, 0x7D, 0xD2, 0x59, 0x08, 0x03, 0xB3, 0xC8, 0xE1, 0xE1, 0x8F, 0xF4, 0x66, 0xD4,
-    0xEC, 0x1E, 0xB7, 0x9A, 0x1D, 0xE3, 0x50, 0x1F, 0xEF, 0x60, 0x02, 0x2E, 0x83, 0xA2, 0x3E, 0xA0,
-    0xD3, 0x4F, 0x74, 0xB0, 0x73, 0xD0, 0xA3, 0xFC, 0x5D, 0xE0, 0x9D, 0xC0, 0x98, 0x5F, 0x15, 0x7A,
-    0x38, 0xE4, 0x54, 0x98, 0x8D, 0x7A, 0xE9, 0x5C, 0xAF, 0x33, 0x09, 0xB3, 0xBA, 0xEB, 0x55, 0xC3,
-    0xE0, 0xBD, 0x78, 0x53, 0xB9, 0x6C, 0x64, 0x67, 0xD0, 0x85, 0x33, 0x0E, 0x99, 0xCA, 0xDA, 0x43,
-    0xC5, 0x09, 0xC6, 0x6D, 0xDF, 0x96, 0xDD, 0x7E, 0x55, 0xFA, 0xB0, 0xDA, 0x9D, 0x13, 0x8F, 0x35,
-    0x2C, 0x8C, 0xF6, 0x35, 0x6E, 0xF8, 0x9B, 0x55, 0xE4, 0x3C, 0xCE, 0x3C, 0x29, 0xF4, 0x81, 0x8E,
-    0xD7, 0xA1, 0x7D, 0x51, 0x34, 0x5E, 0xAB, 0x91, 0xF8, 0xD1, 0x24, 0x3F, 0x30, 0x1E, 0x68, 0x87,
-    0x7E, 0x66, 0x32, 0xF1, 0x12, 0xFC, 0x64, 0x3F, 0xE4, 0x72, 0xB1, 0x13, 0xF3, 0x41, 0x68, 0x8D,
-    0xE4, 0xA4, 0x9D, 0xAA, 0x45, 0x09, 0x1D, 0x52, 0x86, 0xAC, 0x9D, 0xAF, 0x32, 0x1E, 0xB8, 0xA8,
-    0x6A, 0x7B, 0xFA, 0x1A, 0x42, 0xA7, 0x59, 0x66, 0xEB, 0xDE, 0xDC, 0xEF, 0xBE, 0x3A, 0xF9, 0x3A,
-    0x65, 0x33, 0x13, 0x5D, 0xBB, 0x57, 0xC7, 0x22, 0x36, 0x75, 0x72, 0x7C, 0xA9, 0x64, 0xB8, 0xAB,
-    0x44, 0xC2, 0xF0, 0x90, 0x97, 0xF7, 0x74, 0x7B, 0x50, 0xE5, 0x97, 0xF7, 0x3B, 0x88, 0xE9, 0x8E,
-    0xBB, 0xF8, 0x26, 0xF2, 0x2F, 0xC4, 0x25, 0xE0, 0x41, 0xDB, 0x15, 0xA8, 0x11, 0xC8, 0xAD, 0x04,
-    0x3A, 0x84, 0x73, 0x61, 0x6D, 0xCE, 0xC8, 0xE1, 0x44, 0x7B, 0xF4, 0x49, 0x0C, 0xCF, 0xF2, 0x89,
-    0xF3, 0x5B, 0x08, 0x73, 0xDA, 0x60, 0x66, 0x35, 0x87, 0x91, 0x81, 0x68, 0xC5, 0x4A, 0x57, 0xD4,
-    0x23, 0x30, 0x84, 0x31, 0x73, 0x01, 0x4B, 0x2A, 0x4E, 0x7D, 0x55, 0x53, 0x28, 0x55, 0xC4, 0x95,
-    0xEB, 0x2D, 0x74, 0x63, 0x4A, 0xF3, 0xC7, 0xF7, 0x9F, 0xFE, 0xED, 0x38, 0x1A, 0x56, 0xEF, 0xFF,
-    0x6F, 0x1B, 0x93, 0x2A, 0x5B, 0xBD, 0x8F, 0x01, 0x4F, 0x47, 0xF3, 0x09, 0x42, 0xEF, 0x57, 0x59,
-    0x50, 0xA5, 0xC7, 0x0A, 0xDD, 0xA0, 0xF1, 0x83, 0x3D, 0x1A, 0xA4, 0x20, 0xF0, 0x45, 0x95, 0x41,
-    0xBB, 0x9C, 0xA2, 0x61, 0x53, 0xC1, 0xDA, 0x64, 0x7A, 0xD5, 0x9B, 0x0B, 0x60, 0x8C, 0x1F, 0xAA,
-    0x98, 0x02, 0x3A, 0x0E, 0xC4, 0xDD, 0x33, 0xD5, 0xB6, 0x81, 0x0A, 0xC9, 0xA2, 0x3A, 0x31, 0xEB,
-    0x18, 0x62, 0x8D, 0x6C, 0x71, 0x07, 0x95, 0xFC, 0x14, 0x73, 0xFA, 0x5C, 0x5D, 0x79, 0xBA, 0x23,
-    0xE6, 0x76, 0x7C, 0xEA, 0x30, 0xDF, 0x46, 0x4A, 0xE0, 0x66, 0x41, 0x18, 0x64, 0x7E, 0xF5, 0x22,
-    0xB3, 0xAB, 0x7F, 0x65, 0x6A, 0x01, 0x71, 0x67, 0x58, 0x6D, 0x83, 0x4F, 0x4F, 0x8C, 0x2E, 0x97,
-    0x3B, 0x4B, 0x9D, 0x3B, 0x19, 0x4D, 0xCE, 0x84, 0xCC, 0x85, 0xAB, 0x8E, 0x01, 0xEC, 0x5F, 0x70,
-    0xB6, 0x06, 0x93, 0x44, 0x69, 0x92, 0xE3, 0x2E, 0x97, 0xBF, 0x55, 0xE4, 0x1A, 0x76, 0x78, 0x4D,
-    0xF1, 0x39, 0x7B, 0x3E, 0x65, 0x2E, 0x7C, 0x9A, 0x7B, 0x0C, 0x40, 0x18, 0xD4, 0xFC, 0x9A, 0x31,
-    0xCC, 0x55, 0x82, 0x2B, 0x3C, 0x7F, 0xE9, 0x0C, 0x67, 0xAB, 0x34, 0x4B, 0x9E, 0xAF, 0x74, 0x3A,
-    0xFF, 0x00, 0xA7, 0xD9, 0x17, 0x22, 0xE9, 0x27, 0x88, 0xFF, 0x72, 0x5D, 0xB0, 0x9A, 0x27, 0xE7,
-    0x2B, 0xEF, 0xF1, 0x64, 0xE9, 0x07, 0x18, 0xA5, 0xCD, 0x52, 0xC6, 0x43, 0x96, 0x39, 0x32, 0x16,
-    0x24, 0xC3, 0x0B, 0x3F, 0x0E, 0xD3, 0x37, 0xC0, 0x5D, 0x89, 0x08, 0x3E, 0x07, 0xC9, 0x49, 0x21,
-    0x2E, 0x0C, 0xCA, 0x39, 0x63, 0x7E, 0x0C, 0x2F, 0x89, 0x1B, 0x1A, 0xCE, 0x8F, 0x26, 0x07, 0x84,
-    0xAF, 0x4C, 0x80, 0x47, 0x16, 0xDD, 0xFA, 0xC8, 0xDF, 0x9B, 0xF3, 0x73, 0xE4, 0x31, 0xE1, 0x7C,
-    0x26, 0x53, 0x11, 0x1E, 0xFD, 0x53, 0x5E, 0xA7, 0xD2, 0x41, 0xF6, 0x67, 0xAA, 0xBC, 0xDF, 0x36,
-    0x72, 0xBD, 0x61, 0x3E, 0xDD, 0x10, 0xDE, 0x54, 0x71, 0x6B, 0xD9, 0x63, 0x2A, 0xC4, 0x7C, 0x11,
-    0xFE, 0xD1, 0x44, 0xEA, 0x88, 0x7E, 0x56, 0x8E, 0xC4, 0xE8, 0x09, 0x68, 0x70, 0x43, 0xFB, 0xEB,
-    0xD0, 0x4E, 0x11, 0x22, 0x7F, 0xA6, 0x76, 0xC0, 0xDC, 0x0F, 0x12, 0x37, 0xB1, 0x13, 0xCF, 0xC2,
-    0x2D, 0x04, 0x31, 0x2C, 0x18, 0x59, 0x59, 0x9B, 0x5B, 0xF9, 0x08, 0xC1, 0x0D, 0xEE, 0xED, 0x23,
-    0x33, 0x2D, 0x5B, 0xEA, 0x7C, 0x21, 0xE3, 0x8A, 0xB2, 0x90, 0x4D, 0x04, 0xC9, 0xBB, 0xB9, 0xB4,
-    0xE0, 0x6C, 0xB7, 0x72, 0x69, 0x17, 0xAA, 0x0A, 0x4B, 0x8A, 0x11, 0xDD, 0xBB, 0x3A, 0xFC, 0x71,
-    0x33, 0x95, 0x54, 0x3A, 0x69, 0x53, 0x37, 0x55, 0x07, 0x5B, 0x74, 0x74, 0xA4, 0x0E, 0xB7, 0x88,
-    0x8A, 0x98, 0x64, 0x7A, 0xC0, 0x85, 0x33, 0xE3, 0x7C, 0x24, 0xF7, 0x7A, 0x08, 0xF9, 0x49, 0xBA,
-    0x9F, 0x91, 0xF2, 0x76, 0x6E, 0x65, 0xBE, 0x5C, 0xCF, 0xAD, 0xD4, 0x0B, 0xE3, 0xC2, 0x4E, 0xDC,
-    0xA8, 0x8C, 0x49, 0x75, 0xBE, 0xE9, 0x46, 0xF6, 0x3F, 0xF3, 0x96, 0x1B, 0x5A, 0xDF, 0x66, 0xEB,
-    0x9E, 0x58, 0xFF, 0x49, 0x3D, 0x50, 0xFC, 0x43, 0xE2, 0x82, 0xE0, 0x17, 0x91, 0x1B, 0xF3, 0x44,
-    0x14, 0xD7, 0xBD, 0xAA, 0xEC, 0x72, 0xCB, 0xBB, 0x39, 0x4B, 0xE2, 0x90, 0x02, 0x8F, 0x16, 0x81,
-    0x01, 0x03, 0x42, 0x28, 0x48, 0x3F, 0x6C, 0x92, 0xE5, 0x98, 0x25, 0xC2, 0x2D, 0xE6, 0xB5, 0x3E,
-    0x7F, 0x60, 0x31, 0x95, 0x48, 0x3E, 0xCD, 0x9C, 0x5B, 0xDF, 0x70, 0x7C, 0x39, 0x77, 0x9A, 0x4B,
-    0x2E, 0xB1, 0x58, 0x65, 0xBF, 0xBD, 0x06, 0x95, 0x9A, 0x0C, 0xEA, 0x48, 0xAA, 0x2A, 0x3A, 0x9E,
-    0x02, 0x34, 0x67, 0x7D, 0x28, 0x10, 0x9E, 0xF5, 0x61, 0xF8, 0x58, 0x8B, 0xE2, 0x73, 0xE1, 0x46,
-    0x9D, 0x52, 0x1F, 0x95, 0x06, 0x85, 0x28, 0x75, 0x51, 0x57, 0xD0, 0x90, 0xA7, 0x34, 0x6A, 0x30,
-    0xE5, 0x29, 0xA1, 0x8E, 0x98, 0xBB, 0x51, 0x18, 0xDD, 0xCF, 0x75, 0x2C, 0xE9, 0xD6, 0x67, 0x47,
-    0x98, 0xB3, 0xD4, 0xD9, 0xBB, 0x51, 0x9F, 0xCF, 0x1B, 0x44, 0xCD, 0x16, 0x45, 0xCC, 0x09, 0x3D,
-    0x64, 0x85, 0xE2, 0xED, 0x95, 0x43, 0x65, 0xD8, 0x25, 0xB1, 0xAF, 0x8E, 0x25, 0xB3, 0x4A, 0x51,
-    0xD6, 0x01, 0xEE, 0xF4, 0x84, 0x07, 0x4F, 0x8A, 0x20, 0x00, 0x2A, 0x3E, 0xDE, 0xB9, 0x9F, 0xAB,
-    0xE2, 0xDB, 0xE4, 0xA8, 0xEE, 0xAE, 0xFE, 0xFF, 0x01, 0x56, 0x7D, 0xDB, 0x3D, 0xF9, 0xF6, 0xA3,
-    0x6E, 0xB7, 0x83, 0x38, 0xAA, 0x64, 0xE3, 0x42, 0xB5, 0x9B, 0xF4, 0x6A, 0xB3, 0x96, 0xC2, 0x6F,
-    0x76, 0x3E, 0xEF, 0x57, 0xA3, 0x8B, 0xDD, 0x21, 0xA9, 0x40, 0x6F, 0x70, 0x07, 0x91, 0xB0, 0xA0,
-    0xC2, 0xBD, 0x6A, 0x50, 0xA5, 0x5F, 0x57, 0x35, 0x87, 0x31, 0xFF, 0x5F, 0x81, 0x21, 0x53, 0xF9,
-    0xAE, 0x4E, 0xCB, 0x2B, 0x0B, 0x21, 0x78, 0x4D, 0xBD, 0xB6, 0x3B, 0x3D, 0x37, 0x7E, 0x56, 0x6A,
-    0x39, 0x9B, 0xD4, 0x12, 0xE3, 0x62, 0xE3, 0x2C, 0xE3, 0x6C, 0xD3, 0x4B, 0x71, 0x21, 0x14, 0x23,
-    0x21, 0x59, 0xC7, 0x6A, 0x7A, 0x9C, 0x72, 0x67, 0x66, 0x5C, 0x27, 0x24, 0x67, 0x16, 0xF1, 0x1A,
-    0x72, 0xA0, 0xD0, 0xAF, 0x88, 0xBD, 0xA7, 0x34, 0xF5, 0x1A, 0xBB, 0xBD, 0xFF, 0x07, 0xD5, 0x5A,
-    0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0x24, 0x2D, 0xB1, 0x08, 0x51, 0x53, 0x83, 0xBC, 0x58, 0x68,
-    0xD9, 0xA1, 0x93, 0x81, 0x8A, 0x4B, 0x87, 0x14, 0xF0, 0x1D, 0x19, 0x78, 0xE8, 0x98, 0x1B, 0x74,
-    0xCE, 0xE0, 0xC1, 0x19, 0x3C, 0xA4, 0xC9, 0xA0, 0x0E, 0x19, 0x32, 0x48, 0x3A, 0x22, 0x19, 0x3A,
-    0x64, 0xA8, 0x50, 0x74, 0xEB, 0x50, 0x0F, 0x1E, 0x9A, 0xCB, 0xA0, 0x0C, 0x1E, 0x12, 0xE0, 0x4E,
-    0xC7, 0xA0, 0x43, 0xC6, 0xB2, 0x2D, 0x3C, 0x75, 0x28, 0x51, 0xC8, 0x2D, 0xEA, 0xA1, 0x61, 0x51,
-    0x06, 0xA1, 0x92, 0x93, 0xD8, 0xDF, 0xEF, 0x7D, 0xE4, 0x9D, 0xE4, 0xC4, 0xAE, 0x12, 0x9F, 0x65,
-    0x57, 0x22, 0xDF, 0xA3, 0xEE, 0xC8, 0x8F, 0xDF, 0x7B, 0xDF, 0xFB, 0xF3, 0x7B, 0xEF, 0x93, 0x48,
-    0xFB, 0x63, 0x97, 0xE2, 0xD5, 0x07, 0x76, 0x21, 0x83, 0xBA, 0x76, 0x72, 0xFB, 0x38, 0xDE, 0xFC,
-    0x4B, 0xEA, 0x16, 0xE2, 0xD6, 0xB1, 0x9F, 0x8A, 0x35, 0x95, 0x20, 0x11, 0x99, 0x4A, 0x88, 0x3B,
-    0xB7, 0x25, 0x02, 0xED, 0xE2, 0x57, 0x70, 0xF5, 0x28, 0x6A, 0xEE, 0x31, 0xF7, 0x07, 0xB1, 0xC8,
-    0x48, 0x38, 0x4E, 0x25, 0x18, 0xD3, 0x29, 0xC4, 0x3E, 0x96, 0x30, 0x13, 0x99, 0xD4, 0x35, 0xBE,
-    0xF2, 0xEA, 0x8A, 0x33, 0x58, 0x95, 0xF9, 0x0F, 0x6E, 0x01, 0xC9, 0x25, 0x2C, 0xDD, 0xD4, 0xAE,
-    0xEB, 0x97, 0x13, 0xEF, 0xFE, 0xCD, 0x1A, 0x73, 0x70, 0x2A, 0x0C, 0x6C, 0x95, 0x7C, 0xC7, 0x14,
-    0x03, 0x63, 0xD4, 0x87, 0x48, 0x87, 0x5F, 0xE0, 0xDD, 0x15, 0x5E, 0x0A, 0x61, 0xFC, 0xCC, 0xCB,
-    0xC5, 0xA9, 0x6B, 0x4C, 0x7E, 0x72, 0x84, 0x21, 0xAD, 0x58, 0x4E, 0xBD, 0x65, 0x4B, 0xC4, 0x7F,
-    0x27, 0xC7, 0x93, 0xFE, 0x2F, 0x52, 0xD2, 0xDF, 0x26, 0xA4, 0xC7, 0x1C, 0xCB, 0x3F, 0x50, 0x9A,
-    0x7C, 0x4B, 0x8A, 0x89, 0xF8, 0x31, 0x67, 0x12, 0x08, 0x75, 0x17, 0x71, 0x40, 0x0B, 0x53, 0xC0,
-    0x64, 0x4A, 0xBC, 0x7A, 0xC0, 0x29, 0x89, 0xF4, 0x4E, 0xCC, 0xC6, 0xA2, 0x16, 0xAC, 0xF2, 0x35,
-    0xB1, 0x7F, 0x55, 0x8C, 0xC4, 0xF9, 0x47, 0x0E, 0x52, 0x27, 0x20, 0x87, 0x90, 0x0B, 0xBA, 0xF8,
-    0x5F, 0xC4, 0xCD, 0x65, 0x2C, 0x7E, 0x2E, 0x51, 0x1C, 0x41, 0x71, 0xF5, 0x97, 0x39, 0x16, 0xEF,
-    0x4F, 0xF9, 0x09, 0xBD, 0x5A, 0xF8, 0x35, 0x72, 0x67, 0x61, 0xF3, 0x51, 0x35, 0x6A, 0x2E, 0x06,
-    0x45, 0x73, 0x11, 0x64, 0xCD, 0xC5, 0xD2, 0x09, 0x55, 0x45, 0xF5, 0x01, 0xA7, 0x5C, 0x17, 0x51,
-    0x5D, 0xA7, 0x5C, 0xB5, 0xB2, 0xDB, 0xDF, 0x2B, 0xE5, 0xF5, 0xE1, 0xFB, 0x45, 0x47, 0x28, 0x95,
-    0x78, 0x19, 0x04, 0x1E, 0xF0, 0xF9, 0xA4, 0xA3, 0x02, 0x43, 0x62, 0xAA, 0x20, 0x15, 0x4C, 0x0A,
-    0x17, 0x5E, 0xCA, 0x35, 0xC1, 0x85, 0x9B, 0x71, 0x71, 0xCD, 0x85, 0x97, 0xE9, 0x45, 0xDE, 0xE8,
-    0x0B, 0x9F, 0x40, 0x4D, 0xE6, 0x62, 0x2C, 0xCD, 0x53, 0x95, 0x98, 0x71, 0x68, 0x11, 0x3A, 0x32,
-    0x1E, 0x12, 0x7D, 0x17, 0x1E, 0x12, 0x7D, 0xBB, 0x9A, 0x5A, 0x7F, 0xB3, 0x94, 0xFD, 0x7E, 0xBF,
-    0xA7, 0x33, 0xAC, 0xEB, 0xBA, 0x8A, 0x68, 0x55, 0xBC, 0x10, 0x63, 0x5C, 0x46, 0x0D, 0x81, 0x54,
-    0x2A, 0x8C, 0xFB, 0xE7, 0x5C, 0xEF, 0xB4, 0xEB, 0x54, 0x45, 0x91, 0x89, 0x19, 0x0B, 0xB7, 0x35,
-    0x82, 0x98, 0xB7, 0x5D, 0x19, 0xBE, 0xA7, 0xAF, 0x8F, 0xEA, 0x63, 0x9D, 0xCF, 0xA5, 0xFE, 0xD8,
-    0x4C, 0x50, 0xA6, 0x86, 0xDB, 0x85, 0x11, 0xC1, 0xCD, 0xCC, 0xDF, 0x7E, 0xD2, 0x4A, 0x62, 0xE6,
-    0xBF, 0xDD, 0xA8, 0xA1, 0x32, 0xE3, 0x19, 0xD9, 0x07, 0xFC, 0x46, 0xDF, 0x07, 0xD7, 0xD0, 0xA9,
-    0x77, 0xA9, 0x64, 0xA3, 0x5B, 0x9D, 0x38, 0xB8, 0x2E, 0x59, 0xAC, 0x16, 0x5B, 0xDA, 0x79, 0xA0,
-    0x5C, 0xA6, 0xDB, 0xA2, 0x3C, 0x2A, 0x0D, 0xC7, 0x7A, 0x2B, 0x37, 0x86, 0xAD, 0x1F, 0xCA, 0x66,
-    0x56, 0x2E, 0x0F, 0x87, 0x89, 0x53, 0x4F, 0x4B, 0xB7, 0xAE, 0x33, 0xFF, 0x60, 0xB3, 0xB4, 0xFA,
-    0x37, 0xD3, 0x20, 0x71, 0xF1, 0x7D, 0x10, 0x47, 0xF4, 0x75, 0xF5, 0x5F, 0x38, 0x92, 0xF1, 0x9B,
-    0x92, 0x97, 0xCA, 0x61, 0x49, 0xCA, 0xFD, 0xD4, 0xF0, 0x50, 0xF5, 0x50, 0xCA, 0x8E, 0x18, 0xC7,
-    0x9B, 0x0A, 0x3E, 0x72, 0x4A, 0xB8, 0x16, 0x7C, 0xCB, 0x2F, 0xA9, 0x08, 0xB7, 0x3E, 0x2A, 0xFD,
-    0xBA, 0xCE, 0xAD, 0xBA, 0xBC, 0x4B, 0x2E, 0x4B, 0xC6, 0x68, 0x3A, 0x9C, 0x10, 0x49, 0xB5, 0x68,
-    0xD2, 0xED, 0xF7, 0xB9, 0x8C, 0x75, 0x62, 0x88, 0x1A, 0xB2, 0xFA, 0x4E, 0x13, 0x39, 0x1C, 0x4C,
-    0x82, 0xBE, 0x83, 0x8F, 0xEE, 0xE8, 0x54, 0x7A, 0x1D, 0x7E, 0x4B, 0xA2, 0x03, 0xDC, 0xEE, 0xB4,
-    0xF3, 0x93, 0xD9, 0x9F, 0xE5, 0xB7, 0x24, 0x9C, 0x4B, 0xC9, 0x69, 0x18, 0x32, 0x5B, 0x85, 0x19,
-    0xB1, 0xE8, 0x59, 0x88, 0x7A, 0x62, 0xD5, 0x74, 0x2D, 0x06, 0x3C, 0x28, 0xBD, 0x37, 0xA2, 0xEF,
-    0x4D, 0x47, 0xF2, 0xEA, 0x88, 0x7F, 0xE2, 0xB8, 0xA3, 0x9F, 0x9C, 0xF5, 0x90, 0xF9, 0x51, 0xCA,
-    0xB5, 0x42, 0x20, 0x71, 0x9D, 0x44, 0x74, 0x6D, 0x27, 0x8B, 0x12, 0xC3, 0x32, 0xC3, 0x0A, 0x65,
-    0x9D, 0x4A, 0xD9, 0xD5, 0xB1, 0x61, 0x91, 0x61, 0x30, 0x48, 0x32, 0xB8, 0x17, 0x6F, 0x71, 0x0A,
-    0x65, 0x56, 0xA5, 0x4C, 0xA6, 0x86, 0x45, 0x86, 0x85, 0xD7, 0x94, 0xF9, 0xBF, 0x57, 0xE6, 0xFE,
-    0x47, 0x99, 0xFD, 0xB9, 0x32, 0xA9, 0x0D, 0x1B, 0x18, 0x16, 0x1A, 0xE6, 0x83, 0x35, 0xF1, 0x46,
-    0x99, 0x6B, 0x18, 0x63, 0x02, 0xA8, 0x2A, 0x82, 0xB1, 0x96, 0x3F, 0xCB, 0xBB, 0x4D, 0x88, 0x8A,
-    0x55, 0x06, 0xD7, 0xC8, 0xE0, 0x1A, 0x19, 0xEC, 0x44, 0x65, 0xC0, 0x62, 0x55, 0xCA, 0x54, 0x06,
-    0x3B, 0x51, 0x19, 0xDC, 0x54, 0x65, 0x00, 0xA3, 0x0C, 0x6E, 0xAA, 0x32, 0x80, 0x51, 0x06, 0x30,
-    0xCA, 0x40, 0x16, 0x19, 0x06, 0x19, 0xC8, 0x20, 0x03, 0x19, 0x64, 0x20, 0x83, 0x0C, 0x64, 0x90,
-    0x41, 0xD9, 0xC0, 0xB0, 0xD0, 0x30, 0x1F, 0xCC, 0x4C, 0xFE, 0x31, 0x2C, 0x50, 0xE6, 0x1A, 0x89,
-    0xDC, 0xA3, 0x46, 0x12, 0x52, 0x4F, 0xBF, 0xF1, 0x54, 0x70, 0x3B, 0x39, 0x99, 0x7B, 0x6E, 0x05,
-    0x95, 0x2C, 0x27, 0x23, 0x24, 0x40, 0x37, 0x9D, 0x1C, 0x6C, 0xA6, 0xA0, 0xB8, 0xCF, 0x4D, 0xF7,
-    0xE1, 0x82, 0x6E, 0x3A, 0x56, 0x3A, 0x7A, 0x02, 0x3A, 0x9F, 0xDE, 0x49, 0x6A, 0xE6, 0xC3, 0xF0,
-    0x8C, 0xAC, 0xAB, 0x1F, 0xC3, 0x80, 0x56, 0x98, 0x86, 0x3A, 0x36, 0x7C, 0x26, 0x78, 0x39, 0xA5,
-    0x1C, 0x9C, 0xEC, 0xF4, 0x74, 0x7A, 0x52, 0xFF, 0xE2, 0x67, 0x0E, 0xC5, 0x73, 0x3E, 0xE5, 0x00,
-    0x7F, 0xE0, 0xFA, 0xFD, 0x12, 0x63, 0x05, 0x1C, 0x36, 0xD2, 0x15, 0xA2, 0xFB, 0x8D, 0x68, 0xF2,
-    0x15, 0x7E, 0xE1, 0x90, 0x23, 0x44, 0xD8, 0xFA, 0x88, 0x59, 0xEF, 0x58, 0xDC, 0x07, 0xC3, 0x09,
-    0x57, 0xDF, 0x8F, 0x11, 0xCC, 0xFC, 0x34, 0xA4, 0x45, 0x74, 0x99, 0xE6, 0x91, 0x85, 0xED, 0x62,
-    0x4A, 0x17, 0x5D, 0x42, 0xF0, 0x70, 0xD3, 0x75, 0x5C, 0x31, 0x06, 0x62, 0x98, 0x10, 0x23, 0x37,
-    0xF1, 0x44, 0xF6, 0x0E, 0x30, 0xE9, 0x63, 0xF1, 0x76, 0x07, 0xB1, 0xB1, 0x22, 0xCF, 0x9C, 0xD6,
-    0x0D, 0x62, 0x84, 0x34, 0x38, 0xBC, 0x91, 0x46, 0xF8, 0x7B, 0xA4, 0xA7, 0x8F, 0x33, 0x48, 0x77,
-    0x64, 0x80, 0xD0, 0xFD, 0x79, 0xEA, 0xD5, 0xEF, 0xA4, 0x90, 0x13, 0x02, 0xF5, 0x46, 0xC8, 0x7E,
-    0x41, 0xEC, 0x1D, 0x8B, 0x33, 0x6D, 0x04, 0x0C, 0xEB, 0x04, 0x87, 0xA5, 0x41, 0xF0, 0x1B, 0x1D,
-    0x61, 0x1D, 0x47, 0x75, 0xB2, 0x2A, 0x2B, 0xEB, 0x56, 0xE9, 0x7F, 0x92, 0x39, 0x30, 0x80, 0xE3,
-    0x36, 0xDF, 0xBE, 0xD6, 0xB8, 0xF5, 0x59, 0x8F, 0x0B, 0xF8, 0x85, 0x66, 0x70, 0xE5, 0xFC, 0x4D,
-    0x83, 0x05, 0x57, 0x4A, 0xF3, 0xD0, 0xA5, 0x76, 0x0D, 0x3C, 0x22, 0x07, 0x64, 0xE1, 0x98, 0xE8,
-    0x2C, 0x23, 0x38, 0x2B, 0x14, 0x53, 0x29, 0x34, 0x53, 0xA4, 0xA5, 0x99, 0x50, 0xF1, 0xD7, 0xD7,
-    0x11, 0xFD, 0x96, 0xF7, 0xED, 0x28, 0x20, 0x53, 0x5C, 0xA7, 0x70, 0xCC, 0xA0, 0x31, 0x05, 0x63,
-    0x06, 0x8B, 0xAD, 0x9A, 0xCC, 0xA3, 0x59, 0x67, 0x84, 0x3C, 0xC0, 0x6C, 0xC3, 0x4C, 0xD3, 0xC2,
-    0xA7, 0xB0, 0xE4, 0xB2, 0xC6, 0xDE, 0x67, 0x9B, 0x19, 0x53, 0x1A, 0x33, 0x03, 0x11, 0x19, 0x11,
-    0xD8, 0xC9, 0x93, 0x9F, 0x11, 0x8B, 0x11, 0x8A, 0x11, 0x89, 0x29, 0x10, 0x23, 0x0E, 0xE3, 0x38,
-    0x3D, 0x01, 0xA9, 0x68, 0x96, 0x3A, 0x27, 0x5F, 0xED, 0x4A, 0x03, 0x66, 0x6B, 0x75, 0x04, 0x67,
-    0x8A, 0xC7, 0x9E, 0x9C, 0x28, 0x1A, 0x8B, 0x98, 0xBB, 0x42, 0x62, 0x31, 0xFF, 0x00, 0xF6, 0x6D,
-    0x90, 0x98, 0x01, 0x62, 0x3D, 0x5A, 0x19, 0x4D, 0x0F, 0xE1, 0xA0, 0xA0, 0xE9, 0x41, 0xD8, 0x68,
-    0x6E, 0x7A, 0xC0, 0x64, 0xBB, 0x74, 0xAB, 0xB3, 0x9D, 0x6E, 0x4E, 0x1C, 0x46, 0x18, 0x46, 0x14,
-    0xA6, 0x20, 0x8C, 0x36, 0xF1, 0xFA, 0x90, 0x28, 0x94, 0xEB, 0xDA, 0xEF, 0xB7, 0xD8, 0xEA, 0x87,
-    0xCB, 0x94, 0x93, 0x48, 0x46, 0x49, 0x0B, 0xD0, 0xCE, 0x59, 0x74, 0xAB, 0xBF, 0xC1, 0x2C, 0x2E,
-    0xF6, 0xF0, 0x77, 0xE6, 0xF5, 0xF1, 0xCA, 0x4C, 0x18, 0x5E, 0x2F, 0x4C, 0x05, 0xF2, 0x02, 0xDF,
-    0x18, 0xC6, 0x5A, 0x15, 0x34, 0x09, 0x5B, 0xC3, 0xE2, 0xF3, 0xA1, 0x07, 0x91, 0x0D, 0x13, 0xE5,
-    0x18, 0xC5, 0x38, 0x8F, 0xEF, 0x3F, 0x45, 0x5D, 0x14, 0x76, 0x46, 0x4F, 0x64, 0xF8, 0xDC, 0x6F,
-    0x02, 0xB1, 0x31, 0xFD, 0xE7, 0x43, 0x17, 0x2F, 0xC4, 0x97, 0x8D, 0xCC, 0x5F, 0x16, 0xC6, 0x15,
-    0x2E, 0xC7, 0x4F, 0x4F, 0x17, 0x3F, 0xD3, 0x22, 0x63, 0x06, 0x0E, 0x1C, 0x05, 0xB5, 0xB7, 0x9F,
-    0x1F, 0xFF, 0xE8, 0x35, 0xA1, 0x89, 0x09, 0x90, 0xC1, 0xCA, 0x7B, 0x7A, 0xBA, 0x58, 0xAE, 0x77,
-    0x51, 0x09, 0x4C, 0x51, 0x15, 0x4C, 0x1A, 0x64, 0x41, 0xF4, 0x40, 0x8D, 0x38, 0xF9, 0xA5, 0xFE,
-    0x2B, 0x05, 0xA2, 0x74, 0x31, 0x41, 0xDD, 0xB5, 0x85, 0xBF, 0x01, 0x61, 0x32, 0xCC, 0x18, 0xC8,
-    0x3E, 0x8C, 0x99, 0x19, 0x2D, 0xCE, 0x9A, 0x21, 0xEB, 0xCA, 0x70, 0x97, 0xF5, 0x04, 0x1E, 0xBA,
-    0xD4, 0x6F, 0xA3, 0xE9, 0x77, 0x18, 0x74, 0x23, 0x62, 0xB0, 0x75, 0x27, 0x65, 0xBE, 0x39, 0xEF,
-    0xDC, 0xCE, 0x28, 0xE3, 0xE0, 0x56, 0x7B, 0xF8, 0x5E, 0x13, 0x65, 0x56, 0xF5, 0x7B, 0xBD, 0x27,
-    0x5E, 0x5D, 0x58, 0x8E, 0x6F, 0x4B, 0xD6, 0xBC, 0x21, 0xE6, 0xE7, 0xD5, 0x56, 0x52, 0x43, 0x7A,
-    0xCF, 0x5C, 0x7A, 0xBF, 0x01, 0x62, 0x7E, 0x3C, 0x37, 0xEB, 0x85, 0x48, 0x6F, 0xD7, 0x8A, 0xA9,
-    0x1D, 0xC3, 0xF8, 0xDE, 0xF9, 0x0F, 0xEA, 0x41, 0x26, 0x20, 0xBF, 0x61, 0x7B, 0xF7, 0x98, 0x89,
-    0x42, 0x75, 0x2D, 0xE9, 0x18, 0x36, 0x32, 0xAC, 0x52, 0x86, 0xBC, 0x9D, 0xA8, 0x43, 0x2A, 0xF3,
-    0x52, 0x9F, 0x18, 0xC1, 0x4F, 0x94, 0x85, 0xE2, 0xDF, 0xEB, 0x6B, 0xD9, 0x9A, 0x68, 0x43, 0x43,
-    0xD9, 0xF1, 0x70, 0x2F, 0xD1, 0xC0, 0xCE, 0x07, 0xA0, 0x32, 0x32, 0xAD, 0x8A, 0x55, 0x1E, 0x3C,
-    0xA0, 0x1A, 0xC2, 0xDB, 0x23, 0x9D, 0x05, 0x44, 0xD3, 0x42, 0xD7, 0x36, 0xE5, 0x2E, 0x6A, 0xA9,
-    0xB6, 0x57, 0x31, 0xC9, 0xBD, 0x0A, 0x77, 0x4C, 0xE1, 0x84, 0xFE, 0xEE, 0xE4, 0x68, 0x0D, 0x4B,
-    0x10, 0x14, 0x1A, 0x97, 0x53, 0xA6, 0x0D, 0xAD, 0xA8, 0x97, 0x6E, 0xDE, 0xEB, 0x57, 0x78, 0x14,
-    0x45, 0x7E, 0x70, 0x78, 0xF3, 0xC1, 0xF0, 0x4E, 0xA4, 0x4A, 0x1B, 0x9D, 0xA2, 0x21, 0x4C, 0x60,
-    0x47, 0xC6, 0x95, 0xFC, 0x3C, 0x82, 0xE7, 0xD4, 0x85, 0x57, 0x27, 0x01, 0x2A, 0xB1, 0x95, 0xB9,
-    0x0D, 0x40, 0x61, 0x90, 0x86, 0x95, 0x6B, 0xBD, 0x7B, 0x23, 0x75, 0xAA, 0x16, 0xB1, 0xAB, 0xCC,
-    0xE1, 0x2C, 0x34, 0x75, 0x0D, 0xB1, 0xFA, 0xBD, 0x2E, 0x94, 0x5B, 0x34, 0x04, 0x2A, 0x8A, 0x0C,
-    0xB1, 0xDF, 0xFF, 0x02, 0x60, 0xA8, 0xAE, 0x31, 0xC1, 0xEB, 0x9F, 0xA1, 0xD4, 0xB6, 0x81, 0xAB,
-    0xE2, 0x65, 0x6D, 0xA8, 0x15, 0x58, 0x56, 0xF8, 0xB5, 0xF6, 0x54, 0x06, 0xD9, 0x2D, 0x61, 0x69,
-    0x2E, 0xFE, 0x7D, 0xD4, 0xFD, 0x21, 0x8B, 0x72, 0xAD, 0xC8, 0xBB, 0xB3, 0x1A, 0xFC, 0x21, 0xA2,
-    0x5F, 0xE8, 0x2D, 0x41, 0xEA, 0x95, 0xE2, 0x7D, 0xB1, 0x0F, 0xF0, 0x59, 0x57, 0x50, 0xC2, 0xA5,
-    0xB8, 0x6C, 0x2C, 0xD8, 0xA5, 0xFE, 0x5C, 0xA3, 0xCA, 0x42, 0x2E, 0xF6, 0x82, 0x9C, 0xDA, 0x4D,
-    0x10, 0x4D, 0x0E, 0xC5, 0x40, 0x1B, 0xF1, 0x18, 0xEE, 0xEC, 0x7F, 0xF3, 0x09, 0x2D, 0x44, 0xA3,
-    0x44, 0xE6, 0xD0, 0xFA, 0x94, 0x0E, 0xD6, 0x1A, 0x1D, 0xE4, 0x6D, 0x3C, 0xD6, 0x84, 0x7D, 0x52,
-    0x07, 0x4A, 0xE6, 0x3A, 0xB0, 0xAE, 0x1B, 0x1D, 0x84, 0x24, 0xB0, 0x69, 0xA2, 0x3D, 0x90, 0x47,
-    0xE8, 0xC0, 0x34, 0xA2, 0x9C, 0x3C, 0x30, 0xED, 0x27, 0xC5, 0x96, 0xD9, 0xBC, 0xDF, 0xB4, 0x99,
-    0xDD, 0xA2, 0x7A, 0xA8, 0x1D, 0x76, 0x2C, 0x28, 0x38, 0x35, 0x40, 0x55, 0x9C, 0x3C, 0xD9, 0x95,
-    0x20, 0xEE, 0x0C, 0x63, 0xA7, 0x04, 0xB6, 0x2C, 0xD9, 0x85, 0x40, 0xFC, 0x2B, 0x31, 0x7E, 0x69,
-    0x2A, 0x6F, 0xFA, 0xAA, 0x53, 0x40, 0x17, 0x19, 0xCD, 0x75, 0x19, 0xC0, 0x56, 0xBB, 0x29, 0x98,
-    0x5C, 0x6C, 0xF0, 0xA9, 0x84, 0x14, 0x53, 0x3B, 0x28, 0xB3, 0xBE, 0x60, 0xC7, 0xF4, 0xAB, 0x6C,
-    0xB6, 0x6B, 0xDC, 0x1C, 0x24, 0x60, 0x6B, 0x4A, 0xDB, 0x52, 0xD3, 0x26, 0x08, 0x74, 0xA8, 0x93,
-    0x0E, 0xD5, 0xD1, 0xD9, 0xD7, 0x40, 0xC3, 0xB8, 0xFA, 0x57, 0xC6, 0x09, 0x56, 0xF9, 0x1D, 0x5B,
-    0x3B, 0x56, 0x47, 0xD2, 0x3E, 0x16, 0xB0, 0xD3, 0xE3, 0x71, 0x28, 0xA4, 0x10, 0x6D, 0x4F, 0x76,
-    0x68, 0x90, 0xAB, 0xB4, 0xC0, 0x75, 0x35, 0xE5, 0x4F, 0x18, 0xE0, 0xB5, 0x78, 0x3C, 0x7E, 0xB8,
-    0x0F, 0xAA, 0xBD, 0x82, 0xC7, 0x13, 0xE4, 0xE5, 0x11, 0xDF, 0x34, 0xE2, 0x04, 0x47, 0x1A, 0xA5,
-    0xD4, 0xF0, 0x39, 0xC1, 0x11, 0xE3, 0xDA, 0x3E, 0xC9, 0x84, 0x43, 0x4F, 0xC2, 0xB8, 0xFD, 0xD6,
-    0x44, 0xB3, 0x8A, 0x8F, 0x8D, 0xA5, 0x1D, 0xC0, 0x54, 0xE6, 0xE7, 0x59, 0x68, 0x04, 0x7C, 0xDD,
-    0x55, 0x92, 0xBB, 0xB3, 0xA6, 0xC9, 0x58, 0xAD, 0x2D, 0x6D, 0x5A, 0x90, 0x4F, 0x5A, 0x6A, 0x30,
-    0x76, 0x33, 0x5D, 0xFB, 0xCD, 0xDB, 0x7C, 0x78, 0x3D, 0x22, 0x8B, 0xE6, 0x74, 0x9D, 0x83, 0x4F,
-    0xB2, 0x34, 0x4B, 0x93, 0xE7, 0x28, 0x3B, 0xE5, 0xFC, 0xD1, 0x4C, 0x01, 0x6F, 0x91, 0x6C, 0xAB,
-    0xEC, 0x99, 0x91, 0x9D, 0xA1, 0x51, 0x03, 0x63, 0x1B, 0x16, 0x9F, 0xA2, 0x2E, 0x1E, 0x57, 0xFD,
-    0x40, 0x1B, 0x19, 0xCE, 0xFC, 0xCA, 0x70, 0x0F, 0x03, 0x44, 0x18, 0xE0, 0xA8, 0x81, 0xC8, 0xA9,
-    0x09, 0x0B, 0x53, 0xC6, 0x8F, 0x5D, 0x93, 0x78, 0xFA, 0x93, 0xD4, 0xB4, 0xBB, 0xD8, 0x22, 0xA4,
-    0x79, 0xF3, 0x64, 0xC3, 0xD1, 0x29, 0x0E, 0x24, 0xC8, 0x10, 0xAB, 0xE3, 0x4D, 0x8A, 0xBF, 0x6A,
-    0xC2, 0x92, 0x07, 0xFC, 0xA5, 0x41, 0x89, 0x31, 0x89, 0x21, 0xA9, 0x79, 0xE7, 0x95, 0xE1, 0x30,
-    0x66, 0x43, 0x14, 0xEF, 0x8C, 0x4D, 0xC4, 0xA9, 0xE6, 0xEF, 0x0C, 0x8D, 0xF5, 0x5B, 0x08, 0x59,
-    0x36, 0x96, 0xCB, 0xBA, 0x4E, 0xE3, 0x06, 0x7A, 0xD3, 0x74, 0xE9, 0xB6, 0x70, 0x29, 0x6B, 0x04,
-    0x4E, 0x99, 0x67, 0x3F, 0xB2, 0x26, 0xD0, 0x7D, 0x25, 0x6B, 0x98, 0xE7, 0x62, 0x0A, 0xF6, 0x13,
-    0x07, 0xFC, 0x68, 0x82, 0x18, 0x97, 0xFC, 0x7F, 0xF7, 0xC9, 0x75, 0xF2, 0xD2, 0xF4, 0xA1, 0xF5,
-    0xD6, 0xBD, 0xD2, 0x84, 0x44, 0x9D, 0xF9, 0x73, 0xD5, 0x17, 0x6F, 0x7E, 0xCA, 0x6F, 0xC4, 0x9F,
-    0x93, 0xBE, 0xB8, 0x29, 0x33, 0xCD, 0x76, 0x8F, 0xEE, 0x73, 0x69, 0x53, 0x4E, 0x23, 0xE1, 0x85,
-    0x67, 0x92, 0x8E, 0x4D, 0x8B, 0x69, 0x7F, 0xEE, 0x63, 0xDE, 0xDC, 0x0F, 0x9F, 0x66, 0x3A, 0xEE,
-    0x48, 0x63, 0xB5, 0x8F, 0xA6, 0x77, 0x94, 0x56, 0x27, 0x69, 0xC4, 0x2D, 0x9D, 0x86, 0x76, 0xFB,
-    0xFD, 0x87, 0xBE, 0xFD, 0x5A, 0x3A, 0x55, 0xBA, 0xE3, 0x70, 0x96, 0x28, 0x09, 0x68, 0x80, 0x66,
-    0xFB, 0xCD, 0x54, 0x0B, 0x57, 0xBD, 0x3A, 0xBE, 0x3A, 0xC0, 0xE7, 0x87, 0x6E, 0x85, 0xB0, 0x37,
-    0x45, 0x84, 0x63, 0x90, 0x67, 0x8C, 0xD7, 0xB3, 0x63, 0xCE, 0x6D, 0x9C, 0xA3, 0x8E, 0x1A, 0x38,
-    0xF7, 0x12, 0x1C, 0x18, 0xB8, 0xCF, 0xD6, 0x72, 0xDC, 0x81, 0xBD, 0x76, 0x80, 0xCC, 0xBA, 0x13,
-    0x44, 0x80, 0x23, 0x13, 0xBF, 0xBB, 0xCD, 0xDE, 0xC2, 0xD7, 0x9D, 0x46, 0xB7, 0xDA, 0x34, 0xD6,
-    0x96, 0xB8, 0x5D, 0xCC, 0xD2, 0x79, 0x6B, 0x00, 0xDA, 0x05, 0xD7, 0x1E, 0xB8, 0x76, 0xC0, 0xB5,
-    0xFF, 0xAD, 0xDD, 0x6F, 0xED, 0x7D, 0x6B, 0xE7, 0x5B, 0xFB, 0xDE, 0xDA, 0xF5, 0xD6, 0x9E, 0xB7,
-    0x76, 0xBC, 0xB5, 0xDF, 0xAD, 0xDD, 0x6E, 0xED, 0x75, 0x6B, 0xA7, 0x5B, 0xFB, 0xDC, 0xDA, 0xE5,
-    0xD6, 0x1E, 0xB7, 0x76, 0xB8, 0xB5, 0xBF, 0xAD, 0xDD, 0x6D, 0xA6, 0x41, 0xB5, 0xC4, 0x71, 0x5B,
-    0xDA, 0x26, 0x33, 0x34, 0xC4, 0x16, 0x35, 0x1B, 0xD4, 0x6C, 0x4F, 0xB3, 0x39, 0xCD, 0xD6, 0xF4,
-    0xF8, 0xCC, 0xE5, 0x2D, 0x63, 0x30, 0x71, 0xDD, 0xBC, 0xDD, 0x23, 0x1F, 0xB4, 0x95, 0x97, 0xC3,
-    0x80, 0xED, 0x31, 0x15, 0x5D, 0x74, 0x58, 0x19, 0xB8, 0x71, 0xDB, 0x76, 0xD6, 0x1A, 0xEC, 0x5F,
-    0xD4, 0xCC, 0xBC, 0x06, 0x63, 0x8F, 0x70, 0x5D, 0x6B, 0x30, 0x6A, 0x6A, 0x24, 0x05, 0xED, 0xA9,
-    0xA2, 0x41, 0x6D, 0xB1, 0xFC, 0xD2, 0x1A, 0xAC, 0x16, 0xEF, 0x5E, 0x7F, 0x33, 0x46, 0xAC, 0xD3,
-    0xF2, 0xCB, 0x4B, 0xB5, 0xFC, 0xDA, 0x9E, 0x95, 0x5F, 0x8A, 0xAD, 0x58, 0xC3, 0xFB, 0x4D, 0x17,
-    0x7E, 0x0D, 0x7C, 0x07, 0x23, 0x15, 0x3F, 0x16, 0xC9, 0x5F, 0x04, 0xFE, 0x00, 0x00, 0x89, 0xF2,
-    0x05, 0x97, 0x62, 0x33, 0x30, 0xD7, 0xEC, 0x09, 0x98, 0x38, 0x64, 0xDA, 0x1B, 0x5A, 0xF8, 0xC9,
-    0xA9, 0x42, 0xFC, 0x79, 0xAC, 0xCF, 0xDA, 0xFE, 0xF3, 0x8E, 0x52, 0xDD, 0x15, 0x30, 0xF6, 0x6A,
-    0x36, 0x14, 0x2C, 0x39, 0xF7, 0x8A, 0x6D, 0xA3, 0x6D, 0x14, 0xBB, 0xB3, 0x22, 0x6D, 0xFD, 0x84,
-    0xAA, 0x57, 0xF8, 0x7F, 0x0C, 0xA5, 0x86, 0x38, 0x04, 0xBB, 0x01, 0x21, 0x9C, 0x4F, 0x08, 0x17,
-    0x12, 0xC2, 0x6D, 0x11, 0xC2, 0x95, 0xF0, 0x6E, 0x27, 0x87, 0x6B, 0x7B, 0x29, 0x30, 0x1B, 0x02,
-    0x3F, 0x63, 0x3E, 0x08, 0x50, 0x70, 0x17, 0x46, 0x15, 0x45, 0x58, 0xA0, 0x6E, 0x88, 0x47, 0x76,
-    0x82, 0x9B, 0xD4, 0xF7, 0x11, 0x21, 0x1C, 0x9C, 0xAF, 0x70, 0x08, 0xE1, 0xB8, 0x44, 0xB1, 0xFF,
-    0x2E, 0xC2, 0x8F, 0x6D, 0x5E, 0x79, 0xA9, 0xD1, 0xCE, 0xD4, 0x68, 0x86, 0x7A, 0x69, 0xB5, 0x12,
-    0x1E, 0x94, 0x10, 0xB6, 0x30, 0x80, 0xCD, 0x47, 0x54, 0x0E, 0x11, 0x3C, 0xB7, 0xAA, 0x6D, 0x29,
-    0x47, 0xDB, 0xF0, 0x91, 0x6D, 0xD8, 0xCE, 0x76, 0x80, 0xA0, 0x02, 0xBF, 0x8D, 0x10, 0xAA, 0x82,
-    0x02, 0xEB, 0x99, 0x7B, 0x39, 0x4B, 0xB7, 0x10, 0x80, 0x8D, 0x2D, 0x1B, 0x2B, 0xDE, 0xE0, 0x42,
-    0x8D, 0x74, 0xDF, 0x53, 0x9B, 0x61, 0xB0, 0x88, 0xC0, 0xD1, 0x97, 0xC4, 0xE7, 0xDC, 0xC3, 0x58,
-    0x05, 0x28, 0x8D, 0x78, 0xCB, 0x35, 0xE4, 0xF5, 0xB4, 0x10, 0x8B, 0xDF, 0xAD, 0x5C, 0x58, 0x9C,
-    0xC3, 0xE8, 0x76, 0xAD, 0x4F, 0x43, 0x0D, 0x7F, 0x83, 0xF9, 0xBE, 0x28, 0x79, 0xB3, 0x3B, 0x75,
-    0xAE, 0x62, 0x6A, 0xAB, 0x13, 0xEB, 0xEB, 0x1C, 0x22, 0x8A, 0x25, 0x17, 0xA1, 0xE8, 0xC5, 0x89,
-    0xB8, 0x8A, 0xD8, 0xBF, 0x83, 0x47, 0x03, 0xC2, 0xBA, 0xB7, 0x0B, 0xB1, 0xB3, 0x0F, 0x67, 0xCD,
-    0x2F, 0x78, 0x2A, 0x31, 0x6F, 0xCC, 0x2D, 0xE5, 0x47, 0xE5, 0x0E, 0x7C, 0xAF, 0x67, 0xB7, 0xBF,
-    0xF1, 0xC8, 0x7B, 0xF8, 0x7C, 0x3B, 0x96, 0x2E, 0x19, 0xA6, 0xE8, 0xBF, 0x93, 0x8B, 0x93, 0x02,
-    0xCF, 0x14, 0x57, 0xE7, 0x4B, 0xB6, 0x79, 0xA0, 0x98, 0xDD, 0x3B, 0xD8, 0x4C, 0x82, 0x18, 0xCE,
-    0x40, 0xAF, 0x80, 0xAD, 0xED, 0xF4, 0x5F, 0x29, 0xE8, 0x3E, 0x83, 0xE1, 0xF0, 0xF6, 0x76, 0xFB,
-    0xDE, 0x26, 0x90, 0xFB, 0xB9, 0xC5, 0x1E, 0x07, 0x0B, 0x99, 0x44, 0xF3, 0xC4, 0xE5, 0x58, 0xDB,
-    0x8E, 0xCE, 0x03, 0x48, 0x1D, 0x7F, 0x6F, 0xA6, 0xAB, 0xA7, 0x21, 0x8B, 0x5C, 0x4E, 0x74, 0x5D,
-    0xEC, 0xC3, 0x71, 0xB3, 0x2E, 0x4B, 0x0B, 0x93, 0x03, 0xEB, 0xD2, 0xF5, 0x53, 0xAC, 0x8A, 0xF7,
-    0x71, 0x61, 0x67, 0x6F, 0x49, 0xEF, 0x82, 0xA2, 0x30, 0xC4, 0x2A, 0xFE, 0x27, 0xD1, 0x37, 0x3D,
-    0x50, 0x95, 0x38, 0x75, 0xB5, 0xB1, 0x24, 0xDB, 0x41, 0x12, 0xBA, 0xA9, 0xF7, 0x76, 0x6E, 0x67,
-    0x77, 0x9B, 0x2E, 0xF1, 0x65, 0xCD, 0xB3, 0x67, 0x3E, 0xE0, 0x12, 0x01, 0xD4, 0xF8, 0x7E, 0xFA,
-    0xA6, 0x95, 0xAD, 0xA8, 0xC7, 0x3F, 0xE1, 0x76, 0xA5, 0x0E, 0x28, 0xDD, 0x37, 0xD2, 0x0F, 0xEC,
-    0x54, 0xF7, 0xE0, 0xC4, 0xBA, 0xCD, 0xC0, 0x75, 0xF6, 0x43, 0x36, 0x18, 0xF2, 0x46, 0x54, 0x63,
-    0x97, 0x5E, 0xE0, 0x5F, 0x63, 0xA9, 0x95, 0x16, 0x32, 0x6B, 0x84, 0x9F, 0xF3, 0x5E, 0xE5, 0x12,
-    0x16, 0x30, 0x80, 0x81, 0x63, 0xED, 0xC4, 0x66, 0x3F, 0xFE, 0x2E, 0xCA, 0xEA, 0x95, 0xA5, 0xC5,
-    0xED, 0x55, 0xCA, 0xEB, 0x31, 0xAD, 0x01, 0xD1, 0xC8, 0xFB, 0x3B, 0x53, 0x19, 0x2B, 0xF6, 0x0B,
-    0xB3, 0xCC, 0x7D, 0xAE, 0xB2, 0xEA, 0xBF, 0x4A, 0x0C, 0x10, 0xA7, 0xBE, 0xD8, 0x13, 0x3B, 0x75,
-    0xA1, 0x72, 0x6B, 0x61, 0x72, 0x32, 0x38, 0x31, 0xBE, 0x07, 0x58, 0x50, 0xF7, 0x63, 0xC6, 0xF7,
-    0xB7, 0xC4, 0x78, 0x02, 0x9D, 0xF5, 0x8E, 0x71, 0xD6, 0xEB, 0x93, 0x94, 0xFD, 0x2C, 0x03, 0x80,
-    0xED, 0x13, 0x27, 0xF7, 0x23, 0x82, 0xD4, 0x38, 0x35, 0xC0, 0xF0, 0xF5, 0x52, 0x7B, 0x66, 0x1D,
-    0xE4, 0x56, 0x80, 0xD1, 0xD8, 0x80, 0x65, 0xB7, 0x79, 0x4E, 0xAB, 0xC4, 0x71, 0xE3, 0x74, 0x3F,
-    0x3D, 0xE5, 0x74, 0xCB, 0x2F, 0x8D, 0xBD, 0x77, 0x8F, 0xBC, 0x4F, 0x7F, 0x0D, 0x34, 0xE1, 0x15,
-    0xAC, 0x7D, 0x11, 0xBE, 0x1E, 0x73, 0x98, 0x68, 0x8D, 0x08, 0xF4, 0xCF, 0x91, 0xB8, 0xF1, 0x77,
-    0x4F, 0x44, 0xA0, 0xC5, 0x4F, 0xF8, 0xAB, 0xCE, 0x78, 0x6B, 0x2D, 0xFB, 0x70, 0x92, 0xED, 0x1F,
-    0xC6, 0xC0, 0xFE, 0x13, 0x31, 0xBD, 0xB4, 0xC7, 0x1D, 0x4B, 0x2F, 0x21, 0x9B, 0xB9, 0x7F, 0xAC,
-    0x98, 0x6C, 0x34, 0xA7, 0xAF, 0x6B, 0x01, 0x82, 0xA1, 0x2E, 0x3C, 0x9B, 0xBD, 0x2D, 0xAE, 0x39,
-    0xBD, 0x18, 0xAB, 0x60, 0xFC, 0x27, 0x9B, 0xAF, 0xF9, 0x42, 0xF6, 0xF6, 0x34, 0xA7, 0x87, 0x04,
-    0xF7, 0x3B, 0x6F, 0xE0, 0x9D, 0x88, 0x3A, 0xCD, 0xDE, 0xFF, 0x33, 0xD8, 0xDF, 0x3D, 0x65, 0x2A,
-    0xF3, 0x64, 0xB5, 0x98, 0xBD, 0x6D, 0x42, 0xE0, 0x63, 0x56, 0xD5, 0x69, 0x90, 0xDD, 0x48, 0x22,
-    0x99, 0x17, 0x81, 0xEA, 0xE5, 0x84, 0x6D, 0x79, 0xF3, 0x5F, 0x42, 0x93, 0xB2, 0xF9, 0xFF, 0x9B,
-    0x41, 0x6A, 0x8A, 0x24, 0xB3, 0xBF, 0x67, 0x4E, 0x2F, 0xFB, 0x48, 0x50, 0x70, 0xC1, 0x2C, 0x43,
-    0xCE, 0xBE, 0x6D, 0x07, 0x07, 0x4D, 0x81, 0xC6, 0x01, 0x5F, 0x34, 0xB5, 0xAB, 0x5D, 0xDF, 0x0E,
-    0xEA, 0x69, 0xF4, 0xD2, 0x68, 0x4B, 0x35, 0x09, 0x10, 0x0A, 0xE8, 0xEC, 0x1D, 0xC7, 0xEC, 0x46,
-    0xB9, 0x53, 0xB5, 0x46, 0xD6, 0xAF, 0xB7, 0x64, 0x3C, 0xA8, 0xAB, 0x10, 0xC9, 0xCE, 0x20, 0xA9,
-    0xAE, 0x0E, 0xB2, 0xA5, 0xF5, 0x58, 0x8F, 0xE1, 0xA5, 0xE6, 0xD9, 0xBF, 0x71, 0xBF, 0x3F, 0x6B,
-    0x9A, 0x3D, 0xE9, 0x39, 0xEB, 0x63, 0x14, 0xCD, 0x67, 0xA9, 0xE9, 0x3C, 0x9A, 0x98, 0x6C, 0xB1,
-    0xA6, 0xE5, 0x11, 0x3C, 0xD8, 0x05, 0xBE, 0x5F, 0xBB, 0xDF, 0x03, 0x1A, 0x7A, 0xD4, 0xE1, 0x68,
-    0x23, 0xCC, 0xAE, 0x0B, 0x4A, 0x65, 0x7C, 0x24, 0x54, 0x19, 0x10, 0x83, 0xDF, 0x6C, 0x37, 0x71,
-    0xD8, 0x4E, 0x20, 0x44, 0xD8, 0x8F, 0xC3, 0xF4, 0x07, 0x6C, 0x3B, 0x9D, 0xD2, 0x28, 0x93, 0x14,
-    0x20, 0xDB, 0xDA, 0x11, 0x86, 0xC1, 0x79, 0xA8, 0xF0, 0x2D, 0x33, 0xBD, 0x0E, 0xFB, 0xC4, 0xC9,
-    0xBF, 0xDD, 0xA6, 0x6C, 0x1D, 0x24, 0xE2, 0x1E, 0xEB, 0x4A, 0x6D, 0x62, 0xC5, 0xD8, 0x1A, 0x3B,
-    0x9C, 0x17, 0x3A, 0x88, 0x02, 0x47, 0x72, 0x31, 0x9E, 0x34, 0x5D, 0x5C, 0xBF, 0xD9, 0xC6, 0x63,
-    0x46, 0xC4, 0x22, 0x50, 0xF5, 0x5C, 0xE1, 0xA3, 0x7D, 0x44, 0xE7, 0xE0, 0x34, 0x54, 0xD4, 0x6B,
-    0x26, 0x86, 0x81, 0x29, 0x76, 0x37, 0x4B, 0x59, 0x83, 0x79, 0x72, 0x13, 0xE4, 0x27, 0xA6, 0x3A,
-    0x86, 0x40, 0x1F, 0xB2, 0xB2, 0x09, 0xF5, 0x49, 0x05, 0xBA, 0xA7, 0x76, 0x2C, 0xD9, 0xBD, 0x50,
-    0x63, 0x4F, 0xCF, 0x40, 0x22, 0x16, 0x92, 0x4A, 0x00, 0xA4, 0x6E, 0xA6, 0x67, 0x7D, 0x4C, 0x89,
-    0xFE, 0xCB, 0xEC, 0x02, 0x76, 0x28, 0xD6, 0xB8, 0xCB, 0xC0, 0x1C, 0x36, 0xB9, 0xBF, 0x99, 0xCA,
-    0x24, 0x46, 0x44, 0x67, 0x27, 0x41, 0xC6, 0x67, 0xF9, 0xA7, 0xE6, 0xAF, 0x90, 0xFF, 0x02, 0x85,
-    0x54, 0xBF, 0x6F, 0x1B, 0x37, 0x14, 0xFE, 0x4E, 0x27, 0x55, 0x69, 0x2F, 0xF6, 0x09, 0xAD, 0xDC,
-    0x18, 0x85, 0xED, 0xF3, 0x90, 0x02, 0xAE, 0xE2, 0xF8, 0x6E, 0xD0, 0x60, 0x03, 0x3A, 0x91, 0x99,
-    0x3B, 0x54, 0x83, 0xDD, 0xA1, 0x43, 0xA1, 0x21, 0x43, 0x61, 0x34, 0xAD, 0x06, 0x0D, 0x76, 0x21,
-    0xEB, 0x0E, 0xC9, 0x3F, 0xA0, 0x3F, 0xE1, 0x0A, 0xB4, 0x40, 0x22, 0x0F, 0xD1, 0x90, 0x00, 0x31,
-    0x60, 0x44, 0x9C, 0x33, 0xB1, 0x68, 0x81, 0xAC, 0x1C, 0x53, 0x78, 0xB9, 0xE1, 0x06, 0xA1, 0x90,
-    0x7D, 0x7D, 0x14, 0x65, 0x37, 0x4E, 0x80, 0x94, 0x8F, 0xC7, 0x23, 0xF9, 0x7E, 0xF0, 0xF1, 0xBD,
-    0xEF, 0x71, 0x09, 0x0C, 0x6E, 0x5C, 0x96, 0x48, 0x51, 0xB1, 0x5A, 0x76, 0xEA, 0x0A, 0x0F, 0x0D,
-    0x54, 0x80, 0x16, 0xEC, 0x29, 0x9C, 0x0B, 0x78, 0x6E, 0xDC, 0xB3, 0x55, 0x0B, 0x2D, 0x8B, 0x17,
-    0xDD, 0x6C, 0xA5, 0x99, 0x4F, 0xEB, 0x5E, 0x5A, 0x01, 0x67, 0xB9, 0x8C, 0x72, 0xB9, 0xB4, 0xC7,
-    0x6B, 0xC3, 0x61, 0xCC, 0xF2, 0x5C, 0xE8, 0x7F, 0x1B, 0x83, 0x6E, 0x41, 0xB2, 0x5C, 0xB8, 0x17,
-    0xDA, 0x42, 0xF5, 0xE8, 0x68, 0xA3, 0x68, 0x21, 0x2C, 0x8B, 0xA6, 0x23, 0x96, 0x0B, 0xFC, 0x02,
-    0x4F, 0x45, 0x41, 0xDA, 0xD2, 0x8F, 0x1B, 0xD8, 0x80, 0xA3, 0xB6, 0x4E, 0xB7, 0x37, 0xEB, 0x2B,
-    0x8D, 0x86, 0x97, 0x59, 0xDC, 0xE2, 0xBB, 0xCE, 0x1F, 0x99, 0xFB, 0x48, 0x6D, 0x39, 0xF1, 0x81,
-    0x8B, 0x4A, 0x91, 0xF4, 0x5B, 0x3D, 0x92, 0x75, 0x63, 0xF2, 0x82, 0x7C, 0xA1, 0x35, 0x1A, 0xD4,
-    0x36, 0x80, 0xD3, 0xA6, 0xA1, 0x1F, 0xBE, 0x5A, 0x2A, 0x71, 0xDF, 0x91, 0xEE, 0xA3, 0xD4, 0x96,
-    0x19, 0xD2, 0x86, 0x56, 0x4B, 0x60, 0x65, 0xBA, 0xB7, 0x93, 0x6B, 0xBE, 0x58, 0xBF, 0xC1, 0xCB,
-    0x79, 0xF3, 0x58, 0x74, 0x2D, 0x49, 0xEE, 0xDB, 0xA2, 0x2C, 0xDC, 0xD8, 0xE5, 0x3E, 0xDD, 0x9F,
-    0xA1, 0x0A, 0x47, 0xB8, 0xB4, 0xF6, 0xE0, 0x23, 0x9C, 0xDD, 0xBF, 0x49, 0xBB, 0x3E, 0x3C, 0xEE,
-    0x72, 0x27, 0xB6, 0x85, 0xC5, 0xE7, 0x7C, 0x92, 0xDF, 0x22, 0x7E, 0x15, 0xBB, 0x78, 0x49, 0x7C,
-    0x47, 0x14, 0x14, 0x45, 0xA6, 0xE5, 0x28, 0x37, 0x6E, 0xE2, 0x85, 0x76, 0x11, 0x96, 0xFA, 0x5C,
-    0x8D, 0xD5, 0xB7, 0xCA, 0x52, 0xE0, 0xC0, 0x33, 0x9C, 0xF0, 0xB1, 0x3A, 0x69, 0x3D, 0xD3, 0x31,
-    0xC5, 0x38, 0xDF, 0x7F, 0x0A, 0xF7, 0x8A, 0x60, 0xA7, 0x76, 0x5A, 0x96, 0xBE, 0xB8, 0x20, 0xAF,
-    0x4B, 0xCD, 0xEE, 0xA8, 0xDB, 0x2C, 0x15, 0xE8, 0x38, 0x5B, 0xDC, 0x79, 0xC3, 0xE8, 0xC6, 0xB5,
-    0xC7, 0x6C, 0xAA, 0x57, 0xB6, 0x20, 0x5D, 0xE8, 0x3F, 0x9B, 0xDE, 0x79, 0x63, 0x8B, 0x42, 0x5C,
-    0x7B, 0x1C, 0x9D, 0xEB, 0x3D, 0x2B, 0xBD, 0xA4, 0x5B, 0x29, 0x93, 0x8C, 0x0E, 0xCC, 0xAE, 0xE8,
-    0x9C, 0x47, 0xC2, 0x13, 0x08, 0x59, 0x88, 0xB7, 0x93, 0x70, 0x3D, 0xEC, 0x68, 0x86, 0xBD, 0x51,
-    0xCB, 0xC5, 0x1A, 0x3C, 0xA9, 0xCD, 0x1C, 0xAB, 0x9C, 0x5B, 0xE4, 0xDA, 0x5D, 0xBA, 0xE5, 0x01,
-    0x8E, 0x38, 0x93, 0x25, 0x6E, 0xC2, 0x5E, 0x1B, 0x3E, 0x66, 0xF9, 0xB4, 0x81, 0xC6, 0x36, 0x36,
-    0xA9, 0x57, 0x29, 0x08, 0x40, 0xA7, 0xB1, 0xB0, 0xF3, 0xB2, 0xE7, 0x9D, 0x65, 0x80, 0xC9, 0x97,
-    0xBA, 0x96, 0xAF, 0x4B, 0x10, 0xF9, 0x1E, 0x81, 0x48, 0x92, 0xC0, 0x3B, 0x00, 0x79, 0x27, 0x29,
-    0x04, 0x31, 0x2F, 0xDB, 0x7C, 0x1F, 0x62, 0x4B, 0x7B, 0x7B, 0x7C, 0x9C, 0xE7, 0x6A, 0x7F, 0x38,
-    0x1C, 0xE8, 0x5B, 0x5F, 0xC2, 0x4D, 0xCF, 0x35, 0x4F, 0xAF, 0xF5, 0x5F, 0x43, 0x74, 0xB2, 0xBA,
-    0x35, 0x9E, 0x6E, 0x3B, 0x19, 0xE9, 0xBF, 0x8D, 0x4C, 0x62, 0x1B, 0x23, 0xC6, 0xCC, 0xDC, 0x90,
-    0x23, 0x10, 0xC5, 0x85, 0x73, 0xF8, 0x92, 0x12, 0x8E, 0x22, 0x4C, 0xDB, 0x22, 0xA0, 0x01, 0x3D,
-    0x1D, 0x4B, 0x2A, 0x0B, 0xCA, 0x30, 0xC5, 0xBF, 0x2C, 0xE0, 0x72, 0x9D, 0xB2, 0xF7, 0x99, 0x52,
-    0x33, 0x9D, 0x4B, 0x66, 0x38, 0x63, 0xDE, 0xA7, 0xDB, 0x9D, 0xAE, 0x2E, 0xAE, 0x9E, 0xB6, 0x6E,
-    0x63, 0xD9, 0x04, 0x2C, 0xDC, 0xEB, 0x51, 0xFC, 0x96, 0xF6, 0x76, 0x67, 0x38, 0xB8, 0x78, 0xBE,
-    0xF7, 0xFD, 0x08, 0x8B, 0xD4, 0x69, 0xBE, 0x3F, 0x7C, 0x42, 0x9B, 0x14, 0xC5, 0x9D, 0xFE, 0x8F,
-    0x14, 0x51, 0x9A, 0x57, 0xF8, 0x73, 0xC5, 0x84, 0xCF, 0x23, 0x39, 0x52, 0xB4, 0xF4, 0x5F, 0x64,
-    0xBD, 0xBB, 0xEE, 0x4F, 0x13, 0x7C, 0xE8, 0xF6, 0x55, 0x44, 0x04, 0xD8, 0xB2, 0xB0, 0xA8, 0x94,
-    0xD1, 0xB2, 0xB3, 0xB2, 0x74, 0xE3, 0x90, 0xA6, 0xEF, 0x44, 0xB5, 0x06, 0x16, 0x97, 0x45, 0x39,
-    0x76, 0xB5, 0x7E, 0x0D, 0xE8, 0x57, 0x7A, 0xA7, 0x93, 0xA3, 0xC9, 0xA4, 0x9A, 0xAE, 0x13, 0x60,
-    0x37, 0xE8, 0x02, 0x21, 0x98, 0x06, 0x0E, 0xB5, 0x28, 0xCF, 0x65, 0x7F, 0x78, 0x2C, 0x0F, 0x50,
-    0x98, 0x7D, 0xF7, 0x61, 0x7D, 0x30, 0x01, 0xD7, 0x4A, 0x93, 0x70, 0xBF, 0xAF, 0x60, 0x88, 0x90,
-    0xFA, 0x4D, 0xD1, 0x3B, 0x9F, 0x79, 0x31, 0x4E, 0x2B, 0x8A, 0x6B, 0x4D, 0x8A, 0xE3, 0x91, 0x1E,
-    0x3F, 0x1A, 0xDC, 0xF4, 0xCF, 0x37, 0xC3, 0x68, 0xD2, 0x2D, 0x2B, 0x72, 0xC0, 0x6C, 0x9A, 0xE6,
-    0xC7, 0x69, 0x94, 0xAB, 0x34, 0x12, 0xF3, 0xF9, 0x3F, 0x7A, 0x4E, 0x00, 0xC5, 0x3D, 0x94, 0x1F,
-    0x4A, 0x3F, 0x9F, 0xB8, 0x67, 0x69, 0xE1, 0xE1, 0xCC, 0x0F, 0x7C, 0x42, 0x12, 0x7E, 0x6C, 0x2A,
-    0x2B, 0x12, 0x4C, 0x30, 0x69, 0xC6, 0x8E, 0x66, 0xD2, 0x58, 0xA2, 0xB1, 0x8D, 0x57, 0x01, 0x06,
-    0xB8, 0xC1, 0x3F, 0xA5, 0xBD, 0x9B, 0xB0, 0x69, 0x6C, 0x6B, 0x20, 0xB6, 0x69, 0x4C, 0x06, 0x73,
-    0x49, 0x09, 0x04, 0xB2, 0x43, 0x2E, 0x56, 0x64, 0x47, 0x73, 0xA5, 0x96, 0x49, 0x80, 0x1B, 0x28,
-    0x68, 0x2D, 0xFE, 0x19, 0xB0, 0x6E, 0xBD, 0xAA, 0x23, 0x36, 0x36, 0x8D, 0xD6, 0x2F, 0x71, 0x2D,
-    0xAE, 0xD1, 0x89, 0x91, 0x64, 0x52, 0xE7, 0x9F, 0x71, 0x47, 0x7A, 0xB2, 0x4F, 0xB6, 0x9D, 0x66,
-    0xB7, 0x1B, 0x7A, 0xB0, 0x76, 0xE1, 0xE6, 0x9C, 0x19, 0xAC, 0xA7, 0xDC, 0x3C, 0x52, 0xB3, 0x16,
-    0xC4, 0x11, 0x3D, 0x89, 0x4C, 0x1C, 0x4A, 0x4A, 0xC0, 0xC0, 0x21, 0xA5, 0x3E, 0x3C, 0x61, 0x0D,
-    0xDA, 0xF4, 0x77, 0xA4, 0x23, 0x23, 0xDE, 0x26, 0x0F, 0x5A, 0xFD, 0x42, 0xEA, 0xFC, 0x99, 0x39,
-    0xAF, 0x7B, 0xEC, 0xEB, 0xCD, 0xF6, 0xE2, 0x62, 0x37, 0x74, 0xDD, 0xB5, 0x03, 0x14, 0x9B, 0x6C,
-    0xD9, 0x16, 0xB7, 0xFE, 0x62, 0x53, 0x7A, 0x84, 0xD2, 0x8F, 0xDB, 0x06, 0x48, 0x87, 0x2F, 0x1F,
-    0x8C, 0x1A, 0x8B, 0xD4, 0x43, 0xAA, 0xCE, 0xD7, 0xD9, 0x36, 0xEA, 0x88, 0xD4, 0xBE, 0xB4, 0x84,
-    0x15, 0xCF, 0x42, 0xDB, 0xF0, 0xF4, 0x98, 0x39, 0x94, 0x19, 0x47, 0x59, 0xF9, 0xEF, 0xDF, 0xE5,
-    0x1C, 0x7E, 0x9E, 0x6B, 0x80, 0xED, 0x3F, 0x99, 0x87, 0xFF, 0x7F, 0x64, 0x74, 0x11, 0x25, 0xBA,
-    0xA0, 0xD4, 0x7F, 0x33, 0x68, 0x08, 0x14, 0x9D, 0xFC, 0x82, 0xDE, 0x0C, 0x7F, 0x38, 0xCE, 0xCF,
-    0xE8, 0x64, 0xEB, 0xE7, 0x5C, 0xEA, 0xB7, 0xAF, 0x3A, 0xD7, 0x33, 0x36, 0x8C, 0x3D, 0x63, 0xDB,
-    0x9C, 0xD3, 0x98, 0x43, 0x02, 0xB3, 0x28, 0xD3, 0x73, 0x27, 0x67, 0xD5, 0x9A, 0xE9, 0x6A, 0x3D,
-    0x56, 0xB3, 0x1D, 0x6E, 0xE2, 0x55, 0xE2, 0x5F, 0x2A, 0x74, 0xBE, 0x48, 0x93, 0x20, 0x19, 0xB1,
-    0x8E, 0x5E, 0xEF, 0x24, 0xED, 0x60, 0x9C, 0x25, 0xE8, 0xC0, 0x4B, 0x29, 0x39, 0xEB, 0x95, 0xCE,
-    0xAC, 0x69, 0xC6, 0xA0, 0x2E, 0x37, 0xE4, 0xED, 0x24, 0xA0, 0x12, 0xA7, 0x84, 0x0E, 0x02, 0x43,
-    0x49, 0x87, 0x51, 0x42, 0xAD, 0xD6, 0x5A, 0xBB, 0x8E, 0x80, 0x68, 0x1B, 0xDA, 0x15, 0x3D, 0x2D,
-    0x05, 0x87, 0xA9, 0x0C, 0x44, 0x20, 0x49, 0xC6, 0x27, 0x99, 0x01, 0x65, 0xFE, 0x57, 0x7E, 0x32,
-    0x4A, 0xEA, 0x86, 0x06, 0xF5, 0xD2, 0x3D, 0x7E, 0xF2, 0xF7, 0x28, 0xE9, 0xD4, 0x07, 0xC1, 0x55,
-    0xBF, 0x6D, 0xF1, 0x3E, 0xEF, 0xE0, 0x92, 0x2A, 0xD8, 0xC1, 0x21, 0xC5, 0xDC, 0x90, 0xA7, 0xA1,
-    0x84, 0x8D, 0x85, 0x95, 0x95, 0x85, 0x7A, 0x39, 0xB0, 0x93, 0x82, 0x40, 0x25, 0x48, 0x56, 0x85,
-    0x83, 0xC5, 0xB8, 0x2E, 0x93, 0xE0, 0x5F, 0xD5, 0x7C, 0x3D, 0x8C, 0x1C, 0x67, 0x7A, 0xE6, 0x57,
-    0x55, 0x9A, 0xE9, 0x5D, 0x15, 0x0E, 0xA5, 0x03, 0xC8, 0xB3, 0x4E, 0x04, 0x54, 0x0E, 0x14, 0x68,
-    0x05, 0x8A, 0x75, 0xC1, 0x05, 0x6B, 0x60, 0xBA, 0xAA, 0xB8, 0x02, 0x4E, 0xC1, 0x05, 0x9E, 0x03,
-    0xD8, 0x14, 0x70, 0x0C, 0xB8, 0x81, 0x02, 0x1E, 0xEF, 0xD6, 0xB3, 0x81, 0x0F, 0x58, 0xC0, 0xDD,
-    0xD3, 0x65, 0x28, 0xBC, 0xC0, 0x03, 0x58, 0x1B, 0x39, 0x30, 0x03, 0x06, 0x52, 0xEB, 0x70, 0xE3,
-    0xC0, 0xC1, 0x2C, 0x50, 0x3D, 0x55, 0x36, 0x03, 0x07, 0x0E, 0x5C, 0x0B, 0x99, 0x91, 0x83, 0x2D,
-    0x59, 0x43, 0x2C, 0xC0, 0x05, 0x4E, 0xE5, 0x55, 0x13, 0xAA, 0xA1, 0xBA, 0xBB, 0xEE, 0x79, 0xDE,
-    0xAF, 0xAA, 0x7F, 0x66, 0xBA, 0xF9, 0x23, 0x72, 0xC6, 0x7B, 0x3D, 0xF3, 0xBD, 0x5F, 0x77, 0xFD,
-    0x7E, 0x3F, 0xEF, 0xFF, 0xFB, 0x7E, 0x9F, 0xB1, 0xAD, 0x94, 0x51, 0x2A, 0xA5, 0x7A, 0x28, 0x1E,
-    0x8A, 0x1D, 0xE1, 0x40, 0xA8, 0xF8, 0x09, 0xAA, 0x2A, 0x64, 0xF1, 0x3B, 0x1D, 0xD5, 0xC6, 0xEF,
-    0x55, 0x05, 0xE7, 0xA5, 0xF8, 0x9D, 0x6B, 0x6B, 0xAF, 0xE1, 0xFD, 0xCD, 0xB3, 0x54, 0xF8, 0x9A,
-    0xB2, 0xF2, 0x52, 0x59, 0x45, 0xA9, 0x8C, 0xEC, 0x8F, 0x55, 0xF3, 0x39, 0x8B, 0x77, 0x25, 0x55,
-    0x35, 0x56, 0x02, 0x3A, 0x7D, 0xDC, 0x22, 0xDD, 0x5B, 0x0D, 0xDE, 0xB8, 0x0B, 0x50, 0x55, 0xA9,
-    0xF2, 0x1E, 0xEF, 0x17, 0x38, 0x66, 0x96, 0x3C, 0x31, 0x26, 0xE8, 0x2D, 0x83, 0x61, 0x73, 0xC2,
-    0x1A, 0x29, 0xAF, 0x55, 0xE5, 0x04, 0x1C, 0x2D, 0x0C, 0xA3, 0xC2, 0x2B, 0xCC, 0x91, 0x52, 0xAD,
-    0x5C, 0x29, 0x07, 0xA3, 0x78, 0x05, 0x87, 0x2E, 0xCC, 0x7A, 0x57, 0xB7, 0x7C, 0x7D, 0xEF, 0x9E,
-    0xB7, 0xE8, 0xCF, 0x66, 0x75, 0xAC, 0x54, 0x1F, 0x9D, 0x35, 0xAA, 0xED, 0x1D, 0x36, 0x0A, 0xEF,
-    0xCE, 0x00, 0xDC, 0xA8, 0xE9, 0x5C, 0x40, 0xE0, 0xD7, 0xAD, 0xC8, 0x6B, 0xD0, 0xE9, 0x6C, 0xD7,
-    0xC7, 0x66, 0xC0, 0xE3, 0x1D, 0x4E, 0x4A, 0x14, 0x28, 0x00, 0xAC, 0x69, 0x78, 0x49, 0x71, 0xF4,
-    0xF0, 0xBB, 0x9A, 0xE0, 0xC0, 0x45, 0xFD, 0x42, 0x23, 0x99, 0xE2, 0x40, 0x95, 0xBA, 0xD9, 0x8D,
-    0x28, 0xA8, 0x9F, 0xDC, 0xAE, 0xEB, 0x00, 0x23, 0xE1, 0xA2, 0xF7, 0x32, 0x24, 0xC9, 0x88, 0x77,
-    0xE2, 0x68, 0x3F, 0xD5, 0x6D, 0xB2, 0xF2, 0x79, 0xB1, 0xB3, 0x5F, 0xA8, 0x9D, 0x94, 0x4F, 0xF7,
-    0xAA, 0x91, 0x0C, 0x53, 0x7B, 0xD5, 0xE7, 0x15, 0x1C, 0xF6, 0x7B, 0xEF, 0x6E, 0xF1, 0xC5, 0x56,
-    0xF6, 0xAC, 0x7F, 0xCA, 0x0D, 0x5F, 0xF4, 0x1F, 0x23, 0xD7, 0x57, 0xFD, 0x89, 0xEA, 0x8F, 0xD4,
-    0x1B, 0xA1, 0x8C, 0x5C, 0xAA, 0x66, 0x95, 0xDF, 0xB9, 0x91, 0x4A, 0xAF, 0x5B, 0xA7, 0xAB, 0x2D,
-    0x5D, 0x75, 0x67, 0xD5, 0xE3, 0x4F, 0xA5, 0xAA, 0xAA, 0x8C, 0xD5, 0xC3, 0xFD, 0x52, 0xC5, 0x3C,
-    0x37, 0xD1, 0x95, 0xAF, 0xAB, 0x40, 0x1D, 0xB0, 0xF2, 0x54, 0xA9, 0x7F, 0x8D, 0xE4, 0x9C, 0x51,
-    0xB0, 0x1A, 0xBE, 0x8F, 0xEA, 0xFE, 0x8D, 0x12, 0x0F, 0xC0, 0x53, 0xF2, 0x2A, 0x42, 0x35, 0x6D,
-    0x10, 0xAB, 0x3D, 0x9B, 0x80, 0xE7, 0xAB, 0x80, 0x88, 0xFD, 0x4E, 0xC8, 0x0E, 0x55, 0x98, 0x5C,
-    0xA9, 0xAA, 0x54, 0xCE, 0x39, 0xB9, 0x54, 0x56, 0x21, 0x95, 0x31, 0xD2, 0x37, 0x8C, 0x16, 0x7F,
-    0x99, 0xBA, 0x6A, 0xF1, 0x92, 0xA0, 0xB3, 0x93, 0xB5, 0x35, 0xF9, 0x4A, 0x75, 0xA4, 0x9E, 0x83,
-    0xEA, 0x3E, 0x5D, 0x4B, 0x75, 0xDD, 0x19, 0xE8, 0xAD, 0x07, 0x82, 0x92, 0x43, 0xA0, 0xE4, 0x88,
-    0xD8, 0xA1, 0x59, 0xD7, 0xC6, 0x6C, 0x5C, 0xE2, 0xB6, 0xB4, 0x97, 0x1D, 0xB1, 0xD1, 0x35, 0x17,
-    0xED, 0xF3, 0x71, 0x7C, 0xAC, 0xDA, 0xB8, 0xBE, 0x6D, 0x91, 0x12, 0x52, 0x29, 0xFE, 0x07, 0xB9,
-    0x6A, 0x83, 0x70, 0xE5, 0x9C, 0xDA, 0x45, 0xF1, 0x70, 0xAD, 0x83, 0x7B, 0x5A, 0x18, 0x0B, 0xE9,
-    0xEC, 0x18, 0x65, 0x57, 0x3F, 0x5B, 0x28, 0x84, 0x28, 0x8C, 0x41, 0x51, 0x32, 0xC5, 0xF8, 0xBC,
-    0xA2, 0x66, 0xAF, 0xE5, 0xBB, 0x94, 0x4B, 0x10, 0x10, 0x24, 0x00, 0xC6, 0x37, 0x00, 0xD6, 0xAF,
-    0x01, 0xEC, 0xBF, 0x63, 0x4B, 0xDE, 0x07, 0xF0, 0x5B, 0x00, 0x31, 0xC1, 0x08, 0xC0, 0xCA, 0x01,
-    0x5A, 0x29, 0x80, 0x13, 0x02, 0x04, 0x98, 0xF7, 0x36, 0x51, 0xA8, 0x4D, 0x7C, 0x08, 0x88, 0x06,
-    0x41, 0x4A, 0x10, 0x11, 0x28, 0x62, 0xC5, 0x05, 0x72, 0x1C, 0xDF, 0x04, 0xA5, 0xBA, 0x7F, 0xC1,
-    0xAE, 0x57, 0x91, 0x66, 0x40, 0xF2, 0x89, 0xD9, 0x42, 0xCC, 0x5A, 0x2B, 0xF3, 0xD8, 0x60, 0x30,
-    0x23, 0x37, 0xB4, 0x89, 0x5E, 0x68, 0x37, 0xA6, 0xAF, 0xE0, 0x05, 0x25, 0xFE, 0x54, 0xCC, 0xA1,
-    0xF3, 0x2D, 0x3C, 0xC5, 0x6B, 0xE1, 0x29, 0xCE, 0xFF, 0x42, 0xE7, 0xEC, 0x5F, 0x01, 0xE1, 0x2D,
-    0x12, 0xAE, 0x39, 0xE5, 0xC3, 0xC6, 0xAA, 0x96, 0x10, 0xBC, 0x4C, 0xB9, 0xCD, 0xCB, 0x6C, 0x39,
-    0x19, 0xEA, 0x4E, 0x3B, 0xE1, 0x99, 0x00, 0x60, 0xE9, 0x4D, 0x72, 0xF2, 0x4A, 0x03, 0xB6, 0x5C,
-    0x9D, 0x04, 0xC6, 0x1D, 0xB6, 0x83, 0xED, 0x33, 0xD8, 0x52, 0x8B, 0xAC, 0xCA, 0xFA, 0x8A, 0x5C,
-    0xEC, 0x1F, 0x38, 0x5B, 0x7F, 0x86, 0xA6, 0xBA, 0xE8, 0xBB, 0x0A, 0x88, 0x21, 0x6D, 0xF6, 0x21,
-    0x06, 0x5D, 0x49, 0xF7, 0xD1, 0xF9, 0x58, 0x99, 0x24, 0x00, 0xAB, 0x02, 0x49, 0xB5, 0x1E, 0x0E,
-    0x12, 0x4E, 0xAF, 0x13, 0x82, 0x01, 0x38, 0xA9, 0xC7, 0xF1, 0xF3, 0x39, 0x92, 0x5D, 0xBE, 0x6A,
-    0x4C, 0x3C, 0x23, 0x03, 0x40, 0xC9, 0xD0, 0xB0, 0x70, 0xA5, 0x84, 0x1A, 0x6C, 0x03, 0xA5, 0xA6,
-    0xA8, 0x49, 0x4D, 0x76, 0xA1, 0xD1, 0x8F, 0x68, 0xD8, 0x14, 0x13, 0xBF, 0x5B, 0x85, 0x0F, 0xAA,
-    0xD1, 0x52, 0xEA, 0x48, 0xE9, 0x52, 0xA5, 0x7E, 0x67, 0x9F, 0xD7, 0x13, 0xDD, 0xCA, 0x79, 0xE1,
-    0xF5, 0x76, 0x8E, 0x67, 0x86, 0x2C, 0xBE, 0xBA, 0xC1, 0xE7, 0x8D, 0x35, 0x7A, 0xAB, 0x5E, 0x5D,
-    0x88, 0xEA, 0x63, 0x9C, 0x63, 0xFB, 0xF0, 0xDC, 0xC9, 0xD9, 0xC8, 0x1B, 0xA7, 0xAA, 0x88, 0x6E,
-    0x15, 0x19, 0xB6, 0xFB, 0xF3, 0xEB, 0x84, 0x42, 0x7A, 0x8B, 0xD0, 0x3B, 0x05, 0xAF, 0x08, 0xF4,
-    0x17, 0x60, 0x5B, 0x60, 0x4F, 0x60, 0x2C, 0x50, 0xA6, 0x42, 0xFF, 0x63, 0x82, 0x00, 0x2F, 0x3D,
-    0xE8, 0x5C, 0x7F, 0x44, 0xF9, 0x8D, 0x71, 0xD1, 0x30, 0xE6, 0x8C, 0xAE, 0x80, 0x1F, 0x52, 0x06,
-    0x46, 0x67, 0xA1, 0x3D, 0x90, 0xEB, 0x91, 0x82, 0x42, 0x54, 0xA0, 0xA1, 0x14, 0x95, 0x10, 0xD0,
-    0x08, 0x9C, 0x00, 0xDC, 0x62, 0x44, 0xC2, 0x18, 0xAB, 0x11, 0x91, 0xD0, 0x07, 0x11, 0x83, 0x23,
-    0x78, 0xE1, 0x88, 0xDC, 0xC1, 0x49, 0x47, 0xE4, 0x6F, 0x82, 0x53, 0xB3, 0xCA, 0xB9, 0x7F, 0xDC,
-    0x57, 0xB3, 0x4B, 0xC0, 0xE1, 0x49, 0x6F, 0xB8, 0x9D, 0xFD, 0x2D, 0xE5, 0x61, 0xF8, 0x36, 0x02,
-    0x37, 0xB3, 0x33, 0x54, 0x01, 0xE5, 0xF7, 0x08, 0x20, 0x60, 0x23, 0xEC, 0x6C, 0xC8, 0x4A, 0xE8,
-    0x4F, 0x5D, 0xC2, 0xF0, 0x43, 0xDE, 0xAB, 0x3F, 0xD0, 0x72, 0x35, 0x25, 0x96, 0xCE, 0x0B, 0x7F,
-    0xF7, 0xF1, 0xCE, 0x52, 0x8A, 0xEA, 0x24, 0xA4, 0xD4, 0x4C, 0xD3, 0xAE, 0x59, 0x17, 0x7E, 0x6F,
-    0xE5, 0x47, 0x90, 0xBF, 0x24, 0xAA, 0x3E, 0xAF, 0xBB, 0x70, 0xBE, 0xAC, 0x0B, 0x5C, 0xA3, 0x4B,
-    0x72, 0x0C, 0x6E, 0xB2, 0x0B, 0x54, 0x16, 0x8C, 0x6B, 0xE7, 0xCD, 0x41, 0xCF, 0x44, 0x42, 0x90,
-    0xFE, 0xB4, 0x86, 0x05, 0x1D, 0x01, 0xF7, 0x10, 0x5F, 0xE6, 0x60, 0x8B, 0xA0, 0xBB, 0x02, 0xC4,
-    0xCB, 0xE0, 0x80, 0xA0, 0xD4, 0xB8, 0x66, 0xE5, 0xE0, 0x56, 0x56, 0xFE, 0x3E, 0x01, 0x9E, 0x6D,
-    0x51, 0xFE, 0x5B, 0xB9, 0x48, 0xFF, 0x80, 0xAC, 0x2D, 0x47, 0xB7, 0x94, 0x97, 0x07, 0x40, 0xBF,
-    0x20, 0xF7, 0x31, 0xB3, 0xFD, 0xBC, 0x0D, 0x8A, 0xFA, 0x26, 0xDF, 0x02, 0x51, 0x7D, 0x9D, 0x6F,
-    0x75, 0x95, 0xF9, 0x65, 0xBE, 0x85, 0xD7, 0x7F, 0x9E, 0xB7, 0x3D, 0xD5, 0xBA, 0x97, 0xB7, 0x5D,
-    0xE5, 0x7C, 0x94, 0xB7, 0x9D, 0xC8, 0xB1, 0xF2, 0xB6, 0x9D, 0x7A, 0x80, 0x56, 0xD6, 0x26, 0xCC,
-    0xBB, 0x80, 0x46, 0x71, 0x00, 0xA8, 0x46, 0x23, 0xC2, 0x61, 0x41, 0xD8, 0xCF, 0x09, 0x83, 0x94,
-    0xD0, 0x8B, 0x08, 0x9D, 0x90, 0x10, 0xF2, 0x96, 0x5C, 0x3A, 0x7D, 0x06, 0x40, 0xF6, 0xAD, 0x01,
-    0x59, 0x7A, 0xFA, 0xAC, 0xB7, 0xB5, 0x6B, 0x71, 0x4B, 0x4A, 0xC7, 0x98, 0x02, 0xEF, 0xA7, 0x10,
-    0x4A, 0x61, 0x92, 0xB6, 0x0A, 0x30, 0x45, 0x9C, 0xB2, 0x0A, 0xB0, 0x6A, 0xA3, 0x24, 0xB9, 0x8D,
-    0xA9, 0x8C, 0xC6, 0xD4, 0x6D, 0x7A, 0xAB, 0x80, 0x9C, 0x25, 0x18, 0xE3, 0x0E, 0x55, 0xCA, 0xBD,
-    0xF2, 0x14, 0x73, 0x42, 0x42, 0x4A, 0x48, 0xA4, 0x36, 0x39, 0x1B, 0x69, 0x61, 0x26, 0x72, 0x22,
-    0x36, 0x57, 0x7A, 0x79, 0x36, 0x20, 0xA8, 0xEE, 0x68, 0x9E, 0x74, 0x9D, 0x58, 0x6E, 0xE7, 0x1A,
-    0x19, 0xCD, 0x85, 0x22, 0xC8, 0x09, 0x79, 0x93, 0x44, 0x22, 0x57, 0xAA, 0xBD, 0x33, 0xB0, 0x0B,
-    0x56, 0x81, 0x67, 0xB3, 0x0B, 0xA6, 0xDA, 0x2E, 0x20, 0x8B, 0x66, 0xE9, 0xDC, 0x78, 0xD0, 0x11,
-    0x4D, 0xEC, 0x25, 0x94, 0xF3, 0xD5, 0x61, 0x9A, 0x8F, 0x3B, 0x87, 0xC6, 0xCE, 0xC7, 0x4A, 0x86,
-    0x10, 0x54, 0x87, 0xDE, 0x95, 0xD0, 0x8C, 0x5D, 0x95, 0x80, 0xF2, 0x5D, 0x14, 0x30, 0x68, 0x34,
-    0xAA, 0x07, 0x68, 0xA7, 0x5D, 0xC0, 0x56, 0xB6, 0x08, 0xF5, 0x71, 0x7D, 0x8D, 0x17, 0xF1, 0x7A,
-    0xDC, 0x6B, 0x4C, 0xF9, 0x9C, 0xA4, 0xAC, 0x9F, 0x59, 0x3F, 0x7F, 0xF1, 0x8D, 0xA2, 0x60, 0xFA,
-    0xFC, 0x01, 0xA1, 0xE3, 0x73, 0xCC, 0x61, 0x1C, 0xE4, 0xE8, 0x9E, 0x59, 0x50, 0xE1, 0x1C, 0x53,
-    0x8D, 0xE9, 0x11, 0x7D, 0x3D, 0x4E, 0x91, 0xC3, 0x4E, 0xB5, 0x38, 0xB1, 0x7A, 0x76, 0xF9, 0xD3,
-    0xDD, 0xE5, 0x13, 0x38, 0xBD, 0x31, 0xEE, 0x36, 0x28, 0x95, 0xAC, 0x1C, 0x63, 0x85, 0x3B, 0xC7,
-    0x34, 0x6B, 0x7A, 0x9C, 0xD2, 0x80, 0x43, 0xE7, 0x46, 0x67, 0xAB, 0xB6, 0x7D, 0x4C, 0xF2, 0x99,
-    0x08, 0x50, 0x0D, 0x62, 0x9E, 0x00, 0x6F, 0x1F, 0x28, 0x75, 0x40, 0x21, 0xBA, 0xAE, 0xA0, 0x99,
-    0xE3, 0x1E, 0x29, 0x7B, 0xEF, 0xD2, 0x18, 0x6A, 0xC7, 0xD8, 0xAC, 0x8E, 0xC7, 0xF5, 0x64, 0xAE,
-    0x2D, 0x6D, 0x91, 0x94, 0x59, 0x5B, 0x0B, 0xEF, 0xF3, 0xAE, 0xD0, 0xF3, 0xE3, 0xCE, 0x8D, 0x4C,
-    0xDB, 0x53, 0x4D, 0x05, 0x29, 0x53, 0x08, 0xAF, 0xC4, 0x44, 0x90, 0xA7, 0x9D, 0x6F, 0xE5, 0x43,
-    0x93, 0xEA, 0xDC, 0xFC, 0x47, 0xDD, 0x96, 0x69, 0x5D, 0x69, 0x64, 0xF7, 0x9F, 0x50, 0xFD, 0x20,
-    0xE1, 0x45, 0x02, 0x3A, 0xBB, 0x4F, 0xE6, 0x14, 0x83, 0x3D, 0xAD, 0x5C, 0xE1, 0x5B, 0x42, 0xE3,
-    0x15, 0x6C, 0x22, 0xE0, 0xBB, 0x03, 0x6A, 0x72, 0xA2, 0xC0, 0xD4, 0xDF, 0x4C, 0x02, 0x30, 0x5D,
-    0xDA, 0x8C, 0xA2, 0x66, 0x89, 0xEE, 0x4B, 0x5C, 0xF0, 0x9E, 0x01, 0xF0, 0x3D, 0x1E, 0x99, 0xA0,
-    0xE7, 0x43, 0xBB, 0xF6, 0xC8, 0x2E, 0x3D, 0xF2, 0x47, 0x8F, 0x1D, 0x5D, 0x02, 0x72, 0x0C, 0x67,
-    0xFD, 0x4E, 0x3F, 0xF5, 0xD8, 0x32, 0x8F, 0xEF, 0xF1, 0x9E, 0xC6, 0x38, 0xF9, 0x02, 0xAD, 0xBC,
-    0x3F, 0x91, 0x19, 0xE7, 0x7C, 0xAC, 0x56, 0x26, 0x8F, 0xF4, 0x58, 0x5D, 0xE2, 0x17, 0xF2, 0x5A,
-    0xE5, 0x5F, 0xED, 0x93, 0xC9, 0xB6, 0x8A, 0xC6, 0x1C, 0xA1, 0x79, 0x4A, 0xC5, 0x60, 0xCE, 0x51,
-    0x61, 0x6F, 0x54, 0x54, 0x0A, 0x2B, 0x65, 0xC0, 0x06, 0x5F, 0x66, 0xB5, 0x7E, 0x73, 0x87, 0xDC,
-    0x8B, 0xA7, 0x7C, 0xA8, 0x30, 0x52, 0xF2, 0x64, 0x8F, 0x6A, 0x5A, 0x63, 0xF5, 0xD7, 0x24, 0xD4,
-    0x9F, 0x86, 0x74, 0x3B, 0x50, 0xDD, 0x80, 0xF6, 0x72, 0x74, 0x89, 0xCA, 0x49, 0x10, 0xAA, 0x43,
-    0x54, 0x43, 0x3E, 0x91, 0xEA, 0x0A, 0x09, 0x9D, 0x0C, 0x12, 0xF8, 0x40, 0xDD, 0x0F, 0x7A, 0x0E,
-    0x59, 0xA0, 0x0D, 0xDC, 0xA4, 0x16, 0xD8, 0x54, 0xFE, 0x07, 0x52, 0xC9, 0x39, 0x54, 0xF5, 0x95,
-    0xF5, 0x7D, 0x64, 0xB2, 0x64, 0x17, 0xB1, 0x7E, 0x26, 0x5A, 0xCA, 0x37, 0xB8, 0x79, 0x6B, 0xAC,
-    0xDF, 0x5E, 0xB0, 0x2D, 0x89, 0x78, 0xC1, 0xB4, 0xE7, 0x70, 0x13, 0x83, 0x08, 0x71, 0x60, 0x4D,
-    0x7F, 0xDE, 0xE7, 0x6C, 0x83, 0x13, 0x2D, 0x15, 0xE8, 0xA3, 0x81, 0x55, 0xAA, 0xC0, 0xA8, 0x1E,
-    0x27, 0xB4, 0xFF, 0x95, 0xFD, 0xA0, 0x2F, 0xAA, 0x2E, 0xFF, 0x86, 0x28, 0x38, 0x87, 0x86, 0xC8,
-    0x75, 0xBC, 0x9E, 0x2C, 0xCB, 0x48, 0x72, 0x58, 0x1E, 0x13, 0xE5, 0xEC, 0x71, 0xC8, 0xE8, 0x5D,
-    0xA3, 0x44, 0x02, 0x5B, 0xDB, 0xB8, 0x99, 0x9A, 0xF4, 0x46, 0x3D, 0xBE, 0x09, 0x7E, 0x4B, 0xA3,
-    0x80, 0xC5, 0x41, 0x71, 0xD3, 0x5D, 0xC5, 0x79, 0xFA, 0x75, 0x6A, 0x57, 0xEF, 0xA5, 0xE2, 0x9F,
-    0xA3, 0x97, 0xCE, 0x4C, 0xF0, 0xE4, 0xAA, 0x30, 0xAA, 0x8F, 0x65, 0x96, 0xF8, 0x24, 0xF2, 0xDE,
-    0x2B, 0x68, 0x78, 0xDB, 0x9B, 0xAA, 0x36, 0x9E, 0xD5, 0xCF, 0xEC, 0xA2, 0x0F, 0x64, 0xC5, 0xAC,
-    0x95, 0x3D, 0xCD, 0x82, 0xE2, 0x9E, 0x36, 0xB8, 0x60, 0x64, 0xA9, 0x31, 0xEC, 0x9A, 0xD2, 0x0D,
-    0xAD, 0xC2, 0xC9, 0xED, 0x0C, 0x13, 0x19, 0xA9, 0x64, 0x22, 0x1D, 0xBF, 0x0D, 0xFC, 0x49, 0xD0,
-    0xC6, 0xE1, 0xF5, 0x04, 0x63, 0xE5, 0x46, 0x68, 0x07, 0x4B, 0x18, 0x1B, 0x7D, 0x1C, 0x1F, 0x89,
-    0x8E, 0x11, 0x43, 0x9C, 0xC6, 0x4B, 0xED, 0xDC, 0x89, 0x28, 0x4B, 0x13, 0xA0, 0xD0, 0xED, 0xC1,
-    0x9D, 0xA4, 0x2A, 0x0E, 0x07, 0x77, 0x62, 0xB1, 0xE0, 0x9F, 0xFA, 0x8F, 0x1B, 0x3E, 0xE1, 0xC0,
-    0x63, 0x92, 0x0F, 0x07, 0x00, 0x07, 0xF4, 0x45, 0xCC, 0xC1, 0x68, 0x19, 0x14, 0x00, 0x06, 0x81,
-    0x29, 0x4A, 0x27, 0xBD, 0x51, 0x22, 0x60, 0x28, 0xB7, 0x33, 0x01, 0x94, 0xB8, 0x27, 0x81, 0xC6,
-    0xB5, 0x1D, 0x88, 0x11, 0x0E, 0x7E, 0xDE, 0x0F, 0x21, 0xCA, 0x52, 0x5F, 0x44, 0x9C, 0x95, 0xF7,
-    0x3A, 0x1F, 0xE4, 0xB8, 0xB3, 0x48, 0x06, 0xD2, 0x66, 0x71, 0x21, 0xFB, 0x62, 0xE4, 0x50, 0xD9,
-    0x30, 0xD2, 0x16, 0x7D, 0x3B, 0x44, 0x0C, 0x0C, 0xCE, 0x0F, 0xD4, 0xAB, 0xCA, 0x8C, 0x3C, 0x0C,
-    0x07, 0x65, 0xB9, 0x13, 0x42, 0x17, 0xCD, 0x28, 0x2E, 0xCC, 0xC2, 0x09, 0x4B, 0x2A, 0x64, 0x3F,
-    0xC2, 0x6C, 0xB4, 0x9D, 0xF7, 0x33, 0x71, 0x09, 0x45, 0x8D, 0xAF, 0xAD, 0xE7, 0xBE, 0x9F, 0xCB,
-    0x59, 0x9A, 0x3F, 0x4E, 0x38, 0x96, 0xBB, 0x76, 0xA9, 0x0F, 0xE0, 0x09, 0x81, 0x3C, 0xAD, 0x07,
-    0xD8, 0xCA, 0x37, 0xA1, 0x19, 0x79, 0x68, 0xE3, 0x9B, 0x57, 0x13, 0xCA, 0xC1, 0x50, 0x17, 0x48,
-    0x42, 0x63, 0x08, 0x92, 0xCB, 0x51, 0xC6, 0x35, 0x95, 0x35, 0xC8, 0xE3, 0xA4, 0x6F, 0x81, 0x5A,
-    0x84, 0xA1, 0xD4, 0x2E, 0xC8, 0x5B, 0x6A, 0x73, 0x0F, 0x93, 0x92, 0xC7, 0x50, 0xA5, 0x63, 0xA8,
-    0xBD, 0x31, 0xD4, 0xE8, 0xD8, 0xFC, 0x3A, 0x8F, 0xAD, 0x7B, 0x79, 0x6C, 0x7F, 0x94, 0xC7, 0xAE,
-    0x95, 0xC7, 0xD0, 0x93, 0x63, 0x28, 0xCA, 0x31, 0x14, 0xE4, 0x43, 0x28, 0xC6, 0x09, 0xD4, 0xE2,
-    0x04, 0x4A, 0x71, 0x42, 0x41, 0x1B, 0xFD, 0x7B, 0x65, 0x91, 0xEF, 0x3E, 0xC2, 0xBB, 0x80, 0x67,
-    0x8D, 0x33, 0xEA, 0x45, 0x9F, 0x7B, 0x4B, 0xBD, 0x1A, 0x02, 0x71, 0x30, 0x59, 0x3D, 0x94, 0x52,
-    0xC5, 0xD4, 0x7E, 0xA0, 0xEB, 0xC4, 0xE8, 0x4A, 0x52, 0x29, 0x29, 0x94, 0xF7, 0x31, 0xC4, 0xBD,
-    0x9C, 0x03, 0xDD, 0xC7, 0x60, 0x3A, 0xFA, 0x1E, 0x9C, 0x18, 0x0C, 0xEE, 0xAA, 0x0A, 0x0C, 0xE4,
-    0xF1, 0xA0, 0x04, 0x1E, 0xCC, 0x8A, 0x71, 0xA2, 0x98, 0x2C, 0xB0, 0x3C, 0x30, 0xED, 0x25, 0x48,
-    0xAB, 0xAC, 0x58, 0xB4, 0x6F, 0x45, 0xDD, 0x06, 0x59, 0xDF, 0x49, 0x42, 0xE5, 0x14, 0xE0, 0xF1,
-    0x6E, 0x91, 0x80, 0x36, 0x8B, 0xC3, 0x5C, 0xED, 0x16, 0xC3, 0x42, 0xFD, 0xA2, 0x88, 0x4B, 0xF5,
-    0xA8, 0x88, 0xBB, 0xE6, 0xBF, 0x14, 0xE8, 0xC7, 0x2F, 0x8B, 0xD8, 0x6B, 0xFD, 0x4D, 0x11, 0x3B,
-    0xCE, 0x9F, 0x02, 0xFC, 0x99, 0x51, 0xC4, 0xAD, 0xFF, 0x0B, 0x60, 0x4D, 0x00, 0xCC, 0x31, 0x80,
-    0x1A, 0x19, 0xC5, 0x2D, 0x65, 0x62, 0x4C, 0x88, 0x65, 0x27, 0x4B, 0x8B, 0xD8, 0x28, 0x65, 0xF5,
-    0x79, 0x5D, 0xD4, 0xCE, 0x11, 0xB9, 0xA8, 0x72, 0x8E, 0x76, 0x52, 0x0F, 0xC4, 0x48, 0x11, 0x03,
-    0xFC, 0x2B, 0xBB, 0xB5, 0xDE, 0x10, 0xCF, 0xF5, 0x87, 0x92, 0x6E, 0x07, 0x8F, 0xF8, 0x93, 0x39,
-    0x0B, 0x04, 0x4B, 0xFA, 0x19, 0x90, 0xF8, 0xD2, 0xC3, 0xC1, 0x67, 0x29, 0xDD, 0xB0, 0xCF, 0x5B,
-    0x3E, 0x74, 0x8F, 0x54, 0x4C, 0xE2, 0x3D, 0xEA, 0xA7, 0x09, 0x78, 0xEA, 0x21, 0xDE, 0x11, 0x03,
-    0xA3, 0xE9, 0xD4, 0x58, 0x2E, 0x66, 0x31, 0xC4, 0xB9, 0x04, 0xDA, 0x5C, 0x92, 0xBA, 0xE9, 0x21,
-    0x18, 0x7A, 0xDC, 0xC7, 0x1C, 0x81, 0x2E, 0x62, 0xED, 0xAE, 0x3B, 0x55, 0x94, 0x77, 0x4C, 0x51,
-    0xA1, 0x9C, 0x47, 0xFF, 0x55, 0x74, 0xF6, 0xA0, 0xA6, 0xAF, 0xEE, 0x89, 0xEB, 0x1A, 0x9A, 0x13,
-    0xCC, 0xCE, 0x0C, 0xF2, 0x63, 0x2D, 0xB6, 0x85, 0x21, 0xE9, 0xFE, 0xDD, 0x4E, 0x06, 0x91, 0xE8,
-    0xFC, 0xCF, 0x59, 0xC0, 0x5D, 0xEE, 0xB2, 0xFD, 0x54, 0xB7, 0xA9, 0x77, 0xBB, 0x21, 0xA8, 0x2F,
-    0x72, 0x52, 0x1B, 0x14, 0x6C, 0x65, 0x2E, 0x8E, 0x62, 0xD4, 0xE9, 0x04, 0x2E, 0xC9, 0x90, 0x80,
-    0x26, 0xB4, 0x3C, 0xBD, 0x42, 0x2B, 0xD8, 0x42, 0x62, 0xD1, 0x8C, 0x0C, 0x29, 0x03, 0xAF, 0xD7,
-    0x64, 0x41, 0xA7, 0xC4, 0xDC, 0x53, 0xB9, 0x1E, 0x5C, 0x02, 0x4D, 0x1B, 0xE2, 0x99, 0x3B, 0x1E,
-    0xF6, 0x31, 0x6E, 0x5D, 0x3B, 0x0F, 0x54, 0xD7, 0x44, 0x7B, 0xBA, 0xE4, 0xCC, 0x5D, 0xCE, 0x70,
-    0x57, 0xC5, 0x73, 0x20, 0xC7, 0x70, 0x09, 0x2C, 0xC2, 0xB0, 0x4B, 0x06, 0xDD, 0x75, 0x39, 0xE1,
-    0xE0, 0x40, 0xE2, 0xE5, 0x30, 0x86, 0xE1, 0x53, 0x5E, 0xF9, 0x03, 0x65, 0xDC, 0x01, 0x67, 0xCA,
-    0xE9, 0xEF, 0x69, 0xE5, 0x1E, 0x84, 0x00, 0x05, 0x00, 0x6E, 0x0D, 0xEA, 0x5E, 0xB1, 0xF0, 0x3B,
-    0x8E, 0xF1, 0x1C, 0xAF, 0xE1, 0xB5, 0xBC, 0x87, 0x5E, 0x21, 0x60, 0x75, 0x44, 0xAF, 0xC3, 0x73,
-    0x96, 0x0C, 0x22, 0x7E, 0xDA, 0xD7, 0x7A, 0x99, 0x7F, 0xA2, 0xA8, 0xB7, 0x41, 0x29, 0xC2, 0x6D,
-    0x17, 0x4A, 0xBB, 0x2E, 0x01, 0x67, 0xE5, 0xC1, 0x7E, 0x6E, 0x53, 0x07, 0xB8, 0xFD, 0xE7, 0xF9,
-    0x72, 0x90, 0x45, 0x97, 0x5B, 0xE4, 0xBC, 0xA0, 0x35, 0x88, 0xAC, 0xFC, 0x65, 0x41, 0xF1, 0xC9,
-    0xD5, 0x70, 0xE1, 0xF9, 0xD9, 0x4B, 0x82, 0xFA, 0xC9, 0x95, 0x86, 0x6A, 0x16, 0x30, 0x58, 0x01,
-    0xD5, 0xED, 0x4F, 0xA8, 0xA6, 0xD2, 0xC6, 0xB8, 0x2D, 0xAA, 0x56, 0x6F, 0x19, 0xF4, 0x81, 0x42,
-    0x00, 0x38, 0xBF, 0xDB, 0x49, 0x68, 0xFF, 0x00, 0x25, 0x7B, 0xC4, 0xCD, 0x06, 0xF0, 0x67, 0xBF,
-    0xBE, 0xA4, 0x8F, 0x41, 0xBC, 0xA5, 0xA4, 0x33, 0x8A, 0x3D, 0x3D, 0x0D, 0x92, 0x6A, 0x8F, 0x60,
-    0x8C, 0x9F, 0x46, 0xC2, 0x63, 0xDE, 0x7B, 0x00, 0xCE, 0x0C, 0xF0, 0x27, 0x4F, 0xC8, 0x25, 0x72,
-    0xF1, 0xAD, 0x35, 0xF4, 0x8D, 0x93, 0x22, 0xBA, 0x87, 0x1D, 0x51, 0x16, 0xC2, 0x5A, 0x59, 0x88,
-    0xE4, 0xBB, 0x91, 0xC8, 0xB9, 0x04, 0x66, 0xE2, 0xA5, 0x63, 0x25, 0xF5, 0x1F, 0xDC, 0x18, 0xD5,
-    0x26, 0xCE, 0x9C, 0xE2, 0x1D, 0xF2, 0x07, 0x19, 0x20, 0xAF, 0xE6, 0x00, 0xBE, 0x3C, 0x7D, 0x1B,
-    0xDA, 0x15, 0x11, 0xA2, 0x4F, 0x9D, 0x2C, 0xA4, 0xFC, 0xB1, 0x19, 0x6E, 0xEA, 0x83, 0xA3, 0x1A,
-    0x93, 0x16, 0x38, 0x71, 0x01, 0xCA, 0x81, 0xFC, 0xE8, 0xC5, 0xE0, 0xF2, 0x3E, 0x25, 0x47, 0x90,
-    0x80, 0x2B, 0x6A, 0x40, 0xA1, 0x12, 0xF0, 0x98, 0xCF, 0xB3, 0xBD, 0x98, 0x4E, 0xA9, 0xD8, 0x2C,
-    0xCD, 0x92, 0xAA, 0x02, 0xA7, 0xBF, 0x09, 0x77, 0xDE, 0x1E, 0x44, 0x40, 0xBB, 0xCC, 0x7D, 0xF8,
-    0x59, 0x06, 0x34, 0xCC, 0xFC, 0xBA, 0xF0, 0xBB, 0x97, 0xB5, 0x32, 0x9E, 0x33, 0x68, 0xE8, 0x42,
-    0x9C, 0x58, 0x85, 0x95, 0x41, 0x57, 0xCA, 0xDC, 0x48, 0x9F, 0x1F, 0x92, 0x81, 0x5F, 0xAB, 0xFB,
-    0x23, 0x9C, 0x8B, 0xE6, 0x7A, 0x3A, 0xB7, 0xC5, 0x5F, 0x82, 0xC2, 0x21, 0xDA, 0xA8, 0xE8, 0xED,
-    0xB8, 0x2A, 0xBF, 0x3C, 0x57, 0x9C, 0x5F, 0xD2, 0xB3, 0x19, 0xDF, 0x63, 0xD9, 0x7F, 0xA8, 0x65,
-    0xEB, 0x8D, 0xFB, 0xDB, 0xF5, 0xB1, 0x0B, 0xAA, 0xF5, 0x77, 0x55, 0xD6, 0xFA, 0x55, 0x55, 0x42,
-    0x43, 0x1E, 0x43, 0xCB, 0xEC, 0x41, 0x2E, 0xFB, 0x18, 0x6F, 0x9F, 0x41, 0xBD, 0xA7, 0x95, 0xD3,
-    0x2C, 0xE0, 0xDF, 0x92, 0x6D, 0xD2, 0x6D, 0x90, 0x29, 0x63, 0x9B, 0x5E, 0x1C, 0x97, 0x6A, 0xBF,
-    0xFA, 0x6B, 0x1D, 0x74, 0x7E, 0x7E, 0xB5, 0x71, 0xA7, 0x96, 0x2C, 0xA3, 0x37, 0x96, 0x24, 0x4B,
-    0x4F, 0xB0, 0xB2, 0x94, 0xF2, 0x34, 0xC9, 0x62, 0x56, 0x7B, 0x5E, 0x35, 0xDE, 0xBD, 0xFA, 0xD7,
-    0xE2, 0x84, 0x11, 0x6B, 0x23, 0x13, 0x6F, 0x0A, 0xD4, 0xF4, 0x56, 0x29, 0xAF, 0x41, 0x0B, 0xDB,
-    0x77, 0xD4, 0xB8, 0xAA, 0x46, 0xFD, 0x8A, 0xEA, 0xF7, 0x85, 0x38, 0x7E, 0x1B, 0xA8, 0x18, 0x2F,
-    0x7F, 0x2E, 0xBC, 0xB6, 0x15, 0xF7, 0xC6, 0x6F, 0x7F, 0x28, 0x2E, 0xAB, 0xC8, 0x4E, 0x9F, 0xF4,
-    0x07, 0x15, 0x2D, 0xC6, 0xDF, 0xDB, 0xB5, 0x4E, 0x15, 0x3F, 0xCB, 0x9F, 0x51, 0x26, 0x45, 0x3F,
-    0x82, 0x02, 0xC4, 0x28, 0x91, 0x44, 0x2E, 0xA0, 0x04, 0x11, 0x16, 0xC6, 0x09, 0x68, 0xC0, 0x26,
-    0x98, 0x46, 0x84, 0x15, 0xD4, 0x13, 0x63, 0xB4, 0x39, 0x26, 0x54, 0xBB, 0x26, 0xA1, 0x6F, 0xD2,
-    0x0D, 0xE3, 0x5B, 0x19, 0x8F, 0xD8, 0xA9, 0x31, 0x32, 0xC7, 0x55, 0xC4, 0x2B, 0x2B, 0x0A, 0xA8,
-    0xA8, 0x51, 0xF3, 0xCC, 0x48, 0xE9, 0x78, 0xEE, 0x5A, 0x08, 0x55, 0xE3, 0xE1, 0xC7, 0xA2, 0x73,
-    0x57, 0xD1, 0xE1, 0x60, 0xFF, 0xE1, 0x7E, 0xC1, 0xE3, 0xE6, 0x48, 0xCE, 0x96, 0x73, 0x48, 0xA5,
-    0x01, 0x34, 0xC4, 0xB3, 0xA2, 0x08, 0xB5, 0x6A, 0x9B, 0x7D, 0x8E, 0x75, 0x9F, 0x28, 0x86, 0x58,
-    0x6F, 0xDC, 0xBF, 0xB6, 0x88, 0x75, 0x79, 0x8D, 0x75, 0xA0, 0x72, 0x60, 0xD3, 0x1C, 0xEB, 0x82,
-    0xA7, 0x15, 0x89, 0x1D, 0xD2, 0x43, 0x66, 0xD5, 0xC9, 0x0B, 0x6F, 0xCE, 0xA3, 0x9A, 0x2F, 0xAA,
-    0x7E, 0x1A, 0xDB, 0xB5, 0x41, 0xBB, 0x5B, 0x3B, 0xBA, 0x5A, 0x73, 0x4A, 0x7F, 0x61, 0x95, 0x7B,
-    0x0F, 0xC2, 0x07, 0x42, 0x58, 0x1D, 0x03, 0x07, 0xFB, 0xA3, 0x59, 0xEA, 0xCA, 0x59, 0xAA, 0x2E,
-    0x9C, 0xE7, 0xEF, 0xA2, 0x2E, 0x26, 0x3A, 0x98, 0x95, 0xCA, 0x18, 0x2C, 0x16, 0x55, 0xC7, 0xC4,
-    0xCC, 0xC2, 0x6F, 0x2A, 0x0C, 0x33, 0x9B, 0xC8, 0x28, 0x00, 0x2B, 0x46, 0x87, 0x24, 0x34, 0x6E,
-    0xE5, 0xE0, 0x47, 0x63, 0xE9, 0x90, 0x9A, 0xD0, 0x18, 0x8A, 0x0C, 0xA8, 0x47, 0xD0, 0x40, 0x2C,
-    0x98, 0xD1, 0xE8, 0x9D, 0xF5, 0x15, 0x5A, 0x6F, 0xE5, 0xF6, 0x3F, 0x44, 0xE8, 0x67, 0xE1, 0xFC,
-    0x61, 0xEA, 0x86, 0x66, 0xE1, 0xDA, 0x0C, 0x66, 0x96, 0x9E, 0xF8, 0x53, 0xC7, 0xB0, 0xEE, 0xA1,
-    0x44, 0xF6, 0xBA, 0xC6, 0x08, 0x7D, 0xF2, 0x0F, 0xD4, 0x98, 0xC1, 0xBB, 0x91, 0xEA, 0xD3, 0x1A,
-    0x2E, 0x48, 0xC7, 0x4C, 0x60, 0x71, 0xD3, 0x86, 0x5D, 0x52, 0xBC, 0xAB, 0x3B, 0x30, 0x16, 0x43,
-    0xA3, 0xE8, 0x09, 0x6C, 0x63, 0x70, 0xD8, 0x46, 0x27, 0x65, 0x13, 0xF1, 0x4E, 0x8C, 0x3F, 0x20,
-    0x0C, 0x33, 0x27, 0x43, 0x53, 0x22, 0xAF, 0x60, 0x4B, 0x7C, 0x98, 0x6B, 0x56, 0x76, 0x30, 0xE2,
-    0x58, 0x17, 0x31, 0x3A, 0xF6, 0x5B, 0x06, 0x23, 0x54, 0x95, 0x5E, 0x21, 0x2B, 0x8B, 0x1C, 0xFA,
-    0x6B, 0x25, 0x34, 0xD5, 0x5E, 0x92, 0xD8, 0x89, 0x66, 0xB3, 0x90, 0x1B, 0x9D, 0xC3, 0x4E, 0xB8,
-    0x42, 0x9E, 0x37, 0xAE, 0x16, 0xC8, 0x73, 0x0A, 0x70, 0xB4, 0xB5, 0x47, 0xAF, 0x6E, 0x8F, 0x1E,
-    0xA7, 0x1A, 0xC8, 0x4F, 0x9C, 0xD8, 0x35, 0xFA, 0xA9, 0xC4, 0xCA, 0xE4, 0x36, 0x43, 0x9C, 0x32,
-    0x33, 0xF0, 0xDF, 0x1F, 0x37, 0xC6, 0xF3, 0x6D, 0x7E, 0x3B, 0x71, 0x56, 0xF8, 0x82, 0x41, 0xBE,
-    0x6E, 0x88, 0xAB, 0xA6, 0x80, 0xDD, 0x6E, 0xD0, 0x9D, 0x46, 0x57, 0x5E, 0xAA, 0xBF, 0x61, 0xCC,
-    0x42, 0x51, 0x4F, 0x01, 0x8E, 0x16, 0xDC, 0x32, 0xB6, 0x76, 0x6A, 0xD1, 0xAC, 0x87, 0x8E, 0x36,
-    0xBD, 0xDA, 0x53, 0xF4, 0x1A, 0xC9, 0x39, 0x57, 0x67, 0x8A, 0x04, 0xFA, 0x4A, 0x5F, 0x57, 0x3D,
-    0x5D, 0xC5, 0x75, 0x8A, 0x4E, 0x25, 0x41, 0x27, 0xA9, 0xFC, 0xCE, 0xA4, 0xD3, 0x99, 0x9D, 0x6B,
-    0x6B, 0x67, 0x52, 0x5B, 0xBB, 0x93, 0x66, 0x4F, 0x11, 0xFF, 0x3C, 0xE6, 0x44, 0xBF, 0xA1, 0x35,
-    0x51, 0xAF, 0x13, 0x9B, 0xE8, 0x77, 0x6D, 0xAB, 0xDA, 0x6D, 0x54, 0x5B, 0xB7, 0x46, 0x42, 0x35,
-    0xAD, 0x02, 0x6B, 0xE9, 0xFF, 0xFC, 0xAF, 0x48, 0xA5, 0xDA, 0x77, 0x4E, 0x9A, 0x55, 0x54, 0x0A,
-    0x84, 0x2F, 0x49, 0xBC, 0x35, 0xA5, 0xD8, 0xD7, 0xC7, 0xF4, 0x59, 0x71, 0xB4, 0xAB, 0x43, 0x70,
-    0x71, 0x5A, 0xCB, 0xE4, 0x47, 0x45, 0xED, 0xAF, 0x96, 0xD6, 0x57, 0x32, 0x5A, 0x74, 0xB7, 0x7F,
-    0x85, 0xD6, 0x58, 0xFF, 0x44, 0xDF, 0xCC, 0x3D, 0x52, 0xD2, 0x47, 0x24, 0xA9, 0xAB, 0x23, 0x25,
-    0x5E, 0x1D, 0x74, 0x8B, 0x64, 0x44, 0x56, 0x06, 0x85, 0x1E, 0x83, 0xDA, 0xA5, 0x1B, 0xA5, 0x0B,
-    0x55, 0x3B, 0xEB, 0x12, 0x65, 0x40, 0xE3, 0x4E, 0xD4, 0x25, 0xC1, 0x02, 0x39, 0x03, 0xEA, 0xF2,
-    0x54, 0xE8, 0x7B, 0x63, 0x00, 0x1F, 0xD6, 0x27, 0xE5, 0x90, 0x78, 0xBA, 0x39, 0x1A, 0x1E, 0x73,
-    0x82, 0xDA, 0x1C, 0xC1, 0x2E, 0x49, 0xA8, 0x04, 0xBD, 0x1A, 0x1C, 0x32, 0x53, 0xFC, 0xF5, 0x9F,
-    0x7F, 0x89, 0x69, 0xBA, 0xF7, 0x4B, 0x4C, 0xD3, 0x47, 0x59, 0xA9, 0x5C, 0xAA, 0x95, 0x01, 0x9D,
-    0xC2, 0x3D, 0xE8, 0x26, 0xE8, 0x56, 0xE6, 0x8A, 0xA3, 0x3A, 0x92, 0xE9, 0xF2, 0x52, 0xA9, 0x02,
-    0x8D, 0x8A, 0x87, 0x85, 0x54, 0xC7, 0x52, 0x19, 0x05, 0x39, 0x83, 0x58, 0x75, 0xAC, 0xE8, 0xE5,
-    0x6D, 0x8B, 0x63, 0x5F, 0x4F, 0x50, 0x9D, 0x3F, 0x13, 0x61, 0x9E, 0xFA, 0x37, 0xFF, 0x22, 0xE5,
-    0x54, 0x42, 0x0B, 0xE4, 0x74, 0x39, 0xEF, 0xD1, 0x29, 0x56, 0x3A, 0xE8, 0x79, 0xDB, 0x14, 0xBF,
-    0x45, 0x9B, 0xEE, 0x8B, 0x58, 0xB5, 0xE9, 0xBF, 0xF0, 0x55, 0x9B, 0x0E, 0x8C, 0x40, 0x31, 0x0A,
-    0x17, 0xA2, 0x2D, 0xDA, 0x2D, 0x02, 0xBE, 0x72, 0x87, 0xA3, 0x6C, 0x4B, 0x5C, 0xDC, 0x11, 0x69,
-    0x4D, 0xA7, 0x25, 0xEE, 0xBA, 0x42, 0xC8, 0x8E, 0xC6, 0xD2, 0x53, 0x99, 0x22, 0xED, 0xB9, 0x41,
-    0x6F, 0xBE, 0xFC, 0x67, 0xF0, 0x5C, 0xFB, 0xDE, 0x17, 0x80, 0xCE, 0x47, 0x39, 0xF8, 0xB3, 0xFB,
-    0x5E, 0x0E, 0x63, 0x28, 0x20, 0xB9, 0x93, 0x77, 0xA2, 0xC7, 0x98, 0x4E, 0x27, 0x84, 0x46, 0x86,
-    0xF1, 0x77, 0x04, 0xB6, 0x1E, 0x0F, 0x06, 0x64, 0x31, 0x12, 0x10, 0x11, 0x1F, 0x01, 0x66, 0xC8,
-    0x13, 0xEF, 0x08, 0x27, 0xB4, 0xF5, 0x85, 0xE0, 0xFF, 0xB7, 0xB9, 0x58, 0x61, 0xC7, 0x0D, 0x5D,
-    0x1A, 0x13, 0x0F, 0x88, 0x0C, 0x56, 0x84, 0x1B, 0x19, 0x97, 0x29, 0x15, 0x39, 0x4B, 0x2C, 0xC9,
-    0x12, 0x3D, 0xB0, 0x4B, 0x0F, 0xF3, 0xE4, 0x29, 0x4F, 0x1C, 0x79, 0xAC, 0xF9, 0xCB, 0x09, 0x99,
-    0x32, 0xE7, 0xA4, 0xAF, 0x0E, 0x06, 0x83, 0x90, 0x2F, 0x8F, 0x5A, 0x0F, 0x3A, 0x7D, 0x9D, 0x7B,
-    0x01, 0x63, 0x4E, 0xC2, 0x36, 0x4D, 0xC4, 0x86, 0x0A, 0xB8, 0x39, 0x65, 0x3E, 0x46, 0x5E, 0x92,
-    0xB3, 0x94, 0x6E, 0xE8, 0x84, 0xE8, 0xB0, 0xAB, 0xCA, 0x16, 0x14, 0x35, 0x68, 0x92, 0x3D, 0x7A,
-    0x29, 0x62, 0xBA, 0x2B, 0xDA, 0x4A, 0xC6, 0x7E, 0x56, 0x4D, 0x07, 0x83, 0x24, 0x14, 0xA2, 0x20,
-    0xBD, 0x61, 0x90, 0x4A, 0x52, 0x43, 0x6E, 0x15, 0xC2, 0x5B, 0x9D, 0x54, 0x52, 0x82, 0x3C, 0x3D,
-    0xD5, 0x43, 0xD5, 0xCC, 0x9C, 0x54, 0x23, 0x4E, 0xE0, 0x9F, 0x7F, 0x41, 0x82, 0xE9, 0xD1, 0xA6,
-    0xC2, 0x04, 0x92, 0xC1, 0x62, 0x02, 0x89, 0x90, 0x6D, 0x03, 0x72, 0xC7, 0xA6, 0xFB, 0x54, 0x62,
-    0xCC, 0x56, 0xCE, 0x3F, 0xCC, 0x23, 0xAA, 0xA2, 0x4D, 0xEE, 0x87, 0xB6, 0x90, 0xE7, 0xAA, 0xD1,
-    0x2D, 0xE9, 0x63, 0x2C, 0x9D, 0x8C, 0xAD, 0x47, 0xE8, 0x25, 0xE9, 0xAB, 0x4B, 0xC1, 0x29, 0xDD,
-    0x75, 0xDF, 0x67, 0x58, 0x8B, 0x3D, 0x4D, 0xE4, 0xAD, 0x89, 0x44, 0x47, 0xF0, 0xAE, 0x83, 0x00,
-    0x13, 0x98, 0x1E, 0x00, 0x41, 0x9C, 0xE8, 0xC0, 0x4E, 0x63, 0x37, 0x3C, 0x80, 0xC8, 0xF0, 0xD4,
-    0x01, 0x85, 0x9F, 0x3A, 0x40, 0x8F, 0xBB, 0xEA, 0x40, 0x8D, 0xCC, 0x0C, 0x4C, 0xAD, 0xF4, 0x20,
-    0xD6, 0x7B, 0xC2, 0xAB, 0xA9, 0x8D, 0xE1, 0x65, 0x99, 0xB7, 0x67, 0x8F, 0xBE, 0xA7, 0x95, 0xE9,
-    0xC6, 0xBC, 0x18, 0xEB, 0x54, 0xC4, 0x4B, 0xB9, 0xC9, 0x90, 0x29, 0x29, 0xAE, 0x03, 0xBD, 0x57,
-    0xC7, 0xC0, 0x86, 0x35, 0xD5, 0xB6, 0xEB, 0x1A, 0xD7, 0xDA, 0x23, 0x03, 0xCA, 0xBD, 0x43, 0xE7,
-    0xF7, 0xC7, 0x73, 0xDD, 0x33, 0x78, 0xB8, 0x7F, 0x84, 0xE7, 0x8F, 0x8D, 0xC1, 0xE0, 0x7F, 0xEB,
-    0x2C, 0xA7, 0x0D, 0x65, 0x47, 0xFD, 0xD0, 0xFC, 0x17, 0x60, 0x04, 0x50, 0x6F, 0x13, 0x45, 0x7C,
-    0x6E, 0xFF, 0xA5, 0xF1, 0xB9, 0x51, 0x8F, 0x07, 0x96, 0x1A, 0x87, 0x38, 0x8F, 0xF6, 0x49, 0xEC,
-    0x47, 0x14, 0x68, 0xED, 0xAC, 0x95, 0xDA, 0x8B, 0x36, 0x6B, 0x9F, 0xDB, 0x6E, 0x38, 0x6F, 0x30,
-    0xC3, 0x01, 0xAE, 0x56, 0xA5, 0x42, 0x52, 0x7D, 0xB7, 0x87, 0xB6, 0xF5, 0x9E, 0x0E, 0xBA, 0x3E,
-    0xB5, 0x92, 0x00, 0x60, 0xEC, 0x86, 0x3D, 0x73, 0xE4, 0xE4, 0x3D, 0xBB, 0xB0, 0x6A, 0xFA, 0x40,
-    0xB7, 0x37, 0x0E, 0xC3, 0xD3, 0x56, 0xE1, 0x1C, 0x28, 0x75, 0x9A, 0xF5, 0x2F, 0x81, 0x5B, 0x46,
-    0xB1, 0x19, 0xC5, 0x46, 0x81, 0xF9, 0x30, 0x60, 0xC5, 0x10, 0xE4, 0x33, 0x50, 0x00, 0x98, 0xCB,
-    0xA0, 0x3E, 0xDB, 0xC3, 0x1D, 0x59, 0x60, 0x14, 0x4E, 0xEA, 0xFE, 0xB2, 0x48, 0x98, 0x30, 0x39,
-    0x51, 0x1C, 0x62, 0x3D, 0x2D, 0x4F, 0x7E, 0x65, 0x13, 0xF0, 0x1E, 0x69, 0x49, 0x67, 0x4E, 0xC3,
-    0x9D, 0x0C, 0xFA, 0x5C, 0xAB, 0x60, 0x48, 0xAF, 0xA4, 0xCA, 0x3E, 0xF6, 0x9A, 0x90, 0xB6, 0x2F,
-    0xF3, 0x24, 0x58, 0xAC, 0x01, 0x30, 0x30, 0xD1, 0xC7, 0x9A, 0x48, 0xE0, 0x2E, 0x27, 0x86, 0xFA,
-    0x99, 0xD8, 0x22, 0x56, 0x61, 0x62, 0xF0, 0x33, 0xE2, 0x5E, 0x88, 0x77, 0x34, 0x41, 0x05, 0x6F,
-    0x44, 0xCE, 0x19, 0xDA, 0x47, 0x37, 0x69, 0xA4, 0x51, 0xE5, 0x18, 0xF9, 0xB5, 0xEB, 0x1B, 0x6D,
-    0x18, 0xB3, 0x2C, 0xB8, 0xC0, 0x4B, 0x6A, 0x15, 0x4E, 0x66, 0xE7, 0x8B, 0xEE, 0xEF, 0x03, 0xC0,
-    0x09, 0xA6, 0xD2, 0x9E, 0xF8, 0x12, 0xF2, 0xA7, 0x7C, 0xC7, 0xAB, 0x03, 0xD2, 0x22, 0xB9, 0x26,
-    0x35, 0xE0, 0x4C, 0x74, 0x17, 0x45, 0x1D, 0xC7, 0x60, 0xA2, 0x0F, 0xB9, 0xCF, 0x58, 0x44, 0x0D,
-    0x79, 0x80, 0x2F, 0x79, 0x5A, 0xA2, 0x79, 0x91, 0xA7, 0x3B, 0x3B, 0x04, 0xD4, 0x7B, 0x5B, 0x92,
-    0xD4, 0x45, 0xFC, 0x36, 0x4B, 0xD1, 0xED, 0x7E, 0x02, 0xDD, 0x6E, 0xCA, 0x64, 0x29, 0x58, 0x93,
-    0x29, 0x63, 0xAD, 0x60, 0xA4, 0xB0, 0x1E, 0x1C, 0xA8, 0x42, 0x9E, 0x84, 0x8D, 0x19, 0xAD, 0x51,
-    0x23, 0x5A, 0x27, 0xB8, 0xA1, 0xCB, 0x00, 0x71, 0xC1, 0x04, 0x09, 0xD1, 0xEF, 0x8C, 0x70, 0x9B,
-    0x81, 0x60, 0x49, 0xE8, 0x6A, 0x37, 0x02, 0xE4, 0xCD, 0x16, 0xF3, 0x9E, 0x1B, 0xFB, 0xF3, 0xDC,
-    0xFA, 0x72, 0x71, 0x23, 0x54, 0x1E, 0xD8, 0x82, 0xF3, 0xB7, 0x98, 0x1A, 0x88, 0x2A, 0x55, 0x40,
-    0xAE, 0xBD, 0xF6, 0x4A, 0xA3, 0xC3, 0xBE, 0x50, 0x3F, 0xE7, 0x9F, 0x4B, 0x55, 0xFD, 0x4B, 0xF4,
-    0x1D, 0x09, 0xE2, 0x5F, 0xD5, 0x7E, 0x15, 0xBB, 0xA8, 0x55, 0x3D, 0xE0, 0x87, 0x2D, 0x17, 0xA1,
-    0x9B, 0x56, 0x7E, 0x17, 0x2A, 0x5F, 0xA0, 0x07, 0x49, 0xD4, 0x50, 0x73, 0xD4, 0xD5, 0xD1, 0x78,
-    0x6A, 0xD4, 0x92, 0x15, 0x47, 0x8F, 0x2A, 0x94, 0x3C, 0x25, 0xB1, 0x10, 0x27, 0x92, 0x23, 0x40,
-    0x76, 0x25, 0x5F, 0x98, 0x62, 0x23, 0x77, 0x49, 0xE2, 0x08, 0xB3, 0x8E, 0xA8, 0x73, 0x82, 0x11,
-    0x58, 0x30, 0xA6, 0xCA, 0xFA, 0x5D, 0xE5, 0x88, 0x5A, 0x11, 0xDE, 0xDE, 0x2B, 0x98, 0xB5, 0x97,
-    0xE8, 0x76, 0x53, 0x38, 0x89, 0x48, 0x76, 0x49, 0x2C, 0xD2, 0xB6, 0x0B, 0xB5, 0x83, 0x60, 0xD1,
-    0xED, 0x33, 0x8B, 0x53, 0xD6, 0xBE, 0xBB, 0x7A, 0x38, 0xE5, 0x53, 0x35, 0x34, 0x24, 0x9E, 0x0A,
-    0x60, 0x36, 0x06, 0xF2, 0x13, 0x62, 0x37, 0x7D, 0xC1, 0xF6, 0xA3, 0x9D, 0x8C, 0xC3, 0x46, 0x2C,
-    0xF7, 0x94, 0xF6, 0x1B, 0x3B, 0xA1, 0x74, 0x69, 0x4C, 0xF3, 0xA0, 0x27, 0xF3, 0x27, 0x52, 0x90,
-    0x42, 0x80, 0x5C, 0x22, 0xE6, 0x10, 0xB0, 0x66, 0x16, 0x2C, 0xAF, 0xA3, 0x97, 0x59, 0x74, 0xF3,
-    0x2E, 0x74, 0x0B, 0x50, 0x02, 0x8D, 0x07, 0x52, 0x03, 0x0D, 0x08, 0xA1, 0x08, 0xEA, 0x62, 0xA4,
-    0x0A, 0x12, 0x9D, 0x11, 0xCE, 0x93, 0x58, 0x9A, 0x5E, 0x78, 0xCB, 0x7D, 0xD0, 0x91, 0x42, 0x9D,
-    0x31, 0x2D, 0x75, 0xD4, 0x24, 0x03, 0x30, 0x05, 0xAA, 0x49, 0xE6, 0xD0, 0x11, 0x11, 0xA3, 0x4A,
-    0x7E, 0x85, 0xB7, 0x8C, 0x5E, 0xC5, 0x4D, 0x4C, 0xE8, 0xD8, 0x15, 0x1B, 0xDE, 0x93, 0x47, 0x4A,
-    0xBA, 0x18, 0x43, 0xBE, 0x92, 0x19, 0xB7, 0x0E, 0xEA, 0x6B, 0xB4, 0xAC, 0x97, 0x7B, 0x43, 0x9D,
-    0x34, 0xD6, 0x1A, 0x6D, 0xE0, 0x99, 0xC6, 0xB4, 0xFF, 0x4F, 0x9A, 0xF1, 0xD0, 0xAA, 0xD4, 0xC1,
-    0x7B, 0x69, 0x03, 0xCD, 0x80, 0xFA, 0x23, 0x49, 0x14, 0x97, 0x26, 0xA2, 0x20, 0xE7, 0xCA, 0xFE,
-    0xF6, 0x5B, 0x0C, 0x43, 0xB4, 0x2D, 0x99, 0xF1, 0x81, 0xE4, 0x2F, 0x70, 0xA4, 0x1D, 0x01, 0xD1,
-    0x1C, 0xC8, 0x89, 0x86, 0x92, 0x7C, 0x65, 0x7F, 0xF9, 0x68, 0x4C, 0x9E, 0xC3, 0x94, 0x25, 0xB2,
-    0x7D, 0x49, 0x62, 0x30, 0xF6, 0x16, 0xB0, 0xD6, 0x39, 0xAE, 0x73, 0xE7, 0x45, 0xB9, 0xDE, 0xDA,
-    0x94, 0xB6, 0x5C, 0x38, 0xD0, 0xC4, 0x31, 0xD4, 0xD7, 0xD4, 0x7E, 0x9D, 0x1F, 0xEA, 0x6A, 0x11,
-    0xE7, 0x3D, 0x49, 0xDE, 0x06, 0x3E, 0x5D, 0x65, 0xBC, 0xB5, 0xB4, 0x55, 0xEE, 0xA5, 0x82, 0xE1,
-    0xAD, 0x9C, 0x54, 0x29, 0x76, 0xA1, 0x28, 0xFA, 0xA2, 0x46, 0x33, 0x48, 0xA0, 0x9A, 0x04, 0x22,
-    0xCD, 0xE8, 0x16, 0x2A, 0x9F, 0x5E, 0x58, 0xA9, 0x7A, 0x3A, 0x8B, 0xA8, 0xA7, 0xF3, 0x8D, 0x7A,
-    0xC2, 0x0A, 0x25, 0x95, 0x51, 0xBC, 0x89, 0x56, 0x61, 0xD3, 0x1C, 0x01, 0x5F, 0x9C, 0x98, 0x55,
-    0x04, 0xE3, 0xA3, 0x76, 0x60, 0x7A, 0xD5, 0x8F, 0x84, 0xD3, 0x6E, 0xEB, 0x49, 0xBD, 0x1D, 0x8A,
-    0xBA, 0xCC, 0xEE, 0x59, 0xBF, 0x4C, 0xE8, 0xA4, 0xFD, 0xDB, 0xFF, 0x44, 0xED, 0x56, 0x13, 0xA0,
-    0x29, 0xB9, 0xC5, 0x86, 0x7C, 0xB7, 0xC3, 0xC5, 0xEC, 0x62, 0xDA, 0x3F, 0xD9, 0x26, 0xD3, 0x48,
-    0x0A, 0xBB, 0xCA, 0x9C, 0x2F, 0xEE, 0x98, 0xEF, 0x33, 0xFF, 0xA9, 0xCE, 0x7D, 0xAA, 0xDB, 0xDE,
-    0x96, 0x36, 0xFB, 0xBD, 0x1A, 0x5A, 0x59, 0x03, 0xE9, 0x9C, 0x53, 0x6D, 0xBA, 0xDF, 0xD4, 0xD0,
-    0x0B, 0xC1, 0xA8, 0xC6, 0x4E, 0xE6, 0x96, 0xD6, 0xA8, 0x45, 0x47, 0x6B, 0xAE, 0x92, 0x92, 0x9E,
-    0x3D, 0x43, 0x3B, 0x95, 0xEA, 0xAC, 0x8D, 0xC7, 0x53, 0x21, 0xAE, 0x1F, 0xFF, 0x87, 0xD7, 0xD5,
-    0x89, 0xCF, 0xEF, 0xAE, 0xBD, 0xAA, 0xDE, 0x18, 0x0C, 0x22, 0x49, 0x53, 0xC5, 0xA1, 0x7F, 0xD3,
-    0xB2, 0xC2, 0xA5, 0x76, 0x9F, 0xB9, 0x35, 0x3B, 0x4F, 0xBE, 0x0A, 0xC8, 0x09, 0xAA, 0xBD, 0x1D,
-    0x20, 0x1F, 0x67, 0x32, 0x6F, 0xB2, 0xA8, 0xA8, 0x0F, 0x3D, 0x73, 0xF2, 0x95, 0x3B, 0x4B, 0xBE,
-    0x92, 0x4C, 0x1F, 0xE8, 0x02, 0x4A, 0xFB, 0x83, 0x21, 0xBB, 0x05, 0x99, 0x33, 0x55, 0x87, 0x69,
-    0xD7, 0x81, 0x3A, 0x8E, 0x64, 0x1F, 0xDF, 0x98, 0x79, 0xFB, 0xFC, 0x05, 0x8F, 0x5F, 0x6F, 0x41,
-    0x19, 0x0C, 0x66, 0xEE, 0xCE, 0x57, 0x40, 0xFA, 0x34, 0xD5, 0xC6, 0x35, 0x73, 0x5A, 0x57, 0x1A,
-    0x4C, 0xC5, 0x8B, 0x7E, 0x68, 0x47, 0xAA, 0xFF, 0x87, 0x3A, 0xA7, 0xCA, 0xA0, 0xA0, 0x43, 0xFB,
-    0x8C, 0xDF, 0x62, 0xEA, 0xD3, 0x1F, 0xB6, 0x71, 0x2A, 0xF8, 0x4B, 0x34, 0x56, 0x52, 0x4A, 0x42,
-    0xE1, 0xD0, 0x4C, 0xA8, 0xB6, 0xD2, 0xD7, 0x25, 0x67, 0xBF, 0x35, 0x9B, 0x9E, 0x1F, 0x5E, 0xEC,
-    0x40, 0xD7, 0x18, 0x77, 0x35, 0xD3, 0x07, 0xEB, 0xEC, 0x8F, 0x82, 0x69, 0xDC, 0x0F, 0xDF, 0x15,
-    0xFE, 0x43, 0xCD, 0xFC, 0xB2, 0xD0, 0xC4, 0x5B, 0xC3, 0x77, 0x2F, 0x17, 0x6A, 0x93, 0xF9, 0x1A,
-    0x61, 0xCF, 0x9D, 0xFC, 0x31, 0xDD, 0xF6, 0xCA, 0x6C, 0x8C, 0x70, 0xA7, 0xCE, 0x6F, 0x51, 0x97,
-    0x9B, 0x27, 0x5F, 0x30, 0x97, 0xD1, 0x57, 0x6C, 0xE6, 0x7E, 0xA4, 0x65, 0x85, 0x01, 0xEC, 0x37,
-    0xD2, 0xFF, 0x88, 0x07, 0xA4, 0x3F, 0x55, 0x5C, 0x9F, 0x04, 0x2A, 0x78, 0x4D, 0x3D, 0xCB, 0x67,
-    0x53, 0xB3, 0xAB, 0xFF, 0xA6, 0x02, 0x91, 0x3D, 0x56, 0x15, 0xFD, 0xCF, 0x9F, 0x88, 0x97, 0xEE,
-    0x7A, 0xF6, 0xE3, 0xEF, 0xCB, 0x05, 0x6A, 0x4F, 0x3D, 0xD7, 0x87, 0x39, 0xBD, 0x0B, 0x0D, 0x2B,
-    0xEA, 0x86, 0x45, 0x3F, 0x6D, 0x2E, 0xD0, 0x0D, 0x6B, 0x90, 0xDA, 0x9E, 0xD4, 0x5F, 0xDE, 0xDC,
-    0xAF, 0xBF, 0xBC, 0x7D, 0x02, 0xE1, 0xE7, 0xCC, 0x51, 0xA9, 0x9F, 0x35, 0x5F, 0x46, 0xCD, 0x17,
-    0x2D, 0x29, 0xBF, 0xDF, 0xA8, 0x9D, 0x8E, 0xA4, 0x5F, 0x47, 0x7A, 0x25, 0x85, 0xA8, 0x10, 0xC4,
-    0x20, 0x6D, 0xD8, 0x17, 0x8D, 0x84, 0x25, 0x22, 0x47, 0x27, 0xF3, 0xE6, 0x56, 0x7F, 0xDE, 0xD2,
-    0x82, 0x39, 0x6C, 0xC6, 0xE7, 0x58, 0xD9, 0x63, 0x3D, 0x50, 0xA9, 0xFA, 0x1F, 0x7A, 0x04, 0xD3,
-    0x67, 0x1F, 0x1B, 0xE9, 0xFA, 0xEF, 0xA3, 0xFC, 0x55, 0x23, 0xED, 0xCB, 0xC6, 0x25, 0xC0, 0xA8,
-    0x68, 0x9F, 0x2A, 0xE8, 0x15, 0xFD, 0x56, 0xE8, 0x18, 0x4D, 0x07, 0x37, 0xE7, 0x3A, 0xFE, 0x9C,
-    0xAF, 0xF2, 0x01, 0x27, 0xDE, 0x5C, 0x28, 0xFD, 0x44, 0x3E, 0xEE, 0x90, 0xE9, 0x30, 0xE0, 0xDA,
-    0xBC, 0xC4, 0xF8, 0x70, 0x76, 0xC9, 0x96, 0xB0, 0x68, 0x7A, 0x0E, 0x72, 0x31, 0x23, 0x05, 0x26,
-    0x02, 0x1F, 0x4B, 0x8A, 0xEF, 0x6F, 0x09, 0xED, 0xCF, 0x09, 0x61, 0x89, 0xD3, 0x45, 0x23, 0xA9,
-    0xBF, 0x43, 0x81, 0x25, 0xA1, 0xC5, 0x4C, 0xBE, 0xB6, 0x9D, 0x31, 0x1B, 0x18, 0x1C, 0x0F, 0x30,
-    0x90, 0xCC, 0xE0, 0xA1, 0x24, 0x09, 0x4B, 0xCE, 0x6F, 0x50, 0x08, 0xCC, 0x94, 0xF5, 0x80, 0x29,
-    0xBE, 0x60, 0x94, 0x41, 0x9D, 0xCB, 0xA8, 0x97, 0x94, 0x35, 0x59, 0x9E, 0xB2, 0xF0, 0x44, 0x53,
-    0xA1, 0x98, 0x75, 0x0C, 0x0E, 0x68, 0xA4, 0x88, 0x5A, 0xA9, 0xF0, 0x58, 0x0C, 0xB8, 0x50, 0x1B,
-    0x91, 0x64, 0x23, 0x9C, 0x71, 0x40, 0xF3, 0x8E, 0x76, 0x32, 0xC4, 0x64, 0xA3, 0xB1, 0xF2, 0x09,
-    0x62, 0x82, 0xD1, 0x88, 0x3A, 0xCF, 0x88, 0x0A, 0x10, 0x80, 0x13, 0x8E, 0x68, 0x30, 0x03, 0x74,
-    0x09, 0x98, 0xF1, 0x7E, 0xC8, 0x14, 0xF5, 0x84, 0x99, 0xF0, 0x50, 0x51, 0xAA, 0x14, 0x2A, 0x9B,
-    0x18, 0x6C, 0xA2, 0xD6, 0x38, 0x33, 0xC5, 0xC6, 0x9F, 0xB5, 0xF1, 0xC2, 0x02, 0x2F, 0x62, 0x82,
-    0x3C, 0x24, 0x7D, 0x51, 0x83, 0x95, 0xEC, 0xAA, 0x02, 0x7B, 0xB3, 0x68, 0x19, 0x5B, 0x0F, 0xAE,
-    0x4F, 0x78, 0xAC, 0x4F, 0x00, 0x61, 0x95, 0x49, 0x6C, 0x50, 0x03, 0xF9, 0x89, 0x13, 0xF9, 0xBF,
-    0x9B, 0xD4, 0x17, 0x57, 0x53, 0xDD, 0x39, 0x3B, 0x9D, 0x97, 0xFD, 0x87, 0x7B, 0x3A, 0x7E, 0x76,
-    0x3F, 0x5C, 0x3A, 0xBE, 0x54, 0x84, 0x8D, 0x56, 0x0C, 0x55, 0x31, 0xB7, 0x72, 0xC8, 0x68, 0x98,
-    0xCD, 0x04, 0x25, 0xA9, 0x8D, 0x31, 0x8E, 0x8F, 0x50, 0xA2, 0xA0, 0xBA, 0x5B, 0xAF, 0x1C, 0x48,
-    0x56, 0xAD, 0xEA, 0x28, 0xDA, 0xAD, 0x7B, 0x45, 0xDB, 0xFA, 0x4D, 0xEE, 0x5F, 0x67, 0x92, 0x33,
-    0xB3, 0x74, 0x13, 0x71, 0x41, 0xE0, 0xBA, 0x70, 0x5D, 0xB2, 0xD9, 0x3C, 0x77, 0x60, 0x67, 0x96,
-    0x3B, 0x30, 0x5C, 0x97, 0x3B, 0x60, 0x7E, 0x5E, 0x24, 0xC6, 0x37, 0x79, 0x92, 0x26, 0x75, 0xEE,
-    0x40, 0xA5, 0x62, 0xE3, 0x3F, 0xA7, 0x31, 0x38, 0xE8, 0xCA, 0xDC, 0x81, 0x53, 0xA3, 0x61, 0xA7,
-    0xF5, 0xCA, 0x95, 0xD4, 0x1F, 0x0C, 0xC2, 0x97, 0xB9, 0x02, 0x91, 0xA6, 0x4F, 0xFD, 0x7F, 0xFB,
-    0xB3, 0x22, 0xA9, 0x8A, 0x61, 0x67, 0xFB, 0x19, 0x03, 0x51, 0x98, 0xBC, 0x12, 0x65, 0x6C, 0x3D,
-    0x1C, 0xDC, 0x5D, 0x97, 0x08, 0x7C, 0xE9, 0xC1, 0x35, 0x89, 0xCD, 0xB2, 0x3C, 0x4B, 0xE2, 0xF0,
-    0xE6, 0x60, 0xC0, 0x29, 0x55, 0xF6, 0xC3, 0xC1, 0xA9, 0xE9, 0xA6, 0x96, 0x43, 0x7D, 0x73, 0x2D,
-    0x3A, 0xA4, 0x5A, 0xC7, 0x7E, 0xDA, 0x30, 0xF9, 0xB2, 0x70, 0x4E, 0x16, 0xD9, 0x70, 0xD5, 0x00,
-    0xD1, 0xA1, 0xAC, 0x57, 0x00, 0x70, 0x31, 0x8E, 0x4F, 0xD6, 0xB0, 0x58, 0x6A, 0x92, 0xD8, 0xD5,
-    0xB3, 0x03, 0x79, 0xBA, 0x77, 0xA9, 0x50, 0x74, 0xDD, 0xCD, 0xD2, 0x34, 0xEE, 0xA0, 0x6D, 0x85,
-    0x3A, 0x1C, 0xDC, 0x59, 0x11, 0x26, 0x8E, 0x24, 0x77, 0x6C, 0xB8, 0xC9, 0x98, 0x4A, 0xBF, 0x8E,
-    0xA9, 0x2C, 0x86, 0x8B, 0x25, 0x9D, 0x29, 0x9A, 0x07, 0x2C, 0x02, 0x65, 0x5E, 0x9D, 0xC8, 0xEA,
-    0x0F, 0xB3, 0xB6, 0xFA, 0x7A, 0x54, 0x29, 0x3D, 0x25, 0x3A, 0xDF, 0xAE, 0xA8, 0x5B, 0xA2, 0xA6,
-    0xD1, 0x7F, 0xA5, 0xC8, 0x95, 0x24, 0xAD, 0x58, 0x14, 0x35, 0x05, 0x95, 0x8B, 0xCD, 0x74, 0xEE,
-    0xE5, 0x92, 0x2C, 0xFD, 0xF5, 0x97, 0xC2, 0x36, 0xBF, 0xFD, 0x8D, 0xF0, 0x4A, 0xED, 0x9D, 0x31,
-    0xBF, 0xF9, 0xB5, 0x90, 0xF3, 0x97, 0xFF, 0x3C, 0xD2, 0x57, 0x4A, 0x0C, 0x97, 0x6E, 0x33, 0x45,
-    0x46, 0x07, 0x1D, 0xC3, 0xE0, 0x33, 0xB9, 0x54, 0x41, 0xDE, 0x20, 0xEF, 0x9B, 0x6C, 0x0B, 0x9B,
-    0xEB, 0x17, 0xC2, 0xE7, 0x3C, 0xCD, 0x8C, 0xCD, 0xA7, 0x57, 0xC6, 0x36, 0xF3, 0xC6, 0x5E, 0x8D,
-    0xDC, 0xD0, 0x95, 0xF4, 0x6F, 0x57, 0x5C, 0xFC, 0x2E, 0x59, 0xF5, 0xD8, 0xA5, 0xAD, 0xED, 0xBB,
-    0x12, 0xAC, 0xF9, 0x4B, 0x32, 0x9E, 0xD6, 0x57, 0xB1, 0x40, 0x9A, 0x06, 0xEE, 0x4D, 0x1E, 0xD1,
-    0x67, 0x71, 0x25, 0xFD, 0x1E, 0xBC, 0x8B, 0x16, 0xEA, 0xAE, 0xA4, 0x70, 0xBB, 0xE3, 0x21, 0x93,
-    0xB4, 0xC7, 0x0B, 0x26, 0xE4, 0x3A, 0x78, 0xED, 0xCC, 0x96, 0xDD, 0xBC, 0x59, 0xAB, 0xF8, 0x0C,
-    0x7D, 0xB3, 0x5C, 0x4A, 0xB5, 0xF0, 0xBF, 0x40, 0x15, 0xF2, 0x05, 0xF3, 0xD9, 0xAE, 0xAC, 0x78,
-    0x36, 0xA5, 0x81, 0x5E, 0xEA, 0x13, 0x2B, 0xAE, 0x5B, 0x11, 0x0F, 0x29, 0xC3, 0x12, 0x91, 0x8E,
-    0x2A, 0x48, 0xC2, 0xA8, 0x24, 0x81, 0xB6, 0xF9, 0xC4, 0xB6, 0xA0, 0x2E, 0xA5, 0x47, 0xC0, 0x97,
-    0xB5, 0x0F, 0x09, 0xA8, 0x3A, 0xB5, 0x1D, 0x59, 0x4B, 0x37, 0x6A, 0xEE, 0x60, 0x3B, 0x24, 0xB8,
-    0x81, 0xE7, 0x3D, 0x0A, 0x19, 0x7D, 0xD0, 0x0B, 0x77, 0x9A, 0x58, 0xDF, 0x2A, 0x60, 0x84, 0xB7,
-    0xD4, 0x1B, 0x75, 0x9C, 0xB0, 0x54, 0x92, 0x66, 0xC0, 0x18, 0x22, 0x9E, 0x14, 0xC7, 0xDA, 0x0D,
-    0x7F, 0x48, 0x3F, 0xF8, 0x50, 0x1B, 0x5C, 0x72, 0xCE, 0x6A, 0x62, 0x8B, 0x7D, 0xB0, 0x49, 0x77,
-    0x61, 0x68, 0x17, 0x8B, 0xB1, 0x7D, 0xB2, 0x7B, 0xAF, 0xB3, 0x7B, 0x5B, 0xEC, 0x5E, 0x9B, 0x8D,
-    0x65, 0xFA, 0x4E, 0x3B, 0x58, 0xD7, 0x3D, 0x2E, 0xAA, 0x69, 0x4B, 0x2C, 0x20, 0x60, 0xF7, 0xB6,
-    0x78, 0xC7, 0xE5, 0x85, 0xEE, 0x89, 0x3B, 0xB9, 0x94, 0x48, 0x81, 0x92, 0x0E, 0xBC, 0x86, 0x0E,
-    0xFC, 0x0C, 0x1D, 0xF8, 0x13, 0x74, 0x00, 0xA8, 0x11, 0xF7, 0xEB, 0x0E, 0x94, 0xBA, 0x48, 0x07,
-    0x78, 0x8C, 0xE7, 0xFE, 0x04, 0x1D, 0xF8, 0x19, 0x3A, 0xF0, 0xD6, 0xAE, 0x24, 0x88, 0x82, 0x61,
-    0xD1, 0xD2, 0xC0, 0xCC, 0xFE, 0x1E, 0x44, 0x3D, 0xE3, 0xA8, 0xCC, 0xB1, 0xE0, 0x22, 0x38, 0xEA,
-    0x07, 0x30, 0x41, 0x20, 0xC1, 0x33, 0xFA, 0x63, 0x64, 0x19, 0x22, 0x27, 0x5C, 0x83, 0x07, 0xBB,
-    0x64, 0x76, 0x74, 0xA7, 0xE8, 0x4B, 0x98, 0xE5, 0x9F, 0x99, 0xBC, 0x8D, 0xA6, 0x56, 0x86, 0x21,
-    0x6D, 0xC4, 0xA4, 0xC3, 0xC7, 0x8B, 0xE4, 0x9D, 0x71, 0xB8, 0x9D, 0x87, 0x77, 0x84, 0xA3, 0x30,
-    0x5F, 0x41, 0x1F, 0x33, 0xEE, 0xD8, 0x69, 0x2B, 0xA7, 0x6F, 0x89, 0x2E, 0x02, 0x3B, 0x1D, 0x2B,
-    0xFB, 0x1E, 0xB8, 0xE4, 0xDF, 0xA7, 0xCA, 0xFE, 0x0A, 0xE7, 0xBF, 0x82, 0x00, 0xFD, 0xFB, 0x4C,
-    0x1F, 0xE3, 0x39, 0xC9, 0xB3, 0xA5, 0xAB, 0x84, 0xF7, 0x18, 0x25, 0x99, 0x58, 0x4F, 0x31, 0x0A,
-    0x56, 0xAA, 0xDB, 0x87, 0xF2, 0x32, 0x5F, 0xCC, 0x31, 0xBF, 0xE6, 0x7C, 0x1C, 0x5B, 0x59, 0x9E,
-    0xA1, 0x7C, 0x59, 0x81, 0xE2, 0x73, 0x95, 0xB8, 0xF2, 0xC5, 0x80, 0x97, 0x81, 0x57, 0xBE, 0xA4,
-    0x41, 0xFB, 0xA2, 0x94, 0xFB, 0x62, 0x28, 0xF9, 0xE2, 0x25, 0xF5, 0xD5, 0x44, 0xCD, 0x9F, 0xE3,
-    0xA4, 0x7A, 0x5D, 0xB2, 0x2C, 0x23, 0x1C, 0x0B, 0x4F, 0xDD, 0x05, 0xEF, 0x54, 0x9B, 0x11, 0xC4,
-    0xA1, 0x1B, 0x5E, 0xDC, 0xD1, 0x4B, 0x27, 0x98, 0xAC, 0xCC, 0x8B, 0x84, 0xF4, 0x5D, 0x71, 0x8B,
-    0x90, 0x8C, 0x5D, 0xE1, 0x0A, 0xE4, 0x71, 0xFA, 0x84, 0x5C, 0x22, 0xF9, 0xD1, 0x7C, 0xBC, 0x4B,
-    0x12, 0x70, 0x65, 0x35, 0xD7, 0x59, 0xAE, 0x6A, 0xFA, 0x47, 0x82, 0x89, 0x00, 0xF5, 0x24, 0xAF,
-    0xF4, 0x85, 0x5B, 0x5C, 0xD6, 0x1A, 0x53, 0xAC, 0xAE, 0x06, 0x40, 0x74, 0xE6, 0xAA, 0x68, 0xB0,
-    0xE6, 0x3A, 0x6A, 0x74, 0x06, 0x94, 0x05, 0x82, 0x99, 0x92, 0xB6, 0x02, 0x6C, 0xE8, 0x98, 0x25,
-    0x83, 0x5B, 0x4E, 0xC5, 0x01, 0x70, 0x1E, 0xEE, 0xE9, 0x85, 0x57, 0x4F, 0x86, 0xC1, 0x2C, 0x52,
-    0xC9, 0x40, 0x25, 0xFA, 0xAF, 0x9E, 0xE5, 0xAE, 0xD3, 0x10, 0x7D, 0x1D, 0x7C, 0xC2, 0x56, 0x8E,
-    0x01, 0x8E, 0xAF, 0x7D, 0xA7, 0xBE, 0x2E, 0x82, 0x40, 0xE7, 0xD1, 0xD5, 0x15, 0x04, 0xF9, 0xE1,
-    0xF3, 0x2E, 0x90, 0x0F, 0x3A, 0x92, 0x60, 0x13, 0xE8, 0x10, 0x6A, 0x20, 0xE1, 0x25, 0x22, 0x75,
-    0xBD, 0x32, 0xBE, 0x5E, 0x12, 0x3F, 0xD6, 0xD5, 0x50, 0x57, 0xBB, 0xBA, 0xF2, 0x57, 0x56, 0x4B,
-    0xDE, 0xBE, 0x3A, 0xEE, 0x30, 0x5E, 0x70, 0x5A, 0xEE, 0xB9, 0x85, 0x16, 0xB0, 0x5A, 0xCE, 0x6A,
-    0xF3, 0xB5, 0x4E, 0xE0, 0xAC, 0x43, 0x6F, 0xCC, 0x1C, 0x49, 0x9F, 0x98, 0x5D, 0x52, 0x1D, 0x09,
-    0xAC, 0xC4, 0x37, 0xDD, 0x97, 0x8C, 0x03, 0x9B, 0x99, 0x23, 0xA9, 0xA5, 0x73, 0x4C, 0x04, 0x1A,
-    0xC5, 0x2C, 0xBB, 0x24, 0x95, 0x18, 0xB7, 0xAA, 0x61, 0x31, 0x97, 0xBA, 0xB2, 0xB8, 0xFD, 0x2D,
-    0x57, 0x6F, 0x78, 0x40, 0x0C, 0x71, 0x27, 0xCB, 0xA6, 0x92, 0x2D, 0xED, 0xA4, 0x6A, 0xA2, 0xCC,
-    0xE9, 0xD5, 0x66, 0x61, 0x18, 0xE7, 0x32, 0xE1, 0x2A, 0x2D, 0xAB, 0xE2, 0x62, 0x7E, 0xE7, 0x8B,
-    0xB1, 0xF8, 0xCB, 0x87, 0x12, 0x05, 0xF4, 0x05, 0x06, 0x42, 0xCC, 0xCB, 0x30, 0x90, 0xB3, 0x81,
-    0xAC, 0xBE, 0xA4, 0x27, 0x99, 0xD1, 0x44, 0xE7, 0x6F, 0x4A, 0x70, 0xDA, 0xD6, 0xD7, 0x05, 0x9E,
-    0x2F, 0x5A, 0x4C, 0x22, 0xBA, 0x87, 0x2D, 0x31, 0x57, 0x18, 0xF3, 0x55, 0x38, 0xCF, 0xE5, 0x02,
-    0x4F, 0x64, 0xCA, 0xCA, 0x91, 0x48, 0x48, 0x83, 0x3E, 0x7A, 0x18, 0x9B, 0xBE, 0x9A, 0x4E, 0x18,
-    0x74, 0x0B, 0x54, 0x8F, 0xEA, 0x42, 0x97, 0xD2, 0xBF, 0x47, 0xD0, 0xA6, 0xDB, 0x2F, 0xA0, 0x17,
-    0xDB, 0x0D, 0x81, 0x6F, 0x4E, 0xD6, 0x1F, 0x69, 0x23, 0x42, 0xBF, 0xC2, 0x08, 0x77, 0xC2, 0x65,
-    0x17, 0x4E, 0x68, 0x88, 0x0B, 0xE7, 0xC4, 0xFA, 0xB9, 0xEF, 0xE8, 0xC2, 0x29, 0xB4, 0x0B, 0xE7,
-    0x0D, 0xD5, 0xAC, 0x37, 0xE4, 0xC0, 0xFE, 0x82, 0x17, 0xBD, 0xAB, 0x1A, 0x13, 0x4A, 0x00, 0xA3,
-    0x05, 0xE6, 0x44, 0xD5, 0xFB, 0x8A, 0x34, 0x2E, 0x9C, 0x47, 0x3F, 0x79, 0xA2, 0x0B, 0xC7, 0x5F,
-    0x72, 0xE1, 0x6C, 0xD6, 0x09, 0x5B, 0x93, 0x79, 0x76, 0x9D, 0x91, 0xEB, 0x89, 0xFE, 0xBD, 0x5C,
-    0xFB, 0x74, 0x37, 0xE6, 0x2B, 0xF7, 0x6E, 0x7F, 0xF6, 0xF0, 0xD3, 0x17, 0x5B, 0xB1, 0xF7, 0x40,
-    0x1B, 0xA9, 0x56, 0xB5, 0x26, 0x9F, 0xF8, 0xA2, 0x60, 0x33, 0x97, 0xBE, 0xBD, 0xB3, 0x3F, 0x88,
-    0x4E, 0xE5, 0xC0, 0xAC, 0x2D, 0xA1, 0x78, 0xFB, 0xA4, 0xA8, 0x55, 0x65, 0x5B, 0x56, 0xB3, 0x51,
-    0x7B, 0x91, 0x00, 0x76, 0xAC, 0x43, 0xBF, 0x76, 0xCA, 0xD8, 0x36, 0x34, 0x50, 0xE0, 0x34, 0xA5,
-    0x1C, 0xA3, 0xE6, 0x12, 0xFE, 0x55, 0x01, 0x87, 0xCA, 0x1D, 0x37, 0x9E, 0x03, 0x99, 0x13, 0xC1,
-    0xF8, 0xA7, 0x83, 0xC5, 0xA4, 0xA2, 0x40, 0x27, 0x15, 0xA5, 0x75, 0x52, 0x51, 0xC8, 0xC4, 0x02,
-    0x8B, 0xFE, 0x50, 0x3A, 0x2B, 0x25, 0xA9, 0x88, 0x6B, 0xDC, 0x17, 0x82, 0x31, 0x4D, 0x52, 0xD1,
-    0x9A, 0xF2, 0xC2, 0x9D, 0x30, 0x3E, 0x78, 0x10, 0xEA, 0xD5, 0x38, 0x02, 0x5E, 0xB0, 0x13, 0x3D,
-    0x1D, 0x55, 0x5A, 0xD1, 0x09, 0x07, 0x74, 0xE2, 0x48, 0x90, 0xE3, 0x74, 0x27, 0x96, 0xD6, 0x2E,
-    0x8E, 0x5F, 0x74, 0xED, 0x62, 0x36, 0x5B, 0xBB, 0xC8, 0x30, 0x8B, 0x3A, 0xDC, 0x66, 0xDE, 0x05,
-    0x53, 0x31, 0xDC, 0x15, 0xDB, 0x40, 0x2C, 0x6C, 0x08, 0xB1, 0xFD, 0x0E, 0xA4, 0x27, 0x33, 0x4B,
-    0xC4, 0xC1, 0x5C, 0x80, 0x2B, 0xD0, 0xB9, 0x1F, 0xE3, 0x1D, 0x54, 0xE9, 0x18, 0x9B, 0x61, 0xE1,
-    0x77, 0x1C, 0xE3, 0x39, 0x5E, 0x83, 0x6B, 0xA1, 0x6A, 0x59, 0x53, 0x5F, 0x3B, 0x2F, 0x57, 0xA4,
-    0x61, 0xAA, 0x8B, 0x20, 0x94, 0x09, 0x4C, 0x29, 0x54, 0x53, 0xA8, 0x0F, 0xB7, 0xF7, 0x1F, 0x7E,
-    0x4A, 0x2D, 0x42, 0x96, 0x12, 0x9F, 0x4B, 0x75, 0xBF, 0xF3, 0xC1, 0x23, 0xD9, 0x86, 0x81, 0x6C,
-    0xB0, 0xAE, 0x16, 0xC2, 0x4A, 0x4F, 0xAA, 0x36, 0x48, 0x7D, 0xE1, 0x1D, 0x9A, 0x30, 0x7F, 0x5A,
-    0xA8, 0x77, 0x92, 0xC1, 0x55, 0xAD, 0x47, 0xBD, 0x08, 0x1C, 0xE9, 0x2C, 0x8A, 0xA8, 0x86, 0xB5,
-    0x29, 0xB2, 0x1E, 0x6E, 0xE8, 0xB4, 0xD0, 0x58, 0xC9, 0xAE, 0x37, 0xCF, 0x06, 0x76, 0x99, 0x4B,
-    0x10, 0x3C, 0xD4, 0x89, 0x0E, 0x87, 0xCA, 0xF8, 0x3F, 0x7B, 0x6B, 0x39, 0xAE, 0x4F, 0x56, 0x49,
-    0xE5, 0x5E, 0x83, 0xF5, 0xD1, 0xF5, 0xED, 0xBB, 0xCA, 0xDC, 0x2B, 0x25, 0xDC, 0xBA, 0x5C, 0xC6,
-    0xB2, 0xB6, 0xC4, 0xCE, 0xFA, 0x9D, 0x2A, 0xF3, 0xAA, 0x6F, 0xB2, 0xCD, 0xE9, 0x7B, 0x8B, 0x1C,
-    0x8E, 0xB2, 0x66, 0xAA, 0xCB, 0x6A, 0xFC, 0x60, 0xF7, 0xD8, 0xEA, 0x53, 0xC5, 0x08, 0xFD, 0xD8,
-    0x8A, 0x66, 0xA5, 0x6F, 0x45, 0x87, 0xC1, 0x6F, 0xAA, 0xA9, 0xCD, 0x2E, 0xED, 0x1F, 0x01, 0x01,
-    0xA3, 0xE5, 0xB2, 0xF0, 0xDC, 0xBB, 0xD0, 0x6F, 0xB9, 0x85, 0xC1, 0xAC, 0xBC, 0x82, 0x72, 0xB9,
-    0x95, 0x8E, 0x51, 0xE2, 0xCB, 0x6E, 0xDA, 0xFF, 0xA3, 0x2A, 0xF5, 0xAA, 0xDF, 0xA4, 0x9B, 0x53,
-    0xA8, 0x01, 0x97, 0x17, 0x4A, 0x9D, 0x16, 0xDA, 0x5E, 0xB7, 0xFA, 0x76, 0x01, 0x18, 0x9F, 0xE2,
-    0x45, 0xF4, 0x40, 0x04, 0xD5, 0x3E, 0x84, 0xF6, 0x9E, 0xAC, 0xEF, 0x13, 0x6F, 0x3B, 0x98, 0xD1,
-    0xB3, 0x02, 0xB5, 0x26, 0xD1, 0x5D, 0xCA, 0xA5, 0x92, 0xCE, 0xAE, 0x30, 0x79, 0xB0, 0x93, 0x26,
-    0xA1, 0x38, 0xBB, 0xF2, 0xA1, 0xE4, 0xD4, 0x3F, 0x5B, 0x69, 0x14, 0x8F, 0x96, 0x84, 0x02, 0x65,
-    0xAD, 0xA9, 0xAA, 0xAE, 0xC2, 0xA2, 0xB2, 0x24, 0x86, 0x4C, 0x4E, 0x41, 0x47, 0x03, 0x50, 0xF2,
-    0xB2, 0xAC, 0xEE, 0xDF, 0x92, 0x0D, 0x01, 0x34, 0x0C, 0xAA, 0xC1, 0x60, 0xC0, 0xE5, 0xC3, 0x4C,
-    0x64, 0x49, 0xF0, 0xFD, 0x13, 0x2D, 0x96, 0xEB, 0x26, 0x4B, 0xFC, 0xAC, 0x0E, 0xD0, 0xEA, 0xF8,
-    0x8D, 0xA5, 0x15, 0xA2, 0x2A, 0xDC, 0x94, 0x1D, 0x07, 0x2A, 0xD9, 0xCF, 0x4A, 0xF0, 0x5B, 0x7C,
-    0xA8, 0x5A, 0xE5, 0x98, 0x52, 0xE5, 0xD8, 0x89, 0x2E, 0x90, 0x71, 0x88, 0x0B, 0xB7, 0x4B, 0xA7,
-    0xA0, 0x7F, 0xD8, 0xF9, 0xA0, 0xF0, 0xF0, 0xA6, 0x62, 0x73, 0xCA, 0x94, 0xE3, 0xEE, 0x4C, 0xDF,
-    0x13, 0x0C, 0x15, 0xB5, 0xC1, 0xC9, 0x0C, 0x3A, 0x75, 0xAB, 0xB4, 0xD6, 0xA0, 0x8C, 0xB9, 0x1B,
-    0x7D, 0x4D, 0xF7, 0xEC, 0x73, 0xEA, 0x9E, 0xBE, 0x6F, 0x1D, 0xBC, 0xD8, 0xE8, 0x5B, 0x92, 0x4D,
-    0x64, 0xBF, 0x9C, 0xCE, 0xDB, 0xA9, 0x5A, 0x0D, 0x30, 0xD4, 0xC9, 0x34, 0x99, 0xB6, 0xB2, 0xA7,
-    0xFD, 0x25, 0x13, 0x36, 0xE7, 0x82, 0x0E, 0x46, 0x6C, 0x69, 0x54, 0x09, 0x6E, 0xE8, 0x94, 0x86,
-    0x9A, 0x3D, 0x5E, 0x9B, 0x6B, 0xAE, 0xBF, 0x8B, 0x7B, 0xBA, 0x70, 0xD5, 0xA0, 0x92, 0x75, 0x83,
-    0x4A, 0xAF, 0x1C, 0xD4, 0x99, 0xC6, 0xB3, 0xD5, 0x83, 0x5C, 0x8C, 0x7D, 0xC6, 0x8B, 0x27, 0x17,
-    0x3D, 0x26, 0xF6, 0x92, 0x43, 0x88, 0x91, 0x85, 0x13, 0x0E, 0xA1, 0xB6, 0x4E, 0xD7, 0xD2, 0xEA,
-    0x71, 0xA6, 0xFC, 0xF0, 0x26, 0xDD, 0x21, 0x86, 0xD8, 0x4A, 0x7D, 0xE1, 0x05, 0xE1, 0xF2, 0x2E,
-    0x17, 0x73, 0xFB, 0x37, 0x6A, 0x64, 0x81, 0x3B, 0x53, 0xA0, 0x61, 0x9C, 0xBD, 0xD5, 0xA2, 0x68,
-    0xA6, 0xCE, 0x12, 0x34, 0x6B, 0x4B, 0xB4, 0x6B, 0xC8, 0x5F, 0x70, 0x0D, 0x45, 0xDA, 0x0D, 0xC4,
-    0xA0, 0xE4, 0x34, 0x94, 0x35, 0x0A, 0x87, 0xD7, 0xB9, 0x9C, 0x36, 0x08, 0xF5, 0x32, 0x5A, 0x2E,
-    0xA7, 0x6D, 0xCD, 0x57, 0x07, 0x6A, 0xCF, 0x5C, 0xED, 0xA9, 0x73, 0x23, 0x23, 0xEA, 0xD3, 0xC0,
-    0x94, 0x68, 0x4D, 0x6D, 0xC2, 0x88, 0xD5, 0x20, 0x9A, 0x92, 0x73, 0x9F, 0xE1, 0x1E, 0x68, 0x3F,
-    0x33, 0xE8, 0xAA, 0x39, 0xF4, 0x16, 0xA0, 0xBF, 0x00, 0xDB, 0x02, 0xBB, 0x0B, 0x30, 0x16, 0x58,
-    0x0A, 0xD4, 0x1B, 0x19, 0x49, 0x7A, 0x25, 0xFF, 0x1F, 0x29, 0xD9, 0x45, 0x22, 0xAC, 0x18, 0xDF,
-    0x90, 0xD8, 0xA6, 0xBB, 0x60, 0x12, 0xB6, 0x17, 0x9C, 0x8D, 0xE3, 0x06, 0x65, 0xDF, 0xE1, 0x92,
-    0x85, 0x80, 0x96, 0x89, 0xCF, 0x05, 0x0B, 0x8C, 0xC1, 0x68, 0x10, 0xCF, 0x80, 0x04, 0xAB, 0x46,
-    0x0D, 0x30, 0x0A, 0xC9, 0x45, 0x92, 0x3D, 0x63, 0x88, 0x60, 0xB3, 0x30, 0xCD, 0xF4, 0x54, 0x98,
-    0xC6, 0x3D, 0x19, 0xA6, 0x39, 0x87, 0xCD, 0x5C, 0xA2, 0xD3, 0x08, 0xE0, 0xD5, 0x6B, 0xE3, 0xDF,
-    0xDA, 0x9C, 0x23, 0x40, 0xD4, 0x20, 0x80, 0x71, 0x47, 0x2F, 0xA5, 0x3C, 0x5D, 0x64, 0x95, 0x0E,
-    0xCA, 0xBA, 0xF3, 0xF1, 0x92, 0x3F, 0x50, 0x2F, 0x69, 0x17, 0x7B, 0x96, 0xE8, 0xE5, 0x95, 0xB3,
-    0x34, 0xED, 0xF3, 0xF0, 0xF3, 0x8C, 0x67, 0x91, 0xBA, 0xB2, 0xB1, 0xB5, 0x45, 0x49, 0xB5, 0xB4,
-    0xA6, 0xFA, 0xF2, 0xFC, 0x3C, 0xD1, 0xCC, 0xCF, 0x33, 0x9B, 0xE0, 0x2B, 0xB3, 0x09, 0xEE, 0xEA,
-    0x59, 0x5E, 0xAB, 0x9F, 0x9C, 0x28, 0x54, 0xBA, 0xA8, 0x73, 0x51, 0xE5, 0xAA, 0x35, 0xAE, 0x13,
-    0xC5, 0xD8, 0xD5, 0x81, 0x7E, 0x29, 0x2B, 0xC2, 0x28, 0x1B, 0xE1, 0x77, 0xD3, 0xB1, 0x48, 0xB5,
-    0xFD, 0xBA, 0x74, 0xD5, 0xE9, 0x72, 0xA1, 0xDE, 0xF4, 0x48, 0xE9, 0x5D, 0x8F, 0x94, 0xDE, 0xF6,
-    0x48, 0xE9, 0x7D, 0x8F, 0x94, 0xDE, 0xF8, 0x48, 0xE9, 0x9D, 0x8F, 0x94, 0xDE, 0xFA, 0x48, 0xE9,
-    0xBD, 0x8F, 0x94, 0xDE, 0xFC, 0x48, 0xE9, 0xDD, 0x8F, 0x94, 0xDE, 0xFE, 0x48, 0xE9, 0xFD, 0x8F,
-    0x94, 0xDE, 0x00, 0x89, 0x7C, 0xAE, 0xCB, 0x4A, 0xB6, 0x40, 0x62, 0xC0, 0x76, 0xA4, 0xA3, 0xB7,
-    0x12, 0xB2, 0x95, 0x5D, 0x90, 0x94, 0x6C, 0x83, 0xF4, 0x48, 0x92, 0xEE, 0x2D, 0x66, 0xF7, 0x83,
-    0x5D, 0xE8, 0xC0, 0x6C, 0x1D, 0x99, 0x6D, 0xC2, 0x62, 0xDD, 0x45, 0x1F, 0x8F, 0x8E, 0xCE, 0x32,
-    0x3C, 0x7B, 0x5B, 0xA9, 0x57, 0xA3, 0x04, 0x48, 0x98, 0x81, 0x30, 0x83, 0x2C, 0x49, 0xD1, 0x51,
-    0x70, 0xA4, 0x6F, 0xB3, 0x61, 0xA1, 0xBE, 0xCE, 0xE2, 0x91, 0x09, 0x70, 0x60, 0x7D, 0x9E, 0xC5,
-    0x5B, 0xAD, 0x7B, 0x59, 0xDC, 0x76, 0x3E, 0xCA, 0x62, 0xD7, 0xC1, 0x78, 0x39, 0x7F, 0x04, 0x60,
-    0x0F, 0x01, 0xAC, 0x31, 0x41, 0x69, 0x55, 0xCC, 0x32, 0x9D, 0x2E, 0x4F, 0x70, 0xBC, 0x84, 0x66,
-    0x6A, 0xFB, 0x39, 0x04, 0xA8, 0xC8, 0x4F, 0x8E, 0x81, 0xF2, 0x6E, 0x34, 0x5B, 0x72, 0x2D, 0xC8,
-    0xCD, 0x73, 0xDA, 0x5D, 0x4F, 0xD6, 0xCF, 0xE7, 0x57, 0x94, 0x71, 0x1C, 0xEB, 0xC5, 0x3C, 0x8D,
-    0x04, 0xDC, 0x3F, 0x92, 0xBD, 0x86, 0xEC, 0xBD, 0xFE, 0x42, 0x2E, 0x31, 0x8A, 0x71, 0x43, 0x6F,
-    0xFE, 0x70, 0x7C, 0x63, 0xCD, 0xE6, 0x0F, 0xDF, 0xA4, 0x76, 0xF5, 0x51, 0x2A, 0x99, 0x03, 0x92,
-    0x44, 0xE5, 0xD1, 0x0D, 0x12, 0x10, 0xCB, 0xBE, 0x67, 0x2C, 0xA7, 0x2F, 0x9C, 0x53, 0x17, 0x39,
-    0xCE, 0xFC, 0x6D, 0xD1, 0x4D, 0x10, 0x2D, 0x6C, 0xE7, 0xF1, 0x32, 0xBA, 0x48, 0x45, 0xAE, 0x4A,
-    0xB5, 0x85, 0xC8, 0x6A, 0xFF, 0x3E, 0x57, 0xD0, 0x78, 0xDA, 0xFA, 0x6A, 0xEB, 0x2A, 0xD6, 0x55,
-    0x59, 0xE7, 0xC0, 0x49, 0x65, 0xE9, 0x8C, 0x38, 0x3B, 0x75, 0xC4, 0xB0, 0x8C, 0xA4, 0xF2, 0x68,
-    0x6F, 0xD6, 0x59, 0x4C, 0xA2, 0x28, 0xB2, 0x9A, 0x0E, 0xF6, 0x23, 0xE9, 0x06, 0x6F, 0xA0, 0x52,
-    0x1A, 0x09, 0xCD, 0xD6, 0x21, 0x28, 0xDC, 0x20, 0x3D, 0x27, 0xB7, 0x94, 0x56, 0xA4, 0x46, 0x92,
-    0xDB, 0x25, 0xBE, 0x8D, 0xFB, 0x55, 0xE4, 0xEC, 0x25, 0x93, 0x4B, 0x5C, 0x42, 0x5D, 0x68, 0x9B,
-    0x56, 0xEF, 0x2E, 0x82, 0x51, 0xDC, 0xB8, 0x79, 0xBF, 0x53, 0x72, 0x5B, 0x94, 0xAA, 0x74, 0x8F,
-    0x6F, 0x3E, 0x1C, 0xDC, 0x0D, 0x64, 0x00, 0xE2, 0x25, 0x08, 0x62, 0x87, 0xA8, 0x18, 0x96, 0xEA,
-    0xA7, 0x01, 0xB9, 0x7F, 0x61, 0x57, 0x91, 0x0B, 0x99, 0xFA, 0x1A, 0xA5, 0x85, 0x01, 0xFC, 0xA5,
-    0xA5, 0x63, 0x51, 0x7B, 0xA2, 0x18, 0xB9, 0x78, 0x76, 0xFB, 0x17, 0x9B, 0xD1, 0xEA, 0x05, 0x67,
-    0xDC, 0x8F, 0x80, 0x9A, 0x31, 0x15, 0x63, 0xEA, 0xC5, 0x81, 0xE4, 0xCB, 0x5A, 0xC5, 0x2E, 0x94,
-    0x62, 0x0C, 0x5E, 0xD1, 0x87, 0x4A, 0x7C, 0x2A, 0xCF, 0x2A, 0x37, 0xC0, 0x46, 0x18, 0x08, 0x16,
-    0xD7, 0x63, 0x9D, 0x97, 0x22, 0xBE, 0x15, 0xAE, 0x3C, 0x72, 0x3E, 0xDE, 0xAC, 0x66, 0xC9, 0x4A,
-    0xA2, 0xBC, 0x5B, 0x73, 0x27, 0x87, 0x90, 0x78, 0x79, 0xB1, 0xD3, 0xE9, 0x94, 0x7D, 0x8E, 0x9C,
-    0x00, 0xBF, 0x49, 0x64, 0x1C, 0x49, 0xF6, 0xAD, 0xA7, 0xF4, 0x06, 0x69, 0x5C, 0xCF, 0x0E, 0x7C,
-    0xB1, 0x4A, 0x23, 0x61, 0xCA, 0x26, 0x13, 0x6C, 0x25, 0x34, 0xBC, 0xAD, 0xC3, 0x8C, 0x5C, 0x95,
-    0xE3, 0x77, 0x24, 0xCC, 0x58, 0x27, 0x45, 0xE8, 0x85, 0xE3, 0x17, 0xD1, 0x74, 0xBD, 0x22, 0xF6,
-    0xB3, 0xA2, 0x2B, 0x0B, 0xCE, 0x5B, 0x19, 0xA7, 0xC6, 0x8D, 0xBC, 0xD0, 0x96, 0x65, 0x4F, 0x35,
-    0x89, 0x0A, 0x69, 0x71, 0x99, 0xA1, 0xAC, 0x25, 0x54, 0xDF, 0x33, 0x17, 0x49, 0xEB, 0x7C, 0xFB,
-    0xC3, 0x2C, 0x21, 0x51, 0x01, 0x61, 0x37, 0x1A, 0xD1, 0x5B, 0x0B, 0xDB, 0xA1, 0xBD, 0x84, 0x7E,
-    0x36, 0x89, 0x98, 0xD2, 0xD5, 0xBA, 0xB3, 0x27, 0xBB, 0xFB, 0x3B, 0x6B, 0x66, 0x68, 0x0B, 0x49,
-    0x78, 0x51, 0x0D, 0x17, 0xC7, 0xE7, 0x5C, 0xCC, 0x0C, 0xBD, 0x80, 0x95, 0xAA, 0x69, 0xA9, 0xCC,
-    0xF0, 0xC7, 0x0B, 0xE9, 0xE9, 0x67, 0xB3, 0xA5, 0xE5, 0x0C, 0x19, 0xA0, 0x75, 0x18, 0xE1, 0xEF,
-    0x2F, 0x21, 0xC3, 0x8B, 0xEE, 0x15, 0x43, 0x47, 0x36, 0xAD, 0xE7, 0x77, 0x06, 0xFB, 0x99, 0xDE,
-    0xF8, 0x7A, 0xA2, 0x1A, 0x67, 0x9D, 0xDC, 0xCA, 0x15, 0x38, 0x78, 0x8F, 0x5E, 0x7B, 0xC3, 0x50,
-    0x78, 0xAB, 0x09, 0x50, 0x8F, 0x74, 0x61, 0x88, 0xD3, 0x2A, 0x8E, 0x94, 0x9B, 0xB1, 0xCD, 0x3B,
-    0x75, 0x9B, 0xDF, 0x19, 0x0C, 0xC8, 0x67, 0x52, 0x3C, 0x37, 0xD4, 0xEA, 0x56, 0x39, 0x7F, 0xAE,
-    0x57, 0xA7, 0x90, 0x4C, 0xB9, 0x02, 0x1B, 0x1A, 0xFF, 0xF5, 0x69, 0x4D, 0x4E, 0x76, 0x3D, 0x66,
-    0x82, 0xD0, 0xB5, 0x2E, 0x65, 0x8B, 0xE5, 0xF3, 0x0B, 0xD9, 0x4B, 0xA0, 0x94, 0xBD, 0x34, 0x30,
-    0x5F, 0xD4, 0xAD, 0x08, 0x2E, 0x76, 0xC2, 0x73, 0xDE, 0x6F, 0x93, 0x6B, 0xEE, 0x99, 0x4F, 0x6E,
-    0x74, 0xAE, 0xBD, 0x94, 0x95, 0xBF, 0x0B, 0x5C, 0x47, 0xD6, 0x5A, 0xBC, 0xBE, 0x44, 0x86, 0xE7,
-    0xB7, 0x9B, 0x69, 0x23, 0xD0, 0x4F, 0x30, 0x9C, 0x17, 0xEE, 0x9E, 0xA1, 0x83, 0xF6, 0xA3, 0x1A,
-    0x2C, 0xD2, 0xCB, 0x73, 0xAE, 0x0E, 0x5A, 0x05, 0x4E, 0xAF, 0x0E, 0x32, 0x9E, 0xB0, 0x3A, 0x88,
-    0x63, 0x4D, 0xC6, 0xC4, 0xF2, 0xE3, 0xEF, 0x2D, 0xA4, 0xD1, 0xD6, 0xAB, 0x86, 0x1E, 0xED, 0xD4,
-    0xAB, 0x86, 0x8C, 0xD9, 0xAA, 0xA1, 0xC5, 0xE2, 0xEB, 0x0C, 0xF5, 0x95, 0xAB, 0x86, 0xFE, 0x3F,
-    0x5D, 0xEC, 0xF4, 0x12, 0xA7, 0xE7, 0xC5, 0xFB, 0x53, 0x4F, 0x8F, 0x2C, 0x65, 0xD8, 0x5E, 0x31,
-    0x3D, 0x2F, 0xD2, 0xCF, 0x86, 0x67, 0x0B, 0xD3, 0x3E, 0xD9, 0xCD, 0xF3, 0xDD, 0xF8, 0x8E, 0x04,
-    0x7F, 0x45, 0x36, 0x2C, 0xC8, 0x96, 0xD4, 0xF7, 0x97, 0xB1, 0x45, 0xCA, 0x2A, 0xD6, 0x78, 0xBE,
-    0x3B, 0x90, 0x52, 0x50, 0x58, 0x32, 0x38, 0xD7, 0xCE, 0x7C, 0x07, 0x83, 0x27, 0xF3, 0xCE, 0x73,
-    0xDE, 0x79, 0x35, 0x54, 0xB3, 0xFD, 0x15, 0xD5, 0xDE, 0x7C, 0xA1, 0xC9, 0xD9, 0x6E, 0x3E, 0x75,
-    0x61, 0xA3, 0x5E, 0x36, 0x23, 0x8B, 0x4B, 0xAC, 0x8C, 0xB6, 0xC8, 0x8F, 0x70, 0xE3, 0x2B, 0xC6,
-    0xBF, 0xCE, 0x20, 0x6C, 0x84, 0xDB, 0xCA, 0xB9, 0x57, 0xC8, 0x5A, 0xE8, 0x2D, 0x27, 0x54, 0xC5,
-    0xBB, 0x7A, 0x25, 0xC2, 0xDA, 0x81, 0xB0, 0x57, 0x0C, 0x44, 0xF7, 0xC4, 0x40, 0xE4, 0x8D, 0xF2,
-    0xA2, 0x7D, 0x7F, 0x5E, 0xED, 0xBB, 0x39, 0xB1, 0x0B, 0x97, 0xDE, 0x24, 0xC7, 0x5F, 0x1A, 0xFC,
-    0xB3, 0xD8, 0x99, 0x55, 0x26, 0x3A, 0xDF, 0xC2, 0x18, 0xF4, 0x96, 0x4C, 0xDF, 0x17, 0xDD, 0xDF,
-    0x2A, 0x90, 0x0C, 0xED, 0x17, 0xCF, 0x6C, 0x66, 0xFC, 0x90, 0x91, 0xC3, 0x60, 0x6D, 0x62, 0xE1,
-    0x7C, 0xAF, 0x9D, 0xBD, 0xA7, 0x26, 0x37, 0x27, 0x19, 0xFF, 0xAD, 0xE5, 0xFF, 0xA7, 0x0A, 0x8E,
-    0x73, 0xDB, 0x0B, 0x75, 0x91, 0x03, 0xB4, 0x4E, 0x71, 0x80, 0x97, 0xBD, 0x09, 0xD6, 0x4B, 0xCB,
-    0xF4, 0x3E, 0x5A, 0x08, 0xC1, 0x5E, 0x99, 0x97, 0x8D, 0x43, 0x10, 0xEA, 0x58, 0x2F, 0x9D, 0xFB,
-    0xCE, 0x19, 0xE0, 0x93, 0x7A, 0x39, 0x4D, 0x83, 0x0F, 0x5B, 0x4A, 0x7D, 0x1F, 0xCF, 0x74, 0x40,
-    0x51, 0xF6, 0x9E, 0xFA, 0xD7, 0xCA, 0x6D, 0x90, 0x1D, 0x18, 0xF2, 0x66, 0x65, 0xD0, 0x15, 0xF5,
-    0x1D, 0x73, 0x1B, 0xD2, 0x85, 0xDC, 0x86, 0x66, 0xE0, 0x70, 0xE3, 0x06, 0x64, 0x2E, 0x73, 0xA0,
-    0x37, 0xF3, 0x67, 0xEE, 0x1E, 0x93, 0xC1, 0x1C, 0xBA, 0xBC, 0x04, 0xE8, 0xEE, 0x79, 0xB3, 0xEE,
-    0x8D, 0x57, 0x76, 0x6F, 0xB8, 0xB0, 0xED, 0xF4, 0x93, 0x3A, 0x00, 0x56, 0x52, 0xB0, 0xAC, 0xE9,
-    0x00, 0x33, 0x53, 0xCA, 0xFF, 0x07, 0xCD, 0x5A, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0xA5,
-    0xA3, 0x74, 0x84, 0x8F, 0x57, 0xC8, 0x40, 0x70, 0xB2, 0xC4, 0x14, 0x2E, 0x2C, 0x29, 0xBA, 0x75,
-    0xA9, 0x00, 0xBA, 0x25, 0x93, 0x22, 0x41, 0x2A, 0x5D, 0xA1, 0x73, 0x0A, 0x01, 0x91, 0x0A, 0x17,
-    0x42, 0x12, 0xE0, 0x5C, 0xBA, 0xB8, 0x1F, 0xC6, 0x2E, 0x8C, 0x20, 0x45, 0x0E, 0x01, 0x54, 0x26,
-    0x3E, 0x20, 0x57, 0x18, 0x6A, 0x9C, 0x42, 0x85, 0x8A, 0x55, 0x96, 0x48, 0x91, 0x22, 0x4D, 0x18,
-    0x17, 0x69, 0x5C, 0x84, 0x30, 0x2E, 0x08, 0xE0, 0x14, 0xA2, 0x83, 0x35, 0xB4, 0x17, 0xEF, 0xED,
-    0xF8, 0xFB, 0xDE, 0x90, 0xBC, 0x53, 0x22, 0xD9, 0x82, 0xB1, 0xDC, 0x5B, 0x2E, 0x66, 0x76, 0x97,
-    0x3F, 0x33, 0xF3, 0x7D, 0xEF, 0xCD, 0xFB, 0x99, 0xA1, 0xC8, 0x50, 0x44, 0x9C, 0x11, 0x2A, 0xEF,
-    0x90, 0xD5, 0x63, 0x54, 0xC1, 0x5F, 0x51, 0x85, 0xBF, 0x4E, 0x45, 0xA2, 0x20, 0x13, 0x89, 0xBD,
-    0x5C, 0x64, 0xC5, 0x2B, 0x45, 0x7A, 0x0E, 0xAA, 0x21, 0x3E, 0xCE, 0x40, 0x7A, 0xE2, 0x1A, 0x73,
-    0x28, 0x9E, 0x31, 0x63, 0xF1, 0x3F, 0xBD, 0xDF, 0x97, 0x30, 0x93, 0x30, 0x89, 0x12, 0x7C, 0x77,
-    0x44, 0xFC, 0xBC, 0x8B, 0xC6, 0x8A, 0x0D, 0x11, 0xB7, 0x44, 0xE3, 0xB8, 0xFF, 0xD8, 0xC1, 0x2E,
-    0x65, 0xD4, 0xFC, 0xE2, 0xF1, 0xE1, 0xBE, 0x04, 0x68, 0x28, 0xD8, 0xD9, 0x4E, 0x84, 0x2D, 0x49,
-    0x60, 0x8B, 0x73, 0x2B, 0x43, 0x37, 0x59, 0x74, 0x70, 0x2B, 0x8B, 0xF1, 0xBF, 0xA7, 0x25, 0x44,
-    0x89, 0xB2, 0x2D, 0xD9, 0xCE, 0x62, 0xF3, 0x24, 0x0B, 0xCC, 0xBB, 0x99, 0x2C, 0x56, 0xED, 0x84,
-    0x78, 0x3C, 0x4A, 0xED, 0x37, 0x0F, 0x8F, 0x3D, 0xB8, 0x7D, 0xBD, 0xD4, 0x54, 0x04, 0x2A, 0x25,
-    0xAB, 0xDD, 0xA7, 0xC6, 0x34, 0x0D, 0x1A, 0x62, 0x34, 0x77, 0xA5, 0xAC, 0xFA, 0x47, 0x09, 0x73,
-    0x3B, 0xA8, 0x85, 0x89, 0x12, 0x31, 0x97, 0x54, 0x5C, 0xEC, 0xAD, 0x10, 0xD1, 0x9B, 0x68, 0xE2,
-    0x1F, 0xF8, 0xB7, 0xEC, 0xA1, 0xB1, 0x57, 0x65, 0x75, 0xDA, 0xA0, 0x31, 0x0E, 0x7C, 0x97, 0x12,
-    0x61, 0x80, 0xF1, 0xDF, 0x45, 0x3E, 0x1F, 0x88, 0x97, 0x5F, 0x17, 0x47, 0x4E, 0x4D, 0x0C, 0xF4,
-    0xBC, 0x4A, 0x37, 0x25, 0x8C, 0x1C, 0x9D, 0xC9, 0xEF, 0x89, 0xE8, 0x24, 0x41, 0xDF, 0x45, 0x93,
-    0xCB, 0x6C, 0xFB, 0x07, 0xBB, 0xE2, 0xDC, 0x00, 0x07, 0xDD, 0x4D, 0x91, 0x01, 0x44, 0x9D, 0x38,
-    0x76, 0x1C, 0x57, 0x0E, 0xD8, 0x60, 0xEA, 0xEE, 0x47, 0xE8, 0x8D, 0x9D, 0xB9, 0x55, 0x79, 0xA3,
-    0x94, 0xBE, 0x29, 0xFD, 0xF1, 0x1B, 0x65, 0x98, 0xB9, 0x65, 0x47, 0x58, 0x3C, 0x14, 0xBF, 0x8C,
-    0xD2, 0xA8, 0x0C, 0xCD, 0x61, 0xE9, 0x9A, 0xA2, 0xAC, 0xB9, 0x6B, 0x14, 0x3A, 0xA8, 0xF5, 0x7B,
-    0xEF, 0x1A, 0xB1, 0xBD, 0x8E, 0x3F, 0xEF, 0x73, 0x0C, 0xBE, 0xC2, 0xDF, 0x99, 0xBA, 0xCC, 0x4F,
-    0x83, 0xFB, 0xA0, 0x40, 0xCB, 0x6F, 0x55, 0xB2, 0x4F, 0x25, 0xFE, 0x04, 0xCD, 0x51, 0xF6, 0x2B,
-    0x13, 0x95, 0x3D, 0xD4, 0xFD, 0x0E, 0xC6, 0x3E, 0x40, 0x67, 0xDF, 0xED, 0x63, 0xEC, 0xDF, 0x9E,
-    0x13, 0xAB, 0x72, 0xE2, 0x36, 0x5A, 0x70, 0xF1, 0x84, 0x54, 0x7F, 0x6F, 0x1E, 0xF7, 0xFE, 0x56,
-    0xBC, 0x1F, 0x8E, 0x00, 0x19, 0xBD, 0x2F, 0xA1, 0xF9, 0x18, 0x0D, 0x1F, 0x4C, 0x7E, 0x0A, 0x88,
-    0xA2, 0x73, 0x09, 0xCA, 0x37, 0x84, 0x72, 0x03, 0x4D, 0xAC, 0xB8, 0x60, 0x65, 0xF1, 0x24, 0xA6,
-    0xFC, 0x57, 0x99, 0xFB, 0xD3, 0x28, 0x1D, 0xF4, 0xB5, 0x5D, 0xE2, 0xDE, 0x21, 0x98, 0x58, 0x06,
-    0x13, 0xA7, 0x27, 0xEC, 0x0A, 0x50, 0xA2, 0xA4, 0x32, 0xF9, 0xDA, 0x29, 0x8D, 0x62, 0xC4, 0x5F,
-    0x30, 0x8A, 0xB2, 0xF8, 0x16, 0xFE, 0x5E, 0x17, 0xB0, 0x13, 0xDD, 0x62, 0x07, 0x86, 0x57, 0xDF,
-    0x9C, 0xBA, 0x3F, 0xA0, 0x9A, 0x72, 0xD2, 0x63, 0x96, 0xBA, 0x73, 0x67, 0xC4, 0x4B, 0x2F, 0x88,
-    0xFB, 0x5F, 0x5C, 0xEA, 0x97, 0x52, 0x13, 0x32, 0x11, 0x46, 0xB4, 0x2D, 0x3E, 0x27, 0x6E, 0x4E,
-    0xF4, 0x7F, 0x50, 0xF4, 0xF8, 0xB9, 0xDC, 0xA0, 0x77, 0xA6, 0x8F, 0x9E, 0xFE, 0xF7, 0x21, 0xCA,
-    0x55, 0x9C, 0x9A, 0x27, 0xFA, 0x57, 0xDA, 0x41, 0xAF, 0xFA, 0xAF, 0x80, 0xE4, 0x25, 0x56, 0x3F,
-    0x27, 0x05, 0xBB, 0x33, 0x41, 0xC1, 0x12, 0xDA, 0x3C, 0x8F, 0xD6, 0x9C, 0x5C, 0x51, 0xB9, 0x3F,
-    0x3A, 0x2B, 0x5E, 0x76, 0x41, 0x9C, 0x56, 0x94, 0x20, 0x59, 0xFC, 0x3F, 0x3B, 0xB9, 0x28, 0x68,
-    0xEF, 0x9A, 0x53, 0xD3, 0x10, 0x9E, 0x10, 0x0D, 0x7B, 0x73, 0x78, 0xE0, 0x27, 0x8D, 0x9D, 0xA4,
-    0x5D, 0x6C, 0x4D, 0x1B, 0x5E, 0x95, 0x3B, 0xF5, 0xD4, 0x37, 0xCD, 0xD4, 0x5F, 0x95, 0x99, 0x32,
-    0x91, 0x2E, 0x10, 0x7B, 0xD9, 0x45, 0x34, 0x49, 0x02, 0x06, 0x13, 0x9E, 0x0E, 0x34, 0xBF, 0x28,
-    0x71, 0xF5, 0xCD, 0x9F, 0xC6, 0x24, 0x2C, 0xDD, 0xB5, 0x35, 0x35, 0x8F, 0xCF, 0x2A, 0xB8, 0xAE,
-    0xA5, 0xBB, 0x76, 0xF3, 0xB9, 0xF7, 0xF0, 0xF9, 0xBA, 0xAD, 0x06, 0x5E, 0x54, 0xF5, 0x15, 0x55,
-    0xFF, 0xD7, 0xF7, 0x81, 0x0B, 0x18, 0xF6, 0xD7, 0xD3, 0x28, 0x09, 0x30, 0x5E, 0xAF, 0xE8, 0x22,
-    0xC4, 0xD9, 0x5A, 0xFB, 0x71, 0xB9, 0x6D, 0x4C, 0xB9, 0x7D, 0xFF, 0xFE, 0xEE, 0x66, 0xDD, 0x27,
-    0x87, 0x48, 0xA4, 0x85, 0x93, 0x82, 0xD9, 0x1C, 0xA1, 0x51, 0x2A, 0x4E, 0xD5, 0xB4, 0x5F, 0xC1,
-    0xE7, 0x37, 0x0F, 0x52, 0xF2, 0xB3, 0xC2, 0x06, 0xD6, 0x0E, 0xC5, 0x8B, 0xF3, 0x17, 0xEB, 0x39,
-    0xDF, 0x12, 0xC6, 0x08, 0xFD, 0x2C, 0x51, 0x6A, 0xD7, 0x51, 0xDE, 0xC6, 0x58, 0x68, 0xCC, 0xA1,
-    0x28, 0x5E, 0x32, 0x39, 0xAC, 0xAB, 0x8E, 0xF8, 0x87, 0x81, 0x84, 0xFD, 0xB1, 0x5C, 0xF0, 0x47,
-    0x98, 0x1A, 0x8B, 0xED, 0xE1, 0x59, 0x75, 0x12, 0x6F, 0xEC, 0x25, 0xC1, 0x87, 0x46, 0x16, 0x10,
-    0x3E, 0xD5, 0x7D, 0x4D, 0x48, 0x66, 0xBB, 0x9C, 0x03, 0x72, 0x19, 0x02, 0xDB, 0xFE, 0x8B, 0x38,
-    0x4F, 0x0A, 0xE8, 0xF8, 0x43, 0xA8, 0xF6, 0xB7, 0xDA, 0xD4, 0x41, 0x46, 0xE2, 0x03, 0x09, 0xDF,
-    0xC9, 0x25, 0xFE, 0x4F, 0x22, 0xBD, 0xA1, 0xB8, 0xC5, 0xD5, 0xA3, 0x70, 0x63, 0x02, 0xB8, 0x68,
-    0x2D, 0x37, 0xA8, 0xDE, 0x73, 0xA9, 0xCC, 0xDD, 0x86, 0xFC, 0x57, 0xA0, 0x0F, 0x25, 0x42, 0x9A,
-    0x64, 0xCE, 0x46, 0x22, 0xB8, 0x57, 0xCB, 0xBD, 0xB5, 0x84, 0x49, 0xD9, 0x33, 0x0B, 0xE6, 0xAE,
-    0x96, 0x7B, 0x6B, 0xF2, 0xDC, 0x7B, 0xF8, 0x7C, 0xD5, 0xD6, 0xA5, 0x6A, 0x3A, 0xF9, 0xEF, 0x20,
-    0xBD, 0xF8, 0x15, 0x6C, 0x44, 0x07, 0xC9, 0xC6, 0xDB, 0x41, 0x0A, 0x3B, 0x66, 0x15, 0xEF, 0xFC,
-    0x81, 0x70, 0x7C, 0xEE, 0xC1, 0xF9, 0xC2, 0xCF, 0x5D, 0xA4, 0x12, 0x32, 0x44, 0x7A, 0x34, 0x8A,
-    0xEE, 0xAD, 0x8D, 0x22, 0x63, 0x46, 0xD1, 0xA7, 0xF7, 0x3F, 0x88, 0xEA, 0x76, 0x39, 0x8D, 0x72,
-    0x4D, 0x96, 0xEF, 0x88, 0x31, 0x03, 0xE9, 0x98, 0xE2, 0xC8, 0x20, 0x72, 0x12, 0xD1, 0x4B, 0xC2,
-    0x45, 0x5C, 0x0E, 0x12, 0xE9, 0xFF, 0xB9, 0x92, 0xDB, 0x83, 0x96, 0xE5, 0xA6, 0xF9, 0x43, 0xD9,
-    0xE4, 0x0F, 0xE1, 0x51, 0xFE, 0xE0, 0xE6, 0x57, 0x8F, 0x02, 0xE7, 0x49, 0xE8, 0xE5, 0x0E, 0x42,
-    0x8F, 0xF1, 0x77, 0x24, 0xB8, 0x3D, 0x94, 0xB3, 0x0E, 0x32, 0x25, 0xFA, 0xE4, 0xED, 0x74, 0x3A,
-    0x38, 0xEF, 0xD2, 0xF1, 0xFD, 0x4E, 0xBC, 0xF7, 0xE8, 0xF8, 0x98, 0xC8, 0x32, 0x41, 0x00, 0xFD,
-    0x0F, 0x6B, 0x9C, 0x93, 0xD3, 0x53, 0x6D, 0x2A, 0x86, 0x38, 0xFB, 0x85, 0xB8, 0x9F, 0x0D, 0x60,
-    0x3A, 0x57, 0x70, 0xEA, 0xF4, 0xF4, 0xED, 0x3F, 0x45, 0x5B, 0x85, 0xFF, 0x32, 0x18, 0x21, 0xFC,
-    0xEF, 0x00, 0xA7, 0xD3, 0xAA, 0x6F, 0x08, 0x76, 0xC2, 0x11, 0x4C, 0xF4, 0x75, 0x77, 0xE8, 0x65,
-    0x1E, 0x28, 0xEE, 0x8F, 0xFB, 0x63, 0x3F, 0xFF, 0xBA, 0x4F, 0xFF, 0xD0, 0x8C, 0xE3, 0xF4, 0x4A,
-    0x21, 0xA5, 0x53, 0x86, 0xF9, 0x82, 0x3A, 0x92, 0x25, 0xB8, 0xCC, 0xAF, 0xFA, 0xBC, 0x78, 0xCB,
-    0x76, 0x98, 0x41, 0xCE, 0x21, 0x9E, 0xEB, 0xF5, 0x5E, 0x83, 0xA9, 0xEA, 0x3D, 0x7D, 0xC0, 0xAE,
-    0x3C, 0xDA, 0xA8, 0x48, 0x0B, 0x30, 0x31, 0x05, 0x14, 0x24, 0xEE, 0x38, 0x59, 0xCF, 0xE1, 0x66,
-    0x7C, 0x4E, 0x6A, 0x67, 0xC8, 0xE5, 0xAE, 0x11, 0xBD, 0xF8, 0x26, 0xF9, 0xE8, 0x76, 0x49, 0xCC,
-    0xB3, 0x2A, 0xBD, 0xCA, 0xFB, 0xB6, 0x38, 0xEF, 0x7B, 0x7C, 0x76, 0x84, 0x56, 0xBC, 0xD2, 0x1D,
-    0x4B, 0x87, 0xDC, 0x41, 0x60, 0x81, 0xA1, 0x27, 0x3B, 0xD7, 0x08, 0xAE, 0x2B, 0x15, 0xCD, 0xF6,
-    0x97, 0xC6, 0x0D, 0x03, 0x86, 0x39, 0x49, 0xF0, 0xF9, 0x7A, 0x1E, 0xA5, 0x5E, 0x19, 0x23, 0x92,
-    0xC1, 0xB5, 0x11, 0x64, 0xD2, 0x3B, 0x5E, 0x78, 0x0E, 0x0F, 0x0E, 0xA3, 0x04, 0xB6, 0x27, 0x0F,
-    0x0A, 0xC8, 0x27, 0x95, 0x3E, 0x02, 0xAA, 0xE7, 0xF9, 0x6E, 0xF9, 0x29, 0x2B, 0x86, 0xA5, 0xEA,
-    0xBA, 0x85, 0x79, 0xAB, 0xB5, 0x3D, 0x5C, 0x45, 0x91, 0x57, 0xE4, 0x44, 0x68, 0x08, 0x31, 0x8A,
-    0xF9, 0x51, 0xE5, 0xDD, 0x21, 0x09, 0x0F, 0x9D, 0x73, 0x25, 0xA1, 0xF6, 0xEE, 0x93, 0x61, 0x83,
-    0x36, 0x47, 0x18, 0x53, 0x5E, 0x86, 0x01, 0x17, 0xF3, 0x4B, 0xA0, 0x7F, 0x92, 0x33, 0x8C, 0x40,
-    0x6F, 0x67, 0x1B, 0x71, 0x4C, 0x5B, 0x01, 0x2E, 0x69, 0x72, 0x16, 0xFC, 0xAD, 0x90, 0xCE, 0x67,
-    0x89, 0x6C, 0xF4, 0x60, 0x85, 0xA3, 0xA3, 0xE5, 0xAB, 0x09, 0x20, 0x77, 0xB9, 0x5C, 0xE7, 0xEA,
-    0x42, 0xEC, 0x83, 0xCB, 0xA8, 0x5E, 0xEB, 0xA7, 0x33, 0x80, 0xFC, 0x6E, 0x65, 0x5D, 0xC2, 0xF9,
-    0x1D, 0x71, 0xE9, 0xCD, 0x37, 0x31, 0x0D, 0x27, 0x8C, 0xBC, 0x99, 0x4C, 0x64, 0xC0, 0xD1, 0xAC,
-    0x1C, 0xD5, 0x65, 0x2E, 0x02, 0x37, 0xD2, 0x0F, 0xD2, 0xF2, 0x04, 0xA5, 0xCF, 0x41, 0x52, 0xD9,
-    0xE5, 0x1A, 0xA5, 0x23, 0xC1, 0x47, 0x59, 0x5B, 0x5A, 0x00, 0xED, 0x3F, 0x03, 0x89, 0x1F, 0x62,
-    0x86, 0x2D, 0xAC, 0xA3, 0xC7, 0x33, 0x3A, 0x1B, 0x2E, 0xA9, 0x35, 0x48, 0x1A, 0x7D, 0x38, 0x41,
-    0x2E, 0x2E, 0x61, 0xB2, 0x9B, 0x8F, 0xC5, 0xFD, 0xD3, 0x18, 0xC3, 0xC5, 0x09, 0xE8, 0x85, 0x44,
-    0x6D, 0xE9, 0xC5, 0xCB, 0x75, 0x1E, 0xE3, 0x30, 0x35, 0xF5, 0x3E, 0xE1, 0x16, 0x41, 0x82, 0x8E,
-    0x4E, 0x35, 0xEB, 0xBD, 0x33, 0xE2, 0x07, 0x9C, 0xC4, 0x5A, 0xC7, 0x78, 0xA8, 0xB8, 0x80, 0x25,
-    0x71, 0x92, 0x4A, 0xB5, 0x5B, 0xF3, 0x11, 0x36, 0x28, 0xF5, 0xD4, 0x64, 0x30, 0x62, 0xB5, 0x2B,
-    0x7C, 0x76, 0xBE, 0x4A, 0x93, 0xDA, 0xBA, 0x08, 0x6D, 0xCC, 0x3E, 0x0C, 0x0B, 0x58, 0xF2, 0x0A,
-    0xD2, 0xF4, 0x71, 0x46, 0x9E, 0x4C, 0xA2, 0x60, 0x75, 0x83, 0x68, 0xA4, 0x89, 0xEF, 0xA6, 0x82,
-    0xEA, 0x2A, 0xAA, 0xF8, 0xB9, 0xB5, 0xBD, 0xC7, 0xDE, 0xAF, 0x9C, 0x89, 0x12, 0x2E, 0xCA, 0x9A,
-    0x58, 0xDA, 0x2C, 0x6F, 0x15, 0x71, 0x15, 0x73, 0x2A, 0xCB, 0x3F, 0xD6, 0x59, 0xBD, 0x47, 0x87,
-    0x46, 0xFB, 0xCE, 0xCC, 0xBE, 0xB4, 0x27, 0x3A, 0x03, 0x9F, 0x59, 0xFB, 0x8D, 0x34, 0xF8, 0xE7,
-    0x6D, 0x83, 0x71, 0x21, 0x02, 0x27, 0x59, 0xEC, 0x77, 0x24, 0xA4, 0xE8, 0x7F, 0xAB, 0x15, 0x5E,
-    0x20, 0x67, 0x42, 0xD2, 0x84, 0xAC, 0x89, 0xD2, 0xA6, 0xBC, 0x59, 0xE2, 0x9C, 0x63, 0x24, 0x55,
-    0xEB, 0x09, 0x9B, 0x4D, 0x18, 0x26, 0x75, 0x9C, 0x35, 0x2B, 0x2C, 0xDD, 0x6C, 0x48, 0xD2, 0x95,
-    0x88, 0x30, 0xAB, 0x7D, 0xBF, 0xAC, 0xB6, 0xCA, 0x92, 0x8C, 0xED, 0x72, 0x8A, 0xAA, 0x96, 0xAE,
-    0x89, 0xAA, 0x63, 0xAF, 0x6C, 0xB2, 0xFA, 0x7B, 0x78, 0xA4, 0xD9, 0xE2, 0x8A, 0x3B, 0x45, 0x76,
-    0xB1, 0x41, 0xF3, 0x4D, 0x5D, 0x3A, 0xE5, 0x7A, 0x83, 0xF8, 0x44, 0xE4, 0xB7, 0xAC, 0x56, 0x09,
-    0x33, 0x85, 0x70, 0x48, 0x27, 0xD5, 0xE9, 0x6B, 0x4C, 0x14, 0x0C, 0xEB, 0x05, 0xC4, 0x19, 0x22,
-    0xE9, 0x1C, 0xC6, 0xE3, 0x98, 0xEF, 0x67, 0xE2, 0x3D, 0x06, 0x00, 0xFF, 0x7B, 0x46, 0x55, 0xBE,
-    0x5D, 0x5D, 0x92, 0x19, 0xB3, 0x3C, 0xC7, 0xAC, 0xB6, 0x35, 0xDB, 0x47, 0x76, 0xBB, 0x39, 0xDA,
-    0x67, 0x44, 0xCD, 0xB6, 0x9A, 0xE9, 0xC6, 0x80, 0x6F, 0x70, 0x93, 0x76, 0x73, 0x22, 0xD5, 0x0A,
-    0x3D, 0x63, 0x4C, 0xB3, 0x81, 0x19, 0x1B, 0x4B, 0xB8, 0xEF, 0x8E, 0x38, 0x0C, 0x75, 0x8E, 0xE9,
-    0xF1, 0x05, 0x5D, 0x8D, 0x30, 0x15, 0xAD, 0x8D, 0x35, 0x75, 0x49, 0xC8, 0xDD, 0xE9, 0x01, 0xFC,
-    0x8B, 0x15, 0xBF, 0x78, 0x04, 0x57, 0x17, 0x27, 0x71, 0xD1, 0x31, 0x5F, 0x14, 0xBE, 0xF9, 0xA8,
-    0x68, 0x68, 0x5E, 0xAE, 0x08, 0x5E, 0xAE, 0xFE, 0xCF, 0xED, 0x13, 0xED, 0x61, 0x63, 0x6D, 0xB9,
-    0xFA, 0x28, 0x8F, 0xEA, 0x9C, 0xC6, 0xC9, 0x4F, 0x86, 0x86, 0xE3, 0x2F, 0x1D, 0x38, 0xD5, 0x4B,
-    0x07, 0x0B, 0x47, 0xEB, 0xA2, 0x93, 0x61, 0x43, 0xB7, 0xD7, 0x24, 0xD6, 0x7A, 0xEB, 0xC8, 0xF7,
-    0x58, 0x5B, 0xDE, 0x28, 0x85, 0x57, 0x12, 0xFB, 0xBB, 0x05, 0xC7, 0xFE, 0x5E, 0xC6, 0xFA, 0x7D,
-    0xC5, 0x31, 0xA6, 0x6E, 0x85, 0xFB, 0x5A, 0xA7, 0xDF, 0xB0, 0x56, 0x2A, 0x28, 0x8E, 0x48, 0x5F,
-    0x02, 0x89, 0xD9, 0xA0, 0x03, 0x59, 0x58, 0x3A, 0x2A, 0x3E, 0x2A, 0xBD, 0xA0, 0xDB, 0x71, 0x86,
-    0xB5, 0x62, 0xE8, 0xC6, 0x98, 0x0A, 0xEC, 0x94, 0x3D, 0xCB, 0xFD, 0x7B, 0xF7, 0x37, 0x25, 0x10,
-    0xFF, 0x8B, 0xB0, 0x4D, 0x8A, 0xEA, 0x40, 0x48, 0xC0, 0xD7, 0x56, 0x7E, 0x21, 0x24, 0x48, 0xC8,
-    0x90, 0x90, 0x22, 0x51, 0x8E, 0x2C, 0x49, 0x2F, 0xDB, 0xF8, 0x28, 0x69, 0x5C, 0x9D, 0x0D, 0x0B,
-    0xB8, 0x40, 0x79, 0x3C, 0x82, 0x99, 0x0D, 0x96, 0x34, 0x90, 0x50, 0x3A, 0x54, 0x85, 0xAD, 0x83,
-    0xD6, 0x08, 0x06, 0x91, 0x5E, 0x9B, 0x2C, 0xB9, 0xFB, 0x6A, 0x3E, 0xC6, 0xCD, 0x3E, 0x6E, 0x5D,
-    0xEB, 0x30, 0xEC, 0xAB, 0x3B, 0x52, 0xCC, 0x96, 0x46, 0x71, 0x8E, 0xD9, 0x49, 0x26, 0x4D, 0xC5,
-    0x79, 0x66, 0x47, 0xBE, 0xD0, 0xAE, 0x5A, 0xD9, 0x55, 0xFA, 0x7E, 0xCE, 0x4E, 0xBF, 0x30, 0x39,
-    0xD3, 0xC9, 0x6D, 0x8E, 0x27, 0x39, 0x35, 0x5B, 0x24, 0xAD, 0x3A, 0xB4, 0x8E, 0x3E, 0xEE, 0xE8,
-    0xC3, 0x2D, 0xBF, 0xE4, 0x8F, 0x74, 0xE8, 0xAD, 0x52, 0x73, 0xCC, 0xDF, 0xCD, 0x86, 0xE5, 0xB1,
-    0x41, 0x78, 0x59, 0x85, 0x0B, 0xCD, 0xEF, 0xA7, 0x8E, 0xF6, 0x19, 0x59, 0x6E, 0x42, 0x83, 0xE5,
-    0xE6, 0xDC, 0xB9, 0xE6, 0x1C, 0xE3, 0x14, 0xF1, 0xF3, 0x66, 0x70, 0xB5, 0x5D, 0xEA, 0x11, 0xE1,
-    0x16, 0x6F, 0xEA, 0x68, 0x30, 0x92, 0xC2, 0xC6, 0x07, 0x19, 0xDC, 0xAA, 0x57, 0xA0, 0x5F, 0xB7,
-    0xA4, 0x1D, 0xE5, 0x36, 0x83, 0xF4, 0x74, 0x7B, 0x91, 0x69, 0x47, 0xC4, 0x48, 0x31, 0x1C, 0xD4,
-    0x91, 0xAA, 0x9A, 0xBB, 0x17, 0xA8, 0x6E, 0x56, 0x1B, 0xA2, 0x71, 0xF5, 0x22, 0x9B, 0xC6, 0xE6,
-    0xD6, 0x89, 0x7C, 0x20, 0xB2, 0xD7, 0xD3, 0x94, 0x52, 0xDF, 0x8C, 0x2A, 0xA2, 0xC4, 0xCF, 0xC3,
-    0x34, 0xC8, 0x82, 0x2C, 0x4C, 0xBD, 0x3C, 0xC2, 0x59, 0xC4, 0x2F, 0x25, 0x44, 0x32, 0x84, 0xC0,
-    0x7B, 0x60, 0x72, 0x05, 0xBD, 0x77, 0xD0, 0x39, 0xB7, 0xEA, 0x68, 0x74, 0xB5, 0x24, 0xD6, 0x9E,
-    0x75, 0xED, 0x5E, 0x2F, 0xB7, 0x98, 0xB9, 0xFA, 0x34, 0x3D, 0x80, 0xC7, 0x14, 0x53, 0x23, 0xA4,
-    0xA2, 0xFE, 0x35, 0x59, 0x88, 0xA8, 0xBA, 0x61, 0xE6, 0x8C, 0xC2, 0xA4, 0x86, 0x28, 0x01, 0xDF,
-    0xBA, 0x08, 0x74, 0xB7, 0xF9, 0x6A, 0x5D, 0xE9, 0x7E, 0xB7, 0x66, 0x41, 0x6E, 0x36, 0x75, 0x59,
-    0x33, 0x88, 0x5D, 0x1A, 0x54, 0xF9, 0xCC, 0x03, 0xFB, 0xD6, 0x58, 0x90, 0x30, 0xA1, 0x69, 0x5D,
-    0xDE, 0x9A, 0x2D, 0x88, 0xF9, 0x45, 0x2E, 0xEE, 0xBF, 0x0D, 0x52, 0x86, 0xB4, 0x9F, 0x1C, 0x6D,
-    0x2D, 0x4D, 0x91, 0x02, 0xBB, 0xEB, 0x9A, 0xFA, 0x8F, 0x91, 0x29, 0x20, 0xAC, 0xAF, 0x77, 0x5D,
-    0xDB, 0x84, 0xFE, 0x25, 0xB5, 0x58, 0x41, 0x8F, 0xDC, 0x48, 0x15, 0x7E, 0x76, 0x4D, 0x62, 0x69,
-    0xAC, 0x4D, 0xCD, 0xA1, 0x23, 0x05, 0x96, 0xC4, 0x1C, 0x06, 0x29, 0x44, 0x93, 0x36, 0x07, 0x0E,
-    0x23, 0xD4, 0xDD, 0xF6, 0x66, 0x0F, 0x2B, 0x71, 0x49, 0x0E, 0x19, 0x21, 0xC1, 0x25, 0xE7, 0x41,
-    0x10, 0x0E, 0x73, 0x98, 0x95, 0xBA, 0xA7, 0xCD, 0xEE, 0x81, 0x13, 0xDA, 0x39, 0xF0, 0x03, 0x06,
-    0x29, 0x87, 0x49, 0xAF, 0x14, 0x38, 0xE4, 0xD0, 0x2C, 0xE9, 0xEE, 0x0A, 0x39, 0xE4, 0x88, 0x77,
-    0xFF, 0x00, 0xC5, 0xFE, 0x81, 0x29, 0xC0, 0x20, 0x87, 0xF5, 0xD8, 0x7C, 0xAF, 0xEC, 0x9E, 0x9E,
-    0xC9, 0x24, 0xA4, 0x03, 0xDA, 0xAA, 0x7E, 0x55, 0xCF, 0x55, 0xF5, 0x9E, 0xDF, 0x7B, 0xF5, 0xDE,
-    0xAB, 0x72, 0x13, 0x39, 0x09, 0xE9, 0xED, 0xF1, 0x67, 0xE3, 0x03, 0xFD, 0xDB, 0xE4, 0x80, 0xDE,
-    0x5C, 0x89, 0xDC, 0xD8, 0xA7, 0xF6, 0xC3, 0xF6, 0x23, 0x7F, 0xD5, 0xFD, 0x21, 0xAD, 0xBE, 0xB9,
-    0x56, 0x45, 0x55, 0x6C, 0xDD, 0xAD, 0xDB, 0xED, 0xD1, 0xE8, 0x41, 0x55, 0x55, 0xF9, 0xA8, 0xEE,
-    0x63, 0x86, 0xAD, 0xAD, 0x2D, 0xAA, 0x6C, 0x29, 0x9A, 0x6E, 0xCB, 0x96, 0xBB, 0xAF, 0x1C, 0x84,
-    0x00, 0x1D, 0x91, 0x7E, 0x1D, 0x3F, 0xAA, 0x4B, 0x54, 0x55, 0xEA, 0xC6, 0x68, 0x94, 0x30, 0x7E,
-    0x79, 0x6B, 0x2B, 0xE6, 0x67, 0xEE, 0xBD, 0xC4, 0x8F, 0x25, 0x85, 0x14, 0x51, 0x8F, 0x26, 0xD4,
-    0x22, 0x99, 0x04, 0x31, 0x3F, 0x75, 0xA9, 0x43, 0xBB, 0xB4, 0x46, 0xBE, 0x92, 0x4A, 0x26, 0x32,
-    0x0E, 0xA8, 0x8D, 0x91, 0x16, 0x0D, 0x68, 0x0F, 0x2B, 0x43, 0x0A, 0x48, 0x82, 0xD6, 0x21, 0x2F,
-    0x31, 0xFE, 0x7B, 0x46, 0x0A, 0x1D, 0x8A, 0x34, 0xF2, 0x55, 0x4F, 0xAA, 0x89, 0x54, 0xAD, 0x0B,
-    0x24, 0x3F, 0x32, 0xC1, 0xFB, 0x26, 0x14, 0x3A, 0xF2, 0x54, 0xD7, 0x57, 0x1D, 0x19, 0xEF, 0x4A,
-    0x5A, 0x5B, 0x21, 0xFF, 0x69, 0x26, 0xF1, 0xE3, 0x59, 0x1D, 0x88, 0xB4, 0xED, 0xA9, 0x8E, 0x9F,
-    0xB4, 0x1C, 0x1A, 0xC8, 0x64, 0x20, 0x55, 0xCF, 0x57, 0xA1, 0x97, 0x62, 0x5C, 0xDE, 0xD2, 0xE0,
-    0xEC, 0xD0, 0x1D, 0x2B, 0x7C, 0xAF, 0x81, 0x2E, 0xE0, 0x26, 0x60, 0x83, 0xE8, 0xBB, 0x3F, 0xFB,
-    0x31, 0xEB, 0x44, 0x3F, 0x78, 0xF4, 0x29, 0xD1, 0xB7, 0xEA, 0x31, 0x0B, 0x37, 0x5F, 0x82, 0xEE,
-    0x29, 0xFA, 0xD3, 0x10, 0xCD, 0x0D, 0xD3, 0x3C, 0xB7, 0x9B, 0xF5, 0x57, 0x89, 0x86, 0xE0, 0xCB,
-    0xC0, 0xB8, 0x1D, 0xEB, 0x9D, 0x5F, 0xD7, 0xBA, 0x7A, 0xA1, 0x5E, 0x37, 0x9D, 0x2D, 0xD6, 0xB5,
-    0x17, 0x6B, 0x1D, 0x0A, 0xF5, 0x30, 0x9B, 0xE5, 0x5C, 0x87, 0x26, 0xE0, 0x6D, 0xF8, 0xBE, 0x9D,
-    0x8C, 0x34, 0x45, 0xC7, 0x14, 0x95, 0x14, 0x65, 0x14, 0xC5, 0xB4, 0x69, 0x85, 0x68, 0xD1, 0x90,
-    0x66, 0x80, 0x15, 0x60, 0xEB, 0x53, 0x3A, 0x2E, 0xA9, 0x9C, 0xD0, 0x71, 0x8B, 0xD6, 0xF0, 0x48,
-    0x77, 0xA6, 0x54, 0x38, 0x45, 0xE9, 0x1C, 0xBB, 0xC5, 0x04, 0x58, 0x8E, 0x61, 0xBA, 0xD3, 0x9A,
-    0x96, 0x93, 0xD6, 0xF6, 0xE1, 0x67, 0x87, 0xCB, 0x78, 0x37, 0xD7, 0x1B, 0x0F, 0x6F, 0x3C, 0x5A,
-    0xC6, 0xAF, 0x6D, 0xA5, 0xE1, 0xF1, 0xA2, 0xBA, 0xC9, 0x9B, 0x2B, 0x53, 0xFC, 0x82, 0xEA, 0xBA,
-    0x3C, 0x05, 0xBD, 0x53, 0xD7, 0x65, 0x29, 0xEA, 0xE2, 0xE7, 0xE4, 0x68, 0xF4, 0xC1, 0x8C, 0xAC,
-    0x7B, 0x77, 0x65, 0xEC, 0xF3, 0x64, 0xDF, 0x4B, 0x24, 0xCF, 0xEF, 0x0A, 0xC5, 0x1B, 0x41, 0x63,
-    0xA1, 0x3A, 0x4D, 0x3F, 0xAE, 0xFB, 0xA7, 0xA6, 0x9E, 0x7F, 0xF6, 0xF9, 0x98, 0xDE, 0xDD, 0xEF,
-    0x78, 0xBF, 0x7A, 0x5E, 0xC5, 0xC3, 0xAC, 0x2B, 0x6F, 0xDF, 0xFE, 0x40, 0x65, 0xFD, 0xA0, 0x6A,
-    0x5F, 0x13, 0x9F, 0x9B, 0x9B, 0x5E, 0xDE, 0xB9, 0xE9, 0x7C, 0xA9, 0xAF, 0x81, 0xA2, 0xEB, 0xFC,
-    0x3D, 0x0D, 0x88, 0x0C, 0xF7, 0x92, 0x5C, 0x5D, 0xF7, 0x9E, 0xE2, 0x79, 0x8E, 0x80, 0xB6, 0xFB,
-    0x57, 0xDD, 0xE6, 0x58, 0x10, 0xCA, 0x74, 0xE1, 0x6A, 0xF2, 0x48, 0x4D, 0x0B, 0x1A, 0x93, 0xA8,
-    0x28, 0xB4, 0xEF, 0x5A, 0x83, 0x23, 0x9C, 0x2A, 0x10, 0x9D, 0x4C, 0x8D, 0x86, 0x15, 0xCD, 0x83,
-    0xB3, 0x2B, 0x13, 0x4F, 0xD5, 0x68, 0xDF, 0x53, 0x32, 0xAE, 0x51, 0x88, 0x1D, 0xD0, 0x09, 0xDA,
-    0x59, 0xA0, 0xE3, 0x05, 0x6A, 0x4E, 0xD0, 0x3F, 0xE9, 0x3F, 0xD0, 0xEA, 0x01, 0xFD, 0x1C, 0x1C,
-    0x9E, 0x3D, 0xAB, 0x54, 0x54, 0xB8, 0x15, 0x82, 0xF1, 0xF6, 0xED, 0xE7, 0xE9, 0x64, 0xCF, 0xFB,
-    0xC2, 0x04, 0x55, 0x20, 0x1D, 0x93, 0x49, 0x99, 0x64, 0x5E, 0xDE, 0x0D, 0xC8, 0x18, 0x79, 0x3B,
-    0x06, 0xA3, 0x7E, 0x9B, 0xFE, 0x09, 0x14, 0x22, 0x93, 0xB1, 0xE8, 0x27, 0x40, 0x5D, 0x7D, 0x32,
-    0xCA, 0x32, 0x98, 0x1A, 0xF5, 0x93, 0xC0, 0x01, 0x2A, 0xE3, 0x8C, 0x24, 0x21, 0x3E, 0xC7, 0xA1,
-    0x0F, 0x7B, 0xDE, 0x24, 0xEF, 0x48, 0x0D, 0x27, 0xE2, 0x2B, 0x4D, 0x7D, 0x72, 0xAB, 0x38, 0xC8,
-    0x9D, 0x2A, 0x69, 0x34, 0x8F, 0xE1, 0xCF, 0x64, 0x84, 0x66, 0x9D, 0x02, 0x9B, 0x4F, 0xEE, 0xB1,
-    0x2D, 0x85, 0x7E, 0xE2, 0x29, 0x03, 0x0E, 0x01, 0xD4, 0xF2, 0xE3, 0xDD, 0x4B, 0x74, 0xEF, 0x0A,
-    0x8F, 0xCB, 0x18, 0x33, 0x21, 0xAC, 0x0B, 0x53, 0x32, 0x7F, 0x0A, 0x58, 0xC1, 0x8E, 0x7F, 0x2B,
-    0xA5, 0xDD, 0x4B, 0x42, 0x61, 0xD5, 0x45, 0x08, 0x8C, 0x18, 0x0A, 0x20, 0x8B, 0x50, 0xF0, 0x01,
-    0x43, 0xEB, 0x50, 0xA0, 0x07, 0xEE, 0xBE, 0xF2, 0x3F, 0x4E, 0xB1, 0xBF, 0x8E, 0x7E, 0x4C, 0xA6,
-    0x43, 0xEB, 0x57, 0xFA, 0x6D, 0xD8, 0xB1, 0x27, 0x3F, 0x50, 0x14, 0xF8, 0xCF, 0x34, 0x61, 0xD6,
-    0x10, 0xE6, 0xC7, 0x70, 0x9D, 0xC7, 0xB0, 0xA5, 0xE9, 0x60, 0x7B, 0xD7, 0xAF, 0xAC, 0xB2, 0x9C,
-    0x90, 0x0C, 0xA9, 0x8F, 0x8E, 0xC8, 0x7D, 0x1E, 0x8B, 0x8F, 0x95, 0xEF, 0xA4, 0x97, 0xC8, 0x6C,
-    0xD0, 0xCE, 0x26, 0x26, 0xD6, 0x28, 0x17, 0xC6, 0x57, 0x41, 0x3C, 0xA0, 0x27, 0x08, 0x6B, 0x6C,
-    0x54, 0xEA, 0x64, 0xF4, 0x98, 0xC9, 0x9A, 0x67, 0x8D, 0xE7, 0xA2, 0x5E, 0xD3, 0x83, 0x86, 0xF3,
-    0xB2, 0x02, 0xEF, 0xA0, 0xB8, 0x4B, 0x41, 0x22, 0xD2, 0x20, 0x0E, 0x62, 0x4B, 0x09, 0xD9, 0xB1,
-    0x9A, 0xE0, 0x04, 0x03, 0x12, 0x70, 0x61, 0x1E, 0x26, 0xF2, 0x52, 0xCE, 0x19, 0x4E, 0x96, 0x73,
-    0xB2, 0x1A, 0x6A, 0xA1, 0xA7, 0x14, 0x28, 0x61, 0x06, 0x14, 0xA5, 0xC2, 0xB4, 0xE8, 0x45, 0x46,
-    0x31, 0x56, 0x0F, 0xB0, 0x86, 0x93, 0x33, 0x27, 0x11, 0x2F, 0x65, 0x26, 0x60, 0xC5, 0x4C, 0x06,
-    0x64, 0xF3, 0x33, 0xDE, 0x1E, 0xC0, 0x8D, 0xAE, 0xA0, 0xC5, 0xE1, 0x47, 0x17, 0xB0, 0x7C, 0x22,
-    0x4C, 0xFD, 0x1B, 0xE0, 0xE7, 0x9A, 0xFE, 0xFC, 0xD7, 0xC1, 0xCF, 0xD1, 0x67, 0x7E, 0xD4, 0xB8,
-    0x62, 0x8B, 0xF6, 0xA7, 0xC2, 0x94, 0x22, 0x9B, 0xF0, 0xAB, 0xAD, 0x27, 0xFA, 0x55, 0x8A, 0x4C,
-    0x9B, 0xD3, 0x77, 0x32, 0x88, 0x90, 0x85, 0xB0, 0x9D, 0x6C, 0x80, 0x23, 0x03, 0xA2, 0x9B, 0x82,
-    0xE8, 0x1F, 0xF0, 0x44, 0xDE, 0xF7, 0x12, 0x04, 0x78, 0x64, 0x15, 0xD9, 0x4A, 0x67, 0x0A, 0xC6,
-    0x9C, 0xA2, 0x99, 0x5F, 0x3B, 0x39, 0x95, 0x4A, 0x06, 0xFB, 0xF0, 0x3D, 0xCC, 0xB3, 0x9F, 0x8B,
-    0xE4, 0x12, 0x54, 0xE5, 0xE8, 0xE8, 0x83, 0xE1, 0xA7, 0x50, 0xF1, 0xDD, 0xB2, 0x89, 0x09, 0x0A,
-    0x80, 0x39, 0xE5, 0x4F, 0x0C, 0xBC, 0x04, 0xB3, 0x76, 0x9D, 0xA5, 0x60, 0xDA, 0x79, 0x82, 0x60,
-    0x27, 0x23, 0x27, 0x25, 0x57, 0x61, 0x82, 0x7C, 0xE2, 0x65, 0x57, 0xED, 0x2E, 0xEF, 0xD8, 0xE8,
-    0xCB, 0xC9, 0x2D, 0x48, 0xFC, 0x9A, 0x7C, 0xB8, 0xB1, 0x17, 0x5F, 0x15, 0x49, 0xC7, 0x55, 0x3B,
-    0xA4, 0x4F, 0x8B, 0x2A, 0xF4, 0x39, 0x24, 0x7D, 0x09, 0xB9, 0x74, 0x4B, 0x3D, 0xA9, 0x45, 0xAA,
-    0x8E, 0x0A, 0x8B, 0xAC, 0x56, 0xD5, 0x61, 0x13, 0xE6, 0xF3, 0xB8, 0x0C, 0xFA, 0x0D, 0xD2, 0xEB,
-    0x35, 0x48, 0x11, 0xD4, 0xAA, 0x38, 0xB9, 0x6C, 0x42, 0xFE, 0xDB, 0x17, 0x6D, 0xC7, 0x9E, 0x60,
-    0xCD, 0x66, 0xE3, 0xFF, 0x04, 0xC9, 0x4E, 0x21, 0x9B, 0xBE, 0x73, 0x20, 0x92, 0xDF, 0x7F, 0x93,
-    0x86, 0x47, 0x33, 0xE3, 0x95, 0x5F, 0xD9, 0x53, 0x4A, 0x7B, 0x15, 0x1F, 0x55, 0x21, 0xB8, 0xB9,
-    0x2C, 0xC7, 0x1E, 0x24, 0x16, 0x47, 0xCC, 0x02, 0x14, 0xF2, 0x93, 0x84, 0x5C, 0x03, 0x39, 0x43,
-    0x3F, 0x25, 0x4F, 0xE3, 0x5C, 0xDA, 0x13, 0xB0, 0x8D, 0xBA, 0x0E, 0x8B, 0x2C, 0x12, 0x2A, 0xB6,
-    0xCE, 0x5E, 0x63, 0xC8, 0x1A, 0x89, 0x73, 0x81, 0x63, 0x6A, 0x45, 0x39, 0xAF, 0xCA, 0xE6, 0x70,
-    0x63, 0x55, 0x30, 0xEC, 0x32, 0x7F, 0x55, 0x0B, 0x15, 0x2C, 0x28, 0xA8, 0xA1, 0xF0, 0x1A, 0x8A,
-    0x76, 0x43, 0xC1, 0xE7, 0xDF, 0x98, 0xCE, 0xD7, 0x57, 0x8F, 0x4F, 0xEE, 0xCE, 0xF2, 0xED, 0x07,
-    0x51, 0x11, 0x1D, 0x5F, 0x1E, 0x50, 0xF7, 0xA5, 0x3A, 0xE0, 0xC3, 0xE8, 0xDC, 0x68, 0xF7, 0xF2,
-    0x24, 0x3A, 0xBE, 0x71, 0x38, 0x4F, 0xB0, 0x55, 0xEA, 0x55, 0x1A, 0x76, 0xC9, 0xA3, 0xAA, 0xA0,
-    0xAE, 0x73, 0xDC, 0x7B, 0x6F, 0x5A, 0x1F, 0xCA, 0x21, 0x59, 0x08, 0x16, 0x5D, 0x33, 0x38, 0xB0,
-    0x98, 0x93, 0x5B, 0xC7, 0xF4, 0x35, 0x79, 0xD0, 0x24, 0x4C, 0x10, 0x46, 0xF3, 0x29, 0x56, 0xAF,
-    0x51, 0xBE, 0x51, 0xF4, 0x65, 0xCF, 0x26, 0xBE, 0xA7, 0xDC, 0xAB, 0xDD, 0xBB, 0xB0, 0xFB, 0xE0,
-    0x1C, 0x9F, 0x3C, 0xF1, 0xDC, 0xDA, 0x42, 0x3C, 0x3F, 0x85, 0x70, 0x7E, 0x0A, 0xD1, 0xB0, 0x25,
-    0xD4, 0xE3, 0x26, 0xE4, 0xEC, 0x6F, 0x9B, 0x1E, 0x37, 0x03, 0x34, 0x4E, 0x8E, 0xC6, 0xD7, 0x30,
-    0x74, 0x88, 0x54, 0xC7, 0xE9, 0x42, 0xD9, 0x6C, 0x8C, 0xB7, 0xD7, 0x4D, 0x72, 0xE6, 0xE5, 0x4E,
-    0x8C, 0x97, 0xC9, 0x14, 0x2F, 0x96, 0x1A, 0x18, 0x98, 0xF2, 0x98, 0x9D, 0x9C, 0x38, 0x55, 0x46,
-    0x13, 0x09, 0x1F, 0x99, 0xC8, 0xFD, 0xFB, 0x09, 0x54, 0xF2, 0x15, 0x1A, 0x4F, 0xF5, 0x9B, 0xC6,
-    0xE7, 0x26, 0x48, 0xB0, 0x8F, 0x43, 0x6C, 0x26, 0xA8, 0x3B, 0xF0, 0x14, 0x34, 0x70, 0xC8, 0x0E,
-    0xDB, 0xA9, 0xC3, 0xBB, 0x6F, 0x9B, 0x45, 0x69, 0x11, 0x32, 0xF6, 0x94, 0xEF, 0x39, 0x25, 0xA8,
-    0x90, 0x3D, 0x23, 0x1E, 0x43, 0xB6, 0xC7, 0x0D, 0xF8, 0x00, 0xFE, 0x68, 0xB6, 0xB6, 0x7E, 0xA4,
-    0x99, 0x7F, 0xED, 0x27, 0x8D, 0x99, 0xD9, 0xAB, 0xDD, 0xC6, 0x4F, 0xD8, 0xFB, 0xEB, 0x64, 0x46,
-    0xC8, 0xA4, 0x36, 0x2D, 0x8A, 0x26, 0x6A, 0x86, 0x55, 0x19, 0x7F, 0x38, 0xAC, 0xD2, 0x9D, 0xB0,
-    0x32, 0x80, 0x1C, 0x50, 0xBC, 0x06, 0x78, 0x2E, 0x03, 0x68, 0x40, 0xB2, 0xB3, 0x71, 0x87, 0x76,
-    0x70, 0x05, 0x5C, 0x06, 0xD6, 0x21, 0x3F, 0x6D, 0x8F, 0x0E, 0x05, 0xAE, 0xE0, 0xB2, 0x7A, 0xD1,
-    0x07, 0x9B, 0x8D, 0x08, 0x30, 0x7C, 0x05, 0x44, 0x0D, 0x04, 0x00, 0x1F, 0xEB, 0x69, 0x56, 0x15,
-    0xDB, 0xA3, 0x07, 0x1C, 0x7C, 0x09, 0xE4, 0xD4, 0x3B, 0x98, 0x04, 0xE4, 0x80, 0xE2, 0x35, 0xC0,
-    0xF3, 0x06, 0xEB, 0xD5, 0xB0, 0x7A, 0xD1, 0x64, 0x86, 0x26, 0x7C, 0x64, 0x0D, 0x1F, 0xCA, 0x8B,
-    0x7A, 0x76, 0x54, 0xE9, 0x9F, 0x56, 0xE5, 0x3E, 0x45, 0xB0, 0xCD, 0x1F, 0x35, 0x39, 0x7F, 0x43,
-    0x82, 0x37, 0xBC, 0x9B, 0x7B, 0x48, 0x6E, 0xEB, 0xD6, 0x86, 0x33, 0xD4, 0xEE, 0x39, 0xEF, 0x6B,
-    0xC1, 0x8C, 0x11, 0xAC, 0x2C, 0x63, 0xBE, 0x94, 0xCF, 0x7D, 0x63, 0x99, 0x5C, 0xF9, 0x35, 0x94,
-    0x25, 0xD2, 0xF8, 0xFF, 0xA4, 0x3C, 0xFD, 0x3F, 0xB4, 0x03, 0x7A, 0x3C, 0x25, 0x33, 0x71, 0x75,
-    0x0B, 0xF2, 0x70, 0x68, 0x25, 0x4C, 0x1C, 0xD8, 0xCF, 0x83, 0xBE, 0x8D, 0x6B, 0xC3, 0x49, 0x0F,
-    0x93, 0xE2, 0xF4, 0xA4, 0x93, 0x75, 0xDC, 0x7C, 0xCC, 0xCE, 0x49, 0xCE, 0x6C, 0x1F, 0xDE, 0x9B,
-    0x20, 0x90, 0xF6, 0x91, 0xE4, 0x7A, 0x74, 0xBF, 0xFA, 0xCD, 0x7D, 0x3E, 0x50, 0x86, 0x70, 0x08,
-    0x0E, 0xFD, 0x6D, 0x4C, 0x3B, 0x77, 0xAD, 0xFB, 0x22, 0xE7, 0x66, 0x17, 0x33, 0xF2, 0x63, 0x04,
-    0x0D, 0x0E, 0x1E, 0x9F, 0x2F, 0xF9, 0x42, 0x71, 0x0E, 0x88, 0xAD, 0xE5, 0xF9, 0x60, 0xBA, 0xA5,
-    0xB4, 0xF8, 0x02, 0x17, 0x93, 0x7F, 0xFD, 0x39, 0xE1, 0x8F, 0x01, 0x0A, 0x8E, 0xED, 0x61, 0x78,
-    0xE3, 0x77, 0xE5, 0x43, 0xFE, 0x3E, 0xA0, 0x7F, 0xFF, 0x25, 0x16, 0x5F, 0x3E, 0x4F, 0xBD, 0x8F,
-    0x70, 0xA7, 0x71, 0x95, 0xA5, 0x59, 0x94, 0x10, 0x36, 0x88, 0x92, 0xBA, 0x7F, 0x75, 0xE1, 0xB0,
-    0x1A, 0xF2, 0x69, 0x60, 0xAF, 0x22, 0xAF, 0x2B, 0x6C, 0xC7, 0x39, 0x1F, 0x5C, 0x18, 0x4C, 0x3F,
-    0xF0, 0x94, 0xD0, 0x79, 0x0F, 0x97, 0x95, 0xA7, 0x78, 0x20, 0xF9, 0x7E, 0x9A, 0xE1, 0x0A, 0xE3,
-    0x3D, 0xD5, 0xBB, 0xD4, 0xE1, 0x3B, 0x2E, 0xED, 0x5E, 0xF3, 0x7E, 0x99, 0xD2, 0xBD, 0xEB, 0xAB,
-    0xA7, 0x4E, 0x8F, 0x5A, 0x8A, 0xC8, 0xB6, 0xE1, 0x92, 0x4E, 0xC2, 0x3E, 0xEC, 0x2B, 0x96, 0x50,
-    0xA6, 0x2C, 0xA3, 0x9F, 0xB6, 0xD8, 0xC6, 0x6F, 0xA4, 0xAB, 0x6F, 0xC4, 0xCD, 0xBB, 0x6C, 0x7B,
-    0xE1, 0x8C, 0xCE, 0x5E, 0xCA, 0x3C, 0x7D, 0x5D, 0xE3, 0x6F, 0xE2, 0xB6, 0x72, 0x5A, 0xFE, 0x64,
-    0xEE, 0x5D, 0x6F, 0x2B, 0xBF, 0x6D, 0x95, 0x95, 0x1F, 0x57, 0xCE, 0xE1, 0x5E, 0xEB, 0xEC, 0x3B,
-    0x7A, 0xC3, 0xDE, 0x0A, 0xB9, 0x2C, 0x8B, 0x4D, 0x70, 0xB6, 0x71, 0xF6, 0xFF, 0x0B, 0xEF, 0x16,
-    0x2B, 0x35, 0x64, 0xB9, 0x86, 0x2C, 0x56, 0x6F, 0xAE, 0xF5, 0x6B, 0x4A, 0x7C, 0x86, 0x73, 0x9D,
-    0x44, 0x4F, 0x59, 0xA6, 0x7D, 0xD2, 0xE2, 0x6B, 0x1B, 0xB7, 0x08, 0x5F, 0xB7, 0x71, 0x4C, 0xA0,
-    0xC5, 0x89, 0xE7, 0x26, 0x6D, 0xFB, 0xDF, 0x47, 0xFB, 0xA5, 0x95, 0xDB, 0xA3, 0xD9, 0x68, 0x94,
-    0xD8, 0x3F, 0x28, 0xD4, 0xC8, 0xE2, 0xE7, 0xD7, 0x38, 0x71, 0x1B, 0x87, 0x8C, 0x07, 0x6E, 0x96,
-    0xA7, 0xC8, 0x99, 0x3F, 0xDF, 0x1B, 0xCE, 0xAC, 0xFC, 0x06, 0xDF, 0xF5, 0x26, 0xE5, 0xD4, 0x06,
-    0x61, 0xBF, 0x2C, 0xED, 0x7D, 0xC8, 0x7E, 0xBB, 0xD2, 0xA4, 0x2C, 0x11, 0x17, 0x68, 0xAF, 0x53,
-    0x0B, 0x2B, 0xF8, 0xC3, 0x97, 0x87, 0x4F, 0x7D, 0x3E, 0xBE, 0xC5, 0xA7, 0xE7, 0x3B, 0x75, 0x5D,
-    0x96, 0x22, 0x2A, 0xC2, 0x5C, 0x1A, 0x2F, 0x15, 0x6A, 0x99, 0xF5, 0x4C, 0xE1, 0xC4, 0x42, 0x79,
-    0xA9, 0x34, 0x61, 0x8E, 0x4F, 0xAB, 0xA5, 0x28, 0xDC, 0xC4, 0xD7, 0x9B, 0x1B, 0x9B, 0x1B, 0x7C,
-    0x8A, 0x2F, 0xA9, 0x47, 0xF2, 0x76, 0x9A, 0xFF, 0x07, 0xED, 0x53, 0x31, 0x6F, 0x13, 0x31, 0x14,
-    0xFE, 0x6C, 0x4B, 0xB1, 0xE8, 0xA9, 0x98, 0x19, 0xB5, 0xBD, 0x54, 0xEA, 0x80, 0x50, 0x9A, 0xAC,
-    0x45, 0xBA, 0x24, 0xFE, 0x07, 0x54, 0x48, 0x29, 0x43, 0x86, 0xFC, 0x84, 0x06, 0xC9, 0x45, 0x51,
-    0x13, 0xB5, 0xFE, 0x09, 0xDD, 0x59, 0xB2, 0x36, 0x42, 0x1C, 0x43, 0x07, 0x18, 0x68, 0xFC, 0x0F,
-    0xB8, 0x85, 0xFD, 0x06, 0x06, 0x98, 0x7A, 0x43, 0x90, 0xD2, 0x21, 0x35, 0xCF, 0x97, 0x80, 0x2A,
-    0x8A, 0x10, 0x0B, 0x1B, 0x7E, 0xDF, 0xDD, 0xF9, 0xEC, 0xEF, 0xDE, 0x7B, 0x9F, 0xDF, 0x3B, 0x3E,
-    0x87, 0xF2, 0xA8, 0x47, 0x2E, 0x11, 0x6E, 0xC4, 0xB3, 0x01, 0xCF, 0x07, 0x2C, 0x60, 0xC4, 0xF3,
-    0x44, 0x64, 0x2D, 0xE9, 0x62, 0xAF, 0xE5, 0x02, 0x61, 0x98, 0x2A, 0xFA, 0x66, 0x35, 0xAA, 0x58,
-    0x03, 0xDA, 0xC0, 0x14, 0xB8, 0x82, 0xF8, 0x88, 0xE8, 0x29, 0xB6, 0x14, 0x12, 0x85, 0xCB, 0x74,
-    0x3C, 0xF5, 0x05, 0x14, 0x96, 0x58, 0x9B, 0xE8, 0xD8, 0xDB, 0x5D, 0xA0, 0x56, 0xA2, 0xBD, 0x40,
-    0x7D, 0x6A, 0x21, 0x1D, 0x44, 0x46, 0x78, 0x20, 0x5C, 0x2B, 0xB5, 0x8D, 0xA5, 0xFB, 0xA9, 0x96,
-    0xDE, 0x2A, 0x0D, 0x22, 0x27, 0xC0, 0xB1, 0xD7, 0xA7, 0xAF, 0x28, 0xA3, 0x90, 0x4B, 0xC2, 0xF2,
-    0xA6, 0xC8, 0x54, 0xEA, 0xC4, 0x4D, 0x20, 0x3E, 0x9E, 0x9C, 0xB5, 0x3D, 0x7D, 0xEE, 0x20, 0x6D,
-    0x88, 0x12, 0x03, 0xCD, 0xF2, 0x9B, 0x0B, 0xA0, 0x00, 0xCF, 0x57, 0x3B, 0xFC, 0x9A, 0x94, 0xE9,
-    0xA6, 0x08, 0xCA, 0xEA, 0xD2, 0xA9, 0x2B, 0xC8, 0x1B, 0xC4, 0x3D, 0x4B, 0xB2, 0x06, 0x3C, 0xA3,
-    0x7B, 0x23, 0x75, 0x51, 0xE9, 0xB0, 0x32, 0x07, 0xA9, 0x4C, 0xA4, 0xA3, 0xF5, 0xA0, 0x9E, 0xE7,
-    0xAD, 0x6E, 0x1E, 0x2F, 0x32, 0xF6, 0xAC, 0x8C, 0x12, 0xD9, 0x87, 0x53, 0xC4, 0xB3, 0xC0, 0x64,
-    0x10, 0x36, 0x98, 0xF7, 0xCF, 0x3F, 0x85, 0x27, 0xD7, 0x80, 0xF7, 0x9D, 0xCE, 0x64, 0xE2, 0xC9,
-    0x53, 0xA7, 0xE3, 0x3D, 0x71, 0xB4, 0xB0, 0x0A, 0x5B, 0x24, 0x37, 0x21, 0xDB, 0x2B, 0x2D, 0xCC,
-    0x76, 0x71, 0x1F, 0x51, 0xF0, 0x87, 0x7D, 0x7A, 0xDB, 0xA4, 0xCC, 0x23, 0x48, 0xE2, 0x0A, 0x47,
-    0x46, 0xBE, 0xA4, 0x8E, 0x68, 0x6D, 0x17, 0x03, 0x8A, 0xF3, 0xE2, 0x06, 0xA7, 0x5D, 0x3B, 0xE2,
-    0xCE, 0xB0, 0x5F, 0x51, 0x65, 0x96, 0xFF, 0x75, 0xCD, 0xD8, 0x38, 0x2A, 0x5A, 0xC5, 0x45, 0x81,
-    0x3B, 0x46, 0x9A, 0xDB, 0x5E, 0x3F, 0x8A, 0x5C, 0xC8, 0x28, 0x88, 0xD4, 0xE1, 0x1C, 0x47, 0x60,
-    0x45, 0xA8, 0x0E, 0x4D, 0x4F, 0xBD, 0x23, 0x44, 0xD7, 0x81, 0xB6, 0x23, 0x4B, 0x8E, 0x74, 0xEC,
-    0x10, 0x11, 0x39, 0x8E, 0x57, 0xF5, 0xA3, 0xC5, 0xCB, 0x9F, 0xF5, 0xFB, 0xDF, 0x10, 0xFF, 0xB0,
-    0x21, 0xD8, 0x39, 0x54, 0x6A, 0x03, 0x99, 0x3B, 0x3E, 0x75, 0xF1, 0x81, 0x4B, 0xB8, 0xDB, 0x13,
-    0xAE, 0xD9, 0x73, 0xD1, 0xCC, 0x55, 0x3E, 0xA3, 0xFE, 0x06, 0x46, 0xEA, 0xB7, 0x21, 0x13, 0xFB,
-    0xAD, 0xA3, 0x0B, 0xFA, 0x5D, 0x81, 0xD6, 0x81, 0x26, 0x89, 0xB4, 0xDB, 0x48, 0x31, 0x10, 0xAE,
-    0xE0, 0xAE, 0x60, 0xD9, 0x12, 0x86, 0x4E, 0xBA, 0xA7, 0xE5, 0x1C, 0x3B, 0xCC, 0xD6, 0x28, 0x3F,
-    0x05, 0xF1, 0x1A, 0x6C, 0x16, 0x40, 0x13, 0x7A, 0xA5, 0x45, 0xC3, 0xB2, 0xCA, 0x17, 0xD4, 0x53,
-    0x1D, 0xE2, 0xB2, 0x0C, 0x2C, 0x6F, 0xFB, 0x3C, 0x41, 0x56, 0xE3, 0x4E, 0x75, 0x2D, 0x5F, 0xA0,
-    0x5A, 0x46, 0x59, 0xE2, 0xE8, 0x1C, 0xC3, 0xD4, 0x8E, 0xC4, 0x6F, 0x5A, 0xB6, 0x4F, 0x5D, 0x7B,
-    0x8B, 0x69, 0x2A, 0x30, 0x5B, 0x30, 0x03, 0x1C, 0xE5, 0x18, 0x3A, 0x9C, 0x64, 0x30, 0x17, 0x30,
-    0x09, 0x8C, 0x42, 0x5F, 0xDA, 0xAA, 0xB9, 0x35, 0xFA, 0xDB, 0xEF, 0xD6, 0xCE, 0x86, 0xE9, 0xF1,
-    0x7C, 0x24, 0xB2, 0x1A, 0xA5, 0xBC, 0x61, 0x84, 0xBD, 0x73, 0xF5, 0xB9, 0xDD, 0xD8, 0x7E, 0xFF,
-    0xA7, 0xE8, 0xE5, 0xAE, 0x2E, 0x77, 0x33, 0x83, 0x3C, 0x20, 0xFC, 0x2D, 0xEE, 0xA4, 0x6B, 0x5F,
-    0x2E, 0x6E, 0x25, 0x46, 0x95, 0xFF, 0x1A, 0x4E, 0x72, 0xAF, 0xEC, 0x1E, 0x45, 0x8A, 0x3F, 0x94,
-    0x6D, 0x2B, 0xF1, 0xA4, 0x87, 0xC6, 0x1C, 0xF7, 0xB0, 0x8E, 0xC6, 0xF8, 0x70, 0xBC, 0x89, 0x1F,
-    0xB6, 0x0E, 0xB5, 0x2F, 0x67, 0xDF, 0x01, 0x9D, 0x57, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24,
-    0x63, 0x13, 0x35, 0x81, 0x5E, 0x0D, 0x35, 0x0C, 0x44, 0x75, 0xB8, 0xB7, 0x56, 0xB8, 0x16, 0x88,
-    0x1E, 0xC9, 0xA6, 0x43, 0x56, 0x0D, 0x7E, 0xC9, 0xE0, 0x21, 0x4B, 0xA6, 0xAA, 0xE9, 0x2B, 0x50,
-    0x0F, 0x41, 0xC1, 0x67, 0xB2, 0x2A, 0xD0, 0xA5, 0x8B, 0x86, 0xA4, 0x1D, 0x2B, 0x14, 0x1D, 0x02,
-    0x05, 0xAD, 0x35, 0xA4, 0x80, 0x51, 0x50, 0x26, 0x55, 0x0F, 0x1D, 0x3C, 0x94, 0x8E, 0xEB, 0x76,
-    0x08, 0xD0, 0x10, 0x88, 0x54, 0x03, 0x12, 0x10, 0x5D, 0x14, 0x7C, 0x35, 0xF5, 0x44, 0xF2, 0xF6,
-    0x3B, 0x97, 0x7C, 0x92, 0x92, 0xC0, 0x41, 0x5B, 0x4A, 0xE7, 0x7B, 0xEF, 0x9D, 0x7B, 0xCF, 0xBD,
-    0xE7, 0x9E, 0xDF, 0x4B, 0x22, 0x22, 0x53, 0x95, 0x24, 0x94, 0x24, 0x2F, 0x5C, 0xA3, 0x29, 0x7E,
-    0xA7, 0xA0, 0x06, 0x54, 0x9B, 0xDB, 0xBF, 0xAD, 0x2D, 0x55, 0xD7, 0xD6, 0xC1, 0x5A, 0x63, 0x15,
-    0x94, 0x82, 0x02, 0x90, 0x7B, 0x74, 0xB8, 0x65, 0x2B, 0x08, 0x5C, 0x3B, 0x58, 0x23, 0xFC, 0xFE,
-    0x3C, 0xA9, 0x5A, 0x13, 0x3F, 0x46, 0x51, 0x92, 0xB9, 0x57, 0x90, 0x7D, 0x54, 0x50, 0xAC, 0x1A,
-    0x53, 0x7D, 0x5C, 0x3B, 0xA7, 0xDF, 0xDB, 0x74, 0x1F, 0xDA, 0x61, 0x20, 0x1C, 0xF2, 0x85, 0xA0,
-    0xE9, 0x4B, 0x82, 0xA2, 0xEB, 0x5F, 0xA7, 0xF4, 0xC6, 0x75, 0x8A, 0x56, 0x6F, 0x80, 0x56, 0x69,
-    0xF4, 0xCE, 0x2A, 0x05, 0xB7, 0xBF, 0x43, 0x9E, 0xBC, 0x4D, 0x42, 0xEE, 0x90, 0x7D, 0x22, 0xDF,
-    0x32, 0x94, 0xAA, 0x8C, 0x63, 0x55, 0xF2, 0x72, 0xD6, 0x9F, 0x72, 0x32, 0x37, 0x12, 0xBD, 0x05,
-    0x2D, 0xAB, 0x4D, 0xCA, 0x54, 0x65, 0xB5, 0xC6, 0x8E, 0x53, 0x12, 0x89, 0x9C, 0xC8, 0x03, 0x3B,
-    0x00, 0xF9, 0xA0, 0x91, 0xF9, 0xF3, 0x2A, 0xB2, 0x8E, 0x65, 0x64, 0xB5, 0x4B, 0x91, 0x25, 0x69,
-    0x6A, 0x95, 0x34, 0x82, 0x9E, 0x3E, 0xC8, 0xE3, 0xB3, 0xFC, 0xAC, 0x20, 0xF1, 0x18, 0x6B, 0x3E,
-    0x2B, 0xD6, 0x0C, 0x3E, 0x93, 0x07, 0x63, 0x10, 0x8E, 0x85, 0xEF, 0x9A, 0x0E, 0xC6, 0x6B, 0x5F,
-    0x3A, 0xE2, 0xE7, 0x8E, 0xAB, 0x4A, 0x4D, 0x17, 0x78, 0x93, 0xF9, 0x16, 0x54, 0x2A, 0xC9, 0xFE,
-    0xC2, 0x5C, 0xFD, 0xD8, 0x18, 0xF0, 0x54, 0x43, 0x71, 0x78, 0x5B, 0x1B, 0x9A, 0x2D, 0x55, 0x9D,
-    0x93, 0xA7, 0x54, 0x18, 0x80, 0x8C, 0x81, 0xFF, 0xAD, 0x6E, 0x9B, 0xF8, 0xF7, 0xD5, 0x93, 0xB1,
-    0xFE, 0x6D, 0x48, 0xAC, 0x05, 0x0D, 0xDD, 0x27, 0xE3, 0x9B, 0xE0, 0x77, 0x4C, 0x6C, 0xE9, 0x50,
-    0xAF, 0xAD, 0x6D, 0x22, 0xF4, 0x3E, 0x2F, 0x11, 0xBD, 0xE5, 0xED, 0xFB, 0x5D, 0x98, 0xAA, 0x2E,
-    0x56, 0x65, 0x76, 0x10, 0xB7, 0x6F, 0x54, 0x19, 0xEC, 0x49, 0xF5, 0x7D, 0x72, 0x0A, 0x6A, 0x76,
-    0xC9, 0xC9, 0x29, 0x4D, 0x07, 0x14, 0x1A, 0x3D, 0x8D, 0x81, 0xC6, 0x4C, 0xE3, 0x29, 0xA3, 0x71,
-    0xC4, 0x68, 0x3D, 0x64, 0xB4, 0x7F, 0xC1, 0x28, 0x58, 0x8A, 0xF7, 0xC0, 0xB3, 0xAA, 0x31, 0xA2,
-    0xB3, 0xC7, 0x2E, 0x49, 0x92, 0x2D, 0x19, 0x2A, 0x86, 0x86, 0x61, 0x97, 0xE1, 0xF7, 0x0C, 0x9F,
-    0x00, 0x26, 0xC7, 0xDB, 0x73, 0xD8, 0x08, 0x07, 0x5B, 0xFE, 0xFB, 0x93, 0x19, 0xD9, 0x0F, 0x4A,
-    0x49, 0xB7, 0xFE, 0x36, 0x9B, 0xF5, 0xBC, 0xF5, 0xC3, 0x6E, 0x4E, 0x76, 0x1E, 0x61, 0x72, 0x3E,
-    0x62, 0xF0, 0x18, 0xC4, 0x19, 0x38, 0x0C, 0x70, 0x66, 0x76, 0x82, 0xDD, 0x94, 0x82, 0x69, 0xDB,
-    0x09, 0x6C, 0xD3, 0x18, 0x0D, 0x07, 0xEE, 0x2E, 0xC3, 0x48, 0x83, 0xC3, 0x20, 0x00, 0xA9, 0x8B,
-    0xD1, 0x56, 0x35, 0xED, 0xE4, 0x5F, 0xAA, 0x51, 0x2A, 0x77, 0x49, 0x9D, 0x90, 0xCB, 0x51, 0xFE,
-    0x7C, 0x08, 0x01, 0xA2, 0x03, 0xD8, 0x6C, 0x61, 0x5A, 0x8A, 0x79, 0x37, 0x28, 0xC8, 0x9E, 0xDC,
-    0xBD, 0x25, 0x39, 0x51, 0xB4, 0x97, 0x52, 0x9D, 0x2C, 0x29, 0xA5, 0x97, 0x3B, 0x46, 0x57, 0xE5,
-    0x40, 0xFF, 0xB5, 0x30, 0xA5, 0x1A, 0x46, 0x49, 0x4D, 0x19, 0x69, 0xA9, 0x3B, 0x8C, 0x61, 0x90,
-    0xD0, 0xEE, 0x84, 0x44, 0x45, 0xA9, 0x48, 0x4C, 0x45, 0x29, 0xEC, 0x18, 0x24, 0x29, 0x3C, 0x2A,
-    0x72, 0xCC, 0xC4, 0xB1, 0x52, 0xA3, 0x62, 0xA4, 0x66, 0x13, 0x1C, 0x9A, 0x42, 0x24, 0x25, 0x3F,
-    0x6E, 0xA9, 0x77, 0x72, 0x84, 0x1D, 0xA2, 0x55, 0x6A, 0x19, 0x3A, 0xBA, 0x37, 0x22, 0x45, 0xD5,
-    0xCB, 0xC6, 0x31, 0xC0, 0x84, 0x59, 0x5D, 0xF3, 0xE3, 0xEF, 0x4A, 0x61, 0xFD, 0xF9, 0xA7, 0x0C,
-    0x1B, 0xE5, 0xE4, 0x83, 0xA3, 0xA3, 0x9A, 0x0D, 0xDA, 0x2E, 0x7F, 0xF2, 0xAB, 0xA7, 0x7F, 0xB5,
-    0x1F, 0xBE, 0xFA, 0x38, 0xB7, 0xFE, 0x62, 0x7C, 0x0A, 0xA0, 0xA7, 0x89, 0xF5, 0x0F, 0x7A, 0x16,
-    0x9A, 0x9F, 0xD1, 0x69, 0x68, 0xB4, 0x94, 0x11, 0x6C, 0x97, 0xB1, 0xCD, 0x62, 0x06, 0x1F, 0xE9,
-    0xBA, 0x45, 0x51, 0xA6, 0xB0, 0x51, 0x8A, 0x50, 0x8D, 0x38, 0x40, 0x00, 0xF0, 0x49, 0x7A, 0xC5,
-    0x2A, 0xA2, 0x54, 0xFC, 0x4F, 0x60, 0x6E, 0x22, 0x62, 0x10, 0xEA, 0x00, 0xA3, 0x02, 0x38, 0x32,
-    0x15, 0x70, 0x02, 0xA0, 0x3D, 0x0B, 0x9A, 0x6A, 0x80, 0x2B, 0xDB, 0x5D, 0x48, 0xAE, 0x52, 0x09,
-    0x5D, 0x1A, 0x9F, 0x0C, 0xBC, 0xC9, 0x66, 0x85, 0x44, 0x6B, 0x2A, 0x12, 0x33, 0xF8, 0xD9, 0x4D,
-    0x10, 0x56, 0x01, 0x99, 0x15, 0xD4, 0x84, 0xB1, 0xA6, 0x3C, 0xE5, 0x0B, 0x30, 0x62, 0x08, 0x78,
-    0xD4, 0x23, 0x0B, 0x62, 0x85, 0x03, 0xA3, 0xAA, 0xB6, 0x22, 0x43, 0x55, 0x1F, 0x12, 0x5D, 0x5A,
-    0x6C, 0x6A, 0x8C, 0xC7, 0x37, 0xC9, 0x81, 0x81, 0xE8, 0xF2, 0xF6, 0xF6, 0xFB, 0x0B, 0x66, 0x06,
-    0xAF, 0x82, 0x89, 0x22, 0x52, 0xFC, 0x90, 0xE8, 0x3E, 0x0D, 0xE5, 0x90, 0x53, 0x8F, 0x2C, 0x86,
-    0x6B, 0x07, 0x48, 0xC6, 0x98, 0x75, 0xFC, 0xF6, 0x7C, 0x3B, 0xD4, 0x79, 0xDE, 0x43, 0xCC, 0x52,
-    0x31, 0x67, 0xA4, 0x9E, 0x67, 0x32, 0xE8, 0x0C, 0xE7, 0xA0, 0xC4, 0x7A, 0xC9, 0x15, 0x84, 0x14,
-    0x0F, 0x9B, 0xFA, 0xE4, 0x97, 0x74, 0x5D, 0xF0, 0x18, 0x76, 0x01, 0x50, 0xD7, 0x2A, 0x10, 0x0A,
-    0x56, 0x81, 0x6C, 0xB4, 0x0A, 0x8F, 0x47, 0x21, 0x67, 0x3D, 0x82, 0x09, 0xAC, 0xC7, 0x48, 0xFA,
-    0x75, 0x75, 0xF8, 0x3E, 0x67, 0x48, 0x43, 0xD7, 0xBA, 0x19, 0x6A, 0x94, 0xAC, 0x79, 0xCA, 0x94,
-    0x16, 0x93, 0xB5, 0x18, 0x14, 0xB1, 0x0A, 0xEC, 0x8C, 0x45, 0x1B, 0x86, 0x3B, 0x7A, 0x8F, 0x10,
-    0xAA, 0x29, 0xD2, 0x70, 0xF5, 0x8D, 0xD9, 0xB8, 0x2F, 0x22, 0x0B, 0xD8, 0x02, 0x3C, 0xE5, 0xC2,
-    0x82, 0x13, 0x91, 0xC5, 0x9A, 0x09, 0xD6, 0x3C, 0x2E, 0xB1, 0xC7, 0xB3, 0x4F, 0xB1, 0xD4, 0x03,
-    0x95, 0x0F, 0x03, 0x4E, 0x3F, 0x80, 0x13, 0x9C, 0x96, 0x83, 0x56, 0xC6, 0xC5, 0xA5, 0xCE, 0xFC,
-    0xB9, 0xDC, 0xF7, 0x80, 0x80, 0xAD, 0x44, 0xB4, 0x12, 0x4E, 0xB4, 0x2D, 0xC8, 0xD4, 0xDC, 0x51,
-    0x6F, 0x8F, 0x48, 0x97, 0x68, 0x84, 0xB4, 0xD7, 0xDB, 0xC9, 0x1D, 0x3E, 0x42, 0xED, 0x76, 0xFE,
-    0x80, 0xCD, 0xDD, 0xDE, 0x90, 0x1E, 0x7D, 0x3F, 0xC4, 0xF2, 0x81, 0x89, 0x9A, 0x8C, 0xF2, 0xED,
-    0xFC, 0xB3, 0xB1, 0x51, 0x82, 0x44, 0x18, 0xD9, 0xB9, 0x51, 0x7B, 0x14, 0x39, 0xB9, 0x2D, 0x7D,
-    0x8A, 0x44, 0xE2, 0xE5, 0x23, 0xF0, 0x7F, 0xA9, 0xE8, 0x8E, 0x59, 0xB9, 0x50, 0x02, 0xC5, 0xCF,
-    0x43, 0x48, 0x65, 0x5A, 0x0F, 0xAA, 0x97, 0xCE, 0xA3, 0xAD, 0xF7, 0xE8, 0xC2, 0x4D, 0x64, 0xF6,
-    0xCA, 0x0F, 0x67, 0x38, 0x2B, 0xD8, 0x14, 0xE3, 0x9B, 0xAA, 0x30, 0x8B, 0xCD, 0x19, 0x9D, 0x53,
-    0x79, 0x0F, 0x3C, 0x84, 0x94, 0x84, 0xF8, 0x0C, 0x42, 0xA7, 0x98, 0x17, 0x27, 0xBA, 0xF5, 0x84,
-    0xA0, 0x3C, 0x0E, 0x4D, 0xA9, 0x72, 0xEB, 0xDF, 0x4F, 0x73, 0xA1, 0x1E, 0x94, 0x6E, 0xB0, 0x21,
-    0x7D, 0x41, 0x55, 0xF4, 0x35, 0xAA, 0x87, 0x1E, 0x1B, 0x5D, 0x20, 0xF0, 0x32, 0xC9, 0xF2, 0x96,
-    0xDA, 0xD7, 0x5D, 0x25, 0x24, 0xEB, 0xC9, 0x84, 0x5D, 0x89, 0x42, 0xBA, 0x3E, 0xFF, 0x60, 0x1E,
-    0xEA, 0xCA, 0x08, 0xAD, 0x6A, 0xD2, 0xB0, 0x7E, 0xB8, 0xA8, 0xA0, 0x88, 0x19, 0xF6, 0xB6, 0x5B,
-    0x0C, 0x62, 0xAA, 0x1E, 0xB4, 0xFF, 0x6A, 0x18, 0x1E, 0xA1, 0x2F, 0x00, 0x30, 0x10, 0x3A, 0x4F,
-    0x49, 0xEA, 0xD7, 0xCB, 0xB9, 0x55, 0x83, 0xE7, 0x94, 0x82, 0x9B, 0x29, 0xC0, 0x0B, 0x05, 0x9F,
-    0x49, 0x70, 0x3F, 0xBD, 0x00, 0x4A, 0x2E, 0xE0, 0x75, 0x89, 0x51, 0x53, 0x7A, 0x0C, 0x6E, 0x02,
-    0x10, 0x05, 0xC0, 0xAE, 0x00, 0x66, 0xF7, 0xE6, 0x65, 0xC9, 0x51, 0x27, 0x39, 0xA1, 0x36, 0xA9,
-    0xF7, 0xB0, 0x6E, 0x50, 0x2F, 0xF0, 0xBE, 0xEC, 0x06, 0x8B, 0xCD, 0x61, 0x73, 0x82, 0x39, 0x3A,
-    0xF2, 0x50, 0x80, 0xC8, 0xE5, 0x79, 0x81, 0x40, 0x00, 0x8C, 0x10, 0xD3, 0x7C, 0xCA, 0x42, 0x03,
-    0x55, 0x38, 0xAA, 0x29, 0x91, 0x28, 0xE7, 0x3C, 0x54, 0xD0, 0x29, 0x89, 0x04, 0x3A, 0x21, 0x60,
-    0x3C, 0x0E, 0x25, 0x37, 0xF4, 0x59, 0x77, 0xE4, 0x85, 0x93, 0x37, 0x0B, 0x87, 0x1A, 0x59, 0x87,
-    0x12, 0xA0, 0x0A, 0x6B, 0x7F, 0x59, 0x0E, 0x3B, 0xD7, 0x3D, 0x19, 0x15, 0xD6, 0xE9, 0x98, 0x50,
-    0x1E, 0xB0, 0x04, 0x5C, 0xAD, 0xE3, 0x45, 0x29, 0xE6, 0xB1, 0x26, 0xDE, 0x40, 0x2E, 0xBC, 0x2B,
-    0xF6, 0x8D, 0x7B, 0x58, 0xA7, 0xD6, 0x8D, 0xC0, 0x58, 0x5B, 0x98, 0x71, 0x05, 0x74, 0x19, 0x3D,
-    0x45, 0x37, 0x6B, 0x43, 0xFD, 0x6E, 0x82, 0x73, 0x81, 0x27, 0x0A, 0x80, 0x9B, 0xAF, 0xB0, 0x19,
-    0x57, 0xD8, 0x8C, 0x2B, 0x6C, 0xBC, 0xE7, 0x80, 0x1E, 0xF5, 0x18, 0xDC, 0x84, 0x65, 0x59, 0xCC,
-    0x96, 0x00, 0xB3, 0x7B, 0xFB, 0x45, 0xEE, 0x1E, 0x1D, 0xD7, 0xA5, 0x76, 0xD8, 0xAD, 0x07, 0x36,
-    0x63, 0x68, 0xF0, 0x55, 0xCB, 0x0E, 0xC9, 0x2C, 0x9C, 0x90, 0xCB, 0x40, 0x48, 0xCE, 0xFC, 0xEE,
-    0x61, 0xC2, 0xD9, 0x9E, 0x5F, 0x3B, 0xB8, 0xFB, 0x1E, 0x42, 0xC4, 0xE5, 0x81, 0xFF, 0x02, 0xC4,
-    0x39, 0x70, 0x31, 0x71, 0x10, 0xC0, 0x85, 0xC9, 0xD9, 0x4F, 0xDF, 0x58, 0x1C, 0xD5, 0xE1, 0x1B,
-    0x52, 0xCC, 0x7A, 0xB4, 0x46, 0xDA, 0x17, 0xBA, 0x0B, 0x15, 0x40, 0x2E, 0xFC, 0x4A, 0x1D, 0xA7,
-    0x71, 0x5C, 0x69, 0x09, 0xFD, 0x55, 0x2E, 0x1C, 0x4D, 0xBB, 0x2F, 0x5E, 0xD9, 0xD8, 0xF2, 0x5F,
-    0xF9, 0xE3, 0x67, 0xA9, 0xF7, 0xE3, 0xA2, 0xBA, 0xF1, 0xF2, 0x2B, 0xF9, 0xCE, 0x37, 0x47, 0x6E,
-    0xBE, 0x73, 0xBD, 0xB1, 0xBB, 0xD9, 0x44, 0x9A, 0xC7, 0x30, 0xA2, 0x99, 0xFF, 0xE1, 0x07, 0x64,
-    0x62, 0x00, 0x07, 0x5C, 0x7A, 0x81, 0x83, 0xA8, 0x85, 0x3F, 0xDA, 0xAB, 0x5C, 0xB2, 0xF1, 0xF0,
-    0x67, 0x36, 0xF0, 0x74, 0xF1, 0xFD, 0x3F, 0x08, 0xB2, 0x9C, 0x56, 0xDC, 0x00, 0xFB, 0x1B, 0xA3,
-    0x08, 0xCF, 0x78, 0x1C, 0x52, 0xDA, 0xE9, 0xA8, 0xFF, 0xDC, 0x10, 0xB2, 0xA4, 0xBF, 0x50, 0x72,
-    0x3C, 0xF0, 0x25, 0x53, 0x5F, 0xEE, 0xE4, 0x10, 0x45, 0xBB, 0x83, 0x3C, 0x97, 0x2C, 0xD9, 0xD7,
-    0x15, 0x43, 0x1A, 0x20, 0x8F, 0x8C, 0xD3, 0x0E, 0xF9, 0xB5, 0xA9, 0x0D, 0xF1, 0x13, 0xB9, 0x4C,
-    0xC6, 0x5C, 0x21, 0xCC, 0x50, 0x91, 0x21, 0x77, 0x07, 0x65, 0x0D, 0x73, 0xFD, 0x81, 0xA6, 0xA0,
-    0x14, 0x72, 0xB5, 0x21, 0x6D, 0xC4, 0xF8, 0x24, 0xC7, 0x85, 0x14, 0x73, 0xF7, 0xCF, 0x93, 0x95,
-    0x1C, 0x6D, 0x59, 0x5F, 0x57, 0xCF, 0x77, 0x74, 0x32, 0x7D, 0xA8, 0xB3, 0xE9, 0x9E, 0x46, 0xFF,
-    0xCD, 0xF7, 0xC6, 0x6B, 0xDC, 0x3C, 0x39, 0x94, 0xEF, 0x1E, 0x6E, 0xE3, 0x0A, 0x27, 0x74, 0x5D,
-    0xE3, 0x51, 0x49, 0x02, 0x71, 0xB2, 0x43, 0x42, 0xBC, 0x96, 0x00, 0xE3, 0xE3, 0x12, 0x38, 0x6B,
-    0xEE, 0x63, 0xB4, 0xF8, 0x91, 0x9B, 0xF3, 0xDD, 0x8F, 0xAF, 0x37, 0x1A, 0x7F, 0xD3, 0x57, 0xC4,
-    0x96, 0x96, 0x74, 0x53, 0x93, 0x0B, 0xAF, 0xF7, 0xF1, 0xD6, 0x67, 0x71, 0x5F, 0xB4, 0x9F, 0x87,
-    0x46, 0xF6, 0x2E, 0x0D, 0x3D, 0xD2, 0x54, 0x19, 0x4A, 0x9B, 0x53, 0x79, 0x66, 0x03, 0xCB, 0x79,
-    0x30, 0x28, 0x67, 0x69, 0x80, 0x3F, 0x4F, 0xA7, 0x2A, 0x0A, 0x47, 0x32, 0xD2, 0x38, 0x1D, 0x90,
-    0xBE, 0x02, 0x2D, 0x24, 0x99, 0xBE, 0x70, 0x1F, 0xDC, 0xAA, 0x51, 0xC7, 0xDA, 0xE1, 0x2E, 0x1F,
-    0x0C, 0xC4, 0xDF, 0xA7, 0x68, 0xA5, 0xCD, 0x7A, 0x97, 0x49, 0xF8, 0x31, 0x59, 0x9F, 0xBF, 0x7B,
-    0x76, 0x01, 0xCF, 0x70, 0x12, 0xBC, 0x2B, 0x7C, 0xE9, 0x12, 0x8F, 0x9B, 0x15, 0x1C, 0xC7, 0xAF,
-    0x16, 0x64, 0x1D, 0x02, 0xB8, 0x6D, 0x90, 0x3A, 0x42, 0x69, 0x3D, 0xDD, 0x3B, 0x2E, 0x9C, 0x8F,
-    0xF6, 0x1E, 0x4B, 0xB1, 0xB1, 0x57, 0xD4, 0xDE, 0xAB, 0x7B, 0x45, 0x1A, 0x60, 0xDE, 0x94, 0xC1,
-    0xF7, 0xCF, 0x81, 0x86, 0x00, 0xE8, 0x0F, 0xAF, 0x1B, 0x18, 0x07, 0x49, 0x9F, 0x13, 0xFA, 0x96,
-    0x48, 0xF1, 0xA6, 0xBE, 0x55, 0xA8, 0x4A, 0x83, 0xF1, 0x28, 0x27, 0xE3, 0xA3, 0x42, 0x53, 0x00,
-    0xD3, 0x06, 0x88, 0x62, 0xFF, 0x75, 0x15, 0x8E, 0x50, 0x2D, 0x46, 0x90, 0x1D, 0xA1, 0x76, 0xF5,
-    0x9F, 0x6C, 0x9C, 0x18, 0xE3, 0xB5, 0x26, 0xDF, 0xC8, 0xC2, 0x9E, 0x6F, 0x17, 0x23, 0x2C, 0xDF,
-    0x13, 0x7F, 0x17, 0xB9, 0x6F, 0xC4, 0x49, 0x00, 0xD7, 0x07, 0x38, 0xE2, 0x62, 0x6D, 0xE3, 0x11,
-    0xBF, 0x90, 0xE0, 0x2D, 0xAE, 0x13, 0xB3, 0xB7, 0xBD, 0x90, 0x95, 0x9C, 0xEA, 0x8E, 0x93, 0x2E,
-    0xFE, 0xA7, 0x3A, 0xAE, 0xC1, 0x77, 0x8B, 0x4B, 0x36, 0xA4, 0xB3, 0xB6, 0x7F, 0x9B, 0x88, 0xF9,
-    0xBD, 0xA1, 0xBB, 0x3A, 0xBE, 0xF9, 0x1F, 0x13, 0x0D, 0x0D, 0x0D, 0xD8, 0xFF, 0xFF, 0xFF, 0x87,
-    0x7A, 0x20, 0x06, 0x00, 0xBD, 0x92, 0x3D, 0x4E, 0xC3, 0x40, 0x10, 0x85, 0x9F, 0x0D, 0xCA, 0x16,
-    0x2E, 0xD2, 0x44, 0x4A, 0xE9, 0x96, 0xCE, 0x37, 0xC0, 0xCE, 0x0D, 0x28, 0xD2, 0xD3, 0x50, 0x70,
-    0x88, 0x05, 0xFB, 0x08, 0x34, 0xDC, 0x80, 0x26, 0x37, 0xA0, 0xB0, 0xE5, 0xA5, 0x4A, 0x41, 0xE3,
-    0x23, 0xA4, 0x43, 0xA2, 0x4A, 0x61, 0x4B, 0x56, 0xB4, 0x30, 0xCC, 0x8C, 0x1D, 0xE1, 0x12, 0xC4,
-    0x4F, 0xB1, 0x9F, 0xB5, 0x3B, 0xDE, 0xE7, 0xE7, 0x37, 0x83, 0x20, 0xC3, 0x02, 0x48, 0x7C, 0x48,
-    0x0E, 0xE4, 0xE7, 0xE4, 0x82, 0x1E, 0x71, 0x81, 0x70, 0x8F, 0x04, 0x38, 0x39, 0x32, 0x05, 0xA2,
-    0xC3, 0x5D, 0xBE, 0x41, 0x4D, 0x2F, 0xF4, 0x8E, 0x65, 0xB7, 0xCA, 0xD7, 0xE3, 0xF9, 0x6F, 0x11,
-    0xEC, 0x84, 0x7D, 0x2C, 0xD8, 0x45, 0xC9, 0x1E, 0x2A, 0x76, 0x70, 0xC6, 0x15, 0xA9, 0xCA, 0xB7,
-    0xAF, 0x6B, 0xDA, 0xD9, 0x65, 0x97, 0x59, 0xDE, 0x7F, 0x7B, 0x8D, 0xDA, 0x96, 0xB5, 0x2D, 0x6B,
-    0xDB, 0x70, 0x52, 0x63, 0x6D, 0xFB, 0x53, 0x6D, 0x4E, 0x50, 0x23, 0x7C, 0xCA, 0x34, 0xC3, 0xE7,
-    0x21, 0xC4, 0xA8, 0xD1, 0x14, 0xC3, 0x62, 0x88, 0xF1, 0xF8, 0x9F, 0x1A, 0xE4, 0xAC, 0xD0, 0x24,
-    0x8D, 0xD3, 0x28, 0x8D, 0xD3, 0xDA, 0xDF, 0x3C, 0xA6, 0x06, 0xB7, 0x43, 0x93, 0xB7, 0x83, 0x41,
-    0xE3, 0xD4, 0xA0, 0xBE, 0x99, 0x7C, 0x5E, 0x50, 0x83, 0xC6, 0xFD, 0x9F, 0x41, 0x71, 0x67, 0xA8,
-    0x05, 0x62, 0x7A, 0x03, 0x1F, 0xE5, 0xC0, 0x0D, 0xE6, 0x19, 0x67, 0xCB, 0x28, 0x07, 0xE4, 0xAF,
-    0x45, 0x19, 0x10, 0xB9, 0x12, 0x97, 0xF7, 0x59, 0x39, 0x29, 0x7C, 0x05, 0x85, 0xC0, 0x31, 0x8C,
-    0x08, 0xC8, 0xA8, 0x03, 0xA7, 0xBC, 0x70, 0x21, 0x88, 0x88, 0xA7, 0x03, 0x29, 0x35, 0xCC, 0x4A,
-    0xC6, 0x0D, 0x7D, 0x20, 0x6C, 0x95, 0x8F, 0xCC, 0x90, 0xBC, 0x39, 0x3C, 0xC4, 0xE4, 0x13, 0xF2,
-    0xE9, 0xAA, 0x9C, 0x75, 0x6B, 0xCB, 0xF3, 0x2A, 0xCD, 0x17, 0xDE, 0x2A, 0x93, 0x9D, 0x90, 0xB5,
-    0xE4, 0x56, 0xBD, 0x17, 0x1A, 0xAF, 0x0A, 0x95, 0xF2, 0x7C, 0x64, 0x8B, 0x2B, 0x54, 0xF0, 0xC8,
-    0xA9, 0x47, 0xCD, 0x82, 0x0D, 0x37, 0x46, 0x7D, 0x64, 0x1F, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21,
-    0x10, 0x85, 0xE1, 0x77, 0x43, 0x40, 0x70, 0x01, 0x76, 0x70, 0x25, 0x98, 0x98, 0x43, 0x27, 0xB6,
-    0x61, 0xE2, 0x78, 0x55, 0x58, 0x8B, 0x99, 0x96, 0x40, 0x09, 0xD8, 0x03, 0x01, 0x01, 0xEC, 0x73,
-    0xF7, 0x18, 0x99, 0x81, 0x3F, 0xF8, 0x66, 0x87, 0x05, 0xFE, 0xE7, 0x32, 0x33, 0x8E, 0xD7, 0x31,
-    0x59, 0x02, 0xB3, 0x25, 0xB2, 0x5A, 0xE4, 0x69, 0xE8, 0x32, 0xA2, 0x62, 0xF8, 0x20, 0x28, 0xC6,
-    0xEF, 0x6B, 0x55, 0x24, 0xBB, 0x1F, 0x3A, 0xC5, 0xBE, 0x32, 0x05, 0xB2, 0xEA, 0x64, 0x24, 0xF3,
-    0x99, 0xF5, 0x41, 0xA6, 0x37, 0xDB, 0x46, 0x51, 0x2E, 0x9E, 0xE2, 0xC9, 0x7D, 0xA1, 0xAC, 0x14,
-    0x40, 0x91, 0x0D, 0xD8, 0x34, 0x05, 0xF0, 0xC3, 0x73, 0x07, 0x96, 0xEE, 0xC4, 0xFE, 0xBB, 0xBB,
-    0x66, 0xD9, 0xAE, 0xC5, 0x72, 0x90, 0xA2, 0xCC, 0x3D, 0x6F, 0x33, 0x27, 0xBD, 0x3F,
+static const uint8_t notosans_14_regularBitmaps[30220] = {
+    0xBD, 0x58, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0x23, 0x11, 0x30, 0x81, 0x8C, 0x8B, 0x73,
+    0x0C, 0x58, 0x05, 0x1B, 0x17, 0x8E, 0x11, 0x98, 0x6D, 0x8A, 0xE3, 0x8F, 0xE0, 0xC2, 0x65, 0xAE,
+    0xD0, 0xDA, 0xC5, 0x15, 0x69, 0xAE, 0x10, 0x02, 0x04, 0xD7, 0xAA, 0xE0, 0x1E, 0x89, 0xB8, 0x4C,
+    0x91, 0x6B, 0xD2, 0xAB, 0x50, 0xE1, 0x5C, 0x0A, 0xA5, 0x50, 0xA1, 0x04, 0xDC, 0x23, 0x0D, 0x17,
+    0x2A, 0x52, 0x98, 0x88, 0x91, 0x5A, 0x44, 0x7C, 0x82, 0x01, 0x37, 0x21, 0x60, 0x0A, 0xA2, 0x22,
+    0xDE, 0x4E, 0xBE, 0x6F, 0xC8, 0xBD, 0x5B, 0xD9, 0x77, 0xA7, 0x13, 0x24, 0x9B, 0xCB, 0xF7, 0x96,
+    0x1C, 0xCE, 0xBC, 0x99, 0xF7, 0xFF, 0x66, 0x16, 0x8B, 0xC5, 0x7C, 0x9E, 0xA6, 0xE9, 0xE6, 0x78,
+    0x89, 0x6C, 0x1C, 0x2E, 0x17, 0x1B, 0x72, 0xCF, 0x6E, 0x9D, 0xDA, 0xAB, 0x54, 0x12, 0x48, 0x24,
+    0xA1, 0xA4, 0x52, 0xE0, 0x37, 0x4C, 0x3F, 0x3E, 0xCF, 0xD1, 0x1A, 0x4B, 0x20, 0x2A, 0xF7, 0x2A,
+    0xA7, 0xB6, 0x5A, 0xD9, 0xF9, 0x40, 0x54, 0xC2, 0x67, 0xBB, 0xB5, 0x3A, 0xE9, 0xD1, 0x25, 0x35,
+    0x9D, 0xA2, 0xE9, 0x17, 0xE2, 0x8D, 0x64, 0x7A, 0xAB, 0x73, 0x0C, 0x6D, 0x5F, 0x7E, 0x29, 0x57,
+    0xC4, 0xC7, 0x0C, 0xB1, 0x99, 0xE1, 0x96, 0xFC, 0x4D, 0xF4, 0xA0, 0x87, 0xD9, 0x8D, 0x71, 0x09,
+    0xBC, 0xCA, 0x4E, 0x1C, 0xBD, 0x14, 0xAF, 0x09, 0x72, 0x4E, 0x14, 0x88, 0xD3, 0x44, 0x62, 0xB7,
+    0xA1, 0x58, 0x84, 0x2E, 0x15, 0xF9, 0x01, 0xB0, 0x9D, 0xDF, 0xD9, 0x8F, 0xFD, 0x55, 0xE2, 0xD6,
+    0x5E, 0xED, 0x57, 0x8E, 0xD6, 0xA0, 0xD7, 0x8B, 0x58, 0xA0, 0xAB, 0x12, 0xC9, 0x12, 0x5B, 0x27,
+    0xEA, 0x61, 0x12, 0xFF, 0x26, 0xF9, 0x15, 0x5E, 0x5F, 0xEA, 0xC6, 0x65, 0xEB, 0x46, 0x02, 0x7D,
+    0x0C, 0x32, 0x59, 0xF2, 0x2E, 0xA4, 0x20, 0xE2, 0x55, 0xA7, 0xC0, 0x77, 0x1F, 0xFD, 0x62, 0xF4,
+    0x2C, 0xD0, 0xB9, 0x43, 0x73, 0x2D, 0x12, 0xA0, 0x69, 0xF1, 0xFC, 0xEB, 0xE1, 0x6C, 0xB6, 0xA5,
+    0xB5, 0x6E, 0x09, 0x23, 0xDD, 0x0E, 0x74, 0xB5, 0xC4, 0xC9, 0x6E, 0xBE, 0x61, 0x68, 0xB9, 0xF5,
+    0x04, 0xA4, 0x0B, 0xC8, 0xC4, 0xD2, 0x3D, 0xFA, 0x81, 0x95, 0x59, 0x99, 0x8F, 0x94, 0x1C, 0x8C,
+    0xB5, 0x27, 0xE0, 0xB3, 0xDB, 0xDC, 0x91, 0xA0, 0x2A, 0x41, 0x27, 0x60, 0x3F, 0x23, 0x4C, 0x8E,
+    0x45, 0x23, 0x50, 0x46, 0xF4, 0x0C, 0xC8, 0xFE, 0x86, 0xF4, 0x1F, 0x90, 0xF0, 0x47, 0x40, 0x11,
+    0xA7, 0x48, 0x89, 0x5A, 0x20, 0xA7, 0x01, 0xF2, 0x2A, 0x20, 0x9F, 0x73, 0x87, 0x44, 0x19, 0x96,
+    0x39, 0xA2, 0xB7, 0x66, 0xDB, 0xFF, 0x96, 0x71, 0x51, 0xCF, 0x23, 0xA5, 0x21, 0x56, 0xAD, 0x73,
+    0x75, 0x70, 0x90, 0x28, 0x4E, 0x0B, 0xF0, 0xD7, 0x20, 0xB8, 0xBB, 0x8F, 0x45, 0x2D, 0xE5, 0x8D,
+    0x3F, 0x73, 0xF1, 0xEA, 0x7B, 0x8B, 0x37, 0x0C, 0x34, 0x64, 0xEA, 0xD7, 0x58, 0x6B, 0x8C, 0x89,
+    0x7C, 0x08, 0x64, 0x64, 0x00, 0x97, 0xA7, 0x73, 0x29, 0x75, 0x6E, 0x1F, 0x93, 0xC5, 0x49, 0xCC,
+    0xA4, 0x09, 0x88, 0x00, 0xA1, 0xDF, 0x4B, 0x88, 0xF9, 0xB3, 0xDA, 0xAF, 0x33, 0xD0, 0xDD, 0x03,
+    0xBD, 0xD4, 0xD8, 0x83, 0xB1, 0x0B, 0xD8, 0x83, 0xDD, 0xFA, 0x89, 0xD3, 0x4C, 0xF6, 0x90, 0x48,
+    0x09, 0x42, 0x16, 0xFE, 0x26, 0x05, 0xFC, 0xEE, 0xE0, 0xAF, 0xD3, 0xFC, 0xEE, 0xF7, 0x94, 0x38,
+    0x07, 0x0C, 0x80, 0x6E, 0x6D, 0x89, 0x53, 0x17, 0x4E, 0xBE, 0xD6, 0x05, 0xC6, 0x6F, 0x38, 0x1A,
+    0xED, 0xB7, 0x17, 0x97, 0xF2, 0xC0, 0x7C, 0x3E, 0x06, 0xC1, 0x1E, 0x69, 0x93, 0x66, 0x0D, 0xAA,
+    0x52, 0x95, 0xD3, 0x67, 0x22, 0x54, 0x10, 0xFB, 0x3D, 0x2E, 0x13, 0x95, 0xAB, 0x3A, 0xC6, 0xF7,
+    0x70, 0xB2, 0x65, 0x90, 0xEC, 0x8C, 0x1D, 0xE7, 0x5E, 0x03, 0x99, 0x56, 0x96, 0x1E, 0xD7, 0x3B,
+    0xD2, 0x6E, 0x40, 0xFB, 0x58, 0xC0, 0x69, 0x12, 0x63, 0x31, 0xA1, 0x38, 0x75, 0x8A, 0xBE, 0x05,
+    0xF8, 0x24, 0xF0, 0x39, 0x12, 0x17, 0x63, 0xFD, 0x56, 0xE9, 0x65, 0x6B, 0xEB, 0xFF, 0xAC, 0xC9,
+    0x77, 0x65, 0x4C, 0x30, 0x41, 0x6B, 0x09, 0x9D, 0xF5, 0x00, 0xF0, 0xB2, 0x45, 0x3E, 0x96, 0xCB,
+    0x74, 0x5A, 0xFE, 0x14, 0x0C, 0xD0, 0x5B, 0x35, 0xAA, 0x31, 0x1A, 0x7E, 0xEE, 0xBA, 0x92, 0x90,
+    0x0B, 0x95, 0xFB, 0x10, 0x42, 0x28, 0xEF, 0x8D, 0x1A, 0xAA, 0x33, 0xDD, 0x87, 0xD6, 0xB1, 0xD1,
+    0x48, 0x60, 0xEE, 0x88, 0xC2, 0xB1, 0x7A, 0xB8, 0xB1, 0x04, 0x39, 0xE5, 0x74, 0x1F, 0x16, 0x66,
+    0xEE, 0xF1, 0xDA, 0x12, 0x6B, 0x10, 0x7B, 0x20, 0x36, 0x2B, 0x80, 0x40, 0xCC, 0xB3, 0x38, 0xC7,
+    0x44, 0xFF, 0x25, 0xD9, 0x2F, 0x69, 0x4A, 0x7F, 0xA2, 0x46, 0x28, 0xF7, 0xD8, 0x81, 0xDD, 0x84,
+    0x14, 0x73, 0x81, 0xD0, 0x83, 0x01, 0x3D, 0xE5, 0x5E, 0xC0, 0x2B, 0x20, 0x11, 0x68, 0x76, 0x29,
+    0xEE, 0xB7, 0x07, 0x25, 0x39, 0x54, 0x09, 0x54, 0xA8, 0x10, 0x39, 0xE0, 0x43, 0x11, 0x79, 0x4F,
+    0x29, 0x04, 0xA3, 0xA7, 0x58, 0x1F, 0x09, 0x2C, 0xAC, 0x8A, 0x66, 0x77, 0x21, 0x71, 0x87, 0x56,
+    0xD2, 0x9F, 0x02, 0xA3, 0x8C, 0xD7, 0xC4, 0x7A, 0x99, 0x10, 0x22, 0xD9, 0x66, 0xC4, 0x19, 0xF0,
+    0xAD, 0x00, 0xCC, 0x27, 0x28, 0xD8, 0x86, 0x6F, 0xA0, 0xA5, 0xEB, 0x98, 0xDA, 0x31, 0xD7, 0x55,
+    0xFD, 0x54, 0x48, 0x3A, 0xB1, 0xF4, 0xFE, 0x2E, 0x28, 0xCB, 0x68, 0xE8, 0xE2, 0xE7, 0x32, 0x7A,
+    0xBD, 0x31, 0x18, 0x63, 0xB2, 0x67, 0xA2, 0xF8, 0x04, 0x99, 0x11, 0xC6, 0x73, 0x5D, 0x8A, 0xCB,
+    0x5E, 0x26, 0xEF, 0x40, 0xF3, 0xE0, 0x0F, 0x82, 0xE6, 0x6C, 0x6F, 0x71, 0x9E, 0x23, 0x33, 0x59,
+    0x25, 0x60, 0xA4, 0x83, 0x1E, 0x20, 0xFB, 0x90, 0x61, 0x22, 0xE4, 0xF0, 0x90, 0xC3, 0x43, 0x31,
+    0x06, 0x02, 0x11, 0x9C, 0xA0, 0xE6, 0xB9, 0x57, 0xF3, 0xD5, 0xF4, 0x33, 0x23, 0xB2, 0x91, 0x4A,
+    0x34, 0xDB, 0xED, 0x46, 0xCA, 0x31, 0x8D, 0x94, 0x0C, 0x11, 0xA2, 0xD9, 0x8C, 0xB4, 0xCF, 0x04,
+    0x7A, 0x2C, 0x21, 0x9A, 0xDD, 0x38, 0xB7, 0x0F, 0xC7, 0xAF, 0x68, 0x5D, 0x86, 0x66, 0xB4, 0x4E,
+    0xF7, 0x9C, 0x3E, 0xEB, 0x30, 0x5E, 0x36, 0xB4, 0xC6, 0x48, 0xDA, 0x88, 0xDE, 0xBF, 0x06, 0x4F,
+    0xA3, 0x11, 0x35, 0x27, 0x61, 0xF0, 0x4C, 0x1D, 0x38, 0xBA, 0x9D, 0x90, 0xF5, 0x71, 0x1B, 0x8B,
+    0x49, 0x20, 0x8C, 0x18, 0x39, 0x10, 0xF4, 0x67, 0xB7, 0x6E, 0x07, 0x04, 0x1D, 0x5C, 0x6D, 0x19,
+    0x04, 0x5B, 0xE8, 0x40, 0xEF, 0xC3, 0x0B, 0xCC, 0xB4, 0xDE, 0x89, 0xA8, 0x5F, 0x84, 0xC0, 0x87,
+    0x1E, 0x11, 0xB8, 0xFE, 0x6D, 0x75, 0xD9, 0x61, 0x06, 0x95, 0xCB, 0x72, 0xE9, 0xD6, 0x2F, 0xFA,
+    0x95, 0xC7, 0xB0, 0x10, 0xD8, 0xFD, 0x2B, 0xDE, 0x01, 0x2D, 0x21, 0x43, 0x8E, 0xEB, 0xE4, 0x9D,
+    0x84, 0x3C, 0x2E, 0x80, 0xEC, 0x9E, 0xA9, 0xA0, 0x01, 0x82, 0x5C, 0x58, 0x03, 0x00, 0x0D, 0x93,
+    0x33, 0x86, 0x14, 0x6E, 0x48, 0xB9, 0x86, 0x87, 0x46, 0x69, 0x8C, 0x9E, 0x0F, 0xE9, 0xAF, 0xB4,
+    0xDE, 0x10, 0x43, 0xD1, 0xF9, 0x58, 0x56, 0xC3, 0x7C, 0x66, 0x15, 0x8F, 0xA4, 0x1C, 0xDA, 0x2D,
+    0xC8, 0x00, 0xED, 0xBD, 0x50, 0xBF, 0x97, 0x85, 0xC9, 0xCE, 0x72, 0x03, 0x8C, 0x1C, 0x4D, 0xCC,
+    0x88, 0xD7, 0xC4, 0x30, 0x83, 0xB8, 0x89, 0xB0, 0xA2, 0xAC, 0x09, 0xE1, 0x9B, 0x4F, 0x9A, 0x4D,
+    0x84, 0x8F, 0xEF, 0x9A, 0x4D, 0x84, 0xCC, 0xAF, 0x9B, 0x4D, 0xAC, 0xE6, 0xAB, 0x26, 0x0C, 0xC4,
+    0xFD, 0xA2, 0x09, 0x7D, 0x51, 0x9F, 0x36, 0x21, 0xC2, 0xB2, 0xD3, 0x84, 0x28, 0x3F, 0x80, 0x9D,
+    0x3A, 0x24, 0x6E, 0x52, 0x60, 0xAB, 0xBD, 0x0F, 0x2C, 0x5D, 0x47, 0xBC, 0x68, 0x89, 0xB3, 0x86,
+    0x38, 0xAE, 0x88, 0x83, 0x9C, 0x58, 0x21, 0xD6, 0x83, 0x5B, 0xA7, 0xC6, 0x12, 0x80, 0x6A, 0xA2,
+    0x16, 0x28, 0xEC, 0x81, 0x36, 0x17, 0x44, 0x31, 0x91, 0x9F, 0x03, 0x21, 0x25, 0x80, 0x3E, 0xCA,
+    0xA3, 0xD0, 0xEA, 0x81, 0x64, 0x20, 0x8A, 0x89, 0x82, 0x0F, 0x81, 0xD4, 0x17, 0x40, 0xEE, 0x77,
+    0x40, 0xF6, 0x13, 0xBA, 0xAD, 0x26, 0xCA, 0x88, 0x02, 0x22, 0x13, 0x63, 0x4C, 0x0C, 0x06, 0x57,
+    0x30, 0xD0, 0x04, 0xA6, 0xBA, 0x5B, 0x43, 0xF4, 0x6E, 0x0B, 0xC5, 0x58, 0x3D, 0x83, 0xC9, 0xC0,
+    0x74, 0x35, 0xA7, 0x8A, 0x22, 0xE3, 0x57, 0x67, 0x21, 0xF3, 0x95, 0xFD, 0xF6, 0x98, 0xFE, 0x0A,
+    0x8E, 0x1D, 0x40, 0xC5, 0x81, 0xE9, 0x63, 0x22, 0x66, 0xCB, 0x04, 0x73, 0xD0, 0xA3, 0x36, 0xA8,
+    0xE4, 0xDB, 0xA3, 0x67, 0x7E, 0x5C, 0x56, 0xD4, 0x66, 0x68, 0xF2, 0x97, 0xBD, 0x06, 0x7C, 0xF7,
+    0xEA, 0x08, 0xC5, 0x0A, 0x22, 0x29, 0xFA, 0xEE, 0x5F, 0xD2, 0x83, 0x7F, 0x3A, 0x36, 0x7E, 0x41,
+    0x24, 0x4B, 0x13, 0x75, 0x4D, 0xC0, 0x65, 0xA0, 0x70, 0x11, 0xD4, 0xEF, 0xBC, 0x88, 0xB5, 0x86,
+    0x56, 0x3C, 0x06, 0xA7, 0x0E, 0xFD, 0x3A, 0xE3, 0x0C, 0xA1, 0x29, 0x77, 0x83, 0x24, 0x34, 0x5E,
+    0xEB, 0x4E, 0xE3, 0x64, 0x30, 0x1E, 0xC4, 0xDC, 0x56, 0x2E, 0x19, 0x3A, 0x2A, 0xBF, 0xDE, 0xCE,
+    0xE3, 0x55, 0xE9, 0xB2, 0x0A, 0x74, 0x09, 0x0D, 0x15, 0xB3, 0xD3, 0x77, 0x4A, 0x16, 0x8A, 0x7A,
+    0xAA, 0xD8, 0x4C, 0xA9, 0xD4, 0x9C, 0x82, 0x57, 0xFF, 0x5D, 0x76, 0xA7, 0x1A, 0x6F, 0x2C, 0x91,
+    0xF0, 0xAC, 0x09, 0xB3, 0xED, 0x47, 0x33, 0x61, 0x86, 0x7C, 0x0D, 0x70, 0x9F, 0x19, 0xA2, 0x60,
+    0x86, 0x88, 0x58, 0xEE, 0xC4, 0x2C, 0x89, 0x20, 0xCE, 0x98, 0xA5, 0x4F, 0xC4, 0x1A, 0x28, 0x65,
+    0x71, 0x3A, 0x70, 0x45, 0x3D, 0x83, 0x63, 0x2B, 0xAC, 0xEF, 0x91, 0x41, 0x39, 0xBE, 0x60, 0xAE,
+    0x0E, 0x59, 0x24, 0xC5, 0x54, 0x41, 0x40, 0x65, 0xA8, 0x3D, 0x22, 0xCA, 0xC1, 0x35, 0x29, 0x9E,
+    0xA2, 0x67, 0x55, 0x92, 0x9A, 0xEA, 0xA9, 0x9F, 0x33, 0xF3, 0x5B, 0xAC, 0x7A, 0x96, 0x68, 0x86,
+    0x67, 0xE8, 0xB1, 0x66, 0x7A, 0x38, 0x96, 0xF2, 0x5F, 0xA2, 0x9A, 0xC7, 0x4E, 0xE0, 0x8F, 0xD8,
+    0x0C, 0x60, 0x77, 0xF2, 0x11, 0xAA, 0x0F, 0xB7, 0xF2, 0x1D, 0x34, 0x39, 0x35, 0xBC, 0x93, 0x75,
+    0x55, 0x64, 0x9B, 0x32, 0x2F, 0xE4, 0x0E, 0x80, 0x55, 0x10, 0xD3, 0x79, 0x87, 0xED, 0x08, 0xE8,
+    0xF7, 0x9D, 0xA4, 0x60, 0x65, 0xD1, 0x0A, 0x9C, 0x4F, 0xF6, 0x5A, 0x89, 0x3A, 0x46, 0x02, 0xF1,
+    0x31, 0x3D, 0x42, 0x83, 0x6A, 0x4D, 0x7D, 0x4C, 0xE5, 0xC3, 0xC4, 0x50, 0x56, 0x47, 0xAC, 0x2E,
+    0x91, 0x2A, 0x22, 0x26, 0x8D, 0x01, 0x8A, 0xB4, 0x18, 0xFF, 0x29, 0xFB, 0x81, 0x8C, 0xCD, 0x0D,
+    0x4F, 0x54, 0x9A, 0x1A, 0x8C, 0xBD, 0x90, 0x9D, 0x6E, 0xF5, 0xEA, 0xEF, 0xAD, 0xCC, 0xCF, 0x58,
+    0x5E, 0x07, 0x29, 0x39, 0x0D, 0x18, 0xC5, 0xC8, 0x9E, 0xC1, 0x75, 0xC1, 0x18, 0x18, 0x73, 0x77,
+    0xE0, 0xE7, 0x44, 0x08, 0x7C, 0x66, 0x43, 0x85, 0x16, 0x08, 0x0C, 0xC5, 0x52, 0x85, 0xCE, 0x0E,
+    0xC2, 0x09, 0xA6, 0xE4, 0x6C, 0x3D, 0xC5, 0x58, 0x98, 0x62, 0x93, 0x95, 0xA6, 0xCF, 0x39, 0x54,
+    0xB7, 0x2A, 0x0C, 0xB8, 0xA8, 0x4B, 0x20, 0x66, 0x2D, 0x58, 0x48, 0x37, 0x16, 0xBA, 0xDC, 0x39,
+    0xD0, 0x99, 0x68, 0x83, 0x8B, 0xB1, 0xEE, 0x72, 0xA6, 0x66, 0x75, 0x71, 0xF3, 0xB4, 0x6B, 0xE9,
+    0x09, 0x72, 0xF7, 0x08, 0x46, 0x0A, 0x8B, 0xDE, 0xCF, 0x92, 0x31, 0xBD, 0x4E, 0xBB, 0x20, 0x6B,
+    0xBB, 0xB2, 0x69, 0xE5, 0x4F, 0xB7, 0x2B, 0x16, 0xA8, 0x85, 0x01, 0x05, 0xF0, 0xAB, 0x3D, 0x58,
+    0x74, 0xAC, 0x9F, 0x54, 0x9E, 0xFE, 0xB4, 0x92, 0x37, 0x47, 0x77, 0x2F, 0xCE, 0x83, 0xE0, 0x48,
+    0x0A, 0x58, 0x79, 0x79, 0x04, 0x6B, 0xC7, 0x2A, 0x0E, 0xB1, 0x9A, 0xC5, 0x69, 0xA1, 0xDB, 0x9D,
+    0x82, 0x8D, 0x76, 0xA7, 0x2D, 0xA1, 0xA8, 0xB2, 0xF2, 0xAB, 0x7F, 0xC0, 0xBF, 0xEF, 0x65, 0xC3,
+    0x58, 0x30, 0x07, 0x4F, 0x59, 0x1B, 0x8A, 0xF7, 0xF8, 0xF7, 0x27, 0x1C, 0x47, 0x53, 0xCD, 0xBE,
+    0x0E, 0xD1, 0x54, 0x16, 0xB0, 0x3E, 0x50, 0xF5, 0x55, 0x16, 0xEF, 0xB2, 0xDA, 0x24, 0x4C, 0x57,
+    0x77, 0x26, 0xEC, 0xD6, 0x9D, 0xA3, 0x87, 0x4E, 0x1D, 0xED, 0x76, 0x7E, 0x8E, 0xC8, 0x81, 0x3D,
+    0x1E, 0xCC, 0xCF, 0x14, 0xF0, 0xEB, 0x40, 0x5B, 0x8C, 0xD1, 0x0E, 0x83, 0xEE, 0x54, 0xAD, 0x3A,
+    0x14, 0xF0, 0x9D, 0xA5, 0xBB, 0x7B, 0xAC, 0x21, 0x64, 0xF7, 0x88, 0x45, 0x8B, 0x78, 0x47, 0xBB,
+    0xB9, 0x8F, 0x9D, 0x74, 0x6C, 0x36, 0xBB, 0xD8, 0xC4, 0xCC, 0x3E, 0x69, 0xA9, 0xB7, 0xEC, 0xE0,
+    0xE0, 0xF6, 0x7C, 0x55, 0x66, 0xAD, 0xD6, 0xD8, 0x58, 0x39, 0xCA, 0x5D, 0x06, 0xB3, 0xDC, 0xAC,
+    0x11, 0x10, 0x0C, 0xD8, 0x46, 0x5B, 0x74, 0x46, 0xAA, 0x0D, 0xB7, 0xF7, 0xBF, 0xFD, 0x52, 0x37,
+    0x6F, 0x3F, 0x4E, 0x9C, 0x55, 0xCB, 0xC5, 0x37, 0x98, 0xD9, 0x31, 0xCC, 0x3C, 0xBA, 0x24, 0x33,
+    0x09, 0x99, 0xF1, 0x56, 0xCC, 0x74, 0x60, 0x66, 0x12, 0x8C, 0x65, 0xB6, 0xA3, 0x3F, 0xDF, 0xF2,
+    0x6B, 0xEE, 0x0A, 0xAF, 0x9A, 0x58, 0x7B, 0x81, 0xA2, 0xAF, 0xF5, 0x54, 0x74, 0x52, 0x3E, 0x82,
+    0xA2, 0x13, 0xA3, 0xE8, 0x06, 0x0A, 0x6D, 0x8A, 0x4B, 0xC2, 0x46, 0x51, 0x60, 0x0B, 0x72, 0xB3,
+    0x78, 0xFE, 0x42, 0x60, 0xE4, 0x79, 0x85, 0xD9, 0x9C, 0xC8, 0x4D, 0xF3, 0xFC, 0xC2, 0x9F, 0xD5,
+    0x97, 0x6D, 0x96, 0x5F, 0xB8, 0x56, 0x54, 0x44, 0x85, 0x71, 0xDF, 0x41, 0x0A, 0xC8, 0x8C, 0x3E,
+    0x5E, 0x40, 0x2B, 0x05, 0xEC, 0xED, 0x10, 0x80, 0x08, 0x2F, 0x25, 0x34, 0x64, 0xDA, 0xF9, 0xDD,
+    0xE2, 0x89, 0xC8, 0x42, 0xC6, 0x31, 0x6C, 0x3C, 0xF3, 0xDA, 0x09, 0x8E, 0x90, 0xEC, 0x0A, 0xBD,
+    0xF4, 0x75, 0x53, 0x3E, 0xCA, 0x16, 0x9F, 0x74, 0x25, 0xC3, 0x52, 0x7F, 0x48, 0xEF, 0x1B, 0x16,
+    0xF4, 0xAA, 0xA2, 0x78, 0x05, 0xBC, 0xE3, 0x4F, 0x22, 0x3E, 0xF5, 0xA5, 0x97, 0x12, 0xB1, 0x04,
+    0x1D, 0xFD, 0x28, 0xF1, 0x1E, 0xEF, 0xD6, 0x28, 0x58, 0xDA, 0xD8, 0x84, 0x6A, 0x19, 0x60, 0x0E,
+    0xC5, 0x3A, 0xB0, 0x0D, 0xD2, 0xE8, 0xFD, 0x84, 0x95, 0xB3, 0xD7, 0xC0, 0x46, 0xF3, 0x95, 0x1F,
+    0xED, 0xF8, 0xE7, 0xFA, 0x73, 0x77, 0x91, 0x3F, 0x1F, 0x62, 0xDE, 0x02, 0xFE, 0x5C, 0x80, 0xC6,
+    0x79, 0x6A, 0x39, 0x31, 0xDD, 0xA3, 0x97, 0x31, 0x5D, 0x75, 0x86, 0xE9, 0xFE, 0x10, 0x76, 0xAE,
+    0xD5, 0xF7, 0xCB, 0xFA, 0xF0, 0x69, 0x52, 0x82, 0x15, 0x13, 0x19, 0x8B, 0x0B, 0x6F, 0x5B, 0xDF,
+    0xF6, 0xF5, 0x10, 0x5F, 0x67, 0xE6, 0x49, 0x59, 0xD7, 0xA2, 0xF4, 0x14, 0x0F, 0x9B, 0x92, 0xB2,
+    0x35, 0xA9, 0x6F, 0x61, 0xC2, 0x4D, 0xB4, 0x23, 0x0B, 0x6C, 0x98, 0x03, 0xF8, 0xF0, 0x96, 0xA9,
+    0x0D, 0x58, 0x20, 0xF2, 0xF6, 0xBF, 0x85, 0xD7, 0xB6, 0xD7, 0x1E, 0x6D, 0x21, 0x71, 0x9C, 0x77,
+    0xB3, 0x67, 0x8B, 0x89, 0x5A, 0xD2, 0xB4, 0x60, 0xDD, 0xF6, 0x7E, 0x71, 0x69, 0x6D, 0xBA, 0xD0,
+    0xBC, 0x6A, 0xE2, 0x24, 0x6E, 0x02, 0xFD, 0xAC, 0x71, 0xF5, 0xBF, 0x1A, 0xD6, 0x10, 0x9F, 0x89,
+    0xDC, 0x29, 0xC6, 0x04, 0xCC, 0xEC, 0xDB, 0xF0, 0xEC, 0x07, 0xF5, 0x2F, 0xB3, 0x2D, 0x52, 0xEF,
+    0xE9, 0x01, 0x9C, 0x40, 0x3F, 0xD2, 0xC3, 0xA1, 0xE7, 0x4C, 0x9E, 0xCC, 0x9C, 0x4C, 0x26, 0x15,
+    0xD6, 0xF0, 0x46, 0x2E, 0x77, 0xE6, 0x78, 0x24, 0x8D, 0xA0, 0x21, 0x95, 0xA8, 0xE5, 0xD1, 0xC7,
+    0x26, 0xCA, 0x5A, 0x3F, 0x29, 0x3A, 0xD2, 0xEB, 0x0B, 0xE6, 0xEF, 0x36, 0x55, 0xB9, 0xFB, 0x79,
+    0x1B, 0xA2, 0x44, 0xFE, 0xAA, 0xF9, 0xC0, 0x17, 0xE7, 0xEB, 0xDA, 0x47, 0xEE, 0x7E, 0x52, 0x29,
+    0xE8, 0xEC, 0x59, 0xAE, 0x30, 0x03, 0x4C, 0x0D, 0xA2, 0xD2, 0xA6, 0x4C, 0x38, 0x64, 0x76, 0x7D,
+    0x5F, 0xAC, 0xDB, 0x48, 0xF3, 0x2D, 0xC7, 0xF3, 0x20, 0xC5, 0xEA, 0xA3, 0xD1, 0xEB, 0xE2, 0x6E,
+    0xAC, 0xDB, 0x08, 0x7C, 0x46, 0x1B, 0xBF, 0xB1, 0x0F, 0xFB, 0x72, 0x0C, 0xA8, 0xF6, 0xEB, 0xFC,
+    0x91, 0x1B, 0x7F, 0x2C, 0x28, 0xC8, 0x1F, 0x6A, 0x08, 0xDF, 0x70, 0xCD, 0xC3, 0x45, 0xE9, 0xA1,
+    0xB3, 0x82, 0x1B, 0x16, 0xD0, 0x0A, 0xDA, 0xB1, 0x28, 0x53, 0xD3, 0xA9, 0x09, 0x8F, 0x00, 0xA7,
+    0x33, 0x27, 0x9E, 0x53, 0x40, 0xF8, 0xC2, 0xC3, 0xAC, 0xF7, 0x0F, 0x3E, 0xCB, 0xF4, 0xF1, 0x5B,
+    0x33, 0xCE, 0x6C, 0x02, 0x6F, 0xC5, 0x44, 0x4F, 0x5F, 0xE0, 0xE9, 0x04, 0xBC, 0x07, 0x63, 0x03,
+    0x93, 0x68, 0xB4, 0x5E, 0xF2, 0x90, 0x82, 0xDB, 0x77, 0x1A, 0x06, 0x2B, 0x1F, 0xD6, 0x40, 0x3C,
+    0x61, 0xB1, 0xA6, 0x3C, 0xF3, 0x1A, 0x3C, 0x0D, 0xD9, 0x39, 0x21, 0xCC, 0xB0, 0x11, 0xD2, 0xE6,
+    0x1A, 0xA6, 0xBF, 0x99, 0xB9, 0x6E, 0xA8, 0x7C, 0x75, 0xFC, 0xBA, 0x29, 0xB7, 0x90, 0x87, 0xDD,
+    0xBC, 0xF5, 0xAE, 0xB7, 0xD8, 0xEC, 0x04, 0xD8, 0xA4, 0xA0, 0xE2, 0x53, 0xD5, 0x42, 0x55, 0x1B,
+    0x57, 0x44, 0xFD, 0xA1, 0xF5, 0x3F, 0x6C, 0x51, 0x60, 0xC5, 0x6E, 0x85, 0x7D, 0xD0, 0xA6, 0x4A,
+    0x6E, 0x29, 0x79, 0xF3, 0x67, 0xB0, 0x97, 0x77, 0x65, 0xEB, 0x50, 0x06, 0x6B, 0x58, 0x5A, 0xC7,
+    0x36, 0xE2, 0x13, 0xF2, 0xCE, 0x06, 0xE8, 0x6C, 0x71, 0x76, 0x18, 0x53, 0x30, 0xD8, 0xBA, 0x42,
+    0x36, 0x52, 0xBA, 0x82, 0x44, 0xCC, 0x3E, 0x9A, 0x02, 0x70, 0x56, 0x18, 0x0B, 0x47, 0x72, 0xCA,
+    0xFE, 0x82, 0xF4, 0xF5, 0x0D, 0xC4, 0xF1, 0xF6, 0xE3, 0xEB, 0xD9, 0x8D, 0xA9, 0xFD, 0x75, 0xE1,
+    0x31, 0xFB, 0x0F, 0x1B, 0x58, 0x05, 0x63, 0xF0, 0x02, 0x2B, 0x78, 0xCF, 0x99, 0x4E, 0x49, 0x31,
+    0xF7, 0x4D, 0x64, 0xC6, 0x14, 0xA9, 0x31, 0xC5, 0xFB, 0x4B, 0xC3, 0x44, 0x3B, 0x05, 0xED, 0x14,
+    0xB4, 0x53, 0x7B, 0xED, 0x1B, 0x68, 0xA7, 0xAF, 0x4A, 0x9B, 0xA7, 0x9E, 0x14, 0xE1, 0xE7, 0x89,
+    0x91, 0xE1, 0x3F, 0x47, 0x21, 0x7A, 0xB5, 0x91, 0xA2, 0x9D, 0x8F, 0x62, 0x5C, 0xF1, 0x69, 0x04,
+    0x79, 0x35, 0x37, 0x92, 0x74, 0x2B, 0x23, 0x4A, 0xB7, 0x32, 0xDF, 0x7E, 0x9C, 0xBF, 0xF5, 0x05,
+    0x3E, 0x18, 0x95, 0xFC, 0x60, 0x5C, 0xA0, 0x5B, 0x99, 0x05, 0x9A, 0x9E, 0xC1, 0xE9, 0x00, 0xB3,
+    0x40, 0xB7, 0xFA, 0xC9, 0x16, 0xF8, 0x7F, 0xAD, 0x54, 0x3D, 0x8C, 0xDC, 0x44, 0x14, 0xFE, 0x6C,
+    0x2B, 0xB1, 0xC4, 0x14, 0x43, 0x73, 0x52, 0x44, 0x44, 0x4C, 0x71, 0x55, 0x94, 0x5B, 0xD7, 0x48,
+    0xF6, 0xDA, 0x81, 0x22, 0x65, 0xB6, 0xB8, 0x6B, 0xA0, 0x38, 0xEA, 0x50, 0xA4, 0x3D, 0xD0, 0xDE,
+    0xED, 0x88, 0x86, 0xF6, 0x0A, 0xD2, 0xA7, 0xA0, 0x88, 0xAE, 0x49, 0x0A, 0x8A, 0x45, 0xDC, 0xE1,
+    0x01, 0x0A, 0x5A, 0x53, 0xD3, 0x58, 0x22, 0xA2, 0xBD, 0x41, 0x32, 0x92, 0x85, 0x76, 0x77, 0xF8,
+    0xDE, 0x38, 0x7B, 0x44, 0x24, 0x42, 0x29, 0xB0, 0x67, 0x9E, 0xC6, 0xF3, 0xDE, 0xBC, 0x9F, 0xEF,
+    0x7D, 0xE3, 0xA9, 0xB2, 0x53, 0x65, 0x4B, 0x19, 0xA6, 0x4C, 0xCD, 0x5E, 0x6A, 0xEE, 0xA4, 0xE6,
+    0x46, 0x5C, 0x23, 0xB6, 0xEF, 0x02, 0x89, 0xDD, 0x13, 0x51, 0x00, 0xA9, 0xA1, 0x50, 0xE6, 0x08,
+    0xD0, 0xF5, 0x11, 0xDE, 0x7A, 0x7A, 0xB6, 0x79, 0xAC, 0xBD, 0xF7, 0xEE, 0xDA, 0xC3, 0x83, 0x3F,
+    0x67, 0x98, 0x44, 0x0E, 0xD8, 0x8B, 0x3A, 0xA0, 0x88, 0x5B, 0x8A, 0xC4, 0x62, 0x41, 0xAD, 0xAD,
+    0x44, 0xE0, 0x9B, 0xD4, 0x00, 0x4E, 0xD5, 0x14, 0x1A, 0xA3, 0x88, 0xBA, 0x0C, 0x88, 0xDB, 0x5B,
+    0x18, 0x1F, 0xD1, 0xC9, 0x3C, 0xFC, 0x1A, 0x29, 0x4F, 0x64, 0xBE, 0xB1, 0x95, 0xBA, 0x5B, 0x97,
+    0xDC, 0x93, 0x59, 0x71, 0xE6, 0xBF, 0xD6, 0x50, 0xDE, 0x20, 0xF2, 0x6B, 0xE6, 0xC0, 0x85, 0x3A,
+    0xEC, 0xA0, 0x3E, 0x74, 0x50, 0x77, 0x39, 0x3F, 0x70, 0xBB, 0xEA, 0x5E, 0x57, 0x5D, 0x4A, 0xC8,
+    0x0D, 0xA2, 0x87, 0xA7, 0xFF, 0xF8, 0xBC, 0x8E, 0x6D, 0x90, 0x81, 0x61, 0x91, 0x35, 0x48, 0x5A,
+    0x94, 0xBA, 0x56, 0x06, 0xF3, 0xD4, 0x30, 0x97, 0xA3, 0xC4, 0x4E, 0x80, 0x65, 0x28, 0x93, 0x72,
+    0x29, 0xF2, 0x07, 0x27, 0xFB, 0x3F, 0xFD, 0xB2, 0x44, 0x91, 0x7E, 0xF9, 0xB3, 0xAF, 0x4B, 0x7D,
+    0xFF, 0xFE, 0x3D, 0xE6, 0x35, 0xB9, 0x95, 0xB4, 0xE9, 0x50, 0x84, 0x52, 0x97, 0xA5, 0x54, 0xED,
+    0x44, 0xC6, 0x9D, 0xC8, 0xD4, 0xCA, 0xBE, 0xAE, 0x27, 0x31, 0xC3, 0x40, 0x13, 0x84, 0x12, 0xFA,
+    0xD2, 0x62, 0x89, 0xC4, 0x87, 0x0C, 0xDE, 0xDE, 0xA6, 0xB2, 0x18, 0x28, 0x22, 0x2F, 0xBB, 0x89,
+    0xCB, 0x89, 0x4E, 0x6A, 0xB5, 0x15, 0xA9, 0xEC, 0x76, 0x9D, 0x74, 0x19, 0x93, 0x8F, 0xFA, 0xEF,
+    0xC5, 0xBE, 0x19, 0xC2, 0x29, 0x42, 0x8B, 0xD8, 0xB7, 0xD8, 0x87, 0xFE, 0x6D, 0xC0, 0x0A, 0xB9,
+    0xD9, 0xA0, 0x47, 0x85, 0xEA, 0x0B, 0x87, 0x63, 0xEE, 0x75, 0x98, 0x33, 0x94, 0xE5, 0x1A, 0x9E,
+    0xA8, 0x51, 0x1A, 0xE4, 0xED, 0x4D, 0xCF, 0xA4, 0xBC, 0xFF, 0x71, 0xE0, 0xD9, 0x35, 0xE8, 0xEF,
+    0x9A, 0x38, 0x9B, 0x4E, 0xCB, 0xB2, 0xDC, 0xBB, 0x73, 0x23, 0xE4, 0x23, 0xA1, 0xD8, 0x10, 0xE8,
+    0x71, 0x7E, 0xA6, 0xAF, 0x77, 0xCD, 0xA5, 0xEF, 0x3E, 0xF5, 0x9B, 0x53, 0x54, 0x4C, 0xE6, 0xBB,
+    0x0E, 0xD1, 0x1F, 0x3D, 0x73, 0x5D, 0x41, 0xB5, 0x27, 0x88, 0xCC, 0xEE, 0xE8, 0x65, 0x8B, 0xF1,
+    0x4B, 0x73, 0xE7, 0xF0, 0xD1, 0xAC, 0x21, 0x31, 0xD8, 0x7F, 0xF7, 0x3A, 0x7D, 0x98, 0xCC, 0x9A,
+    0x78, 0x25, 0x9D, 0xB4, 0x82, 0x25, 0x6B, 0x23, 0xD1, 0x73, 0x10, 0x2F, 0x56, 0x80, 0x41, 0xF4,
+    0x71, 0xD0, 0xA7, 0x36, 0xE8, 0x6B, 0xD1, 0x4F, 0x83, 0xFE, 0x7C, 0x8B, 0xA4, 0x80, 0x9F, 0x39,
+    0xA2, 0x48, 0x25, 0xDD, 0x6D, 0xF8, 0xC5, 0xA6, 0x08, 0x5C, 0x0B, 0x76, 0x3F, 0x5D, 0xCB, 0xA2,
+    0x13, 0xBC, 0x18, 0x2F, 0x77, 0xA3, 0xFD, 0xD8, 0x81, 0xC5, 0x36, 0xBD, 0x97, 0x9E, 0x9D, 0x83,
+    0x83, 0x99, 0xEC, 0xDD, 0x3E, 0x3B, 0x7B, 0x2C, 0x09, 0x2E, 0xC5, 0xCE, 0x04, 0xD2, 0x8C, 0x8B,
+    0xF4, 0x6A, 0x31, 0xC6, 0x15, 0xBF, 0xF4, 0xAF, 0x36, 0x63, 0x5F, 0xBE, 0xA5, 0xB6, 0x0E, 0x9E,
+    0xDE, 0xF9, 0xAB, 0x96, 0xA8, 0x9E, 0xF6, 0xF9, 0xF3, 0xA8, 0x01, 0x2E, 0x88, 0xA9, 0x65, 0x39,
+    0x2C, 0x89, 0xE5, 0xB0, 0x36, 0x5D, 0x67, 0xDE, 0xCC, 0x33, 0x34, 0x4F, 0x2D, 0x99, 0xD4, 0xF3,
+    0x92, 0x15, 0x49, 0x1B, 0xA4, 0x25, 0x15, 0xE7, 0xA9, 0x25, 0x91, 0xAE, 0xA4, 0xB2, 0x05, 0xF7,
+    0xB5, 0x9D, 0x17, 0x89, 0x9B, 0xB4, 0x7D, 0x09, 0xDF, 0xFB, 0x2E, 0x67, 0xEB, 0x27, 0xB5, 0x0E,
+    0x01, 0x53, 0x61, 0x05, 0xE2, 0x21, 0x14, 0xD7, 0x3C, 0xFA, 0x98, 0x81, 0x94, 0x67, 0xCB, 0x81,
+    0x8F, 0xBE, 0x0A, 0x70, 0x6A, 0x73, 0xFC, 0xBF, 0x88, 0x52, 0xEE, 0x7E, 0x25, 0x7D, 0x22, 0x63,
+    0x2B, 0xE8, 0xE7, 0xF1, 0x8A, 0x6C, 0xF3, 0xBD, 0x00, 0x4A, 0x5C, 0x30, 0x13, 0x9E, 0x36, 0xAB,
+    0x8B, 0xD9, 0x39, 0xDE, 0xEC, 0xBD, 0xD8, 0x6F, 0x56, 0x0F, 0x9E, 0xCC, 0x43, 0x5B, 0xA7, 0x81,
+    0x80, 0xAC, 0x88, 0xED, 0x26, 0x4A, 0x6C, 0xBD, 0x20, 0xD6, 0x07, 0x32, 0x8C, 0x16, 0xD5, 0x68,
+    0x61, 0x82, 0x45, 0x7B, 0x65, 0x51, 0xAD, 0x16, 0xEB, 0x9D, 0x63, 0xBC, 0xE1, 0xBB, 0x73, 0xB1,
+    0x58, 0xDF, 0x7E, 0x12, 0x78, 0x9E, 0x31, 0x67, 0xE1, 0xF6, 0xE7, 0x84, 0xAA, 0x27, 0x8F, 0xDC,
+    0x92, 0x3F, 0xA4, 0x02, 0xF2, 0x33, 0x50, 0xB5, 0xA6, 0x89, 0x32, 0x93, 0xF0, 0xEF, 0x8B, 0x3B,
+    0x92, 0xC1, 0x6D, 0x49, 0x52, 0xBD, 0x20, 0xC9, 0x3E, 0x4E, 0x90, 0xD7, 0xCA, 0xF2, 0xAE, 0xCF,
+    0x10, 0x3D, 0x13, 0x4A, 0x54, 0xA7, 0x72, 0xF3, 0xCE, 0x5F, 0x19, 0x83, 0x70, 0xA6, 0x22, 0x66,
+    0x2D, 0x62, 0x56, 0xB4, 0x7A, 0x9D, 0x0D, 0x0F, 0x56, 0xBC, 0xA6, 0x0C, 0xF3, 0x09, 0x8A, 0xFF,
+    0x7A, 0xF0, 0x3E, 0xC4, 0xD1, 0x4D, 0x17, 0xA0, 0x79, 0x75, 0xD0, 0x57, 0x45, 0x14, 0x7B, 0xB9,
+    0x14, 0x27, 0x2F, 0xC2, 0xFF, 0x6B, 0x44, 0xBD, 0x5C, 0x08, 0xD6, 0xBE, 0x3B, 0x72, 0x3F, 0x5B,
+    0xE3, 0xBD, 0x85, 0xFF, 0xDD, 0x3D, 0x53, 0x42, 0x9B, 0x07, 0xF5, 0xDF, 0xC5, 0x59, 0x31, 0x70,
+    0xDC, 0xC6, 0x15, 0xFD, 0x00, 0x44, 0xC2, 0x19, 0x4C, 0xB4, 0x2C, 0xA8, 0x89, 0x12, 0xC5, 0x42,
+    0x0A, 0x15, 0x9E, 0x8C, 0x4C, 0x34, 0x29, 0x54, 0xDC, 0x1D, 0x60, 0xBB, 0x48, 0x91, 0xC2, 0x2C,
+    0xC4, 0x64, 0x26, 0x2E, 0xE4, 0xC2, 0x85, 0xC7, 0x9E, 0x84, 0x29, 0x54, 0xA8, 0xB8, 0xE3, 0xC1,
+    0x93, 0x32, 0x45, 0xD8, 0xB8, 0x4D, 0x94, 0x19, 0x17, 0x89, 0x5C, 0xD0, 0x85, 0x0A, 0x26, 0x01,
+    0x89, 0x9D, 0xA4, 0x70, 0x19, 0x38, 0x33, 0xEA, 0x91, 0x84, 0x9E, 0xCC, 0xA8, 0x88, 0x91, 0xC9,
+    0x69, 0x0C, 0xCA, 0xC7, 0xDB, 0xBC, 0xB7, 0xC0, 0xDD, 0x51, 0x14, 0x6D, 0xCB, 0xC9, 0x89, 0xC2,
+    0x61, 0x3F, 0x48, 0x60, 0xF1, 0xF7, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x7F, 0xD1, 0x9F, 0x4C, 0x06,
+    0x22, 0x57, 0x3A, 0x3C, 0xFA, 0x3C, 0xF6, 0x70, 0xAC, 0x0A, 0x8F, 0x20, 0x69, 0x5A, 0x78, 0x20,
+    0xAE, 0x31, 0x12, 0x1C, 0xFE, 0x54, 0x42, 0x2D, 0x12, 0xE3, 0x51, 0x0F, 0xAD, 0x8B, 0x36, 0x38,
+    0xD6, 0xBA, 0xED, 0xFD, 0x08, 0x4D, 0x15, 0x8E, 0xF8, 0x78, 0xC7, 0x31, 0x13, 0xFC, 0xB3, 0x3D,
+    0xE7, 0xE5, 0x48, 0x73, 0xF8, 0xA6, 0x90, 0xC8, 0xD4, 0xB2, 0x25, 0x77, 0x65, 0x8C, 0xFF, 0x6B,
+    0xB4, 0xD1, 0xA3, 0xED, 0xC2, 0xE1, 0x86, 0xC4, 0xC6, 0x24, 0xDF, 0x9D, 0xDC, 0x79, 0xEC, 0x99,
+    0x53, 0x89, 0x78, 0x25, 0x44, 0xBB, 0xB7, 0x71, 0x1D, 0x7D, 0x26, 0x6C, 0x17, 0x45, 0xD2, 0xDE,
+    0xE6, 0x3F, 0xCA, 0xD0, 0x18, 0x1D, 0x14, 0x91, 0xA8, 0x24, 0x48, 0x95, 0x78, 0xFA, 0x72, 0xDB,
+    0x94, 0xF8, 0x3A, 0xD0, 0x2A, 0x51, 0x0F, 0xF3, 0x34, 0xCE, 0x3F, 0x2B, 0xAE, 0x2E, 0xBD, 0x54,
+    0x48, 0x23, 0x7B, 0xC4, 0x49, 0xF5, 0x24, 0x4C, 0x24, 0x13, 0xA5, 0x31, 0x80, 0x5F, 0xB8, 0x95,
+    0x78, 0x95, 0x87, 0x0E, 0xA3, 0x00, 0x73, 0xCE, 0x14, 0x64, 0xEF, 0x72, 0x66, 0x51, 0x9F, 0xD3,
+    0xAB, 0x39, 0x03, 0x53, 0x35, 0xC4, 0x4A, 0x62, 0x89, 0xFB, 0xFE, 0xC3, 0xDB, 0x27, 0xEF, 0x1D,
+    0x23, 0x9D, 0xF9, 0xD1, 0xAA, 0xE1, 0x91, 0x3B, 0x4B, 0x64, 0x7A, 0x24, 0xE1, 0xFD, 0x23, 0x88,
+    0x73, 0xCE, 0xEA, 0x93, 0xBA, 0x0E, 0x4B, 0xDE, 0x4F, 0x24, 0x00, 0xDB, 0xC8, 0x1D, 0xE3, 0x7E,
+    0x2C, 0x1D, 0x09, 0x21, 0xAF, 0x92, 0x28, 0x8D, 0xB0, 0x2E, 0x99, 0x48, 0x0E, 0xA5, 0x04, 0x54,
+    0xE4, 0x56, 0xBB, 0x02, 0x91, 0xBC, 0x81, 0xBF, 0x87, 0x66, 0x0C, 0x35, 0xDB, 0x69, 0xCA, 0x8A,
+    0x9D, 0x06, 0xCE, 0x2B, 0xCB, 0xED, 0xE8, 0x58, 0x56, 0xEA, 0x3D, 0xFA, 0x78, 0x27, 0xE5, 0x0A,
+    0xB8, 0x23, 0xE1, 0x84, 0xBB, 0xE4, 0x7B, 0xA0, 0xE4, 0x79, 0xC7, 0x8C, 0xFD, 0xB4, 0xE3, 0x95,
+    0xAB, 0xAE, 0xBE, 0x06, 0x25, 0x38, 0xC5, 0x4D, 0x6A, 0xA1, 0xFC, 0x40, 0xE1, 0x9D, 0xEA, 0x38,
+    0x6D, 0xEE, 0x5F, 0x0B, 0x52, 0xF4, 0xE9, 0xF8, 0x85, 0xB8, 0xFA, 0x45, 0xD7, 0x8C, 0xA9, 0xF1,
+    0xE1, 0x88, 0x5A, 0x27, 0x4F, 0x67, 0x24, 0x0E, 0x06, 0x8B, 0xDF, 0xDD, 0xC4, 0x10, 0xCB, 0x98,
+    0xA6, 0xD8, 0x09, 0x5B, 0x3B, 0x9B, 0xC8, 0xF9, 0x5F, 0xA7, 0x58, 0x21, 0x9C, 0x81, 0xD1, 0x6B,
+    0xAF, 0xE8, 0x8E, 0xA7, 0x3B, 0xBE, 0x8E, 0x72, 0x1D, 0xFC, 0x2D, 0x95, 0x15, 0x74, 0xAB, 0x55,
+    0xE2, 0x55, 0x3D, 0x09, 0xF4, 0x58, 0xC2, 0x97, 0x2B, 0x19, 0x04, 0x05, 0xE6, 0xA2, 0x25, 0x86,
+    0x5A, 0xD5, 0x3B, 0x5C, 0xAE, 0x3D, 0x0C, 0x80, 0x69, 0xDF, 0xA5, 0x24, 0x30, 0x9D, 0x8D, 0x8D,
+    0xF5, 0x1C, 0xCB, 0x30, 0xB4, 0x4B, 0x21, 0xA7, 0xB5, 0x15, 0x33, 0x36, 0xE3, 0x8D, 0xEB, 0x5F,
+    0xA2, 0x08, 0xD7, 0x6C, 0x43, 0x11, 0x9E, 0xA9, 0xA9, 0x88, 0x22, 0x83, 0x22, 0xBC, 0xA2, 0x0B,
+    0x45, 0x80, 0x42, 0x11, 0x5E, 0xD1, 0x87, 0x0A, 0x3C, 0x33, 0xB2, 0xB4, 0x80, 0x22, 0xBC, 0x8F,
+    0x2A, 0x28, 0xC2, 0x2B, 0x6A, 0x28, 0x02, 0x4F, 0xA1, 0x08, 0xAF, 0xE8, 0x41, 0x11, 0x5E, 0xA1,
+    0x5E, 0xFD, 0x72, 0x45, 0xC8, 0xD4, 0x94, 0xE9, 0x20, 0x13, 0x09, 0x77, 0x74, 0xC7, 0x2D, 0x6F,
+    0x49, 0x65, 0xCF, 0xB2, 0x0B, 0x26, 0x26, 0x75, 0x0F, 0x9B, 0xEE, 0x53, 0x87, 0x3A, 0xD6, 0x2E,
+    0xDC, 0x78, 0xD7, 0xCE, 0xFA, 0xAD, 0x9D, 0xFB, 0xB7, 0x4F, 0x7B, 0x2E, 0xED, 0xBA, 0xB3, 0x0F,
+    0xDB, 0x72, 0x8D, 0x01, 0x93, 0x17, 0x02, 0xDD, 0xA8, 0x9E, 0x5D, 0x42, 0x91, 0x3E, 0x9D, 0x0B,
+    0xA2, 0xE2, 0xCF, 0xA1, 0xD1, 0x38, 0x83, 0x43, 0x76, 0xBB, 0xE2, 0xDB, 0x3E, 0xBE, 0x76, 0x36,
+    0x25, 0x80, 0xD0, 0x40, 0x02, 0xE8, 0x88, 0xA7, 0xDE, 0xDF, 0x49, 0x23, 0x3B, 0x0D, 0x67, 0x3D,
+    0x28, 0x55, 0x1A, 0x83, 0xC5, 0xBA, 0xBC, 0x29, 0xEE, 0x76, 0x06, 0xB3, 0x7F, 0xB2, 0xE6, 0x97,
+    0x7B, 0xA2, 0xCA, 0x3C, 0x89, 0xCA, 0xDC, 0x3C, 0x2C, 0xF7, 0xCC, 0x47, 0x65, 0x76, 0x0E, 0xE6,
+    0x2A, 0xA7, 0x37, 0x3B, 0x96, 0x31, 0xE3, 0xC0, 0x1C, 0xF6, 0x43, 0x33, 0xBA, 0x1A, 0xB7, 0x6D,
+    0x78, 0xA2, 0x4D, 0xEF, 0x47, 0x68, 0x0A, 0xCD, 0x45, 0x93, 0x73, 0x37, 0xAF, 0x8A, 0x3C, 0x69,
+    0xFB, 0xCE, 0xC5, 0xD5, 0xFD, 0xC9, 0xDE, 0x6A, 0x00, 0x97, 0x08, 0x4A, 0xD8, 0x4D, 0xF5, 0x76,
+    0x95, 0xA7, 0xCE, 0xED, 0xA0, 0xEA, 0x55, 0x77, 0x2B, 0x79, 0xFC, 0x07, 0x4B, 0x9A, 0x88, 0x7A,
+    0x5F, 0xBF, 0xE8, 0x94, 0x1D, 0xA9, 0x66, 0xE7, 0x9A, 0x5B, 0xAA, 0x4F, 0xB4, 0xF3, 0x7B, 0x59,
+    0x71, 0xE9, 0x84, 0xE9, 0xDC, 0x70, 0xCB, 0x41, 0x63, 0xB8, 0x63, 0x95, 0x7A, 0x55, 0x3C, 0x33,
+    0xF0, 0x1E, 0xBC, 0xE8, 0x56, 0x90, 0x34, 0x53, 0xC5, 0x94, 0xEF, 0x8A, 0x37, 0xE6, 0xBA, 0x00,
+    0x7D, 0xB0, 0x08, 0x57, 0x3B, 0x02, 0x5F, 0xB3, 0x20, 0x40, 0xDA, 0xB5, 0xF4, 0x96, 0xA5, 0x14,
+    0xA1, 0xE3, 0x16, 0xDF, 0x04, 0xF5, 0x35, 0xD0, 0xB8, 0xA3, 0x12, 0x58, 0x53, 0x67, 0xCD, 0xFD,
+    0x97, 0xC8, 0x0B, 0x1D, 0xFF, 0x57, 0x42, 0x1F, 0x59, 0x23, 0x80, 0x5E, 0x05, 0xF5, 0xF4, 0x2D,
+    0xD0, 0x20, 0x7D, 0x98, 0x6F, 0x63, 0x86, 0x06, 0x26, 0xDC, 0xB5, 0xE8, 0x01, 0x8C, 0x5B, 0xB3,
+    0x6E, 0xB2, 0x46, 0xB4, 0x75, 0x0B, 0xF1, 0x6B, 0x9A, 0x44, 0xB4, 0x0B, 0x50, 0x95, 0x6B, 0xB7,
+    0x78, 0x5B, 0x76, 0xA5, 0x63, 0xE9, 0x5D, 0x52, 0xE2, 0xB1, 0xEC, 0x42, 0x34, 0xD0, 0xE0, 0x9D,
+    0xDF, 0x81, 0xAA, 0x10, 0x90, 0xB5, 0xDB, 0x7D, 0x1E, 0xAF, 0xED, 0x5A, 0xA1, 0xDF, 0xA8, 0x48,
+    0xDD, 0x52, 0x1A, 0x43, 0x02, 0x70, 0x80, 0x17, 0x86, 0xBB, 0x6C, 0x01, 0xBD, 0x63, 0x3D, 0xCE,
+    0xF2, 0x07, 0xAF, 0xD8, 0x68, 0xFC, 0x0B, 0xDA, 0x28, 0xE0, 0xD2, 0x11, 0xBB, 0x0D, 0x77, 0x12,
+    0x74, 0x5B, 0xC1, 0xEB, 0x77, 0x29, 0x39, 0x87, 0x0C, 0x52, 0x70, 0x5A, 0xDE, 0xA7, 0x36, 0x00,
+    0x22, 0xC4, 0xA2, 0x40, 0x53, 0x1B, 0x9E, 0xEE, 0x2F, 0x27, 0xE0, 0x58, 0xA9, 0x74, 0xDD, 0xFF,
+    0x53, 0x19, 0xA7, 0xB9, 0xF9, 0xBE, 0xFE, 0x63, 0x7A, 0x09, 0x30, 0xF2, 0x4F, 0x28, 0xEE, 0xB2,
+    0xF7, 0x21, 0xD5, 0x17, 0xF8, 0xA0, 0xBB, 0x97, 0x41, 0x9D, 0xAA, 0xB7, 0x73, 0x80, 0xFE, 0x31,
+    0x60, 0x80, 0xBC, 0xAC, 0x78, 0xB8, 0xFF, 0xA2, 0xA5, 0xD4, 0x35, 0x03, 0x1F, 0x1B, 0xD6, 0x6E,
+    0x76, 0x2C, 0xD3, 0xAD, 0x52, 0x3B, 0x0F, 0xBB, 0x12, 0x80, 0x5E, 0x17, 0x9E, 0x1D, 0x30, 0x2E,
+    0xA5, 0xF3, 0x18, 0xD9, 0x6F, 0xAF, 0xB1, 0x7C, 0x4D, 0xC2, 0x87, 0x06, 0x58, 0x8E, 0x15, 0x79,
+    0x2B, 0x69, 0xBD, 0x5E, 0x71, 0x8E, 0x3E, 0xA3, 0x83, 0xC3, 0xD8, 0x66, 0x7B, 0x03, 0xFC, 0xA7,
+    0x07, 0x61, 0xC9, 0x21, 0xAE, 0x7B, 0xF4, 0x30, 0xEF, 0x13, 0x4E, 0xF1, 0x2F, 0x7C, 0xED, 0x97,
+    0x14, 0x8A, 0xA1, 0x29, 0xB6, 0x50, 0xE5, 0x41, 0x1B, 0x19, 0x55, 0x52, 0xE3, 0x07, 0x4E, 0x19,
+    0x43, 0xF6, 0x91, 0x78, 0x04, 0x13, 0xFF, 0xFE, 0x9D, 0x9C, 0xE3, 0xA8, 0x04, 0x01, 0x4E, 0x69,
+    0xAC, 0xAF, 0x5F, 0xF4, 0x18, 0x92, 0x30, 0x96, 0x5B, 0x8D, 0x9B, 0x91, 0x9D, 0x64, 0x2A, 0x4C,
+    0x94, 0xB4, 0x02, 0xDB, 0x60, 0x2B, 0xC9, 0xD9, 0xCB, 0xB2, 0x4E, 0x3F, 0x1A, 0xDB, 0x2C, 0x81,
+    0xF1, 0xEF, 0x55, 0xE2, 0x26, 0x0C, 0x07, 0x11, 0x6C, 0xFD, 0xAC, 0x65, 0x59, 0x12, 0xE4, 0x42,
+    0x71, 0xF9, 0x3D, 0x91, 0x3F, 0x30, 0x94, 0x94, 0x11, 0x98, 0x26, 0xCE, 0x99, 0xAB, 0xC4, 0x1A,
+    0x44, 0x44, 0x56, 0x31, 0x90, 0x41, 0x9E, 0x73, 0xE6, 0xAB, 0x72, 0x96, 0x62, 0x38, 0xBB, 0x5C,
+    0x14, 0xB2, 0x57, 0x3E, 0x24, 0x38, 0xEF, 0xD1, 0x03, 0x7E, 0xC0, 0x21, 0x27, 0x67, 0x65, 0x1B,
+    0xC8, 0xAE, 0x08, 0x0B, 0xAA, 0xBD, 0xEC, 0xDC, 0xDB, 0x80, 0x0C, 0x51, 0xE3, 0x96, 0xDD, 0xE6,
+    0x92, 0x35, 0x97, 0xDA, 0x5E, 0xDC, 0xCA, 0x5E, 0xBC, 0xD2, 0x5E, 0x90, 0xFF, 0x21, 0xA3, 0x84,
+    0x17, 0xDB, 0x0B, 0x72, 0xC4, 0x7B, 0x1B, 0x36, 0xEA, 0xF2, 0xD9, 0xB0, 0xB9, 0x4C, 0xEE, 0x30,
+    0x09, 0xC0, 0x50, 0x7C, 0x01, 0xE2, 0xF2, 0x02, 0x9D, 0xF3, 0x42, 0xD9, 0x30, 0x1E, 0xA5, 0xC3,
+    0xE8, 0xB1, 0x95, 0xA2, 0x85, 0xA8, 0x65, 0x73, 0x68, 0x19, 0x25, 0x8E, 0xD9, 0xDE, 0x14, 0x6F,
+    0x64, 0x73, 0x60, 0x69, 0x80, 0xA0, 0xF1, 0x28, 0xA6, 0x72, 0x16, 0x13, 0x4E, 0x25, 0xF1, 0x8C,
+    0xD8, 0x37, 0x1A, 0x54, 0x68, 0xE2, 0x49, 0xF2, 0x2D, 0x86, 0x6C, 0x28, 0x38, 0xB0, 0xC9, 0x82,
+    0xF5, 0x4C, 0x82, 0xBD, 0x0C, 0x6D, 0xF2, 0xC4, 0xEE, 0xCC, 0x2C, 0x5C, 0xC0, 0xA3, 0xD5, 0xBE,
+    0x03, 0x27, 0x61, 0x86, 0x61, 0x43, 0x65, 0xD4, 0x76, 0x69, 0x0D, 0x86, 0x12, 0xB2, 0xF5, 0x36,
+    0x36, 0x2C, 0xA3, 0xD3, 0x1A, 0x9E, 0xDB, 0xD6, 0x43, 0x76, 0xF4, 0x79, 0x7D, 0xF8, 0xFE, 0x94,
+    0x97, 0xC8, 0xF5, 0x66, 0xED, 0xB9, 0xB6, 0x5C, 0xE9, 0x70, 0x8E, 0x60, 0x4F, 0x65, 0x3C, 0xE2,
+    0x66, 0x8C, 0x39, 0x99, 0x52, 0xDC, 0x7F, 0x8F, 0x2C, 0xE4, 0x2F, 0xB5, 0x29, 0xD4, 0xD3, 0x99,
+    0xDF, 0x0A, 0x42, 0x43, 0x93, 0xA7, 0x38, 0xE9, 0x95, 0x99, 0xD3, 0x3D, 0x8D, 0xB1, 0xAE, 0x23,
+    0x88, 0x44, 0x49, 0xA0, 0x81, 0x76, 0x58, 0xC5, 0x7C, 0x92, 0x4F, 0xFC, 0xE2, 0xCB, 0x7E, 0xF9,
+    0x11, 0x8C, 0xE3, 0x82, 0x35, 0x87, 0xB1, 0xB8, 0x36, 0xCA, 0x36, 0x00, 0x95, 0x4F, 0x78, 0xC2,
+    0x76, 0xBF, 0xEA, 0x99, 0x1F, 0x09, 0xED, 0x6D, 0x9D, 0x49, 0x07, 0xE2, 0x6A, 0x14, 0x26, 0x99,
+    0x57, 0xAC, 0x5B, 0xF0, 0x8D, 0x4C, 0x8A, 0x93, 0x50, 0xF0, 0x15, 0xCF, 0x88, 0x13, 0x44, 0xA4,
+    0x95, 0x6E, 0xA0, 0x7B, 0x81, 0xBE, 0xE8, 0xB6, 0x08, 0xF6, 0x7F, 0x32, 0xF4, 0xCC, 0x24, 0x21,
+    0x7A, 0xD4, 0xE2, 0x3D, 0xF8, 0xB1, 0x49, 0x90, 0x56, 0x45, 0x05, 0x88, 0x5F, 0x81, 0x38, 0x35,
+    0xAB, 0xAE, 0x31, 0x49, 0x46, 0x32, 0xF8, 0xC6, 0x83, 0xEB, 0x32, 0x88, 0x51, 0x12, 0x6D, 0x31,
+    0xD0, 0x0F, 0xEC, 0xBD, 0xD9, 0xD3, 0xF1, 0xF4, 0x0D, 0xFB, 0x6E, 0x58, 0x78, 0x1F, 0xFF, 0x10,
+    0xFC, 0x90, 0x65, 0x92, 0x7D, 0xCA, 0x68, 0x8D, 0x02, 0x2A, 0x2E, 0x6E, 0x8A, 0x7C, 0x66, 0x23,
+    0x41, 0x7C, 0x3C, 0x12, 0xC0, 0x73, 0x91, 0x3D, 0xA4, 0x24, 0x4C, 0x8A, 0x63, 0xAC, 0x42, 0xD1,
+    0x85, 0x4C, 0x45, 0x67, 0x8F, 0x24, 0x26, 0x09, 0x53, 0x10, 0x85, 0xC4, 0xA6, 0xCB, 0xC2, 0xB2,
+    0x8B, 0xB1, 0x50, 0x44, 0x8C, 0x49, 0x62, 0x92, 0xE8, 0x15, 0x10, 0xF5, 0x67, 0x10, 0xFF, 0x3F,
+    0x20, 0xEE, 0xA7, 0x20, 0x62, 0x48, 0x86, 0x24, 0x11, 0x09, 0x20, 0x85, 0xDE, 0x6D, 0x3D, 0xAD,
+    0x41, 0x7D, 0x5B, 0x79, 0xDB, 0xCC, 0x67, 0x56, 0x5A, 0x03, 0x27, 0x46, 0x16, 0xCD, 0x12, 0x60,
+    0xC7, 0x66, 0x01, 0x14, 0xF1, 0x2B, 0xE0, 0x89, 0x53, 0x13, 0x59, 0xC6, 0x04, 0x84, 0x81, 0x2D,
+    0xE1, 0x89, 0x3B, 0xF1, 0x69, 0xC4, 0x3E, 0x65, 0xBF, 0x2D, 0x20, 0x9D, 0xAD, 0xB3, 0x9C, 0xB1,
+    0xCF, 0x72, 0x18, 0xB9, 0x2D, 0xE2, 0x5F, 0x6E, 0x6C, 0x31, 0xCA, 0xD1, 0x9B, 0x7D, 0x02, 0x2B,
+    0x11, 0x11, 0x8F, 0xA1, 0xA9, 0xC9, 0x90, 0xBA, 0x6D, 0xC1, 0xF9, 0x4C, 0x04, 0xBA, 0x60, 0x8D,
+    0x9F, 0x9B, 0x0D, 0x44, 0x67, 0xEF, 0xEF, 0x15, 0x53, 0xB4, 0x8C, 0x98, 0x74, 0xEE, 0x99, 0x08,
+    0xE4, 0x24, 0x4B, 0xDC, 0x32, 0x38, 0x0F, 0x64, 0x84, 0x67, 0x21, 0xEF, 0xAC, 0xA9, 0x9B, 0xE4,
+    0xD9, 0xC8, 0x62, 0x87, 0xD4, 0xA3, 0x96, 0xB8, 0xC9, 0xEB, 0xC7, 0xF3, 0x88, 0x33, 0x95, 0x05,
+    0x8B, 0x91, 0xF4, 0xE0, 0x18, 0x61, 0xAA, 0xB4, 0x5F, 0xC6, 0x18, 0x06, 0x31, 0x64, 0x58, 0x35,
+    0x79, 0x76, 0x0C, 0x8F, 0x9C, 0xC0, 0x81, 0xAA, 0x2D, 0xC4, 0xC2, 0x10, 0x35, 0xA5, 0x5F, 0x7C,
+    0x5B, 0x1C, 0x3D, 0x15, 0x74, 0x05, 0x6C, 0x0E, 0x46, 0x14, 0x15, 0xAC, 0x93, 0x21, 0x45, 0x55,
+    0x14, 0x35, 0xA2, 0xA8, 0x7D, 0x8A, 0x3A, 0x82, 0xA8, 0x5E, 0xD9, 0xE3, 0x9E, 0x41, 0xCC, 0x9D,
+    0x1D, 0x90, 0x1E, 0xA5, 0xCC, 0x40, 0x58, 0x61, 0xB0, 0x02, 0xEB, 0x45, 0x78, 0x65, 0x2B, 0xBC,
+    0x41, 0x51, 0x8F, 0x28, 0x2A, 0x07, 0xF4, 0x28, 0x2A, 0xB3, 0x8C, 0x44, 0xFD, 0x02, 0xA2, 0xBA,
+    0x56, 0x6D, 0xD6, 0xA4, 0xA2, 0x59, 0x8A, 0x6C, 0x77, 0x73, 0x9A, 0xF4, 0x78, 0x6A, 0xE4, 0x7D,
+    0x5A, 0xFE, 0x60, 0x21, 0x84, 0x8E, 0x9E, 0xC4, 0x8C, 0xDD, 0x11, 0x2A, 0x45, 0x51, 0x07, 0xAE,
+    0xC5, 0x20, 0xBB, 0x34, 0x69, 0xEB, 0x6F, 0xB2, 0x44, 0x61, 0xA2, 0x74, 0x9A, 0x3F, 0x30, 0xF5,
+    0x72, 0x6D, 0x15, 0x91, 0x3C, 0x1B, 0x81, 0x2C, 0x2E, 0xF9, 0x5C, 0x5A, 0x75, 0x34, 0xB5, 0x82,
+    0x9A, 0x79, 0x49, 0x32, 0xB5, 0xF4, 0xB3, 0xD6, 0x10, 0x4D, 0xBD, 0x4F, 0x34, 0x1A, 0x90, 0xAC,
+    0xBA, 0xC7, 0x0D, 0xFD, 0xCC, 0x57, 0x6B, 0x96, 0xDE, 0xED, 0x4D, 0x2D, 0x87, 0xE9, 0xF0, 0x1C,
+    0xB3, 0x33, 0xA6, 0x4D, 0x5B, 0xEC, 0x13, 0xF1, 0x1F, 0x48, 0x8C, 0x4A, 0x54, 0x33, 0x9A, 0x97,
+    0x30, 0x36, 0xB7, 0x62, 0x5E, 0x65, 0x13, 0xDA, 0x8C, 0x8A, 0x8D, 0x89, 0xFA, 0x21, 0xD7, 0x5C,
+    0x8D, 0xA6, 0x89, 0xE2, 0x69, 0x1B, 0x8E, 0xA7, 0x90, 0x47, 0x32, 0x0F, 0x9B, 0xA1, 0xD4, 0x36,
+    0xFB, 0xE8, 0xCA, 0x26, 0x43, 0x4F, 0xD5, 0x85, 0x0B, 0x20, 0xFA, 0xB4, 0x8D, 0x7F, 0x7B, 0x65,
+    0x17, 0x2E, 0x19, 0xEF, 0x30, 0xDE, 0xD6, 0xC8, 0x56, 0x92, 0xC7, 0x32, 0x18, 0x4E, 0x8F, 0x3B,
+    0x68, 0x21, 0xB3, 0x98, 0x24, 0xD4, 0x03, 0x24, 0xA4, 0x7D, 0x34, 0x6E, 0xA6, 0x66, 0x70, 0x9B,
+    0x4C, 0x8E, 0x10, 0x63, 0x2B, 0xC9, 0x10, 0x20, 0x6C, 0x43, 0xB4, 0xC8, 0x9C, 0x09, 0xE6, 0x39,
+    0xC4, 0xF3, 0xA0, 0x42, 0x5E, 0x55, 0x43, 0x01, 0x19, 0x5A, 0xDF, 0x5E, 0x57, 0x65, 0x9C, 0x45,
+    0xA6, 0xCA, 0x42, 0x02, 0xF8, 0x4A, 0xA3, 0xC3, 0xE9, 0xE6, 0x66, 0xD8, 0xE6, 0xBB, 0x53, 0xB3,
+    0x42, 0xE1, 0x1E, 0x20, 0x5B, 0x09, 0xB6, 0x87, 0x49, 0xE3, 0x9D, 0x41, 0xD3, 0x9C, 0xD7, 0x34,
+    0x4A, 0x0B, 0x1D, 0x1E, 0xBE, 0xA6, 0xB9, 0xAF, 0x92, 0xD9, 0x46, 0x79, 0x42, 0xBD, 0x85, 0x71,
+    0x63, 0xF3, 0xA9, 0x0E, 0xCC, 0xCF, 0x75, 0xE3, 0xC0, 0xAB, 0xCD, 0x00, 0xEE, 0xA8, 0x09, 0x62,
+    0xAC, 0xE8, 0xA7, 0xB1, 0x62, 0x11, 0xFC, 0xB9, 0xFC, 0x11, 0x5E, 0xCB, 0x2B, 0x64, 0x2E, 0xDC,
+    0x4A, 0xE9, 0x61, 0xE5, 0x97, 0x16, 0xC7, 0x7F, 0xDD, 0x41, 0x05, 0xE6, 0x27, 0xC1, 0x8E, 0x91,
+    0xF3, 0xEE, 0x11, 0x44, 0x5F, 0x59, 0x1C, 0xEF, 0xA4, 0xA9, 0xC0, 0xBC, 0x0A, 0x36, 0x97, 0xAE,
+    0xCE, 0x5D, 0x68, 0x11, 0xBC, 0x19, 0x57, 0xF6, 0x99, 0x4C, 0x21, 0xAB, 0x62, 0x8D, 0x3D, 0xFA,
+    0x80, 0x29, 0xD6, 0x7C, 0x3F, 0x74, 0x01, 0x63, 0x38, 0x79, 0x89, 0x78, 0xAB, 0xCC, 0x18, 0xDE,
+    0xA8, 0xB6, 0xF3, 0xA3, 0x4B, 0x60, 0x1F, 0x56, 0x4C, 0xA0, 0x94, 0x66, 0x3D, 0x09, 0xAE, 0xB5,
+    0x2C, 0xDD, 0xB8, 0xB7, 0x51, 0x83, 0x23, 0xF2, 0xC8, 0xF0, 0xF0, 0xC6, 0xFD, 0x3B, 0xEF, 0xC5,
+    0x76, 0xB4, 0xEC, 0x11, 0x1A, 0x95, 0x34, 0xC0, 0xBD, 0x5A, 0x7E, 0x16, 0x73, 0xFF, 0xB4, 0x0A,
+    0x4C, 0x1A, 0x9A, 0xA2, 0x35, 0xCF, 0xE8, 0xB0, 0xF9, 0x46, 0xF2, 0xE0, 0x27, 0x76, 0x52, 0xD3,
+    0x6F, 0x24, 0x83, 0x13, 0xAD, 0xD7, 0xC2, 0x00, 0x43, 0x89, 0x2A, 0x96, 0xED, 0x37, 0x12, 0xA6,
+    0xDB, 0x76, 0x7B, 0x96, 0x59, 0xDC, 0xA5, 0x72, 0xBE, 0x47, 0xFD, 0x36, 0xFE, 0xCE, 0xD3, 0x13,
+    0xD6, 0x9F, 0x3C, 0x6A, 0xFD, 0x9B, 0xFC, 0x36, 0x03, 0x0D, 0x1D, 0x6C, 0xA6, 0x21, 0xEA, 0x06,
+    0x1B, 0xF3, 0x18, 0x35, 0x37, 0x7E, 0x64, 0x37, 0xBF, 0x87, 0x77, 0xEE, 0xDC, 0x1E, 0xCC, 0xF6,
+    0x9F, 0xDA, 0x71, 0x4B, 0x07, 0x69, 0xB3, 0x61, 0x38, 0x4E, 0x9B, 0x70, 0x71, 0xCC, 0xFA, 0xBD,
+    0x13, 0xD6, 0xBF, 0x08, 0xFE, 0x53, 0xEB, 0x1F, 0xD2, 0xFA, 0x01, 0x8E, 0xC5, 0xDA, 0xDC, 0xFA,
+    0x17, 0xC1, 0x3F, 0x91, 0x19, 0x5E, 0xC9, 0xF6, 0x31, 0x0B, 0x5D, 0x00, 0xEF, 0x0B, 0xB8, 0x8B,
+    0x94, 0xBD, 0x04, 0x62, 0x83, 0xB1, 0x73, 0xDB, 0xAD, 0xBE, 0xE8, 0xE7, 0xAC, 0xFB, 0x25, 0xF7,
+    0x2D, 0xFA, 0x76, 0xC9, 0xDE, 0x84, 0xCD, 0x7C, 0xD1, 0x8F, 0x1C, 0x27, 0x08, 0x15, 0x89, 0xFA,
+    0xB0, 0x58, 0x73, 0x46, 0xAB, 0x8D, 0xD3, 0xBE, 0x69, 0x63, 0xC1, 0x93, 0x9F, 0x2C, 0xA8, 0xD2,
+    0x81, 0xD2, 0xB3, 0xF8, 0xE6, 0xDC, 0x66, 0x11, 0xF8, 0xE4, 0xA7, 0x3D, 0xAE, 0xB9, 0x5A, 0x86,
+    0x3B, 0x9A, 0xD5, 0x9E, 0x28, 0x98, 0x42, 0x8E, 0x62, 0x72, 0x44, 0x43, 0xA6, 0xC3, 0x61, 0xFA,
+    0x6F, 0xFF, 0xA6, 0x82, 0x2A, 0x47, 0xEA, 0xE3, 0x1B, 0x75, 0x94, 0xB8, 0x63, 0x98, 0xF1, 0x18,
+    0x6A, 0xCB, 0xFA, 0x6D, 0x83, 0x1A, 0x33, 0xDC, 0xAB, 0x23, 0x71, 0x2A, 0x55, 0xF8, 0xA5, 0xCF,
+    0x7D, 0x11, 0x9A, 0x35, 0x97, 0x87, 0xE0, 0x74, 0xE4, 0x8B, 0xCA, 0x8D, 0x7C, 0xDD, 0x1F, 0xCF,
+    0xC0, 0xE9, 0x8D, 0xB0, 0x96, 0x0C, 0x01, 0x23, 0x3F, 0xD8, 0xD4, 0xB9, 0x04, 0xC5, 0x3E, 0xC6,
+    0xD9, 0x7B, 0xE2, 0x0F, 0x06, 0x90, 0x89, 0xDF, 0x6E, 0xF6, 0xA7, 0x5B, 0x1C, 0xBA, 0x4D, 0x7F,
+    0xDA, 0x0D, 0xC2, 0x68, 0x44, 0x77, 0x4C, 0x82, 0x07, 0x9B, 0x48, 0x2F, 0xB9, 0xB1, 0xEE, 0x8C,
+    0x28, 0xF3, 0xA0, 0x95, 0x75, 0x30, 0x97, 0x79, 0x8C, 0xA5, 0xAF, 0xC3, 0xC4, 0x85, 0xDC, 0x41,
+    0x69, 0x2B, 0xBD, 0xA9, 0xDC, 0x8E, 0xB5, 0x07, 0xD8, 0xC6, 0xC8, 0xF6, 0x76, 0xCB, 0x30, 0x71,
+    0x92, 0x36, 0xBD, 0x5A, 0x04, 0xFF, 0x55, 0x94, 0x8F, 0xE6, 0x65, 0xED, 0x7D, 0x62, 0x52, 0xFF,
+    0x25, 0x33, 0x4F, 0x05, 0x16, 0xC1, 0x9B, 0xFE, 0xCB, 0xCF, 0x0A, 0x6C, 0xAF, 0x3F, 0x37, 0x77,
+    0x89, 0x45, 0xF0, 0xB6, 0xDB, 0xDD, 0xBA, 0xC1, 0xE3, 0xD6, 0x8B, 0x4F, 0x7C, 0x6F, 0x6B, 0x0E,
+    0x95, 0xCE, 0xFB, 0x4D, 0x27, 0x17, 0x1D, 0x8C, 0x30, 0x7E, 0xD5, 0x8C, 0xAF, 0x30, 0x7E, 0x84,
+    0xF1, 0xFB, 0xF5, 0x40, 0x46, 0x19, 0x2A, 0xF1, 0x6C, 0x00, 0x1C, 0x1F, 0x84, 0x92, 0x75, 0x51,
+    0x18, 0xC7, 0x35, 0xC6, 0x87, 0x53, 0xA9, 0x32, 0x28, 0x15, 0xC6, 0x8F, 0x30, 0x3E, 0xF7, 0x3D,
+    0x67, 0xDB, 0x5B, 0x7B, 0x8F, 0x6F, 0x6F, 0xFD, 0x2F, 0x1F, 0x9D, 0xE2, 0x24, 0x2E, 0x23, 0xF3,
+    0x19, 0x6C, 0xF6, 0xAF, 0x65, 0x53, 0x3F, 0x5E, 0x6F, 0xE0, 0x90, 0x31, 0x82, 0x50, 0xAB, 0xE6,
+    0xDB, 0x59, 0x0B, 0xE1, 0x6F, 0xB7, 0xAF, 0x98, 0x0C, 0x70, 0xFB, 0x8A, 0xC9, 0xC0, 0x7C, 0xFB,
+    0x6A, 0x21, 0xFC, 0xA7, 0x01, 0xFB, 0xC4, 0x76, 0xD5, 0x62, 0x74, 0xC3, 0x42, 0xE8, 0xA8, 0xD9,
+    0x89, 0x65, 0x36, 0x19, 0xA4, 0x33, 0x1B, 0xF8, 0xAD, 0xC8, 0x7B, 0x99, 0xB5, 0x27, 0xB7, 0x8A,
+    0xF0, 0x30, 0x4C, 0xFC, 0x42, 0xA5, 0x01, 0x3F, 0xB9, 0xA7, 0x28, 0xF2, 0x70, 0x17, 0xD6, 0x46,
+    0x88, 0xAE, 0x89, 0x18, 0x58, 0xC0, 0x2E, 0x78, 0x44, 0x55, 0xF3, 0x7D, 0x5B, 0xB5, 0x76, 0x42,
+    0xDB, 0x8A, 0x9A, 0x38, 0xC9, 0x1D, 0x45, 0xE4, 0x4B, 0x36, 0x02, 0x8A, 0x7C, 0xFE, 0xC7, 0xC0,
+    0x2C, 0x3C, 0x20, 0x8E, 0xC8, 0x31, 0x1C, 0xA9, 0xF6, 0x30, 0x1A, 0x64, 0x61, 0x1B, 0xCD, 0x9B,
+    0x5B, 0xF1, 0x59, 0x8E, 0xB9, 0xE5, 0x3A, 0xD4, 0xFB, 0xF0, 0x83, 0x6C, 0x38, 0x46, 0x22, 0x9A,
+    0x7C, 0xFE, 0x87, 0xC6, 0x59, 0x68, 0x81, 0x40, 0xDB, 0x17, 0x67, 0xBA, 0x7C, 0x9A, 0x73, 0xFD,
+    0x2F, 0xC5, 0x5B, 0xBF, 0x6F, 0xDC, 0xD6, 0x1D, 0xFF, 0x92, 0xB4, 0xC4, 0xC6, 0x44, 0x4B, 0x03,
+    0x95, 0xD1, 0xD6, 0x2E, 0xCC, 0x8C, 0x41, 0x61, 0x8B, 0x4B, 0x87, 0x0C, 0xBE, 0x23, 0xD3, 0x0C,
+    0x59, 0x6F, 0xF0, 0x25, 0x40, 0x3D, 0xB8, 0x83, 0x07, 0x23, 0x40, 0xA1, 0x0C, 0x1D, 0x3A, 0xE8,
+    0x74, 0x04, 0x32, 0x66, 0xA8, 0x86, 0xFE, 0x01, 0x1E, 0x3C, 0xA4, 0xF2, 0xE0, 0x0C, 0x19, 0xDC,
+    0x82, 0xF2, 0xB1, 0xC8, 0xE0, 0x31, 0x4C, 0x83, 0xCE, 0x26, 0x50, 0x69, 0xF1, 0x12, 0x06, 0xA5,
+    0x11, 0xBA, 0xBE, 0x3B, 0xF6, 0xF3, 0x79, 0x8F, 0xBC, 0x3B, 0xC9, 0x92, 0x2C, 0xD9, 0x77, 0x97,
+    0x3B, 0xBE, 0xAF, 0x7C, 0x24, 0xDF, 0xF7, 0x7D, 0x7F, 0xBC, 0xF7, 0xFD, 0xF5, 0x9E, 0x25, 0xA8,
+    0x52, 0x91, 0xA0, 0xCA, 0x44, 0x2E, 0x76, 0x43, 0xA9, 0x3F, 0x25, 0x9A, 0x31, 0x04, 0xB0, 0x46,
+    0x04, 0xDF, 0x01, 0x38, 0x5F, 0x03, 0xB8, 0x7F, 0x89, 0x44, 0x3C, 0x27, 0x41, 0x0F, 0x0B, 0xDD,
+    0x5A, 0x56, 0x2E, 0x12, 0x1B, 0x39, 0x3B, 0x94, 0x62, 0x14, 0x12, 0x8B, 0x59, 0x55, 0x23, 0xB1,
+    0xAA, 0x6A, 0x2C, 0xF6, 0xD3, 0x9D, 0x81, 0xB8, 0x89, 0xB8, 0xA1, 0x17, 0xE2, 0xAF, 0x2F, 0x62,
+    0xA7, 0x6D, 0x20, 0xCB, 0x36, 0x45, 0xCC, 0x1C, 0xC8, 0x8D, 0xC2, 0x52, 0xEF, 0x8E, 0xC5, 0xE8,
+    0xDE, 0xD0, 0xE3, 0x3E, 0xD8, 0x13, 0x07, 0xBF, 0x9D, 0xED, 0x3E, 0x48, 0x41, 0x5F, 0x71, 0x74,
+    0x33, 0x6E, 0x26, 0x40, 0x9C, 0x78, 0xCF, 0x6F, 0x26, 0x01, 0x7E, 0xC7, 0xAA, 0xB9, 0x68, 0x5E,
+    0xB2, 0x25, 0xFD, 0x24, 0xA8, 0x7E, 0x48, 0x9C, 0xEA, 0xD3, 0x44, 0x2E, 0x00, 0xC7, 0xDB, 0xB2,
+    0x2D, 0xF2, 0xAE, 0x01, 0x86, 0xFC, 0x8A, 0xBD, 0x2B, 0x22, 0xEE, 0xC8, 0x92, 0x59, 0x33, 0xE5,
+    0x2D, 0xB1, 0xA2, 0x2B, 0xE8, 0x84, 0x9F, 0x03, 0xA0, 0x59, 0x91, 0xF9, 0xB1, 0xB8, 0x2C, 0x26,
+    0x80, 0xD1, 0x04, 0x1A, 0xB1, 0x23, 0xE2, 0x96, 0x09, 0xF8, 0x2B, 0xC7, 0x2B, 0xB5, 0x5C, 0xDF,
+    0x98, 0x1F, 0x22, 0xBF, 0x02, 0x54, 0xD7, 0xEB, 0xD6, 0x86, 0xAE, 0x3C, 0x68, 0xCF, 0x00, 0x3E,
+    0x83, 0x7A, 0x23, 0x13, 0x0A, 0xB3, 0x78, 0x61, 0xFD, 0x8E, 0x96, 0x02, 0x3F, 0xAB, 0xD5, 0x73,
+    0x4E, 0xDF, 0x2A, 0x34, 0xAA, 0xED, 0x0D, 0xB1, 0x48, 0xB2, 0x4B, 0x92, 0x3D, 0x92, 0xEC, 0xF3,
+    0xFD, 0x80, 0xAF, 0xB5, 0x8F, 0x03, 0xC1, 0x04, 0xA8, 0x1E, 0x6A, 0x18, 0x9B, 0x03, 0x9A, 0xE3,
+    0xF0, 0x12, 0x34, 0x07, 0xD6, 0xC0, 0x1F, 0xA5, 0x7C, 0x91, 0x2F, 0xAD, 0xA1, 0x41, 0x34, 0x26,
+    0xC6, 0xA1, 0x80, 0x5D, 0x0C, 0x70, 0xAE, 0xA6, 0xC4, 0x7F, 0x4E, 0xE1, 0x8A, 0xF3, 0xEC, 0x8F,
+    0x0A, 0x55, 0x50, 0x8F, 0xD0, 0x3B, 0xD4, 0xDA, 0xF5, 0x78, 0xA4, 0xCD, 0x4D, 0x57, 0xC5, 0x46,
+    0x1F, 0x19, 0x8C, 0x34, 0xBF, 0x0A, 0xBF, 0x70, 0xC6, 0x9A, 0x15, 0x70, 0xD8, 0x5F, 0x41, 0x0E,
+    0x1E, 0xB5, 0xBD, 0xA6, 0x9F, 0x2C, 0x9D, 0x61, 0xCE, 0x5A, 0x1F, 0xAF, 0xF4, 0x73, 0x4C, 0x87,
+    0x21, 0x78, 0x5E, 0x17, 0xA3, 0x99, 0xCA, 0xF3, 0x63, 0x98, 0xAF, 0xC9, 0x16, 0xC1, 0x3B, 0x32,
+    0xFB, 0x59, 0x3E, 0xAF, 0x6E, 0xA4, 0xDB, 0xF9, 0x19, 0x2A, 0xE6, 0xC1, 0xA7, 0xD2, 0x9F, 0xD2,
+    0xA4, 0x43, 0x9D, 0x2A, 0xED, 0x2A, 0x3D, 0x4F, 0xF4, 0xBA, 0x5C, 0x66, 0xA9, 0x44, 0xA5, 0x4C,
+    0x28, 0x95, 0xCA, 0x55, 0x4A, 0x5E, 0x99, 0x23, 0xC3, 0x21, 0xBE, 0x52, 0xD8, 0xC0, 0xDA, 0xF6,
+    0x49, 0x0D, 0x8D, 0x95, 0x4D, 0x9E, 0x8C, 0xC6, 0x14, 0x07, 0xD5, 0x9E, 0xE2, 0x37, 0x91, 0x76,
+    0xF7, 0x41, 0x21, 0x2D, 0x31, 0x46, 0x00, 0xD2, 0x27, 0xF0, 0xA2, 0x16, 0x39, 0x68, 0xD1, 0x92,
+    0xB4, 0x68, 0x98, 0x26, 0x20, 0x3B, 0xF0, 0x53, 0x3D, 0x55, 0xEF, 0xA9, 0x1E, 0x7D, 0x8D, 0xA5,
+    0xDD, 0xDD, 0x28, 0x34, 0xE6, 0xA0, 0x2A, 0xA7, 0x7A, 0x2C, 0x62, 0x02, 0xDE, 0x28, 0x28, 0x96,
+    0x22, 0x23, 0xA0, 0xA8, 0x40, 0xD6, 0x46, 0x5A, 0xC0, 0x2A, 0x0E, 0x0B, 0x71, 0xF7, 0xD0, 0xD7,
+    0x8B, 0x40, 0x6A, 0xC0, 0x55, 0xDE, 0xA6, 0x15, 0xEC, 0xF1, 0x95, 0x43, 0xA0, 0x45, 0x10, 0xF0,
+    0xA9, 0x4F, 0x5D, 0xB9, 0xA9, 0x5B, 0x40, 0x00, 0xA3, 0x42, 0x8C, 0xAA, 0xF8, 0x52, 0x8B, 0x12,
+    0x9E, 0x2D, 0xA4, 0xA9, 0x2D, 0xC5, 0x7A, 0xF6, 0xFB, 0x2A, 0xB4, 0x32, 0xF1, 0x53, 0x00, 0x3B,
+    0x07, 0x30, 0x4A, 0x00, 0x19, 0x12, 0xC4, 0x04, 0xBD, 0x5F, 0x3C, 0xBB, 0x21, 0xBD, 0x00, 0xCE,
+    0x62, 0x8B, 0x34, 0xF7, 0xD4, 0xBD, 0xC9, 0xD3, 0x61, 0xD3, 0x43, 0xF5, 0xF5, 0x52, 0x6B, 0xFF,
+    0x43, 0xE0, 0xAB, 0xF0, 0x36, 0x40, 0x34, 0x65, 0xB0, 0x06, 0xE7, 0x77, 0x30, 0xB0, 0xC7, 0x27,
+    0x2B, 0xDD, 0xE7, 0xF5, 0xBD, 0x8D, 0xED, 0x86, 0xC1, 0x67, 0xAF, 0xC9, 0xA0, 0xF3, 0x12, 0x83,
+    0x36, 0x08, 0x60, 0x6B, 0xDC, 0x37, 0x27, 0x2F, 0x5B, 0xBB, 0xDB, 0x65, 0xF7, 0x23, 0x1B, 0x9E,
+    0xAB, 0xD6, 0x46, 0x9F, 0xE3, 0xDE, 0x61, 0xFF, 0x06, 0xD7, 0x4B, 0x21, 0xC2, 0xC6, 0x1E, 0x26,
+    0x27, 0xFC, 0xCD, 0xDE, 0x46, 0xE4, 0x85, 0x0E, 0x7C, 0x8B, 0x95, 0xB5, 0xE1, 0x22, 0xB6, 0xBA,
+    0x1F, 0xE5, 0xFD, 0xAA, 0xCA, 0xFB, 0x3B, 0x3B, 0x77, 0x7B, 0xCD, 0x58, 0xCD, 0xE4, 0xCC, 0x8C,
+    0x08, 0x82, 0x4A, 0xB1, 0x06, 0x22, 0x4E, 0xCE, 0x55, 0xF9, 0x89, 0xD8, 0xE1, 0x55, 0xE0, 0xC5,
+    0x64, 0x60, 0xE4, 0xB3, 0x22, 0x0B, 0xA3, 0xDF, 0xE4, 0x42, 0x3B, 0x2A, 0x0E, 0x98, 0x03, 0x1F,
+    0x0A, 0x17, 0x7D, 0x22, 0x1F, 0xCE, 0x58, 0xAC, 0x45, 0xF0, 0x01, 0x8B, 0x51, 0x5B, 0x47, 0x2C,
+    0xE9, 0xD5, 0x19, 0xEB, 0x38, 0x07, 0x3E, 0x16, 0x42, 0xAF, 0x8A, 0x13, 0x30, 0x51, 0x19, 0xFD,
+    0x30, 0x18, 0x34, 0x9E, 0xD1, 0xE2, 0x86, 0xCA, 0xFA, 0xBD, 0x19, 0xCD, 0x88, 0x6D, 0x6E, 0xC9,
+    0x04, 0xBF, 0x6A, 0xBB, 0x78, 0x23, 0xA0, 0x05, 0x0D, 0x57, 0xA0, 0x14, 0x5A, 0x25, 0xF3, 0xFB,
+    0x42, 0xCF, 0xAD, 0x20, 0x5A, 0xE8, 0xFC, 0xD2, 0x86, 0xDC, 0x3F, 0xDA, 0x90, 0xCF, 0x63, 0x8E,
+    0x69, 0x64, 0x81, 0xF2, 0x57, 0x70, 0x47, 0x8A, 0x2F, 0x27, 0xEA, 0xF1, 0x7E, 0x13, 0xF9, 0x98,
+    0x34, 0x74, 0x7E, 0x05, 0x6E, 0xAB, 0xED, 0xCB, 0x89, 0x45, 0x0B, 0xEB, 0x64, 0x8D, 0x0B, 0x3A,
+    0xDA, 0x73, 0x59, 0x55, 0x5E, 0x03, 0xE3, 0xC3, 0x3C, 0x60, 0xC0, 0xE9, 0x13, 0xC0, 0xDD, 0x98,
+    0x39, 0xBC, 0x9E, 0x99, 0xC3, 0x3E, 0x99, 0x39, 0x3C, 0xD7, 0x6A, 0x2E, 0x24, 0x15, 0x9E, 0xAB,
+    0xDA, 0xD6, 0xB4, 0xAC, 0x00, 0xA1, 0xC7, 0x9C, 0x05, 0x84, 0x94, 0x31, 0x58, 0xF2, 0x30, 0x37,
+    0x8D, 0x9A, 0xE1, 0xF4, 0x36, 0x8D, 0x9C, 0xBB, 0xBF, 0x51, 0xD0, 0xC4, 0xD1, 0xC2, 0xD1, 0xC0,
+    0xD1, 0xA0, 0xCD, 0x36, 0xDA, 0x36, 0x9A, 0x36, 0x3F, 0xB4, 0x0A, 0x1A, 0x36, 0xDA, 0x35, 0x98,
+    0xB5, 0x02, 0xF8, 0x0B, 0x6D, 0x2E, 0x39, 0x6B, 0xAC, 0xFC, 0x67, 0x1D, 0x2F, 0x75, 0x21, 0xE4,
+    0x55, 0x1A, 0x0A, 0x5A, 0x0D, 0x71, 0x60, 0x36, 0xB4, 0xDD, 0x30, 0xA8, 0xDC, 0x89, 0xA4, 0x97,
+    0x2B, 0x03, 0x23, 0x5C, 0x15, 0x33, 0x41, 0x2C, 0x4E, 0x77, 0xDE, 0x2F, 0xEA, 0x50, 0x6A, 0xC1,
+    0xFC, 0x6B, 0x5E, 0x7D, 0x69, 0xF8, 0x39, 0x7F, 0x20, 0x54, 0x5B, 0xEE, 0x1C, 0xA0, 0xBA, 0x99,
+    0x67, 0x10, 0xBB, 0x19, 0xCE, 0x18, 0xA3, 0x45, 0xF2, 0xBF, 0x7C, 0x36, 0xF5, 0x87, 0x49, 0x06,
+    0x62, 0x47, 0x7C, 0xD6, 0xE5, 0x40, 0xFE, 0xC3, 0x04, 0x09, 0x0B, 0xC1, 0xAA, 0x93, 0x2E, 0x37,
+    0x9A, 0x59, 0xF9, 0x8B, 0x14, 0x84, 0x4A, 0xCA, 0xF8, 0x0F, 0x97, 0xD1, 0xA4, 0x4F, 0x0F, 0xF4,
+    0xD0, 0x4E, 0x79, 0xBF, 0x56, 0x05, 0x23, 0xB3, 0x49, 0x04, 0xF7, 0x2A, 0x00, 0x2B, 0x56, 0x69,
+    0x00, 0xBB, 0x76, 0x2B, 0x39, 0x6D, 0x37, 0x05, 0x74, 0xF4, 0x3C, 0x56, 0xC1, 0x16, 0xC6, 0x76,
+    0x1E, 0x83, 0x8A, 0x75, 0xE6, 0xAD, 0x6B, 0xD3, 0x0C, 0x51, 0x7D, 0xE2, 0x93, 0xC1, 0x65, 0x70,
+    0x13, 0xD3, 0x6B, 0x0C, 0xF6, 0x37, 0x12, 0x19, 0x84, 0x4E, 0x2A, 0x8F, 0x60, 0x59, 0x64, 0x97,
+    0x20, 0x3E, 0x2B, 0x60, 0x66, 0xF8, 0x50, 0xE5, 0x87, 0xC3, 0x1A, 0x7E, 0xB4, 0xDF, 0xED, 0x8E,
+    0xC2, 0x8A, 0x9F, 0x4C, 0xC1, 0x74, 0xF6, 0x69, 0x0D, 0xAB, 0x3A, 0xA0, 0x23, 0xC4, 0xFB, 0x87,
+    0x9E, 0x9E, 0x1A, 0x8A, 0x4C, 0x72, 0x70, 0xD9, 0x78, 0xFA, 0x39, 0x0C, 0xF9, 0x50, 0x6E, 0xFE,
+    0xFB, 0x46, 0x7D, 0x6F, 0x0D, 0x42, 0xAA, 0x32, 0xE7, 0x49, 0x55, 0x3A, 0x43, 0x19, 0x3A, 0xB9,
+    0xF4, 0xC0, 0x6B, 0x1B, 0xCF, 0x4E, 0xD5, 0x8C, 0xF0, 0x9C, 0x57, 0x5C, 0x6D, 0x57, 0xC3, 0xDF,
+    0x7A, 0xF9, 0x05, 0xA5, 0x6D, 0x07, 0xC8, 0xB0, 0x1A, 0x7A, 0x72, 0xD6, 0xCB, 0xA9, 0x30, 0xA3,
+    0xB2, 0x06, 0x61, 0xF9, 0x09, 0x11, 0xAA, 0xCF, 0x1D, 0xA5, 0x94, 0x53, 0x5F, 0xFD, 0x2A, 0xE9,
+    0x57, 0xA9, 0xAE, 0x5D, 0xF9, 0x55, 0x84, 0x0B, 0xFA, 0x3F, 0xEB, 0xE5, 0xD3, 0x99, 0x46, 0x40,
+    0x05, 0xEF, 0xAE, 0x51, 0x19, 0x77, 0xB1, 0x28, 0xCF, 0x70, 0xFD, 0x41, 0xB6, 0xFF, 0x64, 0xA6,
+    0x41, 0x95, 0xB8, 0xE3, 0xBA, 0xDA, 0xF4, 0x86, 0xC4, 0x74, 0x24, 0xFA, 0xC2, 0xC2, 0xBA, 0x88,
+    0xBC, 0x06, 0xE1, 0x59, 0x49, 0x1A, 0x8C, 0x07, 0x63, 0x3B, 0x7D, 0xD5, 0x77, 0x30, 0x42, 0x84,
+    0xF0, 0xA5, 0x91, 0x59, 0x09, 0xBE, 0xFB, 0xE6, 0x58, 0xD6, 0x0C, 0x84, 0x0A, 0x4E, 0x62, 0xAA,
+    0xBC, 0x62, 0x35, 0xE2, 0xBF, 0x4F, 0xF8, 0x86, 0x57, 0x60, 0x90, 0xAE, 0x4B, 0xBB, 0xE3, 0x43,
+    0x97, 0x46, 0x48, 0x8C, 0xBA, 0xE7, 0xE9, 0x47, 0xBF, 0x13, 0x1F, 0xFC, 0x0C, 0xC6, 0x46, 0xCE,
+    0x66, 0xA7, 0x6F, 0xDE, 0x06, 0x23, 0x23, 0xAF, 0xC6, 0x2A, 0x06, 0xCC, 0x69, 0x75, 0x99, 0x41,
+    0x22, 0x67, 0x49, 0xD0, 0x10, 0xD2, 0xDE, 0x83, 0x9D, 0xE8, 0xC4, 0x8C, 0x22, 0x86, 0xEF, 0x40,
+    0x83, 0xF5, 0xF4, 0xBB, 0xA7, 0xEE, 0x9C, 0xF6, 0x92, 0xE9, 0x55, 0xC8, 0xFB, 0x39, 0x63, 0x3E,
+    0x26, 0x5E, 0x2A, 0x1E, 0x1C, 0x64, 0xE6, 0xF7, 0xA5, 0x9D, 0xB4, 0x56, 0xB4, 0x5D, 0x86, 0xA1,
+    0x7C, 0xC3, 0xCB, 0x67, 0x8E, 0xDB, 0x1F, 0xD1, 0xE7, 0x5F, 0x52, 0x55, 0x05, 0xD8, 0x3E, 0x58,
+    0x3E, 0xF7, 0x71, 0x0A, 0xAB, 0x57, 0xDB, 0xBC, 0x33, 0xAE, 0x9F, 0xD9, 0xCB, 0x28, 0x99, 0xA2,
+    0xF4, 0x23, 0x1A, 0xF0, 0x5D, 0x00, 0xB3, 0x04, 0x80, 0xC0, 0x5A, 0xAC, 0x03, 0xB4, 0xE8, 0xDA,
+    0x5A, 0x34, 0x30, 0xAA, 0xAC, 0xD8, 0xA2, 0xCB, 0x6B, 0xD1, 0xDB, 0xB5, 0x1E, 0xA9, 0xB8, 0x95,
+    0x21, 0xF0, 0x13, 0x56, 0x1E, 0x59, 0x74, 0x68, 0xA1, 0x2B, 0x5E, 0x1E, 0x49, 0xD3, 0xCD, 0x4B,
+    0x00, 0x1C, 0xA2, 0xB2, 0x54, 0x6E, 0x39, 0x24, 0xD8, 0x9A, 0x35, 0xD1, 0x96, 0xAA, 0x34, 0xD2,
+    0x8F, 0x3A, 0x61, 0x53, 0x69, 0x3C, 0x37, 0x63, 0xBE, 0x8F, 0x6E, 0x97, 0xC2, 0x18, 0x03, 0x40,
+    0x81, 0xC8, 0x94, 0x73, 0x89, 0x41, 0x54, 0x8C, 0xF1, 0x62, 0x50, 0xF9, 0x88, 0x09, 0x17, 0xD6,
+    0xCE, 0x00, 0x6E, 0x59, 0xDD, 0xE7, 0x73, 0x70, 0x18, 0x83, 0x35, 0xDD, 0x47, 0x39, 0x6D, 0xFD,
+    0x69, 0xD7, 0x8E, 0xF5, 0x21, 0x5A, 0xAE, 0x5D, 0xEB, 0x9D, 0xC3, 0xB8, 0x61, 0x28, 0x63, 0xE2,
+    0x02, 0xD5, 0xBB, 0xC4, 0xCD, 0x6A, 0xC7, 0xAD, 0x48, 0x76, 0x79, 0xFF, 0x08, 0xDC, 0x2C, 0x74,
+    0x50, 0x50, 0x1C, 0xC5, 0xAB, 0xF3, 0x91, 0xC6, 0x29, 0xB5, 0xE6, 0xD4, 0xEA, 0x4C, 0x20, 0x62,
+    0x33, 0x3A, 0x76, 0xC6, 0x32, 0xEE, 0x66, 0x5D, 0xEC, 0x8E, 0xCF, 0xF0, 0x5D, 0x04, 0x3D, 0x07,
+    0xE2, 0x17, 0xAF, 0x8E, 0x5E, 0x26, 0x42, 0xF0, 0xCF, 0xF0, 0xD5, 0x48, 0x3C, 0x20, 0xB8, 0x8E,
+    0xCE, 0x2D, 0xFC, 0x1B, 0x8D, 0x73, 0x0A, 0xED, 0x1A, 0xDA, 0xBB, 0x73, 0xA0, 0x35, 0x6E, 0xC7,
+    0xAD, 0xF8, 0x7A, 0xFC, 0xA7, 0xB8, 0x33, 0x0F, 0x69, 0x75, 0xD0, 0xB0, 0x76, 0x0C, 0xAE, 0x9F,
+    0xBB, 0xA7, 0xA5, 0xE0, 0xE5, 0xEF, 0x05, 0x58, 0xC3, 0x61, 0x7C, 0xFB, 0xE5, 0x27, 0x5C, 0x2B,
+    0x27, 0xB6, 0x6F, 0x72, 0xB1, 0xBE, 0xCB, 0x55, 0x54, 0x64, 0x63, 0x25, 0x06, 0x88, 0x51, 0xFB,
+    0xB8, 0xFF, 0xF3, 0xC3, 0xEF, 0xED, 0x77, 0x3B, 0xAC, 0x50, 0xA9, 0x2A, 0x95, 0x1C, 0xEF, 0x4C,
+    0xBE, 0x47, 0xE0, 0x1B, 0x9A, 0x15, 0xA3, 0x3E, 0x3F, 0x97, 0xE0, 0x78, 0x9F, 0xA3, 0xD3, 0x33,
+    0xBD, 0xB2, 0x82, 0x49, 0x69, 0x37, 0xAF, 0xA3, 0x55, 0xA9, 0x4B, 0x94, 0x56, 0x8A, 0x7C, 0x12,
+    0x20, 0x25, 0x00, 0x95, 0x69, 0xAB, 0x04, 0xB8, 0xBE, 0x4B, 0x10, 0x10, 0x78, 0x11, 0x80, 0x9B,
+    0xE0, 0x81, 0x95, 0x03, 0x18, 0x25, 0x80, 0x0C, 0x09, 0x02, 0x02, 0xFF, 0x7D, 0x00, 0xF7, 0x2B,
+    0x00, 0xFB, 0xBF, 0x00, 0xE6, 0x0F, 0xAC, 0x05, 0x56, 0x04, 0x7D, 0x02, 0x9F, 0x80, 0xB5, 0xD3,
+    0x1B, 0xBA, 0x5A, 0xCF, 0x55, 0x48, 0xC3, 0xE2, 0x4E, 0x2D, 0xCA, 0x6D, 0xAF, 0x54, 0x01, 0xDF,
+    0x60, 0x6F, 0x23, 0x19, 0x88, 0x93, 0x32, 0xDA, 0x63, 0xB0, 0x17, 0x9F, 0xB2, 0x2D, 0x91, 0x89,
+    0x43, 0x41, 0x6C, 0xD1, 0x08, 0x54, 0xED, 0xCC, 0x30, 0xF1, 0x7B, 0x53, 0x5E, 0xA6, 0x0B, 0x35,
+    0x9A, 0x2E, 0xD6, 0xAB, 0x75, 0x69, 0xBA, 0x43, 0x6B, 0xB2, 0xC9, 0x97, 0x7C, 0x3E, 0x76, 0x54,
+    0xAC, 0x3D, 0x9C, 0xDD, 0x52, 0x5B, 0x9A, 0x28, 0xE8, 0x45, 0x6D, 0x96, 0x56, 0x72, 0xCC, 0xD5,
+    0x41, 0x56, 0x57, 0x5C, 0xE6, 0xA3, 0x4F, 0xB5, 0xB3, 0xE4, 0x4F, 0x2A, 0xE8, 0x5C, 0x9D, 0x30,
+    0xA4, 0x74, 0x08, 0xB7, 0x91, 0x1B, 0x14, 0x9B, 0x40, 0xDD, 0xE9, 0x03, 0xB7, 0xF4, 0x11, 0xE2,
+    0xC0, 0x6F, 0x59, 0x0C, 0x79, 0x01, 0x36, 0xCF, 0x0A, 0x4E, 0x2D, 0x2D, 0x27, 0x3D, 0x28, 0xAD,
+    0xDD, 0x89, 0xB4, 0xDC, 0x4F, 0x01, 0x9C, 0x6F, 0x01, 0x2C, 0x4A, 0x4B, 0x5E, 0x4C, 0x04, 0x15,
+    0x68, 0x41, 0xA9, 0xEA, 0xF8, 0x01, 0x8F, 0xAA, 0x7C, 0x10, 0x3D, 0xB4, 0xC7, 0x8C, 0x6D, 0x75,
+    0x7B, 0x2A, 0xAF, 0x7D, 0xCA, 0xCB, 0x7E, 0x8D, 0x39, 0x73, 0xB8, 0xC1, 0x0B, 0x9A, 0x2C, 0x8D,
+    0xA9, 0x5D, 0x06, 0x28, 0xC8, 0x25, 0x58, 0xE9, 0x36, 0xB3, 0xC4, 0xA9, 0x30, 0x71, 0xFB, 0x2C,
+    0x88, 0x8E, 0xC3, 0x8D, 0x14, 0x21, 0x82, 0x9D, 0x83, 0x28, 0xA3, 0xE4, 0x06, 0xC3, 0x90, 0x82,
+    0xEF, 0xA9, 0x6D, 0x06, 0xB5, 0xA7, 0x70, 0x14, 0x50, 0x4F, 0xF9, 0xDE, 0x16, 0x55, 0x45, 0x7F,
+    0x6E, 0x0C, 0x81, 0xC5, 0x42, 0xE2, 0x8C, 0xF9, 0x01, 0x67, 0x0C, 0xEE, 0xD4, 0xB8, 0x9C, 0xB5,
+    0x46, 0x55, 0xA9, 0x1D, 0x0C, 0x81, 0x81, 0xD5, 0x3B, 0x1A, 0x05, 0x7F, 0x87, 0xCE, 0xB3, 0x8D,
+    0x14, 0xC2, 0xCD, 0x99, 0xF2, 0x02, 0xEB, 0x10, 0xC6, 0x29, 0x9E, 0x6D, 0xBC, 0x87, 0x81, 0x4A,
+    0x2F, 0x64, 0x6A, 0xEE, 0x64, 0xAA, 0xBA, 0xDE, 0xEC, 0x68, 0xBC, 0x25, 0xBF, 0xA4, 0x09, 0xF9,
+    0x33, 0x79, 0x61, 0x2C, 0xC9, 0x6A, 0xD8, 0x74, 0xF7, 0x66, 0xB9, 0xFC, 0x45, 0x26, 0x96, 0xBF,
+    0x83, 0x35, 0x02, 0x69, 0xF7, 0xCB, 0x69, 0xFD, 0x67, 0x1E, 0x7C, 0x4A, 0x67, 0x8D, 0x9E, 0x60,
+    0x97, 0x93, 0x08, 0x3C, 0xB9, 0xBF, 0x83, 0x72, 0xD7, 0xB9, 0x49, 0xBB, 0x66, 0xFC, 0x28, 0xCC,
+    0xCA, 0x45, 0xB8, 0x94, 0x2D, 0x18, 0x1F, 0x60, 0x36, 0x72, 0xAC, 0xA1, 0x24, 0x17, 0x43, 0xE6,
+    0xC9, 0x70, 0xC3, 0x54, 0xA5, 0x2A, 0x00, 0xEA, 0x0F, 0x18, 0xEB, 0x63, 0xF2, 0x80, 0x28, 0x5F,
+    0x2F, 0x1F, 0x5F, 0xEF, 0xAB, 0xF9, 0xDA, 0x4C, 0xF8, 0xDA, 0x50, 0xF8, 0x3A, 0x72, 0x6C, 0xFE,
+    0xB0, 0x6C, 0x3B, 0xFD, 0xD3, 0xBD, 0xD1, 0x3C, 0xAB, 0xDF, 0xAC, 0xFB, 0xE9, 0x30, 0xBE, 0xC1,
+    0x59, 0x8F, 0x00, 0xC6, 0x03, 0x4E, 0x56, 0x3D, 0x7A, 0x43, 0x4B, 0x3D, 0xBD, 0xFC, 0x3D, 0x19,
+    0x6C, 0x93, 0x4F, 0x6E, 0xB6, 0x38, 0x7B, 0x1B, 0x5F, 0x7F, 0xF3, 0x08, 0x58, 0xEC, 0x0A, 0x20,
+    0x10, 0x73, 0x08, 0xBB, 0xDD, 0xE6, 0x69, 0x00, 0x27, 0x01, 0xAB, 0xA3, 0xEE, 0x2D, 0xFE, 0x61,
+    0x39, 0x05, 0x7F, 0xC6, 0x3B, 0x3B, 0x2C, 0xD5, 0x96, 0xDA, 0xA4, 0x0D, 0x15, 0x9D, 0xEA, 0xDC,
+    0x80, 0x2F, 0xD6, 0x58, 0x6D, 0x30, 0xBA, 0x4F, 0xA2, 0x55, 0x6E, 0x25, 0x7D, 0xA0, 0x78, 0x2F,
+    0x55, 0xC4, 0x6C, 0xD4, 0x72, 0x39, 0xDE, 0x7D, 0x06, 0xD5, 0x3D, 0x5D, 0xA5, 0xFE, 0x70, 0x90,
+    0x30, 0xAC, 0x87, 0x29, 0xCA, 0x69, 0x98, 0xA7, 0xCD, 0xCA, 0x18, 0xF3, 0xEB, 0x6A, 0x76, 0x81,
+    0xF7, 0x0A, 0x95, 0x3A, 0xB4, 0x30, 0x3E, 0xCC, 0x3D, 0xE3, 0xB7, 0xA4, 0xA5, 0x36, 0xF3, 0xD8,
+    0x4F, 0x86, 0x2A, 0xDF, 0x58, 0xE1, 0x31, 0x04, 0x0A, 0x2B, 0x56, 0x0E, 0x4E, 0x69, 0xE6, 0xF6,
+    0xE5, 0xF4, 0xE1, 0x20, 0x7D, 0xF4, 0x3C, 0x1C, 0x40, 0x5F, 0x7C, 0xE9, 0x15, 0x39, 0xCC, 0x42,
+    0x08, 0x9B, 0xCD, 0x50, 0x28, 0x08, 0xE6, 0x27, 0xB5, 0x30, 0x7E, 0xB5, 0x5A, 0xAC, 0xFB, 0x85,
+    0xFF, 0x08, 0xE9, 0x2F, 0x2B, 0xEF, 0x7E, 0x58, 0x6B, 0xF9, 0xB8, 0x6B, 0x12, 0x11, 0xC3, 0xC7,
+    0x5E, 0x53, 0xE1, 0xF0, 0x05, 0xFA, 0x30, 0x3A, 0xB6, 0xF6, 0x91, 0x8E, 0x6D, 0x11, 0x0C, 0xC1,
+    0xA7, 0x6F, 0x5A, 0x29, 0xFC, 0x39, 0xBC, 0x39, 0x7D, 0x79, 0xE7, 0x75, 0x24, 0x7D, 0xD2, 0x59,
+    0x08, 0x03, 0xB3, 0xC8, 0xE1, 0xE1, 0x8F, 0xF4, 0x66, 0xD4, 0xEC, 0x1E, 0xB7, 0x9A, 0x1D, 0xE3,
+    0x50, 0x1F, 0xEF, 0x60, 0x02, 0x2E, 0x83, 0xA2, 0x3E, 0xA0, 0xD3, 0x4F, 0x74, 0xB0, 0x73, 0xD0,
+    0xA3, 0xFC, 0x5D, 0xE0, 0x9D, 0xC0, 0x98, 0x5F, 0x15, 0x7A, 0x38, 0xE4, 0x54, 0x98, 0x8D, 0x7A,
+    0xE9, 0x5C, 0xAF, 0x33, 0x09, 0xB3, 0xBA, 0xEB, 0x55, 0xC3, 0xE0, 0xBD, 0x78, 0x53, 0xB9, 0x6C,
+    0x64, 0x67, 0xD0, 0x85, 0x33, 0x0E, 0x99, 0xCA, 0xDA, 0x43, 0xC5, 0x09, 0xC6, 0x6D, 0xDF, 0x96,
+    0xDD, 0x7E, 0x55, 0xFA, 0xB0, 0xDA, 0x9D, 0x13, 0x8F, 0x35, 0x2C, 0x8C, 0xF6, 0x35, 0x6E, 0xF8,
+    0x9B, 0x55, 0xE4, 0x3C, 0xCE, 0x3C, 0x29, 0xF4, 0x81, 0x8E, 0xD7, 0xA1, 0x7D, 0x51, 0x34, 0x5E,
+    0xAB, 0x91, 0xF8, 0xD1, 0x24, 0x3F, 0x30, 0x1E, 0x68, 0x87, 0x7E, 0x66, 0x32, 0xF1, 0x12, 0xFC,
+    0x64, 0x3F, 0xE4, 0x72, 0xB1, 0x13, 0xF3, 0x41, 0x68, 0x8D, 0xE4, 0xA4, 0x9D, 0xAA, 0x45, 0x09,
+    0x1D, 0x52, 0x86, 0xAC, 0x9D, 0xAF, 0x32, 0x1E, 0xB8, 0xA8, 0x6A, 0x7B, 0xFA, 0x1A, 0x42, 0xA7,
+    0x59, 0x66, 0xEB, 0xDE, 0xDC, 0xEF, 0xBE, 0x3A, 0xF9, 0x3A, 0x65, 0x33, 0x13, 0x5D, 0xBB, 0x57,
+    0xC7, 0x22, 0x36, 0x75, 0x72, 0x7C, 0xA9, 0x64, 0xB8, 0xAB, 0x44, 0xC2, 0xF0, 0x90, 0x97, 0xF7,
+    0x74, 0x7B, 0x50, 0xE5, 0x97, 0xF7, 0x3B, 0x88, 0xE9, 0x8E, 0xBB, 0xF8, 0x26, 0xF2, 0x2F, 0xC4,
+    0x25, 0xE0, 0x41, 0xDB, 0x15, 0xA8, 0x11, 0xC8, 0xAD, 0x04, 0x3A, 0x84, 0x73, 0x61, 0x6D, 0xCE,
+    0xC8, 0xE1, 0x44, 0x7B, 0xF4, 0x49, 0x0C, 0xCF, 0xF2, 0x89, 0xF3, 0x5B, 0x08, 0x73, 0xDA, 0x60,
+    0x66, 0x35, 0x87, 0x91, 0x81, 0x68, 0xC5, 0x4A, 0x57, 0xD4, 0x23, 0x30, 0x84, 0x31, 0x73, 0x01,
+    0x4B, 0x2A, 0x4E, 0x7D, 0x55, 0x53, 0x28, 0x55, 0xC4, 0x95, 0xEB, 0x2D, 0x74, 0x63, 0x4A, 0xF3,
+    0xC7, 0xF7, 0x9F, 0xFE, 0xED, 0x38, 0x1A, 0x56, 0xEF, 0xFF, 0x6F, 0x1B, 0x93, 0x2A, 0x5B, 0xBD,
+    0x8F, 0x01, 0x4F, 0x47, 0xF3, 0x09, 0x42, 0xEF, 0x57, 0x59, 0x50, 0xA5, 0xC7, 0x0A, 0xDD, 0xA0,
+    0xF1, 0x83, 0x3D, 0x1A, 0xA4, 0x20, 0xF0, 0x45, 0x95, 0x41, 0xBB, 0x9C, 0xA2, 0x61, 0x53, 0xC1,
+    0xDA, 0x64, 0x7A, 0xD5, 0x9B, 0x0B, 0x60, 0x8C, 0x1F, 0xAA, 0x98, 0x02, 0x3A, 0x0E, 0xC4, 0xDD,
+    0x33, 0xD5, 0xB6, 0x81, 0x0A, 0xC9, 0xA2, 0x3A, 0x31, 0xEB, 0x18, 0x62, 0x8D, 0x6C, 0x71, 0x07,
+    0x95, 0xFC, 0x14, 0x73, 0xFA, 0x5C, 0x5D, 0x79, 0xBA, 0x23, 0xE6, 0x76, 0x7C, 0xEA, 0x30, 0xDF,
+    0x46, 0x4A, 0xE0, 0x66, 0x41, 0x18, 0x64, 0x7E, 0xF5, 0x22, 0xB3, 0xAB, 0x7F, 0x65, 0x6A, 0x01,
+    0x71, 0x67, 0x58, 0x6D, 0x83, 0x4F, 0x4F, 0x8C, 0x2E, 0x97, 0x3B, 0x4B, 0x9D, 0x3B, 0x19, 0x4D,
+    0xCE, 0x84, 0xCC, 0x85, 0xAB, 0x8E, 0x01, 0xEC, 0x5F, 0x70, 0xB6, 0x06, 0x93, 0x44, 0x69, 0x92,
+    0xE3, 0x2E, 0x97, 0xBF, 0x55, 0xE4, 0x1A, 0x76, 0x78, 0x4D, 0xF1, 0x39, 0x7B, 0x3E, 0x65, 0x2E,
+    0x7C, 0x9A, 0x7B, 0x0C, 0x40, 0x18, 0xD4, 0xFC, 0x9A, 0x31, 0xCC, 0x55, 0x82, 0x2B, 0x3C, 0x7F,
+    0xE9, 0x0C, 0x67, 0xAB, 0x34, 0x4B, 0x9E, 0xAF, 0x74, 0x3A, 0xFF, 0x00, 0xA7, 0xD9, 0x17, 0x22,
+    0xE9, 0x27, 0x88, 0xFF, 0x72, 0x5D, 0xB0, 0x9A, 0x27, 0xE7, 0x2B, 0xEF, 0xF1, 0x64, 0xE9, 0x07,
+    0x18, 0xA5, 0xCD, 0x52, 0xC6, 0x43, 0x96, 0x39, 0x32, 0x16, 0x24, 0xC3, 0x0B, 0x3F, 0x0E, 0xD3,
+    0x37, 0xC0, 0x5D, 0x89, 0x08, 0x3E, 0x07, 0xC9, 0x49, 0x21, 0x2E, 0x0C, 0xCA, 0x39, 0x63, 0x7E,
+    0x0C, 0x2F, 0x89, 0x1B, 0x1A, 0xCE, 0x8F, 0x26, 0x07, 0x84, 0xAF, 0x4C, 0x80, 0x47, 0x16, 0xDD,
+    0xFA, 0xC8, 0xDF, 0x9B, 0xF3, 0x73, 0xE4, 0x31, 0xE1, 0x7C, 0x26, 0x53, 0x11, 0x1E, 0xFD, 0x53,
+    0x5E, 0xA7, 0xD2, 0x41, 0xF6, 0x67, 0xAA, 0xBC, 0xDF, 0x36, 0x72, 0xBD, 0x61, 0x3E, 0xDD, 0x10,
+    0xDE, 0x54, 0x71, 0x6B, 0xD9, 0x63, 0x2A, 0xC4, 0x7C, 0x11, 0xFE, 0xD1, 0x44, 0xEA, 0x88, 0x7E,
+    0x56, 0x8E, 0xC4, 0xE8, 0x09, 0x68, 0x70, 0x43, 0xFB, 0xEB, 0xD0, 0x4E, 0x11, 0x22, 0x7F, 0xA6,
+    0x76, 0xC0, 0xDC, 0x0F, 0x12, 0x37, 0xB1, 0x13, 0xCF, 0xC2, 0x2D, 0x04, 0x31, 0x2C, 0x18, 0x59,
+    0x59, 0x9B, 0x5B, 0xF9, 0x08, 0xC1, 0x0D, 0xEE, 0xED, 0x23, 0x33, 0x2D, 0x5B, 0xEA, 0x7C, 0x21,
+    0xE3, 0x8A, 0xB2, 0x90, 0x4D, 0x04, 0xC9, 0xBB, 0xB9, 0xB4, 0xE0, 0x6C, 0xB7, 0x72, 0x69, 0x17,
+    0xAA, 0x0A, 0x4B, 0x8A, 0x11, 0xDD, 0xBB, 0x3A, 0xFC, 0x71, 0x33, 0x95, 0x54, 0x3A, 0x69, 0x53,
+    0x37, 0x55, 0x07, 0x5B, 0x74, 0x74, 0xA4, 0x0E, 0xB7, 0x88, 0x8A, 0x98, 0x64, 0x7A, 0xC0, 0x85,
+    0x33, 0xE3, 0x7C, 0x24, 0xF7, 0x7A, 0x08, 0xF9, 0x49, 0xBA, 0x9F, 0x91, 0xF2, 0x76, 0x6E, 0x65,
+    0xBE, 0x5C, 0xCF, 0xAD, 0xD4, 0x0B, 0xE3, 0xC2, 0x4E, 0xDC, 0xA8, 0x8C, 0x49, 0x75, 0xBE, 0xE9,
+    0x46, 0xF6, 0x3F, 0xF3, 0x96, 0x1B, 0x5A, 0xDF, 0x66, 0xEB, 0x9E, 0x58, 0xFF, 0x49, 0x3D, 0x50,
+    0xFC, 0x43, 0xE2, 0x82, 0xE0, 0x17, 0x91, 0x1B, 0xF3, 0x44, 0x14, 0xD7, 0xBD, 0xAA, 0xEC, 0x72,
+    0xCB, 0xBB, 0x39, 0x4B, 0xE2, 0x90, 0x02, 0x8F, 0x16, 0x81, 0x01, 0x03, 0x42, 0x28, 0x48, 0x3F,
+    0x6C, 0x92, 0xE5, 0x98, 0x25, 0xC2, 0x2D, 0xE6, 0xB5, 0x3E, 0x7F, 0x60, 0x31, 0x95, 0x48, 0x3E,
+    0xCD, 0x9C, 0x5B, 0xDF, 0x70, 0x7C, 0x39, 0x77, 0x9A, 0x4B, 0x2E, 0xB1, 0x58, 0x65, 0xBF, 0xBD,
+    0x06, 0x95, 0x9A, 0x0C, 0xEA, 0x48, 0xAA, 0x2A, 0x3A, 0x9E, 0x02, 0x34, 0x67, 0x7D, 0x28, 0x10,
+    0x9E, 0xF5, 0x61, 0xF8, 0x58, 0x8B, 0xE2, 0x73, 0xE1, 0x46, 0x9D, 0x52, 0x1F, 0x95, 0x06, 0x85,
+    0x28, 0x75, 0x51, 0x57, 0xD0, 0x90, 0xA7, 0x34, 0x6A, 0x30, 0xE5, 0x29, 0xA1, 0x8E, 0x98, 0xBB,
+    0x51, 0x18, 0xDD, 0xCF, 0x75, 0x2C, 0xE9, 0xD6, 0x67, 0x47, 0x98, 0xB3, 0xD4, 0xD9, 0xBB, 0x51,
+    0x9F, 0xCF, 0x1B, 0x44, 0xCD, 0x16, 0x45, 0xCC, 0x09, 0x3D, 0x64, 0x85, 0xE2, 0xED, 0x95, 0x43,
+    0x65, 0xD8, 0x25, 0xB1, 0xAF, 0x8E, 0x25, 0xB3, 0x4A, 0x51, 0xD6, 0x01, 0xEE, 0xF4, 0x84, 0x07,
+    0x4F, 0x8A, 0x20, 0x00, 0x2A, 0x3E, 0xDE, 0xB9, 0x9F, 0xAB, 0xE2, 0xDB, 0xE4, 0xA8, 0xEE, 0xAE,
+    0xFE, 0xFF, 0x01, 0x56, 0x7D, 0xDB, 0x3D, 0xF9, 0xF6, 0xA3, 0x6E, 0xB7, 0x83, 0x38, 0xAA, 0x64,
+    0xE3, 0x42, 0xB5, 0x9B, 0xF4, 0x6A, 0xB3, 0x96, 0xC2, 0x6F, 0x76, 0x3E, 0xEF, 0x57, 0xA3, 0x8B,
+    0xDD, 0x21, 0xA9, 0x40, 0x6F, 0x70, 0x07, 0x91, 0xB0, 0xA0, 0xC2, 0xBD, 0x6A, 0x50, 0xA5, 0x5F,
+    0x57, 0x35, 0x87, 0x31, 0xFF, 0x5F, 0x81, 0x21, 0x53, 0xF9, 0xAE, 0x4E, 0xCB, 0x2B, 0x0B, 0x21,
+    0x78, 0x4D, 0xBD, 0xB6, 0x3B, 0x3D, 0x37, 0x7E, 0x56, 0x6A, 0x39, 0x9B, 0xD4, 0x12, 0xE3, 0x62,
+    0xE3, 0x2C, 0xE3, 0x6C, 0xD3, 0x4B, 0x71, 0x21, 0x14, 0x23, 0x21, 0x59, 0xC7, 0x6A, 0x7A, 0x9C,
+    0x72, 0x67, 0x66, 0x5C, 0x27, 0x24, 0x67, 0x16, 0xF1, 0x1A, 0x72, 0xA0, 0xD0, 0xAF, 0x88, 0xBD,
+    0xA7, 0x34, 0xF5, 0x1A, 0xBB, 0xBD, 0xFF, 0x07, 0xD5, 0x5A, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F,
+    0x24, 0x2D, 0xB1, 0x08, 0x51, 0x53, 0x83, 0xBC, 0x58, 0x68, 0xD9, 0xA1, 0x93, 0x81, 0x8A, 0x4B,
+    0x87, 0x14, 0xF0, 0x1D, 0x19, 0x78, 0xE8, 0x98, 0x1B, 0x74, 0xCE, 0xE0, 0xC1, 0x19, 0x3C, 0xA4,
+    0xC9, 0xA0, 0x0E, 0x19, 0x32, 0x48, 0x3A, 0x22, 0x19, 0x3A, 0x64, 0xA8, 0x50, 0x74, 0xEB, 0x50,
+    0x0F, 0x1E, 0x9A, 0xCB, 0xA0, 0x0C, 0x1E, 0x12, 0xE0, 0x4E, 0xC7, 0xA0, 0x43, 0xC6, 0xB2, 0x2D,
+    0x3C, 0x75, 0x28, 0x51, 0xC8, 0x2D, 0xEA, 0xA1, 0x61, 0x51, 0x06, 0xA1, 0x92, 0x93, 0xD8, 0xDF,
+    0xEF, 0x7D, 0xE4, 0x9D, 0xE4, 0xC4, 0xAE, 0x12, 0x9F, 0x65, 0x57, 0x22, 0xDF, 0xA3, 0xEE, 0xC8,
+    0x8F, 0xDF, 0x7B, 0xDF, 0xFB, 0xF3, 0x7B, 0xEF, 0x93, 0x48, 0xFB, 0x63, 0x97, 0xE2, 0xD5, 0x07,
+    0x76, 0x21, 0x83, 0xBA, 0x76, 0x72, 0xFB, 0x38, 0xDE, 0xFC, 0x4B, 0xEA, 0x16, 0xE2, 0xD6, 0xB1,
+    0x9F, 0x8A, 0x35, 0x95, 0x20, 0x11, 0x99, 0x4A, 0x88, 0x3B, 0xB7, 0x25, 0x02, 0xED, 0xE2, 0x57,
+    0x70, 0xF5, 0x28, 0x6A, 0xEE, 0x31, 0xF7, 0x07, 0xB1, 0xC8, 0x48, 0x38, 0x4E, 0x25, 0x18, 0xD3,
+    0x29, 0xC4, 0x3E, 0x96, 0x30, 0x13, 0x99, 0xD4, 0x35, 0xBE, 0xF2, 0xEA, 0x8A, 0x33, 0x58, 0x95,
+    0xF9, 0x0F, 0x6E, 0x01, 0xC9, 0x25, 0x2C, 0xDD, 0xD4, 0xAE, 0xEB, 0x97, 0x13, 0xEF, 0xFE, 0xCD,
+    0x1A, 0x73, 0x70, 0x2A, 0x0C, 0x6C, 0x95, 0x7C, 0xC7, 0x14, 0x03, 0x63, 0xD4, 0x87, 0x48, 0x87,
+    0x5F, 0xE0, 0xDD, 0x15, 0x5E, 0x0A, 0x61, 0xFC, 0xCC, 0xCB, 0xC5, 0xA9, 0x6B, 0x4C, 0x7E, 0x72,
+    0x84, 0x21, 0xAD, 0x58, 0x4E, 0xBD, 0x65, 0x4B, 0xC4, 0x7F, 0x27, 0xC7, 0x93, 0xFE, 0x2F, 0x52,
+    0xD2, 0xDF, 0x26, 0xA4, 0xC7, 0x1C, 0xCB, 0x3F, 0x50, 0x9A, 0x7C, 0x4B, 0x8A, 0x89, 0xF8, 0x31,
+    0x67, 0x12, 0x08, 0x75, 0x17, 0x71, 0x40, 0x0B, 0x53, 0xC0, 0x64, 0x4A, 0xBC, 0x7A, 0xC0, 0x29,
+    0x89, 0xF4, 0x4E, 0xCC, 0xC6, 0xA2, 0x16, 0xAC, 0xF2, 0x35, 0xB1, 0x7F, 0x55, 0x8C, 0xC4, 0xF9,
+    0x47, 0x0E, 0x52, 0x27, 0x20, 0x87, 0x90, 0x0B, 0xBA, 0xF8, 0x5F, 0xC4, 0xCD, 0x65, 0x2C, 0x7E,
+    0x2E, 0x51, 0x1C, 0x41, 0x71, 0xF5, 0x97, 0x39, 0x16, 0xEF, 0x4F, 0xF9, 0x09, 0xBD, 0x5A, 0xF8,
+    0x35, 0x72, 0x67, 0x61, 0xF3, 0x51, 0x35, 0x6A, 0x2E, 0x06, 0x45, 0x73, 0x11, 0x64, 0xCD, 0xC5,
+    0xD2, 0x09, 0x55, 0x45, 0xF5, 0x01, 0xA7, 0x5C, 0x17, 0x51, 0x5D, 0xA7, 0x5C, 0xB5, 0xB2, 0xDB,
+    0xDF, 0x2B, 0xE5, 0xF5, 0xE1, 0xFB, 0x45, 0x47, 0x28, 0x95, 0x78, 0x19, 0x04, 0x1E, 0xF0, 0xF9,
+    0xA4, 0xA3, 0x02, 0x43, 0x62, 0xAA, 0x20, 0x15, 0x4C, 0x0A, 0x17, 0x5E, 0xCA, 0x35, 0xC1, 0x85,
+    0x9B, 0x71, 0x71, 0xCD, 0x85, 0x97, 0xE9, 0x45, 0xDE, 0xE8, 0x0B, 0x9F, 0x40, 0x4D, 0xE6, 0x62,
+    0x2C, 0xCD, 0x53, 0x95, 0x98, 0x71, 0x68, 0x11, 0x3A, 0x32, 0x1E, 0x12, 0x7D, 0x17, 0x1E, 0x12,
+    0x7D, 0xBB, 0x9A, 0x5A, 0x7F, 0xB3, 0x94, 0xFD, 0x7E, 0xBF, 0xA7, 0x33, 0xAC, 0xEB, 0xBA, 0x8A,
+    0x68, 0x55, 0xBC, 0x10, 0x63, 0x5C, 0x46, 0x0D, 0x81, 0x54, 0x2A, 0x8C, 0xFB, 0xE7, 0x5C, 0xEF,
+    0xB4, 0xEB, 0x54, 0x45, 0x91, 0x89, 0x19, 0x0B, 0xB7, 0x35, 0x82, 0x98, 0xB7, 0x5D, 0x19, 0xBE,
+    0xA7, 0xAF, 0x8F, 0xEA, 0x63, 0x9D, 0xCF, 0xA5, 0xFE, 0xD8, 0x4C, 0x50, 0xA6, 0x86, 0xDB, 0x85,
+    0x11, 0xC1, 0xCD, 0xCC, 0xDF, 0x7E, 0xD2, 0x4A, 0x62, 0xE6, 0xBF, 0xDD, 0xA8, 0xA1, 0x32, 0xE3,
+    0x19, 0xD9, 0x07, 0xFC, 0x46, 0xDF, 0x07, 0xD7, 0xD0, 0xA9, 0x77, 0xA9, 0x64, 0xA3, 0x5B, 0x9D,
+    0x38, 0xB8, 0x2E, 0x59, 0xAC, 0x16, 0x5B, 0xDA, 0x79, 0xA0, 0x5C, 0xA6, 0xDB, 0xA2, 0x3C, 0x2A,
+    0x0D, 0xC7, 0x7A, 0x2B, 0x37, 0x86, 0xAD, 0x1F, 0xCA, 0x66, 0x56, 0x2E, 0x0F, 0x87, 0x89, 0x53,
+    0x4F, 0x4B, 0xB7, 0xAE, 0x33, 0xFF, 0x60, 0xB3, 0xB4, 0xFA, 0x37, 0xD3, 0x20, 0x71, 0xF1, 0x7D,
+    0x10, 0x47, 0xF4, 0x75, 0xF5, 0x5F, 0x38, 0x92, 0xF1, 0x9B, 0x92, 0x97, 0xCA, 0x61, 0x49, 0xCA,
+    0xFD, 0xD4, 0xF0, 0x50, 0xF5, 0x50, 0xCA, 0x8E, 0x18, 0xC7, 0x9B, 0x0A, 0x3E, 0x72, 0x4A, 0xB8,
+    0x16, 0x7C, 0xCB, 0x2F, 0xA9, 0x08, 0xB7, 0x3E, 0x2A, 0xFD, 0xBA, 0xCE, 0xAD, 0xBA, 0xBC, 0x4B,
+    0x2E, 0x4B, 0xC6, 0x68, 0x3A, 0x9C, 0x10, 0x49, 0xB5, 0x68, 0xD2, 0xED, 0xF7, 0xB9, 0x8C, 0x75,
+    0x62, 0x88, 0x1A, 0xB2, 0xFA, 0x4E, 0x13, 0x39, 0x1C, 0x4C, 0x82, 0xBE, 0x83, 0x8F, 0xEE, 0xE8,
+    0x54, 0x7A, 0x1D, 0x7E, 0x4B, 0xA2, 0x03, 0xDC, 0xEE, 0xB4, 0xF3, 0x93, 0xD9, 0x9F, 0xE5, 0xB7,
+    0x24, 0x9C, 0x4B, 0xC9, 0x69, 0x18, 0x32, 0x5B, 0x85, 0x19, 0xB1, 0xE8, 0x59, 0x88, 0x7A, 0x62,
+    0xD5, 0x74, 0x2D, 0x06, 0x3C, 0x28, 0xBD, 0x37, 0xA2, 0xEF, 0x4D, 0x47, 0xF2, 0xEA, 0x88, 0x7F,
+    0xE2, 0xB8, 0xA3, 0x9F, 0x9C, 0xF5, 0x90, 0xF9, 0x51, 0xCA, 0xB5, 0x42, 0x20, 0x71, 0x9D, 0x44,
+    0x74, 0x6D, 0x27, 0x8B, 0x12, 0xC3, 0x32, 0xC3, 0x0A, 0x65, 0x9D, 0x4A, 0xD9, 0xD5, 0xB1, 0x61,
+    0x91, 0x61, 0x30, 0x48, 0x32, 0xB8, 0x17, 0x6F, 0x71, 0x0A, 0x65, 0x56, 0xA5, 0x4C, 0xA6, 0x86,
+    0x45, 0x86, 0x85, 0xD7, 0x94, 0xF9, 0xBF, 0x57, 0xE6, 0xFE, 0x47, 0x99, 0xFD, 0xB9, 0x32, 0xA9,
+    0x0D, 0x1B, 0x18, 0x16, 0x1A, 0xE6, 0x83, 0x35, 0xF1, 0x46, 0x99, 0x6B, 0x18, 0x63, 0x02, 0xA8,
+    0x2A, 0x82, 0xB1, 0x96, 0x3F, 0xCB, 0xBB, 0x4D, 0x88, 0x8A, 0x55, 0x06, 0xD7, 0xC8, 0xE0, 0x1A,
+    0x19, 0xEC, 0x44, 0x65, 0xC0, 0x62, 0x55, 0xCA, 0x54, 0x06, 0x3B, 0x51, 0x19, 0xDC, 0x54, 0x65,
+    0x00, 0xA3, 0x0C, 0x6E, 0xAA, 0x32, 0x80, 0x51, 0x06, 0x30, 0xCA, 0x40, 0x16, 0x19, 0x06, 0x19,
+    0xC8, 0x20, 0x03, 0x19, 0x64, 0x20, 0x83, 0x0C, 0x64, 0x90, 0x41, 0xD9, 0xC0, 0xB0, 0xD0, 0x30,
+    0x1F, 0xCC, 0x4C, 0xFE, 0x31, 0x2C, 0x50, 0xE6, 0x1A, 0x89, 0xDC, 0xA3, 0x46, 0x12, 0x52, 0x4F,
+    0xBF, 0xF1, 0x54, 0x70, 0x3B, 0x39, 0x99, 0x7B, 0x6E, 0x05, 0x95, 0x2C, 0x27, 0x23, 0x24, 0x40,
+    0x37, 0x9D, 0x1C, 0x6C, 0xA6, 0xA0, 0xB8, 0xCF, 0x4D, 0xF7, 0xE1, 0x82, 0x6E, 0x3A, 0x56, 0x3A,
+    0x7A, 0x02, 0x3A, 0x9F, 0xDE, 0x49, 0x6A, 0xE6, 0xC3, 0xF0, 0x8C, 0xAC, 0xAB, 0x1F, 0xC3, 0x80,
+    0x56, 0x98, 0x86, 0x3A, 0x36, 0x7C, 0x26, 0x78, 0x39, 0xA5, 0x1C, 0x9C, 0xEC, 0xF4, 0x74, 0x7A,
+    0x52, 0xFF, 0xE2, 0x67, 0x0E, 0xC5, 0x73, 0x3E, 0xE5, 0x00, 0x7F, 0xE0, 0xFA, 0xFD, 0x12, 0x63,
+    0x05, 0x1C, 0x36, 0xD2, 0x15, 0xA2, 0xFB, 0x8D, 0x68, 0xF2, 0x15, 0x7E, 0xE1, 0x90, 0x23, 0x44,
+    0xD8, 0xFA, 0x88, 0x59, 0xEF, 0x58, 0xDC, 0x07, 0xC3, 0x09, 0x57, 0xDF, 0x8F, 0x11, 0xCC, 0xFC,
+    0x34, 0xA4, 0x45, 0x74, 0x99, 0xE6, 0x91, 0x85, 0xED, 0x62, 0x4A, 0x17, 0x5D, 0x42, 0xF0, 0x70,
+    0xD3, 0x75, 0x5C, 0x31, 0x06, 0x62, 0x98, 0x10, 0x23, 0x37, 0xF1, 0x44, 0xF6, 0x0E, 0x30, 0xE9,
+    0x63, 0xF1, 0x76, 0x07, 0xB1, 0xB1, 0x22, 0xCF, 0x9C, 0xD6, 0x0D, 0x62, 0x84, 0x34, 0x38, 0xBC,
+    0x91, 0x46, 0xF8, 0x7B, 0xA4, 0xA7, 0x8F, 0x33, 0x48, 0x77, 0x64, 0x80, 0xD0, 0xFD, 0x79, 0xEA,
+    0xD5, 0xEF, 0xA4, 0x90, 0x13, 0x02, 0xF5, 0x46, 0xC8, 0x7E, 0x41, 0xEC, 0x1D, 0x8B, 0x33, 0x6D,
+    0x04, 0x0C, 0xEB, 0x04, 0x87, 0xA5, 0x41, 0xF0, 0x1B, 0x1D, 0x61, 0x1D, 0x47, 0x75, 0xB2, 0x2A,
+    0x2B, 0xEB, 0x56, 0xE9, 0x7F, 0x92, 0x39, 0x30, 0x80, 0xE3, 0x36, 0xDF, 0xBE, 0xD6, 0xB8, 0xF5,
+    0x59, 0x8F, 0x0B, 0xF8, 0x85, 0x66, 0x70, 0xE5, 0xFC, 0x4D, 0x83, 0x05, 0x57, 0x4A, 0xF3, 0xD0,
+    0xA5, 0x76, 0x0D, 0x3C, 0x22, 0x07, 0x64, 0xE1, 0x98, 0xE8, 0x2C, 0x23, 0x38, 0x2B, 0x14, 0x53,
+    0x29, 0x34, 0x53, 0xA4, 0xA5, 0x99, 0x50, 0xF1, 0xD7, 0xD7, 0x11, 0xFD, 0x96, 0xF7, 0xED, 0x28,
+    0x20, 0x53, 0x5C, 0xA7, 0x70, 0xCC, 0xA0, 0x31, 0x05, 0x63, 0x06, 0x8B, 0xAD, 0x9A, 0xCC, 0xA3,
+    0x59, 0x67, 0x84, 0x3C, 0xC0, 0x6C, 0xC3, 0x4C, 0xD3, 0xC2, 0xA7, 0xB0, 0xE4, 0xB2, 0xC6, 0xDE,
+    0x67, 0x9B, 0x19, 0x53, 0x1A, 0x33, 0x03, 0x11, 0x19, 0x11, 0xD8, 0xC9, 0x93, 0x9F, 0x11, 0x8B,
+    0x11, 0x8A, 0x11, 0x89, 0x29, 0x10, 0x23, 0x0E, 0xE3, 0x38, 0x3D, 0x01, 0xA9, 0x68, 0x96, 0x3A,
+    0x27, 0x5F, 0xED, 0x4A, 0x03, 0x66, 0x6B, 0x75, 0x04, 0x67, 0x8A, 0xC7, 0x9E, 0x9C, 0x28, 0x1A,
+    0x8B, 0x98, 0xBB, 0x42, 0x62, 0x31, 0xFF, 0x00, 0xF6, 0x6D, 0x90, 0x98, 0x01, 0x62, 0x3D, 0x5A,
+    0x19, 0x4D, 0x0F, 0xE1, 0xA0, 0xA0, 0xE9, 0x41, 0xD8, 0x68, 0x6E, 0x7A, 0xC0, 0x64, 0xBB, 0x74,
+    0xAB, 0xB3, 0x9D, 0x6E, 0x4E, 0x1C, 0x46, 0x18, 0x46, 0x14, 0xA6, 0x20, 0x8C, 0x36, 0xF1, 0xFA,
+    0x90, 0x28, 0x94, 0xEB, 0xDA, 0xEF, 0xB7, 0xD8, 0xEA, 0x87, 0xCB, 0x94, 0x93, 0x48, 0x46, 0x49,
+    0x0B, 0xD0, 0xCE, 0x59, 0x74, 0xAB, 0xBF, 0xC1, 0x2C, 0x2E, 0xF6, 0xF0, 0x77, 0xE6, 0xF5, 0xF1,
+    0xCA, 0x4C, 0x18, 0x5E, 0x2F, 0x4C, 0x05, 0xF2, 0x02, 0xDF, 0x18, 0xC6, 0x5A, 0x15, 0x34, 0x09,
+    0x5B, 0xC3, 0xE2, 0xF3, 0xA1, 0x07, 0x91, 0x0D, 0x13, 0xE5, 0x18, 0xC5, 0x38, 0x8F, 0xEF, 0x3F,
+    0x45, 0x5D, 0x14, 0x76, 0x46, 0x4F, 0x64, 0xF8, 0xDC, 0x6F, 0x02, 0xB1, 0x31, 0xFD, 0xE7, 0x43,
+    0x17, 0x2F, 0xC4, 0x97, 0x8D, 0xCC, 0x5F, 0x16, 0xC6, 0x15, 0x2E, 0xC7, 0x4F, 0x4F, 0x17, 0x3F,
+    0xD3, 0x22, 0x63, 0x06, 0x0E, 0x1C, 0x05, 0xB5, 0xB7, 0x9F, 0x1F, 0xFF, 0xE8, 0x35, 0xA1, 0x89,
+    0x09, 0x90, 0xC1, 0xCA, 0x7B, 0x7A, 0xBA, 0x58, 0xAE, 0x77, 0x51, 0x09, 0x4C, 0x51, 0x15, 0x4C,
+    0x1A, 0x64, 0x41, 0xF4, 0x40, 0x8D, 0x38, 0xF9, 0xA5, 0xFE, 0x2B, 0x05, 0xA2, 0x74, 0x31, 0x41,
+    0xDD, 0xB5, 0x85, 0xBF, 0x01, 0x61, 0x32, 0xCC, 0x18, 0xC8, 0x3E, 0x8C, 0x99, 0x19, 0x2D, 0xCE,
+    0x9A, 0x21, 0xEB, 0xCA, 0x70, 0x97, 0xF5, 0x04, 0x1E, 0xBA, 0xD4, 0x6F, 0xA3, 0xE9, 0x77, 0x18,
+    0x74, 0x23, 0x62, 0xB0, 0x75, 0x27, 0x65, 0xBE, 0x39, 0xEF, 0xDC, 0xCE, 0x28, 0xE3, 0xE0, 0x56,
+    0x7B, 0xF8, 0x5E, 0x13, 0x65, 0x56, 0xF5, 0x7B, 0xBD, 0x27, 0x5E, 0x5D, 0x58, 0x8E, 0x6F, 0x4B,
+    0xD6, 0xBC, 0x21, 0xE6, 0xE7, 0xD5, 0x56, 0x52, 0x43, 0x7A, 0xCF, 0x5C, 0x7A, 0xBF, 0x01, 0x62,
+    0x7E, 0x3C, 0x37, 0xEB, 0x85, 0x48, 0x6F, 0xD7, 0x8A, 0xA9, 0x1D, 0xC3, 0xF8, 0xDE, 0xF9, 0x0F,
+    0xEA, 0x41, 0x26, 0x20, 0xBF, 0x61, 0x7B, 0xF7, 0x98, 0x89, 0x42, 0x75, 0x2D, 0xE9, 0x18, 0x36,
+    0x32, 0xAC, 0x52, 0x86, 0xBC, 0x9D, 0xA8, 0x43, 0x2A, 0xF3, 0x52, 0x9F, 0x18, 0xC1, 0x4F, 0x94,
+    0x85, 0xE2, 0xDF, 0xEB, 0x6B, 0xD9, 0x9A, 0x68, 0x43, 0x43, 0xD9, 0xF1, 0x70, 0x2F, 0xD1, 0xC0,
+    0xCE, 0x07, 0xA0, 0x32, 0x32, 0xAD, 0x8A, 0x55, 0x1E, 0x3C, 0xA0, 0x1A, 0xC2, 0xDB, 0x23, 0x9D,
+    0x05, 0x44, 0xD3, 0x42, 0xD7, 0x36, 0xE5, 0x2E, 0x6A, 0xA9, 0xB6, 0x57, 0x31, 0xC9, 0xBD, 0x0A,
+    0x77, 0x4C, 0xE1, 0x84, 0xFE, 0xEE, 0xE4, 0x68, 0x0D, 0x4B, 0x10, 0x14, 0x1A, 0x97, 0x53, 0xA6,
+    0x0D, 0xAD, 0xA8, 0x97, 0x6E, 0xDE, 0xEB, 0x57, 0x78, 0x14, 0x45, 0x7E, 0x70, 0x78, 0xF3, 0xC1,
+    0xF0, 0x4E, 0xA4, 0x4A, 0x1B, 0x9D, 0xA2, 0x21, 0x4C, 0x60, 0x47, 0xC6, 0x95, 0xFC, 0x3C, 0x82,
+    0xE7, 0xD4, 0x85, 0x57, 0x27, 0x01, 0x2A, 0xB1, 0x95, 0xB9, 0x0D, 0x40, 0x61, 0x90, 0x86, 0x95,
+    0x6B, 0xBD, 0x7B, 0x23, 0x75, 0xAA, 0x16, 0xB1, 0xAB, 0xCC, 0xE1, 0x2C, 0x34, 0x75, 0x0D, 0xB1,
+    0xFA, 0xBD, 0x2E, 0x94, 0x5B, 0x34, 0x04, 0x2A, 0x8A, 0x0C, 0xB1, 0xDF, 0xFF, 0x02, 0x60, 0xA8,
+    0xAE, 0x31, 0xC1, 0xEB, 0x9F, 0xA1, 0xD4, 0xB6, 0x81, 0xAB, 0xE2, 0x65, 0x6D, 0xA8, 0x15, 0x58,
+    0x56, 0xF8, 0xB5, 0xF6, 0x54, 0x06, 0xD9, 0x2D, 0x61, 0x69, 0x2E, 0xFE, 0x7D, 0xD4, 0xFD, 0x21,
+    0x8B, 0x72, 0xAD, 0xC8, 0xBB, 0xB3, 0x1A, 0xFC, 0x21, 0xA2, 0x5F, 0xE8, 0x2D, 0x41, 0xEA, 0x95,
+    0xE2, 0x7D, 0xB1, 0x0F, 0xF0, 0x59, 0x57, 0x50, 0xC2, 0xA5, 0xB8, 0x6C, 0x2C, 0xD8, 0xA5, 0xFE,
+    0x5C, 0xA3, 0xCA, 0x42, 0x2E, 0xF6, 0x82, 0x9C, 0xDA, 0x4D, 0x10, 0x4D, 0x0E, 0xC5, 0x40, 0x1B,
+    0xF1, 0x18, 0xEE, 0xEC, 0x7F, 0xF3, 0x09, 0x2D, 0x44, 0xA3, 0x44, 0xE6, 0xD0, 0xFA, 0x94, 0x0E,
+    0xD6, 0x1A, 0x1D, 0xE4, 0x6D, 0x3C, 0xD6, 0x84, 0x7D, 0x52, 0x07, 0x4A, 0xE6, 0x3A, 0xB0, 0xAE,
+    0x1B, 0x1D, 0x84, 0x24, 0xB0, 0x69, 0xA2, 0x3D, 0x90, 0x47, 0xE8, 0xC0, 0x34, 0xA2, 0x9C, 0x3C,
+    0x30, 0xED, 0x27, 0xC5, 0x96, 0xD9, 0xBC, 0xDF, 0xB4, 0x99, 0xDD, 0xA2, 0x7A, 0xA8, 0x1D, 0x76,
+    0x2C, 0x28, 0x38, 0x35, 0x40, 0x55, 0x9C, 0x3C, 0xD9, 0x95, 0x20, 0xEE, 0x0C, 0x63, 0xA7, 0x04,
+    0xB6, 0x2C, 0xD9, 0x85, 0x40, 0xFC, 0x2B, 0x31, 0x7E, 0x69, 0x2A, 0x6F, 0xFA, 0xAA, 0x53, 0x40,
+    0x17, 0x19, 0xCD, 0x75, 0x19, 0xC0, 0x56, 0xBB, 0x29, 0x98, 0x5C, 0x6C, 0xF0, 0xA9, 0x84, 0x14,
+    0x53, 0x3B, 0x28, 0xB3, 0xBE, 0x60, 0xC7, 0xF4, 0xAB, 0x6C, 0xB6, 0x6B, 0xDC, 0x1C, 0x24, 0x60,
+    0x6B, 0x4A, 0xDB, 0x52, 0xD3, 0x26, 0x08, 0x74, 0xA8, 0x93, 0x0E, 0xD5, 0xD1, 0xD9, 0xD7, 0x40,
+    0xC3, 0xB8, 0xFA, 0x57, 0xC6, 0x09, 0x56, 0xF9, 0x1D, 0x5B, 0x3B, 0x56, 0x47, 0xD2, 0x3E, 0x16,
+    0xB0, 0xD3, 0xE3, 0x71, 0x28, 0xA4, 0x10, 0x6D, 0x4F, 0x76, 0x68, 0x90, 0xAB, 0xB4, 0xC0, 0x75,
+    0x35, 0xE5, 0x4F, 0x18, 0xE0, 0xB5, 0x78, 0x3C, 0x7E, 0xB8, 0x0F, 0xAA, 0xBD, 0x82, 0xC7, 0x13,
+    0xE4, 0xE5, 0x11, 0xDF, 0x34, 0xE2, 0x04, 0x47, 0x1A, 0xA5, 0xD4, 0xF0, 0x39, 0xC1, 0x11, 0xE3,
+    0xDA, 0x3E, 0xC9, 0x84, 0x43, 0x4F, 0xC2, 0xB8, 0xFD, 0xD6, 0x44, 0xB3, 0x8A, 0x8F, 0x8D, 0xA5,
+    0x1D, 0xC0, 0x54, 0xE6, 0xE7, 0x59, 0x68, 0x04, 0x7C, 0xDD, 0x55, 0x92, 0xBB, 0xB3, 0xA6, 0xC9,
+    0x58, 0xAD, 0x2D, 0x6D, 0x5A, 0x90, 0x4F, 0x5A, 0x6A, 0x30, 0x76, 0x33, 0x5D, 0xFB, 0xCD, 0xDB,
+    0x7C, 0x78, 0x3D, 0x22, 0x8B, 0xE6, 0x74, 0x9D, 0x83, 0x4F, 0xB2, 0x34, 0x4B, 0x93, 0xE7, 0x28,
+    0x3B, 0xE5, 0xFC, 0xD1, 0x4C, 0x01, 0x6F, 0x91, 0x6C, 0xAB, 0xEC, 0x99, 0x91, 0x9D, 0xA1, 0x51,
+    0x03, 0x63, 0x1B, 0x16, 0x9F, 0xA2, 0x2E, 0x1E, 0x57, 0xFD, 0x40, 0x1B, 0x19, 0xCE, 0xFC, 0xCA,
+    0x70, 0x0F, 0x03, 0x44, 0x18, 0xE0, 0xA8, 0x81, 0xC8, 0xA9, 0x09, 0x0B, 0x53, 0xC6, 0x8F, 0x5D,
+    0x93, 0x78, 0xFA, 0x93, 0xD4, 0xB4, 0xBB, 0xD8, 0x22, 0xA4, 0x79, 0xF3, 0x64, 0xC3, 0xD1, 0x29,
+    0x0E, 0x24, 0xC8, 0x10, 0xAB, 0xE3, 0x4D, 0x8A, 0xBF, 0x6A, 0xC2, 0x92, 0x07, 0xFC, 0xA5, 0x41,
+    0x89, 0x31, 0x89, 0x21, 0xA9, 0x79, 0xE7, 0x95, 0xE1, 0x30, 0x66, 0x43, 0x14, 0xEF, 0x8C, 0x4D,
+    0xC4, 0xA9, 0xE6, 0xEF, 0x0C, 0x8D, 0xF5, 0x5B, 0x08, 0x59, 0x36, 0x96, 0xCB, 0xBA, 0x4E, 0xE3,
+    0x06, 0x7A, 0xD3, 0x74, 0xE9, 0xB6, 0x70, 0x29, 0x6B, 0x04, 0x4E, 0x99, 0x67, 0x3F, 0xB2, 0x26,
+    0xD0, 0x7D, 0x25, 0x6B, 0x98, 0xE7, 0x62, 0x0A, 0xF6, 0x13, 0x07, 0xFC, 0x68, 0x82, 0x18, 0x97,
+    0xFC, 0x7F, 0xF7, 0xC9, 0x75, 0xF2, 0xD2, 0xF4, 0xA1, 0xF5, 0xD6, 0xBD, 0xD2, 0x84, 0x44, 0x9D,
+    0xF9, 0x73, 0xD5, 0x17, 0x6F, 0x7E, 0xCA, 0x6F, 0xC4, 0x9F, 0x93, 0xBE, 0xB8, 0x29, 0x33, 0xCD,
+    0x76, 0x8F, 0xEE, 0x73, 0x69, 0x53, 0x4E, 0x23, 0xE1, 0x85, 0x67, 0x92, 0x8E, 0x4D, 0x8B, 0x69,
+    0x7F, 0xEE, 0x63, 0xDE, 0xDC, 0x0F, 0x9F, 0x66, 0x3A, 0xEE, 0x48, 0x63, 0xB5, 0x8F, 0xA6, 0x77,
+    0x94, 0x56, 0x27, 0x69, 0xC4, 0x2D, 0x9D, 0x86, 0x76, 0xFB, 0xFD, 0x87, 0xBE, 0xFD, 0x5A, 0x3A,
+    0x55, 0xBA, 0xE3, 0x70, 0x96, 0x28, 0x09, 0x68, 0x80, 0x66, 0xFB, 0xCD, 0x54, 0x0B, 0x57, 0xBD,
+    0x3A, 0xBE, 0x3A, 0xC0, 0xE7, 0x87, 0x6E, 0x85, 0xB0, 0x37, 0x45, 0x84, 0x63, 0x90, 0x67, 0x8C,
+    0xD7, 0xB3, 0x63, 0xCE, 0x6D, 0x9C, 0xA3, 0x8E, 0x1A, 0x38, 0xF7, 0x12, 0x1C, 0x18, 0xB8, 0xCF,
+    0xD6, 0x72, 0xDC, 0x81, 0xBD, 0x76, 0x80, 0xCC, 0xBA, 0x13, 0x44, 0x80, 0x23, 0x13, 0xBF, 0xBB,
+    0xCD, 0xDE, 0xC2, 0xD7, 0x9D, 0x46, 0xB7, 0xDA, 0x34, 0xD6, 0x96, 0xB8, 0x5D, 0xCC, 0xD2, 0x79,
+    0x6B, 0x00, 0xDA, 0x05, 0xD7, 0x1E, 0xB8, 0x76, 0xC0, 0xB5, 0xFF, 0xAD, 0xDD, 0x6F, 0xED, 0x7D,
+    0x6B, 0xE7, 0x5B, 0xFB, 0xDE, 0xDA, 0xF5, 0xD6, 0x9E, 0xB7, 0x76, 0xBC, 0xB5, 0xDF, 0xAD, 0xDD,
+    0x6E, 0xED, 0x75, 0x6B, 0xA7, 0x5B, 0xFB, 0xDC, 0xDA, 0xE5, 0xD6, 0x1E, 0xB7, 0x76, 0xB8, 0xB5,
+    0xBF, 0xAD, 0xDD, 0x6D, 0xA6, 0x41, 0xB5, 0xC4, 0x71, 0x5B, 0xDA, 0x26, 0x33, 0x34, 0xC4, 0x16,
+    0x35, 0x1B, 0xD4, 0x6C, 0x4F, 0xB3, 0x39, 0xCD, 0xD6, 0xF4, 0xF8, 0xCC, 0xE5, 0x2D, 0x63, 0x30,
+    0x71, 0xDD, 0xBC, 0xDD, 0x23, 0x1F, 0xB4, 0x95, 0x97, 0xC3, 0x80, 0xED, 0x31, 0x15, 0x5D, 0x74,
+    0x58, 0x19, 0xB8, 0x71, 0xDB, 0x76, 0xD6, 0x1A, 0xEC, 0x5F, 0xD4, 0xCC, 0xBC, 0x06, 0x63, 0x8F,
+    0x70, 0x5D, 0x6B, 0x30, 0x6A, 0x6A, 0x24, 0x05, 0xED, 0xA9, 0xA2, 0x41, 0x6D, 0xB1, 0xFC, 0xD2,
+    0x1A, 0xAC, 0x16, 0xEF, 0x5E, 0x7F, 0x33, 0x46, 0xAC, 0xD3, 0xF2, 0xCB, 0x4B, 0xB5, 0xFC, 0xDA,
+    0x9E, 0x95, 0x5F, 0x8A, 0xAD, 0x58, 0xC3, 0xFB, 0x4D, 0x17, 0x7E, 0x0D, 0x7C, 0x07, 0x23, 0x15,
+    0x3F, 0x16, 0xC9, 0x5F, 0x04, 0xFE, 0x00, 0x00, 0x89, 0xF2, 0x05, 0x97, 0x62, 0x33, 0x30, 0xD7,
+    0xEC, 0x09, 0x98, 0x38, 0x64, 0xDA, 0x1B, 0x5A, 0xF8, 0xC9, 0xA9, 0x42, 0xFC, 0x79, 0xAC, 0xCF,
+    0xDA, 0xFE, 0xF3, 0x8E, 0x52, 0xDD, 0x15, 0x30, 0xF6, 0x6A, 0x36, 0x14, 0x2C, 0x39, 0xF7, 0x8A,
+    0x6D, 0xA3, 0x6D, 0x14, 0xBB, 0xB3, 0x22, 0x6D, 0xFD, 0x84, 0xAA, 0x57, 0xF8, 0x7F, 0x0C, 0xA5,
+    0x86, 0x38, 0x04, 0xBB, 0x01, 0x21, 0x9C, 0x4F, 0x08, 0x17, 0x12, 0xC2, 0x6D, 0x11, 0xC2, 0x95,
+    0xF0, 0x6E, 0x27, 0x87, 0x6B, 0x7B, 0x29, 0x30, 0x1B, 0x02, 0x3F, 0x63, 0x3E, 0x08, 0x50, 0x70,
+    0x17, 0x46, 0x15, 0x45, 0x58, 0xA0, 0x6E, 0x88, 0x47, 0x76, 0x82, 0x9B, 0xD4, 0xF7, 0x11, 0x21,
+    0x1C, 0x9C, 0xAF, 0x70, 0x08, 0xE1, 0xB8, 0x44, 0xB1, 0xFF, 0x2E, 0xC2, 0x8F, 0x6D, 0x5E, 0x79,
+    0xA9, 0xD1, 0xCE, 0xD4, 0x68, 0x86, 0x7A, 0x69, 0xB5, 0x12, 0x1E, 0x94, 0x10, 0xB6, 0x30, 0x80,
+    0xCD, 0x47, 0x54, 0x0E, 0x11, 0x3C, 0xB7, 0xAA, 0x6D, 0x29, 0x47, 0xDB, 0xF0, 0x91, 0x6D, 0xD8,
+    0xCE, 0x76, 0x80, 0xA0, 0x02, 0xBF, 0x8D, 0x10, 0xAA, 0x82, 0x02, 0xEB, 0x99, 0x7B, 0x39, 0x4B,
+    0xB7, 0x10, 0x80, 0x8D, 0x2D, 0x1B, 0x2B, 0xDE, 0xE0, 0x42, 0x8D, 0x74, 0xDF, 0x53, 0x9B, 0x61,
+    0xB0, 0x88, 0xC0, 0xD1, 0x97, 0xC4, 0xE7, 0xDC, 0xC3, 0x58, 0x05, 0x28, 0x8D, 0x78, 0xCB, 0x35,
+    0xE4, 0xF5, 0xB4, 0x10, 0x8B, 0xDF, 0xAD, 0x5C, 0x58, 0x9C, 0xC3, 0xE8, 0x76, 0xAD, 0x4F, 0x43,
+    0x0D, 0x7F, 0x83, 0xF9, 0xBE, 0x28, 0x79, 0xB3, 0x3B, 0x75, 0xAE, 0x62, 0x6A, 0xAB, 0x13, 0xEB,
+    0xEB, 0x1C, 0x22, 0x8A, 0x25, 0x17, 0xA1, 0xE8, 0xC5, 0x89, 0xB8, 0x8A, 0xD8, 0xBF, 0x83, 0x47,
+    0x03, 0xC2, 0xBA, 0xB7, 0x0B, 0xB1, 0xB3, 0x0F, 0x67, 0xCD, 0x2F, 0x78, 0x2A, 0x31, 0x6F, 0xCC,
+    0x2D, 0xE5, 0x47, 0xE5, 0x0E, 0x7C, 0xAF, 0x67, 0xB7, 0xBF, 0xF1, 0xC8, 0x7B, 0xF8, 0x7C, 0x3B,
+    0x96, 0x2E, 0x19, 0xA6, 0xE8, 0xBF, 0x93, 0x8B, 0x93, 0x02, 0xCF, 0x14, 0x57, 0xE7, 0x4B, 0xB6,
+    0x79, 0xA0, 0x98, 0xDD, 0x3B, 0xD8, 0x4C, 0x82, 0x18, 0xCE, 0x40, 0xAF, 0x80, 0xAD, 0xED, 0xF4,
+    0x5F, 0x29, 0xE8, 0x3E, 0x83, 0xE1, 0xF0, 0xF6, 0x76, 0xFB, 0xDE, 0x26, 0x90, 0xFB, 0xB9, 0xC5,
+    0x1E, 0x07, 0x0B, 0x99, 0x44, 0xF3, 0xC4, 0xE5, 0x58, 0xDB, 0x8E, 0xCE, 0x03, 0x48, 0x1D, 0x7F,
+    0x6F, 0xA6, 0xAB, 0xA7, 0x21, 0x8B, 0x5C, 0x4E, 0x74, 0x5D, 0xEC, 0xC3, 0x71, 0xB3, 0x2E, 0x4B,
+    0x0B, 0x93, 0x03, 0xEB, 0xD2, 0xF5, 0x53, 0xAC, 0x8A, 0xF7, 0x71, 0x61, 0x67, 0x6F, 0x49, 0xEF,
+    0x82, 0xA2, 0x30, 0xC4, 0x2A, 0xFE, 0x27, 0xD1, 0x37, 0x3D, 0x50, 0x95, 0x38, 0x75, 0xB5, 0xB1,
+    0x24, 0xDB, 0x41, 0x12, 0xBA, 0xA9, 0xF7, 0x76, 0x6E, 0x67, 0x77, 0x9B, 0x2E, 0xF1, 0x65, 0xCD,
+    0xB3, 0x67, 0x3E, 0xE0, 0x12, 0x01, 0xD4, 0xF8, 0x7E, 0xFA, 0xA6, 0x95, 0xAD, 0xA8, 0xC7, 0x3F,
+    0xE1, 0x76, 0xA5, 0x0E, 0x28, 0xDD, 0x37, 0xD2, 0x0F, 0xEC, 0x54, 0xF7, 0xE0, 0xC4, 0xBA, 0xCD,
+    0xC0, 0x75, 0xF6, 0x43, 0x36, 0x18, 0xF2, 0x46, 0x54, 0x63, 0x97, 0x5E, 0xE0, 0x5F, 0x63, 0xA9,
+    0x95, 0x16, 0x32, 0x6B, 0x84, 0x9F, 0xF3, 0x5E, 0xE5, 0x12, 0x16, 0x30, 0x80, 0x81, 0x63, 0xED,
+    0xC4, 0x66, 0x3F, 0xFE, 0x2E, 0xCA, 0xEA, 0x95, 0xA5, 0xC5, 0xED, 0x55, 0xCA, 0xEB, 0x31, 0xAD,
+    0x01, 0xD1, 0xC8, 0xFB, 0x3B, 0x53, 0x19, 0x2B, 0xF6, 0x0B, 0xB3, 0xCC, 0x7D, 0xAE, 0xB2, 0xEA,
+    0xBF, 0x4A, 0x0C, 0x10, 0xA7, 0xBE, 0xD8, 0x13, 0x3B, 0x75, 0xA1, 0x72, 0x6B, 0x61, 0x72, 0x32,
+    0x38, 0x31, 0xBE, 0x07, 0x58, 0x50, 0xF7, 0x63, 0xC6, 0xF7, 0xB7, 0xC4, 0x78, 0x02, 0x9D, 0xF5,
+    0x8E, 0x71, 0xD6, 0xEB, 0x93, 0x94, 0xFD, 0x2C, 0x03, 0x80, 0xED, 0x13, 0x27, 0xF7, 0x23, 0x82,
+    0xD4, 0x38, 0x35, 0xC0, 0xF0, 0xF5, 0x52, 0x7B, 0x66, 0x1D, 0xE4, 0x56, 0x80, 0xD1, 0xD8, 0x80,
+    0x65, 0xB7, 0x79, 0x4E, 0xAB, 0xC4, 0x71, 0xE3, 0x74, 0x3F, 0x3D, 0xE5, 0x74, 0xCB, 0x2F, 0x8D,
+    0xBD, 0x77, 0x8F, 0xBC, 0x4F, 0x7F, 0x0D, 0x34, 0xE1, 0x15, 0xAC, 0x7D, 0x11, 0xBE, 0x1E, 0x73,
+    0x98, 0x68, 0x8D, 0x08, 0xF4, 0xCF, 0x91, 0xB8, 0xF1, 0x77, 0x4F, 0x44, 0xA0, 0xC5, 0x4F, 0xF8,
+    0xAB, 0xCE, 0x78, 0x6B, 0x2D, 0xFB, 0x70, 0x92, 0xED, 0x1F, 0xC6, 0xC0, 0xFE, 0x13, 0x31, 0xBD,
+    0xB4, 0xC7, 0x1D, 0x4B, 0x2F, 0x21, 0x9B, 0xB9, 0x7F, 0xAC, 0x98, 0x6C, 0x34, 0xA7, 0xAF, 0x6B,
+    0x01, 0x82, 0xA1, 0x2E, 0x3C, 0x9B, 0xBD, 0x2D, 0xAE, 0x39, 0xBD, 0x18, 0xAB, 0x60, 0xFC, 0x27,
+    0x9B, 0xAF, 0xF9, 0x42, 0xF6, 0xF6, 0x34, 0xA7, 0x87, 0x04, 0xF7, 0x3B, 0x6F, 0xE0, 0x9D, 0x88,
+    0x3A, 0xCD, 0xDE, 0xFF, 0x33, 0xD8, 0xDF, 0x3D, 0x65, 0x2A, 0xF3, 0x64, 0xB5, 0x98, 0xBD, 0x6D,
+    0x42, 0xE0, 0x63, 0x56, 0xD5, 0x69, 0x90, 0xDD, 0x48, 0x22, 0x99, 0x17, 0x81, 0xEA, 0xE5, 0x84,
+    0x6D, 0x79, 0xF3, 0x5F, 0x42, 0x93, 0xB2, 0xF9, 0xFF, 0x9B, 0x41, 0x6A, 0x8A, 0x24, 0xB3, 0xBF,
+    0x67, 0x4E, 0x2F, 0xFB, 0x48, 0x50, 0x70, 0xC1, 0x2C, 0x43, 0xCE, 0xBE, 0x6D, 0x07, 0x07, 0x4D,
+    0x81, 0xC6, 0x01, 0x5F, 0x34, 0xB5, 0xAB, 0x5D, 0xDF, 0x0E, 0xEA, 0x69, 0xF4, 0xD2, 0x68, 0x4B,
+    0x35, 0x09, 0x10, 0x0A, 0xE8, 0xEC, 0x1D, 0xC7, 0xEC, 0x46, 0xB9, 0x53, 0xB5, 0x46, 0xD6, 0xAF,
+    0xB7, 0x64, 0x3C, 0xA8, 0xAB, 0x10, 0xC9, 0xCE, 0x20, 0xA9, 0xAE, 0x0E, 0xB2, 0xA5, 0xF5, 0x58,
+    0x8F, 0xE1, 0xA5, 0xE6, 0xD9, 0xBF, 0x71, 0xBF, 0x3F, 0x6B, 0x9A, 0x3D, 0xE9, 0x39, 0xEB, 0x63,
+    0x14, 0xCD, 0x67, 0xA9, 0xE9, 0x3C, 0x9A, 0x98, 0x6C, 0xB1, 0xA6, 0xE5, 0x11, 0x3C, 0xD8, 0x05,
+    0xBE, 0x5F, 0xBB, 0xDF, 0x03, 0x1A, 0x7A, 0xD4, 0xE1, 0x68, 0x23, 0xCC, 0xAE, 0x0B, 0x4A, 0x65,
+    0x7C, 0x24, 0x54, 0x19, 0x10, 0x83, 0xDF, 0x6C, 0x37, 0x71, 0xD8, 0x4E, 0x20, 0x44, 0xD8, 0x8F,
+    0xC3, 0xF4, 0x07, 0x6C, 0x3B, 0x9D, 0xD2, 0x28, 0x93, 0x14, 0x20, 0xDB, 0xDA, 0x11, 0x86, 0xC1,
+    0x79, 0xA8, 0xF0, 0x2D, 0x33, 0xBD, 0x0E, 0xFB, 0xC4, 0xC9, 0xBF, 0xDD, 0xA6, 0x6C, 0x1D, 0x24,
+    0xE2, 0x1E, 0xEB, 0x4A, 0x6D, 0x62, 0xC5, 0xD8, 0x1A, 0x3B, 0x9C, 0x17, 0x3A, 0x88, 0x02, 0x47,
+    0x72, 0x31, 0x9E, 0x34, 0x5D, 0x5C, 0xBF, 0xD9, 0xC6, 0x63, 0x46, 0xC4, 0x22, 0x50, 0xF5, 0x5C,
+    0xE1, 0xA3, 0x7D, 0x44, 0xE7, 0xE0, 0x34, 0x54, 0xD4, 0x6B, 0x26, 0x86, 0x81, 0x29, 0x76, 0x37,
+    0x4B, 0x59, 0x83, 0x79, 0x72, 0x13, 0xE4, 0x27, 0xA6, 0x3A, 0x86, 0x40, 0x1F, 0xB2, 0xB2, 0x09,
+    0xF5, 0x49, 0x05, 0xBA, 0xA7, 0x76, 0x2C, 0xD9, 0xBD, 0x50, 0x63, 0x4F, 0xCF, 0x40, 0x22, 0x16,
+    0x92, 0x4A, 0x00, 0xA4, 0x6E, 0xA6, 0x67, 0x7D, 0x4C, 0x89, 0xFE, 0xCB, 0xEC, 0x02, 0x76, 0x28,
+    0xD6, 0xB8, 0xCB, 0xC0, 0x1C, 0x36, 0xB9, 0xBF, 0x99, 0xCA, 0x24, 0x46, 0x44, 0x67, 0x27, 0x41,
+    0xC6, 0x67, 0xF9, 0xA7, 0xE6, 0xAF, 0x90, 0xFF, 0x02, 0x85, 0x54, 0xBF, 0x6F, 0x1B, 0x37, 0x14,
+    0xFE, 0x4E, 0x27, 0x55, 0x69, 0x2F, 0xF6, 0x09, 0xAD, 0xDC, 0x18, 0x85, 0xED, 0xF3, 0x90, 0x02,
+    0xAE, 0xE2, 0xF8, 0x6E, 0xD0, 0x60, 0x03, 0x3A, 0x91, 0x99, 0x3B, 0x54, 0x83, 0xDD, 0xA1, 0x43,
+    0xA1, 0x21, 0x43, 0x61, 0x34, 0xAD, 0x06, 0x0D, 0x76, 0x21, 0xEB, 0x0E, 0xC9, 0x3F, 0xA0, 0x3F,
+    0xE1, 0x0A, 0xB4, 0x40, 0x22, 0x0F, 0xD1, 0x90, 0x00, 0x31, 0x60, 0x44, 0x9C, 0x33, 0xB1, 0x68,
+    0x81, 0xAC, 0x1C, 0x53, 0x78, 0xB9, 0xE1, 0x06, 0xA1, 0x90, 0x7D, 0x7D, 0x14, 0x65, 0x37, 0x4E,
+    0x80, 0x94, 0x8F, 0xC7, 0x23, 0xF9, 0x7E, 0xF0, 0xF1, 0xBD, 0xEF, 0x71, 0x09, 0x0C, 0x6E, 0x5C,
+    0x96, 0x48, 0x51, 0xB1, 0x5A, 0x76, 0xEA, 0x0A, 0x0F, 0x0D, 0x54, 0x80, 0x16, 0xEC, 0x29, 0x9C,
+    0x0B, 0x78, 0x6E, 0xDC, 0xB3, 0x55, 0x0B, 0x2D, 0x8B, 0x17, 0xDD, 0x6C, 0xA5, 0x99, 0x4F, 0xEB,
+    0x5E, 0x5A, 0x01, 0x67, 0xB9, 0x8C, 0x72, 0xB9, 0xB4, 0xC7, 0x6B, 0xC3, 0x61, 0xCC, 0xF2, 0x5C,
+    0xE8, 0x7F, 0x1B, 0x83, 0x6E, 0x41, 0xB2, 0x5C, 0xB8, 0x17, 0xDA, 0x42, 0xF5, 0xE8, 0x68, 0xA3,
+    0x68, 0x21, 0x2C, 0x8B, 0xA6, 0x23, 0x96, 0x0B, 0xFC, 0x02, 0x4F, 0x45, 0x41, 0xDA, 0xD2, 0x8F,
+    0x1B, 0xD8, 0x80, 0xA3, 0xB6, 0x4E, 0xB7, 0x37, 0xEB, 0x2B, 0x8D, 0x86, 0x97, 0x59, 0xDC, 0xE2,
+    0xBB, 0xCE, 0x1F, 0x99, 0xFB, 0x48, 0x6D, 0x39, 0xF1, 0x81, 0x8B, 0x4A, 0x91, 0xF4, 0x5B, 0x3D,
+    0x92, 0x75, 0x63, 0xF2, 0x82, 0x7C, 0xA1, 0x35, 0x1A, 0xD4, 0x36, 0x80, 0xD3, 0xA6, 0xA1, 0x1F,
+    0xBE, 0x5A, 0x2A, 0x71, 0xDF, 0x91, 0xEE, 0xA3, 0xD4, 0x96, 0x19, 0xD2, 0x86, 0x56, 0x4B, 0x60,
+    0x65, 0xBA, 0xB7, 0x93, 0x6B, 0xBE, 0x58, 0xBF, 0xC1, 0xCB, 0x79, 0xF3, 0x58, 0x74, 0x2D, 0x49,
+    0xEE, 0xDB, 0xA2, 0x2C, 0xDC, 0xD8, 0xE5, 0x3E, 0xDD, 0x9F, 0xA1, 0x0A, 0x47, 0xB8, 0xB4, 0xF6,
+    0xE0, 0x23, 0x9C, 0xDD, 0xBF, 0x49, 0xBB, 0x3E, 0x3C, 0xEE, 0x72, 0x27, 0xB6, 0x85, 0xC5, 0xE7,
+    0x7C, 0x92, 0xDF, 0x22, 0x7E, 0x15, 0xBB, 0x78, 0x49, 0x7C, 0x47, 0x14, 0x14, 0x45, 0xA6, 0xE5,
+    0x28, 0x37, 0x6E, 0xE2, 0x85, 0x76, 0x11, 0x96, 0xFA, 0x5C, 0x8D, 0xD5, 0xB7, 0xCA, 0x52, 0xE0,
+    0xC0, 0x33, 0x9C, 0xF0, 0xB1, 0x3A, 0x69, 0x3D, 0xD3, 0x31, 0xC5, 0x38, 0xDF, 0x7F, 0x0A, 0xF7,
+    0x8A, 0x60, 0xA7, 0x76, 0x5A, 0x96, 0xBE, 0xB8, 0x20, 0xAF, 0x4B, 0xCD, 0xEE, 0xA8, 0xDB, 0x2C,
+    0x15, 0xE8, 0x38, 0x5B, 0xDC, 0x79, 0xC3, 0xE8, 0xC6, 0xB5, 0xC7, 0x6C, 0xAA, 0x57, 0xB6, 0x20,
+    0x5D, 0xE8, 0x3F, 0x9B, 0xDE, 0x79, 0x63, 0x8B, 0x42, 0x5C, 0x7B, 0x1C, 0x9D, 0xEB, 0x3D, 0x2B,
+    0xBD, 0xA4, 0x5B, 0x29, 0x93, 0x8C, 0x0E, 0xCC, 0xAE, 0xE8, 0x9C, 0x47, 0xC2, 0x13, 0x08, 0x59,
+    0x88, 0xB7, 0x93, 0x70, 0x3D, 0xEC, 0x68, 0x86, 0xBD, 0x51, 0xCB, 0xC5, 0x1A, 0x3C, 0xA9, 0xCD,
+    0x1C, 0xAB, 0x9C, 0x5B, 0xE4, 0xDA, 0x5D, 0xBA, 0xE5, 0x01, 0x8E, 0x38, 0x93, 0x25, 0x6E, 0xC2,
+    0x5E, 0x1B, 0x3E, 0x66, 0xF9, 0xB4, 0x81, 0xC6, 0x36, 0x36, 0xA9, 0x57, 0x29, 0x08, 0x40, 0xA7,
+    0xB1, 0xB0, 0xF3, 0xB2, 0xE7, 0x9D, 0x65, 0x80, 0xC9, 0x97, 0xBA, 0x96, 0xAF, 0x4B, 0x10, 0xF9,
+    0x1E, 0x81, 0x48, 0x92, 0xC0, 0x3B, 0x00, 0x79, 0x27, 0x29, 0x04, 0x31, 0x2F, 0xDB, 0x7C, 0x1F,
+    0x62, 0x4B, 0x7B, 0x7B, 0x7C, 0x9C, 0xE7, 0x6A, 0x7F, 0x38, 0x1C, 0xE8, 0x5B, 0x5F, 0xC2, 0x4D,
+    0xCF, 0x35, 0x4F, 0xAF, 0xF5, 0x5F, 0x43, 0x74, 0xB2, 0xBA, 0x35, 0x9E, 0x6E, 0x3B, 0x19, 0xE9,
+    0xBF, 0x8D, 0x4C, 0x62, 0x1B, 0x23, 0xC6, 0xCC, 0xDC, 0x90, 0x23, 0x10, 0xC5, 0x85, 0x73, 0xF8,
+    0x92, 0x12, 0x8E, 0x22, 0x4C, 0xDB, 0x22, 0xA0, 0x01, 0x3D, 0x1D, 0x4B, 0x2A, 0x0B, 0xCA, 0x30,
+    0xC5, 0xBF, 0x2C, 0xE0, 0x72, 0x9D, 0xB2, 0xF7, 0x99, 0x52, 0x33, 0x9D, 0x4B, 0x66, 0x38, 0x63,
+    0xDE, 0xA7, 0xDB, 0x9D, 0xAE, 0x2E, 0xAE, 0x9E, 0xB6, 0x6E, 0x63, 0xD9, 0x04, 0x2C, 0xDC, 0xEB,
+    0x51, 0xFC, 0x96, 0xF6, 0x76, 0x67, 0x38, 0xB8, 0x78, 0xBE, 0xF7, 0xFD, 0x08, 0x8B, 0xD4, 0x69,
+    0xBE, 0x3F, 0x7C, 0x42, 0x9B, 0x14, 0xC5, 0x9D, 0xFE, 0x8F, 0x14, 0x51, 0x9A, 0x57, 0xF8, 0x73,
+    0xC5, 0x84, 0xCF, 0x23, 0x39, 0x52, 0xB4, 0xF4, 0x5F, 0x64, 0xBD, 0xBB, 0xEE, 0x4F, 0x13, 0x7C,
+    0xE8, 0xF6, 0x55, 0x44, 0x04, 0xD8, 0xB2, 0xB0, 0xA8, 0x94, 0xD1, 0xB2, 0xB3, 0xB2, 0x74, 0xE3,
+    0x90, 0xA6, 0xEF, 0x44, 0xB5, 0x06, 0x16, 0x97, 0x45, 0x39, 0x76, 0xB5, 0x7E, 0x0D, 0xE8, 0x57,
+    0x7A, 0xA7, 0x93, 0xA3, 0xC9, 0xA4, 0x9A, 0xAE, 0x13, 0x60, 0x37, 0xE8, 0x02, 0x21, 0x98, 0x06,
+    0x0E, 0xB5, 0x28, 0xCF, 0x65, 0x7F, 0x78, 0x2C, 0x0F, 0x50, 0x98, 0x7D, 0xF7, 0x61, 0x7D, 0x30,
+    0x01, 0xD7, 0x4A, 0x93, 0x70, 0xBF, 0xAF, 0x60, 0x88, 0x90, 0xFA, 0x4D, 0xD1, 0x3B, 0x9F, 0x79,
+    0x31, 0x4E, 0x2B, 0x8A, 0x6B, 0x4D, 0x8A, 0xE3, 0x91, 0x1E, 0x3F, 0x1A, 0xDC, 0xF4, 0xCF, 0x37,
+    0xC3, 0x68, 0xD2, 0x2D, 0x2B, 0x72, 0xC0, 0x6C, 0x9A, 0xE6, 0xC7, 0x69, 0x94, 0xAB, 0x34, 0x12,
+    0xF3, 0xF9, 0x3F, 0x7A, 0x4E, 0x00, 0xC5, 0x3D, 0x94, 0x1F, 0x4A, 0x3F, 0x9F, 0xB8, 0x67, 0x69,
+    0xE1, 0xE1, 0xCC, 0x0F, 0x7C, 0x42, 0x12, 0x7E, 0x6C, 0x2A, 0x2B, 0x12, 0x4C, 0x30, 0x69, 0xC6,
+    0x8E, 0x66, 0xD2, 0x58, 0xA2, 0xB1, 0x8D, 0x57, 0x01, 0x06, 0xB8, 0xC1, 0x3F, 0xA5, 0xBD, 0x9B,
+    0xB0, 0x69, 0x6C, 0x6B, 0x20, 0xB6, 0x69, 0x4C, 0x06, 0x73, 0x49, 0x09, 0x04, 0xB2, 0x43, 0x2E,
+    0x56, 0x64, 0x47, 0x73, 0xA5, 0x96, 0x49, 0x80, 0x1B, 0x28, 0x68, 0x2D, 0xFE, 0x19, 0xB0, 0x6E,
+    0xBD, 0xAA, 0x23, 0x36, 0x36, 0x8D, 0xD6, 0x2F, 0x71, 0x2D, 0xAE, 0xD1, 0x89, 0x91, 0x64, 0x52,
+    0xE7, 0x9F, 0x71, 0x47, 0x7A, 0xB2, 0x4F, 0xB6, 0x9D, 0x66, 0xB7, 0x1B, 0x7A, 0xB0, 0x76, 0xE1,
+    0xE6, 0x9C, 0x19, 0xAC, 0xA7, 0xDC, 0x3C, 0x52, 0xB3, 0x16, 0xC4, 0x11, 0x3D, 0x89, 0x4C, 0x1C,
+    0x4A, 0x4A, 0xC0, 0xC0, 0x21, 0xA5, 0x3E, 0x3C, 0x61, 0x0D, 0xDA, 0xF4, 0x77, 0xA4, 0x23, 0x23,
+    0xDE, 0x26, 0x0F, 0x5A, 0xFD, 0x42, 0xEA, 0xFC, 0x99, 0x39, 0xAF, 0x7B, 0xEC, 0xEB, 0xCD, 0xF6,
+    0xE2, 0x62, 0x37, 0x74, 0xDD, 0xB5, 0x03, 0x14, 0x9B, 0x6C, 0xD9, 0x16, 0xB7, 0xFE, 0x62, 0x53,
+    0x7A, 0x84, 0xD2, 0x8F, 0xDB, 0x06, 0x48, 0x87, 0x2F, 0x1F, 0x8C, 0x1A, 0x8B, 0xD4, 0x43, 0xAA,
+    0xCE, 0xD7, 0xD9, 0x36, 0xEA, 0x88, 0xD4, 0xBE, 0xB4, 0x84, 0x15, 0xCF, 0x42, 0xDB, 0xF0, 0xF4,
+    0x98, 0x39, 0x94, 0x19, 0x47, 0x59, 0xF9, 0xEF, 0xDF, 0xE5, 0x1C, 0x7E, 0x9E, 0x6B, 0x80, 0xED,
+    0x3F, 0x99, 0x87, 0xFF, 0x7F, 0x64, 0x74, 0x11, 0x25, 0xBA, 0xA0, 0xD4, 0x7F, 0x33, 0x68, 0x08,
+    0x14, 0x9D, 0xFC, 0x82, 0xDE, 0x0C, 0x7F, 0x38, 0xCE, 0xCF, 0xE8, 0x64, 0xEB, 0xE7, 0x5C, 0xEA,
+    0xB7, 0xAF, 0x3A, 0xD7, 0x33, 0x36, 0x8C, 0x3D, 0x63, 0xDB, 0x9C, 0xD3, 0x98, 0x43, 0x02, 0xB3,
+    0x28, 0xD3, 0x73, 0x27, 0x67, 0xD5, 0x9A, 0xE9, 0x6A, 0x3D, 0x56, 0xB3, 0x1D, 0x6E, 0xE2, 0x55,
+    0xE2, 0x5F, 0x2A, 0x74, 0xBE, 0x48, 0x93, 0x20, 0x19, 0xB1, 0x8E, 0x5E, 0xEF, 0x24, 0xED, 0x60,
+    0x9C, 0x25, 0xE8, 0xC0, 0x4B, 0x29, 0x39, 0xEB, 0x95, 0xCE, 0xAC, 0x69, 0xC6, 0xA0, 0x2E, 0x37,
+    0xE4, 0xED, 0x24, 0xA0, 0x12, 0xA7, 0x84, 0x0E, 0x02, 0x43, 0x49, 0x87, 0x51, 0x42, 0xAD, 0xD6,
+    0x5A, 0xBB, 0x8E, 0x80, 0x68, 0x1B, 0xDA, 0x15, 0x3D, 0x2D, 0x05, 0x87, 0xA9, 0x0C, 0x44, 0x20,
+    0x49, 0xC6, 0x27, 0x99, 0x01, 0x65, 0xFE, 0x57, 0x7E, 0x32, 0x4A, 0xEA, 0x86, 0x06, 0xF5, 0xD2,
+    0x3D, 0x7E, 0xF2, 0xF7, 0x28, 0xE9, 0xD4, 0x07, 0xC1, 0x55, 0xBF, 0x6D, 0xF1, 0x3E, 0xEF, 0xE0,
+    0x92, 0x2A, 0xD8, 0xC1, 0x21, 0xC5, 0xDC, 0x90, 0xA7, 0xA1, 0x84, 0x8D, 0x85, 0x95, 0x95, 0x85,
+    0x7A, 0x39, 0xB0, 0x93, 0x82, 0x40, 0x25, 0x48, 0x56, 0x85, 0x83, 0xC5, 0xB8, 0x2E, 0x93, 0xE0,
+    0x5F, 0xD5, 0x7C, 0x3D, 0x8C, 0x1C, 0x67, 0x7A, 0xE6, 0x57, 0x55, 0x9A, 0xE9, 0x5D, 0x15, 0x0E,
+    0xA5, 0x03, 0xC8, 0xB3, 0x4E, 0x04, 0x54, 0x0E, 0x14, 0x68, 0x05, 0x8A, 0x75, 0xC1, 0x05, 0x6B,
+    0x60, 0xBA, 0xAA, 0xB8, 0x02, 0x4E, 0xC1, 0x05, 0x9E, 0x03, 0xD8, 0x14, 0x70, 0x0C, 0xB8, 0x81,
+    0x02, 0x1E, 0xEF, 0xD6, 0xB3, 0x81, 0x0F, 0x58, 0xC0, 0xDD, 0xD3, 0x65, 0x28, 0xBC, 0xC0, 0x03,
+    0x58, 0x1B, 0x39, 0x30, 0x03, 0x06, 0x52, 0xEB, 0x70, 0xE3, 0xC0, 0xC1, 0x2C, 0x50, 0x3D, 0x55,
+    0x36, 0x03, 0x07, 0x0E, 0x5C, 0x0B, 0x99, 0x91, 0x83, 0x2D, 0x59, 0x43, 0x2C, 0xC0, 0x05, 0x4E,
+    0xE5, 0x55, 0x13, 0xAA, 0xA1, 0xBA, 0xBB, 0xEE, 0x79, 0xDE, 0xAF, 0xAA, 0x7F, 0x66, 0xBA, 0xF9,
+    0x23, 0x72, 0xC6, 0x7B, 0x3D, 0xF3, 0xBD, 0x5F, 0x77, 0xFD, 0x7E, 0x3F, 0xEF, 0xFF, 0xFB, 0x7E,
+    0x9F, 0xB1, 0xAD, 0x94, 0x51, 0x2A, 0xA5, 0x7A, 0x28, 0x1E, 0x8A, 0x1D, 0xE1, 0x40, 0xA8, 0xF8,
+    0x09, 0xAA, 0x2A, 0x64, 0xF1, 0x3B, 0x1D, 0xD5, 0xC6, 0xEF, 0x55, 0x05, 0xE7, 0xA5, 0xF8, 0x9D,
+    0x6B, 0x6B, 0xAF, 0xE1, 0xFD, 0xCD, 0xB3, 0x54, 0xF8, 0x9A, 0xB2, 0xF2, 0x52, 0x59, 0x45, 0xA9,
+    0x8C, 0xEC, 0x8F, 0x55, 0xF3, 0x39, 0x8B, 0x77, 0x25, 0x55, 0x35, 0x56, 0x02, 0x3A, 0x7D, 0xDC,
+    0x22, 0xDD, 0x5B, 0x0D, 0xDE, 0xB8, 0x0B, 0x50, 0x55, 0xA9, 0xF2, 0x1E, 0xEF, 0x17, 0x38, 0x66,
+    0x96, 0x3C, 0x31, 0x26, 0xE8, 0x2D, 0x83, 0x61, 0x73, 0xC2, 0x1A, 0x29, 0xAF, 0x55, 0xE5, 0x04,
+    0x1C, 0x2D, 0x0C, 0xA3, 0xC2, 0x2B, 0xCC, 0x91, 0x52, 0xAD, 0x5C, 0x29, 0x07, 0xA3, 0x78, 0x05,
+    0x87, 0x2E, 0xCC, 0x7A, 0x57, 0xB7, 0x7C, 0x7D, 0xEF, 0x9E, 0xB7, 0xE8, 0xCF, 0x66, 0x75, 0xAC,
+    0x54, 0x1F, 0x9D, 0x35, 0xAA, 0xED, 0x1D, 0x36, 0x0A, 0xEF, 0xCE, 0x00, 0xDC, 0xA8, 0xE9, 0x5C,
+    0x40, 0xE0, 0xD7, 0xAD, 0xC8, 0x6B, 0xD0, 0xE9, 0x6C, 0xD7, 0xC7, 0x66, 0xC0, 0xE3, 0x1D, 0x4E,
+    0x4A, 0x14, 0x28, 0x00, 0xAC, 0x69, 0x78, 0x49, 0x71, 0xF4, 0xF0, 0xBB, 0x9A, 0xE0, 0xC0, 0x45,
+    0xFD, 0x42, 0x23, 0x99, 0xE2, 0x40, 0x95, 0xBA, 0xD9, 0x8D, 0x28, 0xA8, 0x9F, 0xDC, 0xAE, 0xEB,
+    0x00, 0x23, 0xE1, 0xA2, 0xF7, 0x32, 0x24, 0xC9, 0x88, 0x77, 0xE2, 0x68, 0x3F, 0xD5, 0x6D, 0xB2,
+    0xF2, 0x79, 0xB1, 0xB3, 0x5F, 0xA8, 0x9D, 0x94, 0x4F, 0xF7, 0xAA, 0x91, 0x0C, 0x53, 0x7B, 0xD5,
+    0xE7, 0x15, 0x1C, 0xF6, 0x7B, 0xEF, 0x6E, 0xF1, 0xC5, 0x56, 0xF6, 0xAC, 0x7F, 0xCA, 0x0D, 0x5F,
+    0xF4, 0x1F, 0x23, 0xD7, 0x57, 0xFD, 0x89, 0xEA, 0x8F, 0xD4, 0x1B, 0xA1, 0x8C, 0x5C, 0xAA, 0x66,
+    0x95, 0xDF, 0xB9, 0x91, 0x4A, 0xAF, 0x5B, 0xA7, 0xAB, 0x2D, 0x5D, 0x75, 0x67, 0xD5, 0xE3, 0x4F,
+    0xA5, 0xAA, 0xAA, 0x8C, 0xD5, 0xC3, 0xFD, 0x52, 0xC5, 0x3C, 0x37, 0xD1, 0x95, 0xAF, 0xAB, 0x40,
+    0x1D, 0xB0, 0xF2, 0x54, 0xA9, 0x7F, 0x8D, 0xE4, 0x9C, 0x51, 0xB0, 0x1A, 0xBE, 0x8F, 0xEA, 0xFE,
+    0x8D, 0x12, 0x0F, 0xC0, 0x53, 0xF2, 0x2A, 0x42, 0x35, 0x6D, 0x10, 0xAB, 0x3D, 0x9B, 0x80, 0xE7,
+    0xAB, 0x80, 0x88, 0xFD, 0x4E, 0xC8, 0x0E, 0x55, 0x98, 0x5C, 0xA9, 0xAA, 0x54, 0xCE, 0x39, 0xB9,
+    0x54, 0x56, 0x21, 0x95, 0x31, 0xD2, 0x37, 0x8C, 0x16, 0x7F, 0x99, 0xBA, 0x6A, 0xF1, 0x92, 0xA0,
+    0xB3, 0x93, 0xB5, 0x35, 0xF9, 0x4A, 0x75, 0xA4, 0x9E, 0x83, 0xEA, 0x3E, 0x5D, 0x4B, 0x75, 0xDD,
+    0x19, 0xE8, 0xAD, 0x07, 0x82, 0x92, 0x43, 0xA0, 0xE4, 0x88, 0xD8, 0xA1, 0x59, 0xD7, 0xC6, 0x6C,
+    0x5C, 0xE2, 0xB6, 0xB4, 0x97, 0x1D, 0xB1, 0xD1, 0x35, 0x17, 0xED, 0xF3, 0x71, 0x7C, 0xAC, 0xDA,
+    0xB8, 0xBE, 0x6D, 0x91, 0x12, 0x52, 0x29, 0xFE, 0x07, 0xB9, 0x6A, 0x83, 0x70, 0xE5, 0x9C, 0xDA,
+    0x45, 0xF1, 0x70, 0xAD, 0x83, 0x7B, 0x5A, 0x18, 0x0B, 0xE9, 0xEC, 0x18, 0x65, 0x57, 0x3F, 0x5B,
+    0x28, 0x84, 0x28, 0x8C, 0x41, 0x51, 0x32, 0xC5, 0xF8, 0xBC, 0xA2, 0x66, 0xAF, 0xE5, 0xBB, 0x94,
+    0x4B, 0x10, 0x10, 0x24, 0x00, 0xC6, 0x37, 0x00, 0xD6, 0xAF, 0x01, 0xEC, 0xBF, 0x63, 0x4B, 0xDE,
+    0x07, 0xF0, 0x5B, 0x00, 0x31, 0xC1, 0x08, 0xC0, 0xCA, 0x01, 0x5A, 0x29, 0x80, 0x13, 0x02, 0x04,
+    0x98, 0xF7, 0x36, 0x51, 0xA8, 0x4D, 0x7C, 0x08, 0x88, 0x06, 0x41, 0x4A, 0x10, 0x11, 0x28, 0x62,
+    0xC5, 0x05, 0x72, 0x1C, 0xDF, 0x04, 0xA5, 0xBA, 0x7F, 0xC1, 0xAE, 0x57, 0x91, 0x66, 0x40, 0xF2,
+    0x89, 0xD9, 0x42, 0xCC, 0x5A, 0x2B, 0xF3, 0xD8, 0x60, 0x30, 0x23, 0x37, 0xB4, 0x89, 0x5E, 0x68,
+    0x37, 0xA6, 0xAF, 0xE0, 0x05, 0x25, 0xFE, 0x54, 0xCC, 0xA1, 0xF3, 0x2D, 0x3C, 0xC5, 0x6B, 0xE1,
+    0x29, 0xCE, 0xFF, 0x42, 0xE7, 0xEC, 0x5F, 0x01, 0xE1, 0x2D, 0x12, 0xAE, 0x39, 0xE5, 0xC3, 0xC6,
+    0xAA, 0x96, 0x10, 0xBC, 0x4C, 0xB9, 0xCD, 0xCB, 0x6C, 0x39, 0x19, 0xEA, 0x4E, 0x3B, 0xE1, 0x99,
+    0x00, 0x60, 0xE9, 0x4D, 0x72, 0xF2, 0x4A, 0x03, 0xB6, 0x5C, 0x9D, 0x04, 0xC6, 0x1D, 0xB6, 0x83,
+    0xED, 0x33, 0xD8, 0x52, 0x8B, 0xAC, 0xCA, 0xFA, 0x8A, 0x5C, 0xEC, 0x1F, 0x38, 0x5B, 0x7F, 0x86,
+    0xA6, 0xBA, 0xE8, 0xBB, 0x0A, 0x88, 0x21, 0x6D, 0xF6, 0x21, 0x06, 0x5D, 0x49, 0xF7, 0xD1, 0xF9,
+    0x58, 0x99, 0x24, 0x00, 0xAB, 0x02, 0x49, 0xB5, 0x1E, 0x0E, 0x12, 0x4E, 0xAF, 0x13, 0x82, 0x01,
+    0x38, 0xA9, 0xC7, 0xF1, 0xF3, 0x39, 0x92, 0x5D, 0xBE, 0x6A, 0x4C, 0x3C, 0x23, 0x03, 0x40, 0xC9,
+    0xD0, 0xB0, 0x70, 0xA5, 0x84, 0x1A, 0x6C, 0x03, 0xA5, 0xA6, 0xA8, 0x49, 0x4D, 0x76, 0xA1, 0xD1,
+    0x8F, 0x68, 0xD8, 0x14, 0x13, 0xBF, 0x5B, 0x85, 0x0F, 0xAA, 0xD1, 0x52, 0xEA, 0x48, 0xE9, 0x52,
+    0xA5, 0x7E, 0x67, 0x9F, 0xD7, 0x13, 0xDD, 0xCA, 0x79, 0xE1, 0xF5, 0x76, 0x8E, 0x67, 0x86, 0x2C,
+    0xBE, 0xBA, 0xC1, 0xE7, 0x8D, 0x35, 0x7A, 0xAB, 0x5E, 0x5D, 0x88, 0xEA, 0x63, 0x9C, 0x63, 0xFB,
+    0xF0, 0xDC, 0xC9, 0xD9, 0xC8, 0x1B, 0xA7, 0xAA, 0x88, 0x6E, 0x15, 0x19, 0xB6, 0xFB, 0xF3, 0xEB,
+    0x84, 0x42, 0x7A, 0x8B, 0xD0, 0x3B, 0x05, 0xAF, 0x08, 0xF4, 0x17, 0x60, 0x5B, 0x60, 0x4F, 0x60,
+    0x2C, 0x50, 0xA6, 0x42, 0xFF, 0x63, 0x82, 0x00, 0x2F, 0x3D, 0xE8, 0x5C, 0x7F, 0x44, 0xF9, 0x8D,
+    0x71, 0xD1, 0x30, 0xE6, 0x8C, 0xAE, 0x80, 0x1F, 0x52, 0x06, 0x46, 0x67, 0xA1, 0x3D, 0x90, 0xEB,
+    0x91, 0x82, 0x42, 0x54, 0xA0, 0xA1, 0x14, 0x95, 0x10, 0xD0, 0x08, 0x9C, 0x00, 0xDC, 0x62, 0x44,
+    0xC2, 0x18, 0xAB, 0x11, 0x91, 0xD0, 0x07, 0x11, 0x83, 0x23, 0x78, 0xE1, 0x88, 0xDC, 0xC1, 0x49,
+    0x47, 0xE4, 0x6F, 0x82, 0x53, 0xB3, 0xCA, 0xB9, 0x7F, 0xDC, 0x57, 0xB3, 0x4B, 0xC0, 0xE1, 0x49,
+    0x6F, 0xB8, 0x9D, 0xFD, 0x2D, 0xE5, 0x61, 0xF8, 0x36, 0x02, 0x37, 0xB3, 0x33, 0x54, 0x01, 0xE5,
+    0xF7, 0x08, 0x20, 0x60, 0x23, 0xEC, 0x6C, 0xC8, 0x4A, 0xE8, 0x4F, 0x5D, 0xC2, 0xF0, 0x43, 0xDE,
+    0xAB, 0x3F, 0xD0, 0x72, 0x35, 0x25, 0x96, 0xCE, 0x0B, 0x7F, 0xF7, 0xF1, 0xCE, 0x52, 0x8A, 0xEA,
+    0x24, 0xA4, 0xD4, 0x4C, 0xD3, 0xAE, 0x59, 0x17, 0x7E, 0x6F, 0xE5, 0x47, 0x90, 0xBF, 0x24, 0xAA,
+    0x3E, 0xAF, 0xBB, 0x70, 0xBE, 0xAC, 0x0B, 0x5C, 0xA3, 0x4B, 0x72, 0x0C, 0x6E, 0xB2, 0x0B, 0x54,
+    0x16, 0x8C, 0x6B, 0xE7, 0xCD, 0x41, 0xCF, 0x44, 0x42, 0x90, 0xFE, 0xB4, 0x86, 0x05, 0x1D, 0x01,
+    0xF7, 0x10, 0x5F, 0xE6, 0x60, 0x8B, 0xA0, 0xBB, 0x02, 0xC4, 0xCB, 0xE0, 0x80, 0xA0, 0xD4, 0xB8,
+    0x66, 0xE5, 0xE0, 0x56, 0x56, 0xFE, 0x3E, 0x01, 0x9E, 0x6D, 0x51, 0xFE, 0x5B, 0xB9, 0x48, 0xFF,
+    0x80, 0xAC, 0x2D, 0x47, 0xB7, 0x94, 0x97, 0x07, 0x40, 0xBF, 0x20, 0xF7, 0x31, 0xB3, 0xFD, 0xBC,
+    0x0D, 0x8A, 0xFA, 0x26, 0xDF, 0x02, 0x51, 0x7D, 0x9D, 0x6F, 0x75, 0x95, 0xF9, 0x65, 0xBE, 0x85,
+    0xD7, 0x7F, 0x9E, 0xB7, 0x3D, 0xD5, 0xBA, 0x97, 0xB7, 0x5D, 0xE5, 0x7C, 0x94, 0xB7, 0x9D, 0xC8,
+    0xB1, 0xF2, 0xB6, 0x9D, 0x7A, 0x80, 0x56, 0xD6, 0x26, 0xCC, 0xBB, 0x80, 0x46, 0x71, 0x00, 0xA8,
+    0x46, 0x23, 0xC2, 0x61, 0x41, 0xD8, 0xCF, 0x09, 0x83, 0x94, 0xD0, 0x8B, 0x08, 0x9D, 0x90, 0x10,
+    0xF2, 0x96, 0x5C, 0x3A, 0x7D, 0x06, 0x40, 0xF6, 0xAD, 0x01, 0x59, 0x7A, 0xFA, 0xAC, 0xB7, 0xB5,
+    0x6B, 0x71, 0x4B, 0x4A, 0xC7, 0x98, 0x02, 0xEF, 0xA7, 0x10, 0x4A, 0x61, 0x92, 0xB6, 0x0A, 0x30,
+    0x45, 0x9C, 0xB2, 0x0A, 0xB0, 0x6A, 0xA3, 0x24, 0xB9, 0x8D, 0xA9, 0x8C, 0xC6, 0xD4, 0x6D, 0x7A,
+    0xAB, 0x80, 0x9C, 0x25, 0x18, 0xE3, 0x0E, 0x55, 0xCA, 0xBD, 0xF2, 0x14, 0x73, 0x42, 0x42, 0x4A,
+    0x48, 0xA4, 0x36, 0x39, 0x1B, 0x69, 0x61, 0x26, 0x72, 0x22, 0x36, 0x57, 0x7A, 0x79, 0x36, 0x20,
+    0xA8, 0xEE, 0x68, 0x9E, 0x74, 0x9D, 0x58, 0x6E, 0xE7, 0x1A, 0x19, 0xCD, 0x85, 0x22, 0xC8, 0x09,
+    0x79, 0x93, 0x44, 0x22, 0x57, 0xAA, 0xBD, 0x33, 0xB0, 0x0B, 0x56, 0x81, 0x67, 0xB3, 0x0B, 0xA6,
+    0xDA, 0x2E, 0x20, 0x8B, 0x66, 0xE9, 0xDC, 0x78, 0xD0, 0x11, 0x4D, 0xEC, 0x25, 0x94, 0xF3, 0xD5,
+    0x61, 0x9A, 0x8F, 0x3B, 0x87, 0xC6, 0xCE, 0xC7, 0x4A, 0x86, 0x10, 0x54, 0x87, 0xDE, 0x95, 0xD0,
+    0x8C, 0x5D, 0x95, 0x80, 0xF2, 0x5D, 0x14, 0x30, 0x68, 0x34, 0xAA, 0x07, 0x68, 0xA7, 0x5D, 0xC0,
+    0x56, 0xB6, 0x08, 0xF5, 0x71, 0x7D, 0x8D, 0x17, 0xF1, 0x7A, 0xDC, 0x6B, 0x4C, 0xF9, 0x9C, 0xA4,
+    0xAC, 0x9F, 0x59, 0x3F, 0x7F, 0xF1, 0x8D, 0xA2, 0x60, 0xFA, 0xFC, 0x01, 0xA1, 0xE3, 0x73, 0xCC,
+    0x61, 0x1C, 0xE4, 0xE8, 0x9E, 0x59, 0x50, 0xE1, 0x1C, 0x53, 0x8D, 0xE9, 0x11, 0x7D, 0x3D, 0x4E,
+    0x91, 0xC3, 0x4E, 0xB5, 0x38, 0xB1, 0x7A, 0x76, 0xF9, 0xD3, 0xDD, 0xE5, 0x13, 0x38, 0xBD, 0x31,
+    0xEE, 0x36, 0x28, 0x95, 0xAC, 0x1C, 0x63, 0x85, 0x3B, 0xC7, 0x34, 0x6B, 0x7A, 0x9C, 0xD2, 0x80,
+    0x43, 0xE7, 0x46, 0x67, 0xAB, 0xB6, 0x7D, 0x4C, 0xF2, 0x99, 0x08, 0x50, 0x0D, 0x62, 0x9E, 0x00,
+    0x6F, 0x1F, 0x28, 0x75, 0x40, 0x21, 0xBA, 0xAE, 0xA0, 0x99, 0xE3, 0x1E, 0x29, 0x7B, 0xEF, 0xD2,
+    0x18, 0x6A, 0xC7, 0xD8, 0xAC, 0x8E, 0xC7, 0xF5, 0x64, 0xAE, 0x2D, 0x6D, 0x91, 0x94, 0x59, 0x5B,
+    0x0B, 0xEF, 0xF3, 0xAE, 0xD0, 0xF3, 0xE3, 0xCE, 0x8D, 0x4C, 0xDB, 0x53, 0x4D, 0x05, 0x29, 0x53,
+    0x08, 0xAF, 0xC4, 0x44, 0x90, 0xA7, 0x9D, 0x6F, 0xE5, 0x43, 0x93, 0xEA, 0xDC, 0xFC, 0x47, 0xDD,
+    0x96, 0x69, 0x5D, 0x69, 0x64, 0xF7, 0x9F, 0x50, 0xFD, 0x20, 0xE1, 0x45, 0x02, 0x3A, 0xBB, 0x4F,
+    0xE6, 0x14, 0x83, 0x3D, 0xAD, 0x5C, 0xE1, 0x5B, 0x42, 0xE3, 0x15, 0x6C, 0x22, 0xE0, 0xBB, 0x03,
+    0x6A, 0x72, 0xA2, 0xC0, 0xD4, 0xDF, 0x4C, 0x02, 0x30, 0x5D, 0xDA, 0x8C, 0xA2, 0x66, 0x89, 0xEE,
+    0x4B, 0x5C, 0xF0, 0x9E, 0x01, 0xF0, 0x3D, 0x1E, 0x99, 0xA0, 0xE7, 0x43, 0xBB, 0xF6, 0xC8, 0x2E,
+    0x3D, 0xF2, 0x47, 0x8F, 0x1D, 0x5D, 0x02, 0x72, 0x0C, 0x67, 0xFD, 0x4E, 0x3F, 0xF5, 0xD8, 0x32,
+    0x8F, 0xEF, 0xF1, 0x9E, 0xC6, 0x38, 0xF9, 0x02, 0xAD, 0xBC, 0x3F, 0x91, 0x19, 0xE7, 0x7C, 0xAC,
+    0x56, 0x26, 0x8F, 0xF4, 0x58, 0x5D, 0xE2, 0x17, 0xF2, 0x5A, 0xE5, 0x5F, 0xED, 0x93, 0xC9, 0xB6,
+    0x8A, 0xC6, 0x1C, 0xA1, 0x79, 0x4A, 0xC5, 0x60, 0xCE, 0x51, 0x61, 0x6F, 0x54, 0x54, 0x0A, 0x2B,
+    0x65, 0xC0, 0x06, 0x5F, 0x66, 0xB5, 0x7E, 0x73, 0x87, 0xDC, 0x8B, 0xA7, 0x7C, 0xA8, 0x30, 0x52,
+    0xF2, 0x64, 0x8F, 0x6A, 0x5A, 0x63, 0xF5, 0xD7, 0x24, 0xD4, 0x9F, 0x86, 0x74, 0x3B, 0x50, 0xDD,
+    0x80, 0xF6, 0x72, 0x74, 0x89, 0xCA, 0x49, 0x10, 0xAA, 0x43, 0x54, 0x43, 0x3E, 0x91, 0xEA, 0x0A,
+    0x09, 0x9D, 0x0C, 0x12, 0xF8, 0x40, 0xDD, 0x0F, 0x7A, 0x0E, 0x59, 0xA0, 0x0D, 0xDC, 0xA4, 0x16,
+    0xD8, 0x54, 0xFE, 0x07, 0x52, 0xC9, 0x39, 0x54, 0xF5, 0x95, 0xF5, 0x7D, 0x64, 0xB2, 0x64, 0x17,
+    0xB1, 0x7E, 0x26, 0x5A, 0xCA, 0x37, 0xB8, 0x79, 0x6B, 0xAC, 0xDF, 0x5E, 0xB0, 0x2D, 0x89, 0x78,
+    0xC1, 0xB4, 0xE7, 0x70, 0x13, 0x83, 0x08, 0x71, 0x60, 0x4D, 0x7F, 0xDE, 0xE7, 0x6C, 0x83, 0x13,
+    0x2D, 0x15, 0xE8, 0xA3, 0x81, 0x55, 0xAA, 0xC0, 0xA8, 0x1E, 0x27, 0xB4, 0xFF, 0x95, 0xFD, 0xA0,
+    0x2F, 0xAA, 0x2E, 0xFF, 0x86, 0x28, 0x38, 0x87, 0x86, 0xC8, 0x75, 0xBC, 0x9E, 0x2C, 0xCB, 0x48,
+    0x72, 0x58, 0x1E, 0x13, 0xE5, 0xEC, 0x71, 0xC8, 0xE8, 0x5D, 0xA3, 0x44, 0x02, 0x5B, 0xDB, 0xB8,
+    0x99, 0x9A, 0xF4, 0x46, 0x3D, 0xBE, 0x09, 0x7E, 0x4B, 0xA3, 0x80, 0xC5, 0x41, 0x71, 0xD3, 0x5D,
+    0xC5, 0x79, 0xFA, 0x75, 0x6A, 0x57, 0xEF, 0xA5, 0xE2, 0x9F, 0xA3, 0x97, 0xCE, 0x4C, 0xF0, 0xE4,
+    0xAA, 0x30, 0xAA, 0x8F, 0x65, 0x96, 0xF8, 0x24, 0xF2, 0xDE, 0x2B, 0x68, 0x78, 0xDB, 0x9B, 0xAA,
+    0x36, 0x9E, 0xD5, 0xCF, 0xEC, 0xA2, 0x0F, 0x64, 0xC5, 0xAC, 0x95, 0x3D, 0xCD, 0x82, 0xE2, 0x9E,
+    0x36, 0xB8, 0x60, 0x64, 0xA9, 0x31, 0xEC, 0x9A, 0xD2, 0x0D, 0xAD, 0xC2, 0xC9, 0xED, 0x0C, 0x13,
+    0x19, 0xA9, 0x64, 0x22, 0x1D, 0xBF, 0x0D, 0xFC, 0x49, 0xD0, 0xC6, 0xE1, 0xF5, 0x04, 0x63, 0xE5,
+    0x46, 0x68, 0x07, 0x4B, 0x18, 0x1B, 0x7D, 0x1C, 0x1F, 0x89, 0x8E, 0x11, 0x43, 0x9C, 0xC6, 0x4B,
+    0xED, 0xDC, 0x89, 0x28, 0x4B, 0x13, 0xA0, 0xD0, 0xED, 0xC1, 0x9D, 0xA4, 0x2A, 0x0E, 0x07, 0x77,
+    0x62, 0xB1, 0xE0, 0x9F, 0xFA, 0x8F, 0x1B, 0x3E, 0xE1, 0xC0, 0x63, 0x92, 0x0F, 0x07, 0x00, 0x07,
+    0xF4, 0x45, 0xCC, 0xC1, 0x68, 0x19, 0x14, 0x00, 0x06, 0x81, 0x29, 0x4A, 0x27, 0xBD, 0x51, 0x22,
+    0x60, 0x28, 0xB7, 0x33, 0x01, 0x94, 0xB8, 0x27, 0x81, 0xC6, 0xB5, 0x1D, 0x88, 0x11, 0x0E, 0x7E,
+    0xDE, 0x0F, 0x21, 0xCA, 0x52, 0x5F, 0x44, 0x9C, 0x95, 0xF7, 0x3A, 0x1F, 0xE4, 0xB8, 0xB3, 0x48,
+    0x06, 0xD2, 0x66, 0x71, 0x21, 0xFB, 0x62, 0xE4, 0x50, 0xD9, 0x30, 0xD2, 0x16, 0x7D, 0x3B, 0x44,
+    0x0C, 0x0C, 0xCE, 0x0F, 0xD4, 0xAB, 0xCA, 0x8C, 0x3C, 0x0C, 0x07, 0x65, 0xB9, 0x13, 0x42, 0x17,
+    0xCD, 0x28, 0x2E, 0xCC, 0xC2, 0x09, 0x4B, 0x2A, 0x64, 0x3F, 0xC2, 0x6C, 0xB4, 0x9D, 0xF7, 0x33,
+    0x71, 0x09, 0x45, 0x8D, 0xAF, 0xAD, 0xE7, 0xBE, 0x9F, 0xCB, 0x59, 0x9A, 0x3F, 0x4E, 0x38, 0x96,
+    0xBB, 0x76, 0xA9, 0x0F, 0xE0, 0x09, 0x81, 0x3C, 0xAD, 0x07, 0xD8, 0xCA, 0x37, 0xA1, 0x19, 0x79,
+    0x68, 0xE3, 0x9B, 0x57, 0x13, 0xCA, 0xC1, 0x50, 0x17, 0x48, 0x42, 0x63, 0x08, 0x92, 0xCB, 0x51,
+    0xC6, 0x35, 0x95, 0x35, 0xC8, 0xE3, 0xA4, 0x6F, 0x81, 0x5A, 0x84, 0xA1, 0xD4, 0x2E, 0xC8, 0x5B,
+    0x6A, 0x73, 0x0F, 0x93, 0x92, 0xC7, 0x50, 0xA5, 0x63, 0xA8, 0xBD, 0x31, 0xD4, 0xE8, 0xD8, 0xFC,
+    0x3A, 0x8F, 0xAD, 0x7B, 0x79, 0x6C, 0x7F, 0x94, 0xC7, 0xAE, 0x95, 0xC7, 0xD0, 0x93, 0x63, 0x28,
+    0xCA, 0x31, 0x14, 0xE4, 0x43, 0x28, 0xC6, 0x09, 0xD4, 0xE2, 0x04, 0x4A, 0x71, 0x42, 0x41, 0x1B,
+    0xFD, 0x7B, 0x65, 0x91, 0xEF, 0x3E, 0xC2, 0xBB, 0x80, 0x67, 0x8D, 0x33, 0xEA, 0x45, 0x9F, 0x7B,
+    0x4B, 0xBD, 0x1A, 0x02, 0x71, 0x30, 0x59, 0x3D, 0x94, 0x52, 0xC5, 0xD4, 0x7E, 0xA0, 0xEB, 0xC4,
+    0xE8, 0x4A, 0x52, 0x29, 0x29, 0x94, 0xF7, 0x31, 0xC4, 0xBD, 0x9C, 0x03, 0xDD, 0xC7, 0x60, 0x3A,
+    0xFA, 0x1E, 0x9C, 0x18, 0x0C, 0xEE, 0xAA, 0x0A, 0x0C, 0xE4, 0xF1, 0xA0, 0x04, 0x1E, 0xCC, 0x8A,
+    0x71, 0xA2, 0x98, 0x2C, 0xB0, 0x3C, 0x30, 0xED, 0x25, 0x48, 0xAB, 0xAC, 0x58, 0xB4, 0x6F, 0x45,
+    0xDD, 0x06, 0x59, 0xDF, 0x49, 0x42, 0xE5, 0x14, 0xE0, 0xF1, 0x6E, 0x91, 0x80, 0x36, 0x8B, 0xC3,
+    0x5C, 0xED, 0x16, 0xC3, 0x42, 0xFD, 0xA2, 0x88, 0x4B, 0xF5, 0xA8, 0x88, 0xBB, 0xE6, 0xBF, 0x14,
+    0xE8, 0xC7, 0x2F, 0x8B, 0xD8, 0x6B, 0xFD, 0x4D, 0x11, 0x3B, 0xCE, 0x9F, 0x02, 0xFC, 0x99, 0x51,
+    0xC4, 0xAD, 0xFF, 0x0B, 0x60, 0x4D, 0x00, 0xCC, 0x31, 0x80, 0x1A, 0x19, 0xC5, 0x2D, 0x65, 0x62,
+    0x4C, 0x88, 0x65, 0x27, 0x4B, 0x8B, 0xD8, 0x28, 0x65, 0xF5, 0x79, 0x5D, 0xD4, 0xCE, 0x11, 0xB9,
+    0xA8, 0x72, 0x8E, 0x76, 0x52, 0x0F, 0xC4, 0x48, 0x11, 0x03, 0xFC, 0x2B, 0xBB, 0xB5, 0xDE, 0x10,
+    0xCF, 0xF5, 0x87, 0x92, 0x6E, 0x07, 0x8F, 0xF8, 0x93, 0x39, 0x0B, 0x04, 0x4B, 0xFA, 0x19, 0x90,
+    0xF8, 0xD2, 0xC3, 0xC1, 0x67, 0x29, 0xDD, 0xB0, 0xCF, 0x5B, 0x3E, 0x74, 0x8F, 0x54, 0x4C, 0xE2,
+    0x3D, 0xEA, 0xA7, 0x09, 0x78, 0xEA, 0x21, 0xDE, 0x11, 0x03, 0xA3, 0xE9, 0xD4, 0x58, 0x2E, 0x66,
+    0x31, 0xC4, 0xB9, 0x04, 0xDA, 0x5C, 0x92, 0xBA, 0xE9, 0x21, 0x18, 0x7A, 0xDC, 0xC7, 0x1C, 0x81,
+    0x2E, 0x62, 0xED, 0xAE, 0x3B, 0x55, 0x94, 0x77, 0x4C, 0x51, 0xA1, 0x9C, 0x47, 0xFF, 0x55, 0x74,
+    0xF6, 0xA0, 0xA6, 0xAF, 0xEE, 0x89, 0xEB, 0x1A, 0x9A, 0x13, 0xCC, 0xCE, 0x0C, 0xF2, 0x63, 0x2D,
+    0xB6, 0x85, 0x21, 0xE9, 0xFE, 0xDD, 0x4E, 0x06, 0x91, 0xE8, 0xFC, 0xCF, 0x59, 0xC0, 0x5D, 0xEE,
+    0xB2, 0xFD, 0x54, 0xB7, 0xA9, 0x77, 0xBB, 0x21, 0xA8, 0x2F, 0x72, 0x52, 0x1B, 0x14, 0x6C, 0x65,
+    0x2E, 0x8E, 0x62, 0xD4, 0xE9, 0x04, 0x2E, 0xC9, 0x90, 0x80, 0x26, 0xB4, 0x3C, 0xBD, 0x42, 0x2B,
+    0xD8, 0x42, 0x62, 0xD1, 0x8C, 0x0C, 0x29, 0x03, 0xAF, 0xD7, 0x64, 0x41, 0xA7, 0xC4, 0xDC, 0x53,
+    0xB9, 0x1E, 0x5C, 0x02, 0x4D, 0x1B, 0xE2, 0x99, 0x3B, 0x1E, 0xF6, 0x31, 0x6E, 0x5D, 0x3B, 0x0F,
+    0x54, 0xD7, 0x44, 0x7B, 0xBA, 0xE4, 0xCC, 0x5D, 0xCE, 0x70, 0x57, 0xC5, 0x73, 0x20, 0xC7, 0x70,
+    0x09, 0x2C, 0xC2, 0xB0, 0x4B, 0x06, 0xDD, 0x75, 0x39, 0xE1, 0xE0, 0x40, 0xE2, 0xE5, 0x30, 0x86,
+    0xE1, 0x53, 0x5E, 0xF9, 0x03, 0x65, 0xDC, 0x01, 0x67, 0xCA, 0xE9, 0xEF, 0x69, 0xE5, 0x1E, 0x84,
+    0x00, 0x05, 0x00, 0x6E, 0x0D, 0xEA, 0x5E, 0xB1, 0xF0, 0x3B, 0x8E, 0xF1, 0x1C, 0xAF, 0xE1, 0xB5,
+    0xBC, 0x87, 0x5E, 0x21, 0x60, 0x75, 0x44, 0xAF, 0xC3, 0x73, 0x96, 0x0C, 0x22, 0x7E, 0xDA, 0xD7,
+    0x7A, 0x99, 0x7F, 0xA2, 0xA8, 0xB7, 0x41, 0x29, 0xC2, 0x6D, 0x17, 0x4A, 0xBB, 0x2E, 0x01, 0x67,
+    0xE5, 0xC1, 0x7E, 0x6E, 0x53, 0x07, 0xB8, 0xFD, 0xE7, 0xF9, 0x72, 0x90, 0x45, 0x97, 0x5B, 0xE4,
+    0xBC, 0xA0, 0x35, 0x88, 0xAC, 0xFC, 0x65, 0x41, 0xF1, 0xC9, 0xD5, 0x70, 0xE1, 0xF9, 0xD9, 0x4B,
+    0x82, 0xFA, 0xC9, 0x95, 0x86, 0x6A, 0x16, 0x30, 0x58, 0x01, 0xD5, 0xED, 0x4F, 0xA8, 0xA6, 0xD2,
+    0xC6, 0xB8, 0x2D, 0xAA, 0x56, 0x6F, 0x19, 0xF4, 0x81, 0x42, 0x00, 0x38, 0xBF, 0xDB, 0x49, 0x68,
+    0xFF, 0x00, 0x25, 0x7B, 0xC4, 0xCD, 0x06, 0xF0, 0x67, 0xBF, 0xBE, 0xA4, 0x8F, 0x41, 0xBC, 0xA5,
+    0xA4, 0x33, 0x8A, 0x3D, 0x3D, 0x0D, 0x92, 0x6A, 0x8F, 0x60, 0x8C, 0x9F, 0x46, 0xC2, 0x63, 0xDE,
+    0x7B, 0x00, 0xCE, 0x0C, 0xF0, 0x27, 0x4F, 0xC8, 0x25, 0x72, 0xF1, 0xAD, 0x35, 0xF4, 0x8D, 0x93,
+    0x22, 0xBA, 0x87, 0x1D, 0x51, 0x16, 0xC2, 0x5A, 0x59, 0x88, 0xE4, 0xBB, 0x91, 0xC8, 0xB9, 0x04,
+    0x66, 0xE2, 0xA5, 0x63, 0x25, 0xF5, 0x1F, 0xDC, 0x18, 0xD5, 0x26, 0xCE, 0x9C, 0xE2, 0x1D, 0xF2,
+    0x07, 0x19, 0x20, 0xAF, 0xE6, 0x00, 0xBE, 0x3C, 0x7D, 0x1B, 0xDA, 0x15, 0x11, 0xA2, 0x4F, 0x9D,
+    0x2C, 0xA4, 0xFC, 0xB1, 0x19, 0x6E, 0xEA, 0x83, 0xA3, 0x1A, 0x93, 0x16, 0x38, 0x71, 0x01, 0xCA,
+    0x81, 0xFC, 0xE8, 0xC5, 0xE0, 0xF2, 0x3E, 0x25, 0x47, 0x90, 0x80, 0x2B, 0x6A, 0x40, 0xA1, 0x12,
+    0xF0, 0x98, 0xCF, 0xB3, 0xBD, 0x98, 0x4E, 0xA9, 0xD8, 0x2C, 0xCD, 0x92, 0xAA, 0x02, 0xA7, 0xBF,
+    0x09, 0x77, 0xDE, 0x1E, 0x44, 0x40, 0xBB, 0xCC, 0x7D, 0xF8, 0x59, 0x06, 0x34, 0xCC, 0xFC, 0xBA,
+    0xF0, 0xBB, 0x97, 0xB5, 0x32, 0x9E, 0x33, 0x68, 0xE8, 0x42, 0x9C, 0x58, 0x85, 0x95, 0x41, 0x57,
+    0xCA, 0xDC, 0x48, 0x9F, 0x1F, 0x92, 0x81, 0x5F, 0xAB, 0xFB, 0x23, 0x9C, 0x8B, 0xE6, 0x7A, 0x3A,
+    0xB7, 0xC5, 0x5F, 0x82, 0xC2, 0x21, 0xDA, 0xA8, 0xE8, 0xED, 0xB8, 0x2A, 0xBF, 0x3C, 0x57, 0x9C,
+    0x5F, 0xD2, 0xB3, 0x19, 0xDF, 0x63, 0xD9, 0x7F, 0xA8, 0x65, 0xEB, 0x8D, 0xFB, 0xDB, 0xF5, 0xB1,
+    0x0B, 0xAA, 0xF5, 0x77, 0x55, 0xD6, 0xFA, 0x55, 0x55, 0x42, 0x43, 0x1E, 0x43, 0xCB, 0xEC, 0x41,
+    0x2E, 0xFB, 0x18, 0x6F, 0x9F, 0x41, 0xBD, 0xA7, 0x95, 0xD3, 0x2C, 0xE0, 0xDF, 0x92, 0x6D, 0xD2,
+    0x6D, 0x90, 0x29, 0x63, 0x9B, 0x5E, 0x1C, 0x97, 0x6A, 0xBF, 0xFA, 0x6B, 0x1D, 0x74, 0x7E, 0x7E,
+    0xB5, 0x71, 0xA7, 0x96, 0x2C, 0xA3, 0x37, 0x96, 0x24, 0x4B, 0x4F, 0xB0, 0xB2, 0x94, 0xF2, 0x34,
+    0xC9, 0x62, 0x56, 0x7B, 0x5E, 0x35, 0xDE, 0xBD, 0xFA, 0xD7, 0xE2, 0x84, 0x11, 0x6B, 0x23, 0x13,
+    0x6F, 0x0A, 0xD4, 0xF4, 0x56, 0x29, 0xAF, 0x41, 0x0B, 0xDB, 0x77, 0xD4, 0xB8, 0xAA, 0x46, 0xFD,
+    0x8A, 0xEA, 0xF7, 0x85, 0x38, 0x7E, 0x1B, 0xA8, 0x18, 0x2F, 0x7F, 0x2E, 0xBC, 0xB6, 0x15, 0xF7,
+    0xC6, 0x6F, 0x7F, 0x28, 0x2E, 0xAB, 0xC8, 0x4E, 0x9F, 0xF4, 0x07, 0x15, 0x2D, 0xC6, 0xDF, 0xDB,
+    0xB5, 0x4E, 0x15, 0x3F, 0xCB, 0x9F, 0x51, 0x26, 0x45, 0x3F, 0x82, 0x02, 0xC4, 0x28, 0x91, 0x44,
+    0x2E, 0xA0, 0x04, 0x11, 0x16, 0xC6, 0x09, 0x68, 0xC0, 0x26, 0x98, 0x46, 0x84, 0x15, 0xD4, 0x13,
+    0x63, 0xB4, 0x39, 0x26, 0x54, 0xBB, 0x26, 0xA1, 0x6F, 0xD2, 0x0D, 0xE3, 0x5B, 0x19, 0x8F, 0xD8,
+    0xA9, 0x31, 0x32, 0xC7, 0x55, 0xC4, 0x2B, 0x2B, 0x0A, 0xA8, 0xA8, 0x51, 0xF3, 0xCC, 0x48, 0xE9,
+    0x78, 0xEE, 0x5A, 0x08, 0x55, 0xE3, 0xE1, 0xC7, 0xA2, 0x73, 0x57, 0xD1, 0xE1, 0x60, 0xFF, 0xE1,
+    0x7E, 0xC1, 0xE3, 0xE6, 0x48, 0xCE, 0x96, 0x73, 0x48, 0xA5, 0x01, 0x34, 0xC4, 0xB3, 0xA2, 0x08,
+    0xB5, 0x6A, 0x9B, 0x7D, 0x8E, 0x75, 0x9F, 0x28, 0x86, 0x58, 0x6F, 0xDC, 0xBF, 0xB6, 0x88, 0x75,
+    0x79, 0x8D, 0x75, 0xA0, 0x72, 0x60, 0xD3, 0x1C, 0xEB, 0x82, 0xA7, 0x15, 0x89, 0x1D, 0xD2, 0x43,
+    0x66, 0xD5, 0xC9, 0x0B, 0x6F, 0xCE, 0xA3, 0x9A, 0x2F, 0xAA, 0x7E, 0x1A, 0xDB, 0xB5, 0x41, 0xBB,
+    0x5B, 0x3B, 0xBA, 0x5A, 0x73, 0x4A, 0x7F, 0x61, 0x95, 0x7B, 0x0F, 0xC2, 0x07, 0x42, 0x58, 0x1D,
+    0x03, 0x07, 0xFB, 0xA3, 0x59, 0xEA, 0xCA, 0x59, 0xAA, 0x2E, 0x9C, 0xE7, 0xEF, 0xA2, 0x2E, 0x26,
+    0x3A, 0x98, 0x95, 0xCA, 0x18, 0x2C, 0x16, 0x55, 0xC7, 0xC4, 0xCC, 0xC2, 0x6F, 0x2A, 0x0C, 0x33,
+    0x9B, 0xC8, 0x28, 0x00, 0x2B, 0x46, 0x87, 0x24, 0x34, 0x6E, 0xE5, 0xE0, 0x47, 0x63, 0xE9, 0x90,
+    0x9A, 0xD0, 0x18, 0x8A, 0x0C, 0xA8, 0x47, 0xD0, 0x40, 0x2C, 0x98, 0xD1, 0xE8, 0x9D, 0xF5, 0x15,
+    0x5A, 0x6F, 0xE5, 0xF6, 0x3F, 0x44, 0xE8, 0x67, 0xE1, 0xFC, 0x61, 0xEA, 0x86, 0x66, 0xE1, 0xDA,
+    0x0C, 0x66, 0x96, 0x9E, 0xF8, 0x53, 0xC7, 0xB0, 0xEE, 0xA1, 0x44, 0xF6, 0xBA, 0xC6, 0x08, 0x7D,
+    0xF2, 0x0F, 0xD4, 0x98, 0xC1, 0xBB, 0x91, 0xEA, 0xD3, 0x1A, 0x2E, 0x48, 0xC7, 0x4C, 0x60, 0x71,
+    0xD3, 0x86, 0x5D, 0x52, 0xBC, 0xAB, 0x3B, 0x30, 0x16, 0x43, 0xA3, 0xE8, 0x09, 0x6C, 0x63, 0x70,
+    0xD8, 0x46, 0x27, 0x65, 0x13, 0xF1, 0x4E, 0x8C, 0x3F, 0x20, 0x0C, 0x33, 0x27, 0x43, 0x53, 0x22,
+    0xAF, 0x60, 0x4B, 0x7C, 0x98, 0x6B, 0x56, 0x76, 0x30, 0xE2, 0x58, 0x17, 0x31, 0x3A, 0xF6, 0x5B,
+    0x06, 0x23, 0x54, 0x95, 0x5E, 0x21, 0x2B, 0x8B, 0x1C, 0xFA, 0x6B, 0x25, 0x34, 0xD5, 0x5E, 0x92,
+    0xD8, 0x89, 0x66, 0xB3, 0x90, 0x1B, 0x9D, 0xC3, 0x4E, 0xB8, 0x42, 0x9E, 0x37, 0xAE, 0x16, 0xC8,
+    0x73, 0x0A, 0x70, 0xB4, 0xB5, 0x47, 0xAF, 0x6E, 0x8F, 0x1E, 0xA7, 0x1A, 0xC8, 0x4F, 0x9C, 0xD8,
+    0x35, 0xFA, 0xA9, 0xC4, 0xCA, 0xE4, 0x36, 0x43, 0x9C, 0x32, 0x33, 0xF0, 0xDF, 0x1F, 0x37, 0xC6,
+    0xF3, 0x6D, 0x7E, 0x3B, 0x71, 0x56, 0xF8, 0x82, 0x41, 0xBE, 0x6E, 0x88, 0xAB, 0xA6, 0x80, 0xDD,
+    0x6E, 0xD0, 0x9D, 0x46, 0x57, 0x5E, 0xAA, 0xBF, 0x61, 0xCC, 0x42, 0x51, 0x4F, 0x01, 0x8E, 0x16,
+    0xDC, 0x32, 0xB6, 0x76, 0x6A, 0xD1, 0xAC, 0x87, 0x8E, 0x36, 0xBD, 0xDA, 0x53, 0xF4, 0x1A, 0xC9,
+    0x39, 0x57, 0x67, 0x8A, 0x04, 0xFA, 0x4A, 0x5F, 0x57, 0x3D, 0x5D, 0xC5, 0x75, 0x8A, 0x4E, 0x25,
+    0x41, 0x27, 0xA9, 0xFC, 0xCE, 0xA4, 0xD3, 0x99, 0x9D, 0x6B, 0x6B, 0x67, 0x52, 0x5B, 0xBB, 0x93,
+    0x66, 0x4F, 0x11, 0xFF, 0x3C, 0xE6, 0x44, 0xBF, 0xA1, 0x35, 0x51, 0xAF, 0x13, 0x9B, 0xE8, 0x77,
+    0x6D, 0xAB, 0xDA, 0x6D, 0x54, 0x5B, 0xB7, 0x46, 0x42, 0x35, 0xAD, 0x02, 0x6B, 0xE9, 0xFF, 0xFC,
+    0xAF, 0x48, 0xA5, 0xDA, 0x77, 0x4E, 0x9A, 0x55, 0x54, 0x0A, 0x84, 0x2F, 0x49, 0xBC, 0x35, 0xA5,
+    0xD8, 0xD7, 0xC7, 0xF4, 0x59, 0x71, 0xB4, 0xAB, 0x43, 0x70, 0x71, 0x5A, 0xCB, 0xE4, 0x47, 0x45,
+    0xED, 0xAF, 0x96, 0xD6, 0x57, 0x32, 0x5A, 0x74, 0xB7, 0x7F, 0x85, 0xD6, 0x58, 0xFF, 0x44, 0xDF,
+    0xCC, 0x3D, 0x52, 0xD2, 0x47, 0x24, 0xA9, 0xAB, 0x23, 0x25, 0x5E, 0x1D, 0x74, 0x8B, 0x64, 0x44,
+    0x56, 0x06, 0x85, 0x1E, 0x83, 0xDA, 0xA5, 0x1B, 0xA5, 0x0B, 0x55, 0x3B, 0xEB, 0x12, 0x65, 0x40,
+    0xE3, 0x4E, 0xD4, 0x25, 0xC1, 0x02, 0x39, 0x03, 0xEA, 0xF2, 0x54, 0xE8, 0x7B, 0x63, 0x00, 0x1F,
+    0xD6, 0x27, 0xE5, 0x90, 0x78, 0xBA, 0x39, 0x1A, 0x1E, 0x73, 0x82, 0xDA, 0x1C, 0xC1, 0x2E, 0x49,
+    0xA8, 0x04, 0xBD, 0x1A, 0x1C, 0x32, 0x53, 0xFC, 0xF5, 0x9F, 0x7F, 0x89, 0x69, 0xBA, 0xF7, 0x4B,
+    0x4C, 0xD3, 0x47, 0x59, 0xA9, 0x5C, 0xAA, 0x95, 0x01, 0x9D, 0xC2, 0x3D, 0xE8, 0x26, 0xE8, 0x56,
+    0xE6, 0x8A, 0xA3, 0x3A, 0x92, 0xE9, 0xF2, 0x52, 0xA9, 0x02, 0x8D, 0x8A, 0x87, 0x85, 0x54, 0xC7,
+    0x52, 0x19, 0x05, 0x39, 0x83, 0x58, 0x75, 0xAC, 0xE8, 0xE5, 0x6D, 0x8B, 0x63, 0x5F, 0x4F, 0x50,
+    0x9D, 0x3F, 0x13, 0x61, 0x9E, 0xFA, 0x37, 0xFF, 0x22, 0xE5, 0x54, 0x42, 0x0B, 0xE4, 0x74, 0x39,
+    0xEF, 0xD1, 0x29, 0x56, 0x3A, 0xE8, 0x79, 0xDB, 0x14, 0xBF, 0x45, 0x9B, 0xEE, 0x8B, 0x58, 0xB5,
+    0xE9, 0xBF, 0xF0, 0x55, 0x9B, 0x0E, 0x8C, 0x40, 0x31, 0x0A, 0x17, 0xA2, 0x2D, 0xDA, 0x2D, 0x02,
+    0xBE, 0x72, 0x87, 0xA3, 0x6C, 0x4B, 0x5C, 0xDC, 0x11, 0x69, 0x4D, 0xA7, 0x25, 0xEE, 0xBA, 0x42,
+    0xC8, 0x8E, 0xC6, 0xD2, 0x53, 0x99, 0x22, 0xED, 0xB9, 0x41, 0x6F, 0xBE, 0xFC, 0x67, 0xF0, 0x5C,
+    0xFB, 0xDE, 0x17, 0x80, 0xCE, 0x47, 0x39, 0xF8, 0xB3, 0xFB, 0x5E, 0x0E, 0x63, 0x28, 0x20, 0xB9,
+    0x93, 0x77, 0xA2, 0xC7, 0x98, 0x4E, 0x27, 0x84, 0x46, 0x86, 0xF1, 0x77, 0x04, 0xB6, 0x1E, 0x0F,
+    0x06, 0x64, 0x31, 0x12, 0x10, 0x11, 0x1F, 0x01, 0x66, 0xC8, 0x13, 0xEF, 0x08, 0x27, 0xB4, 0xF5,
+    0x85, 0xE0, 0xFF, 0xB7, 0xB9, 0x58, 0x61, 0xC7, 0x0D, 0x5D, 0x1A, 0x13, 0x0F, 0x88, 0x0C, 0x56,
+    0x84, 0x1B, 0x19, 0x97, 0x29, 0x15, 0x39, 0x4B, 0x2C, 0xC9, 0x12, 0x3D, 0xB0, 0x4B, 0x0F, 0xF3,
+    0xE4, 0x29, 0x4F, 0x1C, 0x79, 0xAC, 0xF9, 0xCB, 0x09, 0x99, 0x32, 0xE7, 0xA4, 0xAF, 0x0E, 0x06,
+    0x83, 0x90, 0x2F, 0x8F, 0x5A, 0x0F, 0x3A, 0x7D, 0x9D, 0x7B, 0x01, 0x63, 0x4E, 0xC2, 0x36, 0x4D,
+    0xC4, 0x86, 0x0A, 0xB8, 0x39, 0x65, 0x3E, 0x46, 0x5E, 0x92, 0xB3, 0x94, 0x6E, 0xE8, 0x84, 0xE8,
+    0xB0, 0xAB, 0xCA, 0x16, 0x14, 0x35, 0x68, 0x92, 0x3D, 0x7A, 0x29, 0x62, 0xBA, 0x2B, 0xDA, 0x4A,
+    0xC6, 0x7E, 0x56, 0x4D, 0x07, 0x83, 0x24, 0x14, 0xA2, 0x20, 0xBD, 0x61, 0x90, 0x4A, 0x52, 0x43,
+    0x6E, 0x15, 0xC2, 0x5B, 0x9D, 0x54, 0x52, 0x82, 0x3C, 0x3D, 0xD5, 0x43, 0xD5, 0xCC, 0x9C, 0x54,
+    0x23, 0x4E, 0xE0, 0x9F, 0x7F, 0x41, 0x82, 0xE9, 0xD1, 0xA6, 0xC2, 0x04, 0x92, 0xC1, 0x62, 0x02,
+    0x89, 0x90, 0x6D, 0x03, 0x72, 0xC7, 0xA6, 0xFB, 0x54, 0x62, 0xCC, 0x56, 0xCE, 0x3F, 0xCC, 0x23,
+    0xAA, 0xA2, 0x4D, 0xEE, 0x87, 0xB6, 0x90, 0xE7, 0xAA, 0xD1, 0x2D, 0xE9, 0x63, 0x2C, 0x9D, 0x8C,
+    0xAD, 0x47, 0xE8, 0x25, 0xE9, 0xAB, 0x4B, 0xC1, 0x29, 0xDD, 0x75, 0xDF, 0x67, 0x58, 0x8B, 0x3D,
+    0x4D, 0xE4, 0xAD, 0x89, 0x44, 0x47, 0xF0, 0xAE, 0x83, 0x00, 0x13, 0x98, 0x1E, 0x00, 0x41, 0x9C,
+    0xE8, 0xC0, 0x4E, 0x63, 0x37, 0x3C, 0x80, 0xC8, 0xF0, 0xD4, 0x01, 0x85, 0x9F, 0x3A, 0x40, 0x8F,
+    0xBB, 0xEA, 0x40, 0x8D, 0xCC, 0x0C, 0x4C, 0xAD, 0xF4, 0x20, 0xD6, 0x7B, 0xC2, 0xAB, 0xA9, 0x8D,
+    0xE1, 0x65, 0x99, 0xB7, 0x67, 0x8F, 0xBE, 0xA7, 0x95, 0xE9, 0xC6, 0xBC, 0x18, 0xEB, 0x54, 0xC4,
+    0x4B, 0xB9, 0xC9, 0x90, 0x29, 0x29, 0xAE, 0x03, 0xBD, 0x57, 0xC7, 0xC0, 0x86, 0x35, 0xD5, 0xB6,
+    0xEB, 0x1A, 0xD7, 0xDA, 0x23, 0x03, 0xCA, 0xBD, 0x43, 0xE7, 0xF7, 0xC7, 0x73, 0xDD, 0x33, 0x78,
+    0xB8, 0x7F, 0x84, 0xE7, 0x8F, 0x8D, 0xC1, 0xE0, 0x7F, 0xEB, 0x2C, 0xA7, 0x0D, 0x65, 0x47, 0xFD,
+    0xD0, 0xFC, 0x17, 0x60, 0x04, 0x50, 0x6F, 0x13, 0x45, 0x7C, 0x6E, 0xFF, 0xA5, 0xF1, 0xB9, 0x51,
+    0x8F, 0x07, 0x96, 0x1A, 0x87, 0x38, 0x8F, 0xF6, 0x49, 0xEC, 0x47, 0x14, 0x68, 0xED, 0xAC, 0x95,
+    0xDA, 0x8B, 0x36, 0x6B, 0x9F, 0xDB, 0x6E, 0x38, 0x6F, 0x30, 0xC3, 0x01, 0xAE, 0x56, 0xA5, 0x42,
+    0x52, 0x7D, 0xB7, 0x87, 0xB6, 0xF5, 0x9E, 0x0E, 0xBA, 0x3E, 0xB5, 0x92, 0x00, 0x60, 0xEC, 0x86,
+    0x3D, 0x73, 0xE4, 0xE4, 0x3D, 0xBB, 0xB0, 0x6A, 0xFA, 0x40, 0xB7, 0x37, 0x0E, 0xC3, 0xD3, 0x56,
+    0xE1, 0x1C, 0x28, 0x75, 0x9A, 0xF5, 0x2F, 0x81, 0x5B, 0x46, 0xB1, 0x19, 0xC5, 0x46, 0x81, 0xF9,
+    0x30, 0x60, 0xC5, 0x10, 0xE4, 0x33, 0x50, 0x00, 0x98, 0xCB, 0xA0, 0x3E, 0xDB, 0xC3, 0x1D, 0x59,
+    0x60, 0x14, 0x4E, 0xEA, 0xFE, 0xB2, 0x48, 0x98, 0x30, 0x39, 0x51, 0x1C, 0x62, 0x3D, 0x2D, 0x4F,
+    0x7E, 0x65, 0x13, 0xF0, 0x1E, 0x69, 0x49, 0x67, 0x4E, 0xC3, 0x9D, 0x0C, 0xFA, 0x5C, 0xAB, 0x60,
+    0x48, 0xAF, 0xA4, 0xCA, 0x3E, 0xF6, 0x9A, 0x90, 0xB6, 0x2F, 0xF3, 0x24, 0x58, 0xAC, 0x01, 0x30,
+    0x30, 0xD1, 0xC7, 0x9A, 0x48, 0xE0, 0x2E, 0x27, 0x86, 0xFA, 0x99, 0xD8, 0x22, 0x56, 0x61, 0x62,
+    0xF0, 0x33, 0xE2, 0x5E, 0x88, 0x77, 0x34, 0x41, 0x05, 0x6F, 0x44, 0xCE, 0x19, 0xDA, 0x47, 0x37,
+    0x69, 0xA4, 0x51, 0xE5, 0x18, 0xF9, 0xB5, 0xEB, 0x1B, 0x6D, 0x18, 0xB3, 0x2C, 0xB8, 0xC0, 0x4B,
+    0x6A, 0x15, 0x4E, 0x66, 0xE7, 0x8B, 0xEE, 0xEF, 0x03, 0xC0, 0x09, 0xA6, 0xD2, 0x9E, 0xF8, 0x12,
+    0xF2, 0xA7, 0x7C, 0xC7, 0xAB, 0x03, 0xD2, 0x22, 0xB9, 0x26, 0x35, 0xE0, 0x4C, 0x74, 0x17, 0x45,
+    0x1D, 0xC7, 0x60, 0xA2, 0x0F, 0xB9, 0xCF, 0x58, 0x44, 0x0D, 0x79, 0x80, 0x2F, 0x79, 0x5A, 0xA2,
+    0x79, 0x91, 0xA7, 0x3B, 0x3B, 0x04, 0xD4, 0x7B, 0x5B, 0x92, 0xD4, 0x45, 0xFC, 0x36, 0x4B, 0xD1,
+    0xED, 0x7E, 0x02, 0xDD, 0x6E, 0xCA, 0x64, 0x29, 0x58, 0x93, 0x29, 0x63, 0xAD, 0x60, 0xA4, 0xB0,
+    0x1E, 0x1C, 0xA8, 0x42, 0x9E, 0x84, 0x8D, 0x19, 0xAD, 0x51, 0x23, 0x5A, 0x27, 0xB8, 0xA1, 0xCB,
+    0x00, 0x71, 0xC1, 0x04, 0x09, 0xD1, 0xEF, 0x8C, 0x70, 0x9B, 0x81, 0x60, 0x49, 0xE8, 0x6A, 0x37,
+    0x02, 0xE4, 0xCD, 0x16, 0xF3, 0x9E, 0x1B, 0xFB, 0xF3, 0xDC, 0xFA, 0x72, 0x71, 0x23, 0x54, 0x1E,
+    0xD8, 0x82, 0xF3, 0xB7, 0x98, 0x1A, 0x88, 0x2A, 0x55, 0x40, 0xAE, 0xBD, 0xF6, 0x4A, 0xA3, 0xC3,
+    0xBE, 0x50, 0x3F, 0xE7, 0x9F, 0x4B, 0x55, 0xFD, 0x4B, 0xF4, 0x1D, 0x09, 0xE2, 0x5F, 0xD5, 0x7E,
+    0x15, 0xBB, 0xA8, 0x55, 0x3D, 0xE0, 0x87, 0x2D, 0x17, 0xA1, 0x9B, 0x56, 0x7E, 0x17, 0x2A, 0x5F,
+    0xA0, 0x07, 0x49, 0xD4, 0x50, 0x73, 0xD4, 0xD5, 0xD1, 0x78, 0x6A, 0xD4, 0x92, 0x15, 0x47, 0x8F,
+    0x2A, 0x94, 0x3C, 0x25, 0xB1, 0x10, 0x27, 0x92, 0x23, 0x40, 0x76, 0x25, 0x5F, 0x98, 0x62, 0x23,
+    0x77, 0x49, 0xE2, 0x08, 0xB3, 0x8E, 0xA8, 0x73, 0x82, 0x11, 0x58, 0x30, 0xA6, 0xCA, 0xFA, 0x5D,
+    0xE5, 0x88, 0x5A, 0x11, 0xDE, 0xDE, 0x2B, 0x98, 0xB5, 0x97, 0xE8, 0x76, 0x53, 0x38, 0x89, 0x48,
+    0x76, 0x49, 0x2C, 0xD2, 0xB6, 0x0B, 0xB5, 0x83, 0x60, 0xD1, 0xED, 0x33, 0x8B, 0x53, 0xD6, 0xBE,
+    0xBB, 0x7A, 0x38, 0xE5, 0x53, 0x35, 0x34, 0x24, 0x9E, 0x0A, 0x60, 0x36, 0x06, 0xF2, 0x13, 0x62,
+    0x37, 0x7D, 0xC1, 0xF6, 0xA3, 0x9D, 0x8C, 0xC3, 0x46, 0x2C, 0xF7, 0x94, 0xF6, 0x1B, 0x3B, 0xA1,
+    0x74, 0x69, 0x4C, 0xF3, 0xA0, 0x27, 0xF3, 0x27, 0x52, 0x90, 0x42, 0x80, 0x5C, 0x22, 0xE6, 0x10,
+    0xB0, 0x66, 0x16, 0x2C, 0xAF, 0xA3, 0x97, 0x59, 0x74, 0xF3, 0x2E, 0x74, 0x0B, 0x50, 0x02, 0x8D,
+    0x07, 0x52, 0x03, 0x0D, 0x08, 0xA1, 0x08, 0xEA, 0x62, 0xA4, 0x0A, 0x12, 0x9D, 0x11, 0xCE, 0x93,
+    0x58, 0x9A, 0x5E, 0x78, 0xCB, 0x7D, 0xD0, 0x91, 0x42, 0x9D, 0x31, 0x2D, 0x75, 0xD4, 0x24, 0x03,
+    0x30, 0x05, 0xAA, 0x49, 0xE6, 0xD0, 0x11, 0x11, 0xA3, 0x4A, 0x7E, 0x85, 0xB7, 0x8C, 0x5E, 0xC5,
+    0x4D, 0x4C, 0xE8, 0xD8, 0x15, 0x1B, 0xDE, 0x93, 0x47, 0x4A, 0xBA, 0x18, 0x43, 0xBE, 0x92, 0x19,
+    0xB7, 0x0E, 0xEA, 0x6B, 0xB4, 0xAC, 0x97, 0x7B, 0x43, 0x9D, 0x34, 0xD6, 0x1A, 0x6D, 0xE0, 0x99,
+    0xC6, 0xB4, 0xFF, 0x4F, 0x9A, 0xF1, 0xD0, 0xAA, 0xD4, 0xC1, 0x7B, 0x69, 0x03, 0xCD, 0x80, 0xFA,
+    0x23, 0x49, 0x14, 0x97, 0x26, 0xA2, 0x20, 0xE7, 0xCA, 0xFE, 0xF6, 0x5B, 0x0C, 0x43, 0xB4, 0x2D,
+    0x99, 0xF1, 0x81, 0xE4, 0x2F, 0x70, 0xA4, 0x1D, 0x01, 0xD1, 0x1C, 0xC8, 0x89, 0x86, 0x92, 0x7C,
+    0x65, 0x7F, 0xF9, 0x68, 0x4C, 0x9E, 0xC3, 0x94, 0x25, 0xB2, 0x7D, 0x49, 0x62, 0x30, 0xF6, 0x16,
+    0xB0, 0xD6, 0x39, 0xAE, 0x73, 0xE7, 0x45, 0xB9, 0xDE, 0xDA, 0x94, 0xB6, 0x5C, 0x38, 0xD0, 0xC4,
+    0x31, 0xD4, 0xD7, 0xD4, 0x7E, 0x9D, 0x1F, 0xEA, 0x6A, 0x11, 0xE7, 0x3D, 0x49, 0xDE, 0x06, 0x3E,
+    0x5D, 0x65, 0xBC, 0xB5, 0xB4, 0x55, 0xEE, 0xA5, 0x82, 0xE1, 0xAD, 0x9C, 0x54, 0x29, 0x76, 0xA1,
+    0x28, 0xFA, 0xA2, 0x46, 0x33, 0x48, 0xA0, 0x9A, 0x04, 0x22, 0xCD, 0xE8, 0x16, 0x2A, 0x9F, 0x5E,
+    0x58, 0xA9, 0x7A, 0x3A, 0x8B, 0xA8, 0xA7, 0xF3, 0x8D, 0x7A, 0xC2, 0x0A, 0x25, 0x95, 0x51, 0xBC,
+    0x89, 0x56, 0x61, 0xD3, 0x1C, 0x01, 0x5F, 0x9C, 0x98, 0x55, 0x04, 0xE3, 0xA3, 0x76, 0x60, 0x7A,
+    0xD5, 0x8F, 0x84, 0xD3, 0x6E, 0xEB, 0x49, 0xBD, 0x1D, 0x8A, 0xBA, 0xCC, 0xEE, 0x59, 0xBF, 0x4C,
+    0xE8, 0xA4, 0xFD, 0xDB, 0xFF, 0x44, 0xED, 0x56, 0x13, 0xA0, 0x29, 0xB9, 0xC5, 0x86, 0x7C, 0xB7,
+    0xC3, 0xC5, 0xEC, 0x62, 0xDA, 0x3F, 0xD9, 0x26, 0xD3, 0x48, 0x0A, 0xBB, 0xCA, 0x9C, 0x2F, 0xEE,
+    0x98, 0xEF, 0x33, 0xFF, 0xA9, 0xCE, 0x7D, 0xAA, 0xDB, 0xDE, 0x96, 0x36, 0xFB, 0xBD, 0x1A, 0x5A,
+    0x59, 0x03, 0xE9, 0x9C, 0x53, 0x6D, 0xBA, 0xDF, 0xD4, 0xD0, 0x0B, 0xC1, 0xA8, 0xC6, 0x4E, 0xE6,
+    0x96, 0xD6, 0xA8, 0x45, 0x47, 0x6B, 0xAE, 0x92, 0x92, 0x9E, 0x3D, 0x43, 0x3B, 0x95, 0xEA, 0xAC,
+    0x8D, 0xC7, 0x53, 0x21, 0xAE, 0x1F, 0xFF, 0x87, 0xD7, 0xD5, 0x89, 0xCF, 0xEF, 0xAE, 0xBD, 0xAA,
+    0xDE, 0x18, 0x0C, 0x22, 0x49, 0x53, 0xC5, 0xA1, 0x7F, 0xD3, 0xB2, 0xC2, 0xA5, 0x76, 0x9F, 0xB9,
+    0x35, 0x3B, 0x4F, 0xBE, 0x0A, 0xC8, 0x09, 0xAA, 0xBD, 0x1D, 0x20, 0x1F, 0x67, 0x32, 0x6F, 0xB2,
+    0xA8, 0xA8, 0x0F, 0x3D, 0x73, 0xF2, 0x95, 0x3B, 0x4B, 0xBE, 0x92, 0x4C, 0x1F, 0xE8, 0x02, 0x4A,
+    0xFB, 0x83, 0x21, 0xBB, 0x05, 0x99, 0x33, 0x55, 0x87, 0x69, 0xD7, 0x81, 0x3A, 0x8E, 0x64, 0x1F,
+    0xDF, 0x98, 0x79, 0xFB, 0xFC, 0x05, 0x8F, 0x5F, 0x6F, 0x41, 0x19, 0x0C, 0x66, 0xEE, 0xCE, 0x57,
+    0x40, 0xFA, 0x34, 0xD5, 0xC6, 0x35, 0x73, 0x5A, 0x57, 0x1A, 0x4C, 0xC5, 0x8B, 0x7E, 0x68, 0x47,
+    0xAA, 0xFF, 0x87, 0x3A, 0xA7, 0xCA, 0xA0, 0xA0, 0x43, 0xFB, 0x8C, 0xDF, 0x62, 0xEA, 0xD3, 0x1F,
+    0xB6, 0x71, 0x2A, 0xF8, 0x4B, 0x34, 0x56, 0x52, 0x4A, 0x42, 0xE1, 0xD0, 0x4C, 0xA8, 0xB6, 0xD2,
+    0xD7, 0x25, 0x67, 0xBF, 0x35, 0x9B, 0x9E, 0x1F, 0x5E, 0xEC, 0x40, 0xD7, 0x18, 0x77, 0x35, 0xD3,
+    0x07, 0xEB, 0xEC, 0x8F, 0x82, 0x69, 0xDC, 0x0F, 0xDF, 0x15, 0xFE, 0x43, 0xCD, 0xFC, 0xB2, 0xD0,
+    0xC4, 0x5B, 0xC3, 0x77, 0x2F, 0x17, 0x6A, 0x93, 0xF9, 0x1A, 0x61, 0xCF, 0x9D, 0xFC, 0x31, 0xDD,
+    0xF6, 0xCA, 0x6C, 0x8C, 0x70, 0xA7, 0xCE, 0x6F, 0x51, 0x97, 0x9B, 0x27, 0x5F, 0x30, 0x97, 0xD1,
+    0x57, 0x6C, 0xE6, 0x7E, 0xA4, 0x65, 0x85, 0x01, 0xEC, 0x37, 0xD2, 0xFF, 0x88, 0x07, 0xA4, 0x3F,
+    0x55, 0x5C, 0x9F, 0x04, 0x2A, 0x78, 0x4D, 0x3D, 0xCB, 0x67, 0x53, 0xB3, 0xAB, 0xFF, 0xA6, 0x02,
+    0x91, 0x3D, 0x56, 0x15, 0xFD, 0xCF, 0x9F, 0x88, 0x97, 0xEE, 0x7A, 0xF6, 0xE3, 0xEF, 0xCB, 0x05,
+    0x6A, 0x4F, 0x3D, 0xD7, 0x87, 0x39, 0xBD, 0x0B, 0x0D, 0x2B, 0xEA, 0x86, 0x45, 0x3F, 0x6D, 0x2E,
+    0xD0, 0x0D, 0x6B, 0x90, 0xDA, 0x9E, 0xD4, 0x5F, 0xDE, 0xDC, 0xAF, 0xBF, 0xBC, 0x7D, 0x02, 0xE1,
+    0xE7, 0xCC, 0x51, 0xA9, 0x9F, 0x35, 0x5F, 0x46, 0xCD, 0x17, 0x2D, 0x29, 0xBF, 0xDF, 0xA8, 0x9D,
+    0x8E, 0xA4, 0x5F, 0x47, 0x7A, 0x25, 0x85, 0xA8, 0x10, 0xC4, 0x20, 0x6D, 0xD8, 0x17, 0x8D, 0x84,
+    0x25, 0x22, 0x47, 0x27, 0xF3, 0xE6, 0x56, 0x7F, 0xDE, 0xD2, 0x82, 0x39, 0x6C, 0xC6, 0xE7, 0x58,
+    0xD9, 0x63, 0x3D, 0x50, 0xA9, 0xFA, 0x1F, 0x7A, 0x04, 0xD3, 0x67, 0x1F, 0x1B, 0xE9, 0xFA, 0xEF,
+    0xA3, 0xFC, 0x55, 0x23, 0xED, 0xCB, 0xC6, 0x25, 0xC0, 0xA8, 0x68, 0x9F, 0x2A, 0xE8, 0x15, 0xFD,
+    0x56, 0xE8, 0x18, 0x4D, 0x07, 0x37, 0xE7, 0x3A, 0xFE, 0x9C, 0xAF, 0xF2, 0x01, 0x27, 0xDE, 0x5C,
+    0x28, 0xFD, 0x44, 0x3E, 0xEE, 0x90, 0xE9, 0x30, 0xE0, 0xDA, 0xBC, 0xC4, 0xF8, 0x70, 0x76, 0xC9,
+    0x96, 0xB0, 0x68, 0x7A, 0x0E, 0x72, 0x31, 0x23, 0x05, 0x26, 0x02, 0x1F, 0x4B, 0x8A, 0xEF, 0x6F,
+    0x09, 0xED, 0xCF, 0x09, 0x61, 0x89, 0xD3, 0x45, 0x23, 0xA9, 0xBF, 0x43, 0x81, 0x25, 0xA1, 0xC5,
+    0x4C, 0xBE, 0xB6, 0x9D, 0x31, 0x1B, 0x18, 0x1C, 0x0F, 0x30, 0x90, 0xCC, 0xE0, 0xA1, 0x24, 0x09,
+    0x4B, 0xCE, 0x6F, 0x50, 0x08, 0xCC, 0x94, 0xF5, 0x80, 0x29, 0xBE, 0x60, 0x94, 0x41, 0x9D, 0xCB,
+    0xA8, 0x97, 0x94, 0x35, 0x59, 0x9E, 0xB2, 0xF0, 0x44, 0x53, 0xA1, 0x98, 0x75, 0x0C, 0x0E, 0x68,
+    0xA4, 0x88, 0x5A, 0xA9, 0xF0, 0x58, 0x0C, 0xB8, 0x50, 0x1B, 0x91, 0x64, 0x23, 0x9C, 0x71, 0x40,
+    0xF3, 0x8E, 0x76, 0x32, 0xC4, 0x64, 0xA3, 0xB1, 0xF2, 0x09, 0x62, 0x82, 0xD1, 0x88, 0x3A, 0xCF,
+    0x88, 0x0A, 0x10, 0x80, 0x13, 0x8E, 0x68, 0x30, 0x03, 0x74, 0x09, 0x98, 0xF1, 0x7E, 0xC8, 0x14,
+    0xF5, 0x84, 0x99, 0xF0, 0x50, 0x51, 0xAA, 0x14, 0x2A, 0x9B, 0x18, 0x6C, 0xA2, 0xD6, 0x38, 0x33,
+    0xC5, 0xC6, 0x9F, 0xB5, 0xF1, 0xC2, 0x02, 0x2F, 0x62, 0x82, 0x3C, 0x24, 0x7D, 0x51, 0x83, 0x95,
+    0xEC, 0xAA, 0x02, 0x7B, 0xB3, 0x68, 0x19, 0x5B, 0x0F, 0xAE, 0x4F, 0x78, 0xAC, 0x4F, 0x00, 0x61,
+    0x95, 0x49, 0x6C, 0x50, 0x03, 0xF9, 0x89, 0x13, 0xF9, 0xBF, 0x9B, 0xD4, 0x17, 0x57, 0x53, 0xDD,
+    0x39, 0x3B, 0x9D, 0x97, 0xFD, 0x87, 0x7B, 0x3A, 0x7E, 0x76, 0x3F, 0x5C, 0x3A, 0xBE, 0x54, 0x84,
+    0x8D, 0x56, 0x0C, 0x55, 0x31, 0xB7, 0x72, 0xC8, 0x68, 0x98, 0xCD, 0x04, 0x25, 0xA9, 0x8D, 0x31,
+    0x8E, 0x8F, 0x50, 0xA2, 0xA0, 0xBA, 0x5B, 0xAF, 0x1C, 0x48, 0x56, 0xAD, 0xEA, 0x28, 0xDA, 0xAD,
+    0x7B, 0x45, 0xDB, 0xFA, 0x4D, 0xEE, 0x5F, 0x67, 0x92, 0x33, 0xB3, 0x74, 0x13, 0x71, 0x41, 0xE0,
+    0xBA, 0x70, 0x5D, 0xB2, 0xD9, 0x3C, 0x77, 0x60, 0x67, 0x96, 0x3B, 0x30, 0x5C, 0x97, 0x3B, 0x60,
+    0x7E, 0x5E, 0x24, 0xC6, 0x37, 0x79, 0x92, 0x26, 0x75, 0xEE, 0x40, 0xA5, 0x62, 0xE3, 0x3F, 0xA7,
+    0x31, 0x38, 0xE8, 0xCA, 0xDC, 0x81, 0x53, 0xA3, 0x61, 0xA7, 0xF5, 0xCA, 0x95, 0xD4, 0x1F, 0x0C,
+    0xC2, 0x97, 0xB9, 0x02, 0x91, 0xA6, 0x4F, 0xFD, 0x7F, 0xFB, 0xB3, 0x22, 0xA9, 0x8A, 0x61, 0x67,
+    0xFB, 0x19, 0x03, 0x51, 0x98, 0xBC, 0x12, 0x65, 0x6C, 0x3D, 0x1C, 0xDC, 0x5D, 0x97, 0x08, 0x7C,
+    0xE9, 0xC1, 0x35, 0x89, 0xCD, 0xB2, 0x3C, 0x4B, 0xE2, 0xF0, 0xE6, 0x60, 0xC0, 0x29, 0x55, 0xF6,
+    0xC3, 0xC1, 0xA9, 0xE9, 0xA6, 0x96, 0x43, 0x7D, 0x73, 0x2D, 0x3A, 0xA4, 0x5A, 0xC7, 0x7E, 0xDA,
+    0x30, 0xF9, 0xB2, 0x70, 0x4E, 0x16, 0xD9, 0x70, 0xD5, 0x00, 0xD1, 0xA1, 0xAC, 0x57, 0x00, 0x70,
+    0x31, 0x8E, 0x4F, 0xD6, 0xB0, 0x58, 0x6A, 0x92, 0xD8, 0xD5, 0xB3, 0x03, 0x79, 0xBA, 0x77, 0xA9,
+    0x50, 0x74, 0xDD, 0xCD, 0xD2, 0x34, 0xEE, 0xA0, 0x6D, 0x85, 0x3A, 0x1C, 0xDC, 0x59, 0x11, 0x26,
+    0x8E, 0x24, 0x77, 0x6C, 0xB8, 0xC9, 0x98, 0x4A, 0xBF, 0x8E, 0xA9, 0x2C, 0x86, 0x8B, 0x25, 0x9D,
+    0x29, 0x9A, 0x07, 0x2C, 0x02, 0x65, 0x5E, 0x9D, 0xC8, 0xEA, 0x0F, 0xB3, 0xB6, 0xFA, 0x7A, 0x54,
+    0x29, 0x3D, 0x25, 0x3A, 0xDF, 0xAE, 0xA8, 0x5B, 0xA2, 0xA6, 0xD1, 0x7F, 0xA5, 0xC8, 0x95, 0x24,
+    0xAD, 0x58, 0x14, 0x35, 0x05, 0x95, 0x8B, 0xCD, 0x74, 0xEE, 0xE5, 0x92, 0x2C, 0xFD, 0xF5, 0x97,
+    0xC2, 0x36, 0xBF, 0xFD, 0x8D, 0xF0, 0x4A, 0xED, 0x9D, 0x31, 0xBF, 0xF9, 0xB5, 0x90, 0xF3, 0x97,
+    0xFF, 0x3C, 0xD2, 0x57, 0x4A, 0x0C, 0x97, 0x6E, 0x33, 0x45, 0x46, 0x07, 0x1D, 0xC3, 0xE0, 0x33,
+    0xB9, 0x54, 0x41, 0xDE, 0x20, 0xEF, 0x9B, 0x6C, 0x0B, 0x9B, 0xEB, 0x17, 0xC2, 0xE7, 0x3C, 0xCD,
+    0x8C, 0xCD, 0xA7, 0x57, 0xC6, 0x36, 0xF3, 0xC6, 0x5E, 0x8D, 0xDC, 0xD0, 0x95, 0xF4, 0x6F, 0x57,
+    0x5C, 0xFC, 0x2E, 0x59, 0xF5, 0xD8, 0xA5, 0xAD, 0xED, 0xBB, 0x12, 0xAC, 0xF9, 0x4B, 0x32, 0x9E,
+    0xD6, 0x57, 0xB1, 0x40, 0x9A, 0x06, 0xEE, 0x4D, 0x1E, 0xD1, 0x67, 0x71, 0x25, 0xFD, 0x1E, 0xBC,
+    0x8B, 0x16, 0xEA, 0xAE, 0xA4, 0x70, 0xBB, 0xE3, 0x21, 0x93, 0xB4, 0xC7, 0x0B, 0x26, 0xE4, 0x3A,
+    0x78, 0xED, 0xCC, 0x96, 0xDD, 0xBC, 0x59, 0xAB, 0xF8, 0x0C, 0x7D, 0xB3, 0x5C, 0x4A, 0xB5, 0xF0,
+    0xBF, 0x40, 0x15, 0xF2, 0x05, 0xF3, 0xD9, 0xAE, 0xAC, 0x78, 0x36, 0xA5, 0x81, 0x5E, 0xEA, 0x13,
+    0x2B, 0xAE, 0x5B, 0x11, 0x0F, 0x29, 0xC3, 0x12, 0x91, 0x8E, 0x2A, 0x48, 0xC2, 0xA8, 0x24, 0x81,
+    0xB6, 0xF9, 0xC4, 0xB6, 0xA0, 0x2E, 0xA5, 0x47, 0xC0, 0x97, 0xB5, 0x0F, 0x09, 0xA8, 0x3A, 0xB5,
+    0x1D, 0x59, 0x4B, 0x37, 0x6A, 0xEE, 0x60, 0x3B, 0x24, 0xB8, 0x81, 0xE7, 0x3D, 0x0A, 0x19, 0x7D,
+    0xD0, 0x0B, 0x77, 0x9A, 0x58, 0xDF, 0x2A, 0x60, 0x84, 0xB7, 0xD4, 0x1B, 0x75, 0x9C, 0xB0, 0x54,
+    0x92, 0x66, 0xC0, 0x18, 0x22, 0x9E, 0x14, 0xC7, 0xDA, 0x0D, 0x7F, 0x48, 0x3F, 0xF8, 0x50, 0x1B,
+    0x5C, 0x72, 0xCE, 0x6A, 0x62, 0x8B, 0x7D, 0xB0, 0x49, 0x77, 0x61, 0x68, 0x17, 0x8B, 0xB1, 0x7D,
+    0xB2, 0x7B, 0xAF, 0xB3, 0x7B, 0x5B, 0xEC, 0x5E, 0x9B, 0x8D, 0x65, 0xFA, 0x4E, 0x3B, 0x58, 0xD7,
+    0x3D, 0x2E, 0xAA, 0x69, 0x4B, 0x2C, 0x20, 0x60, 0xF7, 0xB6, 0x78, 0xC7, 0xE5, 0x85, 0xEE, 0x89,
+    0x3B, 0xB9, 0x94, 0x48, 0x81, 0x92, 0x0E, 0xBC, 0x86, 0x0E, 0xFC, 0x0C, 0x1D, 0xF8, 0x13, 0x74,
+    0x00, 0xA8, 0x11, 0xF7, 0xEB, 0x0E, 0x94, 0xBA, 0x48, 0x07, 0x78, 0x8C, 0xE7, 0xFE, 0x04, 0x1D,
+    0xF8, 0x19, 0x3A, 0xF0, 0xD6, 0xAE, 0x24, 0x88, 0x82, 0x61, 0xD1, 0xD2, 0xC0, 0xCC, 0xFE, 0x1E,
+    0x44, 0x3D, 0xE3, 0xA8, 0xCC, 0xB1, 0xE0, 0x22, 0x38, 0xEA, 0x07, 0x30, 0x41, 0x20, 0xC1, 0x33,
+    0xFA, 0x63, 0x64, 0x19, 0x22, 0x27, 0x5C, 0x83, 0x07, 0xBB, 0x64, 0x76, 0x74, 0xA7, 0xE8, 0x4B,
+    0x98, 0xE5, 0x9F, 0x99, 0xBC, 0x8D, 0xA6, 0x56, 0x86, 0x21, 0x6D, 0xC4, 0xA4, 0xC3, 0xC7, 0x8B,
+    0xE4, 0x9D, 0x71, 0xB8, 0x9D, 0x87, 0x77, 0x84, 0xA3, 0x30, 0x5F, 0x41, 0x1F, 0x33, 0xEE, 0xD8,
+    0x69, 0x2B, 0xA7, 0x6F, 0x89, 0x2E, 0x02, 0x3B, 0x1D, 0x2B, 0xFB, 0x1E, 0xB8, 0xE4, 0xDF, 0xA7,
+    0xCA, 0xFE, 0x0A, 0xE7, 0xBF, 0x82, 0x00, 0xFD, 0xFB, 0x4C, 0x1F, 0xE3, 0x39, 0xC9, 0xB3, 0xA5,
+    0xAB, 0x84, 0xF7, 0x18, 0x25, 0x99, 0x58, 0x4F, 0x31, 0x0A, 0x56, 0xAA, 0xDB, 0x87, 0xF2, 0x32,
+    0x5F, 0xCC, 0x31, 0xBF, 0xE6, 0x7C, 0x1C, 0x5B, 0x59, 0x9E, 0xA1, 0x7C, 0x59, 0x81, 0xE2, 0x73,
+    0x95, 0xB8, 0xF2, 0xC5, 0x80, 0x97, 0x81, 0x57, 0xBE, 0xA4, 0x41, 0xFB, 0xA2, 0x94, 0xFB, 0x62,
+    0x28, 0xF9, 0xE2, 0x25, 0xF5, 0xD5, 0x44, 0xCD, 0x9F, 0xE3, 0xA4, 0x7A, 0x5D, 0xB2, 0x2C, 0x23,
+    0x1C, 0x0B, 0x4F, 0xDD, 0x05, 0xEF, 0x54, 0x9B, 0x11, 0xC4, 0xA1, 0x1B, 0x5E, 0xDC, 0xD1, 0x4B,
+    0x27, 0x98, 0xAC, 0xCC, 0x8B, 0x84, 0xF4, 0x5D, 0x71, 0x8B, 0x90, 0x8C, 0x5D, 0xE1, 0x0A, 0xE4,
+    0x71, 0xFA, 0x84, 0x5C, 0x22, 0xF9, 0xD1, 0x7C, 0xBC, 0x4B, 0x12, 0x70, 0x65, 0x35, 0xD7, 0x59,
+    0xAE, 0x6A, 0xFA, 0x47, 0x82, 0x89, 0x00, 0xF5, 0x24, 0xAF, 0xF4, 0x85, 0x5B, 0x5C, 0xD6, 0x1A,
+    0x53, 0xAC, 0xAE, 0x06, 0x40, 0x74, 0xE6, 0xAA, 0x68, 0xB0, 0xE6, 0x3A, 0x6A, 0x74, 0x06, 0x94,
+    0x05, 0x82, 0x99, 0x92, 0xB6, 0x02, 0x6C, 0xE8, 0x98, 0x25, 0x83, 0x5B, 0x4E, 0xC5, 0x01, 0x70,
+    0x1E, 0xEE, 0xE9, 0x85, 0x57, 0x4F, 0x86, 0xC1, 0x2C, 0x52, 0xC9, 0x40, 0x25, 0xFA, 0xAF, 0x9E,
+    0xE5, 0xAE, 0xD3, 0x10, 0x7D, 0x1D, 0x7C, 0xC2, 0x56, 0x8E, 0x01, 0x8E, 0xAF, 0x7D, 0xA7, 0xBE,
+    0x2E, 0x82, 0x40, 0xE7, 0xD1, 0xD5, 0x15, 0x04, 0xF9, 0xE1, 0xF3, 0x2E, 0x90, 0x0F, 0x3A, 0x92,
+    0x60, 0x13, 0xE8, 0x10, 0x6A, 0x20, 0xE1, 0x25, 0x22, 0x75, 0xBD, 0x32, 0xBE, 0x5E, 0x12, 0x3F,
+    0xD6, 0xD5, 0x50, 0x57, 0xBB, 0xBA, 0xF2, 0x57, 0x56, 0x4B, 0xDE, 0xBE, 0x3A, 0xEE, 0x30, 0x5E,
+    0x70, 0x5A, 0xEE, 0xB9, 0x85, 0x16, 0xB0, 0x5A, 0xCE, 0x6A, 0xF3, 0xB5, 0x4E, 0xE0, 0xAC, 0x43,
+    0x6F, 0xCC, 0x1C, 0x49, 0x9F, 0x98, 0x5D, 0x52, 0x1D, 0x09, 0xAC, 0xC4, 0x37, 0xDD, 0x97, 0x8C,
+    0x03, 0x9B, 0x99, 0x23, 0xA9, 0xA5, 0x73, 0x4C, 0x04, 0x1A, 0xC5, 0x2C, 0xBB, 0x24, 0x95, 0x18,
+    0xB7, 0xAA, 0x61, 0x31, 0x97, 0xBA, 0xB2, 0xB8, 0xFD, 0x2D, 0x57, 0x6F, 0x78, 0x40, 0x0C, 0x71,
+    0x27, 0xCB, 0xA6, 0x92, 0x2D, 0xED, 0xA4, 0x6A, 0xA2, 0xCC, 0xE9, 0xD5, 0x66, 0x61, 0x18, 0xE7,
+    0x32, 0xE1, 0x2A, 0x2D, 0xAB, 0xE2, 0x62, 0x7E, 0xE7, 0x8B, 0xB1, 0xF8, 0xCB, 0x87, 0x12, 0x05,
+    0xF4, 0x05, 0x06, 0x42, 0xCC, 0xCB, 0x30, 0x90, 0xB3, 0x81, 0xAC, 0xBE, 0xA4, 0x27, 0x99, 0xD1,
+    0x44, 0xE7, 0x6F, 0x4A, 0x70, 0xDA, 0xD6, 0xD7, 0x05, 0x9E, 0x2F, 0x5A, 0x4C, 0x22, 0xBA, 0x87,
+    0x2D, 0x31, 0x57, 0x18, 0xF3, 0x55, 0x38, 0xCF, 0xE5, 0x02, 0x4F, 0x64, 0xCA, 0xCA, 0x91, 0x48,
+    0x48, 0x83, 0x3E, 0x7A, 0x18, 0x9B, 0xBE, 0x9A, 0x4E, 0x18, 0x74, 0x0B, 0x54, 0x8F, 0xEA, 0x42,
+    0x97, 0xD2, 0xBF, 0x47, 0xD0, 0xA6, 0xDB, 0x2F, 0xA0, 0x17, 0xDB, 0x0D, 0x81, 0x6F, 0x4E, 0xD6,
+    0x1F, 0x69, 0x23, 0x42, 0xBF, 0xC2, 0x08, 0x77, 0xC2, 0x65, 0x17, 0x4E, 0x68, 0x88, 0x0B, 0xE7,
+    0xC4, 0xFA, 0xB9, 0xEF, 0xE8, 0xC2, 0x29, 0xB4, 0x0B, 0xE7, 0x0D, 0xD5, 0xAC, 0x37, 0xE4, 0xC0,
+    0xFE, 0x82, 0x17, 0xBD, 0xAB, 0x1A, 0x13, 0x4A, 0x00, 0xA3, 0x05, 0xE6, 0x44, 0xD5, 0xFB, 0x8A,
+    0x34, 0x2E, 0x9C, 0x47, 0x3F, 0x79, 0xA2, 0x0B, 0xC7, 0x5F, 0x72, 0xE1, 0x6C, 0xD6, 0x09, 0x5B,
+    0x93, 0x79, 0x76, 0x9D, 0x91, 0xEB, 0x89, 0xFE, 0xBD, 0x5C, 0xFB, 0x74, 0x37, 0xE6, 0x2B, 0xF7,
+    0x6E, 0x7F, 0xF6, 0xF0, 0xD3, 0x17, 0x5B, 0xB1, 0xF7, 0x40, 0x1B, 0xA9, 0x56, 0xB5, 0x26, 0x9F,
+    0xF8, 0xA2, 0x60, 0x33, 0x97, 0xBE, 0xBD, 0xB3, 0x3F, 0x88, 0x4E, 0xE5, 0xC0, 0xAC, 0x2D, 0xA1,
+    0x78, 0xFB, 0xA4, 0xA8, 0x55, 0x65, 0x5B, 0x56, 0xB3, 0x51, 0x7B, 0x91, 0x00, 0x76, 0xAC, 0x43,
+    0xBF, 0x76, 0xCA, 0xD8, 0x36, 0x34, 0x50, 0xE0, 0x34, 0xA5, 0x1C, 0xA3, 0xE6, 0x12, 0xFE, 0x55,
+    0x01, 0x87, 0xCA, 0x1D, 0x37, 0x9E, 0x03, 0x99, 0x13, 0xC1, 0xF8, 0xA7, 0x83, 0xC5, 0xA4, 0xA2,
+    0x40, 0x27, 0x15, 0xA5, 0x75, 0x52, 0x51, 0xC8, 0xC4, 0x02, 0x8B, 0xFE, 0x50, 0x3A, 0x2B, 0x25,
+    0xA9, 0x88, 0x6B, 0xDC, 0x17, 0x82, 0x31, 0x4D, 0x52, 0xD1, 0x9A, 0xF2, 0xC2, 0x9D, 0x30, 0x3E,
+    0x78, 0x10, 0xEA, 0xD5, 0x38, 0x02, 0x5E, 0xB0, 0x13, 0x3D, 0x1D, 0x55, 0x5A, 0xD1, 0x09, 0x07,
+    0x74, 0xE2, 0x48, 0x90, 0xE3, 0x74, 0x27, 0x96, 0xD6, 0x2E, 0x8E, 0x5F, 0x74, 0xED, 0x62, 0x36,
+    0x5B, 0xBB, 0xC8, 0x30, 0x8B, 0x3A, 0xDC, 0x66, 0xDE, 0x05, 0x53, 0x31, 0xDC, 0x15, 0xDB, 0x40,
+    0x2C, 0x6C, 0x08, 0xB1, 0xFD, 0x0E, 0xA4, 0x27, 0x33, 0x4B, 0xC4, 0xC1, 0x5C, 0x80, 0x2B, 0xD0,
+    0xB9, 0x1F, 0xE3, 0x1D, 0x54, 0xE9, 0x18, 0x9B, 0x61, 0xE1, 0x77, 0x1C, 0xE3, 0x39, 0x5E, 0x83,
+    0x6B, 0xA1, 0x6A, 0x59, 0x53, 0x5F, 0x3B, 0x2F, 0x57, 0xA4, 0x61, 0xAA, 0x8B, 0x20, 0x94, 0x09,
+    0x4C, 0x29, 0x54, 0x53, 0xA8, 0x0F, 0xB7, 0xF7, 0x1F, 0x7E, 0x4A, 0x2D, 0x42, 0x96, 0x12, 0x9F,
+    0x4B, 0x75, 0xBF, 0xF3, 0xC1, 0x23, 0xD9, 0x86, 0x81, 0x6C, 0xB0, 0xAE, 0x16, 0xC2, 0x4A, 0x4F,
+    0xAA, 0x36, 0x48, 0x7D, 0xE1, 0x1D, 0x9A, 0x30, 0x7F, 0x5A, 0xA8, 0x77, 0x92, 0xC1, 0x55, 0xAD,
+    0x47, 0xBD, 0x08, 0x1C, 0xE9, 0x2C, 0x8A, 0xA8, 0x86, 0xB5, 0x29, 0xB2, 0x1E, 0x6E, 0xE8, 0xB4,
+    0xD0, 0x58, 0xC9, 0xAE, 0x37, 0xCF, 0x06, 0x76, 0x99, 0x4B, 0x10, 0x3C, 0xD4, 0x89, 0x0E, 0x87,
+    0xCA, 0xF8, 0x3F, 0x7B, 0x6B, 0x39, 0xAE, 0x4F, 0x56, 0x49, 0xE5, 0x5E, 0x83, 0xF5, 0xD1, 0xF5,
+    0xED, 0xBB, 0xCA, 0xDC, 0x2B, 0x25, 0xDC, 0xBA, 0x5C, 0xC6, 0xB2, 0xB6, 0xC4, 0xCE, 0xFA, 0x9D,
+    0x2A, 0xF3, 0xAA, 0x6F, 0xB2, 0xCD, 0xE9, 0x7B, 0x8B, 0x1C, 0x8E, 0xB2, 0x66, 0xAA, 0xCB, 0x6A,
+    0xFC, 0x60, 0xF7, 0xD8, 0xEA, 0x53, 0xC5, 0x08, 0xFD, 0xD8, 0x8A, 0x66, 0xA5, 0x6F, 0x45, 0x87,
+    0xC1, 0x6F, 0xAA, 0xA9, 0xCD, 0x2E, 0xED, 0x1F, 0x01, 0x01, 0xA3, 0xE5, 0xB2, 0xF0, 0xDC, 0xBB,
+    0xD0, 0x6F, 0xB9, 0x85, 0xC1, 0xAC, 0xBC, 0x82, 0x72, 0xB9, 0x95, 0x8E, 0x51, 0xE2, 0xCB, 0x6E,
+    0xDA, 0xFF, 0xA3, 0x2A, 0xF5, 0xAA, 0xDF, 0xA4, 0x9B, 0x53, 0xA8, 0x01, 0x97, 0x17, 0x4A, 0x9D,
+    0x16, 0xDA, 0x5E, 0xB7, 0xFA, 0x76, 0x01, 0x18, 0x9F, 0xE2, 0x45, 0xF4, 0x40, 0x04, 0xD5, 0x3E,
+    0x84, 0xF6, 0x9E, 0xAC, 0xEF, 0x13, 0x6F, 0x3B, 0x98, 0xD1, 0xB3, 0x02, 0xB5, 0x26, 0xD1, 0x5D,
+    0xCA, 0xA5, 0x92, 0xCE, 0xAE, 0x30, 0x79, 0xB0, 0x93, 0x26, 0xA1, 0x38, 0xBB, 0xF2, 0xA1, 0xE4,
+    0xD4, 0x3F, 0x5B, 0x69, 0x14, 0x8F, 0x96, 0x84, 0x02, 0x65, 0xAD, 0xA9, 0xAA, 0xAE, 0xC2, 0xA2,
+    0xB2, 0x24, 0x86, 0x4C, 0x4E, 0x41, 0x47, 0x03, 0x50, 0xF2, 0xB2, 0xAC, 0xEE, 0xDF, 0x92, 0x0D,
+    0x01, 0x34, 0x0C, 0xAA, 0xC1, 0x60, 0xC0, 0xE5, 0xC3, 0x4C, 0x64, 0x49, 0xF0, 0xFD, 0x13, 0x2D,
+    0x96, 0xEB, 0x26, 0x4B, 0xFC, 0xAC, 0x0E, 0xD0, 0xEA, 0xF8, 0x8D, 0xA5, 0x15, 0xA2, 0x2A, 0xDC,
+    0x94, 0x1D, 0x07, 0x2A, 0xD9, 0xCF, 0x4A, 0xF0, 0x5B, 0x7C, 0xA8, 0x5A, 0xE5, 0x98, 0x52, 0xE5,
+    0xD8, 0x89, 0x2E, 0x90, 0x71, 0x88, 0x0B, 0xB7, 0x4B, 0xA7, 0xA0, 0x7F, 0xD8, 0xF9, 0xA0, 0xF0,
+    0xF0, 0xA6, 0x62, 0x73, 0xCA, 0x94, 0xE3, 0xEE, 0x4C, 0xDF, 0x13, 0x0C, 0x15, 0xB5, 0xC1, 0xC9,
+    0x0C, 0x3A, 0x75, 0xAB, 0xB4, 0xD6, 0xA0, 0x8C, 0xB9, 0x1B, 0x7D, 0x4D, 0xF7, 0xEC, 0x73, 0xEA,
+    0x9E, 0xBE, 0x6F, 0x1D, 0xBC, 0xD8, 0xE8, 0x5B, 0x92, 0x4D, 0x64, 0xBF, 0x9C, 0xCE, 0xDB, 0xA9,
+    0x5A, 0x0D, 0x30, 0xD4, 0xC9, 0x34, 0x99, 0xB6, 0xB2, 0xA7, 0xFD, 0x25, 0x13, 0x36, 0xE7, 0x82,
+    0x0E, 0x46, 0x6C, 0x69, 0x54, 0x09, 0x6E, 0xE8, 0x94, 0x86, 0x9A, 0x3D, 0x5E, 0x9B, 0x6B, 0xAE,
+    0xBF, 0x8B, 0x7B, 0xBA, 0x70, 0xD5, 0xA0, 0x92, 0x75, 0x83, 0x4A, 0xAF, 0x1C, 0xD4, 0x99, 0xC6,
+    0xB3, 0xD5, 0x83, 0x5C, 0x8C, 0x7D, 0xC6, 0x8B, 0x27, 0x17, 0x3D, 0x26, 0xF6, 0x92, 0x43, 0x88,
+    0x91, 0x85, 0x13, 0x0E, 0xA1, 0xB6, 0x4E, 0xD7, 0xD2, 0xEA, 0x71, 0xA6, 0xFC, 0xF0, 0x26, 0xDD,
+    0x21, 0x86, 0xD8, 0x4A, 0x7D, 0xE1, 0x05, 0xE1, 0xF2, 0x2E, 0x17, 0x73, 0xFB, 0x37, 0x6A, 0x64,
+    0x81, 0x3B, 0x53, 0xA0, 0x61, 0x9C, 0xBD, 0xD5, 0xA2, 0x68, 0xA6, 0xCE, 0x12, 0x34, 0x6B, 0x4B,
+    0xB4, 0x6B, 0xC8, 0x5F, 0x70, 0x0D, 0x45, 0xDA, 0x0D, 0xC4, 0xA0, 0xE4, 0x34, 0x94, 0x35, 0x0A,
+    0x87, 0xD7, 0xB9, 0x9C, 0x36, 0x08, 0xF5, 0x32, 0x5A, 0x2E, 0xA7, 0x6D, 0xCD, 0x57, 0x07, 0x6A,
+    0xCF, 0x5C, 0xED, 0xA9, 0x73, 0x23, 0x23, 0xEA, 0xD3, 0xC0, 0x94, 0x68, 0x4D, 0x6D, 0xC2, 0x88,
+    0xD5, 0x20, 0x9A, 0x92, 0x73, 0x9F, 0xE1, 0x1E, 0x68, 0x3F, 0x33, 0xE8, 0xAA, 0x39, 0xF4, 0x16,
+    0xA0, 0xBF, 0x00, 0xDB, 0x02, 0xBB, 0x0B, 0x30, 0x16, 0x58, 0x0A, 0xD4, 0x1B, 0x19, 0x49, 0x7A,
+    0x25, 0xFF, 0x1F, 0x29, 0xD9, 0x45, 0x22, 0xAC, 0x18, 0xDF, 0x90, 0xD8, 0xA6, 0xBB, 0x60, 0x12,
+    0xB6, 0x17, 0x9C, 0x8D, 0xE3, 0x06, 0x65, 0xDF, 0xE1, 0x92, 0x85, 0x80, 0x96, 0x89, 0xCF, 0x05,
+    0x0B, 0x8C, 0xC1, 0x68, 0x10, 0xCF, 0x80, 0x04, 0xAB, 0x46, 0x0D, 0x30, 0x0A, 0xC9, 0x45, 0x92,
+    0x3D, 0x63, 0x88, 0x60, 0xB3, 0x30, 0xCD, 0xF4, 0x54, 0x98, 0xC6, 0x3D, 0x19, 0xA6, 0x39, 0x87,
+    0xCD, 0x5C, 0xA2, 0xD3, 0x08, 0xE0, 0xD5, 0x6B, 0xE3, 0xDF, 0xDA, 0x9C, 0x23, 0x40, 0xD4, 0x20,
+    0x80, 0x71, 0x47, 0x2F, 0xA5, 0x3C, 0x5D, 0x64, 0x95, 0x0E, 0xCA, 0xBA, 0xF3, 0xF1, 0x92, 0x3F,
+    0x50, 0x2F, 0x69, 0x17, 0x7B, 0x96, 0xE8, 0xE5, 0x95, 0xB3, 0x34, 0xED, 0xF3, 0xF0, 0xF3, 0x8C,
+    0x67, 0x91, 0xBA, 0xB2, 0xB1, 0xB5, 0x45, 0x49, 0xB5, 0xB4, 0xA6, 0xFA, 0xF2, 0xFC, 0x3C, 0xD1,
+    0xCC, 0xCF, 0x33, 0x9B, 0xE0, 0x2B, 0xB3, 0x09, 0xEE, 0xEA, 0x59, 0x5E, 0xAB, 0x9F, 0x9C, 0x28,
+    0x54, 0xBA, 0xA8, 0x73, 0x51, 0xE5, 0xAA, 0x35, 0xAE, 0x13, 0xC5, 0xD8, 0xD5, 0x81, 0x7E, 0x29,
+    0x2B, 0xC2, 0x28, 0x1B, 0xE1, 0x77, 0xD3, 0xB1, 0x48, 0xB5, 0xFD, 0xBA, 0x74, 0xD5, 0xE9, 0x72,
+    0xA1, 0xDE, 0xF4, 0x48, 0xE9, 0x5D, 0x8F, 0x94, 0xDE, 0xF6, 0x48, 0xE9, 0x7D, 0x8F, 0x94, 0xDE,
+    0xF8, 0x48, 0xE9, 0x9D, 0x8F, 0x94, 0xDE, 0xFA, 0x48, 0xE9, 0xBD, 0x8F, 0x94, 0xDE, 0xFC, 0x48,
+    0xE9, 0xDD, 0x8F, 0x94, 0xDE, 0xFE, 0x48, 0xE9, 0xFD, 0x8F, 0x94, 0xDE, 0x00, 0x89, 0x7C, 0xAE,
+    0xCB, 0x4A, 0xB6, 0x40, 0x62, 0xC0, 0x76, 0xA4, 0xA3, 0xB7, 0x12, 0xB2, 0x95, 0x5D, 0x90, 0x94,
+    0x6C, 0x83, 0xF4, 0x48, 0x92, 0xEE, 0x2D, 0x66, 0xF7, 0x83, 0x5D, 0xE8, 0xC0, 0x6C, 0x1D, 0x99,
+    0x6D, 0xC2, 0x62, 0xDD, 0x45, 0x1F, 0x8F, 0x8E, 0xCE, 0x32, 0x3C, 0x7B, 0x5B, 0xA9, 0x57, 0xA3,
+    0x04, 0x48, 0x98, 0x81, 0x30, 0x83, 0x2C, 0x49, 0xD1, 0x51, 0x70, 0xA4, 0x6F, 0xB3, 0x61, 0xA1,
+    0xBE, 0xCE, 0xE2, 0x91, 0x09, 0x70, 0x60, 0x7D, 0x9E, 0xC5, 0x5B, 0xAD, 0x7B, 0x59, 0xDC, 0x76,
+    0x3E, 0xCA, 0x62, 0xD7, 0xC1, 0x78, 0x39, 0x7F, 0x04, 0x60, 0x0F, 0x01, 0xAC, 0x31, 0x41, 0x69,
+    0x55, 0xCC, 0x32, 0x9D, 0x2E, 0x4F, 0x70, 0xBC, 0x84, 0x66, 0x6A, 0xFB, 0x39, 0x04, 0xA8, 0xC8,
+    0x4F, 0x8E, 0x81, 0xF2, 0x6E, 0x34, 0x5B, 0x72, 0x2D, 0xC8, 0xCD, 0x73, 0xDA, 0x5D, 0x4F, 0xD6,
+    0xCF, 0xE7, 0x57, 0x94, 0x71, 0x1C, 0xEB, 0xC5, 0x3C, 0x8D, 0x04, 0xDC, 0x3F, 0x92, 0xBD, 0x86,
+    0xEC, 0xBD, 0xFE, 0x42, 0x2E, 0x31, 0x8A, 0x71, 0x43, 0x6F, 0xFE, 0x70, 0x7C, 0x63, 0xCD, 0xE6,
+    0x0F, 0xDF, 0xA4, 0x76, 0xF5, 0x51, 0x2A, 0x99, 0x03, 0x92, 0x44, 0xE5, 0xD1, 0x0D, 0x12, 0x10,
+    0xCB, 0xBE, 0x67, 0x2C, 0xA7, 0x2F, 0x9C, 0x53, 0x17, 0x39, 0xCE, 0xFC, 0x6D, 0xD1, 0x4D, 0x10,
+    0x2D, 0x6C, 0xE7, 0xF1, 0x32, 0xBA, 0x48, 0x45, 0xAE, 0x4A, 0xB5, 0x85, 0xC8, 0x6A, 0xFF, 0x3E,
+    0x57, 0xD0, 0x78, 0xDA, 0xFA, 0x6A, 0xEB, 0x2A, 0xD6, 0x55, 0x59, 0xE7, 0xC0, 0x49, 0x65, 0xE9,
+    0x8C, 0x38, 0x3B, 0x75, 0xC4, 0xB0, 0x8C, 0xA4, 0xF2, 0x68, 0x6F, 0xD6, 0x59, 0x4C, 0xA2, 0x28,
+    0xB2, 0x9A, 0x0E, 0xF6, 0x23, 0xE9, 0x06, 0x6F, 0xA0, 0x52, 0x1A, 0x09, 0xCD, 0xD6, 0x21, 0x28,
+    0xDC, 0x20, 0x3D, 0x27, 0xB7, 0x94, 0x56, 0xA4, 0x46, 0x92, 0xDB, 0x25, 0xBE, 0x8D, 0xFB, 0x55,
+    0xE4, 0xEC, 0x25, 0x93, 0x4B, 0x5C, 0x42, 0x5D, 0x68, 0x9B, 0x56, 0xEF, 0x2E, 0x82, 0x51, 0xDC,
+    0xB8, 0x79, 0xBF, 0x53, 0x72, 0x5B, 0x94, 0xAA, 0x74, 0x8F, 0x6F, 0x3E, 0x1C, 0xDC, 0x0D, 0x64,
+    0x00, 0xE2, 0x25, 0x08, 0x62, 0x87, 0xA8, 0x18, 0x96, 0xEA, 0xA7, 0x01, 0xB9, 0x7F, 0x61, 0x57,
+    0x91, 0x0B, 0x99, 0xFA, 0x1A, 0xA5, 0x85, 0x01, 0xFC, 0xA5, 0xA5, 0x63, 0x51, 0x7B, 0xA2, 0x18,
+    0xB9, 0x78, 0x76, 0xFB, 0x17, 0x9B, 0xD1, 0xEA, 0x05, 0x67, 0xDC, 0x8F, 0x80, 0x9A, 0x31, 0x15,
+    0x63, 0xEA, 0xC5, 0x81, 0xE4, 0xCB, 0x5A, 0xC5, 0x2E, 0x94, 0x62, 0x0C, 0x5E, 0xD1, 0x87, 0x4A,
+    0x7C, 0x2A, 0xCF, 0x2A, 0x37, 0xC0, 0x46, 0x18, 0x08, 0x16, 0xD7, 0x63, 0x9D, 0x97, 0x22, 0xBE,
+    0x15, 0xAE, 0x3C, 0x72, 0x3E, 0xDE, 0xAC, 0x66, 0xC9, 0x4A, 0xA2, 0xBC, 0x5B, 0x73, 0x27, 0x87,
+    0x90, 0x78, 0x79, 0xB1, 0xD3, 0xE9, 0x94, 0x7D, 0x8E, 0x9C, 0x00, 0xBF, 0x49, 0x64, 0x1C, 0x49,
+    0xF6, 0xAD, 0xA7, 0xF4, 0x06, 0x69, 0x5C, 0xCF, 0x0E, 0x7C, 0xB1, 0x4A, 0x23, 0x61, 0xCA, 0x26,
+    0x13, 0x6C, 0x25, 0x34, 0xBC, 0xAD, 0xC3, 0x8C, 0x5C, 0x95, 0xE3, 0x77, 0x24, 0xCC, 0x58, 0x27,
+    0x45, 0xE8, 0x85, 0xE3, 0x17, 0xD1, 0x74, 0xBD, 0x22, 0xF6, 0xB3, 0xA2, 0x2B, 0x0B, 0xCE, 0x5B,
+    0x19, 0xA7, 0xC6, 0x8D, 0xBC, 0xD0, 0x96, 0x65, 0x4F, 0x35, 0x89, 0x0A, 0x69, 0x71, 0x99, 0xA1,
+    0xAC, 0x25, 0x54, 0xDF, 0x33, 0x17, 0x49, 0xEB, 0x7C, 0xFB, 0xC3, 0x2C, 0x21, 0x51, 0x01, 0x61,
+    0x37, 0x1A, 0xD1, 0x5B, 0x0B, 0xDB, 0xA1, 0xBD, 0x84, 0x7E, 0x36, 0x89, 0x98, 0xD2, 0xD5, 0xBA,
+    0xB3, 0x27, 0xBB, 0xFB, 0x3B, 0x6B, 0x66, 0x68, 0x0B, 0x49, 0x78, 0x51, 0x0D, 0x17, 0xC7, 0xE7,
+    0x5C, 0xCC, 0x0C, 0xBD, 0x80, 0x95, 0xAA, 0x69, 0xA9, 0xCC, 0xF0, 0xC7, 0x0B, 0xE9, 0xE9, 0x67,
+    0xB3, 0xA5, 0xE5, 0x0C, 0x19, 0xA0, 0x75, 0x18, 0xE1, 0xEF, 0x2F, 0x21, 0xC3, 0x8B, 0xEE, 0x15,
+    0x43, 0x47, 0x36, 0xAD, 0xE7, 0x77, 0x06, 0xFB, 0x99, 0xDE, 0xF8, 0x7A, 0xA2, 0x1A, 0x67, 0x9D,
+    0xDC, 0xCA, 0x15, 0x38, 0x78, 0x8F, 0x5E, 0x7B, 0xC3, 0x50, 0x78, 0xAB, 0x09, 0x50, 0x8F, 0x74,
+    0x61, 0x88, 0xD3, 0x2A, 0x8E, 0x94, 0x9B, 0xB1, 0xCD, 0x3B, 0x75, 0x9B, 0xDF, 0x19, 0x0C, 0xC8,
+    0x67, 0x52, 0x3C, 0x37, 0xD4, 0xEA, 0x56, 0x39, 0x7F, 0xAE, 0x57, 0xA7, 0x90, 0x4C, 0xB9, 0x02,
+    0x1B, 0x1A, 0xFF, 0xF5, 0x69, 0x4D, 0x4E, 0x76, 0x3D, 0x66, 0x82, 0xD0, 0xB5, 0x2E, 0x65, 0x8B,
+    0xE5, 0xF3, 0x0B, 0xD9, 0x4B, 0xA0, 0x94, 0xBD, 0x34, 0x30, 0x5F, 0xD4, 0xAD, 0x08, 0x2E, 0x76,
+    0xC2, 0x73, 0xDE, 0x6F, 0x93, 0x6B, 0xEE, 0x99, 0x4F, 0x6E, 0x74, 0xAE, 0xBD, 0x94, 0x95, 0xBF,
+    0x0B, 0x5C, 0x47, 0xD6, 0x5A, 0xBC, 0xBE, 0x44, 0x86, 0xE7, 0xB7, 0x9B, 0x69, 0x23, 0xD0, 0x4F,
+    0x30, 0x9C, 0x17, 0xEE, 0x9E, 0xA1, 0x83, 0xF6, 0xA3, 0x1A, 0x2C, 0xD2, 0xCB, 0x73, 0xAE, 0x0E,
+    0x5A, 0x05, 0x4E, 0xAF, 0x0E, 0x32, 0x9E, 0xB0, 0x3A, 0x88, 0x63, 0x4D, 0xC6, 0xC4, 0xF2, 0xE3,
+    0xEF, 0x2D, 0xA4, 0xD1, 0xD6, 0xAB, 0x86, 0x1E, 0xED, 0xD4, 0xAB, 0x86, 0x8C, 0xD9, 0xAA, 0xA1,
+    0xC5, 0xE2, 0xEB, 0x0C, 0xF5, 0x95, 0xAB, 0x86, 0xFE, 0x3F, 0x5D, 0xEC, 0xF4, 0x12, 0xA7, 0xE7,
+    0xC5, 0xFB, 0x53, 0x4F, 0x8F, 0x2C, 0x65, 0xD8, 0x5E, 0x31, 0x3D, 0x2F, 0xD2, 0xCF, 0x86, 0x67,
+    0x0B, 0xD3, 0x3E, 0xD9, 0xCD, 0xF3, 0xDD, 0xF8, 0x8E, 0x04, 0x7F, 0x45, 0x36, 0x2C, 0xC8, 0x96,
+    0xD4, 0xF7, 0x97, 0xB1, 0x45, 0xCA, 0x2A, 0xD6, 0x78, 0xBE, 0x3B, 0x90, 0x52, 0x50, 0x58, 0x32,
+    0x38, 0xD7, 0xCE, 0x7C, 0x07, 0x83, 0x27, 0xF3, 0xCE, 0x73, 0xDE, 0x79, 0x35, 0x54, 0xB3, 0xFD,
+    0x15, 0xD5, 0xDE, 0x7C, 0xA1, 0xC9, 0xD9, 0x6E, 0x3E, 0x75, 0x61, 0xA3, 0x5E, 0x36, 0x23, 0x8B,
+    0x4B, 0xAC, 0x8C, 0xB6, 0xC8, 0x8F, 0x70, 0xE3, 0x2B, 0xC6, 0xBF, 0xCE, 0x20, 0x6C, 0x84, 0xDB,
+    0xCA, 0xB9, 0x57, 0xC8, 0x5A, 0xE8, 0x2D, 0x27, 0x54, 0xC5, 0xBB, 0x7A, 0x25, 0xC2, 0xDA, 0x81,
+    0xB0, 0x57, 0x0C, 0x44, 0xF7, 0xC4, 0x40, 0xE4, 0x8D, 0xF2, 0xA2, 0x7D, 0x7F, 0x5E, 0xED, 0xBB,
+    0x39, 0xB1, 0x0B, 0x97, 0xDE, 0x24, 0xC7, 0x5F, 0x1A, 0xFC, 0xB3, 0xD8, 0x99, 0x55, 0x26, 0x3A,
+    0xDF, 0xC2, 0x18, 0xF4, 0x96, 0x4C, 0xDF, 0x17, 0xDD, 0xDF, 0x2A, 0x90, 0x0C, 0xED, 0x17, 0xCF,
+    0x6C, 0x66, 0xFC, 0x90, 0x91, 0xC3, 0x60, 0x6D, 0x62, 0xE1, 0x7C, 0xAF, 0x9D, 0xBD, 0xA7, 0x26,
+    0x37, 0x27, 0x19, 0xFF, 0xAD, 0xE5, 0xFF, 0xA7, 0x0A, 0x8E, 0x73, 0xDB, 0x0B, 0x75, 0x91, 0x03,
+    0xB4, 0x4E, 0x71, 0x80, 0x97, 0xBD, 0x09, 0xD6, 0x4B, 0xCB, 0xF4, 0x3E, 0x5A, 0x08, 0xC1, 0x5E,
+    0x99, 0x97, 0x8D, 0x43, 0x10, 0xEA, 0x58, 0x2F, 0x9D, 0xFB, 0xCE, 0x19, 0xE0, 0x93, 0x7A, 0x39,
+    0x4D, 0x83, 0x0F, 0x5B, 0x4A, 0x7D, 0x1F, 0xCF, 0x74, 0x40, 0x51, 0xF6, 0x9E, 0xFA, 0xD7, 0xCA,
+    0x6D, 0x90, 0x1D, 0x18, 0xF2, 0x66, 0x65, 0xD0, 0x15, 0xF5, 0x1D, 0x73, 0x1B, 0xD2, 0x85, 0xDC,
+    0x86, 0x66, 0xE0, 0x70, 0xE3, 0x06, 0x64, 0x2E, 0x73, 0xA0, 0x37, 0xF3, 0x67, 0xEE, 0x1E, 0x93,
+    0xC1, 0x1C, 0xBA, 0xBC, 0x04, 0xE8, 0xEE, 0x79, 0xB3, 0xEE, 0x8D, 0x57, 0x76, 0x6F, 0xB8, 0xB0,
+    0xED, 0xF4, 0x93, 0x3A, 0x00, 0x56, 0x52, 0xB0, 0xAC, 0xE9, 0x00, 0x33, 0x53, 0xCA, 0xFF, 0x07,
+    0xCD, 0x5A, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0xA5, 0xA3, 0x74, 0x84, 0x8F, 0x57, 0xC8,
+    0x40, 0x70, 0xB2, 0xC4, 0x14, 0x2E, 0x2C, 0x29, 0xBA, 0x75, 0xA9, 0x00, 0xBA, 0x25, 0x93, 0x22,
+    0x41, 0x2A, 0x5D, 0xA1, 0x73, 0x0A, 0x01, 0x91, 0x0A, 0x17, 0x42, 0x12, 0xE0, 0x5C, 0xBA, 0xB8,
+    0x1F, 0xC6, 0x2E, 0x8C, 0x20, 0x45, 0x0E, 0x01, 0x54, 0x26, 0x3E, 0x20, 0x57, 0x18, 0x6A, 0x9C,
+    0x42, 0x85, 0x8A, 0x55, 0x96, 0x48, 0x91, 0x22, 0x4D, 0x18, 0x17, 0x69, 0x5C, 0x84, 0x30, 0x2E,
+    0x08, 0xE0, 0x14, 0xA2, 0x83, 0x35, 0xB4, 0x17, 0xEF, 0xED, 0xF8, 0xFB, 0xDE, 0x90, 0xBC, 0x53,
+    0x22, 0xD9, 0x82, 0xB1, 0xDC, 0x5B, 0x2E, 0x66, 0x76, 0x97, 0x3F, 0x33, 0xF3, 0x7D, 0xEF, 0xCD,
+    0xFB, 0x99, 0xA1, 0xC8, 0x50, 0x44, 0x9C, 0x11, 0x2A, 0xEF, 0x90, 0xD5, 0x63, 0x54, 0xC1, 0x5F,
+    0x51, 0x85, 0xBF, 0x4E, 0x45, 0xA2, 0x20, 0x13, 0x89, 0xBD, 0x5C, 0x64, 0xC5, 0x2B, 0x45, 0x7A,
+    0x0E, 0xAA, 0x21, 0x3E, 0xCE, 0x40, 0x7A, 0xE2, 0x1A, 0x73, 0x28, 0x9E, 0x31, 0x63, 0xF1, 0x3F,
+    0xBD, 0xDF, 0x97, 0x30, 0x93, 0x30, 0x89, 0x12, 0x7C, 0x77, 0x44, 0xFC, 0xBC, 0x8B, 0xC6, 0x8A,
+    0x0D, 0x11, 0xB7, 0x44, 0xE3, 0xB8, 0xFF, 0xD8, 0xC1, 0x2E, 0x65, 0xD4, 0xFC, 0xE2, 0xF1, 0xE1,
+    0xBE, 0x04, 0x68, 0x28, 0xD8, 0xD9, 0x4E, 0x84, 0x2D, 0x49, 0x60, 0x8B, 0x73, 0x2B, 0x43, 0x37,
+    0x59, 0x74, 0x70, 0x2B, 0x8B, 0xF1, 0xBF, 0xA7, 0x25, 0x44, 0x89, 0xB2, 0x2D, 0xD9, 0xCE, 0x62,
+    0xF3, 0x24, 0x0B, 0xCC, 0xBB, 0x99, 0x2C, 0x56, 0xED, 0x84, 0x78, 0x3C, 0x4A, 0xED, 0x37, 0x0F,
+    0x8F, 0x3D, 0xB8, 0x7D, 0xBD, 0xD4, 0x54, 0x04, 0x2A, 0x25, 0xAB, 0xDD, 0xA7, 0xC6, 0x34, 0x0D,
+    0x1A, 0x62, 0x34, 0x77, 0xA5, 0xAC, 0xFA, 0x47, 0x09, 0x73, 0x3B, 0xA8, 0x85, 0x89, 0x12, 0x31,
+    0x97, 0x54, 0x5C, 0xEC, 0xAD, 0x10, 0xD1, 0x9B, 0x68, 0xE2, 0x1F, 0xF8, 0xB7, 0xEC, 0xA1, 0xB1,
+    0x57, 0x65, 0x75, 0xDA, 0xA0, 0x31, 0x0E, 0x7C, 0x97, 0x12, 0x61, 0x80, 0xF1, 0xDF, 0x45, 0x3E,
+    0x1F, 0x88, 0x97, 0x5F, 0x17, 0x47, 0x4E, 0x4D, 0x0C, 0xF4, 0xBC, 0x4A, 0x37, 0x25, 0x8C, 0x1C,
+    0x9D, 0xC9, 0xEF, 0x89, 0xE8, 0x24, 0x41, 0xDF, 0x45, 0x93, 0xCB, 0x6C, 0xFB, 0x07, 0xBB, 0xE2,
+    0xDC, 0x00, 0x07, 0xDD, 0x4D, 0x91, 0x01, 0x44, 0x9D, 0x38, 0x76, 0x1C, 0x57, 0x0E, 0xD8, 0x60,
+    0xEA, 0xEE, 0x47, 0xE8, 0x8D, 0x9D, 0xB9, 0x55, 0x79, 0xA3, 0x94, 0xBE, 0x29, 0xFD, 0xF1, 0x1B,
+    0x65, 0x98, 0xB9, 0x65, 0x47, 0x58, 0x3C, 0x14, 0xBF, 0x8C, 0xD2, 0xA8, 0x0C, 0xCD, 0x61, 0xE9,
+    0x9A, 0xA2, 0xAC, 0xB9, 0x6B, 0x14, 0x3A, 0xA8, 0xF5, 0x7B, 0xEF, 0x1A, 0xB1, 0xBD, 0x8E, 0x3F,
+    0xEF, 0x73, 0x0C, 0xBE, 0xC2, 0xDF, 0x99, 0xBA, 0xCC, 0x4F, 0x83, 0xFB, 0xA0, 0x40, 0xCB, 0x6F,
+    0x55, 0xB2, 0x4F, 0x25, 0xFE, 0x04, 0xCD, 0x51, 0xF6, 0x2B, 0x13, 0x95, 0x3D, 0xD4, 0xFD, 0x0E,
+    0xC6, 0x3E, 0x40, 0x67, 0xDF, 0xED, 0x63, 0xEC, 0xDF, 0x9E, 0x13, 0xAB, 0x72, 0xE2, 0x36, 0x5A,
+    0x70, 0xF1, 0x84, 0x54, 0x7F, 0x6F, 0x1E, 0xF7, 0xFE, 0x56, 0xBC, 0x1F, 0x8E, 0x00, 0x19, 0xBD,
+    0x2F, 0xA1, 0xF9, 0x18, 0x0D, 0x1F, 0x4C, 0x7E, 0x0A, 0x88, 0xA2, 0x73, 0x09, 0xCA, 0x37, 0x84,
+    0x72, 0x03, 0x4D, 0xAC, 0xB8, 0x60, 0x65, 0xF1, 0x24, 0xA6, 0xFC, 0x57, 0x99, 0xFB, 0xD3, 0x28,
+    0x1D, 0xF4, 0xB5, 0x5D, 0xE2, 0xDE, 0x21, 0x98, 0x58, 0x06, 0x13, 0xA7, 0x27, 0xEC, 0x0A, 0x50,
+    0xA2, 0xA4, 0x32, 0xF9, 0xDA, 0x29, 0x8D, 0x62, 0xC4, 0x5F, 0x30, 0x8A, 0xB2, 0xF8, 0x16, 0xFE,
+    0x5E, 0x17, 0xB0, 0x13, 0xDD, 0x62, 0x07, 0x86, 0x57, 0xDF, 0x9C, 0xBA, 0x3F, 0xA0, 0x9A, 0x72,
+    0xD2, 0x63, 0x96, 0xBA, 0x73, 0x67, 0xC4, 0x4B, 0x2F, 0x88, 0xFB, 0x5F, 0x5C, 0xEA, 0x97, 0x52,
+    0x13, 0x32, 0x11, 0x46, 0xB4, 0x2D, 0x3E, 0x27, 0x6E, 0x4E, 0xF4, 0x7F, 0x50, 0xF4, 0xF8, 0xB9,
+    0xDC, 0xA0, 0x77, 0xA6, 0x8F, 0x9E, 0xFE, 0xF7, 0x21, 0xCA, 0x55, 0x9C, 0x9A, 0x27, 0xFA, 0x57,
+    0xDA, 0x41, 0xAF, 0xFA, 0xAF, 0x80, 0xE4, 0x25, 0x56, 0x3F, 0x27, 0x05, 0xBB, 0x33, 0x41, 0xC1,
+    0x12, 0xDA, 0x3C, 0x8F, 0xD6, 0x9C, 0x5C, 0x51, 0xB9, 0x3F, 0x3A, 0x2B, 0x5E, 0x76, 0x41, 0x9C,
+    0x56, 0x94, 0x20, 0x59, 0xFC, 0x3F, 0x3B, 0xB9, 0x28, 0x68, 0xEF, 0x9A, 0x53, 0xD3, 0x10, 0x9E,
+    0x10, 0x0D, 0x7B, 0x73, 0x78, 0xE0, 0x27, 0x8D, 0x9D, 0xA4, 0x5D, 0x6C, 0x4D, 0x1B, 0x5E, 0x95,
+    0x3B, 0xF5, 0xD4, 0x37, 0xCD, 0xD4, 0x5F, 0x95, 0x99, 0x32, 0x91, 0x2E, 0x10, 0x7B, 0xD9, 0x45,
+    0x34, 0x49, 0x02, 0x06, 0x13, 0x9E, 0x0E, 0x34, 0xBF, 0x28, 0x71, 0xF5, 0xCD, 0x9F, 0xC6, 0x24,
+    0x2C, 0xDD, 0xB5, 0x35, 0x35, 0x8F, 0xCF, 0x2A, 0xB8, 0xAE, 0xA5, 0xBB, 0x76, 0xF3, 0xB9, 0xF7,
+    0xF0, 0xF9, 0xBA, 0xAD, 0x06, 0x5E, 0x54, 0xF5, 0x15, 0x55, 0xFF, 0xD7, 0xF7, 0x81, 0x0B, 0x18,
+    0xF6, 0xD7, 0xD3, 0x28, 0x09, 0x30, 0x5E, 0xAF, 0xE8, 0x22, 0xC4, 0xD9, 0x5A, 0xFB, 0x71, 0xB9,
+    0x6D, 0x4C, 0xB9, 0x7D, 0xFF, 0xFE, 0xEE, 0x66, 0xDD, 0x27, 0x87, 0x48, 0xA4, 0x85, 0x93, 0x82,
+    0xD9, 0x1C, 0xA1, 0x51, 0x2A, 0x4E, 0xD5, 0xB4, 0x5F, 0xC1, 0xE7, 0x37, 0x0F, 0x52, 0xF2, 0xB3,
+    0xC2, 0x06, 0xD6, 0x0E, 0xC5, 0x8B, 0xF3, 0x17, 0xEB, 0x39, 0xDF, 0x12, 0xC6, 0x08, 0xFD, 0x2C,
+    0x51, 0x6A, 0xD7, 0x51, 0xDE, 0xC6, 0x58, 0x68, 0xCC, 0xA1, 0x28, 0x5E, 0x32, 0x39, 0xAC, 0xAB,
+    0x8E, 0xF8, 0x87, 0x81, 0x84, 0xFD, 0xB1, 0x5C, 0xF0, 0x47, 0x98, 0x1A, 0x8B, 0xED, 0xE1, 0x59,
+    0x75, 0x12, 0x6F, 0xEC, 0x25, 0xC1, 0x87, 0x46, 0x16, 0x10, 0x3E, 0xD5, 0x7D, 0x4D, 0x48, 0x66,
+    0xBB, 0x9C, 0x03, 0x72, 0x19, 0x02, 0xDB, 0xFE, 0x8B, 0x38, 0x4F, 0x0A, 0xE8, 0xF8, 0x43, 0xA8,
+    0xF6, 0xB7, 0xDA, 0xD4, 0x41, 0x46, 0xE2, 0x03, 0x09, 0xDF, 0xC9, 0x25, 0xFE, 0x4F, 0x22, 0xBD,
+    0xA1, 0xB8, 0xC5, 0xD5, 0xA3, 0x70, 0x63, 0x02, 0xB8, 0x68, 0x2D, 0x37, 0xA8, 0xDE, 0x73, 0xA9,
+    0xCC, 0xDD, 0x86, 0xFC, 0x57, 0xA0, 0x0F, 0x25, 0x42, 0x9A, 0x64, 0xCE, 0x46, 0x22, 0xB8, 0x57,
+    0xCB, 0xBD, 0xB5, 0x84, 0x49, 0xD9, 0x33, 0x0B, 0xE6, 0xAE, 0x96, 0x7B, 0x6B, 0xF2, 0xDC, 0x7B,
+    0xF8, 0x7C, 0xD5, 0xD6, 0xA5, 0x6A, 0x3A, 0xF9, 0xEF, 0x20, 0xBD, 0xF8, 0x15, 0x6C, 0x44, 0x07,
+    0xC9, 0xC6, 0xDB, 0x41, 0x0A, 0x3B, 0x66, 0x15, 0xEF, 0xFC, 0x81, 0x70, 0x7C, 0xEE, 0xC1, 0xF9,
+    0xC2, 0xCF, 0x5D, 0xA4, 0x12, 0x32, 0x44, 0x7A, 0x34, 0x8A, 0xEE, 0xAD, 0x8D, 0x22, 0x63, 0x46,
+    0xD1, 0xA7, 0xF7, 0x3F, 0x88, 0xEA, 0x76, 0x39, 0x8D, 0x72, 0x4D, 0x96, 0xEF, 0x88, 0x31, 0x03,
+    0xE9, 0x98, 0xE2, 0xC8, 0x20, 0x72, 0x12, 0xD1, 0x4B, 0xC2, 0x45, 0x5C, 0x0E, 0x12, 0xE9, 0xFF,
+    0xB9, 0x92, 0xDB, 0x83, 0x96, 0xE5, 0xA6, 0xF9, 0x43, 0xD9, 0xE4, 0x0F, 0xE1, 0x51, 0xFE, 0xE0,
+    0xE6, 0x57, 0x8F, 0x02, 0xE7, 0x49, 0xE8, 0xE5, 0x0E, 0x42, 0x8F, 0xF1, 0x77, 0x24, 0xB8, 0x3D,
+    0x94, 0xB3, 0x0E, 0x32, 0x25, 0xFA, 0xE4, 0xED, 0x74, 0x3A, 0x38, 0xEF, 0xD2, 0xF1, 0xFD, 0x4E,
+    0xBC, 0xF7, 0xE8, 0xF8, 0x98, 0xC8, 0x32, 0x41, 0x00, 0xFD, 0x0F, 0x6B, 0x9C, 0x93, 0xD3, 0x53,
+    0x6D, 0x2A, 0x86, 0x38, 0xFB, 0x85, 0xB8, 0x9F, 0x0D, 0x60, 0x3A, 0x57, 0x70, 0xEA, 0xF4, 0xF4,
+    0xED, 0x3F, 0x45, 0x5B, 0x85, 0xFF, 0x32, 0x18, 0x21, 0xFC, 0xEF, 0x00, 0xA7, 0xD3, 0xAA, 0x6F,
+    0x08, 0x76, 0xC2, 0x11, 0x4C, 0xF4, 0x75, 0x77, 0xE8, 0x65, 0x1E, 0x28, 0xEE, 0x8F, 0xFB, 0x63,
+    0x3F, 0xFF, 0xBA, 0x4F, 0xFF, 0xD0, 0x8C, 0xE3, 0xF4, 0x4A, 0x21, 0xA5, 0x53, 0x86, 0xF9, 0x82,
+    0x3A, 0x92, 0x25, 0xB8, 0xCC, 0xAF, 0xFA, 0xBC, 0x78, 0xCB, 0x76, 0x98, 0x41, 0xCE, 0x21, 0x9E,
+    0xEB, 0xF5, 0x5E, 0x83, 0xA9, 0xEA, 0x3D, 0x7D, 0xC0, 0xAE, 0x3C, 0xDA, 0xA8, 0x48, 0x0B, 0x30,
+    0x31, 0x05, 0x14, 0x24, 0xEE, 0x38, 0x59, 0xCF, 0xE1, 0x66, 0x7C, 0x4E, 0x6A, 0x67, 0xC8, 0xE5,
+    0xAE, 0x11, 0xBD, 0xF8, 0x26, 0xF9, 0xE8, 0x76, 0x49, 0xCC, 0xB3, 0x2A, 0xBD, 0xCA, 0xFB, 0xB6,
+    0x38, 0xEF, 0x7B, 0x7C, 0x76, 0x84, 0x56, 0xBC, 0xD2, 0x1D, 0x4B, 0x87, 0xDC, 0x41, 0x60, 0x81,
+    0xA1, 0x27, 0x3B, 0xD7, 0x08, 0xAE, 0x2B, 0x15, 0xCD, 0xF6, 0x97, 0xC6, 0x0D, 0x03, 0x86, 0x39,
+    0x49, 0xF0, 0xF9, 0x7A, 0x1E, 0xA5, 0x5E, 0x19, 0x23, 0x92, 0xC1, 0xB5, 0x11, 0x64, 0xD2, 0x3B,
+    0x5E, 0x78, 0x0E, 0x0F, 0x0E, 0xA3, 0x04, 0xB6, 0x27, 0x0F, 0x0A, 0xC8, 0x27, 0x95, 0x3E, 0x02,
+    0xAA, 0xE7, 0xF9, 0x6E, 0xF9, 0x29, 0x2B, 0x86, 0xA5, 0xEA, 0xBA, 0x85, 0x79, 0xAB, 0xB5, 0x3D,
+    0x5C, 0x45, 0x91, 0x57, 0xE4, 0x44, 0x68, 0x08, 0x31, 0x8A, 0xF9, 0x51, 0xE5, 0xDD, 0x21, 0x09,
+    0x0F, 0x9D, 0x73, 0x25, 0xA1, 0xF6, 0xEE, 0x93, 0x61, 0x83, 0x36, 0x47, 0x18, 0x53, 0x5E, 0x86,
+    0x01, 0x17, 0xF3, 0x4B, 0xA0, 0x7F, 0x92, 0x33, 0x8C, 0x40, 0x6F, 0x67, 0x1B, 0x71, 0x4C, 0x5B,
+    0x01, 0x2E, 0x69, 0x72, 0x16, 0xFC, 0xAD, 0x90, 0xCE, 0x67, 0x89, 0x6C, 0xF4, 0x60, 0x85, 0xA3,
+    0xA3, 0xE5, 0xAB, 0x09, 0x20, 0x77, 0xB9, 0x5C, 0xE7, 0xEA, 0x42, 0xEC, 0x83, 0xCB, 0xA8, 0x5E,
+    0xEB, 0xA7, 0x33, 0x80, 0xFC, 0x6E, 0x65, 0x5D, 0xC2, 0xF9, 0x1D, 0x71, 0xE9, 0xCD, 0x37, 0x31,
+    0x0D, 0x27, 0x8C, 0xBC, 0x99, 0x4C, 0x64, 0xC0, 0xD1, 0xAC, 0x1C, 0xD5, 0x65, 0x2E, 0x02, 0x37,
+    0xD2, 0x0F, 0xD2, 0xF2, 0x04, 0xA5, 0xCF, 0x41, 0x52, 0xD9, 0xE5, 0x1A, 0xA5, 0x23, 0xC1, 0x47,
+    0x59, 0x5B, 0x5A, 0x00, 0xED, 0x3F, 0x03, 0x89, 0x1F, 0x62, 0x86, 0x2D, 0xAC, 0xA3, 0xC7, 0x33,
+    0x3A, 0x1B, 0x2E, 0xA9, 0x35, 0x48, 0x1A, 0x7D, 0x38, 0x41, 0x2E, 0x2E, 0x61, 0xB2, 0x9B, 0x8F,
+    0xC5, 0xFD, 0xD3, 0x18, 0xC3, 0xC5, 0x09, 0xE8, 0x85, 0x44, 0x6D, 0xE9, 0xC5, 0xCB, 0x75, 0x1E,
+    0xE3, 0x30, 0x35, 0xF5, 0x3E, 0xE1, 0x16, 0x41, 0x82, 0x8E, 0x4E, 0x35, 0xEB, 0xBD, 0x33, 0xE2,
+    0x07, 0x9C, 0xC4, 0x5A, 0xC7, 0x78, 0xA8, 0xB8, 0x80, 0x25, 0x71, 0x92, 0x4A, 0xB5, 0x5B, 0xF3,
+    0x11, 0x36, 0x28, 0xF5, 0xD4, 0x64, 0x30, 0x62, 0xB5, 0x2B, 0x7C, 0x76, 0xBE, 0x4A, 0x93, 0xDA,
+    0xBA, 0x08, 0x6D, 0xCC, 0x3E, 0x0C, 0x0B, 0x58, 0xF2, 0x0A, 0xD2, 0xF4, 0x71, 0x46, 0x9E, 0x4C,
+    0xA2, 0x60, 0x75, 0x83, 0x68, 0xA4, 0x89, 0xEF, 0xA6, 0x82, 0xEA, 0x2A, 0xAA, 0xF8, 0xB9, 0xB5,
+    0xBD, 0xC7, 0xDE, 0xAF, 0x9C, 0x89, 0x12, 0x2E, 0xCA, 0x9A, 0x58, 0xDA, 0x2C, 0x6F, 0x15, 0x71,
+    0x15, 0x73, 0x2A, 0xCB, 0x3F, 0xD6, 0x59, 0xBD, 0x47, 0x87, 0x46, 0xFB, 0xCE, 0xCC, 0xBE, 0xB4,
+    0x27, 0x3A, 0x03, 0x9F, 0x59, 0xFB, 0x8D, 0x34, 0xF8, 0xE7, 0x6D, 0x83, 0x71, 0x21, 0x02, 0x27,
+    0x59, 0xEC, 0x77, 0x24, 0xA4, 0xE8, 0x7F, 0xAB, 0x15, 0x5E, 0x20, 0x67, 0x42, 0xD2, 0x84, 0xAC,
+    0x89, 0xD2, 0xA6, 0xBC, 0x59, 0xE2, 0x9C, 0x63, 0x24, 0x55, 0xEB, 0x09, 0x9B, 0x4D, 0x18, 0x26,
+    0x75, 0x9C, 0x35, 0x2B, 0x2C, 0xDD, 0x6C, 0x48, 0xD2, 0x95, 0x88, 0x30, 0xAB, 0x7D, 0xBF, 0xAC,
+    0xB6, 0xCA, 0x92, 0x8C, 0xED, 0x72, 0x8A, 0xAA, 0x96, 0xAE, 0x89, 0xAA, 0x63, 0xAF, 0x6C, 0xB2,
+    0xFA, 0x7B, 0x78, 0xA4, 0xD9, 0xE2, 0x8A, 0x3B, 0x45, 0x76, 0xB1, 0x41, 0xF3, 0x4D, 0x5D, 0x3A,
+    0xE5, 0x7A, 0x83, 0xF8, 0x44, 0xE4, 0xB7, 0xAC, 0x56, 0x09, 0x33, 0x85, 0x70, 0x48, 0x27, 0xD5,
+    0xE9, 0x6B, 0x4C, 0x14, 0x0C, 0xEB, 0x05, 0xC4, 0x19, 0x22, 0xE9, 0x1C, 0xC6, 0xE3, 0x98, 0xEF,
+    0x67, 0xE2, 0x3D, 0x06, 0x00, 0xFF, 0x7B, 0x46, 0x55, 0xBE, 0x5D, 0x5D, 0x92, 0x19, 0xB3, 0x3C,
+    0xC7, 0xAC, 0xB6, 0x35, 0xDB, 0x47, 0x76, 0xBB, 0x39, 0xDA, 0x67, 0x44, 0xCD, 0xB6, 0x9A, 0xE9,
+    0xC6, 0x80, 0x6F, 0x70, 0x93, 0x76, 0x73, 0x22, 0xD5, 0x0A, 0x3D, 0x63, 0x4C, 0xB3, 0x81, 0x19,
+    0x1B, 0x4B, 0xB8, 0xEF, 0x8E, 0x38, 0x0C, 0x75, 0x8E, 0xE9, 0xF1, 0x05, 0x5D, 0x8D, 0x30, 0x15,
+    0xAD, 0x8D, 0x35, 0x75, 0x49, 0xC8, 0xDD, 0xE9, 0x01, 0xFC, 0x8B, 0x15, 0xBF, 0x78, 0x04, 0x57,
+    0x17, 0x27, 0x71, 0xD1, 0x31, 0x5F, 0x14, 0xBE, 0xF9, 0xA8, 0x68, 0x68, 0x5E, 0xAE, 0x08, 0x5E,
+    0xAE, 0xFE, 0xCF, 0xED, 0x13, 0xED, 0x61, 0x63, 0x6D, 0xB9, 0xFA, 0x28, 0x8F, 0xEA, 0x9C, 0xC6,
+    0xC9, 0x4F, 0x86, 0x86, 0xE3, 0x2F, 0x1D, 0x38, 0xD5, 0x4B, 0x07, 0x0B, 0x47, 0xEB, 0xA2, 0x93,
+    0x61, 0x43, 0xB7, 0xD7, 0x24, 0xD6, 0x7A, 0xEB, 0xC8, 0xF7, 0x58, 0x5B, 0xDE, 0x28, 0x85, 0x57,
+    0x12, 0xFB, 0xBB, 0x05, 0xC7, 0xFE, 0x5E, 0xC6, 0xFA, 0x7D, 0xC5, 0x31, 0xA6, 0x6E, 0x85, 0xFB,
+    0x5A, 0xA7, 0xDF, 0xB0, 0x56, 0x2A, 0x28, 0x8E, 0x48, 0x5F, 0x02, 0x89, 0xD9, 0xA0, 0x03, 0x59,
+    0x58, 0x3A, 0x2A, 0x3E, 0x2A, 0xBD, 0xA0, 0xDB, 0x71, 0x86, 0xB5, 0x62, 0xE8, 0xC6, 0x98, 0x0A,
+    0xEC, 0x94, 0x3D, 0xCB, 0xFD, 0x7B, 0xF7, 0x37, 0x25, 0x10, 0xFF, 0x8B, 0xB0, 0x4D, 0x8A, 0xEA,
+    0x40, 0x48, 0xC0, 0xD7, 0x56, 0x7E, 0x21, 0x24, 0x48, 0xC8, 0x90, 0x90, 0x22, 0x51, 0x8E, 0x2C,
+    0x49, 0x2F, 0xDB, 0xF8, 0x28, 0x69, 0x5C, 0x9D, 0x0D, 0x0B, 0xB8, 0x40, 0x79, 0x3C, 0x82, 0x99,
+    0x0D, 0x96, 0x34, 0x90, 0x50, 0x3A, 0x54, 0x85, 0xAD, 0x83, 0xD6, 0x08, 0x06, 0x91, 0x5E, 0x9B,
+    0x2C, 0xB9, 0xFB, 0x6A, 0x3E, 0xC6, 0xCD, 0x3E, 0x6E, 0x5D, 0xEB, 0x30, 0xEC, 0xAB, 0x3B, 0x52,
+    0xCC, 0x96, 0x46, 0x71, 0x8E, 0xD9, 0x49, 0x26, 0x4D, 0xC5, 0x79, 0x66, 0x47, 0xBE, 0xD0, 0xAE,
+    0x5A, 0xD9, 0x55, 0xFA, 0x7E, 0xCE, 0x4E, 0xBF, 0x30, 0x39, 0xD3, 0xC9, 0x6D, 0x8E, 0x27, 0x39,
+    0x35, 0x5B, 0x24, 0xAD, 0x3A, 0xB4, 0x8E, 0x3E, 0xEE, 0xE8, 0xC3, 0x2D, 0xBF, 0xE4, 0x8F, 0x74,
+    0xE8, 0xAD, 0x52, 0x73, 0xCC, 0xDF, 0xCD, 0x86, 0xE5, 0xB1, 0x41, 0x78, 0x59, 0x85, 0x0B, 0xCD,
+    0xEF, 0xA7, 0x8E, 0xF6, 0x19, 0x59, 0x6E, 0x42, 0x83, 0xE5, 0xE6, 0xDC, 0xB9, 0xE6, 0x1C, 0xE3,
+    0x14, 0xF1, 0xF3, 0x66, 0x70, 0xB5, 0x5D, 0xEA, 0x11, 0xE1, 0x16, 0x6F, 0xEA, 0x68, 0x30, 0x92,
+    0xC2, 0xC6, 0x07, 0x19, 0xDC, 0xAA, 0x57, 0xA0, 0x5F, 0xB7, 0xA4, 0x1D, 0xE5, 0x36, 0x83, 0xF4,
+    0x74, 0x7B, 0x91, 0x69, 0x47, 0xC4, 0x48, 0x31, 0x1C, 0xD4, 0x91, 0xAA, 0x9A, 0xBB, 0x17, 0xA8,
+    0x6E, 0x56, 0x1B, 0xA2, 0x71, 0xF5, 0x22, 0x9B, 0xC6, 0xE6, 0xD6, 0x89, 0x7C, 0x20, 0xB2, 0xD7,
+    0xD3, 0x94, 0x52, 0xDF, 0x8C, 0x2A, 0xA2, 0xC4, 0xCF, 0xC3, 0x34, 0xC8, 0x82, 0x2C, 0x4C, 0xBD,
+    0x3C, 0xC2, 0x59, 0xC4, 0x2F, 0x25, 0x44, 0x32, 0x84, 0xC0, 0x7B, 0x60, 0x72, 0x05, 0xBD, 0x77,
+    0xD0, 0x39, 0xB7, 0xEA, 0x68, 0x74, 0xB5, 0x24, 0xD6, 0x9E, 0x75, 0xED, 0x5E, 0x2F, 0xB7, 0x98,
+    0xB9, 0xFA, 0x34, 0x3D, 0x80, 0xC7, 0x14, 0x53, 0x23, 0xA4, 0xA2, 0xFE, 0x35, 0x59, 0x88, 0xA8,
+    0xBA, 0x61, 0xE6, 0x8C, 0xC2, 0xA4, 0x86, 0x28, 0x01, 0xDF, 0xBA, 0x08, 0x74, 0xB7, 0xF9, 0x6A,
+    0x5D, 0xE9, 0x7E, 0xB7, 0x66, 0x41, 0x6E, 0x36, 0x75, 0x59, 0x33, 0x88, 0x5D, 0x1A, 0x54, 0xF9,
+    0xCC, 0x03, 0xFB, 0xD6, 0x58, 0x90, 0x30, 0xA1, 0x69, 0x5D, 0xDE, 0x9A, 0x2D, 0x88, 0xF9, 0x45,
+    0x2E, 0xEE, 0xBF, 0x0D, 0x52, 0x86, 0xB4, 0x9F, 0x1C, 0x6D, 0x2D, 0x4D, 0x91, 0x02, 0xBB, 0xEB,
+    0x9A, 0xFA, 0x8F, 0x91, 0x29, 0x20, 0xAC, 0xAF, 0x77, 0x5D, 0xDB, 0x84, 0xFE, 0x25, 0xB5, 0x58,
+    0x31, 0x6F, 0x1B, 0xC9, 0x15, 0x7E, 0xBB, 0x63, 0x7B, 0x01, 0x2D, 0x4E, 0xA3, 0x82, 0x06, 0x9C,
+    0x5C, 0xEC, 0x4D, 0xA1, 0x00, 0x8E, 0x20, 0x71, 0x53, 0x5C, 0x21, 0x04, 0x24, 0x77, 0xE3, 0x2B,
+    0x0E, 0x48, 0xE3, 0x2B, 0x2C, 0x04, 0x48, 0x1A, 0xD7, 0x0A, 0x12, 0xA7, 0x50, 0xA1, 0x03, 0x48,
+    0xED, 0xE6, 0xAE, 0x48, 0x15, 0x9C, 0x8A, 0xFC, 0x00, 0x05, 0x70, 0x21, 0xEB, 0x00, 0x27, 0x85,
+    0x0B, 0xE6, 0x62, 0x92, 0xE3, 0xB8, 0x70, 0x99, 0xBD, 0xFB, 0x03, 0x99, 0xDC, 0x1F, 0xD0, 0x24,
+    0xD9, 0x04, 0xEB, 0x1C, 0xC5, 0xCD, 0xF7, 0x66, 0x97, 0x22, 0x25, 0xD9, 0x27, 0x3A, 0x87, 0x9B,
+    0xE1, 0x9B, 0x79, 0x3B, 0x33, 0xEF, 0xED, 0x7B, 0x6F, 0xDE, 0x7B, 0x33, 0x4B, 0x22, 0x27, 0x25,
+    0xBD, 0xDD, 0xFF, 0xB4, 0x7F, 0xA0, 0x7F, 0x9F, 0x1E, 0xD0, 0xE5, 0x95, 0xC8, 0x8D, 0x7D, 0x6A,
+    0x3E, 0x6A, 0x3E, 0xF6, 0x97, 0xDC, 0x1F, 0xD3, 0xD2, 0xE5, 0xB5, 0x1C, 0x97, 0xE3, 0xAD, 0x7B,
+    0x55, 0xBB, 0x7D, 0x74, 0xF4, 0xB0, 0x2C, 0xCB, 0xE2, 0xA8, 0xEA, 0x51, 0xC6, 0x75, 0xB7, 0x65,
+    0xCB, 0x3D, 0xF0, 0x6F, 0x89, 0xEC, 0x9B, 0xF8, 0x51, 0x55, 0xA2, 0xB2, 0x54, 0x6B, 0x47, 0x47,
+    0x29, 0xE3, 0xD7, 0xB7, 0xB6, 0x62, 0x7E, 0xE6, 0xDE, 0x4B, 0xFD, 0x58, 0x52, 0x48, 0x11, 0x75,
+    0x68, 0x40, 0x0D, 0xF2, 0x95, 0x54, 0x32, 0x95, 0x71, 0x40, 0x4D, 0x6A, 0xE1, 0xB9, 0x47, 0x7B,
+    0x98, 0x09, 0x29, 0x20, 0x89, 0xB5, 0x0E, 0xF9, 0xCF, 0x72, 0x89, 0xDF, 0x87, 0x26, 0x78, 0x57,
+    0x07, 0x22, 0x6B, 0x7A, 0xAA, 0xE5, 0xA7, 0x0D, 0x87, 0x7A, 0x32, 0xED, 0x49, 0xD5, 0xF1, 0x55,
+    0xE8, 0x65, 0x18, 0x97, 0x77, 0xB4, 0x97, 0x1A, 0x87, 0xDE, 0xB7, 0x2F, 0xEF, 0xD4, 0xD0, 0x06,
+    0x6C, 0x00, 0xD6, 0x89, 0xBE, 0xFF, 0x8B, 0x9F, 0xB2, 0x4C, 0xF4, 0xC3, 0xC7, 0x9F, 0x10, 0x7D,
+    0xA7, 0x1A, 0xB3, 0xB0, 0x71, 0x0E, 0xDA, 0x73, 0xF4, 0xF3, 0x10, 0x4D, 0x15, 0xAB, 0x9F, 0x9B,
+    0xF5, 0xFA, 0x9B, 0x44, 0x09, 0xF8, 0x32, 0x30, 0x6E, 0xC7, 0x3A, 0x17, 0xD7, 0x35, 0x6E, 0x5E,
+    0xAD, 0xD6, 0x0D, 0x47, 0xB3, 0x75, 0xCD, 0xD9, 0x5A, 0x87, 0x42, 0x9D, 0xE4, 0xA3, 0x82, 0x6B,
+    0x62, 0x02, 0x36, 0xE3, 0x3B, 0x76, 0x32, 0xD2, 0x14, 0x9D, 0x50, 0x34, 0xA1, 0x28, 0xA7, 0x28,
+    0xA6, 0x4D, 0x2B, 0x44, 0x83, 0x12, 0x1A, 0x01, 0xAE, 0x00, 0x5B, 0x1D, 0xD2, 0xC9, 0x84, 0x26,
+    0x03, 0x3A, 0x69, 0xD0, 0x4A, 0x63, 0x38, 0x19, 0x34, 0xB6, 0x0F, 0x3F, 0x3D, 0x5C, 0xC4, 0xC7,
+    0xB8, 0xAE, 0x3D, 0x5A, 0x7B, 0xBC, 0x88, 0x77, 0xD9, 0x4A, 0xC9, 0xC9, 0xAC, 0xBA, 0xE9, 0xE5,
+    0x95, 0x29, 0x7E, 0x45, 0x55, 0x5D, 0x9C, 0x82, 0xDE, 0xAA, 0xEA, 0xA2, 0x14, 0x55, 0xF1, 0x0B,
+    0x72, 0x34, 0xFA, 0x60, 0x44, 0xD6, 0x0B, 0xDB, 0x32, 0xF6, 0x79, 0xB2, 0xEB, 0xA5, 0x92, 0xE7,
+    0x77, 0x85, 0x62, 0x7B, 0x53, 0x5F, 0xA8, 0x56, 0xDD, 0xF7, 0xAB, 0xFE, 0x99, 0xA9, 0xE6, 0x9F,
+    0x7F, 0xD6, 0xA7, 0xB7, 0xF7, 0x5B, 0xDE, 0x6F, 0x5E, 0x94, 0x71, 0x92, 0xB7, 0xE5, 0xDD, 0xBB,
+    0xEF, 0xA9, 0xBC, 0x1B, 0x94, 0xCD, 0x5B, 0xE2, 0x33, 0xB3, 0xE1, 0x15, 0xAD, 0x0D, 0xE7, 0x0B,
+    0x7D, 0x0B, 0x14, 0x6D, 0xE7, 0x9F, 0x59, 0x40, 0x64, 0xB8, 0x97, 0xE4, 0xEA, 0xAA, 0xF7, 0x14,
+    0xCF, 0xB3, 0xE3, 0x36, 0xDD, 0xBF, 0xEB, 0x26, 0xBB, 0xB0, 0x50, 0xA6, 0x0D, 0x8F, 0x92, 0xC7,
+    0x6A, 0x38, 0xA6, 0x3E, 0x89, 0x92, 0x42, 0xFB, 0xAE, 0x15, 0xEC, 0xF7, 0x5C, 0x81, 0xE8, 0x64,
+    0x2A, 0x34, 0x2C, 0x69, 0x1A, 0x43, 0x6D, 0x99, 0x7A, 0xAA, 0x42, 0xBB, 0x9E, 0x92, 0x71, 0x85,
+    0x42, 0xEC, 0x80, 0x4E, 0xD1, 0xD6, 0x0C, 0xED, 0xCF, 0x50, 0x73, 0x8A, 0xFE, 0x45, 0xFF, 0x89,
+    0x96, 0x0E, 0xE8, 0x97, 0xE0, 0xF0, 0xFC, 0x79, 0xA9, 0xA2, 0xB1, 0x5B, 0xAA, 0x0E, 0x14, 0x7B,
+    0x91, 0x0D, 0xF6, 0xBC, 0xCF, 0x4D, 0x50, 0x06, 0xD2, 0x31, 0xB9, 0x94, 0x69, 0xEE, 0x15, 0xED,
+    0x80, 0x8C, 0x91, 0x77, 0x63, 0x30, 0xEA, 0x36, 0xE9, 0xDF, 0x40, 0x21, 0x32, 0x19, 0x8B, 0x7E,
+    0x0C, 0xD4, 0xD5, 0xA7, 0xA3, 0x2C, 0x83, 0xA9, 0x50, 0x3F, 0x0D, 0x1C, 0xA0, 0x32, 0xCE, 0x49,
+    0x12, 0xC2, 0xB0, 0x1F, 0xFA, 0xB0, 0xE7, 0x06, 0x79, 0xC7, 0x2A, 0x19, 0x88, 0x2F, 0x35, 0x75,
+    0xC9, 0x2D, 0xE3, 0xA0, 0x70, 0xCA, 0xB4, 0xD6, 0x3C, 0x86, 0xDB, 0x92, 0x11, 0x9A, 0x75, 0x0A,
+    0x10, 0xF4, 0xBB, 0x74, 0x9F, 0x6D, 0x29, 0xF4, 0x53, 0x4F, 0x19, 0x70, 0x08, 0xA0, 0x96, 0x1F,
+    0xEF, 0x2E, 0xD3, 0xFD, 0x1B, 0x3C, 0x2E, 0x63, 0xCC, 0x84, 0xB0, 0x2E, 0x4C, 0xC9, 0xFC, 0x29,
+    0x60, 0x05, 0x5B, 0xFE, 0x9D, 0x8C, 0x76, 0x97, 0x85, 0xC2, 0xAA, 0x6B, 0x10, 0x18, 0xA1, 0x12,
+    0x40, 0x16, 0xA1, 0xE0, 0x03, 0x86, 0x56, 0xA1, 0x40, 0x07, 0xDC, 0x7D, 0xE5, 0x7F, 0x94, 0x61,
+    0x7F, 0x1D, 0xFD, 0x84, 0x4C, 0x8B, 0x56, 0x6F, 0x74, 0x9B, 0xB0, 0x63, 0x47, 0xBE, 0xA7, 0x28,
+    0xF0, 0x9F, 0x6B, 0xC2, 0xAC, 0x21, 0xCC, 0xF7, 0xE1, 0x3A, 0x4F, 0x60, 0x4B, 0xD3, 0xC2, 0xF6,
+    0xAE, 0xDE, 0x58, 0x62, 0x39, 0x21, 0x19, 0x32, 0x14, 0x1D, 0x93, 0xFB, 0x22, 0x16, 0x1F, 0x29,
+    0xDF, 0xC9, 0x96, 0xC9, 0xAC, 0xD3, 0xCE, 0x26, 0x26, 0x56, 0xA8, 0x10, 0xC6, 0x57, 0x41, 0xDC,
+    0xA3, 0xA7, 0x88, 0x5E, 0x6C, 0x54, 0xE6, 0xE4, 0xF4, 0x84, 0xC9, 0xEA, 0x67, 0x8D, 0xE7, 0x71,
+    0xB5, 0xA6, 0x03, 0x0D, 0xA7, 0xE5, 0x0A, 0xBC, 0x83, 0xE2, 0x36, 0x05, 0xA9, 0xC8, 0x82, 0x38,
+    0x88, 0x2D, 0x25, 0x64, 0xC7, 0x6A, 0x82, 0x13, 0xF4, 0x48, 0xC0, 0x85, 0x79, 0x98, 0xC8, 0xCB,
+    0x38, 0x35, 0x38, 0x79, 0xC1, 0x39, 0x29, 0xD1, 0x42, 0x0F, 0x29, 0x50, 0xC2, 0xF4, 0x28, 0xCA,
+    0x84, 0x69, 0xD0, 0xCB, 0x9C, 0x62, 0xAC, 0xEE, 0x61, 0x8D, 0x4C, 0x83, 0x98, 0x73, 0x85, 0x97,
+    0x31, 0x13, 0xB0, 0x62, 0x26, 0x3D, 0xB2, 0x69, 0x15, 0x6F, 0x0F, 0xE0, 0x46, 0x37, 0xD0, 0xE2,
+    0x08, 0xA2, 0xAB, 0x58, 0x3E, 0x10, 0xA6, 0xFA, 0xF5, 0xF0, 0x73, 0x4D, 0x77, 0xFA, 0x6B, 0xE1,
+    0xE7, 0xE8, 0x33, 0x3F, 0xAA, 0x5D, 0xB1, 0x41, 0xFB, 0x43, 0x61, 0x26, 0x22, 0x1F, 0xF0, 0xAB,
+    0xAD, 0x27, 0xFA, 0x65, 0x86, 0x84, 0x5A, 0xD0, 0xF7, 0x72, 0x88, 0x90, 0x87, 0xB0, 0x9D, 0xAC,
+    0x81, 0x23, 0x03, 0xA2, 0x9B, 0x31, 0xD1, 0xBF, 0xE0, 0x89, 0xBC, 0xEF, 0x13, 0x10, 0xE0, 0x91,
+    0x55, 0x64, 0x2B, 0x9D, 0x29, 0x18, 0x73, 0xC6, 0xF5, 0xFC, 0xCA, 0xE9, 0xE1, 0x31, 0x61, 0xB0,
+    0x0F, 0x3F, 0xC0, 0x3C, 0xFB, 0xB9, 0x48, 0x97, 0xA1, 0x2A, 0x47, 0x47, 0x17, 0x0C, 0x3F, 0x81,
+    0x8A, 0x6F, 0x4F, 0xEA, 0x98, 0xA0, 0x00, 0x98, 0x33, 0xF9, 0x99, 0x81, 0x97, 0x60, 0xD6, 0xAE,
+    0xB3, 0x14, 0x4C, 0x3B, 0x4D, 0x10, 0xEC, 0x64, 0xE4, 0x64, 0xE4, 0x2A, 0x4C, 0x90, 0x4F, 0xBC,
+    0xEC, 0xA6, 0xDD, 0xE5, 0x1D, 0x1B, 0x7D, 0x05, 0xB9, 0x63, 0x12, 0xBF, 0x25, 0x1F, 0x6E, 0xEC,
+    0xC5, 0x37, 0x45, 0xDA, 0x72, 0xD5, 0x0E, 0xE9, 0x79, 0x51, 0x85, 0xBE, 0x80, 0x64, 0xE7, 0x90,
+    0xE5, 0x3B, 0xEA, 0x69, 0x25, 0x52, 0x79, 0x3C, 0xB6, 0xC8, 0x52, 0x59, 0x1E, 0xD6, 0x61, 0x3E,
+    0x8D, 0xCB, 0xA0, 0x5B, 0x23, 0x9D, 0x4E, 0x8D, 0x8C, 0x83, 0x4A, 0x15, 0xA7, 0x90, 0x75, 0xC8,
+    0x7F, 0xF7, 0x9A, 0xED, 0xD8, 0x13, 0xAC, 0xD9, 0x6C, 0xFC, 0x9F, 0x22, 0xF9, 0x1C, 0xB2, 0xE9,
+    0x3B, 0x07, 0x22, 0xFD, 0xE3, 0xB7, 0x29, 0x39, 0x1E, 0x19, 0x6F, 0xF2, 0xA5, 0x3D, 0x8C, 0xB4,
+    0x57, 0xF2, 0x89, 0x14, 0x82, 0x9B, 0xCB, 0x72, 0xEC, 0x41, 0x62, 0x71, 0xCC, 0x2C, 0x40, 0x21,
+    0x3F, 0x4E, 0xC9, 0x35, 0x90, 0x33, 0xF4, 0x33, 0xF2, 0x34, 0x8E, 0x9F, 0x3D, 0x01, 0xDB, 0xA8,
+    0xDB, 0xB0, 0xC8, 0x2C, 0xA1, 0x62, 0xEB, 0xEC, 0x65, 0x82, 0xAC, 0x91, 0x38, 0x17, 0x38, 0xA6,
+    0x52, 0x94, 0xF3, 0xAA, 0xAC, 0xCF, 0x30, 0x56, 0x05, 0xC3, 0x2E, 0xF3, 0x57, 0x95, 0x50, 0xC1,
+    0x8C, 0x82, 0x6A, 0x0A, 0xAF, 0xA6, 0x68, 0xD6, 0x14, 0x7C, 0xCC, 0xF5, 0xE9, 0x62, 0x7D, 0xF5,
+    0xF8, 0xE0, 0xDE, 0xA8, 0xD8, 0x7E, 0x18, 0x8D, 0xA3, 0x93, 0xEB, 0x3D, 0x6A, 0x9F, 0xAB, 0x3D,
+    0x3E, 0x8C, 0x2E, 0x8C, 0xB6, 0xAF, 0x0F, 0xA2, 0x93, 0xB5, 0xC3, 0x69, 0x82, 0x2D, 0x33, 0xAF,
+    0xD4, 0xB0, 0x4B, 0x11, 0x95, 0x63, 0x6A, 0x3B, 0x27, 0x9D, 0x1F, 0x0D, 0xAB, 0xB3, 0x37, 0x24,
+    0x0B, 0xC1, 0xAC, 0xAB, 0x07, 0x7B, 0x16, 0x73, 0x0A, 0xEB, 0x98, 0xBE, 0x26, 0x0F, 0x9A, 0x84,
+    0x29, 0xC2, 0x68, 0x3A, 0xC5, 0xEA, 0xD5, 0xCA, 0xD7, 0x8A, 0x9E, 0xF7, 0x6C, 0xE2, 0xEB, 0xC8,
+    0xFD, 0xCA, 0xBD, 0xC7, 0x76, 0x1F, 0x9C, 0x93, 0xD3, 0x27, 0x9E, 0x5B, 0x99, 0x89, 0xE7, 0x67,
+    0x10, 0xCE, 0xCF, 0x20, 0x1A, 0xB6, 0x84, 0x3A, 0xDC, 0x84, 0x9C, 0xFD, 0x6D, 0xD3, 0xE1, 0xA6,
+    0x87, 0xC6, 0x29, 0xD0, 0xF8, 0x1A, 0x86, 0x0E, 0x91, 0xEA, 0x38, 0x5D, 0x28, 0x9B, 0x8D, 0xF1,
+    0xF6, 0xAA, 0x49, 0xCF, 0xBC, 0xDC, 0x89, 0xF1, 0x32, 0x99, 0xE1, 0xC5, 0x52, 0x03, 0x03, 0x53,
+    0x1E, 0xB3, 0x93, 0x03, 0xA7, 0xCC, 0x69, 0x20, 0xE1, 0x23, 0x03, 0xB9, 0xFF, 0x20, 0x85, 0x4A,
+    0xBE, 0x42, 0xE3, 0xA9, 0x6E, 0xDD, 0xF8, 0xDC, 0x04, 0x29, 0xF6, 0x31, 0xC1, 0x66, 0x82, 0xBA,
+    0x05, 0x4F, 0x41, 0x03, 0x87, 0x6C, 0xB1, 0x9D, 0x5A, 0xBC, 0xFB, 0xB6, 0x99, 0x95, 0x06, 0x21,
+    0x63, 0x0F, 0xF9, 0x3A, 0x33, 0x01, 0x15, 0xB2, 0x67, 0xC4, 0x63, 0xC8, 0xF6, 0xB8, 0x87, 0x1E,
+    0xC0, 0x1F, 0xCD, 0xD6, 0xD6, 0x4F, 0x34, 0xF3, 0xAF, 0xFC, 0xA4, 0x36, 0x33, 0x7B, 0xB5, 0x5B,
+    0xFB, 0x09, 0x7B, 0x7F, 0x95, 0xCC, 0x08, 0x99, 0xD4, 0xA6, 0x45, 0x51, 0x47, 0x4D, 0x52, 0x4E,
+    0xE2, 0x0F, 0x92, 0x32, 0xDB, 0x09, 0x4B, 0x03, 0x28, 0x00, 0xE3, 0xD7, 0x00, 0xCF, 0xE5, 0x00,
+    0x0D, 0x48, 0x77, 0xD6, 0xDF, 0xA7, 0x1D, 0xDC, 0xF4, 0x16, 0x81, 0x55, 0xC8, 0x4F, 0xDB, 0x47,
+    0x87, 0x02, 0x37, 0x65, 0x59, 0xBE, 0xEC, 0x82, 0xCD, 0x7A, 0x04, 0x48, 0x5E, 0x01, 0x51, 0x0D,
+    0x01, 0xC0, 0xC7, 0x7A, 0x1A, 0x95, 0xE3, 0xED, 0xA3, 0x87, 0x1C, 0x7C, 0x29, 0xE4, 0xD4, 0x3B,
+    0x98, 0x04, 0x14, 0x80, 0xF1, 0x6B, 0x80, 0xE7, 0x0D, 0xD6, 0xAB, 0xA4, 0x7C, 0x59, 0x67, 0x86,
+    0x3A, 0x7C, 0x64, 0x05, 0x1F, 0xC8, 0x6B, 0x7A, 0x74, 0x5C, 0xEA, 0x9F, 0x97, 0x93, 0x7D, 0x8A,
+    0x60, 0x9B, 0x3F, 0x6B, 0x72, 0xFE, 0x81, 0x04, 0x6F, 0x78, 0x37, 0xF7, 0x90, 0xDC, 0x56, 0xAD,
+    0x0D, 0x47, 0xA8, 0xED, 0x0B, 0xDE, 0xD7, 0x80, 0x19, 0x23, 0x58, 0x59, 0xC6, 0x7C, 0x97, 0x9E,
+    0xFA, 0xC6, 0x22, 0xB9, 0xF2, 0x1B, 0x28, 0x0B, 0xA4, 0xF1, 0xFF, 0x4B, 0x79, 0xFA, 0x3A, 0xB4,
+    0x3D, 0x7A, 0x32, 0x24, 0x33, 0x70, 0x75, 0x03, 0xF2, 0x70, 0x68, 0xA5, 0x4C, 0x1C, 0xD8, 0xAF,
+    0x80, 0xAE, 0x8D, 0x6B, 0xC3, 0x49, 0x0F, 0x93, 0x62, 0x7E, 0xD2, 0xC9, 0x5B, 0x6E, 0xD1, 0x67,
+    0xE7, 0x24, 0x67, 0xB4, 0x0F, 0xEF, 0x4D, 0x11, 0x48, 0xFB, 0x48, 0x72, 0x1D, 0x7A, 0x50, 0xFE,
+    0xEE, 0x01, 0x1F, 0x28, 0x09, 0x1C, 0x82, 0x43, 0x7F, 0x1B, 0xD3, 0xCE, 0x3D, 0xEB, 0xBE, 0xC8,
+    0xB9, 0xF9, 0xB5, 0x9C, 0xFC, 0x18, 0x41, 0x83, 0x83, 0xC7, 0xE7, 0xBB, 0xBC, 0x50, 0x9C, 0x03,
+    0x62, 0x6B, 0x79, 0x3E, 0x98, 0xEE, 0x28, 0x2D, 0x3E, 0xC7, 0xC5, 0xE4, 0x3F, 0x7F, 0x4D, 0xF9,
+    0xCE, 0x4F, 0xC1, 0x89, 0x3D, 0x0C, 0xD7, 0xFE, 0x30, 0x79, 0xC4, 0x9F, 0x01, 0xF4, 0xDF, 0xBF,
+    0xC5, 0xE2, 0x8B, 0x17, 0x99, 0xF7, 0x21, 0xEE, 0x34, 0xAE, 0xB2, 0x34, 0xB3, 0x12, 0xC2, 0x06,
+    0x51, 0x5A, 0xF5, 0xAF, 0x2E, 0x1C, 0x56, 0x09, 0x9F, 0x06, 0xF6, 0x2A, 0xF2, 0xBA, 0xC2, 0x76,
+    0x9C, 0xF2, 0xC1, 0x85, 0xC1, 0x74, 0x03, 0x4F, 0x09, 0x5D, 0x74, 0x70, 0x59, 0x79, 0x86, 0x07,
+    0x92, 0xEF, 0x66, 0x39, 0xAE, 0x30, 0xDE, 0x33, 0xBD, 0x4B, 0x2D, 0xBE, 0xE3, 0xD2, 0xEE, 0x2D,
+    0xEF, 0xD7, 0x19, 0xDD, 0xBF, 0xBD, 0x34, 0x77, 0x7A, 0x54, 0x52, 0x44, 0xB6, 0x0D, 0x17, 0x74,
+    0x12, 0xF6, 0x61, 0x5F, 0xB1, 0x84, 0x32, 0x63, 0x19, 0xFD, 0xAC, 0xC1, 0x36, 0xBE, 0x94, 0xAE,
+    0xBA, 0x11, 0xD7, 0xEF, 0xB2, 0xED, 0xD5, 0x33, 0x3A, 0x7B, 0x19, 0xF3, 0xF4, 0x75, 0x85, 0x5F,
+    0xC6, 0xED, 0xCA, 0xBC, 0xFC, 0xE9, 0xD4, 0xBB, 0xDE, 0x54, 0x7E, 0xDB, 0x2A, 0x2B, 0x3F, 0xAE,
+    0x9C, 0xC9, 0x5E, 0xE3, 0xEC, 0x3B, 0x3A, 0x49, 0xE7, 0x0A, 0xB9, 0x2C, 0x8B, 0x4D, 0x70, 0xB6,
+    0x71, 0xF6, 0xBF, 0x82, 0x77, 0x83, 0x95, 0x4A, 0x58, 0xAE, 0x84, 0xC5, 0xEA, 0x4C, 0xB5, 0x7E,
+    0x4D, 0x89, 0xCF, 0x70, 0xAE, 0x92, 0xE8, 0x9C, 0x65, 0x9A, 0xA7, 0x2D, 0x3E, 0xAA, 0x71, 0x8B,
+    0xF0, 0x75, 0x13, 0xC7, 0x04, 0x5A, 0x9C, 0x78, 0x6E, 0xDA, 0xB4, 0xFF, 0x40, 0x34, 0xCF, 0xAD,
+    0xDC, 0x3E, 0x1A, 0xE1, 0x8B, 0xDE, 0xFE, 0x8F, 0xA0, 0x8E, 0x2C, 0x7E, 0x71, 0x8D, 0x13, 0x37,
+    0x71, 0xC8, 0x78, 0xE0, 0x66, 0x79, 0x8A, 0x82, 0xF9, 0xF3, 0xBD, 0xE1, 0xCC, 0xCA, 0x6F, 0xF1,
+    0x5D, 0x6F, 0x30, 0x19, 0xDA, 0x20, 0xEC, 0x4E, 0x26, 0xF6, 0x3E, 0x64, 0xBF, 0x5D, 0x69, 0x30,
+    0x99, 0x20, 0x2E, 0xD0, 0xDE, 0xA6, 0x06, 0x56, 0xF0, 0xF7, 0x2D, 0x0F, 0xCF, 0x7D, 0x3E, 0xBE,
+    0xC1, 0xA7, 0xE7, 0x5B, 0x55, 0x5D, 0x94, 0x22, 0x1A, 0x87, 0x85, 0x34, 0x5E, 0x26, 0xD4, 0x22,
+    0xEB, 0x99, 0xC2, 0x89, 0x85, 0xF2, 0x32, 0x69, 0xC2, 0x02, 0x9F, 0x56, 0x0B, 0x51, 0xB8, 0xA9,
+    0xAF, 0x37, 0xD7, 0x37, 0xD7, 0xF9, 0x14, 0x5F, 0x50, 0x8F, 0xF4, 0xCD, 0x34, 0xFF, 0x1F, 0xED,
+    0x53, 0x31, 0x6F, 0x13, 0x31, 0x14, 0xFE, 0x6C, 0x4B, 0xB1, 0xE8, 0xA9, 0x98, 0x19, 0xB5, 0xBD,
+    0x54, 0xEA, 0x80, 0x50, 0x9A, 0xAC, 0x45, 0xBA, 0x24, 0xFE, 0x07, 0x54, 0x48, 0x29, 0x43, 0x86,
+    0xFC, 0x84, 0x06, 0xC9, 0x45, 0x51, 0x13, 0xB5, 0xFE, 0x09, 0xDD, 0x59, 0xB2, 0x36, 0x42, 0x1C,
+    0x43, 0x07, 0x18, 0x68, 0xFC, 0x0F, 0xB8, 0x85, 0xFD, 0x06, 0x06, 0x98, 0x7A, 0x43, 0x90, 0xD2,
+    0x21, 0x35, 0xCF, 0x97, 0x80, 0x2A, 0x8A, 0x10, 0x0B, 0x1B, 0x7E, 0xDF, 0xDD, 0xF9, 0xEC, 0xEF,
+    0xDE, 0x7B, 0x9F, 0xDF, 0x3B, 0x3E, 0x87, 0xF2, 0xA8, 0x47, 0x2E, 0x11, 0x6E, 0xC4, 0xB3, 0x01,
+    0xCF, 0x07, 0x2C, 0x60, 0xC4, 0xF3, 0x44, 0x64, 0x2D, 0xE9, 0x62, 0xAF, 0xE5, 0x02, 0x61, 0x98,
+    0x2A, 0xFA, 0x66, 0x35, 0xAA, 0x58, 0x03, 0xDA, 0xC0, 0x14, 0xB8, 0x82, 0xF8, 0x88, 0xE8, 0x29,
+    0xB6, 0x14, 0x12, 0x85, 0xCB, 0x74, 0x3C, 0xF5, 0x05, 0x14, 0x96, 0x58, 0x9B, 0xE8, 0xD8, 0xDB,
+    0x5D, 0xA0, 0x56, 0xA2, 0xBD, 0x40, 0x7D, 0x6A, 0x21, 0x1D, 0x44, 0x46, 0x78, 0x20, 0x5C, 0x2B,
+    0xB5, 0x8D, 0xA5, 0xFB, 0xA9, 0x96, 0xDE, 0x2A, 0x0D, 0x22, 0x27, 0xC0, 0xB1, 0xD7, 0xA7, 0xAF,
+    0x28, 0xA3, 0x90, 0x4B, 0xC2, 0xF2, 0xA6, 0xC8, 0x54, 0xEA, 0xC4, 0x4D, 0x20, 0x3E, 0x9E, 0x9C,
+    0xB5, 0x3D, 0x7D, 0xEE, 0x20, 0x6D, 0x88, 0x12, 0x03, 0xCD, 0xF2, 0x9B, 0x0B, 0xA0, 0x00, 0xCF,
+    0x57, 0x3B, 0xFC, 0x9A, 0x94, 0xE9, 0xA6, 0x08, 0xCA, 0xEA, 0xD2, 0xA9, 0x2B, 0xC8, 0x1B, 0xC4,
+    0x3D, 0x4B, 0xB2, 0x06, 0x3C, 0xA3, 0x7B, 0x23, 0x75, 0x51, 0xE9, 0xB0, 0x32, 0x07, 0xA9, 0x4C,
+    0xA4, 0xA3, 0xF5, 0xA0, 0x9E, 0xE7, 0xAD, 0x6E, 0x1E, 0x2F, 0x32, 0xF6, 0xAC, 0x8C, 0x12, 0xD9,
+    0x87, 0x53, 0xC4, 0xB3, 0xC0, 0x64, 0x10, 0x36, 0x98, 0xF7, 0xCF, 0x3F, 0x85, 0x27, 0xD7, 0x80,
+    0xF7, 0x9D, 0xCE, 0x64, 0xE2, 0xC9, 0x53, 0xA7, 0xE3, 0x3D, 0x71, 0xB4, 0xB0, 0x0A, 0x5B, 0x24,
+    0x37, 0x21, 0xDB, 0x2B, 0x2D, 0xCC, 0x76, 0x71, 0x1F, 0x51, 0xF0, 0x87, 0x7D, 0x7A, 0xDB, 0xA4,
+    0xCC, 0x23, 0x48, 0xE2, 0x0A, 0x47, 0x46, 0xBE, 0xA4, 0x8E, 0x68, 0x6D, 0x17, 0x03, 0x8A, 0xF3,
+    0xE2, 0x06, 0xA7, 0x5D, 0x3B, 0xE2, 0xCE, 0xB0, 0x5F, 0x51, 0x65, 0x96, 0xFF, 0x75, 0xCD, 0xD8,
+    0x38, 0x2A, 0x5A, 0xC5, 0x45, 0x81, 0x3B, 0x46, 0x9A, 0xDB, 0x5E, 0x3F, 0x8A, 0x5C, 0xC8, 0x28,
+    0x88, 0xD4, 0xE1, 0x1C, 0x47, 0x60, 0x45, 0xA8, 0x0E, 0x4D, 0x4F, 0xBD, 0x23, 0x44, 0xD7, 0x81,
+    0xB6, 0x23, 0x4B, 0x8E, 0x74, 0xEC, 0x10, 0x11, 0x39, 0x8E, 0x57, 0xF5, 0xA3, 0xC5, 0xCB, 0x9F,
+    0xF5, 0xFB, 0xDF, 0x10, 0xFF, 0xB0, 0x21, 0xD8, 0x39, 0x54, 0x6A, 0x03, 0x99, 0x3B, 0x3E, 0x75,
+    0xF1, 0x81, 0x4B, 0xB8, 0xDB, 0x13, 0xAE, 0xD9, 0x73, 0xD1, 0xCC, 0x55, 0x3E, 0xA3, 0xFE, 0x06,
+    0x46, 0xEA, 0xB7, 0x21, 0x13, 0xFB, 0xAD, 0xA3, 0x0B, 0xFA, 0x5D, 0x81, 0xD6, 0x81, 0x26, 0x89,
+    0xB4, 0xDB, 0x48, 0x31, 0x10, 0xAE, 0xE0, 0xAE, 0x60, 0xD9, 0x12, 0x86, 0x4E, 0xBA, 0xA7, 0xE5,
+    0x1C, 0x3B, 0xCC, 0xD6, 0x28, 0x3F, 0x05, 0xF1, 0x1A, 0x6C, 0x16, 0x40, 0x13, 0x7A, 0xA5, 0x45,
+    0xC3, 0xB2, 0xCA, 0x17, 0xD4, 0x53, 0x1D, 0xE2, 0xB2, 0x0C, 0x2C, 0x6F, 0xFB, 0x3C, 0x41, 0x56,
+    0xE3, 0x4E, 0x75, 0x2D, 0x5F, 0xA0, 0x5A, 0x46, 0x59, 0xE2, 0xE8, 0x1C, 0xC3, 0xD4, 0x8E, 0xC4,
+    0x6F, 0x5A, 0xB6, 0x4F, 0x5D, 0x7B, 0x8B, 0x69, 0x2A, 0x30, 0x5B, 0x30, 0x03, 0x1C, 0xE5, 0x18,
+    0x3A, 0x9C, 0x64, 0x30, 0x17, 0x30, 0x09, 0x8C, 0x42, 0x5F, 0xDA, 0xAA, 0xB9, 0x35, 0xFA, 0xDB,
+    0xEF, 0xD6, 0xCE, 0x86, 0xE9, 0xF1, 0x7C, 0x24, 0xB2, 0x1A, 0xA5, 0xBC, 0x61, 0x84, 0xBD, 0x73,
+    0xF5, 0xB9, 0xDD, 0xD8, 0x7E, 0xFF, 0xA7, 0xE8, 0xE5, 0xAE, 0x2E, 0x77, 0x33, 0x83, 0x3C, 0x20,
+    0xFC, 0x2D, 0xEE, 0xA4, 0x6B, 0x5F, 0x2E, 0x6E, 0x25, 0x46, 0x95, 0xFF, 0x1A, 0x4E, 0x72, 0xAF,
+    0xEC, 0x1E, 0x45, 0x8A, 0x3F, 0x94, 0x6D, 0x2B, 0xF1, 0xA4, 0x87, 0xC6, 0x1C, 0xF7, 0xB0, 0x8E,
+    0xC6, 0xF8, 0x70, 0xBC, 0x89, 0x1F, 0xB6, 0x0E, 0xB5, 0x2F, 0x67, 0xDF, 0x01, 0x9D, 0x57, 0x3D,
+    0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0x63, 0x13, 0x35, 0x81, 0x5E, 0x0D, 0x35, 0x0C, 0x44, 0x75,
+    0xB8, 0xB7, 0x56, 0xB8, 0x16, 0x88, 0x1E, 0xC9, 0xA6, 0x43, 0x56, 0x0D, 0x7E, 0xC9, 0xE0, 0x21,
+    0x4B, 0xA6, 0xAA, 0xE9, 0x2B, 0x50, 0x0F, 0x41, 0xC1, 0x67, 0xB2, 0x2A, 0xD0, 0xA5, 0x8B, 0x86,
+    0xA4, 0x1D, 0x2B, 0x14, 0x1D, 0x02, 0x05, 0xAD, 0x35, 0xA4, 0x80, 0x51, 0x50, 0x26, 0x55, 0x0F,
+    0x1D, 0x3C, 0x94, 0x8E, 0xEB, 0x76, 0x08, 0xD0, 0x10, 0x88, 0x54, 0x03, 0x12, 0x10, 0x5D, 0x14,
+    0x7C, 0x35, 0xF5, 0x44, 0xF2, 0xF6, 0x3B, 0x97, 0x7C, 0x92, 0x92, 0xC0, 0x41, 0x5B, 0x4A, 0xE7,
+    0x7B, 0xEF, 0x9D, 0x7B, 0xCF, 0xBD, 0xE7, 0x9E, 0xDF, 0x4B, 0x22, 0x22, 0x53, 0x95, 0x24, 0x94,
+    0x24, 0x2F, 0x5C, 0xA3, 0x29, 0x7E, 0xA7, 0xA0, 0x06, 0x54, 0x9B, 0xDB, 0xBF, 0xAD, 0x2D, 0x55,
+    0xD7, 0xD6, 0xC1, 0x5A, 0x63, 0x15, 0x94, 0x82, 0x02, 0x90, 0x7B, 0x74, 0xB8, 0x65, 0x2B, 0x08,
+    0x5C, 0x3B, 0x58, 0x23, 0xFC, 0xFE, 0x3C, 0xA9, 0x5A, 0x13, 0x3F, 0x46, 0x51, 0x92, 0xB9, 0x57,
+    0x90, 0x7D, 0x54, 0x50, 0xAC, 0x1A, 0x53, 0x7D, 0x5C, 0x3B, 0xA7, 0xDF, 0xDB, 0x74, 0x1F, 0xDA,
+    0x61, 0x20, 0x1C, 0xF2, 0x85, 0xA0, 0xE9, 0x4B, 0x82, 0xA2, 0xEB, 0x5F, 0xA7, 0xF4, 0xC6, 0x75,
+    0x8A, 0x56, 0x6F, 0x80, 0x56, 0x69, 0xF4, 0xCE, 0x2A, 0x05, 0xB7, 0xBF, 0x43, 0x9E, 0xBC, 0x4D,
+    0x42, 0xEE, 0x90, 0x7D, 0x22, 0xDF, 0x32, 0x94, 0xAA, 0x8C, 0x63, 0x55, 0xF2, 0x72, 0xD6, 0x9F,
+    0x72, 0x32, 0x37, 0x12, 0xBD, 0x05, 0x2D, 0xAB, 0x4D, 0xCA, 0x54, 0x65, 0xB5, 0xC6, 0x8E, 0x53,
+    0x12, 0x89, 0x9C, 0xC8, 0x03, 0x3B, 0x00, 0xF9, 0xA0, 0x91, 0xF9, 0xF3, 0x2A, 0xB2, 0x8E, 0x65,
+    0x64, 0xB5, 0x4B, 0x91, 0x25, 0x69, 0x6A, 0x95, 0x34, 0x82, 0x9E, 0x3E, 0xC8, 0xE3, 0xB3, 0xFC,
+    0xAC, 0x20, 0xF1, 0x18, 0x6B, 0x3E, 0x2B, 0xD6, 0x0C, 0x3E, 0x93, 0x07, 0x63, 0x10, 0x8E, 0x85,
+    0xEF, 0x9A, 0x0E, 0xC6, 0x6B, 0x5F, 0x3A, 0xE2, 0xE7, 0x8E, 0xAB, 0x4A, 0x4D, 0x17, 0x78, 0x93,
+    0xF9, 0x16, 0x54, 0x2A, 0xC9, 0xFE, 0xC2, 0x5C, 0xFD, 0xD8, 0x18, 0xF0, 0x54, 0x43, 0x71, 0x78,
+    0x5B, 0x1B, 0x9A, 0x2D, 0x55, 0x9D, 0x93, 0xA7, 0x54, 0x18, 0x80, 0x8C, 0x81, 0xFF, 0xAD, 0x6E,
+    0x9B, 0xF8, 0xF7, 0xD5, 0x93, 0xB1, 0xFE, 0x6D, 0x48, 0xAC, 0x05, 0x0D, 0xDD, 0x27, 0xE3, 0x9B,
+    0xE0, 0x77, 0x4C, 0x6C, 0xE9, 0x50, 0xAF, 0xAD, 0x6D, 0x22, 0xF4, 0x3E, 0x2F, 0x11, 0xBD, 0xE5,
+    0xED, 0xFB, 0x5D, 0x98, 0xAA, 0x2E, 0x56, 0x65, 0x76, 0x10, 0xB7, 0x6F, 0x54, 0x19, 0xEC, 0x49,
+    0xF5, 0x7D, 0x72, 0x0A, 0x6A, 0x76, 0xC9, 0xC9, 0x29, 0x4D, 0x07, 0x14, 0x1A, 0x3D, 0x8D, 0x81,
+    0xC6, 0x4C, 0xE3, 0x29, 0xA3, 0x71, 0xC4, 0x68, 0x3D, 0x64, 0xB4, 0x7F, 0xC1, 0x28, 0x58, 0x8A,
+    0xF7, 0xC0, 0xB3, 0xAA, 0x31, 0xA2, 0xB3, 0xC7, 0x2E, 0x49, 0x92, 0x2D, 0x19, 0x2A, 0x86, 0x86,
+    0x61, 0x97, 0xE1, 0xF7, 0x0C, 0x9F, 0x00, 0x26, 0xC7, 0xDB, 0x73, 0xD8, 0x08, 0x07, 0x5B, 0xFE,
+    0xFB, 0x93, 0x19, 0xD9, 0x0F, 0x4A, 0x49, 0xB7, 0xFE, 0x36, 0x9B, 0xF5, 0xBC, 0xF5, 0xC3, 0x6E,
+    0x4E, 0x76, 0x1E, 0x61, 0x72, 0x3E, 0x62, 0xF0, 0x18, 0xC4, 0x19, 0x38, 0x0C, 0x70, 0x66, 0x76,
+    0x82, 0xDD, 0x94, 0x82, 0x69, 0xDB, 0x09, 0x6C, 0xD3, 0x18, 0x0D, 0x07, 0xEE, 0x2E, 0xC3, 0x48,
+    0x83, 0xC3, 0x20, 0x00, 0xA9, 0x8B, 0xD1, 0x56, 0x35, 0xED, 0xE4, 0x5F, 0xAA, 0x51, 0x2A, 0x77,
+    0x49, 0x9D, 0x90, 0xCB, 0x51, 0xFE, 0x7C, 0x08, 0x01, 0xA2, 0x03, 0xD8, 0x6C, 0x61, 0x5A, 0x8A,
+    0x79, 0x37, 0x28, 0xC8, 0x9E, 0xDC, 0xBD, 0x25, 0x39, 0x51, 0xB4, 0x97, 0x52, 0x9D, 0x2C, 0x29,
+    0xA5, 0x97, 0x3B, 0x46, 0x57, 0xE5, 0x40, 0xFF, 0xB5, 0x30, 0xA5, 0x1A, 0x46, 0x49, 0x4D, 0x19,
+    0x69, 0xA9, 0x3B, 0x8C, 0x61, 0x90, 0xD0, 0xEE, 0x84, 0x44, 0x45, 0xA9, 0x48, 0x4C, 0x45, 0x29,
+    0xEC, 0x18, 0x24, 0x29, 0x3C, 0x2A, 0x72, 0xCC, 0xC4, 0xB1, 0x52, 0xA3, 0x62, 0xA4, 0x66, 0x13,
+    0x1C, 0x9A, 0x42, 0x24, 0x25, 0x3F, 0x6E, 0xA9, 0x77, 0x72, 0x84, 0x1D, 0xA2, 0x55, 0x6A, 0x19,
+    0x3A, 0xBA, 0x37, 0x22, 0x45, 0xD5, 0xCB, 0xC6, 0x31, 0xC0, 0x84, 0x59, 0x5D, 0xF3, 0xE3, 0xEF,
+    0x4A, 0x61, 0xFD, 0xF9, 0xA7, 0x0C, 0x1B, 0xE5, 0xE4, 0x83, 0xA3, 0xA3, 0x9A, 0x0D, 0xDA, 0x2E,
+    0x7F, 0xF2, 0xAB, 0xA7, 0x7F, 0xB5, 0x1F, 0xBE, 0xFA, 0x38, 0xB7, 0xFE, 0x62, 0x7C, 0x0A, 0xA0,
+    0xA7, 0x89, 0xF5, 0x0F, 0x7A, 0x16, 0x9A, 0x9F, 0xD1, 0x69, 0x68, 0xB4, 0x94, 0x11, 0x6C, 0x97,
+    0xB1, 0xCD, 0x62, 0x06, 0x1F, 0xE9, 0xBA, 0x45, 0x51, 0xA6, 0xB0, 0x51, 0x8A, 0x50, 0x8D, 0x38,
+    0x40, 0x00, 0xF0, 0x49, 0x7A, 0xC5, 0x2A, 0xA2, 0x54, 0xFC, 0x4F, 0x60, 0x6E, 0x22, 0x62, 0x10,
+    0xEA, 0x00, 0xA3, 0x02, 0x38, 0x32, 0x15, 0x70, 0x02, 0xA0, 0x3D, 0x0B, 0x9A, 0x6A, 0x80, 0x2B,
+    0xDB, 0x5D, 0x48, 0xAE, 0x52, 0x09, 0x5D, 0x1A, 0x9F, 0x0C, 0xBC, 0xC9, 0x66, 0x85, 0x44, 0x6B,
+    0x2A, 0x12, 0x33, 0xF8, 0xD9, 0x4D, 0x10, 0x56, 0x01, 0x99, 0x15, 0xD4, 0x84, 0xB1, 0xA6, 0x3C,
+    0xE5, 0x0B, 0x30, 0x62, 0x08, 0x78, 0xD4, 0x23, 0x0B, 0x62, 0x85, 0x03, 0xA3, 0xAA, 0xB6, 0x22,
+    0x43, 0x55, 0x1F, 0x12, 0x5D, 0x5A, 0x6C, 0x6A, 0x8C, 0xC7, 0x37, 0xC9, 0x81, 0x81, 0xE8, 0xF2,
+    0xF6, 0xF6, 0xFB, 0x0B, 0x66, 0x06, 0xAF, 0x82, 0x89, 0x22, 0x52, 0xFC, 0x90, 0xE8, 0x3E, 0x0D,
+    0xE5, 0x90, 0x53, 0x8F, 0x2C, 0x86, 0x6B, 0x07, 0x48, 0xC6, 0x98, 0x75, 0xFC, 0xF6, 0x7C, 0x3B,
+    0xD4, 0x79, 0xDE, 0x43, 0xCC, 0x52, 0x31, 0x67, 0xA4, 0x9E, 0x67, 0x32, 0xE8, 0x0C, 0xE7, 0xA0,
+    0xC4, 0x7A, 0xC9, 0x15, 0x84, 0x14, 0x0F, 0x9B, 0xFA, 0xE4, 0x97, 0x74, 0x5D, 0xF0, 0x18, 0x76,
+    0x01, 0x50, 0xD7, 0x2A, 0x10, 0x0A, 0x56, 0x81, 0x6C, 0xB4, 0x0A, 0x8F, 0x47, 0x21, 0x67, 0x3D,
+    0x82, 0x09, 0xAC, 0xC7, 0x48, 0xFA, 0x75, 0x75, 0xF8, 0x3E, 0x67, 0x48, 0x43, 0xD7, 0xBA, 0x19,
+    0x6A, 0x94, 0xAC, 0x79, 0xCA, 0x94, 0x16, 0x93, 0xB5, 0x18, 0x14, 0xB1, 0x0A, 0xEC, 0x8C, 0x45,
+    0x1B, 0x86, 0x3B, 0x7A, 0x8F, 0x10, 0xAA, 0x29, 0xD2, 0x70, 0xF5, 0x8D, 0xD9, 0xB8, 0x2F, 0x22,
+    0x0B, 0xD8, 0x02, 0x3C, 0xE5, 0xC2, 0x82, 0x13, 0x91, 0xC5, 0x9A, 0x09, 0xD6, 0x3C, 0x2E, 0xB1,
+    0xC7, 0xB3, 0x4F, 0xB1, 0xD4, 0x03, 0x95, 0x0F, 0x03, 0x4E, 0x3F, 0x80, 0x13, 0x9C, 0x96, 0x83,
+    0x56, 0xC6, 0xC5, 0xA5, 0xCE, 0xFC, 0xB9, 0xDC, 0xF7, 0x80, 0x80, 0xAD, 0x44, 0xB4, 0x12, 0x4E,
+    0xB4, 0x2D, 0xC8, 0xD4, 0xDC, 0x51, 0x6F, 0x8F, 0x48, 0x97, 0x68, 0x84, 0xB4, 0xD7, 0xDB, 0xC9,
+    0x1D, 0x3E, 0x42, 0xED, 0x76, 0xFE, 0x80, 0xCD, 0xDD, 0xDE, 0x90, 0x1E, 0x7D, 0x3F, 0xC4, 0xF2,
+    0x81, 0x89, 0x9A, 0x8C, 0xF2, 0xED, 0xFC, 0xB3, 0xB1, 0x51, 0x82, 0x44, 0x18, 0xD9, 0xB9, 0x51,
+    0x7B, 0x14, 0x39, 0xB9, 0x2D, 0x7D, 0x8A, 0x44, 0xE2, 0xE5, 0x23, 0xF0, 0x7F, 0xA9, 0xE8, 0x8E,
+    0x59, 0xB9, 0x50, 0x02, 0xC5, 0xCF, 0x43, 0x48, 0x65, 0x5A, 0x0F, 0xAA, 0x97, 0xCE, 0xA3, 0xAD,
+    0xF7, 0xE8, 0xC2, 0x4D, 0x64, 0xF6, 0xCA, 0x0F, 0x67, 0x38, 0x2B, 0xD8, 0x14, 0xE3, 0x9B, 0xAA,
+    0x30, 0x8B, 0xCD, 0x19, 0x9D, 0x53, 0x79, 0x0F, 0x3C, 0x84, 0x94, 0x84, 0xF8, 0x0C, 0x42, 0xA7,
+    0x98, 0x17, 0x27, 0xBA, 0xF5, 0x84, 0xA0, 0x3C, 0x0E, 0x4D, 0xA9, 0x72, 0xEB, 0xDF, 0x4F, 0x73,
+    0xA1, 0x1E, 0x94, 0x6E, 0xB0, 0x21, 0x7D, 0x41, 0x55, 0xF4, 0x35, 0xAA, 0x87, 0x1E, 0x1B, 0x5D,
+    0x20, 0xF0, 0x32, 0xC9, 0xF2, 0x96, 0xDA, 0xD7, 0x5D, 0x25, 0x24, 0xEB, 0xC9, 0x84, 0x5D, 0x89,
+    0x42, 0xBA, 0x3E, 0xFF, 0x60, 0x1E, 0xEA, 0xCA, 0x08, 0xAD, 0x6A, 0xD2, 0xB0, 0x7E, 0xB8, 0xA8,
+    0xA0, 0x88, 0x19, 0xF6, 0xB6, 0x5B, 0x0C, 0x62, 0xAA, 0x1E, 0xB4, 0xFF, 0x6A, 0x18, 0x1E, 0xA1,
+    0x2F, 0x00, 0x30, 0x10, 0x3A, 0x4F, 0x49, 0xEA, 0xD7, 0xCB, 0xB9, 0x55, 0x83, 0xE7, 0x94, 0x82,
+    0x9B, 0x29, 0xC0, 0x0B, 0x05, 0x9F, 0x49, 0x70, 0x3F, 0xBD, 0x00, 0x4A, 0x2E, 0xE0, 0x75, 0x89,
+    0x51, 0x53, 0x7A, 0x0C, 0x6E, 0x02, 0x10, 0x05, 0xC0, 0xAE, 0x00, 0x66, 0xF7, 0xE6, 0x65, 0xC9,
+    0x51, 0x27, 0x39, 0xA1, 0x36, 0xA9, 0xF7, 0xB0, 0x6E, 0x50, 0x2F, 0xF0, 0xBE, 0xEC, 0x06, 0x8B,
+    0xCD, 0x61, 0x73, 0x82, 0x39, 0x3A, 0xF2, 0x50, 0x80, 0xC8, 0xE5, 0x79, 0x81, 0x40, 0x00, 0x8C,
+    0x10, 0xD3, 0x7C, 0xCA, 0x42, 0x03, 0x55, 0x38, 0xAA, 0x29, 0x91, 0x28, 0xE7, 0x3C, 0x54, 0xD0,
+    0x29, 0x89, 0x04, 0x3A, 0x21, 0x60, 0x3C, 0x0E, 0x25, 0x37, 0xF4, 0x59, 0x77, 0xE4, 0x85, 0x93,
+    0x37, 0x0B, 0x87, 0x1A, 0x59, 0x87, 0x12, 0xA0, 0x0A, 0x6B, 0x7F, 0x59, 0x0E, 0x3B, 0xD7, 0x3D,
+    0x19, 0x15, 0xD6, 0xE9, 0x98, 0x50, 0x1E, 0xB0, 0x04, 0x5C, 0xAD, 0xE3, 0x45, 0x29, 0xE6, 0xB1,
+    0x26, 0xDE, 0x40, 0x2E, 0xBC, 0x2B, 0xF6, 0x8D, 0x7B, 0x58, 0xA7, 0xD6, 0x8D, 0xC0, 0x58, 0x5B,
+    0x98, 0x71, 0x05, 0x74, 0x19, 0x3D, 0x45, 0x37, 0x6B, 0x43, 0xFD, 0x6E, 0x82, 0x73, 0x81, 0x27,
+    0x0A, 0x80, 0x9B, 0xAF, 0xB0, 0x19, 0x57, 0xD8, 0x8C, 0x2B, 0x6C, 0xBC, 0xE7, 0x80, 0x1E, 0xF5,
+    0x18, 0xDC, 0x84, 0x65, 0x59, 0xCC, 0x96, 0x00, 0xB3, 0x7B, 0xFB, 0x45, 0xEE, 0x1E, 0x1D, 0xD7,
+    0xA5, 0x76, 0xD8, 0xAD, 0x07, 0x36, 0x63, 0x68, 0xF0, 0x55, 0xCB, 0x0E, 0xC9, 0x2C, 0x9C, 0x90,
+    0xCB, 0x40, 0x48, 0xCE, 0xFC, 0xEE, 0x61, 0xC2, 0xD9, 0x9E, 0x5F, 0x3B, 0xB8, 0xFB, 0x1E, 0x42,
+    0xC4, 0xE5, 0x81, 0xFF, 0x02, 0xC4, 0x39, 0x70, 0x31, 0x71, 0x10, 0xC0, 0x85, 0xC9, 0xD9, 0x4F,
+    0xDF, 0x58, 0x1C, 0xD5, 0xE1, 0x1B, 0x52, 0xCC, 0x7A, 0xB4, 0x46, 0xDA, 0x17, 0xBA, 0x0B, 0x15,
+    0x40, 0x2E, 0xFC, 0x4A, 0x1D, 0xA7, 0x71, 0x5C, 0x69, 0x09, 0xFD, 0x55, 0x2E, 0x1C, 0x4D, 0xBB,
+    0x2F, 0x5E, 0xD9, 0xD8, 0xF2, 0x5F, 0xF9, 0xE3, 0x67, 0xA9, 0xF7, 0xE3, 0xA2, 0xBA, 0xF1, 0xF2,
+    0x2B, 0xF9, 0xCE, 0x37, 0x47, 0x6E, 0xBE, 0x73, 0xBD, 0xB1, 0xBB, 0xD9, 0x44, 0x9A, 0xC7, 0x30,
+    0xA2, 0x99, 0xFF, 0xE1, 0x07, 0x64, 0x62, 0x00, 0x07, 0x5C, 0x7A, 0x81, 0x83, 0xA8, 0x85, 0x3F,
+    0xDA, 0xAB, 0x5C, 0xB2, 0xF1, 0xF0, 0x67, 0x36, 0xF0, 0x74, 0xF1, 0xFD, 0x3F, 0x08, 0xB2, 0x9C,
+    0x56, 0xDC, 0x00, 0xFB, 0x1B, 0xA3, 0x08, 0xCF, 0x78, 0x1C, 0x52, 0xDA, 0xE9, 0xA8, 0xFF, 0xDC,
+    0x10, 0xB2, 0xA4, 0xBF, 0x50, 0x72, 0x3C, 0xF0, 0x25, 0x53, 0x5F, 0xEE, 0xE4, 0x10, 0x45, 0xBB,
+    0x83, 0x3C, 0x97, 0x2C, 0xD9, 0xD7, 0x15, 0x43, 0x1A, 0x20, 0x8F, 0x8C, 0xD3, 0x0E, 0xF9, 0xB5,
+    0xA9, 0x0D, 0xF1, 0x13, 0xB9, 0x4C, 0xC6, 0x5C, 0x21, 0xCC, 0x50, 0x91, 0x21, 0x77, 0x07, 0x65,
+    0x0D, 0x73, 0xFD, 0x81, 0xA6, 0xA0, 0x14, 0x72, 0xB5, 0x21, 0x6D, 0xC4, 0xF8, 0x24, 0xC7, 0x85,
+    0x14, 0x73, 0xF7, 0xCF, 0x93, 0x95, 0x1C, 0x6D, 0x59, 0x5F, 0x57, 0xCF, 0x77, 0x74, 0x32, 0x7D,
+    0xA8, 0xB3, 0xE9, 0x9E, 0x46, 0xFF, 0xCD, 0xF7, 0xC6, 0x6B, 0xDC, 0x3C, 0x39, 0x94, 0xEF, 0x1E,
+    0x6E, 0xE3, 0x0A, 0x27, 0x74, 0x5D, 0xE3, 0x51, 0x49, 0x02, 0x71, 0xB2, 0x43, 0x42, 0xBC, 0x96,
+    0x00, 0xE3, 0xE3, 0x12, 0x38, 0x6B, 0xEE, 0x63, 0xB4, 0xF8, 0x91, 0x9B, 0xF3, 0xDD, 0x8F, 0xAF,
+    0x37, 0x1A, 0x7F, 0xD3, 0x57, 0xC4, 0x96, 0x96, 0x74, 0x53, 0x93, 0x0B, 0xAF, 0xF7, 0xF1, 0xD6,
+    0x67, 0x71, 0x5F, 0xB4, 0x9F, 0x87, 0x46, 0xF6, 0x2E, 0x0D, 0x3D, 0xD2, 0x54, 0x19, 0x4A, 0x9B,
+    0x53, 0x79, 0x66, 0x03, 0xCB, 0x79, 0x30, 0x28, 0x67, 0x69, 0x80, 0x3F, 0x4F, 0xA7, 0x2A, 0x0A,
+    0x47, 0x32, 0xD2, 0x38, 0x1D, 0x90, 0xBE, 0x02, 0x2D, 0x24, 0x99, 0xBE, 0x70, 0x1F, 0xDC, 0xAA,
+    0x51, 0xC7, 0xDA, 0xE1, 0x2E, 0x1F, 0x0C, 0xC4, 0xDF, 0xA7, 0x68, 0xA5, 0xCD, 0x7A, 0x97, 0x49,
+    0xF8, 0x31, 0x59, 0x9F, 0xBF, 0x7B, 0x76, 0x01, 0xCF, 0x70, 0x12, 0xBC, 0x2B, 0x7C, 0xE9, 0x12,
+    0x8F, 0x9B, 0x15, 0x1C, 0xC7, 0xAF, 0x16, 0x64, 0x1D, 0x02, 0xB8, 0x6D, 0x90, 0x3A, 0x42, 0x69,
+    0x3D, 0xDD, 0x3B, 0x2E, 0x9C, 0x8F, 0xF6, 0x1E, 0x4B, 0xB1, 0xB1, 0x57, 0xD4, 0xDE, 0xAB, 0x7B,
+    0x45, 0x1A, 0x60, 0xDE, 0x94, 0xC1, 0xF7, 0xCF, 0x81, 0x86, 0x00, 0xE8, 0x0F, 0xAF, 0x1B, 0x18,
+    0x07, 0x49, 0x9F, 0x13, 0xFA, 0x96, 0x48, 0xF1, 0xA6, 0xBE, 0x55, 0xA8, 0x4A, 0x83, 0xF1, 0x28,
+    0x27, 0xE3, 0xA3, 0x42, 0x53, 0x00, 0xD3, 0x06, 0x88, 0x62, 0xFF, 0x75, 0x15, 0x8E, 0x50, 0x2D,
+    0x46, 0x90, 0x1D, 0xA1, 0x76, 0xF5, 0x9F, 0x6C, 0x9C, 0x18, 0xE3, 0xB5, 0x26, 0xDF, 0xC8, 0xC2,
+    0x9E, 0x6F, 0x17, 0x23, 0x2C, 0xDF, 0x13, 0x7F, 0x17, 0xB9, 0x6F, 0xC4, 0x49, 0x00, 0xD7, 0x07,
+    0x38, 0xE2, 0x62, 0x6D, 0xE3, 0x11, 0xBF, 0x90, 0xE0, 0x2D, 0xAE, 0x13, 0xB3, 0xB7, 0xBD, 0x90,
+    0x95, 0x9C, 0xEA, 0x8E, 0x93, 0x2E, 0xFE, 0xA7, 0x3A, 0xAE, 0xC1, 0x77, 0x8B, 0x4B, 0x36, 0xA4,
+    0xB3, 0xB6, 0x7F, 0x9B, 0x88, 0xF9, 0xBD, 0xA1, 0xBB, 0x3A, 0xBE, 0xF9, 0x1F, 0x13, 0x0D, 0x0D,
+    0x0D, 0xD8, 0xFF, 0xFF, 0xFF, 0x87, 0x7A, 0x20, 0x06, 0x00, 0x8D, 0xCE, 0xB1, 0x11, 0xC2, 0x30,
+    0x0C, 0x05, 0xD0, 0x9F, 0xC0, 0xE1, 0x82, 0x82, 0x86, 0x3E, 0x23, 0x78, 0x03, 0x6C, 0x36, 0xA0,
+    0xA0, 0xA7, 0x61, 0x8C, 0x80, 0xB3, 0x04, 0x1B, 0x30, 0x04, 0x85, 0x7D, 0xF1, 0x08, 0x19, 0x81,
+    0x9A, 0x2A, 0x45, 0xB8, 0xCB, 0x71, 0xE6, 0x84, 0xE4, 0x50, 0x50, 0x52, 0xE8, 0x15, 0xD2, 0xE9,
+    0x4B, 0x58, 0x03, 0x50, 0x34, 0x00, 0x15, 0xBD, 0x01, 0x03, 0x07, 0x9C, 0xB0, 0xB2, 0xA8, 0x05,
+    0x3F, 0xE1, 0x1E, 0x8D, 0x2F, 0x88, 0xA2, 0xC7, 0xE1, 0x62, 0xFD, 0xCF, 0xE0, 0x1F, 0x1A, 0x21,
+    0x32, 0x4A, 0x02, 0x4A, 0x8A, 0x7C, 0x70, 0xCE, 0x85, 0x9D, 0xB0, 0x24, 0xCB, 0x1A, 0xEA, 0xD8,
+    0x30, 0xEB, 0xD9, 0xB1, 0x10, 0x87, 0xEC, 0x8D, 0x2D, 0x29, 0xA9, 0xD7, 0xB5, 0xA2, 0xA4, 0x29,
+    0x99, 0xAD, 0x5F, 0x3C, 0xF7, 0x35, 0xC0, 0xFD, 0xC9, 0x73, 0x56, 0xDF, 0x45, 0xCE, 0x92, 0xAD,
+    0xB6, 0x17, 0x55, 0xCA, 0x09, 0x21, 0xBB, 0xF9, 0x3A, 0xE0, 0x88, 0x80, 0x04, 0x47, 0x23, 0x5A,
+    0x0E, 0xEC, 0xA0, 0x53, 0xFE, 0xC3, 0x7E, 0x00, 0x35, 0xCE, 0xB1, 0x11, 0x02, 0x21, 0x10, 0x85,
+    0xE1, 0x77, 0x43, 0x40, 0x70, 0x01, 0x76, 0x70, 0x25, 0x98, 0x98, 0x43, 0x27, 0xB6, 0x61, 0xE2,
+    0x78, 0x55, 0x58, 0x8B, 0x99, 0x96, 0x40, 0x09, 0xD8, 0x03, 0x01, 0x01, 0xEC, 0x73, 0xF7, 0x18,
+    0x99, 0x81, 0x3F, 0xF8, 0x66, 0x87, 0x05, 0xFE, 0xE7, 0x32, 0x33, 0x8E, 0xD7, 0x31, 0x59, 0x02,
+    0xB3, 0x25, 0xB2, 0x5A, 0xE4, 0x69, 0xE8, 0x32, 0xA2, 0x62, 0xF8, 0x20, 0x28, 0xC6, 0xEF, 0x6B,
+    0x55, 0x24, 0xBB, 0x1F, 0x3A, 0xC5, 0xBE, 0x32, 0x05, 0xB2, 0xEA, 0x64, 0x24, 0xF3, 0x99, 0xF5,
+    0x41, 0xA6, 0x37, 0xDB, 0x46, 0x51, 0x2E, 0x9E, 0xE2, 0xC9, 0x7D, 0xA1, 0xAC, 0x14, 0x40, 0x91,
+    0x0D, 0xD8, 0x34, 0x05, 0xF0, 0xC3, 0x73, 0x07, 0x96, 0xEE, 0xC4, 0xFE, 0xBB, 0xBB, 0x66, 0xD9,
+    0xAE, 0xC5, 0x72, 0x90, 0xA2, 0xCC, 0x3D, 0x6F, 0x33, 0x27, 0xBD, 0x3F,
 };
 
 static const EpdGlyph notosans_14_regularGlyphs[] = {
@@ -1901,99 +1905,99 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 4, 22, 126, 2, 21, 22, 0 }, // !
-    { 9, 8, 190, 1, 21, 18, 22 }, // "
-    { 19, 21, 302, 0, 21, 100, 40 }, // #
-    { 15, 25, 267, 1, 23, 94, 140 }, // $
-    { 22, 23, 388, 1, 22, 127, 234 }, // %
-    { 21, 23, 342, 1, 22, 121, 361 }, // &
-    { 4, 8, 105, 1, 21, 8, 482 }, // '
-    { 7, 26, 140, 1, 21, 46, 490 }, // (
-    { 8, 26, 140, 0, 21, 52, 536 }, // )
-    { 14, 14, 257, 1, 23, 49, 588 }, // *
-    { 15, 15, 267, 1, 18, 57, 637 }, // +
-    { 5, 8, 125, 1, 4, 10, 694 }, // ,
-    { 8, 3, 150, 1, 9, 6, 704 }, // -
-    { 4, 5, 125, 2, 4, 5, 710 }, // .
-    { 11, 21, 174, 0, 21, 58, 715 }, // /
-    { 15, 23, 273, 1, 22, 87, 773 }, // 0
-    { 9, 21, 206, 0, 21, 48, 860 }, // 1
-    { 14, 22, 259, 1, 22, 77, 908 }, // 2
-    { 15, 23, 267, 1, 22, 87, 985 }, // 3
-    { 17, 21, 267, 0, 21, 90, 1072 }, // 4
-    { 15, 22, 267, 1, 21, 83, 1162 }, // 5
-    { 15, 23, 267, 1, 22, 87, 1245 }, // 6
-    { 15, 21, 239, 0, 21, 79, 1332 }, // 7
-    { 15, 23, 275, 1, 22, 87, 1411 }, // 8
-    { 15, 23, 267, 1, 22, 87, 1498 }, // 9
-    { 4, 18, 125, 2, 17, 18, 1585 }, // :
-    { 6, 21, 125, 0, 17, 32, 1603 }, // ;
-    { 15, 15, 267, 1, 18, 57, 1635 }, // <
-    { 14, 9, 267, 1, 15, 32, 1692 }, // =
-    { 15, 15, 267, 1, 18, 57, 1724 }, // >
-    { 12, 23, 203, 0, 22, 69, 1781 }, // ?
-    { 24, 24, 420, 1, 21, 144, 1850 }, // @
-    { 19, 21, 298, 0, 21, 100, 1994 }, // A
-    { 16, 21, 303, 2, 21, 84, 2094 }, // B
-    { 17, 23, 295, 1, 22, 98, 2178 }, // C
-    { 18, 21, 341, 2, 21, 95, 2276 }, // D
-    { 13, 21, 260, 2, 21, 69, 2371 }, // E
-    { 13, 21, 242, 2, 21, 69, 2440 }, // F
-    { 19, 23, 340, 1, 22, 110, 2509 }, // G
-    { 17, 21, 346, 2, 21, 90, 2619 }, // H
-    { 8, 21, 158, 1, 21, 42, 2709 }, // I
-    { 9, 27, 127, -3, 21, 61, 2751 }, // J
-    { 17, 21, 289, 2, 21, 90, 2812 }, // K
-    { 13, 21, 245, 2, 21, 69, 2902 }, // L
-    { 22, 21, 423, 2, 21, 116, 2971 }, // M
-    { 18, 21, 355, 2, 21, 95, 3087 }, // N
-    { 20, 23, 365, 1, 22, 115, 3182 }, // O
-    { 15, 21, 282, 2, 21, 79, 3297 }, // P
-    { 20, 27, 365, 1, 22, 135, 3376 }, // Q
-    { 16, 21, 290, 2, 21, 84, 3511 }, // R
-    { 14, 23, 256, 1, 22, 81, 3595 }, // S
-    { 16, 21, 260, 0, 21, 84, 3676 }, // T
-    { 17, 22, 341, 2, 21, 94, 3760 }, // U
-    { 18, 21, 280, 0, 21, 95, 3854 }, // V
-    { 27, 21, 434, 0, 21, 142, 3949 }, // W
-    { 17, 21, 274, 0, 21, 90, 4091 }, // X
-    { 17, 21, 264, 0, 21, 90, 4181 }, // Y
-    { 15, 21, 267, 1, 21, 79, 4271 }, // Z
-    { 7, 26, 154, 2, 21, 46, 4350 }, // [
-    { 11, 21, 174, 0, 21, 58, 4396 }, // <backslash>
-    { 8, 26, 154, 0, 21, 52, 4454 }, // ]
-    { 15, 14, 267, 1, 21, 53, 4506 }, // ^
-    { 15, 3, 207, -1, -2, 12, 4559 }, // _
-    { 7, 6, 131, 1, 23, 11, 4571 }, // `
-    { 13, 17, 262, 1, 16, 56, 4582 }, // a
-    { 15, 24, 287, 2, 23, 90, 4638 }, // b
-    { 13, 17, 224, 1, 16, 56, 4728 }, // c
-    { 15, 24, 287, 1, 23, 90, 4784 }, // d
-    { 14, 17, 263, 1, 16, 60, 4874 }, // e
-    { 12, 23, 161, 0, 23, 69, 4934 }, // f
-    { 15, 23, 287, 1, 16, 87, 5003 }, // g
-    { 14, 23, 288, 2, 23, 81, 5090 }, // h
-    { 4, 22, 120, 2, 22, 22, 5171 }, // i
-    { 8, 29, 120, -2, 22, 58, 5193 }, // j
-    { 14, 23, 249, 2, 23, 81, 5251 }, // k
-    { 4, 23, 120, 2, 23, 23, 5332 }, // l
-    { 23, 16, 436, 2, 16, 92, 5355 }, // m
-    { 14, 16, 288, 2, 16, 56, 5447 }, // n
-    { 16, 17, 282, 1, 16, 68, 5503 }, // o
-    { 15, 23, 287, 2, 16, 87, 5571 }, // p
-    { 15, 23, 287, 1, 16, 87, 5658 }, // q
-    { 10, 16, 193, 2, 16, 40, 5745 }, // r
-    { 12, 17, 224, 1, 16, 51, 5785 }, // s
-    { 10, 21, 168, 0, 20, 53, 5836 }, // t
-    { 14, 17, 288, 2, 16, 60, 5889 }, // u
-    { 15, 16, 237, 0, 16, 60, 5949 }, // v
-    { 23, 16, 367, 0, 16, 92, 6009 }, // w
-    { 15, 16, 247, 0, 16, 60, 6101 }, // x
-    { 15, 23, 238, 0, 16, 87, 6161 }, // y
-    { 12, 16, 219, 1, 16, 48, 6248 }, // z
-    { 11, 26, 177, 0, 21, 72, 6296 }, // {
-    { 4, 31, 257, 6, 23, 31, 6368 }, // |
-    { 11, 26, 177, 0, 21, 72, 6399 }, // }
-    { 15, 5, 267, 1, 13, 19, 6471 }, // ~
+    { 9, 8, 190, 1, 21, 18, 0 }, // "
+    { 19, 21, 302, 0, 21, 100, 18 }, // #
+    { 15, 25, 267, 1, 23, 94, 118 }, // $
+    { 22, 23, 388, 1, 22, 127, 212 }, // %
+    { 21, 23, 342, 1, 22, 121, 339 }, // &
+    { 4, 8, 105, 1, 21, 8, 460 }, // '
+    { 7, 26, 140, 1, 21, 46, 22 }, // (
+    { 8, 26, 140, 0, 21, 52, 68 }, // )
+    { 14, 14, 257, 1, 23, 49, 468 }, // *
+    { 15, 15, 267, 1, 18, 57, 517 }, // +
+    { 5, 8, 125, 1, 4, 10, 120 }, // ,
+    { 8, 3, 150, 1, 9, 6, 130 }, // -
+    { 4, 5, 125, 2, 4, 5, 136 }, // .
+    { 11, 21, 174, 0, 21, 58, 574 }, // /
+    { 15, 23, 273, 1, 22, 87, 141 }, // 0
+    { 9, 21, 206, 0, 21, 48, 228 }, // 1
+    { 14, 22, 259, 1, 22, 77, 276 }, // 2
+    { 15, 23, 267, 1, 22, 87, 353 }, // 3
+    { 17, 21, 267, 0, 21, 90, 440 }, // 4
+    { 15, 22, 267, 1, 21, 83, 530 }, // 5
+    { 15, 23, 267, 1, 22, 87, 613 }, // 6
+    { 15, 21, 239, 0, 21, 79, 700 }, // 7
+    { 15, 23, 275, 1, 22, 87, 779 }, // 8
+    { 15, 23, 267, 1, 22, 87, 866 }, // 9
+    { 4, 18, 125, 2, 17, 18, 953 }, // :
+    { 6, 21, 125, 0, 17, 32, 971 }, // ;
+    { 15, 15, 267, 1, 18, 57, 632 }, // <
+    { 14, 9, 267, 1, 15, 32, 689 }, // =
+    { 15, 15, 267, 1, 18, 57, 721 }, // >
+    { 12, 23, 203, 0, 22, 69, 1003 }, // ?
+    { 24, 24, 420, 1, 21, 144, 778 }, // @
+    { 19, 21, 298, 0, 21, 100, 1072 }, // A
+    { 16, 21, 303, 2, 21, 84, 1172 }, // B
+    { 17, 23, 295, 1, 22, 98, 1256 }, // C
+    { 18, 21, 341, 2, 21, 95, 1354 }, // D
+    { 13, 21, 260, 2, 21, 69, 1449 }, // E
+    { 13, 21, 242, 2, 21, 69, 1518 }, // F
+    { 19, 23, 340, 1, 22, 110, 1587 }, // G
+    { 17, 21, 346, 2, 21, 90, 1697 }, // H
+    { 8, 21, 158, 1, 21, 42, 1787 }, // I
+    { 9, 27, 127, -3, 21, 61, 1829 }, // J
+    { 17, 21, 289, 2, 21, 90, 1890 }, // K
+    { 13, 21, 245, 2, 21, 69, 1980 }, // L
+    { 22, 21, 423, 2, 21, 116, 2049 }, // M
+    { 18, 21, 355, 2, 21, 95, 2165 }, // N
+    { 20, 23, 365, 1, 22, 115, 2260 }, // O
+    { 15, 21, 282, 2, 21, 79, 2375 }, // P
+    { 20, 27, 365, 1, 22, 135, 2454 }, // Q
+    { 16, 21, 290, 2, 21, 84, 2589 }, // R
+    { 14, 23, 256, 1, 22, 81, 2673 }, // S
+    { 16, 21, 260, 0, 21, 84, 2754 }, // T
+    { 17, 22, 341, 2, 21, 94, 922 }, // U
+    { 18, 21, 280, 0, 21, 95, 2838 }, // V
+    { 27, 21, 434, 0, 21, 142, 2933 }, // W
+    { 17, 21, 274, 0, 21, 90, 3075 }, // X
+    { 17, 21, 264, 0, 21, 90, 3165 }, // Y
+    { 15, 21, 267, 1, 21, 79, 3255 }, // Z
+    { 7, 26, 154, 2, 21, 46, 1016 }, // [
+    { 11, 21, 174, 0, 21, 58, 1062 }, // <backslash>
+    { 8, 26, 154, 0, 21, 52, 1120 }, // ]
+    { 15, 14, 267, 1, 21, 53, 1172 }, // ^
+    { 15, 3, 207, -1, -2, 12, 1225 }, // _
+    { 7, 6, 131, 1, 23, 11, 1237 }, // `
+    { 13, 17, 262, 1, 16, 56, 3334 }, // a
+    { 15, 24, 287, 2, 23, 90, 3390 }, // b
+    { 13, 17, 224, 1, 16, 56, 3480 }, // c
+    { 15, 24, 287, 1, 23, 90, 3536 }, // d
+    { 14, 17, 263, 1, 16, 60, 3626 }, // e
+    { 12, 23, 161, 0, 23, 69, 3686 }, // f
+    { 15, 23, 287, 1, 16, 87, 3755 }, // g
+    { 14, 23, 288, 2, 23, 81, 3842 }, // h
+    { 4, 22, 120, 2, 22, 22, 3923 }, // i
+    { 8, 29, 120, -2, 22, 58, 3945 }, // j
+    { 14, 23, 249, 2, 23, 81, 4003 }, // k
+    { 4, 23, 120, 2, 23, 23, 4084 }, // l
+    { 23, 16, 436, 2, 16, 92, 4107 }, // m
+    { 14, 16, 288, 2, 16, 56, 4199 }, // n
+    { 16, 17, 282, 1, 16, 68, 4255 }, // o
+    { 15, 23, 287, 2, 16, 87, 4323 }, // p
+    { 15, 23, 287, 1, 16, 87, 4410 }, // q
+    { 10, 16, 193, 2, 16, 40, 4497 }, // r
+    { 12, 17, 224, 1, 16, 51, 4537 }, // s
+    { 10, 21, 168, 0, 20, 53, 4588 }, // t
+    { 14, 17, 288, 2, 16, 60, 4641 }, // u
+    { 15, 16, 237, 0, 16, 60, 4701 }, // v
+    { 23, 16, 367, 0, 16, 92, 4761 }, // w
+    { 15, 16, 247, 0, 16, 60, 4853 }, // x
+    { 15, 23, 238, 0, 16, 87, 4913 }, // y
+    { 12, 16, 219, 1, 16, 48, 5000 }, // z
+    { 11, 26, 177, 0, 21, 72, 1248 }, // {
+    { 4, 31, 257, 6, 23, 31, 1320 }, // |
+    { 11, 26, 177, 0, 21, 72, 1351 }, // }
+    { 15, 5, 267, 1, 13, 19, 1423 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 4, 22, 126, 2, 16, 22, 0 }, // U+00A1
     { 13, 23, 267, 2, 22, 75, 22 }, // U+00A2
@@ -2077,19 +2081,19 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 16, 24, 282, 1, 23, 96, 6431 }, // U+00F0
     { 14, 22, 288, 2, 22, 77, 6527 }, // U+00F1
     { 16, 24, 282, 1, 23, 96, 6604 }, // U+00F2
-    { 16, 24, 282, 1, 23, 96, 6700 }, // U+00F3
-    { 16, 24, 282, 1, 23, 96, 6796 }, // U+00F4
-    { 16, 23, 282, 1, 22, 92, 6892 }, // U+00F5
-    { 16, 23, 282, 1, 22, 92, 6984 }, // U+00F6
-    { 15, 14, 267, 1, 17, 53, 7076 }, // U+00F7
-    { 16, 18, 282, 1, 17, 72, 7129 }, // U+00F8
-    { 14, 24, 288, 2, 23, 84, 7201 }, // U+00F9
-    { 14, 24, 288, 2, 23, 84, 7285 }, // U+00FA
-    { 14, 24, 288, 2, 23, 84, 7369 }, // U+00FB
-    { 14, 23, 288, 2, 22, 81, 7453 }, // U+00FC
-    { 15, 30, 238, 0, 23, 113, 7534 }, // U+00FD
-    { 15, 30, 287, 2, 23, 113, 7647 }, // U+00FE
-    { 15, 29, 238, 0, 22, 109, 7760 }, // U+00FF
+    { 16, 24, 282, 1, 23, 96, 5048 }, // U+00F3
+    { 16, 24, 282, 1, 23, 96, 6700 }, // U+00F4
+    { 16, 23, 282, 1, 22, 92, 6796 }, // U+00F5
+    { 16, 23, 282, 1, 22, 92, 6888 }, // U+00F6
+    { 15, 14, 267, 1, 17, 53, 6980 }, // U+00F7
+    { 16, 18, 282, 1, 17, 72, 7033 }, // U+00F8
+    { 14, 24, 288, 2, 23, 84, 7105 }, // U+00F9
+    { 14, 24, 288, 2, 23, 84, 7189 }, // U+00FA
+    { 14, 24, 288, 2, 23, 84, 7273 }, // U+00FB
+    { 14, 23, 288, 2, 22, 81, 7357 }, // U+00FC
+    { 15, 30, 238, 0, 23, 113, 7438 }, // U+00FD
+    { 15, 30, 287, 2, 23, 113, 7551 }, // U+00FE
+    { 15, 29, 238, 0, 22, 109, 7664 }, // U+00FF
     { 19, 25, 298, 0, 25, 119, 0 }, // U+0100
     { 13, 21, 262, 1, 20, 69, 119 }, // U+0101
     { 19, 27, 298, 0, 27, 129, 188 }, // U+0102
@@ -2791,98 +2795,98 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 8, 3, 150, 1, 9, 6, 100 }, // U+2010
     { 8, 3, 150, 1, 9, 6, 106 }, // U+2011
     { 15, 3, 267, 1, 12, 12, 112 }, // U+2012
-    { 13, 3, 233, 1, 9, 10, 124 }, // U+2013
-    { 27, 3, 467, 1, 9, 21, 134 }, // U+2014
-    { 27, 3, 467, 1, 9, 21, 155 }, // U+2015
-    { 10, 31, 257, 3, 23, 78, 176 }, // U+2016
-    { 14, 7, 192, -1, 0, 25, 254 }, // U+2017
-    { 5, 8, 82, 0, 21, 10, 279 }, // U+2018
-    { 5, 8, 82, 0, 21, 10, 289 }, // U+2019
-    { 6, 8, 117, 0, 4, 12, 299 }, // U+201A
-    { 5, 8, 82, 0, 21, 10, 311 }, // U+201B
-    { 11, 8, 168, 0, 21, 22, 321 }, // U+201C
-    { 11, 8, 168, 0, 21, 22, 343 }, // U+201D
-    { 11, 8, 194, 0, 4, 22, 365 }, // U+201E
-    { 11, 8, 168, 0, 21, 22, 387 }, // U+201F
-    { 13, 23, 239, 1, 23, 75, 409 }, // U+2020
-    { 13, 23, 239, 1, 23, 75, 484 }, // U+2021
-    { 7, 8, 175, 2, 15, 14, 559 }, // U+2022
-    { 9, 10, 172, 1, 16, 23, 573 }, // U+2023
-    { 5, 5, 233, 5, 4, 7, 596 }, // U+2024
-    { 12, 5, 250, 2, 4, 15, 603 }, // U+2025
-    { 19, 5, 369, 2, 4, 24, 618 }, // U+2026
-    { 4, 5, 125, 2, 10, 5, 642 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 647 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 647 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 647 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 691 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 735 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 785 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 835 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 885 }, // U+202F
-    { 32, 23, 549, 1, 22, 184, 885 }, // U+2030
-    { 43, 23, 721, 1, 22, 248, 1069 }, // U+2031
-    { 7, 8, 108, 1, 21, 14, 1317 }, // U+2032
-    { 12, 8, 190, 1, 21, 24, 1331 }, // U+2033
-    { 17, 8, 273, 1, 21, 34, 1355 }, // U+2034
-    { 7, 8, 108, -1, 21, 14, 1389 }, // U+2035
-    { 12, 8, 205, -1, 21, 24, 1403 }, // U+2036
-    { 17, 8, 281, -1, 21, 34, 1427 }, // U+2037
-    { 12, 10, 186, 0, 3, 30, 1461 }, // U+2038
-    { 7, 13, 145, 1, 14, 23, 1491 }, // U+2039
-    { 7, 13, 145, 1, 14, 23, 1514 }, // U+203A
-    { 22, 23, 391, 1, 22, 127, 1537 }, // U+203B
-    { 11, 22, 233, 2, 21, 61, 1664 }, // U+203C
-    { 13, 23, 207, 0, 22, 75, 1725 }, // U+203D
-    { 16, 3, 233, -1, 25, 12, 1800 }, // U+203E
-    { 18, 7, 284, 0, 0, 32, 1812 }, // U+203F
-    { 18, 8, 284, 0, 24, 36, 1844 }, // U+2040
-    { 11, 19, 175, 0, 12, 53, 1880 }, // U+2041
-    { 33, 28, 522, 0, 23, 231, 1933 }, // U+2042
-    { 8, 3, 150, 1, 9, 6, 2164 }, // U+2043
-    { 16, 21, 61, -6, 21, 84, 2170 }, // U+2044
-    { 7, 26, 151, 2, 21, 46, 2254 }, // U+2045
-    { 8, 26, 151, 0, 21, 52, 2300 }, // U+2046
-    { 25, 23, 399, 0, 22, 144, 2352 }, // U+2047
-    { 18, 23, 317, 0, 22, 104, 2496 }, // U+2048
-    { 18, 23, 318, 2, 22, 104, 2600 }, // U+2049
-    { 15, 16, 267, 1, 16, 60, 2704 }, // U+204A
-    { 16, 27, 306, 2, 23, 108, 2764 }, // U+204B
-    { 16, 15, 298, 1, 16, 60, 2872 }, // U+204C
-    { 16, 15, 298, 2, 16, 60, 2932 }, // U+204D
-    { 14, 14, 257, 1, 8, 49, 2992 }, // U+204E
-    { 6, 21, 111, 1, 17, 32, 3041 }, // U+204F
-    { 18, 31, 282, 0, 24, 140, 3073 }, // U+2050
-    { 14, 29, 257, 1, 23, 102, 3213 }, // U+2051
-    { 11, 23, 174, 0, 22, 64, 3315 }, // U+2052
-    { 25, 5, 467, 2, 11, 32, 3379 }, // U+2053
-    { 18, 7, 282, 0, 0, 32, 3411 }, // U+2054
-    { 16, 16, 267, 0, 15, 64, 3443 }, // U+2055
-    { 13, 23, 241, 1, 22, 75, 3507 }, // U+2056
-    { 22, 8, 346, 1, 21, 44, 3582 }, // U+2057
-    { 22, 23, 384, 1, 22, 127, 3626 }, // U+2058
-    { 22, 23, 387, 1, 22, 127, 3753 }, // U+2059
-    { 4, 23, 103, 1, 22, 23, 3880 }, // U+205A
-    { 17, 23, 305, 1, 22, 98, 3903 }, // U+205B
-    { 22, 23, 372, 1, 22, 127, 4001 }, // U+205C
-    { 4, 22, 125, 2, 21, 22, 4128 }, // U+205D
-    { 4, 23, 125, 2, 22, 23, 4150 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 4173 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 4173 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 4173 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 4173 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 4173 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 4173 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 4173 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 4173 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 4173 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 4173 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 4173 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4223 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4273 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4323 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4373 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 4423 }, // U+206F
+    { 13, 3, 233, 1, 9, 10, 5144 }, // U+2013
+    { 27, 3, 467, 1, 9, 21, 5154 }, // U+2014
+    { 27, 3, 467, 1, 9, 21, 124 }, // U+2015
+    { 10, 31, 257, 3, 23, 78, 145 }, // U+2016
+    { 14, 7, 192, -1, 0, 25, 223 }, // U+2017
+    { 5, 8, 82, 0, 21, 10, 248 }, // U+2018
+    { 5, 8, 82, 0, 21, 10, 5175 }, // U+2019
+    { 6, 8, 117, 0, 4, 12, 258 }, // U+201A
+    { 5, 8, 82, 0, 21, 10, 270 }, // U+201B
+    { 11, 8, 168, 0, 21, 22, 5185 }, // U+201C
+    { 11, 8, 168, 0, 21, 22, 5207 }, // U+201D
+    { 11, 8, 194, 0, 4, 22, 280 }, // U+201E
+    { 11, 8, 168, 0, 21, 22, 302 }, // U+201F
+    { 13, 23, 239, 1, 23, 75, 324 }, // U+2020
+    { 13, 23, 239, 1, 23, 75, 399 }, // U+2021
+    { 7, 8, 175, 2, 15, 14, 474 }, // U+2022
+    { 9, 10, 172, 1, 16, 23, 488 }, // U+2023
+    { 5, 5, 233, 5, 4, 7, 511 }, // U+2024
+    { 12, 5, 250, 2, 4, 15, 518 }, // U+2025
+    { 19, 5, 369, 2, 4, 24, 5229 }, // U+2026
+    { 4, 5, 125, 2, 10, 5, 533 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 538 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 538 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 538 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 582 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 626 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 676 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 726 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 776 }, // U+202F
+    { 32, 23, 549, 1, 22, 184, 776 }, // U+2030
+    { 43, 23, 721, 1, 22, 248, 960 }, // U+2031
+    { 7, 8, 108, 1, 21, 14, 1208 }, // U+2032
+    { 12, 8, 190, 1, 21, 24, 1222 }, // U+2033
+    { 17, 8, 273, 1, 21, 34, 1246 }, // U+2034
+    { 7, 8, 108, -1, 21, 14, 1280 }, // U+2035
+    { 12, 8, 205, -1, 21, 24, 1294 }, // U+2036
+    { 17, 8, 281, -1, 21, 34, 1318 }, // U+2037
+    { 12, 10, 186, 0, 3, 30, 1352 }, // U+2038
+    { 7, 13, 145, 1, 14, 23, 1382 }, // U+2039
+    { 7, 13, 145, 1, 14, 23, 1405 }, // U+203A
+    { 22, 23, 391, 1, 22, 127, 1428 }, // U+203B
+    { 11, 22, 233, 2, 21, 61, 1555 }, // U+203C
+    { 13, 23, 207, 0, 22, 75, 1616 }, // U+203D
+    { 16, 3, 233, -1, 25, 12, 1691 }, // U+203E
+    { 18, 7, 284, 0, 0, 32, 1703 }, // U+203F
+    { 18, 8, 284, 0, 24, 36, 1735 }, // U+2040
+    { 11, 19, 175, 0, 12, 53, 1771 }, // U+2041
+    { 33, 28, 522, 0, 23, 231, 1824 }, // U+2042
+    { 8, 3, 150, 1, 9, 6, 2055 }, // U+2043
+    { 16, 21, 61, -6, 21, 84, 2061 }, // U+2044
+    { 7, 26, 151, 2, 21, 46, 2145 }, // U+2045
+    { 8, 26, 151, 0, 21, 52, 2191 }, // U+2046
+    { 25, 23, 399, 0, 22, 144, 2243 }, // U+2047
+    { 18, 23, 317, 0, 22, 104, 2387 }, // U+2048
+    { 18, 23, 318, 2, 22, 104, 2491 }, // U+2049
+    { 15, 16, 267, 1, 16, 60, 2595 }, // U+204A
+    { 16, 27, 306, 2, 23, 108, 2655 }, // U+204B
+    { 16, 15, 298, 1, 16, 60, 2763 }, // U+204C
+    { 16, 15, 298, 2, 16, 60, 2823 }, // U+204D
+    { 14, 14, 257, 1, 8, 49, 2883 }, // U+204E
+    { 6, 21, 111, 1, 17, 32, 2932 }, // U+204F
+    { 18, 31, 282, 0, 24, 140, 2964 }, // U+2050
+    { 14, 29, 257, 1, 23, 102, 3104 }, // U+2051
+    { 11, 23, 174, 0, 22, 64, 3206 }, // U+2052
+    { 25, 5, 467, 2, 11, 32, 3270 }, // U+2053
+    { 18, 7, 282, 0, 0, 32, 3302 }, // U+2054
+    { 16, 16, 267, 0, 15, 64, 3334 }, // U+2055
+    { 13, 23, 241, 1, 22, 75, 3398 }, // U+2056
+    { 22, 8, 346, 1, 21, 44, 3473 }, // U+2057
+    { 22, 23, 384, 1, 22, 127, 3517 }, // U+2058
+    { 22, 23, 387, 1, 22, 127, 3644 }, // U+2059
+    { 4, 23, 103, 1, 22, 23, 3771 }, // U+205A
+    { 17, 23, 305, 1, 22, 98, 3794 }, // U+205B
+    { 22, 23, 372, 1, 22, 127, 3892 }, // U+205C
+    { 4, 22, 125, 2, 21, 22, 4019 }, // U+205D
+    { 4, 23, 125, 2, 22, 23, 4041 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 4064 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 4064 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 4064 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 4064 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 4064 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 4064 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 4064 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 4064 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 4064 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 4064 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 4064 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 4114 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 4164 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4214 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4264 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4314 }, // U+206F
     { 10, 14, 163, 0, 25, 35, 0 }, // U+2070
     { 3, 14, 78, 1, 22, 11, 35 }, // U+2071
     { 10, 13, 163, 0, 25, 33, 46 }, // U+2074
@@ -2959,13 +2963,13 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 14, 27, 267, 2, 24, 95, 3233 }, // U+20BF
     { 12, 21, 230, 1, 16, 63, 3328 }, // U+20C0
     { 15, 3, 267, 1, 12, 12, 0 }, // U+2212
-    { 22, 23, 321, 0, 23, 127, 0 }, // U+FB00
-    { 16, 23, 281, 0, 23, 92, 127 }, // U+FB01
-    { 16, 23, 281, 0, 23, 92, 219 }, // U+FB02
-    { 26, 23, 442, 0, 23, 150, 311 }, // U+FB03
-    { 26, 23, 442, 0, 23, 150, 461 }, // U+FB04
-    { 17, 24, 314, 2, 23, 102, 611 }, // U+FB05
-    { 23, 24, 392, 1, 23, 138, 713 }, // U+FB06
+    { 22, 23, 321, 0, 23, 127, 5253 }, // U+FB00
+    { 16, 23, 281, 0, 23, 92, 5380 }, // U+FB01
+    { 16, 23, 281, 0, 23, 92, 5472 }, // U+FB02
+    { 26, 23, 442, 0, 23, 150, 5564 }, // U+FB03
+    { 26, 23, 442, 0, 23, 150, 5714 }, // U+FB04
+    { 17, 24, 314, 2, 23, 102, 0 }, // U+FB05
+    { 23, 24, 392, 1, 23, 138, 102 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -2973,8 +2977,7 @@ static const EpdUnicodeInterval notosans_14_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -2982,8 +2985,7 @@ static const EpdUnicodeInterval notosans_14_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -2993,19 +2995,57 @@ static const EpdUnicodeInterval notosans_14_regularIntervals[] = {
 };
 
 static const EpdFontGroup notosans_14_regularGroups[] = {
-    { 0, 3077, 7056, 97, 0 },
-    { 3077, 2898, 8689, 96, 97 },
-    { 5975, 3463, 13305, 128, 193 },
-    { 9438, 3505, 11954, 96, 321 },
-    { 12943, 1160, 1924, 112, 417 },
-    { 14103, 8815, 27313, 256, 529 },
-    { 22918, 2238, 11259, 90, 785 },
-    { 25156, 2037, 4839, 111, 875 },
-    { 27193, 606, 1349, 42, 986 },
-    { 27799, 1904, 3619, 33, 1028 },
-    { 29703, 13, 12, 1, 1061 },
-    { 29716, 310, 908, 7, 1062 },
-    { 30026, 132, 196, 1, 1069 },
+    { 0, 2551, 6362, 83, 2 },
+    { 2551, 821, 1556, 26, 0 },
+    { 3372, 2885, 8593, 95, 97 },
+    { 6257, 3463, 13305, 128, 193 },
+    { 9720, 3505, 11954, 96, 321 },
+    { 13225, 1160, 1924, 112, 417 },
+    { 14385, 8815, 27313, 256, 529 },
+    { 23200, 2238, 11259, 90, 785 },
+    { 25438, 1969, 4717, 105, 875 },
+    { 27407, 606, 1349, 42, 986 },
+    { 28013, 1904, 3619, 33, 1028 },
+    { 29917, 13, 12, 1, 1061 },
+    { 29930, 158, 264, 2, 1067 },
+    { 30088, 132, 196, 1, 1069 },
+};
+
+static const uint16_t notosans_14_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_14_regularKernLeftClasses[] = {
@@ -4064,18 +4104,81 @@ static const EpdLigaturePair notosans_14_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_14_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 61, 49 }, { 0x0265, 66, 51 }, { 0x0266, 70, 60 }, { 0x0267, 0, 0 }, { 0x0268, 71, 61 }, // U+0450
+    { 0x0269, 72, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 73, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_14_regular = {
     notosans_14_regularBitmaps,
     notosans_14_regularGlyphs,
     notosans_14_regularIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notosans_14_regularGroups,
-    13,
-    nullptr,
+    14,
+    notosans_14_regularGlyphToGroup,
     notosans_14_regularKernLeftClasses,
     notosans_14_regularKernRightClasses,
     notosans_14_regularKernMatrix,
@@ -4085,4 +4188,8 @@ static const EpdFontData notosans_14_regular = {
     76,
     notosans_14_regularLigaturePairs,
     5,
+    notosans_14_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
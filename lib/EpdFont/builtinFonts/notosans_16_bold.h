@@ -3,2384 +3,2389 @@
  * name: notosans_16_bold
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_boldBitmaps[37940] = {
-    0xCD, 0x5A, 0xBF, 0x8F, 0xDC, 0xC6, 0x15, 0x1E, 0x92, 0xBE, 0x5B, 0x20, 0x2C, 0xE8, 0x22, 0x17,
-    0xC3, 0x39, 0x24, 0x6C, 0x03, 0x27, 0x00, 0xDB, 0x74, 0xA4, 0xA4, 0xC2, 0x45, 0x0A, 0xAB, 0xD0,
-    0x59, 0x85, 0x0B, 0xB9, 0x71, 0x91, 0x4B, 0x71, 0xFF, 0x41, 0xC8, 0xD8, 0x85, 0x8A, 0x14, 0xB9,
-    0x22, 0x4E, 0xE3, 0x22, 0x2E, 0x1C, 0xC0, 0x38, 0x01, 0xB9, 0x26, 0x45, 0x60, 0xD8, 0x18, 0x2A,
-    0x2E, 0x5D, 0x88, 0xB0, 0x63, 0xB8, 0x48, 0x61, 0xC6, 0x96, 0x13, 0x40, 0x29, 0x8E, 0x08, 0x28,
-    0x99, 0x3A, 0x91, 0x9C, 0x7C, 0xDF, 0x7B, 0xE4, 0xDE, 0xEE, 0x9D, 0x14, 0x9D, 0x6C, 0x05, 0x08,
-    0x97, 0xFC, 0xB8, 0x4B, 0x0E, 0xDF, 0xCC, 0xBC, 0x79, 0xBF, 0xB9, 0x69, 0x9B, 0x9E, 0x7C, 0x9A,
-    0xB4, 0x49, 0xA6, 0x4F, 0xAC, 0x9F, 0x7A, 0x23, 0x33, 0xD8, 0xE2, 0x1A, 0x77, 0xBB, 0xB4, 0x4D,
-    0x1A, 0x2F, 0x73, 0xAF, 0x8F, 0xEE, 0x0D, 0x07, 0xB4, 0xBA, 0x5F, 0x18, 0x72, 0xDD, 0x4D, 0x6F,
-    0xCC, 0xB0, 0x68, 0x8C, 0xF1, 0xFA, 0x10, 0xE8, 0xF7, 0x51, 0x6D, 0x4C, 0xA0, 0xD8, 0x45, 0x15,
-    0xB0, 0x8D, 0x4B, 0x63, 0x16, 0x6D, 0x52, 0x9A, 0xC8, 0x61, 0x2B, 0x57, 0x71, 0xE3, 0xDA, 0x57,
-    0x76, 0x07, 0x3D, 0x55, 0x96, 0xFD, 0x95, 0xC4, 0xA4, 0x1C, 0x8D, 0xC9, 0x71, 0x73, 0x5C, 0xC3,
-    0x2D, 0x7B, 0x75, 0x40, 0x4B, 0x1B, 0x74, 0x68, 0x33, 0x06, 0x2D, 0x71, 0x41, 0x3C, 0xD3, 0xB9,
-    0x31, 0x1C, 0xBD, 0x5F, 0xCF, 0xB0, 0x3D, 0xEE, 0x1B, 0x9F, 0x24, 0xD8, 0xA5, 0x49, 0x85, 0xE4,
-    0xBD, 0xAF, 0xDE, 0x37, 0xF6, 0xE3, 0xFA, 0x19, 0x02, 0x7A, 0xBB, 0x07, 0x48, 0x1D, 0x20, 0x76,
-    0xF7, 0x31, 0x56, 0xE7, 0x30, 0x6E, 0xEB, 0x3A, 0xF9, 0x6A, 0xF8, 0x70, 0x66, 0xFC, 0x2F, 0x5D,
-    0x01, 0x7A, 0xAE, 0x7C, 0xD5, 0xFF, 0xBB, 0x2B, 0xEC, 0xEF, 0x1E, 0xB8, 0xCC, 0x92, 0x1E, 0xA0,
-    0x37, 0x89, 0xE3, 0xC3, 0xBF, 0xB8, 0xBB, 0xD6, 0xAF, 0xC0, 0xB4, 0x05, 0xA0, 0x10, 0xB6, 0xA4,
-    0x5F, 0x99, 0xA8, 0x61, 0x67, 0x8D, 0x49, 0xD0, 0x49, 0xFE, 0x51, 0x67, 0xD2, 0x02, 0x9D, 0x5D,
-    0xEA, 0x0D, 0x7A, 0x32, 0xCE, 0xEF, 0xBD, 0x51, 0xCE, 0x43, 0xD0, 0xEB, 0x79, 0xD1, 0xE9, 0x99,
-    0x8F, 0x19, 0x17, 0xF4, 0x49, 0xB5, 0x2B, 0xED, 0xD3, 0x0F, 0xD1, 0x67, 0xFA, 0xB7, 0xCE, 0xBE,
-    0x84, 0x81, 0x26, 0xAE, 0x19, 0x93, 0x07, 0x3D, 0xA6, 0xF8, 0x49, 0x9F, 0xDE, 0x1C, 0x8D, 0xF7,
-    0xDE, 0xA2, 0x4B, 0x4B, 0x52, 0x8C, 0x9A, 0xB4, 0x70, 0xB2, 0x98, 0xB9, 0x9C, 0xD3, 0x52, 0x7F,
-    0xDB, 0x4C, 0xCF, 0xE0, 0x08, 0xDB, 0xF9, 0x83, 0x49, 0x3E, 0x1E, 0xB9, 0x66, 0x18, 0x63, 0xCF,
-    0xC7, 0x4C, 0xE8, 0x38, 0xE0, 0xDA, 0x78, 0xE4, 0x06, 0xB7, 0x67, 0x96, 0xD3, 0xD9, 0x06, 0x2F,
-    0xF0, 0x28, 0x1B, 0x04, 0xCE, 0x0D, 0xE4, 0xD3, 0x11, 0x88, 0x84, 0x43, 0x40, 0xEC, 0x7D, 0x41,
-    0x7E, 0x5F, 0x8C, 0x21, 0x89, 0xBA, 0x3D, 0x90, 0xF4, 0x9C, 0xE3, 0x14, 0xAC, 0x2B, 0xF9, 0x1D,
-    0xCB, 0xD1, 0x85, 0xE0, 0x5F, 0xD2, 0xC5, 0x90, 0x03, 0x0A, 0x9A, 0x6D, 0x72, 0x7C, 0x92, 0xC1,
-    0x55, 0xB6, 0xC6, 0x9D, 0xD2, 0xD6, 0x64, 0xBC, 0x6D, 0x8C, 0xC5, 0x82, 0xF5, 0xC6, 0x0E, 0x5C,
-    0x3B, 0x5C, 0x89, 0x89, 0x15, 0x56, 0x66, 0xB0, 0x2D, 0xA8, 0x55, 0x09, 0xFA, 0xBF, 0xCC, 0xE1,
-    0x14, 0xFC, 0x58, 0x7E, 0xB2, 0x9C, 0x1F, 0x4E, 0x16, 0xF3, 0xF4, 0x9C, 0x09, 0x06, 0xB3, 0x00,
-    0x73, 0x5A, 0x13, 0x83, 0xED, 0xE0, 0x5A, 0xC5, 0x3B, 0xB9, 0xEC, 0x16, 0x7B, 0xB1, 0xB2, 0xCF,
-    0xD7, 0xD9, 0xA6, 0x36, 0x49, 0x43, 0x4E, 0x44, 0x1D, 0x1F, 0xF7, 0x47, 0x72, 0xCB, 0xE4, 0x85,
-    0xD9, 0xC8, 0x6C, 0x46, 0x0A, 0x20, 0x05, 0x9A, 0x61, 0x0F, 0x79, 0x37, 0x01, 0x98, 0xEE, 0xA4,
-    0x01, 0x96, 0xDA, 0xAD, 0x10, 0xCA, 0xD7, 0x7B, 0xC2, 0x2D, 0xC7, 0x21, 0xF9, 0xCB, 0x51, 0x75,
-    0x1C, 0x15, 0xBA, 0x03, 0xE1, 0x2D, 0x4C, 0xC3, 0xBB, 0x42, 0x79, 0xE9, 0xD7, 0xC0, 0x87, 0x0C,
-    0xFC, 0xC0, 0xEF, 0x36, 0x8B, 0xE4, 0xF8, 0xD8, 0x15, 0x64, 0x43, 0x29, 0xE0, 0x5D, 0x73, 0x57,
-    0x28, 0x54, 0x19, 0x25, 0x0A, 0x6C, 0x75, 0xD7, 0x1A, 0x10, 0x06, 0x45, 0x7F, 0xA4, 0xD8, 0xFC,
-    0x24, 0x28, 0x66, 0xF9, 0xA3, 0xA6, 0x2C, 0x1E, 0x01, 0xBB, 0x37, 0x8E, 0x0F, 0x44, 0x98, 0x8B,
-    0x13, 0x78, 0x64, 0x63, 0x05, 0x0F, 0x0C, 0x8F, 0x5B, 0x9A, 0x8C, 0xB4, 0x4E, 0xCB, 0xBC, 0xB4,
-    0x99, 0x33, 0x57, 0xA8, 0x42, 0xCB, 0xDD, 0x9C, 0xB6, 0x20, 0x86, 0x73, 0x24, 0x1F, 0x8C, 0x8C,
-    0x34, 0x23, 0x07, 0xC8, 0x35, 0xB3, 0x18, 0x28, 0x2D, 0x86, 0x8C, 0x20, 0x27, 0x4C, 0xDA, 0xAC,
-    0x34, 0x2D, 0xCE, 0xD5, 0x14, 0xAC, 0x5D, 0xD9, 0x84, 0x1F, 0x14, 0xB6, 0x80, 0xBA, 0x19, 0x8A,
-    0xEA, 0x8F, 0x0B, 0x67, 0xE2, 0xCE, 0x77, 0x59, 0xD2, 0xA2, 0x7F, 0x3C, 0xB7, 0x02, 0x15, 0xC0,
-    0x56, 0xF9, 0x12, 0xD2, 0x55, 0x98, 0xDA, 0xC9, 0x63, 0x24, 0x50, 0x44, 0x10, 0xF2, 0x2C, 0xA4,
-    0xEA, 0x0B, 0x79, 0xD5, 0x82, 0x44, 0x14, 0x82, 0x52, 0x48, 0x21, 0x08, 0x1D, 0xAF, 0xF0, 0x96,
-    0x18, 0x10, 0x58, 0x07, 0x98, 0x18, 0x9C, 0x3F, 0x74, 0x26, 0xA2, 0x56, 0x7C, 0x9B, 0x43, 0xB6,
-    0x7C, 0xCC, 0x38, 0xAF, 0x9A, 0x1A, 0xD1, 0xD3, 0x04, 0x41, 0x37, 0x6E, 0xC7, 0xA0, 0x9E, 0x49,
-    0x93, 0x53, 0x40, 0x15, 0x34, 0x31, 0xE5, 0x28, 0xE5, 0xDA, 0x71, 0x6D, 0x02, 0x8E, 0x37, 0xE2,
-    0xF5, 0xB4, 0x7B, 0xF8, 0x25, 0x4A, 0x41, 0xE9, 0xD6, 0x41, 0xFA, 0xF6, 0x2C, 0x3A, 0x4F, 0xC8,
-    0xDE, 0x9C, 0x9D, 0x8B, 0x3D, 0x8D, 0xF6, 0x23, 0x07, 0xF3, 0xB0, 0xD2, 0x2F, 0xE9, 0x84, 0x58,
-    0x2D, 0x2F, 0x6F, 0xC9, 0x07, 0xAC, 0x91, 0x1B, 0x67, 0x93, 0x71, 0x83, 0x16, 0x43, 0x98, 0xA4,
-    0x9D, 0xFA, 0x4B, 0xC0, 0xCF, 0x77, 0x70, 0x23, 0xB3, 0x77, 0x66, 0xCB, 0x6A, 0xD9, 0x51, 0x4C,
-    0x03, 0x6C, 0xB6, 0xC4, 0x29, 0x09, 0x65, 0x19, 0x66, 0x22, 0x63, 0x15, 0xAA, 0x23, 0x9F, 0xA7,
-    0x7C, 0x3C, 0x00, 0x44, 0x5F, 0x03, 0x92, 0xCF, 0xE8, 0x45, 0xAE, 0x53, 0x65, 0x17, 0x23, 0xAC,
-    0x1B, 0x60, 0xD1, 0x01, 0xA2, 0x06, 0x90, 0x54, 0x0B, 0x75, 0x2B, 0x2D, 0xA1, 0x3B, 0x01, 0x1A,
-    0x2C, 0xF3, 0x30, 0x08, 0x39, 0x96, 0xE8, 0x14, 0x1C, 0x1F, 0xBC, 0x0B, 0x25, 0x20, 0x6F, 0x05,
-    0x9A, 0x19, 0x12, 0xEA, 0x4F, 0xC2, 0xA9, 0x26, 0x6C, 0x47, 0x7B, 0xC5, 0x31, 0xBB, 0xC9, 0x0F,
-    0xE8, 0x54, 0xBD, 0x95, 0x49, 0x67, 0x3F, 0xE5, 0x5D, 0xE1, 0x64, 0x3A, 0xF1, 0xB4, 0x81, 0x8D,
-    0x1D, 0x97, 0x93, 0x96, 0xCD, 0x3A, 0x12, 0x71, 0xE2, 0x1C, 0x69, 0x4C, 0x29, 0x80, 0xD5, 0xB4,
-    0xBA, 0x54, 0x88, 0xA9, 0xF3, 0x06, 0x8F, 0xA4, 0x5F, 0xA0, 0xF3, 0xF4, 0x73, 0xA5, 0xE7, 0xB2,
-    0xD4, 0xBD, 0x05, 0x31, 0xEE, 0x66, 0x49, 0x07, 0xE4, 0xF5, 0x12, 0x2A, 0x88, 0xB6, 0xAD, 0xA2,
-    0xC1, 0x73, 0x65, 0x08, 0x2B, 0x5E, 0x04, 0x32, 0x5C, 0x11, 0xED, 0x58, 0x2C, 0xFF, 0x15, 0x15,
-    0x86, 0xEA, 0x14, 0xEC, 0xEC, 0xEC, 0xA8, 0x25, 0x2F, 0xA6, 0x35, 0x17, 0x5E, 0x45, 0xFD, 0x0C,
-    0x09, 0x99, 0x92, 0x8A, 0xC5, 0x27, 0x95, 0x87, 0xB5, 0x1D, 0xD6, 0xE4, 0x52, 0xDB, 0xD6, 0x53,
-    0x5B, 0x61, 0x8D, 0x6E, 0x7B, 0xF4, 0xBC, 0x5C, 0x1D, 0x51, 0xE5, 0xD8, 0x1D, 0xD2, 0x6B, 0x80,
-    0x6B, 0xB0, 0x2A, 0xAE, 0x20, 0x64, 0xA2, 0xD9, 0xD1, 0x18, 0x8A, 0xBE, 0xF5, 0x64, 0x0E, 0xBD,
-    0x3A, 0x1E, 0x13, 0x9F, 0x13, 0x52, 0x3F, 0x92, 0x01, 0x77, 0x53, 0x34, 0x2E, 0xF3, 0x0A, 0xF6,
-    0x02, 0x90, 0x57, 0xFA, 0x4D, 0x74, 0x7C, 0x7C, 0xC5, 0x15, 0xB2, 0x50, 0x0B, 0xF1, 0x67, 0x96,
-    0x04, 0x68, 0xE4, 0x74, 0x4B, 0x44, 0xC0, 0x70, 0x2D, 0xE4, 0x30, 0x62, 0x59, 0xA8, 0x5E, 0xE8,
-    0x61, 0x98, 0x79, 0x6D, 0x84, 0xE8, 0x4C, 0x19, 0x3F, 0x61, 0x47, 0xE0, 0x35, 0x53, 0x74, 0x59,
-    0x25, 0x53, 0xB0, 0x63, 0x4B, 0xDF, 0xF5, 0x30, 0x69, 0x2F, 0xEC, 0x8B, 0xB1, 0x52, 0x11, 0x98,
-    0xD5, 0x05, 0x2E, 0xEC, 0x3B, 0x37, 0x40, 0x39, 0x62, 0x1F, 0x11, 0xA5, 0x3D, 0xA2, 0x30, 0x8A,
-    0x2B, 0xD8, 0xC4, 0x3C, 0xD5, 0x8A, 0x46, 0x95, 0x39, 0xB5, 0xAD, 0xDA, 0x57, 0x69, 0xD7, 0x49,
-    0xBB, 0xDA, 0x9C, 0xD9, 0xCE, 0x1A, 0x6B, 0xAA, 0x32, 0x85, 0x2B, 0x9E, 0x85, 0x31, 0x16, 0x7E,
-    0x8D, 0xFC, 0x42, 0xA7, 0x3F, 0x4C, 0xEB, 0x6F, 0xB9, 0x4A, 0x96, 0x0B, 0x44, 0x86, 0x82, 0x3F,
-    0xF7, 0xE5, 0x6B, 0x35, 0xA9, 0x9C, 0x9A, 0x3E, 0x21, 0x20, 0xA4, 0x10, 0x7D, 0xED, 0x1E, 0x1C,
-    0xAC, 0xFA, 0x93, 0x5C, 0xFC, 0xC9, 0x72, 0xDB, 0x82, 0xE0, 0x98, 0xD3, 0xDE, 0xC6, 0x4C, 0xD6,
-    0xD3, 0x7C, 0x60, 0x66, 0x81, 0x91, 0x7E, 0x13, 0xF6, 0x23, 0x63, 0xD1, 0xC1, 0xE8, 0xD7, 0x6D,
-    0x1D, 0x08, 0xE3, 0x26, 0xB0, 0x6A, 0x1B, 0xB2, 0xEE, 0x91, 0x67, 0x89, 0xBB, 0x6D, 0x18, 0x2C,
-    0x4C, 0x04, 0x3E, 0x98, 0x43, 0x41, 0xD9, 0x7C, 0x8D, 0x24, 0x29, 0xBB, 0x0D, 0x95, 0x2C, 0xC9,
-    0xE2, 0xFE, 0x19, 0x71, 0x26, 0xE2, 0x50, 0x70, 0x24, 0xE0, 0xB8, 0xA5, 0xD3, 0x28, 0x45, 0x57,
-    0x69, 0x05, 0xE9, 0x5B, 0xE0, 0xE7, 0xE9, 0x9A, 0xC5, 0x37, 0xCF, 0x1B, 0x43, 0x36, 0x4A, 0xC8,
-    0x7C, 0xD0, 0x55, 0x6D, 0xF0, 0xC6, 0xA6, 0x70, 0x87, 0xD3, 0xA3, 0x66, 0x3A, 0xD1, 0xA2, 0x74,
-    0xCC, 0xB6, 0xA9, 0x51, 0xE2, 0xA7, 0x7C, 0x61, 0x59, 0x0D, 0xEF, 0x7C, 0xF8, 0x4E, 0xD8, 0x46,
-    0x0D, 0xDA, 0x5C, 0xEA, 0xE2, 0x0A, 0x23, 0xBA, 0xD8, 0x27, 0xA5, 0xAD, 0xEC, 0x85, 0x3E, 0xFD,
-    0x15, 0xDC, 0xC5, 0x85, 0x21, 0xBD, 0x38, 0x98, 0xDC, 0x0C, 0x39, 0x22, 0x43, 0x8B, 0x13, 0xE2,
-    0x00, 0xEB, 0xF5, 0x3C, 0x39, 0x9C, 0x18, 0x2E, 0x06, 0x7D, 0x7E, 0x71, 0xF4, 0xDD, 0x8B, 0x2D,
-    0x02, 0xB9, 0x23, 0x77, 0xD4, 0x60, 0x69, 0xDD, 0x2D, 0x78, 0xAA, 0x2A, 0x1E, 0x21, 0x54, 0x12,
-    0x2E, 0x3E, 0x2B, 0x93, 0x9B, 0xEC, 0xAC, 0xB7, 0x4F, 0x4B, 0xF9, 0x32, 0x79, 0x43, 0xA1, 0x94,
-    0x05, 0x54, 0xDE, 0x6F, 0x1E, 0xEC, 0xCB, 0xA8, 0x69, 0x44, 0x0C, 0x87, 0x3C, 0xF1, 0x39, 0x70,
-    0x6A, 0xCB, 0xC5, 0x89, 0xF4, 0xE2, 0x1F, 0x7A, 0xEA, 0x66, 0xD4, 0x51, 0x86, 0x93, 0x36, 0x65,
-    0xD8, 0xDC, 0x50, 0x6F, 0xF3, 0x9A, 0xEA, 0x6E, 0xAB, 0xB8, 0xA3, 0xF6, 0x46, 0x54, 0xC1, 0x02,
-    0xE6, 0xDF, 0x97, 0xD0, 0x9D, 0x16, 0x45, 0x14, 0xCB, 0xA9, 0xE3, 0x44, 0x83, 0x71, 0xE7, 0x65,
-    0xB8, 0x53, 0x7A, 0xCF, 0x2A, 0x15, 0xB6, 0xD3, 0x02, 0x30, 0xFC, 0x23, 0xDF, 0xC9, 0xD1, 0xA4,
-    0x4F, 0xDD, 0x71, 0x46, 0xF3, 0xA5, 0x61, 0x9F, 0x04, 0x3D, 0xB0, 0x5C, 0x9B, 0x8E, 0x46, 0xCB,
-    0xB2, 0xD3, 0xBC, 0x99, 0x6D, 0x18, 0x6E, 0xDC, 0xBD, 0x2A, 0x21, 0x91, 0x18, 0xBC, 0x76, 0xB2,
-    0x7A, 0xC7, 0x37, 0xD4, 0xE0, 0xB1, 0x1D, 0xF3, 0x9C, 0x15, 0xC8, 0x5B, 0x9A, 0x02, 0x0A, 0x02,
-    0x83, 0x15, 0x77, 0xF2, 0xEC, 0xFE, 0xB4, 0xC2, 0x9E, 0xC5, 0x57, 0x31, 0xF3, 0xF4, 0x72, 0xB4,
-    0xB6, 0xB0, 0x38, 0xED, 0x26, 0xD6, 0x2B, 0x33, 0xCF, 0xAA, 0xFB, 0xE9, 0x67, 0x57, 0x79, 0x62,
-    0xBD, 0x4E, 0x43, 0x3B, 0x37, 0x91, 0xC6, 0xF1, 0x30, 0xBB, 0x81, 0xD0, 0xD5, 0xDE, 0x9F, 0xC8,
-    0x16, 0x44, 0x15, 0x93, 0x9F, 0x68, 0x21, 0x3B, 0x5C, 0x93, 0x8D, 0xCB, 0x46, 0x66, 0xAE, 0x53,
-    0xD7, 0xB9, 0x0B, 0x62, 0xE4, 0x77, 0x5F, 0x81, 0x55, 0xE0, 0xE8, 0x7B, 0x22, 0x46, 0x91, 0xD2,
-    0xB8, 0x11, 0x61, 0x0D, 0x57, 0xB0, 0x78, 0x04, 0xEA, 0xDD, 0x93, 0xA7, 0xE2, 0x71, 0x49, 0xED,
-    0xB9, 0x89, 0x6B, 0xF5, 0x49, 0x8F, 0x94, 0x7F, 0xF1, 0x41, 0xBC, 0xBC, 0x76, 0x7C, 0xBA, 0x93,
-    0xB9, 0x39, 0x8E, 0x9B, 0x0F, 0x5E, 0xD3, 0x38, 0x41, 0x8F, 0x3B, 0x07, 0xC5, 0x99, 0x36, 0xF3,
-    0x71, 0x9A, 0xDE, 0x79, 0xE8, 0xF3, 0x20, 0xCD, 0xF3, 0xF6, 0xB1, 0x72, 0x9C, 0xF8, 0x91, 0xDB,
-    0xAA, 0x94, 0xCA, 0x56, 0x19, 0x08, 0xA5, 0xF3, 0xBE, 0xF7, 0x3E, 0x2E, 0x97, 0xF3, 0xE2, 0xA8,
-    0x4B, 0xD2, 0x25, 0xD3, 0x25, 0x04, 0x7A, 0x30, 0x5A, 0x69, 0x13, 0x50, 0xAC, 0x56, 0xB1, 0x15,
-    0xEC, 0x20, 0xEE, 0x59, 0x42, 0xA1, 0xCF, 0xB0, 0xC6, 0xC0, 0x88, 0x0E, 0x3A, 0x5B, 0xB8, 0x0A,
-    0x6E, 0xC9, 0x17, 0xB9, 0x37, 0x8A, 0x89, 0x20, 0x2E, 0xD1, 0x4C, 0x60, 0xA9, 0x39, 0xBE, 0xC5,
-    0x00, 0x08, 0xC7, 0xF3, 0xC0, 0xA7, 0x3B, 0xD7, 0x46, 0x12, 0x5A, 0x85, 0x3B, 0x07, 0x87, 0xE3,
-    0xB9, 0x09, 0x2C, 0x01, 0xD9, 0x2D, 0xE4, 0x1A, 0xFB, 0x9E, 0xAB, 0x03, 0x46, 0x12, 0x4F, 0xB0,
-    0x27, 0x5C, 0xA6, 0x5E, 0x77, 0x5A, 0xCE, 0xA7, 0xB5, 0x27, 0xDD, 0x96, 0x45, 0x44, 0xD6, 0xC0,
-    0xB9, 0xE4, 0x2E, 0xCB, 0x3B, 0x32, 0x27, 0xE9, 0x00, 0xB6, 0x41, 0xAA, 0xE3, 0x2A, 0x57, 0x42,
-    0x84, 0x69, 0x3C, 0x18, 0x8F, 0xC3, 0x00, 0x96, 0xB0, 0xD6, 0xEE, 0x26, 0x94, 0xC6, 0x7D, 0xC8,
-    0xAC, 0xEA, 0x16, 0x83, 0xBD, 0x23, 0x89, 0xC8, 0x07, 0x59, 0x5B, 0x01, 0xDC, 0xB8, 0x07, 0x12,
-    0x90, 0x16, 0xFA, 0xF9, 0xBC, 0x9D, 0x9F, 0x15, 0x2A, 0x0B, 0xD2, 0x83, 0xC1, 0x67, 0x83, 0x7A,
-    0xEA, 0x08, 0x9E, 0x5D, 0xED, 0xDA, 0x53, 0x3C, 0xB0, 0x4E, 0xAB, 0x07, 0x4D, 0x2C, 0x84, 0x83,
-    0xC3, 0x8C, 0x70, 0x1A, 0xF5, 0x24, 0x49, 0x43, 0xA5, 0xD2, 0x59, 0xA9, 0x0E, 0x56, 0x8E, 0x49,
-    0xA3, 0xAD, 0x1C, 0x1C, 0x8C, 0xCB, 0x2B, 0xB7, 0x87, 0xB9, 0xA6, 0x95, 0xBB, 0x56, 0x7B, 0x03,
-    0x4E, 0x2F, 0x35, 0x41, 0xCF, 0x53, 0x0B, 0x4F, 0x50, 0xB9, 0x17, 0xBB, 0x45, 0x8B, 0xD3, 0x1B,
-    0x7D, 0xD4, 0xF0, 0x34, 0xC8, 0xE9, 0xF5, 0x11, 0x79, 0x7F, 0x85, 0xBC, 0x18, 0xCE, 0x81, 0xA7,
-    0x5C, 0x4E, 0x16, 0x4E, 0xB9, 0xA2, 0x63, 0x36, 0x3C, 0xA5, 0x7A, 0x42, 0x8C, 0xC3, 0x13, 0x84,
-    0x9F, 0xA7, 0x48, 0x4E, 0x34, 0xCA, 0x25, 0x47, 0x0B, 0x1C, 0x05, 0x21, 0xBD, 0xC4, 0x52, 0xB0,
-    0x22, 0x62, 0x11, 0x80, 0x58, 0x2D, 0xE0, 0x4B, 0x3D, 0xF1, 0x67, 0x8E, 0x78, 0x09, 0x4B, 0x58,
-    0xBA, 0x8B, 0xE0, 0x79, 0x09, 0x2E, 0x57, 0xC0, 0x02, 0x06, 0x1E, 0x98, 0x76, 0xC4, 0xA8, 0x27,
-    0x86, 0x8E, 0x18, 0x60, 0x9A, 0xAE, 0xF0, 0xA8, 0xD2, 0x58, 0x2E, 0xC1, 0x5C, 0x30, 0x11, 0x8C,
-    0x04, 0xC3, 0xA5, 0x2A, 0xC3, 0x36, 0x4B, 0xB8, 0x42, 0x0B, 0x25, 0x35, 0x18, 0x51, 0x31, 0x2C,
-    0xE6, 0xED, 0x85, 0xAB, 0x23, 0xEA, 0x5A, 0x43, 0x53, 0x9B, 0x76, 0x54, 0x61, 0x38, 0x12, 0x26,
-    0x8B, 0x3D, 0x15, 0x39, 0x1A, 0x26, 0x6C, 0x56, 0x70, 0xF5, 0x7A, 0x47, 0x0F, 0xA7, 0x4F, 0x29,
-    0x05, 0x1A, 0x04, 0xDB, 0x82, 0xEC, 0xC2, 0x35, 0x81, 0xE6, 0x40, 0x4B, 0x45, 0xEE, 0xC5, 0x81,
-    0xEE, 0x4F, 0xD9, 0x30, 0x8C, 0xB6, 0x59, 0x3A, 0x9F, 0x61, 0xF2, 0x40, 0x77, 0xF7, 0x98, 0x3E,
-    0xFA, 0xA7, 0x72, 0xCD, 0xE5, 0x4F, 0x48, 0x5E, 0x7A, 0x6C, 0x19, 0x9F, 0x6B, 0x61, 0x4A, 0x22,
-    0xFF, 0xCA, 0xA4, 0xC7, 0xEF, 0x3C, 0xC2, 0x9F, 0x3C, 0x04, 0xFE, 0x1F, 0x79, 0xC2, 0x71, 0x79,
-    0xB9, 0x44, 0x13, 0x31, 0x5D, 0x25, 0xD6, 0xAE, 0x90, 0x70, 0x42, 0x02, 0x58, 0x27, 0x26, 0x75,
-    0xF7, 0xDD, 0xD9, 0xC1, 0xB7, 0xCB, 0xCC, 0x87, 0x6E, 0x6A, 0x9B, 0x8C, 0xF1, 0x94, 0x4F, 0x6B,
-    0xE0, 0xF1, 0x46, 0xA8, 0x81, 0x80, 0xBA, 0x27, 0x65, 0x96, 0x78, 0x46, 0xC6, 0x0F, 0x69, 0x13,
-    0xD3, 0x93, 0x85, 0xA3, 0x18, 0xEA, 0x6C, 0xC9, 0xF7, 0x7A, 0xF2, 0xF7, 0x54, 0xEC, 0x46, 0x53,
-    0x47, 0x71, 0x06, 0x27, 0x55, 0x41, 0x26, 0x15, 0x64, 0x7E, 0xEF, 0x75, 0x67, 0x78, 0xDC, 0xCF,
-    0x21, 0xAE, 0x44, 0xE4, 0x81, 0x64, 0xA2, 0x96, 0x33, 0x8C, 0x24, 0x50, 0x9A, 0x42, 0x53, 0xA6,
-    0x34, 0x53, 0x34, 0x7F, 0x99, 0xF0, 0xCB, 0x2C, 0x94, 0x70, 0x73, 0x20, 0x74, 0x84, 0x9A, 0x09,
-    0x1D, 0x8D, 0x7E, 0x66, 0x1E, 0x9A, 0x7A, 0x6E, 0x5D, 0x75, 0x6F, 0x5E, 0x31, 0x0F, 0x4B, 0xDF,
-    0x9F, 0x1E, 0xC0, 0xAE, 0xF9, 0x12, 0x04, 0xFC, 0xEF, 0x90, 0x8C, 0x6F, 0x25, 0xC8, 0x60, 0xBA,
-    0xC6, 0xE5, 0x4F, 0xB4, 0xF0, 0xDA, 0x1B, 0x8D, 0x77, 0x8C, 0x16, 0x12, 0x62, 0x61, 0x9C, 0x04,
-    0xD5, 0x8C, 0x25, 0xF3, 0x8A, 0x89, 0x9F, 0xAC, 0x97, 0x22, 0x33, 0x3B, 0xA1, 0x13, 0xF5, 0x13,
-    0x32, 0x0B, 0x1F, 0xE4, 0xE7, 0x38, 0x5D, 0x44, 0xDA, 0xCD, 0x82, 0x0E, 0x1F, 0x29, 0xF4, 0xC1,
-    0xBC, 0x12, 0x52, 0x25, 0xA7, 0xCA, 0x5E, 0xD2, 0x86, 0xCB, 0x15, 0xFF, 0x5B, 0xF2, 0xEF, 0x7B,
-    0x82, 0x0F, 0x06, 0x59, 0x2B, 0x29, 0xAD, 0x4D, 0x28, 0x05, 0x2D, 0x11, 0x5A, 0x09, 0xE6, 0xF1,
-    0xB8, 0x50, 0x66, 0x16, 0x91, 0x48, 0x47, 0x48, 0xE9, 0x52, 0x19, 0x00, 0x18, 0x98, 0x0E, 0x1C,
-    0x06, 0x45, 0x6A, 0x64, 0x70, 0x8D, 0xDE, 0xAD, 0x0C, 0x2F, 0x66, 0x28, 0xC7, 0x3C, 0x1C, 0xBB,
-    0xB3, 0x19, 0x7E, 0x46, 0xBD, 0x37, 0xE6, 0xC8, 0x4F, 0x59, 0x10, 0x1D, 0x52, 0x4E, 0x6A, 0x31,
-    0xC0, 0x60, 0x97, 0x20, 0x12, 0x8C, 0xB4, 0xDC, 0x18, 0x6D, 0xE0, 0x16, 0x7D, 0x52, 0xA3, 0x47,
-    0xDF, 0x85, 0x6D, 0x4C, 0xEF, 0xE3, 0xC1, 0xAC, 0x47, 0x8D, 0xD4, 0xBD, 0xF0, 0xE5, 0xAE, 0x94,
-    0xB2, 0x7E, 0x5F, 0x87, 0xF7, 0xA5, 0x66, 0x7B, 0x54, 0x69, 0x30, 0x9E, 0xD3, 0x6B, 0x49, 0xF9,
-    0xC3, 0x21, 0xAD, 0x1C, 0xE4, 0x0B, 0xEC, 0xA7, 0xCA, 0x6A, 0xA6, 0x21, 0x3C, 0x85, 0x92, 0x22,
-    0x6B, 0x54, 0x5F, 0x35, 0x94, 0x41, 0x3E, 0xCA, 0x19, 0xD1, 0xFB, 0x2D, 0x18, 0x92, 0x53, 0x1D,
-    0x7C, 0xF1, 0x88, 0xD4, 0x31, 0x89, 0xC1, 0x25, 0xFA, 0xBE, 0x2F, 0x61, 0xBE, 0x08, 0xFB, 0x42,
-    0x93, 0x00, 0xA1, 0xA9, 0x04, 0x3D, 0xE1, 0x98, 0x5E, 0x91, 0x82, 0x04, 0xD5, 0x07, 0x03, 0x4E,
-    0xEF, 0xF2, 0x29, 0xDB, 0x58, 0x2E, 0x1F, 0xEB, 0x0D, 0x81, 0xB8, 0x13, 0x88, 0x01, 0x86, 0x00,
-    0xDB, 0xC1, 0x30, 0xB4, 0x63, 0x77, 0x96, 0x8B, 0xD5, 0x58, 0x4A, 0x23, 0x7C, 0x02, 0x87, 0x81,
-    0xEB, 0x91, 0x2C, 0x2B, 0xDB, 0x8F, 0x46, 0x9E, 0xC5, 0x58, 0xD8, 0x40, 0x6A, 0x47, 0x37, 0x85,
-    0xF2, 0x17, 0x52, 0xE8, 0xFC, 0x5A, 0x7B, 0xD4, 0x60, 0xBA, 0x97, 0xD5, 0x6C, 0x64, 0x3C, 0xB5,
-    0x8C, 0x4D, 0xBC, 0xC4, 0x37, 0x41, 0xC6, 0x66, 0x92, 0x11, 0xAC, 0x00, 0x92, 0x55, 0x4D, 0x94,
-    0xCA, 0x49, 0xC1, 0xA5, 0x66, 0xC1, 0x4C, 0x91, 0xA3, 0xD3, 0xA4, 0x2E, 0xD0, 0x6C, 0x74, 0xAE,
-    0x7B, 0x68, 0xF5, 0xAC, 0x99, 0x86, 0x22, 0x05, 0x1F, 0x2D, 0xC0, 0xE9, 0x32, 0x41, 0xD5, 0x4F,
-    0x81, 0x65, 0xA9, 0x4B, 0xF6, 0x3B, 0xEB, 0xA5, 0xE8, 0x6F, 0xB6, 0xCF, 0xD4, 0xB6, 0x76, 0x26,
-    0xCD, 0x12, 0xBD, 0xA7, 0xA0, 0xB2, 0x58, 0x2D, 0x63, 0x5C, 0xE0, 0x08, 0x06, 0x23, 0x65, 0x55,
-    0x29, 0x42, 0x48, 0x2A, 0x5D, 0x4E, 0xF9, 0x6E, 0xAD, 0x95, 0xA4, 0xB5, 0xC6, 0xE3, 0xDC, 0x38,
-    0x5B, 0x6F, 0x2C, 0x82, 0xA7, 0xFB, 0x0B, 0xEE, 0xDB, 0x8F, 0xBD, 0x58, 0x52, 0xC3, 0xE8, 0x8D,
-    0xD7, 0x2E, 0x8B, 0xE0, 0xCB, 0x82, 0x61, 0xC4, 0xDE, 0x93, 0x23, 0x76, 0xFF, 0x1B, 0xEA, 0x2A,
-    0x5F, 0xFB, 0x8C, 0x01, 0x02, 0xF0, 0xDE, 0x97, 0x32, 0xFC, 0xC8, 0xFA, 0xB4, 0x65, 0xF6, 0x9B,
-    0x16, 0x31, 0xF4, 0xB7, 0x44, 0xFA, 0x1E, 0x35, 0x2F, 0x64, 0x66, 0xF3, 0x6D, 0x3A, 0x58, 0x1E,
-    0x58, 0xD3, 0xCB, 0xBB, 0x6F, 0x8B, 0x81, 0x62, 0x86, 0xCA, 0x80, 0xC6, 0x84, 0xB5, 0xD9, 0x78,
-    0xCD, 0x2C, 0xCB, 0x45, 0x6A, 0xAC, 0x8C, 0x7F, 0x37, 0xD4, 0x7A, 0x5D, 0x36, 0x55, 0x38, 0x5E,
-    0x86, 0x96, 0xC1, 0xBB, 0x16, 0xA1, 0x66, 0xA4, 0xFF, 0x82, 0xF8, 0xB6, 0xB8, 0x61, 0x6B, 0x02,
-    0x82, 0x7D, 0x7C, 0x5B, 0xE0, 0xDA, 0xFD, 0x3D, 0x75, 0x53, 0x45, 0xEC, 0xFA, 0xBC, 0x80, 0xA7,
-    0x4C, 0x0B, 0xF3, 0x5D, 0x33, 0x15, 0xF3, 0xB4, 0xB8, 0xF1, 0x68, 0x78, 0x3E, 0x33, 0xF6, 0x13,
-    0x0C, 0xC3, 0x7E, 0x0E, 0x11, 0xD7, 0x57, 0x4C, 0xE3, 0x21, 0x28, 0xB7, 0xAA, 0x38, 0x7C, 0x2F,
-    0x62, 0xF8, 0x8A, 0x04, 0x4D, 0xF1, 0xC4, 0x0C, 0xD3, 0x35, 0x00, 0x1D, 0xA5, 0x45, 0xB2, 0x5A,
-    0xF2, 0xD9, 0xE9, 0x1D, 0xD5, 0x2D, 0x56, 0x52, 0x5F, 0x17, 0x05, 0x91, 0x57, 0x0C, 0x3F, 0xA7,
-    0xFF, 0xEB, 0xE0, 0xFE, 0x7A, 0x16, 0xB4, 0x22, 0x77, 0xD0, 0xC0, 0x02, 0x3C, 0x4B, 0xFD, 0x97,
-    0x64, 0x5E, 0x12, 0xFA, 0xE9, 0x98, 0x43, 0xD8, 0x56, 0xAA, 0x54, 0x3F, 0x8A, 0x10, 0x61, 0x93,
-    0x41, 0xBE, 0xBE, 0xF6, 0xAA, 0x8D, 0x56, 0x92, 0x64, 0x66, 0x6C, 0xFF, 0x28, 0xD8, 0xBC, 0xCC,
-    0xBA, 0x58, 0x9F, 0x23, 0xD9, 0x70, 0x79, 0x4D, 0x87, 0x50, 0xC7, 0xEE, 0x06, 0x38, 0x83, 0xDC,
-    0xBA, 0x06, 0x71, 0x5B, 0xE7, 0x4C, 0xE6, 0x01, 0x69, 0x4D, 0x73, 0x3B, 0x41, 0xA3, 0x90, 0x6B,
-    0x13, 0x69, 0x1C, 0xBB, 0x23, 0xA7, 0x04, 0x40, 0x0A, 0xC2, 0x6A, 0xBB, 0xB8, 0xD6, 0xE2, 0x8B,
-    0xF7, 0x07, 0x31, 0x8D, 0x34, 0x2B, 0x5A, 0xF7, 0xA7, 0x79, 0x63, 0x9D, 0xB0, 0x53, 0x9F, 0x92,
-    0x0B, 0x54, 0x74, 0xB7, 0xAB, 0xB0, 0x9E, 0xAE, 0x33, 0x8D, 0x83, 0x94, 0xBD, 0x69, 0x33, 0x16,
-    0x2C, 0x32, 0x6F, 0x8A, 0x6C, 0x86, 0x99, 0x75, 0x3B, 0x19, 0x6C, 0x4F, 0x23, 0x21, 0x00, 0x86,
-    0xE0, 0xB9, 0x7F, 0xEC, 0xFB, 0x52, 0x9E, 0xCC, 0xE4, 0x88, 0xB5, 0xDE, 0x25, 0xC7, 0x8F, 0xDD,
-    0x41, 0x36, 0x5F, 0x7F, 0xD2, 0x03, 0xFC, 0x92, 0xE0, 0x22, 0x5D, 0xE3, 0xD7, 0x5B, 0xE4, 0x97,
-    0x39, 0x07, 0xBF, 0xD2, 0x35, 0x7E, 0x1D, 0x9E, 0xF0, 0x2B, 0x27, 0xBF, 0x00, 0x1B, 0x99, 0x2C,
-    0x8C, 0x56, 0x5B, 0xAB, 0x1F, 0x62, 0xAE, 0x65, 0xAC, 0x02, 0x0B, 0xA6, 0x49, 0x14, 0xE9, 0xDB,
-    0xB1, 0x78, 0x12, 0x81, 0xED, 0x28, 0xB0, 0x6E, 0x2E, 0xEC, 0xBD, 0x45, 0x19, 0xF4, 0x54, 0x60,
-    0x2B, 0x85, 0x5A, 0xC5, 0x74, 0x4D, 0x6A, 0x1F, 0x0F, 0x1B, 0x12, 0x1A, 0x60, 0xB6, 0xD5, 0x86,
-    0x16, 0xC1, 0xEB, 0xC7, 0x7F, 0x28, 0x0D, 0x2C, 0xC5, 0xD6, 0xDC, 0xF1, 0x65, 0x63, 0x59, 0x41,
-    0xAF, 0xBE, 0xCD, 0xCE, 0x0C, 0x94, 0x85, 0x87, 0x02, 0x9E, 0xD7, 0xDE, 0x7E, 0xBC, 0xC8, 0x9F,
-    0x80, 0xAB, 0x29, 0xF7, 0x05, 0xD6, 0x71, 0xA4, 0x28, 0x23, 0x49, 0xAA, 0x99, 0x35, 0x7D, 0xC1,
-    0x34, 0xEA, 0x33, 0x16, 0xF4, 0x8F, 0x06, 0x0A, 0xAE, 0xBE, 0xF7, 0xCE, 0x08, 0xB8, 0xD1, 0x59,
-    0x91, 0x7B, 0x04, 0x8F, 0x35, 0x5C, 0x47, 0x5E, 0x87, 0x8C, 0x43, 0xA0, 0xD6, 0x13, 0x3D, 0x84,
-    0xB4, 0x5B, 0x19, 0x99, 0xF4, 0x64, 0x1F, 0x63, 0xB0, 0x5C, 0x50, 0x7F, 0x7B, 0x9D, 0x7A, 0x5F,
-    0x73, 0xD1, 0x90, 0x92, 0xCA, 0x7B, 0x16, 0xE7, 0xC4, 0xE0, 0x1C, 0xBA, 0x71, 0x0F, 0xEB, 0x08,
-    0x0B, 0x82, 0x68, 0xDB, 0xD0, 0x9C, 0x54, 0xF0, 0xC5, 0x34, 0x71, 0xA5, 0x9C, 0x8D, 0x9E, 0xAB,
-    0xA7, 0x7B, 0x36, 0xE6, 0xFB, 0x10, 0xA3, 0x37, 0x28, 0x46, 0xB7, 0x1E, 0x2F, 0x46, 0xD5, 0x93,
-    0x82, 0xF1, 0x5E, 0x3B, 0xB1, 0x0D, 0x83, 0xD8, 0x86, 0x2C, 0x72, 0x57, 0xB5, 0x16, 0x50, 0xCD,
-    0xC5, 0xC4, 0x94, 0x05, 0x48, 0x40, 0xBD, 0x84, 0x46, 0xEB, 0x9B, 0x92, 0x5F, 0xD8, 0x5A, 0x1A,
-    0x47, 0x30, 0x5B, 0x25, 0x6D, 0x03, 0xBD, 0x05, 0xD3, 0x22, 0x31, 0xAB, 0x62, 0x05, 0x9F, 0x97,
-    0x29, 0xB4, 0x9C, 0xC2, 0x53, 0x33, 0xDD, 0x9F, 0x73, 0x71, 0x3E, 0xE6, 0x4A, 0x55, 0x5B, 0x8F,
-    0xD7, 0x45, 0xA9, 0x41, 0x8B, 0xE9, 0xE8, 0xD7, 0x4D, 0xC7, 0x2B, 0xE7, 0x35, 0x1D, 0xF9, 0x39,
-    0x4D, 0xC7, 0xE3, 0xE1, 0x79, 0x63, 0x2F, 0x62, 0x16, 0xBF, 0xC6, 0x71, 0x24, 0x2B, 0x8A, 0xE3,
-    0x82, 0x14, 0x99, 0x19, 0x1D, 0xD1, 0xF4, 0x70, 0xBC, 0xE7, 0x39, 0xCC, 0xF7, 0x7E, 0x2B, 0xA9,
-    0x76, 0xAC, 0x61, 0x59, 0x05, 0x65, 0xD0, 0x50, 0x9F, 0x0E, 0x4B, 0xCC, 0xB3, 0xBC, 0x1B, 0xA2,
-    0xB1, 0xAE, 0xF0, 0xA5, 0xD1, 0x1E, 0x92, 0xF6, 0x55, 0x1C, 0xF9, 0x9B, 0xB6, 0x61, 0xFA, 0x45,
-    0x8B, 0x2C, 0x66, 0x7C, 0xAE, 0xE3, 0xE7, 0x64, 0x98, 0xFC, 0x01, 0x42, 0xC2, 0x9A, 0x50, 0x8B,
-    0xC0, 0x72, 0xC0, 0x72, 0x17, 0xE7, 0x7B, 0x1F, 0x4B, 0x6B, 0x7D, 0x5C, 0x49, 0xBF, 0x16, 0x47,
-    0xC2, 0x90, 0xEF, 0xF2, 0xD2, 0xD8, 0x60, 0x21, 0xBF, 0x21, 0xD4, 0x94, 0x18, 0xE4, 0xD8, 0x65,
-    0xEE, 0xEC, 0xF4, 0xAE, 0x3F, 0x82, 0xA2, 0x22, 0xD8, 0x6F, 0x11, 0xD0, 0xAC, 0x1A, 0xB4, 0xB8,
-    0xCF, 0xE7, 0xC2, 0x76, 0x83, 0x8C, 0x09, 0x0B, 0xDE, 0x6B, 0x05, 0x1E, 0x42, 0x3A, 0x60, 0x62,
-    0xC1, 0xE8, 0xB3, 0x18, 0x20, 0x7F, 0x4F, 0x78, 0x91, 0x75, 0xB1, 0x5F, 0x43, 0x66, 0xED, 0x2D,
-    0x16, 0x77, 0x8F, 0xA6, 0x3F, 0xA2, 0xE8, 0xAB, 0x95, 0x88, 0x63, 0x0F, 0x35, 0x96, 0x3D, 0x79,
-    0xE9, 0x98, 0x23, 0xAA, 0xA1, 0x7E, 0x52, 0x9A, 0x90, 0x7C, 0x48, 0x6A, 0x5D, 0x2F, 0x06, 0x84,
-    0x93, 0x88, 0xBA, 0x43, 0xA6, 0x3D, 0xE1, 0x83, 0x86, 0xE5, 0xBB, 0x2E, 0xFA, 0x67, 0xCB, 0xEC,
-    0xA7, 0x8F, 0xBE, 0xEC, 0x90, 0xFC, 0x2C, 0x86, 0xF8, 0x93, 0x1E, 0x31, 0x67, 0x30, 0x26, 0x7F,
-    0xE9, 0x25, 0xE3, 0x49, 0x6F, 0x0E, 0x88, 0x18, 0x7D, 0x97, 0x16, 0x63, 0xCE, 0x34, 0x27, 0xCD,
-    0x46, 0x46, 0x91, 0xCE, 0x1A, 0x6B, 0x0B, 0x79, 0x57, 0x9E, 0xB3, 0xDF, 0x9C, 0x95, 0x00, 0x3A,
-    0xE3, 0x41, 0xDF, 0xED, 0x42, 0x6A, 0xD3, 0x41, 0xFD, 0xB2, 0x56, 0x64, 0x35, 0xC4, 0x4E, 0xDB,
-    0x98, 0xE2, 0x1C, 0x8D, 0x62, 0x96, 0x2E, 0x71, 0xED, 0x3F, 0x1A, 0xA7, 0xD7, 0x96, 0xA9, 0xFC,
-    0x71, 0x85, 0x6A, 0x19, 0x69, 0x1A, 0x53, 0x4D, 0xF3, 0xB4, 0xF2, 0xBE, 0xFE, 0x16, 0x33, 0x91,
-    0xEB, 0x0E, 0x73, 0xC5, 0xD4, 0x10, 0xCF, 0xCB, 0x2B, 0x88, 0x9C, 0x59, 0x4B, 0xDA, 0x4F, 0x3E,
-    0x46, 0xB9, 0x9A, 0x4C, 0x5C, 0xED, 0x94, 0xAB, 0xB6, 0x0A, 0x85, 0xAB, 0xE8, 0x12, 0xD2, 0xA1,
-    0x5C, 0x65, 0x8E, 0x75, 0x9D, 0xEF, 0x0B, 0x3F, 0x62, 0x91, 0x4C, 0xB9, 0x2A, 0x7F, 0x07, 0x90,
-    0x02, 0x41, 0x6D, 0xB4, 0x6A, 0xB5, 0x58, 0x66, 0x02, 0xA7, 0x5E, 0x94, 0xE6, 0xFD, 0x34, 0x32,
-    0xF9, 0xC3, 0x04, 0x45, 0x59, 0x73, 0x8B, 0xE9, 0x1D, 0x52, 0x33, 0x1F, 0xBB, 0x07, 0xF2, 0xA6,
-    0xA9, 0xD4, 0xFF, 0x11, 0x8D, 0x5A, 0xA2, 0x96, 0x94, 0xB7, 0x92, 0x17, 0xA5, 0xCC, 0x3E, 0x48,
-    0x90, 0x11, 0x0C, 0xDA, 0xB7, 0x6E, 0xE5, 0x30, 0xDE, 0x1F, 0xF5, 0xED, 0x32, 0xF9, 0x49, 0xBF,
-    0x71, 0xE6, 0x8F, 0x29, 0xAE, 0x7C, 0x8E, 0xC6, 0x96, 0x4E, 0xCD, 0xB2, 0x60, 0x91, 0x31, 0x73,
-    0x39, 0xFB, 0xFF, 0x15, 0xEE, 0xF7, 0x49, 0x27, 0x71, 0x9A, 0xEE, 0x60, 0xE1, 0xFE, 0xFB, 0xB6,
-    0xFB, 0x5E, 0xC6, 0xCC, 0xD3, 0xCA, 0x9F, 0x77, 0x20, 0x34, 0xC1, 0xA9, 0x9D, 0xC5, 0x77, 0x8C,
-    0xFF, 0xAF, 0x7C, 0x69, 0xB7, 0x8D, 0xC1, 0x81, 0xB3, 0x83, 0x4F, 0x91, 0x3D, 0xD3, 0x72, 0x30,
-    0x7B, 0x83, 0xD0, 0xE9, 0x26, 0x23, 0x27, 0xAF, 0x46, 0x13, 0xB7, 0xEF, 0x63, 0xE0, 0xE3, 0xA1,
-    0xBE, 0x45, 0xFC, 0x33, 0xAC, 0x72, 0x96, 0x2D, 0x39, 0xF8, 0x1F, 0xD5, 0x5A, 0xBF, 0xB3, 0xDD,
-    0xC4, 0x15, 0x3E, 0x92, 0xEC, 0x27, 0x40, 0x61, 0xE4, 0x22, 0x1E, 0x06, 0x28, 0x94, 0x92, 0xA1,
-    0x40, 0xFF, 0x00, 0xB0, 0xC2, 0x14, 0x14, 0x14, 0x71, 0xE1, 0x07, 0x05, 0x45, 0x9A, 0x50, 0xC4,
-    0x05, 0xAF, 0xA5, 0x80, 0x91, 0x20, 0x33, 0xA1, 0xCC, 0x2B, 0x42, 0x45, 0x11, 0x0A, 0x67, 0x06,
-    0x3F, 0x17, 0x6E, 0x52, 0xA4, 0x00, 0x6B, 0x69, 0xD2, 0xA4, 0x40, 0x84, 0x49, 0x6D, 0x25, 0x71,
-    0x26, 0x19, 0x5C, 0x58, 0x85, 0x08, 0xB2, 0x91, 0xB4, 0xF9, 0xBE, 0xB3, 0xBA, 0xF7, 0xDD, 0xF7,
-    0x6C, 0xE3, 0x1F, 0x84, 0x37, 0xF6, 0xB5, 0x74, 0xF6, 0x59, 0x5A, 0xED, 0x9E, 0x73, 0x76, 0xF7,
-    0x3B, 0x3F, 0x76, 0x45, 0xB2, 0xD6, 0xF4, 0x66, 0x30, 0x7D, 0xD6, 0x05, 0xC2, 0x5F, 0xD6, 0x66,
-    0x9D, 0xFF, 0x97, 0x2F, 0xFF, 0x0C, 0xFF, 0xF5, 0xCB, 0xBF, 0x41, 0x2B, 0x45, 0x9D, 0xBF, 0xE3,
-    0xEB, 0x22, 0xB5, 0x1B, 0x22, 0xE7, 0x86, 0xD4, 0xB9, 0x2E, 0x77, 0x6F, 0x74, 0xAC, 0x51, 0xE2,
-    0x55, 0xDD, 0xE2, 0x6E, 0x36, 0x6E, 0xFC, 0xBF, 0x6C, 0xFD, 0x3B, 0x33, 0xCA, 0x2F, 0x33, 0xE7,
-    0x7A, 0x7C, 0xD3, 0x87, 0xB8, 0x65, 0xC7, 0xB5, 0x12, 0xF5, 0xFB, 0xED, 0x06, 0xA7, 0xC5, 0xFF,
-    0xB6, 0x1C, 0x7A, 0xC8, 0x9D, 0xAB, 0xD0, 0x8D, 0x13, 0x71, 0x20, 0x81, 0xB3, 0x4F, 0x4A, 0xE8,
-    0x0A, 0x01, 0x91, 0x4D, 0x12, 0xF1, 0x59, 0xCD, 0xE6, 0xF6, 0xC9, 0xEB, 0xEE, 0xC3, 0xD3, 0x07,
-    0xAA, 0xAC, 0x48, 0x32, 0x81, 0xE4, 0x94, 0x06, 0xF5, 0x5C, 0x73, 0x88, 0x68, 0xDF, 0xA9, 0xC8,
-    0xDB, 0x92, 0x5F, 0x9B, 0x67, 0x32, 0x30, 0x4B, 0x02, 0x21, 0x25, 0x9E, 0xB2, 0x4E, 0xD2, 0x2E,
-    0x1A, 0x24, 0x6D, 0xC2, 0x71, 0x21, 0x2D, 0xFE, 0x9B, 0xF4, 0x49, 0x2F, 0x31, 0x74, 0x20, 0x10,
-    0x6C, 0x14, 0x43, 0x4E, 0xD3, 0xDF, 0x9C, 0xFB, 0x54, 0xA0, 0xD5, 0x9F, 0x51, 0x01, 0xD9, 0x00,
-    0xC9, 0xA9, 0x4A, 0x31, 0x6D, 0x3A, 0x48, 0x6D, 0x93, 0x51, 0x5C, 0x15, 0xCD, 0xE0, 0x2B, 0x74,
-    0xD1, 0x0C, 0xD9, 0x5E, 0x19, 0xC1, 0xCC, 0x17, 0x60, 0xC9, 0x5C, 0xEB, 0x28, 0x34, 0x94, 0x95,
-    0x3A, 0x2B, 0xE1, 0x45, 0xF7, 0x35, 0x78, 0x46, 0x7B, 0x4A, 0x20, 0xD2, 0x19, 0x2F, 0x43, 0x70,
-    0xC1, 0x9D, 0xDF, 0x78, 0x11, 0xBC, 0xEE, 0xB6, 0x37, 0x25, 0x54, 0x52, 0x6F, 0xFE, 0xBC, 0x4A,
-    0xCF, 0x6E, 0x3E, 0x3A, 0x2B, 0x27, 0xA9, 0x1F, 0x57, 0x61, 0x28, 0x6C, 0x7E, 0xA3, 0xB6, 0xC6,
-    0x6E, 0x15, 0xC6, 0x82, 0x07, 0xF4, 0x9E, 0x81, 0xAB, 0x18, 0x6C, 0x24, 0x90, 0x3E, 0xBB, 0xEA,
-    0x2A, 0x63, 0x4B, 0x6B, 0xAA, 0xAC, 0x31, 0x36, 0x6D, 0x4D, 0x9B, 0x35, 0xD9, 0x64, 0x6C, 0xCC,
-    0xB1, 0x21, 0x5B, 0x4F, 0xA3, 0xD4, 0x81, 0xCE, 0xF9, 0x65, 0xFB, 0xB6, 0x98, 0xA6, 0xFC, 0xCE,
-    0xD9, 0x12, 0xEF, 0x32, 0x28, 0x4E, 0x4E, 0x6A, 0xE7, 0x46, 0xA6, 0xFA, 0x7D, 0xE7, 0xDE, 0x77,
-    0x65, 0x31, 0x1D, 0x93, 0x13, 0xB2, 0xFA, 0xED, 0xB8, 0x5D, 0x61, 0x67, 0x4E, 0x87, 0xA5, 0x0D,
-    0x6A, 0x34, 0x86, 0x3F, 0x13, 0x4C, 0x8B, 0x2E, 0x78, 0x33, 0x84, 0xE2, 0x6D, 0xE6, 0x9A, 0xCF,
-    0x24, 0x2D, 0x4A, 0x67, 0x8D, 0x64, 0x78, 0x59, 0x64, 0xC5, 0x8B, 0x21, 0xE6, 0x4C, 0x5A, 0x3D,
-    0xCF, 0x29, 0x93, 0xD8, 0x77, 0x62, 0xF4, 0x1C, 0xA3, 0x68, 0x6E, 0x2E, 0x9E, 0x8F, 0x5A, 0x56,
-    0x79, 0x81, 0x35, 0xD3, 0x2A, 0x0F, 0xC0, 0x50, 0x5A, 0xA4, 0x85, 0xBB, 0x60, 0x73, 0x3C, 0xCE,
-    0x9D, 0x7D, 0x17, 0x1D, 0x85, 0xE7, 0x83, 0x51, 0x70, 0x49, 0x82, 0x5A, 0xE5, 0xAE, 0x94, 0xD0,
-    0x43, 0xC2, 0xA1, 0xD7, 0x59, 0xD2, 0xB2, 0x58, 0x4D, 0xCC, 0x2D, 0xD7, 0xA4, 0x98, 0xBF, 0x17,
-    0x50, 0x79, 0x94, 0xB3, 0x53, 0xE2, 0xA6, 0xFC, 0x5F, 0x93, 0x29, 0x26, 0x73, 0x6A, 0x32, 0xD7,
-    0xA6, 0xCC, 0xBD, 0xBB, 0x75, 0xE5, 0x19, 0x79, 0x44, 0x1E, 0x85, 0x30, 0x55, 0x86, 0xC9, 0xDB,
-    0x96, 0x1D, 0xE6, 0xAD, 0xB3, 0x91, 0xC3, 0x2C, 0x4D, 0xA7, 0x64, 0x16, 0xD3, 0xE7, 0xA3, 0x3E,
-    0xC7, 0x8A, 0xC0, 0xA4, 0xC8, 0x87, 0x0C, 0x33, 0x69, 0x8A, 0x39, 0x98, 0xA7, 0xA8, 0x52, 0x8B,
-    0x59, 0x58, 0xB6, 0x78, 0x93, 0x81, 0x4F, 0x39, 0xC6, 0x81, 0xDB, 0xDB, 0xDB, 0x2B, 0x38, 0x3D,
-    0xAB, 0x7D, 0x42, 0x95, 0xDE, 0x9E, 0x18, 0xD7, 0xAE, 0x2F, 0xD9, 0xF8, 0x7D, 0x9F, 0xB6, 0xB7,
-    0x4F, 0xAB, 0xB6, 0x31, 0x6C, 0xD4, 0xB6, 0xF3, 0xDA, 0x1E, 0x93, 0x16, 0xDA, 0x96, 0x31, 0xEA,
-    0xA0, 0x6D, 0x16, 0xD0, 0xB6, 0x8C, 0x71, 0x0B, 0xFD, 0xCA, 0xB4, 0x63, 0x59, 0xE0, 0x03, 0x2D,
-    0x66, 0x6A, 0x5B, 0x46, 0xAA, 0xF5, 0x05, 0x19, 0x53, 0x0B, 0x6D, 0xE3, 0xF3, 0x86, 0xDA, 0xC6,
-    0x77, 0x7C, 0x3C, 0x06, 0x03, 0xB5, 0x7D, 0x46, 0xB6, 0xEF, 0x4A, 0xDB, 0xCF, 0x42, 0xEC, 0x5D,
-    0xAE, 0xA7, 0x4E, 0x09, 0xFF, 0xFB, 0xB1, 0xAE, 0x67, 0xCC, 0x59, 0x3C, 0x1A, 0xCB, 0x97, 0xA6,
-    0x4B, 0x72, 0xE9, 0x92, 0x94, 0xA0, 0xF8, 0x1B, 0x4F, 0x52, 0xA2, 0x4A, 0xA5, 0x38, 0xD5, 0x53,
-    0xCE, 0xDB, 0x90, 0xB3, 0x17, 0x6E, 0xDC, 0xAC, 0xCF, 0xF8, 0xFB, 0xBE, 0x50, 0x86, 0x6E, 0x39,
-    0x0C, 0xDB, 0x60, 0x1D, 0x5A, 0xEE, 0xF3, 0x6B, 0xE3, 0x63, 0xD1, 0x28, 0xB8, 0x62, 0x40, 0x04,
-    0xD6, 0x7A, 0x23, 0xAE, 0x88, 0x26, 0x49, 0x7B, 0x40, 0xC2, 0xE4, 0x2F, 0x32, 0xB6, 0xD4, 0x1F,
-    0xB2, 0x8F, 0xC6, 0x63, 0xD0, 0x01, 0x50, 0xE4, 0x0D, 0xF0, 0x6C, 0x43, 0x40, 0xD6, 0x16, 0x2A,
-    0xCC, 0x27, 0x64, 0x36, 0x17, 0x28, 0x0B, 0x61, 0x00, 0xCB, 0x7A, 0x6F, 0x17, 0x6F, 0x31, 0x39,
-    0x80, 0x1C, 0x68, 0xB2, 0x5C, 0xC6, 0x11, 0xCB, 0xAD, 0x6E, 0xEE, 0x81, 0xB8, 0x85, 0xB4, 0x24,
-    0x98, 0x90, 0x4D, 0xDD, 0x47, 0x44, 0xBC, 0x7A, 0x1F, 0xFB, 0x4C, 0x53, 0x5F, 0x1B, 0xF3, 0xA6,
-    0xFE, 0xB2, 0xF0, 0xAB, 0xF9, 0x0E, 0x44, 0x82, 0xED, 0xED, 0xD3, 0x84, 0xD0, 0x2E, 0xE6, 0xE0,
-    0x00, 0x45, 0xAE, 0xC2, 0x0A, 0xB8, 0x53, 0x1C, 0xAB, 0x4D, 0x52, 0xAE, 0xC9, 0xA1, 0x17, 0x5A,
-    0x39, 0x25, 0x89, 0x49, 0xD0, 0x14, 0x88, 0x64, 0x3F, 0x94, 0x2C, 0xA6, 0xCC, 0x9B, 0xB6, 0xBC,
-    0x0B, 0x0A, 0xC0, 0x00, 0xA6, 0x37, 0x51, 0x1F, 0x58, 0x55, 0x4B, 0xE9, 0xA4, 0x9C, 0xC4, 0x5C,
-    0xF1, 0x6A, 0x24, 0x56, 0x66, 0x0E, 0x7D, 0x4B, 0x59, 0xCB, 0x33, 0xD0, 0x6E, 0xC9, 0x87, 0xB7,
-    0xB8, 0xF4, 0x17, 0xB8, 0x2A, 0x71, 0x7D, 0xF6, 0xDD, 0x68, 0xEC, 0x6C, 0x8A, 0xDA, 0x14, 0xA5,
-    0x5E, 0x75, 0x6E, 0xE7, 0xD4, 0x8D, 0x31, 0x4C, 0xC0, 0x5B, 0x45, 0x28, 0x41, 0x21, 0x99, 0xCD,
-    0xAC, 0x5F, 0xC3, 0xCB, 0xEA, 0xC6, 0xB2, 0x57, 0x00, 0x08, 0x74, 0x75, 0xEB, 0xE2, 0x27, 0x09,
-    0xDD, 0x7B, 0x1C, 0x5C, 0x22, 0xC3, 0x98, 0x4E, 0x44, 0x86, 0x41, 0xCA, 0x06, 0x9F, 0x25, 0x55,
-    0x62, 0xC5, 0x9B, 0xE5, 0xBC, 0xD2, 0x75, 0x82, 0xA9, 0x96, 0xB5, 0x58, 0xB9, 0x95, 0x00, 0xA4,
-    0x73, 0x14, 0x65, 0x21, 0xA6, 0xAC, 0x28, 0xD4, 0xE3, 0xA6, 0x0A, 0x27, 0x5D, 0xF6, 0x98, 0x7D,
-    0x2C, 0x58, 0x1F, 0x45, 0xDA, 0x7A, 0x2C, 0xB0, 0xC7, 0x51, 0xB5, 0x2A, 0x2B, 0xCC, 0x1F, 0x53,
-    0x39, 0x0E, 0x9F, 0x79, 0x6F, 0xC2, 0x1C, 0x10, 0xF3, 0xEB, 0x11, 0xB3, 0x40, 0x4E, 0xBE, 0xDA,
-    0x27, 0xD7, 0x30, 0xA6, 0x69, 0x97, 0xED, 0x10, 0xC6, 0x1B, 0x93, 0x37, 0xFC, 0xF0, 0x53, 0x16,
-    0x2E, 0x18, 0x50, 0x04, 0x73, 0x44, 0xCC, 0x88, 0x46, 0x2D, 0xE2, 0x3E, 0xD8, 0xAB, 0xFF, 0xC3,
-    0x59, 0x8E, 0xCA, 0xBC, 0xB4, 0xF8, 0xE1, 0x7C, 0x9E, 0x55, 0x3E, 0x3F, 0xC0, 0x52, 0x00, 0x9F,
-    0x19, 0x8D, 0xE9, 0x7B, 0x53, 0x7A, 0x75, 0x22, 0x9F, 0x61, 0x30, 0x93, 0x4F, 0x09, 0x26, 0xF2,
-    0xC9, 0x65, 0xC6, 0x3E, 0x61, 0x79, 0x89, 0x78, 0x34, 0x3C, 0x1C, 0xDC, 0x0A, 0x7C, 0x0A, 0x2D,
-    0x2A, 0x5E, 0xA7, 0xD7, 0xCF, 0x70, 0xE5, 0xE6, 0xB4, 0xC6, 0x9D, 0x16, 0xE4, 0x91, 0xF6, 0x4A,
-    0x7F, 0x31, 0x5C, 0x06, 0x74, 0x4F, 0x78, 0xE4, 0x62, 0x85, 0xDD, 0xCD, 0xAD, 0x3C, 0x82, 0x0F,
-    0xC0, 0x2A, 0x1D, 0x11, 0xD6, 0x4B, 0xDB, 0x40, 0xED, 0xA0, 0xB2, 0x8B, 0x82, 0x40, 0x10, 0x5E,
-    0xEC, 0x28, 0xB6, 0x44, 0xD0, 0xCA, 0xC9, 0x02, 0x1D, 0x19, 0x5B, 0xDB, 0x3F, 0xC5, 0x43, 0x0D,
-    0xDC, 0xAE, 0xDD, 0x37, 0x50, 0x13, 0x0C, 0xDF, 0x57, 0x63, 0xE2, 0xEC, 0xD6, 0xF9, 0x78, 0x48,
-    0x09, 0x6D, 0x69, 0x67, 0x68, 0x57, 0xB3, 0xE6, 0x33, 0x35, 0xAF, 0x76, 0x60, 0x51, 0xBF, 0xDC,
-    0xB3, 0x70, 0x31, 0x7D, 0x86, 0x70, 0xD4, 0x22, 0x1E, 0xC2, 0xBD, 0xFA, 0x8A, 0xAA, 0x15, 0xEF,
-    0xA0, 0x45, 0x16, 0x02, 0xE0, 0x89, 0x29, 0xB4, 0xF3, 0x37, 0x66, 0x92, 0x84, 0xC3, 0x3E, 0xA2,
-    0x07, 0x67, 0x54, 0x5C, 0xBD, 0xE1, 0x58, 0x08, 0xBC, 0xB0, 0x00, 0x13, 0x31, 0x86, 0xFF, 0x90,
-    0xA2, 0xAA, 0xE9, 0xBD, 0x45, 0x2F, 0x1B, 0x75, 0xC2, 0x4E, 0x98, 0x7E, 0x6B, 0xC0, 0xF2, 0x1B,
-    0xE1, 0xAB, 0xCC, 0x31, 0xFD, 0x9A, 0x9D, 0xB9, 0x90, 0xAD, 0x3D, 0x85, 0x4C, 0x7C, 0x22, 0xDE,
-    0x5D, 0x83, 0x72, 0x7B, 0xD5, 0xD2, 0xA8, 0x7D, 0x5C, 0x92, 0x43, 0xBF, 0x5A, 0x19, 0x70, 0xA3,
-    0xAE, 0x89, 0x49, 0xBF, 0x55, 0xC7, 0x63, 0x56, 0x07, 0x6B, 0x24, 0x04, 0xA7, 0x23, 0x9B, 0x4B,
-    0x87, 0xDA, 0xB2, 0x31, 0xB2, 0xA0, 0x2E, 0x10, 0x98, 0x60, 0xD3, 0x75, 0x93, 0xA1, 0x09, 0x67,
-    0xD3, 0x51, 0x17, 0xD5, 0x44, 0x4F, 0xC4, 0xCD, 0xEA, 0xCE, 0x38, 0x9A, 0x27, 0xE7, 0x8A, 0x84,
-    0xD4, 0xA6, 0xF3, 0xF6, 0x6B, 0xCE, 0x62, 0x0D, 0x01, 0xB8, 0xE8, 0x60, 0xD6, 0x1D, 0x25, 0x2A,
-    0x3B, 0x75, 0x26, 0x07, 0x1A, 0x8B, 0x9C, 0x5C, 0x9C, 0xFD, 0x58, 0x19, 0x6A, 0x57, 0xCE, 0xA0,
-    0xF7, 0xF2, 0x24, 0x53, 0x40, 0x50, 0x9B, 0xF8, 0x40, 0xF3, 0xFF, 0xAC, 0xB2, 0x5F, 0x8F, 0x6A,
-    0xDD, 0x68, 0x07, 0xE3, 0x89, 0x52, 0x64, 0x9D, 0x69, 0xD6, 0xEB, 0xE4, 0x81, 0xD6, 0xBF, 0xCE,
-    0x9F, 0x39, 0xA0, 0x53, 0x06, 0x3B, 0xA0, 0x8E, 0x3B, 0x2B, 0xBC, 0x42, 0x1E, 0x5E, 0x90, 0xB7,
-    0xE4, 0x61, 0xE0, 0x3F, 0x69, 0x01, 0x61, 0x8B, 0xCE, 0x3D, 0x4D, 0x3B, 0x80, 0x02, 0x60, 0x38,
-    0x78, 0xD0, 0xF9, 0xCF, 0xD5, 0x22, 0xD3, 0xD9, 0x96, 0xE0, 0x3A, 0xF9, 0x09, 0xBB, 0x17, 0xD7,
-    0xD4, 0x73, 0xF8, 0x00, 0x71, 0xAB, 0x5F, 0x68, 0x8C, 0xE3, 0x74, 0x9A, 0x64, 0x4B, 0x69, 0x96,
-    0xB2, 0xFC, 0xDA, 0x7D, 0x08, 0xDF, 0x42, 0xEA, 0xCF, 0xBD, 0x2F, 0x07, 0x23, 0x59, 0xE9, 0xCA,
-    0x08, 0xB4, 0x8C, 0x96, 0x32, 0x86, 0x0D, 0xFB, 0xDB, 0x76, 0x01, 0xDE, 0x03, 0xF6, 0x8D, 0x38,
-    0xCB, 0x97, 0xA6, 0xF3, 0x65, 0xD9, 0x06, 0xEE, 0xEB, 0x3D, 0x8D, 0x1F, 0xB5, 0xBE, 0xF3, 0x65,
-    0xB8, 0x94, 0xD1, 0x52, 0x26, 0xE4, 0x59, 0x55, 0x20, 0xDA, 0x6E, 0x46, 0x00, 0xA5, 0xCF, 0xD9,
-    0xF9, 0xB2, 0x5C, 0x4A, 0x18, 0xCA, 0xC0, 0xF3, 0xA7, 0xB0, 0x5B, 0xC3, 0x93, 0x4E, 0x89, 0xDA,
-    0xF0, 0x6D, 0x94, 0x01, 0xC4, 0xC2, 0xFD, 0x56, 0x97, 0x60, 0xDD, 0x9E, 0x20, 0xF0, 0xFA, 0x79,
-    0xA5, 0x51, 0x33, 0x75, 0x20, 0xA6, 0xBB, 0x05, 0xE9, 0x57, 0x55, 0xB4, 0x72, 0xC6, 0xB1, 0x49,
-    0x75, 0x50, 0x5C, 0x1B, 0xFC, 0x91, 0x0C, 0xF6, 0xA2, 0x24, 0x27, 0xD9, 0xD2, 0xF0, 0x34, 0xDB,
-    0xF5, 0x3E, 0xC1, 0x12, 0xC3, 0xAA, 0x25, 0x85, 0x13, 0x29, 0xC1, 0x35, 0x12, 0xC7, 0x16, 0xC1,
-    0xD9, 0xB3, 0xE7, 0x7C, 0x73, 0x31, 0x5B, 0xE3, 0xD0, 0xD2, 0x44, 0xAA, 0x23, 0xEB, 0x7F, 0x1C,
-    0x80, 0x03, 0x37, 0x14, 0xC9, 0x6A, 0x07, 0x6E, 0x3E, 0x83, 0x22, 0xD7, 0x37, 0x94, 0x79, 0x53,
-    0x9D, 0xD5, 0x7D, 0xA8, 0x3D, 0x09, 0xA0, 0x78, 0xDA, 0xD8, 0x74, 0xF4, 0xB2, 0x42, 0xB3, 0xC1,
-    0x24, 0x47, 0xD7, 0xFF, 0xD9, 0x5D, 0x35, 0x83, 0x11, 0x06, 0x28, 0xFD, 0xAF, 0x83, 0xEB, 0x5C,
-    0x57, 0x97, 0x60, 0x82, 0x8F, 0xAC, 0x7F, 0x0E, 0xA7, 0x35, 0x85, 0x69, 0x11, 0x58, 0xE3, 0xCE,
-    0x6C, 0x59, 0x04, 0x1A, 0xCB, 0x1D, 0x4D, 0xFF, 0xB0, 0x87, 0x98, 0x57, 0xBA, 0x52, 0x0B, 0xC6,
-    0x57, 0xC9, 0x12, 0x05, 0xE6, 0x6E, 0xC6, 0x2A, 0xC3, 0xF5, 0x34, 0xC0, 0x02, 0x1F, 0xDE, 0xCB,
-    0x95, 0xB8, 0xC1, 0x7F, 0x8B, 0x4B, 0x1E, 0xFB, 0x84, 0x1D, 0xD4, 0x58, 0x62, 0x45, 0xCC, 0x44,
-    0xC8, 0x0A, 0x18, 0xDD, 0x80, 0xE5, 0x80, 0x6B, 0xC7, 0xB5, 0x11, 0x23, 0xDA, 0x7B, 0xB8, 0x72,
-    0xB2, 0x3E, 0xFA, 0x4B, 0x2D, 0x22, 0x58, 0x0C, 0x81, 0x57, 0x09, 0x6C, 0x21, 0x1C, 0xFA, 0xC6,
-    0x14, 0xFB, 0x76, 0x30, 0x59, 0x12, 0x17, 0xBC, 0xB7, 0x68, 0x31, 0x39, 0xC7, 0x7E, 0xC0, 0x4D,
-    0xAB, 0xBB, 0x6A, 0x8F, 0xB7, 0xEA, 0xAA, 0x40, 0x68, 0x69, 0x5D, 0xC1, 0x9B, 0x7E, 0xF3, 0xB1,
-    0x0D, 0x03, 0x00, 0x3D, 0x12, 0xAE, 0xF4, 0xA6, 0x2A, 0xE5, 0xB6, 0x03, 0x73, 0x77, 0x37, 0x74,
-    0xBB, 0x6E, 0xCF, 0xF8, 0xBC, 0xCE, 0x39, 0x0F, 0x51, 0xBB, 0x4A, 0x07, 0xA5, 0x84, 0xDC, 0xED,
-    0x1A, 0xFE, 0x28, 0x51, 0xD7, 0x46, 0xCC, 0x88, 0x51, 0xCB, 0x80, 0x59, 0x52, 0xD3, 0x7B, 0x0A,
-    0x40, 0x2A, 0xCC, 0x70, 0x33, 0x7D, 0xC2, 0x6D, 0xAF, 0xEA, 0x74, 0xEB, 0xAF, 0x7C, 0x0B, 0xDA,
-    0x5A, 0x50, 0x22, 0x60, 0x5D, 0x03, 0xBB, 0xEF, 0xB1, 0x22, 0xBD, 0xB2, 0x16, 0x3B, 0x1D, 0x98,
-    0x54, 0x31, 0xEE, 0xA2, 0xD5, 0xEC, 0x19, 0x50, 0x08, 0x61, 0x2A, 0x9E, 0xF7, 0xC1, 0x95, 0x83,
-    0x06, 0x92, 0x38, 0x04, 0xBD, 0x8D, 0x4A, 0x67, 0xA5, 0x3A, 0x11, 0x15, 0x97, 0x2D, 0x81, 0x0C,
-    0xB4, 0xEE, 0x48, 0xCB, 0x81, 0xF4, 0xE7, 0x23, 0xE9, 0xAB, 0x8E, 0xF4, 0x65, 0xD5, 0xF9, 0x29,
-    0x78, 0xD2, 0xD0, 0xBC, 0x6B, 0x40, 0x2B, 0x98, 0x10, 0x50, 0x48, 0x02, 0x9A, 0x8E, 0xA4, 0x89,
-    0x23, 0x8D, 0x5C, 0x0D, 0x1A, 0x70, 0x75, 0x30, 0x19, 0x45, 0x5A, 0x2A, 0xCD, 0x95, 0xA6, 0x4A,
-    0xE1, 0x8C, 0x03, 0x8F, 0x0A, 0x35, 0x7F, 0x8A, 0x00, 0x0A, 0xBE, 0x0A, 0x4D, 0x4B, 0x76, 0x50,
-    0x18, 0xA5, 0x1C, 0xF8, 0x01, 0xDF, 0x2B, 0xB5, 0x4C, 0x83, 0xCF, 0x13, 0x7A, 0xB3, 0x81, 0x58,
-    0xED, 0x4A, 0xEC, 0xDA, 0x14, 0xB2, 0xB8, 0x8E, 0xF8, 0x6A, 0x06, 0x35, 0xBF, 0x23, 0x41, 0x3C,
-    0x1B, 0x89, 0xE7, 0xE9, 0xB4, 0xD0, 0x6E, 0x83, 0x6E, 0x3E, 0x67, 0x02, 0x6A, 0xF4, 0x5F, 0xF9,
-    0x16, 0x88, 0xF8, 0x75, 0x8F, 0x66, 0x11, 0x40, 0xAA, 0x51, 0xB2, 0x6A, 0xAA, 0x0A, 0xA2, 0xFE,
-    0xA8, 0xF6, 0x6A, 0x77, 0x3F, 0xFF, 0xF4, 0xD4, 0x27, 0xCA, 0xAD, 0x22, 0xB9, 0x4E, 0x53, 0x4D,
-    0xF6, 0x31, 0x3B, 0x40, 0xC4, 0x69, 0xE4, 0xA1, 0x90, 0xE2, 0xA9, 0x73, 0x3A, 0x0A, 0xDE, 0x2D,
-    0xD1, 0x7C, 0xEE, 0xAC, 0x39, 0xA0, 0x81, 0xFE, 0x7A, 0xD6, 0x6C, 0x86, 0x37, 0x0F, 0xF2, 0x58,
-    0xF8, 0x94, 0x40, 0xF1, 0x29, 0xCD, 0xEC, 0x8D, 0x51, 0xFD, 0x19, 0x36, 0xFB, 0x67, 0xC2, 0x7F,
-    0x26, 0xCF, 0x15, 0x0F, 0x8F, 0x14, 0x51, 0x9F, 0x36, 0x74, 0x05, 0xA9, 0x7F, 0x4F, 0xE3, 0x5E,
-    0x31, 0xBD, 0x08, 0xE4, 0x21, 0x91, 0xE2, 0x71, 0x09, 0x60, 0x6F, 0xE3, 0x8E, 0xBE, 0x6A, 0xDE,
-    0x97, 0x6D, 0x32, 0xBB, 0x4A, 0x63, 0x29, 0xFA, 0xEA, 0x58, 0x2F, 0xF4, 0x7C, 0xE1, 0x78, 0x16,
-    0x19, 0x7C, 0x5C, 0x78, 0xB5, 0x5D, 0x59, 0x25, 0xC3, 0x73, 0x12, 0xB6, 0x40, 0xF5, 0x8D, 0x81,
-    0x8A, 0x54, 0xC2, 0xDF, 0x36, 0xEA, 0x93, 0x5A, 0xEF, 0x3A, 0x1E, 0x92, 0x30, 0x52, 0x09, 0x53,
-    0x47, 0x09, 0x73, 0x47, 0x09, 0xCD, 0xEF, 0x29, 0xA1, 0xA3, 0x24, 0xE1, 0x48, 0xD9, 0xA2, 0x81,
-    0x34, 0xED, 0xF8, 0x24, 0xB7, 0xA4, 0xA6, 0xA2, 0x84, 0x8E, 0x12, 0xCE, 0x23, 0x25, 0x24, 0xDE,
-    0x43, 0xC2, 0xEE, 0x96, 0x12, 0xB2, 0xC7, 0x51, 0xA2, 0x1B, 0x94, 0x30, 0xE8, 0x36, 0xC6, 0xC9,
-    0x87, 0xB9, 0x3E, 0x62, 0x49, 0xE6, 0x65, 0xFE, 0x29, 0x20, 0x58, 0x1F, 0xC1, 0x1C, 0x1C, 0x2C,
-    0xF8, 0xF1, 0xB0, 0xFF, 0x6A, 0xDE, 0x7E, 0x2C, 0x8A, 0x68, 0x1B, 0xB2, 0x03, 0x84, 0xE8, 0x6E,
-    0x38, 0x6E, 0x1C, 0xE4, 0x6A, 0x49, 0xC9, 0xBF, 0xBA, 0xAE, 0xA2, 0x62, 0x41, 0x9F, 0xBA, 0xDA,
-    0xFD, 0x5E, 0x40, 0xA8, 0x60, 0xAC, 0x5E, 0xB2, 0xF7, 0x62, 0x35, 0x3D, 0x81, 0xAA, 0x7C, 0x7C,
-    0x78, 0xF5, 0x3F, 0xB0, 0x52, 0xEC, 0xF9, 0x60, 0xA4, 0x55, 0x77, 0x84, 0x4C, 0x67, 0xDF, 0x4E,
-    0x3A, 0x14, 0x14, 0x63, 0x66, 0x3E, 0xE9, 0x61, 0x90, 0x62, 0xC9, 0x31, 0x5E, 0x5A, 0x73, 0xEE,
-    0xA9, 0xB1, 0x4C, 0x7A, 0x1E, 0x3B, 0xE0, 0xF4, 0x3C, 0xC0, 0x52, 0x04, 0xCB, 0x60, 0xE8, 0xBC,
-    0xD2, 0xE7, 0xB9, 0xDA, 0xF8, 0x5A, 0x03, 0xC8, 0xE9, 0x70, 0xF8, 0x4E, 0x29, 0xE0, 0x53, 0x30,
-    0x3C, 0x42, 0x2F, 0x98, 0x88, 0xF0, 0x05, 0x10, 0xB5, 0x72, 0x73, 0x86, 0x7E, 0x0F, 0xB7, 0x2A,
-    0x51, 0x81, 0xCE, 0x82, 0xFB, 0x9C, 0x7D, 0xD5, 0xFF, 0x50, 0x9D, 0x7C, 0x4B, 0x5B, 0xEB, 0xFB,
-    0x4D, 0x35, 0x9C, 0x8E, 0x35, 0x1C, 0xF4, 0x73, 0x20, 0xF0, 0x5E, 0xE3, 0xFD, 0x50, 0xFD, 0xEB,
-    0x30, 0x71, 0x73, 0xA1, 0x6E, 0xBD, 0xA8, 0xE8, 0xEA, 0x97, 0x21, 0xB4, 0x76, 0xA2, 0x8E, 0x1F,
-    0x49, 0xC1, 0x5D, 0x83, 0x62, 0xF9, 0x4B, 0x9F, 0xF1, 0x2D, 0xF3, 0xB3, 0xAB, 0x2F, 0xDA, 0xA5,
-    0x95, 0x46, 0x6E, 0xDD, 0x87, 0x04, 0xDB, 0x8B, 0xD3, 0xEE, 0x83, 0xF2, 0x42, 0x61, 0xAF, 0x81,
-    0x83, 0xF7, 0x11, 0x04, 0x03, 0x68, 0xD6, 0x4C, 0x53, 0xD3, 0x5D, 0x62, 0xCE, 0x58, 0x29, 0xB3,
-    0xD7, 0x4D, 0xC4, 0x5D, 0xD9, 0x86, 0x9B, 0x84, 0x75, 0x63, 0x34, 0x3F, 0xE0, 0xF7, 0x7C, 0x6B,
-    0xEE, 0xFE, 0x36, 0xA5, 0x3E, 0xCF, 0x09, 0x9F, 0x4D, 0xC2, 0xED, 0xD8, 0x86, 0xD8, 0x5B, 0x33,
-    0xFB, 0x4A, 0x1A, 0x2B, 0x05, 0xD3, 0x4A, 0xF1, 0xF7, 0xF5, 0x5F, 0x90, 0x52, 0x3E, 0xD2, 0x91,
-    0xED, 0x28, 0xC7, 0xCC, 0x6C, 0xCA, 0x1E, 0x31, 0x9E, 0xE9, 0x03, 0x8E, 0xCF, 0xCA, 0xDB, 0xD1,
-    0x51, 0xCD, 0x56, 0xEB, 0xEB, 0xF8, 0x9B, 0x54, 0x3E, 0x18, 0x4E, 0x56, 0x73, 0x44, 0xC2, 0x6F,
-    0x12, 0xBF, 0x4D, 0x5C, 0x88, 0x0F, 0xEA, 0x11, 0xE1, 0x07, 0x74, 0x58, 0x99, 0xA6, 0xA8, 0x8C,
-    0xBB, 0x8A, 0xD1, 0xEF, 0xF1, 0x82, 0xF1, 0x4B, 0x55, 0x37, 0x21, 0xFF, 0x8A, 0xF1, 0xEC, 0xFA,
-    0x0E, 0xDF, 0xA2, 0x4A, 0xE6, 0xC6, 0xB2, 0x02, 0x30, 0x9B, 0x4A, 0x7E, 0xAA, 0x9D, 0x3C, 0x76,
-    0x7E, 0x05, 0xBC, 0xCA, 0x8C, 0x26, 0x10, 0x38, 0x0F, 0xF6, 0x43, 0x92, 0xA3, 0x60, 0x63, 0xEB,
-    0xBC, 0x4E, 0x40, 0xCE, 0x45, 0x9D, 0x37, 0x17, 0xB1, 0x5C, 0x26, 0xC4, 0x5F, 0x71, 0xB7, 0x9E,
-    0xE3, 0x47, 0xA2, 0x0D, 0x0F, 0xD9, 0x06, 0xAD, 0xCD, 0x97, 0xD8, 0x07, 0x38, 0xF8, 0x7B, 0xDD,
-    0x4B, 0x6C, 0x93, 0xDD, 0x23, 0x66, 0x23, 0x18, 0x23, 0x80, 0xC5, 0x9C, 0x8C, 0x9E, 0x04, 0x13,
-    0x93, 0x1C, 0x27, 0xD6, 0x26, 0xFD, 0x48, 0x06, 0x65, 0x58, 0x0F, 0xCA, 0x0E, 0xD3, 0x9D, 0xC9,
-    0x8A, 0x98, 0x8B, 0x0A, 0x53, 0x07, 0x6C, 0xDA, 0x51, 0x30, 0x74, 0xFC, 0x9C, 0x1C, 0xFF, 0x9D,
-    0x3A, 0x48, 0x0D, 0xD7, 0x34, 0x9A, 0xF9, 0xCE, 0x69, 0x2E, 0xC4, 0x69, 0x5C, 0x17, 0x5E, 0xE1,
-    0x26, 0x96, 0xCF, 0x03, 0x5A, 0xEE, 0x96, 0x10, 0xEB, 0x34, 0x0C, 0x7A, 0x42, 0x4B, 0xF6, 0xAD,
-    0x87, 0x18, 0x9C, 0x2F, 0x8D, 0xBB, 0xA0, 0x65, 0xD9, 0x2B, 0x8B, 0x40, 0x04, 0xBF, 0xC7, 0x5A,
-    0xB7, 0x7E, 0xC7, 0x80, 0xDC, 0xB4, 0xF2, 0x88, 0x90, 0xA1, 0xF9, 0x35, 0x3D, 0x01, 0x71, 0x99,
-    0xC2, 0x01, 0x4B, 0x22, 0x2F, 0x24, 0x22, 0x3C, 0x06, 0x91, 0x27, 0x97, 0x35, 0x1D, 0xFC, 0x8A,
-    0x1B, 0xD1, 0x03, 0xF8, 0x1B, 0x13, 0x3D, 0x3F, 0xB2, 0xD7, 0x61, 0x65, 0x9D, 0xD0, 0xAD, 0x8A,
-    0xCE, 0x2F, 0xB0, 0x72, 0xF3, 0xCC, 0x48, 0xE7, 0x33, 0x65, 0xF9, 0x24, 0xCF, 0xA4, 0xEE, 0x1A,
-    0xBF, 0x19, 0xF9, 0xAD, 0x1E, 0x94, 0xE0, 0x39, 0x00, 0xEE, 0xF5, 0x6A, 0xA2, 0x8B, 0x7B, 0x37,
-    0xDC, 0x0E, 0xE2, 0xE6, 0x93, 0xF3, 0xAE, 0xC5, 0x5D, 0xE0, 0x47, 0xF0, 0x07, 0x56, 0x61, 0x5B,
-    0x6C, 0x34, 0x51, 0xD1, 0x67, 0xE0, 0x53, 0xCE, 0x0C, 0x89, 0x61, 0x8C, 0x4A, 0xD2, 0x94, 0x84,
-    0xC6, 0x0D, 0x72, 0x30, 0x8B, 0x07, 0x01, 0x02, 0x68, 0xEC, 0xC3, 0xBA, 0x50, 0x20, 0x0D, 0x16,
-    0x47, 0x75, 0x5A, 0x59, 0xA8, 0x3B, 0xE3, 0xC7, 0x51, 0xB0, 0x71, 0x17, 0xF8, 0x71, 0x24, 0xDA,
-    0xB8, 0xF3, 0xC2, 0x3D, 0x02, 0x36, 0x9E, 0x3D, 0xC7, 0x39, 0xC1, 0x89, 0x03, 0x5D, 0xE4, 0x2D,
-    0x95, 0xE0, 0xBD, 0x53, 0xAE, 0x82, 0x7B, 0xBE, 0x0E, 0x6D, 0xD4, 0xD7, 0x1B, 0xBE, 0xC6, 0x7D,
-    0x5C, 0x3E, 0x7F, 0xD9, 0xFB, 0xFC, 0xE5, 0x0D, 0xE6, 0x2F, 0x4B, 0x5B, 0x4A, 0xDA, 0x6C, 0xBA,
-    0x30, 0xFF, 0x97, 0x9B, 0x3B, 0xDE, 0x93, 0xF3, 0x07, 0x73, 0x5E, 0xDA, 0x3F, 0x98, 0x73, 0x9F,
-    0x3A, 0x50, 0x6F, 0x31, 0xAD, 0xDE, 0x81, 0xEA, 0x6F, 0xCC, 0x8B, 0xAB, 0x14, 0xD2, 0x3B, 0x4A,
-    0x7C, 0x7E, 0x1F, 0xF3, 0x3F, 0xFB, 0x00, 0x2F, 0x1E, 0xF5, 0x48, 0x02, 0xBD, 0xEF, 0x20, 0xF2,
-    0x67, 0xB8, 0xD3, 0x72, 0x88, 0xBB, 0x0C, 0x50, 0xC3, 0x73, 0x64, 0x9A, 0x7D, 0xD7, 0x6D, 0x03,
-    0x73, 0x98, 0xF0, 0x45, 0xCB, 0x2A, 0x4D, 0xE6, 0x5E, 0x67, 0x52, 0xD2, 0xC7, 0xA0, 0x8C, 0x1B,
-    0xD5, 0x6B, 0x38, 0xB3, 0xD6, 0x50, 0xF5, 0x22, 0xD3, 0x7A, 0x93, 0xB7, 0x4F, 0xC9, 0x97, 0xD0,
-    0x66, 0x52, 0x3D, 0xBD, 0xDE, 0x0A, 0x7C, 0xAA, 0x90, 0xFA, 0xD7, 0x40, 0xA6, 0xFA, 0x0B, 0xE7,
-    0x64, 0x39, 0xCF, 0xF1, 0x91, 0xB3, 0xF5, 0x00, 0x3F, 0x0E, 0x7E, 0x0C, 0x8F, 0x49, 0xF8, 0x03,
-    0x13, 0xF7, 0x74, 0xCE, 0x62, 0x21, 0x3E, 0x50, 0xD3, 0xCC, 0xBE, 0x6E, 0x44, 0x7A, 0x71, 0x35,
-    0x48, 0x5B, 0xC7, 0x68, 0xC1, 0x9B, 0xFB, 0x33, 0x7C, 0xD2, 0x19, 0x5E, 0xA4, 0x94, 0x08, 0x93,
-    0xD6, 0x35, 0x66, 0x39, 0x1C, 0xB4, 0x92, 0xBC, 0x5D, 0x93, 0xD5, 0x51, 0x32, 0xEE, 0xAC, 0xD4,
-    0xAD, 0x56, 0x4E, 0xA1, 0x35, 0x1E, 0xC7, 0x62, 0x36, 0xCF, 0x2B, 0xA2, 0x5D, 0x29, 0x42, 0x77,
-    0x76, 0xD5, 0x21, 0xD6, 0x05, 0xC1, 0xED, 0x9D, 0x70, 0x5E, 0x1D, 0x8F, 0x39, 0x32, 0x36, 0x42,
-    0xE5, 0x82, 0x98, 0xA7, 0xCF, 0xEA, 0xCB, 0x0C, 0xC7, 0x01, 0x7F, 0xD1, 0xB0, 0x7F, 0xB4, 0xE2,
-    0x28, 0xB4, 0xE1, 0x23, 0x98, 0x0C, 0x1E, 0xF1, 0x5C, 0xB3, 0xA3, 0x59, 0xA2, 0xAE, 0x06, 0x00,
-    0x35, 0xF1, 0xEE, 0x51, 0xB3, 0xF1, 0x59, 0xC8, 0x6D, 0xA6, 0x68, 0xF4, 0x8A, 0x90, 0x99, 0xFB,
-    0x38, 0xFB, 0x87, 0xE2, 0x8E, 0x64, 0x50, 0x34, 0x70, 0x1D, 0x56, 0x89, 0x50, 0xFD, 0x2B, 0x5A,
-    0x59, 0xA3, 0xDB, 0x9C, 0x38, 0x23, 0x6B, 0xBB, 0xAB, 0x23, 0x51, 0xFA, 0x85, 0x12, 0xBF, 0xB1,
-    0x54, 0xEC, 0x73, 0xFF, 0x13, 0x72, 0xEF, 0xF3, 0x18, 0xBA, 0x33, 0x08, 0x24, 0xC0, 0xDA, 0x32,
-    0x43, 0x4C, 0xEE, 0x53, 0xD7, 0x82, 0x7F, 0x07, 0x9E, 0x4B, 0x2C, 0xF1, 0x76, 0x06, 0xE3, 0xFF,
-    0x1C, 0x41, 0xFE, 0xCD, 0xD3, 0xA6, 0xF0, 0x62, 0x40, 0x2C, 0xB8, 0x77, 0x01, 0xB9, 0xBF, 0xB8,
-    0x70, 0xAF, 0x07, 0x24, 0x52, 0x06, 0x27, 0xA1, 0x5D, 0x2B, 0x51, 0x8D, 0x7B, 0xBD, 0x36, 0xEE,
-    0xF1, 0xBC, 0x4E, 0x22, 0x1C, 0x08, 0xBE, 0x19, 0xB6, 0xD8, 0xFB, 0x25, 0x70, 0x76, 0x2C, 0x73,
-    0x34, 0xB6, 0x74, 0x35, 0x44, 0xD0, 0x5D, 0x4E, 0x37, 0x1B, 0x1E, 0xD8, 0x32, 0x56, 0x8E, 0x1F,
-    0x0A, 0x0E, 0x08, 0xA9, 0xC1, 0xBE, 0x71, 0x3F, 0x90, 0x8F, 0xF9, 0xB1, 0xD9, 0x58, 0x8C, 0xBB,
-    0xCE, 0x1C, 0x1A, 0xF7, 0x9D, 0x16, 0x5C, 0x60, 0x7C, 0x92, 0x76, 0x73, 0xE7, 0xED, 0xC7, 0xD7,
-    0x86, 0x1A, 0xF7, 0x98, 0x9E, 0x05, 0x4C, 0xA1, 0x92, 0x70, 0x3C, 0x68, 0xDC, 0x8F, 0x84, 0x0D,
-    0x0F, 0x7D, 0xF3, 0x1A, 0xFA, 0x1A, 0x8E, 0x8C, 0x9E, 0xDC, 0x39, 0x94, 0x0A, 0xC8, 0x46, 0x2C,
-    0x9C, 0xBC, 0xD7, 0x85, 0xC3, 0xF3, 0x57, 0x6D, 0xCA, 0x18, 0x94, 0x87, 0x74, 0x6D, 0x3C, 0x07,
-    0xDC, 0x63, 0xF0, 0x27, 0x75, 0xE9, 0x28, 0x7C, 0x00, 0x4D, 0xD6, 0x7F, 0xE1, 0xB6, 0x86, 0x3F,
-    0xAE, 0x4B, 0xB7, 0x94, 0xA6, 0x2D, 0xF5, 0x46, 0xCE, 0x8A, 0x1E, 0xBC, 0xF1, 0x89, 0x08, 0xF5,
-    0x35, 0x75, 0x4E, 0xEA, 0x02, 0x2B, 0xB9, 0x13, 0xEA, 0xCD, 0x20, 0xB7, 0xD7, 0x59, 0x43, 0x73,
-    0x5F, 0x27, 0x0B, 0xB9, 0xF3, 0x81, 0xBB, 0x27, 0x61, 0xAD, 0xBE, 0x62, 0xB6, 0xF0, 0x32, 0x43,
-    0x69, 0x2E, 0x88, 0x7A, 0xBE, 0x88, 0x75, 0xC9, 0xA3, 0x83, 0x34, 0x54, 0xD6, 0x9F, 0xEC, 0x3B,
-    0x64, 0xAD, 0x5A, 0x4F, 0xBC, 0x2D, 0x83, 0x69, 0x8B, 0x78, 0x46, 0x09, 0x4B, 0xD2, 0x37, 0x70,
-    0x99, 0xB1, 0xF6, 0x5F, 0x1D, 0x2B, 0x9D, 0xBC, 0xBB, 0x23, 0x7F, 0xFE, 0x30, 0x90, 0x47, 0xAE,
-    0x69, 0x41, 0x2E, 0x17, 0x2A, 0x72, 0x9D, 0x78, 0xA0, 0x74, 0xFA, 0x3F, 0xD5, 0x5C, 0xBF, 0x8F,
-    0xDD, 0xD8, 0x75, 0xBE, 0xE4, 0xCB, 0x0C, 0x01, 0xB1, 0xE0, 0x16, 0x9E, 0x18, 0x2B, 0x01, 0x66,
-    0x9B, 0x6C, 0x0A, 0xFE, 0x05, 0x36, 0xE9, 0x0D, 0x10, 0x17, 0x2E, 0x76, 0x0A, 0x3D, 0x6F, 0x91,
-    0xC2, 0x2E, 0x6C, 0xC0, 0xAB, 0x66, 0xEA, 0x00, 0x89, 0xC8, 0xC4, 0x45, 0x8A, 0x34, 0x53, 0x64,
-    0xAB, 0x14, 0x51, 0x00, 0x19, 0xD0, 0x8E, 0x0A, 0x35, 0x69, 0x12, 0x18, 0x22, 0x15, 0x97, 0x2E,
-    0x96, 0x9B, 0xC5, 0xC2, 0x45, 0x8A, 0x65, 0xB4, 0x0B, 0x38, 0x58, 0x15, 0xC3, 0x00, 0xDC, 0x98,
-    0x23, 0x93, 0x3C, 0x39, 0xDF, 0x77, 0x49, 0xBE, 0xF7, 0x46, 0x1A, 0x69, 0x46, 0x3B, 0x33, 0x1A,
-    0x8D, 0x1E, 0x0F, 0xDF, 0xE3, 0x8F, 0x7B, 0xCF, 0xFD, 0xEE, 0x8F, 0xF3, 0xF3, 0xCA, 0x6C, 0x2D,
-    0x97, 0x89, 0x31, 0x81, 0x48, 0xB1, 0x49, 0x37, 0xFE, 0xF2, 0x16, 0x54, 0x3A, 0x25, 0x8E, 0xF4,
-    0x4A, 0x17, 0x22, 0xA0, 0x03, 0xA8, 0xDF, 0x49, 0xA6, 0x6F, 0x75, 0x7C, 0xB7, 0xCD, 0x95, 0x46,
-    0x4D, 0x5C, 0x19, 0x13, 0xD7, 0x71, 0x6D, 0x4C, 0x5A, 0x45, 0x8D, 0x16, 0x50, 0x86, 0x5A, 0x84,
-    0x14, 0x41, 0xA7, 0x05, 0x64, 0x7E, 0x6F, 0x5C, 0x11, 0x19, 0x50, 0x8C, 0x16, 0xE4, 0x81, 0x26,
-    0x3E, 0x68, 0x11, 0x0C, 0xCB, 0x1F, 0x49, 0x11, 0x6A, 0x4D, 0x52, 0xC6, 0xFA, 0x4A, 0x5E, 0xC7,
-    0xFA, 0x7A, 0x5A, 0xA7, 0x5A, 0x54, 0xDC, 0x8A, 0x16, 0x1B, 0x75, 0xCE, 0x72, 0x79, 0x13, 0x05,
-    0xB4, 0x96, 0x38, 0x22, 0xCD, 0xC8, 0xE7, 0xD6, 0xCF, 0xC0, 0xA0, 0xD4, 0x46, 0x0B, 0xEB, 0x58,
-    0xBA, 0x71, 0xBF, 0xF6, 0x45, 0x1B, 0xE8, 0x82, 0x38, 0x60, 0xF4, 0x47, 0x92, 0x39, 0xB9, 0x28,
-    0x13, 0x7A, 0x37, 0x8B, 0xE5, 0x89, 0x64, 0x69, 0xA3, 0x37, 0xF2, 0x0A, 0xA4, 0x74, 0xF1, 0xCD,
-    0xD3, 0x6B, 0x47, 0x7B, 0xB8, 0xAB, 0x8F, 0x84, 0xD2, 0xA5, 0x99, 0x27, 0x55, 0x9C, 0x99, 0x6F,
-    0xA1, 0x8E, 0xEB, 0xC6, 0xB9, 0x63, 0x4C, 0x98, 0x79, 0xCA, 0x51, 0xF0, 0x34, 0x57, 0x8E, 0x3C,
-    0x02, 0xE6, 0x10, 0x12, 0x73, 0xE3, 0x4B, 0x73, 0xA5, 0xC1, 0x73, 0xEF, 0x98, 0x3F, 0x35, 0x8B,
-    0xDA, 0x3C, 0xD4, 0x52, 0x1E, 0xE0, 0x49, 0x80, 0x17, 0x4B, 0x69, 0xCC, 0xF6, 0x91, 0xB9, 0x44,
-    0x18, 0xAF, 0x18, 0x2C, 0xE0, 0x25, 0x28, 0x41, 0xE3, 0x04, 0x34, 0x25, 0x8F, 0x03, 0xA9, 0xDC,
-    0x5C, 0xF1, 0x1B, 0x93, 0x6E, 0xDF, 0xBD, 0x78, 0x8C, 0x1E, 0x6A, 0x3D, 0x2E, 0x6A, 0xD3, 0xCE,
-    0x52, 0x40, 0x48, 0xBE, 0x4E, 0x30, 0xDA, 0x0A, 0x60, 0x85, 0x29, 0x7A, 0x0B, 0xAC, 0xDE, 0xBA,
-    0x03, 0x16, 0x4B, 0x5C, 0xC3, 0x44, 0x46, 0x4B, 0xA2, 0x6A, 0x6E, 0xC7, 0xF4, 0xA7, 0x7C, 0xEC,
-    0x63, 0x66, 0x77, 0x26, 0x55, 0xA2, 0x8C, 0x4B, 0xBB, 0x90, 0x66, 0xBB, 0x06, 0xC7, 0x6F, 0x05,
-    0x68, 0x27, 0x31, 0x60, 0xF3, 0x80, 0x8E, 0x01, 0xCE, 0xCF, 0x90, 0x66, 0x7A, 0x84, 0x0F, 0x87,
-    0xE8, 0xB5, 0x80, 0xDD, 0x25, 0x95, 0xF3, 0xAF, 0xC0, 0xA0, 0x31, 0x24, 0x11, 0xC8, 0xB6, 0x80,
-    0xAB, 0xAD, 0x5D, 0xBD, 0x7F, 0xED, 0x9E, 0x7D, 0x4F, 0x67, 0x0B, 0xD0, 0xF1, 0xF4, 0xED, 0xA0,
-    0x1A, 0x19, 0xFB, 0xC0, 0x98, 0x3D, 0x69, 0xB5, 0xEF, 0x3A, 0x85, 0xA9, 0x0D, 0xE4, 0xA0, 0xD6,
-    0xC2, 0xDF, 0x42, 0x55, 0xEC, 0x6A, 0x76, 0xF7, 0x78, 0xD4, 0xF6, 0x1A, 0xEE, 0x45, 0xBD, 0xF9,
-    0x93, 0x40, 0x0E, 0xF1, 0x4E, 0x87, 0x77, 0xB5, 0x4A, 0x7D, 0x02, 0x1D, 0xF5, 0x0E, 0xF1, 0x68,
-    0xD1, 0x0F, 0xCA, 0x9F, 0xDF, 0x6B, 0x7D, 0x61, 0x15, 0x97, 0x8A, 0x07, 0x31, 0xBC, 0x12, 0x80,
-    0x00, 0x8F, 0x48, 0x9F, 0x4B, 0x75, 0x80, 0x48, 0x5A, 0x2D, 0x3A, 0xBF, 0xF5, 0x2B, 0xA7, 0xBB,
-    0x18, 0x40, 0xB6, 0x38, 0x6E, 0x01, 0x37, 0x9E, 0xB7, 0x84, 0x3F, 0xB7, 0xAF, 0xD0, 0x08, 0xD9,
-    0xC5, 0x9C, 0xD7, 0x67, 0x7B, 0x7B, 0xE0, 0xBB, 0xB3, 0x7F, 0x31, 0x23, 0xE4, 0x1D, 0xE3, 0xDC,
-    0xD5, 0x29, 0x12, 0x34, 0xBA, 0xB2, 0xA4, 0x25, 0xA6, 0xAE, 0xE2, 0x20, 0x68, 0x60, 0xDA, 0x5E,
-    0x15, 0x40, 0xAE, 0xED, 0x9B, 0x5B, 0xC6, 0x6B, 0xDD, 0x41, 0x47, 0x71, 0x80, 0x89, 0x03, 0xDE,
-    0x63, 0x2B, 0x9D, 0x67, 0xFE, 0x14, 0x17, 0x00, 0x63, 0xD8, 0x3A, 0x40, 0x63, 0x80, 0x0D, 0x2A,
-    0x7A, 0x6B, 0x8D, 0x21, 0xDB, 0xE9, 0xD5, 0x4C, 0x36, 0x59, 0x03, 0x4A, 0x06, 0x30, 0xD9, 0x75,
-    0x8C, 0x45, 0x59, 0xA4, 0x00, 0x95, 0x73, 0x0F, 0x9C, 0x18, 0x49, 0x52, 0xAD, 0x39, 0x7E, 0x2C,
-    0x64, 0x1E, 0xED, 0xF0, 0x28, 0x72, 0x5D, 0xA9, 0x36, 0x45, 0x5D, 0x2C, 0x4F, 0x13, 0x50, 0xCC,
-    0x3C, 0xAE, 0x68, 0xA4, 0xB5, 0x89, 0xBF, 0xFE, 0x4B, 0xE5, 0x4E, 0x6B, 0x4D, 0x3B, 0x50, 0x05,
-    0x2F, 0xC6, 0xC2, 0x09, 0xAA, 0xAB, 0xD6, 0x1A, 0xCD, 0x4E, 0xA0, 0xF6, 0xEE, 0xEA, 0xAD, 0x70,
-    0x98, 0x4B, 0xFB, 0xB6, 0xB2, 0x82, 0x5A, 0xAA, 0x55, 0x8D, 0x2D, 0x6A, 0x1F, 0xEC, 0xE8, 0xDE,
-    0x49, 0xA0, 0xDF, 0x68, 0xDB, 0xB1, 0x20, 0xE3, 0xC4, 0xD5, 0xFD, 0xBF, 0xB9, 0xB2, 0xA7, 0x8F,
-    0x39, 0xE5, 0xD2, 0x2F, 0xA8, 0x3F, 0x10, 0x9E, 0xED, 0x5D, 0x9E, 0x74, 0x21, 0xAE, 0x28, 0x91,
-    0x70, 0x0A, 0x58, 0xBA, 0x09, 0xE5, 0x3E, 0x7B, 0x41, 0x87, 0x42, 0x45, 0xF4, 0x72, 0x3B, 0xE2,
-    0xC6, 0x81, 0x17, 0xDB, 0x31, 0xB8, 0x7E, 0xAA, 0xA7, 0x53, 0xBA, 0x7A, 0x61, 0x7C, 0x3D, 0x94,
-    0x43, 0x59, 0x15, 0xAD, 0x15, 0x71, 0x46, 0xE6, 0x6D, 0x58, 0x4D, 0x33, 0x16, 0x17, 0xEF, 0x92,
-    0xEA, 0x30, 0x04, 0x6D, 0x49, 0x21, 0xE0, 0x96, 0xB9, 0x64, 0x0B, 0xC8, 0xB8, 0x42, 0xA9, 0x16,
-    0xA7, 0x54, 0x85, 0x1A, 0x68, 0xDC, 0x58, 0xAA, 0x23, 0x36, 0x89, 0xDB, 0x67, 0xE9, 0xB7, 0x65,
-    0x39, 0x3D, 0x53, 0xCF, 0x6F, 0xD9, 0x12, 0x58, 0x9A, 0x93, 0x4A, 0xB2, 0x98, 0xC5, 0xA8, 0xAD,
-    0x31, 0x03, 0xFD, 0x72, 0x04, 0x73, 0x06, 0x8A, 0xD4, 0x39, 0x90, 0xA7, 0x86, 0x72, 0x77, 0xA2,
-    0xCE, 0x41, 0xFE, 0x74, 0xBA, 0xBB, 0x45, 0x2C, 0x09, 0xA5, 0x47, 0x24, 0x6D, 0x6B, 0x23, 0xE2,
-    0x68, 0x71, 0xD0, 0x99, 0xA1, 0xA0, 0x58, 0x84, 0x2C, 0x5C, 0x1B, 0xB4, 0x01, 0xB5, 0xCF, 0xC4,
-    0xBD, 0xE1, 0xBB, 0x80, 0xCD, 0x96, 0xB3, 0x90, 0x01, 0xA0, 0xE5, 0x0D, 0xC4, 0x1D, 0x21, 0xDB,
-    0x51, 0x5D, 0x56, 0xE7, 0x51, 0x16, 0x51, 0x96, 0xCA, 0xBC, 0xBC, 0xE1, 0xF1, 0x8D, 0xE3, 0xB3,
-    0x65, 0x82, 0xB9, 0xB4, 0x71, 0xE0, 0x9A, 0x2A, 0x0B, 0xF3, 0xF1, 0xD5, 0x41, 0xF6, 0xCC, 0x33,
-    0xD3, 0x71, 0xAC, 0xBC, 0x93, 0x15, 0x52, 0xE7, 0x97, 0xC0, 0x42, 0xAA, 0x79, 0x8E, 0x8A, 0x0E,
-    0x7E, 0x1D, 0xCE, 0x51, 0xAB, 0x05, 0x61, 0x04, 0x93, 0x94, 0xDA, 0x39, 0xB2, 0x4E, 0x8E, 0xCD,
-    0x51, 0x55, 0x70, 0xB4, 0xCD, 0x1F, 0xE6, 0x09, 0xB4, 0x9A, 0x04, 0x2B, 0x51, 0xA2, 0x48, 0x60,
-    0x29, 0xD9, 0xC1, 0x72, 0xE6, 0xEE, 0xC7, 0xC6, 0x2F, 0xA3, 0xA7, 0xAA, 0xE9, 0x08, 0xBA, 0x4F,
-    0x6F, 0xEC, 0xED, 0x9B, 0xCB, 0x6A, 0xFC, 0x69, 0x14, 0xCA, 0x4B, 0x80, 0x81, 0x23, 0x40, 0xC5,
-    0x3C, 0x27, 0x59, 0x0E, 0x99, 0x50, 0x4E, 0x13, 0xE9, 0x52, 0x60, 0xA0, 0x08, 0x33, 0x1E, 0xB8,
-    0xF1, 0x87, 0x89, 0xF0, 0x27, 0x6F, 0x5C, 0x16, 0x0C, 0x17, 0xDF, 0x4C, 0xE8, 0x95, 0x5A, 0x19,
-    0xB4, 0x95, 0x85, 0x2E, 0xB4, 0x8B, 0x7E, 0xD7, 0xCA, 0x01, 0x1C, 0xD7, 0xF7, 0x5F, 0xDA, 0xC6,
-    0xFC, 0x1B, 0xB4, 0x11, 0x90, 0xBE, 0x0F, 0x59, 0xEA, 0x63, 0x05, 0x0A, 0xA0, 0x02, 0x47, 0x33,
-    0x09, 0x65, 0x12, 0xAD, 0x2A, 0x35, 0x3F, 0x30, 0xEE, 0x9D, 0xB4, 0x88, 0xAA, 0xB0, 0x11, 0x55,
-    0xA8, 0x55, 0x35, 0x87, 0xD4, 0xCA, 0x9B, 0x4B, 0x1B, 0x0D, 0xDB, 0xFB, 0x3A, 0x2F, 0x17, 0xBD,
-    0xA3, 0xEC, 0xC8, 0x0F, 0x3B, 0x00, 0x52, 0x83, 0xC3, 0x02, 0x72, 0x3F, 0xB9, 0xC4, 0x49, 0x61,
-    0xAE, 0xDF, 0xA5, 0x5C, 0xEE, 0x6D, 0xA3, 0x61, 0x9D, 0x0C, 0x90, 0xE5, 0x7E, 0x1B, 0x82, 0xA1,
-    0xD2, 0x6D, 0x8F, 0x19, 0xAB, 0x7B, 0x58, 0xE9, 0xC9, 0x0B, 0xC5, 0x29, 0x5B, 0x06, 0x61, 0x70,
-    0xE4, 0xFC, 0x4A, 0x2F, 0x17, 0x13, 0xC4, 0x26, 0xA4, 0xE4, 0xB4, 0x76, 0x13, 0x19, 0x51, 0xAA,
-    0xCB, 0x20, 0xC5, 0x0A, 0xA4, 0xF5, 0x1A, 0x6D, 0x48, 0xB1, 0x2C, 0x26, 0xE0, 0x56, 0x12, 0x55,
-    0x82, 0x94, 0x06, 0x10, 0x3C, 0xCA, 0xB5, 0xDA, 0x41, 0x89, 0x4B, 0x6B, 0xCD, 0xC8, 0xC8, 0x3D,
-    0xA8, 0x5E, 0xC2, 0xF2, 0x41, 0xE5, 0xD0, 0xFD, 0x88, 0xF5, 0x66, 0xE3, 0xBA, 0x92, 0x7F, 0x5E,
-    0x6B, 0x33, 0xD4, 0x88, 0xF0, 0x1A, 0x5A, 0x49, 0xB4, 0xC8, 0xF0, 0x9C, 0xF4, 0x71, 0x45, 0x99,
-    0x4D, 0x01, 0x11, 0xCA, 0x3F, 0xA9, 0x29, 0xD5, 0xE9, 0xC0, 0xA4, 0xE8, 0xA5, 0x90, 0xA1, 0x5C,
-    0xA1, 0x78, 0xB6, 0xA4, 0x9E, 0x08, 0x1F, 0xA1, 0x4C, 0x0A, 0xE5, 0x81, 0xD8, 0x02, 0xAC, 0xF8,
-    0xCF, 0x5B, 0x25, 0x5B, 0x09, 0x85, 0x5E, 0x4E, 0xDD, 0xA0, 0xFC, 0x8E, 0xB2, 0x5D, 0x84, 0xD6,
-    0x62, 0x53, 0x8C, 0x42, 0xAE, 0xFC, 0xF9, 0xA0, 0xFC, 0x5D, 0xCB, 0x8C, 0xAA, 0xF6, 0x7E, 0x89,
-    0xD9, 0xE1, 0x0D, 0x0F, 0x1A, 0x8A, 0x45, 0x74, 0x56, 0x4E, 0xF5, 0xE3, 0xDA, 0xFF, 0x98, 0x37,
-    0x00, 0x6F, 0x5D, 0xD1, 0x55, 0xA8, 0x34, 0x6A, 0x03, 0x3B, 0x72, 0xBF, 0x07, 0xEF, 0x93, 0x4E,
-    0xE8, 0xFE, 0xBB, 0xB9, 0x5A, 0x78, 0x1B, 0x87, 0xB3, 0x29, 0x68, 0x57, 0x18, 0x59, 0x6A, 0xAF,
-    0x38, 0xFB, 0x6F, 0x02, 0xDE, 0x56, 0x42, 0x2C, 0x7A, 0xEA, 0xD5, 0x13, 0x59, 0x50, 0x43, 0xFD,
-    0xE9, 0x55, 0xC3, 0xFB, 0x2A, 0xA3, 0x68, 0xFF, 0x02, 0xDB, 0xFF, 0xAC, 0x2D, 0xA0, 0xC5, 0x1F,
-    0xD2, 0xAF, 0x43, 0x21, 0x61, 0x17, 0x45, 0x73, 0x9D, 0xAC, 0xD0, 0xAB, 0xC3, 0x85, 0xD1, 0x0A,
-    0x8D, 0xB1, 0x0F, 0xD6, 0xF0, 0xEE, 0x5E, 0x37, 0xDE, 0xEE, 0x01, 0x4D, 0xC5, 0x02, 0xC2, 0x03,
-    0xA6, 0xC4, 0xE7, 0x00, 0x48, 0xB9, 0x54, 0xC9, 0x9B, 0xAE, 0x8D, 0x6A, 0x7D, 0xC0, 0xEB, 0x95,
-    0xF8, 0xC3, 0x69, 0xC8, 0x67, 0xCB, 0x1F, 0x0F, 0x00, 0x71, 0x9D, 0x7C, 0x75, 0xF0, 0x60, 0x38,
-    0x75, 0x01, 0x33, 0x31, 0xB7, 0x38, 0xC1, 0xA8, 0xEE, 0x2E, 0x68, 0x18, 0x06, 0x4F, 0x85, 0x7A,
-    0x18, 0x84, 0x4C, 0x3A, 0x3B, 0x79, 0x66, 0xD3, 0x21, 0x2F, 0x4F, 0x43, 0xDF, 0xD6, 0x67, 0xF3,
-    0x4F, 0x61, 0xC6, 0xE5, 0x9F, 0x63, 0x74, 0xE5, 0xB4, 0x42, 0x72, 0xC5, 0xBF, 0x50, 0xF8, 0x1C,
-    0xD0, 0x1A, 0x2E, 0xAF, 0x91, 0x56, 0x78, 0x71, 0xA4, 0xAF, 0xF2, 0x81, 0x21, 0x14, 0x36, 0xB0,
-    0x2F, 0x4D, 0xD4, 0x4E, 0xA7, 0xFB, 0x72, 0x70, 0x90, 0x0F, 0xFB, 0xC2, 0xBF, 0x6A, 0x3C, 0x8D,
-    0x17, 0x37, 0x9F, 0x5C, 0xE0, 0xA2, 0x35, 0x95, 0xE4, 0xC4, 0xD3, 0xE6, 0x0B, 0xAF, 0x76, 0x72,
-    0xE0, 0xCD, 0xF1, 0x86, 0x89, 0x3C, 0x90, 0x03, 0x4E, 0x86, 0xCC, 0x92, 0xFB, 0xF8, 0x39, 0xDE,
-    0x75, 0xEE, 0xEA, 0x78, 0x88, 0x54, 0xF5, 0xE9, 0x55, 0xFA, 0x40, 0x31, 0x68, 0x3D, 0x39, 0xCA,
-    0x3B, 0x8C, 0xB2, 0x5E, 0x57, 0x97, 0x00, 0xC4, 0xEF, 0xF5, 0xE1, 0x33, 0x12, 0x9A, 0xA5, 0x83,
-    0xD3, 0x04, 0xF2, 0xA4, 0xD6, 0x09, 0x58, 0xC5, 0x3A, 0x34, 0xBF, 0x6B, 0xFE, 0x6A, 0xEE, 0x64,
-    0xD7, 0x8E, 0x72, 0xCC, 0xE8, 0xDA, 0x81, 0xC8, 0xC3, 0x64, 0xFC, 0x26, 0x07, 0x0D, 0x5D, 0x5B,
-    0xDE, 0xC2, 0x0A, 0x52, 0x6D, 0xD8, 0xA2, 0x0E, 0xE5, 0x49, 0xA5, 0x0B, 0x4F, 0x71, 0xFB, 0x86,
-    0x24, 0x7F, 0x6D, 0xFE, 0x6D, 0xCD, 0xD7, 0x5E, 0x9D, 0xCB, 0xA1, 0x86, 0xA4, 0x16, 0x6F, 0x3F,
-    0xB6, 0x60, 0x55, 0x3E, 0xED, 0xCF, 0x1B, 0x02, 0xF5, 0xEC, 0x4C, 0x1F, 0x5F, 0xDA, 0xB9, 0xB4,
-    0xE5, 0x52, 0x8D, 0xF7, 0x41, 0x3F, 0xA9, 0xF4, 0x13, 0x66, 0xD9, 0x2B, 0x7C, 0x7E, 0xAE, 0xAA,
-    0xC6, 0x6D, 0x13, 0x16, 0xF1, 0x57, 0x34, 0x77, 0x75, 0x8D, 0x50, 0xB4, 0x1E, 0xAC, 0xC4, 0x1D,
-    0x94, 0x65, 0x30, 0x8F, 0x03, 0x2C, 0x9B, 0x13, 0x35, 0xD7, 0xD3, 0x1D, 0x3E, 0xFC, 0x37, 0x63,
-    0x79, 0x38, 0x46, 0xAB, 0xB3, 0x3A, 0xC9, 0xEA, 0x3C, 0xAF, 0x9E, 0xC8, 0xA5, 0x55, 0xED, 0x58,
-    0x3F, 0x7B, 0x74, 0x52, 0x9C, 0xE9, 0x13, 0x61, 0xDE, 0x76, 0xF6, 0x03, 0xE7, 0xBE, 0x5A, 0x2E,
-    0x29, 0x7D, 0xFA, 0x72, 0x13, 0xDE, 0x7C, 0x15, 0x36, 0xDB, 0x77, 0x9D, 0x24, 0x6C, 0xA2, 0x36,
-    0x6A, 0xC3, 0xC6, 0x6A, 0x12, 0xF8, 0xFE, 0xB2, 0x7F, 0xDA, 0xEA, 0x2C, 0x56, 0xC9, 0x91, 0xDF,
-    0x4C, 0xBB, 0xB8, 0xDB, 0xBE, 0x6B, 0xDE, 0x82, 0xF4, 0x98, 0xAB, 0x9D, 0x85, 0xF6, 0xB9, 0xF1,
-    0xAE, 0x40, 0x9C, 0xE2, 0x1F, 0x5C, 0xA4, 0x09, 0x9D, 0x9D, 0x23, 0xD5, 0x6A, 0x5D, 0xF4, 0x8C,
-    0xB9, 0x50, 0x1A, 0xB1, 0x96, 0xF5, 0x7A, 0x2D, 0x35, 0x63, 0x44, 0x82, 0x90, 0x98, 0xAD, 0x1F,
-    0x5B, 0xF3, 0xCC, 0xFA, 0x3F, 0x5B, 0x52, 0x1A, 0x71, 0x43, 0x02, 0x2B, 0x7D, 0x37, 0x2D, 0x17,
-    0x3D, 0xA2, 0x21, 0x79, 0xE5, 0x8B, 0x7E, 0x1F, 0xB6, 0xD6, 0x74, 0x1F, 0xBD, 0x3E, 0x9C, 0xC7,
-    0x61, 0xD7, 0x4D, 0x1C, 0x30, 0xCE, 0x55, 0xBF, 0xF0, 0x69, 0x77, 0xE1, 0xA8, 0x55, 0xE9, 0x4A,
-    0x6C, 0x98, 0x62, 0x40, 0xC7, 0xA9, 0xAE, 0x91, 0x96, 0x5E, 0x1B, 0x34, 0x41, 0xE9, 0x76, 0x1B,
-    0xAA, 0xC5, 0x45, 0x1F, 0xBA, 0xCE, 0xEF, 0xA8, 0xA1, 0x0A, 0x83, 0x31, 0x55, 0xE1, 0x96, 0x2A,
-    0x5B, 0x74, 0x4B, 0xAB, 0xA4, 0x75, 0xA4, 0xA6, 0x94, 0x85, 0x8C, 0x8D, 0xCB, 0xBC, 0x78, 0x38,
-    0x6A, 0x36, 0x66, 0x92, 0x9D, 0xE7, 0x7C, 0x38, 0x5A, 0x3F, 0x42, 0x9B, 0x14, 0x31, 0x80, 0xE5,
-    0x4B, 0x2E, 0x05, 0x51, 0x4B, 0x01, 0x2C, 0x85, 0xDE, 0x87, 0xCF, 0x30, 0x41, 0x84, 0x4D, 0x6F,
-    0xA8, 0xDA, 0x26, 0x05, 0x44, 0xF2, 0x23, 0xBC, 0xF7, 0x6B, 0xBC, 0xF4, 0x31, 0x26, 0xDB, 0x21,
-    0x9D, 0x42, 0x3D, 0x95, 0x44, 0x33, 0x0A, 0xAC, 0xFF, 0xE3, 0xC2, 0xA8, 0xED, 0x91, 0x22, 0x6D,
-    0xA6, 0x77, 0x59, 0x8A, 0x87, 0xF2, 0x16, 0x7A, 0x4F, 0x1F, 0xA8, 0xC6, 0x8A, 0x4C, 0xDC, 0xAD,
-    0x29, 0x3B, 0x56, 0x51, 0xC6, 0x15, 0xBF, 0x9D, 0x74, 0x3C, 0x86, 0xEE, 0xB6, 0x92, 0x51, 0xCD,
-    0x58, 0xF3, 0x76, 0xBF, 0x80, 0x88, 0xEA, 0x6C, 0x0B, 0xC9, 0x54, 0xBB, 0x1B, 0xF4, 0xA7, 0x56,
-    0x91, 0x56, 0xCA, 0x7D, 0xFA, 0x58, 0xEB, 0x4B, 0x7F, 0x8B, 0xE0, 0xCC, 0x61, 0x0F, 0xFB, 0x7C,
-    0x00, 0x41, 0x2F, 0x00, 0x8A, 0xB4, 0xC5, 0x23, 0x95, 0x2E, 0x1D, 0x69, 0xA5, 0x03, 0x28, 0xD5,
-    0xD1, 0x6A, 0x50, 0x4A, 0x31, 0x96, 0x07, 0x97, 0xE5, 0xEA, 0xCF, 0x32, 0xD9, 0x4D, 0xEA, 0x28,
-    0x39, 0x0D, 0x0B, 0xB3, 0xE6, 0x97, 0x82, 0x3E, 0xA8, 0xAF, 0xB9, 0x60, 0xC3, 0x43, 0x51, 0x21,
-    0xD8, 0x80, 0xDD, 0x5F, 0xA1, 0xF3, 0xBF, 0x40, 0xBD, 0x4F, 0xC8, 0x01, 0x79, 0x61, 0xC8, 0x08,
-    0x6C, 0xF4, 0x3A, 0x79, 0x52, 0x28, 0x99, 0xE3, 0x1B, 0x23, 0x1B, 0xD9, 0x1A, 0x1B, 0xB7, 0xEE,
-    0xB0, 0x03, 0x31, 0xFB, 0x38, 0xAE, 0xA0, 0x3E, 0xAE, 0x05, 0x7C, 0x6C, 0x34, 0xF5, 0x1C, 0x0F,
-    0xA1, 0x84, 0x9C, 0x0F, 0x73, 0xB0, 0xEF, 0xA2, 0x37, 0x61, 0x89, 0xC5, 0xE5, 0x68, 0xA7, 0x6B,
-    0xEF, 0xBC, 0xAA, 0x92, 0xF6, 0x9C, 0xCF, 0x85, 0x37, 0x61, 0xFA, 0x63, 0x64, 0xAA, 0xB5, 0x1D,
-    0x08, 0x07, 0x3D, 0x4C, 0x89, 0x2D, 0xB4, 0x26, 0x2F, 0xCF, 0xFA, 0xCF, 0x42, 0x1F, 0x97, 0x71,
-    0x91, 0x26, 0x0F, 0xCD, 0x4D, 0xB4, 0x01, 0x26, 0x90, 0x83, 0xA8, 0x86, 0xDB, 0x83, 0x20, 0xA6,
-    0xB1, 0x68, 0xF0, 0x6D, 0xFF, 0xF9, 0x11, 0xA5, 0xB3, 0x13, 0xB1, 0xCA, 0xC0, 0x3A, 0xD9, 0x49,
-    0x96, 0x0A, 0xA1, 0x24, 0xF9, 0x27, 0x62, 0xF2, 0xFF, 0xEC, 0xF5, 0xE8, 0x54, 0xE5, 0xAE, 0xCF,
-    0x7D, 0x19, 0x79, 0x79, 0x1F, 0x39, 0xDA, 0xFC, 0xA0, 0x89, 0xEB, 0xA8, 0xD5, 0xA3, 0x8B, 0xEB,
-    0xB0, 0xB1, 0xD7, 0x4E, 0xD7, 0x47, 0x2F, 0x1B, 0x51, 0xBB, 0xF9, 0xA7, 0x7D, 0xFE, 0x5F, 0x82,
-    0xCF, 0x6F, 0xFB, 0xBC, 0xFC, 0xC9, 0x8B, 0x47, 0x14, 0x45, 0xD5, 0xCB, 0xC8, 0xB7, 0x40, 0x7E,
-    0x05, 0x32, 0x8C, 0x49, 0x0B, 0x0B, 0x18, 0x40, 0x21, 0x3C, 0x3C, 0xB9, 0xD0, 0xA7, 0x47, 0xD0,
-    0x67, 0x4B, 0xFE, 0x38, 0xB1, 0x4A, 0xF2, 0x3A, 0x31, 0x4B, 0x24, 0x0C, 0x9C, 0xFC, 0xB9, 0xE3,
-    0x48, 0xE3, 0x20, 0x06, 0xD9, 0x23, 0x3B, 0x00, 0xD9, 0x02, 0x6A, 0x29, 0x66, 0xD7, 0x4E, 0x78,
-    0x1E, 0x51, 0x98, 0x6C, 0x16, 0xBF, 0x01, 0xF5, 0xCC, 0x88, 0xBA, 0x73, 0x4E, 0x13, 0xBE, 0x3F,
-    0xE6, 0x13, 0x01, 0xF7, 0x69, 0x01, 0x3D, 0x43, 0xE9, 0x40, 0x8A, 0x75, 0xA7, 0xE0, 0x4A, 0x53,
-    0x20, 0x24, 0xA9, 0x14, 0xEB, 0x5E, 0x21, 0x2A, 0x8A, 0x94, 0xBE, 0xD7, 0x81, 0xFE, 0x50, 0x40,
-    0xFF, 0x1C, 0xC1, 0x41, 0x79, 0x57, 0x57, 0xC0, 0x42, 0x57, 0x6E, 0xB5, 0xFB, 0x74, 0x11, 0xAA,
-    0x41, 0xE3, 0x16, 0x34, 0xE8, 0x40, 0x55, 0xA6, 0x17, 0xD0, 0xE4, 0xF3, 0x02, 0x0C, 0xEA, 0xE2,
-    0x0E, 0x9B, 0x05, 0x34, 0x25, 0x8D, 0x48, 0x03, 0x52, 0x1A, 0xBB, 0xD7, 0x3E, 0x9A, 0xDC, 0x06,
-    0x50, 0x03, 0xD9, 0x24, 0xAE, 0xFA, 0xFE, 0xCA, 0x9E, 0xBC, 0xAE, 0x1D, 0xFF, 0x0B, 0x55, 0x24,
-    0xF2, 0x8F, 0xB5, 0x07, 0x68, 0x20, 0xD2, 0x3E, 0xA4, 0x79, 0x48, 0xBB, 0xD0, 0x12, 0x58, 0x85,
-    0xEC, 0xDB, 0x33, 0x91, 0xAB, 0x87, 0xC8, 0xFA, 0x5F, 0xCA, 0xDF, 0x39, 0xA9, 0xF5, 0x26, 0xD3,
-    0x48, 0x19, 0xF3, 0x07, 0x76, 0x2F, 0x1E, 0x9E, 0x75, 0x61, 0x4C, 0xB7, 0x09, 0x43, 0xC2, 0xED,
-    0x94, 0xA6, 0x42, 0xAB, 0x1F, 0xC2, 0xD8, 0xDC, 0x33, 0xDB, 0xFB, 0x18, 0x75, 0x88, 0xCB, 0x44,
-    0xFF, 0xCB, 0xFC, 0x94, 0x31, 0xD5, 0xA7, 0x65, 0xDA, 0x4F, 0x75, 0xB5, 0x07, 0x22, 0xBD, 0xF8,
-    0x5E, 0xA7, 0xCA, 0xBD, 0x23, 0xEF, 0xB5, 0xA3, 0x17, 0x3F, 0xDA, 0xF4, 0xE2, 0x5F, 0x2C, 0xD2,
-    0x5E, 0x37, 0x0B, 0xA0, 0xD9, 0xB5, 0x35, 0xFA, 0xB6, 0x4C, 0x68, 0xD3, 0x59, 0x20, 0x90, 0x3E,
-    0x50, 0xB6, 0x3E, 0x19, 0xA0, 0xC6, 0xC6, 0x8F, 0xD4, 0xCA, 0xEC, 0xCC, 0x8E, 0x23, 0x36, 0x1C,
-    0x2B, 0xC3, 0x1E, 0x4F, 0x35, 0xF4, 0x5B, 0x87, 0xEA, 0x1A, 0x4E, 0xEE, 0xFA, 0x29, 0xFB, 0xE6,
-    0x27, 0xF4, 0xA7, 0x22, 0xDB, 0xDB, 0x3E, 0xB3, 0x34, 0x5B, 0xF5, 0x99, 0xB0, 0xCF, 0x72, 0xF6,
-    0xD6, 0xDE, 0xC0, 0x9E, 0x63, 0x9F, 0xFD, 0x80, 0xBD, 0xF5, 0xAE, 0xAA, 0x2C, 0xE8, 0xB3, 0x86,
-    0xBD, 0xC5, 0x7E, 0x0A, 0x07, 0xF6, 0x19, 0xFB, 0x69, 0xC1, 0x1E, 0x1A, 0x7B, 0x2B, 0x27, 0x8D,
-    0x49, 0xC3, 0xA9, 0x9F, 0x18, 0xA2, 0x06, 0x75, 0x48, 0xC7, 0xA9, 0xB1, 0x36, 0x4D, 0x5C, 0xDB,
-    0x67, 0xE8, 0x34, 0x9F, 0x72, 0xDD, 0xE7, 0x00, 0xF4, 0xE8, 0x94, 0x7F, 0x7B, 0xEA, 0xC0, 0xCF,
-    0x2F, 0x66, 0xAA, 0xAC, 0x08, 0x82, 0x17, 0x64, 0x25, 0xB7, 0x04, 0x6E, 0x2E, 0xE6, 0x9D, 0xA8,
-    0x62, 0xED, 0x2C, 0x97, 0xBB, 0x4C, 0x25, 0xAC, 0x36, 0xE9, 0xB1, 0x8C, 0x94, 0xCC, 0x58, 0xF7,
-    0x20, 0x19, 0x65, 0xCC, 0x1D, 0x4A, 0xD6, 0x97, 0x1E, 0x5C, 0x8C, 0x89, 0x91, 0x1A, 0x09, 0x26,
-    0x71, 0x8B, 0xA5, 0x53, 0x65, 0x69, 0x0B, 0x0F, 0x2C, 0xFC, 0xAE, 0x41, 0x3F, 0xD2, 0x7A, 0x8D,
-    0xAE, 0x5F, 0x87, 0x72, 0xD3, 0xD9, 0xB7, 0x6C, 0x09, 0xF0, 0xDF, 0xE6, 0x8D, 0x16, 0xEB, 0xD1,
-    0xF3, 0x62, 0xCD, 0x80, 0xD1, 0xEF, 0xDA, 0xD1, 0xD1, 0x03, 0x5B, 0xDF, 0xC1, 0x62, 0x83, 0xE0,
-    0xB7, 0xE1, 0xD5, 0x15, 0xB1, 0xEC, 0xFE, 0x6C, 0x15, 0xE0, 0xEA, 0xE9, 0x2E, 0x4E, 0x02, 0x79,
-    0xDF, 0x2A, 0xFB, 0x25, 0x74, 0x5C, 0x24, 0xF3, 0xC5, 0x48, 0xC3, 0x53, 0x52, 0xCD, 0xA4, 0xB6,
-    0x59, 0x7E, 0x71, 0x4D, 0x1F, 0x2A, 0x1F, 0x0E, 0xE4, 0x3E, 0x9A, 0x29, 0x70, 0x06, 0x6F, 0x24,
-    0xA8, 0xCC, 0x01, 0x17, 0x04, 0xB2, 0x6C, 0xC0, 0x65, 0x61, 0x61, 0xB3, 0x01, 0x97, 0xEB, 0xC7,
-    0x03, 0x2E, 0x57, 0x12, 0x42, 0x07, 0x01, 0x17, 0x87, 0x2E, 0x5D, 0xB9, 0x3F, 0xCC, 0x01, 0x17,
-    0xAD, 0xC3, 0x7D, 0x98, 0x5C, 0x22, 0x98, 0xE6, 0xE0, 0x2F, 0xEE, 0x01, 0x40, 0xE4, 0x55, 0x7A,
-    0x3D, 0x54, 0xB7, 0xA0, 0x86, 0xCA, 0x10, 0x3D, 0xC2, 0xA2, 0xFD, 0x3D, 0xB7, 0x7E, 0x13, 0xC0,
-    0x34, 0xEF, 0xFC, 0xCB, 0x01, 0xDD, 0xC7, 0x36, 0xF4, 0xBA, 0xE8, 0x75, 0x9D, 0xF4, 0x9A, 0x58,
-    0x97, 0xF5, 0xEC, 0x6F, 0xCC, 0x65, 0x82, 0xB9, 0xF2, 0x89, 0x22, 0x6E, 0xCB, 0x80, 0x85, 0xD0,
-    0xA2, 0xE6, 0xD9, 0x1D, 0xCF, 0x1E, 0x3E, 0x1F, 0x2E, 0x11, 0xE8, 0xA0, 0xD3, 0x24, 0xE8, 0xED,
-    0x39, 0xEA, 0xEC, 0x39, 0x6E, 0xC7, 0x73, 0xA3, 0x67, 0x7D, 0x4E, 0xEB, 0xC7, 0xAB, 0xC5, 0x73,
-    0xCF, 0x5F, 0x1D, 0x64, 0x7C, 0x6E, 0x7A, 0x7E, 0xAD, 0x9C, 0x70, 0x3C, 0x4F, 0xF5, 0xB0, 0xDE,
-    0xC4, 0xAA, 0xA3, 0xEB, 0x7C, 0xCD, 0x7C, 0x6E, 0x8F, 0x67, 0x2B, 0xC9, 0x19, 0xAE, 0x9E, 0x60,
-    0x8B, 0xA4, 0x21, 0x72, 0x30, 0x24, 0x7C, 0xFB, 0x5E, 0x86, 0xE8, 0x88, 0x7C, 0x9F, 0x09, 0xB6,
-    0x8A, 0x43, 0x4C, 0x1B, 0xB6, 0x51, 0xB5, 0x13, 0xA0, 0xF1, 0x6C, 0xF3, 0xB3, 0x9E, 0x7B, 0x1E,
-    0xD3, 0xD4, 0x26, 0x8B, 0x25, 0xB7, 0xE9, 0x72, 0xCC, 0x0A, 0x56, 0x19, 0x70, 0x28, 0xF2, 0xD9,
-    0x1E, 0x31, 0x46, 0x3B, 0x01, 0x33, 0x6D, 0xE0, 0x48, 0x4A, 0x9F, 0x49, 0x5E, 0x37, 0x47, 0xAB,
-    0x7F, 0xA5, 0x34, 0x32, 0x46, 0xFE, 0x3C, 0xA5, 0x71, 0x4A, 0x51, 0x8B, 0xC5, 0x26, 0x8D, 0x0D,
-    0x36, 0x67, 0x2C, 0xAE, 0x6F, 0x00, 0x40, 0x87, 0x7D, 0xBF, 0x49, 0x1C, 0xDC, 0xF0, 0x6D, 0x7E,
-    0xAE, 0x4D, 0x2D, 0x8B, 0x01, 0x4A, 0xCC, 0xAC, 0x36, 0x8C, 0x03, 0x35, 0x58, 0x60, 0xB1, 0xF9,
-    0x03, 0x83, 0x5A, 0xDA, 0x3D, 0x2E, 0xFB, 0x42, 0x2C, 0x00, 0x18, 0x2D, 0x9D, 0xCD, 0x78, 0x83,
-    0x4E, 0x0E, 0xC4, 0x21, 0xC4, 0xD1, 0x52, 0x9D, 0x58, 0xCE, 0xAC, 0x89, 0xBF, 0x6D, 0xF2, 0x77,
-    0xD5, 0x18, 0xFB, 0x07, 0x3D, 0x0E, 0x29, 0x84, 0xF4, 0xF8, 0x3E, 0x81, 0x40, 0x2A, 0x0B, 0x7D,
-    0xA1, 0xA7, 0x35, 0xB8, 0x5E, 0x57, 0xFB, 0xD6, 0x96, 0x05, 0xC6, 0xD3, 0x64, 0x72, 0xD5, 0x58,
-    0xED, 0xB0, 0x9E, 0xA6, 0xE7, 0x39, 0xB6, 0x75, 0xC3, 0x97, 0x81, 0xB6, 0x17, 0xD6, 0xC7, 0xF1,
-    0x70, 0x9C, 0x82, 0x36, 0x0B, 0x63, 0xD4, 0xDF, 0xBA, 0x13, 0xF4, 0xB7, 0xD7, 0x38, 0x26, 0x90,
-    0x89, 0x1A, 0x97, 0x61, 0x8D, 0x0C, 0x77, 0xA6, 0xA1, 0x52, 0x81, 0x9A, 0x52, 0x32, 0xB6, 0x93,
-    0x48, 0x75, 0x88, 0xE8, 0xB1, 0x94, 0xD1, 0x1F, 0x74, 0x69, 0x12, 0x1C, 0x65, 0x12, 0x0D, 0x76,
-    0x90, 0x47, 0x2D, 0x72, 0xE2, 0x4F, 0x77, 0x4C, 0x49, 0xD1, 0x15, 0xA3, 0x0D, 0xC6, 0x06, 0x72,
-    0xA8, 0x3E, 0xC6, 0xD9, 0xB1, 0xE8, 0xF8, 0x3E, 0x26, 0xF6, 0x80, 0x0C, 0xBB, 0x01, 0x0B, 0x7B,
-    0x87, 0x3C, 0xBD, 0xF6, 0x19, 0x87, 0x02, 0x93, 0xCC, 0x99, 0xA1, 0x8F, 0xA5, 0xDF, 0x66, 0xD0,
-    0xE6, 0x00, 0xD7, 0x66, 0x87, 0x52, 0xC7, 0x0F, 0xD7, 0x0D, 0xE0, 0x5D, 0x90, 0xDB, 0x89, 0x22,
-    0x92, 0x62, 0xC5, 0x4D, 0x01, 0x5A, 0x0A, 0x41, 0x7D, 0x83, 0xEA, 0x98, 0x5D, 0x62, 0x5E, 0xE0,
-    0xB1, 0xFA, 0xE3, 0x7F, 0xE4, 0x12, 0xAF, 0x1C, 0xD5, 0xC0, 0x3A, 0xAD, 0xFC, 0x02, 0xF9, 0x5D,
-    0x29, 0x53, 0xCD, 0x20, 0x04, 0x5A, 0xAA, 0x77, 0x0E, 0xFA, 0x01, 0x6A, 0x30, 0x87, 0x52, 0xD4,
-    0xFC, 0x44, 0x8F, 0xF4, 0xC3, 0xBC, 0x46, 0x55, 0x29, 0x13, 0x03, 0x7B, 0x1B, 0x02, 0x86, 0xA7,
-    0x97, 0xAE, 0x5E, 0x6A, 0x61, 0x70, 0xF6, 0x1A, 0xBF, 0x0D, 0xB4, 0x4F, 0x8E, 0x65, 0xC4, 0xBC,
-    0x56, 0x40, 0xDE, 0xD9, 0xA7, 0x49, 0x84, 0xD0, 0x8A, 0x7F, 0x24, 0x8A, 0x47, 0x5A, 0xA4, 0xC9,
-    0xB8, 0x9A, 0x9D, 0x37, 0x20, 0xAF, 0xB5, 0xB5, 0xCC, 0xE4, 0xA2, 0x0B, 0x97, 0x09, 0x03, 0xCE,
-    0x30, 0xED, 0xBD, 0xC8, 0xFB, 0x69, 0x8B, 0x08, 0x23, 0xE5, 0xE7, 0xD9, 0xE8, 0x28, 0xB1, 0xA3,
-    0x1F, 0xF3, 0x03, 0x2B, 0x94, 0x1E, 0xEE, 0x21, 0x64, 0x64, 0x4D, 0x7F, 0x83, 0xEA, 0x95, 0x1F,
-    0xA8, 0xA1, 0xA5, 0xF6, 0xD7, 0x62, 0xC0, 0x4C, 0xA1, 0x24, 0x8C, 0x29, 0x48, 0x87, 0x2B, 0x33,
-    0x65, 0x5E, 0xB8, 0x7E, 0x9C, 0xF3, 0x08, 0x41, 0xF2, 0x19, 0xD2, 0x8A, 0xA5, 0x5D, 0x91, 0x9D,
-    0xF7, 0xE5, 0xC3, 0x9B, 0xA7, 0x73, 0x9A, 0xBD, 0x3A, 0x31, 0x68, 0x8F, 0x7B, 0x64, 0xC6, 0xB5,
-    0x6B, 0xCC, 0xF8, 0x2B, 0x01, 0x5C, 0x31, 0x66, 0x85, 0x05, 0x93, 0x1C, 0x4D, 0xC7, 0x8C, 0x0E,
-    0x9A, 0xBC, 0x09, 0xDA, 0x57, 0xC4, 0xE3, 0xF1, 0x67, 0x72, 0x80, 0x9C, 0x69, 0xF3, 0xF2, 0x03,
-    0xEB, 0xC1, 0xD3, 0x92, 0xB8, 0xE4, 0xD4, 0x87, 0x0A, 0xE8, 0xE6, 0x64, 0x81, 0x1C, 0x80, 0x01,
-    0x3D, 0xBE, 0xA3, 0xD7, 0x43, 0xC8, 0xF3, 0x23, 0xE3, 0xDE, 0x35, 0xD7, 0x33, 0x1D, 0xB5, 0xB9,
-    0x5A, 0x92, 0xBF, 0xC6, 0xFA, 0x8C, 0x2E, 0x0E, 0x80, 0xE9, 0x62, 0xC3, 0x77, 0xF3, 0xFA, 0x30,
-    0xB4, 0xB9, 0x03, 0x1B, 0xA1, 0x88, 0x14, 0xA1, 0x88, 0xDC, 0x44, 0x19, 0xBD, 0x47, 0x8E, 0xB5,
-    0x8D, 0x11, 0x6B, 0x99, 0x09, 0x20, 0x3B, 0x6B, 0x65, 0xDC, 0xFF, 0xF4, 0x14, 0xB1, 0x23, 0x66,
-    0xEA, 0x81, 0x50, 0xE0, 0xC2, 0x2D, 0x75, 0xF6, 0xE6, 0x73, 0x5B, 0xD5, 0x31, 0xE2, 0xBC, 0x2F,
-    0xCB, 0x33, 0x37, 0xFF, 0xD4, 0x43, 0x83, 0x09, 0xF2, 0xC8, 0x44, 0x1A, 0x8F, 0x97, 0x0E, 0x8D,
-    0x55, 0x76, 0x6F, 0x5C, 0x85, 0xDC, 0x48, 0x92, 0x4F, 0xB9, 0xF0, 0x8B, 0x26, 0xC5, 0xC2, 0x52,
-    0x6E, 0x1F, 0xDF, 0x25, 0xC1, 0x5D, 0x50, 0x54, 0xD8, 0x2F, 0x8A, 0x42, 0xEB, 0x60, 0x46, 0x4B,
-    0x8C, 0x59, 0x8E, 0x35, 0x2B, 0xE2, 0x0A, 0x35, 0x6E, 0x55, 0x6B, 0x18, 0x87, 0x63, 0x56, 0x51,
-    0xBF, 0xCA, 0x8A, 0xB2, 0x1E, 0xE2, 0xEF, 0x69, 0x11, 0x43, 0x8F, 0xC7, 0x3A, 0xE3, 0x7F, 0xA2,
-    0x8F, 0xFA, 0xD9, 0x8D, 0x75, 0x2D, 0x41, 0x15, 0x2F, 0x29, 0x5E, 0x95, 0x54, 0xAA, 0x09, 0xC1,
-    0x8C, 0x2B, 0x52, 0xC9, 0x09, 0x3E, 0xB2, 0x07, 0x86, 0xB8, 0x70, 0xA5, 0x51, 0xE5, 0x6D, 0x4A,
-    0xE2, 0xB7, 0x31, 0x8B, 0x63, 0xF4, 0xCA, 0x03, 0x48, 0x0F, 0x8E, 0x2B, 0xD6, 0x36, 0x1A, 0xC9,
-    0xE5, 0xC1, 0xF6, 0x73, 0xB3, 0xAD, 0xBD, 0x74, 0x9B, 0xF1, 0x45, 0x24, 0x85, 0xD0, 0x2E, 0xA7,
-    0x38, 0xA1, 0x3B, 0x66, 0x6F, 0xFF, 0x4D, 0x80, 0xD0, 0xDD, 0xB7, 0x7B, 0x09, 0xFA, 0x17, 0xEC,
-    0x25, 0xB8, 0x0C, 0x30, 0xCD, 0x43, 0x9B, 0xB8, 0x00, 0x95, 0xC4, 0xFF, 0x1D, 0x7D, 0xDA, 0x7F,
-    0xDB, 0xCC, 0xD4, 0x7F, 0x52, 0xCF, 0x77, 0xE7, 0x04, 0xE4, 0x2B, 0x3E, 0xB9, 0xE9, 0x9D, 0xA7,
-    0x7E, 0x11, 0xEF, 0xE9, 0xD8, 0xF8, 0x2E, 0x54, 0x2E, 0x92, 0xF8, 0x41, 0x36, 0xDE, 0xD8, 0x6E,
-    0x2F, 0x13, 0xE2, 0xED, 0x7B, 0xC8, 0x1D, 0x0C, 0x91, 0x4B, 0x30, 0xEE, 0x2C, 0xCB, 0x7F, 0x81,
-    0x4D, 0x7F, 0x3D, 0xA2, 0x07, 0x6E, 0x1D, 0x66, 0x6F, 0x04, 0xAC, 0xB7, 0xFE, 0xEE, 0x23, 0xBD,
-    0xFC, 0x1B, 0x2C, 0x97, 0x61, 0xA3, 0x20, 0xAB, 0x15, 0x1A, 0x54, 0x39, 0xB4, 0xCB, 0xCB, 0x04,
-    0xF3, 0x4A, 0x81, 0xC3, 0xB5, 0x7A, 0x87, 0x10, 0x59, 0x5B, 0x6A, 0xC1, 0x65, 0x90, 0xBB, 0x98,
-    0xB9, 0x63, 0x64, 0x9A, 0x3A, 0xAE, 0x9D, 0x40, 0x69, 0x71, 0x09, 0x18, 0xDD, 0x9E, 0xE2, 0x63,
-    0x64, 0x83, 0xCE, 0x08, 0xEF, 0x28, 0x19, 0xF5, 0x33, 0xD7, 0x6E, 0xA6, 0xCE, 0xE6, 0xED, 0x12,
-    0xE0, 0xAA, 0x9F, 0x77, 0x8A, 0x4C, 0x81, 0x2E, 0x1B, 0x55, 0x50, 0xFD, 0x69, 0x0A, 0xBC, 0x14,
-    0x8B, 0xC6, 0x3C, 0xEF, 0x4F, 0x1F, 0x0C, 0xB1, 0xFE, 0xA3, 0x49, 0x11, 0xF0, 0xE1, 0x86, 0xC0,
-    0x0E, 0x99, 0x47, 0x31, 0x37, 0xB2, 0xF9, 0x3D, 0x77, 0x2F, 0x0E, 0x50, 0xC8, 0xA2, 0x1A, 0x41,
-    0x63, 0xB5, 0x77, 0x43, 0x6C, 0x04, 0x45, 0x9A, 0x81, 0x7E, 0x24, 0x4F, 0xF4, 0x67, 0xD0, 0x39,
-    0x43, 0x9A, 0xE9, 0x03, 0x7E, 0xE7, 0xF6, 0x31, 0x3C, 0x08, 0x5E, 0xBF, 0xE8, 0xF4, 0x4B, 0xA5,
-    0xDC, 0xE8, 0x97, 0x92, 0xBB, 0x57, 0xBD, 0x2E, 0xAA, 0xB4, 0x46, 0x57, 0x7C, 0x65, 0x0C, 0xBA,
-    0xAA, 0xBC, 0x57, 0x07, 0x35, 0x04, 0x00, 0xBE, 0x7C, 0xCD, 0xCD, 0xAD, 0xFF, 0x5C, 0xC1, 0x80,
-    0x54, 0xCE, 0x0E, 0x4B, 0xBB, 0xBF, 0x3E, 0x45, 0x24, 0x68, 0xA0, 0x6C, 0x2D, 0xB8, 0x4F, 0x5A,
-    0xBF, 0x64, 0x8E, 0x58, 0x23, 0x25, 0xB1, 0x26, 0x17, 0x16, 0x85, 0x31, 0x53, 0x6B, 0xDE, 0x3B,
-    0x73, 0x90, 0x8D, 0x5B, 0x13, 0xAD, 0x4A, 0xE3, 0x8F, 0x22, 0x2E, 0xFA, 0xBD, 0x85, 0x2B, 0xCD,
-    0xAC, 0x5F, 0xA5, 0x1F, 0xB3, 0xAD, 0x8F, 0xC5, 0x2D, 0x4B, 0x97, 0x3B, 0x16, 0x91, 0x54, 0xAD,
-    0x7C, 0xD0, 0x39, 0x52, 0x79, 0xFA, 0x6C, 0xED, 0x49, 0xED, 0x03, 0x01, 0xFF, 0x0F, 0xB5, 0x22,
-    0x11, 0xB4, 0xC1, 0xEF, 0x1A, 0x00, 0xD1, 0x05, 0x5F, 0xB4, 0x98, 0x56, 0x7D, 0xF8, 0x69, 0xA7,
-    0x30, 0x2C, 0x86, 0xE8, 0x3F, 0x3A, 0x36, 0x3E, 0x7E, 0xD4, 0xEB, 0x4C, 0x73, 0x25, 0xCE, 0xB0,
-    0x9B, 0xC5, 0x91, 0x38, 0x61, 0xEF, 0x48, 0x6E, 0x72, 0xF8, 0xAB, 0x15, 0x47, 0xE4, 0x4D, 0x01,
-    0x61, 0x86, 0xE1, 0x15, 0x72, 0xDA, 0xFA, 0xDA, 0x07, 0xDC, 0x09, 0xA3, 0x9D, 0x62, 0x73, 0xD2,
-    0xC7, 0x30, 0x79, 0x35, 0x47, 0x84, 0x6C, 0x43, 0x10, 0x8D, 0x82, 0x01, 0x7A, 0xAC, 0x11, 0xDC,
-    0xBD, 0x9E, 0xA5, 0xC8, 0x15, 0xC3, 0x34, 0x08, 0x06, 0x76, 0x5B, 0x87, 0x6C, 0xB2, 0x98, 0x49,
-    0xBA, 0x29, 0x66, 0x4B, 0x86, 0x61, 0x2D, 0x8F, 0x18, 0xE1, 0x79, 0x4C, 0x4F, 0xEC, 0xEF, 0xC5,
-    0x4C, 0xAB, 0xC6, 0xB4, 0x7B, 0xB6, 0x9E, 0xEB, 0x75, 0xAC, 0x85, 0xF0, 0x4A, 0x74, 0x95, 0x1D,
-    0x1E, 0xD9, 0xEC, 0xF0, 0x66, 0xCE, 0x0E, 0xCF, 0x37, 0xF9, 0x0E, 0x3B, 0xE5, 0x2D, 0xA2, 0xEB,
-    0xA9, 0x8E, 0x90, 0xBC, 0xA4, 0x9C, 0xE7, 0xA5, 0x8F, 0xAC, 0x2B, 0x6F, 0x70, 0x10, 0x63, 0x73,
-    0xE1, 0x17, 0x86, 0x96, 0x2B, 0x7F, 0x8F, 0x2D, 0x1F, 0xBF, 0x81, 0xBB, 0xEC, 0x63, 0x6C, 0xA4,
-    0x3D, 0x6C, 0xC6, 0x58, 0x04, 0x13, 0xF6, 0x58, 0xDB, 0xF8, 0x5F, 0x10, 0x24, 0xA3, 0x7A, 0xCD,
-    0xA4, 0x63, 0xC6, 0x26, 0xA1, 0xEF, 0xC6, 0xC2, 0x34, 0x8D, 0x6A, 0x34, 0x97, 0xA3, 0xB5, 0x85,
-    0x30, 0x4A, 0x1E, 0x5A, 0x74, 0x67, 0x8C, 0xE3, 0x0C, 0xDF, 0xFF, 0xE8, 0x99, 0x19, 0x74, 0xD5,
-    0x90, 0x3E, 0xD9, 0xB9, 0xBC, 0x11, 0x13, 0x81, 0xEF, 0xBC, 0x8E, 0x37, 0x89, 0xEA, 0xB3, 0x73,
-    0xDC, 0x8F, 0xB6, 0x3D, 0xAD, 0x55, 0xC2, 0x62, 0x8B, 0xE2, 0x7F, 0xDD, 0x90, 0x4D, 0x37, 0xE7,
-    0x2D, 0xE5, 0x30, 0xC7, 0x9D, 0x19, 0x68, 0x6E, 0x27, 0x0C, 0xED, 0x44, 0x15, 0xE6, 0x13, 0xAF,
-    0x13, 0xF3, 0x92, 0x6C, 0xAF, 0x5C, 0xF9, 0x98, 0x8E, 0x5B, 0x07, 0xDC, 0xAD, 0x57, 0xB0, 0x5C,
-    0x26, 0x42, 0x8E, 0x0E, 0x69, 0x29, 0x69, 0xDF, 0x7A, 0x63, 0x11, 0x88, 0xC4, 0xE8, 0xF3, 0x8D,
-    0xAC, 0x1D, 0x86, 0xFF, 0x77, 0x87, 0x63, 0x0D, 0xAB, 0x6C, 0x24, 0xFC, 0xB9, 0xCA, 0xD6, 0x7C,
-    0xAD, 0x38, 0x4C, 0x9B, 0x40, 0xD3, 0xF1, 0x3F, 0x06, 0x80, 0x67, 0x78, 0xFB, 0xFC, 0x71, 0x98,
-    0x0D, 0xFE, 0xEC, 0xC5, 0x06, 0xFF, 0xEB, 0xC2, 0xE1, 0xC5, 0x8E, 0xE5, 0x73, 0x1C, 0x0F, 0x3B,
-    0xBB, 0x9E, 0xF4, 0xA1, 0x74, 0xB1, 0x7E, 0x8E, 0x7E, 0x3A, 0xEE, 0xE3, 0x7E, 0xD5, 0xCF, 0xFF,
-    0x03, 0xED, 0x5B, 0xBD, 0x8F, 0xDD, 0xC6, 0x11, 0x5F, 0xF2, 0xE5, 0xF4, 0x12, 0x31, 0x00, 0x53,
-    0x58, 0x36, 0x2C, 0x01, 0x61, 0x93, 0x22, 0x50, 0x0A, 0xD6, 0x69, 0x44, 0xC2, 0x01, 0x92, 0xC2,
-    0x85, 0x54, 0xE8, 0xEC, 0x22, 0x85, 0x52, 0x58, 0x85, 0xD5, 0x5C, 0x1D, 0x20, 0x16, 0x9F, 0x93,
-    0x22, 0x45, 0x8A, 0xA8, 0xB0, 0x2A, 0x17, 0x51, 0xA1, 0x00, 0xD2, 0xA9, 0xD0, 0x3F, 0x20, 0x9B,
-    0x74, 0x5C, 0xB8, 0x48, 0x61, 0x06, 0x86, 0x90, 0xD2, 0x8C, 0x23, 0x24, 0x88, 0x52, 0x98, 0x01,
-    0xE8, 0x80, 0x92, 0x49, 0x6E, 0xE6, 0xF7, 0x9B, 0x25, 0xDF, 0x87, 0x24, 0xE8, 0xF4, 0x75, 0x3A,
-    0x19, 0x79, 0xB8, 0x9D, 0x99, 0x7B, 0x8F, 0x5C, 0xEE, 0xCE, 0xCC, 0xCE, 0xCE, 0xC7, 0xD2, 0x18,
-    0xF9, 0x78, 0xA7, 0x01, 0x4D, 0xD8, 0x1B, 0x2F, 0xB7, 0x8B, 0xB0, 0x33, 0x91, 0xB5, 0xAD, 0xA0,
-    0xDC, 0x5A, 0x1B, 0x37, 0xBE, 0xC5, 0xA7, 0x9A, 0xDB, 0x5B, 0x73, 0x6B, 0x8B, 0xD0, 0xA6, 0xC6,
-    0x0E, 0x26, 0xEA, 0x8D, 0x49, 0x5A, 0x13, 0x77, 0x06, 0x4D, 0x28, 0x13, 0x09, 0x6A, 0xD8, 0xC9,
-    0x88, 0xEA, 0x35, 0xB4, 0xFE, 0x9B, 0xDC, 0x20, 0x0F, 0x70, 0xB7, 0xBB, 0xCE, 0x42, 0x6B, 0x4C,
-    0xDE, 0x98, 0x39, 0x9E, 0x55, 0x9B, 0x19, 0x9E, 0x5A, 0x18, 0x03, 0x94, 0xCA, 0x65, 0xD6, 0xCA,
-    0xC5, 0x46, 0x06, 0x73, 0x81, 0x43, 0x3E, 0x65, 0xF4, 0x13, 0xB5, 0x0E, 0x7A, 0x67, 0x4D, 0xDC,
-    0x98, 0xCC, 0x56, 0x49, 0x2D, 0x17, 0x0D, 0xB6, 0x0C, 0x70, 0xE7, 0x22, 0xB4, 0xD7, 0x6C, 0x8F,
-    0x87, 0xD8, 0x0A, 0x0F, 0xCF, 0x6A, 0x0C, 0x48, 0xFE, 0x94, 0xC8, 0xAA, 0x15, 0x7A, 0xFC, 0x09,
-    0x7F, 0x8D, 0xC9, 0x6B, 0xB9, 0xCB, 0xB3, 0xA5, 0x0C, 0xEB, 0x4B, 0x19, 0x87, 0xCC, 0x5D, 0x86,
-    0xE7, 0x59, 0xE9, 0x0C, 0x83, 0xA9, 0xF0, 0xD4, 0xD3, 0x6E, 0x0C, 0x23, 0x03, 0xE7, 0x43, 0x52,
-    0xC9, 0x08, 0x5F, 0xEF, 0xA5, 0x07, 0xDF, 0x9E, 0xEC, 0x88, 0x76, 0x5A, 0x22, 0x5B, 0x2B, 0x2A,
-    0x88, 0xC8, 0x16, 0x5F, 0xE6, 0xF5, 0xE4, 0x68, 0x36, 0x22, 0xF2, 0x30, 0x10, 0x14, 0x0D, 0x26,
-    0x1E, 0x84, 0xBF, 0x96, 0x2C, 0x03, 0x1F, 0x85, 0xE9, 0x46, 0xB9, 0x29, 0xA2, 0xED, 0x39, 0xD6,
-    0x23, 0xE3, 0xD8, 0xD1, 0x8D, 0x31, 0xBC, 0x5F, 0x51, 0x5E, 0x1A, 0xFB, 0xC9, 0x40, 0xF4, 0x79,
-    0x47, 0x24, 0xF7, 0x13, 0x95, 0x44, 0x77, 0x0C, 0x51, 0xF1, 0x48, 0xA8, 0xF2, 0x89, 0x9A, 0x39,
-    0x50, 0x66, 0x73, 0xA0, 0x44, 0x87, 0x14, 0xDA, 0x21, 0x29, 0x30, 0x8E, 0x06, 0xC8, 0x6C, 0x99,
-    0xE5, 0xE7, 0x68, 0x6A, 0xAE, 0x8C, 0x72, 0xAE, 0x83, 0xD6, 0x91, 0xF3, 0x3E, 0xA9, 0x46, 0xC6,
-    0xEB, 0xA4, 0xF8, 0xC9, 0xED, 0x74, 0x5F, 0xDC, 0x9B, 0x07, 0x7C, 0x12, 0x7B, 0x37, 0xC5, 0x5D,
-    0xA2, 0x53, 0x09, 0x64, 0x49, 0xE5, 0x5E, 0x60, 0x24, 0x8B, 0x25, 0x59, 0xFB, 0x7A, 0xC1, 0x57,
-    0x3F, 0xB7, 0xAD, 0xD9, 0xDE, 0x3E, 0x63, 0xA9, 0x1E, 0x50, 0x3F, 0x28, 0x79, 0x6D, 0xC2, 0x01,
-    0x3D, 0x35, 0x20, 0xC1, 0x6F, 0x99, 0xDD, 0x28, 0x08, 0x4F, 0x86, 0xE3, 0xC8, 0x49, 0x2E, 0x0B,
-    0x13, 0xC8, 0xF5, 0x8E, 0x94, 0x0E, 0x46, 0x12, 0x0B, 0xC3, 0x91, 0x50, 0x27, 0xBD, 0x8D, 0x6C,
-    0x52, 0x71, 0x52, 0x22, 0xFA, 0x88, 0xB0, 0x57, 0x12, 0x92, 0x6D, 0x95, 0x94, 0xE1, 0x88, 0xC2,
-    0x82, 0x7C, 0x45, 0xC4, 0x43, 0x7D, 0xC4, 0xD0, 0x2B, 0x0E, 0xBD, 0xE0, 0x84, 0x66, 0x23, 0xD9,
-    0x9A, 0x91, 0x1C, 0xD2, 0x69, 0x5D, 0xE1, 0x73, 0xD5, 0x1C, 0xBA, 0xA4, 0x54, 0xB6, 0x88, 0x2B,
-    0xF2, 0xC6, 0xC4, 0x35, 0x99, 0x20, 0x4F, 0x0C, 0x64, 0x9D, 0xB3, 0x23, 0xB9, 0xA7, 0x23, 0x25,
-    0x0F, 0x94, 0xA6, 0x7C, 0x31, 0xD3, 0x38, 0x1C, 0x25, 0x5C, 0x91, 0x4B, 0x4A, 0x1D, 0xB1, 0xA3,
-    0x64, 0x46, 0x4B, 0x6A, 0xF7, 0x1A, 0xB5, 0x7F, 0xC6, 0x0E, 0xD3, 0x25, 0x6F, 0x96, 0xAC, 0x59,
-    0x72, 0xC6, 0x31, 0x51, 0x54, 0x4E, 0x99, 0xE1, 0xEB, 0xD7, 0xD2, 0xF3, 0xDC, 0x8E, 0xAC, 0x00,
-    0x57, 0x74, 0x04, 0x60, 0x8A, 0x32, 0x02, 0x3C, 0x21, 0x1F, 0x30, 0x82, 0x6A, 0x92, 0x6B, 0x4D,
-    0x2E, 0x38, 0x4A, 0x98, 0xE0, 0xEB, 0x64, 0xCC, 0x91, 0xF4, 0xF0, 0xC2, 0xBC, 0x8D, 0xF9, 0x57,
-    0x41, 0x33, 0xEB, 0x48, 0xCC, 0x86, 0xA8, 0x21, 0x41, 0x8D, 0x27, 0x91, 0xC8, 0xD3, 0x49, 0x44,
-    0x83, 0x51, 0x02, 0x9F, 0x43, 0xA7, 0x1C, 0x61, 0xBB, 0xAC, 0x12, 0x93, 0xD9, 0x09, 0x6B, 0x95,
-    0xC0, 0xD2, 0x23, 0x11, 0x89, 0xF5, 0xA9, 0x8E, 0xEE, 0xE6, 0x5D, 0x22, 0xA6, 0x84, 0x42, 0x86,
-    0x65, 0x11, 0xC2, 0x96, 0x19, 0xAD, 0x8F, 0xCC, 0x0B, 0x76, 0xA7, 0xC2, 0xB4, 0xF0, 0xA0, 0x0A,
-    0x66, 0x51, 0x09, 0x67, 0xAD, 0x2A, 0x5C, 0xCF, 0x8B, 0xA9, 0x5C, 0xB8, 0x9D, 0x6B, 0x1D, 0x1D,
-    0x82, 0x03, 0x91, 0x98, 0xA7, 0x4A, 0xAC, 0x63, 0x1F, 0xBA, 0x19, 0xF7, 0x32, 0x8C, 0x84, 0x84,
-    0xC9, 0xDB, 0x48, 0x89, 0x71, 0x51, 0x71, 0xE1, 0x88, 0x7C, 0x31, 0x77, 0x0A, 0xE3, 0x79, 0x22,
-    0xB1, 0xD2, 0x0F, 0x42, 0xBA, 0xB6, 0x17, 0x6A, 0x91, 0x80, 0xB6, 0x8E, 0xD1, 0x4C, 0x05, 0x96,
-    0x8B, 0x3C, 0xE0, 0x5E, 0x20, 0xA8, 0xA1, 0x3D, 0x50, 0x0B, 0x66, 0xCC, 0x4B, 0xCE, 0x26, 0x70,
-    0x9A, 0xAA, 0x62, 0xB8, 0x1D, 0xC8, 0xE7, 0x1A, 0x36, 0xE6, 0x2D, 0x45, 0x66, 0x15, 0xF9, 0x7A,
-    0xE5, 0xB3, 0x42, 0x32, 0xA3, 0x07, 0xA1, 0x15, 0xFB, 0x3B, 0x99, 0xE1, 0x54, 0x67, 0xA6, 0xFF,
-    0x38, 0xD4, 0x2B, 0x6A, 0xF5, 0xC2, 0x0B, 0xA2, 0xB6, 0xE6, 0x54, 0x5E, 0xCE, 0xFA, 0xBC, 0x9C,
-    0xDB, 0x5C, 0x36, 0x3A, 0xA1, 0x07, 0xB1, 0xB4, 0x6F, 0x49, 0x33, 0xDA, 0xE6, 0xC3, 0xD3, 0x68,
-    0xD8, 0xD2, 0xB4, 0xC1, 0x84, 0xC9, 0x36, 0x0D, 0xC6, 0x6B, 0xAB, 0xC1, 0x76, 0xF0, 0x3F, 0x2B,
-    0x84, 0xB7, 0x90, 0x47, 0x56, 0x88, 0x5E, 0x8A, 0xF4, 0x1C, 0x21, 0x13, 0x71, 0x44, 0x31, 0x12,
-    0xA5, 0x23, 0x64, 0x6B, 0x55, 0x22, 0x6B, 0x1D, 0x71, 0xB2, 0x73, 0xC4, 0xEB, 0xD6, 0x11, 0x3F,
-    0xB1, 0xA9, 0x12, 0xAF, 0xD9, 0x42, 0x89, 0x54, 0xD6, 0x0C, 0x09, 0x59, 0x31, 0x8E, 0x48, 0x5A,
-    0x47, 0x84, 0x9D, 0x23, 0x02, 0xEB, 0x88, 0x99, 0xCD, 0x95, 0xC0, 0x16, 0x41, 0xC2, 0x4C, 0x44,
-    0x36, 0x12, 0xF1, 0x48, 0x84, 0x23, 0x11, 0x90, 0x30, 0x66, 0x65, 0x4B, 0x34, 0x34, 0x39, 0xF8,
-    0x6C, 0xED, 0x0C, 0x6E, 0x33, 0x52, 0xFD, 0x03, 0xD1, 0x8C, 0x84, 0xDB, 0x92, 0xA2, 0x61, 0xDA,
-    0x6B, 0x9C, 0x8B, 0x32, 0xEB, 0x95, 0x4D, 0x81, 0x55, 0x2E, 0x05, 0x56, 0x99, 0x34, 0xEF, 0x95,
-    0x47, 0xE6, 0x94, 0xB2, 0xC8, 0x38, 0x0E, 0x19, 0xC7, 0xA0, 0xF9, 0xA0, 0xFC, 0x11, 0x4C, 0xF6,
-    0x08, 0x26, 0x77, 0x04, 0x93, 0x39, 0x82, 0xC9, 0x1B, 0xC1, 0x64, 0x8D, 0x60, 0x72, 0x06, 0x18,
-    0x8C, 0x01, 0x06, 0x5F, 0x80, 0xC1, 0x16, 0x60, 0x70, 0x05, 0x18, 0x4C, 0x01, 0x36, 0x23, 0xCE,
-    0x1C, 0x8E, 0x1D, 0x0E, 0x1D, 0x0E, 0x80, 0x1D, 0x17, 0x36, 0x70, 0x30, 0x32, 0x43, 0x37, 0x5B,
-    0xB7, 0x26, 0x05, 0xB7, 0x0E, 0xD7, 0x66, 0x6D, 0x75, 0x2A, 0x3B, 0xE6, 0x7A, 0x55, 0x38, 0xAC,
-    0xA2, 0xB9, 0x76, 0xE1, 0x5D, 0x58, 0xDD, 0xF9, 0x45, 0x8D, 0x7F, 0x23, 0x7D, 0x05, 0x7D, 0xFE,
-    0xA9, 0xAC, 0x03, 0x41, 0x30, 0xE6, 0x40, 0xEF, 0xDB, 0x42, 0x50, 0xEB, 0x11, 0xD5, 0x62, 0x4A,
-    0x97, 0x48, 0x8C, 0x25, 0x50, 0xF9, 0x34, 0x90, 0xCE, 0x62, 0x0D, 0x85, 0x8A, 0x22, 0xCE, 0x21,
-    0xB4, 0x0E, 0x35, 0x8A, 0x2A, 0x65, 0x4A, 0x6A, 0x8E, 0xA7, 0x9E, 0x78, 0x2D, 0x71, 0x15, 0xCA,
-    0x0F, 0x41, 0x97, 0x95, 0xF4, 0x5A, 0x61, 0xC4, 0x2C, 0x67, 0x9B, 0x74, 0x9B, 0x4E, 0x49, 0xDE,
-    0xEA, 0x2E, 0x42, 0xE3, 0xD5, 0x4F, 0x0B, 0x7F, 0x36, 0x00, 0x06, 0x1D, 0xEE, 0x0D, 0x3B, 0xBA,
-    0x4A, 0x6D, 0x2E, 0x30, 0x6E, 0x12, 0xDD, 0x4A, 0x6A, 0x6C, 0x45, 0xE2, 0xF4, 0xCA, 0x70, 0xE1,
-    0x06, 0x8B, 0x73, 0xDE, 0xC1, 0x6A, 0x06, 0xEA, 0xD6, 0x0C, 0xBA, 0xD5, 0xD3, 0x73, 0xB5, 0x29,
-    0xBD, 0xE1, 0x22, 0x1C, 0xB6, 0xDF, 0xB0, 0x05, 0xC6, 0x2F, 0x9B, 0xB2, 0xDC, 0x92, 0x63, 0x3F,
-    0x92, 0xDD, 0x85, 0xDB, 0x66, 0x8B, 0x29, 0xC4, 0xDD, 0xA1, 0x0B, 0xE6, 0xB8, 0x28, 0xAD, 0x98,
-    0x51, 0x59, 0x8E, 0xD0, 0x58, 0x08, 0x32, 0xC2, 0xE3, 0x83, 0x51, 0x94, 0x66, 0xEB, 0x2C, 0x7D,
-    0x2F, 0x6C, 0xC8, 0x32, 0x6C, 0x3C, 0xC7, 0xF8, 0x5F, 0xF1, 0x67, 0xDA, 0x31, 0x9A, 0xEE, 0x37,
-    0x44, 0xCD, 0x72, 0x88, 0x4C, 0xDD, 0xAA, 0x7F, 0x8B, 0x76, 0x36, 0xF2, 0x43, 0x5E, 0x01, 0x94,
-    0x3E, 0xA8, 0xB9, 0x7C, 0x77, 0x67, 0xC7, 0xF9, 0x5F, 0xB2, 0xA8, 0xB2, 0x85, 0x38, 0xFF, 0xC9,
-    0x82, 0x86, 0xFC, 0x9C, 0xF1, 0x2E, 0x27, 0x65, 0x54, 0x63, 0xCE, 0xF2, 0x80, 0x94, 0x9C, 0xC9,
-    0xDA, 0x89, 0x69, 0x01, 0x9D, 0x7B, 0x04, 0x24, 0xB6, 0x38, 0x64, 0xD5, 0xC3, 0x7A, 0x92, 0xE6,
-    0x4B, 0x1F, 0x63, 0x7F, 0x68, 0x6F, 0x1B, 0xFF, 0x12, 0x9F, 0xDF, 0xC8, 0x92, 0x91, 0xF9, 0x79,
-    0x90, 0x4F, 0xDE, 0xAC, 0x48, 0xAD, 0x7A, 0x3A, 0x4D, 0x3D, 0x90, 0xB0, 0xC1, 0xCA, 0x98, 0x0D,
-    0x31, 0x37, 0x47, 0x3A, 0x1E, 0x09, 0xD9, 0xBD, 0x62, 0x50, 0x9C, 0xCF, 0x9B, 0x83, 0xBB, 0x08,
-    0xD1, 0x0C, 0x23, 0x34, 0xF5, 0x61, 0x0B, 0xC6, 0x67, 0x15, 0xC3, 0xB3, 0x5A, 0x03, 0x2A, 0x8D,
-    0xAE, 0x34, 0x36, 0xD3, 0xB8, 0xCB, 0xC1, 0x7A, 0x05, 0xAE, 0x7E, 0xCF, 0xA0, 0x4C, 0xEF, 0xD2,
-    0x1E, 0x34, 0x22, 0xD3, 0x80, 0xCC, 0xF9, 0x8D, 0x1A, 0x8E, 0x69, 0x34, 0xE6, 0x82, 0x31, 0xC4,
-    0x62, 0xFE, 0x65, 0x59, 0xB2, 0xBE, 0x6C, 0xDD, 0xA9, 0xC9, 0x3F, 0xC1, 0xBD, 0x18, 0x1D, 0xD7,
-    0xC4, 0x5C, 0xB7, 0x71, 0x5C, 0x77, 0x16, 0xBE, 0x93, 0x85, 0xD3, 0x63, 0xB1, 0x95, 0x48, 0x47,
-    0xA1, 0x7D, 0xD3, 0x16, 0x08, 0xCE, 0x4A, 0x06, 0x60, 0x74, 0xFC, 0x18, 0x87, 0x31, 0x30, 0x53,
-    0x50, 0xAB, 0xAA, 0x3B, 0xD7, 0x89, 0x17, 0x23, 0xA8, 0x2B, 0x18, 0x91, 0x79, 0x1C, 0x88, 0xC6,
-    0x63, 0x08, 0xC2, 0xAE, 0x18, 0x51, 0x5F, 0x03, 0xF3, 0x28, 0x63, 0xF8, 0x9B, 0xE5, 0xC2, 0xD4,
-    0x15, 0xD5, 0x70, 0x75, 0x55, 0x1B, 0xE1, 0x40, 0xE5, 0x76, 0xEA, 0x67, 0x07, 0xE1, 0x87, 0x34,
-    0xD8, 0x4B, 0x34, 0x3A, 0xD3, 0xE0, 0x4C, 0x63, 0x33, 0x17, 0x9A, 0xA9, 0x3F, 0xEE, 0x02, 0x33,
-    0xC4, 0x65, 0x5C, 0x81, 0xF3, 0x4E, 0xD8, 0xE9, 0xD9, 0x93, 0xAD, 0x5B, 0x81, 0xF1, 0xFA, 0x0A,
-    0xA4, 0x06, 0x22, 0xB8, 0x7A, 0x5C, 0x80, 0x88, 0x8C, 0xF1, 0x18, 0xA3, 0x31, 0xC6, 0x62, 0x8C,
-    0xC4, 0x34, 0x0E, 0xDB, 0x5A, 0x0D, 0x99, 0xEC, 0x06, 0xD4, 0xCF, 0xA1, 0xF4, 0x87, 0x08, 0xB5,
-    0x0A, 0x7E, 0x5F, 0x5A, 0xD2, 0x03, 0x03, 0xB8, 0x97, 0x0E, 0x36, 0x7B, 0xBD, 0xDD, 0xDD, 0x4B,
-    0xD0, 0xC1, 0x46, 0x01, 0xFF, 0xD5, 0x4F, 0x37, 0xAF, 0x8C, 0x37, 0x84, 0xD2, 0x37, 0x00, 0xFF,
-    0xDD, 0x47, 0x6E, 0xAB, 0xA7, 0xAB, 0xDB, 0x6B, 0xD8, 0x4E, 0xEE, 0xBA, 0xC9, 0xD2, 0x17, 0x99,
-    0xDB, 0x32, 0x44, 0x2C, 0x4C, 0x18, 0x17, 0x0D, 0x9C, 0xA0, 0xC2, 0xB3, 0x7E, 0xCC, 0xE1, 0x3C,
-    0x57, 0x96, 0x9F, 0x37, 0xB1, 0x0C, 0x26, 0xFA, 0x0B, 0x18, 0x39, 0xFF, 0xBA, 0xA5, 0x77, 0xCD,
-    0xE7, 0xEF, 0x2E, 0x5E, 0x68, 0x05, 0x4F, 0xC5, 0x16, 0xFA, 0xED, 0x0C, 0x9E, 0x41, 0x54, 0xBA,
-    0x8D, 0x84, 0xAE, 0x16, 0x13, 0x55, 0xCF, 0x95, 0xE5, 0x39, 0xBD, 0x42, 0x66, 0x31, 0x9C, 0x57,
-    0xE5, 0xA9, 0x49, 0x49, 0x5E, 0x6C, 0x96, 0x6F, 0x4F, 0xC1, 0x1B, 0xA3, 0x57, 0x86, 0x97, 0xCC,
-    0x58, 0x3D, 0x7F, 0x96, 0xBF, 0xFC, 0x9E, 0x7A, 0x4B, 0xF0, 0x19, 0x1A, 0x80, 0xDE, 0x44, 0x17,
-    0x76, 0xEC, 0x64, 0x71, 0x38, 0x60, 0x5B, 0x1C, 0xD9, 0xDE, 0x96, 0x30, 0x02, 0xE9, 0x9A, 0x09,
-    0x14, 0x19, 0x9E, 0x91, 0x10, 0x88, 0x03, 0xB0, 0x88, 0xFA, 0x33, 0x16, 0x8C, 0xE8, 0xC1, 0x07,
-    0x38, 0x8E, 0xB8, 0x7F, 0x4A, 0xC5, 0x32, 0xE5, 0x58, 0xAC, 0x43, 0xB7, 0xF3, 0x5F, 0x78, 0x15,
-    0xEC, 0xA8, 0x21, 0xE3, 0xB0, 0xC1, 0xDE, 0xAC, 0xB4, 0x97, 0x6E, 0x1D, 0x54, 0x2F, 0x58, 0x76,
-    0x85, 0xCB, 0xE8, 0xA0, 0x55, 0xC0, 0x7F, 0xF5, 0x73, 0x03, 0xB2, 0xB4, 0xE2, 0xDC, 0x13, 0x98,
-    0x0F, 0x26, 0x59, 0xEE, 0x83, 0x53, 0xFC, 0x10, 0x3E, 0xC3, 0x97, 0x84, 0xCB, 0xC8, 0x11, 0xC5,
-    0x84, 0x58, 0xFF, 0x32, 0xB4, 0xF4, 0x45, 0xE1, 0xF3, 0xF6, 0xF6, 0x69, 0x17, 0x2B, 0xCE, 0x30,
-    0x4E, 0xE6, 0xE4, 0x08, 0xBC, 0xC9, 0xF5, 0xDE, 0x17, 0x3E, 0xCB, 0x40, 0x4E, 0x69, 0xBA, 0x45,
-    0xE3, 0xBB, 0x4D, 0xBC, 0xF9, 0xE1, 0xBC, 0x2B, 0xCD, 0xBA, 0x6B, 0xC0, 0xA4, 0x38, 0x71, 0x38,
-    0xBB, 0x6D, 0x2F, 0xA2, 0xC7, 0xFC, 0x23, 0xF5, 0x87, 0xED, 0xBB, 0xC4, 0xBE, 0xD5, 0x34, 0xD7,
-    0xCC, 0xE1, 0xB9, 0xC4, 0x5D, 0x37, 0xB7, 0x53, 0x91, 0x80, 0x47, 0x1B, 0x13, 0xB5, 0x8A, 0x93,
-    0x5A, 0x31, 0xB2, 0x80, 0xB7, 0x65, 0x77, 0x62, 0x30, 0xAC, 0x59, 0x7D, 0x60, 0xDF, 0xE1, 0x99,
-    0xC3, 0x01, 0x38, 0x4F, 0x41, 0x2A, 0x3B, 0x50, 0x1F, 0xB1, 0x5A, 0x83, 0x20, 0xCE, 0x1C, 0x96,
-    0x38, 0xC3, 0xD3, 0xF1, 0xC9, 0xEA, 0x5F, 0xF1, 0xF6, 0xEE, 0xC5, 0x23, 0xEF, 0x2F, 0x9B, 0xAD,
-    0xF7, 0xF8, 0xBC, 0x12, 0x71, 0x80, 0xB0, 0xF7, 0x6B, 0x3B, 0x16, 0x6B, 0x20, 0xC3, 0x5B, 0x81,
-    0x6D, 0x22, 0x55, 0xAA, 0x62, 0x36, 0x70, 0x82, 0x0B, 0x1F, 0x3D, 0xBC, 0x42, 0x0C, 0x99, 0x40,
-    0x5E, 0xE4, 0x92, 0xE0, 0x44, 0x1C, 0x79, 0xE0, 0xAC, 0xD1, 0xFC, 0x17, 0xCC, 0xD9, 0x82, 0x78,
-    0x46, 0xAD, 0x86, 0x94, 0x2A, 0xF3, 0x6D, 0x03, 0x41, 0x0D, 0x6F, 0x30, 0x09, 0xFD, 0x39, 0x84,
-    0x2E, 0xDC, 0x9D, 0xA9, 0xF0, 0x5B, 0x31, 0x42, 0xB7, 0x68, 0x83, 0xBD, 0xD3, 0xCB, 0x61, 0xEE,
-    0xE0, 0xBB, 0x80, 0x25, 0x9B, 0x84, 0xD0, 0x69, 0xE8, 0x1D, 0xEF, 0x06, 0x52, 0x1A, 0x5C, 0x42,
-    0xCB, 0x48, 0x3E, 0x26, 0x4C, 0x1A, 0x85, 0x08, 0x36, 0x61, 0xED, 0x36, 0x20, 0xD6, 0xBB, 0x40,
-    0xEF, 0x9A, 0xBD, 0x15, 0xB7, 0xD0, 0xD5, 0xA8, 0x03, 0x0C, 0x2D, 0xBE, 0x11, 0xFB, 0xEB, 0x21,
-    0x79, 0x3F, 0x5C, 0x43, 0xFC, 0x35, 0x86, 0x48, 0x96, 0x89, 0xE6, 0x3B, 0x60, 0xDB, 0x29, 0xE6,
-    0x8B, 0x21, 0xB0, 0x3E, 0x91, 0x39, 0xD9, 0xAC, 0x62, 0xBA, 0x36, 0xB6, 0xD7, 0x45, 0xE7, 0x90,
-    0xCA, 0x15, 0xC9, 0xE4, 0x15, 0xD3, 0xBC, 0x4C, 0xFA, 0x32, 0x05, 0xAC, 0x14, 0xBE, 0x63, 0xE8,
-    0x93, 0xF4, 0x3E, 0xB3, 0xCA, 0xB6, 0x92, 0x99, 0x81, 0x53, 0xBD, 0x5C, 0xB5, 0x53, 0xD1, 0xA9,
-    0x12, 0x30, 0x73, 0x76, 0x59, 0xC1, 0xAB, 0xA8, 0x45, 0x44, 0x77, 0xAF, 0x43, 0xB5, 0x85, 0x01,
-    0x0C, 0x17, 0x35, 0x72, 0xD4, 0xA2, 0x8A, 0x8B, 0x37, 0x7B, 0xC4, 0x9B, 0xAE, 0x8A, 0x92, 0xD9,
-    0xFB, 0xD7, 0x4E, 0x9E, 0x84, 0x99, 0xB2, 0x8C, 0xCC, 0xFD, 0x98, 0x49, 0x08, 0xA5, 0x4C, 0x63,
-    0xA8, 0x68, 0x2A, 0x3A, 0xE3, 0x21, 0x1C, 0x04, 0x9C, 0x5B, 0x59, 0xA0, 0xA9, 0xD6, 0x60, 0x1E,
-    0xC4, 0x4C, 0xFF, 0x92, 0xCC, 0xC3, 0x25, 0x29, 0x7E, 0x8B, 0x9A, 0x0A, 0x56, 0x65, 0x88, 0xB0,
-    0x79, 0x19, 0x6F, 0x4E, 0xFC, 0x9E, 0x4D, 0xFC, 0x8E, 0xEC, 0xFB, 0xE0, 0xB7, 0xB1, 0xCA, 0xD1,
-    0x4D, 0x7E, 0xAF, 0x32, 0x3D, 0x71, 0x4C, 0x87, 0x70, 0x22, 0x88, 0x89, 0x1D, 0xB0, 0x2B, 0x31,
-    0xA1, 0x02, 0xB6, 0x52, 0x72, 0x3E, 0xA7, 0x4F, 0x5B, 0x7E, 0x5F, 0x86, 0x5D, 0x44, 0x6A, 0x4A,
-    0x46, 0x7E, 0xFB, 0xF9, 0xB0, 0xD8, 0x73, 0x30, 0x27, 0xDF, 0xC4, 0xAD, 0x80, 0xBC, 0x86, 0x2E,
-    0x95, 0xC8, 0x43, 0xA6, 0x30, 0xA1, 0x46, 0x03, 0xE4, 0x02, 0x29, 0xAE, 0x8F, 0x64, 0x82, 0xF6,
-    0x63, 0xA4, 0xED, 0x3E, 0x95, 0xB5, 0x65, 0xBF, 0x84, 0x65, 0x85, 0x09, 0x1F, 0xA5, 0x22, 0x3F,
-    0xFC, 0x17, 0x31, 0x7A, 0x21, 0xCF, 0x90, 0xCD, 0xBB, 0x19, 0xEF, 0x65, 0x2F, 0xC8, 0xD7, 0x4A,
-    0xA7, 0x05, 0x2E, 0xA8, 0xDC, 0x83, 0x4C, 0xD2, 0x21, 0xCF, 0x01, 0x67, 0x2B, 0x42, 0x3E, 0xA0,
-    0x81, 0xC5, 0x9F, 0x73, 0xC9, 0x7B, 0x9A, 0xDE, 0x5A, 0xCD, 0x78, 0x1C, 0x49, 0x97, 0xD5, 0x8F,
-    0x3D, 0x42, 0x59, 0xBD, 0x59, 0x05, 0x37, 0x43, 0x04, 0x80, 0xAC, 0x27, 0x98, 0x2F, 0x10, 0x5E,
-    0x60, 0xF6, 0x05, 0x6B, 0x81, 0x7F, 0xC5, 0xC3, 0xB2, 0x2F, 0x7B, 0x2A, 0xE0, 0x40, 0x08, 0xBE,
-    0x64, 0xD4, 0xC9, 0xAC, 0xE5, 0x95, 0x15, 0x76, 0x8F, 0xAC, 0x82, 0x61, 0xC9, 0x2A, 0xE4, 0xC6,
-    0x33, 0xDA, 0x87, 0xB1, 0x7F, 0x31, 0x1F, 0x07, 0x35, 0x37, 0x32, 0xA7, 0xBB, 0x1B, 0x72, 0x87,
-    0x8E, 0xA9, 0x98, 0x09, 0x99, 0x98, 0xDC, 0x24, 0x1C, 0x96, 0x29, 0x63, 0xFF, 0xCA, 0xB3, 0x4F,
-    0x91, 0x78, 0xB4, 0xCC, 0x60, 0x56, 0x00, 0x01, 0x85, 0xF0, 0x0D, 0xC2, 0xAF, 0x10, 0x1C, 0xE8,
-    0xE6, 0x81, 0x01, 0x9E, 0x4B, 0xC7, 0xCD, 0x6F, 0xCE, 0x8D, 0x41, 0xE1, 0xCC, 0x6E, 0xA6, 0x4E,
-    0x0E, 0x1E, 0xAB, 0x35, 0x0F, 0x5B, 0xAE, 0xB0, 0x7A, 0xB1, 0x64, 0x75, 0x3C, 0x2C, 0xF3, 0xCD,
-    0xDE, 0x55, 0x01, 0x74, 0x34, 0x78, 0xFF, 0x12, 0xEC, 0x4B, 0x9A, 0x6A, 0x92, 0x01, 0x1D, 0xC7,
-    0xB0, 0x1A, 0x65, 0x10, 0xAC, 0xC9, 0x80, 0x06, 0xCE, 0xEF, 0x0D, 0x0D, 0x5C, 0x3F, 0x19, 0xB8,
-    0xB5, 0x84, 0x9A, 0x73, 0x05, 0x6D, 0x19, 0xAD, 0x81, 0x62, 0x6B, 0xFB, 0x0C, 0x8F, 0x4C, 0x74,
-    0x2E, 0xDE, 0xF2, 0xD5, 0x4F, 0x1C, 0x73, 0xCF, 0x19, 0xD8, 0xC5, 0xB5, 0x96, 0xC1, 0x64, 0x1C,
-    0xBF, 0x0E, 0xB3, 0xE9, 0xD9, 0x7A, 0x0C, 0x5B, 0xE0, 0xE3, 0x29, 0x48, 0xEA, 0x1F, 0xE3, 0x87,
-    0x64, 0xC8, 0x65, 0xE6, 0xAE, 0x3A, 0x3E, 0x80, 0x25, 0xD5, 0xBD, 0x56, 0xF8, 0x77, 0x0F, 0xB0,
-    0xC2, 0x5A, 0x1D, 0x59, 0x1B, 0xE4, 0x61, 0x54, 0x82, 0x5D, 0x01, 0x81, 0x79, 0x01, 0x5B, 0xB9,
-    0x99, 0x6B, 0xA1, 0x9B, 0xA9, 0x02, 0xF4, 0x92, 0xB1, 0x62, 0x02, 0x73, 0x74, 0x64, 0xC7, 0xF2,
-    0x8C, 0x40, 0x39, 0x86, 0x90, 0xC9, 0x3A, 0xC8, 0xEA, 0xEF, 0xA1, 0x9B, 0x13, 0xD8, 0x3C, 0xC6,
-    0x91, 0xC2, 0xBD, 0xE0, 0xAE, 0x37, 0xA4, 0xE6, 0xE1, 0xD9, 0xDC, 0xF2, 0xA9, 0x37, 0x1C, 0x1E,
-    0x51, 0x5D, 0x5D, 0x30, 0xF5, 0x9F, 0xDF, 0xFA, 0xFF, 0xF9, 0x83, 0x74, 0x22, 0xEF, 0xA6, 0x53,
-    0x7A, 0xB1, 0x9F, 0x28, 0xA7, 0x35, 0xEE, 0xAC, 0x01, 0xA8, 0x6F, 0xD2, 0x59, 0x03, 0xA7, 0x6A,
-    0x59, 0xF5, 0xE8, 0xC4, 0x0B, 0x78, 0xD6, 0x00, 0x76, 0x8C, 0x89, 0x55, 0x2A, 0x87, 0xE6, 0x46,
-    0x34, 0xE3, 0x13, 0xD5, 0x4B, 0xEB, 0x7C, 0xD0, 0x1D, 0x4D, 0x61, 0xFD, 0xEE, 0x58, 0xE4, 0x74,
-    0x07, 0x17, 0xC4, 0x0E, 0x0D, 0xD3, 0x7E, 0x73, 0x70, 0x1C, 0x4D, 0x48, 0xAC, 0xD2, 0x01, 0x8E,
-    0x03, 0xDD, 0x03, 0xA6, 0x3F, 0xB8, 0x8E, 0x6F, 0x6E, 0xE7, 0xC4, 0xD4, 0xDB, 0xFB, 0xE0, 0xDB,
-    0xBB, 0xF6, 0xBE, 0xF7, 0xDD, 0x0F, 0x7B, 0x8A, 0x45, 0x5D, 0x17, 0x88, 0x66, 0x31, 0x62, 0xC1,
-    0xA1, 0x3B, 0xE5, 0x31, 0xC3, 0xE0, 0x79, 0x30, 0x8C, 0x86, 0x7D, 0x25, 0x97, 0x34, 0x78, 0x32,
-    0x5D, 0x1B, 0x88, 0x3A, 0xD9, 0x1D, 0xCB, 0x25, 0x2E, 0x1D, 0x0D, 0xF0, 0x5E, 0x5B, 0x78, 0xAF,
-    0x08, 0x96, 0x50, 0x2C, 0xA7, 0x0B, 0x0B, 0x40, 0x2A, 0xA3, 0x5B, 0x0B, 0x00, 0xFF, 0xD9, 0xC7,
-    0xA3, 0xF9, 0xDC, 0x10, 0x0F, 0x4D, 0x7A, 0x8C, 0x49, 0x24, 0xF2, 0x67, 0x8C, 0x5E, 0xED, 0x32,
-    0x9C, 0x68, 0x4D, 0xE7, 0x89, 0x2E, 0x42, 0xF9, 0xC6, 0x5C, 0xD8, 0x43, 0x81, 0x39, 0x7A, 0x65,
-    0xE9, 0x4F, 0xB8, 0xB3, 0x1B, 0x79, 0xB9, 0x54, 0x6E, 0xBF, 0x5D, 0x57, 0x6D, 0x3D, 0x02, 0xA0,
-    0x07, 0x00, 0xB4, 0xFC, 0xAF, 0xC5, 0x7F, 0x2D, 0xFD, 0x6B, 0xE1, 0x5F, 0xCB, 0xFE, 0x5A, 0xF4,
-    0xD7, 0x92, 0xBF, 0x16, 0xFC, 0xB5, 0xDC, 0xAF, 0xC5, 0x7E, 0x2D, 0xF5, 0x6B, 0xA1, 0x5F, 0xCB,
-    0xFC, 0x5A, 0xE4, 0xD7, 0x12, 0xBF, 0x16, 0xF8, 0xB5, 0xBC, 0xAF, 0xC5, 0x7D, 0x2D, 0xED, 0x6B,
-    0x61, 0x5F, 0xCB, 0xFA, 0x5A, 0xD4, 0x37, 0xBB, 0x17, 0xC6, 0x9D, 0x94, 0xAB, 0x49, 0xAB, 0x0E,
-    0x9C, 0x47, 0x5C, 0xAC, 0x14, 0xE1, 0x59, 0x82, 0x67, 0x01, 0x9E, 0x19, 0x07, 0x16, 0xDF, 0x59,
-    0x7A, 0x67, 0xC5, 0x5D, 0x01, 0x8A, 0xEE, 0xAC, 0x99, 0x3F, 0x12, 0x30, 0xDC, 0x1F, 0x47, 0xC3,
-    0x10, 0x36, 0xCB, 0x00, 0x43, 0x93, 0x58, 0x9A, 0xA6, 0x1A, 0xB0, 0xEE, 0xFC, 0xFA, 0xC4, 0x04,
-    0xBD, 0xF6, 0x83, 0x8D, 0xF4, 0x95, 0xAF, 0xE9, 0x2B, 0xC2, 0x79, 0xBF, 0x96, 0xBE, 0x2A, 0xEF,
-    0x9B, 0xBE, 0x42, 0xE2, 0x6A, 0x4C, 0x5F, 0xDD, 0xBE, 0x3E, 0x26, 0xAE, 0x66, 0xCB, 0xC4, 0xD5,
-    0x82, 0xE9, 0x09, 0x97, 0xB8, 0x8A, 0x1F, 0x90, 0xB8, 0x1A, 0xD3, 0xD1, 0xF4, 0x5F, 0xCA, 0xD5,
-    0x92, 0x86, 0x77, 0x99, 0x96, 0x2A, 0x75, 0x55, 0xF3, 0x64, 0x2E, 0xBF, 0x9E, 0x00, 0x88, 0x4F,
-    0x16, 0xCE, 0xD5, 0x9E, 0x0F, 0x8F, 0x93, 0xCC, 0x0A, 0x1F, 0x3F, 0x69, 0x78, 0xDC, 0x65, 0x2F,
-    0x35, 0xFD, 0x4E, 0x3F, 0x81, 0x25, 0x27, 0x37, 0x8E, 0x70, 0x3C, 0xC6, 0x52, 0x98, 0x6F, 0x62,
-    0x72, 0xCB, 0xF8, 0xBB, 0x66, 0xF5, 0xBC, 0x89, 0xAB, 0x3F, 0xC8, 0xC0, 0x4B, 0xB3, 0x52, 0x82,
-    0xD8, 0x5C, 0xB5, 0x07, 0x3F, 0xD9, 0xA5, 0x56, 0x48, 0xC3, 0x5F, 0xF6, 0xA1, 0x67, 0x96, 0xF4,
-    0xA8, 0xAC, 0xA6, 0x7E, 0xC7, 0xCF, 0x8C, 0x21, 0xDB, 0xEF, 0x4B, 0x0A, 0xAF, 0x50, 0x1E, 0x6F,
-    0x84, 0x6C, 0x33, 0x86, 0x6C, 0xA1, 0x45, 0xC8, 0x16, 0x5B, 0x84, 0x6C, 0xC9, 0x1F, 0x10, 0xB2,
-    0x59, 0x84, 0x66, 0x7E, 0x87, 0x60, 0x6D, 0xD6, 0x02, 0x86, 0x35, 0xBE, 0x89, 0x0B, 0xC0, 0x64,
-    0x81, 0x90, 0xCD, 0x22, 0x64, 0x1B, 0x70, 0xA2, 0x3B, 0x92, 0x51, 0x22, 0x64, 0xAB, 0xEF, 0x1B,
-    0xB2, 0xF9, 0x5A, 0x45, 0xB9, 0x8B, 0x90, 0xCD, 0xAB, 0x57, 0x4A, 0x07, 0x3A, 0x95, 0x69, 0x35,
-    0x91, 0x43, 0x3C, 0x2B, 0x14, 0x4E, 0x71, 0xA7, 0x77, 0xF6, 0xBB, 0x9A, 0x1D, 0xF0, 0xC7, 0x95,
-    0x6A, 0xB0, 0xCD, 0x16, 0x49, 0x0B, 0xA7, 0xBF, 0x96, 0xE0, 0x48, 0x42, 0x33, 0x11, 0x7F, 0x95,
-    0xC9, 0x4A, 0xAD, 0x06, 0x89, 0xC9, 0xFE, 0xDE, 0x09, 0xF8, 0xA7, 0x28, 0x46, 0x82, 0x04, 0x5B,
-    0x82, 0x72, 0x49, 0x2C, 0xBA, 0x28, 0x81, 0xD9, 0x75, 0x17, 0x98, 0xCD, 0x31, 0x9C, 0x10, 0xF6,
-    0xD7, 0x2F, 0xC6, 0xFC, 0xA1, 0x7F, 0xF5, 0xE8, 0x25, 0x70, 0x92, 0xC7, 0x40, 0xED, 0xCF, 0x30,
-    0x88, 0xE4, 0x4F, 0x3D, 0x87, 0x92, 0xD1, 0x0E, 0x45, 0xE9, 0x81, 0x3E, 0xC0, 0x73, 0xEE, 0xD7,
-    0x12, 0xDF, 0x66, 0x9F, 0xE1, 0x24, 0x78, 0x0D, 0xB5, 0x45, 0x21, 0xC8, 0xEB, 0xC0, 0xC7, 0x77,
-    0xFC, 0x7A, 0x3F, 0x73, 0xE8, 0x47, 0x79, 0x3A, 0x84, 0x49, 0x1D, 0xD6, 0x9F, 0x94, 0xD1, 0x12,
-    0x9C, 0x23, 0xF2, 0x8D, 0xCD, 0xAC, 0x3A, 0xD0, 0x6C, 0x34, 0x87, 0xAE, 0x32, 0x14, 0x29, 0xD5,
-    0x49, 0xF0, 0xC9, 0xA8, 0xC6, 0x74, 0x46, 0x4C, 0xF9, 0x3B, 0xFB, 0x78, 0x0E, 0x4A, 0xA4, 0x09,
-    0x61, 0x42, 0x96, 0x10, 0x25, 0x25, 0xB9, 0x14, 0x24, 0x7D, 0xA9, 0xB5, 0xD6, 0x6F, 0x9F, 0xC6,
-    0x06, 0xB7, 0xD6, 0xF0, 0x9D, 0xC6, 0x0A, 0xDA, 0x86, 0xDD, 0x2B, 0xF7, 0x5C, 0x33, 0xB6, 0x8D,
-    0xFE, 0xCE, 0xBD, 0x76, 0xC5, 0x69, 0x53, 0x3C, 0x69, 0x93, 0xBF, 0xA1, 0x4D, 0xDE, 0x1F, 0x97,
-    0x29, 0x93, 0x4E, 0x3D, 0xF8, 0x50, 0x9C, 0xB5, 0x34, 0x6E, 0xF5, 0xB8, 0x6F, 0x46, 0xB0, 0x51,
-    0x5C, 0x2C, 0xB3, 0x65, 0x08, 0xDF, 0xA8, 0x3F, 0xEF, 0xC9, 0xD3, 0x2F, 0xE6, 0x29, 0x24, 0x95,
-    0x7A, 0xCE, 0x1F, 0xEF, 0x5D, 0x85, 0xF5, 0xDC, 0x05, 0x1E, 0x84, 0x95, 0x21, 0xA5, 0x31, 0x02,
-    0xC8, 0x34, 0x2C, 0xDE, 0x81, 0x28, 0x46, 0x07, 0x4B, 0x36, 0xA8, 0xB5, 0x26, 0x1B, 0x0D, 0x5F,
-    0x1F, 0x59, 0x6D, 0xF8, 0xCE, 0xD2, 0x93, 0xD5, 0x26, 0x9B, 0xCD, 0x3D, 0xD7, 0x8C, 0x6D, 0xA3,
-    0xBF, 0xBD, 0x68, 0xC3, 0x3E, 0xB0, 0xE1, 0xF8, 0xBB, 0x57, 0x4D, 0xF2, 0x1F, 0x09, 0x60, 0x9A,
-    0xBC, 0x98, 0x75, 0x71, 0x69, 0x86, 0xA0, 0x36, 0xF1, 0xB2, 0x36, 0x26, 0x76, 0xBD, 0x65, 0x2E,
-    0x0B, 0x6D, 0xC7, 0x56, 0xDC, 0x10, 0x9E, 0xA4, 0xC5, 0x0C, 0x6F, 0xBB, 0xB1, 0x41, 0x1B, 0x56,
-    0xB5, 0xD1, 0xDF, 0xD0, 0x46, 0xE6, 0x1A, 0x9E, 0x46, 0x3B, 0x97, 0xCA, 0x82, 0x6D, 0xE5, 0xF1,
-    0x7C, 0x07, 0x21, 0xFD, 0xD0, 0x44, 0x8B, 0x1B, 0x26, 0x9C, 0x42, 0x46, 0xF7, 0x3D, 0xDB, 0x31,
-    0xDB, 0x3E, 0x40, 0x86, 0x7B, 0x6F, 0x38, 0xB5, 0x3A, 0xF6, 0xC7, 0x92, 0xD7, 0x43, 0xD4, 0xED,
-    0x69, 0x9D, 0xFE, 0xF3, 0x76, 0x0F, 0xC3, 0x33, 0x63, 0xF6, 0xCC, 0x64, 0x1F, 0x0F, 0xAC, 0xDE,
-    0xD2, 0x93, 0xD5, 0x02, 0x79, 0x1B, 0x14, 0x2F, 0xC0, 0xE9, 0x3F, 0x68, 0x25, 0xD4, 0xD2, 0x55,
-    0x10, 0xA8, 0x98, 0xA6, 0x0F, 0x50, 0xE8, 0x98, 0x54, 0x73, 0x3F, 0x4E, 0xFF, 0x19, 0x32, 0x53,
-    0xF8, 0x92, 0x72, 0xEF, 0x28, 0xB9, 0xEF, 0x60, 0xA6, 0xA5, 0x8F, 0x39, 0x2E, 0x4C, 0xF3, 0x02,
-    0x30, 0x53, 0xD3, 0xD3, 0x9C, 0x14, 0x16, 0x33, 0x5F, 0x39, 0x13, 0xC7, 0xF4, 0xBC, 0x38, 0x1E,
-    0xE6, 0xC4, 0xFE, 0x31, 0x73, 0x2F, 0x76, 0x7F, 0x7A, 0xA3, 0x2A, 0x81, 0x4D, 0x64, 0x72, 0x58,
-    0x93, 0xAF, 0xF5, 0x31, 0x18, 0x3C, 0x8F, 0x63, 0x59, 0x07, 0x1E, 0x7E, 0x08, 0x56, 0xF3, 0xB3,
-    0x09, 0x04, 0x95, 0x40, 0x4E, 0x1C, 0x57, 0x52, 0x33, 0x39, 0xC7, 0x5C, 0x1D, 0x53, 0x77, 0x3E,
-    0x6D, 0x27, 0x2B, 0xA4, 0x59, 0x83, 0xD1, 0x77, 0x4C, 0x00, 0x62, 0x5F, 0x4C, 0xBE, 0x80, 0x25,
-    0xCA, 0x17, 0xF3, 0x56, 0xF6, 0xC5, 0x3E, 0xAC, 0xCD, 0xF9, 0x69, 0x68, 0x6F, 0xF9, 0x7D, 0xD0,
-    0xFB, 0x43, 0xDC, 0xFB, 0x36, 0x47, 0xA1, 0x56, 0x5A, 0xFF, 0x2D, 0x9F, 0x1C, 0x2B, 0x98, 0xE1,
-    0xF3, 0x99, 0xE7, 0x79, 0x78, 0x1B, 0x0D, 0x3F, 0xF7, 0x04, 0x3A, 0xFF, 0x62, 0xF8, 0x6B, 0x35,
-    0xFC, 0xBF, 0x3A, 0x00, 0x7C, 0x80, 0x97, 0xE5, 0xAF, 0x59, 0xAA, 0xA0, 0x3C, 0x61, 0x66, 0xE5,
-    0x78, 0x48, 0x33, 0x96, 0x70, 0x3B, 0xFE, 0x42, 0xE2, 0xD8, 0xAF, 0x45, 0x3D, 0x2C, 0x5A, 0x99,
-    0xA2, 0x18, 0x42, 0xE5, 0x6C, 0x35, 0xD1, 0xBF, 0x97, 0x76, 0xF8, 0xF2, 0xB9, 0xC5, 0x78, 0x9E,
-    0x7D, 0xD6, 0x33, 0xCB, 0x61, 0xE7, 0x4C, 0x06, 0xBF, 0x0B, 0xDB, 0x15, 0x14, 0xE7, 0x5F, 0x84,
-    0xA3, 0xB5, 0xBB, 0x3F, 0x15, 0xAD, 0xCE, 0x61, 0x67, 0x63, 0x98, 0xD9, 0x00, 0x87, 0x91, 0x44,
-    0xAB, 0x65, 0x4E, 0x1F, 0xCC, 0xF6, 0xF5, 0xB0, 0xE7, 0x39, 0x06, 0xC4, 0xCC, 0x6D, 0x47, 0xE3,
-    0xD1, 0x5A, 0x51, 0xB6, 0x0F, 0x19, 0x82, 0xDF, 0x30, 0x1B, 0x66, 0xFF, 0x80, 0x1E, 0xED, 0xE4,
-    0xD2, 0xC8, 0xE4, 0x5B, 0xCF, 0x2D, 0x8D, 0x16, 0x05, 0xCF, 0x7B, 0x96, 0xC6, 0xBE, 0x9C, 0x53,
-    0xDE, 0xB1, 0x58, 0x07, 0x7A, 0x88, 0x7F, 0x00, 0x4F, 0x3B, 0xE4, 0xAD, 0xDB, 0xCD, 0x42, 0x11,
-    0x2B, 0x60, 0xB1, 0x06, 0x23, 0x2D, 0x77, 0x89, 0x14, 0x76, 0xB6, 0x1E, 0xDF, 0xE7, 0xE0, 0xEC,
-    0x22, 0x3B, 0xBE, 0xF5, 0x23, 0xFC, 0x38, 0x05, 0x70, 0x3E, 0x95, 0x85, 0x98, 0xC1, 0xD8, 0x66,
-    0x96, 0x61, 0xB8, 0x58, 0x92, 0x63, 0x8C, 0x6C, 0x96, 0x47, 0xAB, 0x78, 0x66, 0x97, 0x99, 0x94,
-    0xB0, 0x1E, 0xC3, 0x6F, 0x16, 0x22, 0x8F, 0xB8, 0x53, 0x78, 0x30, 0xF2, 0x91, 0x16, 0x08, 0xCA,
-    0xAC, 0x0A, 0x70, 0xBA, 0x8E, 0xB1, 0x7B, 0xC2, 0x6D, 0x00, 0x6C, 0xA7, 0xBF, 0x57, 0xEA, 0xBB,
-    0x33, 0x48, 0xD5, 0xC4, 0xCD, 0x2F, 0xA4, 0x65, 0x17, 0xF3, 0x1A, 0x4F, 0x44, 0xB9, 0x8E, 0x9E,
-    0xE0, 0xF8, 0xF2, 0x2E, 0x0E, 0x6F, 0x30, 0x06, 0x2A, 0x34, 0x9D, 0x9E, 0xE9, 0x4B, 0x70, 0x70,
-    0x2B, 0x1B, 0x80, 0x76, 0x09, 0x8E, 0xBC, 0x69, 0x2F, 0x9E, 0xD6, 0xF4, 0xC0, 0xB3, 0x03, 0xAB,
-    0x09, 0xCF, 0xD4, 0xA5, 0x55, 0x98, 0x2B, 0xD7, 0x63, 0x5C, 0xCD, 0x6A, 0x86, 0x17, 0x63, 0xCD,
-    0x71, 0x21, 0xAE, 0x63, 0x72, 0x05, 0xC2, 0x65, 0xFB, 0x91, 0xDD, 0x5D, 0xEC, 0xCD, 0x3F, 0x85,
-    0x89, 0xBE, 0x5B, 0x92, 0x67, 0x48, 0x21, 0xF3, 0x58, 0x85, 0x7B, 0x40, 0xD0, 0xA9, 0x30, 0x20,
-    0x0B, 0x88, 0x02, 0x69, 0xCD, 0x23, 0x4B, 0x65, 0xA9, 0xA0, 0x22, 0x14, 0xA9, 0xDA, 0xE0, 0x22,
-    0x92, 0x6E, 0xAA, 0xEF, 0x18, 0xB3, 0x74, 0xC7, 0xF5, 0xB4, 0xB2, 0xDC, 0x7A, 0x4C, 0xD4, 0xE5,
-    0x90, 0x26, 0x8B, 0x3B, 0x3A, 0x0A, 0xA9, 0xC9, 0xFE, 0x21, 0x8F, 0xFA, 0xC1, 0x4A, 0x29, 0x92,
-    0xF5, 0x52, 0xBE, 0x8C, 0xAE, 0x95, 0x53, 0xBE, 0x42, 0x5A, 0xBB, 0x57, 0x0E, 0x02, 0xCD, 0x71,
-    0x43, 0xF1, 0x3A, 0xE9, 0x0D, 0x87, 0x16, 0xB4, 0xFC, 0x5A, 0xB9, 0x57, 0x5A, 0x7E, 0xC9, 0x51,
-    0xBD, 0x7C, 0x8A, 0x2A, 0x10, 0x6B, 0x41, 0xA7, 0x09, 0xFF, 0x95, 0xB7, 0x5B, 0x8C, 0xC9, 0x02,
-    0x17, 0x9B, 0xC5, 0x2D, 0xEB, 0xB4, 0x3B, 0x38, 0x21, 0xC2, 0xFC, 0x6E, 0x6D, 0x86, 0x9D, 0xD6,
-    0xA4, 0xF8, 0x0D, 0xEF, 0x50, 0x21, 0x09, 0x85, 0x86, 0x32, 0x0B, 0x82, 0xDB, 0x1C, 0x3A, 0x55,
-    0x1F, 0xC2, 0x41, 0x4E, 0xCE, 0x55, 0x9E, 0x7B, 0x47, 0x1F, 0x86, 0xF7, 0x35, 0x16, 0x22, 0x9A,
-    0x3C, 0x75, 0xD6, 0x50, 0xDF, 0xD7, 0x60, 0xA5, 0xBF, 0x58, 0x3F, 0x95, 0x32, 0xEF, 0xE1, 0x1F,
-    0x0F, 0x7B, 0x01, 0x37, 0xB7, 0xCF, 0x0C, 0xF0, 0x6A, 0x56, 0xC1, 0xED, 0xDD, 0xEB, 0xC3, 0x9E,
-    0x3B, 0x98, 0xC0, 0x23, 0x9F, 0x4A, 0xD1, 0xE4, 0xFB, 0xC3, 0xE0, 0xAB, 0x58, 0xEC, 0x9F, 0xD1,
-    0xDD, 0xFB, 0x1C, 0xFD, 0x69, 0xA6, 0x91, 0x59, 0x6D, 0xC3, 0xB4, 0xB6, 0x61, 0x4A, 0x7B, 0x84,
-    0xC8, 0x6C, 0x8F, 0xF0, 0x71, 0xFE, 0xFE, 0x07, 0x9D, 0x56, 0x3D, 0x6C, 0xE4, 0xC6, 0x15, 0xFE,
-    0x48, 0xDE, 0x8A, 0xF6, 0x11, 0xBE, 0x09, 0x90, 0x15, 0x0C, 0xFB, 0x1C, 0xF3, 0x8A, 0x14, 0xB1,
-    0x0A, 0xB3, 0x71, 0x71, 0xC5, 0xED, 0x0E, 0xCF, 0x80, 0x53, 0xC4, 0x80, 0xB1, 0x80, 0xB5, 0x4D,
-    0x52, 0x24, 0x40, 0x2A, 0xEB, 0x90, 0x28, 0xC5, 0x15, 0x2A, 0x24, 0x91, 0x76, 0x93, 0x22, 0x40,
-    0xBC, 0x45, 0xE0, 0x7A, 0x0B, 0x15, 0x97, 0x75, 0x71, 0x71, 0xE0, 0x42, 0x01, 0xB4, 0xE2, 0x04,
-    0x4E, 0x8A, 0x74, 0x0C, 0x90, 0x3E, 0x6C, 0x8C, 0xC0, 0x70, 0x21, 0x02, 0xA1, 0x13, 0xEA, 0x40,
-    0xEE, 0xCB, 0x37, 0xE4, 0x4A, 0x27, 0x25, 0x67, 0x18, 0xC8, 0xFC, 0x70, 0x38, 0xC3, 0x37, 0xF3,
-    0xFE, 0xBE, 0xF7, 0x86, 0x3B, 0x73, 0xE8, 0x1A, 0xAA, 0x85, 0x2B, 0x40, 0x62, 0xA0, 0x0A, 0x6C,
-    0xCD, 0x21, 0x85, 0x27, 0x71, 0xD0, 0x22, 0x2C, 0xA1, 0x53, 0x60, 0x67, 0x06, 0x47, 0x4A, 0x78,
-    0xD2, 0x40, 0xFD, 0x4B, 0xA0, 0xF3, 0x2C, 0x3D, 0x45, 0x98, 0x83, 0xC5, 0x5B, 0x39, 0x95, 0x92,
-    0x2F, 0xCB, 0x48, 0xA4, 0xD0, 0x6F, 0x8B, 0x19, 0xE1, 0x67, 0x98, 0x4E, 0xA7, 0x99, 0xAC, 0xD8,
-    0x12, 0x69, 0x2D, 0x8D, 0x88, 0x94, 0x17, 0x9D, 0xDF, 0x26, 0x5B, 0x70, 0xE7, 0x1A, 0x41, 0x11,
-    0x3D, 0x11, 0xA3, 0x44, 0x52, 0x4F, 0x56, 0xC0, 0xEE, 0x1C, 0x03, 0x24, 0x79, 0x56, 0x64, 0x45,
-    0x92, 0x0F, 0xEC, 0xB6, 0x04, 0xAD, 0x7C, 0x20, 0x6C, 0x89, 0xD3, 0xDE, 0xC0, 0xB7, 0x76, 0x52,
-    0xA9, 0xA5, 0x79, 0xB3, 0x75, 0x5A, 0xBF, 0x09, 0x8B, 0x90, 0x62, 0xF9, 0x35, 0x22, 0x4A, 0xB3,
-    0x9B, 0xEE, 0x2B, 0xC3, 0xC6, 0x17, 0x4E, 0x37, 0x2A, 0x60, 0xF1, 0xFD, 0x47, 0x9E, 0x84, 0xB5,
-    0xDF, 0xEA, 0x42, 0x95, 0x59, 0x1A, 0xFD, 0xB1, 0xC5, 0xD8, 0x2D, 0xF1, 0x9E, 0xE5, 0x6B, 0xA2,
-    0x22, 0xAC, 0xC4, 0xF8, 0x22, 0x54, 0xB9, 0x01, 0xB2, 0x0A, 0xEF, 0x9D, 0xDA, 0x82, 0x9D, 0x9B,
-    0xB3, 0x4C, 0x15, 0x57, 0x1B, 0xBA, 0xA3, 0x90, 0x7D, 0xB6, 0x42, 0x54, 0x08, 0x82, 0x2A, 0x31,
-    0x6E, 0xA3, 0x72, 0x2C, 0xBD, 0x02, 0x43, 0xEA, 0x65, 0xDB, 0x91, 0xBC, 0x7C, 0xF2, 0xBD, 0xF1,
-    0x21, 0x5A, 0x2D, 0x8D, 0x92, 0xD2, 0x39, 0x8D, 0xAD, 0xB9, 0x3C, 0x6A, 0x4E, 0xD5, 0x62, 0x9A,
-    0xC5, 0xE8, 0x58, 0x99, 0x03, 0xF8, 0xB9, 0xD3, 0x78, 0x8D, 0x5F, 0x07, 0xB5, 0xAA, 0xC2, 0x52,
-    0x97, 0xBA, 0xD8, 0x8C, 0x83, 0x46, 0x35, 0xAA, 0x9B, 0x47, 0x85, 0x36, 0xDA, 0x6C, 0x42, 0x17,
-    0xBA, 0x8C, 0xCA, 0xB0, 0x54, 0x55, 0x50, 0x7B, 0x8D, 0xDB, 0x60, 0xFB, 0x7F, 0x69, 0xE8, 0x9F,
-    0xA8, 0x41, 0xB0, 0xA2, 0x4F, 0x52, 0xFA, 0x02, 0x41, 0x89, 0xC5, 0xCC, 0xB5, 0x2A, 0x41, 0xD5,
-    0x76, 0x21, 0xB1, 0xD6, 0x73, 0x4A, 0xA7, 0xA4, 0xC9, 0x4B, 0x3B, 0x62, 0x02, 0x54, 0xAC, 0x76,
-    0x6E, 0xC7, 0x09, 0x36, 0xA7, 0xC8, 0x24, 0xDD, 0x79, 0x9C, 0x22, 0xB8, 0xDE, 0x36, 0x62, 0x4C,
-    0x63, 0x88, 0xE1, 0xD9, 0x2E, 0x21, 0x40, 0xF3, 0x36, 0x14, 0x0A, 0x63, 0x74, 0x67, 0x52, 0x93,
-    0xC8, 0x8C, 0x31, 0x82, 0x8E, 0x43, 0xE3, 0x1B, 0x27, 0xF6, 0x8C, 0xAD, 0xD9, 0x2A, 0x69, 0x37,
-    0xB7, 0xB3, 0xD5, 0x83, 0x2F, 0xFA, 0x39, 0x61, 0xC1, 0xE7, 0xEE, 0x79, 0xB6, 0x7A, 0xF1, 0x6F,
-    0x9E, 0x71, 0xE9, 0xAA, 0xAC, 0xCD, 0x5A, 0x2C, 0x68, 0xAE, 0xAE, 0x3A, 0xF2, 0x40, 0x92, 0x36,
-    0x69, 0x92, 0xE2, 0x72, 0x09, 0x12, 0xCB, 0x17, 0x59, 0xAB, 0xDB, 0xA0, 0x0D, 0x66, 0xB4, 0x4E,
-    0xA5, 0xAB, 0xB0, 0xC0, 0x33, 0x60, 0xF0, 0x75, 0x4E, 0xE7, 0x9E, 0x5C, 0x9B, 0x24, 0xCE, 0xB0,
-    0x8D, 0xC0, 0xA8, 0xFC, 0x76, 0x83, 0x15, 0x56, 0xD9, 0x2A, 0x6B, 0xB2, 0x02, 0x33, 0xBF, 0x24,
-    0x69, 0xAC, 0x91, 0xFC, 0x46, 0xB7, 0x61, 0xEB, 0x3E, 0x5A, 0xBB, 0x9C, 0x68, 0x24, 0x28, 0x9F,
-    0x2C, 0x1E, 0x57, 0x08, 0xFB, 0x36, 0xC1, 0x60, 0x4F, 0x39, 0xF9, 0x3D, 0xE5, 0x19, 0xFA, 0x2E,
-    0xF5, 0x8B, 0x65, 0x0F, 0x9B, 0xDC, 0xFA, 0x24, 0xEB, 0x60, 0xE3, 0xAC, 0x61, 0x73, 0x2D, 0x2C,
-    0x9E, 0x74, 0x61, 0x61, 0x6C, 0x58, 0xBC, 0x86, 0x8D, 0x99, 0x06, 0xF9, 0x11, 0xDE, 0x21, 0x31,
-    0xE0, 0xDB, 0x28, 0xD8, 0x9D, 0xE1, 0xEB, 0x70, 0x61, 0x95, 0xA4, 0xB7, 0x8B, 0x48, 0xCE, 0x72,
-    0xCD, 0xF5, 0x65, 0x28, 0xF1, 0xB1, 0x73, 0x7C, 0x2D, 0x8C, 0x64, 0x5D, 0x36, 0xA7, 0xD3, 0x6D,
-    0xF6, 0xC9, 0x45, 0x38, 0x61, 0x5D, 0x16, 0x8B, 0xC5, 0xDC, 0xCE, 0x77, 0x38, 0xDA, 0xB9, 0xDF,
-    0xBA, 0x65, 0x28, 0x5F, 0x16, 0x3C, 0x2F, 0x3F, 0xBC, 0x2D, 0xE9, 0x3E, 0xFE, 0x80, 0x67, 0x85,
-    0xA2, 0xEE, 0x4E, 0x35, 0xD7, 0x87, 0xAD, 0x85, 0x2D, 0xF4, 0x1A, 0x31, 0x4E, 0xA0, 0xB5, 0x48,
-    0x5A, 0x4F, 0x28, 0x9E, 0x55, 0x9A, 0xE9, 0xE0, 0x95, 0x35, 0x4F, 0x87, 0xA8, 0x0A, 0xE8, 0x23,
-    0x06, 0x04, 0x42, 0xFA, 0x3C, 0x8A, 0x01, 0xCD, 0xF5, 0x53, 0x76, 0x6A, 0xEC, 0xD0, 0x4A, 0x6E,
-    0x4D, 0x28, 0x50, 0x48, 0xFF, 0x2A, 0x59, 0xDA, 0x93, 0x25, 0x3D, 0x19, 0xAE, 0x92, 0x95, 0x3D,
-    0x99, 0xFA, 0x2F, 0xB2, 0x25, 0xFB, 0x0C, 0xD6, 0xA1, 0x11, 0x42, 0x0B, 0x88, 0x0E, 0xC3, 0x83,
-    0x4B, 0xA7, 0xAD, 0x16, 0x19, 0xE5, 0xA6, 0x3E, 0x1D, 0x5E, 0xAC, 0xCA, 0x8B, 0x8F, 0xF3, 0x3D,
-    0xB8, 0x97, 0xDD, 0xAE, 0x51, 0xAB, 0x34, 0xF8, 0x8A, 0x47, 0x64, 0x67, 0xA9, 0x75, 0xEF, 0xC3,
-    0xC0, 0xC9, 0x87, 0xC3, 0xD1, 0x7E, 0x54, 0x05, 0xCC, 0x08, 0xA3, 0x93, 0xE1, 0x77, 0x37, 0x08,
-    0xEE, 0x11, 0xC1, 0x1D, 0x41, 0xA5, 0xBE, 0x09, 0xE8, 0xA0, 0xBB, 0xF8, 0x26, 0x63, 0x6F, 0x1D,
-    0xD9, 0x60, 0xF4, 0xE5, 0x5A, 0x30, 0x7A, 0x92, 0x32, 0x3C, 0x29, 0x19, 0x17, 0x4E, 0xFB, 0x3D,
-    0x7E, 0xEB, 0x5D, 0x38, 0xC4, 0xD0, 0x21, 0xB1, 0x75, 0x08, 0x01, 0x5B, 0x46, 0x95, 0x57, 0x06,
-    0x85, 0x9F, 0xDA, 0x54, 0x2A, 0x31, 0x12, 0x5F, 0xA2, 0x54, 0x7E, 0xD5, 0x68, 0x23, 0x1F, 0xD6,
-    0x3A, 0x4F, 0x54, 0xA9, 0xCD, 0x0D, 0x6B, 0x8E, 0x4D, 0x24, 0x29, 0xAB, 0x49, 0x6A, 0x5D, 0x87,
-    0x95, 0x85, 0x01, 0x75, 0x6A, 0x0F, 0x17, 0x8B, 0xE5, 0x3E, 0x30, 0xBA, 0xE8, 0x74, 0xD8, 0xF0,
-    0x9B, 0x24, 0x7E, 0x66, 0x9A, 0xD3, 0x0D, 0xE3, 0xFC, 0xDE, 0xBA, 0x22, 0x86, 0xF3, 0xEE, 0x5F,
-    0xD3, 0x40, 0x7E, 0x49, 0xFC, 0x9E, 0xA5, 0x23, 0x7A, 0xFE, 0xDE, 0xC1, 0x23, 0xE0, 0x8D, 0xF5,
-    0x69, 0x36, 0x3B, 0x6B, 0xF3, 0xB4, 0xFF, 0xC0, 0x89, 0x83, 0x73, 0x9F, 0xF1, 0x72, 0x96, 0xEA,
-    0x4C, 0xE2, 0x91, 0xBF, 0xC2, 0xF0, 0x66, 0x7C, 0x9D, 0x86, 0x7B, 0x36, 0x66, 0xCF, 0xEB, 0xF6,
-    0x30, 0x91, 0xE6, 0x98, 0x96, 0xA1, 0x93, 0x8B, 0x57, 0xF5, 0x6A, 0x79, 0x90, 0x35, 0x9F, 0x5A,
-    0x74, 0xC0, 0xBF, 0x9F, 0x47, 0x52, 0x13, 0xEA, 0xEA, 0x7E, 0xE9, 0xDE, 0x4F, 0x3B, 0x46, 0x6E,
-    0xCA, 0x4B, 0xA2, 0xEE, 0x73, 0x0A, 0xB3, 0x8C, 0xE1, 0xFB, 0x4A, 0xF2, 0xA8, 0xF6, 0x7B, 0xCD,
-    0xD4, 0xC5, 0xF3, 0xDD, 0x3F, 0x43, 0x4D, 0xF0, 0xFB, 0x5F, 0x93, 0xCB, 0x2D, 0xE0, 0x77, 0xC0,
-    0xF3, 0xC0, 0x4F, 0x80, 0x3B, 0xF6, 0x65, 0xF2, 0x0B, 0xE0, 0xD6, 0x60, 0x4D, 0xC9, 0x20, 0xF4,
-    0x54, 0x49, 0x84, 0xF9, 0xEB, 0xBD, 0x73, 0xFB, 0xF5, 0x26, 0xF8, 0x7C, 0xE1, 0x62, 0x57, 0x7F,
-    0x02, 0x3E, 0x79, 0x07, 0x28, 0xF1, 0xD3, 0xBF, 0x3C, 0xE5, 0x62, 0x9F, 0x62, 0x65, 0x90, 0x5E,
-    0x06, 0x9B, 0x53, 0x13, 0x4A, 0x18, 0x14, 0x49, 0x6A, 0x15, 0xDA, 0x60, 0x56, 0x4C, 0x70, 0xC2,
-    0x9A, 0xF0, 0xCD, 0x8F, 0xE9, 0x33, 0xDF, 0x86, 0x4D, 0xAD, 0x3F, 0x6A, 0x97, 0x18, 0x37, 0xA7,
-    0x51, 0x7F, 0x63, 0xE0, 0x35, 0x3C, 0x77, 0x67, 0xDC, 0xA8, 0x8A, 0xCE, 0xAD, 0xBF, 0x73, 0x97,
-    0x3B, 0x27, 0x3E, 0x8F, 0x68, 0x90, 0xC5, 0x0C, 0xA7, 0x79, 0x8C, 0x73, 0x22, 0xC3, 0x2F, 0xC2,
-    0xE2, 0x14, 0x73, 0xAB, 0x03, 0x93, 0xEF, 0x18, 0x61, 0x91, 0xC1, 0xAD, 0x78, 0x07, 0x7D, 0xF5,
-    0x8F, 0x54, 0xBF, 0xF9, 0x99, 0x79, 0xC3, 0x7B, 0x3F, 0x3F, 0x62, 0x60, 0x24, 0x08, 0xE3, 0x90,
-    0x6C, 0x97, 0x38, 0xB2, 0xF7, 0xA7, 0x91, 0x42, 0x78, 0x7F, 0xBE, 0x44, 0xD3, 0x7D, 0xFB, 0x4F,
-    0xBA, 0x49, 0xDA, 0xA0, 0x78, 0xFD, 0xF8, 0xB9, 0x3B, 0x5D, 0x8A, 0x21, 0xF6, 0x75, 0x76, 0x66,
-    0xF6, 0x94, 0x6B, 0x1E, 0x32, 0xC5, 0xD9, 0xD1, 0xCE, 0x83, 0x92, 0xB7, 0x2F, 0xB5, 0x7E, 0xA5,
-    0x07, 0xC1, 0x5D, 0x6B, 0x8C, 0xAD, 0xD8, 0xC6, 0xF7, 0xA3, 0xC8, 0xE6, 0x26, 0xBF, 0x56, 0x36,
-    0x4C, 0x93, 0xD2, 0x93, 0xF3, 0xE9, 0x03, 0x31, 0xB0, 0xB1, 0xC6, 0x2D, 0xB7, 0x39, 0x58, 0xC7,
-    0xED, 0xCA, 0xF9, 0xFF, 0xB1, 0xA1, 0x4B, 0x31, 0x5D, 0xBA, 0x59, 0x5C, 0x96, 0xA7, 0x53, 0x0C,
-    0xEC, 0x79, 0x43, 0x57, 0xE4, 0x73, 0x26, 0x08, 0x65, 0xF7, 0x7F, 0x5C, 0x47, 0xDD, 0xF7, 0x52,
-    0xC7, 0x03, 0x1E, 0x98, 0x8F, 0x48, 0xF0, 0xC3, 0xDF, 0xE2, 0xB2, 0x74, 0xA7, 0x82, 0xF9, 0x56,
-    0xE8, 0x0B, 0xCB, 0x51, 0x18, 0x50, 0x9F, 0x3B, 0x3F, 0xE2, 0x2F, 0x46, 0x6D, 0x3F, 0x97, 0x6B,
-    0xD9, 0x5E, 0xEE, 0xA8, 0x8F, 0x70, 0xA5, 0xBC, 0xD0, 0x0F, 0x2A, 0x4D, 0x7A, 0x0E, 0xDD, 0x6E,
-    0xB1, 0x41, 0x36, 0x9D, 0xFE, 0xD8, 0x74, 0xDF, 0x6E, 0xF5, 0x24, 0x37, 0x2C, 0x8B, 0xFA, 0xA5,
-    0x43, 0x44, 0x91, 0xEC, 0x87, 0x27, 0x5A, 0x9F, 0x0D, 0x06, 0x5D, 0xF6, 0xC6, 0xF8, 0xE7, 0xD8,
-    0x57, 0xCC, 0x3D, 0x60, 0x18, 0x8E, 0x1D, 0xA6, 0x24, 0x38, 0xDB, 0x78, 0x58, 0xE1, 0xD3, 0xAA,
-    0x2B, 0x93, 0x35, 0xD5, 0xA9, 0xA5, 0x3A, 0x56, 0xF1, 0x89, 0xC2, 0x88, 0xB9, 0xAC, 0xB1, 0x49,
-    0x74, 0x4F, 0xE1, 0xE4, 0xB2, 0x85, 0x38, 0xD0, 0xD0, 0x82, 0xC1, 0x7D, 0xCB, 0xAA, 0x3A, 0x3C,
-    0x3A, 0x26, 0xCA, 0x6A, 0x2C, 0x87, 0x51, 0x4D, 0x52, 0xC5, 0xF4, 0x17, 0x86, 0x67, 0xE3, 0xEC,
-    0x24, 0x3C, 0x56, 0xC7, 0xEA, 0x20, 0xA2, 0x00, 0x6F, 0xED, 0xC1, 0x32, 0x65, 0x3B, 0x64, 0xA6,
-    0xCE, 0x2C, 0x83, 0xAB, 0x6D, 0xD8, 0xFD, 0x4B, 0xE1, 0xDF, 0xE7, 0xF6, 0x36, 0x7C, 0x1C, 0xD7,
-    0xE3, 0x20, 0xAD, 0x46, 0xD7, 0xFB, 0x64, 0xE8, 0x90, 0xE2, 0x9F, 0xB9, 0xE4, 0x75, 0xF7, 0x9B,
-    0xD0, 0xFF, 0x22, 0x0C, 0xC8, 0x4D, 0x97, 0xBB, 0xF3, 0x10, 0x7D, 0x55, 0xA5, 0x33, 0xA1, 0xE4,
-    0xFB, 0x21, 0x46, 0xAF, 0xE3, 0xD5, 0x7B, 0x50, 0x7B, 0xFC, 0x21, 0xB2, 0x69, 0xDB, 0x89, 0x11,
-    0xF9, 0x46, 0x7D, 0x18, 0x7B, 0x2B, 0x9B, 0xF4, 0xBD, 0x16, 0xC1, 0xDF, 0x11, 0x06, 0x66, 0xE8,
-    0xC4, 0xFF, 0x01, 0xE5, 0x7D, 0x3F, 0x90, 0xDC, 0xD6, 0x99, 0xE7, 0xEB, 0x6E, 0x72, 0x7A, 0xED,
-    0xAE, 0x33, 0x18, 0x98, 0xFE, 0x43, 0xD6, 0x19, 0x0E, 0x2E, 0xD8, 0x63, 0x5D, 0x19, 0xF1, 0x6E,
-    0xED, 0x1A, 0xF0, 0x2A, 0x50, 0xB0, 0x81, 0x19, 0x70, 0xA4, 0x3A, 0x33, 0xE0, 0x05, 0xB7, 0x55,
-    0x67, 0xBA, 0x6A, 0x27, 0xBA, 0x2A, 0xD7, 0x95, 0x6F, 0xD1, 0x16, 0x03, 0x05, 0x0E, 0x3C, 0x5B,
-    0x2B, 0x39, 0x38, 0x07, 0x66, 0x5D, 0xC9, 0x57, 0xE2, 0xB0, 0xEA, 0xE8, 0x60, 0x03, 0x05, 0x5A,
-    0xA3, 0x25, 0x06, 0x0A, 0x14, 0x08, 0x92, 0x8E, 0x7B, 0x81, 0x03, 0xC1, 0x36, 0x59, 0x5B, 0x3B,
-    0x0A, 0x08, 0x4B, 0xE0, 0x0A, 0x1C, 0x02, 0x78, 0xF7, 0xFD, 0x7E, 0xDF, 0x7B, 0x68, 0x74, 0xCF,
-    0x0C, 0x39, 0x94, 0x44, 0x8A, 0xBA, 0x9D, 0x19, 0x7C, 0x1F, 0xA6, 0x1B, 0x78, 0x78, 0x78, 0x7F,
-    0xBE, 0xF7, 0xFD, 0x7F, 0x1B, 0x57, 0x8C, 0x99, 0xD8, 0xC4, 0x18, 0xBB, 0x30, 0x26, 0x2E, 0x8D,
-    0x99, 0xD5, 0xC6, 0x8C, 0x1B, 0xE3, 0x7F, 0x62, 0x6B, 0x6B, 0x39, 0x9A, 0xFE, 0xB8, 0xB3, 0x79,
-    0x0E, 0x97, 0xAD, 0x1C, 0x77, 0x36, 0xCF, 0xCA, 0x77, 0x55, 0x7F, 0xEC, 0xED, 0x5C, 0xDE, 0x77,
-    0x8D, 0x3F, 0x86, 0x65, 0xC9, 0x81, 0x67, 0x4C, 0xCA, 0x60, 0x11, 0xD4, 0x71, 0x81, 0x63, 0x56,
-    0x47, 0xC5, 0x78, 0xFB, 0x8B, 0xC9, 0xE3, 0x7A, 0x7E, 0x6A, 0xE5, 0x06, 0x63, 0x0E, 0x44, 0x27,
-    0x2F, 0x74, 0x9B, 0x67, 0xA5, 0x0E, 0xB3, 0x96, 0x55, 0x39, 0x04, 0xFD, 0xE0, 0x26, 0x90, 0xDC,
-    0xB1, 0x50, 0x54, 0x2A, 0x6A, 0x80, 0x5E, 0xCC, 0x5A, 0x5E, 0x19, 0x74, 0x44, 0x53, 0x4B, 0x34,
-    0x59, 0x41, 0xEE, 0x43, 0xBD, 0xE4, 0x4B, 0x96, 0x37, 0x04, 0xBC, 0x5D, 0x50, 0xA9, 0x68, 0x8E,
-    0x47, 0x8D, 0xCE, 0x01, 0x5E, 0xBC, 0x2C, 0x7D, 0x95, 0xB3, 0xCF, 0x66, 0x72, 0x51, 0x20, 0x57,
-    0x44, 0xF3, 0xBE, 0xBB, 0xE4, 0xC1, 0xF5, 0xCA, 0x71, 0x63, 0xF3, 0x1C, 0x2A, 0xF6, 0x69, 0x1D,
-    0xFA, 0x33, 0xCA, 0xEC, 0xB6, 0x09, 0xAD, 0xD4, 0x55, 0x5A, 0xAA, 0x19, 0xE1, 0x41, 0x13, 0x5B,
-    0x6D, 0x94, 0x81, 0x54, 0xEA, 0x44, 0x88, 0x86, 0x89, 0xD0, 0xB1, 0x71, 0xD5, 0x03, 0xB9, 0x24,
-    0x49, 0x7B, 0xC0, 0x7F, 0xD1, 0x1B, 0xEE, 0x5B, 0x19, 0x72, 0x26, 0xC4, 0x1D, 0x81, 0x65, 0x5B,
-    0x16, 0xE6, 0x87, 0x13, 0x14, 0xCA, 0xD7, 0x31, 0x11, 0xC0, 0xD8, 0xCA, 0x4B, 0x9B, 0xE3, 0x67,
-    0xB5, 0x02, 0x5B, 0x76, 0x5B, 0x2E, 0x90, 0x86, 0xB1, 0x6D, 0x84, 0x8E, 0xAC, 0x37, 0x6A, 0x14,
-    0x97, 0x16, 0x72, 0x94, 0x5A, 0x60, 0x24, 0x8D, 0x16, 0xC8, 0x8D, 0x53, 0x79, 0x94, 0x94, 0x53,
-    0x48, 0x7D, 0x6B, 0x33, 0x42, 0xF3, 0x86, 0xD2, 0xD2, 0x68, 0xF4, 0x89, 0x3D, 0x2B, 0xC7, 0x3F,
-    0x48, 0xCB, 0x67, 0x52, 0x86, 0x1C, 0xB5, 0x1C, 0xC5, 0x69, 0x2B, 0x5F, 0x1F, 0x4F, 0x4C, 0x5C,
-    0xC4, 0xE5, 0xC3, 0xFC, 0xE2, 0xA5, 0x9F, 0x2E, 0xD2, 0xB7, 0x2A, 0xF9, 0x8B, 0xDF, 0x2C, 0x4F,
-    0x8D, 0xB7, 0xB5, 0xAA, 0xD2, 0xCB, 0x9F, 0xCA, 0x9F, 0x09, 0x9A, 0x4F, 0xED, 0x2F, 0xAA, 0x4F,
-    0x66, 0x55, 0x6A, 0xCB, 0xD4, 0xE6, 0xA9, 0x74, 0x89, 0xB4, 0x56, 0xA8, 0xE3, 0x77, 0x70, 0x12,
-    0xED, 0x3F, 0xB9, 0xB3, 0xE9, 0x4E, 0x4A, 0xB3, 0x76, 0x12, 0x0F, 0x4F, 0x76, 0x5F, 0xC2, 0x49,
-    0x81, 0xCE, 0xCB, 0xFD, 0x49, 0xED, 0x4F, 0x3A, 0x3D, 0xD9, 0xCD, 0xE4, 0x8D, 0xE2, 0x5C, 0xEE,
-    0x9A, 0x4A, 0x3F, 0xF1, 0x64, 0x2C, 0x25, 0xA4, 0x38, 0x19, 0xE1, 0x64, 0x81, 0x02, 0xE5, 0x2F,
-    0x5B, 0xB8, 0x4F, 0xF8, 0x37, 0xB1, 0x73, 0x5C, 0x66, 0xF3, 0xD0, 0x26, 0xDA, 0xAF, 0xD6, 0x0A,
-    0xE0, 0xB8, 0x6F, 0x0C, 0x3A, 0x97, 0x13, 0x10, 0x93, 0x97, 0x8F, 0x3A, 0xDE, 0xCF, 0x8B, 0x05,
-    0xDE, 0xFB, 0x53, 0xC0, 0xF8, 0xE9, 0xB6, 0x15, 0xCB, 0x13, 0x14, 0xDB, 0x85, 0xC3, 0xA5, 0xCC,
-    0xB7, 0x0B, 0xED, 0x33, 0xB6, 0xD2, 0xEB, 0xE3, 0x5A, 0x71, 0xD8, 0x28, 0x0E, 0x9A, 0xD5, 0xFF,
-    0xDD, 0xF7, 0xC7, 0xF5, 0x7A, 0xDE, 0xAF, 0x38, 0x77, 0xD8, 0x28, 0xBE, 0xE9, 0x28, 0xD2, 0x7E,
-    0xE8, 0x48, 0x94, 0x12, 0xA3, 0x83, 0xE0, 0xA9, 0x97, 0x94, 0x1C, 0xCD, 0x1D, 0x6D, 0x52, 0xD2,
-    0x34, 0x93, 0x0E, 0x68, 0x1D, 0xD5, 0x11, 0x38, 0xEB, 0x1C, 0x21, 0x7A, 0x30, 0xEC, 0x1C, 0x34,
-    0xA7, 0x5E, 0x96, 0xF2, 0xD3, 0x4A, 0xDB, 0x46, 0xA6, 0xA7, 0x9C, 0x4C, 0xD1, 0x42, 0xB3, 0xC2,
-    0x0C, 0x7E, 0xE4, 0xBB, 0x10, 0x2F, 0x19, 0xE3, 0xCD, 0x6C, 0xC1, 0xAE, 0x44, 0x37, 0xCA, 0x17,
-    0x41, 0x2B, 0x40, 0x66, 0xBD, 0x5D, 0x70, 0xF4, 0xC8, 0x58, 0xB1, 0xFF, 0x88, 0x8B, 0xB4, 0x3B,
-    0x3B, 0xE3, 0xCE, 0xDE, 0x67, 0xC7, 0xCB, 0xFC, 0xB5, 0x8B, 0x14, 0xD7, 0xC5, 0xB8, 0x43, 0xAA,
-    0x6D, 0x17, 0x33, 0x19, 0x03, 0x52, 0xD4, 0xC2, 0x95, 0x6C, 0x32, 0xB4, 0x62, 0xCC, 0xA6, 0xED,
-    0xCC, 0x99, 0x97, 0x8C, 0x27, 0x2A, 0x9C, 0xEC, 0xA8, 0x0B, 0xC9, 0xA4, 0x8C, 0xB5, 0x7D, 0xB5,
-    0xD4, 0xFE, 0x65, 0x6B, 0x47, 0x84, 0x31, 0x61, 0x46, 0xC8, 0x5E, 0x18, 0x13, 0x4E, 0x08, 0x83,
-    0x3D, 0xC0, 0xF0, 0x03, 0xC0, 0xF8, 0x77, 0x80, 0xE9, 0x75, 0x40, 0x7B, 0x49, 0xE0, 0x6B, 0x16,
-    0x2F, 0x77, 0xBD, 0x03, 0x7C, 0xA3, 0x01, 0x7C, 0xAB, 0x06, 0x7C, 0xAF, 0x04, 0xB4, 0x05, 0x21,
-    0x1B, 0xC0, 0xCE, 0x09, 0x31, 0xB7, 0xE5, 0x6D, 0x01, 0x1B, 0xC2, 0x9A, 0xB3, 0x5D, 0x7F, 0xD2,
-    0x45, 0x08, 0x72, 0x56, 0xC8, 0x94, 0x31, 0x51, 0x87, 0x86, 0x0E, 0x30, 0xEC, 0x85, 0x8E, 0xD5,
-    0xAB, 0xF5, 0x07, 0xE5, 0xCB, 0x72, 0x50, 0x53, 0xBB, 0x88, 0x40, 0xE7, 0xE6, 0x01, 0x4B, 0xC3,
-    0x32, 0xD3, 0xB1, 0xEF, 0xF0, 0x6F, 0x22, 0x1F, 0xCA, 0x57, 0x21, 0x2F, 0x23, 0xC1, 0xCC, 0x51,
-    0x72, 0x5C, 0xCA, 0x2C, 0x33, 0x61, 0x85, 0x06, 0x0A, 0x5A, 0x94, 0x3F, 0x43, 0xD3, 0xCB, 0x0D,
-    0x18, 0x44, 0x63, 0x5D, 0xA4, 0xF5, 0x89, 0x59, 0xC9, 0xF3, 0x82, 0xAD, 0xDA, 0x57, 0x27, 0x40,
-    0x77, 0x91, 0xDA, 0x02, 0xB2, 0x81, 0xCF, 0xB9, 0x56, 0x9D, 0xB6, 0x02, 0x66, 0xDD, 0x23, 0x04,
-    0x98, 0x87, 0x6B, 0x40, 0x87, 0xE3, 0x41, 0xC0, 0x64, 0x7C, 0x0D, 0xBE, 0x12, 0x17, 0x03, 0x33,
-    0xD1, 0x57, 0xED, 0xB8, 0xF2, 0x34, 0x6C, 0x82, 0x86, 0x6F, 0x56, 0xA3, 0x51, 0xA2, 0x4A, 0x1B,
-    0x48, 0x57, 0x97, 0xA8, 0x42, 0x2B, 0x87, 0x35, 0xDE, 0x4C, 0x9B, 0x52, 0xDA, 0x77, 0xCC, 0x27,
-    0x4E, 0x48, 0x8A, 0xA6, 0x80, 0xC9, 0x8C, 0x24, 0x21, 0xE8, 0x36, 0x9F, 0xE1, 0x00, 0x17, 0x72,
-    0x85, 0x05, 0x29, 0x2B, 0xD1, 0x3D, 0x69, 0xA9, 0x0B, 0x14, 0x9A, 0x30, 0x6A, 0x2C, 0xD6, 0xD0,
-    0x75, 0x20, 0x4B, 0xB6, 0x52, 0xD3, 0x75, 0xB0, 0x7B, 0x85, 0x93, 0xA2, 0x70, 0xD4, 0x8E, 0xF4,
-    0xE1, 0xC6, 0xB5, 0x7E, 0x16, 0x8C, 0x74, 0x2A, 0xF8, 0xB3, 0x31, 0x40, 0x68, 0xE7, 0x8E, 0x46,
-    0x6A, 0xF1, 0x25, 0xA6, 0x96, 0x2C, 0x6E, 0x76, 0xEF, 0x2C, 0x16, 0xE5, 0x96, 0x2B, 0xF3, 0x1C,
-    0x20, 0x8F, 0xCB, 0x0D, 0x8B, 0xF7, 0xCC, 0x00, 0xD2, 0x1E, 0xD8, 0x22, 0xBE, 0xF3, 0xAC, 0x8C,
-    0x16, 0xBC, 0x24, 0x98, 0x31, 0x5D, 0xCB, 0xE3, 0xBD, 0xAB, 0xB8, 0x43, 0x2F, 0x8E, 0x2B, 0x80,
-    0xBA, 0x07, 0xF2, 0xEF, 0x48, 0x8A, 0x42, 0x55, 0x01, 0xFA, 0x7B, 0x2F, 0x3F, 0x7A, 0xF6, 0x64,
-    0xA6, 0x9C, 0x5B, 0x70, 0x20, 0x6A, 0x37, 0x41, 0xAF, 0x02, 0xE1, 0x28, 0x0E, 0x45, 0xD5, 0x10,
-    0x85, 0x0E, 0x95, 0x44, 0xD1, 0x0A, 0x8A, 0x1D, 0x2A, 0x8C, 0x0E, 0x0A, 0x22, 0xD0, 0x8F, 0x4A,
-    0x86, 0xC2, 0x1C, 0x7C, 0x4D, 0xC6, 0x15, 0xA1, 0x38, 0x18, 0x2D, 0x38, 0x67, 0xEF, 0x87, 0x1E,
-    0x35, 0xE3, 0x2B, 0x15, 0x15, 0x9A, 0x20, 0x94, 0xDC, 0x71, 0x05, 0xA4, 0xF0, 0xE4, 0x0D, 0x1C,
-    0xA1, 0xC0, 0x4D, 0x1C, 0xE6, 0x98, 0xD0, 0x69, 0x11, 0x34, 0x63, 0x4C, 0x8E, 0xB8, 0x0A, 0x1A,
-    0xD2, 0xA7, 0xA0, 0x91, 0x5F, 0x4C, 0xA0, 0x59, 0x17, 0x34, 0x98, 0x12, 0x72, 0xDB, 0x2F, 0xBA,
-    0xB4, 0x74, 0x5C, 0xA8, 0x52, 0x01, 0xEB, 0x78, 0x87, 0x11, 0xDF, 0x9A, 0xD7, 0xDC, 0x26, 0x87,
-    0x2C, 0x1D, 0x15, 0x34, 0x31, 0x66, 0x61, 0xD8, 0x4A, 0x39, 0x1D, 0xB9, 0xC0, 0xA0, 0x99, 0x59,
-    0xD2, 0x18, 0x3C, 0x02, 0x3D, 0x9A, 0x07, 0xC2, 0x5C, 0x82, 0xD7, 0x45, 0x35, 0x84, 0xF4, 0x68,
-    0x0D, 0x65, 0x32, 0x05, 0xAC, 0xB6, 0x70, 0x9A, 0x31, 0x2B, 0x2F, 0xB7, 0x49, 0xCF, 0x92, 0xE2,
-    0x29, 0x2B, 0xBC, 0x81, 0x41, 0x9E, 0xE2, 0x49, 0x60, 0x50, 0x39, 0x64, 0x4D, 0x94, 0x84, 0x4A,
-    0xD4, 0x12, 0xD0, 0x82, 0xC4, 0xAF, 0x59, 0x02, 0x36, 0xB7, 0x1A, 0xCC, 0xE2, 0x12, 0x20, 0x01,
-    0xA8, 0xCC, 0xE8, 0x2A, 0x49, 0xDA, 0x4C, 0xAF, 0x5B, 0x99, 0x87, 0xF2, 0xEF, 0x7F, 0x95, 0x2F,
-    0xE6, 0x58, 0x80, 0x51, 0x3C, 0x99, 0xE0, 0x0A, 0x8C, 0x53, 0x42, 0xC6, 0xF1, 0x09, 0x5D, 0x4B,
-    0x46, 0xD6, 0x64, 0xD2, 0x38, 0x42, 0x2D, 0xA4, 0x8A, 0xD9, 0x3D, 0x4B, 0xAE, 0xBC, 0x75, 0xEC,
-    0xF6, 0x13, 0xBD, 0x16, 0x7E, 0x66, 0x3C, 0x44, 0xC8, 0x41, 0x1B, 0xED, 0x83, 0x32, 0xED, 0xB2,
-    0x02, 0xF3, 0x63, 0x1D, 0x16, 0xF7, 0x83, 0xC2, 0xDB, 0xAE, 0x41, 0x99, 0xE9, 0x3D, 0xC4, 0xB3,
-    0x0B, 0xCC, 0xB0, 0xAC, 0xC0, 0x40, 0x02, 0x34, 0x80, 0x2D, 0x21, 0x48, 0x4C, 0xA1, 0xCC, 0x2C,
-    0x96, 0xAE, 0xA9, 0x30, 0x88, 0x2D, 0x97, 0x5A, 0xBC, 0x23, 0x90, 0x05, 0x9F, 0x4E, 0x14, 0x03,
-    0xCD, 0x89, 0x50, 0x72, 0x96, 0x5B, 0xF0, 0xD2, 0x69, 0x6E, 0xB7, 0xA4, 0x71, 0xE2, 0xDC, 0x5E,
-    0x28, 0x46, 0xAD, 0xA0, 0xEF, 0x96, 0x93, 0x06, 0xA8, 0x9A, 0x34, 0xF2, 0xDD, 0xD3, 0xF5, 0xB4,
-    0x12, 0x74, 0xA9, 0x09, 0x4A, 0xA0, 0x96, 0xE8, 0xB9, 0x2E, 0x2C, 0x04, 0xCD, 0x6D, 0xBC, 0x20,
-    0x4A, 0x89, 0x32, 0x19, 0xF9, 0x39, 0x46, 0xBF, 0x01, 0x8A, 0x15, 0x45, 0x1D, 0x91, 0xF4, 0x04,
-    0x50, 0x40, 0x24, 0x6B, 0x7F, 0x77, 0x64, 0x70, 0x63, 0xF3, 0xFC, 0xBE, 0x95, 0x7C, 0x77, 0xE7,
-    0x5A, 0xF7, 0x70, 0xA5, 0x2C, 0xC8, 0x99, 0x7A, 0x11, 0x35, 0xA1, 0x34, 0x83, 0xA6, 0x53, 0x96,
-    0x00, 0x2B, 0xDD, 0xD4, 0xDE, 0x9C, 0x09, 0x59, 0xC1, 0xA0, 0x28, 0x21, 0xA8, 0xA6, 0x15, 0x24,
-    0x55, 0x59, 0xB6, 0x40, 0xD9, 0x1B, 0x90, 0xBC, 0x90, 0x30, 0x68, 0xD2, 0x01, 0x8C, 0x7B, 0x28,
-    0xDF, 0xF2, 0x4A, 0xBD, 0x0B, 0x8B, 0x7B, 0x5A, 0x69, 0x69, 0xD2, 0x27, 0xF2, 0x47, 0x36, 0x60,
-    0xAE, 0x6B, 0xB3, 0x0A, 0xAE, 0x78, 0x30, 0x88, 0xD2, 0x28, 0x51, 0x72, 0xD8, 0xAE, 0x03, 0x48,
-    0x0C, 0xE0, 0x64, 0x1E, 0x21, 0x88, 0xED, 0x5D, 0x2E, 0x00, 0xD5, 0x72, 0xCD, 0x4F, 0xE2, 0x3B,
-    0x5B, 0xD2, 0x7D, 0xE5, 0xD8, 0x4D, 0x1D, 0x80, 0xBC, 0x07, 0xF2, 0xAF, 0x4C, 0x8A, 0x78, 0xEF,
-    0x9A, 0xCA, 0xEA, 0x5C, 0x3C, 0x00, 0x64, 0x2C, 0xEF, 0x5D, 0xD1, 0xF5, 0xE4, 0x28, 0x60, 0x55,
-    0x5B, 0xD0, 0xA0, 0x23, 0x1A, 0xF4, 0x43, 0x35, 0xF5, 0xDA, 0x02, 0x0A, 0xE3, 0x4E, 0x5B, 0x50,
-    0xF7, 0xFA, 0x00, 0xDC, 0x9B, 0xF6, 0x60, 0x50, 0x28, 0xBF, 0xD5, 0x55, 0x83, 0xAC, 0x26, 0x59,
-    0xD5, 0x9B, 0xE6, 0xEF, 0x27, 0x5C, 0xE1, 0x09, 0x22, 0x80, 0x5E, 0x5B, 0x40, 0x29, 0x09, 0xA0,
-    0x5E, 0x82, 0x93, 0xCF, 0xDA, 0x17, 0xCF, 0x29, 0x61, 0x7C, 0x64, 0xE0, 0xC9, 0xE4, 0xC7, 0x97,
-    0x5D, 0x62, 0x93, 0x01, 0xDA, 0xB0, 0xDB, 0xBC, 0x9F, 0x8D, 0x96, 0x92, 0x55, 0xE4, 0x6C, 0x11,
-    0xF6, 0xD6, 0xEE, 0xD9, 0x6B, 0xB6, 0x08, 0xEC, 0x77, 0x84, 0x4E, 0x96, 0x91, 0xAC, 0xC6, 0x09,
-    0xE6, 0xCA, 0x08, 0x35, 0x07, 0x93, 0x77, 0x28, 0xC2, 0x25, 0x61, 0xE3, 0x6E, 0xC0, 0xED, 0xDF,
-    0xC1, 0x0C, 0xB9, 0x07, 0xF2, 0xE9, 0x8A, 0x76, 0x0F, 0x92, 0x87, 0x5B, 0x3E, 0x7E, 0xEC, 0x94,
-    0x5C, 0x2B, 0x35, 0x33, 0x9B, 0xAE, 0xEB, 0x6D, 0x1E, 0x61, 0x8D, 0x06, 0xC1, 0x9F, 0x58, 0xB6,
-    0x1F, 0x66, 0xF4, 0x9C, 0xDC, 0xF5, 0xC2, 0xF1, 0xD5, 0x68, 0xB9, 0x8A, 0x8D, 0xD0, 0x0D, 0xDB,
-    0x4C, 0x59, 0xFD, 0x9A, 0x8F, 0xA8, 0xFB, 0x4F, 0x02, 0x7E, 0x1B, 0xDD, 0x23, 0x4F, 0x53, 0x2A,
-    0xB7, 0x21, 0x8D, 0x29, 0x4B, 0x4B, 0xCC, 0x45, 0x47, 0x4A, 0x86, 0x54, 0xCC, 0x13, 0xE1, 0x2A,
-    0xE4, 0x11, 0xF2, 0x95, 0xD0, 0x69, 0x43, 0x19, 0x7D, 0x86, 0x75, 0xE7, 0xB1, 0xC2, 0xA0, 0x55,
-    0x5D, 0x43, 0xBD, 0x1F, 0x52, 0xD0, 0x3D, 0x14, 0x0A, 0x6B, 0x1A, 0x34, 0x47, 0x06, 0x05, 0x68,
-    0x1E, 0x58, 0xA9, 0xB8, 0xFB, 0x99, 0xF0, 0x88, 0x10, 0x34, 0xC0, 0x3D, 0x73, 0xD6, 0x36, 0xE6,
-    0xD4, 0x15, 0x2A, 0x41, 0x8E, 0x04, 0xC0, 0x19, 0x97, 0xF2, 0x7C, 0x65, 0x94, 0x49, 0x55, 0x9F,
-    0x0C, 0x7C, 0x67, 0x33, 0xBD, 0x23, 0x1C, 0x5F, 0xAC, 0x1A, 0x9B, 0xC3, 0x71, 0xE1, 0x58, 0x7D,
-    0x48, 0x34, 0x4F, 0xFE, 0x49, 0x05, 0xFA, 0xE9, 0xEA, 0xAE, 0x62, 0xD7, 0x21, 0x27, 0x03, 0x85,
-    0xC1, 0x91, 0x4F, 0x4E, 0x26, 0x29, 0x29, 0xCA, 0x7E, 0x78, 0xF2, 0x3C, 0x17, 0xDC, 0xE9, 0x7E,
-    0x68, 0x37, 0x13, 0xD2, 0x94, 0xCE, 0x53, 0x96, 0x29, 0xC5, 0xCF, 0xA9, 0xBD, 0x6A, 0x29, 0x76,
-    0x44, 0x2A, 0x7C, 0xA8, 0x4A, 0xA9, 0x5B, 0x87, 0xFC, 0x7C, 0x94, 0x35, 0xBC, 0xAB, 0xEE, 0xEF,
-    0x05, 0xDD, 0x98, 0x42, 0x1F, 0x86, 0x09, 0x2B, 0x94, 0xF3, 0xE1, 0xD1, 0xEE, 0x0B, 0x44, 0x52,
-    0x21, 0x45, 0xB5, 0xA2, 0x8E, 0xDF, 0x65, 0x96, 0x57, 0x4E, 0x85, 0x5A, 0xCD, 0xC1, 0xE7, 0xFE,
-    0x18, 0x68, 0x24, 0x7C, 0xEC, 0x12, 0x8D, 0x15, 0x4D, 0xF4, 0xBB, 0x2D, 0x5E, 0x29, 0x3F, 0x5A,
-    0x4A, 0xA3, 0xA8, 0x20, 0xEA, 0xF0, 0xA0, 0x9D, 0xF9, 0x01, 0x72, 0xFC, 0x41, 0xE0, 0xC6, 0x39,
-    0xB2, 0x07, 0xDB, 0xC6, 0xEB, 0xBD, 0x85, 0x3B, 0xDD, 0x25, 0x8B, 0x3D, 0xD5, 0xC7, 0x7A, 0xD9,
-    0x7E, 0x29, 0xE0, 0x4F, 0x54, 0xC0, 0x4F, 0xBC, 0x80, 0xDF, 0x0C, 0x04, 0x7C, 0xFE, 0x8C, 0x9D,
-    0x14, 0x54, 0xA9, 0x98, 0xC2, 0x65, 0x3F, 0xDC, 0x3E, 0x6D, 0x17, 0xC7, 0xDC, 0x92, 0x91, 0xF6,
-    0x8B, 0xAA, 0x50, 0x8B, 0xCD, 0xCD, 0x0B, 0x3A, 0xCD, 0xD7, 0x80, 0x57, 0xA3, 0x45, 0xFD, 0xFA,
-    0xCC, 0xDB, 0x6C, 0xF9, 0x27, 0x42, 0x1E, 0x73, 0xAF, 0x3F, 0xE8, 0x94, 0xBF, 0x38, 0x4D, 0x66,
-    0xE7, 0x78, 0xB2, 0x22, 0x4D, 0x4C, 0x2D, 0x35, 0x26, 0xA8, 0xC5, 0x5C, 0xE5, 0x07, 0x54, 0x73,
-    0xA1, 0x5D, 0x2B, 0x34, 0xDD, 0x26, 0x29, 0x68, 0x9C, 0x8C, 0x08, 0xCA, 0x1D, 0x32, 0x9C, 0xC9,
-    0xDC, 0xA7, 0xC0, 0xF2, 0xEE, 0x42, 0x99, 0xD0, 0xA0, 0x37, 0x2C, 0xF0, 0x42, 0x25, 0xCA, 0x03,
-    0xF0, 0xAE, 0xC3, 0x7A, 0xFD, 0x00, 0xCB, 0x30, 0x1E, 0xA3, 0x1C, 0x96, 0x9B, 0x2C, 0x9F, 0x23,
-    0x20, 0x6E, 0x29, 0x03, 0xB0, 0xED, 0xFA, 0x7A, 0x81, 0x4D, 0x99, 0x93, 0xF2, 0x82, 0x6D, 0xE2,
-    0xF8, 0x27, 0xFC, 0x81, 0xA5, 0x48, 0xD0, 0xE1, 0x3D, 0x3A, 0x48, 0xB4, 0x22, 0xD8, 0xDC, 0x39,
-    0x2F, 0x60, 0x3E, 0xED, 0x64, 0x45, 0x72, 0x60, 0xA2, 0x20, 0x99, 0x76, 0x63, 0xE1, 0x08, 0x3B,
-    0xED, 0x4A, 0xDC, 0x81, 0x05, 0x89, 0x7A, 0x22, 0x19, 0xDD, 0x9D, 0x7C, 0x11, 0x36, 0x02, 0xE2,
-    0x4A, 0x40, 0x56, 0xCA, 0x58, 0x97, 0xF6, 0xD0, 0xA2, 0x66, 0x28, 0x20, 0xC4, 0xF8, 0x97, 0x19,
-    0x2D, 0xDF, 0x1E, 0xFF, 0x25, 0x67, 0x50, 0xA1, 0x2C, 0x54, 0x80, 0xFB, 0xA7, 0x37, 0x4F, 0xAF,
-    0x8A, 0xB2, 0xCF, 0xD8, 0xF9, 0x28, 0xE3, 0x7A, 0x2D, 0x20, 0x12, 0x79, 0x67, 0x9E, 0xCA, 0x0A,
-    0x3C, 0xCF, 0x30, 0x12, 0xB3, 0x7C, 0x8C, 0x33, 0x19, 0x46, 0xE9, 0xDD, 0x2D, 0xD5, 0xF5, 0xCC,
-    0x43, 0xDB, 0x64, 0xC2, 0x0B, 0x17, 0xF1, 0xDC, 0x7C, 0x59, 0x5F, 0xF1, 0x7B, 0x90, 0x0A, 0xA5,
-    0xA8, 0x10, 0xEF, 0x8E, 0xA2, 0xC6, 0xCA, 0x2E, 0xDF, 0x35, 0xB4, 0x4C, 0xE9, 0x72, 0x12, 0x95,
-    0x30, 0x8C, 0xFC, 0x16, 0x4A, 0xA0, 0xDF, 0x40, 0xF8, 0x15, 0x59, 0x7E, 0x91, 0xCA, 0x84, 0xCE,
-    0x53, 0x69, 0xBF, 0x32, 0x05, 0x25, 0x4A, 0x41, 0x8B, 0x52, 0x90, 0x25, 0x82, 0xD8, 0x81, 0xB8,
-    0x24, 0x9D, 0x82, 0xA8, 0x26, 0xDC, 0xC4, 0x55, 0x8A, 0x8F, 0x36, 0x19, 0x91, 0x03, 0x88, 0x38,
-    0x16, 0x3D, 0x83, 0x92, 0x61, 0x12, 0x64, 0x8E, 0x5B, 0x94, 0xB6, 0xB9, 0x75, 0x41, 0x04, 0x57,
-    0xE1, 0xAB, 0x1D, 0x28, 0x64, 0x39, 0x84, 0xA9, 0x06, 0x20, 0x77, 0xD7, 0xDD, 0x3A, 0xAF, 0xDF,
-    0x26, 0xFA, 0xAA, 0x3C, 0xBB, 0xB5, 0x65, 0x5D, 0x01, 0xEE, 0x62, 0x55, 0x0C, 0xA4, 0xAC, 0xB1,
-    0x3B, 0xF6, 0x76, 0xE6, 0xB4, 0x18, 0x7D, 0x8C, 0x63, 0x59, 0xD9, 0x6A, 0x0D, 0xEE, 0x66, 0x80,
-    0x0B, 0x6A, 0x85, 0xE6, 0x54, 0x0A, 0xED, 0x87, 0x49, 0x0F, 0x45, 0x2A, 0xA7, 0xC6, 0x08, 0x70,
-    0xDA, 0x02, 0x52, 0x43, 0x34, 0x1F, 0x58, 0x15, 0x3C, 0x5C, 0xA0, 0xD8, 0xFD, 0x10, 0x14, 0xE6,
-    0xE2, 0xDC, 0x8C, 0x7E, 0xC9, 0xB7, 0xC3, 0x50, 0xA7, 0x7E, 0x5F, 0xBA, 0x27, 0x6C, 0xA7, 0xC2,
-    0x7D, 0x09, 0x5B, 0x3C, 0x87, 0x78, 0x8A, 0xE9, 0x94, 0x2D, 0x50, 0xFA, 0x10, 0x14, 0x9E, 0xCC,
-    0x2B, 0x7F, 0xDD, 0x98, 0x0D, 0x19, 0x61, 0xBB, 0x19, 0x49, 0x2D, 0xB5, 0x36, 0xE8, 0x9E, 0xBB,
-    0x8E, 0x11, 0x73, 0x3F, 0x11, 0x8A, 0x54, 0xC5, 0x11, 0xD9, 0x5A, 0x0C, 0x72, 0x3C, 0x42, 0x46,
-    0xA2, 0x65, 0x83, 0x4A, 0x65, 0x49, 0x6F, 0xD3, 0x02, 0x6A, 0x00, 0xDC, 0x60, 0xDF, 0x54, 0x7E,
-    0x5D, 0xC9, 0xC9, 0x54, 0xF5, 0x71, 0xFD, 0xFF, 0x51, 0x67, 0x6F, 0x73, 0x49, 0x29, 0xE5, 0x7A,
-    0x88, 0x49, 0x22, 0x7B, 0xCA, 0xFD, 0x63, 0x96, 0x53, 0x80, 0xDB, 0xC3, 0x78, 0x26, 0x0B, 0x34,
-    0x97, 0xC9, 0x1B, 0xF3, 0xB9, 0x1D, 0xC8, 0x10, 0x46, 0x68, 0x62, 0xBE, 0x77, 0xD6, 0x6C, 0x59,
-    0x76, 0x37, 0xC8, 0x51, 0xF9, 0xED, 0x04, 0x6A, 0x3E, 0xA7, 0xAB, 0x93, 0x11, 0x33, 0xA1, 0x7A,
-    0x01, 0x8C, 0xA3, 0x10, 0xFD, 0x4D, 0x70, 0xCC, 0x18, 0xCC, 0x41, 0x93, 0xC8, 0x1A, 0xF4, 0xEB,
-    0x1D, 0x5A, 0xFD, 0x4A, 0xDC, 0xBB, 0x85, 0xB5, 0xEA, 0x64, 0xBF, 0xF6, 0x8D, 0x64, 0x44, 0xCB,
-    0xBD, 0x02, 0xA6, 0x00, 0x01, 0x40, 0x08, 0x10, 0x03, 0xA4, 0x19, 0x44, 0x64, 0x19, 0xEF, 0xEF,
-    0xB4, 0x02, 0xDE, 0x15, 0xF6, 0x22, 0xFD, 0x8D, 0x0C, 0xF4, 0xF4, 0xBD, 0x32, 0x86, 0x59, 0x0D,
-    0x60, 0x0E, 0x80, 0x29, 0xD1, 0x01, 0x40, 0xA1, 0x96, 0xCA, 0xC4, 0x29, 0xC7, 0x2F, 0x8F, 0xAF,
-    0x98, 0x49, 0x3B, 0x01, 0x93, 0xFD, 0x97, 0xE0, 0x5F, 0x41, 0x1D, 0xD1, 0x73, 0x66, 0x63, 0x6F,
-    0x55, 0xA5, 0xFF, 0xA8, 0x6A, 0xE0, 0x17, 0x77, 0x99, 0xB7, 0x50, 0x39, 0xE0, 0x19, 0x54, 0xF0,
-    0xA9, 0x86, 0x5B, 0x4A, 0x2E, 0x4C, 0xFA, 0x5B, 0xA5, 0xD7, 0x5C, 0x3F, 0x8C, 0x3B, 0xBB, 0x87,
-    0xCF, 0x0A, 0x28, 0xD5, 0x0A, 0x21, 0x4D, 0x52, 0x17, 0xDC, 0x11, 0xE0, 0xDE, 0x09, 0x4A, 0x19,
-    0xA1, 0x3C, 0x27, 0x91, 0x18, 0xB3, 0x94, 0xC8, 0x14, 0x60, 0x5E, 0x70, 0xC8, 0xAF, 0x02, 0x4E,
-    0x80, 0x25, 0x18, 0x03, 0x70, 0x3A, 0x80, 0x45, 0xA8, 0x2C, 0xA6, 0x84, 0x8C, 0x11, 0x01, 0x50,
-    0xD0, 0x5A, 0x55, 0xB3, 0x2E, 0x9B, 0x08, 0x92, 0x77, 0x93, 0xC2, 0x10, 0x28, 0x50, 0x48, 0x96,
-    0x40, 0xA1, 0x2C, 0x02, 0x73, 0xC0, 0xDB, 0xC5, 0xEC, 0x5E, 0x23, 0xED, 0x11, 0x7C, 0xD4, 0x48,
-    0xD3, 0x84, 0xFF, 0xD4, 0x48, 0x2B, 0x45, 0x6F, 0x00, 0xC6, 0x02, 0xDF, 0x69, 0xD3, 0xA7, 0xA1,
-    0xFB, 0xC8, 0xA6, 0x80, 0x16, 0x30, 0x6D, 0x01, 0xE3, 0x86, 0xB0, 0x06, 0x0C, 0x2B, 0xC0, 0xA0,
-    0x9C, 0x36, 0x7D, 0xA3, 0x2D, 0x1E, 0x00, 0xAC, 0x5D, 0x01, 0x7B, 0x3B, 0x0F, 0xBC, 0x83, 0xDA,
-    0x9F, 0xD1, 0x5F, 0x2D, 0x27, 0x70, 0xCB, 0x09, 0x9C, 0x84, 0xDD, 0xB3, 0x14, 0x47, 0x28, 0x93,
-    0x53, 0xC0, 0x89, 0x15, 0x40, 0xA7, 0x54, 0x65, 0xFD, 0xBF, 0xA0, 0xB9, 0xD4, 0xD7, 0x17, 0x11,
-    0x2E, 0x0E, 0xEC, 0xCF, 0x75, 0x71, 0xC5, 0x04, 0x6E, 0xA8, 0x18, 0x1A, 0xD0, 0xD7, 0x8F, 0x59,
-    0xBF, 0xA3, 0xBC, 0x82, 0xF9, 0xBA, 0x0C, 0x92, 0xD7, 0xC1, 0x6E, 0xBC, 0xA5, 0x5A, 0x51, 0xE8,
-    0x47, 0xCF, 0xCB, 0xD0, 0x10, 0x26, 0x8B, 0x8A, 0xB7, 0x1C, 0x34, 0x88, 0xC3, 0x6B, 0x15, 0xC8,
-    0x67, 0xF2, 0x45, 0xAE, 0x97, 0x08, 0xD7, 0x21, 0x55, 0xBB, 0xED, 0x15, 0xAC, 0xB7, 0xE5, 0x15,
-    0xD2, 0xDF, 0x59, 0x5C, 0x79, 0xDC, 0xD1, 0xAA, 0xFB, 0x03, 0x33, 0xFA, 0x3E, 0x46, 0x6D, 0x0D,
-    0x42, 0x28, 0xCD, 0x58, 0x87, 0xF6, 0x67, 0x25, 0x74, 0x06, 0x2A, 0x25, 0x82, 0x20, 0xAC, 0x1E,
-    0xB4, 0xC7, 0x40, 0x95, 0xDF, 0x9A, 0x63, 0xA1, 0xBD, 0x57, 0xE3, 0x9E, 0xB1, 0xFA, 0x1D, 0xDC,
-    0xEC, 0x9B, 0x0D, 0xD4, 0x72, 0xBE, 0x04, 0x17, 0xAF, 0x75, 0x3B, 0x89, 0x39, 0xBA, 0x30, 0x74,
-    0x3F, 0xA0, 0x6E, 0x2E, 0xE0, 0x71, 0x29, 0x74, 0xB6, 0xA0, 0x73, 0x01, 0xA5, 0xCF, 0xB0, 0x76,
-    0x2B, 0xC3, 0x98, 0xDE, 0x12, 0x23, 0x4F, 0x5D, 0xB3, 0x9E, 0xFC, 0xCB, 0x5A, 0x2C, 0xF4, 0x32,
-    0xFA, 0x00, 0x54, 0x36, 0xFC, 0x90, 0x42, 0xFF, 0x3D, 0xD5, 0xE9, 0x36, 0xE4, 0x0F, 0x54, 0xEA,
-    0x2D, 0x29, 0x01, 0xAB, 0xA6, 0x20, 0x37, 0x9E, 0xE5, 0x1C, 0x71, 0x49, 0xA4, 0xC6, 0xE2, 0x18,
-    0x35, 0xE3, 0x81, 0x13, 0x8C, 0xAB, 0x5E, 0x6B, 0x30, 0x73, 0xDA, 0xB4, 0xE3, 0xDA, 0x0A, 0xAE,
-    0xBA, 0x47, 0x40, 0x17, 0xDA, 0x44, 0x7D, 0x09, 0x5A, 0xA7, 0xFB, 0x57, 0xF6, 0x5F, 0x8A, 0x0E,
-    0xEC, 0x77, 0x1B, 0xA1, 0x44, 0x51, 0x43, 0xAD, 0x7F, 0x4C, 0x55, 0xBF, 0xB3, 0x2E, 0x24, 0x0E,
-    0x65, 0x54, 0xFB, 0xCF, 0x1D, 0xF2, 0xDF, 0xF1, 0xCA, 0x04, 0xE6, 0x07, 0x69, 0x28, 0x77, 0x7B,
-    0x60, 0x7F, 0xD1, 0x66, 0x8D, 0xDA, 0xDE, 0x4A, 0xD7, 0x49, 0x14, 0xFC, 0xEF, 0x3E, 0x5C, 0x75,
-    0x57, 0x91, 0xB2, 0xB9, 0x71, 0xA5, 0xCC, 0x0A, 0x38, 0xB3, 0x89, 0x7D, 0x0A, 0xCC, 0xCA, 0x9B,
-    0x50, 0x28, 0xDF, 0xC6, 0x50, 0x42, 0x1B, 0x91, 0x6D, 0x09, 0x54, 0xE9, 0x02, 0x3F, 0x07, 0xAD,
-    0x01, 0x08, 0xFA, 0x5B, 0x58, 0x6B, 0x9E, 0xB2, 0x52, 0x91, 0xB1, 0x33, 0xA0, 0x80, 0x5C, 0x96,
-    0x42, 0x19, 0x23, 0x7D, 0x02, 0xF8, 0xB2, 0xC5, 0x27, 0x07, 0x50, 0xA0, 0xAC, 0x01, 0xAC, 0xAE,
-    0x07, 0x80, 0x8D, 0x97, 0x1D, 0x2F, 0x3E, 0x52, 0x51, 0xE6, 0x3E, 0xA0, 0x1C, 0xBB, 0x31, 0xEE,
-    0x18, 0x45, 0xB2, 0x82, 0x7B, 0x68, 0xD7, 0xD1, 0x7D, 0x81, 0xA3, 0x8F, 0x63, 0xA8, 0x7F, 0x1E,
-    0x25, 0x52, 0xE9, 0xFC, 0x40, 0x64, 0x56, 0x6B, 0xF1, 0xF8, 0xB0, 0x8A, 0xD6, 0xF9, 0x61, 0xD8,
-    0x8D, 0xA9, 0x07, 0xE0, 0x33, 0xDB, 0x9E, 0xD4, 0x54, 0x6B, 0xF0, 0x62, 0x56, 0x39, 0xBE, 0x0B,
-    0xF0, 0xEE, 0x39, 0x75, 0xCA, 0x29, 0x08, 0x5B, 0x75, 0xD0, 0xC1, 0xE7, 0x3F, 0x90, 0x6E, 0xC0,
-    0x32, 0x4A, 0x23, 0xE4, 0x00, 0xC2, 0x7E, 0x15, 0x75, 0x60, 0xEE, 0x23, 0xAF, 0x96, 0xE6, 0xAA,
-    0x60, 0xB7, 0x07, 0x72, 0xFE, 0xC4, 0x1E, 0x0A, 0xEF, 0x40, 0x59, 0x2A, 0xEF, 0x92, 0x13, 0xD6,
-    0x84, 0xAD, 0x40, 0x61, 0xB1, 0x71, 0xCD, 0x64, 0x1F, 0x9C, 0x01, 0xEE, 0x41, 0x3C, 0x82, 0xF5,
-    0x8D, 0xB0, 0x04, 0xEC, 0x12, 0x67, 0x8D, 0x3A, 0x9C, 0x80, 0xDF, 0x39, 0xCB, 0x15, 0x2A, 0x07,
-    0xA8, 0x55, 0x6C, 0x4A, 0xEF, 0x6C, 0x29, 0x8B, 0x91, 0xB0, 0xBD, 0xDD, 0x99, 0x10, 0x01, 0x79,
-    0x84, 0x55, 0xFB, 0x9E, 0x93, 0x71, 0x45, 0xDA, 0x75, 0xB4, 0x1F, 0xA4, 0x00, 0x9A, 0xEB, 0xFC,
-    0x5B, 0xCF, 0x60, 0x5A, 0x92, 0x1F, 0x24, 0xCF, 0x37, 0x61, 0x85, 0xF4, 0x18, 0x89, 0xC0, 0xAB,
-    0xB2, 0x6D, 0x5C, 0x27, 0xC2, 0xB7, 0x64, 0x57, 0x69, 0x9F, 0xC5, 0xBC, 0x12, 0x7E, 0xB2, 0xF2,
-    0xB4, 0xFF, 0xF8, 0x0B, 0xAC, 0x5C, 0x06, 0x95, 0x25, 0x78, 0xC9, 0x92, 0x4C, 0x8F, 0x25, 0xB7,
-    0xD4, 0x6D, 0x75, 0x60, 0x86, 0x4A, 0xD2, 0x30, 0xC7, 0x4C, 0x65, 0xD0, 0x2C, 0x40, 0xBE, 0x50,
-    0x66, 0x60, 0x88, 0xF6, 0x14, 0xB9, 0x4B, 0x0A, 0xF7, 0x3E, 0x22, 0x03, 0xE2, 0xF6, 0xC8, 0x66,
-    0xDD, 0xB2, 0x68, 0xF7, 0x20, 0x93, 0x3A, 0x7D, 0xE8, 0xD9, 0x9E, 0xFB, 0x76, 0x2A, 0xD4, 0x02,
-    0x04, 0x55, 0xAE, 0xDE, 0x74, 0x9C, 0xDB, 0x00, 0x68, 0xFB, 0xF8, 0xEB, 0xD0, 0x3A, 0xB0, 0x59,
-    0xC1, 0xC8, 0x54, 0x80, 0x4B, 0x5B, 0xB8, 0x26, 0x04, 0x0B, 0x5D, 0x44, 0xB8, 0x23, 0x05, 0xD7,
-    0x37, 0x52, 0x5D, 0x45, 0xE1, 0xA5, 0x7C, 0x78, 0x17, 0x9A, 0x31, 0x57, 0x80, 0xB4, 0xD7, 0x1B,
-    0x3F, 0x06, 0x29, 0xE3, 0x95, 0xB1, 0x14, 0xDF, 0xCD, 0xE0, 0xF2, 0x07, 0xF5, 0x38, 0xCE, 0xCC,
-    0x7F, 0x19, 0x6D, 0x3F, 0xBE, 0x1A, 0xD0, 0xCF, 0x92, 0x5A, 0x2C, 0x02, 0xCE, 0xE0, 0x25, 0xB8,
-    0x6A, 0xA5, 0x9D, 0xFC, 0xB7, 0x67, 0x21, 0xAA, 0x8B, 0x10, 0x22, 0xC4, 0x97, 0x2D, 0x2E, 0x3D,
-    0xB9, 0x67, 0x65, 0x81, 0x5A, 0x44, 0x02, 0x12, 0x2E, 0x55, 0x41, 0x4B, 0xCF, 0x29, 0x3A, 0x4E,
-    0x1D, 0x15, 0x78, 0xFF, 0xAD, 0x25, 0x93, 0x40, 0x7B, 0x13, 0xBD, 0xE8, 0x2C, 0x6D, 0xF9, 0xB9,
-    0x33, 0x81, 0x5C, 0xDC, 0x86, 0x8E, 0x43, 0xFD, 0x03, 0xE1, 0xF4, 0x08, 0x1D, 0x78, 0x32, 0xE0,
-    0x8F, 0x3F, 0x25, 0x69, 0x77, 0x74, 0x65, 0x8D, 0xA5, 0x7A, 0xF1, 0x57, 0x30, 0xD7, 0x78, 0x9F,
-    0xCB, 0x4C, 0xF9, 0x22, 0x3D, 0x6E, 0x6D, 0x26, 0x54, 0xC5, 0x97, 0x6C, 0x67, 0x61, 0x2D, 0x76,
-    0xF7, 0xB3, 0x54, 0x5F, 0x79, 0x01, 0x2D, 0xBF, 0x1D, 0xAA, 0x62, 0x52, 0xC4, 0x86, 0xD3, 0xCA,
-    0xD4, 0xA0, 0xBC, 0x0E, 0x74, 0xAA, 0x42, 0xD7, 0x42, 0x3F, 0x90, 0x9B, 0xD3, 0x5C, 0x58, 0xE1,
-    0xE6, 0x5A, 0x9E, 0x95, 0x23, 0xFB, 0x5F, 0x2A, 0xAD, 0x65, 0xD4, 0x74, 0xB4, 0x94, 0xD8, 0x46,
-    0x42, 0x44, 0xB1, 0xBE, 0xC6, 0xB9, 0x3A, 0x0E, 0x63, 0x6A, 0x3D, 0xE8, 0xF7, 0x98, 0xDC, 0xF4,
-    0xDD, 0x45, 0xFC, 0x8B, 0x02, 0x7F, 0xDF, 0xCD, 0xBF, 0x30, 0x76, 0xCD, 0x36, 0xED, 0x3E, 0xCE,
-    0x1F, 0x3C, 0x0D, 0x9D, 0x51, 0x97, 0xD6, 0xDD, 0xDE, 0xF1, 0x30, 0xCB, 0x3F, 0xC9, 0xDF, 0x08,
-    0xC6, 0xDC, 0x05, 0xF4, 0x01, 0x9D, 0xC9, 0x6E, 0x9A, 0xA1, 0xDE, 0xA1, 0x3C, 0x10, 0xEF, 0x3A,
-    0x83, 0xD0, 0x3C, 0xF6, 0xF8, 0xCE, 0x39, 0xC5, 0x5C, 0x30, 0x88, 0xC1, 0xA2, 0xA8, 0x59, 0x0F,
-    0xF8, 0xCE, 0x05, 0xC5, 0x25, 0xB4, 0x49, 0xC0, 0x42, 0xC4, 0x46, 0x10, 0x1A, 0xC7, 0x34, 0xCA,
-    0xC7, 0xE5, 0x14, 0x1A, 0x46, 0x13, 0x83, 0xD8, 0xAA, 0x12, 0xB1, 0x35, 0x6A, 0x0C, 0xAC, 0x40,
-    0x2C, 0xE2, 0x5E, 0xDB, 0xB8, 0xE2, 0x8C, 0xA6, 0xE2, 0xFF, 0x83, 0xD1, 0xDE, 0x55, 0xBB, 0xFB,
-    0x4B, 0xB7, 0x80, 0xBA, 0xF5, 0xB2, 0xF2, 0x8B, 0x3A, 0x2E, 0x09, 0x5B, 0xA2, 0x59, 0x37, 0x44,
-    0x01, 0x3F, 0xDC, 0xD5, 0x4B, 0x60, 0xD5, 0x23, 0x2A, 0x88, 0xBA, 0x27, 0x62, 0xFA, 0x6E, 0x5C,
-    0xF1, 0x5A, 0x53, 0xF6, 0x03, 0xDD, 0x46, 0xF0, 0xCC, 0x49, 0xBD, 0xDE, 0x4E, 0x8F, 0x46, 0x04,
-    0x1F, 0xD0, 0xF2, 0xA8, 0xA7, 0xE5, 0x23, 0x2E, 0xBE, 0x69, 0xF2, 0x78, 0x74, 0x0C, 0x17, 0xE7,
-    0x60, 0x68, 0xE2, 0x05, 0xD8, 0x1B, 0x67, 0xD0, 0xA4, 0x6D, 0x72, 0x4A, 0x26, 0xD5, 0x6C, 0x6D,
-    0xAF, 0x8E, 0x99, 0x27, 0x5B, 0x00, 0x3A, 0xA2, 0xE8, 0xFF, 0xF0, 0xDA, 0x01, 0x6A, 0xAF, 0xD9,
-    0x3B, 0x6B, 0x00, 0x1C, 0xBB, 0x1A, 0x78, 0xE8, 0x84, 0x40, 0xAC, 0x76, 0x9E, 0x01, 0xA6, 0xD1,
-    0x87, 0x2E, 0x09, 0x11, 0x31, 0x80, 0x34, 0x5A, 0x04, 0x0F, 0x63, 0xF9, 0x28, 0xA4, 0xAE, 0x2C,
-    0xAA, 0xE0, 0x33, 0xD5, 0xC2, 0x73, 0x4B, 0x84, 0x72, 0xF4, 0xD2, 0x0C, 0x5A, 0x69, 0xCE, 0x6C,
-    0x60, 0x74, 0xBF, 0x10, 0x5A, 0x2A, 0x4F, 0x9F, 0xB2, 0x2A, 0x06, 0x5C, 0x6F, 0xD5, 0xD4, 0xF0,
-    0x46, 0x63, 0xDF, 0x86, 0x3E, 0xF8, 0xFD, 0x5A, 0x44, 0x70, 0xA9, 0xD0, 0xBD, 0x2A, 0xFE, 0xA8,
-    0xC3, 0x52, 0x59, 0x86, 0xEA, 0x80, 0x52, 0x68, 0xA4, 0x02, 0x7C, 0x1F, 0x2A, 0xB4, 0xA5, 0x88,
-    0x4A, 0x05, 0x5D, 0xA4, 0x46, 0xCB, 0x68, 0x01, 0x6D, 0x3A, 0x0E, 0x70, 0xC5, 0xF4, 0x30, 0x70,
-    0x38, 0x57, 0x9C, 0xE5, 0xD4, 0xF7, 0xC8, 0x25, 0x53, 0x76, 0x7B, 0x5A, 0xCE, 0x38, 0x08, 0xE0,
-    0x0B, 0x46, 0x45, 0x63, 0x25, 0xCB, 0xDB, 0xB4, 0x1D, 0xCB, 0xDA, 0x53, 0x99, 0x89, 0x70, 0x96,
-    0x4D, 0x04, 0x85, 0x63, 0x40, 0x3B, 0xDD, 0xC8, 0x5E, 0xF8, 0xB0, 0x4D, 0xA1, 0xFD, 0xCF, 0xDE,
-    0xA1, 0x93, 0x6C, 0x0A, 0x9A, 0x99, 0x60, 0x9D, 0x4C, 0x32, 0x2A, 0xAF, 0xAD, 0x7A, 0x0D, 0x48,
-    0x99, 0xD4, 0x63, 0xD3, 0xC5, 0xCE, 0x79, 0xAC, 0x13, 0xEE, 0xD8, 0xDD, 0x97, 0x8D, 0x3A, 0x49,
-    0xAE, 0xC0, 0xE1, 0x70, 0x71, 0x8E, 0xED, 0xCA, 0xD0, 0xAB, 0xDD, 0x55, 0xFD, 0xD9, 0xED, 0x2D,
-    0xF0, 0xD6, 0x74, 0x4E, 0x1F, 0xFA, 0xAA, 0xF7, 0xE7, 0xFC, 0x1C, 0x1E, 0xEB, 0xCE, 0x2D, 0x44,
-    0x45, 0x15, 0xB5, 0xC5, 0x59, 0xBB, 0xB7, 0x5A, 0x13, 0x0F, 0x73, 0x33, 0xB8, 0xB0, 0x87, 0x27,
-    0x69, 0x27, 0xDA, 0x7F, 0xE5, 0xB2, 0x56, 0x5A, 0x75, 0x3C, 0xE5, 0xC6, 0xF9, 0x7D, 0xF5, 0x81,
-    0x8D, 0xDD, 0x0A, 0xDB, 0xBE, 0xAF, 0x26, 0xDB, 0x03, 0x6B, 0xCD, 0x28, 0xA3, 0xF6, 0x16, 0xD6,
-    0x06, 0xB5, 0x85, 0x34, 0x6A, 0x1A, 0xA9, 0x61, 0x29, 0xC9, 0x37, 0x2A, 0x7A, 0x4E, 0x99, 0x13,
-    0xB4, 0xA3, 0x78, 0xEB, 0xBB, 0x5A, 0x6B, 0xF0, 0xD0, 0xEC, 0xCE, 0xE6, 0xA6, 0x19, 0x3A, 0xC7,
-    0x2F, 0xD1, 0xAE, 0xDD, 0xDB, 0xB9, 0x82, 0xD9, 0x5B, 0x0E, 0x6E, 0xF0, 0xB7, 0xC7, 0x5A, 0x18,
-    0xDD, 0x41, 0x60, 0x9A, 0xC9, 0x47, 0xAF, 0x38, 0x0B, 0x11, 0x5E, 0x81, 0x88, 0x32, 0x01, 0xCD,
-    0x49, 0xFA, 0xCE, 0x1A, 0x0C, 0x22, 0x1C, 0x3F, 0xBC, 0x2F, 0x45, 0xFE, 0xCD, 0x61, 0x4E, 0x90,
-    0x81, 0x84, 0x60, 0x8E, 0x3C, 0xB0, 0xDF, 0x79, 0x25, 0xCB, 0x41, 0x82, 0xB3, 0x9C, 0xBA, 0xF8,
-    0x22, 0x56, 0x1D, 0xBD, 0x63, 0x09, 0x7B, 0xB8, 0x97, 0x09, 0x63, 0x94, 0x41, 0xC3, 0xE6, 0xAF,
-    0xC4, 0x5D, 0xC7, 0x50, 0xC2, 0xCF, 0x5E, 0x85, 0x2D, 0x01, 0xA5, 0x8D, 0x08, 0xA5, 0x4D, 0x28,
-    0x82, 0xC1, 0x64, 0x12, 0xB7, 0xBD, 0x06, 0x92, 0xCD, 0xEF, 0xD0, 0x9C, 0x3C, 0x33, 0xC6, 0xA2,
-    0x99, 0xB4, 0x94, 0xEC, 0xA6, 0x0D, 0x98, 0x32, 0x33, 0xAB, 0x11, 0xA9, 0x63, 0x82, 0x32, 0xA8,
-    0x68, 0x48, 0xE1, 0x24, 0x77, 0x01, 0x50, 0x14, 0x73, 0xB4, 0x72, 0x28, 0xE4, 0x36, 0xDC, 0x17,
-    0x46, 0x36, 0xA8, 0xB2, 0xB9, 0x0C, 0xF5, 0xA0, 0x92, 0xD2, 0x26, 0x6D, 0x50, 0x49, 0x69, 0xB3,
-    0x26, 0xA8, 0x64, 0xDC, 0x07, 0x75, 0x50, 0x85, 0xA5, 0x09, 0xAB, 0x00, 0xB3, 0x22, 0x92, 0x22,
-    0x67, 0xA0, 0xBB, 0x41, 0x25, 0xB2, 0x7E, 0x9A, 0x07, 0x95, 0xBA, 0xC6, 0x55, 0xE3, 0xDE, 0x8D,
-    0x5C, 0x29, 0xE0, 0x84, 0xB5, 0x9F, 0x2A, 0x91, 0xFB, 0x88, 0x76, 0xBD, 0x0F, 0xE8, 0x7D, 0x93,
-    0xD3, 0x19, 0x70, 0x91, 0xC1, 0x04, 0x34, 0xE7, 0x3C, 0xB2, 0xB4, 0xB5, 0x61, 0x84, 0x4E, 0xD4,
-    0xF2, 0xDA, 0x64, 0x6F, 0xD5, 0xF2, 0x0E, 0xE9, 0x1B, 0x32, 0x1B, 0xAB, 0xF4, 0x7A, 0x2B, 0x4F,
-    0x4D, 0x5F, 0x97, 0x59, 0x55, 0xA4, 0xAF, 0x89, 0x28, 0x91, 0xA7, 0xD4, 0xF8, 0xA7, 0x0B, 0x12,
-    0x65, 0x92, 0x00, 0xF6, 0x13, 0x3D, 0x48, 0x85, 0x3A, 0x54, 0xCE, 0xA9, 0x50, 0xCD, 0x80, 0xE1,
-    0x87, 0xF4, 0xDA, 0x30, 0xF1, 0xEF, 0x5B, 0xC5, 0xAF, 0x59, 0xE2, 0x6C, 0xAE, 0x58, 0x26, 0xAD,
-    0x0C, 0xD3, 0x1B, 0xCF, 0x58, 0x46, 0x81, 0x38, 0x11, 0xDA, 0x5B, 0xAF, 0x5D, 0x9C, 0x85, 0x8C,
-    0xA6, 0x6B, 0x9D, 0xBD, 0x4D, 0xF3, 0x61, 0x69, 0x7F, 0x02, 0xF3, 0x5D, 0x54, 0xDA, 0x4B, 0x30,
-    0xE7, 0xC5, 0x85, 0xBD, 0x04, 0xD7, 0x3E, 0xA9, 0xD3, 0x73, 0x74, 0x45, 0x44, 0xDD, 0x12, 0x42,
-    0xA9, 0xA3, 0x7D, 0x1D, 0xD6, 0x04, 0xA9, 0x27, 0xDC, 0x14, 0xE7, 0x72, 0xED, 0x1B, 0x6A, 0xBD,
-    0x80, 0x85, 0x42, 0xAD, 0x33, 0xDE, 0xF3, 0xDE, 0x30, 0xEC, 0x2A, 0xC5, 0x4C, 0x58, 0x10, 0xC7,
-    0x78, 0x2F, 0xE0, 0xF7, 0x4A, 0xE2, 0xEC, 0xA7, 0x15, 0xB1, 0x85, 0x72, 0x38, 0x95, 0x39, 0x32,
-    0x69, 0x54, 0xBD, 0x8A, 0xDE, 0x54, 0x26, 0xC6, 0x63, 0x59, 0xB9, 0x77, 0xAF, 0xDD, 0x83, 0x43,
-    0x5E, 0xBA, 0x88, 0x3E, 0xE8, 0xA4, 0x2B, 0xD3, 0x45, 0xFC, 0x4E, 0x27, 0x23, 0x23, 0x5D, 0xA4,
-    0xAF, 0x77, 0xD2, 0x99, 0x52, 0xDB, 0xD7, 0x3B, 0xE9, 0x4D, 0xC1, 0x7F, 0xD1, 0x49, 0x77, 0x4A,
-    0xEB, 0x8E, 0xBB, 0x89, 0xF4, 0xE7, 0xF5, 0x6E, 0xDC, 0x31, 0x02, 0x88, 0xE5, 0xAD, 0xA2, 0x91,
-    0x53, 0x7B, 0x08, 0xCF, 0x9D, 0xAA, 0xB9, 0x03, 0xEB, 0x23, 0xED, 0x32, 0xE8, 0x6E, 0x2E, 0x6D,
-    0x23, 0xFB, 0xD3, 0x66, 0xA9, 0x56, 0x90, 0xC9, 0x5D, 0x1B, 0x1F, 0x11, 0x42, 0x8B, 0x70, 0xD1,
-    0x87, 0xBB, 0xD9, 0xDF, 0xDB, 0x08, 0xFE, 0x48, 0x97, 0x2C, 0x7D, 0x95, 0x26, 0x76, 0xDA, 0x11,
-    0xC1, 0xA2, 0x29, 0xF2, 0x3E, 0x75, 0x1D, 0x58, 0x2A, 0xE6, 0xD4, 0xD9, 0xC9, 0x5C, 0xAD, 0x69,
-    0x95, 0x73, 0xD2, 0x2F, 0x91, 0xF7, 0xFA, 0x0A, 0xAD, 0xB3, 0x55, 0x3A, 0x19, 0x0D, 0x2B, 0x38,
-    0xDC, 0x20, 0xD9, 0xF4, 0xF2, 0xDC, 0x77, 0xB8, 0x5E, 0x7F, 0xD4, 0xF6, 0x8B, 0x2E, 0x59, 0x9C,
-    0x11, 0x57, 0xC3, 0x09, 0x2B, 0x25, 0x23, 0xEE, 0xA7, 0x32, 0xD2, 0xAB, 0xEC, 0x27, 0xB5, 0x4C,
-    0x9A, 0xEC, 0x92, 0x2C, 0x69, 0x45, 0x26, 0xFD, 0x1B, 0xE7, 0xD9, 0x73, 0x1D, 0x06, 0xEB, 0x1C,
-    0xFE, 0xAC, 0x19, 0x7B, 0x36, 0x76, 0x43, 0xE2, 0x80, 0x93, 0x50, 0x3D, 0x90, 0xC1, 0x3A, 0x6E,
-    0x3E, 0x4B, 0x2A, 0x3D, 0xB6, 0x64, 0xFF, 0xF8, 0x61, 0xA0, 0x03, 0x12, 0xA1, 0x5E, 0xCB, 0x50,
-    0x15, 0x38, 0xE0, 0x5F, 0xE0, 0xF2, 0x61, 0x9D, 0xA7, 0x92, 0x3B, 0xA9, 0x4D, 0x1F, 0xF6, 0x83,
-    0xE1, 0xE7, 0x48, 0xA8, 0x50, 0xC3, 0xF8, 0x03, 0x96, 0x06, 0x5F, 0x17, 0x9E, 0x40, 0x19, 0xCF,
-    0xB5, 0xCE, 0x45, 0x86, 0xC1, 0x14, 0x4D, 0x03, 0x28, 0x06, 0x63, 0x5C, 0x86, 0xB5, 0x3B, 0x41,
-    0x47, 0xBD, 0x8E, 0xC1, 0x07, 0xCB, 0xD6, 0x75, 0xAE, 0xC8, 0x9D, 0x3B, 0x19, 0x86, 0x80, 0x80,
-    0x2E, 0x94, 0x8A, 0x8A, 0x94, 0xAF, 0x26, 0x63, 0x9B, 0xD3, 0x3B, 0x5D, 0x4C, 0x1B, 0x8C, 0x11,
-    0x79, 0x29, 0x0E, 0x1D, 0x59, 0x00, 0x4B, 0x1D, 0x71, 0xB9, 0xA2, 0xDA, 0x8F, 0xC7, 0x94, 0xF5,
-    0x4D, 0xE4, 0xF6, 0x77, 0x1B, 0x11, 0x91, 0x17, 0xF1, 0xF5, 0x26, 0xC6, 0x7C, 0xBD, 0xD4, 0x44,
-    0x98, 0xBC, 0x93, 0x26, 0x2C, 0x65, 0x26, 0x4F, 0xE0, 0xFF, 0xF9, 0x7A, 0x37, 0x69, 0x66, 0x98,
-    0xE3, 0x93, 0x46, 0x06, 0xF6, 0x39, 0x73, 0x5A, 0x26, 0x1F, 0xBD, 0x58, 0x5F, 0xB7, 0x97, 0x85,
-    0xBB, 0xE2, 0x32, 0x5F, 0x20, 0x04, 0x4F, 0xDD, 0x32, 0xE6, 0xF4, 0x89, 0x45, 0x3B, 0x57, 0xB3,
-    0x9B, 0x26, 0xAD, 0xC7, 0x3E, 0x94, 0x8F, 0xA0, 0x56, 0x16, 0xF8, 0xE4, 0x79, 0xA9, 0x51, 0x8C,
-    0x46, 0xA5, 0xEA, 0x34, 0x46, 0xAB, 0x9E, 0xB9, 0x46, 0xAA, 0x94, 0xF2, 0xBA, 0x76, 0x85, 0x67,
-    0x0F, 0x5C, 0x08, 0xE1, 0x57, 0xAE, 0x51, 0x6E, 0x04, 0xB7, 0xA1, 0x0A, 0x49, 0xE1, 0x2C, 0xA1,
-    0xFE, 0x4A, 0x97, 0xCE, 0x0B, 0xDD, 0xD5, 0x8E, 0x6A, 0x2D, 0x06, 0x5D, 0x24, 0x30, 0x82, 0xF7,
-    0xFC, 0xED, 0x49, 0x33, 0x85, 0x11, 0x7C, 0xD4, 0x21, 0xC4, 0x2C, 0xFB, 0x05, 0x64, 0x52, 0x52,
-    0x23, 0x75, 0xD6, 0xEE, 0x38, 0x3C, 0x93, 0xE9, 0x0B, 0x1B, 0x24, 0xDA, 0x3D, 0xF8, 0x2A, 0x55,
-    0x01, 0x8D, 0xD3, 0xEF, 0x46, 0xA4, 0xCC, 0xE7, 0x6D, 0xEF, 0xC6, 0x91, 0x39, 0x97, 0x8D, 0x93,
-    0xD7, 0x9C, 0x0D, 0x3B, 0x74, 0xAE, 0x15, 0x32, 0x95, 0x6F, 0x9D, 0x25, 0x3D, 0xF0, 0x60, 0xEF,
-    0xDA, 0x4D, 0xA5, 0xF0, 0x34, 0xDC, 0x8F, 0x9D, 0x82, 0xF2, 0x98, 0x0C, 0xE1, 0x69, 0x0D, 0x49,
-    0xAB, 0x98, 0x35, 0x24, 0x41, 0x0F, 0x87, 0x78, 0xDF, 0x68, 0x89, 0x64, 0x25, 0x81, 0xBB, 0x5A,
-    0x3D, 0xA3, 0xB4, 0x62, 0xFF, 0xB2, 0xD9, 0x6A, 0x55, 0xD7, 0x5E, 0xAB, 0x13, 0x5F, 0xA9, 0xF3,
-    0x7B, 0x4E, 0x4F, 0x3B, 0x8A, 0x90, 0x33, 0x55, 0x94, 0x1E, 0x01, 0xE9, 0x0A, 0x1B, 0x95, 0x47,
-    0x83, 0x99, 0x90, 0xE0, 0xB0, 0x06, 0x0C, 0x9A, 0x25, 0x9C, 0x29, 0x6C, 0x01, 0xA7, 0x0A, 0xBB,
-    0x25, 0x9C, 0x74, 0x2B, 0x9F, 0xE4, 0xB8, 0x32, 0x2D, 0x71, 0x6F, 0x5C, 0xCB, 0x12, 0x53, 0x47,
-    0x7C, 0x85, 0x80, 0x43, 0x7A, 0xAC, 0x94, 0x74, 0x4B, 0x5F, 0xC3, 0x69, 0x43, 0xCB, 0xA3, 0x42,
-    0xEF, 0x8A, 0x3A, 0x27, 0x75, 0xAA, 0xDD, 0x72, 0xCB, 0x32, 0x85, 0xCF, 0x90, 0xC2, 0xA1, 0x0F,
-    0x93, 0x41, 0x85, 0xC1, 0x1B, 0xD5, 0x8C, 0x02, 0x19, 0xF8, 0xFD, 0xC2, 0x87, 0x16, 0xDC, 0xD5,
-    0x01, 0x50, 0xBF, 0xE5, 0x95, 0x7A, 0x17, 0x4A, 0x08, 0x6B, 0x94, 0x06, 0xCD, 0x9E, 0x08, 0xD3,
-    0xE5, 0xC4, 0x51, 0x21, 0xD6, 0x5F, 0xD5, 0xAF, 0x63, 0x65, 0xBA, 0xA8, 0xD7, 0xDB, 0x6F, 0xFA,
-    0x93, 0x2A, 0xFE, 0x7C, 0x60, 0xFA, 0x2B, 0x28, 0x01, 0xA4, 0xA4, 0x03, 0x4B, 0xB0, 0xB7, 0x93,
-    0xF5, 0xA6, 0xBF, 0xAC, 0x80, 0xAF, 0xA5, 0xF0, 0x2C, 0xB7, 0x0F, 0x36, 0xFD, 0x61, 0xD8, 0xCE,
-    0xEE, 0x42, 0x0D, 0x16, 0x77, 0x64, 0x75, 0x08, 0x6D, 0x47, 0x17, 0x84, 0xFF, 0xA3, 0xBE, 0xA9,
-    0x80, 0x1A, 0x0E, 0x48, 0x27, 0x55, 0xF7, 0x21, 0x86, 0x91, 0xFA, 0x2B, 0xCC, 0x95, 0x4A, 0x82,
-    0x8C, 0xA7, 0x39, 0xC9, 0x78, 0xA1, 0x41, 0xE3, 0x6C, 0xD3, 0x3F, 0x50, 0x82, 0xFA, 0x17, 0xDB,
-    0x8B, 0x60, 0x53, 0x27, 0x82, 0x35, 0x3D, 0xEB, 0xE1, 0x45, 0x30, 0xE7, 0x3F, 0xF1, 0x65, 0xE8,
-    0x38, 0xA0, 0xFA, 0x2C, 0xE1, 0x8F, 0x03, 0x4F, 0x11, 0xCA, 0x7A, 0xF1, 0x3D, 0x3C, 0x94, 0xEE,
-    0x88, 0x1A, 0x40, 0x86, 0x69, 0x39, 0xE9, 0xC0, 0xCD, 0x8C, 0xB9, 0xA4, 0x8D, 0xEC, 0xD3, 0x64,
-    0xCD, 0x7F, 0x82, 0x92, 0xC1, 0x97, 0x18, 0x5D, 0x92, 0x55, 0x37, 0x26, 0x4D, 0x97, 0x1B, 0x67,
-    0x98, 0x41, 0x98, 0x86, 0x17, 0xF1, 0x36, 0x5E, 0x86, 0x3C, 0x3A, 0x65, 0x4F, 0x81, 0xB9, 0x42,
-    0x93, 0x5F, 0x22, 0x13, 0xB4, 0x20, 0xDD, 0x29, 0xA2, 0x55, 0x81, 0xF4, 0x49, 0x6B, 0xB1, 0x33,
-    0x7F, 0xBB, 0xC3, 0xB1, 0x4C, 0x0B, 0x57, 0x1D, 0x43, 0xA3, 0xD0, 0x84, 0x68, 0xC9, 0x6C, 0x4A,
-    0x8E, 0x32, 0x59, 0x51, 0x2D, 0x3C, 0xDE, 0xB6, 0x1D, 0xFE, 0x8C, 0x97, 0x0A, 0xA1, 0xC8, 0x69,
-    0xA5, 0x7A, 0x51, 0x46, 0xE3, 0xA1, 0xAD, 0xE3, 0x96, 0x11, 0xC6, 0x70, 0xDA, 0x99, 0x8E, 0x02,
-    0xEB, 0xC2, 0x6C, 0x74, 0xF5, 0xB0, 0xB9, 0x34, 0xBC, 0xCC, 0x42, 0x86, 0xCD, 0xD1, 0xA5, 0x48,
-    0xAD, 0xB7, 0x02, 0x09, 0xE0, 0x4F, 0x54, 0x83, 0xA7, 0x67, 0x70, 0x53, 0xE0, 0x02, 0x40, 0xE4,
-    0x32, 0x3A, 0xCB, 0xEA, 0x29, 0x1C, 0xB0, 0x12, 0xBD, 0x80, 0x3C, 0x8C, 0xDE, 0x26, 0x32, 0x6E,
-    0xE7, 0x4E, 0xE5, 0x2D, 0x5B, 0x9A, 0x05, 0xA0, 0x31, 0x7E, 0xAB, 0xD1, 0x07, 0x0B, 0x19, 0x7F,
-    0x8F, 0xF1, 0x45, 0x90, 0x9B, 0xE2, 0xDB, 0x08, 0x98, 0xCD, 0xF1, 0xA6, 0x22, 0xF2, 0xFA, 0xAA,
-    0x07, 0x4B, 0x51, 0x6B, 0xC6, 0xEE, 0x24, 0xF7, 0x34, 0x75, 0x24, 0x36, 0x71, 0x7E, 0x59, 0xEA,
-    0x04, 0x37, 0x68, 0x9E, 0xE9, 0x52, 0x97, 0xB0, 0x34, 0x34, 0x9A, 0xB4, 0x5E, 0x66, 0x3A, 0x28,
-    0x97, 0xA7, 0xF9, 0xF2, 0xB4, 0x5F, 0xCF, 0xE8, 0x80, 0xA7, 0xC4, 0xC2, 0xC9, 0x1E, 0x0C, 0x18,
-    0xC1, 0x3B, 0xD9, 0x56, 0x03, 0x48, 0xB8, 0x08, 0x82, 0x5B, 0x16, 0x09, 0xEA, 0x59, 0xA7, 0x72,
-    0x88, 0x68, 0x80, 0x2C, 0xB5, 0x31, 0x84, 0xB6, 0x56, 0xCA, 0xA7, 0x49, 0xB3, 0xD5, 0x13, 0x3A,
-    0xD1, 0xA0, 0x01, 0xA5, 0xDD, 0xE8, 0x4A, 0x30, 0x6D, 0xA9, 0x83, 0x42, 0x9B, 0x91, 0x1B, 0x2D,
-    0x59, 0x7C, 0x58, 0x3A, 0x5D, 0x84, 0x65, 0x5F, 0x30, 0x5E, 0x05, 0x42, 0x17, 0x63, 0xC3, 0x52,
-    0xB2, 0xF6, 0x57, 0x19, 0x29, 0x34, 0x57, 0x85, 0xBA, 0xB4, 0x56, 0xE2, 0x28, 0x10, 0x23, 0xFA,
-    0xD5, 0x54, 0xDA, 0x79, 0x3F, 0xF4, 0xE5, 0xEB, 0x87, 0x43, 0x8B, 0xAB, 0x1F, 0x2A, 0x65, 0xAF,
-    0xE4, 0xCC, 0xFB, 0x33, 0x6F, 0x60, 0xCC, 0xFA, 0x46, 0xCC, 0x94, 0x8A, 0x8C, 0x54, 0x2B, 0xAA,
-    0xFE, 0x19, 0x42, 0xDE, 0x0B, 0xE5, 0x3E, 0x3B, 0xEF, 0xE9, 0xA0, 0x3C, 0x32, 0xFA, 0xEE, 0x5E,
-    0x47, 0x96, 0xF4, 0xB9, 0x2A, 0xD6, 0x64, 0x0B, 0x81, 0xA5, 0x56, 0x5D, 0x26, 0x09, 0x54, 0xD9,
-    0xB4, 0x2D, 0x1B, 0xE7, 0xEA, 0x6D, 0x34, 0x2A, 0xE2, 0x00, 0xC4, 0xEF, 0xE6, 0x7A, 0xC3, 0x5C,
-    0x6F, 0x4F, 0x42, 0x2D, 0x4C, 0x24, 0xCE, 0xCB, 0x11, 0x7C, 0xFB, 0xDF, 0x6F, 0x75, 0xB9, 0xF7,
-    0x5E, 0x61, 0x54, 0xD6, 0xEB, 0xA0, 0x97, 0x0A, 0xDE, 0x5C, 0x56, 0xD7, 0x8C, 0x2B, 0xB3, 0xEF,
-    0x27, 0x5E, 0xC6, 0x2A, 0x87, 0xDE, 0x7C, 0xBE, 0x70, 0x0E, 0xB0, 0xCA, 0x50, 0x47, 0x4D, 0x1A,
-    0x40, 0x9D, 0x03, 0xEF, 0x74, 0xF5, 0x95, 0x4C, 0x15, 0x16, 0x03, 0xC8, 0x4F, 0xF4, 0xDB, 0xB8,
-    0xFA, 0x32, 0x74, 0x69, 0x4D, 0x7A, 0xA1, 0x65, 0x09, 0xB5, 0x13, 0xEA, 0x9C, 0x57, 0xDC, 0xCC,
-    0x45, 0x12, 0x70, 0x9C, 0x7D, 0x4B, 0x2B, 0x71, 0xCA, 0x2B, 0x04, 0x6C, 0xE7, 0x67, 0xB5, 0xDD,
-    0xEB, 0xA7, 0xAF, 0x9E, 0x54, 0x33, 0x3D, 0x19, 0xFF, 0xCF, 0xCA, 0x39, 0x4D, 0xCD, 0x7C, 0x6F,
-    0x4E, 0x5B, 0xFF, 0x36, 0xFD, 0x49, 0xFF, 0x95, 0x77, 0x9E, 0xDB, 0xF0, 0x34, 0x60, 0xDB, 0x44,
-    0x0C, 0xFF, 0xA3, 0xBB, 0x29, 0xC5, 0xCE, 0x66, 0xEC, 0x2A, 0x09, 0xDF, 0x21, 0x2C, 0x88, 0xC9,
-    0xAF, 0xCC, 0xE5, 0xD0, 0x2A, 0x5B, 0x88, 0x9E, 0xD2, 0x61, 0x33, 0xEE, 0xE5, 0x35, 0xED, 0x9F,
-    0x03, 0x4F, 0x54, 0xB2, 0xF7, 0x27, 0xD0, 0xCB, 0xF2, 0x44, 0x45, 0x80, 0xFE, 0x04, 0xDE, 0x77,
-    0x3C, 0x09, 0xE9, 0x72, 0x09, 0x19, 0x87, 0x8E, 0xC9, 0x08, 0xD1, 0xB0, 0x2E, 0x10, 0x60, 0x6A,
-    0x8B, 0xC8, 0xCE, 0x53, 0x17, 0x49, 0xE4, 0x35, 0x27, 0xDA, 0x92, 0x42, 0xE9, 0x2E, 0xD0, 0x0F,
-    0x75, 0x0A, 0x86, 0x95, 0xD5, 0x3C, 0xEE, 0xB3, 0x0F, 0xF8, 0x9C, 0x15, 0x7E, 0x26, 0x67, 0x8E,
-    0x40, 0xFA, 0xB4, 0x0A, 0xED, 0x54, 0xF1, 0xCB, 0xAF, 0x9C, 0x9A, 0x9B, 0x3E, 0x4E, 0x79, 0x19,
-    0x02, 0xD1, 0x1B, 0x74, 0x62, 0xF7, 0xB9, 0x6B, 0x4A, 0x97, 0x60, 0xE2, 0xF8, 0x4B, 0xF8, 0xE3,
-    0x1C, 0x49, 0x55, 0x7A, 0x12, 0x4C, 0xF3, 0x09, 0x9A, 0x54, 0xC6, 0xD0, 0xFF, 0x36, 0x5F, 0xDA,
-    0xEA, 0xD4, 0xF3, 0x60, 0xAA, 0x54, 0x90, 0x83, 0xBD, 0xD4, 0x16, 0x4C, 0x55, 0x37, 0x0A, 0xBC,
-    0x33, 0x57, 0x4C, 0x3F, 0x00, 0xE2, 0x31, 0x57, 0x30, 0xC5, 0x15, 0x35, 0x59, 0x49, 0x24, 0x9D,
-    0x53, 0x22, 0x2C, 0xC2, 0x49, 0x42, 0xF2, 0x9C, 0x7B, 0x8E, 0xBD, 0xFD, 0xAD, 0x63, 0x36, 0x93,
-    0x88, 0xA3, 0xF7, 0x2C, 0xFF, 0xCC, 0x4A, 0x26, 0x99, 0x21, 0x0E, 0xCF, 0xFF, 0x23, 0x7B, 0xE6,
-    0x4B, 0x93, 0x79, 0x71, 0xC0, 0x34, 0xF8, 0xBC, 0xEB, 0x3E, 0x47, 0x3B, 0x3B, 0x54, 0xC2, 0x8F,
-    0x07, 0x21, 0xB0, 0xEC, 0xDF, 0xEA, 0xCF, 0x03, 0xBE, 0xE1, 0x7F, 0xFA, 0xDA, 0xC6, 0xFE, 0xD7,
-    0x7E, 0xF2, 0x74, 0xA5, 0xA6, 0xCF, 0xB8, 0xA2, 0x6A, 0x03, 0xD5, 0x1A, 0x38, 0xDD, 0xA7, 0x70,
-    0x29, 0xA3, 0x86, 0x9C, 0xC0, 0x31, 0x47, 0xDF, 0x75, 0x6A, 0xEA, 0x52, 0xA5, 0x34, 0x5D, 0xE7,
-    0xDF, 0x01, 0xB0, 0x32, 0x3E, 0xEA, 0xCB, 0xF9, 0xC5, 0xE8, 0xFC, 0xE6, 0x8A, 0x81, 0xD9, 0x66,
-    0x4E, 0x98, 0x71, 0x4F, 0xA8, 0x4A, 0xD2, 0x50, 0xF2, 0x6E, 0xAA, 0xCE, 0x4F, 0xCB, 0xFB, 0x16,
-    0xBE, 0x06, 0xB1, 0x6A, 0x66, 0xF0, 0x5D, 0x60, 0x3C, 0x4B, 0x1D, 0xDA, 0xFF, 0x51, 0xC9, 0x5B,
-    0x9E, 0xA0, 0x01, 0xB3, 0x3C, 0xC0, 0xE8, 0xE9, 0x7C, 0xC2, 0x22, 0x76, 0xF4, 0xFB, 0x32, 0x5A,
-    0x6C, 0xC9, 0x07, 0x47, 0xD6, 0xDD, 0x11, 0xDF, 0xE7, 0x30, 0x5F, 0xC3, 0x63, 0xBF, 0x0D, 0x59,
-    0xEF, 0x55, 0xA9, 0x36, 0x38, 0xB3, 0xE8, 0xF7, 0x25, 0xF9, 0x1D, 0x43, 0x33, 0xA1, 0xB7, 0x0D,
-    0x21, 0x20, 0xF7, 0xD5, 0x30, 0xFF, 0x9A, 0xA9, 0x47, 0xF3, 0xF8, 0x29, 0xD0, 0x91, 0x7B, 0xB9,
-    0x8F, 0x37, 0xE6, 0x65, 0xD4, 0x32, 0xBE, 0x2A, 0x97, 0x8D, 0xEA, 0x40, 0x18, 0xB5, 0x72, 0x24,
-    0x85, 0xE0, 0xF3, 0xF1, 0x62, 0x75, 0xD4, 0x04, 0x8B, 0x33, 0x3B, 0x34, 0x7A, 0xE3, 0x48, 0xFE,
-    0x86, 0x62, 0xA6, 0xD1, 0x39, 0x18, 0xDA, 0xE4, 0x2B, 0x6A, 0x69, 0xC8, 0xD3, 0x36, 0x28, 0xFE,
-    0x34, 0x99, 0x16, 0xC7, 0x93, 0x38, 0x17, 0x99, 0x22, 0x89, 0x4D, 0x94, 0x83, 0x1E, 0x1F, 0x37,
-    0xB1, 0xB0, 0x0A, 0x61, 0x31, 0xCB, 0xA3, 0xC5, 0x7F, 0x77, 0x89, 0x86, 0x42, 0xE9, 0xEF, 0xD8,
-    0x76, 0xDB, 0xBC, 0x6F, 0x6C, 0xF3, 0xEF, 0x9B, 0x8D, 0x35, 0x8B, 0x4D, 0x36, 0x5F, 0xD1, 0x2E,
-    0x92, 0x34, 0xCF, 0x7F, 0xE8, 0xCF, 0xCC, 0x1F, 0xAF, 0x0D, 0x6C, 0x8D, 0x09, 0xD8, 0xF4, 0x49,
-    0x43, 0x18, 0xE0, 0xBD, 0xF7, 0x2A, 0x06, 0xDA, 0xFB, 0x32, 0x2A, 0x17, 0x5F, 0x02, 0x25, 0x30,
-    0xBF, 0x32, 0x26, 0x39, 0xC6, 0xDA, 0x9F, 0x30, 0x0F, 0xFF, 0x73, 0x5A, 0x57, 0x83, 0x51, 0xE7,
-    0xB5, 0xB3, 0xC2, 0x9E, 0xFD, 0x7D, 0xA8, 0x0D, 0xF4, 0x9D, 0x22, 0x9F, 0xF2, 0xEC, 0xDF, 0xE0,
-    0x21, 0x9F, 0xE0, 0xC7, 0x13, 0x4E, 0x97, 0x44, 0x02, 0xE3, 0x74, 0x94, 0x7F, 0x03, 0x8F, 0x30,
-    0xA5, 0x19, 0xCD, 0xBF, 0x20, 0x67, 0x5F, 0x30, 0xDF, 0x5C, 0xBB, 0xE9, 0xAF, 0x93, 0x3E, 0xF0,
-    0xAE, 0x6F, 0xAB, 0x1B, 0xAF, 0xF8, 0xB3, 0xE4, 0xCF, 0xF6, 0x3F, 0x66, 0xD4, 0xB3, 0x7D, 0x93,
-    0xBE, 0xAF, 0xA7, 0x7D, 0x9E, 0xA7, 0xA0, 0x3F, 0x0B, 0xF5, 0xBA, 0xB1, 0x8C, 0x1D, 0xB7, 0x08,
-    0xCF, 0xFD, 0x42, 0x31, 0x5D, 0x98, 0x7F, 0x2F, 0x8D, 0xB2, 0x40, 0x82, 0x2D, 0x6F, 0xEE, 0x1A,
-    0x55, 0x3D, 0xFF, 0xB5, 0x4C, 0xD6, 0xF2, 0x43, 0x2D, 0x40, 0x7E, 0xBE, 0xF9, 0x90, 0x8D, 0xF1,
-    0xDF, 0xF4, 0xE9, 0xB3, 0x6D, 0x93, 0xBA, 0x16, 0xEF, 0xBC, 0xCD, 0x0C, 0x83, 0xFD, 0xAF, 0x1D,
-    0x37, 0x91, 0x7F, 0xEC, 0xD6, 0xE6, 0x7B, 0x62, 0x3A, 0x4D, 0x58, 0x46, 0x66, 0xDC, 0xCB, 0x90,
-    0x99, 0xE6, 0xCB, 0x44, 0x85, 0xD9, 0x98, 0xF3, 0x65, 0xBE, 0x8D, 0x79, 0x60, 0xFE, 0xBC, 0x6F,
-    0xA1, 0x6F, 0xF4, 0x2D, 0xF4, 0x47, 0x8E, 0x81, 0xEE, 0x8B, 0xFD, 0x56, 0x7F, 0xF6, 0x67, 0x03,
-    0x91, 0x89, 0x0D, 0xF9, 0xB2, 0xD9, 0x78, 0x09, 0xCA, 0x7B, 0x24, 0x81, 0xA0, 0xF5, 0x91, 0x34,
-    0x67, 0x97, 0x8C, 0xA5, 0x0B, 0x23, 0x08, 0x75, 0x85, 0xEF, 0x7D, 0xC5, 0xB9, 0x9A, 0x23, 0x71,
-    0x40, 0x6E, 0xC8, 0x01, 0x13, 0x05, 0x8A, 0x22, 0x45, 0xB1, 0x22, 0x6A, 0xB2, 0x65, 0x99, 0xCD,
-    0x80, 0x26, 0x16, 0x79, 0x8F, 0xE6, 0xB3, 0x96, 0x48, 0x96, 0xB0, 0x9C, 0x12, 0x23, 0x51, 0x5A,
-    0x10, 0x59, 0x98, 0x4F, 0xED, 0x73, 0xB2, 0x5C, 0x0B, 0x7A, 0xDE, 0x32, 0x51, 0xD2, 0x77, 0x1B,
-    0xA2, 0xAD, 0x9A, 0x28, 0x2B, 0x89, 0xA0, 0x5E, 0x03, 0x12, 0x26, 0xFC, 0xD6, 0x39, 0x25, 0xD2,
-    0x35, 0x73, 0x2D, 0x59, 0xB8, 0x4F, 0x43, 0xB6, 0x50, 0xBD, 0x9B, 0x8E, 0xBE, 0xB8, 0x18, 0x7A,
-    0x9E, 0xA9, 0x35, 0xCC, 0x99, 0x93, 0x5C, 0x18, 0xA6, 0x8A, 0x30, 0x3E, 0x73, 0x8E, 0x6A, 0xF2,
-    0xD0, 0x12, 0x30, 0x34, 0x14, 0x6C, 0x7E, 0x4D, 0x85, 0xA0, 0x0D, 0x92, 0x69, 0x83, 0x6C, 0xFC,
-    0x7A, 0x7B, 0xFF, 0x7A, 0x96, 0x73, 0x32, 0xC2, 0x37, 0x82, 0x88, 0x49, 0x57, 0xD2, 0x7C, 0xA2,
-    0x68, 0xA6, 0x28, 0x54, 0x14, 0x7F, 0x44, 0x94, 0xFD, 0x5F, 0xA0, 0xB7, 0xED, 0x1B, 0x40, 0xEF,
-    0x5A, 0x30, 0x93, 0xE9, 0x9B, 0x2D, 0xD1, 0x7B, 0x0D, 0x91, 0x2D, 0x15, 0x15, 0x8A, 0x16, 0x53,
-    0xBB, 0x03, 0x4B, 0xCC, 0x14, 0x2B, 0x7A, 0xA7, 0x08, 0x91, 0x63, 0x3A, 0x10, 0x27, 0xDA, 0x59,
-    0x93, 0x66, 0x20, 0x28, 0xA8, 0x62, 0x92, 0x89, 0x3E, 0x38, 0x44, 0xB4, 0x59, 0x4E, 0x5D, 0x1E,
-    0x44, 0xF1, 0x7E, 0x15, 0x01, 0x6C, 0x31, 0x5B, 0x74, 0x08, 0xE6, 0x2B, 0x81, 0xBE, 0x3B, 0xDB,
-    0x1A, 0xD0, 0x43, 0x9D, 0x35, 0x83, 0x90, 0x27, 0xF6, 0x7B, 0x96, 0x0A, 0xB9, 0x16, 0xD1, 0xBE,
-    0x8C, 0x06, 0xB2, 0x2E, 0x24, 0x48, 0x56, 0x48, 0xE1, 0x36, 0xB2, 0x66, 0xA2, 0xF9, 0xD2, 0xAC,
-    0xEA, 0x85, 0x64, 0x18, 0x88, 0x4C, 0xB0, 0xE6, 0xB4, 0x40, 0x70, 0x0D, 0xC5, 0x7B, 0xA3, 0x47,
-    0x01, 0xCF, 0x85, 0xED, 0xF5, 0x4B, 0x0E, 0x04, 0x08, 0x00, 0x9B, 0x7A, 0x0F, 0xB1, 0x7A, 0xDA,
-    0x6D, 0xA6, 0x0D, 0xA3, 0x35, 0xBC, 0x83, 0x02, 0xFC, 0x1A, 0x36, 0xB3, 0xC6, 0x39, 0x3C, 0x58,
-    0xF0, 0x2F, 0xF6, 0xAE, 0x3C, 0xE3, 0x9F, 0x97, 0xCE, 0x12, 0xB5, 0x4F, 0x45, 0xB3, 0xA5, 0x11,
-    0x68, 0xCA, 0xFB, 0x81, 0x11, 0x14, 0xF0, 0x3B, 0x01, 0xD7, 0x3F, 0x42, 0x66, 0x07, 0xB8, 0x84,
-    0xEC, 0xAA, 0x85, 0xAF, 0x0F, 0x3E, 0x43, 0x75, 0x77, 0x9F, 0x05, 0xB7, 0x38, 0xA6, 0xFF, 0xE1,
-    0xFC, 0x01, 0x91, 0x6F, 0xF7, 0xF1, 0x1A, 0x1F, 0x7B, 0xAF, 0xF1, 0x02, 0xCE, 0xE1, 0xC5, 0x9A,
-    0xEB, 0xF8, 0x7F, 0x80, 0xD7, 0x38, 0x56, 0xA7, 0x32, 0x93, 0xEB, 0x9A, 0x58, 0xAD, 0xE9, 0x89,
-    0x16, 0xF0, 0x1E, 0x8A, 0x7A, 0x87, 0x1C, 0xDE, 0xC9, 0x14, 0xFE, 0x48, 0xFF, 0xF6, 0x41, 0x5E,
-    0xE3, 0x9C, 0xC2, 0x03, 0x3D, 0xB0, 0x07, 0x7D, 0x82, 0x9C, 0x21, 0x80, 0x91, 0xF3, 0xA8, 0x41,
-    0xF0, 0x1F, 0x13, 0x38, 0x92, 0x55, 0xAE, 0x1F, 0xA9, 0xEA, 0xFF, 0xF4, 0xD8, 0xDB, 0xD9, 0xFE,
-    0xB8, 0x3E, 0x5D, 0xFD, 0x00, 0x5C, 0x01, 0x9B, 0x9B, 0x67, 0x0F, 0x8D, 0x6B, 0xF7, 0x09, 0x04,
-    0xEA, 0x01, 0x90, 0x59, 0x72, 0xF6, 0xE1, 0xA2, 0xE3, 0x75, 0x5D, 0xB6, 0xDD, 0xE0, 0x68, 0x67,
-    0x9A, 0x25, 0x91, 0x07, 0x3C, 0xEB, 0x5D, 0x04, 0x14, 0x8F, 0x60, 0xF0, 0xDD, 0xFA, 0xE1, 0xC7,
-    0xDD, 0x0A, 0x38, 0x34, 0x7D, 0x12, 0xC1, 0x6B, 0xE7, 0x96, 0x39, 0x94, 0xD4, 0x34, 0xCD, 0x58,
-    0xAB, 0x02, 0xE6, 0x72, 0x04, 0x8F, 0x67, 0x30, 0x7A, 0x6B, 0x7E, 0xB6, 0xD6, 0x27, 0x95, 0x98,
-    0x74, 0x2A, 0x58, 0x39, 0xC0, 0x59, 0x36, 0x1B, 0xDA, 0x29, 0xBE, 0x80, 0xF8, 0x72, 0xB2, 0xA7,
-    0x21, 0x26, 0x10, 0x1D, 0x5D, 0x34, 0xFA, 0xFE, 0xE4, 0xD2, 0x13, 0xAF, 0x5C, 0x05, 0xC5, 0xBE,
-    0x61, 0x78, 0xEB, 0xAC, 0xE9, 0xFD, 0x7D, 0x8A, 0xA1, 0x03, 0x6C, 0x11, 0xF6, 0x0E, 0xB0, 0xEA,
-    0x02, 0xB3, 0x1A, 0x75, 0xE1, 0x83, 0x61, 0x95, 0x6A, 0xFF, 0xE7, 0xD0, 0xBA, 0xE0, 0xDC, 0xD4,
-    0xD2, 0x1E, 0x59, 0xAA, 0x3A, 0xC6, 0x13, 0x7E, 0x06, 0x65, 0x83, 0x41, 0x8F, 0x9C, 0x64, 0xC5,
-    0x2C, 0x7E, 0xB9, 0x2E, 0x75, 0x28, 0x05, 0x62, 0xB5, 0xDA, 0x9F, 0x60, 0x53, 0xE5, 0x2B, 0xC6,
-    0x25, 0x34, 0xFB, 0x8C, 0x02, 0x8C, 0x34, 0xD5, 0xE1, 0x4C, 0x64, 0x0A, 0x3E, 0x7B, 0x62, 0xA3,
-    0x3F, 0xB0, 0xF4, 0x91, 0xBD, 0xF6, 0xA1, 0xF5, 0xCE, 0x69, 0x4A, 0x64, 0xED, 0xED, 0x7B, 0x9D,
-    0x2E, 0x26, 0x5B, 0x1F, 0xF2, 0x9A, 0x69, 0xE7, 0xEE, 0x0A, 0xE4, 0xF6, 0x4C, 0x3D, 0x4D, 0x23,
-    0xEA, 0xF3, 0xA0, 0xC0, 0xA6, 0xEA, 0x9D, 0x0F, 0x45, 0xE3, 0x42, 0xD6, 0xC4, 0x80, 0x4C, 0xE4,
-    0x1F, 0x54, 0xCC, 0xC2, 0xD7, 0x49, 0xAA, 0x9A, 0x59, 0x58, 0xF2, 0x51, 0x79, 0x5B, 0x64, 0xFA,
-    0x3A, 0x7D, 0x50, 0x73, 0xFC, 0xC9, 0x4E, 0xD0, 0x9F, 0x91, 0x93, 0xB3, 0x22, 0xF5, 0x83, 0x83,
-    0x59, 0xC2, 0x6A, 0xED, 0x82, 0x66, 0x59, 0x5D, 0x5F, 0xFF, 0x29, 0xDE, 0x7E, 0x8E, 0x85, 0x70,
-    0x4B, 0x5F, 0xDE, 0xB9, 0x8D, 0x8C, 0xED, 0xB5, 0x8F, 0x34, 0xBB, 0x50, 0xF4, 0x01, 0x23, 0x04,
-    0x5A, 0x79, 0x71, 0xA8, 0x92, 0x6B, 0xBD, 0x3F, 0x2B, 0xF9, 0xB6, 0x2C, 0x7F, 0x06, 0x47, 0x69,
-    0xBE, 0xAB, 0x0D, 0x3A, 0x3E, 0x1F, 0x66, 0x58, 0xD8, 0x72, 0xAD, 0xE7, 0xAF, 0x1F, 0x0E, 0x8F,
-    0xAE, 0x7C, 0xB6, 0x39, 0x90, 0x36, 0xAA, 0x5E, 0xF3, 0x13, 0x7B, 0xFD, 0xC5, 0xF1, 0x2C, 0x71,
-    0xF9, 0x3A, 0x28, 0x26, 0x7E, 0x11, 0x1A, 0x8B, 0x4F, 0x33, 0x6C, 0x2F, 0x74, 0x5C, 0xEE, 0xB8,
-    0x56, 0x05, 0xC9, 0x57, 0x1B, 0xB5, 0x2C, 0x42, 0x54, 0x3B, 0xC3, 0x25, 0x08, 0xA1, 0x51, 0x0B,
-    0xC6, 0x0C, 0xF6, 0xB9, 0x24, 0x13, 0xDA, 0x85, 0x8D, 0x71, 0x59, 0xDA, 0x16, 0xAA, 0xAD, 0xA7,
-    0x76, 0xF7, 0x75, 0x32, 0xF8, 0x6F, 0x70, 0x16, 0xBC, 0xA5, 0x89, 0x1F, 0xE9, 0xA7, 0x72, 0x9B,
-    0xE7, 0x6F, 0xD1, 0x4B, 0xE5, 0x3A, 0x6D, 0xC4, 0xAF, 0x69, 0xD8, 0x71, 0xA6, 0x9A, 0x7E, 0x1A,
-    0x94, 0x43, 0xFA, 0x35, 0xCC, 0x64, 0xEC, 0xD2, 0x46, 0x58, 0xD0, 0xF4, 0x53, 0xD0, 0x81, 0xA5,
-    0x60, 0x5A, 0xA5, 0x62, 0x19, 0x5D, 0x7F, 0x14, 0x08, 0x85, 0xBD, 0xCD, 0xE1, 0x8B, 0x32, 0xCF,
-    0x72, 0xA9, 0x30, 0x3D, 0x54, 0x18, 0x2E, 0x95, 0xE5, 0x08, 0x82, 0x7D, 0x17, 0x09, 0x83, 0x7E,
-    0xD3, 0xB9, 0xF0, 0x93, 0x0C, 0xB1, 0x94, 0xFA, 0xD9, 0xDB, 0xF8, 0x16, 0x69, 0x2D, 0xB2, 0x3C,
-    0xC6, 0x1D, 0x01, 0xFC, 0x63, 0x26, 0xB6, 0x83, 0x43, 0x4B, 0x07, 0x07, 0x53, 0xFA, 0x24, 0xDE,
-    0x17, 0x8C, 0xAF, 0xC8, 0xF4, 0x80, 0xBA, 0x91, 0xC1, 0x2B, 0x71, 0x79, 0x99, 0x0A, 0x99, 0x12,
-    0xFC, 0x66, 0xF9, 0x11, 0xB5, 0xCF, 0xE4, 0x36, 0x4B, 0x72, 0x99, 0xCA, 0x64, 0xEA, 0x48, 0xFF,
-    0x03, 0x55, 0xE3, 0x1F, 0xEA, 0xC2, 0x41, 0x05, 0x9F, 0xE6, 0x9C, 0xFA, 0x90, 0x8E, 0x07, 0x7F,
-    0x60, 0xC8, 0x4C, 0x49, 0x67, 0x66, 0x7F, 0x2F, 0xD8, 0xD5, 0xF2, 0x1E, 0x6C, 0xC4, 0xE5, 0x07,
-    0x4C, 0xF7, 0x84, 0x82, 0xA0, 0xB3, 0xAE, 0xFA, 0xA7, 0x3B, 0xE5, 0x80, 0x6F, 0x91, 0x77, 0xFE,
-    0x4E, 0x5A, 0xE4, 0x5D, 0x79, 0x73, 0x79, 0xDD, 0x06, 0xA0, 0x04, 0xB8, 0x5F, 0x8B, 0xBC, 0x0B,
-    0x12, 0xEF, 0xAE, 0xC3, 0x1D, 0xB7, 0x71, 0xAF, 0x7C, 0x93, 0xBD, 0xFD, 0x1D, 0xB4, 0xB0, 0xEA,
-    0x50, 0xFA, 0x6C, 0x2D, 0x5B, 0xDD, 0xE5, 0x00, 0x11, 0xC4, 0x98, 0xAB, 0x99, 0x26, 0xC7, 0xB3,
-    0x78, 0xF5, 0xAD, 0xEE, 0x6F, 0x99, 0xB8, 0x53, 0xD3, 0xB2, 0x82, 0x44, 0x06, 0xED, 0x16, 0x95,
-    0xDD, 0x78, 0xA1, 0xC0, 0x6A, 0x64, 0x10, 0xCF, 0xBB, 0xAC, 0xE1, 0x35, 0xD0, 0x11, 0xC3, 0x42,
-    0x6B, 0x34, 0xB7, 0x19, 0xD4, 0x34, 0x05, 0x95, 0x36, 0xCC, 0x5B, 0xA6, 0x69, 0xCC, 0x34, 0xAB,
-    0xD9, 0x8C, 0x31, 0x25, 0x9A, 0xF3, 0x4C, 0x2E, 0xD2, 0xAC, 0xBF, 0xC3, 0xD4, 0x0A, 0xC2, 0x17,
-    0xAA, 0x73, 0x42, 0x0F, 0x7F, 0x60, 0x77, 0x86, 0xD7, 0x04, 0x74, 0x49, 0x8E, 0xA8, 0xCA, 0x44,
-    0xD6, 0x34, 0x84, 0x30, 0x69, 0x50, 0xBA, 0x40, 0xD4, 0x56, 0xE8, 0x70, 0x0D, 0x98, 0x52, 0x29,
-    0x41, 0xBD, 0x65, 0x87, 0x01, 0xCC, 0x90, 0xF3, 0xFE, 0x9A, 0x29, 0xAF, 0x1F, 0xEB, 0x8A, 0x67,
-    0xA9, 0x2A, 0xD5, 0x88, 0x74, 0x2D, 0x9F, 0x7E, 0xC1, 0xD4, 0x9B, 0x32, 0xAE, 0xAB, 0x25, 0x82,
-    0x9A, 0xD0, 0xD2, 0x40, 0xB0, 0x99, 0x32, 0x14, 0x45, 0xC3, 0x39, 0x81, 0x74, 0xB1, 0xAC, 0xA8,
-    0x1A, 0x62, 0x74, 0x38, 0x03, 0x83, 0x41, 0x51, 0xA2, 0x8F, 0xB8, 0x3A, 0x44, 0xAA, 0x59, 0x8E,
-    0xEE, 0x29, 0xFA, 0x17, 0xFD, 0xAE, 0x72, 0x5E, 0xAC, 0x5C, 0x25, 0xA2, 0x4A, 0x53, 0x11, 0xA8,
-    0xEE, 0x19, 0x45, 0xCF, 0x0D, 0x63, 0x5E, 0x72, 0x52, 0x0E, 0x7A, 0x89, 0x57, 0xD4, 0x5F, 0x09,
-    0x42, 0x9B, 0x43, 0xB1, 0xEB, 0x17, 0x3F, 0xD6, 0xAF, 0xA4, 0x56, 0x79, 0x21, 0x50, 0xE8, 0xDF,
-    0xCE, 0x35, 0x18, 0x8C, 0x44, 0x0A, 0x20, 0x65, 0xA9, 0x68, 0xC4, 0xD5, 0x0C, 0x32, 0x6A, 0x95,
-    0xD3, 0x34, 0x3A, 0xAC, 0x8F, 0xFB, 0x9C, 0xF5, 0x0E, 0xF8, 0x12, 0x81, 0xBB, 0x17, 0xCD, 0x1A,
-    0x90, 0xD5, 0x0D, 0x2A, 0xDA, 0xDB, 0xA0, 0x91, 0x54, 0xE3, 0x1A, 0xBD, 0x9F, 0xBA, 0x8F, 0x83,
-    0x6E, 0x6C, 0x5E, 0xD0, 0xEC, 0x65, 0x76, 0x3F, 0x42, 0x5E, 0xAC, 0xA3, 0x17, 0xB6, 0xA9, 0x2E,
-    0x58, 0x60, 0xDC, 0x0F, 0x40, 0xBA, 0x6E, 0x1C, 0x15, 0xF5, 0x2A, 0x69, 0x72, 0xE4, 0x47, 0x83,
-    0xBD, 0x33, 0x4A, 0x0F, 0xF7, 0x76, 0xEC, 0x61, 0xD7, 0xEF, 0x5D, 0x66, 0xA4, 0x4D, 0x39, 0x84,
-    0x47, 0x35, 0xF0, 0x9F, 0xBA, 0xAC, 0x76, 0x92, 0xB9, 0xBE, 0xDA, 0x62, 0x3F, 0xEA, 0x36, 0x93,
-    0xC7, 0xD4, 0xE8, 0xF7, 0x47, 0xCB, 0x36, 0xB4, 0xED, 0x3A, 0xDC, 0x7B, 0xF9, 0x93, 0xB6, 0xE1,
-    0x41, 0xD0, 0x99, 0x29, 0xCC, 0x7D, 0x4F, 0x6E, 0x6C, 0xBA, 0xEC, 0x8D, 0x0B, 0x27, 0x81, 0x1C,
-    0xF5, 0xA4, 0xDA, 0x74, 0x27, 0x0C, 0xBC, 0xD4, 0x13, 0xCD, 0xA0, 0x11, 0xFB, 0x94, 0x1A, 0xB1,
-    0xCB, 0xB1, 0x61, 0xE2, 0xBB, 0xCF, 0xA8, 0xB1, 0x32, 0x06, 0xE3, 0xE6, 0x4E, 0xA6, 0x1C, 0x8F,
-    0x4C, 0x21, 0x30, 0xD7, 0x93, 0x91, 0x3F, 0xD1, 0x9C, 0x27, 0x07, 0x9E, 0xF4, 0x61, 0x87, 0x63,
-    0x7F, 0x32, 0xF1, 0xE3, 0xD3, 0x2D, 0x13, 0xE3, 0x24, 0xF5, 0xCA, 0x28, 0xC7, 0x92, 0x4E, 0x75,
-    0x1D, 0x37, 0xBD, 0x13, 0xA9, 0xDC, 0xD3, 0xAD, 0x68, 0x28, 0xFB, 0x20, 0xE9, 0xF9, 0x3E, 0x24,
-    0x8D, 0x3E, 0x57, 0x9F, 0xF9, 0x03, 0xD1, 0x0D, 0x45, 0xE4, 0xEC, 0x99, 0xD9, 0x82, 0x48, 0xB9,
-    0x76, 0x68, 0x60, 0x05, 0xFD, 0x58, 0x23, 0xB0, 0xE0, 0x33, 0x0F, 0x24, 0x64, 0xB0, 0x60, 0xFE,
-    0xAF, 0x55, 0xA4, 0x3A, 0x89, 0xCA, 0x0C, 0x9C, 0x57, 0xD8, 0x33, 0x22, 0x66, 0x14, 0x2A, 0x3D,
-    0xB9, 0x54, 0xA7, 0x09, 0x51, 0xEB, 0xF5, 0xE5, 0xEB, 0x86, 0x78, 0x92, 0x4A, 0xAB, 0xDC, 0x4B,
-    0x63, 0xD4, 0xA0, 0x06, 0xF5, 0xD4, 0x09, 0x36, 0xD0, 0xE8, 0x2C, 0x57, 0x1E, 0x61, 0x3D, 0x21,
-    0xED, 0xE7, 0x88, 0x13, 0xC4, 0x12, 0x27, 0xCC, 0x7A, 0x0D, 0x3B, 0xF0, 0xAC, 0x81, 0x6B, 0xD1,
-    0x74, 0x0D, 0x4E, 0x01, 0xAB, 0x69, 0x23, 0xFC, 0x7F, 0x33, 0x69, 0x83, 0x3A, 0x6C, 0xC7, 0x56,
-    0x48, 0xBB, 0x1D, 0xD9, 0x4C, 0x18, 0xE5, 0x22, 0x53, 0x57, 0x61, 0xE7, 0x60, 0x7C, 0x95, 0x9E,
-    0x59, 0xCE, 0xC9, 0x06, 0xED, 0x1B, 0x69, 0xB7, 0x9C, 0x33, 0xA3, 0x97, 0xD8, 0xC8, 0x89, 0x66,
-    0xDF, 0x9D, 0x91, 0x83, 0xB3, 0xFF, 0x11, 0xFC, 0x31, 0xCD, 0xD4, 0x01, 0x9A, 0x29, 0x46, 0x60,
-    0x47, 0x7C, 0xBB, 0x11, 0x59, 0xFF, 0x12, 0xC0, 0x5F, 0xB4, 0x00, 0x4D, 0x5A, 0xCA, 0xBF, 0x71,
-    0x19, 0xBF, 0x29, 0x35, 0x88, 0xAC, 0x3C, 0xDA, 0xC5, 0x6E, 0xDC, 0x60, 0x46, 0x16, 0x3C, 0x51,
-    0x0A, 0x3B, 0x3B, 0x70, 0xDC, 0x77, 0x09, 0xE8, 0x02, 0x17, 0x28, 0x38, 0x48, 0x57, 0x0F, 0xCE,
-    0xF6, 0x44, 0x70, 0x58, 0x02, 0xBA, 0xF8, 0xA0, 0xDC, 0x73, 0xB5, 0xBF, 0xD8, 0x25, 0xA0, 0xD3,
-    0xFC, 0x99, 0xA3, 0x7D, 0x09, 0xE8, 0x36, 0xD4, 0xEA, 0x9B, 0x7B, 0x1D, 0xEB, 0xA4, 0xF2, 0xD1,
-    0x1F, 0xCF, 0xD6, 0x3E, 0x79, 0x1B, 0xA7, 0xDD, 0x45, 0x64, 0x73, 0xFE, 0x3E, 0xDD, 0xE9, 0x7C,
-    0x74, 0x55, 0x60, 0x77, 0xCA, 0x08, 0xC6, 0x89, 0xCA, 0x45, 0x58, 0x95, 0x6B, 0x86, 0x89, 0xA5,
-    0x71, 0xE2, 0x8F, 0x03, 0xE1, 0x48, 0x67, 0x6A, 0x31, 0x6D, 0xC8, 0x58, 0x82, 0x01, 0x26, 0xEF,
-    0x1D, 0x2B, 0xE7, 0x0D, 0xC6, 0x1B, 0xD5, 0xC4, 0x6B, 0x0A, 0xD7, 0xBD, 0x96, 0x0A, 0xEF, 0x11,
-    0xE4, 0xC3, 0xDB, 0x4C, 0x06, 0xA2, 0xF2, 0x12, 0x1C, 0x29, 0x0B, 0x92, 0xF3, 0x48, 0x5D, 0x82,
-    0x33, 0x47, 0x56, 0x7A, 0xAD, 0xEB, 0xC0, 0x76, 0x38, 0xC5, 0x87, 0x40, 0xE3, 0x5F, 0x0E, 0x05,
-    0x66, 0x07, 0x5C, 0x8B, 0x5A, 0x44, 0xD5, 0x27, 0xC0, 0x25, 0x99, 0x65, 0x24, 0x8A, 0x26, 0x85,
-    0x4B, 0x95, 0x42, 0xE5, 0x9E, 0xED, 0xCF, 0x7E, 0x47, 0xCB, 0x19, 0x45, 0x3D, 0x55, 0x0A, 0x07,
-    0xCE, 0x28, 0xA0, 0xFE, 0xD6, 0x0C, 0x9D, 0x3B, 0xC0, 0xB9, 0xFF, 0xC8, 0x50, 0xFD, 0x1C, 0xA2,
-    0xC6, 0xBB, 0xC0, 0xA4, 0x18, 0x18, 0x59, 0xC1, 0x98, 0xF2, 0xA0, 0x45, 0xCE, 0x20, 0xCB, 0x30,
-    0xAD, 0x09, 0x26, 0xD9, 0xF3, 0xB0, 0xCA, 0x21, 0xD1, 0x0A, 0x25, 0x16, 0xB8, 0xB1, 0xA8, 0xC2,
-    0x37, 0x52, 0xE3, 0x59, 0xEE, 0x1C, 0x77, 0x66, 0x5E, 0x53, 0x70, 0xD4, 0x4E, 0x7D, 0x74, 0xCD,
-    0x32, 0xDE, 0xB1, 0xBB, 0x97, 0x07, 0xC9, 0xBD, 0x3C, 0xD4, 0xCF, 0x3F, 0xA3, 0x66, 0xE1, 0x56,
-    0x1E, 0x4B, 0xB0, 0x71, 0xD5, 0xEE, 0xCE, 0x0F, 0x6A, 0x16, 0x4D, 0x4B, 0x68, 0x34, 0x2F, 0xA1,
-    0xD1, 0xC4, 0x84, 0x2E, 0x33, 0xA1, 0x4F, 0x4D, 0xE8, 0xC3, 0x1B, 0x34, 0x39, 0xA1, 0xCB, 0x4E,
-    0xE8, 0xD2, 0x13, 0xBA, 0xFC, 0x84, 0xCE, 0xDD, 0xCB, 0x67, 0x74, 0xD7, 0x14, 0x85, 0xFE, 0xC3,
-    0xC0, 0x71, 0xC4, 0x0C, 0xBF, 0x77, 0x69, 0x0A, 0x35, 0x4F, 0xA1, 0x4B, 0x54, 0xC8, 0x4C, 0x85,
-    0xED, 0xA6, 0x7A, 0x28, 0xB8, 0x5C, 0x85, 0xB4, 0xF1, 0x8F, 0x2C, 0x7D, 0x76, 0x7D, 0x60, 0xC2,
-    0xE4, 0xC8, 0xA8, 0x0F, 0x1A, 0x88, 0x35, 0xD1, 0x72, 0x0B, 0xA6, 0x7A, 0x66, 0x35, 0x0D, 0xF3,
-    0x25, 0xA9, 0xC7, 0xC8, 0xBE, 0x69, 0x7B, 0x95, 0x3F, 0x43, 0x52, 0xA5, 0x11, 0x35, 0xA3, 0xB3,
-    0xFA, 0x86, 0x91, 0x5D, 0xE7, 0x2A, 0x9B, 0xEA, 0xDA, 0xF3, 0x1B, 0x36, 0x08, 0xA4, 0x65, 0x74,
-    0x0B, 0x53, 0xF7, 0x58, 0x3A, 0xCF, 0xA4, 0x4C, 0xEB, 0xA3, 0xDE, 0x02, 0xE6, 0x28, 0xF0, 0x62,
-    0xA2, 0x9E, 0x8F, 0xCA, 0x06, 0x55, 0xD9, 0x7E, 0x7C, 0xF2, 0xBC, 0xDD, 0x3C, 0x2B, 0x98, 0x64,
-    0xE0, 0xB1, 0xE3, 0x5B, 0x67, 0xD5, 0xF5, 0x16, 0x62, 0xD1, 0x21, 0xD8, 0x2C, 0x23, 0xF9, 0x1F,
-    0x1E, 0x53, 0xE7, 0x9A, 0xE5, 0x6B, 0xE8, 0x4C, 0xB6, 0xF7, 0x52, 0x46, 0x71, 0xDA, 0x7C, 0x1A,
-    0x48, 0xB8, 0x9C, 0xBD, 0xCB, 0xC6, 0x79, 0xD0, 0xAF, 0xA2, 0x01, 0x43, 0x72, 0x04, 0x74, 0x6A,
-    0x3B, 0x2E, 0x38, 0x9E, 0x34, 0xF1, 0xDA, 0x27, 0x46, 0x8D, 0xD9, 0xA2, 0x03, 0x39, 0xF9, 0x8B,
-    0x50, 0x91, 0x26, 0xDC, 0xC7, 0x70, 0xFC, 0x3B, 0xEE, 0x8B, 0x90, 0x38, 0x16, 0x70, 0x1D, 0xBD,
-    0xA8, 0xCE, 0x78, 0x4E, 0x65, 0x79, 0x00, 0xEA, 0xCD, 0x60, 0x47, 0x47, 0x74, 0xB9, 0xCB, 0x8F,
-    0x0A, 0x61, 0x58, 0xA9, 0xCE, 0xF7, 0x1C, 0x7C, 0x44, 0x38, 0x63, 0x07, 0x9A, 0x4D, 0xB6, 0xBC,
-    0xF1, 0x70, 0x77, 0x9B, 0x13, 0xAC, 0x58, 0x83, 0x8C, 0xEE, 0x7E, 0x10, 0x3C, 0xB5, 0x9D, 0x3D,
-    0x20, 0x47, 0xF2, 0x97, 0x01, 0x7E, 0xE4, 0x41, 0x0E, 0x50, 0x00, 0x54, 0x3F, 0xDA, 0xC2, 0x46,
-    0x38, 0xB6, 0x43, 0x0B, 0x77, 0x81, 0x26, 0x45, 0xB4, 0xCF, 0xCB, 0xB8, 0x7E, 0x15, 0x83, 0xFB,
-    0x47, 0x07, 0x80, 0x2F, 0xAF, 0x2D, 0xBB, 0x9A, 0x16, 0xBF, 0xDE, 0x07, 0x4E, 0x00, 0xBC, 0xB2,
-    0x04, 0x71, 0x1D, 0xB7, 0x32, 0x76, 0xD1, 0x06, 0x35, 0x3D, 0xD2, 0xC6, 0xB6, 0xDB, 0xAA, 0xCD,
-    0x49, 0x3A, 0x7C, 0xBE, 0xB2, 0x0A, 0x8C, 0x03, 0xAA, 0xA5, 0x8D, 0x1F, 0xC2, 0xEB, 0x63, 0x8B,
-    0x76, 0x57, 0x67, 0xB4, 0x70, 0xF9, 0x0F, 0xE1, 0x14, 0xF5, 0x42, 0xE8, 0x3C, 0xE3, 0x92, 0x1E,
-    0x8E, 0x1F, 0x1E, 0x9E, 0x4C, 0x7C, 0x87, 0xDD, 0x07, 0x7C, 0x9D, 0x2A, 0xA7, 0xDA, 0x64, 0xEF,
-    0xA9, 0xA2, 0x13, 0x21, 0xF2, 0x3F, 0xB7, 0x8B, 0x0C, 0x09, 0x91, 0xB2, 0x52, 0x49, 0x39, 0x7D,
-    0x5D, 0x33, 0x07, 0xF2, 0x87, 0x00, 0x03, 0x0E, 0x37, 0x52, 0xB7, 0xC2, 0xB1, 0x4E, 0x06, 0x7A,
-    0xF9, 0x15, 0x8E, 0x9B, 0xA2, 0xDA, 0xB2, 0xA5, 0x32, 0x14, 0x44, 0x5C, 0x56, 0x8A, 0xF4, 0x29,
-    0xB5, 0x62, 0x66, 0x4F, 0xD1, 0xED, 0x37, 0xB1, 0x4F, 0x5B, 0xCD, 0x8D, 0xF9, 0xBE, 0xDD, 0xDC,
-    0x7C, 0xC6, 0xE5, 0x9E, 0xF3, 0x01, 0x72, 0x82, 0x23, 0x87, 0x37, 0xAE, 0xD9, 0x1D, 0x3A, 0x35,
-    0x79, 0xE6, 0xDA, 0x5B, 0x87, 0x27, 0x3D, 0x9E, 0x3B, 0x27, 0x07, 0x79, 0xF8, 0x37, 0xF4, 0xB9,
-    0x1B, 0x9D, 0xAB, 0x47, 0xE7, 0xEA, 0xD5, 0xB9, 0x7A, 0xD6, 0xCE, 0x43, 0x38, 0x19, 0x9A, 0xD2,
-    0xBF, 0xB7, 0x94, 0x68, 0x62, 0x1F, 0x79, 0x03, 0x1A, 0x92, 0xCB, 0x0A, 0x7F, 0x1D, 0xAE, 0xD5,
-    0xF1, 0xF3, 0xE0, 0x3E, 0x62, 0x59, 0x52, 0x66, 0x9A, 0xA9, 0x95, 0x39, 0x6A, 0x2D, 0x8D, 0x99,
-    0xB6, 0xF1, 0xBB, 0xDE, 0x74, 0xCB, 0xDA, 0xA1, 0x4E, 0xDF, 0x94, 0x1A, 0xDD, 0x3D, 0xDF, 0xFB,
-    0x11, 0xA9, 0x5B, 0xB2, 0x73, 0xC0, 0x3F, 0xBE, 0xE2, 0xA3, 0xF6, 0x79, 0x6F, 0xC7, 0x51, 0x7F,
-    0x67, 0xF2, 0x50, 0xF8, 0xF1, 0xB7, 0xBB, 0xFA, 0x1E, 0xDC, 0x1F, 0x9E, 0x41, 0x26, 0xCA, 0x1A,
-    0x01, 0xA8, 0xB6, 0xD9, 0xE2, 0x76, 0x01, 0x0F, 0xF5, 0x27, 0xE2, 0x90, 0xDE, 0x3B, 0x48, 0x0D,
-    0x44, 0xD3, 0xD5, 0xD8, 0x29, 0x05, 0x5A, 0xEF, 0x1A, 0x60, 0xAF, 0x35, 0x5E, 0x45, 0x58, 0xFA,
-    0x81, 0x30, 0x3F, 0xD0, 0x1F, 0xE5, 0xFF, 0xDF, 0x5D, 0x33, 0x76, 0x92, 0x8B, 0x8E, 0xD3, 0x52,
-    0xC7, 0xAE, 0xEC, 0x6D, 0x1D, 0x1B, 0xB1, 0x63, 0x21, 0x03, 0xB7, 0xE5, 0xD0, 0xE8, 0x00, 0x27,
-    0x8F, 0x27, 0x2F, 0x27, 0x24, 0x8D, 0xB8, 0xAA, 0x9C, 0xF2, 0x8B, 0xAF, 0x8B, 0xCF, 0x9E, 0xD9,
-    0x43, 0x0C, 0x3E, 0x78, 0xC8, 0x1B, 0xDD, 0xC0, 0xE0, 0xB3, 0x97, 0x0C, 0x23, 0xAA, 0x35, 0x7C,
-    0x47, 0x4A, 0xBB, 0xF5, 0x8C, 0x6A, 0xB2, 0xA2, 0x4E, 0x35, 0xAB, 0x86, 0x22, 0x6E, 0xC2, 0xCA,
-    0xCD, 0xE9, 0x70, 0x7E, 0x00, 0xEC, 0x75, 0xA8, 0x3A, 0xC7, 0x21, 0x91, 0x6F, 0x20, 0xEB, 0xAD,
-    0xD3, 0x4C, 0x4D, 0xD9, 0xBD, 0x4E, 0x15, 0xEF, 0xFC, 0x87, 0x93, 0x81, 0x47, 0x68, 0x01, 0xF3,
-    0xEF, 0xC2, 0x65, 0x7A, 0x60, 0xCA, 0x1E, 0x04, 0xFA, 0x31, 0x41, 0xC4, 0x3F, 0xD9, 0xDE, 0xD2,
-    0x2B, 0x13, 0xCB, 0xDB, 0xE2, 0x6C, 0x92, 0x76, 0xD7, 0x54, 0xE7, 0x44, 0x7F, 0x89, 0x3E, 0x79,
-    0x20, 0x54, 0x4E, 0x26, 0x54, 0xE0, 0x39, 0x4B, 0x9F, 0x6F, 0xFF, 0xF8, 0x98, 0x2C, 0x89, 0x6A,
-    0x4C, 0x1D, 0x3D, 0x58, 0xEA, 0x95, 0x34, 0x2E, 0xD3, 0x49, 0x68, 0x1E, 0xB9, 0x0D, 0x0F, 0x83,
-    0x96, 0x06, 0x3A, 0x37, 0xFE, 0x83, 0x7A, 0x88, 0xC2, 0x6A, 0x88, 0xD4, 0xEA, 0xEC, 0xDC, 0x7B,
-    0xD7, 0x10, 0xEB, 0xA8, 0x2E, 0x43, 0x8C, 0xC6, 0x76, 0x93, 0x69, 0x80, 0x18, 0xEF, 0x70, 0xE7,
-    0x1C, 0x37, 0x8F, 0xC3, 0x96, 0x7D, 0x8A, 0x34, 0x37, 0x4E, 0xC6, 0xC4, 0x38, 0xD5, 0xF1, 0x81,
-    0x43, 0xCF, 0x32, 0xD5, 0xE5, 0x92, 0xBB, 0x3A, 0xD0, 0xCF, 0xA9, 0x8F, 0xC5, 0x5E, 0x81, 0xBB,
-    0x20, 0x0B, 0x71, 0x1E, 0x30, 0xBC, 0x77, 0x09, 0x33, 0xB5, 0xCC, 0x28, 0x9C, 0xF7, 0x90, 0x89,
-    0xEF, 0xC1, 0xEF, 0x62, 0xF8, 0x13, 0x32, 0xD3, 0xEF, 0x15, 0x46, 0x1D, 0x74, 0x4C, 0x7D, 0xD7,
-    0xC2, 0xE6, 0x63, 0x9B, 0xE3, 0xBD, 0x1F, 0xD2, 0xAC, 0x5E, 0x7A, 0x21, 0x85, 0x03, 0x5D, 0xB6,
-    0x32, 0x3B, 0x67, 0xE6, 0x0F, 0xB7, 0x81, 0x16, 0xF4, 0xD7, 0x87, 0x6C, 0xA2, 0x71, 0xE4, 0xFD,
-    0xB4, 0x74, 0xC3, 0x08, 0xEF, 0xDB, 0x40, 0x4F, 0x41, 0x99, 0x5B, 0x5F, 0x1F, 0xA9, 0x62, 0x0B,
-    0x0E, 0xB0, 0xB4, 0x60, 0x5A, 0xC3, 0xFD, 0x14, 0x87, 0xF9, 0x52, 0x9D, 0x8F, 0xCE, 0x7D, 0x80,
-    0xCF, 0xF1, 0xE2, 0x00, 0x74, 0xD8, 0x47, 0xB8, 0xCD, 0xF7, 0x1C, 0xA6, 0x29, 0xB4, 0x06, 0xFF,
-    0x6E, 0xAA, 0xFA, 0xE4, 0x44, 0xED, 0x8A, 0x14, 0x41, 0x43, 0x4F, 0xAE, 0x9F, 0x20, 0xBB, 0x8B,
-    0x33, 0xB1, 0xCC, 0x57, 0x0C, 0x2E, 0xC6, 0x4F, 0xAE, 0x3E, 0xB7, 0x96, 0xF7, 0x4F, 0x9B, 0xAD,
-    0xE4, 0x20, 0x74, 0xAE, 0xD7, 0x2E, 0x2A, 0x26, 0x2D, 0xCD, 0x63, 0xB7, 0xBB, 0xA8, 0x4C, 0xA1,
-    0xAB, 0xF1, 0xC2, 0xF8, 0xA0, 0x56, 0xE7, 0xF5, 0xEB, 0x3C, 0x3E, 0xB8, 0x1E, 0xEC, 0x98, 0xEC,
-    0xA1, 0x36, 0x69, 0xC9, 0x01, 0x0A, 0x80, 0x6A, 0x94, 0x75, 0xE9, 0xAA, 0xC4, 0x21, 0x82, 0xC0,
-    0xD3, 0x9D, 0x19, 0xAD, 0xE9, 0xF3, 0x46, 0xC8, 0x32, 0x4F, 0x2D, 0xF1, 0x3A, 0xE8, 0x53, 0x65,
-    0x1D, 0x0A, 0xBC, 0x9C, 0xF6, 0x40, 0x20, 0x2B, 0x0C, 0xE4, 0x33, 0x36, 0x16, 0xA5, 0x33, 0x15,
-    0xCE, 0x36, 0x97, 0x43, 0xF0, 0xA2, 0xEE, 0x8F, 0xB1, 0x0A, 0x96, 0xF1, 0xBE, 0x07, 0x00, 0xB8,
-    0x1E, 0xE8, 0x7E, 0x3D, 0xC6, 0x6D, 0xD8, 0x63, 0xDC, 0x8E, 0x3D, 0xC6, 0x6D, 0xD9, 0x63, 0xDC,
-    0x9E, 0x3D, 0xC6, 0x7A, 0x2F, 0x51, 0xDD, 0xB5, 0xC7, 0xB8, 0x6D, 0x7B, 0x8C, 0xDB, 0xB7, 0xC7,
-    0xB8, 0x8D, 0x7B, 0x8C, 0xDB, 0xB9, 0xC7, 0x70, 0xEB, 0x1E, 0x60, 0xDD, 0xBB, 0xC7, 0xB8, 0xCD,
-    0x7B, 0x8C, 0xDB, 0xBD, 0xC7, 0xB8, 0xED, 0x7B, 0x8C, 0xDB, 0xBF, 0xC7, 0xB8, 0x0D, 0x7C, 0x8C,
-    0xDB, 0xC1, 0xC7, 0xE8, 0x16, 0x3E, 0xB7, 0xCE, 0xE9, 0x1E, 0x3E, 0xC2, 0x66, 0x71, 0x13, 0x1F,
-    0x5B, 0xE9, 0x2E, 0x3E, 0xB6, 0xD4, 0x6D, 0x7C, 0x3C, 0x3F, 0xE4, 0x7D, 0x64, 0x7C, 0xB2, 0xC2,
-    0x81, 0x08, 0x3C, 0xB4, 0xC0, 0x78, 0x72, 0xBA, 0xF4, 0x1B, 0xA5, 0x17, 0x4B, 0xD6, 0xA9, 0xB6,
-    0x5F, 0xBD, 0x92, 0xE6, 0x0E, 0x2F, 0xC6, 0x8A, 0x73, 0x9A, 0x60, 0xD2, 0xF7, 0x8A, 0x29, 0xDC,
-    0x85, 0xD2, 0xB7, 0xCA, 0x19, 0x12, 0xF9, 0xA4, 0x6F, 0x56, 0x01, 0xF1, 0x1B, 0x4D, 0xF8, 0x2E,
-    0xF0, 0xF5, 0x26, 0xBE, 0x0E, 0xFC, 0x7A, 0x17, 0x5F, 0x02, 0x5E, 0xD8, 0xEC, 0x29, 0xC5, 0x76,
-    0x42, 0x9C, 0x76, 0x8A, 0x63, 0xE1, 0x83, 0x76, 0x90, 0x68, 0x01, 0x9E, 0x96, 0xD8, 0x42, 0xB1,
-    0x56, 0x1C, 0x94, 0xBD, 0xAD, 0x67, 0xEC, 0x46, 0x86, 0x73, 0x0A, 0xF5, 0x5E, 0xA1, 0x8E, 0x1E,
-    0xF7, 0xEE, 0xA1, 0xDE, 0x08, 0x03, 0xCF, 0xD0, 0x4F, 0x99, 0x13, 0x8D, 0x8A, 0x80, 0x5B, 0xCB,
-    0x85, 0xEA, 0x24, 0x50, 0xF4, 0x8A, 0x88, 0xAC, 0x5B, 0xE7, 0xAD, 0x9E, 0xAC, 0x2D, 0x0B, 0xC7,
-    0x57, 0xCC, 0x8E, 0x14, 0x80, 0xC9, 0x4F, 0xE5, 0x40, 0xA6, 0x71, 0xC6, 0x25, 0xDC, 0x7F, 0xFD,
-    0x5A, 0x7A, 0xFC, 0xAF, 0x5C, 0x9C, 0x06, 0x4C, 0x13, 0x1A, 0x32, 0x36, 0xBE, 0x33, 0xEB, 0x9D,
-    0x8E, 0xC8, 0x0F, 0xAD, 0xA4, 0xAC, 0x8F, 0x8F, 0x94, 0xB2, 0x3E, 0x5D, 0x4D, 0x59, 0xAF, 0xFB,
-    0x78, 0x62, 0xF3, 0xE3, 0x10, 0x4E, 0xD3, 0x0E, 0x06, 0x45, 0x04, 0x77, 0x38, 0xF9, 0x7D, 0xA2,
-    0x9B, 0xD1, 0x85, 0x72, 0x4D, 0x10, 0xA1, 0x83, 0xBD, 0x80, 0x00, 0x46, 0x2D, 0x42, 0x79, 0x4F,
-    0x98, 0xC7, 0xDA, 0x8C, 0x53, 0x27, 0x64, 0x04, 0x4E, 0xC5, 0x17, 0x3A, 0xEC, 0x55, 0x7E, 0xE9,
-    0xAE, 0x7D, 0x11, 0x5B, 0xCC, 0x66, 0xAF, 0x39, 0x4D, 0xEC, 0x8F, 0x1D, 0x37, 0xEB, 0xD3, 0x67,
-    0x29, 0x9E, 0xB6, 0x23, 0x59, 0x3C, 0x91, 0x13, 0x59, 0x03, 0x16, 0xC3, 0x5A, 0x31, 0x36, 0x04,
-    0xB2, 0x4C, 0x5A, 0x36, 0x92, 0x05, 0x74, 0xEE, 0x73, 0xF4, 0x1A, 0x97, 0x59, 0x63, 0xEC, 0xB0,
-    0xDB, 0x37, 0x0B, 0xEB, 0xE6, 0x33, 0xDA, 0x13, 0xFA, 0x7A, 0x61, 0x4D, 0x29, 0xA8, 0xA4, 0xB9,
-    0x17, 0xAA, 0x5F, 0x87, 0x5D, 0x7E, 0x9A, 0x92, 0xE1, 0x6F, 0x2F, 0xB0, 0x9C, 0xDC, 0xAA, 0xF2,
-    0xFE, 0x9E, 0xF5, 0xA1, 0xBA, 0x48, 0x81, 0x70, 0x73, 0x66, 0xAB, 0x50, 0x7B, 0x7B, 0xA1, 0x0E,
-    0x4D, 0xC8, 0x67, 0x4B, 0xFF, 0x6E, 0xE0, 0x91, 0x0A, 0xE7, 0xFA, 0xF6, 0xD4, 0x0E, 0x5D, 0x25,
-    0x4E, 0x2B, 0x65, 0xD7, 0x75, 0x4F, 0x36, 0x75, 0x47, 0xE3, 0xEC, 0x2C, 0xC0, 0x10, 0xFF, 0x91,
-    0x41, 0x83, 0x76, 0xCF, 0xD0, 0xAB, 0xEE, 0x3D, 0x97, 0xE2, 0x61, 0xA2, 0x9D, 0x04, 0xA7, 0xCD,
-    0x9B, 0x9A, 0x95, 0xD0, 0xE7, 0x8E, 0x9E, 0xC7, 0x79, 0x8A, 0x9C, 0x1B, 0xF7, 0x98, 0x4F, 0x57,
-    0x6A, 0x50, 0x0D, 0xF7, 0xEB, 0x2E, 0x56, 0x8E, 0x1B, 0xE4, 0x1B, 0x56, 0x37, 0xB6, 0xC4, 0x67,
-    0xBA, 0x0F, 0x80, 0x1E, 0xD2, 0x8E, 0x87, 0x6E, 0x82, 0xB9, 0x56, 0xDE, 0xF8, 0x8A, 0xAC, 0xCF,
-    0x63, 0x04, 0x78, 0x6B, 0x64, 0xB7, 0x63, 0x6F, 0x31, 0x5B, 0xF7, 0x92, 0xC3, 0x53, 0x6A, 0x06,
-    0x74, 0x49, 0xAC, 0x55, 0x44, 0x4A, 0x09, 0xF6, 0xB1, 0x6F, 0xAB, 0x96, 0x51, 0x64, 0x8E, 0x91,
-    0x56, 0x7C, 0x31, 0xA3, 0xEB, 0x79, 0x32, 0x72, 0xA9, 0x0E, 0xDA, 0x95, 0x30, 0x89, 0xD3, 0x70,
-    0x49, 0x1C, 0xBB, 0x3C, 0xD0, 0x90, 0x54, 0xD8, 0xEC, 0x49, 0x70, 0x37, 0x39, 0x2D, 0x52, 0x2B,
-    0xC4, 0xAD, 0xF2, 0x58, 0xCF, 0xF5, 0x68, 0x0C, 0x99, 0xC6, 0x93, 0x05, 0xCD, 0x99, 0x9D, 0x9D,
-    0x9D, 0x6B, 0x9A, 0xE8, 0xB7, 0x1D, 0xC0, 0x26, 0xDE, 0xC3, 0xE7, 0xC3, 0x0D, 0xDA, 0x40, 0xB3,
-    0x21, 0x6F, 0x63, 0xDE, 0xC9, 0x64, 0x99, 0xAA, 0x63, 0xBE, 0x93, 0xDF, 0x7C, 0xF8, 0xE1, 0x86,
-    0x8E, 0x42, 0x0A, 0x59, 0x5F, 0x79, 0x81, 0x72, 0xCC, 0x5C, 0x77, 0x8B, 0x63, 0x3E, 0x8F, 0x70,
-    0x7B, 0xCB, 0xF6, 0x8A, 0x18, 0x67, 0x9F, 0x3C, 0xB9, 0xB9, 0x69, 0xD7, 0x1A, 0x81, 0xEB, 0x29,
-    0x43, 0x34, 0xB8, 0x61, 0xDA, 0x3C, 0x6C, 0x2F, 0x70, 0x28, 0xB5, 0xCE, 0xD6, 0x9E, 0x32, 0xE4,
-    0xE6, 0xEC, 0x80, 0x5A, 0x85, 0x74, 0x22, 0x02, 0x65, 0x51, 0x38, 0x2B, 0x41, 0xAD, 0x4C, 0xB2,
-    0x4E, 0xAD, 0x9E, 0xCC, 0x96, 0xE2, 0xD2, 0x59, 0x4F, 0x4B, 0xE4, 0xA3, 0xAA, 0x15, 0x8C, 0x9B,
-    0x59, 0x39, 0xA4, 0x59, 0x8F, 0xAF, 0x31, 0xFB, 0xCA, 0xE8, 0x42, 0xEE, 0x42, 0x39, 0x90, 0x29,
-    0xCB, 0x7D, 0x32, 0xEB, 0xDD, 0xE8, 0x93, 0x7F, 0x65, 0xBA, 0x9C, 0x3E, 0x56, 0x2D, 0xF9, 0xB5,
-    0xCB, 0x21, 0xE4, 0xF2, 0x2E, 0xBF, 0xE6, 0x74, 0x3A, 0x73, 0xFD, 0xFF, 0xD8, 0x61, 0xED, 0xF2,
-    0x64, 0xED, 0xEF, 0xE1, 0x7A, 0xBA, 0xD0, 0x5E, 0x9E, 0x02, 0xF8, 0xDE, 0x1D, 0xF6, 0xEC, 0x67,
-    0xBA, 0xE9, 0x2B, 0xE7, 0x5E, 0x1E, 0xCD, 0xC3, 0x12, 0x7B, 0x76, 0x0B, 0xB3, 0x59, 0xC4, 0x8B,
-    0x7E, 0x52, 0x7F, 0xCA, 0x1B, 0x94, 0x70, 0x87, 0xF8, 0x70, 0x05, 0x2C, 0x8E, 0x6F, 0x5E, 0x60,
-    0x26, 0xCC, 0xC6, 0x6D, 0x0A, 0x38, 0xD6, 0xC4, 0xF4, 0x7E, 0xBF, 0xC4, 0x14, 0x4A, 0x57, 0x17,
-    0x15, 0xA0, 0xB9, 0x97, 0x72, 0x1F, 0x8C, 0x18, 0x97, 0x5E, 0x0F, 0xE4, 0x94, 0x41, 0x7F, 0x82,
-    0x2F, 0xE2, 0x2E, 0x1B, 0x6E, 0xEE, 0x34, 0xE3, 0xE0, 0xED, 0x95, 0xE5, 0xAB, 0x0F, 0xCF, 0xBF,
-    0xB8, 0x73, 0x95, 0x26, 0xF4, 0xCE, 0xBB, 0xC8, 0xD8, 0xC2, 0xCD, 0x77, 0x0D, 0x1F, 0xA8, 0x4D,
-    0x2F, 0x32, 0x35, 0x2E, 0xD7, 0xD7, 0xC9, 0x2D, 0x6D, 0xD6, 0xDC, 0x6F, 0x62, 0xB8, 0xE6, 0x6E,
-    0x93, 0x96, 0x27, 0x50, 0xCC, 0xB7, 0x85, 0x2A, 0xF5, 0xD5, 0xB0, 0x4A, 0x92, 0x44, 0x6A, 0x94,
-    0x37, 0x15, 0x0A, 0x72, 0xE0, 0x8E, 0x64, 0x4F, 0xF0, 0x46, 0xB6, 0x66, 0x73, 0xF3, 0x9C, 0xA6,
-    0xC5, 0x18, 0xB9, 0xF4, 0x01, 0xF5, 0xE3, 0xDB, 0xEF, 0x05, 0x1E, 0x41, 0xE8, 0x8C, 0xEC, 0x39,
-    0x3A, 0xB5, 0x13, 0xA6, 0x49, 0x7B, 0x50, 0xB0, 0xED, 0x93, 0xB9, 0x81, 0x71, 0x3B, 0x41, 0x16,
-    0xB9, 0x69, 0xA3, 0x60, 0xD4, 0xC2, 0x9B, 0xEA, 0x84, 0x49, 0x1E, 0x67, 0x0B, 0x4E, 0xAA, 0x20,
-    0x87, 0xAC, 0x10, 0x96, 0x1E, 0x4E, 0xAB, 0xA0, 0x38, 0x68, 0xFD, 0x3E, 0x34, 0xD1, 0xD4, 0xCD,
-    0x29, 0xF2, 0x06, 0x24, 0x6E, 0xFB, 0xD9, 0x18, 0xF9, 0x0A, 0xB0, 0xF1, 0x6C, 0xED, 0xB7, 0x96,
-    0x0D, 0x5A, 0x07, 0xCB, 0x01, 0x1C, 0x7E, 0x4E, 0xCA, 0xA0, 0x77, 0x69, 0x09, 0x98, 0xE4, 0x59,
-    0x35, 0x85, 0x17, 0xDC, 0x83, 0x12, 0x4D, 0xF1, 0xE7, 0x1F, 0xC6, 0xE0, 0xA9, 0x27, 0x18, 0x84,
-    0x50, 0x3D, 0x75, 0x90, 0x81, 0x97, 0x03, 0xE0, 0x80, 0x6D, 0x68, 0x98, 0x4A, 0xC6, 0x65, 0x91,
-    0xD1, 0x3D, 0xE1, 0xDD, 0x96, 0x33, 0xE9, 0xBE, 0x1D, 0x68, 0xE2, 0x92, 0xD9, 0x61, 0x78, 0x31,
-    0x73, 0xC2, 0xAC, 0xE4, 0xA2, 0x2A, 0x56, 0xF6, 0x21, 0xFD, 0x57, 0x9B, 0x8B, 0xEB, 0xC0, 0xC1,
-    0x14, 0x7D, 0x9C, 0xC1, 0xF4, 0x99, 0xB6, 0x94, 0x4E, 0xCA, 0xE5, 0x60, 0x9A, 0x1E, 0x65, 0x30,
-    0x3D, 0x9A, 0xC6, 0x9C, 0x94, 0xD2, 0x94, 0xB3, 0x5A, 0x5A, 0x92, 0x0D, 0xA9, 0xED, 0xB8, 0xDA,
-    0x8C, 0x9F, 0xF9, 0x5E, 0x88, 0xE1, 0x22, 0x35, 0x31, 0x76, 0xCC, 0xC6, 0x76, 0xD9, 0x8B, 0x54,
-    0x6A, 0xA7, 0xDC, 0xD7, 0xA7, 0xBE, 0x63, 0x85, 0x2E, 0x8C, 0x6A, 0x11, 0x1E, 0xC2, 0xD5, 0x24,
-    0x23, 0x4F, 0xE2, 0xEE, 0xC4, 0x5A, 0x73, 0x35, 0x38, 0x0E, 0xE1, 0xE7, 0x29, 0x4D, 0xB8, 0x76,
-    0xB4, 0x61, 0x57, 0x7B, 0x88, 0xEE, 0x86, 0x4A, 0xEA, 0x98, 0xF9, 0x3C, 0xF4, 0x82, 0x13, 0x02,
-    0xE6, 0xBF, 0x56, 0xC1, 0x21, 0xF1, 0x30, 0x9E, 0x67, 0x64, 0x16, 0x8E, 0x7D, 0x9E, 0x7A, 0xE4,
-    0xD4, 0x4B, 0x3B, 0x1A, 0x6E, 0x06, 0x1F, 0xB1, 0xEB, 0xB4, 0xEE, 0xCE, 0x90, 0xD7, 0xA1, 0x86,
-    0x6B, 0xF6, 0xB4, 0xF8, 0xF6, 0xE7, 0xA2, 0x47, 0xC6, 0x3B, 0xA7, 0x2E, 0x2B, 0xB5, 0x0E, 0x2A,
-    0x79, 0x46, 0xFC, 0x36, 0x4C, 0xBE, 0x4F, 0xC9, 0x65, 0xF5, 0x74, 0xE8, 0x04, 0x94, 0x15, 0x48,
-    0xF2, 0xB5, 0xDC, 0x70, 0xB3, 0xD6, 0x1D, 0x05, 0xB2, 0x1C, 0x69, 0x43, 0x17, 0x88, 0x02, 0x9B,
-    0x23, 0x8B, 0xAF, 0xCB, 0xF4, 0x67, 0x9F, 0x97, 0x6A, 0x65, 0x6F, 0x82, 0x1F, 0x47, 0x9A, 0xBF,
-    0xF8, 0x76, 0xE5, 0xD4, 0xB8, 0xF4, 0xE0, 0x9C, 0xA9, 0x25, 0x7A, 0x31, 0xF4, 0x14, 0xD6, 0xD4,
-    0xAC, 0x8D, 0xCB, 0xD9, 0xEA, 0x36, 0x22, 0x29, 0x5C, 0x62, 0xAB, 0x68, 0xC9, 0xCA, 0xFE, 0x1A,
-    0x01, 0x98, 0x48, 0xB3, 0xA7, 0x20, 0x1B, 0x37, 0xEB, 0x3C, 0xE6, 0x67, 0xB5, 0x27, 0xB5, 0x4F,
-    0x5C, 0x96, 0xEB, 0xB2, 0x4B, 0x30, 0x39, 0x60, 0xB1, 0x78, 0x74, 0xFB, 0x64, 0x59, 0x1A, 0x01,
-    0x06, 0xC7, 0x8D, 0xCD, 0x73, 0x87, 0xEA, 0xF2, 0x1E, 0x74, 0xDC, 0x38, 0x6B, 0x34, 0xE7, 0xC2,
-    0xF2, 0xB8, 0x7F, 0x5E, 0xA2, 0x4F, 0xB0, 0x23, 0xCC, 0xDE, 0x65, 0x1A, 0x83, 0xFC, 0x41, 0x6B,
-    0xF5, 0x41, 0xC7, 0x17, 0x2F, 0x0F, 0x18, 0x1C, 0x86, 0x3E, 0x28, 0x87, 0xE3, 0xD1, 0xA4, 0x26,
-    0x8F, 0xB3, 0x9F, 0xC9, 0x31, 0x9F, 0x9B, 0x3D, 0x9D, 0x1F, 0x56, 0x18, 0x78, 0x9C, 0xDB, 0x6B,
-    0x3D, 0x9E, 0xAC, 0x0E, 0x0F, 0x0E, 0xEF, 0xA0, 0x7B, 0x3F, 0xD9, 0xD6, 0x8C, 0xA4, 0x97, 0xF9,
-    0xED, 0x87, 0xD9, 0x0E, 0x3F, 0x76, 0x0A, 0x88, 0xEE, 0x65, 0x3A, 0xA6, 0xF8, 0x83, 0xA6, 0x3C,
-    0x1C, 0x13, 0x77, 0x50, 0xB0, 0xAE, 0x35, 0xBA, 0xE6, 0x62, 0x42, 0x26, 0xCD, 0xE6, 0x91, 0x06,
-    0xD4, 0x92, 0x86, 0x43, 0x85, 0x86, 0x24, 0x7E, 0xDC, 0xBF, 0xC0, 0xE6, 0x6A, 0x9A, 0xA1, 0x51,
-    0xE6, 0xEE, 0x92, 0x16, 0x4F, 0x1D, 0xE9, 0x5E, 0x12, 0xED, 0x91, 0xAD, 0xFA, 0x4F, 0xD4, 0x2F,
-    0x5F, 0x95, 0x3F, 0xF1, 0x1D, 0xBE, 0x2A, 0x76, 0xF7, 0x1B, 0xD1, 0xDD, 0x9F, 0xAA, 0xCB, 0x73,
-    0x33, 0xE8, 0x2E, 0xB1, 0x8D, 0xF3, 0xC4, 0x22, 0xA8, 0x56, 0xD8, 0x4F, 0x46, 0x88, 0x6B, 0x3E,
-    0x84, 0x01, 0x54, 0xBF, 0xD9, 0xA0, 0x1D, 0x24, 0x7E, 0x55, 0x58, 0x0E, 0x1C, 0x01, 0x97, 0x4B,
-    0x6D, 0x5C, 0xD1, 0xAF, 0x49, 0x48, 0x62, 0xA7, 0xFB, 0x3E, 0x3D, 0xC5, 0x4C, 0x9B, 0x6F, 0x76,
-    0x3E, 0xC8, 0x4B, 0x13, 0x6C, 0xBB, 0x9C, 0x08, 0x9A, 0xA8, 0x55, 0xD7, 0x12, 0xCD, 0xFD, 0xA3,
-    0xE9, 0xDF, 0xB1, 0x43, 0xA1, 0xDC, 0xFB, 0x3C, 0x9D, 0x7C, 0xC6, 0x76, 0x57, 0xA3, 0x77, 0x13,
-    0xEC, 0x28, 0x63, 0x13, 0x64, 0x14, 0x52, 0x7E, 0xF1, 0x10, 0x18, 0x93, 0x27, 0x8B, 0x3B, 0xE3,
-    0x95, 0x4B, 0x48, 0x17, 0xF9, 0x31, 0xDB, 0x79, 0xA6, 0x09, 0x55, 0x55, 0xCC, 0x5C, 0x87, 0xCB,
-    0x76, 0x9E, 0xEF, 0x6B, 0xE7, 0x9A, 0xED, 0x4C, 0xC5, 0x67, 0x80, 0x18, 0x08, 0x66, 0xEE, 0x44,
-    0x3B, 0x6B, 0x24, 0x7E, 0xB9, 0x6C, 0x30, 0xB6, 0xD7, 0x6C, 0x7D, 0x1B, 0x47, 0xEB, 0xB6, 0x71,
-    0x0C, 0x7D, 0xF6, 0x72, 0x05, 0x5F, 0xCC, 0x6C, 0xB7, 0x3D, 0xDC, 0xC6, 0xF1, 0x79, 0xBF, 0x8D,
-    0x63, 0x3B, 0xD8, 0xC6, 0x31, 0x6E, 0xFE, 0x1F, 0xDD, 0x5B, 0xBD, 0x6F, 0xE5, 0xC6, 0x11, 0x5F,
-    0x92, 0xD6, 0x23, 0x20, 0x16, 0x74, 0x71, 0x49, 0xA1, 0x2B, 0xD8, 0xC6, 0x2A, 0xCC, 0x3E, 0x88,
-    0x4D, 0x3A, 0x29, 0x5C, 0x5C, 0x61, 0x15, 0xA7, 0x73, 0xE1, 0xC2, 0x8D, 0xAF, 0x71, 0x80, 0xE8,
-    0x1F, 0x70, 0x4C, 0x1A, 0x29, 0xD2, 0xAA, 0x48, 0x52, 0xA4, 0x89, 0x80, 0xC8, 0x81, 0x4E, 0x2E,
-    0xAE, 0x49, 0xA1, 0x00, 0x77, 0x22, 0xE3, 0xC2, 0x06, 0x9C, 0x22, 0x8C, 0x01, 0xA7, 0x35, 0x13,
-    0x1C, 0x52, 0xC4, 0xC5, 0xD1, 0x00, 0x05, 0x53, 0x0A, 0xC9, 0xCD, 0xFC, 0x66, 0x97, 0x5F, 0xCF,
-    0x4A, 0x6C, 0xDD, 0xE5, 0x9E, 0xF8, 0xF2, 0xA4, 0x37, 0x4B, 0xF1, 0x63, 0x77, 0xF6, 0x37, 0xB3,
-    0xF3, 0xB5, 0x94, 0x10, 0x49, 0x25, 0xE8, 0x23, 0x6B, 0x22, 0x86, 0x6C, 0x88, 0x5A, 0x52, 0x82,
-    0xB6, 0xA0, 0x4E, 0x2D, 0x63, 0x21, 0xDC, 0x5A, 0xA6, 0x44, 0xAB, 0x84, 0xA8, 0x5F, 0x06, 0xB9,
-    0x10, 0x41, 0x11, 0x14, 0x42, 0x44, 0xB9, 0x5F, 0x0A, 0x91, 0x64, 0x1E, 0x75, 0x21, 0x53, 0xB7,
-    0xA6, 0x0E, 0x62, 0xA7, 0x11, 0xA6, 0x94, 0xB2, 0x45, 0x37, 0xD4, 0x91, 0x0D, 0x1A, 0x3A, 0xA0,
-    0xA9, 0xDB, 0xEE, 0xDE, 0x91, 0xA9, 0x47, 0x23, 0xC9, 0x2C, 0xA0, 0x47, 0x92, 0x22, 0xA0, 0xC7,
-    0xA3, 0x22, 0xA2, 0xAE, 0x82, 0x4A, 0x52, 0xB7, 0x3E, 0xB8, 0x18, 0x7D, 0x9C, 0x18, 0x14, 0x43,
-    0x11, 0x2D, 0x87, 0x63, 0x2F, 0xEB, 0x6F, 0xD9, 0xB8, 0x0B, 0xBE, 0x65, 0x21, 0x68, 0x8C, 0x9A,
-    0x07, 0x15, 0xE6, 0x99, 0x23, 0x43, 0x41, 0x6C, 0x84, 0xB8, 0x44, 0x5D, 0xDC, 0x91, 0xB1, 0x91,
-    0x48, 0xE2, 0x8D, 0xAE, 0xC6, 0x81, 0xFC, 0x42, 0xC6, 0x51, 0x49, 0x17, 0x92, 0x1C, 0x24, 0x33,
-    0x71, 0x64, 0xD3, 0xB9, 0xF3, 0x3D, 0x5C, 0xA5, 0x5B, 0x3C, 0x59, 0x47, 0xB1, 0x2D, 0xF3, 0x20,
-    0x16, 0x37, 0xFA, 0x81, 0x4C, 0x8C, 0xEF, 0x00, 0x20, 0xB7, 0xC5, 0x11, 0x88, 0x59, 0xF5, 0x97,
-    0xDF, 0x0E, 0x19, 0xC6, 0xB2, 0x07, 0x53, 0xFC, 0xA8, 0xE1, 0xC7, 0x98, 0x3A, 0x7C, 0xC6, 0xCF,
-    0x99, 0xF9, 0x58, 0x2C, 0x7D, 0x66, 0x26, 0x82, 0xCD, 0x43, 0xF0, 0x2A, 0x99, 0x80, 0xD7, 0x28,
-    0x05, 0xF0, 0x31, 0x98, 0xA3, 0x49, 0x5A, 0xCC, 0x60, 0xB1, 0x62, 0xFC, 0x17, 0x07, 0xA0, 0x2E,
-    0x31, 0xB8, 0x7D, 0x00, 0x56, 0x64, 0xFD, 0x10, 0x23, 0x40, 0x08, 0x76, 0x19, 0x85, 0x50, 0x09,
-    0x28, 0xC5, 0x86, 0x30, 0xC2, 0xB9, 0xC2, 0xAA, 0x3F, 0x06, 0x78, 0xB6, 0x2A, 0xE1, 0x4A, 0x9A,
-    0x4D, 0x20, 0x7F, 0x1D, 0x8A, 0x64, 0x2F, 0x17, 0x46, 0x63, 0x97, 0xC2, 0xCA, 0x45, 0xBD, 0x3A,
-    0x58, 0xB7, 0x19, 0x29, 0x3F, 0x65, 0xFD, 0x2C, 0xB6, 0x49, 0xE8, 0x46, 0xC5, 0x60, 0x69, 0x58,
-    0xAB, 0x28, 0x06, 0xAC, 0xEE, 0x1A, 0xC0, 0x9A, 0x84, 0xDD, 0x4C, 0x9C, 0x9C, 0x30, 0x33, 0x7E,
-    0x0B, 0xEE, 0x9C, 0x8B, 0x16, 0xFC, 0x93, 0x72, 0xBC, 0x2C, 0x9C, 0x54, 0x33, 0x7F, 0x67, 0x87,
-    0xCE, 0x81, 0x5F, 0x02, 0x2E, 0x25, 0xF8, 0xE9, 0x6E, 0x7F, 0x27, 0xC1, 0xAA, 0x05, 0x67, 0x02,
-    0x8C, 0x6D, 0xEC, 0x55, 0xE2, 0xA6, 0x94, 0x15, 0x6E, 0xA9, 0x2C, 0xD9, 0x26, 0x95, 0x2D, 0x43,
-    0xAF, 0xA2, 0x05, 0x4F, 0xA4, 0x11, 0x3E, 0x8E, 0x22, 0x3A, 0xF7, 0x2B, 0x5C, 0xA5, 0x5B, 0x48,
-    0x4C, 0x1F, 0x57, 0x22, 0x6A, 0x49, 0xA6, 0x1D, 0x4A, 0x6F, 0x31, 0x95, 0xFC, 0xD7, 0x7D, 0x05,
-    0x30, 0xD1, 0xED, 0x43, 0x28, 0xAA, 0xAC, 0xDF, 0x19, 0x69, 0xEE, 0xDA, 0x40, 0xDC, 0x59, 0x5D,
-    0x9F, 0x57, 0x3E, 0xB0, 0x5A, 0x14, 0xD0, 0x61, 0x80, 0xF8, 0x09, 0x3D, 0x77, 0x7F, 0xD0, 0xE1,
-    0x07, 0xAB, 0x36, 0xCD, 0x34, 0x7C, 0xFC, 0x7B, 0xF4, 0x4A, 0x63, 0x09, 0xEB, 0xAF, 0xE0, 0xDA,
-    0x8C, 0xB7, 0x00, 0xE7, 0xC6, 0x6D, 0x66, 0x9C, 0x6D, 0x70, 0xC4, 0xF2, 0x68, 0x7D, 0x9A, 0x85,
-    0x55, 0x12, 0xA7, 0x00, 0x7C, 0x67, 0xAE, 0x90, 0x2F, 0xF6, 0x37, 0xE9, 0xAF, 0xC6, 0x07, 0xDB,
-    0xC4, 0x4D, 0xE9, 0x75, 0x9E, 0x86, 0x6D, 0xB0, 0x2D, 0x69, 0x12, 0xDE, 0x17, 0xF4, 0x58, 0xF0,
-    0x0A, 0xF5, 0x53, 0x09, 0x7F, 0x0A, 0x79, 0xFE, 0xAD, 0x21, 0xF7, 0x9F, 0x00, 0xF2, 0x6D, 0xB6,
-    0xC5, 0xC9, 0xC8, 0x54, 0x34, 0xE8, 0xD7, 0x2B, 0x82, 0x0C, 0x7E, 0xC2, 0x29, 0xE6, 0xED, 0xDE,
-    0xAE, 0x1A, 0x61, 0x2C, 0xEE, 0xC1, 0xF3, 0x00, 0xBE, 0x00, 0x4C, 0xCA, 0xFB, 0x05, 0xF9, 0x40,
-    0xBB, 0xA6, 0xD5, 0x2B, 0x4E, 0xAF, 0x3B, 0x08, 0x69, 0x94, 0x2F, 0xE9, 0x3F, 0xF7, 0xF8, 0x26,
-    0x9E, 0x23, 0xBB, 0x68, 0xF7, 0xD6, 0x87, 0x34, 0x69, 0x37, 0xB5, 0x89, 0x3A, 0xE7, 0x7B, 0x29,
-    0x63, 0x8F, 0x29, 0x27, 0xBC, 0x24, 0x46, 0x26, 0x67, 0x9E, 0x52, 0x0A, 0x60, 0x3C, 0x23, 0xFA,
-    0x86, 0xF5, 0x0D, 0x61, 0x7E, 0x79, 0xF0, 0x80, 0x7C, 0x94, 0x81, 0x07, 0x11, 0x68, 0x05, 0x58,
-    0x05, 0x8B, 0x8B, 0x95, 0x46, 0x22, 0x0C, 0x30, 0x73, 0xA4, 0x03, 0x39, 0xF7, 0xD5, 0x4F, 0x33,
-    0x46, 0x38, 0x1B, 0x21, 0x1C, 0xAE, 0x0D, 0xC2, 0x1E, 0x3B, 0x4D, 0xA8, 0xCA, 0x0F, 0x4B, 0x42,
-    0xB8, 0x78, 0xEB, 0xDA, 0x11, 0x56, 0xE1, 0xB1, 0x72, 0x33, 0x06, 0x53, 0x13, 0xD4, 0x73, 0x7E,
-    0x06, 0x9C, 0xDF, 0x73, 0x40, 0xCF, 0xA2, 0x75, 0xC2, 0x19, 0xAC, 0x59, 0x6C, 0x2D, 0x1F, 0x82,
-    0xB1, 0x97, 0x88, 0xAD, 0x57, 0xAA, 0xE7, 0x69, 0x81, 0x66, 0x35, 0x65, 0x10, 0xC8, 0x21, 0xD8,
-    0x71, 0x29, 0xB0, 0xCF, 0xC5, 0x75, 0x78, 0xCF, 0x13, 0xF6, 0x9E, 0xC4, 0xBB, 0xF5, 0x8F, 0xC1,
-    0x7B, 0x9A, 0xB1, 0x20, 0x4B, 0x6F, 0xE5, 0x06, 0xCE, 0xB7, 0x6F, 0x40, 0x0A, 0x52, 0x72, 0x0C,
-    0xA0, 0x22, 0x9B, 0x1D, 0x31, 0x6B, 0xEF, 0xE9, 0xF7, 0xDE, 0xF3, 0xA4, 0xF7, 0x9E, 0xEC, 0x29,
-    0x4F, 0xC5, 0xBB, 0x40, 0xBB, 0x86, 0x55, 0x47, 0x18, 0x70, 0x1A, 0xAE, 0xD0, 0x7B, 0x6E, 0x85,
-    0xC6, 0x01, 0xEC, 0x05, 0xCC, 0xB3, 0xDB, 0x26, 0x05, 0x9C, 0x39, 0x80, 0x31, 0x18, 0x30, 0x71,
-    0xF3, 0x91, 0xF8, 0xBF, 0xF2, 0x9E, 0xE6, 0x81, 0xD8, 0xA6, 0x70, 0x8B, 0x30, 0x37, 0xE4, 0x07,
-    0x0D, 0x14, 0xA8, 0x02, 0xF6, 0xF9, 0xCA, 0xCD, 0x0A, 0x33, 0x03, 0x70, 0xDD, 0x66, 0x42, 0x7A,
-    0xEF, 0x49, 0x4F, 0xE5, 0x93, 0xEF, 0x67, 0xBB, 0x21, 0xFB, 0xFB, 0xF1, 0x17, 0xE7, 0x08, 0xA9,
-    0xFE, 0xFB, 0xCF, 0xE3, 0xF8, 0x6B, 0xF7, 0x74, 0xDF, 0xA5, 0xFE, 0x7A, 0x2E, 0xDE, 0x55, 0x53,
-    0x32, 0xE9, 0x26, 0x03, 0x37, 0x26, 0x5D, 0x64, 0xF7, 0x3E, 0x07, 0xA9, 0x39, 0xE4, 0x53, 0x03,
-    0x0B, 0x49, 0x0A, 0x62, 0xC9, 0xD0, 0xAF, 0xA8, 0x3F, 0xC2, 0x35, 0x62, 0x92, 0x45, 0x74, 0x61,
-    0x4C, 0x8A, 0x0E, 0x75, 0x16, 0x00, 0x49, 0xC8, 0x20, 0xB5, 0xFE, 0x65, 0x12, 0x42, 0xB2, 0xA1,
-    0x01, 0x42, 0xEB, 0x15, 0x33, 0xFD, 0x4E, 0xCF, 0xC1, 0x1F, 0x58, 0x8B, 0x98, 0x84, 0xFA, 0xC8,
-    0x68, 0x3A, 0x2E, 0xEE, 0xE1, 0x4C, 0x46, 0x5F, 0xCA, 0xA3, 0xDC, 0x42, 0x39, 0x07, 0x58, 0xE3,
-    0x84, 0xA4, 0xF0, 0x70, 0x10, 0xFD, 0x33, 0x87, 0x4B, 0x87, 0x5D, 0x50, 0x6F, 0x18, 0x9D, 0xE7,
-    0xB8, 0x78, 0xE2, 0xE5, 0xBA, 0x1E, 0x61, 0xF0, 0x6A, 0x19, 0x92, 0xEA, 0xD5, 0x60, 0xE7, 0x54,
-    0x56, 0xEE, 0xCB, 0xC7, 0x19, 0xA9, 0x58, 0xFA, 0xD0, 0x93, 0xE1, 0x89, 0x71, 0xB2, 0x3A, 0x40,
-    0x54, 0xE4, 0x91, 0x05, 0x08, 0xBA, 0x4F, 0xB1, 0x4C, 0x28, 0x04, 0xFD, 0x1B, 0x19, 0x30, 0x3B,
-    0x75, 0xF6, 0x57, 0x0A, 0xC3, 0xE6, 0xBE, 0x8A, 0xCC, 0x8E, 0xF7, 0x23, 0x1A, 0xE8, 0x8C, 0xD8,
-    0x60, 0x5B, 0x9A, 0x4B, 0x44, 0xFF, 0x3E, 0x16, 0xDC, 0x86, 0xB6, 0xA8, 0x01, 0x96, 0xFB, 0x32,
-    0x39, 0xDB, 0xDD, 0xD1, 0xA3, 0x2D, 0x11, 0xBE, 0x00, 0x3B, 0x30, 0x22, 0x17, 0xC7, 0x07, 0x97,
-    0xDF, 0x3C, 0x90, 0x4B, 0xC6, 0x18, 0xA9, 0xA9, 0xD0, 0xCE, 0xD7, 0x95, 0xB7, 0x60, 0xC0, 0xE4,
-    0x27, 0xC4, 0x5A, 0xF4, 0x1B, 0x3C, 0x88, 0x84, 0x1D, 0x01, 0xF5, 0x03, 0x31, 0xD1, 0x22, 0xC6,
-    0x4F, 0x01, 0xA8, 0x10, 0x54, 0x10, 0x0A, 0xC6, 0x50, 0x30, 0x88, 0x4C, 0x33, 0xC1, 0xE0, 0x4D,
-    0x69, 0xB1, 0x6C, 0x0F, 0x19, 0x4C, 0x85, 0x26, 0xDB, 0xDA, 0x50, 0x28, 0x3C, 0x35, 0xA0, 0x8C,
-    0x28, 0x17, 0x62, 0x90, 0x96, 0xAA, 0x32, 0x8C, 0x51, 0x63, 0x68, 0x13, 0x23, 0x73, 0x0D, 0xC6,
-    0x45, 0x7D, 0x60, 0x28, 0x0F, 0xB8, 0x30, 0xDE, 0xCB, 0xA4, 0xD9, 0xBD, 0x4D, 0x5E, 0x00, 0x57,
-    0x97, 0x08, 0x5F, 0xC0, 0x5C, 0x46, 0xA4, 0x3D, 0x3E, 0xBA, 0xFC, 0xE6, 0x81, 0x5C, 0x32, 0x06,
-    0x43, 0x13, 0x77, 0x75, 0x16, 0xBB, 0x80, 0xEB, 0xFC, 0x1D, 0x38, 0xB5, 0xCF, 0x81, 0x11, 0x2C,
-    0xAD, 0x1F, 0xF6, 0x75, 0x96, 0xAD, 0x1D, 0x38, 0xB6, 0x16, 0xF3, 0x24, 0xD4, 0x12, 0xC8, 0x92,
-    0x8C, 0x71, 0x49, 0x86, 0xDA, 0xAD, 0xC9, 0xE0, 0xD8, 0x4C, 0x1A, 0x20, 0x32, 0x21, 0x13, 0xC3,
-    0x04, 0x0B, 0xF9, 0xBC, 0x90, 0xE7, 0x6F, 0x94, 0x80, 0xB7, 0x44, 0xDD, 0xA6, 0x04, 0x2E, 0x84,
-    0x94, 0x81, 0xD8, 0xC3, 0xF8, 0x05, 0x67, 0xA0, 0x38, 0x62, 0x1B, 0xEA, 0x09, 0x52, 0xC9, 0x96,
-    0xCE, 0x94, 0xC5, 0x7C, 0x55, 0x92, 0x2D, 0x98, 0x57, 0xAA, 0x60, 0x84, 0x38, 0x2F, 0xA1, 0x99,
-    0x19, 0xC1, 0xF4, 0x51, 0xA8, 0xF4, 0x12, 0x6A, 0x39, 0xD2, 0xCA, 0x15, 0x59, 0x36, 0x92, 0x45,
-    0xEA, 0xC9, 0xC7, 0xF1, 0x8B, 0x6F, 0x4A, 0xF1, 0x3D, 0xE3, 0x88, 0xCE, 0xA3, 0x54, 0x45, 0x99,
-    0x2E, 0xB1, 0xEE, 0x7C, 0xD9, 0x0A, 0x9F, 0x50, 0xBC, 0xA1, 0x75, 0xF0, 0xD9, 0x9B, 0x7E, 0x0E,
-    0xDF, 0x5A, 0x0F, 0x48, 0x92, 0x0A, 0x9D, 0x38, 0x3D, 0x7C, 0x70, 0x07, 0x16, 0xD6, 0xA7, 0xFB,
-    0x2F, 0xA4, 0x27, 0xEF, 0x35, 0x70, 0x66, 0xFE, 0xB7, 0x84, 0x2A, 0x79, 0x4A, 0xA8, 0x76, 0xE9,
-    0x7B, 0x0C, 0xC7, 0x0D, 0xF5, 0xAA, 0x84, 0xF7, 0x55, 0x4B, 0x56, 0x30, 0x89, 0x4F, 0x47, 0xE1,
-    0xCE, 0xB5, 0x07, 0x11, 0xFF, 0xB1, 0x58, 0x51, 0x88, 0x76, 0x56, 0x71, 0x06, 0xFA, 0x68, 0x90,
-    0x49, 0x6C, 0xD1, 0x34, 0xC8, 0x99, 0x44, 0x31, 0x5D, 0xA7, 0x40, 0xD1, 0x54, 0xC5, 0x25, 0x59,
-    0x11, 0x73, 0xF4, 0xBB, 0x27, 0x73, 0x9C, 0xBF, 0xCA, 0xAF, 0x0F, 0xA8, 0x6A, 0xF5, 0xBB, 0xB5,
-    0x2F, 0x82, 0x86, 0xA0, 0x60, 0x47, 0x90, 0xC0, 0x58, 0x90, 0x2E, 0x39, 0x9D, 0xB8, 0x68, 0xC6,
-    0x4F, 0xF0, 0xFB, 0xBF, 0xE2, 0xAD, 0x8F, 0x49, 0xC9, 0xE4, 0x52, 0x28, 0xEA, 0x72, 0x45, 0x09,
-    0xE1, 0x30, 0x81, 0x9F, 0xE4, 0x49, 0x1E, 0x65, 0x1B, 0x2A, 0x01, 0xC8, 0xBF, 0xF9, 0x87, 0x67,
-    0x13, 0x47, 0x79, 0x52, 0x24, 0xB9, 0x3F, 0xEC, 0x2F, 0x51, 0xC8, 0x1C, 0x73, 0xBD, 0xBB, 0xE2,
-    0x82, 0xB7, 0xE4, 0xD0, 0x5F, 0xA6, 0xB6, 0x7C, 0x44, 0xA1, 0x31, 0xB4, 0x44, 0x16, 0xA8, 0x8D,
-    0x06, 0x15, 0x02, 0x7B, 0xBF, 0x46, 0xD0, 0xEF, 0xD5, 0x90, 0xAF, 0xDB, 0x68, 0x5A, 0x8C, 0xE8,
-    0xF8, 0x7C, 0x05, 0x4F, 0xA1, 0x9E, 0x52, 0x3D, 0xB8, 0x00, 0xB8, 0xA4, 0x6E, 0x6D, 0x59, 0x70,
-    0x6A, 0x91, 0x0A, 0xA9, 0x95, 0x42, 0xBB, 0x33, 0x44, 0x0D, 0xC6, 0x28, 0x67, 0xB4, 0xD5, 0x6E,
-    0x58, 0xA5, 0xDD, 0x64, 0x7F, 0x3C, 0xAA, 0x1F, 0x1A, 0x77, 0x07, 0x55, 0x6D, 0x58, 0x55, 0x43,
-    0x57, 0xBE, 0x2E, 0x53, 0xBA, 0x9D, 0x52, 0x14, 0xD2, 0x52, 0xA4, 0x39, 0x01, 0x12, 0x14, 0x22,
-    0x79, 0x4F, 0x0A, 0x95, 0xFF, 0x04, 0xC8, 0x5F, 0x08, 0x0F, 0xDC, 0xEC, 0xCA, 0x0F, 0x30, 0x6F,
-    0x82, 0xC0, 0x60, 0x7E, 0x7C, 0x5E, 0x4B, 0xB7, 0xFB, 0x81, 0x4E, 0x3A, 0x55, 0xB5, 0x7B, 0x62,
-    0x36, 0x4B, 0x99, 0x58, 0x50, 0x29, 0x07, 0x02, 0xFA, 0x7D, 0x95, 0x02, 0x27, 0x61, 0x1F, 0x64,
-    0xD8, 0xBC, 0xBE, 0x6C, 0x55, 0xB1, 0xD8, 0x9F, 0xB9, 0x08, 0xAE, 0x16, 0x5C, 0xAF, 0x46, 0x0A,
-    0xE6, 0x21, 0x4B, 0x9F, 0x26, 0xB7, 0x7D, 0x04, 0x8B, 0x1A, 0x35, 0x01, 0x5B, 0x54, 0x98, 0x8E,
-    0x1A, 0x85, 0x40, 0x37, 0x87, 0x6A, 0x6C, 0x8C, 0x0A, 0x0F, 0xB3, 0xD6, 0x6F, 0xAD, 0x17, 0x26,
-    0x07, 0x9F, 0xAF, 0x16, 0x1C, 0x7C, 0xC6, 0xFF, 0x25, 0xF8, 0xBC, 0x3B, 0x0E, 0x3E, 0x1B, 0x15,
-    0x7C, 0x86, 0x82, 0x91, 0x16, 0x8C, 0x1E, 0x87, 0x9D, 0x00, 0x74, 0x38, 0x60, 0xA4, 0x3B, 0xDA,
-    0x5D, 0xC2, 0x2F, 0x20, 0xD7, 0x4F, 0x31, 0xE8, 0x1C, 0x7C, 0x0A, 0x0D, 0xBB, 0xC6, 0x9D, 0x81,
-    0xDF, 0x62, 0x6B, 0xE1, 0xB2, 0xDA, 0x5A, 0xE5, 0xF6, 0x11, 0x04, 0x1F, 0xB5, 0x62, 0x8A, 0xBC,
-    0xA3, 0x90, 0x0F, 0xD7, 0x02, 0x79, 0xDE, 0xAE, 0xD6, 0x3E, 0xD9, 0x2E, 0x78, 0x6F, 0xEF, 0x7D,
-    0x9E, 0xB5, 0xD5, 0x48, 0xA1, 0x23, 0x55, 0x84, 0xAA, 0x43, 0x85, 0xFF, 0xBB, 0x3B, 0x42, 0x47,
-    0xAB, 0xE8, 0x33, 0xE3, 0x19, 0xD1, 0x63, 0xF2, 0x2C, 0xAA, 0xE1, 0x61, 0xC9, 0x38, 0x23, 0x5A,
-    0xED, 0x6C, 0xB8, 0x3A, 0xB0, 0xDB, 0x11, 0x9D, 0x18, 0xF9, 0xD0, 0x69, 0xF5, 0x53, 0x42, 0x5E,
-    0x60, 0x97, 0x24, 0xE2, 0xF2, 0x9E, 0xC7, 0x65, 0x1E, 0xB5, 0x61, 0xD2, 0x47, 0xA3, 0x2F, 0x8C,
-    0x38, 0xFE, 0x31, 0x33, 0x64, 0x65, 0xD0, 0x7F, 0xD8, 0xF0, 0xA8, 0x79, 0x89, 0xA5, 0x20, 0x96,
-    0xA4, 0xB0, 0x2E, 0xFA, 0x8F, 0xCD, 0x7A, 0xE1, 0x5E, 0x21, 0xD2, 0x5D, 0x95, 0xB1, 0x47, 0x16,
-    0xFD, 0x03, 0x40, 0xDB, 0x62, 0x0D, 0x9E, 0x41, 0x38, 0xE6, 0xFE, 0x26, 0xD6, 0x81, 0x71, 0x5B,
-    0x65, 0x58, 0xEC, 0x92, 0x20, 0x2E, 0x91, 0xBC, 0x86, 0xAB, 0x15, 0x16, 0x31, 0x05, 0xBF, 0x37,
-    0x66, 0x6E, 0xD5, 0xF7, 0x17, 0x34, 0x4E, 0xFB, 0x26, 0x67, 0x20, 0x42, 0xBC, 0xE3, 0xF4, 0x26,
-    0x5C, 0xA6, 0x7D, 0xDC, 0x8C, 0xFA, 0x5B, 0x4C, 0x4A, 0xF8, 0x53, 0xE1, 0x85, 0xDF, 0x00, 0x7C,
-    0xF5, 0xF4, 0xC0, 0x67, 0x1D, 0xF0, 0xFC, 0x52, 0x89, 0x08, 0x06, 0xCB, 0x62, 0x4A, 0xA8, 0xBD,
-    0x53, 0x79, 0x58, 0x1B, 0x99, 0x59, 0x4D, 0x7D, 0xED, 0xBA, 0x47, 0x2E, 0xE6, 0x71, 0xE7, 0x60,
-    0x59, 0xF9, 0xA2, 0xCF, 0x4B, 0x82, 0xC4, 0x6A, 0x50, 0x6E, 0x4C, 0xE6, 0x16, 0xDC, 0x6C, 0x1D,
-    0xAA, 0x45, 0x51, 0xF4, 0xAA, 0x82, 0xF2, 0xB2, 0x5A, 0xC3, 0x95, 0x98, 0xD6, 0x73, 0xD5, 0x0A,
-    0x41, 0xBC, 0x0A, 0x09, 0x51, 0xCC, 0x0A, 0x11, 0x51, 0x03, 0x19, 0xF9, 0x25, 0x0B, 0x09, 0x40,
-    0x3E, 0x42, 0x51, 0x9B, 0xC5, 0xD4, 0x0A, 0x85, 0xB2, 0x50, 0x90, 0x0B, 0x25, 0x29, 0xA1, 0x84,
-    0xD1, 0x37, 0xC5, 0xA4, 0x99, 0x5E, 0x63, 0x81, 0x75, 0x8F, 0xEB, 0xCE, 0x94, 0xCC, 0x84, 0x12,
-    0x9A, 0xD0, 0x52, 0xD3, 0x62, 0xD3, 0x72, 0xEB, 0x04, 0xD7, 0x49, 0x6E, 0x71, 0x2C, 0xBA, 0x9A,
-    0xAF, 0xAE, 0xCD, 0xF0, 0x4C, 0xCD, 0x56, 0x79, 0x3E, 0x2D, 0x42, 0xA2, 0x24, 0x17, 0x1F, 0x15,
-    0x87, 0x3C, 0x28, 0xA8, 0x8B, 0x56, 0x66, 0x5C, 0x1D, 0x8F, 0x01, 0x72, 0xC3, 0x2E, 0x35, 0xC7,
-    0xF3, 0x97, 0x3B, 0xE2, 0xE2, 0x32, 0x47, 0x5C, 0xD0, 0x53, 0x06, 0x3B, 0xE2, 0xC7, 0x63, 0x47,
-    0xDC, 0x4C, 0x1D, 0xB1, 0x66, 0x90, 0x26, 0xA3, 0xE2, 0x77, 0xA9, 0x30, 0x57, 0x1B, 0x61, 0xC2,
-    0xD6, 0x4B, 0xF9, 0x74, 0xDD, 0x05, 0x61, 0x1C, 0xF3, 0xF4, 0x92, 0x42, 0x27, 0x60, 0x5C, 0x7B,
-    0xE8, 0x5F, 0x6C, 0x40, 0x16, 0x73, 0xED, 0x82, 0x10, 0x5B, 0x2A, 0x7C, 0x8F, 0xD4, 0x1A, 0x89,
-    0xA4, 0x7E, 0xF1, 0x62, 0x14, 0xD4, 0x89, 0xC5, 0x64, 0x7D, 0x38, 0xEB, 0xBF, 0x3E, 0x16, 0x87,
-    0xA2, 0xAB, 0x1C, 0x10, 0xC5, 0xCA, 0x78, 0x2E, 0xC8, 0x86, 0x17, 0xC4, 0x92, 0x61, 0xAD, 0x18,
-    0x33, 0x58, 0x2B, 0xC3, 0xCB, 0x30, 0x0F, 0xD8, 0xA2, 0x5D, 0xE8, 0xAA, 0x25, 0xD6, 0xB5, 0xFB,
-    0x21, 0xDF, 0xE8, 0x89, 0x17, 0xC3, 0xB5, 0x37, 0x5A, 0x2A, 0xEF, 0xCC, 0xE1, 0xA9, 0x65, 0x9B,
-    0xF0, 0xE5, 0x16, 0xAF, 0x76, 0x20, 0xAC, 0xB4, 0x32, 0x7B, 0x7F, 0x16, 0x82, 0x58, 0x73, 0x78,
-    0x3B, 0x7F, 0xAE, 0xB5, 0xBA, 0xDB, 0xE4, 0xF4, 0x54, 0xB3, 0xFC, 0x36, 0xD3, 0x4C, 0x54, 0x5F,
-    0x6D, 0x3C, 0x59, 0xAA, 0xF2, 0x20, 0x87, 0xE3, 0x51, 0x7D, 0x2D, 0x40, 0x64, 0x11, 0x52, 0xE7,
-    0xCF, 0x8E, 0x52, 0xB2, 0x43, 0x9C, 0xD3, 0xC8, 0x04, 0xBF, 0x23, 0x29, 0xF4, 0x14, 0x3E, 0xEF,
-    0x16, 0xE8, 0x6D, 0xDC, 0x92, 0xE1, 0x4F, 0x11, 0xC7, 0xF5, 0x9B, 0x1D, 0xE3, 0xDA, 0xA0, 0xE6,
-    0x99, 0xAB, 0x83, 0x5F, 0xE7, 0x5F, 0x15, 0xBF, 0x32, 0x72, 0xD3, 0x4F, 0x4A, 0x72, 0x4A, 0xC3,
-    0x10, 0xD9, 0xA5, 0x91, 0x4C, 0x64, 0x1A, 0xF0, 0x1E, 0xB7, 0x6C, 0x83, 0xD4, 0x94, 0x25, 0xE5,
-    0x53, 0x1B, 0xC3, 0x1B, 0x5E, 0x79, 0xB7, 0xF1, 0xE1, 0xF5, 0x5B, 0x20, 0xAA, 0x16, 0x37, 0xDA,
-    0xEA, 0x66, 0x26, 0x1D, 0xF6, 0xCA, 0x0B, 0x55, 0x70, 0x53, 0x49, 0x33, 0x57, 0x4D, 0x74, 0xD4,
-    0xA4, 0x98, 0x3F, 0x9A, 0xBB, 0x08, 0x2E, 0x7F, 0xC1, 0x3B, 0xBD, 0xFC, 0x05, 0xEF, 0x95, 0x48,
-    0x41, 0x47, 0x05, 0xB6, 0x8A, 0x01, 0x54, 0x90, 0xA6, 0xF7, 0xD1, 0x78, 0xE3, 0x79, 0xA2, 0x18,
-    0xDA, 0xDE, 0xD8, 0x2D, 0xC3, 0x7B, 0xAB, 0x61, 0x2C, 0x5E, 0xAB, 0xB9, 0xD9, 0xAB, 0xB8, 0x91,
-    0x85, 0x6A, 0x52, 0x6E, 0xD8, 0x8A, 0xE0, 0x5D, 0x82, 0xA7, 0x6F, 0xAC, 0xAE, 0x11, 0x1A, 0x70,
-    0x8D, 0xB8, 0x86, 0xBC, 0xC3, 0x5C, 0x83, 0xDE, 0xA1, 0xDE, 0x69, 0xFE, 0xE6, 0xD1, 0xA8, 0x90,
-    0x28, 0x94, 0x16, 0xE9, 0xB8, 0x47, 0x07, 0x78, 0x6E, 0xAE, 0x5E, 0x7A, 0xE8, 0xD6, 0x03, 0x1A,
-    0xC0, 0xF8, 0x71, 0xCB, 0xCD, 0xE7, 0x35, 0x37, 0x34, 0x04, 0x37, 0x19, 0x37, 0xE7, 0x5A, 0x40,
-    0x57, 0x6A, 0x20, 0x15, 0x95, 0xF7, 0xA4, 0x08, 0x71, 0x12, 0x34, 0x81, 0xE2, 0x9A, 0xA5, 0x03,
-    0x5B, 0x59, 0xF2, 0xEB, 0x77, 0x7A, 0x9D, 0xBC, 0x7D, 0x30, 0xE6, 0x5D, 0x8B, 0xC8, 0x94, 0xE3,
-    0x9A, 0x8B, 0x4A, 0xF9, 0xD7, 0x5A, 0x46, 0xE6, 0x71, 0xA8, 0x84, 0x92, 0x8E, 0x73, 0x22, 0x1D,
-    0xE6, 0x99, 0x7A, 0x0B, 0x25, 0x9A, 0xAB, 0x8C, 0x3A, 0x7F, 0xA6, 0xB8, 0x53, 0xC6, 0x8A, 0xAC,
-    0x95, 0x9E, 0x44, 0x31, 0x6C, 0x40, 0x76, 0x06, 0x4B, 0x5B, 0x2C, 0x98, 0xAC, 0xB5, 0x5D, 0x55,
-    0x2A, 0x72, 0xA5, 0x93, 0xBA, 0x89, 0xC7, 0x1A, 0xC9, 0xE8, 0x50, 0x5C, 0xA2, 0xC4, 0xA5, 0x1E,
-    0xB3, 0x8A, 0x99, 0xCB, 0xCF, 0xAD, 0x6C, 0xB6, 0xC8, 0x92, 0xFF, 0x77, 0x20, 0x51, 0x6F, 0xEC,
-    0xD6, 0x6C, 0xB0, 0x45, 0x69, 0x3C, 0x5A, 0x7F, 0x3B, 0xD8, 0xBD, 0x76, 0xF8, 0x32, 0x9B, 0x90,
-    0x8B, 0x86, 0x75, 0x96, 0x03, 0x34, 0xE7, 0x2F, 0xFC, 0x98, 0x13, 0xDF, 0x8C, 0x67, 0x2C, 0xA3,
-    0x75, 0x47, 0x5E, 0x45, 0x5F, 0x03, 0xB4, 0x63, 0xA0, 0x97, 0x23, 0xB0, 0x99, 0xAF, 0x95, 0x85,
-    0x32, 0x67, 0xEE, 0x24, 0x68, 0xD7, 0x7F, 0x4D, 0x63, 0xB8, 0x2D, 0x76, 0xBE, 0xFC, 0xDE, 0x7C,
-    0x37, 0xA7, 0x84, 0x0D, 0xA4, 0xA7, 0xF6, 0xEC, 0x96, 0x2A, 0x90, 0x09, 0x44, 0x1B, 0x47, 0xD8,
-    0xEB, 0xE7, 0xEC, 0xA2, 0x45, 0xAF, 0xD4, 0xBF, 0xD3, 0xE2, 0x4F, 0x82, 0x21, 0x82, 0x48, 0x62,
-    0xD8, 0x58, 0xF9, 0x47, 0xE6, 0xFD, 0xEF, 0xBC, 0xED, 0xFE, 0x95, 0xEC, 0x51, 0x77, 0x59, 0xA5,
-    0x91, 0x8D, 0xE8, 0xEA, 0x6B, 0xE7, 0x57, 0x9E, 0x88, 0xB2, 0x03, 0x0E, 0xEA, 0xFE, 0x7F, 0x0F,
-    0x79, 0x0A, 0x91, 0xFA, 0xA7, 0xA7, 0x29, 0xDF, 0x5E, 0x4D, 0xBC, 0xF9, 0x25, 0xA7, 0x16, 0x7E,
-    0x45, 0x49, 0x07, 0x92, 0xB1, 0xCC, 0xA1, 0x9C, 0x24, 0xB5, 0x5B, 0x43, 0xC6, 0x96, 0x34, 0x51,
-    0x50, 0x85, 0x44, 0xE5, 0xCF, 0x89, 0xD1, 0xE4, 0x4F, 0xD8, 0xA5, 0xF8, 0x33, 0x2A, 0xC3, 0x8F,
-    0x4B, 0x04, 0x85, 0xC8, 0xB9, 0xC0, 0xAF, 0x83, 0x81, 0x6D, 0x55, 0x3C, 0xEE, 0x76, 0xF0, 0x79,
-    0x9F, 0x93, 0x01, 0x8E, 0x6A, 0x88, 0xA8, 0xD0, 0xEF, 0x73, 0x06, 0x9C, 0x66, 0x55, 0x73, 0x44,
-    0x6E, 0xF2, 0xF9, 0xC9, 0xE0, 0xFE, 0x26, 0x7D, 0x26, 0xE1, 0xB2, 0xF8, 0x57, 0x01, 0xA3, 0x13,
-    0x13, 0x8C, 0x41, 0x11, 0xC0, 0x5C, 0x04, 0xC8, 0x25, 0x09, 0x46, 0x2F, 0xF3, 0x47, 0xBA, 0xA8,
-    0xEA, 0x81, 0x16, 0x43, 0x61, 0xDE, 0x2F, 0x07, 0xBD, 0x76, 0x98, 0x46, 0xF9, 0xF0, 0x0F, 0x09,
-    0x2F, 0xCC, 0x57, 0x79, 0xAF, 0xB4, 0xE1, 0x3C, 0x0F, 0x35, 0x9E, 0x38, 0x63, 0xE5, 0x8B, 0x95,
-    0x2B, 0x56, 0x9E, 0x78, 0xE4, 0x88, 0x67, 0x8A, 0xF9, 0x50, 0x3C, 0x42, 0xED, 0x88, 0x4B, 0x47,
-    0x56, 0x99, 0x50, 0x5E, 0x98, 0x2D, 0xB2, 0x59, 0x21, 0xFD, 0x6F, 0xC5, 0x58, 0xBD, 0x8F, 0xDC,
-    0xC6, 0x15, 0x7F, 0x24, 0xB5, 0x47, 0x43, 0x4C, 0x4C, 0x15, 0xDE, 0x20, 0xB0, 0xE1, 0xB0, 0x4A,
-    0x11, 0xC1, 0x31, 0x9B, 0x14, 0x2E, 0x94, 0x1B, 0xCA, 0x2A, 0x52, 0xEA, 0x8A, 0xDB, 0xB8, 0x50,
-    0xA1, 0x26, 0x95, 0x8B, 0x38, 0x45, 0x4A, 0xC3, 0xA4, 0xAD, 0x7F, 0xE0, 0xFE, 0x04, 0x15, 0x57,
-    0xC8, 0xD7, 0x48, 0xA5, 0x10, 0x28, 0x20, 0x1D, 0x15, 0x2E, 0xD2, 0x50, 0x31, 0x84, 0x14, 0x69,
-    0x88, 0x04, 0x6E, 0xEC, 0x22, 0x13, 0x89, 0x80, 0x18, 0x8B, 0xE4, 0xE4, 0xF7, 0x1B, 0x7E, 0xEC,
-    0xDE, 0x49, 0x3A, 0xAF, 0x24, 0x0B, 0x99, 0xDD, 0x79, 0xE4, 0x90, 0xEF, 0xBD, 0x79, 0x6F, 0xE6,
-    0x7D, 0x0D, 0xA5, 0x10, 0xD1, 0x22, 0x17, 0x24, 0x37, 0x72, 0xEB, 0x82, 0x5C, 0xBF, 0x25, 0xD7,
-    0x0B, 0xB9, 0x2E, 0x2F, 0xFE, 0xDF, 0x13, 0x91, 0x42, 0xBC, 0x4C, 0x42, 0x11, 0x65, 0xB2, 0xD7,
-    0xBD, 0xCC, 0xFB, 0x2C, 0x93, 0xBF, 0x64, 0xE2, 0xBE, 0xC4, 0xDF, 0x49, 0x94, 0xA9, 0xE6, 0xBF,
-    0x90, 0xF3, 0xB1, 0xE1, 0x87, 0x47, 0x47, 0x47, 0x59, 0x6E, 0x8C, 0x29, 0xD6, 0x40, 0xD8, 0x70,
-    0x57, 0x9F, 0xE8, 0x6C, 0xED, 0x8B, 0x5E, 0xC9, 0xB3, 0x97, 0x34, 0xF9, 0x7F, 0xF6, 0xCF, 0xE5,
-    0xBC, 0x2C, 0x57, 0xAB, 0x3D, 0x05, 0x79, 0xD4, 0x28, 0x13, 0xDB, 0xF9, 0xA3, 0xA3, 0x1B, 0x1C,
-    0xE3, 0x7A, 0xE8, 0x36, 0x7E, 0x13, 0xD4, 0xA1, 0x8E, 0xB4, 0xAA, 0x54, 0x95, 0x96, 0xCB, 0x24,
-    0x6C, 0xC2, 0x26, 0xAA, 0x63, 0x8E, 0x0B, 0x55, 0xA4, 0xC9, 0x52, 0xFC, 0x36, 0x68, 0xF1, 0xB4,
-    0x8E, 0x74, 0x5C, 0xC5, 0x78, 0xB6, 0x94, 0xB4, 0x48, 0x4B, 0x55, 0xC5, 0xA0, 0x0A, 0x75, 0x50,
-    0x7B, 0x8D, 0xB3, 0x0F, 0x3E, 0x35, 0x38, 0x69, 0xF2, 0x0A, 0x81, 0x07, 0x7E, 0xC0, 0x60, 0xCF,
-    0x81, 0x6B, 0x8A, 0x65, 0xB2, 0x4A, 0xC8, 0x37, 0x6C, 0x40, 0x55, 0x2B, 0x6D, 0xF9, 0x0F, 0x33,
-    0xA0, 0xE7, 0x49, 0x9A, 0x18, 0x59, 0xCA, 0xBE, 0x70, 0x66, 0xBC, 0x63, 0x07, 0xAD, 0x7D, 0x07,
-    0x8C, 0x3C, 0xC9, 0xF1, 0xDE, 0x60, 0x45, 0x57, 0xC0, 0xC1, 0x38, 0x4B, 0xCB, 0xBC, 0xE0, 0x7B,
-    0xE2, 0x51, 0x2E, 0x6A, 0xC0, 0xB9, 0x3D, 0xC8, 0xE0, 0xEC, 0x3B, 0x7B, 0xB2, 0x4C, 0xB0, 0xF9,
-    0xD8, 0xF2, 0xB8, 0x1C, 0x7A, 0x54, 0x0C, 0x3D, 0x2C, 0x44, 0xDD, 0xFC, 0x56, 0x43, 0x7F, 0xDB,
-    0x77, 0x6F, 0x7E, 0xA3, 0xF9, 0xEC, 0x58, 0x8F, 0x4E, 0xF4, 0x89, 0xC7, 0xD4, 0xC9, 0x77, 0xEA,
-    0x0B, 0xD8, 0x71, 0x0C, 0xC7, 0x88, 0x70, 0x1F, 0xB2, 0x97, 0x96, 0xC7, 0x2F, 0xAE, 0xDE, 0x3F,
-    0x04, 0xFF, 0x7A, 0xEA, 0x03, 0xEF, 0x72, 0xC0, 0xDB, 0xC0, 0xFD, 0xF9, 0xE5, 0x7B, 0xBF, 0xDB,
-    0xC4, 0x3B, 0x17, 0x16, 0xE7, 0x06, 0x1E, 0x1B, 0xB8, 0xE4, 0xBF, 0x27, 0x81, 0x91, 0xD8, 0x14,
-    0xB0, 0xE3, 0xD4, 0xE8, 0xE1, 0xAF, 0xF8, 0x2F, 0x23, 0x53, 0xB8, 0x3D, 0xF7, 0xF5, 0x3D, 0x48,
-    0x94, 0x88, 0xD2, 0xA2, 0x7A, 0xD8, 0x7D, 0xA9, 0x4C, 0x63, 0xED, 0x5E, 0x54, 0x2D, 0x2A, 0x83,
-    0xE7, 0xCA, 0x39, 0x62, 0xC5, 0x65, 0xAA, 0x73, 0x9D, 0x62, 0xFD, 0x17, 0x83, 0x39, 0x44, 0x95,
-    0xD3, 0x01, 0xC7, 0x03, 0x62, 0xE3, 0x9B, 0x44, 0xD5, 0x00, 0xB1, 0x76, 0x0D, 0x9C, 0x09, 0x8B,
-    0x2D, 0x13, 0x92, 0xDB, 0x49, 0x9A, 0xA9, 0x1A, 0x52, 0x80, 0x75, 0xC3, 0x4B, 0x35, 0x8E, 0x62,
-    0xED, 0x75, 0x92, 0x17, 0x40, 0xDF, 0x93, 0x85, 0xC5, 0x55, 0xB5, 0x6A, 0x14, 0x76, 0x12, 0x8F,
-    0xC4, 0x06, 0x0C, 0x79, 0xA9, 0x50, 0xB1, 0x0E, 0x18, 0x36, 0x54, 0x30, 0x68, 0xB8, 0x2F, 0xFD,
-    0x77, 0x12, 0x73, 0xAC, 0xB9, 0xD9, 0x76, 0x3F, 0xD2, 0x7D, 0xBD, 0x2A, 0x85, 0xBF, 0x4A, 0x9E,
-    0x8F, 0x6E, 0x75, 0x45, 0x7C, 0xFB, 0x0B, 0x9E, 0x87, 0x4E, 0xD6, 0xCD, 0x33, 0x89, 0x04, 0xF5,
-    0xB0, 0x23, 0xA6, 0x94, 0x50, 0x8F, 0x6B, 0xA2, 0xAD, 0x5D, 0xA2, 0xA5, 0x7F, 0x6D, 0xB8, 0xD9,
-    0x36, 0xA4, 0x5D, 0x6A, 0xE1, 0x32, 0xB6, 0x19, 0xB7, 0x75, 0xFA, 0xE9, 0xB6, 0xF3, 0xDA, 0xF9,
-    0xD6, 0x6F, 0xE6, 0xDB, 0x91, 0x97, 0x18, 0xAF, 0x8D, 0xCB, 0x0F, 0x45, 0xDE, 0x4C, 0xC8, 0x41,
-    0xDD, 0x35, 0x95, 0x03, 0xF3, 0x55, 0xFF, 0x68, 0xF2, 0xCB, 0x06, 0xF6, 0xD1, 0xC1, 0x08, 0x75,
-    0x1F, 0x3F, 0x6E, 0xC3, 0xC7, 0x46, 0x42, 0xF3, 0x55, 0xAB, 0xBE, 0xE8, 0x23, 0x0D, 0x63, 0xF9,
-    0x93, 0xDF, 0xA8, 0xC2, 0x44, 0x65, 0x0A, 0x79, 0x43, 0xAD, 0x32, 0x03, 0x43, 0xCB, 0x68, 0x0C,
-    0xE9, 0x74, 0x0B, 0x6F, 0x9F, 0x6E, 0xF3, 0x64, 0xBE, 0x85, 0xD9, 0x81, 0xAC, 0xCA, 0x13, 0x81,
-    0x85, 0xC5, 0x7F, 0xEB, 0x43, 0x30, 0x13, 0xAF, 0x81, 0x7E, 0x6D, 0x60, 0x7A, 0xF2, 0xC2, 0x6A,
-    0xC1, 0x3A, 0x5B, 0xEB, 0x0B, 0x0E, 0xB4, 0xCE, 0x47, 0x49, 0xCF, 0x88, 0x2C, 0xE4, 0x44, 0xE3,
-    0x7B, 0x98, 0xF3, 0xD8, 0x7C, 0xD3, 0x88, 0x37, 0xC7, 0xBD, 0x10, 0xC2, 0x8F, 0x8B, 0xC7, 0xF5,
-    0x7B, 0x60, 0xA6, 0xF5, 0xB3, 0x5E, 0x01, 0xEF, 0x2A, 0xA6, 0x11, 0x23, 0xD2, 0xB8, 0x8A, 0xE3,
-    0xC8, 0xC8, 0xC6, 0xE8, 0x62, 0xBF, 0x39, 0xBA, 0xD4, 0x6E, 0x8C, 0x8C, 0x5F, 0xBF, 0x79, 0x20,
-    0x3B, 0x07, 0xE2, 0x1C, 0x92, 0x27, 0x94, 0x69, 0x25, 0xED, 0xB1, 0x66, 0x12, 0x3D, 0xEA, 0xE3,
-    0xAF, 0x0C, 0xFC, 0xC5, 0x24, 0xB9, 0x29, 0x02, 0x84, 0xE4, 0x2F, 0x7B, 0xF3, 0xBE, 0xC9, 0x0B,
-    0x63, 0x2A, 0x0F, 0x09, 0xE7, 0x72, 0x9D, 0xDE, 0x6D, 0xE3, 0x7B, 0xD0, 0x5F, 0x7E, 0x9F, 0x01,
-    0xAA, 0x2F, 0x9B, 0xE8, 0x9F, 0x1D, 0xE5, 0xF5, 0x5A, 0x3B, 0x0A, 0x1F, 0xB6, 0xDC, 0x2E, 0xBF,
-    0x41, 0x7C, 0xFD, 0xFB, 0x34, 0x62, 0xB4, 0x5D, 0xBF, 0x8B, 0xCA, 0x61, 0xF4, 0xC0, 0xD2, 0xA9,
-    0x02, 0xA3, 0xBB, 0xED, 0xC8, 0x25, 0x4F, 0x82, 0x26, 0xBD, 0xD6, 0x2A, 0x0A, 0xC5, 0x55, 0xF7,
-    0x8C, 0xB9, 0x88, 0xEC, 0x87, 0xD9, 0xB9, 0xF0, 0x0E, 0x96, 0x1A, 0x92, 0x29, 0xA4, 0x43, 0xAC,
-    0xBD, 0xA4, 0x8D, 0xC4, 0x9D, 0x84, 0xA3, 0x9E, 0x8E, 0x30, 0x16, 0xD0, 0x01, 0xD3, 0x42, 0x4C,
-    0xE6, 0x18, 0x2E, 0x2A, 0xE6, 0x03, 0x23, 0x84, 0x47, 0x2C, 0xD4, 0x2E, 0x2D, 0xAF, 0x80, 0x6D,
-    0x9A, 0x4F, 0x61, 0x09, 0xB0, 0x20, 0x20, 0xE0, 0x3D, 0x45, 0x05, 0x52, 0x54, 0x02, 0x0D, 0x58,
-    0x2A, 0x4B, 0x05, 0xA8, 0x7F, 0x1E, 0x90, 0xDF, 0x07, 0x73, 0xA0, 0x03, 0x97, 0x04, 0x41, 0x63,
-    0x49, 0x80, 0x6F, 0xF5, 0x2B, 0x2D, 0x19, 0x68, 0x48, 0x98, 0x8B, 0x25, 0xED, 0x2C, 0xB1, 0x03,
-    0xE9, 0x14, 0x18, 0x82, 0x71, 0x4D, 0x31, 0xB8, 0xD9, 0xC6, 0x06, 0x3E, 0x6C, 0x5F, 0x50, 0xAA,
-    0x32, 0x07, 0x91, 0x56, 0x05, 0x5E, 0xC3, 0x5C, 0xB8, 0x74, 0x40, 0xA1, 0x4A, 0xC6, 0x69, 0x89,
-    0x86, 0x59, 0x91, 0xC3, 0x04, 0xA8, 0x51, 0x46, 0x64, 0xD0, 0x12, 0x1D, 0x54, 0x24, 0x00, 0x1D,
-    0x49, 0x68, 0x68, 0x1D, 0x53, 0x89, 0x25, 0x23, 0x35, 0x08, 0x49, 0x4F, 0xD2, 0x7E, 0x24, 0x16,
-    0x79, 0x9B, 0x5B, 0x4E, 0x6D, 0x68, 0xC6, 0x85, 0x38, 0x8F, 0x30, 0xE1, 0x03, 0x68, 0x50, 0x36,
-    0x12, 0x14, 0x77, 0x24, 0xCC, 0x76, 0x25, 0xC6, 0x6F, 0x17, 0x77, 0xF2, 0x1A, 0x88, 0x33, 0xC9,
-    0xE1, 0x4C, 0x05, 0x22, 0x6D, 0xC8, 0x88, 0x8B, 0x91, 0xA4, 0xF0, 0xDC, 0x86, 0x43, 0x7A, 0x36,
-    0x78, 0xA4, 0x95, 0x44, 0x09, 0x2C, 0xDB, 0xB5, 0x99, 0x07, 0xA3, 0xE9, 0x2D, 0x56, 0xA9, 0x20,
-    0x41, 0x5E, 0xB9, 0x26, 0xF3, 0xC1, 0xA1, 0x25, 0x87, 0xB4, 0x94, 0x20, 0xE3, 0xFE, 0x4C, 0xE6,
-    0x2F, 0x6E, 0x0B, 0x6A, 0xBF, 0xF0, 0x7A, 0x79, 0x17, 0x8A, 0xF9, 0xBD, 0xE4, 0x59, 0xD8, 0x7A,
-    0x9D, 0x6B, 0x12, 0xCF, 0x38, 0x4D, 0xD0, 0x59, 0x49, 0x63, 0x5A, 0x87, 0x96, 0x9C, 0x79, 0xA6,
-    0xC5, 0x2B, 0x06, 0x96, 0xC0, 0x7A, 0x8D, 0xF9, 0x77, 0x6D, 0xB5, 0x44, 0x8C, 0x47, 0x7E, 0x0D,
-    0x4D, 0x92, 0x56, 0xA9, 0x46, 0x94, 0x4F, 0x91, 0xAD, 0x99, 0x7D, 0xCA, 0xB3, 0xB0, 0x5E, 0x8D,
-    0xD8, 0xE0, 0x9A, 0xCB, 0xB4, 0xFB, 0xA0, 0xF3, 0xE8, 0x1A, 0x60, 0xC8, 0x42, 0x0A, 0x0C, 0xC1,
-    0x16, 0x0C, 0xF7, 0x20, 0x1E, 0x5E, 0xB5, 0x78, 0x19, 0xD5, 0x10, 0xC2, 0x64, 0x41, 0x89, 0x8B,
-    0x12, 0x37, 0x41, 0xAE, 0xF8, 0x11, 0x25, 0x3D, 0xE4, 0xE2, 0x21, 0xD7, 0x88, 0xCD, 0x22, 0x23,
-    0xF0, 0x8F, 0x01, 0x8A, 0x6F, 0x01, 0x32, 0xCC, 0x09, 0xD0, 0x41, 0xB9, 0xE3, 0xA0, 0x82, 0x31,
-    0x2C, 0x36, 0x32, 0xD6, 0x90, 0xB4, 0xDA, 0x91, 0x73, 0x33, 0xCD, 0x61, 0x69, 0x6D, 0xAA, 0x62,
-    0x73, 0x11, 0x12, 0xD2, 0xA1, 0x10, 0x64, 0x39, 0xD0, 0xC4, 0x06, 0x82, 0x1B, 0x7F, 0xEC, 0x01,
-    0x7A, 0x04, 0xCD, 0x10, 0x70, 0x0C, 0xD2, 0x0E, 0xA3, 0x51, 0x5E, 0x5B, 0x2D, 0x91, 0xEE, 0x86,
-    0xBE, 0xD9, 0x18, 0x31, 0x10, 0x7E, 0x84, 0x95, 0x26, 0x3B, 0x9C, 0x85, 0x01, 0x0A, 0x65, 0xD6,
-    0xD1, 0x01, 0x98, 0xDB, 0x19, 0x8C, 0xE6, 0xF0, 0xBA, 0xC5, 0xFF, 0x15, 0xFA, 0x8F, 0x91, 0x96,
-    0xE5, 0x42, 0x04, 0x70, 0xDB, 0x2F, 0xC5, 0xD3, 0x4E, 0x7F, 0x11, 0x64, 0x29, 0xA7, 0xDA, 0x31,
-    0x07, 0x78, 0xBC, 0xB2, 0xA1, 0xBE, 0xB6, 0x15, 0xAA, 0x78, 0x35, 0x5D, 0x1C, 0x1B, 0xAE, 0xDF,
-    0xC5, 0xE3, 0x8F, 0x49, 0xFB, 0x4B, 0x26, 0xF5, 0xD7, 0x06, 0x07, 0x0D, 0x58, 0x63, 0x40, 0x88,
-    0x58, 0xC4, 0xBA, 0xE4, 0xC7, 0xE8, 0xB0, 0x5D, 0x07, 0x66, 0xEC, 0x41, 0x1E, 0xBF, 0x1C, 0xCB,
-    0x9B, 0x64, 0x30, 0x5B, 0xCA, 0x4B, 0x1D, 0x1E, 0x95, 0xE2, 0xFE, 0x47, 0x8B, 0x57, 0xD6, 0xA3,
-    0xD9, 0xFE, 0x7A, 0x32, 0x5B, 0x9B, 0x7A, 0x96, 0xB3, 0x82, 0xF9, 0x1C, 0x12, 0xD3, 0xE4, 0xC9,
-    0x3B, 0x35, 0xE5, 0xA8, 0x03, 0xE5, 0xDC, 0x1A, 0xB3, 0x55, 0x3A, 0xC6, 0x6A, 0xDF, 0xB0, 0x06,
-    0x9A, 0xEE, 0xC6, 0xA4, 0xF3, 0x13, 0xF3, 0x75, 0x32, 0xA5, 0xB5, 0x29, 0x10, 0x07, 0x8F, 0x9B,
-    0x69, 0xF3, 0x1E, 0x4E, 0x61, 0x5C, 0xDD, 0x9B, 0xA2, 0xAF, 0x8D, 0x31, 0x68, 0x67, 0xAF, 0xFB,
-    0xD9, 0x1F, 0xDD, 0x1B, 0x22, 0x43, 0x04, 0xF7, 0xDB, 0xE9, 0x8E, 0xAE, 0x2A, 0xC1, 0x89, 0x3B,
-    0x4C, 0xFC, 0xC9, 0x6F, 0xAA, 0x8F, 0x64, 0xF7, 0x52, 0xFD, 0x51, 0xC2, 0x02, 0x5D, 0xB8, 0x11,
-    0xD9, 0xD3, 0xEE, 0x44, 0x59, 0x56, 0x8C, 0x7B, 0x29, 0x41, 0xCC, 0xF9, 0x0C, 0x72, 0x93, 0xA4,
-    0x58, 0x29, 0xAF, 0x43, 0x7C, 0x70, 0x0C, 0x62, 0x4F, 0xD0, 0xA2, 0x26, 0xF3, 0xFA, 0xD0, 0xC6,
-    0x38, 0x64, 0x9C, 0xD6, 0xC7, 0x24, 0x7F, 0x38, 0x0B, 0x8A, 0x9F, 0x7A, 0x09, 0xB6, 0xAF, 0x9C,
-    0xFF, 0xA3, 0x32, 0xA5, 0xCD, 0x0E, 0xD3, 0x7A, 0x51, 0x1F, 0x97, 0xEA, 0xD9, 0xE4, 0x64, 0xA5,
-    0x8C, 0xAA, 0x19, 0x23, 0x1B, 0x31, 0x9C, 0x35, 0x46, 0x3D, 0x29, 0x68, 0x73, 0x94, 0x9A, 0x31,
-    0xFA, 0x09, 0xC3, 0x5F, 0x63, 0xCC, 0x53, 0xA1, 0xF0, 0x1A, 0xFF, 0xDF, 0x70, 0xEB, 0x9E, 0xF9,
-    0x9F, 0xD1, 0xEE, 0x6F, 0x85, 0xB6, 0x5C, 0xB1, 0x08, 0x1B, 0xFE, 0xE7, 0xCD, 0x29, 0x04, 0xD9,
-    0x8C, 0xB6, 0xCC, 0xB7, 0x43, 0x5B, 0xCD, 0xA6, 0xE6, 0xC2, 0x03, 0x76, 0x06, 0xE7, 0x2C, 0x27,
-    0x07, 0x1D, 0x5D, 0xA8, 0x4D, 0xE9, 0xA8, 0x49, 0xD4, 0xEE, 0x26, 0x71, 0x7B, 0x06, 0x5B, 0xC1,
-    0x20, 0x26, 0xF3, 0xD5, 0x76, 0x6C, 0x7E, 0xCC, 0xA8, 0x4D, 0xBF, 0xD1, 0xD6, 0x1B, 0x3D, 0xC4,
-    0x27, 0x1F, 0x3D, 0x64, 0xC0, 0xC7, 0xB2, 0xA9, 0xF1, 0x35, 0x72, 0x09, 0xA3, 0xA8, 0x5D, 0x31,
-    0xAE, 0xFC, 0x50, 0x9D, 0x0C, 0x56, 0xBF, 0x94, 0x27, 0x9B, 0x1A, 0x71, 0xAC, 0x93, 0x97, 0x4F,
-    0x5E, 0xD3, 0x31, 0x30, 0xB0, 0x32, 0x59, 0x6C, 0x6A, 0x13, 0x76, 0xD4, 0x25, 0xEC, 0xA8, 0x49,
-    0xD8, 0x51, 0x8F, 0xB0, 0xA3, 0x16, 0xA1, 0xD5, 0x61, 0xD0, 0x60, 0x90, 0x9F, 0x30, 0x6E, 0x08,
-    0x73, 0x0D, 0x08, 0xC9, 0xA1, 0x1B, 0xE4, 0x06, 0x84, 0xD4, 0x84, 0x88, 0xFA, 0x0D, 0x25, 0x06,
-    0x84, 0x2C, 0xC8, 0xB4, 0x90, 0xD4, 0xD9, 0x3B, 0x29, 0x27, 0x9E, 0x43, 0x2A, 0x64, 0x0F, 0xC0,
-    0xA8, 0x1B, 0xEF, 0x21, 0x1F, 0x38, 0x2C, 0xD6, 0xF8, 0xAA, 0x76, 0xF2, 0x1E, 0x55, 0x7F, 0x6C,
-    0x58, 0xD0, 0x33, 0x08, 0xDA, 0xFB, 0x4E, 0xD5, 0xE1, 0x41, 0xD8, 0xAB, 0xFA, 0x0C, 0xEC, 0x5C,
-    0x31, 0x82, 0x58, 0xE8, 0xF7, 0x3C, 0x8C, 0x84, 0x34, 0x7F, 0x14, 0x09, 0x31, 0x83, 0x3D, 0xCE,
-    0x81, 0xA8, 0xD0, 0x12, 0x66, 0x64, 0xC6, 0x62, 0x9E, 0x56, 0x22, 0x5B, 0x8F, 0xC2, 0xA4, 0x61,
-    0xAE, 0x88, 0xC9, 0x8B, 0xE4, 0x98, 0x68, 0x7C, 0x5E, 0xDA, 0xEC, 0xA5, 0xA9, 0x50, 0x5A, 0x8F,
-    0xF7, 0x20, 0xC4, 0x89, 0xCA, 0x59, 0xE3, 0xE7, 0x93, 0x73, 0x5A, 0x90, 0x2C, 0x57, 0xBF, 0xA5,
-    0xD1, 0x7B, 0x74, 0x8B, 0x60, 0x76, 0x79, 0x1E, 0xC2, 0xEC, 0xAA, 0x0B, 0x7D, 0xD5, 0x25, 0x86,
-    0x4F, 0x0C, 0xDA, 0x00, 0x05, 0x19, 0x31, 0xB8, 0x27, 0xCE, 0x90, 0xE9, 0xB8, 0xB3, 0x2B, 0x98,
-    0x5A, 0xCA, 0x98, 0x04, 0xD0, 0xCB, 0x27, 0x37, 0xC1, 0xFE, 0xE3, 0x10, 0x76, 0x46, 0x50, 0x12,
-    0x54, 0xA7, 0x82, 0x72, 0x46, 0xCE, 0x00, 0x7A, 0x01, 0xA8, 0x01, 0x60, 0x17, 0x2F, 0x03, 0x36,
-    0x1A, 0xAD, 0xC4, 0xA3, 0xC1, 0x87, 0x04, 0x91, 0x31, 0x9F, 0xD1, 0xF4, 0xB7, 0x02, 0x31, 0x01,
-    0xC8, 0xBE, 0xD5, 0x8C, 0xB5, 0xDA, 0x21, 0x90, 0x9D, 0x29, 0xE9, 0xD8, 0xC3, 0xA8, 0x9A, 0x02,
-    0x5E, 0xB1, 0x4B, 0x65, 0x08, 0x2A, 0x02, 0x7D, 0x2A, 0xB0, 0x28, 0xA5, 0xC2, 0x5A, 0x15, 0xA4,
-    0x4D, 0xEC, 0x37, 0x85, 0xF3, 0x47, 0x9F, 0x63, 0x51, 0x9D, 0xFD, 0x29, 0x10, 0xAD, 0x81, 0x8B,
-    0x0D, 0x78, 0xDB, 0x6D, 0x76, 0xB2, 0xF8, 0xBB, 0xEF, 0xE8, 0xDE, 0x23, 0x59, 0xE1, 0x5C, 0x35,
-    0xFB, 0xCC, 0x69, 0xCC, 0x42, 0x2C, 0x1A, 0xCC, 0x55, 0x5A, 0x11, 0xB6, 0xCB, 0xED, 0x59, 0xC3,
-    0xBE, 0xE3, 0x8D, 0x2B, 0xB1, 0x83, 0x53, 0x28, 0x8E, 0x91, 0x30, 0x47, 0x9E, 0x95, 0x9F, 0xF0,
-    0x43, 0x6D, 0x3F, 0x3F, 0xD4, 0x41, 0xE3, 0xB7, 0x5E, 0x8B, 0x50, 0xB9, 0xBF, 0x7D, 0xAE, 0x7C,
-    0xF5, 0x6D, 0x9B, 0xD4, 0xFE, 0x2A, 0xD6, 0xEC, 0xD5, 0x30, 0xB5, 0x09, 0x25, 0xAC, 0xF2, 0x0A,
-    0x27, 0x1A, 0x94, 0xC8, 0x39, 0x8E, 0x74, 0x38, 0xE9, 0x0C, 0x39, 0x88, 0x69, 0x8C, 0xB3, 0x0C,
-    0x87, 0x91, 0xF1, 0x7B, 0xC5, 0x18, 0x4F, 0x19, 0x47, 0xCD, 0x90, 0xA5, 0x88, 0xC2, 0xCE, 0x4C,
-    0x86, 0xFA, 0xBE, 0xC0, 0xB1, 0x90, 0x55, 0xB7, 0x4E, 0xB3, 0x5C, 0xE3, 0xAC, 0x55, 0xDA, 0x60,
-    0xB9, 0xD8, 0x1F, 0xCF, 0x70, 0xE6, 0xBF, 0xA0, 0xBC, 0x83, 0x43, 0xB2, 0xE9, 0x0F, 0x7C, 0x14,
-    0x65, 0xB6, 0x69, 0x95, 0x38, 0x37, 0x29, 0xF7, 0x1D, 0xE0, 0x5C, 0x31, 0xDD, 0xC6, 0x72, 0xBF,
-    0x81, 0xFE, 0xD6, 0xBC, 0xF1, 0x38, 0x3B, 0x16, 0xA8, 0x8A, 0x5D, 0xFD, 0xB3, 0x79, 0xE3, 0xDF,
-    0xB0, 0x1B, 0xEF, 0xD2, 0x05, 0x3C, 0x46, 0x31, 0x4F, 0xDF, 0x92, 0xE8, 0xEE, 0x03, 0x84, 0xD5,
-    0x47, 0x28, 0x38, 0x3C, 0x63, 0xA3, 0x37, 0x4B, 0x3C, 0x06, 0x9B, 0x35, 0x00, 0x3F, 0x56, 0xBA,
-    0x58, 0x9C, 0xE0, 0x31, 0x9C, 0x28, 0xFA, 0xD7, 0x43, 0x94, 0xB5, 0xD7, 0x74, 0x2D, 0x8E, 0xA7,
-    0x47, 0x56, 0x68, 0x76, 0xC9, 0xCD, 0x78, 0x3A, 0x47, 0x92, 0x99, 0x82, 0x8C, 0xDC, 0x78, 0xAA,
-    0x6D, 0xD8, 0x03, 0x7D, 0x6C, 0x03, 0x53, 0x33, 0x03, 0xA6, 0xEF, 0xB3, 0x07, 0xCF, 0x36, 0xA8,
-    0x67, 0xCE, 0x71, 0x1B, 0x71, 0xEC, 0x0B, 0x63, 0xCF, 0x39, 0xE6, 0x1A, 0x0A, 0x12, 0x85, 0x13,
-    0x86, 0xDF, 0x46, 0x3A, 0x2D, 0xEC, 0xB1, 0xB1, 0x34, 0x89, 0xDF, 0x60, 0xB1, 0x3F, 0xED, 0x79,
-    0x28, 0x2F, 0x78, 0xDC, 0x8A, 0x8A, 0xF4, 0x62, 0xE7, 0xF3, 0x9B, 0x50, 0xEF, 0x35, 0x70, 0xAD,
-    0x5D, 0x69, 0x3D, 0x1D, 0x16, 0xD3, 0x2C, 0x13, 0xE3, 0x61, 0xA6, 0x71, 0xAE, 0xF9, 0xE1, 0x33,
-    0x74, 0x3A, 0xA1, 0xDD, 0x22, 0x19, 0xF4, 0xAB, 0xAC, 0x72, 0xD8, 0xE9, 0xF1, 0x52, 0x5B, 0xC7,
-    0xB5, 0x7A, 0xBE, 0x95, 0x7D, 0x0F, 0xA3, 0x2D, 0x64, 0xB9, 0x6D, 0xA7, 0xDA, 0x6E, 0xBE, 0xB3,
-    0x3F, 0xC0, 0x7C, 0xDB, 0xE9, 0x2E, 0xA7, 0xC9, 0x12, 0x4C, 0xBA, 0x4F, 0x1F, 0xC9, 0x22, 0xED,
-    0x24, 0xCF, 0xE6, 0xF8, 0x34, 0x2C, 0x5B, 0x1F, 0xDA, 0xE3, 0x96, 0xFD, 0xDA, 0x21, 0x43, 0xDD,
-    0x31, 0x55, 0xE7, 0x67, 0x4E, 0x91, 0x6F, 0x07, 0x18, 0x87, 0x14, 0xCF, 0x7E, 0xEB, 0x13, 0x7F,
-    0x86, 0x35, 0x9F, 0x04, 0xA8, 0x63, 0x9B, 0xEF, 0x8D, 0x6C, 0xA7, 0xCF, 0x3E, 0x54, 0x3C, 0x6E,
-    0xBB, 0xBE, 0xB8, 0x8D, 0xDB, 0x82, 0xAD, 0xDF, 0xBB, 0x3C, 0x0C, 0x06, 0xC6, 0x6D, 0xFD, 0xF9,
-    0xE2, 0x77, 0xF6, 0xA1, 0x1C, 0x02, 0xF3, 0xF0, 0x04, 0xDD, 0x78, 0x19, 0xBE, 0xA7, 0x6B, 0x73,
-    0xEC, 0x32, 0x3E, 0x7C, 0x2A, 0x81, 0xEC, 0xE1, 0xB2, 0x3F, 0xB0, 0xEE, 0x4F, 0xCC, 0x17, 0xF4,
-    0xF6, 0x42, 0x91, 0x6C, 0xF5, 0x7D, 0x9C, 0x7C, 0x5A, 0xF2, 0x21, 0xE9, 0x34, 0x91, 0x5E, 0x3F,
-    0x0B, 0xAB, 0xE9, 0xD9, 0x7A, 0x1B, 0x82, 0xD2, 0x6E, 0x4D, 0x13, 0xD7, 0x3B, 0xD9, 0x62, 0x4C,
-    0x55, 0xB1, 0xB5, 0xB5, 0xE0, 0x60, 0x7C, 0x63, 0xB1, 0xE7, 0x2D, 0xAC, 0x68, 0x20, 0x53, 0x4A,
-    0x0B, 0x0E, 0x8C, 0xF9, 0xE0, 0xFE, 0xF0, 0x85, 0xCF, 0x2B, 0x9E, 0xF3, 0xEB, 0xE3, 0x95, 0xD2,
-    0xE7, 0xAF, 0x7A, 0xAE, 0xAF, 0x88, 0x79, 0xAF, 0x5A, 0x54, 0x95, 0x3A, 0xA8, 0xBC, 0x62, 0x5B,
-    0xAA, 0xE1, 0xEB, 0xA3, 0x93, 0x78, 0x85, 0x5F, 0x86, 0xFC, 0x6E, 0xDF, 0xE6, 0xFD, 0xF6, 0x94,
-    0x6E, 0x16, 0x54, 0xEF, 0xBC, 0x77, 0xEB, 0xF5, 0x0B, 0x17, 0x42, 0xBD, 0xFD, 0x9C, 0xD0, 0x30,
-    0xFB, 0x20, 0x7B, 0x91, 0x95, 0xF9, 0x1F, 0xED, 0x94, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x86, 0x7F,
-    0x9F, 0x49, 0x2C, 0xB8, 0xC2, 0x69, 0xAE, 0x80, 0x82, 0xA3, 0x0C, 0x05, 0xDA, 0x27, 0x80, 0x75,
-    0x78, 0x01, 0x28, 0xEE, 0x84, 0x44, 0x5E, 0x20, 0xA4, 0xC9, 0x13, 0x70, 0x6B, 0xF1, 0x04, 0xA9,
-    0x92, 0x22, 0x05, 0x0D, 0xD5, 0xE5, 0x09, 0x28, 0x38, 0xDF, 0x55, 0xB4, 0x86, 0x48, 0xD0, 0x5A,
-    0x42, 0x4A, 0x24, 0x52, 0xE0, 0xC2, 0x12, 0x26, 0x59, 0xEF, 0xF0, 0xAF, 0x1D, 0x25, 0x24, 0x44,
-    0x48, 0x94, 0x48, 0xEC, 0xCE, 0xFA, 0xBC, 0xEB, 0xD9, 0xD9, 0xD9, 0x99, 0x6F, 0x0E, 0x03, 0x84,
-    0x52, 0xC4, 0x52, 0x2B, 0xB1, 0xFA, 0xC0, 0xE9, 0x85, 0x33, 0x73, 0xE9, 0x44, 0x53, 0x16, 0xC2,
-    0xC5, 0xA1, 0x58, 0x2A, 0x50, 0x0D, 0x03, 0x3C, 0x40, 0x06, 0x03, 0xE0, 0x3E, 0x9F, 0xBF, 0xF7,
-    0x01, 0xDA, 0x16, 0x57, 0x80, 0xE2, 0x30, 0x1C, 0x52, 0xA1, 0xF7, 0xBD, 0x42, 0x74, 0x54, 0x21,
-    0x7E, 0x5F, 0x41, 0x45, 0x15, 0xCC, 0xFA, 0x0F, 0x64, 0x22, 0x89, 0x1F, 0x9B, 0xFB, 0x27, 0x00,
-    0xD7, 0xDA, 0xD1, 0x35, 0x2D, 0x85, 0x97, 0xE9, 0xB6, 0x06, 0x1E, 0xD1, 0x88, 0x24, 0x46, 0x8A,
-    0xDB, 0x5B, 0xB4, 0x51, 0x23, 0xAC, 0x93, 0xA8, 0x7E, 0xBB, 0x55, 0x66, 0x52, 0x70, 0x3D, 0x78,
-    0x0A, 0x04, 0x23, 0x64, 0x36, 0xA4, 0x87, 0x6E, 0x34, 0x2C, 0xA0, 0xE7, 0xD0, 0xAF, 0x4B, 0x2D,
-    0xD6, 0x1C, 0x3A, 0x9D, 0x88, 0x97, 0x54, 0xD4, 0xA1, 0x8B, 0xC5, 0xF6, 0xA4, 0xEC, 0xFC, 0xD3,
-    0x22, 0x9D, 0x00, 0x0D, 0x7A, 0x16, 0x61, 0x85, 0x7E, 0x89, 0xB8, 0x80, 0xE2, 0xE6, 0x94, 0xF7,
-    0x83, 0xA0, 0xD7, 0x20, 0xB4, 0xAD, 0x37, 0x63, 0x44, 0x52, 0x32, 0x02, 0xEA, 0x63, 0xA3, 0xD2,
-    0x46, 0x2D, 0x18, 0x8A, 0xAA, 0x8B, 0x98, 0xFE, 0xDC, 0x1D, 0x91, 0xE9, 0x0F, 0x8E, 0xD1, 0xEB,
-    0xD3, 0xFE, 0xB8, 0xD3, 0xCF, 0x87, 0xFC, 0x7A, 0x64, 0x75, 0xEA, 0x0C, 0xBF, 0xA6, 0xA2, 0x3F,
-    0x89, 0x12, 0x89, 0xAC, 0xF3, 0x27, 0x86, 0xF6, 0xE6, 0x56, 0x1D, 0x4B, 0x19, 0x4B, 0xBA, 0x34,
-    0x42, 0x50, 0x22, 0xA8, 0xCE, 0x44, 0xA4, 0xA4, 0x9C, 0x4F, 0x83, 0x36, 0x22, 0xDD, 0xE2, 0xF9,
-    0xCB, 0x60, 0x9C, 0xFC, 0xBA, 0xC8, 0xB8, 0x15, 0xF1, 0x5C, 0x25, 0x1A, 0x13, 0xBC, 0x63, 0xB7,
-    0x67, 0xBD, 0xE1, 0xFB, 0x04, 0x1A, 0x2A, 0x89, 0xE7, 0xFD, 0xDC, 0xC7, 0xC9, 0xCF, 0x86, 0xA9,
-    0x9F, 0x45, 0x45, 0x58, 0x5E, 0xF4, 0xA8, 0xE8, 0xE7, 0xF1, 0xDC, 0xDB, 0x98, 0x60, 0x84, 0xD5,
-    0x3B, 0xDB, 0x2F, 0xA5, 0x36, 0xA7, 0xD6, 0xA4, 0x8D, 0x81, 0x33, 0x98, 0x5D, 0x91, 0x01, 0x95,
-    0xFE, 0x12, 0x19, 0xDF, 0x32, 0x6E, 0xC1, 0x50, 0x98, 0x76, 0x98, 0x0C, 0xAB, 0x24, 0xC8, 0xF8,
-    0xC5, 0x6B, 0xA4, 0x0D, 0x79, 0xDF, 0x23, 0x50, 0xA9, 0x6F, 0xF6, 0x16, 0xB3, 0x40, 0x61, 0xE6,
-    0xE3, 0x12, 0x3A, 0x87, 0x24, 0x61, 0xE3, 0xF1, 0xD2, 0xD2, 0x74, 0xF2, 0x8B, 0x7E, 0x3D, 0xDC,
-    0xB3, 0x37, 0x02, 0xEB, 0x53, 0xBA, 0x5E, 0xF5, 0x64, 0xDE, 0x23, 0x7A, 0xCB, 0x54, 0x70, 0x2B,
-    0x70, 0x7A, 0x9F, 0xCA, 0x56, 0xD1, 0x9F, 0xF1, 0x7F, 0x44, 0xFF, 0x6D, 0x44, 0x83, 0x2C, 0xEF,
-    0x13, 0xAD, 0x1D, 0xEB, 0x3D, 0x7D, 0xDE, 0xC4, 0xC4, 0x20, 0x6F, 0x74, 0xD2, 0xE8, 0x35, 0xCF,
-    0x43, 0xEC, 0x1E, 0xD2, 0x54, 0xCF, 0x25, 0x43, 0xE6, 0x67, 0xB7, 0x9A, 0x05, 0xB5, 0x9B, 0x5A,
-    0x11, 0xEB, 0xA6, 0x6F, 0x78, 0x35, 0x93, 0xAC, 0x90, 0xAB, 0x2E, 0x0C, 0xAD, 0x4E, 0xA9, 0x77,
-    0xEB, 0x2C, 0xB0, 0x0D, 0x9A, 0x4E, 0x66, 0x68, 0xCC, 0x63, 0x72, 0x42, 0x9D, 0x9C, 0x67, 0x6D,
-    0x62, 0x0A, 0xBD, 0x20, 0x71, 0x07, 0x35, 0xA2, 0xD3, 0x12, 0xA4, 0x8A, 0x37, 0x4B, 0xDB, 0x5F,
-    0x0F, 0x77, 0xFC, 0x85, 0xB8, 0x2C, 0x2C, 0x61, 0xEE, 0xC8, 0x5D, 0x16, 0xDA, 0xAC, 0xEE, 0x3E,
-    0xA3, 0x6F, 0x3C, 0x2D, 0x3B, 0x4B, 0x23, 0x66, 0x4C, 0xCB, 0x79, 0x39, 0x74, 0xEC, 0x9F, 0x89,
-    0xCA, 0x0D, 0x41, 0x38, 0x6A, 0x4C, 0x72, 0x7D, 0xB9, 0xA1, 0x55, 0xBB, 0x32, 0xA6, 0x30, 0x64,
-    0xC2, 0x90, 0x08, 0x43, 0x1E, 0x58, 0x4F, 0x04, 0xD0, 0x8F, 0x14, 0xE6, 0x49, 0x0E, 0xE3, 0xF1,
-    0xF5, 0xDF, 0xC9, 0x88, 0x6F, 0xE6, 0x72, 0xC3, 0x86, 0xCA, 0xB3, 0x74, 0x22, 0xA7, 0x52, 0x9A,
-    0x63, 0xD9, 0xAB, 0xCC, 0x9A, 0x0B, 0x6B, 0x83, 0xA6, 0xC7, 0x87, 0xFD, 0xC3, 0xA3, 0xB5, 0xB5,
-    0xA1, 0x8A, 0xC9, 0x85, 0xBF, 0xB3, 0x6B, 0xFD, 0x7D, 0xA1, 0xF2, 0x89, 0x54, 0xE6, 0xD8, 0x5E,
-    0xBE, 0x93, 0x33, 0xAF, 0xAC, 0xE1, 0x5F, 0x4B, 0x56, 0x98, 0xA5, 0x4B, 0x31, 0x58, 0x96, 0xD4,
-    0xE7, 0x6A, 0x67, 0xAE, 0x13, 0xA8, 0x9A, 0xA5, 0x4C, 0xBE, 0x0B, 0xE2, 0x7E, 0x2F, 0x2A, 0xDB,
-    0x32, 0x4B, 0x59, 0x3E, 0x6C, 0x61, 0x8E, 0x28, 0xC7, 0xF0, 0x84, 0x95, 0x96, 0x6E, 0x7D, 0x4D,
-    0xE2, 0x1C, 0x97, 0xA4, 0xF0, 0x1B, 0x43, 0xEE, 0x1D, 0xE1, 0x27, 0x9D, 0x58, 0x3D, 0x8C, 0xDC,
-    0xC6, 0x15, 0x1E, 0x2E, 0x23, 0x2D, 0x20, 0x02, 0xA1, 0x0B, 0x19, 0x81, 0x60, 0xC0, 0x6C, 0xED,
-    0x04, 0x08, 0xEB, 0x00, 0xBA, 0x1B, 0xC2, 0x8D, 0x0A, 0x37, 0x57, 0x68, 0xA3, 0xC2, 0x85, 0x9A,
-    0xA4, 0xB0, 0x04, 0xE4, 0x52, 0x07, 0x92, 0xB8, 0x81, 0x8A, 0x14, 0x69, 0x04, 0x03, 0xE9, 0xAF,
-    0x50, 0x80, 0x60, 0x55, 0x5C, 0x8A, 0x14, 0x29, 0x14, 0x91, 0x27, 0x15, 0x2A, 0x4D, 0x27, 0x50,
-    0x5C, 0x8A, 0x0A, 0xCE, 0x70, 0x70, 0x2A, 0x6E, 0x9C, 0xD0, 0x16, 0x6F, 0xC5, 0xE5, 0xCB, 0xF7,
-    0xBD, 0x21, 0xEF, 0xF6, 0x24, 0x25, 0x0E, 0xBC, 0x00, 0xBF, 0x8F, 0x9C, 0xFF, 0x79, 0xEF, 0xCD,
-    0x7B, 0x6F, 0xD6, 0x18, 0xFE, 0x52, 0x99, 0x9B, 0x40, 0xA4, 0x32, 0x53, 0x91, 0xD2, 0xC4, 0x82,
-    0xCF, 0xB4, 0x0B, 0x32, 0x63, 0x1D, 0x2A, 0x6D, 0x4D, 0xA8, 0x7E, 0xB8, 0xD8, 0xC9, 0xAB, 0x5C,
-    0x1A, 0x05, 0xAB, 0x50, 0xE7, 0x25, 0x9A, 0x00, 0x92, 0xBE, 0x78, 0xB2, 0x85, 0x6E, 0xE2, 0x42,
-    0x82, 0x29, 0x08, 0x01, 0xCA, 0x8C, 0x41, 0xED, 0x08, 0x28, 0x03, 0x34, 0xEB, 0x70, 0x06, 0x93,
-    0x98, 0xF8, 0x12, 0xAA, 0x93, 0xA8, 0x44, 0x0F, 0x4E, 0x2C, 0xA8, 0xC0, 0x28, 0x8D, 0x0E, 0x15,
-    0x4B, 0x97, 0xD6, 0xE9, 0xEA, 0xFE, 0xA6, 0xB1, 0x4D, 0xBB, 0x61, 0x72, 0xD7, 0x5C, 0x34, 0x45,
-    0xE5, 0x6E, 0x18, 0xF9, 0xCC, 0xDD, 0x37, 0xF2, 0xD0, 0xB5, 0x46, 0x1E, 0xD5, 0xE8, 0xF0, 0xA8,
-    0xC2, 0xB4, 0x7F, 0xDB, 0x03, 0x7C, 0xF9, 0xD0, 0x99, 0xFC, 0xE5, 0xA3, 0xDA, 0x58, 0xB9, 0x5D,
-    0x99, 0x44, 0x6E, 0xEF, 0xDD, 0xE1, 0xD2, 0x2A, 0x8E, 0x57, 0x71, 0x69, 0x15, 0x6A, 0x24, 0x33,
-    0x1B, 0x09, 0xE6, 0xBE, 0x98, 0x60, 0x65, 0x37, 0x7E, 0x6C, 0x86, 0xDF, 0x59, 0x39, 0x32, 0xAC,
-    0x2D, 0x21, 0x0D, 0x29, 0xD9, 0x23, 0x8B, 0x65, 0xFE, 0x8E, 0x49, 0x56, 0x94, 0x41, 0x4B, 0xA0,
-    0x48, 0x72, 0x8A, 0xA4, 0xA8, 0xDE, 0x3F, 0x37, 0x2F, 0xAA, 0xDC, 0x96, 0x52, 0xE6, 0x05, 0x41,
-    0x4A, 0xA9, 0xF2, 0xA3, 0x0C, 0x65, 0xB5, 0x29, 0x28, 0x9C, 0xDC, 0x8D, 0x12, 0xB2, 0x9D, 0x17,
-    0xD3, 0x5E, 0xC6, 0xB5, 0xCC, 0x39, 0xF2, 0xDC, 0x28, 0x24, 0xD2, 0x63, 0xB0, 0xB7, 0x8D, 0x09,
-    0xC7, 0x29, 0xAB, 0x75, 0x98, 0xCD, 0xB2, 0x50, 0x0C, 0x6B, 0xDF, 0x04, 0xE3, 0x50, 0xEB, 0x70,
-    0xAA, 0x49, 0x4E, 0x85, 0x2A, 0x5C, 0x97, 0xC5, 0xFC, 0x8D, 0xA3, 0xAC, 0xED, 0x3C, 0xE5, 0x82,
-    0x20, 0x21, 0xC3, 0xA5, 0x99, 0x89, 0x94, 0x17, 0x00, 0x90, 0xD2, 0x84, 0xED, 0x14, 0xAE, 0xC8,
-    0xEF, 0xB6, 0xBC, 0x7A, 0x15, 0xF4, 0x53, 0x2B, 0xAE, 0xCB, 0xC1, 0xCE, 0x5A, 0xC5, 0xC9, 0xF0,
-    0x11, 0x45, 0x97, 0x52, 0x74, 0x05, 0x77, 0xF4, 0x0A, 0x98, 0xB5, 0x5F, 0x5C, 0x7A, 0x4E, 0xE7,
-    0x9E, 0xAD, 0xE2, 0x85, 0xAC, 0xF8, 0x18, 0x7D, 0x7F, 0x23, 0xAD, 0x08, 0xC4, 0xFA, 0x14, 0xBD,
-    0xA4, 0xD3, 0xB1, 0x44, 0x56, 0xE0, 0x5D, 0xE9, 0xB7, 0xC5, 0x14, 0x6D, 0x28, 0x2E, 0x02, 0xBB,
-    0x80, 0x52, 0x83, 0xF8, 0x03, 0x0A, 0x13, 0x6C, 0x3C, 0x57, 0x23, 0x0F, 0xE5, 0xD5, 0x64, 0xE0,
-    0x70, 0xE0, 0x68, 0xE0, 0x78, 0xE0, 0x74, 0x60, 0x3B, 0x70, 0x31, 0x70, 0xAF, 0x6C, 0x82, 0xCE,
-    0x2F, 0x32, 0x6C, 0x3C, 0x4F, 0x9D, 0xE7, 0x73, 0x77, 0x94, 0xB0, 0xEB, 0x74, 0x8E, 0xF5, 0xD8,
-    0x72, 0x80, 0x39, 0xA1, 0x04, 0x1C, 0x12, 0x9E, 0x57, 0x80, 0x17, 0xCE, 0x96, 0xDB, 0x2F, 0x97,
-    0xC5, 0x3E, 0x37, 0xD3, 0x2A, 0x44, 0x5F, 0x75, 0xA8, 0x70, 0x2B, 0x54, 0x2C, 0xA5, 0xF8, 0xE7,
-    0x5A, 0x85, 0x4B, 0xB7, 0x51, 0x91, 0xEC, 0x02, 0xE2, 0x43, 0x82, 0x00, 0x22, 0x42, 0x78, 0x0C,
-    0x13, 0xDA, 0xE0, 0x5D, 0xE3, 0xD5, 0x9E, 0x79, 0xAA, 0x3D, 0x71, 0x95, 0xF9, 0x17, 0x05, 0x17,
-    0x9D, 0x57, 0xF1, 0x4A, 0x29, 0x5A, 0x4D, 0x76, 0x40, 0xD3, 0x3E, 0x74, 0xA4, 0x55, 0xE4, 0xB4,
-    0x30, 0x26, 0x25, 0x5D, 0x2A, 0x2E, 0x3F, 0x90, 0x23, 0x74, 0x45, 0xF7, 0x7F, 0x7B, 0xFA, 0x6B,
-    0xB1, 0xDC, 0xC9, 0x61, 0xAF, 0x29, 0x9A, 0x1C, 0x6C, 0x29, 0x41, 0x83, 0x6F, 0xA4, 0x64, 0xA0,
-    0xD5, 0xCF, 0x48, 0x31, 0xFD, 0x06, 0xA4, 0xE2, 0x69, 0x22, 0x5E, 0x68, 0x67, 0xB0, 0xB2, 0x1D,
-    0xE3, 0x2D, 0x63, 0xA0, 0xD2, 0x93, 0x9E, 0xAF, 0x27, 0x74, 0x18, 0xA6, 0x28, 0x71, 0xE4, 0x3E,
-    0xCE, 0x8A, 0x32, 0x6D, 0x62, 0x08, 0xA3, 0x4C, 0x1A, 0x2B, 0x1D, 0xBE, 0x5C, 0xC1, 0x2F, 0xEB,
-    0x64, 0xEF, 0x4F, 0xC5, 0x67, 0x52, 0x63, 0xBF, 0xEC, 0x8E, 0x01, 0x38, 0x18, 0x26, 0x28, 0x60,
-    0x25, 0x39, 0x14, 0x06, 0x23, 0x49, 0xA4, 0x2E, 0x1E, 0x09, 0xCC, 0xB1, 0x2D, 0x1E, 0xA2, 0x5D,
-    0xDE, 0xF1, 0xB4, 0x9A, 0x78, 0xA5, 0x14, 0x82, 0xF2, 0x3A, 0x23, 0x59, 0x77, 0xF4, 0x0E, 0x87,
-    0x86, 0xA5, 0x81, 0xE2, 0x0E, 0x86, 0x5C, 0x94, 0x51, 0x4F, 0xAF, 0x84, 0x5F, 0xB0, 0x65, 0xEC,
-    0x3C, 0x6E, 0x4C, 0x0F, 0x7D, 0xC6, 0xAD, 0x52, 0xD2, 0x05, 0x03, 0x41, 0xDD, 0x65, 0xDA, 0x4D,
-    0x3A, 0x93, 0x56, 0xE9, 0x5F, 0xC2, 0xCE, 0x24, 0x95, 0xBD, 0x09, 0x8A, 0x6B, 0x7B, 0x2B, 0x6C,
-    0x41, 0x9B, 0x96, 0xE4, 0x6E, 0xD9, 0x69, 0x03, 0x7A, 0x60, 0x3F, 0x6C, 0x06, 0x13, 0xCE, 0x06,
-    0xFA, 0xC1, 0xD1, 0x6A, 0xFB, 0xE9, 0xD7, 0x30, 0xA7, 0x2E, 0xF9, 0xB4, 0x36, 0xE1, 0x51, 0x17,
-    0x7F, 0x5A, 0x99, 0xC9, 0xB2, 0x8D, 0x9F, 0x82, 0xFA, 0x06, 0x3A, 0x87, 0x87, 0x6E, 0x22, 0x0A,
-    0x88, 0x86, 0x3E, 0x27, 0x4D, 0x95, 0xEA, 0x90, 0xBA, 0x2E, 0x6A, 0x3D, 0x6D, 0xB4, 0x67, 0xF5,
-    0x60, 0x77, 0x4C, 0x52, 0x83, 0xA8, 0x2B, 0x4B, 0xC7, 0xE2, 0xA9, 0x06, 0xD1, 0x2D, 0x29, 0x25,
-    0x0D, 0x69, 0x11, 0xB7, 0xA0, 0x3D, 0x89, 0x3A, 0xA5, 0xE9, 0x77, 0xA7, 0x5A, 0xC9, 0x92, 0x68,
-    0x5E, 0x4A, 0x30, 0xF9, 0x3D, 0x59, 0xEC, 0xC2, 0xFC, 0xF7, 0xB8, 0x4D, 0xA3, 0xD4, 0x7A, 0x52,
-    0xA9, 0xBE, 0x9D, 0x99, 0xD1, 0xA1, 0x2A, 0x06, 0x0B, 0x59, 0xD2, 0x42, 0x68, 0x11, 0x1E, 0x83,
-    0x45, 0xB1, 0x1C, 0x6B, 0xCF, 0x6C, 0x11, 0xA5, 0x03, 0x22, 0x54, 0x01, 0xE9, 0x4D, 0x6B, 0xF8,
-    0xAD, 0x7B, 0x40, 0xDB, 0x05, 0xC4, 0x96, 0x87, 0x3E, 0x77, 0x6C, 0x0F, 0xB4, 0xAF, 0x60, 0xC3,
-    0x72, 0xDF, 0xC6, 0xAE, 0x02, 0xED, 0x7B, 0x28, 0xE3, 0x38, 0xA1, 0xF4, 0x8C, 0x76, 0x45, 0x93,
-    0x72, 0x2E, 0xF3, 0xCA, 0xCF, 0x3B, 0x6D, 0x8F, 0xC1, 0x6C, 0x36, 0x63, 0xD9, 0x36, 0x9C, 0xF7,
-    0xD4, 0x2F, 0xC1, 0x07, 0x17, 0x44, 0x8E, 0xFD, 0x29, 0x5C, 0xF6, 0x7C, 0xDD, 0xFD, 0x5D, 0xED,
-    0x67, 0x5B, 0x46, 0x67, 0x50, 0xB8, 0xBA, 0xC2, 0x67, 0xCC, 0xB3, 0xB8, 0xDB, 0x2F, 0x32, 0x73,
-    0x12, 0x0B, 0xB4, 0xF1, 0xB4, 0xD7, 0xB9, 0xD4, 0xED, 0xD6, 0x81, 0xD6, 0x94, 0x1A, 0x93, 0xB8,
-    0x48, 0x5A, 0x01, 0xAB, 0x60, 0x8C, 0x68, 0x9C, 0xB4, 0x00, 0xEB, 0x00, 0x79, 0x0D, 0x80, 0x0F,
-    0x58, 0xC1, 0x5F, 0x47, 0xAB, 0xB0, 0x47, 0x2D, 0x26, 0x88, 0x56, 0x49, 0x03, 0xC0, 0x01, 0x8A,
-    0x60, 0xDE, 0x88, 0x3F, 0xF2, 0x44, 0xED, 0xAD, 0x3E, 0x81, 0x88, 0x52, 0x8C, 0x56, 0xA9, 0x1B,
-    0x7B, 0x60, 0x1C, 0x0C, 0x20, 0x86, 0x43, 0xCD, 0x87, 0x41, 0x21, 0xAD, 0x71, 0xA2, 0xB4, 0xCB,
-    0xC5, 0x3B, 0x83, 0x75, 0x78, 0xFB, 0x8A, 0x60, 0x4B, 0x83, 0xD3, 0x7F, 0x97, 0x50, 0x10, 0x3A,
-    0x42, 0x3D, 0xEC, 0x26, 0x62, 0xAD, 0x45, 0xAD, 0xAA, 0x35, 0x7C, 0xC1, 0xDA, 0xDB, 0xBE, 0xD6,
-    0x0C, 0xB5, 0xB9, 0x57, 0x3A, 0xE0, 0x05, 0x3F, 0x6F, 0xBF, 0x29, 0x50, 0x31, 0x54, 0x89, 0x77,
-    0xB2, 0x96, 0x11, 0x60, 0x78, 0xF1, 0xD6, 0x94, 0x88, 0xF7, 0x1D, 0xE6, 0xFB, 0xD9, 0xE8, 0x64,
-    0x50, 0xEB, 0x5D, 0x35, 0xFC, 0x9E, 0x7F, 0x29, 0xCA, 0xC8, 0x77, 0x93, 0x52, 0x65, 0x8D, 0x97,
-    0x79, 0xA8, 0x2F, 0x81, 0xF8, 0x60, 0xCB, 0xA8, 0xE7, 0x4B, 0xF0, 0x89, 0x36, 0x1A, 0x9D, 0x55,
-    0x22, 0x8D, 0x41, 0x79, 0xDC, 0xC5, 0x38, 0x58, 0x53, 0xC8, 0xBF, 0xB3, 0x2F, 0x51, 0xDE, 0xC1,
-    0xA0, 0xF2, 0xB2, 0xC8, 0x30, 0x7E, 0xE1, 0x24, 0x83, 0x97, 0xE8, 0x26, 0x52, 0x09, 0xDD, 0x45,
-    0x9B, 0xCA, 0xAF, 0xC5, 0xE4, 0x19, 0x17, 0x86, 0x38, 0x29, 0xB4, 0x13, 0x84, 0xAA, 0xE7, 0x3D,
-    0xD7, 0xCC, 0x18, 0x8F, 0xBE, 0xB2, 0x8F, 0x41, 0xFD, 0xB2, 0xCD, 0xB4, 0x3B, 0xEF, 0x17, 0x1D,
-    0xB5, 0x63, 0x54, 0x1C, 0xB7, 0x11, 0xBB, 0x57, 0x5F, 0x92, 0x7A, 0x78, 0x49, 0xC7, 0x17, 0xBB,
-    0x16, 0x50, 0x53, 0x6E, 0x80, 0x16, 0x13, 0x52, 0x26, 0x53, 0x29, 0x54, 0xC5, 0x8E, 0xAB, 0x6F,
-    0x3C, 0x44, 0x5D, 0xCC, 0x32, 0xB8, 0xEA, 0xA9, 0xA4, 0x8C, 0xD9, 0x70, 0xCE, 0x81, 0xFA, 0x60,
-    0xB5, 0xB1, 0x42, 0x06, 0xE1, 0xFD, 0x32, 0x01, 0x34, 0x49, 0x8F, 0xA0, 0x67, 0x85, 0x0E, 0x13,
-    0x86, 0x21, 0x88, 0x83, 0xF0, 0xC7, 0x52, 0xA5, 0x4F, 0x5D, 0x5E, 0xDB, 0xA8, 0xB2, 0xEE, 0x41,
-    0x48, 0x57, 0x1D, 0x98, 0x94, 0x2B, 0x4E, 0x8E, 0xC1, 0x36, 0xF4, 0xFF, 0x8E, 0x50, 0x13, 0x30,
-    0x7C, 0x7C, 0x04, 0x7D, 0x2F, 0x33, 0x1A, 0x74, 0x43, 0xE8, 0xF5, 0xFC, 0x61, 0x51, 0x38, 0x37,
-    0xDB, 0xFD, 0x42, 0xF6, 0x35, 0xC8, 0xEF, 0xCA, 0x42, 0x5A, 0xCA, 0xB4, 0x52, 0xD0, 0x32, 0x85,
-    0x64, 0xF5, 0x53, 0xB9, 0x13, 0x77, 0x53, 0x26, 0x67, 0xBE, 0x6F, 0x47, 0xC0, 0x29, 0xEE, 0x7F,
-    0x6F, 0xFC, 0xC1, 0xFA, 0xAF, 0x00, 0x25, 0xAB, 0xC7, 0x99, 0xAA, 0xC8, 0xB6, 0x21, 0x7B, 0x2C,
-    0x45, 0xBC, 0xCF, 0xF4, 0x79, 0x4F, 0x4F, 0x81, 0x3D, 0xBB, 0x8F, 0xE2, 0xC7, 0xBA, 0x5E, 0xB6,
-    0x4C, 0x3A, 0x62, 0xAA, 0x68, 0x9B, 0x01, 0xBF, 0x98, 0xE1, 0x48, 0xE0, 0xF0, 0x67, 0xA7, 0xB0,
-    0x51, 0x6C, 0xA7, 0xCF, 0x24, 0x43, 0x7B, 0x60, 0xB2, 0x22, 0x62, 0x1C, 0xE0, 0x54, 0x3E, 0xFF,
-    0x87, 0x64, 0x13, 0xF5, 0xF8, 0xC6, 0x63, 0xAA, 0x88, 0xA2, 0x23, 0x6A, 0xBD, 0x3E, 0x59, 0xDB,
-    0x59, 0x35, 0x72, 0xB5, 0x8B, 0x40, 0x23, 0xA1, 0xB7, 0x68, 0x44, 0x31, 0x36, 0xE1, 0xE9, 0x31,
-    0xD1, 0x4B, 0x1A, 0x72, 0xFC, 0x0D, 0x35, 0x9D, 0x7C, 0xA5, 0xEA, 0x72, 0x3E, 0x10, 0x0E, 0xF9,
-    0x95, 0x54, 0xD7, 0xE4, 0xA0, 0x58, 0xC2, 0x89, 0xCC, 0xE1, 0xD8, 0x60, 0xDE, 0xA9, 0x3B, 0x55,
-    0xFB, 0x51, 0x3F, 0xBB, 0xDA, 0xD3, 0x6E, 0x61, 0xCC, 0x40, 0x18, 0x39, 0x54, 0x06, 0xA4, 0x1E,
-    0xB9, 0x23, 0x9E, 0x11, 0xF5, 0xB8, 0x8C, 0x94, 0x4C, 0xA2, 0x8C, 0x97, 0x5A, 0x45, 0xA1, 0x75,
-    0x5E, 0x72, 0x3E, 0xED, 0xFC, 0x7A, 0xA2, 0xB1, 0xDB, 0x07, 0xF0, 0x4A, 0xDF, 0xAE, 0x2D, 0xA0,
-    0xC9, 0x93, 0x14, 0x06, 0x3B, 0xED, 0x28, 0xE0, 0x0A, 0xB9, 0xA2, 0x2C, 0xEE, 0x9E, 0x54, 0xA8,
-    0x5E, 0x92, 0xF6, 0x58, 0x4D, 0x38, 0x5A, 0x65, 0x34, 0x26, 0xC3, 0x3E, 0x13, 0x47, 0x5F, 0xEE,
-    0x74, 0x76, 0xAC, 0x3F, 0x8A, 0x28, 0x28, 0x7A, 0x35, 0xA1, 0x96, 0x09, 0x4E, 0x1B, 0xF8, 0x3B,
-    0xC3, 0xF3, 0x2F, 0x11, 0x1D, 0x2F, 0xD5, 0x6F, 0xC5, 0x3D, 0x9A, 0xA8, 0xDA, 0xD2, 0x16, 0xA0,
-    0x4A, 0xF3, 0xE0, 0x4E, 0x83, 0x96, 0xB1, 0x89, 0x6A, 0x57, 0x7B, 0xA8, 0xCE, 0xA1, 0xAA, 0x67,
-    0x7F, 0xF4, 0xD7, 0x19, 0x85, 0x94, 0xE0, 0x5D, 0x8F, 0x6A, 0x49, 0x95, 0xE4, 0x75, 0xA4, 0xDE,
-    0x05, 0x09, 0x00, 0x76, 0x8E, 0x6C, 0x00, 0x7B, 0xE4, 0x85, 0x07, 0xF2, 0x83, 0xCB, 0xE5, 0x3E,
-    0x44, 0x43, 0xEF, 0x88, 0x3F, 0x82, 0x55, 0x1F, 0xEC, 0x40, 0xC6, 0x7A, 0x32, 0xBF, 0x2B, 0x2E,
-    0x1D, 0x93, 0x51, 0xDE, 0xB7, 0x60, 0xB8, 0xC4, 0xC8, 0x3B, 0x90, 0xCB, 0xC7, 0xC7, 0x5F, 0xA5,
-    0xC3, 0xF9, 0x5B, 0xB5, 0xED, 0x56, 0xD3, 0x40, 0xA7, 0x69, 0x43, 0x3D, 0xE8, 0xE9, 0x34, 0xAA,
-    0x57, 0x29, 0x7A, 0xEF, 0x4F, 0x39, 0x58, 0xAC, 0x32, 0x9F, 0xF8, 0xA4, 0x2C, 0x5F, 0x33, 0x41,
-    0x64, 0x50, 0xE7, 0x3E, 0xB8, 0x7B, 0x2D, 0xEE, 0xEC, 0x61, 0x2F, 0x8F, 0xBB, 0x5F, 0xAD, 0xF2,
-    0xDF, 0x3E, 0xEE, 0x7E, 0xD2, 0xA4, 0xE1, 0xE7, 0x6D, 0x0A, 0x3C, 0x44, 0x9A, 0x52, 0x4C, 0x11,
-    0xBB, 0x44, 0xDD, 0xF2, 0x52, 0x27, 0x6F, 0xD2, 0x2B, 0x15, 0x31, 0x04, 0xEE, 0x5C, 0x98, 0xCC,
-    0xF5, 0xBC, 0xBD, 0x16, 0x46, 0x10, 0x55, 0xB7, 0x4E, 0x3C, 0xD8, 0x9B, 0x22, 0x8D, 0xF9, 0x1F,
-    0xB7, 0xA1, 0xFF, 0x0B, 0x0A, 0xEF, 0x45, 0x3A, 0xE4, 0x19, 0x7F, 0xD0, 0x7B, 0x09, 0x8C, 0x6E,
-    0xF6, 0x51, 0x7F, 0x79, 0xF0, 0x2E, 0x9D, 0x06, 0x61, 0x1A, 0x62, 0x8E, 0xAB, 0xA5, 0x2A, 0x1F,
-    0xA7, 0x87, 0xD2, 0x73, 0xFE, 0x1A, 0xC3, 0xE4, 0x99, 0xC1, 0x2A, 0xD4, 0x3B, 0x73, 0xE9, 0x05,
-    0x87, 0xB4, 0x02, 0xF6, 0x43, 0x91, 0xA1, 0xCC, 0xC7, 0x8F, 0x63, 0xF8, 0xB0, 0xA2, 0x0C, 0x15,
-    0x78, 0xDB, 0xDB, 0x1F, 0xBC, 0xAB, 0xB0, 0xE2, 0x93, 0xD7, 0x2A, 0xCE, 0xED, 0x00, 0x12, 0xF7,
-    0x09, 0x61, 0xC2, 0xF3, 0x0A, 0xB0, 0x35, 0x20, 0xC7, 0x8D, 0x25, 0x93, 0x72, 0x22, 0x97, 0xBC,
-    0x03, 0x61, 0xB7, 0x8E, 0x50, 0x03, 0x86, 0x2B, 0xE4, 0xF8, 0x1B, 0xC2, 0x5A, 0xBA, 0xAB, 0x9A,
-    0xBD, 0x18, 0xE9, 0xB9, 0xFD, 0x73, 0xA8, 0x1A, 0xBE, 0xEF, 0xA9, 0xB8, 0xB7, 0x5C, 0x2C, 0xB6,
-    0x54, 0xC4, 0xA2, 0xC1, 0x88, 0xC7, 0x2C, 0x56, 0xAA, 0x03, 0x75, 0x0E, 0x08, 0x08, 0x68, 0x89,
-    0x7C, 0x35, 0x74, 0xDF, 0x83, 0xE6, 0x40, 0x37, 0xDF, 0x25, 0xFD, 0x4B, 0x8A, 0x39, 0x83, 0xC5,
-    0xA1, 0xBC, 0x20, 0x4D, 0xBF, 0xC1, 0x16, 0xC2, 0x2E, 0x28, 0x7F, 0x71, 0xEC, 0x61, 0x73, 0x1F,
-    0xAD, 0x6F, 0x14, 0xFB, 0xC1, 0x1D, 0x1F, 0x9D, 0x6B, 0x1F, 0x9B, 0x6B, 0x9F, 0x45, 0xF9, 0x64,
-    0x6F, 0xB8, 0xFC, 0xA9, 0xBE, 0x27, 0x7E, 0xC1, 0x13, 0xF9, 0x56, 0x9A, 0xEA, 0xC5, 0xE6, 0xAC,
-    0x0F, 0xF8, 0x56, 0xFD, 0x4A, 0x20, 0xA3, 0xD7, 0x66, 0x69, 0x2C, 0x1F, 0x20, 0xD2, 0x22, 0x27,
-    0x9F, 0xF0, 0xF6, 0x47, 0xF9, 0xE1, 0xA0, 0x5B, 0x12, 0xF2, 0x54, 0x08, 0x12, 0x1E, 0x6E, 0x20,
-    0x4A, 0x54, 0x09, 0x7E, 0x45, 0xC9, 0x7C, 0x0B, 0x61, 0x86, 0xBB, 0x27, 0x97, 0xEE, 0x3A, 0xF4,
-    0x1E, 0x67, 0x56, 0x74, 0xF4, 0x9B, 0xCC, 0x99, 0x62, 0x9F, 0x38, 0x8D, 0x6F, 0x69, 0x77, 0x9D,
-    0x21, 0x8C, 0xD2, 0x74, 0xE3, 0x95, 0xB7, 0xE7, 0x45, 0x7C, 0x6B, 0xCD, 0x26, 0xF5, 0xD2, 0x73,
-    0x02, 0x48, 0xA4, 0xB2, 0xD7, 0x6F, 0xE8, 0xEF, 0xBD, 0x4F, 0xDC, 0xD8, 0x24, 0xDE, 0x7A, 0x60,
-    0x86, 0x9C, 0x73, 0x48, 0x80, 0xC4, 0xAF, 0x68, 0x65, 0x05, 0x97, 0xD8, 0x9B, 0x9B, 0x85, 0x8B,
-    0xBB, 0x8D, 0x4D, 0xDB, 0xA6, 0xED, 0xC6, 0x26, 0x12, 0x94, 0x66, 0x63, 0x13, 0x07, 0xD5, 0x01,
-    0x57, 0xC4, 0xC8, 0x63, 0x6F, 0xDD, 0xF9, 0xF3, 0xC1, 0x65, 0xFD, 0x37, 0xC3, 0x07, 0x6C, 0xEF,
-    0x81, 0x07, 0x15, 0x4E, 0x87, 0x2C, 0x48, 0xED, 0x27, 0x3F, 0x1A, 0x24, 0xCE, 0xBF, 0x63, 0x5E,
-    0x45, 0x6D, 0x57, 0xBB, 0xE3, 0x67, 0xF8, 0xF7, 0x86, 0x0F, 0x23, 0xB6, 0x93, 0xBF, 0xE3, 0x29,
-    0x6D, 0xB3, 0xF6, 0x38, 0x79, 0x82, 0xFB, 0x1A, 0x2F, 0x6B, 0x63, 0xBB, 0x03, 0x6D, 0xD3, 0x52,
-    0x6B, 0x27, 0x4F, 0x8A, 0xA7, 0x68, 0x75, 0x0C, 0xD1, 0xF6, 0x19, 0x95, 0xBD, 0x3E, 0x97, 0xC9,
-    0x60, 0x3C, 0xC1, 0xCF, 0x69, 0x4B, 0x2D, 0x4F, 0x03, 0x9C, 0x5D, 0x93, 0xC8, 0x3D, 0x87, 0x9C,
-    0xE5, 0x2D, 0xEE, 0x8C, 0x47, 0xB6, 0xA8, 0x4F, 0x3F, 0x2C, 0x63, 0x46, 0x62, 0x57, 0xE6, 0xBD,
-    0x44, 0x0E, 0x5B, 0x3A, 0xC8, 0x09, 0x07, 0xDE, 0xA6, 0x40, 0xBD, 0xFB, 0x84, 0x1B, 0xBA, 0x8C,
-    0x83, 0xD1, 0x8D, 0xCF, 0x7F, 0x00, 0xD3, 0x5A, 0xB5, 0x6A, 0x95, 0x43, 0xFD, 0xFF, 0xFF, 0xFF,
-    0x1B, 0x10, 0x04, 0x03, 0x08, 0x00, 0x00, 0xC5, 0x54, 0x31, 0x4E, 0xC3, 0x40, 0x10, 0x5C, 0x27,
-    0x02, 0x8A, 0x14, 0x34, 0x80, 0x84, 0x52, 0xF0, 0x00, 0x0A, 0x3F, 0xC1, 0x16, 0x25, 0x55, 0x9A,
-    0x34, 0xD0, 0xD2, 0x51, 0xF0, 0x84, 0xB3, 0x68, 0x68, 0x23, 0x24, 0x6A, 0x1A, 0xAA, 0x54, 0x3C,
-    0x00, 0xC9, 0x7E, 0x82, 0x9F, 0x60, 0x81, 0x44, 0x01, 0x8D, 0x01, 0x17, 0x09, 0x0A, 0x19, 0x66,
-    0xD7, 0xE7, 0xC4, 0x42, 0x34, 0x14, 0x09, 0xD2, 0x79, 0x66, 0x2D, 0xEF, 0xDD, 0xCD, 0xDC, 0x9C,
-    0x2C, 0xC1, 0x30, 0x16, 0x8E, 0x03, 0x94, 0x3D, 0xCC, 0x24, 0x45, 0x19, 0x92, 0x80, 0xC2, 0xA1,
-    0x0A, 0xF0, 0x3C, 0x4A, 0xA7, 0xF7, 0x1D, 0x24, 0x92, 0xE6, 0xD2, 0x41, 0x2C, 0x69, 0x66, 0x84,
-    0x9C, 0xFD, 0xB8, 0xB2, 0x2E, 0xDC, 0x2E, 0xE9, 0x10, 0xE3, 0x13, 0xBC, 0x8C, 0x5A, 0x9D, 0x2B,
-    0x22, 0xA1, 0xEA, 0x1D, 0xA1, 0x88, 0x37, 0x08, 0x35, 0x7F, 0x50, 0x21, 0xF0, 0x84, 0x84, 0x8A,
-    0xAF, 0x21, 0x2A, 0xF8, 0xCC, 0x5A, 0xC5, 0x23, 0xD5, 0x5E, 0x22, 0x76, 0x2D, 0xA4, 0xD4, 0x23,
-    0xC4, 0x9D, 0x15, 0x0C, 0xD5, 0x36, 0xD4, 0x2D, 0xDF, 0x55, 0xAB, 0x21, 0xF0, 0x88, 0xD8, 0xB4,
-    0xB1, 0x21, 0xF9, 0xD1, 0xBF, 0x6E, 0x6D, 0x4C, 0x7B, 0x43, 0x7C, 0xDE, 0x3C, 0xCA, 0x3A, 0x71,
-    0x26, 0x5A, 0x67, 0x8E, 0xDC, 0xA7, 0x9E, 0x66, 0x3E, 0xF7, 0xFD, 0xC5, 0xA1, 0x37, 0xD9, 0x4B,
-    0x93, 0x3E, 0x32, 0x1F, 0x7C, 0xAB, 0xF0, 0x77, 0x00, 0x99, 0x9F, 0xF5, 0x4F, 0x85, 0x77, 0xBA,
-    0xB8, 0xD9, 0x94, 0xDD, 0x76, 0x1A, 0x61, 0xB2, 0x70, 0x8A, 0xDC, 0x9C, 0x16, 0xA2, 0x45, 0xAC,
-    0x96, 0x5B, 0x45, 0xE3, 0x34, 0x6F, 0x0C, 0x2E, 0x0B, 0x3A, 0x3D, 0x56, 0xA7, 0xBF, 0xCC, 0x5A,
-    0x67, 0x41, 0xA7, 0x4C, 0x84, 0xEE, 0x26, 0x22, 0x5B, 0x00, 0xAD, 0x6C, 0x13, 0x0B, 0x89, 0xE6,
-    0xA7, 0x8A, 0x95, 0xB8, 0x42, 0x5C, 0x69, 0xE8, 0x8B, 0x00, 0x98, 0xB9, 0xA2, 0xD7, 0xC2, 0xCD,
-    0xF4, 0xF3, 0xCE, 0x37, 0xFC, 0x7D, 0x44, 0xB6, 0x78, 0x34, 0x7F, 0x20, 0x86, 0xBA, 0x1A, 0x05,
-    0x28, 0x76, 0x55, 0x91, 0xC8, 0xAE, 0xC1, 0x40, 0x51, 0xF5, 0x8D, 0xA4, 0xBE, 0x3F, 0xF6, 0x8D,
-    0x67, 0x39, 0x37, 0xF1, 0xD3, 0x0B, 0x63, 0x24, 0x5B, 0x35, 0x8B, 0xF1, 0x1E, 0x62, 0x65, 0xCE,
-    0xD2, 0x1C, 0x32, 0x3E, 0x65, 0x4A, 0x8E, 0xF8, 0xAE, 0xEC, 0xAA, 0x7E, 0x76, 0x8E, 0x71, 0xEC,
-    0x72, 0xB1, 0x3E, 0x57, 0x89, 0xCD, 0x8B, 0x78, 0x34, 0xCA, 0x21, 0x37, 0x51, 0xA6, 0x47, 0xFB,
-    0x4E, 0xDF, 0xB9, 0xAD, 0xDB, 0x47, 0xE9, 0xF7, 0xF1, 0x1C, 0x55, 0xCA, 0x03, 0x09, 0xCB, 0x2E,
-    0x7F, 0x28, 0xEE, 0x26, 0x25, 0xBF, 0xEA, 0x9D, 0x2E, 0xBA, 0xB0, 0xBB, 0xAD, 0xFF, 0x97, 0x2C,
-    0xC4, 0x97, 0x2E, 0x9E, 0x98, 0xA5, 0x60, 0x20, 0xDF, 0x4D, 0x8F, 0xB1, 0x0D, 0xC3, 0x30, 0x0C,
-    0x04, 0x19, 0xA8, 0x48, 0xC9, 0x3E, 0x19, 0x42, 0x23, 0x50, 0x9B, 0x39, 0x23, 0x64, 0x23, 0x6B,
-    0x04, 0x8D, 0x90, 0x11, 0x52, 0xD8, 0x40, 0x0A, 0x3B, 0x9F, 0xD7, 0x0B, 0x36, 0xC2, 0xE6, 0x41,
-    0xF0, 0xC8, 0x7F, 0x9A, 0x9D, 0x95, 0xCA, 0x50, 0x6F, 0x43, 0x63, 0x19, 0x8A, 0x7D, 0x8C, 0x01,
-    0x01, 0x0E, 0x08, 0x88, 0xE7, 0x5D, 0xC0, 0xC7, 0xAC, 0x03, 0x89, 0x1A, 0x04, 0x7C, 0xBB, 0x3D,
-    0x82, 0x40, 0x7C, 0xD1, 0x32, 0x01, 0x00, 0xAF, 0xBC, 0xF7, 0x6D, 0xD4, 0x40, 0xE1, 0x36, 0x6C,
-    0x42, 0x0B, 0x60, 0xBB, 0x00, 0x0B, 0xF5, 0x7D, 0xA5, 0x7A, 0xC7, 0x78, 0x99, 0x5C, 0x9F, 0x15,
-    0xEE, 0xB5, 0xA9, 0x3B, 0xB3, 0xE1, 0x58, 0xB6, 0x32, 0x4E, 0x58, 0x67, 0x05, 0xE1, 0x39, 0x05,
-    0x8B, 0x9A, 0x95, 0xC3, 0x6B, 0x28, 0x57, 0x5A, 0xE7, 0xF2, 0x9F, 0xFB, 0xFC, 0xE3, 0xF8, 0xEB,
-    0xF8, 0x53, 0xF5, 0x03,
+static const uint8_t notosans_16_boldBitmaps[38024] = {
+    0xCD, 0x59, 0x31, 0x8F, 0xDD, 0xC6, 0x11, 0x5E, 0xBE, 0xE7, 0xD3, 0x03, 0xC2, 0x82, 0x2E, 0x7C,
+    0x09, 0x14, 0x03, 0x61, 0x1B, 0x24, 0x05, 0xDB, 0x74, 0xCB, 0xC8, 0x85, 0x81, 0xA4, 0xB0, 0x0A,
+    0x9D, 0x05, 0xC4, 0x85, 0x53, 0xC4, 0x45, 0xDC, 0xE8, 0x1F, 0x64, 0x09, 0xBB, 0x50, 0xE1, 0x46,
+    0x08, 0xE2, 0x4A, 0x85, 0x1B, 0x1B, 0x30, 0x4E, 0x85, 0x52, 0xA4, 0x0C, 0xB0, 0x54, 0x5C, 0xBA,
+    0x10, 0x11, 0xC3, 0x70, 0x69, 0x42, 0x16, 0x1C, 0x40, 0x29, 0x8E, 0x71, 0x28, 0x9B, 0x92, 0x49,
+    0x6E, 0xBE, 0x6F, 0x86, 0xE4, 0x7B, 0x77, 0x92, 0xA2, 0x93, 0x2D, 0x3B, 0x79, 0xC7, 0xFD, 0xC8,
+    0x23, 0x97, 0xBB, 0xB3, 0x33, 0xB3, 0xDF, 0xCE, 0x2C, 0x6D, 0x6B, 0xB7, 0x7F, 0x8D, 0x6D, 0xB2,
+    0xE9, 0x2F, 0xD5, 0xBF, 0x7A, 0x2F, 0x37, 0xF8, 0xA5, 0x35, 0x9E, 0x76, 0xB6, 0xCD, 0x9A, 0x28,
+    0x37, 0xB6, 0x34, 0x3E, 0x8F, 0x82, 0x59, 0x0F, 0x66, 0xD3, 0x9B, 0xA4, 0x35, 0x69, 0x63, 0xB2,
+    0xDA, 0xD8, 0x8A, 0x4F, 0x9C, 0x1C, 0x1E, 0x47, 0xB1, 0x73, 0xCC, 0xF7, 0x59, 0xA7, 0x36, 0x59,
+    0x63, 0x12, 0x1C, 0x1D, 0x5F, 0x5F, 0x8D, 0xC6, 0x04, 0x63, 0x5C, 0x61, 0xF6, 0x72, 0x2F, 0x6D,
+    0xA3, 0x29, 0xB4, 0x19, 0xF7, 0x66, 0x8D, 0x63, 0x34, 0xE8, 0x88, 0x15, 0x42, 0x6E, 0xC2, 0x4E,
+    0x43, 0xEE, 0x78, 0x4F, 0x78, 0x14, 0x28, 0xD2, 0x6A, 0x91, 0xAA, 0xA3, 0x54, 0xE8, 0x0E, 0x0D,
+    0xEF, 0x43, 0xFE, 0x96, 0x63, 0xB2, 0xB5, 0x2D, 0x5D, 0xE9, 0xF3, 0x60, 0x2E, 0x18, 0x1B, 0xEA,
+    0xE5, 0x30, 0x0F, 0x0C, 0x51, 0xEF, 0xA0, 0x4F, 0x13, 0x42, 0x63, 0xD6, 0x21, 0xF4, 0x26, 0x0E,
+    0x61, 0x34, 0xC9, 0xB8, 0x09, 0x26, 0xED, 0x56, 0x21, 0xCF, 0x5A, 0x13, 0x4A, 0xDB, 0xEC, 0x42,
+    0x05, 0xF0, 0x95, 0x5B, 0xC0, 0xEE, 0xC2, 0x54, 0x4F, 0x5E, 0x63, 0x03, 0x45, 0x32, 0xAC, 0x43,
+    0x8E, 0x46, 0x83, 0x36, 0x8F, 0x8E, 0x5A, 0x63, 0x32, 0x0C, 0xC4, 0x98, 0xF3, 0x28, 0x1C, 0x76,
+    0x1C, 0x78, 0x87, 0x8F, 0xCC, 0x06, 0x25, 0x43, 0x71, 0x5F, 0xE2, 0xFC, 0x41, 0x30, 0xC9, 0x1A,
+    0xF7, 0xBF, 0x4D, 0x91, 0x9F, 0x1B, 0x73, 0x8E, 0x0B, 0xB6, 0xA3, 0x08, 0x3E, 0x84, 0xC1, 0xD8,
+    0xDB, 0x29, 0x5A, 0xCF, 0xA5, 0xCA, 0x09, 0x88, 0x47, 0x2A, 0x05, 0xA2, 0x1A, 0x0B, 0x51, 0x0D,
+    0xF5, 0xB6, 0xA6, 0xBC, 0x09, 0xEF, 0xDB, 0xEE, 0xE1, 0xB7, 0xD0, 0x68, 0x28, 0xC3, 0x71, 0x90,
+    0xBE, 0x23, 0x8F, 0xCE, 0x33, 0xAA, 0xD7, 0xB1, 0x73, 0x2B, 0xEA, 0xBD, 0x92, 0x04, 0xF3, 0xCC,
+    0x6E, 0xBF, 0x6C, 0x27, 0x1E, 0x50, 0xDB, 0xB5, 0xD4, 0x43, 0x05, 0xE0, 0x2D, 0x51, 0xD6, 0x35,
+    0x88, 0xAB, 0x4A, 0xD2, 0x4E, 0x57, 0x0B, 0xE0, 0xDF, 0x77, 0xF1, 0x20, 0xF7, 0x77, 0xA0, 0x32,
+    0x3F, 0x8D, 0xAD, 0x81, 0x41, 0x69, 0xD1, 0x7D, 0x31, 0xAF, 0xB4, 0x2C, 0x62, 0x66, 0x22, 0xAB,
+    0xB4, 0x3A, 0xF2, 0x7D, 0xC0, 0xE6, 0x6B, 0x40, 0xF2, 0x15, 0x20, 0xFB, 0x04, 0xE0, 0x2E, 0xD3,
+    0x49, 0x37, 0xA3, 0x59, 0x0D, 0x80, 0x4D, 0x07, 0x48, 0x1A, 0x40, 0x56, 0x01, 0x20, 0x7D, 0x68,
+    0x09, 0xDD, 0x16, 0xD0, 0x02, 0xDB, 0x7B, 0x10, 0x62, 0xCA, 0x92, 0x9C, 0x80, 0xFB, 0x87, 0xEF,
+    0xC3, 0x41, 0xA9, 0x5B, 0x81, 0x66, 0x06, 0x28, 0xA7, 0x20, 0xB4, 0x84, 0x9E, 0xD2, 0x73, 0xA8,
+    0x89, 0x8E, 0x37, 0x9F, 0x86, 0x1A, 0xED, 0x0C, 0x3A, 0xFF, 0x05, 0x9F, 0x8A, 0x26, 0xED, 0xA4,
+    0xD3, 0xC6, 0x3C, 0x1F, 0xC6, 0x65, 0xD0, 0xF2, 0xF3, 0x81, 0x8D, 0x70, 0xCE, 0x01, 0x22, 0x75,
+    0xC0, 0x6A, 0xB2, 0x6E, 0xD2, 0x2D, 0x9D, 0x37, 0x78, 0xC5, 0xDE, 0x42, 0xE7, 0xF6, 0x53, 0x6D,
+    0x2F, 0xE4, 0x36, 0x5C, 0x85, 0x1B, 0x77, 0xB3, 0xA7, 0x03, 0x5C, 0xBD, 0x40, 0x05, 0xD7, 0xF6,
+    0x55, 0x32, 0x44, 0xA1, 0x8C, 0xC3, 0x51, 0x28, 0xD6, 0x22, 0xAE, 0xB8, 0x76, 0xCA, 0xF6, 0x31,
+    0xE7, 0xC4, 0x19, 0xAA, 0x13, 0x70, 0x70, 0x70, 0x40, 0x8F, 0x88, 0x74, 0x08, 0xB3, 0xAE, 0x92,
+    0x7E, 0x86, 0x8C, 0x4A, 0xB1, 0x14, 0xC9, 0xB3, 0x95, 0x87, 0xD5, 0x1D, 0x8E, 0xF9, 0xA5, 0xD6,
+    0xAD, 0xA7, 0xBA, 0xA2, 0x1A, 0xFD, 0x5D, 0xC2, 0xE5, 0x8A, 0xD6, 0x91, 0xA9, 0x9C, 0x86, 0xEB,
+    0x98, 0x4A, 0x1D, 0xB4, 0x86, 0x19, 0x1F, 0x0A, 0x42, 0x2E, 0x33, 0x3B, 0x19, 0x63, 0x99, 0x6F,
+    0x3D, 0x95, 0x53, 0x53, 0x4D, 0x05, 0xAF, 0x1A, 0xBE, 0x36, 0x98, 0x6C, 0xC0, 0x53, 0x8B, 0xCA,
+    0xA5, 0xAB, 0x40, 0x3E, 0x00, 0x57, 0xE9, 0x95, 0xCC, 0xF1, 0xF1, 0x95, 0x50, 0x88, 0xA1, 0x36,
+    0xAC, 0x8C, 0x01, 0xA3, 0x81, 0xE8, 0xFC, 0x2C, 0x41, 0x26, 0x0E, 0x86, 0x7B, 0x31, 0xC5, 0x48,
+    0xC5, 0x50, 0xBD, 0xB4, 0x07, 0x31, 0x5D, 0x6D, 0xA4, 0xD1, 0xB9, 0x65, 0xFC, 0x0B, 0x1E, 0x89,
+    0xA0, 0x6C, 0x74, 0x59, 0x65, 0x9C, 0x38, 0x30, 0x9B, 0x2F, 0x57, 0xA1, 0x07, 0xEF, 0xFD, 0xEC,
+    0x8A, 0xE7, 0x3C, 0x52, 0x17, 0x98, 0xA7, 0x4B, 0x36, 0x98, 0x1F, 0x5C, 0x43, 0xCB, 0x09, 0xFB,
+    0x48, 0xE8, 0xED, 0x09, 0x9D, 0x31, 0x82, 0xEA, 0xCD, 0x19, 0x8C, 0x53, 0x19, 0x2E, 0xA9, 0xCC,
+    0x89, 0xDF, 0x2E, 0xF7, 0x49, 0xBD, 0x4E, 0xEA, 0xD5, 0xE6, 0x81, 0xDF, 0x83, 0x44, 0xCA, 0x1F,
+    0x27, 0x8D, 0x53, 0x83, 0x36, 0xF4, 0xBC, 0x2C, 0x4F, 0xFB, 0x67, 0x48, 0xE1, 0x52, 0x68, 0xC6,
+    0x0C, 0x62, 0x78, 0x32, 0x69, 0x29, 0x0E, 0x4C, 0x6A, 0x00, 0x39, 0x93, 0xEE, 0xC9, 0xD0, 0xA4,
+    0xE8, 0xE5, 0x67, 0x0B, 0x25, 0x92, 0xB9, 0x60, 0xB0, 0x66, 0x4F, 0x1C, 0x97, 0xCE, 0x69, 0xE8,
+    0x50, 0x18, 0xF2, 0x20, 0x63, 0x56, 0x8E, 0x10, 0x72, 0xEA, 0x85, 0x77, 0x7A, 0xDA, 0x3C, 0xE9,
+    0xA8, 0x9B, 0xAC, 0xC5, 0x52, 0x63, 0xB8, 0xA6, 0xA1, 0x8D, 0x9A, 0x6E, 0xE4, 0xAB, 0xB4, 0xA3,
+    0x57, 0x24, 0x34, 0x6D, 0x01, 0x5A, 0x81, 0x2D, 0x20, 0x39, 0x3D, 0x55, 0x0C, 0x16, 0x94, 0x90,
+    0x51, 0x61, 0x3C, 0x78, 0x19, 0x34, 0x4D, 0x56, 0xAE, 0xAC, 0x48, 0x4E, 0xCF, 0x72, 0x0D, 0x6C,
+    0x0C, 0xD1, 0x29, 0x54, 0xD6, 0xDB, 0x70, 0x3F, 0xE7, 0xB4, 0x18, 0x64, 0x6E, 0x14, 0x04, 0xCC,
+    0x88, 0x33, 0x81, 0x93, 0xC1, 0xB3, 0x53, 0xD7, 0xCC, 0x73, 0x03, 0x0F, 0xEE, 0x5E, 0x84, 0x73,
+    0x4C, 0x13, 0xB3, 0x9D, 0x66, 0xD3, 0xFD, 0x6B, 0x3A, 0x91, 0x58, 0x8F, 0x8B, 0xEF, 0x0E, 0xB8,
+    0x96, 0x2E, 0x46, 0x5D, 0x72, 0x81, 0x0A, 0xDB, 0x77, 0xAF, 0x4C, 0x4A, 0x8A, 0x3C, 0x2E, 0x85,
+    0x3E, 0xC8, 0x9E, 0x9C, 0xC5, 0xF0, 0xE4, 0xF6, 0x4C, 0x03, 0xD2, 0x33, 0xCF, 0x2A, 0xAD, 0xF5,
+    0x33, 0x05, 0x6F, 0x67, 0xC5, 0x49, 0x68, 0xE7, 0x2A, 0x52, 0x39, 0x1D, 0x66, 0x7A, 0x89, 0x43,
+    0x1D, 0xFD, 0x85, 0x6A, 0xC1, 0x6A, 0x35, 0xF1, 0x4F, 0x6B, 0xCE, 0x08, 0xFD, 0xEE, 0x9D, 0x37,
+    0x32, 0x72, 0x1D, 0xBA, 0x8E, 0x5D, 0x10, 0x92, 0xDF, 0x7D, 0x05, 0xDE, 0x46, 0xE9, 0x7B, 0x22,
+    0xA4, 0xB0, 0x9C, 0x34, 0x44, 0xCC, 0xB2, 0x1D, 0x2C, 0x1E, 0x81, 0xFA, 0x74, 0xFB, 0x56, 0x3A,
+    0x2E, 0xAD, 0xFD, 0x68, 0xD2, 0x5A, 0xBD, 0xED, 0x91, 0x2E, 0x24, 0xDC, 0xC6, 0xDB, 0xC7, 0xCA,
+    0xC7, 0x07, 0x39, 0xDD, 0xE0, 0x58, 0xE1, 0x3D, 0x5D, 0x7F, 0xB4, 0xDC, 0x39, 0x2C, 0x1E, 0xA8,
+    0x33, 0x97, 0x93, 0xED, 0x9D, 0xA6, 0x7D, 0x16, 0xB6, 0x79, 0xDA, 0x3E, 0x76, 0xCA, 0x96, 0x9F,
+    0x6E, 0x53, 0xF5, 0x74, 0x6A, 0x3B, 0x91, 0xA7, 0x78, 0xE7, 0xBD, 0xE8, 0xAF, 0xB8, 0x5D, 0xCE,
+    0xC6, 0x51, 0xAA, 0x53, 0x93, 0xA9, 0x09, 0x81, 0xD1, 0xC1, 0x01, 0xB4, 0xB4, 0xA6, 0x5B, 0xED,
+    0x62, 0x2B, 0xD8, 0xC1, 0xDD, 0xF3, 0x8C, 0x4E, 0x9F, 0xC3, 0xC6, 0xC0, 0x84, 0xC4, 0x9F, 0x6F,
+    0x42, 0x05, 0xBA, 0x5B, 0x89, 0xDF, 0x1B, 0xC5, 0x4C, 0x10, 0xB7, 0xEE, 0x19, 0x31, 0x35, 0xE5,
+    0xDB, 0x0C, 0x80, 0x78, 0x3C, 0x0D, 0x7C, 0x7C, 0xF0, 0xEA, 0xC8, 0x86, 0x76, 0xE1, 0xCE, 0xE1,
+    0xF5, 0xF1, 0xD4, 0x0D, 0x2C, 0xE0, 0x43, 0x07, 0xBF, 0xC6, 0x71, 0x29, 0xD4, 0x6B, 0xAE, 0x50,
+    0x4F, 0x70, 0x64, 0x34, 0x53, 0xAF, 0x07, 0xC9, 0xE7, 0x69, 0x1D, 0x59, 0xB7, 0xEF, 0xB1, 0xD2,
+    0x37, 0x0E, 0xBC, 0x1C, 0x72, 0xD7, 0x51, 0x39, 0x59, 0x07, 0xF0, 0x4D, 0x28, 0xC1, 0xD3, 0xA1,
+    0x84, 0x0B, 0x93, 0x3C, 0x18, 0xE7, 0xF5, 0x00, 0x10, 0x5E, 0xB8, 0x81, 0x49, 0x13, 0x3E, 0x60,
+    0x7C, 0x7A, 0x93, 0x41, 0xC4, 0x91, 0x44, 0x7A, 0x83, 0xD8, 0x56, 0x00, 0x0F, 0xBE, 0x44, 0x13,
+    0xF0, 0x16, 0xAE, 0x1F, 0xAE, 0x9D, 0xDF, 0x95, 0x56, 0x36, 0x6C, 0x0F, 0x9C, 0xC9, 0x0A, 0xF5,
+    0xD4, 0x11, 0x56, 0x0C, 0xE5, 0xB5, 0xA7, 0x58, 0x60, 0xA7, 0xDD, 0x42, 0x8A, 0x85, 0x73, 0x50,
+    0xCC, 0x04, 0xA7, 0x51, 0x4F, 0x12, 0x8C, 0x56, 0xEA, 0x9D, 0x95, 0xCE, 0xC1, 0x2A, 0x30, 0xFC,
+    0xF6, 0x55, 0x00, 0x47, 0x07, 0x57, 0x85, 0x4B, 0x18, 0xAB, 0xAD, 0xC2, 0xAB, 0x75, 0x34, 0xE0,
+    0xF4, 0x52, 0xB3, 0xEE, 0x79, 0x6A, 0xD7, 0x3D, 0x9E, 0xBD, 0xD8, 0x6D, 0x5A, 0x9C, 0xDE, 0xEC,
+    0x93, 0x86, 0xA7, 0x41, 0x4E, 0x6F, 0x8C, 0x69, 0x8D, 0x53, 0x11, 0xB0, 0x9E, 0xF0, 0xE4, 0xE4,
+    0xE4, 0xB1, 0x18, 0xE2, 0xE4, 0x10, 0xEE, 0x56, 0x64, 0x56, 0x39, 0x61, 0xED, 0xE4, 0x09, 0xCE,
+    0xCF, 0x53, 0x22, 0x27, 0x92, 0x72, 0x49, 0x69, 0x81, 0xA3, 0x20, 0xBC, 0x97, 0x58, 0x0A, 0x56,
+    0x44, 0x18, 0x01, 0x08, 0x6B, 0x01, 0x5F, 0xEA, 0x89, 0xBF, 0x0E, 0xC4, 0x17, 0x60, 0xC2, 0x32,
+    0x9C, 0x83, 0xCE, 0x4B, 0x68, 0xB9, 0x02, 0x16, 0x20, 0x78, 0xA0, 0xED, 0x88, 0x49, 0x4F, 0x8C,
+    0x03, 0x71, 0x8D, 0x61, 0x86, 0x22, 0xE2, 0x94, 0x86, 0xB9, 0x04, 0x9D, 0x60, 0x26, 0x98, 0x08,
+    0xC6, 0xCB, 0x54, 0x06, 0x37, 0x17, 0x0C, 0x7A, 0xC8, 0x50, 0x0C, 0x71, 0x64, 0x99, 0xA1, 0x31,
+    0x6F, 0x6F, 0x42, 0x9D, 0x70, 0xAE, 0x35, 0xA4, 0x5A, 0xDB, 0x71, 0x0A, 0x63, 0x21, 0xE9, 0x38,
+    0xA5, 0x39, 0x91, 0x93, 0x61, 0xC2, 0x66, 0x07, 0x77, 0xEF, 0x77, 0x5C, 0xE1, 0xF4, 0x2D, 0x6D,
+    0x81, 0x84, 0xE0, 0x5B, 0x34, 0xBB, 0x09, 0xCD, 0x5A, 0x63, 0xEB, 0x65, 0x22, 0xF7, 0x12, 0x6B,
+    0x70, 0xC1, 0x60, 0x00, 0x02, 0xD2, 0x36, 0xCB, 0xE2, 0x33, 0x4C, 0x2B, 0xD0, 0xDD, 0x4B, 0x4C,
+    0x4B, 0x56, 0x27, 0x72, 0x98, 0xE5, 0x5F, 0x78, 0x9E, 0xBD, 0xEF, 0x19, 0xF7, 0x85, 0xB0, 0x44,
+    0x94, 0xC8, 0xE0, 0xEE, 0xBF, 0xFB, 0x88, 0xF5, 0xE4, 0x21, 0xF0, 0xFF, 0xA8, 0x13, 0xCA, 0x15,
+    0x39, 0x89, 0x26, 0x52, 0x2E, 0x95, 0xB0, 0x5D, 0x21, 0xE1, 0x84, 0x04, 0x46, 0x41, 0x28, 0xF5,
+    0xF5, 0xF7, 0xE7, 0x05, 0xBE, 0x5D, 0x22, 0x6A, 0x2E, 0x53, 0xCF, 0x53, 0x31, 0x91, 0xEA, 0xE9,
+    0x18, 0x44, 0x7C, 0x10, 0x6B, 0x20, 0xA0, 0xCB, 0x93, 0x2A, 0x4B, 0x56, 0x46, 0xC6, 0x0F, 0xB6,
+    0x49, 0xB9, 0x92, 0xC5, 0xA3, 0x10, 0x75, 0xBE, 0xE8, 0xBD, 0x9E, 0xD6, 0x7B, 0x4E, 0xEC, 0x46,
+    0x53, 0x12, 0x59, 0x0C, 0xAE, 0x50, 0xD4, 0x91, 0x8B, 0x3C, 0x83, 0x55, 0x2A, 0xBF, 0x8F, 0xBA,
+    0x07, 0x74, 0x2C, 0x21, 0xB2, 0x84, 0x3E, 0x54, 0xED, 0x5A, 0x32, 0x1C, 0xCF, 0x11, 0x26, 0x12,
+    0x28, 0x49, 0x9C, 0x94, 0x4A, 0xA8, 0x3C, 0x45, 0x89, 0xE7, 0x09, 0x7F, 0xC8, 0x63, 0x89, 0xD8,
+    0x06, 0x42, 0x47, 0xA8, 0x99, 0x28, 0x90, 0xF4, 0x73, 0xF3, 0xD0, 0x94, 0x66, 0xFF, 0x62, 0x78,
+    0xFB, 0x82, 0x79, 0x58, 0x5A, 0xF8, 0xF4, 0x80, 0x51, 0x9B, 0xAB, 0x18, 0xBA, 0x8B, 0x66, 0x14,
+    0x19, 0x9B, 0xB7, 0x7C, 0x8C, 0x29, 0xAF, 0xC8, 0x3C, 0x6A, 0x90, 0x7F, 0xC7, 0xE9, 0x26, 0x12,
+    0x27, 0xA6, 0xE4, 0x7C, 0xA5, 0xD0, 0x17, 0x11, 0x42, 0xB3, 0x29, 0x34, 0x68, 0x49, 0x9C, 0x50,
+    0x16, 0x15, 0x93, 0x7E, 0x21, 0x19, 0xD4, 0x97, 0x82, 0x5F, 0x0F, 0xA2, 0x95, 0x5E, 0x3A, 0x57,
+    0x6C, 0x25, 0xB4, 0x14, 0xB7, 0x65, 0x90, 0x87, 0xD7, 0xA5, 0x65, 0x66, 0x1E, 0x99, 0x74, 0x84,
+    0xA0, 0xDC, 0x8A, 0x00, 0xA0, 0x60, 0x3B, 0x50, 0x0C, 0x1A, 0x6F, 0x64, 0x98, 0x8B, 0xDE, 0xBD,
+    0x88, 0x97, 0x32, 0x68, 0x62, 0x26, 0x85, 0x23, 0xF8, 0x1C, 0xFF, 0x26, 0x7D, 0x34, 0x3A, 0x64,
+    0x18, 0xA8, 0xB6, 0x1A, 0x2C, 0x07, 0xB5, 0x19, 0x40, 0x8D, 0x25, 0x1A, 0x59, 0x8F, 0xE4, 0x48,
+    0x48, 0xBB, 0x0E, 0x9B, 0x3E, 0xAB, 0xD1, 0xE3, 0x2A, 0xC4, 0x6D, 0x4A, 0x9E, 0x8F, 0x40, 0xA0,
+    0x49, 0x43, 0xD3, 0xF2, 0xE2, 0xAE, 0x6C, 0x46, 0xBC, 0x53, 0xC7, 0xF7, 0x28, 0xBC, 0x3F, 0xAA,
+    0x34, 0xEC, 0x75, 0x5C, 0x1F, 0x24, 0x81, 0x0D, 0x48, 0x0C, 0x06, 0xB9, 0x00, 0x53, 0xA9, 0x57,
+    0xE4, 0x1A, 0x2C, 0xD3, 0xFC, 0x74, 0x0E, 0xA3, 0x33, 0x43, 0x83, 0x06, 0x64, 0x14, 0x1C, 0x11,
+    0xD7, 0x99, 0x0D, 0x83, 0x5F, 0x3A, 0xDE, 0x4A, 0xD6, 0x1E, 0x7A, 0xB3, 0x44, 0xBB, 0x12, 0xE7,
+    0xDE, 0x93, 0x80, 0x5A, 0xDC, 0x6A, 0xA3, 0xE1, 0xB6, 0xB4, 0xA9, 0x0D, 0x46, 0xA2, 0x31, 0xBD,
+    0x23, 0x29, 0x25, 0x1D, 0x15, 0x02, 0xDB, 0xBB, 0x7C, 0xCB, 0x37, 0x9E, 0xE6, 0x63, 0xC6, 0xB8,
+    0x16, 0xE2, 0x46, 0x54, 0x07, 0x11, 0x30, 0x4B, 0x19, 0xF0, 0x75, 0xEC, 0xCE, 0xD3, 0x58, 0x0D,
+    0x2C, 0xCE, 0xFC, 0xA7, 0xA1, 0x18, 0xB8, 0x9F, 0x88, 0x59, 0x59, 0x7F, 0x34, 0xF2, 0x2E, 0x64,
+    0x61, 0x05, 0xC9, 0xFE, 0x6F, 0x48, 0xCB, 0xB7, 0x28, 0x8F, 0xFD, 0x4A, 0x7B, 0xD4, 0xB0, 0xB5,
+    0x17, 0x6B, 0x36, 0x22, 0x4F, 0x2D, 0xB2, 0x09, 0x1F, 0x7F, 0x13, 0x64, 0x14, 0x24, 0xB1, 0xF7,
+    0x0E, 0xEC, 0x23, 0x4D, 0xAD, 0xC8, 0x1E, 0xE5, 0x34, 0x95, 0x24, 0xEB, 0x64, 0x5A, 0x43, 0xE9,
+    0xA8, 0xB4, 0x69, 0x17, 0x42, 0x1F, 0x2E, 0xC1, 0x37, 0x47, 0x28, 0xA2, 0x48, 0xCA, 0xAE, 0x5B,
+    0x28, 0x6A, 0x26, 0x4C, 0xAA, 0x13, 0x60, 0xF6, 0x5E, 0x33, 0x4B, 0xAA, 0xD9, 0x4B, 0x5E, 0x62,
+    0x56, 0x77, 0x63, 0xCD, 0xF5, 0xF3, 0x29, 0xEF, 0x7D, 0x19, 0xF6, 0x05, 0x83, 0x16, 0xB1, 0x66,
+    0x1D, 0xFF, 0x84, 0xE2, 0x5A, 0x3C, 0xF0, 0x35, 0x01, 0x01, 0x1D, 0xAE, 0x36, 0xB8, 0x77, 0xEF,
+    0x92, 0x52, 0x11, 0xB2, 0xD1, 0xDE, 0x15, 0x60, 0x43, 0xA4, 0x55, 0xCF, 0x99, 0x69, 0x23, 0x40,
+    0x32, 0xE9, 0xFF, 0x02, 0x67, 0x73, 0xE3, 0x3F, 0x82, 0x18, 0xFE, 0x53, 0x28, 0x57, 0xE8, 0xDA,
+    0x8F, 0xD7, 0xD1, 0x72, 0xAB, 0x26, 0x03, 0x30, 0x39, 0x05, 0xF8, 0x0A, 0x6F, 0xCC, 0x30, 0xDD,
+    0x03, 0x90, 0x0C, 0x3D, 0x12, 0x92, 0x92, 0xEF, 0xE6, 0xDA, 0xC0, 0x4D, 0xEE, 0xC2, 0xBC, 0x21,
+    0xA6, 0x61, 0xB6, 0x17, 0xFD, 0x9E, 0x1C, 0x87, 0x7C, 0x3B, 0xF4, 0x4C, 0x86, 0x93, 0x70, 0xD8,
+    0xC0, 0xF7, 0x9E, 0xA5, 0xE7, 0x49, 0xC2, 0x26, 0x49, 0xDB, 0x54, 0xE6, 0x30, 0xA5, 0x95, 0x0C,
+    0xF7, 0xA7, 0x09, 0xA2, 0x28, 0x2A, 0x88, 0xEF, 0x32, 0xD8, 0x33, 0x9A, 0x85, 0xCA, 0xC8, 0x58,
+    0xFF, 0x51, 0x70, 0xE6, 0x3C, 0x73, 0xEA, 0xDE, 0x21, 0xA0, 0x0C, 0x0E, 0x8B, 0x0E, 0x48, 0x2F,
+    0x0D, 0xD7, 0xA0, 0x19, 0xE4, 0x4F, 0x48, 0x80, 0x8D, 0xAF, 0x1D, 0x13, 0x36, 0x80, 0xAD, 0x39,
+    0xD1, 0x27, 0x68, 0x14, 0x9C, 0x56, 0x91, 0xCA, 0x69, 0x38, 0x0A, 0xDA, 0x00, 0x9A, 0xC2, 0x2C,
+    0xF6, 0x5D, 0x5A, 0x6B, 0x8E, 0x1A, 0xBD, 0x27, 0x93, 0x92, 0x0E, 0xAD, 0x7B, 0x86, 0x9C, 0x58,
+    0xDC, 0x63, 0xE8, 0x94, 0xCD, 0x9C, 0x40, 0x45, 0x4A, 0xDD, 0x85, 0xE3, 0x29, 0x19, 0x43, 0x75,
+    0x78, 0xF4, 0xDB, 0x3E, 0x67, 0x52, 0x9A, 0x47, 0xD3, 0xEA, 0x35, 0xCC, 0xAA, 0x3B, 0xC8, 0xE1,
+    0xF5, 0x8D, 0xD0, 0x3C, 0x44, 0x88, 0xC2, 0xE7, 0x57, 0x56, 0xB2, 0xB5, 0x91, 0x4B, 0xE1, 0x14,
+    0x74, 0x53, 0xF9, 0x79, 0x38, 0xCC, 0xE7, 0xFB, 0x4F, 0x5A, 0xA0, 0x2F, 0x59, 0x40, 0xEC, 0x31,
+    0x7D, 0x5D, 0xA5, 0xBE, 0xCC, 0x29, 0xF4, 0x65, 0x8F, 0xE9, 0xEB, 0xFA, 0x56, 0x5F, 0x8E, 0xFA,
+    0x02, 0xEC, 0xE5, 0x62, 0x18, 0xDD, 0xA9, 0xA9, 0x7E, 0x82, 0xB1, 0x96, 0xA9, 0x3A, 0x2C, 0x94,
+    0x26, 0x91, 0xC2, 0xCA, 0x8F, 0xC5, 0x93, 0x38, 0x6C, 0x47, 0x87, 0x95, 0x0D, 0x3F, 0xC6, 0x90,
+    0x57, 0xE9, 0x83, 0x91, 0x3A, 0x6C, 0xA5, 0x50, 0xAB, 0x9B, 0x1E, 0xF3, 0xDA, 0xC7, 0xC3, 0x9E,
+    0x2C, 0x4A, 0x18, 0x6D, 0xB5, 0xA7, 0x1B, 0x68, 0xF5, 0xE3, 0xFF, 0xE8, 0x0D, 0xDC, 0xC6, 0xA9,
+    0x79, 0xE0, 0x62, 0x6F, 0xD9, 0x7D, 0xAB, 0xBE, 0xCD, 0xC1, 0x2C, 0x83, 0xC9, 0x65, 0x01, 0xCE,
+    0xF7, 0xB7, 0x1F, 0xEF, 0xF2, 0x5B, 0x08, 0x35, 0xFD, 0xBE, 0x80, 0x1D, 0x47, 0xBA, 0x32, 0x02,
+    0xE1, 0x9A, 0x91, 0xF1, 0x2D, 0x86, 0xCA, 0x9F, 0x70, 0x33, 0xF0, 0x68, 0xA0, 0xE3, 0x8E, 0xB2,
+    0xFA, 0xE7, 0x04, 0x3C, 0xE8, 0xBC, 0xF8, 0x3D, 0x02, 0x84, 0x1A, 0xA4, 0xE5, 0xEA, 0x98, 0x2B,
+    0x20, 0xA6, 0xF5, 0xD4, 0x1E, 0xC2, 0x96, 0xFD, 0x9C, 0x4A, 0x7A, 0xB2, 0x3F, 0x63, 0x60, 0x2E,
+    0x4C, 0x7F, 0x7F, 0x99, 0xF3, 0xBE, 0xA6, 0xD1, 0x90, 0x76, 0xC8, 0x1E, 0x6D, 0x08, 0x42, 0x38,
+    0xD7, 0xC3, 0x78, 0x09, 0x76, 0x04, 0x83, 0x20, 0xA2, 0x32, 0xA4, 0x93, 0x0A, 0xAB, 0x00, 0x29,
+    0xAE, 0x94, 0xB3, 0xD1, 0x73, 0xF5, 0x74, 0xCF, 0xC6, 0xFC, 0x18, 0x6E, 0xF4, 0x26, 0xDD, 0xE8,
+    0xE6, 0xE3, 0xDD, 0xA8, 0x7A, 0x52, 0x30, 0xD1, 0x6B, 0x5B, 0x6E, 0x18, 0x84, 0x1B, 0x90, 0x88,
+    0x5F, 0xD4, 0x7C, 0xAF, 0x9A, 0x37, 0x8C, 0x2C, 0x37, 0x99, 0x00, 0xF5, 0x02, 0x8D, 0xEE, 0x61,
+    0x49, 0x0C, 0xE9, 0x6B, 0xA9, 0x9C, 0x80, 0xB6, 0x4A, 0x72, 0x03, 0x57, 0x0B, 0x86, 0xBE, 0x42,
+    0xAB, 0xC2, 0x82, 0x67, 0x65, 0x08, 0x2D, 0x87, 0xF0, 0xD4, 0xA8, 0xFB, 0x53, 0x1A, 0xE7, 0xEF,
+    0xB4, 0x54, 0xB5, 0xFF, 0xF8, 0xB9, 0x48, 0x29, 0x94, 0x3A, 0xFA, 0xE3, 0xD4, 0xF1, 0xCA, 0x69,
+    0xA9, 0xC3, 0x9D, 0x92, 0x3A, 0x1E, 0x0F, 0x67, 0x8D, 0x3F, 0x87, 0x51, 0xBC, 0x85, 0x72, 0x24,
+    0x16, 0x45, 0xF9, 0xA5, 0x6C, 0x24, 0x72, 0x5D, 0x26, 0xF5, 0x50, 0xDE, 0xD3, 0x14, 0xF3, 0xC3,
+    0x3F, 0x49, 0x3A, 0x95, 0x6A, 0x40, 0x50, 0x61, 0x32, 0x68, 0x90, 0xC9, 0x05, 0x4B, 0xE8, 0x59,
+    0xF6, 0x95, 0x49, 0xD6, 0x15, 0x2E, 0x1A, 0xED, 0x21, 0x6B, 0x7F, 0x8B, 0xE2, 0xDE, 0xF6, 0x0D,
+    0x43, 0x6C, 0x32, 0xB2, 0xD0, 0xF8, 0xBC, 0xDD, 0xE9, 0xA8, 0x30, 0x23, 0xDF, 0xB7, 0xA2, 0x20,
+    0x9F, 0x62, 0xB8, 0xD1, 0x27, 0x05, 0xCC, 0x5D, 0x9C, 0xEE, 0x5B, 0x0E, 0xD9, 0xFA, 0x7E, 0x25,
+    0xFD, 0x7A, 0x94, 0x8C, 0xC1, 0xC6, 0xF9, 0x85, 0x6C, 0x60, 0xC8, 0x6F, 0x08, 0x35, 0x3D, 0x06,
+    0x79, 0x54, 0xE9, 0x82, 0x17, 0x99, 0xB8, 0xFF, 0x3C, 0x5A, 0x84, 0x99, 0xAD, 0x2D, 0x8F, 0x11,
+    0x5A, 0xDA, 0xBB, 0x79, 0xF3, 0xB2, 0x41, 0xAC, 0x0E, 0x83, 0xF7, 0xBA, 0xCB, 0x0A, 0x27, 0x1D,
+    0x30, 0xB0, 0xF5, 0xB8, 0x62, 0xC2, 0x27, 0x1F, 0xF3, 0x5E, 0xE4, 0xDE, 0xC7, 0x5B, 0xF0, 0x59,
+    0x7F, 0x93, 0x1B, 0x78, 0x47, 0xB2, 0xFD, 0xD0, 0x4C, 0xDF, 0x08, 0x12, 0xCA, 0x1E, 0x6B, 0x14,
+    0xB5, 0xFD, 0x60, 0xE1, 0x10, 0xD5, 0x70, 0x7E, 0xD2, 0x9B, 0x10, 0xF6, 0x4A, 0xFA, 0x54, 0x6F,
+    0x06, 0x44, 0xDC, 0x88, 0xF7, 0x62, 0x06, 0xDC, 0xF1, 0xD7, 0x0D, 0xB7, 0x68, 0xBA, 0xE4, 0x1F,
+    0x2D, 0xE3, 0xEE, 0x3E, 0xF9, 0xAC, 0x43, 0xD8, 0xBD, 0x19, 0xD2, 0x8F, 0x7A, 0x44, 0xDD, 0xEB,
+    0x31, 0xFB, 0x5B, 0x2F, 0xB1, 0xB6, 0xBD, 0x31, 0xD8, 0x0A, 0x92, 0xD8, 0x62, 0x74, 0x0C, 0xB0,
+    0x6D, 0x3E, 0x32, 0x45, 0x08, 0xDE, 0x78, 0x5F, 0xC8, 0x77, 0x36, 0xC7, 0x7E, 0x1D, 0xB3, 0x3D,
+    0x2E, 0xC6, 0x83, 0x7E, 0x17, 0x82, 0xD7, 0xDA, 0x41, 0xD7, 0x65, 0xDD, 0x75, 0xD3, 0xE0, 0xCE,
+    0xB6, 0x29, 0xDD, 0x39, 0x19, 0x85, 0x96, 0x5E, 0xA0, 0xED, 0x3F, 0x1C, 0xA7, 0x4F, 0x1E, 0x96,
+    0x91, 0x71, 0xCA, 0x69, 0x99, 0x68, 0x00, 0x5D, 0x4D, 0xE3, 0xF4, 0xF2, 0xAD, 0xEF, 0x26, 0x63,
+    0xE0, 0xCB, 0x01, 0x63, 0xC5, 0xD0, 0x10, 0x49, 0xCA, 0x36, 0xB3, 0x63, 0xBC, 0x6C, 0xFB, 0x69,
+    0x8D, 0x51, 0xAD, 0x66, 0x93, 0x56, 0x3B, 0xD5, 0xAA, 0xAF, 0x62, 0xD1, 0x2A, 0xBA, 0x84, 0x77,
+    0xA8, 0x56, 0x19, 0xDD, 0x5F, 0xE6, 0xB7, 0x86, 0x0F, 0xB9, 0x11, 0xA2, 0x5A, 0x95, 0x4F, 0x89,
+    0x92, 0x04, 0xD6, 0x46, 0x77, 0x26, 0x36, 0x4B, 0x0C, 0x7A, 0xE2, 0x23, 0x8B, 0xEB, 0x27, 0xC9,
+    0xE4, 0x43, 0x28, 0x5D, 0x59, 0xA3, 0x5A, 0xFD, 0x54, 0x84, 0xE0, 0x7C, 0x2A, 0xAF, 0x1F, 0xCA,
+    0x86, 0x7C, 0x29, 0x8D, 0x30, 0x8E, 0xE5, 0x36, 0xA4, 0x24, 0x5B, 0x95, 0x7C, 0x64, 0x61, 0xDC,
+    0xCB, 0x06, 0x19, 0xC1, 0xA0, 0x7E, 0x1B, 0x76, 0x0A, 0x08, 0xE1, 0x70, 0x0E, 0x99, 0x25, 0xC2,
+    0xA1, 0xD6, 0xF9, 0xE5, 0xD7, 0xAC, 0xDB, 0x65, 0x87, 0xE0, 0xBB, 0x67, 0x47, 0x8A, 0x75, 0xA2,
+    0xF0, 0xD7, 0x3F, 0xEA, 0x0C, 0x87, 0xEA, 0xF8, 0xC1, 0x83, 0x9F, 0x3B, 0x6C, 0xE9, 0xF2, 0x7D,
+    0xB3, 0xEA, 0x36, 0xED, 0xA6, 0x8B, 0x9B, 0xB8, 0x4D, 0x90, 0x9B, 0x65, 0x75, 0xDA, 0xD8, 0x0A,
+    0x4F, 0x51, 0xF8, 0x29, 0x28, 0x94, 0xFB, 0xF9, 0x41, 0xCE, 0x77, 0x92, 0x2E, 0x6B, 0xD2, 0xD6,
+    0xEA, 0xA7, 0x12, 0x7D, 0x1B, 0xC5, 0xE7, 0x2E, 0x0F, 0x98, 0xFC, 0x17, 0xB6, 0xDF, 0x5D, 0x56,
+    0x58, 0x56, 0x0B, 0xDB, 0x62, 0x95, 0xA3, 0x0B, 0xF0, 0x54, 0x4F, 0xFF, 0x65, 0xCD, 0x1A, 0x04,
+    0x5E, 0x46, 0x39, 0x26, 0xF3, 0x9E, 0x06, 0x7D, 0x1A, 0xF7, 0xC5, 0xB2, 0x54, 0x36, 0x19, 0x4E,
+    0xC2, 0x29, 0x2D, 0x03, 0x40, 0x7F, 0xEF, 0xCF, 0x34, 0x82, 0xAF, 0x24, 0x74, 0x93, 0x34, 0x32,
+    0xA7, 0x65, 0x40, 0x57, 0x97, 0x95, 0x79, 0xDE, 0xD9, 0x9E, 0xC0, 0x2D, 0xBF, 0x09, 0x77, 0xAE,
+    0xEC, 0xD4, 0xFC, 0x8E, 0x4E, 0x94, 0xFA, 0x39, 0xCE, 0x83, 0x7F, 0x31, 0xF3, 0x0C, 0xFF, 0x96,
+    0xED, 0xB3, 0xCF, 0x98, 0xA0, 0x7E, 0xFE, 0xC7, 0x20, 0x5E, 0xF3, 0x3B, 0x0D, 0x35, 0x27, 0x84,
+    0xB4, 0x6F, 0x84, 0xDC, 0xED, 0x20, 0x44, 0x3D, 0xC7, 0x3D, 0xEA, 0xA7, 0x7F, 0x50, 0xB6, 0x03,
+    0x76, 0xF9, 0x05, 0x65, 0x15, 0x0C, 0xE1, 0x16, 0x27, 0x31, 0x64, 0x43, 0x85, 0xE2, 0x44, 0xFD,
+    0xEF, 0x5B, 0x36, 0x58, 0x7B, 0xCF, 0x4C, 0xF6, 0xE6, 0x2E, 0xAB, 0x58, 0x9C, 0x9B, 0xC9, 0x62,
+    0xF3, 0x50, 0x4D, 0x56, 0xE7, 0xF7, 0x40, 0xB1, 0xFB, 0xD9, 0x45, 0xE9, 0xB3, 0xED, 0xCD, 0x6C,
+    0x7D, 0x52, 0xB8, 0x18, 0x7E, 0xE7, 0x62, 0xF2, 0x01, 0xEE, 0x1A, 0xC8, 0x5B, 0xFF, 0xA3, 0x8B,
+    0x69, 0xA4, 0x8B, 0x67, 0xCB, 0x22, 0xB6, 0x1D, 0xA9, 0x0D, 0xDD, 0x32, 0x52, 0x7E, 0xAD, 0x28,
+    0x24, 0xF8, 0xAB, 0xE4, 0xF5, 0x6A, 0xF7, 0x62, 0x1E, 0x69, 0x35, 0x0F, 0x70, 0x7B, 0x81, 0x91,
+    0xFE, 0x8A, 0x23, 0x7D, 0xC8, 0x5B, 0xDF, 0xE7, 0xC5, 0x7F, 0x00, 0xB5, 0x55, 0x31, 0x8F, 0xDC,
+    0x44, 0x14, 0x7E, 0xB6, 0xC3, 0x6D, 0xB1, 0xC5, 0xD2, 0x9C, 0x28, 0x56, 0xC8, 0x7D, 0x84, 0x34,
+    0x3F, 0x61, 0x9C, 0x4B, 0x41, 0x49, 0x8A, 0x2C, 0x94, 0x47, 0xBD, 0x14, 0xF9, 0x09, 0x36, 0xE1,
+    0x07, 0x70, 0x15, 0x75, 0x0A, 0xAA, 0x43, 0x22, 0x2D, 0x8A, 0x88, 0xC6, 0x88, 0x92, 0x02, 0x2B,
+    0xA4, 0xA3, 0x31, 0x22, 0x69, 0x68, 0xCE, 0x85, 0x89, 0x9C, 0xCB, 0x78, 0x1E, 0xDF, 0x37, 0x73,
+    0xBB, 0xDC, 0x5D, 0x88, 0x40, 0x8A, 0x18, 0x8F, 0xBF, 0x99, 0xB5, 0x9F, 0xDF, 0x7B, 0xF3, 0xDE,
+    0xFB, 0xDE, 0xEA, 0xFD, 0xA0, 0x5F, 0xA8, 0xDE, 0x0F, 0x2E, 0xCD, 0x5B, 0x73, 0x9D, 0xA6, 0x78,
+    0x91, 0x79, 0x31, 0x88, 0x64, 0x7E, 0x09, 0xCC, 0xFD, 0xAA, 0x17, 0x29, 0x12, 0x4E, 0xAB, 0x0E,
+    0x38, 0x96, 0xAD, 0xC8, 0x62, 0x34, 0xAD, 0xAC, 0x14, 0xA3, 0xBD, 0x8C, 0xEF, 0x1C, 0x3F, 0x77,
+    0x1B, 0x91, 0xB2, 0x73, 0x02, 0x6C, 0x89, 0xA6, 0x0D, 0x22, 0x35, 0x5E, 0x86, 0x2B, 0x78, 0xE8,
+    0x3E, 0x99, 0x21, 0xE9, 0x8A, 0x09, 0x32, 0xA1, 0x18, 0x89, 0x0B, 0xE2, 0x6B, 0xC6, 0x45, 0x2A,
+    0xDC, 0x79, 0xBF, 0x83, 0x75, 0x38, 0x91, 0x9C, 0x2A, 0x68, 0x52, 0x6C, 0x54, 0xF9, 0xE2, 0xF9,
+    0xF7, 0xE2, 0x9E, 0xF4, 0x37, 0x08, 0xB0, 0xF6, 0x02, 0x60, 0x15, 0x50, 0xEA, 0x4B, 0xF8, 0xAA,
+    0x0A, 0xBF, 0x9D, 0x4E, 0x71, 0x2B, 0xFC, 0xB8, 0x92, 0xFC, 0x77, 0x6D, 0xA0, 0x4F, 0xDB, 0x4F,
+    0xF3, 0xDF, 0xB4, 0x71, 0x5F, 0xBD, 0xD2, 0xCA, 0x51, 0x1F, 0xC0, 0x8B, 0x51, 0x7E, 0xFC, 0xD9,
+    0x9F, 0x57, 0xEC, 0x46, 0xB8, 0x18, 0x05, 0x34, 0x2C, 0x47, 0xEA, 0xEF, 0x64, 0x35, 0xD0, 0xD8,
+    0x20, 0x06, 0x46, 0xEA, 0x9F, 0x26, 0xB1, 0x0D, 0x8C, 0xDD, 0xF6, 0x02, 0x4B, 0xA2, 0xB9, 0xCF,
+    0x42, 0x5C, 0xE7, 0xC2, 0xA7, 0x75, 0x31, 0xA5, 0x95, 0x9F, 0x89, 0x16, 0xDE, 0x74, 0xDB, 0x28,
+    0x6F, 0x7F, 0x84, 0x4D, 0xFB, 0xEB, 0xE4, 0x3E, 0x82, 0xA3, 0x46, 0x87, 0x60, 0x5E, 0x79, 0x1C,
+    0xF1, 0x17, 0x6F, 0x7F, 0x08, 0x92, 0x3D, 0x5A, 0x4C, 0xB6, 0xA5, 0xC6, 0xD5, 0x60, 0x1B, 0xAE,
+    0x65, 0x5F, 0xC7, 0xD5, 0xB6, 0xE9, 0xB7, 0xAB, 0xD2, 0x8A, 0x88, 0x50, 0x2E, 0x9F, 0xC5, 0x3C,
+    0x09, 0xCC, 0x19, 0x7C, 0xF4, 0xFC, 0x4C, 0x96, 0x4A, 0x87, 0x7B, 0xC9, 0x18, 0x0D, 0x8E, 0x1B,
+    0xFB, 0xE3, 0xAC, 0x11, 0x0B, 0x7C, 0x4A, 0x81, 0x42, 0x75, 0x66, 0x9C, 0xCE, 0xA0, 0x64, 0x39,
+    0x17, 0x44, 0x9F, 0x47, 0xE4, 0x7E, 0x11, 0x96, 0x54, 0xAA, 0xF7, 0xA0, 0x32, 0x53, 0xE5, 0x11,
+    0x9C, 0xB6, 0xDC, 0x23, 0x1D, 0xD3, 0x12, 0xF1, 0x33, 0x53, 0x89, 0x3A, 0xB0, 0xA3, 0x9D, 0xDC,
+    0x50, 0xE3, 0x32, 0xB3, 0x76, 0xAE, 0xC7, 0x9B, 0xD6, 0xF5, 0x0C, 0xBC, 0x1B, 0xC4, 0x21, 0x61,
+    0x5E, 0xDC, 0xCC, 0xDC, 0xE1, 0x49, 0x49, 0xEC, 0x90, 0x99, 0xD9, 0x8D, 0xD0, 0xD6, 0x19, 0xD8,
+    0xBF, 0x43, 0x77, 0x1A, 0x5E, 0x8E, 0x57, 0x55, 0xF3, 0x82, 0x99, 0xBB, 0x8C, 0xBD, 0xBF, 0x02,
+    0x39, 0xE2, 0xF9, 0x7E, 0x3E, 0x1D, 0x34, 0xE6, 0xFC, 0x5C, 0x1B, 0xAA, 0x6C, 0x23, 0x64, 0xC7,
+    0x7A, 0x97, 0x09, 0xAA, 0x98, 0x1D, 0xB8, 0xA8, 0xC7, 0x03, 0x32, 0xBF, 0x9A, 0x24, 0x0F, 0x4C,
+    0xC1, 0x07, 0x45, 0xB3, 0xCB, 0x25, 0xAB, 0x6E, 0xF1, 0x06, 0xD8, 0x7E, 0x73, 0x7E, 0x1A, 0x0B,
+    0xA3, 0xF9, 0x1B, 0xDE, 0x28, 0x9C, 0x20, 0xA3, 0xF3, 0x62, 0x59, 0x0D, 0x34, 0xCB, 0x1B, 0xE5,
+    0x86, 0xE0, 0x15, 0x08, 0xDD, 0x62, 0x66, 0x28, 0x91, 0x0F, 0xB8, 0x50, 0xB2, 0x70, 0x86, 0x4B,
+    0xA2, 0xCD, 0x7F, 0x12, 0x75, 0xED, 0x3E, 0x6F, 0x19, 0x99, 0x51, 0x36, 0x8C, 0x7F, 0xC3, 0xB3,
+    0x36, 0x31, 0x11, 0xD8, 0x30, 0xCB, 0x73, 0x2A, 0x4F, 0x06, 0x1A, 0x40, 0xCF, 0x6A, 0x4A, 0x2D,
+    0x48, 0x09, 0x6C, 0x3B, 0x12, 0x81, 0xB5, 0x69, 0x74, 0xA7, 0x20, 0xAA, 0x02, 0xDD, 0xB6, 0xA7,
+    0xA7, 0x97, 0x0F, 0x5D, 0xC7, 0x43, 0xEF, 0xC7, 0xE1, 0x66, 0xB3, 0x91, 0xEB, 0x21, 0xE1, 0x88,
+    0xE7, 0x7E, 0x4C, 0x70, 0xAC, 0xB0, 0x68, 0xD7, 0xD0, 0x4E, 0xF4, 0x25, 0x39, 0x93, 0xB6, 0xEB,
+    0xE4, 0x08, 0x89, 0x82, 0x03, 0xAF, 0x51, 0x77, 0x19, 0x39, 0x69, 0xF4, 0x99, 0xB0, 0x3A, 0x2E,
+    0x14, 0x3C, 0xDE, 0x71, 0x1F, 0xE3, 0x20, 0x7A, 0x4D, 0xB3, 0x78, 0x83, 0x6A, 0x62, 0x4D, 0xDB,
+    0x50, 0xAD, 0x11, 0xAB, 0x78, 0xC6, 0x36, 0x8F, 0x47, 0xE9, 0x91, 0xDA, 0x87, 0x5F, 0x2F, 0xC7,
+    0xD5, 0x00, 0x99, 0xDB, 0x53, 0xD9, 0xA1, 0x14, 0x8E, 0xBC, 0x69, 0x5D, 0xE7, 0x6E, 0x79, 0xFB,
+    0xB9, 0x0A, 0x5A, 0x9C, 0x3D, 0x9A, 0xA5, 0x96, 0xB9, 0x06, 0x45, 0x1D, 0x16, 0x14, 0x91, 0xCB,
+    0x3C, 0x17, 0xC5, 0x42, 0xDE, 0x16, 0xBE, 0x3E, 0x0A, 0xB9, 0x7E, 0x38, 0x82, 0x51, 0x67, 0x7A,
+    0x36, 0xD8, 0xB6, 0xD6, 0x9F, 0xB5, 0x35, 0x5D, 0x19, 0xC0, 0x81, 0xC8, 0xDB, 0x77, 0x63, 0x66,
+    0x62, 0x23, 0x40, 0xCC, 0x4F, 0xE0, 0x44, 0xF8, 0x98, 0x3E, 0x1B, 0xD5, 0x14, 0xD8, 0x14, 0x93,
+    0x83, 0x53, 0xBC, 0xB2, 0x3D, 0x7E, 0x57, 0x76, 0xF8, 0x1F, 0x11, 0xED, 0xC8, 0x8E, 0x40, 0xB1,
+    0x13, 0x82, 0x23, 0x65, 0x10, 0x93, 0xDA, 0xA3, 0x27, 0x9F, 0x49, 0x6B, 0x32, 0x82, 0x29, 0x98,
+    0x63, 0x06, 0x63, 0x24, 0x77, 0xF3, 0x0F, 0x71, 0xCD, 0x5B, 0xCF, 0x9D, 0xB6, 0xC3, 0x4D, 0xAC,
+    0xCF, 0xBA, 0x8B, 0xE7, 0x16, 0x83, 0x60, 0xAD, 0x60, 0x7E, 0x85, 0x68, 0x2D, 0x70, 0x17, 0xB3,
+    0xC4, 0xFA, 0xCE, 0x62, 0xAB, 0x6A, 0x52, 0x31, 0xDB, 0x0B, 0xE1, 0xF2, 0xBA, 0x70, 0xD8, 0x09,
+    0x57, 0x57, 0x85, 0xC9, 0xE8, 0x26, 0xCD, 0x9B, 0xFA, 0xF6, 0xBE, 0x37, 0x7B, 0x6D, 0xF0, 0x5E,
+    0xB2, 0x71, 0xDF, 0x5E, 0x18, 0xAC, 0x65, 0x6C, 0xBA, 0xB4, 0x6E, 0xCE, 0x68, 0xFE, 0x4B, 0x38,
+    0xEA, 0xF8, 0xE7, 0x14, 0xD0, 0x5A, 0x33, 0x9F, 0x7B, 0xCA, 0x06, 0x32, 0xDF, 0xB1, 0x34, 0x6C,
+    0x53, 0x76, 0xF8, 0xCB, 0xB3, 0xF8, 0x73, 0x1C, 0x6E, 0x56, 0x72, 0xF0, 0x00, 0x05, 0xE8, 0x79,
+    0x83, 0x35, 0x77, 0xB6, 0x0F, 0x62, 0x82, 0x66, 0x66, 0x8D, 0x8C, 0x5F, 0x82, 0xA6, 0xDF, 0x42,
+    0x39, 0x8E, 0x83, 0x62, 0x96, 0xBA, 0xE7, 0xC3, 0x6B, 0x53, 0xDB, 0xF7, 0xC8, 0x31, 0x71, 0xCF,
+    0x48, 0xA8, 0x5A, 0xAB, 0x0C, 0x89, 0x74, 0xED, 0x3F, 0x48, 0xD6, 0x2F, 0xA9, 0xC7, 0x28, 0x88,
+    0x15, 0xA9, 0xF2, 0x2F, 0x63, 0xFB, 0xA8, 0x62, 0x57, 0x70, 0xB1, 0x13, 0xA3, 0xD7, 0x14, 0xD7,
+    0x66, 0x60, 0x3D, 0xE5, 0xFA, 0x94, 0x84, 0x5C, 0xC3, 0xB9, 0x00, 0xEA, 0xC2, 0x6F, 0x3E, 0x7F,
+    0x4D, 0xF8, 0xDE, 0x1C, 0xF5, 0x4C, 0x89, 0xB7, 0xA9, 0x4D, 0x1B, 0x3D, 0xC9, 0xE1, 0x78, 0x78,
+    0x98, 0x3A, 0xC4, 0x77, 0x68, 0xF0, 0x15, 0x28, 0x3E, 0x25, 0x3E, 0xFF, 0x05, 0xD5, 0x5A, 0xBF,
+    0x93, 0xDF, 0xC4, 0x15, 0x7F, 0x92, 0xEC, 0x13, 0xA0, 0x30, 0x72, 0x11, 0x0F, 0x03, 0x14, 0x4A,
+    0xC9, 0x50, 0xA0, 0x7F, 0x00, 0x58, 0x61, 0x0A, 0x0A, 0x8A, 0xB8, 0xF0, 0x41, 0x41, 0x91, 0x26,
+    0x14, 0x71, 0xC1, 0xB5, 0x14, 0x30, 0x12, 0x64, 0x26, 0x94, 0xB9, 0x22, 0x54, 0x14, 0xA1, 0x70,
+    0x66, 0xF0, 0xB9, 0x70, 0x93, 0x22, 0x05, 0x58, 0x4B, 0x93, 0x26, 0x05, 0x22, 0x4C, 0x6A, 0x2B,
+    0x89, 0x33, 0xC9, 0xE0, 0xC2, 0x2A, 0x44, 0x90, 0x8D, 0xA4, 0xCD, 0xE7, 0xF3, 0x56, 0xDF, 0xEF,
+    0x7D, 0xEF, 0x6C, 0xE3, 0x1F, 0x84, 0x1B, 0xFB, 0x6B, 0xE9, 0xED, 0x59, 0x5A, 0xED, 0xBE, 0xF7,
+    0xF6, 0xFD, 0xDE, 0x15, 0xC9, 0x5A, 0xD3, 0x9B, 0xC1, 0xF4, 0x59, 0x17, 0x08, 0x7F, 0x59, 0x9B,
+    0x75, 0xFE, 0x5F, 0xBE, 0xFC, 0x33, 0xFC, 0xD7, 0x2F, 0xFF, 0x06, 0xED, 0x14, 0x75, 0xFE, 0x8E,
+    0xAF, 0x8B, 0xD4, 0x6E, 0x88, 0x9C, 0x1B, 0x52, 0xE7, 0xBA, 0xDC, 0xBD, 0xD1, 0xB1, 0x47, 0x89,
+    0x57, 0x75, 0x8B, 0xBB, 0xD9, 0xB8, 0xF1, 0xFF, 0xB2, 0xF5, 0xEF, 0xCC, 0x28, 0xBF, 0xCC, 0x9C,
+    0xEB, 0xF1, 0x4D, 0x1F, 0xE2, 0x96, 0x1D, 0xD7, 0x4A, 0xD4, 0xEF, 0x8F, 0x1B, 0x9C, 0x16, 0xFF,
+    0xDB, 0x72, 0x98, 0x21, 0x77, 0xAE, 0xC2, 0x34, 0x4E, 0xC4, 0x01, 0x04, 0xCE, 0x3E, 0x29, 0xA1,
+    0x2B, 0x04, 0x40, 0x36, 0x41, 0xC4, 0x67, 0x35, 0x87, 0xDB, 0x07, 0xAF, 0xBB, 0x0F, 0x4F, 0x1F,
+    0xE8, 0xB2, 0x02, 0xC9, 0x04, 0x90, 0x93, 0x1A, 0xF4, 0x73, 0xCD, 0x21, 0xA0, 0x73, 0xA7, 0x22,
+    0x6F, 0x4B, 0x7E, 0x6D, 0x9E, 0x89, 0xC0, 0x2C, 0x09, 0x88, 0x94, 0x78, 0xCA, 0x3A, 0x49, 0xBB,
+    0x68, 0x90, 0xB4, 0x09, 0xC7, 0x05, 0xB4, 0xF8, 0x6F, 0xD2, 0x27, 0xBD, 0xC4, 0xE0, 0x81, 0x80,
+    0xB0, 0x51, 0x0C, 0x31, 0x4D, 0x7F, 0x73, 0xEE, 0x53, 0x01, 0x57, 0x7F, 0x46, 0x06, 0x64, 0x03,
+    0x28, 0x27, 0x2B, 0xC5, 0xB4, 0xE9, 0x20, 0xB5, 0x4D, 0x46, 0x71, 0x55, 0x34, 0x03, 0xAF, 0xD0,
+    0x45, 0x33, 0x68, 0x7B, 0x65, 0x04, 0x32, 0x5F, 0x00, 0x25, 0x73, 0xAD, 0x23, 0xD1, 0x60, 0x56,
+    0xEA, 0xAC, 0x84, 0x17, 0xDD, 0xD7, 0xC0, 0x19, 0xE3, 0x29, 0x00, 0x49, 0x67, 0x3C, 0x0D, 0xC1,
+    0x05, 0x77, 0x7E, 0xE3, 0x45, 0xF0, 0xBA, 0xDB, 0xDE, 0xA4, 0x50, 0x41, 0xBD, 0xF9, 0xF3, 0x2C,
+    0x3D, 0xBB, 0xF9, 0xE8, 0xAC, 0x9C, 0x24, 0x7F, 0x5C, 0x85, 0xA5, 0xB0, 0xF9, 0x8D, 0xDA, 0x1A,
+    0xBB, 0x55, 0x18, 0x0B, 0x1C, 0x30, 0x7B, 0x06, 0xAC, 0x62, 0xA0, 0x91, 0x80, 0xFA, 0xEC, 0xAA,
+    0xAB, 0x8C, 0x2D, 0xAD, 0xA9, 0xB2, 0xC6, 0xD8, 0xB4, 0x35, 0x6D, 0xD6, 0x64, 0x93, 0xB1, 0x31,
+    0xD7, 0x86, 0x68, 0x3D, 0x8D, 0x56, 0x17, 0x3A, 0xE7, 0x97, 0xED, 0xDB, 0x62, 0x9A, 0xF2, 0x3B,
+    0x67, 0x4B, 0xBC, 0xCB, 0xC0, 0x38, 0x39, 0xA9, 0x93, 0x1B, 0x99, 0xEA, 0xF7, 0x9D, 0x7B, 0xDF,
+    0x95, 0xC5, 0x74, 0x4C, 0x4E, 0xC8, 0xEA, 0xB7, 0xE3, 0x76, 0x85, 0x93, 0x39, 0x5D, 0x96, 0x36,
+    0xA8, 0x31, 0x18, 0xFE, 0x4C, 0x20, 0x16, 0x5D, 0xF0, 0x66, 0x08, 0xC6, 0xDB, 0xCC, 0x35, 0x9F,
+    0x49, 0x5A, 0x94, 0xCE, 0x1A, 0xC9, 0xF0, 0xB2, 0xC8, 0x8A, 0x17, 0x43, 0xC8, 0x4C, 0x5A, 0x3D,
+    0x4F, 0x91, 0x49, 0xEC, 0x3B, 0x31, 0x66, 0x8E, 0xD1, 0x34, 0x37, 0x37, 0xCF, 0x47, 0x2D, 0xBB,
+    0xBC, 0xC0, 0x9E, 0x69, 0x95, 0x07, 0x40, 0x28, 0x2D, 0xD2, 0xC2, 0x5D, 0xB0, 0x39, 0x1E, 0xE7,
+    0xCE, 0xBE, 0x8B, 0x89, 0xC2, 0xF3, 0xC1, 0x28, 0xB8, 0x24, 0x41, 0xAF, 0x72, 0x57, 0x4A, 0xF0,
+    0x21, 0xE1, 0xD2, 0xAB, 0x94, 0xB4, 0x6C, 0x56, 0x82, 0xB9, 0xE5, 0x9A, 0x14, 0xF2, 0x7B, 0x01,
+    0x9D, 0x47, 0x39, 0x3B, 0x25, 0x6E, 0xCA, 0xFF, 0x35, 0x99, 0x62, 0x32, 0xA7, 0x26, 0x73, 0x6D,
+    0xCA, 0xDC, 0xBB, 0x5B, 0x57, 0x9E, 0x91, 0x47, 0xE4, 0x51, 0x10, 0x53, 0x65, 0x10, 0xDE, 0xB6,
+    0xEC, 0x20, 0xB7, 0xCE, 0x46, 0x0E, 0x52, 0x9A, 0x4E, 0xC9, 0x2C, 0xA6, 0xCF, 0x47, 0x7D, 0x0E,
+    0x8D, 0x80, 0x50, 0xE4, 0x43, 0x06, 0x49, 0x9A, 0x62, 0x2E, 0xE6, 0x29, 0xB2, 0xD4, 0x42, 0x0A,
+    0xCB, 0x16, 0x6F, 0x32, 0xE0, 0x29, 0xC7, 0xB8, 0x70, 0x7B, 0x7B, 0x7B, 0x05, 0xC5, 0xB3, 0xDA,
+    0x07, 0x64, 0xE9, 0xED, 0x81, 0x71, 0xED, 0xFA, 0x92, 0x8D, 0xDF, 0xF7, 0x71, 0x7B, 0xFB, 0xB4,
+    0x72, 0x1B, 0xCB, 0x46, 0x6E, 0x3B, 0xCF, 0xED, 0x31, 0x69, 0xC1, 0x6D, 0x19, 0xA3, 0x0E, 0xDC,
+    0x66, 0x03, 0x6E, 0xCB, 0x18, 0xB7, 0xE0, 0xAF, 0x4C, 0x3B, 0x96, 0x0D, 0x3E, 0xD0, 0x66, 0x26,
+    0xB7, 0x65, 0x24, 0x5B, 0x5F, 0x90, 0x31, 0xB5, 0xE0, 0x36, 0x3E, 0x6F, 0xC8, 0x6D, 0x7C, 0xC7,
+    0xC7, 0x63, 0x30, 0x90, 0xDB, 0x67, 0x64, 0xFB, 0xAE, 0xB8, 0xFD, 0x2C, 0xC8, 0xDE, 0xA5, 0x3E,
+    0x75, 0x0A, 0xF8, 0xDF, 0x8F, 0x55, 0x9F, 0x21, 0xB3, 0x78, 0x34, 0x96, 0x2F, 0x4D, 0x97, 0xE4,
+    0xD2, 0x25, 0x29, 0x01, 0xF1, 0x37, 0x9E, 0xA4, 0xB4, 0x2A, 0x95, 0xDA, 0xA9, 0x9E, 0x74, 0xDE,
+    0x06, 0x9C, 0xBD, 0x70, 0xE3, 0x66, 0x7E, 0xC6, 0xDF, 0xF7, 0x85, 0x22, 0x74, 0xCB, 0x65, 0xD8,
+    0x06, 0xEA, 0xE0, 0x72, 0x9F, 0x5F, 0x1B, 0x1F, 0x8B, 0x46, 0xC1, 0x15, 0xC3, 0x44, 0x40, 0xD7,
+    0x1B, 0x71, 0x45, 0x34, 0x49, 0xDA, 0xC3, 0x24, 0x4C, 0xFE, 0x22, 0x62, 0x4B, 0xFF, 0x21, 0xFB,
+    0x68, 0x3C, 0x06, 0x1E, 0xC0, 0x8A, 0xBC, 0x01, 0x9C, 0x6D, 0x08, 0x93, 0xB5, 0x85, 0x0E, 0xF3,
+    0x09, 0x99, 0xCD, 0x05, 0xD2, 0x42, 0x33, 0x00, 0xB5, 0xDE, 0xDB, 0xC5, 0x5B, 0x08, 0x07, 0x2C,
+    0x07, 0x86, 0x2C, 0x97, 0x75, 0x84, 0xBA, 0xD5, 0xCD, 0x3D, 0x00, 0xB7, 0x80, 0x96, 0x00, 0x02,
+    0xD9, 0xD4, 0x7D, 0x44, 0x8B, 0x57, 0xEF, 0xDB, 0x3E, 0xD3, 0xD4, 0xD7, 0xC6, 0xBC, 0xA9, 0xBF,
+    0x2C, 0xBC, 0x36, 0xDF, 0x01, 0x48, 0xB0, 0xBD, 0x7D, 0x9A, 0x26, 0xB4, 0x8B, 0xB9, 0x38, 0xB0,
+    0x22, 0x57, 0xE1, 0x05, 0xDC, 0x29, 0xAE, 0xD5, 0x26, 0x28, 0xD7, 0xE0, 0xD0, 0x0B, 0xED, 0x9C,
+    0x12, 0xC4, 0x04, 0x18, 0x0A, 0x40, 0xB2, 0x1F, 0x0A, 0x16, 0x57, 0xE6, 0x5D, 0x5B, 0xDE, 0x05,
+    0x05, 0xCC, 0x00, 0xC4, 0x9B, 0x56, 0x1F, 0xB6, 0xAA, 0x96, 0xD2, 0x49, 0x39, 0x89, 0xB9, 0xE2,
+    0xD9, 0x48, 0x5B, 0x99, 0x39, 0xCC, 0x2D, 0x65, 0x2D, 0xCF, 0x80, 0xBB, 0x25, 0x1F, 0xDE, 0xE2,
+    0xD2, 0x5F, 0xE0, 0xAA, 0xC4, 0xF5, 0xD9, 0x77, 0xA3, 0xB1, 0xB3, 0x29, 0x6A, 0x53, 0x94, 0x7A,
+    0xD5, 0xB9, 0x9D, 0x53, 0x37, 0xC6, 0x70, 0x01, 0x6F, 0x15, 0xA1, 0x04, 0x85, 0x64, 0x36, 0xB3,
+    0x5E, 0x87, 0x17, 0xED, 0x86, 0xDA, 0xAB, 0x01, 0x08, 0x54, 0xBB, 0x55, 0xF9, 0x09, 0x42, 0xF7,
+    0x1E, 0x17, 0x97, 0x96, 0x61, 0x4C, 0x27, 0x5A, 0x86, 0x41, 0xCA, 0x06, 0x9F, 0x25, 0x55, 0x62,
+    0xC5, 0xBB, 0xE5, 0xBC, 0x52, 0x3D, 0x81, 0xA8, 0x65, 0x2D, 0x34, 0xB7, 0x12, 0x18, 0xE9, 0x1C,
+    0x4D, 0x59, 0x88, 0x29, 0x2B, 0x12, 0xF5, 0xB8, 0xA9, 0xC2, 0x49, 0xD5, 0x1E, 0xD2, 0xC7, 0x86,
+    0xFD, 0xD1, 0xA4, 0xAD, 0xB7, 0x05, 0xF6, 0x38, 0xBA, 0x56, 0x65, 0x05, 0xF9, 0x31, 0x95, 0xE3,
+    0xF2, 0x99, 0xF7, 0x26, 0xC8, 0x80, 0x98, 0x5F, 0x8F, 0x90, 0x02, 0x39, 0xF9, 0x6A, 0x9F, 0x5C,
+    0xC3, 0x9A, 0xA6, 0x5D, 0xB6, 0x43, 0x33, 0xDE, 0x98, 0xBC, 0xE1, 0x87, 0x9F, 0xB2, 0x71, 0xC1,
+    0x80, 0x26, 0x98, 0x23, 0xDA, 0x8C, 0x68, 0xD4, 0x26, 0xEE, 0x83, 0xBD, 0xFA, 0x3F, 0x94, 0x72,
+    0x74, 0xE6, 0xA5, 0xCD, 0x0F, 0xC7, 0xF3, 0xAC, 0xE2, 0xF9, 0x01, 0x54, 0x01, 0x78, 0x66, 0x74,
+    0xA6, 0xEF, 0x4D, 0xE9, 0xD5, 0x89, 0x78, 0x86, 0xC1, 0x4C, 0x3C, 0x25, 0x98, 0x88, 0x27, 0xD5,
+    0x8C, 0x73, 0xC2, 0xF3, 0xD2, 0xE2, 0xD1, 0xF1, 0x70, 0x71, 0x2B, 0xE0, 0x29, 0xF4, 0xA8, 0x78,
+    0x9D, 0x5E, 0x3F, 0x43, 0xCD, 0xCD, 0xE9, 0x8D, 0x3B, 0x6D, 0x88, 0x23, 0xFD, 0x95, 0xFE, 0x62,
+    0x84, 0x0C, 0x98, 0x9E, 0xE6, 0x91, 0xCA, 0x0A, 0xBF, 0x9B, 0x5B, 0x79, 0x04, 0x1F, 0x00, 0x55,
+    0x06, 0x22, 0xEC, 0x97, 0xB6, 0x81, 0xFA, 0x41, 0x45, 0x17, 0x0D, 0x0D, 0x41, 0x78, 0xB1, 0x23,
+    0xD9, 0x12, 0x81, 0x2B, 0x27, 0x0B, 0x4C, 0x64, 0x6C, 0x6D, 0xFF, 0x14, 0x0F, 0x35, 0xEC, 0x76,
+    0xED, 0xBE, 0x01, 0x9B, 0xE0, 0xF8, 0xBE, 0x1A, 0x13, 0x67, 0xB7, 0xCE, 0xC7, 0x43, 0x4A, 0xD3,
+    0x96, 0x76, 0x86, 0x7E, 0x35, 0x6B, 0x3E, 0x53, 0xF7, 0x6A, 0x07, 0x36, 0xF5, 0xCB, 0x3D, 0x1B,
+    0x17, 0x33, 0x66, 0x08, 0x47, 0x6D, 0xE2, 0x21, 0xDC, 0xAB, 0xAF, 0x28, 0x5B, 0xF1, 0x0E, 0x5C,
+    0x64, 0x23, 0x30, 0x3C, 0x31, 0x89, 0x76, 0xFE, 0x86, 0x24, 0x49, 0x38, 0xEC, 0x5B, 0xF4, 0xE0,
+    0x8C, 0x92, 0xAB, 0x37, 0x02, 0x0B, 0x41, 0x14, 0x16, 0x40, 0x10, 0x63, 0xC4, 0x0F, 0x29, 0xBA,
+    0x9A, 0xDE, 0x7B, 0xF4, 0xB2, 0xD1, 0x20, 0xEC, 0x84, 0xE9, 0xB7, 0x06, 0xA8, 0xDF, 0x88, 0x58,
+    0x65, 0x8E, 0x19, 0xD7, 0xEC, 0xCC, 0x85, 0x6C, 0xED, 0xA9, 0xC9, 0xC4, 0x27, 0xE2, 0xC3, 0x35,
+    0x30, 0xB7, 0x57, 0x2E, 0x8D, 0x3A, 0xC7, 0x25, 0x39, 0xF4, 0xAB, 0x15, 0x01, 0x37, 0xAA, 0x4E,
+    0x4C, 0xFA, 0xAD, 0x06, 0x1E, 0xB3, 0x06, 0x58, 0x23, 0x4D, 0x70, 0x3A, 0x72, 0xB8, 0x74, 0xA8,
+    0x2D, 0x07, 0x23, 0x0A, 0x1A, 0x02, 0x01, 0x09, 0x0E, 0x5D, 0x37, 0x19, 0x86, 0x70, 0x36, 0x1D,
+    0x55, 0xA9, 0x26, 0x46, 0x22, 0x6E, 0xD6, 0x70, 0xC6, 0xD1, 0x3D, 0x39, 0x57, 0x24, 0x84, 0x36,
+    0x9D, 0xB7, 0x5F, 0x73, 0x16, 0x3A, 0x04, 0xC3, 0xC5, 0x00, 0xB3, 0xEE, 0x48, 0x51, 0xD9, 0x69,
+    0x30, 0x39, 0xD0, 0x59, 0xE4, 0xC4, 0xE2, 0xEC, 0xC7, 0x8A, 0x50, 0xBB, 0x0A, 0x06, 0x7D, 0x94,
+    0x27, 0x99, 0x1A, 0x04, 0xF5, 0x89, 0x0F, 0x34, 0xFE, 0xCF, 0x2A, 0xFA, 0xF5, 0xA8, 0xDE, 0x8D,
+    0x7E, 0x30, 0x9E, 0x48, 0x45, 0xD6, 0x99, 0x66, 0xAD, 0x27, 0x0F, 0x34, 0xFF, 0x55, 0x7E, 0xE6,
+    0x80, 0x41, 0x19, 0xFC, 0x80, 0x06, 0xEE, 0xEC, 0xF0, 0x0A, 0x71, 0x78, 0x41, 0xDE, 0x92, 0x87,
+    0x01, 0xFF, 0xA4, 0x85, 0x09, 0x5B, 0x78, 0xEE, 0x61, 0xDA, 0xC1, 0x28, 0xC0, 0x0C, 0x07, 0x0F,
+    0x3A, 0xFE, 0xB9, 0x7A, 0x64, 0x06, 0xDB, 0x12, 0x5C, 0x27, 0x3E, 0x61, 0xF7, 0xE2, 0x1A, 0x7A,
+    0x0C, 0x1F, 0x20, 0x6C, 0xF5, 0x0B, 0xCD, 0x71, 0x9C, 0x8A, 0x49, 0xB6, 0xB4, 0x66, 0x69, 0xCB,
+    0xAF, 0xDD, 0x87, 0x88, 0x2D, 0xA4, 0xFE, 0xDC, 0xC7, 0x72, 0x70, 0x92, 0x95, 0x6A, 0x46, 0xA0,
+    0x6D, 0xB4, 0xB4, 0x31, 0x7C, 0xD8, 0xDF, 0xB6, 0x0B, 0xE0, 0x1E, 0x70, 0x6E, 0xE4, 0x59, 0xBE,
+    0x35, 0x9D, 0x6F, 0xCB, 0x36, 0x70, 0x5F, 0xEF, 0x69, 0xFE, 0xA8, 0xFD, 0x9D, 0x6F, 0xC3, 0xA5,
+    0x8D, 0x96, 0x36, 0x21, 0xCE, 0xCA, 0x02, 0xD1, 0x71, 0x33, 0x1A, 0x50, 0xC6, 0x9C, 0x9D, 0x6F,
+    0xCB, 0xA5, 0x85, 0xA3, 0x0C, 0x3C, 0x7E, 0x6A, 0x76, 0x6B, 0x44, 0xD2, 0x29, 0xAD, 0x36, 0x62,
+    0x1B, 0x45, 0x00, 0xB9, 0x70, 0xBF, 0xD5, 0x25, 0xD0, 0xDB, 0x13, 0x34, 0xBC, 0x5E, 0xAE, 0x34,
+    0x6B, 0x26, 0x0F, 0xC4, 0x74, 0xB7, 0x00, 0xFD, 0xAA, 0x8B, 0x76, 0xCE, 0xB8, 0x36, 0xA9, 0x2E,
+    0x8A, 0x6B, 0x83, 0x3F, 0x12, 0xC1, 0x5E, 0x14, 0xE4, 0x04, 0x5B, 0x9A, 0x9E, 0x66, 0xBB, 0x3E,
+    0x26, 0x58, 0x72, 0x58, 0xF5, 0xA4, 0x08, 0x22, 0x25, 0xB8, 0x46, 0xE0, 0x38, 0x22, 0x30, 0x7B,
+    0xF6, 0x9C, 0x1F, 0x2E, 0xE6, 0x68, 0x5C, 0x5A, 0xBA, 0x48, 0x0D, 0x64, 0xFD, 0x8F, 0x0B, 0x70,
+    0xE0, 0x06, 0x23, 0xD9, 0xED, 0xC0, 0xCD, 0x67, 0x60, 0xE4, 0xFA, 0x06, 0x33, 0x6F, 0xEA, 0xB3,
+    0xBA, 0x0F, 0x8D, 0x27, 0x01, 0x18, 0x4F, 0x1F, 0x9B, 0x8E, 0x9E, 0x56, 0x70, 0x36, 0x98, 0xE4,
+    0xE8, 0xE6, 0x3F, 0xBB, 0xAB, 0x6E, 0x30, 0xC2, 0x02, 0xA5, 0xFF, 0x75, 0x08, 0x9D, 0xEB, 0xEA,
+    0x12, 0x5C, 0xF0, 0x91, 0xCD, 0xCF, 0xE5, 0xB4, 0xA6, 0x30, 0x2D, 0x12, 0x6B, 0xDC, 0x99, 0x2D,
+    0x8B, 0x40, 0x73, 0xB9, 0xA3, 0x99, 0x1F, 0xFE, 0x10, 0x72, 0xA5, 0x9A, 0x5A, 0x30, 0xBF, 0x4A,
+    0x96, 0x2C, 0x30, 0x77, 0x33, 0xB4, 0x0C, 0xD7, 0xD3, 0x30, 0x16, 0xF8, 0xF0, 0x5E, 0xAE, 0xC4,
+    0x0D, 0xFE, 0x5B, 0x5C, 0xF2, 0xD8, 0x27, 0x9C, 0xA0, 0x86, 0x8A, 0x15, 0x31, 0x0B, 0x21, 0x2B,
+    0xC3, 0xE8, 0x06, 0xA8, 0x03, 0xAE, 0x1D, 0xD7, 0x46, 0xCC, 0x68, 0xEF, 0xE1, 0xCA, 0x89, 0xFA,
+    0xE8, 0x2F, 0xF5, 0x88, 0x40, 0x31, 0x84, 0xBD, 0x4A, 0xE0, 0x0B, 0x11, 0xD0, 0x37, 0xA6, 0xD8,
+    0xF7, 0x83, 0xC9, 0x52, 0xB8, 0xE0, 0xBD, 0x45, 0x8F, 0x49, 0x19, 0xFB, 0x01, 0x37, 0xBD, 0xEE,
+    0x6A, 0x3C, 0xDE, 0xCA, 0xAB, 0x02, 0xA9, 0xA5, 0x75, 0x05, 0x6F, 0xC6, 0xCD, 0xC7, 0x36, 0x1C,
+    0x00, 0xF8, 0x48, 0x73, 0xA5, 0x37, 0x59, 0x29, 0xB7, 0x5D, 0x98, 0xBB, 0xBB, 0xC1, 0xDB, 0xF5,
+    0x78, 0xC6, 0xD7, 0x75, 0xCE, 0x79, 0x13, 0xB5, 0xAB, 0x70, 0x50, 0x48, 0x93, 0xBB, 0x5D, 0x23,
+    0x1E, 0xA5, 0xD5, 0xB5, 0x11, 0x2B, 0x62, 0xE4, 0x32, 0xCC, 0x2C, 0xA1, 0xE9, 0x3D, 0x84, 0x41,
+    0x2A, 0xCC, 0x70, 0x33, 0x7C, 0xC2, 0x6D, 0xAF, 0xFA, 0x74, 0xEB, 0xAF, 0xFC, 0x08, 0x3A, 0x5A,
+    0x50, 0x22, 0x61, 0x5D, 0x1B, 0x76, 0x3F, 0x63, 0x45, 0x78, 0x65, 0x4D, 0x76, 0x3A, 0xB0, 0xA8,
+    0x62, 0xDC, 0x45, 0xAB, 0xD5, 0x33, 0x58, 0x21, 0xA4, 0xA9, 0x78, 0xDE, 0x07, 0x57, 0x0E, 0x3A,
+    0x48, 0xDA, 0x21, 0xF0, 0x6D, 0x54, 0x38, 0x2B, 0x54, 0x41, 0x54, 0xBB, 0x6C, 0x69, 0xC8, 0x00,
+    0xEB, 0x8E, 0xB0, 0x1C, 0x08, 0x7F, 0x3E, 0x12, 0xBE, 0xEA, 0x08, 0x5F, 0x56, 0x9E, 0x9F, 0x42,
+    0x24, 0x0D, 0xCE, 0xBB, 0x06, 0xB0, 0x82, 0x0B, 0x01, 0x04, 0x25, 0x80, 0xE9, 0x48, 0x98, 0x38,
+    0xC2, 0xC8, 0xD5, 0x80, 0x01, 0xB5, 0x83, 0xC5, 0x28, 0xC2, 0x52, 0x61, 0xAE, 0x30, 0x55, 0x88,
+    0x60, 0x1C, 0xF6, 0xA8, 0x50, 0xF7, 0xA7, 0x16, 0x40, 0x8D, 0xAF, 0x9A, 0xA6, 0xA5, 0x3A, 0x28,
+    0xCC, 0x52, 0x0E, 0xFC, 0x60, 0xDF, 0x2B, 0xF5, 0x4C, 0x83, 0xAF, 0x13, 0x7A, 0xB7, 0x81, 0x5C,
+    0xED, 0x4A, 0xEC, 0xDA, 0x14, 0xB4, 0xB8, 0x8E, 0xF6, 0xD5, 0x0C, 0xEA, 0x7E, 0x47, 0x1A, 0xF1,
+    0x6C, 0xA4, 0x3D, 0x4F, 0xA7, 0x05, 0x76, 0x1B, 0x70, 0xF3, 0x39, 0x0B, 0x50, 0xA3, 0xFF, 0xCA,
+    0x8F, 0x40, 0x8B, 0x5F, 0xF7, 0x18, 0x16, 0x09, 0xA4, 0x3A, 0x25, 0xAB, 0xAE, 0xAA, 0xA0, 0xD5,
+    0x1F, 0xD5, 0x5F, 0xED, 0xEE, 0xD7, 0x9F, 0x9E, 0xFA, 0x44, 0xB1, 0x55, 0x4B, 0xAE, 0x62, 0xAA,
+    0xC5, 0x3E, 0x56, 0x07, 0x68, 0x71, 0x1A, 0x79, 0x28, 0xA8, 0x78, 0xEA, 0x9C, 0xAE, 0x82, 0x0F,
+    0x4B, 0xB4, 0x9E, 0x3B, 0x6B, 0x0D, 0x68, 0x60, 0xBC, 0x9E, 0x35, 0x9B, 0xE9, 0xCD, 0x83, 0xBC,
+    0x16, 0xBE, 0x24, 0x50, 0x7C, 0x4A, 0x37, 0x7B, 0x63, 0xD4, 0x78, 0x86, 0xC3, 0xFE, 0x99, 0xE6,
+    0x3F, 0x93, 0xE7, 0x8A, 0x87, 0x87, 0x8A, 0xA8, 0x4F, 0x1B, 0x86, 0x82, 0xE4, 0xBF, 0x87, 0x71,
+    0xAF, 0x36, 0xBD, 0x08, 0xE4, 0x21, 0xA1, 0xE2, 0x71, 0x09, 0xE0, 0x6F, 0xE3, 0x8E, 0xB1, 0x6A,
+    0xDE, 0x97, 0x6D, 0x32, 0xBB, 0x4A, 0x73, 0x29, 0xC6, 0xEA, 0xD0, 0x17, 0x46, 0xBE, 0x08, 0x3C,
+    0x8B, 0x0C, 0x31, 0x2E, 0xA2, 0xDA, 0xAE, 0xAC, 0x92, 0xE1, 0x39, 0x09, 0x5B, 0x58, 0xF5, 0x8D,
+    0x85, 0x8A, 0x94, 0xC2, 0xDF, 0x36, 0x1A, 0x93, 0x5A, 0x1F, 0x3A, 0x1E, 0xA2, 0x30, 0x52, 0x0A,
+    0x53, 0x47, 0x0A, 0x73, 0x47, 0x0A, 0xCD, 0xEF, 0x49, 0xA1, 0x23, 0x25, 0xE1, 0x48, 0xDA, 0xA2,
+    0x81, 0x30, 0xED, 0xF8, 0x24, 0xB7, 0x84, 0xA6, 0x22, 0x85, 0x8E, 0x14, 0xCE, 0x23, 0x29, 0xA4,
+    0xBD, 0x07, 0x85, 0xDD, 0x2D, 0x29, 0xE4, 0x8C, 0xA3, 0x44, 0x37, 0x48, 0x61, 0xD0, 0x6D, 0xAC,
+    0x93, 0x4F, 0x73, 0x7D, 0xC6, 0x92, 0xCC, 0x8B, 0xFC, 0xA9, 0x41, 0xB0, 0x3E, 0x83, 0x39, 0xB8,
+    0x58, 0x88, 0xE3, 0xE1, 0xFF, 0xD5, 0xBD, 0xFD, 0x58, 0x10, 0xD9, 0x36, 0x68, 0x87, 0x11, 0x62,
+    0xB8, 0xE1, 0xB8, 0x71, 0x90, 0xAB, 0x27, 0x25, 0xFE, 0x1A, 0xBA, 0x8A, 0x92, 0x05, 0x7E, 0xAA,
+    0xB6, 0xFB, 0xBD, 0x80, 0x50, 0x8D, 0xB1, 0x46, 0xC9, 0x3E, 0x8A, 0xD5, 0xF2, 0x04, 0xBA, 0xF2,
+    0xF1, 0x61, 0xED, 0x7F, 0x60, 0xA9, 0xD8, 0xF3, 0xC9, 0x48, 0xAB, 0xE1, 0x08, 0x91, 0xCE, 0xBE,
+    0x9D, 0x74, 0x29, 0x48, 0xC6, 0xCC, 0x7A, 0xD2, 0xC3, 0x40, 0xC5, 0x52, 0x63, 0xBC, 0xB4, 0xC6,
+    0xDC, 0x43, 0x63, 0x59, 0xF4, 0x3C, 0x76, 0x20, 0xE8, 0x79, 0x80, 0xA9, 0x08, 0x96, 0xC5, 0x50,
+    0xB9, 0xD2, 0xE7, 0xB9, 0xFA, 0xF8, 0x5A, 0x13, 0xC8, 0xE9, 0x70, 0xFA, 0x4E, 0x2A, 0x10, 0x53,
+    0x30, 0x3D, 0xC2, 0x2C, 0x10, 0x44, 0xC4, 0x02, 0xC8, 0x5A, 0xB9, 0x39, 0xC3, 0xB8, 0x87, 0x5B,
+    0x95, 0xE8, 0xC0, 0x60, 0xC1, 0x7D, 0xCE, 0xB9, 0xEA, 0x7F, 0x28, 0x4F, 0xBE, 0xA5, 0xAF, 0xF5,
+    0xF3, 0xA6, 0x9A, 0x4E, 0xC7, 0x9A, 0x0E, 0x7A, 0x19, 0x08, 0x7C, 0xD4, 0x78, 0x3F, 0x50, 0xFF,
+    0x3A, 0x0C, 0xDC, 0x5C, 0x68, 0x58, 0x2F, 0x4A, 0xBA, 0xC6, 0x65, 0x48, 0xAD, 0x9D, 0x68, 0xE0,
+    0x47, 0x50, 0x70, 0xD7, 0xA0, 0x58, 0xFE, 0xD2, 0x67, 0x7C, 0xCB, 0xFA, 0xEC, 0xEA, 0x8B, 0x76,
+    0x19, 0xA5, 0x91, 0x5B, 0xCF, 0x21, 0xC1, 0xF6, 0x12, 0xB4, 0xFB, 0xA4, 0xBC, 0x50, 0xB3, 0xD7,
+    0x20, 0xC0, 0xFB, 0x08, 0x84, 0xC1, 0x68, 0xD6, 0x2C, 0x53, 0x33, 0x5C, 0x62, 0xCD, 0x58, 0x21,
+    0xAB, 0xD7, 0x4D, 0xC4, 0x5D, 0xD9, 0x86, 0x9B, 0x84, 0x75, 0x63, 0xB4, 0x3E, 0xE0, 0xF7, 0x7C,
+    0x6B, 0xEE, 0xFE, 0x36, 0xA5, 0x3E, 0xCF, 0x69, 0x3E, 0x9B, 0x84, 0xDB, 0xB1, 0x0D, 0x6D, 0x6F,
+    0xCD, 0xEA, 0x2B, 0x61, 0xAC, 0x10, 0x48, 0x2B, 0xC4, 0xDF, 0xD7, 0x7F, 0x41, 0x48, 0xFA, 0x08,
+    0x47, 0x8E, 0xA3, 0x18, 0xB3, 0xB2, 0x29, 0x7B, 0xB4, 0xF1, 0x2C, 0x1F, 0x70, 0x7D, 0x56, 0xD1,
+    0x8E, 0xAE, 0x6A, 0xB6, 0xD2, 0xAF, 0xE3, 0x6F, 0x92, 0xF9, 0x40, 0x38, 0x59, 0xC9, 0x88, 0x84,
+    0xDF, 0x24, 0x7E, 0x9B, 0xB8, 0x10, 0x9F, 0xD4, 0x23, 0xC3, 0x0F, 0x18, 0xB0, 0xB2, 0x4C, 0x51,
+    0x19, 0x77, 0x15, 0xAB, 0xDF, 0xE3, 0x05, 0xF3, 0x97, 0xAA, 0x6E, 0x42, 0xFE, 0x15, 0xE3, 0xD9,
+    0xF5, 0x1D, 0xBE, 0x45, 0x97, 0xCC, 0x8D, 0x65, 0x05, 0xC3, 0x6C, 0x2A, 0xF9, 0xA9, 0x4E, 0xF2,
+    0xD8, 0xF9, 0x95, 0xE1, 0x55, 0x64, 0xB4, 0x80, 0x40, 0x39, 0xD8, 0x4F, 0x49, 0x8E, 0x02, 0x8D,
+    0xAD, 0xF3, 0x2A, 0x80, 0x94, 0x45, 0x95, 0x9B, 0x8B, 0x50, 0x97, 0x09, 0xF9, 0x57, 0xDC, 0xAD,
+    0x65, 0xFC, 0x48, 0xB8, 0xE1, 0x4D, 0xB6, 0xC1, 0x68, 0xF3, 0x25, 0xCE, 0x01, 0x0C, 0xFE, 0x5E,
+    0xF7, 0x12, 0xDB, 0x64, 0xF7, 0x88, 0xD1, 0x08, 0xC6, 0x08, 0xC6, 0x62, 0x4E, 0x46, 0x0F, 0x82,
+    0x89, 0x45, 0x8E, 0x13, 0x6B, 0x97, 0x7E, 0x24, 0x8B, 0x32, 0xAC, 0x17, 0x65, 0x87, 0xE5, 0xCE,
+    0x64, 0x05, 0xCC, 0x45, 0x35, 0x53, 0x07, 0x7C, 0xDA, 0x51, 0x20, 0x74, 0xFC, 0x9C, 0x1C, 0xFF,
+    0x9D, 0x06, 0x48, 0x0D, 0x75, 0x1A, 0xC3, 0x7C, 0xE7, 0xB4, 0x16, 0xE2, 0x34, 0xAF, 0x0B, 0xAF,
+    0x70, 0x13, 0xCB, 0xD7, 0x01, 0x2D, 0x77, 0x4B, 0x68, 0xEB, 0x34, 0x0D, 0x7A, 0x42, 0x5B, 0xCE,
+    0xAD, 0x87, 0x18, 0x9C, 0x6F, 0x8D, 0xBB, 0xA0, 0x6D, 0xD9, 0x2B, 0x8A, 0xB0, 0x08, 0x7E, 0x8F,
+    0xB5, 0x6E, 0xFD, 0x8E, 0x01, 0xB1, 0x69, 0xE5, 0x11, 0x21, 0x42, 0xF3, 0x6B, 0x7A, 0x02, 0xE2,
+    0x32, 0x89, 0x83, 0x2D, 0x89, 0x3C, 0x91, 0xC8, 0xF0, 0x98, 0x44, 0x9E, 0x5C, 0x74, 0x3A, 0xF8,
+    0x15, 0x37, 0xA2, 0x07, 0xE0, 0x37, 0x26, 0x7A, 0x7E, 0x64, 0xAF, 0x83, 0x66, 0x9D, 0xD0, 0xAD,
+    0x8A, 0xCE, 0x2B, 0x58, 0xB9, 0x79, 0x66, 0xA4, 0xF3, 0x95, 0xB2, 0x7C, 0x92, 0x67, 0x52, 0x77,
+    0x8D, 0xDF, 0x8C, 0xFC, 0x56, 0x0F, 0x4A, 0xF0, 0x1C, 0x00, 0xF7, 0x7A, 0xB5, 0xD0, 0xC5, 0xBD,
+    0x1B, 0x6E, 0x07, 0x71, 0xF3, 0xC9, 0xF9, 0xD0, 0xE2, 0x2E, 0xEC, 0x47, 0xF0, 0x07, 0x76, 0xE1,
+    0x58, 0x1C, 0x34, 0x51, 0xD2, 0x67, 0xD8, 0xA7, 0x9C, 0x15, 0x12, 0xC3, 0x1C, 0x95, 0xA0, 0x29,
+    0x69, 0x1A, 0x37, 0xC0, 0xC1, 0x2A, 0x1E, 0x08, 0x08, 0xC0, 0xB1, 0x0F, 0xEB, 0x42, 0x0D, 0x69,
+    0xB0, 0x04, 0xAA, 0xD3, 0xCA, 0x43, 0xDD, 0xD9, 0x7E, 0x1C, 0x05, 0x1A, 0x77, 0x61, 0x3F, 0x8E,
+    0x84, 0x1B, 0x77, 0x56, 0xDC, 0x23, 0x40, 0xE3, 0xD9, 0x73, 0x94, 0x09, 0x0A, 0x0E, 0x78, 0x91,
+    0xB7, 0x64, 0x82, 0x8F, 0x4E, 0xA9, 0x05, 0xF7, 0x7C, 0x1D, 0xDA, 0xA8, 0xAF, 0x37, 0x62, 0x8D,
+    0xFB, 0xB8, 0x7C, 0xFD, 0xB2, 0xF7, 0xF5, 0xCB, 0x1B, 0xAC, 0x5F, 0x96, 0xB6, 0x94, 0xB4, 0xD9,
+    0x0C, 0x61, 0xFE, 0x2F, 0x37, 0x77, 0xBC, 0x27, 0xE7, 0x0F, 0xE6, 0xBC, 0xB4, 0x7F, 0x30, 0xE7,
+    0x3E, 0x79, 0xA0, 0xD1, 0x62, 0x5A, 0xBD, 0x03, 0xD6, 0xDF, 0x98, 0x97, 0x50, 0x29, 0x64, 0x74,
+    0x94, 0xF8, 0xFA, 0x3E, 0xE4, 0x3F, 0xFB, 0x00, 0x2F, 0x1E, 0xF5, 0x96, 0x04, 0x7C, 0xDF, 0x41,
+    0xE6, 0xCF, 0x74, 0xA7, 0xE5, 0x12, 0x77, 0x19, 0x4C, 0x0D, 0xCF, 0x91, 0x69, 0xF5, 0x5D, 0xB7,
+    0x0D, 0xCC, 0x61, 0xC0, 0x17, 0x2D, 0xBB, 0x34, 0x99, 0x7B, 0x9D, 0x45, 0x49, 0x9F, 0x83, 0x32,
+    0x6F, 0xD4, 0xA8, 0xE1, 0xCC, 0x9A, 0x43, 0xD5, 0x8B, 0x2C, 0xEB, 0x4D, 0xDE, 0x3F, 0x25, 0x5F,
+    0x82, 0x9B, 0x49, 0xF5, 0xF4, 0x7A, 0x2B, 0xF0, 0xA9, 0x42, 0xEA, 0x5F, 0xC3, 0x32, 0xD5, 0x5F,
+    0x38, 0x27, 0xCB, 0x79, 0x8E, 0x8F, 0x9C, 0xAD, 0x07, 0xC4, 0x71, 0x88, 0x63, 0x78, 0x4C, 0xC2,
+    0x1F, 0x98, 0xB8, 0xA7, 0x73, 0x16, 0x0B, 0xF0, 0x89, 0x9A, 0x56, 0xF6, 0x75, 0x23, 0xD2, 0x93,
+    0xAB, 0x49, 0xDA, 0x3A, 0x47, 0x0B, 0xDE, 0xDC, 0x97, 0xF0, 0x49, 0x25, 0xBC, 0x48, 0x49, 0x11,
+    0x84, 0xD6, 0x35, 0x66, 0x39, 0x1C, 0xB4, 0xA2, 0xBC, 0x5D, 0x83, 0xD5, 0x51, 0x32, 0xEE, 0xAC,
+    0xD4, 0xAD, 0x76, 0x4E, 0xC1, 0x35, 0x1E, 0xC7, 0x62, 0x35, 0xCF, 0x33, 0xA2, 0x5D, 0x18, 0x11,
+    0xEE, 0x69, 0xA8, 0x5A, 0x2D, 0xCF, 0xEA, 0xCB, 0xCC, 0x83, 0x61, 0x77, 0xA2, 0x61, 0xFF, 0x4C,
+    0xC3, 0x11, 0xA0, 0xB1, 0xA4, 0x0E, 0x19, 0x42, 0xD1, 0xB9, 0xE6, 0x44, 0xB3, 0x44, 0x5D, 0x0D,
+    0xCD, 0x6F, 0xE2, 0xDD, 0xA3, 0x46, 0xE3, 0xB3, 0x90, 0xFB, 0x3B, 0xD1, 0xE8, 0x19, 0x21, 0x33,
+    0x37, 0x50, 0xF6, 0x4F, 0xA3, 0x1D, 0xC9, 0xA2, 0x68, 0xC6, 0x38, 0xAC, 0x2A, 0x90, 0xFA, 0x57,
+    0xB4, 0x72, 0x03, 0xB7, 0x39, 0xEA, 0x45, 0xD4, 0x76, 0x57, 0x67, 0x91, 0xF4, 0x0B, 0x05, 0x7E,
+    0x47, 0xA7, 0xD8, 0xC7, 0xFE, 0x27, 0xC4, 0xDE, 0x17, 0x10, 0x74, 0x4B, 0x0E, 0x2A, 0x08, 0xA1,
+    0x36, 0x43, 0x4C, 0xEC, 0x53, 0xD7, 0x02, 0x7F, 0x07, 0x9C, 0x4B, 0xE8, 0x56, 0x3B, 0x03, 0xF1,
+    0x7F, 0x8E, 0x00, 0xFF, 0xE6, 0x31, 0x4F, 0x84, 0x0F, 0x00, 0x16, 0xD8, 0xBB, 0x80, 0xD8, 0x5F,
+    0x5C, 0xB0, 0xD7, 0x93, 0x09, 0x29, 0xB3, 0x82, 0xD0, 0xAE, 0x99, 0xA8, 0x5E, 0xB5, 0x5E, 0x7B,
+    0xD5, 0x78, 0x5E, 0x67, 0xEF, 0x07, 0xB2, 0x5E, 0xE6, 0x0B, 0xF6, 0x7E, 0x01, 0xA2, 0x0C, 0xCB,
+    0xE2, 0x88, 0x2D, 0x5D, 0x0D, 0x12, 0x74, 0x7B, 0xD1, 0xCD, 0x86, 0x27, 0xA5, 0x8C, 0x95, 0xE3,
+    0x87, 0xA2, 0x72, 0xDA, 0xB2, 0x60, 0xDF, 0xAB, 0x1E, 0x28, 0x84, 0xFC, 0xD8, 0x68, 0x2C, 0x5E,
+    0x55, 0x25, 0x87, 0x5E, 0x75, 0xA7, 0x05, 0x16, 0x58, 0x9F, 0xA4, 0xDD, 0xDC, 0xF2, 0xFA, 0xF1,
+    0xB9, 0xA1, 0x5E, 0x35, 0xA6, 0x4B, 0x87, 0x0F, 0x52, 0x10, 0x8E, 0x07, 0xBD, 0xEA, 0x91, 0xA0,
+    0xA1, 0xA7, 0x49, 0xB4, 0xB8, 0xA3, 0x4E, 0x98, 0xA7, 0xC5, 0x02, 0xDD, 0x6F, 0x1E, 0x0E, 0xE5,
+    0xE0, 0xD9, 0x08, 0xC5, 0xC9, 0x7B, 0x55, 0x1C, 0x1E, 0x7C, 0x6A, 0x53, 0x26, 0x7F, 0x3C, 0x1D,
+    0x6B, 0xE3, 0x39, 0x60, 0x71, 0xDF, 0x1F, 0x91, 0xA5, 0x87, 0xFE, 0x00, 0x9C, 0xAC, 0xFF, 0xC2,
+    0xFD, 0x04, 0x7F, 0x4E, 0x96, 0xF1, 0x20, 0x7D, 0x4A, 0xEA, 0xBD, 0x8B, 0x15, 0x3D, 0xF1, 0xE2,
+    0x2B, 0x00, 0x1A, 0xE4, 0xA9, 0x4C, 0xAA, 0x82, 0x95, 0xDC, 0x82, 0xF4, 0xFE, 0x87, 0xFB, 0xDA,
+    0xEC, 0xA1, 0x45, 0xA7, 0x93, 0x85, 0xDC, 0xF9, 0xA4, 0xDB, 0x93, 0x70, 0x13, 0x5F, 0xB1, 0x4C,
+    0x77, 0x99, 0x39, 0x2C, 0x15, 0xA2, 0x9E, 0x2F, 0x42, 0x2F, 0x79, 0x66, 0x8F, 0x1E, 0xC2, 0xFA,
+    0x23, 0x75, 0x87, 0xDC, 0x44, 0xEB, 0x81, 0x77, 0x22, 0xF0, 0x29, 0x11, 0x0F, 0x07, 0x41, 0x25,
+    0xFD, 0x00, 0x97, 0x99, 0xE4, 0xFE, 0xD5, 0xB1, 0xD3, 0xC9, 0xBB, 0x3B, 0x6B, 0xE7, 0x4F, 0xE1,
+    0x78, 0xCB, 0x35, 0x2D, 0x96, 0xCB, 0x85, 0x6A, 0xB9, 0x4E, 0x3C, 0x50, 0x3C, 0xFD, 0x1F, 0xD5,
+    0x5C, 0xBF, 0x8F, 0xDD, 0xD8, 0x75, 0xBE, 0xE4, 0xCB, 0x0C, 0x01, 0xB1, 0xE0, 0x16, 0x9E, 0x18,
+    0x2B, 0x01, 0x66, 0x9B, 0x6C, 0x0A, 0xFE, 0x05, 0x36, 0xE9, 0x0D, 0x10, 0x17, 0x2E, 0x76, 0x0A,
+    0x3D, 0x6F, 0x91, 0xC2, 0x2E, 0x6C, 0xC0, 0xAB, 0x66, 0xEA, 0x00, 0x89, 0xC8, 0xC4, 0x45, 0x8A,
+    0x34, 0x53, 0x64, 0xAB, 0x14, 0x51, 0x00, 0x19, 0xD0, 0x8E, 0x0A, 0x35, 0x69, 0x12, 0x18, 0x22,
+    0x15, 0x97, 0x2E, 0x96, 0x9B, 0xC5, 0xC2, 0x45, 0x8A, 0x65, 0xB4, 0x0B, 0x38, 0x58, 0x15, 0xC3,
+    0x00, 0xDC, 0x98, 0x23, 0x93, 0x3C, 0x39, 0xDF, 0x77, 0x49, 0xBE, 0xF7, 0x46, 0x1A, 0x69, 0x46,
+    0x3B, 0x33, 0x1A, 0x8D, 0x1E, 0x0F, 0xDF, 0xE3, 0x8F, 0x7B, 0xCF, 0xFD, 0xEE, 0x8F, 0xF3, 0xF3,
+    0xCA, 0x6C, 0x2D, 0x97, 0x89, 0x31, 0x81, 0x48, 0xB1, 0x49, 0x37, 0xFE, 0xF2, 0x16, 0x54, 0x3A,
+    0x25, 0x8E, 0xF4, 0x4A, 0x17, 0x22, 0xA0, 0x03, 0xA8, 0xDF, 0x49, 0xA6, 0x6F, 0x75, 0x7C, 0xB7,
+    0xCD, 0x95, 0x46, 0x4D, 0x5C, 0x19, 0x13, 0xD7, 0x71, 0x6D, 0x4C, 0x5A, 0x45, 0x8D, 0x16, 0x50,
+    0x86, 0x5A, 0x84, 0x14, 0x41, 0xA7, 0x05, 0x64, 0x7E, 0x6F, 0x5C, 0x11, 0x19, 0x50, 0x8C, 0x16,
+    0xE4, 0x81, 0x26, 0x3E, 0x68, 0x11, 0x0C, 0xCB, 0x1F, 0x49, 0x11, 0x6A, 0x4D, 0x52, 0xC6, 0xFA,
+    0x4A, 0x5E, 0xC7, 0xFA, 0x7A, 0x5A, 0xA7, 0x5A, 0x54, 0xDC, 0x8A, 0x16, 0x1B, 0x75, 0xCE, 0x72,
+    0x79, 0x13, 0x05, 0xB4, 0x96, 0x38, 0x22, 0xCD, 0xC8, 0xE7, 0xD6, 0xCF, 0xC0, 0xA0, 0xD4, 0x46,
+    0x0B, 0xEB, 0x58, 0xBA, 0x71, 0xBF, 0xF6, 0x45, 0x1B, 0xE8, 0x82, 0x38, 0x60, 0xF4, 0x47, 0x92,
+    0x39, 0xB9, 0x28, 0x13, 0x7A, 0x37, 0x8B, 0xE5, 0x89, 0x64, 0x69, 0xA3, 0x37, 0xF2, 0x0A, 0xA4,
+    0x74, 0xF1, 0xCD, 0xD3, 0x6B, 0x47, 0x7B, 0xB8, 0xAB, 0x8F, 0x84, 0xD2, 0xA5, 0x99, 0x27, 0x55,
+    0x9C, 0x99, 0x6F, 0xA1, 0x8E, 0xEB, 0xC6, 0xB9, 0x63, 0x4C, 0x98, 0x79, 0xCA, 0x51, 0xF0, 0x34,
+    0x57, 0x8E, 0x3C, 0x02, 0xE6, 0x10, 0x12, 0x73, 0xE3, 0x4B, 0x73, 0xA5, 0xC1, 0x73, 0xEF, 0x98,
+    0x3F, 0x35, 0x8B, 0xDA, 0x3C, 0xD4, 0x52, 0x1E, 0xE0, 0x49, 0x80, 0x17, 0x4B, 0x69, 0xCC, 0xF6,
+    0x91, 0xB9, 0x44, 0x18, 0xAF, 0x18, 0x2C, 0xE0, 0x25, 0x28, 0x41, 0xE3, 0x04, 0x34, 0x25, 0x8F,
+    0x03, 0xA9, 0xDC, 0x5C, 0xF1, 0x1B, 0x93, 0x6E, 0xDF, 0xBD, 0x78, 0x8C, 0x1E, 0x6A, 0x3D, 0x2E,
+    0x6A, 0xD3, 0xCE, 0x52, 0x40, 0x48, 0xBE, 0x4E, 0x30, 0xDA, 0x0A, 0x60, 0x85, 0x29, 0x7A, 0x0B,
+    0xAC, 0xDE, 0xBA, 0x03, 0x16, 0x4B, 0x5C, 0xC3, 0x44, 0x46, 0x4B, 0xA2, 0x6A, 0x6E, 0xC7, 0xF4,
+    0xA7, 0x7C, 0xEC, 0x63, 0x66, 0x77, 0x26, 0x55, 0xA2, 0x8C, 0x4B, 0xBB, 0x90, 0x66, 0xBB, 0x06,
+    0xC7, 0x6F, 0x05, 0x68, 0x27, 0x31, 0x60, 0xF3, 0x80, 0x8E, 0x01, 0xCE, 0xCF, 0x90, 0x66, 0x7A,
+    0x84, 0x0F, 0x87, 0xE8, 0xB5, 0x80, 0xDD, 0x25, 0x95, 0xF3, 0xAF, 0xC0, 0xA0, 0x31, 0x24, 0x11,
+    0xC8, 0xB6, 0x80, 0xAB, 0xAD, 0x5D, 0xBD, 0x7F, 0xED, 0x9E, 0x7D, 0x4F, 0x67, 0x0B, 0xD0, 0xF1,
+    0xF4, 0xED, 0xA0, 0x1A, 0x19, 0xFB, 0xC0, 0x98, 0x3D, 0x69, 0xB5, 0xEF, 0x3A, 0x85, 0xA9, 0x0D,
+    0xE4, 0xA0, 0xD6, 0xC2, 0xDF, 0x42, 0x55, 0xEC, 0x6A, 0x76, 0xF7, 0x78, 0xD4, 0xF6, 0x1A, 0xEE,
+    0x45, 0xBD, 0xF9, 0x93, 0x40, 0x0E, 0xF1, 0x4E, 0x87, 0x77, 0xB5, 0x4A, 0x7D, 0x02, 0x1D, 0xF5,
+    0x0E, 0xF1, 0x68, 0xD1, 0x0F, 0xCA, 0x9F, 0xDF, 0x6B, 0x7D, 0x61, 0x15, 0x97, 0x8A, 0x07, 0x31,
+    0xBC, 0x12, 0x80, 0x00, 0x8F, 0x48, 0x9F, 0x4B, 0x75, 0x80, 0x48, 0x5A, 0x2D, 0x3A, 0xBF, 0xF5,
+    0x2B, 0xA7, 0xBB, 0x18, 0x40, 0xB6, 0x38, 0x6E, 0x01, 0x37, 0x9E, 0xB7, 0x84, 0x3F, 0xB7, 0xAF,
+    0xD0, 0x08, 0xD9, 0xC5, 0x9C, 0xD7, 0x67, 0x7B, 0x7B, 0xE0, 0xBB, 0xB3, 0x7F, 0x31, 0x23, 0xE4,
+    0x1D, 0xE3, 0xDC, 0xD5, 0x29, 0x12, 0x34, 0xBA, 0xB2, 0xA4, 0x25, 0xA6, 0xAE, 0xE2, 0x20, 0x68,
+    0x60, 0xDA, 0x5E, 0x15, 0x40, 0xAE, 0xED, 0x9B, 0x5B, 0xC6, 0x6B, 0xDD, 0x41, 0x47, 0x71, 0x80,
+    0x89, 0x03, 0xDE, 0x63, 0x2B, 0x9D, 0x67, 0xFE, 0x14, 0x17, 0x00, 0x63, 0xD8, 0x3A, 0x40, 0x63,
+    0x80, 0x0D, 0x2A, 0x7A, 0x6B, 0x8D, 0x21, 0xDB, 0xE9, 0xD5, 0x4C, 0x36, 0x59, 0x03, 0x4A, 0x06,
+    0x30, 0xD9, 0x75, 0x8C, 0x45, 0x59, 0xA4, 0x00, 0x95, 0x73, 0x0F, 0x9C, 0x18, 0x49, 0x52, 0xAD,
+    0x39, 0x7E, 0x2C, 0x64, 0x1E, 0xED, 0xF0, 0x28, 0x72, 0x5D, 0xA9, 0x36, 0x45, 0x5D, 0x2C, 0x4F,
+    0x13, 0x50, 0xCC, 0x3C, 0xAE, 0x68, 0xA4, 0xB5, 0x89, 0xBF, 0xFE, 0x4B, 0xE5, 0x4E, 0x6B, 0x4D,
+    0x3B, 0x50, 0x05, 0x2F, 0xC6, 0xC2, 0x09, 0xAA, 0xAB, 0xD6, 0x1A, 0xCD, 0x4E, 0xA0, 0xF6, 0xEE,
+    0xEA, 0xAD, 0x70, 0x98, 0x4B, 0xFB, 0xB6, 0xB2, 0x82, 0x5A, 0xAA, 0x55, 0x8D, 0x2D, 0x6A, 0x1F,
+    0xEC, 0xE8, 0xDE, 0x49, 0xA0, 0xDF, 0x68, 0xDB, 0xB1, 0x20, 0xE3, 0xC4, 0xD5, 0xFD, 0xBF, 0xB9,
+    0xB2, 0xA7, 0x8F, 0x39, 0xE5, 0xD2, 0x2F, 0xA8, 0x3F, 0x10, 0x9E, 0xED, 0x5D, 0x9E, 0x74, 0x21,
+    0xAE, 0x28, 0x91, 0x70, 0x0A, 0x58, 0xBA, 0x09, 0xE5, 0x3E, 0x7B, 0x41, 0x87, 0x42, 0x45, 0xF4,
+    0x72, 0x3B, 0xE2, 0xC6, 0x81, 0x17, 0xDB, 0x31, 0xB8, 0x7E, 0xAA, 0xA7, 0x53, 0xBA, 0x7A, 0x61,
+    0x7C, 0x3D, 0x94, 0x43, 0x59, 0x15, 0xAD, 0x15, 0x71, 0x46, 0xE6, 0x6D, 0x58, 0x4D, 0x33, 0x16,
+    0x17, 0xEF, 0x92, 0xEA, 0x30, 0x04, 0x6D, 0x49, 0x21, 0xE0, 0x96, 0xB9, 0x64, 0x0B, 0xC8, 0xB8,
+    0x42, 0xA9, 0x16, 0xA7, 0x54, 0x85, 0x1A, 0x68, 0xDC, 0x58, 0xAA, 0x23, 0x36, 0x89, 0xDB, 0x67,
+    0xE9, 0xB7, 0x65, 0x39, 0x3D, 0x53, 0xCF, 0x6F, 0xD9, 0x12, 0x58, 0x9A, 0x93, 0x4A, 0xB2, 0x98,
+    0xC5, 0xA8, 0xAD, 0x31, 0x03, 0xFD, 0x72, 0x04, 0x73, 0x06, 0x8A, 0xD4, 0x39, 0x90, 0xA7, 0x86,
+    0x72, 0x77, 0xA2, 0xCE, 0x41, 0xFE, 0x74, 0xBA, 0xBB, 0x45, 0x2C, 0x09, 0xA5, 0x47, 0x24, 0x6D,
+    0x6B, 0x23, 0xE2, 0x68, 0x71, 0xD0, 0x99, 0xA1, 0xA0, 0x58, 0x84, 0x2C, 0x5C, 0x1B, 0xB4, 0x01,
+    0xB5, 0xCF, 0xC4, 0xBD, 0xE1, 0xBB, 0x80, 0xCD, 0x96, 0xB3, 0x90, 0x01, 0xA0, 0xE5, 0x0D, 0xC4,
+    0x1D, 0x21, 0xDB, 0x51, 0x5D, 0x56, 0xE7, 0x51, 0x16, 0x51, 0x96, 0xCA, 0xBC, 0xBC, 0xE1, 0xF1,
+    0x8D, 0xE3, 0xB3, 0x65, 0x82, 0xB9, 0xB4, 0x71, 0xE0, 0x9A, 0x2A, 0x0B, 0xF3, 0xF1, 0xD5, 0x41,
+    0xF6, 0xCC, 0x33, 0xD3, 0x71, 0xAC, 0xBC, 0x93, 0x15, 0x52, 0xE7, 0x97, 0xC0, 0x42, 0xAA, 0x79,
+    0x8E, 0x8A, 0x0E, 0x7E, 0x1D, 0xCE, 0x51, 0xAB, 0x05, 0x61, 0x04, 0x93, 0x94, 0xDA, 0x39, 0xB2,
+    0x4E, 0x8E, 0xCD, 0x51, 0x55, 0x70, 0xB4, 0xCD, 0x1F, 0xE6, 0x09, 0xB4, 0x9A, 0x04, 0x2B, 0x51,
+    0xA2, 0x48, 0x60, 0x29, 0xD9, 0xC1, 0x72, 0xE6, 0xEE, 0xC7, 0xC6, 0x2F, 0xA3, 0xA7, 0xAA, 0xE9,
+    0x08, 0xBA, 0x4F, 0x6F, 0xEC, 0xED, 0x9B, 0xCB, 0x6A, 0xFC, 0x69, 0x14, 0xCA, 0x4B, 0x80, 0x81,
+    0x23, 0x40, 0xC5, 0x3C, 0x27, 0x59, 0x0E, 0x99, 0x50, 0x4E, 0x13, 0xE9, 0x52, 0x60, 0xA0, 0x08,
+    0x33, 0x1E, 0xB8, 0xF1, 0x87, 0x89, 0xF0, 0x27, 0x6F, 0x5C, 0x16, 0x0C, 0x17, 0xDF, 0x4C, 0xE8,
+    0x95, 0x5A, 0x19, 0xB4, 0x95, 0x85, 0x2E, 0xB4, 0x8B, 0x7E, 0xD7, 0xCA, 0x01, 0x1C, 0xD7, 0xF7,
+    0x5F, 0xDA, 0xC6, 0xFC, 0x1B, 0xB4, 0x11, 0x90, 0xBE, 0x0F, 0x59, 0xEA, 0x63, 0x05, 0x0A, 0xA0,
+    0x02, 0x47, 0x33, 0x09, 0x65, 0x12, 0xAD, 0x2A, 0x35, 0x3F, 0x30, 0xEE, 0x9D, 0xB4, 0x88, 0xAA,
+    0xB0, 0x11, 0x55, 0xA8, 0x55, 0x35, 0x87, 0xD4, 0xCA, 0x9B, 0x4B, 0x1B, 0x0D, 0xDB, 0xFB, 0x3A,
+    0x2F, 0x17, 0xBD, 0xA3, 0xEC, 0xC8, 0x0F, 0x3B, 0x00, 0x52, 0x83, 0xC3, 0x02, 0x72, 0x3F, 0xB9,
+    0xC4, 0x49, 0x61, 0xAE, 0xDF, 0xA5, 0x5C, 0xEE, 0x6D, 0xA3, 0x61, 0x9D, 0x0C, 0x90, 0xE5, 0x7E,
+    0x1B, 0x82, 0xA1, 0xD2, 0x6D, 0x8F, 0x19, 0xAB, 0x7B, 0x58, 0xE9, 0xC9, 0x0B, 0xC5, 0x29, 0x5B,
+    0x06, 0x61, 0x70, 0xE4, 0xFC, 0x4A, 0x2F, 0x17, 0x13, 0xC4, 0x26, 0xA4, 0xE4, 0xB4, 0x76, 0x13,
+    0x19, 0x51, 0xAA, 0xCB, 0x20, 0xC5, 0x0A, 0xA4, 0xF5, 0x1A, 0x6D, 0x48, 0xB1, 0x2C, 0x26, 0xE0,
+    0x56, 0x12, 0x55, 0x82, 0x94, 0x06, 0x10, 0x3C, 0xCA, 0xB5, 0xDA, 0x41, 0x89, 0x4B, 0x6B, 0xCD,
+    0xC8, 0xC8, 0x3D, 0xA8, 0x5E, 0xC2, 0xF2, 0x41, 0xE5, 0xD0, 0xFD, 0x88, 0xF5, 0x66, 0xE3, 0xBA,
+    0x92, 0x7F, 0x5E, 0x6B, 0x33, 0xD4, 0x88, 0xF0, 0x1A, 0x5A, 0x49, 0xB4, 0xC8, 0xF0, 0x9C, 0xF4,
+    0x71, 0x45, 0x99, 0x4D, 0x01, 0x11, 0xCA, 0x3F, 0xA9, 0x29, 0xD5, 0xE9, 0xC0, 0xA4, 0xE8, 0xA5,
+    0x90, 0xA1, 0x5C, 0xA1, 0x78, 0xB6, 0xA4, 0x9E, 0x08, 0x1F, 0xA1, 0x4C, 0x0A, 0xE5, 0x81, 0xD8,
+    0x02, 0xAC, 0xF8, 0xCF, 0x5B, 0x25, 0x5B, 0x09, 0x85, 0x5E, 0x4E, 0xDD, 0xA0, 0xFC, 0x8E, 0xB2,
+    0x5D, 0x84, 0xD6, 0x62, 0x53, 0x8C, 0x42, 0xAE, 0xFC, 0xF9, 0xA0, 0xFC, 0x5D, 0xCB, 0x8C, 0xAA,
+    0xF6, 0x7E, 0x89, 0xD9, 0xE1, 0x0D, 0x0F, 0x1A, 0x8A, 0x45, 0x74, 0x56, 0x4E, 0xF5, 0xE3, 0xDA,
+    0xFF, 0x98, 0x37, 0x00, 0x6F, 0x5D, 0xD1, 0x55, 0xA8, 0x34, 0x6A, 0x03, 0x3B, 0x72, 0xBF, 0x07,
+    0xEF, 0x93, 0x4E, 0xE8, 0xFE, 0xBB, 0xB9, 0x5A, 0x78, 0x1B, 0x87, 0xB3, 0x29, 0x68, 0x57, 0x18,
+    0x59, 0x6A, 0xAF, 0x38, 0xFB, 0x6F, 0x02, 0xDE, 0x56, 0x42, 0x2C, 0x7A, 0xEA, 0xD5, 0x13, 0x59,
+    0x50, 0x43, 0xFD, 0xE9, 0x55, 0xC3, 0xFB, 0x2A, 0xA3, 0x68, 0xFF, 0x02, 0xDB, 0xFF, 0xAC, 0x2D,
+    0xA0, 0xC5, 0x1F, 0xD2, 0xAF, 0x43, 0x21, 0x61, 0x17, 0x45, 0x73, 0x9D, 0xAC, 0xD0, 0xAB, 0xC3,
+    0x85, 0xD1, 0x0A, 0x8D, 0xB1, 0x0F, 0xD6, 0xF0, 0xEE, 0x5E, 0x37, 0xDE, 0xEE, 0x01, 0x4D, 0xC5,
+    0x02, 0xC2, 0x03, 0xA6, 0xC4, 0xE7, 0x00, 0x48, 0xB9, 0x54, 0xC9, 0x9B, 0xAE, 0x8D, 0x6A, 0x7D,
+    0xC0, 0xEB, 0x95, 0xF8, 0xC3, 0x69, 0xC8, 0x67, 0xCB, 0x1F, 0x0F, 0x00, 0x71, 0x9D, 0x7C, 0x75,
+    0xF0, 0x60, 0x38, 0x75, 0x01, 0x33, 0x31, 0xB7, 0x38, 0xC1, 0xA8, 0xEE, 0x2E, 0x68, 0x18, 0x06,
+    0x4F, 0x85, 0x7A, 0x18, 0x84, 0x4C, 0x3A, 0x3B, 0x79, 0x66, 0xD3, 0x21, 0x2F, 0x4F, 0x43, 0xDF,
+    0xD6, 0x67, 0xF3, 0x4F, 0x61, 0xC6, 0xE5, 0x9F, 0x63, 0x74, 0xE5, 0xB4, 0x42, 0x72, 0xC5, 0xBF,
+    0x50, 0xF8, 0x1C, 0xD0, 0x1A, 0x2E, 0xAF, 0x91, 0x56, 0x78, 0x71, 0xA4, 0xAF, 0xF2, 0x81, 0x21,
+    0x14, 0x36, 0xB0, 0x2F, 0x4D, 0xD4, 0x4E, 0xA7, 0xFB, 0x72, 0x70, 0x90, 0x0F, 0xFB, 0xC2, 0xBF,
+    0x6A, 0x3C, 0x8D, 0x17, 0x37, 0x9F, 0x5C, 0xE0, 0xA2, 0x35, 0x95, 0xE4, 0xC4, 0xD3, 0xE6, 0x0B,
+    0xAF, 0x76, 0x72, 0xE0, 0xCD, 0xF1, 0x86, 0x89, 0x3C, 0x90, 0x03, 0x4E, 0x86, 0xCC, 0x92, 0xFB,
+    0xF8, 0x39, 0xDE, 0x75, 0xEE, 0xEA, 0x78, 0x88, 0x54, 0xF5, 0xE9, 0x55, 0xFA, 0x40, 0x31, 0x68,
+    0x3D, 0x39, 0xCA, 0x3B, 0x8C, 0xB2, 0x5E, 0x57, 0x97, 0x00, 0xC4, 0xEF, 0xF5, 0xE1, 0x33, 0x12,
+    0x9A, 0xA5, 0x83, 0xD3, 0x04, 0xF2, 0xA4, 0xD6, 0x09, 0x58, 0xC5, 0x3A, 0x34, 0xBF, 0x6B, 0xFE,
+    0x6A, 0xEE, 0x64, 0xD7, 0x8E, 0x72, 0xCC, 0xE8, 0xDA, 0x81, 0xC8, 0xC3, 0x64, 0xFC, 0x26, 0x07,
+    0x0D, 0x5D, 0x5B, 0xDE, 0xC2, 0x0A, 0x52, 0x6D, 0xD8, 0xA2, 0x0E, 0xE5, 0x49, 0xA5, 0x0B, 0x4F,
+    0x71, 0xFB, 0x86, 0x24, 0x7F, 0x6D, 0xFE, 0x6D, 0xCD, 0xD7, 0x5E, 0x9D, 0xCB, 0xA1, 0x86, 0xA4,
+    0x16, 0x6F, 0x3F, 0xB6, 0x60, 0x55, 0x3E, 0xED, 0xCF, 0x1B, 0x02, 0xF5, 0xEC, 0x4C, 0x1F, 0x5F,
+    0xDA, 0xB9, 0xB4, 0xE5, 0x52, 0x8D, 0xF7, 0x41, 0x3F, 0xA9, 0xF4, 0x13, 0x66, 0xD9, 0x2B, 0x7C,
+    0x7E, 0xAE, 0xAA, 0xC6, 0x6D, 0x13, 0x16, 0xF1, 0x57, 0x34, 0x77, 0x75, 0x8D, 0x50, 0xB4, 0x1E,
+    0xAC, 0xC4, 0x1D, 0x94, 0x65, 0x30, 0x8F, 0x03, 0x2C, 0x9B, 0x13, 0x35, 0xD7, 0xD3, 0x1D, 0x3E,
+    0xFC, 0x37, 0x63, 0x79, 0x38, 0x46, 0xAB, 0xB3, 0x3A, 0xC9, 0xEA, 0x3C, 0xAF, 0x9E, 0xC8, 0xA5,
+    0x55, 0xED, 0x58, 0x3F, 0x7B, 0x74, 0x52, 0x9C, 0xE9, 0x13, 0x61, 0xDE, 0x76, 0xF6, 0x03, 0xE7,
+    0xBE, 0x5A, 0x2E, 0x29, 0x7D, 0xFA, 0x72, 0x13, 0xDE, 0x7C, 0x15, 0x36, 0xDB, 0x77, 0x9D, 0x24,
+    0x6C, 0xA2, 0x36, 0x6A, 0xC3, 0xC6, 0x6A, 0x12, 0xF8, 0xFE, 0xB2, 0x7F, 0xDA, 0xEA, 0x2C, 0x56,
+    0xC9, 0x91, 0xDF, 0x4C, 0xBB, 0xB8, 0xDB, 0xBE, 0x6B, 0xDE, 0x82, 0xF4, 0x98, 0xAB, 0x9D, 0x85,
+    0xF6, 0xB9, 0xF1, 0xAE, 0x40, 0x9C, 0xE2, 0x1F, 0x5C, 0xA4, 0x09, 0x9D, 0x9D, 0x23, 0xD5, 0x6A,
+    0x5D, 0xF4, 0x8C, 0xB9, 0x50, 0x1A, 0xB1, 0x96, 0xF5, 0x7A, 0x2D, 0x35, 0x63, 0x44, 0x82, 0x90,
+    0x98, 0xAD, 0x1F, 0x5B, 0xF3, 0xCC, 0xFA, 0x3F, 0x5B, 0x52, 0x1A, 0x71, 0x43, 0x02, 0x2B, 0x7D,
+    0x37, 0x2D, 0x17, 0x3D, 0xA2, 0x21, 0x79, 0xE5, 0x8B, 0x7E, 0x1F, 0xB6, 0xD6, 0x74, 0x1F, 0xBD,
+    0x3E, 0x9C, 0xC7, 0x61, 0xD7, 0x4D, 0x1C, 0x30, 0xCE, 0x55, 0xBF, 0xF0, 0x69, 0x77, 0xE1, 0xA8,
+    0x55, 0xE9, 0x4A, 0x6C, 0x98, 0x62, 0x40, 0xC7, 0xA9, 0xAE, 0x91, 0x96, 0x5E, 0x1B, 0x34, 0x41,
+    0xE9, 0x76, 0x1B, 0xAA, 0xC5, 0x45, 0x1F, 0xBA, 0xCE, 0xEF, 0xA8, 0xA1, 0x0A, 0x83, 0x31, 0x55,
+    0xE1, 0x96, 0x2A, 0x5B, 0x74, 0x4B, 0xAB, 0xA4, 0x75, 0xA4, 0xA6, 0x94, 0x85, 0x8C, 0x8D, 0xCB,
+    0xBC, 0x78, 0x38, 0x6A, 0x36, 0x66, 0x92, 0x9D, 0xE7, 0x7C, 0x38, 0x5A, 0x3F, 0x42, 0x9B, 0x14,
+    0x31, 0x80, 0xE5, 0x4B, 0x2E, 0x05, 0x51, 0x4B, 0x01, 0x2C, 0x85, 0xDE, 0x87, 0xCF, 0x30, 0x41,
+    0x84, 0x4D, 0x6F, 0xA8, 0xDA, 0x26, 0x05, 0x44, 0xF2, 0x23, 0xBC, 0xF7, 0x6B, 0xBC, 0xF4, 0x31,
+    0x26, 0xDB, 0x21, 0x9D, 0x42, 0x3D, 0x95, 0x44, 0x33, 0x0A, 0xAC, 0xFF, 0xE3, 0xC2, 0xA8, 0xED,
+    0x91, 0x22, 0x6D, 0xA6, 0x77, 0x59, 0x8A, 0x87, 0xF2, 0x16, 0x7A, 0x4F, 0x1F, 0xA8, 0xC6, 0x8A,
+    0x4C, 0xDC, 0xAD, 0x29, 0x3B, 0x56, 0x51, 0xC6, 0x15, 0xBF, 0x9D, 0x74, 0x3C, 0x86, 0xEE, 0xB6,
+    0x92, 0x51, 0xCD, 0x58, 0xF3, 0x76, 0xBF, 0x80, 0x88, 0xEA, 0x6C, 0x0B, 0xC9, 0x54, 0xBB, 0x1B,
+    0xF4, 0xA7, 0x56, 0x91, 0x56, 0xCA, 0x7D, 0xFA, 0x58, 0xEB, 0x4B, 0x7F, 0x8B, 0xE0, 0xCC, 0x61,
+    0x0F, 0xFB, 0x7C, 0x00, 0x41, 0x2F, 0x00, 0x8A, 0xB4, 0xC5, 0x23, 0x95, 0x2E, 0x1D, 0x69, 0xA5,
+    0x03, 0x28, 0xD5, 0xD1, 0x6A, 0x50, 0x4A, 0x31, 0x96, 0x07, 0x97, 0xE5, 0xEA, 0xCF, 0x32, 0xD9,
+    0x4D, 0xEA, 0x28, 0x39, 0x0D, 0x0B, 0xB3, 0xE6, 0x97, 0x82, 0x3E, 0xA8, 0xAF, 0xB9, 0x60, 0xC3,
+    0x43, 0x51, 0x21, 0xD8, 0x80, 0xDD, 0x5F, 0xA1, 0xF3, 0xBF, 0x40, 0xBD, 0x4F, 0xC8, 0x01, 0x79,
+    0x61, 0xC8, 0x08, 0x6C, 0xF4, 0x3A, 0x79, 0x52, 0x28, 0x99, 0xE3, 0x1B, 0x23, 0x1B, 0xD9, 0x1A,
+    0x1B, 0xB7, 0xEE, 0xB0, 0x03, 0x31, 0xFB, 0x38, 0xAE, 0xA0, 0x3E, 0xAE, 0x05, 0x7C, 0x6C, 0x34,
+    0xF5, 0x1C, 0x0F, 0xA1, 0x84, 0x9C, 0x0F, 0x73, 0xB0, 0xEF, 0xA2, 0x37, 0x61, 0x89, 0xC5, 0xE5,
+    0x68, 0xA7, 0x6B, 0xEF, 0xBC, 0xAA, 0x92, 0xF6, 0x9C, 0xCF, 0x85, 0x37, 0x61, 0xFA, 0x63, 0x64,
+    0xAA, 0xB5, 0x1D, 0x08, 0x07, 0x3D, 0x4C, 0x89, 0x2D, 0xB4, 0x26, 0x2F, 0xCF, 0xFA, 0xCF, 0x42,
+    0x1F, 0x97, 0x71, 0x91, 0x26, 0x0F, 0xCD, 0x4D, 0xB4, 0x01, 0x26, 0x90, 0x83, 0xA8, 0x86, 0xDB,
+    0x83, 0x20, 0xA6, 0xB1, 0x68, 0xF0, 0x6D, 0xFF, 0xF9, 0x11, 0xA5, 0xB3, 0x13, 0xB1, 0xCA, 0xC0,
+    0x3A, 0xD9, 0x49, 0x96, 0x0A, 0xA1, 0x24, 0xF9, 0x27, 0x62, 0xF2, 0xFF, 0xEC, 0xF5, 0xE8, 0x54,
+    0xE5, 0xAE, 0xCF, 0x7D, 0x19, 0x79, 0x79, 0x1F, 0x39, 0xDA, 0xFC, 0xA0, 0x89, 0xEB, 0xA8, 0xD5,
+    0xA3, 0x8B, 0xEB, 0xB0, 0xB1, 0xD7, 0x4E, 0xD7, 0x47, 0x2F, 0x1B, 0x51, 0xBB, 0xF9, 0xA7, 0x7D,
+    0xFE, 0x5F, 0x82, 0xCF, 0x6F, 0xFB, 0xBC, 0xFC, 0xC9, 0x8B, 0x47, 0x14, 0x45, 0xD5, 0xCB, 0xC8,
+    0xB7, 0x40, 0x7E, 0x05, 0x32, 0x8C, 0x49, 0x0B, 0x0B, 0x18, 0x40, 0x21, 0x3C, 0x3C, 0xB9, 0xD0,
+    0xA7, 0x47, 0xD0, 0x67, 0x4B, 0xFE, 0x38, 0xB1, 0x4A, 0xF2, 0x3A, 0x31, 0x4B, 0x24, 0x0C, 0x9C,
+    0xFC, 0xB9, 0xE3, 0x48, 0xE3, 0x20, 0x06, 0xD9, 0x23, 0x3B, 0x00, 0xD9, 0x02, 0x6A, 0x29, 0x66,
+    0xD7, 0x4E, 0x78, 0x1E, 0x51, 0x98, 0x6C, 0x16, 0xBF, 0x01, 0xF5, 0xCC, 0x88, 0xBA, 0x73, 0x4E,
+    0x13, 0xBE, 0x3F, 0xE6, 0x13, 0x01, 0xF7, 0x69, 0x01, 0x3D, 0x43, 0xE9, 0x40, 0x8A, 0x75, 0xA7,
+    0xE0, 0x4A, 0x53, 0x20, 0x24, 0xA9, 0x14, 0xEB, 0x5E, 0x21, 0x2A, 0x8A, 0x94, 0xBE, 0xD7, 0x81,
+    0xFE, 0x50, 0x40, 0xFF, 0x1C, 0xC1, 0x41, 0x79, 0x57, 0x57, 0xC0, 0x42, 0x57, 0x6E, 0xB5, 0xFB,
+    0x74, 0x11, 0xAA, 0x41, 0xE3, 0x16, 0x34, 0xE8, 0x40, 0x55, 0xA6, 0x17, 0xD0, 0xE4, 0xF3, 0x02,
+    0x0C, 0xEA, 0xE2, 0x0E, 0x9B, 0x05, 0x34, 0x25, 0x8D, 0x48, 0x03, 0x52, 0x1A, 0xBB, 0xD7, 0x3E,
+    0x9A, 0xDC, 0x06, 0x50, 0x03, 0xD9, 0x24, 0xAE, 0xFA, 0xFE, 0xCA, 0x9E, 0xBC, 0xAE, 0x1D, 0xFF,
+    0x0B, 0x55, 0x24, 0xF2, 0x8F, 0xB5, 0x07, 0x68, 0x20, 0xD2, 0x3E, 0xA4, 0x79, 0x48, 0xBB, 0xD0,
+    0x12, 0x58, 0x85, 0xEC, 0xDB, 0x33, 0x91, 0xAB, 0x87, 0xC8, 0xFA, 0x5F, 0xCA, 0xDF, 0x39, 0xA9,
+    0xF5, 0x26, 0xD3, 0x48, 0x19, 0xF3, 0x07, 0x76, 0x2F, 0x1E, 0x9E, 0x75, 0x61, 0x4C, 0xB7, 0x09,
+    0x43, 0xC2, 0xED, 0x94, 0xA6, 0x42, 0xAB, 0x1F, 0xC2, 0xD8, 0xDC, 0x33, 0xDB, 0xFB, 0x18, 0x75,
+    0x88, 0xCB, 0x44, 0xFF, 0xCB, 0xFC, 0x94, 0x31, 0xD5, 0xA7, 0x65, 0xDA, 0x4F, 0x75, 0xB5, 0x07,
+    0x22, 0xBD, 0xF8, 0x5E, 0xA7, 0xCA, 0xBD, 0x23, 0xEF, 0xB5, 0xA3, 0x17, 0x3F, 0xDA, 0xF4, 0xE2,
+    0x5F, 0x2C, 0xD2, 0x5E, 0x37, 0x0B, 0xA0, 0xD9, 0xB5, 0x35, 0xFA, 0xB6, 0x4C, 0x68, 0xD3, 0x59,
+    0x20, 0x90, 0x3E, 0x50, 0xB6, 0x3E, 0x19, 0xA0, 0xC6, 0xC6, 0x8F, 0xD4, 0xCA, 0xEC, 0xCC, 0x8E,
+    0x23, 0x36, 0x1C, 0x2B, 0xC3, 0x1E, 0x4F, 0x35, 0xF4, 0x5B, 0x87, 0xEA, 0x1A, 0x4E, 0xEE, 0xFA,
+    0x29, 0xFB, 0xE6, 0x27, 0xF4, 0xA7, 0x22, 0xDB, 0xDB, 0x3E, 0xB3, 0x34, 0x5B, 0xF5, 0x99, 0xB0,
+    0xCF, 0x72, 0xF6, 0xD6, 0xDE, 0xC0, 0x9E, 0x63, 0x9F, 0xFD, 0x80, 0xBD, 0xF5, 0xAE, 0xAA, 0x2C,
+    0xE8, 0xB3, 0x86, 0xBD, 0xC5, 0x7E, 0x0A, 0x07, 0xF6, 0x19, 0xFB, 0x69, 0xC1, 0x1E, 0x1A, 0x7B,
+    0x2B, 0x27, 0x8D, 0x49, 0xC3, 0xA9, 0x9F, 0x18, 0xA2, 0x06, 0x75, 0x48, 0xC7, 0xA9, 0xB1, 0x36,
+    0x4D, 0x5C, 0xDB, 0x67, 0xE8, 0x34, 0x9F, 0x72, 0xDD, 0xE7, 0x00, 0xF4, 0xE8, 0x94, 0x7F, 0x7B,
+    0xEA, 0xC0, 0xCF, 0x2F, 0x66, 0xAA, 0xAC, 0x08, 0x82, 0x17, 0x64, 0x25, 0xB7, 0x04, 0x6E, 0x2E,
+    0xE6, 0x9D, 0xA8, 0x62, 0xED, 0x2C, 0x97, 0xBB, 0x4C, 0x25, 0xAC, 0x36, 0xE9, 0xB1, 0x8C, 0x94,
+    0xCC, 0x58, 0xF7, 0x20, 0x19, 0x65, 0xCC, 0x1D, 0x4A, 0xD6, 0x97, 0x1E, 0x5C, 0x8C, 0x89, 0x91,
+    0x1A, 0x09, 0x26, 0x71, 0x8B, 0xA5, 0x53, 0x65, 0x69, 0x0B, 0x0F, 0x2C, 0xFC, 0xAE, 0x41, 0x3F,
+    0xD2, 0x7A, 0x8D, 0xAE, 0x5F, 0x87, 0x72, 0xD3, 0xD9, 0xB7, 0x6C, 0x09, 0xF0, 0xDF, 0xE6, 0x8D,
+    0x16, 0xEB, 0xD1, 0xF3, 0x62, 0xCD, 0x80, 0xD1, 0xEF, 0xDA, 0xD1, 0xD1, 0x03, 0x5B, 0xDF, 0xC1,
+    0x62, 0x83, 0xE0, 0xB7, 0xE1, 0xD5, 0x15, 0xB1, 0xEC, 0xFE, 0x6C, 0x15, 0xE0, 0xEA, 0xE9, 0x2E,
+    0x4E, 0x02, 0x79, 0xDF, 0x2A, 0xFB, 0x25, 0x74, 0x5C, 0x24, 0xF3, 0xC5, 0x48, 0xC3, 0x53, 0x52,
+    0xCD, 0xA4, 0xB6, 0x59, 0x7E, 0x71, 0x4D, 0x1F, 0x2A, 0x1F, 0x0E, 0xE4, 0x3E, 0x9A, 0x29, 0x70,
+    0x06, 0x6F, 0x24, 0xA8, 0xCC, 0x01, 0x17, 0x04, 0xB2, 0x6C, 0xC0, 0x65, 0x61, 0x61, 0xB3, 0x01,
+    0x97, 0xEB, 0xC7, 0x03, 0x2E, 0x57, 0x12, 0x42, 0x07, 0x01, 0x17, 0x87, 0x2E, 0x5D, 0xB9, 0x3F,
+    0xCC, 0x01, 0x17, 0xAD, 0xC3, 0x7D, 0x98, 0x5C, 0x22, 0x98, 0xE6, 0xE0, 0x2F, 0xEE, 0x01, 0x40,
+    0xE4, 0x55, 0x7A, 0x3D, 0x54, 0xB7, 0xA0, 0x86, 0xCA, 0x10, 0x3D, 0xC2, 0xA2, 0xFD, 0x3D, 0xB7,
+    0x7E, 0x13, 0xC0, 0x34, 0xEF, 0xFC, 0xCB, 0x01, 0xDD, 0xC7, 0x36, 0xF4, 0xBA, 0xE8, 0x75, 0x9D,
+    0xF4, 0x9A, 0x58, 0x97, 0xF5, 0xEC, 0x6F, 0xCC, 0x65, 0x82, 0xB9, 0xF2, 0x89, 0x22, 0x6E, 0xCB,
+    0x80, 0x85, 0xD0, 0xA2, 0xE6, 0xD9, 0x1D, 0xCF, 0x1E, 0x3E, 0x1F, 0x2E, 0x11, 0xE8, 0xA0, 0xD3,
+    0x24, 0xE8, 0xED, 0x39, 0xEA, 0xEC, 0x39, 0x6E, 0xC7, 0x73, 0xA3, 0x67, 0x7D, 0x4E, 0xEB, 0xC7,
+    0xAB, 0xC5, 0x73, 0xCF, 0x5F, 0x1D, 0x64, 0x7C, 0x6E, 0x7A, 0x7E, 0xAD, 0x9C, 0x70, 0x3C, 0x4F,
+    0xF5, 0xB0, 0xDE, 0xC4, 0xAA, 0xA3, 0xEB, 0x7C, 0xCD, 0x7C, 0x6E, 0x8F, 0x67, 0x2B, 0xC9, 0x19,
+    0xAE, 0x9E, 0x60, 0x8B, 0xA4, 0x21, 0x72, 0x30, 0x24, 0x7C, 0xFB, 0x5E, 0x86, 0xE8, 0x88, 0x7C,
+    0x9F, 0x09, 0xB6, 0x8A, 0x43, 0x4C, 0x1B, 0xB6, 0x51, 0xB5, 0x13, 0xA0, 0xF1, 0x6C, 0xF3, 0xB3,
+    0x9E, 0x7B, 0x1E, 0xD3, 0xD4, 0x26, 0x8B, 0x25, 0xB7, 0xE9, 0x72, 0xCC, 0x0A, 0x56, 0x19, 0x70,
+    0x28, 0xF2, 0xD9, 0x1E, 0x31, 0x46, 0x3B, 0x01, 0x33, 0x6D, 0xE0, 0x48, 0x4A, 0x9F, 0x49, 0x5E,
+    0x37, 0x47, 0xAB, 0x7F, 0xA5, 0x34, 0x32, 0x46, 0xFE, 0x3C, 0xA5, 0x71, 0x4A, 0x51, 0x8B, 0xC5,
+    0x26, 0x8D, 0x0D, 0x36, 0x67, 0x2C, 0xAE, 0x6F, 0x00, 0x40, 0x87, 0x7D, 0xBF, 0x49, 0x1C, 0xDC,
+    0xF0, 0x6D, 0x7E, 0xAE, 0x4D, 0x2D, 0x8B, 0x01, 0x4A, 0xCC, 0xAC, 0x36, 0x8C, 0x03, 0x35, 0x58,
+    0x60, 0xB1, 0xF9, 0x03, 0x83, 0x5A, 0xDA, 0x3D, 0x2E, 0xFB, 0x42, 0x2C, 0x00, 0x18, 0x2D, 0x9D,
+    0xCD, 0x78, 0x83, 0x4E, 0x0E, 0xC4, 0x21, 0xC4, 0xD1, 0x52, 0x9D, 0x58, 0xCE, 0xAC, 0x89, 0xBF,
+    0x6D, 0xF2, 0x77, 0xD5, 0x18, 0xFB, 0x07, 0x3D, 0x0E, 0x29, 0x84, 0xF4, 0xF8, 0x3E, 0x81, 0x40,
+    0x2A, 0x0B, 0x7D, 0xA1, 0xA7, 0x35, 0xB8, 0x5E, 0x57, 0xFB, 0xD6, 0x96, 0x05, 0xC6, 0xD3, 0x64,
+    0x72, 0xD5, 0x58, 0xED, 0xB0, 0x9E, 0xA6, 0xE7, 0x39, 0xB6, 0x75, 0xC3, 0x97, 0x81, 0xB6, 0x17,
+    0xD6, 0xC7, 0xF1, 0x70, 0x9C, 0x82, 0x36, 0x0B, 0x63, 0xD4, 0xDF, 0xBA, 0x13, 0xF4, 0xB7, 0xD7,
+    0x38, 0x26, 0x90, 0x89, 0x1A, 0x97, 0x61, 0x8D, 0x0C, 0x77, 0xA6, 0xA1, 0x52, 0x81, 0x9A, 0x52,
+    0x32, 0xB6, 0x93, 0x48, 0x75, 0x88, 0xE8, 0xB1, 0x94, 0xD1, 0x1F, 0x74, 0x69, 0x12, 0x1C, 0x65,
+    0x12, 0x0D, 0x76, 0x90, 0x47, 0x2D, 0x72, 0xE2, 0x4F, 0x77, 0x4C, 0x49, 0xD1, 0x15, 0xA3, 0x0D,
+    0xC6, 0x06, 0x72, 0xA8, 0x3E, 0xC6, 0xD9, 0xB1, 0xE8, 0xF8, 0x3E, 0x26, 0xF6, 0x80, 0x0C, 0xBB,
+    0x01, 0x0B, 0x7B, 0x87, 0x3C, 0xBD, 0xF6, 0x19, 0x87, 0x02, 0x93, 0xCC, 0x99, 0xA1, 0x8F, 0xA5,
+    0xDF, 0x66, 0xD0, 0xE6, 0x00, 0xD7, 0x66, 0x87, 0x52, 0xC7, 0x0F, 0xD7, 0x0D, 0xE0, 0x5D, 0x90,
+    0xDB, 0x89, 0x22, 0x92, 0x62, 0xC5, 0x4D, 0x01, 0x5A, 0x0A, 0x41, 0x7D, 0x83, 0xEA, 0x98, 0x5D,
+    0x62, 0x5E, 0xE0, 0xB1, 0xFA, 0xE3, 0x7F, 0xE4, 0x12, 0xAF, 0x1C, 0xD5, 0xC0, 0x3A, 0xAD, 0xFC,
+    0x02, 0xF9, 0x5D, 0x29, 0x53, 0xCD, 0x20, 0x04, 0x5A, 0xAA, 0x77, 0x0E, 0xFA, 0x01, 0x6A, 0x30,
+    0x87, 0x52, 0xD4, 0xFC, 0x44, 0x8F, 0xF4, 0xC3, 0xBC, 0x46, 0x55, 0x29, 0x13, 0x03, 0x7B, 0x1B,
+    0x02, 0x86, 0xA7, 0x97, 0xAE, 0x5E, 0x6A, 0x61, 0x70, 0xF6, 0x1A, 0xBF, 0x0D, 0xB4, 0x4F, 0x8E,
+    0x65, 0xC4, 0xBC, 0x56, 0x40, 0xDE, 0xD9, 0xA7, 0x49, 0x84, 0xD0, 0x8A, 0x7F, 0x24, 0x8A, 0x47,
+    0x5A, 0xA4, 0xC9, 0xB8, 0x9A, 0x9D, 0x37, 0x20, 0xAF, 0xB5, 0xB5, 0xCC, 0xE4, 0xA2, 0x0B, 0x97,
+    0x09, 0x03, 0xCE, 0x30, 0xED, 0xBD, 0xC8, 0xFB, 0x69, 0x8B, 0x08, 0x23, 0xE5, 0xE7, 0xD9, 0xE8,
+    0x28, 0xB1, 0xA3, 0x1F, 0xF3, 0x03, 0x2B, 0x94, 0x1E, 0xEE, 0x21, 0x64, 0x64, 0x4D, 0x7F, 0x83,
+    0xEA, 0x95, 0x1F, 0xA8, 0xA1, 0xA5, 0xF6, 0xD7, 0x62, 0xC0, 0x4C, 0xA1, 0x24, 0x8C, 0x29, 0x48,
+    0x87, 0x2B, 0x33, 0x65, 0x5E, 0xB8, 0x7E, 0x9C, 0xF3, 0x08, 0x41, 0xF2, 0x19, 0xD2, 0x8A, 0xA5,
+    0x5D, 0x91, 0x9D, 0xF7, 0xE5, 0xC3, 0x9B, 0xA7, 0x73, 0x9A, 0xBD, 0x3A, 0x31, 0x68, 0x8F, 0x7B,
+    0x64, 0xC6, 0xB5, 0x6B, 0xCC, 0xF8, 0x2B, 0x01, 0x5C, 0x31, 0x66, 0x85, 0x05, 0x93, 0x1C, 0x4D,
+    0xC7, 0x8C, 0x0E, 0x9A, 0xBC, 0x09, 0xDA, 0x57, 0xC4, 0xE3, 0xF1, 0x67, 0x72, 0x80, 0x9C, 0x69,
+    0xF3, 0xF2, 0x03, 0xEB, 0xC1, 0xD3, 0x92, 0xB8, 0xE4, 0xD4, 0x87, 0x0A, 0xE8, 0xE6, 0x64, 0x81,
+    0x1C, 0x80, 0x01, 0x3D, 0xBE, 0xA3, 0xD7, 0x43, 0xC8, 0xF3, 0x23, 0xE3, 0xDE, 0x35, 0xD7, 0x33,
+    0x1D, 0xB5, 0xB9, 0x5A, 0x92, 0xBF, 0xC6, 0xFA, 0x8C, 0x2E, 0x0E, 0x80, 0xE9, 0x62, 0xC3, 0x77,
+    0xF3, 0xFA, 0x30, 0xB4, 0xB9, 0x03, 0x1B, 0xA1, 0x88, 0x14, 0xA1, 0x88, 0xDC, 0x44, 0x19, 0xBD,
+    0x47, 0x8E, 0xB5, 0x8D, 0x11, 0x6B, 0x99, 0x09, 0x20, 0x3B, 0x6B, 0x65, 0xDC, 0xFF, 0xF4, 0x14,
+    0xB1, 0x23, 0x66, 0xEA, 0x81, 0x50, 0xE0, 0xC2, 0x2D, 0x75, 0xF6, 0xE6, 0x73, 0x5B, 0xD5, 0x31,
+    0xE2, 0xBC, 0x2F, 0xCB, 0x33, 0x37, 0xFF, 0xD4, 0x43, 0x83, 0x09, 0xF2, 0xC8, 0x44, 0x1A, 0x8F,
+    0x97, 0x0E, 0x8D, 0x55, 0x76, 0x6F, 0x5C, 0x85, 0xDC, 0x48, 0x92, 0x4F, 0xB9, 0xF0, 0x8B, 0x26,
+    0xC5, 0xC2, 0x52, 0x6E, 0x1F, 0xDF, 0x25, 0xC1, 0x5D, 0x50, 0x54, 0xD8, 0x2F, 0x8A, 0x42, 0xEB,
+    0x60, 0x46, 0x4B, 0x8C, 0x59, 0x8E, 0x35, 0x2B, 0xE2, 0x0A, 0x35, 0x6E, 0x55, 0x6B, 0x18, 0x87,
+    0x63, 0x56, 0x51, 0xBF, 0xCA, 0x8A, 0xB2, 0x1E, 0xE2, 0xEF, 0x69, 0x11, 0x43, 0x8F, 0xC7, 0x3A,
+    0xE3, 0x7F, 0xA2, 0x8F, 0xFA, 0xD9, 0x8D, 0x75, 0x2D, 0x41, 0x15, 0x2F, 0x29, 0x5E, 0x95, 0x54,
+    0xAA, 0x09, 0xC1, 0x8C, 0x2B, 0x52, 0xC9, 0x09, 0x3E, 0xB2, 0x07, 0x86, 0xB8, 0x70, 0xA5, 0x51,
+    0xE5, 0x6D, 0x4A, 0xE2, 0xB7, 0x31, 0x8B, 0x63, 0xF4, 0xCA, 0x03, 0x48, 0x0F, 0x8E, 0x2B, 0xD6,
+    0x36, 0x1A, 0xC9, 0xE5, 0xC1, 0xF6, 0x73, 0xB3, 0xAD, 0xBD, 0x74, 0x9B, 0xF1, 0x45, 0x24, 0x85,
+    0xD0, 0x2E, 0xA7, 0x38, 0xA1, 0x3B, 0x66, 0x6F, 0xFF, 0x4D, 0x80, 0xD0, 0xDD, 0xB7, 0x7B, 0x09,
+    0xFA, 0x17, 0xEC, 0x25, 0xB8, 0x0C, 0x30, 0xCD, 0x43, 0x9B, 0xB8, 0x00, 0x95, 0xC4, 0xFF, 0x1D,
+    0x7D, 0xDA, 0x7F, 0xDB, 0xCC, 0xD4, 0x7F, 0x52, 0xCF, 0x77, 0xE7, 0x04, 0xE4, 0x2B, 0x3E, 0xB9,
+    0xE9, 0x9D, 0xA7, 0x7E, 0x11, 0xEF, 0xE9, 0xD8, 0xF8, 0x2E, 0x54, 0x2E, 0x92, 0xF8, 0x41, 0x36,
+    0xDE, 0xD8, 0x6E, 0x2F, 0x13, 0xE2, 0xED, 0x7B, 0xC8, 0x1D, 0x0C, 0x91, 0x4B, 0x30, 0xEE, 0x2C,
+    0xCB, 0x7F, 0x81, 0x4D, 0x7F, 0x3D, 0xA2, 0x07, 0x6E, 0x1D, 0x66, 0x6F, 0x04, 0xAC, 0xB7, 0xFE,
+    0xEE, 0x23, 0xBD, 0xFC, 0x1B, 0x2C, 0x97, 0x61, 0xA3, 0x20, 0xAB, 0x15, 0x1A, 0x54, 0x39, 0xB4,
+    0xCB, 0xCB, 0x04, 0xF3, 0x4A, 0x81, 0xC3, 0xB5, 0x7A, 0x87, 0x10, 0x59, 0x5B, 0x6A, 0xC1, 0x65,
+    0x90, 0xBB, 0x98, 0xB9, 0x63, 0x64, 0x9A, 0x3A, 0xAE, 0x9D, 0x40, 0x69, 0x71, 0x09, 0x18, 0xDD,
+    0x9E, 0xE2, 0x63, 0x64, 0x83, 0xCE, 0x08, 0xEF, 0x28, 0x19, 0xF5, 0x33, 0xD7, 0x6E, 0xA6, 0xCE,
+    0xE6, 0xED, 0x12, 0xE0, 0xAA, 0x9F, 0x77, 0x8A, 0x4C, 0x81, 0x2E, 0x1B, 0x55, 0x50, 0xFD, 0x69,
+    0x0A, 0xBC, 0x14, 0x8B, 0xC6, 0x3C, 0xEF, 0x4F, 0x1F, 0x0C, 0xB1, 0xFE, 0xA3, 0x49, 0x11, 0xF0,
+    0xE1, 0x86, 0xC0, 0x0E, 0x99, 0x47, 0x31, 0x37, 0xB2, 0xF9, 0x3D, 0x77, 0x2F, 0x0E, 0x50, 0xC8,
+    0xA2, 0x1A, 0x41, 0x63, 0xB5, 0x77, 0x43, 0x6C, 0x04, 0x45, 0x9A, 0x81, 0x7E, 0x24, 0x4F, 0xF4,
+    0x67, 0xD0, 0x39, 0x43, 0x9A, 0xE9, 0x03, 0x7E, 0xE7, 0xF6, 0x31, 0x3C, 0x08, 0x5E, 0xBF, 0xE8,
+    0xF4, 0x4B, 0xA5, 0xDC, 0xE8, 0x97, 0x92, 0xBB, 0x57, 0xBD, 0x2E, 0xAA, 0xB4, 0x46, 0x57, 0x7C,
+    0x65, 0x0C, 0xBA, 0xAA, 0xBC, 0x57, 0x07, 0x35, 0x04, 0x00, 0xBE, 0x7C, 0xCD, 0xCD, 0xAD, 0xFF,
+    0x5C, 0xC1, 0x80, 0x54, 0xCE, 0x0E, 0x4B, 0xBB, 0xBF, 0x3E, 0x45, 0x24, 0x68, 0xA0, 0x6C, 0x2D,
+    0xB8, 0x4F, 0x5A, 0xBF, 0x64, 0x8E, 0x58, 0x23, 0x25, 0xB1, 0x26, 0x17, 0x16, 0x85, 0x31, 0x53,
+    0x6B, 0xDE, 0x3B, 0x73, 0x90, 0x8D, 0x5B, 0x13, 0xAD, 0x4A, 0xE3, 0x8F, 0x22, 0x2E, 0xFA, 0xBD,
+    0x85, 0x2B, 0xCD, 0xAC, 0x5F, 0xA5, 0x1F, 0xB3, 0xAD, 0x8F, 0xC5, 0x2D, 0x4B, 0x97, 0x3B, 0x16,
+    0x91, 0x54, 0xAD, 0x7C, 0xD0, 0x39, 0x52, 0x79, 0xFA, 0x6C, 0xED, 0x49, 0xED, 0x03, 0x01, 0xFF,
+    0x0F, 0xB5, 0x22, 0x11, 0xB4, 0xC1, 0xEF, 0x1A, 0x00, 0xD1, 0x05, 0x5F, 0xB4, 0x98, 0x56, 0x7D,
+    0xF8, 0x69, 0xA7, 0x30, 0x2C, 0x86, 0xE8, 0x3F, 0x3A, 0x36, 0x3E, 0x7E, 0xD4, 0xEB, 0x4C, 0x73,
+    0x25, 0xCE, 0xB0, 0x9B, 0xC5, 0x91, 0x38, 0x61, 0xEF, 0x48, 0x6E, 0x72, 0xF8, 0xAB, 0x15, 0x47,
+    0xE4, 0x4D, 0x01, 0x61, 0x86, 0xE1, 0x15, 0x72, 0xDA, 0xFA, 0xDA, 0x07, 0xDC, 0x09, 0xA3, 0x9D,
+    0x62, 0x73, 0xD2, 0xC7, 0x30, 0x79, 0x35, 0x47, 0x84, 0x6C, 0x43, 0x10, 0x8D, 0x82, 0x01, 0x7A,
+    0xAC, 0x11, 0xDC, 0xBD, 0x9E, 0xA5, 0xC8, 0x15, 0xC3, 0x34, 0x08, 0x06, 0x76, 0x5B, 0x87, 0x6C,
+    0xB2, 0x98, 0x49, 0xBA, 0x29, 0x66, 0x4B, 0x86, 0x61, 0x2D, 0x8F, 0x18, 0xE1, 0x79, 0x4C, 0x4F,
+    0xEC, 0xEF, 0xC5, 0x4C, 0xAB, 0xC6, 0xB4, 0x7B, 0xB6, 0x9E, 0xEB, 0x75, 0xAC, 0x85, 0xF0, 0x4A,
+    0x74, 0x95, 0x1D, 0x1E, 0xD9, 0xEC, 0xF0, 0x66, 0xCE, 0x0E, 0xCF, 0x37, 0xF9, 0x0E, 0x3B, 0xE5,
+    0x2D, 0xA2, 0xEB, 0xA9, 0x8E, 0x90, 0xBC, 0xA4, 0x9C, 0xE7, 0xA5, 0x8F, 0xAC, 0x2B, 0x6F, 0x70,
+    0x10, 0x63, 0x73, 0xE1, 0x17, 0x86, 0x96, 0x2B, 0x7F, 0x8F, 0x2D, 0x1F, 0xBF, 0x81, 0xBB, 0xEC,
+    0x63, 0x6C, 0xA4, 0x3D, 0x6C, 0xC6, 0x58, 0x04, 0x13, 0xF6, 0x58, 0xDB, 0xF8, 0x5F, 0x10, 0x24,
+    0xA3, 0x7A, 0xCD, 0xA4, 0x63, 0xC6, 0x26, 0xA1, 0xEF, 0xC6, 0xC2, 0x34, 0x8D, 0x6A, 0x34, 0x97,
+    0xA3, 0xB5, 0x85, 0x30, 0x4A, 0x1E, 0x5A, 0x74, 0x67, 0x8C, 0xE3, 0x0C, 0xDF, 0xFF, 0xE8, 0x99,
+    0x19, 0x74, 0xD5, 0x90, 0x3E, 0xD9, 0xB9, 0xBC, 0x11, 0x13, 0x81, 0xEF, 0xBC, 0x8E, 0x37, 0x89,
+    0xEA, 0xB3, 0x73, 0xDC, 0x8F, 0xB6, 0x3D, 0xAD, 0x55, 0xC2, 0x62, 0x8B, 0xE2, 0x7F, 0xDD, 0x90,
+    0x4D, 0x37, 0xE7, 0x2D, 0xE5, 0x30, 0xC7, 0x9D, 0x19, 0x68, 0x6E, 0x27, 0x0C, 0xED, 0x44, 0x15,
+    0xE6, 0x13, 0xAF, 0x13, 0xF3, 0x92, 0x6C, 0xAF, 0x5C, 0xF9, 0x98, 0x8E, 0x5B, 0x07, 0xDC, 0xAD,
+    0x57, 0xB0, 0x5C, 0x26, 0x42, 0x8E, 0x0E, 0x69, 0x29, 0x69, 0xDF, 0x7A, 0x63, 0x11, 0x88, 0xC4,
+    0xE8, 0xF3, 0x8D, 0xAC, 0x1D, 0x86, 0xFF, 0x77, 0x87, 0x63, 0x0D, 0xAB, 0x6C, 0x24, 0xFC, 0xB9,
+    0xCA, 0xD6, 0x7C, 0xAD, 0x38, 0x4C, 0x9B, 0x40, 0xD3, 0xF1, 0x3F, 0x06, 0x80, 0x67, 0x78, 0xFB,
+    0xFC, 0x71, 0x98, 0x0D, 0xFE, 0xEC, 0xC5, 0x06, 0xFF, 0xEB, 0xC2, 0xE1, 0xC5, 0x8E, 0xE5, 0x73,
+    0x1C, 0x0F, 0x3B, 0xBB, 0x9E, 0xF4, 0xA1, 0x74, 0xB1, 0x7E, 0x8E, 0x7E, 0x3A, 0xEE, 0xE3, 0x7E,
+    0xD5, 0xCF, 0xFF, 0x03, 0xED, 0x5B, 0xBD, 0x8F, 0xDD, 0xC6, 0x11, 0x5F, 0xF2, 0xE5, 0xF4, 0x12,
+    0x31, 0x00, 0x53, 0x58, 0x36, 0x2C, 0x01, 0x61, 0x93, 0x22, 0x50, 0x0A, 0xD6, 0x69, 0x44, 0xC2,
+    0x01, 0x92, 0xC2, 0x85, 0x54, 0xE8, 0xEC, 0x22, 0x85, 0x52, 0x58, 0x85, 0xD5, 0x5C, 0x1D, 0x20,
+    0x16, 0x9F, 0x93, 0x22, 0x45, 0x8A, 0xA8, 0xB0, 0x2A, 0x17, 0x51, 0xA1, 0x00, 0xD2, 0xA9, 0xD0,
+    0x3F, 0x20, 0x9B, 0x74, 0x5C, 0xB8, 0x48, 0x61, 0x06, 0x86, 0x90, 0xD2, 0x8C, 0x23, 0x24, 0x88,
+    0x52, 0x98, 0x01, 0xE8, 0x80, 0x92, 0x49, 0x6E, 0xE6, 0xF7, 0x9B, 0x25, 0xDF, 0x87, 0x24, 0xE8,
+    0xF4, 0x75, 0x3A, 0x19, 0x79, 0xB8, 0x9D, 0x99, 0x7B, 0x8F, 0x5C, 0xEE, 0xCE, 0xCC, 0xCE, 0xCE,
+    0xC7, 0xD2, 0x18, 0xF9, 0x78, 0xA7, 0x01, 0x4D, 0xD8, 0x1B, 0x2F, 0xB7, 0x8B, 0xB0, 0x33, 0x91,
+    0xB5, 0xAD, 0xA0, 0xDC, 0x5A, 0x1B, 0x37, 0xBE, 0xC5, 0xA7, 0x9A, 0xDB, 0x5B, 0x73, 0x6B, 0x8B,
+    0xD0, 0xA6, 0xC6, 0x0E, 0x26, 0xEA, 0x8D, 0x49, 0x5A, 0x13, 0x77, 0x06, 0x4D, 0x28, 0x13, 0x09,
+    0x6A, 0xD8, 0xC9, 0x88, 0xEA, 0x35, 0xB4, 0xFE, 0x9B, 0xDC, 0x20, 0x0F, 0x70, 0xB7, 0xBB, 0xCE,
+    0x42, 0x6B, 0x4C, 0xDE, 0x98, 0x39, 0x9E, 0x55, 0x9B, 0x19, 0x9E, 0x5A, 0x18, 0x03, 0x94, 0xCA,
+    0x65, 0xD6, 0xCA, 0xC5, 0x46, 0x06, 0x73, 0x81, 0x43, 0x3E, 0x65, 0xF4, 0x13, 0xB5, 0x0E, 0x7A,
+    0x67, 0x4D, 0xDC, 0x98, 0xCC, 0x56, 0x49, 0x2D, 0x17, 0x0D, 0xB6, 0x0C, 0x70, 0xE7, 0x22, 0xB4,
+    0xD7, 0x6C, 0x8F, 0x87, 0xD8, 0x0A, 0x0F, 0xCF, 0x6A, 0x0C, 0x48, 0xFE, 0x94, 0xC8, 0xAA, 0x15,
+    0x7A, 0xFC, 0x09, 0x7F, 0x8D, 0xC9, 0x6B, 0xB9, 0xCB, 0xB3, 0xA5, 0x0C, 0xEB, 0x4B, 0x19, 0x87,
+    0xCC, 0x5D, 0x86, 0xE7, 0x59, 0xE9, 0x0C, 0x83, 0xA9, 0xF0, 0xD4, 0xD3, 0x6E, 0x0C, 0x23, 0x03,
+    0xE7, 0x43, 0x52, 0xC9, 0x08, 0x5F, 0xEF, 0xA5, 0x07, 0xDF, 0x9E, 0xEC, 0x88, 0x76, 0x5A, 0x22,
+    0x5B, 0x2B, 0x2A, 0x88, 0xC8, 0x16, 0x5F, 0xE6, 0xF5, 0xE4, 0x68, 0x36, 0x22, 0xF2, 0x30, 0x10,
+    0x14, 0x0D, 0x26, 0x1E, 0x84, 0xBF, 0x96, 0x2C, 0x03, 0x1F, 0x85, 0xE9, 0x46, 0xB9, 0x29, 0xA2,
+    0xED, 0x39, 0xD6, 0x23, 0xE3, 0xD8, 0xD1, 0x8D, 0x31, 0xBC, 0x5F, 0x51, 0x5E, 0x1A, 0xFB, 0xC9,
+    0x40, 0xF4, 0x79, 0x47, 0x24, 0xF7, 0x13, 0x95, 0x44, 0x77, 0x0C, 0x51, 0xF1, 0x48, 0xA8, 0xF2,
+    0x89, 0x9A, 0x39, 0x50, 0x66, 0x73, 0xA0, 0x44, 0x87, 0x14, 0xDA, 0x21, 0x29, 0x30, 0x8E, 0x06,
+    0xC8, 0x6C, 0x99, 0xE5, 0xE7, 0x68, 0x6A, 0xAE, 0x8C, 0x72, 0xAE, 0x83, 0xD6, 0x91, 0xF3, 0x3E,
+    0xA9, 0x46, 0xC6, 0xEB, 0xA4, 0xF8, 0xC9, 0xED, 0x74, 0x5F, 0xDC, 0x9B, 0x07, 0x7C, 0x12, 0x7B,
+    0x37, 0xC5, 0x5D, 0xA2, 0x53, 0x09, 0x64, 0x49, 0xE5, 0x5E, 0x60, 0x24, 0x8B, 0x25, 0x59, 0xFB,
+    0x7A, 0xC1, 0x57, 0x3F, 0xB7, 0xAD, 0xD9, 0xDE, 0x3E, 0x63, 0xA9, 0x1E, 0x50, 0x3F, 0x28, 0x79,
+    0x6D, 0xC2, 0x01, 0x3D, 0x35, 0x20, 0xC1, 0x6F, 0x99, 0xDD, 0x28, 0x08, 0x4F, 0x86, 0xE3, 0xC8,
+    0x49, 0x2E, 0x0B, 0x13, 0xC8, 0xF5, 0x8E, 0x94, 0x0E, 0x46, 0x12, 0x0B, 0xC3, 0x91, 0x50, 0x27,
+    0xBD, 0x8D, 0x6C, 0x52, 0x71, 0x52, 0x22, 0xFA, 0x88, 0xB0, 0x57, 0x12, 0x92, 0x6D, 0x95, 0x94,
+    0xE1, 0x88, 0xC2, 0x82, 0x7C, 0x45, 0xC4, 0x43, 0x7D, 0xC4, 0xD0, 0x2B, 0x0E, 0xBD, 0xE0, 0x84,
+    0x66, 0x23, 0xD9, 0x9A, 0x91, 0x1C, 0xD2, 0x69, 0x5D, 0xE1, 0x73, 0xD5, 0x1C, 0xBA, 0xA4, 0x54,
+    0xB6, 0x88, 0x2B, 0xF2, 0xC6, 0xC4, 0x35, 0x99, 0x20, 0x4F, 0x0C, 0x64, 0x9D, 0xB3, 0x23, 0xB9,
+    0xA7, 0x23, 0x25, 0x0F, 0x94, 0xA6, 0x7C, 0x31, 0xD3, 0x38, 0x1C, 0x25, 0x5C, 0x91, 0x4B, 0x4A,
+    0x1D, 0xB1, 0xA3, 0x64, 0x46, 0x4B, 0x6A, 0xF7, 0x1A, 0xB5, 0x7F, 0xC6, 0x0E, 0xD3, 0x25, 0x6F,
+    0x96, 0xAC, 0x59, 0x72, 0xC6, 0x31, 0x51, 0x54, 0x4E, 0x99, 0xE1, 0xEB, 0xD7, 0xD2, 0xF3, 0xDC,
+    0x8E, 0xAC, 0x00, 0x57, 0x74, 0x04, 0x60, 0x8A, 0x32, 0x02, 0x3C, 0x21, 0x1F, 0x30, 0x82, 0x6A,
+    0x92, 0x6B, 0x4D, 0x2E, 0x38, 0x4A, 0x98, 0xE0, 0xEB, 0x64, 0xCC, 0x91, 0xF4, 0xF0, 0xC2, 0xBC,
+    0x8D, 0xF9, 0x57, 0x41, 0x33, 0xEB, 0x48, 0xCC, 0x86, 0xA8, 0x21, 0x41, 0x8D, 0x27, 0x91, 0xC8,
+    0xD3, 0x49, 0x44, 0x83, 0x51, 0x02, 0x9F, 0x43, 0xA7, 0x1C, 0x61, 0xBB, 0xAC, 0x12, 0x93, 0xD9,
+    0x09, 0x6B, 0x95, 0xC0, 0xD2, 0x23, 0x11, 0x89, 0xF5, 0xA9, 0x8E, 0xEE, 0xE6, 0x5D, 0x22, 0xA6,
+    0x84, 0x42, 0x86, 0x65, 0x11, 0xC2, 0x96, 0x19, 0xAD, 0x8F, 0xCC, 0x0B, 0x76, 0xA7, 0xC2, 0xB4,
+    0xF0, 0xA0, 0x0A, 0x66, 0x51, 0x09, 0x67, 0xAD, 0x2A, 0x5C, 0xCF, 0x8B, 0xA9, 0x5C, 0xB8, 0x9D,
+    0x6B, 0x1D, 0x1D, 0x82, 0x03, 0x91, 0x98, 0xA7, 0x4A, 0xAC, 0x63, 0x1F, 0xBA, 0x19, 0xF7, 0x32,
+    0x8C, 0x84, 0x84, 0xC9, 0xDB, 0x48, 0x89, 0x71, 0x51, 0x71, 0xE1, 0x88, 0x7C, 0x31, 0x77, 0x0A,
+    0xE3, 0x79, 0x22, 0xB1, 0xD2, 0x0F, 0x42, 0xBA, 0xB6, 0x17, 0x6A, 0x91, 0x80, 0xB6, 0x8E, 0xD1,
+    0x4C, 0x05, 0x96, 0x8B, 0x3C, 0xE0, 0x5E, 0x20, 0xA8, 0xA1, 0x3D, 0x50, 0x0B, 0x66, 0xCC, 0x4B,
+    0xCE, 0x26, 0x70, 0x9A, 0xAA, 0x62, 0xB8, 0x1D, 0xC8, 0xE7, 0x1A, 0x36, 0xE6, 0x2D, 0x45, 0x66,
+    0x15, 0xF9, 0x7A, 0xE5, 0xB3, 0x42, 0x32, 0xA3, 0x07, 0xA1, 0x15, 0xFB, 0x3B, 0x99, 0xE1, 0x54,
+    0x67, 0xA6, 0xFF, 0x38, 0xD4, 0x2B, 0x6A, 0xF5, 0xC2, 0x0B, 0xA2, 0xB6, 0xE6, 0x54, 0x5E, 0xCE,
+    0xFA, 0xBC, 0x9C, 0xDB, 0x5C, 0x36, 0x3A, 0xA1, 0x07, 0xB1, 0xB4, 0x6F, 0x49, 0x33, 0xDA, 0xE6,
+    0xC3, 0xD3, 0x68, 0xD8, 0xD2, 0xB4, 0xC1, 0x84, 0xC9, 0x36, 0x0D, 0xC6, 0x6B, 0xAB, 0xC1, 0x76,
+    0xF0, 0x3F, 0x2B, 0x84, 0xB7, 0x90, 0x47, 0x56, 0x88, 0x5E, 0x8A, 0xF4, 0x1C, 0x21, 0x13, 0x71,
+    0x44, 0x31, 0x12, 0xA5, 0x23, 0x64, 0x6B, 0x55, 0x22, 0x6B, 0x1D, 0x71, 0xB2, 0x73, 0xC4, 0xEB,
+    0xD6, 0x11, 0x3F, 0xB1, 0xA9, 0x12, 0xAF, 0xD9, 0x42, 0x89, 0x54, 0xD6, 0x0C, 0x09, 0x59, 0x31,
+    0x8E, 0x48, 0x5A, 0x47, 0x84, 0x9D, 0x23, 0x02, 0xEB, 0x88, 0x99, 0xCD, 0x95, 0xC0, 0x16, 0x41,
+    0xC2, 0x4C, 0x44, 0x36, 0x12, 0xF1, 0x48, 0x84, 0x23, 0x11, 0x90, 0x30, 0x66, 0x65, 0x4B, 0x34,
+    0x34, 0x39, 0xF8, 0x6C, 0xED, 0x0C, 0x6E, 0x33, 0x52, 0xFD, 0x03, 0xD1, 0x8C, 0x84, 0xDB, 0x92,
+    0xA2, 0x61, 0xDA, 0x6B, 0x9C, 0x8B, 0x32, 0xEB, 0x95, 0x4D, 0x81, 0x55, 0x2E, 0x05, 0x56, 0x99,
+    0x34, 0xEF, 0x95, 0x47, 0xE6, 0x94, 0xB2, 0xC8, 0x38, 0x0E, 0x19, 0xC7, 0xA0, 0xF9, 0xA0, 0xFC,
+    0x11, 0x4C, 0xF6, 0x08, 0x26, 0x77, 0x04, 0x93, 0x39, 0x82, 0xC9, 0x1B, 0xC1, 0x64, 0x8D, 0x60,
+    0x72, 0x06, 0x18, 0x8C, 0x01, 0x06, 0x5F, 0x80, 0xC1, 0x16, 0x60, 0x70, 0x05, 0x18, 0x4C, 0x01,
+    0x36, 0x23, 0xCE, 0x1C, 0x8E, 0x1D, 0x0E, 0x1D, 0x0E, 0x80, 0x1D, 0x17, 0x36, 0x70, 0x30, 0x32,
+    0x43, 0x37, 0x5B, 0xB7, 0x26, 0x05, 0xB7, 0x0E, 0xD7, 0x66, 0x6D, 0x75, 0x2A, 0x3B, 0xE6, 0x7A,
+    0x55, 0x38, 0xAC, 0xA2, 0xB9, 0x76, 0xE1, 0x5D, 0x58, 0xDD, 0xF9, 0x45, 0x8D, 0x7F, 0x23, 0x7D,
+    0x05, 0x7D, 0xFE, 0xA9, 0xAC, 0x03, 0x41, 0x30, 0xE6, 0x40, 0xEF, 0xDB, 0x42, 0x50, 0xEB, 0x11,
+    0xD5, 0x62, 0x4A, 0x97, 0x48, 0x8C, 0x25, 0x50, 0xF9, 0x34, 0x90, 0xCE, 0x62, 0x0D, 0x85, 0x8A,
+    0x22, 0xCE, 0x21, 0xB4, 0x0E, 0x35, 0x8A, 0x2A, 0x65, 0x4A, 0x6A, 0x8E, 0xA7, 0x9E, 0x78, 0x2D,
+    0x71, 0x15, 0xCA, 0x0F, 0x41, 0x97, 0x95, 0xF4, 0x5A, 0x61, 0xC4, 0x2C, 0x67, 0x9B, 0x74, 0x9B,
+    0x4E, 0x49, 0xDE, 0xEA, 0x2E, 0x42, 0xE3, 0xD5, 0x4F, 0x0B, 0x7F, 0x36, 0x00, 0x06, 0x1D, 0xEE,
+    0x0D, 0x3B, 0xBA, 0x4A, 0x6D, 0x2E, 0x30, 0x6E, 0x12, 0xDD, 0x4A, 0x6A, 0x6C, 0x45, 0xE2, 0xF4,
+    0xCA, 0x70, 0xE1, 0x06, 0x8B, 0x73, 0xDE, 0xC1, 0x6A, 0x06, 0xEA, 0xD6, 0x0C, 0xBA, 0xD5, 0xD3,
+    0x73, 0xB5, 0x29, 0xBD, 0xE1, 0x22, 0x1C, 0xB6, 0xDF, 0xB0, 0x05, 0xC6, 0x2F, 0x9B, 0xB2, 0xDC,
+    0x92, 0x63, 0x3F, 0x92, 0xDD, 0x85, 0xDB, 0x66, 0x8B, 0x29, 0xC4, 0xDD, 0xA1, 0x0B, 0xE6, 0xB8,
+    0x28, 0xAD, 0x98, 0x51, 0x59, 0x8E, 0xD0, 0x58, 0x08, 0x32, 0xC2, 0xE3, 0x83, 0x51, 0x94, 0x66,
+    0xEB, 0x2C, 0x7D, 0x2F, 0x6C, 0xC8, 0x32, 0x6C, 0x3C, 0xC7, 0xF8, 0x5F, 0xF1, 0x67, 0xDA, 0x31,
+    0x9A, 0xEE, 0x37, 0x44, 0xCD, 0x72, 0x88, 0x4C, 0xDD, 0xAA, 0x7F, 0x8B, 0x76, 0x36, 0xF2, 0x43,
+    0x5E, 0x01, 0x94, 0x3E, 0xA8, 0xB9, 0x7C, 0x77, 0x67, 0xC7, 0xF9, 0x5F, 0xB2, 0xA8, 0xB2, 0x85,
+    0x38, 0xFF, 0xC9, 0x82, 0x86, 0xFC, 0x9C, 0xF1, 0x2E, 0x27, 0x65, 0x54, 0x63, 0xCE, 0xF2, 0x80,
+    0x94, 0x9C, 0xC9, 0xDA, 0x89, 0x69, 0x01, 0x9D, 0x7B, 0x04, 0x24, 0xB6, 0x38, 0x64, 0xD5, 0xC3,
+    0x7A, 0x92, 0xE6, 0x4B, 0x1F, 0x63, 0x7F, 0x68, 0x6F, 0x1B, 0xFF, 0x12, 0x9F, 0xDF, 0xC8, 0x92,
+    0x91, 0xF9, 0x79, 0x90, 0x4F, 0xDE, 0xAC, 0x48, 0xAD, 0x7A, 0x3A, 0x4D, 0x3D, 0x90, 0xB0, 0xC1,
+    0xCA, 0x98, 0x0D, 0x31, 0x37, 0x47, 0x3A, 0x1E, 0x09, 0xD9, 0xBD, 0x62, 0x50, 0x9C, 0xCF, 0x9B,
+    0x83, 0xBB, 0x08, 0xD1, 0x0C, 0x23, 0x34, 0xF5, 0x61, 0x0B, 0xC6, 0x67, 0x15, 0xC3, 0xB3, 0x5A,
+    0x03, 0x2A, 0x8D, 0xAE, 0x34, 0x36, 0xD3, 0xB8, 0xCB, 0xC1, 0x7A, 0x05, 0xAE, 0x7E, 0xCF, 0xA0,
+    0x4C, 0xEF, 0xD2, 0x1E, 0x34, 0x22, 0xD3, 0x80, 0xCC, 0xF9, 0x8D, 0x1A, 0x8E, 0x69, 0x34, 0xE6,
+    0x82, 0x31, 0xC4, 0x62, 0xFE, 0x65, 0x59, 0xB2, 0xBE, 0x6C, 0xDD, 0xA9, 0xC9, 0x3F, 0xC1, 0xBD,
+    0x18, 0x1D, 0xD7, 0xC4, 0x5C, 0xB7, 0x71, 0x5C, 0x77, 0x16, 0xBE, 0x93, 0x85, 0xD3, 0x63, 0xB1,
+    0x95, 0x48, 0x47, 0xA1, 0x7D, 0xD3, 0x16, 0x08, 0xCE, 0x4A, 0x06, 0x60, 0x74, 0xFC, 0x18, 0x87,
+    0x31, 0x30, 0x53, 0x50, 0xAB, 0xAA, 0x3B, 0xD7, 0x89, 0x17, 0x23, 0xA8, 0x2B, 0x18, 0x91, 0x79,
+    0x1C, 0x88, 0xC6, 0x63, 0x08, 0xC2, 0xAE, 0x18, 0x51, 0x5F, 0x03, 0xF3, 0x28, 0x63, 0xF8, 0x9B,
+    0xE5, 0xC2, 0xD4, 0x15, 0xD5, 0x70, 0x75, 0x55, 0x1B, 0xE1, 0x40, 0xE5, 0x76, 0xEA, 0x67, 0x07,
+    0xE1, 0x87, 0x34, 0xD8, 0x4B, 0x34, 0x3A, 0xD3, 0xE0, 0x4C, 0x63, 0x33, 0x17, 0x9A, 0xA9, 0x3F,
+    0xEE, 0x02, 0x33, 0xC4, 0x65, 0x5C, 0x81, 0xF3, 0x4E, 0xD8, 0xE9, 0xD9, 0x93, 0xAD, 0x5B, 0x81,
+    0xF1, 0xFA, 0x0A, 0xA4, 0x06, 0x22, 0xB8, 0x7A, 0x5C, 0x80, 0x88, 0x8C, 0xF1, 0x18, 0xA3, 0x31,
+    0xC6, 0x62, 0x8C, 0xC4, 0x34, 0x0E, 0xDB, 0x5A, 0x0D, 0x99, 0xEC, 0x06, 0xD4, 0xCF, 0xA1, 0xF4,
+    0x87, 0x08, 0xB5, 0x0A, 0x7E, 0x5F, 0x5A, 0xD2, 0x03, 0x03, 0xB8, 0x97, 0x0E, 0x36, 0x7B, 0xBD,
+    0xDD, 0xDD, 0x4B, 0xD0, 0xC1, 0x46, 0x01, 0xFF, 0xD5, 0x4F, 0x37, 0xAF, 0x8C, 0x37, 0x84, 0xD2,
+    0x37, 0x00, 0xFF, 0xDD, 0x47, 0x6E, 0xAB, 0xA7, 0xAB, 0xDB, 0x6B, 0xD8, 0x4E, 0xEE, 0xBA, 0xC9,
+    0xD2, 0x17, 0x99, 0xDB, 0x32, 0x44, 0x2C, 0x4C, 0x18, 0x17, 0x0D, 0x9C, 0xA0, 0xC2, 0xB3, 0x7E,
+    0xCC, 0xE1, 0x3C, 0x57, 0x96, 0x9F, 0x37, 0xB1, 0x0C, 0x26, 0xFA, 0x0B, 0x18, 0x39, 0xFF, 0xBA,
+    0xA5, 0x77, 0xCD, 0xE7, 0xEF, 0x2E, 0x5E, 0x68, 0x05, 0x4F, 0xC5, 0x16, 0xFA, 0xED, 0x0C, 0x9E,
+    0x41, 0x54, 0xBA, 0x8D, 0x84, 0xAE, 0x16, 0x13, 0x55, 0xCF, 0x95, 0xE5, 0x39, 0xBD, 0x42, 0x66,
+    0x31, 0x9C, 0x57, 0xE5, 0xA9, 0x49, 0x49, 0x5E, 0x6C, 0x96, 0x6F, 0x4F, 0xC1, 0x1B, 0xA3, 0x57,
+    0x86, 0x97, 0xCC, 0x58, 0x3D, 0x7F, 0x96, 0xBF, 0xFC, 0x9E, 0x7A, 0x4B, 0xF0, 0x19, 0x1A, 0x80,
+    0xDE, 0x44, 0x17, 0x76, 0xEC, 0x64, 0x71, 0x38, 0x60, 0x5B, 0x1C, 0xD9, 0xDE, 0x96, 0x30, 0x02,
+    0xE9, 0x9A, 0x09, 0x14, 0x19, 0x9E, 0x91, 0x10, 0x88, 0x03, 0xB0, 0x88, 0xFA, 0x33, 0x16, 0x8C,
+    0xE8, 0xC1, 0x07, 0x38, 0x8E, 0xB8, 0x7F, 0x4A, 0xC5, 0x32, 0xE5, 0x58, 0xAC, 0x43, 0xB7, 0xF3,
+    0x5F, 0x78, 0x15, 0xEC, 0xA8, 0x21, 0xE3, 0xB0, 0xC1, 0xDE, 0xAC, 0xB4, 0x97, 0x6E, 0x1D, 0x54,
+    0x2F, 0x58, 0x76, 0x85, 0xCB, 0xE8, 0xA0, 0x55, 0xC0, 0x7F, 0xF5, 0x73, 0x03, 0xB2, 0xB4, 0xE2,
+    0xDC, 0x13, 0x98, 0x0F, 0x26, 0x59, 0xEE, 0x83, 0x53, 0xFC, 0x10, 0x3E, 0xC3, 0x97, 0x84, 0xCB,
+    0xC8, 0x11, 0xC5, 0x84, 0x58, 0xFF, 0x32, 0xB4, 0xF4, 0x45, 0xE1, 0xF3, 0xF6, 0xF6, 0x69, 0x17,
+    0x2B, 0xCE, 0x30, 0x4E, 0xE6, 0xE4, 0x08, 0xBC, 0xC9, 0xF5, 0xDE, 0x17, 0x3E, 0xCB, 0x40, 0x4E,
+    0x69, 0xBA, 0x45, 0xE3, 0xBB, 0x4D, 0xBC, 0xF9, 0xE1, 0xBC, 0x2B, 0xCD, 0xBA, 0x6B, 0xC0, 0xA4,
+    0x38, 0x71, 0x38, 0xBB, 0x6D, 0x2F, 0xA2, 0xC7, 0xFC, 0x23, 0xF5, 0x87, 0xED, 0xBB, 0xC4, 0xBE,
+    0xD5, 0x34, 0xD7, 0xCC, 0xE1, 0xB9, 0xC4, 0x5D, 0x37, 0xB7, 0x53, 0x91, 0x80, 0x47, 0x1B, 0x13,
+    0xB5, 0x8A, 0x93, 0x5A, 0x31, 0xB2, 0x80, 0xB7, 0x65, 0x77, 0x62, 0x30, 0xAC, 0x59, 0x7D, 0x60,
+    0xDF, 0xE1, 0x99, 0xC3, 0x01, 0x38, 0x4F, 0x41, 0x2A, 0x3B, 0x50, 0x1F, 0xB1, 0x5A, 0x83, 0x20,
+    0xCE, 0x1C, 0x96, 0x38, 0xC3, 0xD3, 0xF1, 0xC9, 0xEA, 0x5F, 0xF1, 0xF6, 0xEE, 0xC5, 0x23, 0xEF,
+    0x2F, 0x9B, 0xAD, 0xF7, 0xF8, 0xBC, 0x12, 0x71, 0x80, 0xB0, 0xF7, 0x6B, 0x3B, 0x16, 0x6B, 0x20,
+    0xC3, 0x5B, 0x81, 0x6D, 0x22, 0x55, 0xAA, 0x62, 0x36, 0x70, 0x82, 0x0B, 0x1F, 0x3D, 0xBC, 0x42,
+    0x0C, 0x99, 0x40, 0x5E, 0xE4, 0x92, 0xE0, 0x44, 0x1C, 0x79, 0xE0, 0xAC, 0xD1, 0xFC, 0x17, 0xCC,
+    0xD9, 0x82, 0x78, 0x46, 0xAD, 0x86, 0x94, 0x2A, 0xF3, 0x6D, 0x03, 0x41, 0x0D, 0x6F, 0x30, 0x09,
+    0xFD, 0x39, 0x84, 0x2E, 0xDC, 0x9D, 0xA9, 0xF0, 0x5B, 0x31, 0x42, 0xB7, 0x68, 0x83, 0xBD, 0xD3,
+    0xCB, 0x61, 0xEE, 0xE0, 0xBB, 0x80, 0x25, 0x9B, 0x84, 0xD0, 0x69, 0xE8, 0x1D, 0xEF, 0x06, 0x52,
+    0x1A, 0x5C, 0x42, 0xCB, 0x48, 0x3E, 0x26, 0x4C, 0x1A, 0x85, 0x08, 0x36, 0x61, 0xED, 0x36, 0x20,
+    0xD6, 0xBB, 0x40, 0xEF, 0x9A, 0xBD, 0x15, 0xB7, 0xD0, 0xD5, 0xA8, 0x03, 0x0C, 0x2D, 0xBE, 0x11,
+    0xFB, 0xEB, 0x21, 0x79, 0x3F, 0x5C, 0x43, 0xFC, 0x35, 0x86, 0x48, 0x96, 0x89, 0xE6, 0x3B, 0x60,
+    0xDB, 0x29, 0xE6, 0x8B, 0x21, 0xB0, 0x3E, 0x91, 0x39, 0xD9, 0xAC, 0x62, 0xBA, 0x36, 0xB6, 0xD7,
+    0x45, 0xE7, 0x90, 0xCA, 0x15, 0xC9, 0xE4, 0x15, 0xD3, 0xBC, 0x4C, 0xFA, 0x32, 0x05, 0xAC, 0x14,
+    0xBE, 0x63, 0xE8, 0x93, 0xF4, 0x3E, 0xB3, 0xCA, 0xB6, 0x92, 0x99, 0x81, 0x53, 0xBD, 0x5C, 0xB5,
+    0x53, 0xD1, 0xA9, 0x12, 0x30, 0x73, 0x76, 0x59, 0xC1, 0xAB, 0xA8, 0x45, 0x44, 0x77, 0xAF, 0x43,
+    0xB5, 0x85, 0x01, 0x0C, 0x17, 0x35, 0x72, 0xD4, 0xA2, 0x8A, 0x8B, 0x37, 0x7B, 0xC4, 0x9B, 0xAE,
+    0x8A, 0x92, 0xD9, 0xFB, 0xD7, 0x4E, 0x9E, 0x84, 0x99, 0xB2, 0x8C, 0xCC, 0xFD, 0x98, 0x49, 0x08,
+    0xA5, 0x4C, 0x63, 0xA8, 0x68, 0x2A, 0x3A, 0xE3, 0x21, 0x1C, 0x04, 0x9C, 0x5B, 0x59, 0xA0, 0xA9,
+    0xD6, 0x60, 0x1E, 0xC4, 0x4C, 0xFF, 0x92, 0xCC, 0xC3, 0x25, 0x29, 0x7E, 0x8B, 0x9A, 0x0A, 0x56,
+    0x65, 0x88, 0xB0, 0x79, 0x19, 0x6F, 0x4E, 0xFC, 0x9E, 0x4D, 0xFC, 0x8E, 0xEC, 0xFB, 0xE0, 0xB7,
+    0xB1, 0xCA, 0xD1, 0x4D, 0x7E, 0xAF, 0x32, 0x3D, 0x71, 0x4C, 0x87, 0x70, 0x22, 0x88, 0x89, 0x1D,
+    0xB0, 0x2B, 0x31, 0xA1, 0x02, 0xB6, 0x52, 0x72, 0x3E, 0xA7, 0x4F, 0x5B, 0x7E, 0x5F, 0x86, 0x5D,
+    0x44, 0x6A, 0x4A, 0x46, 0x7E, 0xFB, 0xF9, 0xB0, 0xD8, 0x73, 0x30, 0x27, 0xDF, 0xC4, 0xAD, 0x80,
+    0xBC, 0x86, 0x2E, 0x95, 0xC8, 0x43, 0xA6, 0x30, 0xA1, 0x46, 0x03, 0xE4, 0x02, 0x29, 0xAE, 0x8F,
+    0x64, 0x82, 0xF6, 0x63, 0xA4, 0xED, 0x3E, 0x95, 0xB5, 0x65, 0xBF, 0x84, 0x65, 0x85, 0x09, 0x1F,
+    0xA5, 0x22, 0x3F, 0xFC, 0x17, 0x31, 0x7A, 0x21, 0xCF, 0x90, 0xCD, 0xBB, 0x19, 0xEF, 0x65, 0x2F,
+    0xC8, 0xD7, 0x4A, 0xA7, 0x05, 0x2E, 0xA8, 0xDC, 0x83, 0x4C, 0xD2, 0x21, 0xCF, 0x01, 0x67, 0x2B,
+    0x42, 0x3E, 0xA0, 0x81, 0xC5, 0x9F, 0x73, 0xC9, 0x7B, 0x9A, 0xDE, 0x5A, 0xCD, 0x78, 0x1C, 0x49,
+    0x97, 0xD5, 0x8F, 0x3D, 0x42, 0x59, 0xBD, 0x59, 0x05, 0x37, 0x43, 0x04, 0x80, 0xAC, 0x27, 0x98,
+    0x2F, 0x10, 0x5E, 0x60, 0xF6, 0x05, 0x6B, 0x81, 0x7F, 0xC5, 0xC3, 0xB2, 0x2F, 0x7B, 0x2A, 0xE0,
+    0x40, 0x08, 0xBE, 0x64, 0xD4, 0xC9, 0xAC, 0xE5, 0x95, 0x15, 0x76, 0x8F, 0xAC, 0x82, 0x61, 0xC9,
+    0x2A, 0xE4, 0xC6, 0x33, 0xDA, 0x87, 0xB1, 0x7F, 0x31, 0x1F, 0x07, 0x35, 0x37, 0x32, 0xA7, 0xBB,
+    0x1B, 0x72, 0x87, 0x8E, 0xA9, 0x98, 0x09, 0x99, 0x98, 0xDC, 0x24, 0x1C, 0x96, 0x29, 0x63, 0xFF,
+    0xCA, 0xB3, 0x4F, 0x91, 0x78, 0xB4, 0xCC, 0x60, 0x56, 0x00, 0x01, 0x85, 0xF0, 0x0D, 0xC2, 0xAF,
+    0x10, 0x1C, 0xE8, 0xE6, 0x81, 0x01, 0x9E, 0x4B, 0xC7, 0xCD, 0x6F, 0xCE, 0x8D, 0x41, 0xE1, 0xCC,
+    0x6E, 0xA6, 0x4E, 0x0E, 0x1E, 0xAB, 0x35, 0x0F, 0x5B, 0xAE, 0xB0, 0x7A, 0xB1, 0x64, 0x75, 0x3C,
+    0x2C, 0xF3, 0xCD, 0xDE, 0x55, 0x01, 0x74, 0x34, 0x78, 0xFF, 0x12, 0xEC, 0x4B, 0x9A, 0x6A, 0x92,
+    0x01, 0x1D, 0xC7, 0xB0, 0x1A, 0x65, 0x10, 0xAC, 0xC9, 0x80, 0x06, 0xCE, 0xEF, 0x0D, 0x0D, 0x5C,
+    0x3F, 0x19, 0xB8, 0xB5, 0x84, 0x9A, 0x73, 0x05, 0x6D, 0x19, 0xAD, 0x81, 0x62, 0x6B, 0xFB, 0x0C,
+    0x8F, 0x4C, 0x74, 0x2E, 0xDE, 0xF2, 0xD5, 0x4F, 0x1C, 0x73, 0xCF, 0x19, 0xD8, 0xC5, 0xB5, 0x96,
+    0xC1, 0x64, 0x1C, 0xBF, 0x0E, 0xB3, 0xE9, 0xD9, 0x7A, 0x0C, 0x5B, 0xE0, 0xE3, 0x29, 0x48, 0xEA,
+    0x1F, 0xE3, 0x87, 0x64, 0xC8, 0x65, 0xE6, 0xAE, 0x3A, 0x3E, 0x80, 0x25, 0xD5, 0xBD, 0x56, 0xF8,
+    0x77, 0x0F, 0xB0, 0xC2, 0x5A, 0x1D, 0x59, 0x1B, 0xE4, 0x61, 0x54, 0x82, 0x5D, 0x01, 0x81, 0x79,
+    0x01, 0x5B, 0xB9, 0x99, 0x6B, 0xA1, 0x9B, 0xA9, 0x02, 0xF4, 0x92, 0xB1, 0x62, 0x02, 0x73, 0x74,
+    0x64, 0xC7, 0xF2, 0x8C, 0x40, 0x39, 0x86, 0x90, 0xC9, 0x3A, 0xC8, 0xEA, 0xEF, 0xA1, 0x9B, 0x13,
+    0xD8, 0x3C, 0xC6, 0x91, 0xC2, 0xBD, 0xE0, 0xAE, 0x37, 0xA4, 0xE6, 0xE1, 0xD9, 0xDC, 0xF2, 0xA9,
+    0x37, 0x1C, 0x1E, 0x51, 0x5D, 0x5D, 0x30, 0xF5, 0x9F, 0xDF, 0xFA, 0xFF, 0xF9, 0x83, 0x74, 0x22,
+    0xEF, 0xA6, 0x53, 0x7A, 0xB1, 0x9F, 0x28, 0xA7, 0x35, 0xEE, 0xAC, 0x01, 0xA8, 0x6F, 0xD2, 0x59,
+    0x03, 0xA7, 0x6A, 0x59, 0xF5, 0xE8, 0xC4, 0x0B, 0x78, 0xD6, 0x00, 0x76, 0x8C, 0x89, 0x55, 0x2A,
+    0x87, 0xE6, 0x46, 0x34, 0xE3, 0x13, 0xD5, 0x4B, 0xEB, 0x7C, 0xD0, 0x1D, 0x4D, 0x61, 0xFD, 0xEE,
+    0x58, 0xE4, 0x74, 0x07, 0x17, 0xC4, 0x0E, 0x0D, 0xD3, 0x7E, 0x73, 0x70, 0x1C, 0x4D, 0x48, 0xAC,
+    0xD2, 0x01, 0x8E, 0x03, 0xDD, 0x03, 0xA6, 0x3F, 0xB8, 0x8E, 0x6F, 0x6E, 0xE7, 0xC4, 0xD4, 0xDB,
+    0xFB, 0xE0, 0xDB, 0xBB, 0xF6, 0xBE, 0xF7, 0xDD, 0x0F, 0x7B, 0x8A, 0x45, 0x5D, 0x17, 0x88, 0x66,
+    0x31, 0x62, 0xC1, 0xA1, 0x3B, 0xE5, 0x31, 0xC3, 0xE0, 0x79, 0x30, 0x8C, 0x86, 0x7D, 0x25, 0x97,
+    0x34, 0x78, 0x32, 0x5D, 0x1B, 0x88, 0x3A, 0xD9, 0x1D, 0xCB, 0x25, 0x2E, 0x1D, 0x0D, 0xF0, 0x5E,
+    0x5B, 0x78, 0xAF, 0x08, 0x96, 0x50, 0x2C, 0xA7, 0x0B, 0x0B, 0x40, 0x2A, 0xA3, 0x5B, 0x0B, 0x00,
+    0xFF, 0xD9, 0xC7, 0xA3, 0xF9, 0xDC, 0x10, 0x0F, 0x4D, 0x7A, 0x8C, 0x49, 0x24, 0xF2, 0x67, 0x8C,
+    0x5E, 0xED, 0x32, 0x9C, 0x68, 0x4D, 0xE7, 0x89, 0x2E, 0x42, 0xF9, 0xC6, 0x5C, 0xD8, 0x43, 0x81,
+    0x39, 0x7A, 0x65, 0xE9, 0x4F, 0xB8, 0xB3, 0x1B, 0x79, 0xB9, 0x54, 0x6E, 0xBF, 0x5D, 0x57, 0x6D,
+    0x3D, 0x02, 0xA0, 0x07, 0x00, 0xB4, 0xFC, 0xAF, 0xC5, 0x7F, 0x2D, 0xFD, 0x6B, 0xE1, 0x5F, 0xCB,
+    0xFE, 0x5A, 0xF4, 0xD7, 0x92, 0xBF, 0x16, 0xFC, 0xB5, 0xDC, 0xAF, 0xC5, 0x7E, 0x2D, 0xF5, 0x6B,
+    0xA1, 0x5F, 0xCB, 0xFC, 0x5A, 0xE4, 0xD7, 0x12, 0xBF, 0x16, 0xF8, 0xB5, 0xBC, 0xAF, 0xC5, 0x7D,
+    0x2D, 0xED, 0x6B, 0x61, 0x5F, 0xCB, 0xFA, 0x5A, 0xD4, 0x37, 0xBB, 0x17, 0xC6, 0x9D, 0x94, 0xAB,
+    0x49, 0xAB, 0x0E, 0x9C, 0x47, 0x5C, 0xAC, 0x14, 0xE1, 0x59, 0x82, 0x67, 0x01, 0x9E, 0x19, 0x07,
+    0x16, 0xDF, 0x59, 0x7A, 0x67, 0xC5, 0x5D, 0x01, 0x8A, 0xEE, 0xAC, 0x99, 0x3F, 0x12, 0x30, 0xDC,
+    0x1F, 0x47, 0xC3, 0x10, 0x36, 0xCB, 0x00, 0x43, 0x93, 0x58, 0x9A, 0xA6, 0x1A, 0xB0, 0xEE, 0xFC,
+    0xFA, 0xC4, 0x04, 0xBD, 0xF6, 0x83, 0x8D, 0xF4, 0x95, 0xAF, 0xE9, 0x2B, 0xC2, 0x79, 0xBF, 0x96,
+    0xBE, 0x2A, 0xEF, 0x9B, 0xBE, 0x42, 0xE2, 0x6A, 0x4C, 0x5F, 0xDD, 0xBE, 0x3E, 0x26, 0xAE, 0x66,
+    0xCB, 0xC4, 0xD5, 0x82, 0xE9, 0x09, 0x97, 0xB8, 0x8A, 0x1F, 0x90, 0xB8, 0x1A, 0xD3, 0xD1, 0xF4,
+    0x5F, 0xCA, 0xD5, 0x92, 0x86, 0x77, 0x99, 0x96, 0x2A, 0x75, 0x55, 0xF3, 0x64, 0x2E, 0xBF, 0x9E,
+    0x00, 0x88, 0x4F, 0x16, 0xCE, 0xD5, 0x9E, 0x0F, 0x8F, 0x93, 0xCC, 0x0A, 0x1F, 0x3F, 0x69, 0x78,
+    0xDC, 0x65, 0x2F, 0x35, 0xFD, 0x4E, 0x3F, 0x81, 0x25, 0x27, 0x37, 0x8E, 0x70, 0x3C, 0xC6, 0x52,
+    0x98, 0x6F, 0x62, 0x72, 0xCB, 0xF8, 0xBB, 0x66, 0xF5, 0xBC, 0x89, 0xAB, 0x3F, 0xC8, 0xC0, 0x4B,
+    0xB3, 0x52, 0x82, 0xD8, 0x5C, 0xB5, 0x07, 0x3F, 0xD9, 0xA5, 0x56, 0x48, 0xC3, 0x5F, 0xF6, 0xA1,
+    0x67, 0x96, 0xF4, 0xA8, 0xAC, 0xA6, 0x7E, 0xC7, 0xCF, 0x8C, 0x21, 0xDB, 0xEF, 0x4B, 0x0A, 0xAF,
+    0x50, 0x1E, 0x6F, 0x84, 0x6C, 0x33, 0x86, 0x6C, 0xA1, 0x45, 0xC8, 0x16, 0x5B, 0x84, 0x6C, 0xC9,
+    0x1F, 0x10, 0xB2, 0x59, 0x84, 0x66, 0x7E, 0x87, 0x60, 0x6D, 0xD6, 0x02, 0x86, 0x35, 0xBE, 0x89,
+    0x0B, 0xC0, 0x64, 0x81, 0x90, 0xCD, 0x22, 0x64, 0x1B, 0x70, 0xA2, 0x3B, 0x92, 0x51, 0x22, 0x64,
+    0xAB, 0xEF, 0x1B, 0xB2, 0xF9, 0x5A, 0x45, 0xB9, 0x8B, 0x90, 0xCD, 0xAB, 0x57, 0x4A, 0x07, 0x3A,
+    0x95, 0x69, 0x35, 0x91, 0x43, 0x3C, 0x2B, 0x14, 0x4E, 0x71, 0xA7, 0x77, 0xF6, 0xBB, 0x9A, 0x1D,
+    0xF0, 0xC7, 0x95, 0x6A, 0xB0, 0xCD, 0x16, 0x49, 0x0B, 0xA7, 0xBF, 0x96, 0xE0, 0x48, 0x42, 0x33,
+    0x11, 0x7F, 0x95, 0xC9, 0x4A, 0xAD, 0x06, 0x89, 0xC9, 0xFE, 0xDE, 0x09, 0xF8, 0xA7, 0x28, 0x46,
+    0x82, 0x04, 0x5B, 0x82, 0x72, 0x49, 0x2C, 0xBA, 0x28, 0x81, 0xD9, 0x75, 0x17, 0x98, 0xCD, 0x31,
+    0x9C, 0x10, 0xF6, 0xD7, 0x2F, 0xC6, 0xFC, 0xA1, 0x7F, 0xF5, 0xE8, 0x25, 0x70, 0x92, 0xC7, 0x40,
+    0xED, 0xCF, 0x30, 0x88, 0xE4, 0x4F, 0x3D, 0x87, 0x92, 0xD1, 0x0E, 0x45, 0xE9, 0x81, 0x3E, 0xC0,
+    0x73, 0xEE, 0xD7, 0x12, 0xDF, 0x66, 0x9F, 0xE1, 0x24, 0x78, 0x0D, 0xB5, 0x45, 0x21, 0xC8, 0xEB,
+    0xC0, 0xC7, 0x77, 0xFC, 0x7A, 0x3F, 0x73, 0xE8, 0x47, 0x79, 0x3A, 0x84, 0x49, 0x1D, 0xD6, 0x9F,
+    0x94, 0xD1, 0x12, 0x9C, 0x23, 0xF2, 0x8D, 0xCD, 0xAC, 0x3A, 0xD0, 0x6C, 0x34, 0x87, 0xAE, 0x32,
+    0x14, 0x29, 0xD5, 0x49, 0xF0, 0xC9, 0xA8, 0xC6, 0x74, 0x46, 0x4C, 0xF9, 0x3B, 0xFB, 0x78, 0x0E,
+    0x4A, 0xA4, 0x09, 0x61, 0x42, 0x96, 0x10, 0x25, 0x25, 0xB9, 0x14, 0x24, 0x7D, 0xA9, 0xB5, 0xD6,
+    0x6F, 0x9F, 0xC6, 0x06, 0xB7, 0xD6, 0xF0, 0x9D, 0xC6, 0x0A, 0xDA, 0x86, 0xDD, 0x2B, 0xF7, 0x5C,
+    0x33, 0xB6, 0x8D, 0xFE, 0xCE, 0xBD, 0x76, 0xC5, 0x69, 0x53, 0x3C, 0x69, 0x93, 0xBF, 0xA1, 0x4D,
+    0xDE, 0x1F, 0x97, 0x29, 0x93, 0x4E, 0x3D, 0xF8, 0x50, 0x9C, 0xB5, 0x34, 0x6E, 0xF5, 0xB8, 0x6F,
+    0x46, 0xB0, 0x51, 0x5C, 0x2C, 0xB3, 0x65, 0x08, 0xDF, 0xA8, 0x3F, 0xEF, 0xC9, 0xD3, 0x2F, 0xE6,
+    0x29, 0x24, 0x95, 0x7A, 0xCE, 0x1F, 0xEF, 0x5D, 0x85, 0xF5, 0xDC, 0x05, 0x1E, 0x84, 0x95, 0x21,
+    0xA5, 0x31, 0x02, 0xC8, 0x34, 0x2C, 0xDE, 0x81, 0x28, 0x46, 0x07, 0x4B, 0x36, 0xA8, 0xB5, 0x26,
+    0x1B, 0x0D, 0x5F, 0x1F, 0x59, 0x6D, 0xF8, 0xCE, 0xD2, 0x93, 0xD5, 0x26, 0x9B, 0xCD, 0x3D, 0xD7,
+    0x8C, 0x6D, 0xA3, 0xBF, 0xBD, 0x68, 0xC3, 0x3E, 0xB0, 0xE1, 0xF8, 0xBB, 0x57, 0x4D, 0xF2, 0x1F,
+    0x09, 0x60, 0x9A, 0xBC, 0x98, 0x75, 0x71, 0x69, 0x86, 0xA0, 0x36, 0xF1, 0xB2, 0x36, 0x26, 0x76,
+    0xBD, 0x65, 0x2E, 0x0B, 0x6D, 0xC7, 0x56, 0xDC, 0x10, 0x9E, 0xA4, 0xC5, 0x0C, 0x6F, 0xBB, 0xB1,
+    0x41, 0x1B, 0x56, 0xB5, 0xD1, 0xDF, 0xD0, 0x46, 0xE6, 0x1A, 0x9E, 0x46, 0x3B, 0x97, 0xCA, 0x82,
+    0x6D, 0xE5, 0xF1, 0x7C, 0x07, 0x21, 0xFD, 0xD0, 0x44, 0x8B, 0x1B, 0x26, 0x9C, 0x42, 0x46, 0xF7,
+    0x3D, 0xDB, 0x31, 0xDB, 0x3E, 0x40, 0x86, 0x7B, 0x6F, 0x38, 0xB5, 0x3A, 0xF6, 0xC7, 0x92, 0xD7,
+    0x43, 0xD4, 0xED, 0x69, 0x9D, 0xFE, 0xF3, 0x76, 0x0F, 0xC3, 0x33, 0x63, 0xF6, 0xCC, 0x64, 0x1F,
+    0x0F, 0xAC, 0xDE, 0xD2, 0x93, 0xD5, 0x02, 0x79, 0x1B, 0x14, 0x2F, 0xC0, 0xE9, 0x3F, 0x68, 0x25,
+    0xD4, 0xD2, 0x55, 0x10, 0xA8, 0x98, 0xA6, 0x0F, 0x50, 0xE8, 0x98, 0x54, 0x73, 0x3F, 0x4E, 0xFF,
+    0x19, 0x32, 0x53, 0xF8, 0x92, 0x72, 0xEF, 0x28, 0xB9, 0xEF, 0x60, 0xA6, 0xA5, 0x8F, 0x39, 0x2E,
+    0x4C, 0xF3, 0x02, 0x30, 0x53, 0xD3, 0xD3, 0x9C, 0x14, 0x16, 0x33, 0x5F, 0x39, 0x13, 0xC7, 0xF4,
+    0xBC, 0x38, 0x1E, 0xE6, 0xC4, 0xFE, 0x31, 0x73, 0x2F, 0x76, 0x7F, 0x7A, 0xA3, 0x2A, 0x81, 0x4D,
+    0x64, 0x72, 0x58, 0x93, 0xAF, 0xF5, 0x31, 0x18, 0x3C, 0x8F, 0x63, 0x59, 0x07, 0x1E, 0x7E, 0x08,
+    0x56, 0xF3, 0xB3, 0x09, 0x04, 0x95, 0x40, 0x4E, 0x1C, 0x57, 0x52, 0x33, 0x39, 0xC7, 0x5C, 0x1D,
+    0x53, 0x77, 0x3E, 0x6D, 0x27, 0x2B, 0xA4, 0x59, 0x83, 0xD1, 0x77, 0x4C, 0x00, 0x62, 0x5F, 0x4C,
+    0xBE, 0x80, 0x25, 0xCA, 0x17, 0xF3, 0x56, 0xF6, 0xC5, 0x3E, 0xAC, 0xCD, 0xF9, 0x69, 0x68, 0x6F,
+    0xF9, 0x7D, 0xD0, 0xFB, 0x43, 0xDC, 0xFB, 0x36, 0x47, 0xA1, 0x56, 0x5A, 0xFF, 0x2D, 0x9F, 0x1C,
+    0x2B, 0x98, 0xE1, 0xF3, 0x99, 0xE7, 0x79, 0x78, 0x1B, 0x0D, 0x3F, 0xF7, 0x04, 0x3A, 0xFF, 0x62,
+    0xF8, 0x6B, 0x35, 0xFC, 0xBF, 0x3A, 0x00, 0x7C, 0x80, 0x97, 0xE5, 0xAF, 0x59, 0xAA, 0xA0, 0x3C,
+    0x61, 0x66, 0xE5, 0x78, 0x48, 0x33, 0x96, 0x70, 0x3B, 0xFE, 0x42, 0xE2, 0xD8, 0xAF, 0x45, 0x3D,
+    0x2C, 0x5A, 0x99, 0xA2, 0x18, 0x42, 0xE5, 0x6C, 0x35, 0xD1, 0xBF, 0x97, 0x76, 0xF8, 0xF2, 0xB9,
+    0xC5, 0x78, 0x9E, 0x7D, 0xD6, 0x33, 0xCB, 0x61, 0xE7, 0x4C, 0x06, 0xBF, 0x0B, 0xDB, 0x15, 0x14,
+    0xE7, 0x5F, 0x84, 0xA3, 0xB5, 0xBB, 0x3F, 0x15, 0xAD, 0xCE, 0x61, 0x67, 0x63, 0x98, 0xD9, 0x00,
+    0x87, 0x91, 0x44, 0xAB, 0x65, 0x4E, 0x1F, 0xCC, 0xF6, 0xF5, 0xB0, 0xE7, 0x39, 0x06, 0xC4, 0xCC,
+    0x6D, 0x47, 0xE3, 0xD1, 0x5A, 0x51, 0xB6, 0x0F, 0x19, 0x82, 0xDF, 0x30, 0x1B, 0x66, 0xFF, 0x80,
+    0x1E, 0xED, 0xE4, 0xD2, 0xC8, 0xE4, 0x5B, 0xCF, 0x2D, 0x8D, 0x16, 0x05, 0xCF, 0x7B, 0x96, 0xC6,
+    0xBE, 0x9C, 0x53, 0xDE, 0xB1, 0x58, 0x07, 0x7A, 0x88, 0x7F, 0x00, 0x4F, 0x3B, 0xE4, 0xAD, 0xDB,
+    0xCD, 0x42, 0x11, 0x2B, 0x60, 0xB1, 0x06, 0x23, 0x2D, 0x77, 0x89, 0x14, 0x76, 0xB6, 0x1E, 0xDF,
+    0xE7, 0xE0, 0xEC, 0x22, 0x3B, 0xBE, 0xF5, 0x23, 0xFC, 0x38, 0x05, 0x70, 0x3E, 0x95, 0x85, 0x98,
+    0xC1, 0xD8, 0x66, 0x96, 0x61, 0xB8, 0x58, 0x92, 0x63, 0x8C, 0x6C, 0x96, 0x47, 0xAB, 0x78, 0x66,
+    0x97, 0x99, 0x94, 0xB0, 0x1E, 0xC3, 0x6F, 0x16, 0x22, 0x8F, 0xB8, 0x53, 0x78, 0x30, 0xF2, 0x91,
+    0x16, 0x08, 0xCA, 0xAC, 0x0A, 0x70, 0xBA, 0x8E, 0xB1, 0x7B, 0xC2, 0x6D, 0x00, 0x6C, 0xA7, 0xBF,
+    0x57, 0xEA, 0xBB, 0x33, 0x48, 0xD5, 0xC4, 0xCD, 0x2F, 0xA4, 0x65, 0x17, 0xF3, 0x1A, 0x4F, 0x44,
+    0xB9, 0x8E, 0x9E, 0xE0, 0xF8, 0xF2, 0x2E, 0x0E, 0x6F, 0x30, 0x06, 0x2A, 0x34, 0x9D, 0x9E, 0xE9,
+    0x4B, 0x70, 0x70, 0x2B, 0x1B, 0x80, 0x76, 0x09, 0x8E, 0xBC, 0x69, 0x2F, 0x9E, 0xD6, 0xF4, 0xC0,
+    0xB3, 0x03, 0xAB, 0x09, 0xCF, 0xD4, 0xA5, 0x55, 0x98, 0x2B, 0xD7, 0x63, 0x5C, 0xCD, 0x6A, 0x86,
+    0x17, 0x63, 0xCD, 0x71, 0x21, 0xAE, 0x63, 0x72, 0x05, 0xC2, 0x65, 0xFB, 0x91, 0xDD, 0x5D, 0xEC,
+    0xCD, 0x3F, 0x85, 0x89, 0xBE, 0x5B, 0x92, 0x67, 0x48, 0x21, 0xF3, 0x58, 0x85, 0x7B, 0x40, 0xD0,
+    0xA9, 0x30, 0x20, 0x0B, 0x88, 0x02, 0x69, 0xCD, 0x23, 0x4B, 0x65, 0xA9, 0xA0, 0x22, 0x14, 0xA9,
+    0xDA, 0xE0, 0x22, 0x92, 0x6E, 0xAA, 0xEF, 0x18, 0xB3, 0x74, 0xC7, 0xF5, 0xB4, 0xB2, 0xDC, 0x7A,
+    0x4C, 0xD4, 0xE5, 0x90, 0x26, 0x8B, 0x3B, 0x3A, 0x0A, 0xA9, 0xC9, 0xFE, 0x21, 0x8F, 0xFA, 0xC1,
+    0x4A, 0x29, 0x92, 0xF5, 0x52, 0xBE, 0x8C, 0xAE, 0x95, 0x53, 0xBE, 0x42, 0x5A, 0xBB, 0x57, 0x0E,
+    0x02, 0xCD, 0x71, 0x43, 0xF1, 0x3A, 0xE9, 0x0D, 0x87, 0x16, 0xB4, 0xFC, 0x5A, 0xB9, 0x57, 0x5A,
+    0x7E, 0xC9, 0x51, 0xBD, 0x7C, 0x8A, 0x2A, 0x10, 0x6B, 0x41, 0xA7, 0x09, 0xFF, 0x95, 0xB7, 0x5B,
+    0x8C, 0xC9, 0x02, 0x17, 0x9B, 0xC5, 0x2D, 0xEB, 0xB4, 0x3B, 0x38, 0x21, 0xC2, 0xFC, 0x6E, 0x6D,
+    0x86, 0x9D, 0xD6, 0xA4, 0xF8, 0x0D, 0xEF, 0x50, 0x21, 0x09, 0x85, 0x86, 0x32, 0x0B, 0x82, 0xDB,
+    0x1C, 0x3A, 0x55, 0x1F, 0xC2, 0x41, 0x4E, 0xCE, 0x55, 0x9E, 0x7B, 0x47, 0x1F, 0x86, 0xF7, 0x35,
+    0x16, 0x22, 0x9A, 0x3C, 0x75, 0xD6, 0x50, 0xDF, 0xD7, 0x60, 0xA5, 0xBF, 0x58, 0x3F, 0x95, 0x32,
+    0xEF, 0xE1, 0x1F, 0x0F, 0x7B, 0x01, 0x37, 0xB7, 0xCF, 0x0C, 0xF0, 0x6A, 0x56, 0xC1, 0xED, 0xDD,
+    0xEB, 0xC3, 0x9E, 0x3B, 0x98, 0xC0, 0x23, 0x9F, 0x4A, 0xD1, 0xE4, 0xFB, 0xC3, 0xE0, 0xAB, 0x58,
+    0xEC, 0x9F, 0xD1, 0xDD, 0xFB, 0x1C, 0xFD, 0x69, 0xA6, 0x91, 0x59, 0x6D, 0xC3, 0xB4, 0xB6, 0x61,
+    0x4A, 0x7B, 0x84, 0xC8, 0x6C, 0x8F, 0xF0, 0x71, 0xFE, 0xFE, 0x07, 0x9D, 0x56, 0x3D, 0x6C, 0xE4,
+    0xC6, 0x15, 0xFE, 0x48, 0xDE, 0x8A, 0xF6, 0x11, 0xBE, 0x09, 0x90, 0x15, 0x0C, 0xFB, 0x1C, 0xF3,
+    0x8A, 0x14, 0xB1, 0x0A, 0xB3, 0x71, 0x71, 0xC5, 0xED, 0x0E, 0xCF, 0x80, 0x53, 0xC4, 0x80, 0xB1,
+    0x80, 0xB5, 0x4D, 0x52, 0x24, 0x40, 0x2A, 0xEB, 0x90, 0x28, 0xC5, 0x15, 0x2A, 0x24, 0x91, 0x76,
+    0x93, 0x22, 0x40, 0xBC, 0x45, 0xE0, 0x7A, 0x0B, 0x15, 0x97, 0x75, 0x71, 0x71, 0xE0, 0x42, 0x01,
+    0xB4, 0xE2, 0x04, 0x4E, 0x8A, 0x74, 0x0C, 0x90, 0x3E, 0x6C, 0x8C, 0xC0, 0x70, 0x21, 0x02, 0xA1,
+    0x13, 0xEA, 0x40, 0xEE, 0xCB, 0x37, 0xE4, 0x4A, 0x27, 0x25, 0x67, 0x18, 0xC8, 0xFC, 0x70, 0x38,
+    0xC3, 0x37, 0xF3, 0xFE, 0xBE, 0xF7, 0x86, 0x3B, 0x73, 0xE8, 0x1A, 0xAA, 0x85, 0x2B, 0x40, 0x62,
+    0xA0, 0x0A, 0x6C, 0xCD, 0x21, 0x85, 0x27, 0x71, 0xD0, 0x22, 0x2C, 0xA1, 0x53, 0x60, 0x67, 0x06,
+    0x47, 0x4A, 0x78, 0xD2, 0x40, 0xFD, 0x4B, 0xA0, 0xF3, 0x2C, 0x3D, 0x45, 0x98, 0x83, 0xC5, 0x5B,
+    0x39, 0x95, 0x92, 0x2F, 0xCB, 0x48, 0xA4, 0xD0, 0x6F, 0x8B, 0x19, 0xE1, 0x67, 0x98, 0x4E, 0xA7,
+    0x99, 0xAC, 0xD8, 0x12, 0x69, 0x2D, 0x8D, 0x88, 0x94, 0x17, 0x9D, 0xDF, 0x26, 0x5B, 0x70, 0xE7,
+    0x1A, 0x41, 0x11, 0x3D, 0x11, 0xA3, 0x44, 0x52, 0x4F, 0x56, 0xC0, 0xEE, 0x1C, 0x03, 0x24, 0x79,
+    0x56, 0x64, 0x45, 0x92, 0x0F, 0xEC, 0xB6, 0x04, 0xAD, 0x7C, 0x20, 0x6C, 0x89, 0xD3, 0xDE, 0xC0,
+    0xB7, 0x76, 0x52, 0xA9, 0xA5, 0x79, 0xB3, 0x75, 0x5A, 0xBF, 0x09, 0x8B, 0x90, 0x62, 0xF9, 0x35,
+    0x22, 0x4A, 0xB3, 0x9B, 0xEE, 0x2B, 0xC3, 0xC6, 0x17, 0x4E, 0x37, 0x2A, 0x60, 0xF1, 0xFD, 0x47,
+    0x9E, 0x84, 0xB5, 0xDF, 0xEA, 0x42, 0x95, 0x59, 0x1A, 0xFD, 0xB1, 0xC5, 0xD8, 0x2D, 0xF1, 0x9E,
+    0xE5, 0x6B, 0xA2, 0x22, 0xAC, 0xC4, 0xF8, 0x22, 0x54, 0xB9, 0x01, 0xB2, 0x0A, 0xEF, 0x9D, 0xDA,
+    0x82, 0x9D, 0x9B, 0xB3, 0x4C, 0x15, 0x57, 0x1B, 0xBA, 0xA3, 0x90, 0x7D, 0xB6, 0x42, 0x54, 0x08,
+    0x82, 0x2A, 0x31, 0x6E, 0xA3, 0x72, 0x2C, 0xBD, 0x02, 0x43, 0xEA, 0x65, 0xDB, 0x91, 0xBC, 0x7C,
+    0xF2, 0xBD, 0xF1, 0x21, 0x5A, 0x2D, 0x8D, 0x92, 0xD2, 0x39, 0x8D, 0xAD, 0xB9, 0x3C, 0x6A, 0x4E,
+    0xD5, 0x62, 0x9A, 0xC5, 0xE8, 0x58, 0x99, 0x03, 0xF8, 0xB9, 0xD3, 0x78, 0x8D, 0x5F, 0x07, 0xB5,
+    0xAA, 0xC2, 0x52, 0x97, 0xBA, 0xD8, 0x8C, 0x83, 0x46, 0x35, 0xAA, 0x9B, 0x47, 0x85, 0x36, 0xDA,
+    0x6C, 0x42, 0x17, 0xBA, 0x8C, 0xCA, 0xB0, 0x54, 0x55, 0x50, 0x7B, 0x8D, 0xDB, 0x60, 0xFB, 0x7F,
+    0x69, 0xE8, 0x9F, 0xA8, 0x41, 0xB0, 0xA2, 0x4F, 0x52, 0xFA, 0x02, 0x41, 0x89, 0xC5, 0xCC, 0xB5,
+    0x2A, 0x41, 0xD5, 0x76, 0x21, 0xB1, 0xD6, 0x73, 0x4A, 0xA7, 0xA4, 0xC9, 0x4B, 0x3B, 0x62, 0x02,
+    0x54, 0xAC, 0x76, 0x6E, 0xC7, 0x09, 0x36, 0xA7, 0xC8, 0x24, 0xDD, 0x79, 0x9C, 0x22, 0xB8, 0xDE,
+    0x36, 0x62, 0x4C, 0x63, 0x88, 0xE1, 0xD9, 0x2E, 0x21, 0x40, 0xF3, 0x36, 0x14, 0x0A, 0x63, 0x74,
+    0x67, 0x52, 0x93, 0xC8, 0x8C, 0x31, 0x82, 0x8E, 0x43, 0xE3, 0x1B, 0x27, 0xF6, 0x8C, 0xAD, 0xD9,
+    0x2A, 0x69, 0x37, 0xB7, 0xB3, 0xD5, 0x83, 0x2F, 0xFA, 0x39, 0x61, 0xC1, 0xE7, 0xEE, 0x79, 0xB6,
+    0x7A, 0xF1, 0x6F, 0x9E, 0x71, 0xE9, 0xAA, 0xAC, 0xCD, 0x5A, 0x2C, 0x68, 0xAE, 0xAE, 0x3A, 0xF2,
+    0x40, 0x92, 0x36, 0x69, 0x92, 0xE2, 0x72, 0x09, 0x12, 0xCB, 0x17, 0x59, 0xAB, 0xDB, 0xA0, 0x0D,
+    0x66, 0xB4, 0x4E, 0xA5, 0xAB, 0xB0, 0xC0, 0x33, 0x60, 0xF0, 0x75, 0x4E, 0xE7, 0x9E, 0x5C, 0x9B,
+    0x24, 0xCE, 0xB0, 0x8D, 0xC0, 0xA8, 0xFC, 0x76, 0x83, 0x15, 0x56, 0xD9, 0x2A, 0x6B, 0xB2, 0x02,
+    0x33, 0xBF, 0x24, 0x69, 0xAC, 0x91, 0xFC, 0x46, 0xB7, 0x61, 0xEB, 0x3E, 0x5A, 0xBB, 0x9C, 0x68,
+    0x24, 0x28, 0x9F, 0x2C, 0x1E, 0x57, 0x08, 0xFB, 0x36, 0xC1, 0x60, 0x4F, 0x39, 0xF9, 0x3D, 0xE5,
+    0x19, 0xFA, 0x2E, 0xF5, 0x8B, 0x65, 0x0F, 0x9B, 0xDC, 0xFA, 0x24, 0xEB, 0x60, 0xE3, 0xAC, 0x61,
+    0x73, 0x2D, 0x2C, 0x9E, 0x74, 0x61, 0x61, 0x6C, 0x58, 0xBC, 0x86, 0x8D, 0x99, 0x06, 0xF9, 0x11,
+    0xDE, 0x21, 0x31, 0xE0, 0xDB, 0x28, 0xD8, 0x9D, 0xE1, 0xEB, 0x70, 0x61, 0x95, 0xA4, 0xB7, 0x8B,
+    0x48, 0xCE, 0x72, 0xCD, 0xF5, 0x65, 0x28, 0xF1, 0xB1, 0x73, 0x7C, 0x2D, 0x8C, 0x64, 0x5D, 0x36,
+    0xA7, 0xD3, 0x6D, 0xF6, 0xC9, 0x45, 0x38, 0x61, 0x5D, 0x16, 0x8B, 0xC5, 0xDC, 0xCE, 0x77, 0x38,
+    0xDA, 0xB9, 0xDF, 0xBA, 0x65, 0x28, 0x5F, 0x16, 0x3C, 0x2F, 0x3F, 0xBC, 0x2D, 0xE9, 0x3E, 0xFE,
+    0x80, 0x67, 0x85, 0xA2, 0xEE, 0x4E, 0x35, 0xD7, 0x87, 0xAD, 0x85, 0x2D, 0xF4, 0x1A, 0x31, 0x4E,
+    0xA0, 0xB5, 0x48, 0x5A, 0x4F, 0x28, 0x9E, 0x55, 0x9A, 0xE9, 0xE0, 0x95, 0x35, 0x4F, 0x87, 0xA8,
+    0x0A, 0xE8, 0x23, 0x06, 0x04, 0x42, 0xFA, 0x3C, 0x8A, 0x01, 0xCD, 0xF5, 0x53, 0x76, 0x6A, 0xEC,
+    0xD0, 0x4A, 0x6E, 0x4D, 0x28, 0x50, 0x48, 0xFF, 0x2A, 0x59, 0xDA, 0x93, 0x25, 0x3D, 0x19, 0xAE,
+    0x92, 0x95, 0x3D, 0x99, 0xFA, 0x2F, 0xB2, 0x25, 0xFB, 0x0C, 0xD6, 0xA1, 0x11, 0x42, 0x0B, 0x88,
+    0x0E, 0xC3, 0x83, 0x4B, 0xA7, 0xAD, 0x16, 0x19, 0xE5, 0xA6, 0x3E, 0x1D, 0x5E, 0xAC, 0xCA, 0x8B,
+    0x8F, 0xF3, 0x3D, 0xB8, 0x97, 0xDD, 0xAE, 0x51, 0xAB, 0x34, 0xF8, 0x8A, 0x47, 0x64, 0x67, 0xA9,
+    0x75, 0xEF, 0xC3, 0xC0, 0xC9, 0x87, 0xC3, 0xD1, 0x7E, 0x54, 0x05, 0xCC, 0x08, 0xA3, 0x93, 0xE1,
+    0x77, 0x37, 0x08, 0xEE, 0x11, 0xC1, 0x1D, 0x41, 0xA5, 0xBE, 0x09, 0xE8, 0xA0, 0xBB, 0xF8, 0x26,
+    0x63, 0x6F, 0x1D, 0xD9, 0x60, 0xF4, 0xE5, 0x5A, 0x30, 0x7A, 0x92, 0x32, 0x3C, 0x29, 0x19, 0x17,
+    0x4E, 0xFB, 0x3D, 0x7E, 0xEB, 0x5D, 0x38, 0xC4, 0xD0, 0x21, 0xB1, 0x75, 0x08, 0x01, 0x5B, 0x46,
+    0x95, 0x57, 0x06, 0x85, 0x9F, 0xDA, 0x54, 0x2A, 0x31, 0x12, 0x5F, 0xA2, 0x54, 0x7E, 0xD5, 0x68,
+    0x23, 0x1F, 0xD6, 0x3A, 0x4F, 0x54, 0xA9, 0xCD, 0x0D, 0x6B, 0x8E, 0x4D, 0x24, 0x29, 0xAB, 0x49,
+    0x6A, 0x5D, 0x87, 0x95, 0x85, 0x01, 0x75, 0x6A, 0x0F, 0x17, 0x8B, 0xE5, 0x3E, 0x30, 0xBA, 0xE8,
+    0x74, 0xD8, 0xF0, 0x9B, 0x24, 0x7E, 0x66, 0x9A, 0xD3, 0x0D, 0xE3, 0xFC, 0xDE, 0xBA, 0x22, 0x86,
+    0xF3, 0xEE, 0x5F, 0xD3, 0x40, 0x7E, 0x49, 0xFC, 0x9E, 0xA5, 0x23, 0x7A, 0xFE, 0xDE, 0xC1, 0x23,
+    0xE0, 0x8D, 0xF5, 0x69, 0x36, 0x3B, 0x6B, 0xF3, 0xB4, 0xFF, 0xC0, 0x89, 0x83, 0x73, 0x9F, 0xF1,
+    0x72, 0x96, 0xEA, 0x4C, 0xE2, 0x91, 0xBF, 0xC2, 0xF0, 0x66, 0x7C, 0x9D, 0x86, 0x7B, 0x36, 0x66,
+    0xCF, 0xEB, 0xF6, 0x30, 0x91, 0xE6, 0x98, 0x96, 0xA1, 0x93, 0x8B, 0x57, 0xF5, 0x6A, 0x79, 0x90,
+    0x35, 0x9F, 0x5A, 0x74, 0xC0, 0xBF, 0x9F, 0x47, 0x52, 0x13, 0xEA, 0xEA, 0x7E, 0xE9, 0xDE, 0x4F,
+    0x3B, 0x46, 0x6E, 0xCA, 0x4B, 0xA2, 0xEE, 0x73, 0x0A, 0xB3, 0x8C, 0xE1, 0xFB, 0x4A, 0xF2, 0xA8,
+    0xF6, 0x7B, 0xCD, 0xD4, 0xC5, 0xF3, 0xDD, 0x3F, 0x43, 0x4D, 0xF0, 0xFB, 0x5F, 0x93, 0xCB, 0x2D,
+    0xE0, 0x77, 0xC0, 0xF3, 0xC0, 0x4F, 0x80, 0x3B, 0xF6, 0x65, 0xF2, 0x0B, 0xE0, 0xD6, 0x60, 0x4D,
+    0xC9, 0x20, 0xF4, 0x54, 0x49, 0x84, 0xF9, 0xEB, 0xBD, 0x73, 0xFB, 0xF5, 0x26, 0xF8, 0x7C, 0xE1,
+    0x62, 0x57, 0x7F, 0x02, 0x3E, 0x79, 0x07, 0x28, 0xF1, 0xD3, 0xBF, 0x3C, 0xE5, 0x62, 0x9F, 0x62,
+    0x65, 0x90, 0x5E, 0x06, 0x9B, 0x53, 0x13, 0x4A, 0x18, 0x14, 0x49, 0x6A, 0x15, 0xDA, 0x60, 0x56,
+    0x4C, 0x70, 0xC2, 0x9A, 0xF0, 0xCD, 0x8F, 0xE9, 0x33, 0xDF, 0x86, 0x4D, 0xAD, 0x3F, 0x6A, 0x97,
+    0x18, 0x37, 0xA7, 0x51, 0x7F, 0x63, 0xE0, 0x35, 0x3C, 0x77, 0x67, 0xDC, 0xA8, 0x8A, 0xCE, 0xAD,
+    0xBF, 0x73, 0x97, 0x3B, 0x27, 0x3E, 0x8F, 0x68, 0x90, 0xC5, 0x0C, 0xA7, 0x79, 0x8C, 0x73, 0x22,
+    0xC3, 0x2F, 0xC2, 0xE2, 0x14, 0x73, 0xAB, 0x03, 0x93, 0xEF, 0x18, 0x61, 0x91, 0xC1, 0xAD, 0x78,
+    0x07, 0x7D, 0xF5, 0x8F, 0x54, 0xBF, 0xF9, 0x99, 0x79, 0xC3, 0x7B, 0x3F, 0x3F, 0x62, 0x60, 0x24,
+    0x08, 0xE3, 0x90, 0x6C, 0x97, 0x38, 0xB2, 0xF7, 0xA7, 0x91, 0x42, 0x78, 0x7F, 0xBE, 0x44, 0xD3,
+    0x7D, 0xFB, 0x4F, 0xBA, 0x49, 0xDA, 0xA0, 0x78, 0xFD, 0xF8, 0xB9, 0x3B, 0x5D, 0x8A, 0x21, 0xF6,
+    0x75, 0x76, 0x66, 0xF6, 0x94, 0x6B, 0x1E, 0x32, 0xC5, 0xD9, 0xD1, 0xCE, 0x83, 0x92, 0xB7, 0x2F,
+    0xB5, 0x7E, 0xA5, 0x07, 0xC1, 0x5D, 0x6B, 0x8C, 0xAD, 0xD8, 0xC6, 0xF7, 0xA3, 0xC8, 0xE6, 0x26,
+    0xBF, 0x56, 0x36, 0x4C, 0x93, 0xD2, 0x93, 0xF3, 0xE9, 0x03, 0x31, 0xB0, 0xB1, 0xC6, 0x2D, 0xB7,
+    0x39, 0x58, 0xC7, 0xED, 0xCA, 0xF9, 0xFF, 0xB1, 0xA1, 0x4B, 0x31, 0x5D, 0xBA, 0x59, 0x5C, 0x96,
+    0xA7, 0x53, 0x0C, 0xEC, 0x79, 0x43, 0x57, 0xE4, 0x73, 0x26, 0x08, 0x65, 0xF7, 0x7F, 0x5C, 0x47,
+    0xDD, 0xF7, 0x52, 0xC7, 0x03, 0x1E, 0x98, 0x8F, 0x48, 0xF0, 0xC3, 0xDF, 0xE2, 0xB2, 0x74, 0xA7,
+    0x82, 0xF9, 0x56, 0xE8, 0x0B, 0xCB, 0x51, 0x18, 0x50, 0x9F, 0x3B, 0x3F, 0xE2, 0x2F, 0x46, 0x6D,
+    0x3F, 0x97, 0x6B, 0xD9, 0x5E, 0xEE, 0xA8, 0x8F, 0x70, 0xA5, 0xBC, 0xD0, 0x0F, 0x2A, 0x4D, 0x7A,
+    0x0E, 0xDD, 0x6E, 0xB1, 0x41, 0x36, 0x9D, 0xFE, 0xD8, 0x74, 0xDF, 0x6E, 0xF5, 0x24, 0x37, 0x2C,
+    0x8B, 0xFA, 0xA5, 0x43, 0x44, 0x91, 0xEC, 0x87, 0x27, 0x5A, 0x9F, 0x0D, 0x06, 0x5D, 0xF6, 0xC6,
+    0xF8, 0xE7, 0xD8, 0x57, 0xCC, 0x3D, 0x60, 0x18, 0x8E, 0x1D, 0xA6, 0x24, 0x38, 0xDB, 0x78, 0x58,
+    0xE1, 0xD3, 0xAA, 0x2B, 0x93, 0x35, 0xD5, 0xA9, 0xA5, 0x3A, 0x56, 0xF1, 0x89, 0xC2, 0x88, 0xB9,
+    0xAC, 0xB1, 0x49, 0x74, 0x4F, 0xE1, 0xE4, 0xB2, 0x85, 0x38, 0xD0, 0xD0, 0x82, 0xC1, 0x7D, 0xCB,
+    0xAA, 0x3A, 0x3C, 0x3A, 0x26, 0xCA, 0x6A, 0x2C, 0x87, 0x51, 0x4D, 0x52, 0xC5, 0xF4, 0x17, 0x86,
+    0x67, 0xE3, 0xEC, 0x24, 0x3C, 0x56, 0xC7, 0xEA, 0x20, 0xA2, 0x00, 0x6F, 0xED, 0xC1, 0x32, 0x65,
+    0x3B, 0x64, 0xA6, 0xCE, 0x2C, 0x83, 0xAB, 0x6D, 0xD8, 0xFD, 0x4B, 0xE1, 0xDF, 0xE7, 0xF6, 0x36,
+    0x7C, 0x1C, 0xD7, 0xE3, 0x20, 0xAD, 0x46, 0xD7, 0xFB, 0x64, 0xE8, 0x90, 0xE2, 0x9F, 0xB9, 0xE4,
+    0x75, 0xF7, 0x9B, 0xD0, 0xFF, 0x22, 0x0C, 0xC8, 0x4D, 0x97, 0xBB, 0xF3, 0x10, 0x7D, 0x55, 0xA5,
+    0x33, 0xA1, 0xE4, 0xFB, 0x21, 0x46, 0xAF, 0xE3, 0xD5, 0x7B, 0x50, 0x7B, 0xFC, 0x21, 0xB2, 0x69,
+    0xDB, 0x89, 0x11, 0xF9, 0x46, 0x7D, 0x18, 0x7B, 0x2B, 0x9B, 0xF4, 0xBD, 0x16, 0xC1, 0xDF, 0x11,
+    0x06, 0x66, 0xE8, 0xC4, 0xFF, 0x01, 0xE5, 0x7D, 0x3F, 0x90, 0xDC, 0xD6, 0x99, 0xE7, 0xEB, 0x6E,
+    0x72, 0x7A, 0xED, 0xAE, 0x33, 0x18, 0x98, 0xFE, 0x43, 0xD6, 0x19, 0x0E, 0x2E, 0xD8, 0x63, 0x5D,
+    0x19, 0xF1, 0x6E, 0xED, 0x1A, 0xF0, 0x2A, 0x50, 0xB0, 0x81, 0x19, 0x70, 0xA4, 0x3A, 0x33, 0xE0,
+    0x05, 0xB7, 0x55, 0x67, 0xBA, 0x6A, 0x27, 0xBA, 0x2A, 0xD7, 0x95, 0x6F, 0xD1, 0x16, 0x03, 0x05,
+    0x0E, 0x3C, 0x5B, 0x2B, 0x39, 0x38, 0x07, 0x66, 0x5D, 0xC9, 0x57, 0xE2, 0xB0, 0xEA, 0xE8, 0x60,
+    0x03, 0x05, 0x5A, 0xA3, 0x25, 0x06, 0x0A, 0x14, 0x08, 0x92, 0x8E, 0x7B, 0x81, 0x03, 0xC1, 0x36,
+    0x59, 0x5B, 0x3B, 0x0A, 0x08, 0x4B, 0xE0, 0x0A, 0x1C, 0x02, 0x78, 0xF7, 0xFD, 0x7E, 0xDF, 0x7B,
+    0x68, 0x74, 0xCF, 0x0C, 0x39, 0x94, 0x44, 0x8A, 0xBA, 0x9D, 0x19, 0x7C, 0x1F, 0xA6, 0x1B, 0x78,
+    0x78, 0x78, 0x7F, 0xBE, 0xF7, 0xFD, 0x7F, 0x1B, 0x57, 0x8C, 0x99, 0xD8, 0xC4, 0x18, 0xBB, 0x30,
+    0x26, 0x2E, 0x8D, 0x99, 0xD5, 0xC6, 0x8C, 0x1B, 0xE3, 0x7F, 0x62, 0x6B, 0x6B, 0x39, 0x9A, 0xFE,
+    0xB8, 0xB3, 0x79, 0x0E, 0x97, 0xAD, 0x1C, 0x77, 0x36, 0xCF, 0xCA, 0x77, 0x55, 0x7F, 0xEC, 0xED,
+    0x5C, 0xDE, 0x77, 0x8D, 0x3F, 0x86, 0x65, 0xC9, 0x81, 0x67, 0x4C, 0xCA, 0x60, 0x11, 0xD4, 0x71,
+    0x81, 0x63, 0x56, 0x47, 0xC5, 0x78, 0xFB, 0x8B, 0xC9, 0xE3, 0x7A, 0x7E, 0x6A, 0xE5, 0x06, 0x63,
+    0x0E, 0x44, 0x27, 0x2F, 0x74, 0x9B, 0x67, 0xA5, 0x0E, 0xB3, 0x96, 0x55, 0x39, 0x04, 0xFD, 0xE0,
+    0x26, 0x90, 0xDC, 0xB1, 0x50, 0x54, 0x2A, 0x6A, 0x80, 0x5E, 0xCC, 0x5A, 0x5E, 0x19, 0x74, 0x44,
+    0x53, 0x4B, 0x34, 0x59, 0x41, 0xEE, 0x43, 0xBD, 0xE4, 0x4B, 0x96, 0x37, 0x04, 0xBC, 0x5D, 0x50,
+    0xA9, 0x68, 0x8E, 0x47, 0x8D, 0xCE, 0x01, 0x5E, 0xBC, 0x2C, 0x7D, 0x95, 0xB3, 0xCF, 0x66, 0x72,
+    0x51, 0x20, 0x57, 0x44, 0xF3, 0xBE, 0xBB, 0xE4, 0xC1, 0xF5, 0xCA, 0x71, 0x63, 0xF3, 0x1C, 0x2A,
+    0xF6, 0x69, 0x1D, 0xFA, 0x33, 0xCA, 0xEC, 0xB6, 0x09, 0xAD, 0xD4, 0x55, 0x5A, 0xAA, 0x19, 0xE1,
+    0x41, 0x13, 0x5B, 0x6D, 0x94, 0x81, 0x54, 0xEA, 0x44, 0x88, 0x86, 0x89, 0xD0, 0xB1, 0x71, 0xD5,
+    0x03, 0xB9, 0x24, 0x49, 0x7B, 0xC0, 0x7F, 0xD1, 0x1B, 0xEE, 0x5B, 0x19, 0x72, 0x26, 0xC4, 0x1D,
+    0x81, 0x65, 0x5B, 0x16, 0xE6, 0x87, 0x13, 0x14, 0xCA, 0xD7, 0x31, 0x11, 0xC0, 0xD8, 0xCA, 0x4B,
+    0x9B, 0xE3, 0x67, 0xB5, 0x02, 0x5B, 0x76, 0x5B, 0x2E, 0x90, 0x86, 0xB1, 0x6D, 0x84, 0x8E, 0xAC,
+    0x37, 0x6A, 0x14, 0x97, 0x16, 0x72, 0x94, 0x5A, 0x60, 0x24, 0x8D, 0x16, 0xC8, 0x8D, 0x53, 0x79,
+    0x94, 0x94, 0x53, 0x48, 0x7D, 0x6B, 0x33, 0x42, 0xF3, 0x86, 0xD2, 0xD2, 0x68, 0xF4, 0x89, 0x3D,
+    0x2B, 0xC7, 0x3F, 0x48, 0xCB, 0x67, 0x52, 0x86, 0x1C, 0xB5, 0x1C, 0xC5, 0x69, 0x2B, 0x5F, 0x1F,
+    0x4F, 0x4C, 0x5C, 0xC4, 0xE5, 0xC3, 0xFC, 0xE2, 0xA5, 0x9F, 0x2E, 0xD2, 0xB7, 0x2A, 0xF9, 0x8B,
+    0xDF, 0x2C, 0x4F, 0x8D, 0xB7, 0xB5, 0xAA, 0xD2, 0xCB, 0x9F, 0xCA, 0x9F, 0x09, 0x9A, 0x4F, 0xED,
+    0x2F, 0xAA, 0x4F, 0x66, 0x55, 0x6A, 0xCB, 0xD4, 0xE6, 0xA9, 0x74, 0x89, 0xB4, 0x56, 0xA8, 0xE3,
+    0x77, 0x70, 0x12, 0xED, 0x3F, 0xB9, 0xB3, 0xE9, 0x4E, 0x4A, 0xB3, 0x76, 0x12, 0x0F, 0x4F, 0x76,
+    0x5F, 0xC2, 0x49, 0x81, 0xCE, 0xCB, 0xFD, 0x49, 0xED, 0x4F, 0x3A, 0x3D, 0xD9, 0xCD, 0xE4, 0x8D,
+    0xE2, 0x5C, 0xEE, 0x9A, 0x4A, 0x3F, 0xF1, 0x64, 0x2C, 0x25, 0xA4, 0x38, 0x19, 0xE1, 0x64, 0x81,
+    0x02, 0xE5, 0x2F, 0x5B, 0xB8, 0x4F, 0xF8, 0x37, 0xB1, 0x73, 0x5C, 0x66, 0xF3, 0xD0, 0x26, 0xDA,
+    0xAF, 0xD6, 0x0A, 0xE0, 0xB8, 0x6F, 0x0C, 0x3A, 0x97, 0x13, 0x10, 0x93, 0x97, 0x8F, 0x3A, 0xDE,
+    0xCF, 0x8B, 0x05, 0xDE, 0xFB, 0x53, 0xC0, 0xF8, 0xE9, 0xB6, 0x15, 0xCB, 0x13, 0x14, 0xDB, 0x85,
+    0xC3, 0xA5, 0xCC, 0xB7, 0x0B, 0xED, 0x33, 0xB6, 0xD2, 0xEB, 0xE3, 0x5A, 0x71, 0xD8, 0x28, 0x0E,
+    0x9A, 0xD5, 0xFF, 0xDD, 0xF7, 0xC7, 0xF5, 0x7A, 0xDE, 0xAF, 0x38, 0x77, 0xD8, 0x28, 0xBE, 0xE9,
+    0x28, 0xD2, 0x7E, 0xE8, 0x48, 0x94, 0x12, 0xA3, 0x83, 0xE0, 0xA9, 0x97, 0x94, 0x1C, 0xCD, 0x1D,
+    0x6D, 0x52, 0xD2, 0x34, 0x93, 0x0E, 0x68, 0x1D, 0xD5, 0x11, 0x38, 0xEB, 0x1C, 0x21, 0x7A, 0x30,
+    0xEC, 0x1C, 0x34, 0xA7, 0x5E, 0x96, 0xF2, 0xD3, 0x4A, 0xDB, 0x46, 0xA6, 0xA7, 0x9C, 0x4C, 0xD1,
+    0x42, 0xB3, 0xC2, 0x0C, 0x7E, 0xE4, 0xBB, 0x10, 0x2F, 0x19, 0xE3, 0xCD, 0x6C, 0xC1, 0xAE, 0x44,
+    0x37, 0xCA, 0x17, 0x41, 0x2B, 0x40, 0x66, 0xBD, 0x5D, 0x70, 0xF4, 0xC8, 0x58, 0xB1, 0xFF, 0x88,
+    0x8B, 0xB4, 0x3B, 0x3B, 0xE3, 0xCE, 0xDE, 0x67, 0xC7, 0xCB, 0xFC, 0xB5, 0x8B, 0x14, 0xD7, 0xC5,
+    0xB8, 0x43, 0xAA, 0x6D, 0x17, 0x33, 0x19, 0x03, 0x52, 0xD4, 0xC2, 0x95, 0x6C, 0x32, 0xB4, 0x62,
+    0xCC, 0xA6, 0xED, 0xCC, 0x99, 0x97, 0x8C, 0x27, 0x2A, 0x9C, 0xEC, 0xA8, 0x0B, 0xC9, 0xA4, 0x8C,
+    0xB5, 0x7D, 0xB5, 0xD4, 0xFE, 0x65, 0x6B, 0x47, 0x84, 0x31, 0x61, 0x46, 0xC8, 0x5E, 0x18, 0x13,
+    0x4E, 0x08, 0x83, 0x3D, 0xC0, 0xF0, 0x03, 0xC0, 0xF8, 0x77, 0x80, 0xE9, 0x75, 0x40, 0x7B, 0x49,
+    0xE0, 0x6B, 0x16, 0x2F, 0x77, 0xBD, 0x03, 0x7C, 0xA3, 0x01, 0x7C, 0xAB, 0x06, 0x7C, 0xAF, 0x04,
+    0xB4, 0x05, 0x21, 0x1B, 0xC0, 0xCE, 0x09, 0x31, 0xB7, 0xE5, 0x6D, 0x01, 0x1B, 0xC2, 0x9A, 0xB3,
+    0x5D, 0x7F, 0xD2, 0x45, 0x08, 0x72, 0x56, 0xC8, 0x94, 0x31, 0x51, 0x87, 0x86, 0x0E, 0x30, 0xEC,
+    0x85, 0x8E, 0xD5, 0xAB, 0xF5, 0x07, 0xE5, 0xCB, 0x72, 0x50, 0x53, 0xBB, 0x88, 0x40, 0xE7, 0xE6,
+    0x01, 0x4B, 0xC3, 0x32, 0xD3, 0xB1, 0xEF, 0xF0, 0x6F, 0x22, 0x1F, 0xCA, 0x57, 0x21, 0x2F, 0x23,
+    0xC1, 0xCC, 0x51, 0x72, 0x5C, 0xCA, 0x2C, 0x33, 0x61, 0x85, 0x06, 0x0A, 0x5A, 0x94, 0x3F, 0x43,
+    0xD3, 0xCB, 0x0D, 0x18, 0x44, 0x63, 0x5D, 0xA4, 0xF5, 0x89, 0x59, 0xC9, 0xF3, 0x82, 0xAD, 0xDA,
+    0x57, 0x27, 0x40, 0x77, 0x91, 0xDA, 0x02, 0xB2, 0x81, 0xCF, 0xB9, 0x56, 0x9D, 0xB6, 0x02, 0x66,
+    0xDD, 0x23, 0x04, 0x98, 0x87, 0x6B, 0x40, 0x87, 0xE3, 0x41, 0xC0, 0x64, 0x7C, 0x0D, 0xBE, 0x12,
+    0x17, 0x03, 0x33, 0xD1, 0x57, 0xED, 0xB8, 0xF2, 0x34, 0x6C, 0x82, 0x86, 0x6F, 0x56, 0xA3, 0x51,
+    0xA2, 0x4A, 0x1B, 0x48, 0x57, 0x97, 0xA8, 0x42, 0x2B, 0x87, 0x35, 0xDE, 0x4C, 0x9B, 0x52, 0xDA,
+    0x77, 0xCC, 0x27, 0x4E, 0x48, 0x8A, 0xA6, 0x80, 0xC9, 0x8C, 0x24, 0x21, 0xE8, 0x36, 0x9F, 0xE1,
+    0x00, 0x17, 0x72, 0x85, 0x05, 0x29, 0x2B, 0xD1, 0x3D, 0x69, 0xA9, 0x0B, 0x14, 0x9A, 0x30, 0x6A,
+    0x2C, 0xD6, 0xD0, 0x75, 0x20, 0x4B, 0xB6, 0x52, 0xD3, 0x75, 0xB0, 0x7B, 0x85, 0x93, 0xA2, 0x70,
+    0xD4, 0x8E, 0xF4, 0xE1, 0xC6, 0xB5, 0x7E, 0x16, 0x8C, 0x74, 0x2A, 0xF8, 0xB3, 0x31, 0x40, 0x68,
+    0xE7, 0x8E, 0x46, 0x6A, 0xF1, 0x25, 0xA6, 0x96, 0x2C, 0x6E, 0x76, 0xEF, 0x2C, 0x16, 0xE5, 0x96,
+    0x2B, 0xF3, 0x1C, 0x20, 0x8F, 0xCB, 0x0D, 0x8B, 0xF7, 0xCC, 0x00, 0xD2, 0x1E, 0xD8, 0x22, 0xBE,
+    0xF3, 0xAC, 0x8C, 0x16, 0xBC, 0x24, 0x98, 0x31, 0x5D, 0xCB, 0xE3, 0xBD, 0xAB, 0xB8, 0x43, 0x2F,
+    0x8E, 0x2B, 0x80, 0xBA, 0x07, 0xF2, 0xEF, 0x48, 0x8A, 0x42, 0x55, 0x01, 0xFA, 0x7B, 0x2F, 0x3F,
+    0x7A, 0xF6, 0x64, 0xA6, 0x9C, 0x5B, 0x70, 0x20, 0x6A, 0x37, 0x41, 0xAF, 0x02, 0xE1, 0x28, 0x0E,
+    0x45, 0xD5, 0x10, 0x85, 0x0E, 0x95, 0x44, 0xD1, 0x0A, 0x8A, 0x1D, 0x2A, 0x8C, 0x0E, 0x0A, 0x22,
+    0xD0, 0x8F, 0x4A, 0x86, 0xC2, 0x1C, 0x7C, 0x4D, 0xC6, 0x15, 0xA1, 0x38, 0x18, 0x2D, 0x38, 0x67,
+    0xEF, 0x87, 0x1E, 0x35, 0xE3, 0x2B, 0x15, 0x15, 0x9A, 0x20, 0x94, 0xDC, 0x71, 0x05, 0xA4, 0xF0,
+    0xE4, 0x0D, 0x1C, 0xA1, 0xC0, 0x4D, 0x1C, 0xE6, 0x98, 0xD0, 0x69, 0x11, 0x34, 0x63, 0x4C, 0x8E,
+    0xB8, 0x0A, 0x1A, 0xD2, 0xA7, 0xA0, 0x91, 0x5F, 0x4C, 0xA0, 0x59, 0x17, 0x34, 0x98, 0x12, 0x72,
+    0xDB, 0x2F, 0xBA, 0xB4, 0x74, 0x5C, 0xA8, 0x52, 0x01, 0xEB, 0x78, 0x87, 0x11, 0xDF, 0x9A, 0xD7,
+    0xDC, 0x26, 0x87, 0x2C, 0x1D, 0x15, 0x34, 0x31, 0x66, 0x61, 0xD8, 0x4A, 0x39, 0x1D, 0xB9, 0xC0,
+    0xA0, 0x99, 0x59, 0xD2, 0x18, 0x3C, 0x02, 0x3D, 0x9A, 0x07, 0xC2, 0x5C, 0x82, 0xD7, 0x45, 0x35,
+    0x84, 0xF4, 0x68, 0x0D, 0x65, 0x32, 0x05, 0xAC, 0xB6, 0x70, 0x9A, 0x31, 0x2B, 0x2F, 0xB7, 0x49,
+    0xCF, 0x92, 0xE2, 0x29, 0x2B, 0xBC, 0x81, 0x41, 0x9E, 0xE2, 0x49, 0x60, 0x50, 0x39, 0x64, 0x4D,
+    0x94, 0x84, 0x4A, 0xD4, 0x12, 0xD0, 0x82, 0xC4, 0xAF, 0x59, 0x02, 0x36, 0xB7, 0x1A, 0xCC, 0xE2,
+    0x12, 0x20, 0x01, 0xA8, 0xCC, 0xE8, 0x2A, 0x49, 0xDA, 0x4C, 0xAF, 0x5B, 0x99, 0x87, 0xF2, 0xEF,
+    0x7F, 0x95, 0x2F, 0xE6, 0x58, 0x80, 0x51, 0x3C, 0x99, 0xE0, 0x0A, 0x8C, 0x53, 0x42, 0xC6, 0xF1,
+    0x09, 0x5D, 0x4B, 0x46, 0xD6, 0x64, 0xD2, 0x38, 0x42, 0x2D, 0xA4, 0x8A, 0xD9, 0x3D, 0x4B, 0xAE,
+    0xBC, 0x75, 0xEC, 0xF6, 0x13, 0xBD, 0x16, 0x7E, 0x66, 0x3C, 0x44, 0xC8, 0x41, 0x1B, 0xED, 0x83,
+    0x32, 0xED, 0xB2, 0x02, 0xF3, 0x63, 0x1D, 0x16, 0xF7, 0x83, 0xC2, 0xDB, 0xAE, 0x41, 0x99, 0xE9,
+    0x3D, 0xC4, 0xB3, 0x0B, 0xCC, 0xB0, 0xAC, 0xC0, 0x40, 0x02, 0x34, 0x80, 0x2D, 0x21, 0x48, 0x4C,
+    0xA1, 0xCC, 0x2C, 0x96, 0xAE, 0xA9, 0x30, 0x88, 0x2D, 0x97, 0x5A, 0xBC, 0x23, 0x90, 0x05, 0x9F,
+    0x4E, 0x14, 0x03, 0xCD, 0x89, 0x50, 0x72, 0x96, 0x5B, 0xF0, 0xD2, 0x69, 0x6E, 0xB7, 0xA4, 0x71,
+    0xE2, 0xDC, 0x5E, 0x28, 0x46, 0xAD, 0xA0, 0xEF, 0x96, 0x93, 0x06, 0xA8, 0x9A, 0x34, 0xF2, 0xDD,
+    0xD3, 0xF5, 0xB4, 0x12, 0x74, 0xA9, 0x09, 0x4A, 0xA0, 0x96, 0xE8, 0xB9, 0x2E, 0x2C, 0x04, 0xCD,
+    0x6D, 0xBC, 0x20, 0x4A, 0x89, 0x32, 0x19, 0xF9, 0x39, 0x46, 0xBF, 0x01, 0x8A, 0x15, 0x45, 0x1D,
+    0x91, 0xF4, 0x04, 0x50, 0x40, 0x24, 0x6B, 0x7F, 0x77, 0x64, 0x70, 0x63, 0xF3, 0xFC, 0xBE, 0x95,
+    0x7C, 0x77, 0xE7, 0x5A, 0xF7, 0x70, 0xA5, 0x2C, 0xC8, 0x99, 0x7A, 0x11, 0x35, 0xA1, 0x34, 0x83,
+    0xA6, 0x53, 0x96, 0x00, 0x2B, 0xDD, 0xD4, 0xDE, 0x9C, 0x09, 0x59, 0xC1, 0xA0, 0x28, 0x21, 0xA8,
+    0xA6, 0x15, 0x24, 0x55, 0x59, 0xB6, 0x40, 0xD9, 0x1B, 0x90, 0xBC, 0x90, 0x30, 0x68, 0xD2, 0x01,
+    0x8C, 0x7B, 0x28, 0xDF, 0xF2, 0x4A, 0xBD, 0x0B, 0x8B, 0x7B, 0x5A, 0x69, 0x69, 0xD2, 0x27, 0xF2,
+    0x47, 0x36, 0x60, 0xAE, 0x6B, 0xB3, 0x0A, 0xAE, 0x78, 0x30, 0x88, 0xD2, 0x28, 0x51, 0x72, 0xD8,
+    0xAE, 0x03, 0x48, 0x0C, 0xE0, 0x64, 0x1E, 0x21, 0x88, 0xED, 0x5D, 0x2E, 0x00, 0xD5, 0x72, 0xCD,
+    0x4F, 0xE2, 0x3B, 0x5B, 0xD2, 0x7D, 0xE5, 0xD8, 0x4D, 0x1D, 0x80, 0xBC, 0x07, 0xF2, 0xAF, 0x4C,
+    0x8A, 0x78, 0xEF, 0x9A, 0xCA, 0xEA, 0x5C, 0x3C, 0x00, 0x64, 0x2C, 0xEF, 0x5D, 0xD1, 0xF5, 0xE4,
+    0x28, 0x60, 0x55, 0x5B, 0xD0, 0xA0, 0x23, 0x1A, 0xF4, 0x43, 0x35, 0xF5, 0xDA, 0x02, 0x0A, 0xE3,
+    0x4E, 0x5B, 0x50, 0xF7, 0xFA, 0x00, 0xDC, 0x9B, 0xF6, 0x60, 0x50, 0x28, 0xBF, 0xD5, 0x55, 0x83,
+    0xAC, 0x26, 0x59, 0xD5, 0x9B, 0xE6, 0xEF, 0x27, 0x5C, 0xE1, 0x09, 0x22, 0x80, 0x5E, 0x5B, 0x40,
+    0x29, 0x09, 0xA0, 0x5E, 0x82, 0x93, 0xCF, 0xDA, 0x17, 0xCF, 0x29, 0x61, 0x7C, 0x64, 0xE0, 0xC9,
+    0xE4, 0xC7, 0x97, 0x5D, 0x62, 0x93, 0x01, 0xDA, 0xB0, 0xDB, 0xBC, 0x9F, 0x8D, 0x96, 0x92, 0x55,
+    0xE4, 0x6C, 0x11, 0xF6, 0xD6, 0xEE, 0xD9, 0x6B, 0xB6, 0x08, 0xEC, 0x77, 0x84, 0x4E, 0x96, 0x91,
+    0xAC, 0xC6, 0x09, 0xE6, 0xCA, 0x08, 0x35, 0x07, 0x93, 0x77, 0x28, 0xC2, 0x25, 0x61, 0xE3, 0x6E,
+    0xC0, 0xED, 0xDF, 0xC1, 0x0C, 0xB9, 0x07, 0xF2, 0xE9, 0x8A, 0x76, 0x0F, 0x92, 0x87, 0x5B, 0x3E,
+    0x7E, 0xEC, 0x94, 0x5C, 0x2B, 0x35, 0x33, 0x9B, 0xAE, 0xEB, 0x6D, 0x1E, 0x61, 0x8D, 0x06, 0xC1,
+    0x9F, 0x58, 0xB6, 0x1F, 0x66, 0xF4, 0x9C, 0xDC, 0xF5, 0xC2, 0xF1, 0xD5, 0x68, 0xB9, 0x8A, 0x8D,
+    0xD0, 0x0D, 0xDB, 0x4C, 0x59, 0xFD, 0x9A, 0x8F, 0xA8, 0xFB, 0x4F, 0x02, 0x7E, 0x1B, 0xDD, 0x23,
+    0x4F, 0x53, 0x2A, 0xB7, 0x21, 0x8D, 0x29, 0x4B, 0x4B, 0xCC, 0x45, 0x47, 0x4A, 0x86, 0x54, 0xCC,
+    0x13, 0xE1, 0x2A, 0xE4, 0x11, 0xF2, 0x95, 0xD0, 0x69, 0x43, 0x19, 0x7D, 0x86, 0x75, 0xE7, 0xB1,
+    0xC2, 0xA0, 0x55, 0x5D, 0x43, 0xBD, 0x1F, 0x52, 0xD0, 0x3D, 0x14, 0x0A, 0x6B, 0x1A, 0x34, 0x47,
+    0x06, 0x05, 0x68, 0x1E, 0x58, 0xA9, 0xB8, 0xFB, 0x99, 0xF0, 0x88, 0x10, 0x34, 0xC0, 0x3D, 0x73,
+    0xD6, 0x36, 0xE6, 0xD4, 0x15, 0x2A, 0x41, 0x8E, 0x04, 0xC0, 0x19, 0x97, 0xF2, 0x7C, 0x65, 0x94,
+    0x49, 0x55, 0x9F, 0x0C, 0x7C, 0x67, 0x33, 0xBD, 0x23, 0x1C, 0x5F, 0xAC, 0x1A, 0x9B, 0xC3, 0x71,
+    0xE1, 0x58, 0x7D, 0x48, 0x34, 0x4F, 0xFE, 0x49, 0x05, 0xFA, 0xE9, 0xEA, 0xAE, 0x62, 0xD7, 0x21,
+    0x27, 0x03, 0x85, 0xC1, 0x91, 0x4F, 0x4E, 0x26, 0x29, 0x29, 0xCA, 0x7E, 0x78, 0xF2, 0x3C, 0x17,
+    0xDC, 0xE9, 0x7E, 0x68, 0x37, 0x13, 0xD2, 0x94, 0xCE, 0x53, 0x96, 0x29, 0xC5, 0xCF, 0xA9, 0xBD,
+    0x6A, 0x29, 0x76, 0x44, 0x2A, 0x7C, 0xA8, 0x4A, 0xA9, 0x5B, 0x87, 0xFC, 0x7C, 0x94, 0x35, 0xBC,
+    0xAB, 0xEE, 0xEF, 0x05, 0xDD, 0x98, 0x42, 0x1F, 0x86, 0x09, 0x2B, 0x94, 0xF3, 0xE1, 0xD1, 0xEE,
+    0x0B, 0x44, 0x52, 0x21, 0x45, 0xB5, 0xA2, 0x8E, 0xDF, 0x65, 0x96, 0x57, 0x4E, 0x85, 0x5A, 0xCD,
+    0xC1, 0xE7, 0xFE, 0x18, 0x68, 0x24, 0x7C, 0xEC, 0x12, 0x8D, 0x15, 0x4D, 0xF4, 0xBB, 0x2D, 0x5E,
+    0x29, 0x3F, 0x5A, 0x4A, 0xA3, 0xA8, 0x20, 0xEA, 0xF0, 0xA0, 0x9D, 0xF9, 0x01, 0x72, 0xFC, 0x41,
+    0xE0, 0xC6, 0x39, 0xB2, 0x07, 0xDB, 0xC6, 0xEB, 0xBD, 0x85, 0x3B, 0xDD, 0x25, 0x8B, 0x3D, 0xD5,
+    0xC7, 0x7A, 0xD9, 0x7E, 0x29, 0xE0, 0x4F, 0x54, 0xC0, 0x4F, 0xBC, 0x80, 0xDF, 0x0C, 0x04, 0x7C,
+    0xFE, 0x8C, 0x9D, 0x14, 0x54, 0xA9, 0x98, 0xC2, 0x65, 0x3F, 0xDC, 0x3E, 0x6D, 0x17, 0xC7, 0xDC,
+    0x92, 0x91, 0xF6, 0x8B, 0xAA, 0x50, 0x8B, 0xCD, 0xCD, 0x0B, 0x3A, 0xCD, 0xD7, 0x80, 0x57, 0xA3,
+    0x45, 0xFD, 0xFA, 0xCC, 0xDB, 0x6C, 0xF9, 0x27, 0x42, 0x1E, 0x73, 0xAF, 0x3F, 0xE8, 0x94, 0xBF,
+    0x38, 0x4D, 0x66, 0xE7, 0x78, 0xB2, 0x22, 0x4D, 0x4C, 0x2D, 0x35, 0x26, 0xA8, 0xC5, 0x5C, 0xE5,
+    0x07, 0x54, 0x73, 0xA1, 0x5D, 0x2B, 0x34, 0xDD, 0x26, 0x29, 0x68, 0x9C, 0x8C, 0x08, 0xCA, 0x1D,
+    0x32, 0x9C, 0xC9, 0xDC, 0xA7, 0xC0, 0xF2, 0xEE, 0x42, 0x99, 0xD0, 0xA0, 0x37, 0x2C, 0xF0, 0x42,
+    0x25, 0xCA, 0x03, 0xF0, 0xAE, 0xC3, 0x7A, 0xFD, 0x00, 0xCB, 0x30, 0x1E, 0xA3, 0x1C, 0x96, 0x9B,
+    0x2C, 0x9F, 0x23, 0x20, 0x6E, 0x29, 0x03, 0xB0, 0xED, 0xFA, 0x7A, 0x81, 0x4D, 0x99, 0x93, 0xF2,
+    0x82, 0x6D, 0xE2, 0xF8, 0x27, 0xFC, 0x81, 0xA5, 0x48, 0xD0, 0xE1, 0x3D, 0x3A, 0x48, 0xB4, 0x22,
+    0xD8, 0xDC, 0x39, 0x2F, 0x60, 0x3E, 0xED, 0x64, 0x45, 0x72, 0x60, 0xA2, 0x20, 0x99, 0x76, 0x63,
+    0xE1, 0x08, 0x3B, 0xED, 0x4A, 0xDC, 0x81, 0x05, 0x89, 0x7A, 0x22, 0x19, 0xDD, 0x9D, 0x7C, 0x11,
+    0x36, 0x02, 0xE2, 0x4A, 0x40, 0x56, 0xCA, 0x58, 0x97, 0xF6, 0xD0, 0xA2, 0x66, 0x28, 0x20, 0xC4,
+    0xF8, 0x97, 0x19, 0x2D, 0xDF, 0x1E, 0xFF, 0x25, 0x67, 0x50, 0xA1, 0x2C, 0x54, 0x80, 0xFB, 0xA7,
+    0x37, 0x4F, 0xAF, 0x8A, 0xB2, 0xCF, 0xD8, 0xF9, 0x28, 0xE3, 0x7A, 0x2D, 0x20, 0x12, 0x79, 0x67,
+    0x9E, 0xCA, 0x0A, 0x3C, 0xCF, 0x30, 0x12, 0xB3, 0x7C, 0x8C, 0x33, 0x19, 0x46, 0xE9, 0xDD, 0x2D,
+    0xD5, 0xF5, 0xCC, 0x43, 0xDB, 0x64, 0xC2, 0x0B, 0x17, 0xF1, 0xDC, 0x7C, 0x59, 0x5F, 0xF1, 0x7B,
+    0x90, 0x0A, 0xA5, 0xA8, 0x10, 0xEF, 0x8E, 0xA2, 0xC6, 0xCA, 0x2E, 0xDF, 0x35, 0xB4, 0x4C, 0xE9,
+    0x72, 0x12, 0x95, 0x30, 0x8C, 0xFC, 0x16, 0x4A, 0xA0, 0xDF, 0x40, 0xF8, 0x15, 0x59, 0x7E, 0x91,
+    0xCA, 0x84, 0xCE, 0x53, 0x69, 0xBF, 0x32, 0x05, 0x25, 0x4A, 0x41, 0x8B, 0x52, 0x90, 0x25, 0x82,
+    0xD8, 0x81, 0xB8, 0x24, 0x9D, 0x82, 0xA8, 0x26, 0xDC, 0xC4, 0x55, 0x8A, 0x8F, 0x36, 0x19, 0x91,
+    0x03, 0x88, 0x38, 0x16, 0x3D, 0x83, 0x92, 0x61, 0x12, 0x64, 0x8E, 0x5B, 0x94, 0xB6, 0xB9, 0x75,
+    0x41, 0x04, 0x57, 0xE1, 0xAB, 0x1D, 0x28, 0x64, 0x39, 0x84, 0xA9, 0x06, 0x20, 0x77, 0xD7, 0xDD,
+    0x3A, 0xAF, 0xDF, 0x26, 0xFA, 0xAA, 0x3C, 0xBB, 0xB5, 0x65, 0x5D, 0x01, 0xEE, 0x62, 0x55, 0x0C,
+    0xA4, 0xAC, 0xB1, 0x3B, 0xF6, 0x76, 0xE6, 0xB4, 0x18, 0x7D, 0x8C, 0x63, 0x59, 0xD9, 0x6A, 0x0D,
+    0xEE, 0x66, 0x80, 0x0B, 0x6A, 0x85, 0xE6, 0x54, 0x0A, 0xED, 0x87, 0x49, 0x0F, 0x45, 0x2A, 0xA7,
+    0xC6, 0x08, 0x70, 0xDA, 0x02, 0x52, 0x43, 0x34, 0x1F, 0x58, 0x15, 0x3C, 0x5C, 0xA0, 0xD8, 0xFD,
+    0x10, 0x14, 0xE6, 0xE2, 0xDC, 0x8C, 0x7E, 0xC9, 0xB7, 0xC3, 0x50, 0xA7, 0x7E, 0x5F, 0xBA, 0x27,
+    0x6C, 0xA7, 0xC2, 0x7D, 0x09, 0x5B, 0x3C, 0x87, 0x78, 0x8A, 0xE9, 0x94, 0x2D, 0x50, 0xFA, 0x10,
+    0x14, 0x9E, 0xCC, 0x2B, 0x7F, 0xDD, 0x98, 0x0D, 0x19, 0x61, 0xBB, 0x19, 0x49, 0x2D, 0xB5, 0x36,
+    0xE8, 0x9E, 0xBB, 0x8E, 0x11, 0x73, 0x3F, 0x11, 0x8A, 0x54, 0xC5, 0x11, 0xD9, 0x5A, 0x0C, 0x72,
+    0x3C, 0x42, 0x46, 0xA2, 0x65, 0x83, 0x4A, 0x65, 0x49, 0x6F, 0xD3, 0x02, 0x6A, 0x00, 0xDC, 0x60,
+    0xDF, 0x54, 0x7E, 0x5D, 0xC9, 0xC9, 0x54, 0xF5, 0x71, 0xFD, 0xFF, 0x51, 0x67, 0x6F, 0x73, 0x49,
+    0x29, 0xE5, 0x7A, 0x88, 0x49, 0x22, 0x7B, 0xCA, 0xFD, 0x63, 0x96, 0x53, 0x80, 0xDB, 0xC3, 0x78,
+    0x26, 0x0B, 0x34, 0x97, 0xC9, 0x1B, 0xF3, 0xB9, 0x1D, 0xC8, 0x10, 0x46, 0x68, 0x62, 0xBE, 0x77,
+    0xD6, 0x6C, 0x59, 0x76, 0x37, 0xC8, 0x51, 0xF9, 0xED, 0x04, 0x6A, 0x3E, 0xA7, 0xAB, 0x93, 0x11,
+    0x33, 0xA1, 0x7A, 0x01, 0x8C, 0xA3, 0x10, 0xFD, 0x4D, 0x70, 0xCC, 0x18, 0xCC, 0x41, 0x93, 0xC8,
+    0x1A, 0xF4, 0xEB, 0x1D, 0x5A, 0xFD, 0x4A, 0xDC, 0xBB, 0x85, 0xB5, 0xEA, 0x64, 0xBF, 0xF6, 0x8D,
+    0x64, 0x44, 0xCB, 0xBD, 0x02, 0xA6, 0x00, 0x01, 0x40, 0x08, 0x10, 0x03, 0xA4, 0x19, 0x44, 0x64,
+    0x19, 0xEF, 0xEF, 0xB4, 0x02, 0xDE, 0x15, 0xF6, 0x22, 0xFD, 0x8D, 0x0C, 0xF4, 0xF4, 0xBD, 0x32,
+    0x86, 0x59, 0x0D, 0x60, 0x0E, 0x80, 0x29, 0xD1, 0x01, 0x40, 0xA1, 0x96, 0xCA, 0xC4, 0x29, 0xC7,
+    0x2F, 0x8F, 0xAF, 0x98, 0x49, 0x3B, 0x01, 0x93, 0xFD, 0x97, 0xE0, 0x5F, 0x41, 0x1D, 0xD1, 0x73,
+    0x66, 0x63, 0x6F, 0x55, 0xA5, 0xFF, 0xA8, 0x6A, 0xE0, 0x17, 0x77, 0x99, 0xB7, 0x50, 0x39, 0xE0,
+    0x19, 0x54, 0xF0, 0xA9, 0x86, 0x5B, 0x4A, 0x2E, 0x4C, 0xFA, 0x5B, 0xA5, 0xD7, 0x5C, 0x3F, 0x8C,
+    0x3B, 0xBB, 0x87, 0xCF, 0x0A, 0x28, 0xD5, 0x0A, 0x21, 0x4D, 0x52, 0x17, 0xDC, 0x11, 0xE0, 0xDE,
+    0x09, 0x4A, 0x19, 0xA1, 0x3C, 0x27, 0x91, 0x18, 0xB3, 0x94, 0xC8, 0x14, 0x60, 0x5E, 0x70, 0xC8,
+    0xAF, 0x02, 0x4E, 0x80, 0x25, 0x18, 0x03, 0x70, 0x3A, 0x80, 0x45, 0xA8, 0x2C, 0xA6, 0x84, 0x8C,
+    0x11, 0x01, 0x50, 0xD0, 0x5A, 0x55, 0xB3, 0x2E, 0x9B, 0x08, 0x92, 0x77, 0x93, 0xC2, 0x10, 0x28,
+    0x50, 0x48, 0x96, 0x40, 0xA1, 0x2C, 0x02, 0x73, 0xC0, 0xDB, 0xC5, 0xEC, 0x5E, 0x23, 0xED, 0x11,
+    0x7C, 0xD4, 0x48, 0xD3, 0x84, 0xFF, 0xD4, 0x48, 0x2B, 0x45, 0x6F, 0x00, 0xC6, 0x02, 0xDF, 0x69,
+    0xD3, 0xA7, 0xA1, 0xFB, 0xC8, 0xA6, 0x80, 0x16, 0x30, 0x6D, 0x01, 0xE3, 0x86, 0xB0, 0x06, 0x0C,
+    0x2B, 0xC0, 0xA0, 0x9C, 0x36, 0x7D, 0xA3, 0x2D, 0x1E, 0x00, 0xAC, 0x5D, 0x01, 0x7B, 0x3B, 0x0F,
+    0xBC, 0x83, 0xDA, 0x9F, 0xD1, 0x5F, 0x2D, 0x27, 0x70, 0xCB, 0x09, 0x9C, 0x84, 0xDD, 0xB3, 0x14,
+    0x47, 0x28, 0x93, 0x53, 0xC0, 0x89, 0x15, 0x40, 0xA7, 0x54, 0x65, 0xFD, 0xBF, 0xA0, 0xB9, 0xD4,
+    0xD7, 0x17, 0x11, 0x2E, 0x0E, 0xEC, 0xCF, 0x75, 0x71, 0xC5, 0x04, 0x6E, 0xA8, 0x18, 0x1A, 0xD0,
+    0xD7, 0x8F, 0x59, 0xBF, 0xA3, 0xBC, 0x82, 0xF9, 0xBA, 0x0C, 0x92, 0xD7, 0xC1, 0x6E, 0xBC, 0xA5,
+    0x5A, 0x51, 0xE8, 0x47, 0xCF, 0xCB, 0xD0, 0x10, 0x26, 0x8B, 0x8A, 0xB7, 0x1C, 0x34, 0x88, 0xC3,
+    0x6B, 0x15, 0xC8, 0x67, 0xF2, 0x45, 0xAE, 0x97, 0x08, 0xD7, 0x21, 0x55, 0xBB, 0xED, 0x15, 0xAC,
+    0xB7, 0xE5, 0x15, 0xD2, 0xDF, 0x59, 0x5C, 0x79, 0xDC, 0xD1, 0xAA, 0xFB, 0x03, 0x33, 0xFA, 0x3E,
+    0x46, 0x6D, 0x0D, 0x42, 0x28, 0xCD, 0x58, 0x87, 0xF6, 0x67, 0x25, 0x74, 0x06, 0x2A, 0x25, 0x82,
+    0x20, 0xAC, 0x1E, 0xB4, 0xC7, 0x40, 0x95, 0xDF, 0x9A, 0x63, 0xA1, 0xBD, 0x57, 0xE3, 0x9E, 0xB1,
+    0xFA, 0x1D, 0xDC, 0xEC, 0x9B, 0x0D, 0xD4, 0x72, 0xBE, 0x04, 0x17, 0xAF, 0x75, 0x3B, 0x89, 0x39,
+    0xBA, 0x30, 0x74, 0x3F, 0xA0, 0x6E, 0x2E, 0xE0, 0x71, 0x29, 0x74, 0xB6, 0xA0, 0x73, 0x01, 0xA5,
+    0xCF, 0xB0, 0x76, 0x2B, 0xC3, 0x98, 0xDE, 0x12, 0x23, 0x4F, 0x5D, 0xB3, 0x9E, 0xFC, 0xCB, 0x5A,
+    0x2C, 0xF4, 0x32, 0xFA, 0x00, 0x54, 0x36, 0xFC, 0x90, 0x42, 0xFF, 0x3D, 0xD5, 0xE9, 0x36, 0xE4,
+    0x0F, 0x54, 0xEA, 0x2D, 0x29, 0x01, 0xAB, 0xA6, 0x20, 0x37, 0x9E, 0xE5, 0x1C, 0x71, 0x49, 0xA4,
+    0xC6, 0xE2, 0x18, 0x35, 0xE3, 0x81, 0x13, 0x8C, 0xAB, 0x5E, 0x6B, 0x30, 0x73, 0xDA, 0xB4, 0xE3,
+    0xDA, 0x0A, 0xAE, 0xBA, 0x47, 0x40, 0x17, 0xDA, 0x44, 0x7D, 0x09, 0x5A, 0xA7, 0xFB, 0x57, 0xF6,
+    0x5F, 0x8A, 0x0E, 0xEC, 0x77, 0x1B, 0xA1, 0x44, 0x51, 0x43, 0xAD, 0x7F, 0x4C, 0x55, 0xBF, 0xB3,
+    0x2E, 0x24, 0x0E, 0x65, 0x54, 0xFB, 0xCF, 0x1D, 0xF2, 0xDF, 0xF1, 0xCA, 0x04, 0xE6, 0x07, 0x69,
+    0x28, 0x77, 0x7B, 0x60, 0x7F, 0xD1, 0x66, 0x8D, 0xDA, 0xDE, 0x4A, 0xD7, 0x49, 0x14, 0xFC, 0xEF,
+    0x3E, 0x5C, 0x75, 0x57, 0x91, 0xB2, 0xB9, 0x71, 0xA5, 0xCC, 0x0A, 0x38, 0xB3, 0x89, 0x7D, 0x0A,
+    0xCC, 0xCA, 0x9B, 0x50, 0x28, 0xDF, 0xC6, 0x50, 0x42, 0x1B, 0x91, 0x6D, 0x09, 0x54, 0xE9, 0x02,
+    0x3F, 0x07, 0xAD, 0x01, 0x08, 0xFA, 0x5B, 0x58, 0x6B, 0x9E, 0xB2, 0x52, 0x91, 0xB1, 0x33, 0xA0,
+    0x80, 0x5C, 0x96, 0x42, 0x19, 0x23, 0x7D, 0x02, 0xF8, 0xB2, 0xC5, 0x27, 0x07, 0x50, 0xA0, 0xAC,
+    0x01, 0xAC, 0xAE, 0x07, 0x80, 0x8D, 0x97, 0x1D, 0x2F, 0x3E, 0x52, 0x51, 0xE6, 0x3E, 0xA0, 0x1C,
+    0xBB, 0x31, 0xEE, 0x18, 0x45, 0xB2, 0x82, 0x7B, 0x68, 0xD7, 0xD1, 0x7D, 0x81, 0xA3, 0x8F, 0x63,
+    0xA8, 0x7F, 0x1E, 0x25, 0x52, 0xE9, 0xFC, 0x40, 0x64, 0x56, 0x6B, 0xF1, 0xF8, 0xB0, 0x8A, 0xD6,
+    0xF9, 0x61, 0xD8, 0x8D, 0xA9, 0x07, 0xE0, 0x33, 0xDB, 0x9E, 0xD4, 0x54, 0x6B, 0xF0, 0x62, 0x56,
+    0x39, 0xBE, 0x0B, 0xF0, 0xEE, 0x39, 0x75, 0xCA, 0x29, 0x08, 0x5B, 0x75, 0xD0, 0xC1, 0xE7, 0x3F,
+    0x90, 0x6E, 0xC0, 0x32, 0x4A, 0x23, 0xE4, 0x00, 0xC2, 0x7E, 0x15, 0x75, 0x60, 0xEE, 0x23, 0xAF,
+    0x96, 0xE6, 0xAA, 0x60, 0xB7, 0x07, 0x72, 0xFE, 0xC4, 0x1E, 0x0A, 0xEF, 0x40, 0x59, 0x2A, 0xEF,
+    0x92, 0x13, 0xD6, 0x84, 0xAD, 0x40, 0x61, 0xB1, 0x71, 0xCD, 0x64, 0x1F, 0x9C, 0x01, 0xEE, 0x41,
+    0x3C, 0x82, 0xF5, 0x8D, 0xB0, 0x04, 0xEC, 0x12, 0x67, 0x8D, 0x3A, 0x9C, 0x80, 0xDF, 0x39, 0xCB,
+    0x15, 0x2A, 0x07, 0xA8, 0x55, 0x6C, 0x4A, 0xEF, 0x6C, 0x29, 0x8B, 0x91, 0xB0, 0xBD, 0xDD, 0x99,
+    0x10, 0x01, 0x79, 0x84, 0x55, 0xFB, 0x9E, 0x93, 0x71, 0x45, 0xDA, 0x75, 0xB4, 0x1F, 0xA4, 0x00,
+    0x9A, 0xEB, 0xFC, 0x5B, 0xCF, 0x60, 0x5A, 0x92, 0x1F, 0x24, 0xCF, 0x37, 0x61, 0x85, 0xF4, 0x18,
+    0x89, 0xC0, 0xAB, 0xB2, 0x6D, 0x5C, 0x27, 0xC2, 0xB7, 0x64, 0x57, 0x69, 0x9F, 0xC5, 0xBC, 0x12,
+    0x7E, 0xB2, 0xF2, 0xB4, 0xFF, 0xF8, 0x0B, 0xAC, 0x5C, 0x06, 0x95, 0x25, 0x78, 0xC9, 0x92, 0x4C,
+    0x8F, 0x25, 0xB7, 0xD4, 0x6D, 0x75, 0x60, 0x86, 0x4A, 0xD2, 0x30, 0xC7, 0x4C, 0x65, 0xD0, 0x2C,
+    0x40, 0xBE, 0x50, 0x66, 0x60, 0x88, 0xF6, 0x14, 0xB9, 0x4B, 0x0A, 0xF7, 0x3E, 0x22, 0x03, 0xE2,
+    0xF6, 0xC8, 0x66, 0xDD, 0xB2, 0x68, 0xF7, 0x20, 0x93, 0x3A, 0x7D, 0xE8, 0xD9, 0x9E, 0xFB, 0x76,
+    0x2A, 0xD4, 0x02, 0x04, 0x55, 0xAE, 0xDE, 0x74, 0x9C, 0xDB, 0x00, 0x68, 0xFB, 0xF8, 0xEB, 0xD0,
+    0x3A, 0xB0, 0x59, 0xC1, 0xC8, 0x54, 0x80, 0x4B, 0x5B, 0xB8, 0x26, 0x04, 0x0B, 0x5D, 0x44, 0xB8,
+    0x23, 0x05, 0xD7, 0x37, 0x52, 0x5D, 0x45, 0xE1, 0xA5, 0x7C, 0x78, 0x17, 0x9A, 0x31, 0x57, 0x80,
+    0xB4, 0xD7, 0x1B, 0x3F, 0x06, 0x29, 0xE3, 0x95, 0xB1, 0x14, 0xDF, 0xCD, 0xE0, 0xF2, 0x07, 0xF5,
+    0x38, 0xCE, 0xCC, 0x7F, 0x19, 0x6D, 0x3F, 0xBE, 0x1A, 0xD0, 0xCF, 0x92, 0x5A, 0x2C, 0x02, 0xCE,
+    0xE0, 0x25, 0xB8, 0x6A, 0xA5, 0x9D, 0xFC, 0xB7, 0x67, 0x21, 0xAA, 0x8B, 0x10, 0x22, 0xC4, 0x97,
+    0x2D, 0x2E, 0x3D, 0xB9, 0x67, 0x65, 0x81, 0x5A, 0x44, 0x02, 0x12, 0x2E, 0x55, 0x41, 0x4B, 0xCF,
+    0x29, 0x3A, 0x4E, 0x1D, 0x15, 0x78, 0xFF, 0xAD, 0x25, 0x93, 0x40, 0x7B, 0x13, 0xBD, 0xE8, 0x2C,
+    0x6D, 0xF9, 0xB9, 0x33, 0x81, 0x5C, 0xDC, 0x86, 0x8E, 0x43, 0xFD, 0x03, 0xE1, 0xF4, 0x08, 0x1D,
+    0x78, 0x32, 0xE0, 0x8F, 0x3F, 0x25, 0x69, 0x77, 0x74, 0x65, 0x8D, 0xA5, 0x7A, 0xF1, 0x57, 0x30,
+    0xD7, 0x78, 0x9F, 0xCB, 0x4C, 0xF9, 0x22, 0x3D, 0x6E, 0x6D, 0x26, 0x54, 0xC5, 0x97, 0x6C, 0x67,
+    0x61, 0x2D, 0x76, 0xF7, 0xB3, 0x54, 0x5F, 0x79, 0x01, 0x2D, 0xBF, 0x1D, 0xAA, 0x62, 0x52, 0xC4,
+    0x86, 0xD3, 0xCA, 0xD4, 0xA0, 0xBC, 0x0E, 0x74, 0xAA, 0x42, 0xD7, 0x42, 0x3F, 0x90, 0x9B, 0xD3,
+    0x5C, 0x58, 0xE1, 0xE6, 0x5A, 0x9E, 0x95, 0x23, 0xFB, 0x5F, 0x2A, 0xAD, 0x65, 0xD4, 0x74, 0xB4,
+    0x94, 0xD8, 0x46, 0x42, 0x44, 0xB1, 0xBE, 0xC6, 0xB9, 0x3A, 0x0E, 0x63, 0x6A, 0x3D, 0xE8, 0xF7,
+    0x98, 0xDC, 0xF4, 0xDD, 0x45, 0xFC, 0x8B, 0x02, 0x7F, 0xDF, 0xCD, 0xBF, 0x30, 0x76, 0xCD, 0x36,
+    0xED, 0x3E, 0xCE, 0x1F, 0x3C, 0x0D, 0x9D, 0x51, 0x97, 0xD6, 0xDD, 0xDE, 0xF1, 0x30, 0xCB, 0x3F,
+    0xC9, 0xDF, 0x08, 0xC6, 0xDC, 0x05, 0xF4, 0x01, 0x9D, 0xC9, 0x6E, 0x9A, 0xA1, 0xDE, 0xA1, 0x3C,
+    0x10, 0xEF, 0x3A, 0x83, 0xD0, 0x3C, 0xF6, 0xF8, 0xCE, 0x39, 0xC5, 0x5C, 0x30, 0x88, 0xC1, 0xA2,
+    0xA8, 0x59, 0x0F, 0xF8, 0xCE, 0x05, 0xC5, 0x25, 0xB4, 0x49, 0xC0, 0x42, 0xC4, 0x46, 0x10, 0x1A,
+    0xC7, 0x34, 0xCA, 0xC7, 0xE5, 0x14, 0x1A, 0x46, 0x13, 0x83, 0xD8, 0xAA, 0x12, 0xB1, 0x35, 0x6A,
+    0x0C, 0xAC, 0x40, 0x2C, 0xE2, 0x5E, 0xDB, 0xB8, 0xE2, 0x8C, 0xA6, 0xE2, 0xFF, 0x83, 0xD1, 0xDE,
+    0x55, 0xBB, 0xFB, 0x4B, 0xB7, 0x80, 0xBA, 0xF5, 0xB2, 0xF2, 0x8B, 0x3A, 0x2E, 0x09, 0x5B, 0xA2,
+    0x59, 0x37, 0x44, 0x01, 0x3F, 0xDC, 0xD5, 0x4B, 0x60, 0xD5, 0x23, 0x2A, 0x88, 0xBA, 0x27, 0x62,
+    0xFA, 0x6E, 0x5C, 0xF1, 0x5A, 0x53, 0xF6, 0x03, 0xDD, 0x46, 0xF0, 0xCC, 0x49, 0xBD, 0xDE, 0x4E,
+    0x8F, 0x46, 0x04, 0x1F, 0xD0, 0xF2, 0xA8, 0xA7, 0xE5, 0x23, 0x2E, 0xBE, 0x69, 0xF2, 0x78, 0x74,
+    0x0C, 0x17, 0xE7, 0x60, 0x68, 0xE2, 0x05, 0xD8, 0x1B, 0x67, 0xD0, 0xA4, 0x6D, 0x72, 0x4A, 0x26,
+    0xD5, 0x6C, 0x6D, 0xAF, 0x8E, 0x99, 0x27, 0x5B, 0x00, 0x3A, 0xA2, 0xE8, 0xFF, 0xF0, 0xDA, 0x01,
+    0x6A, 0xAF, 0xD9, 0x3B, 0x6B, 0x00, 0x1C, 0xBB, 0x1A, 0x78, 0xE8, 0x84, 0x40, 0xAC, 0x76, 0x9E,
+    0x01, 0xA6, 0xD1, 0x87, 0x2E, 0x09, 0x11, 0x31, 0x80, 0x34, 0x5A, 0x04, 0x0F, 0x63, 0xF9, 0x28,
+    0xA4, 0xAE, 0x2C, 0xAA, 0xE0, 0x33, 0xD5, 0xC2, 0x73, 0x4B, 0x84, 0x72, 0xF4, 0xD2, 0x0C, 0x5A,
+    0x69, 0xCE, 0x6C, 0x60, 0x74, 0xBF, 0x10, 0x5A, 0x2A, 0x4F, 0x9F, 0xB2, 0x2A, 0x06, 0x5C, 0x6F,
+    0xD5, 0xD4, 0xF0, 0x46, 0x63, 0xDF, 0x86, 0x3E, 0xF8, 0xFD, 0x5A, 0x44, 0x70, 0xA9, 0xD0, 0xBD,
+    0x2A, 0xFE, 0xA8, 0xC3, 0x52, 0x59, 0x86, 0xEA, 0x80, 0x52, 0x68, 0xA4, 0x02, 0x7C, 0x1F, 0x2A,
+    0xB4, 0xA5, 0x88, 0x4A, 0x05, 0x5D, 0xA4, 0x46, 0xCB, 0x68, 0x01, 0x6D, 0x3A, 0x0E, 0x70, 0xC5,
+    0xF4, 0x30, 0x70, 0x38, 0x57, 0x9C, 0xE5, 0xD4, 0xF7, 0xC8, 0x25, 0x53, 0x76, 0x7B, 0x5A, 0xCE,
+    0x38, 0x08, 0xE0, 0x0B, 0x46, 0x45, 0x63, 0x25, 0xCB, 0xDB, 0xB4, 0x1D, 0xCB, 0xDA, 0x53, 0x99,
+    0x89, 0x70, 0x96, 0x4D, 0x04, 0x85, 0x63, 0x40, 0x3B, 0xDD, 0xC8, 0x5E, 0xF8, 0xB0, 0x4D, 0xA1,
+    0xFD, 0xCF, 0xDE, 0xA1, 0x93, 0x6C, 0x0A, 0x9A, 0x99, 0x60, 0x9D, 0x4C, 0x32, 0x2A, 0xAF, 0xAD,
+    0x7A, 0x0D, 0x48, 0x99, 0xD4, 0x63, 0xD3, 0xC5, 0xCE, 0x79, 0xAC, 0x13, 0xEE, 0xD8, 0xDD, 0x97,
+    0x8D, 0x3A, 0x49, 0xAE, 0xC0, 0xE1, 0x70, 0x71, 0x8E, 0xED, 0xCA, 0xD0, 0xAB, 0xDD, 0x55, 0xFD,
+    0xD9, 0xED, 0x2D, 0xF0, 0xD6, 0x74, 0x4E, 0x1F, 0xFA, 0xAA, 0xF7, 0xE7, 0xFC, 0x1C, 0x1E, 0xEB,
+    0xCE, 0x2D, 0x44, 0x45, 0x15, 0xB5, 0xC5, 0x59, 0xBB, 0xB7, 0x5A, 0x13, 0x0F, 0x73, 0x33, 0xB8,
+    0xB0, 0x87, 0x27, 0x69, 0x27, 0xDA, 0x7F, 0xE5, 0xB2, 0x56, 0x5A, 0x75, 0x3C, 0xE5, 0xC6, 0xF9,
+    0x7D, 0xF5, 0x81, 0x8D, 0xDD, 0x0A, 0xDB, 0xBE, 0xAF, 0x26, 0xDB, 0x03, 0x6B, 0xCD, 0x28, 0xA3,
+    0xF6, 0x16, 0xD6, 0x06, 0xB5, 0x85, 0x34, 0x6A, 0x1A, 0xA9, 0x61, 0x29, 0xC9, 0x37, 0x2A, 0x7A,
+    0x4E, 0x99, 0x13, 0xB4, 0xA3, 0x78, 0xEB, 0xBB, 0x5A, 0x6B, 0xF0, 0xD0, 0xEC, 0xCE, 0xE6, 0xA6,
+    0x19, 0x3A, 0xC7, 0x2F, 0xD1, 0xAE, 0xDD, 0xDB, 0xB9, 0x82, 0xD9, 0x5B, 0x0E, 0x6E, 0xF0, 0xB7,
+    0xC7, 0x5A, 0x18, 0xDD, 0x41, 0x60, 0x9A, 0xC9, 0x47, 0xAF, 0x38, 0x0B, 0x11, 0x5E, 0x81, 0x88,
+    0x32, 0x01, 0xCD, 0x49, 0xFA, 0xCE, 0x1A, 0x0C, 0x22, 0x1C, 0x3F, 0xBC, 0x2F, 0x45, 0xFE, 0xCD,
+    0x61, 0x4E, 0x90, 0x81, 0x84, 0x60, 0x8E, 0x3C, 0xB0, 0xDF, 0x79, 0x25, 0xCB, 0x41, 0x82, 0xB3,
+    0x9C, 0xBA, 0xF8, 0x22, 0x56, 0x1D, 0xBD, 0x63, 0x09, 0x7B, 0xB8, 0x97, 0x09, 0x63, 0x94, 0x41,
+    0xC3, 0xE6, 0xAF, 0xC4, 0x5D, 0xC7, 0x50, 0xC2, 0xCF, 0x5E, 0x85, 0x2D, 0x01, 0xA5, 0x8D, 0x08,
+    0xA5, 0x4D, 0x28, 0x82, 0xC1, 0x64, 0x12, 0xB7, 0xBD, 0x06, 0x92, 0xCD, 0xEF, 0xD0, 0x9C, 0x3C,
+    0x33, 0xC6, 0xA2, 0x99, 0xB4, 0x94, 0xEC, 0xA6, 0x0D, 0x98, 0x32, 0x33, 0xAB, 0x11, 0xA9, 0x63,
+    0x82, 0x32, 0xA8, 0x68, 0x48, 0xE1, 0x24, 0x77, 0x01, 0x50, 0x14, 0x73, 0xB4, 0x72, 0x28, 0xE4,
+    0x36, 0xDC, 0x17, 0x46, 0x36, 0xA8, 0xB2, 0xB9, 0x0C, 0xF5, 0xA0, 0x92, 0xD2, 0x26, 0x6D, 0x50,
+    0x49, 0x69, 0xB3, 0x26, 0xA8, 0x64, 0xDC, 0x07, 0x75, 0x50, 0x85, 0xA5, 0x09, 0xAB, 0x00, 0xB3,
+    0x22, 0x92, 0x22, 0x67, 0xA0, 0xBB, 0x41, 0x25, 0xB2, 0x7E, 0x9A, 0x07, 0x95, 0xBA, 0xC6, 0x55,
+    0xE3, 0xDE, 0x8D, 0x5C, 0x29, 0xE0, 0x84, 0xB5, 0x9F, 0x2A, 0x91, 0xFB, 0x88, 0x76, 0xBD, 0x0F,
+    0xE8, 0x7D, 0x93, 0xD3, 0x19, 0x70, 0x91, 0xC1, 0x04, 0x34, 0xE7, 0x3C, 0xB2, 0xB4, 0xB5, 0x61,
+    0x84, 0x4E, 0xD4, 0xF2, 0xDA, 0x64, 0x6F, 0xD5, 0xF2, 0x0E, 0xE9, 0x1B, 0x32, 0x1B, 0xAB, 0xF4,
+    0x7A, 0x2B, 0x4F, 0x4D, 0x5F, 0x97, 0x59, 0x55, 0xA4, 0xAF, 0x89, 0x28, 0x91, 0xA7, 0xD4, 0xF8,
+    0xA7, 0x0B, 0x12, 0x65, 0x92, 0x00, 0xF6, 0x13, 0x3D, 0x48, 0x85, 0x3A, 0x54, 0xCE, 0xA9, 0x50,
+    0xCD, 0x80, 0xE1, 0x87, 0xF4, 0xDA, 0x30, 0xF1, 0xEF, 0x5B, 0xC5, 0xAF, 0x59, 0xE2, 0x6C, 0xAE,
+    0x58, 0x26, 0xAD, 0x0C, 0xD3, 0x1B, 0xCF, 0x58, 0x46, 0x81, 0x38, 0x11, 0xDA, 0x5B, 0xAF, 0x5D,
+    0x9C, 0x85, 0x8C, 0xA6, 0x6B, 0x9D, 0xBD, 0x4D, 0xF3, 0x61, 0x69, 0x7F, 0x02, 0xF3, 0x5D, 0x54,
+    0xDA, 0x4B, 0x30, 0xE7, 0xC5, 0x85, 0xBD, 0x04, 0xD7, 0x3E, 0xA9, 0xD3, 0x73, 0x74, 0x45, 0x44,
+    0xDD, 0x12, 0x42, 0xA9, 0xA3, 0x7D, 0x1D, 0xD6, 0x04, 0xA9, 0x27, 0xDC, 0x14, 0xE7, 0x72, 0xED,
+    0x1B, 0x6A, 0xBD, 0x80, 0x85, 0x42, 0xAD, 0x33, 0xDE, 0xF3, 0xDE, 0x30, 0xEC, 0x2A, 0xC5, 0x4C,
+    0x58, 0x10, 0xC7, 0x78, 0x2F, 0xE0, 0xF7, 0x4A, 0xE2, 0xEC, 0xA7, 0x15, 0xB1, 0x85, 0x72, 0x38,
+    0x95, 0x39, 0x32, 0x69, 0x54, 0xBD, 0x8A, 0xDE, 0x54, 0x26, 0xC6, 0x63, 0x59, 0xB9, 0x77, 0xAF,
+    0xDD, 0x83, 0x43, 0x5E, 0xBA, 0x88, 0x3E, 0xE8, 0xA4, 0x2B, 0xD3, 0x45, 0xFC, 0x4E, 0x27, 0x23,
+    0x23, 0x5D, 0xA4, 0xAF, 0x77, 0xD2, 0x99, 0x52, 0xDB, 0xD7, 0x3B, 0xE9, 0x4D, 0xC1, 0x7F, 0xD1,
+    0x49, 0x77, 0x4A, 0xEB, 0x8E, 0xBB, 0x89, 0xF4, 0xE7, 0xF5, 0x6E, 0xDC, 0x31, 0x02, 0x88, 0xE5,
+    0xAD, 0xA2, 0x91, 0x53, 0x7B, 0x08, 0xCF, 0x9D, 0xAA, 0xB9, 0x03, 0xEB, 0x23, 0xED, 0x32, 0xE8,
+    0x6E, 0x2E, 0x6D, 0x23, 0xFB, 0xD3, 0x66, 0xA9, 0x56, 0x90, 0xC9, 0x5D, 0x1B, 0x1F, 0x11, 0x42,
+    0x8B, 0x70, 0xD1, 0x87, 0xBB, 0xD9, 0xDF, 0xDB, 0x08, 0xFE, 0x48, 0x97, 0x2C, 0x7D, 0x95, 0x26,
+    0x76, 0xDA, 0x11, 0xC1, 0xA2, 0x29, 0xF2, 0x3E, 0x75, 0x1D, 0x58, 0x2A, 0xE6, 0xD4, 0xD9, 0xC9,
+    0x5C, 0xAD, 0x69, 0x95, 0x73, 0xD2, 0x2F, 0x91, 0xF7, 0xFA, 0x0A, 0xAD, 0xB3, 0x55, 0x3A, 0x19,
+    0x0D, 0x2B, 0x38, 0xDC, 0x20, 0xD9, 0xF4, 0xF2, 0xDC, 0x77, 0xB8, 0x5E, 0x7F, 0xD4, 0xF6, 0x8B,
+    0x2E, 0x59, 0x9C, 0x11, 0x57, 0xC3, 0x09, 0x2B, 0x25, 0x23, 0xEE, 0xA7, 0x32, 0xD2, 0xAB, 0xEC,
+    0x27, 0xB5, 0x4C, 0x9A, 0xEC, 0x92, 0x2C, 0x69, 0x45, 0x26, 0xFD, 0x1B, 0xE7, 0xD9, 0x73, 0x1D,
+    0x06, 0xEB, 0x1C, 0xFE, 0xAC, 0x19, 0x7B, 0x36, 0x76, 0x43, 0xE2, 0x80, 0x93, 0x50, 0x3D, 0x90,
+    0xC1, 0x3A, 0x6E, 0x3E, 0x4B, 0x2A, 0x3D, 0xB6, 0x64, 0xFF, 0xF8, 0x61, 0xA0, 0x03, 0x12, 0xA1,
+    0x5E, 0xCB, 0x50, 0x15, 0x38, 0xE0, 0x5F, 0xE0, 0xF2, 0x61, 0x9D, 0xA7, 0x92, 0x3B, 0xA9, 0x4D,
+    0x1F, 0xF6, 0x83, 0xE1, 0xE7, 0x48, 0xA8, 0x50, 0xC3, 0xF8, 0x03, 0x96, 0x06, 0x5F, 0x17, 0x9E,
+    0x40, 0x19, 0xCF, 0xB5, 0xCE, 0x45, 0x86, 0xC1, 0x14, 0x4D, 0x03, 0x28, 0x06, 0x63, 0x5C, 0x86,
+    0xB5, 0x3B, 0x41, 0x47, 0xBD, 0x8E, 0xC1, 0x07, 0xCB, 0xD6, 0x75, 0xAE, 0xC8, 0x9D, 0x3B, 0x19,
+    0x86, 0x80, 0x80, 0x2E, 0x94, 0x8A, 0x8A, 0x94, 0xAF, 0x26, 0x63, 0x9B, 0xD3, 0x3B, 0x5D, 0x4C,
+    0x1B, 0x8C, 0x11, 0x79, 0x29, 0x0E, 0x1D, 0x59, 0x00, 0x4B, 0x1D, 0x71, 0xB9, 0xA2, 0xDA, 0x8F,
+    0xC7, 0x94, 0xF5, 0x4D, 0xE4, 0xF6, 0x77, 0x1B, 0x11, 0x91, 0x17, 0xF1, 0xF5, 0x26, 0xC6, 0x7C,
+    0xBD, 0xD4, 0x44, 0x98, 0xBC, 0x93, 0x26, 0x2C, 0x65, 0x26, 0x4F, 0xE0, 0xFF, 0xF9, 0x7A, 0x37,
+    0x69, 0x66, 0x98, 0xE3, 0x93, 0x46, 0x06, 0xF6, 0x39, 0x73, 0x5A, 0x26, 0x1F, 0xBD, 0x58, 0x5F,
+    0xB7, 0x97, 0x85, 0xBB, 0xE2, 0x32, 0x5F, 0x20, 0x04, 0x4F, 0xDD, 0x32, 0xE6, 0xF4, 0x89, 0x45,
+    0x3B, 0x57, 0xB3, 0x9B, 0x26, 0xAD, 0xC7, 0x3E, 0x94, 0x8F, 0xA0, 0x56, 0x16, 0xF8, 0xE4, 0x79,
+    0xA9, 0x51, 0x8C, 0x46, 0xA5, 0xEA, 0x34, 0x46, 0xAB, 0x9E, 0xB9, 0x46, 0xAA, 0x94, 0xF2, 0xBA,
+    0x76, 0x85, 0x67, 0x0F, 0x5C, 0x08, 0xE1, 0x57, 0xAE, 0x51, 0x6E, 0x04, 0xB7, 0xA1, 0x0A, 0x49,
+    0xE1, 0x2C, 0xA1, 0xFE, 0x4A, 0x97, 0xCE, 0x0B, 0xDD, 0xD5, 0x8E, 0x6A, 0x2D, 0x06, 0x5D, 0x24,
+    0x30, 0x82, 0xF7, 0xFC, 0xED, 0x49, 0x33, 0x85, 0x11, 0x7C, 0xD4, 0x21, 0xC4, 0x2C, 0xFB, 0x05,
+    0x64, 0x52, 0x52, 0x23, 0x75, 0xD6, 0xEE, 0x38, 0x3C, 0x93, 0xE9, 0x0B, 0x1B, 0x24, 0xDA, 0x3D,
+    0xF8, 0x2A, 0x55, 0x01, 0x8D, 0xD3, 0xEF, 0x46, 0xA4, 0xCC, 0xE7, 0x6D, 0xEF, 0xC6, 0x91, 0x39,
+    0x97, 0x8D, 0x93, 0xD7, 0x9C, 0x0D, 0x3B, 0x74, 0xAE, 0x15, 0x32, 0x95, 0x6F, 0x9D, 0x25, 0x3D,
+    0xF0, 0x60, 0xEF, 0xDA, 0x4D, 0xA5, 0xF0, 0x34, 0xDC, 0x8F, 0x9D, 0x82, 0xF2, 0x98, 0x0C, 0xE1,
+    0x69, 0x0D, 0x49, 0xAB, 0x98, 0x35, 0x24, 0x41, 0x0F, 0x87, 0x78, 0xDF, 0x68, 0x89, 0x64, 0x25,
+    0x81, 0xBB, 0x5A, 0x3D, 0xA3, 0xB4, 0x62, 0xFF, 0xB2, 0xD9, 0x6A, 0x55, 0xD7, 0x5E, 0xAB, 0x13,
+    0x5F, 0xA9, 0xF3, 0x7B, 0x4E, 0x4F, 0x3B, 0x8A, 0x90, 0x33, 0x55, 0x94, 0x1E, 0x01, 0xE9, 0x0A,
+    0x1B, 0x95, 0x47, 0x83, 0x99, 0x90, 0xE0, 0xB0, 0x06, 0x0C, 0x9A, 0x25, 0x9C, 0x29, 0x6C, 0x01,
+    0xA7, 0x0A, 0xBB, 0x25, 0x9C, 0x74, 0x2B, 0x9F, 0xE4, 0xB8, 0x32, 0x2D, 0x71, 0x6F, 0x5C, 0xCB,
+    0x12, 0x53, 0x47, 0x7C, 0x85, 0x80, 0x43, 0x7A, 0xAC, 0x94, 0x74, 0x4B, 0x5F, 0xC3, 0x69, 0x43,
+    0xCB, 0xA3, 0x42, 0xEF, 0x8A, 0x3A, 0x27, 0x75, 0xAA, 0xDD, 0x72, 0xCB, 0x32, 0x85, 0xCF, 0x90,
+    0xC2, 0xA1, 0x0F, 0x93, 0x41, 0x85, 0xC1, 0x1B, 0xD5, 0x8C, 0x02, 0x19, 0xF8, 0xFD, 0xC2, 0x87,
+    0x16, 0xDC, 0xD5, 0x01, 0x50, 0xBF, 0xE5, 0x95, 0x7A, 0x17, 0x4A, 0x08, 0x6B, 0x94, 0x06, 0xCD,
+    0x9E, 0x08, 0xD3, 0xE5, 0xC4, 0x51, 0x21, 0xD6, 0x5F, 0xD5, 0xAF, 0x63, 0x65, 0xBA, 0xA8, 0xD7,
+    0xDB, 0x6F, 0xFA, 0x93, 0x2A, 0xFE, 0x7C, 0x60, 0xFA, 0x2B, 0x28, 0x01, 0xA4, 0xA4, 0x03, 0x4B,
+    0xB0, 0xB7, 0x93, 0xF5, 0xA6, 0xBF, 0xAC, 0x80, 0xAF, 0xA5, 0xF0, 0x2C, 0xB7, 0x0F, 0x36, 0xFD,
+    0x61, 0xD8, 0xCE, 0xEE, 0x42, 0x0D, 0x16, 0x77, 0x64, 0x75, 0x08, 0x6D, 0x47, 0x17, 0x84, 0xFF,
+    0xA3, 0xBE, 0xA9, 0x80, 0x1A, 0x0E, 0x48, 0x27, 0x55, 0xF7, 0x21, 0x86, 0x91, 0xFA, 0x2B, 0xCC,
+    0x95, 0x4A, 0x82, 0x8C, 0xA7, 0x39, 0xC9, 0x78, 0xA1, 0x41, 0xE3, 0x6C, 0xD3, 0x3F, 0x50, 0x82,
+    0xFA, 0x17, 0xDB, 0x8B, 0x60, 0x53, 0x27, 0x82, 0x35, 0x3D, 0xEB, 0xE1, 0x45, 0x30, 0xE7, 0x3F,
+    0xF1, 0x65, 0xE8, 0x38, 0xA0, 0xFA, 0x2C, 0xE1, 0x8F, 0x03, 0x4F, 0x11, 0xCA, 0x7A, 0xF1, 0x3D,
+    0x3C, 0x94, 0xEE, 0x88, 0x1A, 0x40, 0x86, 0x69, 0x39, 0xE9, 0xC0, 0xCD, 0x8C, 0xB9, 0xA4, 0x8D,
+    0xEC, 0xD3, 0x64, 0xCD, 0x7F, 0x82, 0x92, 0xC1, 0x97, 0x18, 0x5D, 0x92, 0x55, 0x37, 0x26, 0x4D,
+    0x97, 0x1B, 0x67, 0x98, 0x41, 0x98, 0x86, 0x17, 0xF1, 0x36, 0x5E, 0x86, 0x3C, 0x3A, 0x65, 0x4F,
+    0x81, 0xB9, 0x42, 0x93, 0x5F, 0x22, 0x13, 0xB4, 0x20, 0xDD, 0x29, 0xA2, 0x55, 0x81, 0xF4, 0x49,
+    0x6B, 0xB1, 0x33, 0x7F, 0xBB, 0xC3, 0xB1, 0x4C, 0x0B, 0x57, 0x1D, 0x43, 0xA3, 0xD0, 0x84, 0x68,
+    0xC9, 0x6C, 0x4A, 0x8E, 0x32, 0x59, 0x51, 0x2D, 0x3C, 0xDE, 0xB6, 0x1D, 0xFE, 0x8C, 0x97, 0x0A,
+    0xA1, 0xC8, 0x69, 0xA5, 0x7A, 0x51, 0x46, 0xE3, 0xA1, 0xAD, 0xE3, 0x96, 0x11, 0xC6, 0x70, 0xDA,
+    0x99, 0x8E, 0x02, 0xEB, 0xC2, 0x6C, 0x74, 0xF5, 0xB0, 0xB9, 0x34, 0xBC, 0xCC, 0x42, 0x86, 0xCD,
+    0xD1, 0xA5, 0x48, 0xAD, 0xB7, 0x02, 0x09, 0xE0, 0x4F, 0x54, 0x83, 0xA7, 0x67, 0x70, 0x53, 0xE0,
+    0x02, 0x40, 0xE4, 0x32, 0x3A, 0xCB, 0xEA, 0x29, 0x1C, 0xB0, 0x12, 0xBD, 0x80, 0x3C, 0x8C, 0xDE,
+    0x26, 0x32, 0x6E, 0xE7, 0x4E, 0xE5, 0x2D, 0x5B, 0x9A, 0x05, 0xA0, 0x31, 0x7E, 0xAB, 0xD1, 0x07,
+    0x0B, 0x19, 0x7F, 0x8F, 0xF1, 0x45, 0x90, 0x9B, 0xE2, 0xDB, 0x08, 0x98, 0xCD, 0xF1, 0xA6, 0x22,
+    0xF2, 0xFA, 0xAA, 0x07, 0x4B, 0x51, 0x6B, 0xC6, 0xEE, 0x24, 0xF7, 0x34, 0x75, 0x24, 0x36, 0x71,
+    0x7E, 0x59, 0xEA, 0x04, 0x37, 0x68, 0x9E, 0xE9, 0x52, 0x97, 0xB0, 0x34, 0x34, 0x9A, 0xB4, 0x5E,
+    0x66, 0x3A, 0x28, 0x97, 0xA7, 0xF9, 0xF2, 0xB4, 0x5F, 0xCF, 0xE8, 0x80, 0xA7, 0xC4, 0xC2, 0xC9,
+    0x1E, 0x0C, 0x18, 0xC1, 0x3B, 0xD9, 0x56, 0x03, 0x48, 0xB8, 0x08, 0x82, 0x5B, 0x16, 0x09, 0xEA,
+    0x59, 0xA7, 0x72, 0x88, 0x68, 0x80, 0x2C, 0xB5, 0x31, 0x84, 0xB6, 0x56, 0xCA, 0xA7, 0x49, 0xB3,
+    0xD5, 0x13, 0x3A, 0xD1, 0xA0, 0x01, 0xA5, 0xDD, 0xE8, 0x4A, 0x30, 0x6D, 0xA9, 0x83, 0x42, 0x9B,
+    0x91, 0x1B, 0x2D, 0x59, 0x7C, 0x58, 0x3A, 0x5D, 0x84, 0x65, 0x5F, 0x30, 0x5E, 0x05, 0x42, 0x17,
+    0x63, 0xC3, 0x52, 0xB2, 0xF6, 0x57, 0x19, 0x29, 0x34, 0x57, 0x85, 0xBA, 0xB4, 0x56, 0xE2, 0x28,
+    0x10, 0x23, 0xFA, 0xD5, 0x54, 0xDA, 0x79, 0x3F, 0xF4, 0xE5, 0xEB, 0x87, 0x43, 0x8B, 0xAB, 0x1F,
+    0x2A, 0x65, 0xAF, 0xE4, 0xCC, 0xFB, 0x33, 0x6F, 0x60, 0xCC, 0xFA, 0x46, 0xCC, 0x94, 0x8A, 0x8C,
+    0x54, 0x2B, 0xAA, 0xFE, 0x19, 0x42, 0xDE, 0x0B, 0xE5, 0x3E, 0x3B, 0xEF, 0xE9, 0xA0, 0x3C, 0x32,
+    0xFA, 0xEE, 0x5E, 0x47, 0x96, 0xF4, 0xB9, 0x2A, 0xD6, 0x64, 0x0B, 0x81, 0xA5, 0x56, 0x5D, 0x26,
+    0x09, 0x54, 0xD9, 0xB4, 0x2D, 0x1B, 0xE7, 0xEA, 0x6D, 0x34, 0x2A, 0xE2, 0x00, 0xC4, 0xEF, 0xE6,
+    0x7A, 0xC3, 0x5C, 0x6F, 0x4F, 0x42, 0x2D, 0x4C, 0x24, 0xCE, 0xCB, 0x11, 0x7C, 0xFB, 0xDF, 0x6F,
+    0x75, 0xB9, 0xF7, 0x5E, 0x61, 0x54, 0xD6, 0xEB, 0xA0, 0x97, 0x0A, 0xDE, 0x5C, 0x56, 0xD7, 0x8C,
+    0x2B, 0xB3, 0xEF, 0x27, 0x5E, 0xC6, 0x2A, 0x87, 0xDE, 0x7C, 0xBE, 0x70, 0x0E, 0xB0, 0xCA, 0x50,
+    0x47, 0x4D, 0x1A, 0x40, 0x9D, 0x03, 0xEF, 0x74, 0xF5, 0x95, 0x4C, 0x15, 0x16, 0x03, 0xC8, 0x4F,
+    0xF4, 0xDB, 0xB8, 0xFA, 0x32, 0x74, 0x69, 0x4D, 0x7A, 0xA1, 0x65, 0x09, 0xB5, 0x13, 0xEA, 0x9C,
+    0x57, 0xDC, 0xCC, 0x45, 0x12, 0x70, 0x9C, 0x7D, 0x4B, 0x2B, 0x71, 0xCA, 0x2B, 0x04, 0x6C, 0xE7,
+    0x67, 0xB5, 0xDD, 0xEB, 0xA7, 0xAF, 0x9E, 0x54, 0x33, 0x3D, 0x19, 0xFF, 0xCF, 0xCA, 0x39, 0x4D,
+    0xCD, 0x7C, 0x6F, 0x4E, 0x5B, 0xFF, 0x36, 0xFD, 0x49, 0xFF, 0x95, 0x77, 0x9E, 0xDB, 0xF0, 0x34,
+    0x60, 0xDB, 0x44, 0x0C, 0xFF, 0xA3, 0xBB, 0x29, 0xC5, 0xCE, 0x66, 0xEC, 0x2A, 0x09, 0xDF, 0x21,
+    0x2C, 0x88, 0xC9, 0xAF, 0xCC, 0xE5, 0xD0, 0x2A, 0x5B, 0x88, 0x9E, 0xD2, 0x61, 0x33, 0xEE, 0xE5,
+    0x35, 0xED, 0x9F, 0x03, 0x4F, 0x54, 0xB2, 0xF7, 0x27, 0xD0, 0xCB, 0xF2, 0x44, 0x45, 0x80, 0xFE,
+    0x04, 0xDE, 0x77, 0x3C, 0x09, 0xE9, 0x72, 0x09, 0x19, 0x87, 0x8E, 0xC9, 0x08, 0xD1, 0xB0, 0x2E,
+    0x10, 0x60, 0x6A, 0x8B, 0xC8, 0xCE, 0x53, 0x17, 0x49, 0xE4, 0x35, 0x27, 0xDA, 0x92, 0x42, 0xE9,
+    0x2E, 0xD0, 0x0F, 0x75, 0x0A, 0x86, 0x95, 0xD5, 0x3C, 0xEE, 0xB3, 0x0F, 0xF8, 0x9C, 0x15, 0x7E,
+    0x26, 0x67, 0x8E, 0x40, 0xFA, 0xB4, 0x0A, 0xED, 0x54, 0xF1, 0xCB, 0xAF, 0x9C, 0x9A, 0x9B, 0x3E,
+    0x4E, 0x79, 0x19, 0x02, 0xD1, 0x1B, 0x74, 0x62, 0xF7, 0xB9, 0x6B, 0x4A, 0x97, 0x60, 0xE2, 0xF8,
+    0x4B, 0xF8, 0xE3, 0x1C, 0x49, 0x55, 0x7A, 0x12, 0x4C, 0xF3, 0x09, 0x9A, 0x54, 0xC6, 0xD0, 0xFF,
+    0x36, 0x5F, 0xDA, 0xEA, 0xD4, 0xF3, 0x60, 0xAA, 0x54, 0x90, 0x83, 0xBD, 0xD4, 0x16, 0x4C, 0x55,
+    0x37, 0x0A, 0xBC, 0x33, 0x57, 0x4C, 0x3F, 0x00, 0xE2, 0x31, 0x57, 0x30, 0xC5, 0x15, 0x35, 0x59,
+    0x49, 0x24, 0x9D, 0x53, 0x22, 0x2C, 0xC2, 0x49, 0x42, 0xF2, 0x9C, 0x7B, 0x8E, 0xBD, 0xFD, 0xAD,
+    0x63, 0x36, 0x93, 0x88, 0xA3, 0xF7, 0x2C, 0xFF, 0xCC, 0x4A, 0x26, 0x99, 0x21, 0x0E, 0xCF, 0xFF,
+    0x23, 0x7B, 0xE6, 0x4B, 0x93, 0x79, 0x71, 0xC0, 0x34, 0xF8, 0xBC, 0xEB, 0x3E, 0x47, 0x3B, 0x3B,
+    0x54, 0xC2, 0x8F, 0x07, 0x21, 0xB0, 0xEC, 0xDF, 0xEA, 0xCF, 0x03, 0xBE, 0xE1, 0x7F, 0xFA, 0xDA,
+    0xC6, 0xFE, 0xD7, 0x7E, 0xF2, 0x74, 0xA5, 0xA6, 0xCF, 0xB8, 0xA2, 0x6A, 0x03, 0xD5, 0x1A, 0x38,
+    0xDD, 0xA7, 0x70, 0x29, 0xA3, 0x86, 0x9C, 0xC0, 0x31, 0x47, 0xDF, 0x75, 0x6A, 0xEA, 0x52, 0xA5,
+    0x34, 0x5D, 0xE7, 0xDF, 0x01, 0xB0, 0x32, 0x3E, 0xEA, 0xCB, 0xF9, 0xC5, 0xE8, 0xFC, 0xE6, 0x8A,
+    0x81, 0xD9, 0x66, 0x4E, 0x98, 0x71, 0x4F, 0xA8, 0x4A, 0xD2, 0x50, 0xF2, 0x6E, 0xAA, 0xCE, 0x4F,
+    0xCB, 0xFB, 0x16, 0xBE, 0x06, 0xB1, 0x6A, 0x66, 0xF0, 0x5D, 0x60, 0x3C, 0x4B, 0x1D, 0xDA, 0xFF,
+    0x51, 0xC9, 0x5B, 0x9E, 0xA0, 0x01, 0xB3, 0x3C, 0xC0, 0xE8, 0xE9, 0x7C, 0xC2, 0x22, 0x76, 0xF4,
+    0xFB, 0x32, 0x5A, 0x6C, 0xC9, 0x07, 0x47, 0xD6, 0xDD, 0x11, 0xDF, 0xE7, 0x30, 0x5F, 0xC3, 0x63,
+    0xBF, 0x0D, 0x59, 0xEF, 0x55, 0xA9, 0x36, 0x38, 0xB3, 0xE8, 0xF7, 0x25, 0xF9, 0x1D, 0x43, 0x33,
+    0xA1, 0xB7, 0x0D, 0x21, 0x20, 0xF7, 0xD5, 0x30, 0xFF, 0x9A, 0xA9, 0x47, 0xF3, 0xF8, 0x29, 0xD0,
+    0x91, 0x7B, 0xB9, 0x8F, 0x37, 0xE6, 0x65, 0xD4, 0x32, 0xBE, 0x2A, 0x97, 0x8D, 0xEA, 0x40, 0x18,
+    0xB5, 0x72, 0x24, 0x85, 0xE0, 0xF3, 0xF1, 0x62, 0x75, 0xD4, 0x04, 0x8B, 0x33, 0x3B, 0x34, 0x7A,
+    0xE3, 0x48, 0xFE, 0x86, 0x62, 0xA6, 0xD1, 0x39, 0x18, 0xDA, 0xE4, 0x2B, 0x6A, 0x69, 0xC8, 0xD3,
+    0x36, 0x28, 0xFE, 0x34, 0x99, 0x16, 0xC7, 0x93, 0x38, 0x17, 0x99, 0x22, 0x89, 0x4D, 0x94, 0x83,
+    0x1E, 0x1F, 0x37, 0xB1, 0xB0, 0x0A, 0x61, 0x31, 0xCB, 0xA3, 0xC5, 0x7F, 0x77, 0x89, 0x86, 0x42,
+    0xE9, 0xEF, 0xD8, 0x76, 0xDB, 0xBC, 0x6F, 0x6C, 0xF3, 0xEF, 0x9B, 0x8D, 0x35, 0x8B, 0x4D, 0x36,
+    0x5F, 0xD1, 0x2E, 0x92, 0x34, 0xCF, 0x7F, 0xE8, 0xCF, 0xCC, 0x1F, 0xAF, 0x0D, 0x6C, 0x8D, 0x09,
+    0xD8, 0xF4, 0x49, 0x43, 0x18, 0xE0, 0xBD, 0xF7, 0x2A, 0x06, 0xDA, 0xFB, 0x32, 0x2A, 0x17, 0x5F,
+    0x02, 0x25, 0x30, 0xBF, 0x32, 0x26, 0x39, 0xC6, 0xDA, 0x9F, 0x30, 0x0F, 0xFF, 0x73, 0x5A, 0x57,
+    0x83, 0x51, 0xE7, 0xB5, 0xB3, 0xC2, 0x9E, 0xFD, 0x7D, 0xA8, 0x0D, 0xF4, 0x9D, 0x22, 0x9F, 0xF2,
+    0xEC, 0xDF, 0xE0, 0x21, 0x9F, 0xE0, 0xC7, 0x13, 0x4E, 0x97, 0x44, 0x02, 0xE3, 0x74, 0x94, 0x7F,
+    0x03, 0x8F, 0x30, 0xA5, 0x19, 0xCD, 0xBF, 0x20, 0x67, 0x5F, 0x30, 0xDF, 0x5C, 0xBB, 0xE9, 0xAF,
+    0x93, 0x3E, 0xF0, 0xAE, 0x6F, 0xAB, 0x1B, 0xAF, 0xF8, 0xB3, 0xE4, 0xCF, 0xF6, 0x3F, 0x66, 0xD4,
+    0xB3, 0x7D, 0x93, 0xBE, 0xAF, 0xA7, 0x7D, 0x9E, 0xA7, 0xA0, 0x3F, 0x0B, 0xF5, 0xBA, 0xB1, 0x8C,
+    0x1D, 0xB7, 0x08, 0xCF, 0xFD, 0x42, 0x31, 0x5D, 0x98, 0x7F, 0x2F, 0x8D, 0xB2, 0x40, 0x82, 0x2D,
+    0x6F, 0xEE, 0x1A, 0x55, 0x3D, 0xFF, 0xB5, 0x4C, 0xD6, 0xF2, 0x43, 0x2D, 0x40, 0x7E, 0xBE, 0xF9,
+    0x90, 0x8D, 0xF1, 0xDF, 0xF4, 0xE9, 0xB3, 0x6D, 0x93, 0xBA, 0x16, 0xEF, 0xBC, 0xCD, 0x0C, 0x83,
+    0xFD, 0xAF, 0x1D, 0x37, 0x91, 0x7F, 0xEC, 0xD6, 0xE6, 0x7B, 0x62, 0x3A, 0x4D, 0x58, 0x46, 0x66,
+    0xDC, 0xCB, 0x90, 0x99, 0xE6, 0xCB, 0x44, 0x85, 0xD9, 0x98, 0xF3, 0x65, 0xBE, 0x8D, 0x79, 0x60,
+    0xFE, 0xBC, 0x6F, 0xA1, 0x6F, 0xF4, 0x2D, 0xF4, 0x47, 0x8E, 0x81, 0xEE, 0x8B, 0xFD, 0x56, 0x7F,
+    0xF6, 0x67, 0x03, 0x91, 0x89, 0x0D, 0xF9, 0xB2, 0xD9, 0x78, 0x09, 0xCA, 0x7B, 0x24, 0x81, 0xA0,
+    0xF5, 0x91, 0x34, 0x67, 0x97, 0x8C, 0xA5, 0x0B, 0x23, 0x08, 0x75, 0x85, 0xEF, 0x7D, 0xC5, 0xB9,
+    0x9A, 0x23, 0x71, 0x40, 0x6E, 0xC8, 0x01, 0x13, 0x05, 0x8A, 0x22, 0x45, 0xB1, 0x22, 0x6A, 0xB2,
+    0x65, 0x99, 0xCD, 0x80, 0x26, 0x16, 0x79, 0x8F, 0xE6, 0xB3, 0x96, 0x48, 0x96, 0xB0, 0x9C, 0x12,
+    0x23, 0x51, 0x5A, 0x10, 0x59, 0x98, 0x4F, 0xED, 0x73, 0xB2, 0x5C, 0x0B, 0x7A, 0xDE, 0x32, 0x51,
+    0xD2, 0x77, 0x1B, 0xA2, 0xAD, 0x9A, 0x28, 0x2B, 0x89, 0xA0, 0x5E, 0x03, 0x12, 0x26, 0xFC, 0xD6,
+    0x39, 0x25, 0xD2, 0x35, 0x73, 0x2D, 0x59, 0xB8, 0x4F, 0x43, 0xB6, 0x50, 0xBD, 0x9B, 0x8E, 0xBE,
+    0xB8, 0x18, 0x7A, 0x9E, 0xA9, 0x35, 0xCC, 0x99, 0x93, 0x5C, 0x18, 0xA6, 0x8A, 0x30, 0x3E, 0x73,
+    0x8E, 0x6A, 0xF2, 0xD0, 0x12, 0x30, 0x34, 0x14, 0x6C, 0x7E, 0x4D, 0x85, 0xA0, 0x0D, 0x92, 0x69,
+    0x83, 0x6C, 0xFC, 0x7A, 0x7B, 0xFF, 0x7A, 0x96, 0x73, 0x32, 0xC2, 0x37, 0x82, 0x88, 0x49, 0x57,
+    0xD2, 0x7C, 0xA2, 0x68, 0xA6, 0x28, 0x54, 0x14, 0x7F, 0x44, 0x94, 0xFD, 0x5F, 0xA0, 0xB7, 0xED,
+    0x1B, 0x40, 0xEF, 0x5A, 0x30, 0x93, 0xE9, 0x9B, 0x2D, 0xD1, 0x7B, 0x0D, 0x91, 0x2D, 0x15, 0x15,
+    0x8A, 0x16, 0x53, 0xBB, 0x03, 0x4B, 0xCC, 0x14, 0x2B, 0x7A, 0xA7, 0x08, 0x91, 0x63, 0x3A, 0x10,
+    0x27, 0xDA, 0x59, 0x93, 0x66, 0x20, 0x28, 0xA8, 0x62, 0x92, 0x89, 0x3E, 0x38, 0x44, 0xB4, 0x59,
+    0x4E, 0x5D, 0x1E, 0x44, 0xF1, 0x7E, 0x15, 0x01, 0x6C, 0x31, 0x5B, 0x74, 0x08, 0xE6, 0x2B, 0x81,
+    0xBE, 0x3B, 0xDB, 0x1A, 0xD0, 0x43, 0x9D, 0x35, 0x83, 0x90, 0x27, 0xF6, 0x7B, 0x96, 0x0A, 0xB9,
+    0x16, 0xD1, 0xBE, 0x8C, 0x06, 0xB2, 0x2E, 0x24, 0x48, 0x56, 0x48, 0xE1, 0x36, 0xB2, 0x66, 0xA2,
+    0xF9, 0xD2, 0xAC, 0xEA, 0x85, 0x64, 0x18, 0x88, 0x4C, 0xB0, 0xE6, 0xB4, 0x40, 0x70, 0x0D, 0xC5,
+    0x7B, 0xA3, 0x47, 0x01, 0xCF, 0x85, 0xED, 0xF5, 0x4B, 0x0E, 0x04, 0x08, 0x00, 0x9B, 0x7A, 0x0F,
+    0xB1, 0x7A, 0xDA, 0x6D, 0xA6, 0x0D, 0xA3, 0x35, 0xBC, 0x83, 0x02, 0xFC, 0x1A, 0x36, 0xB3, 0xC6,
+    0x39, 0x3C, 0x58, 0xF0, 0x2F, 0xF6, 0xAE, 0x3C, 0xE3, 0x9F, 0x97, 0xCE, 0x12, 0xB5, 0x4F, 0x45,
+    0xB3, 0xA5, 0x11, 0x68, 0xCA, 0xFB, 0x81, 0x11, 0x14, 0xF0, 0x3B, 0x01, 0xD7, 0x3F, 0x42, 0x66,
+    0x07, 0xB8, 0x84, 0xEC, 0xAA, 0x85, 0xAF, 0x0F, 0x3E, 0x43, 0x75, 0x77, 0x9F, 0x05, 0xB7, 0x38,
+    0xA6, 0xFF, 0xE1, 0xFC, 0x01, 0x91, 0x6F, 0xF7, 0xF1, 0x1A, 0x1F, 0x7B, 0xAF, 0xF1, 0x02, 0xCE,
+    0xE1, 0xC5, 0x9A, 0xEB, 0xF8, 0x7F, 0x80, 0xD7, 0x38, 0x56, 0xA7, 0x32, 0x93, 0xEB, 0x9A, 0x58,
+    0xAD, 0xE9, 0x89, 0x16, 0xF0, 0x1E, 0x8A, 0x7A, 0x87, 0x1C, 0xDE, 0xC9, 0x14, 0xFE, 0x48, 0xFF,
+    0xF6, 0x41, 0x5E, 0xE3, 0x9C, 0xC2, 0x03, 0x3D, 0xB0, 0x07, 0x7D, 0x82, 0x9C, 0x21, 0x80, 0x91,
+    0xF3, 0xA8, 0x41, 0xF0, 0x1F, 0x13, 0x38, 0x92, 0x55, 0xAE, 0x1F, 0xA9, 0xEA, 0xFF, 0xF4, 0xD8,
+    0xDB, 0xD9, 0xFE, 0xB8, 0x3E, 0x5D, 0xFD, 0x00, 0x5C, 0x01, 0x9B, 0x9B, 0x67, 0x0F, 0x8D, 0x6B,
+    0xF7, 0x09, 0x04, 0xEA, 0x01, 0x90, 0x59, 0x72, 0xF6, 0xE1, 0xA2, 0xE3, 0x75, 0x5D, 0xB6, 0xDD,
+    0xE0, 0x68, 0x67, 0x9A, 0x25, 0x91, 0x07, 0x3C, 0xEB, 0x5D, 0x04, 0x14, 0x8F, 0x60, 0xF0, 0xDD,
+    0xFA, 0xE1, 0xC7, 0xDD, 0x0A, 0x38, 0x34, 0x7D, 0x12, 0xC1, 0x6B, 0xE7, 0x96, 0x39, 0x94, 0xD4,
+    0x34, 0xCD, 0x58, 0xAB, 0x02, 0xE6, 0x72, 0x04, 0x8F, 0x67, 0x30, 0x7A, 0x6B, 0x7E, 0xB6, 0xD6,
+    0x27, 0x95, 0x98, 0x74, 0x2A, 0x58, 0x39, 0xC0, 0x59, 0x36, 0x1B, 0xDA, 0x29, 0xBE, 0x80, 0xF8,
+    0x72, 0xB2, 0xA7, 0x21, 0x26, 0x10, 0x1D, 0x5D, 0x34, 0xFA, 0xFE, 0xE4, 0xD2, 0x13, 0xAF, 0x5C,
+    0x05, 0xC5, 0xBE, 0x61, 0x78, 0xEB, 0xAC, 0xE9, 0xFD, 0x7D, 0x8A, 0xA1, 0x03, 0x6C, 0x11, 0xF6,
+    0x0E, 0xB0, 0xEA, 0x02, 0xB3, 0x1A, 0x75, 0xE1, 0x83, 0x61, 0x95, 0x6A, 0xFF, 0xE7, 0xD0, 0xBA,
+    0xE0, 0xDC, 0xD4, 0xD2, 0x1E, 0x59, 0xAA, 0x3A, 0xC6, 0x13, 0x7E, 0x06, 0x65, 0x83, 0x41, 0x8F,
+    0x9C, 0x64, 0xC5, 0x2C, 0x7E, 0xB9, 0x2E, 0x75, 0x28, 0x05, 0x62, 0xB5, 0xDA, 0x9F, 0x60, 0x53,
+    0xE5, 0x2B, 0xC6, 0x25, 0x34, 0xFB, 0x8C, 0x02, 0x8C, 0x34, 0xD5, 0xE1, 0x4C, 0x64, 0x0A, 0x3E,
+    0x7B, 0x62, 0xA3, 0x3F, 0xB0, 0xF4, 0x91, 0xBD, 0xF6, 0xA1, 0xF5, 0xCE, 0x69, 0x4A, 0x64, 0xED,
+    0xED, 0x7B, 0x9D, 0x2E, 0x26, 0x5B, 0x1F, 0xF2, 0x9A, 0x69, 0xE7, 0xEE, 0x0A, 0xE4, 0xF6, 0x4C,
+    0x3D, 0x4D, 0x23, 0xEA, 0xF3, 0xA0, 0xC0, 0xA6, 0xEA, 0x9D, 0x0F, 0x45, 0xE3, 0x42, 0xD6, 0xC4,
+    0x80, 0x4C, 0xE4, 0x1F, 0x54, 0xCC, 0xC2, 0xD7, 0x49, 0xAA, 0x9A, 0x59, 0x58, 0xF2, 0x51, 0x79,
+    0x5B, 0x64, 0xFA, 0x3A, 0x7D, 0x50, 0x73, 0xFC, 0xC9, 0x4E, 0xD0, 0x9F, 0x91, 0x93, 0xB3, 0x22,
+    0xF5, 0x83, 0x83, 0x59, 0xC2, 0x6A, 0xED, 0x82, 0x66, 0x59, 0x5D, 0x5F, 0xFF, 0x29, 0xDE, 0x7E,
+    0x8E, 0x85, 0x70, 0x4B, 0x5F, 0xDE, 0xB9, 0x8D, 0x8C, 0xED, 0xB5, 0x8F, 0x34, 0xBB, 0x50, 0xF4,
+    0x01, 0x23, 0x04, 0x5A, 0x79, 0x71, 0xA8, 0x92, 0x6B, 0xBD, 0x3F, 0x2B, 0xF9, 0xB6, 0x2C, 0x7F,
+    0x06, 0x47, 0x69, 0xBE, 0xAB, 0x0D, 0x3A, 0x3E, 0x1F, 0x66, 0x58, 0xD8, 0x72, 0xAD, 0xE7, 0xAF,
+    0x1F, 0x0E, 0x8F, 0xAE, 0x7C, 0xB6, 0x39, 0x90, 0x36, 0xAA, 0x5E, 0xF3, 0x13, 0x7B, 0xFD, 0xC5,
+    0xF1, 0x2C, 0x71, 0xF9, 0x3A, 0x28, 0x26, 0x7E, 0x11, 0x1A, 0x8B, 0x4F, 0x33, 0x6C, 0x2F, 0x74,
+    0x5C, 0xEE, 0xB8, 0x56, 0x05, 0xC9, 0x57, 0x1B, 0xB5, 0x2C, 0x42, 0x54, 0x3B, 0xC3, 0x25, 0x08,
+    0xA1, 0x51, 0x0B, 0xC6, 0x0C, 0xF6, 0xB9, 0x24, 0x13, 0xDA, 0x85, 0x8D, 0x71, 0x59, 0xDA, 0x16,
+    0xAA, 0xAD, 0xA7, 0x76, 0xF7, 0x75, 0x32, 0xF8, 0x6F, 0x70, 0x16, 0xBC, 0xA5, 0x89, 0x1F, 0xE9,
+    0xA7, 0x72, 0x9B, 0xE7, 0x6F, 0xD1, 0x4B, 0xE5, 0x3A, 0x6D, 0xC4, 0xAF, 0x69, 0xD8, 0x71, 0xA6,
+    0x9A, 0x7E, 0x1A, 0x94, 0x43, 0xFA, 0x35, 0xCC, 0x64, 0xEC, 0xD2, 0x46, 0x58, 0xD0, 0xF4, 0x53,
+    0xD0, 0x81, 0xA5, 0x60, 0x5A, 0xA5, 0x62, 0x19, 0x5D, 0x7F, 0x14, 0x08, 0x85, 0xBD, 0xCD, 0xE1,
+    0x8B, 0x32, 0xCF, 0x72, 0xA9, 0x30, 0x3D, 0x54, 0x18, 0x2E, 0x95, 0xE5, 0x08, 0x82, 0x7D, 0x17,
+    0x09, 0x83, 0x7E, 0xD3, 0xB9, 0xF0, 0x93, 0x0C, 0xB1, 0x94, 0xFA, 0xD9, 0xDB, 0xF8, 0x16, 0x69,
+    0x2D, 0xB2, 0x3C, 0xC6, 0x1D, 0x01, 0xFC, 0x63, 0x26, 0xB6, 0x83, 0x43, 0x4B, 0x07, 0x07, 0x53,
+    0xFA, 0x24, 0xDE, 0x17, 0x8C, 0xAF, 0xC8, 0xF4, 0x80, 0xBA, 0x91, 0xC1, 0x2B, 0x71, 0x79, 0x99,
+    0x0A, 0x99, 0x12, 0xFC, 0x66, 0xF9, 0x11, 0xB5, 0xCF, 0xE4, 0x36, 0x4B, 0x72, 0x99, 0xCA, 0x64,
+    0xEA, 0x48, 0xFF, 0x03, 0x55, 0xE3, 0x1F, 0xEA, 0xC2, 0x41, 0x05, 0x9F, 0xE6, 0x9C, 0xFA, 0x90,
+    0x8E, 0x07, 0x7F, 0x60, 0xC8, 0x4C, 0x49, 0x67, 0x66, 0x7F, 0x2F, 0xD8, 0xD5, 0xF2, 0x1E, 0x6C,
+    0xC4, 0xE5, 0x07, 0x4C, 0xF7, 0x84, 0x82, 0xA0, 0xB3, 0xAE, 0xFA, 0xA7, 0x3B, 0xE5, 0x80, 0x6F,
+    0x91, 0x77, 0xFE, 0x4E, 0x5A, 0xE4, 0x5D, 0x79, 0x73, 0x79, 0xDD, 0x06, 0xA0, 0x04, 0xB8, 0x5F,
+    0x8B, 0xBC, 0x0B, 0x12, 0xEF, 0xAE, 0xC3, 0x1D, 0xB7, 0x71, 0xAF, 0x7C, 0x93, 0xBD, 0xFD, 0x1D,
+    0xB4, 0xB0, 0xEA, 0x50, 0xFA, 0x6C, 0x2D, 0x5B, 0xDD, 0xE5, 0x00, 0x11, 0xC4, 0x98, 0xAB, 0x99,
+    0x26, 0xC7, 0xB3, 0x78, 0xF5, 0xAD, 0xEE, 0x6F, 0x99, 0xB8, 0x53, 0xD3, 0xB2, 0x82, 0x44, 0x06,
+    0xED, 0x16, 0x95, 0xDD, 0x78, 0xA1, 0xC0, 0x6A, 0x64, 0x10, 0xCF, 0xBB, 0xAC, 0xE1, 0x35, 0xD0,
+    0x11, 0xC3, 0x42, 0x6B, 0x34, 0xB7, 0x19, 0xD4, 0x34, 0x05, 0x95, 0x36, 0xCC, 0x5B, 0xA6, 0x69,
+    0xCC, 0x34, 0xAB, 0xD9, 0x8C, 0x31, 0x25, 0x9A, 0xF3, 0x4C, 0x2E, 0xD2, 0xAC, 0xBF, 0xC3, 0xD4,
+    0x0A, 0xC2, 0x17, 0xAA, 0x73, 0x42, 0x0F, 0x7F, 0x60, 0x77, 0x86, 0xD7, 0x04, 0x74, 0x49, 0x8E,
+    0xA8, 0xCA, 0x44, 0xD6, 0x34, 0x84, 0x30, 0x69, 0x50, 0xBA, 0x40, 0xD4, 0x56, 0xE8, 0x70, 0x0D,
+    0x98, 0x52, 0x29, 0x41, 0xBD, 0x65, 0x87, 0x01, 0xCC, 0x90, 0xF3, 0xFE, 0x9A, 0x29, 0xAF, 0x1F,
+    0xEB, 0x8A, 0x67, 0xA9, 0x2A, 0xD5, 0x88, 0x74, 0x2D, 0x9F, 0x7E, 0xC1, 0xD4, 0x9B, 0x32, 0xAE,
+    0xAB, 0x25, 0x82, 0x9A, 0xD0, 0xD2, 0x40, 0xB0, 0x99, 0x32, 0x14, 0x45, 0xC3, 0x39, 0x81, 0x74,
+    0xB1, 0xAC, 0xA8, 0x1A, 0x62, 0x74, 0x38, 0x03, 0x83, 0x41, 0x51, 0xA2, 0x8F, 0xB8, 0x3A, 0x44,
+    0xAA, 0x59, 0x8E, 0xEE, 0x29, 0xFA, 0x17, 0xFD, 0xAE, 0x72, 0x5E, 0xAC, 0x5C, 0x25, 0xA2, 0x4A,
+    0x53, 0x11, 0xA8, 0xEE, 0x19, 0x45, 0xCF, 0x0D, 0x63, 0x5E, 0x72, 0x52, 0x0E, 0x7A, 0x89, 0x57,
+    0xD4, 0x5F, 0x09, 0x42, 0x9B, 0x43, 0xB1, 0xEB, 0x17, 0x3F, 0xD6, 0xAF, 0xA4, 0x56, 0x79, 0x21,
+    0x50, 0xE8, 0xDF, 0xCE, 0x35, 0x18, 0x8C, 0x44, 0x0A, 0x20, 0x65, 0xA9, 0x68, 0xC4, 0xD5, 0x0C,
+    0x32, 0x6A, 0x95, 0xD3, 0x34, 0x3A, 0xAC, 0x8F, 0xFB, 0x9C, 0xF5, 0x0E, 0xF8, 0x12, 0x81, 0xBB,
+    0x17, 0xCD, 0x1A, 0x90, 0xD5, 0x0D, 0x2A, 0xDA, 0xDB, 0xA0, 0x91, 0x54, 0xE3, 0x1A, 0xBD, 0x9F,
+    0xBA, 0x8F, 0x83, 0x6E, 0x6C, 0x5E, 0xD0, 0xEC, 0x65, 0x76, 0x3F, 0x42, 0x5E, 0xAC, 0xA3, 0x17,
+    0xB6, 0xA9, 0x2E, 0x58, 0x60, 0xDC, 0x0F, 0x40, 0xBA, 0x6E, 0x1C, 0x15, 0xF5, 0x2A, 0x69, 0x72,
+    0xE4, 0x47, 0x83, 0xBD, 0x33, 0x4A, 0x0F, 0xF7, 0x76, 0xEC, 0x61, 0xD7, 0xEF, 0x5D, 0x66, 0xA4,
+    0x4D, 0x39, 0x84, 0x47, 0x35, 0xF0, 0x9F, 0xBA, 0xAC, 0x76, 0x92, 0xB9, 0xBE, 0xDA, 0x62, 0x3F,
+    0xEA, 0x36, 0x93, 0xC7, 0xD4, 0xE8, 0xF7, 0x47, 0xCB, 0x36, 0xB4, 0xED, 0x3A, 0xDC, 0x7B, 0xF9,
+    0x93, 0xB6, 0xE1, 0x41, 0xD0, 0x99, 0x29, 0xCC, 0x7D, 0x4F, 0x6E, 0x6C, 0xBA, 0xEC, 0x8D, 0x0B,
+    0x27, 0x81, 0x1C, 0xF5, 0xA4, 0xDA, 0x74, 0x27, 0x0C, 0xBC, 0xD4, 0x13, 0xCD, 0xA0, 0x11, 0xFB,
+    0x94, 0x1A, 0xB1, 0xCB, 0xB1, 0x61, 0xE2, 0xBB, 0xCF, 0xA8, 0xB1, 0x32, 0x06, 0xE3, 0xE6, 0x4E,
+    0xA6, 0x1C, 0x8F, 0x4C, 0x21, 0x30, 0xD7, 0x93, 0x91, 0x3F, 0xD1, 0x9C, 0x27, 0x07, 0x9E, 0xF4,
+    0x61, 0x87, 0x63, 0x7F, 0x32, 0xF1, 0xE3, 0xD3, 0x2D, 0x13, 0xE3, 0x24, 0xF5, 0xCA, 0x28, 0xC7,
+    0x92, 0x4E, 0x75, 0x1D, 0x37, 0xBD, 0x13, 0xA9, 0xDC, 0xD3, 0xAD, 0x68, 0x28, 0xFB, 0x20, 0xE9,
+    0xF9, 0x3E, 0x24, 0x8D, 0x3E, 0x57, 0x9F, 0xF9, 0x03, 0xD1, 0x0D, 0x45, 0xE4, 0xEC, 0x99, 0xD9,
+    0x82, 0x48, 0xB9, 0x76, 0x68, 0x60, 0x05, 0xFD, 0x58, 0x23, 0xB0, 0xE0, 0x33, 0x0F, 0x24, 0x64,
+    0xB0, 0x60, 0xFE, 0xAF, 0x55, 0xA4, 0x3A, 0x89, 0xCA, 0x0C, 0x9C, 0x57, 0xD8, 0x33, 0x22, 0x66,
+    0x14, 0x2A, 0x3D, 0xB9, 0x54, 0xA7, 0x09, 0x51, 0xEB, 0xF5, 0xE5, 0xEB, 0x86, 0x78, 0x92, 0x4A,
+    0xAB, 0xDC, 0x4B, 0x63, 0xD4, 0xA0, 0x06, 0xF5, 0xD4, 0x09, 0x36, 0xD0, 0xE8, 0x2C, 0x57, 0x1E,
+    0x61, 0x3D, 0x21, 0xED, 0xE7, 0x88, 0x13, 0xC4, 0x12, 0x27, 0xCC, 0x7A, 0x0D, 0x3B, 0xF0, 0xAC,
+    0x81, 0x6B, 0xD1, 0x74, 0x0D, 0x4E, 0x01, 0xAB, 0x69, 0x23, 0xFC, 0x7F, 0x33, 0x69, 0x83, 0x3A,
+    0x6C, 0xC7, 0x56, 0x48, 0xBB, 0x1D, 0xD9, 0x4C, 0x18, 0xE5, 0x22, 0x53, 0x57, 0x61, 0xE7, 0x60,
+    0x7C, 0x95, 0x9E, 0x59, 0xCE, 0xC9, 0x06, 0xED, 0x1B, 0x69, 0xB7, 0x9C, 0x33, 0xA3, 0x97, 0xD8,
+    0xC8, 0x89, 0x66, 0xDF, 0x9D, 0x91, 0x83, 0xB3, 0xFF, 0x11, 0xFC, 0x31, 0xCD, 0xD4, 0x01, 0x9A,
+    0x29, 0x46, 0x60, 0x47, 0x7C, 0xBB, 0x11, 0x59, 0xFF, 0x12, 0xC0, 0x5F, 0xB4, 0x00, 0x4D, 0x5A,
+    0xCA, 0xBF, 0x71, 0x19, 0xBF, 0x29, 0x35, 0x88, 0xAC, 0x3C, 0xDA, 0xC5, 0x6E, 0xDC, 0x60, 0x46,
+    0x16, 0x3C, 0x51, 0x0A, 0x3B, 0x3B, 0x70, 0xDC, 0x77, 0x09, 0xE8, 0x02, 0x17, 0x28, 0x38, 0x48,
+    0x57, 0x0F, 0xCE, 0xF6, 0x44, 0x70, 0x58, 0x02, 0xBA, 0xF8, 0xA0, 0xDC, 0x73, 0xB5, 0xBF, 0xD8,
+    0x25, 0xA0, 0xD3, 0xFC, 0x99, 0xA3, 0x7D, 0x09, 0xE8, 0x36, 0xD4, 0xEA, 0x9B, 0x7B, 0x1D, 0xEB,
+    0xA4, 0xF2, 0xD1, 0x1F, 0xCF, 0xD6, 0x3E, 0x79, 0x1B, 0xA7, 0xDD, 0x45, 0x64, 0x73, 0xFE, 0x3E,
+    0xDD, 0xE9, 0x7C, 0x74, 0x55, 0x60, 0x77, 0xCA, 0x08, 0xC6, 0x89, 0xCA, 0x45, 0x58, 0x95, 0x6B,
+    0x86, 0x89, 0xA5, 0x71, 0xE2, 0x8F, 0x03, 0xE1, 0x48, 0x67, 0x6A, 0x31, 0x6D, 0xC8, 0x58, 0x82,
+    0x01, 0x26, 0xEF, 0x1D, 0x2B, 0xE7, 0x0D, 0xC6, 0x1B, 0xD5, 0xC4, 0x6B, 0x0A, 0xD7, 0xBD, 0x96,
+    0x0A, 0xEF, 0x11, 0xE4, 0xC3, 0xDB, 0x4C, 0x06, 0xA2, 0xF2, 0x12, 0x1C, 0x29, 0x0B, 0x92, 0xF3,
+    0x48, 0x5D, 0x82, 0x33, 0x47, 0x56, 0x7A, 0xAD, 0xEB, 0xC0, 0x76, 0x38, 0xC5, 0x87, 0x40, 0xE3,
+    0x5F, 0x0E, 0x05, 0x66, 0x07, 0x5C, 0x8B, 0x5A, 0x44, 0xD5, 0x27, 0xC0, 0x25, 0x99, 0x65, 0x24,
+    0x8A, 0x26, 0x85, 0x4B, 0x95, 0x42, 0xE5, 0x9E, 0xED, 0xCF, 0x7E, 0x47, 0xCB, 0x19, 0x45, 0x3D,
+    0x55, 0x0A, 0x07, 0xCE, 0x28, 0xA0, 0xFE, 0xD6, 0x0C, 0x9D, 0x3B, 0xC0, 0xB9, 0xFF, 0xC8, 0x50,
+    0xFD, 0x1C, 0xA2, 0xC6, 0xBB, 0xC0, 0xA4, 0x18, 0x18, 0x59, 0xC1, 0x98, 0xF2, 0xA0, 0x45, 0xCE,
+    0x20, 0xCB, 0x30, 0xAD, 0x09, 0x26, 0xD9, 0xF3, 0xB0, 0xCA, 0x21, 0xD1, 0x0A, 0x25, 0x16, 0xB8,
+    0xB1, 0xA8, 0xC2, 0x37, 0x52, 0xE3, 0x59, 0xEE, 0x1C, 0x77, 0x66, 0x5E, 0x53, 0x70, 0xD4, 0x4E,
+    0x7D, 0x74, 0xCD, 0x32, 0xDE, 0xB1, 0xBB, 0x97, 0x07, 0xC9, 0xBD, 0x3C, 0xD4, 0xCF, 0x3F, 0xA3,
+    0x66, 0xE1, 0x56, 0x1E, 0x4B, 0xB0, 0x71, 0xD5, 0xEE, 0xCE, 0x0F, 0x6A, 0x16, 0x4D, 0x4B, 0x68,
+    0x34, 0x2F, 0xA1, 0xD1, 0xC4, 0x84, 0x2E, 0x33, 0xA1, 0x4F, 0x4D, 0xE8, 0xC3, 0x1B, 0x34, 0x39,
+    0xA1, 0xCB, 0x4E, 0xE8, 0xD2, 0x13, 0xBA, 0xFC, 0x84, 0xCE, 0xDD, 0xCB, 0x67, 0x74, 0xD7, 0x14,
+    0x85, 0xFE, 0xC3, 0xC0, 0x71, 0xC4, 0x0C, 0xBF, 0x77, 0x69, 0x0A, 0x35, 0x4F, 0xA1, 0x4B, 0x54,
+    0xC8, 0x4C, 0x85, 0xED, 0xA6, 0x7A, 0x28, 0xB8, 0x5C, 0x85, 0xB4, 0xF1, 0x8F, 0x2C, 0x7D, 0x76,
+    0x7D, 0x60, 0xC2, 0xE4, 0xC8, 0xA8, 0x0F, 0x1A, 0x88, 0x35, 0xD1, 0x72, 0x0B, 0xA6, 0x7A, 0x66,
+    0x35, 0x0D, 0xF3, 0x25, 0xA9, 0xC7, 0xC8, 0xBE, 0x69, 0x7B, 0x95, 0x3F, 0x43, 0x52, 0xA5, 0x11,
+    0x35, 0xA3, 0xB3, 0xFA, 0x86, 0x91, 0x5D, 0xE7, 0x2A, 0x9B, 0xEA, 0xDA, 0xF3, 0x1B, 0x36, 0x08,
+    0xA4, 0x65, 0x74, 0x0B, 0x53, 0xF7, 0x58, 0x3A, 0xCF, 0xA4, 0x4C, 0xEB, 0xA3, 0xDE, 0x02, 0xE6,
+    0x28, 0xF0, 0x62, 0xA2, 0x9E, 0x8F, 0xCA, 0x06, 0x55, 0xD9, 0x7E, 0x7C, 0xF2, 0xBC, 0xDD, 0x3C,
+    0x2B, 0x98, 0x64, 0xE0, 0xB1, 0xE3, 0x5B, 0x67, 0xD5, 0xF5, 0x16, 0x62, 0xD1, 0x21, 0xD8, 0x2C,
+    0x23, 0xF9, 0x1F, 0x1E, 0x53, 0xE7, 0x9A, 0xE5, 0x6B, 0xE8, 0x4C, 0xB6, 0xF7, 0x52, 0x46, 0x71,
+    0xDA, 0x7C, 0x1A, 0x48, 0xB8, 0x9C, 0xBD, 0xCB, 0xC6, 0x79, 0xD0, 0xAF, 0xA2, 0x01, 0x43, 0x72,
+    0x04, 0x74, 0x6A, 0x3B, 0x2E, 0x38, 0x9E, 0x34, 0xF1, 0xDA, 0x27, 0x46, 0x8D, 0xD9, 0xA2, 0x03,
+    0x39, 0xF9, 0x8B, 0x50, 0x91, 0x26, 0xDC, 0xC7, 0x70, 0xFC, 0x3B, 0xEE, 0x8B, 0x90, 0x38, 0x16,
+    0x70, 0x1D, 0xBD, 0xA8, 0xCE, 0x78, 0x4E, 0x65, 0x79, 0x00, 0xEA, 0xCD, 0x60, 0x47, 0x47, 0x74,
+    0xB9, 0xCB, 0x8F, 0x0A, 0x61, 0x58, 0xA9, 0xCE, 0xF7, 0x1C, 0x7C, 0x44, 0x38, 0x63, 0x07, 0x9A,
+    0x4D, 0xB6, 0xBC, 0xF1, 0x70, 0x77, 0x9B, 0x13, 0xAC, 0x58, 0x83, 0x8C, 0xEE, 0x7E, 0x10, 0x3C,
+    0xB5, 0x9D, 0x3D, 0x20, 0x47, 0xF2, 0x97, 0x01, 0x7E, 0xE4, 0x41, 0x0E, 0x50, 0x00, 0x54, 0x3F,
+    0xDA, 0xC2, 0x46, 0x38, 0xB6, 0x43, 0x0B, 0x77, 0x81, 0x26, 0x45, 0xB4, 0xCF, 0xCB, 0xB8, 0x7E,
+    0x15, 0x83, 0xFB, 0x47, 0x07, 0x80, 0x2F, 0xAF, 0x2D, 0xBB, 0x9A, 0x16, 0xBF, 0xDE, 0x07, 0x4E,
+    0x00, 0xBC, 0xB2, 0x04, 0x71, 0x1D, 0xB7, 0x32, 0x76, 0xD1, 0x06, 0x35, 0x3D, 0xD2, 0xC6, 0xB6,
+    0xDB, 0xAA, 0xCD, 0x49, 0x3A, 0x7C, 0xBE, 0xB2, 0x0A, 0x8C, 0x03, 0xAA, 0xA5, 0x8D, 0x1F, 0xC2,
+    0xEB, 0x63, 0x8B, 0x76, 0x57, 0x67, 0xB4, 0x70, 0xF9, 0x0F, 0xE1, 0x14, 0xF5, 0x42, 0xE8, 0x3C,
+    0xE3, 0x92, 0x1E, 0x8E, 0x1F, 0x1E, 0x9E, 0x4C, 0x7C, 0x87, 0xDD, 0x07, 0x7C, 0x9D, 0x2A, 0xA7,
+    0xDA, 0x64, 0xEF, 0xA9, 0xA2, 0x13, 0x21, 0xF2, 0x3F, 0xB7, 0x8B, 0x0C, 0x09, 0x91, 0xB2, 0x52,
+    0x49, 0x39, 0x7D, 0x5D, 0x33, 0x07, 0xF2, 0x87, 0x00, 0x03, 0x0E, 0x37, 0x52, 0xB7, 0xC2, 0xB1,
+    0x4E, 0x06, 0x7A, 0xF9, 0x15, 0x8E, 0x9B, 0xA2, 0xDA, 0xB2, 0xA5, 0x32, 0x14, 0x44, 0x5C, 0x56,
+    0x8A, 0xF4, 0x29, 0xB5, 0x62, 0x66, 0x4F, 0xD1, 0xED, 0x37, 0xB1, 0x4F, 0x5B, 0xCD, 0x8D, 0xF9,
+    0xBE, 0xDD, 0xDC, 0x7C, 0xC6, 0xE5, 0x9E, 0xF3, 0x01, 0x72, 0x82, 0x23, 0x87, 0x37, 0xAE, 0xD9,
+    0x1D, 0x3A, 0x35, 0x79, 0xE6, 0xDA, 0x5B, 0x87, 0x27, 0x3D, 0x9E, 0x3B, 0x27, 0x07, 0x79, 0xF8,
+    0x37, 0xF4, 0xB9, 0x1B, 0x9D, 0xAB, 0x47, 0xE7, 0xEA, 0xD5, 0xB9, 0x7A, 0xD6, 0xCE, 0x43, 0x38,
+    0x19, 0x9A, 0xD2, 0xBF, 0xB7, 0x94, 0x68, 0x62, 0x1F, 0x79, 0x03, 0x1A, 0x92, 0xCB, 0x0A, 0x7F,
+    0x1D, 0xAE, 0xD5, 0xF1, 0xF3, 0xE0, 0x3E, 0x62, 0x59, 0x52, 0x66, 0x9A, 0xA9, 0x95, 0x39, 0x6A,
+    0x2D, 0x8D, 0x99, 0xB6, 0xF1, 0xBB, 0xDE, 0x74, 0xCB, 0xDA, 0xA1, 0x4E, 0xDF, 0x94, 0x1A, 0xDD,
+    0x3D, 0xDF, 0xFB, 0x11, 0xA9, 0x5B, 0xB2, 0x73, 0xC0, 0x3F, 0xBE, 0xE2, 0xA3, 0xF6, 0x79, 0x6F,
+    0xC7, 0x51, 0x7F, 0x67, 0xF2, 0x50, 0xF8, 0xF1, 0xB7, 0xBB, 0xFA, 0x1E, 0xDC, 0x1F, 0x9E, 0x41,
+    0x26, 0xCA, 0x1A, 0x01, 0xA8, 0xB6, 0xD9, 0xE2, 0x76, 0x01, 0x0F, 0xF5, 0x27, 0xE2, 0x90, 0xDE,
+    0x3B, 0x48, 0x0D, 0x44, 0xD3, 0xD5, 0xD8, 0x29, 0x05, 0x5A, 0xEF, 0x1A, 0x60, 0xAF, 0x35, 0x5E,
+    0x45, 0x58, 0xFA, 0x81, 0x30, 0x3F, 0xD0, 0x1F, 0xE5, 0xFF, 0xDF, 0x5D, 0x33, 0x76, 0x92, 0x8B,
+    0x8E, 0xD3, 0x52, 0xC7, 0xAE, 0xEC, 0x6D, 0x1D, 0x1B, 0xB1, 0x63, 0x21, 0x03, 0xB7, 0xE5, 0xD0,
+    0xE8, 0x00, 0x27, 0x8F, 0x27, 0x2F, 0x27, 0x24, 0x8D, 0xB8, 0xAA, 0x9C, 0xF2, 0x8B, 0xAF, 0x8B,
+    0xCF, 0x9E, 0xD9, 0x43, 0x0C, 0x3E, 0x78, 0xC8, 0x1B, 0xDD, 0xC0, 0xE0, 0xB3, 0x97, 0x0C, 0x23,
+    0xAA, 0x35, 0x7C, 0x47, 0x4A, 0xBB, 0xF5, 0x8C, 0x6A, 0xB2, 0xA2, 0x4E, 0x35, 0xAB, 0x86, 0x22,
+    0x6E, 0xC2, 0xCA, 0xCD, 0xE9, 0x70, 0x7E, 0x00, 0xEC, 0x75, 0xA8, 0x3A, 0xC7, 0x21, 0x91, 0x6F,
+    0x20, 0xEB, 0xAD, 0xD3, 0x4C, 0x4D, 0xD9, 0xBD, 0x4E, 0x15, 0xEF, 0xFC, 0x87, 0x93, 0x81, 0x47,
+    0x68, 0x01, 0xF3, 0xEF, 0xC2, 0x65, 0x7A, 0x60, 0xCA, 0x1E, 0x04, 0xFA, 0x31, 0x41, 0xC4, 0x3F,
+    0xD9, 0xDE, 0xD2, 0x2B, 0x13, 0xCB, 0xDB, 0xE2, 0x6C, 0x92, 0x76, 0xD7, 0x54, 0xE7, 0x44, 0x7F,
+    0x89, 0x3E, 0x79, 0x20, 0x54, 0x4E, 0x26, 0x54, 0xE0, 0x39, 0x4B, 0x9F, 0x6F, 0xFF, 0xF8, 0x98,
+    0x2C, 0x89, 0x6A, 0x4C, 0x1D, 0x3D, 0x58, 0xEA, 0x95, 0x34, 0x2E, 0xD3, 0x49, 0x68, 0x1E, 0xB9,
+    0x0D, 0x0F, 0x83, 0x96, 0x06, 0x3A, 0x37, 0xFE, 0x83, 0x7A, 0x88, 0xC2, 0x6A, 0x88, 0xD4, 0xEA,
+    0xEC, 0xDC, 0x7B, 0xD7, 0x10, 0xEB, 0xA8, 0x2E, 0x43, 0x8C, 0xC6, 0x76, 0x93, 0x69, 0x80, 0x18,
+    0xEF, 0x70, 0xE7, 0x1C, 0x37, 0x8F, 0xC3, 0x96, 0x7D, 0x8A, 0x34, 0x37, 0x4E, 0xC6, 0xC4, 0x38,
+    0xD5, 0xF1, 0x81, 0x43, 0xCF, 0x32, 0xD5, 0xE5, 0x92, 0xBB, 0x3A, 0xD0, 0xCF, 0xA9, 0x8F, 0xC5,
+    0x5E, 0x81, 0xBB, 0x20, 0x0B, 0x71, 0x1E, 0x30, 0xBC, 0x77, 0x09, 0x33, 0xB5, 0xCC, 0x28, 0x9C,
+    0xF7, 0x90, 0x89, 0xEF, 0xC1, 0xEF, 0x62, 0xF8, 0x13, 0x32, 0xD3, 0xEF, 0x15, 0x46, 0x1D, 0x74,
+    0x4C, 0x7D, 0xD7, 0xC2, 0xE6, 0x63, 0x9B, 0xE3, 0xBD, 0x1F, 0xD2, 0xAC, 0x5E, 0x7A, 0x21, 0x85,
+    0x03, 0x5D, 0xB6, 0x32, 0x3B, 0x67, 0xE6, 0x0F, 0xB7, 0x81, 0x16, 0xF4, 0xD7, 0x87, 0x6C, 0xA2,
+    0x71, 0xE4, 0xFD, 0xB4, 0x74, 0xC3, 0x08, 0xEF, 0xDB, 0x40, 0x4F, 0x41, 0x99, 0x5B, 0x5F, 0x1F,
+    0xA9, 0x62, 0x0B, 0x0E, 0xB0, 0xB4, 0x60, 0x5A, 0xC3, 0xFD, 0x14, 0x87, 0xF9, 0x52, 0x9D, 0x8F,
+    0xCE, 0x7D, 0x80, 0xCF, 0xF1, 0xE2, 0x00, 0x74, 0xD8, 0x47, 0xB8, 0xCD, 0xF7, 0x1C, 0xA6, 0x29,
+    0xB4, 0x06, 0xFF, 0x6E, 0xAA, 0xFA, 0xE4, 0x44, 0xED, 0x8A, 0x14, 0x41, 0x43, 0x4F, 0xAE, 0x9F,
+    0x20, 0xBB, 0x8B, 0x33, 0xB1, 0xCC, 0x57, 0x0C, 0x2E, 0xC6, 0x4F, 0xAE, 0x3E, 0xB7, 0x96, 0xF7,
+    0x4F, 0x9B, 0xAD, 0xE4, 0x20, 0x74, 0xAE, 0xD7, 0x2E, 0x2A, 0x26, 0x2D, 0xCD, 0x63, 0xB7, 0xBB,
+    0xA8, 0x4C, 0xA1, 0xAB, 0xF1, 0xC2, 0xF8, 0xA0, 0x56, 0xE7, 0xF5, 0xEB, 0x3C, 0x3E, 0xB8, 0x1E,
+    0xEC, 0x98, 0xEC, 0xA1, 0x36, 0x69, 0xC9, 0x01, 0x0A, 0x80, 0x6A, 0x94, 0x75, 0xE9, 0xAA, 0xC4,
+    0x21, 0x82, 0xC0, 0xD3, 0x9D, 0x19, 0xAD, 0xE9, 0xF3, 0x46, 0xC8, 0x32, 0x4F, 0x2D, 0xF1, 0x3A,
+    0xE8, 0x53, 0x65, 0x1D, 0x0A, 0xBC, 0x9C, 0xF6, 0x40, 0x20, 0x2B, 0x0C, 0xE4, 0x33, 0x36, 0x16,
+    0xA5, 0x33, 0x15, 0xCE, 0x36, 0x97, 0x43, 0xF0, 0xA2, 0xEE, 0x8F, 0xB1, 0x0A, 0x96, 0xF1, 0xBE,
+    0x07, 0x00, 0xB8, 0x1E, 0xE8, 0x7E, 0x3D, 0xC6, 0x6D, 0xD8, 0x63, 0xDC, 0x8E, 0x3D, 0xC6, 0x6D,
+    0xD9, 0x63, 0xDC, 0x9E, 0x3D, 0xC6, 0x7A, 0x2F, 0x51, 0xDD, 0xB5, 0xC7, 0xB8, 0x6D, 0x7B, 0x8C,
+    0xDB, 0xB7, 0xC7, 0xB8, 0x8D, 0x7B, 0x8C, 0xDB, 0xB9, 0xC7, 0x70, 0xEB, 0x1E, 0x60, 0xDD, 0xBB,
+    0xC7, 0xB8, 0xCD, 0x7B, 0x8C, 0xDB, 0xBD, 0xC7, 0xB8, 0xED, 0x7B, 0x8C, 0xDB, 0xBF, 0xC7, 0xB8,
+    0x0D, 0x7C, 0x8C, 0xDB, 0xC1, 0xC7, 0xE8, 0x16, 0x3E, 0xB7, 0xCE, 0xE9, 0x1E, 0x3E, 0xC2, 0x66,
+    0x71, 0x13, 0x1F, 0x5B, 0xE9, 0x2E, 0x3E, 0xB6, 0xD4, 0x6D, 0x7C, 0x3C, 0x3F, 0xE4, 0x7D, 0x64,
+    0x7C, 0xB2, 0xC2, 0x81, 0x08, 0x3C, 0xB4, 0xC0, 0x78, 0x72, 0xBA, 0xF4, 0x1B, 0xA5, 0x17, 0x4B,
+    0xD6, 0xA9, 0xB6, 0x5F, 0xBD, 0x92, 0xE6, 0x0E, 0x2F, 0xC6, 0x8A, 0x73, 0x9A, 0x60, 0xD2, 0xF7,
+    0x8A, 0x29, 0xDC, 0x85, 0xD2, 0xB7, 0xCA, 0x19, 0x12, 0xF9, 0xA4, 0x6F, 0x56, 0x01, 0xF1, 0x1B,
+    0x4D, 0xF8, 0x2E, 0xF0, 0xF5, 0x26, 0xBE, 0x0E, 0xFC, 0x7A, 0x17, 0x5F, 0x02, 0x5E, 0xD8, 0xEC,
+    0x29, 0xC5, 0x76, 0x42, 0x9C, 0x76, 0x8A, 0x63, 0xE1, 0x83, 0x76, 0x90, 0x68, 0x01, 0x9E, 0x96,
+    0xD8, 0x42, 0xB1, 0x56, 0x1C, 0x94, 0xBD, 0xAD, 0x67, 0xEC, 0x46, 0x86, 0x73, 0x0A, 0xF5, 0x5E,
+    0xA1, 0x8E, 0x1E, 0xF7, 0xEE, 0xA1, 0xDE, 0x08, 0x03, 0xCF, 0xD0, 0x4F, 0x99, 0x13, 0x8D, 0x8A,
+    0x80, 0x5B, 0xCB, 0x85, 0xEA, 0x24, 0x50, 0xF4, 0x8A, 0x88, 0xAC, 0x5B, 0xE7, 0xAD, 0x9E, 0xAC,
+    0x2D, 0x0B, 0xC7, 0x57, 0xCC, 0x8E, 0x14, 0x80, 0xC9, 0x4F, 0xE5, 0x40, 0xA6, 0x71, 0xC6, 0x25,
+    0xDC, 0x7F, 0xFD, 0x5A, 0x7A, 0xFC, 0xAF, 0x5C, 0x9C, 0x06, 0x4C, 0x13, 0x1A, 0x32, 0x36, 0xBE,
+    0x33, 0xEB, 0x9D, 0x8E, 0xC8, 0x0F, 0xAD, 0xA4, 0xAC, 0x8F, 0x8F, 0x94, 0xB2, 0x3E, 0x5D, 0x4D,
+    0x59, 0xAF, 0xFB, 0x78, 0x62, 0xF3, 0xE3, 0x10, 0x4E, 0xD3, 0x0E, 0x06, 0x45, 0x04, 0x77, 0x38,
+    0xF9, 0x7D, 0xA2, 0x9B, 0xD1, 0x85, 0x72, 0x4D, 0x10, 0xA1, 0x83, 0xBD, 0x80, 0x00, 0x46, 0x2D,
+    0x42, 0x79, 0x4F, 0x98, 0xC7, 0xDA, 0x8C, 0x53, 0x27, 0x64, 0x04, 0x4E, 0xC5, 0x17, 0x3A, 0xEC,
+    0x55, 0x7E, 0xE9, 0xAE, 0x7D, 0x11, 0x5B, 0xCC, 0x66, 0xAF, 0x39, 0x4D, 0xEC, 0x8F, 0x1D, 0x37,
+    0xEB, 0xD3, 0x67, 0x29, 0x9E, 0xB6, 0x23, 0x59, 0x3C, 0x91, 0x13, 0x59, 0x03, 0x16, 0xC3, 0x5A,
+    0x31, 0x36, 0x04, 0xB2, 0x4C, 0x5A, 0x36, 0x92, 0x05, 0x74, 0xEE, 0x73, 0xF4, 0x1A, 0x97, 0x59,
+    0x63, 0xEC, 0xB0, 0xDB, 0x37, 0x0B, 0xEB, 0xE6, 0x33, 0xDA, 0x13, 0xFA, 0x7A, 0x61, 0x4D, 0x29,
+    0xA8, 0xA4, 0xB9, 0x17, 0xAA, 0x5F, 0x87, 0x5D, 0x7E, 0x9A, 0x92, 0xE1, 0x6F, 0x2F, 0xB0, 0x9C,
+    0xDC, 0xAA, 0xF2, 0xFE, 0x9E, 0xF5, 0xA1, 0xBA, 0x48, 0x81, 0x70, 0x73, 0x66, 0xAB, 0x50, 0x7B,
+    0x7B, 0xA1, 0x0E, 0x4D, 0xC8, 0x67, 0x4B, 0xFF, 0x6E, 0xE0, 0x91, 0x0A, 0xE7, 0xFA, 0xF6, 0xD4,
+    0x0E, 0x5D, 0x25, 0x4E, 0x2B, 0x65, 0xD7, 0x75, 0x4F, 0x36, 0x75, 0x47, 0xE3, 0xEC, 0x2C, 0xC0,
+    0x10, 0xFF, 0x91, 0x41, 0x83, 0x76, 0xCF, 0xD0, 0xAB, 0xEE, 0x3D, 0x97, 0xE2, 0x61, 0xA2, 0x9D,
+    0x04, 0xA7, 0xCD, 0x9B, 0x9A, 0x95, 0xD0, 0xE7, 0x8E, 0x9E, 0xC7, 0x79, 0x8A, 0x9C, 0x1B, 0xF7,
+    0x98, 0x4F, 0x57, 0x6A, 0x50, 0x0D, 0xF7, 0xEB, 0x2E, 0x56, 0x8E, 0x1B, 0xE4, 0x1B, 0x56, 0x37,
+    0xB6, 0xC4, 0x67, 0xBA, 0x0F, 0x80, 0x1E, 0xD2, 0x8E, 0x87, 0x6E, 0x82, 0xB9, 0x56, 0xDE, 0xF8,
+    0x8A, 0xAC, 0xCF, 0x63, 0x04, 0x78, 0x6B, 0x64, 0xB7, 0x63, 0x6F, 0x31, 0x5B, 0xF7, 0x92, 0xC3,
+    0x53, 0x6A, 0x06, 0x74, 0x49, 0xAC, 0x55, 0x44, 0x4A, 0x09, 0xF6, 0xB1, 0x6F, 0xAB, 0x96, 0x51,
+    0x64, 0x8E, 0x91, 0x56, 0x7C, 0x31, 0xA3, 0xEB, 0x79, 0x32, 0x72, 0xA9, 0x0E, 0xDA, 0x95, 0x30,
+    0x89, 0xD3, 0x70, 0x49, 0x1C, 0xBB, 0x3C, 0xD0, 0x90, 0x54, 0xD8, 0xEC, 0x49, 0x70, 0x37, 0x39,
+    0x2D, 0x52, 0x2B, 0xC4, 0xAD, 0xF2, 0x58, 0xCF, 0xF5, 0x68, 0x0C, 0x99, 0xC6, 0x93, 0x05, 0xCD,
+    0x99, 0x9D, 0x9D, 0x9D, 0x6B, 0x9A, 0xE8, 0xB7, 0x1D, 0xC0, 0x26, 0xDE, 0xC3, 0xE7, 0xC3, 0x0D,
+    0xDA, 0x40, 0xB3, 0x21, 0x6F, 0x63, 0xDE, 0xC9, 0x64, 0x99, 0xAA, 0x63, 0xBE, 0x93, 0xDF, 0x7C,
+    0xF8, 0xE1, 0x86, 0x8E, 0x42, 0x0A, 0x59, 0x5F, 0x79, 0x81, 0x72, 0xCC, 0x5C, 0x77, 0x8B, 0x63,
+    0x3E, 0x8F, 0x70, 0x7B, 0xCB, 0xF6, 0x8A, 0x18, 0x67, 0x9F, 0x3C, 0xB9, 0xB9, 0x69, 0xD7, 0x1A,
+    0x81, 0xEB, 0x29, 0x43, 0x34, 0xB8, 0x61, 0xDA, 0x3C, 0x6C, 0x2F, 0x70, 0x28, 0xB5, 0xCE, 0xD6,
+    0x9E, 0x32, 0xE4, 0xE6, 0xEC, 0x80, 0x5A, 0x85, 0x74, 0x22, 0x02, 0x65, 0x51, 0x38, 0x2B, 0x41,
+    0xAD, 0x4C, 0xB2, 0x4E, 0xAD, 0x9E, 0xCC, 0x96, 0xE2, 0xD2, 0x59, 0x4F, 0x4B, 0xE4, 0xA3, 0xAA,
+    0x15, 0x8C, 0x9B, 0x59, 0x39, 0xA4, 0x59, 0x8F, 0xAF, 0x31, 0xFB, 0xCA, 0xE8, 0x42, 0xEE, 0x42,
+    0x39, 0x90, 0x29, 0xCB, 0x7D, 0x32, 0xEB, 0xDD, 0xE8, 0x93, 0x7F, 0x65, 0xBA, 0x9C, 0x3E, 0x56,
+    0x2D, 0xF9, 0xB5, 0xCB, 0x21, 0xE4, 0xF2, 0x2E, 0xBF, 0xE6, 0x74, 0x3A, 0x73, 0xFD, 0xFF, 0xD8,
+    0x61, 0xED, 0xF2, 0x64, 0xED, 0xEF, 0xE1, 0x7A, 0xBA, 0xD0, 0x5E, 0x9E, 0x02, 0xF8, 0xDE, 0x1D,
+    0xF6, 0xEC, 0x67, 0xBA, 0xE9, 0x2B, 0xE7, 0x5E, 0x1E, 0xCD, 0xC3, 0x12, 0x7B, 0x76, 0x0B, 0xB3,
+    0x59, 0xC4, 0x8B, 0x7E, 0x52, 0x7F, 0xCA, 0x1B, 0x94, 0x70, 0x87, 0xF8, 0x70, 0x05, 0x2C, 0x8E,
+    0x6F, 0x5E, 0x60, 0x26, 0xCC, 0xC6, 0x6D, 0x0A, 0x38, 0xD6, 0xC4, 0xF4, 0x7E, 0xBF, 0xC4, 0x14,
+    0x4A, 0x57, 0x17, 0x15, 0xA0, 0xB9, 0x97, 0x72, 0x1F, 0x8C, 0x18, 0x97, 0x5E, 0x0F, 0xE4, 0x94,
+    0x41, 0x7F, 0x82, 0x2F, 0xE2, 0x2E, 0x1B, 0x6E, 0xEE, 0x34, 0xE3, 0xE0, 0xED, 0x95, 0xE5, 0xAB,
+    0x0F, 0xCF, 0xBF, 0xB8, 0x73, 0x95, 0x26, 0xF4, 0xCE, 0xBB, 0xC8, 0xD8, 0xC2, 0xCD, 0x77, 0x0D,
+    0x1F, 0xA8, 0x4D, 0x2F, 0x32, 0x35, 0x2E, 0xD7, 0xD7, 0xC9, 0x2D, 0x6D, 0xD6, 0xDC, 0x6F, 0x62,
+    0xB8, 0xE6, 0x6E, 0x93, 0x96, 0x27, 0x50, 0xCC, 0xB7, 0x85, 0x2A, 0xF5, 0xD5, 0xB0, 0x4A, 0x92,
+    0x44, 0x6A, 0x94, 0x37, 0x15, 0x0A, 0x72, 0xE0, 0x8E, 0x64, 0x4F, 0xF0, 0x46, 0xB6, 0x66, 0x73,
+    0xF3, 0x9C, 0xA6, 0xC5, 0x18, 0xB9, 0xF4, 0x01, 0xF5, 0xE3, 0xDB, 0xEF, 0x05, 0x1E, 0x41, 0xE8,
+    0x8C, 0xEC, 0x39, 0x3A, 0xB5, 0x13, 0xA6, 0x49, 0x7B, 0x50, 0xB0, 0xED, 0x93, 0xB9, 0x81, 0x71,
+    0x3B, 0x41, 0x16, 0xB9, 0x69, 0xA3, 0x60, 0xD4, 0xC2, 0x9B, 0xEA, 0x84, 0x49, 0x1E, 0x67, 0x0B,
+    0x4E, 0xAA, 0x20, 0x87, 0xAC, 0x10, 0x96, 0x1E, 0x4E, 0xAB, 0xA0, 0x38, 0x68, 0xFD, 0x3E, 0x34,
+    0xD1, 0xD4, 0xCD, 0x29, 0xF2, 0x06, 0x24, 0x6E, 0xFB, 0xD9, 0x18, 0xF9, 0x0A, 0xB0, 0xF1, 0x6C,
+    0xED, 0xB7, 0x96, 0x0D, 0x5A, 0x07, 0xCB, 0x01, 0x1C, 0x7E, 0x4E, 0xCA, 0xA0, 0x77, 0x69, 0x09,
+    0x98, 0xE4, 0x59, 0x35, 0x85, 0x17, 0xDC, 0x83, 0x12, 0x4D, 0xF1, 0xE7, 0x1F, 0xC6, 0xE0, 0xA9,
+    0x27, 0x18, 0x84, 0x50, 0x3D, 0x75, 0x90, 0x81, 0x97, 0x03, 0xE0, 0x80, 0x6D, 0x68, 0x98, 0x4A,
+    0xC6, 0x65, 0x91, 0xD1, 0x3D, 0xE1, 0xDD, 0x96, 0x33, 0xE9, 0xBE, 0x1D, 0x68, 0xE2, 0x92, 0xD9,
+    0x61, 0x78, 0x31, 0x73, 0xC2, 0xAC, 0xE4, 0xA2, 0x2A, 0x56, 0xF6, 0x21, 0xFD, 0x57, 0x9B, 0x8B,
+    0xEB, 0xC0, 0xC1, 0x14, 0x7D, 0x9C, 0xC1, 0xF4, 0x99, 0xB6, 0x94, 0x4E, 0xCA, 0xE5, 0x60, 0x9A,
+    0x1E, 0x65, 0x30, 0x3D, 0x9A, 0xC6, 0x9C, 0x94, 0xD2, 0x94, 0xB3, 0x5A, 0x5A, 0x92, 0x0D, 0xA9,
+    0xED, 0xB8, 0xDA, 0x8C, 0x9F, 0xF9, 0x5E, 0x88, 0xE1, 0x22, 0x35, 0x31, 0x76, 0xCC, 0xC6, 0x76,
+    0xD9, 0x8B, 0x54, 0x6A, 0xA7, 0xDC, 0xD7, 0xA7, 0xBE, 0x63, 0x85, 0x2E, 0x8C, 0x6A, 0x11, 0x1E,
+    0xC2, 0xD5, 0x24, 0x23, 0x4F, 0xE2, 0xEE, 0xC4, 0x5A, 0x73, 0x35, 0x38, 0x0E, 0xE1, 0xE7, 0x29,
+    0x4D, 0xB8, 0x76, 0xB4, 0x61, 0x57, 0x7B, 0x88, 0xEE, 0x86, 0x4A, 0xEA, 0x98, 0xF9, 0x3C, 0xF4,
+    0x82, 0x13, 0x02, 0xE6, 0xBF, 0x56, 0xC1, 0x21, 0xF1, 0x30, 0x9E, 0x67, 0x64, 0x16, 0x8E, 0x7D,
+    0x9E, 0x7A, 0xE4, 0xD4, 0x4B, 0x3B, 0x1A, 0x6E, 0x06, 0x1F, 0xB1, 0xEB, 0xB4, 0xEE, 0xCE, 0x90,
+    0xD7, 0xA1, 0x86, 0x6B, 0xF6, 0xB4, 0xF8, 0xF6, 0xE7, 0xA2, 0x47, 0xC6, 0x3B, 0xA7, 0x2E, 0x2B,
+    0xB5, 0x0E, 0x2A, 0x79, 0x46, 0xFC, 0x36, 0x4C, 0xBE, 0x4F, 0xC9, 0x65, 0xF5, 0x74, 0xE8, 0x04,
+    0x94, 0x15, 0x48, 0xF2, 0xB5, 0xDC, 0x70, 0xB3, 0xD6, 0x1D, 0x05, 0xB2, 0x1C, 0x69, 0x43, 0x17,
+    0x88, 0x02, 0x9B, 0x23, 0x8B, 0xAF, 0xCB, 0xF4, 0x67, 0x9F, 0x97, 0x6A, 0x65, 0x6F, 0x82, 0x1F,
+    0x47, 0x9A, 0xBF, 0xF8, 0x76, 0xE5, 0xD4, 0xB8, 0xF4, 0xE0, 0x9C, 0xA9, 0x25, 0x7A, 0x31, 0xF4,
+    0x14, 0xD6, 0xD4, 0xAC, 0x8D, 0xCB, 0xD9, 0xEA, 0x36, 0x22, 0x29, 0x5C, 0x62, 0xAB, 0x68, 0xC9,
+    0xCA, 0xFE, 0x1A, 0x01, 0x98, 0x48, 0xB3, 0xA7, 0x20, 0x1B, 0x37, 0xEB, 0x3C, 0xE6, 0x67, 0xB5,
+    0x27, 0xB5, 0x4F, 0x5C, 0x96, 0xEB, 0xB2, 0x4B, 0x30, 0x39, 0x60, 0xB1, 0x78, 0x74, 0xFB, 0x64,
+    0x59, 0x1A, 0x01, 0x06, 0xC7, 0x8D, 0xCD, 0x73, 0x87, 0xEA, 0xF2, 0x1E, 0x74, 0xDC, 0x38, 0x6B,
+    0x34, 0xE7, 0xC2, 0xF2, 0xB8, 0x7F, 0x5E, 0xA2, 0x4F, 0xB0, 0x23, 0xCC, 0xDE, 0x65, 0x1A, 0x83,
+    0xFC, 0x41, 0x6B, 0xF5, 0x41, 0xC7, 0x17, 0x2F, 0x0F, 0x18, 0x1C, 0x86, 0x3E, 0x28, 0x87, 0xE3,
+    0xD1, 0xA4, 0x26, 0x8F, 0xB3, 0x9F, 0xC9, 0x31, 0x9F, 0x9B, 0x3D, 0x9D, 0x1F, 0x56, 0x18, 0x78,
+    0x9C, 0xDB, 0x6B, 0x3D, 0x9E, 0xAC, 0x0E, 0x0F, 0x0E, 0xEF, 0xA0, 0x7B, 0x3F, 0xD9, 0xD6, 0x8C,
+    0xA4, 0x97, 0xF9, 0xED, 0x87, 0xD9, 0x0E, 0x3F, 0x76, 0x0A, 0x88, 0xEE, 0x65, 0x3A, 0xA6, 0xF8,
+    0x83, 0xA6, 0x3C, 0x1C, 0x13, 0x77, 0x50, 0xB0, 0xAE, 0x35, 0xBA, 0xE6, 0x62, 0x42, 0x26, 0xCD,
+    0xE6, 0x91, 0x06, 0xD4, 0x92, 0x86, 0x43, 0x85, 0x86, 0x24, 0x7E, 0xDC, 0xBF, 0xC0, 0xE6, 0x6A,
+    0x9A, 0xA1, 0x51, 0xE6, 0xEE, 0x92, 0x16, 0x4F, 0x1D, 0xE9, 0x5E, 0x12, 0xED, 0x91, 0xAD, 0xFA,
+    0x4F, 0xD4, 0x2F, 0x5F, 0x95, 0x3F, 0xF1, 0x1D, 0xBE, 0x2A, 0x76, 0xF7, 0x1B, 0xD1, 0xDD, 0x9F,
+    0xAA, 0xCB, 0x73, 0x33, 0xE8, 0x2E, 0xB1, 0x8D, 0xF3, 0xC4, 0x22, 0xA8, 0x56, 0xD8, 0x4F, 0x46,
+    0x88, 0x6B, 0x3E, 0x84, 0x01, 0x54, 0xBF, 0xD9, 0xA0, 0x1D, 0x24, 0x7E, 0x55, 0x58, 0x0E, 0x1C,
+    0x01, 0x97, 0x4B, 0x6D, 0x5C, 0xD1, 0xAF, 0x49, 0x48, 0x62, 0xA7, 0xFB, 0x3E, 0x3D, 0xC5, 0x4C,
+    0x9B, 0x6F, 0x76, 0x3E, 0xC8, 0x4B, 0x13, 0x6C, 0xBB, 0x9C, 0x08, 0x9A, 0xA8, 0x55, 0xD7, 0x12,
+    0xCD, 0xFD, 0xA3, 0xE9, 0xDF, 0xB1, 0x43, 0xA1, 0xDC, 0xFB, 0x3C, 0x9D, 0x7C, 0xC6, 0x76, 0x57,
+    0xA3, 0x77, 0x13, 0xEC, 0x28, 0x63, 0x13, 0x64, 0x14, 0x52, 0x7E, 0xF1, 0x10, 0x18, 0x93, 0x27,
+    0x8B, 0x3B, 0xE3, 0x95, 0x4B, 0x48, 0x17, 0xF9, 0x31, 0xDB, 0x79, 0xA6, 0x09, 0x55, 0x55, 0xCC,
+    0x5C, 0x87, 0xCB, 0x76, 0x9E, 0xEF, 0x6B, 0xE7, 0x9A, 0xED, 0x4C, 0xC5, 0x67, 0x80, 0x18, 0x08,
+    0x66, 0xEE, 0x44, 0x3B, 0x6B, 0x24, 0x7E, 0xB9, 0x6C, 0x30, 0xB6, 0xD7, 0x6C, 0x7D, 0x1B, 0x47,
+    0xEB, 0xB6, 0x71, 0x0C, 0x7D, 0xF6, 0x72, 0x05, 0x5F, 0xCC, 0x6C, 0xB7, 0x3D, 0xDC, 0xC6, 0xF1,
+    0x79, 0xBF, 0x8D, 0x63, 0x3B, 0xD8, 0xC6, 0x31, 0x6E, 0xFE, 0x1F, 0xDD, 0x5B, 0xBD, 0x6F, 0xE5,
+    0xC6, 0x11, 0x5F, 0x92, 0xD6, 0x23, 0x20, 0x16, 0x74, 0x71, 0x49, 0xA1, 0x2B, 0xD8, 0xC6, 0x2A,
+    0xCC, 0x3E, 0x88, 0x4D, 0x3A, 0x29, 0x5C, 0x5C, 0x61, 0x15, 0xA7, 0x73, 0xE1, 0xC2, 0x8D, 0xAF,
+    0x71, 0x80, 0xE8, 0x1F, 0x70, 0x4C, 0x1A, 0x29, 0xD2, 0xAA, 0x48, 0x52, 0xA4, 0x89, 0x80, 0xC8,
+    0x81, 0x4E, 0x2E, 0xAE, 0x49, 0xA1, 0x00, 0x77, 0x22, 0xE3, 0xC2, 0x06, 0x9C, 0x22, 0x8C, 0x01,
+    0xA7, 0x35, 0x13, 0x1C, 0x52, 0xC4, 0xC5, 0xD1, 0x00, 0x05, 0x53, 0x0A, 0xC9, 0xCD, 0xFC, 0x66,
+    0x97, 0x5F, 0xCF, 0x4A, 0x6C, 0xDD, 0xE5, 0x9E, 0xF8, 0xF2, 0xA4, 0x37, 0x4B, 0xF1, 0x63, 0x77,
+    0xF6, 0x37, 0xB3, 0xF3, 0xB5, 0x94, 0x10, 0x49, 0x25, 0xE8, 0x23, 0x6B, 0x22, 0x86, 0x6C, 0x88,
+    0x5A, 0x52, 0x82, 0xB6, 0xA0, 0x4E, 0x2D, 0x63, 0x21, 0xDC, 0x5A, 0xA6, 0x44, 0xAB, 0x84, 0xA8,
+    0x5F, 0x06, 0xB9, 0x10, 0x41, 0x11, 0x14, 0x42, 0x44, 0xB9, 0x5F, 0x0A, 0x91, 0x64, 0x1E, 0x75,
+    0x21, 0x53, 0xB7, 0xA6, 0x0E, 0x62, 0xA7, 0x11, 0xA6, 0x94, 0xB2, 0x45, 0x37, 0xD4, 0x91, 0x0D,
+    0x1A, 0x3A, 0xA0, 0xA9, 0xDB, 0xEE, 0xDE, 0x91, 0xA9, 0x47, 0x23, 0xC9, 0x2C, 0xA0, 0x47, 0x92,
+    0x22, 0xA0, 0xC7, 0xA3, 0x22, 0xA2, 0xAE, 0x82, 0x4A, 0x52, 0xB7, 0x3E, 0xB8, 0x18, 0x7D, 0x9C,
+    0x18, 0x14, 0x43, 0x11, 0x2D, 0x87, 0x63, 0x2F, 0xEB, 0x6F, 0xD9, 0xB8, 0x0B, 0xBE, 0x65, 0x21,
+    0x68, 0x8C, 0x9A, 0x07, 0x15, 0xE6, 0x99, 0x23, 0x43, 0x41, 0x6C, 0x84, 0xB8, 0x44, 0x5D, 0xDC,
+    0x91, 0xB1, 0x91, 0x48, 0xE2, 0x8D, 0xAE, 0xC6, 0x81, 0xFC, 0x42, 0xC6, 0x51, 0x49, 0x17, 0x92,
+    0x1C, 0x24, 0x33, 0x71, 0x64, 0xD3, 0xB9, 0xF3, 0x3D, 0x5C, 0xA5, 0x5B, 0x3C, 0x59, 0x47, 0xB1,
+    0x2D, 0xF3, 0x20, 0x16, 0x37, 0xFA, 0x81, 0x4C, 0x8C, 0xEF, 0x00, 0x20, 0xB7, 0xC5, 0x11, 0x88,
+    0x59, 0xF5, 0x97, 0xDF, 0x0E, 0x19, 0xC6, 0xB2, 0x07, 0x53, 0xFC, 0xA8, 0xE1, 0xC7, 0x98, 0x3A,
+    0x7C, 0xC6, 0xCF, 0x99, 0xF9, 0x58, 0x2C, 0x7D, 0x66, 0x26, 0x82, 0xCD, 0x43, 0xF0, 0x2A, 0x99,
+    0x80, 0xD7, 0x28, 0x05, 0xF0, 0x31, 0x98, 0xA3, 0x49, 0x5A, 0xCC, 0x60, 0xB1, 0x62, 0xFC, 0x17,
+    0x07, 0xA0, 0x2E, 0x31, 0xB8, 0x7D, 0x00, 0x56, 0x64, 0xFD, 0x10, 0x23, 0x40, 0x08, 0x76, 0x19,
+    0x85, 0x50, 0x09, 0x28, 0xC5, 0x86, 0x30, 0xC2, 0xB9, 0xC2, 0xAA, 0x3F, 0x06, 0x78, 0xB6, 0x2A,
+    0xE1, 0x4A, 0x9A, 0x4D, 0x20, 0x7F, 0x1D, 0x8A, 0x64, 0x2F, 0x17, 0x46, 0x63, 0x97, 0xC2, 0xCA,
+    0x45, 0xBD, 0x3A, 0x58, 0xB7, 0x19, 0x29, 0x3F, 0x65, 0xFD, 0x2C, 0xB6, 0x49, 0xE8, 0x46, 0xC5,
+    0x60, 0x69, 0x58, 0xAB, 0x28, 0x06, 0xAC, 0xEE, 0x1A, 0xC0, 0x9A, 0x84, 0xDD, 0x4C, 0x9C, 0x9C,
+    0x30, 0x33, 0x7E, 0x0B, 0xEE, 0x9C, 0x8B, 0x16, 0xFC, 0x93, 0x72, 0xBC, 0x2C, 0x9C, 0x54, 0x33,
+    0x7F, 0x67, 0x87, 0xCE, 0x81, 0x5F, 0x02, 0x2E, 0x25, 0xF8, 0xE9, 0x6E, 0x7F, 0x27, 0xC1, 0xAA,
+    0x05, 0x67, 0x02, 0x8C, 0x6D, 0xEC, 0x55, 0xE2, 0xA6, 0x94, 0x15, 0x6E, 0xA9, 0x2C, 0xD9, 0x26,
+    0x95, 0x2D, 0x43, 0xAF, 0xA2, 0x05, 0x4F, 0xA4, 0x11, 0x3E, 0x8E, 0x22, 0x3A, 0xF7, 0x2B, 0x5C,
+    0xA5, 0x5B, 0x48, 0x4C, 0x1F, 0x57, 0x22, 0x6A, 0x49, 0xA6, 0x1D, 0x4A, 0x6F, 0x31, 0x95, 0xFC,
+    0xD7, 0x7D, 0x05, 0x30, 0xD1, 0xED, 0x43, 0x28, 0xAA, 0xAC, 0xDF, 0x19, 0x69, 0xEE, 0xDA, 0x40,
+    0xDC, 0x59, 0x5D, 0x9F, 0x57, 0x3E, 0xB0, 0x5A, 0x14, 0xD0, 0x61, 0x80, 0xF8, 0x09, 0x3D, 0x77,
+    0x7F, 0xD0, 0xE1, 0x07, 0xAB, 0x36, 0xCD, 0x34, 0x7C, 0xFC, 0x7B, 0xF4, 0x4A, 0x63, 0x09, 0xEB,
+    0xAF, 0xE0, 0xDA, 0x8C, 0xB7, 0x00, 0xE7, 0xC6, 0x6D, 0x66, 0x9C, 0x6D, 0x70, 0xC4, 0xF2, 0x68,
+    0x7D, 0x9A, 0x85, 0x55, 0x12, 0xA7, 0x00, 0x7C, 0x67, 0xAE, 0x90, 0x2F, 0xF6, 0x37, 0xE9, 0xAF,
+    0xC6, 0x07, 0xDB, 0xC4, 0x4D, 0xE9, 0x75, 0x9E, 0x86, 0x6D, 0xB0, 0x2D, 0x69, 0x12, 0xDE, 0x17,
+    0xF4, 0x58, 0xF0, 0x0A, 0xF5, 0x53, 0x09, 0x7F, 0x0A, 0x79, 0xFE, 0xAD, 0x21, 0xF7, 0x9F, 0x00,
+    0xF2, 0x6D, 0xB6, 0xC5, 0xC9, 0xC8, 0x54, 0x34, 0xE8, 0xD7, 0x2B, 0x82, 0x0C, 0x7E, 0xC2, 0x29,
+    0xE6, 0xED, 0xDE, 0xAE, 0x1A, 0x61, 0x2C, 0xEE, 0xC1, 0xF3, 0x00, 0xBE, 0x00, 0x4C, 0xCA, 0xFB,
+    0x05, 0xF9, 0x40, 0xBB, 0xA6, 0xD5, 0x2B, 0x4E, 0xAF, 0x3B, 0x08, 0x69, 0x94, 0x2F, 0xE9, 0x3F,
+    0xF7, 0xF8, 0x26, 0x9E, 0x23, 0xBB, 0x68, 0xF7, 0xD6, 0x87, 0x34, 0x69, 0x37, 0xB5, 0x89, 0x3A,
+    0xE7, 0x7B, 0x29, 0x63, 0x8F, 0x29, 0x27, 0xBC, 0x24, 0x46, 0x26, 0x67, 0x9E, 0x52, 0x0A, 0x60,
+    0x3C, 0x23, 0xFA, 0x86, 0xF5, 0x0D, 0x61, 0x7E, 0x79, 0xF0, 0x80, 0x7C, 0x94, 0x81, 0x07, 0x11,
+    0x68, 0x05, 0x58, 0x05, 0x8B, 0x8B, 0x95, 0x46, 0x22, 0x0C, 0x30, 0x73, 0xA4, 0x03, 0x39, 0xF7,
+    0xD5, 0x4F, 0x33, 0x46, 0x38, 0x1B, 0x21, 0x1C, 0xAE, 0x0D, 0xC2, 0x1E, 0x3B, 0x4D, 0xA8, 0xCA,
+    0x0F, 0x4B, 0x42, 0xB8, 0x78, 0xEB, 0xDA, 0x11, 0x56, 0xE1, 0xB1, 0x72, 0x33, 0x06, 0x53, 0x13,
+    0xD4, 0x73, 0x7E, 0x06, 0x9C, 0xDF, 0x73, 0x40, 0xCF, 0xA2, 0x75, 0xC2, 0x19, 0xAC, 0x59, 0x6C,
+    0x2D, 0x1F, 0x82, 0xB1, 0x97, 0x88, 0xAD, 0x57, 0xAA, 0xE7, 0x69, 0x81, 0x66, 0x35, 0x65, 0x10,
+    0xC8, 0x21, 0xD8, 0x71, 0x29, 0xB0, 0xCF, 0xC5, 0x75, 0x78, 0xCF, 0x13, 0xF6, 0x9E, 0xC4, 0xBB,
+    0xF5, 0x8F, 0xC1, 0x7B, 0x9A, 0xB1, 0x20, 0x4B, 0x6F, 0xE5, 0x06, 0xCE, 0xB7, 0x6F, 0x40, 0x0A,
+    0x52, 0x72, 0x0C, 0xA0, 0x22, 0x9B, 0x1D, 0x31, 0x6B, 0xEF, 0xE9, 0xF7, 0xDE, 0xF3, 0xA4, 0xF7,
+    0x9E, 0xEC, 0x29, 0x4F, 0xC5, 0xBB, 0x40, 0xBB, 0x86, 0x55, 0x47, 0x18, 0x70, 0x1A, 0xAE, 0xD0,
+    0x7B, 0x6E, 0x85, 0xC6, 0x01, 0xEC, 0x05, 0xCC, 0xB3, 0xDB, 0x26, 0x05, 0x9C, 0x39, 0x80, 0x31,
+    0x18, 0x30, 0x71, 0xF3, 0x91, 0xF8, 0xBF, 0xF2, 0x9E, 0xE6, 0x81, 0xD8, 0xA6, 0x70, 0x8B, 0x30,
+    0x37, 0xE4, 0x07, 0x0D, 0x14, 0xA8, 0x02, 0xF6, 0xF9, 0xCA, 0xCD, 0x0A, 0x33, 0x03, 0x70, 0xDD,
+    0x66, 0x42, 0x7A, 0xEF, 0x49, 0x4F, 0xE5, 0x93, 0xEF, 0x67, 0xBB, 0x21, 0xFB, 0xFB, 0xF1, 0x17,
+    0xE7, 0x08, 0xA9, 0xFE, 0xFB, 0xCF, 0xE3, 0xF8, 0x6B, 0xF7, 0x74, 0xDF, 0xA5, 0xFE, 0x7A, 0x2E,
+    0xDE, 0x55, 0x53, 0x32, 0xE9, 0x26, 0x03, 0x37, 0x26, 0x5D, 0x64, 0xF7, 0x3E, 0x07, 0xA9, 0x39,
+    0xE4, 0x53, 0x03, 0x0B, 0x49, 0x0A, 0x62, 0xC9, 0xD0, 0xAF, 0xA8, 0x3F, 0xC2, 0x35, 0x62, 0x92,
+    0x45, 0x74, 0x61, 0x4C, 0x8A, 0x0E, 0x75, 0x16, 0x00, 0x49, 0xC8, 0x20, 0xB5, 0xFE, 0x65, 0x12,
+    0x42, 0xB2, 0xA1, 0x01, 0x42, 0xEB, 0x15, 0x33, 0xFD, 0x4E, 0xCF, 0xC1, 0x1F, 0x58, 0x8B, 0x98,
+    0x84, 0xFA, 0xC8, 0x68, 0x3A, 0x2E, 0xEE, 0xE1, 0x4C, 0x46, 0x5F, 0xCA, 0xA3, 0xDC, 0x42, 0x39,
+    0x07, 0x58, 0xE3, 0x84, 0xA4, 0xF0, 0x70, 0x10, 0xFD, 0x33, 0x87, 0x4B, 0x87, 0x5D, 0x50, 0x6F,
+    0x18, 0x9D, 0xE7, 0xB8, 0x78, 0xE2, 0xE5, 0xBA, 0x1E, 0x61, 0xF0, 0x6A, 0x19, 0x92, 0xEA, 0xD5,
+    0x60, 0xE7, 0x54, 0x56, 0xEE, 0xCB, 0xC7, 0x19, 0xA9, 0x58, 0xFA, 0xD0, 0x93, 0xE1, 0x89, 0x71,
+    0xB2, 0x3A, 0x40, 0x54, 0xE4, 0x91, 0x05, 0x08, 0xBA, 0x4F, 0xB1, 0x4C, 0x28, 0x04, 0xFD, 0x1B,
+    0x19, 0x30, 0x3B, 0x75, 0xF6, 0x57, 0x0A, 0xC3, 0xE6, 0xBE, 0x8A, 0xCC, 0x8E, 0xF7, 0x23, 0x1A,
+    0xE8, 0x8C, 0xD8, 0x60, 0x5B, 0x9A, 0x4B, 0x44, 0xFF, 0x3E, 0x16, 0xDC, 0x86, 0xB6, 0xA8, 0x01,
+    0x96, 0xFB, 0x32, 0x39, 0xDB, 0xDD, 0xD1, 0xA3, 0x2D, 0x11, 0xBE, 0x00, 0x3B, 0x30, 0x22, 0x17,
+    0xC7, 0x07, 0x97, 0xDF, 0x3C, 0x90, 0x4B, 0xC6, 0x18, 0xA9, 0xA9, 0xD0, 0xCE, 0xD7, 0x95, 0xB7,
+    0x60, 0xC0, 0xE4, 0x27, 0xC4, 0x5A, 0xF4, 0x1B, 0x3C, 0x88, 0x84, 0x1D, 0x01, 0xF5, 0x03, 0x31,
+    0xD1, 0x22, 0xC6, 0x4F, 0x01, 0xA8, 0x10, 0x54, 0x10, 0x0A, 0xC6, 0x50, 0x30, 0x88, 0x4C, 0x33,
+    0xC1, 0xE0, 0x4D, 0x69, 0xB1, 0x6C, 0x0F, 0x19, 0x4C, 0x85, 0x26, 0xDB, 0xDA, 0x50, 0x28, 0x3C,
+    0x35, 0xA0, 0x8C, 0x28, 0x17, 0x62, 0x90, 0x96, 0xAA, 0x32, 0x8C, 0x51, 0x63, 0x68, 0x13, 0x23,
+    0x73, 0x0D, 0xC6, 0x45, 0x7D, 0x60, 0x28, 0x0F, 0xB8, 0x30, 0xDE, 0xCB, 0xA4, 0xD9, 0xBD, 0x4D,
+    0x5E, 0x00, 0x57, 0x97, 0x08, 0x5F, 0xC0, 0x5C, 0x46, 0xA4, 0x3D, 0x3E, 0xBA, 0xFC, 0xE6, 0x81,
+    0x5C, 0x32, 0x06, 0x43, 0x13, 0x77, 0x75, 0x16, 0xBB, 0x80, 0xEB, 0xFC, 0x1D, 0x38, 0xB5, 0xCF,
+    0x81, 0x11, 0x2C, 0xAD, 0x1F, 0xF6, 0x75, 0x96, 0xAD, 0x1D, 0x38, 0xB6, 0x16, 0xF3, 0x24, 0xD4,
+    0x12, 0xC8, 0x92, 0x8C, 0x71, 0x49, 0x86, 0xDA, 0xAD, 0xC9, 0xE0, 0xD8, 0x4C, 0x1A, 0x20, 0x32,
+    0x21, 0x13, 0xC3, 0x04, 0x0B, 0xF9, 0xBC, 0x90, 0xE7, 0x6F, 0x94, 0x80, 0xB7, 0x44, 0xDD, 0xA6,
+    0x04, 0x2E, 0x84, 0x94, 0x81, 0xD8, 0xC3, 0xF8, 0x05, 0x67, 0xA0, 0x38, 0x62, 0x1B, 0xEA, 0x09,
+    0x52, 0xC9, 0x96, 0xCE, 0x94, 0xC5, 0x7C, 0x55, 0x92, 0x2D, 0x98, 0x57, 0xAA, 0x60, 0x84, 0x38,
+    0x2F, 0xA1, 0x99, 0x19, 0xC1, 0xF4, 0x51, 0xA8, 0xF4, 0x12, 0x6A, 0x39, 0xD2, 0xCA, 0x15, 0x59,
+    0x36, 0x92, 0x45, 0xEA, 0xC9, 0xC7, 0xF1, 0x8B, 0x6F, 0x4A, 0xF1, 0x3D, 0xE3, 0x88, 0xCE, 0xA3,
+    0x54, 0x45, 0x99, 0x2E, 0xB1, 0xEE, 0x7C, 0xD9, 0x0A, 0x9F, 0x50, 0xBC, 0xA1, 0x75, 0xF0, 0xD9,
+    0x9B, 0x7E, 0x0E, 0xDF, 0x5A, 0x0F, 0x48, 0x92, 0x0A, 0x9D, 0x38, 0x3D, 0x7C, 0x70, 0x07, 0x16,
+    0xD6, 0xA7, 0xFB, 0x2F, 0xA4, 0x27, 0xEF, 0x35, 0x70, 0x66, 0xFE, 0xB7, 0x84, 0x2A, 0x79, 0x4A,
+    0xA8, 0x76, 0xE9, 0x7B, 0x0C, 0xC7, 0x0D, 0xF5, 0xAA, 0x84, 0xF7, 0x55, 0x4B, 0x56, 0x30, 0x89,
+    0x4F, 0x47, 0xE1, 0xCE, 0xB5, 0x07, 0x11, 0xFF, 0xB1, 0x58, 0x51, 0x88, 0x76, 0x56, 0x71, 0x06,
+    0xFA, 0x68, 0x90, 0x49, 0x6C, 0xD1, 0x34, 0xC8, 0x99, 0x44, 0x31, 0x5D, 0xA7, 0x40, 0xD1, 0x54,
+    0xC5, 0x25, 0x59, 0x11, 0x73, 0xF4, 0xBB, 0x27, 0x73, 0x9C, 0xBF, 0xCA, 0xAF, 0x0F, 0xA8, 0x6A,
+    0xF5, 0xBB, 0xB5, 0x2F, 0x82, 0x86, 0xA0, 0x60, 0x47, 0x90, 0xC0, 0x58, 0x90, 0x2E, 0x39, 0x9D,
+    0xB8, 0x68, 0xC6, 0x4F, 0xF0, 0xFB, 0xBF, 0xE2, 0xAD, 0x8F, 0x49, 0xC9, 0xE4, 0x52, 0x28, 0xEA,
+    0x72, 0x45, 0x09, 0xE1, 0x30, 0x81, 0x9F, 0xE4, 0x49, 0x1E, 0x65, 0x1B, 0x2A, 0x01, 0xC8, 0xBF,
+    0xF9, 0x87, 0x67, 0x13, 0x47, 0x79, 0x52, 0x24, 0xB9, 0x3F, 0xEC, 0x2F, 0x51, 0xC8, 0x1C, 0x73,
+    0xBD, 0xBB, 0xE2, 0x82, 0xB7, 0xE4, 0xD0, 0x5F, 0xA6, 0xB6, 0x7C, 0x44, 0xA1, 0x31, 0xB4, 0x44,
+    0x16, 0xA8, 0x8D, 0x06, 0x15, 0x02, 0x7B, 0xBF, 0x46, 0xD0, 0xEF, 0xD5, 0x90, 0xAF, 0xDB, 0x68,
+    0x5A, 0x8C, 0xE8, 0xF8, 0x7C, 0x05, 0x4F, 0xA1, 0x9E, 0x52, 0x3D, 0xB8, 0x00, 0xB8, 0xA4, 0x6E,
+    0x6D, 0x59, 0x70, 0x6A, 0x91, 0x0A, 0xA9, 0x95, 0x42, 0xBB, 0x33, 0x44, 0x0D, 0xC6, 0x28, 0x67,
+    0xB4, 0xD5, 0x6E, 0x58, 0xA5, 0xDD, 0x64, 0x7F, 0x3C, 0xAA, 0x1F, 0x1A, 0x77, 0x07, 0x55, 0x6D,
+    0x58, 0x55, 0x43, 0x57, 0xBE, 0x2E, 0x53, 0xBA, 0x9D, 0x52, 0x14, 0xD2, 0x52, 0xA4, 0x39, 0x01,
+    0x12, 0x14, 0x22, 0x79, 0x4F, 0x0A, 0x95, 0xFF, 0x04, 0xC8, 0x5F, 0x08, 0x0F, 0xDC, 0xEC, 0xCA,
+    0x0F, 0x30, 0x6F, 0x82, 0xC0, 0x60, 0x7E, 0x7C, 0x5E, 0x4B, 0xB7, 0xFB, 0x81, 0x4E, 0x3A, 0x55,
+    0xB5, 0x7B, 0x62, 0x36, 0x4B, 0x99, 0x58, 0x50, 0x29, 0x07, 0x02, 0xFA, 0x7D, 0x95, 0x02, 0x27,
+    0x61, 0x1F, 0x64, 0xD8, 0xBC, 0xBE, 0x6C, 0x55, 0xB1, 0xD8, 0x9F, 0xB9, 0x08, 0xAE, 0x16, 0x5C,
+    0xAF, 0x46, 0x0A, 0xE6, 0x21, 0x4B, 0x9F, 0x26, 0xB7, 0x7D, 0x04, 0x8B, 0x1A, 0x35, 0x01, 0x5B,
+    0x54, 0x98, 0x8E, 0x1A, 0x85, 0x40, 0x37, 0x87, 0x6A, 0x6C, 0x8C, 0x0A, 0x0F, 0xB3, 0xD6, 0x6F,
+    0xAD, 0x17, 0x26, 0x07, 0x9F, 0xAF, 0x16, 0x1C, 0x7C, 0xC6, 0xFF, 0x25, 0xF8, 0xBC, 0x3B, 0x0E,
+    0x3E, 0x1B, 0x15, 0x7C, 0x86, 0x82, 0x91, 0x16, 0x8C, 0x1E, 0x87, 0x9D, 0x00, 0x74, 0x38, 0x60,
+    0xA4, 0x3B, 0xDA, 0x5D, 0xC2, 0x2F, 0x20, 0xD7, 0x4F, 0x31, 0xE8, 0x1C, 0x7C, 0x0A, 0x0D, 0xBB,
+    0xC6, 0x9D, 0x81, 0xDF, 0x62, 0x6B, 0xE1, 0xB2, 0xDA, 0x5A, 0xE5, 0xF6, 0x11, 0x04, 0x1F, 0xB5,
+    0x62, 0x8A, 0xBC, 0xA3, 0x90, 0x0F, 0xD7, 0x02, 0x79, 0xDE, 0xAE, 0xD6, 0x3E, 0xD9, 0x2E, 0x78,
+    0x6F, 0xEF, 0x7D, 0x9E, 0xB5, 0xD5, 0x48, 0xA1, 0x23, 0x55, 0x84, 0xAA, 0x43, 0x85, 0xFF, 0xBB,
+    0x3B, 0x42, 0x47, 0xAB, 0xE8, 0x33, 0xE3, 0x19, 0xD1, 0x63, 0xF2, 0x2C, 0xAA, 0xE1, 0x61, 0xC9,
+    0x38, 0x23, 0x5A, 0xED, 0x6C, 0xB8, 0x3A, 0xB0, 0xDB, 0x11, 0x9D, 0x18, 0xF9, 0xD0, 0x69, 0xF5,
+    0x53, 0x42, 0x5E, 0x60, 0x97, 0x24, 0xE2, 0xF2, 0x9E, 0xC7, 0x65, 0x1E, 0xB5, 0x61, 0xD2, 0x47,
+    0xA3, 0x2F, 0x8C, 0x38, 0xFE, 0x31, 0x33, 0x64, 0x65, 0xD0, 0x7F, 0xD8, 0xF0, 0xA8, 0x79, 0x89,
+    0xA5, 0x20, 0x96, 0xA4, 0xB0, 0x2E, 0xFA, 0x8F, 0xCD, 0x7A, 0xE1, 0x5E, 0x21, 0xD2, 0x5D, 0x95,
+    0xB1, 0x47, 0x16, 0xFD, 0x03, 0x40, 0xDB, 0x62, 0x0D, 0x9E, 0x41, 0x38, 0xE6, 0xFE, 0x26, 0xD6,
+    0x81, 0x71, 0x5B, 0x65, 0x58, 0xEC, 0x92, 0x20, 0x2E, 0x91, 0xBC, 0x86, 0xAB, 0x15, 0x16, 0x31,
+    0x05, 0xBF, 0x37, 0x66, 0x6E, 0xD5, 0xF7, 0x17, 0x34, 0x4E, 0xFB, 0x26, 0x67, 0x20, 0x42, 0xBC,
+    0xE3, 0xF4, 0x26, 0x5C, 0xA6, 0x7D, 0xDC, 0x8C, 0xFA, 0x5B, 0x4C, 0x4A, 0xF8, 0x53, 0xE1, 0x85,
+    0xDF, 0x00, 0x7C, 0xF5, 0xF4, 0xC0, 0x67, 0x1D, 0xF0, 0xFC, 0x52, 0x89, 0x08, 0x06, 0xCB, 0x62,
+    0x4A, 0xA8, 0xBD, 0x53, 0x79, 0x58, 0x1B, 0x99, 0x59, 0x4D, 0x7D, 0xED, 0xBA, 0x47, 0x2E, 0xE6,
+    0x71, 0xE7, 0x60, 0x59, 0xF9, 0xA2, 0xCF, 0x4B, 0x82, 0xC4, 0x6A, 0x50, 0x6E, 0x4C, 0xE6, 0x16,
+    0xDC, 0x6C, 0x1D, 0xAA, 0x45, 0x51, 0xF4, 0xAA, 0x82, 0xF2, 0xB2, 0x5A, 0xC3, 0x95, 0x98, 0xD6,
+    0x73, 0xD5, 0x0A, 0x41, 0xBC, 0x0A, 0x09, 0x51, 0xCC, 0x0A, 0x11, 0x51, 0x03, 0x19, 0xF9, 0x25,
+    0x0B, 0x09, 0x40, 0x3E, 0x42, 0x51, 0x9B, 0xC5, 0xD4, 0x0A, 0x85, 0xB2, 0x50, 0x90, 0x0B, 0x25,
+    0x29, 0xA1, 0x84, 0xD1, 0x37, 0xC5, 0xA4, 0x99, 0x5E, 0x63, 0x81, 0x75, 0x8F, 0xEB, 0xCE, 0x94,
+    0xCC, 0x84, 0x12, 0x9A, 0xD0, 0x52, 0xD3, 0x62, 0xD3, 0x72, 0xEB, 0x04, 0xD7, 0x49, 0x6E, 0x71,
+    0x2C, 0xBA, 0x9A, 0xAF, 0xAE, 0xCD, 0xF0, 0x4C, 0xCD, 0x56, 0x79, 0x3E, 0x2D, 0x42, 0xA2, 0x24,
+    0x17, 0x1F, 0x15, 0x87, 0x3C, 0x28, 0xA8, 0x8B, 0x56, 0x66, 0x5C, 0x1D, 0x8F, 0x01, 0x72, 0xC3,
+    0x2E, 0x35, 0xC7, 0xF3, 0x97, 0x3B, 0xE2, 0xE2, 0x32, 0x47, 0x5C, 0xD0, 0x53, 0x06, 0x3B, 0xE2,
+    0xC7, 0x63, 0x47, 0xDC, 0x4C, 0x1D, 0xB1, 0x66, 0x90, 0x26, 0xA3, 0xE2, 0x77, 0xA9, 0x30, 0x57,
+    0x1B, 0x61, 0xC2, 0xD6, 0x4B, 0xF9, 0x74, 0xDD, 0x05, 0x61, 0x1C, 0xF3, 0xF4, 0x92, 0x42, 0x27,
+    0x60, 0x5C, 0x7B, 0xE8, 0x5F, 0x6C, 0x40, 0x16, 0x73, 0xED, 0x82, 0x10, 0x5B, 0x2A, 0x7C, 0x8F,
+    0xD4, 0x1A, 0x89, 0xA4, 0x7E, 0xF1, 0x62, 0x14, 0xD4, 0x89, 0xC5, 0x64, 0x7D, 0x38, 0xEB, 0xBF,
+    0x3E, 0x16, 0x87, 0xA2, 0xAB, 0x1C, 0x10, 0xC5, 0xCA, 0x78, 0x2E, 0xC8, 0x86, 0x17, 0xC4, 0x92,
+    0x61, 0xAD, 0x18, 0x33, 0x58, 0x2B, 0xC3, 0xCB, 0x30, 0x0F, 0xD8, 0xA2, 0x5D, 0xE8, 0xAA, 0x25,
+    0xD6, 0xB5, 0xFB, 0x21, 0xDF, 0xE8, 0x89, 0x17, 0xC3, 0xB5, 0x37, 0x5A, 0x2A, 0xEF, 0xCC, 0xE1,
+    0xA9, 0x65, 0x9B, 0xF0, 0xE5, 0x16, 0xAF, 0x76, 0x20, 0xAC, 0xB4, 0x32, 0x7B, 0x7F, 0x16, 0x82,
+    0x58, 0x73, 0x78, 0x3B, 0x7F, 0xAE, 0xB5, 0xBA, 0xDB, 0xE4, 0xF4, 0x54, 0xB3, 0xFC, 0x36, 0xD3,
+    0x4C, 0x54, 0x5F, 0x6D, 0x3C, 0x59, 0xAA, 0xF2, 0x20, 0x87, 0xE3, 0x51, 0x7D, 0x2D, 0x40, 0x64,
+    0x11, 0x52, 0xE7, 0xCF, 0x8E, 0x52, 0xB2, 0x43, 0x9C, 0xD3, 0xC8, 0x04, 0xBF, 0x23, 0x29, 0xF4,
+    0x14, 0x3E, 0xEF, 0x16, 0xE8, 0x6D, 0xDC, 0x92, 0xE1, 0x4F, 0x11, 0xC7, 0xF5, 0x9B, 0x1D, 0xE3,
+    0xDA, 0xA0, 0xE6, 0x99, 0xAB, 0x83, 0x5F, 0xE7, 0x5F, 0x15, 0xBF, 0x32, 0x72, 0xD3, 0x4F, 0x4A,
+    0x72, 0x4A, 0xC3, 0x10, 0xD9, 0xA5, 0x91, 0x4C, 0x64, 0x1A, 0xF0, 0x1E, 0xB7, 0x6C, 0x83, 0xD4,
+    0x94, 0x25, 0xE5, 0x53, 0x1B, 0xC3, 0x1B, 0x5E, 0x79, 0xB7, 0xF1, 0xE1, 0xF5, 0x5B, 0x20, 0xAA,
+    0x16, 0x37, 0xDA, 0xEA, 0x66, 0x26, 0x1D, 0xF6, 0xCA, 0x0B, 0x55, 0x70, 0x53, 0x49, 0x33, 0x57,
+    0x4D, 0x74, 0xD4, 0xA4, 0x98, 0x3F, 0x9A, 0xBB, 0x08, 0x2E, 0x7F, 0xC1, 0x3B, 0xBD, 0xFC, 0x05,
+    0xEF, 0x95, 0x48, 0x41, 0x47, 0x05, 0xB6, 0x8A, 0x01, 0x54, 0x90, 0xA6, 0xF7, 0xD1, 0x78, 0xE3,
+    0x79, 0xA2, 0x18, 0xDA, 0xDE, 0xD8, 0x2D, 0xC3, 0x7B, 0xAB, 0x61, 0x2C, 0x5E, 0xAB, 0xB9, 0xD9,
+    0xAB, 0xB8, 0x91, 0x85, 0x6A, 0x52, 0x6E, 0xD8, 0x8A, 0xE0, 0x5D, 0x82, 0xA7, 0x6F, 0xAC, 0xAE,
+    0x11, 0x1A, 0x70, 0x8D, 0xB8, 0x86, 0xBC, 0xC3, 0x5C, 0x83, 0xDE, 0xA1, 0xDE, 0x69, 0xFE, 0xE6,
+    0xD1, 0xA8, 0x90, 0x28, 0x94, 0x16, 0xE9, 0xB8, 0x47, 0x07, 0x78, 0x6E, 0xAE, 0x5E, 0x7A, 0xE8,
+    0xD6, 0x03, 0x1A, 0xC0, 0xF8, 0x71, 0xCB, 0xCD, 0xE7, 0x35, 0x37, 0x34, 0x04, 0x37, 0x19, 0x37,
+    0xE7, 0x5A, 0x40, 0x57, 0x6A, 0x20, 0x15, 0x95, 0xF7, 0xA4, 0x08, 0x71, 0x12, 0x34, 0x81, 0xE2,
+    0x9A, 0xA5, 0x03, 0x5B, 0x59, 0xF2, 0xEB, 0x77, 0x7A, 0x9D, 0xBC, 0x7D, 0x30, 0xE6, 0x5D, 0x8B,
+    0xC8, 0x94, 0xE3, 0x9A, 0x8B, 0x4A, 0xF9, 0xD7, 0x5A, 0x46, 0xE6, 0x71, 0xA8, 0x84, 0x92, 0x8E,
+    0x73, 0x22, 0x1D, 0xE6, 0x99, 0x7A, 0x0B, 0x25, 0x9A, 0xAB, 0x8C, 0x3A, 0x7F, 0xA6, 0xB8, 0x53,
+    0xC6, 0x8A, 0xAC, 0x95, 0x9E, 0x44, 0x31, 0x6C, 0x40, 0x76, 0x06, 0x4B, 0x5B, 0x2C, 0x98, 0xAC,
+    0xB5, 0x5D, 0x55, 0x2A, 0x72, 0xA5, 0x93, 0xBA, 0x89, 0xC7, 0x1A, 0xC9, 0xE8, 0x50, 0x5C, 0xA2,
+    0xC4, 0xA5, 0x1E, 0xB3, 0x8A, 0x99, 0xCB, 0xCF, 0xAD, 0x6C, 0xB6, 0xC8, 0x92, 0xFF, 0x77, 0x20,
+    0x51, 0x6F, 0xEC, 0xD6, 0x6C, 0xB0, 0x45, 0x69, 0x3C, 0x5A, 0x7F, 0x3B, 0xD8, 0xBD, 0x76, 0xF8,
+    0x32, 0x9B, 0x90, 0x8B, 0x86, 0x75, 0x96, 0x03, 0x34, 0xE7, 0x2F, 0xFC, 0x98, 0x13, 0xDF, 0x8C,
+    0x67, 0x2C, 0xA3, 0x75, 0x47, 0x5E, 0x45, 0x5F, 0x03, 0xB4, 0x63, 0xA0, 0x97, 0x23, 0xB0, 0x99,
+    0xAF, 0x95, 0x85, 0x32, 0x67, 0xEE, 0x24, 0x68, 0xD7, 0x7F, 0x4D, 0x63, 0xB8, 0x2D, 0x76, 0xBE,
+    0xFC, 0xDE, 0x7C, 0x37, 0xA7, 0x84, 0x0D, 0xA4, 0xA7, 0xF6, 0xEC, 0x96, 0x2A, 0x90, 0x09, 0x44,
+    0x1B, 0x47, 0xD8, 0xEB, 0xE7, 0xEC, 0xA2, 0x45, 0xAF, 0xD4, 0xBF, 0xD3, 0xE2, 0x4F, 0x82, 0x21,
+    0x82, 0x48, 0x62, 0xD8, 0x58, 0xF9, 0x47, 0xE6, 0xFD, 0xEF, 0xBC, 0xED, 0xFE, 0x95, 0xEC, 0x51,
+    0x77, 0x59, 0xA5, 0x91, 0x8D, 0xE8, 0xEA, 0x6B, 0xE7, 0x57, 0x9E, 0x88, 0xB2, 0x03, 0x0E, 0xEA,
+    0xFE, 0x7F, 0x0F, 0x79, 0x0A, 0x91, 0xFA, 0xA7, 0xA7, 0x29, 0xDF, 0x5E, 0x4D, 0xBC, 0xF9, 0x25,
+    0xA7, 0x16, 0x7E, 0x45, 0x49, 0x07, 0x92, 0xB1, 0xCC, 0xA1, 0x9C, 0x24, 0xB5, 0x5B, 0x43, 0xC6,
+    0x96, 0x34, 0x51, 0x50, 0x85, 0x44, 0xE5, 0xCF, 0x89, 0xD1, 0xE4, 0x4F, 0xD8, 0xA5, 0xF8, 0x33,
+    0x2A, 0xC3, 0x8F, 0x4B, 0x04, 0x85, 0xC8, 0xB9, 0xC0, 0xAF, 0x83, 0x81, 0x6D, 0x55, 0x3C, 0xEE,
+    0x76, 0xF0, 0x79, 0x9F, 0x93, 0x01, 0x8E, 0x6A, 0x88, 0xA8, 0xD0, 0xEF, 0x73, 0x06, 0x9C, 0x66,
+    0x55, 0x73, 0x44, 0x6E, 0xF2, 0xF9, 0xC9, 0xE0, 0xFE, 0x26, 0x7D, 0x26, 0xE1, 0xB2, 0xF8, 0x57,
+    0x01, 0xA3, 0x13, 0x13, 0x8C, 0x41, 0x11, 0xC0, 0x5C, 0x04, 0xC8, 0x25, 0x09, 0x46, 0x2F, 0xF3,
+    0x47, 0xBA, 0xA8, 0xEA, 0x81, 0x16, 0x43, 0x61, 0xDE, 0x2F, 0x07, 0xBD, 0x76, 0x98, 0x46, 0xF9,
+    0xF0, 0x0F, 0x09, 0x2F, 0xCC, 0x57, 0x79, 0xAF, 0xB4, 0xE1, 0x3C, 0x0F, 0x35, 0x9E, 0x38, 0x63,
+    0xE5, 0x8B, 0x95, 0x2B, 0x56, 0x9E, 0x78, 0xE4, 0x88, 0x67, 0x8A, 0xF9, 0x50, 0x3C, 0x42, 0xED,
+    0x88, 0x4B, 0x47, 0x56, 0x99, 0x50, 0x5E, 0x98, 0x2D, 0xB2, 0x59, 0x21, 0xFD, 0x6F, 0xC5, 0x58,
+    0xBD, 0x8F, 0xDD, 0xC6, 0x11, 0x1F, 0x92, 0xBA, 0xA3, 0x71, 0x4C, 0x4C, 0x15, 0xBE, 0x20, 0xB0,
+    0xE1, 0xB0, 0x4A, 0x11, 0xC1, 0x31, 0x9B, 0x14, 0x2E, 0x2E, 0xB7, 0x94, 0x55, 0xA4, 0xD4, 0x15,
+    0xF7, 0xE2, 0x42, 0x85, 0x9A, 0x54, 0x2E, 0xE2, 0x14, 0x29, 0x05, 0x93, 0xB6, 0xFE, 0x81, 0xFB,
+    0x13, 0x54, 0x5C, 0x21, 0x5F, 0xA3, 0x2B, 0x85, 0x40, 0x01, 0xE9, 0xA8, 0x70, 0x91, 0x86, 0x8A,
+    0x21, 0xA4, 0x48, 0x43, 0x24, 0x70, 0x63, 0x17, 0xD9, 0x48, 0x04, 0xC4, 0x58, 0x24, 0x37, 0xBF,
+    0xDF, 0xF2, 0xE3, 0xBD, 0x3B, 0xE9, 0xCE, 0x4F, 0x96, 0x85, 0xF0, 0xBD, 0x1D, 0x7E, 0xCD, 0xCC,
+    0xCE, 0xCC, 0xCE, 0xD7, 0x52, 0x0A, 0x11, 0x2D, 0xB2, 0x23, 0xB9, 0x91, 0xE3, 0x1D, 0xB9, 0x75,
+    0x2C, 0xB7, 0x0A, 0xB9, 0x25, 0xDF, 0xFF, 0xBF, 0x27, 0x22, 0x85, 0x78, 0x99, 0x84, 0x22, 0xCA,
+    0x64, 0xAF, 0x7B, 0x99, 0xF7, 0x69, 0x26, 0x7F, 0xC9, 0xC4, 0x7D, 0x89, 0xBF, 0x93, 0x28, 0x53,
+    0xCD, 0x7F, 0x21, 0xE7, 0x13, 0xB7, 0x1F, 0x1E, 0x1D, 0x1D, 0x65, 0xB9, 0x31, 0xA6, 0x58, 0x02,
+    0xE1, 0xC1, 0x2B, 0x1C, 0xED, 0x59, 0x67, 0xE2, 0xF4, 0x92, 0x26, 0xFF, 0xCF, 0xF1, 0x99, 0x5C,
+    0x92, 0xED, 0xC5, 0x62, 0x4F, 0x41, 0x1E, 0x35, 0xCA, 0xC4, 0xE3, 0xD2, 0xD1, 0xD1, 0x6D, 0xDE,
+    0xE3, 0x7C, 0xE8, 0x36, 0x7E, 0x13, 0xD4, 0xA1, 0x8E, 0xB4, 0xAA, 0x54, 0x95, 0x96, 0xDB, 0x89,
+    0xDF, 0x06, 0x6D, 0xD8, 0x84, 0x75, 0xA4, 0xE3, 0x2A, 0x2E, 0x54, 0xB1, 0x2D, 0x69, 0x91, 0x96,
+    0xAA, 0x8A, 0x81, 0x13, 0xEA, 0xA0, 0xF6, 0x1A, 0x67, 0x3F, 0xAA, 0x63, 0x1D, 0x6B, 0xC5, 0x81,
+    0x37, 0x29, 0xB0, 0xF2, 0x22, 0x2D, 0xF2, 0x24, 0x4F, 0x8C, 0x18, 0xE8, 0xBD, 0x90, 0x7D, 0x50,
+    0xE5, 0x59, 0x5A, 0xE6, 0x05, 0xDF, 0x13, 0x8F, 0xFC, 0x38, 0x0F, 0x67, 0xF3, 0x9A, 0x40, 0x3B,
+    0xFB, 0xCE, 0x9E, 0x6C, 0x27, 0x30, 0x39, 0x0C, 0x1D, 0x97, 0xC3, 0x88, 0x8A, 0x61, 0x84, 0x85,
+    0xA8, 0x3B, 0xDF, 0x68, 0x48, 0x69, 0xC7, 0xEE, 0x9D, 0xAF, 0x35, 0x9F, 0x9D, 0x18, 0xD1, 0xA9,
+    0x31, 0xF1, 0x98, 0x06, 0xF9, 0x4E, 0x63, 0x03, 0xDE, 0x13, 0xC3, 0x1D, 0x23, 0x5C, 0x87, 0x1C,
+    0xA5, 0xE5, 0xF1, 0x8B, 0xEB, 0x0F, 0x0F, 0xC1, 0xBF, 0x9E, 0xC6, 0xC0, 0xBB, 0x1C, 0xF0, 0x56,
+    0x70, 0x7F, 0x7E, 0xF5, 0xC1, 0xEF, 0x56, 0xF1, 0x2E, 0x86, 0xC5, 0xC5, 0x81, 0xC7, 0x0A, 0x2E,
+    0xF9, 0xEF, 0x49, 0x60, 0x24, 0x36, 0x05, 0xBC, 0x27, 0x35, 0x7A, 0xF8, 0x2B, 0xFE, 0xCB, 0xC8,
+    0x14, 0x6E, 0x4F, 0xEB, 0xBF, 0x07, 0x89, 0x12, 0x51, 0x5A, 0x54, 0x0F, 0x6F, 0x2B, 0x95, 0x69,
+    0xAC, 0xB7, 0x89, 0xAA, 0x45, 0x65, 0x88, 0x17, 0xB9, 0x48, 0xAC, 0xB8, 0x4C, 0x75, 0xAE, 0x53,
+    0xAC, 0xCA, 0xC6, 0xB0, 0x68, 0x51, 0xE5, 0x74, 0xC0, 0xF1, 0x80, 0xD8, 0xF8, 0x26, 0x51, 0x35,
+    0x40, 0xAC, 0x5D, 0x03, 0x17, 0x86, 0xB1, 0xF9, 0x5E, 0xD5, 0xAA, 0x51, 0x58, 0x18, 0x3C, 0x10,
+    0x1B, 0x75, 0xF2, 0x52, 0xF1, 0xB6, 0x8C, 0x3A, 0x1B, 0x6F, 0x8C, 0x3C, 0xF7, 0xA5, 0xFF, 0x4E,
+    0x62, 0x4E, 0x1C, 0x6E, 0xB6, 0xDE, 0x8F, 0x74, 0x5F, 0x2D, 0x4A, 0xE1, 0xAF, 0x92, 0x17, 0xA3,
+    0x5B, 0x5C, 0x13, 0xDF, 0xFE, 0x82, 0x17, 0xA1, 0x93, 0xE5, 0xE1, 0x99, 0x44, 0x82, 0x7A, 0x58,
+    0x05, 0x53, 0x4A, 0xA8, 0x47, 0x9B, 0x68, 0xEB, 0x66, 0x38, 0xD2, 0xBF, 0x36, 0x5C, 0x3B, 0x9B,
+    0x17, 0xAE, 0xB4, 0x88, 0x00, 0x7B, 0x18, 0xB7, 0x75, 0xFA, 0xE9, 0xB2, 0xF3, 0xDA, 0xF9, 0xD2,
+    0x6F, 0xE6, 0xCB, 0x91, 0x97, 0x18, 0xAF, 0x8D, 0xCB, 0x0F, 0x45, 0xDE, 0x4C, 0xC8, 0x41, 0xDD,
+    0x37, 0x95, 0x03, 0x6F, 0x54, 0xFF, 0x68, 0xF2, 0xAB, 0x06, 0xCB, 0xDD, 0xC1, 0xA7, 0x74, 0x1F,
+    0x3F, 0x6D, 0xC3, 0xA7, 0x46, 0x42, 0xF3, 0x65, 0xAB, 0x3E, 0xEF, 0x23, 0x8D, 0xB5, 0xFF, 0x93,
+    0xDF, 0xA8, 0xC2, 0x44, 0x65, 0x0A, 0x79, 0x43, 0xAD, 0x32, 0x03, 0xBF, 0xC9, 0xE8, 0x0C, 0xE9,
+    0x74, 0xA9, 0x8A, 0xF9, 0x69, 0x9E, 0xCC, 0x97, 0xF0, 0x22, 0x90, 0x55, 0x79, 0x22, 0x2E, 0x78,
+    0xFF, 0xAD, 0x0F, 0xC1, 0x4C, 0xBC, 0x06, 0xFA, 0xB5, 0x81, 0xE9, 0xC9, 0x0B, 0xD6, 0x82, 0xB3,
+    0xB5, 0xD6, 0xB5, 0x1D, 0x68, 0x9D, 0x8F, 0x92, 0x5E, 0x40, 0x30, 0xC9, 0xA9, 0x83, 0xEF, 0xE1,
+    0x9D, 0xE3, 0xE1, 0x9B, 0x46, 0xBC, 0x39, 0xD9, 0x84, 0x10, 0x7E, 0x34, 0x1E, 0xED, 0xF7, 0xC8,
+    0x4C, 0xF6, 0xB3, 0x4E, 0x8E, 0x60, 0x29, 0xA6, 0x3B, 0x24, 0x91, 0x64, 0xB4, 0xE2, 0x78, 0x67,
+    0x64, 0xE5, 0xEE, 0x72, 0xBF, 0x7A, 0x77, 0xA5, 0x5D, 0xB9, 0x33, 0x7E, 0xFD, 0xE6, 0x81, 0x6C,
+    0x1E, 0x88, 0x73, 0x48, 0x9E, 0x50, 0xA6, 0x95, 0xB4, 0x87, 0xCD, 0x24, 0x7A, 0xD2, 0xC7, 0x5F,
+    0x1A, 0x24, 0x25, 0x93, 0xE4, 0xA6, 0x08, 0x90, 0x07, 0xBF, 0xE8, 0xCD, 0xFB, 0x26, 0x2F, 0x8C,
+    0xA9, 0x3C, 0x53, 0xE7, 0x57, 0xEB, 0xF4, 0x7E, 0x1B, 0x3F, 0x80, 0xFE, 0xF2, 0xFB, 0x0C, 0x50,
+    0x7D, 0xD1, 0x44, 0xFF, 0xEC, 0x28, 0xAF, 0xD7, 0xDA, 0xBB, 0xF0, 0x71, 0xCB, 0xE5, 0xF2, 0x9B,
+    0x50, 0xC7, 0x7F, 0x9F, 0xEE, 0x42, 0xBD, 0xFA, 0x2E, 0x2A, 0x87, 0xBB, 0x47, 0x96, 0x4E, 0x15,
+    0xB8, 0xBB, 0xDF, 0x8E, 0x5C, 0xF2, 0x24, 0x68, 0xD2, 0x9B, 0xAD, 0xA2, 0x50, 0xB4, 0xBA, 0x67,
+    0xCC, 0x65, 0x94, 0x10, 0xCC, 0x4E, 0xC3, 0x3B, 0x30, 0x35, 0x24, 0x53, 0xA8, 0x29, 0xB0, 0xBD,
+    0xA4, 0x8D, 0xC4, 0x9D, 0x84, 0xA3, 0x9E, 0x8E, 0x30, 0xB4, 0x19, 0x80, 0x69, 0x21, 0x26, 0x73,
+    0x0C, 0x8D, 0x8A, 0xF9, 0xC0, 0x08, 0xD9, 0x0E, 0x86, 0xDA, 0xA5, 0xE7, 0x15, 0xF0, 0x4D, 0xF3,
+    0x09, 0x3C, 0x01, 0x1E, 0x04, 0x04, 0xBC, 0xA7, 0xA8, 0x40, 0x8A, 0x4A, 0xA0, 0x01, 0x4B, 0x65,
+    0xA9, 0x00, 0xF5, 0xCF, 0x03, 0xF2, 0xFB, 0x60, 0x0E, 0x74, 0xE0, 0x92, 0x20, 0x68, 0x2C, 0x09,
+    0xF0, 0xAD, 0x7E, 0xA5, 0x25, 0x03, 0x0D, 0x09, 0x73, 0xB1, 0xA4, 0x9D, 0x25, 0x76, 0x20, 0x9D,
+    0x02, 0x43, 0x30, 0xAE, 0x29, 0x06, 0x17, 0xDB, 0xD8, 0x3C, 0x86, 0xE5, 0x0B, 0x4A, 0x55, 0xE6,
+    0x20, 0xD2, 0xAA, 0xC0, 0x6B, 0xB8, 0x0B, 0x4D, 0x07, 0x14, 0xAA, 0x64, 0x9C, 0x96, 0x68, 0x98,
+    0x15, 0xA5, 0x44, 0x80, 0x1A, 0x65, 0x44, 0x06, 0x2D, 0xD1, 0x41, 0x45, 0x02, 0xD0, 0x91, 0x84,
+    0x8E, 0xD6, 0xB1, 0x32, 0x58, 0x32, 0x52, 0x83, 0x90, 0xF4, 0x24, 0xED, 0x47, 0x62, 0x91, 0xB7,
+    0xB9, 0xE4, 0xD4, 0x86, 0x6E, 0x5C, 0x88, 0xF3, 0x04, 0x13, 0x3E, 0x82, 0x06, 0x65, 0x23, 0x41,
+    0x71, 0x4F, 0xC2, 0x6C, 0x57, 0x62, 0xFC, 0x76, 0x71, 0x25, 0xAF, 0x81, 0x38, 0x93, 0x1C, 0xC1,
+    0x54, 0x20, 0x71, 0x86, 0x4C, 0xA0, 0xB8, 0x93, 0x14, 0x91, 0xDB, 0xF0, 0x96, 0x91, 0x0D, 0x1E,
+    0x69, 0x25, 0x51, 0x02, 0xCF, 0x76, 0x6D, 0x21, 0xC1, 0xDD, 0xF4, 0x16, 0x56, 0x2A, 0x48, 0x90,
+    0x57, 0xAE, 0xC9, 0x7C, 0x70, 0x68, 0xC9, 0x21, 0x2D, 0x25, 0xC8, 0xB8, 0x3E, 0x93, 0xFB, 0x8B,
+    0xDB, 0x82, 0xDA, 0x2F, 0xBC, 0x5E, 0xDE, 0x85, 0x62, 0x7E, 0x2F, 0x79, 0x16, 0xB6, 0x5E, 0xE7,
+    0x9A, 0xC4, 0x33, 0x4E, 0x13, 0x74, 0x56, 0xD2, 0x98, 0xDE, 0xA1, 0x25, 0x67, 0xD9, 0x68, 0xF1,
+    0x8A, 0x89, 0x25, 0xB0, 0x51, 0x63, 0xFE, 0x5D, 0x5B, 0x2D, 0x51, 0x0D, 0x50, 0x2E, 0x43, 0x93,
+    0xA4, 0x55, 0xAA, 0x51, 0x48, 0x52, 0x94, 0x64, 0x16, 0x93, 0x72, 0x0B, 0xDE, 0xAB, 0x91, 0x1B,
+    0x5C, 0x73, 0x95, 0x7E, 0x1F, 0x74, 0x1E, 0x43, 0x03, 0x0C, 0xD9, 0x8D, 0x80, 0x21, 0xD8, 0x82,
+    0xE1, 0x1E, 0xC4, 0xC3, 0xAB, 0x16, 0x2F, 0xA3, 0x1A, 0x42, 0x98, 0x2C, 0x28, 0x71, 0x52, 0xE2,
+    0x26, 0x5E, 0x27, 0x3F, 0xA2, 0xA4, 0x87, 0x34, 0x1E, 0x4A, 0x07, 0x40, 0x30, 0x03, 0xFF, 0x04,
+    0xA0, 0xF8, 0x16, 0xC4, 0xDA, 0x3B, 0x05, 0x3A, 0x28, 0x77, 0x12, 0x54, 0x70, 0x86, 0x8D, 0xA1,
+    0x00, 0xCD, 0x21, 0x5E, 0xB9, 0xED, 0xC8, 0xB9, 0x99, 0xE6, 0xB0, 0xB4, 0xF0, 0xE6, 0xA1, 0x9A,
+    0xB8, 0x48, 0x09, 0xE9, 0xD0, 0x4D, 0xB1, 0xBA, 0x37, 0xB1, 0x81, 0xE0, 0xC6, 0x1F, 0x47, 0x80,
+    0x11, 0x41, 0x33, 0x24, 0x1C, 0x83, 0xB2, 0xC3, 0x6C, 0x94, 0xD7, 0x56, 0x4B, 0xC9, 0x8B, 0x61,
+    0xAC, 0x1E, 0xCC, 0x18, 0x48, 0x3F, 0xC2, 0x76, 0x8D, 0x03, 0xC1, 0xC2, 0x04, 0x85, 0xDE, 0xE6,
+    0xE8, 0x00, 0xCC, 0xED, 0x0C, 0x46, 0xF3, 0xF6, 0x96, 0xC5, 0xFF, 0x15, 0xC6, 0x8F, 0x51, 0x65,
+    0x65, 0x27, 0x02, 0xB8, 0xEB, 0x97, 0xE2, 0x69, 0xA7, 0xBF, 0x0C, 0xB2, 0x94, 0x53, 0x6D, 0x9A,
+    0x03, 0x3C, 0x5E, 0xD8, 0x54, 0x5F, 0xDB, 0x36, 0x4F, 0xBC, 0x9A, 0x21, 0x8E, 0x05, 0xD7, 0xEF,
+    0xE2, 0xF1, 0x0D, 0xD2, 0xFE, 0x92, 0x35, 0xFA, 0xB5, 0x21, 0x40, 0x03, 0xB6, 0x0C, 0x10, 0x22,
+    0x16, 0xB1, 0x21, 0x79, 0x03, 0x03, 0xBE, 0xEB, 0xC0, 0x8D, 0x3D, 0xC8, 0xE3, 0x97, 0x63, 0xB7,
+    0x92, 0x0C, 0x6E, 0x4B, 0x79, 0xA9, 0xC3, 0x93, 0x52, 0xDC, 0xFF, 0x68, 0xF1, 0xCA, 0x7A, 0x74,
+    0xDB, 0x5F, 0x4F, 0x6E, 0x6B, 0x4B, 0xCF, 0xF6, 0xAC, 0x60, 0x3E, 0xA7, 0xC4, 0x34, 0x79, 0xF6,
+    0x4A, 0x4D, 0x35, 0xEA, 0x40, 0x39, 0xC7, 0x63, 0xB5, 0x4A, 0xC7, 0x5C, 0xED, 0x1B, 0xB6, 0x34,
+    0xD3, 0xD5, 0x58, 0x74, 0x7E, 0x62, 0xBE, 0x4A, 0xA6, 0xB2, 0x36, 0x25, 0xE2, 0xE0, 0x69, 0x33,
+    0x2D, 0xDE, 0xE3, 0x29, 0x8D, 0xAB, 0x07, 0x53, 0xF6, 0xB5, 0x39, 0x06, 0xC7, 0xD6, 0x2D, 0x3F,
+    0xFB, 0xA3, 0x7B, 0x5B, 0x64, 0xC8, 0xE0, 0x7E, 0x3B, 0x5D, 0x31, 0x54, 0x25, 0x38, 0x75, 0x85,
+    0x89, 0x3F, 0xFE, 0x4D, 0xF5, 0x91, 0xEC, 0x5E, 0xA9, 0x3F, 0x4A, 0xD8, 0x15, 0x0B, 0x17, 0x22,
+    0x7B, 0xDE, 0x95, 0x28, 0xCB, 0x8A, 0x79, 0x2F, 0x25, 0x88, 0x39, 0x9F, 0x41, 0x6D, 0x92, 0x14,
+    0x96, 0xF2, 0x3A, 0xE4, 0x07, 0xC7, 0x20, 0xF7, 0x04, 0x2D, 0x5A, 0x2C, 0xAF, 0x0F, 0x6D, 0x8E,
+    0x43, 0xC5, 0x69, 0x7D, 0x4C, 0xF2, 0x87, 0x2D, 0x50, 0xFC, 0xD4, 0x4B, 0xB0, 0x7C, 0xE5, 0xFC,
+    0x1F, 0x95, 0x29, 0x6D, 0x75, 0x98, 0xEC, 0x45, 0x7D, 0x5C, 0xAA, 0x67, 0x8B, 0x93, 0x95, 0x32,
+    0xAA, 0x66, 0x8C, 0x6C, 0xC4, 0x70, 0x96, 0x18, 0xF5, 0xA4, 0xA0, 0xAD, 0x51, 0x6A, 0xC6, 0xE8,
+    0x27, 0x0C, 0x7F, 0x89, 0x31, 0x4F, 0x85, 0xC6, 0x6B, 0xFC, 0x7F, 0xCD, 0xA5, 0x3B, 0xF3, 0x3F,
+    0xA3, 0x3D, 0x5C, 0x0B, 0x6D, 0x7B, 0xC1, 0x26, 0x6C, 0xF8, 0x5F, 0x32, 0xE7, 0x10, 0x64, 0x33,
+    0xDA, 0x76, 0xBE, 0x1E, 0xDA, 0x62, 0x76, 0x35, 0x17, 0x11, 0xB0, 0x39, 0x04, 0x67, 0x39, 0x05,
+    0xE8, 0x18, 0x42, 0x6D, 0xCA, 0x40, 0x4D, 0xA2, 0x76, 0x37, 0x89, 0xDB, 0x0B, 0x58, 0x0A, 0x26,
+    0x31, 0x99, 0xCF, 0x76, 0x60, 0xF1, 0x63, 0x66, 0x6D, 0xC6, 0x8D, 0xB6, 0xD1, 0xE8, 0x21, 0x3F,
+    0xF9, 0x18, 0x21, 0x13, 0x3E, 0xCC, 0xA6, 0xC6, 0xD7, 0xA8, 0x25, 0xCC, 0xA2, 0xD6, 0x62, 0xB4,
+    0xFC, 0xD0, 0x9D, 0x0C, 0x5E, 0xBF, 0x2D, 0xCF, 0x1E, 0x6A, 0xC4, 0xB1, 0x41, 0x5E, 0x3E, 0x7B,
+    0x4E, 0xC7, 0xC4, 0xC0, 0xCE, 0x64, 0x63, 0x55, 0x9B, 0xB0, 0xA3, 0x2E, 0x61, 0x47, 0x4D, 0xC2,
+    0x8E, 0x7A, 0x84, 0x1D, 0xB5, 0x08, 0xAD, 0x0E, 0x83, 0x06, 0x83, 0xFC, 0x84, 0x71, 0x43, 0x98,
+    0x6B, 0x40, 0x48, 0x0E, 0xDD, 0x20, 0x37, 0x20, 0xA4, 0x26, 0x44, 0xD6, 0x6F, 0x28, 0x31, 0x20,
+    0x64, 0x41, 0xA5, 0x85, 0xA4, 0xCE, 0xDE, 0x69, 0x39, 0xF1, 0x1C, 0x52, 0xA1, 0x7A, 0x00, 0x46,
+    0xDD, 0x78, 0x0D, 0xF9, 0xC0, 0x61, 0x63, 0x89, 0xAF, 0x6A, 0x27, 0xEF, 0xD1, 0xC4, 0xC7, 0xE8,
+    0x04, 0x14, 0xB7, 0x14, 0x8D, 0xBD, 0xEE, 0x54, 0x1D, 0x1E, 0x84, 0xBD, 0xAA, 0x2F, 0xC0, 0xCF,
+    0x15, 0x33, 0x88, 0x85, 0x7E, 0xCF, 0xBD, 0x45, 0x48, 0xF7, 0x47, 0x93, 0x10, 0x33, 0xD9, 0x63,
+    0x3B, 0x86, 0x0E, 0x2D, 0x61, 0x45, 0x66, 0x2E, 0xE6, 0xE6, 0x23, 0xB2, 0xFD, 0x28, 0x5C, 0x1A,
+    0xEE, 0x8A, 0x9C, 0xBC, 0x91, 0x9C, 0x10, 0x8D, 0xCF, 0x4B, 0x5B, 0xBD, 0x34, 0x15, 0x4A, 0xEB,
+    0xF1, 0x1A, 0x84, 0xD8, 0x20, 0x39, 0x4B, 0xFC, 0x7C, 0x0A, 0x4E, 0x0B, 0x92, 0xED, 0xC5, 0x6F,
+    0xE9, 0xF4, 0x1E, 0xC3, 0x22, 0x98, 0x43, 0x9E, 0x7B, 0x2A, 0x6B, 0x75, 0x61, 0xAC, 0xBA, 0xC4,
+    0xF0, 0x89, 0x41, 0x1F, 0xA0, 0x20, 0x23, 0x06, 0xD7, 0xC4, 0x19, 0x2A, 0x1D, 0x57, 0x76, 0x01,
+    0x57, 0x4B, 0x99, 0x93, 0x00, 0x7A, 0xF9, 0xF8, 0x0E, 0xD8, 0xDF, 0x08, 0xE1, 0x67, 0x04, 0x25,
+    0x41, 0x75, 0x2E, 0x28, 0x67, 0xE4, 0x0C, 0xA0, 0x17, 0x80, 0x1A, 0x00, 0x7E, 0xF1, 0x32, 0x60,
+    0xE5, 0xA0, 0x97, 0x78, 0x74, 0xF8, 0x90, 0x20, 0x32, 0xE6, 0x53, 0xBA, 0xFE, 0x5A, 0x20, 0x26,
+    0x00, 0xD9, 0x37, 0x9A, 0xB9, 0x56, 0x3B, 0x04, 0xB2, 0x39, 0x15, 0x1D, 0xBB, 0xB7, 0x54, 0x53,
+    0xC2, 0x2B, 0x76, 0xA9, 0x0C, 0x41, 0x45, 0xA0, 0xCF, 0x05, 0x16, 0xA5, 0x54, 0xB0, 0x55, 0x41,
+    0xDA, 0xC4, 0x6E, 0xE4, 0x2F, 0x1D, 0x7D, 0x06, 0xA3, 0x3A, 0xFB, 0x53, 0x22, 0x5A, 0x02, 0x17,
+    0x0B, 0xF0, 0xB6, 0xDB, 0x6C, 0x66, 0xF1, 0xB7, 0xDF, 0x32, 0xBC, 0x47, 0xB2, 0xC2, 0xB9, 0x6E,
+    0xF6, 0x59, 0xD3, 0x58, 0x85, 0xD8, 0x34, 0x98, 0xEB, 0xF4, 0x22, 0x2C, 0x97, 0xDB, 0xB3, 0x87,
+    0x7D, 0xC7, 0x1B, 0x2D, 0xB1, 0x89, 0x4D, 0x25, 0xB6, 0x91, 0x70, 0x47, 0x6E, 0x7D, 0x9F, 0x89,
+    0x43, 0x6D, 0xBF, 0x02, 0xD4, 0x41, 0xE3, 0xB7, 0x5E, 0x8B, 0x54, 0xB9, 0xBF, 0x7E, 0xAD, 0x7C,
+    0xF5, 0xC7, 0x3A, 0xA5, 0xFD, 0x55, 0xD8, 0xEC, 0xD5, 0x30, 0xB5, 0x05, 0x25, 0xAC, 0xF2, 0x0A,
+    0x3B, 0x1A, 0xB4, 0xC8, 0x39, 0xB6, 0x74, 0xD8, 0xE9, 0x0C, 0x35, 0x88, 0x65, 0x8C, 0xB3, 0x0C,
+    0x9B, 0x91, 0xF1, 0xF3, 0xC3, 0x98, 0x4F, 0x99, 0x47, 0xCD, 0x50, 0xA5, 0x88, 0xC2, 0xC1, 0x4A,
+    0x86, 0xFE, 0xBE, 0xC0, 0xB6, 0x90, 0x5D, 0xB7, 0x4E, 0xB3, 0x5C, 0x63, 0xAF, 0x55, 0xDA, 0x64,
+    0xB9, 0xB1, 0x3F, 0xEE, 0xE1, 0xCC, 0x7F, 0x41, 0x79, 0x0F, 0x9B, 0x64, 0xD3, 0x1F, 0xF8, 0x68,
+    0xCA, 0xEC, 0xA1, 0x55, 0xE2, 0xDC, 0xA1, 0xDC, 0xF7, 0x80, 0x73, 0xCD, 0x74, 0x2B, 0xE6, 0x7E,
+    0x03, 0xE3, 0xAD, 0x79, 0xE1, 0xB1, 0x77, 0x2C, 0xD0, 0x15, 0xBB, 0xFA, 0x67, 0xF3, 0xC2, 0xBF,
+    0x61, 0x17, 0xDE, 0x65, 0x08, 0x78, 0xCC, 0x62, 0x9E, 0x3E, 0x96, 0xE8, 0xFE, 0x23, 0xA4, 0xD5,
+    0x27, 0x68, 0x38, 0x3C, 0x63, 0xB3, 0x37, 0x5B, 0x3C, 0x26, 0x9B, 0x25, 0x00, 0x3F, 0x76, 0xBA,
+    0x30, 0x4E, 0xF0, 0x14, 0x41, 0x14, 0xFD, 0xEB, 0x31, 0xDA, 0xDA, 0x9B, 0xBA, 0x16, 0xC7, 0xD3,
+    0x23, 0x2B, 0x1C, 0xD6, 0xE4, 0x66, 0xDC, 0x9D, 0xA3, 0xC8, 0x4C, 0x49, 0x46, 0x6E, 0x3F, 0xD7,
+    0x37, 0xEC, 0x86, 0x3E, 0xB6, 0x89, 0xA9, 0x99, 0x01, 0xCB, 0xF7, 0xD6, 0xC1, 0xD9, 0x0E, 0x75,
+    0xE6, 0x1C, 0x77, 0x91, 0xC7, 0x3E, 0x37, 0x76, 0x9F, 0x63, 0x6E, 0xA2, 0x21, 0x51, 0xD8, 0x61,
+    0xF8, 0x6D, 0xA4, 0xD3, 0xC2, 0x6E, 0x1B, 0x4B, 0x93, 0xF8, 0x0D, 0x8C, 0xFD, 0x49, 0xCF, 0x4D,
+    0x79, 0xC1, 0xED, 0x56, 0x54, 0xA4, 0x97, 0x3B, 0x9F, 0x9F, 0x78, 0x7A, 0xAF, 0x41, 0x68, 0xED,
+    0x4A, 0xEB, 0xE9, 0xB0, 0x98, 0x66, 0x99, 0x18, 0x0F, 0x33, 0x8D, 0x73, 0xCD, 0x0F, 0xCF, 0xD0,
+    0xE9, 0x94, 0x76, 0x1B, 0xC9, 0xA0, 0x5F, 0x65, 0x95, 0xC3, 0x4A, 0x8F, 0xA7, 0xDA, 0x06, 0xAE,
+    0xD5, 0xF3, 0xAD, 0xEC, 0x3B, 0x18, 0xAD, 0x21, 0xCB, 0x5D, 0x3B, 0xD5, 0x7A, 0xF3, 0x6D, 0xFD,
+    0x00, 0xF3, 0xAD, 0xA7, 0xBB, 0x9C, 0x27, 0x4B, 0x30, 0xE9, 0x3E, 0x7D, 0x24, 0x8B, 0xB4, 0x93,
+    0x9C, 0xCD, 0xF1, 0x79, 0x58, 0xB6, 0x3F, 0xB4, 0xDB, 0x2D, 0xFB, 0xB5, 0x43, 0x86, 0xBE, 0x63,
+    0xEA, 0xCE, 0x2F, 0x9C, 0x23, 0xDF, 0x26, 0x30, 0x0E, 0x29, 0x9E, 0xFD, 0x74, 0x27, 0xFE, 0x0C,
+    0x6B, 0x3E, 0x09, 0xD0, 0xC7, 0x36, 0xDF, 0x99, 0xD9, 0xCE, 0x9F, 0x7D, 0xE8, 0x78, 0xDC, 0x76,
+    0x79, 0x72, 0x1B, 0xB7, 0x05, 0x5B, 0xBF, 0x77, 0xB9, 0x19, 0x0C, 0x8C, 0xDB, 0xFA, 0xF3, 0xC9,
+    0xEF, 0xEC, 0x43, 0x39, 0x04, 0xE6, 0xE1, 0x29, 0xBA, 0xF1, 0x34, 0x7C, 0xC4, 0xD6, 0xE6, 0xC4,
+    0x69, 0x7C, 0xF8, 0x5C, 0x02, 0xD9, 0xC3, 0x69, 0x7F, 0x60, 0xDD, 0x9F, 0x9A, 0x2F, 0xE8, 0xED,
+    0x89, 0x22, 0xD9, 0xEE, 0xFB, 0x24, 0xF9, 0x64, 0xF2, 0xA1, 0xE8, 0x34, 0x91, 0x5E, 0x3E, 0x0B,
+    0xAB, 0xE9, 0xD9, 0x72, 0x19, 0x82, 0xD2, 0x2E, 0x4D, 0x13, 0xD7, 0x9B, 0xD9, 0xC6, 0x58, 0xAA,
+    0x62, 0xEB, 0x6B, 0xC1, 0xC1, 0xF8, 0xC6, 0x62, 0xCF, 0x4B, 0x58, 0xD1, 0x41, 0xA6, 0x92, 0x16,
+    0x1C, 0x18, 0xF3, 0xC1, 0xC3, 0xE1, 0x0B, 0x9F, 0x57, 0xBC, 0xE0, 0xD7, 0xC7, 0x6B, 0xA5, 0xCF,
+    0x5F, 0xF5, 0x42, 0x5F, 0x11, 0xF3, 0x5E, 0xB5, 0xE8, 0x2A, 0x75, 0x50, 0x79, 0xC5, 0xBA, 0x54,
+    0xC3, 0xD7, 0x47, 0x27, 0xF1, 0x0A, 0xBF, 0x0C, 0x75, 0x54, 0xAB, 0x36, 0xEF, 0xD7, 0xA7, 0x74,
+    0xB3, 0xA0, 0x7A, 0xE7, 0xBD, 0xE3, 0xD7, 0x77, 0x76, 0x42, 0xBD, 0xFE, 0x9C, 0xD0, 0x30, 0xFB,
+    0x20, 0xFB, 0x3E, 0x96, 0xF9, 0x1F, 0xED, 0x94, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x86, 0x7F, 0x9F,
+    0x49, 0x2C, 0xB8, 0xC2, 0x69, 0xAE, 0x80, 0x82, 0xA3, 0x0C, 0x05, 0xDA, 0x27, 0x80, 0x75, 0x78,
+    0x01, 0x28, 0xEE, 0x84, 0x44, 0x5E, 0x20, 0xA4, 0xC9, 0x13, 0x70, 0x6B, 0xF1, 0x04, 0xA9, 0x92,
+    0x22, 0x05, 0x0D, 0xD5, 0xE5, 0x09, 0x28, 0x38, 0xDF, 0x55, 0xB4, 0x86, 0x48, 0xD0, 0x5A, 0x42,
+    0x4A, 0x24, 0x52, 0xE0, 0xC2, 0x12, 0x26, 0x59, 0xEF, 0xF0, 0xAF, 0x1D, 0x25, 0x24, 0x44, 0x48,
+    0x94, 0x48, 0xEC, 0xCE, 0xFA, 0xBC, 0xEB, 0xD9, 0xD9, 0xD9, 0x99, 0x6F, 0x0E, 0x03, 0x84, 0x52,
+    0xC4, 0x52, 0x2B, 0xB1, 0xFA, 0xC0, 0xE9, 0x85, 0x33, 0x73, 0xE9, 0x44, 0x53, 0x16, 0xC2, 0xC5,
+    0xA1, 0x58, 0x2A, 0x50, 0x0D, 0x03, 0x3C, 0x40, 0x06, 0x03, 0xE0, 0x3E, 0x9F, 0xBF, 0xF7, 0x01,
+    0xDA, 0x16, 0x57, 0x80, 0xE2, 0x30, 0x1C, 0x52, 0xA1, 0xF7, 0xBD, 0x42, 0x74, 0x54, 0x21, 0x7E,
+    0x5F, 0x41, 0x45, 0x15, 0xCC, 0xFA, 0x0F, 0x64, 0x22, 0x89, 0x1F, 0x9B, 0xFB, 0x27, 0x00, 0xD7,
+    0xDA, 0xD1, 0x35, 0x2D, 0x85, 0x97, 0xE9, 0xB6, 0x06, 0x1E, 0xD1, 0x88, 0x24, 0x46, 0x8A, 0xDB,
+    0x5B, 0xB4, 0x51, 0x23, 0xAC, 0x93, 0xA8, 0x7E, 0xBB, 0x55, 0x66, 0x52, 0x70, 0x3D, 0x78, 0x0A,
+    0x04, 0x23, 0x64, 0x36, 0xA4, 0x87, 0x6E, 0x34, 0x2C, 0xA0, 0xE7, 0xD0, 0xAF, 0x4B, 0x2D, 0xD6,
+    0x1C, 0x3A, 0x9D, 0x88, 0x97, 0x54, 0xD4, 0xA1, 0x8B, 0xC5, 0xF6, 0xA4, 0xEC, 0xFC, 0xD3, 0x22,
+    0x9D, 0x00, 0x0D, 0x7A, 0x16, 0x61, 0x85, 0x7E, 0x89, 0xB8, 0x80, 0xE2, 0xE6, 0x94, 0xF7, 0x83,
+    0xA0, 0xD7, 0x20, 0xB4, 0xAD, 0x37, 0x63, 0x44, 0x52, 0x32, 0x02, 0xEA, 0x63, 0xA3, 0xD2, 0x46,
+    0x2D, 0x18, 0x8A, 0xAA, 0x8B, 0x98, 0xFE, 0xDC, 0x1D, 0x91, 0xE9, 0x0F, 0x8E, 0xD1, 0xEB, 0xD3,
+    0xFE, 0xB8, 0xD3, 0xCF, 0x87, 0xFC, 0x7A, 0x64, 0x75, 0xEA, 0x0C, 0xBF, 0xA6, 0xA2, 0x3F, 0x89,
+    0x12, 0x89, 0xAC, 0xF3, 0x27, 0x86, 0xF6, 0xE6, 0x56, 0x1D, 0x4B, 0x19, 0x4B, 0xBA, 0x34, 0x42,
+    0x50, 0x22, 0xA8, 0xCE, 0x44, 0xA4, 0xA4, 0x9C, 0x4F, 0x83, 0x36, 0x22, 0xDD, 0xE2, 0xF9, 0xCB,
+    0x60, 0x9C, 0xFC, 0xBA, 0xC8, 0xB8, 0x15, 0xF1, 0x5C, 0x25, 0x1A, 0x13, 0xBC, 0x63, 0xB7, 0x67,
+    0xBD, 0xE1, 0xFB, 0x04, 0x1A, 0x2A, 0x89, 0xE7, 0xFD, 0xDC, 0xC7, 0xC9, 0xCF, 0x86, 0xA9, 0x9F,
+    0x45, 0x45, 0x58, 0x5E, 0xF4, 0xA8, 0xE8, 0xE7, 0xF1, 0xDC, 0xDB, 0x98, 0x60, 0x84, 0xD5, 0x3B,
+    0xDB, 0x2F, 0xA5, 0x36, 0xA7, 0xD6, 0xA4, 0x8D, 0x81, 0x33, 0x98, 0x5D, 0x91, 0x01, 0x95, 0xFE,
+    0x12, 0x19, 0xDF, 0x32, 0x6E, 0xC1, 0x50, 0x98, 0x76, 0x98, 0x0C, 0xAB, 0x24, 0xC8, 0xF8, 0xC5,
+    0x6B, 0xA4, 0x0D, 0x79, 0xDF, 0x23, 0x50, 0xA9, 0x6F, 0xF6, 0x16, 0xB3, 0x40, 0x61, 0xE6, 0xE3,
+    0x12, 0x3A, 0x87, 0x24, 0x61, 0xE3, 0xF1, 0xD2, 0xD2, 0x74, 0xF2, 0x8B, 0x7E, 0x3D, 0xDC, 0xB3,
+    0x37, 0x02, 0xEB, 0x53, 0xBA, 0x5E, 0xF5, 0x64, 0xDE, 0x23, 0x7A, 0xCB, 0x54, 0x70, 0x2B, 0x70,
+    0x7A, 0x9F, 0xCA, 0x56, 0xD1, 0x9F, 0xF1, 0x7F, 0x44, 0xFF, 0x6D, 0x44, 0x83, 0x2C, 0xEF, 0x13,
+    0xAD, 0x1D, 0xEB, 0x3D, 0x7D, 0xDE, 0xC4, 0xC4, 0x20, 0x6F, 0x74, 0xD2, 0xE8, 0x35, 0xCF, 0x43,
+    0xEC, 0x1E, 0xD2, 0x54, 0xCF, 0x25, 0x43, 0xE6, 0x67, 0xB7, 0x9A, 0x05, 0xB5, 0x9B, 0x5A, 0x11,
+    0xEB, 0xA6, 0x6F, 0x78, 0x35, 0x93, 0xAC, 0x90, 0xAB, 0x2E, 0x0C, 0xAD, 0x4E, 0xA9, 0x77, 0xEB,
+    0x2C, 0xB0, 0x0D, 0x9A, 0x4E, 0x66, 0x68, 0xCC, 0x63, 0x72, 0x42, 0x9D, 0x9C, 0x67, 0x6D, 0x62,
+    0x0A, 0xBD, 0x20, 0x71, 0x07, 0x35, 0xA2, 0xD3, 0x12, 0xA4, 0x8A, 0x37, 0x4B, 0xDB, 0x5F, 0x0F,
+    0x77, 0xFC, 0x85, 0xB8, 0x2C, 0x2C, 0x61, 0xEE, 0xC8, 0x5D, 0x16, 0xDA, 0xAC, 0xEE, 0x3E, 0xA3,
+    0x6F, 0x3C, 0x2D, 0x3B, 0x4B, 0x23, 0x66, 0x4C, 0xCB, 0x79, 0x39, 0x74, 0xEC, 0x9F, 0x89, 0xCA,
+    0x0D, 0x41, 0x38, 0x6A, 0x4C, 0x72, 0x7D, 0xB9, 0xA1, 0x55, 0xBB, 0x32, 0xA6, 0x30, 0x64, 0xC2,
+    0x90, 0x08, 0x43, 0x1E, 0x58, 0x4F, 0x04, 0xD0, 0x8F, 0x14, 0xE6, 0x49, 0x0E, 0xE3, 0xF1, 0xF5,
+    0xDF, 0xC9, 0x88, 0x6F, 0xE6, 0x72, 0xC3, 0x86, 0xCA, 0xB3, 0x74, 0x22, 0xA7, 0x52, 0x9A, 0x63,
+    0xD9, 0xAB, 0xCC, 0x9A, 0x0B, 0x6B, 0x83, 0xA6, 0xC7, 0x87, 0xFD, 0xC3, 0xA3, 0xB5, 0xB5, 0xA1,
+    0x8A, 0xC9, 0x85, 0xBF, 0xB3, 0x6B, 0xFD, 0x7D, 0xA1, 0xF2, 0x89, 0x54, 0xE6, 0xD8, 0x5E, 0xBE,
+    0x93, 0x33, 0xAF, 0xAC, 0xE1, 0x5F, 0x4B, 0x56, 0x98, 0xA5, 0x4B, 0x31, 0x58, 0x96, 0xD4, 0xE7,
+    0x6A, 0x67, 0xAE, 0x13, 0xA8, 0x9A, 0xA5, 0x4C, 0xBE, 0x0B, 0xE2, 0x7E, 0x2F, 0x2A, 0xDB, 0x32,
+    0x4B, 0x59, 0x3E, 0x6C, 0x61, 0x8E, 0x28, 0xC7, 0xF0, 0x84, 0x95, 0x96, 0x6E, 0x7D, 0x4D, 0xE2,
+    0x1C, 0x97, 0xA4, 0xF0, 0x1B, 0x43, 0xEE, 0x1D, 0xE1, 0x27, 0x9D, 0x58, 0x3D, 0x8C, 0xDC, 0xC6,
+    0x15, 0x1E, 0x2E, 0x23, 0x2D, 0x20, 0x02, 0xA1, 0x0B, 0x19, 0x81, 0x60, 0xC0, 0x6C, 0xED, 0x04,
+    0x08, 0xEB, 0x00, 0xBA, 0x1B, 0xC2, 0x8D, 0x0A, 0x37, 0x57, 0x68, 0xA3, 0xC2, 0x85, 0x9A, 0xA4,
+    0xB0, 0x04, 0xE4, 0x52, 0x07, 0x92, 0xB8, 0x81, 0x8A, 0x14, 0x69, 0x04, 0x03, 0xE9, 0xAF, 0x50,
+    0x80, 0x60, 0x55, 0x5C, 0x8A, 0x14, 0x29, 0x14, 0x91, 0x27, 0x15, 0x2A, 0x4D, 0x27, 0x50, 0x5C,
+    0x8A, 0x0A, 0xCE, 0x70, 0x70, 0x2A, 0x6E, 0x9C, 0xD0, 0x16, 0x6F, 0xC5, 0xE5, 0xCB, 0xF7, 0xBD,
+    0x21, 0xEF, 0xF6, 0x24, 0x25, 0x0E, 0xBC, 0x00, 0xBF, 0x8F, 0x9C, 0xFF, 0x79, 0xEF, 0xCD, 0x7B,
+    0x6F, 0xD6, 0x18, 0xFE, 0x52, 0x99, 0x9B, 0x40, 0xA4, 0x32, 0x53, 0x91, 0xD2, 0xC4, 0x82, 0xCF,
+    0xB4, 0x0B, 0x32, 0x63, 0x1D, 0x2A, 0x6D, 0x4D, 0xA8, 0x7E, 0xB8, 0xD8, 0xC9, 0xAB, 0x5C, 0x1A,
+    0x05, 0xAB, 0x50, 0xE7, 0x25, 0x9A, 0x00, 0x92, 0xBE, 0x78, 0xB2, 0x85, 0x6E, 0xE2, 0x42, 0x82,
+    0x29, 0x08, 0x01, 0xCA, 0x8C, 0x41, 0xED, 0x08, 0x28, 0x03, 0x34, 0xEB, 0x70, 0x06, 0x93, 0x98,
+    0xF8, 0x12, 0xAA, 0x93, 0xA8, 0x44, 0x0F, 0x4E, 0x2C, 0xA8, 0xC0, 0x28, 0x8D, 0x0E, 0x15, 0x4B,
+    0x97, 0xD6, 0xE9, 0xEA, 0xFE, 0xA6, 0xB1, 0x4D, 0xBB, 0x61, 0x72, 0xD7, 0x5C, 0x34, 0x45, 0xE5,
+    0x6E, 0x18, 0xF9, 0xCC, 0xDD, 0x37, 0xF2, 0xD0, 0xB5, 0x46, 0x1E, 0xD5, 0xE8, 0xF0, 0xA8, 0xC2,
+    0xB4, 0x7F, 0xDB, 0x03, 0x7C, 0xF9, 0xD0, 0x99, 0xFC, 0xE5, 0xA3, 0xDA, 0x58, 0xB9, 0x5D, 0x99,
+    0x44, 0x6E, 0xEF, 0xDD, 0xE1, 0xD2, 0x2A, 0x8E, 0x57, 0x71, 0x69, 0x15, 0x6A, 0x24, 0x33, 0x1B,
+    0x09, 0xE6, 0xBE, 0x98, 0x60, 0x65, 0x37, 0x7E, 0x6C, 0x86, 0xDF, 0x59, 0x39, 0x32, 0xAC, 0x2D,
+    0x21, 0x0D, 0x29, 0xD9, 0x23, 0x8B, 0x65, 0xFE, 0x8E, 0x49, 0x56, 0x94, 0x41, 0x4B, 0xA0, 0x48,
+    0x72, 0x8A, 0xA4, 0xA8, 0xDE, 0x3F, 0x37, 0x2F, 0xAA, 0xDC, 0x96, 0x52, 0xE6, 0x05, 0x41, 0x4A,
+    0xA9, 0xF2, 0xA3, 0x0C, 0x65, 0xB5, 0x29, 0x28, 0x9C, 0xDC, 0x8D, 0x12, 0xB2, 0x9D, 0x17, 0xD3,
+    0x5E, 0xC6, 0xB5, 0xCC, 0x39, 0xF2, 0xDC, 0x28, 0x24, 0xD2, 0x63, 0xB0, 0xB7, 0x8D, 0x09, 0xC7,
+    0x29, 0xAB, 0x75, 0x98, 0xCD, 0xB2, 0x50, 0x0C, 0x6B, 0xDF, 0x04, 0xE3, 0x50, 0xEB, 0x70, 0xAA,
+    0x49, 0x4E, 0x85, 0x2A, 0x5C, 0x97, 0xC5, 0xFC, 0x8D, 0xA3, 0xAC, 0xED, 0x3C, 0xE5, 0x82, 0x20,
+    0x21, 0xC3, 0xA5, 0x99, 0x89, 0x94, 0x17, 0x00, 0x90, 0xD2, 0x84, 0xED, 0x14, 0xAE, 0xC8, 0xEF,
+    0xB6, 0xBC, 0x7A, 0x15, 0xF4, 0x53, 0x2B, 0xAE, 0xCB, 0xC1, 0xCE, 0x5A, 0xC5, 0xC9, 0xF0, 0x11,
+    0x45, 0x97, 0x52, 0x74, 0x05, 0x77, 0xF4, 0x0A, 0x98, 0xB5, 0x5F, 0x5C, 0x7A, 0x4E, 0xE7, 0x9E,
+    0xAD, 0xE2, 0x85, 0xAC, 0xF8, 0x18, 0x7D, 0x7F, 0x23, 0xAD, 0x08, 0xC4, 0xFA, 0x14, 0xBD, 0xA4,
+    0xD3, 0xB1, 0x44, 0x56, 0xE0, 0x5D, 0xE9, 0xB7, 0xC5, 0x14, 0x6D, 0x28, 0x2E, 0x02, 0xBB, 0x80,
+    0x52, 0x83, 0xF8, 0x03, 0x0A, 0x13, 0x6C, 0x3C, 0x57, 0x23, 0x0F, 0xE5, 0xD5, 0x64, 0xE0, 0x70,
+    0xE0, 0x68, 0xE0, 0x78, 0xE0, 0x74, 0x60, 0x3B, 0x70, 0x31, 0x70, 0xAF, 0x6C, 0x82, 0xCE, 0x2F,
+    0x32, 0x6C, 0x3C, 0x4F, 0x9D, 0xE7, 0x73, 0x77, 0x94, 0xB0, 0xEB, 0x74, 0x8E, 0xF5, 0xD8, 0x72,
+    0x80, 0x39, 0xA1, 0x04, 0x1C, 0x12, 0x9E, 0x57, 0x80, 0x17, 0xCE, 0x96, 0xDB, 0x2F, 0x97, 0xC5,
+    0x3E, 0x37, 0xD3, 0x2A, 0x44, 0x5F, 0x75, 0xA8, 0x70, 0x2B, 0x54, 0x2C, 0xA5, 0xF8, 0xE7, 0x5A,
+    0x85, 0x4B, 0xB7, 0x51, 0x91, 0xEC, 0x02, 0xE2, 0x43, 0x82, 0x00, 0x22, 0x42, 0x78, 0x0C, 0x13,
+    0xDA, 0xE0, 0x5D, 0xE3, 0xD5, 0x9E, 0x79, 0xAA, 0x3D, 0x71, 0x95, 0xF9, 0x17, 0x05, 0x17, 0x9D,
+    0x57, 0xF1, 0x4A, 0x29, 0x5A, 0x4D, 0x76, 0x40, 0xD3, 0x3E, 0x74, 0xA4, 0x55, 0xE4, 0xB4, 0x30,
+    0x26, 0x25, 0x5D, 0x2A, 0x2E, 0x3F, 0x90, 0x23, 0x74, 0x45, 0xF7, 0x7F, 0x7B, 0xFA, 0x6B, 0xB1,
+    0xDC, 0xC9, 0x61, 0xAF, 0x29, 0x9A, 0x1C, 0x6C, 0x29, 0x41, 0x83, 0x6F, 0xA4, 0x64, 0xA0, 0xD5,
+    0xCF, 0x48, 0x31, 0xFD, 0x06, 0xA4, 0xE2, 0x69, 0x22, 0x5E, 0x68, 0x67, 0xB0, 0xB2, 0x1D, 0xE3,
+    0x2D, 0x63, 0xA0, 0xD2, 0x93, 0x9E, 0xAF, 0x27, 0x74, 0x18, 0xA6, 0x28, 0x71, 0xE4, 0x3E, 0xCE,
+    0x8A, 0x32, 0x6D, 0x62, 0x08, 0xA3, 0x4C, 0x1A, 0x2B, 0x1D, 0xBE, 0x5C, 0xC1, 0x2F, 0xEB, 0x64,
+    0xEF, 0x4F, 0xC5, 0x67, 0x52, 0x63, 0xBF, 0xEC, 0x8E, 0x01, 0x38, 0x18, 0x26, 0x28, 0x60, 0x25,
+    0x39, 0x14, 0x06, 0x23, 0x49, 0xA4, 0x2E, 0x1E, 0x09, 0xCC, 0xB1, 0x2D, 0x1E, 0xA2, 0x5D, 0xDE,
+    0xF1, 0xB4, 0x9A, 0x78, 0xA5, 0x14, 0x82, 0xF2, 0x3A, 0x23, 0x59, 0x77, 0xF4, 0x0E, 0x87, 0x86,
+    0xA5, 0x81, 0xE2, 0x0E, 0x86, 0x5C, 0x94, 0x51, 0x4F, 0xAF, 0x84, 0x5F, 0xB0, 0x65, 0xEC, 0x3C,
+    0x6E, 0x4C, 0x0F, 0x7D, 0xC6, 0xAD, 0x52, 0xD2, 0x05, 0x03, 0x41, 0xDD, 0x65, 0xDA, 0x4D, 0x3A,
+    0x93, 0x56, 0xE9, 0x5F, 0xC2, 0xCE, 0x24, 0x95, 0xBD, 0x09, 0x8A, 0x6B, 0x7B, 0x2B, 0x6C, 0x41,
+    0x9B, 0x96, 0xE4, 0x6E, 0xD9, 0x69, 0x03, 0x7A, 0x60, 0x3F, 0x6C, 0x06, 0x13, 0xCE, 0x06, 0xFA,
+    0xC1, 0xD1, 0x6A, 0xFB, 0xE9, 0xD7, 0x30, 0xA7, 0x2E, 0xF9, 0xB4, 0x36, 0xE1, 0x51, 0x17, 0x7F,
+    0x5A, 0x99, 0xC9, 0xB2, 0x8D, 0x9F, 0x82, 0xFA, 0x06, 0x3A, 0x87, 0x87, 0x6E, 0x22, 0x0A, 0x88,
+    0x86, 0x3E, 0x27, 0x4D, 0x95, 0xEA, 0x90, 0xBA, 0x2E, 0x6A, 0x3D, 0x6D, 0xB4, 0x67, 0xF5, 0x60,
+    0x77, 0x4C, 0x52, 0x83, 0xA8, 0x2B, 0x4B, 0xC7, 0xE2, 0xA9, 0x06, 0xD1, 0x2D, 0x29, 0x25, 0x0D,
+    0x69, 0x11, 0xB7, 0xA0, 0x3D, 0x89, 0x3A, 0xA5, 0xE9, 0x77, 0xA7, 0x5A, 0xC9, 0x92, 0x68, 0x5E,
+    0x4A, 0x30, 0xF9, 0x3D, 0x59, 0xEC, 0xC2, 0xFC, 0xF7, 0xB8, 0x4D, 0xA3, 0xD4, 0x7A, 0x52, 0xA9,
+    0xBE, 0x9D, 0x99, 0xD1, 0xA1, 0x2A, 0x06, 0x0B, 0x59, 0xD2, 0x42, 0x68, 0x11, 0x1E, 0x83, 0x45,
+    0xB1, 0x1C, 0x6B, 0xCF, 0x6C, 0x11, 0xA5, 0x03, 0x22, 0x54, 0x01, 0xE9, 0x4D, 0x6B, 0xF8, 0xAD,
+    0x7B, 0x40, 0xDB, 0x05, 0xC4, 0x96, 0x87, 0x3E, 0x77, 0x6C, 0x0F, 0xB4, 0xAF, 0x60, 0xC3, 0x72,
+    0xDF, 0xC6, 0xAE, 0x02, 0xED, 0x7B, 0x28, 0xE3, 0x38, 0xA1, 0xF4, 0x8C, 0x76, 0x45, 0x93, 0x72,
+    0x2E, 0xF3, 0xCA, 0xCF, 0x3B, 0x6D, 0x8F, 0xC1, 0x6C, 0x36, 0x63, 0xD9, 0x36, 0x9C, 0xF7, 0xD4,
+    0x2F, 0xC1, 0x07, 0x17, 0x44, 0x8E, 0xFD, 0x29, 0x5C, 0xF6, 0x7C, 0xDD, 0xFD, 0x5D, 0xED, 0x67,
+    0x5B, 0x46, 0x67, 0x50, 0xB8, 0xBA, 0xC2, 0x67, 0xCC, 0xB3, 0xB8, 0xDB, 0x2F, 0x32, 0x73, 0x12,
+    0x0B, 0xB4, 0xF1, 0xB4, 0xD7, 0xB9, 0xD4, 0xED, 0xD6, 0x81, 0xD6, 0x94, 0x1A, 0x93, 0xB8, 0x48,
+    0x5A, 0x01, 0xAB, 0x60, 0x8C, 0x68, 0x9C, 0xB4, 0x00, 0xEB, 0x00, 0x79, 0x0D, 0x80, 0x0F, 0x58,
+    0xC1, 0x5F, 0x47, 0xAB, 0xB0, 0x47, 0x2D, 0x26, 0x88, 0x56, 0x49, 0x03, 0xC0, 0x01, 0x8A, 0x60,
+    0xDE, 0x88, 0x3F, 0xF2, 0x44, 0xED, 0xAD, 0x3E, 0x81, 0x88, 0x52, 0x8C, 0x56, 0xA9, 0x1B, 0x7B,
+    0x60, 0x1C, 0x0C, 0x20, 0x86, 0x43, 0xCD, 0x87, 0x41, 0x21, 0xAD, 0x71, 0xA2, 0xB4, 0xCB, 0xC5,
+    0x3B, 0x83, 0x75, 0x78, 0xFB, 0x8A, 0x60, 0x4B, 0x83, 0xD3, 0x7F, 0x97, 0x50, 0x10, 0x3A, 0x42,
+    0x3D, 0xEC, 0x26, 0x62, 0xAD, 0x45, 0xAD, 0xAA, 0x35, 0x7C, 0xC1, 0xDA, 0xDB, 0xBE, 0xD6, 0x0C,
+    0xB5, 0xB9, 0x57, 0x3A, 0xE0, 0x05, 0x3F, 0x6F, 0xBF, 0x29, 0x50, 0x31, 0x54, 0x89, 0x77, 0xB2,
+    0x96, 0x11, 0x60, 0x78, 0xF1, 0xD6, 0x94, 0x88, 0xF7, 0x1D, 0xE6, 0xFB, 0xD9, 0xE8, 0x64, 0x50,
+    0xEB, 0x5D, 0x35, 0xFC, 0x9E, 0x7F, 0x29, 0xCA, 0xC8, 0x77, 0x93, 0x52, 0x65, 0x8D, 0x97, 0x79,
+    0xA8, 0x2F, 0x81, 0xF8, 0x60, 0xCB, 0xA8, 0xE7, 0x4B, 0xF0, 0x89, 0x36, 0x1A, 0x9D, 0x55, 0x22,
+    0x8D, 0x41, 0x79, 0xDC, 0xC5, 0x38, 0x58, 0x53, 0xC8, 0xBF, 0xB3, 0x2F, 0x51, 0xDE, 0xC1, 0xA0,
+    0xF2, 0xB2, 0xC8, 0x30, 0x7E, 0xE1, 0x24, 0x83, 0x97, 0xE8, 0x26, 0x52, 0x09, 0xDD, 0x45, 0x9B,
+    0xCA, 0xAF, 0xC5, 0xE4, 0x19, 0x17, 0x86, 0x38, 0x29, 0xB4, 0x13, 0x84, 0xAA, 0xE7, 0x3D, 0xD7,
+    0xCC, 0x18, 0x8F, 0xBE, 0xB2, 0x8F, 0x41, 0xFD, 0xB2, 0xCD, 0xB4, 0x3B, 0xEF, 0x17, 0x1D, 0xB5,
+    0x63, 0x54, 0x1C, 0xB7, 0x11, 0xBB, 0x57, 0x5F, 0x92, 0x7A, 0x78, 0x49, 0xC7, 0x17, 0xBB, 0x16,
+    0x50, 0x53, 0x6E, 0x80, 0x16, 0x13, 0x52, 0x26, 0x53, 0x29, 0x54, 0xC5, 0x8E, 0xAB, 0x6F, 0x3C,
+    0x44, 0x5D, 0xCC, 0x32, 0xB8, 0xEA, 0xA9, 0xA4, 0x8C, 0xD9, 0x70, 0xCE, 0x81, 0xFA, 0x60, 0xB5,
+    0xB1, 0x42, 0x06, 0xE1, 0xFD, 0x32, 0x01, 0x34, 0x49, 0x8F, 0xA0, 0x67, 0x85, 0x0E, 0x13, 0x86,
+    0x21, 0x88, 0x83, 0xF0, 0xC7, 0x52, 0xA5, 0x4F, 0x5D, 0x5E, 0xDB, 0xA8, 0xB2, 0xEE, 0x41, 0x48,
+    0x57, 0x1D, 0x98, 0x94, 0x2B, 0x4E, 0x8E, 0xC1, 0x36, 0xF4, 0xFF, 0x8E, 0x50, 0x13, 0x30, 0x7C,
+    0x7C, 0x04, 0x7D, 0x2F, 0x33, 0x1A, 0x74, 0x43, 0xE8, 0xF5, 0xFC, 0x61, 0x51, 0x38, 0x37, 0xDB,
+    0xFD, 0x42, 0xF6, 0x35, 0xC8, 0xEF, 0xCA, 0x42, 0x5A, 0xCA, 0xB4, 0x52, 0xD0, 0x32, 0x85, 0x64,
+    0xF5, 0x53, 0xB9, 0x13, 0x77, 0x53, 0x26, 0x67, 0xBE, 0x6F, 0x47, 0xC0, 0x29, 0xEE, 0x7F, 0x6F,
+    0xFC, 0xC1, 0xFA, 0xAF, 0x00, 0x25, 0xAB, 0xC7, 0x99, 0xAA, 0xC8, 0xB6, 0x21, 0x7B, 0x2C, 0x45,
+    0xBC, 0xCF, 0xF4, 0x79, 0x4F, 0x4F, 0x81, 0x3D, 0xBB, 0x8F, 0xE2, 0xC7, 0xBA, 0x5E, 0xB6, 0x4C,
+    0x3A, 0x62, 0xAA, 0x68, 0x9B, 0x01, 0xBF, 0x98, 0xE1, 0x48, 0xE0, 0xF0, 0x67, 0xA7, 0xB0, 0x51,
+    0x6C, 0xA7, 0xCF, 0x24, 0x43, 0x7B, 0x60, 0xB2, 0x22, 0x62, 0x1C, 0xE0, 0x54, 0x3E, 0xFF, 0x87,
+    0x64, 0x13, 0xF5, 0xF8, 0xC6, 0x63, 0xAA, 0x88, 0xA2, 0x23, 0x6A, 0xBD, 0x3E, 0x59, 0xDB, 0x59,
+    0x35, 0x72, 0xB5, 0x8B, 0x40, 0x23, 0xA1, 0xB7, 0x68, 0x44, 0x31, 0x36, 0xE1, 0xE9, 0x31, 0xD1,
+    0x4B, 0x1A, 0x72, 0xFC, 0x0D, 0x35, 0x9D, 0x7C, 0xA5, 0xEA, 0x72, 0x3E, 0x10, 0x0E, 0xF9, 0x95,
+    0x54, 0xD7, 0xE4, 0xA0, 0x58, 0xC2, 0x89, 0xCC, 0xE1, 0xD8, 0x60, 0xDE, 0xA9, 0x3B, 0x55, 0xFB,
+    0x51, 0x3F, 0xBB, 0xDA, 0xD3, 0x6E, 0x61, 0xCC, 0x40, 0x18, 0x39, 0x54, 0x06, 0xA4, 0x1E, 0xB9,
+    0x23, 0x9E, 0x11, 0xF5, 0xB8, 0x8C, 0x94, 0x4C, 0xA2, 0x8C, 0x97, 0x5A, 0x45, 0xA1, 0x75, 0x5E,
+    0x72, 0x3E, 0xED, 0xFC, 0x7A, 0xA2, 0xB1, 0xDB, 0x07, 0xF0, 0x4A, 0xDF, 0xAE, 0x2D, 0xA0, 0xC9,
+    0x93, 0x14, 0x06, 0x3B, 0xED, 0x28, 0xE0, 0x0A, 0xB9, 0xA2, 0x2C, 0xEE, 0x9E, 0x54, 0xA8, 0x5E,
+    0x92, 0xF6, 0x58, 0x4D, 0x38, 0x5A, 0x65, 0x34, 0x26, 0xC3, 0x3E, 0x13, 0x47, 0x5F, 0xEE, 0x74,
+    0x76, 0xAC, 0x3F, 0x8A, 0x28, 0x28, 0x7A, 0x35, 0xA1, 0x96, 0x09, 0x4E, 0x1B, 0xF8, 0x3B, 0xC3,
+    0xF3, 0x2F, 0x11, 0x1D, 0x2F, 0xD5, 0x6F, 0xC5, 0x3D, 0x9A, 0xA8, 0xDA, 0xD2, 0x16, 0xA0, 0x4A,
+    0xF3, 0xE0, 0x4E, 0x83, 0x96, 0xB1, 0x89, 0x6A, 0x57, 0x7B, 0xA8, 0xCE, 0xA1, 0xAA, 0x67, 0x7F,
+    0xF4, 0xD7, 0x19, 0x85, 0x94, 0xE0, 0x5D, 0x8F, 0x6A, 0x49, 0x95, 0xE4, 0x75, 0xA4, 0xDE, 0x05,
+    0x09, 0x00, 0x76, 0x8E, 0x6C, 0x00, 0x7B, 0xE4, 0x85, 0x07, 0xF2, 0x83, 0xCB, 0xE5, 0x3E, 0x44,
+    0x43, 0xEF, 0x88, 0x3F, 0x82, 0x55, 0x1F, 0xEC, 0x40, 0xC6, 0x7A, 0x32, 0xBF, 0x2B, 0x2E, 0x1D,
+    0x93, 0x51, 0xDE, 0xB7, 0x60, 0xB8, 0xC4, 0xC8, 0x3B, 0x90, 0xCB, 0xC7, 0xC7, 0x5F, 0xA5, 0xC3,
+    0xF9, 0x5B, 0xB5, 0xED, 0x56, 0xD3, 0x40, 0xA7, 0x69, 0x43, 0x3D, 0xE8, 0xE9, 0x34, 0xAA, 0x57,
+    0x29, 0x7A, 0xEF, 0x4F, 0x39, 0x58, 0xAC, 0x32, 0x9F, 0xF8, 0xA4, 0x2C, 0x5F, 0x33, 0x41, 0x64,
+    0x50, 0xE7, 0x3E, 0xB8, 0x7B, 0x2D, 0xEE, 0xEC, 0x61, 0x2F, 0x8F, 0xBB, 0x5F, 0xAD, 0xF2, 0xDF,
+    0x3E, 0xEE, 0x7E, 0xD2, 0xA4, 0xE1, 0xE7, 0x6D, 0x0A, 0x3C, 0x44, 0x9A, 0x52, 0x4C, 0x11, 0xBB,
+    0x44, 0xDD, 0xF2, 0x52, 0x27, 0x6F, 0xD2, 0x2B, 0x15, 0x31, 0x04, 0xEE, 0x5C, 0x98, 0xCC, 0xF5,
+    0xBC, 0xBD, 0x16, 0x46, 0x10, 0x55, 0xB7, 0x4E, 0x3C, 0xD8, 0x9B, 0x22, 0x8D, 0xF9, 0x1F, 0xB7,
+    0xA1, 0xFF, 0x0B, 0x0A, 0xEF, 0x45, 0x3A, 0xE4, 0x19, 0x7F, 0xD0, 0x7B, 0x09, 0x8C, 0x6E, 0xF6,
+    0x51, 0x7F, 0x79, 0xF0, 0x2E, 0x9D, 0x06, 0x61, 0x1A, 0x62, 0x8E, 0xAB, 0xA5, 0x2A, 0x1F, 0xA7,
+    0x87, 0xD2, 0x73, 0xFE, 0x1A, 0xC3, 0xE4, 0x99, 0xC1, 0x2A, 0xD4, 0x3B, 0x73, 0xE9, 0x05, 0x87,
+    0xB4, 0x02, 0xF6, 0x43, 0x91, 0xA1, 0xCC, 0xC7, 0x8F, 0x63, 0xF8, 0xB0, 0xA2, 0x0C, 0x15, 0x78,
+    0xDB, 0xDB, 0x1F, 0xBC, 0xAB, 0xB0, 0xE2, 0x93, 0xD7, 0x2A, 0xCE, 0xED, 0x00, 0x12, 0xF7, 0x09,
+    0x61, 0xC2, 0xF3, 0x0A, 0xB0, 0x35, 0x20, 0xC7, 0x8D, 0x25, 0x93, 0x72, 0x22, 0x97, 0xBC, 0x03,
+    0x61, 0xB7, 0x8E, 0x50, 0x03, 0x86, 0x2B, 0xE4, 0xF8, 0x1B, 0xC2, 0x5A, 0xBA, 0xAB, 0x9A, 0xBD,
+    0x18, 0xE9, 0xB9, 0xFD, 0x73, 0xA8, 0x1A, 0xBE, 0xEF, 0xA9, 0xB8, 0xB7, 0x5C, 0x2C, 0xB6, 0x54,
+    0xC4, 0xA2, 0xC1, 0x88, 0xC7, 0x2C, 0x56, 0xAA, 0x03, 0x75, 0x0E, 0x08, 0x08, 0x68, 0x89, 0x7C,
+    0x35, 0x74, 0xDF, 0x83, 0xE6, 0x40, 0x37, 0xDF, 0x25, 0xFD, 0x4B, 0x8A, 0x39, 0x83, 0xC5, 0xA1,
+    0xBC, 0x20, 0x4D, 0xBF, 0xC1, 0x16, 0xC2, 0x2E, 0x28, 0x7F, 0x71, 0xEC, 0x61, 0x73, 0x1F, 0xAD,
+    0x6F, 0x14, 0xFB, 0xC1, 0x1D, 0x1F, 0x9D, 0x6B, 0x1F, 0x9B, 0x6B, 0x9F, 0x45, 0xF9, 0x64, 0x6F,
+    0xB8, 0xFC, 0xA9, 0xBE, 0x27, 0x7E, 0xC1, 0x13, 0xF9, 0x56, 0x9A, 0xEA, 0xC5, 0xE6, 0xAC, 0x0F,
+    0xF8, 0x56, 0xFD, 0x4A, 0x20, 0xA3, 0xD7, 0x66, 0x69, 0x2C, 0x1F, 0x20, 0xD2, 0x22, 0x27, 0x9F,
+    0xF0, 0xF6, 0x47, 0xF9, 0xE1, 0xA0, 0x5B, 0x12, 0xF2, 0x54, 0x08, 0x12, 0x1E, 0x6E, 0x20, 0x4A,
+    0x54, 0x09, 0x7E, 0x45, 0xC9, 0x7C, 0x0B, 0x61, 0x86, 0xBB, 0x27, 0x97, 0xEE, 0x3A, 0xF4, 0x1E,
+    0x67, 0x56, 0x74, 0xF4, 0x9B, 0xCC, 0x99, 0x62, 0x9F, 0x38, 0x8D, 0x6F, 0x69, 0x77, 0x9D, 0x21,
+    0x8C, 0xD2, 0x74, 0xE3, 0x95, 0xB7, 0xE7, 0x45, 0x7C, 0x6B, 0xCD, 0x26, 0xF5, 0xD2, 0x73, 0x02,
+    0x48, 0xA4, 0xB2, 0xD7, 0x6F, 0xE8, 0xEF, 0xBD, 0x4F, 0xDC, 0xD8, 0x24, 0xDE, 0x7A, 0x60, 0x86,
+    0x9C, 0x73, 0x48, 0x80, 0xC4, 0xAF, 0x68, 0x65, 0x05, 0x97, 0xD8, 0x9B, 0x9B, 0x85, 0x8B, 0xBB,
+    0x8D, 0x4D, 0xDB, 0xA6, 0xED, 0xC6, 0x26, 0x12, 0x94, 0x66, 0x63, 0x13, 0x07, 0xD5, 0x01, 0x57,
+    0xC4, 0xC8, 0x63, 0x6F, 0xDD, 0xF9, 0xF3, 0xC1, 0x65, 0xFD, 0x37, 0xC3, 0x07, 0x6C, 0xEF, 0x81,
+    0x07, 0x15, 0x4E, 0x87, 0x2C, 0x48, 0xED, 0x27, 0x3F, 0x1A, 0x24, 0xCE, 0xBF, 0x63, 0x5E, 0x45,
+    0x6D, 0x57, 0xBB, 0xE3, 0x67, 0xF8, 0xF7, 0x86, 0x0F, 0x23, 0xB6, 0x93, 0xBF, 0xE3, 0x29, 0x6D,
+    0xB3, 0xF6, 0x38, 0x79, 0x82, 0xFB, 0x1A, 0x2F, 0x6B, 0x63, 0xBB, 0x03, 0x6D, 0xD3, 0x52, 0x6B,
+    0x27, 0x4F, 0x8A, 0xA7, 0x68, 0x75, 0x0C, 0xD1, 0xF6, 0x19, 0x95, 0xBD, 0x3E, 0x97, 0xC9, 0x60,
+    0x3C, 0xC1, 0xCF, 0x69, 0x4B, 0x2D, 0x4F, 0x03, 0x9C, 0x5D, 0x93, 0xC8, 0x3D, 0x87, 0x9C, 0xE5,
+    0x2D, 0xEE, 0x8C, 0x47, 0xB6, 0xA8, 0x4F, 0x3F, 0x2C, 0x63, 0x46, 0x62, 0x57, 0xE6, 0xBD, 0x44,
+    0x0E, 0x5B, 0x3A, 0xC8, 0x09, 0x07, 0xDE, 0xA6, 0x40, 0xBD, 0xFB, 0x84, 0x1B, 0xBA, 0x8C, 0x83,
+    0xD1, 0x8D, 0xCF, 0x7F, 0x00, 0xD3, 0x5A, 0xB5, 0x6A, 0x95, 0x43, 0xFD, 0xFF, 0xFF, 0xFF, 0x1B,
+    0x10, 0x04, 0x03, 0x08, 0x00, 0x00, 0x95, 0x90, 0xB1, 0x11, 0x82, 0x40, 0x10, 0x45, 0x97, 0x61,
+    0x46, 0x02, 0x03, 0x23, 0x4D, 0x08, 0x2C, 0xE1, 0x4A, 0x38, 0x4A, 0x20, 0x31, 0xB2, 0x04, 0x03,
+    0x4B, 0x38, 0x4A, 0x30, 0xB1, 0x03, 0x23, 0x6B, 0x70, 0x06, 0x4A, 0xA0, 0x04, 0x72, 0x93, 0x0B,
+    0x2E, 0x50, 0x47, 0xF9, 0xFE, 0x5D, 0x08, 0x4C, 0x65, 0x8E, 0xFF, 0x8E, 0xB9, 0xDB, 0xBF, 0x7F,
+    0x91, 0x6C, 0x27, 0x7C, 0x5A, 0x3C, 0x44, 0x0A, 0x00, 0x8D, 0xAC, 0xA8, 0x83, 0xF8, 0x71, 0xAF,
+    0x9A, 0x24, 0x0C, 0x12, 0xA2, 0xE9, 0xBC, 0xC9, 0x80, 0x77, 0x18, 0x96, 0x3F, 0xBA, 0x68, 0x5F,
+    0x97, 0xF9, 0xC2, 0xFF, 0xCB, 0x9B, 0xB9, 0x1F, 0x6F, 0x54, 0xA7, 0x6E, 0x0C, 0xA0, 0x9A, 0x6B,
+    0x22, 0x91, 0xB5, 0x49, 0xAD, 0xAA, 0xF9, 0x4E, 0xCA, 0x2D, 0xA6, 0xB3, 0x00, 0x8C, 0x16, 0xFE,
+    0x79, 0x34, 0xA2, 0x29, 0x26, 0x8A, 0x71, 0x83, 0x4A, 0xC9, 0xAA, 0x9E, 0x15, 0x1D, 0xDF, 0xD8,
+    0x92, 0x9E, 0xDF, 0xCA, 0x90, 0xCA, 0xEE, 0x80, 0x6B, 0x15, 0x7A, 0xB1, 0x7B, 0x21, 0x89, 0xD5,
+    0x79, 0x54, 0x46, 0xC7, 0x26, 0x4A, 0xCE, 0x68, 0xE7, 0x9C, 0xBB, 0x37, 0xDF, 0x12, 0x71, 0xEE,
+    0x33, 0xD3, 0x27, 0x65, 0x2D, 0x2E, 0xE6, 0xA0, 0xCF, 0xB9, 0x25, 0xEF, 0x1D, 0xD3, 0x0D, 0xB9,
+    0xF6, 0xD1, 0x9F, 0x4A, 0x3A, 0x7C, 0xD4, 0xBC, 0xB1, 0x91, 0xB2, 0x5A, 0xBE, 0x4D, 0x8F, 0xB1,
+    0x0D, 0xC3, 0x30, 0x0C, 0x04, 0x19, 0xA8, 0x48, 0xC9, 0x3E, 0x19, 0x42, 0x23, 0x50, 0x9B, 0x39,
+    0x23, 0x64, 0x23, 0x6B, 0x04, 0x8D, 0x90, 0x11, 0x52, 0xD8, 0x40, 0x0A, 0x3B, 0x9F, 0xD7, 0x0B,
+    0x36, 0xC2, 0xE6, 0x41, 0xF0, 0xC8, 0x7F, 0x9A, 0x9D, 0x95, 0xCA, 0x50, 0x6F, 0x43, 0x63, 0x19,
+    0x8A, 0x7D, 0x8C, 0x01, 0x01, 0x0E, 0x08, 0x88, 0xE7, 0x5D, 0xC0, 0xC7, 0xAC, 0x03, 0x89, 0x1A,
+    0x04, 0x7C, 0xBB, 0x3D, 0x82, 0x40, 0x7C, 0xD1, 0x32, 0x01, 0x00, 0xAF, 0xBC, 0xF7, 0x6D, 0xD4,
+    0x40, 0xE1, 0x36, 0x6C, 0x42, 0x0B, 0x60, 0xBB, 0x00, 0x0B, 0xF5, 0x7D, 0xA5, 0x7A, 0xC7, 0x78,
+    0x99, 0x5C, 0x9F, 0x15, 0xEE, 0xB5, 0xA9, 0x3B, 0xB3, 0xE1, 0x58, 0xB6, 0x32, 0x4E, 0x58, 0x67,
+    0x05, 0xE1, 0x39, 0x05, 0x8B, 0x9A, 0x95, 0xC3, 0x6B, 0x28, 0x57, 0x5A, 0xE7, 0xF2, 0x9F, 0xFB,
+    0xFC, 0xE3, 0xF8, 0xEB, 0xF8, 0x53, 0xF5, 0x03,
 };
 
 static const EpdGlyph notosans_16_boldGlyphs[] = {
@@ -2388,99 +2393,99 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 0, 0, 139, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 139, 0, 0, 0, 0 }, // U+0020
     { 7, 25, 150, 1, 24, 44, 0 }, // !
-    { 12, 9, 255, 2, 24, 27, 44 }, // "
-    { 21, 24, 344, 0, 24, 126, 71 }, // #
-    { 17, 28, 305, 1, 26, 119, 197 }, // $
-    { 29, 26, 481, 1, 25, 189, 316 }, // %
-    { 24, 26, 400, 1, 25, 156, 505 }, // &
-    { 5, 9, 142, 2, 24, 12, 661 }, // '
-    { 10, 30, 181, 1, 24, 75, 673 }, // (
-    { 9, 30, 181, 1, 24, 68, 748 }, // )
-    { 18, 17, 289, 0, 26, 77, 816 }, // *
-    { 17, 17, 305, 1, 20, 73, 893 }, // +
-    { 7, 9, 152, 1, 4, 16, 966 }, // ,
-    { 10, 5, 171, 0, 11, 13, 982 }, // -
-    { 7, 7, 150, 1, 6, 13, 995 }, // .
-    { 14, 25, 221, 0, 24, 88, 1008 }, // /
-    { 18, 26, 322, 1, 25, 117, 1096 }, // 0
-    { 13, 24, 276, 0, 24, 78, 1213 }, // 1
-    { 17, 25, 298, 1, 25, 107, 1291 }, // 2
-    { 17, 26, 305, 1, 25, 111, 1398 }, // 3
-    { 19, 24, 310, 0, 24, 114, 1509 }, // 4
-    { 17, 25, 308, 1, 24, 107, 1623 }, // 5
-    { 18, 26, 321, 1, 25, 117, 1730 }, // 6
-    { 18, 24, 285, 0, 24, 108, 1847 }, // 7
-    { 18, 26, 317, 1, 25, 117, 1955 }, // 8
-    { 18, 26, 321, 1, 25, 117, 2072 }, // 9
-    { 7, 20, 150, 1, 19, 35, 2189 }, // :
-    { 7, 24, 152, 1, 19, 42, 2224 }, // ;
-    { 17, 18, 305, 1, 21, 77, 2266 }, // <
-    { 17, 11, 305, 1, 17, 47, 2343 }, // =
-    { 17, 18, 305, 1, 21, 77, 2390 }, // >
-    { 16, 26, 254, 0, 25, 104, 2467 }, // ?
-    { 28, 27, 479, 1, 24, 189, 2571 }, // @
-    { 24, 24, 369, 0, 24, 144, 2760 }, // A
-    { 19, 24, 355, 2, 24, 114, 2904 }, // B
-    { 20, 26, 342, 1, 25, 130, 3018 }, // C
-    { 21, 24, 390, 2, 24, 126, 3148 }, // D
-    { 14, 24, 299, 3, 24, 84, 3274 }, // E
-    { 14, 24, 293, 3, 24, 84, 3358 }, // F
-    { 21, 26, 386, 1, 25, 137, 3442 }, // G
-    { 20, 24, 408, 3, 24, 120, 3579 }, // H
-    { 11, 24, 207, 1, 24, 66, 3699 }, // I
-    { 12, 31, 177, -3, 24, 93, 3765 }, // J
-    { 20, 24, 354, 3, 24, 120, 3858 }, // K
-    { 16, 24, 298, 2, 24, 96, 3978 }, // L
-    { 26, 24, 503, 3, 24, 156, 4074 }, // M
-    { 22, 24, 434, 3, 24, 132, 4230 }, // N
-    { 24, 26, 422, 1, 25, 156, 4362 }, // O
-    { 18, 24, 331, 2, 24, 108, 4518 }, // P
-    { 24, 31, 422, 1, 25, 186, 4626 }, // Q
-    { 20, 24, 350, 2, 24, 120, 4812 }, // R
-    { 17, 26, 294, 1, 25, 111, 4932 }, // S
-    { 19, 24, 308, 0, 24, 114, 5043 }, // T
-    { 21, 25, 403, 2, 24, 132, 5157 }, // U
-    { 22, 24, 347, 0, 24, 132, 5289 }, // V
-    { 33, 24, 516, 0, 24, 198, 5421 }, // W
-    { 23, 24, 357, 0, 24, 138, 5619 }, // X
-    { 21, 24, 334, 0, 24, 126, 5757 }, // Y
-    { 19, 24, 309, 0, 24, 114, 5883 }, // Z
-    { 9, 30, 177, 2, 24, 68, 5997 }, // [
-    { 14, 25, 221, 0, 24, 88, 6065 }, // <backslash>
-    { 9, 30, 177, 0, 24, 68, 6153 }, // ]
-    { 19, 16, 305, 0, 24, 76, 6221 }, // ^
-    { 15, 3, 219, -1, -3, 12, 6297 }, // _
-    { 10, 6, 195, 1, 26, 15, 6309 }, // `
-    { 17, 20, 319, 1, 19, 85, 6324 }, // a
-    { 18, 27, 337, 2, 26, 122, 6409 }, // b
-    { 16, 20, 275, 1, 19, 80, 6531 }, // c
-    { 18, 27, 337, 1, 26, 122, 6611 }, // d
-    { 18, 20, 318, 1, 19, 90, 6733 }, // e
-    { 15, 26, 206, 0, 26, 98, 6823 }, // f
-    { 18, 27, 337, 1, 19, 122, 6921 }, // g
-    { 18, 26, 347, 2, 26, 117, 7043 }, // h
-    { 6, 26, 159, 2, 26, 39, 7160 }, // i
-    { 10, 34, 159, -2, 26, 85, 7199 }, // j
-    { 19, 26, 331, 2, 26, 124, 7284 }, // k
-    { 6, 26, 159, 2, 26, 39, 7408 }, // l
-    { 29, 19, 520, 2, 19, 138, 7447 }, // m
-    { 18, 19, 347, 2, 19, 86, 7585 }, // n
-    { 19, 20, 333, 1, 19, 95, 7671 }, // o
-    { 18, 27, 337, 2, 19, 122, 7766 }, // p
-    { 18, 27, 337, 1, 19, 122, 7888 }, // q
-    { 13, 19, 238, 2, 19, 62, 8010 }, // r
-    { 15, 20, 268, 1, 19, 75, 8072 }, // s
-    { 14, 24, 231, 0, 23, 84, 8147 }, // t
-    { 18, 20, 347, 2, 19, 90, 8231 }, // u
-    { 20, 19, 304, 0, 19, 95, 8321 }, // v
-    { 29, 19, 456, 0, 19, 138, 8416 }, // w
-    { 20, 19, 308, 0, 19, 95, 8554 }, // x
-    { 20, 27, 304, 0, 19, 135, 8649 }, // y
-    { 15, 19, 263, 1, 19, 72, 8784 }, // z
-    { 12, 30, 210, 0, 24, 90, 8856 }, // {
-    { 4, 34, 294, 7, 26, 34, 8946 }, // |
-    { 12, 30, 210, 1, 24, 90, 8980 }, // }
-    { 17, 7, 305, 1, 15, 30, 9070 }, // ~
+    { 12, 9, 255, 2, 24, 27, 0 }, // "
+    { 21, 24, 344, 0, 24, 126, 27 }, // #
+    { 17, 28, 305, 1, 26, 119, 153 }, // $
+    { 29, 26, 481, 1, 25, 189, 272 }, // %
+    { 24, 26, 400, 1, 25, 156, 461 }, // &
+    { 5, 9, 142, 2, 24, 12, 617 }, // '
+    { 10, 30, 181, 1, 24, 75, 44 }, // (
+    { 9, 30, 181, 1, 24, 68, 119 }, // )
+    { 18, 17, 289, 0, 26, 77, 629 }, // *
+    { 17, 17, 305, 1, 20, 73, 706 }, // +
+    { 7, 9, 152, 1, 4, 16, 187 }, // ,
+    { 10, 5, 171, 0, 11, 13, 203 }, // -
+    { 7, 7, 150, 1, 6, 13, 216 }, // .
+    { 14, 25, 221, 0, 24, 88, 779 }, // /
+    { 18, 26, 322, 1, 25, 117, 229 }, // 0
+    { 13, 24, 276, 0, 24, 78, 346 }, // 1
+    { 17, 25, 298, 1, 25, 107, 424 }, // 2
+    { 17, 26, 305, 1, 25, 111, 531 }, // 3
+    { 19, 24, 310, 0, 24, 114, 642 }, // 4
+    { 17, 25, 308, 1, 24, 107, 756 }, // 5
+    { 18, 26, 321, 1, 25, 117, 863 }, // 6
+    { 18, 24, 285, 0, 24, 108, 980 }, // 7
+    { 18, 26, 317, 1, 25, 117, 1088 }, // 8
+    { 18, 26, 321, 1, 25, 117, 1205 }, // 9
+    { 7, 20, 150, 1, 19, 35, 1322 }, // :
+    { 7, 24, 152, 1, 19, 42, 1357 }, // ;
+    { 17, 18, 305, 1, 21, 77, 867 }, // <
+    { 17, 11, 305, 1, 17, 47, 944 }, // =
+    { 17, 18, 305, 1, 21, 77, 991 }, // >
+    { 16, 26, 254, 0, 25, 104, 1399 }, // ?
+    { 28, 27, 479, 1, 24, 189, 1068 }, // @
+    { 24, 24, 369, 0, 24, 144, 1503 }, // A
+    { 19, 24, 355, 2, 24, 114, 1647 }, // B
+    { 20, 26, 342, 1, 25, 130, 1761 }, // C
+    { 21, 24, 390, 2, 24, 126, 1891 }, // D
+    { 14, 24, 299, 3, 24, 84, 2017 }, // E
+    { 14, 24, 293, 3, 24, 84, 2101 }, // F
+    { 21, 26, 386, 1, 25, 137, 2185 }, // G
+    { 20, 24, 408, 3, 24, 120, 2322 }, // H
+    { 11, 24, 207, 1, 24, 66, 2442 }, // I
+    { 12, 31, 177, -3, 24, 93, 2508 }, // J
+    { 20, 24, 354, 3, 24, 120, 2601 }, // K
+    { 16, 24, 298, 2, 24, 96, 2721 }, // L
+    { 26, 24, 503, 3, 24, 156, 2817 }, // M
+    { 22, 24, 434, 3, 24, 132, 2973 }, // N
+    { 24, 26, 422, 1, 25, 156, 3105 }, // O
+    { 18, 24, 331, 2, 24, 108, 3261 }, // P
+    { 24, 31, 422, 1, 25, 186, 3369 }, // Q
+    { 20, 24, 350, 2, 24, 120, 3555 }, // R
+    { 17, 26, 294, 1, 25, 111, 3675 }, // S
+    { 19, 24, 308, 0, 24, 114, 3786 }, // T
+    { 21, 25, 403, 2, 24, 132, 1257 }, // U
+    { 22, 24, 347, 0, 24, 132, 3900 }, // V
+    { 33, 24, 516, 0, 24, 198, 4032 }, // W
+    { 23, 24, 357, 0, 24, 138, 4230 }, // X
+    { 21, 24, 334, 0, 24, 126, 4368 }, // Y
+    { 19, 24, 309, 0, 24, 114, 4494 }, // Z
+    { 9, 30, 177, 2, 24, 68, 1389 }, // [
+    { 14, 25, 221, 0, 24, 88, 1457 }, // <backslash>
+    { 9, 30, 177, 0, 24, 68, 1545 }, // ]
+    { 19, 16, 305, 0, 24, 76, 1613 }, // ^
+    { 15, 3, 219, -1, -3, 12, 1689 }, // _
+    { 10, 6, 195, 1, 26, 15, 1701 }, // `
+    { 17, 20, 319, 1, 19, 85, 4608 }, // a
+    { 18, 27, 337, 2, 26, 122, 4693 }, // b
+    { 16, 20, 275, 1, 19, 80, 4815 }, // c
+    { 18, 27, 337, 1, 26, 122, 4895 }, // d
+    { 18, 20, 318, 1, 19, 90, 5017 }, // e
+    { 15, 26, 206, 0, 26, 98, 5107 }, // f
+    { 18, 27, 337, 1, 19, 122, 5205 }, // g
+    { 18, 26, 347, 2, 26, 117, 5327 }, // h
+    { 6, 26, 159, 2, 26, 39, 5444 }, // i
+    { 10, 34, 159, -2, 26, 85, 5483 }, // j
+    { 19, 26, 331, 2, 26, 124, 5568 }, // k
+    { 6, 26, 159, 2, 26, 39, 5692 }, // l
+    { 29, 19, 520, 2, 19, 138, 5731 }, // m
+    { 18, 19, 347, 2, 19, 86, 5869 }, // n
+    { 19, 20, 333, 1, 19, 95, 5955 }, // o
+    { 18, 27, 337, 2, 19, 122, 6050 }, // p
+    { 18, 27, 337, 1, 19, 122, 6172 }, // q
+    { 13, 19, 238, 2, 19, 62, 6294 }, // r
+    { 15, 20, 268, 1, 19, 75, 6356 }, // s
+    { 14, 24, 231, 0, 23, 84, 6431 }, // t
+    { 18, 20, 347, 2, 19, 90, 6515 }, // u
+    { 20, 19, 304, 0, 19, 95, 6605 }, // v
+    { 29, 19, 456, 0, 19, 138, 6700 }, // w
+    { 20, 19, 308, 0, 19, 95, 6838 }, // x
+    { 20, 27, 304, 0, 19, 135, 6933 }, // y
+    { 15, 19, 263, 1, 19, 72, 7068 }, // z
+    { 12, 30, 210, 0, 24, 90, 1716 }, // {
+    { 4, 34, 294, 7, 26, 34, 1806 }, // |
+    { 12, 30, 210, 1, 24, 90, 1840 }, // }
+    { 17, 7, 305, 1, 15, 30, 1930 }, // ~
     { 0, 0, 139, 0, 0, 0, 0 }, // U+00A0
     { 7, 25, 153, 1, 19, 44, 0 }, // U+00A1
     { 15, 26, 305, 2, 25, 98, 44 }, // U+00A2
@@ -2564,19 +2569,19 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 19, 27, 334, 1, 26, 129, 9129 }, // U+00F0
     { 18, 26, 347, 2, 26, 117, 9258 }, // U+00F1
     { 19, 27, 333, 1, 26, 129, 9375 }, // U+00F2
-    { 19, 27, 333, 1, 26, 129, 9504 }, // U+00F3
-    { 19, 27, 333, 1, 26, 129, 9633 }, // U+00F4
-    { 19, 27, 333, 1, 26, 129, 9762 }, // U+00F5
-    { 19, 27, 333, 1, 26, 129, 9891 }, // U+00F6
-    { 17, 17, 305, 1, 20, 73, 10020 }, // U+00F7
-    { 19, 22, 330, 1, 20, 105, 10093 }, // U+00F8
-    { 18, 27, 347, 2, 26, 122, 10198 }, // U+00F9
-    { 18, 27, 347, 2, 26, 122, 10320 }, // U+00FA
-    { 18, 27, 347, 2, 26, 122, 10442 }, // U+00FB
-    { 18, 27, 347, 2, 26, 122, 10564 }, // U+00FC
-    { 20, 34, 304, 0, 26, 170, 10686 }, // U+00FD
-    { 18, 34, 337, 2, 26, 153, 10856 }, // U+00FE
-    { 20, 34, 304, 0, 26, 170, 11009 }, // U+00FF
+    { 19, 27, 333, 1, 26, 129, 7140 }, // U+00F3
+    { 19, 27, 333, 1, 26, 129, 9504 }, // U+00F4
+    { 19, 27, 333, 1, 26, 129, 9633 }, // U+00F5
+    { 19, 27, 333, 1, 26, 129, 9762 }, // U+00F6
+    { 17, 17, 305, 1, 20, 73, 9891 }, // U+00F7
+    { 19, 22, 330, 1, 20, 105, 9964 }, // U+00F8
+    { 18, 27, 347, 2, 26, 122, 10069 }, // U+00F9
+    { 18, 27, 347, 2, 26, 122, 10191 }, // U+00FA
+    { 18, 27, 347, 2, 26, 122, 10313 }, // U+00FB
+    { 18, 27, 347, 2, 26, 122, 10435 }, // U+00FC
+    { 20, 34, 304, 0, 26, 170, 10557 }, // U+00FD
+    { 18, 34, 337, 2, 26, 153, 10727 }, // U+00FE
+    { 20, 34, 304, 0, 26, 170, 10880 }, // U+00FF
     { 24, 30, 369, 0, 30, 180, 0 }, // U+0100
     { 17, 25, 319, 1, 24, 107, 180 }, // U+0101
     { 24, 32, 369, 0, 32, 192, 287 }, // U+0102
@@ -3278,98 +3283,98 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 10, 5, 171, 0, 11, 13, 126 }, // U+2010
     { 10, 5, 171, 0, 11, 13, 139 }, // U+2011
     { 17, 5, 308, 1, 14, 22, 152 }, // U+2012
-    { 15, 4, 267, 1, 11, 15, 174 }, // U+2013
-    { 32, 4, 533, 1, 11, 32, 189 }, // U+2014
-    { 32, 4, 533, 1, 11, 32, 221 }, // U+2015
-    { 13, 34, 294, 3, 26, 111, 253 }, // U+2016
-    { 15, 8, 219, -1, 0, 30, 364 }, // U+2017
-    { 7, 9, 116, 0, 24, 16, 394 }, // U+2018
-    { 7, 9, 116, 0, 24, 16, 410 }, // U+2019
-    { 8, 9, 153, 0, 5, 18, 426 }, // U+201A
-    { 7, 9, 116, 0, 24, 16, 444 }, // U+201B
-    { 15, 9, 237, 0, 24, 34, 460 }, // U+201C
-    { 15, 9, 237, 0, 24, 34, 494 }, // U+201D
-    { 15, 9, 274, 1, 4, 34, 528 }, // U+201E
-    { 15, 9, 237, 0, 24, 34, 562 }, // U+201F
-    { 15, 26, 274, 1, 26, 98, 596 }, // U+2020
-    { 15, 26, 277, 1, 26, 98, 694 }, // U+2021
-    { 10, 11, 201, 1, 18, 28, 792 }, // U+2022
-    { 12, 13, 201, 1, 19, 39, 820 }, // U+2023
-    { 7, 7, 267, 5, 6, 13, 859 }, // U+2024
-    { 17, 7, 307, 1, 6, 30, 872 }, // U+2025
-    { 26, 7, 456, 1, 6, 46, 902 }, // U+2026
-    { 7, 7, 150, 1, 12, 13, 948 }, // U+2027
-    { 0, 0, 320, 0, 0, 0, 961 }, // U+2028
-    { 0, 0, 320, 0, 0, 0, 961 }, // U+2029
-    { 9, 26, 0, -1, 21, 59, 961 }, // U+202A
-    { 9, 26, 0, -8, 21, 59, 1020 }, // U+202B
-    { 8, 28, 0, -4, 23, 56, 1079 }, // U+202C
-    { 8, 28, 0, -4, 23, 56, 1135 }, // U+202D
-    { 8, 28, 0, -4, 23, 56, 1191 }, // U+202E
-    { 0, 0, 89, 0, 0, 0, 1247 }, // U+202F
-    { 41, 26, 683, 1, 25, 267, 1247 }, // U+2030
-    { 55, 26, 889, 0, 25, 358, 1514 }, // U+2031
-    { 10, 9, 162, 1, 24, 23, 1872 }, // U+2032
-    { 17, 9, 279, 1, 24, 39, 1895 }, // U+2033
-    { 25, 9, 397, 1, 24, 57, 1934 }, // U+2034
-    { 10, 9, 225, 1, 24, 23, 1991 }, // U+2035
-    { 17, 9, 343, 1, 24, 39, 2014 }, // U+2036
-    { 25, 9, 461, 1, 24, 57, 2053 }, // U+2037
-    { 13, 11, 218, 0, 3, 36, 2110 }, // U+2038
-    { 10, 16, 195, 1, 17, 40, 2146 }, // U+2039
-    { 10, 16, 195, 1, 17, 40, 2186 }, // U+203A
-    { 26, 26, 453, 1, 25, 169, 2226 }, // U+203B
-    { 17, 25, 304, 1, 24, 107, 2395 }, // U+203C
-    { 16, 26, 254, 0, 25, 104, 2502 }, // U+203D
-    { 18, 4, 267, -1, 29, 18, 2606 }, // U+203E
-    { 20, 8, 325, 0, 0, 40, 2624 }, // U+203F
-    { 20, 8, 325, 0, 27, 40, 2664 }, // U+2040
-    { 14, 22, 226, 0, 14, 77, 2704 }, // U+2041
-    { 37, 31, 597, 0, 26, 287, 2781 }, // U+2042
-    { 10, 5, 171, 1, 11, 13, 3068 }, // U+2043
-    { 18, 24, 69, -7, 24, 108, 3081 }, // U+2044
-    { 9, 30, 177, 2, 24, 68, 3189 }, // U+2045
-    { 9, 30, 177, 0, 24, 68, 3257 }, // U+2046
-    { 31, 26, 506, 0, 25, 202, 3325 }, // U+2047
-    { 24, 26, 407, 0, 25, 156, 3527 }, // U+2048
-    { 24, 26, 407, 1, 25, 156, 3683 }, // U+2049
-    { 17, 19, 314, 1, 19, 81, 3839 }, // U+204A
-    { 18, 31, 346, 2, 26, 140, 3920 }, // U+204B
-    { 18, 18, 349, 1, 19, 81, 4060 }, // U+204C
-    { 19, 18, 349, 2, 19, 86, 4141 }, // U+204D
-    { 18, 17, 289, 0, 9, 77, 4227 }, // U+204E
-    { 8, 24, 152, 1, 19, 48, 4304 }, // U+204F
-    { 20, 35, 320, 0, 27, 175, 4352 }, // U+2050
-    { 18, 34, 289, 0, 26, 153, 4527 }, // U+2051
-    { 14, 26, 225, 0, 25, 91, 4680 }, // U+2052
-    { 32, 7, 533, 1, 13, 56, 4771 }, // U+2053
-    { 20, 8, 320, 0, 0, 40, 4827 }, // U+2054
-    { 17, 17, 299, 1, 17, 73, 4867 }, // U+2055
-    { 17, 26, 309, 1, 25, 111, 4940 }, // U+2056
-    { 31, 9, 499, 1, 24, 70, 5051 }, // U+2057
-    { 27, 26, 466, 1, 25, 176, 5121 }, // U+2058
-    { 27, 26, 466, 1, 25, 176, 5297 }, // U+2059
-    { 7, 26, 152, 1, 25, 46, 5473 }, // U+205A
-    { 21, 28, 370, 1, 27, 147, 5519 }, // U+205B
-    { 27, 27, 455, 1, 25, 183, 5666 }, // U+205C
-    { 7, 27, 150, 1, 26, 48, 5849 }, // U+205D
-    { 7, 26, 152, 1, 25, 46, 5897 }, // U+205E
-    { 0, 0, 118, 0, 0, 0, 5943 }, // U+205F
-    { 0, 0, 320, 0, 0, 0, 5943 }, // U+2060
-    { 0, 0, 320, 0, 0, 0, 5943 }, // U+2061
-    { 0, 0, 320, 0, 0, 0, 5943 }, // U+2062
-    { 0, 0, 320, 0, 0, 0, 5943 }, // U+2063
-    { 0, 0, 320, 0, 0, 0, 5943 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 5943 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 5943 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 5943 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 5943 }, // U+2069
-    { 8, 28, 0, -4, 23, 56, 5943 }, // U+206A
-    { 8, 28, 0, -4, 23, 56, 5999 }, // U+206B
-    { 8, 28, 0, -4, 23, 56, 6055 }, // U+206C
-    { 8, 29, 0, -4, 24, 58, 6111 }, // U+206D
-    { 8, 28, 0, -4, 23, 56, 6169 }, // U+206E
-    { 8, 28, 0, -4, 23, 56, 6225 }, // U+206F
+    { 15, 4, 267, 1, 11, 15, 7269 }, // U+2013
+    { 32, 4, 533, 1, 11, 32, 7284 }, // U+2014
+    { 32, 4, 533, 1, 11, 32, 174 }, // U+2015
+    { 13, 34, 294, 3, 26, 111, 206 }, // U+2016
+    { 15, 8, 219, -1, 0, 30, 317 }, // U+2017
+    { 7, 9, 116, 0, 24, 16, 347 }, // U+2018
+    { 7, 9, 116, 0, 24, 16, 7316 }, // U+2019
+    { 8, 9, 153, 0, 5, 18, 363 }, // U+201A
+    { 7, 9, 116, 0, 24, 16, 381 }, // U+201B
+    { 15, 9, 237, 0, 24, 34, 7332 }, // U+201C
+    { 15, 9, 237, 0, 24, 34, 7366 }, // U+201D
+    { 15, 9, 274, 1, 4, 34, 397 }, // U+201E
+    { 15, 9, 237, 0, 24, 34, 431 }, // U+201F
+    { 15, 26, 274, 1, 26, 98, 465 }, // U+2020
+    { 15, 26, 277, 1, 26, 98, 563 }, // U+2021
+    { 10, 11, 201, 1, 18, 28, 661 }, // U+2022
+    { 12, 13, 201, 1, 19, 39, 689 }, // U+2023
+    { 7, 7, 267, 5, 6, 13, 728 }, // U+2024
+    { 17, 7, 307, 1, 6, 30, 741 }, // U+2025
+    { 26, 7, 456, 1, 6, 46, 7400 }, // U+2026
+    { 7, 7, 150, 1, 12, 13, 771 }, // U+2027
+    { 0, 0, 320, 0, 0, 0, 784 }, // U+2028
+    { 0, 0, 320, 0, 0, 0, 784 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 784 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 843 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 902 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 958 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 1014 }, // U+202E
+    { 0, 0, 89, 0, 0, 0, 1070 }, // U+202F
+    { 41, 26, 683, 1, 25, 267, 1070 }, // U+2030
+    { 55, 26, 889, 0, 25, 358, 1337 }, // U+2031
+    { 10, 9, 162, 1, 24, 23, 1695 }, // U+2032
+    { 17, 9, 279, 1, 24, 39, 1718 }, // U+2033
+    { 25, 9, 397, 1, 24, 57, 1757 }, // U+2034
+    { 10, 9, 225, 1, 24, 23, 1814 }, // U+2035
+    { 17, 9, 343, 1, 24, 39, 1837 }, // U+2036
+    { 25, 9, 461, 1, 24, 57, 1876 }, // U+2037
+    { 13, 11, 218, 0, 3, 36, 1933 }, // U+2038
+    { 10, 16, 195, 1, 17, 40, 1969 }, // U+2039
+    { 10, 16, 195, 1, 17, 40, 2009 }, // U+203A
+    { 26, 26, 453, 1, 25, 169, 2049 }, // U+203B
+    { 17, 25, 304, 1, 24, 107, 2218 }, // U+203C
+    { 16, 26, 254, 0, 25, 104, 2325 }, // U+203D
+    { 18, 4, 267, -1, 29, 18, 2429 }, // U+203E
+    { 20, 8, 325, 0, 0, 40, 2447 }, // U+203F
+    { 20, 8, 325, 0, 27, 40, 2487 }, // U+2040
+    { 14, 22, 226, 0, 14, 77, 2527 }, // U+2041
+    { 37, 31, 597, 0, 26, 287, 2604 }, // U+2042
+    { 10, 5, 171, 1, 11, 13, 2891 }, // U+2043
+    { 18, 24, 69, -7, 24, 108, 2904 }, // U+2044
+    { 9, 30, 177, 2, 24, 68, 3012 }, // U+2045
+    { 9, 30, 177, 0, 24, 68, 3080 }, // U+2046
+    { 31, 26, 506, 0, 25, 202, 3148 }, // U+2047
+    { 24, 26, 407, 0, 25, 156, 3350 }, // U+2048
+    { 24, 26, 407, 1, 25, 156, 3506 }, // U+2049
+    { 17, 19, 314, 1, 19, 81, 3662 }, // U+204A
+    { 18, 31, 346, 2, 26, 140, 3743 }, // U+204B
+    { 18, 18, 349, 1, 19, 81, 3883 }, // U+204C
+    { 19, 18, 349, 2, 19, 86, 3964 }, // U+204D
+    { 18, 17, 289, 0, 9, 77, 4050 }, // U+204E
+    { 8, 24, 152, 1, 19, 48, 4127 }, // U+204F
+    { 20, 35, 320, 0, 27, 175, 4175 }, // U+2050
+    { 18, 34, 289, 0, 26, 153, 4350 }, // U+2051
+    { 14, 26, 225, 0, 25, 91, 4503 }, // U+2052
+    { 32, 7, 533, 1, 13, 56, 4594 }, // U+2053
+    { 20, 8, 320, 0, 0, 40, 4650 }, // U+2054
+    { 17, 17, 299, 1, 17, 73, 4690 }, // U+2055
+    { 17, 26, 309, 1, 25, 111, 4763 }, // U+2056
+    { 31, 9, 499, 1, 24, 70, 4874 }, // U+2057
+    { 27, 26, 466, 1, 25, 176, 4944 }, // U+2058
+    { 27, 26, 466, 1, 25, 176, 5120 }, // U+2059
+    { 7, 26, 152, 1, 25, 46, 5296 }, // U+205A
+    { 21, 28, 370, 1, 27, 147, 5342 }, // U+205B
+    { 27, 27, 455, 1, 25, 183, 5489 }, // U+205C
+    { 7, 27, 150, 1, 26, 48, 5672 }, // U+205D
+    { 7, 26, 152, 1, 25, 46, 5720 }, // U+205E
+    { 0, 0, 118, 0, 0, 0, 5766 }, // U+205F
+    { 0, 0, 320, 0, 0, 0, 5766 }, // U+2060
+    { 0, 0, 320, 0, 0, 0, 5766 }, // U+2061
+    { 0, 0, 320, 0, 0, 0, 5766 }, // U+2062
+    { 0, 0, 320, 0, 0, 0, 5766 }, // U+2063
+    { 0, 0, 320, 0, 0, 0, 5766 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 5766 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 5766 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 5766 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 5766 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 5766 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 5822 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 5878 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 5934 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 5992 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 6048 }, // U+206F
     { 12, 16, 202, 0, 29, 48, 0 }, // U+2070
     { 5, 16, 103, 1, 25, 20, 48 }, // U+2071
     { 13, 16, 203, 0, 29, 52, 68 }, // U+2074
@@ -3446,13 +3451,13 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 15, 32, 305, 3, 28, 120, 4412 }, // U+20BF
     { 16, 25, 279, 1, 19, 100, 4532 }, // U+20C0
     { 17, 5, 310, 1, 14, 22, 0 }, // U+2212
-    { 28, 26, 412, 0, 26, 182, 0 }, // U+FB00
-    { 21, 26, 365, 0, 26, 137, 182 }, // U+FB01
-    { 21, 26, 369, 0, 26, 137, 319 }, // U+FB02
-    { 34, 26, 571, 0, 26, 221, 456 }, // U+FB03
-    { 34, 26, 575, 0, 26, 221, 677 }, // U+FB04
-    { 23, 27, 417, 2, 26, 156, 898 }, // U+FB05
-    { 29, 27, 496, 1, 26, 196, 1054 }, // U+FB06
+    { 28, 26, 412, 0, 26, 182, 7446 }, // U+FB00
+    { 21, 26, 365, 0, 26, 137, 7628 }, // U+FB01
+    { 21, 26, 369, 0, 26, 137, 7765 }, // U+FB02
+    { 34, 26, 571, 0, 26, 221, 7902 }, // U+FB03
+    { 34, 26, 575, 0, 26, 221, 8123 }, // U+FB04
+    { 23, 27, 417, 2, 26, 156, 0 }, // U+FB05
+    { 29, 27, 496, 1, 26, 196, 156 }, // U+FB06
     { 31, 32, 533, 1, 26, 248, 0 }, // U+FFFD
 };
 
@@ -3460,8 +3465,7 @@ static const EpdUnicodeInterval notosans_16_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3469,8 +3473,7 @@ static const EpdUnicodeInterval notosans_16_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3480,19 +3483,57 @@ static const EpdUnicodeInterval notosans_16_boldIntervals[] = {
 };
 
 static const EpdFontGroup notosans_16_boldGroups[] = {
-    { 0, 3867, 9957, 97, 0 },
-    { 3867, 3553, 11997, 96, 97 },
-    { 7420, 4469, 18572, 128, 193 },
-    { 11889, 4247, 16734, 96, 321 },
-    { 16136, 1515, 2654, 112, 417 },
-    { 17651, 11349, 38711, 256, 529 },
-    { 29000, 2915, 16005, 90, 785 },
-    { 31915, 2524, 6819, 111, 875 },
-    { 34439, 708, 1747, 42, 986 },
-    { 35147, 2235, 4901, 33, 1028 },
-    { 37382, 17, 25, 1, 1061 },
-    { 37399, 402, 1340, 7, 1062 },
-    { 37801, 139, 256, 1, 1069 },
+    { 0, 3259, 9065, 83, 2 },
+    { 3259, 978, 2176, 26, 0 },
+    { 4237, 3538, 11862, 95, 97 },
+    { 7775, 4469, 18572, 128, 193 },
+    { 12244, 4247, 16734, 96, 321 },
+    { 16491, 1515, 2654, 112, 417 },
+    { 18006, 11349, 38711, 256, 529 },
+    { 29355, 2915, 16005, 90, 785 },
+    { 32270, 2456, 6632, 105, 875 },
+    { 34726, 708, 1747, 42, 986 },
+    { 35434, 2235, 4901, 33, 1028 },
+    { 37669, 17, 25, 1, 1061 },
+    { 37686, 199, 378, 2, 1067 },
+    { 37885, 139, 256, 1, 1069 },
+};
+
+static const uint16_t notosans_16_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_16_boldKernLeftClasses[] = {
@@ -4552,18 +4593,81 @@ static const EpdLigaturePair notosans_16_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_16_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 70, 49 }, { 0x0265, 66, 51 }, { 0x0266, 71, 60 }, { 0x0267, 0, 0 }, { 0x0268, 72, 61 }, // U+0450
+    { 0x0269, 73, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 74, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_16_bold = {
     notosans_16_boldBitmaps,
     notosans_16_boldGlyphs,
     notosans_16_boldIntervals,
-    20,
+    18,
     45,
     36,
     -10,
     true,
     notosans_16_boldGroups,
-    13,
-    nullptr,
+    14,
+    notosans_16_boldGlyphToGroup,
     notosans_16_boldKernLeftClasses,
     notosans_16_boldKernRightClasses,
     notosans_16_boldKernMatrix,
@@ -4573,4 +4677,8 @@ static const EpdFontData notosans_16_bold = {
     76,
     notosans_16_boldLigaturePairs,
     5,
+    notosans_16_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2572 +3,2576 @@
  * name: notosans_16_italic
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_italicBitmaps[41094] = {
-    0xB5, 0x5A, 0xBF, 0xB3, 0xE4, 0x56, 0x95, 0x3E, 0x92, 0xFC, 0x46, 0x5B, 0x28, 0x90, 0x03, 0x0F,
-    0x50, 0x4C, 0x2D, 0x22, 0x00, 0x8A, 0xA5, 0x6A, 0xAD, 0x7F, 0x60, 0xBA, 0x25, 0x43, 0x40, 0xB0,
-    0xC1, 0x3A, 0xF0, 0xB3, 0x8B, 0x72, 0x30, 0xB9, 0x37, 0x78, 0x09, 0xE1, 0xEB, 0x96, 0x3C, 0x1B,
-    0x38, 0x70, 0x60, 0x27, 0x10, 0x3B, 0x30, 0x45, 0xF1, 0x26, 0x30, 0xC1, 0x06, 0x53, 0x4B, 0xFF,
-    0x90, 0x97, 0xC0, 0xC1, 0x06, 0x56, 0xD5, 0x2E, 0x45, 0x88, 0x80, 0x71, 0x6D, 0x61, 0x82, 0x91,
-    0xB1, 0x8C, 0x35, 0x0F, 0x75, 0x6B, 0xBF, 0xEF, 0xDC, 0x2B, 0x75, 0xF7, 0x7B, 0x3D, 0x63, 0x43,
-    0x41, 0xCF, 0xEB, 0xDB, 0x6F, 0xD4, 0xD2, 0xB9, 0xE7, 0x9E, 0xFB, 0x9D, 0xEF, 0xFC, 0xB8, 0x4F,
-    0xA2, 0x42, 0xE2, 0x42, 0x92, 0x5C, 0x92, 0x54, 0x12, 0x91, 0x4C, 0x64, 0x25, 0xB2, 0x14, 0xE9,
-    0xF4, 0xA7, 0x15, 0xA7, 0x11, 0xB7, 0x16, 0x0F, 0x3F, 0x95, 0x78, 0xA5, 0xF8, 0x85, 0x38, 0xA9,
-    0x98, 0x57, 0x84, 0x27, 0x0A, 0xC9, 0x0A, 0x3E, 0xFA, 0x94, 0x48, 0xF8, 0x6A, 0x13, 0xDD, 0x6D,
-    0xE2, 0xEF, 0xD6, 0xB1, 0x57, 0x27, 0x5E, 0x39, 0xF1, 0x8A, 0xDB, 0x3E, 0x7E, 0xF2, 0x1F, 0xF8,
-    0x78, 0x60, 0x22, 0xFF, 0x81, 0x27, 0xCE, 0xA5, 0xC6, 0xB8, 0x70, 0x38, 0x36, 0x6E, 0x85, 0xB1,
-    0x86, 0x4C, 0x71, 0x6A, 0x88, 0xC5, 0x04, 0x41, 0x21, 0x5F, 0xB8, 0x77, 0xF9, 0xCE, 0x87, 0x79,
-    0xD8, 0xE3, 0x95, 0x9F, 0xDC, 0xF9, 0x65, 0x76, 0x9A, 0x4A, 0x98, 0x4E, 0x71, 0x63, 0x08, 0x11,
-    0x98, 0x12, 0x22, 0x44, 0xA6, 0x72, 0x5F, 0x28, 0xB2, 0x15, 0xE1, 0x8D, 0x9D, 0x1D, 0xA5, 0xF1,
-    0xAE, 0x8B, 0xCC, 0x31, 0x96, 0x21, 0x34, 0xF0, 0x8B, 0x08, 0x5F, 0x06, 0x79, 0xAC, 0xBA, 0x3B,
-    0x1C, 0x78, 0x19, 0x82, 0xF1, 0x3A, 0xC3, 0x6F, 0x41, 0xBF, 0xC5, 0xFA, 0xFB, 0x5E, 0x64, 0x33,
-    0xF9, 0xAA, 0xB8, 0xCD, 0x6D, 0x3C, 0x59, 0x9F, 0x53, 0xC8, 0x7D, 0xFE, 0x06, 0xFD, 0xDD, 0x96,
-    0x8A, 0xF7, 0x1C, 0x92, 0x0D, 0x06, 0xBF, 0xA7, 0xF4, 0x1E, 0x93, 0x7A, 0xBF, 0xC0, 0x45, 0xEF,
-    0xDD, 0x06, 0xD7, 0x5E, 0xC5, 0x10, 0xDC, 0x6D, 0x24, 0x0D, 0xBF, 0x57, 0xCB, 0xA3, 0xF0, 0xAC,
-    0xA4, 0x76, 0xA9, 0x9C, 0xF5, 0xD0, 0x56, 0xE6, 0x9C, 0xEC, 0xF6, 0x38, 0x9C, 0xCB, 0xF8, 0xCA,
-    0x4A, 0x71, 0x2B, 0x17, 0xB2, 0x83, 0xC2, 0xAF, 0x5A, 0xD8, 0x36, 0xCC, 0x17, 0x58, 0x68, 0x24,
-    0x0B, 0xFC, 0x7B, 0x56, 0x6D, 0x36, 0x91, 0xFB, 0x58, 0x1A, 0x96, 0x1D, 0xE6, 0x78, 0xB2, 0xC1,
-    0x42, 0xCE, 0x9D, 0xFA, 0xFC, 0x2B, 0xE9, 0xB9, 0x57, 0x35, 0x7D, 0x3D, 0xF1, 0x7F, 0xF1, 0xBB,
-    0xCB, 0x36, 0x39, 0x7B, 0xFD, 0xBD, 0x72, 0x11, 0x6D, 0xA3, 0x30, 0x3F, 0xBF, 0xF1, 0x60, 0xA2,
-    0xF6, 0x6A, 0x63, 0x8C, 0x6E, 0x3D, 0x85, 0x20, 0xBF, 0x80, 0x10, 0xAC, 0x7B, 0x22, 0x0D, 0x84,
-    0x4F, 0x20, 0x74, 0x21, 0x13, 0xAF, 0xC2, 0x67, 0x12, 0x14, 0x10, 0x1E, 0xF5, 0x98, 0x57, 0x82,
-    0x8D, 0xAA, 0xF4, 0xFC, 0xA8, 0xDC, 0xBA, 0xD1, 0xD5, 0xF2, 0x72, 0xF4, 0x9B, 0x35, 0x97, 0x9F,
-    0xC6, 0xB0, 0x58, 0x42, 0x08, 0x50, 0x49, 0x1D, 0x13, 0x5E, 0x27, 0x7A, 0x24, 0xF6, 0xB9, 0xD6,
-    0xA8, 0x2F, 0x69, 0xDE, 0x2D, 0x05, 0xC4, 0x14, 0xE0, 0x62, 0x8F, 0x4E, 0x24, 0x68, 0x56, 0xB8,
-    0x2D, 0xCE, 0x13, 0x18, 0x23, 0x93, 0xA8, 0xE8, 0x80, 0xB6, 0xE0, 0xB7, 0x0D, 0xD0, 0xE6, 0xFD,
-    0xB9, 0x22, 0xE6, 0xFA, 0x42, 0x47, 0x02, 0xD1, 0x83, 0x81, 0x93, 0x37, 0xCF, 0x1E, 0x96, 0x12,
-    0xF7, 0x3D, 0xCC, 0xE9, 0xF7, 0xAD, 0x8B, 0xEF, 0x6E, 0xEA, 0xE6, 0xE5, 0x51, 0x1E, 0xA7, 0x31,
-    0x64, 0x4D, 0x60, 0xCC, 0xDB, 0xF2, 0x03, 0x5C, 0xBB, 0x4F, 0xAC, 0x06, 0x58, 0x46, 0x4E, 0x6D,
-    0x96, 0xE2, 0xB4, 0x44, 0xAE, 0x5F, 0x49, 0x58, 0xF0, 0x27, 0x52, 0x88, 0x27, 0x54, 0x56, 0x66,
-    0x8A, 0xF2, 0xC5, 0xE1, 0xCF, 0x4C, 0x7F, 0xA6, 0x7A, 0x4F, 0xAC, 0xF8, 0x00, 0x7E, 0x88, 0x77,
-    0xAF, 0x20, 0xFE, 0x21, 0x1C, 0x76, 0x23, 0xEC, 0xBA, 0xBD, 0x87, 0x96, 0xC3, 0xCF, 0x62, 0xF0,
-    0x9A, 0x8E, 0x13, 0xBB, 0xCD, 0xDE, 0xDC, 0x39, 0xC5, 0xCD, 0xF9, 0x0D, 0x2E, 0xF3, 0x9A, 0x2A,
-    0xF8, 0x0C, 0xD7, 0x41, 0x0C, 0xE2, 0x19, 0x4A, 0xC5, 0x36, 0x7C, 0x9D, 0x5B, 0xF1, 0x5C, 0x25,
-    0xD9, 0x9F, 0x0A, 0xB9, 0xD1, 0xFF, 0x61, 0x2B, 0x21, 0x50, 0x19, 0x57, 0xDF, 0x97, 0x8E, 0x4E,
-    0xD8, 0x48, 0x58, 0x2E, 0xF0, 0xF0, 0x4C, 0x5C, 0x35, 0xF7, 0x3F, 0x11, 0xDC, 0x8F, 0x7D, 0xAF,
-    0x01, 0x3C, 0xBE, 0x4F, 0x5F, 0xFA, 0xE0, 0xF4, 0xB1, 0xF7, 0x61, 0x75, 0x4E, 0xE7, 0xB6, 0x5E,
-    0xED, 0x57, 0x61, 0x11, 0xC2, 0x3B, 0x26, 0x50, 0xEB, 0xE4, 0x34, 0x8D, 0xFB, 0x22, 0xE9, 0x8B,
-    0x9B, 0xF0, 0x3F, 0x98, 0x2D, 0x29, 0xB2, 0x22, 0x49, 0x9F, 0xB2, 0x4E, 0xAF, 0xE6, 0xD1, 0x15,
-    0x1B, 0xCD, 0x5D, 0x6E, 0xAE, 0x47, 0xAF, 0xC0, 0x52, 0x85, 0xC6, 0xB7, 0x77, 0xCC, 0xAF, 0xDF,
-    0x11, 0x94, 0xC3, 0x6D, 0x87, 0x77, 0x38, 0xED, 0xF5, 0x3B, 0x08, 0x31, 0x12, 0xD2, 0xF0, 0x72,
-    0xE8, 0x69, 0x01, 0x1D, 0x3D, 0xF9, 0x00, 0xA8, 0x5A, 0x43, 0x84, 0xD3, 0xE1, 0x2E, 0xAF, 0xC1,
-    0x9C, 0x7E, 0x8D, 0x87, 0xF0, 0x2C, 0x16, 0xC1, 0xBD, 0x06, 0xAD, 0x45, 0x00, 0x88, 0x10, 0x23,
-    0x18, 0xB8, 0x9F, 0xA9, 0xEE, 0xFD, 0x30, 0xCC, 0x0D, 0x42, 0x12, 0x4E, 0x9F, 0xC0, 0xB3, 0x01,
-    0x69, 0x4C, 0x1F, 0xE5, 0x21, 0x36, 0xE7, 0x01, 0x38, 0xCD, 0x27, 0x1B, 0x38, 0x3D, 0x15, 0x3F,
-    0xE1, 0xE4, 0xD8, 0xFB, 0xA8, 0x96, 0x75, 0xED, 0xF7, 0x55, 0xF2, 0x7F, 0x65, 0xF6, 0x2F, 0xC5,
-    0xB7, 0x2C, 0xA6, 0x72, 0xEA, 0x39, 0xC2, 0x6A, 0xBE, 0x23, 0x4F, 0x83, 0x01, 0x4B, 0x9E, 0x8A,
-    0x04, 0x5D, 0x9A, 0x71, 0xA8, 0x96, 0x2B, 0x01, 0x2D, 0x24, 0x1F, 0xAC, 0x0B, 0xF9, 0xAA, 0x84,
-    0x24, 0x2E, 0xBF, 0x1E, 0x6C, 0xA0, 0x83, 0xCF, 0x6B, 0x21, 0x1F, 0x89, 0x46, 0x7B, 0xD1, 0x03,
-    0xBD, 0x66, 0xB8, 0x9E, 0xC1, 0x40, 0x8E, 0x12, 0x11, 0x2F, 0xC5, 0xBC, 0x8B, 0xCE, 0xE9, 0xD1,
-    0x96, 0x2A, 0x31, 0xF9, 0xF0, 0xE2, 0xA7, 0xA4, 0xB4, 0x0D, 0x87, 0x6E, 0x30, 0x23, 0x27, 0x8F,
-    0xC6, 0xC9, 0xFF, 0xD9, 0xC8, 0xD2, 0xD9, 0x76, 0xC3, 0x6E, 0x27, 0x21, 0xF1, 0xC6, 0x3B, 0x78,
-    0x22, 0xC4, 0x03, 0x18, 0xF4, 0xDE, 0x76, 0xD0, 0x45, 0xDD, 0xDD, 0xEC, 0x51, 0x36, 0xEE, 0xE7,
-    0x46, 0xBE, 0x26, 0x70, 0xD3, 0xE9, 0xF3, 0x51, 0x23, 0x49, 0x8F, 0x27, 0x6E, 0xD1, 0x96, 0x72,
-    0xD3, 0xC4, 0x0D, 0x9D, 0x2D, 0xA1, 0x78, 0x38, 0x3A, 0x38, 0x01, 0x43, 0xF0, 0x6B, 0x4C, 0x14,
-    0xBD, 0x81, 0xEF, 0x33, 0xB2, 0x73, 0x97, 0xD0, 0x02, 0x09, 0x6F, 0x9D, 0x73, 0xDF, 0x96, 0x9C,
-    0x66, 0x41, 0x7B, 0x76, 0xB4, 0x4C, 0x0B, 0xE5, 0xF0, 0x7B, 0x42, 0xEB, 0x62, 0x59, 0x7D, 0x4D,
-    0x8C, 0x57, 0xAF, 0x5C, 0xDC, 0xBB, 0x84, 0x14, 0x9F, 0xD2, 0x83, 0x62, 0x58, 0xC1, 0xB8, 0x0C,
-    0x18, 0x1B, 0xDB, 0xC5, 0x01, 0x2B, 0xCF, 0x8D, 0x31, 0x19, 0x56, 0xE8, 0xEF, 0xEA, 0xB9, 0x06,
-    0x86, 0xA2, 0x3C, 0xF5, 0xC9, 0xDB, 0xA4, 0x75, 0xDC, 0x86, 0x01, 0x3B, 0x91, 0xEA, 0x7A, 0x9D,
-    0x6E, 0x5C, 0xF4, 0xF2, 0x70, 0x50, 0x84, 0xB7, 0xA0, 0xCB, 0xA0, 0x96, 0xE5, 0x73, 0x99, 0x3A,
-    0x5E, 0x0A, 0xC6, 0xE2, 0x53, 0xCF, 0xEC, 0xE0, 0x0B, 0x6E, 0xC5, 0x72, 0x31, 0x84, 0xDB, 0x17,
-    0x61, 0x81, 0xD2, 0x5A, 0x4F, 0xE5, 0xEE, 0x6D, 0xB8, 0xAA, 0x7D, 0x77, 0x0B, 0x01, 0x77, 0x80,
-    0xF7, 0x64, 0x75, 0x07, 0x46, 0xAC, 0x88, 0xCF, 0x1C, 0x13, 0x65, 0x9C, 0x4D, 0x79, 0x64, 0x36,
-    0x0E, 0x73, 0x51, 0x6B, 0x40, 0x44, 0x92, 0x06, 0x95, 0x44, 0x15, 0xD0, 0x1B, 0x30, 0x8C, 0xB9,
-    0x23, 0x7A, 0xC1, 0x9E, 0x3D, 0xB7, 0x42, 0x87, 0xED, 0x11, 0xBF, 0x2D, 0x0F, 0xFC, 0x76, 0x75,
-    0x70, 0x87, 0x7F, 0xC4, 0xB3, 0xC7, 0x3B, 0xBC, 0xC3, 0x3B, 0xE2, 0xFC, 0x80, 0x1D, 0xCC, 0xCB,
-    0xA5, 0xDF, 0x46, 0x8C, 0x1E, 0xD9, 0x0F, 0x19, 0x5D, 0xA1, 0x27, 0x34, 0x8E, 0x72, 0xA7, 0x19,
-    0x87, 0xD6, 0x38, 0x22, 0xC4, 0x66, 0x7E, 0x6B, 0x43, 0x47, 0xA4, 0x0E, 0x08, 0x7B, 0x05, 0x4D,
-    0x84, 0x00, 0x40, 0x0F, 0xCF, 0x68, 0xE7, 0x25, 0x4D, 0xA6, 0x1E, 0xA6, 0xC3, 0x86, 0xD7, 0xD6,
-    0xD4, 0x21, 0x29, 0xE3, 0xCA, 0x6C, 0xAF, 0xDB, 0x3F, 0x1A, 0xFC, 0x96, 0xAF, 0x00, 0x97, 0xB2,
-    0xBE, 0x76, 0xFA, 0x97, 0x3A, 0xE8, 0xBB, 0x81, 0x1B, 0xCE, 0xA1, 0x6D, 0xC2, 0x28, 0x41, 0xDF,
-    0xB5, 0xEF, 0x0C, 0xFF, 0xDF, 0x86, 0x85, 0xB7, 0x09, 0x9B, 0xB3, 0x8D, 0xD7, 0x6F, 0x3A, 0x59,
-    0x57, 0x98, 0x01, 0x0A, 0xAA, 0x91, 0xB8, 0x3B, 0xB4, 0x13, 0x97, 0xB8, 0x96, 0xB7, 0x6F, 0x31,
-    0xEB, 0xA8, 0x85, 0xFA, 0x69, 0x42, 0xF4, 0xB4, 0x6C, 0x5C, 0xFC, 0x53, 0x1E, 0xBB, 0xF6, 0xDA,
-    0x63, 0x50, 0x47, 0xA5, 0xC4, 0xFA, 0xA3, 0xF6, 0x7C, 0xC2, 0x0B, 0xEB, 0xF4, 0x34, 0x82, 0x29,
-    0xAF, 0x91, 0x7A, 0xA7, 0x9A, 0x33, 0x3C, 0xBD, 0xBB, 0x25, 0x10, 0xEB, 0xF4, 0x01, 0xB7, 0x75,
-    0x4D, 0x82, 0x24, 0x44, 0xD7, 0xA5, 0xFD, 0x25, 0xE3, 0xCE, 0xAE, 0x95, 0x48, 0x4D, 0x08, 0xE6,
-    0x94, 0xF1, 0x66, 0x60, 0x53, 0xB9, 0xB5, 0x1D, 0x04, 0x88, 0xBF, 0x97, 0x8C, 0x00, 0x2A, 0x7C,
-    0x5F, 0x55, 0xE8, 0x95, 0x8B, 0x8B, 0x9F, 0xDA, 0xEF, 0xF4, 0x39, 0x79, 0x6B, 0xC7, 0x01, 0x4A,
-    0x1D, 0xDB, 0xF1, 0xD7, 0x1B, 0x26, 0xEE, 0xF3, 0x57, 0x77, 0x9C, 0xE3, 0xD6, 0x86, 0xF3, 0xD2,
-    0x88, 0xAD, 0xCD, 0x9E, 0x54, 0xAB, 0x55, 0x3A, 0x88, 0xDA, 0xE3, 0xFA, 0x86, 0xA8, 0x95, 0xE8,
-    0x83, 0x75, 0xFE, 0x0F, 0x4A, 0x80, 0xE1, 0xDE, 0x9B, 0x86, 0x23, 0xCA, 0xB6, 0x86, 0x8B, 0x38,
-    0xCB, 0x3A, 0x55, 0x4F, 0xD2, 0x9D, 0x2A, 0x0C, 0x05, 0x38, 0x07, 0x3B, 0x20, 0xF4, 0x20, 0xC9,
-    0x72, 0xC3, 0x54, 0xD6, 0x2F, 0x5F, 0xF9, 0x3D, 0xC7, 0x5B, 0xBD, 0xDA, 0xA2, 0xFF, 0xFD, 0xBF,
-    0x6D, 0x8C, 0x40, 0x10, 0x2B, 0xB7, 0x19, 0x53, 0x71, 0x6D, 0x7E, 0x89, 0x5D, 0x75, 0x20, 0x1A,
-    0x89, 0x52, 0xBF, 0x71, 0xEA, 0xA0, 0xA0, 0x7B, 0x35, 0x08, 0x96, 0x39, 0xF2, 0xA8, 0x08, 0x80,
-    0xD4, 0x6C, 0xAC, 0x05, 0x8D, 0x34, 0x53, 0x87, 0x04, 0x55, 0x4F, 0xA0, 0x47, 0xE3, 0xD4, 0x9A,
-    0x5A, 0xB9, 0xFC, 0xC0, 0xC3, 0xC8, 0x88, 0x2B, 0x1F, 0x0F, 0xE3, 0xBB, 0xA8, 0x8E, 0xD2, 0xA9,
-    0xB3, 0xED, 0xB6, 0x5B, 0x2C, 0x63, 0x5D, 0xC3, 0x08, 0x51, 0x7A, 0x22, 0x27, 0xA9, 0x71, 0x22,
-    0xCB, 0x04, 0x42, 0x12, 0x65, 0x62, 0x2D, 0xEB, 0xFF, 0xFD, 0x62, 0xA7, 0x04, 0xA2, 0x1C, 0xEE,
-    0xAC, 0xB7, 0xE9, 0xBE, 0xA9, 0xD4, 0xDD, 0x74, 0x8B, 0xC9, 0xD0, 0x4C, 0x99, 0xC4, 0x27, 0xA1,
-    0x86, 0xEF, 0xD3, 0x52, 0x6F, 0x60, 0x48, 0x68, 0x8D, 0x39, 0x87, 0x0E, 0x48, 0x72, 0x1B, 0x90,
-    0x24, 0xE3, 0x3D, 0x60, 0xE5, 0x31, 0x3D, 0x81, 0xAE, 0x31, 0xB1, 0x9C, 0x71, 0xD8, 0x5E, 0xDC,
-    0xAB, 0x1D, 0xA6, 0x29, 0xB8, 0x8A, 0x3B, 0x2B, 0x90, 0x0B, 0x94, 0x72, 0x5A, 0xDA, 0x83, 0xC4,
-    0x2C, 0xDD, 0x4A, 0x5D, 0x3F, 0xEE, 0x1F, 0x08, 0xD9, 0x24, 0xE7, 0x50, 0x81, 0x84, 0x48, 0x7E,
-    0x84, 0xEB, 0x92, 0xFE, 0xD8, 0xD9, 0xA1, 0x81, 0xE5, 0xFC, 0x1A, 0x34, 0x12, 0x95, 0xDE, 0xF6,
-    0x5E, 0x4F, 0x42, 0x7D, 0xC0, 0xA1, 0xE5, 0x12, 0xD7, 0xC4, 0x75, 0x9C, 0x6B, 0x1C, 0x35, 0x41,
-    0x3B, 0xE7, 0x80, 0x78, 0x5D, 0xD0, 0x25, 0x19, 0xB4, 0x41, 0x58, 0x17, 0xEF, 0x74, 0x46, 0xB3,
-    0xB5, 0xC5, 0x9C, 0xE2, 0x0A, 0x20, 0x72, 0x69, 0x8E, 0x68, 0x7B, 0xAF, 0x21, 0xC8, 0x9F, 0x26,
-    0x16, 0x4C, 0xE4, 0xF3, 0xEB, 0x83, 0xB8, 0xB9, 0xA3, 0xA4, 0x64, 0x0C, 0x53, 0xAB, 0x23, 0x43,
-    0x36, 0xDE, 0xA2, 0xC1, 0x29, 0xAA, 0xD4, 0xA9, 0x4E, 0xEF, 0x73, 0x1E, 0x42, 0x82, 0xEB, 0x95,
-    0x17, 0x74, 0xEE, 0xB7, 0x45, 0x97, 0x9E, 0x8A, 0x59, 0x3B, 0x16, 0x1F, 0xB5, 0x64, 0x3C, 0xEE,
-    0xD7, 0x52, 0x51, 0xD9, 0x89, 0xA1, 0x6A, 0xA6, 0x28, 0xAD, 0x98, 0x58, 0x65, 0x38, 0xFA, 0xCA,
-    0xC8, 0x9D, 0xCE, 0x34, 0x31, 0x58, 0xE9, 0xE6, 0x77, 0x1C, 0x21, 0x07, 0xA6, 0xF0, 0x89, 0x0A,
-    0xC6, 0x71, 0x72, 0x13, 0xE8, 0x0A, 0xF9, 0x20, 0x9E, 0xB8, 0x58, 0xAB, 0x32, 0x74, 0xA2, 0xB5,
-    0xAA, 0xC4, 0xBD, 0x2B, 0xA9, 0x48, 0x61, 0x86, 0xF9, 0xC8, 0xBE, 0xBB, 0xA8, 0x36, 0x66, 0x58,
-    0x86, 0xF2, 0xB7, 0x17, 0x6F, 0x73, 0x13, 0x1A, 0x33, 0x28, 0xD8, 0x76, 0x59, 0xD7, 0x8E, 0xE9,
-    0x35, 0xD5, 0x8B, 0xC7, 0x7C, 0x2F, 0xB9, 0xB8, 0x20, 0x8D, 0x62, 0x8A, 0x35, 0xB7, 0xFD, 0xAF,
-    0x98, 0x57, 0x53, 0x9B, 0xCB, 0x61, 0x72, 0x9F, 0x9B, 0x7A, 0x74, 0xDE, 0xFC, 0x70, 0xDE, 0x31,
-    0xB1, 0x58, 0xEE, 0xC3, 0x5E, 0x01, 0xE8, 0x2A, 0x49, 0x45, 0xDB, 0x8B, 0xAD, 0x52, 0xDD, 0x97,
-    0xB5, 0x6E, 0xC0, 0x24, 0x3A, 0xBB, 0x02, 0xC1, 0x20, 0xC1, 0x40, 0xC1, 0x08, 0x35, 0x02, 0xB9,
-    0x33, 0xD0, 0x24, 0x83, 0x2E, 0xAD, 0x56, 0x1A, 0x0D, 0x61, 0x00, 0x15, 0xF7, 0xC7, 0x4C, 0x5D,
-    0x31, 0x51, 0xF3, 0x24, 0x26, 0xDD, 0xD3, 0x7C, 0x1E, 0xB8, 0x58, 0xE7, 0x3A, 0x79, 0x4A, 0x45,
-    0x18, 0x6C, 0x14, 0x1A, 0x9C, 0xC0, 0xD3, 0x07, 0xC6, 0xC7, 0xE6, 0xBA, 0xB2, 0x99, 0x8E, 0x4B,
-    0x5D, 0x5B, 0xA7, 0x96, 0xED, 0x78, 0xF3, 0x3E, 0x36, 0xDC, 0xED, 0x05, 0x56, 0x01, 0xCB, 0x20,
-    0x50, 0x7A, 0x5A, 0xCF, 0x72, 0x63, 0x3A, 0xB5, 0x90, 0xA2, 0xC2, 0x69, 0x15, 0x1B, 0x0D, 0x8B,
-    0x07, 0x4D, 0x55, 0x39, 0x3E, 0x79, 0x42, 0xF5, 0x93, 0x84, 0xBE, 0xF2, 0xC8, 0xEC, 0x01, 0xB7,
-    0x60, 0x08, 0x66, 0x4C, 0x95, 0x82, 0x2B, 0xA4, 0x6A, 0xAA, 0xBA, 0xDD, 0x7B, 0x6E, 0xAD, 0xDE,
-    0xED, 0x8A, 0x14, 0x57, 0xF1, 0x97, 0x03, 0x04, 0x85, 0x1C, 0x7E, 0xCB, 0xD5, 0x30, 0x5A, 0x5E,
-    0x9D, 0x88, 0x2B, 0x08, 0x9F, 0x30, 0xD1, 0xF4, 0xFA, 0x44, 0x14, 0xA5, 0x62, 0xAC, 0x28, 0x78,
-    0xC1, 0x37, 0xE8, 0x03, 0x4C, 0x5A, 0x5B, 0x1B, 0xD9, 0x63, 0xB1, 0x69, 0xF7, 0x46, 0xDD, 0xA9,
-    0xA1, 0x10, 0x6E, 0xF6, 0x92, 0xFD, 0x08, 0x80, 0x90, 0x41, 0xAE, 0xD3, 0xFC, 0xA4, 0xE3, 0x65,
-    0xA7, 0x25, 0xFF, 0xBB, 0x8D, 0xF2, 0xC4, 0xA7, 0x5A, 0x6E, 0xF4, 0x66, 0xEC, 0x34, 0xA5, 0x9D,
-    0xAB, 0x17, 0x24, 0x8A, 0x44, 0x6A, 0xA7, 0x35, 0x04, 0x0B, 0x02, 0xA6, 0x22, 0x29, 0xD7, 0x11,
-    0xA7, 0xC6, 0x67, 0x5D, 0xDD, 0x35, 0x46, 0x9B, 0xB9, 0x4E, 0xBE, 0x34, 0xE4, 0x11, 0x1F, 0xB1,
-    0xDB, 0xE2, 0xC8, 0x92, 0xAC, 0x65, 0xD8, 0xAB, 0xB8, 0x6A, 0x1D, 0x5A, 0x86, 0x5E, 0x37, 0x5A,
-    0x07, 0x2E, 0x47, 0x8F, 0x53, 0x87, 0x8B, 0xB9, 0x5F, 0x28, 0x56, 0x98, 0x87, 0xE0, 0xA3, 0xD6,
-    0x28, 0x9A, 0x51, 0x23, 0x40, 0x17, 0x1F, 0xDB, 0x5A, 0x36, 0xB5, 0x38, 0x9F, 0x22, 0x00, 0xC1,
-    0xB3, 0x3F, 0xD6, 0x0F, 0xFF, 0x57, 0x95, 0xD3, 0x00, 0x37, 0xEF, 0x95, 0x6E, 0x8D, 0x94, 0x0B,
-    0x35, 0x7E, 0x8D, 0xC4, 0x9C, 0x94, 0xBF, 0x90, 0x05, 0x3E, 0xAA, 0x85, 0xB4, 0xA8, 0x9D, 0xCA,
-    0x73, 0xB7, 0x8E, 0xD3, 0xA0, 0x98, 0x79, 0x30, 0x40, 0x58, 0x4C, 0xC2, 0x02, 0x1F, 0xF9, 0x04,
-    0x69, 0x0B, 0x54, 0x9A, 0xB2, 0x52, 0x8F, 0xD3, 0xE9, 0x0C, 0x2B, 0x8A, 0x39, 0x27, 0x0B, 0xA6,
-    0xB8, 0xC6, 0x07, 0x2A, 0xFF, 0x0A, 0xCB, 0x9A, 0xC1, 0xBB, 0x1C, 0x46, 0xBF, 0x30, 0xE7, 0x02,
-    0x49, 0xB8, 0x2D, 0xDD, 0x05, 0x58, 0x48, 0x4A, 0xCD, 0xD2, 0xB5, 0x00, 0x5A, 0xEB, 0xB8, 0x69,
-    0xB9, 0xF2, 0xB6, 0x23, 0xFC, 0xDA, 0x05, 0x00, 0xE8, 0x34, 0xD8, 0xB6, 0xC2, 0xAD, 0x13, 0x8D,
-    0x44, 0x71, 0x1A, 0xE5, 0x5E, 0x8D, 0xD0, 0x9A, 0x7A, 0xA8, 0x47, 0x63, 0xDC, 0xE5, 0x43, 0x25,
-    0xEA, 0x3D, 0xD5, 0xBB, 0x70, 0x2F, 0xB2, 0xC5, 0xA5, 0xFA, 0xD1, 0x82, 0x76, 0x5A, 0x76, 0x34,
-    0xFC, 0x54, 0x13, 0xC8, 0x84, 0x4D, 0x0D, 0x96, 0x69, 0x44, 0x3F, 0x5B, 0x1B, 0x0C, 0x4A, 0x63,
-    0x4E, 0xC3, 0xA8, 0xE9, 0x2B, 0x5F, 0xC7, 0x97, 0x67, 0xD8, 0x90, 0x75, 0xEE, 0x6C, 0xB5, 0x7C,
-    0xCA, 0x14, 0x3C, 0x9A, 0x3C, 0x9B, 0x70, 0xC4, 0x00, 0xA4, 0xE1, 0x3F, 0x51, 0x1C, 0x18, 0x4C,
-    0x64, 0xCA, 0x22, 0x73, 0x1D, 0xB5, 0xC9, 0x91, 0xAF, 0xB4, 0x11, 0xB2, 0xD2, 0xD8, 0xB1, 0xD2,
-    0x0C, 0x27, 0xD3, 0x0A, 0x21, 0x51, 0x02, 0x82, 0x01, 0x30, 0x3B, 0xF8, 0x02, 0x36, 0x08, 0xB6,
-    0x2F, 0x6A, 0x56, 0xAA, 0x1D, 0x94, 0x58, 0x6B, 0x28, 0xCB, 0x17, 0xFD, 0x5B, 0x0C, 0x22, 0x5B,
-    0x1B, 0x4A, 0xE7, 0xDC, 0xE4, 0xA5, 0x40, 0x91, 0x25, 0x6D, 0xD5, 0x0D, 0x03, 0xA3, 0x68, 0x45,
-    0xCF, 0x2F, 0xE9, 0xF2, 0x30, 0x86, 0xD3, 0xA7, 0x1E, 0xA5, 0xE9, 0x7A, 0x82, 0xCB, 0x1F, 0x7F,
-    0x26, 0x77, 0x1F, 0xE7, 0xD0, 0xBF, 0xA7, 0x4D, 0x4C, 0x2B, 0x68, 0x75, 0xDC, 0x26, 0xB1, 0xB1,
-    0x49, 0x7A, 0xC5, 0x26, 0x77, 0xCA, 0x1D, 0x6F, 0x1B, 0x0E, 0x17, 0x13, 0xF3, 0x33, 0x25, 0xEE,
-    0x6F, 0x6B, 0xD4, 0x79, 0x73, 0x67, 0x31, 0x46, 0x9D, 0x48, 0x2D, 0x56, 0x3F, 0xC9, 0x62, 0x49,
-    0xEE, 0x7D, 0xF2, 0x72, 0x6F, 0xF3, 0x0E, 0xAD, 0x28, 0xCA, 0x38, 0x1D, 0x92, 0x0E, 0xAD, 0xE1,
-    0x59, 0x37, 0xA5, 0x4A, 0xA7, 0x58, 0xB6, 0x69, 0x07, 0xD8, 0x4A, 0x6B, 0x33, 0xB8, 0xB7, 0x29,
-    0x9D, 0x37, 0x62, 0xAA, 0xC8, 0xE4, 0x12, 0x01, 0x60, 0xCD, 0xD4, 0xBF, 0x1B, 0x6A, 0x38, 0x67,
-    0xAC, 0x12, 0x4D, 0xA9, 0xD8, 0xAB, 0xF5, 0xB5, 0xA6, 0xDB, 0x8C, 0xA9, 0xB7, 0xE6, 0xC6, 0x41,
-    0x33, 0xE4, 0x2A, 0xBB, 0xDB, 0x4D, 0x19, 0xD8, 0x22, 0x91, 0xC1, 0x5A, 0xE6, 0xA7, 0x48, 0xE0,
-    0xB3, 0x5D, 0x15, 0x79, 0x6A, 0x73, 0xF2, 0x94, 0xA5, 0x6E, 0xDA, 0x6B, 0xD0, 0xBB, 0x12, 0x39,
-    0x77, 0x5B, 0x7F, 0x6C, 0xD7, 0x57, 0x07, 0xC5, 0xEA, 0xD1, 0xB8, 0x7C, 0xD8, 0x77, 0xD8, 0x49,
-    0xE7, 0xCD, 0xA1, 0x89, 0x5A, 0xAC, 0xD3, 0x20, 0x5E, 0x9D, 0xFC, 0x5A, 0x16, 0x33, 0xD7, 0x71,
-    0xB9, 0x8B, 0x57, 0x76, 0x64, 0xA5, 0xC7, 0xC9, 0xA0, 0x16, 0x1E, 0x8C, 0x75, 0x92, 0x64, 0x18,
-    0x7D, 0x66, 0x8E, 0xBB, 0xA8, 0x35, 0xD7, 0x40, 0x4D, 0x4F, 0x66, 0xFE, 0xC7, 0x58, 0x1E, 0x7D,
-    0xF2, 0x72, 0xA7, 0xD5, 0x7B, 0x6D, 0x8B, 0x41, 0x31, 0xE5, 0xD6, 0x82, 0x12, 0xF8, 0x0D, 0x88,
-    0x0C, 0x4F, 0x2E, 0x89, 0xBD, 0x19, 0x55, 0x99, 0x73, 0xB1, 0x5A, 0x21, 0x4F, 0xCD, 0x36, 0xEA,
-    0x44, 0x01, 0xA3, 0x23, 0x26, 0x88, 0xA9, 0x46, 0xAC, 0xED, 0x3D, 0xB6, 0x15, 0xA2, 0x94, 0xCB,
-    0xBA, 0x8B, 0xF5, 0x84, 0xFF, 0xCE, 0x28, 0xF3, 0x3A, 0xB9, 0xF8, 0x7D, 0xC2, 0xFC, 0xE1, 0xD0,
-    0xBA, 0x0C, 0x68, 0xAB, 0x60, 0xCC, 0x2B, 0x67, 0xB6, 0x37, 0x38, 0xD7, 0x82, 0x26, 0xE3, 0x67,
-    0xCF, 0x55, 0xCF, 0xB1, 0xBF, 0x06, 0x31, 0xDE, 0x43, 0xAE, 0x73, 0x2A, 0xC1, 0xAF, 0x09, 0x28,
-    0xB0, 0xD6, 0x1B, 0x0C, 0x1E, 0xA0, 0xCA, 0x30, 0x65, 0xD1, 0x29, 0x49, 0x98, 0x6A, 0x7B, 0x72,
-    0x16, 0x9A, 0x86, 0x54, 0x67, 0x3E, 0x1D, 0xD4, 0x13, 0xD0, 0x28, 0x21, 0xF9, 0x31, 0x6F, 0xF4,
-    0xCA, 0x90, 0x9D, 0x64, 0xA4, 0xEE, 0xAA, 0x5A, 0x12, 0xE6, 0xE1, 0x6B, 0xD0, 0x2E, 0x89, 0x25,
-    0xFC, 0x6F, 0x06, 0x76, 0x4C, 0x40, 0x45, 0xE3, 0x73, 0x4C, 0x24, 0x1A, 0x0A, 0xB4, 0x02, 0x04,
-    0x2F, 0xAB, 0xC6, 0xE3, 0x67, 0x69, 0x9A, 0x43, 0x30, 0xAB, 0x4D, 0x87, 0x72, 0xF1, 0x4C, 0x4F,
-    0xB2, 0xA4, 0xF5, 0x99, 0x3F, 0x68, 0xB6, 0x83, 0x54, 0x5D, 0x83, 0x94, 0x42, 0x40, 0x03, 0xA6,
-    0x2C, 0x15, 0x49, 0x53, 0x05, 0x50, 0xA2, 0xB8, 0x89, 0xF6, 0x32, 0x2A, 0x45, 0x36, 0x49, 0x1D,
-    0x4F, 0x3D, 0x32, 0x30, 0xD2, 0xBE, 0x53, 0xA1, 0xD3, 0xA6, 0x33, 0xB1, 0x3D, 0x36, 0xA7, 0xB3,
-    0xDB, 0xCD, 0xEC, 0x5E, 0xEB, 0xD8, 0x58, 0x7F, 0x31, 0xB9, 0xD5, 0x82, 0xB0, 0x5A, 0xDA, 0x8D,
-    0xDB, 0x98, 0xB0, 0x9A, 0x98, 0xC4, 0x26, 0x2C, 0x4D, 0x0B, 0x4F, 0xC9, 0x26, 0x2C, 0xE0, 0x43,
-    0xC1, 0xBB, 0x2C, 0x1B, 0xFF, 0x87, 0xC1, 0xF3, 0x0F, 0xA5, 0xF5, 0x28, 0xA7, 0x1F, 0xDB, 0x32,
-    0x8F, 0x45, 0x75, 0x75, 0x04, 0xD5, 0xA1, 0x3A, 0x91, 0x19, 0x23, 0x5B, 0xCE, 0xBA, 0xD7, 0xD2,
-    0xC6, 0x24, 0x1F, 0xBD, 0xC7, 0x79, 0xCC, 0x97, 0xEB, 0xDD, 0x97, 0xDE, 0x13, 0xBF, 0x6C, 0x76,
-    0x5F, 0xC6, 0x1F, 0x5E, 0x5C, 0x88, 0x69, 0xC8, 0x0C, 0x1D, 0x19, 0xAF, 0x67, 0xCF, 0x11, 0xFC,
-    0xF8, 0x61, 0x6E, 0xD2, 0x81, 0xDC, 0xBC, 0x35, 0x1D, 0xD8, 0x4B, 0x94, 0x66, 0x36, 0xAB, 0x58,
-    0xEC, 0xB5, 0x8D, 0x1B, 0x6D, 0x4F, 0x1E, 0x66, 0x16, 0xFB, 0xC9, 0x5D, 0xBE, 0x97, 0x59, 0x50,
-    0xD4, 0xD6, 0x9C, 0x5F, 0xDC, 0x7C, 0x81, 0xE2, 0x26, 0xDA, 0xBA, 0x47, 0x44, 0x97, 0x88, 0xA7,
-    0x0E, 0x29, 0x80, 0x56, 0xA0, 0xC2, 0x2D, 0xFC, 0xC2, 0x47, 0x79, 0xC8, 0xCA, 0xD5, 0xC5, 0x3F,
-    0xCC, 0xD1, 0x60, 0xAE, 0xD6, 0xE8, 0x88, 0xF7, 0x8D, 0x77, 0xAE, 0x4A, 0xBD, 0xA2, 0x60, 0xF7,
-    0x18, 0x05, 0xAB, 0x23, 0xD9, 0xE7, 0x9E, 0x98, 0x78, 0x97, 0x41, 0x51, 0xC7, 0xAC, 0x33, 0x7A,
-    0xB2, 0x03, 0x3F, 0x94, 0x76, 0x8A, 0x67, 0x4E, 0x31, 0xE5, 0x91, 0xD0, 0x6D, 0x3E, 0x71, 0x9F,
-    0x47, 0x39, 0x0D, 0xE4, 0xB9, 0x3C, 0xFD, 0xF1, 0x4A, 0x1E, 0x03, 0x14, 0xD0, 0x18, 0x97, 0x17,
-    0x14, 0xC9, 0x45, 0x0A, 0x8F, 0x41, 0xCC, 0x99, 0x8F, 0x16, 0x2F, 0x2D, 0x2C, 0xDF, 0xDC, 0x3C,
-    0x3D, 0x7D, 0xFE, 0xDB, 0xA0, 0x9B, 0x10, 0xAB, 0xC5, 0x43, 0x3F, 0xB3, 0x5D, 0x95, 0xAD, 0xC7,
-    0x64, 0xF3, 0xBD, 0x42, 0xFA, 0x97, 0x1E, 0x16, 0x60, 0xE5, 0x3E, 0x07, 0x2B, 0x67, 0xC6, 0x81,
-    0xD5, 0x7B, 0xF5, 0xB4, 0x6C, 0xD7, 0x46, 0x9E, 0xDB, 0x46, 0x9C, 0x12, 0x40, 0xCB, 0x6A, 0x98,
-    0x61, 0x24, 0xC6, 0xF0, 0x2E, 0xD2, 0xB2, 0xA8, 0xFF, 0x2D, 0xCF, 0x2E, 0xBE, 0x53, 0xD9, 0xD6,
-    0x8D, 0x32, 0xD8, 0x31, 0xD6, 0x8E, 0xE5, 0x90, 0xBA, 0xD9, 0xC2, 0x59, 0x66, 0x60, 0xBD, 0xCD,
-    0x23, 0x64, 0xBF, 0x7D, 0x01, 0xF4, 0xF4, 0xB0, 0x1E, 0x02, 0x34, 0x82, 0x1B, 0x0B, 0x04, 0x8F,
-    0xE5, 0x9B, 0x36, 0x88, 0x78, 0xA8, 0x80, 0x5C, 0xC9, 0x34, 0xC1, 0x23, 0xDE, 0x99, 0xA4, 0xEA,
-    0x65, 0x51, 0x8D, 0xDB, 0xE3, 0x25, 0x28, 0xEC, 0xD9, 0x04, 0x81, 0x7E, 0x12, 0x28, 0x89, 0x0E,
-    0x67, 0x3B, 0x3E, 0x7B, 0x8C, 0xEC, 0x63, 0xFD, 0xF0, 0x2D, 0x06, 0x24, 0xE6, 0x4B, 0x5A, 0x37,
-    0xE4, 0xBB, 0x5C, 0x36, 0xB3, 0x41, 0x64, 0x78, 0xEB, 0x75, 0x1E, 0x0B, 0x54, 0xB7, 0xB4, 0xCF,
-    0xE8, 0x30, 0x82, 0x9F, 0x18, 0xB3, 0x6A, 0x52, 0xD3, 0x3E, 0xD1, 0x0F, 0x19, 0xF9, 0x03, 0x5A,
-    0xF7, 0xFD, 0xBF, 0x85, 0x75, 0x2F, 0x47, 0xEB, 0x7E, 0xB7, 0xDA, 0x6B, 0x8C, 0x05, 0xDA, 0x97,
-    0xC0, 0xB2, 0x5E, 0x6A, 0xBC, 0xD6, 0x69, 0x83, 0x8A, 0x5D, 0x0C, 0xB7, 0xE1, 0x31, 0x41, 0xF2,
-    0xDC, 0xBA, 0x4C, 0xB4, 0x13, 0xFA, 0x40, 0xE6, 0xE9, 0xD1, 0x65, 0xA5, 0x6C, 0xCD, 0x9B, 0x65,
-    0xA9, 0xB4, 0x13, 0x5A, 0x8B, 0x81, 0x98, 0x55, 0xE2, 0x5E, 0xB7, 0xD3, 0xEC, 0xDE, 0xB0, 0x71,
-    0xCE, 0x7A, 0x2B, 0x7A, 0x5C, 0x23, 0x27, 0xEB, 0x17, 0x3E, 0x5F, 0x2D, 0xFC, 0xB8, 0x98, 0xFB,
-    0x39, 0xF2, 0x38, 0x8A, 0xFB, 0x49, 0x3B, 0x30, 0xF0, 0x3A, 0xDF, 0xEB, 0xB6, 0xE6, 0xB4, 0xC9,
-    0x47, 0x08, 0x7B, 0xBF, 0xFC, 0x79, 0x8D, 0xFC, 0x29, 0x21, 0x54, 0x22, 0xE6, 0x41, 0x00, 0x39,
-    0xA9, 0x3F, 0x54, 0x80, 0x30, 0xED, 0x21, 0x19, 0x9B, 0x68, 0x84, 0x21, 0xE3, 0xB0, 0xC5, 0xE0,
-    0x6E, 0x88, 0x22, 0x0C, 0xCD, 0x7C, 0xC1, 0x23, 0xB7, 0x8E, 0x3D, 0x3B, 0x4C, 0xF5, 0x94, 0xD3,
-    0x98, 0x83, 0x90, 0xE1, 0xA4, 0xA6, 0x92, 0xAF, 0x69, 0xBC, 0xFE, 0x11, 0xCB, 0x32, 0x9A, 0xEB,
-    0x0B, 0x4C, 0xCE, 0x3E, 0x0F, 0xBC, 0xA7, 0x06, 0xDE, 0x5B, 0x85, 0x77, 0x0E, 0x78, 0x9F, 0x11,
-    0xDE, 0x01, 0xE1, 0x1D, 0x94, 0xC0, 0x6B, 0x50, 0xBA, 0xCC, 0x1E, 0x00, 0x6F, 0x6D, 0x4F, 0xA9,
-    0xE2, 0xAC, 0x53, 0x84, 0x55, 0x8A, 0x09, 0xE5, 0x89, 0x49, 0x18, 0x20, 0x7D, 0xA6, 0x75, 0x00,
-    0xA5, 0x77, 0x26, 0x6D, 0x93, 0x1B, 0x3A, 0x35, 0x54, 0x0B, 0xF7, 0x3A, 0x65, 0xB3, 0xC3, 0x73,
-    0xED, 0xE1, 0x84, 0xCE, 0x1C, 0xCD, 0x10, 0x96, 0xA5, 0xEC, 0x1F, 0xE9, 0xC4, 0x56, 0x55, 0x27,
-    0xB7, 0x95, 0x6C, 0x6D, 0x0E, 0xCC, 0xE4, 0x4A, 0x57, 0xF1, 0x6A, 0x25, 0x3B, 0xBB, 0x5E, 0x32,
-    0x5F, 0x25, 0xE8, 0xA1, 0xEC, 0xBB, 0x4A, 0xD0, 0x83, 0x28, 0x6C, 0xF0, 0x37, 0x59, 0xD4, 0xB6,
-    0xF6, 0x98, 0xE0, 0x24, 0xFD, 0xCC, 0x2C, 0xCF, 0x02, 0x23, 0x62, 0x93, 0x81, 0x9D, 0x27, 0xC6,
-    0x9C, 0x8E, 0x2A, 0xB7, 0x11, 0x0B, 0x31, 0x5C, 0x72, 0x3F, 0x62, 0x7B, 0xF4, 0x63, 0xAA, 0xC0,
-    0x64, 0xCA, 0x27, 0x9E, 0x83, 0x96, 0x29, 0x54, 0xB9, 0x92, 0x21, 0xC8, 0xEA, 0x61, 0x99, 0xA2,
-    0x82, 0x04, 0xA2, 0x4D, 0x75, 0x0D, 0x5C, 0x4E, 0x7A, 0xC4, 0x36, 0xC9, 0xC1, 0x71, 0x97, 0xFD,
-    0x5B, 0x81, 0xE6, 0xE0, 0xB8, 0x2B, 0x28, 0xE4, 0xFA, 0x31, 0xD9, 0xF0, 0x3A, 0x0F, 0xD8, 0x62,
-    0x97, 0x45, 0xD6, 0xB3, 0x12, 0x07, 0xC5, 0xFD, 0xEB, 0x8F, 0x3A, 0x92, 0xDC, 0x12, 0xE1, 0xBC,
-    0x27, 0xCD, 0x2F, 0x81, 0x04, 0x54, 0xFE, 0x0B, 0xE2, 0xB7, 0xD0, 0x5A, 0x9E, 0x65, 0x9F, 0x26,
-    0x07, 0x4E, 0xAB, 0x0D, 0x0F, 0xED, 0x65, 0xE2, 0xA3, 0x0E, 0x88, 0x05, 0xE4, 0x4E, 0x85, 0xD6,
-    0x01, 0x21, 0x8F, 0x90, 0xFD, 0x4A, 0x9B, 0x2D, 0x9A, 0xEB, 0x13, 0x4C, 0xB1, 0xE9, 0xA0, 0x24,
-    0xB6, 0x85, 0xA2, 0x1C, 0x78, 0xCE, 0x1C, 0x0F, 0x0A, 0x14, 0xB2, 0xD9, 0xF0, 0xA4, 0xBE, 0x0C,
-    0x4B, 0x24, 0x14, 0x41, 0xE5, 0x12, 0x82, 0xA8, 0x40, 0x50, 0x3E, 0x58, 0x08, 0x46, 0x05, 0x8C,
-    0x11, 0xB3, 0x50, 0xB0, 0xB6, 0x19, 0x20, 0xA8, 0x6E, 0xB3, 0xE2, 0xEA, 0x78, 0xB0, 0x31, 0x42,
-    0xD0, 0xB2, 0x2B, 0xDB, 0xCD, 0x30, 0x37, 0x8F, 0x1E, 0x48, 0x5D, 0xAB, 0x31, 0x13, 0x4D, 0x8C,
-    0x3D, 0x76, 0x67, 0x92, 0x73, 0x3B, 0xCC, 0x8D, 0x51, 0xE7, 0x7B, 0x07, 0x93, 0x98, 0x39, 0x7A,
-    0x00, 0xF5, 0xF4, 0xC4, 0xD0, 0xD1, 0x8A, 0x60, 0xD7, 0xDB, 0x8E, 0x5C, 0x96, 0x09, 0x3C, 0x31,
-    0x49, 0xE6, 0x77, 0xB0, 0x5F, 0x35, 0x2B, 0x18, 0xD6, 0xE3, 0x19, 0xDB, 0x4B, 0x6B, 0x2E, 0x7A,
-    0x63, 0xCE, 0xCE, 0x5C, 0x46, 0x70, 0xAF, 0x71, 0xB8, 0x45, 0x3C, 0x86, 0xE6, 0x9D, 0xBA, 0x40,
-    0xAC, 0xAD, 0xC3, 0xED, 0xC1, 0xC3, 0xEF, 0x6C, 0x91, 0x55, 0x42, 0x7E, 0xF8, 0x5F, 0x3D, 0x9D,
-    0xE1, 0x99, 0xE3, 0x58, 0xDB, 0x9D, 0x9B, 0xED, 0x15, 0x93, 0x4F, 0x0E, 0x99, 0x85, 0x21, 0xF5,
-    0xEC, 0x2F, 0x20, 0xF5, 0xDF, 0x91, 0xD4, 0xBF, 0x47, 0x52, 0x7F, 0xDC, 0x99, 0xDE, 0x55, 0xBD,
-    0x08, 0x29, 0x64, 0xA8, 0x8B, 0xAC, 0x96, 0xCD, 0xE5, 0x9B, 0xC2, 0x92, 0xB2, 0x37, 0x07, 0xA4,
-    0x4C, 0xEC, 0xBC, 0xE6, 0xB3, 0x5B, 0x5F, 0xF1, 0x9E, 0x28, 0xA4, 0x08, 0x88, 0x01, 0x7D, 0xE5,
-    0x3D, 0x7A, 0xB9, 0x60, 0x15, 0xCC, 0xFB, 0xE9, 0xB4, 0xCA, 0x03, 0xCC, 0xD8, 0x86, 0x73, 0x0C,
-    0x77, 0x63, 0x13, 0xBD, 0x5D, 0xC0, 0x6C, 0x70, 0x8D, 0xC5, 0x66, 0xC6, 0x7B, 0x18, 0x0B, 0xFE,
-    0x51, 0xFF, 0xE0, 0x43, 0xFF, 0x40, 0xE0, 0x56, 0xDF, 0x65, 0x7D, 0xF7, 0xA5, 0x4F, 0x5E, 0xD8,
-    0xF7, 0x93, 0xD1, 0x49, 0xC0, 0x28, 0xA3, 0x9F, 0xF0, 0xE7, 0x39, 0xA8, 0x81, 0x7D, 0x27, 0x58,
-    0xB1, 0x6F, 0x81, 0x21, 0xC3, 0x61, 0x00, 0x23, 0xB2, 0x6E, 0x65, 0x17, 0x7D, 0x84, 0xA3, 0x52,
-    0xF9, 0x9C, 0x72, 0x96, 0x12, 0x1B, 0x38, 0x9A, 0x94, 0x9A, 0xB5, 0xD0, 0x68, 0xE2, 0x57, 0x87,
-    0xB8, 0x19, 0x68, 0xDC, 0x7C, 0x7E, 0xA8, 0x6C, 0xE6, 0x7B, 0x67, 0xE2, 0x5A, 0x09, 0x2B, 0x03,
-    0xF0, 0xC0, 0xCA, 0x78, 0x70, 0x42, 0xCE, 0x9B, 0xDB, 0xC2, 0x29, 0xBC, 0xDB, 0x0E, 0x85, 0xD3,
-    0x6B, 0xA5, 0x3D, 0x6F, 0x40, 0xD5, 0x23, 0xAA, 0xAF, 0x39, 0x7E, 0xF2, 0x3B, 0xC5, 0x8B, 0x4A,
-    0x49, 0xB4, 0xB2, 0xA5, 0xB8, 0x5A, 0x33, 0xFD, 0x67, 0x1B, 0x9D, 0x66, 0xD2, 0xB8, 0x9C, 0x68,
-    0xD1, 0x68, 0xA1, 0xD6, 0x34, 0x6C, 0xB5, 0xBA, 0x75, 0xC3, 0xA5, 0x78, 0x55, 0x4B, 0x7B, 0xF8,
-    0x45, 0xCB, 0x9A, 0x2B, 0xCC, 0xD9, 0xA3, 0x8B, 0x23, 0xB6, 0x8D, 0x58, 0xFF, 0xDC, 0x67, 0x31,
-    0x7A, 0x5B, 0xFE, 0x93, 0x8D, 0xB0, 0xFB, 0xF2, 0x73, 0x9E, 0x31, 0x36, 0x7A, 0xF0, 0xC5, 0x73,
-    0x7A, 0x6E, 0x6A, 0x69, 0xDA, 0x06, 0xB6, 0x0E, 0xA4, 0x13, 0xE5, 0x0C, 0x09, 0x64, 0x3A, 0xBF,
-    0x84, 0x76, 0xDE, 0x1F, 0xC9, 0xCB, 0x7F, 0xAE, 0xEC, 0x51, 0xB4, 0x49, 0xD6, 0x7B, 0xCD, 0xC5,
-    0xD9, 0xE3, 0xE0, 0x19, 0x4A, 0xFC, 0x3A, 0x4F, 0x4E, 0x78, 0x0A, 0xD2, 0xE9, 0x76, 0x91, 0x41,
-    0x4A, 0xAA, 0x9D, 0xDB, 0x66, 0xAE, 0xFD, 0xE3, 0x8E, 0xD4, 0x98, 0x9E, 0x23, 0x3B, 0x04, 0x05,
-    0xE9, 0x57, 0x37, 0x8B, 0x0D, 0x2C, 0xCD, 0x78, 0x43, 0xFD, 0x73, 0xA4, 0x28, 0xB7, 0x47, 0xDB,
-    0x18, 0xE7, 0x1A, 0x4C, 0xF5, 0x98, 0xF5, 0x23, 0x06, 0x56, 0xE7, 0x63, 0xAD, 0xA5, 0x3E, 0xD5,
-    0x18, 0x63, 0x9A, 0xAB, 0x9A, 0xAA, 0xD9, 0x16, 0x88, 0x72, 0x8A, 0x39, 0x5E, 0x34, 0x75, 0x46,
-    0x50, 0x8D, 0x8D, 0xED, 0x6F, 0xA8, 0xEA, 0xFA, 0x37, 0x49, 0xB6, 0x2E, 0x03, 0xF4, 0x36, 0xFA,
-    0xBE, 0xF9, 0xA2, 0xC5, 0xBE, 0xE9, 0xE4, 0x98, 0x74, 0xCE, 0x5E, 0x1A, 0x8E, 0x33, 0x33, 0x19,
-    0xCF, 0xCE, 0x86, 0x4B, 0x6C, 0x47, 0x69, 0x03, 0x42, 0xBE, 0x82, 0x09, 0x60, 0x4E, 0xA7, 0xCF,
-    0x8F, 0xBB, 0xCF, 0x95, 0x12, 0xC0, 0xC6, 0x2D, 0x3D, 0x67, 0x2B, 0x8D, 0x4C, 0x86, 0xBF, 0xE1,
-    0xED, 0x5E, 0xA9, 0x51, 0x06, 0x51, 0x6C, 0x89, 0xD0, 0xAB, 0x1C, 0x7B, 0xC6, 0xF3, 0xCC, 0xF9,
-    0x67, 0xBD, 0xF0, 0x0C, 0x92, 0x8D, 0xB0, 0xB5, 0x48, 0x9B, 0xE9, 0x5F, 0x84, 0x1D, 0x96, 0x1F,
-    0x36, 0xF4, 0xF2, 0xCF, 0xCD, 0x1C, 0xAB, 0x87, 0xB0, 0xE3, 0xC5, 0x4E, 0x2A, 0x96, 0xE4, 0x3D,
-    0xB2, 0xDD, 0xD7, 0xC7, 0x54, 0x31, 0x36, 0x8A, 0xF3, 0x40, 0x90, 0xDD, 0x56, 0x56, 0x74, 0x4C,
-    0x30, 0x83, 0x47, 0x60, 0xDF, 0xAC, 0xAF, 0x02, 0x59, 0x9D, 0x21, 0x8F, 0x7C, 0xD3, 0x59, 0x77,
-    0x26, 0x46, 0xFF, 0x3F, 0xD5, 0x5A, 0x3F, 0x6C, 0xDC, 0xD6, 0x19, 0xFF, 0x48, 0x5A, 0x66, 0x10,
-    0x16, 0x65, 0x06, 0x7B, 0x71, 0x1A, 0xB3, 0x43, 0x5A, 0xA4, 0x41, 0x6C, 0xAE, 0x29, 0x20, 0x89,
-    0x74, 0x32, 0x76, 0xB0, 0x07, 0xAB, 0x1E, 0x32, 0xB8, 0x6B, 0x52, 0x14, 0x5A, 0x3A, 0x78, 0x90,
-    0xEE, 0xE8, 0x74, 0xE8, 0x58, 0x2F, 0x99, 0xE3, 0xC1, 0x05, 0xDC, 0xCB, 0xA0, 0xC5, 0x83, 0x86,
-    0x3B, 0x1D, 0xDD, 0x0C, 0x19, 0x3A, 0x98, 0x40, 0x1A, 0x74, 0x0C, 0x51, 0x3B, 0x1D, 0xD2, 0xC1,
-    0x2C, 0x7A, 0x41, 0x18, 0x9B, 0x77, 0xAF, 0xBF, 0xDF, 0xF7, 0x78, 0xD4, 0x9D, 0xE4, 0x36, 0x46,
-    0x1A, 0x39, 0xCA, 0xE1, 0xEE, 0xA3, 0xC4, 0x3F, 0xEF, 0xFB, 0xBD, 0xEF, 0x7D, 0xFF, 0x1F, 0x45,
-    0x44, 0xA2, 0x5C, 0x12, 0xFB, 0x4D, 0xE5, 0x84, 0xB4, 0x9F, 0x55, 0x91, 0x2D, 0x91, 0x5D, 0x91,
-    0x09, 0xBF, 0x4E, 0x25, 0x6E, 0x25, 0x1E, 0xBE, 0xA5, 0xF8, 0x85, 0x04, 0x85, 0x84, 0x39, 0xBF,
-    0x78, 0x34, 0xCE, 0xF8, 0x1C, 0xBE, 0xDD, 0x67, 0xCD, 0x3E, 0x2E, 0xDB, 0x22, 0x81, 0xA9, 0xA4,
-    0x6F, 0x2A, 0x67, 0x26, 0xBF, 0xF2, 0x30, 0x50, 0x58, 0x2A, 0x37, 0x89, 0x71, 0x77, 0x22, 0xF6,
-    0xD7, 0x3B, 0xF0, 0xD3, 0xF3, 0x19, 0xEE, 0xFB, 0x62, 0x53, 0x7C, 0x63, 0x44, 0xC6, 0xB5, 0x1D,
-    0x0E, 0x70, 0x88, 0x47, 0x5E, 0xD8, 0xE7, 0xE4, 0x18, 0x0C, 0x2A, 0x21, 0xEF, 0x92, 0xE4, 0xB3,
-    0x3D, 0xD0, 0x3D, 0x9D, 0x41, 0xA3, 0x17, 0x6B, 0xA5, 0xBC, 0x83, 0xE0, 0xF1, 0xF1, 0x16, 0xA8,
-    0x5F, 0xF2, 0xF4, 0xCE, 0xA3, 0xDB, 0x38, 0x61, 0x0C, 0x1E, 0x70, 0xAE, 0x7E, 0x72, 0x99, 0x83,
-    0x65, 0xBC, 0x1A, 0xE9, 0x74, 0x62, 0xA5, 0x89, 0xB2, 0x5A, 0x57, 0xAA, 0x03, 0xBB, 0x3A, 0x64,
-    0xFC, 0x68, 0x30, 0xC0, 0xBC, 0x8D, 0x31, 0x19, 0xA6, 0x68, 0x4C, 0x2A, 0xCF, 0x89, 0xFC, 0x78,
-    0x3D, 0x7A, 0x50, 0xC7, 0xC6, 0x54, 0xC1, 0x57, 0x9B, 0x79, 0x90, 0xFB, 0x45, 0x98, 0xBA, 0x65,
-    0x04, 0xF1, 0x45, 0x22, 0x55, 0x88, 0x63, 0x98, 0x79, 0xA5, 0x5F, 0x86, 0x39, 0x30, 0x97, 0x49,
-    0xFF, 0x51, 0xFD, 0x9A, 0x93, 0xDE, 0x11, 0xCB, 0xD6, 0xAD, 0x20, 0xD0, 0xA0, 0x0C, 0x28, 0x58,
-    0xC8, 0x38, 0x49, 0x21, 0xEB, 0x1E, 0xD1, 0x36, 0xB8, 0x84, 0x83, 0x33, 0x21, 0xE6, 0x1A, 0x37,
-    0xC9, 0x90, 0x98, 0xB6, 0xB6, 0x29, 0x6B, 0x20, 0x5A, 0xE9, 0x7F, 0x91, 0x0A, 0x98, 0x16, 0x44,
-    0x53, 0xB4, 0xE0, 0x63, 0xFC, 0xDE, 0x19, 0x03, 0xE1, 0x98, 0xD0, 0x06, 0x66, 0x60, 0x17, 0x04,
-    0xCF, 0x76, 0xF3, 0xA0, 0x7C, 0x4E, 0x6D, 0x2D, 0x7C, 0x4E, 0xB5, 0x62, 0x7D, 0x65, 0xF1, 0x24,
-    0xFE, 0x3F, 0x7D, 0x89, 0x42, 0x9A, 0x61, 0x64, 0x4A, 0x3A, 0x49, 0x57, 0x5A, 0x71, 0xF4, 0x54,
-    0x3C, 0xE4, 0x16, 0x51, 0x9A, 0xE1, 0x8C, 0xFF, 0x12, 0x41, 0x1D, 0x50, 0x59, 0xDC, 0x5A, 0xBC,
-    0x02, 0xAC, 0x40, 0xF0, 0x57, 0x85, 0x95, 0x70, 0x1B, 0x0A, 0xDF, 0xBC, 0x4F, 0x15, 0xE0, 0xCD,
-    0xAE, 0x91, 0x76, 0xB5, 0xA9, 0x4C, 0x2D, 0x89, 0x32, 0xF9, 0xB9, 0x8C, 0x39, 0xD2, 0x54, 0xE4,
-    0x45, 0x53, 0xB6, 0xA0, 0x4E, 0x48, 0xBA, 0xED, 0x17, 0xA3, 0xA0, 0xB8, 0xE6, 0x67, 0x9D, 0x02,
-    0x6C, 0x9A, 0x1B, 0xA0, 0xC1, 0x6C, 0x67, 0x6A, 0xC7, 0xD9, 0xCC, 0x74, 0x5A, 0x10, 0x14, 0x84,
-    0x77, 0x19, 0x7F, 0x06, 0x59, 0x60, 0xF2, 0x35, 0x09, 0xB1, 0x44, 0x79, 0x24, 0xE7, 0x64, 0x2A,
-    0x69, 0x98, 0xAE, 0x72, 0x05, 0xFD, 0x6C, 0x95, 0x60, 0xBC, 0xFC, 0x1A, 0x6E, 0xD5, 0x43, 0x71,
-    0xF8, 0xB0, 0x6A, 0xAF, 0xAD, 0x52, 0x7F, 0xFC, 0xEC, 0x1C, 0xC7, 0x0E, 0xD2, 0x50, 0xC6, 0x1F,
-    0xE4, 0x21, 0x86, 0x8E, 0x38, 0xB4, 0x57, 0x38, 0x7F, 0x84, 0x50, 0xA9, 0x6D, 0x1C, 0xAF, 0x8F,
-    0xA5, 0xC0, 0x2C, 0x82, 0x47, 0x6F, 0x71, 0x82, 0x90, 0xBE, 0xE2, 0x77, 0x2E, 0xB5, 0x80, 0x67,
-    0xAF, 0xF8, 0x8F, 0x77, 0xC3, 0x0B, 0x93, 0xB3, 0x52, 0xAD, 0xF2, 0x5B, 0xBE, 0xEE, 0x16, 0xE0,
-    0xB5, 0x1A, 0xE4, 0xC9, 0x38, 0x0F, 0xEF, 0x67, 0x76, 0xA6, 0x10, 0x02, 0x8C, 0xAE, 0x07, 0x99,
-    0xD5, 0x41, 0x1E, 0x94, 0x71, 0x1A, 0xE7, 0x7B, 0xD2, 0x77, 0x1A, 0x9E, 0x92, 0x04, 0xE8, 0xA3,
-    0xAC, 0x81, 0xB0, 0x86, 0xB0, 0xC5, 0x75, 0x70, 0x85, 0x72, 0x95, 0xA1, 0x58, 0x76, 0xC6, 0xF0,
-    0xB7, 0xB1, 0xB1, 0xB1, 0xA9, 0xA3, 0x1C, 0xFE, 0x9D, 0x59, 0xD9, 0x48, 0x63, 0x93, 0x27, 0x26,
-    0x3F, 0xBD, 0x91, 0x3E, 0x9D, 0x20, 0x45, 0x05, 0x39, 0x9E, 0x09, 0x05, 0x39, 0xB6, 0x82, 0x1C,
-    0x42, 0x8B, 0xD3, 0x55, 0x19, 0x7A, 0x15, 0x04, 0xC9, 0x03, 0x64, 0x86, 0x43, 0xC9, 0xC3, 0x68,
-    0x33, 0xE7, 0x61, 0x6C, 0x28, 0x48, 0xD9, 0xDB, 0xA3, 0x04, 0x65, 0x18, 0xDB, 0x03, 0x94, 0x3B,
-    0xE3, 0xE3, 0x05, 0x05, 0x89, 0xE7, 0x28, 0xC8, 0xA1, 0x53, 0x53, 0x90, 0x97, 0xE5, 0xF2, 0x53,
-    0x09, 0xF2, 0xD5, 0xC1, 0xE0, 0x26, 0x4C, 0xAE, 0x7A, 0x67, 0x30, 0xB8, 0xA1, 0x5A, 0x94, 0x85,
-    0xA6, 0x8A, 0x65, 0xB8, 0x26, 0xAB, 0xAB, 0xB2, 0x86, 0x2F, 0xFE, 0xC0, 0xBF, 0x38, 0x89, 0x4B,
-    0x6A, 0xF2, 0xC5, 0xD7, 0x11, 0x0A, 0xCD, 0x92, 0xD3, 0x57, 0x3E, 0xDB, 0xF8, 0xBA, 0x27, 0xF8,
-    0x39, 0x0D, 0x19, 0x2F, 0x3C, 0x26, 0x2B, 0x29, 0xBC, 0x91, 0xF7, 0xA8, 0x71, 0xD2, 0xAD, 0xB9,
-    0xF7, 0xAC, 0xE9, 0x77, 0x60, 0xCF, 0x31, 0xFF, 0x84, 0x1C, 0x23, 0xFA, 0x8B, 0x6A, 0x6C, 0xD4,
-    0x01, 0x9D, 0x4E, 0x5D, 0x53, 0x79, 0xFF, 0x68, 0xF4, 0x4E, 0xBD, 0xFF, 0x64, 0x25, 0x30, 0xD5,
-    0x9D, 0x42, 0xBD, 0x15, 0xBF, 0x2F, 0xB8, 0x55, 0x6F, 0xA7, 0x48, 0x4C, 0xCA, 0x59, 0xBF, 0x2D,
-    0x53, 0x6F, 0x12, 0x14, 0x11, 0x84, 0xCE, 0x81, 0xB6, 0xE9, 0x9D, 0x86, 0x74, 0x4E, 0xCD, 0x9C,
-    0x40, 0x72, 0x3D, 0x3A, 0xA7, 0x11, 0x07, 0x68, 0xAC, 0xE7, 0x00, 0xA9, 0xB1, 0x8A, 0xB0, 0xBD,
-    0xB0, 0xC0, 0xA5, 0x30, 0xA7, 0x02, 0x91, 0x8C, 0x33, 0xBF, 0x72, 0x4C, 0x1A, 0x34, 0xD1, 0xA7,
-    0x69, 0x60, 0x4C, 0x2C, 0xE1, 0xA7, 0x35, 0xC8, 0xF5, 0x74, 0xEE, 0x3F, 0xD2, 0xB9, 0xEB, 0x4B,
-    0x3A, 0xF7, 0xB7, 0xEF, 0x3F, 0x64, 0x05, 0x93, 0x77, 0xE8, 0xFB, 0x42, 0x92, 0xD8, 0x4C, 0xAF,
-    0x64, 0xB0, 0x57, 0x3F, 0xEB, 0x93, 0x8C, 0x49, 0xCC, 0x13, 0xC8, 0xB8, 0xBB, 0x45, 0x6F, 0x8E,
-    0x49, 0x42, 0x12, 0x87, 0x44, 0xE4, 0xDC, 0xFF, 0x4B, 0xC4, 0x3A, 0xEF, 0x24, 0xEF, 0xE7, 0x49,
-    0x7A, 0x02, 0x0A, 0x87, 0xF1, 0x39, 0xF9, 0x89, 0x33, 0x19, 0x97, 0x86, 0x53, 0xEA, 0xB9, 0xD3,
-    0x68, 0xB8, 0xB6, 0x85, 0x69, 0xD4, 0x38, 0x5B, 0x39, 0x95, 0x5B, 0x7A, 0x85, 0x57, 0xF8, 0xF0,
-    0xD6, 0xF6, 0x69, 0x08, 0xE6, 0x31, 0x54, 0xBB, 0x3A, 0x2B, 0x77, 0x56, 0xDB, 0xAF, 0x9A, 0xAA,
-    0x57, 0x44, 0x3B, 0x59, 0xA0, 0xBA, 0xE8, 0xA4, 0xCF, 0x89, 0x4F, 0xD3, 0x2F, 0x63, 0x88, 0x1A,
-    0xE2, 0xA2, 0x53, 0x86, 0x46, 0xAB, 0x79, 0x8E, 0xDD, 0x89, 0xD3, 0xF8, 0x70, 0xD8, 0x51, 0x1E,
-    0xE6, 0x7D, 0xAC, 0x7D, 0x23, 0xDB, 0x38, 0xFD, 0xB2, 0x9B, 0xCB, 0xC2, 0x07, 0x4E, 0x2E, 0xC8,
-    0x64, 0x9C, 0xC2, 0x24, 0xFD, 0x87, 0x0C, 0x99, 0xE1, 0x55, 0x35, 0xB8, 0xF3, 0xBA, 0xF8, 0xEB,
-    0x18, 0x5E, 0x4F, 0xA6, 0xD4, 0x8B, 0x75, 0x95, 0x3A, 0xE5, 0xBE, 0xAB, 0xD1, 0x6C, 0xE2, 0x21,
-    0x80, 0x20, 0x9C, 0xE4, 0x71, 0xEE, 0x40, 0xED, 0xFB, 0x99, 0x5B, 0x6D, 0x3B, 0x9C, 0x5C, 0xED,
-    0xDD, 0xA3, 0xED, 0x84, 0x30, 0xF3, 0x20, 0x5F, 0x3B, 0x4F, 0x49, 0xEC, 0x9E, 0xC3, 0x68, 0x4E,
-    0x85, 0x90, 0xDC, 0x20, 0xCC, 0xE5, 0x6E, 0x85, 0x90, 0xCA, 0xE8, 0x82, 0x48, 0xCA, 0x48, 0x37,
-    0xD1, 0xD5, 0xAD, 0x44, 0x9E, 0x8C, 0x2D, 0x25, 0xB6, 0x75, 0xC5, 0xD6, 0x2C, 0x60, 0x2B, 0x14,
-    0x5B, 0x46, 0x6C, 0xC9, 0x22, 0xB6, 0x95, 0x94, 0xD8, 0xC6, 0x13, 0x60, 0xFB, 0x10, 0x86, 0x00,
-    0x6C, 0xE9, 0x1A, 0xB0, 0x69, 0x46, 0xA0, 0x41, 0x9C, 0xCF, 0x0F, 0x39, 0x37, 0xFC, 0x81, 0xB9,
-    0x41, 0xE4, 0xEB, 0x1A, 0xA9, 0x86, 0x1C, 0xDF, 0xD1, 0xEC, 0x02, 0xF6, 0x85, 0x91, 0xF1, 0x4D,
-    0x68, 0xD2, 0x4C, 0x1E, 0x5A, 0x54, 0x2B, 0x69, 0x17, 0xF1, 0xCF, 0x8A, 0xF7, 0x79, 0x63, 0xD5,
-    0xD1, 0x8E, 0x8C, 0x83, 0x46, 0xF5, 0x2D, 0x0E, 0x29, 0x27, 0x27, 0xAA, 0xC2, 0x30, 0x7D, 0x4A,
-    0x0E, 0xF6, 0x44, 0x78, 0x5C, 0x6A, 0x51, 0xE1, 0xA9, 0x01, 0x4F, 0xC2, 0x2C, 0x11, 0xD8, 0x57,
-    0x8C, 0x48, 0xB3, 0xBE, 0x53, 0x6C, 0x21, 0x43, 0x81, 0x9D, 0x4D, 0xFC, 0x29, 0x3C, 0x0C, 0xC4,
-    0xCB, 0x7C, 0x03, 0x22, 0xDC, 0xB2, 0x9E, 0xF8, 0x1A, 0x39, 0xB8, 0x25, 0x93, 0x8F, 0xDA, 0xCF,
-    0x27, 0x4C, 0x27, 0x34, 0xE7, 0xF0, 0x73, 0x0D, 0x88, 0x98, 0x89, 0x5B, 0xAA, 0x89, 0x70, 0xEC,
-    0xE1, 0x82, 0x8F, 0xD8, 0x17, 0x28, 0xD3, 0x2B, 0xAC, 0x94, 0xB5, 0xA6, 0x13, 0x0B, 0xD7, 0xB6,
-    0x5A, 0x93, 0x6A, 0xBD, 0x5E, 0x44, 0x5F, 0x94, 0x8A, 0x87, 0xE9, 0x85, 0xF8, 0x37, 0x6E, 0x9F,
-    0xE0, 0x54, 0x47, 0xED, 0x8F, 0x69, 0x4E, 0x3F, 0xEB, 0x31, 0xE2, 0x23, 0xBF, 0xC2, 0x73, 0x1B,
-    0x2A, 0x98, 0x5B, 0x5D, 0x5C, 0x1F, 0x75, 0x56, 0x4B, 0xFD, 0x11, 0x2F, 0x5B, 0x02, 0xA3, 0x17,
-    0xC6, 0xBC, 0x40, 0x95, 0xF1, 0xE8, 0x20, 0xFD, 0x4F, 0x41, 0xC2, 0x7B, 0x40, 0x18, 0xFD, 0x01,
-    0x24, 0xA1, 0x10, 0x7B, 0x24, 0x0D, 0x12, 0x3D, 0x77, 0x82, 0xF5, 0x86, 0x97, 0x2F, 0x91, 0xF5,
-    0x61, 0x7D, 0xD4, 0x83, 0x30, 0xC3, 0x61, 0xD2, 0x53, 0xC9, 0x6C, 0xF0, 0x41, 0x85, 0xB8, 0xE4,
-    0x4E, 0x70, 0xD6, 0x65, 0x82, 0xE2, 0xD0, 0x16, 0x9C, 0x9A, 0xC0, 0x1B, 0xB2, 0x6A, 0xF6, 0xE6,
-    0xB0, 0x5E, 0x55, 0xF6, 0x7B, 0x0A, 0xB6, 0xD9, 0x4F, 0xC4, 0x6C, 0xC2, 0x75, 0x4E, 0x0E, 0x7E,
-    0x6C, 0xDA, 0xA5, 0x40, 0x15, 0xA9, 0x85, 0x6A, 0xB1, 0x5A, 0xB0, 0x16, 0xAD, 0x85, 0x6B, 0xF1,
-    0x2A, 0x60, 0x8B, 0xD8, 0x42, 0xB6, 0x98, 0x2D, 0x68, 0x8B, 0xDA, 0xC2, 0x56, 0xDC, 0xA2, 0xC0,
-    0x45, 0x91, 0x8B, 0x42, 0x17, 0xC5, 0xAE, 0x52, 0x57, 0xAF, 0x0A, 0xDA, 0xC1, 0x3F, 0x49, 0xBE,
-    0x31, 0x83, 0x50, 0xBF, 0x62, 0x72, 0xC9, 0xE8, 0x58, 0xAC, 0x51, 0x19, 0xCF, 0x1E, 0x0B, 0xF9,
-    0x5E, 0x12, 0x9C, 0xF2, 0x66, 0x5E, 0xCE, 0x84, 0xF8, 0x21, 0x13, 0x68, 0x9F, 0xD9, 0xD5, 0x8F,
-    0x34, 0x67, 0x3E, 0xD6, 0x92, 0x85, 0xA3, 0xC6, 0xAD, 0x49, 0x4B, 0xDC, 0xE2, 0xB0, 0x2E, 0x7C,
-    0x77, 0x4A, 0xAB, 0xCC, 0x69, 0xCE, 0x8F, 0x60, 0xF6, 0x4E, 0x09, 0xBF, 0xE0, 0x14, 0x74, 0x0E,
-    0x15, 0x7D, 0xC2, 0x98, 0x0A, 0xFC, 0xE2, 0xF1, 0x30, 0x2F, 0x17, 0x71, 0x98, 0x9E, 0x30, 0x68,
-    0x8F, 0x8C, 0xCB, 0x0C, 0x16, 0xC9, 0x45, 0x1B, 0x77, 0x7A, 0xA1, 0x3D, 0x36, 0x51, 0x66, 0x6B,
-    0x18, 0x5B, 0xDC, 0xF8, 0x95, 0xD5, 0x86, 0x30, 0xB7, 0xC7, 0x38, 0xD3, 0xA4, 0x5E, 0xFA, 0x32,
-    0x1E, 0xB0, 0x64, 0x98, 0x32, 0xBB, 0xC1, 0xED, 0xB5, 0x18, 0x16, 0x00, 0x9A, 0x53, 0xD8, 0xD1,
-    0xB5, 0xBA, 0x8A, 0x2C, 0x13, 0x49, 0x06, 0x1F, 0xE8, 0x71, 0x66, 0x8D, 0xDA, 0x69, 0xEC, 0xD1,
-    0x9B, 0xD8, 0x3A, 0x2B, 0xE0, 0xEC, 0x6C, 0xA5, 0x19, 0x7E, 0x3E, 0xB8, 0xC9, 0x9A, 0x21, 0xE4,
-    0xF4, 0xC6, 0x62, 0x8F, 0xED, 0x27, 0x46, 0xED, 0xE0, 0xB2, 0x18, 0x8B, 0x66, 0x18, 0xAE, 0x5F,
-    0xA0, 0xD4, 0x63, 0xBC, 0xF5, 0x6A, 0x05, 0x4A, 0xB6, 0xED, 0x20, 0xD6, 0x31, 0x2E, 0xA4, 0x27,
-    0xFD, 0xCE, 0xB5, 0x1C, 0x20, 0xFD, 0xEE, 0x96, 0x24, 0x9F, 0xD7, 0x29, 0xC1, 0x6C, 0x63, 0x97,
-    0x7C, 0x6A, 0xAA, 0xEC, 0x03, 0x8C, 0xFF, 0xD7, 0xB9, 0x97, 0x64, 0x7D, 0xDA, 0x56, 0x8C, 0x3A,
-    0xBD, 0xC9, 0x7C, 0x91, 0xAD, 0xB1, 0xBC, 0xDD, 0x8D, 0x18, 0x77, 0x9E, 0x8B, 0xF6, 0x06, 0xC5,
-    0x58, 0x54, 0x81, 0x79, 0x29, 0x96, 0x5B, 0xD2, 0xEB, 0x7C, 0xF2, 0x7E, 0xE9, 0xD5, 0xCC, 0xEB,
-    0x53, 0xAD, 0x25, 0xBD, 0xD9, 0xE0, 0x16, 0xAB, 0xD0, 0x89, 0x25, 0x56, 0x64, 0xC5, 0xC1, 0xA2,
-    0xE8, 0x70, 0x62, 0x36, 0x18, 0x68, 0xE9, 0x99, 0x73, 0x8D, 0x74, 0x55, 0x9F, 0xCF, 0xE6, 0xE5,
-    0xD4, 0xDE, 0x9C, 0x81, 0xA6, 0xEF, 0x41, 0x7A, 0x2C, 0xF0, 0xB9, 0x37, 0xF9, 0x20, 0x47, 0x8C,
-    0xC9, 0x60, 0xB4, 0xC6, 0x48, 0x1A, 0xB1, 0xB2, 0xF2, 0xD3, 0xE3, 0x80, 0xEF, 0x05, 0x87, 0x0B,
-    0x8F, 0x65, 0x75, 0x6A, 0xDE, 0x5F, 0x85, 0x87, 0xFC, 0xD0, 0x77, 0x05, 0xED, 0xE4, 0x0D, 0x1B,
-    0x2E, 0x55, 0x37, 0x9B, 0xB6, 0xC7, 0xF2, 0xC3, 0x45, 0x5C, 0x85, 0x56, 0xDE, 0xEE, 0x57, 0x96,
-    0xAF, 0x56, 0xB6, 0x95, 0xED, 0x72, 0xD0, 0x65, 0xD3, 0xDB, 0x84, 0xED, 0x8F, 0xFC, 0x16, 0x1B,
-    0x30, 0xF3, 0x26, 0xCC, 0xA8, 0x1D, 0xBA, 0xB1, 0xDA, 0xEF, 0xAA, 0x79, 0x64, 0xAC, 0xF7, 0xC8,
-    0xE1, 0x36, 0xCE, 0x34, 0xD6, 0x0C, 0x39, 0x08, 0x33, 0xAB, 0x6B, 0xCF, 0x90, 0xFF, 0x19, 0xCD,
-    0xCC, 0x91, 0xFE, 0xE5, 0xE2, 0xDF, 0x67, 0x25, 0x35, 0x01, 0xFB, 0x6B, 0xCF, 0x8C, 0xBF, 0x03,
-    0x57, 0x14, 0xE6, 0x8D, 0xFE, 0x02, 0xDB, 0xB1, 0x79, 0x66, 0xBC, 0x63, 0x73, 0x4B, 0xFB, 0x2A,
-    0x8C, 0x27, 0xA0, 0x25, 0x9F, 0x88, 0x6A, 0x3E, 0xC3, 0x05, 0x19, 0xD1, 0xE9, 0xF2, 0xB9, 0xBE,
-    0x52, 0xAD, 0x02, 0x41, 0x09, 0x24, 0x51, 0x18, 0x09, 0x46, 0x62, 0xC8, 0x1D, 0x2B, 0xFD, 0xF5,
-    0xE7, 0xB7, 0x70, 0x27, 0x35, 0x70, 0x4F, 0x01, 0x71, 0x4A, 0x1C, 0x07, 0xC0, 0x7C, 0x4D, 0x9B,
-    0xE1, 0x02, 0x01, 0xB0, 0x0F, 0x05, 0x97, 0x93, 0x6C, 0xF6, 0x0C, 0xC6, 0x8A, 0xC5, 0x68, 0x8D,
-    0xFC, 0xC0, 0xCE, 0xF8, 0x92, 0x03, 0x28, 0xFE, 0xB4, 0x4D, 0x35, 0xF0, 0xF7, 0x39, 0xAD, 0x8B,
-    0x5E, 0xB1, 0x39, 0xE8, 0x82, 0x64, 0xB4, 0x89, 0x00, 0xC7, 0x0B, 0xB5, 0x4D, 0x18, 0xEA, 0x98,
-    0x3A, 0xB1, 0x44, 0x52, 0x3A, 0xD5, 0x9A, 0xB8, 0x6E, 0x28, 0xA4, 0x7A, 0x08, 0x31, 0x39, 0x93,
-    0x1E, 0xD0, 0xB8, 0x88, 0x48, 0x8C, 0x82, 0x71, 0x1A, 0x65, 0xA8, 0x65, 0xB2, 0x38, 0x65, 0xB9,
-    0x13, 0xE3, 0x2E, 0xBF, 0x48, 0x70, 0x97, 0x57, 0xAD, 0xEB, 0x5D, 0xB8, 0x37, 0x73, 0xEA, 0x11,
-    0x91, 0x37, 0x43, 0x62, 0x1E, 0x35, 0x74, 0xCB, 0xEB, 0x35, 0x85, 0x9A, 0x4C, 0xA8, 0xA1, 0x51,
-    0xC5, 0xC4, 0x19, 0x79, 0x34, 0xAC, 0x33, 0xA8, 0xE6, 0x39, 0x9C, 0x35, 0xC2, 0x36, 0xFB, 0xB4,
-    0x7E, 0x5E, 0xB3, 0x70, 0x91, 0x97, 0x0E, 0x9A, 0x7B, 0x7F, 0xC6, 0x89, 0xAA, 0xCC, 0xE3, 0x47,
-    0x9B, 0x0D, 0x55, 0x10, 0x85, 0x82, 0x33, 0xA5, 0xB4, 0xD9, 0xCF, 0x4C, 0xD2, 0x80, 0x97, 0x32,
-    0x5D, 0xDA, 0x9C, 0xD3, 0x45, 0x1C, 0x4D, 0xE7, 0xD1, 0x94, 0xE5, 0x1F, 0xCF, 0xF7, 0x94, 0xEE,
-    0xA9, 0x40, 0xF6, 0xB4, 0x63, 0xA6, 0x29, 0xBC, 0xFA, 0xE8, 0xB1, 0xC6, 0x93, 0x29, 0x31, 0x23,
-    0xE7, 0x87, 0xA8, 0x80, 0x13, 0x41, 0x0A, 0xD2, 0x0A, 0x66, 0xBF, 0x84, 0x06, 0x20, 0x4C, 0x4D,
-    0x5B, 0x1D, 0xC3, 0xE7, 0x72, 0xDB, 0xF6, 0xBC, 0x2D, 0x36, 0xB8, 0xCE, 0x43, 0x62, 0xDB, 0xA9,
-    0xD4, 0xFA, 0xFC, 0x60, 0x35, 0x77, 0x6C, 0x67, 0xF1, 0x33, 0xA5, 0xDA, 0x01, 0xB4, 0x6D, 0x9A,
-    0xE0, 0x6F, 0xBC, 0x9C, 0x68, 0xAF, 0x76, 0x57, 0xEE, 0x7C, 0x2F, 0x66, 0xE1, 0xA4, 0x27, 0x39,
-    0x62, 0x1D, 0xAA, 0x89, 0xD2, 0x8C, 0x77, 0x35, 0xB6, 0xDD, 0xD4, 0x58, 0xF7, 0x3D, 0xC0, 0xAF,
-    0xED, 0xF4, 0x30, 0xA3, 0x19, 0x44, 0xD7, 0x35, 0x71, 0x3C, 0xAC, 0x40, 0xC7, 0x59, 0x8B, 0xE4,
-    0x07, 0x22, 0x2F, 0xE3, 0x89, 0x51, 0x94, 0xBB, 0xB5, 0x5F, 0x05, 0xA5, 0xD3, 0x80, 0x77, 0x9F,
-    0xCD, 0xEA, 0xBA, 0xAD, 0xA1, 0x81, 0x75, 0xAF, 0x0F, 0x9F, 0x1A, 0xE5, 0x41, 0xE9, 0x57, 0x71,
-    0xE6, 0x34, 0xE7, 0x61, 0xF1, 0x27, 0x96, 0x76, 0x12, 0xE4, 0x26, 0x93, 0x59, 0x08, 0xC0, 0x31,
-    0xE6, 0x71, 0x05, 0x86, 0x6F, 0xC1, 0xF5, 0xA2, 0xDA, 0x43, 0xC9, 0xDE, 0x4F, 0x65, 0x9C, 0x03,
-    0x96, 0x63, 0x0A, 0x76, 0xB4, 0x1F, 0x97, 0xF0, 0x1C, 0xE1, 0x47, 0xE0, 0x24, 0xC9, 0x9B, 0x15,
-    0xCC, 0x6F, 0x0F, 0x5E, 0x2A, 0x77, 0x6A, 0x36, 0x7C, 0x90, 0xC7, 0x57, 0x11, 0x24, 0x40, 0x2E,
-    0x94, 0x07, 0xE7, 0x18, 0x16, 0xF1, 0x75, 0x96, 0x3F, 0xF1, 0xEF, 0x90, 0xD8, 0xE7, 0xD1, 0x3D,
-    0x6E, 0xB3, 0x84, 0xF0, 0xE5, 0x46, 0xC2, 0x29, 0x3D, 0xAF, 0xDF, 0x30, 0x25, 0xF2, 0xCC, 0x7B,
-    0xE3, 0x52, 0x93, 0xF6, 0x54, 0x92, 0x5F, 0x30, 0xA9, 0x7E, 0x49, 0x4E, 0x2F, 0xC0, 0x3B, 0x93,
-    0xCA, 0x3C, 0x5F, 0xB0, 0xF9, 0xC3, 0xDC, 0x7F, 0xA9, 0x13, 0x58, 0x0C, 0xC5, 0xF3, 0x7D, 0x0A,
-    0xA4, 0x31, 0x0D, 0x03, 0x0E, 0xE3, 0x41, 0x9C, 0x32, 0x1E, 0xC4, 0x6D, 0x3C, 0xB0, 0xD4, 0xD7,
-    0x40, 0x42, 0x3A, 0xD2, 0x11, 0x9B, 0xFD, 0x78, 0x00, 0xA7, 0x18, 0x65, 0x5A, 0xAE, 0xA5, 0x74,
-    0xDA, 0xB1, 0x32, 0x4B, 0xE6, 0xD4, 0xE7, 0xB6, 0x04, 0x1F, 0xE9, 0x29, 0xA0, 0x9E, 0xDD, 0x40,
-    0xD2, 0x8D, 0x00, 0xA4, 0x9E, 0x86, 0x3B, 0x37, 0x6F, 0x35, 0x5A, 0x88, 0x30, 0x61, 0xD1, 0xB0,
-    0x25, 0x4E, 0x9B, 0xDF, 0x59, 0xAB, 0xD0, 0x34, 0xDB, 0xA6, 0xF0, 0x36, 0x85, 0xB2, 0x5E, 0xD8,
-    0x2D, 0xBE, 0x27, 0xB3, 0x50, 0xF7, 0xEB, 0x4E, 0x75, 0x2D, 0xD4, 0x7F, 0xC5, 0x17, 0x39, 0x97,
-    0x11, 0xA3, 0xBD, 0x53, 0x2E, 0x17, 0x03, 0xC7, 0x76, 0x16, 0x27, 0x44, 0xB3, 0x4D, 0x55, 0x23,
-    0x4B, 0xCF, 0x1D, 0x5A, 0x80, 0xE3, 0x8C, 0xDF, 0x16, 0x13, 0xD5, 0xBC, 0x20, 0x4C, 0xBA, 0xDC,
-    0x7B, 0x49, 0xFC, 0x43, 0xC2, 0x1E, 0xF1, 0x72, 0xCF, 0xBA, 0x16, 0xA7, 0xB1, 0xA8, 0xE3, 0x14,
-    0xA6, 0x1B, 0x65, 0xC0, 0xA6, 0x0E, 0x2A, 0xCC, 0xB1, 0x9C, 0xC1, 0x5D, 0x36, 0x75, 0x3E, 0x66,
-    0xFE, 0xF6, 0xCF, 0xA2, 0x8D, 0x4A, 0x8E, 0x2E, 0xF0, 0xF4, 0x09, 0x99, 0x7D, 0xD5, 0x91, 0x72,
-    0x9E, 0x54, 0xEC, 0x67, 0xF6, 0xB6, 0x42, 0xDC, 0x2F, 0x50, 0x55, 0xCD, 0xB9, 0x1D, 0x87, 0x2C,
-    0x0A, 0x43, 0xE8, 0x8E, 0x41, 0x83, 0xB2, 0x92, 0x82, 0xC9, 0xE7, 0x8D, 0xF9, 0x39, 0x41, 0x7E,
-    0x9B, 0x63, 0xBC, 0x38, 0xC3, 0x78, 0x7D, 0x26, 0x3B, 0x33, 0x94, 0xCD, 0x78, 0x2C, 0x62, 0x1A,
-    0x16, 0x31, 0x1D, 0x3C, 0xD0, 0x9D, 0xDF, 0xAF, 0x43, 0x08, 0x71, 0xC3, 0x66, 0xA5, 0x04, 0xA4,
-    0x45, 0xAE, 0x3B, 0x65, 0xBF, 0x0D, 0x43, 0x8F, 0x14, 0xE1, 0x48, 0x21, 0x72, 0x55, 0x73, 0xE6,
-    0x99, 0xF0, 0x57, 0xF4, 0xDB, 0xA9, 0x36, 0x27, 0x9D, 0x69, 0xA7, 0x0D, 0xEB, 0xD4, 0x66, 0xD9,
-    0x56, 0x3A, 0xD2, 0x5C, 0xA3, 0x51, 0x95, 0x6F, 0x34, 0x0F, 0xAF, 0xD9, 0xA9, 0x44, 0x5A, 0xE7,
-    0x77, 0x1B, 0xC3, 0x15, 0xA3, 0x80, 0xFD, 0x03, 0xD8, 0x71, 0x3E, 0xF8, 0xB8, 0x88, 0x0B, 0x09,
-    0x3F, 0x64, 0x01, 0x13, 0xDE, 0xA5, 0xEB, 0x0E, 0x73, 0x36, 0x71, 0x6D, 0x03, 0x62, 0x71, 0x6F,
-    0x55, 0xE1, 0xFF, 0x54, 0xAB, 0xA7, 0x64, 0xD2, 0x75, 0x5C, 0xDA, 0x9E, 0xA6, 0xED, 0x15, 0x0E,
-    0xBB, 0x4D, 0x08, 0xED, 0x69, 0xFA, 0x4B, 0x4D, 0x97, 0x80, 0x5D, 0xAF, 0xC4, 0x7C, 0x94, 0x8B,
-    0xB9, 0xF2, 0x30, 0xF7, 0x6A, 0x31, 0x19, 0x14, 0xA3, 0x9F, 0x86, 0xD4, 0x25, 0xB0, 0x4B, 0x54,
-    0x9F, 0xC8, 0xAC, 0x47, 0x32, 0x22, 0xC3, 0x06, 0x84, 0x1B, 0x6A, 0xEC, 0x2E, 0xF4, 0xE8, 0x81,
-    0x13, 0x89, 0x41, 0xEE, 0xCE, 0x10, 0x73, 0xCC, 0xDF, 0x31, 0x07, 0xF3, 0x46, 0xD9, 0x45, 0x88,
-    0x57, 0x6D, 0x6F, 0xC3, 0x26, 0xE6, 0x76, 0xA9, 0xB5, 0xF8, 0x5F, 0xEE, 0x54, 0x1D, 0x35, 0x0C,
-    0xAD, 0xEE, 0xE3, 0xA2, 0xED, 0x49, 0xB8, 0x13, 0x6E, 0x46, 0xE6, 0x5B, 0x87, 0x3A, 0x90, 0x47,
-    0x0D, 0xE3, 0x92, 0x83, 0x5A, 0x81, 0x3C, 0xB4, 0xCD, 0x78, 0x96, 0x1E, 0xF0, 0xB5, 0xE5, 0x26,
-    0xE3, 0x51, 0x23, 0xD0, 0x86, 0x61, 0xB9, 0xCE, 0x95, 0xE8, 0xE9, 0xF6, 0xEC, 0x21, 0x9F, 0x75,
-    0xE4, 0x1A, 0xA1, 0x19, 0x91, 0xF6, 0x05, 0xE9, 0x98, 0x0A, 0xC4, 0x5F, 0x37, 0x7F, 0x9D, 0xCE,
-    0x87, 0x69, 0xAB, 0x76, 0xB4, 0xE2, 0xEC, 0x99, 0x03, 0x92, 0x60, 0x1A, 0xB0, 0x12, 0xEB, 0x9B,
-    0x8B, 0x7D, 0xA3, 0x9C, 0xA6, 0x57, 0x0B, 0xAF, 0x76, 0x4C, 0xE9, 0x97, 0xE0, 0x66, 0x32, 0xBE,
-    0x79, 0x00, 0xAF, 0x1A, 0x14, 0xE0, 0x38, 0x85, 0x93, 0x01, 0xCF, 0x06, 0x55, 0x5E, 0x42, 0x47,
-    0xA1, 0x3B, 0x88, 0xC6, 0xDC, 0xE0, 0x1E, 0xE2, 0x57, 0x6A, 0x94, 0x6A, 0xF4, 0x60, 0x5C, 0xEB,
-    0x21, 0x6A, 0xD4, 0x5E, 0xFB, 0xEA, 0x21, 0xDE, 0xFD, 0xD2, 0x64, 0xBF, 0x01, 0x8A, 0x8F, 0x1E,
-    0xC2, 0xAE, 0xFD, 0x99, 0xFF, 0x7B, 0x66, 0x2C, 0x97, 0x44, 0xE6, 0x6F, 0x10, 0xF8, 0xF0, 0x3E,
-    0x09, 0xC4, 0x60, 0xDE, 0xBB, 0xC9, 0xEE, 0x5D, 0xD0, 0x76, 0x0D, 0xE6, 0xDB, 0x19, 0x49, 0xDB,
-    0x47, 0x3B, 0xF4, 0xDE, 0x07, 0xDD, 0x43, 0xF9, 0x22, 0xFD, 0x3D, 0xB0, 0x80, 0xD3, 0x5A, 0x6A,
-    0x73, 0x9B, 0x69, 0xEB, 0x31, 0x42, 0xBB, 0x3D, 0xC9, 0x49, 0x86, 0x44, 0x37, 0xEF, 0x8B, 0xB8,
-    0x8B, 0x7D, 0x91, 0x05, 0x6B, 0x08, 0x4C, 0x66, 0x71, 0x5C, 0x99, 0x40, 0x0E, 0x35, 0xB2, 0xC3,
-    0x1A, 0x5E, 0x6F, 0x12, 0x65, 0x7E, 0x95, 0x5C, 0x18, 0x17, 0x28, 0xA7, 0x71, 0xF9, 0x81, 0xF4,
-    0xD2, 0x27, 0xE2, 0xE0, 0xC6, 0x68, 0xAA, 0x38, 0x56, 0xE6, 0x71, 0x5F, 0x67, 0x53, 0x5A, 0x27,
-    0x46, 0x77, 0x74, 0xE7, 0x88, 0x78, 0xBD, 0x6A, 0x9B, 0x8E, 0x2E, 0x96, 0x31, 0xF8, 0x18, 0xA1,
-    0xE0, 0xC2, 0x72, 0xBF, 0xE3, 0xDB, 0xE4, 0xB5, 0xD8, 0xDB, 0x08, 0xD3, 0xC9, 0xB2, 0x1D, 0x7D,
-    0x7B, 0x7C, 0x9C, 0x9B, 0x1A, 0x3C, 0x1B, 0x95, 0x1B, 0x9B, 0x7E, 0xF3, 0x96, 0xDF, 0xB6, 0x86,
-    0xAE, 0x46, 0xBF, 0x35, 0xEF, 0x71, 0x17, 0xE3, 0xC8, 0xE2, 0xCB, 0x46, 0x19, 0x75, 0x20, 0x6E,
-    0xA3, 0xC6, 0x3B, 0xD4, 0x0A, 0xA8, 0x28, 0x2E, 0x43, 0x23, 0x3A, 0x17, 0xF0, 0xCD, 0x46, 0x7B,
-    0x3E, 0x65, 0xBD, 0x31, 0x2E, 0xDD, 0x2F, 0x26, 0x61, 0x3E, 0x3C, 0xDF, 0x39, 0xF6, 0x6F, 0x36,
-    0x5A, 0x7A, 0xC2, 0x2B, 0xD7, 0xE0, 0x9B, 0x96, 0x3C, 0xD3, 0x37, 0x9C, 0xA6, 0x7E, 0x76, 0xB9,
-    0x1D, 0x3C, 0xE3, 0xEB, 0x10, 0x09, 0xA3, 0x50, 0x5C, 0xB5, 0x1B, 0xA1, 0xC1, 0x84, 0x2D, 0xB9,
-    0x74, 0xBB, 0x0B, 0xA5, 0x78, 0xEA, 0xE4, 0xED, 0x88, 0x1E, 0xE0, 0xFD, 0xD4, 0x35, 0x3B, 0x0F,
-    0xD3, 0x60, 0xE2, 0x18, 0x3A, 0x99, 0x71, 0xCA, 0xAE, 0x8E, 0xA6, 0x56, 0x5C, 0x25, 0x25, 0x3D,
-    0x02, 0x1A, 0x59, 0x54, 0x3D, 0x86, 0xB6, 0x84, 0x61, 0x3B, 0x2E, 0x36, 0xE9, 0xDA, 0x0D, 0x95,
-    0x8F, 0x96, 0x6F, 0x55, 0xFF, 0x94, 0xBC, 0xCC, 0x1D, 0xD5, 0x3B, 0x38, 0x89, 0xF2, 0xC8, 0xBB,
-    0xCB, 0x3E, 0x5C, 0x7A, 0xA6, 0x03, 0x08, 0xD3, 0xDF, 0xE2, 0xEB, 0x3F, 0x43, 0xFA, 0x9D, 0xE9,
-    0x74, 0xB3, 0x10, 0x53, 0x84, 0x05, 0x72, 0xA7, 0xA0, 0x44, 0xD2, 0x10, 0x14, 0xA8, 0xE7, 0xC2,
-    0xC2, 0x6B, 0xD3, 0x1C, 0x24, 0x37, 0x15, 0x93, 0x9B, 0xD2, 0x26, 0x61, 0x6C, 0xF7, 0x58, 0xD2,
-    0xE7, 0xDC, 0xF7, 0x38, 0xFB, 0x29, 0x55, 0xA8, 0x7D, 0xB1, 0x41, 0xDC, 0x1B, 0xF3, 0x4C, 0xCB,
-    0xBE, 0xD2, 0xB5, 0x9F, 0x0B, 0x04, 0x4B, 0xCA, 0xEA, 0x33, 0x5F, 0xE3, 0x86, 0xB1, 0x63, 0xAE,
-    0x34, 0xB4, 0xD4, 0x3D, 0x9A, 0x6A, 0x3B, 0x7C, 0xDC, 0xBA, 0xD7, 0xE4, 0xA0, 0x0C, 0x7A, 0x9D,
-    0xB7, 0x4D, 0x54, 0x06, 0x29, 0xC0, 0x45, 0x0F, 0x30, 0x03, 0x2A, 0x2F, 0x86, 0xAA, 0xD5, 0x44,
-    0xF4, 0xF3, 0x27, 0xB1, 0x4D, 0x50, 0x0B, 0x26, 0xEC, 0xD2, 0xCE, 0x6B, 0xCF, 0x14, 0x86, 0x4A,
-    0xBD, 0xAF, 0xA9, 0x29, 0x02, 0x90, 0x7F, 0x9F, 0xBB, 0xC6, 0xAC, 0xDF, 0xD7, 0x64, 0xF5, 0x19,
-    0xC2, 0x70, 0x2E, 0xB9, 0xA9, 0x84, 0x4D, 0xC0, 0x37, 0xCF, 0x76, 0x44, 0x56, 0x23, 0x58, 0xF9,
-    0x6F, 0x97, 0x1B, 0x80, 0x47, 0x8D, 0x80, 0xA1, 0x2F, 0xC8, 0x87, 0xA2, 0x9E, 0x4B, 0x82, 0xEC,
-    0xCE, 0xA1, 0x34, 0xE0, 0xA8, 0x11, 0xA4, 0xF3, 0x8D, 0xA9, 0xA0, 0x23, 0xCE, 0x52, 0xD8, 0xDF,
-    0x7F, 0x3F, 0x68, 0x83, 0xAF, 0x0B, 0x2D, 0x42, 0x2B, 0x97, 0x1E, 0x5B, 0x7A, 0x65, 0x20, 0x07,
-    0x93, 0xFB, 0xDA, 0x0D, 0x80, 0x4D, 0x7C, 0x62, 0x68, 0x0E, 0xFD, 0xCC, 0x85, 0x25, 0xC3, 0x7A,
-    0xBC, 0x87, 0x79, 0x50, 0x84, 0x7F, 0xC9, 0xC3, 0x3C, 0x0E, 0x40, 0xB6, 0xC3, 0x3C, 0xBC, 0x0E,
-    0x9F, 0x1C, 0xBD, 0x59, 0x86, 0x59, 0x74, 0x31, 0x8F, 0xD2, 0x68, 0x87, 0x13, 0x9C, 0x62, 0x0A,
-    0x61, 0x8D, 0xEC, 0xC1, 0xE7, 0xBB, 0x78, 0x3A, 0x52, 0xCC, 0xA6, 0xC8, 0x4B, 0xD2, 0xED, 0xB4,
-    0x2C, 0xBC, 0x31, 0xB0, 0xFD, 0x3F, 0xDE, 0x18, 0x40, 0x92, 0x1F, 0x2C, 0x16, 0x27, 0x90, 0x05,
-    0xF2, 0x08, 0xF8, 0x5C, 0x38, 0xAC, 0xB8, 0x33, 0x5D, 0x4D, 0x62, 0x7A, 0xF4, 0xC4, 0x23, 0x0A,
-    0xB6, 0xE9, 0x2A, 0x2D, 0x7A, 0x95, 0x2E, 0x75, 0xB9, 0xFE, 0xA8, 0x4D, 0x5D, 0x02, 0xF3, 0x66,
-    0xA9, 0x5E, 0xA3, 0xCB, 0xAE, 0xC7, 0xF3, 0x54, 0xDF, 0xDA, 0x56, 0xB6, 0x1C, 0xC7, 0x9F, 0x01,
-    0x8C, 0xA7, 0xDB, 0xDF, 0x3F, 0x72, 0x18, 0x5F, 0xBB, 0x19, 0x7E, 0xF4, 0xEB, 0x61, 0x15, 0xE3,
-    0x69, 0xDB, 0xCB, 0x5A, 0x41, 0x73, 0xC1, 0x70, 0x93, 0x32, 0x26, 0xD5, 0x62, 0x8F, 0xCB, 0xA9,
-    0x50, 0xD9, 0xBB, 0xE7, 0x66, 0x08, 0xB3, 0x4F, 0x24, 0xEE, 0xCC, 0x9D, 0x74, 0x76, 0xA0, 0x3D,
-    0x7D, 0x39, 0x57, 0x37, 0xB0, 0xFF, 0x45, 0x86, 0xCE, 0xBF, 0xD5, 0x88, 0xBE, 0x54, 0xB6, 0x76,
-    0xE7, 0x49, 0x8B, 0x7E, 0xAD, 0xBE, 0x96, 0x5E, 0xEC, 0xB5, 0xFD, 0xAF, 0x40, 0xAB, 0x7D, 0xED,
-    0x00, 0xFC, 0x64, 0xAC, 0x5A, 0xAC, 0xA5, 0x7A, 0x52, 0x76, 0x71, 0x69, 0xA1, 0x50, 0xDF, 0xAF,
-    0xD1, 0x83, 0x7C, 0x79, 0x0B, 0xEE, 0x5D, 0x30, 0x89, 0xAF, 0x72, 0x23, 0xA7, 0x77, 0xB5, 0x92,
-    0xA4, 0xC2, 0xE4, 0x93, 0x1C, 0x7C, 0xFA, 0x2C, 0xD0, 0xC7, 0xE4, 0x38, 0x25, 0xE1, 0x4E, 0x3C,
-    0x0E, 0xDE, 0xC4, 0x61, 0xEC, 0xE6, 0xBB, 0x0D, 0xBC, 0x53, 0x23, 0x1B, 0x82, 0x5A, 0x83, 0xDB,
-    0x83, 0x87, 0x6F, 0xCC, 0x24, 0xB8, 0x07, 0x1F, 0x11, 0xFE, 0xD9, 0x30, 0xA2, 0x9F, 0x6A, 0x0B,
-    0xDE, 0xFF, 0xFA, 0x3E, 0x5D, 0x5B, 0xB6, 0xDB, 0x46, 0x6C, 0x74, 0x41, 0x77, 0x47, 0xDF, 0x20,
-    0x3D, 0x7B, 0xB0, 0x91, 0x74, 0xEC, 0xE5, 0xFD, 0x1F, 0xD5, 0x5C, 0x3D, 0x90, 0x1C, 0xC7, 0x75,
-    0xEE, 0x99, 0x15, 0x30, 0x36, 0xA6, 0xCA, 0xC3, 0x00, 0x2E, 0xD1, 0x84, 0x89, 0x71, 0x95, 0x29,
-    0x15, 0x4D, 0x97, 0x30, 0xA9, 0x02, 0xF0, 0x66, 0x68, 0x85, 0x0E, 0xCC, 0x80, 0x20, 0x02, 0x06,
-    0x56, 0x66, 0xAA, 0x54, 0x25, 0x24, 0x0E, 0x18, 0xDC, 0xED, 0x0E, 0xCB, 0x01, 0x43, 0x22, 0x91,
-    0x9D, 0x22, 0x40, 0x40, 0xAE, 0x02, 0x25, 0x0C, 0x50, 0xD2, 0xED, 0xED, 0xC0, 0x0C, 0x18, 0x38,
-    0xE0, 0x94, 0x54, 0x2C, 0x87, 0x9C, 0xB2, 0x11, 0xD8, 0x64, 0xC0, 0xA5, 0x35, 0x2C, 0x0D, 0xAE,
-    0x66, 0x77, 0xFC, 0xBE, 0xEF, 0xF5, 0xFC, 0xEC, 0xEE, 0x1D, 0x70, 0x94, 0x70, 0xB8, 0xC3, 0x01,
-    0xF7, 0x96, 0xDC, 0x9D, 0xED, 0x7E, 0xFD, 0xF5, 0xEB, 0xF7, 0xDF, 0x30, 0xC6, 0x9D, 0x7E, 0x68,
-    0x8C, 0xD7, 0xAC, 0x40, 0x96, 0x66, 0xF8, 0x13, 0x83, 0xCC, 0x13, 0x21, 0x8D, 0x90, 0x51, 0x93,
-    0xCA, 0x23, 0x9F, 0x0B, 0x09, 0x3E, 0xCD, 0x8C, 0x09, 0xDF, 0x17, 0x12, 0xFB, 0x42, 0xC6, 0x20,
-    0xB5, 0x9F, 0x1B, 0xB7, 0xF4, 0x72, 0x33, 0x5A, 0x78, 0x85, 0xF1, 0xF3, 0x51, 0x61, 0x82, 0x6C,
-    0xB4, 0x30, 0x51, 0xD3, 0x2C, 0xCC, 0x04, 0x64, 0x35, 0xFD, 0xC5, 0xC2, 0xA9, 0xE5, 0x21, 0x79,
-    0x57, 0x9E, 0x2C, 0x8C, 0x53, 0x05, 0x99, 0x90, 0x48, 0x46, 0xAC, 0x31, 0x55, 0x7D, 0x00, 0xD2,
-    0xF2, 0x23, 0xAC, 0xF8, 0x4D, 0x3D, 0x64, 0xC7, 0x5F, 0x8D, 0x32, 0x13, 0x37, 0x9F, 0x64, 0xA6,
-    0xB9, 0xF9, 0x55, 0x36, 0xAA, 0x4C, 0x93, 0xFA, 0x32, 0x76, 0x22, 0xA3, 0xC4, 0x26, 0x4C, 0x85,
-    0xC4, 0x09, 0x88, 0x70, 0x04, 0x32, 0x93, 0x17, 0x19, 0x6E, 0x6C, 0x1C, 0x10, 0x79, 0x7C, 0x6C,
-    0xFC, 0x52, 0x3E, 0x88, 0x84, 0xDC, 0x5F, 0x2D, 0x4C, 0xD8, 0xFC, 0xD7, 0x42, 0xE6, 0xF9, 0xBB,
-    0xC2, 0x98, 0xE7, 0x38, 0xBE, 0x9B, 0x5C, 0x14, 0x3A, 0xCA, 0x02, 0xD0, 0x43, 0xC1, 0xC3, 0x38,
-    0x4D, 0x85, 0x0F, 0xA2, 0xDB, 0x66, 0xE3, 0x87, 0xC8, 0x28, 0x34, 0xC4, 0x46, 0xC1, 0x51, 0x74,
-    0x14, 0x1E, 0xC5, 0x47, 0x01, 0x52, 0x84, 0x08, 0x91, 0x62, 0xA4, 0x20, 0x29, 0x4A, 0x0A, 0x93,
-    0xE2, 0xA4, 0x40, 0x11, 0x29, 0x43, 0xA8, 0x0C, 0xB1, 0x32, 0x04, 0xCB, 0x10, 0x2D, 0x43, 0xB8,
-    0xC8, 0x40, 0x6D, 0x14, 0x30, 0x61, 0xFC, 0x92, 0xCC, 0x9D, 0x86, 0x60, 0x5B, 0x60, 0x73, 0xC9,
-    0xF5, 0xAD, 0xF4, 0x69, 0x62, 0x77, 0x46, 0xB2, 0x22, 0x8B, 0x2D, 0x80, 0x38, 0xD6, 0x7A, 0x0D,
-    0x1C, 0x5C, 0xEF, 0x48, 0x8C, 0x4D, 0x0B, 0x8B, 0xA7, 0x83, 0x81, 0x0F, 0x06, 0x76, 0x30, 0xC9,
-    0x3D, 0x90, 0x45, 0x47, 0x56, 0x40, 0x64, 0xD2, 0x6F, 0x85, 0x73, 0x17, 0x62, 0x82, 0x8F, 0x82,
-    0xAC, 0x45, 0x6D, 0x1F, 0xEF, 0x17, 0x6B, 0xF2, 0x15, 0x35, 0x82, 0x50, 0x23, 0xE2, 0x1F, 0xAE,
-    0x7E, 0x51, 0x9A, 0x49, 0x2E, 0x28, 0x43, 0x1E, 0x47, 0x55, 0xF7, 0xED, 0x1C, 0xAB, 0xC3, 0x10,
-    0x80, 0x44, 0xC7, 0x21, 0x99, 0x80, 0x1C, 0x1C, 0x41, 0x26, 0xDD, 0x23, 0x71, 0xD6, 0x22, 0xE3,
-    0xAF, 0x6E, 0xDC, 0xC3, 0x3C, 0x15, 0x24, 0xEF, 0x81, 0xBC, 0xF1, 0x06, 0x79, 0xFC, 0x40, 0x66,
-    0x2A, 0x75, 0x8E, 0x48, 0xF8, 0xDF, 0x6B, 0x17, 0xA3, 0x3F, 0x5E, 0x53, 0x08, 0x8A, 0x0B, 0xD3,
-    0xFC, 0xFC, 0x0E, 0xF8, 0x11, 0x08, 0xB9, 0x16, 0xF0, 0x11, 0xDB, 0x29, 0x30, 0xD7, 0x78, 0xF0,
-    0xCB, 0xF7, 0x13, 0x4C, 0x7A, 0x45, 0x0E, 0x75, 0x23, 0xE7, 0x4A, 0xC4, 0xF4, 0x02, 0x4F, 0xCF,
-    0xDB, 0x3C, 0x66, 0x3C, 0x41, 0xF2, 0xFF, 0xC1, 0x7F, 0x40, 0x46, 0x70, 0x2A, 0xCA, 0xE1, 0x94,
-    0x67, 0x0C, 0xC8, 0xDF, 0x40, 0xAA, 0x71, 0xAE, 0x52, 0xE3, 0xFF, 0x67, 0x6E, 0x62, 0x77, 0x21,
-    0xDB, 0xFC, 0xD1, 0x29, 0x01, 0x72, 0x19, 0x64, 0xD9, 0x91, 0xDA, 0x6C, 0xFD, 0x9C, 0x29, 0x16,
-    0x97, 0xED, 0x0A, 0xE6, 0x46, 0x05, 0xC3, 0x9C, 0x92, 0x60, 0xBC, 0x6C, 0x9E, 0x97, 0xAF, 0x1A,
-    0x19, 0x27, 0x78, 0xAF, 0xC0, 0xD8, 0x32, 0xCA, 0x88, 0x3A, 0xB9, 0x3A, 0x37, 0x60, 0xFC, 0x85,
-    0xFC, 0x09, 0x92, 0x7D, 0xE3, 0x7F, 0xBC, 0x10, 0xF1, 0xCD, 0x54, 0x8E, 0xEB, 0x53, 0x02, 0x04,
-    0x93, 0x19, 0x4E, 0x27, 0x03, 0x7F, 0xBC, 0xE0, 0x89, 0xC9, 0xDA, 0xC3, 0x03, 0x6D, 0xB5, 0x29,
-    0x24, 0xD0, 0x34, 0x71, 0x83, 0x53, 0x25, 0xB4, 0xC0, 0xF0, 0x61, 0x85, 0xE7, 0xDC, 0x9A, 0x4F,
-    0xAF, 0xC8, 0xEA, 0x84, 0x34, 0x26, 0xAA, 0x31, 0x4C, 0x8D, 0x50, 0x98, 0xA3, 0x75, 0x0A, 0x63,
-    0x35, 0x31, 0x30, 0x5F, 0x07, 0x5C, 0x41, 0x0D, 0x2A, 0xE3, 0x88, 0xD2, 0xF4, 0x4A, 0x13, 0x26,
-    0x26, 0x28, 0xA0, 0x29, 0x26, 0x50, 0xA4, 0x17, 0x85, 0x9F, 0x78, 0x3A, 0x27, 0x50, 0xB2, 0x37,
-    0x66, 0x4E, 0xB8, 0xF0, 0xF3, 0xC6, 0x05, 0xBE, 0x54, 0x11, 0x95, 0x4C, 0x45, 0x75, 0xE9, 0x96,
-    0x58, 0x8F, 0x4C, 0xC3, 0xD3, 0x3E, 0xFA, 0xBF, 0x9C, 0x2F, 0xAA, 0x0C, 0x61, 0x28, 0x05, 0x78,
-    0xDA, 0xCE, 0xB8, 0xA1, 0x51, 0x85, 0xE2, 0xE6, 0xE6, 0x42, 0x1C, 0xA8, 0xBC, 0x09, 0x29, 0x50,
-    0xA3, 0x02, 0x37, 0xAA, 0xC2, 0x8D, 0x2A, 0x71, 0xA3, 0x6A, 0xDC, 0xA8, 0x22, 0x37, 0xAA, 0xCA,
-    0x8D, 0x2A, 0x73, 0xA3, 0xEA, 0xDC, 0xA8, 0x42, 0x97, 0x97, 0xFB, 0x87, 0x60, 0x81, 0x4A, 0x1D,
-    0x3B, 0xF7, 0x23, 0xF2, 0xF0, 0xDC, 0x13, 0x02, 0x73, 0xD2, 0xC0, 0x64, 0xCF, 0x49, 0x7F, 0xFA,
-    0xC5, 0xDD, 0x27, 0x01, 0xA6, 0x62, 0x69, 0xDA, 0x13, 0x71, 0xE1, 0xCD, 0x87, 0xCA, 0x62, 0xDA,
-    0x32, 0xCA, 0x5D, 0x53, 0x14, 0x15, 0xC4, 0x09, 0x30, 0x74, 0x9A, 0x37, 0x05, 0x42, 0x01, 0x60,
-    0x9E, 0x5A, 0x00, 0x15, 0x3F, 0x85, 0x4F, 0xD1, 0x53, 0xF0, 0x14, 0x3B, 0x85, 0x4E, 0x91, 0x53,
-    0xE0, 0x14, 0x37, 0x85, 0x4D, 0x51, 0x53, 0xD0, 0x2C, 0x66, 0x16, 0xB2, 0xE9, 0x34, 0xC1, 0x79,
-    0x21, 0x59, 0x97, 0x4B, 0x59, 0x87, 0x30, 0x98, 0x29, 0x19, 0x77, 0xB2, 0xBB, 0xDF, 0x69, 0xBB,
-    0xBA, 0x5D, 0x13, 0x10, 0x94, 0x43, 0x3F, 0xBD, 0x2B, 0xA2, 0xDE, 0x94, 0x4A, 0xB8, 0x28, 0x80,
-    0xA7, 0x06, 0x94, 0x24, 0xC4, 0xC1, 0x0E, 0xB1, 0x64, 0x98, 0x2B, 0x7B, 0x74, 0xA7, 0xD3, 0x14,
-    0xA0, 0x65, 0x82, 0x19, 0x30, 0xB9, 0x24, 0xA3, 0x84, 0x72, 0x7C, 0xC3, 0xA6, 0xEC, 0x1D, 0x02,
-    0xF9, 0x80, 0xE7, 0xF3, 0x66, 0x39, 0xAA, 0x9C, 0xCA, 0x2F, 0xE0, 0x65, 0xB8, 0x65, 0x98, 0x7A,
-    0x8B, 0xF8, 0xB5, 0x79, 0x2E, 0x0C, 0xCA, 0xC7, 0x0F, 0xCC, 0x38, 0x39, 0xF2, 0x7C, 0x26, 0x72,
-    0x3E, 0x13, 0x3D, 0x9F, 0x60, 0xF8, 0xB6, 0x9B, 0x8A, 0x15, 0xF7, 0x84, 0x9F, 0x15, 0xDC, 0xA0,
-    0x39, 0xB4, 0xD0, 0x95, 0xE2, 0x3C, 0x2C, 0xFD, 0x4F, 0x45, 0x95, 0x86, 0x66, 0xD7, 0x04, 0x5F,
-    0x96, 0x54, 0x49, 0xE6, 0x20, 0x39, 0x15, 0x08, 0x8C, 0x93, 0xB6, 0x4A, 0xD7, 0x5F, 0xB4, 0xE7,
-    0x77, 0x53, 0x2B, 0x9D, 0x0D, 0x04, 0x82, 0x41, 0xAF, 0x6F, 0x77, 0xD6, 0x79, 0x7A, 0x92, 0x10,
-    0x9C, 0xD9, 0xFA, 0x76, 0x5B, 0x57, 0xD8, 0xCB, 0x5A, 0x7F, 0x38, 0xC0, 0xD3, 0xC1, 0xFF, 0xE0,
-    0xBD, 0xFA, 0x89, 0xAF, 0x57, 0xA4, 0xFB, 0x82, 0xF0, 0x3F, 0xCA, 0x75, 0x9E, 0xD0, 0xD8, 0x5F,
-    0x51, 0x4F, 0x7E, 0x7B, 0xC0, 0x6E, 0xCB, 0x1F, 0x53, 0x42, 0xF3, 0xEC, 0x72, 0x00, 0x70, 0x11,
-    0x2E, 0xDA, 0x05, 0x9E, 0x83, 0x63, 0x71, 0x49, 0x78, 0xDF, 0x33, 0xDE, 0x6F, 0x4A, 0x51, 0x52,
-    0xB9, 0x06, 0x2E, 0xB3, 0xD3, 0x91, 0x0B, 0x63, 0x5E, 0xE9, 0x23, 0x46, 0x97, 0x76, 0xDB, 0xFF,
-    0x2D, 0xF8, 0x8E, 0x5E, 0xC3, 0x8A, 0xDE, 0x91, 0x3F, 0x9B, 0x07, 0xE5, 0x01, 0x1E, 0x84, 0xEE,
-    0x0C, 0x57, 0x53, 0x41, 0x5B, 0x3C, 0x9B, 0xE7, 0xE9, 0x85, 0xCA, 0xFA, 0x89, 0x09, 0xCF, 0x99,
-    0x7A, 0x37, 0xEA, 0xDE, 0xE8, 0x52, 0x6D, 0x68, 0x2A, 0x46, 0x68, 0x0A, 0x33, 0x33, 0x12, 0x95,
-    0x77, 0x20, 0xB4, 0x84, 0x6B, 0x23, 0xB6, 0x68, 0x48, 0x27, 0x34, 0x11, 0x31, 0xC1, 0x13, 0x4F,
-    0x47, 0x80, 0x0B, 0x11, 0x88, 0xC1, 0xD7, 0x11, 0xE3, 0x80, 0xC9, 0x13, 0x30, 0xF2, 0xB0, 0x37,
-    0x37, 0x2E, 0x62, 0xAA, 0x00, 0x13, 0x47, 0xE0, 0x61, 0x26, 0x0E, 0xA0, 0xBB, 0x10, 0x73, 0xEE,
-    0xA7, 0x7E, 0x32, 0x60, 0x5E, 0x1C, 0x65, 0x84, 0x47, 0x5F, 0x2F, 0x4C, 0xFC, 0xD9, 0xAF, 0x25,
-    0x98, 0x33, 0x71, 0x01, 0xFB, 0x96, 0xCB, 0x9C, 0x41, 0xE6, 0x61, 0x0E, 0x61, 0x3B, 0xCC, 0x30,
-    0x61, 0x2A, 0x24, 0x4A, 0x68, 0x7C, 0x84, 0x4C, 0x40, 0x56, 0x42, 0xDC, 0xA5, 0x3C, 0xE4, 0x0B,
-    0x29, 0xC7, 0xFB, 0xA2, 0xB3, 0xAA, 0x5A, 0xEC, 0x56, 0x2E, 0x02, 0xF0, 0x1D, 0x07, 0x70, 0xB9,
-    0xF4, 0x7E, 0x28, 0x49, 0x85, 0xF9, 0x2B, 0xAC, 0x3E, 0xFE, 0x57, 0xE1, 0x35, 0x06, 0xDA, 0x97,
-    0x1A, 0x06, 0xEB, 0xD0, 0x79, 0x86, 0x5A, 0xCF, 0x50, 0xEF, 0xA9, 0x33, 0x66, 0xD6, 0x74, 0xDF,
-    0x39, 0x46, 0xDA, 0x49, 0xD5, 0x9A, 0x08, 0x59, 0xC1, 0xD3, 0x9E, 0x23, 0x16, 0xB8, 0x72, 0xC7,
-    0x9C, 0x2F, 0x90, 0xA9, 0x55, 0x5B, 0x1C, 0xE8, 0x35, 0x6F, 0xEA, 0xD6, 0xF3, 0x2D, 0xCE, 0x8F,
-    0xB7, 0x57, 0xE7, 0x01, 0xE4, 0x73, 0x0C, 0xA0, 0xA2, 0x58, 0x9A, 0x76, 0x11, 0x16, 0x42, 0x9A,
-    0x1F, 0xDA, 0x03, 0x59, 0xA7, 0x7D, 0x0A, 0xC7, 0x91, 0xA7, 0xD1, 0x94, 0xED, 0xD3, 0xEA, 0xDF,
-    0x67, 0xE7, 0x0D, 0xEF, 0x63, 0x35, 0xF5, 0xE2, 0x28, 0x4D, 0x2D, 0x20, 0x8F, 0x08, 0x5A, 0x07,
-    0xDD, 0x98, 0x36, 0x68, 0x8F, 0x74, 0x46, 0x53, 0x54, 0xD3, 0x16, 0xD5, 0x78, 0x78, 0x18, 0x1A,
-    0xB8, 0xAB, 0xA9, 0xEC, 0xA4, 0xD8, 0x30, 0x99, 0x1D, 0xB4, 0xA6, 0x29, 0xAB, 0x69, 0xCB, 0x6A,
-    0x9B, 0xED, 0x43, 0x68, 0x50, 0x02, 0x50, 0x61, 0x3A, 0x24, 0x7D, 0xF4, 0x84, 0xC6, 0x81, 0x92,
-    0xF0, 0x60, 0x2B, 0x43, 0xE8, 0x8C, 0x71, 0x0C, 0xCB, 0x89, 0xEF, 0xE7, 0xA3, 0x16, 0x69, 0x27,
-    0xD9, 0xB6, 0x95, 0x94, 0x95, 0xA8, 0x93, 0x17, 0x1E, 0xE3, 0xB1, 0x2F, 0x72, 0x36, 0x9B, 0x88,
-    0x19, 0x5C, 0x3E, 0xBC, 0x95, 0x99, 0x26, 0x93, 0xB9, 0x1A, 0x99, 0xD0, 0x59, 0x0A, 0x71, 0xC1,
-    0xE1, 0xA8, 0xD4, 0xC4, 0x1D, 0xF7, 0x46, 0x0C, 0x63, 0x2E, 0xE3, 0xF8, 0x08, 0x27, 0x02, 0x4B,
-    0xC6, 0x18, 0x7D, 0x0F, 0xA3, 0xCF, 0x30, 0x3A, 0xF3, 0x96, 0x35, 0x27, 0x42, 0x8C, 0xA7, 0x8B,
-    0xB0, 0xAB, 0xB0, 0xCB, 0x08, 0x1B, 0xFC, 0xC0, 0x15, 0xC0, 0xCB, 0x2B, 0x02, 0xD1, 0xFC, 0x7F,
-    0xF5, 0x3B, 0x89, 0x8D, 0xAB, 0x2C, 0x7A, 0x70, 0x03, 0x70, 0x10, 0x14, 0x3F, 0x0B, 0xA0, 0x45,
-    0xD0, 0x42, 0x68, 0x31, 0xB4, 0x20, 0x5A, 0xFC, 0xB0, 0x15, 0x4C, 0xB8, 0x26, 0xED, 0xE4, 0x5B,
-    0x3C, 0x60, 0xDB, 0x08, 0xCD, 0x3A, 0x52, 0xCE, 0xAD, 0xCF, 0x5E, 0xC7, 0x3C, 0x08, 0xF6, 0x9B,
-    0x62, 0x88, 0xD4, 0x9E, 0x27, 0x87, 0x62, 0x3F, 0x16, 0x49, 0xAA, 0x57, 0x73, 0x41, 0x2A, 0x17,
-    0x29, 0x6D, 0x92, 0x6F, 0x85, 0xD4, 0xCE, 0xD1, 0x48, 0x39, 0x89, 0x2B, 0x93, 0x57, 0x3E, 0x82,
-    0x3A, 0x31, 0x04, 0xD7, 0x43, 0x79, 0xEF, 0x9F, 0xDD, 0x3B, 0x9B, 0x19, 0x10, 0xF9, 0x14, 0xB9,
-    0xE5, 0x87, 0x9D, 0x8B, 0xD4, 0xC9, 0x39, 0xBD, 0xA3, 0xFE, 0xA4, 0x1D, 0xB5, 0xED, 0x7D, 0x4A,
-    0x84, 0xA4, 0x77, 0xC0, 0x3A, 0xDF, 0x8B, 0x71, 0xA6, 0x0B, 0x02, 0x69, 0x10, 0xFF, 0x09, 0x03,
-    0xBC, 0xEE, 0xA4, 0xDE, 0x6A, 0x94, 0x05, 0xCD, 0x57, 0xC9, 0x35, 0xBF, 0x31, 0x2F, 0x9B, 0x0F,
-    0x7A, 0x9E, 0xF6, 0xEC, 0x10, 0xB5, 0xFD, 0xAD, 0xD4, 0x7F, 0x03, 0x6F, 0xE0, 0x0A, 0xBF, 0x60,
-    0x8C, 0xB1, 0x69, 0xAE, 0x0C, 0xE1, 0x17, 0x3C, 0x81, 0xA5, 0xA8, 0xE5, 0xE5, 0xA8, 0xA8, 0x2D,
-    0xA2, 0xBB, 0x98, 0x73, 0xB5, 0x47, 0x0E, 0x98, 0x6D, 0x0F, 0xD8, 0xA6, 0x5B, 0x62, 0xBB, 0xBE,
-    0x0D, 0xDE, 0xDC, 0x4A, 0x57, 0x86, 0x85, 0x5D, 0x9C, 0x7E, 0xE8, 0x37, 0xCB, 0xBE, 0xF4, 0xB0,
-    0xC7, 0xA7, 0x6B, 0xFE, 0xAD, 0xB0, 0x0A, 0xCD, 0xCA, 0xCB, 0x5F, 0x99, 0x50, 0xE6, 0x13, 0xFE,
-    0x03, 0x55, 0x96, 0x29, 0xA6, 0x8A, 0x74, 0x12, 0xF8, 0x1F, 0x81, 0xB9, 0x2E, 0xBE, 0x47, 0xB5,
-    0x15, 0x73, 0x9D, 0xF6, 0x02, 0xC4, 0xAF, 0xF5, 0xD3, 0xAB, 0xC6, 0x3B, 0xAC, 0x45, 0x81, 0xC9,
-    0xF8, 0x3F, 0x4B, 0x9F, 0xFC, 0xC6, 0x9C, 0xF2, 0x1A, 0x90, 0x5D, 0x1D, 0xC6, 0x16, 0xD1, 0x66,
-    0x6C, 0x61, 0x7E, 0x8C, 0xEF, 0x21, 0x29, 0x51, 0x0E, 0xF2, 0x6D, 0x83, 0xDD, 0x10, 0x95, 0xA7,
-    0x1B, 0xD2, 0xE5, 0x33, 0x06, 0x1B, 0xA9, 0xBB, 0xE8, 0x72, 0x17, 0x9D, 0x42, 0xD0, 0xC2, 0x04,
-    0xAF, 0xF2, 0x6F, 0x7C, 0xA7, 0x2B, 0x1A, 0x3C, 0x22, 0x66, 0x3C, 0xED, 0xE5, 0xEF, 0xC9, 0xA7,
-    0xB5, 0xFC, 0x91, 0xB8, 0x03, 0x35, 0x10, 0xD4, 0x49, 0xBC, 0xDC, 0xCF, 0xC5, 0xFC, 0x65, 0x61,
-    0x1A, 0x25, 0x11, 0x06, 0x11, 0x1E, 0xA0, 0x41, 0x44, 0xD9, 0x64, 0xE0, 0x43, 0xA6, 0x11, 0x4E,
-    0x7A, 0x1B, 0xB1, 0xE8, 0x6D, 0x84, 0x47, 0x1B, 0xE1, 0x67, 0x56, 0xAF, 0xED, 0x93, 0xD6, 0xAD,
-    0x69, 0x5A, 0x37, 0x4A, 0x7D, 0xDA, 0x6F, 0x4C, 0x3A, 0xDB, 0x34, 0x4A, 0x46, 0x8D, 0x52, 0x45,
-    0xAB, 0xDB, 0x08, 0x33, 0xE0, 0x78, 0xE8, 0x6A, 0xA8, 0x23, 0x08, 0xE3, 0xE3, 0xBC, 0x55, 0xD3,
-    0xF1, 0xD6, 0x8C, 0x1A, 0xA5, 0xF0, 0x75, 0x90, 0x8B, 0x50, 0xAC, 0x01, 0xCC, 0x49, 0x08, 0x7B,
-    0x1E, 0x24, 0xEB, 0x4E, 0x80, 0xCA, 0x69, 0x84, 0xB9, 0xA9, 0x04, 0x77, 0xB4, 0x0C, 0x23, 0x13,
-    0xCF, 0xB0, 0x73, 0xAC, 0x8B, 0xD5, 0x60, 0xAE, 0x12, 0xE2, 0x20, 0x00, 0x94, 0x9D, 0xF4, 0xE0,
-    0x23, 0xF8, 0x03, 0x47, 0x01, 0xA3, 0xA7, 0x3E, 0x7C, 0x04, 0x38, 0x0A, 0xA6, 0x2D, 0xF2, 0x6C,
-    0xE9, 0xBC, 0x71, 0xCB, 0xED, 0x3F, 0x81, 0xD9, 0xF9, 0xA2, 0xAF, 0xD7, 0xBC, 0x60, 0xEC, 0x7F,
-    0x3B, 0x50, 0xAE, 0xDE, 0x7F, 0xC3, 0x76, 0xA4, 0x15, 0xA4, 0xE4, 0xFA, 0x1A, 0xAF, 0xB3, 0xED,
-    0x38, 0x55, 0x9D, 0x8D, 0x23, 0x34, 0xF1, 0x46, 0x9C, 0x7A, 0xAC, 0x26, 0xDE, 0x39, 0x46, 0x13,
-    0x0F, 0xA2, 0xE0, 0x6E, 0xF4, 0x40, 0x06, 0xFE, 0xDE, 0x04, 0x15, 0x36, 0xE6, 0x27, 0x99, 0x0D,
-    0x34, 0xDF, 0x26, 0x5E, 0xDB, 0x8A, 0x94, 0x7B, 0xC3, 0x76, 0x8C, 0x2D, 0xD8, 0x70, 0xA6, 0x36,
-    0xD6, 0x37, 0xB0, 0x34, 0xE9, 0xF6, 0xFA, 0xB0, 0xAA, 0xEF, 0x03, 0x70, 0x72, 0x1A, 0xD3, 0x63,
-    0x54, 0xAD, 0x19, 0x73, 0x23, 0x62, 0x2E, 0x6D, 0x4C, 0x57, 0x76, 0xC6, 0x70, 0x7A, 0x9F, 0xFB,
-    0x53, 0x73, 0xC5, 0x35, 0xDE, 0x76, 0xAA, 0x38, 0x05, 0x0C, 0xCC, 0xF4, 0xFF, 0xBE, 0x62, 0x2E,
-    0x5C, 0x29, 0x05, 0xAE, 0x1A, 0x93, 0x93, 0x98, 0x5C, 0x44, 0x4C, 0x11, 0x87, 0x3C, 0x88, 0xF8,
-    0x6E, 0x98, 0x80, 0xD1, 0x28, 0x51, 0x41, 0x77, 0x29, 0xFA, 0x9A, 0xDC, 0xC4, 0x2C, 0xB3, 0x56,
-    0x7E, 0xFB, 0x1F, 0xF5, 0x66, 0x55, 0xC2, 0x55, 0x0D, 0x30, 0x31, 0x61, 0xEB, 0x53, 0x8A, 0xE3,
-    0x85, 0xE4, 0xA4, 0xB6, 0x35, 0xC4, 0x29, 0x44, 0xA2, 0x18, 0x73, 0xD6, 0x70, 0xDA, 0x2B, 0x79,
-    0xCB, 0x29, 0xE5, 0x2D, 0xF7, 0x6B, 0x79, 0x6B, 0xF4, 0x3B, 0xA8, 0x92, 0x86, 0xF9, 0x54, 0xD4,
-    0x0C, 0x2A, 0x7A, 0x33, 0x07, 0x18, 0x38, 0xB6, 0xCB, 0xB1, 0xAE, 0xAF, 0x2C, 0x26, 0x86, 0xD7,
-    0xAF, 0x78, 0x0D, 0xF8, 0xCD, 0xDA, 0x1D, 0xDD, 0xE9, 0x7C, 0xEE, 0x45, 0xC7, 0xEA, 0xDE, 0x36,
-    0x07, 0x4E, 0xCF, 0xC1, 0xE2, 0x8F, 0xE1, 0xE0, 0x12, 0x52, 0xCF, 0x29, 0x8B, 0x28, 0x10, 0x53,
-    0x78, 0x78, 0x43, 0x31, 0x8B, 0x8E, 0xD0, 0x7F, 0xFB, 0xBD, 0x0E, 0xDC, 0x34, 0x43, 0xF8, 0xBA,
-    0x16, 0xC9, 0xD7, 0x55, 0x29, 0x56, 0xD6, 0xA9, 0xD3, 0xE9, 0x34, 0x45, 0x46, 0xC7, 0xA6, 0x78,
-    0xA1, 0x68, 0x33, 0xDD, 0xC0, 0xDA, 0xEA, 0xE3, 0xB4, 0x77, 0x79, 0x8F, 0xB3, 0x65, 0xC7, 0xE8,
-    0x63, 0x88, 0xF8, 0xA6, 0x6A, 0xF7, 0x1F, 0xA3, 0xDA, 0x4F, 0x7F, 0x8D, 0x83, 0xFE, 0x83, 0x3D,
-    0xCB, 0x27, 0xC6, 0x81, 0x77, 0x6A, 0x6C, 0x79, 0x6E, 0xCB, 0xC2, 0xA9, 0xAB, 0xB2, 0x66, 0x19,
-    0x93, 0x35, 0xCB, 0x38, 0x23, 0x93, 0x83, 0xEF, 0xE9, 0x97, 0xF4, 0x07, 0xDF, 0xCE, 0xF9, 0x25,
-    0x16, 0xD6, 0x9F, 0xE3, 0x2A, 0x5F, 0x30, 0x5A, 0x28, 0x8F, 0x21, 0x5E, 0x63, 0xB0, 0x31, 0x43,
-    0x05, 0x7B, 0xDF, 0x4D, 0x8F, 0xD6, 0x55, 0xBD, 0xA6, 0x28, 0x8E, 0xD1, 0x84, 0x27, 0xC9, 0xD8,
-    0x39, 0xC9, 0xEB, 0x26, 0xF8, 0x77, 0xF1, 0xA4, 0x3F, 0x96, 0x60, 0xE8, 0x3D, 0x91, 0xC0, 0x7F,
-    0x90, 0x75, 0x5C, 0x3D, 0xC3, 0x5D, 0x74, 0x44, 0x8B, 0xF8, 0xC5, 0xA8, 0x08, 0x0A, 0xAF, 0xF0,
-    0xB3, 0x13, 0xEF, 0x22, 0xAD, 0xDF, 0xA6, 0xCB, 0xD8, 0x6D, 0x05, 0xF6, 0xE1, 0xB2, 0xA9, 0x0E,
-    0x9C, 0x72, 0xE5, 0x96, 0xBB, 0xC3, 0xFD, 0xF3, 0xB3, 0xB5, 0xEF, 0xE9, 0x97, 0x4E, 0xE6, 0x6B,
-    0xFC, 0xA5, 0x68, 0x37, 0xD1, 0x96, 0x38, 0xD0, 0xC2, 0x80, 0x07, 0x35, 0x2B, 0x2B, 0x98, 0x08,
-    0x22, 0x7F, 0xDD, 0xBA, 0x2D, 0x43, 0x39, 0xFC, 0x62, 0x7A, 0x47, 0x02, 0xB1, 0x45, 0x84, 0x38,
-    0xE7, 0xB1, 0xDC, 0xAE, 0x24, 0xD8, 0xC9, 0xDD, 0x06, 0xCE, 0x99, 0x0C, 0x28, 0x16, 0xF4, 0xBB,
-    0xEA, 0x18, 0x1F, 0xC9, 0xAD, 0xFC, 0xFC, 0xA4, 0x73, 0x10, 0xAC, 0xE6, 0xD2, 0x7C, 0x30, 0x37,
-    0x7F, 0xC3, 0xB4, 0x6A, 0xB1, 0xB4, 0x42, 0x3A, 0x42, 0x76, 0x32, 0x46, 0xDB, 0x08, 0xE6, 0x18,
-    0x71, 0x1A, 0xA1, 0xCB, 0x0A, 0x12, 0x25, 0x1A, 0x4A, 0xE6, 0xAB, 0xF6, 0x65, 0x4A, 0xA7, 0x14,
-    0xC3, 0x91, 0xB9, 0x8B, 0x98, 0xE1, 0x16, 0xF2, 0x03, 0xA3, 0x45, 0x20, 0x4E, 0x8A, 0xEC, 0x51,
-    0x16, 0xC9, 0x53, 0x9E, 0x58, 0x05, 0x5F, 0x3E, 0xD9, 0xE1, 0x53, 0xF2, 0x6C, 0xEA, 0x54, 0x33,
-    0x3A, 0x42, 0xFB, 0x8C, 0xBD, 0x6A, 0xAC, 0x6F, 0xA7, 0x22, 0xB7, 0x25, 0x14, 0x68, 0xB8, 0x60,
-    0x64, 0xBD, 0x80, 0x00, 0x30, 0x4B, 0x44, 0x35, 0x43, 0x3D, 0xA3, 0x96, 0xA2, 0xEE, 0xA4, 0xBA,
-    0x3F, 0x9E, 0xE2, 0xE5, 0xEC, 0x06, 0x02, 0xF7, 0xFE, 0x44, 0x64, 0x77, 0xB9, 0xBC, 0x95, 0x33,
-    0x24, 0x74, 0x04, 0xA2, 0xC2, 0x45, 0x48, 0x38, 0x12, 0x4F, 0x2A, 0x6F, 0x43, 0xC2, 0x30, 0x13,
-    0x15, 0x1A, 0xA5, 0x7E, 0xD1, 0x6A, 0xD4, 0x36, 0x24, 0x64, 0x4E, 0xE3, 0x00, 0x6C, 0x2D, 0x61,
-    0x06, 0xBB, 0xE0, 0xF9, 0xDC, 0x21, 0x72, 0x4C, 0x2E, 0x28, 0xEB, 0xAD, 0xE7, 0xD5, 0xB5, 0x5C,
-    0xD0, 0xA9, 0xC2, 0x33, 0x48, 0xE0, 0x77, 0x1A, 0x86, 0xA9, 0xA8, 0x57, 0x0D, 0xF3, 0x37, 0xAD,
-    0x13, 0x2A, 0x5E, 0xE8, 0xC5, 0x04, 0x5C, 0x46, 0xC6, 0x1A, 0x3E, 0x39, 0x1A, 0x64, 0x7C, 0x9E,
-    0xF5, 0xCE, 0xEC, 0x39, 0x16, 0xC4, 0xDB, 0xE6, 0x8E, 0x70, 0x84, 0x68, 0xE3, 0x55, 0x9A, 0x33,
-    0x1C, 0xA8, 0xA0, 0xEC, 0xEA, 0xBE, 0xA7, 0x8E, 0x34, 0xD5, 0x3B, 0x2B, 0xE9, 0x6D, 0x42, 0xAD,
-    0xF7, 0x3D, 0xBE, 0x63, 0xE2, 0xE0, 0x7E, 0x93, 0xEF, 0x06, 0xEF, 0x37, 0xE5, 0xE5, 0x70, 0xFE,
-    0x6F, 0x35, 0x1C, 0x50, 0x21, 0x0B, 0x7C, 0x19, 0xB1, 0x47, 0x9C, 0x88, 0xF7, 0x31, 0x81, 0xFB,
-    0x75, 0x00, 0x28, 0x97, 0x18, 0xA3, 0x56, 0xE2, 0x2D, 0x64, 0x64, 0xE1, 0xAF, 0x1A, 0xB0, 0x16,
-    0x80, 0xB5, 0x90, 0xAC, 0xA5, 0x8F, 0xDF, 0x09, 0xAF, 0xDB, 0x89, 0x19, 0x77, 0x62, 0x67, 0xB0,
-    0x13, 0xA1, 0xEE, 0x44, 0x86, 0x9D, 0xF0, 0xC5, 0xA1, 0x91, 0x9D, 0x28, 0x06, 0x3B, 0x81, 0x5D,
-    0x4B, 0x8D, 0xEE, 0xC4, 0x3E, 0x77, 0x62, 0x8F, 0x3B, 0x11, 0x73, 0x27, 0x22, 0xEE, 0x44, 0x30,
-    0xD8, 0x09, 0xCD, 0xBA, 0x2A, 0xE2, 0x7E, 0x9F, 0x7B, 0xBD, 0xA1, 0x9D, 0x70, 0xD4, 0x71, 0x9A,
-    0xBA, 0xB8, 0xD0, 0xED, 0xC9, 0xAE, 0xAF, 0x1B, 0xF2, 0xC7, 0xA6, 0xD5, 0xC6, 0x5B, 0xC9, 0xA2,
-    0x23, 0x2D, 0x2E, 0xF6, 0xC5, 0x95, 0x79, 0xC4, 0x9B, 0x43, 0x63, 0x1E, 0x59, 0x7A, 0x61, 0x7A,
-    0x97, 0x41, 0x6C, 0x49, 0xBA, 0x71, 0x86, 0xCD, 0x04, 0x4D, 0x6B, 0x1E, 0x53, 0x5C, 0xD1, 0xE1,
-    0x2D, 0x19, 0x77, 0x9E, 0x3A, 0x2B, 0x23, 0xEC, 0x21, 0x7F, 0x8C, 0x20, 0x31, 0xC1, 0x98, 0x51,
-    0x4A, 0x83, 0x93, 0x61, 0x37, 0xC4, 0x33, 0x4C, 0xAC, 0x7F, 0x28, 0x74, 0x42, 0x14, 0xC6, 0xA4,
-    0x07, 0x3C, 0x39, 0x07, 0xAC, 0x8B, 0x1D, 0x50, 0x65, 0x1E, 0xB0, 0x79, 0x68, 0x42, 0x0B, 0x10,
-    0x33, 0x79, 0x2D, 0x3B, 0x29, 0x02, 0x2D, 0x51, 0xB7, 0x6C, 0xA6, 0xBF, 0x7A, 0xB3, 0x61, 0xAE,
-    0x79, 0xD9, 0x66, 0xB6, 0x6C, 0xAE, 0xF9, 0xD2, 0xF4, 0x03, 0x19, 0x1B, 0xFE, 0x7D, 0xD8, 0x54,
-    0xEB, 0x5D, 0x47, 0x29, 0x02, 0x67, 0x71, 0x63, 0x9B, 0x9B, 0x35, 0xE4, 0xF1, 0x00, 0x4B, 0xB6,
-    0x58, 0x45, 0x49, 0xEB, 0xA7, 0x90, 0x8C, 0x2D, 0x19, 0xAB, 0xF1, 0x1A, 0x2B, 0x74, 0x22, 0x69,
-    0x71, 0x02, 0xF9, 0x7A, 0x20, 0xE7, 0x03, 0x65, 0x3B, 0xDB, 0xF7, 0xE9, 0xD8, 0xC4, 0xF5, 0xCB,
-    0x6C, 0x2E, 0x84, 0xE6, 0x08, 0xBF, 0x24, 0xA2, 0x64, 0xCB, 0xF9, 0x95, 0x79, 0x26, 0x70, 0x43,
-    0xDB, 0x10, 0x32, 0x51, 0x62, 0xD4, 0x2B, 0xEB, 0xD7, 0x6F, 0x14, 0xC1, 0x4E, 0x1B, 0x41, 0xF3,
-    0x02, 0x13, 0x96, 0x13, 0x9E, 0x8F, 0x1A, 0x2E, 0x8A, 0xBB, 0xD8, 0xA1, 0xE3, 0x02, 0xF9, 0xFB,
-    0x33, 0x27, 0x7F, 0x16, 0x70, 0x34, 0x97, 0xDE, 0x95, 0x33, 0x13, 0xFD, 0x48, 0xE0, 0xDB, 0xC3,
-    0xC4, 0x25, 0x72, 0xD8, 0xF9, 0x2E, 0x42, 0x9C, 0xE2, 0xA9, 0x82, 0x69, 0x31, 0x6A, 0x9A, 0x66,
-    0x05, 0x90, 0xF0, 0x12, 0x1D, 0xFE, 0x14, 0x0C, 0xCF, 0x53, 0x1C, 0x78, 0x67, 0xA9, 0xCE, 0xAE,
-    0x16, 0xC6, 0x65, 0x6E, 0x8F, 0x3D, 0xC6, 0xD4, 0x4E, 0x82, 0x15, 0x78, 0x8F, 0x13, 0x7D, 0x11,
-    0x80, 0xBE, 0x10, 0xB7, 0x94, 0x25, 0x78, 0xE0, 0x85, 0xEE, 0xA1, 0x03, 0xB5, 0x7C, 0xFD, 0xCB,
-    0x58, 0x5F, 0x66, 0xA6, 0xED, 0x6F, 0x6A, 0x95, 0x0D, 0xF5, 0x38, 0x6A, 0xDD, 0xD4, 0x3A, 0xFE,
-    0xEA, 0xE6, 0x6A, 0xFA, 0x21, 0xAB, 0x44, 0xC0, 0x2E, 0xD2, 0x74, 0xBC, 0x35, 0xB5, 0x3D, 0x36,
-    0x9E, 0x16, 0xD5, 0x23, 0xD6, 0xD5, 0xEB, 0xF9, 0xCD, 0x0A, 0x9D, 0x48, 0x95, 0xA9, 0x81, 0x91,
-    0x28, 0x7F, 0xA0, 0x94, 0x39, 0x15, 0x70, 0x42, 0x99, 0x5D, 0x26, 0x79, 0x6D, 0x5E, 0xC4, 0xDA,
-    0xD1, 0x44, 0x06, 0x1F, 0x10, 0x34, 0x2D, 0xB9, 0xCF, 0xD5, 0xB9, 0x6D, 0xC8, 0x92, 0xCB, 0x97,
-    0x84, 0xF0, 0x0B, 0x72, 0x9F, 0x3E, 0xB8, 0x92, 0x0A, 0x76, 0x02, 0x50, 0xEA, 0x34, 0x25, 0xFB,
-    0x15, 0xDA, 0x30, 0xDD, 0x5C, 0xBA, 0xDD, 0x3A, 0x70, 0x71, 0xE7, 0xC0, 0x2D, 0xD6, 0x1D, 0x38,
-    0x6E, 0xFE, 0x6D, 0x4C, 0xB8, 0x32, 0x6D, 0x5B, 0x42, 0x98, 0x0B, 0x08, 0x22, 0x28, 0xB3, 0x81,
-    0xAD, 0x1A, 0xC1, 0x56, 0x79, 0x05, 0x4A, 0x34, 0x48, 0x3D, 0xC5, 0xE9, 0xE8, 0x9B, 0xB7, 0x1A,
-    0x94, 0x07, 0x90, 0xF5, 0x95, 0x9D, 0xF3, 0xF3, 0x08, 0x58, 0xD3, 0x0F, 0xA6, 0x27, 0x2C, 0xEB,
-    0x0C, 0x13, 0x66, 0xE8, 0x46, 0xA5, 0xDD, 0x6B, 0x9B, 0xDD, 0x5A, 0x76, 0xB9, 0x07, 0x51, 0x74,
-    0x68, 0x2B, 0xF3, 0x6C, 0xBB, 0xE0, 0x4E, 0xEB, 0xB6, 0x58, 0xF3, 0x21, 0x8E, 0xC0, 0xBE, 0x18,
-    0xBC, 0xE5, 0xE1, 0x6D, 0xC3, 0xAE, 0x05, 0x6E, 0x39, 0xBF, 0x31, 0x2A, 0x1F, 0x9F, 0x85, 0x1C,
-    0x64, 0x70, 0xCF, 0x6A, 0x7D, 0x27, 0x4B, 0x54, 0xA8, 0xC4, 0xDC, 0x97, 0xE5, 0xF9, 0x9F, 0x08,
-    0x09, 0x3E, 0xFF, 0x50, 0xC8, 0xB2, 0xCD, 0x67, 0x85, 0x79, 0xB7, 0x87, 0x6B, 0x89, 0x25, 0xCD,
-    0x58, 0x1D, 0xD7, 0x39, 0xD2, 0x67, 0xAC, 0xFA, 0x9F, 0xBE, 0x14, 0xB9, 0xE1, 0x2A, 0x5E, 0x6E,
-    0xBB, 0x58, 0x7E, 0x6C, 0xCC, 0x3D, 0x40, 0xBA, 0xC3, 0xA0, 0x0E, 0x92, 0x14, 0x54, 0xEB, 0x6E,
-    0xD6, 0x19, 0xC2, 0x89, 0x2E, 0x16, 0x71, 0x59, 0x64, 0xD9, 0xA3, 0xDF, 0x20, 0xD6, 0xA5, 0xCA,
-    0x62, 0xFB, 0xDF, 0xC1, 0xDA, 0x32, 0x21, 0x36, 0x94, 0x1B, 0x0A, 0x8E, 0xD1, 0xC7, 0x8C, 0xCA,
-    0x0E, 0x85, 0x67, 0x90, 0x50, 0x3C, 0x41, 0xCD, 0x28, 0x1A, 0xBA, 0xC8, 0x8C, 0x88, 0xE2, 0x76,
-    0x4E, 0xC2, 0xAD, 0xDF, 0x5E, 0x33, 0x33, 0x0E, 0x9A, 0x18, 0x02, 0xF6, 0xF9, 0x1C, 0xCE, 0x53,
-    0x39, 0xBD, 0x4E, 0xA2, 0xDB, 0xD3, 0x67, 0x4D, 0xBB, 0xFF, 0xD5, 0x15, 0xC4, 0x74, 0x29, 0x97,
-    0x5A, 0x17, 0x86, 0xFE, 0x61, 0xDE, 0xA0, 0x6C, 0xDD, 0xCE, 0xFE, 0x71, 0x12, 0x79, 0xEF, 0x39,
-    0x00, 0x3E, 0xBE, 0x31, 0xCF, 0xA1, 0x1F, 0x25, 0x54, 0xA5, 0xDE, 0xBC, 0xA1, 0xA9, 0xD0, 0xBB,
-    0x7D, 0x03, 0x6E, 0x6C, 0xE3, 0xF8, 0x62, 0xB8, 0x7D, 0x89, 0x23, 0x16, 0x67, 0xF4, 0xF0, 0xAD,
-    0x0C, 0xC6, 0x05, 0xEB, 0x86, 0xC2, 0xC4, 0x19, 0x64, 0xD7, 0x31, 0xF0, 0x8A, 0x10, 0xF7, 0x2F,
-    0x6D, 0xEF, 0x73, 0xDF, 0xC0, 0x5B, 0xCA, 0x7B, 0xD8, 0xC1, 0x09, 0x9E, 0x79, 0xA3, 0x4F, 0xBB,
-    0x96, 0xEB, 0x69, 0xD7, 0x10, 0x0A, 0x66, 0x0D, 0x91, 0xB3, 0x05, 0xE4, 0x6D, 0x79, 0x6A, 0xA5,
-    0x5E, 0x21, 0xAE, 0x67, 0xA0, 0xE9, 0x7E, 0xD8, 0x73, 0xFF, 0x44, 0x01, 0x39, 0xCB, 0xD5, 0xFE,
-    0xAC, 0xCB, 0x2A, 0x4C, 0x3A, 0xA5, 0xE3, 0xB5, 0x12, 0x4D, 0x9F, 0xD8, 0xAB, 0x9E, 0xF4, 0xA2,
-    0x3F, 0x52, 0x4D, 0xE6, 0x56, 0x56, 0x2B, 0x5D, 0x53, 0x1D, 0x87, 0xE2, 0x6D, 0x54, 0xB0, 0x59,
-    0xD4, 0x69, 0x5B, 0xE3, 0xF6, 0xD7, 0x5B, 0xE3, 0x82, 0xFC, 0xDC, 0x1C, 0x99, 0x97, 0xC4, 0xF5,
-    0xBD, 0x86, 0x16, 0x84, 0xF7, 0x0A, 0x7A, 0x35, 0x40, 0x60, 0xD8, 0x7C, 0xFF, 0x04, 0x25, 0x04,
-    0x45, 0xFF, 0x1C, 0x2E, 0x03, 0xBA, 0xEA, 0x9A, 0x6C, 0x2B, 0x69, 0xB8, 0x78, 0x54, 0xD2, 0x30,
-    0x3A, 0xAE, 0xA8, 0xB3, 0x51, 0xB7, 0x38, 0x22, 0x40, 0xA2, 0x06, 0x60, 0x5F, 0x84, 0xC6, 0x71,
-    0xF5, 0x9A, 0xF1, 0x98, 0xF4, 0xB5, 0xA0, 0x17, 0x29, 0x42, 0x4C, 0x92, 0x5E, 0x69, 0xEA, 0x49,
-    0x53, 0x7F, 0xF7, 0x9B, 0x37, 0xB6, 0x33, 0xAB, 0xE1, 0x7A, 0x66, 0x95, 0xEE, 0x8B, 0xC0, 0x24,
-    0x4E, 0x1C, 0x8A, 0x99, 0x72, 0xF6, 0x65, 0x77, 0x61, 0x82, 0x98, 0x98, 0x15, 0xF7, 0x16, 0x7E,
-    0xEE, 0x4B, 0x08, 0x2F, 0x76, 0x90, 0x37, 0x09, 0xFF, 0x1E, 0x26, 0xBB, 0x0B, 0xD2, 0xDC, 0x72,
-    0xD3, 0xDF, 0x4B, 0xE6, 0x20, 0xEC, 0x8B, 0x38, 0x71, 0x1D, 0x69, 0xDC, 0xDD, 0x6A, 0x98, 0x3D,
-    0x0A, 0x88, 0x63, 0x61, 0xD6, 0xD4, 0xB9, 0x67, 0xF3, 0x82, 0xB2, 0xBA, 0x17, 0x45, 0x8E, 0xAF,
-    0xBF, 0xD3, 0xE5, 0x43, 0x05, 0x0D, 0x36, 0xB7, 0x0B, 0x1E, 0x5B, 0x39, 0xD6, 0x63, 0x73, 0xA1,
-    0xED, 0xEF, 0x6B, 0x10, 0x22, 0xAC, 0x59, 0x1D, 0xC5, 0xC7, 0x48, 0x81, 0xB7, 0xCD, 0xDE, 0x85,
-    0x7F, 0xFC, 0x0C, 0xCD, 0x3B, 0x6D, 0xFF, 0xE8, 0xC0, 0x17, 0xF8, 0x36, 0x52, 0x60, 0x3C, 0x04,
-    0x0F, 0x7D, 0xDE, 0xF7, 0xA2, 0x00, 0x2C, 0xBC, 0x98, 0x0B, 0xCB, 0x1B, 0x6B, 0x45, 0xF2, 0xBF,
-    0x3D, 0xBC, 0xC3, 0x86, 0x50, 0xBC, 0x1E, 0x55, 0x24, 0xE7, 0x6F, 0x2E, 0x56, 0x1C, 0xBC, 0x83,
-    0x9D, 0xCB, 0x1A, 0xF8, 0xFF, 0x09, 0xCF, 0x25, 0x54, 0x50, 0xB3, 0xC2, 0x50, 0x05, 0x8A, 0x8C,
-    0x4E, 0xE6, 0xA7, 0xEB, 0x61, 0x4F, 0xCD, 0x64, 0x19, 0xCB, 0xB2, 0x98, 0x2D, 0x4A, 0xC0, 0x61,
-    0xB4, 0x75, 0x0F, 0x63, 0x4C, 0x3A, 0x1B, 0x14, 0x64, 0xDB, 0xB2, 0xAC, 0xE0, 0x8C, 0xFB, 0x81,
-    0x09, 0x96, 0x16, 0x19, 0x5B, 0x01, 0xEE, 0xEA, 0xC0, 0xE3, 0x41, 0xAF, 0xD0, 0x98, 0x69, 0x0A,
-    0xDB, 0xEF, 0x9F, 0xC2, 0x0F, 0x08, 0xBF, 0x41, 0xAD, 0xD6, 0xE7, 0xF5, 0x43, 0x47, 0xAF, 0x0F,
-    0x38, 0x89, 0x4D, 0x21, 0xE1, 0xE8, 0xBB, 0x22, 0xE0, 0xCD, 0x57, 0x42, 0xBC, 0x06, 0xA7, 0xE1,
-    0x83, 0xF5, 0x9C, 0x9F, 0xAF, 0xD9, 0x8A, 0x96, 0x84, 0x29, 0xF2, 0x16, 0x89, 0x4C, 0x17, 0x75,
-    0x29, 0x8B, 0x58, 0x53, 0x16, 0x21, 0x53, 0x16, 0x9A, 0x43, 0x72, 0x40, 0x46, 0x70, 0x69, 0xBA,
-    0x7B, 0x75, 0xEF, 0x1E, 0xDA, 0x7B, 0x75, 0x3E, 0x2F, 0x13, 0x68, 0xF4, 0xF0, 0xCA, 0xF4, 0x36,
-    0x4F, 0x40, 0x41, 0x9A, 0x3F, 0x0B, 0xA8, 0x1D, 0x77, 0xA7, 0xF6, 0xD4, 0xB1, 0x7A, 0x09, 0xDE,
-    0xAA, 0xD9, 0x45, 0x51, 0xC8, 0xC4, 0xBF, 0xE4, 0xD5, 0x27, 0xDA, 0x01, 0xB6, 0x06, 0x3D, 0x03,
-    0xB8, 0xE1, 0x0A, 0x2E, 0x6F, 0xE0, 0xF2, 0x02, 0xAE, 0x06, 0xBE, 0x6B, 0xD7, 0x6F, 0x4F, 0x1D,
-    0x41, 0x1B, 0x15, 0x70, 0xD7, 0x82, 0x5F, 0x82, 0xAB, 0x17, 0x47, 0x29, 0x29, 0xF4, 0xE1, 0x55,
-    0x06, 0x89, 0x01, 0xFB, 0x2E, 0x9D, 0x7B, 0xCF, 0x04, 0xA6, 0xB6, 0x62, 0x08, 0x59, 0x38, 0x2C,
-    0xA1, 0x7E, 0x44, 0x13, 0x39, 0x39, 0xD4, 0xD1, 0xE2, 0x9D, 0xB6, 0xE3, 0xE1, 0x4A, 0xFA, 0x54,
-    0x21, 0xFE, 0xC9, 0xC5, 0xB4, 0x4F, 0x05, 0xC5, 0x74, 0xC8, 0xE8, 0x01, 0xF1, 0x06, 0xC3, 0x0F,
-    0xBD, 0x67, 0x43, 0x31, 0xBA, 0xB7, 0xC5, 0x85, 0x0E, 0xEE, 0xD7, 0x6D, 0x56, 0xC8, 0xB7, 0x59,
-    0x21, 0x37, 0xFD, 0xE1, 0x53, 0x04, 0xF3, 0xBC, 0x81, 0xA3, 0x51, 0x31, 0xEF, 0x9E, 0xE8, 0x8D,
-    0x6C, 0x5B, 0xD1, 0xDB, 0x35, 0xDD, 0xA5, 0x6C, 0xF5, 0x81, 0x4F, 0x1F, 0x9E, 0x13, 0x5F, 0xCA,
-    0xBE, 0x64, 0xFF, 0x33, 0xB2, 0xB6, 0x65, 0xAE, 0x61, 0x90, 0x5B, 0x56, 0xB6, 0x8E, 0xA4, 0xCC,
-    0x5F, 0xB5, 0x65, 0xAC, 0xCD, 0x4E, 0x25, 0x56, 0x06, 0x6C, 0x42, 0x6A, 0x62, 0x33, 0x52, 0xC8,
-    0xE6, 0x21, 0x25, 0xC5, 0xAB, 0xE3, 0x5F, 0x01, 0xDB, 0x1D, 0xE3, 0x7F, 0x8E, 0x50, 0x7E, 0xC7,
-    0x04, 0xEF, 0xA3, 0x05, 0x65, 0xC7, 0x84, 0x81, 0x5E, 0x3D, 0x8F, 0x03, 0x6D, 0x63, 0xDE, 0x0B,
-    0x12, 0x7A, 0x8D, 0xB5, 0xBE, 0x3A, 0x65, 0x90, 0x8A, 0xF3, 0x12, 0xA3, 0x6E, 0x84, 0x6B, 0x85,
-    0xA3, 0x3C, 0x78, 0xB7, 0xE4, 0x35, 0xFA, 0xE0, 0x5F, 0xB0, 0xAF, 0x41, 0x1A, 0xBC, 0x87, 0xCE,
-    0xCF, 0x48, 0x6F, 0x4D, 0x47, 0x32, 0xC1, 0xA7, 0x48, 0xF2, 0xEC, 0xCA, 0x44, 0x86, 0xAE, 0x37,
-    0x0A, 0x0D, 0xA8, 0xB9, 0xF8, 0xF5, 0xF0, 0x35, 0xC7, 0x35, 0x43, 0x6E, 0xA5, 0x67, 0xC3, 0xBD,
-    0xB7, 0x75, 0x2B, 0x56, 0x36, 0x49, 0xA7, 0x2D, 0x41, 0xFC, 0xE7, 0x0B, 0xCC, 0xDE, 0x88, 0x98,
-    0x14, 0xA6, 0xD8, 0x5C, 0xF7, 0x8E, 0x76, 0x7E, 0xC4, 0x8C, 0x1F, 0xB0, 0x4D, 0x0B, 0x26, 0x54,
-    0xAF, 0x95, 0xDC, 0x9E, 0x57, 0x4B, 0x17, 0xDB, 0xB2, 0x5F, 0x52, 0x92, 0xCA, 0xD2, 0xE7, 0xB5,
-    0xE9, 0x12, 0xEB, 0x1D, 0x15, 0x15, 0xBC, 0x64, 0x2F, 0xAB, 0x80, 0x5B, 0x90, 0xA2, 0x5B, 0x27,
-    0x0A, 0x51, 0x35, 0xC3, 0x1A, 0xEE, 0x41, 0x88, 0xAF, 0x9B, 0x5F, 0xA1, 0x43, 0xF7, 0x9E, 0xF9,
-    0xB5, 0x4C, 0x1B, 0x96, 0x66, 0x9E, 0x33, 0x3C, 0x42, 0x61, 0x2E, 0xCC, 0x79, 0xE9, 0xD3, 0x5E,
-    0x1C, 0x5F, 0xB5, 0x0C, 0x93, 0x5D, 0x32, 0xBB, 0x58, 0x63, 0x75, 0x1F, 0x07, 0x63, 0x66, 0xF3,
-    0xAC, 0xCB, 0x4E, 0x6E, 0x16, 0x5A, 0xE2, 0x0A, 0xD3, 0x30, 0x6D, 0xDB, 0x5A, 0xF0, 0xEF, 0x4D,
-    0xDC, 0x97, 0xC9, 0xBD, 0xDF, 0xC2, 0x8D, 0xFD, 0x32, 0xB7, 0x11, 0x94, 0x5E, 0xAF, 0x5D, 0x7E,
-    0xDB, 0x9E, 0x06, 0x7B, 0x6B, 0xBC, 0xED, 0xD0, 0xA7, 0x0D, 0x0E, 0x3E, 0x61, 0xBE, 0x8A, 0x49,
-    0xA8, 0x8F, 0x06, 0xF7, 0xC7, 0x15, 0xEF, 0xD4, 0xF6, 0x66, 0x44, 0xED, 0x8D, 0x4C, 0xA1, 0x88,
-    0xFE, 0x32, 0x44, 0x6A, 0x3C, 0x23, 0xAC, 0x55, 0x61, 0x26, 0xCC, 0x30, 0x2A, 0xA0, 0x3D, 0x47,
-    0xD4, 0x9E, 0xA3, 0xC5, 0xB8, 0xAB, 0x61, 0xBA, 0x5F, 0x83, 0x39, 0xE7, 0x77, 0x0C, 0x6F, 0x7E,
-    0xCF, 0xCD, 0x63, 0xB7, 0xAE, 0x86, 0x87, 0x66, 0x65, 0x3A, 0x4F, 0x58, 0x63, 0x39, 0xF5, 0x80,
-    0x59, 0xBC, 0xD3, 0xD2, 0xD5, 0xF7, 0xE6, 0x3C, 0xA8, 0x5C, 0x71, 0x5C, 0xD8, 0xBA, 0x2D, 0xBC,
-    0x77, 0xF0, 0x1D, 0xE3, 0xF1, 0x1F, 0xB8, 0x5B, 0x17, 0x25, 0xCE, 0x10, 0x66, 0xFE, 0x8B, 0x0A,
-    0xB6, 0x91, 0x40, 0xA3, 0xE7, 0x28, 0xE9, 0x12, 0x81, 0x5B, 0x62, 0x1B, 0x30, 0x7A, 0x52, 0x1A,
-    0x36, 0x9A, 0x16, 0x76, 0xB7, 0xEE, 0x4F, 0xC4, 0x69, 0x17, 0x36, 0x39, 0xC7, 0x7C, 0x38, 0xEF,
-    0x3F, 0x1C, 0x3D, 0xF2, 0xC3, 0x21, 0x63, 0x5F, 0x4C, 0xA7, 0xCC, 0x0F, 0x36, 0xA4, 0xAB, 0xFE,
-    0xBA, 0xC1, 0xAA, 0xED, 0xAF, 0xF6, 0xBA, 0x7F, 0xCE, 0xE2, 0x07, 0xEB, 0x35, 0x11, 0xB8, 0x91,
-    0x24, 0x7F, 0xFE, 0x66, 0x97, 0xAC, 0xE3, 0xAE, 0x31, 0xFC, 0xED, 0x3B, 0x11, 0xCA, 0x76, 0xB6,
-    0xEE, 0x7D, 0xA7, 0x4B, 0x70, 0xF7, 0xEF, 0xF3, 0x9E, 0xF0, 0x44, 0x35, 0xB6, 0x4D, 0x74, 0x6A,
-    0xBA, 0x70, 0x35, 0x68, 0x70, 0x33, 0xE7, 0x1D, 0xBB, 0x8B, 0x56, 0x66, 0xA3, 0xAC, 0xED, 0x1E,
-    0x59, 0xC3, 0x0B, 0xBF, 0x44, 0x0B, 0xE3, 0x68, 0xC9, 0xA8, 0x6F, 0x0E, 0x6B, 0xFF, 0x7D, 0x0B,
-    0x7D, 0xCB, 0xB1, 0xFD, 0x62, 0xED, 0x5B, 0xC0, 0x47, 0xE1, 0x79, 0x9E, 0xD7, 0xEE, 0x43, 0x82,
-    0xEB, 0x7F, 0xD2, 0x5F, 0xBB, 0x77, 0x1B, 0x73, 0xD4, 0x3F, 0xCF, 0x70, 0xDE, 0x30, 0x72, 0x13,
-    0x37, 0x31, 0xA3, 0x3C, 0x42, 0x9F, 0x58, 0xDD, 0x76, 0x38, 0x4C, 0xB2, 0xEE, 0x94, 0x3C, 0x0D,
-    0xF9, 0xBA, 0x00, 0x47, 0x65, 0x82, 0x84, 0x6B, 0x63, 0x91, 0xB7, 0xC7, 0xF8, 0x84, 0xE9, 0x8B,
-    0x47, 0xB6, 0xC1, 0xFE, 0x81, 0x4D, 0xB6, 0xC0, 0xFE, 0xFB, 0xAC, 0x62, 0x95, 0xAD, 0x73, 0xFC,
-    0xFF, 0xED, 0x5B, 0x3F, 0x8C, 0xE4, 0xE6, 0x75, 0xFF, 0x48, 0x4A, 0x4B, 0x78, 0x89, 0x88, 0x2A,
-    0x2C, 0xC4, 0xD1, 0x41, 0x62, 0x0A, 0x23, 0xB0, 0x0F, 0x96, 0xD8, 0xA4, 0x09, 0x70, 0xB7, 0xA4,
-    0xAD, 0xD2, 0x85, 0x54, 0xE8, 0x72, 0x85, 0x0A, 0xBB, 0x0B, 0x6C, 0x20, 0x59, 0x17, 0x2E, 0x52,
-    0xDC, 0xCE, 0xF0, 0xAC, 0xC2, 0x65, 0xB6, 0x89, 0xEB, 0x2B, 0x54, 0x9C, 0x47, 0x85, 0x5D, 0xB8,
-    0x30, 0x90, 0x99, 0x1D, 0xCA, 0x2E, 0x54, 0xB8, 0x10, 0x11, 0xC0, 0x55, 0x8A, 0xD0, 0xCE, 0x19,
-    0x06, 0x9C, 0xE2, 0x28, 0x64, 0x04, 0xF3, 0xCE, 0xE4, 0x30, 0xEF, 0xF7, 0x7B, 0x1F, 0xC9, 0xE1,
-    0xDC, 0x9E, 0xA0, 0x00, 0xD6, 0xDE, 0x2E, 0x90, 0xB9, 0x9B, 0xEF, 0xE3, 0xCE, 0x0C, 0xBF, 0xEF,
-    0xBD, 0xF7, 0xBD, 0xFF, 0xEF, 0xD1, 0x18, 0x79, 0x39, 0x6F, 0x61, 0x34, 0x41, 0x69, 0xCC, 0x7C,
-    0x9B, 0x86, 0x85, 0xF1, 0xBB, 0xAE, 0x8C, 0x72, 0x13, 0x3F, 0x3E, 0x6E, 0x12, 0x63, 0xD6, 0x99,
-    0xD3, 0x35, 0xC6, 0x69, 0xE5, 0xDB, 0xD2, 0x78, 0x1B, 0x63, 0x92, 0x94, 0xBF, 0x8D, 0x33, 0x13,
-    0xE6, 0xC6, 0xE0, 0x87, 0x99, 0xC1, 0xA5, 0x7C, 0xCE, 0xC9, 0x70, 0x9A, 0x1B, 0x7E, 0x37, 0xD3,
-    0xE9, 0xCC, 0xF0, 0x06, 0x4C, 0xF2, 0x33, 0x4C, 0xF2, 0x3D, 0xA6, 0x35, 0xAF, 0x8C, 0xAC, 0x2E,
-    0xF7, 0x79, 0x8D, 0x4C, 0xB9, 0x09, 0x2A, 0xB9, 0xA7, 0x34, 0x49, 0x21, 0x40, 0x6D, 0xFF, 0xBE,
-    0x93, 0xD5, 0xDD, 0xAE, 0x6B, 0x01, 0x63, 0xDC, 0x15, 0x84, 0xF5, 0x6D, 0x63, 0x5F, 0x87, 0x99,
-    0xD1, 0x0D, 0x74, 0x7D, 0xBF, 0xCB, 0x64, 0x99, 0x79, 0x57, 0xB5, 0xC6, 0xE9, 0x6E, 0x77, 0x1B,
-    0xE3, 0xD5, 0x66, 0x4D, 0x70, 0x93, 0x1E, 0xB6, 0x38, 0xC5, 0xB8, 0xFB, 0x7F, 0xD6, 0x8F, 0xFA,
-    0x7F, 0xC5, 0x11, 0x90, 0x18, 0xB7, 0x06, 0xB8, 0x3E, 0xC0, 0x79, 0x70, 0x0C, 0x68, 0xBA, 0x4E,
-    0x70, 0x74, 0xBA, 0x9A, 0x64, 0x33, 0xC3, 0x4B, 0xC1, 0x71, 0x1B, 0xDC, 0x15, 0xBE, 0xBB, 0xC1,
-    0x14, 0xFD, 0xB0, 0x72, 0xE4, 0x67, 0xF1, 0x9B, 0xB9, 0xBB, 0x01, 0xDC, 0xA9, 0x27, 0xAB, 0x24,
-    0xB5, 0xE1, 0x94, 0x1A, 0xBF, 0xE4, 0x2E, 0x98, 0x64, 0xBF, 0xA0, 0xE0, 0x86, 0x20, 0xE7, 0x38,
-    0x45, 0x99, 0xE1, 0x0A, 0xA9, 0xE1, 0x0A, 0x46, 0x6F, 0x1D, 0x26, 0xBB, 0x02, 0x6E, 0x9D, 0xE9,
-    0x3D, 0x33, 0x25, 0x44, 0xC2, 0x0D, 0x4C, 0x92, 0x99, 0x0E, 0xA4, 0xF9, 0xE4, 0x9D, 0xC6, 0x10,
-    0xF2, 0x0A, 0x30, 0x13, 0x81, 0xE1, 0xC8, 0xF1, 0xFA, 0x0E, 0x47, 0x52, 0xD7, 0x34, 0xCE, 0xC6,
-    0x04, 0xBF, 0xD8, 0xC8, 0x0E, 0xE1, 0xAF, 0x4A, 0x8C, 0x5D, 0x26, 0x63, 0x54, 0x63, 0xB3, 0x28,
-    0xC5, 0x5E, 0x71, 0x4F, 0x46, 0x1D, 0x05, 0x46, 0xEC, 0x9A, 0x02, 0x09, 0x01, 0x94, 0x44, 0x73,
-    0x38, 0x7A, 0x20, 0x9D, 0x09, 0xC0, 0x2E, 0x26, 0xC6, 0x78, 0xF7, 0x31, 0xC8, 0xD8, 0xFD, 0xB6,
-    0x02, 0x30, 0x6F, 0x08, 0xF0, 0x66, 0x84, 0xC1, 0x98, 0xBF, 0x92, 0x7F, 0xF6, 0x15, 0xA6, 0xCB,
-    0xFE, 0x32, 0xF8, 0x65, 0xD5, 0x5F, 0x7A, 0x5D, 0xDE, 0x5F, 0x3A, 0xDD, 0x78, 0x5F, 0x6B, 0x9E,
-    0xF6, 0x8A, 0xBB, 0xF7, 0x88, 0xB6, 0xFC, 0x38, 0x01, 0xD6, 0x61, 0x7F, 0x59, 0xDA, 0xCB, 0x19,
-    0x10, 0x33, 0x04, 0x77, 0x85, 0xB3, 0x33, 0x64, 0x6E, 0x41, 0x64, 0x0B, 0x20, 0x4A, 0x9E, 0x01,
-    0x58, 0x33, 0xCE, 0x2D, 0x37, 0xF0, 0x4F, 0x87, 0x78, 0xF1, 0x2E, 0x77, 0xA3, 0xE7, 0xB1, 0x19,
-    0xCE, 0x04, 0x77, 0xD9, 0x4B, 0xDC, 0x65, 0x2F, 0xB1, 0x08, 0x4E, 0x6B, 0xAE, 0xE0, 0xE2, 0xC4,
-    0xCE, 0x78, 0x97, 0x3D, 0x69, 0x08, 0x13, 0x2E, 0x05, 0x06, 0xDC, 0x05, 0xA2, 0xFA, 0x1B, 0xDE,
-    0x05, 0xCA, 0xCA, 0x9A, 0xCA, 0xFA, 0xA9, 0x99, 0xE7, 0x1E, 0x39, 0x2F, 0x31, 0x07, 0x9D, 0xDE,
-    0x65, 0x92, 0xC5, 0xBA, 0x36, 0xD1, 0x1F, 0x16, 0x0B, 0x70, 0xBD, 0x08, 0x47, 0x42, 0xD4, 0xD6,
-    0xDD, 0x03, 0x63, 0x2F, 0xF5, 0xE5, 0xA6, 0x6E, 0x66, 0xE9, 0x58, 0xCA, 0x9A, 0xA4, 0x8D, 0xD9,
-    0xAC, 0x2C, 0x69, 0xCC, 0x7A, 0x63, 0x29, 0x43, 0x99, 0x53, 0xC2, 0x40, 0xA8, 0x2D, 0x5D, 0xCC,
-    0x40, 0x16, 0x63, 0xA9, 0x92, 0x74, 0x5B, 0x4B, 0x94, 0xB9, 0x5C, 0x29, 0x4D, 0x5E, 0xBA, 0xD5,
-    0xF6, 0x24, 0x71, 0xEB, 0x1E, 0x77, 0x11, 0x65, 0x7B, 0x25, 0xAC, 0x69, 0xAF, 0x92, 0x5D, 0x72,
-    0x8C, 0xD4, 0x18, 0x89, 0xA1, 0xB4, 0x00, 0x2F, 0x2B, 0x29, 0x92, 0x81, 0x12, 0xCD, 0x40, 0x88,
-    0xCD, 0x84, 0x0E, 0x4A, 0x06, 0x10, 0xAF, 0xA7, 0x42, 0x3E, 0x10, 0x21, 0xB3, 0x22, 0x7A, 0x6A,
-    0xEE, 0xE1, 0xA2, 0x36, 0xB5, 0x0F, 0x25, 0x22, 0x40, 0xDF, 0x8C, 0x21, 0x0C, 0x02, 0x73, 0x4C,
-    0x0A, 0x83, 0xE1, 0x37, 0xF6, 0xC2, 0x2F, 0x95, 0x58, 0x96, 0x7E, 0xBE, 0xAA, 0x9D, 0x60, 0x1B,
-    0xE4, 0x21, 0x56, 0x4C, 0xBA, 0x8F, 0xF4, 0xA2, 0xBB, 0xFD, 0x30, 0x7F, 0xFE, 0xD6, 0x3C, 0x95,
-    0x83, 0xC1, 0x46, 0x67, 0x40, 0x78, 0x9E, 0x82, 0x3D, 0x54, 0x40, 0x44, 0x77, 0x08, 0x0E, 0x49,
-    0xAF, 0x1F, 0x55, 0x36, 0x55, 0xDB, 0x9C, 0x91, 0x12, 0x2B, 0x2A, 0x19, 0x2A, 0x1C, 0xE8, 0x99,
-    0x99, 0xBD, 0x55, 0x2E, 0x64, 0x49, 0xC8, 0xF1, 0x0C, 0x42, 0xD4, 0x1A, 0x95, 0x23, 0xFC, 0xD6,
-    0x24, 0x1F, 0x3C, 0xAE, 0xF0, 0x5B, 0x4A, 0x53, 0x08, 0xC1, 0xF6, 0x45, 0xA0, 0x42, 0x9E, 0xDF,
-    0x8B, 0x03, 0xFB, 0xEB, 0x3B, 0x31, 0x3D, 0xC9, 0xED, 0xAE, 0x56, 0xC3, 0xE1, 0xBD, 0xD4, 0xD3,
-    0x6C, 0x76, 0x27, 0x1C, 0xA5, 0xBC, 0x71, 0x8E, 0xF2, 0xC6, 0x81, 0x79, 0xD5, 0x30, 0x95, 0xA4,
-    0x08, 0x48, 0x23, 0x6F, 0x1C, 0x9C, 0xBC, 0x01, 0xAB, 0xBC, 0xED, 0x24, 0xB8, 0xE2, 0x2D, 0x87,
-    0x85, 0x63, 0x8A, 0xD3, 0x5E, 0xDD, 0x12, 0x86, 0xC5, 0x42, 0x95, 0x73, 0x97, 0xCF, 0xC0, 0xA2,
-    0x5D, 0xB6, 0x1A, 0x38, 0x6A, 0x9C, 0x94, 0xC3, 0x9F, 0x3F, 0xA6, 0xE0, 0x87, 0x2A, 0xF4, 0xA1,
-    0xB2, 0x9E, 0x93, 0xF6, 0xC8, 0x7D, 0x89, 0xE8, 0xCD, 0xB9, 0xF2, 0x9A, 0xE3, 0x09, 0x71, 0x53,
-    0xD4, 0x14, 0x33, 0x2E, 0xE8, 0x50, 0x17, 0xBB, 0x1B, 0xA0, 0xE5, 0x55, 0x2E, 0x25, 0x15, 0xD8,
-    0xF8, 0x25, 0xC7, 0x02, 0x28, 0x05, 0xB9, 0x4F, 0x9E, 0x03, 0x42, 0x61, 0x4E, 0x93, 0x96, 0x61,
-    0x8C, 0x53, 0x60, 0x13, 0x13, 0x99, 0x84, 0xB8, 0x1C, 0x71, 0xAB, 0x19, 0x31, 0x59, 0x11, 0x91,
-    0x86, 0x78, 0x28, 0xE4, 0x6A, 0x14, 0xC8, 0x40, 0x6E, 0x65, 0xD9, 0xC8, 0x4A, 0xBE, 0x71, 0x8F,
-    0x81, 0x88, 0x4F, 0x5E, 0xF4, 0xDA, 0x1E, 0x97, 0x30, 0x97, 0x89, 0x1B, 0xCB, 0x8E, 0xA2, 0x5B,
-    0xD3, 0x20, 0x27, 0x62, 0xDC, 0x46, 0x87, 0x19, 0x3E, 0x58, 0xE1, 0xBA, 0x91, 0xED, 0x65, 0x98,
-    0x61, 0xA3, 0x95, 0x22, 0xE6, 0x62, 0x90, 0x5D, 0x20, 0x6D, 0xF2, 0x81, 0x5F, 0xCA, 0xBE, 0x41,
-    0x21, 0x1F, 0x04, 0x39, 0x78, 0x19, 0x78, 0xD9, 0xD5, 0xB1, 0x70, 0x4A, 0x8E, 0xE4, 0x00, 0xC4,
-    0x88, 0xD1, 0x64, 0x27, 0xAB, 0x4E, 0xFF, 0x01, 0xE8, 0xAC, 0x01, 0xFB, 0x3C, 0x53, 0xAB, 0x2A,
-    0x1B, 0x1C, 0xC1, 0x2E, 0xCB, 0x1E, 0x33, 0x68, 0x08, 0xD9, 0xF7, 0xC4, 0xCC, 0xC9, 0x17, 0x2B,
-    0xFC, 0x52, 0xE6, 0xC6, 0xB4, 0x35, 0x98, 0xA3, 0x31, 0xB5, 0x30, 0x72, 0x21, 0xF4, 0xAE, 0x97,
-    0x02, 0x86, 0x50, 0x7E, 0x33, 0x93, 0x3D, 0x85, 0xF6, 0x55, 0xC2, 0xD9, 0xAB, 0x40, 0x57, 0xCC,
-    0x61, 0x16, 0xA7, 0x72, 0x0E, 0x65, 0x98, 0xC7, 0x02, 0xB5, 0x2F, 0xFF, 0xF0, 0x0B, 0x80, 0x7E,
-    0xC4, 0x73, 0x70, 0xAB, 0x19, 0xE8, 0x92, 0x39, 0xF5, 0x4A, 0x66, 0x01, 0xB9, 0x59, 0x0A, 0xCC,
-    0x02, 0xF5, 0xAA, 0xC1, 0x79, 0xC8, 0x71, 0x88, 0x80, 0x90, 0xB1, 0x00, 0x96, 0x10, 0x27, 0x02,
-    0x38, 0x27, 0x42, 0xD6, 0x4A, 0x18, 0x60, 0x49, 0xDD, 0x63, 0x59, 0xAB, 0x9F, 0x29, 0x3E, 0x86,
-    0x52, 0x89, 0xD7, 0x4B, 0xC7, 0xA5, 0x35, 0x15, 0xAA, 0x23, 0x62, 0x6B, 0x4D, 0x46, 0x46, 0x33,
-    0x5F, 0xB4, 0xF8, 0xAF, 0x2C, 0xFE, 0xAD, 0xC5, 0x7F, 0x69, 0xF1, 0x37, 0x16, 0x7F, 0x63, 0xF1,
-    0x37, 0x8A, 0xBF, 0x1C, 0x04, 0xF1, 0xC7, 0xB9, 0x10, 0xFF, 0x52, 0xF1, 0x17, 0x8E, 0x23, 0xFE,
-    0x38, 0x25, 0xE0, 0x8F, 0x6F, 0x80, 0x3F, 0xBE, 0x01, 0xFE, 0x38, 0x29, 0xE0, 0x1F, 0xA5, 0x8A,
-    0xBF, 0x7C, 0x43, 0xFC, 0x79, 0x64, 0x82, 0x3F, 0xF9, 0x70, 0xD5, 0x28, 0x5B, 0x1C, 0xD5, 0xCA,
-    0x19, 0x09, 0xC0, 0x51, 0xFC, 0x1B, 0x8B, 0x7F, 0xAD, 0xF8, 0x3B, 0x16, 0x5F, 0x77, 0x63, 0x95,
-    0x7F, 0x35, 0x9D, 0x7D, 0xAB, 0xDF, 0x42, 0x55, 0x6F, 0x07, 0x73, 0xB5, 0xB1, 0x81, 0xB5, 0x1B,
-    0x7E, 0xDD, 0x93, 0xE1, 0x79, 0x3B, 0x27, 0x7B, 0xF3, 0xD1, 0x79, 0x96, 0x57, 0xED, 0xFA, 0x1D,
-    0x48, 0xAD, 0x2C, 0xB0, 0x9C, 0x77, 0x39, 0xE0, 0x68, 0xDB, 0xE3, 0x02, 0xD2, 0xD1, 0x15, 0x21,
-    0xC8, 0xE3, 0x40, 0x73, 0x0B, 0x1C, 0x6E, 0xAB, 0x2C, 0x2B, 0xAE, 0x5F, 0x58, 0xF8, 0x74, 0x30,
-    0xC9, 0xB3, 0xF0, 0x3B, 0x84, 0x19, 0x70, 0x54, 0x31, 0xC4, 0x51, 0xD4, 0xBC, 0x90, 0x2B, 0x03,
-    0xA8, 0x24, 0x06, 0xF9, 0x38, 0x4E, 0xD5, 0xD3, 0x54, 0x4F, 0xE4, 0xCC, 0xBA, 0x77, 0x2D, 0xC0,
-    0x4A, 0x52, 0x25, 0x06, 0x25, 0x67, 0x39, 0x65, 0x83, 0x7E, 0x7E, 0x0A, 0x79, 0x5C, 0xCB, 0x16,
-    0xBD, 0xCB, 0xE1, 0x6E, 0x77, 0x6C, 0x28, 0xED, 0xA7, 0x70, 0x02, 0x15, 0xCD, 0x9A, 0x37, 0x26,
-    0x85, 0xE9, 0xC5, 0x69, 0xF2, 0x52, 0x22, 0xAD, 0xF9, 0x39, 0xDD, 0x2E, 0x8F, 0x7C, 0xE6, 0xFF,
-    0x27, 0xC6, 0xF0, 0x23, 0x9A, 0xFA, 0x7F, 0xC1, 0x98, 0x04, 0x18, 0x67, 0x1C, 0x1B, 0xA8, 0x21,
-    0x77, 0x03, 0x83, 0xE3, 0x55, 0x38, 0x9F, 0x80, 0x4A, 0x0A, 0xA2, 0x03, 0x46, 0x85, 0x17, 0x37,
-    0xE7, 0xB8, 0x5D, 0xBC, 0x5F, 0xC1, 0x58, 0xA8, 0x9A, 0x76, 0x21, 0xFE, 0x40, 0x48, 0xE8, 0x21,
-    0x23, 0x98, 0xB6, 0x21, 0x00, 0x0D, 0xBD, 0xEC, 0x86, 0xE0, 0xA7, 0xC6, 0x2B, 0x04, 0x4C, 0xA7,
-    0x02, 0x3D, 0xE8, 0x0F, 0xF2, 0xC0, 0xA7, 0x90, 0x07, 0x5B, 0x4F, 0x48, 0xDB, 0x7D, 0x98, 0xD3,
-    0xB6, 0xD1, 0xAE, 0xD1, 0xA6, 0xF5, 0x8A, 0x23, 0x51, 0x0B, 0x46, 0x6B, 0x42, 0xFB, 0x35, 0x53,
-    0xB5, 0xE4, 0x34, 0x6A, 0xB3, 0x68, 0xAF, 0xE8, 0xF3, 0x25, 0x1F, 0x6C, 0x2B, 0xF5, 0xF8, 0xFC,
-    0xEE, 0x1B, 0xBD, 0x6D, 0xFA, 0x82, 0x39, 0x14, 0x6C, 0x32, 0x39, 0x19, 0xEF, 0xDF, 0x61, 0x64,
-    0xE8, 0xD0, 0x93, 0x3A, 0x67, 0x7B, 0xEE, 0x5B, 0x01, 0xEB, 0x0D, 0x62, 0x3C, 0xEA, 0x8F, 0x88,
-    0xE7, 0xC3, 0x81, 0x8C, 0x4B, 0xA3, 0x4C, 0xA2, 0x85, 0xC3, 0x70, 0x9E, 0x66, 0x1B, 0xD5, 0xDB,
-    0x6A, 0x38, 0xFC, 0xA6, 0xD7, 0xD8, 0x54, 0x09, 0x73, 0x1C, 0xCC, 0x1A, 0xC7, 0x7D, 0x90, 0x1E,
-    0xA4, 0x42, 0x24, 0xD1, 0xE0, 0x8D, 0x92, 0x68, 0x9E, 0x8F, 0xDC, 0x6E, 0x68, 0x68, 0x74, 0x19,
-    0x6B, 0x35, 0x8D, 0xDA, 0x4B, 0xE3, 0x5A, 0x27, 0x50, 0x8D, 0x8B, 0xC2, 0xA6, 0x06, 0x45, 0xDF,
-    0x34, 0x25, 0xA9, 0x9A, 0xE5, 0x64, 0xC7, 0xE3, 0x55, 0x67, 0x57, 0xFD, 0x5C, 0xE5, 0x37, 0xEB,
-    0xDD, 0x36, 0xFB, 0xDC, 0x24, 0xA1, 0x99, 0x61, 0x64, 0x66, 0x18, 0x98, 0x31, 0x2E, 0xDB, 0x6A,
-    0x58, 0x66, 0xA3, 0x32, 0x0D, 0xCA, 0x34, 0x26, 0xD3, 0x90, 0x4C, 0x23, 0x32, 0x0D, 0xC8, 0x34,
-    0x1E, 0xD3, 0x70, 0x4C, 0xA3, 0x31, 0x0D, 0xC6, 0x34, 0x16, 0xD3, 0x50, 0x4C, 0x23, 0x31, 0x0D,
-    0xC4, 0x34, 0x0E, 0xD3, 0x30, 0x4C, 0xA3, 0x30, 0x1B, 0x84, 0xD9, 0x18, 0xEC, 0x6D, 0x3D, 0xCD,
-    0x03, 0x81, 0x3E, 0x93, 0x55, 0xBD, 0xDF, 0x80, 0x12, 0x80, 0x8E, 0x8E, 0x90, 0x35, 0xC7, 0xFD,
-    0x8B, 0x96, 0x4F, 0xC2, 0x32, 0x44, 0x65, 0x0D, 0xB8, 0xE4, 0x4C, 0x63, 0xB2, 0x5E, 0x8A, 0x55,
-    0x8F, 0xEB, 0x30, 0xB3, 0xC3, 0x4C, 0x5D, 0x95, 0x99, 0x72, 0xB2, 0x5B, 0x6B, 0x24, 0xC6, 0x40,
-    0x8C, 0x71, 0x98, 0x86, 0x61, 0x1A, 0x85, 0x7D, 0xD9, 0x7C, 0x45, 0xC6, 0x9B, 0xB4, 0xBE, 0xD1,
-    0x37, 0xC9, 0x17, 0x2A, 0x71, 0xED, 0xAE, 0x7C, 0x0F, 0x2F, 0x04, 0x59, 0x99, 0xC6, 0x58, 0x1A,
-    0x62, 0x69, 0x84, 0xA5, 0xFE, 0xA9, 0x8E, 0x1A, 0x5E, 0x69, 0x7C, 0xA6, 0xE1, 0x99, 0xFA, 0xA7,
-    0x18, 0x6B, 0x1B, 0x9B, 0x69, 0x68, 0xA6, 0x91, 0x59, 0xD2, 0x8F, 0x72, 0x8B, 0x86, 0x65, 0x1A,
-    0x95, 0x69, 0x50, 0x66, 0xFD, 0x3E, 0x86, 0x64, 0x1A, 0x91, 0x69, 0x40, 0x66, 0xE3, 0x31, 0x35,
-    0x38, 0x54, 0x30, 0xAA, 0x5F, 0xA8, 0x5E, 0xA8, 0x5D, 0xA8, 0x5C, 0xE2, 0x6C, 0x07, 0x78, 0xC4,
-    0x68, 0x6A, 0xDF, 0xFB, 0x21, 0xCA, 0x18, 0x9F, 0x31, 0x3C, 0x9B, 0x18, 0xF9, 0x99, 0x86, 0x66,
-    0x8C, 0xCC, 0x18, 0x98, 0x31, 0x2E, 0x4B, 0x46, 0x09, 0x45, 0x50, 0x46, 0x09, 0xD5, 0x90, 0x4C,
-    0x35, 0x77, 0x48, 0xC2, 0x46, 0x1C, 0x5F, 0x5E, 0xBC, 0xB7, 0x47, 0xBB, 0x23, 0x5A, 0xB9, 0x19,
-    0x25, 0xF0, 0xA6, 0x57, 0x5C, 0x05, 0xC2, 0x1A, 0x84, 0x03, 0x3A, 0x2C, 0x16, 0xBD, 0xB2, 0x4B,
-    0x9F, 0xC3, 0xC2, 0x49, 0x3F, 0x14, 0x37, 0x2F, 0x92, 0xC4, 0x1A, 0xFE, 0x59, 0xBB, 0xAB, 0xFA,
-    0xF7, 0x84, 0x9F, 0x57, 0xE7, 0x13, 0xFA, 0x86, 0x97, 0x5F, 0x09, 0x42, 0x5B, 0xC3, 0x87, 0x3F,
-    0xB6, 0xBD, 0xE0, 0x51, 0x4D, 0x87, 0x03, 0xC9, 0xCB, 0xA3, 0x67, 0x44, 0x72, 0xBE, 0x22, 0xBA,
-    0x2C, 0xC1, 0x07, 0xE0, 0x6D, 0xEF, 0xBF, 0x01, 0x99, 0xAB, 0x19, 0x91, 0xAD, 0x39, 0x97, 0xCF,
-    0x13, 0x9A, 0x9B, 0xAB, 0xC2, 0xE7, 0xCA, 0x42, 0x00, 0x7C, 0x09, 0x83, 0x73, 0x04, 0xAD, 0xCE,
-    0x24, 0x47, 0xD8, 0x07, 0xB2, 0x7B, 0x6C, 0xEF, 0x16, 0xAF, 0x5D, 0xA8, 0x66, 0x21, 0x17, 0x07,
-    0xC5, 0x8E, 0xB3, 0xA5, 0xAA, 0xF9, 0xC6, 0xD5, 0xD6, 0x2F, 0xA3, 0xC5, 0x3E, 0xE9, 0x63, 0x6F,
-    0xC0, 0x29, 0x2B, 0xE7, 0xCF, 0x5C, 0xD3, 0xC0, 0x73, 0x10, 0xD7, 0xA2, 0xCB, 0xBD, 0xDF, 0x7D,
-    0xAB, 0x72, 0xA8, 0x78, 0xE8, 0xF7, 0x5A, 0x07, 0x46, 0xD6, 0xB9, 0xD6, 0xD5, 0x82, 0x4E, 0x1D,
-    0x6C, 0x6F, 0x6F, 0xA2, 0x02, 0x30, 0xFA, 0xE5, 0x11, 0xDD, 0x86, 0x24, 0x4D, 0xEE, 0x6E, 0x69,
-    0x08, 0x7C, 0xD8, 0xFC, 0x2F, 0x8E, 0xBA, 0xD4, 0x8E, 0xA3, 0x36, 0xED, 0xB3, 0x74, 0x90, 0x6E,
-    0xC5, 0x73, 0x0F, 0xD1, 0x4B, 0xE8, 0x11, 0x1B, 0x24, 0x70, 0x1C, 0x0E, 0xC8, 0x9F, 0xED, 0xC8,
-    0x07, 0xB0, 0xF0, 0x4B, 0x78, 0x35, 0xF9, 0x8D, 0x0B, 0xF4, 0x8D, 0x15, 0x22, 0x05, 0x09, 0x30,
-    0x8D, 0xC4, 0x0D, 0xD2, 0x31, 0xCD, 0xAD, 0x63, 0x60, 0x2E, 0x37, 0x71, 0x1D, 0x4B, 0xDC, 0x74,
-    0x97, 0xB8, 0x44, 0x83, 0x39, 0x4E, 0x7A, 0x34, 0x87, 0xE6, 0x42, 0x89, 0x6B, 0x0E, 0xAD, 0x33,
-    0xA3, 0xAE, 0x0D, 0xE6, 0xCD, 0x79, 0xF1, 0xAB, 0xF8, 0xB9, 0xFC, 0x41, 0x60, 0x67, 0xA4, 0x8B,
-    0xE9, 0x8A, 0xBD, 0xA9, 0x46, 0x78, 0xA6, 0x6A, 0xCC, 0x34, 0x0C, 0x36, 0x84, 0x16, 0x6A, 0xC0,
-    0xFD, 0x2A, 0xB1, 0x4A, 0x4E, 0xE7, 0x38, 0x53, 0x1F, 0x78, 0x6E, 0xD6, 0xA4, 0x40, 0x8B, 0x5C,
-    0x11, 0x03, 0x8E, 0x0E, 0xD9, 0x53, 0xCF, 0x66, 0x27, 0x42, 0xDD, 0x44, 0x80, 0x51, 0x68, 0x92,
-    0xC5, 0xFB, 0x1B, 0x35, 0x48, 0xD4, 0x90, 0x4E, 0x63, 0xC3, 0x9E, 0x8D, 0x06, 0x3D, 0x81, 0x66,
-    0xDE, 0xC0, 0x05, 0xE1, 0x1F, 0x16, 0xF7, 0x40, 0x13, 0xA6, 0x00, 0xD7, 0x46, 0x67, 0xD9, 0x60,
-    0xF1, 0x63, 0x75, 0xB9, 0xB7, 0x3A, 0x3D, 0x99, 0x22, 0x0F, 0xDA, 0x20, 0xD8, 0xE2, 0x60, 0xDF,
-    0x94, 0xD8, 0x1C, 0xD4, 0x6E, 0xBF, 0x55, 0x78, 0xA2, 0x03, 0x4A, 0xBF, 0x14, 0x8A, 0x77, 0xA2,
-    0x80, 0x04, 0x43, 0x89, 0xCF, 0x0B, 0x41, 0xB0, 0x95, 0x9D, 0x10, 0x4B, 0x1F, 0x74, 0x20, 0x7A,
-    0xD7, 0x51, 0xF7, 0x74, 0xDD, 0xA9, 0x90, 0x9B, 0x81, 0xD9, 0x4C, 0x5D, 0x19, 0x21, 0x7E, 0xCD,
-    0x29, 0x6A, 0xC8, 0x8A, 0x73, 0x66, 0x2C, 0x7F, 0xF0, 0xC7, 0x2E, 0xFB, 0x47, 0xC1, 0xEC, 0xC3,
-    0x87, 0x02, 0x85, 0xBF, 0xF5, 0x7F, 0x08, 0x14, 0xDF, 0xEA, 0x35, 0x89, 0x8D, 0xF3, 0x1E, 0x28,
-    0xC5, 0x05, 0xA5, 0xED, 0x02, 0x50, 0x15, 0xE6, 0x4B, 0x86, 0xA5, 0x0B, 0x96, 0x83, 0xFA, 0x64,
-    0x8D, 0xBA, 0x4A, 0xB6, 0xD0, 0x93, 0x8E, 0xFC, 0x2E, 0xD0, 0xC8, 0xA9, 0x4A, 0x08, 0xD4, 0x21,
-    0xA8, 0xF0, 0x64, 0x83, 0x33, 0xD2, 0xB6, 0x1F, 0x0F, 0xDE, 0x7F, 0x24, 0xDF, 0x86, 0x42, 0x0C,
-    0xD1, 0xA4, 0x02, 0x45, 0xC2, 0x5C, 0x65, 0x84, 0xCC, 0x98, 0x70, 0xDC, 0xAD, 0x35, 0xC3, 0x1A,
-    0x88, 0x4B, 0xDC, 0x3D, 0x9A, 0x54, 0x96, 0xE4, 0xF3, 0x0C, 0x5C, 0xF4, 0xB1, 0xF0, 0xE0, 0xAF,
-    0xFF, 0xAD, 0x92, 0xF3, 0x48, 0x4A, 0x64, 0xA5, 0x8B, 0x69, 0x6A, 0x2D, 0x67, 0xD6, 0x33, 0x44,
-    0x7E, 0x2D, 0xB2, 0x8C, 0xBA, 0xC6, 0xB0, 0x85, 0x0C, 0xB5, 0x02, 0x76, 0xD8, 0x9A, 0xE0, 0xD1,
-    0x6A, 0x09, 0xD0, 0x18, 0xB4, 0xD5, 0x36, 0x4B, 0xF8, 0xFC, 0xED, 0x47, 0x3C, 0x32, 0x9E, 0xBC,
-    0xF9, 0x6B, 0x1A, 0x9B, 0x1F, 0x09, 0x20, 0x09, 0x0E, 0xEC, 0x50, 0x63, 0x2C, 0x06, 0xCB, 0x12,
-    0x23, 0xC2, 0xAA, 0xF8, 0x08, 0x97, 0x6D, 0xBC, 0xAC, 0xF2, 0x6D, 0x93, 0x9D, 0xE6, 0xE2, 0x88,
-    0x89, 0x71, 0x4E, 0x4B, 0x99, 0xD0, 0x52, 0x7E, 0x26, 0x62, 0x3A, 0xA7, 0xCE, 0xA9, 0xD8, 0x79,
-    0xA8, 0x9B, 0x25, 0x53, 0xC1, 0x00, 0x24, 0xAA, 0xC6, 0xB4, 0xD3, 0x13, 0xF4, 0x4E, 0x9E, 0x42,
-    0xEF, 0x70, 0x8F, 0xDE, 0x99, 0xD2, 0x7B, 0xAE, 0xF4, 0x8E, 0x32, 0xB7, 0xC5, 0xA1, 0xC8, 0xB0,
-    0x99, 0x2D, 0x85, 0xF1, 0xEB, 0x46, 0x38, 0xB5, 0x10, 0x7A, 0x3F, 0xC7, 0xB8, 0xD0, 0x1D, 0xB2,
-    0x07, 0x22, 0x43, 0x4F, 0xD0, 0xFB, 0x54, 0xC3, 0xC8, 0x2F, 0xC3, 0xEB, 0x70, 0x35, 0x8C, 0x64,
-    0x52, 0x41, 0x69, 0x77, 0x7E, 0x18, 0x19, 0xF7, 0xB9, 0x75, 0x56, 0x2F, 0x21, 0x07, 0x33, 0xE2,
-    0xB4, 0xA2, 0x07, 0xBC, 0x64, 0x36, 0xB5, 0xA1, 0x78, 0x34, 0xF8, 0xD8, 0xA9, 0x13, 0x94, 0x32,
-    0x37, 0x90, 0x4B, 0xEF, 0x8F, 0xF4, 0x40, 0x3B, 0x1D, 0x1B, 0x26, 0xDB, 0x66, 0xF4, 0x8D, 0x34,
-    0x5A, 0x8F, 0x19, 0xB9, 0x6B, 0x09, 0x04, 0xF7, 0x46, 0x29, 0xA4, 0x3F, 0xD6, 0x2A, 0xA2, 0xD6,
-    0x25, 0x59, 0x83, 0x9A, 0x71, 0xF3, 0x95, 0x16, 0x99, 0x4E, 0xCD, 0xB7, 0x8D, 0xF9, 0x39, 0x7E,
-    0x78, 0xC4, 0x44, 0x3C, 0x0B, 0x59, 0xF5, 0x4E, 0x9E, 0x4F, 0xB8, 0x2E, 0xFD, 0xAC, 0xE9, 0x12,
-    0xD9, 0x7B, 0x85, 0x55, 0x1B, 0x6C, 0xD3, 0x80, 0x6F, 0xEA, 0x08, 0x29, 0x50, 0xF9, 0xC8, 0xFD,
-    0x58, 0x3E, 0xF2, 0xFE, 0x07, 0xE9, 0x0E, 0x68, 0x1C, 0x1F, 0x58, 0x04, 0x35, 0x7C, 0xA3, 0xE2,
-    0xCC, 0xEA, 0x3F, 0x62, 0x60, 0xCF, 0x89, 0x29, 0x3B, 0xBF, 0xB2, 0x24, 0xBA, 0x9C, 0xE9, 0x0C,
-    0xCD, 0xDB, 0xFB, 0x6A, 0x60, 0x09, 0xE0, 0xEB, 0x3B, 0x09, 0xCE, 0x98, 0x95, 0xA3, 0xB0, 0xDA,
-    0x3B, 0xFF, 0xCF, 0x2F, 0xAB, 0x41, 0x10, 0xEE, 0x00, 0xAE, 0xAA, 0x2F, 0x43, 0xE9, 0xF0, 0x98,
-    0xD2, 0x3F, 0x82, 0xA0, 0xF1, 0x79, 0x4C, 0xD3, 0x11, 0x77, 0xD5, 0xE5, 0xCE, 0x19, 0xFD, 0x5F,
-    0x89, 0x7C, 0xB8, 0xB8, 0x0F, 0x09, 0x6C, 0x46, 0x8B, 0x7D, 0x79, 0x08, 0x7F, 0x6A, 0xA8, 0xD4,
-    0x04, 0xAD, 0x3B, 0xF1, 0x44, 0xA9, 0x05, 0x13, 0xA5, 0x96, 0xC0, 0x26, 0x73, 0x98, 0xF3, 0x18,
-    0x10, 0x4A, 0x68, 0xB0, 0xC9, 0x42, 0x17, 0x35, 0x20, 0xC3, 0xE5, 0xB6, 0x4F, 0x0A, 0x30, 0x54,
-    0x8B, 0x80, 0xA0, 0x9E, 0xA7, 0xDF, 0x0C, 0x75, 0xEE, 0xB3, 0xE9, 0xD0, 0xAA, 0x7B, 0x90, 0xA2,
-    0x44, 0xDA, 0xA6, 0xF3, 0x52, 0xAC, 0xB3, 0xDC, 0x16, 0x13, 0x8F, 0x97, 0x2C, 0x90, 0x42, 0x53,
-    0x96, 0x3B, 0x59, 0xEA, 0x64, 0x7D, 0x83, 0x25, 0xCE, 0xA0, 0xDC, 0x05, 0x92, 0x8E, 0x43, 0x04,
-    0xF8, 0x5E, 0x5E, 0xFC, 0x64, 0x80, 0x68, 0xD5, 0xAB, 0x3C, 0x62, 0x14, 0xF7, 0x29, 0x5A, 0x26,
-    0x4C, 0x03, 0x42, 0x0A, 0x4D, 0x7F, 0x48, 0xAC, 0xFC, 0x8D, 0xAD, 0xA4, 0x5B, 0x48, 0x57, 0xD3,
-    0x61, 0x48, 0xB9, 0x0A, 0x86, 0x2F, 0xE2, 0x88, 0x93, 0x1F, 0xAD, 0x73, 0x2D, 0x22, 0x07, 0xBC,
-    0xFF, 0x53, 0x6C, 0xC4, 0x34, 0xF1, 0x11, 0xA5, 0x4F, 0x2A, 0xAC, 0xA3, 0x21, 0xF0, 0x3A, 0x27,
-    0xBF, 0xBB, 0xA7, 0xFA, 0xC7, 0xEC, 0x71, 0xB0, 0x97, 0x3D, 0xCE, 0x9E, 0x54, 0x87, 0x60, 0xFC,
-    0xBF, 0xA1, 0x23, 0x53, 0x8F, 0x69, 0xFE, 0xFF, 0x6F, 0x2B, 0x60, 0x5B, 0x81, 0xB6, 0x10, 0x98,
-    0xBE, 0x83, 0xC0, 0xF4, 0x0D, 0x04, 0x66, 0xA0, 0xC0, 0x4E, 0xFB, 0xC0, 0xD0, 0x3D, 0x30, 0x34,
-    0x0F, 0xF4, 0xBD, 0x03, 0x43, 0xEB, 0xC0, 0xD0, 0x39, 0x30, 0x34, 0x0E, 0x0C, 0x7D, 0x03, 0x43,
-    0xDB, 0xC0, 0x80, 0xED, 0x80, 0xEB, 0x80, 0xE9, 0xD0, 0x32, 0x30, 0x74, 0x0C, 0x0C, 0x0D, 0x03,
-    0x43, 0xBF, 0xC0, 0x80, 0xDF, 0xD0, 0x2D, 0x30, 0x34, 0x0B, 0x4C, 0x7A, 0x05, 0x06, 0x17, 0xB0,
-    0xD7, 0x39, 0x7D, 0x9D, 0x68, 0xF4, 0x00, 0xFA, 0x02, 0xDA, 0xCE, 0xC5, 0xD5, 0x6D, 0x15, 0x90,
-    0xD7, 0xFD, 0xB1, 0xF4, 0xAE, 0x0C, 0xA0, 0xA1, 0x8D, 0x2A, 0xE6, 0x9F, 0x5D, 0x09, 0x37, 0x53,
-    0x6C, 0x61, 0xD6, 0xAB, 0xAE, 0xB3, 0x5E, 0xF0, 0x35, 0xF7, 0x98, 0x5E, 0x2E, 0x37, 0x33, 0xB6,
-    0x6A, 0x2C, 0x19, 0x75, 0x4D, 0xAF, 0x6E, 0x12, 0x2B, 0x2D, 0x33, 0xDB, 0xC5, 0x70, 0x62, 0x85,
-    0x66, 0xA9, 0x75, 0x4C, 0x36, 0x01, 0x80, 0x1B, 0x11, 0xF2, 0x0A, 0x33, 0x3A, 0xA8, 0x00, 0x7B,
-    0x5B, 0x44, 0x8C, 0x0D, 0x72, 0x3C, 0x5D, 0xD5, 0xCF, 0x0E, 0x7B, 0xB6, 0xBC, 0x52, 0x7E, 0x24,
-    0x04, 0xF4, 0x31, 0x83, 0x78, 0x8A, 0x65, 0x9F, 0x68, 0x52, 0x84, 0x21, 0x28, 0x19, 0xD2, 0x4D,
-    0xD6, 0x61, 0x53, 0xEF, 0x4D, 0x39, 0xF1, 0x93, 0xB5, 0xB6, 0xA9, 0x41, 0x53, 0xAF, 0x10, 0xD4,
-    0x6F, 0xA6, 0xF5, 0x60, 0xE0, 0x5B, 0xCE, 0xD1, 0x5C, 0xF1, 0x5B, 0x1C, 0x88, 0xF7, 0x1F, 0xBF,
-    0x13, 0xBD, 0xEE, 0x3F, 0x84, 0xE4, 0x05, 0xE4, 0x52, 0xED, 0xFF, 0x09, 0x59, 0xCF, 0x0D, 0xD9,
-    0x01, 0x24, 0xDB, 0xCA, 0x18, 0xA7, 0x3B, 0xC7, 0x4B, 0x96, 0x3F, 0x62, 0x52, 0x40, 0x2B, 0xB6,
-    0x4B, 0xEA, 0x8B, 0x86, 0xEA, 0xA3, 0xC1, 0x1A, 0x82, 0x0E, 0xEB, 0xEF, 0x28, 0x8E, 0xB9, 0x15,
-    0x7C, 0x5A, 0xEF, 0xE3, 0x35, 0x72, 0x16, 0x0C, 0x72, 0x7D, 0x2A, 0x9E, 0xA0, 0x1D, 0x53, 0x8C,
-    0x76, 0xCC, 0x06, 0x93, 0xA1, 0x39, 0xB9, 0x81, 0xFF, 0xCC, 0x4E, 0x85, 0xCA, 0xB9, 0xB7, 0xD3,
-    0x1A, 0xA0, 0xFA, 0xEA, 0xA6, 0x19, 0x5D, 0x94, 0x60, 0x2F, 0xC5, 0xA5, 0xFD, 0x00, 0xDA, 0x0D,
-    0xA0, 0xBD, 0x00, 0xDA, 0x09, 0xA0, 0x7D, 0x00, 0xDA, 0x05, 0xC0, 0x1E, 0x00, 0xED, 0x00, 0xD0,
-    0xFA, 0x7F, 0xDF, 0xFD, 0xA0, 0xBD, 0x0F, 0xA8, 0xFC, 0x6B, 0xDD, 0x5F, 0xAB, 0xFE, 0x7D, 0xCF,
-    0x03, 0x2A, 0xFE, 0x7D, 0xBF, 0x83, 0x76, 0x3B, 0xA0, 0xD6, 0xDF, 0x77, 0x3A, 0xA0, 0xCE, 0xAF,
-    0x55, 0xFE, 0xBE, 0xC7, 0x81, 0x8D, 0x92, 0xE6, 0xAB, 0x03, 0x4A, 0x14, 0x5A, 0x9A, 0x34, 0xD5,
-    0x46, 0xD5, 0x6E, 0x49, 0x9E, 0xF5, 0x78, 0x14, 0xE3, 0x59, 0x89, 0x67, 0x19, 0x9E, 0x35, 0x78,
-    0x2D, 0xC0, 0xA3, 0xFA, 0x4E, 0x7D, 0xCA, 0xBA, 0x3B, 0x8B, 0xEE, 0x5A, 0x71, 0x2F, 0x7A, 0xB7,
-    0x8A, 0x85, 0x76, 0x56, 0xD9, 0x59, 0x62, 0x4F, 0x34, 0x0D, 0x69, 0x09, 0x36, 0x67, 0x32, 0xB4,
-    0x1D, 0x45, 0x5F, 0xF5, 0x87, 0xC6, 0xF9, 0xFF, 0x64, 0x86, 0xC0, 0xD5, 0xCB, 0x29, 0x1D, 0xD9,
-    0xCE, 0xF8, 0xFB, 0x72, 0x28, 0x7D, 0xFA, 0x0F, 0xCF, 0x4F, 0x55, 0x9D, 0xED, 0xA4, 0xAA, 0xEA,
-    0xF3, 0x53, 0x55, 0xC9, 0x53, 0x52, 0x55, 0x1B, 0xE3, 0xEC, 0xA4, 0xAA, 0xCC, 0xF9, 0x79, 0x40,
-    0x9C, 0xE6, 0xAE, 0x73, 0x93, 0xF7, 0x1C, 0xCE, 0x01, 0x7C, 0xE6, 0xFE, 0x06, 0xC1, 0x4E, 0xFE,
-    0x7D, 0x3B, 0xF0, 0x4F, 0x43, 0x8C, 0x5E, 0xBA, 0xB8, 0xF4, 0x95, 0x79, 0xD9, 0xB2, 0xE2, 0x7C,
-    0xDA, 0xC6, 0xD0, 0xDB, 0xA0, 0xC0, 0xBA, 0x4A, 0x2F, 0x9C, 0xDF, 0x10, 0x79, 0xC5, 0xD3, 0x5A,
-    0xC6, 0x5C, 0x57, 0x3C, 0xD6, 0x2A, 0xB5, 0xCD, 0x2E, 0xEE, 0x2A, 0xE9, 0xE6, 0x55, 0x73, 0x69,
-    0x73, 0x5D, 0x0A, 0xFC, 0x76, 0x54, 0x35, 0x1A, 0x93, 0x2B, 0xE0, 0xAF, 0x4D, 0x40, 0xBE, 0x07,
-    0xAA, 0xDD, 0xAD, 0xB1, 0xF5, 0x9F, 0x44, 0x83, 0x6E, 0xDF, 0x11, 0xC0, 0xE3, 0x12, 0xDD, 0x58,
-    0x22, 0x66, 0xA2, 0x5F, 0xD1, 0xDB, 0x5C, 0xA0, 0xC5, 0xF2, 0x4F, 0xEC, 0xD1, 0xFD, 0xB0, 0x42,
-    0xEC, 0xF3, 0x46, 0x25, 0xA2, 0x7A, 0x26, 0xBA, 0x25, 0x77, 0xC4, 0x85, 0x82, 0xD3, 0xE4, 0x57,
-    0x50, 0xE7, 0x7E, 0x15, 0x67, 0x08, 0xF3, 0x10, 0xBA, 0x85, 0x45, 0x7C, 0x17, 0x72, 0x10, 0xBF,
-    0x2B, 0xF2, 0x9D, 0x47, 0x1F, 0xC1, 0xCF, 0x80, 0x13, 0xDF, 0x99, 0xB0, 0x85, 0xAE, 0x95, 0x50,
-    0x43, 0x78, 0xD0, 0xEB, 0xFE, 0x75, 0xAD, 0xCE, 0xAC, 0xF0, 0xEB, 0x37, 0x81, 0xC5, 0x2B, 0x23,
-    0x97, 0xB3, 0x4D, 0xE8, 0xB4, 0xB7, 0xEA, 0x49, 0xCF, 0x85, 0x34, 0x7A, 0xFE, 0x4E, 0x95, 0x5A,
-    0xD4, 0x63, 0xF7, 0x5F, 0x5C, 0x45, 0xD4, 0xC6, 0xAF, 0x3B, 0x68, 0x8C, 0x79, 0xE6, 0x8A, 0xFE,
-    0x46, 0x0B, 0xD8, 0xC3, 0x3C, 0x28, 0xC2, 0x5F, 0x89, 0x89, 0x8D, 0xC5, 0x47, 0xCA, 0x4F, 0xC4,
-    0xE2, 0xDE, 0xAD, 0xC3, 0x3C, 0x12, 0xC7, 0x24, 0x8B, 0xDE, 0xCC, 0xA3, 0x34, 0xFA, 0x09, 0xF4,
-    0x4D, 0x2B, 0x32, 0x12, 0xD6, 0x72, 0xCE, 0x7E, 0x1D, 0x54, 0xBA, 0x52, 0x3C, 0xDF, 0x02, 0x9A,
-    0x41, 0x23, 0x3B, 0xF7, 0xAE, 0x33, 0xAD, 0x92, 0x22, 0xC3, 0x22, 0x00, 0x1D, 0x41, 0x39, 0x44,
-    0x00, 0xC6, 0x4F, 0x7F, 0xFA, 0x64, 0x72, 0x9C, 0xB9, 0x71, 0xF8, 0x0D, 0xCC, 0x8C, 0x33, 0x31,
-    0x4E, 0x65, 0x43, 0x5D, 0x43, 0x55, 0xC3, 0xA4, 0x38, 0x14, 0x0D, 0x53, 0xE2, 0x54, 0x33, 0xD4,
-    0x32, 0x54, 0x32, 0xB1, 0x0D, 0xE3, 0x2A, 0x6A, 0x18, 0x2A, 0x18, 0xA6, 0xC2, 0xA9, 0x5E, 0x98,
-    0x08, 0xA7, 0x72, 0xA1, 0x6E, 0xA1, 0x6A, 0x71, 0xEF, 0x7D, 0x15, 0x72, 0x94, 0xF4, 0x42, 0x75,
-    0x82, 0xD5, 0x63, 0xF6, 0x1C, 0xA6, 0xD5, 0x85, 0xA6, 0xBE, 0x5F, 0xC6, 0x91, 0xAD, 0x11, 0x5C,
-    0x50, 0x46, 0xF3, 0x08, 0x14, 0x3A, 0x7C, 0xF6, 0x14, 0xB2, 0x90, 0x41, 0x55, 0x78, 0x70, 0x90,
-    0xFC, 0xFC, 0x55, 0x94, 0x36, 0x5E, 0xB8, 0x40, 0xE2, 0xDC, 0x3F, 0x14, 0x74, 0x57, 0xE0, 0x9E,
-    0x04, 0x22, 0x19, 0x7D, 0x03, 0x0D, 0xEA, 0x39, 0x5A, 0x7A, 0x8A, 0x1B, 0x53, 0xA7, 0xB7, 0x6F,
-    0x2C, 0xE6, 0x30, 0xF6, 0x13, 0x2D, 0x27, 0x41, 0x27, 0x63, 0x05, 0xED, 0x56, 0xDA, 0x8A, 0x93,
-    0xEB, 0x41, 0xFD, 0x71, 0x18, 0x83, 0xCE, 0xBD, 0xF4, 0xDB, 0x7E, 0x48, 0xBB, 0x58, 0x64, 0xEC,
-    0x2D, 0x65, 0x6B, 0xA9, 0x39, 0xCC, 0xEE, 0x8B, 0x72, 0x6C, 0x0D, 0x3C, 0x04, 0xB3, 0x11, 0x5F,
-    0xE0, 0x4E, 0x90, 0x99, 0xD7, 0xDC, 0x31, 0x2A, 0x0E, 0x18, 0x63, 0x88, 0x2A, 0xBB, 0xBD, 0x11,
-    0xBD, 0x56, 0x07, 0x25, 0x28, 0xED, 0x6E, 0xA2, 0x4C, 0x14, 0xF7, 0xD7, 0xD7, 0x85, 0x00, 0x2B,
-    0x5F, 0x3F, 0x30, 0xB3, 0x74, 0x68, 0xFF, 0xD5, 0x86, 0xDC, 0x14, 0xCF, 0x58, 0x5C, 0x4B, 0x91,
-    0xFB, 0x70, 0x40, 0x7A, 0xDA, 0xBA, 0x03, 0x04, 0x75, 0xC9, 0x96, 0x95, 0x28, 0x34, 0x8A, 0x89,
-    0x48, 0xBB, 0xB9, 0x97, 0x3D, 0x7B, 0x32, 0x18, 0xF3, 0x5D, 0xF5, 0xF3, 0x42, 0x41, 0xF5, 0x75,
-    0x09, 0x49, 0xBE, 0x62, 0xFE, 0xF6, 0xF3, 0x20, 0xC1, 0x81, 0x90, 0xDB, 0x27, 0xB9, 0x13, 0x24,
-    0x3C, 0x53, 0x21, 0x77, 0x6E, 0x5E, 0xD9, 0x21, 0x77, 0x4C, 0xF4, 0x0B, 0x1A, 0x84, 0x73, 0x9B,
-    0xBE, 0xF2, 0x27, 0x9B, 0xBE, 0x12, 0x33, 0xBE, 0x67, 0x4F, 0xF6, 0x8F, 0xC1, 0x1E, 0xA0, 0x03,
-    0x0D, 0x0D, 0x68, 0xD7, 0x0F, 0x4E, 0xA1, 0xCA, 0xEF, 0x6E, 0xFC, 0xBC, 0x71, 0xAB, 0x9B, 0xE6,
-    0xA7, 0x2F, 0x8C, 0x61, 0xA5, 0x76, 0x5B, 0xE3, 0x7F, 0x86, 0xA5, 0x87, 0x07, 0x59, 0x66, 0x8C,
-    0x13, 0x56, 0x36, 0x40, 0xD0, 0xEE, 0x6D, 0xD7, 0x76, 0xA5, 0x5E, 0x4F, 0x45, 0xE4, 0x51, 0x11,
-    0x16, 0xBD, 0x6F, 0xEE, 0x88, 0xEE, 0xFC, 0xDA, 0x45, 0x61, 0x02, 0xC9, 0xEE, 0x6A, 0x91, 0xEA,
-    0x20, 0x7B, 0x3D, 0x30, 0x7F, 0x31, 0xB6, 0xCF, 0xF5, 0x80, 0xCA, 0x0D, 0x0A, 0xAB, 0x76, 0x98,
-    0xCB, 0xB6, 0xBB, 0x38, 0x2A, 0x82, 0xB6, 0x83, 0xFD, 0xF0, 0xEE, 0x7B, 0x0C, 0x27, 0x99, 0x4D,
-    0x29, 0x4F, 0x98, 0x9E, 0x23, 0x97, 0x2C, 0x19, 0xDB, 0x7D, 0x6D, 0xC2, 0xA1, 0x97, 0xB5, 0x59,
-    0xEE, 0xE0, 0xF4, 0x3E, 0xBC, 0xA9, 0xB3, 0xD1, 0x24, 0xC8, 0x86, 0x37, 0x91, 0x0D, 0x7D, 0xD5,
-    0x2D, 0x2E, 0xB2, 0x59, 0xCE, 0x7C, 0x57, 0xAB, 0xC3, 0xCC, 0x0F, 0xD1, 0x3B, 0x7B, 0xDD, 0xFC,
-    0x1C, 0x64, 0xDC, 0x11, 0xA9, 0x4B, 0xDC, 0x73, 0x48, 0x37, 0x18, 0x4C, 0x2D, 0x98, 0xA1, 0x1F,
-    0x24, 0xBD, 0x61, 0x26, 0x7C, 0xFD, 0xF9, 0x53, 0xF0, 0x3B, 0x78, 0xEA, 0x6C, 0x4E, 0xD4, 0xDF,
-    0x10, 0x30, 0xC2, 0x0F, 0x20, 0x3D, 0xC5, 0x1D, 0xF9, 0xB6, 0x7C, 0x6D, 0x6A, 0x32, 0x4E, 0x8D,
-    0x66, 0x39, 0xAD, 0xAE, 0x8C, 0x0A, 0x34, 0xA5, 0xA0, 0x4D, 0x9D, 0x6E, 0xB2, 0x1D, 0x18, 0xAB,
-    0x23, 0x40, 0x47, 0x74, 0x9E, 0x64, 0xDE, 0x27, 0xEF, 0x74, 0xD0, 0x95, 0xE8, 0xBA, 0xE8, 0xF0,
-    0xD0, 0x15, 0xBB, 0x9C, 0x29, 0x15, 0x94, 0x8B, 0x00, 0x21, 0x3B, 0x43, 0x68, 0x6F, 0x63, 0x21,
-    0xB5, 0x0F, 0x06, 0xB4, 0x5A, 0x08, 0x52, 0x1D, 0xB6, 0x9A, 0xEA, 0xB0, 0x57, 0x77, 0x74, 0xD8,
-    0x1D, 0x89, 0x21, 0x97, 0x12, 0xB5, 0xB6, 0x8F, 0x4F, 0x19, 0xC4, 0x74, 0x1A, 0xBB, 0x21, 0xDA,
-    0xEE, 0xB3, 0x8E, 0x9F, 0xA6, 0x04, 0xC6, 0x1E, 0x56, 0x47, 0x8B, 0x0F, 0xC6, 0x36, 0xCF, 0x6E,
-    0xC4, 0x50, 0x3B, 0x85, 0x9B, 0x3F, 0x7B, 0x12, 0xEC, 0x29, 0xBE, 0x1B, 0x13, 0x06, 0xF9, 0x73,
-    0xA1, 0x7F, 0xDD, 0x45, 0xE6, 0x20, 0x7E, 0x57, 0x53, 0xAE, 0xAC, 0xE4, 0x15, 0x4B, 0xEA, 0x26,
-    0x96, 0x35, 0x7E, 0x16, 0x5C, 0x85, 0xAE, 0xD3, 0xCF, 0xEA, 0x42, 0x7F, 0xEE, 0x8D, 0x4A, 0xCE,
-    0x8F, 0xC7, 0x27, 0x7E, 0x12, 0xEA, 0xA6, 0x3B, 0xAC, 0xC1, 0x7C, 0xCF, 0x94, 0x57, 0xA2, 0x07,
-    0xEC, 0xF0, 0x3C, 0x17, 0x3B, 0xB8, 0xE8, 0x0E, 0x47, 0x67, 0xDD, 0x1A, 0x8D, 0x95, 0x92, 0xC7,
-    0x6B, 0xB4, 0x22, 0x38, 0xA9, 0xFA, 0x63, 0x83, 0x53, 0xE6, 0x0C, 0x7F, 0x6A, 0x17, 0x41, 0x42,
-    0x33, 0xD0, 0x6A, 0x66, 0xD4, 0xF0, 0x21, 0x5F, 0x5B, 0xDF, 0xF1, 0xA6, 0x3F, 0xE7, 0x20, 0x9F,
-    0xBD, 0x08, 0xF1, 0x9D, 0xDD, 0x5A, 0x17, 0x70, 0xCF, 0x52, 0x5B, 0x6F, 0xBA, 0x35, 0x8D, 0x23,
-    0x66, 0x83, 0x47, 0xC8, 0x20, 0xBF, 0x98, 0xB4, 0xCA, 0xC5, 0x70, 0xB7, 0xBA, 0xD2, 0x7B, 0xF4,
-    0x4E, 0x1E, 0x94, 0x2A, 0x63, 0x38, 0x24, 0x24, 0x8E, 0xBC, 0xAD, 0xCD, 0xAB, 0xC4, 0xF0, 0x26,
-    0x5A, 0x1B, 0xED, 0xF7, 0x1E, 0xC7, 0xDC, 0x6C, 0xE4, 0x33, 0xA8, 0x85, 0x39, 0x7E, 0xF3, 0xF6,
-    0x98, 0xA6, 0x47, 0xE6, 0x15, 0x71, 0x15, 0xAC, 0x29, 0x5A, 0x4D, 0x9F, 0xD3, 0xCC, 0x43, 0x57,
-    0xC4, 0x18, 0x50, 0xB2, 0xC8, 0xF7, 0x1F, 0x21, 0xD8, 0xAB, 0x04, 0xED, 0xD7, 0xC4, 0x9F, 0xF6,
-    0x84, 0xD4, 0x5E, 0x89, 0x69, 0xCF, 0xD7, 0x9D, 0x16, 0x60, 0x75, 0x8B, 0x61, 0xF5, 0x68, 0x48,
-    0x2D, 0x6A, 0x54, 0xF6, 0x0A, 0xFB, 0x1E, 0x97, 0x58, 0xE4, 0x5A, 0xD7, 0xCC, 0xBB, 0xE6, 0x2F,
-    0x3F, 0x79, 0x7B, 0xF0, 0x85, 0x76, 0x1D, 0xA1, 0x28, 0x9D, 0x3E, 0xB5, 0xFC, 0x75, 0xE8, 0x5C,
-    0x3C, 0xA4, 0xF3, 0x96, 0x6D, 0xA7, 0xC4, 0xCF, 0xB8, 0xF4, 0x3F, 0x4F, 0xBA, 0x5D, 0xAF, 0xD9,
-    0x3C, 0x3D, 0xCA, 0x6C, 0xDB, 0x5B, 0x72, 0xBA, 0xE2, 0xCE, 0xC7, 0xF9, 0x7E, 0x96, 0x54, 0xF3,
-    0xF3, 0xAC, 0x4B, 0x6A, 0x6E, 0x85, 0x15, 0x47, 0x67, 0x0D, 0xD2, 0x1C, 0xEB, 0xF3, 0xCE, 0x10,
-    0x4A, 0xA7, 0x0E, 0xAA, 0xB1, 0x4A, 0x60, 0xD3, 0x2F, 0x3B, 0xA3, 0x7E, 0x62, 0x73, 0x1B, 0x9A,
-    0xFE, 0xA7, 0xE0, 0xF2, 0x11, 0x13, 0x97, 0xB5, 0x81, 0x98, 0xBD, 0x08, 0x38, 0xBA, 0x03, 0x5A,
-    0xF5, 0x44, 0x19, 0xEE, 0x01, 0xBE, 0x9B, 0xB4, 0x99, 0xAF, 0xA1, 0xF4, 0x11, 0x68, 0xF8, 0x0F,
-    0xAE, 0x89, 0x11, 0x57, 0xE2, 0xEE, 0x91, 0x59, 0x9F, 0xFB, 0x94, 0xC5, 0xFD, 0x2D, 0x40, 0x84,
-    0xF2, 0xDE, 0x22, 0x0F, 0x95, 0x12, 0x93, 0xE8, 0x9C, 0xC7, 0x42, 0x58, 0x1A, 0x00, 0x86, 0x64,
-    0xAC, 0x08, 0x8D, 0x90, 0x80, 0xE5, 0x78, 0x0B, 0x96, 0x44, 0x59, 0x08, 0x39, 0x9E, 0xBF, 0x53,
-    0x08, 0xBE, 0x20, 0xFF, 0xA6, 0x9D, 0x37, 0xDE, 0xA7, 0x75, 0xDE, 0xC8, 0xF1, 0x78, 0xA5, 0x55,
-    0x20, 0xC9, 0x8E, 0x02, 0x39, 0xE1, 0xB8, 0x22, 0x00, 0x0D, 0x63, 0x1C, 0x16, 0xA4, 0xB4, 0xEA,
-    0xA5, 0x25, 0x2F, 0x77, 0xBB, 0x58, 0xB0, 0x41, 0x53, 0x48, 0x82, 0xB1, 0x21, 0x53, 0x36, 0xA3,
-    0xDE, 0xD2, 0xD4, 0x25, 0x8C, 0x63, 0x36, 0xC9, 0x9F, 0x7F, 0xCA, 0x86, 0x9F, 0xA5, 0x13, 0xC4,
-    0x79, 0x5A, 0x27, 0x48, 0x3C, 0x2D, 0xAC, 0xCE, 0x90, 0x3E, 0x5B, 0xC1, 0xAB, 0x6F, 0x1F, 0x1D,
-    0x4B, 0x0C, 0x8E, 0xAE, 0x27, 0xE4, 0xCB, 0x1C, 0xE4, 0x8D, 0x5D, 0x40, 0xD8, 0xE7, 0x8D, 0xB5,
-    0x9A, 0x90, 0xF9, 0xF6, 0x49, 0xC6, 0x31, 0x6F, 0x8C, 0xE7, 0xF8, 0x04, 0xB2, 0x98, 0x3A, 0xCD,
-    0xF4, 0x79, 0xE3, 0xFF, 0x05, 0xAD, 0x56, 0xBF, 0x6F, 0xE3, 0xD6, 0x1D, 0xFF, 0x90, 0xB4, 0xC5,
-    0x3B, 0x3F, 0x4B, 0xEF, 0x06, 0x1B, 0x2D, 0x0E, 0xBA, 0xA3, 0x87, 0x0C, 0xF6, 0xD5, 0x36, 0x35,
-    0x08, 0xA9, 0x1A, 0x48, 0x22, 0x8B, 0x6C, 0x2D, 0x10, 0x08, 0xC8, 0x19, 0x5D, 0x0D, 0x34, 0x28,
-    0x92, 0x6B, 0x81, 0x68, 0xF0, 0xA0, 0x00, 0xD6, 0x91, 0x6D, 0xB2, 0x15, 0x28, 0xFC, 0x27, 0x68,
-    0xB8, 0x00, 0x81, 0x6E, 0xB0, 0x5A, 0x78, 0x30, 0x50, 0x5B, 0x62, 0x87, 0x0E, 0x45, 0x87, 0x10,
-    0x45, 0x81, 0xAC, 0x44, 0x52, 0xA0, 0x37, 0xE5, 0x88, 0x82, 0x03, 0x73, 0xA0, 0xF4, 0xFA, 0x79,
-    0xA4, 0x9D, 0x64, 0x08, 0x32, 0x85, 0xE4, 0xA3, 0x25, 0xBD, 0xF7, 0xBE, 0x3F, 0x3E, 0x9F, 0xCF,
-    0xF7, 0xFB, 0xFC, 0x2E, 0x9E, 0xC2, 0x83, 0x0C, 0xED, 0xC8, 0x88, 0xF1, 0x9E, 0x51, 0x58, 0xA9,
-    0x8C, 0x5C, 0x8C, 0x80, 0x3D, 0x40, 0xC1, 0x52, 0xA1, 0xF8, 0x2C, 0xF6, 0xCC, 0xF4, 0x12, 0x17,
-    0x86, 0x5F, 0x83, 0x93, 0x4B, 0x78, 0x6A, 0x8E, 0x91, 0x5B, 0x60, 0x66, 0x26, 0xB8, 0x3F, 0x9D,
-    0x78, 0x2A, 0xF5, 0x54, 0x02, 0x5E, 0x81, 0x52, 0xD1, 0x82, 0x63, 0xFB, 0xE8, 0xC8, 0x3F, 0xC6,
-    0xE4, 0xD2, 0x4C, 0x82, 0xF3, 0xC8, 0x55, 0x7E, 0xED, 0x05, 0xB6, 0x9E, 0xCE, 0x4F, 0xB1, 0x06,
-    0x7F, 0x6C, 0xC7, 0xD7, 0x22, 0x3E, 0xB5, 0xC3, 0x6D, 0x04, 0xF1, 0x6F, 0x52, 0x64, 0x66, 0xEA,
-    0xC6, 0x3D, 0xBA, 0xBB, 0xC7, 0xFD, 0x32, 0xEB, 0x5F, 0x8F, 0xE4, 0x89, 0xEC, 0x3E, 0x74, 0x8B,
-    0x5A, 0x82, 0x67, 0xF7, 0x61, 0xA5, 0x01, 0x44, 0x5C, 0xC0, 0x79, 0x33, 0xC5, 0xA9, 0x08, 0x31,
-    0x69, 0x00, 0xEF, 0xE0, 0x9D, 0x1E, 0x77, 0xC9, 0x48, 0x2A, 0xD8, 0x05, 0xAC, 0x0C, 0x86, 0x2F,
-    0x22, 0x11, 0xC9, 0x50, 0xFA, 0x8E, 0xEF, 0x32, 0x99, 0x3E, 0xB6, 0xB0, 0x6E, 0xF8, 0x8E, 0x1D,
-    0xBB, 0x22, 0xF2, 0x44, 0xD4, 0x97, 0xE1, 0x58, 0xFA, 0x74, 0xB0, 0x57, 0x3B, 0xF3, 0xEC, 0xD4,
-    0xF9, 0x43, 0x2A, 0xA2, 0xDC, 0x4A, 0x7A, 0x48, 0x1F, 0xEA, 0xB0, 0xAF, 0x80, 0x42, 0x3F, 0xC7,
-    0xC7, 0x93, 0x91, 0x91, 0x7A, 0xE7, 0x71, 0x15, 0x32, 0xDE, 0x83, 0xAD, 0x62, 0x47, 0xA5, 0x5C,
-    0xD7, 0xC1, 0x90, 0xF9, 0xA7, 0x56, 0x42, 0x37, 0x91, 0xEB, 0x07, 0x98, 0xE3, 0x31, 0xCC, 0xCC,
-    0x4A, 0xED, 0x44, 0x46, 0x4E, 0xE8, 0xA2, 0x47, 0x2B, 0x03, 0x3A, 0xF6, 0x6E, 0x6E, 0x17, 0x0E,
-    0xEF, 0xF5, 0xEF, 0x58, 0xF3, 0x08, 0xAE, 0x2F, 0x23, 0x3B, 0x36, 0x53, 0x5C, 0xE0, 0x13, 0x2B,
-    0x17, 0x89, 0x13, 0xF6, 0xF9, 0x91, 0xD7, 0x29, 0x46, 0x41, 0xBE, 0xC8, 0x90, 0x1A, 0x29, 0x18,
-    0xAE, 0xF4, 0x25, 0x9C, 0xA5, 0xBB, 0x3C, 0x40, 0x97, 0x09, 0x6D, 0x1F, 0x0D, 0x02, 0x95, 0x3E,
-    0x79, 0x9E, 0xC0, 0x8A, 0x61, 0x45, 0xB0, 0x23, 0x10, 0x10, 0xA6, 0x25, 0x81, 0x0D, 0x60, 0x9B,
-    0x21, 0x2D, 0xC9, 0x5E, 0xE6, 0xC6, 0xFD, 0x12, 0x4C, 0xC1, 0x38, 0xBB, 0x38, 0x21, 0xB4, 0x7D,
-    0xDC, 0x05, 0x06, 0x46, 0x6A, 0x24, 0x66, 0x1C, 0xAC, 0x82, 0xE5, 0xF6, 0xE3, 0xC5, 0xF2, 0xFC,
-    0x85, 0xF0, 0xB5, 0x7D, 0x7D, 0xA5, 0xA0, 0xBF, 0x9F, 0xBC, 0x22, 0xAF, 0xF8, 0xD1, 0xBF, 0xB5,
-    0x69, 0x33, 0x2C, 0xC9, 0x5C, 0xAC, 0x68, 0xB5, 0x8F, 0x31, 0xC3, 0x2E, 0x50, 0x18, 0xF9, 0x6F,
-    0xD3, 0x20, 0x09, 0xFC, 0x75, 0x5F, 0x86, 0x15, 0xCC, 0x1A, 0x68, 0xEF, 0x99, 0x9B, 0x89, 0xB4,
-    0xBB, 0x5C, 0x8E, 0x48, 0xAE, 0x67, 0xA5, 0x7C, 0x0E, 0xCC, 0x98, 0xDE, 0xF3, 0xFE, 0xBC, 0x23,
-    0x47, 0xB2, 0xEB, 0xB8, 0xCB, 0x5A, 0x62, 0x6B, 0xDC, 0xFC, 0x43, 0x26, 0x78, 0x0F, 0x66, 0x6C,
-    0x45, 0x22, 0x31, 0x72, 0x5A, 0xCD, 0x83, 0x34, 0x08, 0xAD, 0xC8, 0x61, 0x7E, 0x97, 0xBC, 0x17,
-    0x91, 0x17, 0x01, 0xDA, 0x3E, 0x89, 0x44, 0x45, 0xE4, 0x98, 0x7B, 0x1E, 0x63, 0xFD, 0xE8, 0x68,
-    0x20, 0x95, 0x4A, 0x9C, 0xE9, 0xF3, 0xE4, 0x90, 0xF9, 0xF7, 0x18, 0x65, 0x97, 0x08, 0x6C, 0xC1,
-    0xC0, 0x49, 0xC3, 0x8C, 0x4E, 0x5C, 0x3B, 0xF2, 0x94, 0x82, 0xF3, 0xAF, 0x1C, 0x13, 0x1C, 0x5F,
-    0x59, 0x49, 0xDF, 0x09, 0x9D, 0x15, 0x64, 0x0E, 0x3B, 0xD1, 0x44, 0x56, 0x4A, 0x96, 0xFF, 0x8C,
-    0xFA, 0x56, 0x7A, 0x81, 0xD9, 0x04, 0x67, 0x99, 0x15, 0xCF, 0xCF, 0xB9, 0x09, 0xB5, 0xFF, 0xE8,
-    0x05, 0x42, 0x45, 0x15, 0xD3, 0x6D, 0xCC, 0x0C, 0xDF, 0xE4, 0xCE, 0x6F, 0xEB, 0x7C, 0x82, 0x47,
-    0xA5, 0xCE, 0x03, 0x15, 0x53, 0xE3, 0x29, 0x35, 0x9E, 0xE2, 0xE6, 0x72, 0x95, 0xCA, 0xE9, 0x3A,
-    0xBB, 0xFD, 0xFE, 0x64, 0x3A, 0x9D, 0x70, 0x3E, 0x3E, 0x62, 0x0D, 0x10, 0x74, 0x5F, 0x2C, 0xAD,
-    0x50, 0xAA, 0x97, 0xFE, 0x81, 0x58, 0xA1, 0x63, 0x3C, 0x2B, 0xD7, 0x70, 0x7D, 0x42, 0x3B, 0xB1,
-    0xAE, 0x93, 0x47, 0x53, 0x5E, 0x9F, 0xF0, 0x17, 0xA5, 0x8A, 0xEA, 0xB3, 0x5E, 0x61, 0x46, 0x70,
-    0x12, 0x2C, 0x42, 0x51, 0xB0, 0x4C, 0x58, 0xA0, 0xD8, 0xA9, 0xAC, 0x6F, 0xE9, 0x57, 0xCE, 0x61,
-    0xE8, 0x00, 0xAC, 0xA4, 0xE4, 0x59, 0x57, 0x8E, 0x56, 0xB7, 0xA7, 0x27, 0xC7, 0x3F, 0xC0, 0x8A,
-    0xD3, 0xEF, 0x5B, 0xE1, 0x56, 0x91, 0x1C, 0x50, 0xDE, 0xC2, 0x17, 0x24, 0x6A, 0x89, 0x33, 0x0A,
-    0x1D, 0x03, 0x09, 0x23, 0x71, 0x60, 0x96, 0x04, 0x79, 0xD3, 0xE7, 0x9A, 0x10, 0xDD, 0x09, 0xCA,
-    0xD5, 0x9A, 0x3C, 0x39, 0x7D, 0x1E, 0x37, 0x48, 0xDC, 0x03, 0x8E, 0x03, 0xD8, 0x21, 0xE7, 0x75,
-    0xF6, 0xB0, 0xB3, 0x39, 0xDC, 0xC5, 0xCB, 0x70, 0xE4, 0x58, 0xD1, 0xAC, 0x6E, 0x85, 0x77, 0xEE,
-    0xB8, 0x7D, 0x99, 0x8B, 0xD4, 0x49, 0xC7, 0xC5, 0xCE, 0x0E, 0x7E, 0x67, 0x16, 0x76, 0x24, 0xD8,
-    0x9E, 0xAC, 0xC4, 0x64, 0x01, 0xBA, 0xD1, 0xDE, 0xF7, 0xE1, 0x9E, 0x68, 0xDC, 0xF7, 0x98, 0x86,
-    0x13, 0x0A, 0xEE, 0xA0, 0xB6, 0xBF, 0x55, 0x62, 0xC6, 0xC0, 0xF4, 0xE5, 0x52, 0xF8, 0xAE, 0x7A,
-    0x89, 0xAE, 0xB3, 0x44, 0x9B, 0x7C, 0xCC, 0x41, 0x5D, 0x84, 0x22, 0x74, 0xF0, 0x63, 0x86, 0x19,
-    0x63, 0xCD, 0xFD, 0x08, 0x63, 0xCF, 0xC3, 0xF5, 0xB5, 0x87, 0x51, 0xD6, 0x63, 0x4E, 0x1A, 0x75,
-    0x2D, 0xC4, 0x6B, 0x0A, 0xD4, 0x0D, 0x29, 0xC5, 0xC7, 0x0E, 0xB9, 0x72, 0xA7, 0xD3, 0xAB, 0x1E,
-    0xA1, 0xEA, 0x02, 0x97, 0x1C, 0x19, 0x4B, 0x6E, 0xA0, 0xE3, 0x28, 0xE7, 0x18, 0xDB, 0x6D, 0x5C,
-    0xCC, 0x70, 0xA2, 0x35, 0x43, 0x24, 0x06, 0xEB, 0xC6, 0x40, 0x7E, 0x98, 0x38, 0x6F, 0xC6, 0x37,
-    0x9D, 0x49, 0x6A, 0x50, 0xBD, 0xC2, 0x2B, 0x88, 0xF8, 0x25, 0x32, 0x5D, 0x88, 0x44, 0xF8, 0xED,
-    0xBF, 0xF9, 0xB6, 0xFA, 0xB0, 0x12, 0x8D, 0x4B, 0xD1, 0x7C, 0x40, 0xD1, 0xB4, 0x6E, 0xAC, 0x09,
-    0xCE, 0x3B, 0x61, 0x35, 0x88, 0xB9, 0xC8, 0x04, 0xDC, 0xD5, 0xFB, 0xE8, 0x05, 0x4B, 0x5C, 0xD8,
-    0xC4, 0xE2, 0x35, 0x94, 0xBD, 0xAC, 0x1C, 0xC7, 0x40, 0x29, 0xC0, 0x15, 0x49, 0x5A, 0x28, 0x74,
-    0xED, 0xA2, 0x34, 0x51, 0x3B, 0x6B, 0xC0, 0x5B, 0x8E, 0xF1, 0x41, 0x90, 0x63, 0x56, 0x63, 0xA9,
-    0xB2, 0xD5, 0x98, 0xD1, 0x05, 0x03, 0x5F, 0x52, 0x98, 0xAC, 0x99, 0xDF, 0x67, 0x30, 0x7F, 0x1E,
-    0xDE, 0x38, 0x34, 0x58, 0xAB, 0x6E, 0xA6, 0x09, 0xD0, 0xDD, 0x82, 0x00, 0xE4, 0xD6, 0x4A, 0xC5,
-    0x6E, 0x6E, 0x57, 0x15, 0x20, 0x6F, 0xDF, 0x6F, 0xFF, 0x1D, 0x72, 0x80, 0xBF, 0xFC, 0x89, 0x51,
-    0xB1, 0x45, 0xCF, 0xA0, 0x5B, 0xCE, 0x71, 0x29, 0xDB, 0xBB, 0x18, 0x0C, 0x81, 0xC6, 0xFA, 0xCD,
-    0xCA, 0x33, 0x0A, 0x4A, 0xA6, 0x74, 0x6B, 0xDF, 0xEC, 0x9D, 0xE8, 0xD9, 0x0D, 0xF6, 0x57, 0xD4,
-    0x6F, 0x77, 0x55, 0x16, 0xF0, 0xE7, 0xB7, 0x74, 0x6F, 0xFA, 0xF5, 0x3F, 0xBE, 0xF1, 0x52, 0x2A,
-    0x49, 0xC7, 0xA0, 0xAA, 0x18, 0x88, 0x3B, 0x16, 0xBE, 0x48, 0x44, 0xB2, 0x08, 0x2B, 0x25, 0xC8,
-    0x92, 0xE8, 0x19, 0x47, 0x4F, 0x13, 0xCA, 0x74, 0xD9, 0x15, 0x54, 0xD4, 0xFF, 0x55, 0x72, 0x89,
-    0x64, 0x30, 0x1B, 0x98, 0x39, 0xF8, 0x90, 0xD4, 0x3B, 0x3B, 0xFD, 0x42, 0x66, 0x32, 0xF5, 0xF2,
-    0x07, 0x1D, 0x0D, 0x94, 0x9D, 0x04, 0x61, 0x51, 0x1A, 0xC3, 0x64, 0x87, 0x7C, 0x3B, 0x89, 0x99,
-    0x89, 0xCC, 0xF3, 0xDB, 0xBA, 0x13, 0xE3, 0x2B, 0x22, 0xEA, 0xF1, 0x1C, 0xB2, 0x3F, 0xFF, 0x12,
-    0xCE, 0x17, 0x9F, 0x62, 0x6E, 0xFF, 0xD1, 0x9F, 0x08, 0x2B, 0x5C, 0x63, 0xF7, 0x15, 0x6C, 0x61,
-    0x6C, 0x69, 0xA1, 0x47, 0xF4, 0xB7, 0xE6, 0xAB, 0x53, 0x18, 0x67, 0xE0, 0x51, 0x7A, 0xF8, 0x25,
-    0xA9, 0xA1, 0xB8, 0x21, 0x4F, 0x51, 0x7B, 0xAD, 0x0C, 0xCE, 0xF9, 0x7C, 0x89, 0xA7, 0x8B, 0x97,
-    0xFE, 0xEC, 0xD0, 0x8A, 0xD2, 0x07, 0x54, 0x3B, 0xFF, 0x3E, 0x25, 0xCD, 0xFA, 0x77, 0xA0, 0xC3,
-    0x66, 0xBD, 0x48, 0x89, 0x6B, 0xC2, 0xDD, 0x3C, 0xE5, 0xF4, 0x79, 0x55, 0xD6, 0xEA, 0x95, 0xC7,
-    0x10, 0xEC, 0x54, 0x32, 0xC3, 0x20, 0xB2, 0xD4, 0x2B, 0xF6, 0x65, 0x7D, 0xD4, 0x52, 0x98, 0xC6,
-    0x13, 0x6A, 0xA3, 0xEC, 0x29, 0x7B, 0x57, 0xFA, 0x5D, 0xE8, 0xF2, 0xE5, 0x01, 0xC7, 0x96, 0xB6,
-    0x88, 0x6C, 0xF5, 0x4A, 0x7D, 0xB3, 0x72, 0xFA, 0xAC, 0xD4, 0xE2, 0x34, 0xE4, 0x77, 0x15, 0xE9,
-    0x57, 0xC8, 0x92, 0x99, 0xFA, 0x0B, 0xFD, 0x49, 0xBF, 0x7C, 0x6C, 0x53, 0xC0, 0x46, 0x68, 0x2A,
-    0x75, 0xC6, 0x0A, 0x95, 0xAF, 0x94, 0xFA, 0xF8, 0x9C, 0x7D, 0xDE, 0x58, 0x50, 0x18, 0xBB, 0xDA,
-    0x02, 0xA9, 0xC3, 0xFA, 0xC7, 0xDA, 0x83, 0x52, 0x5F, 0x95, 0x86, 0x55, 0x68, 0xAD, 0x7C, 0x38,
-    0xA9, 0xD4, 0x1E, 0x8A, 0xAA, 0xBB, 0xBC, 0xAB, 0xDF, 0xF7, 0xCB, 0x7C, 0xFD, 0x4A, 0x43, 0x27,
-    0xE5, 0x52, 0xC6, 0xA2, 0xCA, 0xAB, 0xFA, 0xF5, 0xAA, 0x9A, 0x3B, 0xBE, 0xAD, 0x13, 0xF3, 0x7F,
-    0x68, 0x48, 0xEC, 0x36, 0xD0, 0xAE, 0xA3, 0xD5, 0x44, 0xAB, 0x8B, 0xFE, 0x0B, 0x2D, 0x71, 0x3B,
-    0xD9, 0xEF, 0xB4, 0xDA, 0x7F, 0x8D, 0x27, 0x24, 0xF5, 0x8D, 0xC9, 0xBA, 0x6F, 0xC0, 0xA2, 0x81,
-    0x1A, 0xC5, 0xB2, 0x89, 0x26, 0xF6, 0x89, 0x5A, 0x5B, 0x1F, 0x2A, 0x59, 0xA3, 0xDE, 0xD9, 0x68,
-    0x6F, 0xB4, 0xEA, 0xED, 0xE6, 0x21, 0xFF, 0x51, 0xD9, 0xB4, 0xD0, 0xB4, 0xB1, 0xBF, 0x81, 0x4E,
-    0x1D, 0xED, 0xD2, 0xDA, 0x1B, 0xA5, 0x35, 0x33, 0x7B, 0xC0, 0x1D, 0x2D, 0xAA, 0x6D, 0x88, 0x3E,
-    0xAD, 0x31, 0x5F, 0x7D, 0xDA, 0x59, 0xBE, 0xF9, 0x5F, 0xD4, 0x25, 0x3A, 0x0D, 0xB4, 0xEA, 0x18,
-    0x36, 0x31, 0xFC, 0xDA, 0x3D, 0x04, 0xE5, 0x58, 0xBF, 0x72, 0x7E, 0xD1, 0xDC, 0xD8, 0xAD, 0xB7,
-    0x37, 0x5B, 0xCD, 0xE1, 0x3E, 0xEE, 0xDD, 0xC9, 0xC7, 0x0F, 0x1B, 0xBF, 0xDC, 0x6F, 0xD8, 0xED,
-    0xE6, 0x46, 0x6B, 0xBF, 0x3E, 0xEC, 0x6C, 0x4E, 0xDA, 0x4D, 0xFF, 0xDE, 0xDA, 0xDD, 0x4B, 0xE9,
-    0xD7, 0x19, 0xD6, 0x2E, 0x83, 0x6A, 0x95, 0xA7, 0x70, 0x9D, 0x94, 0xDD, 0x7E, 0x1F, 0xE2, 0x67,
-    0x3C, 0x50, 0x8F, 0x37, 0x87, 0xBB, 0xAD, 0x61, 0x2B, 0x7E, 0x3D, 0xFA, 0x29, 0x4F, 0xC4, 0x35,
-    0xDC, 0xAD, 0x41, 0x34, 0x61, 0xCD, 0x74, 0xCF, 0xB7, 0x63, 0xD4, 0x87, 0x68, 0xB7, 0x75, 0x2B,
-    0xF9, 0x3F, 0xE5, 0x7D, 0x3D, 0x90, 0xDC, 0xD6, 0x9D, 0xE7, 0x03, 0x5A, 0x64, 0xAF, 0x89, 0x5A,
-    0x83, 0x81, 0x58, 0x3E, 0x4B, 0x75, 0xC6, 0x06, 0xBB, 0x55, 0x5E, 0x6F, 0xD9, 0x48, 0x77, 0xAB,
-    0xCC, 0x01, 0x28, 0x05, 0x17, 0x38, 0x10, 0x03, 0x8D, 0x74, 0x75, 0x0C, 0xE8, 0xC0, 0x81, 0x3F,
-    0x6A, 0x77, 0x92, 0x0B, 0x5C, 0x5B, 0x9C, 0x06, 0x74, 0x0A, 0x1C, 0x28, 0x30, 0x03, 0x4B, 0x17,
-    0x2E, 0x03, 0xDD, 0x95, 0x3D, 0xAC, 0x3A, 0x6E, 0xE0, 0x40, 0x55, 0xD7, 0x1F, 0x90, 0x5C, 0x5B,
-    0x0A, 0x1C, 0x08, 0x27, 0x97, 0x76, 0x83, 0x0D, 0x0C, 0xDB, 0xA2, 0xBD, 0x4B, 0x05, 0x84, 0x2D,
-    0xF0, 0x88, 0x19, 0xA1, 0x1B, 0xF7, 0xFF, 0xFD, 0xFE, 0x0F, 0xE8, 0x8F, 0xE9, 0x21, 0x29, 0xAF,
-    0x68, 0x52, 0x7B, 0x23, 0xF6, 0xC3, 0xA8, 0xA7, 0x1B, 0xEF, 0xBD, 0xFF, 0xFB, 0x7F, 0x7F, 0xC1,
-    0x98, 0x6F, 0x19, 0xF9, 0x89, 0x30, 0x04, 0xA9, 0x0C, 0x5E, 0x26, 0xC3, 0x20, 0xC7, 0xFF, 0x17,
-    0x66, 0xE5, 0x27, 0x6C, 0xDB, 0xCC, 0x44, 0x18, 0x92, 0xB6, 0x4D, 0xCD, 0x04, 0xEF, 0x8D, 0x31,
-    0x34, 0xDD, 0xE0, 0xD4, 0x32, 0xB8, 0x15, 0xBE, 0x5E, 0x62, 0x38, 0x3A, 0x78, 0xDD, 0x0C, 0xDA,
-    0xB6, 0x34, 0x43, 0x0C, 0x1E, 0x6E, 0xE9, 0x67, 0xDD, 0xC0, 0xB9, 0x82, 0x18, 0x37, 0xEE, 0xE7,
-    0xE7, 0x90, 0x1C, 0x1C, 0xC4, 0x66, 0x86, 0x29, 0xDA, 0xB6, 0x8D, 0xBB, 0xD9, 0xDF, 0xF0, 0x31,
-    0x49, 0x28, 0xFF, 0x5F, 0xE3, 0xF3, 0xD7, 0x3E, 0xFF, 0x18, 0x2C, 0x4D, 0x66, 0x5C, 0x60, 0xC6,
-    0x05, 0xDE, 0x9B, 0xCB, 0xA7, 0xE3, 0xB5, 0x4F, 0xEF, 0x60, 0x18, 0x61, 0xE0, 0x82, 0x9A, 0x5D,
-    0xF9, 0x73, 0xDB, 0xD6, 0xC6, 0xC1, 0x37, 0x9C, 0xB9, 0x33, 0x8B, 0x65, 0x41, 0x61, 0x26, 0x0B,
-    0xF2, 0x39, 0xE4, 0xC3, 0x42, 0x06, 0x59, 0x8B, 0x9F, 0xC9, 0x32, 0x38, 0x84, 0xA9, 0x0C, 0x49,
-    0x1C, 0xBC, 0xF4, 0xC2, 0xC2, 0x84, 0x17, 0xDA, 0xC6, 0x44, 0x4E, 0x8B, 0xB5, 0x3E, 0xC9, 0x6D,
-    0x9F, 0xC1, 0x3A, 0xA3, 0xD8, 0x4E, 0xE0, 0x54, 0xDD, 0xB9, 0x79, 0xF1, 0x06, 0x70, 0x52, 0x2C,
-    0x35, 0xC5, 0x52, 0xE3, 0x07, 0x01, 0x0E, 0x07, 0x9C, 0xFD, 0x10, 0xC3, 0xC9, 0xC0, 0x59, 0xDF,
-    0xEE, 0xCA, 0x4E, 0x57, 0x66, 0x7F, 0xBA, 0xAD, 0x74, 0xC3, 0xDE, 0xE2, 0xB5, 0xC6, 0x84, 0x85,
-    0x79, 0xC2, 0xCC, 0xF0, 0xBD, 0x39, 0xE6, 0xC0, 0xBC, 0x43, 0xCC, 0xE6, 0x15, 0xFD, 0x1C, 0xB7,
-    0x0E, 0x7E, 0x68, 0x82, 0x56, 0xB6, 0x1A, 0x72, 0x88, 0xBB, 0x2D, 0x46, 0xFD, 0x94, 0x21, 0x57,
-    0xC0, 0x0F, 0x73, 0x91, 0x5C, 0x7D, 0xFB, 0xEA, 0x5F, 0x1B, 0x39, 0x06, 0xB9, 0x6D, 0xD0, 0xE2,
-    0x8D, 0x73, 0xDD, 0x02, 0x1C, 0x99, 0xDB, 0xF8, 0x44, 0x90, 0x9B, 0x37, 0xE4, 0xE0, 0x8C, 0x63,
-    0x37, 0x8D, 0xC1, 0xAD, 0xBB, 0xED, 0xF3, 0x7F, 0x0D, 0xF1, 0x2D, 0xE2, 0x62, 0xE6, 0xBC, 0x2B,
-    0xA6, 0x4A, 0x08, 0x85, 0xB2, 0x5B, 0xB0, 0xB3, 0x84, 0x5B, 0xA3, 0xEF, 0x9D, 0xC5, 0x5F, 0x47,
-    0xBB, 0xB3, 0x42, 0x21, 0x1C, 0x72, 0x01, 0xBB, 0x46, 0xF1, 0x27, 0x22, 0x64, 0x26, 0xFC, 0xD7,
-    0xE0, 0x9F, 0x4C, 0x27, 0xB0, 0x16, 0x20, 0xEB, 0x3F, 0x81, 0x31, 0x8F, 0x1C, 0xFF, 0x04, 0xB6,
-    0xB2, 0x43, 0xF9, 0x17, 0xAD, 0x7C, 0xCF, 0x42, 0xF3, 0xCA, 0x15, 0xD3, 0x34, 0xF8, 0xF7, 0x8D,
-    0x6F, 0x74, 0x07, 0xFB, 0x89, 0xDD, 0x7C, 0x62, 0x37, 0xD4, 0x28, 0x30, 0x80, 0x49, 0x40, 0x07,
-    0x20, 0x02, 0x5E, 0x40, 0x03, 0x60, 0x01, 0x0E, 0xA8, 0x7B, 0x01, 0x0D, 0x70, 0x1A, 0x91, 0x3D,
-    0xFE, 0x1D, 0x8B, 0x01, 0x1B, 0xB7, 0xE2, 0x6D, 0xEC, 0xAD, 0xE4, 0xB4, 0xFE, 0x6C, 0x06, 0x3A,
-    0x95, 0x25, 0xC8, 0x9F, 0x4E, 0x71, 0x6A, 0x17, 0xB8, 0x01, 0x30, 0xDA, 0xEB, 0x90, 0x94, 0x44,
-    0x2E, 0xC4, 0xB5, 0xF9, 0xDD, 0x35, 0xE5, 0x31, 0xC9, 0x9C, 0x7A, 0x8D, 0x14, 0x61, 0xE5, 0x4A,
-    0x74, 0x95, 0xB9, 0x07, 0x47, 0x17, 0x89, 0xD9, 0x43, 0x72, 0x8D, 0xC6, 0x78, 0x6D, 0x2B, 0xEB,
-    0xAE, 0x65, 0xE5, 0x4F, 0x57, 0xD8, 0x92, 0x9F, 0xB9, 0x8D, 0x71, 0x4B, 0xBD, 0xA3, 0x7C, 0x49,
-    0x76, 0xD0, 0x60, 0x6B, 0xB2, 0x8B, 0x06, 0xDB, 0x8B, 0xF0, 0x25, 0xF9, 0x63, 0x84, 0x85, 0xCB,
-    0x1F, 0x23, 0x2C, 0x9C, 0x80, 0x0A, 0xCA, 0x2F, 0xC9, 0xDA, 0xA6, 0x07, 0x6D, 0x16, 0x35, 0x20,
-    0xE1, 0x05, 0x51, 0x84, 0xB7, 0x37, 0xCB, 0xB3, 0x08, 0x2C, 0x39, 0x10, 0x47, 0x47, 0x96, 0x28,
-    0x26, 0xF6, 0x3A, 0xB6, 0xF4, 0x21, 0xDF, 0xDF, 0xB7, 0xD7, 0x89, 0x45, 0xBD, 0xC6, 0x12, 0x1F,
-    0x91, 0xA9, 0x52, 0x6C, 0x14, 0x68, 0xB4, 0xA0, 0x58, 0xBD, 0xCA, 0x39, 0xDE, 0xDC, 0x7D, 0xF1,
-    0xCE, 0x1E, 0x97, 0x39, 0x28, 0x9D, 0x05, 0x96, 0x29, 0x2B, 0x4F, 0x70, 0xE5, 0xCA, 0x65, 0xB9,
-    0x5C, 0xB9, 0xAC, 0x41, 0xAE, 0x23, 0xAC, 0x41, 0xAE, 0x13, 0xCC, 0x1D, 0xA4, 0x82, 0xA6, 0x5C,
-    0x96, 0x10, 0x0A, 0x96, 0x75, 0x20, 0x78, 0x8A, 0x65, 0xE1, 0xFE, 0x32, 0x67, 0xD2, 0xBE, 0x6F,
-    0x3E, 0x2E, 0x27, 0x3B, 0x47, 0x4E, 0xD6, 0x80, 0xB0, 0x85, 0x9E, 0xE6, 0x71, 0x92, 0xB9, 0x55,
-    0xC7, 0xC4, 0x06, 0x60, 0xA7, 0xE0, 0x64, 0x59, 0xCF, 0xC9, 0x52, 0x62, 0x1F, 0xD8, 0x59, 0x4C,
-    0xB8, 0x12, 0x07, 0x23, 0x7B, 0x47, 0xE7, 0x75, 0xD3, 0xF1, 0x1C, 0xE5, 0x00, 0xCA, 0x74, 0xCD,
-    0x15, 0x8E, 0xA5, 0x59, 0xFF, 0x51, 0x9C, 0x8F, 0xC8, 0x3F, 0x46, 0xC4, 0xAC, 0x09, 0xB9, 0xC0,
-    0x98, 0x5C, 0xA1, 0x31, 0x33, 0x2C, 0xCF, 0x21, 0xF2, 0x81, 0xB1, 0xB8, 0x95, 0x9F, 0xE3, 0xE6,
-    0x60, 0x1E, 0x03, 0x22, 0xD6, 0x80, 0xC4, 0x39, 0x6C, 0x1B, 0x72, 0xB6, 0x39, 0x27, 0x1D, 0x71,
-    0x8C, 0xC8, 0xDC, 0x42, 0xE2, 0x35, 0x16, 0x12, 0x12, 0xE7, 0x23, 0x32, 0x28, 0xC5, 0xB2, 0x11,
-    0x0F, 0xA7, 0x23, 0x35, 0x85, 0x85, 0x7B, 0xCD, 0x74, 0xCC, 0xB3, 0xA3, 0xA6, 0xF3, 0x1C, 0x03,
-    0x8E, 0xDE, 0xF1, 0xF5, 0x0B, 0xAF, 0xC0, 0xB1, 0x94, 0x3C, 0x0C, 0x1E, 0x85, 0xB0, 0xF4, 0x89,
-    0x10, 0x02, 0xF0, 0x72, 0x78, 0x1B, 0xA3, 0xFF, 0x0E, 0xB0, 0x3D, 0x0A, 0x52, 0xB9, 0xEF, 0x24,
-    0x8C, 0xE5, 0xC8, 0x6B, 0xAC, 0x60, 0x50, 0x60, 0xC4, 0x7A, 0x87, 0x45, 0x28, 0x5F, 0xF1, 0xF2,
-    0x7D, 0xD9, 0xB8, 0x9F, 0xD5, 0xF8, 0xCA, 0x4F, 0x4A, 0x19, 0x83, 0x57, 0x32, 0xF9, 0x62, 0x78,
-    0x99, 0x92, 0x65, 0x84, 0x45, 0x47, 0xC4, 0xF5, 0x88, 0xAC, 0x20, 0xC9, 0x31, 0xCE, 0x52, 0x6C,
-    0xAC, 0xB5, 0xD0, 0x7E, 0xDD, 0x00, 0xFE, 0x8D, 0x0B, 0x40, 0x4F, 0x2F, 0x01, 0xA3, 0x23, 0x32,
-    0xBD, 0xD3, 0x87, 0xEB, 0x0B, 0x07, 0x4F, 0xF0, 0x71, 0x73, 0x00, 0x1A, 0x68, 0xC3, 0xDD, 0xCE,
-    0x01, 0x05, 0x80, 0x9B, 0x73, 0xC9, 0xBE, 0xC0, 0xC8, 0x43, 0x65, 0x10, 0x31, 0x90, 0xC8, 0x4F,
-    0x23, 0x02, 0x17, 0x80, 0xF6, 0xDE, 0x24, 0xE8, 0x7F, 0x46, 0x4E, 0xFA, 0x9B, 0x9C, 0x87, 0x91,
-    0x91, 0x05, 0x00, 0xDB, 0x1C, 0x92, 0xBF, 0x32, 0x57, 0xF2, 0x59, 0x65, 0xB9, 0x22, 0x20, 0x65,
-    0x78, 0x81, 0x1F, 0x51, 0xCE, 0xA0, 0x64, 0xF7, 0xE4, 0x12, 0x9E, 0x40, 0x7C, 0x45, 0x7B, 0xD0,
-    0xC1, 0xA4, 0x1B, 0x49, 0xD7, 0x4A, 0xD5, 0x4A, 0xD3, 0xF2, 0x01, 0x97, 0x08, 0x83, 0xA5, 0x8E,
-    0x39, 0x36, 0x76, 0x14, 0xB0, 0x38, 0xE0, 0x14, 0x86, 0x78, 0x6C, 0x28, 0x92, 0x2D, 0x8F, 0xC0,
-    0x18, 0x5B, 0x3E, 0xA1, 0x5C, 0xC2, 0xEF, 0x26, 0x14, 0x75, 0x40, 0x24, 0xCA, 0x8C, 0xBA, 0x40,
-    0xAB, 0xCA, 0xCA, 0x90, 0x7A, 0x93, 0x8E, 0x54, 0xA4, 0x2C, 0x4E, 0xFB, 0x80, 0xA9, 0x65, 0x79,
-    0x96, 0xA8, 0x28, 0x06, 0x5B, 0x22, 0xA6, 0xFC, 0x71, 0xF8, 0x73, 0x19, 0xFC, 0x77, 0x00, 0xB8,
-    0xEF, 0xCB, 0x10, 0xE1, 0xCB, 0x23, 0x0C, 0x0D, 0x57, 0x35, 0x04, 0xE1, 0x93, 0x9B, 0x0F, 0x0A,
-    0xA5, 0xB4, 0x10, 0x7C, 0x21, 0xC1, 0xB0, 0x38, 0xB8, 0x5E, 0x0A, 0xDC, 0xDC, 0x4A, 0xDE, 0x95,
-    0x4F, 0x62, 0x2B, 0x32, 0xA9, 0x53, 0x93, 0x22, 0x30, 0x55, 0x33, 0x25, 0x6E, 0x86, 0xE0, 0x58,
-    0x42, 0xE9, 0x39, 0xBE, 0x96, 0xDD, 0x47, 0x11, 0xB8, 0x73, 0x91, 0x5C, 0x28, 0xB5, 0x5A, 0x52,
-    0x71, 0x09, 0xCC, 0xC7, 0x99, 0x63, 0x3B, 0x53, 0x05, 0xB6, 0xC0, 0x66, 0x04, 0xD0, 0x4C, 0x70,
-    0x08, 0x60, 0x31, 0x2E, 0x06, 0xAF, 0x12, 0xB0, 0xC8, 0x3C, 0x33, 0x05, 0xCA, 0xFB, 0x38, 0xA3,
-    0xC5, 0x55, 0x60, 0xD5, 0xC2, 0x74, 0xF3, 0x8A, 0x16, 0x30, 0x06, 0x59, 0x11, 0xFA, 0x18, 0x64,
-    0xDE, 0x61, 0x01, 0xD0, 0x83, 0x7B, 0x44, 0xE9, 0xE0, 0xE8, 0xFA, 0x02, 0xF3, 0xE6, 0xE0, 0xE5,
-    0xD8, 0xB3, 0x43, 0xC6, 0x4C, 0x76, 0x17, 0xC5, 0x94, 0x63, 0x32, 0x6F, 0x14, 0x93, 0x19, 0xC8,
-    0x06, 0x67, 0x98, 0x7C, 0x2E, 0xF3, 0xDE, 0xA8, 0x31, 0xAF, 0x20, 0x77, 0x7B, 0xF8, 0x48, 0x15,
-    0x9F, 0x44, 0x65, 0x03, 0xD7, 0x02, 0x4E, 0xC9, 0x4B, 0xCD, 0xDB, 0x28, 0x82, 0x59, 0xDC, 0xC2,
-    0x05, 0x37, 0x93, 0xE9, 0x22, 0x9D, 0x50, 0xA9, 0x45, 0x2F, 0x29, 0xEF, 0x1C, 0xE8, 0xCA, 0x43,
-    0xBD, 0xBB, 0xA2, 0x33, 0xFE, 0x50, 0x1B, 0x2B, 0xEF, 0xAD, 0xCC, 0xB7, 0x12, 0x1F, 0x14, 0x88,
-    0x4B, 0x40, 0x09, 0x01, 0xAD, 0x49, 0xEE, 0x7A, 0xA6, 0x15, 0x4C, 0x3D, 0x82, 0x5A, 0x05, 0x86,
-    0x1D, 0xEA, 0xC5, 0x72, 0x76, 0x5E, 0xF6, 0x95, 0xC5, 0x4F, 0x3A, 0xE1, 0x64, 0xC1, 0x44, 0x22,
-    0xBB, 0xF8, 0xE8, 0x54, 0x7F, 0xD1, 0x66, 0x43, 0x30, 0x19, 0x60, 0x05, 0x98, 0x82, 0x53, 0x59,
-    0x16, 0xD3, 0x40, 0xC6, 0x65, 0x58, 0xC4, 0x04, 0x9C, 0x48, 0x56, 0x4F, 0xA6, 0x2F, 0x9F, 0x6E,
-    0x20, 0x13, 0x64, 0x86, 0xDA, 0xE7, 0x9C, 0x6F, 0xD6, 0x11, 0x26, 0x1B, 0xBE, 0x5B, 0x4D, 0xAD,
-    0x96, 0xD1, 0xD8, 0xAB, 0x0A, 0x1C, 0x7B, 0x8D, 0xBE, 0xF7, 0x2E, 0x39, 0xF8, 0xCC, 0xCB, 0x28,
-    0x8E, 0x1B, 0x9F, 0xD7, 0x61, 0x69, 0x85, 0x43, 0x1E, 0x90, 0x8F, 0x09, 0xCA, 0x91, 0xAB, 0x2D,
-    0x94, 0xC7, 0x11, 0xE1, 0x21, 0x82, 0x4B, 0x59, 0x80, 0x40, 0x3B, 0xC8, 0x94, 0x0F, 0x26, 0x38,
-    0x32, 0x2B, 0x12, 0x54, 0x03, 0x06, 0xF0, 0x64, 0x78, 0x8D, 0xFC, 0x2E, 0xC8, 0x3B, 0x8D, 0x77,
-    0xB8, 0x05, 0xD7, 0x64, 0x3B, 0x67, 0xAE, 0x37, 0x50, 0x63, 0xAF, 0x02, 0xF0, 0x05, 0x97, 0xD3,
-    0xA3, 0x59, 0xB4, 0x01, 0x30, 0x0C, 0x0B, 0xFD, 0xC8, 0x68, 0x77, 0xAF, 0xC2, 0xF9, 0x08, 0xCC,
-    0xA8, 0x4A, 0x9D, 0x7B, 0x2C, 0xE5, 0xCD, 0x53, 0xE6, 0x4B, 0x5C, 0x16, 0xF0, 0x2D, 0x78, 0x95,
-    0x52, 0x98, 0x47, 0xE0, 0x4C, 0xE3, 0xC7, 0x5B, 0x52, 0x3E, 0x7E, 0x9A, 0x87, 0xA5, 0x11, 0x2B,
-    0x78, 0x40, 0xD2, 0x9D, 0x30, 0xB4, 0xD2, 0x10, 0x2C, 0x64, 0x62, 0x3A, 0x49, 0xD8, 0xF1, 0x8E,
-    0x9E, 0x85, 0x90, 0x66, 0xC7, 0x8A, 0xA8, 0x2A, 0x08, 0x85, 0xA9, 0xE0, 0x22, 0x64, 0x06, 0xA4,
-    0x14, 0x9D, 0x60, 0xC8, 0x3D, 0x70, 0x39, 0x54, 0xE9, 0x8C, 0x35, 0x27, 0xAC, 0x3D, 0x61, 0x6D,
-    0x0A, 0x0B, 0x18, 0x28, 0xC9, 0xF8, 0x4D, 0xA5, 0x2E, 0x54, 0xE4, 0xD1, 0xCA, 0x71, 0xCA, 0x2D,
-    0xBC, 0x9A, 0xEF, 0x06, 0x35, 0x4D, 0x2A, 0xB1, 0x01, 0x66, 0x32, 0x59, 0x52, 0x99, 0xA9, 0x5C,
-    0x16, 0xA5, 0x39, 0x12, 0xF1, 0xF5, 0x61, 0x69, 0x0E, 0x85, 0x8F, 0xFD, 0xAA, 0x70, 0xEE, 0xC8,
-    0xB4, 0x6F, 0xE7, 0x6E, 0x29, 0xFC, 0xF2, 0x15, 0x11, 0x0B, 0x72, 0x4A, 0x10, 0x7B, 0xB5, 0x39,
-    0x2F, 0x97, 0x42, 0xCE, 0x31, 0x48, 0x87, 0xF9, 0xD8, 0xA9, 0x82, 0xD8, 0xCB, 0xC6, 0x83, 0x12,
-    0xF4, 0x78, 0x65, 0x98, 0x0B, 0x39, 0xA6, 0x57, 0xA0, 0x73, 0x04, 0xE9, 0xF9, 0x80, 0xE2, 0xE9,
-    0xFC, 0x0E, 0x05, 0xD4, 0xCE, 0x98, 0x22, 0x2A, 0x02, 0x02, 0xEC, 0x98, 0x10, 0x18, 0xB0, 0x2F,
-    0x6B, 0x12, 0x10, 0x4C, 0x84, 0x6C, 0x05, 0x04, 0x82, 0x11, 0x31, 0xF6, 0x1E, 0x52, 0x7A, 0x47,
-    0xDC, 0xE8, 0xC8, 0xA8, 0x16, 0x8D, 0x71, 0x6C, 0xD4, 0x60, 0xB0, 0xA3, 0x9A, 0x21, 0x6A, 0x84,
-    0x74, 0x47, 0x24, 0x4C, 0xEF, 0x60, 0xCE, 0xF3, 0x68, 0x78, 0x1C, 0x54, 0xD7, 0xD5, 0xA6, 0x70,
-    0xC8, 0xFC, 0xE5, 0xC3, 0xBD, 0x42, 0xA1, 0x9C, 0x9F, 0x8C, 0xCD, 0xB2, 0xFF, 0x8D, 0x09, 0x1B,
-    0xCB, 0x27, 0xF5, 0x67, 0xB6, 0x20, 0xA5, 0x40, 0x90, 0x44, 0x87, 0x42, 0xE7, 0xA2, 0x38, 0x0C,
-    0x1A, 0x32, 0x86, 0x39, 0xD1, 0x44, 0x64, 0x23, 0x51, 0x06, 0x66, 0x71, 0x44, 0x8C, 0x8C, 0x62,
-    0xE5, 0x58, 0x3A, 0x8E, 0x78, 0xF0, 0x53, 0x8E, 0x73, 0x32, 0x0E, 0x8C, 0x53, 0x8E, 0x0D, 0x46,
-    0xC1, 0xDC, 0x29, 0xED, 0x8F, 0x84, 0x26, 0xB9, 0xA0, 0xAD, 0xB0, 0x29, 0x39, 0xB4, 0x44, 0x2C,
-    0x8B, 0xC3, 0x4B, 0x0B, 0xE2, 0x59, 0x45, 0xD1, 0x86, 0x45, 0x39, 0x17, 0xAD, 0x67, 0x41, 0xE5,
-    0x82, 0x0A, 0x06, 0xD5, 0x29, 0x64, 0xD1, 0xE3, 0x6D, 0xCA, 0x97, 0xC2, 0x4A, 0xF5, 0xC4, 0x49,
-    0xA7, 0x7C, 0x15, 0x56, 0xF9, 0xA2, 0x99, 0xB6, 0x84, 0xD2, 0x3D, 0x94, 0xAF, 0x5E, 0x05, 0xEB,
-    0x61, 0xD5, 0x1D, 0x48, 0xAF, 0x68, 0xD0, 0xA8, 0x69, 0x31, 0x4B, 0x82, 0x73, 0x13, 0xC0, 0xF0,
-    0x24, 0xA8, 0xC0, 0x60, 0x9E, 0xCE, 0x56, 0x09, 0x30, 0x44, 0xF1, 0xA0, 0x70, 0x5A, 0x9C, 0x97,
-    0xB5, 0x18, 0xFD, 0x5B, 0x3F, 0xBA, 0x9F, 0x98, 0xDA, 0xEE, 0xE9, 0xD8, 0x53, 0x7D, 0x45, 0x98,
-    0xCA, 0xD1, 0xA5, 0x12, 0xBC, 0xE3, 0xAC, 0x3B, 0x57, 0x93, 0xCE, 0x3A, 0x2A, 0xE8, 0xB2, 0xA0,
-    0xF3, 0x62, 0xE3, 0x56, 0xD3, 0xFE, 0x7E, 0xF3, 0x7E, 0x98, 0xF4, 0x7F, 0x20, 0x8F, 0xA7, 0x14,
-    0x0B, 0x28, 0x29, 0x16, 0xBB, 0x3F, 0x06, 0xED, 0x57, 0xD8, 0x25, 0xDE, 0x78, 0x9E, 0xD2, 0xA5,
-    0x4D, 0x71, 0x02, 0xA9, 0x2A, 0xA3, 0x2B, 0x22, 0x65, 0x8B, 0xE4, 0xDD, 0x50, 0x5F, 0xB6, 0x6D,
-    0x69, 0x29, 0xD2, 0xB7, 0x68, 0x48, 0xCB, 0xBB, 0x3F, 0xA6, 0x46, 0x41, 0xFF, 0xA3, 0xBA, 0x77,
-    0x47, 0x47, 0xDC, 0xB7, 0x1C, 0x93, 0x25, 0x25, 0x7C, 0x25, 0x39, 0x9C, 0xED, 0xD5, 0x98, 0x65,
-    0x22, 0xAA, 0xED, 0xA0, 0xA6, 0x36, 0x21, 0xAB, 0xB5, 0x72, 0xBD, 0xA1, 0xC1, 0x0A, 0x31, 0x21,
-    0xCB, 0x86, 0x9C, 0x88, 0x21, 0x61, 0x40, 0x5F, 0x4A, 0xB8, 0x62, 0x52, 0x17, 0x72, 0x46, 0x61,
-    0x3A, 0x2C, 0x48, 0xE6, 0xA2, 0x9C, 0x0B, 0x7E, 0x89, 0xD8, 0x11, 0x91, 0x35, 0x68, 0x2F, 0xFF,
-    0x23, 0x36, 0xD2, 0xAA, 0x3F, 0xE3, 0xE9, 0x16, 0xE2, 0xDC, 0x7A, 0xB1, 0x2C, 0xCC, 0xFB, 0x8B,
-    0x2E, 0x5B, 0x98, 0x35, 0x75, 0x7B, 0x9C, 0x99, 0x62, 0xBC, 0x4C, 0x32, 0x05, 0xF4, 0x55, 0xAA,
-    0x10, 0xF6, 0x0D, 0x0F, 0x74, 0xC2, 0xAD, 0xEC, 0xA8, 0x46, 0x40, 0xE0, 0x04, 0xAA, 0xCE, 0xD0,
-    0xEE, 0xA0, 0xFF, 0x8A, 0xBC, 0xD5, 0x38, 0x87, 0x7A, 0x74, 0x35, 0x81, 0x41, 0x0D, 0x29, 0xDE,
-    0xE7, 0x71, 0x47, 0x04, 0x6B, 0xD4, 0x69, 0xA2, 0x3E, 0xD9, 0x7A, 0xC8, 0x5F, 0x12, 0x3D, 0xE2,
-    0x0D, 0xD3, 0xCA, 0x7F, 0x60, 0xD3, 0x6A, 0xF2, 0x31, 0x4C, 0xAB, 0xF0, 0x1E, 0xA6, 0xD5, 0x2D,
-    0x9A, 0x56, 0x0B, 0x9A, 0x56, 0x8B, 0xDE, 0x4F, 0xD5, 0x11, 0x9D, 0x8E, 0x75, 0x67, 0x9B, 0x52,
-    0x51, 0x85, 0x95, 0x54, 0xD0, 0x37, 0x42, 0xC7, 0x88, 0x0F, 0xAF, 0x08, 0x5D, 0x23, 0xF4, 0x87,
-    0xD0, 0x19, 0x42, 0x4F, 0xC8, 0x0E, 0x96, 0x9D, 0x58, 0xEB, 0x61, 0x07, 0xC4, 0x35, 0x35, 0xC1,
-    0xD1, 0x8D, 0x39, 0xD0, 0x42, 0xEE, 0x3B, 0x3B, 0x3A, 0xD1, 0x38, 0x28, 0xB7, 0x1B, 0x07, 0x21,
-    0xDD, 0x3A, 0x35, 0x6E, 0x37, 0xC6, 0x17, 0x47, 0x58, 0x1F, 0x54, 0x12, 0x0B, 0x07, 0xBE, 0x49,
-    0x63, 0x07, 0xDE, 0xB9, 0x42, 0xDF, 0x1C, 0x16, 0xFA, 0x26, 0x39, 0x52, 0x67, 0xD6, 0x0D, 0xED,
-    0x55, 0xEE, 0x1F, 0xA4, 0x8A, 0x0F, 0x44, 0x33, 0x5E, 0xF9, 0xA6, 0xE2, 0x26, 0x0C, 0x20, 0x7D,
-    0x53, 0x4D, 0xB1, 0x08, 0xD0, 0xE1, 0x9B, 0x40, 0x5B, 0xA3, 0x2B, 0x88, 0xAC, 0xCE, 0x10, 0x59,
-    0x53, 0x41, 0xA0, 0x2A, 0xC6, 0x62, 0x45, 0xB8, 0x42, 0xF3, 0x6D, 0xED, 0x75, 0x75, 0xFD, 0x93,
-    0x6D, 0xEB, 0x9F, 0xAC, 0xAD, 0xBF, 0xDC, 0xB6, 0xFE, 0x72, 0xDB, 0xFA, 0x4B, 0x55, 0x14, 0xB6,
-    0xAD, 0x3F, 0x3D, 0x71, 0xFD, 0x63, 0x7D, 0x73, 0x7D, 0xFD, 0xE3, 0xE5, 0xFA, 0x17, 0x57, 0x75,
-    0xFD, 0x6D, 0xAE, 0x97, 0x36, 0x5B, 0xA3, 0xF6, 0xFE, 0xDA, 0x89, 0xCF, 0x30, 0xEE, 0x35, 0x4A,
-    0xA3, 0x56, 0x78, 0x84, 0xAF, 0x24, 0x18, 0x66, 0xED, 0xFD, 0x39, 0xE2, 0xE2, 0x55, 0xA3, 0xDE,
-    0x3E, 0x87, 0x3E, 0xAF, 0xFA, 0xF4, 0x02, 0x50, 0x48, 0x8C, 0x4A, 0x8F, 0x52, 0xCF, 0x87, 0x9B,
-    0x8B, 0x94, 0x62, 0x64, 0x01, 0x0B, 0x75, 0x37, 0x06, 0xB7, 0x66, 0x55, 0x67, 0x3D, 0x1D, 0xDA,
-    0x25, 0xA8, 0x7A, 0x61, 0xC5, 0xBD, 0x95, 0x61, 0x56, 0xC3, 0xB0, 0xB2, 0xAC, 0x53, 0xD8, 0x42,
-    0xC5, 0x41, 0xEB, 0xEA, 0x14, 0x35, 0xE3, 0xE8, 0x79, 0x32, 0x55, 0xB5, 0xC1, 0x68, 0xC3, 0x80,
-    0xBE, 0x9E, 0xAE, 0x55, 0xB6, 0x35, 0xAA, 0x6B, 0xCC, 0x55, 0x8C, 0x4E, 0x54, 0xDB, 0x98, 0xAB,
-    0x08, 0x6D, 0xB8, 0x4E, 0xA7, 0xA1, 0xAA, 0x31, 0xA8, 0xB8, 0x06, 0xBF, 0x94, 0x35, 0x88, 0xB1,
-    0x0E, 0x1F, 0x9D, 0x40, 0x14, 0x5F, 0xC2, 0x2E, 0xE9, 0xD9, 0xB5, 0x50, 0xE8, 0x3C, 0xBA, 0xE3,
-    0x2D, 0x5E, 0x5D, 0x59, 0x0C, 0x56, 0x82, 0x65, 0x0C, 0x0B, 0xAF, 0xC6, 0x02, 0x30, 0x3B, 0x1C,
-    0x04, 0xE0, 0x12, 0x32, 0xE9, 0x1C, 0xFB, 0x90, 0xD5, 0x8B, 0x4A, 0xEE, 0x95, 0x32, 0x51, 0x8E,
-    0x59, 0xD4, 0x27, 0xA0, 0x9C, 0xF8, 0x7D, 0xF5, 0xA6, 0x9A, 0xC5, 0x6B, 0x3C, 0x06, 0x1A, 0x46,
-    0x8C, 0x07, 0x50, 0x68, 0x72, 0xD7, 0x4E, 0xBD, 0x32, 0x9C, 0x39, 0xB8, 0x5E, 0xC3, 0x8A, 0x25,
-    0x4C, 0x7B, 0xCA, 0xDC, 0x88, 0x20, 0x50, 0x36, 0x90, 0xCF, 0x82, 0x69, 0x0C, 0x1B, 0xF3, 0xB7,
-    0xBB, 0xB3, 0x52, 0x0D, 0xD7, 0x68, 0xE9, 0x99, 0x5F, 0x75, 0xDC, 0x62, 0xF2, 0x08, 0xA7, 0x4B,
-    0x05, 0xC5, 0x5B, 0x5C, 0xA2, 0x04, 0x13, 0x69, 0x3B, 0xC3, 0xCE, 0xE5, 0x56, 0x11, 0x8E, 0x65,
-    0x41, 0x09, 0x4E, 0x15, 0x1F, 0x32, 0x0F, 0x4B, 0x04, 0xE6, 0xD3, 0xE6, 0x16, 0x05, 0xD5, 0xA3,
-    0x93, 0x7C, 0x70, 0x74, 0x23, 0xE7, 0x95, 0x58, 0xE9, 0xE7, 0x43, 0xBD, 0x8A, 0x68, 0x80, 0xF4,
-    0x0F, 0x04, 0xD4, 0xB8, 0x22, 0xAC, 0x43, 0x4D, 0x4D, 0xC4, 0x8B, 0x6A, 0x6C, 0x01, 0x15, 0xFF,
-    0x29, 0x0C, 0x80, 0x5C, 0x19, 0xB3, 0x08, 0x3A, 0xFA, 0x9F, 0x45, 0xA4, 0xC8, 0x4A, 0x44, 0x5B,
-    0x6F, 0x77, 0x55, 0xC1, 0x4A, 0x00, 0xB1, 0x06, 0x22, 0xAC, 0x58, 0x15, 0x1F, 0xCE, 0x0D, 0xCC,
-    0x44, 0x5C, 0x33, 0xA4, 0x89, 0xC1, 0x1C, 0x47, 0x39, 0x2C, 0x2D, 0x77, 0x0D, 0x57, 0xB8, 0xEB,
-    0x92, 0xA9, 0xC3, 0x9E, 0x32, 0x43, 0xA8, 0xBF, 0x22, 0x71, 0x77, 0x1B, 0x3A, 0x2D, 0x88, 0x73,
-    0x1C, 0x17, 0x38, 0x02, 0xB7, 0x61, 0x0C, 0xA0, 0xA4, 0x0B, 0x3F, 0xA7, 0x53, 0x21, 0x85, 0x5D,
-    0xD0, 0x92, 0xA9, 0x13, 0xE5, 0x86, 0x64, 0xED, 0x3E, 0x71, 0x27, 0x4A, 0x7B, 0x82, 0x13, 0x50,
-    0x0E, 0xA1, 0x19, 0x8A, 0xA9, 0xD5, 0xBE, 0xF8, 0xF3, 0x54, 0xB6, 0xD3, 0xC6, 0x1E, 0xA0, 0x4A,
-    0x67, 0x4E, 0x98, 0xAA, 0x18, 0x1A, 0x29, 0x99, 0x93, 0xE0, 0x27, 0x3A, 0xB8, 0x90, 0xC4, 0xF2,
-    0xF1, 0xA9, 0xF1, 0x41, 0x68, 0xA2, 0xAE, 0x47, 0x2F, 0x89, 0x75, 0x10, 0xB4, 0xBF, 0x2A, 0x64,
-    0xDB, 0xCF, 0xE6, 0x74, 0x4A, 0xF0, 0x47, 0x66, 0x3A, 0x3D, 0x2B, 0x54, 0x15, 0x1A, 0xB4, 0xFF,
-    0x2A, 0x20, 0xAE, 0xBA, 0xD3, 0x9F, 0x77, 0x88, 0xA3, 0x48, 0xF2, 0x0B, 0x51, 0xCF, 0xFC, 0x9F,
-    0xCA, 0xB6, 0xFC, 0xDB, 0x2F, 0xCE, 0xF1, 0xB1, 0x19, 0xD4, 0x5B, 0x91, 0x00, 0x00, 0x47, 0x64,
-    0x3D, 0xD2, 0x76, 0xD8, 0xC1, 0xAA, 0x76, 0xB0, 0xAA, 0x1D, 0xEB, 0xDA, 0x82, 0x0E, 0x20, 0xA0,
-    0x0C, 0x72, 0xF9, 0x8E, 0x07, 0x15, 0xCB, 0x21, 0x80, 0x3A, 0x87, 0x9E, 0xBC, 0x07, 0x2F, 0x53,
-    0xE9, 0x2C, 0x5E, 0x84, 0x03, 0x02, 0x52, 0xBA, 0x01, 0x2D, 0x8B, 0xDA, 0x20, 0xC8, 0x1F, 0x14,
-    0x72, 0x66, 0x31, 0xCE, 0x6D, 0xBA, 0xBB, 0x97, 0x4F, 0x04, 0x96, 0x10, 0x91, 0xD0, 0x8E, 0x60,
-    0xE3, 0x85, 0x72, 0x4F, 0x5F, 0x6E, 0xE9, 0xE2, 0x8E, 0xA7, 0x2C, 0xE8, 0xF6, 0x16, 0xF2, 0xFF,
-    0xB2, 0xE2, 0xC3, 0x4B, 0xA5, 0x52, 0x43, 0x17, 0x8F, 0x09, 0xC0, 0x86, 0x04, 0xC4, 0x73, 0x39,
-    0xAF, 0xAB, 0xC6, 0x57, 0xD5, 0xAB, 0x8F, 0xC2, 0xF0, 0x95, 0x07, 0xA0, 0x11, 0x01, 0xC7, 0xA1,
-    0x3A, 0x01, 0x4E, 0xFF, 0x88, 0x7A, 0x7B, 0x6E, 0x4F, 0xF5, 0xAC, 0x33, 0x5F, 0xAA, 0x95, 0x3D,
-    0x7F, 0x24, 0xB3, 0x94, 0x73, 0x79, 0x7A, 0x41, 0x6E, 0xF0, 0x4E, 0xE6, 0x2E, 0x86, 0x6D, 0x2A,
-    0x48, 0xD8, 0x32, 0x04, 0x09, 0xEB, 0x94, 0xB6, 0x84, 0x85, 0xD0, 0x08, 0x10, 0x62, 0xDC, 0x69,
-    0x79, 0x64, 0x6A, 0x45, 0x03, 0x0D, 0xC2, 0x1C, 0x66, 0x03, 0xF0, 0xD4, 0x25, 0x99, 0xAE, 0x80,
-    0x29, 0xC6, 0x51, 0x39, 0xED, 0xA5, 0x6A, 0x50, 0xB9, 0x95, 0x57, 0x38, 0x95, 0xF0, 0xC9, 0x4A,
-    0x98, 0x67, 0x19, 0x39, 0xB3, 0x0C, 0x5E, 0x12, 0x9C, 0x24, 0x7C, 0x01, 0x13, 0xA3, 0xA1, 0x92,
-    0x91, 0x5D, 0x66, 0x98, 0x3F, 0x1D, 0x2B, 0x98, 0x0E, 0x57, 0x6E, 0x08, 0xCE, 0x9C, 0x8A, 0xE0,
-    0x92, 0xF3, 0x94, 0xEF, 0xD5, 0x46, 0xA6, 0x7B, 0xB1, 0x72, 0xAA, 0xC1, 0xFC, 0xEB, 0x42, 0x45,
-    0x2E, 0x89, 0x12, 0xBC, 0x8F, 0x8C, 0x81, 0x66, 0x22, 0xAF, 0x85, 0xC6, 0x66, 0x86, 0x39, 0x99,
-    0xBC, 0x55, 0xD1, 0x4C, 0x6B, 0x9D, 0x43, 0x87, 0x97, 0xDF, 0xD3, 0x98, 0x4C, 0x90, 0x32, 0x26,
-    0x53, 0x06, 0x31, 0x9D, 0x41, 0x45, 0x48, 0x1E, 0x08, 0x45, 0x42, 0x16, 0x77, 0x36, 0x11, 0x35,
-    0x22, 0x11, 0xBC, 0x99, 0xC3, 0x92, 0x9C, 0xC3, 0x8E, 0x1D, 0x1B, 0x6F, 0x6E, 0x97, 0xA6, 0xF8,
-    0xE9, 0xCC, 0xE6, 0x30, 0x09, 0xD2, 0xC1, 0xCD, 0xBD, 0x5C, 0x59, 0x14, 0xC8, 0x67, 0xA8, 0xA1,
-    0xB4, 0x73, 0xB3, 0xD8, 0xCC, 0xE4, 0x3C, 0x38, 0xE9, 0xCC, 0x9E, 0x03, 0x8D, 0x6A, 0x5A, 0xD4,
-    0xEF, 0x3B, 0x0B, 0xC6, 0x58, 0x78, 0x70, 0xCF, 0xD3, 0x1A, 0xF7, 0x96, 0xB1, 0x62, 0x88, 0xD4,
-    0x00, 0x22, 0x47, 0x40, 0x67, 0x45, 0x4E, 0xD4, 0xBB, 0x65, 0xF7, 0x71, 0xAB, 0xB1, 0x4A, 0xFD,
-    0x08, 0xDC, 0x64, 0x07, 0x5C, 0x64, 0x04, 0xDF, 0x6C, 0xD4, 0x13, 0x53, 0x68, 0x89, 0xA9, 0xB0,
-    0x8B, 0xF5, 0x52, 0x1F, 0x4A, 0x12, 0xB4, 0xBE, 0x7C, 0xDA, 0x79, 0x2B, 0xF6, 0xAE, 0xAE, 0x00,
-    0xFA, 0x61, 0xAF, 0x60, 0x1F, 0x10, 0x1A, 0xAB, 0x29, 0x91, 0xA8, 0x33, 0x85, 0x5A, 0xAF, 0x5B,
-    0x51, 0x63, 0x14, 0x1A, 0x1D, 0xDC, 0x99, 0xDB, 0x95, 0x0D, 0x31, 0x78, 0x39, 0x79, 0xF1, 0xC4,
-    0x74, 0xCA, 0x9D, 0x4C, 0x4A, 0x46, 0x4A, 0x2E, 0x4A, 0xFF, 0x49, 0xA4, 0xA2, 0x84, 0xF6, 0x20,
-    0x85, 0x9C, 0x30, 0xB5, 0x83, 0x05, 0x15, 0xC7, 0x09, 0x15, 0xC7, 0xC6, 0xA8, 0x3E, 0x83, 0x11,
-    0xF7, 0x85, 0x4E, 0xA3, 0x1A, 0x8D, 0xEE, 0x53, 0x36, 0x4A, 0xB2, 0x8B, 0x55, 0x25, 0x56, 0xC7,
-    0x0C, 0xFC, 0xF2, 0x13, 0x6C, 0xF6, 0x73, 0xEA, 0x98, 0xA6, 0x36, 0x9B, 0x64, 0x4B, 0xC6, 0x07,
-    0xC4, 0x70, 0x65, 0x32, 0xB1, 0x02, 0x07, 0x32, 0x9B, 0x70, 0x63, 0x5F, 0x2E, 0x1F, 0x89, 0xDA,
-    0x23, 0x9A, 0xD4, 0x5D, 0x59, 0xDB, 0xD8, 0xB8, 0x1F, 0xE6, 0x66, 0x2C, 0x7A, 0xD4, 0x87, 0x82,
-    0xB6, 0xA2, 0x46, 0xFD, 0xB2, 0x1C, 0xFC, 0x56, 0xB4, 0xA8, 0xFF, 0x53, 0x0E, 0xDF, 0xAD, 0x04,
-    0x43, 0x4A, 0xFF, 0x2D, 0x40, 0xBB, 0x0A, 0x09, 0xEF, 0x7A, 0x07, 0x9A, 0x60, 0xFA, 0x46, 0x23,
-    0xA8, 0x13, 0xC4, 0xFB, 0x95, 0xCC, 0x1F, 0xC8, 0xAC, 0xD8, 0xA9, 0xF0, 0x2F, 0x42, 0x3E, 0x4A,
-    0x45, 0xDB, 0xDD, 0xD1, 0x10, 0xA0, 0x40, 0xD2, 0x2D, 0x35, 0xC2, 0x61, 0x5D, 0xEC, 0xDC, 0xD6,
-    0xD2, 0xF2, 0x95, 0xE1, 0xCE, 0xEE, 0x1E, 0x44, 0x77, 0x9B, 0xC2, 0x53, 0xA1, 0xBA, 0xCB, 0xDA,
-    0x09, 0x52, 0x19, 0x1B, 0xAB, 0x26, 0xD2, 0x1D, 0x63, 0xBD, 0xC2, 0xEC, 0xC0, 0xED, 0x0C, 0xD8,
-    0x9D, 0xE5, 0xD3, 0xB9, 0x3A, 0x1F, 0x96, 0xC1, 0xBD, 0x25, 0xA3, 0x88, 0x40, 0xC7, 0x23, 0x0C,
-    0x93, 0x4E, 0xAD, 0x13, 0x6E, 0x11, 0x59, 0x7E, 0x9A, 0x6D, 0xE5, 0xA7, 0xE6, 0x4A, 0x20, 0x47,
-    0x3D, 0x9E, 0x09, 0x0C, 0x8F, 0x0E, 0x05, 0x8A, 0xAD, 0xC8, 0x4B, 0xA7, 0x55, 0xA5, 0x4A, 0x56,
-    0x5F, 0x5B, 0x0B, 0x3E, 0xED, 0xD4, 0xAF, 0xC8, 0x9C, 0xB0, 0x85, 0xA6, 0x8B, 0x4E, 0xC0, 0x4D,
-    0xB8, 0x74, 0xCA, 0x06, 0xB0, 0x2F, 0xC3, 0x40, 0x68, 0x6B, 0x67, 0x74, 0x19, 0x5E, 0x3F, 0x78,
-    0x3E, 0x32, 0x59, 0xD6, 0x0C, 0x8E, 0x9D, 0x05, 0x3E, 0x3D, 0xC7, 0xD0, 0xA8, 0xF9, 0xE5, 0x56,
-    0x2E, 0x54, 0x5D, 0x99, 0x77, 0x88, 0x4F, 0x8A, 0x18, 0x14, 0x96, 0x93, 0x89, 0x6E, 0x91, 0xC4,
-    0xDE, 0xED, 0x67, 0x44, 0xD9, 0x7B, 0x07, 0x82, 0xE5, 0xAD, 0x16, 0xFA, 0xED, 0x93, 0x5D, 0x9A,
-    0xC2, 0x89, 0xE1, 0x53, 0xB3, 0x64, 0x87, 0x05, 0xA5, 0x46, 0xFB, 0x42, 0x01, 0x34, 0x85, 0xF9,
-    0x46, 0xF5, 0x60, 0x25, 0xAE, 0xDE, 0x69, 0x60, 0xDD, 0x6B, 0xC9, 0x0E, 0x9F, 0x22, 0x87, 0xDD,
-    0x64, 0x87, 0x57, 0x02, 0xD9, 0x83, 0x60, 0x56, 0xD2, 0x0E, 0x85, 0x17, 0x1E, 0xDE, 0x49, 0x2E,
-    0xFF, 0xF7, 0x46, 0x58, 0x64, 0x30, 0x16, 0x7A, 0x6A, 0x61, 0x26, 0x36, 0x50, 0x4B, 0x45, 0x3C,
-    0x41, 0xAF, 0xC8, 0x3A, 0xBD, 0xB0, 0x26, 0xE7, 0x76, 0x2A, 0x42, 0x52, 0xF8, 0x72, 0x4E, 0x66,
-    0x4E, 0xDD, 0x94, 0x97, 0xB1, 0x60, 0x10, 0x75, 0x53, 0xD1, 0x63, 0x62, 0xAA, 0x99, 0xA1, 0x7A,
-    0x6B, 0x22, 0x35, 0xEB, 0x22, 0x6B, 0xD1, 0x45, 0x66, 0x99, 0x5D, 0xA0, 0x11, 0x0B, 0x75, 0x94,
-    0xA9, 0x6F, 0x2D, 0x48, 0xC1, 0x02, 0x19, 0x0E, 0x56, 0x9B, 0xCC, 0xFA, 0x3E, 0x3D, 0x90, 0xB0,
-    0x51, 0xD7, 0xFB, 0x90, 0x8E, 0xF8, 0xE1, 0xCF, 0xC0, 0xB8, 0x07, 0xFF, 0xCC, 0x54, 0x24, 0x44,
-    0xC6, 0x84, 0xEA, 0xC9, 0x82, 0x68, 0x07, 0xAA, 0x3F, 0x5C, 0xCF, 0x52, 0x03, 0xC7, 0xB4, 0xC6,
-    0xD4, 0xC1, 0xA2, 0x82, 0xED, 0xBA, 0x72, 0x74, 0x62, 0xEC, 0xAC, 0x73, 0xA3, 0x3D, 0x7F, 0xCC,
-    0x70, 0xAC, 0x37, 0x6F, 0xA4, 0x23, 0x2D, 0x3C, 0xB7, 0x0B, 0x22, 0x41, 0xA1, 0xFA, 0xBB, 0xDB,
-    0xA2, 0x8E, 0xD5, 0xFE, 0x4F, 0x64, 0xEB, 0x02, 0x08, 0xD1, 0x1F, 0x64, 0xF9, 0x23, 0x7A, 0x02,
-    0x22, 0xFB, 0xDF, 0x88, 0xD4, 0x37, 0x61, 0x28, 0x65, 0x42, 0x4C, 0x9F, 0x98, 0x86, 0x81, 0x8A,
-    0x86, 0xFA, 0x1C, 0x14, 0xC6, 0xF0, 0xCD, 0x4A, 0xA4, 0xA3, 0x7F, 0x74, 0x67, 0xC6, 0xB8, 0xDA,
-    0xBC, 0x93, 0xCB, 0x3A, 0xA1, 0xDD, 0xC5, 0x5A, 0xD8, 0x30, 0x5B, 0x1A, 0x32, 0xCA, 0x5C, 0xD4,
-    0x65, 0x40, 0xDA, 0x1E, 0x29, 0xD5, 0x89, 0xC2, 0x15, 0xC4, 0x53, 0xC4, 0x3A, 0x1A, 0xEB, 0x48,
-    0xA1, 0x07, 0x45, 0x1D, 0x28, 0xCC, 0x62, 0x99, 0xD3, 0xEF, 0x8C, 0x1B, 0xDD, 0xC6, 0x1D, 0x10,
-    0x8B, 0x84, 0x9A, 0x3E, 0xC0, 0x71, 0x7B, 0x05, 0x3D, 0x61, 0x4E, 0xA5, 0xCE, 0x9B, 0x8F, 0xCB,
-    0xE3, 0x7B, 0xE6, 0xC0, 0x58, 0xC8, 0x0A, 0x8F, 0xAF, 0xC0, 0xE3, 0x45, 0x6B, 0x6A, 0x7F, 0x21,
-    0x5A, 0x44, 0x1B, 0xCB, 0x62, 0x2E, 0x6E, 0xCD, 0x2A, 0xF8, 0x16, 0xE3, 0x5C, 0xA0, 0x56, 0x48,
-    0x8C, 0x88, 0x11, 0x4B, 0x87, 0x46, 0xC3, 0x48, 0xD4, 0x4A, 0xD9, 0x62, 0x99, 0x08, 0xA7, 0x8B,
-    0x3E, 0xB8, 0x5B, 0x04, 0xED, 0x3F, 0x15, 0xEE, 0xE1, 0x6A, 0x1E, 0x4A, 0x97, 0x83, 0xA2, 0xF4,
-    0x82, 0xD4, 0x8E, 0x94, 0x08, 0xBD, 0xB4, 0x77, 0xEA, 0x25, 0x42, 0x03, 0x45, 0xBD, 0x6C, 0x05,
-    0xAF, 0x0B, 0x7A, 0x78, 0x7A, 0xBC, 0x0E, 0x15, 0xAF, 0xC9, 0x9B, 0x88, 0xD0, 0x72, 0x5C, 0xA9,
-    0xCA, 0x10, 0x11, 0xF4, 0xBE, 0x28, 0x42, 0xA2, 0xFE, 0x44, 0x95, 0x70, 0xF5, 0xE8, 0xA5, 0x3B,
-    0x4D, 0x20, 0x5A, 0xA9, 0xD8, 0x9F, 0x8B, 0x1D, 0xA8, 0x34, 0x49, 0x75, 0x1E, 0x22, 0xEC, 0x94,
-    0xCA, 0xC8, 0x3F, 0xE0, 0x22, 0xF6, 0x62, 0x2E, 0x22, 0xAC, 0xB9, 0x08, 0xD1, 0x95, 0xB1, 0x08,
-    0x45, 0xE1, 0xFE, 0xA2, 0x46, 0x82, 0x22, 0x98, 0x39, 0x9D, 0x86, 0xC0, 0x0D, 0xDA, 0xBF, 0x5F,
-    0x9A, 0x6D, 0xF3, 0x6F, 0x3A, 0xC4, 0xC9, 0xDA, 0x0A, 0xCB, 0x49, 0x9C, 0xA4, 0x6A, 0x55, 0x1E,
-    0x1B, 0x44, 0x4C, 0xCF, 0xE2, 0x19, 0xEE, 0x35, 0xEF, 0x6C, 0x91, 0x27, 0xD5, 0x15, 0xE3, 0x54,
-    0x2E, 0x03, 0x20, 0x9A, 0x3E, 0xA4, 0x23, 0xE6, 0x1F, 0x14, 0x8C, 0x23, 0xE4, 0xFE, 0x9B, 0x30,
-    0x48, 0xC0, 0xBC, 0xFC, 0x0C, 0x89, 0x59, 0x62, 0x0B, 0x5D, 0x0D, 0x0A, 0x48, 0x6F, 0xA8, 0x5A,
-    0xF0, 0xAD, 0x85, 0x04, 0x94, 0xFA, 0xD9, 0xE0, 0xCD, 0xF6, 0x0A, 0xE0, 0x7A, 0x28, 0x6C, 0x02,
-    0xB2, 0x62, 0x4C, 0x61, 0xD1, 0x58, 0xB6, 0xE7, 0x96, 0xEB, 0x89, 0x4A, 0xD0, 0xAE, 0x3C, 0x22,
-    0x48, 0x4C, 0x06, 0x29, 0xAA, 0x70, 0x16, 0x5E, 0x0D, 0x4A, 0xBD, 0xA3, 0x5B, 0xE9, 0x4B, 0xE6,
-    0x10, 0xF9, 0x03, 0x75, 0xDE, 0xEB, 0x55, 0x6F, 0x9B, 0xE8, 0x20, 0x3A, 0x19, 0x52, 0x88, 0x06,
-    0x37, 0x67, 0x99, 0x3A, 0x6E, 0x07, 0xCB, 0x19, 0x76, 0x5F, 0x14, 0x66, 0xDD, 0x96, 0x2E, 0x9D,
-    0x26, 0x9B, 0xA9, 0x51, 0x51, 0xFC, 0x57, 0xA7, 0x17, 0xD4, 0xB1, 0xC3, 0x76, 0xC5, 0x44, 0xA1,
-    0x66, 0x03, 0x65, 0x1D, 0x81, 0x88, 0x96, 0x89, 0x3E, 0xB3, 0xD7, 0xE6, 0xAA, 0xDF, 0x08, 0xCD,
-    0x59, 0xD6, 0x5B, 0xD3, 0x87, 0x40, 0x24, 0x11, 0x38, 0x1C, 0x5E, 0x86, 0x32, 0x41, 0x43, 0x5F,
-    0xD6, 0x49, 0xD3, 0x55, 0x36, 0x46, 0xD1, 0xEA, 0x65, 0xF4, 0x8E, 0x08, 0xD0, 0xC4, 0xC0, 0xA6,
-    0x7F, 0x4B, 0xEE, 0x83, 0xEC, 0x1A, 0xE0, 0x4A, 0xEC, 0x55, 0x62, 0x20, 0x84, 0xEA, 0x22, 0x40,
-    0x64, 0x7C, 0xAE, 0x7B, 0xB2, 0x9E, 0x4F, 0x1B, 0x8E, 0x0D, 0x8F, 0xAE, 0x17, 0x90, 0xBF, 0xE0,
-    0xF2, 0x32, 0xDF, 0x58, 0xBD, 0x0F, 0xA4, 0x6B, 0x41, 0xDE, 0xE8, 0xE6, 0x1E, 0x20, 0xD7, 0xD2,
-    0xE5, 0x0F, 0xAD, 0x15, 0xAA, 0x15, 0x22, 0x55, 0x09, 0x04, 0xD0, 0x1C, 0xBC, 0x07, 0x6A, 0x93,
-    0x0F, 0x2F, 0x56, 0x48, 0xE7, 0xAF, 0x7B, 0xD5, 0x74, 0xE1, 0x23, 0xCD, 0xDB, 0xF9, 0xCA, 0x7A,
-    0xE6, 0xCB, 0x27, 0xAD, 0xF5, 0x7B, 0x59, 0x4D, 0x6F, 0xA6, 0x9F, 0xD6, 0x6B, 0xEE, 0xDE, 0x4F,
-    0x72, 0x1E, 0x82, 0xAC, 0xF7, 0xEF, 0x39, 0x7B, 0xEF, 0x5D, 0x54, 0x87, 0xCB, 0x80, 0x7E, 0xE3,
-    0x15, 0x37, 0x91, 0xF3, 0x03, 0xF8, 0x63, 0x05, 0x50, 0x0D, 0xE3, 0xD6, 0x95, 0x28, 0x34, 0x30,
-    0x99, 0x9C, 0x45, 0xAF, 0xAC, 0xF4, 0x4A, 0x17, 0xB8, 0x29, 0x4C, 0xE7, 0x6D, 0xDC, 0x94, 0x39,
-    0x5B, 0x7D, 0x2A, 0xC5, 0x89, 0xD9, 0x09, 0x10, 0xA0, 0x67, 0x80, 0x98, 0x1E, 0x83, 0x7E, 0x3C,
-    0x5E, 0xE7, 0x87, 0x6A, 0x22, 0x42, 0x7D, 0x00, 0x2B, 0xBC, 0xB2, 0x9E, 0x37, 0xF5, 0x49, 0x9A,
-    0x92, 0xF7, 0x53, 0x5A, 0x76, 0x9F, 0x27, 0x3F, 0x48, 0xDA, 0xE6, 0x3E, 0x4A, 0xCB, 0x7C, 0x79,
-    0x9A, 0xE1, 0x22, 0x16, 0x9A, 0x2A, 0x06, 0x87, 0x97, 0x32, 0xD9, 0x1D, 0x40, 0xA3, 0xF1, 0x46,
-    0xAC, 0x16, 0xE2, 0x1E, 0xB4, 0x14, 0xCA, 0xE2, 0x06, 0x73, 0x6B, 0x27, 0x75, 0xAB, 0x4B, 0x4C,
-    0x25, 0xA2, 0x0D, 0x11, 0x97, 0xCE, 0x46, 0x32, 0xA7, 0x35, 0x32, 0x29, 0xEA, 0x76, 0xBC, 0x4A,
-    0x7D, 0xCB, 0xC8, 0x69, 0xBD, 0x96, 0x21, 0x29, 0x07, 0x22, 0xC7, 0xB1, 0x99, 0x21, 0xA9, 0x77,
-    0xFF, 0xFA, 0xD7, 0x45, 0x2F, 0x87, 0xFF, 0xFC, 0xB7, 0xE5, 0xDA, 0xAD, 0xC6, 0xDB, 0x32, 0x2D,
-    0x8B, 0xCD, 0x4C, 0xCB, 0x20, 0x5E, 0x06, 0x8C, 0xE5, 0x84, 0x52, 0xDD, 0x0F, 0x82, 0x17, 0x9A,
-    0x1B, 0xB4, 0xFC, 0x01, 0x03, 0x0E, 0xCD, 0x71, 0x85, 0xCF, 0xBA, 0xDB, 0xCC, 0x09, 0xF9, 0x98,
-    0x4B, 0x36, 0xB7, 0x3D, 0x1F, 0x53, 0x14, 0x82, 0x6F, 0x37, 0x8C, 0xAE, 0xCA, 0x29, 0x6A, 0x4E,
-    0x0A, 0x75, 0xA7, 0x99, 0xDA, 0xBA, 0x8B, 0x83, 0xB9, 0x6A, 0x41, 0x8D, 0xE9, 0xCC, 0x20, 0xCD,
-    0xC3, 0xC1, 0xC5, 0xAD, 0xCE, 0x62, 0x12, 0x17, 0x08, 0x4D, 0x57, 0x16, 0x31, 0xB8, 0x1A, 0x36,
-    0xAA, 0x11, 0xCC, 0x61, 0x0D, 0xE5, 0x44, 0x56, 0x2F, 0x67, 0x92, 0x21, 0xA3, 0x6B, 0xF0, 0x6B,
-    0x38, 0x8D, 0x58, 0x44, 0x83, 0x7A, 0x58, 0x89, 0x49, 0x84, 0x43, 0x4D, 0xE8, 0x67, 0xE5, 0x59,
-    0x20, 0x64, 0xB8, 0xAF, 0xBB, 0x1F, 0xAB, 0xA6, 0xD3, 0x28, 0x7D, 0xE9, 0x45, 0x73, 0x2E, 0x19,
-    0x22, 0x8D, 0x35, 0x2F, 0xA6, 0x4B, 0x83, 0xBC, 0xA6, 0x97, 0x85, 0x19, 0x1E, 0x1D, 0xCC, 0x0E,
-    0x68, 0xAB, 0xC8, 0xD4, 0x19, 0xE5, 0x27, 0xF3, 0x0B, 0xC7, 0xEA, 0xE5, 0x9F, 0x28, 0x4F, 0x44,
-    0x3C, 0x06, 0x8C, 0x32, 0x9D, 0x31, 0xEB, 0x51, 0xB6, 0x8B, 0x08, 0xAB, 0xF5, 0x95, 0x9D, 0x7B,
-    0x30, 0xCA, 0xA6, 0x66, 0xB2, 0x3F, 0x14, 0xA4, 0x1F, 0x23, 0x5B, 0xB5, 0x59, 0x08, 0xC5, 0xB5,
-    0x39, 0xFC, 0xA3, 0x9A, 0x04, 0x25, 0x96, 0xD4, 0x03, 0x51, 0xF6, 0x4E, 0xAF, 0x27, 0xAD, 0x53,
-    0xB6, 0x66, 0x6E, 0x33, 0x14, 0x38, 0xEA, 0xBD, 0x54, 0xCC, 0x05, 0x59, 0x4B, 0x82, 0x78, 0x78,
-    0x06, 0xB1, 0x26, 0x5D, 0x36, 0xFD, 0x5E, 0x03, 0xF5, 0x00, 0x60, 0x19, 0xD9, 0x1F, 0xD0, 0xE2,
-    0x17, 0x56, 0xF5, 0x06, 0xF7, 0x49, 0x97, 0x23, 0xFD, 0xB8, 0xD4, 0x4F, 0x8E, 0x65, 0x1F, 0x3E,
-    0xCE, 0x86, 0xC5, 0xC3, 0x06, 0xD2, 0xF0, 0x24, 0x3B, 0xF2, 0x87, 0xFA, 0x3E, 0x92, 0x09, 0x0A,
-    0xCD, 0x3B, 0x1E, 0x16, 0x89, 0x4D, 0xF9, 0xD2, 0xFC, 0x63, 0x3F, 0x9B, 0xEA, 0x47, 0xEC, 0x35,
-    0x8C, 0xA7, 0x16, 0x8E, 0x53, 0x6E, 0x27, 0xC1, 0x95, 0x91, 0xF2, 0x29, 0xDD, 0x15, 0xC8, 0x01,
-    0x10, 0x78, 0x08, 0x60, 0xA7, 0xB2, 0x02, 0xB5, 0x31, 0x82, 0x04, 0x86, 0x7A, 0x62, 0xA2, 0x48,
-    0xBD, 0x04, 0xFB, 0xCC, 0x51, 0x11, 0x7B, 0x86, 0xD8, 0x15, 0xB9, 0x25, 0x75, 0x83, 0xE8, 0xD9,
-    0x82, 0xF1, 0xC5, 0xF0, 0x95, 0xCC, 0x47, 0x44, 0x37, 0xF8, 0x7E, 0xEC, 0xC1, 0x14, 0xF1, 0x6F,
-    0x33, 0x51, 0x07, 0xE9, 0xF4, 0x4C, 0x73, 0xF4, 0x1A, 0x05, 0xB8, 0xDC, 0xDA, 0x59, 0x0D, 0x9E,
-    0x8F, 0x34, 0x80, 0xB4, 0xCF, 0x4B, 0x3A, 0xD1, 0xA0, 0xE0, 0x44, 0x33, 0x23, 0x26, 0xE0, 0x1A,
-    0x3B, 0xB0, 0x41, 0x41, 0xF9, 0xE3, 0x8E, 0xDB, 0xF8, 0xB9, 0x53, 0x31, 0x99, 0x90, 0xF1, 0xA9,
-    0xA4, 0xA0, 0x3A, 0xF3, 0x11, 0x14, 0xEA, 0x9D, 0xC1, 0x87, 0x25, 0x42, 0x49, 0xC3, 0xB7, 0x4A,
-    0x44, 0xFA, 0xFC, 0x67, 0x4A, 0xAC, 0x6C, 0xE4, 0xFC, 0x5F, 0x39, 0xD8, 0xA0, 0x61, 0xAC, 0x58,
-    0x74, 0x65, 0x4A, 0xD1, 0x42, 0x4F, 0x35, 0x58, 0x72, 0xCE, 0x73, 0xB3, 0xDD, 0x8B, 0x48, 0xAB,
-    0x9C, 0x81, 0x1D, 0xCC, 0x57, 0x98, 0x30, 0x14, 0x9D, 0xC5, 0x8F, 0xC8, 0x26, 0xE4, 0x25, 0xFA,
-    0x9A, 0x8B, 0xD4, 0xCC, 0x05, 0xD4, 0x79, 0xDF, 0xBE, 0x10, 0x6F, 0x41, 0x94, 0x05, 0x69, 0x90,
-    0xD1, 0x41, 0x5B, 0x88, 0xC6, 0x11, 0x27, 0x1A, 0xEF, 0xE0, 0x51, 0x5E, 0xF1, 0x89, 0x66, 0x63,
-    0x4D, 0xA2, 0x98, 0xCF, 0xF7, 0x32, 0xCA, 0x37, 0x88, 0x50, 0x87, 0xEE, 0x74, 0xD8, 0x6A, 0xB8,
-    0x0C, 0x94, 0x29, 0x82, 0xC1, 0xFC, 0xC3, 0x45, 0xDA, 0xD6, 0x22, 0x85, 0x87, 0x4C, 0xFA, 0x84,
-    0x90, 0x94, 0x23, 0x28, 0x94, 0xA0, 0x0B, 0x9E, 0xC5, 0x40, 0x2F, 0x34, 0x23, 0x22, 0x68, 0xCA,
-    0x31, 0x5C, 0xB0, 0x59, 0xA4, 0x7A, 0x5C, 0x04, 0x63, 0xB0, 0x36, 0xC6, 0xAC, 0xFB, 0x4D, 0x43,
-    0x5B, 0x1B, 0x11, 0x75, 0xF9, 0x7D, 0xB2, 0x94, 0x5B, 0x37, 0xA0, 0x89, 0x88, 0xA4, 0x75, 0xE8,
-    0xE0, 0x2A, 0xD5, 0xD6, 0x64, 0x44, 0x45, 0xB9, 0x97, 0x51, 0x24, 0x51, 0xA6, 0x65, 0xA9, 0x85,
-    0x39, 0x02, 0x22, 0xAB, 0xAF, 0x2F, 0x90, 0xBE, 0xA7, 0x29, 0xEB, 0xA6, 0xBF, 0x0E, 0x8B, 0xA1,
-    0xA5, 0xA4, 0xA1, 0xCD, 0xF1, 0x56, 0x5B, 0x44, 0xAE, 0xA5, 0x1A, 0xB7, 0x4A, 0x69, 0x42, 0xC9,
-    0x95, 0x9A, 0xB9, 0x4A, 0x85, 0x11, 0x31, 0x93, 0xD7, 0xD9, 0xCD, 0x4B, 0x8C, 0x56, 0x84, 0x36,
-    0xC5, 0xE4, 0x74, 0x57, 0x17, 0x74, 0x2A, 0x5E, 0x53, 0xB1, 0xE1, 0xD3, 0xF3, 0x5B, 0x18, 0xDD,
-    0xC9, 0x7B, 0xDF, 0xD4, 0x88, 0x8D, 0xA9, 0xDD, 0xBA, 0x0B, 0x9E, 0x43, 0x23, 0x94, 0x75, 0x1D,
-    0x5E, 0xBE, 0xB9, 0xAB, 0xAB, 0x83, 0x66, 0x0D, 0xB8, 0xE6, 0x90, 0x3C, 0x1E, 0x64, 0x88, 0x4A,
-    0x12, 0xA3, 0xD1, 0x19, 0x51, 0xAA, 0xA9, 0x51, 0x79, 0xF5, 0xE9, 0x2C, 0x44, 0xCA, 0x05, 0x78,
-    0x8A, 0x4A, 0x33, 0xCD, 0x7F, 0xD1, 0xA4, 0x5E, 0x85, 0x4E, 0xC2, 0x91, 0xCC, 0xCB, 0xF9, 0x88,
-    0x69, 0x0C, 0x1F, 0x32, 0x4C, 0x4C, 0x7E, 0x13, 0xBC, 0x8C, 0x2D, 0x46, 0x4C, 0xB2, 0x1E, 0x71,
-    0x6C, 0xAF, 0x57, 0xCC, 0xE0, 0xAA, 0x09, 0x28, 0x19, 0xFD, 0x77, 0x81, 0xA4, 0xF2, 0x41, 0x84,
-    0xD4, 0x07, 0x85, 0x68, 0x19, 0xD3, 0x61, 0xBE, 0x8F, 0xF4, 0xDF, 0x0C, 0xB1, 0x75, 0x2F, 0xDB,
-    0x61, 0x36, 0x22, 0x78, 0x89, 0xE6, 0x37, 0xC1, 0x52, 0x82, 0x85, 0x04, 0x32, 0x61, 0x01, 0x80,
-    0x16, 0xC2, 0xF8, 0x00, 0x5E, 0x80, 0x61, 0x07, 0x7A, 0xE0, 0x18, 0x4A, 0x6E, 0xBD, 0x03, 0x82,
-    0x93, 0x61, 0x78, 0x33, 0x31, 0xAA, 0xDA, 0x87, 0xCC, 0x47, 0x0C, 0xE1, 0xE3, 0x8B, 0x90, 0xE2,
-    0xB0, 0x03, 0x37, 0xE7, 0xBE, 0x9C, 0x49, 0x3E, 0x86, 0x4C, 0x1D, 0xC3, 0xCA, 0xA8, 0x91, 0x4F,
-    0x45, 0xBB, 0x44, 0xA5, 0x53, 0xA4, 0x0A, 0x8C, 0xA6, 0xE4, 0xD1, 0xB1, 0xC7, 0x60, 0xBF, 0x99,
-    0x56, 0xAA, 0x15, 0xD5, 0x1A, 0x34, 0xE6, 0x65, 0x58, 0x36, 0xEA, 0x20, 0x1A, 0x6B, 0xD6, 0x93,
-    0x18, 0x0D, 0x8B, 0x83, 0xD9, 0xAD, 0x79, 0x27, 0xCB, 0x3B, 0x91, 0x5E, 0xB8, 0xD5, 0x38, 0x62,
-    0xC1, 0x40, 0xC3, 0xAD, 0x65, 0x35, 0x12, 0x45, 0x82, 0x97, 0xAA, 0x20, 0x0E, 0xD2, 0xC8, 0x29,
-    0xB1, 0xCF, 0x89, 0x5B, 0xFA, 0x69, 0x78, 0x81, 0x6E, 0xFC, 0x08, 0xB9, 0x7D, 0x72, 0x11, 0xAC,
-    0xCA, 0x05, 0x32, 0x7E, 0xE6, 0x65, 0x5E, 0x3E, 0x41, 0x3C, 0x4D, 0xD6, 0xB9, 0x4F, 0x06, 0x3E,
-    0xA1, 0x5A, 0xDC, 0xD0, 0xE3, 0x2A, 0x96, 0x11, 0x53, 0x65, 0x23, 0xBA, 0xAB, 0xC6, 0x21, 0x16,
-    0x53, 0x0B, 0xA6, 0x1D, 0xBE, 0x78, 0x67, 0x2F, 0xE6, 0x1A, 0xE8, 0xFF, 0x6C, 0x65, 0xDF, 0xE1,
-    0x73, 0xDF, 0x97, 0x9B, 0x45, 0xC1, 0xD7, 0x64, 0x11, 0x4D, 0x20, 0xF6, 0xE9, 0x9B, 0x75, 0x28,
-    0x98, 0xF1, 0x72, 0x29, 0xA7, 0x11, 0x7E, 0x2D, 0xDF, 0x11, 0x8B, 0x51, 0xF8, 0x93, 0x48, 0xDD,
-    0x30, 0x1E, 0x0F, 0xA8, 0xDD, 0x40, 0x3D, 0x72, 0x57, 0x2E, 0xAC, 0x3A, 0x21, 0xD2, 0x4D, 0x34,
-    0x6F, 0x46, 0x33, 0x5F, 0x90, 0x36, 0xA2, 0xC1, 0x15, 0xD2, 0x8D, 0xF7, 0xAE, 0x92, 0xCB, 0x5D,
-    0x62, 0xFD, 0xE7, 0xC8, 0x1D, 0x1C, 0x4D, 0xDE, 0x1B, 0x2E, 0x16, 0x10, 0x29, 0x7E, 0xDE, 0xA8,
-    0x39, 0x09, 0xFE, 0x62, 0x12, 0x9A, 0x86, 0x66, 0xAE, 0x99, 0xDD, 0x0D, 0x4D, 0x69, 0xD8, 0xD6,
-    0x83, 0x82, 0xC6, 0xB5, 0x2D, 0xB7, 0x20, 0xF7, 0x44, 0x18, 0x92, 0x29, 0x84, 0x1A, 0x87, 0x51,
-    0xF7, 0x35, 0x63, 0x81, 0x3A, 0x7A, 0xB7, 0x0E, 0x66, 0x10, 0x16, 0xCC, 0xF7, 0xAA, 0x6C, 0x3E,
-    0x09, 0x30, 0xF6, 0xBC, 0x26, 0x93, 0xCE, 0x97, 0x39, 0x66, 0xB7, 0x3F, 0x90, 0xBF, 0x4E, 0xC1,
-    0xCA, 0x9D, 0xDA, 0x4F, 0xE1, 0x45, 0xF6, 0x63, 0xFA, 0x29, 0xA8, 0x6D, 0x21, 0xA5, 0x12, 0xA9,
-    0x14, 0xFB, 0x8C, 0x95, 0x8D, 0x84, 0x21, 0x30, 0x81, 0x38, 0x64, 0x22, 0x12, 0xE6, 0xEE, 0xAE,
-    0x09, 0xAF, 0x8C, 0xF0, 0x85, 0x19, 0xBF, 0x04, 0x7E, 0x8B, 0x5B, 0x38, 0x8D, 0x26, 0x87, 0x0C,
-    0x35, 0x55, 0xA4, 0xD2, 0x24, 0x39, 0xB0, 0x4E, 0xCD, 0x24, 0x81, 0x47, 0x5E, 0xF8, 0x09, 0x0C,
-    0x0F, 0xE5, 0x24, 0x39, 0xAF, 0xB3, 0xDB, 0xD0, 0xDA, 0xDD, 0x3A, 0x7C, 0xB6, 0xE6, 0xBE, 0x23,
-    0x22, 0x19, 0xE8, 0xA2, 0x21, 0xED, 0xE2, 0x8A, 0x71, 0xC4, 0x84, 0x3E, 0xF5, 0xC1, 0x85, 0x71,
-    0x43, 0x4F, 0x5C, 0x44, 0x96, 0x25, 0xE2, 0x77, 0x50, 0x31, 0xEF, 0x6F, 0x24, 0xFA, 0x2A, 0x24,
-    0xC8, 0xC4, 0xCF, 0x35, 0xD5, 0x61, 0x7F, 0xC0, 0xE5, 0x4E, 0xF4, 0xD2, 0x0C, 0x8E, 0x0E, 0x6E,
-    0x40, 0xD4, 0x30, 0x2D, 0x42, 0xB0, 0x47, 0x95, 0xFE, 0x88, 0x0A, 0x98, 0x09, 0x9E, 0x13, 0x15,
-    0xEC, 0x70, 0xF7, 0x72, 0x6B, 0x39, 0x5E, 0x05, 0xD3, 0xFA, 0xA3, 0xA3, 0x06, 0x66, 0xFA, 0xB3,
-    0xA5, 0x88, 0xCF, 0x6C, 0x04, 0xA9, 0x2C, 0xB8, 0xC4, 0xAC, 0xC4, 0x37, 0x6B, 0xA1, 0x28, 0x90,
-    0x37, 0x2E, 0xE1, 0xD7, 0x0A, 0xA8, 0xAA, 0x21, 0x48, 0x59, 0x16, 0x8B, 0x6C, 0x76, 0xB0, 0x92,
-    0x27, 0xE0, 0x40, 0x09, 0x70, 0x38, 0xDE, 0x4F, 0xB0, 0x6D, 0xC8, 0x4D, 0xA7, 0xA5, 0xE1, 0x9E,
-    0xAA, 0xE1, 0xEE, 0x1F, 0x5E, 0x92, 0x09, 0x62, 0x67, 0x99, 0x21, 0x36, 0x59, 0xF3, 0x2A, 0x13,
-    0xEB, 0x04, 0xE7, 0xDC, 0x03, 0x24, 0x81, 0xC1, 0xD7, 0xE0, 0xA9, 0xD6, 0x4F, 0xEE, 0xE4, 0x2F,
-    0xC3, 0xEB, 0xE5, 0x5A, 0xEC, 0x9C, 0xD9, 0x69, 0x51, 0x86, 0x2C, 0xA5, 0x58, 0x26, 0x63, 0x1A,
-    0xCC, 0x55, 0x13, 0xA2, 0x9E, 0x2A, 0x5A, 0xBA, 0xEC, 0xE2, 0x5D, 0x94, 0xB6, 0xC1, 0xCF, 0x4D,
-    0x86, 0xB5, 0xBB, 0xFB, 0x4D, 0xCB, 0x7A, 0x07, 0x88, 0x6D, 0x3B, 0x25, 0xE6, 0x98, 0x54, 0x36,
-    0xFF, 0xE8, 0xB4, 0x26, 0x3D, 0xA3, 0x1C, 0xEF, 0xD5, 0x76, 0x19, 0x69, 0xEC, 0x7F, 0x43, 0x5E,
-    0xD3, 0xF5, 0xBA, 0xAB, 0x7D, 0xD0, 0x2C, 0xE7, 0x7A, 0x2D, 0xFD, 0x6C, 0xB9, 0xA1, 0xBD, 0x52,
-    0x41, 0xE0, 0x61, 0xDA, 0xE8, 0x7D, 0x6B, 0xB9, 0x6B, 0x02, 0x3A, 0x33, 0xC6, 0x99, 0x99, 0x3E,
-    0xEC, 0xF3, 0x40, 0x98, 0x6F, 0xC3, 0x4C, 0xAD, 0x86, 0x42, 0x91, 0x17, 0xE6, 0xFE, 0x21, 0x4B,
-    0x52, 0xCE, 0x6E, 0xA4, 0xB4, 0x31, 0xD1, 0x0B, 0x10, 0x86, 0xC5, 0x08, 0x08, 0x24, 0xE0, 0x80,
-    0x63, 0x06, 0x4A, 0x2C, 0x01, 0x45, 0x31, 0x59, 0x0B, 0x22, 0xF5, 0xD0, 0xA3, 0x85, 0x2D, 0x42,
-    0xAA, 0x56, 0xD1, 0x85, 0x85, 0xE6, 0xDC, 0x56, 0x4A, 0xBD, 0x20, 0xF0, 0xA7, 0xDA, 0xD7, 0x57,
-    0xB2, 0x94, 0x3A, 0x37, 0xFF, 0xDA, 0xC5, 0x86, 0x50, 0xFA, 0x30, 0xC4, 0x93, 0xA6, 0x57, 0xE9,
-    0xEC, 0xD7, 0xC6, 0xDB, 0x93, 0x9B, 0xDC, 0x4A, 0x49, 0x16, 0x6B, 0xB2, 0x63, 0x81, 0x71, 0x98,
-    0x63, 0x79, 0x5E, 0x06, 0xE2, 0x07, 0x1D, 0x74, 0xFF, 0xC9, 0x6A, 0x53, 0x28, 0x68, 0x2A, 0x27,
-    0x90, 0xB8, 0xA6, 0x5E, 0xEA, 0x1D, 0x12, 0xE3, 0x88, 0xBB, 0x9D, 0x20, 0xAA, 0x9D, 0x35, 0xC2,
-    0xD3, 0xFD, 0x6A, 0x3E, 0x23, 0x04, 0x17, 0xB4, 0x10, 0x8B, 0xAD, 0x4E, 0x71, 0xF5, 0x24, 0x9E,
-    0x54, 0xDA, 0xD2, 0xC5, 0xBD, 0x16, 0x9A, 0x8B, 0x8C, 0x60, 0xD9, 0xD1, 0x1E, 0x72, 0xA9, 0x52,
-    0x07, 0xC5, 0xAE, 0xD0, 0x35, 0x21, 0xDF, 0xA3, 0x98, 0xC9, 0x80, 0xD4, 0xD4, 0x83, 0x2C, 0xA4,
-    0xAC, 0x8D, 0x54, 0x5F, 0x7F, 0x75, 0x77, 0x77, 0x2F, 0x4B, 0xC8, 0x8D, 0x75, 0x9C, 0xD2, 0x46,
-    0x62, 0xCE, 0x2A, 0xF4, 0x56, 0xD5, 0x56, 0xCD, 0x8C, 0x1A, 0x1B, 0xAD, 0x3A, 0xD1, 0x92, 0x22,
-    0x66, 0xDF, 0x07, 0x05, 0x8C, 0x5C, 0x6F, 0xF1, 0x82, 0xB2, 0xE2, 0x39, 0xED, 0x88, 0x7C, 0xE9,
-    0xF2, 0xD7, 0xC2, 0x42, 0x06, 0xAD, 0x50, 0x8D, 0x8A, 0xA0, 0x15, 0x55, 0xDC, 0xA2, 0x53, 0xD0,
-    0x43, 0x58, 0xFE, 0xB2, 0x82, 0x84, 0x9C, 0x8B, 0x6C, 0x4B, 0x43, 0xDC, 0xA3, 0x6D, 0x41, 0xAB,
-    0x62, 0x2F, 0xD3, 0x2A, 0x43, 0x0D, 0x5A, 0x39, 0x7A, 0x6C, 0xEE, 0x1C, 0xC6, 0xD7, 0x02, 0xC9,
-    0xAF, 0xEF, 0x4D, 0x6C, 0xD4, 0x6B, 0x8E, 0xC4, 0x8D, 0x46, 0xF3, 0xC5, 0x77, 0x34, 0x3C, 0xBE,
-    0x8C, 0x53, 0xD1, 0xD7, 0x00, 0xCE, 0xA8, 0x29, 0x75, 0x10, 0xFF, 0xCF, 0x54, 0x56, 0x59, 0xF0,
-    0xBF, 0x07, 0xA7, 0x22, 0x2A, 0x81, 0x7C, 0x16, 0x06, 0xC1, 0x71, 0x4F, 0xE5, 0xD1, 0x63, 0xFA,
-    0x78, 0x5F, 0x38, 0xBB, 0x8F, 0x6F, 0x22, 0x39, 0x24, 0xB6, 0xE5, 0x8A, 0xCB, 0x3D, 0x05, 0xDD,
-    0xED, 0x91, 0xFC, 0xCB, 0x10, 0x76, 0x70, 0x01, 0x8A, 0x06, 0x6F, 0xFF, 0x32, 0x74, 0xE0, 0x9F,
-    0xE2, 0xF6, 0xEF, 0x40, 0xF7, 0xB9, 0xCD, 0x64, 0x8D, 0xEE, 0xF6, 0x43, 0x0C, 0x4F, 0x5D, 0xB8,
-    0x26, 0x7F, 0x7D, 0xAB, 0xB3, 0x2A, 0xA9, 0x3F, 0x98, 0x0A, 0x86, 0xE2, 0x77, 0xD7, 0xEA, 0x8B,
-    0x1F, 0xD5, 0xCE, 0xBF, 0x75, 0x1A, 0xCE, 0x2A, 0x62, 0xD3, 0xB3, 0xF8, 0x5A, 0x06, 0x6E, 0x92,
-    0x8B, 0xCE, 0xE3, 0x14, 0x5F, 0x5E, 0x37, 0xA2, 0x1F, 0x16, 0x84, 0xCC, 0x26, 0xDE, 0xDB, 0xFA,
-    0x55, 0x9B, 0x96, 0xA3, 0xF8, 0xAF, 0x76, 0xA2, 0xE6, 0xB1, 0x5A, 0x3A, 0x30, 0x36, 0xC1, 0x49,
-    0x73, 0x41, 0xB9, 0x83, 0x97, 0x6A, 0x2B, 0x8A, 0x83, 0x0C, 0x6E, 0x25, 0xA5, 0x8B, 0xC6, 0x96,
-    0x0F, 0xE0, 0x37, 0x2F, 0xD7, 0x94, 0xD9, 0xB1, 0x7C, 0x22, 0xA1, 0x45, 0x3A, 0xB1, 0x59, 0xDD,
-    0x81, 0x18, 0x4D, 0x23, 0xA3, 0xB4, 0x32, 0xB2, 0xCA, 0x79, 0x14, 0xEF, 0xD0, 0x86, 0xC3, 0x6C,
-    0x91, 0x66, 0x91, 0xA2, 0x48, 0x6A, 0x58, 0x58, 0xDA, 0x09, 0x35, 0x07, 0x48, 0xE8, 0x07, 0x1A,
-    0xA0, 0xA5, 0xA1, 0xC8, 0x58, 0x3A, 0xF2, 0xF7, 0x8D, 0xA5, 0x25, 0x9F, 0x69, 0x41, 0xA0, 0x27,
-    0xBF, 0xEA, 0x68, 0x4A, 0x8D, 0x82, 0xE7, 0x57, 0xF2, 0xEC, 0x56, 0x13, 0xD5, 0xA3, 0x1E, 0x22,
-    0xD3, 0xBE, 0x72, 0xB0, 0x83, 0x95, 0x7B, 0xA9, 0x63, 0x7B, 0x83, 0xB6, 0x73, 0x82, 0x0D, 0x16,
-    0xEB, 0x70, 0x14, 0x2A, 0x75, 0x58, 0x03, 0x0B, 0x0F, 0x23, 0xDC, 0x6B, 0xA0, 0x56, 0x96, 0x87,
-    0x91, 0x62, 0x21, 0xEC, 0x79, 0x7E, 0x8D, 0xF2, 0x90, 0x88, 0x84, 0x49, 0xBF, 0xF8, 0x58, 0xCB,
-    0x5D, 0x23, 0x8A, 0x7C, 0xFE, 0xB2, 0x4F, 0x56, 0x0F, 0xA6, 0x47, 0x43, 0x16, 0x11, 0x3A, 0x4D,
-    0xBA, 0x9B, 0x98, 0x1D, 0x4D, 0x7F, 0x6A, 0xA0, 0x18, 0xDA, 0xF4, 0x1E, 0x58, 0x8A, 0xA0, 0xEE,
-    0x10, 0x99, 0xFE, 0xEF, 0xEF, 0xE5, 0x28, 0x53, 0xD0, 0xD0, 0x34, 0x76, 0x4C, 0x4A, 0xA7, 0x00,
-    0x75, 0x56, 0x77, 0xDE, 0x07, 0xFC, 0xFB, 0x7D, 0xCF, 0xBB, 0xCD, 0x5A, 0xD7, 0xB4, 0x7B, 0xB9,
-    0xEC, 0x76, 0x66, 0xBF, 0x34, 0xEC, 0xB6, 0xFC, 0x06, 0x01, 0x30, 0x57, 0xD7, 0xBC, 0xB2, 0xCD,
-    0x8A, 0x9A, 0xB9, 0xBC, 0x35, 0x7B, 0xB9, 0x6A, 0x89, 0x2E, 0x11, 0xD2, 0xA6, 0xE4, 0x90, 0xE9,
-    0xE0, 0xC8, 0x59, 0x81, 0x51, 0x00, 0x3D, 0xBC, 0x02, 0xA8, 0x41, 0xE7, 0xBC, 0x8C, 0x09, 0x47,
-    0x2D, 0x55, 0x9A, 0x2E, 0x47, 0x65, 0xA1, 0xAC, 0x32, 0x89, 0xE2, 0x44, 0xD1, 0x21, 0x26, 0x02,
-    0x64, 0x34, 0x31, 0x8B, 0x26, 0x60, 0x48, 0x40, 0x96, 0xE6, 0x28, 0xF3, 0x0F, 0xA9, 0x8F, 0x0E,
-    0x9B, 0x35, 0x29, 0x85, 0x9F, 0x2F, 0xD2, 0xBC, 0xE1, 0x3E, 0xAE, 0x6A, 0x84, 0x88, 0xDF, 0x18,
-    0xD4, 0xDF, 0x24, 0x45, 0x85, 0x5A, 0xE3, 0xDB, 0xE5, 0xD9, 0x5A, 0xF7, 0xD3, 0xC8, 0x0E, 0x24,
-    0x30, 0x9B, 0x34, 0xC4, 0x0A, 0x9A, 0xE8, 0x82, 0xE8, 0x6F, 0xC1, 0x6D, 0x94, 0x86, 0x41, 0x76,
-    0x3A, 0x8C, 0x53, 0x68, 0x5D, 0x94, 0x45, 0xA5, 0x8B, 0x4B, 0x97, 0xBE, 0x96, 0x1A, 0x1C, 0xF2,
-    0x97, 0xF3, 0x5A, 0x92, 0x6F, 0xBE, 0xF9, 0xDD, 0xA7, 0xF4, 0x03, 0x1D, 0x30, 0xBF, 0x62, 0xAF,
-    0x1D, 0xED, 0xFF, 0xD8, 0x22, 0x5F, 0xBA, 0x56, 0xC4, 0x3A, 0x2B, 0x1C, 0x90, 0xA7, 0xD7, 0x36,
-    0x1E, 0xD2, 0x6E, 0xA2, 0xA3, 0x7A, 0x78, 0x0B, 0x69, 0x1A, 0xF1, 0x59, 0xD7, 0x24, 0xB1, 0x62,
-    0x6A, 0x98, 0xAA, 0x21, 0x2A, 0x30, 0xB7, 0x06, 0xAB, 0xA6, 0x55, 0xAB, 0x51, 0x48, 0x07, 0x53,
-    0xAA, 0x7F, 0x57, 0x02, 0xD6, 0xD2, 0x30, 0x7C, 0x4F, 0x49, 0x9B, 0x64, 0xB9, 0x63, 0x9D, 0x2C,
-    0x23, 0x2B, 0xB6, 0x60, 0x26, 0xE1, 0xDA, 0x58, 0xFB, 0xB9, 0x01, 0x82, 0x24, 0xA0, 0x0D, 0xFA,
-    0xE4, 0x10, 0xEE, 0x13, 0xB4, 0x46, 0x46, 0x81, 0x50, 0x63, 0x70, 0x67, 0xAF, 0x7D, 0xAD, 0x25,
-    0xF6, 0xC1, 0x93, 0x0E, 0xE4, 0xF3, 0x48, 0x31, 0x62, 0xEF, 0xDA, 0x14, 0xF7, 0x27, 0x6C, 0x6F,
-    0x83, 0xC2, 0x56, 0xB3, 0x5D, 0xA5, 0x50, 0x86, 0xA6, 0x64, 0xCE, 0x78, 0x17, 0xAE, 0xAD, 0xA4,
-    0xC1, 0x5A, 0x7F, 0xB3, 0xF5, 0xEB, 0x69, 0x55, 0xB2, 0xF9, 0x53, 0x73, 0xEC, 0x47, 0x20, 0xAD,
-    0x89, 0x74, 0x17, 0x58, 0xD8, 0xFD, 0x5F, 0xCC, 0xAF, 0xE7, 0x36, 0x77, 0x46, 0xAD, 0x98, 0x48,
-    0x6F, 0x18, 0x75, 0x15, 0x0C, 0x36, 0x04, 0x62, 0x2F, 0x89, 0xD6, 0xA3, 0x33, 0x9E, 0x34, 0xC5,
-    0x25, 0xA3, 0x04, 0xA0, 0x9E, 0x1F, 0xA9, 0xAB, 0x14, 0x2A, 0x94, 0x40, 0x34, 0x7C, 0x6F, 0x76,
-    0x33, 0x51, 0x8B, 0xA4, 0x45, 0x92, 0xCC, 0x2F, 0x6C, 0xBB, 0x06, 0x75, 0x4D, 0x9C, 0x39, 0x38,
-    0xF8, 0xA1, 0x2D, 0xCC, 0xE3, 0x61, 0x78, 0x6E, 0xF6, 0x5F, 0xD5, 0x71, 0x11, 0x9F, 0x3D, 0xBE,
-    0xE6, 0x7F, 0x2F, 0xDE, 0x2F, 0xE3, 0x1C, 0x1C, 0x1C, 0xA4, 0x4B, 0x4D, 0x32, 0xFF, 0x4B, 0x74,
-    0x3B, 0x31, 0xE9, 0xD9, 0x27, 0x36, 0x77, 0xFC, 0x88, 0xFD, 0x64, 0x5D, 0x47, 0x91, 0x1C, 0x62,
-    0x41, 0x14, 0xE7, 0xC5, 0xF5, 0x0A, 0xB5, 0x72, 0x67, 0x49, 0x86, 0xCB, 0x76, 0x1E, 0x24, 0x98,
-    0x6D, 0xE5, 0x2E, 0x49, 0x2F, 0x19, 0x36, 0x86, 0x65, 0x36, 0x62, 0x94, 0x2D, 0x2B, 0x5D, 0x5E,
-    0x80, 0xF8, 0x59, 0x74, 0xA6, 0xE9, 0x46, 0x69, 0x8A, 0x73, 0x52, 0x69, 0x8A, 0x72, 0x5B, 0x94,
-    0x3A, 0x97, 0xA6, 0x7D, 0xF5, 0x1A, 0x96, 0xE5, 0x95, 0x36, 0x4F, 0x7F, 0x23, 0xC0, 0x35, 0x5A,
-    0x79, 0x45, 0x36, 0x71, 0x34, 0x7C, 0xFF, 0x1B, 0x72, 0xFC, 0xD0, 0x13, 0x4B, 0x1B, 0x85, 0x2A,
-    0x8E, 0xB7, 0xC0, 0xE8, 0xF2, 0xF4, 0x8C, 0xF9, 0x0F, 0x76, 0xE5, 0x4F, 0x40, 0xD3, 0xF0, 0xA9,
-    0x44, 0xFC, 0x8E, 0x39, 0x18, 0x45, 0xD7, 0x3A, 0x04, 0x99, 0x4C, 0x26, 0x82, 0x65, 0xBF, 0xEF,
-    0xE7, 0x7F, 0x64, 0x6A, 0x27, 0x8B, 0x9E, 0x81, 0xD3, 0xFA, 0x2E, 0x6A, 0xEC, 0x28, 0x15, 0x58,
-    0xB1, 0x11, 0xE1, 0x63, 0x13, 0x40, 0x5B, 0x6C, 0x45, 0xE3, 0x96, 0x4E, 0xAC, 0x2A, 0xB7, 0xB3,
-    0xE2, 0x91, 0x1F, 0xA4, 0xCE, 0xEE, 0xE5, 0x1C, 0xF6, 0x4E, 0xB4, 0xBB, 0x6B, 0x79, 0xDD, 0x59,
-    0xD8, 0x6D, 0x62, 0x7C, 0xC8, 0x7B, 0xF5, 0x20, 0xFB, 0x73, 0xE3, 0xA6, 0x5F, 0x5E, 0xD4, 0x7F,
-    0xFF, 0x95, 0xD3, 0x5F, 0x16, 0xA0, 0x8A, 0x61, 0x69, 0xAE, 0x80, 0x97, 0x5E, 0xD4, 0xAC, 0xAD,
-    0xA0, 0x5D, 0xC4, 0xE7, 0x9D, 0x36, 0xFB, 0xA2, 0x39, 0x9D, 0xAE, 0x23, 0x56, 0x9F, 0x24, 0xE3,
-    0xB6, 0x65, 0x3F, 0xD9, 0x77, 0xBB, 0xDF, 0x94, 0xFD, 0xAF, 0xFC, 0xA8, 0xE7, 0x0D, 0x99, 0xD4,
-    0x49, 0xD5, 0xD5, 0xEC, 0x1C, 0xC1, 0x76, 0xF1, 0x3E, 0x28, 0x64, 0xC5, 0x9F, 0x95, 0xDF, 0x3E,
-    0x6B, 0xFE, 0xDE, 0x98, 0xF8, 0x09, 0x32, 0xAB, 0x2D, 0xB4, 0x7B, 0xDF, 0x9F, 0xA7, 0x55, 0xFC,
-    0x88, 0xEA, 0x14, 0xCD, 0x2D, 0x87, 0xCA, 0x7E, 0xAC, 0xFC, 0xCB, 0xBF, 0x50, 0xE4, 0x74, 0x8B,
-    0x9B, 0x3F, 0xC6, 0x24, 0xFF, 0x86, 0x1F, 0xB8, 0xB0, 0xB4, 0xCD, 0x0B, 0xF9, 0x0D, 0xD0, 0xC6,
-    0xC9, 0xBF, 0x80, 0x29, 0x8C, 0xD0, 0x68, 0xFA, 0x19, 0xF9, 0xED, 0x33, 0xE6, 0x4F, 0x36, 0xBE,
-    0xF4, 0x37, 0x71, 0xDF, 0x5B, 0xA6, 0x87, 0xD5, 0x7B, 0x6F, 0x74, 0xBF, 0xC5, 0x5F, 0x3D, 0x3E,
-    0x8D, 0xD3, 0x6B, 0xCC, 0xCB, 0xF8, 0xCA, 0xB0, 0x3F, 0x81, 0xA5, 0x05, 0xA5, 0x28, 0x65, 0xDC,
-    0xBE, 0x58, 0xC1, 0x4B, 0x3B, 0xD5, 0x62, 0x98, 0x99, 0x3F, 0x17, 0xA0, 0x64, 0x16, 0xD3, 0x11,
-    0xB9, 0x55, 0xDB, 0xD0, 0xEF, 0xC9, 0x82, 0x7C, 0xDA, 0x7C, 0x57, 0x6F, 0x20, 0x3F, 0x7F, 0xF2,
-    0x31, 0x81, 0xF1, 0xB7, 0x3A, 0xBB, 0x77, 0xD5, 0xD2, 0x1B, 0x14, 0x5E, 0x6F, 0x61, 0xE9, 0x29,
-    0x37, 0x7F, 0xA3, 0x9F, 0x7A, 0x2A, 0xFF, 0xBD, 0xA1, 0x9D, 0x76, 0x04, 0xA3, 0xED, 0xA5, 0x66,
-    0x3D, 0xD9, 0x2E, 0x3A, 0x43, 0x37, 0x2C, 0x80, 0x99, 0x8D, 0x06, 0x3B, 0x84, 0xD0, 0xCE, 0xF7,
-    0x10, 0xFA, 0x42, 0x0F, 0xA1, 0x3F, 0x5A, 0x2F, 0xE7, 0x58, 0xCA, 0x7E, 0x63, 0x96, 0xA0, 0xEF,
-    0x4A, 0xC1, 0xAE, 0x10, 0xBA, 0xFB, 0xD6, 0xC3, 0x9F, 0x90, 0x7B, 0x35, 0xA6, 0xCF, 0x9E, 0x3F,
-    0xBB, 0xEA, 0x0E, 0xD7, 0x7E, 0x2F, 0x7E, 0x45, 0x5F, 0x16, 0x55, 0xC6, 0x84, 0xA5, 0x2F, 0x2D,
-    0x0B, 0x76, 0xEE, 0x82, 0x9D, 0xC2, 0x22, 0x10, 0x65, 0xF1, 0x39, 0x24, 0x4C, 0x8D, 0xFC, 0xCC,
-    0x2D, 0x45, 0x6D, 0x4F, 0x61, 0x92, 0x23, 0x10, 0xE5, 0xE5, 0xA1, 0x90, 0x2C, 0xF4, 0x01, 0xF8,
-    0x7C, 0x76, 0x18, 0x78, 0x12, 0x19, 0xF8, 0x16, 0xD8, 0xAF, 0xFF, 0x0A, 0x42, 0x79, 0xC1, 0x65,
-    0xA6, 0xCE, 0x20, 0xED, 0xC3, 0x84, 0x0D, 0xEB, 0xD9, 0x2B, 0x04, 0x90, 0x84, 0x01, 0x0C, 0x8E,
-    0x52, 0x11, 0x8B, 0x22, 0x26, 0x66, 0x5D, 0x4C, 0x4A, 0xE3, 0x3D, 0xD6, 0x23, 0x50, 0x6F, 0x64,
-    0xA7, 0xD9, 0x5A, 0x2F, 0xD0, 0xE1, 0x29, 0xA0, 0x57, 0x60, 0x98, 0x1B, 0x8A, 0x00, 0xF4, 0xCD,
-    0x19, 0x9C, 0x3F, 0x38, 0xC1, 0x1B, 0x57, 0xD7, 0x3B, 0x78, 0xAC, 0xC4, 0xA9, 0x34, 0x7D, 0xB2,
-    0x0F, 0x56, 0xF5, 0x71, 0xAA, 0x68, 0xB5, 0xAF, 0x43, 0xDC, 0xC5, 0xA9, 0x98, 0xDA, 0x15, 0xAD,
-    0xA6, 0x76, 0x1D, 0xC6, 0x41, 0xFB, 0xCB, 0x36, 0xF6, 0xDA, 0x67, 0x5B, 0x70, 0x97, 0x9D, 0xBE,
-    0x65, 0x4B, 0xDD, 0xB7, 0xA2, 0x2A, 0xCD, 0x4A, 0xB4, 0x7B, 0x25, 0xC4, 0x0D, 0xA5, 0x1A, 0xB9,
-    0x16, 0x67, 0xDA, 0x83, 0xE3, 0x55, 0x25, 0x1A, 0x61, 0x61, 0xD0, 0x79, 0x58, 0x0C, 0xE1, 0x01,
-    0x65, 0x45, 0x89, 0x8D, 0xAE, 0xD8, 0xAA, 0x12, 0xB7, 0x8B, 0xB0, 0xE4, 0xE8, 0xEC, 0x30, 0x6B,
-    0xAF, 0xA9, 0x41, 0xB2, 0xD2, 0xBE, 0xE8, 0x73, 0x87, 0x17, 0x69, 0xEC, 0x27, 0x6C, 0x5E, 0xB1,
-    0xD1, 0xBE, 0x28, 0xDD, 0x08, 0x97, 0x9F, 0xBB, 0xC8, 0xF6, 0x14, 0x28, 0x11, 0x41, 0x35, 0x70,
-    0x43, 0x8B, 0x97, 0xAF, 0x0C, 0x99, 0x7E, 0x49, 0x3C, 0x8B, 0x23, 0x7A, 0xC5, 0x0A, 0xC5, 0xAB,
-    0x10, 0x13, 0xB2, 0xA1, 0x05, 0x3D, 0x4F, 0x23, 0x68, 0xAE, 0x8C, 0xD5, 0x4E, 0x56, 0x52, 0x6E,
-    0xFB, 0xAE, 0x16, 0x81, 0x9F, 0xBB, 0xA5, 0xBF, 0x27, 0x00, 0xF7, 0xDB, 0x98, 0x59, 0x7F, 0xDA,
-    0x13, 0xE1, 0xE8, 0x7F, 0x56, 0x7D, 0x3A, 0xD5, 0xD7, 0x95, 0x07, 0x6C, 0x2B, 0xCF, 0x1C, 0x99,
-    0xCE, 0xE1, 0xB5, 0x99, 0xB9, 0x1A, 0xF5, 0x99, 0xAB, 0x11, 0xD2, 0x70, 0x12, 0x04, 0x44, 0x67,
-    0x6B, 0x99, 0xAB, 0xA8, 0xE7, 0xAE, 0x68, 0x46, 0xC9, 0xEF, 0xC8, 0x5C, 0xFD, 0x63, 0x3F, 0x1F,
-    0x54, 0x11, 0x32, 0x57, 0xFD, 0x59, 0xEC, 0xDD, 0x7E, 0x4E, 0xE8, 0xDB, 0x66, 0xAE, 0x02, 0x25,
-    0x9E, 0x64, 0x0C, 0xFE, 0x0A, 0x56, 0xF0, 0x97, 0x9B, 0x79, 0x7A, 0xFB, 0x2B, 0x9E, 0x2D, 0xE3,
-    0x5C, 0xB3, 0x89, 0x57, 0xAB, 0x2D, 0x33, 0xD0, 0x77, 0x00, 0xAB, 0xEA, 0x7B, 0x45, 0x2C, 0x23,
-    0x95, 0x0F, 0xD0, 0x75, 0xA3, 0xFC, 0xFD, 0xBB, 0x6E, 0x2C, 0x1D, 0x11, 0x1B, 0xD8, 0x84, 0xC3,
-    0x9F, 0xC9, 0x6B, 0xBE, 0x7B, 0x71, 0x2D, 0x8A, 0xF7, 0x80, 0xA9, 0x14, 0x61, 0xEF, 0xB6, 0xEC,
-    0xB7, 0xF4, 0x71, 0xF6, 0x45, 0xD5, 0x7D, 0x86, 0xE1, 0x3B, 0xB7, 0x5E, 0xFF, 0xBD, 0xF6, 0xD5,
-    0xAD, 0x7F, 0x71, 0x70, 0x6D, 0xDB, 0xFA, 0xBB, 0x3F, 0xB3, 0xF2, 0xE8, 0x3E, 0xEB, 0x3F, 0x76,
-    0x2E, 0xFB, 0x27, 0x15, 0xFC, 0x56, 0xFD, 0xD1, 0xB6, 0x5A, 0xF5, 0x5D, 0x98, 0xE1, 0xE1, 0x0D,
-    0x66, 0x8F, 0xB3, 0xFB, 0x4B, 0x6B, 0x59, 0x45, 0xDA, 0xB5, 0x62, 0x81, 0x33, 0x87, 0x65, 0x95,
-    0x69, 0xE7, 0x4A, 0x89, 0x50, 0x63, 0xBA, 0xDE, 0x9F, 0xA2, 0x6B, 0x95, 0xC6, 0xD8, 0xD1, 0x17,
-    0x5E, 0x90, 0x55, 0x04, 0xB8, 0x7D, 0x40, 0x73, 0xF3, 0x79, 0xDD, 0x6C, 0x75, 0xE2, 0x66, 0xEF,
-    0xC4, 0xEC, 0xA1, 0x00, 0x9F, 0xDB, 0xB0, 0xD8, 0x43, 0xCC, 0x87, 0xCE, 0x4F, 0xBC, 0x10, 0x3E,
-    0x0C, 0xE3, 0x41, 0xA5, 0xA9, 0x82, 0xDD, 0xB1, 0xAA, 0xB5, 0xAC, 0xB1, 0xB9, 0x59, 0xFC, 0xD9,
-    0x4B, 0x0B, 0x31, 0x28, 0x6A, 0x75, 0x01, 0x5A, 0x71, 0xB2, 0x43, 0x9B, 0x8B, 0x74, 0x5B, 0x42,
-    0xCB, 0x03, 0xE1, 0x1B, 0xF6, 0x01, 0x48, 0x08, 0x8E, 0x86, 0x4E, 0xF6, 0x09, 0xD3, 0x76, 0x91,
-    0x16, 0xC9, 0x76, 0x0E, 0x26, 0x7C, 0xA6, 0x64, 0x25, 0xB6, 0xFF, 0x93, 0x92, 0x72, 0xD1, 0xFB,
-    0xD9, 0x87, 0x36, 0x9A, 0xF3, 0x41, 0x69, 0x2D, 0xB1, 0x4C, 0x55, 0x95, 0xDB, 0x6A, 0x1B, 0xBE,
-    0xF3, 0x8E, 0x46, 0x07, 0x9F, 0x7B, 0x85, 0x8C, 0x70, 0xAE, 0x91, 0xC0, 0x41, 0x1D, 0x3E, 0xC3,
-    0x60, 0x5D, 0x11, 0x69, 0x4B, 0x86, 0x34, 0xB2, 0x3E, 0x1A, 0xF6, 0x63, 0x71, 0xD9, 0x9C, 0x20,
-    0xD5, 0x65, 0xF9, 0xB7, 0x98, 0xAE, 0x0D, 0x41, 0x9C, 0x80, 0x1F, 0xF7, 0x1E, 0x93, 0x0E, 0xF7,
-    0x9B, 0x8D, 0x6B, 0xBD, 0x6C, 0xD8, 0xD4, 0xE5, 0x47, 0xAE, 0x5A, 0xD4, 0xAA, 0xEF, 0x20, 0xDF,
-    0xB7, 0x14, 0x55, 0xCF, 0x2D, 0x07, 0x6D, 0xE9, 0xBC, 0x58, 0x0B, 0x30, 0xEF, 0x5C, 0x44, 0x78,
-    0xA9, 0xA0, 0xFE, 0xDD, 0x0C, 0xF2, 0xC4, 0x96, 0xC8, 0x68, 0xAC, 0x41, 0x73, 0x28, 0xCC, 0x84,
-    0x0E, 0x41, 0x26, 0x87, 0x56, 0xB6, 0x64, 0x86, 0xB7, 0x6F, 0x82, 0x67, 0xA9, 0x94, 0xD4, 0xA1,
-    0x52, 0x73, 0x15, 0xD9, 0xE8, 0xC2, 0x8E, 0xB6, 0x63, 0xC9, 0xF6, 0xE9, 0x0F, 0x99, 0xC5, 0x57,
-    0x80, 0x0D, 0x11, 0x92, 0x08, 0xC5, 0xE4, 0x4F, 0x50, 0xB1, 0x23, 0x86, 0xC6, 0xB9, 0x07, 0x59,
-    0xFF, 0x60, 0xE3, 0xBA, 0xD6, 0x61, 0xF0, 0x51, 0xF4, 0x57, 0x21, 0xF1, 0xD2, 0x15, 0xEA, 0xF5,
-    0x6D, 0x33, 0xC1, 0xC5, 0x07, 0x68, 0xEC, 0x34, 0x98, 0xAF, 0xFB, 0x1D, 0x3E, 0xA1, 0x3A, 0xA0,
-    0x2B, 0xB6, 0xBD, 0xD8, 0x57, 0xAC, 0x44, 0x15, 0xD6, 0xFC, 0xD9, 0xC6, 0x7A, 0xE7, 0xAC, 0x3F,
-    0x8A, 0xA5, 0x6C, 0x84, 0x32, 0xE9, 0x6D, 0xC4, 0xE8, 0xCE, 0x88, 0x0D, 0x04, 0x26, 0xDC, 0x4A,
-    0x43, 0x32, 0x6C, 0xF0, 0xB6, 0xC3, 0xEE, 0x38, 0x6E, 0xC5, 0x1D, 0xDE, 0xD5, 0xC6, 0x73, 0x45,
-    0xEF, 0x9F, 0x1B, 0xFE, 0xA6, 0xEC, 0xE3, 0x95, 0x5A, 0x3C, 0xEE, 0x67, 0x33, 0xD3, 0x79, 0xEC,
-    0xB5, 0x72, 0x31, 0xA4, 0x3F, 0x5F, 0x93, 0x8A, 0x44, 0x53, 0x58, 0x5C, 0x05, 0x18, 0x5B, 0x7A,
-    0xD9, 0xA2, 0x63, 0x31, 0x02, 0xD5, 0x6E, 0x57, 0xF3, 0xD8, 0xA3, 0x15, 0x37, 0x6D, 0x90, 0x69,
-    0x33, 0x1F, 0x56, 0x58, 0xB2, 0xE6, 0x90, 0x6D, 0xAC, 0x2A, 0x10, 0x04, 0x0C, 0x53, 0x31, 0x56,
-    0xAD, 0xA1, 0x41, 0x9B, 0x7A, 0xF8, 0x4F, 0x60, 0x7B, 0x6F, 0x55, 0x76, 0x6D, 0xEC, 0xA5, 0x22,
-    0xAA, 0x17, 0x3A, 0x1C, 0xFA, 0xEF, 0x21, 0x35, 0x0D, 0x89, 0x0F, 0x4A, 0x2C, 0xFB, 0xC7, 0x79,
-    0xF5, 0x52, 0x4D, 0x59, 0x03, 0xDB, 0xBC, 0xDB, 0x8B, 0x82, 0x6D, 0xFF, 0x0C, 0xC1, 0x16, 0x10,
-    0x6C, 0x01, 0xC1, 0x16, 0x1E, 0x03, 0x5B, 0xD3, 0xF7, 0x76, 0x19, 0x90, 0x28, 0x86, 0xBF, 0xA9,
-    0xC8, 0x19, 0x08, 0xB6, 0x37, 0x09, 0xB6, 0xB7, 0xF0, 0x49, 0xFF, 0x65, 0xF8, 0xB2, 0x82, 0x97,
-    0xB1, 0xF8, 0xF0, 0xC2, 0xD7, 0x56, 0xC0, 0xE6, 0xB2, 0x57, 0x02, 0x0E, 0x67, 0x5F, 0x51, 0x6E,
-    0x9F, 0x89, 0x75, 0x7F, 0x8A, 0xC4, 0xAF, 0x2B, 0x88, 0x62, 0xFF, 0x6F, 0xF9, 0x58, 0x2D, 0x50,
-    0x75, 0x2A, 0xB8, 0x4C, 0xAA, 0x79, 0x0F, 0x0C, 0x60, 0xD1, 0xED, 0xBC, 0x03, 0xC6, 0xDB, 0x00,
-    0xC6, 0xDB, 0x00, 0xC6, 0x4F, 0xC1, 0x5B, 0xBF, 0x2F, 0xFC, 0x22, 0x7C, 0x0E, 0xDC, 0xFA, 0x33,
-    0x5E, 0x61, 0x27, 0x0B, 0xCD, 0xC6, 0x4E, 0xBD, 0x16, 0x9D, 0x92, 0xFC, 0xB6, 0x92, 0xB7, 0xCF,
-    0xB4, 0xD7, 0xEE, 0x81, 0x20, 0x83, 0x0F, 0x57, 0x11, 0x24, 0x5B, 0x22, 0xC8, 0xCF, 0xAA, 0x15,
-    0x04, 0x99, 0x1A, 0x7B, 0x0C, 0x72, 0xDA, 0x6B, 0x08, 0x52, 0xAE, 0xEC, 0x94, 0xF5, 0xB5, 0xDC,
-    0xE9, 0xB1, 0x64, 0xBC, 0xB8, 0xEF, 0x3A, 0x16, 0xAF, 0x67, 0x3D, 0x05, 0x70, 0x6A, 0x90, 0x03,
-    0x22, 0xBA, 0x8F, 0xBD, 0x60, 0xE1, 0x0E, 0xD6, 0xED, 0x96, 0x84, 0x48, 0x65, 0x11, 0xD7, 0x42,
-    0x04, 0x62, 0x00, 0xDC, 0x8A, 0x7D, 0x26, 0x7C, 0x78, 0xCD, 0x65, 0x5D, 0xA9, 0xB6, 0xD8, 0x09,
-    0xB5, 0xB7, 0xD0, 0xA0, 0x66, 0x3F, 0x93, 0x30, 0x45, 0x19, 0xF8, 0xCC, 0x20, 0xFF, 0x97, 0x1D,
-    0x0D, 0x34, 0xCD, 0x01, 0xC2, 0x63, 0x44, 0x8A, 0xDC, 0x27, 0x87, 0x98, 0xD0, 0xB7, 0xD1, 0xD0,
-    0xAF, 0xD1, 0x70, 0xF1, 0x87, 0x4D, 0x6F, 0x30, 0xBB, 0x1F, 0x11, 0x2E, 0x1F, 0x52, 0xFC, 0xFF,
-    0x56, 0xEB, 0x05, 0xA7, 0x64, 0x3C, 0x51, 0xEF, 0x3B, 0x54, 0x4F, 0xA2, 0x8F, 0x68, 0xA3, 0xAC,
-    0x05, 0x1C, 0x31, 0x8C, 0xF5, 0x20, 0xB4, 0x19, 0x01, 0x88, 0x34, 0x69, 0x33, 0xB7, 0x96, 0xC1,
-    0x2B, 0xBF, 0x7D, 0x03, 0x5F, 0x0A, 0xE0, 0x55, 0x0C, 0x2E, 0xC0, 0x31, 0xC3, 0x76, 0x40, 0x2C,
-    0x17, 0xA6, 0x2B, 0x17, 0x73, 0x4C, 0xA9, 0xF0, 0x30, 0x5D, 0x14, 0xD3, 0xD4, 0x08, 0xC4, 0xD6,
-    0xEC, 0xB5, 0xC0, 0xC4, 0x54, 0x87, 0xBA, 0xE8, 0x1C, 0x0A, 0x9A, 0xBA, 0xC8, 0xF4, 0x97, 0x8D,
-    0x7E, 0x33, 0xFB, 0xEB, 0x9D, 0x54, 0x58, 0xE0, 0xB3, 0xD1, 0xE0, 0xC6, 0x5D, 0x1C, 0x1C, 0x68,
-    0xD2, 0x46, 0xDF, 0xE0, 0x86, 0xAD, 0x5B, 0x8E, 0x37, 0xB8, 0xF1, 0xD3, 0xB5, 0xE6, 0x0E, 0x6B,
-    0x13, 0x1E, 0x71, 0xC2, 0x96, 0x13, 0x2E, 0xCC, 0x52, 0xAF, 0x1D, 0xDF, 0xA7, 0xAD, 0x03, 0x3E,
-    0xC6, 0x84, 0xE2, 0x5A, 0x43, 0xF0, 0x9D, 0x6A, 0x5B, 0xB2, 0xFF, 0x00, 0x54, 0xDB, 0x62, 0x70,
-    0xB8, 0x7B, 0x09, 0x46, 0x43, 0x9B, 0x0F, 0x35, 0x9D, 0x03, 0x81, 0x82, 0xBE, 0xEB, 0x64, 0x67,
-    0xD7, 0x68, 0xA8, 0xE0, 0x62, 0x08, 0xC3, 0x2E, 0xB2, 0x2D, 0x32, 0xB6, 0x29, 0x9D, 0x4B, 0x65,
-    0xDC, 0x1A, 0x86, 0x6D, 0xA3, 0x59, 0xA4, 0x8D, 0xDA, 0x2F, 0xB5, 0x85, 0x9C, 0x6D, 0xD5, 0x63,
-    0x9B, 0x03, 0x75, 0x6D, 0x68, 0x1A, 0xCD, 0xAD, 0x22, 0xF8, 0x2C, 0xFC, 0x98, 0xCB, 0xA0, 0xEA,
-    0x54, 0x3B, 0x37, 0x16, 0x84, 0x16, 0x86, 0x16, 0x88, 0x16, 0x8A, 0x16, 0x8C, 0x16, 0x82, 0xB6,
-    0x53, 0x90, 0x6D, 0x93, 0xC1, 0x35, 0xE4, 0xC6, 0x1E, 0xDE, 0xC6, 0x1A, 0x00, 0x24, 0xDB, 0x9C,
-    0x0D, 0xB4, 0x23, 0x80, 0x5A, 0x1C, 0xD8, 0x2E, 0x0E, 0x7D, 0x5F, 0x27, 0xBD, 0xB8, 0xDA, 0xDE,
-    0x89, 0x20, 0xD3, 0xB5, 0xE4, 0xC6, 0x46, 0x01, 0xCC, 0x50, 0xDB, 0x3B, 0x79, 0xDA, 0xDE, 0x49,
-    0xFB, 0x33, 0x74, 0x0D, 0xE9, 0xB4, 0xBE, 0xCB, 0x76, 0x90, 0xB5, 0x3D, 0x26, 0x6C, 0x8B, 0x06,
-    0xED, 0x05, 0x94, 0x1B, 0x63, 0xBB, 0x01, 0x2D, 0xAF, 0x23, 0x0B, 0xC8, 0x7D, 0xEB, 0x0B, 0x9C,
-    0x58, 0x01, 0xD0, 0x58, 0xEA, 0xB6, 0x57, 0xED, 0x21, 0x62, 0x73, 0x3F, 0xAC, 0xD4, 0x6F, 0xAC,
-    0xB4, 0x27, 0x3F, 0x28, 0xB5, 0x77, 0x32, 0x72, 0x60, 0x16, 0xDF, 0x59, 0xD8, 0x7E, 0x22, 0xB3,
-    0x58, 0x7B, 0x89, 0xB0, 0x06, 0x92, 0x56, 0xAD, 0x4F, 0xAD, 0x09, 0xFD, 0xDA, 0x34, 0x23, 0x5B,
-    0x6B, 0xDF, 0x19, 0x26, 0x41, 0x4B, 0x90, 0xEE, 0x9A, 0xEB, 0xB2, 0xFC, 0x9C, 0xD1, 0xC1, 0x65,
-    0xC7, 0x08, 0x7B, 0x8D, 0xEC, 0xD1, 0x5B, 0x9F, 0xA7, 0x8D, 0xDE, 0xD9, 0xB0, 0xC8, 0xF0, 0xD5,
-    0x59, 0x69, 0x23, 0x7D, 0xA9, 0x5E, 0x6D, 0xB2, 0xEA, 0x39, 0xDB, 0xFA, 0xAF, 0x52, 0x05, 0xA9,
-    0x64, 0x9A, 0xF5, 0xF5, 0xD2, 0x74, 0x9D, 0x8E, 0xE4, 0x14, 0x70, 0x7A, 0xB0, 0xC3, 0xF3, 0xD5,
-    0x46, 0x80, 0xFE, 0x3F, 0x68, 0x17, 0x16, 0x35, 0x55, 0x91, 0xB1, 0x0C, 0x5B, 0xEA, 0x42, 0xAB,
-    0xCD, 0x24, 0x22, 0x8D, 0x73, 0xA1, 0x75, 0x80, 0x96, 0x7D, 0x68, 0xA6, 0x73, 0xD8, 0x95, 0xE1,
-    0xD9, 0x82, 0x21, 0xDB, 0x5E, 0x70, 0xB3, 0xDB, 0x4D, 0x27, 0x61, 0x35, 0x1A, 0xA7, 0x8A, 0xCE,
-    0x5F, 0xED, 0x69, 0xE7, 0x5C, 0x0D, 0xC2, 0x85, 0x8B, 0x63, 0x6E, 0x9A, 0xBD, 0x85, 0x6E, 0x4F,
-    0x83, 0x98, 0x9D, 0x73, 0x10, 0x0A, 0x71, 0xCC, 0x8A, 0xA4, 0x1A, 0x2A, 0x0C, 0x1B, 0x46, 0xB8,
-    0xF3, 0x24, 0x0E, 0x85, 0x9F, 0x89, 0xEE, 0x1F, 0x0B, 0xD0, 0x99, 0x9E, 0x86, 0x00, 0x65, 0x98,
-    0xC2, 0x2F, 0x0E, 0x03, 0x61, 0xCA, 0x88, 0xC1, 0x94, 0x35, 0xF6, 0x1C, 0xCD, 0x94, 0xAF, 0x84,
-    0x8D, 0xA8, 0xA2, 0x38, 0x62, 0x10, 0x3F, 0x7C, 0x05, 0x61, 0xF5, 0xE0, 0x36, 0x82, 0xF8, 0x97,
-    0x19, 0x16, 0x68, 0x17, 0xFF, 0x19, 0x61, 0x31, 0x2A, 0x45, 0xCF, 0x87, 0x8D, 0xE9, 0x93, 0xEE,
-    0xBA, 0xA0, 0x10, 0x12, 0xF1, 0xDC, 0xC5, 0x2E, 0xBB, 0x17, 0xB0, 0x31, 0xC1, 0x02, 0x2A, 0x49,
-    0x9B, 0x86, 0x71, 0xF4, 0x77, 0xB2, 0x8E, 0x39, 0x18, 0x6F, 0x33, 0xCC, 0x47, 0xE0, 0x87, 0x23,
-    0x57, 0x54, 0x89, 0x11, 0xD2, 0xA6, 0xE5, 0x37, 0xF9, 0x80, 0x53, 0xCB, 0xF4, 0xE9, 0xA2, 0x91,
-    0x39, 0x67, 0x10, 0x81, 0xED, 0xAF, 0xE9, 0x7A, 0x8F, 0xCD, 0x29, 0xA7, 0xFD, 0x83, 0x3B, 0xB9,
-    0x77, 0xDF, 0xB0, 0x89, 0x80, 0xCC, 0x14, 0xD5, 0xA0, 0x1B, 0x11, 0xAC, 0xEA, 0x06, 0x32, 0x42,
-    0xC6, 0x76, 0x66, 0xD9, 0x7A, 0xB0, 0xF4, 0xBE, 0x4E, 0xEE, 0xE4, 0x04, 0x27, 0x77, 0x50, 0x3C,
-    0x8D, 0x7D, 0xCB, 0xB6, 0xE5, 0x54, 0xBF, 0x12, 0x6B, 0x60, 0xC8, 0xB7, 0x2F, 0x41, 0xAA, 0xD3,
-    0x0B, 0x1B, 0x6B, 0x57, 0x94, 0x86, 0x93, 0x45, 0x06, 0xCD, 0xE8, 0xDC, 0x64, 0x96, 0xD9, 0xBD,
-    0x3C, 0x17, 0xD3, 0x7B, 0xD9, 0x99, 0x9B, 0xF6, 0xFF, 0x11, 0x0F, 0x97, 0xE1, 0x9F, 0x75, 0xC7,
-    0xC3, 0x16, 0xE5, 0x6D, 0xB5, 0xBE, 0xCA, 0x5C, 0xF1, 0x1A, 0x33, 0x2B, 0x90, 0x58, 0x0B, 0x4D,
-    0x6C, 0x7E, 0x98, 0x3C, 0xF7, 0x5A, 0x63, 0xDA, 0xCC, 0x47, 0x2C, 0xB8, 0x85, 0x7A, 0x8C, 0xFE,
-    0x4E, 0xA2, 0xD0, 0x8C, 0x51, 0xFC, 0x9A, 0x51, 0x7D, 0x08, 0xD2, 0xCD, 0xFA, 0x3C, 0x36, 0x45,
-    0x71, 0xD7, 0xEB, 0xF3, 0xCA, 0x2D, 0xF5, 0x79, 0x5E, 0xC1, 0x6C, 0xC2, 0x61, 0x4B, 0xE9, 0xE8,
-    0x2E, 0xD6, 0xCC, 0xB1, 0xF1, 0x9A, 0x31, 0x56, 0x6F, 0xCD, 0xFA, 0xA1, 0xB8, 0x98, 0xD8, 0x88,
-    0xE8, 0xBC, 0xF7, 0xB0, 0x95, 0x9A, 0xA6, 0x2F, 0x58, 0x9C, 0x76, 0x51, 0xD4, 0xB9, 0x6D, 0x90,
-    0xA5, 0x65, 0x9D, 0x1F, 0xE4, 0xD6, 0x57, 0xAD, 0x58, 0x3A, 0xFF, 0xB8, 0x6D, 0x4C, 0x47, 0xB6,
-    0xB7, 0xC5, 0x64, 0x65, 0x4A, 0x26, 0x48, 0x85, 0xCA, 0xE9, 0x43, 0xD4, 0xAD, 0x44, 0x76, 0x71,
-    0xC8, 0xFA, 0x13, 0x3B, 0x97, 0x2A, 0x65, 0x61, 0x5B, 0xD3, 0x7A, 0x3F, 0x4F, 0x6D, 0x25, 0x29,
-    0x2B, 0x8F, 0x06, 0x4D, 0xD7, 0xAA, 0x65, 0xC3, 0x7D, 0xE3, 0x9D, 0x84, 0x1C, 0x9E, 0xD5, 0x4F,
-    0x98, 0xC5, 0xC8, 0x6E, 0xAF, 0xDA, 0x84, 0x0D, 0xAB, 0x87, 0xD7, 0x8A, 0xFD, 0xB0, 0xD9, 0x37,
-    0x0A, 0xD4, 0x35, 0xC6, 0x17, 0xF7, 0xD9, 0x5D, 0x9C, 0x6D, 0x0C, 0xEB, 0xAE, 0xD1, 0x15, 0xFE,
-    0x78, 0xEA, 0xF2, 0x7B, 0xF1, 0x8A, 0x53, 0xE3, 0x5C, 0xB2, 0x1B, 0xAF, 0xE2, 0xDD, 0x7A, 0xB9,
-    0xF5, 0x90, 0xC9, 0x92, 0x6C, 0x9F, 0xDB, 0x4F, 0xC9, 0xF8, 0x9E, 0xAB, 0x3D, 0x8D, 0xDC, 0x5A,
-    0x13, 0x22, 0xB9, 0x38, 0xDA, 0x1D, 0xB6, 0x73, 0x2E, 0x6E, 0xD3, 0x50, 0xF9, 0xAB, 0xBB, 0x9E,
-    0x5A, 0x49, 0xDE, 0x11, 0x30, 0x08, 0x89, 0x86, 0xA7, 0xB6, 0x17, 0x98, 0xDE, 0xCB, 0x25, 0xF4,
-    0xE8, 0xDB, 0x7B, 0xFD, 0x2B, 0xDB, 0x7B, 0xCD, 0xD9, 0xDE, 0xAB, 0xB9, 0x57, 0x25, 0xB4, 0xBB,
-    0x92, 0xF4, 0x05, 0xFD, 0x9C, 0xBD, 0xBD, 0x18, 0xE5, 0xA7, 0x4A, 0x4F, 0xD4, 0xD4, 0x9C, 0xA0,
-    0x5F, 0x21, 0x89, 0x99, 0xD9, 0xCE, 0x14, 0x85, 0x6D, 0x27, 0x2B, 0xE9, 0xBF, 0x66, 0xFA, 0x4E,
-    0xF8, 0x5C, 0xC6, 0x4C, 0x66, 0x66, 0xAE, 0x0A, 0xDF, 0x74, 0x0F, 0x21, 0xB2, 0x5B, 0x58, 0x90,
-    0xB3, 0xFB, 0xB7, 0xD7, 0xB3, 0xBC, 0xA7, 0x21, 0xF3, 0x69, 0xC0, 0x7D, 0xB6, 0xB6, 0x12, 0xD3,
-    0x6E, 0xE8, 0x2A, 0xF2, 0x8F, 0xB7, 0x12, 0x1B, 0xAD, 0x74, 0x2D, 0x9B, 0xF0, 0xD0, 0xEE, 0xD1,
-    0xBB, 0xAC, 0x59, 0xEF, 0x5D, 0x76, 0x74, 0x70, 0x7D, 0x91, 0x7A, 0xCC, 0x46, 0xF3, 0xFB, 0x4E,
-    0x53, 0xF7, 0x36, 0x66, 0xBB, 0x9E, 0x97, 0x82, 0x18, 0xC5, 0x0E, 0x1A, 0x01, 0x8F, 0xBE, 0x3D,
-    0xBB, 0x75, 0x75, 0xD2, 0x15, 0x7D, 0x74, 0xBD, 0x08, 0x46, 0x86, 0x51, 0x59, 0x77, 0xDD, 0x5F,
-    0x8C, 0x92, 0x45, 0xCD, 0x51, 0x0C, 0x11, 0x5B, 0x40, 0x5F, 0x75, 0xA7, 0xCD, 0x9C, 0xB9, 0xF7,
-    0x73, 0xF4, 0x66, 0xF2, 0xE5, 0xBB, 0xB5, 0x9C, 0x9D, 0x13, 0x9F, 0x48, 0xF6, 0x36, 0x00, 0x0A,
-    0x54, 0xEE, 0xDB, 0x41, 0x23, 0x30, 0xA1, 0x9C, 0xCC, 0xF6, 0x45, 0x93, 0x43, 0xF4, 0xB6, 0xF6,
-    0x45, 0xD3, 0xB6, 0x0D, 0xE9, 0x69, 0xED, 0x11, 0x8C, 0xE4, 0xD1, 0xA9, 0x71, 0x0E, 0xAE, 0x9E,
-    0xE8, 0x26, 0xE4, 0xDC, 0x47, 0x69, 0x9F, 0xC6, 0xB9, 0xA5, 0xED, 0xC1, 0xFE, 0x66, 0xDB, 0x03,
-    0x81, 0xDE, 0xBE, 0x2D, 0xF7, 0x6E, 0x6C, 0xB9, 0x77, 0x2D, 0xFC, 0x76, 0x4B, 0xB9, 0xF7, 0xDB,
-    0xB9, 0x7B, 0x78, 0xCC, 0xAF, 0xF9, 0x03, 0x36, 0x0E, 0x45, 0xD8, 0x64, 0xB5, 0x2E, 0x77, 0xCD,
-    0xC7, 0x7F, 0xDF, 0xED, 0xA7, 0xDC, 0xFE, 0xD7, 0xB1, 0x7D, 0xA4, 0x94, 0x23, 0xCB, 0x3C, 0x72,
-    0x4B, 0xD9, 0xBE, 0x2B, 0xFA, 0x61, 0xF4, 0xF2, 0x3F, 0xAE, 0x6E, 0xDF, 0xDC, 0xC8, 0x27, 0x36,
-    0xAE, 0xAB, 0x03, 0xAB, 0x8E, 0xB0, 0xF3, 0xCF, 0x1F, 0x07, 0xFD, 0xD6, 0xBD, 0x79, 0x2F, 0xD7,
-    0x23, 0xFF, 0x3F, 0x55, 0x23, 0x5F, 0xF6, 0xE6, 0x47, 0x65, 0xD4, 0xDA, 0xBD, 0xA1, 0x72, 0xE4,
-    0xAB, 0xB2, 0xA0, 0x2B, 0xF2, 0xFA, 0xAE, 0x7C, 0xEB, 0xC7, 0x2B, 0xE5, 0x7B, 0x1B, 0x92, 0x34,
-    0x39, 0xB1, 0x45, 0xE3, 0xA9, 0x1F, 0x18, 0xF7, 0x90, 0x75, 0xAB, 0x0C, 0x9A, 0x5C, 0x0D, 0x4A,
-    0x1A, 0x7E, 0xDB, 0xB6, 0xDD, 0xED, 0xFD, 0xD8, 0xA9, 0x8F, 0xFA, 0x3E, 0x1D, 0x1B, 0xE6, 0xF8,
-    0x0A, 0xE3, 0xDE, 0x6C, 0x66, 0x81, 0xB0, 0xE0, 0x04, 0xB6, 0xF3, 0xFC, 0x70, 0x0F, 0xF4, 0xCC,
-    0x3E, 0xB9, 0x1F, 0xAB, 0x36, 0x6E, 0x74, 0x52, 0x6D, 0xDC, 0x96, 0x44, 0xD2, 0x1B, 0x70, 0x8F,
-    0xA5, 0xEE, 0x6A, 0xC3, 0xD3, 0x39, 0xB9, 0x61, 0x73, 0x45, 0x78, 0x9A, 0xD3, 0x00, 0xD8, 0xC3,
-    0x1A, 0x36, 0xF9, 0x5E, 0x39, 0x9F, 0xEE, 0xDE, 0x68, 0xB3, 0x19, 0x0D, 0x2D, 0x39, 0xC6, 0x45,
-    0xBC, 0x6E, 0x59, 0x1E, 0x1F, 0x17, 0x2B, 0xAA, 0xBE, 0xB0, 0xF5, 0x53, 0xB2, 0xED, 0xC3, 0x17,
-    0x16, 0xFD, 0x93, 0x28, 0x66, 0x9A, 0xA1, 0xBF, 0xD4, 0x36, 0x02, 0xA0, 0xF9, 0x0C, 0xF9, 0xE8,
-    0xF3, 0xCB, 0xA5, 0x28, 0x5D, 0x83, 0xF2, 0x49, 0xEC, 0x74, 0x8C, 0x8C, 0xE3, 0x31, 0xAA, 0x6F,
-    0xE6, 0xD3, 0x53, 0xEC, 0xC6, 0xC9, 0xF9, 0xAF, 0xAE, 0xC8, 0x69, 0x1D, 0xE6, 0x5D, 0xE8, 0xD3,
-    0x44, 0x39, 0xBB, 0x8F, 0xB5, 0x9D, 0xFF, 0xE8, 0x9C, 0x79, 0x6C, 0xF7, 0xEF, 0x15, 0x9B, 0x4D,
-    0x29, 0x2C, 0x17, 0x4C, 0xD7, 0xD2, 0xE0, 0x1E, 0x3E, 0x8C, 0xEE, 0x19, 0xB2, 0xE8, 0x15, 0x77,
-    0xD8, 0x36, 0xEE, 0xE1, 0xC7, 0xAF, 0x9A, 0x3D, 0xA1, 0x00, 0xD7, 0xAD, 0xB5, 0xF1, 0xED, 0x4C,
-    0x05, 0x80, 0x7B, 0xD5, 0x4D, 0x35, 0x23, 0x5A, 0xF3, 0xA0, 0x07, 0x77, 0xF6, 0x14, 0x00, 0xB6,
-    0x4D, 0xA5, 0xF9, 0x8B, 0x6B, 0x5B, 0x82, 0xDF, 0x9F, 0xFE, 0x66, 0xE6, 0x81, 0x8D, 0xB4, 0x07,
-    0x36, 0x32, 0xAD, 0xDE, 0xCD, 0xAE, 0x83, 0xF7, 0x96, 0x1E, 0xDE, 0x8F, 0x75, 0x7F, 0xAE, 0xAD,
-    0x4E, 0xDF, 0x1C, 0x12, 0x2B, 0x62, 0x83, 0x00, 0xD6, 0xFE, 0xF1, 0x00, 0xA8, 0x95, 0x39, 0x35,
-    0xDE, 0x5E, 0xF7, 0x95, 0x1F, 0x1A, 0x1B, 0x21, 0xD3, 0xFE, 0xC1, 0x10, 0xDF, 0xDA, 0x2D, 0x3C,
-    0x4A, 0xBB, 0x3A, 0xF4, 0xD4, 0x16, 0x84, 0xFB, 0xF9, 0xB1, 0x1E, 0xC6, 0xB9, 0xED, 0xC0, 0xB7,
-    0xDF, 0xF7, 0x79, 0xC9, 0x96, 0xCE, 0x87, 0x64, 0xE9, 0x78, 0x80, 0xB6, 0x76, 0x06, 0x3D, 0x0C,
-    0x35, 0x59, 0xB2, 0x73, 0x38, 0x9C, 0xFB, 0x78, 0x7E, 0xF3, 0x43, 0xEB, 0xB1, 0x18, 0xBE, 0xBF,
-    0xC7, 0x82, 0xD5, 0x4A, 0x93, 0xF3, 0x68, 0xDF, 0xD0, 0xBA, 0x09, 0x57, 0x9A, 0x25, 0x6D, 0x3C,
-    0x21, 0x49, 0x5B, 0x0F, 0x94, 0x5A, 0xEC, 0x36, 0x78, 0xAD, 0xD5, 0x70, 0x9C, 0xD8, 0x22, 0xC5,
-    0xCA, 0x31, 0x03, 0xF9, 0x35, 0x8B, 0x54, 0x53, 0x86, 0x6D, 0x5B, 0x2D, 0xE4, 0x4E, 0x08, 0xDD,
-    0xA9, 0x6B, 0x6B, 0xD9, 0x56, 0x4B, 0xCB, 0xFE, 0x58, 0xA5, 0xA1, 0x36, 0x88, 0x26, 0x88, 0xD3,
-    0xC5, 0xD1, 0xD5, 0x84, 0x77, 0x9E, 0x45, 0xF8, 0xC2, 0xAA, 0x65, 0xBB, 0x6C, 0x3A, 0xB3, 0xAD,
-    0x66, 0x17, 0x42, 0xB3, 0x3B, 0x87, 0x14, 0xCE, 0x6B, 0xC8, 0x12, 0x6A, 0x0B, 0x28, 0x06, 0x6D,
-    0x7E, 0xAA, 0xAF, 0x51, 0x08, 0x56, 0x14, 0xB4, 0x95, 0xF6, 0xB1, 0x83, 0x7A, 0x23, 0x41, 0x07,
-    0x11, 0x18, 0x9F, 0x39, 0xA1, 0xBF, 0x06, 0xB1, 0xC3, 0xE4, 0xC6, 0x43, 0x51, 0xB4, 0xDE, 0xBA,
-    0x17, 0xAA, 0xC3, 0x7C, 0xED, 0xA1, 0x36, 0x21, 0xEA, 0x76, 0xA2, 0xBE, 0x7D, 0x03, 0x20, 0xF7,
-    0xB9, 0xDA, 0x44, 0xCF, 0x27, 0x42, 0x36, 0x65, 0x92, 0xAA, 0x92, 0x3E, 0x58, 0x5A, 0x44, 0xBD,
-    0x24, 0xDD, 0x59, 0x31, 0x15, 0x1F, 0xBD, 0x5F, 0x76, 0x7D, 0xC2, 0x9E, 0xAB, 0x6B, 0x7A, 0x6B,
-    0xB2, 0x4C, 0x6B, 0x46, 0x81, 0xA1, 0xF7, 0x3F, 0x4E, 0x44, 0xC4, 0x4F, 0xD2, 0x47, 0xAB, 0xEE,
-    0xC5, 0x68, 0x93, 0xDF, 0x2F, 0xB1, 0x11, 0xD1, 0x09, 0x76, 0x68, 0xD1, 0xCE, 0x6E, 0xFD, 0x71,
-    0x3E, 0x56, 0x4E, 0xEE, 0xF9, 0x8A, 0x4B, 0xA0, 0x3A, 0x96, 0xC0, 0x93, 0x99, 0xCE, 0x77, 0x44,
-    0x10, 0x3E, 0x2C, 0x27, 0x77, 0x71, 0x2F, 0x1C, 0x6C, 0x8C, 0x79, 0x20, 0x85, 0xD9, 0xFF, 0xC4,
-    0xEC, 0x85, 0xEF, 0xB0, 0xFC, 0xB5, 0xB4, 0x3D, 0xBB, 0x9D, 0x3E, 0x0E, 0x77, 0x3C, 0x9D, 0xA4,
-    0x4F, 0xF8, 0xB2, 0x6D, 0xA1, 0x3A, 0x5B, 0xC1, 0xAD, 0x60, 0xAB, 0x09, 0x33, 0x2F, 0xE7, 0x62,
-    0x18, 0x4F, 0x65, 0x87, 0xC9, 0x07, 0x1F, 0xE5, 0x61, 0xFB, 0x4E, 0x76, 0xFA, 0xB0, 0xCF, 0xCD,
-    0x54, 0xC1, 0xEE, 0x24, 0xEA, 0x50, 0x42, 0xB8, 0xE1, 0x24, 0x99, 0xCF, 0x53, 0xC8, 0x99, 0x9C,
-    0x0B, 0xD3, 0x1A, 0x46, 0x56, 0x49, 0x67, 0x43, 0x52, 0xD2, 0xCE, 0xB0, 0x4F, 0x27, 0x98, 0x0B,
-    0x88, 0xEE, 0x0A, 0x4B, 0xAB, 0xC8, 0x50, 0xEB, 0x0A, 0x31, 0x37, 0xA7, 0x12, 0x8C, 0xF8, 0x69,
-    0xEE, 0x8A, 0x01, 0x1E, 0x20, 0xB7, 0xAA, 0x41, 0x61, 0x01, 0x96, 0x36, 0xC6, 0x43, 0x0A, 0xC6,
-    0xC8, 0x12, 0x1E, 0xE6, 0x57, 0x60, 0x5A, 0x78, 0xD9, 0xFE, 0x00, 0x75, 0x80, 0xD9, 0x79, 0xD6,
-    0xF0, 0xA6, 0xE7, 0x83, 0x18, 0xCD, 0x21, 0x76, 0x22, 0x72, 0x8E, 0x9D, 0x7D, 0x2A, 0xC1, 0x61,
-    0xAD, 0xE5, 0x0C, 0x25, 0x1F, 0x52, 0x10, 0x14, 0xCE, 0xE2, 0x2A, 0xD8, 0xBB, 0x58, 0x80, 0x63,
-    0xF9, 0x8A, 0xCD, 0x7C, 0xEF, 0x72, 0x04, 0x23, 0x73, 0xBC, 0xD8, 0x4C, 0x13, 0xD7, 0xD5, 0x3D,
-    0xD9, 0xF7, 0x21, 0x44, 0x0A, 0x6F, 0x0A, 0x0F, 0x02, 0x5C, 0x25, 0x25, 0x9A, 0x10, 0x0A, 0x4A,
-    0xDC, 0xCD, 0xCC, 0xDD, 0xDC, 0xF9, 0x30, 0x73, 0xEF, 0xE6, 0xEE, 0x87, 0xF9, 0xE0, 0x9F, 0xB3,
-    0xC1, 0xAF, 0x72, 0xFF, 0xFB, 0xD9, 0xE0, 0xDD, 0x22, 0xF0, 0xD3, 0xC1, 0xBB, 0xE5, 0x8E, 0x1F,
-    0x0F, 0xDF, 0x2C, 0xAF, 0x04, 0xC6, 0x7B, 0xB3, 0x44, 0x49, 0x6E, 0xFA, 0x3B, 0xC1, 0x25, 0x3F,
-    0xBE, 0x9B, 0xCB, 0xBA, 0xE4, 0x46, 0x22, 0x51, 0xCD, 0x2C, 0x1E, 0x09, 0x92, 0x09, 0xF8, 0xE5,
-    0xBD, 0x2B, 0x66, 0xCD, 0x34, 0x5E, 0xC9, 0x5E, 0xBB, 0xB2, 0x5C, 0xDE, 0xB2, 0x9E, 0xE0, 0xA1,
-    0xAB, 0x68, 0x67, 0xD2, 0x33, 0x31, 0x4B, 0xBA, 0xA1, 0x44, 0xDF, 0x64, 0x9E, 0xA1, 0xEA, 0x0E,
-    0x6B, 0x0D, 0x2D, 0x57, 0xE0, 0xC8, 0x87, 0x31, 0xE9, 0xE3, 0xFF, 0x68, 0xCB, 0xEA, 0xF3, 0x98,
-    0xD4, 0xEB, 0xA5, 0x4F, 0x64, 0xD2, 0x47, 0x32, 0xE9, 0x33, 0x99, 0xF8, 0x50, 0x26, 0xF5, 0x18,
-    0xDA, 0xDE, 0x56, 0x7C, 0x2E, 0x93, 0x15, 0x6D, 0x7C, 0x32, 0x93, 0x3E, 0x9A, 0x49, 0x03, 0x00,
-    0x4E, 0xD7, 0x36, 0x5B, 0x23, 0x2F, 0xCA, 0x46, 0xD0, 0x56, 0x3E, 0xED, 0xAA, 0xEA, 0xB5, 0x6C,
-    0x07, 0x82, 0x32, 0xF3, 0x44, 0x44, 0x67, 0x64, 0x30, 0x09, 0x24, 0x69, 0x73, 0x6C, 0xD1, 0xDE,
-    0x62, 0x00, 0x9F, 0xD7, 0xDB, 0x62, 0x76, 0xBD, 0x78, 0x1B, 0xAD, 0x10, 0xD9, 0xA6, 0x35, 0x59,
-    0xA1, 0xFF, 0xA8, 0x7F, 0xBE, 0xDA, 0xB2, 0xB3, 0x6E, 0x57, 0x8D, 0xB5, 0xD6, 0xA1, 0xED, 0xCD,
-    0x05, 0xC2, 0x0E, 0xBF, 0x44, 0x0D, 0xC8, 0x33, 0x45, 0x9F, 0x0C, 0x89, 0x9C, 0x5D, 0x24, 0xD3,
-    0xE8, 0xE0, 0xE6, 0x5F, 0xDE, 0x9A, 0x78, 0xFF, 0x08, 0x1E, 0x60, 0xA5, 0x2B, 0x2B, 0x50, 0xC8,
-    0x8E, 0x5A, 0x97, 0x41, 0x76, 0x3C, 0xD3, 0xF6, 0xA1, 0x03, 0x07, 0x86, 0x76, 0xAD, 0x75, 0xD2,
-    0xBC, 0xFA, 0x5A, 0x03, 0x6A, 0xA2, 0xE7, 0xD4, 0x35, 0x3F, 0xB2, 0x51, 0x98, 0x46, 0x65, 0x28,
-    0xBA, 0x4F, 0x29, 0x49, 0x46, 0xB6, 0x37, 0x79, 0x57, 0x2C, 0x32, 0xB2, 0x66, 0xD7, 0xEC, 0xE0,
-    0x80, 0xF2, 0x95, 0xFD, 0xD6, 0x04, 0x8B, 0xA9, 0x41, 0xA9, 0xEE, 0x64, 0x6C, 0xA9, 0xAD, 0xD1,
-    0x9E, 0xD7, 0x98, 0x05, 0xDD, 0xDB, 0x69, 0xB3, 0x69, 0x12, 0xB0, 0x7D, 0x6C, 0xCB, 0xA0, 0xB2,
-    0xCE, 0xD7, 0x42, 0xFD, 0xAF, 0x50, 0x3C, 0x6F, 0x1D, 0x5C, 0x33, 0xDA, 0x00, 0xA2, 0x84, 0x25,
-    0xD5, 0x19, 0x07, 0x0A, 0xA5, 0xB9, 0xE7, 0xF1, 0x71, 0x5C, 0xCF, 0xA1, 0x09, 0xBA, 0x40, 0x6A,
-    0x7E, 0x39, 0x1F, 0xD4, 0x4E, 0x5B, 0x0C, 0x0B, 0x76, 0xFC, 0x25, 0xDF, 0x6F, 0x95, 0xF3, 0xCF,
-    0xB5, 0xD0, 0xA5, 0x39, 0xCD, 0x46, 0x12, 0x2D, 0x43, 0xA0, 0x0E, 0x6C, 0xB6, 0x11, 0xC9, 0xD7,
-    0x3E, 0x0B, 0x07, 0x80, 0xAB, 0x35, 0x4E, 0xAF, 0xCF, 0x98, 0x61, 0x06, 0x71, 0xF4, 0xDF, 0xEE,
-    0xB6, 0xE9, 0x5F, 0xCB, 0xEA, 0xDF, 0xBE, 0x8D, 0xA8, 0xD6, 0x62, 0xF8, 0x3D, 0x6C, 0xE3, 0xA2,
-    0x66, 0x51, 0x3A, 0xD7, 0xDC, 0x6B, 0xC6, 0x81, 0x57, 0xD6, 0x99, 0x5F, 0x66, 0x2B, 0x76, 0x24,
-    0xF3, 0xBC, 0xBF, 0xD6, 0x9C, 0xFB, 0x63, 0x27, 0x14, 0x2E, 0xF4, 0xB9, 0x53, 0x95, 0x0E, 0x0F,
-    0x9C, 0x50, 0x88, 0xEA, 0x0B, 0x3E, 0x9C, 0x8C, 0x0F, 0x9F, 0x12, 0x36, 0x86, 0x07, 0x29, 0xA6,
-    0xEC, 0x85, 0x3B, 0xE9, 0x2C, 0xCF, 0xFF, 0x95, 0xAE, 0x97, 0xCB, 0x20, 0xCA, 0x02, 0x98, 0xB6,
-    0x2F, 0xCA, 0x6C, 0xB5, 0x3A, 0xEF, 0x6A, 0xD5, 0x71, 0x59, 0x50, 0x1C, 0x5D, 0x98, 0xE5, 0x36,
-    0x2F, 0x09, 0x26, 0xF4, 0x28, 0x5E, 0x73, 0x4D, 0x47, 0xBD, 0x86, 0x15, 0x14, 0x4F, 0xC7, 0x5D,
-    0x0F, 0xD4, 0xF9, 0x5A, 0x8F, 0x0E, 0x0F, 0xFA, 0x95, 0x3E, 0x0E, 0x0B, 0x5A, 0xD7, 0x35, 0x05,
-    0xB1, 0xBB, 0xB4, 0x90, 0x37, 0xA3, 0x4A, 0xFA, 0xBF, 0xCE, 0x0D, 0xFB, 0x30, 0xC7, 0x41, 0xBB,
-    0x38, 0x98, 0xFB, 0x87, 0x20, 0x22, 0x51, 0x5B, 0xEA, 0x04, 0x88, 0x32, 0x85, 0x22, 0x3F, 0xB5,
-    0x45, 0x31, 0x49, 0x9A, 0x20, 0x7E, 0x11, 0xDD, 0xDC, 0x63, 0x5B, 0xF5, 0x5C, 0x1B, 0x73, 0x2D,
-    0xDB, 0x6A, 0x24, 0x54, 0x87, 0xB2, 0xC1, 0xCD, 0xCB, 0xA5, 0xA3, 0x7D, 0x83, 0xEA, 0x95, 0x24,
-    0xCB, 0xC6, 0x3C, 0xDD, 0x0A, 0xD2, 0xB4, 0xB5, 0xB7, 0x78, 0xB1, 0x0A, 0x72, 0x76, 0xB3, 0x16,
-    0xE2, 0x04, 0x8A, 0x47, 0x71, 0xF4, 0xD2, 0x82, 0x4F, 0x62, 0x45, 0xE2, 0xB8, 0x26, 0x63, 0x3F,
-    0x81, 0x66, 0xDD, 0x68, 0x64, 0x6B, 0x46, 0x38, 0x97, 0xAF, 0xAE, 0x75, 0x1A, 0x7A, 0xF4, 0xFB,
-    0x75, 0xF0, 0x18, 0x57, 0x08, 0x5A, 0x31, 0x96, 0x87, 0x7D, 0xE5, 0xC3, 0x43, 0x80, 0x83, 0x2D,
-    0x8A, 0x80, 0xC6, 0x13, 0x5A, 0xE5, 0x4B, 0x79, 0xC2, 0x56, 0x4E, 0xFB, 0xEF, 0xC8, 0x7D, 0xE0,
-    0x58, 0x1E, 0xDA, 0xB5, 0xED, 0x0B, 0x5E, 0xD2, 0xAB, 0x7F, 0xEC, 0x29, 0x9F, 0x9F, 0x06, 0xF7,
-    0x81, 0xE2, 0xF3, 0x79, 0x68, 0xD6, 0x53, 0x6F, 0x3B, 0x3E, 0x3F, 0xD2, 0x27, 0xBF, 0x11, 0xC2,
-    0x8E, 0x88, 0xD9, 0x67, 0x2A, 0xF3, 0x05, 0xA7, 0x78, 0x28, 0xE9, 0x88, 0xCF, 0x6B, 0x9C, 0xA3,
-    0xD4, 0xC1, 0x3E, 0xF5, 0x90, 0x48, 0xD6, 0x87, 0xCA, 0x89, 0x7A, 0x7D, 0x3F, 0xFE, 0x95, 0x87,
-    0x21, 0x81, 0x7F, 0x86, 0xC4, 0xB8, 0xE1, 0x06, 0x81, 0x2F, 0x87, 0xB9, 0xCA, 0xB8, 0x18, 0x31,
-    0xFE, 0x79, 0x9C, 0x20, 0xE9, 0x00, 0xE9, 0x5A, 0x4B, 0x67, 0x29, 0x71, 0x36, 0xC0, 0xBC, 0x4F,
-    0xA1, 0x57, 0xC7, 0xCA, 0xD3, 0xB0, 0x89, 0x72, 0x84, 0x2D, 0xD9, 0xFC, 0xB4, 0xEF, 0x8E, 0xC1,
-    0x15, 0x40, 0x6B, 0x39, 0xC3, 0xD5, 0x32, 0x7B, 0xC0, 0x59, 0xAE, 0x60, 0x4B, 0x57, 0x8D, 0xEE,
-    0xC9, 0xBC, 0x67, 0x51, 0x09, 0x1C, 0xBD, 0xC6, 0x47, 0x18, 0x2F, 0xFA, 0x0A, 0x92, 0xD3, 0x2C,
-    0x58, 0xA4, 0xEB, 0x80, 0x49, 0xC6, 0x6B, 0x3F, 0x8F, 0xDB, 0x43, 0xEC, 0xDC, 0x83, 0x1F, 0xC1,
-    0x6C, 0xA7, 0x77, 0x77, 0xFE, 0xD0, 0x6A, 0x43, 0xAC, 0xDE, 0xB4, 0xDA, 0xE8, 0x4D, 0x69, 0x1F,
-    0xFC, 0xB5, 0x8B, 0x54, 0x6E, 0xF2, 0xD8, 0xC7, 0x14, 0x62, 0xF7, 0xD7, 0x86, 0xFF, 0x40, 0xB0,
-    0xF3, 0xD3, 0xAA, 0xE7, 0x99, 0x27, 0x71, 0xCC, 0x7F, 0x43, 0xF7, 0x0D, 0x63, 0x73, 0x24, 0xB5,
-    0xD5, 0xAB, 0x8A, 0xCB, 0x4F, 0xA6, 0xFB, 0x06, 0x97, 0xCF, 0x93, 0xE7, 0xC1, 0x7B, 0xE9, 0x8F,
-    0x8F, 0xAD, 0x7B, 0xD8, 0x37, 0x94, 0xDF, 0xD6, 0x9B, 0x63, 0x4B, 0x43, 0xF9, 0x93, 0x7B, 0x73,
-    0xA0, 0x72, 0xDF, 0x5B, 0xEF, 0xCD, 0xF1, 0xFF, 0x7B, 0x6F, 0x12, 0x2B, 0xAA, 0x54, 0xF7, 0x52,
-    0xE5, 0x6B, 0x9B, 0xB4, 0x7A, 0x7C, 0x61, 0x44, 0x0C, 0xB2, 0x59, 0xDE, 0xC0, 0xA0, 0xF8, 0x44,
-    0x0C, 0x7A, 0x68, 0x10, 0x04, 0x17, 0xA0, 0xBE, 0x46, 0x2E, 0xE0, 0x14, 0x5F, 0x38, 0x9E, 0x34,
-    0xF7, 0x28, 0x9F, 0x66, 0x84, 0x03, 0xC6, 0xF1, 0xE2, 0x70, 0x37, 0x8E, 0xF6, 0x93, 0xED, 0x67,
-    0xFD, 0xA5, 0x83, 0xAB, 0xA6, 0x7B, 0xF0, 0x60, 0xD2, 0xE6, 0x9B, 0x8C, 0xF0, 0xB1, 0x7C, 0x1A,
-    0xE0, 0x53, 0x07, 0xD7, 0x8C, 0xB5, 0xD5, 0xEC, 0xB8, 0x1A, 0xA9, 0x64, 0x80, 0xC6, 0x4F, 0x6D,
-    0x1A, 0xA8, 0x06, 0x16, 0x98, 0x30, 0x8E, 0x79, 0xC8, 0xD8, 0x45, 0x33, 0xA2, 0x7E, 0x54, 0x30,
-    0x5F, 0xB3, 0xD0, 0xE7, 0x36, 0x47, 0x3C, 0x2F, 0xA6, 0xAC, 0x96, 0x54, 0x27, 0x7F, 0xCB, 0xF3,
-    0xFD, 0x90, 0x66, 0xF9, 0xDD, 0xBC, 0x6F, 0x06, 0xA8, 0x3E, 0x25, 0x1B, 0x64, 0x6D, 0x96, 0xA9,
-    0x36, 0xB6, 0xBD, 0x68, 0xD1, 0xC7, 0x7D, 0xFE, 0x4C, 0xC3, 0x9D, 0xF3, 0x65, 0x8A, 0x4F, 0x47,
-    0xB7, 0x5A, 0x4B, 0xA3, 0xE3, 0x97, 0xDD, 0x6D, 0xD5, 0xB7, 0x8F, 0x2B, 0xE4, 0x55, 0x72, 0x05,
-    0x17, 0x58, 0xD9, 0x8B, 0x0E, 0x3F, 0x9B, 0x9A, 0xE8, 0xA7, 0xE2, 0x14, 0xCC, 0x9F, 0xB3, 0x58,
-    0x9E, 0x89, 0xFF, 0xE8, 0x1D, 0x8F, 0xA5, 0x50, 0xDB, 0x73, 0xF1, 0x81, 0x2F, 0x0E, 0xD2, 0x4F,
-    0xC5, 0x59, 0x98, 0xA7, 0xD0, 0xA6, 0xDD, 0x8C, 0xA8, 0x90, 0x37, 0x6C, 0xB2, 0x5C, 0x9C, 0x67,
-    0xF1, 0x12, 0x40, 0xF6, 0x1F, 0xDD, 0xEC, 0x53, 0x74, 0x22, 0xF7, 0xE5, 0xC6, 0x8F, 0xEC, 0x41,
-    0x90, 0xA0, 0x58, 0x50, 0x2A, 0x5E, 0x1B, 0xB4, 0xFA, 0x49, 0x3D, 0xE7, 0xE2, 0xF7, 0x2D, 0xE7,
-    0xBC, 0x67, 0x99, 0xED, 0xD6, 0xF2, 0xE3, 0xD7, 0xBB, 0xF6, 0x0E, 0xC9, 0x49, 0x37, 0x58, 0x26,
-    0x7A, 0x9E, 0x7A, 0x90, 0x8A, 0xD5, 0x35, 0x1F, 0x7F, 0x7E, 0x3C, 0xB3, 0x2B, 0xBC, 0x6F, 0x66,
-    0x97, 0x76, 0xBC, 0x50, 0x99, 0xAC, 0xBD, 0x2B, 0xBB, 0x4B, 0xE5, 0xC7, 0x27, 0x78, 0x10, 0x3E,
-    0x2D, 0x0F, 0x5D, 0x5C, 0x31, 0xDA, 0xEF, 0xCD, 0x2E, 0xFF, 0xF0, 0x0F, 0xD9, 0xC0, 0x5B, 0xA5,
-    0x5A, 0xDB, 0x6A, 0x72, 0x6F, 0x49, 0x0C, 0xDB, 0xF2, 0x1C, 0xE1, 0xA0, 0x6F, 0x35, 0xFB, 0xD4,
-    0xD1, 0x8F, 0xB6, 0xE7, 0x2A, 0x32, 0xCE, 0xB7, 0x82, 0x8C, 0xFF, 0x62, 0x6C, 0xFB, 0xDA, 0x70,
-    0x99, 0xE9, 0xBD, 0xDE, 0x52, 0x80, 0x01, 0x4D, 0x26, 0xC2, 0x7F, 0xDE, 0xE6, 0x1A, 0x35, 0xEC,
-    0xE9, 0x10, 0x89, 0x21, 0x1E, 0xD9, 0xB8, 0xD3, 0x4A, 0x80, 0xA8, 0xFB, 0x33, 0xAC, 0xFF, 0xCD,
-    0x67, 0x85, 0x78, 0x37, 0xB5, 0xA9, 0x1B, 0x03, 0xB5, 0xFB, 0xD6, 0xAF, 0x3C, 0xB6, 0xB5, 0x3B,
-    0xA5, 0x76, 0xCE, 0xFF, 0xFC, 0x63, 0x91, 0xBC, 0xFB, 0x2F, 0x4C, 0xDE, 0x6D, 0x56, 0x92, 0x77,
-    0xEB, 0x65, 0x54, 0xD9, 0x59, 0x89, 0x2D, 0xCF, 0x74, 0x02, 0x92, 0xC4, 0xE7, 0x09, 0x0D, 0x28,
-    0xB6, 0xD0, 0x2A, 0x59, 0xB0, 0x49, 0xE6, 0xC7, 0xA2, 0xDE, 0xC1, 0xEF, 0xAA, 0xAE, 0x6A, 0x8D,
-    0x0C, 0x79, 0xD6, 0x35, 0xF8, 0x1A, 0x80, 0x33, 0x6B, 0xF2, 0xEE, 0x2B, 0x99, 0xDA, 0x0B, 0x4C,
-    0xDE, 0x15, 0x23, 0xFB, 0x10, 0xF9, 0xE9, 0x6D, 0x26, 0x6C, 0x92, 0xC9, 0xBB, 0xA4, 0xB8, 0xF5,
-    0x0C, 0x5E, 0x42, 0xD2, 0xE7, 0xA3, 0xBC, 0x2E, 0x7E, 0x4C, 0xB0, 0xA5, 0xEB, 0x60, 0x8B, 0x6C,
-    0x4D, 0x04, 0x34, 0xE3, 0x6F, 0xB7, 0x47, 0xD7, 0xEE, 0x07, 0xB6, 0xE9, 0x03, 0x3C, 0xD2, 0xF8,
-    0x01, 0x80, 0xB1, 0xDB, 0xBE, 0x47, 0x57, 0x61, 0xAA, 0x05, 0x21, 0xF7, 0x00, 0x46, 0xAD, 0x4F,
-    0x16, 0x8F, 0xC0, 0x16, 0xFE, 0x1F, 0xD5, 0x5B, 0x3F, 0x8C, 0x1C, 0x67, 0x15, 0x7F, 0x33, 0x9B,
-    0xBB, 0x4D, 0x6E, 0x24, 0x0F, 0x85, 0x85, 0xC0, 0x51, 0x6E, 0x9A, 0x80, 0x00, 0xC5, 0x99, 0x26,
-    0x45, 0x8A, 0xB3, 0x67, 0x4C, 0x84, 0x42, 0xC7, 0x15, 0x08, 0x0B, 0xA5, 0x81, 0x92, 0xEA, 0x52,
-    0xB8, 0xB8, 0x22, 0x99, 0x9D, 0x04, 0x21, 0x24, 0x1A, 0xDC, 0xD3, 0x50, 0xB8, 0x32, 0x8D, 0x0B,
-    0x17, 0x29, 0x72, 0x77, 0x63, 0x53, 0x20, 0x41, 0xC1, 0x4A, 0x29, 0x28, 0x99, 0x18, 0x23, 0x24,
-    0x52, 0x78, 0x10, 0x8B, 0x32, 0x38, 0xBB, 0xFB, 0xF1, 0x7E, 0xEF, 0xBD, 0x6F, 0x66, 0xEF, 0xEC,
-    0x44, 0x42, 0x8A, 0x6F, 0x76, 0xD7, 0xB7, 0x6F, 0xD7, 0xBB, 0x73, 0xF3, 0xBD, 0xEF, 0xF7, 0x7B,
-    0xDF, 0xFB, 0xF7, 0x7D, 0x47, 0x44, 0x19, 0xF1, 0xE3, 0x24, 0x67, 0xE1, 0x58, 0x8C, 0x5C, 0x49,
-    0x34, 0xFE, 0x2B, 0x8B, 0xF8, 0xCF, 0x15, 0x51, 0xF2, 0x6B, 0x16, 0x59, 0xC4, 0xA2, 0x80, 0x98,
-    0x47, 0x53, 0x0A, 0x67, 0xE3, 0x29, 0x8D, 0x9A, 0x71, 0x4D, 0xD1, 0x74, 0x54, 0x53, 0x5C, 0x8D,
-    0x1A, 0x4A, 0x9D, 0x6B, 0x68, 0x02, 0xB1, 0xBC, 0xFD, 0xBB, 0x26, 0x98, 0xF3, 0x45, 0xFC, 0x29,
-    0x5F, 0x59, 0x53, 0xD0, 0xC6, 0x15, 0x8B, 0x94, 0xEF, 0x38, 0xC7, 0x50, 0xF3, 0x63, 0x08, 0xEA,
-    0x1F, 0x41, 0xCD, 0x62, 0x34, 0x83, 0x68, 0xF0, 0xDF, 0xA9, 0xFF, 0x22, 0x5A, 0x8E, 0x2A, 0xCA,
-    0xDC, 0x1F, 0x2A, 0x72, 0xD7, 0x1F, 0x55, 0xA3, 0x96, 0x5C, 0x19, 0xF1, 0x28, 0x39, 0xDF, 0x2F,
-    0xA3, 0xA4, 0x64, 0x91, 0xE5, 0x10, 0xAC, 0x1B, 0xC4, 0x11, 0xBF, 0xF0, 0x8D, 0x0B, 0x0A, 0x20,
-    0xF8, 0xF2, 0x82, 0xA2, 0x19, 0x7F, 0x91, 0xB2, 0xB8, 0xB7, 0x6C, 0x28, 0x71, 0x0F, 0x1A, 0x1A,
-    0xBB, 0xEF, 0xF2, 0x70, 0x5F, 0xE9, 0x06, 0xDF, 0x83, 0x58, 0x74, 0xE2, 0x50, 0x3F, 0x4D, 0x6E,
-    0xB2, 0x48, 0x45, 0xC9, 0x77, 0xFC, 0x55, 0x61, 0xCB, 0x22, 0x86, 0x72, 0xBB, 0xF8, 0xE8, 0xA5,
-    0xEE, 0x16, 0x03, 0xE1, 0xB7, 0x85, 0x61, 0x53, 0xC0, 0xF6, 0xD5, 0x5E, 0xD1, 0x0F, 0xA1, 0x23,
-    0x50, 0x4C, 0xA0, 0xCF, 0x65, 0x7C, 0xF4, 0xDC, 0x39, 0xC2, 0x99, 0xE6, 0xF2, 0xF2, 0x2E, 0x44,
-    0x7C, 0x6F, 0x26, 0xE8, 0x3C, 0x28, 0x05, 0x5D, 0xF9, 0xCF, 0x68, 0x2A, 0x5A, 0x5E, 0x58, 0x41,
-    0x8F, 0x4E, 0xE3, 0x68, 0x48, 0x2A, 0x96, 0x86, 0xA6, 0xE1, 0x69, 0x88, 0x1A, 0xA6, 0x86, 0xAA,
-    0xE1, 0xAA, 0xC8, 0x92, 0x62, 0x4B, 0x8A, 0x2E, 0x29, 0xBE, 0xA4, 0x08, 0x93, 0x62, 0x4C, 0x8A,
-    0x32, 0x09, 0xCE, 0x44, 0x82, 0xB4, 0x18, 0x1E, 0x5E, 0x04, 0x6D, 0x5C, 0x2F, 0x2F, 0x82, 0xB8,
-    0xAA, 0xC5, 0x2F, 0x67, 0xAD, 0x16, 0x60, 0x19, 0xE0, 0xC9, 0x7D, 0xB9, 0xEF, 0x03, 0xFE, 0x20,
-    0x78, 0x8C, 0xB7, 0x63, 0x99, 0xE6, 0x93, 0xB3, 0x14, 0x06, 0x94, 0x02, 0xE1, 0x80, 0x84, 0x04,
-    0x12, 0x16, 0x48, 0x68, 0x50, 0x1E, 0x94, 0x08, 0x65, 0x42, 0xA9, 0x50, 0x2E, 0x94, 0x0C, 0x65,
-    0x43, 0xE9, 0x50, 0x3E, 0x94, 0x10, 0x65, 0xC4, 0x28, 0x31, 0x4E, 0x42, 0xA8, 0x43, 0x82, 0xFD,
-    0x1E, 0x0F, 0x40, 0x2F, 0x64, 0xB5, 0x91, 0x21, 0x54, 0x9C, 0x55, 0x71, 0x38, 0x57, 0xB0, 0xAA,
-    0x68, 0xC2, 0x77, 0x7F, 0x7E, 0x52, 0x1B, 0x9A, 0xE3, 0xA7, 0x28, 0xFA, 0xEC, 0x4D, 0x39, 0xB8,
-    0x29, 0x5A, 0xA9, 0x72, 0x3A, 0x36, 0x38, 0x8D, 0xEF, 0x03, 0xBF, 0xEC, 0xE3, 0xDC, 0x9B, 0xF4,
-    0xE8, 0x73, 0xA8, 0x36, 0x6B, 0x56, 0x63, 0x16, 0x5B, 0x56, 0x53, 0x56, 0x4B, 0x56, 0x43, 0x56,
-    0x3B, 0x56, 0x33, 0x56, 0x2B, 0x16, 0x23, 0x56, 0x1B, 0x56, 0x13, 0x56, 0x0B, 0x56, 0x03, 0x56,
-    0xFB, 0x55, 0xF3, 0x15, 0xEB, 0x55, 0xE3, 0x55, 0xDB, 0x55, 0xD3, 0x55, 0xCB, 0x55, 0xC3, 0x55,
-    0xBB, 0xED, 0x10, 0x0E, 0x7F, 0x0B, 0x01, 0x73, 0xA5, 0x57, 0x6C, 0x36, 0xC9, 0xEF, 0x79, 0x9C,
-    0xC9, 0xC7, 0x43, 0xE2, 0x7C, 0x51, 0xDE, 0xB8, 0xB2, 0x01, 0x3E, 0x8E, 0xD5, 0x19, 0xE7, 0x80,
-    0x2C, 0xD0, 0x6F, 0x63, 0x5D, 0xE7, 0x35, 0x6D, 0x1A, 0xDA, 0x17, 0x69, 0x9F, 0x02, 0xF7, 0x5E,
-    0x4D, 0xA3, 0x47, 0xAE, 0xA2, 0x28, 0x37, 0x9F, 0xC6, 0x4A, 0x60, 0xDC, 0x61, 0x4D, 0x7B, 0x1B,
-    0x90, 0xA4, 0xC0, 0x74, 0x02, 0x07, 0xD8, 0xB6, 0xD0, 0xE3, 0x0A, 0xA2, 0xDA, 0xEE, 0x9A, 0xF8,
-    0x82, 0x2F, 0x48, 0x0B, 0x76, 0x44, 0x79, 0xBC, 0x3D, 0x69, 0xC0, 0x1D, 0x2B, 0x1F, 0x55, 0xEF,
-    0x3C, 0xA1, 0xFC, 0x70, 0x99, 0xC3, 0x29, 0x7B, 0xD4, 0x85, 0x87, 0x79, 0x04, 0xDB, 0x08, 0xD7,
-    0xE3, 0x32, 0xC6, 0x74, 0xFE, 0x8E, 0xA9, 0x06, 0x0E, 0xF9, 0x04, 0x1D, 0xDC, 0x5C, 0x77, 0xC7,
-    0x21, 0x8F, 0xAB, 0x10, 0xAD, 0xAC, 0x40, 0xB6, 0xA0, 0xED, 0x6D, 0x1E, 0xA0, 0x4C, 0xF8, 0x7F,
-    0xFF, 0xE4, 0xD0, 0x14, 0x3A, 0x90, 0x74, 0x50, 0x9E, 0x37, 0x01, 0x16, 0x7D, 0x89, 0xAE, 0xA8,
-    0xB3, 0x10, 0xA3, 0x09, 0xBF, 0xB7, 0xC9, 0x38, 0xCF, 0xBB, 0xE9, 0x60, 0x02, 0xDB, 0xE1, 0xBA,
-    0xE0, 0x2C, 0x29, 0x25, 0xD1, 0xDD, 0x5E, 0x4A, 0x7E, 0x15, 0x44, 0x9B, 0x6A, 0xD5, 0x12, 0x60,
-    0x62, 0x09, 0x2C, 0x77, 0x20, 0x1A, 0xC9, 0x16, 0x19, 0xF2, 0x9D, 0xE1, 0x21, 0x47, 0xF0, 0xD0,
-    0xE8, 0xA1, 0xE1, 0x83, 0xA2, 0x6B, 0xAE, 0x8B, 0x89, 0x81, 0xBC, 0x6E, 0x22, 0xE4, 0x98, 0x56,
-    0xE8, 0xAE, 0x4D, 0x69, 0x2C, 0x31, 0x31, 0x70, 0xA6, 0xE6, 0x16, 0x2A, 0x19, 0x81, 0x7C, 0x3C,
-    0x14, 0xE4, 0x61, 0xBE, 0x0D, 0x78, 0x2A, 0x01, 0xF5, 0xF1, 0xB2, 0x07, 0x35, 0xDD, 0x0C, 0xEF,
-    0xDC, 0xC7, 0x4B, 0x0D, 0x98, 0x1A, 0x31, 0x2D, 0x64, 0x86, 0xF9, 0x0E, 0x0C, 0x06, 0x26, 0xFD,
-    0x78, 0x01, 0x7C, 0xDB, 0x41, 0xBC, 0xC8, 0xD3, 0xC2, 0x65, 0x8A, 0x94, 0x2F, 0x73, 0xAE, 0x52,
-    0x51, 0xE0, 0xB3, 0xA3, 0xCE, 0xAF, 0xCF, 0xBD, 0x40, 0x31, 0x26, 0xF5, 0x19, 0x8D, 0x96, 0xB7,
-    0x6F, 0x21, 0x51, 0x9C, 0xA9, 0xB0, 0x22, 0xCF, 0x67, 0x8A, 0x22, 0x92, 0xD2, 0x57, 0xBF, 0x52,
-    0x8C, 0x0A, 0x5F, 0xD9, 0xED, 0xDB, 0x25, 0x10, 0xAE, 0xE8, 0xC4, 0xB9, 0x53, 0x33, 0x97, 0x0A,
-    0xF9, 0xB8, 0x13, 0xAF, 0x77, 0x88, 0xF0, 0x65, 0x19, 0x33, 0xE2, 0xAE, 0xCF, 0x46, 0x6D, 0xD0,
-    0x46, 0x35, 0xD2, 0x95, 0x70, 0x96, 0x94, 0xE3, 0x26, 0xBB, 0x76, 0x32, 0x65, 0x75, 0xF9, 0xEB,
-    0x87, 0x54, 0xE4, 0x52, 0x99, 0xC9, 0x33, 0xB3, 0x9A, 0x30, 0xA9, 0x5F, 0xCC, 0x23, 0xE7, 0xF2,
-    0xC0, 0x2D, 0xAC, 0x48, 0xB7, 0xE9, 0x2E, 0x6C, 0x3A, 0x37, 0x64, 0x80, 0x87, 0x50, 0x58, 0xA0,
-    0x48, 0x21, 0x5E, 0xC5, 0x3C, 0x31, 0x77, 0x14, 0x75, 0x9C, 0x31, 0x42, 0x74, 0x55, 0xF5, 0x50,
-    0x30, 0x5D, 0x84, 0xA9, 0xF3, 0xEF, 0xBD, 0xD5, 0xA8, 0x8B, 0x44, 0x91, 0x96, 0x56, 0x5A, 0xDF,
-    0x1F, 0x76, 0x35, 0xE6, 0x97, 0x0B, 0xD6, 0x45, 0xFA, 0x09, 0xAF, 0x3E, 0x2E, 0x08, 0x46, 0xEE,
-    0xB3, 0x9A, 0xC6, 0xEF, 0xC3, 0x57, 0x08, 0x3A, 0x34, 0x34, 0x1C, 0x41, 0x1E, 0xF2, 0xD5, 0x6D,
-    0x8C, 0x0A, 0x9E, 0xAD, 0xE5, 0x10, 0xFD, 0xA1, 0xB7, 0x25, 0xBB, 0xA3, 0x55, 0xB3, 0x11, 0x28,
-    0x80, 0x05, 0x01, 0x0C, 0x02, 0x1A, 0x04, 0x38, 0x08, 0x78, 0x10, 0x00, 0x81, 0xDE, 0x24, 0x90,
-    0x08, 0x26, 0x3A, 0x83, 0xA2, 0xF3, 0x2E, 0xD2, 0x58, 0x00, 0x30, 0x04, 0x64, 0x48, 0xA0, 0xE9,
-    0x0C, 0x49, 0x1A, 0x50, 0xA2, 0xE4, 0xB8, 0x91, 0xDE, 0x43, 0x8B, 0xBA, 0xAE, 0xC0, 0xDB, 0x60,
-    0xF6, 0xAA, 0x84, 0x86, 0xF1, 0x19, 0x97, 0x25, 0x78, 0x29, 0x56, 0x26, 0x65, 0x2C, 0xC5, 0xCC,
-    0x52, 0xA8, 0x79, 0x2F, 0x05, 0x37, 0x05, 0x4E, 0x91, 0x53, 0xD4, 0x4C, 0x0A, 0x78, 0x8A, 0x9E,
-    0x95, 0x67, 0x2A, 0x05, 0x40, 0x45, 0xD0, 0xBA, 0x40, 0xEA, 0x29, 0x05, 0x44, 0x45, 0xF1, 0xEC,
-    0xE2, 0x3B, 0xB2, 0x61, 0x26, 0xF0, 0x91, 0xEE, 0x57, 0x7C, 0xEF, 0x7F, 0xA0, 0xB2, 0xB8, 0xD6,
-    0x60, 0x1D, 0xBE, 0x76, 0x8E, 0xB0, 0xB6, 0x9D, 0x7F, 0x8A, 0xF9, 0x56, 0xB4, 0x9D, 0xB4, 0x06,
-    0xA9, 0x20, 0x7A, 0x06, 0xD0, 0x01, 0x7D, 0x16, 0x70, 0x42, 0xFE, 0x4D, 0xCD, 0x84, 0xE8, 0x65,
-    0xFE, 0x10, 0x80, 0x01, 0xAF, 0x55, 0xB8, 0xBE, 0x64, 0xCF, 0x75, 0x4B, 0x9B, 0x71, 0x7A, 0x6B,
-    0x2D, 0x61, 0x61, 0x64, 0x4D, 0x2B, 0xB6, 0x97, 0x6F, 0x9E, 0xED, 0x49, 0x05, 0xB9, 0xD3, 0xF8,
-    0x44, 0x36, 0x40, 0xEC, 0x8D, 0xF9, 0x33, 0xF7, 0x8B, 0xE1, 0x0C, 0x90, 0x25, 0xBB, 0xDA, 0xC9,
-    0x94, 0x7D, 0xEA, 0x67, 0x3C, 0x48, 0x38, 0x9D, 0xF8, 0x1E, 0xF8, 0x58, 0x7A, 0xB9, 0x67, 0xED,
-    0x31, 0x5F, 0x07, 0x7B, 0xDC, 0x0F, 0x72, 0x1A, 0x2F, 0x47, 0x25, 0xC5, 0x27, 0x3C, 0xEB, 0x97,
-    0xC2, 0x85, 0xD7, 0x68, 0x22, 0x16, 0x53, 0x9E, 0x86, 0xF3, 0xC6, 0x79, 0xC2, 0x29, 0xBD, 0x2E,
-    0x09, 0xA4, 0xD2, 0xC3, 0x3F, 0xBA, 0x82, 0xD0, 0x95, 0xAC, 0x0F, 0x74, 0x5F, 0x9C, 0x7E, 0x7C,
-    0x47, 0x13, 0xCC, 0x10, 0x91, 0xEF, 0xA3, 0x9A, 0xD2, 0x6B, 0x33, 0x0E, 0xB6, 0x87, 0x74, 0x6E,
-    0xA9, 0x49, 0x51, 0x5A, 0x6B, 0xC8, 0xA2, 0x3E, 0xA6, 0x99, 0x95, 0xDA, 0xFF, 0xBC, 0xE1, 0x91,
-    0x03, 0x70, 0x53, 0x0A, 0xFF, 0x4B, 0xBE, 0x7F, 0x2E, 0x4F, 0x5C, 0x8A, 0x2C, 0x17, 0x9E, 0x2A,
-    0xB6, 0x27, 0x10, 0x01, 0x16, 0x19, 0xF5, 0xCF, 0xC2, 0x90, 0x9E, 0xDB, 0xB3, 0xD5, 0xED, 0x95,
-    0x09, 0x4F, 0xED, 0x04, 0xAB, 0x75, 0x4B, 0x76, 0x36, 0xB0, 0xAF, 0xB1, 0x07, 0x36, 0x38, 0x19,
-    0x65, 0x48, 0x77, 0xFD, 0x5E, 0xC6, 0xBB, 0xF2, 0xCB, 0x73, 0xF9, 0x69, 0x41, 0x8F, 0xA6, 0xCB,
-    0xFC, 0xC3, 0xE3, 0xF3, 0xF0, 0x4C, 0x09, 0x0F, 0xCC, 0x3F, 0x3C, 0x34, 0x8F, 0x9C, 0xEA, 0x98,
-    0xCF, 0x5A, 0x67, 0xBF, 0x62, 0x4B, 0x0D, 0xD2, 0xB8, 0x8D, 0x58, 0x5B, 0x50, 0x8A, 0x66, 0x8D,
-    0xBA, 0x6E, 0xDF, 0x07, 0xCC, 0x71, 0x7F, 0xED, 0xF1, 0x5F, 0x95, 0x7B, 0xFB, 0x19, 0xF1, 0x74,
-    0x82, 0xD9, 0xA9, 0x19, 0xF1, 0x74, 0xA2, 0xCA, 0x5C, 0x9D, 0xEE, 0x3E, 0xE9, 0xF6, 0xC0, 0xE5,
-    0xFE, 0x76, 0x93, 0x25, 0x12, 0x02, 0xE7, 0x78, 0x2A, 0xE9, 0xE3, 0x03, 0xBE, 0xCF, 0x49, 0x19,
-    0x2C, 0x29, 0x58, 0x60, 0x31, 0xA2, 0x22, 0xC8, 0xF2, 0x08, 0x5F, 0x95, 0x32, 0xB7, 0x0A, 0x85,
-    0x44, 0x5C, 0xC1, 0x20, 0x58, 0x8A, 0xE1, 0x4E, 0xA4, 0x35, 0x59, 0x88, 0x84, 0x25, 0xA6, 0xE5,
-    0xB1, 0x98, 0xCC, 0xB1, 0x2C, 0x67, 0xC8, 0x13, 0x59, 0xD6, 0x0B, 0x8C, 0x3B, 0xE2, 0x22, 0xA4,
-    0x12, 0x4E, 0x6A, 0xCA, 0x58, 0xB7, 0xE5, 0x8F, 0x18, 0x82, 0xD0, 0xC9, 0xFA, 0x03, 0xC8, 0xFC,
-    0xF8, 0x61, 0xAF, 0x5A, 0x28, 0x1F, 0x44, 0x75, 0x2F, 0x47, 0xFD, 0x12, 0x18, 0x3B, 0x71, 0xD0,
-    0x5C, 0xF3, 0xB8, 0xEB, 0x73, 0x54, 0x12, 0xC7, 0xB8, 0x26, 0xD3, 0xBD, 0x90, 0xD4, 0x6A, 0x0E,
-    0x13, 0x85, 0x89, 0x42, 0xD1, 0x2A, 0xB4, 0x18, 0x62, 0x0A, 0xB2, 0x9C, 0xC1, 0x4D, 0x1E, 0x1E,
-    0x4C, 0xBD, 0x23, 0x68, 0xA9, 0xEB, 0x20, 0x5B, 0x66, 0xAD, 0x3E, 0x69, 0xD2, 0x35, 0xBF, 0x79,
-    0xBD, 0x69, 0x05, 0x37, 0xED, 0xF7, 0x1E, 0x34, 0x93, 0x7B, 0x71, 0xDA, 0xD7, 0x77, 0xDA, 0xEE,
-    0xB8, 0xB3, 0xEE, 0x30, 0x6F, 0x75, 0x4D, 0xF2, 0x6F, 0x4A, 0xE0, 0xFC, 0x40, 0xE2, 0xB1, 0x38,
-    0x47, 0xDF, 0xB9, 0xDB, 0x23, 0xCB, 0xE6, 0xCF, 0x0B, 0xF5, 0x79, 0x87, 0xAB, 0x54, 0xC0, 0x81,
-    0xFB, 0x31, 0xC6, 0xFD, 0x44, 0x3C, 0xA4, 0x6C, 0x4F, 0x1D, 0xD2, 0xDB, 0x67, 0x52, 0x85, 0x35,
-    0xB6, 0x61, 0x5D, 0xFC, 0x88, 0x03, 0xD9, 0x9B, 0xFC, 0x9D, 0xFB, 0x23, 0xDF, 0xE0, 0x53, 0xAC,
-    0x71, 0xEC, 0x5B, 0x7C, 0x8B, 0xFF, 0xAD, 0x3C, 0x9E, 0x31, 0xB8, 0xB1, 0x2C, 0x9E, 0x51, 0xA5,
-    0x15, 0xBF, 0x84, 0xAC, 0x9F, 0x4A, 0x1F, 0x62, 0x43, 0xC1, 0x1D, 0x57, 0xDD, 0xD2, 0xBB, 0x8B,
-    0x01, 0x5F, 0x86, 0x2B, 0x1D, 0x0A, 0x5C, 0x64, 0x86, 0xF9, 0x4A, 0xBF, 0xB3, 0xE9, 0xFA, 0x2A,
-    0x45, 0x8C, 0x0E, 0x9C, 0xFB, 0xFE, 0xA6, 0x02, 0xBD, 0x8D, 0x46, 0xD6, 0xCE, 0xCC, 0xC7, 0x7B,
-    0x84, 0xF6, 0xEC, 0x4D, 0x64, 0xBD, 0xF7, 0x86, 0x44, 0x3B, 0x0F, 0x00, 0xD6, 0x02, 0x21, 0x33,
-    0x41, 0x12, 0x49, 0xAF, 0x8C, 0xE7, 0xA7, 0xD7, 0x1C, 0x5F, 0xFF, 0xA4, 0x71, 0xDF, 0xD9, 0x08,
-    0xCC, 0xF7, 0x29, 0xE7, 0x84, 0xF1, 0x0D, 0x8E, 0xDC, 0x8F, 0x78, 0x0E, 0x17, 0xC2, 0xE5, 0xA9,
-    0x83, 0x03, 0x6A, 0xE6, 0xF5, 0x40, 0xC0, 0x7F, 0xBB, 0xAF, 0xEA, 0x42, 0xC9, 0x48, 0xA3, 0xBF,
-    0x40, 0xF3, 0x4C, 0x3C, 0xF6, 0x07, 0x16, 0xF8, 0x36, 0x3B, 0xBD, 0xB8, 0x24, 0x8A, 0xA3, 0x6D,
-    0x23, 0xDB, 0xCA, 0x7F, 0xC3, 0xF9, 0x88, 0xB2, 0xC5, 0xEE, 0xCA, 0xDE, 0xF9, 0x7A, 0x94, 0xCF,
-    0xCB, 0x40, 0xA4, 0x48, 0xF1, 0x9B, 0x10, 0xD2, 0xDC, 0xF5, 0x36, 0x6F, 0x1D, 0x09, 0x9B, 0x9B,
-    0xAC, 0x82, 0x7D, 0xF2, 0x13, 0x64, 0x2E, 0x38, 0xBD, 0x04, 0x19, 0x49, 0x25, 0x6C, 0x64, 0x42,
-    0x87, 0x9B, 0x2B, 0x1F, 0xB5, 0x11, 0x42, 0xCA, 0x88, 0x66, 0xB3, 0x15, 0x29, 0x27, 0xA4, 0xA4,
-    0x90, 0xB2, 0x42, 0x4A, 0x0B, 0x29, 0x2F, 0xA4, 0xC4, 0x90, 0x32, 0x43, 0x4A, 0x8D, 0x71, 0x63,
-    0xE4, 0x18, 0x3B, 0x46, 0x8F, 0xF1, 0x63, 0x04, 0x79, 0x86, 0x3C, 0x45, 0x1D, 0x47, 0x3F, 0x13,
-    0xFD, 0xE7, 0x7D, 0x57, 0x5A, 0x13, 0xD9, 0xD4, 0x6A, 0x8F, 0x9D, 0xB2, 0xDB, 0x16, 0xC7, 0xE8,
-    0x4C, 0x47, 0x26, 0x7C, 0x2C, 0x40, 0x08, 0x0A, 0xAD, 0x16, 0xC9, 0x98, 0x50, 0x62, 0x9A, 0x77,
-    0x79, 0x73, 0xF7, 0x53, 0x78, 0x59, 0xF8, 0x4C, 0xBA, 0xB0, 0x93, 0x3B, 0x48, 0xD0, 0x85, 0x1C,
-    0x65, 0x47, 0xE9, 0xF1, 0xCD, 0x7D, 0x23, 0xE8, 0x52, 0xBE, 0x72, 0xD6, 0xC0, 0xBA, 0x0B, 0xA6,
-    0xAA, 0x1D, 0x48, 0x59, 0xD9, 0xDC, 0xDD, 0x58, 0x22, 0xC2, 0x9B, 0x2B, 0xFB, 0x02, 0xED, 0x4A,
-    0xF7, 0xE5, 0xAA, 0xB5, 0x76, 0x86, 0x27, 0xC2, 0x72, 0x72, 0x4B, 0xCA, 0x2D, 0x2B, 0xB7, 0xDC,
-    0xC0, 0xF2, 0x72, 0x7F, 0x38, 0xCC, 0x1C, 0xD4, 0x9D, 0x0D, 0x5E, 0x18, 0x5A, 0x7E, 0xEB, 0xD9,
-    0x16, 0xCD, 0xDB, 0x25, 0x71, 0xD7, 0xCC, 0x5D, 0x53, 0x77, 0xE3, 0x66, 0x4F, 0xB8, 0xB9, 0x38,
-    0x28, 0x37, 0x5B, 0xF4, 0xBC, 0xAA, 0x2B, 0xCE, 0xD3, 0x2D, 0xC5, 0xC1, 0xD5, 0x27, 0x72, 0x30,
-    0xA3, 0x8A, 0xCA, 0x4D, 0x5F, 0x1D, 0xC1, 0x7E, 0x88, 0x21, 0x17, 0xD8, 0x77, 0x49, 0xDD, 0x23,
-    0x39, 0x84, 0x86, 0xCB, 0x5E, 0x0B, 0x6E, 0xAD, 0xC1, 0xBA, 0xD8, 0x68, 0xFF, 0xAF, 0x8A, 0xE7,
-    0xFD, 0xE9, 0xA7, 0xEE, 0xA5, 0xDB, 0xDF, 0xA2, 0xB5, 0xC0, 0xD8, 0xAA, 0x64, 0xDD, 0x9E, 0x34,
-    0x79, 0xE8, 0x8B, 0x59, 0x2E, 0xBB, 0xE6, 0x48, 0x20, 0xE4, 0x5C, 0x68, 0x8E, 0xF6, 0x51, 0x2A,
-    0xCE, 0x34, 0x33, 0x89, 0x26, 0x52, 0x21, 0xF2, 0x48, 0x42, 0xC8, 0x5C, 0x80, 0x57, 0xD9, 0xA2,
-    0x9D, 0x84, 0xFD, 0xDB, 0x1C, 0x6D, 0x9D, 0x54, 0xBC, 0x70, 0xE6, 0x25, 0xFF, 0x4A, 0x21, 0x51,
-    0xA7, 0x90, 0xA9, 0x15, 0x02, 0x83, 0x9D, 0x00, 0x2D, 0x91, 0xA1, 0x25, 0xFF, 0x79, 0x6B, 0x2E,
-    0x3A, 0xA3, 0x23, 0x27, 0x9A, 0x53, 0x90, 0x9F, 0x45, 0xB6, 0x83, 0x0E, 0x60, 0x9A, 0x17, 0x89,
-    0xB0, 0xBB, 0x1C, 0x77, 0x22, 0x29, 0x79, 0xA8, 0x24, 0xE7, 0x91, 0x52, 0xC5, 0xD0, 0x6F, 0xEE,
-    0x16, 0x68, 0x46, 0x1D, 0x41, 0x3B, 0x64, 0x33, 0x01, 0x04, 0xE3, 0x9D, 0xF5, 0x5B, 0xBA, 0xEF,
-    0x3D, 0xB6, 0x2D, 0xDD, 0xC8, 0xBD, 0x51, 0x23, 0xAF, 0xA5, 0x95, 0xCE, 0xA1, 0x02, 0x25, 0xE1,
-    0x5D, 0x7B, 0x83, 0x68, 0xAF, 0xA1, 0x61, 0x9F, 0xFB, 0x1D, 0x0B, 0x2F, 0x0F, 0xF0, 0x89, 0x76,
-    0x89, 0x35, 0xB1, 0x09, 0xFB, 0xA6, 0xD9, 0x9A, 0x22, 0x7C, 0xF6, 0x88, 0xF5, 0x9E, 0x0F, 0x9B,
-    0x51, 0x77, 0xC4, 0x7A, 0x77, 0xF5, 0x88, 0xF5, 0xB3, 0x47, 0xFD, 0xFF, 0x49, 0x1A, 0x7D, 0xE4,
-    0x9F, 0x0B, 0xBC, 0x3F, 0x9F, 0x09, 0xBE, 0xBF, 0x6C, 0x04, 0xE0, 0x1F, 0x54, 0x82, 0xB0, 0xCB,
-    0x05, 0xDC, 0x56, 0x31, 0xCE, 0x0D, 0x64, 0x43, 0xD9, 0x60, 0x36, 0x9C, 0xFD, 0x8B, 0x22, 0x6D,
-    0x50, 0x1B, 0xD6, 0x06, 0xB6, 0xA1, 0x6D, 0x70, 0x1B, 0xDE, 0x06, 0xB8, 0x21, 0x6E, 0x90, 0x1B,
-    0xE6, 0x06, 0xBA, 0x47, 0xDD, 0xBB, 0x39, 0x6D, 0x81, 0x13, 0x49, 0xC5, 0x24, 0xC7, 0xEE, 0x6D,
-    0xEB, 0x47, 0x9B, 0x1F, 0x97, 0x2D, 0xA9, 0xB4, 0x35, 0x3A, 0x07, 0xEA, 0xF7, 0x71, 0xAE, 0x30,
-    0xFE, 0x53, 0x0D, 0xE9, 0x4A, 0x00, 0xDF, 0x92, 0x20, 0x4F, 0x02, 0xBD, 0x79, 0x8D, 0xEE, 0x88,
-    0x75, 0x41, 0x0A, 0xBF, 0xE2, 0xAF, 0x04, 0x28, 0x03, 0x4A, 0x81, 0x3F, 0x56, 0x0D, 0x12, 0xEC,
-    0x58, 0xB5, 0xD2, 0xE0, 0x79, 0xB8, 0x74, 0xCA, 0xA1, 0xA9, 0x81, 0xD3, 0xA8, 0x7E, 0x7A, 0xD2,
-    0xB8, 0xB1, 0x44, 0x04, 0xB7, 0xFA, 0xE4, 0xDD, 0xB6, 0xEC, 0x74, 0x67, 0x2D, 0xCE, 0xAD, 0xD5,
-    0x3D, 0x38, 0x11, 0xEA, 0x6E, 0xFC, 0xDF, 0x09, 0x78, 0x26, 0xEC, 0xE5, 0x40, 0x27, 0xB3, 0x58,
-    0x5D, 0x18, 0xF0, 0x3A, 0x1B, 0xBB, 0x30, 0x34, 0x69, 0x14, 0x8F, 0x44, 0x5F, 0x9F, 0xAF, 0x04,
-    0x2D, 0xC9, 0xE5, 0x65, 0xC7, 0xCB, 0xB8, 0xD9, 0x95, 0x45, 0xF2, 0xDC, 0xA0, 0xDC, 0x6C, 0xD1,
-    0xD7, 0xA4, 0xE8, 0xF5, 0x49, 0xE3, 0x4C, 0xD2, 0x79, 0x49, 0x1A, 0xC3, 0x6A, 0xA7, 0xDC, 0x78,
-    0x37, 0xB5, 0x1F, 0x60, 0x93, 0x53, 0xFE, 0xA6, 0x23, 0x76, 0x8F, 0xF8, 0xFD, 0x6E, 0x24, 0x4D,
-    0x2C, 0x4E, 0xE4, 0x07, 0x5F, 0x17, 0x9B, 0xED, 0xFF, 0x57, 0x93, 0xC6, 0xB4, 0x5A, 0x8D, 0x75,
-    0x17, 0xFA, 0xEF, 0xD7, 0x02, 0x63, 0xDB, 0x85, 0x3B, 0x5E, 0x91, 0xAF, 0xF7, 0x8D, 0x64, 0x69,
-    0x2A, 0x48, 0xEC, 0xD2, 0x6A, 0xB6, 0x3F, 0x69, 0xB2, 0x72, 0x82, 0x39, 0x29, 0x8F, 0xAC, 0xB1,
-    0xB4, 0xE8, 0x52, 0x81, 0x86, 0x95, 0xE2, 0x34, 0x3F, 0x29, 0x93, 0x52, 0xBB, 0x68, 0x71, 0xC5,
-    0x13, 0x8D, 0xEE, 0xE1, 0xB0, 0xFE, 0x47, 0xD8, 0xB8, 0xFC, 0x64, 0x6A, 0xAD, 0x3B, 0x3D, 0x47,
-    0xB9, 0x78, 0xCA, 0x66, 0x75, 0xD3, 0x89, 0xDA, 0x6B, 0xD1, 0x6F, 0x56, 0xFB, 0xA4, 0xDB, 0x7A,
-    0x66, 0x4D, 0x5F, 0x7A, 0xEA, 0x1F, 0x92, 0xAD, 0xEE, 0x2E, 0x92, 0x1D, 0xB2, 0xC0, 0xA6, 0xAA,
-    0xEC, 0xA8, 0x76, 0x40, 0x2E, 0x20, 0x01, 0x9B, 0xA4, 0x3D, 0x34, 0x9E, 0xCA, 0x66, 0x6A, 0x8D,
-    0x11, 0x46, 0x35, 0x36, 0x51, 0x47, 0x4D, 0x26, 0xB7, 0x2F, 0x04, 0x02, 0x28, 0x18, 0xFE, 0x0B,
-    0xA3, 0x04, 0xFF, 0x16, 0xDE, 0x3F, 0x15, 0x9F, 0xAC, 0xBB, 0xA7, 0x6A, 0x02, 0xCB, 0xB3, 0x87,
-    0x41, 0x54, 0x35, 0x55, 0x53, 0xC2, 0xED, 0x37, 0x4E, 0x24, 0x0E, 0x2D, 0xFA, 0xF2, 0x79, 0x38,
-    0x0C, 0xBB, 0xF3, 0xD1, 0x5D, 0x5F, 0x37, 0xEB, 0x92, 0xC2, 0x01, 0x11, 0x3B, 0x14, 0xC4, 0x16,
-    0x82, 0xD8, 0x5C, 0x10, 0xBB, 0x7B, 0x1A, 0x31, 0x0D, 0x9B, 0x9A, 0xA4, 0x4B, 0x52, 0x25, 0x25,
-    0xFC, 0x81, 0x4F, 0xB7, 0x64, 0xA7, 0x7A, 0x54, 0x0D, 0x6E, 0xA2, 0xB6, 0x65, 0xA9, 0xB3, 0xFD,
-    0x4D, 0xDD, 0xB7, 0x83, 0x34, 0xD3, 0x9A, 0x94, 0x5D, 0xD7, 0x44, 0xB7, 0x6A, 0x56, 0x16, 0xE6,
-    0x1A, 0x9B, 0x2B, 0xC7, 0xC5, 0x17, 0xF8, 0x7D, 0xC3, 0x2B, 0xEC, 0x64, 0xF9, 0x21, 0x4E, 0x73,
-    0xCD, 0x28, 0x98, 0x6E, 0x97, 0x6B, 0xE1, 0x15, 0x82, 0x7C, 0x4B, 0x32, 0x8C, 0x0B, 0xF2, 0x97,
-    0x92, 0xC8, 0xF9, 0xEE, 0xA6, 0xF8, 0xE5, 0x7A, 0xFB, 0xE6, 0xC6, 0xF8, 0x83, 0xFF, 0x01, 0xC5,
-    0x58, 0xBF, 0x93, 0xDC, 0x48, 0x15, 0x7E, 0x92, 0xBC, 0x96, 0xCF, 0x2A, 0xAC, 0x0D, 0x76, 0x29,
-    0xCE, 0xAE, 0xB3, 0x2E, 0xBD, 0xC3, 0xB7, 0x22, 0x20, 0x70, 0xB0, 0x3B, 0x6A, 0xDB, 0xFF, 0xC0,
-    0x06, 0x1E, 0x5C, 0x85, 0x83, 0x4B, 0x08, 0x0C, 0x89, 0x09, 0x1C, 0xB8, 0xA8, 0xD9, 0x55, 0x1B,
-    0x02, 0x02, 0x12, 0x07, 0xB8, 0xA8, 0x22, 0x72, 0xE0, 0x00, 0x7C, 0xC1, 0x3A, 0xD8, 0x60, 0x29,
-    0x66, 0xAD, 0xB6, 0x2F, 0xB8, 0x54, 0x55, 0xD4, 0x41, 0x15, 0x24, 0xA2, 0x8C, 0x13, 0x2E, 0x40,
-    0x60, 0x01, 0xE2, 0xD0, 0x4C, 0xDF, 0xF7, 0xBA, 0x5B, 0x3B, 0x33, 0x7B, 0xFE, 0xB5, 0xE7, 0xA2,
-    0x90, 0xA6, 0x5B, 0xA3, 0xEE, 0xD7, 0xAF, 0x5F, 0xBF, 0x7E, 0xEF, 0x7B, 0xAF, 0x45, 0x8A, 0xA8,
-    0x26, 0x5A, 0xA7, 0x42, 0xD3, 0x83, 0x75, 0xBA, 0xFB, 0x80, 0xEE, 0x2A, 0xBA, 0x4B, 0x5F, 0xFD,
-    0xB7, 0x49, 0x44, 0x8A, 0x02, 0x49, 0x31, 0x51, 0xA6, 0xE5, 0xA9, 0x40, 0x06, 0x3F, 0x96, 0xF4,
-    0x58, 0x92, 0xFF, 0x06, 0x3F, 0x4F, 0x2C, 0x0D, 0x45, 0xAA, 0x55, 0xA6, 0xD5, 0xEA, 0x70, 0xE1,
-    0x3F, 0xF1, 0x95, 0x6A, 0xAD, 0x45, 0x86, 0x8A, 0x56, 0x87, 0xC3, 0x21, 0x2D, 0x0D, 0x87, 0x97,
-    0xD1, 0xD4, 0xA2, 0xA5, 0x45, 0xC3, 0x26, 0xDE, 0xF9, 0xE2, 0x36, 0xBE, 0xB8, 0xDD, 0x3C, 0x57,
-    0x6D, 0xFB, 0x2B, 0xFB, 0x37, 0x49, 0x34, 0x7E, 0xF5, 0xBF, 0xFE, 0x91, 0xBD, 0x62, 0xAD, 0xBB,
-    0x04, 0xC5, 0xBD, 0xD2, 0xFB, 0xF7, 0xEF, 0xDF, 0x85, 0x40, 0x35, 0x2F, 0x84, 0x76, 0xBD, 0x3A,
-    0xA8, 0x22, 0x15, 0xAB, 0x4C, 0xE4, 0x34, 0xA5, 0xCB, 0xE4, 0x37, 0x41, 0x1D, 0x55, 0xB1, 0x4A,
-    0x64, 0x46, 0x1B, 0x34, 0x86, 0xF6, 0xBD, 0x2E, 0x68, 0xD1, 0x56, 0xA2, 0x4D, 0x0C, 0x68, 0x44,
-    0xCB, 0x34, 0xA0, 0xCC, 0xDD, 0x29, 0x25, 0xD8, 0x96, 0x25, 0xA2, 0xDD, 0x48, 0x78, 0x75, 0x42,
-    0x41, 0x95, 0x51, 0xA4, 0xF6, 0x29, 0x56, 0x1D, 0x65, 0x17, 0x5B, 0xCA, 0x83, 0x9A, 0xA6, 0x51,
-    0x45, 0x97, 0x97, 0x04, 0x38, 0xA7, 0x32, 0xA8, 0x33, 0x11, 0x55, 0x39, 0xFA, 0x27, 0x94, 0xC8,
-    0x96, 0x32, 0xBF, 0xA6, 0x8D, 0xA0, 0xA2, 0x71, 0xA8, 0x68, 0x13, 0x6C, 0xBC, 0x2E, 0x51, 0x41,
-    0x6B, 0xE8, 0x28, 0x2A, 0x1F, 0x1A, 0x3E, 0xC9, 0x85, 0x86, 0x06, 0xE0, 0x33, 0x0A, 0x14, 0x2D,
-    0x7B, 0x44, 0xDB, 0x61, 0xB9, 0x1D, 0x95, 0x59, 0x58, 0xF1, 0x2F, 0xA8, 0xD2, 0xA0, 0x4A, 0xFC,
-    0x2A, 0xF6, 0xEA, 0x25, 0x96, 0x15, 0xC6, 0x82, 0xE9, 0x30, 0x16, 0xEB, 0x86, 0x21, 0xC6, 0x12,
-    0x05, 0x5B, 0xCA, 0xA6, 0xB3, 0xB3, 0x83, 0x1D, 0xD6, 0xF2, 0x47, 0xDB, 0x1F, 0x09, 0x58, 0x27,
-    0x99, 0x72, 0x13, 0x65, 0x0F, 0xA5, 0x21, 0x63, 0xB4, 0x1E, 0x0A, 0x24, 0xC2, 0x32, 0x6C, 0x09,
-    0xCB, 0x19, 0xAB, 0x04, 0x25, 0x45, 0xC9, 0x24, 0x2B, 0x71, 0x15, 0x25, 0x47, 0xD9, 0x47, 0x19,
-    0x1F, 0x30, 0xF1, 0x7F, 0xFE, 0xCF, 0x6B, 0x01, 0x54, 0x1D, 0x62, 0xAF, 0xC9, 0xC7, 0xC0, 0xA0,
-    0x5C, 0x64, 0x62, 0x8A, 0x95, 0x67, 0xF5, 0xEC, 0x92, 0x28, 0x20, 0x0F, 0x8A, 0x10, 0xEB, 0x9E,
-    0x95, 0x87, 0x59, 0x75, 0xAC, 0x06, 0xC8, 0xD1, 0xE2, 0x29, 0xD2, 0x26, 0xEF, 0x8A, 0x89, 0x9E,
-    0x16, 0xD3, 0x62, 0x92, 0x75, 0xBC, 0x34, 0x0A, 0x04, 0x85, 0x15, 0x45, 0x1D, 0x36, 0x56, 0xC4,
-    0xBA, 0x8A, 0x75, 0x93, 0x68, 0x91, 0x56, 0xD8, 0x2D, 0x7B, 0x25, 0x22, 0x53, 0x39, 0xF6, 0xF3,
-    0x98, 0x7B, 0x8B, 0x65, 0xA6, 0x52, 0x6E, 0x41, 0x5B, 0x26, 0x8F, 0xF1, 0x6E, 0xB9, 0x9E, 0x48,
-    0x41, 0x83, 0x2A, 0x2D, 0xE3, 0x3A, 0x37, 0x75, 0x26, 0x52, 0x15, 0x97, 0x4C, 0xE1, 0x41, 0xC6,
-    0x94, 0x72, 0x51, 0x88, 0x82, 0x56, 0x98, 0x98, 0x9D, 0x99, 0xDE, 0xC8, 0x8D, 0x67, 0xCE, 0x6C,
-    0xDC, 0x98, 0x1D, 0xDA, 0x7F, 0xE3, 0x9F, 0x27, 0xF4, 0xC2, 0xE5, 0xCB, 0xD7, 0xBB, 0x79, 0xDC,
-    0xD3, 0x61, 0x49, 0x7C, 0x57, 0x74, 0xB4, 0x71, 0xC3, 0xAB, 0x14, 0x9A, 0x3B, 0x3A, 0xCA, 0x38,
-    0x3A, 0xB8, 0xF2, 0x92, 0x8C, 0x6F, 0xFA, 0xBA, 0x86, 0xAF, 0xE0, 0x4F, 0x58, 0xB5, 0xD8, 0x0C,
-    0xF6, 0x54, 0x39, 0x86, 0x6F, 0xF1, 0xD6, 0xC0, 0x10, 0xD8, 0x14, 0x68, 0x8D, 0xC6, 0x6C, 0x93,
-    0x84, 0xCD, 0xDD, 0x63, 0x5B, 0xE2, 0x3F, 0x6D, 0x6C, 0x2C, 0x70, 0x44, 0x4D, 0x6A, 0xF8, 0x8D,
-    0xBC, 0x7A, 0x74, 0x5A, 0xD0, 0xF7, 0xE1, 0x20, 0x55, 0xA3, 0xEB, 0x40, 0xAB, 0x8D, 0xF0, 0xE3,
-    0x27, 0x9F, 0xB7, 0xF1, 0x67, 0x55, 0x76, 0xFD, 0x67, 0x9F, 0x94, 0xE3, 0xD4, 0xAF, 0x93, 0x69,
-    0x12, 0xCB, 0xD1, 0xC0, 0xAB, 0x8F, 0xFF, 0x65, 0x23, 0xA1, 0xD1, 0x88, 0x99, 0xB6, 0x29, 0x8D,
-    0x98, 0xBB, 0x5F, 0x0F, 0x68, 0xDC, 0xC2, 0xEC, 0x43, 0x85, 0x59, 0x1A, 0xD8, 0x7D, 0x2C, 0x36,
-    0xA8, 0x69, 0x30, 0xDF, 0x80, 0x36, 0xBC, 0xBA, 0x86, 0x6F, 0x8E, 0xD9, 0x4B, 0x9B, 0x58, 0x82,
-    0x3C, 0x8B, 0x14, 0x46, 0xA2, 0x13, 0x56, 0x57, 0x4C, 0xD8, 0xC3, 0xA2, 0x09, 0xA5, 0x8D, 0x11,
-    0x05, 0x0E, 0x48, 0x8B, 0x57, 0xBF, 0xD8, 0xF9, 0xF5, 0xCE, 0x2F, 0x79, 0x7E, 0xD5, 0xF3, 0x0B,
-    0x9F, 0x5F, 0xFB, 0xFC, 0xF2, 0xE7, 0x35, 0x30, 0xAF, 0x84, 0x79, 0x3D, 0x78, 0xF7, 0x66, 0xAA,
-    0x88, 0x35, 0xCD, 0xB4, 0xB1, 0x23, 0x0E, 0x14, 0x32, 0x06, 0x9A, 0x19, 0x9D, 0x60, 0x81, 0x4D,
-    0xA4, 0x7A, 0xB5, 0xFC, 0x83, 0x17, 0xEB, 0x34, 0xF3, 0x0C, 0xB8, 0xD8, 0x2B, 0xE7, 0x59, 0x19,
-    0xC9, 0x5E, 0x3F, 0x4F, 0x4A, 0x78, 0xB0, 0x53, 0xD1, 0x1F, 0x14, 0x3C, 0xD9, 0x69, 0xE9, 0x13,
-    0x95, 0x52, 0xAF, 0xA8, 0x9F, 0x82, 0xB4, 0xD7, 0x55, 0x50, 0x8D, 0x0F, 0xD4, 0xE5, 0xEB, 0x66,
-    0xA6, 0x31, 0x5D, 0xCE, 0x94, 0x76, 0xCC, 0x60, 0x49, 0xE7, 0x5B, 0x34, 0x16, 0x6B, 0x40, 0x83,
-    0x1B, 0x68, 0x01, 0x5E, 0x74, 0xA9, 0xF0, 0x81, 0x86, 0xCC, 0x05, 0xDC, 0x28, 0xBE, 0x50, 0xD3,
-    0x1A, 0x90, 0x70, 0x3D, 0x94, 0x74, 0xE3, 0x24, 0x8F, 0x8A, 0x1F, 0xB5, 0x20, 0xBA, 0x54, 0x83,
-    0x2A, 0x2C, 0x41, 0x16, 0x2B, 0xD0, 0x25, 0x4C, 0x38, 0x60, 0xCA, 0x11, 0x93, 0xD6, 0x4C, 0x5B,
-    0xD1, 0x16, 0x64, 0x1D, 0x58, 0xD0, 0x16, 0x91, 0x08, 0x65, 0x20, 0xB7, 0x80, 0xE9, 0xB1, 0x1C,
-    0xC4, 0x2A, 0x0D, 0x55, 0x12, 0xA8, 0xF8, 0x52, 0x19, 0x5D, 0xAC, 0xC2, 0x5B, 0x75, 0x20, 0xEB,
-    0xAD, 0xE4, 0x52, 0x35, 0x88, 0x7F, 0x52, 0x0F, 0xE2, 0xC7, 0x75, 0x1A, 0x3E, 0xAA, 0xD1, 0xDD,
-    0xA0, 0x7F, 0x0F, 0x04, 0x37, 0x41, 0xB1, 0x0E, 0x92, 0x73, 0xE4, 0x49, 0x0B, 0x72, 0x31, 0x36,
-    0x79, 0x0D, 0xBB, 0x35, 0x02, 0x4A, 0xD4, 0x37, 0x80, 0x7D, 0xEB, 0x14, 0xCA, 0x75, 0xE0, 0xDC,
-    0x07, 0xD8, 0xAF, 0x53, 0x80, 0xC7, 0xD8, 0xAC, 0x31, 0x01, 0x7C, 0x93, 0xD7, 0x52, 0x58, 0x33,
-    0x9E, 0xE6, 0xFC, 0x86, 0x28, 0xC2, 0xA6, 0x80, 0x95, 0x02, 0x28, 0x01, 0xF3, 0x64, 0xCC, 0x05,
-    0x0E, 0x83, 0x9D, 0x80, 0x2D, 0x32, 0x1C, 0xB7, 0x06, 0x18, 0x07, 0x86, 0x74, 0x4A, 0x41, 0xC3,
-    0x70, 0x9A, 0x0A, 0xAC, 0x86, 0xBE, 0x3D, 0x6F, 0x6B, 0xC7, 0x10, 0x62, 0xA0, 0x4B, 0x18, 0x27,
-    0xD4, 0x24, 0x38, 0x90, 0x60, 0x40, 0x58, 0x7B, 0x15, 0x20, 0x95, 0x11, 0x95, 0x99, 0xE7, 0x07,
-    0x60, 0x9E, 0xB1, 0x19, 0xD6, 0x8C, 0xB6, 0x1C, 0xE1, 0x8C, 0xA1, 0xE5, 0xDC, 0xF5, 0x36, 0x76,
-    0x8A, 0x4E, 0x0A, 0x8C, 0x44, 0xE8, 0x51, 0xB9, 0x08, 0xF8, 0x91, 0x01, 0x6C, 0xCD, 0xC0, 0x2C,
-    0x31, 0x16, 0xDC, 0x85, 0x3C, 0x20, 0xA8, 0x99, 0x2D, 0xB7, 0x6F, 0x93, 0x5D, 0x87, 0x34, 0xF0,
-    0x0D, 0x78, 0x06, 0xC3, 0x4D, 0xAC, 0x33, 0x56, 0x90, 0x76, 0xDB, 0x8A, 0x94, 0x88, 0x13, 0x2C,
-    0xFB, 0x71, 0xBB, 0xE7, 0x6C, 0xEC, 0x2A, 0x95, 0x08, 0x29, 0x08, 0x28, 0x99, 0xCC, 0x04, 0x01,
-    0x9D, 0x99, 0x49, 0xCE, 0x42, 0x3E, 0x24, 0xFC, 0x26, 0xC6, 0x24, 0x98, 0x23, 0x57, 0xE0, 0x46,
-    0xAD, 0x87, 0x05, 0x36, 0x3E, 0xFB, 0x2C, 0x26, 0x08, 0x60, 0x2C, 0x50, 0x11, 0xD4, 0x1F, 0x94,
-    0x50, 0x56, 0x88, 0x7D, 0x87, 0xDE, 0x16, 0x3C, 0x30, 0x11, 0xB0, 0x49, 0x84, 0x03, 0x49, 0xB9,
-    0x2A, 0x30, 0x0F, 0x82, 0x3C, 0xD4, 0xB4, 0x62, 0x3B, 0x3D, 0x18, 0x23, 0x32, 0x14, 0xAC, 0xB7,
-    0x90, 0x27, 0xB6, 0xB1, 0x30, 0x63, 0x6E, 0xAE, 0xB4, 0x89, 0xF4, 0x9A, 0x0C, 0x41, 0x7D, 0x4A,
-    0xFE, 0xBF, 0x5B, 0x0A, 0x60, 0xAC, 0x81, 0x16, 0x14, 0x74, 0x46, 0x6B, 0xBC, 0x39, 0xC6, 0x99,
-    0xBD, 0x85, 0xC9, 0x6C, 0x74, 0xCC, 0xA5, 0x8D, 0x8D, 0x2B, 0x2E, 0xD9, 0xC8, 0x91, 0x6C, 0xFC,
-    0xE0, 0xFE, 0xFD, 0xDB, 0xDF, 0x02, 0xB9, 0x84, 0x55, 0x07, 0x30, 0x0C, 0xD8, 0xC3, 0x1A, 0xBB,
-    0x6F, 0x2C, 0xB1, 0x67, 0x08, 0x99, 0x18, 0x72, 0xBD, 0x65, 0x26, 0x43, 0x94, 0x48, 0xC3, 0x06,
-    0x8A, 0xE1, 0x84, 0x37, 0x3F, 0xA1, 0x88, 0x63, 0xC5, 0x3B, 0xC0, 0x0F, 0x75, 0x1E, 0x7D, 0xE5,
-    0x32, 0x2A, 0x46, 0x0E, 0x0E, 0x63, 0x1F, 0xB8, 0x10, 0xCE, 0xA1, 0x9B, 0xA3, 0x2D, 0x0B, 0x85,
-    0xBE, 0xB3, 0x2E, 0xBA, 0xEF, 0xDA, 0x2E, 0x5F, 0x59, 0x79, 0x63, 0x17, 0xC1, 0x37, 0x40, 0x5A,
-    0x57, 0xE4, 0x55, 0x50, 0xA1, 0x02, 0x26, 0x89, 0x07, 0xB0, 0xD0, 0x5D, 0x8C, 0xB8, 0x69, 0xD5,
-    0xD2, 0xAF, 0x27, 0xE8, 0xD1, 0x27, 0xE8, 0x53, 0xA9, 0x1E, 0x83, 0x6E, 0x07, 0x0E, 0xC7, 0x26,
-    0xA1, 0x43, 0x22, 0xFD, 0x99, 0x43, 0xB3, 0x48, 0xEF, 0xB8, 0x4C, 0x2B, 0xEB, 0x53, 0xAE, 0xE2,
-    0xD6, 0x35, 0x0B, 0x80, 0xCF, 0xDC, 0xA8, 0xF8, 0xB1, 0x63, 0x98, 0x5D, 0x70, 0x53, 0x0C, 0xA8,
-    0xB5, 0x7F, 0x4E, 0x18, 0x83, 0xC4, 0x26, 0x13, 0xDD, 0x63, 0xE0, 0xE4, 0x3F, 0xC6, 0x07, 0xB8,
-    0x70, 0xB5, 0xCC, 0xAD, 0xCB, 0x10, 0x64, 0x8B, 0xF3, 0x8B, 0x7D, 0x08, 0x52, 0xFC, 0x0E, 0x6C,
-    0x35, 0xAA, 0x33, 0xFA, 0xD3, 0x5F, 0xA3, 0xBA, 0xF3, 0x2B, 0xBA, 0xAE, 0x61, 0x3B, 0xD7, 0x31,
-    0x7F, 0xFA, 0x7B, 0x24, 0x28, 0xD9, 0x1F, 0x3B, 0x7A, 0xC8, 0x33, 0x7E, 0xCE, 0x0E, 0xC6, 0xE9,
-    0xCD, 0xDF, 0x6B, 0x8A, 0xCB, 0x96, 0x35, 0x02, 0x0B, 0x00, 0xFC, 0xC2, 0x9B, 0x3A, 0x8A, 0xD8,
-    0xA1, 0x4E, 0x19, 0xF8, 0x35, 0xA9, 0xC4, 0xD6, 0x02, 0x90, 0xA7, 0x5A, 0x66, 0x5A, 0xAC, 0x0E,
-    0xCD, 0xCB, 0x59, 0x9A, 0x11, 0xB4, 0x33, 0x55, 0x59, 0x74, 0xB7, 0xB8, 0x6E, 0x11, 0xDD, 0x60,
-    0xB9, 0x45, 0x71, 0xAB, 0x3B, 0x8B, 0xDC, 0x2E, 0x70, 0x99, 0xBA, 0x99, 0x69, 0xD8, 0x8D, 0x77,
-    0x28, 0x7F, 0xC0, 0xDC, 0x2C, 0xDD, 0xEC, 0xA0, 0x4D, 0x9E, 0x16, 0x98, 0x63, 0xAC, 0x86, 0xED,
-    0xA3, 0x44, 0x7F, 0x95, 0xB3, 0x9C, 0x4F, 0x5A, 0x39, 0x52, 0xEB, 0x97, 0x66, 0xC0, 0x96, 0x1B,
-    0xC2, 0x65, 0x02, 0x07, 0x84, 0xF5, 0x7B, 0xBA, 0xB6, 0xF9, 0x5E, 0x5F, 0xFA, 0x9C, 0x4F, 0xCD,
-    0xD2, 0xC7, 0x64, 0x9E, 0xD5, 0x14, 0x05, 0xAA, 0x5D, 0xBD, 0xCC, 0x02, 0xF1, 0x9C, 0x28, 0xC7,
-    0x77, 0x0E, 0x53, 0x1D, 0x9A, 0xB0, 0x73, 0x05, 0x8B, 0xF9, 0x8E, 0x9D, 0x93, 0x8B, 0x9D, 0xEC,
-    0x79, 0x13, 0x3A, 0x36, 0x3D, 0xAB, 0x6D, 0x3B, 0x67, 0xDE, 0xB9, 0x79, 0x67, 0xCE, 0x7B, 0x46,
-    0x4B, 0xF6, 0x5F, 0x8D, 0x0C, 0xF0, 0x69, 0x21, 0xA7, 0x57, 0xBB, 0x13, 0xC0, 0x94, 0x4D, 0xC6,
-    0x0D, 0xE6, 0xB5, 0x7F, 0xF8, 0xE1, 0xD0, 0x29, 0xB3, 0xB9, 0x25, 0x96, 0x12, 0x21, 0xE6, 0xB7,
-    0x8C, 0x0F, 0x84, 0xF4, 0xD1, 0xD3, 0xB0, 0x54, 0xC1, 0x0D, 0x0C, 0x6A, 0xB1, 0xC5, 0xE2, 0xD4,
-    0xEA, 0x7D, 0x60, 0x25, 0x1C, 0x59, 0xE7, 0x58, 0x39, 0x14, 0xE3, 0x8D, 0xC4, 0xAD, 0xF1, 0x7D,
-    0x86, 0x87, 0xDC, 0x3D, 0x88, 0x41, 0xCF, 0x10, 0x6F, 0xCE, 0x0B, 0x1D, 0x97, 0x06, 0x73, 0x14,
-    0x8B, 0x9C, 0xA8, 0x13, 0x16, 0x05, 0x89, 0x0F, 0x20, 0xA6, 0xA6, 0xBE, 0x4E, 0xA4, 0x05, 0x55,
-    0xCE, 0xB0, 0xA7, 0xAC, 0x47, 0x48, 0x06, 0xB6, 0x90, 0xB4, 0x65, 0x41, 0x19, 0x09, 0x3B, 0x36,
-    0xAD, 0xC0, 0x6C, 0xA1, 0x0D, 0x16, 0x10, 0x12, 0x66, 0xE6, 0x99, 0xF0, 0x71, 0x48, 0xC0, 0x98,
-    0x51, 0x96, 0x97, 0x9A, 0xDB, 0xDA, 0x88, 0xBB, 0x42, 0x07, 0xD9, 0x30, 0xC3, 0x71, 0x04, 0x90,
-    0x4B, 0x15, 0xE7, 0xEE, 0x99, 0x2C, 0x7E, 0x31, 0x01, 0x5C, 0xBE, 0x0B, 0x18, 0xCE, 0x4C, 0xAA,
-    0x9F, 0x1B, 0x61, 0x1E, 0x9A, 0xFD, 0xD8, 0x27, 0x87, 0xCC, 0x9E, 0x81, 0x66, 0xE0, 0x21, 0x44,
-    0x4A, 0x4B, 0xF6, 0xD5, 0x02, 0xC1, 0x9A, 0x97, 0x0F, 0xA9, 0x22, 0x06, 0x67, 0x9E, 0x17, 0x22,
-    0x59, 0x3D, 0x0E, 0x8C, 0x60, 0x2B, 0x5F, 0x52, 0xDE, 0x98, 0xF7, 0xC0, 0xE3, 0x3D, 0x56, 0x3E,
-    0xEA, 0x4C, 0xF8, 0x9D, 0x89, 0x96, 0x9B, 0x9C, 0x77, 0x9B, 0x0D, 0x46, 0x85, 0x73, 0x63, 0xDE,
-    0x5B, 0x3D, 0xC7, 0x02, 0xEB, 0x73, 0x7C, 0xB0, 0x30, 0xFB, 0x6B, 0x7D, 0x6A, 0x9B, 0x9C, 0xAD,
-    0xF9, 0x8D, 0x0D, 0x6F, 0xAE, 0x93, 0xB7, 0xDE, 0x2C, 0xC4, 0xC8, 0x6E, 0xA2, 0xD6, 0xEA, 0xF0,
-    0xB2, 0x61, 0x5F, 0x71, 0xD5, 0xD1, 0x6F, 0x3E, 0xD4, 0x53, 0xDA, 0xC5, 0x59, 0xD1, 0x54, 0x92,
-    0x2B, 0xF5, 0xD2, 0xCA, 0x90, 0x88, 0x7E, 0x44, 0xC7, 0x55, 0x85, 0x8A, 0x61, 0xF7, 0x0D, 0x2A,
-    0x7B, 0x7D, 0x53, 0xEB, 0xD2, 0xC7, 0xA2, 0x4B, 0xA4, 0xD8, 0x57, 0x4A, 0x1C, 0x5E, 0x7D, 0x36,
-    0x1A, 0xBF, 0xCC, 0x5E, 0x5D, 0x19, 0xBA, 0x98, 0x2B, 0x8C, 0xFD, 0xC8, 0x72, 0xA1, 0xD3, 0x88,
-    0x3E, 0xE8, 0xBD, 0x0D, 0x4C, 0x86, 0xA4, 0x1B, 0x1F, 0x42, 0xE6, 0x75, 0x74, 0x4B, 0xAE, 0xD4,
-    0x41, 0x55, 0x1E, 0x54, 0xD5, 0xE2, 0xEB, 0x8C, 0x44, 0x0E, 0x76, 0x30, 0xD6, 0x70, 0x41, 0x64,
-    0xEB, 0xB3, 0x50, 0x8B, 0x44, 0x9D, 0x03, 0xAC, 0x6F, 0x30, 0xA4, 0x65, 0x48, 0xB9, 0x28, 0xFB,
-    0x0F, 0x23, 0x78, 0xF1, 0x5F, 0xCD, 0x61, 0x01, 0x55, 0x52, 0x7F, 0x17, 0xA8, 0xB0, 0xCB, 0xFE,
-    0x37, 0x62, 0xEF, 0xDB, 0x60, 0xB7, 0x62, 0x77, 0x14, 0x29, 0xDB, 0xEB, 0x3B, 0x1C, 0xD9, 0x82,
-    0x26, 0xC2, 0x1D, 0x56, 0xF4, 0x9C, 0xAB, 0x73, 0x37, 0xE7, 0xC8, 0x48, 0xEB, 0xAC, 0x25, 0x0D,
-    0xA9, 0x8F, 0x98, 0x26, 0x64, 0xDA, 0x98, 0x69, 0x83, 0x26, 0x99, 0xA8, 0x49, 0x26, 0x6C, 0x52,
-    0x1F, 0x37, 0xFF, 0x2F, 0x97, 0x09, 0xFD, 0x64, 0x62, 0x3F, 0x99, 0xE0, 0x6F, 0xA3, 0xBF, 0x0D,
-    0xFF, 0x2E, 0xFE, 0xBB, 0x04, 0xC0, 0xC6, 0x5F, 0x63, 0xDC, 0x26, 0x2A, 0x30, 0xFE, 0xDC, 0xE6,
-    0x8A, 0x63, 0xAD, 0xA7, 0xFF, 0x84, 0xA6, 0x33, 0x7A, 0x87, 0xE1, 0x46, 0x33, 0x10, 0xDC, 0xFA,
-    0x1E, 0x05, 0x1C, 0x57, 0xE3, 0x8F, 0xE1, 0x09, 0xD9, 0x45, 0x0C, 0x1B, 0xB0, 0x1F, 0xBA, 0x38,
-    0x7A, 0x6F, 0x5E, 0x08, 0xBF, 0x8F, 0xA5, 0xA6, 0x7A, 0x97, 0x03, 0xD2, 0x43, 0x0E, 0xE4, 0xC5,
-    0x13, 0x54, 0xC7, 0xF5, 0xDF, 0xA0, 0xBC, 0x84, 0x03, 0x67, 0xFE, 0xE8, 0x1A, 0x79, 0xFF, 0x62,
-    0x64, 0xFE, 0x73, 0xCD, 0xB0, 0xD0, 0xDA, 0x73, 0x09, 0xA0, 0xC2, 0x44, 0xBC, 0xF3, 0x96, 0xDB,
-    0x36, 0x1A, 0x0B, 0xB8, 0x74, 0x81, 0xD6, 0x0D, 0x63, 0x01, 0x8D, 0x0D, 0x75, 0x0B, 0x41, 0x44,
-    0xDA, 0x78, 0x36, 0x70, 0x11, 0x6D, 0x6C, 0x4D, 0xC4, 0xEB, 0xE3, 0xCD, 0x02, 0xD9, 0x7B, 0xF0,
-    0xD0, 0x02, 0x64, 0x05, 0xC8, 0x72, 0x93, 0xCF, 0xD2, 0xAA, 0x30, 0x0A, 0xF1, 0xD9, 0x76, 0x91,
-    0xA8, 0xC0, 0xAE, 0xA7, 0x02, 0x94, 0x03, 0x88, 0x3B, 0xBD, 0x33, 0xE1, 0x84, 0x25, 0x04, 0xFA,
-    0xD3, 0x0F, 0x41, 0xF5, 0xF5, 0x29, 0xD3, 0xF2, 0x2E, 0x27, 0x7C, 0xB0, 0xD0, 0xBF, 0x6C, 0x59,
-    0x92, 0x01, 0x47, 0xCC, 0x98, 0x75, 0x1E, 0x70, 0xEA, 0xE5, 0xAB, 0x65, 0xAB, 0xE0, 0x1B, 0x64,
-    0x3F, 0x5A, 0x78, 0x72, 0xEF, 0x6B, 0xA0, 0xDB, 0x83, 0x15, 0xB6, 0x7B, 0x50, 0xD9, 0xE0, 0xB7,
-    0x35, 0x7F, 0x31, 0x52, 0xB4, 0x7A, 0x55, 0xDF, 0xD9, 0xE4, 0xEF, 0x56, 0xF5, 0xFB, 0x3B, 0xFA,
-    0xFE, 0x5D, 0xD3, 0x46, 0x19, 0xF7, 0x76, 0x7B, 0x0C, 0x6F, 0x18, 0xE1, 0xAB, 0xBD, 0x53, 0xEE,
-    0xD3, 0x87, 0xAD, 0x68, 0x3E, 0x73, 0x0A, 0x79, 0x63, 0x59, 0x25, 0xB7, 0x5F, 0x64, 0x14, 0x9C,
-    0x45, 0x70, 0xBE, 0x68, 0xCA, 0xCB, 0xED, 0x67, 0xD3, 0xF2, 0x9A, 0xE3, 0x89, 0x63, 0x0F, 0x1F,
-    0xFD, 0xF8, 0xE0, 0xB3, 0x4D, 0xE6, 0xE8, 0xD3, 0xF1, 0x19, 0x29, 0xBE, 0xD5, 0xF0, 0x31, 0x29,
-    0x61, 0xE4, 0xBD, 0x50, 0x6F, 0xC0, 0x6E, 0xF8, 0x08, 0x04, 0x1D, 0xF0, 0x21, 0x08, 0x3B, 0x71,
-    0xE3, 0xA4, 0x57, 0x9E, 0x3B, 0x24, 0x29, 0x59, 0xC6, 0xB3, 0xC7, 0x8B, 0x45, 0x7E, 0xE1, 0x3A,
-    0x50, 0x71, 0x00, 0xE3, 0x4C, 0x5E, 0xDA, 0x87, 0xC9, 0xEF, 0x8E, 0xE6, 0x70, 0xE2, 0x39, 0x22,
-    0xB9, 0xB7, 0x79, 0x91, 0x0C, 0xD7, 0xD4, 0x4D, 0xA4, 0xDC, 0xB4, 0xA7, 0xB9, 0xE7, 0xE4, 0x91,
-    0xA6, 0x7B, 0xEE, 0xDA, 0xFD, 0xEA, 0x48, 0x3C, 0x96, 0x6C, 0x65, 0x85, 0x10, 0x46, 0xA4, 0x5C,
-    0xBA, 0xB7, 0xB7, 0xB8, 0xEF, 0x2D, 0x13, 0x78, 0x58, 0x2D, 0xE9, 0x2B, 0x99, 0x9D, 0x36, 0x2C,
-    0xEC, 0x97, 0x2B, 0x03, 0xA9, 0xD3, 0x83, 0x6A, 0xFF, 0x55, 0x63, 0x79, 0xCC, 0x32, 0x26, 0xF6,
-    0x5A, 0x93, 0x86, 0xE0, 0x9F, 0xDF, 0x9D, 0x75, 0x67, 0x80, 0x97, 0x5E, 0xD7, 0x16, 0x27, 0x9A,
-    0x90, 0xF3, 0x22, 0xF3, 0x2D, 0x71, 0x96, 0xFC, 0xDB, 0xC7, 0xED, 0xA0, 0xF2, 0x71, 0x08, 0x6A,
-    0x83, 0x8A, 0x13, 0x24, 0x7E, 0x20, 0xC8, 0x37, 0xE6, 0x8D, 0x36, 0x83, 0xCA, 0xA4, 0x1D, 0x0B,
-    0x03, 0x16, 0x1E, 0x85, 0xF9, 0x46, 0x25, 0xDC, 0x63, 0x38, 0xBC, 0xF2, 0x74, 0x38, 0x7C, 0xC1,
-    0x00, 0x01, 0x66, 0x64, 0x59, 0x2B, 0x33, 0x51, 0x62, 0xE7, 0xC3, 0x29, 0xCD, 0xAB, 0x82, 0x2A,
-    0x92, 0x5F, 0x1A, 0xE7, 0x5B, 0x0B, 0x01, 0x84, 0x88, 0x42, 0xCC, 0xBB, 0xD3, 0xDB, 0xFC, 0x1D,
-    0x4F, 0xE6, 0x62, 0x6D, 0xAE, 0xCD, 0x50, 0xC9, 0xDC, 0x68, 0x6D, 0x9B, 0x90, 0x61, 0x90, 0xFD,
-    0xCE, 0xB7, 0x82, 0x27, 0xBF, 0x99, 0x3C, 0x02, 0x80, 0xA4, 0xCD, 0xFD, 0x9E, 0x03, 0xBC, 0x9E,
-    0x0E, 0x41, 0xF9, 0x53, 0xFB, 0x5D, 0x2B, 0x50, 0x47, 0xFC, 0xE6, 0x76, 0xB5, 0x0C, 0xF9, 0xAE,
-    0x8E, 0xF4, 0xED, 0xAC, 0x98, 0x66, 0x5D, 0xDA, 0xC6, 0x75, 0x54, 0x05, 0xEA, 0x75, 0x47, 0xD9,
-    0x6F, 0x6E, 0x9E, 0x08, 0x54, 0x58, 0xC6, 0x75, 0xD2, 0x64, 0x5D, 0x31, 0x7D, 0xFD, 0x91, 0xBE,
-    0x8C, 0xAA, 0x73, 0xE7, 0x1F, 0x9C, 0x5A, 0x5F, 0x8F, 0xEB, 0xD7, 0x9F, 0x13, 0x2B, 0x94, 0x57,
-    0xE4, 0x57, 0xD1, 0xCC, 0x17, 0x65, 0x95, 0xBF, 0x6F, 0x24, 0x35, 0x14, 0xC7, 0xBF, 0xB6, 0x2F,
-    0x19, 0x84, 0xA5, 0xF3, 0x15, 0x77, 0x05, 0xC5, 0xED, 0xF4, 0x51, 0x76, 0xA7, 0x4D, 0x31, 0xB3,
-    0x63, 0x8E, 0x7F, 0x20, 0x05, 0x7F, 0x00, 0x05, 0x0D, 0x69, 0xAE, 0x49, 0xB1, 0x12, 0x23, 0x76,
-    0x44, 0x41, 0xBD, 0x3D, 0x4D, 0x0A, 0x8A, 0x23, 0x42, 0xCA, 0x15, 0x8B, 0x34, 0xA0, 0xA0, 0x35,
-    0xE2, 0x1F, 0xB0, 0xF8, 0x07, 0x70, 0x81, 0x28, 0x2E, 0x05, 0x3E, 0x34, 0x3A, 0xF6, 0x72, 0xBB,
-    0x31, 0xCF, 0x9E, 0xCD, 0x82, 0x84, 0xE7, 0x8D, 0xB4, 0xE3, 0x9F, 0xEF, 0x7D, 0xDF, 0xE7, 0x79,
-    0xF1, 0x01, 0x58, 0xB0, 0xD9, 0x8D, 0x57, 0x6D, 0x5F, 0xA0, 0xAF, 0xB0, 0x2E, 0xD1, 0x37, 0xE8,
-    0xAF, 0xE1, 0x3B, 0xE6, 0x3B, 0xEE, 0xAE, 0x85, 0x6D, 0xA4, 0xA9, 0x57, 0xC8, 0x37, 0x60, 0xA7,
-    0xA0, 0xE6, 0xE1, 0x00, 0xA6, 0x85, 0x11, 0x6D, 0xA6, 0x25, 0x14, 0x1E, 0x62, 0x84, 0x31, 0x4A,
-    0x7A, 0x1E, 0x23, 0xB5, 0x0D, 0xF8, 0x1A, 0xB2, 0xC7, 0xA8, 0x47, 0xE3, 0xF1, 0xDA, 0x8B, 0x5F,
-    0x9D, 0xFC, 0xC8, 0x4E, 0x84, 0xA9, 0xC3, 0x66, 0x1E, 0x36, 0x90, 0x2D, 0x94, 0xA6, 0x85, 0x43,
-    0xE3, 0xA1, 0x17, 0x64, 0xE6, 0xBE, 0xFB, 0x07, 0xE4, 0xA1, 0x7D, 0x20, 0x0D, 0x84, 0x1D, 0x4C,
-    0x4B, 0x73, 0xBB, 0xD2, 0xAB, 0x2D, 0x0E, 0x34, 0xA2, 0x0F, 0xF3, 0x35, 0xBB, 0xFB, 0x26, 0xB3,
-    0x71, 0xF2, 0x08, 0xA8, 0x56, 0xBA, 0x0E, 0xF6, 0x0B, 0xE1, 0x1A, 0xE6, 0x1B, 0xE6, 0x1A, 0xEE,
-    0x9A, 0xCC, 0xD4, 0x57, 0xAD, 0xBA, 0xDB, 0xF9, 0x2B, 0xC3, 0x86, 0x0C, 0xE8, 0xC1, 0x3D, 0x32,
-    0x03, 0xD5, 0xA2, 0xA0, 0x65, 0xD1, 0x4D, 0xE6, 0x21, 0x1C, 0xE8, 0xA8, 0x5C, 0xA3, 0x1E, 0xBC,
-    0xA1, 0x33, 0x56, 0x3D, 0x7F, 0x4B, 0x61, 0x57, 0xC2, 0x54, 0x14, 0x3C, 0x7B, 0xD3, 0x23, 0xB4,
-    0x59, 0xB0, 0xF9, 0x33, 0x5F, 0xA1, 0x27, 0x79, 0x2A, 0xE6, 0x8B, 0xAF, 0x9D, 0x0C, 0x1A, 0x1F,
-    0x83, 0x42, 0xE6, 0xC1, 0xC8, 0x1B, 0x9F, 0x6B, 0x3F, 0x89, 0xFA, 0x45, 0x9B, 0x0A, 0x9F, 0x07,
-    0x9F, 0xBD, 0x71, 0xD1, 0x7F, 0xDA, 0xBD, 0xC0, 0xE5, 0x16, 0xC1, 0xE1, 0x09, 0xED, 0x7F, 0x11,
-    0x05, 0x1C, 0x6C, 0x1E, 0xDC, 0xD9, 0xED, 0x62, 0xFF, 0x89, 0xE4, 0x6D, 0xEC, 0xBC, 0x5C, 0xCC,
-    0x83, 0x25, 0x1B, 0x3C, 0xA2, 0x9E, 0xA3, 0xCB, 0x45, 0x0C, 0xB5, 0x49, 0x41, 0xB8, 0x5D, 0x10,
-    0xA4, 0x5F, 0x0E, 0x4C, 0x52, 0x28, 0x64, 0x65, 0xB2, 0xE1, 0x37, 0x75, 0xD2, 0xA8, 0x4C, 0xC9,
-    0x5A, 0xD2, 0xB2, 0x98, 0x9B, 0x2A, 0x3D, 0x25, 0x7D, 0x5D, 0xA3, 0x67, 0x9E, 0xBB, 0xCC, 0x28,
-    0x3D, 0x41, 0x07, 0xC6, 0x16, 0xD9, 0xF3, 0xB5, 0xEC, 0x1B, 0x65, 0x4A, 0xA5, 0xCB, 0x1C, 0xCD,
-    0x18, 0x5D, 0x89, 0x65, 0x09, 0xDF, 0xC0, 0xCF, 0x98, 0x3B, 0x65, 0x1A, 0x03, 0x26, 0xEF, 0x22,
-    0x26, 0x39, 0xBA, 0x29, 0xBA, 0x2A, 0xCE, 0x59, 0x37, 0x11, 0x16, 0xDF, 0x70, 0xDF, 0x08, 0x57,
-    0x45, 0x4C, 0xB4, 0xDA, 0xEE, 0x64, 0xDF, 0xC8, 0xF5, 0xBC, 0xEF, 0x3C, 0x9D, 0xE4, 0x85, 0x13,
-    0x36, 0x33, 0x99, 0x91, 0xAD, 0xD2, 0x4A, 0xE7, 0x3B, 0x99, 0x29, 0xE7, 0xB7, 0x1B, 0xA6, 0x07,
-    0x8F, 0x29, 0xB4, 0x75, 0xCC, 0x4F, 0x52, 0x8B, 0x32, 0x43, 0x69, 0x89, 0x39, 0x09, 0x7E, 0x1E,
-    0xFC, 0x30, 0x9F, 0xD1, 0xFC, 0x57, 0x9B, 0xFB, 0x08, 0x1B, 0x1C, 0xC6, 0xB4, 0xE0, 0xCA, 0xC6,
-    0x24, 0x92, 0x2C, 0xE8, 0x1F, 0x71, 0x3F, 0xBD, 0xB2, 0x75, 0xD0, 0xC3, 0xF9, 0xC0, 0x4F, 0x60,
-    0xB4, 0xD1, 0x06, 0xAA, 0x43, 0xD5, 0x63, 0x49, 0x21, 0xFB, 0xEC, 0x67, 0xAF, 0xB8, 0xAB, 0xC3,
-    0x96, 0x48, 0x8C, 0x32, 0x12, 0x72, 0x64, 0xFF, 0x62, 0xE8, 0x87, 0x3E, 0x12, 0xEF, 0x7F, 0x18,
-    0x9A, 0x84, 0x21, 0x56, 0x9B, 0x7B, 0x0C, 0x8B, 0x0D, 0x61, 0x48, 0x23, 0x94, 0x8A, 0x98, 0x87,
-    0x79, 0xC4, 0xB0, 0xE6, 0xBE, 0x8A, 0x18, 0x92, 0x24, 0x8E, 0xE0, 0x29, 0x12, 0x86, 0xD8, 0x61,
-    0xB8, 0x4D, 0x18, 0xA6, 0x30, 0xF7, 0xCB, 0xA6, 0xA0, 0x74, 0xB0, 0x3E, 0xC6, 0xBB, 0x47, 0x33,
-    0xB6, 0x27, 0xA4, 0xB7, 0xCB, 0xFE, 0xE8, 0x55, 0xDB, 0x29, 0xDD, 0xC9, 0xB6, 0x17, 0x37, 0x96,
-    0x07, 0xA8, 0x3F, 0xDB, 0x69, 0x66, 0x3B, 0xE1, 0x7A, 0xEE, 0x3A, 0x61, 0xE7, 0xCF, 0x4D, 0x3E,
-    0x60, 0xFE, 0x98, 0xE6, 0x47, 0x0C, 0x95, 0xA6, 0x32, 0x5E, 0x4E, 0xB0, 0x9C, 0xA2, 0x2F, 0x78,
-    0xAF, 0x28, 0xA2, 0xB7, 0xE9, 0xB8, 0x2C, 0x42, 0x4E, 0x18, 0xAE, 0x06, 0x0C, 0x3F, 0x01, 0x5E,
-    0xEE, 0xAC, 0x26, 0xBE, 0x6E, 0x2F, 0xF6, 0x9F, 0x78, 0x14, 0xCF, 0x27, 0xE5, 0x8F, 0x2E, 0x2F,
-    0x68, 0x88, 0x6C, 0xF0, 0xA8, 0x1E, 0x30, 0x24, 0xFE, 0x85, 0x93, 0x84, 0x4E, 0x41, 0x69, 0x88,
-    0x2C, 0x75, 0x24, 0xFE, 0xF0, 0x74, 0x89, 0xB4, 0x71, 0xDC, 0x64, 0xB6, 0x47, 0x6E, 0xBC, 0xC7,
-    0x8E, 0x26, 0x12, 0x0A, 0x46, 0xB5, 0x45, 0xCC, 0xF6, 0x67, 0xEF, 0x89, 0xF0, 0x9D, 0xD2, 0xEB,
-    0x71, 0x2A, 0xA9, 0x19, 0xFC, 0x92, 0x8C, 0xBB, 0x65, 0x66, 0x9B, 0xC2, 0x14, 0x7F, 0x99, 0x28,
-    0xF2, 0x19, 0x44, 0x30, 0x8A, 0xDB, 0x31, 0xB7, 0xA5, 0x34, 0xF3, 0x3B, 0xFC, 0x78, 0x4A, 0x38,
-    0x47, 0xAB, 0x0E, 0x29, 0x3B, 0x29, 0xF0, 0x33, 0x50, 0x69, 0x2A, 0x4D, 0xA5, 0x49, 0xC0, 0x2E,
-    0x97, 0xD1, 0x86, 0xAD, 0x6C, 0x25, 0xDB, 0x41, 0x1C, 0xD6, 0xBE, 0x0F, 0xFA, 0x44, 0x1C, 0xC0,
-    0xF7, 0x14, 0x4E, 0x4D, 0x29, 0x8F, 0x3A, 0xCF, 0xE9, 0x7D, 0xA7, 0x21, 0x7E, 0x21, 0xE5, 0xB9,
-    0x25, 0x37, 0x13, 0x6A, 0x60, 0xDF, 0x42, 0x05, 0xF3, 0x80, 0x0A, 0x2D, 0x15, 0x26, 0xBB, 0xF2,
-    0xEA, 0x95, 0xAB, 0xB8, 0x3D, 0xC9, 0x0C, 0x55, 0x47, 0x41, 0xD7, 0x86, 0x06, 0xB3, 0xE0, 0x84,
-    0x46, 0xB2, 0xEC, 0xAB, 0x85, 0x9C, 0xAF, 0x95, 0x2B, 0x55, 0x4B, 0xE3, 0x27, 0x4F, 0x31, 0x3B,
-    0x4E, 0xD5, 0x73, 0x02, 0x7F, 0xCE, 0x1C, 0x79, 0x12, 0xF7, 0xFC, 0xEF, 0xFC, 0xF6, 0x53, 0xF9,
-    0xA1, 0x57, 0x59, 0xAB, 0x46, 0x18, 0x75, 0xC8, 0x3D, 0x8A, 0x0E, 0x65, 0x89, 0x93, 0x11, 0xCE,
-    0x15, 0x96, 0x59, 0x04, 0x92, 0x39, 0x6E, 0xE9, 0x86, 0x35, 0x59, 0x2B, 0xB5, 0x4A, 0x77, 0xEC,
-    0x53, 0x1C, 0x27, 0x51, 0x67, 0x31, 0x7E, 0xF0, 0xC3, 0xF6, 0x08, 0x72, 0xFE, 0x9A, 0xF4, 0xB1,
-    0x9F, 0x3F, 0x23, 0x01, 0x1A, 0x6E, 0x15, 0x66, 0xDC, 0x8C, 0xF0, 0x52, 0x98, 0x63, 0x78, 0xD1,
-    0x96, 0x70, 0x99, 0x2E, 0x99, 0x93, 0xD4, 0x4D, 0x63, 0x4B, 0x92, 0x7E, 0xC8, 0x24, 0xFB, 0xF2,
-    0x77, 0xF1, 0xDB, 0x56, 0xF4, 0x93, 0xCC, 0x8E, 0x64, 0x3B, 0x56, 0xA8, 0x14, 0xCA, 0xD1, 0xAE,
-    0xEC, 0x29, 0x1B, 0x49, 0x85, 0xD3, 0x17, 0xC0, 0xDF, 0x01, 0xD8, 0xCA, 0x96, 0xD1, 0x66, 0xDC,
-    0x89, 0x36, 0x7A, 0x23, 0x8C, 0xD4, 0x74, 0x71, 0x10, 0x4E, 0x13, 0x48, 0x77, 0x0D, 0x55, 0x7B,
-    0x3C, 0x3C, 0x00, 0x79, 0x07, 0xF2, 0x2F, 0x5D, 0x41, 0xE9, 0x1D, 0x34, 0x1C, 0xA5, 0x01, 0xBA,
-    0xA7, 0x33, 0x1F, 0xCB, 0x31, 0x02, 0xAF, 0xB0, 0x98, 0x20, 0xAC, 0x63, 0x11, 0xF1, 0x56, 0xE8,
-    0xFC, 0xC5, 0x6A, 0xA3, 0xF6, 0xFF, 0x1F, 0x33, 0x9C, 0xD3, 0x5B, 0x9B, 0x03, 0xFC, 0x03, 0x6D,
-    0x58, 0x3D, 0x8C, 0xDC, 0xD6, 0x11, 0x1E, 0x92, 0x3A, 0x31, 0x31, 0x83, 0xF0, 0x0A, 0x0B, 0x09,
-    0xA2, 0x28, 0x4C, 0x1D, 0xC1, 0xC7, 0x26, 0xE5, 0xDE, 0x91, 0xB2, 0x8A, 0xB4, 0x57, 0xF8, 0x9C,
-    0x22, 0x85, 0x52, 0x1A, 0x0E, 0x02, 0x05, 0x41, 0x10, 0x5C, 0xB1, 0xB7, 0xA4, 0x63, 0x20, 0xAD,
-    0xAF, 0xB1, 0x53, 0xA4, 0xB9, 0x42, 0x01, 0x94, 0x55, 0x71, 0x2A, 0x54, 0x1C, 0x92, 0xDB, 0x5D,
-    0x5A, 0x29, 0x52, 0xB8, 0x10, 0xE5, 0x44, 0x70, 0xE1, 0x42, 0x44, 0x20, 0x03, 0x86, 0x1C, 0x44,
-    0x74, 0x44, 0xC1, 0xD4, 0x99, 0xCB, 0x97, 0xEF, 0x1B, 0x72, 0x7F, 0x24, 0x84, 0xC5, 0x47, 0x1E,
-    0x97, 0xEF, 0xBD, 0x79, 0x33, 0xDF, 0x7C, 0x33, 0xEF, 0x44, 0x78, 0x05, 0x6D, 0x2C, 0x62, 0x4C,
-    0x2A, 0xCE, 0xFC, 0x7C, 0x2C, 0x5E, 0x81, 0x57, 0x7E, 0x06, 0x08, 0xF1, 0x5A, 0x22, 0x7E, 0x31,
-    0x92, 0xB7, 0xC7, 0xF1, 0x88, 0xDF, 0x4C, 0xA4, 0x1D, 0xC7, 0x13, 0xAB, 0x12, 0x99, 0xD8, 0x25,
-    0x7E, 0x70, 0x00, 0xD1, 0x55, 0x40, 0x68, 0xCE, 0x6E, 0x8A, 0x6B, 0x4C, 0x23, 0x72, 0xED, 0xB3,
-    0x37, 0xFA, 0x19, 0xFC, 0x94, 0xC0, 0x69, 0x82, 0x78, 0x39, 0xA1, 0x29, 0x08, 0x39, 0xE7, 0xDD,
-    0xDD, 0x14, 0xB1, 0x0B, 0x8C, 0x76, 0x3E, 0x04, 0xB8, 0x5F, 0xE0, 0xE5, 0xCC, 0x54, 0x9C, 0xA6,
-    0x92, 0xB0, 0xF5, 0x6F, 0xCB, 0x6C, 0x18, 0x88, 0xD5, 0x0C, 0x5F, 0x13, 0xA7, 0xBC, 0x33, 0x80,
-    0x69, 0xE5, 0xBE, 0xF8, 0x77, 0x8B, 0x4A, 0x82, 0x77, 0x31, 0x20, 0xFC, 0xC9, 0xDD, 0x5C, 0x22,
-    0xEF, 0x6A, 0x26, 0x91, 0xEF, 0xA6, 0x12, 0x6D, 0xF9, 0x98, 0x78, 0x10, 0x00, 0x30, 0x40, 0xA2,
-    0x6A, 0x80, 0x65, 0x31, 0x40, 0xFC, 0x92, 0x93, 0xB7, 0x67, 0xFD, 0xC4, 0xDE, 0x35, 0x73, 0x28,
-    0xBE, 0x07, 0xD3, 0x38, 0x40, 0x38, 0x60, 0x71, 0xCD, 0x5A, 0x11, 0xCF, 0x18, 0x4C, 0x78, 0x76,
-    0x9C, 0x89, 0x89, 0x2D, 0x71, 0xB0, 0x1F, 0x71, 0x4B, 0x6E, 0x83, 0x16, 0x07, 0xDC, 0x50, 0xD4,
-    0xF9, 0xE5, 0xE8, 0x97, 0xF0, 0xCB, 0xD3, 0x56, 0x26, 0x96, 0xF9, 0xB7, 0x34, 0x36, 0x86, 0x36,
-    0x4E, 0x4D, 0xC0, 0xD7, 0x8D, 0x5B, 0x10, 0x30, 0x64, 0xEE, 0xC1, 0x11, 0x53, 0x7A, 0x23, 0xA1,
-    0x37, 0xA2, 0x87, 0x18, 0x1C, 0x98, 0x3F, 0x66, 0xB4, 0x25, 0xE3, 0x76, 0xF1, 0x72, 0x83, 0x13,
-    0x5A, 0xC6, 0xCC, 0xC5, 0xA6, 0x03, 0x1D, 0x05, 0xAE, 0xC9, 0x59, 0xC4, 0xE3, 0xC2, 0x5E, 0x26,
-    0xEB, 0x3E, 0x5D, 0x73, 0xE7, 0x78, 0x1C, 0xC3, 0x9D, 0x46, 0x3A, 0x38, 0xE0, 0x36, 0x4E, 0x09,
-    0x34, 0xFC, 0xC2, 0xFC, 0x0D, 0xBE, 0xC7, 0xE3, 0xE5, 0xF6, 0x26, 0x5C, 0xCD, 0x39, 0x75, 0x62,
-    0xA7, 0x58, 0xCC, 0xBE, 0xB8, 0x6C, 0x78, 0x06, 0x93, 0x73, 0x0E, 0x89, 0x1E, 0x4C, 0x81, 0x53,
-    0x39, 0xD7, 0x4F, 0x23, 0x56, 0xAD, 0x9F, 0x54, 0x8A, 0x1C, 0xDF, 0xCD, 0x22, 0x3F, 0x7B, 0xB6,
-    0xC7, 0x91, 0x30, 0xBC, 0xB3, 0xBC, 0x37, 0xB1, 0x43, 0xFB, 0xF8, 0xF1, 0x0D, 0x75, 0x27, 0x86,
-    0x9D, 0x9F, 0x8D, 0x8F, 0x16, 0x64, 0x82, 0xD7, 0x16, 0xF6, 0xF5, 0x53, 0x86, 0x67, 0xFD, 0x26,
-    0xE0, 0x8C, 0x04, 0x18, 0xCB, 0xFA, 0x75, 0xA2, 0x68, 0xE9, 0x82, 0xE2, 0x28, 0x6F, 0xD4, 0x1D,
-    0x43, 0xAF, 0xF1, 0xC1, 0xA5, 0xD3, 0xC4, 0x44, 0xA6, 0x96, 0xF9, 0xF3, 0xC4, 0x7C, 0xD0, 0x88,
-    0xC9, 0xFC, 0xB9, 0xCC, 0xC5, 0x88, 0x5F, 0x21, 0x30, 0x73, 0xF1, 0xF1, 0x81, 0xDD, 0x48, 0x90,
-    0x21, 0x2E, 0xE0, 0x54, 0xAA, 0xE1, 0x49, 0x62, 0xAB, 0xC6, 0xE6, 0x0D, 0x96, 0x77, 0x73, 0x1B,
-    0xB7, 0xD2, 0xCB, 0x9C, 0x16, 0x7B, 0xF2, 0x39, 0x9A, 0xB7, 0xB0, 0x81, 0x77, 0x82, 0x74, 0xD0,
-    0xC0, 0xFB, 0x61, 0x5C, 0x37, 0xD8, 0x51, 0x68, 0x7D, 0x59, 0xE3, 0x16, 0x39, 0x1F, 0x57, 0x8C,
-    0x01, 0xF9, 0xC3, 0x40, 0x74, 0x36, 0x6E, 0x77, 0xB7, 0xB7, 0xBA, 0x1B, 0xA8, 0x52, 0x71, 0x65,
-    0xF0, 0xB4, 0x84, 0xDD, 0x61, 0x09, 0x9F, 0x45, 0x25, 0x16, 0xDE, 0x29, 0xE1, 0xF8, 0x6D, 0x2C,
-    0x2A, 0xC3, 0xDA, 0xCD, 0x5E, 0x69, 0xDB, 0xE3, 0xCF, 0xE1, 0x71, 0xD3, 0xE8, 0x93, 0x55, 0x0D,
-    0x83, 0xD8, 0x2A, 0x87, 0xA1, 0x5C, 0x3E, 0x33, 0xB3, 0x23, 0x3A, 0xA2, 0xBC, 0xF8, 0x59, 0x32,
-    0xDD, 0x75, 0xF3, 0xAD, 0x21, 0x76, 0x1C, 0x9E, 0x02, 0x82, 0x53, 0x2C, 0x1E, 0xC0, 0x90, 0x18,
-    0x1B, 0x0C, 0x40, 0x6D, 0x09, 0x09, 0x11, 0x97, 0x13, 0xBF, 0xD5, 0x54, 0xD3, 0x48, 0x86, 0x0C,
-    0x0A, 0x7E, 0xD4, 0x78, 0x2A, 0x65, 0x77, 0x94, 0x30, 0x23, 0xC5, 0x89, 0x84, 0xAF, 0xE7, 0x08,
-    0x41, 0xE4, 0xC2, 0x31, 0x60, 0x66, 0x26, 0xB5, 0xB4, 0x49, 0x6B, 0x55, 0x60, 0x65, 0x8B, 0x50,
-    0x7E, 0x99, 0xBC, 0x0F, 0x16, 0xC6, 0x91, 0x38, 0x67, 0x87, 0x18, 0x4E, 0xA6, 0xEC, 0x28, 0x11,
-    0x0F, 0xD4, 0xF5, 0xA7, 0x1A, 0xE1, 0x46, 0xB9, 0x58, 0x6B, 0x52, 0xD4, 0x3A, 0x6D, 0xB3, 0xC9,
-    0x08, 0x9B, 0x92, 0x98, 0x68, 0xC0, 0x36, 0x68, 0x95, 0xBA, 0x2A, 0x30, 0x4A, 0xA2, 0xCE, 0x2E,
-    0xCC, 0x39, 0xEB, 0x6E, 0x4A, 0x89, 0x9D, 0x2E, 0xA7, 0x0E, 0x60, 0x15, 0x22, 0x3A, 0x41, 0x3E,
-    0x63, 0x0F, 0xB0, 0x2E, 0x7C, 0x70, 0x1B, 0xB7, 0x69, 0x44, 0x06, 0x5A, 0x0D, 0x6F, 0xCF, 0xAF,
-    0x55, 0x91, 0x92, 0x2D, 0xC7, 0x08, 0xC7, 0xB4, 0x12, 0xE4, 0x08, 0xD8, 0x48, 0xBC, 0x1A, 0x46,
-    0x46, 0x82, 0x2C, 0xF4, 0x72, 0x7C, 0x90, 0xC4, 0x08, 0x58, 0x8C, 0xB0, 0xFB, 0x19, 0x52, 0x05,
-    0x61, 0x4D, 0x61, 0x24, 0x9E, 0x53, 0xD8, 0x1D, 0xE0, 0x17, 0xFF, 0xA3, 0x38, 0xC1, 0xEE, 0xFC,
-    0x4F, 0x31, 0x43, 0x24, 0xDE, 0xC7, 0xEA, 0x32, 0xB5, 0x16, 0xF1, 0x6A, 0x64, 0xDB, 0x2A, 0xAD,
-    0x06, 0xC4, 0x29, 0x41, 0x9D, 0xDA, 0x2E, 0x9D, 0xC6, 0xAA, 0xEC, 0xD2, 0xE5, 0xDF, 0xA5, 0x3F,
-    0x74, 0x0A, 0xBB, 0x0C, 0xF6, 0xDD, 0xCC, 0x29, 0xB7, 0xF6, 0xC1, 0x9B, 0x62, 0xB0, 0xEF, 0xC7,
-    0x4E, 0x31, 0x3C, 0x09, 0x90, 0x55, 0xF5, 0x49, 0xA4, 0x3C, 0x86, 0x79, 0xC4, 0xCC, 0xF9, 0x47,
-    0x5E, 0xD5, 0xE2, 0x7C, 0x92, 0x55, 0x95, 0x38, 0x1F, 0xA5, 0xCF, 0x4A, 0x71, 0xEE, 0xC5, 0xFF,
-    0x2D, 0xC4, 0x7D, 0x28, 0x4F, 0x21, 0x01, 0xFF, 0x91, 0xAF, 0x80, 0x8D, 0x7C, 0x1D, 0x13, 0x11,
-    0x2A, 0xB7, 0x12, 0x4A, 0x50, 0x09, 0x0A, 0x53, 0x88, 0x35, 0xA3, 0xCC, 0x73, 0x3A, 0x3C, 0xC0,
-    0x9C, 0xF8, 0x3B, 0x18, 0xDF, 0xAA, 0xE8, 0x6C, 0xA8, 0x22, 0x44, 0x18, 0x3B, 0x85, 0x51, 0x70,
-    0x9F, 0x1C, 0xE0, 0x76, 0x60, 0x1F, 0x1E, 0x80, 0x64, 0xA7, 0x6E, 0x06, 0x1B, 0xA5, 0xF1, 0xB2,
-    0x53, 0x10, 0xAD, 0xF6, 0x33, 0x3C, 0xE1, 0x96, 0xE2, 0xC9, 0xAA, 0x82, 0x2B, 0x95, 0x9F, 0xDA,
-    0x65, 0x68, 0x95, 0x30, 0xBA, 0x8C, 0xB0, 0x13, 0xD8, 0xBE, 0xE3, 0x94, 0xA1, 0xB8, 0xF9, 0x8E,
-    0x03, 0x0F, 0xBA, 0xD9, 0x01, 0x9E, 0x10, 0xE5, 0x53, 0x2F, 0x3B, 0x80, 0xCB, 0x1A, 0x8D, 0x76,
-    0x5A, 0x53, 0x03, 0x30, 0x98, 0x5A, 0x18, 0x5A, 0xCF, 0xF6, 0x92, 0x5C, 0x42, 0x5B, 0x53, 0x75,
-    0x07, 0x44, 0x79, 0xD4, 0xF1, 0xFE, 0x82, 0x74, 0xC1, 0x5C, 0x24, 0xB9, 0xB5, 0x37, 0x8D, 0x55,
-    0x53, 0x0A, 0xC5, 0x7C, 0xA9, 0x24, 0xAC, 0x1F, 0xB6, 0xF9, 0x5D, 0x49, 0x56, 0x3C, 0x05, 0x26,
-    0x0F, 0xFE, 0x0A, 0x6C, 0x25, 0x2C, 0x84, 0xC9, 0xCA, 0x90, 0x92, 0x61, 0xA0, 0x1D, 0x10, 0xD9,
-    0x44, 0xCC, 0x44, 0x43, 0x48, 0x9E, 0xE1, 0x21, 0x52, 0x2D, 0x4E, 0x14, 0x5B, 0xA2, 0x3D, 0xA7,
-    0xEC, 0x78, 0xC4, 0x72, 0x04, 0x01, 0x74, 0x4D, 0x7D, 0x4A, 0x51, 0xCD, 0xB9, 0xE0, 0x39, 0x79,
-    0xE9, 0x42, 0x72, 0x95, 0x14, 0x5F, 0x5A, 0x76, 0x61, 0x6F, 0x6F, 0x25, 0x38, 0xE7, 0x69, 0x65,
-    0x48, 0x29, 0x33, 0x63, 0x04, 0xAE, 0x96, 0x1F, 0x6A, 0x66, 0x51, 0x40, 0x96, 0xB5, 0x10, 0x97,
-    0xE6, 0x16, 0x47, 0x47, 0x04, 0x55, 0x31, 0x55, 0xC4, 0xEF, 0x50, 0x10, 0x67, 0x20, 0x95, 0xA8,
-    0x28, 0xAA, 0xC2, 0x3A, 0x2B, 0xD5, 0xE5, 0x77, 0x96, 0x0A, 0x9F, 0x79, 0xFF, 0x84, 0xCA, 0x5C,
-    0x53, 0x20, 0xF9, 0xF6, 0x55, 0x4D, 0x56, 0xAE, 0x10, 0xE9, 0xEC, 0x91, 0x7E, 0x3C, 0xD2, 0xAA,
-    0x33, 0xD1, 0xEC, 0x38, 0xD5, 0x45, 0x1B, 0x9D, 0xA3, 0xE1, 0x6B, 0xAB, 0x8E, 0x52, 0x2A, 0x68,
-    0xCB, 0x75, 0xBF, 0x9A, 0xEB, 0xC2, 0x0C, 0x08, 0x89, 0x87, 0xA5, 0xEB, 0x91, 0xD6, 0x8E, 0x48,
-    0xE5, 0x98, 0xC9, 0x09, 0xFA, 0x67, 0xF4, 0x14, 0xC7, 0x06, 0x31, 0x4D, 0x0B, 0x63, 0x2D, 0xDF,
-    0x62, 0xD7, 0x44, 0x1A, 0x36, 0xD2, 0xC5, 0x27, 0x42, 0xCF, 0x42, 0x0A, 0x4C, 0xE5, 0x11, 0xA8,
-    0x51, 0xA5, 0xBE, 0xEE, 0x65, 0xBB, 0x03, 0xD4, 0x57, 0xEB, 0xAC, 0x61, 0x24, 0x31, 0x97, 0x43,
-    0x33, 0x5C, 0x1A, 0x17, 0x15, 0x7C, 0x75, 0x1F, 0xB1, 0xFB, 0xF4, 0x61, 0x21, 0xDF, 0xF6, 0x29,
-    0xE7, 0x3E, 0xA3, 0x10, 0x66, 0x0C, 0x88, 0x32, 0x82, 0x21, 0xC0, 0x12, 0xF2, 0xE3, 0x95, 0x4B,
-    0x57, 0xB3, 0x2F, 0x43, 0xA1, 0x72, 0x46, 0x17, 0xAB, 0x94, 0x84, 0x7F, 0xBA, 0xAE, 0xD2, 0x81,
-    0x60, 0xCE, 0xE2, 0x2E, 0x5B, 0x43, 0xAD, 0x36, 0x61, 0xAC, 0x3D, 0x0B, 0x7D, 0x56, 0xF6, 0xF7,
-    0xAA, 0x23, 0x62, 0x57, 0x5E, 0x0E, 0x7A, 0xD6, 0x4D, 0xFA, 0x7B, 0xB3, 0xBC, 0x77, 0xBF, 0x23,
-    0xCE, 0x95, 0x6D, 0x52, 0x90, 0xD2, 0x29, 0x03, 0x43, 0xB1, 0x86, 0x94, 0xFC, 0xA1, 0x26, 0x07,
-    0xF3, 0x89, 0x16, 0x8C, 0x10, 0x69, 0xC0, 0x92, 0x9E, 0x5C, 0xA9, 0x91, 0x57, 0xB9, 0xD5, 0x62,
-    0x20, 0xB2, 0x2A, 0xC0, 0x37, 0x76, 0xED, 0x3F, 0x36, 0xB9, 0x53, 0x7B, 0xA5, 0x8F, 0xB0, 0x23,
-    0x17, 0xF2, 0x00, 0xED, 0x85, 0xFB, 0xA4, 0xED, 0xEB, 0xD4, 0xAE, 0x2C, 0x0B, 0xE2, 0xFA, 0xBD,
-    0xAB, 0x1E, 0x5D, 0x1D, 0xEF, 0x42, 0x2F, 0xB2, 0x2C, 0x90, 0x8B, 0x1C, 0xEA, 0x2F, 0x75, 0x9E,
-    0x44, 0x3A, 0xE3, 0x3C, 0xD4, 0xF4, 0xE1, 0x38, 0x68, 0x51, 0x4C, 0x62, 0x05, 0x5A, 0xCF, 0x43,
-    0xC5, 0x1D, 0xC5, 0x53, 0x45, 0x8E, 0x72, 0xFE, 0x45, 0x8F, 0xD8, 0x5F, 0xE5, 0x5A, 0xE1, 0x53,
-    0x6D, 0x33, 0x56, 0xD5, 0x57, 0xDD, 0xF0, 0x2D, 0x6D, 0x71, 0xB6, 0x7D, 0x62, 0x12, 0x0E, 0xC9,
-    0xCD, 0x03, 0x94, 0x33, 0xE7, 0x8B, 0x1A, 0x93, 0x79, 0x7F, 0x2F, 0x81, 0xC1, 0xD5, 0x0C, 0x86,
-    0xED, 0xD8, 0x71, 0xB8, 0x66, 0x6C, 0xB8, 0x66, 0x70, 0x67, 0xAE, 0x46, 0xF0, 0x83, 0x8E, 0xDE,
-    0xEA, 0xD8, 0x19, 0x17, 0x0C, 0xDB, 0xC3, 0xBE, 0x07, 0x49, 0x6E, 0xB5, 0x0C, 0x46, 0xC2, 0x2F,
-    0x83, 0x34, 0x64, 0xE1, 0xBB, 0xDC, 0x8E, 0x67, 0x9F, 0x53, 0x59, 0x52, 0x78, 0x34, 0x8C, 0x91,
-    0x3E, 0xC9, 0x2E, 0x59, 0x5C, 0xFE, 0xE2, 0x6C, 0xDC, 0x1E, 0xBA, 0x05, 0xD4, 0xC0, 0xBB, 0x7F,
-    0xBD, 0xA4, 0x7A, 0x64, 0x9D, 0x12, 0xBE, 0xDC, 0xFE, 0xC8, 0x0B, 0x79, 0xB9, 0x6A, 0x7F, 0x70,
-    0x6D, 0xAE, 0xDA, 0x87, 0x90, 0x12, 0x65, 0x6B, 0x62, 0x04, 0xE6, 0x0C, 0x66, 0x24, 0xF7, 0x8B,
-    0xEF, 0xC2, 0x4C, 0x1B, 0x8E, 0x71, 0x1A, 0x27, 0x63, 0x8F, 0x47, 0xF4, 0x73, 0x97, 0x39, 0x92,
-    0xB1, 0xBA, 0x87, 0x29, 0xFD, 0x8B, 0x22, 0xA1, 0x2B, 0xF8, 0xE3, 0x1B, 0xB0, 0x9C, 0x45, 0x6C,
-    0x8A, 0xD9, 0x2A, 0xE0, 0x36, 0x88, 0x31, 0x95, 0x81, 0xE2, 0x90, 0x5D, 0x85, 0xEC, 0x83, 0x22,
-    0x91, 0xDC, 0x41, 0x9D, 0x8C, 0xB2, 0x8A, 0x82, 0x55, 0xA0, 0x95, 0x10, 0xAF, 0x7D, 0x06, 0x47,
-    0x74, 0x62, 0x89, 0xA1, 0xCF, 0x19, 0x96, 0x7F, 0x6A, 0x2F, 0xA3, 0x64, 0xB0, 0xD3, 0xF5, 0xD0,
-    0x77, 0xCC, 0xD6, 0x0E, 0xC8, 0xD1, 0x78, 0xB9, 0x4F, 0xB4, 0x87, 0xBE, 0xC7, 0x6F, 0x83, 0xF7,
-    0x54, 0x85, 0xB4, 0x17, 0x1C, 0x01, 0x2D, 0xA6, 0x7A, 0x61, 0x2B, 0x22, 0xF7, 0x98, 0xD2, 0x5E,
-    0xCE, 0xD6, 0xCE, 0x47, 0x71, 0x62, 0xE7, 0x05, 0xAF, 0x31, 0x77, 0x31, 0xD1, 0x9C, 0x5C, 0xB7,
-    0x94, 0xF1, 0x48, 0x0E, 0x4B, 0x75, 0xDC, 0xAA, 0x95, 0x8F, 0x35, 0xDB, 0x22, 0x56, 0x5B, 0xA5,
-    0xC5, 0x74, 0x2D, 0x0B, 0xAD, 0xD9, 0x5C, 0x85, 0x3B, 0x15, 0xF7, 0x6C, 0x06, 0x99, 0xEB, 0x1A,
-    0x61, 0x4D, 0x2E, 0x7B, 0x09, 0x4E, 0x79, 0x7E, 0x3C, 0x3E, 0xAE, 0xBB, 0x3E, 0x66, 0x7C, 0x6C,
-    0x6E, 0xC2, 0xAC, 0x9A, 0x6E, 0x4E, 0xE5, 0x47, 0xA6, 0x1D, 0x1F, 0xB1, 0x10, 0x96, 0xC1, 0xB3,
-    0xBD, 0xBD, 0x5D, 0x25, 0xBF, 0x0A, 0xA9, 0xB6, 0xD1, 0xFA, 0xA4, 0x5D, 0xB5, 0xF7, 0xFC, 0xCD,
-    0x9A, 0xA9, 0x53, 0x53, 0x98, 0x61, 0xBE, 0xB5, 0xBB, 0x8A, 0xDF, 0x89, 0x46, 0xEF, 0xB0, 0xEB,
-    0x2F, 0x03, 0xF3, 0x75, 0xC5, 0xD0, 0x6D, 0x4A, 0x8B, 0xC8, 0x39, 0x35, 0xBA, 0x41, 0x8D, 0x9B,
-    0x86, 0x4D, 0xA3, 0x16, 0xA6, 0x5E, 0xDC, 0xC5, 0x4C, 0x21, 0x61, 0x83, 0x36, 0x95, 0x2D, 0xC2,
-    0x36, 0x61, 0xD0, 0x03, 0x82, 0xC5, 0x4F, 0x28, 0xC2, 0x19, 0x76, 0x11, 0xF0, 0x10, 0x82, 0x40,
-    0x9D, 0x70, 0x1D, 0x35, 0xE3, 0x51, 0xDF, 0x6B, 0x6A, 0x90, 0x34, 0x46, 0x6E, 0xEC, 0x51, 0xBB,
-    0x94, 0x0F, 0xA1, 0xD2, 0x3F, 0x22, 0xF1, 0xCF, 0xAB, 0xDE, 0xA2, 0x3C, 0x23, 0xFD, 0x37, 0xE6,
-    0x7B, 0xEC, 0xB8, 0x1B, 0xF5, 0x60, 0xC3, 0xF4, 0xB2, 0x6A, 0x3A, 0xC9, 0xAE, 0xD8, 0x35, 0x3B,
-    0x6C, 0x01, 0x7B, 0x74, 0x0B, 0x46, 0xCB, 0xCD, 0xD9, 0x53, 0x79, 0x39, 0x3D, 0x83, 0x26, 0x65,
-    0x89, 0xDA, 0xA7, 0x80, 0xE0, 0x7E, 0x1E, 0xB3, 0xBF, 0xE3, 0x81, 0x04, 0x86, 0x29, 0x5D, 0x5E,
-    0x5D, 0x13, 0x86, 0x8B, 0x74, 0x16, 0x54, 0xBF, 0x21, 0x59, 0x6E, 0x01, 0xBD, 0x8A, 0xBF, 0xAB,
-    0x4F, 0x3B, 0xF7, 0xBE, 0x80, 0xDD, 0x7B, 0x5F, 0x53, 0xD3, 0xE9, 0xF4, 0xA9, 0x3B, 0x86, 0x85,
-    0x2A, 0x30, 0x8E, 0x59, 0x63, 0x60, 0x98, 0xBD, 0xF2, 0x7A, 0x7A, 0x23, 0xC8, 0xA2, 0x7B, 0x4F,
-    0x1B, 0x3F, 0xFB, 0x75, 0x39, 0xB9, 0x14, 0x64, 0xBF, 0xCD, 0xF7, 0x2F, 0x85, 0x69, 0x94, 0xDD,
-    0xBE, 0x04, 0xB7, 0xE6, 0xE5, 0xD6, 0x1C, 0x14, 0x3B, 0x9B, 0x81, 0x4A, 0xC7, 0x54, 0x6A, 0xCF,
-    0x7A, 0xF0, 0x1B, 0xCC, 0x6E, 0x67, 0xBF, 0x12, 0xF9, 0xA6, 0x9D, 0xFE, 0x5C, 0xD4, 0x27, 0x9A,
-    0xE6, 0x0A, 0x6B, 0x4D, 0xFD, 0xDB, 0xE3, 0xF1, 0x9F, 0x59, 0xAC, 0x5A, 0xD6, 0xAA, 0xF9, 0xE2,
-    0x5C, 0xB3, 0x24, 0xC6, 0x4B, 0x89, 0xFD, 0xFF, 0x4A, 0x44, 0xB3, 0x50, 0x2F, 0x85, 0x55, 0xFD,
-    0xED, 0x4E, 0x4D, 0x0C, 0x08, 0xD9, 0x2F, 0x1B, 0xD7, 0xF5, 0x80, 0x52, 0x2F, 0xC7, 0xCD, 0xB5,
-    0x6C, 0x37, 0xAC, 0x29, 0x75, 0xFF, 0x4E, 0x7F, 0x45, 0xC7, 0x25, 0x6F, 0xCE, 0x60, 0x01, 0x4B,
-    0xB7, 0x68, 0xDD, 0x19, 0x2D, 0xD7, 0x56, 0xA3, 0xD4, 0x3C, 0x6F, 0x59, 0xCF, 0xED, 0x55, 0x29,
-    0xD7, 0xA2, 0xC4, 0x62, 0x26, 0x6E, 0xBE, 0x38, 0xAE, 0xF5, 0x3B, 0xBA, 0x88, 0xC1, 0xBF, 0x6F,
-    0x7B, 0xF9, 0x49, 0xA8, 0x5E, 0x74, 0x43, 0x30, 0x83, 0x44, 0x6D, 0x8E, 0xAE, 0xD7, 0x8C, 0x5D,
-    0x0C, 0x02, 0x41, 0x20, 0x13, 0x4E, 0xF5, 0x17, 0xE4, 0xE7, 0x11, 0x76, 0x84, 0xAA, 0x02, 0xAF,
-    0x16, 0xDA, 0x04, 0x01, 0x82, 0x8C, 0xBA, 0x12, 0x63, 0x62, 0x76, 0xB7, 0x1E, 0xDA, 0xEE, 0xC7,
-    0x08, 0xBC, 0x4F, 0x97, 0x06, 0xDA, 0x7A, 0xED, 0xAE, 0x4E, 0x71, 0x6A, 0x8C, 0xAE, 0x82, 0xD3,
-    0x2D, 0xED, 0x1E, 0x50, 0xD0, 0x7A, 0xDC, 0xD6, 0x43, 0x4B, 0xF4, 0xE4, 0x31, 0x0E, 0x63, 0xBE,
-    0x12, 0x56, 0xB5, 0x83, 0x1C, 0x63, 0x5B, 0xBF, 0xA5, 0x6C, 0x47, 0x9A, 0x20, 0xB7, 0x06, 0xDF,
-    0xFF, 0x06, 0x70, 0x78, 0xB0, 0x63, 0x67, 0x32, 0x35, 0x06, 0x67, 0xEC, 0xD9, 0x7B, 0x9F, 0x3C,
-    0x89, 0x65, 0xE2, 0x5E, 0x69, 0xD5, 0x65, 0x9B, 0xE2, 0xE9, 0xEE, 0xB7, 0x54, 0x6D, 0xCF, 0x75,
-    0x67, 0xBA, 0xE8, 0xC1, 0x5B, 0xBA, 0x7C, 0xB3, 0x3C, 0x50, 0xB2, 0xA5, 0x96, 0xC5, 0x81, 0xB3,
-    0x3F, 0x71, 0x76, 0xE8, 0xE5, 0xF2, 0xE2, 0x79, 0xB1, 0xF3, 0xF3, 0xC6, 0xEC, 0x91, 0x9E, 0x85,
-    0x55, 0xEF, 0x79, 0x76, 0x8C, 0x8A, 0x48, 0x7B, 0xE3, 0x91, 0xCC, 0xE1, 0xEF, 0x89, 0x8C, 0x1C,
-    0x3D, 0x1A, 0x38, 0xA5, 0x1E, 0x5F, 0xD8, 0x23, 0x47, 0xA8, 0xC8, 0xB5, 0x8C, 0xFC, 0x1C, 0x5E,
-    0x9B, 0xA0, 0xC9, 0xDD, 0x95, 0xB9, 0x12, 0xBE, 0xD1, 0x09, 0x1B, 0xD2, 0x09, 0xBD, 0x92, 0x06,
-    0x2D, 0xEA, 0xE2, 0x67, 0x1B, 0x16, 0x25, 0x3D, 0x67, 0xE3, 0x84, 0x33, 0x33, 0x6A, 0x13, 0x44,
-    0x1A, 0x36, 0xA1, 0xA5, 0xF0, 0x16, 0x0D, 0x67, 0xDF, 0x76, 0x6A, 0xE7, 0x09, 0x8D, 0x0C, 0xE3,
-    0xAE, 0x3F, 0xB3, 0x10, 0xD1, 0xC8, 0x42, 0xF8, 0x68, 0x60, 0x4E, 0x9A, 0xC3, 0xEB, 0x1B, 0xED,
-    0xDE, 0xAA, 0x81, 0x51, 0x44, 0x6D, 0xEB, 0x3A, 0x4D, 0xE0, 0x4F, 0x9F, 0xEF, 0x2D, 0x0F, 0xCD,
-    0x1D, 0xAE, 0x3B, 0x61, 0x79, 0xBD, 0x46, 0x6D, 0x91, 0x41, 0x87, 0x3F, 0x50, 0x5E, 0x91, 0x8B,
-    0x9E, 0x76, 0x40, 0x09, 0x55, 0xDE, 0x32, 0xE5, 0x60, 0x17, 0xCD, 0x9D, 0xFE, 0x5F, 0xE3, 0x7E,
-    0x71, 0x07, 0x96, 0xBC, 0x43, 0xED, 0x4A, 0xEC, 0x1C, 0x38, 0x75, 0x32, 0xFE, 0xF3, 0xC1, 0xF9,
-    0xB0, 0x78, 0xE1, 0xE0, 0xBE, 0x7E, 0x7C, 0xB7, 0xAA, 0xD5, 0x9B, 0xDE, 0xDA, 0xB9, 0x2C, 0x19,
-    0xAC, 0xA5, 0x40, 0x75, 0x44, 0xE4, 0x7B, 0xB7, 0xCC, 0xE3, 0x23, 0x3D, 0xCD, 0x94, 0x3D, 0xF6,
-    0xD7, 0x00, 0xFA, 0x29, 0xFB, 0x84, 0x3B, 0xFB, 0xE4, 0x36, 0xBB, 0x47, 0xE6, 0x4D, 0x44, 0x2A,
-    0x8D, 0x20, 0xA8, 0x88, 0x92, 0xAF, 0xC0, 0x13, 0x8B, 0x9F, 0x29, 0x58, 0x2C, 0x33, 0x30, 0x61,
-    0x06, 0xE9, 0x39, 0xD6, 0xFF, 0x71, 0xA4, 0x04, 0xD4, 0x2D, 0x2D, 0xF2, 0x39, 0xAC, 0xC0, 0x97,
-    0x53, 0x42, 0x42, 0x7F, 0x8F, 0x58, 0xE4, 0xA7, 0xF4, 0x39, 0x2B, 0x93, 0x5B, 0x4B, 0x34, 0x9E,
-    0x95, 0xF4, 0x41, 0x8A, 0xA4, 0xC1, 0x8A, 0xCE, 0x5D, 0x96, 0xEE, 0xBF, 0xB1, 0x72, 0xBF, 0xCB,
-    0xBE, 0xD2, 0x82, 0x39, 0xFF, 0x03, 0x63, 0x0D, 0x75, 0xD0, 0xFF, 0x7F, 0xC0, 0xFE, 0xFF, 0x01,
-    0xD1, 0x50, 0x07, 0x00, 0xC5, 0x55, 0x31, 0x6E, 0xDB, 0x40, 0x10, 0x5C, 0x89, 0x16, 0x58, 0xA8,
-    0x50, 0x13, 0xD7, 0xEC, 0xD2, 0xF2, 0x07, 0x3E, 0x3E, 0x81, 0x85, 0x8D, 0x14, 0x7E, 0x84, 0x5F,
-    0x60, 0x8A, 0xBF, 0xF1, 0x27, 0x74, 0x26, 0x81, 0x7C, 0x80, 0xC8, 0x0B, 0xD4, 0xA4, 0x67, 0xC1,
-    0x82, 0x06, 0x4E, 0xBA, 0xEC, 0xEE, 0xEC, 0xD1, 0x44, 0x00, 0x1B, 0x08, 0x12, 0x20, 0x2A, 0x6E,
-    0x0C, 0xEB, 0xF6, 0x76, 0x66, 0x6E, 0x6E, 0x45, 0x44, 0xBB, 0x9A, 0x1E, 0x88, 0x3F, 0x71, 0xCE,
-    0xE3, 0x40, 0x94, 0xC5, 0xA9, 0x88, 0x3D, 0x51, 0x3E, 0x92, 0x6B, 0xF9, 0xDF, 0x87, 0x9E, 0x1C,
-    0x01, 0xBD, 0x60, 0x51, 0x51, 0x10, 0x2C, 0x49, 0x71, 0xD3, 0xC5, 0x18, 0x27, 0xFE, 0x3A, 0x02,
-    0x77, 0xDD, 0xC3, 0xB7, 0xB7, 0x9A, 0xBF, 0xF0, 0x94, 0x8D, 0xB2, 0xEF, 0x64, 0x18, 0x28, 0x3F,
-    0x03, 0xF7, 0x83, 0xD4, 0xCD, 0xB4, 0xE7, 0x2E, 0xB4, 0x9D, 0xE4, 0x64, 0x92, 0x4D, 0x09, 0x8B,
-    0x16, 0x58, 0x56, 0x8C, 0x5C, 0xA4, 0xED, 0xB9, 0x28, 0xD1, 0xB8, 0x33, 0x6C, 0x94, 0x4E, 0xFB,
-    0x1B, 0x2D, 0x43, 0xDE, 0x3C, 0x03, 0x37, 0x93, 0x60, 0xF3, 0x4E, 0x43, 0xF0, 0x65, 0xDE, 0x3E,
-    0x09, 0x8D, 0x6E, 0xCC, 0xA2, 0xB4, 0xEB, 0xDA, 0xEC, 0x42, 0xF8, 0xEC, 0x6A, 0xB8, 0xF1, 0x45,
-    0xBD, 0x78, 0x55, 0x27, 0xAE, 0xDA, 0xF0, 0x44, 0xE0, 0x28, 0xCD, 0xE0, 0x80, 0xE8, 0xBF, 0x6E,
-    0x99, 0x7A, 0xBC, 0xF2, 0xF1, 0xBB, 0xEE, 0x5E, 0x9A, 0x78, 0x55, 0x7A, 0x52, 0x9D, 0x41, 0x2B,
-    0x74, 0x65, 0xC5, 0x87, 0x56, 0xF4, 0x72, 0x35, 0xD4, 0xF1, 0xEA, 0xC8, 0x56, 0x2E, 0x69, 0x54,
-    0xA5, 0x5F, 0xB5, 0x0A, 0xAA, 0x4F, 0xD6, 0x8A, 0xAB, 0x61, 0x08, 0x6C, 0xB0, 0x55, 0x2D, 0x80,
-    0xE0, 0x17, 0x95, 0xDB, 0xA9, 0xC8, 0xAE, 0x5D, 0xB4, 0xDC, 0xAA, 0x96, 0x46, 0xB5, 0x78, 0xD5,
-    0xB2, 0x1C, 0x6D, 0x0D, 0x70, 0xB4, 0x10, 0x63, 0x2D, 0xD9, 0x5A, 0xCB, 0xF9, 0x33, 0x2D, 0xC5,
-    0x5A, 0x0B, 0x7D, 0xA6, 0x25, 0xAC, 0xB4, 0xCC, 0x7F, 0xA3, 0x05, 0x39, 0x45, 0x50, 0x6B, 0x4B,
-    0xEA, 0xF7, 0xD1, 0xA2, 0x2A, 0xCE, 0x6B, 0x56, 0x85, 0x76, 0x0A, 0xEB, 0x12, 0x8B, 0x14, 0x57,
-    0xCB, 0x2B, 0x7F, 0x8F, 0xC0, 0x32, 0x25, 0x24, 0x56, 0xAE, 0xD4, 0x9B, 0x16, 0x64, 0xD6, 0xA5,
-    0xD0, 0xBA, 0x94, 0xDA, 0x26, 0xC5, 0xD6, 0xA7, 0xDC, 0x86, 0x14, 0xDC, 0x90, 0x92, 0x3B, 0x5B,
-    0x74, 0x45, 0xA3, 0xD6, 0xF2, 0x46, 0x84, 0xD7, 0x08, 0xDE, 0xA5, 0x3F, 0x1A, 0xB5, 0x56, 0xF3,
-    0x9B, 0x0F, 0xC6, 0x54, 0x9E, 0x44, 0x4A, 0xF0, 0x12, 0xE1, 0x25, 0xC3, 0x4B, 0x88, 0x53, 0x8A,
-    0x97, 0x18, 0x2F, 0x39, 0x5E, 0x07, 0x19, 0x8E, 0xD5, 0xE6, 0xD8, 0x8F, 0xE9, 0x43, 0xC7, 0xF2,
-    0xE4, 0xD8, 0x3B, 0x8F, 0xC1, 0x1C, 0x93, 0xBB, 0xFE, 0xC0, 0xB1, 0xF2, 0x5F, 0x3B, 0x36, 0xFD,
-    0x7F, 0xC7, 0x36, 0xF7, 0x28, 0x8F, 0x92, 0xCE, 0x4D, 0x8C, 0x32, 0xB1, 0xB2, 0x39, 0x9F, 0x31,
-    0x88, 0x82, 0xCE, 0x21, 0xB9, 0x59, 0x66, 0xA3, 0x0D, 0x0E, 0xFD, 0x76, 0xD4, 0x21, 0x54, 0xCA,
-    0xEC, 0x2B, 0x2B, 0x1D, 0x81, 0x8E, 0x1E, 0x7F, 0xD6, 0x02, 0x3A, 0xE8, 0x1A, 0xCC, 0x0C, 0x03,
-    0x0F, 0x08, 0x18, 0x72, 0x41, 0x9F, 0x01, 0x1F, 0xE8, 0x30, 0x09, 0x0D, 0x1A, 0xCC, 0xBF, 0x67,
-    0x80, 0x47, 0x73, 0x8F, 0x21, 0xD8, 0xDD, 0xE0, 0xD2, 0x2E, 0x0A, 0x05, 0x80, 0x2A, 0xC2, 0x81,
-    0xE9, 0x5D, 0xD9, 0x93, 0xA2, 0x57, 0x5D, 0xBF, 0x9A, 0x3B, 0xB0, 0xC4, 0x0D, 0x7F, 0xA0, 0xB6,
-    0x57, 0xB5, 0xFB, 0x5E, 0xEE, 0x84, 0xF2, 0x5E, 0xCC, 0x2C, 0xE3, 0xC0, 0x6A, 0x65, 0x7B, 0x8C,
-    0x63, 0xF6, 0xF6, 0xD8, 0xB3, 0xDA, 0xFD, 0x59, 0xC9, 0xC9, 0x65, 0x30, 0x1D, 0xD1, 0xCD, 0x20,
-    0x86, 0xF3, 0xC4, 0xCB, 0xAE, 0x20, 0xC7, 0x3F, 0x2E, 0x42, 0xAE, 0x34, 0xB5, 0x17, 0x70, 0xEC,
-    0xF0, 0xEE, 0x9D, 0xAA, 0x65, 0xD0, 0x67, 0x7B, 0x14, 0x98, 0x78, 0x0B, 0xAB, 0x8D, 0x71, 0xA6,
-    0xE3, 0x85, 0x8E, 0x5C, 0x2E, 0x6A, 0x85, 0x72, 0x45, 0xBF, 0x00, 0x4D, 0x8F, 0xB1, 0x0D, 0xC3,
+static const uint8_t notosans_16_italicBitmaps[41158] = {
+    0xC5, 0x59, 0xBF, 0xAF, 0xE4, 0x56, 0x15, 0x3E, 0x1E, 0xEF, 0xCB, 0x20, 0x5C, 0x98, 0x62, 0x57,
+    0x20, 0xAD, 0xC0, 0x69, 0x82, 0x10, 0x12, 0xF1, 0x3F, 0x90, 0x9D, 0xEB, 0x84, 0x82, 0x82, 0x82,
+    0x57, 0xEC, 0xCB, 0x16, 0x29, 0xB6, 0xA7, 0xD9, 0x96, 0x62, 0x9F, 0xED, 0x84, 0x22, 0x45, 0x8A,
+    0xA4, 0x21, 0x75, 0x8A, 0x45, 0x28, 0x6F, 0x8B, 0x34, 0x14, 0x2B, 0x32, 0x33, 0x76, 0xA0, 0x48,
+    0x41, 0x11, 0x0B, 0x84, 0x28, 0x19, 0xC1, 0x46, 0x48, 0xA1, 0x58, 0x87, 0x38, 0x8A, 0xF7, 0xE1,
+    0x19, 0xF3, 0x7D, 0xE7, 0x5E, 0x7B, 0x66, 0xDE, 0x7B, 0xFB, 0x12, 0x20, 0x11, 0x93, 0x79, 0x77,
+    0x36, 0x1E, 0xCF, 0xBD, 0xE7, 0xC7, 0x77, 0xCE, 0xF9, 0xCE, 0xB1, 0x44, 0xA5, 0xC4, 0xA5, 0x98,
+    0x5C, 0x4C, 0x22, 0x46, 0x24, 0x13, 0x59, 0x8A, 0x2C, 0x44, 0x3A, 0x7D, 0xB7, 0xE2, 0x35, 0x32,
+    0xA9, 0xC5, 0xC7, 0x7B, 0x25, 0x7E, 0x25, 0xD3, 0x52, 0xBC, 0x44, 0xEC, 0x2B, 0xC2, 0x2F, 0x4A,
+    0xC9, 0x4A, 0xFE, 0xF4, 0x0A, 0x2F, 0x3C, 0xE0, 0xAD, 0x41, 0x25, 0x51, 0xCE, 0xAD, 0x16, 0xE2,
+    0xB5, 0xFC, 0xE1, 0x74, 0x25, 0x61, 0xC9, 0x77, 0xA4, 0x27, 0xE0, 0x3D, 0x13, 0x39, 0xD6, 0x43,
+    0xE6, 0xFB, 0xEF, 0x63, 0x7D, 0xCF, 0xF4, 0x9E, 0x58, 0x24, 0x4C, 0x24, 0xC8, 0xF5, 0x38, 0xBF,
+    0xE4, 0xF1, 0xD8, 0x5C, 0x1A, 0xCA, 0x44, 0xC9, 0xC6, 0x1F, 0x2D, 0x86, 0xF7, 0x7C, 0x10, 0xBA,
+    0xE3, 0xC1, 0x93, 0x66, 0xE7, 0xEC, 0x9C, 0xDB, 0xA5, 0xFC, 0x06, 0x97, 0x79, 0x4D, 0x05, 0xBC,
+    0x2A, 0xE2, 0x75, 0x93, 0xD6, 0xAF, 0xA7, 0xAB, 0xB0, 0x0C, 0xF3, 0x58, 0x6E, 0xE0, 0xD2, 0xC1,
+    0x51, 0x12, 0xF7, 0xA5, 0xE9, 0xCB, 0x6B, 0x47, 0x09, 0x55, 0x34, 0x65, 0x56, 0x9A, 0xE4, 0x8A,
+    0x53, 0xD9, 0xEB, 0x57, 0x22, 0x41, 0x8F, 0x43, 0xCC, 0x87, 0x1B, 0x91, 0x02, 0xDB, 0x78, 0x9D,
+    0xC4, 0x89, 0xDF, 0x40, 0xE9, 0x69, 0x8D, 0xC3, 0xA0, 0x3E, 0x36, 0xA3, 0xBE, 0xB0, 0x6C, 0x94,
+    0xC3, 0x14, 0x51, 0x1E, 0x27, 0x58, 0xA8, 0x53, 0xA2, 0xFA, 0x0F, 0x4B, 0x6A, 0xAD, 0x64, 0x28,
+    0x97, 0x91, 0x49, 0x0B, 0x3B, 0x42, 0xE4, 0x28, 0x0F, 0x21, 0xE0, 0x43, 0x98, 0x75, 0xDA, 0x6F,
+    0x78, 0x22, 0x54, 0x96, 0x03, 0x1E, 0x0E, 0xFD, 0xA3, 0x5A, 0x8A, 0x7A, 0xDA, 0xAF, 0xCC, 0xDF,
+    0xAB, 0xEC, 0xC7, 0xE5, 0xF7, 0x9C, 0x5D, 0xA1, 0xDE, 0x8E, 0x69, 0xD3, 0xAD, 0xFF, 0xAC, 0x1D,
+    0x9C, 0xFF, 0xD4, 0x1A, 0x10, 0xCF, 0xBD, 0x8A, 0x96, 0x9A, 0xF4, 0xF8, 0xE1, 0x87, 0x45, 0x29,
+    0xDF, 0x11, 0x9C, 0x2A, 0x02, 0x15, 0x84, 0x77, 0xBA, 0x65, 0xCA, 0x6B, 0x21, 0x7F, 0x02, 0x65,
+    0x74, 0x7F, 0x91, 0x35, 0xBF, 0x6C, 0x86, 0xEB, 0x19, 0x8C, 0xE4, 0xF1, 0xD2, 0x94, 0x97, 0x62,
+    0xDE, 0x55, 0xF0, 0x86, 0x96, 0x37, 0xF0, 0xD7, 0xE6, 0xA3, 0x93, 0xB7, 0x25, 0xEB, 0xFB, 0x35,
+    0x97, 0x6E, 0x30, 0x23, 0x0F, 0x8F, 0xC6, 0xC3, 0x7F, 0x60, 0xF7, 0xD2, 0xD3, 0xB6, 0x4B, 0xC8,
+    0xCD, 0xA0, 0x9B, 0xEE, 0xF8, 0xD4, 0x3B, 0xF8, 0x45, 0x88, 0x1F, 0x60, 0xD1, 0x7B, 0xDB, 0x41,
+    0x16, 0xE2, 0x55, 0x71, 0xEB, 0x96, 0xD4, 0x7E, 0xF1, 0xB4, 0x4C, 0x3A, 0x99, 0x1D, 0x46, 0x8D,
+    0x98, 0x1E, 0xBF, 0xB8, 0x4E, 0x5B, 0xCA, 0x35, 0x0B, 0x5D, 0x3D, 0xCD, 0x70, 0xFB, 0x1E, 0xCB,
+    0x84, 0x4B, 0xF0, 0x17, 0x1C, 0x14, 0xBD, 0x8E, 0xEF, 0x33, 0x40, 0x45, 0x3A, 0x43, 0x0B, 0x18,
+    0xDE, 0x9A, 0xD2, 0x6F, 0x0B, 0x1E, 0x33, 0xA7, 0x3D, 0x3B, 0x5A, 0xA6, 0x85, 0x70, 0xF8, 0xB7,
+    0xA1, 0x75, 0xA1, 0x56, 0x5F, 0x17, 0x58, 0x56, 0x3F, 0x3D, 0xB9, 0x7F, 0x8A, 0x5D, 0xA6, 0xDC,
+    0x3D, 0x28, 0x07, 0x0D, 0x46, 0x35, 0x60, 0x6C, 0xB8, 0x8B, 0x0B, 0x34, 0xCF, 0xAD, 0x31, 0x67,
+    0x5C, 0x8E, 0xB9, 0xCC, 0xB9, 0xA8, 0x7D, 0x68, 0xC8, 0xC9, 0xA7, 0xF7, 0x20, 0x00, 0x6F, 0xC3,
+    0x02, 0x4F, 0x24, 0xAA, 0xAF, 0xD7, 0x8D, 0x4A, 0x2F, 0xF6, 0x17, 0x7E, 0x01, 0x00, 0x1D, 0x4A,
+    0x50, 0xCB, 0xE2, 0xF9, 0xAC, 0x92, 0x82, 0xC6, 0x8D, 0x7B, 0xFE, 0xEA, 0xAA, 0x8C, 0xAF, 0x08,
+    0x17, 0x27, 0xFC, 0x26, 0xDC, 0xBC, 0x08, 0x0B, 0x54, 0xCE, 0x7A, 0xBA, 0xEF, 0x8E, 0xC3, 0x55,
+    0xEC, 0x57, 0x36, 0xD8, 0xE0, 0x36, 0xF0, 0x6E, 0x96, 0xB7, 0x61, 0xC4, 0x15, 0xF1, 0x99, 0xE3,
+    0xA0, 0x8C, 0xA7, 0x69, 0x2C, 0x1D, 0x8F, 0x4B, 0x2A, 0x6A, 0x0D, 0x6C, 0x61, 0x92, 0x60, 0x25,
+    0xD1, 0x0A, 0xE8, 0x85, 0xBA, 0xB4, 0xED, 0x80, 0xDE, 0x18, 0x16, 0xA2, 0x2B, 0x74, 0xD9, 0x8C,
+    0x32, 0x37, 0xC3, 0xC9, 0x16, 0x65, 0xF9, 0x80, 0xB2, 0xE5, 0xDE, 0x1D, 0x0A, 0xCB, 0x2D, 0x1E,
+    0xF6, 0xEF, 0xF0, 0xF7, 0xEF, 0x88, 0xC7, 0x3B, 0x16, 0x5B, 0xC5, 0x27, 0x8C, 0xDB, 0x08, 0x20,
+    0x94, 0xEC, 0x17, 0x3D, 0x4D, 0x68, 0x12, 0x48, 0x1C, 0xE5, 0x5E, 0x33, 0x2E, 0xAD, 0x0D, 0x44,
+    0x6C, 0x9B, 0x4D, 0x15, 0x9D, 0x10, 0x28, 0xD2, 0x00, 0x84, 0xBD, 0x82, 0x26, 0xAA, 0xB0, 0x33,
+    0x4E, 0xC9, 0x68, 0xE7, 0x05, 0x4D, 0xA6, 0x11, 0xA6, 0xCB, 0x9A, 0xD7, 0x0A, 0xCA, 0x60, 0xAA,
+    0x78, 0x65, 0xDD, 0x3B, 0xE9, 0x1F, 0x0F, 0x71, 0xCB, 0x57, 0x80, 0x4B, 0x59, 0x5F, 0x7B, 0xFD,
+    0xAD, 0x0E, 0xF2, 0xAE, 0x11, 0x86, 0x29, 0xA4, 0x35, 0xCC, 0x94, 0x8C, 0x5D, 0xF7, 0x97, 0xE1,
+    0xFF, 0x37, 0x61, 0xE9, 0xAF, 0xC3, 0xE6, 0xCE, 0xDA, 0xEF, 0xD7, 0x9D, 0x14, 0x2B, 0x9C, 0x00,
+    0x01, 0xD5, 0x48, 0xF4, 0x0E, 0xED, 0x44, 0x15, 0x0B, 0xB9, 0x77, 0xBD, 0x13, 0x82, 0x83, 0xF2,
+    0x69, 0x4E, 0xFE, 0x86, 0xAC, 0x27, 0xF8, 0xCF, 0x6B, 0xE5, 0x82, 0xD7, 0x4E, 0x26, 0xF3, 0x74,
+    0x97, 0x58, 0xDF, 0x6A, 0xCF, 0x4B, 0x5E, 0xD0, 0xD3, 0xD7, 0x2C, 0xAE, 0x79, 0x8D, 0x29, 0x1C,
+    0x90, 0xBD, 0xCB, 0xB3, 0x5C, 0x3E, 0x6C, 0xE8, 0x59, 0x89, 0x3E, 0x2C, 0xF2, 0xAF, 0x69, 0x92,
+    0x08, 0x77, 0xFE, 0xB8, 0x39, 0x3D, 0xB1, 0xB1, 0xF1, 0x0A, 0xD3, 0x48, 0x91, 0x28, 0xDA, 0x54,
+    0x9B, 0xD2, 0x86, 0x89, 0xB7, 0x27, 0xA5, 0x10, 0x65, 0x92, 0xE5, 0x36, 0x9A, 0x1D, 0x76, 0xD5,
+    0x9D, 0x05, 0x75, 0x64, 0x06, 0xF0, 0x7B, 0x46, 0x19, 0x03, 0x36, 0xFC, 0x80, 0xA7, 0xBC, 0x8E,
+    0xC5, 0x70, 0xA7, 0x94, 0x4B, 0x07, 0x49, 0x27, 0x0D, 0x82, 0x90, 0x79, 0x1D, 0x62, 0xFB, 0x2C,
+    0x01, 0x38, 0x2F, 0xA6, 0xAD, 0x32, 0x2E, 0x9B, 0x93, 0xFB, 0xB5, 0xC7, 0x52, 0x80, 0xAB, 0xB8,
+    0x73, 0x05, 0xF0, 0x42, 0x5A, 0xAF, 0xA5, 0x59, 0x19, 0xF8, 0xD2, 0x2D, 0x15, 0x5A, 0x71, 0xFF,
+    0x50, 0x88, 0xD6, 0x9C, 0xCB, 0x0A, 0x20, 0x67, 0x70, 0xD1, 0x1C, 0x0B, 0xFA, 0xBB, 0x73, 0x4B,
+    0x03, 0x7B, 0x4F, 0x6B, 0xC0, 0x34, 0xAA, 0xFC, 0xCD, 0xFD, 0x9E, 0x01, 0xFB, 0x90, 0x4B, 0x4B,
+    0x77, 0x15, 0xB4, 0x5B, 0x9C, 0x6B, 0x9E, 0xB6, 0x45, 0x21, 0xE7, 0x82, 0x7A, 0x50, 0xD2, 0xE5,
+    0x2C, 0x0A, 0x08, 0x88, 0x93, 0x77, 0x3A, 0x2B, 0x59, 0x61, 0x23, 0x43, 0x5F, 0x31, 0x00, 0x38,
+    0x61, 0xCA, 0x8C, 0x36, 0xF7, 0x91, 0x65, 0x2A, 0x98, 0x7C, 0x33, 0x64, 0xD6, 0x69, 0xBD, 0x97,
+    0x97, 0xB7, 0x90, 0x37, 0x63, 0x1A, 0x5C, 0x5E, 0xB0, 0x64, 0xE3, 0x2D, 0x9A, 0xFC, 0x22, 0x06,
+    0x7B, 0xB0, 0x39, 0x7A, 0xC0, 0x73, 0xB0, 0x6D, 0x46, 0x7D, 0xE5, 0xA6, 0x9E, 0x7D, 0x4F, 0x54,
+    0xF5, 0x44, 0xAC, 0xEE, 0x50, 0x3E, 0x6A, 0x19, 0x51, 0x48, 0xAA, 0x8C, 0xAB, 0x8D, 0x86, 0x9E,
+    0xA6, 0x02, 0x96, 0xC0, 0x56, 0x6C, 0x2E, 0xB4, 0x39, 0xE0, 0xCC, 0x4A, 0xD4, 0x66, 0x5A, 0x78,
+    0x96, 0x8A, 0x8A, 0x8E, 0x2B, 0xF6, 0x81, 0x29, 0x50, 0x34, 0x60, 0x0B, 0xD4, 0x09, 0x62, 0x1F,
+    0xE1, 0x20, 0x4F, 0x21, 0x38, 0xCD, 0x49, 0xA1, 0xC2, 0x30, 0x00, 0x0B, 0x15, 0x89, 0xBE, 0xAB,
+    0x28, 0x48, 0x69, 0x97, 0x74, 0x8C, 0xEE, 0x6D, 0xD6, 0xE4, 0xA2, 0xC8, 0xB7, 0x29, 0x65, 0x73,
+    0x72, 0x8F, 0x4E, 0x68, 0xEC, 0xA2, 0x69, 0x4D, 0x4B, 0xDF, 0x7E, 0x4A, 0x56, 0xBC, 0xF1, 0xF0,
+    0xC1, 0x2C, 0x27, 0x27, 0x0C, 0x53, 0x1C, 0x51, 0xD0, 0xED, 0xFF, 0xC5, 0xB9, 0x5A, 0x3A, 0x4F,
+    0x87, 0xC3, 0xA7, 0x74, 0xEA, 0x85, 0xE7, 0xE6, 0xFB, 0xE7, 0x8E, 0x85, 0x6B, 0xB1, 0x1B, 0x7C,
+    0x0A, 0xC0, 0x09, 0x73, 0x26, 0x40, 0x70, 0x02, 0x9B, 0x03, 0x05, 0xDF, 0x22, 0x62, 0x78, 0x88,
+    0x9E, 0xAE, 0x40, 0xB0, 0x48, 0xB0, 0x50, 0xB0, 0x9B, 0xDA, 0x0D, 0xE9, 0x19, 0x48, 0x92, 0x41,
+    0x96, 0x16, 0xB6, 0xF7, 0x21, 0xD0, 0x52, 0x45, 0xDC, 0x5D, 0x33, 0x4D, 0x2B, 0x46, 0xCD, 0x63,
+    0x2C, 0x9D, 0x50, 0xCE, 0x04, 0x5C, 0x14, 0xB9, 0x1E, 0x9E, 0x50, 0x10, 0x26, 0x33, 0x85, 0x06,
+    0x0F, 0xF0, 0xF5, 0x07, 0xE3, 0xCF, 0x52, 0xD5, 0xEC, 0x58, 0xD7, 0x85, 0xEA, 0xD6, 0xA9, 0x65,
+    0x3B, 0xDE, 0xBC, 0x8B, 0x8D, 0xC9, 0xE6, 0x04, 0x5A, 0xC0, 0x32, 0x48, 0xC4, 0x5C, 0x3B, 0x75,
+    0x4C, 0xA7, 0x16, 0x52, 0x54, 0x78, 0xAD, 0x62, 0xA3, 0x21, 0x41, 0x53, 0x2A, 0xC4, 0xF5, 0xF2,
+    0x03, 0x35, 0x4E, 0x0C, 0x63, 0xE5, 0xB1, 0xF5, 0x01, 0x5D, 0x30, 0x24, 0x4B, 0x96, 0xE2, 0xE0,
+    0x4C, 0x42, 0xA2, 0x81, 0x8C, 0x6C, 0xFF, 0x52, 0x67, 0xF5, 0xCE, 0xFD, 0xB5, 0x5A, 0x49, 0x81,
+    0x82, 0x1C, 0x20, 0x28, 0x65, 0xFF, 0x5B, 0x6A, 0xC3, 0x6C, 0x7C, 0xF6, 0x20, 0x6A, 0x10, 0x5E,
+    0x72, 0xD0, 0xEC, 0xFC, 0x41, 0xDC, 0x4A, 0xB7, 0x71, 0x5B, 0x21, 0x0A, 0x9E, 0x61, 0x0C, 0x90,
+    0x14, 0xB5, 0xAE, 0x72, 0xC4, 0xE2, 0x68, 0xDD, 0x5A, 0xC3, 0xA9, 0xE1, 0x26, 0x74, 0xF6, 0x82,
+    0x94, 0x1B, 0x20, 0x24, 0x15, 0xE8, 0xB4, 0xFE, 0x75, 0xBC, 0xEC, 0xB5, 0xCC, 0x9D, 0x93, 0x46,
+    0xF3, 0xC4, 0x67, 0x04, 0xA5, 0xDF, 0xDB, 0xB5, 0x53, 0xCA, 0x94, 0x6A, 0x14, 0x18, 0x45, 0x22,
+    0xA5, 0x53, 0x8E, 0x4A, 0xC2, 0xC9, 0x52, 0x97, 0x50, 0x8F, 0x38, 0xB1, 0x31, 0x3B, 0x51, 0xAF,
+    0x31, 0x53, 0xA7, 0x7A, 0xF8, 0xC2, 0x26, 0x8F, 0xF8, 0x02, 0xBB, 0xCD, 0x2F, 0x50, 0xC9, 0x59,
+    0xC6, 0x5F, 0x9D, 0xB7, 0x0E, 0x2D, 0xC3, 0xA8, 0x1B, 0xAD, 0x83, 0x90, 0x63, 0xC4, 0x69, 0xC0,
+    0xC5, 0xF4, 0x17, 0xC8, 0x30, 0xEB, 0x1C, 0x3E, 0xB0, 0x45, 0xDC, 0x4A, 0x46, 0x89, 0x00, 0x5D,
+    0x7C, 0x6C, 0x6A, 0x59, 0xD7, 0xE2, 0x7D, 0x06, 0x06, 0x86, 0xC8, 0xFE, 0x44, 0x3F, 0xA6, 0x7F,
+    0x5E, 0x79, 0x0D, 0x70, 0xF3, 0x7E, 0x35, 0xA9, 0x51, 0xD2, 0x03, 0xE4, 0x7A, 0x10, 0x3F, 0xA6,
+    0xFC, 0xB9, 0xCC, 0xF1, 0xB1, 0x9A, 0x4B, 0x0B, 0x6E, 0x5E, 0xDD, 0x9D, 0xD4, 0x71, 0x12, 0x94,
+    0xC7, 0x3E, 0x0C, 0x10, 0x96, 0x37, 0xC2, 0x12, 0x1F, 0xF9, 0x0D, 0x94, 0x45, 0x88, 0x34, 0x33,
+    0x50, 0x27, 0x4E, 0x66, 0xC7, 0xD0, 0x28, 0xE6, 0x99, 0x24, 0xE4, 0x71, 0x8D, 0x8F, 0x19, 0xC2,
+    0x01, 0x6A, 0x1D, 0x23, 0xBA, 0xF0, 0x31, 0xC7, 0x4F, 0xA8, 0x20, 0x13, 0x6E, 0xCB, 0x70, 0x01,
+    0x16, 0x4C, 0xA5, 0x2C, 0x50, 0x09, 0x76, 0xA1, 0xEB, 0xBA, 0xA5, 0xE6, 0x6D, 0x47, 0xF8, 0xB5,
+    0x73, 0x00, 0xD0, 0x6B, 0xE0, 0xB6, 0x72, 0x52, 0x1B, 0xAD, 0x44, 0x71, 0x12, 0xE5, 0x7E, 0x8D,
+    0x7E, 0x23, 0xF1, 0xD1, 0x77, 0xC4, 0xB8, 0x6B, 0x0A, 0x91, 0x28, 0xF7, 0x4C, 0xEF, 0xC2, 0xBD,
+    0x60, 0x23, 0x0B, 0x8D, 0xA3, 0x39, 0xED, 0xB4, 0xE8, 0x68, 0xF8, 0x99, 0x12, 0x14, 0x18, 0x02,
+    0x58, 0x42, 0x1B, 0x40, 0xF4, 0xD7, 0x34, 0x7E, 0x50, 0x8F, 0xF9, 0x22, 0x03, 0x65, 0x63, 0xCE,
+    0xA1, 0x23, 0x4F, 0xEF, 0xC0, 0x21, 0x45, 0xEE, 0x6D, 0x94, 0x9E, 0x67, 0x0A, 0x1E, 0x25, 0x67,
+    0xB6, 0x1C, 0xB1, 0x00, 0xB1, 0x80, 0x96, 0x46, 0x71, 0x60, 0x31, 0x91, 0x69, 0x16, 0x49, 0x75,
+    0x5D, 0x6A, 0x5D, 0xE1, 0x6A, 0x92, 0xA5, 0xD6, 0x8E, 0xA5, 0x32, 0xF1, 0x4C, 0x19, 0xA8, 0xD1,
+    0x04, 0x04, 0x03, 0xE0, 0x74, 0xE4, 0x0B, 0xD8, 0x20, 0xD8, 0xBC, 0xA8, 0xAC, 0x87, 0x1C, 0x4B,
+    0x63, 0x72, 0xCC, 0x17, 0xFD, 0x5B, 0x2C, 0x22, 0x1B, 0x57, 0x4A, 0x53, 0x3A, 0x79, 0x21, 0x10,
+    0x64, 0x41, 0x5B, 0x75, 0xC3, 0xC2, 0x2A, 0xBA, 0x62, 0xE4, 0x57, 0x0C, 0x79, 0x18, 0xC3, 0xEB,
+    0x13, 0x9F, 0xBB, 0xA9, 0x3E, 0xC1, 0xE9, 0x2F, 0x3F, 0x37, 0x77, 0x5F, 0x9C, 0x43, 0xBF, 0x4A,
+    0x9B, 0x18, 0xB5, 0xC9, 0xF2, 0x62, 0x9B, 0xC4, 0xD6, 0x26, 0xC9, 0x19, 0x9B, 0xDC, 0xAE, 0xB6,
+    0x79, 0xDB, 0xE6, 0x70, 0xB1, 0x35, 0x3F, 0xD3, 0xC4, 0xFD, 0x7D, 0xAD, 0x3A, 0x6F, 0x6C, 0x2D,
+    0xC6, 0xAA, 0x13, 0xA9, 0xC5, 0xEA, 0xCB, 0x2C, 0x66, 0x72, 0xFF, 0xD3, 0x97, 0x7A, 0xC7, 0x3B,
+    0x94, 0xB1, 0x56, 0x30, 0x8D, 0x23, 0x1D, 0xDA, 0x23, 0x92, 0x97, 0x27, 0x9A, 0x4E, 0xA1, 0xB6,
+    0x6D, 0x37, 0x1D, 0x93, 0x5F, 0x0F, 0xE1, 0x6D, 0x5B, 0xB3, 0xB5, 0xD8, 0x2E, 0xC5, 0x9C, 0xA2,
+    0x00, 0x14, 0xA4, 0x96, 0xDD, 0xD0, 0x23, 0x78, 0x63, 0x17, 0x62, 0x5B, 0x91, 0x5E, 0xAD, 0xAF,
+    0x3D, 0xC3, 0x5A, 0x59, 0x36, 0xFD, 0x92, 0x69, 0xB1, 0x6D, 0x06, 0xAE, 0xB2, 0xBD, 0xDD, 0xB6,
+    0x19, 0x2D, 0x88, 0x0C, 0x74, 0x49, 0x8F, 0x8A, 0x8A, 0xA5, 0x76, 0xE8, 0x52, 0x8E, 0x44, 0x6B,
+    0x7E, 0x9F, 0xB0, 0x95, 0x4A, 0x7A, 0x2D, 0x7A, 0x67, 0x2A, 0xE7, 0xD6, 0xF5, 0x17, 0x79, 0x7D,
+    0xB9, 0xD7, 0x0C, 0x5D, 0x58, 0x97, 0xF7, 0xFB, 0xDA, 0xED, 0xEE, 0x73, 0x5E, 0xEE, 0x18, 0x4A,
+    0x73, 0x5E, 0x59, 0xD0, 0xCB, 0xC7, 0xDC, 0x3B, 0xE5, 0xB6, 0xDA, 0xEB, 0xCC, 0xAC, 0xC1, 0x68,
+    0x69, 0x62, 0x97, 0x91, 0xCC, 0x4C, 0x01, 0xE9, 0x75, 0x58, 0xC1, 0x06, 0x31, 0x4A, 0x58, 0xF6,
+    0x5E, 0xC1, 0x71, 0xE1, 0xCF, 0x99, 0xCF, 0x5F, 0x63, 0xD6, 0xFB, 0x80, 0x80, 0x7A, 0xC4, 0x83,
+    0xE8, 0xE5, 0x80, 0x52, 0x05, 0x23, 0x83, 0x3B, 0x76, 0x93, 0x8E, 0x54, 0x5B, 0xDC, 0x8C, 0x9F,
+    0x3D, 0x75, 0x48, 0x61, 0x49, 0xEB, 0x1B, 0xFF, 0x11, 0xE5, 0x9F, 0xA1, 0x3D, 0xA5, 0xEB, 0x90,
+    0x1F, 0x5E, 0x67, 0x9A, 0x46, 0x52, 0x0A, 0x13, 0xB6, 0x0F, 0x62, 0xC2, 0x44, 0x87, 0x2D, 0xC7,
+    0xA1, 0x1D, 0x2D, 0x74, 0xF6, 0xD3, 0x6B, 0xC2, 0x1C, 0x12, 0x19, 0xA6, 0x19, 0x32, 0x34, 0xBF,
+    0x0A, 0x5F, 0x6E, 0x94, 0x24, 0xAB, 0x68, 0x26, 0xCC, 0xC3, 0x57, 0x21, 0x9D, 0x89, 0x25, 0xFC,
+    0x3D, 0x4B, 0x28, 0x0E, 0xA0, 0xA0, 0xF1, 0x5D, 0x1C, 0x24, 0x9A, 0x74, 0x03, 0x8A, 0x8B, 0x0C,
+    0xA8, 0x12, 0x8F, 0x9F, 0x95, 0x6D, 0xF3, 0x51, 0x35, 0x1C, 0xF1, 0xC8, 0xC5, 0xB7, 0x13, 0x96,
+    0x8A, 0x36, 0x65, 0xA5, 0x56, 0x5E, 0x01, 0x52, 0xAC, 0xE5, 0x40, 0x8D, 0xAD, 0xA5, 0x49, 0x16,
+    0xEA, 0xB3, 0x99, 0xBA, 0xCA, 0xA8, 0x87, 0xA2, 0x1D, 0xEE, 0xA2, 0x18, 0x62, 0xFA, 0xC4, 0xAF,
+    0x1E, 0x5B, 0x87, 0xE9, 0x04, 0xA1, 0xD4, 0x63, 0x93, 0x63, 0x71, 0xD3, 0x12, 0xAF, 0xD3, 0x30,
+    0x53, 0x6A, 0x10, 0x6A, 0x47, 0x12, 0xEB, 0x3F, 0x2C, 0x8B, 0x99, 0x13, 0x1E, 0x0B, 0xE7, 0xB8,
+    0xB5, 0x2D, 0x60, 0xC6, 0x52, 0x88, 0xB0, 0xB2, 0xC3, 0x18, 0x0D, 0xEB, 0xB0, 0x04, 0x5A, 0x83,
+    0xF7, 0x70, 0xC2, 0xF4, 0x8F, 0x2C, 0x53, 0xFF, 0xA8, 0x1C, 0x76, 0xBD, 0x7E, 0x6C, 0xB0, 0x9F,
+    0x88, 0x9F, 0xD5, 0x79, 0xFC, 0x30, 0x5E, 0xFA, 0x61, 0x8D, 0x5C, 0x7B, 0x3B, 0x39, 0x47, 0xD0,
+    0x4C, 0x3E, 0xE2, 0xD4, 0x7B, 0xC2, 0x97, 0xC5, 0xF6, 0x4B, 0xFF, 0xD2, 0x2F, 0x9B, 0xED, 0x97,
+    0xF1, 0x47, 0x27, 0x27, 0x62, 0x5B, 0xEB, 0xB1, 0xB7, 0xD6, 0x96, 0x73, 0xE3, 0x93, 0x4E, 0xBC,
+    0x5F, 0x4A, 0x7F, 0xEB, 0x51, 0x89, 0xB8, 0xEB, 0x73, 0xC4, 0x5D, 0x66, 0x81, 0xA3, 0xA8, 0xD1,
+    0x91, 0xDF, 0x76, 0x10, 0x95, 0xBA, 0x56, 0x5E, 0x81, 0xD7, 0xB2, 0xDF, 0x61, 0xA2, 0x88, 0xB1,
+    0xBC, 0x87, 0xC2, 0x1B, 0xF5, 0x7F, 0xAD, 0x91, 0x5A, 0x5E, 0x58, 0xB9, 0xE6, 0x4F, 0x5B, 0xCE,
+    0x8B, 0xE2, 0x32, 0x96, 0xFD, 0xE0, 0x0C, 0xC8, 0x1F, 0x32, 0x04, 0xFA, 0xFA, 0x31, 0xF8, 0x4D,
+    0x5F, 0x42, 0xEA, 0x1E, 0x16, 0x44, 0x0A, 0x46, 0xFA, 0x22, 0x05, 0xF4, 0x49, 0xD0, 0xB5, 0xC5,
+    0xE4, 0x68, 0x0E, 0xD5, 0xD0, 0x8E, 0xD1, 0x22, 0xDE, 0x69, 0x12, 0xF5, 0x6E, 0x54, 0xE3, 0xF6,
+    0x78, 0x81, 0xD0, 0x79, 0xD6, 0x20, 0x95, 0xDF, 0x08, 0x34, 0xF3, 0x1C, 0x3A, 0x4D, 0xA7, 0x9C,
+    0x52, 0xB0, 0x13, 0xFE, 0xC5, 0x5B, 0x4C, 0x39, 0xAC, 0x88, 0xCA, 0x0C, 0xF3, 0x2D, 0x5B, 0xC9,
+    0x5C, 0x9A, 0x18, 0xFE, 0xF4, 0x3A, 0x07, 0x7C, 0xAB, 0xEB, 0x3A, 0xA9, 0xF0, 0x98, 0xA3, 0x0F,
+    0xEC, 0x78, 0x48, 0xCB, 0x56, 0x7B, 0xA9, 0xFF, 0x99, 0xDB, 0x03, 0x5A, 0xF7, 0x83, 0x2F, 0xC3,
+    0xBA, 0xA7, 0xA3, 0x75, 0x7F, 0xB8, 0x1A, 0x5B, 0x6B, 0x3B, 0x33, 0x50, 0xB5, 0x6E, 0x35, 0x7E,
+    0xEB, 0xB5, 0xC1, 0x8A, 0x7D, 0xEA, 0xA4, 0xE1, 0xA0, 0xD1, 0x3C, 0x5F, 0x54, 0x46, 0x67, 0x29,
+    0x0F, 0x25, 0x4D, 0x2E, 0x54, 0x2B, 0xE1, 0x70, 0xCF, 0xAA, 0xA5, 0xBB, 0x1D, 0xD0, 0x5A, 0x4C,
+    0xB5, 0xEC, 0x03, 0x76, 0xE6, 0x25, 0xD6, 0x7B, 0x83, 0xE3, 0xBC, 0x62, 0x43, 0x20, 0x63, 0x39,
+    0x28, 0x6E, 0x7E, 0xB1, 0x6E, 0xE7, 0x49, 0x59, 0xF5, 0x0B, 0x54, 0x6A, 0x6E, 0xF7, 0xAB, 0x76,
+    0x88, 0xFC, 0x22, 0xDF, 0x99, 0xD7, 0xE4, 0xB4, 0xC9, 0xC7, 0x48, 0xB7, 0x7F, 0x7A, 0x17, 0x1D,
+    0x3B, 0xE7, 0x4F, 0x1D, 0x3B, 0x6C, 0x8E, 0x58, 0x75, 0xA8, 0x1B, 0x2A, 0x40, 0x58, 0xD8, 0x98,
+    0x04, 0x6C, 0x16, 0xC4, 0x92, 0x71, 0xD9, 0x60, 0x99, 0xAC, 0x89, 0x22, 0x2C, 0x4D, 0x3A, 0x87,
+    0x61, 0xC1, 0xC6, 0xBC, 0xBE, 0xC2, 0x51, 0x57, 0xBC, 0xC6, 0x8E, 0x52, 0x9D, 0xD0, 0x48, 0xE6,
+    0x4F, 0x33, 0xA1, 0x99, 0x37, 0x49, 0xBC, 0x69, 0xAE, 0xAF, 0xB3, 0xFC, 0x7E, 0x11, 0x78, 0xCF,
+    0x2C, 0xBC, 0x37, 0x0A, 0xEF, 0x1C, 0xF0, 0xBE, 0x43, 0x78, 0x07, 0x84, 0x77, 0x50, 0x01, 0xAF,
+    0x41, 0x35, 0x61, 0x57, 0x03, 0x78, 0xEB, 0x00, 0x42, 0x05, 0x27, 0x13, 0x15, 0xF2, 0x50, 0x5B,
+    0x42, 0x74, 0x49, 0xB9, 0xFB, 0xB1, 0x32, 0x3D, 0xEE, 0xDE, 0xD9, 0xC2, 0x2C, 0x4F, 0xE9, 0xD1,
+    0x10, 0x2D, 0x4C, 0xB6, 0x74, 0xE6, 0x78, 0x7F, 0x38, 0x3F, 0xCC, 0xB9, 0xED, 0x70, 0x97, 0xB0,
+    0xAC, 0x64, 0x77, 0x28, 0x1C, 0x3B, 0x51, 0xBD, 0xDC, 0xF5, 0x2A, 0x4C, 0x77, 0xD5, 0xD9, 0xC9,
+    0xD0, 0xF9, 0x5E, 0xE5, 0xF8, 0x7C, 0x53, 0xA4, 0x6D, 0x4F, 0x7D, 0xBE, 0xED, 0x19, 0xFB, 0xAB,
+    0x7C, 0xBF, 0xED, 0x81, 0x83, 0xBF, 0xCB, 0xB6, 0xA5, 0x75, 0x83, 0xC6, 0x83, 0xE4, 0x73, 0xEB,
+    0xB8, 0x03, 0x46, 0xC4, 0x36, 0x92, 0xB3, 0x05, 0xE6, 0xBA, 0x8E, 0x22, 0xB7, 0x11, 0xA9, 0x36,
+    0x2E, 0x4D, 0x3E, 0xE6, 0xF0, 0xE8, 0x13, 0x8A, 0xC0, 0xB1, 0xE8, 0x94, 0x78, 0x0E, 0x5A, 0x96,
+    0xEE, 0x6A, 0x29, 0x43, 0x72, 0xD7, 0x71, 0xBB, 0xA2, 0x82, 0x09, 0x44, 0xC7, 0x72, 0x9A, 0x30,
+    0xBD, 0xE4, 0x02, 0xDB, 0x98, 0xBD, 0x81, 0xB9, 0x7B, 0xE0, 0xD1, 0xEC, 0x0D, 0xCC, 0x83, 0x52,
+    0xCE, 0x0F, 0xDA, 0x87, 0xD7, 0xDD, 0x80, 0x43, 0x3A, 0x99, 0x67, 0x3D, 0x7B, 0x2D, 0xA4, 0xB8,
+    0x9F, 0xBC, 0xD9, 0x31, 0xC9, 0x2D, 0x50, 0x46, 0x7A, 0xA0, 0x4F, 0x16, 0x40, 0x02, 0x7A, 0xBB,
+    0x39, 0xF1, 0x5B, 0x6A, 0xB7, 0x46, 0x62, 0xAF, 0x45, 0xC9, 0x6B, 0xB5, 0xA5, 0xD5, 0x69, 0x15,
+    0x3E, 0xEA, 0x80, 0x58, 0x40, 0xCD, 0x2E, 0x95, 0xE9, 0xE1, 0x83, 0xD9, 0x51, 0xDB, 0x69, 0x65,
+    0x73, 0x04, 0x53, 0x6C, 0x7B, 0x64, 0xE3, 0x9A, 0x64, 0xCD, 0x81, 0x77, 0xC9, 0x2D, 0x20, 0x40,
+    0x29, 0xEB, 0xF5, 0x1D, 0xA0, 0xAF, 0x0A, 0x2B, 0x14, 0xB2, 0x60, 0x35, 0x21, 0x04, 0xC1, 0x31,
+    0x41, 0x10, 0x1D, 0x04, 0xA3, 0x12, 0xC6, 0x88, 0x49, 0x05, 0x9D, 0x6D, 0x06, 0x08, 0x6A, 0xD8,
+    0x2C, 0xA9, 0x1D, 0x47, 0xA3, 0x23, 0x04, 0x5D, 0x76, 0xE5, 0x30, 0x0E, 0xE6, 0xE6, 0xF0, 0x92,
+    0xA9, 0x6B, 0x39, 0x32, 0x20, 0x63, 0xED, 0xB1, 0x7D, 0xAA, 0x91, 0xBA, 0x25, 0xB5, 0x46, 0x4D,
+    0x77, 0x1E, 0x6D, 0xE0, 0xE4, 0xE8, 0x21, 0xC4, 0xD3, 0x67, 0x0E, 0x9E, 0x72, 0xBE, 0xED, 0xE4,
+    0x2F, 0x9A, 0x90, 0x08, 0x72, 0xE6, 0x6A, 0xD2, 0xDB, 0xF0, 0x57, 0x4D, 0x8E, 0xCA, 0x8E, 0x2B,
+    0xE3, 0x00, 0xA1, 0xA0, 0xD2, 0x6B, 0x3B, 0x7D, 0x87, 0xDE, 0x68, 0xAF, 0x1A, 0x8F, 0x2E, 0xE2,
+    0xC3, 0x1C, 0xDE, 0xA9, 0x0A, 0x42, 0xB7, 0x0E, 0xB7, 0x07, 0x8F, 0x5E, 0xD8, 0x80, 0xCD, 0x60,
+    0xFF, 0xF0, 0xB7, 0x3D, 0x83, 0xE1, 0xEA, 0xC5, 0x58, 0xDB, 0x4E, 0xDE, 0x77, 0xDA, 0x85, 0xCB,
+    0x4B, 0x66, 0x69, 0x93, 0x7A, 0xF6, 0x1F, 0x24, 0xF5, 0xBF, 0x31, 0xA9, 0xFF, 0x88, 0x49, 0xFD,
+    0x49, 0x4F, 0x05, 0xCE, 0xCA, 0x45, 0x48, 0x81, 0x19, 0xCD, 0xD1, 0x50, 0xAE, 0x4F, 0xDF, 0x10,
+    0x36, 0x0D, 0xBD, 0x7D, 0xC4, 0x42, 0x42, 0xE1, 0x37, 0x9F, 0x3F, 0xDC, 0x88, 0x77, 0xB6, 0x02,
+    0xB9, 0x46, 0x0D, 0xE8, 0x57, 0xFE, 0xE3, 0x97, 0x4A, 0xF6, 0x39, 0xBC, 0x9F, 0x41, 0xAB, 0x79,
+    0x80, 0x4C, 0x81, 0xFB, 0xC7, 0x6C, 0xDB, 0xD7, 0x8E, 0x60, 0x6C, 0x0B, 0x66, 0x83, 0x6B, 0x6C,
+    0x27, 0x32, 0xDE, 0xC3, 0x5A, 0xF0, 0x6D, 0x91, 0xE7, 0xDC, 0x63, 0xB6, 0xEB, 0x7D, 0x97, 0xF5,
+    0xDD, 0x37, 0x3F, 0xBD, 0xB9, 0x1B, 0x27, 0x63, 0x90, 0x20, 0xA3, 0x8C, 0x71, 0xC2, 0xF7, 0xF3,
+    0x10, 0x03, 0x7E, 0x27, 0x58, 0xE1, 0xB7, 0xC0, 0x26, 0xC3, 0x61, 0x41, 0x46, 0x64, 0x67, 0xC2,
+    0x39, 0xE9, 0x08, 0x47, 0x4D, 0xE5, 0x29, 0xF7, 0x59, 0x48, 0x6C, 0xE1, 0x68, 0xA9, 0x1C, 0x39,
+    0xF8, 0x68, 0xE2, 0x97, 0x87, 0xBA, 0x19, 0x68, 0xDD, 0x3C, 0x1C, 0x18, 0x75, 0xBA, 0xF3, 0x54,
+    0x4D, 0x7B, 0x1D, 0xCD, 0x00, 0x1C, 0x79, 0xDB, 0x08, 0x36, 0xCC, 0x79, 0xA9, 0x23, 0xEC, 0xE1,
+    0x2B, 0xED, 0x40, 0xD8, 0x5F, 0xAD, 0xDC, 0x44, 0x19, 0x6C, 0x5B, 0x54, 0x5E, 0x09, 0xF4, 0xD1,
+    0x56, 0xA7, 0x78, 0xD1, 0x5D, 0x8C, 0xF6, 0x2E, 0xDC, 0xAE, 0x56, 0x86, 0xF9, 0x6C, 0xA3, 0xC7,
+    0xDC, 0x68, 0x26, 0x3C, 0x68, 0xDE, 0x68, 0x83, 0xD0, 0x34, 0x1C, 0xA6, 0x4D, 0xEA, 0x86, 0xAA,
+    0xF8, 0xAB, 0x96, 0xF6, 0x98, 0x96, 0x2D, 0xB9, 0x7E, 0x98, 0x73, 0x0A, 0x13, 0x47, 0x1C, 0x0C,
+    0x90, 0x77, 0x3F, 0xE0, 0x5C, 0xFC, 0x39, 0xF9, 0x0D, 0x47, 0x1D, 0x0F, 0xE4, 0x5D, 0x3E, 0xA5,
+    0x68, 0xA4, 0xA8, 0x94, 0x1D, 0x17, 0x74, 0x6A, 0x65, 0x1B, 0x43, 0xD7, 0x7F, 0x30, 0x88, 0x72,
+    0x96, 0x04, 0x66, 0xBA, 0x69, 0x05, 0xE9, 0xFC, 0x7F, 0x32, 0x2F, 0xFF, 0x6B, 0xE5, 0x1E, 0x66,
+    0x59, 0x92, 0xD8, 0xEB, 0xD0, 0x87, 0x5D, 0x2C, 0xA7, 0xE4, 0xF1, 0x6B, 0x9C, 0x8D, 0x73, 0xCE,
+    0xDD, 0xA9, 0xBB, 0x98, 0x41, 0x2A, 0x8A, 0x9D, 0xBB, 0x71, 0x9D, 0x7B, 0x44, 0x9A, 0x58, 0xD3,
+    0x73, 0x65, 0x0F, 0x58, 0x32, 0xFD, 0xAA, 0xB3, 0x38, 0xA2, 0xD0, 0x51, 0x0E, 0x61, 0xE6, 0x33,
+    0x23, 0xD9, 0x87, 0x63, 0x58, 0x53, 0x2D, 0xA6, 0xFA, 0xA0, 0xE6, 0x63, 0x16, 0x56, 0xEF, 0x13,
+    0xE5, 0xF0, 0x9F, 0x69, 0x8D, 0xB1, 0xE3, 0x33, 0xA5, 0x6A, 0xAE, 0xC9, 0xD5, 0x9C, 0x62, 0x1F,
+    0x50, 0x58, 0x7E, 0x1B, 0xAC, 0xC6, 0xD1, 0xE5, 0x33, 0x2A, 0xBA, 0x59, 0x6F, 0xFB, 0x01, 0x40,
+    0x6F, 0xAD, 0x7F, 0xD7, 0x5E, 0x74, 0xD8, 0xB7, 0xBD, 0xBA, 0xA5, 0x73, 0xEE, 0xD2, 0xF0, 0x40,
+    0x24, 0x93, 0xF1, 0xC9, 0xC2, 0x70, 0x89, 0x03, 0x07, 0x6D, 0x31, 0x45, 0xDE, 0x1E, 0x18, 0xB9,
+    0x3F, 0x12, 0x1F, 0x8D, 0x91, 0x9F, 0xED, 0x95, 0xC2, 0xAF, 0x36, 0xD5, 0x1D, 0x1C, 0x1D, 0xDD,
+    0x8C, 0x11, 0x51, 0x10, 0xAB, 0xBD, 0x76, 0x74, 0x74, 0x88, 0xFF, 0xE7, 0x8B, 0xD7, 0xF8, 0xE2,
+    0x75, 0xFD, 0xBC, 0x66, 0xAF, 0x1F, 0xF2, 0x01, 0x45, 0xB0, 0xE2, 0x33, 0x03, 0x00, 0x0C, 0x71,
+    0x07, 0x80, 0xFF, 0x3A, 0x48, 0xBC, 0x3A, 0x82, 0x0F, 0x38, 0x30, 0x5A, 0x68, 0x7F, 0x64, 0x5E,
+    0x40, 0x88, 0x42, 0xAB, 0x0D, 0x24, 0xBD, 0x89, 0x22, 0x3B, 0x69, 0xE2, 0x1C, 0xDE, 0x49, 0x82,
+    0x55, 0xA6, 0x8D, 0x4E, 0x94, 0xB7, 0xC4, 0xA2, 0xDC, 0x00, 0x73, 0x9D, 0x4F, 0x4B, 0x39, 0x3C,
+    0xD8, 0x16, 0xFE, 0x00, 0x94, 0xC4, 0x94, 0x71, 0x15, 0xD6, 0x99, 0xAE, 0x26, 0x89, 0x41, 0xAC,
+    0xAE, 0x80, 0x31, 0x2A, 0xFD, 0x01, 0x65, 0x3C, 0x52, 0x0F, 0xB6, 0x53, 0xE6, 0x00, 0x10, 0xC7,
+    0x88, 0x2E, 0x65, 0x20, 0xE4, 0xD6, 0x8A, 0x6A, 0x43, 0x3B, 0xF6, 0x1D, 0x46, 0xBE, 0x62, 0x39,
+    0x0C, 0xA9, 0x64, 0xCF, 0x19, 0xB8, 0xB6, 0x45, 0xFC, 0x3C, 0x28, 0x8E, 0x6E, 0x3D, 0x3E, 0xD4,
+    0x84, 0x6B, 0x7D, 0x3F, 0x77, 0x9F, 0x76, 0x0C, 0x3C, 0x0C, 0x82, 0x09, 0x0F, 0xCD, 0x93, 0xAC,
+    0x70, 0xA5, 0xF5, 0xD8, 0xF0, 0xA9, 0x09, 0xD3, 0x8E, 0x84, 0x87, 0x71, 0xB0, 0x1D, 0x5C, 0x3B,
+    0x31, 0x66, 0xEE, 0x53, 0xC9, 0x65, 0x94, 0x9F, 0x11, 0xCB, 0x7D, 0x1A, 0x4B, 0xEE, 0x99, 0x53,
+    0x1A, 0x4B, 0x38, 0x46, 0x31, 0x6A, 0xE5, 0xA3, 0x93, 0x3B, 0x95, 0x52, 0x52, 0x7D, 0xCE, 0x04,
+    0x56, 0xEA, 0xAF, 0x9D, 0xC1, 0x94, 0x42, 0xC3, 0x1A, 0x57, 0xD5, 0x16, 0x4B, 0xB5, 0xC4, 0x46,
+    0x0F, 0x9C, 0x0F, 0x9D, 0xA0, 0x52, 0x5D, 0xCB, 0x11, 0x41, 0xA5, 0x61, 0x76, 0x70, 0x69, 0x6C,
+    0x0F, 0x32, 0xCD, 0x43, 0x16, 0xAA, 0xE9, 0x7C, 0x3B, 0xF0, 0xDE, 0x8E, 0xBD, 0x73, 0xEA, 0x1B,
+    0x25, 0xC3, 0xC0, 0xBB, 0x76, 0x7D, 0xAE, 0x1D, 0x7B, 0xA7, 0xAA, 0xE5, 0x62, 0xE7, 0xA8, 0x6E,
+    0x3B, 0x67, 0x67, 0x38, 0xED, 0x4F, 0xFD, 0x47, 0x7E, 0x6D, 0x15, 0x56, 0x86, 0x6D, 0x29, 0xF6,
+    0x96, 0x63, 0x1F, 0x1C, 0x5E, 0x53, 0x5D, 0x52, 0xD5, 0x65, 0xA1, 0xBA, 0x8C, 0x5B, 0xBB, 0x03,
+    0xEC, 0xD6, 0x14, 0x0C, 0xBA, 0xF8, 0xBB, 0xBA, 0xAC, 0x2E, 0xD3, 0x25, 0xDA, 0xD5, 0x45, 0x2E,
+    0xD3, 0xA5, 0xDB, 0xD1, 0xA5, 0xFD, 0x5F, 0x74, 0xB1, 0x38, 0xB5, 0x40, 0x3D, 0x74, 0x48, 0xFD,
+    0x5D, 0xED, 0xA0, 0xEA, 0xD7, 0x0E, 0xAB, 0x14, 0x7B, 0x00, 0xEB, 0x08, 0x8B, 0x01, 0xAE, 0x0E,
+    0xAF, 0x61, 0xE9, 0x00, 0x0B, 0x91, 0x2C, 0x62, 0xE9, 0xD2, 0x85, 0xD3, 0xC5, 0x62, 0xD6, 0x0C,
+    0xA0, 0x35, 0x03, 0x6A, 0xD3, 0x01, 0xB6, 0x8B, 0x01, 0xB7, 0xDD, 0x00, 0xDC, 0x6E, 0x40, 0x6E,
+    0xEB, 0xA0, 0x4B, 0x1D, 0x1D, 0xEF, 0x73, 0xE0, 0x75, 0x02, 0xCE, 0x86, 0x7F, 0xA4, 0x6A, 0x5A,
+    0xC5, 0xEF, 0xB4, 0x72, 0x92, 0x32, 0x24, 0x06, 0x04, 0x8F, 0x10, 0x1E, 0x31, 0x3C, 0x82, 0x78,
+    0x40, 0xF1, 0x08, 0xE3, 0x11, 0xC7, 0xBB, 0x40, 0xB6, 0x16, 0x3B, 0x74, 0x16, 0xFB, 0x43, 0xF3,
+    0x44, 0x8B, 0x4D, 0x07, 0x8B, 0x6D, 0xE5, 0xA8, 0x9C, 0xC5, 0xE8, 0xEB, 0x27, 0x58, 0x2C, 0xFE,
+    0xB2, 0x2D, 0xD6, 0xFC, 0x9F, 0x2D, 0xF6, 0x6F, 0x85, 0x55, 0x3D, 0x73, 0xE4, 0x44, 0x10, 0x6D,
+    0x49, 0xD8, 0xAA, 0x42, 0x81, 0x08, 0x30, 0xC1, 0xB9, 0x8A, 0x49, 0x48, 0x20, 0x60, 0xFE, 0xC0,
+    0x6A, 0x25, 0x8A, 0x80, 0xF4, 0x02, 0xB6, 0x28, 0x8A, 0x80, 0x1C, 0x82, 0x4D, 0x2E, 0x5C, 0xEF,
+    0xCE, 0x5D, 0x4A, 0xE2, 0x9F, 0x40, 0xCA, 0x11, 0x1C, 0x01, 0x81, 0x83, 0xF5, 0x4A, 0xD4, 0x05,
+    0xA4, 0x0A, 0x20, 0x17, 0x5F, 0xC1, 0x1D, 0x01, 0x0A, 0x04, 0x25, 0x1F, 0x5A, 0x0D, 0xEF, 0x8D,
+    0xA4, 0xC5, 0x67, 0x97, 0x41, 0xF6, 0xF4, 0xAA, 0x66, 0xA6, 0x5F, 0x7F, 0xBC, 0xEE, 0x56, 0xFC,
+    0xB0, 0x51, 0x8F, 0x1A, 0xFD, 0x7E, 0xAD, 0x83, 0x3A, 0x0D, 0xCA, 0x24, 0x28, 0x66, 0x21, 0xFE,
+    0xCD, 0x83, 0x30, 0x13, 0x49, 0xE4, 0x5B, 0x11, 0x59, 0x49, 0x0D, 0xB9, 0xF5, 0x28, 0x1B, 0xBF,
+    0x82, 0xAC, 0x83, 0x52, 0xC4, 0xAB, 0xC3, 0x42, 0x24, 0xA8, 0xA2, 0x42, 0x5E, 0xFD, 0xFA, 0xC5,
+    0x93, 0xE7, 0x26, 0xB6, 0x78, 0xCC, 0xD1, 0xA7, 0x3F, 0x6E, 0x16, 0x99, 0xC4, 0xD9, 0x1C, 0x17,
+    0x63, 0x40, 0x88, 0x28, 0x40, 0x88, 0xCC, 0xE5, 0x42, 0x08, 0xD9, 0x8A, 0xF0, 0x62, 0x37, 0x4A,
+    0x69, 0x82, 0xDB, 0x90, 0x06, 0xB2, 0x8C, 0xE1, 0x41, 0x58, 0x28, 0x1C, 0x46, 0x46, 0x0B, 0x1F,
+    0x8F, 0x82, 0xDB, 0x00, 0xC6, 0xB3, 0xC4, 0x5B, 0x64, 0x7B, 0x91, 0x8D, 0xB5, 0x22, 0xFB, 0xE4,
+    0x4D, 0xF1, 0x9B, 0x19, 0x34, 0xEB, 0x15, 0x41, 0x2E, 0xF8, 0x06, 0xFF, 0xFD, 0x96, 0x8E, 0x5B,
+    0x8A, 0x74, 0x0F, 0x11, 0x5A, 0xA2, 0x5B, 0x18, 0x0D, 0x9E, 0x62, 0x33, 0xF8, 0xAE, 0xC1, 0xDE,
+    0x43, 0x88, 0xE8, 0x51, 0x23, 0x59, 0xFC, 0x41, 0x2D, 0x57, 0xF1, 0xB2, 0xA4, 0x77, 0x99, 0x2C,
+    0x2D, 0xBC, 0x95, 0x35, 0x8D, 0xCD, 0x0E, 0x62, 0x25, 0x87, 0x67, 0x53, 0x8A, 0x5F, 0xF9, 0xC0,
+    0x8E, 0x8A, 0xB0, 0x6A, 0x45, 0x65, 0xB1, 0xD9, 0x22, 0x50, 0x25, 0x5B, 0xFC, 0xBD, 0xEB, 0x72,
+    0x96, 0xC8, 0x05, 0x42, 0x43, 0xD8, 0xB1, 0x81, 0x66, 0x83, 0x40, 0x56, 0x5E, 0xBD, 0xBA, 0x97,
+    0xAD, 0x82, 0xAA, 0xB1, 0x75, 0x12, 0x3E, 0xFD, 0xE5, 0x45, 0x9B, 0x2E, 0xBF, 0xF8, 0xBE, 0xDC,
+    0xAA, 0x5E, 0xC5, 0x66, 0x75, 0xFC, 0x6B, 0xE2, 0xF2, 0xD5, 0x6A, 0x48, 0xBF, 0x9E, 0x03, 0x28,
+    0x2C, 0x00, 0x82, 0xB8, 0x13, 0x69, 0x00, 0x9E, 0x00, 0x74, 0x2B, 0x49, 0x50, 0xE1, 0x37, 0x8D,
+    0x0A, 0x80, 0x2B, 0x0B, 0xBB, 0x12, 0xED, 0x9D, 0x4B, 0xF7, 0x0F, 0xCE, 0xE5, 0x8D, 0x8B, 0x96,
+    0xDB, 0xEA, 0xA7, 0x9C, 0xE1, 0x67, 0x1A, 0x19, 0x4B, 0xE1, 0x26, 0xD9, 0x18, 0x64, 0xCA, 0x7D,
+    0xD9, 0x41, 0xEA, 0x90, 0xB1, 0x2A, 0x5B, 0x32, 0xBD, 0x3D, 0x01, 0x34, 0x01, 0x7C, 0x70, 0x74,
+    0x24, 0x51, 0xB3, 0xC3, 0x35, 0x6D, 0x52, 0x24, 0x63, 0x23, 0xAA, 0xE8, 0xE4, 0x52, 0xA2, 0x9F,
+    0x1B, 0xE9, 0x24, 0xF8, 0xBB, 0x82, 0x14, 0x5B, 0x38, 0x29, 0x80, 0x0A, 0x90, 0xE0, 0xF4, 0x7C,
+    0xF9, 0x47, 0x29, 0xDA, 0x5A, 0xA4, 0x33, 0xB4, 0xAD, 0x8F, 0xB3, 0x13, 0x47, 0x9E, 0x51, 0x46,
+    0x67, 0x1A, 0x58, 0x09, 0x92, 0x39, 0x93, 0x07, 0xD8, 0x23, 0x9F, 0x38, 0x67, 0x61, 0x20, 0xA4,
+    0xB7, 0x18, 0xD6, 0x7B, 0x95, 0x6C, 0xFE, 0x2A, 0xE4, 0xD8, 0xFE, 0xDE, 0x4B, 0x0C, 0x86, 0x75,
+    0xF5, 0xB1, 0x74, 0x35, 0xF8, 0x6C, 0x24, 0x2E, 0xB7, 0x40, 0x39, 0x13, 0xDF, 0xB9, 0xFE, 0x36,
+    0x0B, 0xE5, 0xCE, 0x95, 0x83, 0x44, 0xAE, 0xC5, 0x47, 0xBF, 0x2D, 0xEE, 0xBC, 0xE7, 0xD1, 0xBE,
+    0xCB, 0x86, 0x43, 0x44, 0x60, 0xA3, 0x3F, 0x3E, 0xC3, 0x0F, 0x58, 0x37, 0x71, 0xC1, 0x1B, 0x66,
+    0xBA, 0xB1, 0xBE, 0x7D, 0x23, 0x2A, 0xA7, 0x6B, 0x2F, 0xDF, 0xF0, 0xDA, 0xDB, 0x37, 0x48, 0x02,
+    0x92, 0x78, 0xED, 0x89, 0x1C, 0x5D, 0x7C, 0x61, 0xDE, 0x73, 0x94, 0xA6, 0x23, 0x33, 0x2F, 0xC7,
+    0x97, 0x0D, 0x75, 0x73, 0xA7, 0x36, 0x50, 0x42, 0x57, 0x34, 0x4F, 0x3C, 0xD6, 0xB1, 0x9C, 0xF6,
+    0x13, 0x80, 0x84, 0xD7, 0x8A, 0x13, 0x91, 0x73, 0xC9, 0x8D, 0xE7, 0xB3, 0xC7, 0x8F, 0xBF, 0x1A,
+    0xCF, 0x9C, 0x9E, 0x7C, 0x49, 0xB1, 0x73, 0x2A, 0x44, 0x0B, 0xFB, 0xC3, 0xEB, 0xF1, 0x50, 0x07,
+    0x7C, 0xF5, 0x0F, 0x36, 0x4E, 0xF7, 0xB4, 0x0B, 0x97, 0x74, 0x3B, 0x76, 0x93, 0xF3, 0x6A, 0x97,
+    0x4D, 0x50, 0x07, 0x43, 0xCF, 0x28, 0x4F, 0xAD, 0xF3, 0xD1, 0x3E, 0xFB, 0x1C, 0x7A, 0xAC, 0xB1,
+    0x4D, 0x86, 0x42, 0x72, 0xB9, 0xA0, 0xCD, 0xB0, 0x44, 0x8E, 0x3C, 0xE4, 0x08, 0x05, 0x6D, 0xF7,
+    0x5E, 0x1D, 0x15, 0x11, 0x5C, 0x6E, 0x62, 0xA3, 0x0D, 0xEA, 0x5D, 0x81, 0x0E, 0xD7, 0x35, 0x2D,
+    0x6A, 0xBE, 0x99, 0xA3, 0x36, 0x5A, 0xA9, 0x13, 0x24, 0xB4, 0xF1, 0x6A, 0xD7, 0x02, 0x3E, 0x7F,
+    0xA0, 0x8C, 0xC9, 0x55, 0x85, 0x50, 0xC6, 0x99, 0xAA, 0x55, 0x36, 0xF7, 0xFA, 0xAE, 0xEF, 0x41,
+    0x46, 0x5E, 0xC3, 0x39, 0x95, 0x1D, 0xC9, 0x51, 0x36, 0x64, 0x1F, 0x16, 0x2B, 0xF7, 0xC3, 0x9A,
+    0x7C, 0x85, 0x21, 0xFD, 0xF0, 0x46, 0xE7, 0x0A, 0xDF, 0x3A, 0xC2, 0xF2, 0x3E, 0xFB, 0x37, 0x82,
+    0x8E, 0x15, 0x4B, 0xA9, 0x0C, 0x99, 0xD4, 0x19, 0x19, 0xD7, 0x8E, 0xD0, 0x74, 0x94, 0x44, 0x5B,
+    0x3B, 0x79, 0xE9, 0x38, 0xEE, 0x9C, 0x99, 0x41, 0xB6, 0x2C, 0x1A, 0x28, 0x82, 0x71, 0x28, 0x6A,
+    0x57, 0x09, 0xE9, 0x24, 0xA1, 0xB2, 0x76, 0x65, 0xB1, 0x76, 0xB9, 0x80, 0x54, 0x05, 0xF7, 0xD3,
+    0x4C, 0x52, 0xC3, 0x4E, 0x52, 0x7F, 0x7E, 0xD2, 0x71, 0xC0, 0x71, 0x74, 0x79, 0x9C, 0x46, 0x53,
+    0xAD, 0x06, 0x68, 0xB6, 0x10, 0x2B, 0x7A, 0x6E, 0x9C, 0x99, 0xD8, 0x0C, 0x8B, 0x35, 0xAC, 0xC7,
+    0x12, 0xE4, 0xF4, 0x3D, 0xE3, 0xD8, 0x1E, 0xD7, 0xD4, 0x60, 0xF0, 0xDF, 0xAF, 0x87, 0x92, 0x74,
+    0xAB, 0x22, 0x03, 0xB0, 0x52, 0xC8, 0x01, 0x4A, 0x5D, 0x87, 0xEA, 0x87, 0xA9, 0x79, 0xF2, 0x21,
+    0xE1, 0x12, 0x37, 0x30, 0x30, 0x07, 0x30, 0xE1, 0x30, 0xEB, 0x30, 0x75, 0xE2, 0x02, 0x7C, 0x15,
+    0x61, 0x11, 0x96, 0x60, 0x01, 0x3C, 0xF8, 0xF8, 0x83, 0x8D, 0x06, 0xB6, 0xDA, 0xC1, 0x47, 0xAC,
+    0xE3, 0x27, 0x37, 0x51, 0x6F, 0x38, 0xD8, 0xDD, 0xE1, 0x60, 0x35, 0x90, 0x75, 0xCB, 0xC1, 0x11,
+    0x66, 0x82, 0x5A, 0x0F, 0x3E, 0x6E, 0xBA, 0xC1, 0x4F, 0x09, 0xC8, 0x73, 0xE8, 0x1A, 0x97, 0x85,
+    0xA9, 0x68, 0x62, 0xCE, 0x0F, 0xD1, 0x8C, 0x1A, 0x17, 0xFC, 0x80, 0x34, 0xC0, 0xF3, 0xF9, 0xCD,
+    0x09, 0x4A, 0x9F, 0xD3, 0x1B, 0x1E, 0x63, 0x7B, 0x4B, 0x48, 0x06, 0x29, 0x1C, 0xBE, 0xC3, 0x97,
+    0x46, 0x38, 0xC5, 0xDA, 0xD4, 0xDA, 0xE6, 0x64, 0xB1, 0xB8, 0xFF, 0x0E, 0xE8, 0x89, 0x11, 0x2D,
+    0x94, 0xBE, 0x11, 0xB9, 0x07, 0x43, 0x79, 0x01, 0x72, 0x8C, 0xF3, 0xF7, 0xBF, 0x7C, 0xA5, 0x9F,
+    0xF0, 0x31, 0x65, 0xFD, 0x9B, 0xA1, 0xA3, 0xA9, 0xC2, 0x70, 0xA7, 0xE5, 0xDF, 0xE0, 0x64, 0x82,
+    0x8A, 0x70, 0x16, 0x80, 0x07, 0x6F, 0xE8, 0x56, 0x79, 0x7D, 0xF5, 0x7F, 0x0F, 0x74, 0xCE, 0x61,
+    0xBE, 0x1D, 0xC7, 0xC7, 0x99, 0xFB, 0xEE, 0xBE, 0x9C, 0xEE, 0x31, 0xD5, 0xFC, 0xA8, 0x7B, 0xA3,
+    0x1F, 0xC2, 0xCA, 0xD7, 0xA5, 0x0B, 0x29, 0xB8, 0x1A, 0x26, 0xD6, 0x5D, 0x65, 0x75, 0x39, 0xC0,
+    0xB0, 0x9D, 0x53, 0xB6, 0x01, 0xAE, 0xBD, 0xC6, 0xF9, 0x75, 0x85, 0x56, 0xDE, 0xD8, 0x2A, 0x92,
+    0xDD, 0x12, 0x5D, 0x7C, 0xEE, 0xE5, 0xB4, 0x85, 0xD6, 0xFB, 0x07, 0xD5, 0x5A, 0x3F, 0x6C, 0xDC,
+    0xD6, 0x19, 0xFF, 0x48, 0x5A, 0x66, 0x10, 0x16, 0x65, 0x06, 0x7B, 0x71, 0x1A, 0xB3, 0x43, 0x5A,
+    0xA4, 0x46, 0x6D, 0xAE, 0x29, 0x20, 0x89, 0x74, 0x32, 0x76, 0xB0, 0x07, 0xAB, 0x1E, 0x32, 0xB8,
+    0x6B, 0x52, 0x14, 0x5A, 0x3A, 0x78, 0x90, 0xEE, 0xE8, 0x74, 0xE8, 0x58, 0x2F, 0x99, 0xE3, 0xC1,
+    0x05, 0x8C, 0xCB, 0xA0, 0xC5, 0x83, 0x86, 0x3B, 0x1D, 0xDD, 0x0C, 0x19, 0x3A, 0x98, 0x40, 0x1A,
+    0x74, 0x0C, 0x51, 0x3B, 0x1D, 0xD2, 0xC1, 0x2C, 0x7A, 0x41, 0x18, 0x9B, 0x77, 0xAF, 0xBF, 0xDF,
+    0xF7, 0x78, 0xD4, 0x9D, 0xE4, 0x36, 0x46, 0x1A, 0x39, 0xCA, 0xE1, 0xEE, 0xA3, 0xC4, 0x3F, 0xEF,
+    0xFB, 0xBD, 0xEF, 0x7D, 0xFF, 0x1F, 0x45, 0x44, 0xA2, 0x5C, 0x12, 0xFB, 0x4D, 0xE5, 0x84, 0xB4,
+    0x9F, 0x55, 0x91, 0x2D, 0x91, 0x5D, 0x91, 0x09, 0xBF, 0x4E, 0x25, 0x6E, 0x25, 0x1E, 0xBE, 0xA5,
+    0xF8, 0x85, 0x04, 0x85, 0x84, 0x39, 0xBF, 0x78, 0x34, 0xCE, 0xF8, 0x1C, 0xBE, 0xDD, 0x67, 0xCD,
+    0x3E, 0x2E, 0xDB, 0x22, 0x81, 0xA9, 0xA4, 0x6F, 0x2A, 0x67, 0x26, 0xBF, 0xF6, 0x30, 0x50, 0x58,
+    0x2A, 0x37, 0x89, 0x71, 0x77, 0x22, 0xF6, 0xD7, 0x3B, 0xF0, 0xD3, 0xF3, 0x19, 0xEE, 0xFB, 0x62,
+    0x53, 0x7C, 0x63, 0x44, 0xC6, 0xB5, 0x1D, 0x0E, 0x70, 0x88, 0x47, 0x5E, 0xDA, 0xE7, 0xE4, 0x18,
+    0x0C, 0x2A, 0x21, 0xEF, 0x92, 0xE4, 0xB3, 0x3D, 0xD0, 0x3D, 0x9D, 0x41, 0xA3, 0x17, 0x6B, 0xA5,
+    0xBC, 0x83, 0xE0, 0xF1, 0xF1, 0x16, 0xA8, 0x5F, 0xF2, 0xF4, 0xCE, 0xE3, 0x3B, 0x38, 0x61, 0x0C,
+    0x1E, 0x70, 0xAE, 0x7D, 0x72, 0x85, 0x83, 0x65, 0xBC, 0x1A, 0xE9, 0x74, 0x62, 0xA5, 0x89, 0xB2,
+    0x5A, 0x57, 0xAA, 0x03, 0xBB, 0x3A, 0x64, 0xFC, 0x78, 0x30, 0xC0, 0xBC, 0x8D, 0x31, 0x19, 0xA6,
+    0x68, 0x4C, 0x2A, 0x2F, 0x88, 0xFC, 0x78, 0x3D, 0x7A, 0x58, 0xC7, 0xC6, 0x54, 0xC1, 0x57, 0x9B,
+    0x79, 0x90, 0xFB, 0x45, 0x98, 0xBA, 0x65, 0x04, 0xF1, 0x45, 0x22, 0x55, 0x88, 0x63, 0x98, 0x79,
+    0xA5, 0x5F, 0x86, 0x39, 0x30, 0x97, 0x49, 0xFF, 0x71, 0xFD, 0x73, 0x27, 0xBD, 0x2B, 0x96, 0xAD,
+    0x5B, 0x41, 0xA0, 0x41, 0x19, 0x50, 0xB0, 0x90, 0x71, 0x92, 0x42, 0xD6, 0x3D, 0xA2, 0x6D, 0x70,
+    0x09, 0x07, 0x67, 0x42, 0xCC, 0x35, 0x6E, 0x92, 0x21, 0x31, 0x6D, 0x6D, 0x53, 0xD6, 0x40, 0xB4,
+    0xD2, 0xFF, 0x22, 0x15, 0x30, 0x2D, 0x88, 0xA6, 0x68, 0xC1, 0xC7, 0xF8, 0xBD, 0x33, 0x06, 0xC2,
+    0x31, 0xA1, 0x0D, 0xCC, 0xC0, 0x2E, 0x08, 0x9E, 0xED, 0xE6, 0x41, 0xF9, 0x9C, 0xDA, 0x5A, 0xF8,
+    0x9C, 0x6A, 0xC5, 0xFA, 0xDA, 0xE2, 0x49, 0xFC, 0x7F, 0xFA, 0x32, 0x85, 0x34, 0xC3, 0xC8, 0x94,
+    0x74, 0x92, 0xAE, 0xB4, 0xE2, 0xE8, 0xA9, 0x78, 0xC8, 0x2D, 0xA2, 0x34, 0xC3, 0x19, 0xFF, 0x25,
+    0x82, 0x3A, 0xA0, 0xB2, 0xB8, 0xB5, 0x78, 0x05, 0x58, 0x81, 0xE0, 0xAF, 0x0A, 0x2B, 0xE1, 0x36,
+    0x14, 0xBE, 0x79, 0x9F, 0x2A, 0xC0, 0x9B, 0x5D, 0x23, 0xED, 0x6A, 0x53, 0x99, 0x5A, 0x12, 0x65,
+    0xF2, 0x0B, 0x19, 0x73, 0xA4, 0xA9, 0xC8, 0xCB, 0xA6, 0x6C, 0x41, 0x9D, 0x90, 0x74, 0xDB, 0x2F,
+    0x46, 0x41, 0x71, 0xDD, 0xCF, 0x3A, 0x05, 0xD8, 0x34, 0x37, 0x41, 0x83, 0xD9, 0xCE, 0xD4, 0x8E,
+    0xB3, 0x99, 0xE9, 0xB4, 0x20, 0x28, 0x08, 0xEF, 0x0A, 0xFE, 0x0C, 0xB2, 0xC0, 0xE4, 0x6B, 0x12,
+    0x62, 0x89, 0xF2, 0x48, 0xCE, 0xCB, 0x54, 0xD2, 0x30, 0x5D, 0xE5, 0x0A, 0xFA, 0xD9, 0x2A, 0xC1,
+    0x78, 0xF9, 0x75, 0xDC, 0xAA, 0x87, 0xE2, 0xF0, 0x61, 0xD5, 0x5E, 0x5B, 0xA5, 0xFE, 0xF8, 0xD9,
+    0x79, 0x8E, 0x1D, 0xA4, 0xA1, 0x8C, 0x3F, 0xC8, 0x43, 0x0C, 0x1D, 0x71, 0x68, 0xAF, 0x70, 0xFE,
+    0x04, 0xA1, 0x52, 0xDB, 0x38, 0x5E, 0x1F, 0x4B, 0x81, 0x59, 0x04, 0x8F, 0xDF, 0xE2, 0x04, 0x21,
+    0x7D, 0xC5, 0xEF, 0x5C, 0x6E, 0x01, 0xCF, 0x5E, 0xF3, 0x9F, 0xEC, 0x86, 0x17, 0x27, 0x67, 0xA5,
+    0x5A, 0xE5, 0xB7, 0x7C, 0xDD, 0x2D, 0xC0, 0x6B, 0x35, 0xC8, 0x93, 0x71, 0x1E, 0x3E, 0xC8, 0xEC,
+    0x4C, 0x21, 0x04, 0x18, 0x5D, 0x0F, 0x32, 0xAB, 0x83, 0x3C, 0x28, 0xE3, 0x34, 0xCE, 0xF7, 0xA4,
+    0xEF, 0x34, 0x3C, 0x25, 0x09, 0xD0, 0x47, 0x59, 0x03, 0x61, 0x0D, 0x61, 0x8B, 0xEB, 0xE0, 0x0A,
+    0xE5, 0x2A, 0x43, 0xB1, 0xEC, 0x8C, 0xE1, 0x6F, 0x63, 0x63, 0x63, 0x53, 0x47, 0x39, 0xFC, 0x3B,
+    0xB3, 0xB2, 0x91, 0xC6, 0x26, 0x4F, 0x4C, 0x7E, 0x7A, 0x23, 0x7D, 0x36, 0x41, 0x8A, 0x0A, 0x72,
+    0x3C, 0x13, 0x0A, 0x72, 0x6C, 0x05, 0x39, 0x84, 0x16, 0xA7, 0xAB, 0x32, 0xF4, 0x2A, 0x08, 0x92,
+    0x07, 0xC8, 0x0C, 0x87, 0x92, 0x87, 0xD1, 0x66, 0xCE, 0xC3, 0xD8, 0x50, 0x90, 0xB2, 0xB7, 0x47,
+    0x09, 0xCA, 0x30, 0xB6, 0x07, 0x28, 0x77, 0xC6, 0xC7, 0x0B, 0x0A, 0x12, 0xCF, 0x51, 0x90, 0x43,
+    0xA7, 0xA6, 0x20, 0xAF, 0xC8, 0x95, 0x67, 0x12, 0xE4, 0xB9, 0xC1, 0xE0, 0x16, 0x4C, 0xAE, 0x7A,
+    0x67, 0x30, 0xB8, 0xA9, 0x5A, 0x94, 0x85, 0xA6, 0x8A, 0x65, 0xB8, 0x26, 0xAB, 0xAB, 0xB2, 0x86,
+    0x2F, 0xFE, 0xC0, 0xBF, 0x38, 0x89, 0x4B, 0x6A, 0xF2, 0xC5, 0xD7, 0x11, 0x0A, 0xCD, 0x92, 0xD3,
+    0x57, 0x3F, 0xDB, 0xF8, 0xBA, 0x27, 0xF8, 0x39, 0x0D, 0x19, 0x2F, 0x3C, 0x26, 0x2B, 0x29, 0xBC,
+    0x91, 0xF7, 0xB8, 0x71, 0xD2, 0xAD, 0xB9, 0xF7, 0xAC, 0xE9, 0x77, 0x60, 0xCF, 0x31, 0xFF, 0x84,
+    0x1C, 0x23, 0xFA, 0x8B, 0x6A, 0x6C, 0xD4, 0x01, 0x9D, 0x4E, 0x5D, 0x53, 0x79, 0xFF, 0x68, 0xF4,
+    0x4E, 0xBD, 0xFF, 0x64, 0x25, 0x30, 0xD5, 0x9D, 0x42, 0xBD, 0x15, 0xBF, 0x2F, 0xB9, 0x55, 0x6F,
+    0xA7, 0x48, 0x4C, 0xCA, 0x59, 0xBF, 0x2D, 0x53, 0x6F, 0x12, 0x14, 0x11, 0x84, 0xCE, 0x81, 0xB6,
+    0xE9, 0x9D, 0x86, 0x74, 0x4E, 0xCD, 0x9C, 0x40, 0x72, 0x3D, 0x3A, 0xA7, 0x11, 0x07, 0x68, 0xAC,
+    0xE7, 0x00, 0xA9, 0xB1, 0x8A, 0xB0, 0xBD, 0xB0, 0xC0, 0xA5, 0x30, 0xA7, 0x02, 0x91, 0x8C, 0x33,
+    0xBF, 0x72, 0x4C, 0x1A, 0x34, 0xD1, 0xA7, 0x69, 0x60, 0x4C, 0x2C, 0xE1, 0xA7, 0x35, 0xC8, 0x8D,
+    0x74, 0xEE, 0x3F, 0xD2, 0xB9, 0xEB, 0x4B, 0x3A, 0xF7, 0xB7, 0xEF, 0x3F, 0x64, 0x05, 0x93, 0x77,
+    0xE8, 0xFB, 0x42, 0x92, 0xD8, 0x4C, 0xAF, 0x66, 0xB0, 0x57, 0x3F, 0xEB, 0x93, 0x8C, 0x49, 0xCC,
+    0x53, 0xC8, 0xB8, 0xBB, 0x45, 0x6F, 0x8E, 0x49, 0x42, 0x12, 0x87, 0x44, 0xE4, 0xFC, 0xFF, 0x4B,
+    0xC4, 0x3A, 0xEF, 0x24, 0xEF, 0xE7, 0x49, 0x7A, 0x02, 0x0A, 0x87, 0xF1, 0x39, 0xF9, 0x89, 0x33,
+    0x19, 0x97, 0x86, 0x53, 0xEA, 0xB9, 0xD3, 0x68, 0xB8, 0xB6, 0x85, 0x69, 0xD4, 0x38, 0x5B, 0x39,
+    0x95, 0x5B, 0x7A, 0x85, 0x57, 0xF8, 0xF0, 0xD6, 0xF6, 0x69, 0x08, 0xE6, 0x09, 0x54, 0xBB, 0x3A,
+    0x2B, 0x77, 0x57, 0xDB, 0xAF, 0x9A, 0xAA, 0x57, 0x44, 0x3B, 0x59, 0xA0, 0xBA, 0xE8, 0xA4, 0x2F,
+    0x88, 0x4F, 0xD3, 0x2F, 0x63, 0x88, 0x1A, 0xE2, 0xA2, 0x53, 0x86, 0x46, 0xAB, 0x79, 0x8E, 0xDD,
+    0x89, 0xD3, 0xF8, 0x70, 0xD8, 0x51, 0x1E, 0xE6, 0x7D, 0xAC, 0x7D, 0x23, 0xDB, 0x38, 0xFD, 0xAA,
+    0x9B, 0xCB, 0xC2, 0x07, 0x4E, 0x2E, 0xC8, 0x64, 0x9C, 0xC2, 0x24, 0xFD, 0x47, 0x0C, 0x99, 0xE1,
+    0x35, 0x35, 0xB8, 0x0B, 0xBA, 0xF8, 0xEB, 0x18, 0x5E, 0x4F, 0xA6, 0xD4, 0x8B, 0x75, 0x95, 0x3A,
+    0xE5, 0xBE, 0xAB, 0xD1, 0x6C, 0xE2, 0x21, 0x80, 0x20, 0x9C, 0xE4, 0x71, 0xEE, 0x40, 0xED, 0xFB,
+    0x99, 0x5B, 0x6D, 0x3B, 0x9C, 0x5C, 0xED, 0xDD, 0xA7, 0xED, 0x84, 0x30, 0xF3, 0x20, 0x5F, 0xBB,
+    0x40, 0x49, 0xEC, 0x9E, 0xC7, 0x68, 0x4E, 0x85, 0x90, 0xDC, 0x20, 0xCC, 0xE5, 0x6E, 0x85, 0x90,
+    0xCA, 0xE8, 0x82, 0x48, 0xCA, 0x48, 0x37, 0xD1, 0xD5, 0xAD, 0x44, 0x9E, 0x8E, 0x2D, 0x25, 0xB6,
+    0x75, 0xC5, 0xD6, 0x2C, 0x60, 0x2B, 0x14, 0x5B, 0x46, 0x6C, 0xC9, 0x22, 0xB6, 0x95, 0x94, 0xD8,
+    0xC6, 0x13, 0x60, 0xFB, 0x10, 0x86, 0x00, 0x6C, 0xE9, 0x1A, 0xB0, 0x69, 0x46, 0xA0, 0x41, 0x9C,
+    0xCF, 0x0F, 0x39, 0x37, 0xFC, 0x81, 0xB9, 0x41, 0xE4, 0xEB, 0x1A, 0xA9, 0x86, 0x1C, 0xDF, 0xD1,
+    0xEC, 0x02, 0xF6, 0x85, 0x91, 0xF1, 0x4D, 0x68, 0xD2, 0x4C, 0x1E, 0x5A, 0x54, 0x2B, 0x69, 0x17,
+    0xF1, 0xCF, 0x8A, 0xF7, 0x79, 0x63, 0xD5, 0xD1, 0x8E, 0x8C, 0x83, 0x46, 0xF5, 0x2D, 0x0E, 0x29,
+    0x27, 0x27, 0xAA, 0xC2, 0x30, 0x7D, 0x4A, 0x0E, 0xF6, 0x44, 0x78, 0x5C, 0x6A, 0x51, 0xE1, 0xA9,
+    0x01, 0x4F, 0xC2, 0x2C, 0x11, 0xD8, 0x57, 0x8C, 0x48, 0xB3, 0xBE, 0x53, 0x6C, 0x21, 0x43, 0x81,
+    0x9D, 0x4D, 0xFC, 0x29, 0x3C, 0x0C, 0xC4, 0xCB, 0x7C, 0x03, 0x22, 0xDC, 0xB2, 0x9E, 0xF8, 0x3A,
+    0x39, 0xB8, 0x25, 0x93, 0x8F, 0xDA, 0xCF, 0x27, 0x4C, 0x27, 0x34, 0xE7, 0xF0, 0x73, 0x0D, 0x88,
+    0x98, 0x89, 0x5B, 0xAA, 0x89, 0x70, 0xEC, 0xE1, 0x82, 0x8F, 0xD8, 0x17, 0x28, 0xD3, 0x2B, 0xAC,
+    0x94, 0xB5, 0xA6, 0x13, 0x0B, 0xD7, 0xB6, 0x5A, 0x93, 0x6A, 0xBD, 0x5E, 0x44, 0x5F, 0x94, 0x8A,
+    0x87, 0xE9, 0x85, 0xF8, 0x37, 0x6E, 0x9F, 0xE0, 0x54, 0x47, 0xED, 0x8F, 0x69, 0x4E, 0x3F, 0xEB,
+    0x31, 0xE2, 0x23, 0xBF, 0xC2, 0x73, 0x1B, 0x2A, 0x98, 0xDB, 0x5D, 0x5C, 0x1F, 0x75, 0x56, 0x4B,
+    0xFD, 0x11, 0x2F, 0x5B, 0x02, 0xA3, 0x17, 0xC6, 0xBC, 0x40, 0x95, 0xF1, 0xE8, 0x20, 0xFD, 0x4F,
+    0x41, 0xC2, 0xFB, 0x40, 0x18, 0xFD, 0x11, 0x24, 0xA1, 0x10, 0x7B, 0x24, 0x0D, 0x12, 0x3D, 0x77,
+    0x82, 0xF5, 0x86, 0x97, 0x2F, 0x91, 0xF5, 0x61, 0x7D, 0xD4, 0x83, 0x30, 0xC3, 0x61, 0xD2, 0x53,
+    0xC9, 0x6C, 0xF0, 0x41, 0x85, 0xB8, 0xE4, 0x4E, 0x70, 0xD6, 0x65, 0x82, 0xE2, 0xD0, 0x16, 0x9C,
+    0x9A, 0xC0, 0x1B, 0xB2, 0x6A, 0xF6, 0xE6, 0xB0, 0xCE, 0x29, 0xFB, 0x3D, 0x05, 0xDB, 0xEC, 0x27,
+    0x62, 0x36, 0xE1, 0x3A, 0x2F, 0x07, 0x3F, 0x36, 0xED, 0x52, 0xA0, 0x8A, 0xD4, 0x42, 0xB5, 0x58,
+    0x2D, 0x58, 0x8B, 0xD6, 0xC2, 0xB5, 0x78, 0x15, 0xB0, 0x45, 0x6C, 0x21, 0x5B, 0xCC, 0x16, 0xB4,
+    0x45, 0x6D, 0x61, 0x2B, 0x6E, 0x51, 0xE0, 0xA2, 0xC8, 0x45, 0xA1, 0x8B, 0x62, 0x57, 0xA9, 0xAB,
+    0x57, 0x05, 0xED, 0xE0, 0x9F, 0x24, 0xDF, 0x98, 0x41, 0xA8, 0x5F, 0x31, 0xB9, 0x64, 0x74, 0x2C,
+    0xD6, 0xA8, 0x8C, 0x67, 0x8F, 0x85, 0x7C, 0x2F, 0x0B, 0x4E, 0x79, 0x33, 0x2F, 0x67, 0x42, 0xFC,
+    0x88, 0x09, 0xB4, 0xCF, 0xEC, 0xEA, 0x47, 0x9A, 0x33, 0x1F, 0x6B, 0xC9, 0xC2, 0x51, 0xE3, 0xD6,
+    0xA4, 0x25, 0x6E, 0x71, 0x58, 0x17, 0xBE, 0x3B, 0xA5, 0x55, 0xE6, 0x34, 0xE7, 0xC7, 0x30, 0x7B,
+    0xA7, 0x84, 0x5F, 0x70, 0x0A, 0x3A, 0x87, 0x8A, 0x3E, 0x61, 0x4C, 0x05, 0x7E, 0xF9, 0x78, 0x98,
+    0x97, 0x8B, 0x38, 0x4C, 0x4F, 0x18, 0xB4, 0x47, 0xC6, 0x65, 0x06, 0x8B, 0xE4, 0x92, 0x8D, 0x3B,
+    0xBD, 0xD0, 0x1E, 0x9B, 0x28, 0xB3, 0x35, 0x8C, 0x2D, 0x6E, 0xFC, 0xCA, 0x6A, 0x43, 0x98, 0xDB,
+    0x63, 0x9C, 0x69, 0x52, 0x2F, 0x7D, 0x19, 0x0F, 0x58, 0x32, 0x4C, 0x99, 0xDD, 0xE0, 0xF6, 0x5A,
+    0x0C, 0x0B, 0x00, 0xCD, 0x29, 0xEC, 0xE8, 0x5A, 0x5D, 0x45, 0x96, 0x89, 0x24, 0x83, 0x0F, 0xF4,
+    0x38, 0xB3, 0x46, 0xED, 0x34, 0xF6, 0xE8, 0x4D, 0x6C, 0x9D, 0x15, 0x70, 0x76, 0xB6, 0xD2, 0x0C,
+    0x3F, 0x1F, 0xDC, 0x62, 0xCD, 0x10, 0x72, 0x7A, 0x63, 0xB1, 0xC7, 0xF6, 0x13, 0xA3, 0x76, 0x70,
+    0x59, 0x8C, 0x45, 0x33, 0x0C, 0xD7, 0x2F, 0x50, 0xEA, 0x31, 0xDE, 0x7A, 0xB5, 0x02, 0x25, 0xDB,
+    0x76, 0x10, 0xEB, 0x18, 0x17, 0xD2, 0x93, 0x7E, 0xE7, 0x5A, 0x0E, 0x90, 0x7E, 0x77, 0x4B, 0x92,
+    0xCF, 0xEB, 0x94, 0x60, 0xB6, 0xB1, 0x4B, 0x3E, 0x35, 0x55, 0xF6, 0x21, 0xC6, 0xFF, 0xEB, 0xDC,
+    0x4B, 0xB2, 0x3E, 0x6D, 0x2B, 0x46, 0x9D, 0xDE, 0x64, 0xBE, 0xC8, 0xD6, 0x58, 0xDE, 0xEE, 0x46,
+    0x8C, 0x3B, 0xCF, 0x45, 0x7B, 0x83, 0x62, 0x2C, 0xAA, 0xC0, 0xBC, 0x14, 0xCB, 0x2D, 0xE9, 0x75,
+    0x3E, 0x79, 0xBF, 0xF4, 0x6A, 0xE6, 0xF5, 0xA9, 0xD6, 0x92, 0xDE, 0x6C, 0x70, 0x9B, 0x55, 0xE8,
+    0xC4, 0x12, 0x2B, 0xB2, 0xE2, 0x60, 0x51, 0x74, 0x38, 0x31, 0x1B, 0x0C, 0xB4, 0xF4, 0xCC, 0xB9,
+    0x46, 0xBA, 0xAA, 0x2F, 0x66, 0xF3, 0x72, 0x6A, 0x6F, 0xCE, 0x40, 0xD3, 0xF7, 0x20, 0x3D, 0x16,
+    0xF8, 0xDC, 0x5B, 0x7C, 0x90, 0x23, 0xC6, 0x64, 0x30, 0x5A, 0x63, 0x24, 0x8D, 0x58, 0x59, 0xF9,
+    0xE9, 0x71, 0xC0, 0xF7, 0x92, 0xC3, 0x85, 0xC7, 0xB2, 0x3A, 0x35, 0xEF, 0xAF, 0xC2, 0x43, 0x7E,
+    0xE8, 0xBB, 0x82, 0x76, 0xF2, 0xA6, 0x0D, 0x97, 0xAA, 0x9B, 0x4D, 0xDB, 0x63, 0xF9, 0xE1, 0x22,
+    0xAE, 0x42, 0x2B, 0x6F, 0xF7, 0x2B, 0xCB, 0x57, 0x2B, 0xDB, 0xCA, 0x76, 0x39, 0xE8, 0xB2, 0xE9,
+    0x6D, 0xC2, 0xF6, 0x47, 0x7E, 0x8B, 0x0D, 0x98, 0x79, 0x13, 0x66, 0xD4, 0x0E, 0xDD, 0x58, 0xED,
+    0x77, 0xD5, 0x3C, 0x32, 0xD6, 0x7B, 0xE4, 0x70, 0x07, 0x67, 0x1A, 0x6B, 0x86, 0x1C, 0x84, 0x99,
+    0xD5, 0xF5, 0xE7, 0xC8, 0xFF, 0x8C, 0x66, 0xE6, 0x48, 0xFF, 0x72, 0xF1, 0x1F, 0xB0, 0x92, 0x9A,
+    0x80, 0xFD, 0xF5, 0xE7, 0xC6, 0xDF, 0x81, 0x2B, 0x0A, 0xF3, 0x46, 0x7F, 0x81, 0xED, 0xD8, 0x3C,
+    0x37, 0xDE, 0xB1, 0xB9, 0xAD, 0x7D, 0x15, 0xC6, 0x13, 0xD0, 0x92, 0x4F, 0x44, 0x35, 0x9F, 0xE1,
+    0x82, 0x8C, 0xE8, 0x74, 0xF9, 0x5C, 0x5F, 0xA9, 0x56, 0x81, 0xA0, 0x04, 0x92, 0x28, 0x8C, 0x04,
+    0x23, 0x31, 0xE4, 0x8E, 0x95, 0xFE, 0xE6, 0xF3, 0xDB, 0xB8, 0x93, 0x1A, 0xB8, 0xA7, 0x80, 0x38,
+    0x25, 0x8E, 0x03, 0x60, 0xBE, 0xA6, 0xCD, 0x70, 0x81, 0x00, 0xD8, 0x87, 0x82, 0xCB, 0x49, 0x36,
+    0x7B, 0x06, 0x63, 0xC5, 0x62, 0xB4, 0x46, 0x7E, 0x68, 0x67, 0x7C, 0xD9, 0x01, 0x14, 0x7F, 0xDA,
+    0xA6, 0x1A, 0xF8, 0xFB, 0xBC, 0xD6, 0x45, 0xAF, 0xD9, 0x1C, 0x74, 0x41, 0x32, 0xDA, 0x44, 0x80,
+    0xE3, 0x85, 0xDA, 0x26, 0x0C, 0x75, 0x4C, 0x9D, 0x58, 0x22, 0x29, 0x9D, 0x6A, 0x4D, 0x5C, 0x37,
+    0x14, 0x52, 0x3D, 0x84, 0x98, 0x9C, 0x49, 0x0F, 0x68, 0x5C, 0x44, 0x24, 0x46, 0xC1, 0x38, 0x8D,
+    0x32, 0xD4, 0x32, 0x59, 0x9C, 0xB2, 0xDC, 0x89, 0x71, 0x97, 0x5F, 0x24, 0xB8, 0xCB, 0xAB, 0xD6,
+    0xF5, 0x2E, 0xDC, 0x9B, 0x39, 0xF5, 0x88, 0xC8, 0x9B, 0x21, 0x31, 0x8F, 0x1A, 0xBA, 0xE5, 0xF5,
+    0x9A, 0x42, 0x4D, 0x26, 0xD4, 0xD0, 0xA8, 0x62, 0xE2, 0x8C, 0x3C, 0x1A, 0xD6, 0x19, 0x54, 0xF3,
+    0x1C, 0xCE, 0x1A, 0x61, 0x9B, 0x7D, 0x5A, 0x3F, 0xAF, 0x59, 0xB8, 0xC8, 0x2B, 0x07, 0xCD, 0xBD,
+    0x3F, 0xE3, 0x44, 0x55, 0xE6, 0xF1, 0xE3, 0xCD, 0x86, 0x2A, 0x88, 0x42, 0xC1, 0x99, 0x52, 0xDA,
+    0xEC, 0x67, 0x26, 0x69, 0xC0, 0x4B, 0x99, 0x2E, 0x6D, 0xCE, 0xE9, 0x22, 0x8E, 0xA6, 0xF3, 0x68,
+    0xCA, 0xF2, 0x8F, 0xE7, 0x7B, 0x4A, 0xF7, 0x54, 0x20, 0x7B, 0xDA, 0x31, 0xD3, 0x14, 0x5E, 0x7D,
+    0xF4, 0x58, 0xE3, 0xC9, 0x94, 0x98, 0x91, 0xF3, 0x43, 0x54, 0xC0, 0x89, 0x20, 0x05, 0x69, 0x05,
+    0xB3, 0x5F, 0x41, 0x03, 0x10, 0xA6, 0xA6, 0xAD, 0x8E, 0xE1, 0x73, 0xA5, 0x6D, 0x7B, 0xDE, 0x11,
+    0x1B, 0x5C, 0xE7, 0x21, 0xB1, 0xED, 0x54, 0x6A, 0x7D, 0x7E, 0xB0, 0x9A, 0x3B, 0xB6, 0xB3, 0xF8,
+    0x99, 0x52, 0xED, 0x00, 0xDA, 0x36, 0x4D, 0xF0, 0x37, 0x5E, 0x4E, 0xB4, 0x57, 0xBB, 0x2B, 0x77,
+    0xBF, 0x17, 0xB3, 0x70, 0xD2, 0x93, 0x1C, 0xB1, 0x0E, 0xD5, 0x44, 0x69, 0xC6, 0xBB, 0x1A, 0xDB,
+    0x6E, 0x69, 0xAC, 0xFB, 0x1E, 0xE0, 0xD7, 0x76, 0x7A, 0x98, 0xD1, 0x0C, 0xA2, 0x1B, 0x9A, 0x38,
+    0x1E, 0x56, 0xA0, 0xE3, 0xAC, 0x45, 0xF2, 0x03, 0x91, 0x57, 0xF1, 0xC4, 0x28, 0xCA, 0xDD, 0xDA,
+    0xAF, 0x82, 0xD2, 0x69, 0xC0, 0xBB, 0xCF, 0x66, 0x75, 0xDD, 0xD6, 0xD0, 0xC0, 0xBA, 0xD7, 0x87,
+    0x4F, 0x8D, 0xF2, 0xA0, 0xF4, 0xAB, 0x38, 0x73, 0x9A, 0x0B, 0xB0, 0xF8, 0x13, 0x4B, 0x3B, 0x09,
+    0x72, 0x8B, 0xC9, 0x2C, 0x04, 0xE0, 0x18, 0xF3, 0xA4, 0x02, 0xC3, 0xB7, 0xE0, 0x7A, 0x51, 0xED,
+    0xA1, 0x64, 0xEF, 0xA7, 0x32, 0xCE, 0x01, 0xCB, 0x31, 0x05, 0x3B, 0xDA, 0x4F, 0x4A, 0x78, 0x8E,
+    0xF0, 0x23, 0x70, 0x92, 0xE4, 0xCD, 0x0A, 0xE6, 0xB7, 0x07, 0x2F, 0x95, 0x3B, 0x35, 0x1B, 0x3E,
+    0xC8, 0xE3, 0xAB, 0x08, 0x12, 0x20, 0x17, 0xCA, 0x83, 0x73, 0x0C, 0x8B, 0xF8, 0x06, 0xCB, 0x9F,
+    0xF8, 0xF7, 0x48, 0xEC, 0xF3, 0xE8, 0x3E, 0xB7, 0x59, 0x42, 0xF8, 0x72, 0x23, 0xE1, 0x94, 0x9E,
+    0xD7, 0x6F, 0x98, 0x12, 0x79, 0xE6, 0xBD, 0x71, 0xA9, 0x49, 0x7B, 0x2A, 0xC9, 0x2F, 0x99, 0x54,
+    0xBF, 0x22, 0xA7, 0x17, 0xE0, 0x9D, 0x49, 0x65, 0x9E, 0x2F, 0xD8, 0xFC, 0x61, 0xEE, 0xBF, 0xD4,
+    0x09, 0x2C, 0x86, 0xE2, 0xF9, 0x3E, 0x05, 0xD2, 0x98, 0x86, 0x01, 0x87, 0xF1, 0x20, 0x4E, 0x19,
+    0x0F, 0xE2, 0x36, 0x1E, 0x58, 0xEA, 0x6B, 0x20, 0x21, 0x1D, 0xE9, 0x88, 0xCD, 0x7E, 0x3C, 0x80,
+    0x53, 0x8C, 0x32, 0x2D, 0xD7, 0x52, 0x3A, 0xED, 0x58, 0x99, 0x25, 0x73, 0xEA, 0x73, 0x5B, 0x82,
+    0x8F, 0xF4, 0x14, 0x50, 0xCF, 0x6E, 0x20, 0xE9, 0x46, 0x00, 0x52, 0x4F, 0xC3, 0x9D, 0x9B, 0xB7,
+    0x1A, 0x2D, 0x44, 0x98, 0xB0, 0x68, 0xD8, 0x12, 0xA7, 0xCD, 0xEF, 0xAC, 0x55, 0x68, 0x9A, 0x6D,
+    0x53, 0x78, 0x9B, 0x42, 0x59, 0x2F, 0xEC, 0x16, 0xDF, 0x93, 0x59, 0xA8, 0xFB, 0x75, 0xA7, 0xBA,
+    0x16, 0xEA, 0xBF, 0xE2, 0x4B, 0x9C, 0xCB, 0x88, 0xD1, 0xDE, 0x29, 0x97, 0x8B, 0x81, 0x63, 0x3B,
+    0x8B, 0x13, 0xA2, 0xD9, 0xA6, 0xAA, 0x91, 0xA5, 0xE7, 0x0F, 0x2D, 0xC0, 0x71, 0xC6, 0x6F, 0x8B,
+    0x89, 0x6A, 0x5E, 0x10, 0x26, 0x5D, 0xEE, 0xBD, 0x24, 0xFE, 0x21, 0x61, 0x8F, 0x78, 0xB9, 0x67,
+    0x5D, 0x8B, 0xD3, 0x58, 0xD4, 0x71, 0x0A, 0xD3, 0x8D, 0x32, 0x60, 0x53, 0x07, 0x15, 0xE6, 0x58,
+    0xCE, 0xE0, 0x1E, 0x9B, 0x3A, 0x1F, 0x33, 0x7F, 0xFB, 0x67, 0xD1, 0x46, 0x25, 0x47, 0x17, 0x78,
+    0xFA, 0x94, 0xCC, 0xBE, 0xEA, 0x48, 0x39, 0x4F, 0x2A, 0xF6, 0x33, 0x7B, 0x5B, 0x21, 0xEE, 0x17,
+    0xA8, 0xAA, 0xE6, 0xDC, 0x8E, 0x43, 0x16, 0x85, 0x21, 0x74, 0xC7, 0xA0, 0x41, 0x59, 0x49, 0xC1,
+    0xE4, 0xF3, 0xC6, 0xFC, 0x9C, 0x20, 0xBF, 0xCD, 0x31, 0x5E, 0x9C, 0x61, 0xBC, 0x3E, 0x93, 0x9D,
+    0x19, 0xCA, 0x66, 0x3C, 0x16, 0x31, 0x0D, 0x8B, 0x98, 0x0E, 0x1E, 0xE8, 0xCE, 0xEF, 0xD7, 0x21,
+    0x84, 0xB8, 0x61, 0xB3, 0x52, 0x02, 0xD2, 0x22, 0xD7, 0x9D, 0xB2, 0xDF, 0x86, 0xA1, 0x47, 0x8A,
+    0x70, 0xA4, 0x10, 0xB9, 0xAA, 0x39, 0xF3, 0x4C, 0xF8, 0x2B, 0xFA, 0xED, 0x54, 0x9B, 0x93, 0xCE,
+    0xB4, 0xD3, 0x86, 0x75, 0x6A, 0xB3, 0x6C, 0x2B, 0x1D, 0x69, 0xAE, 0xD1, 0xA8, 0xCA, 0x37, 0x9A,
+    0x87, 0xD7, 0xEC, 0x54, 0x22, 0xAD, 0xF3, 0xBB, 0x8D, 0xE1, 0x8A, 0x51, 0xC0, 0xFE, 0x01, 0xEC,
+    0x38, 0x1F, 0x7C, 0x5C, 0xC4, 0x85, 0x84, 0x1F, 0xB2, 0x80, 0x09, 0xEF, 0xD1, 0x75, 0x87, 0x39,
+    0x9B, 0xB8, 0xB6, 0x01, 0xB1, 0xB8, 0xB7, 0xAA, 0xF0, 0x7F, 0xAA, 0xD5, 0x53, 0x32, 0xE9, 0x3A,
+    0x2E, 0x6D, 0x4F, 0xD3, 0xF6, 0x0A, 0x87, 0xDD, 0x26, 0x84, 0xF6, 0x34, 0xFD, 0xA5, 0xA6, 0x4B,
+    0xC0, 0xAE, 0x57, 0x62, 0x3E, 0xCA, 0xC5, 0x5C, 0x7D, 0x94, 0x7B, 0xB5, 0x98, 0x0C, 0x8A, 0xD1,
+    0x4F, 0x43, 0xEA, 0x12, 0xD8, 0x25, 0xAA, 0x4F, 0x64, 0xD6, 0x23, 0x19, 0x91, 0x61, 0x03, 0xC2,
+    0x0D, 0x35, 0x76, 0x17, 0x7A, 0xF4, 0xC0, 0x89, 0xC4, 0x20, 0xF7, 0x66, 0x88, 0x39, 0xE6, 0xEF,
+    0x98, 0x83, 0x79, 0xA3, 0xEC, 0x22, 0xC4, 0x39, 0xDB, 0xDB, 0xB0, 0x89, 0xB9, 0x5D, 0x6A, 0x2D,
+    0xFE, 0x97, 0x3B, 0x55, 0x47, 0x0D, 0x43, 0xAB, 0xFB, 0xB8, 0x68, 0x7B, 0x12, 0xEE, 0x84, 0x9B,
+    0x91, 0xF9, 0xD6, 0xA1, 0x0E, 0xE4, 0x51, 0xC3, 0xB8, 0xEC, 0xA0, 0x56, 0x20, 0x0F, 0x6D, 0x33,
+    0x9E, 0xA5, 0x07, 0xFC, 0xF9, 0x72, 0x93, 0xF1, 0xA8, 0x11, 0x68, 0xC3, 0xB0, 0x5C, 0xE7, 0x4A,
+    0xF4, 0x74, 0x7B, 0xF6, 0x90, 0xCF, 0x3A, 0x72, 0x8D, 0xD0, 0x8C, 0x48, 0xFB, 0x82, 0x74, 0x4C,
+    0x05, 0xE2, 0xAF, 0x9B, 0xBF, 0x4E, 0xE7, 0xC3, 0xB4, 0x55, 0x3B, 0x5A, 0x71, 0xF6, 0xDC, 0x01,
+    0x49, 0x30, 0x0D, 0x58, 0x89, 0xF5, 0xCD, 0xA5, 0xBE, 0x51, 0x4E, 0xD3, 0x6B, 0x85, 0x57, 0x3B,
+    0xA6, 0xF4, 0x4B, 0x70, 0x33, 0x19, 0xDF, 0x3C, 0x80, 0x57, 0x0D, 0x0A, 0x70, 0x9C, 0xC2, 0xC9,
+    0x80, 0x67, 0x83, 0x2A, 0x2F, 0xA1, 0xA3, 0xD0, 0x1D, 0x44, 0x63, 0x6E, 0x72, 0x0F, 0xF1, 0x2B,
+    0x35, 0x4A, 0x35, 0x7A, 0x30, 0xAE, 0xF5, 0x10, 0x35, 0x6A, 0xAF, 0x7D, 0xF5, 0x10, 0xEF, 0x7E,
+    0x69, 0xB2, 0xDF, 0x02, 0xC5, 0x47, 0x8F, 0x60, 0xD7, 0xFE, 0xCC, 0xFF, 0x03, 0x33, 0x96, 0xCB,
+    0x22, 0xF3, 0x37, 0x08, 0x7C, 0x78, 0x9F, 0x04, 0x62, 0x30, 0xEF, 0xDD, 0x62, 0xF7, 0x2E, 0x68,
+    0xBB, 0x06, 0xF3, 0xED, 0x8C, 0xA4, 0xED, 0xA3, 0x1D, 0x7A, 0xEF, 0x83, 0xEE, 0xA1, 0x7C, 0x99,
+    0xFE, 0x1E, 0x58, 0xC0, 0x69, 0x2D, 0xB5, 0xB9, 0xCD, 0xB4, 0xF5, 0x18, 0xA1, 0xDD, 0x9E, 0xE4,
+    0x24, 0x43, 0xA2, 0x9B, 0xF7, 0x45, 0xDC, 0xC5, 0xBE, 0xC8, 0x82, 0x35, 0x04, 0x26, 0xB3, 0x38,
+    0xAE, 0x4E, 0x20, 0x87, 0x1A, 0xD9, 0x61, 0x0D, 0xAF, 0x37, 0x89, 0x32, 0xBF, 0x4A, 0x2E, 0x8E,
+    0x0B, 0x94, 0xD3, 0xB8, 0xFC, 0x50, 0x7A, 0xE9, 0x53, 0x71, 0x70, 0x63, 0x34, 0x55, 0x1C, 0x2B,
+    0xF3, 0xB8, 0xAF, 0xB3, 0x29, 0xAD, 0x13, 0xA3, 0x3B, 0xBA, 0x7B, 0x44, 0xBC, 0xCE, 0xD9, 0xA6,
+    0xA3, 0x8B, 0x65, 0x0C, 0x3E, 0x46, 0x28, 0xB8, 0xB8, 0xDC, 0xEF, 0xF8, 0x36, 0x79, 0x2D, 0xF6,
+    0x36, 0xC2, 0x74, 0xB2, 0x6C, 0x47, 0xDF, 0x1E, 0x1F, 0xE7, 0x96, 0x06, 0xCF, 0x46, 0xE5, 0xC6,
+    0xA6, 0xDF, 0xBC, 0xE5, 0xB7, 0xAD, 0xA1, 0xAB, 0xD1, 0x6F, 0xCD, 0x7B, 0xDC, 0xC5, 0x38, 0xB2,
+    0xF8, 0xB2, 0x51, 0x46, 0x1D, 0x88, 0xDB, 0xA8, 0xF1, 0x0E, 0xB5, 0x02, 0x2A, 0x8A, 0xCB, 0xD0,
+    0x88, 0xCE, 0x05, 0x7C, 0xB3, 0xD1, 0x5E, 0x4C, 0x59, 0x6F, 0x8C, 0x4B, 0xF7, 0x8B, 0x49, 0x98,
+    0x0F, 0x2F, 0x74, 0x8E, 0xFD, 0x9B, 0x8D, 0x96, 0x9E, 0xF0, 0xCA, 0x35, 0xF8, 0xA6, 0x25, 0xCF,
+    0xF4, 0x0D, 0xA7, 0xA9, 0x9F, 0x5D, 0x6E, 0x07, 0xCF, 0xF8, 0x3A, 0x44, 0xC2, 0x28, 0x14, 0x57,
+    0xED, 0x46, 0x68, 0x30, 0x61, 0x4B, 0x2E, 0xDD, 0xEE, 0x42, 0x29, 0x9E, 0x3A, 0x79, 0x27, 0xA2,
+    0x07, 0x78, 0x3F, 0x75, 0xCD, 0xCE, 0xA3, 0x34, 0x98, 0x38, 0x86, 0x4E, 0x66, 0x9C, 0xB2, 0xAB,
+    0xA3, 0xA9, 0x15, 0x57, 0x49, 0x49, 0x8F, 0x80, 0x46, 0x16, 0x55, 0x8F, 0xA1, 0x2D, 0x61, 0xD8,
+    0x8E, 0x8B, 0x4D, 0xBA, 0x76, 0x43, 0xE5, 0xA3, 0xE5, 0x5B, 0xD5, 0x3F, 0x25, 0xAF, 0x72, 0x47,
+    0xF5, 0x2E, 0x4E, 0xA2, 0x3C, 0xF2, 0xEE, 0xB1, 0x0F, 0x97, 0x9E, 0xE9, 0x00, 0xC2, 0xF4, 0xB7,
+    0xF8, 0xFA, 0xCF, 0x90, 0x7E, 0x67, 0x3A, 0xDD, 0x2C, 0xC4, 0x14, 0x61, 0x81, 0xDC, 0x29, 0x28,
+    0x91, 0x34, 0x04, 0x05, 0xEA, 0xB9, 0xB0, 0xF0, 0xDA, 0x34, 0x07, 0xC9, 0x4D, 0xC5, 0xE4, 0xA6,
+    0xB4, 0x49, 0x18, 0xDB, 0x3D, 0x96, 0xF4, 0x39, 0xF7, 0x3D, 0xCE, 0x7E, 0x4A, 0x15, 0x6A, 0x5F,
+    0x6C, 0x10, 0xF7, 0xE6, 0x3C, 0xD3, 0xB2, 0xAF, 0x74, 0xED, 0xE7, 0x02, 0xC1, 0x92, 0xB2, 0xFA,
+    0xCC, 0xD7, 0xB8, 0x61, 0xEC, 0x98, 0xAB, 0x0D, 0x2D, 0x75, 0x8F, 0xA6, 0xDA, 0x0E, 0x1F, 0xB7,
+    0xEE, 0x35, 0x39, 0x28, 0x83, 0x5E, 0xE7, 0x6D, 0x13, 0x95, 0x41, 0x0A, 0x70, 0xD1, 0x43, 0xCC,
+    0x80, 0xCA, 0x8B, 0xA1, 0x6A, 0x35, 0x11, 0x69, 0x7B, 0x90, 0xBA, 0x87, 0xEB, 0xB0, 0x02, 0xF5,
+    0x1F, 0x70, 0xBB, 0x96, 0x85, 0xF3, 0x9A, 0xAC, 0x3E, 0x47, 0x18, 0xCE, 0x65, 0x37, 0x95, 0xB0,
+    0x09, 0xF8, 0xCA, 0xD7, 0x8E, 0xC8, 0x6A, 0x04, 0xF3, 0xFA, 0xDD, 0x72, 0xE7, 0xED, 0xA8, 0x11,
+    0x30, 0xE6, 0x04, 0xF9, 0x50, 0xD4, 0x65, 0x48, 0x90, 0xDD, 0x3D, 0x14, 0x7F, 0x8F, 0x1A, 0x41,
+    0x3A, 0xDF, 0x11, 0x0A, 0x3A, 0xE2, 0x2C, 0xC5, 0xDB, 0xFD, 0x17, 0x73, 0x36, 0xF8, 0x9E, 0xCE,
+    0x22, 0xB4, 0x72, 0xE9, 0xB1, 0xA5, 0xBD, 0xFA, 0x1C, 0x4C, 0x1E, 0x68, 0x19, 0x0E, 0x65, 0xFC,
+    0xC4, 0x50, 0x0F, 0xFB, 0x99, 0x0B, 0x13, 0x82, 0xDA, 0x7A, 0x8F, 0xF2, 0xA0, 0x08, 0xFF, 0x92,
+    0xA3, 0x92, 0x0F, 0x40, 0xB6, 0xC3, 0x3C, 0xBC, 0x01, 0x67, 0x18, 0xBD, 0x59, 0x86, 0x59, 0x74,
+    0x29, 0x8F, 0xD2, 0x68, 0x87, 0x13, 0x9C, 0x62, 0x0A, 0x61, 0x8D, 0xB0, 0xED, 0xF3, 0x25, 0x38,
+    0x1D, 0x29, 0x66, 0x37, 0xE2, 0x15, 0xE9, 0xB6, 0x38, 0x16, 0xB6, 0xEA, 0xB7, 0xFF, 0xC7, 0x56,
+    0x3D, 0xB2, 0xEB, 0x60, 0xB1, 0x2A, 0x80, 0x2C, 0x10, 0xC0, 0xE1, 0xEC, 0xE0, 0x29, 0xE2, 0xCE,
+    0x66, 0x34, 0x7B, 0xE8, 0xD1, 0x05, 0x8E, 0x28, 0xD8, 0xA6, 0x2B, 0x71, 0x68, 0xCE, 0x5D, 0xCE,
+    0x70, 0xE3, 0x71, 0x9B, 0x33, 0x04, 0xE6, 0xCD, 0x52, 0xCD, 0xB5, 0x4B, 0x6B, 0xC7, 0xF3, 0x1C,
+    0x5B, 0x2D, 0x4C, 0xD3, 0xDA, 0xA5, 0x74, 0xF2, 0xC8, 0x61, 0x3C, 0xDB, 0xC6, 0xFA, 0x91, 0xC3,
+    0xF8, 0xDA, 0x5D, 0xE8, 0xA3, 0x5F, 0x0F, 0xAB, 0x18, 0xCF, 0xDA, 0xD7, 0xD5, 0xD2, 0x95, 0x0B,
+    0x86, 0x9B, 0x94, 0x31, 0xA9, 0x56, 0x59, 0x5C, 0x4E, 0x85, 0xCA, 0xA6, 0x39, 0x77, 0x21, 0x98,
+    0xF6, 0x21, 0x63, 0x66, 0xD2, 0xA2, 0xB3, 0x03, 0xED, 0xE9, 0x5B, 0xB1, 0xBA, 0x73, 0xFC, 0x2F,
+    0x32, 0x74, 0xFE, 0xAD, 0x46, 0xF4, 0xA5, 0xB2, 0xB5, 0x5B, 0x3E, 0x5A, 0x6D, 0x6B, 0xD9, 0xB3,
+    0xF4, 0x46, 0xAD, 0x6D, 0x3C, 0x05, 0x5A, 0x66, 0x6B, 0xE9, 0xFD, 0x93, 0xB1, 0x6A, 0xB1, 0xD6,
+    0xC8, 0x49, 0xD9, 0x05, 0x84, 0x85, 0x0A, 0x79, 0xBF, 0x38, 0x0E, 0xF2, 0xE5, 0xBD, 0xAF, 0x77,
+    0xC1, 0x24, 0xBE, 0xC6, 0x1D, 0x94, 0xDE, 0xB5, 0x4A, 0x92, 0x0A, 0x93, 0x4F, 0x72, 0xF0, 0xE9,
+    0xB3, 0x32, 0x1E, 0x93, 0xE3, 0x94, 0x84, 0x5B, 0xE0, 0x38, 0x78, 0x13, 0x87, 0x41, 0x93, 0x2F,
+    0x15, 0xF0, 0x4E, 0x0D, 0x29, 0x88, 0x26, 0x0D, 0x6E, 0x0F, 0x1E, 0xBD, 0x31, 0x93, 0xE0, 0x3E,
+    0x7C, 0x44, 0xF8, 0x67, 0xC3, 0x50, 0x7A, 0xAA, 0xAD, 0x34, 0xFF, 0xEB, 0x8B, 0x6C, 0x6D, 0xBD,
+    0x6C, 0x3B, 0xA0, 0xD1, 0x45, 0xDD, 0x96, 0x7C, 0x83, 0xF4, 0xEC, 0xC1, 0x0E, 0xCE, 0xB1, 0x97,
+    0xF7, 0x7F, 0x00, 0xD5, 0x5C, 0x3D, 0x90, 0x1C, 0xC7, 0x75, 0xEE, 0x99, 0x15, 0x30, 0x36, 0xA6,
+    0xCA, 0xC3, 0x00, 0x2E, 0xD1, 0x84, 0x89, 0x71, 0x95, 0x29, 0x15, 0x4D, 0x97, 0x30, 0xA9, 0x02,
+    0xF0, 0x66, 0x68, 0x85, 0x0E, 0xCC, 0x80, 0x20, 0x02, 0x06, 0x56, 0x66, 0xAA, 0x54, 0x25, 0x24,
+    0x0E, 0x18, 0xDC, 0xED, 0x0E, 0xCB, 0x01, 0x43, 0x22, 0x91, 0x9D, 0x22, 0x40, 0x40, 0xAE, 0x02,
+    0x25, 0x0C, 0x50, 0xD2, 0xED, 0xED, 0xC0, 0x0C, 0x18, 0x38, 0xE0, 0x94, 0x54, 0x2C, 0x87, 0x9C,
+    0xB2, 0x11, 0xD8, 0x64, 0xC0, 0xA5, 0x35, 0x2C, 0x0D, 0xAE, 0x66, 0x77, 0xFC, 0xBE, 0xEF, 0xF5,
+    0xFC, 0xEC, 0xEE, 0x1D, 0x70, 0x94, 0x70, 0xB8, 0xC3, 0x01, 0xF7, 0x96, 0xDC, 0x9D, 0xED, 0x7E,
+    0xFD, 0xF5, 0xEB, 0xF7, 0xDF, 0x30, 0xC6, 0x9D, 0x7E, 0x68, 0x8C, 0xD7, 0xAC, 0x40, 0x96, 0x66,
+    0xF8, 0x13, 0x83, 0xCC, 0x13, 0x21, 0x8D, 0x90, 0x51, 0x93, 0xCA, 0x23, 0x9F, 0x0B, 0x09, 0x3E,
+    0xCD, 0x8C, 0x09, 0xDF, 0x17, 0x12, 0xFB, 0x42, 0xC6, 0x20, 0xB5, 0x9F, 0x1B, 0xB7, 0xF4, 0x72,
+    0x33, 0x5A, 0x78, 0x85, 0xF1, 0xF3, 0x51, 0x61, 0x82, 0x6C, 0xB4, 0x30, 0x51, 0xD3, 0x2C, 0xCC,
+    0x04, 0x64, 0x35, 0xFD, 0xC5, 0xC2, 0xA9, 0xE5, 0x21, 0x79, 0x57, 0x9E, 0x2C, 0x8C, 0x53, 0x05,
+    0x99, 0x90, 0x48, 0x46, 0xAC, 0x31, 0x55, 0x7D, 0x00, 0xD2, 0xF2, 0x23, 0xAC, 0xF8, 0x4D, 0x3D,
+    0x64, 0xC7, 0x5F, 0x8D, 0x32, 0x13, 0x37, 0x9F, 0x64, 0xA6, 0xB9, 0xF9, 0x55, 0x36, 0xAA, 0x4C,
+    0x93, 0xFA, 0x32, 0x76, 0x22, 0xA3, 0xC4, 0x26, 0x4C, 0x85, 0xC4, 0x09, 0x88, 0x70, 0x04, 0x32,
+    0x93, 0x17, 0x19, 0x6E, 0x6C, 0x1C, 0x10, 0x79, 0x7C, 0x6C, 0xFC, 0x52, 0x3E, 0x88, 0x84, 0xDC,
+    0x5F, 0x2D, 0x4C, 0xD8, 0xFC, 0xD7, 0x42, 0xE6, 0xF9, 0xBB, 0xC2, 0x98, 0xE7, 0x38, 0xBE, 0x9B,
+    0x5C, 0x14, 0x3A, 0xCA, 0x02, 0xD0, 0x43, 0xC1, 0xC3, 0x38, 0x4D, 0x85, 0x0F, 0xA2, 0xDB, 0x66,
+    0xE3, 0x87, 0xC8, 0x28, 0x34, 0xC4, 0x46, 0xC1, 0x51, 0x74, 0x14, 0x1E, 0xC5, 0x47, 0x01, 0x52,
+    0x84, 0x08, 0x91, 0x62, 0xA4, 0x20, 0x29, 0x4A, 0x0A, 0x93, 0xE2, 0xA4, 0x40, 0x11, 0x29, 0x43,
+    0xA8, 0x0C, 0xB1, 0x32, 0x04, 0xCB, 0x10, 0x2D, 0x43, 0xB8, 0xC8, 0x40, 0x6D, 0x14, 0x30, 0x61,
+    0xFC, 0x92, 0xCC, 0x9D, 0x86, 0x60, 0x5B, 0x60, 0x73, 0xC9, 0xF5, 0xAD, 0xF4, 0x69, 0x62, 0x77,
+    0x46, 0xB2, 0x22, 0x8B, 0x2D, 0x80, 0x38, 0xD6, 0x7A, 0x0D, 0x1C, 0x5C, 0xEF, 0x48, 0x8C, 0x4D,
+    0x0B, 0x8B, 0xA7, 0x83, 0x81, 0x0F, 0x06, 0x76, 0x30, 0xC9, 0x3D, 0x90, 0x45, 0x47, 0x56, 0x40,
+    0x64, 0xD2, 0x6F, 0x85, 0x73, 0x17, 0x62, 0x82, 0x8F, 0x82, 0xAC, 0x45, 0x6D, 0x1F, 0xEF, 0x17,
+    0x6B, 0xF2, 0x15, 0x35, 0x82, 0x50, 0x23, 0xE2, 0x1F, 0xAE, 0x7E, 0x51, 0x9A, 0x49, 0x2E, 0x28,
+    0x43, 0x1E, 0x47, 0x55, 0xF7, 0xED, 0x1C, 0xAB, 0xC3, 0x10, 0x80, 0x44, 0xC7, 0x21, 0x99, 0x80,
+    0x1C, 0x1C, 0x41, 0x26, 0xDD, 0x23, 0x71, 0xD6, 0x22, 0xE3, 0xAF, 0x6E, 0xDC, 0xC3, 0x3C, 0x15,
+    0x24, 0xEF, 0x81, 0xBC, 0xF1, 0x06, 0x79, 0xFC, 0x40, 0x66, 0x2A, 0x75, 0x8E, 0x48, 0xF8, 0xDF,
+    0x6B, 0x17, 0xA3, 0x3F, 0x5E, 0x53, 0x08, 0x8A, 0x0B, 0xD3, 0xFC, 0xFC, 0x0E, 0xF8, 0x11, 0x08,
+    0xB9, 0x16, 0xF0, 0x11, 0xDB, 0x29, 0x30, 0xD7, 0x78, 0xF0, 0xCB, 0xF7, 0x13, 0x4C, 0x7A, 0x45,
+    0x0E, 0x75, 0x23, 0xE7, 0x4A, 0xC4, 0xF4, 0x02, 0x4F, 0xCF, 0xDB, 0x3C, 0x66, 0x3C, 0x41, 0xF2,
+    0xFF, 0xC1, 0x7F, 0x40, 0x46, 0x70, 0x2A, 0xCA, 0xE1, 0x94, 0x67, 0x0C, 0xC8, 0xDF, 0x40, 0xAA,
+    0x71, 0xAE, 0x52, 0xE3, 0xFF, 0x67, 0x6E, 0x62, 0x77, 0x21, 0xDB, 0xFC, 0xD1, 0x29, 0x01, 0x72,
+    0x19, 0x64, 0xD9, 0x91, 0xDA, 0x6C, 0xFD, 0x9C, 0x29, 0x16, 0x97, 0xED, 0x0A, 0xE6, 0x46, 0x05,
+    0xC3, 0x9C, 0x92, 0x60, 0xBC, 0x6C, 0x9E, 0x97, 0xAF, 0x1A, 0x19, 0x27, 0x78, 0xAF, 0xC0, 0xD8,
+    0x32, 0xCA, 0x88, 0x3A, 0xB9, 0x3A, 0x37, 0x60, 0xFC, 0x85, 0xFC, 0x09, 0x92, 0x7D, 0xE3, 0x7F,
+    0xBC, 0x10, 0xF1, 0xCD, 0x54, 0x8E, 0xEB, 0x53, 0x02, 0x04, 0x93, 0x19, 0x4E, 0x27, 0x03, 0x7F,
+    0xBC, 0xE0, 0x89, 0xC9, 0xDA, 0xC3, 0x03, 0x6D, 0xB5, 0x29, 0x24, 0xD0, 0x34, 0x71, 0x83, 0x53,
+    0x25, 0xB4, 0xC0, 0xF0, 0x61, 0x85, 0xE7, 0xDC, 0x9A, 0x4F, 0xAF, 0xC8, 0xEA, 0x84, 0x34, 0x26,
+    0xAA, 0x31, 0x4C, 0x8D, 0x50, 0x98, 0xA3, 0x75, 0x0A, 0x63, 0x35, 0x31, 0x30, 0x5F, 0x07, 0x5C,
+    0x41, 0x0D, 0x2A, 0xE3, 0x88, 0xD2, 0xF4, 0x4A, 0x13, 0x26, 0x26, 0x28, 0xA0, 0x29, 0x26, 0x50,
+    0xA4, 0x17, 0x85, 0x9F, 0x78, 0x3A, 0x27, 0x50, 0xB2, 0x37, 0x66, 0x4E, 0xB8, 0xF0, 0xF3, 0xC6,
+    0x05, 0xBE, 0x54, 0x11, 0x95, 0x4C, 0x45, 0x75, 0xE9, 0x96, 0x58, 0x8F, 0x4C, 0xC3, 0xD3, 0x3E,
+    0xFA, 0xBF, 0x9C, 0x2F, 0xAA, 0x0C, 0x61, 0x28, 0x05, 0x78, 0xDA, 0xCE, 0xB8, 0xA1, 0x51, 0x85,
+    0xE2, 0xE6, 0xE6, 0x42, 0x1C, 0xA8, 0xBC, 0x09, 0x29, 0x50, 0xA3, 0x02, 0x37, 0xAA, 0xC2, 0x8D,
+    0x2A, 0x71, 0xA3, 0x6A, 0xDC, 0xA8, 0x22, 0x37, 0xAA, 0xCA, 0x8D, 0x2A, 0x73, 0xA3, 0xEA, 0xDC,
+    0xA8, 0x42, 0x97, 0x97, 0xFB, 0x87, 0x60, 0x81, 0x4A, 0x1D, 0x3B, 0xF7, 0x23, 0xF2, 0xF0, 0xDC,
+    0x13, 0x02, 0x73, 0xD2, 0xC0, 0x64, 0xCF, 0x49, 0x7F, 0xFA, 0xC5, 0xDD, 0x27, 0x01, 0xA6, 0x62,
+    0x69, 0xDA, 0x13, 0x71, 0xE1, 0xCD, 0x87, 0xCA, 0x62, 0xDA, 0x32, 0xCA, 0x5D, 0x53, 0x14, 0x15,
+    0xC4, 0x09, 0x30, 0x74, 0x9A, 0x37, 0x05, 0x42, 0x01, 0x60, 0x9E, 0x5A, 0x00, 0x15, 0x3F, 0x85,
+    0x4F, 0xD1, 0x53, 0xF0, 0x14, 0x3B, 0x85, 0x4E, 0x91, 0x53, 0xE0, 0x14, 0x37, 0x85, 0x4D, 0x51,
+    0x53, 0xD0, 0x2C, 0x66, 0x16, 0xB2, 0xE9, 0x34, 0xC1, 0x79, 0x21, 0x59, 0x97, 0x4B, 0x59, 0x87,
+    0x30, 0x98, 0x29, 0x19, 0x77, 0xB2, 0xBB, 0xDF, 0x69, 0xBB, 0xBA, 0x5D, 0x13, 0x10, 0x94, 0x43,
+    0x3F, 0xBD, 0x2B, 0xA2, 0xDE, 0x94, 0x4A, 0xB8, 0x28, 0x80, 0xA7, 0x06, 0x94, 0x24, 0xC4, 0xC1,
+    0x0E, 0xB1, 0x64, 0x98, 0x2B, 0x7B, 0x74, 0xA7, 0xD3, 0x14, 0xA0, 0x65, 0x82, 0x19, 0x30, 0xB9,
+    0x24, 0xA3, 0x84, 0x72, 0x7C, 0xC3, 0xA6, 0xEC, 0x1D, 0x02, 0xF9, 0x80, 0xE7, 0xF3, 0x66, 0x39,
+    0xAA, 0x9C, 0xCA, 0x2F, 0xE0, 0x65, 0xB8, 0x65, 0x98, 0x7A, 0x8B, 0xF8, 0xB5, 0x79, 0x2E, 0x0C,
+    0xCA, 0xC7, 0x0F, 0xCC, 0x38, 0x39, 0xF2, 0x7C, 0x26, 0x72, 0x3E, 0x13, 0x3D, 0x9F, 0x60, 0xF8,
+    0xB6, 0x9B, 0x8A, 0x15, 0xF7, 0x84, 0x9F, 0x15, 0xDC, 0xA0, 0x39, 0xB4, 0xD0, 0x95, 0xE2, 0x3C,
+    0x2C, 0xFD, 0x4F, 0x45, 0x95, 0x86, 0x66, 0xD7, 0x04, 0x5F, 0x96, 0x54, 0x49, 0xE6, 0x20, 0x39,
+    0x15, 0x08, 0x8C, 0x93, 0xB6, 0x4A, 0xD7, 0x5F, 0xB4, 0xE7, 0x77, 0x53, 0x2B, 0x9D, 0x0D, 0x04,
+    0x82, 0x41, 0xAF, 0x6F, 0x77, 0xD6, 0x79, 0x7A, 0x92, 0x10, 0x9C, 0xD9, 0xFA, 0x76, 0x5B, 0x57,
+    0xD8, 0xCB, 0x5A, 0x7F, 0x38, 0xC0, 0xD3, 0xC1, 0xFF, 0xE0, 0xBD, 0xFA, 0x89, 0xAF, 0x57, 0xA4,
+    0xFB, 0x82, 0xF0, 0x3F, 0xCA, 0x75, 0x9E, 0xD0, 0xD8, 0x5F, 0x51, 0x4F, 0x7E, 0x7B, 0xC0, 0x6E,
+    0xCB, 0x1F, 0x53, 0x42, 0xF3, 0xEC, 0x72, 0x00, 0x70, 0x11, 0x2E, 0xDA, 0x05, 0x9E, 0x83, 0x63,
+    0x71, 0x49, 0x78, 0xDF, 0x33, 0xDE, 0x6F, 0x4A, 0x51, 0x52, 0xB9, 0x06, 0x2E, 0xB3, 0xD3, 0x91,
+    0x0B, 0x63, 0x5E, 0xE9, 0x23, 0x46, 0x97, 0x76, 0xDB, 0xFF, 0x2D, 0xF8, 0x8E, 0x5E, 0xC3, 0x8A,
+    0xDE, 0x91, 0x3F, 0x9B, 0x07, 0xE5, 0x01, 0x1E, 0x84, 0xEE, 0x0C, 0x57, 0x53, 0x41, 0x5B, 0x3C,
+    0x9B, 0xE7, 0xE9, 0x85, 0xCA, 0xFA, 0x89, 0x09, 0xCF, 0x99, 0x7A, 0x37, 0xEA, 0xDE, 0xE8, 0x52,
+    0x6D, 0x68, 0x2A, 0x46, 0x68, 0x0A, 0x33, 0x33, 0x12, 0x95, 0x77, 0x20, 0xB4, 0x84, 0x6B, 0x23,
+    0xB6, 0x68, 0x48, 0x27, 0x34, 0x11, 0x31, 0xC1, 0x13, 0x4F, 0x47, 0x80, 0x0B, 0x11, 0x88, 0xC1,
+    0xD7, 0x11, 0xE3, 0x80, 0xC9, 0x13, 0x30, 0xF2, 0xB0, 0x37, 0x37, 0x2E, 0x62, 0xAA, 0x00, 0x13,
+    0x47, 0xE0, 0x61, 0x26, 0x0E, 0xA0, 0xBB, 0x10, 0x73, 0xEE, 0xA7, 0x7E, 0x32, 0x60, 0x5E, 0x1C,
+    0x65, 0x84, 0x47, 0x5F, 0x2F, 0x4C, 0xFC, 0xD9, 0xAF, 0x25, 0x98, 0x33, 0x71, 0x01, 0xFB, 0x96,
+    0xCB, 0x9C, 0x41, 0xE6, 0x61, 0x0E, 0x61, 0x3B, 0xCC, 0x30, 0x61, 0x2A, 0x24, 0x4A, 0x68, 0x7C,
+    0x84, 0x4C, 0x40, 0x56, 0x42, 0xDC, 0xA5, 0x3C, 0xE4, 0x0B, 0x29, 0xC7, 0xFB, 0xA2, 0xB3, 0xAA,
+    0x5A, 0xEC, 0x56, 0x2E, 0x02, 0xF0, 0x1D, 0x07, 0x70, 0xB9, 0xF4, 0x7E, 0x28, 0x49, 0x85, 0xF9,
+    0x2B, 0xAC, 0x3E, 0xFE, 0x57, 0xE1, 0x35, 0x06, 0xDA, 0x97, 0x1A, 0x06, 0xEB, 0xD0, 0x79, 0x86,
+    0x5A, 0xCF, 0x50, 0xEF, 0xA9, 0x33, 0x66, 0xD6, 0x74, 0xDF, 0x39, 0x46, 0xDA, 0x49, 0xD5, 0x9A,
+    0x08, 0x59, 0xC1, 0xD3, 0x9E, 0x23, 0x16, 0xB8, 0x72, 0xC7, 0x9C, 0x2F, 0x90, 0xA9, 0x55, 0x5B,
+    0x1C, 0xE8, 0x35, 0x6F, 0xEA, 0xD6, 0xF3, 0x2D, 0xCE, 0x8F, 0xB7, 0x57, 0xE7, 0x01, 0xE4, 0x73,
+    0x0C, 0xA0, 0xA2, 0x58, 0x9A, 0x76, 0x11, 0x16, 0x42, 0x9A, 0x1F, 0xDA, 0x03, 0x59, 0xA7, 0x7D,
+    0x0A, 0xC7, 0x91, 0xA7, 0xD1, 0x94, 0xED, 0xD3, 0xEA, 0xDF, 0x67, 0xE7, 0x0D, 0xEF, 0x63, 0x35,
+    0xF5, 0xE2, 0x28, 0x4D, 0x2D, 0x20, 0x8F, 0x08, 0x5A, 0x07, 0xDD, 0x98, 0x36, 0x68, 0x8F, 0x74,
+    0x46, 0x53, 0x54, 0xD3, 0x16, 0xD5, 0x78, 0x78, 0x18, 0x1A, 0xB8, 0xAB, 0xA9, 0xEC, 0xA4, 0xD8,
+    0x30, 0x99, 0x1D, 0xB4, 0xA6, 0x29, 0xAB, 0x69, 0xCB, 0x6A, 0x9B, 0xED, 0x43, 0x68, 0x50, 0x02,
+    0x50, 0x61, 0x3A, 0x24, 0x7D, 0xF4, 0x84, 0xC6, 0x81, 0x92, 0xF0, 0x60, 0x2B, 0x43, 0xE8, 0x8C,
+    0x71, 0x0C, 0xCB, 0x89, 0xEF, 0xE7, 0xA3, 0x16, 0x69, 0x27, 0xD9, 0xB6, 0x95, 0x94, 0x95, 0xA8,
+    0x93, 0x17, 0x1E, 0xE3, 0xB1, 0x2F, 0x72, 0x36, 0x9B, 0x88, 0x19, 0x5C, 0x3E, 0xBC, 0x95, 0x99,
+    0x26, 0x93, 0xB9, 0x1A, 0x99, 0xD0, 0x59, 0x0A, 0x71, 0xC1, 0xE1, 0xA8, 0xD4, 0xC4, 0x1D, 0xF7,
+    0x46, 0x0C, 0x63, 0x2E, 0xE3, 0xF8, 0x08, 0x27, 0x02, 0x4B, 0xC6, 0x18, 0x7D, 0x0F, 0xA3, 0xCF,
+    0x30, 0x3A, 0xF3, 0x96, 0x35, 0x27, 0x42, 0x8C, 0xA7, 0x8B, 0xB0, 0xAB, 0xB0, 0xCB, 0x08, 0x1B,
+    0xFC, 0xC0, 0x15, 0xC0, 0xCB, 0x2B, 0x02, 0xD1, 0xFC, 0x7F, 0xF5, 0x3B, 0x89, 0x8D, 0xAB, 0x2C,
+    0x7A, 0x70, 0x03, 0x70, 0x10, 0x14, 0x3F, 0x0B, 0xA0, 0x45, 0xD0, 0x42, 0x68, 0x31, 0xB4, 0x20,
+    0x5A, 0xFC, 0xB0, 0x15, 0x4C, 0xB8, 0x26, 0xED, 0xE4, 0x5B, 0x3C, 0x60, 0xDB, 0x08, 0xCD, 0x3A,
+    0x52, 0xCE, 0xAD, 0xCF, 0x5E, 0xC7, 0x3C, 0x08, 0xF6, 0x9B, 0x62, 0x88, 0xD4, 0x9E, 0x27, 0x87,
+    0x62, 0x3F, 0x16, 0x49, 0xAA, 0x57, 0x73, 0x41, 0x2A, 0x17, 0x29, 0x6D, 0x92, 0x6F, 0x85, 0xD4,
+    0xCE, 0xD1, 0x48, 0x39, 0x89, 0x2B, 0x93, 0x57, 0x3E, 0x82, 0x3A, 0x31, 0x04, 0xD7, 0x43, 0x79,
+    0xEF, 0x9F, 0xDD, 0x3B, 0x9B, 0x19, 0x10, 0xF9, 0x14, 0xB9, 0xE5, 0x87, 0x9D, 0x8B, 0xD4, 0xC9,
+    0x39, 0xBD, 0xA3, 0xFE, 0xA4, 0x1D, 0xB5, 0xED, 0x7D, 0x4A, 0x84, 0xA4, 0x77, 0xC0, 0x3A, 0xDF,
+    0x8B, 0x71, 0xA6, 0x0B, 0x02, 0x69, 0x10, 0xFF, 0x09, 0x03, 0xBC, 0xEE, 0xA4, 0xDE, 0x6A, 0x94,
+    0x05, 0xCD, 0x57, 0xC9, 0x35, 0xBF, 0x31, 0x2F, 0x9B, 0x0F, 0x7A, 0x9E, 0xF6, 0xEC, 0x10, 0xB5,
+    0xFD, 0xAD, 0xD4, 0x7F, 0x03, 0x6F, 0xE0, 0x0A, 0xBF, 0x60, 0x8C, 0xB1, 0x69, 0xAE, 0x0C, 0xE1,
+    0x17, 0x3C, 0x81, 0xA5, 0xA8, 0xE5, 0xE5, 0xA8, 0xA8, 0x2D, 0xA2, 0xBB, 0x98, 0x73, 0xB5, 0x47,
+    0x0E, 0x98, 0x6D, 0x0F, 0xD8, 0xA6, 0x5B, 0x62, 0xBB, 0xBE, 0x0D, 0xDE, 0xDC, 0x4A, 0x57, 0x86,
+    0x85, 0x5D, 0x9C, 0x7E, 0xE8, 0x37, 0xCB, 0xBE, 0xF4, 0xB0, 0xC7, 0xA7, 0x6B, 0xFE, 0xAD, 0xB0,
+    0x0A, 0xCD, 0xCA, 0xCB, 0x5F, 0x99, 0x50, 0xE6, 0x13, 0xFE, 0x03, 0x55, 0x96, 0x29, 0xA6, 0x8A,
+    0x74, 0x12, 0xF8, 0x1F, 0x81, 0xB9, 0x2E, 0xBE, 0x47, 0xB5, 0x15, 0x73, 0x9D, 0xF6, 0x02, 0xC4,
+    0xAF, 0xF5, 0xD3, 0xAB, 0xC6, 0x3B, 0xAC, 0x45, 0x81, 0xC9, 0xF8, 0x3F, 0x4B, 0x9F, 0xFC, 0xC6,
+    0x9C, 0xF2, 0x1A, 0x90, 0x5D, 0x1D, 0xC6, 0x16, 0xD1, 0x66, 0x6C, 0x61, 0x7E, 0x8C, 0xEF, 0x21,
+    0x29, 0x51, 0x0E, 0xF2, 0x6D, 0x83, 0xDD, 0x10, 0x95, 0xA7, 0x1B, 0xD2, 0xE5, 0x33, 0x06, 0x1B,
+    0xA9, 0xBB, 0xE8, 0x72, 0x17, 0x9D, 0x42, 0xD0, 0xC2, 0x04, 0xAF, 0xF2, 0x6F, 0x7C, 0xA7, 0x2B,
+    0x1A, 0x3C, 0x22, 0x66, 0x3C, 0xED, 0xE5, 0xEF, 0xC9, 0xA7, 0xB5, 0xFC, 0x91, 0xB8, 0x03, 0x35,
+    0x10, 0xD4, 0x49, 0xBC, 0xDC, 0xCF, 0xC5, 0xFC, 0x65, 0x61, 0x1A, 0x25, 0x11, 0x06, 0x11, 0x1E,
+    0xA0, 0x41, 0x44, 0xD9, 0x64, 0xE0, 0x43, 0xA6, 0x11, 0x4E, 0x7A, 0x1B, 0xB1, 0xE8, 0x6D, 0x84,
+    0x47, 0x1B, 0xE1, 0x67, 0x56, 0xAF, 0xED, 0x93, 0xD6, 0xAD, 0x69, 0x5A, 0x37, 0x4A, 0x7D, 0xDA,
+    0x6F, 0x4C, 0x3A, 0xDB, 0x34, 0x4A, 0x46, 0x8D, 0x52, 0x45, 0xAB, 0xDB, 0x08, 0x33, 0xE0, 0x78,
+    0xE8, 0x6A, 0xA8, 0x23, 0x08, 0xE3, 0xE3, 0xBC, 0x55, 0xD3, 0xF1, 0xD6, 0x8C, 0x1A, 0xA5, 0xF0,
+    0x75, 0x90, 0x8B, 0x50, 0xAC, 0x01, 0xCC, 0x49, 0x08, 0x7B, 0x1E, 0x24, 0xEB, 0x4E, 0x80, 0xCA,
+    0x69, 0x84, 0xB9, 0xA9, 0x04, 0x77, 0xB4, 0x0C, 0x23, 0x13, 0xCF, 0xB0, 0x73, 0xAC, 0x8B, 0xD5,
+    0x60, 0xAE, 0x12, 0xE2, 0x20, 0x00, 0x94, 0x9D, 0xF4, 0xE0, 0x23, 0xF8, 0x03, 0x47, 0x01, 0xA3,
+    0xA7, 0x3E, 0x7C, 0x04, 0x38, 0x0A, 0xA6, 0x2D, 0xF2, 0x6C, 0xE9, 0xBC, 0x71, 0xCB, 0xED, 0x3F,
+    0x81, 0xD9, 0xF9, 0xA2, 0xAF, 0xD7, 0xBC, 0x60, 0xEC, 0x7F, 0x3B, 0x50, 0xAE, 0xDE, 0x7F, 0xC3,
+    0x76, 0xA4, 0x15, 0xA4, 0xE4, 0xFA, 0x1A, 0xAF, 0xB3, 0xED, 0x38, 0x55, 0x9D, 0x8D, 0x23, 0x34,
+    0xF1, 0x46, 0x9C, 0x7A, 0xAC, 0x26, 0xDE, 0x39, 0x46, 0x13, 0x0F, 0xA2, 0xE0, 0x6E, 0xF4, 0x40,
+    0x06, 0xFE, 0xDE, 0x04, 0x15, 0x36, 0xE6, 0x27, 0x99, 0x0D, 0x34, 0xDF, 0x26, 0x5E, 0xDB, 0x8A,
+    0x94, 0x7B, 0xC3, 0x76, 0x8C, 0x2D, 0xD8, 0x70, 0xA6, 0x36, 0xD6, 0x37, 0xB0, 0x34, 0xE9, 0xF6,
+    0xFA, 0xB0, 0xAA, 0xEF, 0x03, 0x70, 0x72, 0x1A, 0xD3, 0x63, 0x54, 0xAD, 0x19, 0x73, 0x23, 0x62,
+    0x2E, 0x6D, 0x4C, 0x57, 0x76, 0xC6, 0x70, 0x7A, 0x9F, 0xFB, 0x53, 0x73, 0xC5, 0x35, 0xDE, 0x76,
+    0xAA, 0x38, 0x05, 0x0C, 0xCC, 0xF4, 0xFF, 0xBE, 0x62, 0x2E, 0x5C, 0x29, 0x05, 0xAE, 0x1A, 0x93,
+    0x93, 0x98, 0x5C, 0x44, 0x4C, 0x11, 0x87, 0x3C, 0x88, 0xF8, 0x6E, 0x98, 0x80, 0xD1, 0x28, 0x51,
+    0x41, 0x77, 0x29, 0xFA, 0x9A, 0xDC, 0xC4, 0x2C, 0xB3, 0x56, 0x7E, 0xFB, 0x1F, 0xF5, 0x66, 0x55,
+    0xC2, 0x55, 0x0D, 0x30, 0x31, 0x61, 0xEB, 0x53, 0x8A, 0xE3, 0x85, 0xE4, 0xA4, 0xB6, 0x35, 0xC4,
+    0x29, 0x44, 0xA2, 0x18, 0x73, 0xD6, 0x70, 0xDA, 0x2B, 0x79, 0xCB, 0x29, 0xE5, 0x2D, 0xF7, 0x6B,
+    0x79, 0x6B, 0xF4, 0x3B, 0xA8, 0x92, 0x86, 0xF9, 0x54, 0xD4, 0x0C, 0x2A, 0x7A, 0x33, 0x07, 0x18,
+    0x38, 0xB6, 0xCB, 0xB1, 0xAE, 0xAF, 0x2C, 0x26, 0x86, 0xD7, 0xAF, 0x78, 0x0D, 0xF8, 0xCD, 0xDA,
+    0x1D, 0xDD, 0xE9, 0x7C, 0xEE, 0x45, 0xC7, 0xEA, 0xDE, 0x36, 0x07, 0x4E, 0xCF, 0xC1, 0xE2, 0x8F,
+    0xE1, 0xE0, 0x12, 0x52, 0xCF, 0x29, 0x8B, 0x28, 0x10, 0x53, 0x78, 0x78, 0x43, 0x31, 0x8B, 0x8E,
+    0xD0, 0x7F, 0xFB, 0xBD, 0x0E, 0xDC, 0x34, 0x43, 0xF8, 0xBA, 0x16, 0xC9, 0xD7, 0x55, 0x29, 0x56,
+    0xD6, 0xA9, 0xD3, 0xE9, 0x34, 0x45, 0x46, 0xC7, 0xA6, 0x78, 0xA1, 0x68, 0x33, 0xDD, 0xC0, 0xDA,
+    0xEA, 0xE3, 0xB4, 0x77, 0x79, 0x8F, 0xB3, 0x65, 0xC7, 0xE8, 0x63, 0x88, 0xF8, 0xA6, 0x6A, 0xF7,
+    0x1F, 0xA3, 0xDA, 0x4F, 0x7F, 0x8D, 0x83, 0xFE, 0x83, 0x3D, 0xCB, 0x27, 0xC6, 0x81, 0x77, 0x6A,
+    0x6C, 0x79, 0x6E, 0xCB, 0xC2, 0xA9, 0xAB, 0xB2, 0x66, 0x19, 0x93, 0x35, 0xCB, 0x38, 0x23, 0x93,
+    0x83, 0xEF, 0xE9, 0x97, 0xF4, 0x07, 0xDF, 0xCE, 0xF9, 0x25, 0x16, 0xD6, 0x9F, 0xE3, 0x2A, 0x5F,
+    0x30, 0x5A, 0x28, 0x8F, 0x21, 0x5E, 0x63, 0xB0, 0x31, 0x43, 0x05, 0x7B, 0xDF, 0x4D, 0x8F, 0xD6,
+    0x55, 0xBD, 0xA6, 0x28, 0x8E, 0xD1, 0x84, 0x27, 0xC9, 0xD8, 0x39, 0xC9, 0xEB, 0x26, 0xF8, 0x77,
+    0xF1, 0xA4, 0x3F, 0x96, 0x60, 0xE8, 0x3D, 0x91, 0xC0, 0x7F, 0x90, 0x75, 0x5C, 0x3D, 0xC3, 0x5D,
+    0x74, 0x44, 0x8B, 0xF8, 0xC5, 0xA8, 0x08, 0x0A, 0xAF, 0xF0, 0xB3, 0x13, 0xEF, 0x22, 0xAD, 0xDF,
+    0xA6, 0xCB, 0xD8, 0x6D, 0x05, 0xF6, 0xE1, 0xB2, 0xA9, 0x0E, 0x9C, 0x72, 0xE5, 0x96, 0xBB, 0xC3,
+    0xFD, 0xF3, 0xB3, 0xB5, 0xEF, 0xE9, 0x97, 0x4E, 0xE6, 0x6B, 0xFC, 0xA5, 0x68, 0x37, 0xD1, 0x96,
+    0x38, 0xD0, 0xC2, 0x80, 0x07, 0x35, 0x2B, 0x2B, 0x98, 0x08, 0x22, 0x7F, 0xDD, 0xBA, 0x2D, 0x43,
+    0x39, 0xFC, 0x62, 0x7A, 0x47, 0x02, 0xB1, 0x45, 0x84, 0x38, 0xE7, 0xB1, 0xDC, 0xAE, 0x24, 0xD8,
+    0xC9, 0xDD, 0x06, 0xCE, 0x99, 0x0C, 0x28, 0x16, 0xF4, 0xBB, 0xEA, 0x18, 0x1F, 0xC9, 0xAD, 0xFC,
+    0xFC, 0xA4, 0x73, 0x10, 0xAC, 0xE6, 0xD2, 0x7C, 0x30, 0x37, 0x7F, 0xC3, 0xB4, 0x6A, 0xB1, 0xB4,
+    0x42, 0x3A, 0x42, 0x76, 0x32, 0x46, 0xDB, 0x08, 0xE6, 0x18, 0x71, 0x1A, 0xA1, 0xCB, 0x0A, 0x12,
+    0x25, 0x1A, 0x4A, 0xE6, 0xAB, 0xF6, 0x65, 0x4A, 0xA7, 0x14, 0xC3, 0x91, 0xB9, 0x8B, 0x98, 0xE1,
+    0x16, 0xF2, 0x03, 0xA3, 0x45, 0x20, 0x4E, 0x8A, 0xEC, 0x51, 0x16, 0xC9, 0x53, 0x9E, 0x58, 0x05,
+    0x5F, 0x3E, 0xD9, 0xE1, 0x53, 0xF2, 0x6C, 0xEA, 0x54, 0x33, 0x3A, 0x42, 0xFB, 0x8C, 0xBD, 0x6A,
+    0xAC, 0x6F, 0xA7, 0x22, 0xB7, 0x25, 0x14, 0x68, 0xB8, 0x60, 0x64, 0xBD, 0x80, 0x00, 0x30, 0x4B,
+    0x44, 0x35, 0x43, 0x3D, 0xA3, 0x96, 0xA2, 0xEE, 0xA4, 0xBA, 0x3F, 0x9E, 0xE2, 0xE5, 0xEC, 0x06,
+    0x02, 0xF7, 0xFE, 0x44, 0x64, 0x77, 0xB9, 0xBC, 0x95, 0x33, 0x24, 0x74, 0x04, 0xA2, 0xC2, 0x45,
+    0x48, 0x38, 0x12, 0x4F, 0x2A, 0x6F, 0x43, 0xC2, 0x30, 0x13, 0x15, 0x1A, 0xA5, 0x7E, 0xD1, 0x6A,
+    0xD4, 0x36, 0x24, 0x64, 0x4E, 0xE3, 0x00, 0x6C, 0x2D, 0x61, 0x06, 0xBB, 0xE0, 0xF9, 0xDC, 0x21,
+    0x72, 0x4C, 0x2E, 0x28, 0xEB, 0xAD, 0xE7, 0xD5, 0xB5, 0x5C, 0xD0, 0xA9, 0xC2, 0x33, 0x48, 0xE0,
+    0x77, 0x1A, 0x86, 0xA9, 0xA8, 0x57, 0x0D, 0xF3, 0x37, 0xAD, 0x13, 0x2A, 0x5E, 0xE8, 0xC5, 0x04,
+    0x5C, 0x46, 0xC6, 0x1A, 0x3E, 0x39, 0x1A, 0x64, 0x7C, 0x9E, 0xF5, 0xCE, 0xEC, 0x39, 0x16, 0xC4,
+    0xDB, 0xE6, 0x8E, 0x70, 0x84, 0x68, 0xE3, 0x55, 0x9A, 0x33, 0x1C, 0xA8, 0xA0, 0xEC, 0xEA, 0xBE,
+    0xA7, 0x8E, 0x34, 0xD5, 0x3B, 0x2B, 0xE9, 0x6D, 0x42, 0xAD, 0xF7, 0x3D, 0xBE, 0x63, 0xE2, 0xE0,
+    0x7E, 0x93, 0xEF, 0x06, 0xEF, 0x37, 0xE5, 0xE5, 0x70, 0xFE, 0x6F, 0x35, 0x1C, 0x50, 0x21, 0x0B,
+    0x7C, 0x19, 0xB1, 0x47, 0x9C, 0x88, 0xF7, 0x31, 0x81, 0xFB, 0x75, 0x00, 0x28, 0x97, 0x18, 0xA3,
+    0x56, 0xE2, 0x2D, 0x64, 0x64, 0xE1, 0xAF, 0x1A, 0xB0, 0x16, 0x80, 0xB5, 0x90, 0xAC, 0xA5, 0x8F,
+    0xDF, 0x09, 0xAF, 0xDB, 0x89, 0x19, 0x77, 0x62, 0x67, 0xB0, 0x13, 0xA1, 0xEE, 0x44, 0x86, 0x9D,
+    0xF0, 0xC5, 0xA1, 0x91, 0x9D, 0x28, 0x06, 0x3B, 0x81, 0x5D, 0x4B, 0x8D, 0xEE, 0xC4, 0x3E, 0x77,
+    0x62, 0x8F, 0x3B, 0x11, 0x73, 0x27, 0x22, 0xEE, 0x44, 0x30, 0xD8, 0x09, 0xCD, 0xBA, 0x2A, 0xE2,
+    0x7E, 0x9F, 0x7B, 0xBD, 0xA1, 0x9D, 0x70, 0xD4, 0x71, 0x9A, 0xBA, 0xB8, 0xD0, 0xED, 0xC9, 0xAE,
+    0xAF, 0x1B, 0xF2, 0xC7, 0xA6, 0xD5, 0xC6, 0x5B, 0xC9, 0xA2, 0x23, 0x2D, 0x2E, 0xF6, 0xC5, 0x95,
+    0x79, 0xC4, 0x9B, 0x43, 0x63, 0x1E, 0x59, 0x7A, 0x61, 0x7A, 0x97, 0x41, 0x6C, 0x49, 0xBA, 0x71,
+    0x86, 0xCD, 0x04, 0x4D, 0x6B, 0x1E, 0x53, 0x5C, 0xD1, 0xE1, 0x2D, 0x19, 0x77, 0x9E, 0x3A, 0x2B,
+    0x23, 0xEC, 0x21, 0x7F, 0x8C, 0x20, 0x31, 0xC1, 0x98, 0x51, 0x4A, 0x83, 0x93, 0x61, 0x37, 0xC4,
+    0x33, 0x4C, 0xAC, 0x7F, 0x28, 0x74, 0x42, 0x14, 0xC6, 0xA4, 0x07, 0x3C, 0x39, 0x07, 0xAC, 0x8B,
+    0x1D, 0x50, 0x65, 0x1E, 0xB0, 0x79, 0x68, 0x42, 0x0B, 0x10, 0x33, 0x79, 0x2D, 0x3B, 0x29, 0x02,
+    0x2D, 0x51, 0xB7, 0x6C, 0xA6, 0xBF, 0x7A, 0xB3, 0x61, 0xAE, 0x79, 0xD9, 0x66, 0xB6, 0x6C, 0xAE,
+    0xF9, 0xD2, 0xF4, 0x03, 0x19, 0x1B, 0xFE, 0x7D, 0xD8, 0x54, 0xEB, 0x5D, 0x47, 0x29, 0x02, 0x67,
+    0x71, 0x63, 0x9B, 0x9B, 0x35, 0xE4, 0xF1, 0x00, 0x4B, 0xB6, 0x58, 0x45, 0x49, 0xEB, 0xA7, 0x90,
+    0x8C, 0x2D, 0x19, 0xAB, 0xF1, 0x1A, 0x2B, 0x74, 0x22, 0x69, 0x71, 0x02, 0xF9, 0x7A, 0x20, 0xE7,
+    0x03, 0x65, 0x3B, 0xDB, 0xF7, 0xE9, 0xD8, 0xC4, 0xF5, 0xCB, 0x6C, 0x2E, 0x84, 0xE6, 0x08, 0xBF,
+    0x24, 0xA2, 0x64, 0xCB, 0xF9, 0x95, 0x79, 0x26, 0x70, 0x43, 0xDB, 0x10, 0x32, 0x51, 0x62, 0xD4,
+    0x2B, 0xEB, 0xD7, 0x6F, 0x14, 0xC1, 0x4E, 0x1B, 0x41, 0xF3, 0x02, 0x13, 0x96, 0x13, 0x9E, 0x8F,
+    0x1A, 0x2E, 0x8A, 0xBB, 0xD8, 0xA1, 0xE3, 0x02, 0xF9, 0xFB, 0x33, 0x27, 0x7F, 0x16, 0x70, 0x34,
+    0x97, 0xDE, 0x95, 0x33, 0x13, 0xFD, 0x48, 0xE0, 0xDB, 0xC3, 0xC4, 0x25, 0x72, 0xD8, 0xF9, 0x2E,
+    0x42, 0x9C, 0xE2, 0xA9, 0x82, 0x69, 0x31, 0x6A, 0x9A, 0x66, 0x05, 0x90, 0xF0, 0x12, 0x1D, 0xFE,
+    0x14, 0x0C, 0xCF, 0x53, 0x1C, 0x78, 0x67, 0xA9, 0xCE, 0xAE, 0x16, 0xC6, 0x65, 0x6E, 0x8F, 0x3D,
+    0xC6, 0xD4, 0x4E, 0x82, 0x15, 0x78, 0x8F, 0x13, 0x7D, 0x11, 0x80, 0xBE, 0x10, 0xB7, 0x94, 0x25,
+    0x78, 0xE0, 0x85, 0xEE, 0xA1, 0x03, 0xB5, 0x7C, 0xFD, 0xCB, 0x58, 0x5F, 0x66, 0xA6, 0xED, 0x6F,
+    0x6A, 0x95, 0x0D, 0xF5, 0x38, 0x6A, 0xDD, 0xD4, 0x3A, 0xFE, 0xEA, 0xE6, 0x6A, 0xFA, 0x21, 0xAB,
+    0x44, 0xC0, 0x2E, 0xD2, 0x74, 0xBC, 0x35, 0xB5, 0x3D, 0x36, 0x9E, 0x16, 0xD5, 0x23, 0xD6, 0xD5,
+    0xEB, 0xF9, 0xCD, 0x0A, 0x9D, 0x48, 0x95, 0xA9, 0x81, 0x91, 0x28, 0x7F, 0xA0, 0x94, 0x39, 0x15,
+    0x70, 0x42, 0x99, 0x5D, 0x26, 0x79, 0x6D, 0x5E, 0xC4, 0xDA, 0xD1, 0x44, 0x06, 0x1F, 0x10, 0x34,
+    0x2D, 0xB9, 0xCF, 0xD5, 0xB9, 0x6D, 0xC8, 0x92, 0xCB, 0x97, 0x84, 0xF0, 0x0B, 0x72, 0x9F, 0x3E,
+    0xB8, 0x92, 0x0A, 0x76, 0x02, 0x50, 0xEA, 0x34, 0x25, 0xFB, 0x15, 0xDA, 0x30, 0xDD, 0x5C, 0xBA,
+    0xDD, 0x3A, 0x70, 0x71, 0xE7, 0xC0, 0x2D, 0xD6, 0x1D, 0x38, 0x6E, 0xFE, 0x6D, 0x4C, 0xB8, 0x32,
+    0x6D, 0x5B, 0x42, 0x98, 0x0B, 0x08, 0x22, 0x28, 0xB3, 0x81, 0xAD, 0x1A, 0xC1, 0x56, 0x79, 0x05,
+    0x4A, 0x34, 0x48, 0x3D, 0xC5, 0xE9, 0xE8, 0x9B, 0xB7, 0x1A, 0x94, 0x07, 0x90, 0xF5, 0x95, 0x9D,
+    0xF3, 0xF3, 0x08, 0x58, 0xD3, 0x0F, 0xA6, 0x27, 0x2C, 0xEB, 0x0C, 0x13, 0x66, 0xE8, 0x46, 0xA5,
+    0xDD, 0x6B, 0x9B, 0xDD, 0x5A, 0x76, 0xB9, 0x07, 0x51, 0x74, 0x68, 0x2B, 0xF3, 0x6C, 0xBB, 0xE0,
+    0x4E, 0xEB, 0xB6, 0x58, 0xF3, 0x21, 0x8E, 0xC0, 0xBE, 0x18, 0xBC, 0xE5, 0xE1, 0x6D, 0xC3, 0xAE,
+    0x05, 0x6E, 0x39, 0xBF, 0x31, 0x2A, 0x1F, 0x9F, 0x85, 0x1C, 0x64, 0x70, 0xCF, 0x6A, 0x7D, 0x27,
+    0x4B, 0x54, 0xA8, 0xC4, 0xDC, 0x97, 0xE5, 0xF9, 0x9F, 0x08, 0x09, 0x3E, 0xFF, 0x50, 0xC8, 0xB2,
+    0xCD, 0x67, 0x85, 0x79, 0xB7, 0x87, 0x6B, 0x89, 0x25, 0xCD, 0x58, 0x1D, 0xD7, 0x39, 0xD2, 0x67,
+    0xAC, 0xFA, 0x9F, 0xBE, 0x14, 0xB9, 0xE1, 0x2A, 0x5E, 0x6E, 0xBB, 0x58, 0x7E, 0x6C, 0xCC, 0x3D,
+    0x40, 0xBA, 0xC3, 0xA0, 0x0E, 0x92, 0x14, 0x54, 0xEB, 0x6E, 0xD6, 0x19, 0xC2, 0x89, 0x2E, 0x16,
+    0x71, 0x59, 0x64, 0xD9, 0xA3, 0xDF, 0x20, 0xD6, 0xA5, 0xCA, 0x62, 0xFB, 0xDF, 0xC1, 0xDA, 0x32,
+    0x21, 0x36, 0x94, 0x1B, 0x0A, 0x8E, 0xD1, 0xC7, 0x8C, 0xCA, 0x0E, 0x85, 0x67, 0x90, 0x50, 0x3C,
+    0x41, 0xCD, 0x28, 0x1A, 0xBA, 0xC8, 0x8C, 0x88, 0xE2, 0x76, 0x4E, 0xC2, 0xAD, 0xDF, 0x5E, 0x33,
+    0x33, 0x0E, 0x9A, 0x18, 0x02, 0xF6, 0xF9, 0x1C, 0xCE, 0x53, 0x39, 0xBD, 0x4E, 0xA2, 0xDB, 0xD3,
+    0x67, 0x4D, 0xBB, 0xFF, 0xD5, 0x15, 0xC4, 0x74, 0x29, 0x97, 0x5A, 0x17, 0x86, 0xFE, 0x61, 0xDE,
+    0xA0, 0x6C, 0xDD, 0xCE, 0xFE, 0x71, 0x12, 0x79, 0xEF, 0x39, 0x00, 0x3E, 0xBE, 0x31, 0xCF, 0xA1,
+    0x1F, 0x25, 0x54, 0xA5, 0xDE, 0xBC, 0xA1, 0xA9, 0xD0, 0xBB, 0x7D, 0x03, 0x6E, 0x6C, 0xE3, 0xF8,
+    0x62, 0xB8, 0x7D, 0x89, 0x23, 0x16, 0x67, 0xF4, 0xF0, 0xAD, 0x0C, 0xC6, 0x05, 0xEB, 0x86, 0xC2,
+    0xC4, 0x19, 0x64, 0xD7, 0x31, 0xF0, 0x8A, 0x10, 0xF7, 0x2F, 0x6D, 0xEF, 0x73, 0xDF, 0xC0, 0x5B,
+    0xCA, 0x7B, 0xD8, 0xC1, 0x09, 0x9E, 0x79, 0xA3, 0x4F, 0xBB, 0x96, 0xEB, 0x69, 0xD7, 0x10, 0x0A,
+    0x66, 0x0D, 0x91, 0xB3, 0x05, 0xE4, 0x6D, 0x79, 0x6A, 0xA5, 0x5E, 0x21, 0xAE, 0x67, 0xA0, 0xE9,
+    0x7E, 0xD8, 0x73, 0xFF, 0x44, 0x01, 0x39, 0xCB, 0xD5, 0xFE, 0xAC, 0xCB, 0x2A, 0x4C, 0x3A, 0xA5,
+    0xE3, 0xB5, 0x12, 0x4D, 0x9F, 0xD8, 0xAB, 0x9E, 0xF4, 0xA2, 0x3F, 0x52, 0x4D, 0xE6, 0x56, 0x56,
+    0x2B, 0x5D, 0x53, 0x1D, 0x87, 0xE2, 0x6D, 0x54, 0xB0, 0x59, 0xD4, 0x69, 0x5B, 0xE3, 0xF6, 0xD7,
+    0x5B, 0xE3, 0x82, 0xFC, 0xDC, 0x1C, 0x99, 0x97, 0xC4, 0xF5, 0xBD, 0x86, 0x16, 0x84, 0xF7, 0x0A,
+    0x7A, 0x35, 0x40, 0x60, 0xD8, 0x7C, 0xFF, 0x04, 0x25, 0x04, 0x45, 0xFF, 0x1C, 0x2E, 0x03, 0xBA,
+    0xEA, 0x9A, 0x6C, 0x2B, 0x69, 0xB8, 0x78, 0x54, 0xD2, 0x30, 0x3A, 0xAE, 0xA8, 0xB3, 0x51, 0xB7,
+    0x38, 0x22, 0x40, 0xA2, 0x06, 0x60, 0x5F, 0x84, 0xC6, 0x71, 0xF5, 0x9A, 0xF1, 0x98, 0xF4, 0xB5,
+    0xA0, 0x17, 0x29, 0x42, 0x4C, 0x92, 0x5E, 0x69, 0xEA, 0x49, 0x53, 0x7F, 0xF7, 0x9B, 0x37, 0xB6,
+    0x33, 0xAB, 0xE1, 0x7A, 0x66, 0x95, 0xEE, 0x8B, 0xC0, 0x24, 0x4E, 0x1C, 0x8A, 0x99, 0x72, 0xF6,
+    0x65, 0x77, 0x61, 0x82, 0x98, 0x98, 0x15, 0xF7, 0x16, 0x7E, 0xEE, 0x4B, 0x08, 0x2F, 0x76, 0x90,
+    0x37, 0x09, 0xFF, 0x1E, 0x26, 0xBB, 0x0B, 0xD2, 0xDC, 0x72, 0xD3, 0xDF, 0x4B, 0xE6, 0x20, 0xEC,
+    0x8B, 0x38, 0x71, 0x1D, 0x69, 0xDC, 0xDD, 0x6A, 0x98, 0x3D, 0x0A, 0x88, 0x63, 0x61, 0xD6, 0xD4,
+    0xB9, 0x67, 0xF3, 0x82, 0xB2, 0xBA, 0x17, 0x45, 0x8E, 0xAF, 0xBF, 0xD3, 0xE5, 0x43, 0x05, 0x0D,
+    0x36, 0xB7, 0x0B, 0x1E, 0x5B, 0x39, 0xD6, 0x63, 0x73, 0xA1, 0xED, 0xEF, 0x6B, 0x10, 0x22, 0xAC,
+    0x59, 0x1D, 0xC5, 0xC7, 0x48, 0x81, 0xB7, 0xCD, 0xDE, 0x85, 0x7F, 0xFC, 0x0C, 0xCD, 0x3B, 0x6D,
+    0xFF, 0xE8, 0xC0, 0x17, 0xF8, 0x36, 0x52, 0x60, 0x3C, 0x04, 0x0F, 0x7D, 0xDE, 0xF7, 0xA2, 0x00,
+    0x2C, 0xBC, 0x98, 0x0B, 0xCB, 0x1B, 0x6B, 0x45, 0xF2, 0xBF, 0x3D, 0xBC, 0xC3, 0x86, 0x50, 0xBC,
+    0x1E, 0x55, 0x24, 0xE7, 0x6F, 0x2E, 0x56, 0x1C, 0xBC, 0x83, 0x9D, 0xCB, 0x1A, 0xF8, 0xFF, 0x09,
+    0xCF, 0x25, 0x54, 0x50, 0xB3, 0xC2, 0x50, 0x05, 0x8A, 0x8C, 0x4E, 0xE6, 0xA7, 0xEB, 0x61, 0x4F,
+    0xCD, 0x64, 0x19, 0xCB, 0xB2, 0x98, 0x2D, 0x4A, 0xC0, 0x61, 0xB4, 0x75, 0x0F, 0x63, 0x4C, 0x3A,
+    0x1B, 0x14, 0x64, 0xDB, 0xB2, 0xAC, 0xE0, 0x8C, 0xFB, 0x81, 0x09, 0x96, 0x16, 0x19, 0x5B, 0x01,
+    0xEE, 0xEA, 0xC0, 0xE3, 0x41, 0xAF, 0xD0, 0x98, 0x69, 0x0A, 0xDB, 0xEF, 0x9F, 0xC2, 0x0F, 0x08,
+    0xBF, 0x41, 0xAD, 0xD6, 0xE7, 0xF5, 0x43, 0x47, 0xAF, 0x0F, 0x38, 0x89, 0x4D, 0x21, 0xE1, 0xE8,
+    0xBB, 0x22, 0xE0, 0xCD, 0x57, 0x42, 0xBC, 0x06, 0xA7, 0xE1, 0x83, 0xF5, 0x9C, 0x9F, 0xAF, 0xD9,
+    0x8A, 0x96, 0x84, 0x29, 0xF2, 0x16, 0x89, 0x4C, 0x17, 0x75, 0x29, 0x8B, 0x58, 0x53, 0x16, 0x21,
+    0x53, 0x16, 0x9A, 0x43, 0x72, 0x40, 0x46, 0x70, 0x69, 0xBA, 0x7B, 0x75, 0xEF, 0x1E, 0xDA, 0x7B,
+    0x75, 0x3E, 0x2F, 0x13, 0x68, 0xF4, 0xF0, 0xCA, 0xF4, 0x36, 0x4F, 0x40, 0x41, 0x9A, 0x3F, 0x0B,
+    0xA8, 0x1D, 0x77, 0xA7, 0xF6, 0xD4, 0xB1, 0x7A, 0x09, 0xDE, 0xAA, 0xD9, 0x45, 0x51, 0xC8, 0xC4,
+    0xBF, 0xE4, 0xD5, 0x27, 0xDA, 0x01, 0xB6, 0x06, 0x3D, 0x03, 0xB8, 0xE1, 0x0A, 0x2E, 0x6F, 0xE0,
+    0xF2, 0x02, 0xAE, 0x06, 0xBE, 0x6B, 0xD7, 0x6F, 0x4F, 0x1D, 0x41, 0x1B, 0x15, 0x70, 0xD7, 0x82,
+    0x5F, 0x82, 0xAB, 0x17, 0x47, 0x29, 0x29, 0xF4, 0xE1, 0x55, 0x06, 0x89, 0x01, 0xFB, 0x2E, 0x9D,
+    0x7B, 0xCF, 0x04, 0xA6, 0xB6, 0x62, 0x08, 0x59, 0x38, 0x2C, 0xA1, 0x7E, 0x44, 0x13, 0x39, 0x39,
+    0xD4, 0xD1, 0xE2, 0x9D, 0xB6, 0xE3, 0xE1, 0x4A, 0xFA, 0x54, 0x21, 0xFE, 0xC9, 0xC5, 0xB4, 0x4F,
+    0x05, 0xC5, 0x74, 0xC8, 0xE8, 0x01, 0xF1, 0x06, 0xC3, 0x0F, 0xBD, 0x67, 0x43, 0x31, 0xBA, 0xB7,
+    0xC5, 0x85, 0x0E, 0xEE, 0xD7, 0x6D, 0x56, 0xC8, 0xB7, 0x59, 0x21, 0x37, 0xFD, 0xE1, 0x53, 0x04,
+    0xF3, 0xBC, 0x81, 0xA3, 0x51, 0x31, 0xEF, 0x9E, 0xE8, 0x8D, 0x6C, 0x5B, 0xD1, 0xDB, 0x35, 0xDD,
+    0xA5, 0x6C, 0xF5, 0x81, 0x4F, 0x1F, 0x9E, 0x13, 0x5F, 0xCA, 0xBE, 0x64, 0xFF, 0x33, 0xB2, 0xB6,
+    0x65, 0xAE, 0x61, 0x90, 0x5B, 0x56, 0xB6, 0x8E, 0xA4, 0xCC, 0x5F, 0xB5, 0x65, 0xAC, 0xCD, 0x4E,
+    0x25, 0x56, 0x06, 0x6C, 0x42, 0x6A, 0x62, 0x33, 0x52, 0xC8, 0xE6, 0x21, 0x25, 0xC5, 0xAB, 0xE3,
+    0x5F, 0x01, 0xDB, 0x1D, 0xE3, 0x7F, 0x8E, 0x50, 0x7E, 0xC7, 0x04, 0xEF, 0xA3, 0x05, 0x65, 0xC7,
+    0x84, 0x81, 0x5E, 0x3D, 0x8F, 0x03, 0x6D, 0x63, 0xDE, 0x0B, 0x12, 0x7A, 0x8D, 0xB5, 0xBE, 0x3A,
+    0x65, 0x90, 0x8A, 0xF3, 0x12, 0xA3, 0x6E, 0x84, 0x6B, 0x85, 0xA3, 0x3C, 0x78, 0xB7, 0xE4, 0x35,
+    0xFA, 0xE0, 0x5F, 0xB0, 0xAF, 0x41, 0x1A, 0xBC, 0x87, 0xCE, 0xCF, 0x48, 0x6F, 0x4D, 0x47, 0x32,
+    0xC1, 0xA7, 0x48, 0xF2, 0xEC, 0xCA, 0x44, 0x86, 0xAE, 0x37, 0x0A, 0x0D, 0xA8, 0xB9, 0xF8, 0xF5,
+    0xF0, 0x35, 0xC7, 0x35, 0x43, 0x6E, 0xA5, 0x67, 0xC3, 0xBD, 0xB7, 0x75, 0x2B, 0x56, 0x36, 0x49,
+    0xA7, 0x2D, 0x41, 0xFC, 0xE7, 0x0B, 0xCC, 0xDE, 0x88, 0x98, 0x14, 0xA6, 0xD8, 0x5C, 0xF7, 0x8E,
+    0x76, 0x7E, 0xC4, 0x8C, 0x1F, 0xB0, 0x4D, 0x0B, 0x26, 0x54, 0xAF, 0x95, 0xDC, 0x9E, 0x57, 0x4B,
+    0x17, 0xDB, 0xB2, 0x5F, 0x52, 0x92, 0xCA, 0xD2, 0xE7, 0xB5, 0xE9, 0x12, 0xEB, 0x1D, 0x15, 0x15,
+    0xBC, 0x64, 0x2F, 0xAB, 0x80, 0x5B, 0x90, 0xA2, 0x5B, 0x27, 0x0A, 0x51, 0x35, 0xC3, 0x1A, 0xEE,
+    0x41, 0x88, 0xAF, 0x9B, 0x5F, 0xA1, 0x43, 0xF7, 0x9E, 0xF9, 0xB5, 0x4C, 0x1B, 0x96, 0x66, 0x9E,
+    0x33, 0x3C, 0x42, 0x61, 0x2E, 0xCC, 0x79, 0xE9, 0xD3, 0x5E, 0x1C, 0x5F, 0xB5, 0x0C, 0x93, 0x5D,
+    0x32, 0xBB, 0x58, 0x63, 0x75, 0x1F, 0x07, 0x63, 0x66, 0xF3, 0xAC, 0xCB, 0x4E, 0x6E, 0x16, 0x5A,
+    0xE2, 0x0A, 0xD3, 0x30, 0x6D, 0xDB, 0x5A, 0xF0, 0xEF, 0x4D, 0xDC, 0x97, 0xC9, 0xBD, 0xDF, 0xC2,
+    0x8D, 0xFD, 0x32, 0xB7, 0x11, 0x94, 0x5E, 0xAF, 0x5D, 0x7E, 0xDB, 0x9E, 0x06, 0x7B, 0x6B, 0xBC,
+    0xED, 0xD0, 0xA7, 0x0D, 0x0E, 0x3E, 0x61, 0xBE, 0x8A, 0x49, 0xA8, 0x8F, 0x06, 0xF7, 0xC7, 0x15,
+    0xEF, 0xD4, 0xF6, 0x66, 0x44, 0xED, 0x8D, 0x4C, 0xA1, 0x88, 0xFE, 0x32, 0x44, 0x6A, 0x3C, 0x23,
+    0xAC, 0x55, 0x61, 0x26, 0xCC, 0x30, 0x2A, 0xA0, 0x3D, 0x47, 0xD4, 0x9E, 0xA3, 0xC5, 0xB8, 0xAB,
+    0x61, 0xBA, 0x5F, 0x83, 0x39, 0xE7, 0x77, 0x0C, 0x6F, 0x7E, 0xCF, 0xCD, 0x63, 0xB7, 0xAE, 0x86,
+    0x87, 0x66, 0x65, 0x3A, 0x4F, 0x58, 0x63, 0x39, 0xF5, 0x80, 0x59, 0xBC, 0xD3, 0xD2, 0xD5, 0xF7,
+    0xE6, 0x3C, 0xA8, 0x5C, 0x71, 0x5C, 0xD8, 0xBA, 0x2D, 0xBC, 0x77, 0xF0, 0x1D, 0xE3, 0xF1, 0x1F,
+    0xB8, 0x5B, 0x17, 0x25, 0xCE, 0x10, 0x66, 0xFE, 0x8B, 0x0A, 0xB6, 0x91, 0x40, 0xA3, 0xE7, 0x28,
+    0xE9, 0x12, 0x81, 0x5B, 0x62, 0x1B, 0x30, 0x7A, 0x52, 0x1A, 0x36, 0x9A, 0x16, 0x76, 0xB7, 0xEE,
+    0x4F, 0xC4, 0x69, 0x17, 0x36, 0x39, 0xC7, 0x7C, 0x38, 0xEF, 0x3F, 0x1C, 0x3D, 0xF2, 0xC3, 0x21,
+    0x63, 0x5F, 0x4C, 0xA7, 0xCC, 0x0F, 0x36, 0xA4, 0xAB, 0xFE, 0xBA, 0xC1, 0xAA, 0xED, 0xAF, 0xF6,
+    0xBA, 0x7F, 0xCE, 0xE2, 0x07, 0xEB, 0x35, 0x11, 0xB8, 0x91, 0x24, 0x7F, 0xFE, 0x66, 0x97, 0xAC,
+    0xE3, 0xAE, 0x31, 0xFC, 0xED, 0x3B, 0x11, 0xCA, 0x76, 0xB6, 0xEE, 0x7D, 0xA7, 0x4B, 0x70, 0xF7,
+    0xEF, 0xF3, 0x9E, 0xF0, 0x44, 0x35, 0xB6, 0x4D, 0x74, 0x6A, 0xBA, 0x70, 0x35, 0x68, 0x70, 0x33,
+    0xE7, 0x1D, 0xBB, 0x8B, 0x56, 0x66, 0xA3, 0xAC, 0xED, 0x1E, 0x59, 0xC3, 0x0B, 0xBF, 0x44, 0x0B,
+    0xE3, 0x68, 0xC9, 0xA8, 0x6F, 0x0E, 0x6B, 0xFF, 0x7D, 0x0B, 0x7D, 0xCB, 0xB1, 0xFD, 0x62, 0xED,
+    0x5B, 0xC0, 0x47, 0xE1, 0x79, 0x9E, 0xD7, 0xEE, 0x43, 0x82, 0xEB, 0x7F, 0xD2, 0x5F, 0xBB, 0x77,
+    0x1B, 0x73, 0xD4, 0x3F, 0xCF, 0x70, 0xDE, 0x30, 0x72, 0x13, 0x37, 0x31, 0xA3, 0x3C, 0x42, 0x9F,
+    0x58, 0xDD, 0x76, 0x38, 0x4C, 0xB2, 0xEE, 0x94, 0x3C, 0x0D, 0xF9, 0xBA, 0x00, 0x47, 0x65, 0x82,
+    0x84, 0x6B, 0x63, 0x91, 0xB7, 0xC7, 0xF8, 0x84, 0xE9, 0x8B, 0x47, 0xB6, 0xC1, 0xFE, 0x81, 0x4D,
+    0xB6, 0xC0, 0xFE, 0xFB, 0xAC, 0x62, 0x95, 0xAD, 0x73, 0xFC, 0xFF, 0xED, 0x5B, 0x3F, 0x8C, 0xE4,
+    0xE6, 0x75, 0xFF, 0x48, 0x4A, 0x4B, 0x78, 0x89, 0x88, 0x2A, 0x2C, 0xC4, 0xD1, 0x41, 0x62, 0x0A,
+    0x23, 0xB0, 0x0F, 0x96, 0xD8, 0xA4, 0x09, 0x70, 0xB7, 0xA4, 0xAD, 0xD2, 0x85, 0x54, 0xE8, 0x72,
+    0x85, 0x0A, 0xBB, 0x0B, 0x6C, 0x20, 0x59, 0x17, 0x2E, 0x52, 0xDC, 0xCE, 0xF0, 0xAC, 0xC2, 0x65,
+    0xB6, 0x89, 0xEB, 0x2B, 0x54, 0x9C, 0x47, 0x85, 0x5D, 0xB8, 0x30, 0x90, 0x99, 0x1D, 0xCA, 0x2E,
+    0x54, 0xB8, 0x10, 0x11, 0xC0, 0x55, 0x8A, 0xD0, 0xCE, 0x19, 0x06, 0x9C, 0xE2, 0x28, 0x64, 0x04,
+    0xF3, 0xCE, 0xE4, 0x30, 0xEF, 0xF7, 0x7B, 0x1F, 0xC9, 0xE1, 0xDC, 0x9E, 0xA0, 0x00, 0xD6, 0xDE,
+    0x2E, 0x90, 0xB9, 0x9B, 0xEF, 0xE3, 0xCE, 0x0C, 0xBF, 0xEF, 0xBD, 0xF7, 0xBD, 0xFF, 0xEF, 0xD1,
+    0x18, 0x79, 0x39, 0x6F, 0x61, 0x34, 0x41, 0x69, 0xCC, 0x7C, 0x9B, 0x86, 0x85, 0xF1, 0xBB, 0xAE,
+    0x8C, 0x72, 0x13, 0x3F, 0x3E, 0x6E, 0x12, 0x63, 0xD6, 0x99, 0xD3, 0x35, 0xC6, 0x69, 0xE5, 0xDB,
+    0xD2, 0x78, 0x1B, 0x63, 0x92, 0x94, 0xBF, 0x8D, 0x33, 0x13, 0xE6, 0xC6, 0xE0, 0x87, 0x99, 0xC1,
+    0xA5, 0x7C, 0xCE, 0xC9, 0x70, 0x9A, 0x1B, 0x7E, 0x37, 0xD3, 0xE9, 0xCC, 0xF0, 0x06, 0x4C, 0xF2,
+    0x33, 0x4C, 0xF2, 0x3D, 0xA6, 0x35, 0xAF, 0x8C, 0xAC, 0x2E, 0xF7, 0x79, 0x8D, 0x4C, 0xB9, 0x09,
+    0x2A, 0xB9, 0xA7, 0x34, 0x49, 0x21, 0x40, 0x6D, 0xFF, 0xBE, 0x93, 0xD5, 0xDD, 0xAE, 0x6B, 0x01,
+    0x63, 0xDC, 0x15, 0x84, 0xF5, 0x6D, 0x63, 0x5F, 0x87, 0x99, 0xD1, 0x0D, 0x74, 0x7D, 0xBF, 0xCB,
+    0x64, 0x99, 0x79, 0x57, 0xB5, 0xC6, 0xE9, 0x6E, 0x77, 0x1B, 0xE3, 0xD5, 0x66, 0x4D, 0x70, 0x93,
+    0x1E, 0xB6, 0x38, 0xC5, 0xB8, 0xFB, 0x7F, 0xD6, 0x8F, 0xFA, 0x7F, 0xC5, 0x11, 0x90, 0x18, 0xB7,
+    0x06, 0xB8, 0x3E, 0xC0, 0x79, 0x70, 0x0C, 0x68, 0xBA, 0x4E, 0x70, 0x74, 0xBA, 0x9A, 0x64, 0x33,
+    0xC3, 0x4B, 0xC1, 0x71, 0x1B, 0xDC, 0x15, 0xBE, 0xBB, 0xC1, 0x14, 0xFD, 0xB0, 0x72, 0xE4, 0x67,
+    0xF1, 0x9B, 0xB9, 0xBB, 0x01, 0xDC, 0xA9, 0x27, 0xAB, 0x24, 0xB5, 0xE1, 0x94, 0x1A, 0xBF, 0xE4,
+    0x2E, 0x98, 0x64, 0xBF, 0xA0, 0xE0, 0x86, 0x20, 0xE7, 0x38, 0x45, 0x99, 0xE1, 0x0A, 0xA9, 0xE1,
+    0x0A, 0x46, 0x6F, 0x1D, 0x26, 0xBB, 0x02, 0x6E, 0x9D, 0xE9, 0x3D, 0x33, 0x25, 0x44, 0xC2, 0x0D,
+    0x4C, 0x92, 0x99, 0x0E, 0xA4, 0xF9, 0xE4, 0x9D, 0xC6, 0x10, 0xF2, 0x0A, 0x30, 0x13, 0x81, 0xE1,
+    0xC8, 0xF1, 0xFA, 0x0E, 0x47, 0x52, 0xD7, 0x34, 0xCE, 0xC6, 0x04, 0xBF, 0xD8, 0xC8, 0x0E, 0xE1,
+    0xAF, 0x4A, 0x8C, 0x5D, 0x26, 0x63, 0x54, 0x63, 0xB3, 0x28, 0xC5, 0x5E, 0x71, 0x4F, 0x46, 0x1D,
+    0x05, 0x46, 0xEC, 0x9A, 0x02, 0x09, 0x01, 0x94, 0x44, 0x73, 0x38, 0x7A, 0x20, 0x9D, 0x09, 0xC0,
+    0x2E, 0x26, 0xC6, 0x78, 0xF7, 0x31, 0xC8, 0xD8, 0xFD, 0xB6, 0x02, 0x30, 0x6F, 0x08, 0xF0, 0x66,
+    0x84, 0xC1, 0x98, 0xBF, 0x92, 0x7F, 0xF6, 0x15, 0xA6, 0xCB, 0xFE, 0x32, 0xF8, 0x65, 0xD5, 0x5F,
+    0x7A, 0x5D, 0xDE, 0x5F, 0x3A, 0xDD, 0x78, 0x5F, 0x6B, 0x9E, 0xF6, 0x8A, 0xBB, 0xF7, 0x88, 0xB6,
+    0xFC, 0x38, 0x01, 0xD6, 0x61, 0x7F, 0x59, 0xDA, 0xCB, 0x19, 0x10, 0x33, 0x04, 0x77, 0x85, 0xB3,
+    0x33, 0x64, 0x6E, 0x41, 0x64, 0x0B, 0x20, 0x4A, 0x9E, 0x01, 0x58, 0x33, 0xCE, 0x2D, 0x37, 0xF0,
+    0x4F, 0x87, 0x78, 0xF1, 0x2E, 0x77, 0xA3, 0xE7, 0xB1, 0x19, 0xCE, 0x04, 0x77, 0xD9, 0x4B, 0xDC,
+    0x65, 0x2F, 0xB1, 0x08, 0x4E, 0x6B, 0xAE, 0xE0, 0xE2, 0xC4, 0xCE, 0x78, 0x97, 0x3D, 0x69, 0x08,
+    0x13, 0x2E, 0x05, 0x06, 0xDC, 0x05, 0xA2, 0xFA, 0x1B, 0xDE, 0x05, 0xCA, 0xCA, 0x9A, 0xCA, 0xFA,
+    0xA9, 0x99, 0xE7, 0x1E, 0x39, 0x2F, 0x31, 0x07, 0x9D, 0xDE, 0x65, 0x92, 0xC5, 0xBA, 0x36, 0xD1,
+    0x1F, 0x16, 0x0B, 0x70, 0xBD, 0x08, 0x47, 0x42, 0xD4, 0xD6, 0xDD, 0x03, 0x63, 0x2F, 0xF5, 0xE5,
+    0xA6, 0x6E, 0x66, 0xE9, 0x58, 0xCA, 0x9A, 0xA4, 0x8D, 0xD9, 0xAC, 0x2C, 0x69, 0xCC, 0x7A, 0x63,
+    0x29, 0x43, 0x99, 0x53, 0xC2, 0x40, 0xA8, 0x2D, 0x5D, 0xCC, 0x40, 0x16, 0x63, 0xA9, 0x92, 0x74,
+    0x5B, 0x4B, 0x94, 0xB9, 0x5C, 0x29, 0x4D, 0x5E, 0xBA, 0xD5, 0xF6, 0x24, 0x71, 0xEB, 0x1E, 0x77,
+    0x11, 0x65, 0x7B, 0x25, 0xAC, 0x69, 0xAF, 0x92, 0x5D, 0x72, 0x8C, 0xD4, 0x18, 0x89, 0xA1, 0xB4,
+    0x00, 0x2F, 0x2B, 0x29, 0x92, 0x81, 0x12, 0xCD, 0x40, 0x88, 0xCD, 0x84, 0x0E, 0x4A, 0x06, 0x10,
+    0xAF, 0xA7, 0x42, 0x3E, 0x10, 0x21, 0xB3, 0x22, 0x7A, 0x6A, 0xEE, 0xE1, 0xA2, 0x36, 0xB5, 0x0F,
+    0x25, 0x22, 0x40, 0xDF, 0x8C, 0x21, 0x0C, 0x02, 0x73, 0x4C, 0x0A, 0x83, 0xE1, 0x37, 0xF6, 0xC2,
+    0x2F, 0x95, 0x58, 0x96, 0x7E, 0xBE, 0xAA, 0x9D, 0x60, 0x1B, 0xE4, 0x21, 0x56, 0x4C, 0xBA, 0x8F,
+    0xF4, 0xA2, 0xBB, 0xFD, 0x30, 0x7F, 0xFE, 0xD6, 0x3C, 0x95, 0x83, 0xC1, 0x46, 0x67, 0x40, 0x78,
+    0x9E, 0x82, 0x3D, 0x54, 0x40, 0x44, 0x77, 0x08, 0x0E, 0x49, 0xAF, 0x1F, 0x55, 0x36, 0x55, 0xDB,
+    0x9C, 0x91, 0x12, 0x2B, 0x2A, 0x19, 0x2A, 0x1C, 0xE8, 0x99, 0x99, 0xBD, 0x55, 0x2E, 0x64, 0x49,
+    0xC8, 0xF1, 0x0C, 0x42, 0xD4, 0x1A, 0x95, 0x23, 0xFC, 0xD6, 0x24, 0x1F, 0x3C, 0xAE, 0xF0, 0x5B,
+    0x4A, 0x53, 0x08, 0xC1, 0xF6, 0x45, 0xA0, 0x42, 0x9E, 0xDF, 0x8B, 0x03, 0xFB, 0xEB, 0x3B, 0x31,
+    0x3D, 0xC9, 0xED, 0xAE, 0x56, 0xC3, 0xE1, 0xBD, 0xD4, 0xD3, 0x6C, 0x76, 0x27, 0x1C, 0xA5, 0xBC,
+    0x71, 0x8E, 0xF2, 0xC6, 0x81, 0x79, 0xD5, 0x30, 0x95, 0xA4, 0x08, 0x48, 0x23, 0x6F, 0x1C, 0x9C,
+    0xBC, 0x01, 0xAB, 0xBC, 0xED, 0x24, 0xB8, 0xE2, 0x2D, 0x87, 0x85, 0x63, 0x8A, 0xD3, 0x5E, 0xDD,
+    0x12, 0x86, 0xC5, 0x42, 0x95, 0x73, 0x97, 0xCF, 0xC0, 0xA2, 0x5D, 0xB6, 0x1A, 0x38, 0x6A, 0x9C,
+    0x94, 0xC3, 0x9F, 0x3F, 0xA6, 0xE0, 0x87, 0x2A, 0xF4, 0xA1, 0xB2, 0x9E, 0x93, 0xF6, 0xC8, 0x7D,
+    0x89, 0xE8, 0xCD, 0xB9, 0xF2, 0x9A, 0xE3, 0x09, 0x71, 0x53, 0xD4, 0x14, 0x33, 0x2E, 0xE8, 0x50,
+    0x17, 0xBB, 0x1B, 0xA0, 0xE5, 0x55, 0x2E, 0x25, 0x15, 0xD8, 0xF8, 0x25, 0xC7, 0x02, 0x28, 0x05,
+    0xB9, 0x4F, 0x9E, 0x03, 0x42, 0x61, 0x4E, 0x93, 0x96, 0x61, 0x8C, 0x53, 0x60, 0x13, 0x13, 0x99,
+    0x84, 0xB8, 0x1C, 0x71, 0xAB, 0x19, 0x31, 0x59, 0x11, 0x91, 0x86, 0x78, 0x28, 0xE4, 0x6A, 0x14,
+    0xC8, 0x40, 0x6E, 0x65, 0xD9, 0xC8, 0x4A, 0xBE, 0x71, 0x8F, 0x81, 0x88, 0x4F, 0x5E, 0xF4, 0xDA,
+    0x1E, 0x97, 0x30, 0x97, 0x89, 0x1B, 0xCB, 0x8E, 0xA2, 0x5B, 0xD3, 0x20, 0x27, 0x62, 0xDC, 0x46,
+    0x87, 0x19, 0x3E, 0x58, 0xE1, 0xBA, 0x91, 0xED, 0x65, 0x98, 0x61, 0xA3, 0x95, 0x22, 0xE6, 0x62,
+    0x90, 0x5D, 0x20, 0x6D, 0xF2, 0x81, 0x5F, 0xCA, 0xBE, 0x41, 0x21, 0x1F, 0x04, 0x39, 0x78, 0x19,
+    0x78, 0xD9, 0xD5, 0xB1, 0x70, 0x4A, 0x8E, 0xE4, 0x00, 0xC4, 0x88, 0xD1, 0x64, 0x27, 0xAB, 0x4E,
+    0xFF, 0x01, 0xE8, 0xAC, 0x01, 0xFB, 0x3C, 0x53, 0xAB, 0x2A, 0x1B, 0x1C, 0xC1, 0x2E, 0xCB, 0x1E,
+    0x33, 0x68, 0x08, 0xD9, 0xF7, 0xC4, 0xCC, 0xC9, 0x17, 0x2B, 0xFC, 0x52, 0xE6, 0xC6, 0xB4, 0x35,
+    0x98, 0xA3, 0x31, 0xB5, 0x30, 0x72, 0x21, 0xF4, 0xAE, 0x97, 0x02, 0x86, 0x50, 0x7E, 0x33, 0x93,
+    0x3D, 0x85, 0xF6, 0x55, 0xC2, 0xD9, 0xAB, 0x40, 0x57, 0xCC, 0x61, 0x16, 0xA7, 0x72, 0x0E, 0x65,
+    0x98, 0xC7, 0x02, 0xB5, 0x2F, 0xFF, 0xF0, 0x0B, 0x80, 0x7E, 0xC4, 0x73, 0x70, 0xAB, 0x19, 0xE8,
+    0x92, 0x39, 0xF5, 0x4A, 0x66, 0x01, 0xB9, 0x59, 0x0A, 0xCC, 0x02, 0xF5, 0xAA, 0xC1, 0x79, 0xC8,
+    0x71, 0x88, 0x80, 0x90, 0xB1, 0x00, 0x96, 0x10, 0x27, 0x02, 0x38, 0x27, 0x42, 0xD6, 0x4A, 0x18,
+    0x60, 0x49, 0xDD, 0x63, 0x59, 0xAB, 0x9F, 0x29, 0x3E, 0x86, 0x52, 0x89, 0xD7, 0x4B, 0xC7, 0xA5,
+    0x35, 0x15, 0xAA, 0x23, 0x62, 0x6B, 0x4D, 0x46, 0x46, 0x33, 0x5F, 0xB4, 0xF8, 0xAF, 0x2C, 0xFE,
+    0xAD, 0xC5, 0x7F, 0x69, 0xF1, 0x37, 0x16, 0x7F, 0x63, 0xF1, 0x37, 0x8A, 0xBF, 0x1C, 0x04, 0xF1,
+    0xC7, 0xB9, 0x10, 0xFF, 0x52, 0xF1, 0x17, 0x8E, 0x23, 0xFE, 0x38, 0x25, 0xE0, 0x8F, 0x6F, 0x80,
+    0x3F, 0xBE, 0x01, 0xFE, 0x38, 0x29, 0xE0, 0x1F, 0xA5, 0x8A, 0xBF, 0x7C, 0x43, 0xFC, 0x79, 0x64,
+    0x82, 0x3F, 0xF9, 0x70, 0xD5, 0x28, 0x5B, 0x1C, 0xD5, 0xCA, 0x19, 0x09, 0xC0, 0x51, 0xFC, 0x1B,
+    0x8B, 0x7F, 0xAD, 0xF8, 0x3B, 0x16, 0x5F, 0x77, 0x63, 0x95, 0x7F, 0x35, 0x9D, 0x7D, 0xAB, 0xDF,
+    0x42, 0x55, 0x6F, 0x07, 0x73, 0xB5, 0xB1, 0x81, 0xB5, 0x1B, 0x7E, 0xDD, 0x93, 0xE1, 0x79, 0x3B,
+    0x27, 0x7B, 0xF3, 0xD1, 0x79, 0x96, 0x57, 0xED, 0xFA, 0x1D, 0x48, 0xAD, 0x2C, 0xB0, 0x9C, 0x77,
+    0x39, 0xE0, 0x68, 0xDB, 0xE3, 0x02, 0xD2, 0xD1, 0x15, 0x21, 0xC8, 0xE3, 0x40, 0x73, 0x0B, 0x1C,
+    0x6E, 0xAB, 0x2C, 0x2B, 0xAE, 0x5F, 0x58, 0xF8, 0x74, 0x30, 0xC9, 0xB3, 0xF0, 0x3B, 0x84, 0x19,
+    0x70, 0x54, 0x31, 0xC4, 0x51, 0xD4, 0xBC, 0x90, 0x2B, 0x03, 0xA8, 0x24, 0x06, 0xF9, 0x38, 0x4E,
+    0xD5, 0xD3, 0x54, 0x4F, 0xE4, 0xCC, 0xBA, 0x77, 0x2D, 0xC0, 0x4A, 0x52, 0x25, 0x06, 0x25, 0x67,
+    0x39, 0x65, 0x83, 0x7E, 0x7E, 0x0A, 0x79, 0x5C, 0xCB, 0x16, 0xBD, 0xCB, 0xE1, 0x6E, 0x77, 0x6C,
+    0x28, 0xED, 0xA7, 0x70, 0x02, 0x15, 0xCD, 0x9A, 0x37, 0x26, 0x85, 0xE9, 0xC5, 0x69, 0xF2, 0x52,
+    0x22, 0xAD, 0xF9, 0x39, 0xDD, 0x2E, 0x8F, 0x7C, 0xE6, 0xFF, 0x27, 0xC6, 0xF0, 0x23, 0x9A, 0xFA,
+    0x7F, 0xC1, 0x98, 0x04, 0x18, 0x67, 0x1C, 0x1B, 0xA8, 0x21, 0x77, 0x03, 0x83, 0xE3, 0x55, 0x38,
+    0x9F, 0x80, 0x4A, 0x0A, 0xA2, 0x03, 0x46, 0x85, 0x17, 0x37, 0xE7, 0xB8, 0x5D, 0xBC, 0x5F, 0xC1,
+    0x58, 0xA8, 0x9A, 0x76, 0x21, 0xFE, 0x40, 0x48, 0xE8, 0x21, 0x23, 0x98, 0xB6, 0x21, 0x00, 0x0D,
+    0xBD, 0xEC, 0x86, 0xE0, 0xA7, 0xC6, 0x2B, 0x04, 0x4C, 0xA7, 0x02, 0x3D, 0xE8, 0x0F, 0xF2, 0xC0,
+    0xA7, 0x90, 0x07, 0x5B, 0x4F, 0x48, 0xDB, 0x7D, 0x98, 0xD3, 0xB6, 0xD1, 0xAE, 0xD1, 0xA6, 0xF5,
+    0x8A, 0x23, 0x51, 0x0B, 0x46, 0x6B, 0x42, 0xFB, 0x35, 0x53, 0xB5, 0xE4, 0x34, 0x6A, 0xB3, 0x68,
+    0xAF, 0xE8, 0xF3, 0x25, 0x1F, 0x6C, 0x2B, 0xF5, 0xF8, 0xFC, 0xEE, 0x1B, 0xBD, 0x6D, 0xFA, 0x82,
+    0x39, 0x14, 0x6C, 0x32, 0x39, 0x19, 0xEF, 0xDF, 0x61, 0x64, 0xE8, 0xD0, 0x93, 0x3A, 0x67, 0x7B,
+    0xEE, 0x5B, 0x01, 0xEB, 0x0D, 0x62, 0x3C, 0xEA, 0x8F, 0x88, 0xE7, 0xC3, 0x81, 0x8C, 0x4B, 0xA3,
+    0x4C, 0xA2, 0x85, 0xC3, 0x70, 0x9E, 0x66, 0x1B, 0xD5, 0xDB, 0x6A, 0x38, 0xFC, 0xA6, 0xD7, 0xD8,
+    0x54, 0x09, 0x73, 0x1C, 0xCC, 0x1A, 0xC7, 0x7D, 0x90, 0x1E, 0xA4, 0x42, 0x24, 0xD1, 0xE0, 0x8D,
+    0x92, 0x68, 0x9E, 0x8F, 0xDC, 0x6E, 0x68, 0x68, 0x74, 0x19, 0x6B, 0x35, 0x8D, 0xDA, 0x4B, 0xE3,
+    0x5A, 0x27, 0x50, 0x8D, 0x8B, 0xC2, 0xA6, 0x06, 0x45, 0xDF, 0x34, 0x25, 0xA9, 0x9A, 0xE5, 0x64,
+    0xC7, 0xE3, 0x55, 0x67, 0x57, 0xFD, 0x5C, 0xE5, 0x37, 0xEB, 0xDD, 0x36, 0xFB, 0xDC, 0x24, 0xA1,
+    0x99, 0x61, 0x64, 0x66, 0x18, 0x98, 0x31, 0x2E, 0xDB, 0x6A, 0x58, 0x66, 0xA3, 0x32, 0x0D, 0xCA,
+    0x34, 0x26, 0xD3, 0x90, 0x4C, 0x23, 0x32, 0x0D, 0xC8, 0x34, 0x1E, 0xD3, 0x70, 0x4C, 0xA3, 0x31,
+    0x0D, 0xC6, 0x34, 0x16, 0xD3, 0x50, 0x4C, 0x23, 0x31, 0x0D, 0xC4, 0x34, 0x0E, 0xD3, 0x30, 0x4C,
+    0xA3, 0x30, 0x1B, 0x84, 0xD9, 0x18, 0xEC, 0x6D, 0x3D, 0xCD, 0x03, 0x81, 0x3E, 0x93, 0x55, 0xBD,
+    0xDF, 0x80, 0x12, 0x80, 0x8E, 0x8E, 0x90, 0x35, 0xC7, 0xFD, 0x8B, 0x96, 0x4F, 0xC2, 0x32, 0x44,
+    0x65, 0x0D, 0xB8, 0xE4, 0x4C, 0x63, 0xB2, 0x5E, 0x8A, 0x55, 0x8F, 0xEB, 0x30, 0xB3, 0xC3, 0x4C,
+    0x5D, 0x95, 0x99, 0x72, 0xB2, 0x5B, 0x6B, 0x24, 0xC6, 0x40, 0x8C, 0x71, 0x98, 0x86, 0x61, 0x1A,
+    0x85, 0x7D, 0xD9, 0x7C, 0x45, 0xC6, 0x9B, 0xB4, 0xBE, 0xD1, 0x37, 0xC9, 0x17, 0x2A, 0x71, 0xED,
+    0xAE, 0x7C, 0x0F, 0x2F, 0x04, 0x59, 0x99, 0xC6, 0x58, 0x1A, 0x62, 0x69, 0x84, 0xA5, 0xFE, 0xA9,
+    0x8E, 0x1A, 0x5E, 0x69, 0x7C, 0xA6, 0xE1, 0x99, 0xFA, 0xA7, 0x18, 0x6B, 0x1B, 0x9B, 0x69, 0x68,
+    0xA6, 0x91, 0x59, 0xD2, 0x8F, 0x72, 0x8B, 0x86, 0x65, 0x1A, 0x95, 0x69, 0x50, 0x66, 0xFD, 0x3E,
+    0x86, 0x64, 0x1A, 0x91, 0x69, 0x40, 0x66, 0xE3, 0x31, 0x35, 0x38, 0x54, 0x30, 0xAA, 0x5F, 0xA8,
+    0x5E, 0xA8, 0x5D, 0xA8, 0x5C, 0xE2, 0x6C, 0x07, 0x78, 0xC4, 0x68, 0x6A, 0xDF, 0xFB, 0x21, 0xCA,
+    0x18, 0x9F, 0x31, 0x3C, 0x9B, 0x18, 0xF9, 0x99, 0x86, 0x66, 0x8C, 0xCC, 0x18, 0x98, 0x31, 0x2E,
+    0x4B, 0x46, 0x09, 0x45, 0x50, 0x46, 0x09, 0xD5, 0x90, 0x4C, 0x35, 0x77, 0x48, 0xC2, 0x46, 0x1C,
+    0x5F, 0x5E, 0xBC, 0xB7, 0x47, 0xBB, 0x23, 0x5A, 0xB9, 0x19, 0x25, 0xF0, 0xA6, 0x57, 0x5C, 0x05,
+    0xC2, 0x1A, 0x84, 0x03, 0x3A, 0x2C, 0x16, 0xBD, 0xB2, 0x4B, 0x9F, 0xC3, 0xC2, 0x49, 0x3F, 0x14,
+    0x37, 0x2F, 0x92, 0xC4, 0x1A, 0xFE, 0x59, 0xBB, 0xAB, 0xFA, 0xF7, 0x84, 0x9F, 0x57, 0xE7, 0x13,
+    0xFA, 0x86, 0x97, 0x5F, 0x09, 0x42, 0x5B, 0xC3, 0x87, 0x3F, 0xB6, 0xBD, 0xE0, 0x51, 0x4D, 0x87,
+    0x03, 0xC9, 0xCB, 0xA3, 0x67, 0x44, 0x72, 0xBE, 0x22, 0xBA, 0x2C, 0xC1, 0x07, 0xE0, 0x6D, 0xEF,
+    0xBF, 0x01, 0x99, 0xAB, 0x19, 0x91, 0xAD, 0x39, 0x97, 0xCF, 0x13, 0x9A, 0x9B, 0xAB, 0xC2, 0xE7,
+    0xCA, 0x42, 0x00, 0x7C, 0x09, 0x83, 0x73, 0x04, 0xAD, 0xCE, 0x24, 0x47, 0xD8, 0x07, 0xB2, 0x7B,
+    0x6C, 0xEF, 0x16, 0xAF, 0x5D, 0xA8, 0x66, 0x21, 0x17, 0x07, 0xC5, 0x8E, 0xB3, 0xA5, 0xAA, 0xF9,
+    0xC6, 0xD5, 0xD6, 0x2F, 0xA3, 0xC5, 0x3E, 0xE9, 0x63, 0x6F, 0xC0, 0x29, 0x2B, 0xE7, 0xCF, 0x5C,
+    0xD3, 0xC0, 0x73, 0x10, 0xD7, 0xA2, 0xCB, 0xBD, 0xDF, 0x7D, 0xAB, 0x72, 0xA8, 0x78, 0xE8, 0xF7,
+    0x5A, 0x07, 0x46, 0xD6, 0xB9, 0xD6, 0xD5, 0x82, 0x4E, 0x1D, 0x6C, 0x6F, 0x6F, 0xA2, 0x02, 0x30,
+    0xFA, 0xE5, 0x11, 0xDD, 0x86, 0x24, 0x4D, 0xEE, 0x6E, 0x69, 0x08, 0x7C, 0xD8, 0xFC, 0x2F, 0x8E,
+    0xBA, 0xD4, 0x8E, 0xA3, 0x36, 0xED, 0xB3, 0x74, 0x90, 0x6E, 0xC5, 0x73, 0x0F, 0xD1, 0x4B, 0xE8,
+    0x11, 0x1B, 0x24, 0x70, 0x1C, 0x0E, 0xC8, 0x9F, 0xED, 0xC8, 0x07, 0xB0, 0xF0, 0x4B, 0x78, 0x35,
+    0xF9, 0x8D, 0x0B, 0xF4, 0x8D, 0x15, 0x22, 0x05, 0x09, 0x30, 0x8D, 0xC4, 0x0D, 0xD2, 0x31, 0xCD,
+    0xAD, 0x63, 0x60, 0x2E, 0x37, 0x71, 0x1D, 0x4B, 0xDC, 0x74, 0x97, 0xB8, 0x44, 0x83, 0x39, 0x4E,
+    0x7A, 0x34, 0x87, 0xE6, 0x42, 0x89, 0x6B, 0x0E, 0xAD, 0x33, 0xA3, 0xAE, 0x0D, 0xE6, 0xCD, 0x79,
+    0xF1, 0xAB, 0xF8, 0xB9, 0xFC, 0x41, 0x60, 0x67, 0xA4, 0x8B, 0xE9, 0x8A, 0xBD, 0xA9, 0x46, 0x78,
+    0xA6, 0x6A, 0xCC, 0x34, 0x0C, 0x36, 0x84, 0x16, 0x6A, 0xC0, 0xFD, 0x2A, 0xB1, 0x4A, 0x4E, 0xE7,
+    0x38, 0x53, 0x1F, 0x78, 0x6E, 0xD6, 0xA4, 0x40, 0x8B, 0x5C, 0x11, 0x03, 0x8E, 0x0E, 0xD9, 0x53,
+    0xCF, 0x66, 0x27, 0x42, 0xDD, 0x44, 0x80, 0x51, 0x68, 0x92, 0xC5, 0xFB, 0x1B, 0x35, 0x48, 0xD4,
+    0x90, 0x4E, 0x63, 0xC3, 0x9E, 0x8D, 0x06, 0x3D, 0x81, 0x66, 0xDE, 0xC0, 0x05, 0xE1, 0x1F, 0x16,
+    0xF7, 0x40, 0x13, 0xA6, 0x00, 0xD7, 0x46, 0x67, 0xD9, 0x60, 0xF1, 0x63, 0x75, 0xB9, 0xB7, 0x3A,
+    0x3D, 0x99, 0x22, 0x0F, 0xDA, 0x20, 0xD8, 0xE2, 0x60, 0xDF, 0x94, 0xD8, 0x1C, 0xD4, 0x6E, 0xBF,
+    0x55, 0x78, 0xA2, 0x03, 0x4A, 0xBF, 0x14, 0x8A, 0x77, 0xA2, 0x80, 0x04, 0x43, 0x89, 0xCF, 0x0B,
+    0x41, 0xB0, 0x95, 0x9D, 0x10, 0x4B, 0x1F, 0x74, 0x20, 0x7A, 0xD7, 0x51, 0xF7, 0x74, 0xDD, 0xA9,
+    0x90, 0x9B, 0x81, 0xD9, 0x4C, 0x5D, 0x19, 0x21, 0x7E, 0xCD, 0x29, 0x6A, 0xC8, 0x8A, 0x73, 0x66,
+    0x2C, 0x7F, 0xF0, 0xC7, 0x2E, 0xFB, 0x47, 0xC1, 0xEC, 0xC3, 0x87, 0x02, 0x85, 0xBF, 0xF5, 0x7F,
+    0x08, 0x14, 0xDF, 0xEA, 0x35, 0x89, 0x8D, 0xF3, 0x1E, 0x28, 0xC5, 0x05, 0xA5, 0xED, 0x02, 0x50,
+    0x15, 0xE6, 0x4B, 0x86, 0xA5, 0x0B, 0x96, 0x83, 0xFA, 0x64, 0x8D, 0xBA, 0x4A, 0xB6, 0xD0, 0x93,
+    0x8E, 0xFC, 0x2E, 0xD0, 0xC8, 0xA9, 0x4A, 0x08, 0xD4, 0x21, 0xA8, 0xF0, 0x64, 0x83, 0x33, 0xD2,
+    0xB6, 0x1F, 0x0F, 0xDE, 0x7F, 0x24, 0xDF, 0x86, 0x42, 0x0C, 0xD1, 0xA4, 0x02, 0x45, 0xC2, 0x5C,
+    0x65, 0x84, 0xCC, 0x98, 0x70, 0xDC, 0xAD, 0x35, 0xC3, 0x1A, 0x88, 0x4B, 0xDC, 0x3D, 0x9A, 0x54,
+    0x96, 0xE4, 0xF3, 0x0C, 0x5C, 0xF4, 0xB1, 0xF0, 0xE0, 0xAF, 0xFF, 0xAD, 0x92, 0xF3, 0x48, 0x4A,
+    0x64, 0xA5, 0x8B, 0x69, 0x6A, 0x2D, 0x67, 0xD6, 0x33, 0x44, 0x7E, 0x2D, 0xB2, 0x8C, 0xBA, 0xC6,
+    0xB0, 0x85, 0x0C, 0xB5, 0x02, 0x76, 0xD8, 0x9A, 0xE0, 0xD1, 0x6A, 0x09, 0xD0, 0x18, 0xB4, 0xD5,
+    0x36, 0x4B, 0xF8, 0xFC, 0xED, 0x47, 0x3C, 0x32, 0x9E, 0xBC, 0xF9, 0x6B, 0x1A, 0x9B, 0x1F, 0x09,
+    0x20, 0x09, 0x0E, 0xEC, 0x50, 0x63, 0x2C, 0x06, 0xCB, 0x12, 0x23, 0xC2, 0xAA, 0xF8, 0x08, 0x97,
+    0x6D, 0xBC, 0xAC, 0xF2, 0x6D, 0x93, 0x9D, 0xE6, 0xE2, 0x88, 0x89, 0x71, 0x4E, 0x4B, 0x99, 0xD0,
+    0x52, 0x7E, 0x26, 0x62, 0x3A, 0xA7, 0xCE, 0xA9, 0xD8, 0x79, 0xA8, 0x9B, 0x25, 0x53, 0xC1, 0x00,
+    0x24, 0xAA, 0xC6, 0xB4, 0xD3, 0x13, 0xF4, 0x4E, 0x9E, 0x42, 0xEF, 0x70, 0x8F, 0xDE, 0x99, 0xD2,
+    0x7B, 0xAE, 0xF4, 0x8E, 0x32, 0xB7, 0xC5, 0xA1, 0xC8, 0xB0, 0x99, 0x2D, 0x85, 0xF1, 0xEB, 0x46,
+    0x38, 0xB5, 0x10, 0x7A, 0x3F, 0xC7, 0xB8, 0xD0, 0x1D, 0xB2, 0x07, 0x22, 0x43, 0x4F, 0xD0, 0xFB,
+    0x54, 0xC3, 0xC8, 0x2F, 0xC3, 0xEB, 0x70, 0x35, 0x8C, 0x64, 0x52, 0x41, 0x69, 0x77, 0x7E, 0x18,
+    0x19, 0xF7, 0xB9, 0x75, 0x56, 0x2F, 0x21, 0x07, 0x33, 0xE2, 0xB4, 0xA2, 0x07, 0xBC, 0x64, 0x36,
+    0xB5, 0xA1, 0x78, 0x34, 0xF8, 0xD8, 0xA9, 0x13, 0x94, 0x32, 0x37, 0x90, 0x4B, 0xEF, 0x8F, 0xF4,
+    0x40, 0x3B, 0x1D, 0x1B, 0x26, 0xDB, 0x66, 0xF4, 0x8D, 0x34, 0x5A, 0x8F, 0x19, 0xB9, 0x6B, 0x09,
+    0x04, 0xF7, 0x46, 0x29, 0xA4, 0x3F, 0xD6, 0x2A, 0xA2, 0xD6, 0x25, 0x59, 0x83, 0x9A, 0x71, 0xF3,
+    0x95, 0x16, 0x99, 0x4E, 0xCD, 0xB7, 0x8D, 0xF9, 0x39, 0x7E, 0x78, 0xC4, 0x44, 0x3C, 0x0B, 0x59,
+    0xF5, 0x4E, 0x9E, 0x4F, 0xB8, 0x2E, 0xFD, 0xAC, 0xE9, 0x12, 0xD9, 0x7B, 0x85, 0x55, 0x1B, 0x6C,
+    0xD3, 0x80, 0x6F, 0xEA, 0x08, 0x29, 0x50, 0xF9, 0xC8, 0xFD, 0x58, 0x3E, 0xF2, 0xFE, 0x07, 0xE9,
+    0x0E, 0x68, 0x1C, 0x1F, 0x58, 0x04, 0x35, 0x7C, 0xA3, 0xE2, 0xCC, 0xEA, 0x3F, 0x62, 0x60, 0xCF,
+    0x89, 0x29, 0x3B, 0xBF, 0xB2, 0x24, 0xBA, 0x9C, 0xE9, 0x0C, 0xCD, 0xDB, 0xFB, 0x6A, 0x60, 0x09,
+    0xE0, 0xEB, 0x3B, 0x09, 0xCE, 0x98, 0x95, 0xA3, 0xB0, 0xDA, 0x3B, 0xFF, 0xCF, 0x2F, 0xAB, 0x41,
+    0x10, 0xEE, 0x00, 0xAE, 0xAA, 0x2F, 0x43, 0xE9, 0xF0, 0x98, 0xD2, 0x3F, 0x82, 0xA0, 0xF1, 0x79,
+    0x4C, 0xD3, 0x11, 0x77, 0xD5, 0xE5, 0xCE, 0x19, 0xFD, 0x5F, 0x89, 0x7C, 0xB8, 0xB8, 0x0F, 0x09,
+    0x6C, 0x46, 0x8B, 0x7D, 0x79, 0x08, 0x7F, 0x6A, 0xA8, 0xD4, 0x04, 0xAD, 0x3B, 0xF1, 0x44, 0xA9,
+    0x05, 0x13, 0xA5, 0x96, 0xC0, 0x26, 0x73, 0x98, 0xF3, 0x18, 0x10, 0x4A, 0x68, 0xB0, 0xC9, 0x42,
+    0x17, 0x35, 0x20, 0xC3, 0xE5, 0xB6, 0x4F, 0x0A, 0x30, 0x54, 0x8B, 0x80, 0xA0, 0x9E, 0xA7, 0xDF,
+    0x0C, 0x75, 0xEE, 0xB3, 0xE9, 0xD0, 0xAA, 0x7B, 0x90, 0xA2, 0x44, 0xDA, 0xA6, 0xF3, 0x52, 0xAC,
+    0xB3, 0xDC, 0x16, 0x13, 0x8F, 0x97, 0x2C, 0x90, 0x42, 0x53, 0x96, 0x3B, 0x59, 0xEA, 0x64, 0x7D,
+    0x83, 0x25, 0xCE, 0xA0, 0xDC, 0x05, 0x92, 0x8E, 0x43, 0x04, 0xF8, 0x5E, 0x5E, 0xFC, 0x64, 0x80,
+    0x68, 0xD5, 0xAB, 0x3C, 0x62, 0x14, 0xF7, 0x29, 0x5A, 0x26, 0x4C, 0x03, 0x42, 0x0A, 0x4D, 0x7F,
+    0x48, 0xAC, 0xFC, 0x8D, 0xAD, 0xA4, 0x5B, 0x48, 0x57, 0xD3, 0x61, 0x48, 0xB9, 0x0A, 0x86, 0x2F,
+    0xE2, 0x88, 0x93, 0x1F, 0xAD, 0x73, 0x2D, 0x22, 0x07, 0xBC, 0xFF, 0x53, 0x6C, 0xC4, 0x34, 0xF1,
+    0x11, 0xA5, 0x4F, 0x2A, 0xAC, 0xA3, 0x21, 0xF0, 0x3A, 0x27, 0xBF, 0xBB, 0xA7, 0xFA, 0xC7, 0xEC,
+    0x71, 0xB0, 0x97, 0x3D, 0xCE, 0x9E, 0x54, 0x87, 0x60, 0xFC, 0xBF, 0xA1, 0x23, 0x53, 0x8F, 0x69,
+    0xFE, 0xFF, 0x6F, 0x2B, 0x60, 0x5B, 0x81, 0xB6, 0x10, 0x98, 0xBE, 0x83, 0xC0, 0xF4, 0x0D, 0x04,
+    0x66, 0xA0, 0xC0, 0x4E, 0xFB, 0xC0, 0xD0, 0x3D, 0x30, 0x34, 0x0F, 0xF4, 0xBD, 0x03, 0x43, 0xEB,
+    0xC0, 0xD0, 0x39, 0x30, 0x34, 0x0E, 0x0C, 0x7D, 0x03, 0x43, 0xDB, 0xC0, 0x80, 0xED, 0x80, 0xEB,
+    0x80, 0xE9, 0xD0, 0x32, 0x30, 0x74, 0x0C, 0x0C, 0x0D, 0x03, 0x43, 0xBF, 0xC0, 0x80, 0xDF, 0xD0,
+    0x2D, 0x30, 0x34, 0x0B, 0x4C, 0x7A, 0x05, 0x06, 0x17, 0xB0, 0xD7, 0x39, 0x7D, 0x9D, 0x68, 0xF4,
+    0x00, 0xFA, 0x02, 0xDA, 0xCE, 0xC5, 0xD5, 0x6D, 0x15, 0x90, 0xD7, 0xFD, 0xB1, 0xF4, 0xAE, 0x0C,
+    0xA0, 0xA1, 0x8D, 0x2A, 0xE6, 0x9F, 0x5D, 0x09, 0x37, 0x53, 0x6C, 0x61, 0xD6, 0xAB, 0xAE, 0xB3,
+    0x5E, 0xF0, 0x35, 0xF7, 0x98, 0x5E, 0x2E, 0x37, 0x33, 0xB6, 0x6A, 0x2C, 0x19, 0x75, 0x4D, 0xAF,
+    0x6E, 0x12, 0x2B, 0x2D, 0x33, 0xDB, 0xC5, 0x70, 0x62, 0x85, 0x66, 0xA9, 0x75, 0x4C, 0x36, 0x01,
+    0x80, 0x1B, 0x11, 0xF2, 0x0A, 0x33, 0x3A, 0xA8, 0x00, 0x7B, 0x5B, 0x44, 0x8C, 0x0D, 0x72, 0x3C,
+    0x5D, 0xD5, 0xCF, 0x0E, 0x7B, 0xB6, 0xBC, 0x52, 0x7E, 0x24, 0x04, 0xF4, 0x31, 0x83, 0x78, 0x8A,
+    0x65, 0x9F, 0x68, 0x52, 0x84, 0x21, 0x28, 0x19, 0xD2, 0x4D, 0xD6, 0x61, 0x53, 0xEF, 0x4D, 0x39,
+    0xF1, 0x93, 0xB5, 0xB6, 0xA9, 0x41, 0x53, 0xAF, 0x10, 0xD4, 0x6F, 0xA6, 0xF5, 0x60, 0xE0, 0x5B,
+    0xCE, 0xD1, 0x5C, 0xF1, 0x5B, 0x1C, 0x88, 0xF7, 0x1F, 0xBF, 0x13, 0xBD, 0xEE, 0x3F, 0x84, 0xE4,
+    0x05, 0xE4, 0x52, 0xED, 0xFF, 0x09, 0x59, 0xCF, 0x0D, 0xD9, 0x01, 0x24, 0xDB, 0xCA, 0x18, 0xA7,
+    0x3B, 0xC7, 0x4B, 0x96, 0x3F, 0x62, 0x52, 0x40, 0x2B, 0xB6, 0x4B, 0xEA, 0x8B, 0x86, 0xEA, 0xA3,
+    0xC1, 0x1A, 0x82, 0x0E, 0xEB, 0xEF, 0x28, 0x8E, 0xB9, 0x15, 0x7C, 0x5A, 0xEF, 0xE3, 0x35, 0x72,
+    0x16, 0x0C, 0x72, 0x7D, 0x2A, 0x9E, 0xA0, 0x1D, 0x53, 0x8C, 0x76, 0xCC, 0x06, 0x93, 0xA1, 0x39,
+    0xB9, 0x81, 0xFF, 0xCC, 0x4E, 0x85, 0xCA, 0xB9, 0xB7, 0xD3, 0x1A, 0xA0, 0xFA, 0xEA, 0xA6, 0x19,
+    0x5D, 0x94, 0x60, 0x2F, 0xC5, 0xA5, 0xFD, 0x00, 0xDA, 0x0D, 0xA0, 0xBD, 0x00, 0xDA, 0x09, 0xA0,
+    0x7D, 0x00, 0xDA, 0x05, 0xC0, 0x1E, 0x00, 0xED, 0x00, 0xD0, 0xFA, 0x7F, 0xDF, 0xFD, 0xA0, 0xBD,
+    0x0F, 0xA8, 0xFC, 0x6B, 0xDD, 0x5F, 0xAB, 0xFE, 0x7D, 0xCF, 0x03, 0x2A, 0xFE, 0x7D, 0xBF, 0x83,
+    0x76, 0x3B, 0xA0, 0xD6, 0xDF, 0x77, 0x3A, 0xA0, 0xCE, 0xAF, 0x55, 0xFE, 0xBE, 0xC7, 0x81, 0x8D,
+    0x92, 0xE6, 0xAB, 0x03, 0x4A, 0x14, 0x5A, 0x9A, 0x34, 0xD5, 0x46, 0xD5, 0x6E, 0x49, 0x9E, 0xF5,
+    0x78, 0x14, 0xE3, 0x59, 0x89, 0x67, 0x19, 0x9E, 0x35, 0x78, 0x2D, 0xC0, 0xA3, 0xFA, 0x4E, 0x7D,
+    0xCA, 0xBA, 0x3B, 0x8B, 0xEE, 0x5A, 0x71, 0x2F, 0x7A, 0xB7, 0x8A, 0x85, 0x76, 0x56, 0xD9, 0x59,
+    0x62, 0x4F, 0x34, 0x0D, 0x69, 0x09, 0x36, 0x67, 0x32, 0xB4, 0x1D, 0x45, 0x5F, 0xF5, 0x87, 0xC6,
+    0xF9, 0xFF, 0x64, 0x86, 0xC0, 0xD5, 0xCB, 0x29, 0x1D, 0xD9, 0xCE, 0xF8, 0xFB, 0x72, 0x28, 0x7D,
+    0xFA, 0x0F, 0xCF, 0x4F, 0x55, 0x9D, 0xED, 0xA4, 0xAA, 0xEA, 0xF3, 0x53, 0x55, 0xC9, 0x53, 0x52,
+    0x55, 0x1B, 0xE3, 0xEC, 0xA4, 0xAA, 0xCC, 0xF9, 0x79, 0x40, 0x9C, 0xE6, 0xAE, 0x73, 0x93, 0xF7,
+    0x1C, 0xCE, 0x01, 0x7C, 0xE6, 0xFE, 0x06, 0xC1, 0x4E, 0xFE, 0x7D, 0x3B, 0xF0, 0x4F, 0x43, 0x8C,
+    0x5E, 0xBA, 0xB8, 0xF4, 0x95, 0x79, 0xD9, 0xB2, 0xE2, 0x7C, 0xDA, 0xC6, 0xD0, 0xDB, 0xA0, 0xC0,
+    0xBA, 0x4A, 0x2F, 0x9C, 0xDF, 0x10, 0x79, 0xC5, 0xD3, 0x5A, 0xC6, 0x5C, 0x57, 0x3C, 0xD6, 0x2A,
+    0xB5, 0xCD, 0x2E, 0xEE, 0x2A, 0xE9, 0xE6, 0x55, 0x73, 0x69, 0x73, 0x5D, 0x0A, 0xFC, 0x76, 0x54,
+    0x35, 0x1A, 0x93, 0x2B, 0xE0, 0xAF, 0x4D, 0x40, 0xBE, 0x07, 0xAA, 0xDD, 0xAD, 0xB1, 0xF5, 0x9F,
+    0x44, 0x83, 0x6E, 0xDF, 0x11, 0xC0, 0xE3, 0x12, 0xDD, 0x58, 0x22, 0x66, 0xA2, 0x5F, 0xD1, 0xDB,
+    0x5C, 0xA0, 0xC5, 0xF2, 0x4F, 0xEC, 0xD1, 0xFD, 0xB0, 0x42, 0xEC, 0xF3, 0x46, 0x25, 0xA2, 0x7A,
+    0x26, 0xBA, 0x25, 0x77, 0xC4, 0x85, 0x82, 0xD3, 0xE4, 0x57, 0x50, 0xE7, 0x7E, 0x15, 0x67, 0x08,
+    0xF3, 0x10, 0xBA, 0x85, 0x45, 0x7C, 0x17, 0x72, 0x10, 0xBF, 0x2B, 0xF2, 0x9D, 0x47, 0x1F, 0xC1,
+    0xCF, 0x80, 0x13, 0xDF, 0x99, 0xB0, 0x85, 0xAE, 0x95, 0x50, 0x43, 0x78, 0xD0, 0xEB, 0xFE, 0x75,
+    0xAD, 0xCE, 0xAC, 0xF0, 0xEB, 0x37, 0x81, 0xC5, 0x2B, 0x23, 0x97, 0xB3, 0x4D, 0xE8, 0xB4, 0xB7,
+    0xEA, 0x49, 0xCF, 0x85, 0x34, 0x7A, 0xFE, 0x4E, 0x95, 0x5A, 0xD4, 0x63, 0xF7, 0x5F, 0x5C, 0x45,
+    0xD4, 0xC6, 0xAF, 0x3B, 0x68, 0x8C, 0x79, 0xE6, 0x8A, 0xFE, 0x46, 0x0B, 0xD8, 0xC3, 0x3C, 0x28,
+    0xC2, 0x5F, 0x89, 0x89, 0x8D, 0xC5, 0x47, 0xCA, 0x4F, 0xC4, 0xE2, 0xDE, 0xAD, 0xC3, 0x3C, 0x12,
+    0xC7, 0x24, 0x8B, 0xDE, 0xCC, 0xA3, 0x34, 0xFA, 0x09, 0xF4, 0x4D, 0x2B, 0x32, 0x12, 0xD6, 0x72,
+    0xCE, 0x7E, 0x1D, 0x54, 0xBA, 0x52, 0x3C, 0xDF, 0x02, 0x9A, 0x41, 0x23, 0x3B, 0xF7, 0xAE, 0x33,
+    0xAD, 0x92, 0x22, 0xC3, 0x22, 0x00, 0x1D, 0x41, 0x39, 0x44, 0x00, 0xC6, 0x4F, 0x7F, 0xFA, 0x64,
+    0x72, 0x9C, 0xB9, 0x71, 0xF8, 0x0D, 0xCC, 0x8C, 0x33, 0x31, 0x4E, 0x65, 0x43, 0x5D, 0x43, 0x55,
+    0xC3, 0xA4, 0x38, 0x14, 0x0D, 0x53, 0xE2, 0x54, 0x33, 0xD4, 0x32, 0x54, 0x32, 0xB1, 0x0D, 0xE3,
+    0x2A, 0x6A, 0x18, 0x2A, 0x18, 0xA6, 0xC2, 0xA9, 0x5E, 0x98, 0x08, 0xA7, 0x72, 0xA1, 0x6E, 0xA1,
+    0x6A, 0x71, 0xEF, 0x7D, 0x15, 0x72, 0x94, 0xF4, 0x42, 0x75, 0x82, 0xD5, 0x63, 0xF6, 0x1C, 0xA6,
+    0xD5, 0x85, 0xA6, 0xBE, 0x5F, 0xC6, 0x91, 0xAD, 0x11, 0x5C, 0x50, 0x46, 0xF3, 0x08, 0x14, 0x3A,
+    0x7C, 0xF6, 0x14, 0xB2, 0x90, 0x41, 0x55, 0x78, 0x70, 0x90, 0xFC, 0xFC, 0x55, 0x94, 0x36, 0x5E,
+    0xB8, 0x40, 0xE2, 0xDC, 0x3F, 0x14, 0x74, 0x57, 0xE0, 0x9E, 0x04, 0x22, 0x19, 0x7D, 0x03, 0x0D,
+    0xEA, 0x39, 0x5A, 0x7A, 0x8A, 0x1B, 0x53, 0xA7, 0xB7, 0x6F, 0x2C, 0xE6, 0x30, 0xF6, 0x13, 0x2D,
+    0x27, 0x41, 0x27, 0x63, 0x05, 0xED, 0x56, 0xDA, 0x8A, 0x93, 0xEB, 0x41, 0xFD, 0x71, 0x18, 0x83,
+    0xCE, 0xBD, 0xF4, 0xDB, 0x7E, 0x48, 0xBB, 0x58, 0x64, 0xEC, 0x2D, 0x65, 0x6B, 0xA9, 0x39, 0xCC,
+    0xEE, 0x8B, 0x72, 0x6C, 0x0D, 0x3C, 0x04, 0xB3, 0x11, 0x5F, 0xE0, 0x4E, 0x90, 0x99, 0xD7, 0xDC,
+    0x31, 0x2A, 0x0E, 0x18, 0x63, 0x88, 0x2A, 0xBB, 0xBD, 0x11, 0xBD, 0x56, 0x07, 0x25, 0x28, 0xED,
+    0x6E, 0xA2, 0x4C, 0x14, 0xF7, 0xD7, 0xD7, 0x85, 0x00, 0x2B, 0x5F, 0x3F, 0x30, 0xB3, 0x74, 0x68,
+    0xFF, 0xD5, 0x86, 0xDC, 0x14, 0xCF, 0x58, 0x5C, 0x4B, 0x91, 0xFB, 0x70, 0x40, 0x7A, 0xDA, 0xBA,
+    0x03, 0x04, 0x75, 0xC9, 0x96, 0x95, 0x28, 0x34, 0x8A, 0x89, 0x48, 0xBB, 0xB9, 0x97, 0x3D, 0x7B,
+    0x32, 0x18, 0xF3, 0x5D, 0xF5, 0xF3, 0x42, 0x41, 0xF5, 0x75, 0x09, 0x49, 0xBE, 0x62, 0xFE, 0xF6,
+    0xF3, 0x20, 0xC1, 0x81, 0x90, 0xDB, 0x27, 0xB9, 0x13, 0x24, 0x3C, 0x53, 0x21, 0x77, 0x6E, 0x5E,
+    0xD9, 0x21, 0x77, 0x4C, 0xF4, 0x0B, 0x1A, 0x84, 0x73, 0x9B, 0xBE, 0xF2, 0x27, 0x9B, 0xBE, 0x12,
+    0x33, 0xBE, 0x67, 0x4F, 0xF6, 0x8F, 0xC1, 0x1E, 0xA0, 0x03, 0x0D, 0x0D, 0x68, 0xD7, 0x0F, 0x4E,
+    0xA1, 0xCA, 0xEF, 0x6E, 0xFC, 0xBC, 0x71, 0xAB, 0x9B, 0xE6, 0xA7, 0x2F, 0x8C, 0x61, 0xA5, 0x76,
+    0x5B, 0xE3, 0x7F, 0x86, 0xA5, 0x87, 0x07, 0x59, 0x66, 0x8C, 0x13, 0x56, 0x36, 0x40, 0xD0, 0xEE,
+    0x6D, 0xD7, 0x76, 0xA5, 0x5E, 0x4F, 0x45, 0xE4, 0x51, 0x11, 0x16, 0xBD, 0x6F, 0xEE, 0x88, 0xEE,
+    0xFC, 0xDA, 0x45, 0x61, 0x02, 0xC9, 0xEE, 0x6A, 0x91, 0xEA, 0x20, 0x7B, 0x3D, 0x30, 0x7F, 0x31,
+    0xB6, 0xCF, 0xF5, 0x80, 0xCA, 0x0D, 0x0A, 0xAB, 0x76, 0x98, 0xCB, 0xB6, 0xBB, 0x38, 0x2A, 0x82,
+    0xB6, 0x83, 0xFD, 0xF0, 0xEE, 0x7B, 0x0C, 0x27, 0x99, 0x4D, 0x29, 0x4F, 0x98, 0x9E, 0x23, 0x97,
+    0x2C, 0x19, 0xDB, 0x7D, 0x6D, 0xC2, 0xA1, 0x97, 0xB5, 0x59, 0xEE, 0xE0, 0xF4, 0x3E, 0xBC, 0xA9,
+    0xB3, 0xD1, 0x24, 0xC8, 0x86, 0x37, 0x91, 0x0D, 0x7D, 0xD5, 0x2D, 0x2E, 0xB2, 0x59, 0xCE, 0x7C,
+    0x57, 0xAB, 0xC3, 0xCC, 0x0F, 0xD1, 0x3B, 0x7B, 0xDD, 0xFC, 0x1C, 0x64, 0xDC, 0x11, 0xA9, 0x4B,
+    0xDC, 0x73, 0x48, 0x37, 0x18, 0x4C, 0x2D, 0x98, 0xA1, 0x1F, 0x24, 0xBD, 0x61, 0x26, 0x7C, 0xFD,
+    0xF9, 0x53, 0xF0, 0x3B, 0x78, 0xEA, 0x6C, 0x4E, 0xD4, 0xDF, 0x10, 0x30, 0xC2, 0x0F, 0x20, 0x3D,
+    0xC5, 0x1D, 0xF9, 0xB6, 0x7C, 0x6D, 0x6A, 0x32, 0x4E, 0x8D, 0x66, 0x39, 0xAD, 0xAE, 0x8C, 0x0A,
+    0x34, 0xA5, 0xA0, 0x4D, 0x9D, 0x6E, 0xB2, 0x1D, 0x18, 0xAB, 0x23, 0x40, 0x47, 0x74, 0x9E, 0x64,
+    0xDE, 0x27, 0xEF, 0x74, 0xD0, 0x95, 0xE8, 0xBA, 0xE8, 0xF0, 0xD0, 0x15, 0xBB, 0x9C, 0x29, 0x15,
+    0x94, 0x8B, 0x00, 0x21, 0x3B, 0x43, 0x68, 0x6F, 0x63, 0x21, 0xB5, 0x0F, 0x06, 0xB4, 0x5A, 0x08,
+    0x52, 0x1D, 0xB6, 0x9A, 0xEA, 0xB0, 0x57, 0x77, 0x74, 0xD8, 0x1D, 0x89, 0x21, 0x97, 0x12, 0xB5,
+    0xB6, 0x8F, 0x4F, 0x19, 0xC4, 0x74, 0x1A, 0xBB, 0x21, 0xDA, 0xEE, 0xB3, 0x8E, 0x9F, 0xA6, 0x04,
+    0xC6, 0x1E, 0x56, 0x47, 0x8B, 0x0F, 0xC6, 0x36, 0xCF, 0x6E, 0xC4, 0x50, 0x3B, 0x85, 0x9B, 0x3F,
+    0x7B, 0x12, 0xEC, 0x29, 0xBE, 0x1B, 0x13, 0x06, 0xF9, 0x73, 0xA1, 0x7F, 0xDD, 0x45, 0xE6, 0x20,
+    0x7E, 0x57, 0x53, 0xAE, 0xAC, 0xE4, 0x15, 0x4B, 0xEA, 0x26, 0x96, 0x35, 0x7E, 0x16, 0x5C, 0x85,
+    0xAE, 0xD3, 0xCF, 0xEA, 0x42, 0x7F, 0xEE, 0x8D, 0x4A, 0xCE, 0x8F, 0xC7, 0x27, 0x7E, 0x12, 0xEA,
+    0xA6, 0x3B, 0xAC, 0xC1, 0x7C, 0xCF, 0x94, 0x57, 0xA2, 0x07, 0xEC, 0xF0, 0x3C, 0x17, 0x3B, 0xB8,
+    0xE8, 0x0E, 0x47, 0x67, 0xDD, 0x1A, 0x8D, 0x95, 0x92, 0xC7, 0x6B, 0xB4, 0x22, 0x38, 0xA9, 0xFA,
+    0x63, 0x83, 0x53, 0xE6, 0x0C, 0x7F, 0x6A, 0x17, 0x41, 0x42, 0x33, 0xD0, 0x6A, 0x66, 0xD4, 0xF0,
+    0x21, 0x5F, 0x5B, 0xDF, 0xF1, 0xA6, 0x3F, 0xE7, 0x20, 0x9F, 0xBD, 0x08, 0xF1, 0x9D, 0xDD, 0x5A,
+    0x17, 0x70, 0xCF, 0x52, 0x5B, 0x6F, 0xBA, 0x35, 0x8D, 0x23, 0x66, 0x83, 0x47, 0xC8, 0x20, 0xBF,
+    0x98, 0xB4, 0xCA, 0xC5, 0x70, 0xB7, 0xBA, 0xD2, 0x7B, 0xF4, 0x4E, 0x1E, 0x94, 0x2A, 0x63, 0x38,
+    0x24, 0x24, 0x8E, 0xBC, 0xAD, 0xCD, 0xAB, 0xC4, 0xF0, 0x26, 0x5A, 0x1B, 0xED, 0xF7, 0x1E, 0xC7,
+    0xDC, 0x6C, 0xE4, 0x33, 0xA8, 0x85, 0x39, 0x7E, 0xF3, 0xF6, 0x98, 0xA6, 0x47, 0xE6, 0x15, 0x71,
+    0x15, 0xAC, 0x29, 0x5A, 0x4D, 0x9F, 0xD3, 0xCC, 0x43, 0x57, 0xC4, 0x18, 0x50, 0xB2, 0xC8, 0xF7,
+    0x1F, 0x21, 0xD8, 0xAB, 0x04, 0xED, 0xD7, 0xC4, 0x9F, 0xF6, 0x84, 0xD4, 0x5E, 0x89, 0x69, 0xCF,
+    0xD7, 0x9D, 0x16, 0x60, 0x75, 0x8B, 0x61, 0xF5, 0x68, 0x48, 0x2D, 0x6A, 0x54, 0xF6, 0x0A, 0xFB,
+    0x1E, 0x97, 0x58, 0xE4, 0x5A, 0xD7, 0xCC, 0xBB, 0xE6, 0x2F, 0x3F, 0x79, 0x7B, 0xF0, 0x85, 0x76,
+    0x1D, 0xA1, 0x28, 0x9D, 0x3E, 0xB5, 0xFC, 0x75, 0xE8, 0x5C, 0x3C, 0xA4, 0xF3, 0x96, 0x6D, 0xA7,
+    0xC4, 0xCF, 0xB8, 0xF4, 0x3F, 0x4F, 0xBA, 0x5D, 0xAF, 0xD9, 0x3C, 0x3D, 0xCA, 0x6C, 0xDB, 0x5B,
+    0x72, 0xBA, 0xE2, 0xCE, 0xC7, 0xF9, 0x7E, 0x96, 0x54, 0xF3, 0xF3, 0xAC, 0x4B, 0x6A, 0x6E, 0x85,
+    0x15, 0x47, 0x67, 0x0D, 0xD2, 0x1C, 0xEB, 0xF3, 0xCE, 0x10, 0x4A, 0xA7, 0x0E, 0xAA, 0xB1, 0x4A,
+    0x60, 0xD3, 0x2F, 0x3B, 0xA3, 0x7E, 0x62, 0x73, 0x1B, 0x9A, 0xFE, 0xA7, 0xE0, 0xF2, 0x11, 0x13,
+    0x97, 0xB5, 0x81, 0x98, 0xBD, 0x08, 0x38, 0xBA, 0x03, 0x5A, 0xF5, 0x44, 0x19, 0xEE, 0x01, 0xBE,
+    0x9B, 0xB4, 0x99, 0xAF, 0xA1, 0xF4, 0x11, 0x68, 0xF8, 0x0F, 0xAE, 0x89, 0x11, 0x57, 0xE2, 0xEE,
+    0x91, 0x59, 0x9F, 0xFB, 0x94, 0xC5, 0xFD, 0x2D, 0x40, 0x84, 0xF2, 0xDE, 0x22, 0x0F, 0x95, 0x12,
+    0x93, 0xE8, 0x9C, 0xC7, 0x42, 0x58, 0x1A, 0x00, 0x86, 0x64, 0xAC, 0x08, 0x8D, 0x90, 0x80, 0xE5,
+    0x78, 0x0B, 0x96, 0x44, 0x59, 0x08, 0x39, 0x9E, 0xBF, 0x53, 0x08, 0xBE, 0x20, 0xFF, 0xA6, 0x9D,
+    0x37, 0xDE, 0xA7, 0x75, 0xDE, 0xC8, 0xF1, 0x78, 0xA5, 0x55, 0x20, 0xC9, 0x8E, 0x02, 0x39, 0xE1,
+    0xB8, 0x22, 0x00, 0x0D, 0x63, 0x1C, 0x16, 0xA4, 0xB4, 0xEA, 0xA5, 0x25, 0x2F, 0x77, 0xBB, 0x58,
+    0xB0, 0x41, 0x53, 0x48, 0x82, 0xB1, 0x21, 0x53, 0x36, 0xA3, 0xDE, 0xD2, 0xD4, 0x25, 0x8C, 0x63,
+    0x36, 0xC9, 0x9F, 0x7F, 0xCA, 0x86, 0x9F, 0xA5, 0x13, 0xC4, 0x79, 0x5A, 0x27, 0x48, 0x3C, 0x2D,
+    0xAC, 0xCE, 0x90, 0x3E, 0x5B, 0xC1, 0xAB, 0x6F, 0x1F, 0x1D, 0x4B, 0x0C, 0x8E, 0xAE, 0x27, 0xE4,
+    0xCB, 0x1C, 0xE4, 0x8D, 0x5D, 0x40, 0xD8, 0xE7, 0x8D, 0xB5, 0x9A, 0x90, 0xF9, 0xF6, 0x49, 0xC6,
+    0x31, 0x6F, 0x8C, 0xE7, 0xF8, 0x04, 0xB2, 0x98, 0x3A, 0xCD, 0xF4, 0x79, 0xE3, 0xFF, 0x05, 0xAD,
+    0x56, 0xBF, 0x6F, 0xE3, 0xD6, 0x1D, 0xFF, 0x90, 0xB4, 0xC5, 0x3B, 0x3F, 0x4B, 0xEF, 0x06, 0x1B,
+    0x2D, 0x0E, 0xBA, 0xA3, 0x87, 0x0C, 0xF6, 0xD5, 0x36, 0x35, 0x08, 0xA9, 0x1A, 0x48, 0x22, 0x8B,
+    0x6C, 0x2D, 0x10, 0x08, 0xC8, 0x19, 0x5D, 0x0D, 0x34, 0x28, 0x92, 0x6B, 0x81, 0x68, 0xF0, 0xA0,
+    0x00, 0xD6, 0x91, 0x6D, 0xB2, 0x15, 0x28, 0xFC, 0x27, 0x68, 0xB8, 0x00, 0x81, 0x6E, 0xB0, 0x5A,
+    0x78, 0x30, 0x50, 0x5B, 0x62, 0x87, 0x0E, 0x45, 0x87, 0x10, 0x45, 0x81, 0xAC, 0x44, 0x52, 0xA0,
+    0x37, 0xE5, 0x88, 0x82, 0x03, 0x73, 0xA0, 0xF4, 0xFA, 0x79, 0xA4, 0x9D, 0x64, 0x08, 0x32, 0x85,
+    0xE4, 0xA3, 0x25, 0xBD, 0xF7, 0xBE, 0x3F, 0x3E, 0x9F, 0xCF, 0xF7, 0xFB, 0xFC, 0x2E, 0x9E, 0xC2,
+    0x83, 0x0C, 0xED, 0xC8, 0x88, 0xF1, 0x9E, 0x51, 0x58, 0xA9, 0x8C, 0x5C, 0x8C, 0x80, 0x3D, 0x40,
+    0xC1, 0x52, 0xA1, 0xF8, 0x2C, 0xF6, 0xCC, 0xF4, 0x12, 0x17, 0x86, 0x5F, 0x83, 0x93, 0x4B, 0x78,
+    0x6A, 0x8E, 0x91, 0x5B, 0x60, 0x66, 0x26, 0xB8, 0x3F, 0x9D, 0x78, 0x2A, 0xF5, 0x54, 0x02, 0x5E,
+    0x81, 0x52, 0xD1, 0x82, 0x63, 0xFB, 0xE8, 0xC8, 0x3F, 0xC6, 0xE4, 0xD2, 0x4C, 0x82, 0xF3, 0xC8,
+    0x55, 0x7E, 0xED, 0x05, 0xB6, 0x9E, 0xCE, 0x4F, 0xB1, 0x06, 0x7F, 0x6C, 0xC7, 0xD7, 0x22, 0x3E,
+    0xB5, 0xC3, 0x6D, 0x04, 0xF1, 0x6F, 0x52, 0x64, 0x66, 0xEA, 0xC6, 0x3D, 0xBA, 0xBB, 0xC7, 0xFD,
+    0x32, 0xEB, 0x5F, 0x8F, 0xE4, 0x89, 0xEC, 0x3E, 0x74, 0x8B, 0x5A, 0x82, 0x67, 0xF7, 0x61, 0xA5,
+    0x01, 0x44, 0x5C, 0xC0, 0x79, 0x33, 0xC5, 0xA9, 0x08, 0x31, 0x69, 0x00, 0xEF, 0xE0, 0x9D, 0x1E,
+    0x77, 0xC9, 0x48, 0x2A, 0xD8, 0x05, 0xAC, 0x0C, 0x86, 0x2F, 0x22, 0x11, 0xC9, 0x50, 0xFA, 0x8E,
+    0xEF, 0x32, 0x99, 0x3E, 0xB6, 0xB0, 0x6E, 0xF8, 0x8E, 0x1D, 0xBB, 0x22, 0xF2, 0x44, 0xD4, 0x97,
+    0xE1, 0x58, 0xFA, 0x74, 0xB0, 0x57, 0x3B, 0xF3, 0xEC, 0xD4, 0xF9, 0x43, 0x2A, 0xA2, 0xDC, 0x4A,
+    0x7A, 0x48, 0x1F, 0xEA, 0xB0, 0xAF, 0x80, 0x42, 0x3F, 0xC7, 0xC7, 0x93, 0x91, 0x91, 0x7A, 0xE7,
+    0x71, 0x15, 0x32, 0xDE, 0x83, 0xAD, 0x62, 0x47, 0xA5, 0x5C, 0xD7, 0xC1, 0x90, 0xF9, 0xA7, 0x56,
+    0x42, 0x37, 0x91, 0xEB, 0x07, 0x98, 0xE3, 0x31, 0xCC, 0xCC, 0x4A, 0xED, 0x44, 0x46, 0x4E, 0xE8,
+    0xA2, 0x47, 0x2B, 0x03, 0x3A, 0xF6, 0x6E, 0x6E, 0x17, 0x0E, 0xEF, 0xF5, 0xEF, 0x58, 0xF3, 0x08,
+    0xAE, 0x2F, 0x23, 0x3B, 0x36, 0x53, 0x5C, 0xE0, 0x13, 0x2B, 0x17, 0x89, 0x13, 0xF6, 0xF9, 0x91,
+    0xD7, 0x29, 0x46, 0x41, 0xBE, 0xC8, 0x90, 0x1A, 0x29, 0x18, 0xAE, 0xF4, 0x25, 0x9C, 0xA5, 0xBB,
+    0x3C, 0x40, 0x97, 0x09, 0x6D, 0x1F, 0x0D, 0x02, 0x95, 0x3E, 0x79, 0x9E, 0xC0, 0x8A, 0x61, 0x45,
+    0xB0, 0x23, 0x10, 0x10, 0xA6, 0x25, 0x81, 0x0D, 0x60, 0x9B, 0x21, 0x2D, 0xC9, 0x5E, 0xE6, 0xC6,
+    0xFD, 0x12, 0x4C, 0xC1, 0x38, 0xBB, 0x38, 0x21, 0xB4, 0x7D, 0xDC, 0x05, 0x06, 0x46, 0x6A, 0x24,
+    0x66, 0x1C, 0xAC, 0x82, 0xE5, 0xF6, 0xE3, 0xC5, 0xF2, 0xFC, 0x85, 0xF0, 0xB5, 0x7D, 0x7D, 0xA5,
+    0xA0, 0xBF, 0x9F, 0xBC, 0x22, 0xAF, 0xF8, 0xD1, 0xBF, 0xB5, 0x69, 0x33, 0x2C, 0xC9, 0x5C, 0xAC,
+    0x68, 0xB5, 0x8F, 0x31, 0xC3, 0x2E, 0x50, 0x18, 0xF9, 0x6F, 0xD3, 0x20, 0x09, 0xFC, 0x75, 0x5F,
+    0x86, 0x15, 0xCC, 0x1A, 0x68, 0xEF, 0x99, 0x9B, 0x89, 0xB4, 0xBB, 0x5C, 0x8E, 0x48, 0xAE, 0x67,
+    0xA5, 0x7C, 0x0E, 0xCC, 0x98, 0xDE, 0xF3, 0xFE, 0xBC, 0x23, 0x47, 0xB2, 0xEB, 0xB8, 0xCB, 0x5A,
+    0x62, 0x6B, 0xDC, 0xFC, 0x43, 0x26, 0x78, 0x0F, 0x66, 0x6C, 0x45, 0x22, 0x31, 0x72, 0x5A, 0xCD,
+    0x83, 0x34, 0x08, 0xAD, 0xC8, 0x61, 0x7E, 0x97, 0xBC, 0x17, 0x91, 0x17, 0x01, 0xDA, 0x3E, 0x89,
+    0x44, 0x45, 0xE4, 0x98, 0x7B, 0x1E, 0x63, 0xFD, 0xE8, 0x68, 0x20, 0x95, 0x4A, 0x9C, 0xE9, 0xF3,
+    0xE4, 0x90, 0xF9, 0xF7, 0x18, 0x65, 0x97, 0x08, 0x6C, 0xC1, 0xC0, 0x49, 0xC3, 0x8C, 0x4E, 0x5C,
+    0x3B, 0xF2, 0x94, 0x82, 0xF3, 0xAF, 0x1C, 0x13, 0x1C, 0x5F, 0x59, 0x49, 0xDF, 0x09, 0x9D, 0x15,
+    0x64, 0x0E, 0x3B, 0xD1, 0x44, 0x56, 0x4A, 0x96, 0xFF, 0x8C, 0xFA, 0x56, 0x7A, 0x81, 0xD9, 0x04,
+    0x67, 0x99, 0x15, 0xCF, 0xCF, 0xB9, 0x09, 0xB5, 0xFF, 0xE8, 0x05, 0x42, 0x45, 0x15, 0xD3, 0x6D,
+    0xCC, 0x0C, 0xDF, 0xE4, 0xCE, 0x6F, 0xEB, 0x7C, 0x82, 0x47, 0xA5, 0xCE, 0x03, 0x15, 0x53, 0xE3,
+    0x29, 0x35, 0x9E, 0xE2, 0xE6, 0x72, 0x95, 0xCA, 0xE9, 0x3A, 0xBB, 0xFD, 0xFE, 0x64, 0x3A, 0x9D,
+    0x70, 0x3E, 0x3E, 0x62, 0x0D, 0x10, 0x74, 0x5F, 0x2C, 0xAD, 0x50, 0xAA, 0x97, 0xFE, 0x81, 0x58,
+    0xA1, 0x63, 0x3C, 0x2B, 0xD7, 0x70, 0x7D, 0x42, 0x3B, 0xB1, 0xAE, 0x93, 0x47, 0x53, 0x5E, 0x9F,
+    0xF0, 0x17, 0xA5, 0x8A, 0xEA, 0xB3, 0x5E, 0x61, 0x46, 0x70, 0x12, 0x2C, 0x42, 0x51, 0xB0, 0x4C,
+    0x58, 0xA0, 0xD8, 0xA9, 0xAC, 0x6F, 0xE9, 0x57, 0xCE, 0x61, 0xE8, 0x00, 0xAC, 0xA4, 0xE4, 0x59,
+    0x57, 0x8E, 0x56, 0xB7, 0xA7, 0x27, 0xC7, 0x3F, 0xC0, 0x8A, 0xD3, 0xEF, 0x5B, 0xE1, 0x56, 0x91,
+    0x1C, 0x50, 0xDE, 0xC2, 0x17, 0x24, 0x6A, 0x89, 0x33, 0x0A, 0x1D, 0x03, 0x09, 0x23, 0x71, 0x60,
+    0x96, 0x04, 0x79, 0xD3, 0xE7, 0x9A, 0x10, 0xDD, 0x09, 0xCA, 0xD5, 0x9A, 0x3C, 0x39, 0x7D, 0x1E,
+    0x37, 0x48, 0xDC, 0x03, 0x8E, 0x03, 0xD8, 0x21, 0xE7, 0x75, 0xF6, 0xB0, 0xB3, 0x39, 0xDC, 0xC5,
+    0xCB, 0x70, 0xE4, 0x58, 0xD1, 0xAC, 0x6E, 0x85, 0x77, 0xEE, 0xB8, 0x7D, 0x99, 0x8B, 0xD4, 0x49,
+    0xC7, 0xC5, 0xCE, 0x0E, 0x7E, 0x67, 0x16, 0x76, 0x24, 0xD8, 0x9E, 0xAC, 0xC4, 0x64, 0x01, 0xBA,
+    0xD1, 0xDE, 0xF7, 0xE1, 0x9E, 0x68, 0xDC, 0xF7, 0x98, 0x86, 0x13, 0x0A, 0xEE, 0xA0, 0xB6, 0xBF,
+    0x55, 0x62, 0xC6, 0xC0, 0xF4, 0xE5, 0x52, 0xF8, 0xAE, 0x7A, 0x89, 0xAE, 0xB3, 0x44, 0x9B, 0x7C,
+    0xCC, 0x41, 0x5D, 0x84, 0x22, 0x74, 0xF0, 0x63, 0x86, 0x19, 0x63, 0xCD, 0xFD, 0x08, 0x63, 0xCF,
+    0xC3, 0xF5, 0xB5, 0x87, 0x51, 0xD6, 0x63, 0x4E, 0x1A, 0x75, 0x2D, 0xC4, 0x6B, 0x0A, 0xD4, 0x0D,
+    0x29, 0xC5, 0xC7, 0x0E, 0xB9, 0x72, 0xA7, 0xD3, 0xAB, 0x1E, 0xA1, 0xEA, 0x02, 0x97, 0x1C, 0x19,
+    0x4B, 0x6E, 0xA0, 0xE3, 0x28, 0xE7, 0x18, 0xDB, 0x6D, 0x5C, 0xCC, 0x70, 0xA2, 0x35, 0x43, 0x24,
+    0x06, 0xEB, 0xC6, 0x40, 0x7E, 0x98, 0x38, 0x6F, 0xC6, 0x37, 0x9D, 0x49, 0x6A, 0x50, 0xBD, 0xC2,
+    0x2B, 0x88, 0xF8, 0x25, 0x32, 0x5D, 0x88, 0x44, 0xF8, 0xED, 0xBF, 0xF9, 0xB6, 0xFA, 0xB0, 0x12,
+    0x8D, 0x4B, 0xD1, 0x7C, 0x40, 0xD1, 0xB4, 0x6E, 0xAC, 0x09, 0xCE, 0x3B, 0x61, 0x35, 0x88, 0xB9,
+    0xC8, 0x04, 0xDC, 0xD5, 0xFB, 0xE8, 0x05, 0x4B, 0x5C, 0xD8, 0xC4, 0xE2, 0x35, 0x94, 0xBD, 0xAC,
+    0x1C, 0xC7, 0x40, 0x29, 0xC0, 0x15, 0x49, 0x5A, 0x28, 0x74, 0xED, 0xA2, 0x34, 0x51, 0x3B, 0x6B,
+    0xC0, 0x5B, 0x8E, 0xF1, 0x41, 0x90, 0x63, 0x56, 0x63, 0xA9, 0xB2, 0xD5, 0x98, 0xD1, 0x05, 0x03,
+    0x5F, 0x52, 0x98, 0xAC, 0x99, 0xDF, 0x67, 0x30, 0x7F, 0x1E, 0xDE, 0x38, 0x34, 0x58, 0xAB, 0x6E,
+    0xA6, 0x09, 0xD0, 0xDD, 0x82, 0x00, 0xE4, 0xD6, 0x4A, 0xC5, 0x6E, 0x6E, 0x57, 0x15, 0x20, 0x6F,
+    0xDF, 0x6F, 0xFF, 0x1D, 0x72, 0x80, 0xBF, 0xFC, 0x89, 0x51, 0xB1, 0x45, 0xCF, 0xA0, 0x5B, 0xCE,
+    0x71, 0x29, 0xDB, 0xBB, 0x18, 0x0C, 0x81, 0xC6, 0xFA, 0xCD, 0xCA, 0x33, 0x0A, 0x4A, 0xA6, 0x74,
+    0x6B, 0xDF, 0xEC, 0x9D, 0xE8, 0xD9, 0x0D, 0xF6, 0x57, 0xD4, 0x6F, 0x77, 0x55, 0x16, 0xF0, 0xE7,
+    0xB7, 0x74, 0x6F, 0xFA, 0xF5, 0x3F, 0xBE, 0xF1, 0x52, 0x2A, 0x49, 0xC7, 0xA0, 0xAA, 0x18, 0x88,
+    0x3B, 0x16, 0xBE, 0x48, 0x44, 0xB2, 0x08, 0x2B, 0x25, 0xC8, 0x92, 0xE8, 0x19, 0x47, 0x4F, 0x13,
+    0xCA, 0x74, 0xD9, 0x15, 0x54, 0xD4, 0xFF, 0x55, 0x72, 0x89, 0x64, 0x30, 0x1B, 0x98, 0x39, 0xF8,
+    0x90, 0xD4, 0x3B, 0x3B, 0xFD, 0x42, 0x66, 0x32, 0xF5, 0xF2, 0x07, 0x1D, 0x0D, 0x94, 0x9D, 0x04,
+    0x61, 0x51, 0x1A, 0xC3, 0x64, 0x87, 0x7C, 0x3B, 0x89, 0x99, 0x89, 0xCC, 0xF3, 0xDB, 0xBA, 0x13,
+    0xE3, 0x2B, 0x22, 0xEA, 0xF1, 0x1C, 0xB2, 0x3F, 0xFF, 0x12, 0xCE, 0x17, 0x9F, 0x62, 0x6E, 0xFF,
+    0xD1, 0x9F, 0x08, 0x2B, 0x5C, 0x63, 0xF7, 0x15, 0x6C, 0x61, 0x6C, 0x69, 0xA1, 0x47, 0xF4, 0xB7,
+    0xE6, 0xAB, 0x53, 0x18, 0x67, 0xE0, 0x51, 0x7A, 0xF8, 0x25, 0xA9, 0xA1, 0xB8, 0x21, 0x4F, 0x51,
+    0x7B, 0xAD, 0x0C, 0xCE, 0xF9, 0x7C, 0x89, 0xA7, 0x8B, 0x97, 0xFE, 0xEC, 0xD0, 0x8A, 0xD2, 0x07,
+    0x54, 0x3B, 0xFF, 0x3E, 0x25, 0xCD, 0xFA, 0x77, 0xA0, 0xC3, 0x66, 0xBD, 0x48, 0x89, 0x6B, 0xC2,
+    0xDD, 0x3C, 0xE5, 0xF4, 0x79, 0x55, 0xD6, 0xEA, 0x95, 0xC7, 0x10, 0xEC, 0x54, 0x32, 0xC3, 0x20,
+    0xB2, 0xD4, 0x2B, 0xF6, 0x65, 0x7D, 0xD4, 0x52, 0x98, 0xC6, 0x13, 0x6A, 0xA3, 0xEC, 0x29, 0x7B,
+    0x57, 0xFA, 0x5D, 0xE8, 0xF2, 0xE5, 0x01, 0xC7, 0x96, 0xB6, 0x88, 0x6C, 0xF5, 0x4A, 0x7D, 0xB3,
+    0x72, 0xFA, 0xAC, 0xD4, 0xE2, 0x34, 0xE4, 0x77, 0x15, 0xE9, 0x57, 0xC8, 0x92, 0x99, 0xFA, 0x0B,
+    0xFD, 0x49, 0xBF, 0x7C, 0x6C, 0x53, 0xC0, 0x46, 0x68, 0x2A, 0x75, 0xC6, 0x0A, 0x95, 0xAF, 0x94,
+    0xFA, 0xF8, 0x9C, 0x7D, 0xDE, 0x58, 0x50, 0x18, 0xBB, 0xDA, 0x02, 0xA9, 0xC3, 0xFA, 0xC7, 0xDA,
+    0x83, 0x52, 0x5F, 0x95, 0x86, 0x55, 0x68, 0xAD, 0x7C, 0x38, 0xA9, 0xD4, 0x1E, 0x8A, 0xAA, 0xBB,
+    0xBC, 0xAB, 0xDF, 0xF7, 0xCB, 0x7C, 0xFD, 0x4A, 0x43, 0x27, 0xE5, 0x52, 0xC6, 0xA2, 0xCA, 0xAB,
+    0xFA, 0xF5, 0xAA, 0x9A, 0x3B, 0xBE, 0xAD, 0x13, 0xF3, 0x7F, 0x68, 0x48, 0xEC, 0x36, 0xD0, 0xAE,
+    0xA3, 0xD5, 0x44, 0xAB, 0x8B, 0xFE, 0x0B, 0x2D, 0x71, 0x3B, 0xD9, 0xEF, 0xB4, 0xDA, 0x7F, 0x8D,
+    0x27, 0x24, 0xF5, 0x8D, 0xC9, 0xBA, 0x6F, 0xC0, 0xA2, 0x81, 0x1A, 0xC5, 0xB2, 0x89, 0x26, 0xF6,
+    0x89, 0x5A, 0x5B, 0x1F, 0x2A, 0x59, 0xA3, 0xDE, 0xD9, 0x68, 0x6F, 0xB4, 0xEA, 0xED, 0xE6, 0x21,
+    0xFF, 0x51, 0xD9, 0xB4, 0xD0, 0xB4, 0xB1, 0xBF, 0x81, 0x4E, 0x1D, 0xED, 0xD2, 0xDA, 0x1B, 0xA5,
+    0x35, 0x33, 0x7B, 0xC0, 0x1D, 0x2D, 0xAA, 0x6D, 0x88, 0x3E, 0xAD, 0x31, 0x5F, 0x7D, 0xDA, 0x59,
+    0xBE, 0xF9, 0x5F, 0xD4, 0x25, 0x3A, 0x0D, 0xB4, 0xEA, 0x18, 0x36, 0x31, 0xFC, 0xDA, 0x3D, 0x04,
+    0xE5, 0x58, 0xBF, 0x72, 0x7E, 0xD1, 0xDC, 0xD8, 0xAD, 0xB7, 0x37, 0x5B, 0xCD, 0xE1, 0x3E, 0xEE,
+    0xDD, 0xC9, 0xC7, 0x0F, 0x1B, 0xBF, 0xDC, 0x6F, 0xD8, 0xED, 0xE6, 0x46, 0x6B, 0xBF, 0x3E, 0xEC,
+    0x6C, 0x4E, 0xDA, 0x4D, 0xFF, 0xDE, 0xDA, 0xDD, 0x4B, 0xE9, 0xD7, 0x19, 0xD6, 0x2E, 0x83, 0x6A,
+    0x95, 0xA7, 0x70, 0x9D, 0x94, 0xDD, 0x7E, 0x1F, 0xE2, 0x67, 0x3C, 0x50, 0x8F, 0x37, 0x87, 0xBB,
+    0xAD, 0x61, 0x2B, 0x7E, 0x3D, 0xFA, 0x29, 0x4F, 0xC4, 0x35, 0xDC, 0xAD, 0x41, 0x34, 0x61, 0xCD,
+    0x74, 0xCF, 0xB7, 0x63, 0xD4, 0x87, 0x68, 0xB7, 0x75, 0x2B, 0xF9, 0x3F, 0xE5, 0x7D, 0x3D, 0x90,
+    0xDC, 0xD6, 0x9D, 0xE7, 0x03, 0x5A, 0x64, 0xAF, 0x89, 0x5A, 0x83, 0x81, 0x58, 0x3E, 0x4B, 0x75,
+    0xC6, 0x06, 0xBB, 0x55, 0x5E, 0x6F, 0xD9, 0x48, 0x77, 0xAB, 0xCC, 0x01, 0x28, 0x05, 0x17, 0x38,
+    0x10, 0x03, 0x8D, 0x74, 0x75, 0x0C, 0xE8, 0xC0, 0x81, 0x3F, 0x6A, 0x77, 0x92, 0x0B, 0x5C, 0x5B,
+    0x9C, 0x06, 0x74, 0x0A, 0x1C, 0x28, 0x30, 0x03, 0x4B, 0x17, 0x2E, 0x03, 0xDD, 0x95, 0x3D, 0xAC,
+    0x3A, 0x6E, 0xE0, 0x40, 0x55, 0xD7, 0x1F, 0x90, 0x5C, 0x5B, 0x0A, 0x1C, 0x08, 0x27, 0x97, 0x76,
+    0x83, 0x0D, 0x0C, 0xDB, 0xA2, 0xBD, 0x4B, 0x05, 0x84, 0x2D, 0xF0, 0x88, 0x19, 0xA1, 0x1B, 0xF7,
+    0xFF, 0xFD, 0xFE, 0x0F, 0xE8, 0x8F, 0xE9, 0x21, 0x29, 0xAF, 0x68, 0x52, 0x7B, 0x23, 0xF6, 0xC3,
+    0xA8, 0xA7, 0x1B, 0xEF, 0xBD, 0xFF, 0xFB, 0x7F, 0x7F, 0xC1, 0x98, 0x6F, 0x19, 0xF9, 0x89, 0x30,
+    0x04, 0xA9, 0x0C, 0x5E, 0x26, 0xC3, 0x20, 0xC7, 0xFF, 0x17, 0x66, 0xE5, 0x27, 0x6C, 0xDB, 0xCC,
+    0x44, 0x18, 0x92, 0xB6, 0x4D, 0xCD, 0x04, 0xEF, 0x8D, 0x31, 0x34, 0xDD, 0xE0, 0xD4, 0x32, 0xB8,
+    0x15, 0xBE, 0x5E, 0x62, 0x38, 0x3A, 0x78, 0xDD, 0x0C, 0xDA, 0xB6, 0x34, 0x43, 0x0C, 0x1E, 0x6E,
+    0xE9, 0x67, 0xDD, 0xC0, 0xB9, 0x82, 0x18, 0x37, 0xEE, 0xE7, 0xE7, 0x90, 0x1C, 0x1C, 0xC4, 0x66,
+    0x86, 0x29, 0xDA, 0xB6, 0x8D, 0xBB, 0xD9, 0xDF, 0xF0, 0x31, 0x49, 0x28, 0xFF, 0x5F, 0xE3, 0xF3,
+    0xD7, 0x3E, 0xFF, 0x18, 0x2C, 0x4D, 0x66, 0x5C, 0x60, 0xC6, 0x05, 0xDE, 0x9B, 0xCB, 0xA7, 0xE3,
+    0xB5, 0x4F, 0xEF, 0x60, 0x18, 0x61, 0xE0, 0x82, 0x9A, 0x5D, 0xF9, 0x73, 0xDB, 0xD6, 0xC6, 0xC1,
+    0x37, 0x9C, 0xB9, 0x33, 0x8B, 0x65, 0x41, 0x61, 0x26, 0x0B, 0xF2, 0x39, 0xE4, 0xC3, 0x42, 0x06,
+    0x59, 0x8B, 0x9F, 0xC9, 0x32, 0x38, 0x84, 0xA9, 0x0C, 0x49, 0x1C, 0xBC, 0xF4, 0xC2, 0xC2, 0x84,
+    0x17, 0xDA, 0xC6, 0x44, 0x4E, 0x8B, 0xB5, 0x3E, 0xC9, 0x6D, 0x9F, 0xC1, 0x3A, 0xA3, 0xD8, 0x4E,
+    0xE0, 0x54, 0xDD, 0xB9, 0x79, 0xF1, 0x06, 0x70, 0x52, 0x2C, 0x35, 0xC5, 0x52, 0xE3, 0x07, 0x01,
+    0x0E, 0x07, 0x9C, 0xFD, 0x10, 0xC3, 0xC9, 0xC0, 0x59, 0xDF, 0xEE, 0xCA, 0x4E, 0x57, 0x66, 0x7F,
+    0xBA, 0xAD, 0x74, 0xC3, 0xDE, 0xE2, 0xB5, 0xC6, 0x84, 0x85, 0x79, 0xC2, 0xCC, 0xF0, 0xBD, 0x39,
+    0xE6, 0xC0, 0xBC, 0x43, 0xCC, 0xE6, 0x15, 0xFD, 0x1C, 0xB7, 0x0E, 0x7E, 0x68, 0x82, 0x56, 0xB6,
+    0x1A, 0x72, 0x88, 0xBB, 0x2D, 0x46, 0xFD, 0x94, 0x21, 0x57, 0xC0, 0x0F, 0x73, 0x91, 0x5C, 0x7D,
+    0xFB, 0xEA, 0x5F, 0x1B, 0x39, 0x06, 0xB9, 0x6D, 0xD0, 0xE2, 0x8D, 0x73, 0xDD, 0x02, 0x1C, 0x99,
+    0xDB, 0xF8, 0x44, 0x90, 0x9B, 0x37, 0xE4, 0xE0, 0x8C, 0x63, 0x37, 0x8D, 0xC1, 0xAD, 0xBB, 0xED,
+    0xF3, 0x7F, 0x0D, 0xF1, 0x2D, 0xE2, 0x62, 0xE6, 0xBC, 0x2B, 0xA6, 0x4A, 0x08, 0x85, 0xB2, 0x5B,
+    0xB0, 0xB3, 0x84, 0x5B, 0xA3, 0xEF, 0x9D, 0xC5, 0x5F, 0x47, 0xBB, 0xB3, 0x42, 0x21, 0x1C, 0x72,
+    0x01, 0xBB, 0x46, 0xF1, 0x27, 0x22, 0x64, 0x26, 0xFC, 0xD7, 0xE0, 0x9F, 0x4C, 0x27, 0xB0, 0x16,
+    0x20, 0xEB, 0x3F, 0x81, 0x31, 0x8F, 0x1C, 0xFF, 0x04, 0xB6, 0xB2, 0x43, 0xF9, 0x17, 0xAD, 0x7C,
+    0xCF, 0x42, 0xF3, 0xCA, 0x15, 0xD3, 0x34, 0xF8, 0xF7, 0x8D, 0x6F, 0x74, 0x07, 0xFB, 0x89, 0xDD,
+    0x7C, 0x62, 0x37, 0xD4, 0x28, 0x30, 0x80, 0x49, 0x40, 0x07, 0x20, 0x02, 0x5E, 0x40, 0x03, 0x60,
+    0x01, 0x0E, 0xA8, 0x7B, 0x01, 0x0D, 0x70, 0x1A, 0x91, 0x3D, 0xFE, 0x1D, 0x8B, 0x01, 0x1B, 0xB7,
+    0xE2, 0x6D, 0xEC, 0xAD, 0xE4, 0xB4, 0xFE, 0x6C, 0x06, 0x3A, 0x95, 0x25, 0xC8, 0x9F, 0x4E, 0x71,
+    0x6A, 0x17, 0xB8, 0x01, 0x30, 0xDA, 0xEB, 0x90, 0x94, 0x44, 0x2E, 0xC4, 0xB5, 0xF9, 0xDD, 0x35,
+    0xE5, 0x31, 0xC9, 0x9C, 0x7A, 0x8D, 0x14, 0x61, 0xE5, 0x4A, 0x74, 0x95, 0xB9, 0x07, 0x47, 0x17,
+    0x89, 0xD9, 0x43, 0x72, 0x8D, 0xC6, 0x78, 0x6D, 0x2B, 0xEB, 0xAE, 0x65, 0xE5, 0x4F, 0x57, 0xD8,
+    0x92, 0x9F, 0xB9, 0x8D, 0x71, 0x4B, 0xBD, 0xA3, 0x7C, 0x49, 0x76, 0xD0, 0x60, 0x6B, 0xB2, 0x8B,
+    0x06, 0xDB, 0x8B, 0xF0, 0x25, 0xF9, 0x63, 0x84, 0x85, 0xCB, 0x1F, 0x23, 0x2C, 0x9C, 0x80, 0x0A,
+    0xCA, 0x2F, 0xC9, 0xDA, 0xA6, 0x07, 0x6D, 0x16, 0x35, 0x20, 0xE1, 0x05, 0x51, 0x84, 0xB7, 0x37,
+    0xCB, 0xB3, 0x08, 0x2C, 0x39, 0x10, 0x47, 0x47, 0x96, 0x28, 0x26, 0xF6, 0x3A, 0xB6, 0xF4, 0x21,
+    0xDF, 0xDF, 0xB7, 0xD7, 0x89, 0x45, 0xBD, 0xC6, 0x12, 0x1F, 0x91, 0xA9, 0x52, 0x6C, 0x14, 0x68,
+    0xB4, 0xA0, 0x58, 0xBD, 0xCA, 0x39, 0xDE, 0xDC, 0x7D, 0xF1, 0xCE, 0x1E, 0x97, 0x39, 0x28, 0x9D,
+    0x05, 0x96, 0x29, 0x2B, 0x4F, 0x70, 0xE5, 0xCA, 0x65, 0xB9, 0x5C, 0xB9, 0xAC, 0x41, 0xAE, 0x23,
+    0xAC, 0x41, 0xAE, 0x13, 0xCC, 0x1D, 0xA4, 0x82, 0xA6, 0x5C, 0x96, 0x10, 0x0A, 0x96, 0x75, 0x20,
+    0x78, 0x8A, 0x65, 0xE1, 0xFE, 0x32, 0x67, 0xD2, 0xBE, 0x6F, 0x3E, 0x2E, 0x27, 0x3B, 0x47, 0x4E,
+    0xD6, 0x80, 0xB0, 0x85, 0x9E, 0xE6, 0x71, 0x92, 0xB9, 0x55, 0xC7, 0xC4, 0x06, 0x60, 0xA7, 0xE0,
+    0x64, 0x59, 0xCF, 0xC9, 0x52, 0x62, 0x1F, 0xD8, 0x59, 0x4C, 0xB8, 0x12, 0x07, 0x23, 0x7B, 0x47,
+    0xE7, 0x75, 0xD3, 0xF1, 0x1C, 0xE5, 0x00, 0xCA, 0x74, 0xCD, 0x15, 0x8E, 0xA5, 0x59, 0xFF, 0x51,
+    0x9C, 0x8F, 0xC8, 0x3F, 0x46, 0xC4, 0xAC, 0x09, 0xB9, 0xC0, 0x98, 0x5C, 0xA1, 0x31, 0x33, 0x2C,
+    0xCF, 0x21, 0xF2, 0x81, 0xB1, 0xB8, 0x95, 0x9F, 0xE3, 0xE6, 0x60, 0x1E, 0x03, 0x22, 0xD6, 0x80,
+    0xC4, 0x39, 0x6C, 0x1B, 0x72, 0xB6, 0x39, 0x27, 0x1D, 0x71, 0x8C, 0xC8, 0xDC, 0x42, 0xE2, 0x35,
+    0x16, 0x12, 0x12, 0xE7, 0x23, 0x32, 0x28, 0xC5, 0xB2, 0x11, 0x0F, 0xA7, 0x23, 0x35, 0x85, 0x85,
+    0x7B, 0xCD, 0x74, 0xCC, 0xB3, 0xA3, 0xA6, 0xF3, 0x1C, 0x03, 0x8E, 0xDE, 0xF1, 0xF5, 0x0B, 0xAF,
+    0xC0, 0xB1, 0x94, 0x3C, 0x0C, 0x1E, 0x85, 0xB0, 0xF4, 0x89, 0x10, 0x02, 0xF0, 0x72, 0x78, 0x1B,
+    0xA3, 0xFF, 0x0E, 0xB0, 0x3D, 0x0A, 0x52, 0xB9, 0xEF, 0x24, 0x8C, 0xE5, 0xC8, 0x6B, 0xAC, 0x60,
+    0x50, 0x60, 0xC4, 0x7A, 0x87, 0x45, 0x28, 0x5F, 0xF1, 0xF2, 0x7D, 0xD9, 0xB8, 0x9F, 0xD5, 0xF8,
+    0xCA, 0x4F, 0x4A, 0x19, 0x83, 0x57, 0x32, 0xF9, 0x62, 0x78, 0x99, 0x92, 0x65, 0x84, 0x45, 0x47,
+    0xC4, 0xF5, 0x88, 0xAC, 0x20, 0xC9, 0x31, 0xCE, 0x52, 0x6C, 0xAC, 0xB5, 0xD0, 0x7E, 0xDD, 0x00,
+    0xFE, 0x8D, 0x0B, 0x40, 0x4F, 0x2F, 0x01, 0xA3, 0x23, 0x32, 0xBD, 0xD3, 0x87, 0xEB, 0x0B, 0x07,
+    0x4F, 0xF0, 0x71, 0x73, 0x00, 0x1A, 0x68, 0xC3, 0xDD, 0xCE, 0x01, 0x05, 0x80, 0x9B, 0x73, 0xC9,
+    0xBE, 0xC0, 0xC8, 0x43, 0x65, 0x10, 0x31, 0x90, 0xC8, 0x4F, 0x23, 0x02, 0x17, 0x80, 0xF6, 0xDE,
+    0x24, 0xE8, 0x7F, 0x46, 0x4E, 0xFA, 0x9B, 0x9C, 0x87, 0x91, 0x91, 0x05, 0x00, 0xDB, 0x1C, 0x92,
+    0xBF, 0x32, 0x57, 0xF2, 0x59, 0x65, 0xB9, 0x22, 0x20, 0x65, 0x78, 0x81, 0x1F, 0x51, 0xCE, 0xA0,
+    0x64, 0xF7, 0xE4, 0x12, 0x9E, 0x40, 0x7C, 0x45, 0x7B, 0xD0, 0xC1, 0xA4, 0x1B, 0x49, 0xD7, 0x4A,
+    0xD5, 0x4A, 0xD3, 0xF2, 0x01, 0x97, 0x08, 0x83, 0xA5, 0x8E, 0x39, 0x36, 0x76, 0x14, 0xB0, 0x38,
+    0xE0, 0x14, 0x86, 0x78, 0x6C, 0x28, 0x92, 0x2D, 0x8F, 0xC0, 0x18, 0x5B, 0x3E, 0xA1, 0x5C, 0xC2,
+    0xEF, 0x26, 0x14, 0x75, 0x40, 0x24, 0xCA, 0x8C, 0xBA, 0x40, 0xAB, 0xCA, 0xCA, 0x90, 0x7A, 0x93,
+    0x8E, 0x54, 0xA4, 0x2C, 0x4E, 0xFB, 0x80, 0xA9, 0x65, 0x79, 0x96, 0xA8, 0x28, 0x06, 0x5B, 0x22,
+    0xA6, 0xFC, 0x71, 0xF8, 0x73, 0x19, 0xFC, 0x77, 0x00, 0xB8, 0xEF, 0xCB, 0x10, 0xE1, 0xCB, 0x23,
+    0x0C, 0x0D, 0x57, 0x35, 0x04, 0xE1, 0x93, 0x9B, 0x0F, 0x0A, 0xA5, 0xB4, 0x10, 0x7C, 0x21, 0xC1,
+    0xB0, 0x38, 0xB8, 0x5E, 0x0A, 0xDC, 0xDC, 0x4A, 0xDE, 0x95, 0x4F, 0x62, 0x2B, 0x32, 0xA9, 0x53,
+    0x93, 0x22, 0x30, 0x55, 0x33, 0x25, 0x6E, 0x86, 0xE0, 0x58, 0x42, 0xE9, 0x39, 0xBE, 0x96, 0xDD,
+    0x47, 0x11, 0xB8, 0x73, 0x91, 0x5C, 0x28, 0xB5, 0x5A, 0x52, 0x71, 0x09, 0xCC, 0xC7, 0x99, 0x63,
+    0x3B, 0x53, 0x05, 0xB6, 0xC0, 0x66, 0x04, 0xD0, 0x4C, 0x70, 0x08, 0x60, 0x31, 0x2E, 0x06, 0xAF,
+    0x12, 0xB0, 0xC8, 0x3C, 0x33, 0x05, 0xCA, 0xFB, 0x38, 0xA3, 0xC5, 0x55, 0x60, 0xD5, 0xC2, 0x74,
+    0xF3, 0x8A, 0x16, 0x30, 0x06, 0x59, 0x11, 0xFA, 0x18, 0x64, 0xDE, 0x61, 0x01, 0xD0, 0x83, 0x7B,
+    0x44, 0xE9, 0xE0, 0xE8, 0xFA, 0x02, 0xF3, 0xE6, 0xE0, 0xE5, 0xD8, 0xB3, 0x43, 0xC6, 0x4C, 0x76,
+    0x17, 0xC5, 0x94, 0x63, 0x32, 0x6F, 0x14, 0x93, 0x19, 0xC8, 0x06, 0x67, 0x98, 0x7C, 0x2E, 0xF3,
+    0xDE, 0xA8, 0x31, 0xAF, 0x20, 0x77, 0x7B, 0xF8, 0x48, 0x15, 0x9F, 0x44, 0x65, 0x03, 0xD7, 0x02,
+    0x4E, 0xC9, 0x4B, 0xCD, 0xDB, 0x28, 0x82, 0x59, 0xDC, 0xC2, 0x05, 0x37, 0x93, 0xE9, 0x22, 0x9D,
+    0x50, 0xA9, 0x45, 0x2F, 0x29, 0xEF, 0x1C, 0xE8, 0xCA, 0x43, 0xBD, 0xBB, 0xA2, 0x33, 0xFE, 0x50,
+    0x1B, 0x2B, 0xEF, 0xAD, 0xCC, 0xB7, 0x12, 0x1F, 0x14, 0x88, 0x4B, 0x40, 0x09, 0x01, 0xAD, 0x49,
+    0xEE, 0x7A, 0xA6, 0x15, 0x4C, 0x3D, 0x82, 0x5A, 0x05, 0x86, 0x1D, 0xEA, 0xC5, 0x72, 0x76, 0x5E,
+    0xF6, 0x95, 0xC5, 0x4F, 0x3A, 0xE1, 0x64, 0xC1, 0x44, 0x22, 0xBB, 0xF8, 0xE8, 0x54, 0x7F, 0xD1,
+    0x66, 0x43, 0x30, 0x19, 0x60, 0x05, 0x98, 0x82, 0x53, 0x59, 0x16, 0xD3, 0x40, 0xC6, 0x65, 0x58,
+    0xC4, 0x04, 0x9C, 0x48, 0x56, 0x4F, 0xA6, 0x2F, 0x9F, 0x6E, 0x20, 0x13, 0x64, 0x86, 0xDA, 0xE7,
+    0x9C, 0x6F, 0xD6, 0x11, 0x26, 0x1B, 0xBE, 0x5B, 0x4D, 0xAD, 0x96, 0xD1, 0xD8, 0xAB, 0x0A, 0x1C,
+    0x7B, 0x8D, 0xBE, 0xF7, 0x2E, 0x39, 0xF8, 0xCC, 0xCB, 0x28, 0x8E, 0x1B, 0x9F, 0xD7, 0x61, 0x69,
+    0x85, 0x43, 0x1E, 0x90, 0x8F, 0x09, 0xCA, 0x91, 0xAB, 0x2D, 0x94, 0xC7, 0x11, 0xE1, 0x21, 0x82,
+    0x4B, 0x59, 0x80, 0x40, 0x3B, 0xC8, 0x94, 0x0F, 0x26, 0x38, 0x32, 0x2B, 0x12, 0x54, 0x03, 0x06,
+    0xF0, 0x64, 0x78, 0x8D, 0xFC, 0x2E, 0xC8, 0x3B, 0x8D, 0x77, 0xB8, 0x05, 0xD7, 0x64, 0x3B, 0x67,
+    0xAE, 0x37, 0x50, 0x63, 0xAF, 0x02, 0xF0, 0x05, 0x97, 0xD3, 0xA3, 0x59, 0xB4, 0x01, 0x30, 0x0C,
+    0x0B, 0xFD, 0xC8, 0x68, 0x77, 0xAF, 0xC2, 0xF9, 0x08, 0xCC, 0xA8, 0x4A, 0x9D, 0x7B, 0x2C, 0xE5,
+    0xCD, 0x53, 0xE6, 0x4B, 0x5C, 0x16, 0xF0, 0x2D, 0x78, 0x95, 0x52, 0x98, 0x47, 0xE0, 0x4C, 0xE3,
+    0xC7, 0x5B, 0x52, 0x3E, 0x7E, 0x9A, 0x87, 0xA5, 0x11, 0x2B, 0x78, 0x40, 0xD2, 0x9D, 0x30, 0xB4,
+    0xD2, 0x10, 0x2C, 0x64, 0x62, 0x3A, 0x49, 0xD8, 0xF1, 0x8E, 0x9E, 0x85, 0x90, 0x66, 0xC7, 0x8A,
+    0xA8, 0x2A, 0x08, 0x85, 0xA9, 0xE0, 0x22, 0x64, 0x06, 0xA4, 0x14, 0x9D, 0x60, 0xC8, 0x3D, 0x70,
+    0x39, 0x54, 0xE9, 0x8C, 0x35, 0x27, 0xAC, 0x3D, 0x61, 0x6D, 0x0A, 0x0B, 0x18, 0x28, 0xC9, 0xF8,
+    0x4D, 0xA5, 0x2E, 0x54, 0xE4, 0xD1, 0xCA, 0x71, 0xCA, 0x2D, 0xBC, 0x9A, 0xEF, 0x06, 0x35, 0x4D,
+    0x2A, 0xB1, 0x01, 0x66, 0x32, 0x59, 0x52, 0x99, 0xA9, 0x5C, 0x16, 0xA5, 0x39, 0x12, 0xF1, 0xF5,
+    0x61, 0x69, 0x0E, 0x85, 0x8F, 0xFD, 0xAA, 0x70, 0xEE, 0xC8, 0xB4, 0x6F, 0xE7, 0x6E, 0x29, 0xFC,
+    0xF2, 0x15, 0x11, 0x0B, 0x72, 0x4A, 0x10, 0x7B, 0xB5, 0x39, 0x2F, 0x97, 0x42, 0xCE, 0x31, 0x48,
+    0x87, 0xF9, 0xD8, 0xA9, 0x82, 0xD8, 0xCB, 0xC6, 0x83, 0x12, 0xF4, 0x78, 0x65, 0x98, 0x0B, 0x39,
+    0xA6, 0x57, 0xA0, 0x73, 0x04, 0xE9, 0xF9, 0x80, 0xE2, 0xE9, 0xFC, 0x0E, 0x05, 0xD4, 0xCE, 0x98,
+    0x22, 0x2A, 0x02, 0x02, 0xEC, 0x98, 0x10, 0x18, 0xB0, 0x2F, 0x6B, 0x12, 0x10, 0x4C, 0x84, 0x6C,
+    0x05, 0x04, 0x82, 0x11, 0x31, 0xF6, 0x1E, 0x52, 0x7A, 0x47, 0xDC, 0xE8, 0xC8, 0xA8, 0x16, 0x8D,
+    0x71, 0x6C, 0xD4, 0x60, 0xB0, 0xA3, 0x9A, 0x21, 0x6A, 0x84, 0x74, 0x47, 0x24, 0x4C, 0xEF, 0x60,
+    0xCE, 0xF3, 0x68, 0x78, 0x1C, 0x54, 0xD7, 0xD5, 0xA6, 0x70, 0xC8, 0xFC, 0xE5, 0xC3, 0xBD, 0x42,
+    0xA1, 0x9C, 0x9F, 0x8C, 0xCD, 0xB2, 0xFF, 0x8D, 0x09, 0x1B, 0xCB, 0x27, 0xF5, 0x67, 0xB6, 0x20,
+    0xA5, 0x40, 0x90, 0x44, 0x87, 0x42, 0xE7, 0xA2, 0x38, 0x0C, 0x1A, 0x32, 0x86, 0x39, 0xD1, 0x44,
+    0x64, 0x23, 0x51, 0x06, 0x66, 0x71, 0x44, 0x8C, 0x8C, 0x62, 0xE5, 0x58, 0x3A, 0x8E, 0x78, 0xF0,
+    0x53, 0x8E, 0x73, 0x32, 0x0E, 0x8C, 0x53, 0x8E, 0x0D, 0x46, 0xC1, 0xDC, 0x29, 0xED, 0x8F, 0x84,
+    0x26, 0xB9, 0xA0, 0xAD, 0xB0, 0x29, 0x39, 0xB4, 0x44, 0x2C, 0x8B, 0xC3, 0x4B, 0x0B, 0xE2, 0x59,
+    0x45, 0xD1, 0x86, 0x45, 0x39, 0x17, 0xAD, 0x67, 0x41, 0xE5, 0x82, 0x0A, 0x06, 0xD5, 0x29, 0x64,
+    0xD1, 0xE3, 0x6D, 0xCA, 0x97, 0xC2, 0x4A, 0xF5, 0xC4, 0x49, 0xA7, 0x7C, 0x15, 0x56, 0xF9, 0xA2,
+    0x99, 0xB6, 0x84, 0xD2, 0x3D, 0x94, 0xAF, 0x5E, 0x05, 0xEB, 0x61, 0xD5, 0x1D, 0x48, 0xAF, 0x68,
+    0xD0, 0xA8, 0x69, 0x31, 0x4B, 0x82, 0x73, 0x13, 0xC0, 0xF0, 0x24, 0xA8, 0xC0, 0x60, 0x9E, 0xCE,
+    0x56, 0x09, 0x30, 0x44, 0xF1, 0xA0, 0x70, 0x5A, 0x9C, 0x97, 0xB5, 0x18, 0xFD, 0x5B, 0x3F, 0xBA,
+    0x9F, 0x98, 0xDA, 0xEE, 0xE9, 0xD8, 0x53, 0x7D, 0x45, 0x98, 0xCA, 0xD1, 0xA5, 0x12, 0xBC, 0xE3,
+    0xAC, 0x3B, 0x57, 0x93, 0xCE, 0x3A, 0x2A, 0xE8, 0xB2, 0xA0, 0xF3, 0x62, 0xE3, 0x56, 0xD3, 0xFE,
+    0x7E, 0xF3, 0x7E, 0x98, 0xF4, 0x7F, 0x20, 0x8F, 0xA7, 0x14, 0x0B, 0x28, 0x29, 0x16, 0xBB, 0x3F,
+    0x06, 0xED, 0x57, 0xD8, 0x25, 0xDE, 0x78, 0x9E, 0xD2, 0xA5, 0x4D, 0x71, 0x02, 0xA9, 0x2A, 0xA3,
+    0x2B, 0x22, 0x65, 0x8B, 0xE4, 0xDD, 0x50, 0x5F, 0xB6, 0x6D, 0x69, 0x29, 0xD2, 0xB7, 0x68, 0x48,
+    0xCB, 0xBB, 0x3F, 0xA6, 0x46, 0x41, 0xFF, 0xA3, 0xBA, 0x77, 0x47, 0x47, 0xDC, 0xB7, 0x1C, 0x93,
+    0x25, 0x25, 0x7C, 0x25, 0x39, 0x9C, 0xED, 0xD5, 0x98, 0x65, 0x22, 0xAA, 0xED, 0xA0, 0xA6, 0x36,
+    0x21, 0xAB, 0xB5, 0x72, 0xBD, 0xA1, 0xC1, 0x0A, 0x31, 0x21, 0xCB, 0x86, 0x9C, 0x88, 0x21, 0x61,
+    0x40, 0x5F, 0x4A, 0xB8, 0x62, 0x52, 0x17, 0x72, 0x46, 0x61, 0x3A, 0x2C, 0x48, 0xE6, 0xA2, 0x9C,
+    0x0B, 0x7E, 0x89, 0xD8, 0x11, 0x91, 0x35, 0x68, 0x2F, 0xFF, 0x23, 0x36, 0xD2, 0xAA, 0x3F, 0xE3,
+    0xE9, 0x16, 0xE2, 0xDC, 0x7A, 0xB1, 0x2C, 0xCC, 0xFB, 0x8B, 0x2E, 0x5B, 0x98, 0x35, 0x75, 0x7B,
+    0x9C, 0x99, 0x62, 0xBC, 0x4C, 0x32, 0x05, 0xF4, 0x55, 0xAA, 0x10, 0xF6, 0x0D, 0x0F, 0x74, 0xC2,
+    0xAD, 0xEC, 0xA8, 0x46, 0x40, 0xE0, 0x04, 0xAA, 0xCE, 0xD0, 0xEE, 0xA0, 0xFF, 0x8A, 0xBC, 0xD5,
+    0x38, 0x87, 0x7A, 0x74, 0x35, 0x81, 0x41, 0x0D, 0x29, 0xDE, 0xE7, 0x71, 0x47, 0x04, 0x6B, 0xD4,
+    0x69, 0xA2, 0x3E, 0xD9, 0x7A, 0xC8, 0x5F, 0x12, 0x3D, 0xE2, 0x0D, 0xD3, 0xCA, 0x7F, 0x60, 0xD3,
+    0x6A, 0xF2, 0x31, 0x4C, 0xAB, 0xF0, 0x1E, 0xA6, 0xD5, 0x2D, 0x9A, 0x56, 0x0B, 0x9A, 0x56, 0x8B,
+    0xDE, 0x4F, 0xD5, 0x11, 0x9D, 0x8E, 0x75, 0x67, 0x9B, 0x52, 0x51, 0x85, 0x95, 0x54, 0xD0, 0x37,
+    0x42, 0xC7, 0x88, 0x0F, 0xAF, 0x08, 0x5D, 0x23, 0xF4, 0x87, 0xD0, 0x19, 0x42, 0x4F, 0xC8, 0x0E,
+    0x96, 0x9D, 0x58, 0xEB, 0x61, 0x07, 0xC4, 0x35, 0x35, 0xC1, 0xD1, 0x8D, 0x39, 0xD0, 0x42, 0xEE,
+    0x3B, 0x3B, 0x3A, 0xD1, 0x38, 0x28, 0xB7, 0x1B, 0x07, 0x21, 0xDD, 0x3A, 0x35, 0x6E, 0x37, 0xC6,
+    0x17, 0x47, 0x58, 0x1F, 0x54, 0x12, 0x0B, 0x07, 0xBE, 0x49, 0x63, 0x07, 0xDE, 0xB9, 0x42, 0xDF,
+    0x1C, 0x16, 0xFA, 0x26, 0x39, 0x52, 0x67, 0xD6, 0x0D, 0xED, 0x55, 0xEE, 0x1F, 0xA4, 0x8A, 0x0F,
+    0x44, 0x33, 0x5E, 0xF9, 0xA6, 0xE2, 0x26, 0x0C, 0x20, 0x7D, 0x53, 0x4D, 0xB1, 0x08, 0xD0, 0xE1,
+    0x9B, 0x40, 0x5B, 0xA3, 0x2B, 0x88, 0xAC, 0xCE, 0x10, 0x59, 0x53, 0x41, 0xA0, 0x2A, 0xC6, 0x62,
+    0x45, 0xB8, 0x42, 0xF3, 0x6D, 0xED, 0x75, 0x75, 0xFD, 0x93, 0x6D, 0xEB, 0x9F, 0xAC, 0xAD, 0xBF,
+    0xDC, 0xB6, 0xFE, 0x72, 0xDB, 0xFA, 0x4B, 0x55, 0x14, 0xB6, 0xAD, 0x3F, 0x3D, 0x71, 0xFD, 0x63,
+    0x7D, 0x73, 0x7D, 0xFD, 0xE3, 0xE5, 0xFA, 0x17, 0x57, 0x75, 0xFD, 0x6D, 0xAE, 0x97, 0x36, 0x5B,
+    0xA3, 0xF6, 0xFE, 0xDA, 0x89, 0xCF, 0x30, 0xEE, 0x35, 0x4A, 0xA3, 0x56, 0x78, 0x84, 0xAF, 0x24,
+    0x18, 0x66, 0xED, 0xFD, 0x39, 0xE2, 0xE2, 0x55, 0xA3, 0xDE, 0x3E, 0x87, 0x3E, 0xAF, 0xFA, 0xF4,
+    0x02, 0x50, 0x48, 0x8C, 0x4A, 0x8F, 0x52, 0xCF, 0x87, 0x9B, 0x8B, 0x94, 0x62, 0x64, 0x01, 0x0B,
+    0x75, 0x37, 0x06, 0xB7, 0x66, 0x55, 0x67, 0x3D, 0x1D, 0xDA, 0x25, 0xA8, 0x7A, 0x61, 0xC5, 0xBD,
+    0x95, 0x61, 0x56, 0xC3, 0xB0, 0xB2, 0xAC, 0x53, 0xD8, 0x42, 0xC5, 0x41, 0xEB, 0xEA, 0x14, 0x35,
+    0xE3, 0xE8, 0x79, 0x32, 0x55, 0xB5, 0xC1, 0x68, 0xC3, 0x80, 0xBE, 0x9E, 0xAE, 0x55, 0xB6, 0x35,
+    0xAA, 0x6B, 0xCC, 0x55, 0x8C, 0x4E, 0x54, 0xDB, 0x98, 0xAB, 0x08, 0x6D, 0xB8, 0x4E, 0xA7, 0xA1,
+    0xAA, 0x31, 0xA8, 0xB8, 0x06, 0xBF, 0x94, 0x35, 0x88, 0xB1, 0x0E, 0x1F, 0x9D, 0x40, 0x14, 0x5F,
+    0xC2, 0x2E, 0xE9, 0xD9, 0xB5, 0x50, 0xE8, 0x3C, 0xBA, 0xE3, 0x2D, 0x5E, 0x5D, 0x59, 0x0C, 0x56,
+    0x82, 0x65, 0x0C, 0x0B, 0xAF, 0xC6, 0x02, 0x30, 0x3B, 0x1C, 0x04, 0xE0, 0x12, 0x32, 0xE9, 0x1C,
+    0xFB, 0x90, 0xD5, 0x8B, 0x4A, 0xEE, 0x95, 0x32, 0x51, 0x8E, 0x59, 0xD4, 0x27, 0xA0, 0x9C, 0xF8,
+    0x7D, 0xF5, 0xA6, 0x9A, 0xC5, 0x6B, 0x3C, 0x06, 0x1A, 0x46, 0x8C, 0x07, 0x50, 0x68, 0x72, 0xD7,
+    0x4E, 0xBD, 0x32, 0x9C, 0x39, 0xB8, 0x5E, 0xC3, 0x8A, 0x25, 0x4C, 0x7B, 0xCA, 0xDC, 0x88, 0x20,
+    0x50, 0x36, 0x90, 0xCF, 0x82, 0x69, 0x0C, 0x1B, 0xF3, 0xB7, 0xBB, 0xB3, 0x52, 0x0D, 0xD7, 0x68,
+    0xE9, 0x99, 0x5F, 0x75, 0xDC, 0x62, 0xF2, 0x08, 0xA7, 0x4B, 0x05, 0xC5, 0x5B, 0x5C, 0xA2, 0x04,
+    0x13, 0x69, 0x3B, 0xC3, 0xCE, 0xE5, 0x56, 0x11, 0x8E, 0x65, 0x41, 0x09, 0x4E, 0x15, 0x1F, 0x32,
+    0x0F, 0x4B, 0x04, 0xE6, 0xD3, 0xE6, 0x16, 0x05, 0xD5, 0xA3, 0x93, 0x7C, 0x70, 0x74, 0x23, 0xE7,
+    0x95, 0x58, 0xE9, 0xE7, 0x43, 0xBD, 0x8A, 0x68, 0x80, 0xF4, 0x0F, 0x04, 0xD4, 0xB8, 0x22, 0xAC,
+    0x43, 0x4D, 0x4D, 0xC4, 0x8B, 0x6A, 0x6C, 0x01, 0x15, 0xFF, 0x29, 0x0C, 0x80, 0x5C, 0x19, 0xB3,
+    0x08, 0x3A, 0xFA, 0x9F, 0x45, 0xA4, 0xC8, 0x4A, 0x44, 0x5B, 0x6F, 0x77, 0x55, 0xC1, 0x4A, 0x00,
+    0xB1, 0x06, 0x22, 0xAC, 0x58, 0x15, 0x1F, 0xCE, 0x0D, 0xCC, 0x44, 0x5C, 0x33, 0xA4, 0x89, 0xC1,
+    0x1C, 0x47, 0x39, 0x2C, 0x2D, 0x77, 0x0D, 0x57, 0xB8, 0xEB, 0x92, 0xA9, 0xC3, 0x9E, 0x32, 0x43,
+    0xA8, 0xBF, 0x22, 0x71, 0x77, 0x1B, 0x3A, 0x2D, 0x88, 0x73, 0x1C, 0x17, 0x38, 0x02, 0xB7, 0x61,
+    0x0C, 0xA0, 0xA4, 0x0B, 0x3F, 0xA7, 0x53, 0x21, 0x85, 0x5D, 0xD0, 0x92, 0xA9, 0x13, 0xE5, 0x86,
+    0x64, 0xED, 0x3E, 0x71, 0x27, 0x4A, 0x7B, 0x82, 0x13, 0x50, 0x0E, 0xA1, 0x19, 0x8A, 0xA9, 0xD5,
+    0xBE, 0xF8, 0xF3, 0x54, 0xB6, 0xD3, 0xC6, 0x1E, 0xA0, 0x4A, 0x67, 0x4E, 0x98, 0xAA, 0x18, 0x1A,
+    0x29, 0x99, 0x93, 0xE0, 0x27, 0x3A, 0xB8, 0x90, 0xC4, 0xF2, 0xF1, 0xA9, 0xF1, 0x41, 0x68, 0xA2,
+    0xAE, 0x47, 0x2F, 0x89, 0x75, 0x10, 0xB4, 0xBF, 0x2A, 0x64, 0xDB, 0xCF, 0xE6, 0x74, 0x4A, 0xF0,
+    0x47, 0x66, 0x3A, 0x3D, 0x2B, 0x54, 0x15, 0x1A, 0xB4, 0xFF, 0x2A, 0x20, 0xAE, 0xBA, 0xD3, 0x9F,
+    0x77, 0x88, 0xA3, 0x48, 0xF2, 0x0B, 0x51, 0xCF, 0xFC, 0x9F, 0xCA, 0xB6, 0xFC, 0xDB, 0x2F, 0xCE,
+    0xF1, 0xB1, 0x19, 0xD4, 0x5B, 0x91, 0x00, 0x00, 0x47, 0x64, 0x3D, 0xD2, 0x76, 0xD8, 0xC1, 0xAA,
+    0x76, 0xB0, 0xAA, 0x1D, 0xEB, 0xDA, 0x82, 0x0E, 0x20, 0xA0, 0x0C, 0x72, 0xF9, 0x8E, 0x07, 0x15,
+    0xCB, 0x21, 0x80, 0x3A, 0x87, 0x9E, 0xBC, 0x07, 0x2F, 0x53, 0xE9, 0x2C, 0x5E, 0x84, 0x03, 0x02,
+    0x52, 0xBA, 0x01, 0x2D, 0x8B, 0xDA, 0x20, 0xC8, 0x1F, 0x14, 0x72, 0x66, 0x31, 0xCE, 0x6D, 0xBA,
+    0xBB, 0x97, 0x4F, 0x04, 0x96, 0x10, 0x91, 0xD0, 0x8E, 0x60, 0xE3, 0x85, 0x72, 0x4F, 0x5F, 0x6E,
+    0xE9, 0xE2, 0x8E, 0xA7, 0x2C, 0xE8, 0xF6, 0x16, 0xF2, 0xFF, 0xB2, 0xE2, 0xC3, 0x4B, 0xA5, 0x52,
+    0x43, 0x17, 0x8F, 0x09, 0xC0, 0x86, 0x04, 0xC4, 0x73, 0x39, 0xAF, 0xAB, 0xC6, 0x57, 0xD5, 0xAB,
+    0x8F, 0xC2, 0xF0, 0x95, 0x07, 0xA0, 0x11, 0x01, 0xC7, 0xA1, 0x3A, 0x01, 0x4E, 0xFF, 0x88, 0x7A,
+    0x7B, 0x6E, 0x4F, 0xF5, 0xAC, 0x33, 0x5F, 0xAA, 0x95, 0x3D, 0x7F, 0x24, 0xB3, 0x94, 0x73, 0x79,
+    0x7A, 0x41, 0x6E, 0xF0, 0x4E, 0xE6, 0x2E, 0x86, 0x6D, 0x2A, 0x48, 0xD8, 0x32, 0x04, 0x09, 0xEB,
+    0x94, 0xB6, 0x84, 0x85, 0xD0, 0x08, 0x10, 0x62, 0xDC, 0x69, 0x79, 0x64, 0x6A, 0x45, 0x03, 0x0D,
+    0xC2, 0x1C, 0x66, 0x03, 0xF0, 0xD4, 0x25, 0x99, 0xAE, 0x80, 0x29, 0xC6, 0x51, 0x39, 0xED, 0xA5,
+    0x6A, 0x50, 0xB9, 0x95, 0x57, 0x38, 0x95, 0xF0, 0xC9, 0x4A, 0x98, 0x67, 0x19, 0x39, 0xB3, 0x0C,
+    0x5E, 0x12, 0x9C, 0x24, 0x7C, 0x01, 0x13, 0xA3, 0xA1, 0x92, 0x91, 0x5D, 0x66, 0x98, 0x3F, 0x1D,
+    0x2B, 0x98, 0x0E, 0x57, 0x6E, 0x08, 0xCE, 0x9C, 0x8A, 0xE0, 0x92, 0xF3, 0x94, 0xEF, 0xD5, 0x46,
+    0xA6, 0x7B, 0xB1, 0x72, 0xAA, 0xC1, 0xFC, 0xEB, 0x42, 0x45, 0x2E, 0x89, 0x12, 0xBC, 0x8F, 0x8C,
+    0x81, 0x66, 0x22, 0xAF, 0x85, 0xC6, 0x66, 0x86, 0x39, 0x99, 0xBC, 0x55, 0xD1, 0x4C, 0x6B, 0x9D,
+    0x43, 0x87, 0x97, 0xDF, 0xD3, 0x98, 0x4C, 0x90, 0x32, 0x26, 0x53, 0x06, 0x31, 0x9D, 0x41, 0x45,
+    0x48, 0x1E, 0x08, 0x45, 0x42, 0x16, 0x77, 0x36, 0x11, 0x35, 0x22, 0x11, 0xBC, 0x99, 0xC3, 0x92,
+    0x9C, 0xC3, 0x8E, 0x1D, 0x1B, 0x6F, 0x6E, 0x97, 0xA6, 0xF8, 0xE9, 0xCC, 0xE6, 0x30, 0x09, 0xD2,
+    0xC1, 0xCD, 0xBD, 0x5C, 0x59, 0x14, 0xC8, 0x67, 0xA8, 0xA1, 0xB4, 0x73, 0xB3, 0xD8, 0xCC, 0xE4,
+    0x3C, 0x38, 0xE9, 0xCC, 0x9E, 0x03, 0x8D, 0x6A, 0x5A, 0xD4, 0xEF, 0x3B, 0x0B, 0xC6, 0x58, 0x78,
+    0x70, 0xCF, 0xD3, 0x1A, 0xF7, 0x96, 0xB1, 0x62, 0x88, 0xD4, 0x00, 0x22, 0x47, 0x40, 0x67, 0x45,
+    0x4E, 0xD4, 0xBB, 0x65, 0xF7, 0x71, 0xAB, 0xB1, 0x4A, 0xFD, 0x08, 0xDC, 0x64, 0x07, 0x5C, 0x64,
+    0x04, 0xDF, 0x6C, 0xD4, 0x13, 0x53, 0x68, 0x89, 0xA9, 0xB0, 0x8B, 0xF5, 0x52, 0x1F, 0x4A, 0x12,
+    0xB4, 0xBE, 0x7C, 0xDA, 0x79, 0x2B, 0xF6, 0xAE, 0xAE, 0x00, 0xFA, 0x61, 0xAF, 0x60, 0x1F, 0x10,
+    0x1A, 0xAB, 0x29, 0x91, 0xA8, 0x33, 0x85, 0x5A, 0xAF, 0x5B, 0x51, 0x63, 0x14, 0x1A, 0x1D, 0xDC,
+    0x99, 0xDB, 0x95, 0x0D, 0x31, 0x78, 0x39, 0x79, 0xF1, 0xC4, 0x74, 0xCA, 0x9D, 0x4C, 0x4A, 0x46,
+    0x4A, 0x2E, 0x4A, 0xFF, 0x49, 0xA4, 0xA2, 0x84, 0xF6, 0x20, 0x85, 0x9C, 0x30, 0xB5, 0x83, 0x05,
+    0x15, 0xC7, 0x09, 0x15, 0xC7, 0xC6, 0xA8, 0x3E, 0x83, 0x11, 0xF7, 0x85, 0x4E, 0xA3, 0x1A, 0x8D,
+    0xEE, 0x53, 0x36, 0x4A, 0xB2, 0x8B, 0x55, 0x25, 0x56, 0xC7, 0x0C, 0xFC, 0xF2, 0x13, 0x6C, 0xF6,
+    0x73, 0xEA, 0x98, 0xA6, 0x36, 0x9B, 0x64, 0x4B, 0xC6, 0x07, 0xC4, 0x70, 0x65, 0x32, 0xB1, 0x02,
+    0x07, 0x32, 0x9B, 0x70, 0x63, 0x5F, 0x2E, 0x1F, 0x89, 0xDA, 0x23, 0x9A, 0xD4, 0x5D, 0x59, 0xDB,
+    0xD8, 0xB8, 0x1F, 0xE6, 0x66, 0x2C, 0x7A, 0xD4, 0x87, 0x82, 0xB6, 0xA2, 0x46, 0xFD, 0xB2, 0x1C,
+    0xFC, 0x56, 0xB4, 0xA8, 0xFF, 0x53, 0x0E, 0xDF, 0xAD, 0x04, 0x43, 0x4A, 0xFF, 0x2D, 0x40, 0xBB,
+    0x0A, 0x09, 0xEF, 0x7A, 0x07, 0x9A, 0x60, 0xFA, 0x46, 0x23, 0xA8, 0x13, 0xC4, 0xFB, 0x95, 0xCC,
+    0x1F, 0xC8, 0xAC, 0xD8, 0xA9, 0xF0, 0x2F, 0x42, 0x3E, 0x4A, 0x45, 0xDB, 0xDD, 0xD1, 0x10, 0xA0,
+    0x40, 0xD2, 0x2D, 0x35, 0xC2, 0x61, 0x5D, 0xEC, 0xDC, 0xD6, 0xD2, 0xF2, 0x95, 0xE1, 0xCE, 0xEE,
+    0x1E, 0x44, 0x77, 0x9B, 0xC2, 0x53, 0xA1, 0xBA, 0xCB, 0xDA, 0x09, 0x52, 0x19, 0x1B, 0xAB, 0x26,
+    0xD2, 0x1D, 0x63, 0xBD, 0xC2, 0xEC, 0xC0, 0xED, 0x0C, 0xD8, 0x9D, 0xE5, 0xD3, 0xB9, 0x3A, 0x1F,
+    0x96, 0xC1, 0xBD, 0x25, 0xA3, 0x88, 0x40, 0xC7, 0x23, 0x0C, 0x93, 0x4E, 0xAD, 0x13, 0x6E, 0x11,
+    0x59, 0x7E, 0x9A, 0x6D, 0xE5, 0xA7, 0xE6, 0x4A, 0x20, 0x47, 0x3D, 0x9E, 0x09, 0x0C, 0x8F, 0x0E,
+    0x05, 0x8A, 0xAD, 0xC8, 0x4B, 0xA7, 0x55, 0xA5, 0x4A, 0x56, 0x5F, 0x5B, 0x0B, 0x3E, 0xED, 0xD4,
+    0xAF, 0xC8, 0x9C, 0xB0, 0x85, 0xA6, 0x8B, 0x4E, 0xC0, 0x4D, 0xB8, 0x74, 0xCA, 0x06, 0xB0, 0x2F,
+    0xC3, 0x40, 0x68, 0x6B, 0x67, 0x74, 0x19, 0x5E, 0x3F, 0x78, 0x3E, 0x32, 0x59, 0xD6, 0x0C, 0x8E,
+    0x9D, 0x05, 0x3E, 0x3D, 0xC7, 0xD0, 0xA8, 0xF9, 0xE5, 0x56, 0x2E, 0x54, 0x5D, 0x99, 0x77, 0x88,
+    0x4F, 0x8A, 0x18, 0x14, 0x96, 0x93, 0x89, 0x6E, 0x91, 0xC4, 0xDE, 0xED, 0x67, 0x44, 0xD9, 0x7B,
+    0x07, 0x82, 0xE5, 0xAD, 0x16, 0xFA, 0xED, 0x93, 0x5D, 0x9A, 0xC2, 0x89, 0xE1, 0x53, 0xB3, 0x64,
+    0x87, 0x05, 0xA5, 0x46, 0xFB, 0x42, 0x01, 0x34, 0x85, 0xF9, 0x46, 0xF5, 0x60, 0x25, 0xAE, 0xDE,
+    0x69, 0x60, 0xDD, 0x6B, 0xC9, 0x0E, 0x9F, 0x22, 0x87, 0xDD, 0x64, 0x87, 0x57, 0x02, 0xD9, 0x83,
+    0x60, 0x56, 0xD2, 0x0E, 0x85, 0x17, 0x1E, 0xDE, 0x49, 0x2E, 0xFF, 0xF7, 0x46, 0x58, 0x64, 0x30,
+    0x16, 0x7A, 0x6A, 0x61, 0x26, 0x36, 0x50, 0x4B, 0x45, 0x3C, 0x41, 0xAF, 0xC8, 0x3A, 0xBD, 0xB0,
+    0x26, 0xE7, 0x76, 0x2A, 0x42, 0x52, 0xF8, 0x72, 0x4E, 0x66, 0x4E, 0xDD, 0x94, 0x97, 0xB1, 0x60,
+    0x10, 0x75, 0x53, 0xD1, 0x63, 0x62, 0xAA, 0x99, 0xA1, 0x7A, 0x6B, 0x22, 0x35, 0xEB, 0x22, 0x6B,
+    0xD1, 0x45, 0x66, 0x99, 0x5D, 0xA0, 0x11, 0x0B, 0x75, 0x94, 0xA9, 0x6F, 0x2D, 0x48, 0xC1, 0x02,
+    0x19, 0x0E, 0x56, 0x9B, 0xCC, 0xFA, 0x3E, 0x3D, 0x90, 0xB0, 0x51, 0xD7, 0xFB, 0x90, 0x8E, 0xF8,
+    0xE1, 0xCF, 0xC0, 0xB8, 0x07, 0xFF, 0xCC, 0x54, 0x24, 0x44, 0xC6, 0x84, 0xEA, 0xC9, 0x82, 0x68,
+    0x07, 0xAA, 0x3F, 0x5C, 0xCF, 0x52, 0x03, 0xC7, 0xB4, 0xC6, 0xD4, 0xC1, 0xA2, 0x82, 0xED, 0xBA,
+    0x72, 0x74, 0x62, 0xEC, 0xAC, 0x73, 0xA3, 0x3D, 0x7F, 0xCC, 0x70, 0xAC, 0x37, 0x6F, 0xA4, 0x23,
+    0x2D, 0x3C, 0xB7, 0x0B, 0x22, 0x41, 0xA1, 0xFA, 0xBB, 0xDB, 0xA2, 0x8E, 0xD5, 0xFE, 0x4F, 0x64,
+    0xEB, 0x02, 0x08, 0xD1, 0x1F, 0x64, 0xF9, 0x23, 0x7A, 0x02, 0x22, 0xFB, 0xDF, 0x88, 0xD4, 0x37,
+    0x61, 0x28, 0x65, 0x42, 0x4C, 0x9F, 0x98, 0x86, 0x81, 0x8A, 0x86, 0xFA, 0x1C, 0x14, 0xC6, 0xF0,
+    0xCD, 0x4A, 0xA4, 0xA3, 0x7F, 0x74, 0x67, 0xC6, 0xB8, 0xDA, 0xBC, 0x93, 0xCB, 0x3A, 0xA1, 0xDD,
+    0xC5, 0x5A, 0xD8, 0x30, 0x5B, 0x1A, 0x32, 0xCA, 0x5C, 0xD4, 0x65, 0x40, 0xDA, 0x1E, 0x29, 0xD5,
+    0x89, 0xC2, 0x15, 0xC4, 0x53, 0xC4, 0x3A, 0x1A, 0xEB, 0x48, 0xA1, 0x07, 0x45, 0x1D, 0x28, 0xCC,
+    0x62, 0x99, 0xD3, 0xEF, 0x8C, 0x1B, 0xDD, 0xC6, 0x1D, 0x10, 0x8B, 0x84, 0x9A, 0x3E, 0xC0, 0x71,
+    0x7B, 0x05, 0x3D, 0x61, 0x4E, 0xA5, 0xCE, 0x9B, 0x8F, 0xCB, 0xE3, 0x7B, 0xE6, 0xC0, 0x58, 0xC8,
+    0x0A, 0x8F, 0xAF, 0xC0, 0xE3, 0x45, 0x6B, 0x6A, 0x7F, 0x21, 0x5A, 0x44, 0x1B, 0xCB, 0x62, 0x2E,
+    0x6E, 0xCD, 0x2A, 0xF8, 0x16, 0xE3, 0x5C, 0xA0, 0x56, 0x48, 0x8C, 0x88, 0x11, 0x4B, 0x87, 0x46,
+    0xC3, 0x48, 0xD4, 0x4A, 0xD9, 0x62, 0x99, 0x08, 0xA7, 0x8B, 0x3E, 0xB8, 0x5B, 0x04, 0xED, 0x3F,
+    0x15, 0xEE, 0xE1, 0x6A, 0x1E, 0x4A, 0x97, 0x83, 0xA2, 0xF4, 0x82, 0xD4, 0x8E, 0x94, 0x08, 0xBD,
+    0xB4, 0x77, 0xEA, 0x25, 0x42, 0x03, 0x45, 0xBD, 0x6C, 0x05, 0xAF, 0x0B, 0x7A, 0x78, 0x7A, 0xBC,
+    0x0E, 0x15, 0xAF, 0xC9, 0x9B, 0x88, 0xD0, 0x72, 0x5C, 0xA9, 0xCA, 0x10, 0x11, 0xF4, 0xBE, 0x28,
+    0x42, 0xA2, 0xFE, 0x44, 0x95, 0x70, 0xF5, 0xE8, 0xA5, 0x3B, 0x4D, 0x20, 0x5A, 0xA9, 0xD8, 0x9F,
+    0x8B, 0x1D, 0xA8, 0x34, 0x49, 0x75, 0x1E, 0x22, 0xEC, 0x94, 0xCA, 0xC8, 0x3F, 0xE0, 0x22, 0xF6,
+    0x62, 0x2E, 0x22, 0xAC, 0xB9, 0x08, 0xD1, 0x95, 0xB1, 0x08, 0x45, 0xE1, 0xFE, 0xA2, 0x46, 0x82,
+    0x22, 0x98, 0x39, 0x9D, 0x86, 0xC0, 0x0D, 0xDA, 0xBF, 0x5F, 0x9A, 0x6D, 0xF3, 0x6F, 0x3A, 0xC4,
+    0xC9, 0xDA, 0x0A, 0xCB, 0x49, 0x9C, 0xA4, 0x6A, 0x55, 0x1E, 0x1B, 0x44, 0x4C, 0xCF, 0xE2, 0x19,
+    0xEE, 0x35, 0xEF, 0x6C, 0x91, 0x27, 0xD5, 0x15, 0xE3, 0x54, 0x2E, 0x03, 0x20, 0x9A, 0x3E, 0xA4,
+    0x23, 0xE6, 0x1F, 0x14, 0x8C, 0x23, 0xE4, 0xFE, 0x9B, 0x30, 0x48, 0xC0, 0xBC, 0xFC, 0x0C, 0x89,
+    0x59, 0x62, 0x0B, 0x5D, 0x0D, 0x0A, 0x48, 0x6F, 0xA8, 0x5A, 0xF0, 0xAD, 0x85, 0x04, 0x94, 0xFA,
+    0xD9, 0xE0, 0xCD, 0xF6, 0x0A, 0xE0, 0x7A, 0x28, 0x6C, 0x02, 0xB2, 0x62, 0x4C, 0x61, 0xD1, 0x58,
+    0xB6, 0xE7, 0x96, 0xEB, 0x89, 0x4A, 0xD0, 0xAE, 0x3C, 0x22, 0x48, 0x4C, 0x06, 0x29, 0xAA, 0x70,
+    0x16, 0x5E, 0x0D, 0x4A, 0xBD, 0xA3, 0x5B, 0xE9, 0x4B, 0xE6, 0x10, 0xF9, 0x03, 0x75, 0xDE, 0xEB,
+    0x55, 0x6F, 0x9B, 0xE8, 0x20, 0x3A, 0x19, 0x52, 0x88, 0x06, 0x37, 0x67, 0x99, 0x3A, 0x6E, 0x07,
+    0xCB, 0x19, 0x76, 0x5F, 0x14, 0x66, 0xDD, 0x96, 0x2E, 0x9D, 0x26, 0x9B, 0xA9, 0x51, 0x51, 0xFC,
+    0x57, 0xA7, 0x17, 0xD4, 0xB1, 0xC3, 0x76, 0xC5, 0x44, 0xA1, 0x66, 0x03, 0x65, 0x1D, 0x81, 0x88,
+    0x96, 0x89, 0x3E, 0xB3, 0xD7, 0xE6, 0xAA, 0xDF, 0x08, 0xCD, 0x59, 0xD6, 0x5B, 0xD3, 0x87, 0x40,
+    0x24, 0x11, 0x38, 0x1C, 0x5E, 0x86, 0x32, 0x41, 0x43, 0x5F, 0xD6, 0x49, 0xD3, 0x55, 0x36, 0x46,
+    0xD1, 0xEA, 0x65, 0xF4, 0x8E, 0x08, 0xD0, 0xC4, 0xC0, 0xA6, 0x7F, 0x4B, 0xEE, 0x83, 0xEC, 0x1A,
+    0xE0, 0x4A, 0xEC, 0x55, 0x62, 0x20, 0x84, 0xEA, 0x22, 0x40, 0x64, 0x7C, 0xAE, 0x7B, 0xB2, 0x9E,
+    0x4F, 0x1B, 0x8E, 0x0D, 0x8F, 0xAE, 0x17, 0x90, 0xBF, 0xE0, 0xF2, 0x32, 0xDF, 0x58, 0xBD, 0x0F,
+    0xA4, 0x6B, 0x41, 0xDE, 0xE8, 0xE6, 0x1E, 0x20, 0xD7, 0xD2, 0xE5, 0x0F, 0xAD, 0x15, 0xAA, 0x15,
+    0x22, 0x55, 0x09, 0x04, 0xD0, 0x1C, 0xBC, 0x07, 0x6A, 0x93, 0x0F, 0x2F, 0x56, 0x48, 0xE7, 0xAF,
+    0x7B, 0xD5, 0x74, 0xE1, 0x23, 0xCD, 0xDB, 0xF9, 0xCA, 0x7A, 0xE6, 0xCB, 0x27, 0xAD, 0xF5, 0x7B,
+    0x59, 0x4D, 0x6F, 0xA6, 0x9F, 0xD6, 0x6B, 0xEE, 0xDE, 0x4F, 0x72, 0x1E, 0x82, 0xAC, 0xF7, 0xEF,
+    0x39, 0x7B, 0xEF, 0x5D, 0x54, 0x87, 0xCB, 0x80, 0x7E, 0xE3, 0x15, 0x37, 0x91, 0xF3, 0x03, 0xF8,
+    0x63, 0x05, 0x50, 0x0D, 0xE3, 0xD6, 0x95, 0x28, 0x34, 0x30, 0x99, 0x9C, 0x45, 0xAF, 0xAC, 0xF4,
+    0x4A, 0x17, 0xB8, 0x29, 0x4C, 0xE7, 0x6D, 0xDC, 0x94, 0x39, 0x5B, 0x7D, 0x2A, 0xC5, 0x89, 0xD9,
+    0x09, 0x10, 0xA0, 0x67, 0x80, 0x98, 0x1E, 0x83, 0x7E, 0x3C, 0x5E, 0xE7, 0x87, 0x6A, 0x22, 0x42,
+    0x7D, 0x00, 0x2B, 0xBC, 0xB2, 0x9E, 0x37, 0xF5, 0x49, 0x9A, 0x92, 0xF7, 0x53, 0x5A, 0x76, 0x9F,
+    0x27, 0x3F, 0x48, 0xDA, 0xE6, 0x3E, 0x4A, 0xCB, 0x7C, 0x79, 0x9A, 0xE1, 0x22, 0x16, 0x9A, 0x2A,
+    0x06, 0x87, 0x97, 0x32, 0xD9, 0x1D, 0x40, 0xA3, 0xF1, 0x46, 0xAC, 0x16, 0xE2, 0x1E, 0xB4, 0x14,
+    0xCA, 0xE2, 0x06, 0x73, 0x6B, 0x27, 0x75, 0xAB, 0x4B, 0x4C, 0x25, 0xA2, 0x0D, 0x11, 0x97, 0xCE,
+    0x46, 0x32, 0xA7, 0x35, 0x32, 0x29, 0xEA, 0x76, 0xBC, 0x4A, 0x7D, 0xCB, 0xC8, 0x69, 0xBD, 0x96,
+    0x21, 0x29, 0x07, 0x22, 0xC7, 0xB1, 0x99, 0x21, 0xA9, 0x77, 0xFF, 0xFA, 0xD7, 0x45, 0x2F, 0x87,
+    0xFF, 0xFC, 0xB7, 0xE5, 0xDA, 0xAD, 0xC6, 0xDB, 0x32, 0x2D, 0x8B, 0xCD, 0x4C, 0xCB, 0x20, 0x5E,
+    0x06, 0x8C, 0xE5, 0x84, 0x52, 0xDD, 0x0F, 0x82, 0x17, 0x9A, 0x1B, 0xB4, 0xFC, 0x01, 0x03, 0x0E,
+    0xCD, 0x71, 0x85, 0xCF, 0xBA, 0xDB, 0xCC, 0x09, 0xF9, 0x98, 0x4B, 0x36, 0xB7, 0x3D, 0x1F, 0x53,
+    0x14, 0x82, 0x6F, 0x37, 0x8C, 0xAE, 0xCA, 0x29, 0x6A, 0x4E, 0x0A, 0x75, 0xA7, 0x99, 0xDA, 0xBA,
+    0x8B, 0x83, 0xB9, 0x6A, 0x41, 0x8D, 0xE9, 0xCC, 0x20, 0xCD, 0xC3, 0xC1, 0xC5, 0xAD, 0xCE, 0x62,
+    0x12, 0x17, 0x08, 0x4D, 0x57, 0x16, 0x31, 0xB8, 0x1A, 0x36, 0xAA, 0x11, 0xCC, 0x61, 0x0D, 0xE5,
+    0x44, 0x56, 0x2F, 0x67, 0x92, 0x21, 0xA3, 0x6B, 0xF0, 0x6B, 0x38, 0x8D, 0x58, 0x44, 0x83, 0x7A,
+    0x58, 0x89, 0x49, 0x84, 0x43, 0x4D, 0xE8, 0x67, 0xE5, 0x59, 0x20, 0x64, 0xB8, 0xAF, 0xBB, 0x1F,
+    0xAB, 0xA6, 0xD3, 0x28, 0x7D, 0xE9, 0x45, 0x73, 0x2E, 0x19, 0x22, 0x8D, 0x35, 0x2F, 0xA6, 0x4B,
+    0x83, 0xBC, 0xA6, 0x97, 0x85, 0x19, 0x1E, 0x1D, 0xCC, 0x0E, 0x68, 0xAB, 0xC8, 0xD4, 0x19, 0xE5,
+    0x27, 0xF3, 0x0B, 0xC7, 0xEA, 0xE5, 0x9F, 0x28, 0x4F, 0x44, 0x3C, 0x06, 0x8C, 0x32, 0x9D, 0x31,
+    0xEB, 0x51, 0xB6, 0x8B, 0x08, 0xAB, 0xF5, 0x95, 0x9D, 0x7B, 0x30, 0xCA, 0xA6, 0x66, 0xB2, 0x3F,
+    0x14, 0xA4, 0x1F, 0x23, 0x5B, 0xB5, 0x59, 0x08, 0xC5, 0xB5, 0x39, 0xFC, 0xA3, 0x9A, 0x04, 0x25,
+    0x96, 0xD4, 0x03, 0x51, 0xF6, 0x4E, 0xAF, 0x27, 0xAD, 0x53, 0xB6, 0x66, 0x6E, 0x33, 0x14, 0x38,
+    0xEA, 0xBD, 0x54, 0xCC, 0x05, 0x59, 0x4B, 0x82, 0x78, 0x78, 0x06, 0xB1, 0x26, 0x5D, 0x36, 0xFD,
+    0x5E, 0x03, 0xF5, 0x00, 0x60, 0x19, 0xD9, 0x1F, 0xD0, 0xE2, 0x17, 0x56, 0xF5, 0x06, 0xF7, 0x49,
+    0x97, 0x23, 0xFD, 0xB8, 0xD4, 0x4F, 0x8E, 0x65, 0x1F, 0x3E, 0xCE, 0x86, 0xC5, 0xC3, 0x06, 0xD2,
+    0xF0, 0x24, 0x3B, 0xF2, 0x87, 0xFA, 0x3E, 0x92, 0x09, 0x0A, 0xCD, 0x3B, 0x1E, 0x16, 0x89, 0x4D,
+    0xF9, 0xD2, 0xFC, 0x63, 0x3F, 0x9B, 0xEA, 0x47, 0xEC, 0x35, 0x8C, 0xA7, 0x16, 0x8E, 0x53, 0x6E,
+    0x27, 0xC1, 0x95, 0x91, 0xF2, 0x29, 0xDD, 0x15, 0xC8, 0x01, 0x10, 0x78, 0x08, 0x60, 0xA7, 0xB2,
+    0x02, 0xB5, 0x31, 0x82, 0x04, 0x86, 0x7A, 0x62, 0xA2, 0x48, 0xBD, 0x04, 0xFB, 0xCC, 0x51, 0x11,
+    0x7B, 0x86, 0xD8, 0x15, 0xB9, 0x25, 0x75, 0x83, 0xE8, 0xD9, 0x82, 0xF1, 0xC5, 0xF0, 0x95, 0xCC,
+    0x47, 0x44, 0x37, 0xF8, 0x7E, 0xEC, 0xC1, 0x14, 0xF1, 0x6F, 0x33, 0x51, 0x07, 0xE9, 0xF4, 0x4C,
+    0x73, 0xF4, 0x1A, 0x05, 0xB8, 0xDC, 0xDA, 0x59, 0x0D, 0x9E, 0x8F, 0x34, 0x80, 0xB4, 0xCF, 0x4B,
+    0x3A, 0xD1, 0xA0, 0xE0, 0x44, 0x33, 0x23, 0x26, 0xE0, 0x1A, 0x3B, 0xB0, 0x41, 0x41, 0xF9, 0xE3,
+    0x8E, 0xDB, 0xF8, 0xB9, 0x53, 0x31, 0x99, 0x90, 0xF1, 0xA9, 0xA4, 0xA0, 0x3A, 0xF3, 0x11, 0x14,
+    0xEA, 0x9D, 0xC1, 0x87, 0x25, 0x42, 0x49, 0xC3, 0xB7, 0x4A, 0x44, 0xFA, 0xFC, 0x67, 0x4A, 0xAC,
+    0x6C, 0xE4, 0xFC, 0x5F, 0x39, 0xD8, 0xA0, 0x61, 0xAC, 0x58, 0x74, 0x65, 0x4A, 0xD1, 0x42, 0x4F,
+    0x35, 0x58, 0x72, 0xCE, 0x73, 0xB3, 0xDD, 0x8B, 0x48, 0xAB, 0x9C, 0x81, 0x1D, 0xCC, 0x57, 0x98,
+    0x30, 0x14, 0x9D, 0xC5, 0x8F, 0xC8, 0x26, 0xE4, 0x25, 0xFA, 0x9A, 0x8B, 0xD4, 0xCC, 0x05, 0xD4,
+    0x79, 0xDF, 0xBE, 0x10, 0x6F, 0x41, 0x94, 0x05, 0x69, 0x90, 0xD1, 0x41, 0x5B, 0x88, 0xC6, 0x11,
+    0x27, 0x1A, 0xEF, 0xE0, 0x51, 0x5E, 0xF1, 0x89, 0x66, 0x63, 0x4D, 0xA2, 0x98, 0xCF, 0xF7, 0x32,
+    0xCA, 0x37, 0x88, 0x50, 0x87, 0xEE, 0x74, 0xD8, 0x6A, 0xB8, 0x0C, 0x94, 0x29, 0x82, 0xC1, 0xFC,
+    0xC3, 0x45, 0xDA, 0xD6, 0x22, 0x85, 0x87, 0x4C, 0xFA, 0x84, 0x90, 0x94, 0x23, 0x28, 0x94, 0xA0,
+    0x0B, 0x9E, 0xC5, 0x40, 0x2F, 0x34, 0x23, 0x22, 0x68, 0xCA, 0x31, 0x5C, 0xB0, 0x59, 0xA4, 0x7A,
+    0x5C, 0x04, 0x63, 0xB0, 0x36, 0xC6, 0xAC, 0xFB, 0x4D, 0x43, 0x5B, 0x1B, 0x11, 0x75, 0xF9, 0x7D,
+    0xB2, 0x94, 0x5B, 0x37, 0xA0, 0x89, 0x88, 0xA4, 0x75, 0xE8, 0xE0, 0x2A, 0xD5, 0xD6, 0x64, 0x44,
+    0x45, 0xB9, 0x97, 0x51, 0x24, 0x51, 0xA6, 0x65, 0xA9, 0x85, 0x39, 0x02, 0x22, 0xAB, 0xAF, 0x2F,
+    0x90, 0xBE, 0xA7, 0x29, 0xEB, 0xA6, 0xBF, 0x0E, 0x8B, 0xA1, 0xA5, 0xA4, 0xA1, 0xCD, 0xF1, 0x56,
+    0x5B, 0x44, 0xAE, 0xA5, 0x1A, 0xB7, 0x4A, 0x69, 0x42, 0xC9, 0x95, 0x9A, 0xB9, 0x4A, 0x85, 0x11,
+    0x31, 0x93, 0xD7, 0xD9, 0xCD, 0x4B, 0x8C, 0x56, 0x84, 0x36, 0xC5, 0xE4, 0x74, 0x57, 0x17, 0x74,
+    0x2A, 0x5E, 0x53, 0xB1, 0xE1, 0xD3, 0xF3, 0x5B, 0x18, 0xDD, 0xC9, 0x7B, 0xDF, 0xD4, 0x88, 0x8D,
+    0xA9, 0xDD, 0xBA, 0x0B, 0x9E, 0x43, 0x23, 0x94, 0x75, 0x1D, 0x5E, 0xBE, 0xB9, 0xAB, 0xAB, 0x83,
+    0x66, 0x0D, 0xB8, 0xE6, 0x90, 0x3C, 0x1E, 0x64, 0x88, 0x4A, 0x12, 0xA3, 0xD1, 0x19, 0x51, 0xAA,
+    0xA9, 0x51, 0x79, 0xF5, 0xE9, 0x2C, 0x44, 0xCA, 0x05, 0x78, 0x8A, 0x4A, 0x33, 0xCD, 0x7F, 0xD1,
+    0xA4, 0x5E, 0x85, 0x4E, 0xC2, 0x91, 0xCC, 0xCB, 0xF9, 0x88, 0x69, 0x0C, 0x1F, 0x32, 0x4C, 0x4C,
+    0x7E, 0x13, 0xBC, 0x8C, 0x2D, 0x46, 0x4C, 0xB2, 0x1E, 0x71, 0x6C, 0xAF, 0x57, 0xCC, 0xE0, 0xAA,
+    0x09, 0x28, 0x19, 0xFD, 0x77, 0x81, 0xA4, 0xF2, 0x41, 0x84, 0xD4, 0x07, 0x85, 0x68, 0x19, 0xD3,
+    0x61, 0xBE, 0x8F, 0xF4, 0xDF, 0x0C, 0xB1, 0x75, 0x2F, 0xDB, 0x61, 0x36, 0x22, 0x78, 0x89, 0xE6,
+    0x37, 0xC1, 0x52, 0x82, 0x85, 0x04, 0x32, 0x61, 0x01, 0x80, 0x16, 0xC2, 0xF8, 0x00, 0x5E, 0x80,
+    0x61, 0x07, 0x7A, 0xE0, 0x18, 0x4A, 0x6E, 0xBD, 0x03, 0x82, 0x93, 0x61, 0x78, 0x33, 0x31, 0xAA,
+    0xDA, 0x87, 0xCC, 0x47, 0x0C, 0xE1, 0xE3, 0x8B, 0x90, 0xE2, 0xB0, 0x03, 0x37, 0xE7, 0xBE, 0x9C,
+    0x49, 0x3E, 0x86, 0x4C, 0x1D, 0xC3, 0xCA, 0xA8, 0x91, 0x4F, 0x45, 0xBB, 0x44, 0xA5, 0x53, 0xA4,
+    0x0A, 0x8C, 0xA6, 0xE4, 0xD1, 0xB1, 0xC7, 0x60, 0xBF, 0x99, 0x56, 0xAA, 0x15, 0xD5, 0x1A, 0x34,
+    0xE6, 0x65, 0x58, 0x36, 0xEA, 0x20, 0x1A, 0x6B, 0xD6, 0x93, 0x18, 0x0D, 0x8B, 0x83, 0xD9, 0xAD,
+    0x79, 0x27, 0xCB, 0x3B, 0x91, 0x5E, 0xB8, 0xD5, 0x38, 0x62, 0xC1, 0x40, 0xC3, 0xAD, 0x65, 0x35,
+    0x12, 0x45, 0x82, 0x97, 0xAA, 0x20, 0x0E, 0xD2, 0xC8, 0x29, 0xB1, 0xCF, 0x89, 0x5B, 0xFA, 0x69,
+    0x78, 0x81, 0x6E, 0xFC, 0x08, 0xB9, 0x7D, 0x72, 0x11, 0xAC, 0xCA, 0x05, 0x32, 0x7E, 0xE6, 0x65,
+    0x5E, 0x3E, 0x41, 0x3C, 0x4D, 0xD6, 0xB9, 0x4F, 0x06, 0x3E, 0xA1, 0x5A, 0xDC, 0xD0, 0xE3, 0x2A,
+    0x96, 0x11, 0x53, 0x65, 0x23, 0xBA, 0xAB, 0xC6, 0x21, 0x16, 0x53, 0x0B, 0xA6, 0x1D, 0xBE, 0x78,
+    0x67, 0x2F, 0xE6, 0x1A, 0xE8, 0xFF, 0x6C, 0x65, 0xDF, 0xE1, 0x73, 0xDF, 0x97, 0x9B, 0x45, 0xC1,
+    0xD7, 0x64, 0x11, 0x4D, 0x20, 0xF6, 0xE9, 0x9B, 0x75, 0x28, 0x98, 0xF1, 0x72, 0x29, 0xA7, 0x11,
+    0x7E, 0x2D, 0xDF, 0x11, 0x8B, 0x51, 0xF8, 0x93, 0x48, 0xDD, 0x30, 0x1E, 0x0F, 0xA8, 0xDD, 0x40,
+    0x3D, 0x72, 0x57, 0x2E, 0xAC, 0x3A, 0x21, 0xD2, 0x4D, 0x34, 0x6F, 0x46, 0x33, 0x5F, 0x90, 0x36,
+    0xA2, 0xC1, 0x15, 0xD2, 0x8D, 0xF7, 0xAE, 0x92, 0xCB, 0x5D, 0x62, 0xFD, 0xE7, 0xC8, 0x1D, 0x1C,
+    0x4D, 0xDE, 0x1B, 0x2E, 0x16, 0x10, 0x29, 0x7E, 0xDE, 0xA8, 0x39, 0x09, 0xFE, 0x62, 0x12, 0x9A,
+    0x86, 0x66, 0xAE, 0x99, 0xDD, 0x0D, 0x4D, 0x69, 0xD8, 0xD6, 0x83, 0x82, 0xC6, 0xB5, 0x2D, 0xB7,
+    0x20, 0xF7, 0x44, 0x18, 0x92, 0x29, 0x84, 0x1A, 0x87, 0x51, 0xF7, 0x35, 0x63, 0x81, 0x3A, 0x7A,
+    0xB7, 0x0E, 0x66, 0x10, 0x16, 0xCC, 0xF7, 0xAA, 0x6C, 0x3E, 0x09, 0x30, 0xF6, 0xBC, 0x26, 0x93,
+    0xCE, 0x97, 0x39, 0x66, 0xB7, 0x3F, 0x90, 0xBF, 0x4E, 0xC1, 0xCA, 0x9D, 0xDA, 0x4F, 0xE1, 0x45,
+    0xF6, 0x63, 0xFA, 0x29, 0xA8, 0x6D, 0x21, 0xA5, 0x12, 0xA9, 0x14, 0xFB, 0x8C, 0x95, 0x8D, 0x84,
+    0x21, 0x30, 0x81, 0x38, 0x64, 0x22, 0x12, 0xE6, 0xEE, 0xAE, 0x09, 0xAF, 0x8C, 0xF0, 0x85, 0x19,
+    0xBF, 0x04, 0x7E, 0x8B, 0x5B, 0x38, 0x8D, 0x26, 0x87, 0x0C, 0x35, 0x55, 0xA4, 0xD2, 0x24, 0x39,
+    0xB0, 0x4E, 0xCD, 0x24, 0x81, 0x47, 0x5E, 0xF8, 0x09, 0x0C, 0x0F, 0xE5, 0x24, 0x39, 0xAF, 0xB3,
+    0xDB, 0xD0, 0xDA, 0xDD, 0x3A, 0x7C, 0xB6, 0xE6, 0xBE, 0x23, 0x22, 0x19, 0xE8, 0xA2, 0x21, 0xED,
+    0xE2, 0x8A, 0x71, 0xC4, 0x84, 0x3E, 0xF5, 0xC1, 0x85, 0x71, 0x43, 0x4F, 0x5C, 0x44, 0x96, 0x25,
+    0xE2, 0x77, 0x50, 0x31, 0xEF, 0x6F, 0x24, 0xFA, 0x2A, 0x24, 0xC8, 0xC4, 0xCF, 0x35, 0xD5, 0x61,
+    0x7F, 0xC0, 0xE5, 0x4E, 0xF4, 0xD2, 0x0C, 0x8E, 0x0E, 0x6E, 0x40, 0xD4, 0x30, 0x2D, 0x42, 0xB0,
+    0x47, 0x95, 0xFE, 0x88, 0x0A, 0x98, 0x09, 0x9E, 0x13, 0x15, 0xEC, 0x70, 0xF7, 0x72, 0x6B, 0x39,
+    0x5E, 0x05, 0xD3, 0xFA, 0xA3, 0xA3, 0x06, 0x66, 0xFA, 0xB3, 0xA5, 0x88, 0xCF, 0x6C, 0x04, 0xA9,
+    0x2C, 0xB8, 0xC4, 0xAC, 0xC4, 0x37, 0x6B, 0xA1, 0x28, 0x90, 0x37, 0x2E, 0xE1, 0xD7, 0x0A, 0xA8,
+    0xAA, 0x21, 0x48, 0x59, 0x16, 0x8B, 0x6C, 0x76, 0xB0, 0x92, 0x27, 0xE0, 0x40, 0x09, 0x70, 0x38,
+    0xDE, 0x4F, 0xB0, 0x6D, 0xC8, 0x4D, 0xA7, 0xA5, 0xE1, 0x9E, 0xAA, 0xE1, 0xEE, 0x1F, 0x5E, 0x92,
+    0x09, 0x62, 0x67, 0x99, 0x21, 0x36, 0x59, 0xF3, 0x2A, 0x13, 0xEB, 0x04, 0xE7, 0xDC, 0x03, 0x24,
+    0x81, 0xC1, 0xD7, 0xE0, 0xA9, 0xD6, 0x4F, 0xEE, 0xE4, 0x2F, 0xC3, 0xEB, 0xE5, 0x5A, 0xEC, 0x9C,
+    0xD9, 0x69, 0x51, 0x86, 0x2C, 0xA5, 0x58, 0x26, 0x63, 0x1A, 0xCC, 0x55, 0x13, 0xA2, 0x9E, 0x2A,
+    0x5A, 0xBA, 0xEC, 0xE2, 0x5D, 0x94, 0xB6, 0xC1, 0xCF, 0x4D, 0x86, 0xB5, 0xBB, 0xFB, 0x4D, 0xCB,
+    0x7A, 0x07, 0x88, 0x6D, 0x3B, 0x25, 0xE6, 0x98, 0x54, 0x36, 0xFF, 0xE8, 0xB4, 0x26, 0x3D, 0xA3,
+    0x1C, 0xEF, 0xD5, 0x76, 0x19, 0x69, 0xEC, 0x7F, 0x43, 0x5E, 0xD3, 0xF5, 0xBA, 0xAB, 0x7D, 0xD0,
+    0x2C, 0xE7, 0x7A, 0x2D, 0xFD, 0x6C, 0xB9, 0xA1, 0xBD, 0x52, 0x41, 0xE0, 0x61, 0xDA, 0xE8, 0x7D,
+    0x6B, 0xB9, 0x6B, 0x02, 0x3A, 0x33, 0xC6, 0x99, 0x99, 0x3E, 0xEC, 0xF3, 0x40, 0x98, 0x6F, 0xC3,
+    0x4C, 0xAD, 0x86, 0x42, 0x91, 0x17, 0xE6, 0xFE, 0x21, 0x4B, 0x52, 0xCE, 0x6E, 0xA4, 0xB4, 0x31,
+    0xD1, 0x0B, 0x10, 0x86, 0xC5, 0x08, 0x08, 0x24, 0xE0, 0x80, 0x63, 0x06, 0x4A, 0x2C, 0x01, 0x45,
+    0x31, 0x59, 0x0B, 0x22, 0xF5, 0xD0, 0xA3, 0x85, 0x2D, 0x42, 0xAA, 0x56, 0xD1, 0x85, 0x85, 0xE6,
+    0xDC, 0x56, 0x4A, 0xBD, 0x20, 0xF0, 0xA7, 0xDA, 0xD7, 0x57, 0xB2, 0x94, 0x3A, 0x37, 0xFF, 0xDA,
+    0xC5, 0x86, 0x50, 0xFA, 0x30, 0xC4, 0x93, 0xA6, 0x57, 0xE9, 0xEC, 0xD7, 0xC6, 0xDB, 0x93, 0x9B,
+    0xDC, 0x4A, 0x49, 0x16, 0x6B, 0xB2, 0x63, 0x81, 0x71, 0x98, 0x63, 0x79, 0x5E, 0x06, 0xE2, 0x07,
+    0x1D, 0x74, 0xFF, 0xC9, 0x6A, 0x53, 0x28, 0x68, 0x2A, 0x27, 0x90, 0xB8, 0xA6, 0x5E, 0xEA, 0x1D,
+    0x12, 0xE3, 0x88, 0xBB, 0x9D, 0x20, 0xAA, 0x9D, 0x35, 0xC2, 0xD3, 0xFD, 0x6A, 0x3E, 0x23, 0x04,
+    0x17, 0xB4, 0x10, 0x8B, 0xAD, 0x4E, 0x71, 0xF5, 0x24, 0x9E, 0x54, 0xDA, 0xD2, 0xC5, 0xBD, 0x16,
+    0x9A, 0x8B, 0x8C, 0x60, 0xD9, 0xD1, 0x1E, 0x72, 0xA9, 0x52, 0x07, 0xC5, 0xAE, 0xD0, 0x35, 0x21,
+    0xDF, 0xA3, 0x98, 0xC9, 0x80, 0xD4, 0xD4, 0x83, 0x2C, 0xA4, 0xAC, 0x8D, 0x54, 0x5F, 0x7F, 0x75,
+    0x77, 0x77, 0x2F, 0x4B, 0xC8, 0x8D, 0x75, 0x9C, 0xD2, 0x46, 0x62, 0xCE, 0x2A, 0xF4, 0x56, 0xD5,
+    0x56, 0xCD, 0x8C, 0x1A, 0x1B, 0xAD, 0x3A, 0xD1, 0x92, 0x22, 0x66, 0xDF, 0x07, 0x05, 0x8C, 0x5C,
+    0x6F, 0xF1, 0x82, 0xB2, 0xE2, 0x39, 0xED, 0x88, 0x7C, 0xE9, 0xF2, 0xD7, 0xC2, 0x42, 0x06, 0xAD,
+    0x50, 0x8D, 0x8A, 0xA0, 0x15, 0x55, 0xDC, 0xA2, 0x53, 0xD0, 0x43, 0x58, 0xFE, 0xB2, 0x82, 0x84,
+    0x9C, 0x8B, 0x6C, 0x4B, 0x43, 0xDC, 0xA3, 0x6D, 0x41, 0xAB, 0x62, 0x2F, 0xD3, 0x2A, 0x43, 0x0D,
+    0x5A, 0x39, 0x7A, 0x6C, 0xEE, 0x1C, 0xC6, 0xD7, 0x02, 0xC9, 0xAF, 0xEF, 0x4D, 0x6C, 0xD4, 0x6B,
+    0x8E, 0xC4, 0x8D, 0x46, 0xF3, 0xC5, 0x77, 0x34, 0x3C, 0xBE, 0x8C, 0x53, 0xD1, 0xD7, 0x00, 0xCE,
+    0xA8, 0x29, 0x75, 0x10, 0xFF, 0xCF, 0x54, 0x56, 0x59, 0xF0, 0xBF, 0x07, 0xA7, 0x22, 0x2A, 0x81,
+    0x7C, 0x16, 0x06, 0xC1, 0x71, 0x4F, 0xE5, 0xD1, 0x63, 0xFA, 0x78, 0x5F, 0x38, 0xBB, 0x8F, 0x6F,
+    0x22, 0x39, 0x24, 0xB6, 0xE5, 0x8A, 0xCB, 0x3D, 0x05, 0xDD, 0xED, 0x91, 0xFC, 0xCB, 0x10, 0x76,
+    0x70, 0x01, 0x8A, 0x06, 0x6F, 0xFF, 0x32, 0x74, 0xE0, 0x9F, 0xE2, 0xF6, 0xEF, 0x40, 0xF7, 0xB9,
+    0xCD, 0x64, 0x8D, 0xEE, 0xF6, 0x43, 0x0C, 0x4F, 0x5D, 0xB8, 0x26, 0x7F, 0x7D, 0xAB, 0xB3, 0x2A,
+    0xA9, 0x3F, 0x98, 0x0A, 0x86, 0xE2, 0x77, 0xD7, 0xEA, 0x8B, 0x1F, 0xD5, 0xCE, 0xBF, 0x75, 0x1A,
+    0xCE, 0x2A, 0x62, 0xD3, 0xB3, 0xF8, 0x5A, 0x06, 0x6E, 0x92, 0x8B, 0xCE, 0xE3, 0x14, 0x5F, 0x5E,
+    0x37, 0xA2, 0x1F, 0x16, 0x84, 0xCC, 0x26, 0xDE, 0xDB, 0xFA, 0x55, 0x9B, 0x96, 0xA3, 0xF8, 0xAF,
+    0x76, 0xA2, 0xE6, 0xB1, 0x5A, 0x3A, 0x30, 0x36, 0xC1, 0x49, 0x73, 0x41, 0xB9, 0x83, 0x97, 0x6A,
+    0x2B, 0x8A, 0x83, 0x0C, 0x6E, 0x25, 0xA5, 0x8B, 0xC6, 0x96, 0x0F, 0xE0, 0x37, 0x2F, 0xD7, 0x94,
+    0xD9, 0xB1, 0x7C, 0x22, 0xA1, 0x45, 0x3A, 0xB1, 0x59, 0xDD, 0x81, 0x18, 0x4D, 0x23, 0xA3, 0xB4,
+    0x32, 0xB2, 0xCA, 0x79, 0x14, 0xEF, 0xD0, 0x86, 0xC3, 0x6C, 0x91, 0x66, 0x91, 0xA2, 0x48, 0x6A,
+    0x58, 0x58, 0xDA, 0x09, 0x35, 0x07, 0x48, 0xE8, 0x07, 0x1A, 0xA0, 0xA5, 0xA1, 0xC8, 0x58, 0x3A,
+    0xF2, 0xF7, 0x8D, 0xA5, 0x25, 0x9F, 0x69, 0x41, 0xA0, 0x27, 0xBF, 0xEA, 0x68, 0x4A, 0x8D, 0x82,
+    0xE7, 0x57, 0xF2, 0xEC, 0x56, 0x13, 0xD5, 0xA3, 0x1E, 0x22, 0xD3, 0xBE, 0x72, 0xB0, 0x83, 0x95,
+    0x7B, 0xA9, 0x63, 0x7B, 0x83, 0xB6, 0x73, 0x82, 0x0D, 0x16, 0xEB, 0x70, 0x14, 0x2A, 0x75, 0x58,
+    0x03, 0x0B, 0x0F, 0x23, 0xDC, 0x6B, 0xA0, 0x56, 0x96, 0x87, 0x91, 0x62, 0x21, 0xEC, 0x79, 0x7E,
+    0x8D, 0xF2, 0x90, 0x88, 0x84, 0x49, 0xBF, 0xF8, 0x58, 0xCB, 0x5D, 0x23, 0x8A, 0x7C, 0xFE, 0xB2,
+    0x4F, 0x56, 0x0F, 0xA6, 0x47, 0x43, 0x16, 0x11, 0x3A, 0x4D, 0xBA, 0x9B, 0x98, 0x1D, 0x4D, 0x7F,
+    0x6A, 0xA0, 0x18, 0xDA, 0xF4, 0x1E, 0x58, 0x8A, 0xA0, 0xEE, 0x10, 0x99, 0xFE, 0xEF, 0xEF, 0xE5,
+    0x28, 0x53, 0xD0, 0xD0, 0x34, 0x76, 0x4C, 0x4A, 0xA7, 0x00, 0x75, 0x56, 0x77, 0xDE, 0x07, 0xFC,
+    0xFB, 0x7D, 0xCF, 0xBB, 0xCD, 0x5A, 0xD7, 0xB4, 0x7B, 0xB9, 0xEC, 0x76, 0x66, 0xBF, 0x34, 0xEC,
+    0xB6, 0xFC, 0x06, 0x01, 0x30, 0x57, 0xD7, 0xBC, 0xB2, 0xCD, 0x8A, 0x9A, 0xB9, 0xBC, 0x35, 0x7B,
+    0xB9, 0x6A, 0x89, 0x2E, 0x11, 0xD2, 0xA6, 0xE4, 0x90, 0xE9, 0xE0, 0xC8, 0x59, 0x81, 0x51, 0x00,
+    0x3D, 0xBC, 0x02, 0xA8, 0x41, 0xE7, 0xBC, 0x8C, 0x09, 0x47, 0x2D, 0x55, 0x9A, 0x2E, 0x47, 0x65,
+    0xA1, 0xAC, 0x32, 0x89, 0xE2, 0x44, 0xD1, 0x21, 0x26, 0x02, 0x64, 0x34, 0x31, 0x8B, 0x26, 0x60,
+    0x48, 0x40, 0x96, 0xE6, 0x28, 0xF3, 0x0F, 0xA9, 0x8F, 0x0E, 0x9B, 0x35, 0x29, 0x85, 0x9F, 0x2F,
+    0xD2, 0xBC, 0xE1, 0x3E, 0xAE, 0x6A, 0x84, 0x88, 0xDF, 0x18, 0xD4, 0xDF, 0x24, 0x45, 0x85, 0x5A,
+    0xE3, 0xDB, 0xE5, 0xD9, 0x5A, 0xF7, 0xD3, 0xC8, 0x0E, 0x24, 0x30, 0x9B, 0x34, 0xC4, 0x0A, 0x9A,
+    0xE8, 0x82, 0xE8, 0x6F, 0xC1, 0x6D, 0x94, 0x86, 0x41, 0x76, 0x3A, 0x8C, 0x53, 0x68, 0x5D, 0x94,
+    0x45, 0xA5, 0x8B, 0x4B, 0x97, 0xBE, 0x96, 0x1A, 0x1C, 0xF2, 0x97, 0xF3, 0x5A, 0x92, 0x6F, 0xBE,
+    0xF9, 0xDD, 0xA7, 0xF4, 0x03, 0x1D, 0x30, 0xBF, 0x62, 0xAF, 0x1D, 0xED, 0xFF, 0xD8, 0x22, 0x5F,
+    0xBA, 0x56, 0xC4, 0x3A, 0x2B, 0x1C, 0x90, 0xA7, 0xD7, 0x36, 0x1E, 0xD2, 0x6E, 0xA2, 0xA3, 0x7A,
+    0x78, 0x0B, 0x69, 0x1A, 0xF1, 0x59, 0xD7, 0x24, 0xB1, 0x62, 0x6A, 0x98, 0xAA, 0x21, 0x2A, 0x30,
+    0xB7, 0x06, 0xAB, 0xA6, 0x55, 0xAB, 0x51, 0x48, 0x07, 0x53, 0xAA, 0x7F, 0x57, 0x02, 0xD6, 0xD2,
+    0x30, 0x7C, 0x4F, 0x49, 0x9B, 0x64, 0xB9, 0x63, 0x9D, 0x2C, 0x23, 0x2B, 0xB6, 0x60, 0x26, 0xE1,
+    0xDA, 0x58, 0xFB, 0xB9, 0x01, 0x82, 0x24, 0xA0, 0x0D, 0xFA, 0xE4, 0x10, 0xEE, 0x13, 0xB4, 0x46,
+    0x46, 0x81, 0x50, 0x63, 0x70, 0x67, 0xAF, 0x7D, 0xAD, 0x25, 0xF6, 0xC1, 0x93, 0x0E, 0xE4, 0xF3,
+    0x48, 0x31, 0x62, 0xEF, 0xDA, 0x14, 0xF7, 0x27, 0x6C, 0x6F, 0x83, 0xC2, 0x56, 0xB3, 0x5D, 0xA5,
+    0x50, 0x86, 0xA6, 0x64, 0xCE, 0x78, 0x17, 0xAE, 0xAD, 0xA4, 0xC1, 0x5A, 0x7F, 0xB3, 0xF5, 0xEB,
+    0x69, 0x55, 0xB2, 0xF9, 0x53, 0x73, 0xEC, 0x47, 0x20, 0xAD, 0x89, 0x74, 0x17, 0x58, 0xD8, 0xFD,
+    0x5F, 0xCC, 0xAF, 0xE7, 0x36, 0x77, 0x46, 0xAD, 0x98, 0x48, 0x6F, 0x18, 0x75, 0x15, 0x0C, 0x36,
+    0x04, 0x62, 0x2F, 0x89, 0xD6, 0xA3, 0x33, 0x9E, 0x34, 0xC5, 0x25, 0xA3, 0x04, 0xA0, 0x9E, 0x1F,
+    0xA9, 0xAB, 0x14, 0x2A, 0x94, 0x40, 0x34, 0x7C, 0x6F, 0x76, 0x33, 0x51, 0x8B, 0xA4, 0x45, 0x92,
+    0xCC, 0x2F, 0x6C, 0xBB, 0x06, 0x75, 0x4D, 0x9C, 0x39, 0x38, 0xF8, 0xA1, 0x2D, 0xCC, 0xE3, 0x61,
+    0x78, 0x6E, 0xF6, 0x5F, 0xD5, 0x71, 0x11, 0x9F, 0x3D, 0xBE, 0xE6, 0x7F, 0x2F, 0xDE, 0x2F, 0xE3,
+    0x1C, 0x1C, 0x1C, 0xA4, 0x4B, 0x4D, 0x32, 0xFF, 0x4B, 0x74, 0x3B, 0x31, 0xE9, 0xD9, 0x27, 0x36,
+    0x77, 0xFC, 0x88, 0xFD, 0x64, 0x5D, 0x47, 0x91, 0x1C, 0x62, 0x41, 0x14, 0xE7, 0xC5, 0xF5, 0x0A,
+    0xB5, 0x72, 0x67, 0x49, 0x86, 0xCB, 0x76, 0x1E, 0x24, 0x98, 0x6D, 0xE5, 0x2E, 0x49, 0x2F, 0x19,
+    0x36, 0x86, 0x65, 0x36, 0x62, 0x94, 0x2D, 0x2B, 0x5D, 0x5E, 0x80, 0xF8, 0x59, 0x74, 0xA6, 0xE9,
+    0x46, 0x69, 0x8A, 0x73, 0x52, 0x69, 0x8A, 0x72, 0x5B, 0x94, 0x3A, 0x97, 0xA6, 0x7D, 0xF5, 0x1A,
+    0x96, 0xE5, 0x95, 0x36, 0x4F, 0x7F, 0x23, 0xC0, 0x35, 0x5A, 0x79, 0x45, 0x36, 0x71, 0x34, 0x7C,
+    0xFF, 0x1B, 0x72, 0xFC, 0xD0, 0x13, 0x4B, 0x1B, 0x85, 0x2A, 0x8E, 0xB7, 0xC0, 0xE8, 0xF2, 0xF4,
+    0x8C, 0xF9, 0x0F, 0x76, 0xE5, 0x4F, 0x40, 0xD3, 0xF0, 0xA9, 0x44, 0xFC, 0x8E, 0x39, 0x18, 0x45,
+    0xD7, 0x3A, 0x04, 0x99, 0x4C, 0x26, 0x82, 0x65, 0xBF, 0xEF, 0xE7, 0x7F, 0x64, 0x6A, 0x27, 0x8B,
+    0x9E, 0x81, 0xD3, 0xFA, 0x2E, 0x6A, 0xEC, 0x28, 0x15, 0x58, 0xB1, 0x11, 0xE1, 0x63, 0x13, 0x40,
+    0x5B, 0x6C, 0x45, 0xE3, 0x96, 0x4E, 0xAC, 0x2A, 0xB7, 0xB3, 0xE2, 0x91, 0x1F, 0xA4, 0xCE, 0xEE,
+    0xE5, 0x1C, 0xF6, 0x4E, 0xB4, 0xBB, 0x6B, 0x79, 0xDD, 0x59, 0xD8, 0x6D, 0x62, 0x7C, 0xC8, 0x7B,
+    0xF5, 0x20, 0xFB, 0x73, 0xE3, 0xA6, 0x5F, 0x5E, 0xD4, 0x7F, 0xFF, 0x95, 0xD3, 0x5F, 0x16, 0xA0,
+    0x8A, 0x61, 0x69, 0xAE, 0x80, 0x97, 0x5E, 0xD4, 0xAC, 0xAD, 0xA0, 0x5D, 0xC4, 0xE7, 0x9D, 0x36,
+    0xFB, 0xA2, 0x39, 0x9D, 0xAE, 0x23, 0x56, 0x9F, 0x24, 0xE3, 0xB6, 0x65, 0x3F, 0xD9, 0x77, 0xBB,
+    0xDF, 0x94, 0xFD, 0xAF, 0xFC, 0xA8, 0xE7, 0x0D, 0x99, 0xD4, 0x49, 0xD5, 0xD5, 0xEC, 0x1C, 0xC1,
+    0x76, 0xF1, 0x3E, 0x28, 0x64, 0xC5, 0x9F, 0x95, 0xDF, 0x3E, 0x6B, 0xFE, 0xDE, 0x98, 0xF8, 0x09,
+    0x32, 0xAB, 0x2D, 0xB4, 0x7B, 0xDF, 0x9F, 0xA7, 0x55, 0xFC, 0x88, 0xEA, 0x14, 0xCD, 0x2D, 0x87,
+    0xCA, 0x7E, 0xAC, 0xFC, 0xCB, 0xBF, 0x50, 0xE4, 0x74, 0x8B, 0x9B, 0x3F, 0xC6, 0x24, 0xFF, 0x86,
+    0x1F, 0xB8, 0xB0, 0xB4, 0xCD, 0x0B, 0xF9, 0x0D, 0xD0, 0xC6, 0xC9, 0xBF, 0x80, 0x29, 0x8C, 0xD0,
+    0x68, 0xFA, 0x19, 0xF9, 0xED, 0x33, 0xE6, 0x4F, 0x36, 0xBE, 0xF4, 0x37, 0x71, 0xDF, 0x5B, 0xA6,
+    0x87, 0xD5, 0x7B, 0x6F, 0x74, 0xBF, 0xC5, 0x5F, 0x3D, 0x3E, 0x8D, 0xD3, 0x6B, 0xCC, 0xCB, 0xF8,
+    0xCA, 0xB0, 0x3F, 0x81, 0xA5, 0x05, 0xA5, 0x28, 0x65, 0xDC, 0xBE, 0x58, 0xC1, 0x4B, 0x3B, 0xD5,
+    0x62, 0x98, 0x99, 0x3F, 0x17, 0xA0, 0x64, 0x16, 0xD3, 0x11, 0xB9, 0x55, 0xDB, 0xD0, 0xEF, 0xC9,
+    0x82, 0x7C, 0xDA, 0x7C, 0x57, 0x6F, 0x20, 0x3F, 0x7F, 0xF2, 0x31, 0x81, 0xF1, 0xB7, 0x3A, 0xBB,
+    0x77, 0xD5, 0xD2, 0x1B, 0x14, 0x5E, 0x6F, 0x61, 0xE9, 0x29, 0x37, 0x7F, 0xA3, 0x9F, 0x7A, 0x2A,
+    0xFF, 0xBD, 0xA1, 0x9D, 0x76, 0x04, 0xA3, 0xED, 0xA5, 0x66, 0x3D, 0xD9, 0x2E, 0x3A, 0x43, 0x37,
+    0x2C, 0x80, 0x99, 0x8D, 0x06, 0x3B, 0x84, 0xD0, 0xCE, 0xF7, 0x10, 0xFA, 0x42, 0x0F, 0xA1, 0x3F,
+    0x5A, 0x2F, 0xE7, 0x58, 0xCA, 0x7E, 0x63, 0x96, 0xA0, 0xEF, 0x4A, 0xC1, 0xAE, 0x10, 0xBA, 0xFB,
+    0xD6, 0xC3, 0x9F, 0x90, 0x7B, 0x35, 0xA6, 0xCF, 0x9E, 0x3F, 0xBB, 0xEA, 0x0E, 0xD7, 0x7E, 0x2F,
+    0x7E, 0x45, 0x5F, 0x16, 0x55, 0xC6, 0x84, 0xA5, 0x2F, 0x2D, 0x0B, 0x76, 0xEE, 0x82, 0x9D, 0xC2,
+    0x22, 0x10, 0x65, 0xF1, 0x39, 0x24, 0x4C, 0x8D, 0xFC, 0xCC, 0x2D, 0x45, 0x6D, 0x4F, 0x61, 0x92,
+    0x23, 0x10, 0xE5, 0xE5, 0xA1, 0x90, 0x2C, 0xF4, 0x01, 0xF8, 0x7C, 0x76, 0x18, 0x78, 0x12, 0x19,
+    0xF8, 0x16, 0xD8, 0xAF, 0xFF, 0x0A, 0x42, 0x79, 0xC1, 0x65, 0xA6, 0xCE, 0x20, 0xED, 0xC3, 0x84,
+    0x0D, 0xEB, 0xD9, 0x2B, 0x04, 0x90, 0x84, 0x01, 0x0C, 0x8E, 0x52, 0x11, 0x8B, 0x22, 0x26, 0x66,
+    0x5D, 0x4C, 0x4A, 0xE3, 0x3D, 0xD6, 0x23, 0x50, 0x6F, 0x64, 0xA7, 0xD9, 0x5A, 0x2F, 0xD0, 0xE1,
+    0x29, 0xA0, 0x57, 0x60, 0x98, 0x1B, 0x8A, 0x00, 0xF4, 0xCD, 0x19, 0x9C, 0x3F, 0x38, 0xC1, 0x1B,
+    0x57, 0xD7, 0x3B, 0x78, 0xAC, 0xC4, 0xA9, 0x34, 0x7D, 0xB2, 0x0F, 0x56, 0xF5, 0x71, 0xAA, 0x68,
+    0xB5, 0xAF, 0x43, 0xDC, 0xC5, 0xA9, 0x98, 0xDA, 0x15, 0xAD, 0xA6, 0x76, 0x1D, 0xC6, 0x41, 0xFB,
+    0xCB, 0x36, 0xF6, 0xDA, 0x67, 0x5B, 0x70, 0x97, 0x9D, 0xBE, 0x65, 0x4B, 0xDD, 0xB7, 0xA2, 0x2A,
+    0xCD, 0x4A, 0xB4, 0x7B, 0x25, 0xC4, 0x0D, 0xA5, 0x1A, 0xB9, 0x16, 0x67, 0xDA, 0x83, 0xE3, 0x55,
+    0x25, 0x1A, 0x61, 0x61, 0xD0, 0x79, 0x58, 0x0C, 0xE1, 0x01, 0x65, 0x45, 0x89, 0x8D, 0xAE, 0xD8,
+    0xAA, 0x12, 0xB7, 0x8B, 0xB0, 0xE4, 0xE8, 0xEC, 0x30, 0x6B, 0xAF, 0xA9, 0x41, 0xB2, 0xD2, 0xBE,
+    0xE8, 0x73, 0x87, 0x17, 0x69, 0xEC, 0x27, 0x6C, 0x5E, 0xB1, 0xD1, 0xBE, 0x28, 0xDD, 0x08, 0x97,
+    0x9F, 0xBB, 0xC8, 0xF6, 0x14, 0x28, 0x11, 0x41, 0x35, 0x70, 0x43, 0x8B, 0x97, 0xAF, 0x0C, 0x99,
+    0x7E, 0x49, 0x3C, 0x8B, 0x23, 0x7A, 0xC5, 0x0A, 0xC5, 0xAB, 0x10, 0x13, 0xB2, 0xA1, 0x05, 0x3D,
+    0x4F, 0x23, 0x68, 0xAE, 0x8C, 0xD5, 0x4E, 0x56, 0x52, 0x6E, 0xFB, 0xAE, 0x16, 0x81, 0x9F, 0xBB,
+    0xA5, 0xBF, 0x27, 0x00, 0xF7, 0xDB, 0x98, 0x59, 0x7F, 0xDA, 0x13, 0xE1, 0xE8, 0x7F, 0x56, 0x7D,
+    0x3A, 0xD5, 0xD7, 0x95, 0x07, 0x6C, 0x2B, 0xCF, 0x1C, 0x99, 0xCE, 0xE1, 0xB5, 0x99, 0xB9, 0x1A,
+    0xF5, 0x99, 0xAB, 0x11, 0xD2, 0x70, 0x12, 0x04, 0x44, 0x67, 0x6B, 0x99, 0xAB, 0xA8, 0xE7, 0xAE,
+    0x68, 0x46, 0xC9, 0xEF, 0xC8, 0x5C, 0xFD, 0x63, 0x3F, 0x1F, 0x54, 0x11, 0x32, 0x57, 0xFD, 0x59,
+    0xEC, 0xDD, 0x7E, 0x4E, 0xE8, 0xDB, 0x66, 0xAE, 0x02, 0x25, 0x9E, 0x64, 0x0C, 0xFE, 0x0A, 0x56,
+    0xF0, 0x97, 0x9B, 0x79, 0x7A, 0xFB, 0x2B, 0x9E, 0x2D, 0xE3, 0x5C, 0xB3, 0x89, 0x57, 0xAB, 0x2D,
+    0x33, 0xD0, 0x77, 0x00, 0xAB, 0xEA, 0x7B, 0x45, 0x2C, 0x23, 0x95, 0x0F, 0xD0, 0x75, 0xA3, 0xFC,
+    0xFD, 0xBB, 0x6E, 0x2C, 0x1D, 0x11, 0x1B, 0xD8, 0x84, 0xC3, 0x9F, 0xC9, 0x6B, 0xBE, 0x7B, 0x71,
+    0x2D, 0x8A, 0xF7, 0x80, 0xA9, 0x14, 0x61, 0xEF, 0xB6, 0xEC, 0xB7, 0xF4, 0x71, 0xF6, 0x45, 0xD5,
+    0x7D, 0x86, 0xE1, 0x3B, 0xB7, 0x5E, 0xFF, 0xBD, 0xF6, 0xD5, 0xAD, 0x7F, 0x71, 0x70, 0x6D, 0xDB,
+    0xFA, 0xBB, 0x3F, 0xB3, 0xF2, 0xE8, 0x3E, 0xEB, 0x3F, 0x76, 0x2E, 0xFB, 0x27, 0x15, 0xFC, 0x56,
+    0xFD, 0xD1, 0xB6, 0x5A, 0xF5, 0x5D, 0x98, 0xE1, 0xE1, 0x0D, 0x66, 0x8F, 0xB3, 0xFB, 0x4B, 0x6B,
+    0x59, 0x45, 0xDA, 0xB5, 0x62, 0x81, 0x33, 0x87, 0x65, 0x95, 0x69, 0xE7, 0x4A, 0x89, 0x50, 0x63,
+    0xBA, 0xDE, 0x9F, 0xA2, 0x6B, 0x95, 0xC6, 0xD8, 0xD1, 0x17, 0x5E, 0x90, 0x55, 0x04, 0xB8, 0x7D,
+    0x40, 0x73, 0xF3, 0x79, 0xDD, 0x6C, 0x75, 0xE2, 0x66, 0xEF, 0xC4, 0xEC, 0xA1, 0x00, 0x9F, 0xDB,
+    0xB0, 0xD8, 0x43, 0xCC, 0x87, 0xCE, 0x4F, 0xBC, 0x10, 0x3E, 0x0C, 0xE3, 0x41, 0xA5, 0xA9, 0x82,
+    0xDD, 0xB1, 0xAA, 0xB5, 0xAC, 0xB1, 0xB9, 0x59, 0xFC, 0xD9, 0x4B, 0x0B, 0x31, 0x28, 0x6A, 0x75,
+    0x01, 0x5A, 0x71, 0xB2, 0x43, 0x9B, 0x8B, 0x74, 0x5B, 0x42, 0xCB, 0x03, 0xE1, 0x1B, 0xF6, 0x01,
+    0x48, 0x08, 0x8E, 0x86, 0x4E, 0xF6, 0x09, 0xD3, 0x76, 0x91, 0x16, 0xC9, 0x76, 0x0E, 0x26, 0x7C,
+    0xA6, 0x64, 0x25, 0xB6, 0xFF, 0x93, 0x92, 0x72, 0xD1, 0xFB, 0xD9, 0x87, 0x36, 0x9A, 0xF3, 0x41,
+    0x69, 0x2D, 0xB1, 0x4C, 0x55, 0x95, 0xDB, 0x6A, 0x1B, 0xBE, 0xF3, 0x8E, 0x46, 0x07, 0x9F, 0x7B,
+    0x85, 0x8C, 0x70, 0xAE, 0x91, 0xC0, 0x41, 0x1D, 0x3E, 0xC3, 0x60, 0x5D, 0x11, 0x69, 0x4B, 0x86,
+    0x34, 0xB2, 0x3E, 0x1A, 0xF6, 0x63, 0x71, 0xD9, 0x9C, 0x20, 0xD5, 0x65, 0xF9, 0xB7, 0x98, 0xAE,
+    0x0D, 0x41, 0x9C, 0x80, 0x1F, 0xF7, 0x1E, 0x93, 0x0E, 0xF7, 0x9B, 0x8D, 0x6B, 0xBD, 0x6C, 0xD8,
+    0xD4, 0xE5, 0x47, 0xAE, 0x5A, 0xD4, 0xAA, 0xEF, 0x20, 0xDF, 0xB7, 0x14, 0x55, 0xCF, 0x2D, 0x07,
+    0x6D, 0xE9, 0xBC, 0x58, 0x0B, 0x30, 0xEF, 0x5C, 0x44, 0x78, 0xA9, 0xA0, 0xFE, 0xDD, 0x0C, 0xF2,
+    0xC4, 0x96, 0xC8, 0x68, 0xAC, 0x41, 0x73, 0x28, 0xCC, 0x84, 0x0E, 0x41, 0x26, 0x87, 0x56, 0xB6,
+    0x64, 0x86, 0xB7, 0x6F, 0x82, 0x67, 0xA9, 0x94, 0xD4, 0xA1, 0x52, 0x73, 0x15, 0xD9, 0xE8, 0xC2,
+    0x8E, 0xB6, 0x63, 0xC9, 0xF6, 0xE9, 0x0F, 0x99, 0xC5, 0x57, 0x80, 0x0D, 0x11, 0x92, 0x08, 0xC5,
+    0xE4, 0x4F, 0x50, 0xB1, 0x23, 0x86, 0xC6, 0xB9, 0x07, 0x59, 0xFF, 0x60, 0xE3, 0xBA, 0xD6, 0x61,
+    0xF0, 0x51, 0xF4, 0x57, 0x21, 0xF1, 0xD2, 0x15, 0xEA, 0xF5, 0x6D, 0x33, 0xC1, 0xC5, 0x07, 0x68,
+    0xEC, 0x34, 0x98, 0xAF, 0xFB, 0x1D, 0x3E, 0xA1, 0x3A, 0xA0, 0x2B, 0xB6, 0xBD, 0xD8, 0x57, 0xAC,
+    0x44, 0x15, 0xD6, 0xFC, 0xD9, 0xC6, 0x7A, 0xE7, 0xAC, 0x3F, 0x8A, 0xA5, 0x6C, 0x84, 0x32, 0xE9,
+    0x6D, 0xC4, 0xE8, 0xCE, 0x88, 0x0D, 0x04, 0x26, 0xDC, 0x4A, 0x43, 0x32, 0x6C, 0xF0, 0xB6, 0xC3,
+    0xEE, 0x38, 0x6E, 0xC5, 0x1D, 0xDE, 0xD5, 0xC6, 0x73, 0x45, 0xEF, 0x9F, 0x1B, 0xFE, 0xA6, 0xEC,
+    0xE3, 0x95, 0x5A, 0x3C, 0xEE, 0x67, 0x33, 0xD3, 0x79, 0xEC, 0xB5, 0x72, 0x31, 0xA4, 0x3F, 0x5F,
+    0x93, 0x8A, 0x44, 0x53, 0x58, 0x5C, 0x05, 0x18, 0x5B, 0x7A, 0xD9, 0xA2, 0x63, 0x31, 0x02, 0xD5,
+    0x6E, 0x57, 0xF3, 0xD8, 0xA3, 0x15, 0x37, 0x6D, 0x90, 0x69, 0x33, 0x1F, 0x56, 0x58, 0xB2, 0xE6,
+    0x90, 0x6D, 0xAC, 0x2A, 0x10, 0x04, 0x0C, 0x53, 0x31, 0x56, 0xAD, 0xA1, 0x41, 0x9B, 0x7A, 0xF8,
+    0x4F, 0x60, 0x7B, 0x6F, 0x55, 0x76, 0x6D, 0xEC, 0xA5, 0x22, 0xAA, 0x17, 0x3A, 0x1C, 0xFA, 0xEF,
+    0x21, 0x35, 0x0D, 0x89, 0x0F, 0x4A, 0x2C, 0xFB, 0xC7, 0x79, 0xF5, 0x52, 0x4D, 0x59, 0x03, 0xDB,
+    0xBC, 0xDB, 0x8B, 0x82, 0x6D, 0xFF, 0x0C, 0xC1, 0x16, 0x10, 0x6C, 0x01, 0xC1, 0x16, 0x1E, 0x03,
+    0x5B, 0xD3, 0xF7, 0x76, 0x19, 0x90, 0x28, 0x86, 0xBF, 0xA9, 0xC8, 0x19, 0x08, 0xB6, 0x37, 0x09,
+    0xB6, 0xB7, 0xF0, 0x49, 0xFF, 0x65, 0xF8, 0xB2, 0x82, 0x97, 0xB1, 0xF8, 0xF0, 0xC2, 0xD7, 0x56,
+    0xC0, 0xE6, 0xB2, 0x57, 0x02, 0x0E, 0x67, 0x5F, 0x51, 0x6E, 0x9F, 0x89, 0x75, 0x7F, 0x8A, 0xC4,
+    0xAF, 0x2B, 0x88, 0x62, 0xFF, 0x6F, 0xF9, 0x58, 0x2D, 0x50, 0x75, 0x2A, 0xB8, 0x4C, 0xAA, 0x79,
+    0x0F, 0x0C, 0x60, 0xD1, 0xED, 0xBC, 0x03, 0xC6, 0xDB, 0x00, 0xC6, 0xDB, 0x00, 0xC6, 0x4F, 0xC1,
+    0x5B, 0xBF, 0x2F, 0xFC, 0x22, 0x7C, 0x0E, 0xDC, 0xFA, 0x33, 0x5E, 0x61, 0x27, 0x0B, 0xCD, 0xC6,
+    0x4E, 0xBD, 0x16, 0x9D, 0x92, 0xFC, 0xB6, 0x92, 0xB7, 0xCF, 0xB4, 0xD7, 0xEE, 0x81, 0x20, 0x83,
+    0x0F, 0x57, 0x11, 0x24, 0x5B, 0x22, 0xC8, 0xCF, 0xAA, 0x15, 0x04, 0x99, 0x1A, 0x7B, 0x0C, 0x72,
+    0xDA, 0x6B, 0x08, 0x52, 0xAE, 0xEC, 0x94, 0xF5, 0xB5, 0xDC, 0xE9, 0xB1, 0x64, 0xBC, 0xB8, 0xEF,
+    0x3A, 0x16, 0xAF, 0x67, 0x3D, 0x05, 0x70, 0x6A, 0x90, 0x03, 0x22, 0xBA, 0x8F, 0xBD, 0x60, 0xE1,
+    0x0E, 0xD6, 0xED, 0x96, 0x84, 0x48, 0x65, 0x11, 0xD7, 0x42, 0x04, 0x62, 0x00, 0xDC, 0x8A, 0x7D,
+    0x26, 0x7C, 0x78, 0xCD, 0x65, 0x5D, 0xA9, 0xB6, 0xD8, 0x09, 0xB5, 0xB7, 0xD0, 0xA0, 0x66, 0x3F,
+    0x93, 0x30, 0x45, 0x19, 0xF8, 0xCC, 0x20, 0xFF, 0x97, 0x1D, 0x0D, 0x34, 0xCD, 0x01, 0xC2, 0x63,
+    0x44, 0x8A, 0xDC, 0x27, 0x87, 0x98, 0xD0, 0xB7, 0xD1, 0xD0, 0xAF, 0xD1, 0x70, 0xF1, 0x87, 0x4D,
+    0x6F, 0x30, 0xBB, 0x1F, 0x11, 0x2E, 0x1F, 0x52, 0xFC, 0xFF, 0x56, 0xEB, 0x05, 0xA7, 0x64, 0x3C,
+    0x51, 0xEF, 0x3B, 0x54, 0x4F, 0xA2, 0x8F, 0x68, 0xA3, 0xAC, 0x05, 0x1C, 0x31, 0x8C, 0xF5, 0x20,
+    0xB4, 0x19, 0x01, 0x88, 0x34, 0x69, 0x33, 0xB7, 0x96, 0xC1, 0x2B, 0xBF, 0x7D, 0x03, 0x5F, 0x0A,
+    0xE0, 0x55, 0x0C, 0x2E, 0xC0, 0x31, 0xC3, 0x76, 0x40, 0x2C, 0x17, 0xA6, 0x2B, 0x17, 0x73, 0x4C,
+    0xA9, 0xF0, 0x30, 0x5D, 0x14, 0xD3, 0xD4, 0x08, 0xC4, 0xD6, 0xEC, 0xB5, 0xC0, 0xC4, 0x54, 0x87,
+    0xBA, 0xE8, 0x1C, 0x0A, 0x9A, 0xBA, 0xC8, 0xF4, 0x97, 0x8D, 0x7E, 0x33, 0xFB, 0xEB, 0x9D, 0x54,
+    0x58, 0xE0, 0xB3, 0xD1, 0xE0, 0xC6, 0x5D, 0x1C, 0x1C, 0x68, 0xD2, 0x46, 0xDF, 0xE0, 0x86, 0xAD,
+    0x5B, 0x8E, 0x37, 0xB8, 0xF1, 0xD3, 0xB5, 0xE6, 0x0E, 0x6B, 0x13, 0x1E, 0x71, 0xC2, 0x96, 0x13,
+    0x2E, 0xCC, 0x52, 0xAF, 0x1D, 0xDF, 0xA7, 0xAD, 0x03, 0x3E, 0xC6, 0x84, 0xE2, 0x5A, 0x43, 0xF0,
+    0x9D, 0x6A, 0x5B, 0xB2, 0xFF, 0x00, 0x54, 0xDB, 0x62, 0x70, 0xB8, 0x7B, 0x09, 0x46, 0x43, 0x9B,
+    0x0F, 0x35, 0x9D, 0x03, 0x81, 0x82, 0xBE, 0xEB, 0x64, 0x67, 0xD7, 0x68, 0xA8, 0xE0, 0x62, 0x08,
+    0xC3, 0x2E, 0xB2, 0x2D, 0x32, 0xB6, 0x29, 0x9D, 0x4B, 0x65, 0xDC, 0x1A, 0x86, 0x6D, 0xA3, 0x59,
+    0xA4, 0x8D, 0xDA, 0x2F, 0xB5, 0x85, 0x9C, 0x6D, 0xD5, 0x63, 0x9B, 0x03, 0x75, 0x6D, 0x68, 0x1A,
+    0xCD, 0xAD, 0x22, 0xF8, 0x2C, 0xFC, 0x98, 0xCB, 0xA0, 0xEA, 0x54, 0x3B, 0x37, 0x16, 0x84, 0x16,
+    0x86, 0x16, 0x88, 0x16, 0x8A, 0x16, 0x8C, 0x16, 0x82, 0xB6, 0x53, 0x90, 0x6D, 0x93, 0xC1, 0x35,
+    0xE4, 0xC6, 0x1E, 0xDE, 0xC6, 0x1A, 0x00, 0x24, 0xDB, 0x9C, 0x0D, 0xB4, 0x23, 0x80, 0x5A, 0x1C,
+    0xD8, 0x2E, 0x0E, 0x7D, 0x5F, 0x27, 0xBD, 0xB8, 0xDA, 0xDE, 0x89, 0x20, 0xD3, 0xB5, 0xE4, 0xC6,
+    0x46, 0x01, 0xCC, 0x50, 0xDB, 0x3B, 0x79, 0xDA, 0xDE, 0x49, 0xFB, 0x33, 0x74, 0x0D, 0xE9, 0xB4,
+    0xBE, 0xCB, 0x76, 0x90, 0xB5, 0x3D, 0x26, 0x6C, 0x8B, 0x06, 0xED, 0x05, 0x94, 0x1B, 0x63, 0xBB,
+    0x01, 0x2D, 0xAF, 0x23, 0x0B, 0xC8, 0x7D, 0xEB, 0x0B, 0x9C, 0x58, 0x01, 0xD0, 0x58, 0xEA, 0xB6,
+    0x57, 0xED, 0x21, 0x62, 0x73, 0x3F, 0xAC, 0xD4, 0x6F, 0xAC, 0xB4, 0x27, 0x3F, 0x28, 0xB5, 0x77,
+    0x32, 0x72, 0x60, 0x16, 0xDF, 0x59, 0xD8, 0x7E, 0x22, 0xB3, 0x58, 0x7B, 0x89, 0xB0, 0x06, 0x92,
+    0x56, 0xAD, 0x4F, 0xAD, 0x09, 0xFD, 0xDA, 0x34, 0x23, 0x5B, 0x6B, 0xDF, 0x19, 0x26, 0x41, 0x4B,
+    0x90, 0xEE, 0x9A, 0xEB, 0xB2, 0xFC, 0x9C, 0xD1, 0xC1, 0x65, 0xC7, 0x08, 0x7B, 0x8D, 0xEC, 0xD1,
+    0x5B, 0x9F, 0xA7, 0x8D, 0xDE, 0xD9, 0xB0, 0xC8, 0xF0, 0xD5, 0x59, 0x69, 0x23, 0x7D, 0xA9, 0x5E,
+    0x6D, 0xB2, 0xEA, 0x39, 0xDB, 0xFA, 0xAF, 0x52, 0x05, 0xA9, 0x64, 0x9A, 0xF5, 0xF5, 0xD2, 0x74,
+    0x9D, 0x8E, 0xE4, 0x14, 0x70, 0x7A, 0xB0, 0xC3, 0xF3, 0xD5, 0x46, 0x80, 0xFE, 0x3F, 0x68, 0x17,
+    0x16, 0x35, 0x55, 0x91, 0xB1, 0x0C, 0x5B, 0xEA, 0x42, 0xAB, 0xCD, 0x24, 0x22, 0x8D, 0x73, 0xA1,
+    0x75, 0x80, 0x96, 0x7D, 0x68, 0xA6, 0x73, 0xD8, 0x95, 0xE1, 0xD9, 0x82, 0x21, 0xDB, 0x5E, 0x70,
+    0xB3, 0xDB, 0x4D, 0x27, 0x61, 0x35, 0x1A, 0xA7, 0x8A, 0xCE, 0x5F, 0xED, 0x69, 0xE7, 0x5C, 0x0D,
+    0xC2, 0x85, 0x8B, 0x63, 0x6E, 0x9A, 0xBD, 0x85, 0x6E, 0x4F, 0x83, 0x98, 0x9D, 0x73, 0x10, 0x0A,
+    0x71, 0xCC, 0x8A, 0xA4, 0x1A, 0x2A, 0x0C, 0x1B, 0x46, 0xB8, 0xF3, 0x24, 0x0E, 0x85, 0x9F, 0x89,
+    0xEE, 0x1F, 0x0B, 0xD0, 0x99, 0x9E, 0x86, 0x00, 0x65, 0x98, 0xC2, 0x2F, 0x0E, 0x03, 0x61, 0xCA,
+    0x88, 0xC1, 0x94, 0x35, 0xF6, 0x1C, 0xCD, 0x94, 0xAF, 0x84, 0x8D, 0xA8, 0xA2, 0x38, 0x62, 0x10,
+    0x3F, 0x7C, 0x05, 0x61, 0xF5, 0xE0, 0x36, 0x82, 0xF8, 0x97, 0x19, 0x16, 0x68, 0x17, 0xFF, 0x19,
+    0x61, 0x31, 0x2A, 0x45, 0xCF, 0x87, 0x8D, 0xE9, 0x93, 0xEE, 0xBA, 0xA0, 0x10, 0x12, 0xF1, 0xDC,
+    0xC5, 0x2E, 0xBB, 0x17, 0xB0, 0x31, 0xC1, 0x02, 0x2A, 0x49, 0x9B, 0x86, 0x71, 0xF4, 0x77, 0xB2,
+    0x8E, 0x39, 0x18, 0x6F, 0x33, 0xCC, 0x47, 0xE0, 0x87, 0x23, 0x57, 0x54, 0x89, 0x11, 0xD2, 0xA6,
+    0xE5, 0x37, 0xF9, 0x80, 0x53, 0xCB, 0xF4, 0xE9, 0xA2, 0x91, 0x39, 0x67, 0x10, 0x81, 0xED, 0xAF,
+    0xE9, 0x7A, 0x8F, 0xCD, 0x29, 0xA7, 0xFD, 0x83, 0x3B, 0xB9, 0x77, 0xDF, 0xB0, 0x89, 0x80, 0xCC,
+    0x14, 0xD5, 0xA0, 0x1B, 0x11, 0xAC, 0xEA, 0x06, 0x32, 0x42, 0xC6, 0x76, 0x66, 0xD9, 0x7A, 0xB0,
+    0xF4, 0xBE, 0x4E, 0xEE, 0xE4, 0x04, 0x27, 0x77, 0x50, 0x3C, 0x8D, 0x7D, 0xCB, 0xB6, 0xE5, 0x54,
+    0xBF, 0x12, 0x6B, 0x60, 0xC8, 0xB7, 0x2F, 0x41, 0xAA, 0xD3, 0x0B, 0x1B, 0x6B, 0x57, 0x94, 0x86,
+    0x93, 0x45, 0x06, 0xCD, 0xE8, 0xDC, 0x64, 0x96, 0xD9, 0xBD, 0x3C, 0x17, 0xD3, 0x7B, 0xD9, 0x99,
+    0x9B, 0xF6, 0xFF, 0x11, 0x0F, 0x97, 0xE1, 0x9F, 0x75, 0xC7, 0xC3, 0x16, 0xE5, 0x6D, 0xB5, 0xBE,
+    0xCA, 0x5C, 0xF1, 0x1A, 0x33, 0x2B, 0x90, 0x58, 0x0B, 0x4D, 0x6C, 0x7E, 0x98, 0x3C, 0xF7, 0x5A,
+    0x63, 0xDA, 0xCC, 0x47, 0x2C, 0xB8, 0x85, 0x7A, 0x8C, 0xFE, 0x4E, 0xA2, 0xD0, 0x8C, 0x51, 0xFC,
+    0x9A, 0x51, 0x7D, 0x08, 0xD2, 0xCD, 0xFA, 0x3C, 0x36, 0x45, 0x71, 0xD7, 0xEB, 0xF3, 0xCA, 0x2D,
+    0xF5, 0x79, 0x5E, 0xC1, 0x6C, 0xC2, 0x61, 0x4B, 0xE9, 0xE8, 0x2E, 0xD6, 0xCC, 0xB1, 0xF1, 0x9A,
+    0x31, 0x56, 0x6F, 0xCD, 0xFA, 0xA1, 0xB8, 0x98, 0xD8, 0x88, 0xE8, 0xBC, 0xF7, 0xB0, 0x95, 0x9A,
+    0xA6, 0x2F, 0x58, 0x9C, 0x76, 0x51, 0xD4, 0xB9, 0x6D, 0x90, 0xA5, 0x65, 0x9D, 0x1F, 0xE4, 0xD6,
+    0x57, 0xAD, 0x58, 0x3A, 0xFF, 0xB8, 0x6D, 0x4C, 0x47, 0xB6, 0xB7, 0xC5, 0x64, 0x65, 0x4A, 0x26,
+    0x48, 0x85, 0xCA, 0xE9, 0x43, 0xD4, 0xAD, 0x44, 0x76, 0x71, 0xC8, 0xFA, 0x13, 0x3B, 0x97, 0x2A,
+    0x65, 0x61, 0x5B, 0xD3, 0x7A, 0x3F, 0x4F, 0x6D, 0x25, 0x29, 0x2B, 0x8F, 0x06, 0x4D, 0xD7, 0xAA,
+    0x65, 0xC3, 0x7D, 0xE3, 0x9D, 0x84, 0x1C, 0x9E, 0xD5, 0x4F, 0x98, 0xC5, 0xC8, 0x6E, 0xAF, 0xDA,
+    0x84, 0x0D, 0xAB, 0x87, 0xD7, 0x8A, 0xFD, 0xB0, 0xD9, 0x37, 0x0A, 0xD4, 0x35, 0xC6, 0x17, 0xF7,
+    0xD9, 0x5D, 0x9C, 0x6D, 0x0C, 0xEB, 0xAE, 0xD1, 0x15, 0xFE, 0x78, 0xEA, 0xF2, 0x7B, 0xF1, 0x8A,
+    0x53, 0xE3, 0x5C, 0xB2, 0x1B, 0xAF, 0xE2, 0xDD, 0x7A, 0xB9, 0xF5, 0x90, 0xC9, 0x92, 0x6C, 0x9F,
+    0xDB, 0x4F, 0xC9, 0xF8, 0x9E, 0xAB, 0x3D, 0x8D, 0xDC, 0x5A, 0x13, 0x22, 0xB9, 0x38, 0xDA, 0x1D,
+    0xB6, 0x73, 0x2E, 0x6E, 0xD3, 0x50, 0xF9, 0xAB, 0xBB, 0x9E, 0x5A, 0x49, 0xDE, 0x11, 0x30, 0x08,
+    0x89, 0x86, 0xA7, 0xB6, 0x17, 0x98, 0xDE, 0xCB, 0x25, 0xF4, 0xE8, 0xDB, 0x7B, 0xFD, 0x2B, 0xDB,
+    0x7B, 0xCD, 0xD9, 0xDE, 0xAB, 0xB9, 0x57, 0x25, 0xB4, 0xBB, 0x92, 0xF4, 0x05, 0xFD, 0x9C, 0xBD,
+    0xBD, 0x18, 0xE5, 0xA7, 0x4A, 0x4F, 0xD4, 0xD4, 0x9C, 0xA0, 0x5F, 0x21, 0x89, 0x99, 0xD9, 0xCE,
+    0x14, 0x85, 0x6D, 0x27, 0x2B, 0xE9, 0xBF, 0x66, 0xFA, 0x4E, 0xF8, 0x5C, 0xC6, 0x4C, 0x66, 0x66,
+    0xAE, 0x0A, 0xDF, 0x74, 0x0F, 0x21, 0xB2, 0x5B, 0x58, 0x90, 0xB3, 0xFB, 0xB7, 0xD7, 0xB3, 0xBC,
+    0xA7, 0x21, 0xF3, 0x69, 0xC0, 0x7D, 0xB6, 0xB6, 0x12, 0xD3, 0x6E, 0xE8, 0x2A, 0xF2, 0x8F, 0xB7,
+    0x12, 0x1B, 0xAD, 0x74, 0x2D, 0x9B, 0xF0, 0xD0, 0xEE, 0xD1, 0xBB, 0xAC, 0x59, 0xEF, 0x5D, 0x76,
+    0x74, 0x70, 0x7D, 0x91, 0x7A, 0xCC, 0x46, 0xF3, 0xFB, 0x4E, 0x53, 0xF7, 0x36, 0x66, 0xBB, 0x9E,
+    0x97, 0x82, 0x18, 0xC5, 0x0E, 0x1A, 0x01, 0x8F, 0xBE, 0x3D, 0xBB, 0x75, 0x75, 0xD2, 0x15, 0x7D,
+    0x74, 0xBD, 0x08, 0x46, 0x86, 0x51, 0x59, 0x77, 0xDD, 0x5F, 0x8C, 0x92, 0x45, 0xCD, 0x51, 0x0C,
+    0x11, 0x5B, 0x40, 0x5F, 0x75, 0xA7, 0xCD, 0x9C, 0xB9, 0xF7, 0x73, 0xF4, 0x66, 0xF2, 0xE5, 0xBB,
+    0xB5, 0x9C, 0x9D, 0x13, 0x9F, 0x48, 0xF6, 0x36, 0x00, 0x0A, 0x54, 0xEE, 0xDB, 0x41, 0x23, 0x30,
+    0xA1, 0x9C, 0xCC, 0xF6, 0x45, 0x93, 0x43, 0xF4, 0xB6, 0xF6, 0x45, 0xD3, 0xB6, 0x0D, 0xE9, 0x69,
+    0xED, 0x11, 0x8C, 0xE4, 0xD1, 0xA9, 0x71, 0x0E, 0xAE, 0x9E, 0xE8, 0x26, 0xE4, 0xDC, 0x47, 0x69,
+    0x9F, 0xC6, 0xB9, 0xA5, 0xED, 0xC1, 0xFE, 0x66, 0xDB, 0x03, 0x81, 0xDE, 0xBE, 0x2D, 0xF7, 0x6E,
+    0x6C, 0xB9, 0x77, 0x2D, 0xFC, 0x76, 0x4B, 0xB9, 0xF7, 0xDB, 0xB9, 0x7B, 0x78, 0xCC, 0xAF, 0xF9,
+    0x03, 0x36, 0x0E, 0x45, 0xD8, 0x64, 0xB5, 0x2E, 0x77, 0xCD, 0xC7, 0x7F, 0xDF, 0xED, 0xA7, 0xDC,
+    0xFE, 0xD7, 0xB1, 0x7D, 0xA4, 0x94, 0x23, 0xCB, 0x3C, 0x72, 0x4B, 0xD9, 0xBE, 0x2B, 0xFA, 0x61,
+    0xF4, 0xF2, 0x3F, 0xAE, 0x6E, 0xDF, 0xDC, 0xC8, 0x27, 0x36, 0xAE, 0xAB, 0x03, 0xAB, 0x8E, 0xB0,
+    0xF3, 0xCF, 0x1F, 0x07, 0xFD, 0xD6, 0xBD, 0x79, 0x2F, 0xD7, 0x23, 0xFF, 0x3F, 0x55, 0x23, 0x5F,
+    0xF6, 0xE6, 0x47, 0x65, 0xD4, 0xDA, 0xBD, 0xA1, 0x72, 0xE4, 0xAB, 0xB2, 0xA0, 0x2B, 0xF2, 0xFA,
+    0xAE, 0x7C, 0xEB, 0xC7, 0x2B, 0xE5, 0x7B, 0x1B, 0x92, 0x34, 0x39, 0xB1, 0x45, 0xE3, 0xA9, 0x1F,
+    0x18, 0xF7, 0x90, 0x75, 0xAB, 0x0C, 0x9A, 0x5C, 0x0D, 0x4A, 0x1A, 0x7E, 0xDB, 0xB6, 0xDD, 0xED,
+    0xFD, 0xD8, 0xA9, 0x8F, 0xFA, 0x3E, 0x1D, 0x1B, 0xE6, 0xF8, 0x0A, 0xE3, 0xDE, 0x6C, 0x66, 0x81,
+    0xB0, 0xE0, 0x04, 0xB6, 0xF3, 0xFC, 0x70, 0x0F, 0xF4, 0xCC, 0x3E, 0xB9, 0x1F, 0xAB, 0x36, 0x6E,
+    0x74, 0x52, 0x6D, 0xDC, 0x96, 0x44, 0xD2, 0x1B, 0x70, 0x8F, 0xA5, 0xEE, 0x6A, 0xC3, 0xD3, 0x39,
+    0xB9, 0x61, 0x73, 0x45, 0x78, 0x9A, 0xD3, 0x00, 0xD8, 0xC3, 0x1A, 0x36, 0xF9, 0x5E, 0x39, 0x9F,
+    0xEE, 0xDE, 0x68, 0xB3, 0x19, 0x0D, 0x2D, 0x39, 0xC6, 0x45, 0xBC, 0x6E, 0x59, 0x1E, 0x1F, 0x17,
+    0x2B, 0xAA, 0xBE, 0xB0, 0xF5, 0x53, 0xB2, 0xED, 0xC3, 0x17, 0x16, 0xFD, 0x93, 0x28, 0x66, 0x9A,
+    0xA1, 0xBF, 0xD4, 0x36, 0x02, 0xA0, 0xF9, 0x0C, 0xF9, 0xE8, 0xF3, 0xCB, 0xA5, 0x28, 0x5D, 0x83,
+    0xF2, 0x49, 0xEC, 0x74, 0x8C, 0x8C, 0xE3, 0x31, 0xAA, 0x6F, 0xE6, 0xD3, 0x53, 0xEC, 0xC6, 0xC9,
+    0xF9, 0xAF, 0xAE, 0xC8, 0x69, 0x1D, 0xE6, 0x5D, 0xE8, 0xD3, 0x44, 0x39, 0xBB, 0x8F, 0xB5, 0x9D,
+    0xFF, 0xE8, 0x9C, 0x79, 0x6C, 0xF7, 0xEF, 0x15, 0x9B, 0x4D, 0x29, 0x2C, 0x17, 0x4C, 0xD7, 0xD2,
+    0xE0, 0x1E, 0x3E, 0x8C, 0xEE, 0x19, 0xB2, 0xE8, 0x15, 0x77, 0xD8, 0x36, 0xEE, 0xE1, 0xC7, 0xAF,
+    0x9A, 0x3D, 0xA1, 0x00, 0xD7, 0xAD, 0xB5, 0xF1, 0xED, 0x4C, 0x05, 0x80, 0x7B, 0xD5, 0x4D, 0x35,
+    0x23, 0x5A, 0xF3, 0xA0, 0x07, 0x77, 0xF6, 0x14, 0x00, 0xB6, 0x4D, 0xA5, 0xF9, 0x8B, 0x6B, 0x5B,
+    0x82, 0xDF, 0x9F, 0xFE, 0x66, 0xE6, 0x81, 0x8D, 0xB4, 0x07, 0x36, 0x32, 0xAD, 0xDE, 0xCD, 0xAE,
+    0x83, 0xF7, 0x96, 0x1E, 0xDE, 0x8F, 0x75, 0x7F, 0xAE, 0xAD, 0x4E, 0xDF, 0x1C, 0x12, 0x2B, 0x62,
+    0x83, 0x00, 0xD6, 0xFE, 0xF1, 0x00, 0xA8, 0x95, 0x39, 0x35, 0xDE, 0x5E, 0xF7, 0x95, 0x1F, 0x1A,
+    0x1B, 0x21, 0xD3, 0xFE, 0xC1, 0x10, 0xDF, 0xDA, 0x2D, 0x3C, 0x4A, 0xBB, 0x3A, 0xF4, 0xD4, 0x16,
+    0x84, 0xFB, 0xF9, 0xB1, 0x1E, 0xC6, 0xB9, 0xED, 0xC0, 0xB7, 0xDF, 0xF7, 0x79, 0xC9, 0x96, 0xCE,
+    0x87, 0x64, 0xE9, 0x78, 0x80, 0xB6, 0x76, 0x06, 0x3D, 0x0C, 0x35, 0x59, 0xB2, 0x73, 0x38, 0x9C,
+    0xFB, 0x78, 0x7E, 0xF3, 0x43, 0xEB, 0xB1, 0x18, 0xBE, 0xBF, 0xC7, 0x82, 0xD5, 0x4A, 0x93, 0xF3,
+    0x68, 0xDF, 0xD0, 0xBA, 0x09, 0x57, 0x9A, 0x25, 0x6D, 0x3C, 0x21, 0x49, 0x5B, 0x0F, 0x94, 0x5A,
+    0xEC, 0x36, 0x78, 0xAD, 0xD5, 0x70, 0x9C, 0xD8, 0x22, 0xC5, 0xCA, 0x31, 0x03, 0xF9, 0x35, 0x8B,
+    0x54, 0x53, 0x86, 0x6D, 0x5B, 0x2D, 0xE4, 0x4E, 0x08, 0xDD, 0xA9, 0x6B, 0x6B, 0xD9, 0x56, 0x4B,
+    0xCB, 0xFE, 0x58, 0xA5, 0xA1, 0x36, 0x88, 0x26, 0x88, 0xD3, 0xC5, 0xD1, 0xD5, 0x84, 0x77, 0x9E,
+    0x45, 0xF8, 0xC2, 0xAA, 0x65, 0xBB, 0x6C, 0x3A, 0xB3, 0xAD, 0x66, 0x17, 0x42, 0xB3, 0x3B, 0x87,
+    0x14, 0xCE, 0x6B, 0xC8, 0x12, 0x6A, 0x0B, 0x28, 0x06, 0x6D, 0x7E, 0xAA, 0xAF, 0x51, 0x08, 0x56,
+    0x14, 0xB4, 0x95, 0xF6, 0xB1, 0x83, 0x7A, 0x23, 0x41, 0x07, 0x11, 0x18, 0x9F, 0x39, 0xA1, 0xBF,
+    0x06, 0xB1, 0xC3, 0xE4, 0xC6, 0x43, 0x51, 0xB4, 0xDE, 0xBA, 0x17, 0xAA, 0xC3, 0x7C, 0xED, 0xA1,
+    0x36, 0x21, 0xEA, 0x76, 0xA2, 0xBE, 0x7D, 0x03, 0x20, 0xF7, 0xB9, 0xDA, 0x44, 0xCF, 0x27, 0x42,
+    0x36, 0x65, 0x92, 0xAA, 0x92, 0x3E, 0x58, 0x5A, 0x44, 0xBD, 0x24, 0xDD, 0x59, 0x31, 0x15, 0x1F,
+    0xBD, 0x5F, 0x76, 0x7D, 0xC2, 0x9E, 0xAB, 0x6B, 0x7A, 0x6B, 0xB2, 0x4C, 0x6B, 0x46, 0x81, 0xA1,
+    0xF7, 0x3F, 0x4E, 0x44, 0xC4, 0x4F, 0xD2, 0x47, 0xAB, 0xEE, 0xC5, 0x68, 0x93, 0xDF, 0x2F, 0xB1,
+    0x11, 0xD1, 0x09, 0x76, 0x68, 0xD1, 0xCE, 0x6E, 0xFD, 0x71, 0x3E, 0x56, 0x4E, 0xEE, 0xF9, 0x8A,
+    0x4B, 0xA0, 0x3A, 0x96, 0xC0, 0x93, 0x99, 0xCE, 0x77, 0x44, 0x10, 0x3E, 0x2C, 0x27, 0x77, 0x71,
+    0x2F, 0x1C, 0x6C, 0x8C, 0x79, 0x20, 0x85, 0xD9, 0xFF, 0xC4, 0xEC, 0x85, 0xEF, 0xB0, 0xFC, 0xB5,
+    0xB4, 0x3D, 0xBB, 0x9D, 0x3E, 0x0E, 0x77, 0x3C, 0x9D, 0xA4, 0x4F, 0xF8, 0xB2, 0x6D, 0xA1, 0x3A,
+    0x5B, 0xC1, 0xAD, 0x60, 0xAB, 0x09, 0x33, 0x2F, 0xE7, 0x62, 0x18, 0x4F, 0x65, 0x87, 0xC9, 0x07,
+    0x1F, 0xE5, 0x61, 0xFB, 0x4E, 0x76, 0xFA, 0xB0, 0xCF, 0xCD, 0x54, 0xC1, 0xEE, 0x24, 0xEA, 0x50,
+    0x42, 0xB8, 0xE1, 0x24, 0x99, 0xCF, 0x53, 0xC8, 0x99, 0x9C, 0x0B, 0xD3, 0x1A, 0x46, 0x56, 0x49,
+    0x67, 0x43, 0x52, 0xD2, 0xCE, 0xB0, 0x4F, 0x27, 0x98, 0x0B, 0x88, 0xEE, 0x0A, 0x4B, 0xAB, 0xC8,
+    0x50, 0xEB, 0x0A, 0x31, 0x37, 0xA7, 0x12, 0x8C, 0xF8, 0x69, 0xEE, 0x8A, 0x01, 0x1E, 0x20, 0xB7,
+    0xAA, 0x41, 0x61, 0x01, 0x96, 0x36, 0xC6, 0x43, 0x0A, 0xC6, 0xC8, 0x12, 0x1E, 0xE6, 0x57, 0x60,
+    0x5A, 0x78, 0xD9, 0xFE, 0x00, 0x75, 0x80, 0xD9, 0x79, 0xD6, 0xF0, 0xA6, 0xE7, 0x83, 0x18, 0xCD,
+    0x21, 0x76, 0x22, 0x72, 0x8E, 0x9D, 0x7D, 0x2A, 0xC1, 0x61, 0xAD, 0xE5, 0x0C, 0x25, 0x1F, 0x52,
+    0x10, 0x14, 0xCE, 0xE2, 0x2A, 0xD8, 0xBB, 0x58, 0x80, 0x63, 0xF9, 0x8A, 0xCD, 0x7C, 0xEF, 0x72,
+    0x04, 0x23, 0x73, 0xBC, 0xD8, 0x4C, 0x13, 0xD7, 0xD5, 0x3D, 0xD9, 0xF7, 0x21, 0x44, 0x0A, 0x6F,
+    0x0A, 0x0F, 0x02, 0x5C, 0x25, 0x25, 0x9A, 0x10, 0x0A, 0x4A, 0xDC, 0xCD, 0xCC, 0xDD, 0xDC, 0xF9,
+    0x30, 0x73, 0xEF, 0xE6, 0xEE, 0x87, 0xF9, 0xE0, 0x9F, 0xB3, 0xC1, 0xAF, 0x72, 0xFF, 0xFB, 0xD9,
+    0xE0, 0xDD, 0x22, 0xF0, 0xD3, 0xC1, 0xBB, 0xE5, 0x8E, 0x1F, 0x0F, 0xDF, 0x2C, 0xAF, 0x04, 0xC6,
+    0x7B, 0xB3, 0x44, 0x49, 0x6E, 0xFA, 0x3B, 0xC1, 0x25, 0x3F, 0xBE, 0x9B, 0xCB, 0xBA, 0xE4, 0x46,
+    0x22, 0x51, 0xCD, 0x2C, 0x1E, 0x09, 0x92, 0x09, 0xF8, 0xE5, 0xBD, 0x2B, 0x66, 0xCD, 0x34, 0x5E,
+    0xC9, 0x5E, 0xBB, 0xB2, 0x5C, 0xDE, 0xB2, 0x9E, 0xE0, 0xA1, 0xAB, 0x68, 0x67, 0xD2, 0x33, 0x31,
+    0x4B, 0xBA, 0xA1, 0x44, 0xDF, 0x64, 0x9E, 0xA1, 0xEA, 0x0E, 0x6B, 0x0D, 0x2D, 0x57, 0xE0, 0xC8,
+    0x87, 0x31, 0xE9, 0xE3, 0xFF, 0x68, 0xCB, 0xEA, 0xF3, 0x98, 0xD4, 0xEB, 0xA5, 0x4F, 0x64, 0xD2,
+    0x47, 0x32, 0xE9, 0x33, 0x99, 0xF8, 0x50, 0x26, 0xF5, 0x18, 0xDA, 0xDE, 0x56, 0x7C, 0x2E, 0x93,
+    0x15, 0x6D, 0x7C, 0x32, 0x93, 0x3E, 0x9A, 0x49, 0x03, 0x00, 0x4E, 0xD7, 0x36, 0x5B, 0x23, 0x2F,
+    0xCA, 0x46, 0xD0, 0x56, 0x3E, 0xED, 0xAA, 0xEA, 0xB5, 0x6C, 0x07, 0x82, 0x32, 0xF3, 0x44, 0x44,
+    0x67, 0x64, 0x30, 0x09, 0x24, 0x69, 0x73, 0x6C, 0xD1, 0xDE, 0x62, 0x00, 0x9F, 0xD7, 0xDB, 0x62,
+    0x76, 0xBD, 0x78, 0x1B, 0xAD, 0x10, 0xD9, 0xA6, 0x35, 0x59, 0xA1, 0xFF, 0xA8, 0x7F, 0xBE, 0xDA,
+    0xB2, 0xB3, 0x6E, 0x57, 0x8D, 0xB5, 0xD6, 0xA1, 0xED, 0xCD, 0x05, 0xC2, 0x0E, 0xBF, 0x44, 0x0D,
+    0xC8, 0x33, 0x45, 0x9F, 0x0C, 0x89, 0x9C, 0x5D, 0x24, 0xD3, 0xE8, 0xE0, 0xE6, 0x5F, 0xDE, 0x9A,
+    0x78, 0xFF, 0x08, 0x1E, 0x60, 0xA5, 0x2B, 0x2B, 0x50, 0xC8, 0x8E, 0x5A, 0x97, 0x41, 0x76, 0x3C,
+    0xD3, 0xF6, 0xA1, 0x03, 0x07, 0x86, 0x76, 0xAD, 0x75, 0xD2, 0xBC, 0xFA, 0x5A, 0x03, 0x6A, 0xA2,
+    0xE7, 0xD4, 0x35, 0x3F, 0xB2, 0x51, 0x98, 0x46, 0x65, 0x28, 0xBA, 0x4F, 0x29, 0x49, 0x46, 0xB6,
+    0x37, 0x79, 0x57, 0x2C, 0x32, 0xB2, 0x66, 0xD7, 0xEC, 0xE0, 0x80, 0xF2, 0x95, 0xFD, 0xD6, 0x04,
+    0x8B, 0xA9, 0x41, 0xA9, 0xEE, 0x64, 0x6C, 0xA9, 0xAD, 0xD1, 0x9E, 0xD7, 0x98, 0x05, 0xDD, 0xDB,
+    0x69, 0xB3, 0x69, 0x12, 0xB0, 0x7D, 0x6C, 0xCB, 0xA0, 0xB2, 0xCE, 0xD7, 0x42, 0xFD, 0xAF, 0x50,
+    0x3C, 0x6F, 0x1D, 0x5C, 0x33, 0xDA, 0x00, 0xA2, 0x84, 0x25, 0xD5, 0x19, 0x07, 0x0A, 0xA5, 0xB9,
+    0xE7, 0xF1, 0x71, 0x5C, 0xCF, 0xA1, 0x09, 0xBA, 0x40, 0x6A, 0x7E, 0x39, 0x1F, 0xD4, 0x4E, 0x5B,
+    0x0C, 0x0B, 0x76, 0xFC, 0x25, 0xDF, 0x6F, 0x95, 0xF3, 0xCF, 0xB5, 0xD0, 0xA5, 0x39, 0xCD, 0x46,
+    0x12, 0x2D, 0x43, 0xA0, 0x0E, 0x6C, 0xB6, 0x11, 0xC9, 0xD7, 0x3E, 0x0B, 0x07, 0x80, 0xAB, 0x35,
+    0x4E, 0xAF, 0xCF, 0x98, 0x61, 0x06, 0x71, 0xF4, 0xDF, 0xEE, 0xB6, 0xE9, 0x5F, 0xCB, 0xEA, 0xDF,
+    0xBE, 0x8D, 0xA8, 0xD6, 0x62, 0xF8, 0x3D, 0x6C, 0xE3, 0xA2, 0x66, 0x51, 0x3A, 0xD7, 0xDC, 0x6B,
+    0xC6, 0x81, 0x57, 0xD6, 0x99, 0x5F, 0x66, 0x2B, 0x76, 0x24, 0xF3, 0xBC, 0xBF, 0xD6, 0x9C, 0xFB,
+    0x63, 0x27, 0x14, 0x2E, 0xF4, 0xB9, 0x53, 0x95, 0x0E, 0x0F, 0x9C, 0x50, 0x88, 0xEA, 0x0B, 0x3E,
+    0x9C, 0x8C, 0x0F, 0x9F, 0x12, 0x36, 0x86, 0x07, 0x29, 0xA6, 0xEC, 0x85, 0x3B, 0xE9, 0x2C, 0xCF,
+    0xFF, 0x95, 0xAE, 0x97, 0xCB, 0x20, 0xCA, 0x02, 0x98, 0xB6, 0x2F, 0xCA, 0x6C, 0xB5, 0x3A, 0xEF,
+    0x6A, 0xD5, 0x71, 0x59, 0x50, 0x1C, 0x5D, 0x98, 0xE5, 0x36, 0x2F, 0x09, 0x26, 0xF4, 0x28, 0x5E,
+    0x73, 0x4D, 0x47, 0xBD, 0x86, 0x15, 0x14, 0x4F, 0xC7, 0x5D, 0x0F, 0xD4, 0xF9, 0x5A, 0x8F, 0x0E,
+    0x0F, 0xFA, 0x95, 0x3E, 0x0E, 0x0B, 0x5A, 0xD7, 0x35, 0x05, 0xB1, 0xBB, 0xB4, 0x90, 0x37, 0xA3,
+    0x4A, 0xFA, 0xBF, 0xCE, 0x0D, 0xFB, 0x30, 0xC7, 0x41, 0xBB, 0x38, 0x98, 0xFB, 0x87, 0x20, 0x22,
+    0x51, 0x5B, 0xEA, 0x04, 0x88, 0x32, 0x85, 0x22, 0x3F, 0xB5, 0x45, 0x31, 0x49, 0x9A, 0x20, 0x7E,
+    0x11, 0xDD, 0xDC, 0x63, 0x5B, 0xF5, 0x5C, 0x1B, 0x73, 0x2D, 0xDB, 0x6A, 0x24, 0x54, 0x87, 0xB2,
+    0xC1, 0xCD, 0xCB, 0xA5, 0xA3, 0x7D, 0x83, 0xEA, 0x95, 0x24, 0xCB, 0xC6, 0x3C, 0xDD, 0x0A, 0xD2,
+    0xB4, 0xB5, 0xB7, 0x78, 0xB1, 0x0A, 0x72, 0x76, 0xB3, 0x16, 0xE2, 0x04, 0x8A, 0x47, 0x71, 0xF4,
+    0xD2, 0x82, 0x4F, 0x62, 0x45, 0xE2, 0xB8, 0x26, 0x63, 0x3F, 0x81, 0x66, 0xDD, 0x68, 0x64, 0x6B,
+    0x46, 0x38, 0x97, 0xAF, 0xAE, 0x75, 0x1A, 0x7A, 0xF4, 0xFB, 0x75, 0xF0, 0x18, 0x57, 0x08, 0x5A,
+    0x31, 0x96, 0x87, 0x7D, 0xE5, 0xC3, 0x43, 0x80, 0x83, 0x2D, 0x8A, 0x80, 0xC6, 0x13, 0x5A, 0xE5,
+    0x4B, 0x79, 0xC2, 0x56, 0x4E, 0xFB, 0xEF, 0xC8, 0x7D, 0xE0, 0x58, 0x1E, 0xDA, 0xB5, 0xED, 0x0B,
+    0x5E, 0xD2, 0xAB, 0x7F, 0xEC, 0x29, 0x9F, 0x9F, 0x06, 0xF7, 0x81, 0xE2, 0xF3, 0x79, 0x68, 0xD6,
+    0x53, 0x6F, 0x3B, 0x3E, 0x3F, 0xD2, 0x27, 0xBF, 0x11, 0xC2, 0x8E, 0x88, 0xD9, 0x67, 0x2A, 0xF3,
+    0x05, 0xA7, 0x78, 0x28, 0xE9, 0x88, 0xCF, 0x6B, 0x9C, 0xA3, 0xD4, 0xC1, 0x3E, 0xF5, 0x90, 0x48,
+    0xD6, 0x87, 0xCA, 0x89, 0x7A, 0x7D, 0x3F, 0xFE, 0x95, 0x87, 0x21, 0x81, 0x7F, 0x86, 0xC4, 0xB8,
+    0xE1, 0x06, 0x81, 0x2F, 0x87, 0xB9, 0xCA, 0xB8, 0x18, 0x31, 0xFE, 0x79, 0x9C, 0x20, 0xE9, 0x00,
+    0xE9, 0x5A, 0x4B, 0x67, 0x29, 0x71, 0x36, 0xC0, 0xBC, 0x4F, 0xA1, 0x57, 0xC7, 0xCA, 0xD3, 0xB0,
+    0x89, 0x72, 0x84, 0x2D, 0xD9, 0xFC, 0xB4, 0xEF, 0x8E, 0xC1, 0x15, 0x40, 0x6B, 0x39, 0xC3, 0xD5,
+    0x32, 0x7B, 0xC0, 0x59, 0xAE, 0x60, 0x4B, 0x57, 0x8D, 0xEE, 0xC9, 0xBC, 0x67, 0x51, 0x09, 0x1C,
+    0xBD, 0xC6, 0x47, 0x18, 0x2F, 0xFA, 0x0A, 0x92, 0xD3, 0x2C, 0x58, 0xA4, 0xEB, 0x80, 0x49, 0xC6,
+    0x6B, 0x3F, 0x8F, 0xDB, 0x43, 0xEC, 0xDC, 0x83, 0x1F, 0xC1, 0x6C, 0xA7, 0x77, 0x77, 0xFE, 0xD0,
+    0x6A, 0x43, 0xAC, 0xDE, 0xB4, 0xDA, 0xE8, 0x4D, 0x69, 0x1F, 0xFC, 0xB5, 0x8B, 0x54, 0x6E, 0xF2,
+    0xD8, 0xC7, 0x14, 0x62, 0xF7, 0xD7, 0x86, 0xFF, 0x40, 0xB0, 0xF3, 0xD3, 0xAA, 0xE7, 0x99, 0x27,
+    0x71, 0xCC, 0x7F, 0x43, 0xF7, 0x0D, 0x63, 0x73, 0x24, 0xB5, 0xD5, 0xAB, 0x8A, 0xCB, 0x4F, 0xA6,
+    0xFB, 0x06, 0x97, 0xCF, 0x93, 0xE7, 0xC1, 0x7B, 0xE9, 0x8F, 0x8F, 0xAD, 0x7B, 0xD8, 0x37, 0x94,
+    0xDF, 0xD6, 0x9B, 0x63, 0x4B, 0x43, 0xF9, 0x93, 0x7B, 0x73, 0xA0, 0x72, 0xDF, 0x5B, 0xEF, 0xCD,
+    0xF1, 0xFF, 0x7B, 0x6F, 0x12, 0x2B, 0xAA, 0x54, 0xF7, 0x52, 0xE5, 0x6B, 0x9B, 0xB4, 0x7A, 0x7C,
+    0x61, 0x44, 0x0C, 0xB2, 0x59, 0xDE, 0xC0, 0xA0, 0xF8, 0x44, 0x0C, 0x7A, 0x68, 0x10, 0x04, 0x17,
+    0xA0, 0xBE, 0x46, 0x2E, 0xE0, 0x14, 0x5F, 0x38, 0x9E, 0x34, 0xF7, 0x28, 0x9F, 0x66, 0x84, 0x03,
+    0xC6, 0xF1, 0xE2, 0x70, 0x37, 0x8E, 0xF6, 0x93, 0xED, 0x67, 0xFD, 0xA5, 0x83, 0xAB, 0xA6, 0x7B,
+    0xF0, 0x60, 0xD2, 0xE6, 0x9B, 0x8C, 0xF0, 0xB1, 0x7C, 0x1A, 0xE0, 0x53, 0x07, 0xD7, 0x8C, 0xB5,
+    0xD5, 0xEC, 0xB8, 0x1A, 0xA9, 0x64, 0x80, 0xC6, 0x4F, 0x6D, 0x1A, 0xA8, 0x06, 0x16, 0x98, 0x30,
+    0x8E, 0x79, 0xC8, 0xD8, 0x45, 0x33, 0xA2, 0x7E, 0x54, 0x30, 0x5F, 0xB3, 0xD0, 0xE7, 0x36, 0x47,
+    0x3C, 0x2F, 0xA6, 0xAC, 0x96, 0x54, 0x27, 0x7F, 0xCB, 0xF3, 0xFD, 0x90, 0x66, 0xF9, 0xDD, 0xBC,
+    0x6F, 0x06, 0xA8, 0x3E, 0x25, 0x1B, 0x64, 0x6D, 0x96, 0xA9, 0x36, 0xB6, 0xBD, 0x68, 0xD1, 0xC7,
+    0x7D, 0xFE, 0x4C, 0xC3, 0x9D, 0xF3, 0x65, 0x8A, 0x4F, 0x47, 0xB7, 0x5A, 0x4B, 0xA3, 0xE3, 0x97,
+    0xDD, 0x6D, 0xD5, 0xB7, 0x8F, 0x2B, 0xE4, 0x55, 0x72, 0x05, 0x17, 0x58, 0xD9, 0x8B, 0x0E, 0x3F,
+    0x9B, 0x9A, 0xE8, 0xA7, 0xE2, 0x14, 0xCC, 0x9F, 0xB3, 0x58, 0x9E, 0x89, 0xFF, 0xE8, 0x1D, 0x8F,
+    0xA5, 0x50, 0xDB, 0x73, 0xF1, 0x81, 0x2F, 0x0E, 0xD2, 0x4F, 0xC5, 0x59, 0x98, 0xA7, 0xD0, 0xA6,
+    0xDD, 0x8C, 0xA8, 0x90, 0x37, 0x6C, 0xB2, 0x5C, 0x9C, 0x67, 0xF1, 0x12, 0x40, 0xF6, 0x1F, 0xDD,
+    0xEC, 0x53, 0x74, 0x22, 0xF7, 0xE5, 0xC6, 0x8F, 0xEC, 0x41, 0x90, 0xA0, 0x58, 0x50, 0x2A, 0x5E,
+    0x1B, 0xB4, 0xFA, 0x49, 0x3D, 0xE7, 0xE2, 0xF7, 0x2D, 0xE7, 0xBC, 0x67, 0x99, 0xED, 0xD6, 0xF2,
+    0xE3, 0xD7, 0xBB, 0xF6, 0x0E, 0xC9, 0x49, 0x37, 0x58, 0x26, 0x7A, 0x9E, 0x7A, 0x90, 0x8A, 0xD5,
+    0x35, 0x1F, 0x7F, 0x7E, 0x3C, 0xB3, 0x2B, 0xBC, 0x6F, 0x66, 0x97, 0x76, 0xBC, 0x50, 0x99, 0xAC,
+    0xBD, 0x2B, 0xBB, 0x4B, 0xE5, 0xC7, 0x27, 0x78, 0x10, 0x3E, 0x2D, 0x0F, 0x5D, 0x5C, 0x31, 0xDA,
+    0xEF, 0xCD, 0x2E, 0xFF, 0xF0, 0x0F, 0xD9, 0xC0, 0x5B, 0xA5, 0x5A, 0xDB, 0x6A, 0x72, 0x6F, 0x49,
+    0x0C, 0xDB, 0xF2, 0x1C, 0xE1, 0xA0, 0x6F, 0x35, 0xFB, 0xD4, 0xD1, 0x8F, 0xB6, 0xE7, 0x2A, 0x32,
+    0xCE, 0xB7, 0x82, 0x8C, 0xFF, 0x62, 0x6C, 0xFB, 0xDA, 0x70, 0x99, 0xE9, 0xBD, 0xDE, 0x52, 0x80,
+    0x01, 0x4D, 0x26, 0xC2, 0x7F, 0xDE, 0xE6, 0x1A, 0x35, 0xEC, 0xE9, 0x10, 0x89, 0x21, 0x1E, 0xD9,
+    0xB8, 0xD3, 0x4A, 0x80, 0xA8, 0xFB, 0x33, 0xAC, 0xFF, 0xCD, 0x67, 0x85, 0x78, 0x37, 0xB5, 0xA9,
+    0x1B, 0x03, 0xB5, 0xFB, 0xD6, 0xAF, 0x3C, 0xB6, 0xB5, 0x3B, 0xA5, 0x76, 0xCE, 0xFF, 0xFC, 0x63,
+    0x91, 0xBC, 0xFB, 0x2F, 0x4C, 0xDE, 0x6D, 0x56, 0x92, 0x77, 0xEB, 0x65, 0x54, 0xD9, 0x59, 0x89,
+    0x2D, 0xCF, 0x74, 0x02, 0x92, 0xC4, 0xE7, 0x09, 0x0D, 0x28, 0xB6, 0xD0, 0x2A, 0x59, 0xB0, 0x49,
+    0xE6, 0xC7, 0xA2, 0xDE, 0xC1, 0xEF, 0xAA, 0xAE, 0x6A, 0x8D, 0x0C, 0x79, 0xD6, 0x35, 0xF8, 0x1A,
+    0x80, 0x33, 0x6B, 0xF2, 0xEE, 0x2B, 0x99, 0xDA, 0x0B, 0x4C, 0xDE, 0x15, 0x23, 0xFB, 0x10, 0xF9,
+    0xE9, 0x6D, 0x26, 0x6C, 0x92, 0xC9, 0xBB, 0xA4, 0xB8, 0xF5, 0x0C, 0x5E, 0x42, 0xD2, 0xE7, 0xA3,
+    0xBC, 0x2E, 0x7E, 0x4C, 0xB0, 0xA5, 0xEB, 0x60, 0x8B, 0x6C, 0x4D, 0x04, 0x34, 0xE3, 0x6F, 0xB7,
+    0x47, 0xD7, 0xEE, 0x07, 0xB6, 0xE9, 0x03, 0x3C, 0xD2, 0xF8, 0x01, 0x80, 0xB1, 0xDB, 0xBE, 0x47,
+    0x57, 0x61, 0xAA, 0x05, 0x21, 0xF7, 0x00, 0x46, 0xAD, 0x4F, 0x16, 0x8F, 0xC0, 0x16, 0xFE, 0x1F,
+    0xD5, 0x5B, 0x3F, 0x8C, 0x1C, 0x67, 0x15, 0x7F, 0x33, 0x9B, 0xBB, 0x4D, 0x6E, 0x24, 0x0F, 0x85,
+    0x85, 0xC0, 0x51, 0x6E, 0x9A, 0x80, 0x00, 0xC5, 0x99, 0x26, 0x45, 0x8A, 0xB3, 0x67, 0x4C, 0x84,
+    0x42, 0xC7, 0x15, 0x08, 0x0B, 0xA5, 0x81, 0x92, 0xEA, 0x52, 0xB8, 0xB8, 0x22, 0x99, 0x9D, 0x04,
+    0x21, 0x24, 0x1A, 0xDC, 0xD3, 0x50, 0xB8, 0x32, 0x8D, 0x0B, 0x17, 0x29, 0x72, 0x77, 0x63, 0x53,
+    0x20, 0x41, 0xC1, 0x4A, 0x29, 0x28, 0x99, 0x18, 0x23, 0x24, 0x52, 0x78, 0x10, 0x8B, 0x32, 0x38,
+    0xBB, 0xFB, 0xF1, 0x7E, 0xEF, 0xBD, 0x6F, 0x66, 0xEF, 0xEC, 0x44, 0x42, 0x8A, 0x6F, 0x76, 0xD7,
+    0xB7, 0x6F, 0xD7, 0xBB, 0x73, 0xF3, 0xBD, 0xEF, 0xF7, 0x7B, 0xDF, 0xFB, 0xF7, 0x7D, 0x47, 0x44,
+    0x19, 0xF1, 0xE3, 0x24, 0x67, 0xE1, 0x58, 0x8C, 0x5C, 0x49, 0x34, 0xFE, 0x2B, 0x8B, 0xF8, 0xCF,
+    0x15, 0x51, 0xF2, 0x6B, 0x16, 0x59, 0xC4, 0xA2, 0x80, 0x98, 0x47, 0x53, 0x0A, 0x67, 0xE3, 0x29,
+    0x8D, 0x9A, 0x71, 0x4D, 0xD1, 0x74, 0x54, 0x53, 0x5C, 0x8D, 0x1A, 0x4A, 0x9D, 0x6B, 0x68, 0x02,
+    0xB1, 0xBC, 0xFD, 0xBB, 0x26, 0x98, 0xF3, 0x45, 0xFC, 0x29, 0x5F, 0x59, 0x53, 0xD0, 0xC6, 0x15,
+    0x8B, 0x94, 0xEF, 0x38, 0xC7, 0x50, 0xF3, 0x63, 0x08, 0xEA, 0x1F, 0x41, 0xCD, 0x62, 0x34, 0x83,
+    0x68, 0xF0, 0xDF, 0xA9, 0xFF, 0x22, 0x5A, 0x8E, 0x2A, 0xCA, 0xDC, 0x1F, 0x2A, 0x72, 0xD7, 0x1F,
+    0x55, 0xA3, 0x96, 0x5C, 0x19, 0xF1, 0x28, 0x39, 0xDF, 0x2F, 0xA3, 0xA4, 0x64, 0x91, 0xE5, 0x10,
+    0xAC, 0x1B, 0xC4, 0x11, 0xBF, 0xF0, 0x8D, 0x0B, 0x0A, 0x20, 0xF8, 0xF2, 0x82, 0xA2, 0x19, 0x7F,
+    0x91, 0xB2, 0xB8, 0xB7, 0x6C, 0x28, 0x71, 0x0F, 0x1A, 0x1A, 0xBB, 0xEF, 0xF2, 0x70, 0x5F, 0xE9,
+    0x06, 0xDF, 0x83, 0x58, 0x74, 0xE2, 0x50, 0x3F, 0x4D, 0x6E, 0xB2, 0x48, 0x45, 0xC9, 0x77, 0xFC,
+    0x55, 0x61, 0xCB, 0x22, 0x86, 0x72, 0xBB, 0xF8, 0xE8, 0xA5, 0xEE, 0x16, 0x03, 0xE1, 0xB7, 0x85,
+    0x61, 0x53, 0xC0, 0xF6, 0xD5, 0x5E, 0xD1, 0x0F, 0xA1, 0x23, 0x50, 0x4C, 0xA0, 0xCF, 0x65, 0x7C,
+    0xF4, 0xDC, 0x39, 0xC2, 0x99, 0xE6, 0xF2, 0xF2, 0x2E, 0x44, 0x7C, 0x6F, 0x26, 0xE8, 0x3C, 0x28,
+    0x05, 0x5D, 0xF9, 0xCF, 0x68, 0x2A, 0x5A, 0x5E, 0x58, 0x41, 0x8F, 0x4E, 0xE3, 0x68, 0x48, 0x2A,
+    0x96, 0x86, 0xA6, 0xE1, 0x69, 0x88, 0x1A, 0xA6, 0x86, 0xAA, 0xE1, 0xAA, 0xC8, 0x92, 0x62, 0x4B,
+    0x8A, 0x2E, 0x29, 0xBE, 0xA4, 0x08, 0x93, 0x62, 0x4C, 0x8A, 0x32, 0x09, 0xCE, 0x44, 0x82, 0xB4,
+    0x18, 0x1E, 0x5E, 0x04, 0x6D, 0x5C, 0x2F, 0x2F, 0x82, 0xB8, 0xAA, 0xC5, 0x2F, 0x67, 0xAD, 0x16,
+    0x60, 0x19, 0xE0, 0xC9, 0x7D, 0xB9, 0xEF, 0x03, 0xFE, 0x20, 0x78, 0x8C, 0xB7, 0x63, 0x99, 0xE6,
+    0x93, 0xB3, 0x14, 0x06, 0x94, 0x02, 0xE1, 0x80, 0x84, 0x04, 0x12, 0x16, 0x48, 0x68, 0x50, 0x1E,
+    0x94, 0x08, 0x65, 0x42, 0xA9, 0x50, 0x2E, 0x94, 0x0C, 0x65, 0x43, 0xE9, 0x50, 0x3E, 0x94, 0x10,
+    0x65, 0xC4, 0x28, 0x31, 0x4E, 0x42, 0xA8, 0x43, 0x82, 0xFD, 0x1E, 0x0F, 0x40, 0x2F, 0x64, 0xB5,
+    0x91, 0x21, 0x54, 0x9C, 0x55, 0x71, 0x38, 0x57, 0xB0, 0xAA, 0x68, 0xC2, 0x77, 0x7F, 0x7E, 0x52,
+    0x1B, 0x9A, 0xE3, 0xA7, 0x28, 0xFA, 0xEC, 0x4D, 0x39, 0xB8, 0x29, 0x5A, 0xA9, 0x72, 0x3A, 0x36,
+    0x38, 0x8D, 0xEF, 0x03, 0xBF, 0xEC, 0xE3, 0xDC, 0x9B, 0xF4, 0xE8, 0x73, 0xA8, 0x36, 0x6B, 0x56,
+    0x63, 0x16, 0x5B, 0x56, 0x53, 0x56, 0x4B, 0x56, 0x43, 0x56, 0x3B, 0x56, 0x33, 0x56, 0x2B, 0x16,
+    0x23, 0x56, 0x1B, 0x56, 0x13, 0x56, 0x0B, 0x56, 0x03, 0x56, 0xFB, 0x55, 0xF3, 0x15, 0xEB, 0x55,
+    0xE3, 0x55, 0xDB, 0x55, 0xD3, 0x55, 0xCB, 0x55, 0xC3, 0x55, 0xBB, 0xED, 0x10, 0x0E, 0x7F, 0x0B,
+    0x01, 0x73, 0xA5, 0x57, 0x6C, 0x36, 0xC9, 0xEF, 0x79, 0x9C, 0xC9, 0xC7, 0x43, 0xE2, 0x7C, 0x51,
+    0xDE, 0xB8, 0xB2, 0x01, 0x3E, 0x8E, 0xD5, 0x19, 0xE7, 0x80, 0x2C, 0xD0, 0x6F, 0x63, 0x5D, 0xE7,
+    0x35, 0x6D, 0x1A, 0xDA, 0x17, 0x69, 0x9F, 0x02, 0xF7, 0x5E, 0x4D, 0xA3, 0x47, 0xAE, 0xA2, 0x28,
+    0x37, 0x9F, 0xC6, 0x4A, 0x60, 0xDC, 0x61, 0x4D, 0x7B, 0x1B, 0x90, 0xA4, 0xC0, 0x74, 0x02, 0x07,
+    0xD8, 0xB6, 0xD0, 0xE3, 0x0A, 0xA2, 0xDA, 0xEE, 0x9A, 0xF8, 0x82, 0x2F, 0x48, 0x0B, 0x76, 0x44,
+    0x79, 0xBC, 0x3D, 0x69, 0xC0, 0x1D, 0x2B, 0x1F, 0x55, 0xEF, 0x3C, 0xA1, 0xFC, 0x70, 0x99, 0xC3,
+    0x29, 0x7B, 0xD4, 0x85, 0x87, 0x79, 0x04, 0xDB, 0x08, 0xD7, 0xE3, 0x32, 0xC6, 0x74, 0xFE, 0x8E,
+    0xA9, 0x06, 0x0E, 0xF9, 0x04, 0x1D, 0xDC, 0x5C, 0x77, 0xC7, 0x21, 0x8F, 0xAB, 0x10, 0xAD, 0xAC,
+    0x40, 0xB6, 0xA0, 0xED, 0x6D, 0x1E, 0xA0, 0x4C, 0xF8, 0x7F, 0xFF, 0xE4, 0xD0, 0x14, 0x3A, 0x90,
+    0x74, 0x50, 0x9E, 0x37, 0x01, 0x16, 0x7D, 0x89, 0xAE, 0xA8, 0xB3, 0x10, 0xA3, 0x09, 0xBF, 0xB7,
+    0xC9, 0x38, 0xCF, 0xBB, 0xE9, 0x60, 0x02, 0xDB, 0xE1, 0xBA, 0xE0, 0x2C, 0x29, 0x25, 0xD1, 0xDD,
+    0x5E, 0x4A, 0x7E, 0x15, 0x44, 0x9B, 0x6A, 0xD5, 0x12, 0x60, 0x62, 0x09, 0x2C, 0x77, 0x20, 0x1A,
+    0xC9, 0x16, 0x19, 0xF2, 0x9D, 0xE1, 0x21, 0x47, 0xF0, 0xD0, 0xE8, 0xA1, 0xE1, 0x83, 0xA2, 0x6B,
+    0xAE, 0x8B, 0x89, 0x81, 0xBC, 0x6E, 0x22, 0xE4, 0x98, 0x56, 0xE8, 0xAE, 0x4D, 0x69, 0x2C, 0x31,
+    0x31, 0x70, 0xA6, 0xE6, 0x16, 0x2A, 0x19, 0x81, 0x7C, 0x3C, 0x14, 0xE4, 0x61, 0xBE, 0x0D, 0x78,
+    0x2A, 0x01, 0xF5, 0xF1, 0xB2, 0x07, 0x35, 0xDD, 0x0C, 0xEF, 0xDC, 0xC7, 0x4B, 0x0D, 0x98, 0x1A,
+    0x31, 0x2D, 0x64, 0x86, 0xF9, 0x0E, 0x0C, 0x06, 0x26, 0xFD, 0x78, 0x01, 0x7C, 0xDB, 0x41, 0xBC,
+    0xC8, 0xD3, 0xC2, 0x65, 0x8A, 0x94, 0x2F, 0x73, 0xAE, 0x52, 0x51, 0xE0, 0xB3, 0xA3, 0xCE, 0xAF,
+    0xCF, 0xBD, 0x40, 0x31, 0x26, 0xF5, 0x19, 0x8D, 0x96, 0xB7, 0x6F, 0x21, 0x51, 0x9C, 0xA9, 0xB0,
+    0x22, 0xCF, 0x67, 0x8A, 0x22, 0x92, 0xD2, 0x57, 0xBF, 0x52, 0x8C, 0x0A, 0x5F, 0xD9, 0xED, 0xDB,
+    0x25, 0x10, 0xAE, 0xE8, 0xC4, 0xB9, 0x53, 0x33, 0x97, 0x0A, 0xF9, 0xB8, 0x13, 0xAF, 0x77, 0x88,
+    0xF0, 0x65, 0x19, 0x33, 0xE2, 0xAE, 0xCF, 0x46, 0x6D, 0xD0, 0x46, 0x35, 0xD2, 0x95, 0x70, 0x96,
+    0x94, 0xE3, 0x26, 0xBB, 0x76, 0x32, 0x65, 0x75, 0xF9, 0xEB, 0x87, 0x54, 0xE4, 0x52, 0x99, 0xC9,
+    0x33, 0xB3, 0x9A, 0x30, 0xA9, 0x5F, 0xCC, 0x23, 0xE7, 0xF2, 0xC0, 0x2D, 0xAC, 0x48, 0xB7, 0xE9,
+    0x2E, 0x6C, 0x3A, 0x37, 0x64, 0x80, 0x87, 0x50, 0x58, 0xA0, 0x48, 0x21, 0x5E, 0xC5, 0x3C, 0x31,
+    0x77, 0x14, 0x75, 0x9C, 0x31, 0x42, 0x74, 0x55, 0xF5, 0x50, 0x30, 0x5D, 0x84, 0xA9, 0xF3, 0xEF,
+    0xBD, 0xD5, 0xA8, 0x8B, 0x44, 0x91, 0x96, 0x56, 0x5A, 0xDF, 0x1F, 0x76, 0x35, 0xE6, 0x97, 0x0B,
+    0xD6, 0x45, 0xFA, 0x09, 0xAF, 0x3E, 0x2E, 0x08, 0x46, 0xEE, 0xB3, 0x9A, 0xC6, 0xEF, 0xC3, 0x57,
+    0x08, 0x3A, 0x34, 0x34, 0x1C, 0x41, 0x1E, 0xF2, 0xD5, 0x6D, 0x8C, 0x0A, 0x9E, 0xAD, 0xE5, 0x10,
+    0xFD, 0xA1, 0xB7, 0x25, 0xBB, 0xA3, 0x55, 0xB3, 0x11, 0x28, 0x80, 0x05, 0x01, 0x0C, 0x02, 0x1A,
+    0x04, 0x38, 0x08, 0x78, 0x10, 0x00, 0x81, 0xDE, 0x24, 0x90, 0x08, 0x26, 0x3A, 0x83, 0xA2, 0xF3,
+    0x2E, 0xD2, 0x58, 0x00, 0x30, 0x04, 0x64, 0x48, 0xA0, 0xE9, 0x0C, 0x49, 0x1A, 0x50, 0xA2, 0xE4,
+    0xB8, 0x91, 0xDE, 0x43, 0x8B, 0xBA, 0xAE, 0xC0, 0xDB, 0x60, 0xF6, 0xAA, 0x84, 0x86, 0xF1, 0x19,
+    0x97, 0x25, 0x78, 0x29, 0x56, 0x26, 0x65, 0x2C, 0xC5, 0xCC, 0x52, 0xA8, 0x79, 0x2F, 0x05, 0x37,
+    0x05, 0x4E, 0x91, 0x53, 0xD4, 0x4C, 0x0A, 0x78, 0x8A, 0x9E, 0x95, 0x67, 0x2A, 0x05, 0x40, 0x45,
+    0xD0, 0xBA, 0x40, 0xEA, 0x29, 0x05, 0x44, 0x45, 0xF1, 0xEC, 0xE2, 0x3B, 0xB2, 0x61, 0x26, 0xF0,
+    0x91, 0xEE, 0x57, 0x7C, 0xEF, 0x7F, 0xA0, 0xB2, 0xB8, 0xD6, 0x60, 0x1D, 0xBE, 0x76, 0x8E, 0xB0,
+    0xB6, 0x9D, 0x7F, 0x8A, 0xF9, 0x56, 0xB4, 0x9D, 0xB4, 0x06, 0xA9, 0x20, 0x7A, 0x06, 0xD0, 0x01,
+    0x7D, 0x16, 0x70, 0x42, 0xFE, 0x4D, 0xCD, 0x84, 0xE8, 0x65, 0xFE, 0x10, 0x80, 0x01, 0xAF, 0x55,
+    0xB8, 0xBE, 0x64, 0xCF, 0x75, 0x4B, 0x9B, 0x71, 0x7A, 0x6B, 0x2D, 0x61, 0x61, 0x64, 0x4D, 0x2B,
+    0xB6, 0x97, 0x6F, 0x9E, 0xED, 0x49, 0x05, 0xB9, 0xD3, 0xF8, 0x44, 0x36, 0x40, 0xEC, 0x8D, 0xF9,
+    0x33, 0xF7, 0x8B, 0xE1, 0x0C, 0x90, 0x25, 0xBB, 0xDA, 0xC9, 0x94, 0x7D, 0xEA, 0x67, 0x3C, 0x48,
+    0x38, 0x9D, 0xF8, 0x1E, 0xF8, 0x58, 0x7A, 0xB9, 0x67, 0xED, 0x31, 0x5F, 0x07, 0x7B, 0xDC, 0x0F,
+    0x72, 0x1A, 0x2F, 0x47, 0x25, 0xC5, 0x27, 0x3C, 0xEB, 0x97, 0xC2, 0x85, 0xD7, 0x68, 0x22, 0x16,
+    0x53, 0x9E, 0x86, 0xF3, 0xC6, 0x79, 0xC2, 0x29, 0xBD, 0x2E, 0x09, 0xA4, 0xD2, 0xC3, 0x3F, 0xBA,
+    0x82, 0xD0, 0x95, 0xAC, 0x0F, 0x74, 0x5F, 0x9C, 0x7E, 0x7C, 0x47, 0x13, 0xCC, 0x10, 0x91, 0xEF,
+    0xA3, 0x9A, 0xD2, 0x6B, 0x33, 0x0E, 0xB6, 0x87, 0x74, 0x6E, 0xA9, 0x49, 0x51, 0x5A, 0x6B, 0xC8,
+    0xA2, 0x3E, 0xA6, 0x99, 0x95, 0xDA, 0xFF, 0xBC, 0xE1, 0x91, 0x03, 0x70, 0x53, 0x0A, 0xFF, 0x4B,
+    0xBE, 0x7F, 0x2E, 0x4F, 0x5C, 0x8A, 0x2C, 0x17, 0x9E, 0x2A, 0xB6, 0x27, 0x10, 0x01, 0x16, 0x19,
+    0xF5, 0xCF, 0xC2, 0x90, 0x9E, 0xDB, 0xB3, 0xD5, 0xED, 0x95, 0x09, 0x4F, 0xED, 0x04, 0xAB, 0x75,
+    0x4B, 0x76, 0x36, 0xB0, 0xAF, 0xB1, 0x07, 0x36, 0x38, 0x19, 0x65, 0x48, 0x77, 0xFD, 0x5E, 0xC6,
+    0xBB, 0xF2, 0xCB, 0x73, 0xF9, 0x69, 0x41, 0x8F, 0xA6, 0xCB, 0xFC, 0xC3, 0xE3, 0xF3, 0xF0, 0x4C,
+    0x09, 0x0F, 0xCC, 0x3F, 0x3C, 0x34, 0x8F, 0x9C, 0xEA, 0x98, 0xCF, 0x5A, 0x67, 0xBF, 0x62, 0x4B,
+    0x0D, 0xD2, 0xB8, 0x8D, 0x58, 0x5B, 0x50, 0x8A, 0x66, 0x8D, 0xBA, 0x6E, 0xDF, 0x07, 0xCC, 0x71,
+    0x7F, 0xED, 0xF1, 0x5F, 0x95, 0x7B, 0xFB, 0x19, 0xF1, 0x74, 0x82, 0xD9, 0xA9, 0x19, 0xF1, 0x74,
+    0xA2, 0xCA, 0x5C, 0x9D, 0xEE, 0x3E, 0xE9, 0xF6, 0xC0, 0xE5, 0xFE, 0x76, 0x93, 0x25, 0x12, 0x02,
+    0xE7, 0x78, 0x2A, 0xE9, 0xE3, 0x03, 0xBE, 0xCF, 0x49, 0x19, 0x2C, 0x29, 0x58, 0x60, 0x31, 0xA2,
+    0x22, 0xC8, 0xF2, 0x08, 0x5F, 0x95, 0x32, 0xB7, 0x0A, 0x85, 0x44, 0x5C, 0xC1, 0x20, 0x58, 0x8A,
+    0xE1, 0x4E, 0xA4, 0x35, 0x59, 0x88, 0x84, 0x25, 0xA6, 0xE5, 0xB1, 0x98, 0xCC, 0xB1, 0x2C, 0x67,
+    0xC8, 0x13, 0x59, 0xD6, 0x0B, 0x8C, 0x3B, 0xE2, 0x22, 0xA4, 0x12, 0x4E, 0x6A, 0xCA, 0x58, 0xB7,
+    0xE5, 0x8F, 0x18, 0x82, 0xD0, 0xC9, 0xFA, 0x03, 0xC8, 0xFC, 0xF8, 0x61, 0xAF, 0x5A, 0x28, 0x1F,
+    0x44, 0x75, 0x2F, 0x47, 0xFD, 0x12, 0x18, 0x3B, 0x71, 0xD0, 0x5C, 0xF3, 0xB8, 0xEB, 0x73, 0x54,
+    0x12, 0xC7, 0xB8, 0x26, 0xD3, 0xBD, 0x90, 0xD4, 0x6A, 0x0E, 0x13, 0x85, 0x89, 0x42, 0xD1, 0x2A,
+    0xB4, 0x18, 0x62, 0x0A, 0xB2, 0x9C, 0xC1, 0x4D, 0x1E, 0x1E, 0x4C, 0xBD, 0x23, 0x68, 0xA9, 0xEB,
+    0x20, 0x5B, 0x66, 0xAD, 0x3E, 0x69, 0xD2, 0x35, 0xBF, 0x79, 0xBD, 0x69, 0x05, 0x37, 0xED, 0xF7,
+    0x1E, 0x34, 0x93, 0x7B, 0x71, 0xDA, 0xD7, 0x77, 0xDA, 0xEE, 0xB8, 0xB3, 0xEE, 0x30, 0x6F, 0x75,
+    0x4D, 0xF2, 0x6F, 0x4A, 0xE0, 0xFC, 0x40, 0xE2, 0xB1, 0x38, 0x47, 0xDF, 0xB9, 0xDB, 0x23, 0xCB,
+    0xE6, 0xCF, 0x0B, 0xF5, 0x79, 0x87, 0xAB, 0x54, 0xC0, 0x81, 0xFB, 0x31, 0xC6, 0xFD, 0x44, 0x3C,
+    0xA4, 0x6C, 0x4F, 0x1D, 0xD2, 0xDB, 0x67, 0x52, 0x85, 0x35, 0xB6, 0x61, 0x5D, 0xFC, 0x88, 0x03,
+    0xD9, 0x9B, 0xFC, 0x9D, 0xFB, 0x23, 0xDF, 0xE0, 0x53, 0xAC, 0x71, 0xEC, 0x5B, 0x7C, 0x8B, 0xFF,
+    0xAD, 0x3C, 0x9E, 0x31, 0xB8, 0xB1, 0x2C, 0x9E, 0x51, 0xA5, 0x15, 0xBF, 0x84, 0xAC, 0x9F, 0x4A,
+    0x1F, 0x62, 0x43, 0xC1, 0x1D, 0x57, 0xDD, 0xD2, 0xBB, 0x8B, 0x01, 0x5F, 0x86, 0x2B, 0x1D, 0x0A,
+    0x5C, 0x64, 0x86, 0xF9, 0x4A, 0xBF, 0xB3, 0xE9, 0xFA, 0x2A, 0x45, 0x8C, 0x0E, 0x9C, 0xFB, 0xFE,
+    0xA6, 0x02, 0xBD, 0x8D, 0x46, 0xD6, 0xCE, 0xCC, 0xC7, 0x7B, 0x84, 0xF6, 0xEC, 0x4D, 0x64, 0xBD,
+    0xF7, 0x86, 0x44, 0x3B, 0x0F, 0x00, 0xD6, 0x02, 0x21, 0x33, 0x41, 0x12, 0x49, 0xAF, 0x8C, 0xE7,
+    0xA7, 0xD7, 0x1C, 0x5F, 0xFF, 0xA4, 0x71, 0xDF, 0xD9, 0x08, 0xCC, 0xF7, 0x29, 0xE7, 0x84, 0xF1,
+    0x0D, 0x8E, 0xDC, 0x8F, 0x78, 0x0E, 0x17, 0xC2, 0xE5, 0xA9, 0x83, 0x03, 0x6A, 0xE6, 0xF5, 0x40,
+    0xC0, 0x7F, 0xBB, 0xAF, 0xEA, 0x42, 0xC9, 0x48, 0xA3, 0xBF, 0x40, 0xF3, 0x4C, 0x3C, 0xF6, 0x07,
+    0x16, 0xF8, 0x36, 0x3B, 0xBD, 0xB8, 0x24, 0x8A, 0xA3, 0x6D, 0x23, 0xDB, 0xCA, 0x7F, 0xC3, 0xF9,
+    0x88, 0xB2, 0xC5, 0xEE, 0xCA, 0xDE, 0xF9, 0x7A, 0x94, 0xCF, 0xCB, 0x40, 0xA4, 0x48, 0xF1, 0x9B,
+    0x10, 0xD2, 0xDC, 0xF5, 0x36, 0x6F, 0x1D, 0x09, 0x9B, 0x9B, 0xAC, 0x82, 0x7D, 0xF2, 0x13, 0x64,
+    0x2E, 0x38, 0xBD, 0x04, 0x19, 0x49, 0x25, 0x6C, 0x64, 0x42, 0x87, 0x9B, 0x2B, 0x1F, 0xB5, 0x11,
+    0x42, 0xCA, 0x88, 0x66, 0xB3, 0x15, 0x29, 0x27, 0xA4, 0xA4, 0x90, 0xB2, 0x42, 0x4A, 0x0B, 0x29,
+    0x2F, 0xA4, 0xC4, 0x90, 0x32, 0x43, 0x4A, 0x8D, 0x71, 0x63, 0xE4, 0x18, 0x3B, 0x46, 0x8F, 0xF1,
+    0x63, 0x04, 0x79, 0x86, 0x3C, 0x45, 0x1D, 0x47, 0x3F, 0x13, 0xFD, 0xE7, 0x7D, 0x57, 0x5A, 0x13,
+    0xD9, 0xD4, 0x6A, 0x8F, 0x9D, 0xB2, 0xDB, 0x16, 0xC7, 0xE8, 0x4C, 0x47, 0x26, 0x7C, 0x2C, 0x40,
+    0x08, 0x0A, 0xAD, 0x16, 0xC9, 0x98, 0x50, 0x62, 0x9A, 0x77, 0x79, 0x73, 0xF7, 0x53, 0x78, 0x59,
+    0xF8, 0x4C, 0xBA, 0xB0, 0x93, 0x3B, 0x48, 0xD0, 0x85, 0x1C, 0x65, 0x47, 0xE9, 0xF1, 0xCD, 0x7D,
+    0x23, 0xE8, 0x52, 0xBE, 0x72, 0xD6, 0xC0, 0xBA, 0x0B, 0xA6, 0xAA, 0x1D, 0x48, 0x59, 0xD9, 0xDC,
+    0xDD, 0x58, 0x22, 0xC2, 0x9B, 0x2B, 0xFB, 0x02, 0xED, 0x4A, 0xF7, 0xE5, 0xAA, 0xB5, 0x76, 0x86,
+    0x27, 0xC2, 0x72, 0x72, 0x4B, 0xCA, 0x2D, 0x2B, 0xB7, 0xDC, 0xC0, 0xF2, 0x72, 0x7F, 0x38, 0xCC,
+    0x1C, 0xD4, 0x9D, 0x0D, 0x5E, 0x18, 0x5A, 0x7E, 0xEB, 0xD9, 0x16, 0xCD, 0xDB, 0x25, 0x71, 0xD7,
+    0xCC, 0x5D, 0x53, 0x77, 0xE3, 0x66, 0x4F, 0xB8, 0xB9, 0x38, 0x28, 0x37, 0x5B, 0xF4, 0xBC, 0xAA,
+    0x2B, 0xCE, 0xD3, 0x2D, 0xC5, 0xC1, 0xD5, 0x27, 0x72, 0x30, 0xA3, 0x8A, 0xCA, 0x4D, 0x5F, 0x1D,
+    0xC1, 0x7E, 0x88, 0x21, 0x17, 0xD8, 0x77, 0x49, 0xDD, 0x23, 0x39, 0x84, 0x86, 0xCB, 0x5E, 0x0B,
+    0x6E, 0xAD, 0xC1, 0xBA, 0xD8, 0x68, 0xFF, 0xAF, 0x8A, 0xE7, 0xFD, 0xE9, 0xA7, 0xEE, 0xA5, 0xDB,
+    0xDF, 0xA2, 0xB5, 0xC0, 0xD8, 0xAA, 0x64, 0xDD, 0x9E, 0x34, 0x79, 0xE8, 0x8B, 0x59, 0x2E, 0xBB,
+    0xE6, 0x48, 0x20, 0xE4, 0x5C, 0x68, 0x8E, 0xF6, 0x51, 0x2A, 0xCE, 0x34, 0x33, 0x89, 0x26, 0x52,
+    0x21, 0xF2, 0x48, 0x42, 0xC8, 0x5C, 0x80, 0x57, 0xD9, 0xA2, 0x9D, 0x84, 0xFD, 0xDB, 0x1C, 0x6D,
+    0x9D, 0x54, 0xBC, 0x70, 0xE6, 0x25, 0xFF, 0x4A, 0x21, 0x51, 0xA7, 0x90, 0xA9, 0x15, 0x02, 0x83,
+    0x9D, 0x00, 0x2D, 0x91, 0xA1, 0x25, 0xFF, 0x79, 0x6B, 0x2E, 0x3A, 0xA3, 0x23, 0x27, 0x9A, 0x53,
+    0x90, 0x9F, 0x45, 0xB6, 0x83, 0x0E, 0x60, 0x9A, 0x17, 0x89, 0xB0, 0xBB, 0x1C, 0x77, 0x22, 0x29,
+    0x79, 0xA8, 0x24, 0xE7, 0x91, 0x52, 0xC5, 0xD0, 0x6F, 0xEE, 0x16, 0x68, 0x46, 0x1D, 0x41, 0x3B,
+    0x64, 0x33, 0x01, 0x04, 0xE3, 0x9D, 0xF5, 0x5B, 0xBA, 0xEF, 0x3D, 0xB6, 0x2D, 0xDD, 0xC8, 0xBD,
+    0x51, 0x23, 0xAF, 0xA5, 0x95, 0xCE, 0xA1, 0x02, 0x25, 0xE1, 0x5D, 0x7B, 0x83, 0x68, 0xAF, 0xA1,
+    0x61, 0x9F, 0xFB, 0x1D, 0x0B, 0x2F, 0x0F, 0xF0, 0x89, 0x76, 0x89, 0x35, 0xB1, 0x09, 0xFB, 0xA6,
+    0xD9, 0x9A, 0x22, 0x7C, 0xF6, 0x88, 0xF5, 0x9E, 0x0F, 0x9B, 0x51, 0x77, 0xC4, 0x7A, 0x77, 0xF5,
+    0x88, 0xF5, 0xB3, 0x47, 0xFD, 0xFF, 0x49, 0x1A, 0x7D, 0xE4, 0x9F, 0x0B, 0xBC, 0x3F, 0x9F, 0x09,
+    0xBE, 0xBF, 0x6C, 0x04, 0xE0, 0x1F, 0x54, 0x82, 0xB0, 0xCB, 0x05, 0xDC, 0x56, 0x31, 0xCE, 0x0D,
+    0x64, 0x43, 0xD9, 0x60, 0x36, 0x9C, 0xFD, 0x8B, 0x22, 0x6D, 0x50, 0x1B, 0xD6, 0x06, 0xB6, 0xA1,
+    0x6D, 0x70, 0x1B, 0xDE, 0x06, 0xB8, 0x21, 0x6E, 0x90, 0x1B, 0xE6, 0x06, 0xBA, 0x47, 0xDD, 0xBB,
+    0x39, 0x6D, 0x81, 0x13, 0x49, 0xC5, 0x24, 0xC7, 0xEE, 0x6D, 0xEB, 0x47, 0x9B, 0x1F, 0x97, 0x2D,
+    0xA9, 0xB4, 0x35, 0x3A, 0x07, 0xEA, 0xF7, 0x71, 0xAE, 0x30, 0xFE, 0x53, 0x0D, 0xE9, 0x4A, 0x00,
+    0xDF, 0x92, 0x20, 0x4F, 0x02, 0xBD, 0x79, 0x8D, 0xEE, 0x88, 0x75, 0x41, 0x0A, 0xBF, 0xE2, 0xAF,
+    0x04, 0x28, 0x03, 0x4A, 0x81, 0x3F, 0x56, 0x0D, 0x12, 0xEC, 0x58, 0xB5, 0xD2, 0xE0, 0x79, 0xB8,
+    0x74, 0xCA, 0xA1, 0xA9, 0x81, 0xD3, 0xA8, 0x7E, 0x7A, 0xD2, 0xB8, 0xB1, 0x44, 0x04, 0xB7, 0xFA,
+    0xE4, 0xDD, 0xB6, 0xEC, 0x74, 0x67, 0x2D, 0xCE, 0xAD, 0xD5, 0x3D, 0x38, 0x11, 0xEA, 0x6E, 0xFC,
+    0xDF, 0x09, 0x78, 0x26, 0xEC, 0xE5, 0x40, 0x27, 0xB3, 0x58, 0x5D, 0x18, 0xF0, 0x3A, 0x1B, 0xBB,
+    0x30, 0x34, 0x69, 0x14, 0x8F, 0x44, 0x5F, 0x9F, 0xAF, 0x04, 0x2D, 0xC9, 0xE5, 0x65, 0xC7, 0xCB,
+    0xB8, 0xD9, 0x95, 0x45, 0xF2, 0xDC, 0xA0, 0xDC, 0x6C, 0xD1, 0xD7, 0xA4, 0xE8, 0xF5, 0x49, 0xE3,
+    0x4C, 0xD2, 0x79, 0x49, 0x1A, 0xC3, 0x6A, 0xA7, 0xDC, 0x78, 0x37, 0xB5, 0x1F, 0x60, 0x93, 0x53,
+    0xFE, 0xA6, 0x23, 0x76, 0x8F, 0xF8, 0xFD, 0x6E, 0x24, 0x4D, 0x2C, 0x4E, 0xE4, 0x07, 0x5F, 0x17,
+    0x9B, 0xED, 0xFF, 0x57, 0x93, 0xC6, 0xB4, 0x5A, 0x8D, 0x75, 0x17, 0xFA, 0xEF, 0xD7, 0x02, 0x63,
+    0xDB, 0x85, 0x3B, 0x5E, 0x91, 0xAF, 0xF7, 0x8D, 0x64, 0x69, 0x2A, 0x48, 0xEC, 0xD2, 0x6A, 0xB6,
+    0x3F, 0x69, 0xB2, 0x72, 0x82, 0x39, 0x29, 0x8F, 0xAC, 0xB1, 0xB4, 0xE8, 0x52, 0x81, 0x86, 0x95,
+    0xE2, 0x34, 0x3F, 0x29, 0x93, 0x52, 0xBB, 0x68, 0x71, 0xC5, 0x13, 0x8D, 0xEE, 0xE1, 0xB0, 0xFE,
+    0x47, 0xD8, 0xB8, 0xFC, 0x64, 0x6A, 0xAD, 0x3B, 0x3D, 0x47, 0xB9, 0x78, 0xCA, 0x66, 0x75, 0xD3,
+    0x89, 0xDA, 0x6B, 0xD1, 0x6F, 0x56, 0xFB, 0xA4, 0xDB, 0x7A, 0x66, 0x4D, 0x5F, 0x7A, 0xEA, 0x1F,
+    0x92, 0xAD, 0xEE, 0x2E, 0x92, 0x1D, 0xB2, 0xC0, 0xA6, 0xAA, 0xEC, 0xA8, 0x76, 0x40, 0x2E, 0x20,
+    0x01, 0x9B, 0xA4, 0x3D, 0x34, 0x9E, 0xCA, 0x66, 0x6A, 0x8D, 0x11, 0x46, 0x35, 0x36, 0x51, 0x47,
+    0x4D, 0x26, 0xB7, 0x2F, 0x04, 0x02, 0x28, 0x18, 0xFE, 0x0B, 0xA3, 0x04, 0xFF, 0x16, 0xDE, 0x3F,
+    0x15, 0x9F, 0xAC, 0xBB, 0xA7, 0x6A, 0x02, 0xCB, 0xB3, 0x87, 0x41, 0x54, 0x35, 0x55, 0x53, 0xC2,
+    0xED, 0x37, 0x4E, 0x24, 0x0E, 0x2D, 0xFA, 0xF2, 0x79, 0x38, 0x0C, 0xBB, 0xF3, 0xD1, 0x5D, 0x5F,
+    0x37, 0xEB, 0x92, 0xC2, 0x01, 0x11, 0x3B, 0x14, 0xC4, 0x16, 0x82, 0xD8, 0x5C, 0x10, 0xBB, 0x7B,
+    0x1A, 0x31, 0x0D, 0x9B, 0x9A, 0xA4, 0x4B, 0x52, 0x25, 0x25, 0xFC, 0x81, 0x4F, 0xB7, 0x64, 0xA7,
+    0x7A, 0x54, 0x0D, 0x6E, 0xA2, 0xB6, 0x65, 0xA9, 0xB3, 0xFD, 0x4D, 0xDD, 0xB7, 0x83, 0x34, 0xD3,
+    0x9A, 0x94, 0x5D, 0xD7, 0x44, 0xB7, 0x6A, 0x56, 0x16, 0xE6, 0x1A, 0x9B, 0x2B, 0xC7, 0xC5, 0x17,
+    0xF8, 0x7D, 0xC3, 0x2B, 0xEC, 0x64, 0xF9, 0x21, 0x4E, 0x73, 0xCD, 0x28, 0x98, 0x6E, 0x97, 0x6B,
+    0xE1, 0x15, 0x82, 0x7C, 0x4B, 0x32, 0x8C, 0x0B, 0xF2, 0x97, 0x92, 0xC8, 0xF9, 0xEE, 0xA6, 0xF8,
+    0xE5, 0x7A, 0xFB, 0xE6, 0xC6, 0xF8, 0x83, 0xFF, 0x01, 0xC5, 0x58, 0xBD, 0x93, 0xDC, 0x48, 0x15,
+    0x7F, 0x92, 0xBC, 0x96, 0xCF, 0x2A, 0xAC, 0x0D, 0x76, 0x29, 0xCE, 0xAE, 0xB3, 0x2E, 0xBD, 0xC3,
+    0xB7, 0x22, 0x20, 0x70, 0xB0, 0x33, 0x6A, 0x9F, 0xFF, 0x81, 0x09, 0x3C, 0xB8, 0x0A, 0x07, 0x97,
+    0x10, 0x18, 0x12, 0x13, 0x38, 0x70, 0x51, 0xB3, 0xA3, 0x36, 0x04, 0x04, 0x24, 0x1B, 0x70, 0x45,
+    0x15, 0x91, 0x03, 0x07, 0xE0, 0x0B, 0xD6, 0x81, 0x83, 0xA5, 0x58, 0x5B, 0x6D, 0x5F, 0x70, 0xA9,
+    0xAA, 0xA8, 0x83, 0x2A, 0x48, 0x44, 0x19, 0x27, 0x5C, 0x80, 0xC0, 0x02, 0xC4, 0xA1, 0x9D, 0xBE,
+    0xDF, 0xEB, 0x6E, 0xED, 0xCC, 0xEC, 0xF9, 0x6B, 0xCF, 0x45, 0x21, 0x4D, 0xB7, 0x46, 0xD2, 0xEB,
+    0xD7, 0xAF, 0xDF, 0xC7, 0xEF, 0xBD, 0x16, 0x29, 0xA2, 0x9A, 0x68, 0x93, 0x0A, 0x4D, 0x77, 0x37,
+    0xE9, 0xD6, 0x5D, 0xBA, 0xA5, 0xE8, 0x16, 0x7D, 0xF5, 0xDF, 0x88, 0x88, 0x14, 0x05, 0x92, 0x62,
+    0xA2, 0x4C, 0xCB, 0x53, 0x81, 0x0C, 0x7E, 0x2C, 0xE9, 0x91, 0x24, 0xFF, 0x35, 0x7E, 0x9E, 0x58,
+    0x19, 0x8B, 0x54, 0xAB, 0x4C, 0xAB, 0xF5, 0xF1, 0xD2, 0x7F, 0xE2, 0x23, 0xD5, 0x5A, 0x8B, 0x0C,
+    0x1D, 0xAD, 0x8F, 0xC7, 0x63, 0x5A, 0x19, 0x9B, 0xE3, 0x12, 0x3F, 0xC6, 0xD1, 0x66, 0xEE, 0xBA,
+    0x6E, 0x9F, 0x8F, 0x46, 0x24, 0x1A, 0xBF, 0xFA, 0x5F, 0xFF, 0xC8, 0x1E, 0xB1, 0xD6, 0x5D, 0x82,
+    0xE6, 0x6E, 0xE9, 0xDD, 0x3B, 0x77, 0x6E, 0x41, 0xA0, 0x1A, 0xC2, 0x8C, 0xE8, 0x9E, 0x57, 0x07,
+    0x55, 0xA4, 0x62, 0x95, 0x89, 0x9C, 0x66, 0x74, 0x89, 0xBC, 0x2E, 0x68, 0x83, 0x3A, 0x2A, 0x63,
+    0x95, 0x88, 0x21, 0x4D, 0x68, 0x95, 0x86, 0x94, 0xB9, 0x33, 0xA5, 0x04, 0x4A, 0x5D, 0x01, 0x4D,
+    0xA2, 0x82, 0x36, 0x95, 0x41, 0x9D, 0x51, 0x54, 0x3E, 0xA0, 0x58, 0x75, 0x94, 0x5C, 0x68, 0x68,
+    0x18, 0xD4, 0x34, 0x09, 0x14, 0xAD, 0x7A, 0x44, 0xD3, 0xB0, 0x9C, 0x46, 0x65, 0x16, 0x56, 0xFC,
+    0x0B, 0xAA, 0x34, 0xA8, 0x12, 0xBF, 0x8A, 0xBD, 0x7A, 0x05, 0xF6, 0xF1, 0x60, 0xA2, 0x08, 0xE2,
+    0x45, 0x25, 0xA4, 0x83, 0xF9, 0x63, 0x89, 0x06, 0x45, 0xB2, 0xC1, 0x76, 0x76, 0xA0, 0x57, 0x2D,
+    0x7F, 0x34, 0xFD, 0x48, 0xC0, 0x27, 0xC8, 0xB4, 0x1B, 0x68, 0xBB, 0x68, 0x0D, 0x19, 0x57, 0xF1,
+    0xD0, 0x7C, 0xB4, 0xA0, 0xB2, 0x2D, 0x2C, 0xE7, 0xAC, 0x12, 0xB4, 0x14, 0x2D, 0x93, 0xBC, 0xD4,
+    0x75, 0xB4, 0x1C, 0xED, 0x3E, 0xDA, 0xDE, 0x01, 0x13, 0xFF, 0xE7, 0xFF, 0xBC, 0x1A, 0x40, 0x21,
+    0x21, 0x2C, 0x42, 0x3E, 0x06, 0x06, 0xE5, 0x32, 0x13, 0xD3, 0xAC, 0x3C, 0xEB, 0x67, 0x57, 0x44,
+    0x01, 0x79, 0xD0, 0x84, 0xD8, 0xF4, 0xAC, 0x3C, 0xCC, 0x0A, 0xEA, 0xF4, 0xD0, 0xFC, 0x16, 0x57,
+    0x91, 0x36, 0x79, 0x57, 0xEC, 0xEB, 0x59, 0x31, 0x2B, 0xF6, 0xB3, 0x8E, 0x97, 0x46, 0x81, 0xA0,
+    0xB0, 0xA2, 0xA8, 0x83, 0xFA, 0x45, 0xAC, 0xAB, 0x58, 0x37, 0x89, 0x16, 0x69, 0x45, 0x03, 0x67,
+    0x85, 0x44, 0x64, 0x2A, 0x87, 0xD6, 0x8F, 0xB9, 0xBB, 0x58, 0x66, 0x2A, 0xE5, 0x27, 0x78, 0x96,
+    0xC9, 0x63, 0xD0, 0x32, 0x16, 0x42, 0xB9, 0x28, 0x44, 0x41, 0x6B, 0x4C, 0xC2, 0xE1, 0x41, 0xAF,
+    0x15, 0x18, 0xF3, 0xF0, 0x30, 0x81, 0xC1, 0x21, 0xE2, 0xBF, 0xF6, 0xCF, 0x13, 0x7A, 0xE9, 0xF0,
+    0xE5, 0xAB, 0x9D, 0x3C, 0xEE, 0xC9, 0xB8, 0x24, 0x3E, 0x2B, 0x3A, 0xDA, 0xB8, 0xF1, 0x15, 0x0A,
+    0xCD, 0x19, 0x1D, 0x65, 0x1C, 0x1D, 0x1C, 0x79, 0x49, 0x26, 0x3A, 0x7C, 0x5D, 0x53, 0x04, 0x5B,
+    0xC3, 0x52, 0x2D, 0x4C, 0xC0, 0xB1, 0x22, 0xF7, 0xE0, 0xEF, 0x6C, 0x10, 0x18, 0x99, 0xCD, 0x4C,
+    0x1B, 0xB4, 0xC7, 0xFE, 0x46, 0x30, 0xDC, 0x2E, 0xFB, 0x09, 0xFF, 0x69, 0x63, 0xE3, 0x5D, 0x13,
+    0x6A, 0x52, 0xC3, 0x6F, 0xE2, 0xD5, 0x93, 0xD3, 0x82, 0xBE, 0x0F, 0xE7, 0xAF, 0x1A, 0x5D, 0x07,
+    0x5A, 0x0D, 0xC2, 0x8F, 0x1F, 0x7F, 0xDE, 0xC6, 0x9F, 0x55, 0xD9, 0xB5, 0x9F, 0x7D, 0x52, 0xEE,
+    0xA5, 0x7E, 0x9D, 0xCC, 0x92, 0x58, 0x4E, 0x86, 0x5E, 0x7D, 0xFC, 0x2F, 0x83, 0x84, 0x26, 0x13,
+    0x66, 0xDA, 0xA6, 0x34, 0x61, 0xEE, 0x7E, 0x3D, 0xA4, 0xBD, 0x16, 0x2E, 0x1D, 0x2A, 0xCC, 0xD2,
+    0xC0, 0xA7, 0x63, 0x31, 0xA0, 0xA6, 0xC1, 0x7C, 0x43, 0x1A, 0x78, 0x75, 0x1D, 0x2A, 0x08, 0x33,
+    0x00, 0xF3, 0x58, 0x82, 0x3C, 0x8B, 0x14, 0x46, 0xE2, 0x25, 0x3C, 0xAA, 0xD8, 0xE7, 0xE8, 0x89,
+    0xF6, 0x29, 0x6D, 0x8C, 0x28, 0x08, 0x2E, 0x5A, 0x3E, 0xFA, 0xC5, 0x2E, 0xAE, 0x77, 0x71, 0xC9,
+    0x8B, 0xAB, 0x5E, 0x5C, 0xF8, 0xE2, 0xDA, 0x17, 0x97, 0xBF, 0xA8, 0x81, 0x45, 0x25, 0x2C, 0xEA,
+    0xC1, 0xBB, 0x3D, 0x57, 0x45, 0xAC, 0x69, 0xAE, 0x8D, 0x1D, 0x71, 0xA0, 0x90, 0x3D, 0x20, 0x8C,
+    0xD1, 0x09, 0x16, 0xD8, 0x44, 0xAA, 0x57, 0xCB, 0x3F, 0x78, 0xB1, 0x4E, 0x33, 0x4F, 0x81, 0x4C,
+    0xBD, 0x72, 0x9E, 0x96, 0x91, 0xEC, 0xF5, 0xF3, 0xB8, 0x44, 0x74, 0x3A, 0x15, 0xFD, 0x41, 0x21,
+    0x4A, 0x9D, 0x96, 0x3E, 0x51, 0x29, 0xF5, 0x8A, 0xFA, 0x29, 0x48, 0x7B, 0x5D, 0x05, 0xD5, 0xDE,
+    0x81, 0xBA, 0x7C, 0xDD, 0xCC, 0x35, 0xA6, 0xCB, 0xB9, 0xD2, 0x8E, 0x19, 0x9C, 0xE8, 0x7C, 0x8B,
+    0x87, 0x62, 0x03, 0x91, 0x7E, 0x1D, 0x4F, 0x80, 0x05, 0x5D, 0x2A, 0x7C, 0x20, 0x1D, 0x73, 0x01,
+    0x37, 0x8A, 0x2F, 0xD4, 0xB4, 0x01, 0x94, 0xDB, 0x0C, 0x25, 0x5D, 0x3F, 0xC9, 0xA3, 0xE2, 0x87,
+    0x2D, 0x88, 0x2E, 0xD6, 0xA0, 0x0A, 0x4B, 0x90, 0xC5, 0x0A, 0x74, 0x09, 0x13, 0x0E, 0x99, 0x72,
+    0xC2, 0xA4, 0x35, 0xD3, 0x56, 0xB4, 0x05, 0x59, 0x87, 0x16, 0x48, 0x45, 0x24, 0x42, 0x19, 0xC8,
+    0x2D, 0xE0, 0x6C, 0x2C, 0x87, 0xB1, 0x4A, 0x43, 0x95, 0x04, 0x2A, 0xBE, 0x58, 0x46, 0xEF, 0x57,
+    0xE1, 0xCD, 0x3A, 0x90, 0xF5, 0x56, 0x72, 0xB1, 0x1A, 0xC6, 0x3F, 0xA9, 0x87, 0xF1, 0xA3, 0x3A,
+    0x0D, 0x1F, 0xD6, 0x78, 0xDD, 0xE0, 0xFD, 0x2E, 0x08, 0x6E, 0x80, 0x62, 0x13, 0x24, 0xE7, 0xC8,
+    0x93, 0x16, 0xC0, 0x62, 0x18, 0x79, 0x03, 0xD6, 0x9A, 0x00, 0x25, 0xEA, 0xEB, 0xC0, 0xB5, 0x4D,
+    0x0A, 0xE5, 0x26, 0x30, 0xEC, 0x3D, 0xD8, 0xEB, 0x14, 0xA0, 0x2F, 0x36, 0x6B, 0x4C, 0x00, 0xCD,
+    0xE4, 0xB5, 0x14, 0xD6, 0x8C, 0x95, 0x39, 0xDF, 0x01, 0xD9, 0xD9, 0x15, 0xB0, 0x52, 0x80, 0x20,
+    0x20, 0x9C, 0x8C, 0xBB, 0x20, 0x60, 0x60, 0x09, 0xF8, 0x22, 0x43, 0x6D, 0x6B, 0x40, 0x6F, 0x68,
+    0x48, 0x67, 0x14, 0x34, 0x0C, 0x95, 0xA9, 0xC0, 0x6A, 0xE8, 0xDB, 0x8B, 0xBE, 0x76, 0x8C, 0xFC,
+    0x06, 0xBA, 0x84, 0x73, 0x42, 0x4D, 0x82, 0x93, 0x04, 0x06, 0x84, 0xB5, 0x57, 0x01, 0x2E, 0x19,
+    0x2D, 0x99, 0x79, 0x7E, 0x00, 0xD4, 0x19, 0xBB, 0x61, 0xCD, 0x48, 0xCA, 0x59, 0xC7, 0x38, 0x5A,
+    0xCE, 0xAF, 0xDE, 0x84, 0xA5, 0xE8, 0xA4, 0xC0, 0x48, 0xA4, 0x15, 0x95, 0x8B, 0x80, 0x2F, 0x19,
+    0x80, 0xD4, 0x0C, 0xCC, 0x12, 0xE3, 0xC1, 0x5D, 0xC8, 0x03, 0x82, 0x9A, 0xD9, 0xF2, 0xF3, 0x29,
+    0xD9, 0x75, 0x48, 0x03, 0xCD, 0x80, 0x5E, 0x30, 0x1C, 0x61, 0x9D, 0xB1, 0x82, 0xB4, 0x53, 0x2B,
+    0x52, 0x22, 0x4E, 0xB0, 0xEC, 0xC7, 0xAD, 0xCD, 0xD9, 0xD9, 0x55, 0x2A, 0x91, 0x2E, 0x90, 0x2C,
+    0x32, 0x99, 0x09, 0x02, 0xF2, 0x32, 0x93, 0x9C, 0x85, 0x7C, 0x40, 0xF8, 0xED, 0x1B, 0x97, 0x60,
+    0x8E, 0xDC, 0x81, 0x1B, 0xB5, 0x1E, 0x16, 0xD8, 0xF8, 0x1C, 0xB3, 0x98, 0x20, 0x80, 0xB3, 0x40,
+    0x45, 0x50, 0x7F, 0x50, 0x42, 0x59, 0x21, 0xEC, 0x0E, 0xBD, 0x2D, 0x45, 0x60, 0x22, 0xE0, 0x93,
+    0x80, 0x7A, 0x49, 0xB9, 0x2A, 0x30, 0x0F, 0xD2, 0x2C, 0xD4, 0xB4, 0x66, 0x5F, 0x7A, 0x70, 0x46,
+    0xD4, 0x08, 0x58, 0x6F, 0x21, 0x4F, 0x4C, 0xB1, 0x30, 0xE3, 0x6E, 0xAE, 0xB5, 0x89, 0xF4, 0x9A,
+    0x4C, 0x78, 0xF5, 0x8C, 0xFC, 0x7F, 0xB7, 0x14, 0xC0, 0x59, 0x03, 0x2D, 0x28, 0xE8, 0x8C, 0xD6,
+    0xD8, 0x38, 0x26, 0x98, 0xBD, 0xA5, 0xC9, 0x6C, 0xE6, 0xCB, 0xA5, 0xCD, 0x7B, 0x6B, 0x2E, 0xDD,
+    0xE7, 0x48, 0xF7, 0x3F, 0xB8, 0x73, 0x67, 0xFB, 0x5B, 0x20, 0x97, 0xF0, 0xEA, 0x00, 0x8E, 0x01,
+    0x7F, 0xD8, 0xE0, 0xF0, 0x8D, 0x25, 0x6C, 0x86, 0x74, 0x88, 0x21, 0xD7, 0x5A, 0x66, 0x32, 0x46,
+    0x8B, 0x34, 0x7C, 0xA0, 0x18, 0xEF, 0xB3, 0xF1, 0x13, 0x8A, 0x38, 0x57, 0xBC, 0x05, 0xFC, 0x50,
+    0xE7, 0xF1, 0xAE, 0x5C, 0x45, 0xC7, 0xC8, 0xC1, 0x29, 0xEA, 0x3D, 0x97, 0x9E, 0x39, 0x2D, 0x73,
+    0x26, 0x65, 0xA1, 0xF0, 0xEE, 0xAC, 0xCB, 0xDC, 0xF7, 0xEC, 0x2B, 0x5F, 0x59, 0x79, 0x63, 0x97,
+    0x9D, 0x07, 0x20, 0xAD, 0x2B, 0xF2, 0x2A, 0xA8, 0x50, 0x01, 0x93, 0xC4, 0x5D, 0x78, 0xE8, 0x3D,
+    0x8C, 0xB8, 0x61, 0xD5, 0xD2, 0xAF, 0x27, 0xE8, 0xD1, 0x27, 0xE8, 0x8B, 0x99, 0x1E, 0x83, 0xB6,
+    0x03, 0x87, 0x63, 0xFB, 0xA1, 0x43, 0x22, 0xFD, 0x99, 0x43, 0xB3, 0x48, 0xEF, 0xB8, 0x5A, 0x27,
+    0xEB, 0x8B, 0x9E, 0xE2, 0xE6, 0x55, 0x0B, 0x80, 0x4F, 0xDD, 0xA8, 0xF8, 0x91, 0x63, 0x98, 0x5D,
+    0x70, 0x53, 0x0C, 0xA9, 0xB5, 0x7F, 0x4E, 0x18, 0x87, 0x84, 0x91, 0x89, 0x6E, 0x33, 0x70, 0xF2,
+    0x1F, 0x13, 0x03, 0xDC, 0xB8, 0x5B, 0xE5, 0xA7, 0xAB, 0x10, 0x64, 0x8B, 0x6B, 0x87, 0xFB, 0x10,
+    0xA4, 0xF8, 0x1D, 0xD8, 0x6A, 0x74, 0x67, 0xF4, 0xA7, 0xBF, 0x46, 0xF7, 0xE1, 0xAF, 0xE8, 0x9A,
+    0x86, 0xEF, 0x5C, 0xC3, 0xFC, 0xE9, 0xEF, 0x51, 0x7C, 0x64, 0x7F, 0xEC, 0xE8, 0x01, 0xCF, 0xF8,
+    0x39, 0x07, 0x18, 0x97, 0x2E, 0x7F, 0xAF, 0x29, 0x2E, 0x5B, 0xD6, 0x08, 0x3C, 0x00, 0xF0, 0x8B,
+    0x68, 0xEA, 0x28, 0xE2, 0x80, 0x3A, 0x65, 0xE0, 0xD7, 0x94, 0x09, 0x5B, 0x4B, 0x40, 0x9E, 0x6A,
+    0x99, 0x69, 0xB1, 0x3E, 0x36, 0x37, 0x67, 0x69, 0x4E, 0xD0, 0xCE, 0x55, 0x65, 0xD1, 0xDD, 0xE2,
+    0xBA, 0x45, 0x74, 0x83, 0xE5, 0x16, 0xC5, 0xAD, 0xEE, 0x2C, 0x72, 0xBB, 0xC4, 0x65, 0xFA, 0x66,
+    0xAE, 0x61, 0x37, 0xDE, 0xA1, 0xFC, 0x01, 0x73, 0xB3, 0x74, 0x63, 0x41, 0x5B, 0x18, 0x2D, 0x31,
+    0xC7, 0x58, 0x0D, 0xDF, 0x47, 0x8B, 0xFE, 0x2A, 0xE7, 0xF5, 0x9C, 0xB4, 0x72, 0xA4, 0x36, 0x2E,
+    0xCD, 0x80, 0x2D, 0x37, 0x84, 0xDB, 0x3E, 0x02, 0x10, 0xDE, 0xEF, 0xE9, 0xDA, 0xD6, 0x72, 0x7D,
+    0xEB, 0xEB, 0x39, 0x35, 0x2F, 0x0D, 0x93, 0x45, 0x56, 0x33, 0x34, 0xA8, 0x76, 0xFD, 0x12, 0x0B,
+    0xC4, 0x73, 0xA2, 0x1D, 0xDF, 0x39, 0x4C, 0x75, 0x68, 0xC2, 0xCE, 0x35, 0x2C, 0xE6, 0x3B, 0x76,
+    0x4E, 0x6E, 0x76, 0xB2, 0x67, 0x4D, 0xE8, 0xD8, 0xF4, 0xAC, 0xA6, 0x76, 0xCE, 0xBC, 0x73, 0xF3,
+    0xCE, 0x83, 0xF7, 0x8C, 0x96, 0x1C, 0xBF, 0x1A, 0xD5, 0xDD, 0x93, 0x42, 0xCE, 0xAE, 0x74, 0x27,
+    0x80, 0x29, 0x23, 0xC6, 0x0D, 0xE6, 0x75, 0xFF, 0xF0, 0xC5, 0xA1, 0x53, 0x66, 0xEB, 0x46, 0x2C,
+    0x25, 0x42, 0xCE, 0x6F, 0x19, 0x1F, 0x08, 0xA5, 0xA1, 0xA7, 0xE1, 0xA9, 0x82, 0x1F, 0x30, 0xA8,
+    0xC5, 0x16, 0x8B, 0x53, 0xAB, 0xF7, 0xA1, 0x95, 0x70, 0x62, 0x83, 0x63, 0xED, 0x50, 0x8E, 0x37,
+    0x12, 0xB7, 0x26, 0xF6, 0x19, 0x1E, 0x72, 0x77, 0x21, 0x06, 0x3D, 0x43, 0x3C, 0x5A, 0x14, 0x3A,
+    0x2E, 0x0D, 0xE6, 0x28, 0x16, 0x39, 0x51, 0x27, 0x2C, 0x0A, 0x12, 0x6F, 0x01, 0x4C, 0x4F, 0x7D,
+    0x9F, 0x48, 0x0B, 0xAA, 0x5C, 0x3D, 0xCF, 0x58, 0x8F, 0x90, 0x0C, 0x6C, 0x21, 0x69, 0xCB, 0x82,
+    0x32, 0x12, 0x76, 0xEC, 0x5A, 0x81, 0x31, 0xA1, 0x4D, 0x16, 0x10, 0x12, 0x6E, 0xE6, 0x99, 0xF4,
+    0x71, 0x48, 0xC0, 0x98, 0x51, 0x96, 0x97, 0x9A, 0xDB, 0xDE, 0x88, 0xBB, 0x66, 0x61, 0xC4, 0x11,
+    0xA9, 0x08, 0x20, 0x97, 0x2A, 0xAE, 0xCB, 0x33, 0x59, 0xFC, 0x62, 0x1F, 0x70, 0xF9, 0x36, 0x60,
+    0x38, 0x33, 0x65, 0x7C, 0x6E, 0x84, 0x79, 0x60, 0xEC, 0x71, 0x9F, 0x1C, 0x32, 0x7B, 0x06, 0x9A,
+    0x81, 0x87, 0x10, 0x29, 0x2D, 0x39, 0x56, 0x0B, 0x24, 0x6B, 0x5E, 0x3E, 0xA4, 0x8A, 0x18, 0x9C,
+    0x79, 0x5E, 0x88, 0x64, 0xF5, 0x38, 0x34, 0x82, 0xAD, 0x7D, 0x49, 0x79, 0x7B, 0x6C, 0x03, 0x8F,
+    0x6D, 0xAC, 0x7C, 0xF4, 0x99, 0xF0, 0x3B, 0x93, 0x2D, 0x47, 0x5C, 0x77, 0x1B, 0x03, 0xA3, 0xC3,
+    0xCE, 0x2D, 0xEF, 0xBD, 0x9E, 0x73, 0x81, 0x8D, 0x39, 0xDE, 0x34, 0x18, 0xFB, 0xDA, 0x98, 0x9A,
+    0x92, 0xF3, 0x35, 0xBF, 0xB1, 0xE9, 0xCD, 0xBD, 0x64, 0xD3, 0x9B, 0x85, 0x18, 0xD9, 0x4D, 0xD6,
+    0x5A, 0x1F, 0x5F, 0x32, 0xEC, 0x2B, 0xEE, 0x3A, 0xFA, 0xCD, 0x07, 0x7A, 0x46, 0xF7, 0xB0, 0x5B,
+    0x33, 0x9D, 0xE4, 0x4E, 0xBD, 0xB0, 0x33, 0x24, 0xA2, 0x1F, 0xD1, 0x71, 0x57, 0xA1, 0x63, 0xD8,
+    0x7D, 0x8D, 0xCE, 0x1E, 0xDF, 0xD4, 0xBA, 0xF4, 0xB1, 0xE8, 0x12, 0x25, 0xF6, 0xE5, 0x12, 0xDB,
+    0x47, 0x9F, 0x9D, 0xC6, 0x2F, 0xB3, 0x97, 0x77, 0x86, 0x2E, 0xE6, 0x0E, 0x63, 0x3F, 0xB2, 0x5C,
+    0xE8, 0x34, 0xB2, 0x0F, 0xDE, 0x6E, 0x03, 0x93, 0x21, 0xE9, 0xE0, 0x03, 0xC8, 0xBC, 0x89, 0xD7,
+    0x92, 0x3B, 0x75, 0xD0, 0x95, 0x07, 0x5D, 0xB5, 0x7C, 0x3B, 0x27, 0x91, 0xC3, 0x1D, 0x8C, 0x35,
+    0x5C, 0x90, 0xD9, 0xFA, 0x2A, 0xD4, 0x22, 0x51, 0xE7, 0x00, 0xEB, 0x1B, 0x0C, 0x69, 0x19, 0x4A,
+    0x2E, 0xCA, 0xFE, 0xC3, 0x08, 0x5E, 0xFC, 0x57, 0x73, 0x5A, 0x40, 0x97, 0xD4, 0xDF, 0x05, 0x2A,
+    0xDC, 0xE3, 0xF8, 0x9B, 0x70, 0xF4, 0x0D, 0x38, 0xAC, 0x38, 0x1C, 0x45, 0xCA, 0xFE, 0xFA, 0x16,
+    0x67, 0xB6, 0xA0, 0x89, 0x70, 0x86, 0x15, 0x3D, 0xE3, 0xE8, 0xDC, 0xC9, 0x35, 0x32, 0xCA, 0x3A,
+    0xEB, 0x49, 0x63, 0xEA, 0x33, 0xA6, 0x49, 0x99, 0x36, 0x67, 0xDA, 0xA4, 0x49, 0x26, 0x6B, 0x92,
+    0x49, 0x9B, 0xD4, 0xE7, 0xCD, 0xFF, 0xCB, 0x61, 0x52, 0x3F, 0x99, 0xDC, 0x4F, 0x26, 0xF9, 0xDB,
+    0xEC, 0x6F, 0xD3, 0xBF, 0xCB, 0xFF, 0xAE, 0x00, 0xB0, 0xF9, 0xD7, 0x38, 0xB7, 0xC9, 0x0A, 0x8C,
+    0x3F, 0xDB, 0xDC, 0x71, 0xAE, 0xF5, 0xF4, 0x9F, 0xF0, 0xE8, 0x8C, 0xDE, 0x61, 0xB8, 0xD1, 0x0C,
+    0x04, 0x37, 0xBF, 0x47, 0x01, 0xE7, 0xD5, 0xF8, 0x63, 0x44, 0x42, 0xF6, 0x3E, 0x86, 0x0D, 0x39,
+    0x0E, 0x5D, 0x1E, 0xBD, 0xBD, 0x28, 0x84, 0xDF, 0xE7, 0x52, 0xD3, 0xBD, 0xCD, 0x09, 0xE9, 0x01,
+    0x27, 0xF2, 0xE2, 0x31, 0xBA, 0xE3, 0xFA, 0x6F, 0x50, 0x5E, 0xC2, 0x89, 0x33, 0x7F, 0x78, 0x95,
+    0xBC, 0x7F, 0x31, 0x32, 0xFF, 0xB9, 0x66, 0x58, 0x68, 0xED, 0xBE, 0x04, 0x50, 0x61, 0x32, 0xDE,
+    0x79, 0xCB, 0x6D, 0x8A, 0x87, 0x05, 0x42, 0xBA, 0xC0, 0xD3, 0x81, 0xF1, 0x80, 0xC6, 0xA6, 0xBA,
+    0xA5, 0x24, 0x22, 0x6D, 0x3E, 0x1B, 0xBA, 0x8C, 0xB6, 0x67, 0x5D, 0xC4, 0xEB, 0xF3, 0xCD, 0x12,
+    0xD9, 0x3B, 0x88, 0xD0, 0x02, 0x64, 0x05, 0xC8, 0x72, 0x53, 0xCF, 0xD2, 0xBA, 0x30, 0x0A, 0xF1,
+    0xD9, 0x77, 0x51, 0xA8, 0xC0, 0xAF, 0x67, 0x02, 0x94, 0x43, 0x88, 0x3B, 0xFB, 0x70, 0x9F, 0x0B,
+    0x96, 0x10, 0xE8, 0x4F, 0x3F, 0x04, 0xD5, 0xD7, 0x67, 0x4C, 0xCB, 0x56, 0x4E, 0x78, 0x63, 0xA1,
+    0x7F, 0xD9, 0xB2, 0x24, 0x43, 0xCE, 0x98, 0x31, 0xEB, 0x3C, 0xE0, 0xD2, 0xCB, 0x57, 0xAB, 0x56,
+    0xC1, 0xD7, 0xC9, 0x7E, 0x90, 0xF0, 0xE4, 0xEE, 0xD7, 0x40, 0xB7, 0x0B, 0x2F, 0x6C, 0x77, 0xA1,
+    0xB2, 0xE1, 0x6F, 0x6B, 0xFE, 0x66, 0xA3, 0x68, 0xFD, 0x8A, 0xFE, 0x70, 0xC4, 0x5F, 0x8E, 0xEA,
+    0x77, 0x77, 0xF4, 0x9D, 0x5B, 0xE6, 0x19, 0x65, 0xFC, 0xB6, 0xDB, 0x65, 0x78, 0xC3, 0x08, 0x5F,
+    0xED, 0x9E, 0x72, 0x9F, 0x35, 0x6C, 0x47, 0x8B, 0x95, 0x53, 0xC8, 0x86, 0x65, 0x95, 0x6C, 0x3F,
+    0xCF, 0x29, 0xB8, 0x8A, 0xE0, 0x7A, 0xD1, 0xB4, 0x17, 0xFB, 0xCF, 0xC8, 0xF2, 0x5A, 0xE0, 0x89,
+    0x6D, 0x0F, 0x6F, 0xFD, 0x78, 0xE3, 0x33, 0x25, 0xB3, 0xF5, 0xE9, 0x78, 0x8F, 0x14, 0xDF, 0x6C,
+    0x78, 0x9B, 0x94, 0x30, 0xF2, 0x5E, 0xA8, 0x07, 0xF0, 0x1B, 0xDE, 0x02, 0x41, 0x07, 0xBC, 0x09,
+    0x82, 0x25, 0xAE, 0x9F, 0xF4, 0xCA, 0x73, 0x87, 0x24, 0x25, 0xCB, 0x78, 0x7E, 0x79, 0xBE, 0xC8,
+    0xCF, 0x5D, 0x07, 0x3A, 0x4E, 0x60, 0x5C, 0xC9, 0x4B, 0x7B, 0x31, 0xF5, 0xDD, 0xD1, 0x02, 0x4E,
+    0x3C, 0x43, 0x24, 0x77, 0xB7, 0x28, 0x92, 0xE1, 0x9A, 0xBA, 0x89, 0x94, 0x9B, 0xF6, 0x34, 0xBF,
+    0x39, 0x79, 0xA4, 0xE9, 0x9E, 0xB9, 0x76, 0xBF, 0x3A, 0x12, 0x8F, 0x15, 0xDB, 0x59, 0x21, 0x84,
+    0x11, 0x29, 0x97, 0xEE, 0xEE, 0x0D, 0x7E, 0xF7, 0x86, 0x49, 0x3C, 0xAC, 0x96, 0xF4, 0xA5, 0xCC,
+    0x4E, 0x1B, 0x16, 0xF6, 0xAB, 0x94, 0x81, 0xD4, 0xD9, 0x41, 0x77, 0xFF, 0x65, 0x63, 0x79, 0xCC,
+    0x2A, 0x26, 0xF6, 0x5A, 0x53, 0x86, 0xE0, 0x9F, 0xDF, 0x9D, 0x75, 0x7B, 0x80, 0x17, 0x1E, 0x57,
+    0x97, 0x27, 0xDA, 0x27, 0x17, 0x45, 0xE6, 0x3B, 0xE1, 0xBC, 0xF8, 0xB7, 0x97, 0xED, 0xA0, 0xF2,
+    0xB1, 0x09, 0x6A, 0x83, 0x8A, 0x0B, 0x24, 0xBE, 0x20, 0xC9, 0x37, 0xE6, 0x8E, 0x46, 0x41, 0x65,
+    0xCA, 0x8E, 0xA5, 0x01, 0x4B, 0x97, 0xC2, 0x7C, 0xA3, 0x12, 0xEE, 0x32, 0x1E, 0x5F, 0x7E, 0x32,
+    0x1E, 0x3F, 0x67, 0x80, 0x00, 0x33, 0xB2, 0xAC, 0x95, 0x99, 0x28, 0xB1, 0xF3, 0x61, 0x97, 0xE6,
+    0x55, 0x41, 0x15, 0xC9, 0x2F, 0x8D, 0xF3, 0xAD, 0x87, 0x00, 0x42, 0x44, 0x21, 0x16, 0xC3, 0xE9,
+    0x4D, 0xFE, 0x8E, 0x27, 0x73, 0xB1, 0xB1, 0xF0, 0xCC, 0x50, 0xC9, 0xDC, 0x68, 0x6D, 0x4A, 0xA8,
+    0x30, 0xC8, 0x7E, 0xE7, 0x5B, 0xC3, 0x95, 0xEF, 0x4C, 0x1D, 0x01, 0x40, 0xD2, 0xE6, 0x7C, 0xC7,
+    0x01, 0x5E, 0x4F, 0x87, 0xA4, 0xFC, 0xA9, 0xFD, 0xAE, 0x15, 0xA8, 0x23, 0x7E, 0x73, 0xBB, 0x52,
+    0x86, 0x7C, 0x56, 0x47, 0xFA, 0x76, 0x56, 0xCC, 0xB2, 0x2E, 0x6D, 0xE3, 0x3A, 0xAA, 0x02, 0xF5,
+    0xAA, 0xA3, 0xEC, 0x37, 0x37, 0x4F, 0x04, 0x2A, 0x2C, 0xE3, 0x3A, 0x69, 0xB2, 0xAE, 0x98, 0xBD,
+    0xFA, 0x48, 0x5F, 0x46, 0xD5, 0xB9, 0xF3, 0x77, 0x4F, 0x6D, 0x6E, 0xC6, 0xF5, 0xAB, 0xCF, 0x89,
+    0x15, 0xCA, 0xCB, 0xF2, 0xAB, 0x68, 0xE6, 0x0B, 0x65, 0x95, 0xBF, 0x6F, 0x24, 0x35, 0x14, 0xC7,
+    0xBF, 0xB6, 0x2F, 0x19, 0x84, 0xA5, 0xF3, 0x15, 0x77, 0x05, 0xC5, 0xED, 0xF4, 0x51, 0x76, 0xA7,
+    0x4D, 0x31, 0xB3, 0x63, 0x8E, 0x7F, 0x20, 0x05, 0x7F, 0x00, 0x05, 0x0D, 0x69, 0xAE, 0x49, 0xB1,
+    0x12, 0x23, 0x76, 0x44, 0x41, 0xBD, 0x3D, 0x4D, 0x0A, 0x8A, 0x23, 0x42, 0xCA, 0x15, 0x8B, 0x34,
+    0xA0, 0xA0, 0x35, 0xE2, 0x1F, 0xB0, 0xF8, 0x07, 0x70, 0x81, 0x28, 0x2E, 0x05, 0x3E, 0x34, 0x3A,
+    0xF6, 0x72, 0xBB, 0x31, 0xCF, 0x9E, 0xCD, 0x82, 0x84, 0xE7, 0x8D, 0xB4, 0xE3, 0x9F, 0xEF, 0x7D,
+    0xDF, 0xE7, 0x79, 0xF1, 0x01, 0x58, 0xB0, 0xD9, 0x8D, 0x57, 0x6D, 0x5F, 0xA0, 0xAF, 0xB0, 0x2E,
+    0xD1, 0x37, 0xE8, 0xAF, 0xE1, 0x3B, 0xE6, 0x3B, 0xEE, 0xAE, 0x85, 0x6D, 0xA4, 0xA9, 0x57, 0xC8,
+    0x37, 0x60, 0xA7, 0xA0, 0xE6, 0xE1, 0x00, 0xA6, 0x85, 0x11, 0x6D, 0xA6, 0x25, 0x14, 0x1E, 0x62,
+    0x84, 0x31, 0x4A, 0x7A, 0x1E, 0x23, 0xB5, 0x0D, 0xF8, 0x1A, 0xB2, 0xC7, 0xA8, 0x47, 0xE3, 0xF1,
+    0xDA, 0x8B, 0x5F, 0x9D, 0xFC, 0xC8, 0x4E, 0x84, 0xA9, 0xC3, 0x66, 0x1E, 0x36, 0x90, 0x2D, 0x94,
+    0xA6, 0x85, 0x43, 0xE3, 0xA1, 0x17, 0x64, 0xE6, 0xBE, 0xFB, 0x07, 0xE4, 0xA1, 0x7D, 0x20, 0x0D,
+    0x84, 0x1D, 0x4C, 0x4B, 0x73, 0xBB, 0xD2, 0xAB, 0x2D, 0x0E, 0x34, 0xA2, 0x0F, 0xF3, 0x35, 0xBB,
+    0xFB, 0x26, 0xB3, 0x71, 0xF2, 0x08, 0xA8, 0x56, 0xBA, 0x0E, 0xF6, 0x0B, 0xE1, 0x1A, 0xE6, 0x1B,
+    0xE6, 0x1A, 0xEE, 0x9A, 0xCC, 0xD4, 0x57, 0xAD, 0xBA, 0xDB, 0xF9, 0x2B, 0xC3, 0x86, 0x0C, 0xE8,
+    0xC1, 0x3D, 0x32, 0x03, 0xD5, 0xA2, 0xA0, 0x65, 0xD1, 0x4D, 0xE6, 0x21, 0x1C, 0xE8, 0xA8, 0x5C,
+    0xA3, 0x1E, 0xBC, 0xA1, 0x33, 0x56, 0x3D, 0x7F, 0x4B, 0x61, 0x57, 0xC2, 0x54, 0x14, 0x3C, 0x7B,
+    0xD3, 0x23, 0xB4, 0x59, 0xB0, 0xF9, 0x33, 0x5F, 0xA1, 0x27, 0x79, 0x2A, 0xE6, 0x8B, 0xAF, 0x9D,
+    0x0C, 0x1A, 0x1F, 0x83, 0x42, 0xE6, 0xC1, 0xC8, 0x1B, 0x9F, 0x6B, 0x3F, 0x89, 0xFA, 0x45, 0x9B,
+    0x0A, 0x9F, 0x07, 0x9F, 0xBD, 0x71, 0xD1, 0x7F, 0xDA, 0xBD, 0xC0, 0xE5, 0x16, 0xC1, 0xE1, 0x09,
+    0xED, 0x7F, 0x11, 0x05, 0x1C, 0x6C, 0x1E, 0xDC, 0xD9, 0xED, 0x62, 0xFF, 0x89, 0xE4, 0x6D, 0xEC,
+    0xBC, 0x5C, 0xCC, 0x83, 0x25, 0x1B, 0x3C, 0xA2, 0x9E, 0xA3, 0xCB, 0x45, 0x0C, 0xB5, 0x49, 0x41,
+    0xB8, 0x5D, 0x10, 0xA4, 0x5F, 0x0E, 0x4C, 0x52, 0x28, 0x64, 0x65, 0xB2, 0xE1, 0x37, 0x75, 0xD2,
+    0xA8, 0x4C, 0xC9, 0x5A, 0xD2, 0xB2, 0x98, 0x9B, 0x2A, 0x3D, 0x25, 0x7D, 0x5D, 0xA3, 0x67, 0x9E,
+    0xBB, 0xCC, 0x28, 0x3D, 0x41, 0x07, 0xC6, 0x16, 0xD9, 0xF3, 0xB5, 0xEC, 0x1B, 0x65, 0x4A, 0xA5,
+    0xCB, 0x1C, 0xCD, 0x18, 0x5D, 0x89, 0x65, 0x09, 0xDF, 0xC0, 0xCF, 0x98, 0x3B, 0x65, 0x1A, 0x03,
+    0x26, 0xEF, 0x22, 0x26, 0x39, 0xBA, 0x29, 0xBA, 0x2A, 0xCE, 0x59, 0x37, 0x11, 0x16, 0xDF, 0x70,
+    0xDF, 0x08, 0x57, 0x45, 0x4C, 0xB4, 0xDA, 0xEE, 0x64, 0xDF, 0xC8, 0xF5, 0xBC, 0xEF, 0x3C, 0x9D,
+    0xE4, 0x85, 0x13, 0x36, 0x33, 0x99, 0x91, 0xAD, 0xD2, 0x4A, 0xE7, 0x3B, 0x99, 0x29, 0xE7, 0xB7,
+    0x1B, 0xA6, 0x07, 0x8F, 0x29, 0xB4, 0x75, 0xCC, 0x4F, 0x52, 0x8B, 0x32, 0x43, 0x69, 0x89, 0x39,
+    0x09, 0x7E, 0x1E, 0xFC, 0x30, 0x9F, 0xD1, 0xFC, 0x57, 0x9B, 0xFB, 0x08, 0x1B, 0x1C, 0xC6, 0xB4,
+    0xE0, 0xCA, 0xC6, 0x24, 0x92, 0x2C, 0xE8, 0x1F, 0x71, 0x3F, 0xBD, 0xB2, 0x75, 0xD0, 0xC3, 0xF9,
+    0xC0, 0x4F, 0x60, 0xB4, 0xD1, 0x06, 0xAA, 0x43, 0xD5, 0x63, 0x49, 0x21, 0xFB, 0xEC, 0x67, 0xAF,
+    0xB8, 0xAB, 0xC3, 0x96, 0x48, 0x8C, 0x32, 0x12, 0x72, 0x64, 0xFF, 0x62, 0xE8, 0x87, 0x3E, 0x12,
+    0xEF, 0x7F, 0x18, 0x9A, 0x84, 0x21, 0x56, 0x9B, 0x7B, 0x0C, 0x8B, 0x0D, 0x61, 0x48, 0x23, 0x94,
+    0x8A, 0x98, 0x87, 0x79, 0xC4, 0xB0, 0xE6, 0xBE, 0x8A, 0x18, 0x92, 0x24, 0x8E, 0xE0, 0x29, 0x12,
+    0x86, 0xD8, 0x61, 0xB8, 0x4D, 0x18, 0xA6, 0x30, 0xF7, 0xCB, 0xA6, 0xA0, 0x74, 0xB0, 0x3E, 0xC6,
+    0xBB, 0x47, 0x33, 0xB6, 0x27, 0xA4, 0xB7, 0xCB, 0xFE, 0xE8, 0x55, 0xDB, 0x29, 0xDD, 0xC9, 0xB6,
+    0x17, 0x37, 0x96, 0x07, 0xA8, 0x3F, 0xDB, 0x69, 0x66, 0x3B, 0xE1, 0x7A, 0xEE, 0x3A, 0x61, 0xE7,
+    0xCF, 0x4D, 0x3E, 0x60, 0xFE, 0x98, 0xE6, 0x47, 0x0C, 0x95, 0xA6, 0x32, 0x5E, 0x4E, 0xB0, 0x9C,
+    0xA2, 0x2F, 0x78, 0xAF, 0x28, 0xA2, 0xB7, 0xE9, 0xB8, 0x2C, 0x42, 0x4E, 0x18, 0xAE, 0x06, 0x0C,
+    0x3F, 0x01, 0x5E, 0xEE, 0xAC, 0x26, 0xBE, 0x6E, 0x2F, 0xF6, 0x9F, 0x78, 0x14, 0xCF, 0x27, 0xE5,
+    0x8F, 0x2E, 0x2F, 0x68, 0x88, 0x6C, 0xF0, 0xA8, 0x1E, 0x30, 0x24, 0xFE, 0x85, 0x93, 0x84, 0x4E,
+    0x41, 0x69, 0x88, 0x2C, 0x75, 0x24, 0xFE, 0xF0, 0x74, 0x89, 0xB4, 0x71, 0xDC, 0x64, 0xB6, 0x47,
+    0x6E, 0xBC, 0xC7, 0x8E, 0x26, 0x12, 0x0A, 0x46, 0xB5, 0x45, 0xCC, 0xF6, 0x67, 0xEF, 0x89, 0xF0,
+    0x9D, 0xD2, 0xEB, 0x71, 0x2A, 0xA9, 0x19, 0xFC, 0x92, 0x8C, 0xBB, 0x65, 0x66, 0x9B, 0xC2, 0x14,
+    0x7F, 0x99, 0x28, 0xF2, 0x19, 0x44, 0x30, 0x8A, 0xDB, 0x31, 0xB7, 0xA5, 0x34, 0xF3, 0x3B, 0xFC,
+    0x78, 0x4A, 0x38, 0x47, 0xAB, 0x0E, 0x29, 0x3B, 0x29, 0xF0, 0x33, 0x50, 0x69, 0x2A, 0x4D, 0xA5,
+    0x49, 0xC0, 0x2E, 0x97, 0xD1, 0x86, 0xAD, 0x6C, 0x25, 0xDB, 0x41, 0x1C, 0xD6, 0xBE, 0x0F, 0xFA,
+    0x44, 0x1C, 0xC0, 0xF7, 0x14, 0x4E, 0x4D, 0x29, 0x8F, 0x3A, 0xCF, 0xE9, 0x7D, 0xA7, 0x21, 0x7E,
+    0x21, 0xE5, 0xB9, 0x25, 0x37, 0x13, 0x6A, 0x60, 0xDF, 0x42, 0x05, 0xF3, 0x80, 0x0A, 0x2D, 0x15,
+    0x26, 0xBB, 0xF2, 0xEA, 0x95, 0xAB, 0xB8, 0x3D, 0xC9, 0x0C, 0x55, 0x47, 0x41, 0xD7, 0x86, 0x06,
+    0xB3, 0xE0, 0x84, 0x46, 0xB2, 0xEC, 0xAB, 0x85, 0x9C, 0xAF, 0x95, 0x2B, 0x55, 0x4B, 0xE3, 0x27,
+    0x4F, 0x31, 0x3B, 0x4E, 0xD5, 0x73, 0x02, 0x7F, 0xCE, 0x1C, 0x79, 0x12, 0xF7, 0xFC, 0xEF, 0xFC,
+    0xF6, 0x53, 0xF9, 0xA1, 0x57, 0x59, 0xAB, 0x46, 0x18, 0x75, 0xC8, 0x3D, 0x8A, 0x0E, 0x65, 0x89,
+    0x93, 0x11, 0xCE, 0x15, 0x96, 0x59, 0x04, 0x92, 0x39, 0x6E, 0xE9, 0x86, 0x35, 0x59, 0x2B, 0xB5,
+    0x4A, 0x77, 0xEC, 0x53, 0x1C, 0x27, 0x51, 0x67, 0x31, 0x7E, 0xF0, 0xC3, 0xF6, 0x08, 0x72, 0xFE,
+    0x9A, 0xF4, 0xB1, 0x9F, 0x3F, 0x23, 0x01, 0x1A, 0x6E, 0x15, 0x66, 0xDC, 0x8C, 0xF0, 0x52, 0x98,
+    0x63, 0x78, 0xD1, 0x96, 0x70, 0x99, 0x2E, 0x99, 0x93, 0xD4, 0x4D, 0x63, 0x4B, 0x92, 0x7E, 0xC8,
+    0x24, 0xFB, 0xF2, 0x77, 0xF1, 0xDB, 0x56, 0xF4, 0x93, 0xCC, 0x8E, 0x64, 0x3B, 0x56, 0xA8, 0x14,
+    0xCA, 0xD1, 0xAE, 0xEC, 0x29, 0x1B, 0x49, 0x85, 0xD3, 0x17, 0xC0, 0xDF, 0x01, 0xD8, 0xCA, 0x96,
+    0xD1, 0x66, 0xDC, 0x89, 0x36, 0x7A, 0x23, 0x8C, 0xD4, 0x74, 0x71, 0x10, 0x4E, 0x13, 0x48, 0x77,
+    0x0D, 0x55, 0x7B, 0x3C, 0x3C, 0x00, 0x79, 0x07, 0xF2, 0x2F, 0x5D, 0x41, 0xE9, 0x1D, 0x34, 0x1C,
+    0xA5, 0x01, 0xBA, 0xA7, 0x33, 0x1F, 0xCB, 0x31, 0x02, 0xAF, 0xB0, 0x98, 0x20, 0xAC, 0x63, 0x11,
+    0xF1, 0x56, 0xE8, 0xFC, 0xC5, 0x6A, 0xA3, 0xF6, 0xFF, 0x1F, 0x33, 0x9C, 0xD3, 0x5B, 0x9B, 0x03,
+    0xFC, 0x03, 0x6D, 0x58, 0x3D, 0x8C, 0xDC, 0xD6, 0x11, 0x1E, 0x92, 0x3A, 0x31, 0x31, 0x83, 0xF0,
+    0x0A, 0x0B, 0x09, 0xA2, 0x28, 0x4C, 0x1D, 0xC1, 0xC7, 0x26, 0xE5, 0xDE, 0x91, 0xB2, 0x8A, 0xB4,
+    0x57, 0xF8, 0x9C, 0x22, 0x85, 0x52, 0x1A, 0x0E, 0x02, 0x05, 0x41, 0x10, 0x5C, 0xB1, 0xB7, 0xA4,
+    0x63, 0x20, 0xAD, 0xAF, 0xB1, 0x53, 0xA4, 0xB9, 0x42, 0x01, 0x94, 0x55, 0x71, 0x2A, 0x54, 0x1C,
+    0x92, 0xDB, 0x5D, 0x5A, 0x29, 0x52, 0xB8, 0x10, 0xE5, 0x44, 0x70, 0xE1, 0x42, 0x44, 0x20, 0x03,
+    0x86, 0x1C, 0x44, 0x74, 0x44, 0xC1, 0xD4, 0x99, 0xCB, 0x97, 0xEF, 0x1B, 0x72, 0x7F, 0x24, 0x84,
+    0xC5, 0x47, 0x1E, 0x97, 0xEF, 0xBD, 0x79, 0x33, 0xDF, 0x7C, 0x33, 0xEF, 0x44, 0x78, 0x05, 0x6D,
+    0x2C, 0x62, 0x4C, 0x2A, 0xCE, 0xFC, 0x7C, 0x2C, 0x5E, 0x81, 0x57, 0x7E, 0x06, 0x08, 0xF1, 0x5A,
+    0x22, 0x7E, 0x31, 0x92, 0xB7, 0xC7, 0xF1, 0x88, 0xDF, 0x4C, 0xA4, 0x1D, 0xC7, 0x13, 0xAB, 0x12,
+    0x99, 0xD8, 0x25, 0x7E, 0x70, 0x00, 0xD1, 0x55, 0x40, 0x68, 0xCE, 0x6E, 0x8A, 0x6B, 0x4C, 0x23,
+    0x72, 0xED, 0xB3, 0x37, 0xFA, 0x19, 0xFC, 0x94, 0xC0, 0x69, 0x82, 0x78, 0x39, 0xA1, 0x29, 0x08,
+    0x39, 0xE7, 0xDD, 0xDD, 0x14, 0xB1, 0x0B, 0x8C, 0x76, 0x3E, 0x04, 0xB8, 0x5F, 0xE0, 0xE5, 0xCC,
+    0x54, 0x9C, 0xA6, 0x92, 0xB0, 0xF5, 0x6F, 0xCB, 0x6C, 0x18, 0x88, 0xD5, 0x0C, 0x5F, 0x13, 0xA7,
+    0xBC, 0x33, 0x80, 0x69, 0xE5, 0xBE, 0xF8, 0x77, 0x8B, 0x4A, 0x82, 0x77, 0x31, 0x20, 0xFC, 0xC9,
+    0xDD, 0x5C, 0x22, 0xEF, 0x6A, 0x26, 0x91, 0xEF, 0xA6, 0x12, 0x6D, 0xF9, 0x98, 0x78, 0x10, 0x00,
+    0x30, 0x40, 0xA2, 0x6A, 0x80, 0x65, 0x31, 0x40, 0xFC, 0x92, 0x93, 0xB7, 0x67, 0xFD, 0xC4, 0xDE,
+    0x35, 0x73, 0x28, 0xBE, 0x07, 0xD3, 0x38, 0x40, 0x38, 0x60, 0x71, 0xCD, 0x5A, 0x11, 0xCF, 0x18,
+    0x4C, 0x78, 0x76, 0x9C, 0x89, 0x89, 0x2D, 0x71, 0xB0, 0x1F, 0x71, 0x4B, 0x6E, 0x83, 0x16, 0x07,
+    0xDC, 0x50, 0xD4, 0xF9, 0xE5, 0xE8, 0x97, 0xF0, 0xCB, 0xD3, 0x56, 0x26, 0x96, 0xF9, 0xB7, 0x34,
+    0x36, 0x86, 0x36, 0x4E, 0x4D, 0xC0, 0xD7, 0x8D, 0x5B, 0x10, 0x30, 0x64, 0xEE, 0xC1, 0x11, 0x53,
+    0x7A, 0x23, 0xA1, 0x37, 0xA2, 0x87, 0x18, 0x1C, 0x98, 0x3F, 0x66, 0xB4, 0x25, 0xE3, 0x76, 0xF1,
+    0x72, 0x83, 0x13, 0x5A, 0xC6, 0xCC, 0xC5, 0xA6, 0x03, 0x1D, 0x05, 0xAE, 0xC9, 0x59, 0xC4, 0xE3,
+    0xC2, 0x5E, 0x26, 0xEB, 0x3E, 0x5D, 0x73, 0xE7, 0x78, 0x1C, 0xC3, 0x9D, 0x46, 0x3A, 0x38, 0xE0,
+    0x36, 0x4E, 0x09, 0x34, 0xFC, 0xC2, 0xFC, 0x0D, 0xBE, 0xC7, 0xE3, 0xE5, 0xF6, 0x26, 0x5C, 0xCD,
+    0x39, 0x75, 0x62, 0xA7, 0x58, 0xCC, 0xBE, 0xB8, 0x6C, 0x78, 0x06, 0x93, 0x73, 0x0E, 0x89, 0x1E,
+    0x4C, 0x81, 0x53, 0x39, 0xD7, 0x4F, 0x23, 0x56, 0xAD, 0x9F, 0x54, 0x8A, 0x1C, 0xDF, 0xCD, 0x22,
+    0x3F, 0x7B, 0xB6, 0xC7, 0x91, 0x30, 0xBC, 0xB3, 0xBC, 0x37, 0xB1, 0x43, 0xFB, 0xF8, 0xF1, 0x0D,
+    0x75, 0x27, 0x86, 0x9D, 0x9F, 0x8D, 0x8F, 0x16, 0x64, 0x82, 0xD7, 0x16, 0xF6, 0xF5, 0x53, 0x86,
+    0x67, 0xFD, 0x26, 0xE0, 0x8C, 0x04, 0x18, 0xCB, 0xFA, 0x75, 0xA2, 0x68, 0xE9, 0x82, 0xE2, 0x28,
+    0x6F, 0xD4, 0x1D, 0x43, 0xAF, 0xF1, 0xC1, 0xA5, 0xD3, 0xC4, 0x44, 0xA6, 0x96, 0xF9, 0xF3, 0xC4,
+    0x7C, 0xD0, 0x88, 0xC9, 0xFC, 0xB9, 0xCC, 0xC5, 0x88, 0x5F, 0x21, 0x30, 0x73, 0xF1, 0xF1, 0x81,
+    0xDD, 0x48, 0x90, 0x21, 0x2E, 0xE0, 0x54, 0xAA, 0xE1, 0x49, 0x62, 0xAB, 0xC6, 0xE6, 0x0D, 0x96,
+    0x77, 0x73, 0x1B, 0xB7, 0xD2, 0xCB, 0x9C, 0x16, 0x7B, 0xF2, 0x39, 0x9A, 0xB7, 0xB0, 0x81, 0x77,
+    0x82, 0x74, 0xD0, 0xC0, 0xFB, 0x61, 0x5C, 0x37, 0xD8, 0x51, 0x68, 0x7D, 0x59, 0xE3, 0x16, 0x39,
+    0x1F, 0x57, 0x8C, 0x01, 0xF9, 0xC3, 0x40, 0x74, 0x36, 0x6E, 0x77, 0xB7, 0xB7, 0xBA, 0x1B, 0xA8,
+    0x52, 0x71, 0x65, 0xF0, 0xB4, 0x84, 0xDD, 0x61, 0x09, 0x9F, 0x45, 0x25, 0x16, 0xDE, 0x29, 0xE1,
+    0xF8, 0x6D, 0x2C, 0x2A, 0xC3, 0xDA, 0xCD, 0x5E, 0x69, 0xDB, 0xE3, 0xCF, 0xE1, 0x71, 0xD3, 0xE8,
+    0x93, 0x55, 0x0D, 0x83, 0xD8, 0x2A, 0x87, 0xA1, 0x5C, 0x3E, 0x33, 0xB3, 0x23, 0x3A, 0xA2, 0xBC,
+    0xF8, 0x59, 0x32, 0xDD, 0x75, 0xF3, 0xAD, 0x21, 0x76, 0x1C, 0x9E, 0x02, 0x82, 0x53, 0x2C, 0x1E,
+    0xC0, 0x90, 0x18, 0x1B, 0x0C, 0x40, 0x6D, 0x09, 0x09, 0x11, 0x97, 0x13, 0xBF, 0xD5, 0x54, 0xD3,
+    0x48, 0x86, 0x0C, 0x0A, 0x7E, 0xD4, 0x78, 0x2A, 0x65, 0x77, 0x94, 0x30, 0x23, 0xC5, 0x89, 0x84,
+    0xAF, 0xE7, 0x08, 0x41, 0xE4, 0xC2, 0x31, 0x60, 0x66, 0x26, 0xB5, 0xB4, 0x49, 0x6B, 0x55, 0x60,
+    0x65, 0x8B, 0x50, 0x7E, 0x99, 0xBC, 0x0F, 0x16, 0xC6, 0x91, 0x38, 0x67, 0x87, 0x18, 0x4E, 0xA6,
+    0xEC, 0x28, 0x11, 0x0F, 0xD4, 0xF5, 0xA7, 0x1A, 0xE1, 0x46, 0xB9, 0x58, 0x6B, 0x52, 0xD4, 0x3A,
+    0x6D, 0xB3, 0xC9, 0x08, 0x9B, 0x92, 0x98, 0x68, 0xC0, 0x36, 0x68, 0x95, 0xBA, 0x2A, 0x30, 0x4A,
+    0xA2, 0xCE, 0x2E, 0xCC, 0x39, 0xEB, 0x6E, 0x4A, 0x89, 0x9D, 0x2E, 0xA7, 0x0E, 0x60, 0x15, 0x22,
+    0x3A, 0x41, 0x3E, 0x63, 0x0F, 0xB0, 0x2E, 0x7C, 0x70, 0x1B, 0xB7, 0x69, 0x44, 0x06, 0x5A, 0x0D,
+    0x6F, 0xCF, 0xAF, 0x55, 0x91, 0x92, 0x2D, 0xC7, 0x08, 0xC7, 0xB4, 0x12, 0xE4, 0x08, 0xD8, 0x48,
+    0xBC, 0x1A, 0x46, 0x46, 0x82, 0x2C, 0xF4, 0x72, 0x7C, 0x90, 0xC4, 0x08, 0x58, 0x8C, 0xB0, 0xFB,
+    0x19, 0x52, 0x05, 0x61, 0x4D, 0x61, 0x24, 0x9E, 0x53, 0xD8, 0x1D, 0xE0, 0x17, 0xFF, 0xA3, 0x38,
+    0xC1, 0xEE, 0xFC, 0x4F, 0x31, 0x43, 0x24, 0xDE, 0xC7, 0xEA, 0x32, 0xB5, 0x16, 0xF1, 0x6A, 0x64,
+    0xDB, 0x2A, 0xAD, 0x06, 0xC4, 0x29, 0x41, 0x9D, 0xDA, 0x2E, 0x9D, 0xC6, 0xAA, 0xEC, 0xD2, 0xE5,
+    0xDF, 0xA5, 0x3F, 0x74, 0x0A, 0xBB, 0x0C, 0xF6, 0xDD, 0xCC, 0x29, 0xB7, 0xF6, 0xC1, 0x9B, 0x62,
+    0xB0, 0xEF, 0xC7, 0x4E, 0x31, 0x3C, 0x09, 0x90, 0x55, 0xF5, 0x49, 0xA4, 0x3C, 0x86, 0x79, 0xC4,
+    0xCC, 0xF9, 0x47, 0x5E, 0xD5, 0xE2, 0x7C, 0x92, 0x55, 0x95, 0x38, 0x1F, 0xA5, 0xCF, 0x4A, 0x71,
+    0xEE, 0xC5, 0xFF, 0x2D, 0xC4, 0x7D, 0x28, 0x4F, 0x21, 0x01, 0xFF, 0x91, 0xAF, 0x80, 0x8D, 0x7C,
+    0x1D, 0x13, 0x11, 0x2A, 0xB7, 0x12, 0x4A, 0x50, 0x09, 0x0A, 0x53, 0x88, 0x35, 0xA3, 0xCC, 0x73,
+    0x3A, 0x3C, 0xC0, 0x9C, 0xF8, 0x3B, 0x18, 0xDF, 0xAA, 0xE8, 0x6C, 0xA8, 0x22, 0x44, 0x18, 0x3B,
+    0x85, 0x51, 0x70, 0x9F, 0x1C, 0xE0, 0x76, 0x60, 0x1F, 0x1E, 0x80, 0x64, 0xA7, 0x6E, 0x06, 0x1B,
+    0xA5, 0xF1, 0xB2, 0x53, 0x10, 0xAD, 0xF6, 0x33, 0x3C, 0xE1, 0x96, 0xE2, 0xC9, 0xAA, 0x82, 0x2B,
+    0x95, 0x9F, 0xDA, 0x65, 0x68, 0x95, 0x30, 0xBA, 0x8C, 0xB0, 0x13, 0xD8, 0xBE, 0xE3, 0x94, 0xA1,
+    0xB8, 0xF9, 0x8E, 0x03, 0x0F, 0xBA, 0xD9, 0x01, 0x9E, 0x10, 0xE5, 0x53, 0x2F, 0x3B, 0x80, 0xCB,
+    0x1A, 0x8D, 0x76, 0x5A, 0x53, 0x03, 0x30, 0x98, 0x5A, 0x18, 0x5A, 0xCF, 0xF6, 0x92, 0x5C, 0x42,
+    0x5B, 0x53, 0x75, 0x07, 0x44, 0x79, 0xD4, 0xF1, 0xFE, 0x82, 0x74, 0xC1, 0x5C, 0x24, 0xB9, 0xB5,
+    0x37, 0x8D, 0x55, 0x53, 0x0A, 0xC5, 0x7C, 0xA9, 0x24, 0xAC, 0x1F, 0xB6, 0xF9, 0x5D, 0x49, 0x56,
+    0x3C, 0x05, 0x26, 0x0F, 0xFE, 0x0A, 0x6C, 0x25, 0x2C, 0x84, 0xC9, 0xCA, 0x90, 0x92, 0x61, 0xA0,
+    0x1D, 0x10, 0xD9, 0x44, 0xCC, 0x44, 0x43, 0x48, 0x9E, 0xE1, 0x21, 0x52, 0x2D, 0x4E, 0x14, 0x5B,
+    0xA2, 0x3D, 0xA7, 0xEC, 0x78, 0xC4, 0x72, 0x04, 0x01, 0x74, 0x4D, 0x7D, 0x4A, 0x51, 0xCD, 0xB9,
+    0xE0, 0x39, 0x79, 0xE9, 0x42, 0x72, 0x95, 0x14, 0x5F, 0x5A, 0x76, 0x61, 0x6F, 0x6F, 0x25, 0x38,
+    0xE7, 0x69, 0x65, 0x48, 0x29, 0x33, 0x63, 0x04, 0xAE, 0x96, 0x1F, 0x6A, 0x66, 0x51, 0x40, 0x96,
+    0xB5, 0x10, 0x97, 0xE6, 0x16, 0x47, 0x47, 0x04, 0x55, 0x31, 0x55, 0xC4, 0xEF, 0x50, 0x10, 0x67,
+    0x20, 0x95, 0xA8, 0x28, 0xAA, 0xC2, 0x3A, 0x2B, 0xD5, 0xE5, 0x77, 0x96, 0x0A, 0x9F, 0x79, 0xFF,
+    0x84, 0xCA, 0x5C, 0x53, 0x20, 0xF9, 0xF6, 0x55, 0x4D, 0x56, 0xAE, 0x10, 0xE9, 0xEC, 0x91, 0x7E,
+    0x3C, 0xD2, 0xAA, 0x33, 0xD1, 0xEC, 0x38, 0xD5, 0x45, 0x1B, 0x9D, 0xA3, 0xE1, 0x6B, 0xAB, 0x8E,
+    0x52, 0x2A, 0x68, 0xCB, 0x75, 0xBF, 0x9A, 0xEB, 0xC2, 0x0C, 0x08, 0x89, 0x87, 0xA5, 0xEB, 0x91,
+    0xD6, 0x8E, 0x48, 0xE5, 0x98, 0xC9, 0x09, 0xFA, 0x67, 0xF4, 0x14, 0xC7, 0x06, 0x31, 0x4D, 0x0B,
+    0x63, 0x2D, 0xDF, 0x62, 0xD7, 0x44, 0x1A, 0x36, 0xD2, 0xC5, 0x27, 0x42, 0xCF, 0x42, 0x0A, 0x4C,
+    0xE5, 0x11, 0xA8, 0x51, 0xA5, 0xBE, 0xEE, 0x65, 0xBB, 0x03, 0xD4, 0x57, 0xEB, 0xAC, 0x61, 0x24,
+    0x31, 0x97, 0x43, 0x33, 0x5C, 0x1A, 0x17, 0x15, 0x7C, 0x75, 0x1F, 0xB1, 0xFB, 0xF4, 0x61, 0x21,
+    0xDF, 0xF6, 0x29, 0xE7, 0x3E, 0xA3, 0x10, 0x66, 0x0C, 0x88, 0x32, 0x82, 0x21, 0xC0, 0x12, 0xF2,
+    0xE3, 0x95, 0x4B, 0x57, 0xB3, 0x2F, 0x43, 0xA1, 0x72, 0x46, 0x17, 0xAB, 0x94, 0x84, 0x7F, 0xBA,
+    0xAE, 0xD2, 0x81, 0x60, 0xCE, 0xE2, 0x2E, 0x5B, 0x43, 0xAD, 0x36, 0x61, 0xAC, 0x3D, 0x0B, 0x7D,
+    0x56, 0xF6, 0xF7, 0xAA, 0x23, 0x62, 0x57, 0x5E, 0x0E, 0x7A, 0xD6, 0x4D, 0xFA, 0x7B, 0xB3, 0xBC,
+    0x77, 0xBF, 0x23, 0xCE, 0x95, 0x6D, 0x52, 0x90, 0xD2, 0x29, 0x03, 0x43, 0xB1, 0x86, 0x94, 0xFC,
+    0xA1, 0x26, 0x07, 0xF3, 0x89, 0x16, 0x8C, 0x10, 0x69, 0xC0, 0x92, 0x9E, 0x5C, 0xA9, 0x91, 0x57,
+    0xB9, 0xD5, 0x62, 0x20, 0xB2, 0x2A, 0xC0, 0x37, 0x76, 0xED, 0x3F, 0x36, 0xB9, 0x53, 0x7B, 0xA5,
+    0x8F, 0xB0, 0x23, 0x17, 0xF2, 0x00, 0xED, 0x85, 0xFB, 0xA4, 0xED, 0xEB, 0xD4, 0xAE, 0x2C, 0x0B,
+    0xE2, 0xFA, 0xBD, 0xAB, 0x1E, 0x5D, 0x1D, 0xEF, 0x42, 0x2F, 0xB2, 0x2C, 0x90, 0x8B, 0x1C, 0xEA,
+    0x2F, 0x75, 0x9E, 0x44, 0x3A, 0xE3, 0x3C, 0xD4, 0xF4, 0xE1, 0x38, 0x68, 0x51, 0x4C, 0x62, 0x05,
+    0x5A, 0xCF, 0x43, 0xC5, 0x1D, 0xC5, 0x53, 0x45, 0x8E, 0x72, 0xFE, 0x45, 0x8F, 0xD8, 0x5F, 0xE5,
+    0x5A, 0xE1, 0x53, 0x6D, 0x33, 0x56, 0xD5, 0x57, 0xDD, 0xF0, 0x2D, 0x6D, 0x71, 0xB6, 0x7D, 0x62,
+    0x12, 0x0E, 0xC9, 0xCD, 0x03, 0x94, 0x33, 0xE7, 0x8B, 0x1A, 0x93, 0x79, 0x7F, 0x2F, 0x81, 0xC1,
+    0xD5, 0x0C, 0x86, 0xED, 0xD8, 0x71, 0xB8, 0x66, 0x6C, 0xB8, 0x66, 0x70, 0x67, 0xAE, 0x46, 0xF0,
+    0x83, 0x8E, 0xDE, 0xEA, 0xD8, 0x19, 0x17, 0x0C, 0xDB, 0xC3, 0xBE, 0x07, 0x49, 0x6E, 0xB5, 0x0C,
+    0x46, 0xC2, 0x2F, 0x83, 0x34, 0x64, 0xE1, 0xBB, 0xDC, 0x8E, 0x67, 0x9F, 0x53, 0x59, 0x52, 0x78,
+    0x34, 0x8C, 0x91, 0x3E, 0xC9, 0x2E, 0x59, 0x5C, 0xFE, 0xE2, 0x6C, 0xDC, 0x1E, 0xBA, 0x05, 0xD4,
+    0xC0, 0xBB, 0x7F, 0xBD, 0xA4, 0x7A, 0x64, 0x9D, 0x12, 0xBE, 0xDC, 0xFE, 0xC8, 0x0B, 0x79, 0xB9,
+    0x6A, 0x7F, 0x70, 0x6D, 0xAE, 0xDA, 0x87, 0x90, 0x12, 0x65, 0x6B, 0x62, 0x04, 0xE6, 0x0C, 0x66,
+    0x24, 0xF7, 0x8B, 0xEF, 0xC2, 0x4C, 0x1B, 0x8E, 0x71, 0x1A, 0x27, 0x63, 0x8F, 0x47, 0xF4, 0x73,
+    0x97, 0x39, 0x92, 0xB1, 0xBA, 0x87, 0x29, 0xFD, 0x8B, 0x22, 0xA1, 0x2B, 0xF8, 0xE3, 0x1B, 0xB0,
+    0x9C, 0x45, 0x6C, 0x8A, 0xD9, 0x2A, 0xE0, 0x36, 0x88, 0x31, 0x95, 0x81, 0xE2, 0x90, 0x5D, 0x85,
+    0xEC, 0x83, 0x22, 0x91, 0xDC, 0x41, 0x9D, 0x8C, 0xB2, 0x8A, 0x82, 0x55, 0xA0, 0x95, 0x10, 0xAF,
+    0x7D, 0x06, 0x47, 0x74, 0x62, 0x89, 0xA1, 0xCF, 0x19, 0x96, 0x7F, 0x6A, 0x2F, 0xA3, 0x64, 0xB0,
+    0xD3, 0xF5, 0xD0, 0x77, 0xCC, 0xD6, 0x0E, 0xC8, 0xD1, 0x78, 0xB9, 0x4F, 0xB4, 0x87, 0xBE, 0xC7,
+    0x6F, 0x83, 0xF7, 0x54, 0x85, 0xB4, 0x17, 0x1C, 0x01, 0x2D, 0xA6, 0x7A, 0x61, 0x2B, 0x22, 0xF7,
+    0x98, 0xD2, 0x5E, 0xCE, 0xD6, 0xCE, 0x47, 0x71, 0x62, 0xE7, 0x05, 0xAF, 0x31, 0x77, 0x31, 0xD1,
+    0x9C, 0x5C, 0xB7, 0x94, 0xF1, 0x48, 0x0E, 0x4B, 0x75, 0xDC, 0xAA, 0x95, 0x8F, 0x35, 0xDB, 0x22,
+    0x56, 0x5B, 0xA5, 0xC5, 0x74, 0x2D, 0x0B, 0xAD, 0xD9, 0x5C, 0x85, 0x3B, 0x15, 0xF7, 0x6C, 0x06,
+    0x99, 0xEB, 0x1A, 0x61, 0x4D, 0x2E, 0x7B, 0x09, 0x4E, 0x79, 0x7E, 0x3C, 0x3E, 0xAE, 0xBB, 0x3E,
+    0x66, 0x7C, 0x6C, 0x6E, 0xC2, 0xAC, 0x9A, 0x6E, 0x4E, 0xE5, 0x47, 0xA6, 0x1D, 0x1F, 0xB1, 0x10,
+    0x96, 0xC1, 0xB3, 0xBD, 0xBD, 0x5D, 0x25, 0xBF, 0x0A, 0xA9, 0xB6, 0xD1, 0xFA, 0xA4, 0x5D, 0xB5,
+    0xF7, 0xFC, 0xCD, 0x9A, 0xA9, 0x53, 0x53, 0x98, 0x61, 0xBE, 0xB5, 0xBB, 0x8A, 0xDF, 0x89, 0x46,
+    0xEF, 0xB0, 0xEB, 0x2F, 0x03, 0xF3, 0x75, 0xC5, 0xD0, 0x6D, 0x4A, 0x8B, 0xC8, 0x39, 0x35, 0xBA,
+    0x41, 0x8D, 0x9B, 0x86, 0x4D, 0xA3, 0x16, 0xA6, 0x5E, 0xDC, 0xC5, 0x4C, 0x21, 0x61, 0x83, 0x36,
+    0x95, 0x2D, 0xC2, 0x36, 0x61, 0xD0, 0x03, 0x82, 0xC5, 0x4F, 0x28, 0xC2, 0x19, 0x76, 0x11, 0xF0,
+    0x10, 0x82, 0x40, 0x9D, 0x70, 0x1D, 0x35, 0xE3, 0x51, 0xDF, 0x6B, 0x6A, 0x90, 0x34, 0x46, 0x6E,
+    0xEC, 0x51, 0xBB, 0x94, 0x0F, 0xA1, 0xD2, 0x3F, 0x22, 0xF1, 0xCF, 0xAB, 0xDE, 0xA2, 0x3C, 0x23,
+    0xFD, 0x37, 0xE6, 0x7B, 0xEC, 0xB8, 0x1B, 0xF5, 0x60, 0xC3, 0xF4, 0xB2, 0x6A, 0x3A, 0xC9, 0xAE,
+    0xD8, 0x35, 0x3B, 0x6C, 0x01, 0x7B, 0x74, 0x0B, 0x46, 0xCB, 0xCD, 0xD9, 0x53, 0x79, 0x39, 0x3D,
+    0x83, 0x26, 0x65, 0x89, 0xDA, 0xA7, 0x80, 0xE0, 0x7E, 0x1E, 0xB3, 0xBF, 0xE3, 0x81, 0x04, 0x86,
+    0x29, 0x5D, 0x5E, 0x5D, 0x13, 0x86, 0x8B, 0x74, 0x16, 0x54, 0xBF, 0x21, 0x59, 0x6E, 0x01, 0xBD,
+    0x8A, 0xBF, 0xAB, 0x4F, 0x3B, 0xF7, 0xBE, 0x80, 0xDD, 0x7B, 0x5F, 0x53, 0xD3, 0xE9, 0xF4, 0xA9,
+    0x3B, 0x86, 0x85, 0x2A, 0x30, 0x8E, 0x59, 0x63, 0x60, 0x98, 0xBD, 0xF2, 0x7A, 0x7A, 0x23, 0xC8,
+    0xA2, 0x7B, 0x4F, 0x1B, 0x3F, 0xFB, 0x75, 0x39, 0xB9, 0x14, 0x64, 0xBF, 0xCD, 0xF7, 0x2F, 0x85,
+    0x69, 0x94, 0xDD, 0xBE, 0x04, 0xB7, 0xE6, 0xE5, 0xD6, 0x1C, 0x14, 0x3B, 0x9B, 0x81, 0x4A, 0xC7,
+    0x54, 0x6A, 0xCF, 0x7A, 0xF0, 0x1B, 0xCC, 0x6E, 0x67, 0xBF, 0x12, 0xF9, 0xA6, 0x9D, 0xFE, 0x5C,
+    0xD4, 0x27, 0x9A, 0xE6, 0x0A, 0x6B, 0x4D, 0xFD, 0xDB, 0xE3, 0xF1, 0x9F, 0x59, 0xAC, 0x5A, 0xD6,
+    0xAA, 0xF9, 0xE2, 0x5C, 0xB3, 0x24, 0xC6, 0x4B, 0x89, 0xFD, 0xFF, 0x4A, 0x44, 0xB3, 0x50, 0x2F,
+    0x85, 0x55, 0xFD, 0xED, 0x4E, 0x4D, 0x0C, 0x08, 0xD9, 0x2F, 0x1B, 0xD7, 0xF5, 0x80, 0x52, 0x2F,
+    0xC7, 0xCD, 0xB5, 0x6C, 0x37, 0xAC, 0x29, 0x75, 0xFF, 0x4E, 0x7F, 0x45, 0xC7, 0x25, 0x6F, 0xCE,
+    0x60, 0x01, 0x4B, 0xB7, 0x68, 0xDD, 0x19, 0x2D, 0xD7, 0x56, 0xA3, 0xD4, 0x3C, 0x6F, 0x59, 0xCF,
+    0xED, 0x55, 0x29, 0xD7, 0xA2, 0xC4, 0x62, 0x26, 0x6E, 0xBE, 0x38, 0xAE, 0xF5, 0x3B, 0xBA, 0x88,
+    0xC1, 0xBF, 0x6F, 0x7B, 0xF9, 0x49, 0xA8, 0x5E, 0x74, 0x43, 0x30, 0x83, 0x44, 0x6D, 0x8E, 0xAE,
+    0xD7, 0x8C, 0x5D, 0x0C, 0x02, 0x41, 0x20, 0x13, 0x4E, 0xF5, 0x17, 0xE4, 0xE7, 0x11, 0x76, 0x84,
+    0xAA, 0x02, 0xAF, 0x16, 0xDA, 0x04, 0x01, 0x82, 0x8C, 0xBA, 0x12, 0x63, 0x62, 0x76, 0xB7, 0x1E,
+    0xDA, 0xEE, 0xC7, 0x08, 0xBC, 0x4F, 0x97, 0x06, 0xDA, 0x7A, 0xED, 0xAE, 0x4E, 0x71, 0x6A, 0x8C,
+    0xAE, 0x82, 0xD3, 0x2D, 0xED, 0x1E, 0x50, 0xD0, 0x7A, 0xDC, 0xD6, 0x43, 0x4B, 0xF4, 0xE4, 0x31,
+    0x0E, 0x63, 0xBE, 0x12, 0x56, 0xB5, 0x83, 0x1C, 0x63, 0x5B, 0xBF, 0xA5, 0x6C, 0x47, 0x9A, 0x20,
+    0xB7, 0x06, 0xDF, 0xFF, 0x06, 0x70, 0x78, 0xB0, 0x63, 0x67, 0x32, 0x35, 0x06, 0x67, 0xEC, 0xD9,
+    0x7B, 0x9F, 0x3C, 0x89, 0x65, 0xE2, 0x5E, 0x69, 0xD5, 0x65, 0x9B, 0xE2, 0xE9, 0xEE, 0xB7, 0x54,
+    0x6D, 0xCF, 0x75, 0x67, 0xBA, 0xE8, 0xC1, 0x5B, 0xBA, 0x7C, 0xB3, 0x3C, 0x50, 0xB2, 0xA5, 0x96,
+    0xC5, 0x81, 0xB3, 0x3F, 0x71, 0x76, 0xE8, 0xE5, 0xF2, 0xE2, 0x79, 0xB1, 0xF3, 0xF3, 0xC6, 0xEC,
+    0x91, 0x9E, 0x85, 0x55, 0xEF, 0x79, 0x76, 0x8C, 0x8A, 0x48, 0x7B, 0xE3, 0x91, 0xCC, 0xE1, 0xEF,
+    0x89, 0x8C, 0x1C, 0x3D, 0x1A, 0x38, 0xA5, 0x1E, 0x5F, 0xD8, 0x23, 0x47, 0xA8, 0xC8, 0xB5, 0x8C,
+    0xFC, 0x1C, 0x5E, 0x9B, 0xA0, 0xC9, 0xDD, 0x95, 0xB9, 0x12, 0xBE, 0xD1, 0x09, 0x1B, 0xD2, 0x09,
+    0xBD, 0x92, 0x06, 0x2D, 0xEA, 0xE2, 0x67, 0x1B, 0x16, 0x25, 0x3D, 0x67, 0xE3, 0x84, 0x33, 0x33,
+    0x6A, 0x13, 0x44, 0x1A, 0x36, 0xA1, 0xA5, 0xF0, 0x16, 0x0D, 0x67, 0xDF, 0x76, 0x6A, 0xE7, 0x09,
+    0x8D, 0x0C, 0xE3, 0xAE, 0x3F, 0xB3, 0x10, 0xD1, 0xC8, 0x42, 0xF8, 0x68, 0x60, 0x4E, 0x9A, 0xC3,
+    0xEB, 0x1B, 0xED, 0xDE, 0xAA, 0x81, 0x51, 0x44, 0x6D, 0xEB, 0x3A, 0x4D, 0xE0, 0x4F, 0x9F, 0xEF,
+    0x2D, 0x0F, 0xCD, 0x1D, 0xAE, 0x3B, 0x61, 0x79, 0xBD, 0x46, 0x6D, 0x91, 0x41, 0x87, 0x3F, 0x50,
+    0x5E, 0x91, 0x8B, 0x9E, 0x76, 0x40, 0x09, 0x55, 0xDE, 0x32, 0xE5, 0x60, 0x17, 0xCD, 0x9D, 0xFE,
+    0x5F, 0xE3, 0x7E, 0x71, 0x07, 0x96, 0xBC, 0x43, 0xED, 0x4A, 0xEC, 0x1C, 0x38, 0x75, 0x32, 0xFE,
+    0xF3, 0xC1, 0xF9, 0xB0, 0x78, 0xE1, 0xE0, 0xBE, 0x7E, 0x7C, 0xB7, 0xAA, 0xD5, 0x9B, 0xDE, 0xDA,
+    0xB9, 0x2C, 0x19, 0xAC, 0xA5, 0x40, 0x75, 0x44, 0xE4, 0x7B, 0xB7, 0xCC, 0xE3, 0x23, 0x3D, 0xCD,
+    0x94, 0x3D, 0xF6, 0xD7, 0x00, 0xFA, 0x29, 0xFB, 0x84, 0x3B, 0xFB, 0xE4, 0x36, 0xBB, 0x47, 0xE6,
+    0x4D, 0x44, 0x2A, 0x8D, 0x20, 0xA8, 0x88, 0x92, 0xAF, 0xC0, 0x13, 0x8B, 0x9F, 0x29, 0x58, 0x2C,
+    0x33, 0x30, 0x61, 0x06, 0xE9, 0x39, 0xD6, 0xFF, 0x71, 0xA4, 0x04, 0xD4, 0x2D, 0x2D, 0xF2, 0x39,
+    0xAC, 0xC0, 0x97, 0x53, 0x42, 0x42, 0x7F, 0x8F, 0x58, 0xE4, 0xA7, 0xF4, 0x39, 0x2B, 0x93, 0x5B,
+    0x4B, 0x34, 0x9E, 0x95, 0xF4, 0x41, 0x8A, 0xA4, 0xC1, 0x8A, 0xCE, 0x5D, 0x96, 0xEE, 0xBF, 0xB1,
+    0x72, 0xBF, 0xCB, 0xBE, 0xD2, 0x82, 0x39, 0xFF, 0x03, 0x63, 0x0D, 0x75, 0xD0, 0xFF, 0x7F, 0xC0,
+    0xFE, 0xFF, 0x01, 0xD1, 0x50, 0x07, 0x00, 0x8D, 0x8F, 0xBD, 0x11, 0xC2, 0x30, 0x0C, 0x85, 0x5F,
+    0x12, 0xEE, 0x52, 0xB8, 0x60, 0x04, 0x3A, 0x5A, 0x8F, 0x90, 0x8C, 0x40, 0x41, 0xC7, 0x2C, 0x10,
+    0x16, 0x0B, 0x78, 0x04, 0x8F, 0x90, 0x86, 0x3E, 0x45, 0x8A, 0x70, 0x97, 0x20, 0x9E, 0x24, 0x38,
+    0x5A, 0x5C, 0xE8, 0xB3, 0x6C, 0xFD, 0xBC, 0x07, 0xA0, 0x38, 0x42, 0x4F, 0x23, 0x2D, 0x63, 0x21,
+    0x32, 0x10, 0xD5, 0x5C, 0xCF, 0x44, 0x3D, 0x60, 0x21, 0x42, 0x2E, 0x34, 0xDB, 0xA6, 0x62, 0x32,
+    0x94, 0x23, 0xB1, 0xBB, 0x46, 0x61, 0x1A, 0x5B, 0x51, 0x34, 0x38, 0x3D, 0x0E, 0x8A, 0x90, 0xF9,
+    0x77, 0x61, 0xD1, 0x0F, 0xBD, 0x63, 0x61, 0x8B, 0x21, 0x72, 0x11, 0x07, 0x36, 0x4C, 0xCA, 0xE9,
+    0x8B, 0x8B, 0x6E, 0x1D, 0x71, 0x76, 0xF4, 0xBE, 0xBC, 0xB7, 0xE5, 0xB8, 0x6F, 0x74, 0x2B, 0x9A,
+    0xD5, 0xB0, 0x73, 0xA0, 0x85, 0x0F, 0x84, 0x0D, 0x54, 0x07, 0x16, 0x71, 0xB3, 0xB8, 0x5F, 0xFC,
+    0x6D, 0x72, 0x64, 0x7C, 0xCE, 0x1F, 0x6E, 0x93, 0xB9, 0x0D, 0xA9, 0xD4, 0xDE, 0x3A, 0x51, 0x0E,
+    0xA2, 0x64, 0xBA, 0xD5, 0x72, 0x91, 0xB1, 0x7A, 0x9E, 0x12, 0xDD, 0x86, 0xC1, 0xC4, 0x85, 0x64,
+    0x72, 0xD4, 0x37, 0x51, 0xB3, 0x78, 0x7B, 0x45, 0xF5, 0x72, 0x71, 0x92, 0x4D, 0x5C, 0xFC, 0xB8,
+    0x5D, 0x5D, 0xE3, 0xDD, 0xDC, 0xF2, 0x7E, 0x76, 0xA8, 0x4D, 0x74, 0x8A, 0x89, 0x25, 0x74, 0x2B,
+    0x32, 0xA3, 0x5B, 0xD1, 0xB1, 0x5D, 0xDD, 0xAA, 0xE4, 0x16, 0x6F, 0x4D, 0x8F, 0xB1, 0x0D, 0xC3,
     0x30, 0x0C, 0x04, 0x19, 0xA8, 0x48, 0xC9, 0x3E, 0x19, 0x42, 0x23, 0x50, 0x9B, 0x39, 0x23, 0x64,
     0x23, 0x6B, 0x04, 0x8D, 0x90, 0x11, 0x52, 0xD8, 0x40, 0x0A, 0x3B, 0x9F, 0xD7, 0x0B, 0x36, 0xC2,
     0xE6, 0x41, 0xF0, 0xC8, 0x7F, 0x9A, 0x9D, 0x95, 0xCA, 0x50, 0x6F, 0x43, 0x63, 0x19, 0x8A, 0x7D,
@@ -2585,99 +2589,99 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 0, 0, 139, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 139, 0, 0, 0, 0 }, // U+0020
     { 10, 25, 139, 0, 24, 63, 0 }, // !
-    { 11, 9, 209, 3, 24, 25, 63 }, // "
-    { 21, 24, 344, 1, 24, 126, 88 }, // #
-    { 17, 28, 294, 1, 26, 119, 214 }, // $
-    { 24, 26, 426, 2, 25, 156, 333 }, // %
-    { 21, 26, 359, 1, 25, 137, 489 }, // &
-    { 5, 9, 117, 3, 24, 12, 626 }, // '
-    { 12, 30, 155, 1, 24, 90, 638 }, // (
-    { 12, 30, 155, -3, 24, 90, 728 }, // )
-    { 16, 16, 294, 3, 26, 64, 818 }, // *
-    { 16, 17, 305, 2, 20, 68, 882 }, // +
-    { 8, 9, 137, -2, 4, 18, 950 }, // ,
-    { 10, 4, 167, 0, 11, 10, 968 }, // -
-    { 5, 6, 137, 0, 5, 8, 978 }, // .
-    { 17, 24, 190, -2, 24, 102, 986 }, // /
-    { 17, 26, 298, 1, 25, 111, 1088 }, // 0
-    { 11, 24, 243, 3, 24, 66, 1199 }, // 1
-    { 18, 25, 294, -1, 25, 113, 1265 }, // 2
-    { 18, 26, 294, -1, 25, 117, 1378 }, // 3
-    { 18, 24, 294, 0, 24, 108, 1495 }, // 4
-    { 18, 25, 294, 0, 24, 113, 1603 }, // 5
-    { 17, 26, 294, 1, 25, 111, 1716 }, // 6
-    { 17, 24, 254, 2, 24, 102, 1827 }, // 7
-    { 17, 26, 294, 1, 25, 111, 1929 }, // 8
-    { 16, 26, 294, 1, 25, 104, 2040 }, // 9
-    { 8, 20, 137, 0, 19, 40, 2144 }, // :
-    { 10, 24, 137, -2, 19, 60, 2184 }, // ;
-    { 17, 18, 305, 2, 21, 77, 2244 }, // <
-    { 16, 10, 305, 2, 17, 40, 2321 }, // =
-    { 17, 18, 305, 2, 21, 77, 2361 }, // >
-    { 14, 26, 229, 2, 25, 91, 2438 }, // ?
-    { 27, 28, 452, 1, 24, 189, 2529 }, // @
-    { 20, 24, 300, -2, 24, 120, 2718 }, // A
-    { 19, 24, 320, 1, 24, 114, 2838 }, // B
-    { 20, 26, 313, 2, 25, 130, 2952 }, // C
-    { 21, 24, 356, 1, 24, 126, 3082 }, // D
-    { 18, 24, 274, 1, 24, 108, 3208 }, // E
-    { 18, 24, 254, 1, 24, 108, 3316 }, // F
-    { 21, 26, 362, 2, 25, 137, 3424 }, // G
-    { 22, 24, 363, 1, 24, 132, 3561 }, // H
-    { 14, 24, 173, -1, 24, 84, 3693 }, // I
-    { 16, 31, 146, -6, 24, 124, 3777 }, // J
-    { 21, 24, 300, 1, 24, 126, 3901 }, // K
-    { 13, 24, 255, 1, 24, 78, 4027 }, // L
-    { 28, 24, 448, 1, 24, 168, 4105 }, // M
-    { 23, 24, 377, 1, 24, 138, 4273 }, // N
-    { 21, 26, 384, 2, 25, 137, 4411 }, // O
-    { 18, 24, 302, 1, 24, 108, 4548 }, // P
-    { 21, 31, 384, 2, 25, 163, 4656 }, // Q
-    { 18, 24, 306, 1, 24, 108, 4819 }, // R
-    { 18, 26, 269, 0, 25, 117, 4927 }, // S
-    { 17, 24, 267, 3, 24, 102, 5044 }, // T
-    { 21, 25, 361, 2, 24, 132, 5146 }, // U
-    { 19, 24, 294, 3, 24, 114, 5278 }, // V
-    { 29, 24, 456, 3, 24, 174, 5392 }, // W
-    { 23, 24, 281, -2, 24, 138, 5566 }, // X
-    { 18, 24, 271, 3, 24, 108, 5704 }, // Y
-    { 21, 24, 283, -1, 24, 126, 5812 }, // Z
-    { 14, 30, 155, -1, 24, 105, 5938 }, // [
-    { 7, 24, 190, 3, 24, 42, 6043 }, // <backslash>
-    { 14, 30, 155, -3, 24, 105, 6085 }, // ]
-    { 17, 16, 305, 1, 24, 68, 6190 }, // ^
-    { 15, 3, 211, -4, -3, 12, 6258 }, // _
-    { 7, 6, 148, 4, 26, 11, 6270 }, // `
-    { 18, 20, 303, 1, 19, 90, 6281 }, // a
-    { 18, 27, 309, 0, 26, 122, 6371 }, // b
-    { 15, 20, 242, 1, 19, 75, 6493 }, // c
-    { 19, 27, 309, 1, 26, 129, 6568 }, // d
-    { 15, 20, 266, 1, 19, 75, 6697 }, // e
-    { 19, 34, 170, -4, 26, 162, 6772 }, // f
-    { 19, 27, 309, 0, 19, 129, 6934 }, // g
-    { 18, 26, 309, 0, 26, 117, 7063 }, // h
-    { 9, 25, 138, 0, 25, 57, 7180 }, // i
-    { 14, 33, 138, -5, 25, 116, 7237 }, // j
-    { 18, 26, 264, 0, 26, 117, 7353 }, // k
-    { 10, 26, 138, 0, 26, 65, 7470 }, // l
-    { 28, 19, 467, 0, 19, 133, 7535 }, // m
-    { 18, 19, 309, 0, 19, 86, 7668 }, // n
-    { 17, 20, 300, 1, 19, 85, 7754 }, // o
-    { 19, 27, 309, -1, 19, 129, 7839 }, // p
-    { 18, 27, 309, 1, 19, 122, 7968 }, // q
-    { 15, 19, 212, 0, 19, 72, 8090 }, // r
-    { 14, 20, 230, 0, 19, 70, 8162 }, // s
-    { 12, 23, 177, 1, 22, 69, 8232 }, // t
-    { 18, 19, 309, 1, 18, 86, 8301 }, // u
-    { 17, 18, 249, 1, 18, 77, 8387 }, // v
-    { 25, 18, 386, 1, 18, 113, 8464 }, // w
-    { 19, 18, 258, -2, 18, 86, 8577 }, // x
-    { 22, 26, 249, -4, 18, 143, 8663 }, // y
-    { 16, 18, 237, -1, 18, 72, 8806 }, // z
-    { 14, 30, 187, 0, 24, 105, 8878 }, // {
-    { 4, 35, 294, 8, 26, 35, 8983 }, // |
-    { 14, 30, 187, -2, 24, 105, 9018 }, // }
-    { 17, 5, 305, 2, 14, 22, 9123 }, // ~
+    { 11, 9, 209, 3, 24, 25, 0 }, // "
+    { 21, 24, 344, 1, 24, 126, 25 }, // #
+    { 17, 28, 294, 1, 26, 119, 151 }, // $
+    { 24, 26, 426, 2, 25, 156, 270 }, // %
+    { 21, 26, 359, 1, 25, 137, 426 }, // &
+    { 5, 9, 117, 3, 24, 12, 563 }, // '
+    { 12, 30, 155, 1, 24, 90, 63 }, // (
+    { 12, 30, 155, -3, 24, 90, 153 }, // )
+    { 16, 16, 294, 3, 26, 64, 575 }, // *
+    { 16, 17, 305, 2, 20, 68, 639 }, // +
+    { 8, 9, 137, -2, 4, 18, 243 }, // ,
+    { 10, 4, 167, 0, 11, 10, 261 }, // -
+    { 5, 6, 137, 0, 5, 8, 271 }, // .
+    { 17, 24, 190, -2, 24, 102, 707 }, // /
+    { 17, 26, 298, 1, 25, 111, 279 }, // 0
+    { 11, 24, 243, 3, 24, 66, 390 }, // 1
+    { 18, 25, 294, -1, 25, 113, 456 }, // 2
+    { 18, 26, 294, -1, 25, 117, 569 }, // 3
+    { 18, 24, 294, 0, 24, 108, 686 }, // 4
+    { 18, 25, 294, 0, 24, 113, 794 }, // 5
+    { 17, 26, 294, 1, 25, 111, 907 }, // 6
+    { 17, 24, 254, 2, 24, 102, 1018 }, // 7
+    { 17, 26, 294, 1, 25, 111, 1120 }, // 8
+    { 16, 26, 294, 1, 25, 104, 1231 }, // 9
+    { 8, 20, 137, 0, 19, 40, 1335 }, // :
+    { 10, 24, 137, -2, 19, 60, 1375 }, // ;
+    { 17, 18, 305, 2, 21, 77, 809 }, // <
+    { 16, 10, 305, 2, 17, 40, 886 }, // =
+    { 17, 18, 305, 2, 21, 77, 926 }, // >
+    { 14, 26, 229, 2, 25, 91, 1435 }, // ?
+    { 27, 28, 452, 1, 24, 189, 1003 }, // @
+    { 20, 24, 300, -2, 24, 120, 1526 }, // A
+    { 19, 24, 320, 1, 24, 114, 1646 }, // B
+    { 20, 26, 313, 2, 25, 130, 1760 }, // C
+    { 21, 24, 356, 1, 24, 126, 1890 }, // D
+    { 18, 24, 274, 1, 24, 108, 2016 }, // E
+    { 18, 24, 254, 1, 24, 108, 2124 }, // F
+    { 21, 26, 362, 2, 25, 137, 2232 }, // G
+    { 22, 24, 363, 1, 24, 132, 2369 }, // H
+    { 14, 24, 173, -1, 24, 84, 2501 }, // I
+    { 16, 31, 146, -6, 24, 124, 2585 }, // J
+    { 21, 24, 300, 1, 24, 126, 2709 }, // K
+    { 13, 24, 255, 1, 24, 78, 2835 }, // L
+    { 28, 24, 448, 1, 24, 168, 2913 }, // M
+    { 23, 24, 377, 1, 24, 138, 3081 }, // N
+    { 21, 26, 384, 2, 25, 137, 3219 }, // O
+    { 18, 24, 302, 1, 24, 108, 3356 }, // P
+    { 21, 31, 384, 2, 25, 163, 3464 }, // Q
+    { 18, 24, 306, 1, 24, 108, 3627 }, // R
+    { 18, 26, 269, 0, 25, 117, 3735 }, // S
+    { 17, 24, 267, 3, 24, 102, 3852 }, // T
+    { 21, 25, 361, 2, 24, 132, 1192 }, // U
+    { 19, 24, 294, 3, 24, 114, 3954 }, // V
+    { 29, 24, 456, 3, 24, 174, 4068 }, // W
+    { 23, 24, 281, -2, 24, 138, 4242 }, // X
+    { 18, 24, 271, 3, 24, 108, 4380 }, // Y
+    { 21, 24, 283, -1, 24, 126, 4488 }, // Z
+    { 14, 30, 155, -1, 24, 105, 1324 }, // [
+    { 7, 24, 190, 3, 24, 42, 1429 }, // <backslash>
+    { 14, 30, 155, -3, 24, 105, 1471 }, // ]
+    { 17, 16, 305, 1, 24, 68, 1576 }, // ^
+    { 15, 3, 211, -4, -3, 12, 1644 }, // _
+    { 7, 6, 148, 4, 26, 11, 1656 }, // `
+    { 18, 20, 303, 1, 19, 90, 4614 }, // a
+    { 18, 27, 309, 0, 26, 122, 4704 }, // b
+    { 15, 20, 242, 1, 19, 75, 4826 }, // c
+    { 19, 27, 309, 1, 26, 129, 4901 }, // d
+    { 15, 20, 266, 1, 19, 75, 5030 }, // e
+    { 19, 34, 170, -4, 26, 162, 5105 }, // f
+    { 19, 27, 309, 0, 19, 129, 5267 }, // g
+    { 18, 26, 309, 0, 26, 117, 5396 }, // h
+    { 9, 25, 138, 0, 25, 57, 5513 }, // i
+    { 14, 33, 138, -5, 25, 116, 5570 }, // j
+    { 18, 26, 264, 0, 26, 117, 5686 }, // k
+    { 10, 26, 138, 0, 26, 65, 5803 }, // l
+    { 28, 19, 467, 0, 19, 133, 5868 }, // m
+    { 18, 19, 309, 0, 19, 86, 6001 }, // n
+    { 17, 20, 300, 1, 19, 85, 6087 }, // o
+    { 19, 27, 309, -1, 19, 129, 6172 }, // p
+    { 18, 27, 309, 1, 19, 122, 6301 }, // q
+    { 15, 19, 212, 0, 19, 72, 6423 }, // r
+    { 14, 20, 230, 0, 19, 70, 6495 }, // s
+    { 12, 23, 177, 1, 22, 69, 6565 }, // t
+    { 18, 19, 309, 1, 18, 86, 6634 }, // u
+    { 17, 18, 249, 1, 18, 77, 6720 }, // v
+    { 25, 18, 386, 1, 18, 113, 6797 }, // w
+    { 19, 18, 258, -2, 18, 86, 6910 }, // x
+    { 22, 26, 249, -4, 18, 143, 6996 }, // y
+    { 16, 18, 237, -1, 18, 72, 7139 }, // z
+    { 14, 30, 187, 0, 24, 105, 1667 }, // {
+    { 4, 35, 294, 8, 26, 35, 1772 }, // |
+    { 14, 30, 187, -2, 24, 105, 1807 }, // }
+    { 17, 5, 305, 2, 14, 22, 1912 }, // ~
     { 0, 0, 139, 0, 0, 0, 0 }, // U+00A0
     { 10, 26, 139, -1, 19, 65, 0 }, // U+00A1
     { 15, 26, 294, 3, 25, 98, 65 }, // U+00A2
@@ -2761,19 +2765,19 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 18, 27, 304, 1, 26, 122, 8881 }, // U+00F0
     { 19, 25, 309, 0, 25, 119, 9003 }, // U+00F1
     { 17, 27, 300, 1, 26, 115, 9122 }, // U+00F2
-    { 17, 27, 300, 1, 26, 115, 9237 }, // U+00F3
-    { 17, 27, 300, 1, 26, 115, 9352 }, // U+00F4
-    { 17, 26, 300, 1, 25, 111, 9467 }, // U+00F5
-    { 17, 26, 300, 1, 25, 111, 9578 }, // U+00F6
-    { 17, 16, 305, 2, 20, 68, 9689 }, // U+00F7
-    { 18, 22, 300, 0, 20, 99, 9757 }, // U+00F8
-    { 18, 27, 309, 1, 26, 122, 9856 }, // U+00F9
-    { 18, 27, 309, 1, 26, 122, 9978 }, // U+00FA
-    { 18, 27, 309, 1, 26, 122, 10100 }, // U+00FB
-    { 18, 26, 309, 1, 25, 117, 10222 }, // U+00FC
-    { 22, 34, 249, -4, 26, 187, 10339 }, // U+00FD
-    { 19, 34, 309, -1, 26, 162, 10526 }, // U+00FE
-    { 22, 33, 249, -4, 25, 182, 10688 }, // U+00FF
+    { 17, 27, 300, 1, 26, 115, 7211 }, // U+00F3
+    { 17, 27, 300, 1, 26, 115, 9237 }, // U+00F4
+    { 17, 26, 300, 1, 25, 111, 9352 }, // U+00F5
+    { 17, 26, 300, 1, 25, 111, 9463 }, // U+00F6
+    { 17, 16, 305, 2, 20, 68, 9574 }, // U+00F7
+    { 18, 22, 300, 0, 20, 99, 9642 }, // U+00F8
+    { 18, 27, 309, 1, 26, 122, 9741 }, // U+00F9
+    { 18, 27, 309, 1, 26, 122, 9863 }, // U+00FA
+    { 18, 27, 309, 1, 26, 122, 9985 }, // U+00FB
+    { 18, 26, 309, 1, 25, 117, 10107 }, // U+00FC
+    { 22, 34, 249, -4, 26, 187, 10224 }, // U+00FD
+    { 19, 34, 309, -1, 26, 162, 10411 }, // U+00FE
+    { 22, 33, 249, -4, 25, 182, 10573 }, // U+00FF
     { 20, 29, 300, -2, 29, 145, 0 }, // U+0100
     { 18, 24, 303, 1, 23, 108, 145 }, // U+0101
     { 21, 31, 300, -2, 31, 163, 253 }, // U+0102
@@ -3475,98 +3479,98 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 10, 4, 167, 0, 11, 10, 126 }, // U+2010
     { 10, 4, 167, 0, 11, 10, 136 }, // U+2011
     { 17, 4, 294, 1, 14, 17, 146 }, // U+2012
-    { 15, 4, 256, 0, 11, 15, 163 }, // U+2013
-    { 31, 4, 512, 0, 11, 31, 178 }, // U+2014
-    { 31, 4, 512, 0, 11, 31, 209 }, // U+2015
-    { 10, 35, 294, 5, 26, 88, 240 }, // U+2016
-    { 16, 8, 211, -4, 0, 32, 328 }, // U+2017
-    { 7, 9, 93, 2, 24, 16, 360 }, // U+2018
-    { 7, 9, 93, 2, 24, 16, 376 }, // U+2019
-    { 7, 9, 130, -2, 4, 16, 392 }, // U+201A
-    { 5, 9, 93, 3, 24, 12, 408 }, // U+201B
-    { 13, 9, 191, 2, 24, 30, 420 }, // U+201C
-    { 13, 9, 191, 2, 24, 30, 450 }, // U+201D
-    { 14, 9, 227, -2, 4, 32, 480 }, // U+201E
-    { 10, 9, 191, 3, 24, 23, 512 }, // U+201F
-    { 13, 26, 251, 3, 26, 85, 535 }, // U+2020
-    { 16, 26, 251, 1, 26, 104, 620 }, // U+2021
-    { 8, 9, 201, 3, 17, 18, 724 }, // U+2022
-    { 11, 11, 196, 1, 18, 31, 742 }, // U+2023
-    { 5, 6, 267, 4, 5, 8, 773 }, // U+2024
-    { 14, 6, 270, 0, 5, 21, 781 }, // U+2025
-    { 22, 6, 410, 0, 5, 33, 802 }, // U+2026
-    { 5, 6, 137, 2, 12, 8, 835 }, // U+2027
-    { 0, 0, 320, 0, 0, 0, 843 }, // U+2028
-    { 0, 0, 320, 0, 0, 0, 843 }, // U+2029
-    { 9, 26, 0, -1, 21, 59, 843 }, // U+202A
-    { 9, 26, 0, -8, 21, 59, 902 }, // U+202B
-    { 8, 28, 0, -4, 23, 56, 961 }, // U+202C
-    { 8, 28, 0, -4, 23, 56, 1017 }, // U+202D
-    { 8, 28, 0, -4, 23, 56, 1073 }, // U+202E
-    { 0, 0, 89, 0, 0, 0, 1129 }, // U+202F
-    { 35, 26, 600, 2, 25, 228, 1129 }, // U+2030
-    { 45, 26, 775, 2, 25, 293, 1357 }, // U+2031
-    { 8, 9, 117, 2, 24, 18, 1650 }, // U+2032
-    { 14, 9, 207, 2, 24, 32, 1668 }, // U+2033
-    { 19, 9, 298, 2, 24, 43, 1700 }, // U+2034
-    { 5, 9, 144, 4, 24, 12, 1743 }, // U+2035
-    { 11, 9, 226, 4, 24, 25, 1755 }, // U+2036
-    { 16, 9, 308, 4, 24, 36, 1780 }, // U+2037
-    { 13, 11, 213, -3, 3, 36, 1816 }, // U+2038
-    { 9, 15, 153, 1, 16, 34, 1852 }, // U+2039
-    { 9, 15, 153, 0, 16, 34, 1886 }, // U+203A
-    { 26, 26, 446, 1, 25, 169, 1920 }, // U+203B
-    { 17, 25, 263, 0, 24, 107, 2089 }, // U+203C
-    { 14, 26, 230, 2, 25, 91, 2196 }, // U+203D
-    { 15, 3, 210, 3, 28, 12, 2287 }, // U+203E
-    { 18, 7, 289, -2, -1, 32, 2299 }, // U+203F
-    { 18, 8, 289, 2, 27, 36, 2331 }, // U+2040
-    { 16, 22, 182, -4, 14, 88, 2367 }, // U+2041
-    { 36, 31, 596, 0, 26, 279, 2455 }, // U+2042
-    { 9, 4, 153, 0, 11, 9, 2734 }, // U+2043
-    { 21, 24, 69, -8, 24, 126, 2743 }, // U+2044
-    { 14, 30, 155, -1, 24, 105, 2869 }, // U+2045
-    { 14, 30, 155, -3, 24, 105, 2974 }, // U+2046
-    { 28, 26, 459, 2, 25, 182, 3079 }, // U+2047
-    { 22, 26, 368, 2, 25, 143, 3261 }, // U+2048
-    { 24, 26, 368, 0, 25, 156, 3404 }, // U+2049
-    { 17, 18, 277, 2, 18, 77, 3560 }, // U+204A
-    { 17, 31, 319, 3, 26, 132, 3637 }, // U+204B
-    { 18, 17, 341, 1, 18, 77, 3769 }, // U+204C
-    { 18, 17, 341, 2, 18, 77, 3846 }, // U+204D
-    { 17, 16, 294, -1, 9, 68, 3923 }, // U+204E
-    { 7, 24, 137, 1, 19, 42, 3991 }, // U+204F
-    { 22, 35, 289, -2, 27, 193, 4033 }, // U+2050
-    { 19, 33, 294, 0, 26, 157, 4226 }, // U+2051
-    { 13, 26, 198, 0, 25, 85, 4383 }, // U+2052
-    { 29, 6, 533, 3, 13, 44, 4468 }, // U+2053
-    { 18, 8, 289, -3, 0, 36, 4512 }, // U+2054
-    { 18, 18, 305, 0, 17, 81, 4548 }, // U+2055
-    { 15, 26, 276, 1, 25, 98, 4629 }, // U+2056
-    { 25, 9, 387, 2, 24, 57, 4727 }, // U+2057
-    { 25, 26, 438, 1, 25, 163, 4784 }, // U+2058
-    { 25, 26, 442, 1, 25, 163, 4947 }, // U+2059
-    { 5, 26, 118, 1, 25, 33, 5110 }, // U+205A
-    { 20, 26, 349, 1, 25, 130, 5143 }, // U+205B
-    { 25, 26, 424, 1, 25, 163, 5273 }, // U+205C
-    { 5, 25, 143, 2, 24, 32, 5436 }, // U+205D
-    { 5, 26, 143, 3, 25, 33, 5468 }, // U+205E
-    { 0, 0, 118, 0, 0, 0, 5501 }, // U+205F
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2060
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2061
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2062
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2063
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2064
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2066
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2067
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2068
-    { 0, 0, 320, 0, 0, 0, 5501 }, // U+2069
-    { 8, 28, 0, -4, 23, 56, 5501 }, // U+206A
-    { 8, 28, 0, -4, 23, 56, 5557 }, // U+206B
-    { 8, 28, 0, -4, 23, 56, 5613 }, // U+206C
-    { 8, 29, 0, -4, 24, 58, 5669 }, // U+206D
-    { 8, 28, 0, -4, 23, 56, 5727 }, // U+206E
-    { 8, 28, 0, -4, 23, 56, 5783 }, // U+206F
+    { 15, 4, 256, 0, 11, 15, 7326 }, // U+2013
+    { 31, 4, 512, 0, 11, 31, 7341 }, // U+2014
+    { 31, 4, 512, 0, 11, 31, 163 }, // U+2015
+    { 10, 35, 294, 5, 26, 88, 194 }, // U+2016
+    { 16, 8, 211, -4, 0, 32, 282 }, // U+2017
+    { 7, 9, 93, 2, 24, 16, 314 }, // U+2018
+    { 7, 9, 93, 2, 24, 16, 7372 }, // U+2019
+    { 7, 9, 130, -2, 4, 16, 330 }, // U+201A
+    { 5, 9, 93, 3, 24, 12, 346 }, // U+201B
+    { 13, 9, 191, 2, 24, 30, 7388 }, // U+201C
+    { 13, 9, 191, 2, 24, 30, 7418 }, // U+201D
+    { 14, 9, 227, -2, 4, 32, 358 }, // U+201E
+    { 10, 9, 191, 3, 24, 23, 390 }, // U+201F
+    { 13, 26, 251, 3, 26, 85, 413 }, // U+2020
+    { 16, 26, 251, 1, 26, 104, 498 }, // U+2021
+    { 8, 9, 201, 3, 17, 18, 602 }, // U+2022
+    { 11, 11, 196, 1, 18, 31, 620 }, // U+2023
+    { 5, 6, 267, 4, 5, 8, 651 }, // U+2024
+    { 14, 6, 270, 0, 5, 21, 659 }, // U+2025
+    { 22, 6, 410, 0, 5, 33, 7448 }, // U+2026
+    { 5, 6, 137, 2, 12, 8, 680 }, // U+2027
+    { 0, 0, 320, 0, 0, 0, 688 }, // U+2028
+    { 0, 0, 320, 0, 0, 0, 688 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 688 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 747 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 806 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 862 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 918 }, // U+202E
+    { 0, 0, 89, 0, 0, 0, 974 }, // U+202F
+    { 35, 26, 600, 2, 25, 228, 974 }, // U+2030
+    { 45, 26, 775, 2, 25, 293, 1202 }, // U+2031
+    { 8, 9, 117, 2, 24, 18, 1495 }, // U+2032
+    { 14, 9, 207, 2, 24, 32, 1513 }, // U+2033
+    { 19, 9, 298, 2, 24, 43, 1545 }, // U+2034
+    { 5, 9, 144, 4, 24, 12, 1588 }, // U+2035
+    { 11, 9, 226, 4, 24, 25, 1600 }, // U+2036
+    { 16, 9, 308, 4, 24, 36, 1625 }, // U+2037
+    { 13, 11, 213, -3, 3, 36, 1661 }, // U+2038
+    { 9, 15, 153, 1, 16, 34, 1697 }, // U+2039
+    { 9, 15, 153, 0, 16, 34, 1731 }, // U+203A
+    { 26, 26, 446, 1, 25, 169, 1765 }, // U+203B
+    { 17, 25, 263, 0, 24, 107, 1934 }, // U+203C
+    { 14, 26, 230, 2, 25, 91, 2041 }, // U+203D
+    { 15, 3, 210, 3, 28, 12, 2132 }, // U+203E
+    { 18, 7, 289, -2, -1, 32, 2144 }, // U+203F
+    { 18, 8, 289, 2, 27, 36, 2176 }, // U+2040
+    { 16, 22, 182, -4, 14, 88, 2212 }, // U+2041
+    { 36, 31, 596, 0, 26, 279, 2300 }, // U+2042
+    { 9, 4, 153, 0, 11, 9, 2579 }, // U+2043
+    { 21, 24, 69, -8, 24, 126, 2588 }, // U+2044
+    { 14, 30, 155, -1, 24, 105, 2714 }, // U+2045
+    { 14, 30, 155, -3, 24, 105, 2819 }, // U+2046
+    { 28, 26, 459, 2, 25, 182, 2924 }, // U+2047
+    { 22, 26, 368, 2, 25, 143, 3106 }, // U+2048
+    { 24, 26, 368, 0, 25, 156, 3249 }, // U+2049
+    { 17, 18, 277, 2, 18, 77, 3405 }, // U+204A
+    { 17, 31, 319, 3, 26, 132, 3482 }, // U+204B
+    { 18, 17, 341, 1, 18, 77, 3614 }, // U+204C
+    { 18, 17, 341, 2, 18, 77, 3691 }, // U+204D
+    { 17, 16, 294, -1, 9, 68, 3768 }, // U+204E
+    { 7, 24, 137, 1, 19, 42, 3836 }, // U+204F
+    { 22, 35, 289, -2, 27, 193, 3878 }, // U+2050
+    { 19, 33, 294, 0, 26, 157, 4071 }, // U+2051
+    { 13, 26, 198, 0, 25, 85, 4228 }, // U+2052
+    { 29, 6, 533, 3, 13, 44, 4313 }, // U+2053
+    { 18, 8, 289, -3, 0, 36, 4357 }, // U+2054
+    { 18, 18, 305, 0, 17, 81, 4393 }, // U+2055
+    { 15, 26, 276, 1, 25, 98, 4474 }, // U+2056
+    { 25, 9, 387, 2, 24, 57, 4572 }, // U+2057
+    { 25, 26, 438, 1, 25, 163, 4629 }, // U+2058
+    { 25, 26, 442, 1, 25, 163, 4792 }, // U+2059
+    { 5, 26, 118, 1, 25, 33, 4955 }, // U+205A
+    { 20, 26, 349, 1, 25, 130, 4988 }, // U+205B
+    { 25, 26, 424, 1, 25, 163, 5118 }, // U+205C
+    { 5, 25, 143, 2, 24, 32, 5281 }, // U+205D
+    { 5, 26, 143, 3, 25, 33, 5313 }, // U+205E
+    { 0, 0, 118, 0, 0, 0, 5346 }, // U+205F
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2060
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2061
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2062
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2063
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2064
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2066
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2067
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2068
+    { 0, 0, 320, 0, 0, 0, 5346 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 5346 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 5402 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 5458 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 5514 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 5572 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 5628 }, // U+206F
     { 11, 16, 188, 3, 29, 44, 0 }, // U+2070
     { 6, 16, 119, 2, 25, 24, 44 }, // U+2071
     { 12, 16, 188, 2, 29, 48, 68 }, // U+2074
@@ -3642,13 +3646,13 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 22, 28, 313, -1, 28, 154, 4238 }, // U+20BE
     { 18, 32, 294, 1, 28, 144, 4392 }, // U+20BF
     { 10, 4, 167, 0, 11, 10, 0 }, // U+2212
-    { 30, 34, 340, -4, 26, 255, 0 }, // U+FB00
-    { 24, 34, 307, -4, 26, 204, 255 }, // U+FB01
-    { 24, 34, 307, -4, 26, 204, 459 }, // U+FB02
-    { 35, 34, 478, -4, 26, 298, 663 }, // U+FB03
-    { 35, 34, 478, -4, 26, 298, 961 }, // U+FB04
-    { 27, 34, 328, -5, 26, 230, 1259 }, // U+FB05
-    { 27, 27, 407, 0, 26, 183, 1489 }, // U+FB06
+    { 30, 34, 340, -4, 26, 255, 7481 }, // U+FB00
+    { 24, 34, 307, -4, 26, 204, 7736 }, // U+FB01
+    { 24, 34, 307, -4, 26, 204, 7940 }, // U+FB02
+    { 35, 34, 478, -4, 26, 298, 8144 }, // U+FB03
+    { 35, 34, 478, -4, 26, 298, 8442 }, // U+FB04
+    { 27, 34, 328, -5, 26, 230, 0 }, // U+FB05
+    { 27, 27, 407, 0, 26, 183, 230 }, // U+FB06
     { 31, 32, 533, 1, 26, 248, 0 }, // U+FFFD
 };
 
@@ -3656,8 +3660,7 @@ static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3665,8 +3668,7 @@ static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3676,19 +3678,57 @@ static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
 };
 
 static const EpdFontGroup notosans_16_italicGroups[] = {
-    { 0, 4356, 10060, 97, 0 },
-    { 4356, 3765, 11853, 96, 97 },
-    { 8121, 4744, 18698, 128, 193 },
-    { 12865, 4756, 16508, 96, 321 },
-    { 17621, 1581, 2456, 112, 417 },
-    { 19202, 12148, 36677, 256, 529 },
-    { 31350, 2777, 15572, 90, 785 },
-    { 34127, 2646, 6453, 111, 875 },
-    { 36773, 1034, 1688, 42, 986 },
-    { 37807, 2551, 4815, 32, 1028 },
-    { 40358, 14, 12, 1, 1060 },
-    { 40372, 583, 1719, 7, 1061 },
-    { 40955, 139, 256, 1, 1068 },
+    { 0, 3832, 9510, 83, 2 },
+    { 3832, 1059, 2151, 26, 0 },
+    { 4891, 3752, 11718, 95, 97 },
+    { 8643, 4744, 18698, 128, 193 },
+    { 13387, 4756, 16508, 96, 321 },
+    { 18143, 1581, 2456, 112, 417 },
+    { 19724, 12148, 36677, 256, 529 },
+    { 31872, 2777, 15572, 90, 785 },
+    { 34649, 2559, 6279, 105, 875 },
+    { 37208, 1034, 1688, 42, 986 },
+    { 38242, 2551, 4815, 32, 1028 },
+    { 40793, 14, 12, 1, 1060 },
+    { 40807, 212, 427, 2, 1066 },
+    { 41019, 139, 256, 1, 1068 },
+};
+
+static const uint16_t notosans_16_italicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_16_italicKernLeftClasses[] = {
@@ -4740,18 +4780,81 @@ static const EpdLigaturePair notosans_16_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_16_italicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 1, 0 }, { 0x0003, 0, 1 }, { 0x0004, 2, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 3, 3 }, { 0x0009, 2, 2 }, // U+0020
+    { 0x000A, 4, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 13, 0 }, { 0x002E, 14, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 15, 0 }, { 0x0033, 10, 10 }, { 0x0034, 16, 0 }, { 0x0035, 0, 13 }, { 0x0036, 17, 14 }, { 0x0037, 18, 15 }, { 0x0038, 19, 16 }, { 0x0039, 19, 16 }, // U+0050
+    { 0x003A, 13, 17 }, { 0x003B, 20, 18 }, { 0x003C, 21, 19 }, { 0x003D, 4, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 22, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 20 }, { 0x0044, 24, 0 }, { 0x0045, 25, 21 }, { 0x0046, 0, 21 }, { 0x0047, 24, 21 }, { 0x0048, 26, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 0, 0 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 27, 0 }, { 0x004E, 0, 0 }, { 0x004F, 0, 25 }, { 0x0050, 0, 25 }, { 0x0051, 24, 21 }, // U+0068
+    { 0x0052, 24, 25 }, { 0x0053, 0, 21 }, { 0x0054, 28, 25 }, { 0x0055, 0, 26 }, { 0x0056, 29, 27 }, { 0x0057, 0, 25 }, { 0x0058, 30, 28 }, { 0x0059, 30, 28 }, // U+0070
+    { 0x005A, 27, 0 }, { 0x005B, 30, 28 }, { 0x005C, 0, 29 }, { 0x005D, 4, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 31, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 32, 30 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 33, 31 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 34, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 32 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 18, 15 }, { 0x009B, 18, 15 }, { 0x009C, 18, 15 }, { 0x009D, 18, 15 }, { 0x009E, 20, 18 }, { 0x009F, 15, 0 }, { 0x00A0, 0, 24 }, // U+00D8
+    { 0x00A1, 23, 21 }, { 0x00A2, 23, 20 }, { 0x00A3, 23, 20 }, { 0x00A4, 23, 20 }, { 0x00A5, 23, 20 }, { 0x00A6, 23, 20 }, { 0x00A7, 24, 20 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 24, 21 }, { 0x00AA, 24, 21 }, { 0x00AB, 24, 21 }, { 0x00AC, 24, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 0, 0 }, { 0x00B0, 35, 0 }, // U+00E8
+    { 0x00B1, 24, 0 }, { 0x00B2, 0, 25 }, { 0x00B3, 24, 21 }, { 0x00B4, 24, 21 }, { 0x00B5, 24, 21 }, { 0x00B6, 24, 21 }, { 0x00B7, 24, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 30, 28 }, { 0x00BF, 24, 0 }, { 0x00C0, 30, 28 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 23, 20 }, { 0x00C3, 7, 9 }, { 0x00C4, 23, 20 }, { 0x00C5, 7, 9 }, { 0x00C6, 23, 20 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 36, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 24, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 24, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 24, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 24, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 24, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 33 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 37, 34 }, { 0x00EB, 0, 0 }, { 0x00EC, 35, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 38, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 24 }, { 0x00F7, 13, 0 }, { 0x00F8, 27, 0 }, // U+0130
+    { 0x00F9, 27, 25 }, { 0x00FA, 14, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 14, 0 }, { 0x00FD, 0, 0 }, { 0x00FE, 14, 0 }, { 0x00FF, 36, 0 }, { 0x0100, 14, 0 }, // U+0138
+    { 0x0101, 0, 0 }, { 0x0102, 14, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 0, 25 }, { 0x0106, 0, 0 }, { 0x0107, 0, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 25 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 25 }, { 0x010D, 10, 10 }, { 0x010E, 24, 21 }, { 0x010F, 10, 10 }, { 0x0110, 24, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 24, 21 }, { 0x0113, 11, 10 }, { 0x0114, 24, 21 }, { 0x0115, 0, 0 }, { 0x0116, 28, 25 }, { 0x0117, 0, 0 }, { 0x0118, 28, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 28, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 26 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 26 }, { 0x0123, 17, 14 }, { 0x0124, 29, 27 }, { 0x0125, 17, 14 }, { 0x0126, 39, 27 }, { 0x0127, 17, 14 }, { 0x0128, 29, 27 }, // U+0160
+    { 0x0129, 18, 15 }, { 0x012A, 0, 25 }, { 0x012B, 18, 15 }, { 0x012C, 0, 25 }, { 0x012D, 18, 15 }, { 0x012E, 0, 25 }, { 0x012F, 18, 15 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 18, 15 }, { 0x0132, 0, 25 }, { 0x0133, 18, 15 }, { 0x0134, 0, 25 }, { 0x0135, 19, 16 }, { 0x0136, 30, 28 }, { 0x0137, 20, 18 }, { 0x0138, 30, 28 }, // U+0170
+    { 0x0139, 20, 18 }, { 0x013A, 21, 19 }, { 0x013B, 0, 29 }, { 0x013C, 21, 19 }, { 0x013D, 0, 29 }, { 0x013E, 21, 19 }, { 0x013F, 0, 29 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 35 }, { 0x0214, 45, 0 }, { 0x0215, 46, 36 }, { 0x0216, 47, 37 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 48, 38 }, { 0x021A, 44, 39 }, { 0x021B, 44, 0 }, { 0x021C, 49, 35 }, { 0x021D, 50, 0 }, { 0x021E, 0, 0 }, { 0x021F, 51, 40 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 52, 41 }, { 0x0222, 53, 0 }, { 0x0223, 54, 0 }, { 0x0224, 45, 0 }, { 0x0225, 55, 42 }, { 0x0226, 0, 0 }, { 0x0227, 50, 43 }, { 0x0228, 54, 44 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 50, 0 }, { 0x022C, 0, 39 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 56, 36 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 57, 0 }, { 0x0232, 46, 36 }, { 0x0233, 45, 35 }, { 0x0234, 51, 40 }, { 0x0235, 58, 45 }, { 0x0236, 50, 43 }, { 0x0237, 55, 0 }, { 0x0238, 0, 46 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 55, 0 }, { 0x023B, 44, 35 }, { 0x023C, 0, 0 }, { 0x023D, 44, 0 }, { 0x023E, 56, 44 }, { 0x023F, 56, 0 }, { 0x0240, 0, 47 }, // U+0428
+    { 0x0241, 59, 48 }, { 0x0242, 60, 49 }, { 0x0243, 61, 48 }, { 0x0244, 62, 50 }, { 0x0245, 63, 51 }, { 0x0246, 62, 48 }, { 0x0247, 64, 52 }, { 0x0248, 61, 50 }, // U+0430
+    { 0x0249, 59, 53 }, { 0x024A, 59, 53 }, { 0x024B, 65, 54 }, { 0x024C, 59, 55 }, { 0x024D, 59, 54 }, { 0x024E, 59, 54 }, { 0x024F, 66, 48 }, { 0x0250, 67, 54 }, // U+0438
+    { 0x0251, 66, 54 }, { 0x0252, 64, 48 }, { 0x0253, 67, 54 }, { 0x0254, 68, 56 }, { 0x0255, 66, 48 }, { 0x0256, 65, 57 }, { 0x0257, 69, 53 }, { 0x0258, 59, 58 }, // U+0440
+    { 0x0259, 59, 53 }, { 0x025A, 69, 53 }, { 0x025B, 70, 59 }, { 0x025C, 59, 53 }, { 0x025D, 70, 53 }, { 0x025E, 66, 52 }, { 0x025F, 66, 54 }, { 0x0260, 59, 60 }, // U+0448
+    { 0x0261, 62, 48 }, { 0x0262, 62, 48 }, { 0x0263, 71, 61 }, { 0x0264, 62, 50 }, { 0x0265, 64, 48 }, { 0x0266, 72, 62 }, { 0x0267, 0, 0 }, { 0x0268, 73, 63 }, // U+0450
+    { 0x0269, 74, 64 }, { 0x026A, 70, 55 }, { 0x026B, 70, 54 }, { 0x026C, 67, 61 }, { 0x026D, 65, 54 }, { 0x026E, 59, 53 }, { 0x026F, 75, 65 }, { 0x0270, 59, 53 }, // U+0458
+};
+
 static const EpdFontData notosans_16_italic = {
     notosans_16_italicBitmaps,
     notosans_16_italicGlyphs,
     notosans_16_italicIntervals,
-    20,
+    18,
     45,
     36,
     -10,
     true,
     notosans_16_italicGroups,
-    13,
-    nullptr,
+    14,
+    notosans_16_italicGlyphToGroup,
     notosans_16_italicKernLeftClasses,
     notosans_16_italicKernRightClasses,
     notosans_16_italicKernMatrix,
@@ -4761,4 +4864,8 @@ static const EpdFontData notosans_16_italic = {
     83,
     notosans_16_italicLigaturePairs,
     5,
+    notosans_16_italicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2207 +3,2212 @@
  * name: notosans_16_regular
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_regularBitmaps[35113] = {
-    0xBD, 0x5A, 0x3D, 0x8C, 0xE5, 0x56, 0x15, 0xBE, 0xB6, 0x77, 0xD7, 0x12, 0x16, 0x72, 0x8A, 0x2C,
-    0x44, 0x6C, 0xE1, 0x26, 0x55, 0x22, 0xE2, 0x36, 0xC5, 0x8E, 0xAF, 0xA3, 0x88, 0x3E, 0xC5, 0x4E,
-    0x56, 0x62, 0x8A, 0xD0, 0x12, 0x09, 0x4D, 0x93, 0x82, 0x62, 0xE6, 0xD9, 0x90, 0x82, 0x22, 0x05,
-    0x2B, 0xA1, 0x20, 0xA4, 0x34, 0x14, 0x09, 0x82, 0xB7, 0xC5, 0x36, 0x14, 0x20, 0xBD, 0x79, 0xB6,
-    0x40, 0xA2, 0xA1, 0x88, 0x41, 0x42, 0x94, 0x38, 0x62, 0xB7, 0x48, 0x28, 0x62, 0x81, 0x23, 0xFC,
-    0x36, 0xB6, 0x2F, 0xDF, 0x77, 0xAE, 0xFD, 0xDE, 0xCC, 0xEE, 0xEC, 0x6F, 0x56, 0xF8, 0xF9, 0x1E,
-    0xCF, 0xF3, 0xBB, 0x3F, 0xE7, 0x9E, 0xFF, 0x73, 0xEE, 0x68, 0xA5, 0xCF, 0xF9, 0x24, 0xEA, 0x95,
-    0xE9, 0xF3, 0x6D, 0x75, 0x41, 0xF1, 0xD2, 0xAA, 0x48, 0x8B, 0x3C, 0xC3, 0xB7, 0x55, 0x50, 0x4D,
-    0xB7, 0x5F, 0xE2, 0x3E, 0xC2, 0xED, 0xF1, 0x7E, 0xD5, 0xCB, 0x95, 0xFA, 0xAD, 0x53, 0xA3, 0x73,
-    0xEB, 0x11, 0x36, 0x5E, 0xA5, 0x94, 0xD3, 0x78, 0xA5, 0x52, 0x6E, 0xE3, 0x13, 0xD6, 0x01, 0xA0,
-    0x57, 0x05, 0xB9, 0xFA, 0xDA, 0xCD, 0xBB, 0xB7, 0x3E, 0x4B, 0x43, 0x83, 0x2B, 0xBF, 0x78, 0xF0,
-    0xB7, 0xC3, 0xFD, 0x54, 0x05, 0x79, 0x8C, 0x41, 0x61, 0x9A, 0x08, 0xDC, 0x03, 0x8C, 0xD4, 0x55,
-    0xC0, 0x58, 0x1D, 0x61, 0x79, 0x74, 0x1C, 0x27, 0xA8, 0xF6, 0x54, 0x8B, 0xF7, 0x57, 0x55, 0x03,
-    0x78, 0xE4, 0x10, 0xAE, 0x5C, 0xC2, 0xCE, 0xB5, 0x8B, 0x57, 0xF3, 0xE2, 0xCA, 0x41, 0xC3, 0x6A,
-    0xD2, 0xAE, 0xDC, 0x50, 0xBE, 0x31, 0x55, 0x64, 0x4C, 0x93, 0x7D, 0xF0, 0xF3, 0xE6, 0x04, 0xEF,
-    0xFA, 0xA9, 0x0D, 0x68, 0xD9, 0x7B, 0xB9, 0x8A, 0x4D, 0x8E, 0x3E, 0x9D, 0x52, 0x19, 0xFE, 0x08,
-    0x4C, 0xA3, 0x82, 0x9F, 0x74, 0x18, 0xDB, 0xA3, 0xAD, 0xF8, 0x4C, 0x83, 0x1F, 0xF5, 0xE3, 0xC1,
-    0xAD, 0x16, 0x68, 0x54, 0x19, 0x31, 0xB9, 0x92, 0xEF, 0xE6, 0x67, 0xB3, 0x97, 0x3B, 0x72, 0x07,
-    0x2A, 0x34, 0x25, 0x90, 0x57, 0xF1, 0xEB, 0x35, 0x30, 0x56, 0x09, 0x10, 0x5D, 0x11, 0xF7, 0x86,
-    0xD8, 0x1F, 0x01, 0xCD, 0x46, 0x1E, 0x24, 0x0C, 0x1E, 0x61, 0x2E, 0x8F, 0x48, 0x36, 0xD6, 0x26,
-    0x97, 0x6E, 0xA8, 0x3D, 0xA7, 0x59, 0xE9, 0x5E, 0xBD, 0xE2, 0x36, 0xED, 0xBA, 0x50, 0xD1, 0x07,
-    0x7F, 0x6D, 0xDA, 0x30, 0x0D, 0xCC, 0xBB, 0x7F, 0x69, 0xC2, 0xDC, 0xF9, 0x7D, 0xF8, 0x87, 0x86,
-    0xC4, 0x8C, 0xDC, 0x9A, 0x13, 0x24, 0x9E, 0x3C, 0x8E, 0xEC, 0xA3, 0x93, 0x97, 0x6E, 0xE3, 0xB2,
-    0x8B, 0x57, 0x39, 0x18, 0xA0, 0xF0, 0x57, 0x17, 0xA5, 0x44, 0x2B, 0x1B, 0xC9, 0x4D, 0x15, 0x75,
-    0x82, 0xAB, 0x93, 0xCE, 0x58, 0x47, 0x86, 0x7F, 0x16, 0x06, 0x34, 0x74, 0xC6, 0x03, 0xE0, 0xE8,
-    0xB5, 0x0E, 0xFA, 0x00, 0xCD, 0x7E, 0x07, 0xF9, 0xC6, 0xE9, 0x3C, 0xD2, 0x7F, 0x88, 0x48, 0x6D,
-    0x5D, 0x70, 0xDB, 0xD1, 0xC0, 0x19, 0x32, 0xBE, 0x76, 0xCD, 0xA0, 0xBC, 0x3A, 0x68, 0xB3, 0xDC,
-    0xAF, 0xA2, 0x32, 0xAA, 0xC3, 0x52, 0xA7, 0x7E, 0x07, 0x88, 0x59, 0x75, 0xAA, 0x49, 0x5B, 0x59,
-    0xBE, 0x27, 0x0C, 0x7A, 0x15, 0x97, 0x4A, 0x8F, 0x2A, 0xDC, 0x5C, 0x37, 0x18, 0x61, 0x4C, 0x17,
-    0xD6, 0xC0, 0x21, 0xF7, 0x7A, 0xE5, 0xBC, 0x41, 0xC6, 0xF2, 0x3A, 0x3A, 0x3A, 0x7A, 0x15, 0x22,
-    0xB9, 0xC2, 0xC2, 0x8D, 0x5F, 0x85, 0x65, 0x94, 0xC7, 0x29, 0xA5, 0x74, 0x81, 0xCF, 0xC9, 0xA9,
-    0x0F, 0xBF, 0xF3, 0x7D, 0x9C, 0x87, 0x65, 0x58, 0xF9, 0xB5, 0x4B, 0xA4, 0x8F, 0xD5, 0x85, 0x15,
-    0xDE, 0x45, 0x69, 0x58, 0xFA, 0xB5, 0xD7, 0xB8, 0xDC, 0x54, 0x8F, 0xCF, 0x3C, 0x60, 0xFE, 0x9C,
-    0xA8, 0x81, 0xEF, 0x5D, 0xAE, 0xD1, 0x04, 0x55, 0x98, 0x6B, 0x0C, 0x7D, 0xCE, 0x12, 0xC8, 0xAF,
-    0x6D, 0xA3, 0x4C, 0xA1, 0xBD, 0xE8, 0x95, 0x17, 0xB3, 0x9F, 0xFD, 0x69, 0x2C, 0x20, 0x07, 0xDF,
-    0x2A, 0xC6, 0x8F, 0x54, 0x88, 0x8D, 0x6B, 0x30, 0xF7, 0x04, 0x9B, 0xEC, 0xE3, 0xDC, 0x6B, 0xC3,
-    0x4A, 0x68, 0xFF, 0x9C, 0x43, 0xA1, 0x57, 0x8F, 0x00, 0x19, 0xA6, 0x49, 0x05, 0x5C, 0xBE, 0xFE,
-    0xC5, 0xFE, 0xA3, 0x46, 0x28, 0xE0, 0x13, 0x92, 0x08, 0x25, 0x89, 0x90, 0x40, 0xA0, 0x8E, 0x88,
-    0x26, 0x39, 0x97, 0xE2, 0xDE, 0xDF, 0x3F, 0xA3, 0xAC, 0x0A, 0x2A, 0xAC, 0xB0, 0x3B, 0x45, 0xD9,
-    0x23, 0x0B, 0x9D, 0x56, 0x98, 0xA9, 0xA8, 0xA1, 0x01, 0xB6, 0x13, 0x52, 0x88, 0x72, 0x6A, 0x99,
-    0x48, 0x05, 0xF6, 0x2C, 0xDD, 0x14, 0xF8, 0xEC, 0x4E, 0x5D, 0xFD, 0x87, 0x74, 0xB5, 0x57, 0x0C,
-    0x91, 0x52, 0xD0, 0x09, 0xE5, 0x51, 0x70, 0x82, 0xDA, 0xE9, 0xD9, 0xF9, 0x84, 0xBD, 0xC1, 0x8D,
-    0x54, 0x98, 0xA2, 0x88, 0xAE, 0x05, 0x51, 0xFE, 0x30, 0x30, 0xF5, 0x93, 0x61, 0x32, 0x01, 0xA6,
-    0x5A, 0x63, 0x52, 0xA0, 0xE5, 0x6D, 0xAE, 0x74, 0x5C, 0x08, 0x08, 0xC5, 0x22, 0xAD, 0x14, 0x11,
-    0xEC, 0x04, 0x92, 0x58, 0xD4, 0xDE, 0x97, 0x75, 0xF4, 0xCF, 0x5A, 0xBF, 0x5E, 0x7F, 0x1D, 0x6F,
-    0x9E, 0xE2, 0x16, 0x1A, 0x0E, 0x50, 0x7B, 0x53, 0xEA, 0x3B, 0x87, 0x4D, 0x02, 0xF9, 0xBF, 0x00,
-    0x76, 0x4E, 0xF4, 0x98, 0x9A, 0x33, 0xD1, 0xC5, 0x6F, 0x2C, 0x3D, 0x34, 0xB0, 0x58, 0xE3, 0x15,
-    0x5E, 0x07, 0xC4, 0x2A, 0xBF, 0xEF, 0x6B, 0xB1, 0x5C, 0x2E, 0x29, 0x28, 0x6C, 0x56, 0xE3, 0x8A,
-    0x91, 0xCA, 0x86, 0x4D, 0x60, 0x99, 0x16, 0xFC, 0x71, 0x39, 0xB7, 0x12, 0x0D, 0x3A, 0xD9, 0x02,
-    0xBE, 0x93, 0xC5, 0x03, 0xAC, 0xF4, 0x76, 0x81, 0xA5, 0xCC, 0xA0, 0xA6, 0xBD, 0xAB, 0x2B, 0x32,
-    0x62, 0x14, 0x9D, 0x53, 0x13, 0x37, 0x4E, 0x81, 0x0C, 0x74, 0x71, 0x06, 0xB5, 0x4E, 0xD1, 0xAF,
-    0xE0, 0x88, 0xC8, 0x8C, 0xC0, 0xF3, 0xB2, 0xA8, 0xBA, 0x4C, 0xEA, 0x11, 0x84, 0x04, 0x31, 0xC1,
-    0x9E, 0xEC, 0xAE, 0xA7, 0x9D, 0x06, 0xF0, 0x2B, 0x80, 0x10, 0x56, 0x0F, 0x9C, 0xEE, 0xC9, 0xE6,
-    0x9E, 0xE2, 0xD0, 0x5B, 0x1B, 0xE0, 0x57, 0x00, 0xB0, 0x27, 0xA2, 0xBE, 0xBD, 0xC8, 0x6E, 0x2B,
-    0xE0, 0xA5, 0xE5, 0x72, 0xFC, 0xE5, 0x84, 0xF8, 0xFD, 0x00, 0xFB, 0xAD, 0x62, 0xA0, 0x12, 0xF3,
-    0x39, 0xE1, 0x39, 0xB7, 0x64, 0x6E, 0x6F, 0xDF, 0x50, 0x99, 0xB5, 0xF2, 0xD5, 0x05, 0x15, 0x51,
-    0x48, 0x3B, 0x75, 0x1F, 0x07, 0xD8, 0xDC, 0x2E, 0x05, 0x07, 0x36, 0xAF, 0x65, 0x15, 0xB5, 0x26,
-    0xA6, 0xC5, 0xBE, 0x3C, 0xCB, 0xA2, 0xC3, 0x6F, 0x11, 0x41, 0x71, 0xE7, 0x9A, 0x72, 0x49, 0x34,
-    0x0A, 0xB1, 0x48, 0xB0, 0xB0, 0x0C, 0xA6, 0x40, 0x59, 0x21, 0x56, 0xFA, 0x12, 0xE8, 0xA2, 0x63,
-    0x18, 0x7A, 0xBD, 0x3E, 0xC0, 0x8E, 0x6A, 0xD0, 0x54, 0xE7, 0xA7, 0xC4, 0x35, 0x3A, 0x05, 0x20,
-    0x90, 0x31, 0x8C, 0x08, 0x7E, 0x03, 0x6B, 0xD7, 0xCA, 0x1B, 0xFC, 0x9E, 0xFC, 0x68, 0x94, 0xB8,
-    0x0D, 0x91, 0x45, 0xE1, 0xF1, 0x0E, 0xCC, 0xFC, 0xD8, 0x32, 0x94, 0x92, 0x33, 0x61, 0x53, 0x6F,
-    0xB1, 0xC9, 0xE7, 0x6E, 0x8B, 0x59, 0x0C, 0x9C, 0x7B, 0xFA, 0x6E, 0x31, 0x8F, 0xB7, 0x7D, 0xD7,
-    0x67, 0x64, 0x64, 0xD2, 0x42, 0xA8, 0x84, 0x43, 0x84, 0xFC, 0xCD, 0x75, 0xF0, 0xA8, 0x42, 0x27,
-    0x41, 0xD7, 0x2A, 0xD1, 0xA4, 0x49, 0x0B, 0x0A, 0x14, 0x78, 0x39, 0x50, 0xAE, 0x0A, 0x78, 0x28,
-    0x0C, 0x13, 0xE3, 0x01, 0xE5, 0xED, 0x82, 0x0E, 0xC3, 0x9C, 0x91, 0xEB, 0x08, 0x0D, 0x44, 0x1F,
-    0xC3, 0x2D, 0x80, 0x52, 0xCA, 0x2C, 0x2D, 0x1C, 0x9C, 0x67, 0x84, 0xC4, 0xE6, 0x86, 0xB2, 0x86,
-    0x5A, 0xAE, 0xC3, 0x81, 0xF6, 0x1F, 0x93, 0x06, 0x9B, 0xC3, 0x46, 0x45, 0x25, 0xF4, 0x00, 0x0A,
-    0x22, 0xA2, 0x92, 0x90, 0xC5, 0x34, 0xD9, 0xA0, 0xBC, 0x00, 0x7E, 0x15, 0x77, 0x80, 0x49, 0x1D,
-    0x93, 0x86, 0x5F, 0x1C, 0x18, 0x4E, 0x0A, 0xBE, 0x14, 0xDD, 0x4E, 0x94, 0x93, 0xFB, 0xE9, 0x07,
-    0xC4, 0x2F, 0x38, 0x50, 0x88, 0x80, 0x0E, 0x38, 0x30, 0xB7, 0xF1, 0xEA, 0x1A, 0xDA, 0x05, 0x6B,
-    0xF5, 0x52, 0xAD, 0xCE, 0xBB, 0x76, 0x16, 0xD1, 0x01, 0x5E, 0x71, 0x15, 0x57, 0x42, 0xD0, 0xFB,
-    0xAE, 0x88, 0x76, 0x35, 0xE7, 0xE6, 0x8F, 0x61, 0x31, 0x3B, 0xB5, 0xDD, 0x9A, 0xF2, 0x29, 0x35,
-    0x19, 0x9D, 0x01, 0xE9, 0x95, 0xD1, 0x23, 0x8C, 0xA7, 0xFF, 0xD0, 0xD5, 0xF4, 0xBB, 0x8A, 0x3B,
-    0x11, 0x43, 0x7E, 0x8F, 0x44, 0x47, 0x0B, 0xE2, 0x18, 0x88, 0x3C, 0x48, 0x07, 0x3F, 0x3D, 0x85,
-    0x18, 0x05, 0x45, 0xCF, 0xB6, 0xE1, 0xDE, 0x0B, 0x4A, 0xB5, 0xBC, 0xB7, 0xCB, 0x3B, 0xDB, 0x79,
-    0x62, 0xEB, 0x6F, 0xCF, 0xFB, 0xD3, 0xD9, 0xAE, 0x16, 0x8C, 0x34, 0x39, 0x95, 0xF5, 0xD1, 0x2E,
-    0xF9, 0xA5, 0xBB, 0x79, 0x82, 0x77, 0xCE, 0x2C, 0x76, 0xC9, 0xB4, 0xD4, 0x67, 0xA5, 0x3F, 0x2A,
-    0xF2, 0x17, 0x45, 0xE0, 0xFC, 0xCA, 0x3A, 0x8A, 0xD3, 0x1E, 0x00, 0x0C, 0x85, 0x6D, 0x51, 0x7E,
-    0x3B, 0x7D, 0xA5, 0xF9, 0x60, 0x1C, 0x36, 0xB5, 0xE7, 0x4F, 0x4D, 0x48, 0x07, 0x61, 0xA6, 0x36,
-    0xCE, 0xBF, 0x39, 0xB7, 0x3E, 0x14, 0xD4, 0x0C, 0x95, 0xC6, 0x33, 0xEF, 0x1F, 0x52, 0x5D, 0x6B,
-    0x04, 0x07, 0xD6, 0x96, 0x41, 0x18, 0x3A, 0x91, 0x79, 0x88, 0xFE, 0x45, 0xC8, 0xBF, 0x5F, 0x32,
-    0xA0, 0x40, 0x78, 0x14, 0x82, 0xDD, 0x5D, 0x84, 0xE5, 0x11, 0x08, 0xC4, 0xE0, 0x4D, 0xA2, 0x8E,
-    0x12, 0x30, 0x08, 0x8F, 0x3D, 0xF8, 0x34, 0x79, 0x34, 0x74, 0x86, 0xF6, 0xB1, 0xE2, 0xCB, 0x63,
-    0xD5, 0xED, 0xA1, 0xCB, 0xA0, 0x60, 0xCC, 0x4F, 0x5C, 0xE3, 0xD5, 0xB1, 0xD2, 0x9F, 0x7F, 0xFC,
-    0x79, 0x19, 0xA9, 0x70, 0xF4, 0x0C, 0x55, 0xE2, 0x0D, 0x7C, 0xB8, 0x49, 0xAA, 0x5A, 0x6B, 0x91,
-    0x1E, 0xAD, 0xCB, 0x8F, 0x37, 0xDF, 0xB9, 0x95, 0x93, 0xD9, 0x46, 0x88, 0xFA, 0xB2, 0xF9, 0x70,
-    0x2B, 0x93, 0x34, 0x11, 0xE4, 0xAA, 0x08, 0x90, 0xB0, 0xD9, 0xF9, 0x2F, 0xD5, 0xD9, 0xFB, 0x37,
-    0xB5, 0xD5, 0xFB, 0x44, 0x84, 0xB4, 0x12, 0x0B, 0x5B, 0x9E, 0x88, 0x86, 0x2F, 0xC4, 0xE0, 0x58,
-    0x7B, 0x07, 0x33, 0x02, 0x81, 0x26, 0xE9, 0xC4, 0x49, 0x42, 0x61, 0x61, 0xA0, 0xA1, 0x34, 0xD0,
-    0x5B, 0xEF, 0xEE, 0xF2, 0x66, 0x4B, 0x62, 0x83, 0x04, 0xB6, 0x43, 0x54, 0x52, 0xD5, 0x39, 0x44,
-    0xDB, 0xE1, 0xE9, 0x42, 0x26, 0xB4, 0x93, 0x17, 0xE6, 0x53, 0x5A, 0x20, 0x8C, 0x07, 0x60, 0x4C,
-    0x03, 0xBD, 0xC4, 0x2F, 0x05, 0x81, 0x3E, 0x0B, 0xD6, 0x00, 0x30, 0x15, 0x66, 0x59, 0x48, 0xE7,
-    0x94, 0xA0, 0xE5, 0x3B, 0x19, 0xA1, 0x53, 0x1A, 0x7B, 0xCE, 0x1A, 0x95, 0x33, 0x88, 0x09, 0x34,
-    0xDF, 0x19, 0x35, 0x2E, 0x6F, 0x0D, 0x76, 0x84, 0x11, 0x4F, 0x62, 0xA3, 0x5C, 0xFE, 0x09, 0x7B,
-    0xDE, 0x38, 0xE6, 0xB3, 0x5B, 0x95, 0x37, 0x28, 0x27, 0x0F, 0x49, 0x80, 0xB8, 0x54, 0xD6, 0x2F,
-    0x5A, 0xDF, 0xB4, 0xDE, 0x3A, 0xB7, 0xE1, 0xAC, 0x53, 0xD8, 0xBD, 0x5B, 0xEF, 0x1C, 0x19, 0x87,
-    0x69, 0x31, 0x8B, 0xA4, 0x68, 0xD0, 0xC9, 0x3A, 0xEF, 0x1F, 0x94, 0x34, 0xA8, 0x54, 0x79, 0x0A,
-    0x0D, 0xFC, 0xD8, 0x99, 0x9D, 0x33, 0x6E, 0x83, 0xE8, 0x13, 0x67, 0x52, 0x3D, 0xA0, 0x0F, 0xF3,
-    0x5A, 0x71, 0x13, 0xF4, 0xD8, 0xFD, 0xEC, 0xDC, 0x2C, 0x18, 0xB6, 0x60, 0xFB, 0x4E, 0xBA, 0x48,
-    0x67, 0x19, 0x16, 0x36, 0xD3, 0xF6, 0x61, 0x96, 0xC6, 0x65, 0x31, 0xCC, 0x0B, 0x6D, 0xC4, 0xC0,
-    0xD3, 0xE5, 0xD4, 0x4C, 0x00, 0xCE, 0xF1, 0x4B, 0xDB, 0x66, 0x96, 0xCB, 0x1C, 0x7D, 0x4A, 0xB6,
-    0x87, 0xF5, 0x63, 0x1B, 0x97, 0xCB, 0x1B, 0xD3, 0x9C, 0xF5, 0xE3, 0xCE, 0xFF, 0xA4, 0x6B, 0xCC,
-    0x6D, 0x72, 0x91, 0x34, 0xDB, 0x11, 0x09, 0x67, 0xEE, 0xDE, 0xEC, 0x3D, 0x48, 0xFC, 0x8B, 0x8C,
-    0x60, 0x45, 0xDA, 0xAC, 0x70, 0x3F, 0x80, 0x73, 0xCB, 0xDF, 0x90, 0x28, 0x46, 0x00, 0xDF, 0x65,
-    0xEC, 0xA2, 0xD9, 0x59, 0x93, 0x73, 0x9A, 0xAC, 0xD7, 0x08, 0xE0, 0x95, 0xA6, 0x6F, 0xD4, 0xAE,
-    0xB9, 0xF3, 0xA6, 0x91, 0x10, 0x81, 0x7A, 0x04, 0x23, 0x78, 0xF1, 0x0D, 0x86, 0xA1, 0x8E, 0xF0,
-    0xE6, 0xB1, 0x01, 0xF6, 0x79, 0x93, 0x19, 0x97, 0xB1, 0xE0, 0x89, 0xC6, 0xEE, 0x00, 0x72, 0x0A,
-    0x78, 0x3B, 0x7F, 0x43, 0x97, 0xFA, 0x34, 0x77, 0x4B, 0x67, 0x49, 0x7F, 0x89, 0xB0, 0x3E, 0x7C,
-    0x76, 0x77, 0x9C, 0xEF, 0x17, 0x0A, 0x01, 0x61, 0xD1, 0xC2, 0xDA, 0x91, 0x38, 0xA2, 0xDB, 0x99,
-    0xD5, 0xD6, 0x9E, 0xCB, 0x8A, 0x27, 0xEF, 0xAD, 0x1F, 0x05, 0xA7, 0x7A, 0xC6, 0x96, 0x3D, 0xC3,
-    0x87, 0x9E, 0xD4, 0xEE, 0x49, 0xFC, 0x91, 0x5A, 0xC1, 0xF0, 0x5B, 0x99, 0xF7, 0xA0, 0x81, 0x23,
-    0xC3, 0xA6, 0x9E, 0x4C, 0xEB, 0xC9, 0x48, 0x49, 0xB1, 0x30, 0x0B, 0x03, 0x68, 0x9F, 0xF3, 0xB9,
-    0x9C, 0x19, 0x5A, 0x3D, 0xEB, 0x77, 0x54, 0xAD, 0x1E, 0x53, 0x7C, 0x9E, 0xA4, 0x99, 0xD3, 0x62,
-    0x9D, 0xD3, 0x23, 0x31, 0xD8, 0xF0, 0x24, 0x80, 0xF5, 0x25, 0x6C, 0x82, 0x03, 0xA7, 0x13, 0x29,
-    0x7A, 0x7A, 0x00, 0x4D, 0x1D, 0xD4, 0xBA, 0x87, 0xCF, 0xD8, 0xD3, 0x3D, 0x6C, 0x1D, 0x72, 0x5F,
-    0xC4, 0x02, 0x9D, 0xEE, 0xA3, 0xDC, 0x69, 0x75, 0x1F, 0x96, 0x6E, 0xA3, 0x7B, 0xB8, 0x85, 0x5A,
-    0xF7, 0x48, 0x2F, 0x4B, 0xC0, 0x06, 0x49, 0x65, 0xEF, 0xB4, 0x08, 0xCF, 0xB0, 0x21, 0x98, 0xD7,
-    0x5E, 0xAD, 0x12, 0xC2, 0xC5, 0x31, 0xA1, 0xBD, 0xE1, 0x8B, 0x01, 0x61, 0x97, 0xB6, 0x10, 0xE6,
-    0x5E, 0x53, 0x6C, 0x57, 0x24, 0xDA, 0x8A, 0x38, 0xAD, 0x88, 0xCC, 0x0A, 0xC6, 0x4D, 0xAD, 0x68,
-    0x17, 0x56, 0x7D, 0x41, 0x00, 0x82, 0xAF, 0x7A, 0x68, 0xC4, 0x8A, 0xC4, 0x5E, 0xF5, 0xE0, 0xC4,
-    0xAA, 0x07, 0x4F, 0x56, 0xE4, 0xC2, 0x8A, 0xFC, 0x58, 0x91, 0xB0, 0x2B, 0x12, 0x76, 0xC5, 0xD8,
-    0x78, 0x45, 0xC2, 0x02, 0xA8, 0x81, 0x20, 0x23, 0x88, 0xB9, 0xA7, 0x90, 0xC0, 0x17, 0x0B, 0xD3,
-    0x6F, 0x1D, 0xED, 0xC6, 0x7A, 0xC0, 0x0A, 0x76, 0xEB, 0x4E, 0xD1, 0x29, 0xBF, 0x63, 0xA0, 0x4A,
-    0xC5, 0xC9, 0xC4, 0x7C, 0x32, 0x02, 0xA1, 0x81, 0x27, 0x73, 0xC3, 0x6A, 0x2D, 0xF1, 0x22, 0xF5,
-    0xCD, 0x6F, 0x6C, 0x38, 0xDB, 0x9F, 0x82, 0xC3, 0x16, 0xFA, 0x8D, 0xED, 0x69, 0x47, 0xD9, 0x19,
-    0xA8, 0xCD, 0x71, 0x1E, 0x55, 0x9C, 0x19, 0xD6, 0x14, 0xE6, 0xDE, 0xB5, 0x2E, 0x57, 0xF2, 0x02,
-    0x1B, 0x43, 0x29, 0x8A, 0x1E, 0x5E, 0x7C, 0x48, 0x43, 0x47, 0x93, 0x82, 0x99, 0x83, 0x8E, 0xDB,
-    0xE9, 0xAD, 0xA5, 0x3C, 0x99, 0x1A, 0xFF, 0xEE, 0xED, 0xFB, 0xA8, 0x31, 0x62, 0xAA, 0x46, 0xF0,
-    0xF9, 0xC6, 0x13, 0x98, 0x9E, 0xFF, 0xFB, 0xDE, 0xCB, 0x47, 0xEE, 0xDD, 0x9C, 0xF2, 0xE9, 0xE2,
-    0x75, 0x88, 0xD2, 0x54, 0xC5, 0xC1, 0xB5, 0x4C, 0x49, 0x19, 0x21, 0x8D, 0x12, 0x2F, 0x4D, 0xE2,
-    0xCC, 0xFA, 0x29, 0x35, 0x03, 0xB8, 0xF3, 0x19, 0xC8, 0x57, 0x51, 0xDC, 0x4E, 0x8D, 0xFB, 0x87,
-    0x5B, 0x5F, 0x2B, 0x3F, 0x9D, 0x52, 0xC8, 0x7C, 0x56, 0x6B, 0xBF, 0x99, 0xB5, 0xDC, 0xCE, 0xB7,
-    0xDE, 0xB9, 0x63, 0x1B, 0x9F, 0x1E, 0x9A, 0x1B, 0xD0, 0x99, 0x3E, 0x1C, 0x6F, 0x76, 0x10, 0xC6,
-    0xE7, 0xC5, 0xCC, 0xCE, 0xB9, 0x53, 0x6A, 0x7B, 0xD1, 0x76, 0xFB, 0x62, 0x02, 0x36, 0xCC, 0x7C,
-    0x98, 0x73, 0x32, 0x6B, 0xEF, 0x27, 0xC3, 0xBD, 0x9E, 0x52, 0x0B, 0xB6, 0x93, 0xE7, 0xB0, 0x4E,
-    0xF6, 0xFE, 0x5B, 0x4C, 0xD9, 0x90, 0x8F, 0x8D, 0x93, 0x33, 0xC5, 0xB6, 0x76, 0xE0, 0x41, 0x29,
-    0xDC, 0x33, 0x07, 0x4F, 0x69, 0xC9, 0x1F, 0x09, 0x3C, 0xCA, 0x82, 0xD7, 0x64, 0x94, 0x07, 0xC4,
-    0x12, 0x71, 0x19, 0x6E, 0xDE, 0x34, 0xA9, 0x27, 0x2E, 0x2B, 0x93, 0xFC, 0xF9, 0x9A, 0x2D, 0x87,
-    0x2C, 0x48, 0x9A, 0x35, 0x49, 0x49, 0x6D, 0x77, 0x60, 0x69, 0x30, 0x01, 0x8C, 0x32, 0x2C, 0x4B,
-    0x05, 0xCE, 0x20, 0x10, 0x93, 0x30, 0x14, 0xA6, 0xA7, 0x85, 0x5D, 0x76, 0xFA, 0x6D, 0x32, 0xC3,
-    0xCA, 0x11, 0x38, 0x39, 0x4C, 0xC1, 0x55, 0xFC, 0x63, 0x08, 0x4C, 0xF8, 0xC7, 0x66, 0x02, 0xFE,
-    0xDF, 0x19, 0x36, 0xFF, 0x4B, 0xAC, 0x5D, 0x49, 0xC3, 0x97, 0x4E, 0x31, 0x30, 0x59, 0xB1, 0x90,
-    0xB0, 0xD9, 0x6D, 0x33, 0x46, 0x2B, 0x58, 0x09, 0xB3, 0x21, 0xED, 0xF4, 0x1A, 0x96, 0x3B, 0x90,
-    0xB9, 0xD5, 0xC0, 0x61, 0xD1, 0x60, 0x5D, 0xD6, 0x4F, 0x18, 0x05, 0xE2, 0xD9, 0x33, 0x50, 0x0C,
-    0x2A, 0xA7, 0x5B, 0x01, 0x0B, 0x56, 0xB5, 0x8E, 0x11, 0x11, 0x7A, 0x8D, 0x87, 0xA8, 0x56, 0x63,
-    0x24, 0x2C, 0x22, 0x9E, 0x6E, 0xEB, 0x57, 0x31, 0xA2, 0x43, 0xA7, 0xC3, 0x98, 0x1C, 0x61, 0x67,
-    0xCF, 0xB1, 0xA4, 0x72, 0x94, 0x06, 0x7C, 0x9E, 0xC4, 0xCA, 0x67, 0x68, 0xBA, 0xD0, 0x36, 0x50,
-    0xD5, 0x89, 0x72, 0xFF, 0xC3, 0xE7, 0xB1, 0x0D, 0x5F, 0x23, 0x50, 0xE4, 0xCB, 0xCA, 0x56, 0x05,
-    0xCC, 0x24, 0x55, 0x0C, 0x71, 0x99, 0x27, 0x52, 0x39, 0x58, 0xF1, 0xD0, 0xAC, 0xC9, 0xC0, 0x7F,
-    0xC7, 0x13, 0x8D, 0x42, 0x92, 0x27, 0xCA, 0x99, 0xE6, 0x51, 0xD6, 0xB0, 0x6A, 0xC6, 0xE8, 0x3D,
-    0x7E, 0x97, 0xA4, 0xF8, 0x73, 0x45, 0xB1, 0x64, 0xD9, 0xD7, 0xCC, 0xD5, 0x0A, 0xF9, 0xCB, 0xA3,
-    0x84, 0x86, 0x1F, 0x33, 0x23, 0x61, 0x3F, 0x4D, 0x87, 0xC6, 0xE2, 0x1B, 0x46, 0x66, 0x74, 0xB5,
-    0x71, 0x8E, 0x54, 0x83, 0xF5, 0x2D, 0x2C, 0xAD, 0x19, 0x92, 0xAD, 0x19, 0xA1, 0x9D, 0xB0, 0xF6,
-    0x92, 0x91, 0xAF, 0x40, 0x22, 0xA8, 0xC5, 0x7B, 0xC2, 0x30, 0xC7, 0x39, 0x46, 0x68, 0x16, 0x5C,
-    0x4E, 0xAC, 0xE2, 0xA9, 0x35, 0x03, 0x79, 0x4D, 0x6C, 0xA3, 0x9F, 0x72, 0x3B, 0x9F, 0xE7, 0x53,
-    0xCA, 0xC6, 0x38, 0x67, 0x4A, 0x97, 0x9F, 0x00, 0xEC, 0x8A, 0x73, 0xD9, 0x94, 0x0A, 0xAC, 0xB7,
-    0x45, 0x94, 0x29, 0x1B, 0x9D, 0x03, 0x27, 0x29, 0x9F, 0x3E, 0xFD, 0x8F, 0x48, 0xF5, 0x72, 0x2A,
-    0x60, 0x29, 0x20, 0x63, 0xE0, 0xA4, 0xB2, 0x25, 0x05, 0xE6, 0x99, 0xDC, 0x76, 0xC2, 0xCB, 0xFB,
-    0x92, 0x95, 0x25, 0x93, 0x09, 0x61, 0x29, 0x84, 0x99, 0x06, 0x4B, 0xC9, 0x52, 0xE0, 0x6C, 0xA6,
-    0x24, 0xBB, 0x9B, 0x48, 0x70, 0x3C, 0x75, 0x8C, 0xA7, 0x4A, 0x85, 0x74, 0x9E, 0xB2, 0x42, 0x76,
-    0x66, 0x39, 0x51, 0x3A, 0xAE, 0x26, 0x0B, 0x03, 0x59, 0x64, 0xB2, 0x9A, 0xBE, 0x54, 0xB0, 0x5C,
-    0xF2, 0x4C, 0x6E, 0xCC, 0x86, 0x1B, 0x98, 0x2B, 0x1E, 0x25, 0x88, 0x20, 0x2A, 0x1B, 0xAF, 0x72,
-    0xD1, 0x84, 0xD9, 0xE7, 0x55, 0xE2, 0xF7, 0xBB, 0x10, 0xBB, 0x69, 0x03, 0x56, 0xBE, 0x3D, 0xA8,
-    0x56, 0xE5, 0x36, 0xDC, 0x57, 0xCB, 0x9A, 0xF7, 0x8A, 0x1B, 0xD8, 0xE3, 0xB6, 0xE5, 0x34, 0x21,
-    0x4C, 0xB7, 0xB9, 0xF7, 0x9C, 0x57, 0xBF, 0x0D, 0x2E, 0x44, 0xA5, 0x5F, 0x63, 0x43, 0x3F, 0x54,
-    0x36, 0x41, 0x4D, 0x11, 0xA6, 0xD4, 0xDE, 0x9D, 0x2B, 0xAD, 0x23, 0x05, 0xBD, 0x53, 0xDE, 0xEC,
-    0xD2, 0xCD, 0xDE, 0xA5, 0x51, 0xBE, 0xBB, 0xDF, 0x43, 0x35, 0x18, 0x83, 0xF5, 0x0B, 0x69, 0x30,
-    0xAE, 0xCA, 0xC3, 0xBB, 0xB8, 0x8F, 0xCC, 0x70, 0xE4, 0x9B, 0xFA, 0x88, 0x85, 0xA9, 0xCB, 0xE7,
-    0xD4, 0xE8, 0xCE, 0x03, 0x49, 0x00, 0x01, 0x4B, 0x32, 0x96, 0xA3, 0x36, 0x2C, 0x47, 0x55, 0xB6,
-    0x1C, 0x95, 0xF1, 0x57, 0xFD, 0xD0, 0xEA, 0xA9, 0xFC, 0x80, 0x2E, 0x52, 0xB7, 0x29, 0x39, 0xAC,
-    0x83, 0xFD, 0xDF, 0x2B, 0x30, 0xD5, 0xD5, 0x68, 0xAE, 0x4E, 0x4D, 0x55, 0xFE, 0x1B, 0x0E, 0xB7,
-    0x35, 0x7E, 0xB7, 0xA2, 0xCF, 0xA5, 0xFC, 0xC5, 0xE9, 0xD9, 0x7A, 0xDC, 0x99, 0x96, 0xDA, 0x3E,
-    0xEC, 0xEB, 0x0F, 0x17, 0x6B, 0x8E, 0x45, 0xD2, 0x57, 0x4D, 0x13, 0x5E, 0x54, 0x73, 0x05, 0xEB,
-    0x61, 0x20, 0x1E, 0xC2, 0x1C, 0xF4, 0xFA, 0x38, 0xF7, 0x37, 0xD7, 0x4D, 0xCE, 0x02, 0x7F, 0x8E,
-    0x39, 0x75, 0x8E, 0xC9, 0xE3, 0x73, 0x36, 0x13, 0x9E, 0xFE, 0xCA, 0x2E, 0xAC, 0x3A, 0xE5, 0x30,
-    0x37, 0x45, 0x1E, 0x74, 0x97, 0x8C, 0x9D, 0x4A, 0x65, 0x23, 0xF2, 0xF7, 0xDD, 0xE9, 0x45, 0xCC,
-    0xBC, 0x94, 0xC8, 0x49, 0x8D, 0x58, 0x7C, 0x2B, 0x56, 0x5E, 0x6F, 0xAB, 0xCF, 0x00, 0xCB, 0x65,
-    0x31, 0xD5, 0x52, 0xA4, 0xAA, 0xB2, 0xA3, 0x7D, 0x3A, 0x2B, 0x22, 0x77, 0x89, 0x6D, 0xBE, 0xF6,
-    0x83, 0x29, 0xC1, 0x89, 0x19, 0x14, 0x4A, 0x75, 0xC9, 0xD9, 0xB7, 0xAE, 0x15, 0x82, 0x28, 0x96,
-    0x6C, 0x2A, 0x05, 0xCF, 0xED, 0x8A, 0x61, 0xA5, 0xB5, 0x57, 0xDF, 0xD8, 0x5C, 0x3B, 0xF3, 0xFE,
-    0x49, 0xDB, 0xB4, 0x97, 0x21, 0xC8, 0x1D, 0xA1, 0xD7, 0x70, 0x20, 0xF4, 0x32, 0x96, 0x5E, 0xF1,
-    0x7D, 0xF4, 0x0A, 0xCF, 0x02, 0xA1, 0x57, 0xB4, 0xA5, 0x57, 0xB6, 0xA5, 0xD7, 0x3F, 0xB6, 0xF4,
-    0x0A, 0xB7, 0x8C, 0x89, 0x25, 0xD7, 0x26, 0x0B, 0x8D, 0x0A, 0x3F, 0x85, 0xBC, 0x05, 0x74, 0xFE,
-    0x4E, 0x01, 0x42, 0x5E, 0x56, 0x0F, 0x91, 0x08, 0xB6, 0xC0, 0xE4, 0x90, 0xD3, 0x56, 0x6F, 0xAE,
-    0xF7, 0x90, 0xD2, 0x01, 0x72, 0xB7, 0x20, 0x8D, 0x9F, 0xB4, 0xBD, 0x00, 0xD9, 0xCE, 0x6C, 0x8D,
-    0x4F, 0x8C, 0x92, 0x7E, 0xE4, 0x47, 0xBD, 0x20, 0xC9, 0x69, 0xA6, 0xB6, 0xA3, 0xA6, 0x2A, 0xA1,
-    0xFE, 0x0A, 0x77, 0x42, 0xA3, 0xFE, 0xAB, 0x5E, 0x99, 0x4E, 0x15, 0x95, 0x54, 0xA9, 0x92, 0x87,
-    0x36, 0xB7, 0x4B, 0xE0, 0x82, 0x12, 0x30, 0x23, 0x81, 0x4D, 0x4F, 0x10, 0xD7, 0x27, 0x30, 0xE6,
-    0x09, 0x78, 0x94, 0x10, 0x31, 0x88, 0x88, 0x86, 0xDF, 0xD3, 0xC8, 0xC5, 0xB4, 0xC7, 0x0A, 0xD5,
-    0x80, 0xC6, 0x6D, 0xC6, 0x65, 0x02, 0x11, 0xE3, 0xC1, 0x42, 0x02, 0x4B, 0x71, 0x59, 0x3F, 0xE8,
-    0x9A, 0x76, 0x75, 0x15, 0xE6, 0x20, 0x1E, 0xD5, 0x5E, 0x66, 0x3E, 0xE1, 0x99, 0xC4, 0xE6, 0xE0,
-    0xCB, 0x3B, 0x87, 0x08, 0x68, 0x5C, 0xC4, 0x32, 0x0D, 0x28, 0x6E, 0x60, 0xA9, 0xC5, 0xED, 0xCA,
-    0x03, 0x01, 0xE4, 0xB3, 0x7D, 0x4C, 0x18, 0xE4, 0x7B, 0x3B, 0x3E, 0x8F, 0x4F, 0xCB, 0xE7, 0xB9,
-    0x3E, 0x9D, 0x53, 0xAF, 0x5A, 0xE5, 0x0D, 0xD7, 0x25, 0xE2, 0xCF, 0xA8, 0x75, 0x31, 0xC5, 0x9A,
-    0xC7, 0x83, 0x13, 0x60, 0xF0, 0x1E, 0x6C, 0x81, 0x7C, 0x0D, 0x4B, 0xE9, 0x22, 0x9D, 0x65, 0x98,
-    0xB7, 0xB9, 0x34, 0xD8, 0xA9, 0x76, 0xB5, 0x77, 0xB9, 0xF6, 0x80, 0x30, 0x09, 0xF6, 0x55, 0x2C,
-    0x68, 0x76, 0xCA, 0x82, 0x26, 0xB4, 0xA0, 0x89, 0x28, 0x3E, 0xD7, 0x78, 0x0C, 0x1B, 0x7E, 0xAF,
-    0x06, 0x3F, 0x2B, 0x8B, 0x27, 0x1A, 0x1C, 0x51, 0x83, 0x1F, 0x69, 0x6E, 0x27, 0x70, 0x35, 0xE8,
-    0x91, 0x49, 0xEF, 0xAD, 0x7F, 0x81, 0xB8, 0x12, 0x3B, 0xB2, 0xB1, 0xDB, 0x23, 0x6F, 0x7B, 0x84,
-    0x32, 0xAA, 0x90, 0x22, 0x57, 0xBD, 0x25, 0xE5, 0xF4, 0xC5, 0xAC, 0xF6, 0x8C, 0xA7, 0xA4, 0x8A,
-    0x5C, 0xDB, 0x33, 0x3F, 0x87, 0xC4, 0x8F, 0xA6, 0x90, 0x80, 0x75, 0xD4, 0xA0, 0x3A, 0x56, 0x87,
-    0x25, 0x8B, 0xC8, 0xDB, 0x43, 0x99, 0x86, 0xB7, 0x23, 0x45, 0x94, 0xC8, 0xF4, 0x99, 0xE9, 0xBF,
-    0xF9, 0xC5, 0xB5, 0xC7, 0x29, 0xB7, 0xF0, 0xE4, 0x06, 0x36, 0x38, 0x06, 0xA3, 0x59, 0xF4, 0x4C,
-    0xD0, 0xF4, 0x63, 0xB6, 0x0C, 0xAD, 0x00, 0xC2, 0x46, 0xA7, 0xAE, 0x89, 0xEB, 0x2B, 0x06, 0x9B,
-    0xD1, 0xAE, 0xE9, 0x62, 0x1A, 0xBB, 0x93, 0xA9, 0x20, 0x6B, 0x19, 0x4E, 0x2B, 0xB8, 0x20, 0xBD,
-    0x06, 0x86, 0x36, 0xB0, 0x81, 0x08, 0xB3, 0x19, 0x53, 0x37, 0x16, 0x38, 0x1D, 0x77, 0xD6, 0x33,
-    0xEA, 0x59, 0x91, 0xA8, 0x0B, 0x39, 0xBB, 0x92, 0x80, 0xE8, 0x78, 0x3E, 0x41, 0x0B, 0x69, 0xB7,
-    0x59, 0x0E, 0x3F, 0x66, 0x86, 0xEF, 0xD7, 0x8C, 0x00, 0x44, 0x78, 0xBD, 0x41, 0x24, 0x37, 0x30,
-    0x94, 0xDD, 0x3C, 0xBC, 0x85, 0x65, 0x10, 0x93, 0xBF, 0x95, 0xF2, 0x14, 0x29, 0x22, 0xCB, 0xD1,
-    0x89, 0x32, 0xEF, 0xD7, 0x89, 0x0F, 0xBA, 0x79, 0xCD, 0xB1, 0x57, 0xAF, 0x58, 0x49, 0x60, 0x7A,
-    0xEB, 0xB6, 0x9D, 0xDB, 0x60, 0xE6, 0x4D, 0xAB, 0xBE, 0xC0, 0xDC, 0x63, 0xA3, 0xEE, 0x82, 0x92,
-    0xEB, 0x5A, 0x72, 0xBB, 0xAC, 0x92, 0x73, 0x07, 0x72, 0xB5, 0x92, 0xE8, 0x1C, 0x01, 0xF9, 0x7C,
-    0x3C, 0xB5, 0xB6, 0x39, 0xA5, 0x2B, 0x87, 0xF4, 0x52, 0x28, 0xCA, 0x88, 0x7E, 0xCC, 0xE0, 0x33,
-    0x1C, 0xE7, 0xB3, 0x3F, 0xC9, 0x0E, 0xE5, 0xAB, 0x3E, 0xE4, 0x11, 0xA6, 0x94, 0x9B, 0x7D, 0x12,
-    0x1E, 0xA1, 0x0E, 0x06, 0x0D, 0x64, 0x6B, 0xA6, 0x44, 0x18, 0xCF, 0xA3, 0x98, 0x1C, 0xEF, 0x0A,
-    0xC5, 0x10, 0x32, 0x4D, 0x14, 0x73, 0xE5, 0x5F, 0x1A, 0x76, 0x14, 0x3B, 0xA6, 0xAF, 0xD1, 0x74,
-    0x33, 0xB1, 0x24, 0xE4, 0xEB, 0x99, 0x62, 0xFE, 0x36, 0x06, 0x96, 0xF3, 0x2D, 0xBF, 0x3E, 0x73,
-    0xC8, 0x45, 0x77, 0xFC, 0x26, 0x31, 0x2B, 0xD8, 0x8D, 0x27, 0x17, 0xF4, 0xDA, 0x25, 0xDB, 0xE5,
-    0xFD, 0xC3, 0xDD, 0x99, 0xAB, 0x63, 0xFF, 0x2D, 0x41, 0x46, 0x46, 0xD3, 0x49, 0xC4, 0x60, 0xDD,
-    0x28, 0x5F, 0x43, 0x7B, 0xE4, 0xBC, 0x2C, 0xDB, 0xDF, 0x4F, 0x59, 0x56, 0x2D, 0xA4, 0x40, 0xF6,
-    0x7D, 0xA6, 0x01, 0xE1, 0xC6, 0x9E, 0x70, 0x9D, 0x7F, 0x9F, 0xA8, 0x97, 0x3B, 0x39, 0x05, 0x6C,
-    0xE5, 0xA0, 0x63, 0xF1, 0x20, 0x5D, 0x81, 0xA7, 0xBD, 0xCD, 0xD3, 0x15, 0x47, 0x8E, 0x36, 0xF6,
-    0x1E, 0x75, 0xA9, 0x5F, 0x43, 0x20, 0x73, 0xB2, 0x0F, 0x3B, 0x27, 0x92, 0xF7, 0xDF, 0x52, 0x25,
-    0x50, 0xFA, 0x36, 0x0B, 0x10, 0x11, 0x7C, 0x51, 0x6A, 0x4F, 0x5E, 0xEF, 0xB9, 0x31, 0x96, 0xF9,
-    0x68, 0xC3, 0xA3, 0x07, 0x5B, 0xA2, 0xF0, 0x91, 0xF7, 0x23, 0x44, 0xBE, 0x1D, 0xA4, 0x8B, 0x43,
-    0xE4, 0x28, 0xDF, 0xE3, 0x31, 0xB6, 0x1C, 0xCB, 0xFD, 0x0F, 0xD5, 0x5A, 0x3D, 0x8C, 0xDC, 0xD6,
-    0x11, 0x1E, 0x92, 0xD2, 0xD1, 0x10, 0x81, 0x50, 0x85, 0x64, 0x04, 0x16, 0x2C, 0xBA, 0x48, 0x11,
-    0x0B, 0xB6, 0xD8, 0xBA, 0xB8, 0x5B, 0xD2, 0x48, 0x91, 0x22, 0x85, 0x55, 0xE8, 0x2C, 0x20, 0x2E,
-    0x54, 0xC7, 0x41, 0x70, 0x29, 0x5C, 0xA8, 0x58, 0x2D, 0xE9, 0x2A, 0x65, 0xAE, 0x71, 0x95, 0x46,
-    0x85, 0x03, 0xC8, 0x7B, 0x40, 0xCE, 0xC5, 0x01, 0x51, 0x80, 0xBD, 0x5B, 0x02, 0x29, 0x52, 0xA4,
-    0x08, 0x81, 0xA4, 0x37, 0x93, 0xC8, 0x06, 0xE2, 0x46, 0x44, 0x42, 0x23, 0x7B, 0x07, 0xEE, 0xBE,
-    0x7C, 0xDF, 0x3C, 0xEE, 0xDE, 0x9F, 0x24, 0x4B, 0xCE, 0x9D, 0x7C, 0xDE, 0x5D, 0xCE, 0xDB, 0xE3,
-    0xBE, 0x37, 0x6F, 0x66, 0xDE, 0xBC, 0x79, 0xDF, 0x0C, 0x4F, 0x24, 0x91, 0x71, 0x3A, 0x4E, 0x13,
-    0x39, 0x27, 0x7C, 0xBD, 0x89, 0xF7, 0x75, 0xBC, 0x7B, 0xFA, 0x4E, 0x8E, 0xBC, 0x33, 0xBC, 0xBB,
-    0x57, 0x50, 0x74, 0xD7, 0xDF, 0xC4, 0x31, 0xA6, 0xF0, 0x71, 0x45, 0xCD, 0x52, 0x9A, 0xE4, 0xA2,
-    0x7D, 0xB6, 0x71, 0xB5, 0x8F, 0xB9, 0xA6, 0xB8, 0x76, 0xC4, 0xF6, 0x49, 0x0A, 0x49, 0xC3, 0xBD,
-    0x9F, 0xEB, 0x58, 0xC9, 0x66, 0x1D, 0xBF, 0xDC, 0x5E, 0xCE, 0x7C, 0xA2, 0x25, 0xF3, 0x50, 0x24,
-    0x36, 0x46, 0x64, 0xFC, 0xD1, 0x36, 0x99, 0x9C, 0x13, 0x67, 0x82, 0xFB, 0x6E, 0xF3, 0x34, 0x32,
-    0x26, 0x4F, 0x43, 0x72, 0x6B, 0x77, 0x35, 0x7D, 0x6C, 0x17, 0xAF, 0x9E, 0x93, 0xB0, 0xE0, 0x88,
-    0x2F, 0x87, 0xC3, 0xDC, 0x70, 0x88, 0x12, 0x9D, 0xFB, 0x55, 0x49, 0x5F, 0x95, 0x78, 0x6D, 0x36,
-    0x90, 0xD0, 0x98, 0x56, 0xBC, 0xC6, 0xAF, 0xC5, 0x2F, 0xA4, 0xA1, 0x84, 0x23, 0x09, 0x53, 0x59,
-    0x5E, 0x90, 0x3E, 0xA5, 0x9F, 0x88, 0x57, 0xB9, 0xE8, 0x32, 0x5B, 0x6B, 0x24, 0x32, 0x66, 0x2A,
-    0xF1, 0xD2, 0xC7, 0x3D, 0x5A, 0xF6, 0x9C, 0x0C, 0x38, 0x6B, 0xC2, 0x09, 0xA3, 0x5C, 0x82, 0x32,
-    0x2C, 0x31, 0x2B, 0xB8, 0xC5, 0x94, 0x65, 0x40, 0xB5, 0x60, 0x9D, 0x6D, 0x2A, 0x96, 0x50, 0xA4,
-    0xF8, 0xC7, 0x15, 0xC4, 0xFA, 0x0B, 0xED, 0xF1, 0x28, 0x15, 0xE7, 0x96, 0x59, 0x15, 0x0F, 0x52,
-    0x59, 0x62, 0x2D, 0x49, 0xE2, 0xAC, 0x4E, 0xBB, 0x1F, 0xDC, 0xE1, 0x6C, 0x78, 0xE0, 0x87, 0x7D,
-    0x72, 0x69, 0xE5, 0xC0, 0xEB, 0x52, 0x67, 0xD3, 0xD7, 0x0F, 0xDE, 0x14, 0xB9, 0x7C, 0x53, 0x5C,
-    0x63, 0x4A, 0xE8, 0x58, 0x46, 0xB9, 0x93, 0xC7, 0xE8, 0x11, 0xA7, 0x22, 0x51, 0x89, 0xE9, 0xB1,
-    0x60, 0xAE, 0xA9, 0xC4, 0x37, 0x33, 0x09, 0xF3, 0xAC, 0x88, 0x25, 0xA8, 0x62, 0x28, 0x01, 0xB9,
-    0xA1, 0x88, 0x57, 0x87, 0x8D, 0x5F, 0x7A, 0x66, 0x33, 0x97, 0xCC, 0xB0, 0x63, 0x6E, 0x47, 0x41,
-    0x31, 0xB5, 0xAC, 0x5F, 0xF5, 0xD2, 0xA8, 0x4C, 0x8C, 0x49, 0xAF, 0x98, 0x89, 0xCE, 0x7C, 0x4E,
-    0xD2, 0xC4, 0xAD, 0x13, 0xB7, 0xB9, 0xEE, 0xD4, 0xF3, 0x15, 0x96, 0x35, 0xB3, 0x4E, 0x8F, 0x9A,
-    0x6D, 0xD2, 0x3B, 0xE0, 0x41, 0x6B, 0x60, 0x33, 0xE1, 0x68, 0x98, 0x53, 0x6E, 0xE2, 0x6B, 0x90,
-    0x07, 0xA6, 0x58, 0x91, 0x10, 0xB3, 0x14, 0x11, 0x3C, 0x74, 0x0A, 0xC7, 0x49, 0x97, 0xB9, 0x8A,
-    0x7E, 0xBE, 0xCC, 0x89, 0xBC, 0xE2, 0x0E, 0xBA, 0x6A, 0x53, 0x1E, 0x6F, 0x96, 0xED, 0x6F, 0xCB,
-    0x2E, 0x45, 0xCA, 0xDF, 0x24, 0xEF, 0x20, 0x0D, 0x65, 0xBC, 0x51, 0x84, 0x60, 0x1D, 0x91, 0xB5,
-    0x57, 0x3A, 0xBF, 0xC5, 0x92, 0x72, 0x01, 0xC8, 0x2F, 0x4B, 0x25, 0xA6, 0xF1, 0xF7, 0xDE, 0x9B,
-    0x89, 0x7A, 0x53, 0xC5, 0xC6, 0xB9, 0x61, 0xE5, 0xBD, 0x32, 0x93, 0x64, 0x9C, 0x5F, 0xF4, 0x0A,
-    0x0E, 0xDB, 0x28, 0x63, 0x53, 0x8E, 0xBC, 0xB2, 0xC1, 0xC7, 0x2F, 0x77, 0xD6, 0xCA, 0xF8, 0xAB,
-    0xB2, 0xD3, 0x54, 0x7A, 0x4E, 0x23, 0xAD, 0x5F, 0xBB, 0x4D, 0x58, 0x04, 0x55, 0x22, 0x51, 0x3E,
-    0x95, 0xCC, 0x9D, 0xC8, 0x8E, 0xD7, 0x48, 0x92, 0xB6, 0x12, 0x96, 0x99, 0xFA, 0x83, 0xD3, 0x06,
-    0x95, 0x0C, 0x70, 0xF3, 0x0D, 0xD1, 0x79, 0x32, 0xAC, 0x68, 0xAA, 0xE4, 0xF2, 0xEA, 0xEA, 0xED,
-    0x94, 0x1E, 0xFA, 0x24, 0x72, 0xC1, 0x8A, 0x97, 0xE2, 0xB3, 0xBA, 0x2A, 0xCF, 0x66, 0x51, 0x51,
-    0x8B, 0x8E, 0x67, 0x42, 0x8B, 0x8E, 0xAD, 0x45, 0x47, 0x7E, 0x05, 0x8B, 0xCA, 0xC8, 0xAB, 0x61,
-    0x51, 0x36, 0x30, 0x1E, 0x9A, 0x8A, 0xCD, 0xF6, 0x5A, 0xC1, 0x66, 0x6C, 0x68, 0x51, 0xD9, 0xD9,
-    0xA1, 0x29, 0x65, 0x14, 0xDB, 0x06, 0x5E, 0x9C, 0x73, 0x78, 0x49, 0x8B, 0x62, 0x1C, 0x2D, 0x3A,
-    0x72, 0x26, 0xB4, 0xE8, 0x4D, 0xB9, 0xF9, 0x4C, 0x16, 0xBD, 0x36, 0x1C, 0x0E, 0xD7, 0xE1, 0x24,
-    0xA6, 0xE6, 0xB7, 0x7B, 0xA2, 0x8E, 0x14, 0x1A, 0xF8, 0xD8, 0x68, 0x45, 0x96, 0x97, 0x65, 0x05,
-    0x1F, 0x7C, 0xC1, 0x9F, 0xB8, 0xA9, 0x3E, 0x86, 0x1E, 0xD5, 0xD7, 0x91, 0x03, 0x46, 0xBC, 0xF5,
-    0xD5, 0xEA, 0xD7, 0x8D, 0xE0, 0x0B, 0xC6, 0x5E, 0x3D, 0x30, 0x0C, 0x9E, 0x17, 0x98, 0x3C, 0xD9,
-    0xA8, 0x5E, 0xA2, 0xAB, 0xD6, 0x02, 0xEA, 0xEA, 0xF6, 0x8F, 0x52, 0xB9, 0x2B, 0x58, 0x59, 0xBF,
-    0xE4, 0xD7, 0xC4, 0xD4, 0xF8, 0x70, 0xFC, 0x4D, 0xEC, 0xF9, 0x22, 0xF9, 0x4D, 0x7D, 0x69, 0xD1,
-    0x3F, 0x28, 0x7D, 0x93, 0xBA, 0x9B, 0x15, 0x7B, 0xD3, 0xFE, 0x13, 0x7C, 0x19, 0x6C, 0xD4, 0x99,
-    0xC9, 0x9D, 0x9B, 0xE2, 0xDC, 0xF7, 0x26, 0x41, 0x15, 0xE5, 0x3D, 0xB9, 0x83, 0x50, 0x2B, 0x49,
-    0xF2, 0x7C, 0x57, 0x86, 0x6B, 0x9C, 0xE4, 0x8E, 0x49, 0xAA, 0x2B, 0x06, 0xD6, 0x8B, 0x7B, 0xD9,
-    0x24, 0xEE, 0x39, 0x10, 0x88, 0x4B, 0xFE, 0x84, 0x0B, 0x11, 0x03, 0xD1, 0x10, 0xC1, 0x11, 0x9B,
-    0xD6, 0x6C, 0x70, 0xC7, 0xBB, 0x65, 0x44, 0x92, 0x3C, 0x23, 0xD1, 0xCE, 0x3A, 0xCC, 0x23, 0x01,
-    0x2B, 0x10, 0x09, 0xFF, 0x5F, 0xA2, 0x2F, 0x3D, 0x89, 0xF2, 0x0C, 0x3B, 0xC7, 0x2B, 0xE0, 0x4D,
-    0xB5, 0xD3, 0x22, 0xAA, 0x8E, 0xC6, 0x4D, 0x06, 0x5F, 0xC6, 0x16, 0x69, 0xB3, 0x51, 0xBF, 0x7F,
-    0xB1, 0x2F, 0xC7, 0xDF, 0x7C, 0xF9, 0x33, 0x89, 0x1F, 0x15, 0x7D, 0xB7, 0xDE, 0x92, 0xBA, 0x91,
-    0xAD, 0x5A, 0x3F, 0x5B, 0xD2, 0xF4, 0x9D, 0x3A, 0xDE, 0x28, 0x03, 0x33, 0xDF, 0x92, 0x77, 0xE1,
-    0x8C, 0x09, 0x38, 0x87, 0xC5, 0x00, 0x61, 0x2A, 0xCE, 0x9D, 0x09, 0x42, 0xF1, 0x0E, 0x6E, 0x66,
-    0x2E, 0xF7, 0x6A, 0xE5, 0x35, 0x51, 0x11, 0x94, 0x89, 0xC4, 0x79, 0x2B, 0x03, 0xDC, 0x7A, 0xC3,
-    0xE9, 0xDC, 0xE3, 0x81, 0xC8, 0x55, 0xF1, 0x11, 0x51, 0x57, 0x24, 0x06, 0x1D, 0xC9, 0x76, 0x9F,
-    0x4B, 0xFC, 0x5A, 0x5F, 0xB7, 0x94, 0x86, 0x7F, 0x50, 0x6E, 0xCA, 0xBE, 0x30, 0x82, 0x5A, 0xC1,
-    0xFA, 0x32, 0xC1, 0x92, 0x40, 0x2C, 0xEC, 0xF0, 0xBE, 0x57, 0x86, 0xA0, 0x61, 0x9E, 0x80, 0x46,
-    0xF2, 0xFB, 0x4A, 0x2E, 0xF5, 0x9C, 0xFF, 0x60, 0xF0, 0xC8, 0xFB, 0x23, 0x68, 0x13, 0xFC, 0x88,
-    0xDB, 0xF3, 0x2A, 0xD8, 0xF9, 0xC5, 0x0A, 0x68, 0x88, 0x5D, 0x0D, 0xAD, 0xE0, 0x92, 0x53, 0xF2,
-    0xC2, 0x1D, 0xEE, 0xA5, 0x8A, 0xDE, 0x85, 0xEF, 0x77, 0x29, 0x8F, 0xB8, 0x33, 0x0A, 0x24, 0xD1,
-    0x8C, 0x12, 0x49, 0xAF, 0x47, 0x91, 0xC0, 0xD6, 0x6E, 0xF3, 0x9E, 0x0A, 0x85, 0x46, 0x43, 0x45,
-    0x4F, 0xC5, 0x42, 0xD3, 0xB7, 0xCD, 0x64, 0x09, 0x76, 0xED, 0xB9, 0x35, 0x0E, 0x36, 0xE9, 0x79,
-    0x7F, 0xDD, 0x1D, 0xA3, 0x09, 0xF3, 0x3C, 0x42, 0x13, 0x69, 0x74, 0x01, 0x1B, 0xC1, 0x37, 0x32,
-    0xBE, 0x8E, 0xA6, 0x91, 0x4E, 0x0A, 0x3A, 0x33, 0xB6, 0x81, 0x5F, 0x6A, 0x2F, 0x6C, 0x01, 0x32,
-    0xBE, 0xAB, 0xCA, 0xF2, 0x27, 0x9E, 0x82, 0x38, 0x91, 0x20, 0x88, 0xA7, 0x87, 0x95, 0x85, 0x0B,
-    0xD8, 0x4F, 0xE0, 0x90, 0x60, 0xDB, 0x63, 0x13, 0xFD, 0x10, 0x17, 0x43, 0x33, 0x76, 0x49, 0xC8,
-    0xB3, 0xBE, 0xD6, 0x79, 0xC0, 0x1A, 0xAA, 0xF8, 0x86, 0x67, 0x2B, 0x1B, 0x65, 0xB6, 0x54, 0xAB,
-    0x2A, 0x32, 0xF1, 0x8B, 0xCB, 0x6C, 0xC2, 0x74, 0x40, 0x59, 0x62, 0x99, 0xC9, 0x1F, 0xFC, 0xBA,
-    0x0F, 0xFD, 0x33, 0x53, 0x4E, 0xFC, 0xDF, 0xC9, 0xD2, 0x27, 0x6E, 0x1D, 0xF6, 0xC8, 0xA6, 0x5C,
-    0x61, 0x13, 0xE4, 0x0F, 0xD8, 0x44, 0x52, 0xB3, 0xE9, 0x79, 0x25, 0xFD, 0x7F, 0x04, 0xAC, 0x41,
-    0x53, 0x7B, 0x6C, 0xC8, 0xB8, 0xA7, 0xAA, 0xB0, 0xA1, 0x8D, 0x7A, 0x56, 0x58, 0xC6, 0xAB, 0xA0,
-    0xB1, 0x97, 0x02, 0x84, 0x74, 0x3F, 0xB2, 0x32, 0x5A, 0xF0, 0xE2, 0xE0, 0x00, 0x2A, 0x44, 0x18,
-    0x0D, 0xCB, 0xB9, 0x30, 0x62, 0x50, 0xDB, 0x3F, 0x13, 0xB1, 0x9C, 0xE6, 0x17, 0xFE, 0x4E, 0xE3,
-    0x87, 0x57, 0xE0, 0x84, 0x0C, 0x5F, 0x30, 0xC4, 0x79, 0x44, 0x3D, 0x1A, 0x1F, 0x5C, 0x1A, 0xDD,
-    0x94, 0x7A, 0x58, 0x13, 0x06, 0x50, 0x60, 0x9D, 0xCC, 0xCF, 0xE5, 0xC8, 0x2B, 0xB1, 0x54, 0xEF,
-    0x8F, 0x15, 0x9E, 0x18, 0x5A, 0xD0, 0xF9, 0x2F, 0xCD, 0xE3, 0xFD, 0x5B, 0xC1, 0xCC, 0xDF, 0xC9,
-    0x2E, 0x28, 0x5B, 0xC5, 0x34, 0x84, 0x60, 0x51, 0x4E, 0xA6, 0x71, 0xB7, 0xFF, 0x79, 0xA8, 0x6F,
-    0x2B, 0xDA, 0xA1, 0xFF, 0x13, 0xB7, 0x71, 0x39, 0x18, 0x78, 0xC5, 0xDB, 0x1B, 0x6E, 0x34, 0x3C,
-    0x1F, 0x10, 0xAF, 0x6D, 0x07, 0x6A, 0xB2, 0xA3, 0x43, 0x12, 0x3B, 0x5C, 0x0D, 0x1F, 0xE5, 0xED,
-    0x1C, 0x30, 0x7D, 0xA2, 0xE6, 0x68, 0xE7, 0x06, 0xC3, 0x5D, 0xDD, 0xC8, 0xB1, 0xCA, 0xBF, 0x2C,
-    0x67, 0x5D, 0xFE, 0x6B, 0x2A, 0xCF, 0x98, 0xF2, 0x38, 0x7A, 0x18, 0xF9, 0xFF, 0xE0, 0xEC, 0x61,
-    0xBE, 0xAD, 0x30, 0x38, 0x3A, 0xE3, 0xF2, 0x3B, 0x29, 0xE2, 0x8A, 0x84, 0x13, 0x3A, 0x4A, 0x62,
-    0x36, 0x69, 0x72, 0x06, 0x01, 0xF9, 0xC0, 0xF9, 0xF8, 0xAC, 0x4B, 0x2E, 0x17, 0xF5, 0xCB, 0x48,
-    0xE9, 0x54, 0xB7, 0xEA, 0x1D, 0x79, 0xEC, 0xEB, 0xCC, 0xF9, 0xBC, 0x2C, 0x24, 0x71, 0xBF, 0xD0,
-    0xD9, 0x8B, 0x4F, 0x49, 0xF3, 0x2D, 0xFD, 0x5E, 0x2F, 0x7C, 0x49, 0xB2, 0xB3, 0x23, 0xF3, 0x58,
-    0xC1, 0x8C, 0x72, 0x61, 0xEB, 0x75, 0xAD, 0x5F, 0xD9, 0xA8, 0x13, 0x96, 0xB6, 0x8D, 0x0A, 0xDB,
-    0xC6, 0x69, 0xDB, 0xD9, 0xDE, 0xB6, 0xDB, 0x5D, 0xDB, 0xDA, 0x16, 0x47, 0xE2, 0x6C, 0x38, 0xD4,
-    0x2D, 0x6F, 0xCC, 0x4C, 0x63, 0xA0, 0xB6, 0x98, 0x4A, 0x7F, 0x8F, 0x99, 0x28, 0x71, 0x78, 0xD7,
-    0x66, 0xC3, 0xE1, 0x3C, 0x15, 0x61, 0x4B, 0x38, 0xD8, 0x76, 0x11, 0x83, 0xAD, 0xDF, 0xB5, 0x8C,
-    0x1D, 0xE4, 0x4B, 0x6D, 0x28, 0x5F, 0x92, 0xDA, 0xB6, 0x0B, 0xBA, 0x66, 0x96, 0x92, 0x73, 0xED,
-    0x98, 0x2F, 0x37, 0x4B, 0x6F, 0x2A, 0x4E, 0x1E, 0xD2, 0x90, 0x44, 0x94, 0xC2, 0xAE, 0x36, 0x2F,
-    0x65, 0x62, 0xA9, 0x19, 0xA6, 0x25, 0xFB, 0x79, 0xD0, 0xFE, 0x3D, 0xED, 0xA2, 0x9D, 0x75, 0x58,
-    0x42, 0x06, 0x11, 0x57, 0x26, 0xD0, 0x9C, 0xD2, 0x7C, 0xF4, 0x5E, 0x61, 0x73, 0x47, 0x04, 0x6B,
-    0x2C, 0xE1, 0xF5, 0x74, 0x1E, 0xCB, 0x74, 0x41, 0xFD, 0x05, 0x5E, 0xD4, 0x8C, 0x82, 0x59, 0xA2,
-    0x07, 0xDD, 0xDD, 0x8F, 0xBB, 0x40, 0x38, 0xED, 0x7C, 0x96, 0x76, 0x5F, 0xC0, 0x1A, 0x5D, 0x81,
-    0x92, 0x6B, 0x88, 0xAB, 0x6C, 0x9F, 0x90, 0x18, 0xF3, 0x32, 0x36, 0x03, 0x65, 0x02, 0x5A, 0x3C,
-    0xAD, 0x1F, 0x2F, 0x18, 0x6B, 0xBD, 0xE3, 0x09, 0x51, 0xDE, 0xE7, 0x1D, 0xCC, 0x39, 0xB1, 0x16,
-    0xE5, 0xFC, 0x57, 0xE5, 0xC5, 0xCD, 0xFF, 0x0A, 0xBD, 0x0F, 0xFA, 0xC2, 0x41, 0xDD, 0xA6, 0x15,
-    0xE2, 0xA7, 0xAB, 0x9A, 0xC5, 0xBF, 0x28, 0xFD, 0xCF, 0x01, 0x8D, 0xF4, 0xB0, 0x3C, 0x09, 0x76,
-    0xE1, 0x9B, 0x87, 0x42, 0xC8, 0x69, 0xCF, 0xFD, 0xBE, 0x7A, 0x12, 0xDC, 0xD6, 0xB7, 0xC0, 0xE8,
-    0xCE, 0x62, 0xDE, 0x1C, 0xA9, 0x95, 0xBF, 0x4B, 0x4F, 0xFF, 0x26, 0x9F, 0x86, 0x99, 0x19, 0x3E,
-    0x72, 0x61, 0x9D, 0x6E, 0x8E, 0x39, 0xA6, 0xE4, 0xEF, 0x95, 0x27, 0xCD, 0xFF, 0x3E, 0xBC, 0x9E,
-    0x68, 0x2B, 0xFC, 0x73, 0xD9, 0x73, 0x9B, 0xAD, 0x0E, 0x4E, 0x63, 0xB7, 0x55, 0x31, 0xF6, 0x1B,
-    0xF6, 0x5D, 0x2B, 0xDF, 0xE4, 0x33, 0x05, 0x87, 0x1A, 0x9F, 0x8B, 0x8E, 0xB4, 0x41, 0xD1, 0x06,
-    0xE5, 0x03, 0xBF, 0x38, 0xB0, 0x28, 0x27, 0x23, 0xBC, 0x6F, 0x66, 0xEB, 0xC4, 0x96, 0x1A, 0x88,
-    0xB8, 0xC2, 0x0C, 0x47, 0x71, 0x43, 0xEA, 0xB6, 0x0A, 0xCF, 0x8C, 0xD2, 0x24, 0x25, 0x8D, 0x73,
-    0x0B, 0xD8, 0x48, 0x99, 0x90, 0x93, 0xB2, 0x48, 0x13, 0x96, 0x96, 0x6E, 0xEE, 0xDD, 0xE7, 0x7D,
-    0xFB, 0xEB, 0xA2, 0xA7, 0x1D, 0x65, 0x39, 0x98, 0x7D, 0xCE, 0x11, 0x66, 0xD9, 0xDB, 0xE0, 0x8C,
-    0xF3, 0xD9, 0x09, 0xE8, 0xCE, 0xE3, 0x2D, 0x49, 0xFD, 0x3D, 0x74, 0x9D, 0x21, 0xAE, 0xD7, 0x19,
-    0x32, 0xBE, 0xD2, 0x42, 0xBD, 0xEE, 0xC5, 0x00, 0x34, 0x62, 0x68, 0x19, 0x31, 0x7A, 0x8C, 0x98,
-    0x39, 0x8E, 0x0C, 0xFC, 0x66, 0x34, 0x65, 0x52, 0xD1, 0x8E, 0x49, 0xB0, 0xD8, 0xA3, 0x16, 0x2E,
-    0x35, 0x62, 0x5D, 0x60, 0xD4, 0x42, 0xDD, 0x51, 0x0B, 0x8C, 0x38, 0x6A, 0xB1, 0xC7, 0x41, 0x92,
-    0x14, 0x24, 0x2E, 0x40, 0xC2, 0x0A, 0xC4, 0xAB, 0x41, 0xDC, 0x76, 0x44, 0xA3, 0x93, 0x64, 0x24,
-    0x71, 0x0B, 0x12, 0x92, 0xF8, 0x24, 0x90, 0xD9, 0xBD, 0xA7, 0x48, 0xCD, 0x06, 0xF3, 0xE9, 0x81,
-    0xE3, 0x35, 0xB4, 0x09, 0x75, 0x79, 0xE4, 0xEC, 0x5D, 0x32, 0xBB, 0xB6, 0x14, 0x01, 0x8D, 0xCD,
-    0xE7, 0xE3, 0x89, 0xF8, 0x13, 0x71, 0x61, 0x26, 0xA6, 0xD6, 0x1A, 0x78, 0xE3, 0xDC, 0x86, 0xBA,
-    0x4C, 0xC3, 0x37, 0xF5, 0x0A, 0xAA, 0xA9, 0x86, 0xF4, 0xA9, 0x06, 0xF8, 0xF6, 0x00, 0x9D, 0x2E,
-    0xA8, 0x5F, 0xDB, 0x9E, 0x76, 0x94, 0xE5, 0xC0, 0x03, 0x3E, 0xCE, 0x59, 0x38, 0xCA, 0x18, 0x87,
-    0x9D, 0x19, 0x03, 0xF1, 0xDA, 0x44, 0x37, 0x2F, 0x61, 0xB6, 0xD1, 0x92, 0xC1, 0x79, 0x2B, 0xD7,
-    0xFB, 0xFB, 0x0A, 0xB8, 0x5A, 0x53, 0xD2, 0xA0, 0xDC, 0x69, 0x71, 0x5D, 0xBE, 0x1B, 0x5A, 0xBC,
-    0xA2, 0x07, 0x5B, 0x62, 0xE1, 0x81, 0x42, 0x82, 0xAF, 0x5A, 0x2D, 0xAA, 0x32, 0x5F, 0x40, 0xE8,
-    0x4C, 0xBF, 0x0B, 0x5A, 0x38, 0x37, 0x1C, 0x16, 0x6B, 0xA7, 0x1E, 0x04, 0x88, 0xCC, 0x23, 0x7C,
-    0x5F, 0xD6, 0x3C, 0xFB, 0x2D, 0xE6, 0xCA, 0xDF, 0x09, 0x5F, 0x62, 0xCD, 0x9B, 0x07, 0x07, 0x61,
-    0xCC, 0x40, 0x21, 0xDC, 0xCA, 0x63, 0x71, 0xE8, 0x59, 0x95, 0x5F, 0x7E, 0x20, 0xF2, 0xCB, 0x6D,
-    0x80, 0xAA, 0x24, 0xF5, 0xEB, 0xB0, 0x8C, 0x0A, 0xAF, 0x01, 0xAF, 0x59, 0xCB, 0x18, 0x04, 0x36,
-    0x14, 0xAF, 0x41, 0x76, 0x39, 0xC5, 0x4C, 0x49, 0x1A, 0x15, 0x5A, 0x6F, 0x6C, 0xFA, 0x9A, 0xCA,
-    0x2B, 0x08, 0x97, 0x97, 0x54, 0x37, 0xA4, 0x9C, 0x99, 0x16, 0x91, 0xA1, 0x5B, 0x4B, 0xDD, 0x3C,
-    0xD5, 0xCD, 0x33, 0xD4, 0x2D, 0x34, 0xD4, 0x2D, 0x7E, 0x87, 0xBA, 0x0D, 0x54, 0xB7, 0x96, 0xBA,
-    0xB9, 0x35, 0x75, 0xF3, 0x4B, 0x6A, 0x15, 0x16, 0xA4, 0x89, 0x6A, 0xB5, 0x4D, 0x0A, 0x94, 0x07,
-    0xDD, 0x10, 0xA9, 0xA1, 0x1B, 0x62, 0x25, 0x74, 0x8B, 0x72, 0xEA, 0x66, 0x54, 0xB7, 0x76, 0x5F,
-    0x37, 0x5F, 0x75, 0x0B, 0xF5, 0x10, 0x8F, 0x7F, 0x42, 0xDD, 0x2E, 0x2C, 0x74, 0x63, 0x65, 0x30,
-    0x9D, 0x83, 0xBC, 0xB0, 0x5A, 0xA4, 0x99, 0xAD, 0x7D, 0x4E, 0x71, 0xE0, 0xC5, 0x00, 0xD7, 0x9C,
-    0x02, 0xF1, 0xB8, 0x3E, 0x5E, 0x9D, 0x71, 0x8D, 0xB0, 0x57, 0xE3, 0x22, 0xDC, 0x7D, 0xD7, 0xA4,
-    0x1E, 0x4F, 0x0B, 0x18, 0xAC, 0xD2, 0x92, 0x1F, 0xBD, 0xE3, 0xDE, 0x5C, 0xC0, 0x38, 0x9F, 0x47,
-    0x55, 0xC5, 0xBA, 0xD5, 0xD9, 0x11, 0x52, 0xB3, 0x42, 0x8F, 0x4E, 0x17, 0x72, 0x8B, 0x62, 0x39,
-    0x81, 0xEC, 0x61, 0x4F, 0xC8, 0xF8, 0xE0, 0xCC, 0x08, 0xC9, 0xFA, 0x9C, 0xDC, 0x25, 0xB4, 0x1E,
-    0x70, 0xA9, 0x97, 0x8F, 0x9D, 0x49, 0xDF, 0xF6, 0x4A, 0xEB, 0x19, 0xCA, 0x32, 0x8F, 0xE6, 0x29,
-    0x76, 0xA5, 0x99, 0xC6, 0xCA, 0xA1, 0x95, 0xDE, 0x66, 0x9A, 0x93, 0x91, 0x1F, 0x0E, 0xF2, 0xA0,
-    0x02, 0x18, 0x57, 0xB4, 0x11, 0xE7, 0x2C, 0x3D, 0xF2, 0xD0, 0xDA, 0xEE, 0xB2, 0x29, 0x3E, 0x07,
-    0x90, 0x84, 0x80, 0x3D, 0xFA, 0x35, 0x51, 0x07, 0x43, 0xA8, 0xCF, 0xE5, 0x61, 0x52, 0xD1, 0x55,
-    0x85, 0x9E, 0x83, 0x8C, 0x8E, 0xC1, 0xD4, 0x75, 0xCD, 0xA1, 0xB8, 0xBB, 0x90, 0x27, 0x36, 0x44,
-    0x09, 0x04, 0x09, 0x7C, 0xD2, 0x74, 0xE0, 0x6A, 0xED, 0xFD, 0xA0, 0x31, 0x1B, 0x0A, 0x95, 0x53,
-    0x42, 0x99, 0xC7, 0xC1, 0x5E, 0x39, 0x7F, 0x53, 0xD3, 0xC8, 0x9C, 0x68, 0xA7, 0x91, 0xB8, 0x5C,
-    0x6A, 0x2D, 0x2E, 0x4D, 0xA8, 0x73, 0x47, 0x1C, 0x06, 0x02, 0x9F, 0x8A, 0x12, 0xB5, 0xB2, 0x34,
-    0xA6, 0x89, 0x64, 0x47, 0xA6, 0x24, 0x48, 0xA5, 0xF0, 0x2B, 0xBB, 0xF8, 0x3A, 0x96, 0x4F, 0x1F,
-    0xD1, 0x3B, 0x11, 0x4D, 0x1C, 0x14, 0xC5, 0x23, 0xB0, 0xD8, 0x3F, 0x83, 0x1C, 0x3F, 0x04, 0x4C,
-    0x08, 0x5D, 0xAE, 0x85, 0x9C, 0x4F, 0x6D, 0xE1, 0x29, 0xEB, 0x76, 0x1B, 0x51, 0x19, 0x1F, 0xEB,
-    0x1C, 0xF4, 0xE2, 0xCC, 0xA4, 0x2C, 0xF3, 0x79, 0x9F, 0x5F, 0x69, 0x1C, 0x8B, 0x11, 0xF6, 0xB5,
-    0x58, 0xDA, 0x68, 0x91, 0x48, 0xB7, 0xE1, 0xDE, 0x6A, 0x8B, 0x48, 0xDB, 0x82, 0x4D, 0x3B, 0xD0,
-    0xCB, 0xC1, 0x77, 0x0F, 0xF7, 0xE2, 0x36, 0x32, 0xD3, 0xBE, 0x6F, 0xAA, 0xBE, 0xB0, 0xDE, 0x28,
-    0x17, 0x72, 0x7B, 0x4E, 0x67, 0x9D, 0xF7, 0xD5, 0x87, 0x6B, 0x73, 0x27, 0x39, 0x17, 0xBD, 0x2B,
-    0x04, 0x8B, 0x18, 0x8A, 0xEE, 0xC0, 0x92, 0x0D, 0xE2, 0x6A, 0xE9, 0x56, 0xA7, 0x32, 0xD7, 0x25,
-    0x79, 0xCD, 0x31, 0xF9, 0x96, 0x67, 0xF6, 0x6A, 0xFF, 0x43, 0x53, 0x06, 0x1D, 0x22, 0x39, 0xF1,
-    0x79, 0x00, 0xFF, 0x65, 0x12, 0x16, 0x4E, 0x8B, 0x5D, 0xB0, 0x15, 0x1C, 0x2E, 0x6A, 0x9E, 0xE8,
-    0x3A, 0x89, 0xB5, 0x5D, 0x0F, 0xBD, 0xDE, 0x0A, 0x45, 0x3E, 0x08, 0x59, 0x10, 0xB3, 0xB6, 0x5C,
-    0xAA, 0x4E, 0x6F, 0x4E, 0x6C, 0x88, 0xF1, 0x54, 0xC6, 0x0D, 0xCF, 0xB0, 0x3F, 0xE1, 0xFC, 0x0A,
-    0x1E, 0xDE, 0x7E, 0x54, 0x66, 0xB9, 0xC3, 0xC3, 0x53, 0xAB, 0x00, 0x53, 0xC5, 0xA7, 0x4E, 0xAB,
-    0x87, 0x97, 0x6D, 0x5E, 0xDE, 0x98, 0x0D, 0x37, 0x58, 0x09, 0x66, 0x45, 0x27, 0xDC, 0x7B, 0x17,
-    0xE9, 0xE4, 0xBD, 0x24, 0xD7, 0x87, 0xDA, 0x99, 0xDD, 0xF5, 0x03, 0x5B, 0x4E, 0x18, 0xD8, 0x40,
-    0x90, 0xD9, 0xEA, 0x79, 0x92, 0x67, 0xB7, 0x1F, 0xBE, 0x5C, 0x42, 0x04, 0x68, 0x50, 0x42, 0x0A,
-    0x87, 0xF5, 0x91, 0xCB, 0x76, 0x4F, 0x68, 0x05, 0xC7, 0xAC, 0x3B, 0xD4, 0x6D, 0xF6, 0x53, 0x3E,
-    0x67, 0xD0, 0x10, 0x65, 0xCB, 0x42, 0x4F, 0xB8, 0x52, 0xDB, 0x87, 0x7D, 0xFD, 0xE9, 0x79, 0xB2,
-    0x43, 0x90, 0x22, 0xC4, 0xD1, 0xA7, 0xA5, 0x42, 0x20, 0x60, 0xEB, 0xFA, 0xD7, 0x6D, 0x21, 0x3B,
-    0xE1, 0x16, 0xC6, 0x6F, 0x3F, 0x5B, 0xD4, 0x50, 0xF4, 0x68, 0xE6, 0x16, 0xB4, 0x7B, 0x50, 0x0E,
-    0x97, 0xF1, 0xE2, 0x99, 0x16, 0x71, 0x00, 0x24, 0x76, 0xAF, 0x4C, 0x58, 0xE1, 0x41, 0x10, 0xCA,
-    0x6D, 0xAD, 0x4A, 0x4B, 0x55, 0x20, 0xC3, 0xE1, 0x98, 0x95, 0x22, 0xC3, 0x6F, 0x43, 0x1B, 0x4F,
-    0x93, 0x45, 0x71, 0x26, 0x5A, 0x1C, 0xFC, 0xFE, 0xF4, 0xED, 0x5F, 0x30, 0xF2, 0x4C, 0x99, 0x97,
-    0x36, 0xF3, 0x68, 0xCC, 0xAD, 0x69, 0x45, 0xC8, 0xE6, 0x61, 0xD0, 0xB5, 0x45, 0xB9, 0x17, 0x29,
-    0x86, 0x3D, 0x13, 0x68, 0x2A, 0xFA, 0x9A, 0x0C, 0x30, 0xC6, 0x99, 0xC0, 0x26, 0x5E, 0x79, 0xE0,
-    0x09, 0xF7, 0xE9, 0x8B, 0xC1, 0x8D, 0xC6, 0x4C, 0x1B, 0x84, 0x7E, 0xB7, 0x75, 0xFC, 0x01, 0xC2,
-    0x29, 0x4B, 0x70, 0x2D, 0x8D, 0x71, 0xCA, 0xB9, 0xC8, 0x55, 0x3B, 0x70, 0x36, 0xD1, 0x43, 0xEE,
-    0xE9, 0xEF, 0xFB, 0xDE, 0x04, 0xC0, 0x15, 0xA1, 0xDF, 0x7A, 0xCE, 0xF1, 0xFF, 0x38, 0x39, 0xFE,
-    0x96, 0xD7, 0xA1, 0x44, 0xEA, 0x22, 0x66, 0xFD, 0xB3, 0x8E, 0xD2, 0x76, 0x79, 0x91, 0xF3, 0xF5,
-    0xC4, 0x2A, 0xF1, 0x5C, 0x1F, 0x40, 0x8E, 0x9E, 0x57, 0x03, 0x6E, 0xAC, 0x1C, 0x08, 0xB4, 0x32,
-    0xF9, 0x46, 0x25, 0x8F, 0x73, 0xF6, 0xF1, 0x0D, 0xF0, 0x75, 0xFC, 0x05, 0x13, 0x6F, 0xE2, 0x06,
-    0xFB, 0x2F, 0x11, 0xAC, 0x00, 0x67, 0xBF, 0x82, 0x3B, 0xBC, 0x65, 0x0F, 0xF5, 0xED, 0xCE, 0xB0,
-    0x17, 0xFE, 0x05, 0xDB, 0x1B, 0xF3, 0x59, 0xEE, 0x99, 0x4D, 0x53, 0xC0, 0xB4, 0xE3, 0x22, 0x22,
-    0xFA, 0x80, 0xB9, 0xC3, 0x72, 0x7E, 0x1E, 0xEE, 0x13, 0x1A, 0x0A, 0x04, 0xE7, 0x5E, 0x94, 0x63,
-    0xF9, 0x70, 0x7E, 0x4E, 0x80, 0xA1, 0xB1, 0x0E, 0x3C, 0x34, 0xB4, 0xFE, 0x70, 0x63, 0x11, 0xDA,
-    0x3F, 0x65, 0x68, 0x0F, 0xDE, 0x66, 0x68, 0xBF, 0xB6, 0x08, 0xED, 0xC8, 0xCF, 0xF2, 0x95, 0xCC,
-    0x34, 0xC9, 0xEE, 0xAD, 0x36, 0x29, 0x65, 0x86, 0x30, 0x37, 0x48, 0x9E, 0xFF, 0xD1, 0x73, 0x62,
-    0x1F, 0x9E, 0x58, 0x60, 0x5E, 0x3E, 0x05, 0x98, 0x43, 0xAA, 0x9C, 0xF2, 0x35, 0x80, 0x9E, 0xB7,
-    0x34, 0xA7, 0xC8, 0xE8, 0x45, 0x71, 0x0E, 0xB5, 0x3B, 0x65, 0x12, 0x39, 0xAA, 0x6A, 0x68, 0x55,
-    0xD5, 0x2E, 0xDA, 0x59, 0x87, 0x79, 0xBB, 0x4B, 0x53, 0xCB, 0x4A, 0x99, 0x5A, 0x55, 0x8F, 0x42,
-    0xEF, 0x41, 0xB7, 0x78, 0x47, 0xA0, 0xF7, 0x69, 0x8B, 0x71, 0x14, 0x5C, 0xDF, 0xDE, 0x07, 0xD7,
-    0x5B, 0x2F, 0x50, 0x8C, 0xCB, 0xF2, 0x7D, 0x80, 0xA9, 0x72, 0x19, 0x3F, 0xCC, 0x90, 0x9F, 0x96,
-    0xE3, 0x5A, 0xDC, 0xFC, 0xF0, 0x99, 0x7B, 0xDA, 0xEB, 0xB1, 0x00, 0xF0, 0x3B, 0x44, 0xB5, 0xCB,
-    0x5E, 0x79, 0x3C, 0x08, 0x9D, 0xB2, 0x04, 0xE9, 0xDC, 0x1D, 0xFD, 0xC5, 0xFF, 0x78, 0x39, 0xEB,
-    0x87, 0x51, 0xC7, 0x81, 0x7F, 0xAE, 0x59, 0x3D, 0xF8, 0xCB, 0xFE, 0x30, 0x25, 0x5D, 0x40, 0x38,
-    0x4F, 0xF6, 0xEF, 0xE4, 0xA2, 0xFF, 0x7E, 0x65, 0x65, 0x76, 0x0C, 0x64, 0xF6, 0x4C, 0x1A, 0xA7,
-    0xC1, 0x67, 0x10, 0x37, 0x7A, 0x07, 0xA4, 0x47, 0x21, 0x5B, 0x88, 0xEB, 0x36, 0x20, 0x7E, 0x85,
-    0x3F, 0xC3, 0x02, 0x32, 0xAF, 0x51, 0xE6, 0x29, 0x65, 0x9E, 0x40, 0x66, 0x7F, 0x0A, 0x99, 0x15,
-    0x3D, 0x47, 0x9B, 0x90, 0xD9, 0xEF, 0xAC, 0xD6, 0x3D, 0x4D, 0x1D, 0x1F, 0x05, 0xB5, 0xFB, 0xDE,
-    0x33, 0xB0, 0xD0, 0x26, 0x79, 0xC6, 0x2B, 0x1B, 0xF0, 0x9F, 0x43, 0x10, 0x28, 0x13, 0x44, 0xCA,
-    0xB8, 0xBA, 0x62, 0x00, 0x4F, 0x80, 0xA0, 0x27, 0xB1, 0xCD, 0xAE, 0x15, 0xD4, 0xE6, 0x0B, 0x50,
-    0xEB, 0x1D, 0x06, 0xB5, 0x27, 0x3A, 0x97, 0x0B, 0xE3, 0x87, 0xCD, 0x61, 0x50, 0x5B, 0xEC, 0xC7,
-    0xDA, 0x13, 0x9D, 0x6B, 0x0E, 0x36, 0x71, 0x49, 0x73, 0xD8, 0xF1, 0x4F, 0xDE, 0x7E, 0x5F, 0x8F,
-    0x3C, 0xB6, 0xBB, 0xE7, 0x7A, 0x71, 0x9A, 0x74, 0x4F, 0xF5, 0x06, 0xC4, 0x84, 0xDB, 0xF6, 0x59,
-    0x99, 0x5F, 0x01, 0xF1, 0x79, 0xB5, 0xC7, 0x47, 0x26, 0x5C, 0x00, 0x62, 0x06, 0x7B, 0x76, 0xDF,
-    0x65, 0x2D, 0x33, 0x21, 0x74, 0x8B, 0xB5, 0x26, 0xC4, 0x22, 0x51, 0xA8, 0x0F, 0xCB, 0xDA, 0xF9,
-    0xBF, 0x0C, 0x58, 0x57, 0xAD, 0xE6, 0xE8, 0x2B, 0x9C, 0x3F, 0x07, 0x7B, 0x97, 0x78, 0x71, 0xCC,
-    0x6E, 0xE3, 0x52, 0x23, 0xC2, 0xE2, 0x00, 0x7F, 0x3A, 0xC1, 0xB9, 0x20, 0xBD, 0xCC, 0x20, 0x27,
-    0xDB, 0x7D, 0xAF, 0xE5, 0xA3, 0x9C, 0x19, 0xFD, 0xC3, 0xA2, 0x02, 0xCD, 0xCE, 0x48, 0xA2, 0xFC,
-    0x38, 0xB1, 0xBA, 0xA5, 0xB6, 0x73, 0xC1, 0x61, 0x13, 0x48, 0xD9, 0x1B, 0x83, 0x55, 0x2F, 0x32,
-    0xBC, 0x7B, 0xE3, 0x99, 0x24, 0x78, 0x06, 0xFC, 0xF2, 0xED, 0x9B, 0xF3, 0x7F, 0xD5, 0x5B, 0xBD,
-    0x8F, 0xDC, 0xC8, 0x95, 0x7F, 0x24, 0x4F, 0x43, 0xAF, 0x18, 0xD0, 0x80, 0x57, 0xE7, 0xB5, 0x05,
-    0x6F, 0x3B, 0x30, 0x8C, 0xF5, 0x7E, 0x88, 0xA9, 0x03, 0xA9, 0x49, 0x5F, 0x70, 0xB1, 0x82, 0x1D,
-    0x2D, 0x60, 0x05, 0xEB, 0x60, 0x13, 0x1B, 0x30, 0x94, 0x38, 0x50, 0xB0, 0xEA, 0x26, 0xEC, 0xC0,
-    0x81, 0x83, 0x9D, 0xC4, 0xC0, 0x65, 0x56, 0x20, 0x18, 0xDA, 0x1E, 0xC0, 0xB3, 0x81, 0x02, 0xC1,
-    0xE8, 0x99, 0x26, 0xEE, 0xFE, 0x00, 0x77, 0x70, 0x80, 0x43, 0x73, 0x61, 0x2F, 0x60, 0xCB, 0x81,
-    0x09, 0xBB, 0x05, 0x73, 0x66, 0xC9, 0x2E, 0xFF, 0x7E, 0xAF, 0x48, 0xF6, 0x87, 0xB4, 0x23, 0x69,
-    0x34, 0x5F, 0xEE, 0xE9, 0x7A, 0xEC, 0x21, 0x8B, 0x55, 0xEF, 0xBD, 0xAA, 0x7A, 0x5F, 0xF5, 0x4A,
-    0x2E, 0x8E, 0x3E, 0x16, 0x91, 0x9E, 0x99, 0x2B, 0xAC, 0x65, 0xED, 0x13, 0x5B, 0x98, 0x12, 0x4E,
-    0x32, 0x42, 0x33, 0x05, 0x70, 0xFE, 0x99, 0x03, 0x7A, 0x7F, 0x2F, 0x08, 0x3F, 0x9D, 0x01, 0x06,
-    0xD3, 0x0A, 0x30, 0xCC, 0x76, 0xD9, 0x4E, 0x3A, 0x00, 0x8C, 0xF4, 0xE5, 0x58, 0xA2, 0x44, 0x64,
-    0x17, 0x4F, 0x44, 0x2A, 0x42, 0xC7, 0x18, 0x93, 0x8B, 0x0B, 0x58, 0x88, 0x77, 0x30, 0xDA, 0x9E,
-    0x89, 0x9F, 0x8B, 0x53, 0x36, 0x15, 0x7A, 0x80, 0x7B, 0xFA, 0x4A, 0x6C, 0x5F, 0x4F, 0x06, 0xDA,
-    0xA0, 0x6D, 0xDC, 0x19, 0x8D, 0x52, 0xBC, 0x39, 0x45, 0x1B, 0x59, 0x87, 0xE2, 0xD0, 0x24, 0x3E,
-    0x9A, 0xF4, 0x3E, 0xBB, 0x3C, 0x73, 0xC4, 0x2D, 0x85, 0xCD, 0xB4, 0x65, 0x63, 0xBB, 0x42, 0xFD,
-    0x2A, 0x3C, 0xD8, 0xAC, 0x40, 0x43, 0x35, 0xC4, 0xBD, 0x81, 0x16, 0x07, 0xBF, 0x3D, 0xDC, 0x8B,
-    0x2A, 0x10, 0xFD, 0xA1, 0x6F, 0xF2, 0x0F, 0xE5, 0x12, 0xDE, 0x78, 0x4D, 0x5E, 0x01, 0x7C, 0x5D,
-    0xAE, 0xB0, 0xBB, 0x47, 0x6C, 0xC3, 0x37, 0xA4, 0x4E, 0x7E, 0x93, 0x9E, 0x6F, 0xCE, 0xB8, 0xA9,
-    0x6C, 0xB9, 0x53, 0x6F, 0xEA, 0xCC, 0x77, 0x32, 0x99, 0x18, 0xF4, 0xFA, 0x27, 0x39, 0x11, 0x0E,
-    0x9D, 0x33, 0xBA, 0xD9, 0x7F, 0x4F, 0x31, 0xBA, 0xAA, 0x50, 0x07, 0x4B, 0x8A, 0xA5, 0xDF, 0x73,
-    0xC5, 0x74, 0x48, 0x1C, 0xE5, 0xC2, 0x71, 0xF3, 0xE3, 0xA1, 0x88, 0x0B, 0xBA, 0x7D, 0xE0, 0x11,
-    0x34, 0xC5, 0x3F, 0xC0, 0x3D, 0x0C, 0x80, 0xBC, 0x8A, 0xC2, 0xB5, 0xE5, 0xB2, 0x61, 0x8F, 0xC8,
-    0x84, 0x44, 0xA2, 0x07, 0x4A, 0xE4, 0xDA, 0xCA, 0x54, 0x72, 0xCD, 0x3C, 0x91, 0x08, 0xE4, 0x3B,
-    0xE6, 0xD1, 0xCE, 0xD4, 0xAB, 0xC5, 0x49, 0x43, 0x92, 0x10, 0x65, 0x4A, 0x2F, 0x31, 0x66, 0xB5,
-    0x3D, 0x82, 0xBA, 0x03, 0x55, 0x07, 0x16, 0xF7, 0xB4, 0x8A, 0x56, 0xD6, 0xD7, 0x62, 0x36, 0xD0,
-    0xE3, 0xC0, 0x04, 0xA5, 0xF6, 0xF3, 0xCB, 0x9B, 0x9C, 0x1D, 0x58, 0x3C, 0x81, 0x31, 0xE0, 0xCB,
-    0x25, 0x56, 0xBA, 0x98, 0xDA, 0x9E, 0x86, 0xB6, 0x39, 0x17, 0x3D, 0x7B, 0x4B, 0xB3, 0xBD, 0x67,
-    0xB6, 0x1C, 0x32, 0x6B, 0xFE, 0xFD, 0x69, 0x88, 0x96, 0x38, 0x1C, 0x76, 0x30, 0xBE, 0xA0, 0x24,
-    0xB6, 0x0E, 0xEB, 0xFA, 0xF5, 0x85, 0x9C, 0xEF, 0x82, 0x36, 0x50, 0x7E, 0x1D, 0x4F, 0xDF, 0x6C,
-    0x67, 0x8D, 0x83, 0xBB, 0x98, 0x2D, 0xE0, 0x4A, 0x98, 0x62, 0x82, 0xBC, 0xD3, 0x0C, 0xE2, 0x79,
-    0x60, 0x88, 0x7B, 0x17, 0x48, 0xE1, 0x69, 0x84, 0x06, 0x06, 0x71, 0xE2, 0x94, 0x41, 0x86, 0x75,
-    0x95, 0x9F, 0x0C, 0x43, 0x5E, 0xE9, 0x96, 0x94, 0xE2, 0x17, 0xC9, 0x13, 0x9F, 0x33, 0xE5, 0x85,
-    0x83, 0xAB, 0x57, 0x2C, 0xCA, 0xF2, 0xE7, 0x38, 0xF9, 0xF0, 0x86, 0x5C, 0xE4, 0xCA, 0xE8, 0xE3,
-    0xD1, 0xA7, 0x40, 0xC6, 0xFD, 0xBC, 0x68, 0xA5, 0x8B, 0xA2, 0x7A, 0x2E, 0x98, 0x01, 0x11, 0x7B,
-    0xD7, 0x9D, 0x41, 0x34, 0xED, 0x46, 0xA9, 0xC4, 0x78, 0x3F, 0x44, 0x93, 0x7E, 0x71, 0x22, 0x0C,
-    0x71, 0xB6, 0xE4, 0x03, 0x91, 0x92, 0x6B, 0x31, 0xA6, 0x90, 0xEB, 0x51, 0xA0, 0xF8, 0x44, 0x5C,
-    0xC5, 0x55, 0xF7, 0x99, 0x98, 0xBF, 0x40, 0xFE, 0xF2, 0x45, 0x80, 0x1A, 0x34, 0xBA, 0x26, 0x01,
-    0x56, 0x11, 0x45, 0x6F, 0x50, 0x54, 0x94, 0x3B, 0x5C, 0xD2, 0x25, 0x80, 0x53, 0xA9, 0x80, 0xEB,
-    0x40, 0xDD, 0x81, 0xEE, 0x9E, 0x56, 0xD1, 0xCA, 0xFA, 0x5A, 0xC8, 0x06, 0xA2, 0xAC, 0xC2, 0x62,
-    0x4D, 0xE6, 0xA3, 0x49, 0xDD, 0x76, 0xB4, 0xAF, 0x5D, 0x5F, 0x70, 0x38, 0x7F, 0x7B, 0x3F, 0x23,
-    0x03, 0x7A, 0x3F, 0x57, 0xC9, 0xF6, 0x73, 0x65, 0xE2, 0x2F, 0xC8, 0xCF, 0xDE, 0x47, 0xCA, 0x91,
-    0xB4, 0x85, 0x51, 0x1D, 0xA6, 0x14, 0xF1, 0xBF, 0x4B, 0xC5, 0xDF, 0x7F, 0x0F, 0x1C, 0x05, 0xD5,
-    0x93, 0x94, 0xF4, 0x43, 0xCA, 0x82, 0x13, 0x64, 0xA9, 0xD6, 0x5C, 0x83, 0xE1, 0xDA, 0x1D, 0xAD,
-    0xC9, 0xCA, 0x29, 0xA5, 0x29, 0x5A, 0x08, 0xCA, 0x0D, 0xD3, 0xB6, 0x2C, 0xC3, 0x39, 0xEA, 0x8B,
-    0x93, 0xA8, 0xDE, 0x9E, 0x6F, 0x09, 0x07, 0x6F, 0xAE, 0x10, 0x6C, 0x0D, 0xA6, 0x12, 0xCD, 0x08,
-    0x21, 0x90, 0x01, 0xC5, 0x28, 0x8C, 0x13, 0xC2, 0x28, 0x25, 0xEC, 0x65, 0x84, 0x61, 0x16, 0xE4,
-    0x84, 0x64, 0x68, 0x38, 0xB5, 0x70, 0xE7, 0xE0, 0x3E, 0xEF, 0xDB, 0xA7, 0x5D, 0x4D, 0xFB, 0x96,
-    0x6D, 0xC1, 0x2C, 0x5A, 0xEE, 0xA1, 0x97, 0x83, 0x6D, 0xF6, 0xD8, 0xF6, 0xBE, 0x25, 0x9D, 0xF6,
-    0x51, 0x96, 0x00, 0x38, 0x9B, 0xB7, 0xFE, 0x1F, 0x48, 0x9A, 0xCA, 0x82, 0xC5, 0x83, 0xA8, 0xEE,
-    0xA5, 0x98, 0x0A, 0x1F, 0xA5, 0x7E, 0x7D, 0xD3, 0xA4, 0x60, 0x93, 0x49, 0x95, 0x4B, 0x4A, 0xBA,
-    0x72, 0x61, 0x05, 0x84, 0xCB, 0xFF, 0xB2, 0x8A, 0x32, 0x47, 0x79, 0xA3, 0xAC, 0xB1, 0x9C, 0x51,
-    0xC6, 0x90, 0x2F, 0x1B, 0xA3, 0x91, 0x84, 0xC6, 0x10, 0xA9, 0xA5, 0x49, 0x64, 0xA6, 0x1C, 0x5A,
-    0x72, 0xA9, 0x5A, 0x51, 0x86, 0xAB, 0xC5, 0xC0, 0xFA, 0x42, 0x9D, 0x8C, 0xE5, 0xB0, 0x7A, 0x2C,
-    0xF3, 0xD1, 0x68, 0xAB, 0x69, 0x33, 0xA7, 0xD5, 0x46, 0x25, 0x3F, 0xB5, 0x60, 0xE9, 0x13, 0x61,
-    0x35, 0x0B, 0x27, 0x95, 0xB7, 0x7F, 0xB9, 0xE4, 0x80, 0x56, 0xE4, 0x80, 0x6A, 0x7B, 0x55, 0xF6,
-    0x00, 0xA3, 0xD1, 0x44, 0x62, 0xB4, 0xC2, 0x5F, 0xA3, 0x46, 0x52, 0x76, 0xAB, 0x96, 0xCB, 0x47,
-    0xD7, 0x0F, 0xD6, 0xC6, 0xF7, 0x7E, 0xCC, 0xE6, 0xB1, 0x44, 0x22, 0xB5, 0xD8, 0xDE, 0x85, 0x62,
-    0x93, 0x0D, 0x09, 0xF1, 0xE7, 0x3F, 0xDA, 0xC3, 0x04, 0x01, 0x56, 0xB7, 0xB6, 0x4E, 0x8F, 0x66,
-    0xD8, 0x63, 0x30, 0x0D, 0x5C, 0x90, 0x4B, 0x8B, 0x0C, 0x26, 0x07, 0x35, 0xED, 0x9F, 0xE4, 0xF4,
-    0xA8, 0x07, 0xF1, 0xCD, 0xD2, 0xA3, 0x8C, 0x59, 0x91, 0xA2, 0x27, 0x4E, 0xBD, 0x08, 0x27, 0xB3,
-    0x2A, 0x8C, 0x05, 0x58, 0xFB, 0x9C, 0x2C, 0xF5, 0x27, 0x4F, 0x61, 0xAF, 0xB1, 0x39, 0x1F, 0x36,
-    0x96, 0x26, 0x0B, 0x45, 0x0E, 0x2D, 0xCD, 0x0B, 0x27, 0x4B, 0x23, 0x91, 0xB9, 0xA1, 0x77, 0xF5,
-    0x79, 0xD2, 0xDA, 0xC0, 0x0A, 0xC2, 0x3F, 0x53, 0x89, 0xA9, 0xB6, 0xBB, 0x0E, 0xF3, 0x62, 0x23,
-    0x09, 0xB3, 0x28, 0xF1, 0x0A, 0x18, 0x59, 0xE4, 0xCD, 0x30, 0x6F, 0xA5, 0xF2, 0xA9, 0x4C, 0x04,
-    0xEA, 0x4C, 0x51, 0xA5, 0x29, 0xBB, 0x3A, 0x17, 0xA9, 0x76, 0xC3, 0xEA, 0xC9, 0x29, 0x71, 0xC2,
-    0x6B, 0x41, 0x8D, 0x5C, 0x89, 0xF8, 0x7C, 0x82, 0x7B, 0x4E, 0x89, 0xA7, 0x7E, 0x8E, 0xC6, 0xC3,
-    0xC4, 0xCF, 0x96, 0xD0, 0x70, 0x26, 0x90, 0xD5, 0x3D, 0xBE, 0x6C, 0x0E, 0xB6, 0x2B, 0x0F, 0xD2,
-    0xFB, 0x5B, 0xE1, 0xAC, 0x6D, 0x5E, 0x7D, 0x9E, 0x2F, 0xB0, 0x2F, 0x46, 0x1F, 0x53, 0x4D, 0x9A,
-    0xAA, 0xE9, 0x59, 0x86, 0xAC, 0x12, 0xB3, 0x72, 0x4C, 0xFC, 0x62, 0x2E, 0xC2, 0x98, 0xF8, 0xC5,
-    0x3E, 0x6A, 0xC7, 0xAE, 0xF9, 0xEC, 0x86, 0x81, 0x50, 0x00, 0x35, 0x10, 0xFF, 0x10, 0x0B, 0x17,
-    0xA0, 0x4C, 0x9D, 0x7B, 0x44, 0x5F, 0xFD, 0x1A, 0x4A, 0x8B, 0x98, 0x0C, 0xAB, 0xE8, 0x0A, 0xE5,
-    0xF2, 0x60, 0x85, 0x57, 0x75, 0x40, 0x0D, 0xF1, 0xBB, 0x75, 0x0D, 0x11, 0x3D, 0xA1, 0x21, 0xC2,
-    0x55, 0xA0, 0x1A, 0xA2, 0xD7, 0x69, 0x88, 0x61, 0xA7, 0x21, 0xFE, 0xD0, 0x69, 0x88, 0x30, 0x6D,
-    0x55, 0x51, 0xA4, 0x66, 0x11, 0xA7, 0xB2, 0x91, 0xF0, 0x2F, 0x37, 0x2B, 0xAA, 0x8C, 0x02, 0x0C,
-    0xE2, 0x40, 0x6D, 0x88, 0x9B, 0x48, 0x90, 0x06, 0x09, 0xFC, 0xB5, 0x09, 0x8D, 0x79, 0x22, 0xFD,
-    0xD6, 0x96, 0x9C, 0x17, 0x4E, 0x6E, 0x61, 0xD6, 0x49, 0xE1, 0x60, 0x8A, 0xED, 0xED, 0x50, 0x43,
-    0xD3, 0x82, 0xDB, 0x28, 0xE5, 0x7C, 0x31, 0x51, 0x5C, 0x69, 0x5D, 0xD8, 0x05, 0x58, 0xFD, 0x9C,
-    0x29, 0x13, 0xD5, 0x3F, 0x71, 0xD9, 0x9D, 0x47, 0xD6, 0x39, 0xB3, 0xA7, 0xC8, 0xF0, 0xB3, 0x67,
-    0xE2, 0xD9, 0xB3, 0x49, 0x3F, 0x3E, 0xED, 0x9A, 0x40, 0x87, 0x91, 0xFD, 0x85, 0xBC, 0xF7, 0x8E,
-    0x34, 0x51, 0x00, 0x79, 0x8D, 0xE0, 0xC3, 0x36, 0x26, 0xE1, 0x2C, 0xF4, 0x62, 0x7E, 0xDE, 0xD8,
-    0x79, 0x9F, 0x58, 0x31, 0x16, 0x18, 0x18, 0xFC, 0x1B, 0x7D, 0x04, 0x8A, 0xEE, 0x10, 0xD5, 0x99,
-    0xEA, 0xB9, 0xF6, 0x33, 0xE6, 0x74, 0xA0, 0xAF, 0xF0, 0xDC, 0x00, 0x0A, 0x64, 0x7B, 0x06, 0xC6,
-    0x19, 0x0B, 0x5E, 0xE8, 0xDD, 0x05, 0x90, 0xEF, 0x68, 0xBC, 0x89, 0x4E, 0x3A, 0x0D, 0xC9, 0xE0,
-    0x8F, 0x05, 0xBD, 0xC6, 0x8A, 0x8A, 0xF8, 0x4A, 0x8B, 0xDB, 0x22, 0x48, 0xF5, 0x0C, 0x10, 0x40,
-    0x2A, 0xF4, 0x87, 0x50, 0x11, 0xF1, 0xFE, 0x7B, 0x95, 0xC4, 0x53, 0xCC, 0x0A, 0xCC, 0x95, 0x41,
-    0xA3, 0x6D, 0x8E, 0x0E, 0xE8, 0xB4, 0x61, 0x3A, 0x90, 0x6B, 0xC1, 0xFA, 0xC5, 0xE8, 0x27, 0x6D,
-    0x2E, 0xDB, 0x07, 0xA3, 0xD1, 0xCE, 0x41, 0xF2, 0xD4, 0x9A, 0x1E, 0xD4, 0x28, 0x64, 0x97, 0x67,
-    0xD4, 0x77, 0x69, 0x2F, 0x4F, 0xAD, 0x79, 0xC4, 0x8B, 0xFA, 0x6F, 0x0B, 0xF3, 0xEC, 0xAB, 0x8F,
-    0x37, 0x13, 0xEB, 0xF1, 0x4E, 0xE8, 0xF1, 0x2E, 0x1B, 0x6F, 0xFF, 0x79, 0x5D, 0xBC, 0x4F, 0xE1,
-    0xCA, 0x78, 0x7F, 0xC5, 0x13, 0xCF, 0x24, 0x51, 0xE6, 0x61, 0xD6, 0xE4, 0xDE, 0x0C, 0xCF, 0x50,
-    0xE5, 0xC8, 0xC0, 0x49, 0x30, 0x2F, 0x2B, 0x2F, 0x8D, 0xCD, 0x4E, 0x72, 0xB5, 0x37, 0x97, 0x9F,
-    0xA8, 0x06, 0xB4, 0x9F, 0xC0, 0x94, 0x28, 0x18, 0xDA, 0xE1, 0xD6, 0x21, 0x2E, 0xF4, 0x8B, 0x96,
-    0x44, 0xDB, 0x64, 0x71, 0x12, 0x57, 0x7A, 0x65, 0x00, 0xDD, 0xB0, 0x23, 0x0F, 0x7A, 0xB5, 0x7C,
-    0xE2, 0x2E, 0xFA, 0x96, 0xFE, 0xF1, 0xF4, 0xF7, 0xE6, 0xE8, 0xDE, 0xD0, 0x94, 0x43, 0xD3, 0x48,
-    0xCE, 0xC8, 0xE4, 0x91, 0x29, 0x1C, 0xAC, 0xB3, 0x4A, 0x8E, 0xF2, 0xAD, 0xD1, 0x42, 0x81, 0xEF,
-    0x8F, 0x46, 0x77, 0x27, 0xA6, 0xC0, 0xB7, 0xC1, 0xB6, 0x3C, 0x4A, 0x6B, 0x3F, 0x90, 0x37, 0x6E,
-    0xCB, 0xED, 0x78, 0xBB, 0x08, 0xCD, 0xD4, 0xFD, 0xAD, 0x1C, 0x2F, 0x86, 0x77, 0xE5, 0x83, 0x07,
-    0x52, 0x0C, 0xB6, 0xF1, 0x3B, 0xDB, 0xD8, 0x97, 0x97, 0xC1, 0x73, 0x62, 0xD2, 0x89, 0xC9, 0xFC,
-    0x7D, 0xD1, 0x19, 0xF3, 0xE2, 0xDF, 0x19, 0x5A, 0xC8, 0xF0, 0xA5, 0x80, 0x78, 0xC8, 0xC8, 0xB0,
-    0xAB, 0x5F, 0x67, 0x9E, 0x32, 0xBE, 0x74, 0x41, 0x9C, 0xD4, 0x2F, 0xFC, 0xA2, 0x15, 0xC4, 0x5E,
-    0xCE, 0xA9, 0x79, 0xF8, 0x9F, 0x9F, 0x85, 0x68, 0xEC, 0x1A, 0xFE, 0xE2, 0x7B, 0xBD, 0x19, 0x9C,
-    0xEA, 0x2D, 0xF6, 0x82, 0xAF, 0x5B, 0x2C, 0x7B, 0x58, 0xC7, 0x83, 0x76, 0x3F, 0x5E, 0xFF, 0xA0,
-    0xE5, 0x28, 0xC1, 0x93, 0x28, 0x41, 0xEB, 0xB4, 0xEC, 0x4F, 0x0C, 0xCC, 0xA4, 0xE9, 0x48, 0xC1,
-    0x42, 0x73, 0x34, 0xFA, 0xF4, 0xC6, 0xBC, 0xB1, 0xFC, 0x34, 0x96, 0x4B, 0x45, 0xF7, 0x1A, 0xF8,
-    0x39, 0x44, 0xAD, 0x21, 0x04, 0x69, 0xDF, 0x06, 0xBA, 0x97, 0x96, 0x54, 0x2F, 0x61, 0xE4, 0xFF,
-    0x65, 0x8B, 0x3C, 0x51, 0x80, 0xD0, 0xB7, 0x61, 0x2F, 0xC7, 0xD4, 0xD0, 0x79, 0x13, 0xCE, 0xC6,
-    0x75, 0x38, 0x83, 0x99, 0xBF, 0x8B, 0x11, 0x8D, 0x92, 0x60, 0xD9, 0xC8, 0xA7, 0x92, 0x0E, 0x4F,
-    0xA1, 0x40, 0x19, 0x6F, 0xC2, 0x36, 0x9E, 0xCC, 0xAD, 0xCB, 0xA1, 0x2E, 0xE1, 0x77, 0xA8, 0xBC,
-    0xA0, 0xBA, 0xA0, 0xB8, 0xA0, 0xB6, 0x16, 0x4A, 0xAB, 0x2F, 0x56, 0x7D, 0x1C, 0xF1, 0xDB, 0xA7,
-    0x6D, 0xF3, 0xEB, 0x4A, 0x20, 0x32, 0x27, 0x53, 0x2A, 0x67, 0xDD, 0x1D, 0x19, 0x62, 0xF5, 0x38,
-    0x15, 0x00, 0x06, 0xB2, 0xB2, 0x2E, 0x55, 0xCC, 0x85, 0x0D, 0x84, 0x2A, 0x46, 0x11, 0x2B, 0x86,
-    0xB9, 0x2A, 0x9A, 0x38, 0xDC, 0xE5, 0x90, 0x39, 0x8D, 0x64, 0x8D, 0xCF, 0x98, 0x5F, 0x60, 0x22,
-    0xCF, 0x3D, 0x5D, 0xAE, 0x35, 0x01, 0x37, 0x41, 0x18, 0x46, 0xA8, 0xE8, 0x61, 0x55, 0xE2, 0xB3,
-    0x3D, 0x97, 0x2D, 0xC3, 0x82, 0x20, 0xD7, 0xD9, 0x5B, 0x6F, 0x39, 0xB0, 0xB3, 0x30, 0x6E, 0xAC,
-    0x5D, 0xD4, 0x99, 0x44, 0xFF, 0xD1, 0x58, 0x44, 0xFD, 0x43, 0x8B, 0x5B, 0xF6, 0xA1, 0x5E, 0xFA,
-    0x60, 0x61, 0x5F, 0x26, 0xD2, 0x47, 0x57, 0xFD, 0xA0, 0x90, 0x3E, 0x6C, 0xA1, 0x3E, 0x50, 0xE9,
-    0x43, 0xFF, 0xC7, 0x58, 0xD0, 0x31, 0xD0, 0x8C, 0x81, 0x65, 0x1F, 0x48, 0xF6, 0x81, 0x23, 0xEA,
-    0x67, 0x7D, 0x60, 0xD8, 0x07, 0xC1, 0x7D, 0x52, 0xDE, 0x7E, 0x74, 0x44, 0x52, 0xEB, 0x1E, 0x5F,
-    0x69, 0xBC, 0xF6, 0x2F, 0x93, 0x71, 0x6E, 0x19, 0x4B, 0x50, 0x60, 0x56, 0x65, 0x31, 0xDE, 0x8F,
-    0x1D, 0x18, 0x00, 0xE0, 0x15, 0x0D, 0xBE, 0x98, 0x51, 0xC9, 0x09, 0x0A, 0xF8, 0x11, 0xFF, 0x1E,
-    0xFD, 0xFC, 0x57, 0x89, 0xFA, 0x78, 0xCE, 0x7A, 0x5A, 0x3F, 0xCC, 0x63, 0xF4, 0x13, 0xB3, 0x9F,
-    0x8F, 0xED, 0x1E, 0x0F, 0xB7, 0x78, 0xB8, 0xC3, 0xC3, 0x79, 0xBF, 0xBC, 0xBF, 0x13, 0xC9, 0x31,
-    0x2A, 0xB0, 0xB6, 0x3C, 0x1A, 0xDD, 0x83, 0x2F, 0x5C, 0xB2, 0xC8, 0x7D, 0xAF, 0xF4, 0x8B, 0x10,
-    0x38, 0xDD, 0x56, 0xF3, 0x27, 0x7E, 0xE1, 0xBF, 0xF1, 0x33, 0x3C, 0xFA, 0xA3, 0x14, 0xB3, 0x12,
-    0x2C, 0x59, 0x1F, 0x89, 0x64, 0x65, 0x24, 0x8E, 0x82, 0xB3, 0x72, 0x36, 0x89, 0x30, 0xEA, 0x1F,
-    0xC2, 0x3B, 0xBE, 0x0E, 0x1A, 0xFC, 0x69, 0xA5, 0x25, 0xC8, 0x30, 0x4F, 0x61, 0x14, 0x86, 0xC0,
-    0xE3, 0x4B, 0xC7, 0x46, 0xC3, 0x25, 0x27, 0x89, 0xC1, 0x63, 0x98, 0xDB, 0xA1, 0xC4, 0xAF, 0x4B,
-    0xFC, 0xF6, 0x4B, 0xAD, 0xD8, 0xE7, 0xE7, 0xF8, 0xB7, 0x74, 0x11, 0xDA, 0x32, 0x7E, 0x7E, 0x6C,
-    0x9F, 0x89, 0xC3, 0x2B, 0x74, 0x71, 0xF8, 0x8D, 0x9E, 0x8D, 0xAD, 0x5B, 0x3C, 0x19, 0xCD, 0x3B,
-    0x04, 0xC0, 0xEF, 0xF1, 0x1E, 0x43, 0x22, 0x7B, 0x98, 0x9B, 0x00, 0x18, 0xEF, 0x80, 0xCE, 0x55,
-    0x5C, 0xB4, 0xE0, 0x2B, 0x5F, 0xF8, 0x2E, 0x8C, 0xDE, 0x84, 0xB6, 0x6E, 0xAA, 0x80, 0x1B, 0x21,
-    0xE5, 0x21, 0xDF, 0xC4, 0xF9, 0x7C, 0x0A, 0xE5, 0xE3, 0x98, 0x24, 0xC0, 0xF2, 0x2C, 0x25, 0x3A,
-    0xAC, 0x32, 0x9D, 0x59, 0x9A, 0x78, 0x41, 0xD1, 0xEE, 0xC4, 0x6A, 0xE0, 0xE8, 0xCE, 0x62, 0xA7,
-    0xB8, 0xF9, 0xD0, 0x07, 0x1C, 0x13, 0xEB, 0x31, 0x93, 0x0C, 0xC6, 0x34, 0xB3, 0xC6, 0x34, 0xE1,
-    0xC6, 0xDC, 0x2C, 0x19, 0x57, 0x13, 0x02, 0xBC, 0x3A, 0xAE, 0x20, 0x8F, 0xC6, 0x14, 0xA2, 0xE3,
-    0x0A, 0x4B, 0x7F, 0x5C, 0x41, 0x12, 0x8C, 0x29, 0x5D, 0xC7, 0x94, 0xB3, 0x63, 0x0A, 0xCC, 0x31,
-    0x05, 0x26, 0x80, 0x57, 0x8C, 0x29, 0x30, 0xC7, 0xB4, 0x90, 0x08, 0x86, 0x04, 0x11, 0x37, 0x5B,
-    0x42, 0x02, 0x5F, 0xB7, 0x5D, 0x2A, 0xAB, 0xBA, 0xE8, 0xAE, 0x36, 0x3B, 0xB1, 0x64, 0x89, 0xBF,
-    0x88, 0xD5, 0x5D, 0x85, 0xC3, 0x72, 0x0D, 0xC6, 0x24, 0xDD, 0x15, 0x78, 0x2B, 0x73, 0x3A, 0x2B,
-    0x1C, 0x9F, 0x17, 0x2D, 0x67, 0x47, 0xDF, 0xAA, 0x81, 0x6D, 0x59, 0x3F, 0x5E, 0xF1, 0x8A, 0x25,
-    0x39, 0x5E, 0x5A, 0x17, 0x1B, 0x87, 0xB3, 0x66, 0x67, 0xBB, 0xDD, 0xAD, 0x4F, 0xAC, 0x4A, 0xBE,
-    0x2B, 0x6F, 0x10, 0x91, 0x92, 0xBB, 0x57, 0x78, 0x14, 0xFC, 0x2D, 0x6B, 0x76, 0xEF, 0xA5, 0x3E,
-    0x0F, 0x73, 0xC2, 0x4D, 0x9C, 0x2D, 0xB7, 0x80, 0xB3, 0x56, 0x31, 0x10, 0x5A, 0xDB, 0x8D, 0x69,
-    0x3F, 0x3F, 0xF6, 0x39, 0xA1, 0x91, 0x12, 0xBB, 0x8B, 0x6A, 0xAD, 0xBC, 0x36, 0xCD, 0x43, 0xBA,
-    0x81, 0x92, 0xF1, 0x15, 0x1F, 0xDA, 0xF0, 0x61, 0x1C, 0x63, 0x59, 0x5F, 0x8F, 0xEB, 0x1B, 0xB5,
-    0xDA, 0x5B, 0x13, 0xDD, 0x3B, 0x8D, 0x75, 0xE2, 0xC6, 0xBA, 0xA6, 0x22, 0x7D, 0xED, 0xE5, 0xE0,
-    0x53, 0xF9, 0x5D, 0xAE, 0xF1, 0x3B, 0xED, 0xF8, 0x5D, 0x90, 0xDF, 0x25, 0xB9, 0xAC, 0xFC, 0x9E,
-    0x28, 0xBF, 0x53, 0xB2, 0x9A, 0xFC, 0xF6, 0xC9, 0x6A, 0xAF, 0x24, 0x83, 0xAB, 0x8E, 0xD5, 0xF1,
-    0x3A, 0xAB, 0x5B, 0x31, 0x6A, 0x67, 0x24, 0x7F, 0x51, 0x66, 0x5C, 0xB8, 0x39, 0xA3, 0x2F, 0x9A,
-    0x37, 0x01, 0x11, 0xB9, 0xDE, 0xB2, 0x7D, 0x6B, 0x8D, 0xED, 0xC3, 0x23, 0x4E, 0xCF, 0xF5, 0x32,
-    0x80, 0x35, 0x5B, 0x77, 0xD6, 0xEC, 0xC5, 0xD1, 0x48, 0xC3, 0xC1, 0x46, 0x3D, 0x62, 0xB3, 0x16,
-    0x7E, 0xDB, 0xD0, 0xAD, 0xD8, 0x21, 0x8D, 0x36, 0xD7, 0x7C, 0x36, 0x29, 0xC5, 0x2F, 0xC5, 0xAD,
-    0x35, 0x0C, 0x3E, 0xD4, 0xC1, 0xD4, 0xA8, 0x11, 0x98, 0x30, 0x54, 0x91, 0x47, 0xA6, 0x06, 0x39,
-    0xE7, 0xB5, 0x5F, 0xD4, 0x2A, 0x72, 0xAB, 0x25, 0x58, 0x77, 0xD0, 0x2F, 0x6C, 0x4D, 0xFB, 0x96,
-    0x6D, 0x81, 0x62, 0x29, 0x4A, 0x69, 0xE4, 0x0D, 0xB9, 0x43, 0xEE, 0xCC, 0xB9, 0x45, 0x7E, 0xAB,
-    0xD4, 0x1D, 0x04, 0x65, 0xCE, 0xBC, 0xDB, 0xE1, 0x84, 0x7B, 0x4A, 0x43, 0xB2, 0xE0, 0xB3, 0x95,
-    0x20, 0x7F, 0x64, 0x74, 0x1B, 0x10, 0xBE, 0x52, 0xFD, 0x9E, 0x62, 0x39, 0x64, 0x84, 0x2E, 0x62,
-    0x78, 0x8B, 0xD6, 0x4B, 0x03, 0xD8, 0x61, 0xD0, 0x01, 0xFD, 0x97, 0x3B, 0x18, 0x00, 0x5A, 0x59,
-    0x5F, 0xF3, 0xF6, 0x37, 0x6A, 0xDB, 0x94, 0x36, 0xDA, 0xA6, 0x52, 0x6C, 0xA8, 0x99, 0x49, 0x43,
-    0x33, 0x78, 0x44, 0x12, 0x54, 0x01, 0xAD, 0x6C, 0xFB, 0x9D, 0x67, 0xBE, 0xDD, 0x85, 0x4F, 0x0E,
-    0xFF, 0x94, 0x41, 0xEB, 0xED, 0xBC, 0x21, 0x6C, 0xE1, 0x3C, 0x9F, 0x06, 0x07, 0xE5, 0x3E, 0x35,
-    0x90, 0x5B, 0x46, 0x9A, 0xF5, 0x31, 0x54, 0x67, 0x49, 0xB7, 0xA6, 0x55, 0x36, 0xBF, 0xED, 0xA5,
-    0xFF, 0x16, 0x7C, 0xBC, 0x98, 0xDE, 0x47, 0xDD, 0x9F, 0xE2, 0x59, 0x4C, 0x0D, 0x3A, 0x66, 0x86,
-    0x59, 0x01, 0xDB, 0xDF, 0xCD, 0xBE, 0x7B, 0xAA, 0xCC, 0x6C, 0x02, 0xC3, 0x8C, 0xDC, 0x95, 0x1A,
-    0x34, 0x36, 0x15, 0xB8, 0xB4, 0x83, 0x0B, 0x08, 0xD0, 0x54, 0x82, 0x5C, 0x2F, 0x60, 0x94, 0xA6,
-    0x11, 0x68, 0x50, 0x8E, 0xBA, 0x9F, 0x97, 0x3D, 0x7B, 0xA9, 0xED, 0x85, 0xD9, 0x1C, 0x07, 0xA3,
-    0xBB, 0x95, 0x0A, 0x81, 0xD9, 0xD2, 0x65, 0x51, 0x65, 0x6F, 0xE5, 0xF5, 0xA6, 0x31, 0x70, 0x4D,
-    0xB3, 0x15, 0x34, 0xF9, 0x41, 0x9A, 0x6E, 0xC9, 0xB8, 0x83, 0xD1, 0x7D, 0x72, 0xCE, 0x68, 0x30,
-    0x4C, 0x2F, 0x36, 0x17, 0x6C, 0x89, 0x39, 0x49, 0x60, 0xF9, 0x93, 0xC7, 0x64, 0xD1, 0xFE, 0xCD,
-    0x72, 0xFE, 0xDF, 0xEA, 0x45, 0xC2, 0x99, 0x1D, 0x6A, 0x2A, 0x06, 0xBC, 0xA4, 0x84, 0x91, 0xE9,
-    0x69, 0x13, 0x97, 0xCE, 0x9A, 0xD0, 0xF4, 0xA3, 0xD1, 0x44, 0x39, 0xC7, 0xBD, 0x42, 0xFB, 0xFF,
-    0x48, 0xEF, 0x67, 0x56, 0xC2, 0xF5, 0x9A, 0x54, 0x9D, 0x68, 0x6A, 0x03, 0xD2, 0x71, 0x63, 0x8F,
-    0x4D, 0xB8, 0x56, 0xC1, 0xC9, 0xCA, 0x24, 0xB7, 0xD8, 0x6F, 0x11, 0x53, 0xDE, 0x81, 0x9F, 0xBE,
-    0xCE, 0xB2, 0xEB, 0x4D, 0x64, 0x57, 0x33, 0xC8, 0x28, 0x08, 0x9D, 0x6E, 0x17, 0x51, 0xC3, 0xEE,
-    0xAF, 0xAF, 0x6D, 0x70, 0xDF, 0xD3, 0xBC, 0x98, 0x54, 0x34, 0xAB, 0xB0, 0x22, 0xED, 0x8D, 0x37,
-    0xAC, 0x96, 0xB4, 0xEC, 0x76, 0xA0, 0xB6, 0x71, 0x26, 0x6A, 0x08, 0x99, 0x6F, 0xDE, 0xD2, 0x4C,
-    0x9A, 0x44, 0x94, 0x25, 0xF5, 0xB2, 0xFB, 0x9B, 0xB6, 0x4E, 0xB4, 0x5F, 0xB4, 0x3E, 0xB5, 0x6D,
-    0x6F, 0x4F, 0x7D, 0x60, 0x4D, 0xBB, 0xC9, 0xB8, 0x87, 0x87, 0x47, 0x18, 0x59, 0x50, 0xD6, 0x97,
-    0x2E, 0x68, 0x7E, 0x35, 0xA8, 0xAE, 0xC5, 0xD5, 0xB5, 0xBD, 0xFF, 0x01, 0xB5, 0x54, 0x97, 0xC9,
-    0x73, 0x79, 0x09, 0x67, 0x46, 0xC5, 0x53, 0x3D, 0xF9, 0xEC, 0x09, 0x4F, 0xFE, 0xC8, 0x84, 0x35,
-    0x73, 0x4C, 0x2B, 0x5F, 0xD3, 0x9D, 0x91, 0x07, 0x3A, 0xC2, 0x17, 0x99, 0x64, 0x15, 0x64, 0x70,
-    0x0F, 0xDD, 0x19, 0xD3, 0x46, 0xE7, 0x9C, 0x13, 0x0C, 0xEA, 0xD8, 0x59, 0x73, 0xE6, 0xC3, 0xFB,
-    0x81, 0x7C, 0xAD, 0x0F, 0x81, 0xF2, 0x7F, 0x85, 0x6F, 0x32, 0x78, 0x1D, 0x76, 0x47, 0xE9, 0x25,
-    0xB8, 0xF0, 0xB4, 0xD4, 0xCB, 0x25, 0x42, 0x6F, 0x99, 0x2D, 0x8F, 0xB9, 0xA8, 0xF3, 0xED, 0x12,
-    0xF4, 0xBF, 0x1A, 0x27, 0xAB, 0xC9, 0x63, 0x9A, 0xD8, 0x31, 0xA3, 0x88, 0x61, 0xE4, 0x66, 0x9F,
-    0x59, 0x62, 0xF8, 0x31, 0x29, 0x9A, 0x4D, 0xE4, 0xBA, 0xB1, 0x5B, 0x07, 0x4D, 0xD9, 0xFD, 0x32,
-    0x73, 0x58, 0x7F, 0xF9, 0xFE, 0x8C, 0x02, 0x3B, 0xA2, 0xC0, 0xD4, 0x25, 0xFF, 0x43, 0x5B, 0xD5,
-    0x6B, 0x0C, 0x4B, 0xBA, 0xE7, 0x57, 0x96, 0x76, 0x20, 0x51, 0x2F, 0xE4, 0x42, 0x9E, 0xBE, 0x9F,
-    0x34, 0xE6, 0x89, 0xED, 0x9F, 0xF2, 0xAB, 0xA6, 0x30, 0xA1, 0xAA, 0xD2, 0x48, 0x60, 0x6A, 0x47,
-    0x89, 0x22, 0x86, 0x51, 0x9F, 0x60, 0x7A, 0x47, 0x6E, 0x65, 0xE8, 0x0B, 0x6B, 0xB8, 0xB4, 0x8B,
-    0x97, 0x99, 0x95, 0xC1, 0x4A, 0x66, 0x25, 0x33, 0x96, 0x8B, 0x53, 0xA5, 0xF7, 0xEB, 0x89, 0x4D,
-    0xF6, 0x63, 0xAE, 0xF1, 0x63, 0x06, 0x0B, 0x06, 0x10, 0x1D, 0x41, 0x72, 0x22, 0xF4, 0x9E, 0x06,
-    0x4D, 0x97, 0x53, 0xBB, 0x20, 0x99, 0xBB, 0xA8, 0x4E, 0xEE, 0xD8, 0x46, 0xDA, 0x19, 0x73, 0x9C,
-    0xA4, 0xC7, 0x4B, 0x53, 0xAF, 0x91, 0xB3, 0x7C, 0x51, 0x63, 0x02, 0x33, 0x75, 0xDB, 0x18, 0xFF,
-    0xE5, 0x6A, 0x58, 0x24, 0x48, 0x32, 0x8D, 0xAD, 0x49, 0x90, 0x5C, 0xCE, 0xF3, 0x38, 0x85, 0xF1,
-    0xFD, 0x1A, 0x13, 0x5E, 0xD2, 0x48, 0xAD, 0x0A, 0x87, 0xE6, 0xE7, 0x50, 0xF3, 0xF4, 0x4E, 0x64,
-    0x3E, 0x53, 0x81, 0x16, 0x0B, 0xB0, 0x9C, 0x67, 0x7A, 0xC2, 0xE0, 0x41, 0x9B, 0xE4, 0xEE, 0xCE,
-    0x3B, 0x8F, 0xCD, 0xEE, 0x3B, 0xA7, 0x4D, 0xF2, 0x08, 0xFD, 0x44, 0xD6, 0x28, 0x38, 0x40, 0x18,
-    0x83, 0x9E, 0xA9, 0x86, 0xA6, 0xFA, 0xEA, 0xE3, 0x77, 0x9F, 0x67, 0xEB, 0x01, 0x36, 0x9C, 0x98,
-    0x9A, 0xCB, 0x14, 0x0B, 0x23, 0x64, 0x3A, 0xA9, 0xFA, 0xCF, 0xFA, 0x05, 0x9D, 0x86, 0xB9, 0x6D,
-    0x1F, 0x30, 0x8A, 0x3C, 0xE3, 0x36, 0x2A, 0x39, 0x47, 0xDF, 0x48, 0xB7, 0x8D, 0x9D, 0xB5, 0xF4,
-    0xD4, 0xB3, 0xE2, 0x90, 0x46, 0x99, 0x07, 0xDD, 0x72, 0xA0, 0x59, 0x5D, 0x38, 0xB9, 0xD3, 0xA4,
-    0x31, 0x83, 0x1B, 0xB0, 0xC8, 0x2A, 0x01, 0x3F, 0x56, 0xD2, 0x9B, 0x9F, 0x59, 0x18, 0x45, 0xE0,
-    0x3C, 0xD4, 0xEC, 0xA2, 0x5A, 0x53, 0x4D, 0xD7, 0x69, 0x54, 0x0E, 0x1C, 0x0A, 0x9C, 0xCD, 0xFA,
-    0x5D, 0xEE, 0xE8, 0xCE, 0x2D, 0xB0, 0x96, 0xCC, 0xB3, 0x5F, 0x5B, 0x07, 0x87, 0x8E, 0xEE, 0x5B,
-    0x07, 0xF7, 0x62, 0x53, 0xBD, 0x75, 0x70, 0xFF, 0xB0, 0xD1, 0x05, 0xF6, 0x17, 0xE4, 0x4B, 0x18,
-    0xA6, 0xFC, 0x6D, 0x2E, 0x8C, 0xB1, 0xB8, 0x53, 0x88, 0x0D, 0x37, 0x0D, 0x96, 0x0D, 0xFD, 0x23,
-    0x6E, 0xD5, 0x3F, 0x13, 0x78, 0xB4, 0xF2, 0xD5, 0xCB, 0x08, 0x72, 0x08, 0xE4, 0x28, 0x0B, 0xF7,
-    0x6F, 0x18, 0x06, 0xFF, 0x6A, 0xBA, 0x14, 0x79, 0x93, 0xB8, 0xF5, 0xAA, 0x7C, 0x13, 0x2B, 0xF1,
-    0x13, 0xCF, 0x1C, 0x14, 0xC1, 0xF7, 0xCC, 0x34, 0x90, 0x37, 0x3B, 0x51, 0x8D, 0xD1, 0xED, 0xA3,
-    0xC4, 0xCF, 0x59, 0x86, 0x28, 0x13, 0x2C, 0x75, 0x13, 0x27, 0xAE, 0x89, 0xF2, 0xCB, 0x06, 0x62,
-    0x20, 0x76, 0x4D, 0x19, 0xA9, 0xD7, 0xF0, 0x45, 0x4E, 0xEB, 0x99, 0x52, 0xDF, 0x1C, 0x77, 0xCA,
-    0xDC, 0xA5, 0xE3, 0x4E, 0xC7, 0x4A, 0xF5, 0xC2, 0xE5, 0x1C, 0x58, 0x97, 0x33, 0x5B, 0x77, 0x39,
-    0xCF, 0x94, 0x7E, 0x37, 0x75, 0x78, 0xA8, 0x29, 0x73, 0x0E, 0x9A, 0x43, 0x4D, 0x97, 0x17, 0x09,
-    0xB4, 0xC7, 0xCA, 0x07, 0xEB, 0xA9, 0x51, 0x7E, 0x85, 0xBF, 0xC2, 0xFC, 0xFA, 0x06, 0x8D, 0x30,
-    0x05, 0xAF, 0xFB, 0xAD, 0x40, 0x75, 0x1E, 0x9E, 0x1B, 0xB6, 0xD8, 0xAD, 0x94, 0xD2, 0x32, 0xE0,
-    0x36, 0xE4, 0xF3, 0x4F, 0x50, 0xAE, 0xF6, 0xAC, 0x44, 0xDA, 0xC8, 0x4F, 0x86, 0x45, 0xEA, 0x55,
-    0xF7, 0xFE, 0xB7, 0xF3, 0xAA, 0xE9, 0x74, 0xCD, 0xE8, 0x55, 0x4F, 0xDF, 0x3E, 0x3F, 0x8C, 0xF9,
-    0x3A, 0x2C, 0xCC, 0x21, 0x0D, 0xF8, 0x30, 0x73, 0x66, 0x30, 0x02, 0xA6, 0xD7, 0xA0, 0xC1, 0x3E,
-    0x39, 0x11, 0x86, 0x9C, 0x0D, 0xA1, 0xB3, 0x36, 0xF3, 0xD7, 0x5B, 0x78, 0x63, 0x1D, 0x08, 0xF6,
-    0xDB, 0xE4, 0x2D, 0x88, 0x4D, 0xD2, 0x4A, 0x10, 0xBF, 0x30, 0x18, 0x12, 0x4C, 0x68, 0x15, 0x19,
-    0x21, 0xE5, 0x42, 0xD2, 0x69, 0x34, 0xC5, 0xB0, 0x8E, 0xCA, 0x98, 0x51, 0x96, 0x87, 0x5D, 0x16,
-    0x5B, 0xD6, 0x7A, 0x86, 0x0A, 0xBC, 0x03, 0x69, 0xC3, 0xE7, 0xAF, 0x76, 0x59, 0xB7, 0x6D, 0xE2,
-    0x6D, 0x93, 0x7B, 0x2B, 0x4D, 0xFA, 0xAD, 0x34, 0x19, 0xB8, 0x9A, 0xC1, 0xEC, 0x3F, 0x99, 0xFB,
-    0x48, 0x2C, 0xC2, 0x0C, 0x4C, 0x19, 0xAA, 0x01, 0xE2, 0x15, 0xB1, 0xBA, 0x82, 0x5E, 0x41, 0xB7,
-    0xB1, 0xC0, 0xBB, 0x30, 0x32, 0x07, 0x05, 0xCC, 0x32, 0x54, 0xDA, 0xE5, 0x61, 0x41, 0x5C, 0xAB,
-    0x4A, 0xCF, 0x67, 0x38, 0xE5, 0x18, 0xFE, 0xB7, 0x9F, 0xBB, 0xC5, 0x1D, 0x4D, 0x66, 0xF0, 0x8A,
-    0x3E, 0xC8, 0xC1, 0x35, 0xE7, 0xCE, 0x21, 0x4C, 0xD4, 0x69, 0x94, 0x0C, 0x80, 0x05, 0xDE, 0xE1,
-    0xE1, 0xB3, 0x8A, 0xEF, 0xD2, 0x4B, 0xEC, 0x25, 0x1A, 0xEF, 0xDA, 0x8D, 0xC4, 0xE7, 0x09, 0xC6,
-    0x41, 0x6C, 0xCF, 0x33, 0xC6, 0x7D, 0x71, 0xFF, 0xC1, 0xEB, 0x1D, 0x7B, 0xCA, 0xB1, 0x07, 0x9B,
-    0xE2, 0xF3, 0xA9, 0x35, 0x6F, 0x4D, 0x63, 0xB3, 0xF2, 0xAC, 0x12, 0x77, 0x96, 0x18, 0xA7, 0xE2,
-    0x99, 0x20, 0xDD, 0x5B, 0x6A, 0xD2, 0x99, 0x3C, 0x6B, 0x91, 0x84, 0x36, 0x7C, 0x1B, 0xBF, 0xAF,
-    0xB4, 0xEE, 0xAA, 0x61, 0xBC, 0x9E, 0xDA, 0x6B, 0xA3, 0xED, 0x2E, 0xBC, 0xD0, 0x9C, 0xA7, 0x0D,
-    0x35, 0xE8, 0xE4, 0xD5, 0x1A, 0x71, 0x0A, 0x0C, 0x63, 0x4E, 0x69, 0xB8, 0x03, 0xD2, 0x80, 0xF0,
-    0xFB, 0x49, 0x94, 0xE0, 0x7F, 0xA6, 0xFF, 0xA1, 0x12, 0x63, 0x55, 0x7E, 0xDE, 0xF7, 0x61, 0xA3,
-    0x7A, 0xC5, 0x1D, 0x2F, 0x1F, 0x73, 0x7F, 0x81, 0x36, 0xB0, 0x3B, 0x2B, 0xDD, 0x02, 0x8B, 0x76,
-    0x7F, 0x26, 0x8F, 0x81, 0xE6, 0xBC, 0x90, 0x03, 0x06, 0x18, 0x73, 0x35, 0xAB, 0x61, 0x1B, 0x33,
-    0x1F, 0x9C, 0x1E, 0xAB, 0x0D, 0x16, 0xA9, 0xEB, 0xBF, 0x9A, 0x02, 0xD8, 0xFB, 0x08, 0x8F, 0x06,
-    0xAE, 0xA6, 0x00, 0xDE, 0x5E, 0xC2, 0x72, 0x97, 0xC3, 0x38, 0xE4, 0x54, 0x65, 0x52, 0x55, 0x0E,
-    0xE6, 0xEB, 0xB9, 0x99, 0x28, 0x05, 0x5D, 0xDC, 0x59, 0x67, 0x05, 0xEB, 0x3F, 0xD3, 0x68, 0x8A,
-    0xC9, 0x13, 0x6D, 0x2A, 0xFC, 0x1B, 0x39, 0x64, 0xDA, 0x3E, 0x9C, 0x17, 0x36, 0xED, 0xE8, 0x44,
-    0xDA, 0x43, 0x5A, 0x14, 0x77, 0xF4, 0x23, 0x85, 0x8E, 0xA4, 0xAC, 0x78, 0x92, 0x8A, 0x9F, 0x1E,
-    0x3A, 0x65, 0xD6, 0x88, 0x3D, 0x72, 0x3A, 0xE0, 0x74, 0xD2, 0x63, 0xA7, 0x64, 0x2F, 0x4C, 0x28,
-    0xCD, 0x42, 0x73, 0x67, 0x1C, 0x88, 0x52, 0xA3, 0x6C, 0x0C, 0x51, 0xDD, 0xE1, 0x52, 0x8A, 0x35,
-    0xB7, 0x44, 0x23, 0x8F, 0x5D, 0xC2, 0xBA, 0xDF, 0x1D, 0xE3, 0xD4, 0x91, 0xD3, 0x4D, 0x18, 0xBE,
-    0xD5, 0x04, 0xB6, 0x12, 0x9B, 0x10, 0x23, 0x13, 0x56, 0x9B, 0x4C, 0x6D, 0x88, 0x04, 0x37, 0xFB,
-    0xAC, 0xAD, 0x22, 0xF3, 0x1D, 0x27, 0x5F, 0x1F, 0xEA, 0x33, 0x63, 0xA2, 0x5C, 0xDC, 0x5A, 0x39,
-    0x35, 0x57, 0xB7, 0x09, 0xBE, 0xDE, 0xCA, 0xF9, 0x1C, 0x46, 0x2D, 0x93, 0x05, 0x68, 0x1C, 0x30,
-    0xA7, 0xE3, 0x84, 0xEE, 0xA5, 0xF6, 0xBA, 0x56, 0x26, 0x47, 0x7F, 0x38, 0x82, 0xA9, 0x43, 0xFB,
-    0x39, 0x53, 0xA0, 0x51, 0x09, 0xA7, 0xB6, 0x75, 0x83, 0x26, 0xA7, 0xE2, 0x9D, 0xA5, 0xB3, 0xD7,
-    0xF4, 0xE0, 0x50, 0x2E, 0x6D, 0xDE, 0xCA, 0x6C, 0x0B, 0x7B, 0xB6, 0xF1, 0x26, 0xB5, 0x51, 0x5B,
-    0x8E, 0x2D, 0x5D, 0xB4, 0x95, 0x79, 0x3B, 0x6C, 0x1C, 0xC1, 0xE1, 0xE6, 0x66, 0xC2, 0x63, 0x0F,
-    0x13, 0xCD, 0x75, 0xD9, 0xEA, 0x62, 0x5C, 0xC4, 0xCA, 0x7D, 0xF2, 0x9C, 0xCA, 0x99, 0xB1, 0xE0,
-    0x95, 0xC6, 0xB1, 0x8B, 0x53, 0x59, 0x3D, 0x1C, 0x7B, 0x7C, 0xE4, 0xEB, 0xE9, 0x0C, 0x67, 0xC6,
-    0xF0, 0xDE, 0x40, 0x4F, 0x67, 0x4C, 0xDA, 0xA3, 0x23, 0xDE, 0xEC, 0x3C, 0xF0, 0x00, 0xCE, 0xBC,
-    0xC6, 0x94, 0xFD, 0xBC, 0x71, 0xE6, 0x27, 0x59, 0xBB, 0x3D, 0x79, 0xBC, 0xD3, 0xE0, 0x12, 0x14,
-    0x6C, 0x11, 0x9A, 0x3C, 0xCA, 0x5E, 0x2A, 0xAB, 0xC3, 0x7E, 0xFF, 0x05, 0xE5, 0x5B, 0x3D, 0x8C,
-    0x1C, 0x57, 0x72, 0xAE, 0xEE, 0x36, 0xB7, 0x6D, 0x0E, 0xA0, 0x56, 0x20, 0x9E, 0x71, 0x22, 0x4E,
-    0x9D, 0x1C, 0x0C, 0x99, 0x10, 0xD4, 0xA9, 0x02, 0x71, 0xBA, 0x0F, 0x0E, 0x2F, 0x10, 0x03, 0xAD,
-    0x14, 0x30, 0x60, 0x62, 0x18, 0xB0, 0x00, 0x83, 0x0E, 0x14, 0x5C, 0x40, 0x6E, 0xF7, 0x9D, 0x03,
-    0x07, 0x4E, 0x36, 0x21, 0xE0, 0x70, 0x83, 0x85, 0x21, 0x0D, 0x03, 0x29, 0x50, 0x70, 0x01, 0x77,
-    0xA7, 0x7D, 0x89, 0x43, 0x8F, 0xED, 0xD0, 0xC1, 0xCD, 0x01, 0x94, 0x01, 0xF9, 0x02, 0x35, 0xEC,
-    0x39, 0x5C, 0x2F, 0xDD, 0x3D, 0xCF, 0xF5, 0x7D, 0xF5, 0xBA, 0x67, 0x46, 0x3F, 0x14, 0xA9, 0x5B,
-    0xF2, 0x56, 0xF6, 0x60, 0xBB, 0xEA, 0xED, 0xF4, 0xDF, 0xAB, 0x7A, 0xEF, 0x55, 0xD5, 0x57, 0xF5,
-    0x46, 0x44, 0x3F, 0x97, 0x84, 0x9F, 0xAC, 0x92, 0x3D, 0x77, 0x26, 0x59, 0x21, 0xA5, 0x73, 0x8B,
-    0x5C, 0x42, 0xF7, 0xE9, 0xBC, 0x3D, 0x90, 0xB8, 0xD5, 0x56, 0x27, 0xC9, 0x52, 0x64, 0xBE, 0x94,
-    0xAC, 0x16, 0xC9, 0x2B, 0xC9, 0xF5, 0xFA, 0xA4, 0x96, 0x12, 0x6C, 0x21, 0xA7, 0xCA, 0x26, 0x4B,
-    0xE9, 0x95, 0xC5, 0xCD, 0xC0, 0x3A, 0x65, 0xD1, 0xC8, 0x76, 0xCF, 0xF9, 0x1B, 0xFC, 0xED, 0xFE,
-    0x61, 0xFA, 0x58, 0xF4, 0x21, 0x5D, 0x08, 0x4E, 0x4C, 0x5A, 0x09, 0xD6, 0xA2, 0xAF, 0xBE, 0x77,
-    0xBB, 0xD5, 0xF3, 0x73, 0xED, 0x12, 0x6E, 0x72, 0x6B, 0xD9, 0xEA, 0xB2, 0xC8, 0xB5, 0x02, 0x34,
-    0x37, 0xAA, 0xF7, 0xBB, 0xEA, 0x40, 0xC4, 0xB9, 0x55, 0x27, 0x51, 0xFF, 0xAE, 0x5B, 0xA1, 0xDB,
-    0x65, 0x2D, 0x69, 0x8D, 0x27, 0xAB, 0x64, 0x78, 0x8D, 0x0C, 0x94, 0x6F, 0x9E, 0x7C, 0x89, 0xEA,
-    0x59, 0xBB, 0x32, 0xAD, 0x70, 0x97, 0x5E, 0xA6, 0xDD, 0x89, 0xCE, 0x42, 0xED, 0x7B, 0xA0, 0x4F,
-    0x16, 0xBE, 0x05, 0xEF, 0xBB, 0x31, 0x74, 0xE2, 0x8A, 0xB1, 0x1C, 0xC2, 0x86, 0x2B, 0xCF, 0x0E,
-    0x8C, 0x75, 0x64, 0x7A, 0x1B, 0x59, 0x4D, 0xA6, 0x02, 0xF1, 0xDC, 0x39, 0x32, 0x55, 0x31, 0xB4,
-    0x0A, 0x96, 0x53, 0xB7, 0x18, 0x29, 0x0C, 0x56, 0x72, 0xF6, 0x8E, 0x53, 0xED, 0x44, 0xCE, 0x41,
-    0xF7, 0x3A, 0xB4, 0x4B, 0xF6, 0xF5, 0xED, 0xA1, 0xEF, 0x7B, 0x87, 0x62, 0xA3, 0xC0, 0x41, 0xB8,
-    0x2B, 0x32, 0x4D, 0x6A, 0x55, 0x61, 0x9E, 0x17, 0xA0, 0x6B, 0x01, 0x5D, 0x91, 0xCA, 0x93, 0xD2,
-    0x92, 0x74, 0xCE, 0x7F, 0x1D, 0x06, 0x27, 0x54, 0x9A, 0x2D, 0xAF, 0x2A, 0x4D, 0x9C, 0xCB, 0xA1,
-    0x87, 0x36, 0xDB, 0x1E, 0x44, 0x91, 0x57, 0xE5, 0xB2, 0x6F, 0xA5, 0xC5, 0xD4, 0xB7, 0xE2, 0x5F,
-    0xB5, 0xBE, 0x15, 0xFE, 0x4F, 0x33, 0x5C, 0x38, 0xAF, 0x87, 0x96, 0x8D, 0xF9, 0x97, 0x3E, 0x73,
-    0xF7, 0x99, 0xDE, 0xEA, 0x74, 0xA0, 0xF4, 0x58, 0x8E, 0xAD, 0xDE, 0x5A, 0x9D, 0xBE, 0xBB, 0xE0,
-    0xE4, 0x53, 0x9D, 0x65, 0x10, 0x3A, 0xAD, 0xB5, 0x35, 0x69, 0xF8, 0x40, 0xE8, 0x11, 0xE3, 0x3B,
-    0x1F, 0x46, 0x29, 0xE0, 0xE8, 0x05, 0xF6, 0x3D, 0x66, 0xB2, 0x5D, 0xEB, 0x5B, 0x29, 0x47, 0x13,
-    0x73, 0x5A, 0xFB, 0xE2, 0x5B, 0x73, 0xF1, 0x67, 0x71, 0x93, 0xB5, 0x22, 0x1B, 0x21, 0xFD, 0x02,
-    0xAF, 0xB1, 0x27, 0xEB, 0xAD, 0x62, 0x4F, 0x85, 0x18, 0xDA, 0x4A, 0x1A, 0xDC, 0x8A, 0x56, 0x56,
-    0x07, 0xFE, 0x09, 0xAE, 0x60, 0x6F, 0xD6, 0xB3, 0x79, 0x2F, 0x93, 0x47, 0xB3, 0xD9, 0x07, 0x94,
-    0x68, 0xA2, 0xB4, 0x73, 0xBA, 0x50, 0xAD, 0x65, 0x52, 0x1F, 0xCA, 0x9F, 0x5B, 0xA3, 0x0B, 0x57,
-    0xD4, 0x80, 0xE4, 0x93, 0x05, 0x2F, 0x57, 0x95, 0x17, 0x94, 0x5F, 0xE2, 0xB5, 0x98, 0xF8, 0x41,
-    0x2B, 0x83, 0xF4, 0x32, 0x08, 0x6F, 0xBD, 0x09, 0xF5, 0x42, 0x76, 0x30, 0xB2, 0x46, 0xD0, 0x05,
-    0xFB, 0xFB, 0xBD, 0x17, 0x37, 0x6C, 0x7D, 0x23, 0x6E, 0xBC, 0xB0, 0x49, 0xED, 0x1B, 0x59, 0xE5,
-    0x4F, 0x95, 0x83, 0x6E, 0x06, 0xC5, 0x99, 0xDE, 0x54, 0xE2, 0x78, 0xE9, 0x05, 0x4E, 0x6A, 0x2F,
-    0xAF, 0x29, 0x4D, 0xE7, 0xE8, 0xA9, 0x97, 0x16, 0x72, 0x53, 0xD8, 0xE8, 0x37, 0xFB, 0x6F, 0x0F,
-    0xA3, 0xB7, 0xA6, 0xA8, 0x68, 0x70, 0xC6, 0x5C, 0x96, 0x3D, 0xAC, 0xBD, 0xB4, 0x9A, 0xD4, 0x69,
-    0xC1, 0x46, 0xB4, 0x3A, 0xE1, 0xBC, 0xA9, 0xC4, 0xB5, 0xBE, 0x91, 0x2F, 0x7D, 0x23, 0xAD, 0x7D,
-    0xC3, 0xCF, 0x2D, 0x6B, 0x64, 0x7D, 0x52, 0x65, 0xFA, 0x78, 0x95, 0xF6, 0x9F, 0xD9, 0x88, 0xCF,
-    0xDE, 0x75, 0xD5, 0x95, 0xFD, 0x5B, 0x0B, 0xB5, 0x16, 0xF3, 0x0A, 0x03, 0x9B, 0x9A, 0x39, 0xCA,
-    0xD1, 0x49, 0xB5, 0x01, 0x2A, 0x63, 0xCE, 0xDB, 0x55, 0x75, 0xD6, 0xD0, 0x85, 0x66, 0x0D, 0xB3,
-    0x22, 0x09, 0x4D, 0x85, 0x7D, 0x53, 0x8A, 0x6F, 0x74, 0x62, 0xB7, 0x63, 0x89, 0xE2, 0x6C, 0x15,
-    0x2F, 0xB9, 0xD2, 0xE6, 0x95, 0xEA, 0x40, 0x0D, 0xDC, 0x9E, 0xAB, 0xF2, 0x7B, 0xFB, 0x05, 0xBB,
-    0x91, 0x3B, 0xD7, 0x48, 0xB9, 0x4E, 0xAC, 0x11, 0xF8, 0xB9, 0xFD, 0x80, 0x0B, 0xA2, 0x63, 0xD7,
-    0x9F, 0x3F, 0x75, 0xB3, 0xD9, 0xA1, 0x52, 0x55, 0xD0, 0x40, 0xA9, 0xBD, 0x62, 0x43, 0x61, 0xB9,
-    0xE5, 0x1D, 0x9A, 0x64, 0x9B, 0x89, 0x66, 0x5D, 0x5E, 0xB2, 0xDE, 0xFF, 0x11, 0xFB, 0xCF, 0x65,
-    0xE5, 0x69, 0x26, 0x36, 0x5F, 0xBF, 0x48, 0xB3, 0x67, 0x42, 0xD1, 0x7F, 0xA5, 0xDA, 0xF3, 0x81,
-    0xB2, 0xE7, 0x5F, 0xA2, 0xF9, 0x86, 0xFE, 0x05, 0x65, 0x29, 0xD9, 0x33, 0x9D, 0x45, 0x57, 0xF8,
-    0xFD, 0x25, 0x3D, 0xB2, 0x42, 0xE7, 0x42, 0x95, 0xEB, 0x68, 0xE4, 0xFE, 0x5A, 0x3B, 0xF0, 0x7F,
-    0xF6, 0x3B, 0x1F, 0xF2, 0xA5, 0x43, 0x9F, 0xFE, 0x27, 0xB0, 0x9D, 0x1D, 0xFB, 0x71, 0xCA, 0xB9,
-    0x90, 0x16, 0xF0, 0x3B, 0x0F, 0xF4, 0xBC, 0xFA, 0x11, 0xE3, 0x8D, 0xE7, 0x2B, 0xE3, 0x58, 0xAA,
-    0xE0, 0xDD, 0xDC, 0x73, 0x9D, 0x7F, 0xE4, 0x3A, 0x9F, 0xC9, 0xD5, 0x31, 0x90, 0xEB, 0x3A, 0x24,
-    0xD7, 0x25, 0x47, 0x2E, 0x6B, 0xCF, 0xF3, 0xC2, 0x78, 0x56, 0x1B, 0x4F, 0x96, 0xC6, 0xA3, 0xC6,
-    0x78, 0xD8, 0x19, 0x97, 0xDE, 0xF3, 0xD2, 0xF3, 0xAC, 0x33, 0x9E, 0x78, 0x1E, 0x7B, 0x1E, 0x76,
-    0x7E, 0xAE, 0xC8, 0xC8, 0x73, 0xBF, 0x1C, 0x4B, 0x63, 0x36, 0x7F, 0xD4, 0x00, 0x74, 0x9E, 0x9B,
-    0x87, 0x1A, 0x66, 0x11, 0xE6, 0x91, 0xC9, 0x9F, 0x8B, 0xC9, 0x9F, 0x0F, 0xF2, 0x8B, 0xC9, 0xAF,
-    0xD3, 0x6E, 0x65, 0xDC, 0xE4, 0xD7, 0x39, 0x65, 0xF2, 0x8B, 0xC9, 0xAF, 0x0E, 0x99, 0xF2, 0x2B,
-    0xA7, 0xFC, 0xCA, 0x29, 0xBF, 0x72, 0xCA, 0x0F, 0x87, 0xBD, 0xF6, 0x1C, 0xF2, 0x83, 0x43, 0x7E,
-    0x70, 0xC8, 0x0F, 0x0E, 0xF9, 0xC1, 0x21, 0x3F, 0x1D, 0x7C, 0xEF, 0x79, 0xE9, 0xB9, 0xCA, 0x4F,
-    0x9E, 0x78, 0x1E, 0x7B, 0x1E, 0x76, 0xA3, 0xBC, 0x4F, 0xC8, 0x6D, 0x0E, 0xAA, 0x2B, 0xF1, 0xB6,
-    0xBD, 0xF4, 0xFA, 0xB8, 0xB4, 0xA3, 0xC5, 0xBC, 0xF2, 0xEE, 0xF2, 0x2B, 0xBD, 0xE0, 0x9B, 0x13,
-    0x55, 0x55, 0x5A, 0x5C, 0x2F, 0x55, 0x33, 0x3A, 0xC5, 0xCE, 0xDE, 0xC5, 0x28, 0xE4, 0x0B, 0x15,
-    0x53, 0x59, 0xA5, 0xEE, 0x19, 0xF3, 0xCE, 0x4F, 0xEB, 0xF3, 0x67, 0xDB, 0xFD, 0xFC, 0x4A, 0x66,
-    0x92, 0x62, 0x82, 0x8B, 0xCD, 0x71, 0x5B, 0x6E, 0x3E, 0x0C, 0x48, 0x11, 0x7A, 0xC8, 0xE4, 0x5F,
-    0x5A, 0xBA, 0x7E, 0x4A, 0xEF, 0xEA, 0x6D, 0x45, 0x6D, 0x3E, 0xF9, 0x96, 0x2E, 0x2C, 0x34, 0x60,
-    0x98, 0x18, 0xFC, 0x16, 0x77, 0x45, 0xFF, 0x05, 0xCF, 0x16, 0xFD, 0x0A, 0x4E, 0x74, 0xB2, 0xE8,
-    0x18, 0xE0, 0x9C, 0xD0, 0xB2, 0x1D, 0x70, 0xED, 0xDB, 0x0A, 0x46, 0x97, 0x4E, 0xE0, 0x95, 0x30,
-    0xDA, 0x35, 0x42, 0x3C, 0x9D, 0x80, 0x6A, 0x93, 0x75, 0x6E, 0x45, 0x8F, 0x66, 0xF7, 0x57, 0xF0,
-    0x5C, 0x6A, 0xF6, 0xED, 0x02, 0x38, 0x94, 0x53, 0xBF, 0x40, 0x79, 0x3B, 0xBB, 0x6A, 0x06, 0x33,
-    0xA9, 0xC3, 0x4A, 0x8E, 0xC2, 0x26, 0x5E, 0xC8, 0x89, 0x5E, 0x91, 0xEB, 0xA4, 0x4D, 0x5A, 0x86,
-    0xBB, 0xE3, 0xA7, 0x74, 0x85, 0x7A, 0xB2, 0x65, 0xF4, 0xE9, 0xD5, 0x55, 0xC0, 0x00, 0x63, 0x70,
-    0x97, 0x7A, 0xEC, 0xDD, 0xEF, 0xF4, 0xAD, 0x5D, 0xF2, 0x68, 0xBF, 0x53, 0x79, 0x3A, 0x5D, 0x1C,
-    0xDD, 0x01, 0x8F, 0x40, 0xDB, 0x91, 0x7E, 0x97, 0x75, 0xA9, 0xEB, 0xEF, 0xC4, 0x6E, 0x79, 0x07,
-    0x76, 0xE9, 0x48, 0x5E, 0xBD, 0x2B, 0x6D, 0xFA, 0xB7, 0xCB, 0xC9, 0xE7, 0x35, 0xE2, 0xAB, 0xDE,
-    0xBF, 0x22, 0x53, 0x3B, 0xE7, 0x9A, 0x60, 0x5D, 0x98, 0x17, 0x7E, 0xEA, 0xBF, 0x5E, 0x9F, 0xD0,
-    0xE8, 0xDF, 0x0F, 0xE5, 0xFB, 0x99, 0x9C, 0x24, 0xBF, 0x58, 0x45, 0xAA, 0x51, 0x87, 0x29, 0xE3,
-    0x3F, 0x53, 0x6A, 0xFD, 0x69, 0xFF, 0xBE, 0x2F, 0x7B, 0x05, 0xDC, 0x64, 0x46, 0x38, 0xD0, 0x71,
-    0x9D, 0x53, 0x31, 0xE5, 0xC2, 0x63, 0x8F, 0xDD, 0x0F, 0x90, 0x88, 0x10, 0x88, 0x18, 0x0E, 0x21,
-    0x0C, 0xE9, 0x89, 0x42, 0x4A, 0xC6, 0xB5, 0x59, 0x65, 0xB0, 0xC1, 0x30, 0x84, 0x01, 0x0A, 0x43,
-    0x17, 0xFD, 0xF8, 0x8A, 0x81, 0xF6, 0x23, 0x8D, 0x1B, 0xBB, 0xD2, 0xEE, 0xB2, 0x27, 0x18, 0xEE,
-    0x30, 0xD8, 0x61, 0xA8, 0xC3, 0x83, 0x8E, 0x39, 0xE3, 0x27, 0x0F, 0x39, 0xB0, 0xFA, 0x02, 0x86,
-    0x59, 0x5D, 0x88, 0x20, 0x1B, 0xF3, 0x21, 0x41, 0x2C, 0x19, 0xE3, 0xB9, 0x61, 0xBB, 0xD3, 0x7B,
-    0x00, 0x04, 0x62, 0x05, 0x05, 0x21, 0xEC, 0x74, 0x69, 0x10, 0x84, 0xB8, 0x82, 0x10, 0x23, 0xF7,
-    0xEF, 0x9F, 0x8C, 0x84, 0xFF, 0x26, 0x35, 0x2F, 0xE1, 0xC5, 0xBC, 0x2D, 0x3A, 0xDB, 0xEB, 0x3D,
-    0xEC, 0x30, 0xD4, 0x71, 0x63, 0x88, 0xF6, 0x3A, 0x84, 0x15, 0x1A, 0xE5, 0xF9, 0x6E, 0x44, 0xE8,
-    0x65, 0xB0, 0xD3, 0x0D, 0x8F, 0x3F, 0xCE, 0x9D, 0x44, 0x0D, 0x91, 0x06, 0x40, 0xDA, 0x32, 0x07,
-    0xCA, 0x20, 0xC6, 0x30, 0x84, 0x61, 0xF8, 0x42, 0xD1, 0x45, 0x58, 0x04, 0x87, 0x61, 0xA3, 0xDD,
-    0xEB, 0xB0, 0x16, 0x7A, 0xBF, 0x16, 0x96, 0x63, 0xE7, 0x74, 0x3E, 0x4D, 0x81, 0x18, 0x9E, 0xF0,
-    0x28, 0x81, 0x28, 0x80, 0x27, 0x80, 0x26, 0x80, 0x25, 0x80, 0x24, 0x88, 0x23, 0x2E, 0x31, 0xE8,
-    0x6F, 0x80, 0xFA, 0x94, 0xBC, 0x37, 0x3B, 0xDA, 0x56, 0xC1, 0xDD, 0x48, 0xDF, 0x78, 0x00, 0x54,
-    0x74, 0x3D, 0x5A, 0x5C, 0x18, 0xD5, 0x38, 0x57, 0xE3, 0x08, 0x66, 0x33, 0x9B, 0xF6, 0x2F, 0x06,
-    0x22, 0x6D, 0x52, 0x07, 0x7A, 0xC8, 0x6A, 0x52, 0x3D, 0x13, 0x15, 0x59, 0x98, 0xCF, 0x80, 0x38,
-    0x1F, 0xC2, 0xAE, 0x60, 0x79, 0xA1, 0xF5, 0xE4, 0xD7, 0x52, 0x6D, 0x58, 0x4F, 0xCF, 0x60, 0xE1,
-    0xC5, 0xD5, 0xF3, 0xD1, 0x57, 0x21, 0x2F, 0xEA, 0x4B, 0x02, 0xAC, 0xB1, 0x64, 0x77, 0x8D, 0x7D,
-    0x70, 0xA1, 0x95, 0xA6, 0xD0, 0xE1, 0x46, 0x04, 0x1F, 0xD4, 0x6F, 0xAD, 0xBB, 0xBD, 0xA3, 0xE7,
-    0xA3, 0xB4, 0xF9, 0x68, 0xCB, 0x61, 0x97, 0x38, 0x5E, 0x22, 0x77, 0x2E, 0xFC, 0x24, 0x23, 0xE0,
-    0x9E, 0xFB, 0xAE, 0xAB, 0xEA, 0x24, 0x68, 0x9E, 0xD3, 0xA2, 0x34, 0x47, 0xA7, 0x18, 0xB4, 0xCE,
-    0xEE, 0xDD, 0xD6, 0x97, 0x46, 0x43, 0x4C, 0x70, 0xEA, 0xE3, 0xE3, 0xFC, 0xDA, 0x6C, 0x36, 0x57,
-    0x37, 0xE8, 0x70, 0xE8, 0x73, 0xA6, 0x48, 0xB1, 0x00, 0x39, 0xA7, 0x75, 0xD8, 0x26, 0xAB, 0xAB,
-    0x8D, 0x8A, 0x53, 0xCB, 0x7C, 0xCD, 0x81, 0x97, 0x94, 0x49, 0x9E, 0x94, 0x1E, 0xEB, 0xF2, 0xEC,
-    0xC3, 0x2F, 0xF8, 0xD4, 0xA4, 0x7E, 0x20, 0x03, 0x68, 0x9F, 0x54, 0x77, 0x2E, 0x78, 0x2C, 0xA5,
-    0xAE, 0x1F, 0xC7, 0x37, 0x19, 0xC9, 0xF3, 0x8C, 0xA9, 0xE4, 0xD2, 0xFE, 0xDB, 0xA3, 0xFE, 0x52,
-    0x9F, 0x6A, 0xE4, 0xE7, 0x0F, 0xB6, 0x35, 0xB4, 0x81, 0xBE, 0xFE, 0xFB, 0x0B, 0xAD, 0xBF, 0xFD,
-    0x7D, 0x8B, 0xB9, 0xC3, 0x85, 0xC5, 0xA2, 0x38, 0xC2, 0xC5, 0x33, 0x89, 0x49, 0x65, 0xE3, 0x7F,
-    0xE7, 0x4C, 0x94, 0xE2, 0xE9, 0xAB, 0xAF, 0x49, 0xD3, 0x39, 0x58, 0x54, 0x48, 0xE8, 0xD3, 0x93,
-    0xE4, 0xF1, 0xD2, 0xC0, 0x40, 0xB2, 0x30, 0xCE, 0xEC, 0x1C, 0x71, 0x43, 0xB7, 0x49, 0xB1, 0x0A,
-    0x94, 0x34, 0x24, 0x0F, 0xC8, 0x35, 0x14, 0x5A, 0xCF, 0x66, 0x4C, 0x7F, 0x32, 0x51, 0xA4, 0xD6,
-    0x87, 0xDC, 0x72, 0x4D, 0x08, 0x9D, 0x0C, 0x5C, 0xE6, 0x9E, 0x97, 0xB3, 0x59, 0x27, 0x43, 0xA2,
-    0xCA, 0xC2, 0x26, 0x9F, 0xA7, 0x26, 0x8F, 0x3D, 0x87, 0xE1, 0xC7, 0x73, 0xA1, 0x69, 0xF4, 0x0F,
-    0x23, 0x6F, 0xFD, 0xBC, 0x36, 0x3B, 0x36, 0xE9, 0xDA, 0xAF, 0x11, 0x32, 0x98, 0xF7, 0x32, 0x5F,
-    0x21, 0xDF, 0xF9, 0x4F, 0xDA, 0x91, 0xC9, 0xC3, 0x5B, 0x9F, 0x2F, 0xCA, 0x2A, 0x50, 0x39, 0x39,
-    0x78, 0x1A, 0xC9, 0x22, 0x14, 0x42, 0x7E, 0xAC, 0x19, 0xD8, 0xF7, 0xEE, 0xAF, 0x67, 0xF7, 0x1B,
-    0x0C, 0xB6, 0x0E, 0x77, 0xF2, 0xE8, 0x1D, 0x7D, 0xF1, 0x51, 0x5E, 0x31, 0xA2, 0x2B, 0xCD, 0x42,
-    0x1D, 0x00, 0x4C, 0x82, 0xD1, 0x0F, 0x69, 0xB0, 0x8A, 0x9E, 0xE4, 0x55, 0x79, 0xEB, 0xE1, 0xF7,
-    0x16, 0x3A, 0x0C, 0x3A, 0x8A, 0x0B, 0x1D, 0x89, 0x00, 0x1D, 0xD4, 0xC1, 0xB8, 0x54, 0x6C, 0xFA,
-    0xE2, 0x0E, 0x31, 0x9F, 0x61, 0x1C, 0xDC, 0xA3, 0xFB, 0x1D, 0xEF, 0xFF, 0xA1, 0xCF, 0xFB, 0x59,
-    0x8A, 0xCC, 0xE6, 0xB4, 0x01, 0xF2, 0x53, 0xD2, 0x7E, 0x8B, 0x22, 0x3B, 0xB7, 0x26, 0x75, 0x9E,
-    0xF6, 0x1C, 0x8B, 0x53, 0x52, 0xBD, 0x6B, 0x36, 0x3F, 0xCA, 0x19, 0x80, 0xA9, 0x99, 0x9D, 0xB9,
-    0x23, 0x44, 0xE9, 0x39, 0x62, 0x69, 0x61, 0x15, 0xE1, 0x1D, 0xC7, 0x48, 0xDE, 0x31, 0x8D, 0xF7,
-    0x10, 0xCB, 0x6C, 0xCC, 0x9C, 0x97, 0xFD, 0xA4, 0x62, 0xFE, 0x2B, 0x3E, 0xBB, 0xE9, 0x2A, 0xE6,
-    0xC6, 0x32, 0xA4, 0xDE, 0x98, 0x37, 0x63, 0x16, 0x6D, 0x20, 0xC9, 0x48, 0xFC, 0x77, 0x48, 0xE8,
-    0x23, 0x91, 0x56, 0x56, 0x93, 0x55, 0xE8, 0x2A, 0x9D, 0x41, 0xBF, 0xAC, 0x98, 0x41, 0x93, 0xE0,
-    0x46, 0x82, 0x45, 0x08, 0xC2, 0xC0, 0xD9, 0x61, 0x94, 0xF6, 0xCB, 0xC3, 0x4B, 0x90, 0x30, 0xF9,
-    0xEC, 0x66, 0x8F, 0xCC, 0xE9, 0x4A, 0xD5, 0xA2, 0x20, 0x49, 0x01, 0xA7, 0xA2, 0xB6, 0xC9, 0x22,
-    0xAD, 0x98, 0xB2, 0x57, 0xE9, 0xA1, 0xF0, 0xBC, 0xB1, 0x92, 0xC4, 0xCE, 0x80, 0xAA, 0x12, 0xA9,
-    0x43, 0xA8, 0x90, 0x1A, 0x4C, 0x56, 0x63, 0x44, 0x55, 0x0D, 0xDA, 0x3B, 0x1D, 0xB5, 0xD6, 0xFB,
-    0x09, 0x36, 0xFB, 0x90, 0x2A, 0x23, 0xC1, 0x77, 0x25, 0xB5, 0x46, 0xDB, 0x0E, 0xAD, 0xE7, 0x8C,
-    0x6F, 0xA8, 0xB1, 0x18, 0xC9, 0x1E, 0xD3, 0x17, 0xD5, 0x65, 0xDA, 0x52, 0x65, 0x19, 0xEE, 0x68,
-    0x31, 0x57, 0x0E, 0xD0, 0xAB, 0x14, 0xC0, 0x79, 0xD2, 0xDB, 0xC4, 0xDF, 0xC1, 0x1D, 0xAA, 0xCE,
-    0x80, 0xEA, 0xEC, 0xA1, 0xCE, 0xA5, 0x02, 0x37, 0x66, 0x32, 0xB3, 0xC7, 0xA8, 0x73, 0xD0, 0x69,
-    0x61, 0x3A, 0xCD, 0x31, 0x0A, 0xAA, 0x53, 0x64, 0x27, 0xC3, 0x2D, 0x9D, 0x16, 0x49, 0x35, 0x64,
-    0x50, 0x09, 0xE2, 0x91, 0x16, 0x13, 0x07, 0x75, 0x76, 0x50, 0x67, 0x63, 0xEA, 0x0C, 0xAB, 0xE0,
-    0x48, 0x08, 0x81, 0x19, 0x7F, 0xA0, 0x80, 0x60, 0x11, 0xC8, 0x0E, 0x0C, 0x66, 0x92, 0x86, 0x86,
-    0xAA, 0xB4, 0x4C, 0xB9, 0xCF, 0x13, 0xEB, 0x9B, 0x3B, 0x4B, 0x0B, 0xAF, 0x81, 0x6F, 0xB0, 0x2A,
-    0x51, 0xC9, 0xE8, 0xA0, 0x22, 0x18, 0x1F, 0x59, 0x3B, 0x8E, 0xA9, 0x3E, 0xDD, 0xFD, 0x9D, 0x3E,
-    0x6F, 0x1D, 0x71, 0xE1, 0xF6, 0x20, 0xB0, 0x4D, 0x88, 0x15, 0x59, 0xA9, 0xEA, 0x24, 0x5E, 0x31,
-    0x59, 0x83, 0x01, 0x70, 0x4C, 0xC4, 0xE2, 0x6D, 0xE9, 0x42, 0x51, 0x2D, 0xAC, 0xAD, 0x5A, 0x5E,
-    0x45, 0xB6, 0x30, 0x3B, 0x30, 0x84, 0xC4, 0x55, 0x23, 0xBE, 0xB5, 0xBC, 0xD3, 0xF4, 0x49, 0x88,
-    0xF6, 0x70, 0x8A, 0x5A, 0xCB, 0x14, 0x81, 0xC3, 0x14, 0x11, 0xC4, 0x14, 0x2B, 0x74, 0x8A, 0x95,
-    0x35, 0xC5, 0xC4, 0x98, 0xA2, 0xD3, 0x53, 0x2E, 0x53, 0x64, 0x30, 0x72, 0x74, 0x3A, 0x47, 0xA7,
-    0xA7, 0xE8, 0xF4, 0x14, 0x9D, 0x9E, 0xA2, 0xD3, 0x53, 0x74, 0x7A, 0x0A, 0x25, 0x4C, 0x6D, 0xA9,
-    0x5F, 0x48, 0x08, 0xCC, 0x19, 0x20, 0xA9, 0x25, 0x98, 0x64, 0x13, 0xDA, 0x19, 0xCD, 0x69, 0xF8,
-    0x33, 0x0E, 0x73, 0x50, 0x3C, 0x07, 0x24, 0x8C, 0x60, 0x26, 0xA0, 0x57, 0xC5, 0x20, 0xC6, 0xF5,
-    0x40, 0xA2, 0x47, 0xCC, 0x2E, 0x0C, 0x43, 0x79, 0x19, 0x8E, 0x01, 0x86, 0x98, 0xE5, 0x43, 0x77,
-    0xD1, 0xF3, 0x0C, 0x13, 0x5A, 0x9D, 0x84, 0x9D, 0x7B, 0x9D, 0xF4, 0xFA, 0x16, 0xCD, 0xE9, 0x76,
-    0x68, 0x78, 0x4C, 0xC9, 0xF4, 0xB7, 0x44, 0xBE, 0x73, 0xD7, 0x3C, 0xA7, 0x14, 0xC4, 0x93, 0x29,
-    0x1E, 0x09, 0x00, 0xD5, 0x06, 0x80, 0x40, 0x47, 0x53, 0xC0, 0xD0, 0x94, 0xA6, 0x60, 0xB9, 0x13,
-    0x76, 0xC2, 0x53, 0x6F, 0x88, 0x8F, 0x81, 0x31, 0x00, 0x66, 0x56, 0x37, 0x5F, 0x2D, 0x06, 0x47,
-    0x05, 0x77, 0xA6, 0x42, 0x57, 0xDE, 0xB4, 0x5B, 0x0A, 0xC6, 0xC0, 0x07, 0xCF, 0x13, 0x81, 0x6C,
-    0x48, 0x2E, 0xF0, 0xDB, 0xB2, 0x2E, 0xAE, 0x76, 0xC2, 0x58, 0x2A, 0x73, 0xB0, 0xFC, 0x57, 0xF4,
-    0xD8, 0x2B, 0x82, 0x2A, 0x5E, 0x22, 0xAA, 0xCC, 0x2D, 0xED, 0x8F, 0xF9, 0x3B, 0x59, 0x6C, 0x77,
-    0x6E, 0xA5, 0x47, 0x7B, 0x0D, 0xC1, 0x17, 0x4F, 0xE0, 0x89, 0x07, 0x16, 0x32, 0xC0, 0xA4, 0xC1,
-    0x1C, 0x63, 0x78, 0xB1, 0xC6, 0xD1, 0xFB, 0x8F, 0xB0, 0xCE, 0xD3, 0x46, 0x36, 0x91, 0xD4, 0x89,
-    0x3F, 0xEE, 0x7A, 0xCE, 0x72, 0xD8, 0x0D, 0xF5, 0xBE, 0xF3, 0x7B, 0xF3, 0x85, 0x0E, 0xBD, 0x0E,
-    0xFC, 0x43, 0x39, 0xE7, 0x6C, 0xDB, 0xF8, 0x37, 0x85, 0x47, 0xFA, 0x87, 0x0E, 0xA5, 0xB1, 0xF9,
-    0xE2, 0xFF, 0x5D, 0x6D, 0xD4, 0x2A, 0xA1, 0x9C, 0x2B, 0xBE, 0xA8, 0xE0, 0x7C, 0x19, 0x5C, 0x06,
-    0x61, 0xBF, 0xBB, 0x95, 0xD0, 0xDD, 0x9A, 0xE6, 0xB7, 0x6B, 0x7C, 0x77, 0x2A, 0xA1, 0xD8, 0xEA,
-    0x31, 0x2C, 0xF2, 0x60, 0x88, 0xD5, 0xCD, 0x58, 0x26, 0x72, 0x51, 0xE2, 0x34, 0xBF, 0x9B, 0x22,
-    0x1D, 0x0D, 0x15, 0xDF, 0xD2, 0xCA, 0x2E, 0xE0, 0xBA, 0x08, 0x71, 0xDA, 0x03, 0xAB, 0x7D, 0x76,
-    0x66, 0xBC, 0xBE, 0x91, 0x4D, 0x6A, 0x63, 0x8B, 0x5D, 0xE6, 0x66, 0xB3, 0xB9, 0x70, 0x9F, 0x81,
-    0xDB, 0xB0, 0xAF, 0xBC, 0xF2, 0xEB, 0x19, 0x57, 0x8E, 0xBA, 0x45, 0xB0, 0xE4, 0xD3, 0x39, 0x96,
-    0xCF, 0x84, 0x30, 0x43, 0xC7, 0xA1, 0xDD, 0xD9, 0xEB, 0xF3, 0xF3, 0x58, 0x6D, 0x63, 0x97, 0xEB,
-    0xB7, 0xDD, 0xFA, 0xE6, 0x1A, 0xA5, 0xE6, 0x12, 0x05, 0xD1, 0xAC, 0xC2, 0xBE, 0x92, 0x9A, 0x68,
-    0xAF, 0xDF, 0x25, 0x9D, 0x27, 0x0C, 0x35, 0x09, 0x21, 0x89, 0x1F, 0x4F, 0x77, 0x82, 0xCE, 0x14,
-    0xCB, 0xB1, 0xD4, 0x39, 0x1A, 0x22, 0xE8, 0xCC, 0x56, 0x43, 0x94, 0xD9, 0x0F, 0x00, 0xBE, 0x1F,
-    0x6B, 0xD5, 0x8F, 0x27, 0xF2, 0x72, 0x35, 0x78, 0x29, 0x06, 0xBB, 0x96, 0x8C, 0x87, 0xD9, 0x97,
-    0x57, 0xB6, 0x07, 0x9F, 0xC5, 0x4C, 0x56, 0x32, 0x59, 0xC6, 0x64, 0x0D, 0x93, 0x05, 0x4C, 0x56,
-    0x2F, 0x59, 0xBA, 0x64, 0xDD, 0x92, 0x45, 0x4B, 0x56, 0x2C, 0x59, 0xAE, 0x64, 0xAD, 0x92, 0x85,
-    0x4A, 0x56, 0x29, 0x59, 0xA2, 0x64, 0x7D, 0x92, 0xC5, 0x49, 0x56, 0x26, 0x59, 0x96, 0x64, 0x4D,
-    0x92, 0x05, 0x49, 0x56, 0x23, 0x59, 0x8A, 0xB4, 0x3A, 0xE4, 0x87, 0x5B, 0x59, 0x2E, 0xB8, 0x32,
-    0xA6, 0xE7, 0x3E, 0xD9, 0xA9, 0x19, 0xA2, 0x60, 0x88, 0x6A, 0x21, 0x4A, 0x85, 0xA8, 0x13, 0xC2,
-    0x8B, 0x3C, 0xED, 0xE1, 0x17, 0xA8, 0xB9, 0x0B, 0xEF, 0x4C, 0xB3, 0xAD, 0x8A, 0xEE, 0xEB, 0xC5,
-    0x58, 0xE5, 0x8D, 0x6A, 0x86, 0x11, 0xF5, 0x27, 0xA4, 0x1F, 0x63, 0xA1, 0xFC, 0x47, 0xB3, 0xC9,
-    0x9F, 0x18, 0xFD, 0x2D, 0x53, 0x89, 0xFF, 0xBD, 0xC9, 0x9F, 0xC4, 0x3E, 0x7F, 0xC2, 0xDD, 0x11,
-    0xD5, 0x74, 0xCC, 0x9F, 0x4C, 0x59, 0x0D, 0x1D, 0xF2, 0x27, 0xFA, 0x62, 0xCB, 0x9F, 0x44, 0x63,
-    0xFE, 0xA4, 0x65, 0x6F, 0x98, 0x5A, 0xD1, 0xCB, 0xB0, 0x3C, 0xCA, 0x9D, 0xCC, 0x49, 0xEF, 0x51,
-    0x9F, 0x4A, 0x2F, 0xF3, 0xC2, 0xBC, 0x9C, 0xB7, 0x3F, 0x00, 0xB3, 0xAF, 0xDF, 0x56, 0x25, 0xA9,
-    0xB5, 0x79, 0x63, 0x62, 0x3C, 0xD5, 0xEB, 0xF7, 0x1E, 0x3E, 0xAB, 0x4C, 0x8A, 0x84, 0xBE, 0x92,
-    0x31, 0xF1, 0x71, 0x5D, 0x5A, 0xEF, 0x96, 0x8B, 0x1F, 0x78, 0xBE, 0x94, 0xFF, 0x8B, 0x19, 0x16,
-    0x09, 0x8F, 0xB7, 0xA5, 0xF7, 0x60, 0xDC, 0x6F, 0xFA, 0xBA, 0x6B, 0x22, 0x36, 0x72, 0x51, 0xD3,
-    0x2E, 0xEF, 0x6D, 0xB2, 0x27, 0x56, 0x1A, 0xB4, 0x98, 0xD7, 0x10, 0xD4, 0x8E, 0x35, 0x90, 0x3F,
-    0x24, 0x08, 0x49, 0x0B, 0xF3, 0x25, 0x00, 0x21, 0x1D, 0x40, 0x48, 0xC4, 0xA0, 0x5D, 0x3B, 0xAE,
-    0x7E, 0x27, 0x71, 0xB0, 0xFD, 0xD9, 0x5B, 0x00, 0x21, 0x07, 0x04, 0x21, 0x1D, 0x40, 0x88, 0xE2,
-    0x6C, 0x05, 0x1B, 0xF1, 0x02, 0xF0, 0x23, 0xA9, 0x41, 0x73, 0xC2, 0x8F, 0x13, 0x50, 0x95, 0x40,
-    0x41, 0x88, 0x0A, 0xA8, 0x20, 0x44, 0x07, 0x4B, 0x43, 0x7B, 0xB8, 0xE8, 0x3A, 0x77, 0xB4, 0xB6,
-    0xDD, 0x06, 0x84, 0xC4, 0x04, 0x21, 0x09, 0x97, 0x4A, 0xF6, 0x63, 0x8C, 0xE9, 0xE5, 0xED, 0x9D,
-    0x79, 0xAC, 0x1D, 0x58, 0x38, 0x9E, 0x8D, 0x38, 0xB9, 0xDD, 0x29, 0x1E, 0xD1, 0x44, 0x67, 0xEE,
-    0xAD, 0x0A, 0x43, 0x37, 0xE0, 0x0D, 0xC5, 0x01, 0x69, 0x1D, 0xB9, 0x22, 0x2B, 0x26, 0xBF, 0x54,
-    0xA8, 0x91, 0xBE, 0xA5, 0x64, 0x0A, 0x80, 0xD1, 0x29, 0xD4, 0x08, 0x57, 0x4A, 0x34, 0xEE, 0x5E,
-    0xE4, 0x49, 0xAD, 0x78, 0xE3, 0x36, 0xF0, 0x46, 0x0F, 0xBC, 0xD1, 0x6A, 0xB7, 0xE2, 0x7E, 0xCF,
-    0x67, 0x68, 0xD2, 0x8F, 0xD4, 0x4C, 0xC6, 0xE3, 0x3E, 0xCB, 0xE0, 0xF8, 0x1A, 0xBD, 0x3F, 0x3C,
-    0xB1, 0x06, 0xCB, 0xF4, 0xB2, 0x0C, 0x03, 0x92, 0x0A, 0x66, 0x21, 0xAC, 0x5F, 0xBB, 0xD8, 0x29,
-    0xED, 0x6B, 0xBA, 0xA2, 0xB3, 0x9F, 0xB5, 0xF4, 0x49, 0x51, 0xA3, 0x76, 0x6B, 0xA5, 0x58, 0xFA,
-    0x8D, 0xE8, 0xD9, 0xA4, 0xB2, 0xE5, 0x3D, 0x4C, 0xC4, 0x88, 0x99, 0xC9, 0xE4, 0x11, 0x37, 0x74,
-    0x11, 0x4F, 0xFE, 0x40, 0x5E, 0xB8, 0xD8, 0x5A, 0x92, 0xBD, 0x63, 0x68, 0x42, 0x3B, 0x31, 0xAF,
-    0xC3, 0x65, 0xB4, 0x08, 0xEB, 0x60, 0xF1, 0x2C, 0x34, 0x74, 0x2D, 0x3C, 0x94, 0xFC, 0xCF, 0x56,
-    0x36, 0x1A, 0xCB, 0xBB, 0x8A, 0x68, 0x75, 0x34, 0x7E, 0x12, 0x6F, 0x65, 0x2E, 0x0C, 0xFA, 0x11,
-    0x02, 0xEE, 0xEC, 0xF9, 0xFA, 0xC2, 0xF1, 0x9F, 0x6A, 0x30, 0x90, 0xFA, 0xC4, 0xF1, 0xB8, 0xEB,
-    0x70, 0xCC, 0x66, 0xC7, 0xFE, 0x99, 0x2D, 0x66, 0x83, 0xA4, 0xBF, 0x68, 0xBD, 0x5A, 0x23, 0xDE,
-    0xDC, 0x26, 0xFA, 0xFE, 0xD7, 0xA2, 0x9D, 0xDD, 0x10, 0xD9, 0x9A, 0x46, 0x51, 0x8D, 0xC1, 0xD9,
-    0xD5, 0xD6, 0x72, 0x64, 0xBA, 0x94, 0xA9, 0xC0, 0xDC, 0x60, 0x5E, 0x8E, 0x38, 0x2C, 0xC7, 0xE2,
-    0xD3, 0xD6, 0xCC, 0xC6, 0x33, 0x1F, 0xCD, 0x25, 0xFD, 0x06, 0x17, 0x70, 0xDC, 0xFF, 0xE8, 0xAF,
-    0x7C, 0x78, 0x9B, 0x71, 0x62, 0xA0, 0xDA, 0xF1, 0xF2, 0x21, 0xB7, 0x5E, 0xC5, 0x8F, 0xD4, 0x5E,
-    0x16, 0x89, 0xCE, 0x8E, 0x78, 0xDB, 0x85, 0x70, 0x13, 0xA9, 0x1E, 0x8B, 0x6E, 0x47, 0xD7, 0xBB,
-    0x87, 0xC6, 0x81, 0xD8, 0x20, 0x58, 0xE3, 0x78, 0xDC, 0x75, 0x1D, 0x11, 0xDB, 0xEC, 0xD0, 0x3F,
-    0x73, 0xC9, 0xA1, 0xD6, 0x8E, 0x17, 0x1C, 0x6C, 0xB5, 0x28, 0x1A, 0x26, 0x87, 0xF5, 0xAE, 0x43,
-    0x7B, 0xB6, 0xD2, 0xFF, 0xE5, 0x9E, 0xC6, 0xCD, 0xEA, 0x8C, 0xB2, 0x9F, 0xAD, 0x18, 0xE4, 0x86,
-    0x4B, 0x5D, 0x96, 0x1F, 0x4F, 0xC6, 0xB7, 0x87, 0x0E, 0x59, 0x1A, 0x9D, 0x8C, 0xE9, 0x43, 0xF3,
-    0x41, 0xE7, 0x72, 0x2C, 0xF8, 0x4C, 0x1C, 0x34, 0x09, 0x7F, 0x33, 0x4C, 0xC2, 0xC1, 0x24, 0xC4,
-    0x9B, 0xF1, 0x47, 0xC9, 0x14, 0x36, 0xEE, 0x77, 0x3C, 0x82, 0x0F, 0xD5, 0xC2, 0x2F, 0xF2, 0x5F,
-    0x37, 0x6F, 0xCA, 0x4F, 0xDE, 0x97, 0x37, 0xCE, 0x77, 0xAB, 0x90, 0x3E, 0x3C, 0x75, 0x75, 0xFE,
-    0x79, 0xF3, 0x73, 0x69, 0x3E, 0x96, 0xF7, 0x7D, 0xCF, 0xDB, 0x6F, 0xF5, 0xCC, 0xE3, 0x97, 0x31,
-    0x68, 0x3D, 0xDD, 0x7D, 0x4E, 0xA7, 0x99, 0xFE, 0x88, 0x31, 0x1F, 0xA3, 0xBD, 0x60, 0xF1, 0x83,
-    0xEF, 0xC2, 0x3E, 0xA1, 0xCB, 0x3F, 0x3D, 0xC6, 0x6D, 0xBD, 0xAF, 0x3E, 0x07, 0x2B, 0xC4, 0xA5,
-    0x77, 0x90, 0x23, 0x7B, 0x25, 0x58, 0x3C, 0xC7, 0x7D, 0x42, 0x58, 0xDB, 0xDC, 0x6D, 0x0F, 0x89,
-    0x1E, 0x31, 0x15, 0x5F, 0x00, 0x2D, 0xBF, 0x20, 0x93, 0xEF, 0x82, 0x1A, 0x31, 0x6B, 0x51, 0xEC,
-    0xD0, 0x1B, 0xCA, 0x8F, 0xF4, 0xD4, 0x0A, 0x01, 0xDF, 0x52, 0xFE, 0xFA, 0xF9, 0x69, 0x90, 0x36,
-    0x1A, 0x2E, 0xDB, 0x70, 0x24, 0x9D, 0x36, 0x97, 0xE8, 0x8E, 0xDB, 0xC6, 0x0D, 0x9F, 0x31, 0xF4,
-    0x5D, 0x5A, 0xFC, 0x9B, 0x8B, 0x62, 0xC9, 0xDC, 0xA3, 0x8B, 0x1C, 0xBB, 0x22, 0xB3, 0x91, 0xE4,
-    0xB6, 0x49, 0x32, 0x47, 0x62, 0x33, 0xBF, 0x77, 0xB3, 0xC5, 0x1D, 0x0B, 0x10, 0x9E, 0x82, 0x51,
-    0x43, 0x26, 0x00, 0x55, 0x85, 0x9C, 0x29, 0x30, 0xC4, 0xA0, 0xB9, 0x4F, 0xBB, 0xF0, 0x79, 0x1C,
-    0x09, 0x93, 0xA8, 0xF9, 0xD3, 0x3D, 0xF8, 0xB0, 0x46, 0xD2, 0x7F, 0xD4, 0x11, 0x5B, 0xC0, 0x87,
-    0x29, 0xD0, 0x7A, 0x7F, 0xE3, 0xC3, 0xA2, 0x7A, 0x5E, 0x47, 0xFF, 0xE6, 0xEA, 0xE8, 0xDF, 0x3F,
-    0xAB, 0x34, 0x94, 0x54, 0x2F, 0x68, 0xB0, 0xEC, 0x69, 0x2D, 0x08, 0x27, 0x12, 0x37, 0xE8, 0x46,
-    0x6B, 0x87, 0xCD, 0x03, 0xEA, 0xA6, 0x26, 0x12, 0x17, 0x3B, 0x70, 0xE3, 0x98, 0xA1, 0x7B, 0x65,
-    0x29, 0xD6, 0x0E, 0x63, 0xEB, 0x61, 0xB6, 0x76, 0xBE, 0xF3, 0x80, 0xE2, 0x64, 0xFC, 0x97, 0xF8,
-    0xBB, 0x95, 0xF5, 0xFE, 0xED, 0xA5, 0x45, 0xFC, 0x04, 0x0E, 0xFD, 0x76, 0x31, 0xA7, 0x1A, 0x4A,
-    0x42, 0xFC, 0x35, 0x11, 0xC1, 0xBA, 0x3D, 0xEF, 0xD4, 0x12, 0x4A, 0x96, 0x33, 0x7B, 0x4F, 0xA7,
-    0xCC, 0x32, 0xFD, 0x75, 0x7B, 0x5D, 0xDE, 0x7C, 0x43, 0x5E, 0x1B, 0xA0, 0x6C, 0x77, 0x3D, 0xEF,
-    0xAE, 0x9F, 0xFE, 0x7D, 0xDE, 0x48, 0x5E, 0x0B, 0xD5, 0xFA, 0xCD, 0x7F, 0x97, 0xAB, 0x0F, 0xC6,
-    0x65, 0x4B, 0x67, 0x3C, 0x2E, 0xDB, 0x17, 0xB6, 0x83, 0xDD, 0xDF, 0xEF, 0x7E, 0x95, 0x6F, 0xF2,
-    0x18, 0xE7, 0xBA, 0x3F, 0xC5, 0x2F, 0x40, 0x40, 0x62, 0x2C, 0xC0, 0x4F, 0xB0, 0x00, 0x8F, 0x46,
-    0x0B, 0xFF, 0xFB, 0xDF, 0xBB, 0xB3, 0x1B, 0x2A, 0xD6, 0xDB, 0xA1, 0xE2, 0x79, 0xEF, 0xD3, 0x91,
-    0xDB, 0xEE, 0x30, 0x42, 0x78, 0xB9, 0xBE, 0xDF, 0xEA, 0x0A, 0x7D, 0x29, 0x2F, 0xB6, 0xC2, 0xBA,
-    0xC2, 0xB6, 0xA9, 0x21, 0xD1, 0x18, 0x33, 0x79, 0x74, 0xE6, 0xED, 0xD6, 0xBC, 0xE1, 0x4E, 0x70,
-    0x83, 0x82, 0xA7, 0x1E, 0x3E, 0xE1, 0x38, 0x79, 0x11, 0x61, 0xE9, 0xBD, 0x5B, 0x2B, 0xD8, 0xDC,
-    0x0C, 0x36, 0xEF, 0x8A, 0x5F, 0x4D, 0x70, 0x7A, 0xA8, 0x9F, 0x22, 0xB7, 0x89, 0x68, 0xF0, 0x95,
-    0xCD, 0x36, 0x13, 0x54, 0xE1, 0xB5, 0x5F, 0x75, 0xBE, 0xB8, 0xC5, 0x9F, 0x21, 0x1C, 0x0C, 0xEF,
-    0xC7, 0x06, 0x35, 0xEC, 0x8F, 0x83, 0x62, 0x32, 0xEC, 0x05, 0x72, 0x95, 0x45, 0x3E, 0xC8, 0x77,
-    0xF0, 0x61, 0x6A, 0x1C, 0x6E, 0xD7, 0xFA, 0x2E, 0x35, 0x55, 0xED, 0xF8, 0x83, 0x35, 0x8B, 0x46,
-    0x2A, 0xDB, 0x45, 0xFE, 0xBA, 0xAF, 0xEA, 0xBD, 0x68, 0xA9, 0x83, 0x66, 0x43, 0x9E, 0x28, 0xFB,
-    0x75, 0x3E, 0x64, 0xF3, 0x39, 0x19, 0xBF, 0x6B, 0x87, 0x72, 0x13, 0x93, 0xA8, 0x4C, 0xC8, 0x34,
-    0xF8, 0xD3, 0xEF, 0xD4, 0x36, 0xA5, 0xAE, 0x2B, 0x5D, 0xF7, 0xC7, 0xBF, 0x79, 0x3B, 0xE2, 0xBF,
-    0x8F, 0xFB, 0x5B, 0xC1, 0xA5, 0x21, 0xB1, 0x97, 0xF5, 0x3E, 0xAF, 0xA3, 0x3A, 0x56, 0x15, 0xA8,
-    0x96, 0x53, 0xCA, 0xFE, 0xD2, 0x90, 0x44, 0xD0, 0x90, 0x28, 0x65, 0x1A, 0xFA, 0xD3, 0x9B, 0x1D,
-    0x2A, 0x6F, 0xFD, 0x98, 0x32, 0x2E, 0x65, 0x27, 0x83, 0xCC, 0x5C, 0x06, 0x7F, 0x9F, 0xB8, 0xC4,
-    0x0C, 0xF1, 0xA1, 0xAA, 0x9C, 0xF1, 0x3B, 0xBB, 0xAD, 0xDC, 0x8D, 0x47, 0x8D, 0x8C, 0x27, 0x58,
-    0xDD, 0x22, 0x3A, 0x5B, 0xF9, 0xA7, 0xA4, 0xFA, 0x94, 0xD8, 0xD1, 0x1F, 0x16, 0xF6, 0x8D, 0x1C,
-    0x0F, 0x4A, 0x99, 0xA8, 0x77, 0xC2, 0x20, 0x4E, 0x8B, 0xB2, 0x1A, 0x63, 0x49, 0x0E, 0x32, 0xB7,
-    0x05, 0xD4, 0x4C, 0x5B, 0x4D, 0x7A, 0x9A, 0xEA, 0x70, 0x3D, 0x2F, 0x82, 0x43, 0x4E, 0x82, 0xA5,
-    0x25, 0x5C, 0x06, 0x6B, 0xEE, 0x93, 0xEF, 0x9C, 0xB2, 0x8E, 0xD7, 0xEF, 0x39, 0xA4, 0x75, 0x0A,
-    0xFE, 0x7C, 0x87, 0x09, 0xAD, 0x23, 0x79, 0x55, 0xE4, 0x01, 0x76, 0x3F, 0x66, 0x3F, 0xC6, 0xD3,
-    0x3F, 0xAF, 0x86, 0xDD, 0x8F, 0xDD, 0x17, 0xCA, 0xF8, 0xC1, 0xD3, 0x2D, 0x6D, 0x85, 0x0A, 0xF7,
-    0x51, 0x73, 0x72, 0x46, 0xBE, 0xA5, 0x81, 0x78, 0x55, 0x5E, 0x06, 0xF6, 0xBC, 0xAB, 0x3D, 0xFB,
-    0x57, 0x96, 0xF1, 0x97, 0x43, 0x19, 0xBF, 0x94, 0x9D, 0x1F, 0x65, 0xE6, 0x4F, 0x40, 0xF0, 0x53,
-    0x89, 0x29, 0xB6, 0xF0, 0xF0, 0x67, 0x12, 0xBA, 0x96, 0x7A, 0xE1, 0x4F, 0x24, 0x06, 0x3F, 0xFD,
-    0x6D, 0xC9, 0xFF, 0x02, 0x9D, 0x55, 0x3D, 0x6C, 0xDB, 0x46, 0x14, 0xFE, 0x4E, 0xB4, 0xCC, 0x58,
-    0x57, 0xFB, 0x04, 0x54, 0xEE, 0x4F, 0xE2, 0x98, 0x1D, 0x3C, 0x04, 0x86, 0x23, 0x7A, 0x10, 0x0A,
-    0x0D, 0x92, 0x78, 0x69, 0xF7, 0x42, 0x40, 0xEC, 0xB9, 0x05, 0x1A, 0x20, 0x68, 0x3A, 0x44, 0x83,
-    0x07, 0x0D, 0xB6, 0xC9, 0xA2, 0x7B, 0xE1, 0xA1, 0xE8, 0xD2, 0xC5, 0x83, 0x87, 0x54, 0x19, 0xEC,
-    0x16, 0x19, 0x3C, 0xD8, 0xD2, 0x15, 0x69, 0x87, 0x6E, 0x1C, 0x0A, 0x74, 0xE5, 0x56, 0x34, 0x1D,
-    0xC2, 0x02, 0x0C, 0x20, 0xB7, 0x94, 0xAE, 0xEF, 0x48, 0x33, 0x89, 0x93, 0x14, 0x01, 0x7A, 0x8F,
-    0x7F, 0x47, 0xBE, 0xBB, 0x7B, 0xF7, 0x7D, 0xDF, 0x7B, 0x5C, 0x85, 0x17, 0x08, 0x65, 0xC5, 0x18,
-    0xA3, 0xC5, 0x0E, 0xAC, 0x44, 0x84, 0x6E, 0xD0, 0xC1, 0x03, 0xE0, 0x33, 0x40, 0xC3, 0xD2, 0x4A,
-    0xFC, 0x16, 0xBB, 0x48, 0xFB, 0xB8, 0xCE, 0x24, 0x93, 0x22, 0xB5, 0x02, 0x57, 0x3F, 0x96, 0x2D,
-    0x47, 0xA3, 0xC1, 0xEE, 0x61, 0x30, 0xD8, 0xD7, 0x3A, 0x1E, 0xE9, 0x18, 0xD4, 0x34, 0x3D, 0x9A,
-    0x73, 0x73, 0x73, 0xB3, 0xBB, 0x82, 0x77, 0x5A, 0x68, 0xB9, 0x83, 0xB1, 0xD0, 0x11, 0x1B, 0xCA,
-    0xDA, 0x70, 0xB8, 0x83, 0x2A, 0xE4, 0x89, 0x1D, 0x9E, 0xDA, 0xD1, 0xB6, 0xA5, 0x16, 0xE1, 0x47,
-    0x6F, 0x25, 0x38, 0x46, 0xC2, 0x63, 0x21, 0x05, 0xCA, 0x34, 0xDE, 0x49, 0x3A, 0x3B, 0x0F, 0x96,
-    0x8F, 0x16, 0xFA, 0x75, 0x2F, 0xE5, 0x11, 0x0E, 0x2E, 0x4B, 0x2B, 0xF1, 0xA4, 0x1D, 0x0D, 0x21,
-    0xD4, 0x18, 0x6E, 0x29, 0x42, 0xD3, 0x0A, 0x70, 0x0B, 0xEF, 0x76, 0x70, 0x22, 0x1E, 0xC6, 0xB6,
-    0x56, 0x4C, 0x4B, 0x0C, 0x51, 0xDB, 0x31, 0x0D, 0xDD, 0xF2, 0xD8, 0x2D, 0x0C, 0x58, 0x2D, 0xED,
-    0xC3, 0xFB, 0x30, 0xA1, 0xA1, 0x29, 0xAC, 0x68, 0x07, 0x2C, 0x76, 0x80, 0xA6, 0x1D, 0x98, 0x40,
-    0x77, 0x40, 0xA3, 0xE8, 0x58, 0xB9, 0x76, 0x21, 0x48, 0xDC, 0x01, 0xD7, 0x91, 0xF3, 0xE7, 0xB8,
-    0x8D, 0x56, 0x13, 0x6B, 0x25, 0x65, 0x2B, 0xAE, 0x44, 0xE0, 0x4A, 0x0F, 0x1E, 0x7C, 0x2C, 0x42,
-    0x84, 0x42, 0x39, 0xCA, 0x09, 0x5C, 0xEA, 0xB7, 0xB1, 0x8D, 0x1A, 0x76, 0xE9, 0xBD, 0x07, 0x57,
-    0x3A, 0x84, 0x21, 0x57, 0x96, 0x62, 0x92, 0x87, 0x99, 0x57, 0x36, 0xAA, 0x83, 0x16, 0xF9, 0xAC,
-    0x1A, 0x84, 0xC3, 0x0C, 0xE1, 0x35, 0xDC, 0x2B, 0xA5, 0x76, 0x2C, 0x94, 0x8B, 0x26, 0xC5, 0xC1,
-    0x62, 0x16, 0x13, 0x64, 0xB1, 0xB9, 0xA3, 0x0B, 0x24, 0x64, 0xA6, 0x6F, 0xEE, 0x5D, 0x2C, 0x6E,
-    0xCA, 0x91, 0x56, 0x77, 0xEE, 0x2B, 0x58, 0x17, 0x8F, 0x52, 0x40, 0xB3, 0x4E, 0x90, 0xB2, 0xD4,
-    0x4E, 0xFC, 0xD0, 0x27, 0x5C, 0xCB, 0x5E, 0xFF, 0xE8, 0xA8, 0xEF, 0x96, 0x99, 0xB4, 0x94, 0xB1,
-    0xD1, 0xD4, 0x9F, 0x2C, 0x6E, 0x8C, 0xA6, 0x9F, 0xFF, 0x91, 0xF7, 0x01, 0x73, 0xBD, 0x7B, 0x36,
-    0x9A, 0xBE, 0xFD, 0xAB, 0xA5, 0x68, 0xBC, 0xE1, 0x4A, 0xB3, 0x6E, 0x29, 0x2E, 0xCC, 0x8A, 0x0F,
-    0x23, 0xAD, 0x86, 0x72, 0x83, 0xA2, 0x2C, 0x2C, 0xC5, 0x68, 0xDF, 0x8F, 0xAF, 0x44, 0xAD, 0xE1,
-    0xB0, 0xF5, 0x3C, 0x77, 0x2F, 0x32, 0x25, 0x08, 0x24, 0x47, 0xD6, 0x69, 0xB3, 0x55, 0x5A, 0xC7,
-    0x0E, 0x44, 0x82, 0x13, 0x83, 0x8F, 0x3F, 0xF6, 0x42, 0x06, 0x41, 0x5F, 0xB6, 0x89, 0xE8, 0x13,
-    0x9A, 0xCD, 0x8B, 0x99, 0x3C, 0x67, 0x8B, 0x44, 0x42, 0x21, 0xFC, 0x3D, 0x38, 0x4C, 0x68, 0xB6,
-    0xEC, 0xE8, 0xA2, 0xDC, 0x17, 0x2C, 0x6C, 0x09, 0x4B, 0xB9, 0x5A, 0x07, 0x76, 0x74, 0xFA, 0x0A,
-    0xAE, 0x2F, 0xC8, 0x92, 0x8D, 0x49, 0x96, 0x85, 0xD2, 0x92, 0x57, 0x92, 0xC8, 0xBA, 0x2C, 0xE0,
-    0x13, 0x33, 0xE3, 0xE3, 0xA0, 0xC5, 0x35, 0xC1, 0x7E, 0xFC, 0x4C, 0xB4, 0xBE, 0xD6, 0x13, 0x73,
-    0xE2, 0xBC, 0x15, 0x02, 0x2E, 0xFA, 0x83, 0xCC, 0x33, 0x17, 0x34, 0x93, 0x25, 0xB8, 0x09, 0x87,
-    0xAF, 0x0F, 0xF1, 0xC0, 0x4D, 0xB1, 0x4F, 0xFA, 0x7A, 0x51, 0xF4, 0x83, 0xAC, 0xE9, 0xAC, 0xE5,
-    0xCF, 0xC6, 0xA3, 0xA4, 0xE0, 0x44, 0x18, 0x05, 0x3C, 0x85, 0x1F, 0x92, 0x62, 0xF0, 0x9E, 0x79,
-    0xCB, 0x24, 0x91, 0x12, 0x02, 0x9C, 0xE0, 0x14, 0x44, 0x08, 0xA9, 0x93, 0xF4, 0x02, 0xC2, 0x0D,
-    0x04, 0x15, 0x08, 0x7E, 0x92, 0x07, 0xB9, 0xC4, 0x2F, 0xBB, 0xB9, 0x2F, 0xBB, 0x95, 0xCE, 0xDD,
-    0xEC, 0x73, 0x37, 0x21, 0x73, 0x37, 0x33, 0xE3, 0x36, 0x9D, 0xDD, 0xB4, 0x2E, 0x44, 0x3D, 0xED,
-    0x12, 0xC6, 0x4F, 0xF1, 0x9E, 0x0E, 0x46, 0x14, 0x27, 0xC5, 0x6D, 0xC2, 0x21, 0x18, 0xC2, 0xDD,
-    0xC1, 0xFD, 0xB0, 0x8F, 0xD2, 0xD3, 0xD3, 0xBC, 0x5B, 0x1D, 0x0C, 0x02, 0xFE, 0x64, 0x0A, 0x77,
-    0x44, 0xF8, 0x11, 0x33, 0x5B, 0x9C, 0x85, 0xB5, 0x5A, 0x7B, 0x9B, 0xA0, 0x88, 0x9C, 0xA4, 0x7D,
-    0x52, 0x5B, 0x99, 0x55, 0xAE, 0x6A, 0x53, 0x3C, 0x2E, 0x2D, 0x6C, 0x12, 0xC6, 0x93, 0xCD, 0xD7,
-    0x82, 0xF9, 0x5F, 0x29, 0xF1, 0x2A, 0xB6, 0x7C, 0xF8, 0x94, 0x88, 0xB6, 0x12, 0x72, 0x8E, 0xF6,
-    0x15, 0x62, 0xC6, 0x51, 0xF0, 0xDC, 0x8F, 0xA5, 0xE7, 0x39, 0x41, 0xBD, 0x2D, 0x60, 0x32, 0xA9,
-    0x06, 0x13, 0x41, 0x07, 0x5E, 0x24, 0xC2, 0xC5, 0xCD, 0xCD, 0x0D, 0x43, 0xEA, 0xEE, 0x60, 0x70,
-    0x4A, 0x5B, 0x6F, 0x17, 0x67, 0xCD, 0xB8, 0xBD, 0x26, 0xAE, 0x8B, 0x25, 0xC4, 0x4B, 0xBD, 0x94,
-    0x44, 0x9D, 0x1B, 0xF1, 0xC5, 0x6E, 0xFE, 0x18, 0x70, 0xFD, 0x65, 0x1E, 0x9D, 0x4B, 0xD1, 0x6D,
-    0xDF, 0x03, 0xD6, 0xCF, 0xA7, 0xA9, 0x98, 0x02, 0x66, 0x08, 0x22, 0xE4, 0xA9, 0x98, 0xD9, 0x63,
-    0x4B, 0x39, 0xFA, 0xDB, 0xA0, 0xED, 0x68, 0xD9, 0x2A, 0x4D, 0x90, 0x17, 0x38, 0xC3, 0x4A, 0x90,
-    0xF9, 0xCE, 0x06, 0x73, 0xEE, 0xF8, 0x7A, 0x67, 0x94, 0x6E, 0xF1, 0x84, 0xBE, 0x88, 0x68, 0xD9,
-    0x9B, 0xEE, 0xF4, 0xFD, 0xB4, 0x37, 0x1B, 0x51, 0xD7, 0xBE, 0x11, 0xBA, 0x7A, 0xEC, 0xEB, 0x89,
-    0xB8, 0x11, 0x97, 0x6E, 0x64, 0x35, 0x8B, 0xB2, 0x9E, 0x47, 0xEE, 0x38, 0xCF, 0x67, 0xCA, 0x70,
-    0x45, 0xCF, 0x53, 0x1D, 0xBA, 0x63, 0x3B, 0xDF, 0x8A, 0x28, 0xAE, 0x37, 0x7F, 0x86, 0xE8, 0xE2,
-    0x87, 0xAF, 0x68, 0xC5, 0x05, 0xE0, 0x08, 0x20, 0xD8, 0x3E, 0xC9, 0x44, 0x37, 0x87, 0x6E, 0x0F,
-    0x58, 0x28, 0x9F, 0x7B, 0xEE, 0x91, 0x64, 0x44, 0x6C, 0x44, 0x73, 0x3E, 0x76, 0xDF, 0x7C, 0xAD,
-    0x80, 0xAE, 0xF3, 0xC5, 0xA8, 0x7C, 0x06, 0x7C, 0xFF, 0x11, 0x10, 0xE3, 0xD3, 0x5F, 0x9E, 0xAD,
-    0x62, 0xAE, 0xDA, 0xC4, 0xA0, 0xF3, 0x18, 0x4C, 0xF1, 0xF2, 0x29, 0x42, 0x1E, 0xF9, 0x41, 0x92,
-    0xC5, 0xEB, 0x10, 0x1F, 0x5B, 0xF4, 0x23, 0xE9, 0x53, 0x81, 0xE4, 0x28, 0xE9, 0x40, 0xE8, 0xD8,
-    0xFD, 0x66, 0x4C, 0x58, 0xD6, 0x5A, 0xB5, 0xBC, 0xFE, 0xE2, 0x1A, 0x2E, 0xBD, 0xD7, 0x49, 0x45,
-    0x22, 0x62, 0x6F, 0x7C, 0xD5, 0xC8, 0xA6, 0x6B, 0xD3, 0x78, 0xAA, 0x3B, 0x92, 0xEA, 0xFF, 0xBE,
-    0xC4, 0x19, 0xBC, 0xD0, 0x8E, 0x1C, 0xFA, 0x03, 0xEC, 0x67, 0x59, 0xD3, 0x21, 0x73, 0xA2, 0x11,
-    0x4A, 0x89, 0x06, 0x7F, 0xF2, 0x7B, 0xE0, 0x7D, 0xF0, 0x50, 0x35, 0xAC, 0x2F, 0x68, 0x0F, 0xC7,
-    0x94, 0x58, 0x82, 0xD6, 0x11, 0x54, 0xDC, 0x6F, 0xA1, 0xB6, 0x3B, 0xDA, 0x21, 0xC0, 0xDE, 0xFC,
-    0xC9, 0x4B, 0xFD, 0x09, 0x8F, 0xEA, 0xC7, 0x97, 0xB2, 0x9C, 0x33, 0x42, 0xF6, 0x46, 0x8F, 0x55,
-    0x5F, 0x94, 0xD4, 0x16, 0x95, 0x1A, 0x73, 0x37, 0x7D, 0x1E, 0x4F, 0x61, 0xF6, 0xBA, 0x94, 0x53,
-    0xDE, 0x34, 0x10, 0xDC, 0xCA, 0x92, 0x74, 0xCF, 0xE4, 0x19, 0x65, 0x95, 0x61, 0x8D, 0xCA, 0x3C,
-    0x3F, 0x23, 0xE6, 0x26, 0x60, 0x5A, 0x1F, 0x6A, 0xDA, 0xE5, 0x15, 0xAD, 0xA7, 0x44, 0x29, 0x2E,
-    0x0F, 0xE4, 0xFF, 0x18, 0xF0, 0xAC, 0x58, 0x14, 0x3A, 0x7C, 0xBE, 0x8B, 0x4D, 0xE3, 0xD8, 0xE5,
-    0x5A, 0xEF, 0x81, 0x45, 0xDE, 0x3F, 0x5A, 0x3F, 0x3A, 0x54, 0x7D, 0x30, 0xCA, 0x59, 0x49, 0x95,
-    0x87, 0xDD, 0x39, 0x28, 0x04, 0x8C, 0x59, 0xAD, 0xCF, 0xF2, 0x14, 0xD6, 0x21, 0x95, 0xC6, 0xAF,
-    0xD9, 0xDD, 0x94, 0x04, 0x45, 0x6F, 0x46, 0x04, 0xBD, 0x21, 0x4A, 0x99, 0x4A, 0x41, 0x7F, 0x41,
-    0x3C, 0xD7, 0x66, 0xF2, 0x1B, 0x97, 0x5E, 0xB6, 0x66, 0x94, 0xDF, 0xF2, 0xAC, 0xE0, 0xB9, 0xE2,
-    0xE6, 0x0A, 0x5F, 0x9E, 0xCC, 0x2C, 0x61, 0x9E, 0x4F, 0x9A, 0xF3, 0xEB, 0xF3, 0xED, 0xD3, 0xB2,
-    0xB4, 0x93, 0xA5, 0xAB, 0x8D, 0x8A, 0xA7, 0x1B, 0x44, 0xA0, 0xF8, 0x8E, 0x6D, 0x54, 0x7B, 0xE8,
-    0xE5, 0xAD, 0x4A, 0x6A, 0x5E, 0xBB, 0x8A, 0x75, 0x8E, 0x9E, 0x6D, 0x8E, 0x46, 0x05, 0xCB, 0x27,
-    0x94, 0xD6, 0x58, 0xAF, 0x14, 0xD6, 0x58, 0xA8, 0x0F, 0xCB, 0x92, 0xC7, 0x2D, 0x33, 0x8A, 0xAC,
-    0x81, 0xE5, 0x03, 0x72, 0xA8, 0x18, 0xE3, 0x8F, 0x9A, 0xCB, 0xBD, 0x85, 0x5E, 0xA5, 0x97, 0x79,
-    0x31, 0xB9, 0x4E, 0x5F, 0x1B, 0x78, 0x7F, 0xDC, 0x5A, 0x68, 0xF0, 0xC2, 0xAA, 0xEC, 0xF6, 0x5F,
-    0x13, 0xF4, 0xEB, 0xB4, 0xC4, 0x92, 0xF5, 0xD2, 0x59, 0x9D, 0x61, 0xB8, 0xAD, 0x4E, 0x49, 0xB5,
-    0x85, 0x55, 0x61, 0xF4, 0xEC, 0x46, 0xF3, 0x28, 0x8C, 0xEF, 0xB1, 0xEE, 0x3A, 0xC5, 0x46, 0x84,
-    0xBF, 0x81, 0xF9, 0x35, 0x54, 0x1A, 0xB0, 0x7A, 0x59, 0xF9, 0x94, 0x58, 0x99, 0x33, 0x6F, 0xEC,
-    0x1E, 0x95, 0x3F, 0x03, 0xD8, 0x02, 0xFD, 0x42, 0xE6, 0x51, 0x65, 0xF8, 0x17, 0xE5, 0x7D, 0x4F,
-    0x8C, 0xE4, 0xD6, 0x99, 0xDF, 0x23, 0xE9, 0x19, 0xAE, 0x4D, 0xC4, 0xF4, 0x61, 0xE4, 0x38, 0x1A,
-    0x44, 0xDC, 0x4B, 0x00, 0xAF, 0x76, 0x35, 0xBC, 0xC6, 0x80, 0xA7, 0x48, 0xED, 0x02, 0xD9, 0xA3,
-    0x3B, 0xC0, 0x94, 0x06, 0xF1, 0x1C, 0x46, 0x87, 0x3D, 0xC4, 0x76, 0xE2, 0xBE, 0xEC, 0xC1, 0x08,
-    0xD4, 0x4D, 0x7A, 0x0D, 0x64, 0x0F, 0x39, 0xEC, 0x1C, 0x34, 0xD9, 0x20, 0x39, 0x58, 0x07, 0xD9,
-    0x90, 0x6B, 0x0E, 0x9D, 0x83, 0x0F, 0x5A, 0xA0, 0xAB, 0x49, 0xDB, 0x87, 0x3D, 0xEC, 0x41, 0x04,
-    0x6C, 0x21, 0x07, 0x1F, 0xB6, 0x76, 0xAD, 0x81, 0xB3, 0xCA, 0x41, 0xF4, 0xAA, 0x04, 0x57, 0xB7,
-    0xC8, 0x62, 0xBE, 0xDF, 0xEF, 0x7B, 0x64, 0x55, 0xF5, 0xBF, 0xE9, 0x19, 0xCD, 0x68, 0x66, 0x93,
-    0x9E, 0xE2, 0xF7, 0x6A, 0xAA, 0xC8, 0xC7, 0xF7, 0x3E, 0xBE, 0xF7, 0xFD, 0xFF, 0xBE, 0x72, 0xDF,
-    0x34, 0xC6, 0x6D, 0x8C, 0x31, 0x07, 0x72, 0xC4, 0xA9, 0x31, 0x41, 0x29, 0x1F, 0x54, 0xA6, 0xFF,
-    0x2B, 0xBA, 0xAE, 0xEA, 0xBA, 0x6E, 0x26, 0x47, 0x85, 0xD3, 0xCE, 0x3A, 0xBA, 0xC9, 0x24, 0x97,
-    0x73, 0x4A, 0x1C, 0xE7, 0x9D, 0x87, 0x63, 0x39, 0x99, 0xDC, 0xB1, 0x7D, 0xCE, 0x9C, 0xFC, 0x8A,
-    0xF1, 0xEA, 0x1D, 0x39, 0x0E, 0x8C, 0x37, 0xDB, 0x31, 0xEB, 0x7F, 0x4F, 0xFA, 0xDE, 0x05, 0x2E,
-    0xC0, 0x5D, 0xBA, 0xCA, 0xE8, 0x7B, 0x13, 0x96, 0xB8, 0xF1, 0x03, 0xE0, 0x4F, 0xC6, 0x82, 0xA7,
-    0xB0, 0xEB, 0x16, 0x84, 0x9D, 0xC0, 0x8F, 0x4C, 0x51, 0xE2, 0xDB, 0x70, 0x06, 0xE8, 0xD7, 0x80,
-    0xDE, 0x19, 0x50, 0xBF, 0x0D, 0x2B, 0x81, 0xE3, 0x0C, 0x57, 0xB1, 0x87, 0x12, 0xBD, 0x19, 0xF3,
-    0x9C, 0xF4, 0x6C, 0xBE, 0x61, 0x8C, 0x23, 0x63, 0xF5, 0xE6, 0xF2, 0x34, 0xE4, 0x49, 0x44, 0xF2,
-    0xD9, 0x4B, 0x1B, 0x58, 0x29, 0x2F, 0x3A, 0xDB, 0x47, 0x39, 0xF4, 0xEF, 0x72, 0xB7, 0x4C, 0x4D,
-    0xD2, 0x75, 0xB5, 0xD3, 0xBD, 0xBF, 0x57, 0xF9, 0xAD, 0x71, 0xF2, 0xB0, 0xC6, 0x12, 0x01, 0x0A,
-    0x12, 0x8C, 0x32, 0x33, 0x76, 0xD5, 0x98, 0xD6, 0x28, 0x62, 0xDF, 0x34, 0x32, 0xA6, 0x46, 0x41,
-    0x3B, 0x7C, 0xC1, 0x53, 0x0A, 0x80, 0x84, 0x00, 0x1D, 0x44, 0x33, 0x01, 0x01, 0x66, 0xEC, 0x75,
-    0x77, 0x6F, 0x11, 0xFB, 0x95, 0x09, 0xBA, 0x2E, 0x37, 0xE6, 0x52, 0xAA, 0x03, 0xD8, 0xEE, 0xEE,
-    0x78, 0xD2, 0x51, 0xB8, 0xBC, 0xB7, 0x88, 0x4A, 0x73, 0x05, 0xB7, 0x4C, 0x6C, 0x1F, 0x78, 0x8F,
-    0x71, 0x84, 0x82, 0x20, 0x1F, 0xD7, 0x74, 0x87, 0xD2, 0x25, 0xDE, 0x14, 0x32, 0x44, 0xBF, 0xB1,
-    0x77, 0xC6, 0x8D, 0x77, 0xED, 0x31, 0xFD, 0x82, 0xA0, 0x34, 0xBB, 0x7B, 0x7B, 0x9E, 0xC9, 0x9D,
-    0xA2, 0x6E, 0x49, 0x4C, 0xEF, 0x37, 0xA7, 0xFF, 0xC9, 0xF9, 0xD7, 0x22, 0x93, 0xC4, 0xA9, 0xBC,
-    0xFE, 0xC5, 0xE7, 0x2C, 0x42, 0xDC, 0x1A, 0xCF, 0xEF, 0x93, 0xBF, 0xB0, 0xC1, 0xC2, 0xC7, 0xF7,
-    0x8A, 0xF3, 0x71, 0x61, 0x8A, 0xA5, 0x29, 0xE6, 0xE6, 0x92, 0xE1, 0x7A, 0x5C, 0x62, 0xB4, 0xD1,
-    0xF1, 0x36, 0x25, 0x1A, 0xCE, 0x6C, 0xE3, 0xBE, 0x35, 0x43, 0x9B, 0x4D, 0xB6, 0xB4, 0xED, 0xBA,
-    0x14, 0x68, 0x97, 0xB6, 0x46, 0xBB, 0x6B, 0xAE, 0x36, 0xDA, 0x0A, 0x96, 0xB5, 0x3D, 0xB0, 0x6D,
-    0x66, 0x46, 0x6C, 0x93, 0xA1, 0xDD, 0xB1, 0x9F, 0xEF, 0xDB, 0xF3, 0x1B, 0xB4, 0x5E, 0x73, 0x6F,
-    0x81, 0xFE, 0x8B, 0xB9, 0xF4, 0x88, 0x7E, 0x4B, 0x79, 0xFA, 0xD2, 0x1E, 0x9A, 0x2B, 0x16, 0xD9,
-    0xFB, 0x4A, 0x87, 0x70, 0x7A, 0xF8, 0x49, 0x5A, 0x59, 0x06, 0x21, 0x68, 0x59, 0xC7, 0xBF, 0x3B,
-    0xB6, 0x6D, 0xCC, 0x72, 0x3C, 0xBE, 0x7D, 0xFF, 0xEB, 0x9D, 0x3D, 0x2F, 0x29, 0xB5, 0x0D, 0x6D,
-    0x1B, 0x54, 0xB6, 0x9D, 0x6D, 0xFE, 0x3F, 0xB4, 0x6D, 0x64, 0xCF, 0xCB, 0x72, 0xB4, 0xEF, 0xDF,
-    0xD3, 0x7E, 0x40, 0x0F, 0xD8, 0xCA, 0xC6, 0xF9, 0xA4, 0x94, 0x45, 0xFB, 0x13, 0xBC, 0x0B, 0x65,
-    0xC9, 0xCA, 0x81, 0x5E, 0x3C, 0x80, 0xB2, 0x9C, 0x03, 0xCD, 0xF3, 0xDC, 0xB2, 0xA9, 0xDD, 0x1A,
-    0xEE, 0x1C, 0x5B, 0x0F, 0x98, 0x09, 0xD2, 0x75, 0x8A, 0xBB, 0x8F, 0x95, 0xD0, 0xE0, 0x81, 0x35,
-    0xFA, 0xB4, 0x5C, 0xCC, 0x49, 0xEE, 0xDA, 0xA0, 0x9F, 0x46, 0x56, 0x9B, 0x80, 0x0C, 0xF8, 0x95,
-    0xEF, 0x1B, 0x10, 0x28, 0x2C, 0x0A, 0x83, 0x69, 0xEA, 0xBB, 0xC6, 0x5B, 0xE0, 0xDB, 0x16, 0xA0,
-    0x00, 0x48, 0x70, 0x45, 0x84, 0x6B, 0x03, 0xF4, 0xE2, 0xA1, 0x3F, 0x87, 0x97, 0x17, 0x00, 0x09,
-    0x50, 0x28, 0x5F, 0x3F, 0x9F, 0x63, 0xFA, 0xA0, 0x0A, 0xE8, 0xD4, 0x12, 0xA2, 0x11, 0x71, 0x72,
-    0x6C, 0x7C, 0x0E, 0xF6, 0xA7, 0x07, 0x10, 0x00, 0x44, 0x00, 0x09, 0xC0, 0x54, 0x80, 0xB3, 0x10,
-    0xE0, 0xD5, 0x02, 0xE4, 0x99, 0xC9, 0x98, 0xF3, 0x06, 0x4B, 0x55, 0xC0, 0x0E, 0x80, 0xFC, 0x6B,
-    0x04, 0x17, 0x4D, 0xE3, 0xCF, 0x04, 0x60, 0x42, 0x8D, 0xAC, 0xEF, 0xA6, 0xD9, 0x05, 0xC0, 0x84,
-    0x96, 0x72, 0xEF, 0xA6, 0x9B, 0x01, 0x94, 0x00, 0x29, 0xC0, 0x1A, 0x59, 0x8C, 0xD2, 0x84, 0xCF,
-    0x0A, 0x5B, 0xC4, 0xC7, 0x43, 0x32, 0x0E, 0xCE, 0x5E, 0xFF, 0x53, 0x36, 0xAA, 0x94, 0x4A, 0xB0,
-    0x25, 0xFF, 0xC7, 0xA3, 0x95, 0xF1, 0xCC, 0x80, 0x4B, 0x25, 0x01, 0xF2, 0xC6, 0xC7, 0x4D, 0xB8,
-    0x36, 0x0F, 0x30, 0x7D, 0x9C, 0x0C, 0xA2, 0x96, 0x6B, 0xFF, 0x53, 0x3C, 0x18, 0x2C, 0x3E, 0xE3,
-    0xFD, 0x06, 0x44, 0xD2, 0xFD, 0x18, 0xA4, 0xD7, 0xE8, 0xBD, 0x8A, 0x6A, 0x20, 0xA3, 0x4A, 0x88,
-    0x95, 0xB8, 0x3A, 0x7C, 0xAE, 0x7B, 0x0B, 0x0E, 0x6D, 0x46, 0xC8, 0x2F, 0xB7, 0x2C, 0xDE, 0xDC,
-    0x1A, 0x78, 0x7B, 0xD2, 0x40, 0xB8, 0xC0, 0xBD, 0x1A, 0x7B, 0x4C, 0x81, 0x3C, 0x10, 0x0C, 0xED,
-    0x14, 0xA0, 0xE3, 0x22, 0x47, 0xC0, 0x1A, 0xC1, 0x2C, 0x38, 0x23, 0xAC, 0x24, 0xE3, 0xFC, 0x96,
-    0x2B, 0xE1, 0x1F, 0x31, 0x6B, 0xEF, 0xEF, 0xB0, 0x20, 0xB8, 0x05, 0x2D, 0x66, 0xA2, 0x7C, 0x97,
-    0x14, 0xCA, 0x22, 0x59, 0x66, 0x39, 0xB5, 0x48, 0x16, 0xE8, 0x80, 0xB1, 0x1B, 0x97, 0x37, 0xF7,
-    0x8E, 0x26, 0xF7, 0xE6, 0x40, 0xB5, 0xDC, 0x51, 0x4F, 0x00, 0xAA, 0x0F, 0x78, 0x49, 0x62, 0x39,
-    0xC9, 0x2E, 0x3B, 0xD4, 0xCE, 0x65, 0xA7, 0xCE, 0x3B, 0x7B, 0x9C, 0x29, 0x3F, 0xC8, 0x0E, 0x15,
-    0x9A, 0x9A, 0xE2, 0x36, 0xAD, 0xB9, 0xBD, 0x68, 0x45, 0x7A, 0x12, 0xCC, 0x2F, 0xE5, 0xD8, 0x95,
-    0x23, 0xC3, 0x21, 0x83, 0x3C, 0x90, 0xA3, 0x9D, 0x0A, 0x2F, 0x3A, 0x98, 0x14, 0x35, 0x38, 0x76,
-    0x21, 0xD4, 0xA1, 0xE8, 0xFE, 0x81, 0xA4, 0x68, 0xA6, 0x2C, 0x52, 0x76, 0xD7, 0x72, 0xB5, 0x11,
-    0x36, 0xC1, 0x81, 0x6E, 0x93, 0x6E, 0x52, 0xF0, 0x64, 0xDC, 0xB3, 0x9B, 0xE3, 0x33, 0x5E, 0x91,
-    0x60, 0x8F, 0xC6, 0xBA, 0x75, 0x7A, 0x10, 0x97, 0xFD, 0x76, 0xEA, 0x84, 0x17, 0xEF, 0xB5, 0x7A,
-    0x45, 0x67, 0xA9, 0xD1, 0x93, 0x95, 0x18, 0xFC, 0x0E, 0xAC, 0xDB, 0x27, 0xA1, 0x0B, 0x14, 0x92,
-    0x68, 0x9D, 0x05, 0xCF, 0x7C, 0xE5, 0x2B, 0x28, 0x9C, 0x09, 0xEC, 0x8D, 0x30, 0x31, 0x2B, 0x38,
-    0x35, 0x4A, 0x8A, 0x04, 0x82, 0xD6, 0x84, 0xE5, 0xB7, 0x8E, 0x26, 0x93, 0xBD, 0xF7, 0x0B, 0x52,
-    0x76, 0x85, 0xFB, 0x5C, 0x54, 0x67, 0x41, 0xF2, 0x98, 0x4B, 0x4F, 0x5A, 0xB6, 0x4C, 0x8C, 0xCE,
-    0x20, 0xCA, 0x65, 0x79, 0xC9, 0xB3, 0x92, 0xAD, 0x2E, 0x6D, 0x86, 0xED, 0x1F, 0x81, 0x24, 0xCA,
-    0x92, 0x8C, 0x72, 0x21, 0x04, 0x42, 0x2A, 0xA3, 0x5C, 0x08, 0xAC, 0xCC, 0x2E, 0xCA, 0xB1, 0x48,
-    0xA3, 0x3C, 0xCA, 0x41, 0x38, 0xC2, 0x2A, 0xCA, 0x21, 0x62, 0x79, 0xB5, 0x2E, 0x4F, 0x2C, 0x6C,
-    0x6E, 0x1C, 0x2E, 0x6D, 0xC3, 0x25, 0xBE, 0xB0, 0xDF, 0x63, 0xEB, 0xF7, 0xE7, 0xC7, 0x72, 0x4B,
-    0x6C, 0xA8, 0xBE, 0xBF, 0xA5, 0xB4, 0x42, 0x7A, 0x65, 0x31, 0x45, 0xB9, 0x20, 0x4C, 0xC8, 0x2B,
-    0xEF, 0x2F, 0xF4, 0x48, 0xDA, 0x02, 0x3B, 0x42, 0xDA, 0x24, 0x15, 0x4A, 0x82, 0xA1, 0x96, 0x05,
-    0x46, 0x80, 0x6F, 0xF1, 0x17, 0x40, 0x78, 0xC8, 0xB0, 0x60, 0x93, 0x1F, 0x08, 0x65, 0x11, 0x49,
-    0xBD, 0xD9, 0x14, 0xEB, 0xA6, 0xFD, 0x7F, 0x21, 0xAF, 0x82, 0x4F, 0x38, 0x13, 0x79, 0xF8, 0x6E,
-    0xD7, 0x72, 0x7C, 0xA4, 0x42, 0xBC, 0x62, 0xB9, 0x12, 0xFF, 0xD2, 0x01, 0x18, 0x0A, 0x91, 0x29,
-    0xD6, 0xF4, 0xC1, 0x78, 0xBB, 0xC1, 0x32, 0x9D, 0x89, 0xD8, 0x27, 0x0B, 0xD6, 0x3C, 0xF7, 0xD4,
-    0x69, 0xFD, 0x0E, 0xF7, 0x19, 0xF8, 0x64, 0x0C, 0x74, 0x53, 0xCC, 0x7C, 0xEA, 0x6C, 0xE8, 0xA9,
-    0xB1, 0x67, 0x55, 0x73, 0xA2, 0x75, 0x48, 0x99, 0xF0, 0x24, 0x8C, 0x15, 0x9A, 0xE3, 0xF0, 0xFC,
-    0xD7, 0x68, 0x0D, 0xEE, 0x10, 0xEE, 0x13, 0x92, 0x1C, 0x42, 0x58, 0x4C, 0x4C, 0xC7, 0x3D, 0x82,
-    0x99, 0x24, 0x56, 0x4C, 0x2C, 0x72, 0xEE, 0x8A, 0x12, 0x4A, 0x04, 0xB0, 0xE5, 0x73, 0x8A, 0xB2,
-    0x66, 0x65, 0xDE, 0x61, 0xD1, 0xC8, 0x55, 0x11, 0x9F, 0x48, 0x92, 0x34, 0xD2, 0xE7, 0xF5, 0xA4,
-    0x41, 0xB7, 0x09, 0x70, 0xBD, 0x48, 0x9A, 0x28, 0x77, 0xE6, 0x89, 0x20, 0xDF, 0xAD, 0x93, 0x26,
-    0xA8, 0xBC, 0x59, 0xD2, 0x78, 0xB3, 0xA0, 0x14, 0x58, 0x87, 0x02, 0x9D, 0xB9, 0xB0, 0x7A, 0x41,
-    0x83, 0x30, 0x99, 0xC6, 0xEC, 0x8F, 0x00, 0x77, 0x77, 0x00, 0xF5, 0x15, 0x2F, 0x00, 0x45, 0x1F,
-    0x1A, 0xA0, 0x5F, 0x91, 0xBC, 0x38, 0xE0, 0x1B, 0xF2, 0xF4, 0x2F, 0x08, 0x84, 0xB8, 0xDC, 0x5B,
-    0x80, 0x62, 0x29, 0x78, 0xA8, 0x6B, 0x57, 0xC0, 0x2E, 0x4A, 0x9F, 0xE4, 0x20, 0x03, 0x25, 0x76,
-    0xBB, 0x1F, 0x88, 0x26, 0xE4, 0x2F, 0xB0, 0xFB, 0x20, 0x63, 0x2C, 0x29, 0x8A, 0x64, 0xCA, 0xF2,
-    0x48, 0x25, 0xA2, 0xF2, 0x80, 0x2C, 0x8F, 0x94, 0x83, 0x84, 0x2D, 0xAC, 0x4E, 0x42, 0xFD, 0x56,
-    0xCF, 0xD4, 0xAB, 0xD0, 0x43, 0x6C, 0xE9, 0x8B, 0xF6, 0x1C, 0xCC, 0x41, 0x15, 0xDC, 0xEE, 0xEE,
-    0x76, 0xAD, 0xBA, 0x29, 0x1E, 0xC1, 0x21, 0x75, 0x59, 0x55, 0x56, 0xBB, 0x35, 0x79, 0xE0, 0xD3,
-    0x10, 0x41, 0x08, 0x8A, 0x8E, 0xCA, 0x68, 0xAE, 0x37, 0x0D, 0x04, 0x51, 0x2E, 0x96, 0x42, 0xCB,
-    0x0D, 0xAA, 0x07, 0xDE, 0x37, 0xFA, 0x79, 0x84, 0xD1, 0x55, 0x50, 0x95, 0xBA, 0xC9, 0x9D, 0x87,
-    0x50, 0x92, 0xDD, 0x87, 0x55, 0x92, 0xDB, 0x41, 0xB6, 0x5D, 0x81, 0x47, 0x54, 0x92, 0x89, 0xD9,
-    0x15, 0x38, 0xD1, 0xED, 0x93, 0x02, 0xCF, 0xA6, 0x80, 0x3B, 0xFC, 0x79, 0xF5, 0xC9, 0xE6, 0x72,
-    0xD7, 0x6F, 0x0D, 0xEE, 0x8D, 0xBF, 0xFC, 0x48, 0x36, 0x47, 0x30, 0xF7, 0x6A, 0x1F, 0xA4, 0x4F,
-    0x4E, 0xC1, 0xF6, 0x90, 0x06, 0xFB, 0xC3, 0xAB, 0x29, 0x19, 0x4A, 0x13, 0xA7, 0xD9, 0x46, 0x93,
-    0xAC, 0x35, 0x49, 0x7F, 0x41, 0x54, 0xF1, 0x72, 0xDB, 0x99, 0xED, 0xDA, 0xDE, 0xA8, 0xBF, 0xED,
-    0xA9, 0x43, 0x32, 0xCE, 0x96, 0x3E, 0x6B, 0xA1, 0x34, 0x50, 0xD0, 0x04, 0x51, 0x41, 0x45, 0xD9,
-    0x40, 0x70, 0x97, 0x60, 0x51, 0x08, 0x8A, 0x32, 0x70, 0xD5, 0xF8, 0x7B, 0x72, 0x41, 0xF8, 0x37,
-    0x15, 0xE6, 0x0B, 0xD3, 0x5C, 0xD7, 0xF3, 0x53, 0xBE, 0xF3, 0x70, 0x23, 0x7E, 0x1B, 0xE1, 0xBC,
-    0x04, 0x12, 0xC5, 0x54, 0xAE, 0x16, 0xAA, 0xA0, 0xE3, 0xCE, 0x03, 0x98, 0xA4, 0xA8, 0x3A, 0x0A,
-    0x2E, 0xBD, 0xF9, 0x01, 0x58, 0x17, 0xD5, 0x01, 0xC3, 0x8D, 0xF2, 0x14, 0x20, 0x74, 0x84, 0xA3,
-    0x9C, 0x92, 0x5A, 0xA5, 0x90, 0xB2, 0xC6, 0xB9, 0xD0, 0x49, 0x77, 0x60, 0x12, 0x98, 0xDA, 0xC5,
-    0x73, 0x0E, 0xD8, 0x1D, 0x00, 0xE5, 0xC5, 0x04, 0xEA, 0x7A, 0xB4, 0xBC, 0xD7, 0x95, 0x2A, 0x9E,
-    0x16, 0xCB, 0xAF, 0x95, 0xBD, 0xBE, 0x7D, 0x21, 0xB0, 0x4F, 0xBE, 0x14, 0xAB, 0xE5, 0x42, 0x25,
-    0xEF, 0x67, 0xB2, 0x15, 0x5E, 0x22, 0xAF, 0x22, 0x55, 0x13, 0x47, 0x37, 0xB4, 0xFB, 0x46, 0x8D,
-    0x30, 0x0D, 0xA5, 0xB5, 0x67, 0xB7, 0x5D, 0x72, 0xFC, 0xDD, 0x5B, 0x76, 0xDC, 0x4D, 0xDF, 0xDA,
-    0x7D, 0x7D, 0xD1, 0x76, 0xAB, 0xA0, 0xA4, 0x56, 0x60, 0xAF, 0x58, 0x78, 0x31, 0xD3, 0xCB, 0xFB,
-    0xAF, 0xAB, 0xF9, 0x6C, 0x36, 0x18, 0x60, 0xCA, 0xCB, 0x9D, 0xEA, 0x1D, 0xAA, 0x8F, 0x3C, 0xC0,
-    0x0C, 0x07, 0x58, 0xA0, 0x9F, 0xBD, 0x96, 0x3D, 0xCC, 0xAD, 0x29, 0x68, 0xDF, 0x58, 0xDD, 0x5B,
-    0x59, 0xD3, 0x05, 0xE1, 0x72, 0xB2, 0x25, 0x10, 0x1C, 0xC9, 0x23, 0x6F, 0xF2, 0x6A, 0xD1, 0x13,
-    0xE6, 0xF8, 0xD6, 0x6D, 0x78, 0x8E, 0xC2, 0xE9, 0x09, 0xD8, 0x02, 0x3A, 0xFC, 0xD6, 0x5F, 0xA0,
-    0x9F, 0xA2, 0x66, 0x0F, 0x39, 0xE0, 0x7B, 0xD2, 0xDB, 0xBE, 0x15, 0xDB, 0xCF, 0x3B, 0x0E, 0xE4,
-    0xEE, 0x85, 0x0C, 0x1E, 0x12, 0xF9, 0x54, 0xEE, 0x3B, 0x95, 0xBB, 0xAA, 0x42, 0x6B, 0xA6, 0x56,
-    0xB9, 0x9D, 0xEA, 0xFF, 0x1D, 0xF9, 0xDC, 0x5F, 0x58, 0x25, 0x37, 0x2F, 0xE4, 0x0E, 0xBD, 0xF5,
-    0xB8, 0x57, 0x1C, 0xEE, 0xEF, 0x35, 0x22, 0xAF, 0x29, 0xD9, 0xCA, 0xF0, 0x68, 0x22, 0x9A, 0x9D,
-    0x66, 0xAA, 0x2F, 0x58, 0x7B, 0x8F, 0x00, 0x88, 0x42, 0xD4, 0x71, 0x7A, 0x45, 0x87, 0x36, 0x2A,
-    0x35, 0x54, 0xD5, 0x3D, 0xE0, 0x65, 0x7C, 0x60, 0x09, 0x85, 0x3F, 0xB3, 0x0B, 0xC5, 0x81, 0x37,
-    0x8A, 0x55, 0x71, 0x48, 0x37, 0xA4, 0xF4, 0xAB, 0x18, 0x10, 0x54, 0x62, 0x8C, 0x47, 0x30, 0xD2,
-    0xFD, 0xF7, 0x0E, 0xB2, 0xAE, 0x30, 0xE9, 0xA8, 0x56, 0xE9, 0x97, 0x12, 0x6F, 0x66, 0x54, 0xE8,
-    0x9D, 0x1A, 0x15, 0xAB, 0x1B, 0x72, 0xEE, 0x86, 0x4A, 0x8D, 0xC8, 0xED, 0x14, 0xB1, 0x44, 0xF6,
-    0xBC, 0x67, 0x5B, 0x0E, 0x4F, 0x76, 0x9C, 0x6D, 0x1B, 0x77, 0xB1, 0x71, 0xDE, 0x70, 0x5D, 0xDF,
-    0x0F, 0x59, 0xFC, 0x72, 0xED, 0x3E, 0xFD, 0x7D, 0x85, 0xC3, 0x87, 0x18, 0x87, 0xBF, 0x1C, 0x17,
-    0x18, 0x97, 0x43, 0xD1, 0x1A, 0x44, 0xBF, 0x9B, 0xEB, 0x1C, 0x28, 0xE9, 0x5E, 0x2E, 0xD4, 0x98,
-    0x58, 0x7A, 0x20, 0x61, 0xE1, 0x1C, 0x6A, 0x25, 0x56, 0x1D, 0x17, 0x1D, 0x35, 0x64, 0x05, 0x79,
-    0xFF, 0x45, 0x08, 0xB3, 0x9F, 0xB7, 0x1C, 0xDF, 0x2E, 0x0D, 0x89, 0x5E, 0x04, 0x10, 0xDE, 0x97,
-    0xFF, 0xC6, 0x25, 0x15, 0x69, 0x01, 0x4B, 0x01, 0x0E, 0xF4, 0x06, 0x0F, 0xFD, 0x91, 0x4B, 0xF0,
-    0xDA, 0x24, 0x55, 0x91, 0x4F, 0xB7, 0x85, 0x23, 0x88, 0x93, 0xC5, 0x5C, 0x05, 0xF7, 0x6F, 0x0B,
-    0xFE, 0x31, 0x51, 0x4E, 0x52, 0xC5, 0xA0, 0xE7, 0x8B, 0xC6, 0xA5, 0x89, 0x7E, 0xDC, 0x40, 0x8F,
-    0x80, 0xE2, 0xB1, 0x2B, 0x13, 0xDC, 0x95, 0xD5, 0x92, 0x89, 0xE8, 0x99, 0xE4, 0x71, 0x13, 0x75,
-    0xCD, 0xBE, 0x70, 0xEB, 0xD7, 0xAC, 0xC8, 0xFE, 0x75, 0x6E, 0x4A, 0xEA, 0x10, 0xF2, 0xE6, 0x68,
-    0x0B, 0xBA, 0x5F, 0xFF, 0x68, 0x49, 0x6E, 0xB9, 0x40, 0xCC, 0x58, 0x30, 0x10, 0x61, 0xF1, 0x14,
-    0xB2, 0x11, 0x93, 0xB9, 0x3C, 0x67, 0x21, 0xE3, 0xA2, 0xA3, 0xE6, 0x2A, 0x81, 0x86, 0x2B, 0x50,
-    0x0D, 0x40, 0x3F, 0x13, 0x44, 0x44, 0x9C, 0x62, 0x2A, 0x33, 0x12, 0x0E, 0xD8, 0x5E, 0x6E, 0xF1,
-    0xF4, 0xA9, 0xC6, 0xE5, 0x2A, 0x2C, 0x24, 0x22, 0x9D, 0x8A, 0xCC, 0x56, 0x25, 0x93, 0xBD, 0x5A,
-    0xB8, 0xF9, 0x22, 0x91, 0x29, 0xE9, 0xE1, 0xCD, 0xE5, 0xB3, 0x2A, 0x91, 0x29, 0x27, 0xD4, 0xE0,
-    0xFD, 0x05, 0x54, 0x10, 0x70, 0x63, 0x6D, 0x9D, 0x26, 0x19, 0x6F, 0x2F, 0xF8, 0x9D, 0x9E, 0x83,
-    0xD7, 0x64, 0x92, 0x5C, 0x40, 0xC1, 0x19, 0x5E, 0xB8, 0xAC, 0xB4, 0x60, 0xB2, 0x57, 0x0A, 0x6F,
-    0x09, 0xD6, 0xC1, 0xF5, 0x01, 0xEC, 0x00, 0xBC, 0x06, 0xB0, 0x0F, 0xD0, 0x00, 0x2C, 0x04, 0xC8,
-    0x8E, 0x08, 0x20, 0xB4, 0x04, 0xE5, 0xED, 0xFB, 0xE3, 0xDB, 0xF7, 0x8B, 0xC1, 0xEC, 0xB1, 0xDF,
-    0x9B, 0x38, 0xD6, 0xC0, 0xBF, 0x17, 0xF0, 0x22, 0x31, 0x1F, 0x2F, 0xB1, 0xBA, 0x2A, 0xFF, 0xF0,
-    0xEA, 0x3C, 0xAC, 0x9C, 0x46, 0xD6, 0x0A, 0x26, 0xB5, 0x0B, 0xBB, 0x7E, 0x26, 0x64, 0x17, 0x22,
-    0x8B, 0xB4, 0x93, 0x5D, 0xB3, 0x72, 0xB3, 0xD0, 0x0A, 0x01, 0xBD, 0xAA, 0x75, 0xF6, 0x1D, 0x90,
-    0xC4, 0x18, 0xBB, 0xE9, 0x86, 0x7C, 0xE7, 0x42, 0x12, 0x8A, 0x20, 0x02, 0xED, 0xAA, 0xD8, 0x02,
-    0x6D, 0xD7, 0xAB, 0x65, 0x68, 0x8E, 0xD0, 0x1C, 0x88, 0x7E, 0x53, 0xE8, 0x51, 0xD2, 0x8D, 0x57,
-    0x43, 0xEC, 0x8B, 0xFE, 0xF2, 0xA3, 0x03, 0x9A, 0x13, 0x48, 0xCE, 0x65, 0x3D, 0x61, 0x43, 0x88,
-    0x60, 0x03, 0xE9, 0x38, 0x93, 0x53, 0x72, 0xD2, 0x33, 0x91, 0x81, 0xDC, 0x05, 0xFA, 0x11, 0xC2,
-    0x20, 0x9D, 0xC1, 0x66, 0x27, 0xEF, 0xDB, 0x5E, 0xD6, 0xB2, 0xF2, 0x0C, 0x26, 0x73, 0x55, 0x1E,
-    0xA8, 0x8C, 0xD8, 0x8C, 0xFE, 0x2D, 0x74, 0xC0, 0xC8, 0x5A, 0xD7, 0x71, 0xC4, 0xB9, 0x3B, 0x59,
-    0xCA, 0x3E, 0x17, 0xA5, 0x84, 0x8E, 0x0F, 0x48, 0xE2, 0x90, 0x20, 0x30, 0x26, 0x1C, 0x61, 0x75,
-    0x68, 0x32, 0x18, 0x73, 0xD2, 0x0C, 0xBB, 0x77, 0x4C, 0xE6, 0xBE, 0x1C, 0x09, 0x7D, 0x1A, 0xC9,
-    0x15, 0xF2, 0x08, 0xE4, 0x88, 0x32, 0x51, 0xF8, 0x92, 0x91, 0x79, 0x4D, 0x8E, 0x45, 0x32, 0x12,
-    0x0D, 0x71, 0xE4, 0x57, 0xC9, 0x48, 0x56, 0xD8, 0x48, 0xB4, 0xC2, 0x91, 0x7C, 0x39, 0xDA, 0x97,
-    0x13, 0x44, 0x4E, 0x4B, 0x44, 0x14, 0x4C, 0x44, 0xF3, 0xC3, 0xEA, 0x74, 0xDE, 0x70, 0xEF, 0xB8,
-    0xB5, 0xE8, 0x81, 0xAD, 0x8C, 0x27, 0x93, 0xE5, 0xFD, 0xB9, 0xF7, 0x06, 0x4A, 0xF4, 0xB8, 0xEE,
-    0x31, 0xD2, 0x65, 0x2A, 0xCB, 0x36, 0xA8, 0x60, 0xDF, 0x49, 0x28, 0xAC, 0xB6, 0x72, 0x73, 0x39,
-    0xF1, 0xA6, 0x9C, 0x28, 0xA2, 0x54, 0x82, 0x7D, 0x23, 0x7B, 0x3A, 0x71, 0x60, 0x73, 0x80, 0x67,
-    0x46, 0x36, 0x0E, 0xF7, 0x4D, 0x30, 0xE3, 0x12, 0x07, 0x09, 0xA2, 0x96, 0x48, 0xB0, 0x3B, 0xD9,
-    0xCB, 0x65, 0x85, 0x85, 0x27, 0x40, 0xB3, 0x09, 0x16, 0x03, 0x10, 0x72, 0x21, 0xBA, 0xB3, 0x00,
-    0x38, 0x17, 0xF2, 0xFF, 0x01, 0x20, 0xB7, 0x15, 0x90, 0xEA, 0xF6, 0x55, 0xD1, 0x3D, 0xCB, 0x65,
-    0xD0, 0xA6, 0x28, 0x13, 0xD8, 0x1F, 0x00, 0xDD, 0xAE, 0x1C, 0x89, 0x7E, 0xF0, 0x41, 0x29, 0x13,
-    0xF3, 0xFF, 0xB6, 0x1C, 0xED, 0x98, 0xF0, 0x9D, 0x72, 0x24, 0x23, 0xFB, 0x5A, 0x29, 0x53, 0x8E,
-    0xC3, 0x72, 0x14, 0xE6, 0x32, 0xFF, 0x51, 0x50, 0xEE, 0x0B, 0xF4, 0x66, 0x0B, 0xC0, 0xDF, 0xCC,
-    0x05, 0x3A, 0xBF, 0x95, 0xB5, 0x34, 0x12, 0xD5, 0x1F, 0xB0, 0x28, 0x01, 0x93, 0x1C, 0x30, 0x36,
-    0x80, 0x5C, 0xC4, 0xA7, 0x1F, 0xE3, 0xF1, 0x81, 0xEC, 0xB4, 0x25, 0x8F, 0xF3, 0xCE, 0xB3, 0x4E,
-    0x2F, 0x10, 0x89, 0x14, 0xDB, 0x44, 0x56, 0xE0, 0xE1, 0x4D, 0x6A, 0x2F, 0x05, 0x56, 0x1C, 0x10,
-    0x48, 0x6C, 0xAB, 0x1A, 0xBC, 0x2E, 0x63, 0x66, 0xEB, 0xD4, 0x28, 0x2A, 0x79, 0x32, 0x2F, 0xF3,
-    0x0F, 0x85, 0xF2, 0x38, 0xC7, 0x29, 0x4F, 0xD7, 0xF2, 0x98, 0x4C, 0xB0, 0xF9, 0xA6, 0x8F, 0x7A,
-    0x70, 0xA8, 0xD7, 0x03, 0xE9, 0xF6, 0x7A, 0x06, 0x9F, 0xDC, 0xE1, 0x2D, 0x79, 0xD4, 0x95, 0x50,
-    0xF4, 0x24, 0x57, 0x25, 0x9F, 0x03, 0x8E, 0x87, 0x51, 0x1F, 0x03, 0xFC, 0x82, 0xD4, 0x34, 0xC3,
-    0xA3, 0x92, 0xCB, 0x16, 0xA2, 0xBC, 0x8C, 0x0A, 0xE9, 0x6A, 0x04, 0x2F, 0x6A, 0xC2, 0xB1, 0xAE,
-    0x74, 0xD1, 0xB3, 0x80, 0xC5, 0xD8, 0x1D, 0x20, 0xCC, 0x6F, 0x5F, 0xA9, 0x40, 0x2B, 0xE2, 0x72,
-    0x45, 0x3F, 0x76, 0x8F, 0x1D, 0x1B, 0x74, 0x45, 0x16, 0x47, 0x70, 0x28, 0x7B, 0x46, 0x6D, 0x7E,
-    0x15, 0xF0, 0x23, 0xEB, 0xB1, 0x11, 0x4A, 0xD6, 0x7C, 0x73, 0xEF, 0xFD, 0xB7, 0xC8, 0x0E, 0x1E,
-    0xF1, 0x98, 0x5A, 0x17, 0x81, 0xCE, 0x53, 0x5D, 0x9B, 0xB2, 0x27, 0x5B, 0xB5, 0x91, 0xF9, 0x33,
-    0x67, 0x41, 0x6A, 0x25, 0xB2, 0x05, 0x18, 0xCF, 0x02, 0xE4, 0x01, 0x56, 0x38, 0xB3, 0x13, 0xC1,
-    0xAC, 0x41, 0x35, 0x95, 0x5A, 0x2A, 0xED, 0x1E, 0x4D, 0x6F, 0xC3, 0xF4, 0x06, 0x49, 0xC4, 0x1F,
-    0x84, 0x10, 0x50, 0x1E, 0x3A, 0xD5, 0xBE, 0x05, 0x5A, 0x53, 0x90, 0xDD, 0x6B, 0xE8, 0xC4, 0x25,
-    0x42, 0xDD, 0x0F, 0xE7, 0x43, 0xF6, 0x11, 0x50, 0x78, 0x81, 0xFF, 0x41, 0x28, 0xC4, 0xED, 0x5F,
-    0xB6, 0xA2, 0x51, 0x86, 0x79, 0x91, 0x0A, 0x2B, 0xCB, 0x63, 0xE1, 0xC8, 0x61, 0x0E, 0x1E, 0x17,
-    0x8A, 0x2E, 0x97, 0x09, 0xF4, 0xEB, 0x5D, 0xEE, 0x3E, 0x85, 0x19, 0x21, 0xBE, 0xF5, 0x67, 0x7A,
-    0xA6, 0xF0, 0xF8, 0x5C, 0xAE, 0x9C, 0x85, 0x79, 0x96, 0x7B, 0x6D, 0xF8, 0x9F, 0x97, 0xB4, 0x19,
-    0x2F, 0xC8, 0x75, 0xEF, 0xC0, 0xB3, 0xFE, 0x8B, 0x8B, 0x8E, 0x2D, 0xCC, 0x2D, 0xDB, 0x22, 0xFA,
-    0x82, 0x99, 0x6B, 0x31, 0xE7, 0x34, 0x54, 0xEC, 0xF1, 0x20, 0x93, 0xA2, 0xC7, 0x12, 0x2D, 0x15,
-    0x04, 0x11, 0xC8, 0x7B, 0x02, 0xE2, 0x0E, 0x5A, 0xE8, 0x2E, 0x84, 0x15, 0xCB, 0x65, 0x42, 0x32,
-    0x84, 0xF1, 0xE0, 0xE9, 0x1F, 0x40, 0x10, 0x4A, 0xD2, 0x11, 0x34, 0x13, 0xAE, 0xE7, 0x4F, 0x0E,
-    0xC6, 0xE3, 0xE5, 0x56, 0x02, 0x3B, 0x48, 0xD2, 0x9B, 0xC7, 0x4F, 0x01, 0xCE, 0x1B, 0x32, 0xCE,
-    0x85, 0x9A, 0x7D, 0x4E, 0x3F, 0x0A, 0xF0, 0xF8, 0xF7, 0xF7, 0x44, 0x6C, 0xE9, 0x1A, 0xA7, 0x78,
-    0xEF, 0x4C, 0x0B, 0x90, 0x10, 0xE2, 0x39, 0x49, 0x80, 0xFB, 0x84, 0x9B, 0x6C, 0x7C, 0xF3, 0x50,
-    0xC4, 0xB8, 0x8C, 0xBA, 0x50, 0xDF, 0x8C, 0xF8, 0x9D, 0x6C, 0x65, 0x9E, 0xF2, 0x24, 0x1B, 0xDC,
-    0x7D, 0xFB, 0x17, 0x09, 0x6F, 0xBB, 0xB4, 0xCD, 0xC0, 0xD2, 0xCE, 0x6C, 0x7E, 0x2F, 0xEB, 0xB8,
-    0x9A, 0x05, 0x7C, 0xB3, 0x48, 0x6D, 0x5C, 0xD1, 0x3A, 0xB8, 0x8B, 0x3D, 0x06, 0xAF, 0x56, 0x8C,
-    0x87, 0x15, 0xA7, 0x57, 0x17, 0x02, 0xB0, 0x36, 0x52, 0x43, 0xD0, 0xF6, 0xEF, 0x5C, 0x01, 0x77,
-    0xB7, 0xE7, 0x38, 0xAF, 0x12, 0xD0, 0xF2, 0x0E, 0xEA, 0x85, 0x3D, 0x07, 0x8E, 0x53, 0x40, 0x19,
-    0x29, 0x60, 0x57, 0xE1, 0xF3, 0xA8, 0x06, 0xF4, 0x60, 0xD6, 0x95, 0x05, 0x09, 0xE8, 0x10, 0xBA,
-    0xFC, 0xC4, 0xC7, 0xB7, 0xE3, 0x62, 0xC6, 0xF3, 0x73, 0xC0, 0x85, 0x5C, 0x3B, 0x5A, 0xA3, 0x59,
-    0x1B, 0xC7, 0x18, 0xA4, 0x7C, 0xA9, 0x42, 0xA4, 0xF4, 0x6C, 0xB9, 0xAA, 0x15, 0x22, 0x5D, 0xE5,
-    0xD0, 0xE3, 0xBD, 0x19, 0xFA, 0x4A, 0xD4, 0x14, 0x2A, 0x63, 0xAF, 0x0C, 0x24, 0x8E, 0xAF, 0xBC,
-    0xD2, 0x59, 0xE5, 0x25, 0x1C, 0x24, 0x93, 0x4B, 0xE3, 0x5B, 0xB5, 0xC8, 0x44, 0x3C, 0x94, 0xC4,
-    0x80, 0xC2, 0xE0, 0x3B, 0x8A, 0x50, 0xF9, 0x0F, 0x44, 0x0F, 0x85, 0x20, 0x9C, 0x81, 0x4C, 0xDE,
-    0x58, 0xC9, 0x14, 0x4E, 0x07, 0x53, 0x91, 0x5C, 0x05, 0x1E, 0xFF, 0x6E, 0x56, 0x82, 0xDB, 0x83,
-    0xC7, 0x43, 0x18, 0x83, 0x44, 0x20, 0xA3, 0x81, 0xFA, 0xD4, 0x24, 0x37, 0x09, 0x69, 0x23, 0xB4,
-    0xD0, 0xE3, 0x27, 0xFA, 0xAD, 0x9E, 0x89, 0xAB, 0xE6, 0xE8, 0xC1, 0x97, 0xF9, 0x24, 0xD5, 0x76,
-    0xC9, 0x9E, 0x81, 0x21, 0x35, 0x62, 0x5D, 0x62, 0x48, 0x4E, 0xEB, 0x0B, 0xFB, 0x0A, 0x8F, 0x26,
-    0xAD, 0xD0, 0xF9, 0x0D, 0x96, 0x24, 0xBB, 0x7A, 0x1A, 0x1E, 0x8E, 0xA7, 0xF8, 0x5E, 0x06, 0xDB,
-    0xCA, 0x0E, 0x87, 0x19, 0x6A, 0x2A, 0x14, 0x63, 0x2A, 0x6A, 0xDE, 0x14, 0x8E, 0x3B, 0x99, 0xF5,
-    0x34, 0xC3, 0x6E, 0xFD, 0x86, 0x35, 0xEC, 0x61, 0x7A, 0x98, 0xAA, 0x03, 0xD2, 0xFA, 0x9D, 0x95,
-    0xE2, 0xF6, 0x18, 0x65, 0x55, 0xB5, 0x0D, 0x40, 0x7E, 0x06, 0xF1, 0xA7, 0x8E, 0xF1, 0x44, 0xEE,
-    0x43, 0x73, 0xDE, 0x4A, 0x4F, 0xFD, 0xD6, 0xD1, 0x84, 0x44, 0x97, 0x34, 0x7D, 0xFD, 0x0B, 0xAF,
-    0xFE, 0xA2, 0x28, 0xF6, 0xBF, 0x11, 0x04, 0x79, 0x1F, 0x43, 0x29, 0xEF, 0xD2, 0xB8, 0xF4, 0x60,
-    0x3C, 0xF5, 0x2C, 0x69, 0x7D, 0x64, 0x60, 0xCC, 0xA9, 0x00, 0x1A, 0xF3, 0xF3, 0x70, 0xAD, 0x33,
-    0x3E, 0x2A, 0xC4, 0x6A, 0x7C, 0x0B, 0x01, 0x7F, 0x1A, 0x49, 0x12, 0x1B, 0xF3, 0x55, 0x8B, 0x8C,
-    0x47, 0x54, 0x67, 0xEC, 0xE2, 0xDE, 0x90, 0x01, 0xF2, 0x15, 0xBE, 0xB2, 0xF1, 0x98, 0x01, 0x44,
-    0x38, 0x2E, 0x22, 0x03, 0xA8, 0x55, 0xBD, 0x05, 0xAB, 0xCA, 0x93, 0xBB, 0xDB, 0x94, 0x75, 0xF6,
-    0xAD, 0x7D, 0x1C, 0xBB, 0x26, 0x3A, 0x84, 0x1D, 0x54, 0x4E, 0xDD, 0xA6, 0x8B, 0xB1, 0x0F, 0x04,
-    0xB3, 0xCC, 0x3F, 0x2C, 0xFF, 0x4A, 0x04, 0x4F, 0xA0, 0x9C, 0x0A, 0xB4, 0xEC, 0xD3, 0x2F, 0x51,
-    0x71, 0x18, 0x0D, 0x7B, 0x26, 0x79, 0xE0, 0xBF, 0x2F, 0x7D, 0x69, 0x34, 0x4A, 0x92, 0xEB, 0xD7,
-    0xAD, 0x39, 0x79, 0xF6, 0xE0, 0x7F, 0x72, 0x13, 0x30, 0xB4, 0x6C, 0xA0, 0x7F, 0x3D, 0x2D, 0x4C,
-    0x3E, 0xC1, 0x6B, 0x84, 0x39, 0xFF, 0xB0, 0x31, 0x08, 0x1B, 0xA8, 0x6C, 0x10, 0xD6, 0xD0, 0xEC,
-    0x4E, 0x48, 0x56, 0xF7, 0x95, 0x9C, 0x9E, 0x68, 0x40, 0x5E, 0x1B, 0x25, 0xB0, 0x6C, 0x66, 0xA4,
-    0xA5, 0x42, 0x64, 0x2D, 0x99, 0x5D, 0x28, 0x79, 0x9D, 0xB3, 0x71, 0xB4, 0xA1, 0x71, 0xDB, 0x5D,
-    0x88, 0x38, 0x2F, 0x04, 0xB7, 0x26, 0xB5, 0xED, 0x2A, 0x52, 0xE8, 0xC3, 0xB5, 0x19, 0xED, 0xE8,
-    0xE3, 0x9B, 0x5E, 0xB0, 0x01, 0xBF, 0x78, 0x4F, 0x1B, 0x21, 0x25, 0x93, 0xC9, 0x72, 0x52, 0x54,
-    0xFC, 0x2E, 0xA8, 0xD9, 0x78, 0xA7, 0x35, 0xFC, 0xEE, 0x60, 0xCC, 0x33, 0x0B, 0x92, 0x20, 0x69,
-    0xE6, 0xA7, 0xEC, 0x30, 0x06, 0x45, 0xE4, 0x38, 0x27, 0x3F, 0x65, 0x87, 0x2D, 0x57, 0x3B, 0xAC,
-    0x7A, 0x5C, 0x3B, 0x0C, 0x51, 0x4A, 0x20, 0x5C, 0xAD, 0xD2, 0x2C, 0x04, 0x50, 0xAD, 0xC5, 0x4F,
-    0x3D, 0x36, 0xED, 0xEC, 0x47, 0xD6, 0x71, 0x04, 0xD1, 0x50, 0x14, 0x4A, 0x15, 0x5E, 0x7E, 0xFC,
-    0xD8, 0xB5, 0x49, 0x68, 0xAC, 0xC6, 0xCC, 0x65, 0x01, 0x53, 0x4E, 0x93, 0xB1, 0xC9, 0x5C, 0x2E,
-    0xFF, 0xEF, 0x75, 0x0A, 0xF9, 0xF4, 0x45, 0x69, 0x2C, 0xBA, 0x47, 0xD6, 0x95, 0xC6, 0xE3, 0xB6,
-    0xD7, 0xB9, 0x06, 0x0B, 0x40, 0x7F, 0xC8, 0xDC, 0xD5, 0x5D, 0xED, 0x23, 0x56, 0x43, 0xE8, 0x11,
-    0x18, 0x1F, 0x5B, 0xC6, 0x6E, 0xB0, 0x85, 0x31, 0x49, 0x1E, 0x8C, 0x1A, 0x77, 0x83, 0x2A, 0xEA,
-    0x5B, 0x1B, 0x8E, 0x07, 0xAB, 0x30, 0xBD, 0x2B, 0x82, 0xD0, 0x5A, 0x8D, 0x68, 0x49, 0xAD, 0xE1,
-    0x1C, 0x05, 0x76, 0x15, 0xAC, 0x17, 0x60, 0xD1, 0xEE, 0x1C, 0x9E, 0x5A, 0x3C, 0x5A, 0xB7, 0x6E,
-    0xA1, 0x0A, 0x35, 0x10, 0xDE, 0x61, 0x44, 0x95, 0xA7, 0x04, 0x81, 0x32, 0x0B, 0xCA, 0xF8, 0x65,
-    0x78, 0xB9, 0xA5, 0xAF, 0x9F, 0x0A, 0x5E, 0xA2, 0xEF, 0xA7, 0xC1, 0xCF, 0xE1, 0xF6, 0xF9, 0xC0,
-    0xF8, 0x1F, 0x43, 0x46, 0x90, 0xC5, 0x4C, 0x3F, 0x37, 0x54, 0xCA, 0x54, 0xA3, 0x2D, 0x8A, 0xD5,
-    0x53, 0x42, 0xF4, 0xB4, 0x2C, 0x94, 0x5D, 0x34, 0x41, 0x45, 0xE9, 0x10, 0x2B, 0x90, 0x96, 0xA2,
-    0x44, 0x83, 0x9F, 0x62, 0x6D, 0x22, 0xEC, 0xFB, 0x28, 0x17, 0x05, 0x1E, 0x14, 0x21, 0x2C, 0x3D,
-    0x44, 0x70, 0x06, 0x95, 0xF4, 0x3F, 0x92, 0xF9, 0x86, 0x1D, 0x77, 0x61, 0x74, 0x3B, 0x6D, 0x64,
-    0x7D, 0xC7, 0xE1, 0x4F, 0x10, 0x2C, 0x70, 0x3D, 0xF8, 0x99, 0x8C, 0x64, 0xBA, 0xEF, 0xFD, 0x5A,
-    0x90, 0x96, 0xCC, 0x5D, 0x8C, 0x23, 0xAA, 0x0D, 0x86, 0x21, 0xF3, 0x3E, 0xD0, 0x18, 0xD2, 0x5E,
-    0xB2, 0x53, 0x38, 0xCE, 0xEE, 0xDE, 0xE0, 0xDE, 0x6D, 0x7A, 0x68, 0xED, 0x36, 0x71, 0x7A, 0x02,
-    0xBE, 0xFF, 0x23, 0x32, 0x10, 0x98, 0xDD, 0x63, 0x9E, 0x2A, 0x54, 0xA8, 0xD3, 0x30, 0x82, 0x14,
-    0x50, 0x2E, 0x8C, 0x19, 0x9A, 0x32, 0x40, 0xFD, 0x44, 0xBF, 0xC5, 0x99, 0x88, 0x75, 0xC2, 0xB5,
-    0xD4, 0xB4, 0xA1, 0x46, 0xDD, 0x38, 0xE9, 0xB8, 0x2C, 0x06, 0x42, 0xF1, 0xCD, 0xE5, 0x24, 0x3D,
-    0xDD, 0xB7, 0xB9, 0x9C, 0xDC, 0x20, 0xCF, 0xAE, 0xFA, 0x58, 0x2B, 0xB7, 0xE9, 0xC3, 0x2C, 0x04,
-    0x2D, 0x16, 0x08, 0xDE, 0xDA, 0xF1, 0xED, 0x45, 0x1F, 0xC5, 0xB5, 0x5C, 0x8F, 0x08, 0x11, 0x81,
-    0xB7, 0xA1, 0x92, 0x05, 0x15, 0xA3, 0x38, 0xDA, 0xAB, 0x19, 0xE0, 0x65, 0x5E, 0x85, 0x25, 0x9E,
-    0x37, 0x61, 0x7C, 0xA3, 0x06, 0xA1, 0x69, 0xB0, 0x06, 0x23, 0x30, 0x52, 0x6D, 0xE8, 0xFF, 0x84,
-    0x0B, 0xE4, 0x2D, 0x63, 0x1D, 0x1F, 0xB6, 0x69, 0xD4, 0x89, 0x6C, 0x4F, 0x59, 0x35, 0x7A, 0x5D,
-    0xAC, 0x9D, 0x31, 0xCA, 0xB5, 0x81, 0x33, 0x1E, 0x8D, 0xD7, 0xEA, 0xA4, 0xBA, 0xFB, 0xAF, 0xC0,
-    0x27, 0x90, 0xA8, 0xE7, 0xFD, 0xB2, 0xF5, 0xB4, 0x5D, 0xDA, 0x5A, 0x11, 0x92, 0xED, 0x0E, 0x6A,
-    0x04, 0x05, 0xD9, 0xE0, 0xF0, 0x56, 0x99, 0x58, 0x5F, 0x6D, 0xB2, 0x8A, 0x90, 0x53, 0xD5, 0x7D,
-    0xBC, 0x14, 0x46, 0x4E, 0x42, 0xDE, 0x43, 0x4B, 0xE8, 0xC9, 0x98, 0x39, 0xC2, 0xFE, 0x7C, 0x35,
-    0x01, 0x84, 0x87, 0x97, 0xA5, 0x4F, 0x8F, 0x3D, 0x0B, 0xDB, 0xCA, 0x7B, 0x97, 0xA7, 0x9A, 0x95,
-    0x63, 0x75, 0xF1, 0xD2, 0x15, 0x9A, 0x11, 0x36, 0x1A, 0x19, 0xD8, 0xD0, 0xE6, 0x3F, 0x25, 0x7D,
-    0x48, 0xE8, 0xFD, 0x8B, 0x29, 0x28, 0x82, 0x9E, 0x44, 0xEF, 0xEF, 0x91, 0x4A, 0x61, 0xAD, 0x24,
-    0x94, 0x95, 0xA7, 0xE1, 0x9F, 0x41, 0x84, 0x0D, 0xBF, 0x8B, 0x90, 0x9B, 0x30, 0x87, 0xE0, 0x1B,
-    0x0A, 0xB9, 0xF2, 0x6B, 0x28, 0x47, 0x41, 0x25, 0xCA, 0xB3, 0xAC, 0x71, 0x28, 0xC3, 0x71, 0xDE,
-    0xAB, 0xD0, 0xFE, 0x4C, 0xD5, 0x66, 0x21, 0x61, 0x70, 0xB5, 0xD2, 0xA9, 0xEC, 0x41, 0x26, 0xF7,
-    0x3F, 0x40, 0xF2, 0xC3, 0x3B, 0x90, 0x4B, 0xFE, 0x0B, 0x0C, 0x89, 0x20, 0x8B, 0x09, 0x88, 0xD4,
-    0xAE, 0xCB, 0x38, 0x1A, 0x5A, 0xE7, 0x5B, 0x19, 0x5C, 0x83, 0x7D, 0xD6, 0xA0, 0xFF, 0x06, 0x11,
-    0x56, 0x0D, 0x06, 0xD7, 0x60, 0xBF, 0x35, 0x18, 0x72, 0x83, 0xD1, 0x37, 0xCE, 0x62, 0x5F, 0x29,
-    0x9C, 0xCC, 0xC7, 0x5F, 0x68, 0x3C, 0x72, 0xC3, 0x26, 0x6A, 0xD5, 0xC0, 0x6F, 0x83, 0x5B, 0xC8,
-    0x88, 0x49, 0x2E, 0x1B, 0x25, 0x9D, 0x98, 0x49, 0x00, 0x86, 0x4D, 0x92, 0xDA, 0x4D, 0xEE, 0x1D,
-    0xDD, 0x9B, 0x9F, 0x58, 0x10, 0xD1, 0xF7, 0x6A, 0x04, 0x08, 0x26, 0x7F, 0x84, 0x1B, 0xD2, 0x82,
-    0x2A, 0x2B, 0x6F, 0x2A, 0x3B, 0xB7, 0x6C, 0xD4, 0x90, 0xDA, 0xC0, 0x90, 0x1A, 0xCC, 0x1A, 0x10,
-    0x67, 0x19, 0xAC, 0xDA, 0x53, 0x45, 0x69, 0xF7, 0x6A, 0x07, 0x11, 0x47, 0x20, 0x4C, 0x0D, 0xCD,
-    0xAA, 0xC5, 0x88, 0x54, 0x77, 0x04, 0x23, 0x1D, 0x18, 0xD8, 0xC7, 0x80, 0xDE, 0x87, 0x33, 0xC0,
-    0xBF, 0xAF, 0x61, 0x93, 0x16, 0x22, 0x30, 0x42, 0x04, 0x93, 0xAC, 0x81, 0xED, 0xBB, 0xD3, 0x8D,
-    0x35, 0x30, 0x12, 0x45, 0x38, 0xCA, 0x85, 0xE5, 0xC0, 0x6E, 0xE7, 0xCE, 0x85, 0xE7, 0x8C, 0xBC,
-    0x1A, 0x2F, 0x79, 0x23, 0xFF, 0x85, 0x71, 0x6E, 0xC1, 0x13, 0x9A, 0x11, 0x22, 0xC2, 0x77, 0xE1,
-    0x81, 0xED, 0x66, 0xEB, 0x10, 0x0E, 0x85, 0x88, 0x16, 0x1B, 0x5A, 0x04, 0x6C, 0x58, 0x1F, 0x58,
-    0x6B, 0x0D, 0x5E, 0x42, 0x99, 0x5C, 0x84, 0x01, 0x2C, 0x41, 0xA7, 0xC0, 0xDE, 0x8E, 0x68, 0xC8,
-    0x28, 0xBA, 0x8F, 0x65, 0x63, 0xB5, 0xA0, 0xD0, 0xEE, 0xC2, 0x9F, 0xC1, 0x89, 0x2F, 0xD4, 0xAB,
-    0xF2, 0x05, 0xFA, 0x33, 0x21, 0x67, 0x33, 0x58, 0x9F, 0x05, 0xCE, 0x23, 0x81, 0xEE, 0x22, 0xCE,
-    0x11, 0x69, 0x95, 0xA4, 0x84, 0x20, 0xFE, 0xD3, 0x5D, 0xC0, 0xDD, 0x80, 0xE8, 0x54, 0xA8, 0xB1,
-    0xA2, 0xD8, 0x42, 0x55, 0x1F, 0xAC, 0xA0, 0x71, 0xA6, 0xFE, 0xDF, 0x69, 0x80, 0xC2, 0x5C, 0x05,
-    0x1A, 0xF9, 0xBC, 0x2B, 0x44, 0x22, 0xF3, 0xE6, 0x31, 0x88, 0xEE, 0x2C, 0x16, 0xBA, 0x2A, 0x8B,
-    0x94, 0x11, 0x58, 0xB1, 0x4C, 0x24, 0x4A, 0x63, 0x8A, 0x99, 0x31, 0x83, 0xE0, 0x63, 0xF9, 0xFF,
-    0x94, 0x76, 0xCA, 0x7D, 0x06, 0x6C, 0x80, 0x98, 0x1C, 0x6F, 0x65, 0xDA, 0x0C, 0xE3, 0x62, 0xC0,
-    0x39, 0x95, 0x37, 0x0D, 0xC8, 0xA2, 0x84, 0xD0, 0xC7, 0x82, 0x72, 0xCD, 0x7C, 0x6F, 0xAE, 0x2B,
-    0xE9, 0x97, 0x15, 0xE3, 0x12, 0xF7, 0xBA, 0x5F, 0xF4, 0x91, 0xED, 0xA9, 0x6D, 0x2B, 0x2C, 0x8E,
-    0x6A, 0xCA, 0x88, 0xB0, 0x24, 0x9D, 0x3A, 0xEA, 0xDC, 0x9A, 0x1A, 0x75, 0x6E, 0x4D, 0x87, 0x77,
-    0xBB, 0xB6, 0xC5, 0x7A, 0x15, 0x0D, 0x0D, 0x51, 0x65, 0x72, 0xDB, 0x29, 0x22, 0x61, 0xD9, 0xCA,
-    0xB2, 0x06, 0x9A, 0xD0, 0x0A, 0x65, 0x99, 0x1A, 0x3C, 0x50, 0x7D, 0xE4, 0xB6, 0x81, 0xBB, 0xB6,
-    0xE5, 0x44, 0x65, 0x77, 0x8C, 0xC0, 0xFB, 0x2A, 0x2C, 0x19, 0x98, 0xF2, 0x21, 0x06, 0xC1, 0x23,
-    0x3D, 0x1E, 0x17, 0x8D, 0x95, 0x01, 0x21, 0xF7, 0x74, 0x1F, 0x7C, 0x80, 0x33, 0xA7, 0x81, 0xAC,
-    0xD1, 0x11, 0x54, 0xB1, 0x5D, 0xE9, 0x6C, 0x0E, 0x06, 0x25, 0x2B, 0x46, 0xF8, 0x5F, 0x3A, 0x92,
-    0x47, 0x07, 0xE3, 0xAE, 0xF4, 0xC5, 0x26, 0x0F, 0xE4, 0xE1, 0x8D, 0xE2, 0x14, 0xDE, 0x0E, 0x27,
-    0x15, 0xDD, 0xC0, 0x9B, 0x71, 0x2B, 0x45, 0xA2, 0x70, 0x65, 0x0C, 0xDB, 0x5D, 0xD8, 0x55, 0x11,
-    0x81, 0x18, 0x64, 0xF7, 0x6F, 0x35, 0xE6, 0xFA, 0x46, 0xA8, 0xE1, 0x26, 0xC0, 0x17, 0xD2, 0x81,
-    0x3B, 0xC1, 0xD3, 0x83, 0x07, 0x42, 0xA3, 0xC6, 0x4C, 0xD0, 0xAC, 0x62, 0x6F, 0x52, 0x46, 0x03,
-    0xF7, 0x80, 0x8B, 0x8F, 0x9F, 0x09, 0x81, 0x70, 0x6E, 0xB5, 0xA0, 0xA0, 0x73, 0xA8, 0xFE, 0xA9,
-    0x29, 0x5E, 0xDF, 0x88, 0xE6, 0x59, 0xA6, 0x97, 0x68, 0xBF, 0xEC, 0x6C, 0x74, 0xDC, 0x78, 0x7C,
-    0x6B, 0xC5, 0x9E, 0x65, 0x1E, 0xB5, 0x5B, 0xC7, 0xB2, 0xE7, 0x0E, 0xC0, 0x41, 0xA5, 0x17, 0xEA,
-    0x37, 0x65, 0xF8, 0xFA, 0xF6, 0x4C, 0xA9, 0x84, 0x6B, 0x0F, 0xC1, 0xF9, 0x37, 0x0B, 0x61, 0x54,
-    0x2D, 0x96, 0xB8, 0xDC, 0x3C, 0xA8, 0x37, 0xFC, 0x6D, 0xF4, 0xBF, 0xDD, 0xAE, 0x41, 0xC7, 0x85,
-    0xD3, 0x99, 0xEC, 0x75, 0xD5, 0x8D, 0x70, 0x88, 0x9E, 0x7A, 0x47, 0x78, 0xE0, 0xA2, 0x8F, 0x39,
-    0x11, 0xC6, 0xC0, 0x98, 0xE9, 0xE4, 0x21, 0x60, 0xA8, 0xB0, 0x6C, 0x09, 0x0F, 0x08, 0x13, 0xC6,
-    0xBA, 0x24, 0x39, 0x48, 0x7C, 0x38, 0x4F, 0xDC, 0x25, 0xA3, 0x7C, 0x17, 0x9A, 0x9B, 0x05, 0xCF,
-    0xE4, 0x7B, 0x6B, 0x61, 0xDC, 0xE7, 0xC2, 0xE7, 0xCC, 0x45, 0xCF, 0x4C, 0x8C, 0x1A, 0x06, 0x85,
-    0x62, 0x90, 0xA9, 0xAC, 0x60, 0x9C, 0x02, 0x46, 0x0A, 0xF3, 0x15, 0x0C, 0x4F, 0x40, 0x50, 0x9D,
-    0x84, 0x62, 0x6B, 0x62, 0x65, 0xEC, 0x0C, 0x52, 0xB6, 0x90, 0xFB, 0xE0, 0x30, 0x11, 0xFE, 0xED,
-    0x6A, 0xD8, 0xC9, 0xB6, 0x72, 0xF0, 0xEC, 0xA1, 0xC6, 0x36, 0x64, 0x48, 0x1D, 0xAA, 0x46, 0x56,
-    0x49, 0x6F, 0xF7, 0x8B, 0x05, 0x17, 0x57, 0x4B, 0x26, 0x5F, 0x90, 0x09, 0xF6, 0xC1, 0x4E, 0x19,
-    0x63, 0xE9, 0xE8, 0x00, 0x9B, 0xB5, 0x74, 0x7B, 0x0B, 0x33, 0x1D, 0xDF, 0x62, 0x44, 0x5C, 0x67,
-    0xA1, 0x7E, 0xAE, 0x50, 0xCF, 0xD4, 0xAB, 0xB4, 0x07, 0x68, 0xBE, 0x71, 0x0E, 0xC7, 0x79, 0x06,
-    0x0B, 0xAB, 0xB3, 0x64, 0xBC, 0x9D, 0x3E, 0x85, 0x99, 0x0D, 0xD3, 0xED, 0x6D, 0xCE, 0xAA, 0x90,
-    0xE7, 0xEA, 0xF5, 0xF4, 0xDA, 0x57, 0x38, 0xA2, 0x4C, 0x83, 0x90, 0xE9, 0x26, 0x56, 0x6F, 0xC5,
-    0x78, 0x7C, 0xBB, 0xC2, 0xDE, 0xB4, 0x60, 0xF0, 0xA2, 0xC6, 0x36, 0x68, 0x99, 0x11, 0xCB, 0x99,
-    0xF1, 0x0E, 0xDD, 0x13, 0x6E, 0x0C, 0xAC, 0xB7, 0x88, 0xA3, 0xCC, 0xC8, 0xA3, 0xBB, 0x57, 0x65,
-    0x8F, 0x30, 0xBE, 0xD8, 0xD0, 0x97, 0xAC, 0x62, 0x28, 0x16, 0xB3, 0x3F, 0x5B, 0x25, 0xA1, 0xB8,
-    0x0C, 0x3C, 0x56, 0x23, 0x9F, 0x95, 0x62, 0x0E, 0xAC, 0x5B, 0x60, 0x6A, 0xDD, 0xE5, 0xD2, 0xED,
-    0x77, 0xB1, 0x7A, 0xC3, 0x9F, 0x82, 0xD8, 0x86, 0x3F, 0xA7, 0x86, 0xF0, 0x2B, 0xA6, 0x02, 0xFC,
-    0xB6, 0xA2, 0x61, 0xA0, 0xA4, 0x4B, 0x5A, 0x13, 0x05, 0x56, 0x91, 0x61, 0x7D, 0xC6, 0x10, 0xC6,
-    0x14, 0x63, 0x48, 0xC9, 0x56, 0x82, 0xC0, 0x0B, 0x72, 0xD5, 0xB0, 0x74, 0x20, 0x0E, 0xBB, 0x20,
-    0xD6, 0x54, 0xE3, 0x64, 0x50, 0xA0, 0x3B, 0x56, 0x53, 0x69, 0x60, 0xE3, 0xDE, 0x61, 0x46, 0x00,
-    0xED, 0x12, 0x34, 0x30, 0x4E, 0xD7, 0x6D, 0xDA, 0xEE, 0x1B, 0xF0, 0xA0, 0x82, 0x8B, 0x18, 0x7B,
-    0x8D, 0xC8, 0x05, 0xD4, 0x5B, 0x52, 0x46, 0x28, 0x94, 0xFF, 0x7A, 0x33, 0x03, 0xE4, 0x59, 0x43,
-    0xCF, 0xF3, 0x2F, 0xBF, 0x21, 0x57, 0xFE, 0x04, 0x91, 0xCA, 0xD5, 0x14, 0x74, 0x06, 0x7D, 0xBF,
-    0x8D, 0x69, 0xFF, 0x81, 0x5B, 0x6E, 0x8E, 0xFB, 0x09, 0x61, 0x70, 0xED, 0x2F, 0xE8, 0x23, 0x44,
-    0xD4, 0x30, 0x46, 0x13, 0x4B, 0xF7, 0x43, 0x1D, 0x32, 0xA4, 0xD7, 0x50, 0xA3, 0xE3, 0x64, 0xA9,
-    0x7B, 0x8B, 0x21, 0x37, 0xA4, 0x19, 0xB6, 0x5E, 0x2B, 0xF7, 0x72, 0xE7, 0x74, 0x1B, 0x13, 0x73,
-    0x94, 0x3E, 0x89, 0x49, 0xBA, 0x1C, 0x88, 0x4A, 0x06, 0x5F, 0xD0, 0x7C, 0xCD, 0x77, 0x2F, 0x0B,
-    0xE6, 0xD3, 0x46, 0x03, 0x35, 0x2C, 0x1A, 0x41, 0x4C, 0x46, 0xA4, 0xDE, 0x09, 0xD1, 0x3B, 0xB5,
-    0x89, 0x24, 0x0D, 0x11, 0x0E, 0x87, 0xCA, 0xC2, 0x3E, 0x00, 0x68, 0x63, 0x09, 0x1F, 0x88, 0xFF,
-    0x73, 0xB2, 0x65, 0x18, 0x11, 0x7E, 0x55, 0x21, 0xF3, 0x50, 0x68, 0xB3, 0x2B, 0xD2, 0x92, 0xB7,
-    0x1C, 0xC3, 0x3E, 0xA3, 0x1B, 0x8E, 0xD2, 0x01, 0xA5, 0x94, 0x79, 0x4F, 0x55, 0x18, 0xF7, 0xB0,
-    0x3B, 0xCC, 0xBF, 0x39, 0xF9, 0xCE, 0x9D, 0xF7, 0xEF, 0xFC, 0xDA, 0xBE, 0xF9, 0xEC, 0x76, 0x9F,
-    0x80, 0x1B, 0x76, 0xBD, 0x7D, 0x21, 0xDC, 0x44, 0xA4, 0xEC, 0x46, 0xFA, 0xD9, 0xB1, 0x37, 0x29,
-    0x68, 0x7A, 0xED, 0xCD, 0x56, 0xF8, 0x83, 0xBB, 0xE0, 0x76, 0x87, 0x18, 0x11, 0x21, 0x2C, 0x09,
-    0x0A, 0x1D, 0xF7, 0xF4, 0x2E, 0x75, 0x42, 0xEE, 0x7F, 0x1B, 0x3A, 0x01, 0x17, 0x7E, 0x82, 0x55,
-    0x81, 0x5D, 0xCF, 0x37, 0x01, 0xE9, 0xBD, 0x7C, 0x05, 0x29, 0x99, 0x27, 0x23, 0x5E, 0x88, 0x97,
-    0x8B, 0xDC, 0x6B, 0xD8, 0xA1, 0x39, 0x9C, 0x2B, 0x45, 0x31, 0x07, 0xB2, 0x16, 0xE0, 0xE5, 0x34,
-    0xD9, 0xCC, 0x92, 0x08, 0xB8, 0x7C, 0x49, 0x26, 0xA8, 0xE2, 0x6C, 0xF5, 0x7C, 0x74, 0x83, 0x70,
-    0x26, 0x6B, 0xB6, 0x05, 0x8D, 0x84, 0xB4, 0x98, 0x70, 0x6F, 0xD7, 0xFD, 0x82, 0xB0, 0xB3, 0xF7,
-    0x54, 0xBD, 0xBA, 0xAC, 0x7E, 0xB2, 0xBA, 0x0F, 0xB8, 0x55, 0x65, 0xCF, 0xA1, 0xF8, 0xE4, 0xB5,
-    0x61, 0x55, 0xA4, 0x58, 0x35, 0x22, 0xE4, 0xC3, 0x0A, 0x88, 0x28, 0x47, 0xD9, 0x67, 0x19, 0xB7,
-    0xEC, 0x01, 0xBB, 0x57, 0x36, 0xAD, 0xF1, 0xB7, 0xCD, 0x09, 0xA8, 0xDF, 0x32, 0xFE, 0xB6, 0xD1,
-    0xAB, 0xB4, 0x07, 0xED, 0x0D, 0xD4, 0x3C, 0xAA, 0x7C, 0x91, 0xEF, 0x8B, 0x5C, 0xEE, 0xF8, 0xB1,
-    0x86, 0x35, 0xCD, 0xA9, 0x4C, 0xD1, 0x95, 0x51, 0xAF, 0x62, 0x14, 0xBF, 0x6C, 0x54, 0x52, 0x30,
-    0x57, 0x41, 0x94, 0x0B, 0x58, 0xA0, 0x96, 0x5D, 0x51, 0x06, 0xB3, 0x6F, 0x84, 0x33, 0x06, 0x79,
-    0x0A, 0x22, 0x61, 0x21, 0xD2, 0x98, 0x92, 0xD3, 0x01, 0x4F, 0xC1, 0xC9, 0xF3, 0x60, 0x76, 0x25,
-    0xA8, 0xBD, 0xB6, 0xCB, 0x4A, 0x63, 0xC3, 0xEE, 0xE7, 0xB6, 0x7B, 0xDA, 0xCF, 0x87, 0xB8, 0xD7,
-    0xC0, 0x66, 0x26, 0x44, 0xDD, 0x92, 0x6F, 0xAE, 0x39, 0x1A, 0x3F, 0xFB, 0xE5, 0x17, 0x2E, 0xE5,
-    0x6B, 0xD9, 0x55, 0xBD, 0x4B, 0x4F, 0x56, 0x99, 0x5D, 0x51, 0xD7, 0x2C, 0xFE, 0xFF, 0x64, 0x63,
-    0x5D, 0x45, 0x4B, 0xED, 0x51, 0xE4, 0x93, 0x04, 0x0C, 0x64, 0x79, 0xAB, 0xBC, 0x76, 0x4B, 0xB9,
-    0xDA, 0x67, 0x34, 0x5D, 0x44, 0x23, 0xC0, 0x53, 0x33, 0xF0, 0x36, 0xCC, 0xFF, 0x40, 0xBB, 0x9E,
-    0x4D, 0x6D, 0x8C, 0x6B, 0xF3, 0xE0, 0x16, 0xF4, 0x10, 0x1C, 0x8F, 0xED, 0xD4, 0xB6, 0xBB, 0xBD,
-    0xE9, 0x85, 0xAD, 0xF0, 0x24, 0x9B, 0x96, 0x62, 0xD3, 0x54, 0x72, 0xD9, 0x78, 0x89, 0x20, 0x44,
-    0xD6, 0xC8, 0x2B, 0xDD, 0xE1, 0x2D, 0xC6, 0xF6, 0x1C, 0x59, 0xEE, 0x54, 0x6D, 0x13, 0x13, 0x37,
-    0x2C, 0x66, 0x9C, 0xB4, 0xB7, 0xF1, 0x93, 0xC3, 0xAB, 0x19, 0xF3, 0x6D, 0x8D, 0x19, 0x7E, 0xE3,
-    0x3B, 0xCF, 0x9B, 0x21, 0x2D, 0x65, 0xD8, 0x9E, 0xFF, 0x52, 0x9B, 0xB7, 0x75, 0x55, 0xDE, 0x31,
-    0x27, 0xFE, 0xB2, 0x16, 0x2F, 0x84, 0x44, 0x89, 0x42, 0xEB, 0x1F, 0xFE, 0x07, 0xF3, 0x95, 0xED,
-    0x8A, 0x8A, 0xB7, 0x5F, 0x13, 0x2F, 0xEE, 0x9C, 0x46, 0x0D, 0xA7, 0xD1, 0x35, 0x7E, 0xB2, 0xD9,
-    0x3D, 0xD1, 0xD0, 0xA2, 0xE6, 0x34, 0x72, 0xB9, 0x68, 0x95, 0xD8, 0xBA, 0x9D, 0x74, 0xE6, 0xB7,
-    0x7E, 0x37, 0xDB, 0x86, 0x4D, 0xFD, 0x7F, 0x69, 0x9C, 0x46, 0x0A, 0x89, 0x50, 0xD4, 0x67, 0xE6,
-    0x46, 0x3F, 0x37, 0x1E, 0x6F, 0x59, 0x83, 0x3D, 0x17, 0xDF, 0x4B, 0xC1, 0x77, 0x19, 0x36, 0xFD,
-    0x3B, 0x9E, 0x29, 0x4F, 0x8E, 0xF9, 0xFF, 0x15, 0x1B, 0x97, 0xB9, 0x3C, 0x99, 0xFC, 0x48, 0x63,
-    0x88, 0xA8, 0xB2, 0xE7, 0x35, 0x1C, 0x17, 0xAE, 0xD9, 0xBA, 0x72, 0x7C, 0xC6, 0x4F, 0xD9, 0x1A,
-    0x66, 0x6C, 0xD8, 0x5C, 0xAA, 0x64, 0xAA, 0x3B, 0xDA, 0xAB, 0x41, 0xC7, 0xEE, 0x90, 0xB3, 0x45,
-    0x17, 0x4C, 0x0C, 0x38, 0x96, 0x3D, 0x9F, 0x9D, 0x95, 0x18, 0x20, 0x82, 0xE7, 0x9F, 0x80, 0xD4,
-    0x2C, 0x80, 0x18, 0x7C, 0x70, 0xF9, 0xAC, 0x7C, 0xCB, 0xE3, 0xE9, 0x97, 0x20, 0x18, 0xB0, 0x60,
-    0xC9, 0xE0, 0x5E, 0x99, 0x91, 0xCA, 0x95, 0xC6, 0x26, 0x46, 0x9E, 0x71, 0xA4, 0x2B, 0xAF, 0x8D,
-    0xDF, 0x5E, 0x4E, 0x1D, 0xF5, 0xDF, 0xCA, 0xA7, 0xDB, 0xA9, 0xDA, 0x00, 0xCF, 0x3A, 0xE0, 0x1F,
-    0xA1, 0xB1, 0xE9, 0x33, 0x90, 0x31, 0x22, 0x23, 0xF7, 0x8F, 0xFF, 0xBE, 0xEE, 0xE9, 0x3C, 0xAD,
-    0xBC, 0x50, 0xE5, 0xCC, 0x08, 0xC1, 0x5C, 0xFB, 0x51, 0x75, 0xC5, 0x2C, 0x9C, 0x3C, 0xF9, 0x43,
-    0x39, 0x23, 0xFE, 0x75, 0xD5, 0x8B, 0x35, 0x3C, 0x2D, 0x01, 0x72, 0xF6, 0x71, 0xDA, 0x3C, 0x04,
-    0xB5, 0x70, 0xD4, 0x3E, 0x6E, 0xDC, 0xB5, 0xE4, 0xAC, 0x20, 0xBD, 0x34, 0xDE, 0xCE, 0xE1, 0x7B,
-    0x85, 0xEF, 0x49, 0xDD, 0x38, 0x37, 0x40, 0x1F, 0xCC, 0xEF, 0xC3, 0xA7, 0xF4, 0x9E, 0x5F, 0xFE,
-    0x2B, 0x39, 0xFF, 0x9A, 0xE0, 0x74, 0xC7, 0x7C, 0x55, 0x46, 0xE3, 0xA6, 0xD7, 0x10, 0xB3, 0x93,
-    0x06, 0xE6, 0x25, 0xF3, 0x2A, 0x6D, 0x54, 0xE0, 0xB9, 0x50, 0xF2, 0xAE, 0xCB, 0x9D, 0xBF, 0x6C,
-    0xB9, 0xCF, 0x5A, 0xF9, 0x85, 0x7C, 0x48, 0xFE, 0xE8, 0xD9, 0xB5, 0x97, 0xF7, 0xCE, 0x4B, 0x4F,
-    0x99, 0xC0, 0xDA, 0x9F, 0x96, 0x33, 0x18, 0x63, 0x06, 0xB4, 0x7A, 0x63, 0x32, 0x47, 0x10, 0x11,
-    0x83, 0xFF, 0x23, 0x5C, 0xB3, 0xFC, 0xBC, 0xBC, 0xFB, 0xBC, 0xF9, 0x9F, 0xC6, 0xA4, 0x9F, 0x31,
-    0x40, 0xD0, 0x17, 0xCC, 0xC3, 0xFF, 0x5D, 0x55, 0x01, 0x42, 0xB4, 0x82, 0xA4, 0xB5, 0x2C, 0xA1,
-    0xFC, 0x71, 0xA4, 0x34, 0xFF, 0xE5, 0x59, 0xE5, 0xF3, 0xDD, 0x3F, 0xC3, 0x4D, 0x3E, 0xC1, 0x5F,
-    0xA2, 0xEC, 0x17, 0x9C, 0xA1, 0xB1, 0x19, 0x18, 0x4E, 0xF5, 0x02, 0xF3, 0xB3, 0x6B, 0xE3, 0xE4,
-    0x9F, 0x85, 0xD4, 0x62, 0x7E, 0xF7, 0xD8, 0x45, 0xDF, 0x4E, 0x87, 0xFD, 0x30, 0xE0, 0xEA, 0xDD,
-    0xB7, 0xFB, 0x77, 0xE9, 0x57, 0x4F, 0xDE, 0xC6, 0x19, 0xDC, 0x29, 0xDE, 0x40, 0xCC, 0xFC, 0xE1,
-    0x09, 0x84, 0xC3, 0x3B, 0xB5, 0x39, 0xCB, 0xFE, 0x87, 0x0B, 0x93, 0x73, 0xCE, 0x7B, 0xC9, 0xC2,
-    0x2F, 0xCD, 0xEF, 0x09, 0x52, 0x4A, 0xEB, 0x62, 0x70, 0x30, 0x66, 0x7A, 0x98, 0xC3, 0x61, 0x7F,
-    0x69, 0x7A, 0xE3, 0x77, 0xB4, 0x03, 0xF9, 0xFB, 0xDD, 0x87, 0x44, 0xC6, 0x7F, 0xD2, 0xBB, 0x07,
-    0x77, 0x98, 0xEF, 0x8B, 0x77, 0x4B, 0xBC, 0x34, 0x0B, 0xAB, 0x32, 0xDF, 0xD6, 0xB3, 0x9E, 0xAF,
-    0x1E, 0x19, 0xDB, 0x9C, 0xE7, 0x97, 0xFA, 0x1C, 0x7D, 0xD2, 0x41, 0xF5, 0x97, 0xE0, 0x26, 0x9C,
-    0x4C, 0x3C, 0xC3, 0xCA, 0x6C, 0x74, 0x63, 0x85, 0xA5, 0x5D, 0xE8, 0xC0, 0xD0, 0x0B, 0x03, 0x86,
-    0x7E, 0xC7, 0x8A, 0x8A, 0x43, 0xB7, 0xD7, 0x86, 0x77, 0x2B, 0xD4, 0x5B, 0xFA, 0x39, 0xE7, 0x69,
-    0x2A, 0xF7, 0xB6, 0xA4, 0x3A, 0x19, 0x1F, 0x74, 0xA4, 0x39, 0x39, 0x57, 0x36, 0xD4, 0x1B, 0xDA,
-    0xC4, 0x3D, 0x42, 0x9F, 0x30, 0x24, 0x4C, 0x68, 0x26, 0xCF, 0x98, 0x3A, 0xD9, 0xEC, 0x30, 0x9D,
-    0x70, 0x87, 0xF9, 0x89, 0x3B, 0xD4, 0x22, 0x76, 0x18, 0xF9, 0xBC, 0x43, 0x93, 0xD4, 0x0E, 0x0D,
-    0x50, 0x3B, 0x4C, 0x48, 0x14, 0x28, 0xDC, 0x64, 0x87, 0xDA, 0x84, 0x40, 0x91, 0x57, 0x76, 0x28,
-    0x8A, 0x31, 0x59, 0x52, 0x20, 0x08, 0xDB, 0x0E, 0xF3, 0xFF, 0x76, 0x60, 0xA5, 0x34, 0xD9, 0x9B,
-    0x78, 0xA4, 0xD9, 0xBC, 0x1B, 0x8C, 0xC7, 0x9A, 0x53, 0xE3, 0x6B, 0xBE, 0xC8, 0x5A, 0x50, 0xBF,
-    0x7A, 0x1D, 0x54, 0x56, 0x79, 0x0E, 0x6B, 0xEB, 0x8A, 0x11, 0xCD, 0x6D, 0x5F, 0x53, 0x51, 0x9C,
-    0x16, 0x71, 0x11, 0x05, 0xE6, 0xF7, 0xB9, 0x23, 0xB3, 0xE9, 0xB9, 0xCD, 0x10, 0xFC, 0xD1, 0xE5,
-    0xF0, 0xB2, 0x09, 0xF0, 0x3E, 0x10, 0x10, 0xBE, 0x23, 0x20, 0xFA, 0x1A, 0xEC, 0x0A, 0xA1, 0x80,
-    0x7D, 0x01, 0x8E, 0x50, 0xA1, 0x11, 0x4C, 0xCE, 0xA3, 0xA0, 0x14, 0x00, 0x4E, 0x32, 0x82, 0x01,
-    0x62, 0x34, 0x05, 0x40, 0xB0, 0x24, 0x58, 0xE6, 0xBB, 0x22, 0x15, 0x87, 0xAD, 0x10, 0x6E, 0x5D,
-    0x7F, 0x4C, 0x42, 0x5E, 0xF4, 0x8F, 0xD1, 0x5D, 0xF9, 0x2D, 0x67, 0x7D, 0x99, 0x91, 0x75, 0x37,
-    0x27, 0xE2, 0x4C, 0xD6, 0xC0, 0xA9, 0x6E, 0xFE, 0xE5, 0xE4, 0x0E, 0x6C, 0x59, 0xE0, 0x9F, 0x88,
-    0x11, 0xAF, 0x45, 0x28, 0x85, 0x9A, 0x36, 0x67, 0x22, 0x16, 0xA3, 0xB5, 0x7A, 0xC0, 0xFF, 0xF2,
-    0x8B, 0xB0, 0xF6, 0x8E, 0x26, 0x5D, 0x85, 0x2B, 0x52, 0x0F, 0x4E, 0xDA, 0x63, 0xEE, 0x55, 0x82,
-    0x9B, 0x1F, 0xDD, 0xB0, 0xCC, 0x85, 0xE0, 0xCC, 0x18, 0x83, 0xE3, 0xE0, 0x08, 0xC9, 0x0B, 0xEB,
-    0x03, 0x8A, 0x66, 0x27, 0xFD, 0xA9, 0xC1, 0xCC, 0xFB, 0x68, 0x5C, 0x94, 0xAB, 0x11, 0x1C, 0x4B,
-    0xD9, 0x43, 0x1A, 0x2D, 0x9E, 0xFF, 0x01, 0x12, 0x5C, 0xF4, 0x48, 0x0F, 0x1A, 0xAF, 0x6A, 0x1B,
-    0xEF, 0x1F, 0xE5, 0x73, 0x66, 0xE9, 0xCF, 0x98, 0xE8, 0x32, 0xF9, 0xBE, 0x68, 0x7A, 0xDE, 0x4C,
-    0xCE, 0xAF, 0x1E, 0x98, 0xB2, 0x77, 0x46, 0xD4, 0x64, 0x72, 0xB1, 0xA8, 0xC9, 0x2F, 0x23, 0x6A,
-    0x72, 0x47, 0x4E, 0x2E, 0x63, 0x44, 0x4D, 0x86, 0xAB, 0xA8, 0x49, 0xE4, 0x84, 0x6D, 0x51, 0x6D,
-    0xBF, 0x0E, 0xF0, 0x85, 0xF3, 0xA2, 0x26, 0xDD, 0x37, 0x14, 0x51, 0xAB, 0xA3, 0x50, 0x3B, 0x50,
-    0x6D, 0x53, 0x24, 0x9F, 0x4C, 0x49, 0x9F, 0x8D, 0x00, 0x03, 0x1B, 0xED, 0x31, 0x1E, 0x3F, 0x54,
-    0x50, 0x82, 0xCB, 0x44, 0x92, 0xAE, 0xCF, 0x44, 0xB8, 0xC8, 0x5A, 0x98, 0x6F, 0x84, 0xBC, 0xFF,
-    0xFE, 0xD1, 0x24, 0xBF, 0xF8, 0x3A, 0x5A, 0x01, 0x79, 0xD4, 0x1E, 0x64, 0x95, 0xA3, 0xC9, 0x1D,
-    0xEC, 0x93, 0xE3, 0x47, 0x61, 0x83, 0x8E, 0xA0, 0x40, 0x9F, 0xF6, 0xFD, 0xEA, 0x3C, 0x79, 0x50,
-    0xDD, 0x00, 0x2E, 0x9A, 0xF5, 0xD8, 0x41, 0x79, 0x50, 0xCF, 0xE0, 0x84, 0x9E, 0x41, 0x25, 0x7A,
-    0xDD, 0x5A, 0x86, 0x74, 0x63, 0xD3, 0x68, 0x99, 0x39, 0x1B, 0x6C, 0x02, 0xAA, 0x08, 0x0A, 0xCA,
-    0x8D, 0xE4, 0x50, 0x21, 0x60, 0x30, 0x5A, 0x6B, 0x6A, 0x36, 0x0D, 0xBE, 0x8E, 0x46, 0x09, 0xEB,
-    0x31, 0x99, 0x9C, 0x11, 0x7A, 0xB6, 0xD0, 0xEF, 0x5F, 0x2E, 0xA0, 0xCB, 0xCF, 0x34, 0xE4, 0xC0,
-    0x5D, 0x0B, 0x41, 0x73, 0x98, 0xAB, 0xA0, 0x92, 0x1E, 0x0E, 0x77, 0xAE, 0x78, 0x0C, 0x66, 0xCE,
-    0xFD, 0xA2, 0xA4, 0xE0, 0x56, 0x2C, 0x7A, 0xCD, 0x87, 0x95, 0x7A, 0xD4, 0x6C, 0x4F, 0x0F, 0xE5,
-    0x08, 0xCF, 0xCC, 0xA3, 0x51, 0x1F, 0xDE, 0x7C, 0x38, 0x31, 0x72, 0xAD, 0xEC, 0xC3, 0xEA, 0x02,
-    0xF0, 0xE6, 0x70, 0x3A, 0x23, 0x9B, 0xB8, 0x33, 0xE2, 0xCC, 0x4C, 0x33, 0x52, 0x62, 0x9B, 0x8D,
-    0x32, 0x6B, 0x9F, 0xB0, 0x56, 0x9B, 0x03, 0xE5, 0x90, 0x07, 0x23, 0xAE, 0x7E, 0xB7, 0x19, 0x51,
-    0x06, 0xF6, 0xEB, 0x11, 0x8C, 0xDB, 0xEC, 0x47, 0xB3, 0x68, 0x46, 0xB6, 0x66, 0xD3, 0xC8, 0x66,
-    0xC9, 0x8C, 0x80, 0x28, 0x9F, 0x2E, 0xA8, 0x19, 0x86, 0x22, 0xE3, 0x3A, 0xBA, 0x93, 0xE4, 0x74,
-    0x55, 0xCD, 0x0A, 0xA5, 0xD2, 0xB6, 0xF6, 0x8A, 0xFF, 0x90, 0xAD, 0x83, 0x50, 0xC0, 0x19, 0xDD,
-    0x16, 0xE4, 0x04, 0x70, 0x8F, 0x79, 0x9A, 0xBB, 0x00, 0x4D, 0xFE, 0x40, 0x33, 0x12, 0x92, 0x3F,
-    0x82, 0x36, 0x6A, 0xC2, 0x9F, 0xFD, 0x86, 0x31, 0x0B, 0x1F, 0x7E, 0xA8, 0xD2, 0x04, 0xA5, 0x51,
-    0xF7, 0xE3, 0x8F, 0x99, 0xC0, 0xF4, 0xAB, 0x0F, 0x81, 0x84, 0xE8, 0x67, 0xDC, 0xB5, 0x89, 0xBA,
-    0x2C, 0x1B, 0x5A, 0x5E, 0x40, 0x65, 0x11, 0x63, 0x55, 0x79, 0xB5, 0x7B, 0xB8, 0xA5, 0xBE, 0xB6,
-    0xBA, 0x60, 0xF2, 0x68, 0x7D, 0x66, 0xA2, 0xEA, 0xE9, 0xCD, 0x60, 0x3A, 0x7B, 0x4A, 0xC5, 0x18,
-    0xAE, 0x72, 0xC6, 0x33, 0x95, 0x12, 0x7A, 0x05, 0x79, 0xD1, 0x0B, 0x9E, 0xF1, 0x6C, 0xCD, 0xF4,
-    0xFC, 0xD8, 0x12, 0x33, 0x88, 0xF9, 0x94, 0xC2, 0x1C, 0x65, 0x20, 0x1C, 0xF0, 0xFE, 0x42, 0xDF,
-    0xB8, 0xA2, 0x75, 0x8A, 0x72, 0x5B, 0x08, 0x81, 0x19, 0x55, 0x5A, 0x03, 0xA1, 0x52, 0x77, 0x5A,
-    0x83, 0x29, 0x6A, 0xA9, 0x03, 0x68, 0x36, 0x0D, 0xEE, 0xD5, 0x40, 0x86, 0xE2, 0x9A, 0x5C, 0xD2,
-    0x39, 0x8E, 0x50, 0x13, 0xA8, 0xDD, 0xA6, 0xC1, 0x3A, 0x6C, 0x5C, 0xBA, 0xD8, 0xBA, 0xA1, 0x24,
-    0x42, 0x38, 0x1B, 0xAA, 0x21, 0x2C, 0xDF, 0xC2, 0x8D, 0xB4, 0xC8, 0xC3, 0x83, 0x69, 0xC5, 0xD6,
-    0x48, 0x13, 0x84, 0xA1, 0x2F, 0x33, 0x77, 0x00, 0xCF, 0x06, 0x11, 0x40, 0x26, 0x61, 0x95, 0x0F,
-    0x86, 0x74, 0x26, 0xBD, 0x2E, 0x93, 0xD0, 0x80, 0xC9, 0x74, 0x7A, 0x6C, 0x23, 0xC6, 0x65, 0x22,
-    0x64, 0x48, 0x5D, 0xEA, 0x89, 0x89, 0xDE, 0x85, 0x46, 0x0A, 0x6F, 0xBB, 0x26, 0xD0, 0xC5, 0xE7,
-    0x82, 0x33, 0xF0, 0xF2, 0x12, 0xF0, 0xF2, 0x12, 0xF0, 0xF2, 0x12, 0xF0, 0x12, 0x03, 0x2F, 0x78,
-    0x6A, 0x4D, 0x32, 0xE0, 0x85, 0x09, 0x6A, 0xCB, 0x01, 0x2F, 0xFC, 0x02, 0xA6, 0xAD, 0x26, 0x06,
-    0x5E, 0x5E, 0x02, 0x5E, 0x5E, 0x02, 0x5E, 0x3E, 0xB3, 0x86, 0x17, 0xD2, 0xC0, 0x8C, 0x21, 0x0F,
-    0x25, 0x26, 0x9D, 0x7C, 0x36, 0xAC, 0x92, 0x28, 0xCE, 0x93, 0xE8, 0xC0, 0x24, 0xA2, 0xD0, 0x25,
-    0xA2, 0x17, 0x27, 0x82, 0x61, 0xCC, 0x36, 0xE9, 0x34, 0x52, 0x1C, 0x53, 0x4D, 0x22, 0x41, 0x4D,
-    0x34, 0x97, 0x43, 0xD4, 0xED, 0x28, 0x93, 0x23, 0x2A, 0x93, 0xCF, 0x22, 0xEA, 0xCB, 0x6D, 0x20,
-    0xFD, 0x40, 0xE9, 0xC6, 0xE0, 0x29, 0xAA, 0xC8, 0x3A, 0xAC, 0x64, 0xFF, 0x0B, 0x94, 0x9E, 0xBE,
-    0xB5, 0x04, 0x23, 0x96, 0xCF, 0x0F, 0x00, 0x59, 0x22, 0xAF, 0x56, 0x06, 0x0A, 0xE4, 0x79, 0x7D,
-    0x29, 0x88, 0x74, 0x78, 0x4F, 0xF3, 0x1D, 0xF7, 0xB6, 0x40, 0xD7, 0x66, 0x1F, 0x13, 0x66, 0x84,
-    0xB1, 0x5A, 0xDF, 0x67, 0xB4, 0x18, 0x68, 0xE6, 0x3A, 0xEF, 0x6B, 0x96, 0x84, 0xD9, 0x71, 0xA9,
-    0xE8, 0x9F, 0x7F, 0x34, 0xB6, 0x86, 0xEB, 0xE2, 0x84, 0x34, 0xC6, 0xC4, 0xF0, 0xD6, 0x30, 0x71,
-    0x09, 0xBE, 0x77, 0x16, 0x66, 0x31, 0x88, 0xCF, 0xB7, 0x35, 0x09, 0x3E, 0xAC, 0xAD, 0xFA, 0xE7,
-    0x81, 0x76, 0x78, 0x1F, 0x52, 0xA2, 0x6A, 0x19, 0xE8, 0x90, 0xEA, 0x14, 0x48, 0x31, 0x38, 0x31,
-    0x50, 0x0B, 0x1D, 0x60, 0xC1, 0xE0, 0x36, 0x98, 0x81, 0xC2, 0x0A, 0xEF, 0x13, 0xD6, 0x93, 0x59,
-    0x1A, 0x5B, 0x3D, 0x86, 0xB5, 0x5D, 0x04, 0xC6, 0xAC, 0x1C, 0xC3, 0xA0, 0xB1, 0xEF, 0x52, 0x6C,
-    0xFF, 0x73, 0x12, 0xA6, 0xBF, 0xA0, 0x72, 0x4D, 0xBB, 0x58, 0xC4, 0xFA, 0x4A, 0xD1, 0x5F, 0xD0,
-    0x0C, 0xF1, 0x3D, 0x86, 0xE9, 0xE7, 0x4B, 0xC2, 0x8C, 0xBE, 0x6E, 0x78, 0x97, 0xB4, 0x12, 0x8D,
-    0xF4, 0xAC, 0xE6, 0x39, 0xAD, 0x05, 0x13, 0xD3, 0xF4, 0x16, 0xB2, 0x5E, 0x8C, 0xB7, 0xC8, 0x3A,
-    0x98, 0xAA, 0x04, 0xCA, 0x28, 0x5F, 0xDC, 0x2B, 0x7D, 0x16, 0xB4, 0xD3, 0xF8, 0x4B, 0xC6, 0x6B,
-    0xB0, 0xA2, 0x44, 0xF0, 0x33, 0xD6, 0x6C, 0xFA, 0x1B, 0x66, 0x7A, 0x7E, 0x90, 0x13, 0x32, 0xCD,
-    0xE1, 0xAF, 0x19, 0x92, 0xFA, 0x53, 0xEA, 0x60, 0xAC, 0x2B, 0x11, 0x20, 0x65, 0x06, 0x3D, 0x20,
-    0x94, 0x8E, 0x9E, 0xFF, 0x00, 0xE1, 0x65, 0x80, 0x09, 0x83, 0x6A, 0xE6, 0xF4, 0x7B, 0x3E, 0x3C,
-    0x44, 0x69, 0x0D, 0x0D, 0x9C, 0xE8, 0xE1, 0xA3, 0xF4, 0xB3, 0xC4, 0x66, 0x72, 0x59, 0x21, 0xC8,
-    0xBD, 0x48, 0x9A, 0x7A, 0x9F, 0xAC, 0x3E, 0xB2, 0xD1, 0xE8, 0xF1, 0x39, 0x60, 0x3C, 0xDE, 0x46,
-    0xB8, 0x79, 0x67, 0xC1, 0x79, 0x27, 0xBF, 0x0E, 0xD0, 0x10, 0x3C, 0x98, 0x02, 0x11, 0x6D, 0xDD,
-    0x92, 0x43, 0xEE, 0x56, 0xF0, 0xD3, 0x44, 0xDB, 0x26, 0x04, 0x32, 0x3A, 0x1A, 0x1E, 0x15, 0x4E,
-    0xDE, 0x58, 0xD5, 0x89, 0x39, 0x06, 0x81, 0x13, 0x86, 0x0C, 0x0C, 0xF0, 0xAC, 0x33, 0xCF, 0x80,
-    0xB6, 0xD8, 0x9E, 0xE9, 0xCB, 0x0A, 0xF4, 0x6D, 0x63, 0x9F, 0xCD, 0x27, 0x69, 0x35, 0x9E, 0x16,
-    0x2D, 0x0B, 0xFD, 0x05, 0x47, 0x7B, 0x9D, 0xFD, 0x3E, 0x2B, 0xB5, 0x0D, 0x67, 0xDA, 0xFA, 0xB5,
-    0xB6, 0xDE, 0x5C, 0x5B, 0x77, 0xA1, 0x2D, 0x15, 0x1A, 0x06, 0x49, 0x9E, 0xDE, 0xF6, 0xAE, 0x90,
-    0xC1, 0x25, 0x62, 0x4D, 0x75, 0x9E, 0x75, 0x11, 0x05, 0x56, 0x20, 0xD0, 0xF0, 0xA9, 0x17, 0x5E,
-    0x51, 0xD3, 0x7F, 0x64, 0xC3, 0xD0, 0xA2, 0xDE, 0xB7, 0x76, 0x45, 0x53, 0xCD, 0xCC, 0xAA, 0x41,
-    0xB0, 0xC6, 0x83, 0x43, 0x76, 0x6F, 0xB0, 0x81, 0x46, 0xCC, 0x86, 0xEA, 0xCC, 0xC1, 0xBF, 0xE9,
-    0x6C, 0x8A, 0x4D, 0x9E, 0x68, 0xA1, 0x35, 0x0D, 0xD2, 0xD5, 0x38, 0x5E, 0xDA, 0x91, 0x87, 0x66,
-    0x88, 0xE3, 0x5D, 0x97, 0xB6, 0x6C, 0xA3, 0x3B, 0xC3, 0xEA, 0xE5, 0x2A, 0x03, 0xBB, 0xF7, 0x69,
-    0x8C, 0xA7, 0x80, 0x02, 0x23, 0xC7, 0xB1, 0x4A, 0x7A, 0x82, 0xE8, 0xDA, 0x58, 0x05, 0xDD, 0xEB,
-    0x7E, 0x78, 0xA7, 0xF7, 0x25, 0x0A, 0xA1, 0x12, 0x4D, 0x1E, 0xD9, 0x6B, 0xB4, 0x3B, 0x0B, 0x35,
-    0xCE, 0x40, 0x97, 0x72, 0x24, 0x3F, 0x20, 0x78, 0x01, 0xB1, 0x28, 0x30, 0x37, 0xF8, 0x33, 0x78,
-    0xAC, 0xF0, 0x28, 0x90, 0xA9, 0xAA, 0xB0, 0xE5, 0x27, 0x53, 0x7E, 0xBB, 0xCB, 0x33, 0x13, 0x5E,
-    0x95, 0x08, 0xE1, 0x83, 0x83, 0x5D, 0xFA, 0x91, 0xBB, 0x38, 0x22, 0x22, 0xB8, 0xDD, 0x5D, 0x1B,
-    0xE6, 0x70, 0x78, 0x83, 0x21, 0x42, 0x0B, 0x98, 0x10, 0x54, 0x6C, 0xEE, 0x8D, 0x54, 0x31, 0xAC,
-    0xF2, 0xD8, 0x5C, 0xBE, 0x9C, 0xA3, 0x12, 0xBE, 0xD0, 0xCE, 0x2E, 0x8D, 0xD3, 0x08, 0x2E, 0xF5,
-    0xE4, 0xCF, 0x05, 0x1F, 0x19, 0x04, 0xF3, 0x29, 0xA4, 0xF2, 0xA9, 0x59, 0xD8, 0x77, 0xBB, 0xCE,
-    0x5C, 0xF6, 0x35, 0xF8, 0x43, 0xF2, 0xC7, 0x42, 0xF7, 0xA3, 0xBF, 0x2D, 0xBD, 0xC3, 0xB0, 0x83,
-    0x45, 0xB5, 0xFB, 0x6F, 0x36, 0x0A, 0x72, 0x2B, 0x68, 0xD6, 0x4A, 0xCC, 0xC4, 0x7D, 0x89, 0x19,
-    0xEF, 0xA1, 0x4B, 0xCC, 0x9C, 0x6A, 0x49, 0x4E, 0x4F, 0xB3, 0x24, 0xDF, 0xBD, 0xA5, 0x49, 0xE6,
-    0xB6, 0xC4, 0xCC, 0x0E, 0x63, 0x61, 0x06, 0xAB, 0x9B, 0x5F, 0xF6, 0xB6, 0x95, 0x3D, 0xCD, 0xBC,
-    0x37, 0x66, 0x30, 0x56, 0x46, 0xCC, 0x01, 0x9C, 0x79, 0xCB, 0xAF, 0x57, 0x17, 0xB5, 0x24, 0x53,
-    0x34, 0x64, 0x1E, 0xC5, 0xA5, 0x99, 0xA3, 0xE9, 0xFB, 0x95, 0x9A, 0x40, 0xB0, 0xD4, 0x5F, 0x83,
-    0xA6, 0xAE, 0xC7, 0xE7, 0x1A, 0xAD, 0xF3, 0xEA, 0x9C, 0xAC, 0x78, 0xE3, 0x5C, 0xD0, 0xD6, 0xFD,
-    0x08, 0x60, 0x79, 0xC7, 0x96, 0x76, 0xD4, 0xFA, 0x8E, 0xFE, 0xB9, 0x40, 0x86, 0x86, 0xD4, 0x45,
-    0x1C, 0x2F, 0x32, 0x75, 0xB1, 0x32, 0x0F, 0x77, 0xDC, 0xC7, 0x5A, 0xD7, 0xE3, 0x4C, 0xA4, 0x71,
-    0x97, 0x3A, 0x8B, 0xCC, 0xCA, 0x0B, 0x58, 0xB4, 0xEA, 0x8D, 0xA1, 0x6A, 0x81, 0xB4, 0x23, 0x9C,
-    0xC0, 0x88, 0xD5, 0x03, 0x4A, 0x91, 0xE4, 0xE4, 0xE0, 0xFF, 0x21, 0x18, 0xB0, 0xDF, 0xF5, 0xFE,
-    0x54, 0xE7, 0x61, 0x0B, 0xFE, 0xEC, 0x9F, 0x16, 0x03, 0x9E, 0xF7, 0x25, 0xC7, 0x82, 0x4A, 0x28,
-    0xBC, 0x8D, 0x01, 0x67, 0xA5, 0xC5, 0x21, 0x06, 0x7C, 0x0A, 0xDF, 0xEF, 0x08, 0x82, 0x69, 0x72,
-    0x4A, 0x48, 0xC0, 0xC3, 0xE8, 0xFF, 0x8F, 0x71, 0xE6, 0xCE, 0xB8, 0xBD, 0x41, 0xB3, 0x94, 0x02,
-    0xF9, 0xEF, 0xF8, 0x31, 0xCC, 0xBC, 0x7E, 0xD8, 0x99, 0x07, 0xE0, 0xAC, 0x04, 0xE7, 0xCF, 0x9C,
-    0x05, 0x82, 0x7A, 0x31, 0xB5, 0x32, 0x94, 0x11, 0x31, 0x04, 0xB7, 0x37, 0xD4, 0xA2, 0xEB, 0x8C,
-    0x6B, 0x96, 0x75, 0x82, 0xB4, 0x14, 0x90, 0x56, 0x0A, 0xB2, 0x2A, 0x83, 0xAA, 0x7B, 0xFA, 0x9E,
-    0xD5, 0x82, 0x4C, 0xF8, 0x0E, 0x29, 0x15, 0xCF, 0x67, 0xC1, 0x20, 0x0D, 0x6F, 0x66, 0xC9, 0x20,
-    0x9B, 0x63, 0x1F, 0x54, 0xB6, 0xE4, 0x49, 0x70, 0x84, 0xB9, 0xCB, 0x75, 0x07, 0xD6, 0x92, 0xDE,
-    0xBB, 0xF4, 0xCF, 0x87, 0x97, 0x18, 0xA8, 0x9D, 0x4A, 0x1F, 0x07, 0xAA, 0x9A, 0xB9, 0x0B, 0xA6,
-    0x9C, 0xC1, 0xF0, 0x9E, 0x51, 0x1D, 0x64, 0xDA, 0x28, 0x8B, 0x3F, 0x0C, 0x69, 0x01, 0xFC, 0x6F,
-    0x02, 0x6F, 0xD2, 0x01, 0xE3, 0x4A, 0x20, 0x0C, 0xCF, 0x65, 0x7C, 0x72, 0xD1, 0x72, 0x0B, 0x49,
-    0xF5, 0x78, 0xFC, 0xF1, 0x83, 0x97, 0x8C, 0x56, 0x1D, 0x9B, 0xB1, 0x9E, 0xE7, 0x5A, 0xC3, 0x2F,
-    0x9F, 0x62, 0xC3, 0x32, 0x95, 0x5C, 0x76, 0x76, 0xF5, 0xF5, 0x01, 0x30, 0xC9, 0x85, 0x9B, 0x4B,
-    0x88, 0x3D, 0x08, 0x73, 0xC2, 0x52, 0x68, 0xCD, 0x9B, 0xC7, 0x6A, 0x66, 0x7E, 0x22, 0xF8, 0xEE,
-    0x78, 0xFB, 0x17, 0x2C, 0xF4, 0xB7, 0xB4, 0x70, 0xE5, 0x1A, 0x3F, 0x1F, 0xA2, 0x61, 0x29, 0x88,
-    0x47, 0x81, 0x99, 0x55, 0x9E, 0x08, 0x2B, 0xA7, 0xA8, 0x79, 0xF3, 0x1A, 0x08, 0xFA, 0xB5, 0x20,
-    0xEE, 0x9B, 0x3F, 0xF2, 0xD6, 0x2C, 0xFC, 0x67, 0xC2, 0xA3, 0xBC, 0xF7, 0xAD, 0x59, 0x78, 0xA1,
-    0x9A, 0x3F, 0x97, 0xB4, 0x32, 0xD2, 0xF4, 0x5C, 0xB0, 0x0B, 0x90, 0x21, 0x92, 0x3F, 0x79, 0x77,
-    0x1B, 0xA8, 0x59, 0xEE, 0xCA, 0x6E, 0x9A, 0xED, 0x0E, 0xF3, 0x5F, 0x81, 0x6C, 0xAB, 0xF7, 0x48,
-    0x64, 0x67, 0xA5, 0x20, 0xAF, 0x80, 0x45, 0xDB, 0x83, 0xC0, 0xAB, 0x00, 0x73, 0x0B, 0x32, 0x80,
-    0x84, 0xA0, 0x9A, 0x6F, 0xD7, 0xC4, 0x94, 0x20, 0xEA, 0xB7, 0xB5, 0x79, 0xFE, 0x10, 0x98, 0x98,
-    0x9F, 0x02, 0x5E, 0x3D, 0xB1, 0x45, 0x76, 0xB4, 0x7A, 0xCF, 0xE6, 0xE1, 0xE7, 0x3C, 0x76, 0xE4,
-    0xC8, 0xFC, 0x3F, 0x6B, 0x93, 0x5F, 0x7E, 0xD0, 0x8A, 0x5C, 0x39, 0x75, 0x51, 0x00, 0x28, 0xC8,
-    0x45, 0xC4, 0xEB, 0x8F, 0x74, 0x28, 0x14, 0xB4, 0x7F, 0x61, 0x1E, 0xF2, 0xEF, 0x52, 0xD3, 0x6E,
-    0xDB, 0x00, 0xF6, 0xB4, 0x83, 0xA1, 0x67, 0xD9, 0x9B, 0x4A, 0x21, 0x31, 0xFB, 0x0F, 0x07, 0x9E,
-    0x3B, 0x87, 0x4D, 0xF2, 0x08, 0xBA, 0x7C, 0x94, 0x75, 0xF3, 0xE4, 0xF0, 0x66, 0x93, 0x54, 0xA6,
-    0x15, 0x51, 0x71, 0x37, 0x51, 0xAB, 0xCB, 0x43, 0x1D, 0xEB, 0x25, 0xF7, 0x73, 0xAD, 0x72, 0x4B,
-    0x83, 0xD7, 0xD1, 0xBD, 0x56, 0xFD, 0xC0, 0x85, 0xA6, 0x82, 0xC5, 0x25, 0x05, 0x75, 0x25, 0xCE,
-    0x32, 0xA3, 0x6B, 0x3E, 0xAD, 0x0E, 0x23, 0xF0, 0x03, 0x69, 0x42, 0x5A, 0x22, 0x92, 0xEF, 0xBF,
-    0x3B, 0x1E, 0xDF, 0x9C, 0x47, 0xDC, 0xF7, 0x73, 0x5F, 0x1B, 0xAD, 0x85, 0x34, 0x48, 0xC5, 0x6A,
-    0x49, 0xED, 0x8B, 0xAF, 0xDA, 0x68, 0x30, 0x1B, 0x07, 0xE7, 0xB4, 0x2B, 0xF7, 0x33, 0x64, 0xAB,
-    0xC3, 0xF1, 0x1E, 0x2B, 0x2D, 0x76, 0xB6, 0xD0, 0x15, 0xB7, 0xAB, 0x73, 0x63, 0x2D, 0x90, 0x87,
-    0xC2, 0xB5, 0xA6, 0x14, 0xB7, 0x37, 0x89, 0x6A, 0x61, 0x05, 0xD7, 0x59, 0xFE, 0xE7, 0x3A, 0x62,
-    0x69, 0xCC, 0x75, 0xD2, 0xE8, 0xA4, 0x78, 0x7F, 0x52, 0xA4, 0x1C, 0x57, 0xEA, 0x14, 0x93, 0xC9,
-    0x24, 0xB5, 0x0E, 0x33, 0x4D, 0xD0, 0x51, 0x7A, 0xAE, 0x03, 0x54, 0xF5, 0xC3, 0x5B, 0xBE, 0xFC,
-    0x6D, 0x63, 0x4B, 0x2A, 0xC9, 0x5D, 0x16, 0xBD, 0x7F, 0xFB, 0x18, 0xB6, 0x82, 0x01, 0x5B, 0xCB,
-    0x01, 0x5B, 0x8E, 0x62, 0xCB, 0x5B, 0x61, 0xCB, 0x9F, 0x5D, 0x0B, 0x14, 0x5B, 0xE1, 0xA7, 0x89,
-    0xAD, 0xC3, 0x35, 0xAD, 0xEA, 0x22, 0x16, 0xD8, 0xAD, 0xE3, 0x78, 0x2D, 0x3E, 0x15, 0xBC, 0x5A,
-    0x3D, 0x70, 0x71, 0x2E, 0x54, 0x8C, 0x17, 0x5D, 0xE9, 0x1F, 0x3E, 0xEA, 0xAF, 0x12, 0xC0, 0xCC,
-    0x56, 0xDA, 0x62, 0x69, 0xBD, 0x1F, 0x39, 0xB6, 0x48, 0x4E, 0x6C, 0x4C, 0x9E, 0xC5, 0x68, 0x37,
-    0x37, 0xA7, 0x06, 0x19, 0xFD, 0xD3, 0x2E, 0x76, 0xAC, 0xA9, 0x90, 0x36, 0x19, 0xD2, 0xA6, 0x43,
-    0xDA, 0x84, 0xC8, 0xE3, 0x29, 0x91, 0x76, 0xC2, 0x4F, 0xB3, 0x04, 0x52, 0x6F, 0xE5, 0x2D, 0x36,
-    0xAC, 0xDF, 0x4C, 0x1A, 0xA1, 0xF5, 0xBB, 0xB5, 0xC5, 0x7F, 0xAD, 0xF5, 0x3B, 0xB7, 0xF1, 0x8D,
-    0xCB, 0xE5, 0x9B, 0xAB, 0x04, 0x37, 0x9C, 0xE5, 0xD3, 0x7E, 0x91, 0xAD, 0xFC, 0x56, 0xAB, 0x02,
-    0xAA, 0x73, 0x9A, 0x6E, 0x8E, 0x81, 0x53, 0x4A, 0xB1, 0x31, 0x82, 0xA7, 0x34, 0x5F, 0xB9, 0x09,
-    0x03, 0x6F, 0xC7, 0x7C, 0x8F, 0x4A, 0x03, 0x6E, 0x10, 0x78, 0x35, 0x62, 0x00, 0x16, 0x7C, 0x46,
-    0x07, 0x66, 0x24, 0xB3, 0x19, 0x09, 0x5E, 0x46, 0x82, 0xF1, 0x11, 0xF2, 0x43, 0x98, 0x4A, 0xD1,
-    0xA5, 0xC9, 0x0F, 0x8A, 0x99, 0x9C, 0x27, 0xE7, 0xBA, 0xCD, 0x88, 0xA5, 0x35, 0xCC, 0x14, 0x49,
-    0x9F, 0xF0, 0x4B, 0xE9, 0xAF, 0x48, 0x30, 0xEB, 0x78, 0xAA, 0xDC, 0xC4, 0xFE, 0x2E, 0xCA, 0x5F,
-    0x6D, 0xCF, 0x58, 0xDC, 0x2F, 0x6E, 0x7B, 0x2D, 0x19, 0xC6, 0x19, 0x6F, 0x1D, 0xCE, 0xB0, 0xD1,
-    0x14, 0xFA, 0xD5, 0x0A, 0x06, 0x7D, 0x4D, 0xF1, 0xE3, 0x70, 0x3D, 0xC3, 0x50, 0x5F, 0x27, 0x8C,
-    0x4B, 0x54, 0x05, 0x30, 0x12, 0xCD, 0xDA, 0xEA, 0xE1, 0x1F, 0x23, 0xFC, 0xF0, 0x1F, 0xB0, 0x4E,
-    0xE3, 0x16, 0x7B, 0x28, 0x6E, 0xAE, 0x0C, 0xBB, 0x93, 0x4E, 0x7E, 0xCB, 0xF0, 0x95, 0x98, 0x28,
-    0xBD, 0x52, 0xE2, 0x75, 0x89, 0xB9, 0x2B, 0x16, 0xC4, 0x48, 0xEA, 0x8E, 0xF5, 0xCE, 0xBC, 0x65,
-    0x0F, 0x46, 0x7A, 0x6F, 0x01, 0x3B, 0x00, 0xFB, 0x43, 0x99, 0x0C, 0x00, 0xC7, 0x06, 0xE1, 0x89,
-    0xB0, 0x2D, 0x73, 0x7D, 0x1D, 0x38, 0x41, 0xAD, 0x68, 0x35, 0x14, 0x2E, 0x7A, 0x9F, 0x8D, 0xB3,
-    0x19, 0x66, 0x60, 0x6D, 0x32, 0x7D, 0xC1, 0x62, 0xF7, 0xC2, 0x80, 0xE6, 0xC1, 0xCE, 0xD6, 0xC8,
-    0xEF, 0x1E, 0xEE, 0xDA, 0x33, 0xD6, 0x91, 0x5F, 0xF7, 0xE8, 0x48, 0x4A, 0x2D, 0x8F, 0xC1, 0x75,
-    0x14, 0x53, 0xF1, 0xE6, 0x3A, 0xBA, 0x88, 0x29, 0x35, 0xBB, 0xA8, 0x29, 0x75, 0x0D, 0x6C, 0xD4,
-    0x24, 0x49, 0x06, 0xEB, 0x88, 0x2C, 0xA9, 0xCF, 0xDF, 0xE2, 0x0F, 0x70, 0xAC, 0xD7, 0xFD, 0x7E,
-    0x06, 0x6C, 0xD1, 0x77, 0xD6, 0x6C, 0xD1, 0xEB, 0xB2, 0xEC, 0x5A, 0x6A, 0x6D, 0xB2, 0x26, 0x96,
-    0xB7, 0x36, 0xF4, 0xED, 0xC9, 0xDA, 0xA2, 0x1F, 0xB0, 0xC4, 0x2E, 0x24, 0xE3, 0x6E, 0x80, 0xCC,
-    0xA6, 0x7E, 0x42, 0xC6, 0x15, 0x75, 0xA0, 0x97, 0x71, 0x45, 0x19, 0xB0, 0xBA, 0xC0, 0x99, 0xE0,
-    0x5B, 0x34, 0x17, 0x0E, 0x60, 0xDF, 0x9C, 0x07, 0xAE, 0x50, 0xF6, 0x9F, 0x9E, 0x71, 0x40, 0xE8,
-    0x87, 0xCC, 0x0F, 0x91, 0x1F, 0x12, 0xBF, 0x15, 0xF8, 0xD7, 0x8E, 0x4B, 0x07, 0xAA, 0xB0, 0xF2,
-    0x28, 0x4F, 0x3F, 0xFA, 0x12, 0xE5, 0x46, 0x1D, 0x53, 0x46, 0x8B, 0x94, 0x1B, 0xAD, 0x52, 0x6E,
-    0xB4, 0x4C, 0xB9, 0xD1, 0x3A, 0xE5, 0x46, 0x0B, 0x95, 0x1B, 0xAD, 0x54, 0x6E, 0xB4, 0x54, 0xB9,
-    0xD1, 0x5A, 0xE5, 0x46, 0x8B, 0x95, 0x1B, 0xAD, 0x56, 0x6E, 0xB4, 0x5C, 0xB9, 0x50, 0xF8, 0x99,
-    0x5F, 0x32, 0xE9, 0x14, 0x26, 0xD9, 0xC6, 0x99, 0x87, 0x29, 0x4B, 0x4E, 0xC6, 0x4C, 0x72, 0x40,
-    0xCD, 0x72, 0xA3, 0x45, 0xCB, 0x8D, 0x56, 0x2D, 0x37, 0x5A, 0xB6, 0x5C, 0xAB, 0x5F, 0x26, 0x6F,
-    0xD9, 0xC2, 0xE5, 0x5A, 0xB9, 0x7C, 0xD1, 0xC7, 0x80, 0xAD, 0x88, 0xD5, 0x31, 0x2B, 0xAE, 0x15,
-    0xB6, 0x94, 0x2F, 0x8A, 0xE2, 0x04, 0xEB, 0x61, 0x87, 0xF0, 0x19, 0xD4, 0x66, 0x9C, 0x61, 0x72,
-    0x09, 0x74, 0x36, 0x33, 0x9A, 0x9B, 0xE0, 0x03, 0x73, 0x5D, 0x7A, 0xDF, 0x33, 0xD7, 0x5F, 0x33,
-    0xD1, 0xB6, 0xB9, 0x2E, 0x23, 0x89, 0x45, 0x26, 0xE2, 0x2B, 0x4C, 0xF7, 0x01, 0xCB, 0x85, 0x40,
-    0xFF, 0x27, 0xB5, 0x40, 0xEF, 0x57, 0x80, 0xEE, 0x6F, 0x2B, 0x81, 0x4E, 0x57, 0x0A, 0x34, 0x5D,
-    0x1E, 0xDF, 0xB8, 0x2E, 0x7B, 0x31, 0x6E, 0x10, 0x4B, 0x13, 0x2F, 0x56, 0x63, 0x5B, 0xA7, 0xA3,
-    0xCA, 0xA9, 0xD5, 0xAC, 0x6C, 0x25, 0xC2, 0xC7, 0x2D, 0x07, 0xC5, 0x5A, 0x6E, 0x28, 0x67, 0xB5,
-    0xEA, 0xD3, 0x7F, 0xEE, 0xE5, 0x59, 0xFB, 0x09, 0x13, 0x08, 0x32, 0xCE, 0xDC, 0xD3, 0x2A, 0x84,
-    0x90, 0x5F, 0xD6, 0x85, 0x97, 0xAC, 0x4B, 0x7D, 0xD8, 0x69, 0xEF, 0x5F, 0x9D, 0x3B, 0xEA, 0x5B,
-    0x58, 0x05, 0x09, 0x5D, 0xBE, 0xA7, 0xB5, 0x3C, 0x8F, 0xD6, 0x6B, 0x79, 0x6A, 0x3D, 0x4F, 0x91,
-    0x3A, 0x6C, 0x2D, 0xCF, 0xF6, 0x35, 0xD6, 0xF2, 0x84, 0x02, 0xE6, 0xD0, 0xFA, 0xCB, 0xF2, 0xC8,
-    0x36, 0xD3, 0x26, 0xC8, 0xBF, 0x73, 0x46, 0xE8, 0xE8, 0x33, 0x85, 0x21, 0xF3, 0x05, 0x47, 0x36,
-    0x15, 0x6A, 0x9F, 0xCA, 0xFB, 0x79, 0xB0, 0x19, 0xDD, 0xFB, 0x38, 0x31, 0xA4, 0x66, 0xA8, 0x54,
-    0x85, 0x59, 0xEB, 0x94, 0x66, 0x4B, 0x35, 0x76, 0xA8, 0xB2, 0x6F, 0xA3, 0x87, 0x8C, 0xFD, 0x69,
-    0x87, 0x21, 0xD7, 0xCB, 0x5A, 0xE5, 0x8C, 0x35, 0x6D, 0x92, 0x0D, 0x2C, 0x27, 0x13, 0x2E, 0x7F,
-    0xEA, 0x08, 0x41, 0xA5, 0xAD, 0xFE, 0x1A, 0x4A, 0x5F, 0x3E, 0x81, 0x3E, 0x1F, 0xB6, 0xD9, 0x64,
-    0xD2, 0xEB, 0xE0, 0x8D, 0x35, 0x6C, 0x37, 0x66, 0xC8, 0x4A, 0x27, 0xDF, 0x6D, 0xEC, 0xCE, 0x46,
-    0xBF, 0xC0, 0x1A, 0x89, 0x7F, 0xDA, 0x67, 0x32, 0xA9, 0x26, 0x55, 0xB4, 0x08, 0xF4, 0x17, 0x32,
-    0xFC, 0xD7, 0x72, 0xB3, 0xE0, 0xBD, 0xDB, 0x1F, 0x54, 0x59, 0xEE, 0x60, 0xAB, 0x03, 0xD9, 0xAE,
-    0xD6, 0xD5, 0x50, 0x8F, 0xB5, 0x6D, 0xBE, 0x78, 0x6F, 0x39, 0xB9, 0x57, 0xBB, 0x9A, 0xD7, 0x18,
-    0x1E, 0xBD, 0x22, 0x9D, 0xBF, 0x91, 0xE4, 0xB4, 0x51, 0x66, 0xAA, 0xD1, 0xEC, 0xEA, 0x2F, 0x0E,
-    0xEE, 0xAA, 0x59, 0x36, 0x93, 0xBD, 0x95, 0xF2, 0x77, 0x09, 0x6E, 0xBF, 0xF7, 0xC5, 0x2A, 0x62,
-    0x8D, 0xA9, 0x4A, 0xB0, 0xC8, 0x38, 0xA5, 0xE7, 0x86, 0x1F, 0x84, 0x43, 0xB8, 0x7E, 0xC0, 0x92,
-    0x02, 0xC8, 0x8E, 0x9D, 0xAF, 0x69, 0x9B, 0x4F, 0xF6, 0x87, 0x5C, 0xCC, 0x1B, 0x88, 0xD7, 0x5B,
-    0x80, 0xDC, 0x4C, 0x57, 0x55, 0x52, 0x8E, 0x25, 0x63, 0x2D, 0x89, 0x34, 0xA1, 0x83, 0x87, 0x57,
-    0x17, 0x1A, 0x86, 0x12, 0xE5, 0xBA, 0x06, 0x35, 0xB2, 0x10, 0x1E, 0xB8, 0x82, 0x2E, 0x4D, 0xBC,
-    0x9B, 0xAC, 0xC7, 0x04, 0xA6, 0x3D, 0x59, 0x65, 0x75, 0x08, 0xBF, 0x7D, 0xF9, 0x3F, 0x6A, 0xA1,
-    0x01, 0x5B, 0x03, 0xF8, 0xC6, 0xDA, 0x44, 0xE7, 0xAA, 0xC2, 0x8A, 0xC6, 0xB2, 0xFC, 0xAF, 0xC2,
-    0xE2, 0x2E, 0xF7, 0x01, 0x3D, 0x36, 0x8F, 0xC5, 0x06, 0x5E, 0xAD, 0xAA, 0x0A, 0xF6, 0x02, 0x82,
-    0x75, 0x4D, 0x33, 0x15, 0x7B, 0x66, 0xA1, 0x8C, 0x62, 0x6F, 0xA6, 0x15, 0x16, 0x58, 0x8A, 0x6B,
-    0xAD, 0xCE, 0x42, 0x4C, 0x55, 0x8A, 0x15, 0x74, 0x91, 0x69, 0xB3, 0x80, 0x89, 0xD6, 0xE9, 0x50,
-    0x86, 0x4D, 0xB3, 0x5D, 0x65, 0x10, 0xED, 0x2A, 0xA3, 0x57, 0x13, 0x61, 0x65, 0xF1, 0x95, 0x31,
-    0x7F, 0x02, 0xC2, 0xEB, 0x77, 0xCD, 0x81, 0x1D, 0x52, 0xF2, 0xA2, 0xCC, 0x9D, 0xB5, 0xB4, 0xE4,
-    0x40, 0x65, 0x23, 0xD6, 0xD8, 0x4A, 0x11, 0x7D, 0xE3, 0x2E, 0xC2, 0xF9, 0xD5, 0xDA, 0xD3, 0xBA,
-    0xEC, 0xEA, 0x57, 0xDB, 0xA4, 0x2B, 0xED, 0x39, 0x74, 0xE5, 0x19, 0xC5, 0x87, 0x63, 0x10, 0x16,
-    0xEC, 0x22, 0x89, 0xAB, 0x0E, 0xD3, 0xF5, 0x01, 0x3F, 0x56, 0x3C, 0x31, 0x5B, 0x40, 0xA3, 0x9E,
-    0x47, 0xD6, 0xC1, 0xBA, 0x6B, 0xE3, 0xE6, 0xAF, 0x9F, 0x17, 0xC6, 0xFF, 0x4F, 0xFE, 0x67, 0x89,
-    0x40, 0xBE, 0x6D, 0x4D, 0x37, 0x36, 0x95, 0xE6, 0x75, 0x95, 0x67, 0x4E, 0xF8, 0xA9, 0x16, 0x2B,
-    0x46, 0x5A, 0x87, 0x5C, 0x63, 0x65, 0x5A, 0x77, 0xF6, 0xC2, 0x89, 0x01, 0x3E, 0xD5, 0xDF, 0x58,
-    0xC2, 0x6E, 0x0B, 0xCA, 0x1D, 0xF2, 0x5C, 0x3F, 0xDF, 0xCC, 0xC7, 0x78, 0x9C, 0x45, 0x96, 0x51,
-    0x81, 0x77, 0x0D, 0xD8, 0xD5, 0x4F, 0x8A, 0x47, 0xB9, 0x60, 0xF5, 0x51, 0x35, 0x04, 0xC7, 0xDE,
-    0xE1, 0xA2, 0x62, 0x2A, 0x22, 0x7F, 0xF3, 0xA3, 0xDD, 0x2C, 0xD3, 0x10, 0xE7, 0x1B, 0x20, 0x81,
-    0x9D, 0x4F, 0x84, 0xEA, 0xF4, 0x6A, 0xA3, 0x4B, 0x71, 0x55, 0x0F, 0x5E, 0x6E, 0x39, 0x97, 0x63,
-    0xF1, 0x22, 0x2B, 0x7C, 0x60, 0xA0, 0xB8, 0x62, 0x57, 0x59, 0xA2, 0x5F, 0xDB, 0x32, 0x8B, 0x36,
-    0x67, 0x1A, 0xA3, 0xDB, 0xB3, 0x59, 0x5D, 0x2B, 0x09, 0xA0, 0xB7, 0x79, 0xAF, 0x59, 0x22, 0xDC,
-    0xC5, 0x96, 0x09, 0xEA, 0xE2, 0x6E, 0x51, 0x21, 0x20, 0x8C, 0x79, 0xCD, 0x2F, 0x4E, 0xDE, 0x34,
-    0xAC, 0xF2, 0x28, 0x60, 0xBE, 0x99, 0x59, 0xFD, 0x54, 0x7E, 0x2E, 0xCA, 0x11, 0x96, 0x87, 0xDA,
-    0x3E, 0x36, 0x68, 0xF5, 0xB1, 0x16, 0x0F, 0x13, 0xEA, 0x03, 0xD4, 0x42, 0x22, 0x67, 0xD4, 0xE2,
-    0x35, 0xE7, 0x84, 0x64, 0xFC, 0xD4, 0x7E, 0xC0, 0xEB, 0x1C, 0x09, 0xEF, 0xB1, 0x4D, 0xDF, 0x21,
-    0xF9, 0xF5, 0xAB, 0xEB, 0x03, 0xE9, 0x3D, 0x8B, 0xF0, 0x9E, 0x53, 0x27, 0x22, 0x7B, 0x40, 0x9D,
-    0x88, 0xF6, 0xC4, 0xEF, 0x42, 0xB4, 0x03, 0xFC, 0xC4, 0x75, 0x22, 0x04, 0x5F, 0x3B, 0x90, 0x6A,
-    0x0E, 0xB0, 0x65, 0xBF, 0xEA, 0x9D, 0x4C, 0x56, 0x42, 0x26, 0xB7, 0xA3, 0x55, 0x24, 0x6E, 0xF6,
-    0x55, 0x24, 0xCA, 0xCD, 0x2A, 0x12, 0xF6, 0xD6, 0xC1, 0x00, 0x36, 0xAA, 0x48, 0xE0, 0x64, 0x5E,
-    0xE6, 0x9D, 0x52, 0x0C, 0xFB, 0xFF, 0xF7, 0x2A, 0x1A, 0x8F, 0x67, 0x05, 0x3D, 0x55, 0x1C, 0xF5,
-    0x2B, 0x68, 0x7A, 0xDE, 0x0A, 0x7A, 0x82, 0x18, 0x7C, 0x30, 0x73, 0x7D, 0xCA, 0xBF, 0x43, 0xF2,
-    0x05, 0x11, 0xB6, 0x16, 0x26, 0xFE, 0xAE, 0x10, 0x37, 0x33, 0x3F, 0x86, 0x99, 0xC7, 0x58, 0x0F,
-    0xF8, 0xF9, 0xC9, 0x5B, 0xEC, 0xB2, 0xA5, 0xE3, 0xA8, 0xD9, 0x44, 0xC1, 0xB3, 0xF9, 0x7B, 0x5D,
-    0x60, 0x4D, 0x2C, 0xBE, 0xAB, 0xE0, 0x59, 0xAA, 0x38, 0xD9, 0xAB, 0x20, 0x14, 0x6F, 0x55, 0x37,
-    0x0F, 0xD3, 0xB7, 0x4F, 0xDB, 0x97, 0xCF, 0xE8, 0x4F, 0xA1, 0x51, 0x42, 0x5E, 0x84, 0x7D, 0x7D,
-    0x96, 0x1F, 0xFB, 0xF9, 0xF1, 0x81, 0x3F, 0x0B, 0x15, 0xF2, 0x9F, 0x7F, 0xF9, 0x4D, 0xC3, 0x24,
-    0x1B, 0x58, 0x02, 0x28, 0xC5, 0x2F, 0x60, 0xC9, 0x76, 0xEB, 0xD1, 0x46, 0x46, 0xF5, 0xB3, 0x8D,
-    0x6A, 0x07, 0xB5, 0x81, 0x7C, 0xA8, 0x06, 0x34, 0xE6, 0x44, 0x7F, 0x28, 0x28, 0xB8, 0x0E, 0x42,
-    0xF8, 0xA7, 0x1B, 0xBF, 0xAB, 0x7D, 0x1A, 0xBE, 0xF9, 0x53, 0xB6, 0x0F, 0xC2, 0x77, 0xF8, 0x10,
-    0xF8, 0x0E, 0x86, 0x0C, 0x33, 0x0C, 0xFF, 0x95, 0x01, 0xDF, 0x3A, 0x31, 0xC6, 0x6A, 0xEE, 0x23,
-    0x45, 0xB6, 0x05, 0xF1, 0xFA, 0x8E, 0x57, 0x9E, 0xAC, 0x9B, 0xF0, 0x74, 0x7E, 0x60, 0x0D, 0x64,
-    0xDC, 0xEB, 0xB3, 0xD8, 0xAA, 0x6B, 0x1B, 0x63, 0x7A, 0x5C, 0xF5, 0xFA, 0x0B, 0x35, 0xE6, 0x3C,
-    0xD6, 0x04, 0xCB, 0xEE, 0x0D, 0x43, 0x53, 0x7E, 0x57, 0x1F, 0x4F, 0xE7, 0x5C, 0x1D, 0xFA, 0xAB,
-    0x1F, 0x4B, 0xBC, 0x26, 0x3F, 0xBA, 0x50, 0x92, 0xE5, 0x16, 0x2A, 0xC4, 0xC9, 0xCB, 0x3D, 0xF1,
-    0x32, 0x83, 0xD2, 0xAF, 0x2A, 0x7F, 0x40, 0x73, 0x85, 0x57, 0xBE, 0x74, 0x1A, 0x69, 0x7A, 0xD6,
-    0x7E, 0x75, 0xEC, 0x98, 0x5D, 0x87, 0x3B, 0x31, 0x7F, 0xED, 0xB4, 0x91, 0x7F, 0x9A, 0x15, 0xFE,
-    0x3F, 0xBD, 0x7C, 0x56, 0xD4, 0xE6, 0xD1, 0xE4, 0x9F, 0xEE, 0xB4, 0x4D, 0xC0, 0x6F, 0x53, 0x5B,
-    0x89, 0xD4, 0x79, 0xF3, 0x93, 0xA6, 0xBC, 0x7E, 0xA4, 0xDD, 0xB1, 0xCB, 0xF5, 0x4A, 0x1C, 0xB1,
-    0x0D, 0x34, 0x6E, 0x59, 0xFE, 0xF8, 0xD3, 0x8B, 0x2E, 0x6D, 0xCF, 0x8C, 0x2E, 0x65, 0xE4, 0x5F,
-    0x97, 0x32, 0xBA, 0x34, 0x5D, 0x15, 0x76, 0x58, 0x87, 0xB1, 0x5A, 0x49, 0x08, 0x69, 0x03, 0x90,
-    0xA1, 0x3F, 0xDE, 0xE8, 0xD2, 0x36, 0x3D, 0x37, 0xBA, 0x74, 0xD6, 0x7B, 0x2C, 0x38, 0xEF, 0x6F,
-    0x30, 0x11, 0x7A, 0x1E, 0xDB, 0x5F, 0xED, 0x0C, 0x4F, 0xF9, 0xD5, 0xCE, 0xC5, 0xF1, 0x5F, 0xED,
-    0x84, 0x13, 0xB3, 0x02, 0x98, 0x7D, 0xEE, 0x5E, 0xF7, 0xFE, 0x1D, 0xFB, 0xAB, 0x9D, 0xEF, 0x6C,
-    0xFC, 0x6A, 0x67, 0xBB, 0xF9, 0xAB, 0x9D, 0x95, 0x2A, 0x50, 0x2C, 0x86, 0x6E, 0x7F, 0xB5, 0xF3,
-    0x02, 0x93, 0xBE, 0x74, 0x7B, 0x39, 0xD6, 0x1F, 0x6B, 0x0E, 0xD5, 0x37, 0x30, 0x4C, 0x7A, 0xF7,
-    0xC4, 0xA4, 0xF1, 0x00, 0x32, 0xD6, 0x51, 0xCE, 0xFF, 0x2F, 0xD5, 0x5B, 0xBD, 0x8F, 0xDC, 0xD6,
-    0x11, 0x1F, 0x92, 0xB7, 0x47, 0x47, 0x04, 0xC4, 0x14, 0x3A, 0x40, 0xD1, 0x21, 0x5A, 0x17, 0x29,
-    0x6C, 0x43, 0x3A, 0xB6, 0x29, 0xA4, 0x23, 0x0D, 0x03, 0x69, 0x73, 0x85, 0xA2, 0x14, 0x01, 0xA2,
-    0x26, 0x85, 0x83, 0x20, 0xBE, 0xC6, 0x85, 0x11, 0x48, 0xBB, 0x54, 0x1A, 0x17, 0x29, 0x22, 0x20,
-    0x70, 0x95, 0xC2, 0x2A, 0x5C, 0xD8, 0xEB, 0xC2, 0x2A, 0x54, 0x1C, 0x10, 0xDD, 0x2D, 0x13, 0x15,
-    0x69, 0x99, 0xFC, 0x03, 0x61, 0x00, 0xBB, 0x71, 0xE3, 0x85, 0xB1, 0x41, 0xB8, 0x32, 0x77, 0x5F,
-    0x7E, 0x33, 0xF3, 0xF8, 0x71, 0x67, 0x5B, 0x16, 0x82, 0xBB, 0xDD, 0xDB, 0xD5, 0xBD, 0xE1, 0x2E,
-    0x3F, 0x1E, 0xE7, 0xFD, 0x66, 0xDE, 0x7C, 0xBD, 0x27, 0xA2, 0x98, 0xF8, 0x13, 0xA7, 0x4C, 0xC7,
-    0x19, 0x53, 0x93, 0x83, 0x38, 0xFF, 0x2D, 0x40, 0xBD, 0x2F, 0x27, 0x4C, 0xFF, 0x3D, 0x05, 0x0D,
-    0xF2, 0x0A, 0x34, 0xCC, 0x0E, 0x41, 0xFB, 0xE9, 0x00, 0x34, 0x92, 0x87, 0x63, 0x8A, 0x12, 0xA2,
-    0x43, 0x5C, 0x21, 0xAA, 0x98, 0x3A, 0xC6, 0x98, 0x82, 0x5C, 0xD0, 0x09, 0x79, 0xCF, 0x46, 0x1F,
-    0x4F, 0xC9, 0x2F, 0xC8, 0x29, 0xED, 0x0D, 0x7D, 0xD0, 0x23, 0x79, 0x24, 0xD6, 0xC7, 0x93, 0x81,
-    0x74, 0xA8, 0x9D, 0xD3, 0xB1, 0xCF, 0x55, 0xE5, 0x2D, 0x69, 0xE9, 0xD5, 0xFA, 0xD2, 0xD0, 0x24,
-    0x3E, 0x5E, 0xE3, 0x7D, 0xB6, 0x3D, 0x75, 0xC8, 0x2D, 0x89, 0xBB, 0xAE, 0xDB, 0xE6, 0xC7, 0x15,
-    0xDE, 0x5E, 0x85, 0xCF, 0x7E, 0x56, 0x61, 0x5C, 0xD5, 0x10, 0xE7, 0x06, 0xD2, 0x1C, 0x7C, 0xF7,
-    0x70, 0x2E, 0xAA, 0xFA, 0x66, 0x7E, 0xD7, 0x37, 0xC5, 0x5D, 0xDA, 0xB2, 0xFD, 0xB9, 0x18, 0xB4,
-    0x3F, 0xD1, 0xC6, 0xDF, 0xE9, 0x96, 0x9C, 0x36, 0xC2, 0xD1, 0x2F, 0x18, 0x0B, 0x72, 0x26, 0x72,
-    0xA3, 0xD0, 0x88, 0x6F, 0xA1, 0x5D, 0xB9, 0xE7, 0x86, 0xD0, 0x8D, 0x0E, 0xDF, 0xE7, 0x0C, 0xD3,
-    0x1E, 0x2E, 0xF4, 0x01, 0x51, 0xEF, 0x08, 0xBF, 0x77, 0x94, 0x6F, 0x17, 0xD7, 0x3C, 0x30, 0xE5,
-    0xE1, 0x51, 0x27, 0x39, 0x13, 0x4C, 0xDF, 0x14, 0xCA, 0xDD, 0x6C, 0x09, 0x68, 0xE3, 0xBF, 0x03,
-    0x10, 0xC7, 0x30, 0x06, 0xBE, 0x8C, 0x3E, 0x4C, 0x6E, 0x0A, 0x70, 0x1B, 0xE7, 0x16, 0x39, 0xFB,
-    0x91, 0x6F, 0x31, 0x2B, 0xC7, 0x5D, 0x5C, 0xAC, 0x1E, 0x02, 0x41, 0xBE, 0xAD, 0x0C, 0x53, 0xE8,
-    0x8A, 0x7B, 0x4C, 0x69, 0x81, 0x21, 0x31, 0x88, 0xC4, 0x28, 0x92, 0x85, 0x51, 0x30, 0x6C, 0x08,
-    0xA0, 0x64, 0x7E, 0xC0, 0x1D, 0xC0, 0xE4, 0xB1, 0x56, 0xC4, 0x70, 0xD2, 0x40, 0x89, 0xC3, 0x3F,
-    0x3D, 0xBE, 0x10, 0x81, 0x3F, 0x60, 0x4A, 0x02, 0xAA, 0xA0, 0x7A, 0x41, 0x24, 0x15, 0xE4, 0xAA,
-    0x88, 0x82, 0xF3, 0x81, 0xC0, 0xB4, 0x76, 0xB0, 0xF2, 0xD9, 0x3E, 0xAE, 0xFB, 0x7F, 0xAD, 0xC8,
-    0xF9, 0x93, 0xC1, 0xE9, 0x7F, 0xA5, 0xB4, 0xEB, 0x15, 0xF4, 0x18, 0xFF, 0xEA, 0x4F, 0xDF, 0xE4,
-    0x78, 0x4F, 0x49, 0xB3, 0x9F, 0xCC, 0x29, 0xA1, 0x23, 0xFB, 0x98, 0x36, 0x67, 0x64, 0x68, 0x6C,
-    0x8C, 0xB7, 0x78, 0x6F, 0x18, 0x16, 0x14, 0xE3, 0x8D, 0x71, 0x3F, 0x95, 0x36, 0xC4, 0x77, 0x13,
-    0x16, 0x81, 0x81, 0x1C, 0xEE, 0x38, 0xA6, 0xEC, 0xCB, 0x04, 0xA8, 0xC1, 0x0B, 0x65, 0xFE, 0xDA,
-    0x97, 0x3C, 0x62, 0xE5, 0xF4, 0x19, 0x8A, 0xF1, 0xBB, 0x0C, 0xA9, 0xA0, 0xE2, 0xFF, 0x93, 0x91,
-    0xE8, 0xD3, 0xDD, 0xF5, 0x50, 0xCE, 0x39, 0x93, 0x3B, 0xA2, 0x17, 0x62, 0x99, 0x58, 0x4D, 0xDF,
-    0xC6, 0x0D, 0xD5, 0xCB, 0x78, 0x62, 0x68, 0xD5, 0xD4, 0xC9, 0xC5, 0xA8, 0x2D, 0x49, 0x4D, 0xC9,
-    0xFD, 0x94, 0x79, 0x09, 0xCD, 0x5B, 0x6C, 0xB2, 0xFB, 0xDC, 0xE3, 0x65, 0xE7, 0x21, 0x5F, 0x50,
-    0xD3, 0x30, 0x6C, 0x55, 0xD6, 0x5B, 0x13, 0x95, 0xBD, 0x04, 0x05, 0x34, 0xF7, 0x73, 0xE7, 0x2B,
-    0x93, 0x79, 0xD9, 0x58, 0x0D, 0x26, 0xFB, 0x8A, 0x10, 0xD7, 0xE3, 0x81, 0x80, 0x7C, 0xCC, 0x14,
-    0x9C, 0xAA, 0x2D, 0x7D, 0x8D, 0x1A, 0x14, 0x2C, 0x6A, 0x5F, 0x0A, 0x6A, 0x29, 0x8F, 0xF9, 0x3A,
-    0x54, 0xF5, 0xC4, 0x67, 0x0D, 0x7D, 0xBA, 0x0B, 0xF5, 0x08, 0x01, 0x53, 0x04, 0x75, 0x1E, 0xC4,
-    0x89, 0x53, 0x06, 0x99, 0x97, 0x3B, 0x05, 0x9D, 0xA5, 0xBF, 0x0F, 0x26, 0xDA, 0x44, 0x6C, 0xCE,
-    0x07, 0x7C, 0xDA, 0x13, 0xEB, 0x10, 0x08, 0xCF, 0x02, 0xEB, 0x45, 0x61, 0x2F, 0x4C, 0xD8, 0xC9,
-    0xFB, 0xA6, 0x6C, 0x24, 0x70, 0x9E, 0xFD, 0x7D, 0xC3, 0xD3, 0x13, 0x09, 0x5A, 0x9C, 0xFB, 0xF7,
-    0x53, 0x27, 0x87, 0xA3, 0x9F, 0xED, 0xC3, 0x38, 0xC2, 0xD4, 0x06, 0x9F, 0xD2, 0x99, 0xE0, 0xEA,
-    0x3E, 0x68, 0x03, 0x24, 0x3A, 0x10, 0x7A, 0x5D, 0x31, 0xFC, 0xE1, 0x5A, 0x62, 0x78, 0x4F, 0xCD,
-    0x29, 0x05, 0xE9, 0xF2, 0x30, 0xA4, 0xDF, 0x49, 0x97, 0xBF, 0x11, 0x0E, 0x3C, 0xA1, 0x7E, 0xD6,
-    0x22, 0xB9, 0xB1, 0x7E, 0x48, 0x3A, 0xA4, 0xB3, 0x8C, 0xDE, 0x41, 0xFB, 0xB1, 0xE8, 0x87, 0xF3,
-    0x7B, 0xA0, 0x59, 0x08, 0x9A, 0x99, 0xA0, 0x79, 0xE1, 0xAC, 0x34, 0xB2, 0xB8, 0x20, 0x7E, 0xE8,
-    0x97, 0x27, 0xFD, 0x90, 0x35, 0x45, 0x82, 0xA6, 0x38, 0xFA, 0x40, 0xD0, 0x74, 0xCF, 0x3D, 0x9A,
-    0x1B, 0xF0, 0x43, 0xE3, 0xB4, 0x60, 0x3F, 0xE4, 0x66, 0x43, 0xB1, 0x9F, 0x4E, 0xEA, 0x2C, 0x47,
-    0x37, 0x7F, 0x40, 0x82, 0xA6, 0x5A, 0xC4, 0xCF, 0x39, 0xEE, 0xF0, 0x0C, 0x8F, 0x9C, 0xDE, 0x4A,
-    0xD7, 0xDF, 0x03, 0x39, 0x29, 0x3D, 0x70, 0x0A, 0xB8, 0x85, 0xC5, 0x27, 0x99, 0x84, 0x47, 0x67,
-    0xA5, 0x93, 0x32, 0xA5, 0x01, 0x4C, 0x98, 0x6B, 0xC3, 0x77, 0xC4, 0xB1, 0x39, 0x0F, 0x0F, 0x2D,
-    0xAF, 0x8E, 0x75, 0x7E, 0xBC, 0x99, 0xD1, 0x28, 0xC5, 0x3D, 0x19, 0xB7, 0xE7, 0xDD, 0xC7, 0x6D,
-    0x31, 0x1A, 0x3D, 0xB0, 0x7D, 0xB6, 0x5E, 0x34, 0x64, 0x7C, 0x53, 0x6D, 0x61, 0x7D, 0x32, 0x5A,
-    0x00, 0x04, 0x89, 0x05, 0x67, 0xDB, 0x25, 0xB3, 0x04, 0x38, 0x53, 0x45, 0x53, 0xC0, 0x04, 0x19,
-    0x8D, 0xC6, 0x14, 0xA3, 0x27, 0xFE, 0x36, 0x52, 0xE1, 0xC6, 0x0D, 0x7C, 0x8C, 0x3D, 0x85, 0x92,
-    0x7F, 0xCC, 0x5F, 0xFF, 0x2D, 0x0B, 0x0A, 0xAA, 0x11, 0x89, 0x66, 0xDC, 0x6A, 0xDE, 0xCC, 0x12,
-    0x17, 0xE0, 0x34, 0xD2, 0x9C, 0xD8, 0x58, 0x70, 0x8C, 0xC7, 0x6E, 0x4F, 0x6D, 0x9A, 0x38, 0x55,
-    0x43, 0xC1, 0x69, 0x41, 0xD8, 0xCE, 0xC2, 0x33, 0x07, 0xC7, 0xD9, 0x63, 0x3D, 0x5C, 0x80, 0xF4,
-    0xF6, 0x13, 0x09, 0xAB, 0xC4, 0xC6, 0xF2, 0xAB, 0x59, 0x2F, 0x44, 0xC3, 0x05, 0xC2, 0x64, 0x49,
-    0x88, 0xED, 0x51, 0x1A, 0xCC, 0xBD, 0xAC, 0x6F, 0xBE, 0xC8, 0xAE, 0x07, 0x86, 0x5E, 0xA1, 0x0F,
-    0x1B, 0x18, 0xCF, 0x1C, 0x8C, 0x4B, 0xF4, 0x23, 0xF0, 0x93, 0xBE, 0x8D, 0xA9, 0xFD, 0x6C, 0x42,
-    0xFE, 0x7D, 0x9C, 0xF2, 0xE9, 0x4A, 0xD2, 0x9D, 0x3F, 0x67, 0xAE, 0x2F, 0xAF, 0x0A, 0x63, 0x5B,
-    0x08, 0x5D, 0x86, 0x4F, 0x91, 0xCA, 0x61, 0xBE, 0x4F, 0xF0, 0x9E, 0x74, 0x07, 0x1A, 0xD1, 0x5B,
-    0x0E, 0x0A, 0xDD, 0xBC, 0x1F, 0xEA, 0xE8, 0x4D, 0x91, 0x9E, 0x84, 0xF3, 0x5F, 0x81, 0x4D, 0x4E,
-    0xA8, 0x9E, 0x20, 0x3E, 0x74, 0x8A, 0x4E, 0x70, 0x7A, 0xE6, 0xA0, 0xBC, 0x69, 0x8B, 0x4D, 0xFD,
-    0x64, 0x8F, 0xBC, 0xA7, 0x15, 0xBB, 0x34, 0x3C, 0x07, 0xF6, 0x0E, 0xDC, 0x02, 0x6A, 0xF9, 0x7D,
-    0x09, 0x5A, 0xF1, 0x48, 0x68, 0xCC, 0x22, 0xE4, 0x63, 0xA6, 0xCC, 0x7F, 0x63, 0x7B, 0x36, 0xFA,
-    0x30, 0x64, 0x83, 0xC5, 0xED, 0x79, 0xF7, 0x71, 0xFB, 0x7C, 0xF4, 0x91, 0xED, 0x73, 0x21, 0xC3,
-    0x7C, 0xD2, 0x70, 0x1D, 0xBE, 0x81, 0x29, 0xEB, 0xFE, 0x81, 0xBD, 0x40, 0xB4, 0x0F, 0x72, 0x97,
-    0x83, 0xE6, 0xA5, 0x82, 0x82, 0x14, 0x15, 0x37, 0x05, 0x53, 0x0D, 0x2B, 0x10, 0x5E, 0x6C, 0x79,
-    0x05, 0x34, 0x26, 0x15, 0x8D, 0x29, 0x56, 0xA3, 0x31, 0x6D, 0x32, 0xEE, 0x27, 0x36, 0x19, 0x9F,
-    0x1E, 0x4B, 0xC6, 0x0F, 0x24, 0x19, 0x77, 0xF2, 0xE5, 0xC1, 0xE4, 0x4E, 0x7D, 0xE8, 0xC6, 0x1D,
-    0x0A, 0xFB, 0x73, 0x7A, 0x89, 0xB3, 0x1C, 0x46, 0x24, 0xC6, 0x23, 0xAB, 0x98, 0x58, 0x1B, 0x30,
-    0x6E, 0x34, 0xCE, 0xC1, 0xEB, 0x57, 0x08, 0x08, 0x10, 0xC1, 0xD4, 0x91, 0x83, 0x27, 0x09, 0x2D,
-    0xDF, 0x1F, 0x77, 0xA6, 0xD8, 0x12, 0x61, 0x92, 0xF2, 0x50, 0x9C, 0x0B, 0x2C, 0xEE, 0xB4, 0x42,
-    0x60, 0x12, 0x23, 0x71, 0x09, 0xD2, 0xA5, 0x59, 0xDE, 0x6F, 0xF3, 0xD1, 0x9C, 0x19, 0x53, 0xC0,
-    0xFE, 0xB1, 0xCF, 0xDA, 0x35, 0xE0, 0x20, 0xA7, 0x0C, 0x00, 0x5E, 0xAE, 0x05, 0xE9, 0x15, 0xBB,
-    0x71, 0xBF, 0x84, 0x76, 0x89, 0xBF, 0xC4, 0x5F, 0xC4, 0x65, 0x21, 0xD8, 0x00, 0x15, 0xDC, 0xD8,
-    0xA4, 0x63, 0x93, 0xF9, 0x33, 0xCE, 0xAA, 0xFF, 0x9F, 0xBF, 0x29, 0x7A, 0xC8, 0xF0, 0x77, 0x8B,
-    0x4C, 0xF6, 0xE7, 0x89, 0x33, 0x71, 0x27, 0xFD, 0x7C, 0x97, 0xAE, 0x49, 0x60, 0xB0, 0x2B, 0x83,
-    0x7A, 0xFE, 0xBF, 0xD3, 0x7A, 0xBF, 0x0E, 0x1D, 0xC3, 0xC2, 0x19, 0xFC, 0xE1, 0xCB, 0x65, 0x1A,
-    0xE2, 0xDF, 0xAE, 0x05, 0xE5, 0x45, 0x78, 0xD1, 0x14, 0x8E, 0x9F, 0xBA, 0x5E, 0x63, 0xB9, 0x69,
-    0x66, 0x12, 0x5A, 0xF2, 0x44, 0x30, 0x9F, 0x8D, 0x4B, 0x86, 0xD2, 0x9D, 0x8B, 0x08, 0x86, 0x14,
-    0x65, 0xAC, 0x01, 0xB1, 0x38, 0x21, 0x9E, 0x10, 0x61, 0xCE, 0xE5, 0xCF, 0xA0, 0x98, 0x4B, 0xDD,
-    0x49, 0x62, 0xEF, 0x49, 0xD5, 0xA1, 0xF3, 0x86, 0xFA, 0x13, 0xBD, 0x53, 0x9F, 0xD2, 0x1E, 0x62,
-    0xD1, 0xA7, 0x7E, 0xCE, 0x3D, 0x43, 0x95, 0x9C, 0x05, 0xDE, 0xF8, 0xDE, 0x7E, 0x29, 0x5A, 0x5D,
-    0xB0, 0xEB, 0x10, 0xEB, 0xDE, 0xEB, 0x68, 0x93, 0x46, 0x87, 0x51, 0xDA, 0xD2, 0xB0, 0xD5, 0x34,
-    0x93, 0xB2, 0x7A, 0x00, 0x8C, 0xF9, 0xCF, 0x85, 0xDF, 0x21, 0x2B, 0x4F, 0x94, 0x42, 0xD3, 0xF0,
-    0x2A, 0xB2, 0x84, 0x5F, 0x1D, 0x34, 0x44, 0x7E, 0x86, 0x99, 0xDC, 0x22, 0x37, 0xCB, 0x63, 0xDE,
-    0x6C, 0x73, 0xAE, 0x5D, 0x49, 0xA7, 0x1C, 0xFA, 0x3C, 0x27, 0x60, 0xB4, 0xF9, 0xC4, 0x70, 0xDA,
-    0x2C, 0x2C, 0xD8, 0x32, 0x83, 0xC6, 0x68, 0x61, 0xDE, 0xB2, 0xD9, 0x32, 0x7B, 0x4E, 0x61, 0x96,
-    0xA0, 0xD3, 0xE3, 0xDF, 0xCE, 0x7E, 0x5A, 0x97, 0x9C, 0xC4, 0xDA, 0x70, 0xD0, 0x49, 0xD3, 0x66,
-    0xCC, 0x7B, 0xCB, 0x43, 0xFD, 0xD5, 0xC6, 0xC5, 0xF7, 0x04, 0xD1, 0xF8, 0x29, 0x33, 0x65, 0x26,
-    0xCD, 0xF8, 0x83, 0x74, 0x47, 0xE2, 0x72, 0x87, 0xD6, 0x42, 0x87, 0xFD, 0x42, 0xA3, 0x79, 0xB7,
-    0xDC, 0xE1, 0x00, 0xFF, 0x15, 0xD8, 0xB8, 0x4F, 0x60, 0xE9, 0xEE, 0x71, 0xC1, 0xFF, 0xA1, 0xD4,
-    0xFE, 0x97, 0xA4, 0xD2, 0x9B, 0x69, 0x5B, 0x5B, 0xA4, 0xA9, 0xB0, 0x78, 0x23, 0x16, 0x6D, 0x15,
-    0x70, 0xDD, 0x0E, 0xB8, 0xBD, 0xB5, 0x00, 0x77, 0x60, 0x57, 0x1A, 0x70, 0xE5, 0x6F, 0xE8, 0xDE,
-    0x79, 0x97, 0x2F, 0xF7, 0xDF, 0x47, 0x27, 0x37, 0x19, 0xDC, 0x47, 0xCB, 0x04, 0xD7, 0xC6, 0x81,
-    0x36, 0x12, 0xAC, 0x97, 0x63, 0xB9, 0xD8, 0xC4, 0xF1, 0x20, 0x6B, 0x71, 0xBA, 0xD6, 0x5A, 0xCC,
-    0x7D, 0xD0, 0x76, 0x5A, 0x97, 0x03, 0x91, 0x8E, 0xB8, 0xE5, 0x35, 0xD6, 0xE7, 0xCB, 0x2B, 0xD3,
-    0x67, 0x89, 0x29, 0xB9, 0x02, 0xF9, 0x3E, 0x8F, 0x69, 0x9B, 0xC7, 0xFA, 0x3D, 0xFA, 0xA0, 0x65,
-    0x3C, 0xCE, 0x68, 0x3D, 0x21, 0xEF, 0x71, 0x2A, 0x15, 0x17, 0x80, 0xF2, 0x2F, 0xCC, 0x7D, 0x11,
-    0xD5, 0xA5, 0x23, 0x71, 0x42, 0xBE, 0x68, 0x39, 0x43, 0x7E, 0x73, 0xF9, 0x90, 0xDB, 0x24, 0xBC,
-    0x0B, 0xED, 0x7F, 0x04, 0x5A, 0x19, 0xE5, 0x55, 0x0A, 0x92, 0xE3, 0x55, 0xAE, 0x75, 0x8C, 0x2E,
-    0x64, 0x0D, 0xC6, 0x9B, 0x93, 0xE6, 0xB7, 0x14, 0xFD, 0x14, 0x6C, 0x1E, 0xC2, 0x6C, 0x22, 0xE2,
-    0x3A, 0x58, 0xAA, 0x41, 0xF9, 0xB6, 0x00, 0x84, 0x7E, 0xAD, 0xA1, 0x60, 0xD5, 0xE6, 0x2C, 0xF5,
-    0x72, 0xBC, 0x94, 0xAD, 0xEA, 0x3A, 0x3D, 0x75, 0x06, 0x8C, 0xF1, 0xB1, 0x2C, 0xF0, 0x62, 0x16,
-    0x46, 0xAC, 0xD2, 0x18, 0x88, 0x38, 0x78, 0x71, 0xB5, 0x90, 0x22, 0x18, 0x0B, 0x04, 0x30, 0x2A,
-    0x9E, 0xA4, 0xE0, 0x92, 0x22, 0x4D, 0x0A, 0x7B, 0x7D, 0x50, 0x81, 0xD4, 0x87, 0xE3, 0xD7, 0xEC,
-    0x03, 0xF6, 0x71, 0xDB, 0x99, 0x4A, 0x87, 0x54, 0x3C, 0x56, 0x3E, 0xB5, 0x80, 0x24, 0xAB, 0xA1,
-    0x46, 0x44, 0x35, 0xCB, 0x9B, 0xB2, 0x90, 0xD3, 0xCF, 0xDB, 0x0A, 0xE9, 0x61, 0x1B, 0x66, 0xB9,
-    0x39, 0xBD, 0xD6, 0xA9, 0x9D, 0xC6, 0x82, 0xDC, 0x80, 0x53, 0x0F, 0x64, 0x4D, 0x10, 0x08, 0xB0,
-    0x64, 0x68, 0x33, 0x15, 0x09, 0x09, 0xE0, 0x14, 0x53, 0x4D, 0x85, 0xAF, 0xE0, 0x6B, 0x14, 0x57,
-    0xF5, 0x4E, 0xE4, 0x2C, 0x78, 0x0A, 0xB7, 0x81, 0x59, 0x6F, 0x06, 0x8D, 0xB5, 0xE2, 0xB1, 0xF2,
-    0x51, 0x01, 0xB9, 0x5A, 0xC4, 0xF7, 0xCA, 0x4E, 0xD6, 0x5D, 0x17, 0x9D, 0xB5, 0x7E, 0x67, 0x57,
-    0xF5, 0xD6, 0x5B, 0x10, 0xBA, 0xEE, 0xAB, 0x46, 0x48, 0xA3, 0x5B, 0x1B, 0x43, 0x94, 0x56, 0xD5,
-    0x56, 0x2E, 0x88, 0xBA, 0xA2, 0x3D, 0xD6, 0x39, 0x70, 0xDB, 0x66, 0xA4, 0xD3, 0xEE, 0x61, 0xBB,
-    0xE8, 0xCE, 0x0F, 0xBB, 0x83, 0x6B, 0x63, 0x8D, 0xC5, 0x22, 0xB1, 0x3B, 0x05, 0xA2, 0x75, 0xBD,
-    0x7D, 0xD5, 0xB9, 0xA4, 0xA5, 0x47, 0xED, 0x5C, 0x81, 0xE1, 0x62, 0x11, 0x25, 0xAB, 0x14, 0x91,
-    0xB3, 0xE7, 0x48, 0x82, 0x31, 0xD7, 0xF0, 0xC1, 0x7C, 0xC1, 0xBF, 0x6E, 0x70, 0xCE, 0xCE, 0x75,
-    0xB3, 0x83, 0xB5, 0x9F, 0x24, 0x5B, 0xC8, 0xC6, 0x59, 0x01, 0x6F, 0xF0, 0xE8, 0x17, 0x25, 0x6F,
-    0x6B, 0x1B, 0x43, 0x0D, 0xBD, 0x34, 0x48, 0x57, 0x3F, 0x3D, 0xD6, 0xDA, 0x0D, 0xD8, 0xCF, 0x45,
-    0xEA, 0x78, 0xEB, 0xFA, 0x70, 0xB1, 0xBE, 0x7A, 0x2E, 0x30, 0xAE, 0xFD, 0xB3, 0xBA, 0x6A, 0xA5,
-    0x72, 0xA6, 0x22, 0x29, 0xE6, 0x9D, 0x3A, 0xF1, 0x38, 0x0C, 0xF2, 0x26, 0x8C, 0x64, 0x81, 0x90,
-    0x2C, 0xCA, 0xC2, 0xD9, 0x6D, 0x93, 0x78, 0x52, 0x33, 0x1B, 0x4A, 0x31, 0xAF, 0xAD, 0x99, 0x71,
-    0x94, 0xC8, 0xDB, 0x2D, 0x95, 0xF0, 0xCF, 0x81, 0x6E, 0x20, 0x8C, 0x5F, 0xB0, 0x0D, 0xD1, 0xC6,
-    0xC0, 0xC5, 0xC4, 0x89, 0x6B, 0xA2, 0x62, 0xDB, 0x84, 0xC6, 0xC4, 0xAE, 0x29, 0xA3, 0x46, 0x50,
-    0x27, 0xD6, 0x13, 0xD5, 0x31, 0x7A, 0xA6, 0x59, 0xCD, 0x0A, 0xB2, 0xDA, 0x00, 0xCF, 0x1B, 0xAC,
-    0xEA, 0xE2, 0xE1, 0x6A, 0x21, 0x7A, 0xC1, 0xBD, 0xA9, 0xA7, 0x8B, 0x98, 0xC6, 0x37, 0xD6, 0xA5,
-    0xDA, 0xAA, 0x92, 0xE6, 0xB4, 0xB5, 0x6B, 0xED, 0xEC, 0x96, 0xDB, 0xAA, 0x83, 0x0B, 0x19, 0x98,
-    0x3D, 0x0C, 0x6A, 0xD8, 0xF8, 0x00, 0x95, 0x94, 0x43, 0x26, 0x87, 0xD2, 0x42, 0x7A, 0x8A, 0x07,
-    0xF6, 0xFA, 0x47, 0x7A, 0x88, 0x65, 0x6A, 0xB3, 0xA1, 0x60, 0x5B, 0x21, 0x90, 0xB2, 0xA4, 0xCD,
-    0x5C, 0x97, 0xA9, 0xD5, 0xD5, 0x5A, 0xDD, 0xBB, 0x92, 0xB6, 0x53, 0x53, 0x9D, 0x92, 0x0C, 0x4E,
-    0xB2, 0x62, 0x56, 0x13, 0x85, 0xC1, 0x96, 0xCD, 0xB2, 0x7B, 0x80, 0x38, 0xCC, 0x18, 0x40, 0x59,
-    0x3C, 0x8F, 0x17, 0x8C, 0x48, 0x3C, 0x15, 0x4A, 0x2F, 0x4A, 0x87, 0x42, 0xC7, 0xF2, 0x93, 0x97,
-    0xA8, 0x00, 0x3F, 0x98, 0x85, 0x00, 0x38, 0xA4, 0x37, 0x31, 0xA3, 0x54, 0x46, 0x6D, 0x7C, 0x93,
-    0x74, 0x02, 0x9C, 0x5A, 0x1C, 0x36, 0xC4, 0xD1, 0x7D, 0x88, 0xDD, 0x78, 0x7A, 0x6D, 0x05, 0xF1,
-    0x91, 0x86, 0x48, 0x1D, 0xF3, 0xA9, 0x5B, 0x12, 0xBC, 0x7A, 0x2B, 0xEA, 0xCA, 0x05, 0xE1, 0xCD,
-    0xF4, 0xA0, 0x66, 0xD5, 0xEE, 0x7F, 0xB3, 0x1B, 0x8F, 0xD8, 0x0A, 0xF3, 0x67, 0x71, 0x2C, 0xB4,
-    0x7B, 0xB4, 0xC6, 0xF2, 0xD0, 0xED, 0xC0, 0xB2, 0xD8, 0xA4, 0x76, 0xC7, 0xEE, 0xF5, 0x13, 0xFB,
-    0x63, 0xAD, 0xB4, 0x4E, 0x12, 0x58, 0x20, 0xC8, 0x06, 0x36, 0x68, 0x85, 0xB2, 0xE9, 0xD1, 0x4B,
-    0x1A, 0x61, 0x5F, 0x93, 0xED, 0x5E, 0x8B, 0x27, 0x62, 0x9E, 0xC6, 0x92, 0x9E, 0xA6, 0x17, 0xD2,
-    0xB5, 0x9F, 0x1D, 0x97, 0xE8, 0x65, 0x1E, 0x57, 0xFA, 0x88, 0x74, 0xCF, 0x01, 0x05, 0xAF, 0x73,
-    0x30, 0x12, 0xC0, 0x3A, 0xAC, 0x7C, 0x5E, 0xAC, 0xB7, 0xFD, 0xB7, 0x9F, 0xC7, 0xDD, 0x9A, 0x85,
-    0x3D, 0xB4, 0x9B, 0xEC, 0xCF, 0x05, 0xC6, 0x1A, 0xB5, 0x34, 0x6C, 0xE4, 0xED, 0x99, 0x2B, 0xCD,
-    0xD2, 0x24, 0x0F, 0x5B, 0x00, 0xB1, 0xBB, 0x10, 0x76, 0xBA, 0x63, 0x3C, 0x64, 0xE7, 0xC6, 0x51,
-    0xE2, 0x04, 0xEE, 0x2E, 0x28, 0x60, 0x5F, 0xC3, 0x0C, 0x0F, 0x44, 0x29, 0x30, 0x8B, 0x59, 0x26,
-    0x87, 0x0C, 0x24, 0xC6, 0x7E, 0xC4, 0x45, 0x9B, 0x98, 0x77, 0x6E, 0xF7, 0xFF, 0xC8, 0x01, 0x13,
-    0x67, 0x43, 0xBE, 0x69, 0xD6, 0x62, 0xAA, 0xAF, 0x6D, 0x83, 0xFF, 0x0E, 0x22, 0x05, 0xA1, 0x61,
-    0xE3, 0xC5, 0xA4, 0x16, 0xA4, 0x3B, 0x60, 0xDF, 0x39, 0xC1, 0x9F, 0xEC, 0x6E, 0x8B, 0x92, 0xD8,
-    0xEE, 0x6D, 0x1B, 0xB0, 0x13, 0x90, 0xFD, 0x6D, 0x15, 0xF9, 0x05, 0x3C, 0xB3, 0x37, 0xF1, 0x78,
-    0xE5, 0x99, 0x85, 0xCC, 0xCB, 0xBB, 0x24, 0x9B, 0x33, 0xEE, 0x71, 0xF8, 0x16, 0xF3, 0x92, 0x6F,
-    0x24, 0x71, 0xFC, 0x51, 0x6D, 0xB8, 0xFC, 0xAA, 0x2E, 0x40, 0x89, 0x17, 0x91, 0xA5, 0x0E, 0x79,
-    0xB9, 0xFE, 0x5F, 0x15, 0x3C, 0x70, 0x9B, 0x07, 0x34, 0xAE, 0xEA, 0xE4, 0x7C, 0x65, 0x08, 0x9D,
-    0xD0, 0x44, 0xE9, 0x40, 0x7B, 0x79, 0xBC, 0x2C, 0x5C, 0xFE, 0x01, 0x1A, 0x3E, 0xC5, 0xC4, 0x8C,
-    0xDF, 0x28, 0x81, 0x0B, 0xB2, 0xF2, 0x16, 0x17, 0x72, 0x67, 0x8D, 0xE7, 0x13, 0xBF, 0xA7, 0x69,
-    0x72, 0x56, 0x7B, 0xBC, 0xC7, 0x75, 0x08, 0xBF, 0x52, 0x35, 0x13, 0x97, 0x25, 0x03, 0xEC, 0x8D,
-    0x1B, 0x7F, 0xC5, 0x73, 0xC8, 0x99, 0xCB, 0x36, 0xD7, 0x26, 0x64, 0x4D, 0xCE, 0x8D, 0xC2, 0xA9,
-    0xE3, 0x1A, 0x16, 0x08, 0xE0, 0xD8, 0x69, 0x39, 0xC5, 0x70, 0x4A, 0x6E, 0x66, 0x43, 0xEF, 0x15,
-    0xC3, 0xF9, 0xDD, 0xBB, 0xDC, 0x56, 0x8F, 0xDF, 0xFF, 0x00, 0xB5, 0x58, 0xBD, 0x6F, 0xDC, 0xC8,
-    0x15, 0x7F, 0x24, 0x25, 0x33, 0xB9, 0x4D, 0x8E, 0x2A, 0xA4, 0x00, 0x67, 0xC0, 0xC7, 0xC6, 0x45,
-    0xCE, 0xB1, 0x96, 0x4D, 0x8A, 0x2B, 0xB4, 0xCB, 0xB1, 0x53, 0xA4, 0xDD, 0xC2, 0x82, 0x0B, 0x03,
-    0x49, 0xCA, 0x20, 0x01, 0x72, 0x8D, 0x0B, 0x17, 0xAB, 0xE5, 0xC4, 0xFE, 0x07, 0x04, 0x1C, 0x9C,
-    0x26, 0x8D, 0x1A, 0x03, 0x39, 0xA7, 0xB0, 0x0A, 0x03, 0xD1, 0x25, 0x2B, 0x93, 0xB6, 0x81, 0xA4,
-    0x65, 0x2E, 0x48, 0x9A, 0x34, 0xCC, 0xC7, 0x35, 0xA9, 0x26, 0x07, 0x02, 0x21, 0x0E, 0xD4, 0x32,
-    0xBF, 0xF7, 0x86, 0x5C, 0xED, 0xCA, 0xB2, 0x2D, 0x9D, 0x70, 0x5C, 0xCE, 0x70, 0x86, 0x7C, 0x5F,
-    0xF3, 0xE6, 0x7D, 0xCD, 0x52, 0x46, 0x64, 0x88, 0xB6, 0x28, 0x6D, 0x68, 0x7F, 0x8B, 0xF6, 0xF6,
-    0x69, 0x2F, 0xA3, 0x3D, 0xFA, 0xEA, 0xF7, 0x88, 0x88, 0x32, 0xF2, 0x34, 0x05, 0x44, 0x71, 0xA3,
-    0xDF, 0xF5, 0xB4, 0x77, 0x5F, 0xD3, 0x0B, 0x4D, 0xEE, 0x05, 0x6E, 0x47, 0x81, 0x6A, 0xDA, 0x28,
-    0xDC, 0xDB, 0xDB, 0x74, 0x62, 0xCC, 0xB3, 0xA6, 0xD1, 0xD2, 0x6D, 0x6C, 0xB7, 0xEF, 0x30, 0x2B,
-    0xB9, 0x61, 0x3E, 0x22, 0x3A, 0x06, 0xC3, 0x55, 0x77, 0xCF, 0x6D, 0x7B, 0xDD, 0x7A, 0xDB, 0xF7,
-    0x35, 0x1A, 0x1D, 0x38, 0xE6, 0xEB, 0xBE, 0x5B, 0x21, 0x62, 0x30, 0xE6, 0xD6, 0x09, 0x75, 0xED,
-    0xF1, 0xE3, 0xDF, 0xF0, 0x1C, 0x2B, 0xBB, 0xE5, 0xE6, 0x7E, 0xD6, 0xCB, 0x02, 0x1D, 0xAA, 0x58,
-    0xC5, 0x94, 0xD0, 0x06, 0x05, 0x79, 0x90, 0x85, 0x59, 0xA4, 0x23, 0x8A, 0x69, 0x40, 0x63, 0x5A,
-    0x23, 0xCC, 0xB2, 0x08, 0x5F, 0x63, 0xDA, 0xA1, 0x29, 0x1D, 0x60, 0x3F, 0x26, 0x80, 0x8C, 0x29,
-    0x52, 0xA1, 0x0E, 0x80, 0xED, 0xE5, 0x8E, 0x72, 0xB3, 0x4D, 0x3F, 0x1B, 0xF4, 0xB2, 0x69, 0xA0,
-    0xEB, 0xF0, 0x46, 0x15, 0xBB, 0x65, 0xEC, 0x99, 0xC4, 0x37, 0x1B, 0xCE, 0x28, 0xC8, 0x0F, 0x83,
-    0xEC, 0x28, 0xCC, 0xEA, 0xE8, 0x46, 0x15, 0xB9, 0xE5, 0xD0, 0x33, 0x03, 0xAF, 0x18, 0xFB, 0xD9,
-    0x9A, 0xA3, 0xF8, 0xE5, 0xF3, 0x3A, 0xBA, 0x59, 0xC5, 0x1E, 0xC3, 0xEF, 0x78, 0xC5, 0xD4, 0xCF,
-    0x0E, 0x7A, 0x7A, 0xB4, 0x4A, 0x13, 0xDF, 0x24, 0x9E, 0xC1, 0xFB, 0xE8, 0x66, 0x19, 0xEA, 0x0A,
-    0x64, 0x7B, 0xD9, 0xD8, 0xCB, 0x06, 0x8E, 0x5A, 0x87, 0x90, 0x58, 0x54, 0xDB, 0x86, 0x6D, 0xDB,
-    0xB4, 0x6D, 0xF6, 0xEC, 0x49, 0x06, 0x45, 0x67, 0xBF, 0xFF, 0xC5, 0xCF, 0xB3, 0xEE, 0xDD, 0x52,
-    0x1B, 0x9E, 0xD2, 0xE2, 0xD7, 0xB4, 0x8D, 0x13, 0xF3, 0xBE, 0x6D, 0x0F, 0xFB, 0x1B, 0x9A, 0x79,
-    0x70, 0x13, 0x9A, 0xFD, 0x53, 0x70, 0x87, 0xF6, 0xFD, 0xAD, 0xCD, 0x55, 0xD5, 0xC1, 0xAA, 0x2B,
-    0xA4, 0x04, 0xF6, 0x24, 0x4F, 0x15, 0x56, 0xF1, 0x51, 0xD2, 0xF0, 0x2F, 0x9E, 0xC5, 0x47, 0xBD,
-    0x92, 0xC4, 0xEE, 0x0F, 0x61, 0x3F, 0x39, 0xA5, 0xB5, 0x98, 0xE6, 0x11, 0xA5, 0x05, 0x3D, 0x23,
-    0xDA, 0x6F, 0x37, 0x71, 0x48, 0xA9, 0x4A, 0x55, 0x42, 0xEB, 0x76, 0x8B, 0x29, 0xD0, 0xA9, 0x8A,
-    0xF2, 0x54, 0x47, 0x79, 0x82, 0x0D, 0x5B, 0xA1, 0xD5, 0x6E, 0xF3, 0x29, 0xD4, 0xBD, 0x3C, 0x55,
-    0x71, 0x16, 0x98, 0x54, 0x73, 0x9F, 0x50, 0x94, 0x05, 0x05, 0x43, 0xB0, 0x0F, 0xC4, 0x4C, 0x47,
-    0x27, 0xB4, 0x62, 0xCD, 0x95, 0xE9, 0xEF, 0x5D, 0xF8, 0x1E, 0xB5, 0x76, 0xA7, 0xD9, 0x6B, 0xDD,
-    0x0B, 0xDF, 0x8E, 0x6A, 0x96, 0x2E, 0x57, 0x9F, 0xED, 0xC7, 0x78, 0x9F, 0x6F, 0xE7, 0xC4, 0xBF,
-    0x82, 0xCE, 0x87, 0xB7, 0x7D, 0x87, 0x7C, 0xF9, 0xF5, 0xCE, 0x83, 0x47, 0xF3, 0xCB, 0x9D, 0x11,
-    0x05, 0x32, 0x0F, 0x60, 0x25, 0x91, 0xBC, 0x8B, 0x7E, 0x50, 0xC0, 0xA5, 0x64, 0xF7, 0xE0, 0x9C,
-    0x53, 0x19, 0x0D, 0x10, 0x2B, 0x4B, 0x19, 0x8D, 0xA9, 0xF4, 0x4C, 0x37, 0xF2, 0xB3, 0x6E, 0x14,
-    0xE8, 0x6E, 0x14, 0x5A, 0xCA, 0x5B, 0x54, 0x0E, 0x2F, 0xED, 0xD2, 0x25, 0x4D, 0x03, 0xC7, 0x4C,
-    0xE3, 0x9A, 0x92, 0x8A, 0xFA, 0xAE, 0x29, 0x9F, 0xA5, 0x34, 0x3B, 0xA4, 0xF0, 0xD7, 0x9F, 0x99,
-    0x32, 0xB8, 0x69, 0x22, 0x08, 0xFE, 0xE0, 0xCF, 0x26, 0x78, 0x50, 0x04, 0xE4, 0x7C, 0x1A, 0xBC,
-    0x30, 0xBD, 0x97, 0x39, 0xCB, 0x13, 0xBA, 0x85, 0xFF, 0x32, 0x63, 0xA2, 0x43, 0xAF, 0xF0, 0xFF,
-    0x24, 0xA3, 0xF1, 0x7C, 0x54, 0x75, 0x5F, 0x5D, 0xE3, 0xB6, 0x18, 0xF0, 0x6E, 0xA6, 0x02, 0xE6,
-    0xBD, 0x8C, 0xAA, 0xF0, 0x86, 0x89, 0x65, 0x61, 0xC9, 0x8C, 0x9A, 0x23, 0x31, 0xDF, 0xB0, 0xA2,
-    0xD8, 0xAE, 0x00, 0xEB, 0x77, 0x68, 0xF9, 0x62, 0x35, 0xF4, 0x74, 0x3B, 0x61, 0x4D, 0x84, 0xDD,
-    0x97, 0xE8, 0x87, 0x85, 0x38, 0x82, 0xD5, 0x87, 0x6B, 0xB0, 0xC2, 0xF6, 0xDA, 0x81, 0x42, 0xAA,
-    0x6E, 0x32, 0x86, 0x4C, 0x66, 0x61, 0xE2, 0xE5, 0x0B, 0x93, 0x5E, 0xB6, 0x30, 0x09, 0xD4, 0xF1,
-    0xA4, 0x1C, 0x3A, 0xD0, 0x90, 0xDC, 0x03, 0xA7, 0x1C, 0x47, 0x33, 0x8A, 0x8F, 0x28, 0xA9, 0x29,
-    0x76, 0x4D, 0x95, 0xC0, 0xE0, 0xA1, 0xAA, 0x19, 0x54, 0xF5, 0x0F, 0x53, 0x07, 0x59, 0x15, 0xDE,
-    0x2F, 0x59, 0x5B, 0x2F, 0x8B, 0xD2, 0x7F, 0x8E, 0x45, 0x9B, 0x40, 0x3B, 0x9F, 0xF6, 0x9E, 0x1B,
-    0xEF, 0x33, 0xE3, 0xBF, 0x2C, 0x58, 0x2B, 0xC1, 0x0D, 0xE3, 0xFD, 0x0B, 0x93, 0x9C, 0xF9, 0x45,
-    0x0E, 0x26, 0x85, 0xFF, 0x17, 0x99, 0x0C, 0x16, 0x27, 0x35, 0x26, 0xFF, 0x6C, 0xC1, 0x1C, 0xE3,
-    0x94, 0x20, 0xD0, 0x13, 0x02, 0x5E, 0x41, 0x15, 0x48, 0x63, 0x13, 0x20, 0x23, 0x76, 0x76, 0xCA,
-    0x4C, 0x6F, 0x80, 0x29, 0xBC, 0x16, 0x5E, 0xA2, 0x92, 0x86, 0x1A, 0xE8, 0x89, 0xE7, 0x47, 0x14,
-    0xD6, 0x14, 0xB5, 0xAB, 0x57, 0xA2, 0x51, 0xC5, 0x1A, 0xA9, 0x5D, 0xE3, 0x15, 0x08, 0xD4, 0xAA,
-    0x8F, 0xFD, 0xBF, 0x8B, 0x37, 0xE0, 0x51, 0x07, 0xDA, 0xC5, 0x3E, 0x7B, 0xC5, 0x00, 0x5B, 0x33,
-    0xC5, 0xA6, 0x18, 0xD8, 0x41, 0x41, 0x5B, 0x5E, 0x46, 0x77, 0x7B, 0x4A, 0x60, 0xA6, 0x00, 0xFA,
-    0x25, 0x14, 0x18, 0x79, 0x40, 0x1F, 0xF8, 0xB9, 0x04, 0x68, 0x00, 0x86, 0x0C, 0x39, 0x60, 0xD0,
-    0x31, 0xC3, 0xEE, 0x83, 0x03, 0x02, 0x85, 0x0A, 0x10, 0xCB, 0x5D, 0xB6, 0xC7, 0x31, 0x5D, 0xDF,
-    0x61, 0xD9, 0xC0, 0x25, 0x84, 0xD1, 0x06, 0xCF, 0x0D, 0xEC, 0xE0, 0x00, 0x56, 0xB1, 0x45, 0x54,
-    0x22, 0x84, 0x8D, 0x91, 0x8A, 0xAF, 0xFB, 0x7A, 0x27, 0xB8, 0x6F, 0x18, 0xA8, 0x62, 0xA8, 0x29,
-    0x83, 0x0D, 0x19, 0x2E, 0x64, 0x40, 0xEC, 0x7A, 0xD9, 0x87, 0x28, 0xE3, 0xC0, 0x29, 0x18, 0x76,
-    0x9F, 0xBE, 0x49, 0xB2, 0x46, 0x8A, 0x21, 0xDB, 0xEF, 0xA0, 0xAF, 0x2F, 0x72, 0x72, 0x73, 0x10,
-    0xCE, 0x9E, 0x52, 0x4F, 0x6D, 0x21, 0xBB, 0x6F, 0xE2, 0x17, 0x60, 0x7D, 0x10, 0x7E, 0x45, 0xA2,
-    0x64, 0x4D, 0x6E, 0x49, 0xBD, 0x02, 0x21, 0x0C, 0x09, 0x87, 0xA3, 0x1F, 0x50, 0x83, 0x9C, 0xE0,
-    0x26, 0x0E, 0xB2, 0xD9, 0x04, 0x32, 0xB0, 0x9A, 0x56, 0x44, 0xFA, 0x20, 0xF3, 0x8D, 0x53, 0x01,
-    0x28, 0xA1, 0xDA, 0x2B, 0x7B, 0x79, 0xA4, 0x27, 0xF6, 0xB3, 0xBD, 0x56, 0x98, 0x94, 0x03, 0xFE,
-    0x5E, 0x05, 0x4D, 0x85, 0x19, 0x1E, 0x31, 0x01, 0xA3, 0x00, 0x13, 0x26, 0xC6, 0xAE, 0x07, 0x1E,
-    0x01, 0xE4, 0x0A, 0x33, 0x89, 0xCA, 0xBE, 0x21, 0x4E, 0x99, 0x4E, 0x6D, 0xBD, 0x32, 0xE1, 0x4F,
-    0xEF, 0x51, 0xD8, 0xD0, 0x3B, 0xC8, 0x85, 0x7E, 0x0D, 0xB0, 0x44, 0x79, 0xFC, 0x00, 0xEF, 0x46,
-    0x10, 0xE3, 0x50, 0xEC, 0xB1, 0xF6, 0x19, 0xC1, 0x33, 0x4C, 0x96, 0xDF, 0x4F, 0x6C, 0x98, 0xC7,
-    0x22, 0x98, 0xA0, 0x5F, 0x30, 0xAF, 0x11, 0x44, 0x85, 0xB6, 0x4B, 0x7C, 0x14, 0x91, 0x42, 0xF5,
-    0x0D, 0xC2, 0xEC, 0x12, 0xE3, 0x8F, 0x04, 0x7E, 0xC2, 0xA1, 0xB9, 0x6D, 0x49, 0x3B, 0x5F, 0x6C,
-    0x43, 0xC9, 0xCF, 0xDC, 0x86, 0x68, 0xFD, 0x79, 0xDB, 0x92, 0xB6, 0x89, 0xB6, 0x62, 0x83, 0x7A,
-    0x9B, 0x06, 0x26, 0x08, 0xF4, 0x0D, 0xA5, 0xBA, 0x01, 0xB5, 0x14, 0x5F, 0x6C, 0xE2, 0xB8, 0xD4,
-    0x94, 0x5C, 0x1F, 0xD0, 0xB0, 0x8E, 0x60, 0x97, 0x7E, 0x4E, 0x53, 0x18, 0xEB, 0x14, 0x02, 0xDA,
-    0x67, 0x41, 0x63, 0x98, 0xC0, 0x18, 0xA2, 0x8F, 0xA1, 0xFD, 0x09, 0xEC, 0x32, 0x81, 0xFF, 0x25,
-    0xCA, 0xE6, 0xB0, 0x41, 0xDB, 0x16, 0xAF, 0xEF, 0x72, 0x1A, 0x41, 0x6B, 0x48, 0x36, 0x88, 0xD9,
-    0xA0, 0xDE, 0x78, 0xBC, 0x0B, 0x26, 0x8D, 0xE1, 0xD1, 0xDE, 0x55, 0xBC, 0xFD, 0x16, 0xEC, 0x88,
-    0xAE, 0xC3, 0x88, 0xE8, 0x29, 0xFC, 0xC1, 0x2D, 0xA0, 0x8D, 0x90, 0x5D, 0xE1, 0x88, 0x25, 0xDA,
-    0xC5, 0x6B, 0x2E, 0xB9, 0x42, 0xC8, 0x46, 0xE9, 0xC3, 0x94, 0xFD, 0x07, 0x55, 0x0A, 0x98, 0x9A,
-    0x2B, 0x78, 0xFD, 0x21, 0xE3, 0x5E, 0x59, 0x93, 0x3D, 0xE5, 0x34, 0xD7, 0xE7, 0x90, 0x48, 0xF7,
-    0x60, 0x98, 0xF0, 0x3A, 0x58, 0x14, 0x0C, 0x8A, 0x43, 0x0E, 0x88, 0xBF, 0x2F, 0x5F, 0x10, 0x57,
-    0x8E, 0x58, 0x1E, 0xF7, 0xEF, 0xCA, 0x7B, 0x99, 0xF5, 0xEE, 0x67, 0x30, 0xC8, 0xF7, 0xC9, 0x0C,
-    0xE8, 0xDE, 0x98, 0x3F, 0xDB, 0x34, 0xDF, 0x69, 0xE9, 0xD5, 0x51, 0xF4, 0xCA, 0xC8, 0x81, 0x13,
-    0xFE, 0x44, 0x46, 0xDE, 0xEC, 0x47, 0xA1, 0x0D, 0x4E, 0x1E, 0x96, 0xD7, 0x06, 0xC1, 0x9F, 0x35,
-    0xFF, 0xD9, 0xED, 0xCA, 0xBF, 0x2E, 0x3E, 0x39, 0xFF, 0x2B, 0xDA, 0x91, 0xF7, 0x45, 0xD9, 0x45,
-    0xC3, 0xBC, 0xAB, 0xC8, 0xA2, 0x2C, 0x6D, 0x47, 0xA1, 0xB6, 0x21, 0xD1, 0x19, 0x39, 0x28, 0xBC,
-    0x46, 0xD6, 0x0A, 0x89, 0x4D, 0x97, 0x58, 0x0B, 0x8B, 0x23, 0x29, 0xEF, 0x24, 0x1A, 0xF2, 0xE8,
-    0xAA, 0x97, 0xAF, 0xD2, 0xBA, 0x63, 0x5C, 0x8A, 0x3F, 0xFE, 0x5B, 0x43, 0xD1, 0xBF, 0xFF, 0x8B,
-    0xE2, 0x00, 0x32, 0x51, 0xC4, 0x35, 0xEC, 0xE5, 0x74, 0xF6, 0x88, 0xBE, 0xF3, 0xA4, 0xF9, 0x04,
-    0xEE, 0xC3, 0x04, 0x7C, 0xE6, 0x1C, 0x71, 0x02, 0x0A, 0x98, 0xF3, 0x0E, 0xAF, 0x36, 0x12, 0xFB,
-    0x8C, 0xD0, 0x4D, 0xD8, 0xC5, 0x2A, 0x74, 0x62, 0xC9, 0xC8, 0x03, 0x3C, 0x62, 0x9E, 0x6B, 0x1C,
-    0xDD, 0xD7, 0x1D, 0x3A, 0x59, 0x2E, 0x8B, 0x14, 0x12, 0x8B, 0x25, 0x06, 0x0F, 0x6D, 0x0C, 0x26,
-    0x92, 0xC4, 0x26, 0xD1, 0x5B, 0xD2, 0x99, 0x64, 0xB2, 0x88, 0x3A, 0xA3, 0x99, 0xCE, 0x17, 0x51,
-    0xBC, 0x06, 0xBD, 0xEA, 0xD0, 0x85, 0x81, 0xA0, 0x87, 0x73, 0x74, 0xAE, 0x96, 0x26, 0x9F, 0xEC,
-    0xD0, 0xAB, 0xBF, 0xC9, 0x36, 0x7F, 0x3B, 0xED, 0xCB, 0x8E, 0x60, 0x6D, 0x6C, 0x23, 0xE6, 0xE2,
-    0xBE, 0x96, 0x2A, 0xD4, 0xB0, 0x6F, 0xB8, 0x37, 0x12, 0x65, 0x21, 0xDF, 0x0C, 0x86, 0xDB, 0x82,
-    0x6D, 0x6C, 0x77, 0xA6, 0xC2, 0x6E, 0xF5, 0x11, 0x07, 0xF6, 0xC6, 0x87, 0xD9, 0xC7, 0x8F, 0xD2,
-    0x07, 0x5F, 0xDE, 0xA9, 0xAF, 0x52, 0xF0, 0x42, 0xB1, 0x2D, 0xC2, 0xCD, 0xD8, 0x37, 0x78, 0xDD,
-    0x43, 0x09, 0x08, 0xFC, 0x60, 0x2D, 0x1F, 0xDA, 0x00, 0x54, 0x4B, 0xA0, 0x43, 0x38, 0x70, 0x00,
-    0x1C, 0xE6, 0xE4, 0x97, 0xE2, 0x73, 0xFC, 0xC9, 0xA6, 0x5C, 0x8E, 0x48, 0x03, 0xAB, 0x96, 0xB1,
-    0x55, 0x6E, 0xFB, 0x58, 0x27, 0x5A, 0x2C, 0x42, 0xBA, 0x7C, 0x2A, 0x1C, 0xE1, 0x91, 0x81, 0x99,
-    0x3F, 0xB8, 0x3C, 0x29, 0x96, 0x11, 0x58, 0x68, 0x54, 0xF6, 0x30, 0x1A, 0xC4, 0x9C, 0x47, 0xA9,
-    0x4E, 0x09, 0x12, 0x67, 0x09, 0x6F, 0x5F, 0x3E, 0x91, 0x7D, 0xE2, 0xDE, 0x97, 0xBE, 0x27, 0x6F,
-    0x82, 0x4C, 0x4A, 0x59, 0x05, 0x59, 0x20, 0x2A, 0x7A, 0x48, 0x3A, 0x90, 0x35, 0x0C, 0x44, 0xCE,
-    0x81, 0xDC, 0xD6, 0x07, 0xE7, 0xFD, 0x3A, 0x2D, 0xC4, 0xA5, 0x4E, 0xC0, 0x89, 0x08, 0x36, 0xBF,
-    0x67, 0x12, 0x44, 0xD6, 0xA9, 0x8D, 0x52, 0xA0, 0xF5, 0x51, 0xA3, 0x63, 0x8F, 0x75, 0xE9, 0xCD,
-    0xEE, 0xD4, 0x31, 0x64, 0x3E, 0x92, 0xEA, 0x79, 0xB9, 0x9B, 0x70, 0x57, 0xB3, 0x82, 0x2A, 0xAE,
-    0x52, 0x0A, 0x48, 0x17, 0xEB, 0x3E, 0x6B, 0xAD, 0xCF, 0x9E, 0xD3, 0x67, 0x95, 0xF7, 0x59, 0x6D,
-    0x9B, 0xDC, 0xAD, 0x2C, 0xEB, 0x2A, 0xE6, 0x9D, 0x48, 0x15, 0x94, 0x93, 0x6A, 0x74, 0x09, 0xF5,
-    0x8C, 0x05, 0xE1, 0xC3, 0x1B, 0x71, 0xDD, 0x49, 0x38, 0xBA, 0x25, 0x73, 0xD3, 0xAD, 0xC8, 0x6E,
-    0x84, 0xEC, 0x9C, 0x6C, 0x8E, 0x35, 0xEE, 0x89, 0xE4, 0x80, 0xCE, 0x57, 0xC5, 0x7F, 0xE5, 0x23,
-    0xFB, 0x97, 0x8D, 0x2B, 0x87, 0x92, 0x56, 0x38, 0xCA, 0xF1, 0x49, 0x11, 0x84, 0x73, 0xFA, 0x32,
-    0x6D, 0x2A, 0x32, 0x11, 0x02, 0x20, 0xBA, 0xE6, 0xB8, 0x53, 0xDC, 0xE9, 0x53, 0x3A, 0xB5, 0x04,
-    0x27, 0x68, 0x42, 0x20, 0x27, 0xC3, 0x47, 0x92, 0x8B, 0x74, 0xF6, 0xFA, 0x1E, 0xC4, 0x72, 0x59,
-    0x36, 0x14, 0xC0, 0xB7, 0xF3, 0x10, 0x55, 0x70, 0x1E, 0x71, 0x17, 0xBF, 0xBD, 0x13, 0xB8, 0x80,
-    0x3B, 0xE0, 0xFE, 0xD6, 0x52, 0xA1, 0xCB, 0x36, 0x09, 0xEC, 0xCA, 0x71, 0x94, 0x06, 0x3F, 0x86,
-    0xE0, 0x5B, 0xF8, 0xAC, 0xB9, 0xCB, 0xE6, 0x5D, 0x3E, 0xEF, 0x8A, 0xE5, 0xE9, 0x31, 0x88, 0x1E,
-    0x3E, 0x01, 0xAE, 0x50, 0x41, 0x3E, 0xD1, 0xD6, 0x80, 0xD9, 0x89, 0xB8, 0xB1, 0x4B, 0xA0, 0x5D,
-    0xF5, 0xB2, 0xD5, 0xE4, 0xE3, 0x3F, 0xCE, 0x78, 0xEB, 0x24, 0xF8, 0x71, 0xD8, 0x8B, 0xB1, 0x6D,
-    0x87, 0x31, 0x34, 0x1F, 0x69, 0xAF, 0x0C, 0x50, 0xE8, 0x20, 0xE6, 0x20, 0xA4, 0xAD, 0xC0, 0x80,
-    0x13, 0x9D, 0xE8, 0x98, 0x4E, 0xBB, 0x70, 0xEC, 0x55, 0x11, 0x8E, 0xB9, 0x28, 0x2F, 0xB8, 0x38,
-    0x2A, 0x38, 0x28, 0x9F, 0x35, 0x39, 0x7D, 0xFD, 0xD7, 0x59, 0x72, 0xE9, 0x05, 0xD5, 0xD3, 0x55,
-    0xF6, 0x17, 0xA5, 0x31, 0x41, 0xEC, 0x4E, 0xF9, 0xD8, 0x0A, 0x77, 0x1F, 0x88, 0x07, 0x95, 0x36,
-    0xFE, 0x73, 0x18, 0xE4, 0xF8, 0xC4, 0x19, 0x80, 0x63, 0x7C, 0x48, 0xC7, 0xD5, 0xC5, 0xD4, 0x66,
-    0x01, 0x01, 0x33, 0x96, 0xF5, 0x31, 0xD8, 0x07, 0x52, 0x1D, 0x0D, 0xD0, 0xA6, 0x5C, 0xBA, 0xB1,
-    0xC6, 0x37, 0x38, 0x65, 0x3A, 0xE4, 0xB2, 0x9D, 0x91, 0xAF, 0x03, 0x4E, 0x7E, 0xC8, 0x2A, 0x91,
-    0xBA, 0xD4, 0x34, 0x0F, 0x9F, 0x71, 0xF4, 0xC1, 0xA0, 0xA2, 0xEF, 0x4B, 0xB4, 0xD3, 0xB6, 0x3C,
-    0x41, 0xE9, 0xCF, 0x5B, 0xF9, 0xAB, 0x14, 0xBA, 0x03, 0x75, 0x6C, 0xA5, 0x63, 0x50, 0x39, 0xD0,
-    0x3D, 0xD6, 0xEB, 0x66, 0xBB, 0x95, 0x77, 0x79, 0x09, 0x07, 0xA0, 0xAD, 0x0F, 0xBE, 0x0D, 0x89,
-    0x0F, 0x60, 0x2C, 0xD5, 0x01, 0x5C, 0x78, 0xF8, 0x07, 0x63, 0xCF, 0x35, 0x1B, 0x77, 0x9A, 0x87,
-    0x23, 0x5B, 0xE4, 0x3C, 0x69, 0x1E, 0xEF, 0xC9, 0x3B, 0x8A, 0xF9, 0x6B, 0x0D, 0x38, 0xCF, 0x00,
-    0xC3, 0xCD, 0x0E, 0xDE, 0xB5, 0x54, 0xDA, 0x6E, 0x7E, 0xF1, 0xDA, 0x38, 0xC8, 0x7B, 0xAC, 0x92,
-    0xDD, 0xD7, 0x6D, 0x36, 0x0B, 0x15, 0xEB, 0xB6, 0xBD, 0xD9, 0x2E, 0x46, 0x96, 0xD6, 0x02, 0x4D,
-    0x1C, 0x06, 0xAA, 0x50, 0x51, 0x1D, 0xDE, 0xC4, 0x01, 0xCE, 0x45, 0x18, 0xCD, 0xA7, 0x58, 0xC7,
-    0x98, 0x6B, 0x77, 0xB4, 0x00, 0x69, 0x16, 0xA7, 0x9C, 0x3E, 0x14, 0x8C, 0xC6, 0xB5, 0xFB, 0x96,
-    0xAF, 0x9F, 0xC2, 0xA6, 0xEE, 0xF6, 0xA8, 0xB8, 0x72, 0x42, 0x52, 0xB2, 0x84, 0x8F, 0x1F, 0xAF,
-    0x17, 0xF9, 0xB5, 0xEB, 0x40, 0xC7, 0xC7, 0x00, 0xAC, 0x25, 0xD6, 0xF6, 0x41, 0xED, 0xC9, 0xE0,
-    0x1C, 0x97, 0x3A, 0x45, 0xA4, 0x76, 0xB6, 0x28, 0x92, 0x50, 0x8D, 0x5A, 0x46, 0x59, 0xCB, 0xF6,
-    0x32, 0x7F, 0x79, 0xE7, 0x5C, 0xEC, 0x4E, 0x5D, 0xBB, 0x5B, 0x9C, 0x8B, 0xC6, 0xAA, 0xED, 0xAC,
-    0x10, 0x4A, 0x44, 0x42, 0xE4, 0xB1, 0x33, 0x3E, 0x1F, 0xC9, 0x21, 0x29, 0x16, 0xB5, 0x44, 0x6F,
-    0x25, 0x76, 0x59, 0x48, 0xC4, 0x6A, 0xA5, 0xF5, 0x14, 0x4E, 0x9B, 0x6D, 0x77, 0xF8, 0x36, 0x5C,
-    0xC6, 0x59, 0x03, 0x63, 0xA7, 0x82, 0x10, 0x5E, 0x8D, 0x91, 0x5B, 0xF3, 0xC6, 0x3C, 0x7D, 0x1B,
-    0xE2, 0x4F, 0x97, 0x19, 0x1D, 0x71, 0xB7, 0x66, 0x6B, 0x56, 0xAB, 0xA5, 0x62, 0xE1, 0xB1, 0xEB,
-    0x15, 0x2E, 0x2A, 0x99, 0xCA, 0x2B, 0xA4, 0xA6, 0xC4, 0x03, 0xA7, 0x9F, 0x52, 0x66, 0x34, 0xF2,
-    0x0A, 0xC9, 0xBF, 0x4B, 0x08, 0x4B, 0x0F, 0xFB, 0xAF, 0xA9, 0x6A, 0x1F, 0xDB, 0xDB, 0xB7, 0x3F,
-    0x97, 0x7A, 0xF3, 0x34, 0x04, 0x05, 0x62, 0x64, 0x49, 0x67, 0xC2, 0x28, 0xB4, 0xFC, 0x70, 0x22,
-    0x73, 0x0A, 0x9C, 0x9C, 0xF5, 0x2B, 0x78, 0xEE, 0x6E, 0x1B, 0xDF, 0xF9, 0x7F, 0xB4, 0x45, 0x77,
-    0x7A, 0x0F, 0xB5, 0x56, 0xAA, 0x13, 0xD5, 0x5F, 0xCA, 0x02, 0xC7, 0xFF, 0x92, 0x75, 0x18, 0x2B,
-    0xA2, 0x45, 0x1C, 0xA6, 0x74, 0x87, 0x7F, 0xAD, 0xC5, 0xFC, 0xE0, 0x04, 0x0E, 0x12, 0xE8, 0x5F,
-    0xED, 0x3F, 0x44, 0x5E, 0x76, 0xCE, 0x7F, 0xAF, 0xEE, 0xE4, 0x3E, 0xFF, 0x8A, 0x73, 0xFD, 0x0B,
-    0x95, 0xCE, 0xE2, 0x3A, 0xAA, 0x02, 0xD3, 0x2B, 0xBC, 0xEC, 0xAC, 0x58, 0xF6, 0xDF, 0x2B, 0x47,
-    0x79, 0x99, 0x9F, 0x07, 0x26, 0x2C, 0xE3, 0x3A, 0x9D, 0x9D, 0x1D, 0xD3, 0xD5, 0xBD, 0xE2, 0xFA,
-    0x87, 0xFB, 0xEF, 0x6E, 0x6D, 0x05, 0xE6, 0xEC, 0x3C, 0xB1, 0x42, 0x7D, 0x5B, 0x7F, 0x15, 0xCD,
-    0xFC, 0x1F, 0xED, 0x53, 0xB1, 0x6E, 0xDB, 0x30, 0x10, 0x7D, 0x94, 0x9A, 0xA8, 0xA8, 0x06, 0x79,
-    0x70, 0x96, 0x0E, 0x55, 0x86, 0xCE, 0xD6, 0xAA, 0x26, 0x92, 0xA5, 0xA0, 0x3F, 0xE0, 0x21, 0xFD,
-    0x83, 0x4C, 0xFE, 0x02, 0x0D, 0x4A, 0x4C, 0xA0, 0x3F, 0x90, 0xDD, 0x4B, 0x87, 0x0E, 0x89, 0x33,
-    0x64, 0x31, 0x50, 0x0F, 0x46, 0x4D, 0xA0, 0x63, 0x17, 0xEE, 0x1D, 0x2A, 0xA0, 0xDD, 0x32, 0x84,
-    0x83, 0x06, 0x21, 0xB0, 0x7B, 0x3D, 0xCA, 0x4E, 0x50, 0x23, 0x40, 0xD1, 0x8E, 0x05, 0xCA, 0x7B,
-    0x20, 0xC8, 0xE3, 0x91, 0xBC, 0x7B, 0x77, 0x87, 0x2E, 0x3C, 0x92, 0xC1, 0x6D, 0x15, 0x09, 0xD3,
-    0x47, 0x93, 0x62, 0x5E, 0xA2, 0x7C, 0x00, 0x6F, 0x59, 0x19, 0x89, 0x9A, 0x0D, 0x5C, 0x92, 0xE8,
-    0x02, 0x49, 0x8C, 0x4E, 0xFC, 0x30, 0x58, 0x01, 0xF8, 0x1A, 0xA1, 0x46, 0xA6, 0xF1, 0x41, 0x8B,
-    0x6F, 0xDA, 0xFD, 0xA4, 0x83, 0xD7, 0xFA, 0x85, 0xAB, 0x13, 0x57, 0x2F, 0x68, 0xC5, 0x80, 0xAB,
-    0x37, 0x68, 0x47, 0x46, 0xEA, 0x6C, 0x22, 0x0B, 0x60, 0x8D, 0x45, 0x83, 0x05, 0xE5, 0x9D, 0x50,
-    0xC1, 0xAD, 0xE0, 0x54, 0x3C, 0xE7, 0x9E, 0xBE, 0xBB, 0x56, 0xF4, 0x03, 0x3B, 0x03, 0x60, 0x27,
-    0x07, 0x19, 0xEF, 0xEE, 0x5D, 0x20, 0xD1, 0x03, 0x52, 0x76, 0x60, 0x21, 0x47, 0x64, 0x46, 0x68,
-    0xD8, 0xBF, 0x04, 0x49, 0x82, 0x32, 0x42, 0x13, 0xDC, 0x18, 0x97, 0x34, 0xBA, 0xEB, 0xF7, 0x97,
-    0x19, 0x35, 0x40, 0x0D, 0x61, 0xEC, 0xA7, 0x9E, 0x02, 0x5F, 0x0E, 0x81, 0x3E, 0x5F, 0x06, 0x66,
-    0xF6, 0xC4, 0x31, 0xF7, 0xEE, 0xD8, 0xF8, 0x55, 0x30, 0x36, 0x11, 0xEA, 0x1E, 0x6A, 0x66, 0x21,
-    0xB8, 0xD1, 0x2E, 0xE5, 0xFE, 0xAD, 0x8E, 0x9C, 0x3A, 0xC5, 0x2C, 0xB1, 0x2C, 0x34, 0xD1, 0xD8,
-    0xF8, 0xA4, 0x70, 0x0C, 0x86, 0x4F, 0x32, 0x1A, 0x57, 0x29, 0xEA, 0x12, 0xB3, 0x96, 0xA6, 0x79,
-    0x5F, 0x2C, 0x43, 0x9A, 0x7B, 0xAB, 0xA2, 0x7D, 0x9D, 0x9F, 0xAE, 0x9E, 0x5D, 0xAB, 0x60, 0xED,
-    0x7F, 0x0E, 0x54, 0x1B, 0x5C, 0xDD, 0x49, 0x22, 0x25, 0xEE, 0xB7, 0x38, 0xC7, 0x64, 0x62, 0x35,
-    0xEC, 0xC5, 0xF0, 0x7E, 0xC1, 0x63, 0x41, 0xAA, 0x5D, 0x7B, 0x32, 0xE0, 0x90, 0xF9, 0x7F, 0x4C,
-    0xD9, 0x63, 0xD3, 0x4A, 0xCD, 0xEB, 0x82, 0x75, 0x29, 0xC7, 0xE3, 0xE7, 0x8E, 0xB4, 0x11, 0xF5,
-    0x10, 0xC0, 0x97, 0xAE, 0x62, 0xD1, 0xCE, 0x46, 0xEC, 0x8E, 0xEF, 0xE7, 0x21, 0x5B, 0x9E, 0xA0,
-    0xB3, 0x87, 0x03, 0xAA, 0xB2, 0xA3, 0x3A, 0x41, 0x91, 0x20, 0x66, 0xC4, 0xDB, 0xE8, 0xA2, 0x8B,
-    0xBF, 0x2D, 0x04, 0x88, 0xA5, 0xBF, 0x1C, 0xCD, 0xCB, 0xB2, 0xC3, 0xE7, 0x8F, 0x64, 0x43, 0x54,
-    0x76, 0x55, 0x3D, 0xE5, 0x2C, 0xB0, 0xE7, 0x3C, 0x33, 0xE9, 0x9C, 0x8B, 0x30, 0xC7, 0x29, 0x44,
-    0x0D, 0x4F, 0xDB, 0x65, 0x46, 0x86, 0x81, 0xD6, 0x3E, 0x24, 0x95, 0x8D, 0x4D, 0xF7, 0xC1, 0xDE,
-    0xD7, 0x1E, 0xE5, 0xCE, 0x75, 0x65, 0xAD, 0xD1, 0x58, 0x88, 0xFA, 0xEC, 0xCA, 0x8C, 0x48, 0x8A,
-    0x63, 0xFC, 0x2F, 0xBC, 0x7F, 0xA0, 0xF0, 0x76, 0x2F, 0x11, 0x91, 0x7C, 0xE2, 0x2A, 0x38, 0x9A,
-    0x11, 0x92, 0x3E, 0x75, 0xB4, 0x61, 0xB8, 0xBA, 0x09, 0x75, 0xD6, 0x68, 0x26, 0x59, 0x5C, 0x22,
-    0x20, 0x99, 0x3A, 0xBA, 0x80, 0x99, 0xC2, 0x10, 0x19, 0xCE, 0xF6, 0x14, 0xB6, 0x86, 0xA2, 0x7C,
-    0xE0, 0x33, 0xB9, 0x6F, 0xD6, 0x36, 0x2A, 0x15, 0xA6, 0x40, 0x31, 0x45, 0x62, 0x5A, 0xB0, 0x43,
-    0xEC, 0x61, 0xCF, 0x61, 0x82, 0x24, 0xB3, 0xF3, 0x12, 0x27, 0x3D, 0x18, 0xAE, 0x00, 0xF7, 0xB3,
-    0x14, 0x04, 0xCC, 0x81, 0x15, 0x9C, 0xAF, 0xF0, 0xDF, 0xAA, 0x50, 0x54, 0x89, 0x25, 0x08, 0xCF,
-    0xDF, 0x63, 0x44, 0xB9, 0x4D, 0x8C, 0x25, 0xC3, 0x0C, 0x27, 0xF6, 0x3B, 0x0E, 0x6F, 0x2A, 0xAA,
-    0xD4, 0xB3, 0xC4, 0x61, 0x80, 0x18, 0xBF, 0x60, 0x98, 0x1F, 0x12, 0xB7, 0xC3, 0xA6, 0x71, 0xE2,
-    0x47, 0x00, 0xB6, 0xED, 0x71, 0x1E, 0x7B, 0x2A, 0x0E, 0x11, 0x97, 0x78, 0x65, 0x90, 0x55, 0xE8,
-    0xCF, 0x90, 0xA4, 0x88, 0x03, 0x58, 0xBD, 0x63, 0x0B, 0x3D, 0xDE, 0x1E, 0xD8, 0x1F, 0x72, 0x74,
-    0x87, 0xF4, 0x85, 0x24, 0x67, 0x93, 0x8B, 0x17, 0xB5, 0xE0, 0xC9, 0x88, 0x2A, 0xFE, 0xED, 0xD4,
-    0x66, 0x6C, 0xFF, 0x0F, 0xFC, 0x6B, 0x6D, 0xAA, 0xD6, 0xC6, 0x96, 0x6D, 0x6C, 0x2B, 0xD7, 0x22,
-    0x45, 0x91, 0x1D, 0x99, 0x03, 0xD2, 0xF1, 0xDE, 0x56, 0x0C, 0xBB, 0x17, 0xCC, 0x11, 0xDA, 0x1E,
-    0xE4, 0x46, 0x45, 0xF8, 0x1D, 0xE2, 0x23, 0x10, 0x30, 0x6B, 0xF9, 0x79, 0x08, 0x6E, 0x2A, 0xCE,
-    0x99, 0x07, 0x1F, 0xE1, 0xC5, 0x62, 0x19, 0x60, 0x4B, 0xA4, 0xB7, 0xC2, 0xF1, 0x4F, 0xAD, 0x58,
-    0x3D, 0x8F, 0xDC, 0xD6, 0x15, 0xBD, 0x24, 0x2D, 0x11, 0x36, 0x0B, 0xBA, 0x88, 0x25, 0xC0, 0x80,
-    0xC5, 0x14, 0x6E, 0x02, 0x24, 0x22, 0x52, 0xA4, 0xDB, 0x1D, 0x32, 0x51, 0x91, 0x32, 0x5B, 0x68,
-    0xE5, 0x62, 0x81, 0x54, 0xAE, 0xB2, 0x08, 0xB6, 0x95, 0x01, 0xED, 0x90, 0x49, 0x7E, 0x40, 0xB6,
-    0xB0, 0x92, 0x32, 0x2A, 0x1C, 0x40, 0x1E, 0x17, 0xAB, 0x42, 0x85, 0x0A, 0xAD, 0x48, 0xD9, 0x45,
-    0x8A, 0x14, 0x61, 0xEC, 0x04, 0x2E, 0x52, 0x88, 0x40, 0x22, 0x28, 0x91, 0x8A, 0x25, 0x12, 0x2A,
-    0xE2, 0xAE, 0xC8, 0x79, 0x39, 0xE7, 0x3E, 0xCE, 0xEC, 0xAC, 0x6C, 0x19, 0x46, 0x92, 0x01, 0x78,
-    0xEE, 0xCC, 0xFB, 0xE2, 0x7B, 0xF7, 0xE3, 0xDC, 0xFB, 0x46, 0x84, 0x9F, 0xE2, 0x48, 0xC4, 0x37,
-    0x73, 0x91, 0xB0, 0xFE, 0xB6, 0x48, 0x92, 0xA2, 0x29, 0x61, 0xFB, 0x2E, 0xE1, 0x2E, 0xA1, 0x97,
-    0xD9, 0x2C, 0xED, 0xC5, 0x98, 0xB2, 0x97, 0xF9, 0x2C, 0x3F, 0x40, 0x83, 0x4C, 0x09, 0x09, 0x21,
-    0x46, 0xAB, 0x84, 0x66, 0x3E, 0x4B, 0x5D, 0x63, 0x4C, 0x2A, 0x67, 0x86, 0x4D, 0x9D, 0xF3, 0x12,
-    0xC0, 0x2A, 0x23, 0x7C, 0xE3, 0x0C, 0x7E, 0xAE, 0x5D, 0x00, 0x5C, 0xBD, 0x08, 0xB8, 0x87, 0x17,
-    0x06, 0xC6, 0xE4, 0x52, 0xA0, 0xD7, 0x35, 0x4D, 0x96, 0xFB, 0x4F, 0xEB, 0x3B, 0x12, 0x7E, 0x5A,
-    0xB5, 0x12, 0x7D, 0x52, 0x35, 0x92, 0x5C, 0x2A, 0x01, 0xDE, 0xFD, 0x5A, 0x12, 0xFF, 0xE7, 0xB5,
-    0x4C, 0x83, 0x4B, 0x95, 0x4C, 0xC3, 0x4B, 0xA5, 0x4C, 0x42, 0xAF, 0x94, 0x24, 0xF2, 0x73, 0x49,
-    0x2E, 0x04, 0xA9, 0xC4, 0x3F, 0x0D, 0x53, 0x89, 0xFA, 0x10, 0xBB, 0x22, 0x78, 0x03, 0x5E, 0xE1,
-    0x18, 0xB3, 0xAF, 0x2B, 0xE7, 0xF2, 0x6F, 0x83, 0x03, 0x37, 0x6B, 0x68, 0x6B, 0xAE, 0x02, 0xEA,
-    0xDB, 0x32, 0x7E, 0xCE, 0xB2, 0x23, 0xE6, 0x10, 0xF3, 0xE7, 0x22, 0xF5, 0x06, 0x71, 0xC4, 0x6F,
-    0xD0, 0x1E, 0x56, 0x80, 0x08, 0x1B, 0x96, 0x78, 0xA9, 0x9C, 0x44, 0xDE, 0xBD, 0x98, 0x26, 0x72,
-    0x64, 0x00, 0xE6, 0x39, 0x21, 0x45, 0xDB, 0x30, 0xAA, 0xC4, 0xEA, 0x05, 0x2A, 0x93, 0x28, 0xA7,
-    0x72, 0xA8, 0xA1, 0xA0, 0x01, 0x78, 0x5D, 0xCF, 0xBD, 0xF4, 0x5B, 0x22, 0x99, 0x31, 0x3C, 0x2F,
-    0xF4, 0x2E, 0x6F, 0x88, 0x50, 0x75, 0xAB, 0xC0, 0xF7, 0x7E, 0x1D, 0x30, 0x66, 0x20, 0xCC, 0xC7,
-    0x6F, 0xA7, 0x7B, 0xB7, 0x8F, 0x6F, 0xC2, 0xBC, 0x68, 0x97, 0xED, 0xF9, 0xCD, 0x2F, 0x5F, 0x60,
-    0x71, 0xF2, 0xBF, 0xE9, 0xC9, 0xB1, 0xAB, 0xEB, 0xF7, 0x04, 0xC7, 0x78, 0x45, 0x9C, 0x0E, 0xED,
-    0x4E, 0xCB, 0x71, 0xA7, 0x61, 0xFB, 0x78, 0x06, 0x05, 0xD1, 0x80, 0xDB, 0xF0, 0x85, 0x95, 0x0E,
-    0x9A, 0xCD, 0x76, 0xBC, 0x73, 0xB4, 0x99, 0xDA, 0x36, 0xAF, 0x59, 0x40, 0x48, 0xFD, 0x15, 0x8F,
-    0x67, 0xB3, 0xDC, 0x70, 0x8C, 0x82, 0x9C, 0x7C, 0xD6, 0xAD, 0xB8, 0x66, 0x45, 0xAB, 0xE8, 0x60,
-    0xDE, 0x5A, 0x60, 0x2E, 0xE1, 0x74, 0xEB, 0x99, 0x79, 0x84, 0x09, 0xC9, 0xD1, 0x96, 0x79, 0xB8,
-    0x53, 0x27, 0x70, 0x8F, 0xD4, 0x6B, 0x12, 0xEC, 0x03, 0xAF, 0x49, 0xB8, 0x61, 0x15, 0x3D, 0x36,
-    0xBC, 0x14, 0xAE, 0x15, 0x9E, 0x15, 0xBE, 0x15, 0xA1, 0x15, 0x91, 0x15, 0xEB, 0x56, 0x5C, 0xB3,
-    0xA2, 0x53, 0xE1, 0x34, 0x2A, 0xDC, 0x9A, 0x42, 0x3C, 0xBB, 0xC7, 0x20, 0x57, 0x11, 0xDA, 0xDD,
-    0xBD, 0xA9, 0xE8, 0xC1, 0x2B, 0xB9, 0x7A, 0x0C, 0x07, 0x23, 0xCC, 0x09, 0x86, 0x70, 0x98, 0x02,
-    0x1E, 0x94, 0x80, 0xCF, 0x01, 0xDB, 0xCF, 0x8F, 0x8B, 0x0F, 0xA0, 0x1B, 0xD3, 0x6D, 0x1F, 0xE3,
-    0x9B, 0x57, 0x75, 0x98, 0x56, 0xDF, 0x8D, 0xA0, 0x48, 0x53, 0xDC, 0xD4, 0x8E, 0x77, 0x1E, 0xEE,
-    0xEC, 0xBF, 0xEF, 0xD5, 0xE1, 0x6F, 0xD0, 0x11, 0x3E, 0x00, 0xF8, 0x87, 0x00, 0x2C, 0xE6, 0xD5,
-    0x2E, 0xC1, 0x21, 0x88, 0x42, 0x21, 0xD9, 0x31, 0x9D, 0x30, 0x33, 0x9D, 0x8C, 0x3E, 0x84, 0x40,
-    0x2D, 0x72, 0x22, 0x5D, 0x74, 0x57, 0x15, 0xBD, 0x2B, 0x41, 0x65, 0xF1, 0xAA, 0xE2, 0x1D, 0x6D,
-    0xEF, 0x80, 0xF1, 0xEF, 0x4C, 0xB3, 0xEB, 0x14, 0xB1, 0x69, 0x33, 0x33, 0x9C, 0x1B, 0x36, 0x32,
-    0xD3, 0x4A, 0x27, 0xD9, 0x87, 0x22, 0x9D, 0x06, 0xFC, 0xD7, 0xC1, 0x41, 0xB1, 0xE8, 0x88, 0x71,
-    0xA7, 0x96, 0x4A, 0x93, 0x79, 0xAA, 0x61, 0xA1, 0xDB, 0x92, 0x64, 0x9F, 0x6E, 0x2D, 0x13, 0xC9,
-    0xAC, 0xD0, 0xB8, 0x99, 0x20, 0x18, 0x54, 0x84, 0x65, 0x36, 0x50, 0xDC, 0xC7, 0xEE, 0xD1, 0xF8,
-    0x8B, 0xEE, 0xC7, 0x1C, 0xF2, 0xC3, 0x9A, 0x7D, 0x89, 0x8F, 0x8D, 0x4F, 0xAE, 0xCC, 0xFD, 0x5A,
-    0x17, 0xF3, 0x3A, 0x8A, 0x0A, 0xE6, 0x96, 0x09, 0x62, 0xB1, 0xA8, 0x65, 0x02, 0x6F, 0x82, 0xF9,
-    0x26, 0xF0, 0x4F, 0x87, 0xD3, 0x35, 0xDA, 0x26, 0x72, 0x8F, 0xF1, 0x36, 0x61, 0x6C, 0x46, 0xA9,
-    0xBE, 0x8F, 0xBF, 0xA2, 0xDF, 0xA7, 0x19, 0x5F, 0xF4, 0x17, 0xC3, 0xF7, 0xF9, 0x8F, 0x8C, 0xF5,
-    0xAB, 0x37, 0x54, 0x59, 0xB9, 0x57, 0xAF, 0x83, 0xBB, 0xBC, 0x1A, 0xC3, 0x4B, 0xBF, 0x4A, 0x24,
-    0xA9, 0x7C, 0x98, 0x6B, 0x52, 0x07, 0x65, 0x24, 0xBB, 0xC4, 0xF4, 0xBD, 0x26, 0xCC, 0xC3, 0xF4,
-    0x0E, 0x31, 0x6F, 0xDB, 0x30, 0x0D, 0xCB, 0xB6, 0x8D, 0x24, 0xB8, 0xDF, 0xDE, 0x89, 0xE9, 0xED,
-    0xC6, 0x34, 0x16, 0xBD, 0x4F, 0xEB, 0xB5, 0x89, 0x78, 0x7F, 0xAD, 0xD6, 0xD7, 0x89, 0xDF, 0x59,
-    0x13, 0xF7, 0x5F, 0xE5, 0xC5, 0x6B, 0xE2, 0x3C, 0x2B, 0x23, 0x78, 0xF4, 0xB3, 0x3C, 0xBC, 0x03,
-    0xCA, 0xB3, 0x98, 0x86, 0xD8, 0x44, 0x01, 0x36, 0x20, 0x92, 0x5E, 0x32, 0x62, 0x62, 0xFE, 0x21,
-    0x6E, 0x9D, 0xC0, 0xC5, 0xE1, 0xD6, 0xB3, 0xFD, 0xC6, 0x6B, 0x26, 0xE2, 0x76, 0x44, 0xE9, 0x15,
-    0x77, 0x81, 0xEE, 0x1E, 0x0E, 0x3F, 0xC1, 0x86, 0xFF, 0x67, 0x14, 0x7E, 0xA9, 0xC5, 0xAF, 0x88,
-    0x51, 0x39, 0xF1, 0x1E, 0x6E, 0x16, 0xE9, 0xC4, 0x23, 0x85, 0x10, 0x6B, 0x6A, 0x89, 0xE4, 0x6C,
-    0x2D, 0x06, 0x70, 0x36, 0x77, 0xFE, 0x84, 0x24, 0x61, 0x7A, 0x0B, 0x27, 0x1D, 0xF1, 0x10, 0xE5,
-    0xE0, 0xD6, 0x5F, 0xE6, 0xFE, 0xB0, 0x85, 0x13, 0xC2, 0x4B, 0x73, 0xB8, 0x61, 0x92, 0x23, 0x8D,
-    0xC4, 0x39, 0xAD, 0x71, 0x1A, 0xC2, 0xD5, 0x9F, 0x1C, 0x12, 0x83, 0xB3, 0x73, 0x10, 0x6C, 0x91,
-    0x07, 0xDD, 0x59, 0x93, 0x83, 0xC5, 0xFE, 0x90, 0x4B, 0x36, 0x0F, 0xF1, 0xCA, 0x74, 0x85, 0x1E,
-    0x10, 0x59, 0xD4, 0x33, 0x61, 0xB5, 0x35, 0x06, 0x57, 0x63, 0x4A, 0x2B, 0xC1, 0x7C, 0xBB, 0x91,
-    0xB8, 0x92, 0x0D, 0xCB, 0xCE, 0xF7, 0x16, 0xD9, 0x46, 0x59, 0xCC, 0xED, 0xD4, 0x33, 0xE1, 0x9A,
-    0x0A, 0x27, 0x9C, 0x74, 0xFE, 0x29, 0x78, 0x2A, 0xE1, 0x79, 0x01, 0x95, 0x1D, 0x6C, 0x93, 0xD4,
-    0x40, 0x50, 0xE7, 0x4D, 0xC8, 0x00, 0xE1, 0xD1, 0x95, 0x86, 0x5B, 0xA0, 0xB9, 0x30, 0x50, 0x9C,
-    0x0D, 0x92, 0x93, 0xDB, 0x82, 0x42, 0x83, 0x1A, 0x10, 0x95, 0x80, 0x84, 0x8C, 0xDA, 0x03, 0xC0,
-    0x0C, 0x6E, 0x13, 0xD4, 0x00, 0xA8, 0xC2, 0x6D, 0x12, 0x52, 0x2D, 0x56, 0x3D, 0xF7, 0x0C, 0xB4,
-    0x48, 0x87, 0x29, 0x33, 0x82, 0x3B, 0x9F, 0x72, 0x6B, 0xD0, 0x82, 0xDB, 0x84, 0x1C, 0xE7, 0x73,
-    0x86, 0xDB, 0x2E, 0x56, 0xC1, 0xEB, 0x01, 0x71, 0x0E, 0x08, 0x2B, 0x80, 0xDF, 0x00, 0xDC, 0x8E,
-    0x73, 0xDB, 0x13, 0xF8, 0x62, 0x8E, 0x65, 0x3E, 0xED, 0x0B, 0x26, 0x5A, 0x1E, 0x87, 0x24, 0xEB,
-    0x32, 0x18, 0x23, 0xF6, 0x16, 0xE8, 0x45, 0x0A, 0x32, 0xE2, 0x54, 0x1A, 0x0B, 0x2F, 0xF6, 0x2E,
-    0x12, 0x54, 0xF5, 0x65, 0x89, 0x7B, 0x91, 0x2A, 0x16, 0x91, 0x6E, 0x4D, 0x11, 0xFF, 0x76, 0x47,
-    0x95, 0xF5, 0x0A, 0xE6, 0xA7, 0xD6, 0x6F, 0x62, 0x25, 0xCD, 0x38, 0x0D, 0x6A, 0x9B, 0x29, 0x55,
-    0xD7, 0x94, 0xAD, 0x65, 0x03, 0xCD, 0x0C, 0x08, 0x41, 0xAB, 0xEF, 0x83, 0xA5, 0xDE, 0x17, 0xD2,
-    0xF6, 0xC3, 0x50, 0xAD, 0x6B, 0x72, 0x92, 0x70, 0x13, 0x19, 0x1E, 0xDE, 0xAF, 0x93, 0x5F, 0x23,
-    0x26, 0xA0, 0x8E, 0x03, 0x46, 0x85, 0x16, 0x1E, 0x3D, 0xB4, 0x96, 0x7D, 0xBF, 0x93, 0x3E, 0xA8,
-    0x9C, 0x39, 0x26, 0xF6, 0x88, 0x5B, 0x8C, 0x71, 0xBB, 0xF0, 0xB1, 0xA9, 0xBC, 0x2E, 0x68, 0x50,
-    0x98, 0xD0, 0x72, 0x55, 0x64, 0xF6, 0xC4, 0x3F, 0x9C, 0x5B, 0x3A, 0x2F, 0x37, 0x2C, 0x9F, 0x8F,
-    0x19, 0x68, 0x29, 0x2D, 0xCD, 0x83, 0x42, 0x46, 0xF7, 0x1A, 0xCF, 0x9C, 0x8C, 0x72, 0x72, 0xA2,
-    0x86, 0x60, 0x50, 0x1D, 0xD0, 0xD7, 0x48, 0xBB, 0x3D, 0x97, 0xE8, 0x82, 0x05, 0xF4, 0xC1, 0xA2,
-    0xED, 0x2E, 0xD7, 0xDC, 0x8D, 0x38, 0x99, 0xAB, 0x25, 0xEB, 0x0B, 0x65, 0x93, 0x06, 0x94, 0x05,
-    0x5E, 0xA7, 0x9A, 0x6E, 0x85, 0xF8, 0xD6, 0x82, 0x4C, 0xDD, 0x7E, 0xB7, 0x47, 0x2E, 0xE9, 0x0F,
-    0x24, 0x78, 0x80, 0xB8, 0x0F, 0x7F, 0x54, 0x83, 0x98, 0x3C, 0x70, 0xD1, 0xAE, 0x9B, 0xEA, 0xF6,
-    0x74, 0xAF, 0xC1, 0x69, 0x60, 0xDB, 0xAB, 0x3B, 0xE8, 0x8D, 0xB8, 0xA1, 0x10, 0xAB, 0xB0, 0x92,
-    0xD1, 0x40, 0xF6, 0x8E, 0x61, 0x55, 0xAF, 0x71, 0xE6, 0xB4, 0x42, 0x26, 0x63, 0x1E, 0x9A, 0x15,
-    0x7F, 0x27, 0x8D, 0xE6, 0x0A, 0x88, 0x82, 0x9D, 0xBD, 0x65, 0xC7, 0x07, 0x68, 0xE3, 0xE0, 0xAD,
-    0x7E, 0x5C, 0x80, 0xF6, 0x3E, 0x09, 0x99, 0xAF, 0x06, 0xB8, 0xCE, 0x22, 0x5D, 0x3A, 0x05, 0x14,
-    0x1E, 0x91, 0x51, 0x8C, 0x79, 0xD2, 0x7B, 0xF3, 0x20, 0x7F, 0x3B, 0x6C, 0xD1, 0x11, 0x95, 0x01,
-    0x43, 0x1E, 0x90, 0x71, 0xDC, 0x3D, 0xC2, 0xB0, 0x84, 0x5E, 0x82, 0xC7, 0x1F, 0xF6, 0x2C, 0x03,
-    0x15, 0xD8, 0x96, 0x71, 0x48, 0xC2, 0xC1, 0x49, 0x92, 0x02, 0x62, 0x2C, 0x90, 0x84, 0x35, 0xC0,
-    0xEF, 0x01, 0xAE, 0x79, 0xF2, 0x2B, 0xC3, 0x44, 0x68, 0x48, 0x4D, 0x28, 0x63, 0x82, 0xBD, 0x45,
-    0xC2, 0x3E, 0x4B, 0x33, 0x4E, 0x75, 0x5B, 0x46, 0xF7, 0x66, 0x52, 0x2D, 0x99, 0xA8, 0x32, 0xEF,
-    0x39, 0xD1, 0x7F, 0x44, 0x17, 0x0D, 0x3E, 0xD1, 0x02, 0xE5, 0x63, 0x5A, 0x24, 0xFA, 0x59, 0x27,
-    0x96, 0xDB, 0x47, 0xC4, 0x0E, 0x33, 0xF5, 0x4A, 0x38, 0x81, 0xD3, 0x33, 0xB3, 0xAC, 0xF6, 0xFA,
-    0x24, 0x00, 0x26, 0x5B, 0xBA, 0x65, 0xA9, 0x35, 0x41, 0x4E, 0xBE, 0x61, 0x15, 0xAD, 0x53, 0x70,
-    0xAC, 0xA9, 0xEE, 0x62, 0x58, 0xF1, 0xA3, 0x1D, 0xA8, 0xC6, 0xE3, 0x11, 0xBD, 0xF9, 0x47, 0xA8,
-    0x60, 0x52, 0xC9, 0xB8, 0xB1, 0x38, 0x5F, 0xE1, 0x55, 0xC6, 0x4F, 0xB1, 0xC8, 0x30, 0xD8, 0xDE,
-    0x4E, 0xC7, 0xD0, 0x43, 0x7B, 0x86, 0x2F, 0x57, 0xCC, 0xF5, 0xCD, 0x0D, 0xED, 0xC8, 0x50, 0x50,
-    0xDD, 0x88, 0x4E, 0x4F, 0xD4, 0x4A, 0x15, 0x4C, 0xEC, 0xA4, 0xFE, 0x7C, 0x73, 0x9F, 0x94, 0x8A,
-    0x79, 0x3B, 0xF4, 0x08, 0xB9, 0xBC, 0x24, 0xF6, 0x50, 0x35, 0x01, 0xD3, 0xA2, 0xEA, 0x6B, 0x1C,
-    0x73, 0xB8, 0x5F, 0x79, 0x43, 0xE8, 0xE4, 0x61, 0x13, 0xB2, 0xA0, 0x0F, 0x79, 0x0F, 0x08, 0xC9,
-    0x80, 0x21, 0x15, 0x10, 0xF2, 0x18, 0x0B, 0xE8, 0x97, 0x70, 0xD2, 0xA6, 0x43, 0x74, 0xB0, 0x4E,
-    0x4B, 0xB8, 0x40, 0x54, 0x03, 0x82, 0x2E, 0xE4, 0x7B, 0xF6, 0xB7, 0x4A, 0x5B, 0x1E, 0x6A, 0x7D,
-    0x6F, 0xE3, 0x4B, 0x8B, 0xA9, 0xD7, 0xF0, 0xDC, 0x12, 0x9C, 0xAF, 0x51, 0x00, 0xA9, 0x3A, 0x8C,
-    0x74, 0x0C, 0x33, 0x3D, 0x6D, 0xDA, 0x9F, 0x3F, 0xDA, 0x7E, 0x7A, 0xD9, 0x43, 0x3E, 0x94, 0xFF,
-    0x06, 0x5C, 0x92, 0x87, 0x33, 0x9C, 0xC1, 0x0F, 0x33, 0x07, 0x24, 0x73, 0x2D, 0x56, 0x16, 0x41,
-    0xEC, 0x14, 0xE4, 0xB2, 0x40, 0x15, 0x9C, 0xA0, 0xAE, 0x54, 0xCA, 0x4F, 0x47, 0xF6, 0x1F, 0x49,
-    0x6F, 0x15, 0x0B, 0xCB, 0x06, 0x95, 0x72, 0x84, 0x0E, 0xF2, 0x6D, 0xAE, 0xCC, 0x94, 0x57, 0xAC,
-    0x67, 0x49, 0xDC, 0xD8, 0xF2, 0xF0, 0x35, 0xF7, 0xC6, 0xB7, 0x9C, 0x2E, 0x79, 0x30, 0x98, 0xB2,
-    0xFB, 0x6E, 0x8B, 0xCB, 0x4B, 0xF7, 0xBD, 0xE6, 0x82, 0xFB, 0xC7, 0xF6, 0x62, 0xFD, 0x96, 0xFB,
-    0x59, 0x13, 0xB4, 0x6F, 0xB9, 0x87, 0x28, 0x6C, 0xCC, 0x47, 0xF0, 0xCA, 0x27, 0xCA, 0xE4, 0xF5,
-    0x85, 0x2B, 0x58, 0x1A, 0xBD, 0xC0, 0xBD, 0x57, 0x9D, 0x5C, 0xBD, 0xBA, 0x3E, 0x81, 0x13, 0xF6,
-    0xF9, 0xC9, 0x6C, 0x36, 0xDB, 0x5B, 0xE9, 0xB0, 0xC5, 0xFA, 0xFF, 0x0D, 0x32, 0x9B, 0x5D, 0xDA,
-    0x73, 0xE6, 0xFA, 0x86, 0xBA, 0x13, 0xAB, 0x31, 0xF2, 0xC7, 0xD8, 0xAE, 0xC1, 0xCE, 0xDA, 0x25,
-    0xAA, 0xE4, 0x4D, 0x18, 0x34, 0x1B, 0xEC, 0xBD, 0x91, 0x1E, 0x4C, 0x2E, 0x62, 0x97, 0x92, 0x7D,
-    0x3F, 0xE6, 0xE2, 0x64, 0x74, 0x4B, 0xDE, 0xA4, 0xD8, 0x79, 0xF7, 0x85, 0xF4, 0xE2, 0xDC, 0x02,
-    0xEC, 0x34, 0xBC, 0x17, 0x32, 0xA1, 0xB3, 0xF6, 0xA3, 0x7A, 0xA7, 0x3D, 0x7C, 0xE1, 0xF5, 0x3E,
-    0x63, 0x07, 0x2C, 0xE5, 0x23, 0x6C, 0x24, 0x43, 0x7E, 0xB8, 0xF1, 0x1E, 0x39, 0x4D, 0x56, 0x01,
-    0x3B, 0xEC, 0xF9, 0xEE, 0x9E, 0xEF, 0xE9, 0xB9, 0x9B, 0x1E, 0x9C, 0x27, 0x03, 0xE3, 0x86, 0xB9,
-    0x5D, 0xCC, 0x20, 0xA7, 0x3E, 0x7E, 0x37, 0x56, 0x10, 0x2A, 0xD6, 0x2C, 0xF5, 0x5F, 0xF5, 0xD5,
-    0x82, 0x77, 0x3D, 0x35, 0xF1, 0xAE, 0x15, 0xC9, 0x93, 0x63, 0x5C, 0x7F, 0x71, 0xC3, 0x25, 0x45,
-    0x92, 0xD7, 0x94, 0x16, 0xD8, 0x87, 0x70, 0xA3, 0xC0, 0x24, 0x0A, 0x3C, 0x5E, 0x75, 0xE3, 0x6D,
-    0x58, 0xCF, 0xFB, 0xAC, 0x3D, 0xA0, 0x38, 0x34, 0x06, 0xB7, 0x53, 0x6F, 0x1E, 0x7F, 0x7E, 0x08,
-    0xD1, 0x05, 0xA4, 0xA1, 0xC0, 0xF2, 0x64, 0x6C, 0x4B, 0xD1, 0x6B, 0xD6, 0xB1, 0xBE, 0x39, 0x1D,
-    0x13, 0xCE, 0xC3, 0x2B, 0x74, 0xCE, 0xC0, 0x28, 0x53, 0xE1, 0x55, 0xA9, 0x2C, 0x1D, 0xD6, 0x53,
-    0xFB, 0x5B, 0x9A, 0xFD, 0x6A, 0xDC, 0xE6, 0x0D, 0x21, 0xE2, 0x66, 0x79, 0x1D, 0x33, 0xB9, 0x07,
-    0xD7, 0xCF, 0xEA, 0x00, 0x21, 0x81, 0x74, 0x58, 0x31, 0x39, 0x46, 0x25, 0x95, 0x16, 0xE3, 0x0E,
-    0x25, 0x07, 0x9A, 0x9F, 0xA7, 0x2B, 0x98, 0xA0, 0x90, 0xD9, 0x23, 0xF2, 0xEC, 0x2F, 0x43, 0x70,
-    0x87, 0x72, 0xD8, 0x80, 0xE3, 0xED, 0x1B, 0x26, 0x92, 0x84, 0x6B, 0x86, 0xB5, 0xC7, 0x4A, 0xE5,
-    0x8B, 0xB1, 0x18, 0xB0, 0x23, 0xAA, 0xBC, 0xA7, 0x20, 0xB1, 0x82, 0xF7, 0xD5, 0x82, 0x7E, 0x7B,
-    0xFE, 0xE8, 0xF2, 0x6A, 0xFA, 0xC0, 0x85, 0x92, 0xE4, 0x0B, 0xBB, 0xE1, 0x06, 0xF9, 0x92, 0x0C,
-    0xE3, 0xEC, 0xBD, 0xCB, 0x50, 0xD3, 0x5B, 0xBB, 0xFB, 0x54, 0x93, 0xA8, 0xDE, 0xA1, 0x0B, 0x5A,
-    0xD9, 0x33, 0x75, 0xD1, 0x49, 0xF0, 0xCF, 0xFA, 0xF6, 0x20, 0xD1, 0xC7, 0xF5, 0x6D, 0xE4, 0xCE,
-    0x1F, 0xD4, 0xB7, 0x51, 0x88, 0x62, 0x7C, 0x58, 0x4E, 0x89, 0xD5, 0x01, 0x30, 0xA8, 0x06, 0x62,
-    0x4D, 0xF4, 0xEB, 0x41, 0xD2, 0x0D, 0x67, 0xE3, 0x40, 0x96, 0x95, 0xA3, 0xAD, 0xFC, 0x46, 0xBA,
-    0x56, 0x5A, 0xB6, 0xFF, 0x01, 0x8C, 0x15, 0x8C, 0x68, 0xB4, 0x3B, 0x19, 0xDC, 0xC2, 0x7A, 0xC5,
-    0x88, 0xCA, 0x01, 0x55, 0xB3, 0x7C, 0x0A, 0xF0, 0x0A, 0xDB, 0x8D, 0xFE, 0x71, 0x12, 0xE1, 0x46,
-    0xE9, 0x37, 0x74, 0xD7, 0x93, 0xC7, 0xAF, 0xE9, 0xAF, 0x66, 0x66, 0x52, 0x5A, 0x8B, 0xB6, 0xC2,
-    0x6F, 0xF6, 0xB5, 0xF0, 0x72, 0xDE, 0x47, 0x7B, 0xFB, 0xB8, 0x78, 0x58, 0x99, 0x05, 0xCD, 0x7C,
-    0x56, 0xD4, 0xFC, 0x97, 0x85, 0xE3, 0x57, 0xDF, 0x25, 0x69, 0xBA, 0x2C, 0x89, 0x51, 0x8F, 0x57,
-    0xFE, 0x7C, 0xAB, 0x44, 0x0E, 0xD0, 0xDD, 0x27, 0xE3, 0x59, 0xA6, 0x2F, 0x3C, 0x8B, 0x76, 0x8E,
-    0x41, 0x24, 0x4B, 0x70, 0x74, 0x96, 0x84, 0x54, 0x21, 0xCE, 0xD1, 0x62, 0x4B, 0xA4, 0x37, 0x36,
-    0x37, 0x53, 0x56, 0xC8, 0x2C, 0x90, 0xFF, 0x03, 0xAB, 0xFF, 0xFF, 0xFF, 0xBF, 0x43, 0x3D, 0x88,
-    0x10, 0x0D, 0x0D, 0x0D, 0x65, 0x00, 0x00, 0xCD, 0x93, 0x31, 0x4E, 0xC3, 0x30, 0x18, 0x85, 0x9F,
-    0x5B, 0x15, 0x86, 0x0C, 0x66, 0x29, 0x4B, 0x87, 0x1C, 0x21, 0x47, 0xB0, 0x77, 0x06, 0x32, 0x14,
-    0x31, 0xF6, 0x08, 0x9C, 0x00, 0x6A, 0xB1, 0x72, 0xA8, 0x58, 0x9C, 0xC0, 0x0B, 0x3B, 0x47, 0xC8,
-    0x10, 0xA4, 0x22, 0xA5, 0xF9, 0x79, 0xB6, 0x53, 0x04, 0x2D, 0x03, 0x03, 0x45, 0x5D, 0xDE, 0x17,
-    0xFB, 0x77, 0x9C, 0xF7, 0xFB, 0xC5, 0x50, 0x37, 0x50, 0x4B, 0xA0, 0x14, 0x57, 0x09, 0x60, 0xC4,
-    0x36, 0xC4, 0x00, 0xB5, 0x05, 0xD0, 0x63, 0xD2, 0x01, 0x6A, 0x83, 0x69, 0xBB, 0x8F, 0x85, 0xF4,
-    0xA5, 0x74, 0x68, 0xA4, 0x17, 0xD9, 0xE0, 0xF2, 0x7D, 0x79, 0xFB, 0x56, 0xFF, 0xBC, 0xF2, 0x18,
-    0x00, 0x5D, 0x47, 0xCF, 0x8F, 0x96, 0x8E, 0xAF, 0x03, 0xFD, 0xEA, 0x40, 0xB7, 0x85, 0x67, 0x3D,
-    0x2D, 0x1A, 0x85, 0x2E, 0x0B, 0xDF, 0x44, 0xA1, 0xC3, 0x54, 0xFD, 0x2B, 0xA1, 0x03, 0x65, 0xE9,
-    0xE0, 0xC9, 0xD3, 0xC1, 0x95, 0xA7, 0x03, 0xCE, 0xF5, 0x87, 0xEB, 0x8E, 0xEA, 0x20, 0x25, 0x97,
-    0xA3, 0x3B, 0x1B, 0xB3, 0x2B, 0x7D, 0x0E, 0xAF, 0xF4, 0x39, 0x3D, 0xED, 0x3E, 0x8F, 0x6C, 0x8F,
-    0x39, 0x41, 0xED, 0x72, 0x84, 0xDA, 0xE5, 0x0C, 0x77, 0xEB, 0xFF, 0x9F, 0xB9, 0x9F, 0xD9, 0xD8,
-    0x0F, 0xC7, 0xA9, 0x1F, 0x32, 0xF5, 0x43, 0x7E, 0xEB, 0xE7, 0x90, 0x27, 0xD7, 0xCF, 0xBC, 0x06,
-    0x26, 0x32, 0x00, 0x85, 0x48, 0x40, 0x19, 0x16, 0x2D, 0x8C, 0x65, 0x0B, 0x06, 0x7B, 0xB2, 0x90,
-    0xAD, 0x61, 0xB7, 0x83, 0x89, 0xF7, 0xE8, 0xA0, 0xFA, 0x0B, 0x51, 0x49, 0x7A, 0x0A, 0x0F, 0x8B,
-    0xD2, 0x70, 0x2B, 0x94, 0xFC, 0x32, 0x40, 0x0F, 0x98, 0xDB, 0xF8, 0xA4, 0x24, 0xDE, 0x88, 0x68,
-    0x26, 0x42, 0x87, 0xB5, 0x8B, 0xFF, 0x8E, 0xD5, 0x9E, 0xA8, 0xF0, 0x15, 0x69, 0x52, 0x89, 0xB8,
-    0xB5, 0xB4, 0x5A, 0xE4, 0x59, 0xA4, 0x35, 0x61, 0x65, 0x57, 0x2F, 0xB5, 0x89, 0x6F, 0x7A, 0x3C,
-    0x64, 0x8C, 0x23, 0x13, 0x12, 0xF4, 0x36, 0x61, 0x22, 0xAF, 0x69, 0x97, 0x6A, 0x48, 0x50, 0xE2,
-    0xF2, 0x9E, 0x3E, 0xA1, 0x08, 0x09, 0xE7, 0x61, 0x37, 0x0A, 0xB8, 0xC7, 0x9D, 0x2F, 0xBA, 0x8B,
-    0x35, 0x7D, 0x4D, 0xA5, 0xAB, 0xA2, 0xCB, 0xA6, 0xC5, 0x9C, 0xE5, 0x19, 0x3E, 0x00, 0x4D, 0x8F,
-    0xB1, 0x0D, 0xC3, 0x30, 0x0C, 0x04, 0x19, 0xA8, 0x48, 0xC9, 0x3E, 0x19, 0x42, 0x23, 0x50, 0x9B,
-    0x39, 0x23, 0x64, 0x23, 0x6B, 0x04, 0x8D, 0x90, 0x11, 0x52, 0xD8, 0x40, 0x0A, 0x3B, 0x9F, 0xD7,
-    0x0B, 0x36, 0xC2, 0xE6, 0x41, 0xF0, 0xC8, 0x7F, 0x9A, 0x9D, 0x95, 0xCA, 0x50, 0x6F, 0x43, 0x63,
-    0x19, 0x8A, 0x7D, 0x8C, 0x01, 0x01, 0x0E, 0x08, 0x88, 0xE7, 0x5D, 0xC0, 0xC7, 0xAC, 0x03, 0x89,
-    0x1A, 0x04, 0x7C, 0xBB, 0x3D, 0x82, 0x40, 0x7C, 0xD1, 0x32, 0x01, 0x00, 0xAF, 0xBC, 0xF7, 0x6D,
-    0xD4, 0x40, 0xE1, 0x36, 0x6C, 0x42, 0x0B, 0x60, 0xBB, 0x00, 0x0B, 0xF5, 0x7D, 0xA5, 0x7A, 0xC7,
-    0x78, 0x99, 0x5C, 0x9F, 0x15, 0xEE, 0xB5, 0xA9, 0x3B, 0xB3, 0xE1, 0x58, 0xB6, 0x32, 0x4E, 0x58,
-    0x67, 0x05, 0xE1, 0x39, 0x05, 0x8B, 0x9A, 0x95, 0xC3, 0x6B, 0x28, 0x57, 0x5A, 0xE7, 0xF2, 0x9F,
-    0xFB, 0xFC, 0xE3, 0xF8, 0xEB, 0xF8, 0x53, 0xF5, 0x03,
+static const uint8_t notosans_16_regularBitmaps[35189] = {
+    0xCD, 0x59, 0x3D, 0x8F, 0xDC, 0xD6, 0x15, 0x7D, 0x24, 0x57, 0xCB, 0x82, 0x08, 0xE8, 0xC2, 0x9B,
+    0x18, 0x50, 0xC1, 0xC6, 0x55, 0x00, 0x87, 0x7F, 0xC0, 0xCB, 0x47, 0x21, 0xA5, 0x8B, 0xA8, 0xD0,
+    0x5A, 0x40, 0x54, 0xB8, 0x37, 0x10, 0xEC, 0x1F, 0xD0, 0x0E, 0x09, 0xA7, 0x74, 0x11, 0x35, 0x06,
+    0x52, 0xBA, 0x48, 0x02, 0x64, 0x54, 0xE8, 0x0F, 0xCC, 0x0E, 0x09, 0xA4, 0x4C, 0x61, 0x76, 0x29,
+    0x43, 0x23, 0x51, 0xE1, 0xA4, 0x08, 0x91, 0x50, 0x08, 0x47, 0x26, 0xE7, 0xE5, 0x9C, 0xFB, 0x48,
+    0xCE, 0x8C, 0x77, 0x2D, 0x69, 0x65, 0xD9, 0xC8, 0xEC, 0xBC, 0xCB, 0x1D, 0xF2, 0x7D, 0xDC, 0x77,
+    0x3F, 0xCE, 0xBB, 0xF7, 0x52, 0x2B, 0x7D, 0xCD, 0x5F, 0xA2, 0x7E, 0x36, 0xFE, 0xBD, 0xA7, 0x8E,
+    0x14, 0x3F, 0x5A, 0x15, 0x69, 0x91, 0x67, 0xFC, 0x95, 0xA8, 0x95, 0xD3, 0x79, 0x8D, 0x5F, 0x85,
+    0x65, 0x94, 0xC7, 0x29, 0xFB, 0x2F, 0xF0, 0x77, 0xB9, 0xF7, 0xC7, 0xDF, 0xBC, 0x1F, 0xE7, 0x61,
+    0x19, 0x56, 0x7E, 0xED, 0x36, 0xAA, 0x57, 0x17, 0xEA, 0x68, 0x85, 0x7B, 0x51, 0x1A, 0x96, 0x7E,
+    0xED, 0x35, 0x6E, 0xEB, 0x74, 0xB8, 0xDB, 0xCF, 0x03, 0xA6, 0xBF, 0x4B, 0x35, 0xF0, 0xBE, 0xCB,
+    0x35, 0x9A, 0xA0, 0x0A, 0x73, 0x8D, 0xA1, 0x6F, 0xA9, 0x90, 0xEB, 0x95, 0x5C, 0x2F, 0x51, 0xA7,
+    0xEA, 0x21, 0xEE, 0xE0, 0x53, 0x98, 0x14, 0xDF, 0xB3, 0xB3, 0x43, 0x0E, 0xE5, 0x13, 0x6F, 0x41,
+    0x8C, 0xA9, 0x94, 0xB7, 0x7D, 0xD0, 0xAA, 0xA0, 0x76, 0x7A, 0x15, 0x96, 0x98, 0x3C, 0xCA, 0xC9,
+    0x58, 0x2A, 0xFC, 0x29, 0x4E, 0x67, 0x49, 0x94, 0xBF, 0x88, 0x8C, 0xFD, 0x64, 0x98, 0x4C, 0x80,
+    0xA9, 0xD6, 0x98, 0x14, 0x8C, 0x7A, 0x9B, 0xDB, 0x1D, 0x17, 0xAA, 0xD1, 0xC1, 0xA4, 0x58, 0xF3,
+    0x2E, 0x9A, 0x57, 0xAB, 0xA8, 0x56, 0x45, 0xED, 0x7D, 0x5D, 0x47, 0x7F, 0xAB, 0xF5, 0xCF, 0xEB,
+    0x1F, 0xE1, 0xCE, 0x6B, 0x7C, 0x65, 0x8F, 0x83, 0x0A, 0x8C, 0x29, 0xF5, 0xD3, 0xF3, 0x26, 0x51,
+    0x5E, 0x7B, 0xA4, 0xB0, 0x13, 0xA5, 0xF6, 0x1A, 0xE4, 0xA8, 0xDC, 0x56, 0x29, 0xBF, 0x51, 0xE4,
+    0x4B, 0x69, 0x70, 0xB1, 0xC6, 0x2D, 0xDC, 0x0E, 0xC8, 0x55, 0x7E, 0xE5, 0x67, 0xB1, 0x5C, 0x2E,
+    0x0B, 0x63, 0x0C, 0x9B, 0xAC, 0xE1, 0x14, 0x90, 0x56, 0xC4, 0x4D, 0x60, 0x99, 0x16, 0x7A, 0x77,
+    0x39, 0x37, 0x14, 0x81, 0xCF, 0xE5, 0x4C, 0x78, 0x4F, 0x16, 0x0F, 0xB0, 0xD2, 0xC7, 0x05, 0x96,
+    0x32, 0x83, 0x1A, 0xF7, 0xAE, 0x6E, 0xCB, 0x08, 0x0A, 0x5D, 0x65, 0xD6, 0x62, 0x0E, 0x48, 0x06,
+    0xB9, 0x38, 0x83, 0x5A, 0xA7, 0xE8, 0x57, 0x70, 0x44, 0x64, 0xB6, 0xE0, 0xF3, 0x24, 0x55, 0xD3,
+    0xA4, 0x1E, 0x49, 0x48, 0x12, 0x93, 0x9C, 0xCA, 0xEE, 0x40, 0xDC, 0x06, 0xC4, 0xAF, 0x40, 0xC2,
+    0x1C, 0x24, 0x26, 0x1B, 0x17, 0x24, 0x34, 0x1F, 0x8F, 0x96, 0xE5, 0x57, 0x20, 0x61, 0x0E, 0xA2,
+    0xC9, 0x64, 0x86, 0x5D, 0xB5, 0x42, 0x7E, 0xBA, 0x5C, 0x6E, 0x3F, 0x1F, 0x19, 0xBF, 0x4A, 0xB0,
+    0xDF, 0x2A, 0x06, 0x2B, 0x31, 0xAF, 0x23, 0x9F, 0x53, 0x4B, 0xA6, 0xF6, 0xF1, 0x23, 0xCC, 0xB7,
+    0x55, 0x1A, 0x7D, 0x8E, 0x54, 0x84, 0x7D, 0x7B, 0x9D, 0xBA, 0xA2, 0x01, 0x36, 0xB7, 0x4B, 0xA1,
+    0x81, 0xCD, 0x9D, 0xAC, 0xC2, 0xCA, 0x69, 0x6C, 0xD0, 0xED, 0x64, 0x34, 0x45, 0xE5, 0xF0, 0x57,
+    0x44, 0x52, 0x3C, 0xBD, 0xA7, 0x5C, 0x0A, 0x0D, 0x8C, 0x43, 0x8E, 0x95, 0xB2, 0x2A, 0x83, 0x57,
+    0x70, 0xDF, 0x22, 0xAD, 0x63, 0xC8, 0x45, 0xC7, 0xA6, 0x51, 0x7A, 0xFD, 0x00, 0x3B, 0xAA, 0x21,
+    0x53, 0x9D, 0xEF, 0x99, 0x6B, 0xB4, 0x47, 0x60, 0x90, 0x31, 0xFC, 0x09, 0xCF, 0xA0, 0xDA, 0xB5,
+    0xF2, 0x06, 0xBF, 0xA7, 0x3E, 0x1A, 0xDA, 0x62, 0x6E, 0x6D, 0x51, 0x74, 0xBC, 0x23, 0x93, 0x3E,
+    0x66, 0x85, 0xD2, 0x72, 0x46, 0x6E, 0xEA, 0x99, 0x9B, 0x7C, 0xEA, 0xB6, 0x98, 0xCC, 0xC0, 0xF9,
+    0x46, 0xDF, 0x99, 0xF3, 0x78, 0xEE, 0xBB, 0x3E, 0xB0, 0x91, 0xD1, 0x0B, 0xE1, 0x12, 0x0E, 0x19,
+    0xF2, 0x37, 0xF7, 0xA1, 0xA3, 0x0A, 0x9D, 0x84, 0x5D, 0xEB, 0x44, 0xA3, 0x27, 0x2D, 0x68, 0x50,
+    0xD0, 0xE5, 0x40, 0xBB, 0x2A, 0x4C, 0xC9, 0x61, 0xE2, 0xDC, 0x70, 0xDE, 0x2E, 0xE8, 0x30, 0xCC,
+    0xD9, 0x72, 0x1D, 0x91, 0x81, 0xF8, 0x63, 0x38, 0x13, 0x38, 0xA5, 0xCC, 0xD2, 0xBA, 0x5B, 0xE5,
+    0x19, 0x11, 0xB1, 0x79, 0x04, 0x16, 0xEE, 0x4E, 0x1C, 0x9C, 0x83, 0x7B, 0x17, 0xFE, 0xA3, 0x82,
+    0xCD, 0x79, 0xA3, 0xA2, 0x12, 0x7E, 0x00, 0x07, 0x11, 0x53, 0x49, 0xA8, 0x62, 0xA2, 0x17, 0x24,
+    0x2F, 0x84, 0x3F, 0x29, 0xD8, 0x0C, 0x93, 0x3A, 0x26, 0x0D, 0x9F, 0x3D, 0x30, 0x9C, 0x14, 0x7A,
+    0x29, 0xBA, 0x9D, 0x29, 0x27, 0x57, 0xE5, 0x07, 0xC6, 0x8F, 0x1C, 0x38, 0x44, 0x00, 0x53, 0x01,
+    0xF9, 0x3B, 0x6E, 0xDD, 0x43, 0x3B, 0xB2, 0xA8, 0x94, 0x6A, 0x75, 0xDD, 0x67, 0x87, 0x58, 0x0E,
+    0xF8, 0x8A, 0xAB, 0xB8, 0x12, 0x81, 0x5E, 0xF9, 0x44, 0xC4, 0xBD, 0x9C, 0x9B, 0xBF, 0x50, 0x2B,
+    0x58, 0xBD, 0xDD, 0xDA, 0xB1, 0x69, 0x69, 0xE9, 0x4A, 0xFF, 0xBE, 0xC8, 0xDF, 0x15, 0x55, 0xC0,
+    0x0D, 0x04, 0x33, 0xFC, 0xDA, 0xEA, 0x67, 0xC4, 0x02, 0x78, 0x9D, 0xF2, 0xDB, 0xF1, 0x27, 0x1D,
+    0x0B, 0xED, 0xE1, 0xD8, 0xDE, 0xDE, 0x5B, 0xE6, 0x82, 0xAE, 0x3C, 0xB6, 0xED, 0xF4, 0xCC, 0x72,
+    0xAE, 0x73, 0x01, 0x22, 0xE1, 0xCE, 0x50, 0xF3, 0xCE, 0x7F, 0x69, 0x2B, 0xDE, 0xBF, 0x69, 0x0A,
+    0xDE, 0x97, 0x22, 0x81, 0x4A, 0xDC, 0xB7, 0xBC, 0x14, 0xF3, 0x59, 0x88, 0x35, 0x5B, 0x67, 0x82,
+    0x8D, 0x42, 0x5A, 0x5C, 0x5D, 0x10, 0x18, 0xD6, 0x00, 0xEF, 0x87, 0x46, 0x60, 0x14, 0xDE, 0xF3,
+    0xE5, 0xE3, 0x96, 0xFC, 0x02, 0xC2, 0x6C, 0x87, 0xA8, 0xA4, 0x1D, 0x71, 0x88, 0xB6, 0xC3, 0xD3,
+    0x85, 0x4C, 0x68, 0x27, 0x2F, 0xCC, 0x57, 0x34, 0x6F, 0x8C, 0x07, 0xE1, 0xD9, 0x01, 0xA5, 0xE3,
+    0x49, 0x41, 0xA2, 0x0F, 0xC9, 0x1A, 0x04, 0x76, 0x68, 0x96, 0x85, 0x74, 0x4E, 0x49, 0x5A, 0xDE,
+    0x93, 0x11, 0x3A, 0x25, 0x92, 0x70, 0xD6, 0xA8, 0x9C, 0x48, 0x4C, 0xA2, 0x79, 0xCF, 0xA8, 0xED,
+    0xF2, 0xC9, 0x60, 0x47, 0x18, 0x81, 0x29, 0xF9, 0xB8, 0xFC, 0x17, 0x60, 0xD1, 0x38, 0xE6, 0x1F,
+    0x4F, 0x2A, 0x6F, 0x50, 0x4E, 0x1E, 0x52, 0x00, 0x71, 0xA9, 0x2C, 0xE8, 0x5A, 0xE0, 0x5B, 0xCF,
+    0xC8, 0x39, 0x1C, 0x22, 0xCE, 0xEE, 0xDE, 0x7A, 0x87, 0x92, 0x1C, 0xA6, 0xC5, 0xE7, 0x28, 0x51,
+    0x18, 0x3B, 0xD7, 0xF9, 0xEC, 0x41, 0x49, 0x6F, 0xA5, 0x3D, 0xD1, 0x8D, 0x01, 0x92, 0x07, 0x3B,
+    0xE7, 0xF9, 0xE8, 0x1A, 0xD9, 0x02, 0xA5, 0x1E, 0x10, 0x20, 0xBD, 0x56, 0x30, 0x88, 0xC7, 0x41,
+    0x3F, 0x21, 0xA7, 0x25, 0xC3, 0x4C, 0xE6, 0x7B, 0xD2, 0x45, 0x3A, 0xCB, 0xB0, 0xB0, 0x19, 0xB7,
+    0x0F, 0x9B, 0xDF, 0x2E, 0x8B, 0x61, 0x5A, 0x68, 0x23, 0xE8, 0x41, 0x3C, 0xAB, 0xD1, 0xAA, 0x6B,
+    0x40, 0x6F, 0x6E, 0x66, 0xB9, 0xCC, 0xD1, 0xA7, 0x64, 0x7B, 0x51, 0x3F, 0xB6, 0xED, 0x72, 0xF9,
+    0x68, 0x9C, 0xB3, 0x7E, 0xD5, 0xF9, 0x6F, 0xBA, 0xC6, 0xD4, 0x46, 0xFC, 0x25, 0x26, 0x44, 0x14,
+    0x9C, 0x79, 0xFE, 0xB8, 0xF7, 0x60, 0xDD, 0xEF, 0x86, 0xAD, 0x78, 0xD6, 0x64, 0xDC, 0xDF, 0xA2,
+    0xB9, 0xE5, 0x1F, 0x29, 0x14, 0x23, 0x84, 0xF7, 0x32, 0x76, 0xD1, 0xEC, 0xAC, 0xA9, 0x39, 0x4D,
+    0xD5, 0xEB, 0x10, 0x9A, 0xD3, 0x04, 0x5E, 0xED, 0x9A, 0xA7, 0x1F, 0x1A, 0x39, 0x7F, 0x94, 0x6F,
+    0x88, 0x02, 0xB7, 0xEE, 0xC2, 0x63, 0x95, 0x23, 0xBA, 0x79, 0x65, 0x82, 0x7D, 0x3E, 0x6E, 0x0D,
+    0xAD, 0x4F, 0xC8, 0x8D, 0xC6, 0xEE, 0x48, 0x61, 0x72, 0x40, 0xA9, 0xBF, 0x21, 0x5E, 0xBF, 0xCE,
+    0xB7, 0x25, 0x12, 0x13, 0x8C, 0x83, 0x92, 0xBE, 0xF9, 0xA6, 0xBE, 0x71, 0x7E, 0x56, 0x28, 0x44,
+    0x1B, 0x45, 0xAB, 0x6E, 0x29, 0x0A, 0x47, 0x7C, 0x3B, 0xB3, 0xDE, 0xDA, 0x73, 0x59, 0x39, 0x26,
+    0x7A, 0x0B, 0xD2, 0xD0, 0x54, 0xCF, 0xC0, 0xA5, 0xE7, 0xD9, 0xD4, 0x53, 0xDA, 0x3D, 0x85, 0xBF,
+    0xA5, 0x57, 0x30, 0xB6, 0x53, 0xE6, 0x53, 0x78, 0xE0, 0x96, 0x67, 0x72, 0x4F, 0xA5, 0xF5, 0x54,
+    0x64, 0x4F, 0x8F, 0xC4, 0x2C, 0x8C, 0xCE, 0x7C, 0xCE, 0xE7, 0x72, 0x66, 0x78, 0xF5, 0xE4, 0xDF,
+    0x51, 0xB5, 0x7A, 0x45, 0xF3, 0xB9, 0x49, 0x33, 0xFB, 0x66, 0x9D, 0xF3, 0xD0, 0xE7, 0x49, 0xE6,
+    0x49, 0x74, 0xE4, 0xCB, 0x99, 0x8C, 0xD3, 0x81, 0x38, 0x5C, 0xF4, 0x8C, 0x06, 0x34, 0x7D, 0x50,
+    0xEB, 0x1E, 0xB0, 0x7B, 0xAA, 0x7B, 0x60, 0xDD, 0x4A, 0xF7, 0x38, 0x68, 0x3A, 0xDD, 0x47, 0xB9,
+    0xD3, 0xEA, 0x3E, 0x2C, 0xDD, 0x46, 0xF7, 0x41, 0xE5, 0xD5, 0xBA, 0xF7, 0xEA, 0xA0, 0x04, 0x6D,
+    0x42, 0x50, 0xA7, 0xC5, 0xD9, 0x8F, 0x0D, 0x01, 0x5E, 0x7B, 0xB5, 0x4A, 0x48, 0x17, 0x17, 0xA4,
+    0xF6, 0x1B, 0x77, 0xA4, 0xC0, 0xA5, 0x99, 0xE2, 0x58, 0xD0, 0x34, 0xDB, 0x15, 0x85, 0xB6, 0x22,
+    0x4F, 0x2B, 0x32, 0xB3, 0x02, 0xB8, 0xA9, 0x15, 0x71, 0x61, 0xD5, 0x17, 0x24, 0x10, 0xF8, 0xAA,
+    0x87, 0x47, 0xAC, 0x28, 0xEC, 0x55, 0x0F, 0x4D, 0xAC, 0x7A, 0xE8, 0x64, 0x45, 0x2D, 0xAC, 0xA8,
+    0x8F, 0x15, 0x05, 0xBB, 0xA2, 0x60, 0x57, 0x0C, 0xBC, 0x56, 0x14, 0x2C, 0x88, 0x1A, 0x48, 0x32,
+    0x92, 0x98, 0x7B, 0x0A, 0x49, 0x7C, 0x41, 0x98, 0xC9, 0x03, 0x8F, 0x09, 0x25, 0xF4, 0x8B, 0x0A,
+    0xB8, 0xF5, 0xB4, 0xE8, 0x94, 0xDF, 0x31, 0x0A, 0xA2, 0xE3, 0x64, 0x02, 0x9F, 0x3C, 0xDE, 0x08,
+    0xF0, 0x54, 0x6E, 0x58, 0xAD, 0x25, 0x18, 0xA1, 0xBF, 0xF9, 0x8D, 0x8D, 0x95, 0xFA, 0x3D, 0x3A,
+    0xCC, 0xD4, 0x6F, 0x6C, 0x4F, 0x3B, 0xCA, 0xCE, 0x40, 0x6F, 0x8E, 0xF3, 0xA8, 0xE2, 0xCC, 0x40,
+    0x53, 0xC0, 0x3D, 0xE0, 0xF4, 0x5C, 0xC2, 0x02, 0x2A, 0x42, 0x0E, 0x68, 0x45, 0xD3, 0xC3, 0x8D,
+    0xDF, 0x11, 0xE8, 0x08, 0x29, 0x98, 0x39, 0xE8, 0xB8, 0x9D, 0xDE, 0x22, 0xE5, 0xE5, 0xD8, 0xF8,
+    0x7F, 0x6F, 0xEF, 0x47, 0x8D, 0x11, 0xA8, 0xDA, 0x42, 0xCF, 0x8F, 0x6E, 0x00, 0x3D, 0x3F, 0xF8,
+    0xDE, 0xCB, 0x97, 0xEE, 0xDD, 0xEC, 0x9D, 0xE9, 0x72, 0xEA, 0x90, 0x25, 0x9E, 0x3B, 0xF2, 0x58,
+    0x2D, 0x53, 0x4A, 0x46, 0x44, 0xA3, 0xE4, 0x94, 0xA6, 0x70, 0x26, 0xFF, 0x94, 0xDC, 0x0C, 0xC7,
+    0xF9, 0x44, 0xE4, 0xA7, 0x38, 0x6E, 0xA7, 0xB6, 0x67, 0xE7, 0xF3, 0x59, 0x2B, 0x8F, 0xF6, 0x1C,
+    0x32, 0x9F, 0xDC, 0xDA, 0x6F, 0x26, 0x2F, 0xB7, 0xF3, 0xAD, 0x77, 0xC7, 0xB1, 0x0D, 0x7E, 0xCE,
+    0xCD, 0x23, 0xF8, 0x4C, 0x1F, 0x6E, 0x1F, 0x77, 0x30, 0xC6, 0xB7, 0x05, 0x66, 0xA7, 0xC0, 0x3C,
+    0xB5, 0xBD, 0x88, 0xDD, 0xBE, 0x40, 0xC0, 0x86, 0x61, 0x35, 0x13, 0x9A, 0x86, 0x26, 0x37, 0x02,
+    0xF7, 0x7A, 0x8C, 0x5B, 0xD9, 0x2E, 0xDF, 0xC2, 0x3A, 0xD9, 0x67, 0x1F, 0x31, 0x1F, 0x40, 0xB0,
+    0xBF, 0x1D, 0x0F, 0x53, 0x6C, 0x6B, 0x47, 0xBE, 0x2D, 0x3F, 0x78, 0xE3, 0x84, 0xA8, 0xB3, 0x20,
+    0x77, 0x6B, 0xEE, 0x86, 0x0E, 0xE7, 0xC0, 0xD9, 0x81, 0xD5, 0xC0, 0x45, 0x38, 0x77, 0x05, 0xE1,
+    0x20, 0x16, 0x82, 0xCB, 0x37, 0x50, 0x26, 0xE2, 0x4A, 0x00, 0x41, 0x3F, 0x07, 0xAB, 0x4C, 0x92,
+    0x21, 0xCC, 0x61, 0x8C, 0x6F, 0xE2, 0x4F, 0xA0, 0xB3, 0xF0, 0x4F, 0xCD, 0x48, 0xFC, 0xBF, 0x30,
+    0xF8, 0xFB, 0xA7, 0x00, 0x4E, 0x49, 0xEC, 0x49, 0xC7, 0x48, 0x8E, 0xD2, 0x58, 0x48, 0xF0, 0xE7,
+    0xB6, 0x19, 0x03, 0x06, 0xAC, 0x84, 0xD9, 0x90, 0x56, 0x78, 0x0D, 0xD3, 0x59, 0x44, 0xE6, 0x35,
+    0x78, 0x58, 0x34, 0x58, 0x97, 0xF9, 0x31, 0x03, 0x31, 0x5C, 0x7B, 0xC6, 0x6A, 0x41, 0xE5, 0x74,
+    0x2B, 0x70, 0xC1, 0x04, 0xFE, 0x02, 0x41, 0x99, 0xD7, 0x78, 0x48, 0x41, 0x35, 0x46, 0x02, 0x94,
+    0x70, 0x75, 0x5B, 0xBF, 0x8A, 0x11, 0xA0, 0x39, 0x1D, 0xC6, 0xE4, 0x88, 0xFC, 0x7A, 0x8E, 0xA5,
+    0x41, 0x44, 0x69, 0xC0, 0xEB, 0x65, 0xAC, 0x7C, 0x46, 0x87, 0x0B, 0x6D, 0x63, 0x45, 0x9D, 0x28,
+    0xF7, 0x3F, 0xBC, 0x5E, 0xD8, 0x08, 0x32, 0x82, 0x44, 0xBE, 0xAE, 0x6C, 0xD6, 0x67, 0x46, 0xC5,
+    0x32, 0xCA, 0x64, 0x1E, 0x40, 0xFB, 0x64, 0x46, 0xAB, 0x99, 0x73, 0xE3, 0x08, 0x8D, 0x47, 0x19,
+    0x85, 0x14, 0x4F, 0x94, 0x33, 0x8C, 0xA7, 0xBA, 0xB1, 0x6A, 0xC6, 0x04, 0x38, 0xFE, 0x35, 0x45,
+    0xF1, 0xE7, 0x8A, 0x96, 0x51, 0x32, 0x86, 0x9A, 0xB2, 0x51, 0xF9, 0xCF, 0xA3, 0x91, 0x84, 0x5F,
+    0xE0, 0x69, 0xC4, 0x7E, 0x9A, 0x67, 0x0A, 0xEB, 0x0C, 0x18, 0x99, 0xF1, 0xB4, 0x8B, 0x73, 0x04,
+    0xCC, 0xAC, 0x2F, 0x60, 0x69, 0xCD, 0xA8, 0x68, 0xCD, 0x20, 0xE9, 0x92, 0xB9, 0x75, 0x46, 0x8F,
+    0x03, 0x13, 0x41, 0x2D, 0x07, 0x18, 0xB0, 0x31, 0xCE, 0x31, 0x42, 0x33, 0xA1, 0xBE, 0xB4, 0xB6,
+    0xAF, 0xD6, 0x30, 0x68, 0x84, 0x00, 0x98, 0x39, 0xFA, 0x0D, 0xB7, 0xF3, 0x2F, 0xF2, 0x2E, 0xEB,
+    0x6E, 0xE7, 0x74, 0xE8, 0x06, 0x84, 0x01, 0x44, 0xBA, 0x23, 0xA3, 0x49, 0xDB, 0x24, 0x79, 0xCC,
+    0x36, 0xA6, 0xD8, 0x85, 0x0F, 0x8B, 0xD7, 0x7F, 0xB8, 0x44, 0x48, 0x45, 0x1F, 0x28, 0x85, 0x88,
+    0xFF, 0x65, 0x26, 0xC5, 0x69, 0x55, 0x7B, 0x4F, 0x6F, 0xB7, 0x8E, 0x14, 0x0D, 0xF6, 0x40, 0xED,
+    0xF8, 0x71, 0xEF, 0xD2, 0x37, 0x9F, 0x9F, 0xF5, 0x50, 0x0F, 0x8F, 0xE2, 0x7E, 0x21, 0x0D, 0x3E,
+    0x86, 0xFC, 0x5D, 0xE7, 0x71, 0x1F, 0x99, 0xE1, 0xA1, 0x6F, 0xEA, 0x87, 0x4C, 0x7E, 0x4F, 0xAE,
+    0xA9, 0x03, 0x5C, 0x47, 0x92, 0x00, 0x9B, 0x4C, 0x32, 0xA6, 0xBC, 0x1B, 0xA6, 0xBC, 0x95, 0x4D,
+    0x79, 0x33, 0x3E, 0xD5, 0x2F, 0xAC, 0xD0, 0xC8, 0x03, 0x74, 0x91, 0xDC, 0xB0, 0xE4, 0xB0, 0x0E,
+    0x30, 0x70, 0x5A, 0x60, 0xAA, 0xF7, 0xA3, 0x29, 0x03, 0xB6, 0x49, 0x94, 0x79, 0xE4, 0x70, 0x5B,
+    0xDB, 0x5F, 0x56, 0x84, 0x5E, 0xCA, 0x20, 0x4E, 0x0F, 0x73, 0xFE, 0x83, 0x96, 0xDA, 0x3E, 0xEC,
+    0xEB, 0x0F, 0xB7, 0x6A, 0x8E, 0x45, 0xEC, 0x5F, 0x8D, 0x13, 0xDE, 0x52, 0x53, 0x96, 0xFC, 0x22,
+    0x12, 0x0F, 0x61, 0x0E, 0x79, 0x7D, 0x91, 0x23, 0xF9, 0x35, 0x39, 0xA6, 0x2A, 0x72, 0xCC, 0xA9,
+    0x73, 0x4C, 0x1E, 0x5F, 0xB3, 0x99, 0x70, 0xFF, 0x27, 0xBB, 0x30, 0xB3, 0xCD, 0x61, 0xF2, 0x45,
+    0x1E, 0x74, 0xC7, 0xC6, 0x4E, 0xA5, 0xB2, 0x2D, 0xD2, 0x66, 0x27, 0x9D, 0x13, 0x6C, 0xA6, 0x27,
+    0x64, 0x4E, 0xEA, 0x50, 0x02, 0xB1, 0x58, 0x79, 0x3D, 0x57, 0xB8, 0x40, 0x96, 0xCB, 0x82, 0xF5,
+    0x0B, 0xC3, 0xFF, 0x96, 0xFB, 0xB2, 0x4F, 0x27, 0x63, 0xE0, 0x2E, 0xB1, 0xCD, 0x3B, 0xBF, 0x1A,
+    0xE3, 0xDC, 0x98, 0xB1, 0x81, 0x64, 0xB0, 0xCE, 0x99, 0x45, 0x58, 0x0D, 0x0D, 0x6D, 0x77, 0xE5,
+    0xA6, 0xA9, 0xDD, 0x36, 0xAC, 0xE6, 0xF4, 0xEA, 0xC7, 0x9B, 0x7B, 0x07, 0xF7, 0x6F, 0xDA, 0xC6,
+    0xBD, 0x0C, 0x01, 0xD2, 0x6E, 0xCA, 0x6B, 0x78, 0x20, 0xF2, 0x32, 0x56, 0x5E, 0xF1, 0x15, 0x79,
+    0x85, 0x87, 0x44, 0xE4, 0x15, 0xCD, 0xF2, 0xCA, 0x66, 0x79, 0xFD, 0x75, 0x96, 0x57, 0x38, 0x2B,
+    0x26, 0x96, 0x94, 0x8B, 0x2A, 0x34, 0x2A, 0xFC, 0x0A, 0xF6, 0x16, 0xF0, 0x0C, 0x70, 0x0A, 0x08,
+    0xF2, 0x44, 0xBD, 0xC0, 0x22, 0xD8, 0x02, 0x93, 0xC3, 0x4E, 0x5B, 0xBD, 0xB9, 0xDF, 0xC3, 0x4A,
+    0x07, 0xD8, 0xDD, 0x82, 0x32, 0xBE, 0x69, 0x7B, 0x07, 0xB6, 0x9D, 0xD9, 0x3A, 0x82, 0xD4, 0x13,
+    0xF4, 0x4B, 0xFF, 0xD4, 0x3B, 0x92, 0xA3, 0x64, 0x6A, 0x1E, 0x35, 0x56, 0x22, 0xF4, 0x77, 0xF8,
+    0x26, 0x04, 0x96, 0x3F, 0x20, 0x49, 0xEE, 0x54, 0x51, 0x49, 0xBE, 0x9F, 0xBC, 0xB0, 0xB9, 0x5D,
+    0x02, 0x18, 0x4C, 0xA0, 0x8C, 0x04, 0xB8, 0x92, 0x20, 0xBC, 0x4B, 0x00, 0x28, 0x09, 0x74, 0x94,
+    0x90, 0x31, 0x98, 0x88, 0x06, 0x88, 0x68, 0x84, 0xE4, 0x1A, 0xE1, 0x40, 0x02, 0x7C, 0x4D, 0x64,
+    0x9B, 0x71, 0x99, 0xC0, 0xC4, 0x58, 0xBC, 0x4C, 0x80, 0x14, 0x27, 0xFA, 0xDB, 0x3E, 0xE3, 0xAE,
+    0xDE, 0x07, 0x1C, 0xC4, 0x5B, 0x75, 0x9A, 0x99, 0x2F, 0x59, 0xF7, 0xDC, 0x3C, 0xF8, 0xFA, 0xE9,
+    0x79, 0xAD, 0x4B, 0x64, 0xBC, 0x00, 0x62, 0xC4, 0x24, 0x38, 0x77, 0x04, 0xFA, 0xE5, 0x82, 0x38,
+    0xE2, 0xCD, 0x5E, 0x46, 0x0E, 0xF2, 0xD3, 0x9D, 0x9E, 0xB7, 0xAF, 0xAB, 0xE7, 0xA9, 0x06, 0x96,
+    0xD3, 0xAF, 0x5A, 0xE5, 0x0D, 0xF7, 0x25, 0xF0, 0xCB, 0xE8, 0x75, 0x31, 0xCD, 0x1A, 0x31, 0x9B,
+    0x1A, 0x09, 0x63, 0xB8, 0x60, 0x26, 0xF2, 0x33, 0x2C, 0xA5, 0x8B, 0x74, 0x96, 0x61, 0xDE, 0xE6,
+    0x78, 0xB0, 0x53, 0xED, 0xEA, 0x7B, 0xF2, 0x39, 0x05, 0xC3, 0x14, 0xD8, 0x77, 0x41, 0xD0, 0x6C,
+    0x0F, 0x41, 0x13, 0x22, 0x68, 0x22, 0x8E, 0xCF, 0x35, 0x5E, 0x01, 0xC3, 0xBF, 0xE9, 0xC1, 0x6F,
+    0x0A, 0xF1, 0xC4, 0x83, 0x23, 0x7A, 0xF0, 0x4B, 0xE1, 0x76, 0x24, 0xEF, 0x07, 0x3D, 0x12, 0xAA,
+    0xD3, 0xF5, 0x6F, 0x11, 0xDB, 0x60, 0x47, 0x36, 0x7E, 0x78, 0xE9, 0xD7, 0x96, 0x69, 0xB7, 0x2A,
+    0xA4, 0xC9, 0x55, 0x1F, 0x49, 0xC9, 0x6E, 0x31, 0xB9, 0x3D, 0xCF, 0x74, 0x29, 0x23, 0xD6, 0xF6,
+    0xBD, 0x82, 0x43, 0xE1, 0x13, 0x39, 0x59, 0x66, 0x63, 0xD9, 0x2D, 0xA8, 0x2E, 0xD4, 0x79, 0xC9,
+    0x72, 0xDC, 0x5C, 0xF8, 0x6D, 0xF8, 0x75, 0x24, 0x97, 0x8E, 0x4C, 0x9F, 0x99, 0xFE, 0x27, 0xCF,
+    0xEE, 0xBD, 0x4A, 0xD6, 0xCD, 0xEA, 0x30, 0x30, 0x38, 0x86, 0xA2, 0x59, 0xFB, 0x4A, 0xD0, 0xF4,
+    0x2B, 0xB6, 0x0C, 0xAD, 0x00, 0xC3, 0x46, 0xA7, 0xAE, 0x89, 0xEB, 0xDB, 0x06, 0x9B, 0xD1, 0xAE,
+    0xE9, 0x62, 0x82, 0xDD, 0xE5, 0x58, 0x97, 0xB3, 0x0A, 0x27, 0x0A, 0x2E, 0x28, 0xAF, 0x81, 0xA1,
+    0x21, 0x30, 0x10, 0xA1, 0x1E, 0xE3, 0xBA, 0xC6, 0x12, 0xA7, 0xE3, 0xCE, 0x7A, 0xD6, 0xE4, 0x56,
+    0x14, 0xEA, 0x42, 0xEA, 0xE3, 0x94, 0x45, 0x7C, 0x31, 0x55, 0xE9, 0x43, 0xE2, 0x36, 0x0B, 0x8B,
+    0x17, 0x4C, 0xF4, 0xFC, 0x9A, 0x11, 0x80, 0x18, 0xAF, 0x37, 0x88, 0xE5, 0x06, 0x86, 0xB6, 0x9B,
+    0x87, 0x4F, 0xB0, 0x0C, 0xE2, 0xC2, 0x8F, 0x52, 0x56, 0xAA, 0x23, 0xAA, 0x1C, 0x9D, 0x68, 0xF3,
+    0x7E, 0x9D, 0xF8, 0x90, 0x9B, 0xD7, 0x5C, 0x78, 0xF5, 0x8A, 0x09, 0x25, 0xB3, 0x1C, 0xB7, 0xED,
+    0xDC, 0x06, 0x33, 0x6F, 0x5A, 0xF5, 0x0C, 0x73, 0x6F, 0x1B, 0xF5, 0x1C, 0x92, 0x5C, 0xD7, 0x12,
+    0xE2, 0x67, 0xC0, 0xF6, 0x5A, 0xEA, 0x65, 0x54, 0x09, 0x6C, 0x16, 0x41, 0xE1, 0x54, 0x02, 0x5F,
+    0xDB, 0xD4, 0xC2, 0xED, 0x18, 0xE8, 0x48, 0xBD, 0x20, 0x23, 0xFB, 0x31, 0x03, 0xA0, 0x70, 0x3B,
+    0xBD, 0x5F, 0x90, 0x24, 0x41, 0x7E, 0xEA, 0x73, 0xBE, 0x26, 0x91, 0xAA, 0xA3, 0x4F, 0xC1, 0x23,
+    0xD4, 0xC1, 0xA0, 0x81, 0x6A, 0xCD, 0x94, 0x18, 0xE3, 0x75, 0x12, 0x93, 0x57, 0x48, 0x22, 0x31,
+    0xBF, 0x9E, 0x24, 0xE6, 0xB6, 0x2C, 0x89, 0xEF, 0x24, 0x76, 0xC1, 0xB3, 0x46, 0xF3, 0x98, 0x89,
+    0x25, 0x2F, 0x5B, 0x4F, 0x12, 0xF3, 0xE7, 0x38, 0x4C, 0x6A, 0xE8, 0x7E, 0x7D, 0x50, 0x48, 0xE7,
+    0x71, 0xFC, 0x21, 0x39, 0x2B, 0xD8, 0xAD, 0xE0, 0x7D, 0x4D, 0x63, 0x44, 0x3B, 0x39, 0x3B, 0xDF,
+    0xBD, 0xD7, 0x61, 0x34, 0xC7, 0xF1, 0x1C, 0x19, 0x8D, 0x35, 0xDD, 0xC1, 0x1E, 0xA3, 0xBC, 0x0D,
+    0xEF, 0x91, 0x9A, 0x7C, 0x76, 0x76, 0x96, 0xB2, 0xBA, 0x56, 0x48, 0x9D, 0xE4, 0xF8, 0xF3, 0xE9,
+    0x98, 0x97, 0x7A, 0xBD, 0x94, 0xF5, 0xA9, 0x3F, 0xA7, 0x3E, 0x28, 0x35, 0x7F, 0xFF, 0x50, 0x05,
+    0x76, 0x5A, 0xB6, 0xB3, 0xB3, 0xB3, 0xB9, 0x44, 0xCF, 0xE0, 0x93, 0x05, 0xDD, 0xE9, 0x7A, 0x66,
+    0x3F, 0xF7, 0xC6, 0x57, 0x7E, 0x39, 0x2B, 0xC9, 0xF6, 0x95, 0x9F, 0x5B, 0xBE, 0xE7, 0x97, 0xA7,
+    0x41, 0xB9, 0x0A, 0xF3, 0x3E, 0xBA, 0xD3, 0x69, 0x1C, 0x01, 0x5E, 0x93, 0xF9, 0xCD, 0x89, 0x73,
+    0x37, 0xAC, 0x2E, 0xC3, 0x72, 0x88, 0xCA, 0x3E, 0xBE, 0xD3, 0xC5, 0x6E, 0x9B, 0x78, 0xCD, 0xA9,
+    0x57, 0x3F, 0xF4, 0xCB, 0xB7, 0xA6, 0x58, 0x89, 0x2F, 0x1D, 0x82, 0xAA, 0x48, 0x75, 0x19, 0x36,
+    0x45, 0x4E, 0xCA, 0xFC, 0x3B, 0xAC, 0x8F, 0xE0, 0x1D, 0xE8, 0x83, 0x48, 0xC7, 0xB9, 0x27, 0xC1,
+    0x0E, 0x5F, 0x3E, 0x68, 0xBE, 0x58, 0x64, 0x02, 0xC1, 0xEA, 0x39, 0xCD, 0xAA, 0x15, 0x09, 0x53,
+    0xC0, 0x87, 0x17, 0x44, 0x40, 0x91, 0x61, 0xAD, 0xAC, 0xE7, 0xCB, 0x07, 0xC4, 0x41, 0xF7, 0x9F,
+    0xDD, 0xBD, 0xBE, 0xE7, 0xF7, 0x71, 0x91, 0xF8, 0x0C, 0x3C, 0x7F, 0xC2, 0xA3, 0xF7, 0x17, 0x44,
+    0x7D, 0x89, 0x00, 0x83, 0x52, 0x82, 0xAA, 0x1D, 0x01, 0x97, 0x01, 0x62, 0x7C, 0x10, 0x70, 0x28,
+    0x4F, 0xDF, 0x14, 0x01, 0x07, 0x10, 0x5E, 0x64, 0x3E, 0x85, 0x4F, 0x9A, 0x0F, 0x78, 0x80, 0x04,
+    0xE5, 0xC4, 0xC1, 0x3E, 0xF9, 0x5E, 0x39, 0x10, 0xCD, 0x59, 0xD5, 0x1D, 0x8F, 0xBA, 0x8B, 0x4A,
+    0xAB, 0xBC, 0xA8, 0xB4, 0xDA, 0x0B, 0xF3, 0x59, 0x64, 0xDF, 0xB8, 0x5A, 0x0D, 0x86, 0xB9, 0x55,
+    0x61, 0x98, 0x5B, 0x1D, 0x4E, 0xFD, 0x7F, 0xF8, 0xAB, 0xDD, 0xCF, 0xAD, 0x71, 0x3F, 0x61, 0x6E,
+    0xF7, 0x83, 0xAB, 0xEC, 0x47, 0x5E, 0x73, 0xEE, 0xED, 0xE7, 0xEA, 0xF5, 0xFF, 0x6D, 0x3F, 0xFF,
+    0x03, 0xB5, 0x55, 0x31, 0x8C, 0xDD, 0x44, 0x10, 0x9D, 0xF5, 0xEA, 0xB0, 0x14, 0x17, 0xA6, 0x20,
+    0x0D, 0x29, 0xB6, 0xA1, 0x4A, 0xA4, 0xB8, 0x4D, 0x71, 0xDF, 0xB6, 0x84, 0xE8, 0x53, 0x70, 0xA4,
+    0xB8, 0x86, 0x16, 0x9A, 0x6B, 0x52, 0x50, 0xF8, 0x62, 0x23, 0x0A, 0x0A, 0x9A, 0x93, 0x10, 0x34,
+    0x69, 0x83, 0x84, 0x8E, 0xE2, 0x1A, 0x0A, 0x22, 0xF9, 0x62, 0x8B, 0x82, 0x36, 0x06, 0x89, 0xDE,
+    0xC5, 0x55, 0x34, 0xD9, 0xC2, 0x48, 0x3E, 0xE4, 0xEF, 0xE5, 0xBD, 0xF5, 0xFF, 0x77, 0x11, 0x7C,
+    0x71, 0x4D, 0xD8, 0xDB, 0x9D, 0xDD, 0xDB, 0x3F, 0xBB, 0x3B, 0xF3, 0xE6, 0xCD, 0xB8, 0x8E, 0xBA,
+    0x7A, 0xE9, 0x61, 0x8B, 0x5E, 0xA0, 0x6B, 0xF6, 0x07, 0xBA, 0x12, 0xF9, 0x51, 0xF5, 0x22, 0x32,
+    0x68, 0x4A, 0xAB, 0x3B, 0x11, 0x65, 0x75, 0x2B, 0x12, 0xD8, 0x90, 0xB2, 0x8F, 0x20, 0x75, 0x17,
+    0x55, 0x72, 0xEB, 0x87, 0xBF, 0xCE, 0xFE, 0xC8, 0x63, 0x87, 0x56, 0xED, 0x1D, 0xFE, 0x7E, 0x74,
+    0x90, 0x4B, 0x54, 0x25, 0x38, 0x14, 0xE7, 0xA9, 0x97, 0x2B, 0x48, 0x23, 0xFB, 0x90, 0x89, 0x14,
+    0x22, 0x19, 0x14, 0xE7, 0x8D, 0x94, 0x95, 0x0C, 0xD8, 0xDF, 0x17, 0x0B, 0x59, 0x28, 0xCA, 0x3A,
+    0xA0, 0x1C, 0x83, 0xE5, 0xF1, 0x6E, 0xFB, 0xB8, 0x28, 0x0C, 0xBC, 0xE6, 0xC7, 0x9D, 0x13, 0x09,
+    0x9D, 0xEB, 0x8C, 0x73, 0xB6, 0x7C, 0xFA, 0xAD, 0x3D, 0xC7, 0xDE, 0xB4, 0x19, 0x6B, 0x8C, 0xF2,
+    0xAB, 0x4A, 0x12, 0x57, 0x41, 0x67, 0x14, 0x29, 0xB1, 0x88, 0x9C, 0x95, 0xE8, 0xCB, 0x11, 0x67,
+    0x27, 0x8C, 0x9A, 0x73, 0x1E, 0x7D, 0x3E, 0xCD, 0x87, 0x67, 0x03, 0xCC, 0xE8, 0x4A, 0x5A, 0x72,
+    0xA7, 0xBA, 0xBE, 0x9F, 0x63, 0x69, 0xC1, 0x4C, 0x0F, 0x24, 0x76, 0x2D, 0x8C, 0x97, 0xE4, 0xFD,
+    0x1E, 0x16, 0x4B, 0x0A, 0x43, 0x6B, 0xDA, 0x6E, 0x69, 0x7D, 0x01, 0x33, 0xAD, 0x9F, 0x08, 0x0C,
+    0xA6, 0xB8, 0xF2, 0x93, 0xF1, 0x8E, 0x0D, 0xE9, 0x5B, 0x27, 0xB2, 0x52, 0xB6, 0xCE, 0x26, 0xB9,
+    0x1F, 0xD8, 0xE1, 0x45, 0x23, 0xE6, 0xE9, 0x6F, 0x76, 0x88, 0xF3, 0xC8, 0x7D, 0xF1, 0xAB, 0x8D,
+    0x2B, 0xF5, 0x3C, 0xFE, 0xD9, 0x12, 0x4C, 0x13, 0xF4, 0xBC, 0x20, 0xD5, 0x7E, 0x2A, 0x96, 0x69,
+    0xF4, 0x9B, 0x81, 0x0D, 0xA8, 0xA2, 0x3B, 0x85, 0x03, 0x82, 0xD5, 0x68, 0x72, 0x9A, 0x55, 0xC2,
+    0xBA, 0x0C, 0x27, 0x47, 0x6F, 0xAB, 0xCA, 0xB7, 0x56, 0x1B, 0xC7, 0x65, 0xE3, 0x80, 0xA1, 0x9A,
+    0x0F, 0x61, 0xA3, 0x1E, 0x14, 0x74, 0x60, 0xE6, 0x74, 0x2D, 0xB9, 0xA3, 0x46, 0x4D, 0xFC, 0xD7,
+    0x86, 0x68, 0x67, 0x0D, 0xDD, 0x36, 0x6B, 0xDE, 0x50, 0x72, 0x3B, 0x70, 0x6B, 0xD1, 0x7D, 0x34,
+    0x94, 0x55, 0xD8, 0x99, 0xD6, 0xF4, 0x71, 0x9B, 0xE5, 0xE1, 0x08, 0x89, 0x5B, 0xB3, 0x3C, 0x23,
+    0xB6, 0xFE, 0xF9, 0x89, 0x32, 0x9A, 0x24, 0x69, 0x25, 0x9B, 0x25, 0xBE, 0x7C, 0xE4, 0x70, 0xC2,
+    0xB9, 0x31, 0xEE, 0x61, 0x43, 0xA5, 0x27, 0x51, 0x0F, 0x19, 0x58, 0xB6, 0xA2, 0x28, 0x1E, 0x78,
+    0x43, 0xC3, 0x7E, 0x19, 0x8C, 0x2D, 0xC6, 0x7B, 0xBA, 0xDD, 0x2B, 0xBF, 0xFE, 0x65, 0x6E, 0x10,
+    0x8F, 0x77, 0x9B, 0xF9, 0x3B, 0x89, 0x61, 0x40, 0x06, 0x90, 0xCF, 0xF1, 0xD8, 0x94, 0x54, 0x7A,
+    0x88, 0x3B, 0x8F, 0xC1, 0xDB, 0x8A, 0xE4, 0x93, 0x1B, 0x44, 0x89, 0x6B, 0x72, 0x2F, 0x6E, 0x3F,
+    0xFA, 0xF3, 0xE0, 0xA6, 0x13, 0xE2, 0x81, 0xBB, 0x8F, 0xF1, 0x84, 0x76, 0x62, 0x00, 0x20, 0x35,
+    0x78, 0xA8, 0x84, 0xFC, 0x8F, 0x60, 0x64, 0xCC, 0x10, 0x55, 0xE4, 0xB0, 0xC7, 0x5C, 0x8E, 0x17,
+    0x35, 0x01, 0x8A, 0xC1, 0x46, 0x35, 0xFC, 0x0F, 0xD5, 0x6D, 0x0B, 0xF9, 0x56, 0x49, 0x00, 0x1C,
+    0x17, 0x44, 0x61, 0x7E, 0x7D, 0x91, 0x75, 0x9B, 0xDF, 0x25, 0x61, 0x54, 0x95, 0xE3, 0xFF, 0x86,
+    0xBF, 0x48, 0x73, 0xC1, 0x14, 0x70, 0xB2, 0x55, 0x08, 0xF3, 0xEB, 0x6B, 0x99, 0x4E, 0x8B, 0xD8,
+    0xD5, 0xEE, 0x9E, 0x9E, 0x9E, 0xFE, 0x53, 0xE5, 0xF1, 0xD5, 0x3D, 0xC9, 0x12, 0xEB, 0x5D, 0x4B,
+    0x75, 0xF5, 0x5A, 0x04, 0x13, 0x54, 0xD3, 0x2D, 0xFC, 0x08, 0xDC, 0x09, 0x9E, 0x1C, 0xB7, 0x17,
+    0x3C, 0x7E, 0xED, 0x29, 0x75, 0xF6, 0xCC, 0x1F, 0x41, 0x31, 0x00, 0x28, 0xEE, 0x9B, 0x23, 0x68,
+    0x81, 0x5D, 0x0A, 0xC7, 0x4B, 0xDE, 0x5A, 0x91, 0x76, 0x40, 0x09, 0x78, 0xED, 0x01, 0xB4, 0xB0,
+    0x25, 0xC9, 0x90, 0x32, 0x31, 0x72, 0x70, 0x34, 0x92, 0xA1, 0x66, 0xD4, 0x09, 0x62, 0x90, 0x4A,
+    0x91, 0x02, 0x5B, 0x4C, 0x2B, 0x44, 0xC2, 0x4F, 0x16, 0x19, 0xB7, 0x99, 0x6A, 0x6E, 0x1E, 0xCB,
+    0xB8, 0x82, 0xCA, 0x5A, 0x6C, 0x2A, 0xE7, 0x81, 0xD3, 0x7D, 0x22, 0xD9, 0xAB, 0x97, 0xAF, 0x5A,
+    0x23, 0xF1, 0xAC, 0x9D, 0x20, 0x53, 0x1E, 0xE2, 0x2F, 0xEC, 0xBC, 0x5D, 0x9E, 0xE7, 0x68, 0xF3,
+    0x92, 0x27, 0xC9, 0xE5, 0x07, 0x67, 0x15, 0x83, 0xE0, 0xBC, 0xB3, 0xF7, 0xDC, 0x33, 0x1F, 0xCD,
+    0x60, 0xF8, 0x1F, 0x84, 0xB6, 0x2F, 0x28, 0xE0, 0x7E, 0xD4, 0x67, 0xA8, 0x23, 0x6D, 0x7C, 0xF9,
+    0x91, 0xCB, 0xB5, 0x83, 0xE3, 0xC0, 0x89, 0x04, 0xFC, 0xD0, 0xA7, 0x12, 0xFB, 0x29, 0x29, 0xF8,
+    0x46, 0xFA, 0x72, 0xE1, 0xED, 0x03, 0xCF, 0xBE, 0x74, 0xC3, 0x44, 0x94, 0x0D, 0xCF, 0x4E, 0xD6,
+    0x1B, 0x9F, 0x7D, 0x76, 0x61, 0x2F, 0x59, 0xEC, 0xD9, 0x7C, 0xBC, 0x51, 0x24, 0x75, 0x49, 0x61,
+    0xAF, 0xDC, 0x2D, 0x59, 0x40, 0x65, 0x66, 0x85, 0x57, 0xAC, 0x37, 0xD9, 0x92, 0x81, 0x52, 0xE8,
+    0xF9, 0xDD, 0x26, 0x97, 0xE4, 0xCD, 0x74, 0xDC, 0x86, 0x0E, 0xCB, 0x85, 0xDF, 0x1B, 0x09, 0xF9,
+    0x3D, 0x60, 0x39, 0x10, 0xC3, 0x47, 0x53, 0x7E, 0x4E, 0xF6, 0x69, 0xDF, 0x4F, 0xA8, 0x80, 0x32,
+    0x44, 0x2C, 0x8F, 0xA8, 0x20, 0x1A, 0xF5, 0x81, 0x7E, 0x0D, 0x2C, 0x8C, 0x35, 0x1D, 0x58, 0xD1,
+    0x6D, 0xFF, 0xC9, 0x89, 0xF3, 0xAB, 0x24, 0xD9, 0x26, 0xC0, 0xA7, 0xA0, 0x9A, 0x69, 0xC3, 0x1E,
+    0x0E, 0x7D, 0x26, 0xF2, 0x89, 0x68, 0x16, 0x2E, 0xD0, 0x93, 0xDE, 0xEF, 0xEC, 0xE7, 0x72, 0x6F,
+    0x94, 0x0C, 0xBF, 0x0F, 0xA2, 0xD6, 0xDE, 0xF7, 0xDD, 0x9A, 0xB9, 0x98, 0x0B, 0x66, 0x0B, 0x19,
+    0x2F, 0xEF, 0xAC, 0x6E, 0x6A, 0xF2, 0xBD, 0x08, 0x52, 0xA5, 0xB1, 0x64, 0x28, 0x73, 0xE3, 0xDF,
+    0x1D, 0x70, 0xE3, 0xC1, 0xEC, 0x42, 0xC2, 0x91, 0xA5, 0x1E, 0x40, 0x4F, 0x3B, 0xD4, 0x70, 0x16,
+    0x91, 0x34, 0x56, 0x50, 0x31, 0xE6, 0xA5, 0xD4, 0x5C, 0xA2, 0xB2, 0x65, 0xEE, 0x22, 0xCA, 0x9F,
+    0x1C, 0x81, 0xE6, 0x1F, 0x4B, 0xC3, 0xD2, 0x8E, 0x5A, 0xFC, 0x37, 0xD5, 0x5A, 0x3D, 0x8C, 0xDC,
+    0xD6, 0x11, 0x1E, 0x92, 0xD2, 0xD1, 0x10, 0x81, 0x50, 0x85, 0x64, 0x04, 0x16, 0x2C, 0xBA, 0x48,
+    0x11, 0x0B, 0xB1, 0xD8, 0xBA, 0xB8, 0x5B, 0xD2, 0x48, 0x91, 0x22, 0x85, 0x55, 0xE8, 0x2C, 0x20,
+    0x2E, 0x54, 0xC7, 0x41, 0x70, 0x29, 0x5C, 0xB8, 0x58, 0x2D, 0x99, 0x2A, 0x65, 0xAE, 0x71, 0x95,
+    0x46, 0x85, 0x03, 0xC8, 0x7B, 0x40, 0xCE, 0xC5, 0x01, 0x51, 0x80, 0xBD, 0x5B, 0x02, 0x29, 0x52,
+    0xA4, 0x08, 0x81, 0xA4, 0x37, 0x93, 0xC8, 0x06, 0xE2, 0x46, 0x44, 0x42, 0x23, 0x7B, 0x07, 0xEE,
+    0xBE, 0x7C, 0xDF, 0x3C, 0xEE, 0xDE, 0x9E, 0x4E, 0x92, 0x25, 0xE7, 0x4E, 0x3E, 0xEF, 0x2E, 0xE7,
+    0xED, 0x71, 0xDF, 0xCF, 0xCC, 0xBC, 0x99, 0x79, 0xDF, 0x0C, 0x4F, 0x24, 0x91, 0x71, 0x3A, 0x4E,
+    0x13, 0x39, 0x27, 0x7C, 0xBD, 0x81, 0xF7, 0x75, 0xBC, 0x7B, 0xFA, 0x4E, 0x1E, 0x79, 0x67, 0x78,
+    0x77, 0xAF, 0xA0, 0xE8, 0xAE, 0xBF, 0x89, 0x63, 0x4C, 0xE1, 0xE3, 0x8A, 0x9A, 0x95, 0x34, 0xC9,
+    0x45, 0xFB, 0xEC, 0xE2, 0x6A, 0x1F, 0x73, 0x4D, 0x71, 0xED, 0x89, 0xED, 0x93, 0x14, 0x92, 0x86,
+    0x07, 0x3F, 0xD3, 0xB1, 0x92, 0xCD, 0xBA, 0xF9, 0x72, 0x7B, 0x39, 0xF3, 0x85, 0x56, 0xCC, 0x03,
+    0x91, 0xD8, 0x18, 0x91, 0xF1, 0x87, 0xBB, 0x9C, 0xE4, 0x9C, 0x38, 0x13, 0xDC, 0x77, 0x9B, 0xA7,
+    0x91, 0x31, 0xE7, 0x34, 0x24, 0xB7, 0xF6, 0xD7, 0xD3, 0xC7, 0x76, 0xF1, 0xEA, 0x39, 0x09, 0x0B,
+    0x8E, 0xF8, 0x62, 0x38, 0xCC, 0x0D, 0x87, 0x28, 0xD1, 0xB5, 0x5F, 0x95, 0xF4, 0x55, 0x89, 0x37,
+    0x66, 0x03, 0x09, 0x8D, 0x69, 0xC5, 0x6B, 0xFC, 0x5A, 0xFC, 0x42, 0x1A, 0x72, 0x38, 0x92, 0x30,
+    0x95, 0xD5, 0x05, 0xE9, 0x93, 0xFB, 0x89, 0x78, 0x95, 0x8B, 0x2E, 0xB3, 0x8D, 0x46, 0x22, 0x63,
+    0xA6, 0x12, 0xAF, 0x7C, 0xD4, 0xA3, 0x66, 0xCF, 0xC9, 0x80, 0xAB, 0x26, 0x5C, 0x30, 0xCA, 0x25,
+    0x28, 0xC3, 0x12, 0xAB, 0x62, 0xB6, 0x98, 0xBC, 0x0C, 0x28, 0x16, 0xB4, 0xB3, 0x4B, 0xC1, 0x12,
+    0xB2, 0x14, 0xFF, 0xA8, 0x02, 0x5B, 0x7F, 0xA1, 0x3E, 0x1E, 0xA6, 0xE2, 0xDC, 0x32, 0xEB, 0xE2,
+    0x81, 0x2B, 0x4B, 0xAC, 0x26, 0x49, 0x9C, 0xF5, 0x69, 0xF7, 0x83, 0x3B, 0x9C, 0x0D, 0x97, 0x7E,
+    0x38, 0x24, 0x97, 0xD6, 0x96, 0x5E, 0x97, 0x3A, 0x9D, 0xBE, 0xBE, 0x7C, 0x53, 0xE4, 0xF2, 0x4D,
+    0x71, 0x8D, 0x29, 0x21, 0x63, 0x19, 0xE5, 0x4E, 0x1E, 0xA3, 0x47, 0x9C, 0x8A, 0x44, 0x25, 0x96,
+    0xC7, 0x86, 0xB9, 0xA6, 0x12, 0xDF, 0xCC, 0x24, 0xCC, 0xB3, 0x22, 0x96, 0xA0, 0x8A, 0x21, 0x04,
+    0xF8, 0x86, 0x20, 0x5E, 0x1D, 0x36, 0x7E, 0xE9, 0x99, 0xED, 0x5C, 0x32, 0xC3, 0x8E, 0xB9, 0x1D,
+    0x05, 0xC1, 0x54, 0xB3, 0x7E, 0xD5, 0x4B, 0xA3, 0x32, 0x31, 0x26, 0xBD, 0x62, 0x26, 0xBA, 0xF2,
+    0x39, 0x49, 0x13, 0xB7, 0x4E, 0xDC, 0xE6, 0xBA, 0x53, 0xCF, 0x77, 0x58, 0x36, 0xCC, 0x26, 0x2D,
+    0x6A, 0xB6, 0x4D, 0xEB, 0x80, 0x05, 0x6D, 0x60, 0x9A, 0x09, 0x47, 0x43, 0x9D, 0x72, 0x13, 0x5F,
+    0x83, 0x3C, 0x30, 0xC5, 0x9A, 0x84, 0x58, 0xA5, 0x88, 0x60, 0xA1, 0x53, 0x18, 0x4E, 0xBA, 0xCA,
+    0x5D, 0xF4, 0xF3, 0x55, 0x2E, 0xE4, 0x15, 0x1F, 0xA0, 0xAB, 0x36, 0xE5, 0xF1, 0x66, 0xD5, 0xFE,
+    0xB6, 0xEA, 0x92, 0xA5, 0xFC, 0x0D, 0xCE, 0x1D, 0xA4, 0xA1, 0x8C, 0xB7, 0x8A, 0x10, 0x53, 0x47,
+    0x9C, 0xDA, 0x2B, 0x9D, 0xDF, 0x62, 0x4B, 0xB9, 0x01, 0x9C, 0x2F, 0x4B, 0x25, 0xA6, 0xF2, 0x0F,
+    0xDE, 0x9D, 0x89, 0x5A, 0x53, 0xC5, 0xC6, 0xB9, 0x61, 0xF9, 0xBD, 0x32, 0x93, 0x64, 0x9C, 0x5F,
+    0xF4, 0x0A, 0x0E, 0xDB, 0x2A, 0x63, 0x53, 0x8E, 0xBC, 0xB2, 0xC1, 0xC7, 0x2F, 0xF7, 0x36, 0xCA,
+    0xF8, 0xCB, 0xB2, 0x93, 0x54, 0x7A, 0x4E, 0x23, 0xAD, 0x5F, 0xBB, 0x4D, 0x58, 0x04, 0x55, 0x22,
+    0x51, 0x3E, 0x95, 0xCC, 0x9D, 0xC8, 0x9E, 0xD7, 0x48, 0x92, 0xB6, 0x12, 0x96, 0x99, 0xDA, 0x83,
+    0xD3, 0x06, 0x95, 0x0C, 0x70, 0xF3, 0x07, 0xA2, 0xEB, 0x64, 0xD8, 0xD1, 0x54, 0xC9, 0xE5, 0xF5,
+    0xF5, 0xDB, 0x29, 0x2D, 0xF4, 0x49, 0xE4, 0x82, 0x65, 0x2F, 0xC5, 0x67, 0x7D, 0x5D, 0x9E, 0x4D,
+    0xA3, 0xA2, 0x1A, 0x1D, 0xCF, 0x84, 0x1A, 0x1D, 0x5B, 0x8D, 0x8E, 0xFC, 0x0A, 0x1A, 0x95, 0x91,
+    0x57, 0x43, 0xA3, 0x6C, 0xA0, 0x3C, 0x34, 0x15, 0x9B, 0xDD, 0x8D, 0x82, 0xCD, 0xD8, 0x50, 0xA3,
+    0xB2, 0xB7, 0x47, 0x55, 0xCA, 0x28, 0xB6, 0x0D, 0xAC, 0x38, 0xE7, 0xF0, 0x92, 0x1A, 0xC5, 0x38,
+    0x6A, 0x74, 0xE4, 0x4C, 0xA8, 0xD1, 0x9B, 0x72, 0xF3, 0x99, 0x34, 0x7A, 0x6D, 0x38, 0x1C, 0x6E,
+    0xC2, 0x48, 0x4C, 0xCD, 0x6F, 0x77, 0x45, 0x0D, 0x29, 0x34, 0xB0, 0xB1, 0xD1, 0x9A, 0xAC, 0xAE,
+    0xCA, 0x1A, 0x3E, 0xF8, 0x82, 0x3F, 0x71, 0x53, 0x6D, 0x0C, 0x3D, 0xAA, 0xAF, 0x22, 0x4B, 0x4A,
+    0xBC, 0xF5, 0xE5, 0xFA, 0x57, 0x8D, 0xE0, 0x0B, 0xCA, 0x5E, 0x5F, 0x1A, 0x06, 0xCB, 0x0B, 0x4C,
+    0x9E, 0x6C, 0x55, 0x2F, 0xD1, 0x54, 0x6B, 0x01, 0x75, 0xD5, 0xFD, 0xA3, 0x54, 0xEE, 0x08, 0x76,
+    0xD6, 0x2F, 0xF9, 0x35, 0x31, 0x35, 0x3E, 0x1C, 0x7F, 0x13, 0x3E, 0x5F, 0x24, 0xBF, 0xA9, 0x2F,
+    0x2D, 0xFA, 0x07, 0xA5, 0x6F, 0x52, 0x77, 0xBB, 0x62, 0x6F, 0xEA, 0x7F, 0x82, 0x2F, 0x83, 0xAD,
+    0x3A, 0x33, 0xB9, 0x73, 0x53, 0x9C, 0x7B, 0xDE, 0x24, 0xA8, 0xA2, 0xBC, 0x27, 0x1F, 0x20, 0xD4,
+    0x4A, 0x92, 0x3C, 0xDF, 0x95, 0xE1, 0x1A, 0x27, 0xB9, 0x63, 0x92, 0xEA, 0x8A, 0x81, 0xF6, 0xE2,
+    0x5E, 0x36, 0x89, 0x7B, 0x0E, 0x18, 0xE2, 0x96, 0x3F, 0xE1, 0x42, 0xC4, 0x40, 0x34, 0x44, 0x70,
+    0x84, 0xD3, 0x9A, 0x2D, 0x7A, 0xBC, 0x5B, 0x46, 0x24, 0xC9, 0x33, 0x12, 0xED, 0xAC, 0xC3, 0x3C,
+    0x12, 0x4C, 0x05, 0x22, 0xE1, 0xFF, 0x4B, 0xF4, 0xA5, 0x27, 0x51, 0x9E, 0xC1, 0x73, 0xBC, 0x02,
+    0xD6, 0x54, 0x3B, 0x2D, 0xA2, 0xEA, 0x68, 0xDC, 0x64, 0xB0, 0x65, 0xB8, 0x48, 0x9B, 0x8D, 0xFA,
+    0xFD, 0x8B, 0x7D, 0x39, 0xFE, 0xE6, 0xCB, 0x9F, 0x49, 0xFC, 0xB0, 0xE8, 0xBB, 0xF5, 0x8E, 0xD4,
+    0x8D, 0xEC, 0xD4, 0xFA, 0xD9, 0x91, 0xA6, 0xEF, 0xD4, 0xF1, 0x56, 0x19, 0x98, 0xB9, 0x4B, 0xDE,
+    0x81, 0x31, 0x26, 0x98, 0x39, 0x2C, 0x06, 0x08, 0x53, 0x71, 0xEE, 0x4C, 0x10, 0x8A, 0xF7, 0x70,
+    0x33, 0x73, 0xE9, 0xAB, 0x95, 0xD7, 0x44, 0x45, 0x50, 0x26, 0x12, 0xE7, 0xAD, 0x0C, 0x70, 0xEB,
+    0x07, 0x4E, 0x67, 0x1E, 0xF7, 0x45, 0xAE, 0x8A, 0x8F, 0x88, 0xBA, 0x26, 0x31, 0xE8, 0x48, 0x76,
+    0xFB, 0xDC, 0xE2, 0xD7, 0xFA, 0xEA, 0x52, 0x1A, 0xFE, 0x41, 0xE9, 0x94, 0x7D, 0x61, 0x04, 0xB5,
+    0x8C, 0xF5, 0x65, 0x82, 0x2D, 0x01, 0x5B, 0xF0, 0xF0, 0xBE, 0x57, 0x86, 0xA0, 0x61, 0x9E, 0x80,
+    0x46, 0xF2, 0xFB, 0x4A, 0x2E, 0xF5, 0x9C, 0xFF, 0x60, 0xF0, 0xC8, 0xFB, 0x23, 0x68, 0x13, 0xFC,
+    0x90, 0xEE, 0x79, 0x15, 0xD3, 0xF9, 0xC5, 0x1A, 0x68, 0x08, 0xAF, 0x86, 0x54, 0x30, 0xC9, 0x29,
+    0xE7, 0xC2, 0x1D, 0xFA, 0x52, 0x45, 0xEB, 0xC2, 0xF7, 0x3B, 0xE4, 0x47, 0xDC, 0x19, 0x19, 0x92,
+    0x68, 0x46, 0x8E, 0xA4, 0xD7, 0x23, 0x4B, 0x98, 0xD6, 0xBA, 0x79, 0x4F, 0x99, 0x42, 0xA3, 0xA1,
+    0xA2, 0xA7, 0x6C, 0xA1, 0xE9, 0xDB, 0x66, 0xB2, 0x02, 0xBD, 0xF6, 0xDC, 0x1A, 0x07, 0x9B, 0xF4,
+    0xBC, 0xBF, 0xEE, 0x8F, 0xD1, 0x84, 0x79, 0x1E, 0xA1, 0x89, 0x34, 0xBA, 0x60, 0x1A, 0xC1, 0x37,
+    0x4E, 0x7C, 0x1D, 0x4D, 0x23, 0x1D, 0x17, 0x34, 0x66, 0xB8, 0x81, 0x5F, 0x6A, 0x2F, 0xB8, 0x00,
+    0x27, 0xBE, 0xA3, 0xC2, 0xF2, 0x27, 0x9E, 0x82, 0x38, 0x91, 0xC0, 0x88, 0xA7, 0x87, 0x95, 0x85,
+    0x0B, 0xF0, 0x27, 0xCC, 0x90, 0xC0, 0xED, 0xE1, 0x44, 0xDF, 0xC7, 0xC5, 0xD0, 0x0C, 0x2F, 0x09,
+    0x79, 0xD6, 0xD7, 0xBA, 0x0E, 0xA6, 0x86, 0x28, 0xBE, 0xE1, 0xD9, 0xCA, 0x46, 0x27, 0x5B, 0xA9,
+    0x55, 0x14, 0x99, 0xF8, 0xC5, 0x65, 0x36, 0x61, 0x3A, 0x20, 0x2F, 0xB1, 0xCC, 0xE4, 0x0F, 0x7E,
+    0xDD, 0x87, 0xFC, 0x99, 0x29, 0x27, 0xFE, 0xEF, 0x64, 0xE5, 0x63, 0xB7, 0x0E, 0x7B, 0x9C, 0xA6,
+    0x5C, 0x63, 0x13, 0xE4, 0xF7, 0xD9, 0x44, 0x52, 0xB3, 0xE9, 0x79, 0x25, 0xED, 0x7F, 0x04, 0xAC,
+    0x41, 0x55, 0x7B, 0x6C, 0x38, 0x71, 0x4F, 0x45, 0x61, 0x43, 0x1D, 0xF5, 0x2C, 0xB3, 0x8C, 0x57,
+    0x41, 0x63, 0x2F, 0x05, 0x08, 0xE9, 0x61, 0x64, 0x65, 0xB4, 0xE0, 0xC5, 0xC1, 0x01, 0x44, 0x88,
+    0x30, 0x1A, 0x9A, 0x73, 0xA1, 0xC4, 0xA0, 0xB6, 0x7F, 0x26, 0x62, 0x67, 0x9A, 0x5F, 0xF8, 0x3B,
+    0x8D, 0x1F, 0x5C, 0x81, 0x11, 0x32, 0x7C, 0x41, 0x11, 0xE7, 0x11, 0xF5, 0xA8, 0x7C, 0xCC, 0xD2,
+    0xA8, 0x53, 0xEA, 0x61, 0x4D, 0x18, 0x40, 0x86, 0x75, 0x31, 0x3F, 0x97, 0x47, 0x5E, 0x89, 0xA5,
+    0x7A, 0x7F, 0xAC, 0xF0, 0xC4, 0x50, 0x83, 0xCE, 0x7F, 0xA9, 0x1E, 0xEF, 0xDF, 0x0A, 0x66, 0xFE,
+    0xCE, 0xE9, 0x82, 0xB2, 0x55, 0x4C, 0x43, 0x08, 0x16, 0xE5, 0x9C, 0x34, 0xEE, 0xFC, 0x9F, 0x87,
+    0xFA, 0xAE, 0xA2, 0x1D, 0xDA, 0x3F, 0x71, 0x1B, 0xB7, 0x83, 0x81, 0x57, 0xBC, 0x83, 0xE1, 0x56,
+    0xC3, 0xF3, 0x01, 0xF1, 0xDA, 0x76, 0xA0, 0x24, 0x7B, 0x3A, 0x24, 0xB1, 0xC3, 0x55, 0xF1, 0x51,
+    0xDE, 0xCE, 0x01, 0xD3, 0xC7, 0xAA, 0x8E, 0x76, 0xAE, 0x30, 0xDC, 0x55, 0x47, 0x8E, 0x95, 0xFF,
+    0x55, 0x39, 0xEB, 0xFC, 0x5F, 0x53, 0x7E, 0xC6, 0xE4, 0xC7, 0xD1, 0xC3, 0xC8, 0xFF, 0x07, 0x57,
+    0x0F, 0xF3, 0x5D, 0x85, 0xC1, 0xD1, 0x19, 0xE7, 0xDF, 0x49, 0x11, 0x57, 0x24, 0x9C, 0xD0, 0x50,
+    0x12, 0xB3, 0x4D, 0x95, 0x33, 0x08, 0xC8, 0xFB, 0xCE, 0x47, 0x67, 0x9D, 0x73, 0xB9, 0xA8, 0x5F,
+    0x46, 0x4A, 0xA7, 0xEA, 0xAA, 0x1F, 0xC8, 0x63, 0x5F, 0x67, 0xCE, 0xE6, 0x65, 0xC1, 0x89, 0xFB,
+    0xB9, 0xAE, 0x5E, 0x7C, 0x42, 0x9A, 0xEF, 0xE8, 0xF7, 0x7A, 0x61, 0x4B, 0x92, 0x9D, 0x1D, 0x9E,
+    0xC7, 0x0A, 0x66, 0x74, 0x16, 0xB6, 0x5E, 0xD7, 0xFA, 0x95, 0x8D, 0x3A, 0x61, 0x69, 0xDB, 0xA8,
+    0xB0, 0x6D, 0x9C, 0xB6, 0x9D, 0xEE, 0x6D, 0xBB, 0xDB, 0xB5, 0xAD, 0x6D, 0x71, 0x24, 0xCE, 0x86,
+    0x43, 0x75, 0x79, 0x63, 0x66, 0x1A, 0x03, 0xB5, 0xC5, 0x52, 0xFA, 0x7B, 0xCC, 0x44, 0x89, 0xC3,
+    0xBB, 0x36, 0x1B, 0x0E, 0xE7, 0xA9, 0x08, 0x5B, 0xC2, 0xC1, 0xB6, 0x8B, 0x18, 0x6C, 0xFD, 0xAE,
+    0x65, 0xEC, 0xE0, 0xBC, 0x94, 0x86, 0xFC, 0x25, 0xA9, 0x6D, 0xBB, 0xA0, 0x6B, 0x66, 0x29, 0x67,
+    0xAE, 0x1D, 0xF3, 0xC5, 0x76, 0xE9, 0x4D, 0xC5, 0xC9, 0x43, 0x2A, 0x92, 0x88, 0x52, 0xD8, 0xD5,
+    0xE6, 0xA5, 0x4C, 0x2C, 0x35, 0xC3, 0xB4, 0xE4, 0x30, 0x0F, 0x3A, 0xBC, 0xA7, 0x5D, 0xB4, 0xB3,
+    0x0E, 0x4B, 0x38, 0x41, 0xC4, 0x9D, 0x09, 0x34, 0xA7, 0x34, 0x1F, 0xBE, 0x5B, 0xD8, 0xDC, 0x11,
+    0xC1, 0x1A, 0x5B, 0x78, 0x3D, 0x9D, 0xC7, 0x32, 0xDD, 0x50, 0x7F, 0x81, 0x17, 0x35, 0xA3, 0x60,
+    0x96, 0xE8, 0x41, 0x76, 0xF7, 0xA3, 0x2E, 0x10, 0x4E, 0x3B, 0x9B, 0xA5, 0xDE, 0x17, 0xB0, 0x46,
+    0x77, 0xA0, 0xE4, 0x1E, 0xE2, 0x2A, 0xDB, 0x27, 0x24, 0xC6, 0xBC, 0x8C, 0xCD, 0x40, 0x99, 0x80,
+    0x16, 0x4F, 0xEB, 0xC7, 0x0B, 0xCA, 0xDA, 0xEC, 0xE6, 0x04, 0x2B, 0xEF, 0xF1, 0x0E, 0xD6, 0x9C,
+    0x58, 0x8D, 0x72, 0xFD, 0xAB, 0xF2, 0xE2, 0xD6, 0x7F, 0x85, 0xD6, 0x07, 0x79, 0x61, 0xA0, 0x6E,
+    0xD3, 0x0A, 0xF1, 0xD3, 0x55, 0xCD, 0xE2, 0x5F, 0x94, 0xFC, 0xE7, 0x80, 0x46, 0x7A, 0xD8, 0x9E,
+    0x04, 0x5E, 0xF8, 0xC6, 0x91, 0x10, 0x72, 0xDA, 0x6B, 0xBF, 0xA7, 0x96, 0x04, 0xB3, 0xF5, 0x2D,
+    0x30, 0xFA, 0x60, 0xB1, 0x6E, 0x8E, 0xD4, 0xCA, 0xDF, 0xA7, 0xA5, 0x7F, 0x9D, 0x4F, 0xC3, 0xCC,
+    0x0C, 0x1F, 0xB9, 0xB0, 0x49, 0x33, 0xC7, 0x1A, 0x53, 0xCE, 0xEF, 0x95, 0x27, 0x3D, 0xFF, 0x3D,
+    0x58, 0x3D, 0xD1, 0x56, 0xF8, 0xE7, 0xB2, 0xE7, 0x36, 0x3B, 0x1D, 0x9C, 0x86, 0xB7, 0x55, 0x31,
+    0xFC, 0x0D, 0x7E, 0xD7, 0xCA, 0xD7, 0xF9, 0x4C, 0x31, 0x43, 0x8D, 0xCF, 0x45, 0x47, 0xDA, 0xA0,
+    0x68, 0x83, 0xF2, 0xBE, 0x5F, 0x2C, 0x6D, 0xCA, 0xC9, 0x30, 0xEF, 0x9B, 0xD9, 0x26, 0xB1, 0xA5,
+    0x06, 0x22, 0xEE, 0x30, 0xC3, 0x51, 0xDC, 0x90, 0xBA, 0xAD, 0xC2, 0x33, 0xA3, 0x34, 0x49, 0x49,
+    0xE3, 0xDC, 0x02, 0x36, 0x52, 0x26, 0xE4, 0xA4, 0x2C, 0xD2, 0x84, 0xA5, 0xA5, 0xDB, 0x07, 0xF7,
+    0x78, 0xDF, 0xFE, 0xBA, 0xE8, 0x69, 0x47, 0xD9, 0x19, 0xCC, 0xE1, 0xCC, 0x11, 0x56, 0x39, 0xD8,
+    0xE2, 0x8A, 0xF3, 0xD5, 0x09, 0xE8, 0xCE, 0xE3, 0x2D, 0x49, 0xFD, 0x1D, 0x74, 0x9D, 0x21, 0xAE,
+    0xD7, 0x19, 0x32, 0xBE, 0xD2, 0x42, 0xBD, 0xEE, 0xC5, 0x00, 0x34, 0x62, 0x68, 0x19, 0x31, 0x7A,
+    0x8C, 0x98, 0x39, 0x8E, 0x0C, 0xEC, 0x66, 0x34, 0x65, 0x52, 0xD1, 0x8E, 0x49, 0xB0, 0xD9, 0xA3,
+    0x16, 0x26, 0x35, 0x62, 0x5D, 0x60, 0xD4, 0x42, 0xDC, 0x51, 0x0B, 0x8C, 0x38, 0x6A, 0xE1, 0xE3,
+    0x20, 0x49, 0x0A, 0x12, 0x17, 0x20, 0x61, 0x05, 0xE2, 0xD5, 0x20, 0x6E, 0x3B, 0xA2, 0xD2, 0x49,
+    0x32, 0x92, 0xB8, 0x05, 0x09, 0x49, 0x7C, 0x12, 0xF0, 0xEC, 0xDE, 0x55, 0xA4, 0x66, 0x83, 0xF9,
+    0x74, 0xE9, 0x78, 0x0D, 0x6D, 0x42, 0x5D, 0x3E, 0x72, 0xF6, 0xAE, 0x98, 0x7D, 0x5B, 0x8A, 0x80,
+    0xC4, 0xE6, 0xB3, 0xF1, 0x44, 0xFC, 0x89, 0xB8, 0x50, 0x13, 0x53, 0x6B, 0x0D, 0xBC, 0x71, 0x6E,
+    0x43, 0x5D, 0xA6, 0xE1, 0x9B, 0x72, 0x05, 0xD5, 0x54, 0x43, 0xFA, 0x54, 0x03, 0x7C, 0xBB, 0x44,
+    0xA7, 0x0B, 0xEA, 0xD7, 0xB6, 0xA7, 0x1D, 0x65, 0x67, 0xE0, 0x01, 0x1F, 0xE7, 0x2C, 0x1C, 0x65,
+    0x8C, 0xC3, 0xCE, 0x8C, 0x81, 0x78, 0x63, 0xA2, 0xCE, 0x4B, 0x98, 0x6D, 0xB4, 0x64, 0x70, 0xDE,
+    0xF2, 0xF5, 0xDE, 0xA1, 0x00, 0xAE, 0xD6, 0x94, 0x34, 0x28, 0x77, 0x52, 0x5C, 0x97, 0x6F, 0x87,
+    0x14, 0xAF, 0xE8, 0xC1, 0x96, 0x58, 0x78, 0xA0, 0x90, 0xE0, 0xCB, 0x56, 0x8B, 0xAA, 0xCC, 0x17,
+    0x10, 0x3A, 0xD3, 0x6F, 0x83, 0x14, 0xCE, 0x0D, 0x87, 0xC5, 0xDA, 0xA9, 0x07, 0x06, 0x22, 0xF3,
+    0x10, 0xDF, 0x57, 0x35, 0xCF, 0x7E, 0x93, 0xB9, 0xF2, 0xB7, 0xC2, 0x96, 0x58, 0xF3, 0xE6, 0xC1,
+    0x41, 0x18, 0x33, 0x50, 0x08, 0xB7, 0xF6, 0x58, 0x1C, 0x7A, 0x56, 0xF9, 0x97, 0xEF, 0x89, 0xFC,
+    0x62, 0x17, 0xA0, 0x2A, 0x49, 0xFD, 0x3A, 0x2C, 0xA3, 0xC2, 0x6B, 0x30, 0xD7, 0xAC, 0x65, 0x0C,
+    0xC2, 0x34, 0x64, 0xAF, 0x41, 0x76, 0x39, 0xC5, 0x4A, 0x49, 0x1A, 0x15, 0x5A, 0x6F, 0x6C, 0xFA,
+    0x9A, 0xCA, 0x2B, 0x08, 0x97, 0x97, 0x54, 0x36, 0xA4, 0x9C, 0x99, 0x16, 0x91, 0x21, 0x5B, 0x4B,
+    0xD9, 0x3C, 0x95, 0xCD, 0x33, 0x94, 0x2D, 0x34, 0x94, 0x2D, 0x7E, 0x9B, 0xB2, 0x0D, 0x54, 0xB6,
+    0x96, 0xB2, 0xB9, 0x35, 0x65, 0xF3, 0x4B, 0x4A, 0x15, 0x16, 0xA4, 0x89, 0x4A, 0xB5, 0x4B, 0x0A,
+    0x94, 0x07, 0xD9, 0x10, 0xA9, 0x21, 0x1B, 0x62, 0x25, 0x64, 0x8B, 0x72, 0xCA, 0x66, 0x54, 0xB6,
+    0xF6, 0x50, 0x36, 0x5F, 0x65, 0x0B, 0xF5, 0x10, 0x8F, 0x7F, 0x4C, 0xD9, 0x2E, 0x2C, 0x64, 0x63,
+    0x65, 0x30, 0x9D, 0x83, 0xBC, 0xB0, 0x5A, 0xA4, 0x99, 0xAD, 0x7D, 0x4E, 0xB1, 0xF4, 0x62, 0x80,
+    0x6B, 0x4E, 0x81, 0x78, 0xDC, 0x1F, 0xAF, 0xCE, 0xB8, 0x47, 0xF0, 0xD5, 0xB8, 0x08, 0xF7, 0xDF,
+    0x31, 0xA9, 0xC7, 0xD3, 0x02, 0x0A, 0xAB, 0xB4, 0xE4, 0x47, 0xEB, 0xB8, 0x3B, 0x67, 0x30, 0xCE,
+    0xE7, 0x51, 0x55, 0xB1, 0x6E, 0x75, 0x76, 0x98, 0xD4, 0xAC, 0xD0, 0xA3, 0xD1, 0x85, 0x74, 0x51,
+    0x6C, 0x27, 0x90, 0x3D, 0xF4, 0x09, 0x1E, 0xEF, 0x9F, 0x19, 0x26, 0x59, 0x9F, 0x93, 0x3B, 0x84,
+    0xD6, 0x03, 0x6E, 0xF5, 0xEA, 0xB1, 0x33, 0xE9, 0x9B, 0xDE, 0x69, 0x3D, 0x43, 0x59, 0xE6, 0xD1,
+    0x3C, 0xC5, 0xEE, 0x34, 0xD3, 0x58, 0x39, 0xB2, 0xD3, 0xBB, 0x4C, 0x73, 0x32, 0xCE, 0x87, 0x83,
+    0x3C, 0xA8, 0x00, 0xC6, 0x15, 0x6D, 0xC4, 0x39, 0x4B, 0x8F, 0x3C, 0xB4, 0x76, 0xBB, 0x6C, 0x8A,
+    0xCF, 0x01, 0x24, 0x21, 0x60, 0x8F, 0x7E, 0x4D, 0xD4, 0xC1, 0x10, 0xEA, 0x73, 0x7B, 0x98, 0x54,
+    0x74, 0x55, 0xA1, 0xE7, 0x20, 0xA3, 0x63, 0x30, 0x75, 0x53, 0x73, 0x28, 0x7A, 0x17, 0xF2, 0xC4,
+    0x86, 0x28, 0x81, 0x20, 0x81, 0x4F, 0x9A, 0x96, 0xAE, 0xD6, 0xDE, 0x0F, 0x1A, 0xB3, 0xA5, 0x50,
+    0x39, 0x25, 0x94, 0x79, 0x1C, 0xEC, 0x95, 0xF3, 0x37, 0x35, 0x8D, 0xCC, 0x89, 0x76, 0x1A, 0x89,
+    0xCB, 0x95, 0xD6, 0xE2, 0xD2, 0x84, 0x32, 0x77, 0xC4, 0x61, 0x20, 0xF0, 0x29, 0x28, 0x51, 0x2B,
+    0x4B, 0x63, 0x9A, 0x48, 0x76, 0x64, 0x4A, 0x82, 0x54, 0x0A, 0xBF, 0xB2, 0x8B, 0xAF, 0x63, 0xF9,
+    0xF4, 0x11, 0xBD, 0x13, 0xD1, 0xC4, 0x41, 0x51, 0x3C, 0x02, 0x8B, 0xFD, 0x33, 0xC8, 0xF1, 0x43,
+    0xC0, 0x84, 0xD0, 0xE5, 0x5E, 0xC8, 0xF9, 0xD4, 0x16, 0x9E, 0xB2, 0xCE, 0xDB, 0x88, 0xCA, 0xF8,
+    0x58, 0x67, 0xD9, 0x8A, 0x33, 0x93, 0xB2, 0xCC, 0xE7, 0x7D, 0x76, 0xA5, 0x71, 0x2C, 0x46, 0x38,
+    0x94, 0x62, 0x65, 0xAB, 0x45, 0x22, 0xDD, 0x86, 0x07, 0xEB, 0x2D, 0x22, 0x6D, 0x8B, 0x69, 0xDA,
+    0x81, 0x5E, 0x0E, 0xBE, 0x7B, 0xB8, 0x17, 0xB7, 0x91, 0x99, 0xF6, 0x7D, 0x53, 0xF5, 0x85, 0xF5,
+    0x46, 0xB9, 0x90, 0xDB, 0x73, 0x3A, 0xEB, 0xAC, 0xAF, 0x3E, 0x5A, 0x9B, 0x3B, 0xC9, 0xB5, 0x68,
+    0x5D, 0x21, 0xA6, 0x88, 0x21, 0xE8, 0x1E, 0x34, 0xD9, 0x20, 0xAE, 0x96, 0x6E, 0x75, 0x2A, 0x6B,
+    0x5D, 0x92, 0xD7, 0x1C, 0x93, 0xEF, 0x78, 0xE6, 0xA0, 0xF6, 0x7F, 0x69, 0xCA, 0xA0, 0x43, 0x24,
+    0x27, 0xBE, 0x0E, 0xE0, 0xBF, 0x4C, 0xC2, 0xC2, 0x69, 0xE1, 0x05, 0x3B, 0xC1, 0xD1, 0xA2, 0xE6,
+    0x89, 0xEE, 0x93, 0x58, 0xDD, 0xF5, 0xD0, 0xEB, 0xCD, 0x50, 0xE4, 0xFD, 0x90, 0x05, 0x31, 0xAB,
+    0xCB, 0x95, 0xEA, 0xF4, 0xD6, 0x84, 0x43, 0x8C, 0xA7, 0x32, 0x6E, 0x78, 0x86, 0xFD, 0x09, 0xE7,
+    0x57, 0xF0, 0xE0, 0xF6, 0xC3, 0x32, 0xCB, 0x1D, 0x1E, 0x9E, 0x5A, 0x05, 0x98, 0x2A, 0x3E, 0x75,
+    0x5A, 0x3D, 0xBC, 0x6C, 0xF3, 0xF2, 0xD6, 0x6C, 0xB8, 0xC5, 0x4A, 0x30, 0x2B, 0x3A, 0xE1, 0xC1,
+    0x3B, 0x48, 0x27, 0xEF, 0x26, 0xB9, 0x3E, 0xD4, 0xCE, 0xAC, 0xD7, 0x0F, 0x6C, 0x39, 0x61, 0x60,
+    0x03, 0x41, 0x66, 0xAB, 0xE7, 0x49, 0x9E, 0xDD, 0x7E, 0xF0, 0x72, 0x09, 0x16, 0x20, 0x41, 0x09,
+    0x2E, 0x1C, 0xD6, 0x47, 0x2E, 0x5B, 0x9F, 0xD0, 0x0A, 0x8E, 0xD9, 0x74, 0x28, 0xDB, 0xEC, 0x27,
+    0x7C, 0xCE, 0xA0, 0x21, 0xCA, 0x96, 0x85, 0x9E, 0x70, 0xA5, 0xB6, 0x0F, 0xFB, 0xFA, 0xD3, 0xF3,
+    0x9C, 0x0E, 0x41, 0x8A, 0x10, 0x47, 0x9F, 0x96, 0x0A, 0x81, 0x80, 0xAD, 0xEB, 0x5F, 0xB7, 0x85,
+    0xEC, 0x84, 0x2E, 0x8C, 0xDF, 0x7E, 0xBA, 0xA8, 0xA1, 0xE8, 0xD1, 0x4C, 0x17, 0xB4, 0x3E, 0x28,
+    0x47, 0xCB, 0x78, 0xF1, 0x4C, 0x8B, 0x38, 0x00, 0x12, 0xFB, 0x57, 0x26, 0xAC, 0xF0, 0x20, 0x08,
+    0xE5, 0xB6, 0x56, 0xA5, 0xA5, 0x2A, 0x90, 0xE1, 0x70, 0xCC, 0x4A, 0x91, 0xE1, 0xB7, 0xA1, 0x8D,
+    0xA7, 0xC9, 0xA2, 0x38, 0x13, 0x2D, 0x0E, 0x7E, 0x7F, 0xFA, 0xD6, 0xCF, 0x19, 0x79, 0xA6, 0xCC,
+    0x4B, 0x9B, 0x79, 0x34, 0xA6, 0x6B, 0x5A, 0x16, 0xB2, 0x79, 0x18, 0x74, 0x6D, 0x51, 0xEE, 0x45,
+    0xB2, 0x61, 0xCF, 0x04, 0xAA, 0x8A, 0xB6, 0x26, 0x03, 0x8C, 0x71, 0x26, 0xD0, 0x89, 0x57, 0x2E,
+    0x3D, 0xE1, 0x3E, 0x7D, 0x36, 0xE8, 0x68, 0xCC, 0xB4, 0x41, 0x68, 0x77, 0x3B, 0xC7, 0x1F, 0x20,
+    0x9C, 0x32, 0x07, 0xD7, 0xD2, 0x18, 0xA7, 0x9C, 0x8B, 0x5C, 0xB5, 0x03, 0x67, 0x13, 0x3D, 0xE4,
+    0x9E, 0xFE, 0xBE, 0xE7, 0x4D, 0x00, 0x5C, 0x11, 0xFA, 0xAD, 0xE5, 0x1C, 0xFF, 0x8F, 0x93, 0xE3,
+    0x6F, 0x79, 0x1D, 0x42, 0xA4, 0x2E, 0x62, 0xD6, 0x3F, 0xEB, 0x28, 0x6D, 0x57, 0x17, 0x39, 0x5F,
+    0x4F, 0xAC, 0x10, 0xCF, 0xF5, 0x01, 0xE4, 0xE8, 0x79, 0x35, 0xE0, 0xC6, 0xDA, 0x52, 0xA0, 0x95,
+    0xC9, 0xD7, 0x2A, 0x79, 0x9C, 0xB3, 0x8F, 0x6F, 0x80, 0xAF, 0xE3, 0xCF, 0x99, 0x78, 0x13, 0x37,
+    0xD8, 0x7F, 0x89, 0x60, 0x05, 0x38, 0xFB, 0x15, 0xCC, 0xE1, 0x4D, 0x7B, 0xA8, 0xEF, 0x76, 0x8A,
+    0xBD, 0xF0, 0x2F, 0xE8, 0xDE, 0x98, 0x4F, 0x73, 0xCF, 0x6C, 0x9B, 0x02, 0xAA, 0x1D, 0x17, 0x11,
+    0xD1, 0x07, 0xD4, 0x1D, 0x96, 0xF3, 0xF3, 0xF0, 0x90, 0x50, 0x51, 0x20, 0x38, 0xF7, 0xA2, 0x1C,
+    0xDB, 0x87, 0xF3, 0x73, 0x02, 0x0C, 0x8D, 0x7D, 0xE0, 0xA1, 0xA1, 0xF5, 0x87, 0x1B, 0x8B, 0xD0,
+    0xFE, 0x09, 0x43, 0x7B, 0xF0, 0x16, 0x43, 0xFB, 0xB5, 0x45, 0x68, 0x47, 0x7E, 0x96, 0xAF, 0x65,
+    0xA6, 0x49, 0xF6, 0x6F, 0xB5, 0x49, 0x29, 0x33, 0x84, 0xB9, 0x41, 0xF2, 0xFC, 0x8F, 0x9E, 0x13,
+    0xFB, 0xF0, 0xC4, 0x02, 0xF3, 0xF2, 0x29, 0xC0, 0x1C, 0x5C, 0xE5, 0xE4, 0xAF, 0x01, 0xF4, 0xBC,
+    0xA5, 0x39, 0x45, 0x46, 0x2B, 0x8A, 0x73, 0x88, 0xDD, 0x09, 0x93, 0xC8, 0xA3, 0xA2, 0x86, 0x56,
+    0x54, 0xED, 0xA2, 0x9D, 0x75, 0x98, 0xB7, 0xBF, 0x32, 0xB5, 0x53, 0xE9, 0xA4, 0x56, 0xD4, 0x47,
+    0x51, 0xED, 0xED, 0x43, 0x54, 0xBB, 0xF3, 0x02, 0xD9, 0xB8, 0x2C, 0xDF, 0x05, 0x8A, 0x29, 0x57,
+    0xF1, 0xC3, 0x0C, 0x89, 0x61, 0x39, 0xAE, 0xC5, 0xCD, 0x8F, 0x1E, 0x76, 0xA7, 0xCC, 0x81, 0x2C,
+    0x90, 0xF3, 0x1E, 0xE1, 0xE4, 0xAA, 0x57, 0x1E, 0xF7, 0xFE, 0x53, 0xE6, 0x20, 0x9D, 0xDB, 0x81,
+    0xBF, 0xF8, 0xE7, 0x2A, 0x67, 0xF3, 0xE8, 0x71, 0xBF, 0xF4, 0x5F, 0x2D, 0xEB, 0xCB, 0xBF, 0x1C,
+    0x0E, 0x53, 0xD2, 0x79, 0xE2, 0x79, 0x4E, 0xFF, 0x76, 0x2E, 0xFA, 0x7F, 0x4F, 0x96, 0x67, 0xC7,
+    0x80, 0x67, 0xCF, 0xA4, 0x71, 0x1A, 0x7C, 0x0A, 0x76, 0xA3, 0xB7, 0x41, 0x7A, 0x64, 0xB2, 0x05,
+    0xBB, 0x6E, 0x03, 0xE2, 0x57, 0xF8, 0x33, 0x2C, 0xC0, 0xF3, 0x06, 0x79, 0x9E, 0x92, 0xE7, 0x09,
+    0x78, 0xF6, 0xA7, 0xE0, 0x59, 0x61, 0x6B, 0xB4, 0x0D, 0x9E, 0xFD, 0x4E, 0x6B, 0xDD, 0x63, 0xCC,
+    0xF1, 0xA3, 0x68, 0xF2, 0xD0, 0x7A, 0x06, 0x16, 0x53, 0x24, 0xCF, 0x78, 0x65, 0x03, 0xFE, 0x57,
+    0x06, 0x22, 0x54, 0x82, 0x10, 0x15, 0x57, 0x57, 0x0C, 0x70, 0x01, 0xA0, 0xEB, 0x24, 0xB6, 0x69,
+    0xAD, 0xA2, 0xC9, 0x7C, 0x81, 0x26, 0xBD, 0xA3, 0x68, 0xF2, 0x44, 0xD7, 0x72, 0xA1, 0xFC, 0xB0,
+    0x39, 0x8A, 0x26, 0x8B, 0xC3, 0x20, 0x77, 0xA2, 0x6B, 0xCD, 0x51, 0x1E, 0x2E, 0x69, 0x8E, 0x1A,
+    0xFE, 0xC9, 0xEB, 0xEF, 0xAB, 0x8F, 0xFC, 0xDD, 0xEE, 0x81, 0x5A, 0x9C, 0x26, 0xDD, 0xE3, 0xB4,
+    0x01, 0xC1, 0xD8, 0xAE, 0x7D, 0x48, 0xE5, 0x57, 0x80, 0x5A, 0x5E, 0xED, 0xF1, 0x59, 0x05, 0x37,
+    0x80, 0x87, 0xB5, 0x3D, 0x34, 0xEF, 0xB0, 0x88, 0x98, 0x10, 0x33, 0xC5, 0x5A, 0x8C, 0x61, 0x75,
+    0x26, 0xD4, 0xA7, 0x54, 0xED, 0xFC, 0x59, 0xBD, 0x35, 0xD5, 0x6A, 0x0E, 0x7B, 0xC2, 0xF9, 0x03,
+    0xA8, 0x77, 0x08, 0xD4, 0xC6, 0xEC, 0x36, 0x2E, 0x35, 0x22, 0x2C, 0x4E, 0xCE, 0xA7, 0x13, 0x04,
+    0x64, 0xE9, 0x65, 0x06, 0xC9, 0xD0, 0xFE, 0xBB, 0x2D, 0x9F, 0xA1, 0xCC, 0x68, 0x1F, 0xF6, 0x38,
+    0xD6, 0xB4, 0x88, 0x24, 0xCA, 0x8F, 0x13, 0x2B, 0x5B, 0x6A, 0x3B, 0x17, 0x1C, 0x36, 0x01, 0x97,
+    0xBD, 0x31, 0xA6, 0xEA, 0x45, 0x86, 0x77, 0x6F, 0x3C, 0x13, 0x07, 0xCF, 0x00, 0x1C, 0xBE, 0x79,
+    0x75, 0xFE, 0x0F, 0xD5, 0x5B, 0xBD, 0x8F, 0xDC, 0xC8, 0x95, 0x7F, 0x24, 0x4F, 0x43, 0xAF, 0x18,
+    0xD0, 0x80, 0x57, 0xE7, 0xB5, 0x05, 0x6F, 0x3B, 0x30, 0x8C, 0xF5, 0x7E, 0x88, 0xA9, 0x03, 0xA9,
+    0x49, 0x5F, 0x70, 0xB1, 0x82, 0x1D, 0x2D, 0x60, 0x05, 0xEB, 0x60, 0x13, 0x1B, 0x30, 0x94, 0x38,
+    0x50, 0xB0, 0xEA, 0x26, 0xEC, 0xC0, 0x81, 0x83, 0x9D, 0xC4, 0xC0, 0x65, 0x56, 0x20, 0x18, 0xDA,
+    0x1E, 0xC0, 0xB3, 0x81, 0x02, 0xC1, 0xE8, 0x99, 0x26, 0xEE, 0xFE, 0x00, 0x77, 0x70, 0x80, 0x43,
+    0x73, 0x61, 0x2F, 0x60, 0xCB, 0x81, 0x09, 0xBB, 0x05, 0x73, 0x66, 0xC9, 0x2E, 0xFF, 0x7E, 0xAF,
+    0x48, 0xF6, 0x87, 0xB4, 0x23, 0x69, 0x34, 0x5F, 0xEE, 0xE9, 0x7A, 0xEC, 0x21, 0x8B, 0x55, 0xEF,
+    0xBD, 0xAA, 0x7A, 0x5F, 0xF5, 0x4A, 0x2E, 0x8E, 0x3E, 0x16, 0x91, 0x9E, 0x99, 0x2B, 0xAC, 0x65,
+    0xED, 0x13, 0x5B, 0x98, 0x12, 0x4E, 0x32, 0x42, 0x33, 0x05, 0x70, 0xFE, 0x99, 0x03, 0x7A, 0x7F,
+    0x2F, 0x08, 0x3F, 0x9D, 0x01, 0x06, 0xD3, 0x0A, 0x30, 0xCC, 0x76, 0xD9, 0x4E, 0x3A, 0x00, 0x8C,
+    0xF4, 0xE5, 0x58, 0xA2, 0x44, 0x64, 0x17, 0x4F, 0x44, 0x2A, 0x42, 0xC7, 0x18, 0x93, 0x8B, 0x0B,
+    0x58, 0x88, 0x77, 0x30, 0xDA, 0x9E, 0x89, 0x9F, 0x8B, 0x53, 0x36, 0x15, 0x7A, 0x80, 0x7B, 0xFA,
+    0x4A, 0x6C, 0x5F, 0x4F, 0x06, 0xDA, 0xA0, 0x6D, 0xDC, 0x19, 0x8D, 0x52, 0xBC, 0x39, 0x45, 0x1B,
+    0x59, 0x87, 0xE2, 0xD0, 0x24, 0x3E, 0x9A, 0xF4, 0x3E, 0xBB, 0x3C, 0x73, 0xC4, 0x2D, 0x85, 0xCD,
+    0xB4, 0x65, 0x63, 0xBB, 0x42, 0xFD, 0x2A, 0x3C, 0xD8, 0xAC, 0x40, 0x43, 0x35, 0xC4, 0xBD, 0x81,
+    0x16, 0x07, 0xBF, 0x3D, 0xDC, 0x8B, 0x2A, 0x10, 0xFD, 0xA1, 0x6F, 0xF2, 0x0F, 0xE5, 0x12, 0xDE,
+    0x78, 0x4D, 0x5E, 0x01, 0x7C, 0x5D, 0xAE, 0xB0, 0xBB, 0x47, 0x6C, 0xC3, 0x37, 0xA4, 0x4E, 0x7E,
+    0x93, 0x9E, 0x6F, 0xCE, 0xB8, 0xA9, 0x6C, 0xB9, 0x53, 0x6F, 0xEA, 0xCC, 0x77, 0x32, 0x99, 0x18,
+    0xF4, 0xFA, 0x27, 0x39, 0x11, 0x0E, 0x9D, 0x33, 0xBA, 0xD9, 0x7F, 0x4F, 0x31, 0xBA, 0xAA, 0x50,
+    0x07, 0x4B, 0x8A, 0xA5, 0xDF, 0x73, 0xC5, 0x74, 0x48, 0x1C, 0xE5, 0xC2, 0x71, 0xF3, 0xE3, 0xA1,
+    0x88, 0x0B, 0xBA, 0x7D, 0xE0, 0x11, 0x34, 0xC5, 0x3F, 0xC0, 0x3D, 0x0C, 0x80, 0xBC, 0x8A, 0xC2,
+    0xB5, 0xE5, 0xB2, 0x61, 0x8F, 0xC8, 0x84, 0x44, 0xA2, 0x07, 0x4A, 0xE4, 0xDA, 0xCA, 0x54, 0x72,
+    0xCD, 0x3C, 0x91, 0x08, 0xE4, 0x3B, 0xE6, 0xD1, 0xCE, 0xD4, 0xAB, 0xC5, 0x49, 0x43, 0x92, 0x10,
+    0x65, 0x4A, 0x2F, 0x31, 0x66, 0xB5, 0x3D, 0x82, 0xBA, 0x03, 0x55, 0x07, 0x16, 0xF7, 0xB4, 0x8A,
+    0x56, 0xD6, 0xD7, 0x62, 0x36, 0xD0, 0xE3, 0xC0, 0x04, 0xA5, 0xF6, 0xF3, 0xCB, 0x9B, 0x9C, 0x1D,
+    0x58, 0x3C, 0x81, 0x31, 0xE0, 0xCB, 0x25, 0x56, 0xBA, 0x98, 0xDA, 0x9E, 0x86, 0xB6, 0x39, 0x17,
+    0x3D, 0x7B, 0x4B, 0xB3, 0xBD, 0x67, 0xB6, 0x1C, 0x32, 0x6B, 0xFE, 0xFD, 0x69, 0x88, 0x96, 0x38,
+    0x1C, 0x76, 0x30, 0xBE, 0xA0, 0x24, 0xB6, 0x0E, 0xEB, 0xFA, 0xF5, 0x85, 0x9C, 0xEF, 0x82, 0x36,
+    0x50, 0x7E, 0x1D, 0x4F, 0xDF, 0x6C, 0x67, 0x8D, 0x83, 0xBB, 0x98, 0x2D, 0xE0, 0x4A, 0x98, 0x62,
+    0x82, 0xBC, 0xD3, 0x0C, 0xE2, 0x79, 0x60, 0x88, 0x7B, 0x17, 0x48, 0xE1, 0x69, 0x84, 0x06, 0x06,
+    0x71, 0xE2, 0x94, 0x41, 0x86, 0x75, 0x95, 0x9F, 0x0C, 0x43, 0x5E, 0xE9, 0x96, 0x94, 0xE2, 0x17,
+    0xC9, 0x13, 0x9F, 0x33, 0xE5, 0x85, 0x83, 0xAB, 0x57, 0x2C, 0xCA, 0xF2, 0xE7, 0x38, 0xF9, 0xF0,
+    0x86, 0x5C, 0xE4, 0xCA, 0xE8, 0xE3, 0xD1, 0xA7, 0x40, 0xC6, 0xFD, 0xBC, 0x68, 0xA5, 0x8B, 0xA2,
+    0x7A, 0x2E, 0x98, 0x01, 0x11, 0x7B, 0xD7, 0x9D, 0x41, 0x34, 0xED, 0x46, 0xA9, 0xC4, 0x78, 0x3F,
+    0x44, 0x93, 0x7E, 0x71, 0x22, 0x0C, 0x71, 0xB6, 0xE4, 0x03, 0x91, 0x92, 0x6B, 0x31, 0xA6, 0x90,
+    0xEB, 0x51, 0xA0, 0xF8, 0x44, 0x5C, 0xC5, 0x55, 0xF7, 0x99, 0x98, 0xBF, 0x40, 0xFE, 0xF2, 0x45,
+    0x80, 0x1A, 0x34, 0xBA, 0x26, 0x01, 0x56, 0x11, 0x45, 0x6F, 0x50, 0x54, 0x94, 0x3B, 0x5C, 0xD2,
+    0x25, 0x80, 0x53, 0xA9, 0x80, 0xEB, 0x40, 0xDD, 0x81, 0xEE, 0x9E, 0x56, 0xD1, 0xCA, 0xFA, 0x5A,
+    0xC8, 0x06, 0xA2, 0xAC, 0xC2, 0x62, 0x4D, 0xE6, 0xA3, 0x49, 0xDD, 0x76, 0xB4, 0xAF, 0x5D, 0x5F,
+    0x70, 0x38, 0x7F, 0x7B, 0x3F, 0x23, 0x03, 0x7A, 0x3F, 0x57, 0xC9, 0xF6, 0x73, 0x65, 0xE2, 0x2F,
+    0xC8, 0xCF, 0xDE, 0x47, 0xCA, 0x91, 0xB4, 0x85, 0x51, 0x1D, 0xA6, 0x14, 0xF1, 0xBF, 0x4B, 0xC5,
+    0xDF, 0x7F, 0x0F, 0x1C, 0x05, 0xD5, 0x93, 0x94, 0xF4, 0x43, 0xCA, 0x82, 0x13, 0x64, 0xA9, 0xD6,
+    0x5C, 0x83, 0xE1, 0xDA, 0x1D, 0xAD, 0xC9, 0xCA, 0x29, 0xA5, 0x29, 0x5A, 0x08, 0xCA, 0x0D, 0xD3,
+    0xB6, 0x2C, 0xC3, 0x39, 0xEA, 0x8B, 0x93, 0xA8, 0xDE, 0x9E, 0x6F, 0x09, 0x07, 0x6F, 0xAE, 0x10,
+    0x6C, 0x0D, 0xA6, 0x12, 0xCD, 0x08, 0x21, 0x90, 0x01, 0xC5, 0x28, 0x8C, 0x13, 0xC2, 0x28, 0x25,
+    0xEC, 0x65, 0x84, 0x61, 0x16, 0xE4, 0x84, 0x64, 0x68, 0x38, 0xB5, 0x70, 0xE7, 0xE0, 0x3E, 0xEF,
+    0xDB, 0xA7, 0x5D, 0x4D, 0xFB, 0x96, 0x6D, 0xC1, 0x2C, 0x5A, 0xEE, 0xA1, 0x97, 0x83, 0x6D, 0xF6,
+    0xD8, 0xF6, 0xBE, 0x25, 0x9D, 0xF6, 0x51, 0x96, 0x00, 0x38, 0x9B, 0xB7, 0xFE, 0x1F, 0x48, 0x9A,
+    0xCA, 0x82, 0xC5, 0x83, 0xA8, 0xEE, 0xA5, 0x98, 0x0A, 0x1F, 0xA5, 0x7E, 0x7D, 0xD3, 0xA4, 0x60,
+    0x93, 0x49, 0x95, 0x4B, 0x4A, 0xBA, 0x72, 0x61, 0x05, 0x84, 0xCB, 0xFF, 0xB2, 0x8A, 0x32, 0x47,
+    0x79, 0xA3, 0xAC, 0xB1, 0x9C, 0x51, 0xC6, 0x90, 0x2F, 0x1B, 0xA3, 0x91, 0x84, 0xC6, 0x10, 0xA9,
+    0xA5, 0x49, 0x64, 0xA6, 0x1C, 0x5A, 0x72, 0xA9, 0x5A, 0x51, 0x86, 0xAB, 0xC5, 0xC0, 0xFA, 0x42,
+    0x9D, 0x8C, 0xE5, 0xB0, 0x7A, 0x2C, 0xF3, 0xD1, 0x68, 0xAB, 0x69, 0x33, 0xA7, 0xD5, 0x46, 0x25,
+    0x3F, 0xB5, 0x60, 0xE9, 0x13, 0x61, 0x35, 0x0B, 0x27, 0x95, 0xB7, 0x7F, 0xB9, 0xE4, 0x80, 0x56,
+    0xE4, 0x80, 0x6A, 0x7B, 0x55, 0xF6, 0x00, 0xA3, 0xD1, 0x44, 0x62, 0xB4, 0xC2, 0x5F, 0xA3, 0x46,
+    0x52, 0x76, 0xAB, 0x96, 0xCB, 0x47, 0xD7, 0x0F, 0xD6, 0xC6, 0xF7, 0x7E, 0xCC, 0xE6, 0xB1, 0x44,
+    0x22, 0xB5, 0xD8, 0xDE, 0x85, 0x62, 0x93, 0x0D, 0x09, 0xF1, 0xE7, 0x3F, 0xDA, 0xC3, 0x04, 0x01,
+    0x56, 0xB7, 0xB6, 0x4E, 0x8F, 0x66, 0xD8, 0x63, 0x30, 0x0D, 0x5C, 0x90, 0x4B, 0x8B, 0x0C, 0x26,
+    0x07, 0x35, 0xED, 0x9F, 0xE4, 0xF4, 0xA8, 0x07, 0xF1, 0xCD, 0xD2, 0xA3, 0x8C, 0x59, 0x91, 0xA2,
+    0x27, 0x4E, 0xBD, 0x08, 0x27, 0xB3, 0x2A, 0x8C, 0x05, 0x58, 0xFB, 0x9C, 0x2C, 0xF5, 0x27, 0x4F,
+    0x61, 0xAF, 0xB1, 0x39, 0x1F, 0x36, 0x96, 0x26, 0x0B, 0x45, 0x0E, 0x2D, 0xCD, 0x0B, 0x27, 0x4B,
+    0x23, 0x91, 0xB9, 0xA1, 0x77, 0xF5, 0x79, 0xD2, 0xDA, 0xC0, 0x0A, 0xC2, 0x3F, 0x53, 0x89, 0xA9,
+    0xB6, 0xBB, 0x0E, 0xF3, 0x62, 0x23, 0x09, 0xB3, 0x28, 0xF1, 0x0A, 0x18, 0x59, 0xE4, 0xCD, 0x30,
+    0x6F, 0xA5, 0xF2, 0xA9, 0x4C, 0x04, 0xEA, 0x4C, 0x51, 0xA5, 0x29, 0xBB, 0x3A, 0x17, 0xA9, 0x76,
+    0xC3, 0xEA, 0xC9, 0x29, 0x71, 0xC2, 0x6B, 0x41, 0x8D, 0x5C, 0x89, 0xF8, 0x7C, 0x82, 0x7B, 0x4E,
+    0x89, 0xA7, 0x7E, 0x8E, 0xC6, 0xC3, 0xC4, 0xCF, 0x96, 0xD0, 0x70, 0x26, 0x90, 0xD5, 0x3D, 0xBE,
+    0x6C, 0x0E, 0xB6, 0x2B, 0x0F, 0xD2, 0xFB, 0x5B, 0xE1, 0xAC, 0x6D, 0x5E, 0x7D, 0x9E, 0x2F, 0xB0,
+    0x2F, 0x46, 0x1F, 0x53, 0x4D, 0x9A, 0xAA, 0xE9, 0x59, 0x86, 0xAC, 0x12, 0xB3, 0x72, 0x4C, 0xFC,
+    0x62, 0x2E, 0xC2, 0x98, 0xF8, 0xC5, 0x3E, 0x6A, 0xC7, 0xAE, 0xF9, 0xEC, 0x86, 0x81, 0x50, 0x00,
+    0x35, 0x10, 0xFF, 0x10, 0x0B, 0x17, 0xA0, 0x4C, 0x9D, 0x7B, 0x44, 0x5F, 0xFD, 0x1A, 0x4A, 0x8B,
+    0x98, 0x0C, 0xAB, 0xE8, 0x0A, 0xE5, 0xF2, 0x60, 0x85, 0x57, 0x75, 0x40, 0x0D, 0xF1, 0xBB, 0x75,
+    0x0D, 0x11, 0x3D, 0xA1, 0x21, 0xC2, 0x55, 0xA0, 0x1A, 0xA2, 0xD7, 0x69, 0x88, 0x61, 0xA7, 0x21,
+    0xFE, 0xD0, 0x69, 0x88, 0x30, 0x6D, 0x55, 0x51, 0xA4, 0x66, 0x11, 0xA7, 0xB2, 0x91, 0xF0, 0x2F,
+    0x37, 0x2B, 0xAA, 0x8C, 0x02, 0x0C, 0xE2, 0x40, 0x6D, 0x88, 0x9B, 0x48, 0x90, 0x06, 0x09, 0xFC,
+    0xB5, 0x09, 0x8D, 0x79, 0x22, 0xFD, 0xD6, 0x96, 0x9C, 0x17, 0x4E, 0x6E, 0x61, 0xD6, 0x49, 0xE1,
+    0x60, 0x8A, 0xED, 0xED, 0x50, 0x43, 0xD3, 0x82, 0xDB, 0x28, 0xE5, 0x7C, 0x31, 0x51, 0x5C, 0x69,
+    0x5D, 0xD8, 0x05, 0x58, 0xFD, 0x9C, 0x29, 0x13, 0xD5, 0x3F, 0x71, 0xD9, 0x9D, 0x47, 0xD6, 0x39,
+    0xB3, 0xA7, 0xC8, 0xF0, 0xB3, 0x67, 0xE2, 0xD9, 0xB3, 0x49, 0x3F, 0x3E, 0xED, 0x9A, 0x40, 0x87,
+    0x91, 0xFD, 0x85, 0xBC, 0xF7, 0x8E, 0x34, 0x51, 0x00, 0x79, 0x8D, 0xE0, 0xC3, 0x36, 0x26, 0xE1,
+    0x2C, 0xF4, 0x62, 0x7E, 0xDE, 0xD8, 0x79, 0x9F, 0x58, 0x31, 0x16, 0x18, 0x18, 0xFC, 0x1B, 0x7D,
+    0x04, 0x8A, 0xEE, 0x10, 0xD5, 0x99, 0xEA, 0xB9, 0xF6, 0x33, 0xE6, 0x74, 0xA0, 0xAF, 0xF0, 0xDC,
+    0x00, 0x0A, 0x64, 0x7B, 0x06, 0xC6, 0x19, 0x0B, 0x5E, 0xE8, 0xDD, 0x05, 0x90, 0xEF, 0x68, 0xBC,
+    0x89, 0x4E, 0x3A, 0x0D, 0xC9, 0xE0, 0x8F, 0x05, 0xBD, 0xC6, 0x8A, 0x8A, 0xF8, 0x4A, 0x8B, 0xDB,
+    0x22, 0x48, 0xF5, 0x0C, 0x10, 0x40, 0x2A, 0xF4, 0x87, 0x50, 0x11, 0xF1, 0xFE, 0x7B, 0x95, 0xC4,
+    0x53, 0xCC, 0x0A, 0xCC, 0x95, 0x41, 0xA3, 0x6D, 0x8E, 0x0E, 0xE8, 0xB4, 0x61, 0x3A, 0x90, 0x6B,
+    0xC1, 0xFA, 0xC5, 0xE8, 0x27, 0x6D, 0x2E, 0xDB, 0x07, 0xA3, 0xD1, 0xCE, 0x41, 0xF2, 0xD4, 0x9A,
+    0x1E, 0xD4, 0x28, 0x64, 0x97, 0x67, 0xD4, 0x77, 0x69, 0x2F, 0x4F, 0xAD, 0x79, 0xC4, 0x8B, 0xFA,
+    0x6F, 0x0B, 0xF3, 0xEC, 0xAB, 0x8F, 0x37, 0x13, 0xEB, 0xF1, 0x4E, 0xE8, 0xF1, 0x2E, 0x1B, 0x6F,
+    0xFF, 0x79, 0x5D, 0xBC, 0x4F, 0xE1, 0xCA, 0x78, 0x7F, 0xC5, 0x13, 0xCF, 0x24, 0x51, 0xE6, 0x61,
+    0xD6, 0xE4, 0xDE, 0x0C, 0xCF, 0x50, 0xE5, 0xC8, 0xC0, 0x49, 0x30, 0x2F, 0x2B, 0x2F, 0x8D, 0xCD,
+    0x4E, 0x72, 0xB5, 0x37, 0x97, 0x9F, 0xA8, 0x06, 0xB4, 0x9F, 0xC0, 0x94, 0x28, 0x18, 0xDA, 0xE1,
+    0xD6, 0x21, 0x2E, 0xF4, 0x8B, 0x96, 0x44, 0xDB, 0x64, 0x71, 0x12, 0x57, 0x7A, 0x65, 0x00, 0xDD,
+    0xB0, 0x23, 0x0F, 0x7A, 0xB5, 0x7C, 0xE2, 0x2E, 0xFA, 0x96, 0xFE, 0xF1, 0xF4, 0xF7, 0xE6, 0xE8,
+    0xDE, 0xD0, 0x94, 0x43, 0xD3, 0x48, 0xCE, 0xC8, 0xE4, 0x91, 0x29, 0x1C, 0xAC, 0xB3, 0x4A, 0x8E,
+    0xF2, 0xAD, 0xD1, 0x42, 0x81, 0xEF, 0x8F, 0x46, 0x77, 0x27, 0xA6, 0xC0, 0xB7, 0xC1, 0xB6, 0x3C,
+    0x4A, 0x6B, 0x3F, 0x90, 0x37, 0x6E, 0xCB, 0xED, 0x78, 0xBB, 0x08, 0xCD, 0xD4, 0xFD, 0xAD, 0x1C,
+    0x2F, 0x86, 0x77, 0xE5, 0x83, 0x07, 0x52, 0x0C, 0xB6, 0xF1, 0x3B, 0xDB, 0xD8, 0x97, 0x97, 0xC1,
+    0x73, 0x62, 0xD2, 0x89, 0xC9, 0xFC, 0x7D, 0xD1, 0x19, 0xF3, 0xE2, 0xDF, 0x19, 0x5A, 0xC8, 0xF0,
+    0xA5, 0x80, 0x78, 0xC8, 0xC8, 0xB0, 0xAB, 0x5F, 0x67, 0x9E, 0x32, 0xBE, 0x74, 0x41, 0x9C, 0xD4,
+    0x2F, 0xFC, 0xA2, 0x15, 0xC4, 0x5E, 0xCE, 0xA9, 0x79, 0xF8, 0x9F, 0x9F, 0x85, 0x68, 0xEC, 0x1A,
+    0xFE, 0xE2, 0x7B, 0xBD, 0x19, 0x9C, 0xEA, 0x2D, 0xF6, 0x82, 0xAF, 0x5B, 0x2C, 0x7B, 0x58, 0xC7,
+    0x83, 0x76, 0x3F, 0x5E, 0xFF, 0xA0, 0xE5, 0x28, 0xC1, 0x93, 0x28, 0x41, 0xEB, 0xB4, 0xEC, 0x4F,
+    0x0C, 0xCC, 0xA4, 0xE9, 0x48, 0xC1, 0x42, 0x73, 0x34, 0xFA, 0xF4, 0xC6, 0xBC, 0xB1, 0xFC, 0x34,
+    0x96, 0x4B, 0x45, 0xF7, 0x1A, 0xF8, 0x39, 0x44, 0xAD, 0x21, 0x04, 0x69, 0xDF, 0x06, 0xBA, 0x97,
+    0x96, 0x54, 0x2F, 0x61, 0xE4, 0xFF, 0x65, 0x8B, 0x3C, 0x51, 0x80, 0xD0, 0xB7, 0x61, 0x2F, 0xC7,
+    0xD4, 0xD0, 0x79, 0x13, 0xCE, 0xC6, 0x75, 0x38, 0x83, 0x99, 0xBF, 0x8B, 0x11, 0x8D, 0x92, 0x60,
+    0xD9, 0xC8, 0xA7, 0x92, 0x0E, 0x4F, 0xA1, 0x40, 0x19, 0x6F, 0xC2, 0x36, 0x9E, 0xCC, 0xAD, 0xCB,
+    0xA1, 0x2E, 0xE1, 0x77, 0xA8, 0xBC, 0xA0, 0xBA, 0xA0, 0xB8, 0xA0, 0xB6, 0x16, 0x4A, 0xAB, 0x2F,
+    0x56, 0x7D, 0x1C, 0xF1, 0xDB, 0xA7, 0x6D, 0xF3, 0xEB, 0x4A, 0x20, 0x32, 0x27, 0x53, 0x2A, 0x67,
+    0xDD, 0x1D, 0x19, 0x62, 0xF5, 0x38, 0x15, 0x00, 0x06, 0xB2, 0xB2, 0x2E, 0x55, 0xCC, 0x85, 0x0D,
+    0x84, 0x2A, 0x46, 0x11, 0x2B, 0x86, 0xB9, 0x2A, 0x9A, 0x38, 0xDC, 0xE5, 0x90, 0x39, 0x8D, 0x64,
+    0x8D, 0xCF, 0x98, 0x5F, 0x60, 0x22, 0xCF, 0x3D, 0x5D, 0xAE, 0x35, 0x01, 0x37, 0x41, 0x18, 0x46,
+    0xA8, 0xE8, 0x61, 0x55, 0xE2, 0xB3, 0x3D, 0x97, 0x2D, 0xC3, 0x82, 0x20, 0xD7, 0xD9, 0x5B, 0x6F,
+    0x39, 0xB0, 0xB3, 0x30, 0x6E, 0xAC, 0x5D, 0xD4, 0x99, 0x44, 0xFF, 0xD1, 0x58, 0x44, 0xFD, 0x43,
+    0x8B, 0x5B, 0xF6, 0xA1, 0x5E, 0xFA, 0x60, 0x61, 0x5F, 0x26, 0xD2, 0x47, 0x57, 0xFD, 0xA0, 0x90,
+    0x3E, 0x6C, 0xA1, 0x3E, 0x50, 0xE9, 0x43, 0xFF, 0xC7, 0x58, 0xD0, 0x31, 0xD0, 0x8C, 0x81, 0x65,
+    0x1F, 0x48, 0xF6, 0x81, 0x23, 0xEA, 0x67, 0x7D, 0x60, 0xD8, 0x07, 0xC1, 0x7D, 0x52, 0xDE, 0x7E,
+    0x74, 0x44, 0x52, 0xEB, 0x1E, 0x5F, 0x69, 0xBC, 0xF6, 0x2F, 0x93, 0x71, 0x6E, 0x19, 0x4B, 0x50,
+    0x60, 0x56, 0x65, 0x31, 0xDE, 0x8F, 0x1D, 0x18, 0x00, 0xE0, 0x15, 0x0D, 0xBE, 0x98, 0x51, 0xC9,
+    0x09, 0x0A, 0xF8, 0x11, 0xFF, 0x1E, 0xFD, 0xFC, 0x57, 0x89, 0xFA, 0x78, 0xCE, 0x7A, 0x5A, 0x3F,
+    0xCC, 0x63, 0xF4, 0x13, 0xB3, 0x9F, 0x8F, 0xED, 0x1E, 0x0F, 0xB7, 0x78, 0xB8, 0xC3, 0xC3, 0x79,
+    0xBF, 0xBC, 0xBF, 0x13, 0xC9, 0x31, 0x2A, 0xB0, 0xB6, 0x3C, 0x1A, 0xDD, 0x83, 0x2F, 0x5C, 0xB2,
+    0xC8, 0x7D, 0xAF, 0xF4, 0x8B, 0x10, 0x38, 0xDD, 0x56, 0xF3, 0x27, 0x7E, 0xE1, 0xBF, 0xF1, 0x33,
+    0x3C, 0xFA, 0xA3, 0x14, 0xB3, 0x12, 0x2C, 0x59, 0x1F, 0x89, 0x64, 0x65, 0x24, 0x8E, 0x82, 0xB3,
+    0x72, 0x36, 0x89, 0x30, 0xEA, 0x1F, 0xC2, 0x3B, 0xBE, 0x0E, 0x1A, 0xFC, 0x69, 0xA5, 0x25, 0xC8,
+    0x30, 0x4F, 0x61, 0x14, 0x86, 0xC0, 0xE3, 0x4B, 0xC7, 0x46, 0xC3, 0x25, 0x27, 0x89, 0xC1, 0x63,
+    0x98, 0xDB, 0xA1, 0xC4, 0xAF, 0x4B, 0xFC, 0xF6, 0x4B, 0xAD, 0xD8, 0xE7, 0xE7, 0xF8, 0xB7, 0x74,
+    0x11, 0xDA, 0x32, 0x7E, 0x7E, 0x6C, 0x9F, 0x89, 0xC3, 0x2B, 0x74, 0x71, 0xF8, 0x8D, 0x9E, 0x8D,
+    0xAD, 0x5B, 0x3C, 0x19, 0xCD, 0x3B, 0x04, 0xC0, 0xEF, 0xF1, 0x1E, 0x43, 0x22, 0x7B, 0x98, 0x9B,
+    0x00, 0x18, 0xEF, 0x80, 0xCE, 0x55, 0x5C, 0xB4, 0xE0, 0x2B, 0x5F, 0xF8, 0x2E, 0x8C, 0xDE, 0x84,
+    0xB6, 0x6E, 0xAA, 0x80, 0x1B, 0x21, 0xE5, 0x21, 0xDF, 0xC4, 0xF9, 0x7C, 0x0A, 0xE5, 0xE3, 0x98,
+    0x24, 0xC0, 0xF2, 0x2C, 0x25, 0x3A, 0xAC, 0x32, 0x9D, 0x59, 0x9A, 0x78, 0x41, 0xD1, 0xEE, 0xC4,
+    0x6A, 0xE0, 0xE8, 0xCE, 0x62, 0xA7, 0xB8, 0xF9, 0xD0, 0x07, 0x1C, 0x13, 0xEB, 0x31, 0x93, 0x0C,
+    0xC6, 0x34, 0xB3, 0xC6, 0x34, 0xE1, 0xC6, 0xDC, 0x2C, 0x19, 0x57, 0x13, 0x02, 0xBC, 0x3A, 0xAE,
+    0x20, 0x8F, 0xC6, 0x14, 0xA2, 0xE3, 0x0A, 0x4B, 0x7F, 0x5C, 0x41, 0x12, 0x8C, 0x29, 0x5D, 0xC7,
+    0x94, 0xB3, 0x63, 0x0A, 0xCC, 0x31, 0x05, 0x26, 0x80, 0x57, 0x8C, 0x29, 0x30, 0xC7, 0xB4, 0x90,
+    0x08, 0x86, 0x04, 0x11, 0x37, 0x5B, 0x42, 0x02, 0x5F, 0xB7, 0x5D, 0x2A, 0xAB, 0xBA, 0xE8, 0xAE,
+    0x36, 0x3B, 0xB1, 0x64, 0x89, 0xBF, 0x88, 0xD5, 0x5D, 0x85, 0xC3, 0x72, 0x0D, 0xC6, 0x24, 0xDD,
+    0x15, 0x78, 0x2B, 0x73, 0x3A, 0x2B, 0x1C, 0x9F, 0x17, 0x2D, 0x67, 0x47, 0xDF, 0xAA, 0x81, 0x6D,
+    0x59, 0x3F, 0x5E, 0xF1, 0x8A, 0x25, 0x39, 0x5E, 0x5A, 0x17, 0x1B, 0x87, 0xB3, 0x66, 0x67, 0xBB,
+    0xDD, 0xAD, 0x4F, 0xAC, 0x4A, 0xBE, 0x2B, 0x6F, 0x10, 0x91, 0x92, 0xBB, 0x57, 0x78, 0x14, 0xFC,
+    0x2D, 0x6B, 0x76, 0xEF, 0xA5, 0x3E, 0x0F, 0x73, 0xC2, 0x4D, 0x9C, 0x2D, 0xB7, 0x80, 0xB3, 0x56,
+    0x31, 0x10, 0x5A, 0xDB, 0x8D, 0x69, 0x3F, 0x3F, 0xF6, 0x39, 0xA1, 0x91, 0x12, 0xBB, 0x8B, 0x6A,
+    0xAD, 0xBC, 0x36, 0xCD, 0x43, 0xBA, 0x81, 0x92, 0xF1, 0x15, 0x1F, 0xDA, 0xF0, 0x61, 0x1C, 0x63,
+    0x59, 0x5F, 0x8F, 0xEB, 0x1B, 0xB5, 0xDA, 0x5B, 0x13, 0xDD, 0x3B, 0x8D, 0x75, 0xE2, 0xC6, 0xBA,
+    0xA6, 0x22, 0x7D, 0xED, 0xE5, 0xE0, 0x53, 0xF9, 0x5D, 0xAE, 0xF1, 0x3B, 0xED, 0xF8, 0x5D, 0x90,
+    0xDF, 0x25, 0xB9, 0xAC, 0xFC, 0x9E, 0x28, 0xBF, 0x53, 0xB2, 0x9A, 0xFC, 0xF6, 0xC9, 0x6A, 0xAF,
+    0x24, 0x83, 0xAB, 0x8E, 0xD5, 0xF1, 0x3A, 0xAB, 0x5B, 0x31, 0x6A, 0x67, 0x24, 0x7F, 0x51, 0x66,
+    0x5C, 0xB8, 0x39, 0xA3, 0x2F, 0x9A, 0x37, 0x01, 0x11, 0xB9, 0xDE, 0xB2, 0x7D, 0x6B, 0x8D, 0xED,
+    0xC3, 0x23, 0x4E, 0xCF, 0xF5, 0x32, 0x80, 0x35, 0x5B, 0x77, 0xD6, 0xEC, 0xC5, 0xD1, 0x48, 0xC3,
+    0xC1, 0x46, 0x3D, 0x62, 0xB3, 0x16, 0x7E, 0xDB, 0xD0, 0xAD, 0xD8, 0x21, 0x8D, 0x36, 0xD7, 0x7C,
+    0x36, 0x29, 0xC5, 0x2F, 0xC5, 0xAD, 0x35, 0x0C, 0x3E, 0xD4, 0xC1, 0xD4, 0xA8, 0x11, 0x98, 0x30,
+    0x54, 0x91, 0x47, 0xA6, 0x06, 0x39, 0xE7, 0xB5, 0x5F, 0xD4, 0x2A, 0x72, 0xAB, 0x25, 0x58, 0x77,
+    0xD0, 0x2F, 0x6C, 0x4D, 0xFB, 0x96, 0x6D, 0x81, 0x62, 0x29, 0x4A, 0x69, 0xE4, 0x0D, 0xB9, 0x43,
+    0xEE, 0xCC, 0xB9, 0x45, 0x7E, 0xAB, 0xD4, 0x1D, 0x04, 0x65, 0xCE, 0xBC, 0xDB, 0xE1, 0x84, 0x7B,
+    0x4A, 0x43, 0xB2, 0xE0, 0xB3, 0x95, 0x20, 0x7F, 0x64, 0x74, 0x1B, 0x10, 0xBE, 0x52, 0xFD, 0x9E,
+    0x62, 0x39, 0x64, 0x84, 0x2E, 0x62, 0x78, 0x8B, 0xD6, 0x4B, 0x03, 0xD8, 0x61, 0xD0, 0x01, 0xFD,
+    0x97, 0x3B, 0x18, 0x00, 0x5A, 0x59, 0x5F, 0xF3, 0xF6, 0x37, 0x6A, 0xDB, 0x94, 0x36, 0xDA, 0xA6,
+    0x52, 0x6C, 0xA8, 0x99, 0x49, 0x43, 0x33, 0x78, 0x44, 0x12, 0x54, 0x01, 0xAD, 0x6C, 0xFB, 0x9D,
+    0x67, 0xBE, 0xDD, 0x85, 0x4F, 0x0E, 0xFF, 0x94, 0x41, 0xEB, 0xED, 0xBC, 0x21, 0x6C, 0xE1, 0x3C,
+    0x9F, 0x06, 0x07, 0xE5, 0x3E, 0x35, 0x90, 0x5B, 0x46, 0x9A, 0xF5, 0x31, 0x54, 0x67, 0x49, 0xB7,
+    0xA6, 0x55, 0x36, 0xBF, 0xED, 0xA5, 0xFF, 0x16, 0x7C, 0xBC, 0x98, 0xDE, 0x47, 0xDD, 0x9F, 0xE2,
+    0x59, 0x4C, 0x0D, 0x3A, 0x66, 0x86, 0x59, 0x01, 0xDB, 0xDF, 0xCD, 0xBE, 0x7B, 0xAA, 0xCC, 0x6C,
+    0x02, 0xC3, 0x8C, 0xDC, 0x95, 0x1A, 0x34, 0x36, 0x15, 0xB8, 0xB4, 0x83, 0x0B, 0x08, 0xD0, 0x54,
+    0x82, 0x5C, 0x2F, 0x60, 0x94, 0xA6, 0x11, 0x68, 0x50, 0x8E, 0xBA, 0x9F, 0x97, 0x3D, 0x7B, 0xA9,
+    0xED, 0x85, 0xD9, 0x1C, 0x07, 0xA3, 0xBB, 0x95, 0x0A, 0x81, 0xD9, 0xD2, 0x65, 0x51, 0x65, 0x6F,
+    0xE5, 0xF5, 0xA6, 0x31, 0x70, 0x4D, 0xB3, 0x15, 0x34, 0xF9, 0x41, 0x9A, 0x6E, 0xC9, 0xB8, 0x83,
+    0xD1, 0x7D, 0x72, 0xCE, 0x68, 0x30, 0x4C, 0x2F, 0x36, 0x17, 0x6C, 0x89, 0x39, 0x49, 0x60, 0xF9,
+    0x93, 0xC7, 0x64, 0xD1, 0xFE, 0xCD, 0x72, 0xFE, 0xDF, 0xEA, 0x45, 0xC2, 0x99, 0x1D, 0x6A, 0x2A,
+    0x06, 0xBC, 0xA4, 0x84, 0x91, 0xE9, 0x69, 0x13, 0x97, 0xCE, 0x9A, 0xD0, 0xF4, 0xA3, 0xD1, 0x44,
+    0x39, 0xC7, 0xBD, 0x42, 0xFB, 0xFF, 0x48, 0xEF, 0x67, 0x56, 0xC2, 0xF5, 0x9A, 0x54, 0x9D, 0x68,
+    0x6A, 0x03, 0xD2, 0x71, 0x63, 0x8F, 0x4D, 0xB8, 0x56, 0xC1, 0xC9, 0xCA, 0x24, 0xB7, 0xD8, 0x6F,
+    0x11, 0x53, 0xDE, 0x81, 0x9F, 0xBE, 0xCE, 0xB2, 0xEB, 0x4D, 0x64, 0x57, 0x33, 0xC8, 0x28, 0x08,
+    0x9D, 0x6E, 0x17, 0x51, 0xC3, 0xEE, 0xAF, 0xAF, 0x6D, 0x70, 0xDF, 0xD3, 0xBC, 0x98, 0x54, 0x34,
+    0xAB, 0xB0, 0x22, 0xED, 0x8D, 0x37, 0xAC, 0x96, 0xB4, 0xEC, 0x76, 0xA0, 0xB6, 0x71, 0x26, 0x6A,
+    0x08, 0x99, 0x6F, 0xDE, 0xD2, 0x4C, 0x9A, 0x44, 0x94, 0x25, 0xF5, 0xB2, 0xFB, 0x9B, 0xB6, 0x4E,
+    0xB4, 0x5F, 0xB4, 0x3E, 0xB5, 0x6D, 0x6F, 0x4F, 0x7D, 0x60, 0x4D, 0xBB, 0xC9, 0xB8, 0x87, 0x87,
+    0x47, 0x18, 0x59, 0x50, 0xD6, 0x97, 0x2E, 0x68, 0x7E, 0x35, 0xA8, 0xAE, 0xC5, 0xD5, 0xB5, 0xBD,
+    0xFF, 0x01, 0xB5, 0x54, 0x97, 0xC9, 0x73, 0x79, 0x09, 0x67, 0x46, 0xC5, 0x53, 0x3D, 0xF9, 0xEC,
+    0x09, 0x4F, 0xFE, 0xC8, 0x84, 0x35, 0x73, 0x4C, 0x2B, 0x5F, 0xD3, 0x9D, 0x91, 0x07, 0x3A, 0xC2,
+    0x17, 0x99, 0x64, 0x15, 0x64, 0x70, 0x0F, 0xDD, 0x19, 0xD3, 0x46, 0xE7, 0x9C, 0x13, 0x0C, 0xEA,
+    0xD8, 0x59, 0x73, 0xE6, 0xC3, 0xFB, 0x81, 0x7C, 0xAD, 0x0F, 0x81, 0xF2, 0x7F, 0x85, 0x6F, 0x32,
+    0x78, 0x1D, 0x76, 0x47, 0xE9, 0x25, 0xB8, 0xF0, 0xB4, 0xD4, 0xCB, 0x25, 0x42, 0x6F, 0x99, 0x2D,
+    0x8F, 0xB9, 0xA8, 0xF3, 0xED, 0x12, 0xF4, 0xBF, 0x1A, 0x27, 0xAB, 0xC9, 0x63, 0x9A, 0xD8, 0x31,
+    0xA3, 0x88, 0x61, 0xE4, 0x66, 0x9F, 0x59, 0x62, 0xF8, 0x31, 0x29, 0x9A, 0x4D, 0xE4, 0xBA, 0xB1,
+    0x5B, 0x07, 0x4D, 0xD9, 0xFD, 0x32, 0x73, 0x58, 0x7F, 0xF9, 0xFE, 0x8C, 0x02, 0x3B, 0xA2, 0xC0,
+    0xD4, 0x25, 0xFF, 0x43, 0x5B, 0xD5, 0x6B, 0x0C, 0x4B, 0xBA, 0xE7, 0x57, 0x96, 0x76, 0x20, 0x51,
+    0x2F, 0xE4, 0x42, 0x9E, 0xBE, 0x9F, 0x34, 0xE6, 0x89, 0xED, 0x9F, 0xF2, 0xAB, 0xA6, 0x30, 0xA1,
+    0xAA, 0xD2, 0x48, 0x60, 0x6A, 0x47, 0x89, 0x22, 0x86, 0x51, 0x9F, 0x60, 0x7A, 0x47, 0x6E, 0x65,
+    0xE8, 0x0B, 0x6B, 0xB8, 0xB4, 0x8B, 0x97, 0x99, 0x95, 0xC1, 0x4A, 0x66, 0x25, 0x33, 0x96, 0x8B,
+    0x53, 0xA5, 0xF7, 0xEB, 0x89, 0x4D, 0xF6, 0x63, 0xAE, 0xF1, 0x63, 0x06, 0x0B, 0x06, 0x10, 0x1D,
+    0x41, 0x72, 0x22, 0xF4, 0x9E, 0x06, 0x4D, 0x97, 0x53, 0xBB, 0x20, 0x99, 0xBB, 0xA8, 0x4E, 0xEE,
+    0xD8, 0x46, 0xDA, 0x19, 0x73, 0x9C, 0xA4, 0xC7, 0x4B, 0x53, 0xAF, 0x91, 0xB3, 0x7C, 0x51, 0x63,
+    0x02, 0x33, 0x75, 0xDB, 0x18, 0xFF, 0xE5, 0x6A, 0x58, 0x24, 0x48, 0x32, 0x8D, 0xAD, 0x49, 0x90,
+    0x5C, 0xCE, 0xF3, 0x38, 0x85, 0xF1, 0xFD, 0x1A, 0x13, 0x5E, 0xD2, 0x48, 0xAD, 0x0A, 0x87, 0xE6,
+    0xE7, 0x50, 0xF3, 0xF4, 0x4E, 0x64, 0x3E, 0x53, 0x81, 0x16, 0x0B, 0xB0, 0x9C, 0x67, 0x7A, 0xC2,
+    0xE0, 0x41, 0x9B, 0xE4, 0xEE, 0xCE, 0x3B, 0x8F, 0xCD, 0xEE, 0x3B, 0xA7, 0x4D, 0xF2, 0x08, 0xFD,
+    0x44, 0xD6, 0x28, 0x38, 0x40, 0x18, 0x83, 0x9E, 0xA9, 0x86, 0xA6, 0xFA, 0xEA, 0xE3, 0x77, 0x9F,
+    0x67, 0xEB, 0x01, 0x36, 0x9C, 0x98, 0x9A, 0xCB, 0x14, 0x0B, 0x23, 0x64, 0x3A, 0xA9, 0xFA, 0xCF,
+    0xFA, 0x05, 0x9D, 0x86, 0xB9, 0x6D, 0x1F, 0x30, 0x8A, 0x3C, 0xE3, 0x36, 0x2A, 0x39, 0x47, 0xDF,
+    0x48, 0xB7, 0x8D, 0x9D, 0xB5, 0xF4, 0xD4, 0xB3, 0xE2, 0x90, 0x46, 0x99, 0x07, 0xDD, 0x72, 0xA0,
+    0x59, 0x5D, 0x38, 0xB9, 0xD3, 0xA4, 0x31, 0x83, 0x1B, 0xB0, 0xC8, 0x2A, 0x01, 0x3F, 0x56, 0xD2,
+    0x9B, 0x9F, 0x59, 0x18, 0x45, 0xE0, 0x3C, 0xD4, 0xEC, 0xA2, 0x5A, 0x53, 0x4D, 0xD7, 0x69, 0x54,
+    0x0E, 0x1C, 0x0A, 0x9C, 0xCD, 0xFA, 0x5D, 0xEE, 0xE8, 0xCE, 0x2D, 0xB0, 0x96, 0xCC, 0xB3, 0x5F,
+    0x5B, 0x07, 0x87, 0x8E, 0xEE, 0x5B, 0x07, 0xF7, 0x62, 0x53, 0xBD, 0x75, 0x70, 0xFF, 0xB0, 0xD1,
+    0x05, 0xF6, 0x17, 0xE4, 0x4B, 0x18, 0xA6, 0xFC, 0x6D, 0x2E, 0x8C, 0xB1, 0xB8, 0x53, 0x88, 0x0D,
+    0x37, 0x0D, 0x96, 0x0D, 0xFD, 0x23, 0x6E, 0xD5, 0x3F, 0x13, 0x78, 0xB4, 0xF2, 0xD5, 0xCB, 0x08,
+    0x72, 0x08, 0xE4, 0x28, 0x0B, 0xF7, 0x6F, 0x18, 0x06, 0xFF, 0x6A, 0xBA, 0x14, 0x79, 0x93, 0xB8,
+    0xF5, 0xAA, 0x7C, 0x13, 0x2B, 0xF1, 0x13, 0xCF, 0x1C, 0x14, 0xC1, 0xF7, 0xCC, 0x34, 0x90, 0x37,
+    0x3B, 0x51, 0x8D, 0xD1, 0xED, 0xA3, 0xC4, 0xCF, 0x59, 0x86, 0x28, 0x13, 0x2C, 0x75, 0x13, 0x27,
+    0xAE, 0x89, 0xF2, 0xCB, 0x06, 0x62, 0x20, 0x76, 0x4D, 0x19, 0xA9, 0xD7, 0xF0, 0x45, 0x4E, 0xEB,
+    0x99, 0x52, 0xDF, 0x1C, 0x77, 0xCA, 0xDC, 0xA5, 0xE3, 0x4E, 0xC7, 0x4A, 0xF5, 0xC2, 0xE5, 0x1C,
+    0x58, 0x97, 0x33, 0x5B, 0x77, 0x39, 0xCF, 0x94, 0x7E, 0x37, 0x75, 0x78, 0xA8, 0x29, 0x73, 0x0E,
+    0x9A, 0x43, 0x4D, 0x97, 0x17, 0x09, 0xB4, 0xC7, 0xCA, 0x07, 0xEB, 0xA9, 0x51, 0x7E, 0x85, 0xBF,
+    0xC2, 0xFC, 0xFA, 0x06, 0x8D, 0x30, 0x05, 0xAF, 0xFB, 0xAD, 0x40, 0x75, 0x1E, 0x9E, 0x1B, 0xB6,
+    0xD8, 0xAD, 0x94, 0xD2, 0x32, 0xE0, 0x36, 0xE4, 0xF3, 0x4F, 0x50, 0xAE, 0xF6, 0xAC, 0x44, 0xDA,
+    0xC8, 0x4F, 0x86, 0x45, 0xEA, 0x55, 0xF7, 0xFE, 0xB7, 0xF3, 0xAA, 0xE9, 0x74, 0xCD, 0xE8, 0x55,
+    0x4F, 0xDF, 0x3E, 0x3F, 0x8C, 0xF9, 0x3A, 0x2C, 0xCC, 0x21, 0x0D, 0xF8, 0x30, 0x73, 0x66, 0x30,
+    0x02, 0xA6, 0xD7, 0xA0, 0xC1, 0x3E, 0x39, 0x11, 0x86, 0x9C, 0x0D, 0xA1, 0xB3, 0x36, 0xF3, 0xD7,
+    0x5B, 0x78, 0x63, 0x1D, 0x08, 0xF6, 0xDB, 0xE4, 0x2D, 0x88, 0x4D, 0xD2, 0x4A, 0x10, 0xBF, 0x30,
+    0x18, 0x12, 0x4C, 0x68, 0x15, 0x19, 0x21, 0xE5, 0x42, 0xD2, 0x69, 0x34, 0xC5, 0xB0, 0x8E, 0xCA,
+    0x98, 0x51, 0x96, 0x87, 0x5D, 0x16, 0x5B, 0xD6, 0x7A, 0x86, 0x0A, 0xBC, 0x03, 0x69, 0xC3, 0xE7,
+    0xAF, 0x76, 0x59, 0xB7, 0x6D, 0xE2, 0x6D, 0x93, 0x7B, 0x2B, 0x4D, 0xFA, 0xAD, 0x34, 0x19, 0xB8,
+    0x9A, 0xC1, 0xEC, 0x3F, 0x99, 0xFB, 0x48, 0x2C, 0xC2, 0x0C, 0x4C, 0x19, 0xAA, 0x01, 0xE2, 0x15,
+    0xB1, 0xBA, 0x82, 0x5E, 0x41, 0xB7, 0xB1, 0xC0, 0xBB, 0x30, 0x32, 0x07, 0x05, 0xCC, 0x32, 0x54,
+    0xDA, 0xE5, 0x61, 0x41, 0x5C, 0xAB, 0x4A, 0xCF, 0x67, 0x38, 0xE5, 0x18, 0xFE, 0xB7, 0x9F, 0xBB,
+    0xC5, 0x1D, 0x4D, 0x66, 0xF0, 0x8A, 0x3E, 0xC8, 0xC1, 0x35, 0xE7, 0xCE, 0x21, 0x4C, 0xD4, 0x69,
+    0x94, 0x0C, 0x80, 0x05, 0xDE, 0xE1, 0xE1, 0xB3, 0x8A, 0xEF, 0xD2, 0x4B, 0xEC, 0x25, 0x1A, 0xEF,
+    0xDA, 0x8D, 0xC4, 0xE7, 0x09, 0xC6, 0x41, 0x6C, 0xCF, 0x33, 0xC6, 0x7D, 0x71, 0xFF, 0xC1, 0xEB,
+    0x1D, 0x7B, 0xCA, 0xB1, 0x07, 0x9B, 0xE2, 0xF3, 0xA9, 0x35, 0x6F, 0x4D, 0x63, 0xB3, 0xF2, 0xAC,
+    0x12, 0x77, 0x96, 0x18, 0xA7, 0xE2, 0x99, 0x20, 0xDD, 0x5B, 0x6A, 0xD2, 0x99, 0x3C, 0x6B, 0x91,
+    0x84, 0x36, 0x7C, 0x1B, 0xBF, 0xAF, 0xB4, 0xEE, 0xAA, 0x61, 0xBC, 0x9E, 0xDA, 0x6B, 0xA3, 0xED,
+    0x2E, 0xBC, 0xD0, 0x9C, 0xA7, 0x0D, 0x35, 0xE8, 0xE4, 0xD5, 0x1A, 0x71, 0x0A, 0x0C, 0x63, 0x4E,
+    0x69, 0xB8, 0x03, 0xD2, 0x80, 0xF0, 0xFB, 0x49, 0x94, 0xE0, 0x7F, 0xA6, 0xFF, 0xA1, 0x12, 0x63,
+    0x55, 0x7E, 0xDE, 0xF7, 0x61, 0xA3, 0x7A, 0xC5, 0x1D, 0x2F, 0x1F, 0x73, 0x7F, 0x81, 0x36, 0xB0,
+    0x3B, 0x2B, 0xDD, 0x02, 0x8B, 0x76, 0x7F, 0x26, 0x8F, 0x81, 0xE6, 0xBC, 0x90, 0x03, 0x06, 0x18,
+    0x73, 0x35, 0xAB, 0x61, 0x1B, 0x33, 0x1F, 0x9C, 0x1E, 0xAB, 0x0D, 0x16, 0xA9, 0xEB, 0xBF, 0x9A,
+    0x02, 0xD8, 0xFB, 0x08, 0x8F, 0x06, 0xAE, 0xA6, 0x00, 0xDE, 0x5E, 0xC2, 0x72, 0x97, 0xC3, 0x38,
+    0xE4, 0x54, 0x65, 0x52, 0x55, 0x0E, 0xE6, 0xEB, 0xB9, 0x99, 0x28, 0x05, 0x5D, 0xDC, 0x59, 0x67,
+    0x05, 0xEB, 0x3F, 0xD3, 0x68, 0x8A, 0xC9, 0x13, 0x6D, 0x2A, 0xFC, 0x1B, 0x39, 0x64, 0xDA, 0x3E,
+    0x9C, 0x17, 0x36, 0xED, 0xE8, 0x44, 0xDA, 0x43, 0x5A, 0x14, 0x77, 0xF4, 0x23, 0x85, 0x8E, 0xA4,
+    0xAC, 0x78, 0x92, 0x8A, 0x9F, 0x1E, 0x3A, 0x65, 0xD6, 0x88, 0x3D, 0x72, 0x3A, 0xE0, 0x74, 0xD2,
+    0x63, 0xA7, 0x64, 0x2F, 0x4C, 0x28, 0xCD, 0x42, 0x73, 0x67, 0x1C, 0x88, 0x52, 0xA3, 0x6C, 0x0C,
+    0x51, 0xDD, 0xE1, 0x52, 0x8A, 0x35, 0xB7, 0x44, 0x23, 0x8F, 0x5D, 0xC2, 0xBA, 0xDF, 0x1D, 0xE3,
+    0xD4, 0x91, 0xD3, 0x4D, 0x18, 0xBE, 0xD5, 0x04, 0xB6, 0x12, 0x9B, 0x10, 0x23, 0x13, 0x56, 0x9B,
+    0x4C, 0x6D, 0x88, 0x04, 0x37, 0xFB, 0xAC, 0xAD, 0x22, 0xF3, 0x1D, 0x27, 0x5F, 0x1F, 0xEA, 0x33,
+    0x63, 0xA2, 0x5C, 0xDC, 0x5A, 0x39, 0x35, 0x57, 0xB7, 0x09, 0xBE, 0xDE, 0xCA, 0xF9, 0x1C, 0x46,
+    0x2D, 0x93, 0x05, 0x68, 0x1C, 0x30, 0xA7, 0xE3, 0x84, 0xEE, 0xA5, 0xF6, 0xBA, 0x56, 0x26, 0x47,
+    0x7F, 0x38, 0x82, 0xA9, 0x43, 0xFB, 0x39, 0x53, 0xA0, 0x51, 0x09, 0xA7, 0xB6, 0x75, 0x83, 0x26,
+    0xA7, 0xE2, 0x9D, 0xA5, 0xB3, 0xD7, 0xF4, 0xE0, 0x50, 0x2E, 0x6D, 0xDE, 0xCA, 0x6C, 0x0B, 0x7B,
+    0xB6, 0xF1, 0x26, 0xB5, 0x51, 0x5B, 0x8E, 0x2D, 0x5D, 0xB4, 0x95, 0x79, 0x3B, 0x6C, 0x1C, 0xC1,
+    0xE1, 0xE6, 0x66, 0xC2, 0x63, 0x0F, 0x13, 0xCD, 0x75, 0xD9, 0xEA, 0x62, 0x5C, 0xC4, 0xCA, 0x7D,
+    0xF2, 0x9C, 0xCA, 0x99, 0xB1, 0xE0, 0x95, 0xC6, 0xB1, 0x8B, 0x53, 0x59, 0x3D, 0x1C, 0x7B, 0x7C,
+    0xE4, 0xEB, 0xE9, 0x0C, 0x67, 0xC6, 0xF0, 0xDE, 0x40, 0x4F, 0x67, 0x4C, 0xDA, 0xA3, 0x23, 0xDE,
+    0xEC, 0x3C, 0xF0, 0x00, 0xCE, 0xBC, 0xC6, 0x94, 0xFD, 0xBC, 0x71, 0xE6, 0x27, 0x59, 0xBB, 0x3D,
+    0x79, 0xBC, 0xD3, 0xE0, 0x12, 0x14, 0x6C, 0x11, 0x9A, 0x3C, 0xCA, 0x5E, 0x2A, 0xAB, 0xC3, 0x7E,
+    0xFF, 0x05, 0xE5, 0x5B, 0x3D, 0x8C, 0x1C, 0x57, 0x72, 0xAE, 0xEE, 0x36, 0xB7, 0x6D, 0x0E, 0xA0,
+    0x56, 0x20, 0x9E, 0x71, 0x22, 0x4E, 0x9D, 0x1C, 0x0C, 0x99, 0x10, 0xD4, 0xA9, 0x02, 0x71, 0xBA,
+    0x0F, 0x0E, 0x2F, 0x10, 0x03, 0xAD, 0x14, 0x30, 0x60, 0x62, 0x18, 0xB0, 0x00, 0x83, 0x0E, 0x14,
+    0x5C, 0x40, 0x6E, 0xF7, 0x9D, 0x03, 0x07, 0x4E, 0x36, 0x21, 0xE0, 0x70, 0x83, 0x85, 0x21, 0x0D,
+    0x03, 0x29, 0x50, 0x70, 0x01, 0x77, 0xA7, 0x7D, 0x89, 0x43, 0x8F, 0xED, 0xD0, 0xC1, 0xCD, 0x01,
+    0x94, 0x01, 0xF9, 0x02, 0x35, 0xEC, 0x39, 0x5C, 0x2F, 0xDD, 0x3D, 0xCF, 0xF5, 0x7D, 0xF5, 0xBA,
+    0x67, 0x46, 0x3F, 0x14, 0xA9, 0x5B, 0xF2, 0x56, 0xF6, 0x60, 0xBB, 0xEA, 0xED, 0xF4, 0xDF, 0xAB,
+    0x7A, 0xEF, 0x55, 0xD5, 0x57, 0xF5, 0x46, 0x44, 0x3F, 0x97, 0x84, 0x9F, 0xAC, 0x92, 0x3D, 0x77,
+    0x26, 0x59, 0x21, 0xA5, 0x73, 0x8B, 0x5C, 0x42, 0xF7, 0xE9, 0xBC, 0x3D, 0x90, 0xB8, 0xD5, 0x56,
+    0x27, 0xC9, 0x52, 0x64, 0xBE, 0x94, 0xAC, 0x16, 0xC9, 0x2B, 0xC9, 0xF5, 0xFA, 0xA4, 0x96, 0x12,
+    0x6C, 0x21, 0xA7, 0xCA, 0x26, 0x4B, 0xE9, 0x95, 0xC5, 0xCD, 0xC0, 0x3A, 0x65, 0xD1, 0xC8, 0x76,
+    0xCF, 0xF9, 0x1B, 0xFC, 0xED, 0xFE, 0x61, 0xFA, 0x58, 0xF4, 0x21, 0x5D, 0x08, 0x4E, 0x4C, 0x5A,
+    0x09, 0xD6, 0xA2, 0xAF, 0xBE, 0x77, 0xBB, 0xD5, 0xF3, 0x73, 0xED, 0x12, 0x6E, 0x72, 0x6B, 0xD9,
+    0xEA, 0xB2, 0xC8, 0xB5, 0x02, 0x34, 0x37, 0xAA, 0xF7, 0xBB, 0xEA, 0x40, 0xC4, 0xB9, 0x55, 0x27,
+    0x51, 0xFF, 0xAE, 0x5B, 0xA1, 0xDB, 0x65, 0x2D, 0x69, 0x8D, 0x27, 0xAB, 0x64, 0x78, 0x8D, 0x0C,
+    0x94, 0x6F, 0x9E, 0x7C, 0x89, 0xEA, 0x59, 0xBB, 0x32, 0xAD, 0x70, 0x97, 0x5E, 0xA6, 0xDD, 0x89,
+    0xCE, 0x42, 0xED, 0x7B, 0xA0, 0x4F, 0x16, 0xBE, 0x05, 0xEF, 0xBB, 0x31, 0x74, 0xE2, 0x8A, 0xB1,
+    0x1C, 0xC2, 0x86, 0x2B, 0xCF, 0x0E, 0x8C, 0x75, 0x64, 0x7A, 0x1B, 0x59, 0x4D, 0xA6, 0x02, 0xF1,
+    0xDC, 0x39, 0x32, 0x55, 0x31, 0xB4, 0x0A, 0x96, 0x53, 0xB7, 0x18, 0x29, 0x0C, 0x56, 0x72, 0xF6,
+    0x8E, 0x53, 0xED, 0x44, 0xCE, 0x41, 0xF7, 0x3A, 0xB4, 0x4B, 0xF6, 0xF5, 0xED, 0xA1, 0xEF, 0x7B,
+    0x87, 0x62, 0xA3, 0xC0, 0x41, 0xB8, 0x2B, 0x32, 0x4D, 0x6A, 0x55, 0x61, 0x9E, 0x17, 0xA0, 0x6B,
+    0x01, 0x5D, 0x91, 0xCA, 0x93, 0xD2, 0x92, 0x74, 0xCE, 0x7F, 0x1D, 0x06, 0x27, 0x54, 0x9A, 0x2D,
+    0xAF, 0x2A, 0x4D, 0x9C, 0xCB, 0xA1, 0x87, 0x36, 0xDB, 0x1E, 0x44, 0x91, 0x57, 0xE5, 0xB2, 0x6F,
+    0xA5, 0xC5, 0xD4, 0xB7, 0xE2, 0x5F, 0xB5, 0xBE, 0x15, 0xFE, 0x4F, 0x33, 0x5C, 0x38, 0xAF, 0x87,
+    0x96, 0x8D, 0xF9, 0x97, 0x3E, 0x73, 0xF7, 0x99, 0xDE, 0xEA, 0x74, 0xA0, 0xF4, 0x58, 0x8E, 0xAD,
+    0xDE, 0x5A, 0x9D, 0xBE, 0xBB, 0xE0, 0xE4, 0x53, 0x9D, 0x65, 0x10, 0x3A, 0xAD, 0xB5, 0x35, 0x69,
+    0xF8, 0x40, 0xE8, 0x11, 0xE3, 0x3B, 0x1F, 0x46, 0x29, 0xE0, 0xE8, 0x05, 0xF6, 0x3D, 0x66, 0xB2,
+    0x5D, 0xEB, 0x5B, 0x29, 0x47, 0x13, 0x73, 0x5A, 0xFB, 0xE2, 0x5B, 0x73, 0xF1, 0x67, 0x71, 0x93,
+    0xB5, 0x22, 0x1B, 0x21, 0xFD, 0x02, 0xAF, 0xB1, 0x27, 0xEB, 0xAD, 0x62, 0x4F, 0x85, 0x18, 0xDA,
+    0x4A, 0x1A, 0xDC, 0x8A, 0x56, 0x56, 0x07, 0xFE, 0x09, 0xAE, 0x60, 0x6F, 0xD6, 0xB3, 0x79, 0x2F,
+    0x93, 0x47, 0xB3, 0xD9, 0x07, 0x94, 0x68, 0xA2, 0xB4, 0x73, 0xBA, 0x50, 0xAD, 0x65, 0x52, 0x1F,
+    0xCA, 0x9F, 0x5B, 0xA3, 0x0B, 0x57, 0xD4, 0x80, 0xE4, 0x93, 0x05, 0x2F, 0x57, 0x95, 0x17, 0x94,
+    0x5F, 0xE2, 0xB5, 0x98, 0xF8, 0x41, 0x2B, 0x83, 0xF4, 0x32, 0x08, 0x6F, 0xBD, 0x09, 0xF5, 0x42,
+    0x76, 0x30, 0xB2, 0x46, 0xD0, 0x05, 0xFB, 0xFB, 0xBD, 0x17, 0x37, 0x6C, 0x7D, 0x23, 0x6E, 0xBC,
+    0xB0, 0x49, 0xED, 0x1B, 0x59, 0xE5, 0x4F, 0x95, 0x83, 0x6E, 0x06, 0xC5, 0x99, 0xDE, 0x54, 0xE2,
+    0x78, 0xE9, 0x05, 0x4E, 0x6A, 0x2F, 0xAF, 0x29, 0x4D, 0xE7, 0xE8, 0xA9, 0x97, 0x16, 0x72, 0x53,
+    0xD8, 0xE8, 0x37, 0xFB, 0x6F, 0x0F, 0xA3, 0xB7, 0xA6, 0xA8, 0x68, 0x70, 0xC6, 0x5C, 0x96, 0x3D,
+    0xAC, 0xBD, 0xB4, 0x9A, 0xD4, 0x69, 0xC1, 0x46, 0xB4, 0x3A, 0xE1, 0xBC, 0xA9, 0xC4, 0xB5, 0xBE,
+    0x91, 0x2F, 0x7D, 0x23, 0xAD, 0x7D, 0xC3, 0xCF, 0x2D, 0x6B, 0x64, 0x7D, 0x52, 0x65, 0xFA, 0x78,
+    0x95, 0xF6, 0x9F, 0xD9, 0x88, 0xCF, 0xDE, 0x75, 0xD5, 0x95, 0xFD, 0x5B, 0x0B, 0xB5, 0x16, 0xF3,
+    0x0A, 0x03, 0x9B, 0x9A, 0x39, 0xCA, 0xD1, 0x49, 0xB5, 0x01, 0x2A, 0x63, 0xCE, 0xDB, 0x55, 0x75,
+    0xD6, 0xD0, 0x85, 0x66, 0x0D, 0xB3, 0x22, 0x09, 0x4D, 0x85, 0x7D, 0x53, 0x8A, 0x6F, 0x74, 0x62,
+    0xB7, 0x63, 0x89, 0xE2, 0x6C, 0x15, 0x2F, 0xB9, 0xD2, 0xE6, 0x95, 0xEA, 0x40, 0x0D, 0xDC, 0x9E,
+    0xAB, 0xF2, 0x7B, 0xFB, 0x05, 0xBB, 0x91, 0x3B, 0xD7, 0x48, 0xB9, 0x4E, 0xAC, 0x11, 0xF8, 0xB9,
+    0xFD, 0x80, 0x0B, 0xA2, 0x63, 0xD7, 0x9F, 0x3F, 0x75, 0xB3, 0xD9, 0xA1, 0x52, 0x55, 0xD0, 0x40,
+    0xA9, 0xBD, 0x62, 0x43, 0x61, 0xB9, 0xE5, 0x1D, 0x9A, 0x64, 0x9B, 0x89, 0x66, 0x5D, 0x5E, 0xB2,
+    0xDE, 0xFF, 0x11, 0xFB, 0xCF, 0x65, 0xE5, 0x69, 0x26, 0x36, 0x5F, 0xBF, 0x48, 0xB3, 0x67, 0x42,
+    0xD1, 0x7F, 0xA5, 0xDA, 0xF3, 0x81, 0xB2, 0xE7, 0x5F, 0xA2, 0xF9, 0x86, 0xFE, 0x05, 0x65, 0x29,
+    0xD9, 0x33, 0x9D, 0x45, 0x57, 0xF8, 0xFD, 0x25, 0x3D, 0xB2, 0x42, 0xE7, 0x42, 0x95, 0xEB, 0x68,
+    0xE4, 0xFE, 0x5A, 0x3B, 0xF0, 0x7F, 0xF6, 0x3B, 0x1F, 0xF2, 0xA5, 0x43, 0x9F, 0xFE, 0x27, 0xB0,
+    0x9D, 0x1D, 0xFB, 0x71, 0xCA, 0xB9, 0x90, 0x16, 0xF0, 0x3B, 0x0F, 0xF4, 0xBC, 0xFA, 0x11, 0xE3,
+    0x8D, 0xE7, 0x2B, 0xE3, 0x58, 0xAA, 0xE0, 0xDD, 0xDC, 0x73, 0x9D, 0x7F, 0xE4, 0x3A, 0x9F, 0xC9,
+    0xD5, 0x31, 0x90, 0xEB, 0x3A, 0x24, 0xD7, 0x25, 0x47, 0x2E, 0x6B, 0xCF, 0xF3, 0xC2, 0x78, 0x56,
+    0x1B, 0x4F, 0x96, 0xC6, 0xA3, 0xC6, 0x78, 0xD8, 0x19, 0x97, 0xDE, 0xF3, 0xD2, 0xF3, 0xAC, 0x33,
+    0x9E, 0x78, 0x1E, 0x7B, 0x1E, 0x76, 0x7E, 0xAE, 0xC8, 0xC8, 0x73, 0xBF, 0x1C, 0x4B, 0x63, 0x36,
+    0x7F, 0xD4, 0x00, 0x74, 0x9E, 0x9B, 0x87, 0x1A, 0x66, 0x11, 0xE6, 0x91, 0xC9, 0x9F, 0x8B, 0xC9,
+    0x9F, 0x0F, 0xF2, 0x8B, 0xC9, 0xAF, 0xD3, 0x6E, 0x65, 0xDC, 0xE4, 0xD7, 0x39, 0x65, 0xF2, 0x8B,
+    0xC9, 0xAF, 0x0E, 0x99, 0xF2, 0x2B, 0xA7, 0xFC, 0xCA, 0x29, 0xBF, 0x72, 0xCA, 0x0F, 0x87, 0xBD,
+    0xF6, 0x1C, 0xF2, 0x83, 0x43, 0x7E, 0x70, 0xC8, 0x0F, 0x0E, 0xF9, 0xC1, 0x21, 0x3F, 0x1D, 0x7C,
+    0xEF, 0x79, 0xE9, 0xB9, 0xCA, 0x4F, 0x9E, 0x78, 0x1E, 0x7B, 0x1E, 0x76, 0xA3, 0xBC, 0x4F, 0xC8,
+    0x6D, 0x0E, 0xAA, 0x2B, 0xF1, 0xB6, 0xBD, 0xF4, 0xFA, 0xB8, 0xB4, 0xA3, 0xC5, 0xBC, 0xF2, 0xEE,
+    0xF2, 0x2B, 0xBD, 0xE0, 0x9B, 0x13, 0x55, 0x55, 0x5A, 0x5C, 0x2F, 0x55, 0x33, 0x3A, 0xC5, 0xCE,
+    0xDE, 0xC5, 0x28, 0xE4, 0x0B, 0x15, 0x53, 0x59, 0xA5, 0xEE, 0x19, 0xF3, 0xCE, 0x4F, 0xEB, 0xF3,
+    0x67, 0xDB, 0xFD, 0xFC, 0x4A, 0x66, 0x92, 0x62, 0x82, 0x8B, 0xCD, 0x71, 0x5B, 0x6E, 0x3E, 0x0C,
+    0x48, 0x11, 0x7A, 0xC8, 0xE4, 0x5F, 0x5A, 0xBA, 0x7E, 0x4A, 0xEF, 0xEA, 0x6D, 0x45, 0x6D, 0x3E,
+    0xF9, 0x96, 0x2E, 0x2C, 0x34, 0x60, 0x98, 0x18, 0xFC, 0x16, 0x77, 0x45, 0xFF, 0x05, 0xCF, 0x16,
+    0xFD, 0x0A, 0x4E, 0x74, 0xB2, 0xE8, 0x18, 0xE0, 0x9C, 0xD0, 0xB2, 0x1D, 0x70, 0xED, 0xDB, 0x0A,
+    0x46, 0x97, 0x4E, 0xE0, 0x95, 0x30, 0xDA, 0x35, 0x42, 0x3C, 0x9D, 0x80, 0x6A, 0x93, 0x75, 0x6E,
+    0x45, 0x8F, 0x66, 0xF7, 0x57, 0xF0, 0x5C, 0x6A, 0xF6, 0xED, 0x02, 0x38, 0x94, 0x53, 0xBF, 0x40,
+    0x79, 0x3B, 0xBB, 0x6A, 0x06, 0x33, 0xA9, 0xC3, 0x4A, 0x8E, 0xC2, 0x26, 0x5E, 0xC8, 0x89, 0x5E,
+    0x91, 0xEB, 0xA4, 0x4D, 0x5A, 0x86, 0xBB, 0xE3, 0xA7, 0x74, 0x85, 0x7A, 0xB2, 0x65, 0xF4, 0xE9,
+    0xD5, 0x55, 0xC0, 0x00, 0x63, 0x70, 0x97, 0x7A, 0xEC, 0xDD, 0xEF, 0xF4, 0xAD, 0x5D, 0xF2, 0x68,
+    0xBF, 0x53, 0x79, 0x3A, 0x5D, 0x1C, 0xDD, 0x01, 0x8F, 0x40, 0xDB, 0x91, 0x7E, 0x97, 0x75, 0xA9,
+    0xEB, 0xEF, 0xC4, 0x6E, 0x79, 0x07, 0x76, 0xE9, 0x48, 0x5E, 0xBD, 0x2B, 0x6D, 0xFA, 0xB7, 0xCB,
+    0xC9, 0xE7, 0x35, 0xE2, 0xAB, 0xDE, 0xBF, 0x22, 0x53, 0x3B, 0xE7, 0x9A, 0x60, 0x5D, 0x98, 0x17,
+    0x7E, 0xEA, 0xBF, 0x5E, 0x9F, 0xD0, 0xE8, 0xDF, 0x0F, 0xE5, 0xFB, 0x99, 0x9C, 0x24, 0xBF, 0x58,
+    0x45, 0xAA, 0x51, 0x87, 0x29, 0xE3, 0x3F, 0x53, 0x6A, 0xFD, 0x69, 0xFF, 0xBE, 0x2F, 0x7B, 0x05,
+    0xDC, 0x64, 0x46, 0x38, 0xD0, 0x71, 0x9D, 0x53, 0x31, 0xE5, 0xC2, 0x63, 0x8F, 0xDD, 0x0F, 0x90,
+    0x88, 0x10, 0x88, 0x18, 0x0E, 0x21, 0x0C, 0xE9, 0x89, 0x42, 0x4A, 0xC6, 0xB5, 0x59, 0x65, 0xB0,
+    0xC1, 0x30, 0x84, 0x01, 0x0A, 0x43, 0x17, 0xFD, 0xF8, 0x8A, 0x81, 0xF6, 0x23, 0x8D, 0x1B, 0xBB,
+    0xD2, 0xEE, 0xB2, 0x27, 0x18, 0xEE, 0x30, 0xD8, 0x61, 0xA8, 0xC3, 0x83, 0x8E, 0x39, 0xE3, 0x27,
+    0x0F, 0x39, 0xB0, 0xFA, 0x02, 0x86, 0x59, 0x5D, 0x88, 0x20, 0x1B, 0xF3, 0x21, 0x41, 0x2C, 0x19,
+    0xE3, 0xB9, 0x61, 0xBB, 0xD3, 0x7B, 0x00, 0x04, 0x62, 0x05, 0x05, 0x21, 0xEC, 0x74, 0x69, 0x10,
+    0x84, 0xB8, 0x82, 0x10, 0x23, 0xF7, 0xEF, 0x9F, 0x8C, 0x84, 0xFF, 0x26, 0x35, 0x2F, 0xE1, 0xC5,
+    0xBC, 0x2D, 0x3A, 0xDB, 0xEB, 0x3D, 0xEC, 0x30, 0xD4, 0x71, 0x63, 0x88, 0xF6, 0x3A, 0x84, 0x15,
+    0x1A, 0xE5, 0xF9, 0x6E, 0x44, 0xE8, 0x65, 0xB0, 0xD3, 0x0D, 0x8F, 0x3F, 0xCE, 0x9D, 0x44, 0x0D,
+    0x91, 0x06, 0x40, 0xDA, 0x32, 0x07, 0xCA, 0x20, 0xC6, 0x30, 0x84, 0x61, 0xF8, 0x42, 0xD1, 0x45,
+    0x58, 0x04, 0x87, 0x61, 0xA3, 0xDD, 0xEB, 0xB0, 0x16, 0x7A, 0xBF, 0x16, 0x96, 0x63, 0xE7, 0x74,
+    0x3E, 0x4D, 0x81, 0x18, 0x9E, 0xF0, 0x28, 0x81, 0x28, 0x80, 0x27, 0x80, 0x26, 0x80, 0x25, 0x80,
+    0x24, 0x88, 0x23, 0x2E, 0x31, 0xE8, 0x6F, 0x80, 0xFA, 0x94, 0xBC, 0x37, 0x3B, 0xDA, 0x56, 0xC1,
+    0xDD, 0x48, 0xDF, 0x78, 0x00, 0x54, 0x74, 0x3D, 0x5A, 0x5C, 0x18, 0xD5, 0x38, 0x57, 0xE3, 0x08,
+    0x66, 0x33, 0x9B, 0xF6, 0x2F, 0x06, 0x22, 0x6D, 0x52, 0x07, 0x7A, 0xC8, 0x6A, 0x52, 0x3D, 0x13,
+    0x15, 0x59, 0x98, 0xCF, 0x80, 0x38, 0x1F, 0xC2, 0xAE, 0x60, 0x79, 0xA1, 0xF5, 0xE4, 0xD7, 0x52,
+    0x6D, 0x58, 0x4F, 0xCF, 0x60, 0xE1, 0xC5, 0xD5, 0xF3, 0xD1, 0x57, 0x21, 0x2F, 0xEA, 0x4B, 0x02,
+    0xAC, 0xB1, 0x64, 0x77, 0x8D, 0x7D, 0x70, 0xA1, 0x95, 0xA6, 0xD0, 0xE1, 0x46, 0x04, 0x1F, 0xD4,
+    0x6F, 0xAD, 0xBB, 0xBD, 0xA3, 0xE7, 0xA3, 0xB4, 0xF9, 0x68, 0xCB, 0x61, 0x97, 0x38, 0x5E, 0x22,
+    0x77, 0x2E, 0xFC, 0x24, 0x23, 0xE0, 0x9E, 0xFB, 0xAE, 0xAB, 0xEA, 0x24, 0x68, 0x9E, 0xD3, 0xA2,
+    0x34, 0x47, 0xA7, 0x18, 0xB4, 0xCE, 0xEE, 0xDD, 0xD6, 0x97, 0x46, 0x43, 0x4C, 0x70, 0xEA, 0xE3,
+    0xE3, 0xFC, 0xDA, 0x6C, 0x36, 0x57, 0x37, 0xE8, 0x70, 0xE8, 0x73, 0xA6, 0x48, 0xB1, 0x00, 0x39,
+    0xA7, 0x75, 0xD8, 0x26, 0xAB, 0xAB, 0x8D, 0x8A, 0x53, 0xCB, 0x7C, 0xCD, 0x81, 0x97, 0x94, 0x49,
+    0x9E, 0x94, 0x1E, 0xEB, 0xF2, 0xEC, 0xC3, 0x2F, 0xF8, 0xD4, 0xA4, 0x7E, 0x20, 0x03, 0x68, 0x9F,
+    0x54, 0x77, 0x2E, 0x78, 0x2C, 0xA5, 0xAE, 0x1F, 0xC7, 0x37, 0x19, 0xC9, 0xF3, 0x8C, 0xA9, 0xE4,
+    0xD2, 0xFE, 0xDB, 0xA3, 0xFE, 0x52, 0x9F, 0x6A, 0xE4, 0xE7, 0x0F, 0xB6, 0x35, 0xB4, 0x81, 0xBE,
+    0xFE, 0xFB, 0x0B, 0xAD, 0xBF, 0xFD, 0x7D, 0x8B, 0xB9, 0xC3, 0x85, 0xC5, 0xA2, 0x38, 0xC2, 0xC5,
+    0x33, 0x89, 0x49, 0x65, 0xE3, 0x7F, 0xE7, 0x4C, 0x94, 0xE2, 0xE9, 0xAB, 0xAF, 0x49, 0xD3, 0x39,
+    0x58, 0x54, 0x48, 0xE8, 0xD3, 0x93, 0xE4, 0xF1, 0xD2, 0xC0, 0x40, 0xB2, 0x30, 0xCE, 0xEC, 0x1C,
+    0x71, 0x43, 0xB7, 0x49, 0xB1, 0x0A, 0x94, 0x34, 0x24, 0x0F, 0xC8, 0x35, 0x14, 0x5A, 0xCF, 0x66,
+    0x4C, 0x7F, 0x32, 0x51, 0xA4, 0xD6, 0x87, 0xDC, 0x72, 0x4D, 0x08, 0x9D, 0x0C, 0x5C, 0xE6, 0x9E,
+    0x97, 0xB3, 0x59, 0x27, 0x43, 0xA2, 0xCA, 0xC2, 0x26, 0x9F, 0xA7, 0x26, 0x8F, 0x3D, 0x87, 0xE1,
+    0xC7, 0x73, 0xA1, 0x69, 0xF4, 0x0F, 0x23, 0x6F, 0xFD, 0xBC, 0x36, 0x3B, 0x36, 0xE9, 0xDA, 0xAF,
+    0x11, 0x32, 0x98, 0xF7, 0x32, 0x5F, 0x21, 0xDF, 0xF9, 0x4F, 0xDA, 0x91, 0xC9, 0xC3, 0x5B, 0x9F,
+    0x2F, 0xCA, 0x2A, 0x50, 0x39, 0x39, 0x78, 0x1A, 0xC9, 0x22, 0x14, 0x42, 0x7E, 0xAC, 0x19, 0xD8,
+    0xF7, 0xEE, 0xAF, 0x67, 0xF7, 0x1B, 0x0C, 0xB6, 0x0E, 0x77, 0xF2, 0xE8, 0x1D, 0x7D, 0xF1, 0x51,
+    0x5E, 0x31, 0xA2, 0x2B, 0xCD, 0x42, 0x1D, 0x00, 0x4C, 0x82, 0xD1, 0x0F, 0x69, 0xB0, 0x8A, 0x9E,
+    0xE4, 0x55, 0x79, 0xEB, 0xE1, 0xF7, 0x16, 0x3A, 0x0C, 0x3A, 0x8A, 0x0B, 0x1D, 0x89, 0x00, 0x1D,
+    0xD4, 0xC1, 0xB8, 0x54, 0x6C, 0xFA, 0xE2, 0x0E, 0x31, 0x9F, 0x61, 0x1C, 0xDC, 0xA3, 0xFB, 0x1D,
+    0xEF, 0xFF, 0xA1, 0xCF, 0xFB, 0x59, 0x8A, 0xCC, 0xE6, 0xB4, 0x01, 0xF2, 0x53, 0xD2, 0x7E, 0x8B,
+    0x22, 0x3B, 0xB7, 0x26, 0x75, 0x9E, 0xF6, 0x1C, 0x8B, 0x53, 0x52, 0xBD, 0x6B, 0x36, 0x3F, 0xCA,
+    0x19, 0x80, 0xA9, 0x99, 0x9D, 0xB9, 0x23, 0x44, 0xE9, 0x39, 0x62, 0x69, 0x61, 0x15, 0xE1, 0x1D,
+    0xC7, 0x48, 0xDE, 0x31, 0x8D, 0xF7, 0x10, 0xCB, 0x6C, 0xCC, 0x9C, 0x97, 0xFD, 0xA4, 0x62, 0xFE,
+    0x2B, 0x3E, 0xBB, 0xE9, 0x2A, 0xE6, 0xC6, 0x32, 0xA4, 0xDE, 0x98, 0x37, 0x63, 0x16, 0x6D, 0x20,
+    0xC9, 0x48, 0xFC, 0x77, 0x48, 0xE8, 0x23, 0x91, 0x56, 0x56, 0x93, 0x55, 0xE8, 0x2A, 0x9D, 0x41,
+    0xBF, 0xAC, 0x98, 0x41, 0x93, 0xE0, 0x46, 0x82, 0x45, 0x08, 0xC2, 0xC0, 0xD9, 0x61, 0x94, 0xF6,
+    0xCB, 0xC3, 0x4B, 0x90, 0x30, 0xF9, 0xEC, 0x66, 0x8F, 0xCC, 0xE9, 0x4A, 0xD5, 0xA2, 0x20, 0x49,
+    0x01, 0xA7, 0xA2, 0xB6, 0xC9, 0x22, 0xAD, 0x98, 0xB2, 0x57, 0xE9, 0xA1, 0xF0, 0xBC, 0xB1, 0x92,
+    0xC4, 0xCE, 0x80, 0xAA, 0x12, 0xA9, 0x43, 0xA8, 0x90, 0x1A, 0x4C, 0x56, 0x63, 0x44, 0x55, 0x0D,
+    0xDA, 0x3B, 0x1D, 0xB5, 0xD6, 0xFB, 0x09, 0x36, 0xFB, 0x90, 0x2A, 0x23, 0xC1, 0x77, 0x25, 0xB5,
+    0x46, 0xDB, 0x0E, 0xAD, 0xE7, 0x8C, 0x6F, 0xA8, 0xB1, 0x18, 0xC9, 0x1E, 0xD3, 0x17, 0xD5, 0x65,
+    0xDA, 0x52, 0x65, 0x19, 0xEE, 0x68, 0x31, 0x57, 0x0E, 0xD0, 0xAB, 0x14, 0xC0, 0x79, 0xD2, 0xDB,
+    0xC4, 0xDF, 0xC1, 0x1D, 0xAA, 0xCE, 0x80, 0xEA, 0xEC, 0xA1, 0xCE, 0xA5, 0x02, 0x37, 0x66, 0x32,
+    0xB3, 0xC7, 0xA8, 0x73, 0xD0, 0x69, 0x61, 0x3A, 0xCD, 0x31, 0x0A, 0xAA, 0x53, 0x64, 0x27, 0xC3,
+    0x2D, 0x9D, 0x16, 0x49, 0x35, 0x64, 0x50, 0x09, 0xE2, 0x91, 0x16, 0x13, 0x07, 0x75, 0x76, 0x50,
+    0x67, 0x63, 0xEA, 0x0C, 0xAB, 0xE0, 0x48, 0x08, 0x81, 0x19, 0x7F, 0xA0, 0x80, 0x60, 0x11, 0xC8,
+    0x0E, 0x0C, 0x66, 0x92, 0x86, 0x86, 0xAA, 0xB4, 0x4C, 0xB9, 0xCF, 0x13, 0xEB, 0x9B, 0x3B, 0x4B,
+    0x0B, 0xAF, 0x81, 0x6F, 0xB0, 0x2A, 0x51, 0xC9, 0xE8, 0xA0, 0x22, 0x18, 0x1F, 0x59, 0x3B, 0x8E,
+    0xA9, 0x3E, 0xDD, 0xFD, 0x9D, 0x3E, 0x6F, 0x1D, 0x71, 0xE1, 0xF6, 0x20, 0xB0, 0x4D, 0x88, 0x15,
+    0x59, 0xA9, 0xEA, 0x24, 0x5E, 0x31, 0x59, 0x83, 0x01, 0x70, 0x4C, 0xC4, 0xE2, 0x6D, 0xE9, 0x42,
+    0x51, 0x2D, 0xAC, 0xAD, 0x5A, 0x5E, 0x45, 0xB6, 0x30, 0x3B, 0x30, 0x84, 0xC4, 0x55, 0x23, 0xBE,
+    0xB5, 0xBC, 0xD3, 0xF4, 0x49, 0x88, 0xF6, 0x70, 0x8A, 0x5A, 0xCB, 0x14, 0x81, 0xC3, 0x14, 0x11,
+    0xC4, 0x14, 0x2B, 0x74, 0x8A, 0x95, 0x35, 0xC5, 0xC4, 0x98, 0xA2, 0xD3, 0x53, 0x2E, 0x53, 0x64,
+    0x30, 0x72, 0x74, 0x3A, 0x47, 0xA7, 0xA7, 0xE8, 0xF4, 0x14, 0x9D, 0x9E, 0xA2, 0xD3, 0x53, 0x74,
+    0x7A, 0x0A, 0x25, 0x4C, 0x6D, 0xA9, 0x5F, 0x48, 0x08, 0xCC, 0x19, 0x20, 0xA9, 0x25, 0x98, 0x64,
+    0x13, 0xDA, 0x19, 0xCD, 0x69, 0xF8, 0x33, 0x0E, 0x73, 0x50, 0x3C, 0x07, 0x24, 0x8C, 0x60, 0x26,
+    0xA0, 0x57, 0xC5, 0x20, 0xC6, 0xF5, 0x40, 0xA2, 0x47, 0xCC, 0x2E, 0x0C, 0x43, 0x79, 0x19, 0x8E,
+    0x01, 0x86, 0x98, 0xE5, 0x43, 0x77, 0xD1, 0xF3, 0x0C, 0x13, 0x5A, 0x9D, 0x84, 0x9D, 0x7B, 0x9D,
+    0xF4, 0xFA, 0x16, 0xCD, 0xE9, 0x76, 0x68, 0x78, 0x4C, 0xC9, 0xF4, 0xB7, 0x44, 0xBE, 0x73, 0xD7,
+    0x3C, 0xA7, 0x14, 0xC4, 0x93, 0x29, 0x1E, 0x09, 0x00, 0xD5, 0x06, 0x80, 0x40, 0x47, 0x53, 0xC0,
+    0xD0, 0x94, 0xA6, 0x60, 0xB9, 0x13, 0x76, 0xC2, 0x53, 0x6F, 0x88, 0x8F, 0x81, 0x31, 0x00, 0x66,
+    0x56, 0x37, 0x5F, 0x2D, 0x06, 0x47, 0x05, 0x77, 0xA6, 0x42, 0x57, 0xDE, 0xB4, 0x5B, 0x0A, 0xC6,
+    0xC0, 0x07, 0xCF, 0x13, 0x81, 0x6C, 0x48, 0x2E, 0xF0, 0xDB, 0xB2, 0x2E, 0xAE, 0x76, 0xC2, 0x58,
+    0x2A, 0x73, 0xB0, 0xFC, 0x57, 0xF4, 0xD8, 0x2B, 0x82, 0x2A, 0x5E, 0x22, 0xAA, 0xCC, 0x2D, 0xED,
+    0x8F, 0xF9, 0x3B, 0x59, 0x6C, 0x77, 0x6E, 0xA5, 0x47, 0x7B, 0x0D, 0xC1, 0x17, 0x4F, 0xE0, 0x89,
+    0x07, 0x16, 0x32, 0xC0, 0xA4, 0xC1, 0x1C, 0x63, 0x78, 0xB1, 0xC6, 0xD1, 0xFB, 0x8F, 0xB0, 0xCE,
+    0xD3, 0x46, 0x36, 0x91, 0xD4, 0x89, 0x3F, 0xEE, 0x7A, 0xCE, 0x72, 0xD8, 0x0D, 0xF5, 0xBE, 0xF3,
+    0x7B, 0xF3, 0x85, 0x0E, 0xBD, 0x0E, 0xFC, 0x43, 0x39, 0xE7, 0x6C, 0xDB, 0xF8, 0x37, 0x85, 0x47,
+    0xFA, 0x87, 0x0E, 0xA5, 0xB1, 0xF9, 0xE2, 0xFF, 0x5D, 0x6D, 0xD4, 0x2A, 0xA1, 0x9C, 0x2B, 0xBE,
+    0xA8, 0xE0, 0x7C, 0x19, 0x5C, 0x06, 0x61, 0xBF, 0xBB, 0x95, 0xD0, 0xDD, 0x9A, 0xE6, 0xB7, 0x6B,
+    0x7C, 0x77, 0x2A, 0xA1, 0xD8, 0xEA, 0x31, 0x2C, 0xF2, 0x60, 0x88, 0xD5, 0xCD, 0x58, 0x26, 0x72,
+    0x51, 0xE2, 0x34, 0xBF, 0x9B, 0x22, 0x1D, 0x0D, 0x15, 0xDF, 0xD2, 0xCA, 0x2E, 0xE0, 0xBA, 0x08,
+    0x71, 0xDA, 0x03, 0xAB, 0x7D, 0x76, 0x66, 0xBC, 0xBE, 0x91, 0x4D, 0x6A, 0x63, 0x8B, 0x5D, 0xE6,
+    0x66, 0xB3, 0xB9, 0x70, 0x9F, 0x81, 0xDB, 0xB0, 0xAF, 0xBC, 0xF2, 0xEB, 0x19, 0x57, 0x8E, 0xBA,
+    0x45, 0xB0, 0xE4, 0xD3, 0x39, 0x96, 0xCF, 0x84, 0x30, 0x43, 0xC7, 0xA1, 0xDD, 0xD9, 0xEB, 0xF3,
+    0xF3, 0x58, 0x6D, 0x63, 0x97, 0xEB, 0xB7, 0xDD, 0xFA, 0xE6, 0x1A, 0xA5, 0xE6, 0x12, 0x05, 0xD1,
+    0xAC, 0xC2, 0xBE, 0x92, 0x9A, 0x68, 0xAF, 0xDF, 0x25, 0x9D, 0x27, 0x0C, 0x35, 0x09, 0x21, 0x89,
+    0x1F, 0x4F, 0x77, 0x82, 0xCE, 0x14, 0xCB, 0xB1, 0xD4, 0x39, 0x1A, 0x22, 0xE8, 0xCC, 0x56, 0x43,
+    0x94, 0xD9, 0x0F, 0x00, 0xBE, 0x1F, 0x6B, 0xD5, 0x8F, 0x27, 0xF2, 0x72, 0x35, 0x78, 0x29, 0x06,
+    0xBB, 0x96, 0x8C, 0x87, 0xD9, 0x97, 0x57, 0xB6, 0x07, 0x9F, 0xC5, 0x4C, 0x56, 0x32, 0x59, 0xC6,
+    0x64, 0x0D, 0x93, 0x05, 0x4C, 0x56, 0x2F, 0x59, 0xBA, 0x64, 0xDD, 0x92, 0x45, 0x4B, 0x56, 0x2C,
+    0x59, 0xAE, 0x64, 0xAD, 0x92, 0x85, 0x4A, 0x56, 0x29, 0x59, 0xA2, 0x64, 0x7D, 0x92, 0xC5, 0x49,
+    0x56, 0x26, 0x59, 0x96, 0x64, 0x4D, 0x92, 0x05, 0x49, 0x56, 0x23, 0x59, 0x8A, 0xB4, 0x3A, 0xE4,
+    0x87, 0x5B, 0x59, 0x2E, 0xB8, 0x32, 0xA6, 0xE7, 0x3E, 0xD9, 0xA9, 0x19, 0xA2, 0x60, 0x88, 0x6A,
+    0x21, 0x4A, 0x85, 0xA8, 0x13, 0xC2, 0x8B, 0x3C, 0xED, 0xE1, 0x17, 0xA8, 0xB9, 0x0B, 0xEF, 0x4C,
+    0xB3, 0xAD, 0x8A, 0xEE, 0xEB, 0xC5, 0x58, 0xE5, 0x8D, 0x6A, 0x86, 0x11, 0xF5, 0x27, 0xA4, 0x1F,
+    0x63, 0xA1, 0xFC, 0x47, 0xB3, 0xC9, 0x9F, 0x18, 0xFD, 0x2D, 0x53, 0x89, 0xFF, 0xBD, 0xC9, 0x9F,
+    0xC4, 0x3E, 0x7F, 0xC2, 0xDD, 0x11, 0xD5, 0x74, 0xCC, 0x9F, 0x4C, 0x59, 0x0D, 0x1D, 0xF2, 0x27,
+    0xFA, 0x62, 0xCB, 0x9F, 0x44, 0x63, 0xFE, 0xA4, 0x65, 0x6F, 0x98, 0x5A, 0xD1, 0xCB, 0xB0, 0x3C,
+    0xCA, 0x9D, 0xCC, 0x49, 0xEF, 0x51, 0x9F, 0x4A, 0x2F, 0xF3, 0xC2, 0xBC, 0x9C, 0xB7, 0x3F, 0x00,
+    0xB3, 0xAF, 0xDF, 0x56, 0x25, 0xA9, 0xB5, 0x79, 0x63, 0x62, 0x3C, 0xD5, 0xEB, 0xF7, 0x1E, 0x3E,
+    0xAB, 0x4C, 0x8A, 0x84, 0xBE, 0x92, 0x31, 0xF1, 0x71, 0x5D, 0x5A, 0xEF, 0x96, 0x8B, 0x1F, 0x78,
+    0xBE, 0x94, 0xFF, 0x8B, 0x19, 0x16, 0x09, 0x8F, 0xB7, 0xA5, 0xF7, 0x60, 0xDC, 0x6F, 0xFA, 0xBA,
+    0x6B, 0x22, 0x36, 0x72, 0x51, 0xD3, 0x2E, 0xEF, 0x6D, 0xB2, 0x27, 0x56, 0x1A, 0xB4, 0x98, 0xD7,
+    0x10, 0xD4, 0x8E, 0x35, 0x90, 0x3F, 0x24, 0x08, 0x49, 0x0B, 0xF3, 0x25, 0x00, 0x21, 0x1D, 0x40,
+    0x48, 0xC4, 0xA0, 0x5D, 0x3B, 0xAE, 0x7E, 0x27, 0x71, 0xB0, 0xFD, 0xD9, 0x5B, 0x00, 0x21, 0x07,
+    0x04, 0x21, 0x1D, 0x40, 0x88, 0xE2, 0x6C, 0x05, 0x1B, 0xF1, 0x02, 0xF0, 0x23, 0xA9, 0x41, 0x73,
+    0xC2, 0x8F, 0x13, 0x50, 0x95, 0x40, 0x41, 0x88, 0x0A, 0xA8, 0x20, 0x44, 0x07, 0x4B, 0x43, 0x7B,
+    0xB8, 0xE8, 0x3A, 0x77, 0xB4, 0xB6, 0xDD, 0x06, 0x84, 0xC4, 0x04, 0x21, 0x09, 0x97, 0x4A, 0xF6,
+    0x63, 0x8C, 0xE9, 0xE5, 0xED, 0x9D, 0x79, 0xAC, 0x1D, 0x58, 0x38, 0x9E, 0x8D, 0x38, 0xB9, 0xDD,
+    0x29, 0x1E, 0xD1, 0x44, 0x67, 0xEE, 0xAD, 0x0A, 0x43, 0x37, 0xE0, 0x0D, 0xC5, 0x01, 0x69, 0x1D,
+    0xB9, 0x22, 0x2B, 0x26, 0xBF, 0x54, 0xA8, 0x91, 0xBE, 0xA5, 0x64, 0x0A, 0x80, 0xD1, 0x29, 0xD4,
+    0x08, 0x57, 0x4A, 0x34, 0xEE, 0x5E, 0xE4, 0x49, 0xAD, 0x78, 0xE3, 0x36, 0xF0, 0x46, 0x0F, 0xBC,
+    0xD1, 0x6A, 0xB7, 0xE2, 0x7E, 0xCF, 0x67, 0x68, 0xD2, 0x8F, 0xD4, 0x4C, 0xC6, 0xE3, 0x3E, 0xCB,
+    0xE0, 0xF8, 0x1A, 0xBD, 0x3F, 0x3C, 0xB1, 0x06, 0xCB, 0xF4, 0xB2, 0x0C, 0x03, 0x92, 0x0A, 0x66,
+    0x21, 0xAC, 0x5F, 0xBB, 0xD8, 0x29, 0xED, 0x6B, 0xBA, 0xA2, 0xB3, 0x9F, 0xB5, 0xF4, 0x49, 0x51,
+    0xA3, 0x76, 0x6B, 0xA5, 0x58, 0xFA, 0x8D, 0xE8, 0xD9, 0xA4, 0xB2, 0xE5, 0x3D, 0x4C, 0xC4, 0x88,
+    0x99, 0xC9, 0xE4, 0x11, 0x37, 0x74, 0x11, 0x4F, 0xFE, 0x40, 0x5E, 0xB8, 0xD8, 0x5A, 0x92, 0xBD,
+    0x63, 0x68, 0x42, 0x3B, 0x31, 0xAF, 0xC3, 0x65, 0xB4, 0x08, 0xEB, 0x60, 0xF1, 0x2C, 0x34, 0x74,
+    0x2D, 0x3C, 0x94, 0xFC, 0xCF, 0x56, 0x36, 0x1A, 0xCB, 0xBB, 0x8A, 0x68, 0x75, 0x34, 0x7E, 0x12,
+    0x6F, 0x65, 0x2E, 0x0C, 0xFA, 0x11, 0x02, 0xEE, 0xEC, 0xF9, 0xFA, 0xC2, 0xF1, 0x9F, 0x6A, 0x30,
+    0x90, 0xFA, 0xC4, 0xF1, 0xB8, 0xEB, 0x70, 0xCC, 0x66, 0xC7, 0xFE, 0x99, 0x2D, 0x66, 0x83, 0xA4,
+    0xBF, 0x68, 0xBD, 0x5A, 0x23, 0xDE, 0xDC, 0x26, 0xFA, 0xFE, 0xD7, 0xA2, 0x9D, 0xDD, 0x10, 0xD9,
+    0x9A, 0x46, 0x51, 0x8D, 0xC1, 0xD9, 0xD5, 0xD6, 0x72, 0x64, 0xBA, 0x94, 0xA9, 0xC0, 0xDC, 0x60,
+    0x5E, 0x8E, 0x38, 0x2C, 0xC7, 0xE2, 0xD3, 0xD6, 0xCC, 0xC6, 0x33, 0x1F, 0xCD, 0x25, 0xFD, 0x06,
+    0x17, 0x70, 0xDC, 0xFF, 0xE8, 0xAF, 0x7C, 0x78, 0x9B, 0x71, 0x62, 0xA0, 0xDA, 0xF1, 0xF2, 0x21,
+    0xB7, 0x5E, 0xC5, 0x8F, 0xD4, 0x5E, 0x16, 0x89, 0xCE, 0x8E, 0x78, 0xDB, 0x85, 0x70, 0x13, 0xA9,
+    0x1E, 0x8B, 0x6E, 0x47, 0xD7, 0xBB, 0x87, 0xC6, 0x81, 0xD8, 0x20, 0x58, 0xE3, 0x78, 0xDC, 0x75,
+    0x1D, 0x11, 0xDB, 0xEC, 0xD0, 0x3F, 0x73, 0xC9, 0xA1, 0xD6, 0x8E, 0x17, 0x1C, 0x6C, 0xB5, 0x28,
+    0x1A, 0x26, 0x87, 0xF5, 0xAE, 0x43, 0x7B, 0xB6, 0xD2, 0xFF, 0xE5, 0x9E, 0xC6, 0xCD, 0xEA, 0x8C,
+    0xB2, 0x9F, 0xAD, 0x18, 0xE4, 0x86, 0x4B, 0x5D, 0x96, 0x1F, 0x4F, 0xC6, 0xB7, 0x87, 0x0E, 0x59,
+    0x1A, 0x9D, 0x8C, 0xE9, 0x43, 0xF3, 0x41, 0xE7, 0x72, 0x2C, 0xF8, 0x4C, 0x1C, 0x34, 0x09, 0x7F,
+    0x33, 0x4C, 0xC2, 0xC1, 0x24, 0xC4, 0x9B, 0xF1, 0x47, 0xC9, 0x14, 0x36, 0xEE, 0x77, 0x3C, 0x82,
+    0x0F, 0xD5, 0xC2, 0x2F, 0xF2, 0x5F, 0x37, 0x6F, 0xCA, 0x4F, 0xDE, 0x97, 0x37, 0xCE, 0x77, 0xAB,
+    0x90, 0x3E, 0x3C, 0x75, 0x75, 0xFE, 0x79, 0xF3, 0x73, 0x69, 0x3E, 0x96, 0xF7, 0x7D, 0xCF, 0xDB,
+    0x6F, 0xF5, 0xCC, 0xE3, 0x97, 0x31, 0x68, 0x3D, 0xDD, 0x7D, 0x4E, 0xA7, 0x99, 0xFE, 0x88, 0x31,
+    0x1F, 0xA3, 0xBD, 0x60, 0xF1, 0x83, 0xEF, 0xC2, 0x3E, 0xA1, 0xCB, 0x3F, 0x3D, 0xC6, 0x6D, 0xBD,
+    0xAF, 0x3E, 0x07, 0x2B, 0xC4, 0xA5, 0x77, 0x90, 0x23, 0x7B, 0x25, 0x58, 0x3C, 0xC7, 0x7D, 0x42,
+    0x58, 0xDB, 0xDC, 0x6D, 0x0F, 0x89, 0x1E, 0x31, 0x15, 0x5F, 0x00, 0x2D, 0xBF, 0x20, 0x93, 0xEF,
+    0x82, 0x1A, 0x31, 0x6B, 0x51, 0xEC, 0xD0, 0x1B, 0xCA, 0x8F, 0xF4, 0xD4, 0x0A, 0x01, 0xDF, 0x52,
+    0xFE, 0xFA, 0xF9, 0x69, 0x90, 0x36, 0x1A, 0x2E, 0xDB, 0x70, 0x24, 0x9D, 0x36, 0x97, 0xE8, 0x8E,
+    0xDB, 0xC6, 0x0D, 0x9F, 0x31, 0xF4, 0x5D, 0x5A, 0xFC, 0x9B, 0x8B, 0x62, 0xC9, 0xDC, 0xA3, 0x8B,
+    0x1C, 0xBB, 0x22, 0xB3, 0x91, 0xE4, 0xB6, 0x49, 0x32, 0x47, 0x62, 0x33, 0xBF, 0x77, 0xB3, 0xC5,
+    0x1D, 0x0B, 0x10, 0x9E, 0x82, 0x51, 0x43, 0x26, 0x00, 0x55, 0x85, 0x9C, 0x29, 0x30, 0xC4, 0xA0,
+    0xB9, 0x4F, 0xBB, 0xF0, 0x79, 0x1C, 0x09, 0x93, 0xA8, 0xF9, 0xD3, 0x3D, 0xF8, 0xB0, 0x46, 0xD2,
+    0x7F, 0xD4, 0x11, 0x5B, 0xC0, 0x87, 0x29, 0xD0, 0x7A, 0x7F, 0xE3, 0xC3, 0xA2, 0x7A, 0x5E, 0x47,
+    0xFF, 0xE6, 0xEA, 0xE8, 0xDF, 0x3F, 0xAB, 0x34, 0x94, 0x54, 0x2F, 0x68, 0xB0, 0xEC, 0x69, 0x2D,
+    0x08, 0x27, 0x12, 0x37, 0xE8, 0x46, 0x6B, 0x87, 0xCD, 0x03, 0xEA, 0xA6, 0x26, 0x12, 0x17, 0x3B,
+    0x70, 0xE3, 0x98, 0xA1, 0x7B, 0x65, 0x29, 0xD6, 0x0E, 0x63, 0xEB, 0x61, 0xB6, 0x76, 0xBE, 0xF3,
+    0x80, 0xE2, 0x64, 0xFC, 0x97, 0xF8, 0xBB, 0x95, 0xF5, 0xFE, 0xED, 0xA5, 0x45, 0xFC, 0x04, 0x0E,
+    0xFD, 0x76, 0x31, 0xA7, 0x1A, 0x4A, 0x42, 0xFC, 0x35, 0x11, 0xC1, 0xBA, 0x3D, 0xEF, 0xD4, 0x12,
+    0x4A, 0x96, 0x33, 0x7B, 0x4F, 0xA7, 0xCC, 0x32, 0xFD, 0x75, 0x7B, 0x5D, 0xDE, 0x7C, 0x43, 0x5E,
+    0x1B, 0xA0, 0x6C, 0x77, 0x3D, 0xEF, 0xAE, 0x9F, 0xFE, 0x7D, 0xDE, 0x48, 0x5E, 0x0B, 0xD5, 0xFA,
+    0xCD, 0x7F, 0x97, 0xAB, 0x0F, 0xC6, 0x65, 0x4B, 0x67, 0x3C, 0x2E, 0xDB, 0x17, 0xB6, 0x83, 0xDD,
+    0xDF, 0xEF, 0x7E, 0x95, 0x6F, 0xF2, 0x18, 0xE7, 0xBA, 0x3F, 0xC5, 0x2F, 0x40, 0x40, 0x62, 0x2C,
+    0xC0, 0x4F, 0xB0, 0x00, 0x8F, 0x46, 0x0B, 0xFF, 0xFB, 0xDF, 0xBB, 0xB3, 0x1B, 0x2A, 0xD6, 0xDB,
+    0xA1, 0xE2, 0x79, 0xEF, 0xD3, 0x91, 0xDB, 0xEE, 0x30, 0x42, 0x78, 0xB9, 0xBE, 0xDF, 0xEA, 0x0A,
+    0x7D, 0x29, 0x2F, 0xB6, 0xC2, 0xBA, 0xC2, 0xB6, 0xA9, 0x21, 0xD1, 0x18, 0x33, 0x79, 0x74, 0xE6,
+    0xED, 0xD6, 0xBC, 0xE1, 0x4E, 0x70, 0x83, 0x82, 0xA7, 0x1E, 0x3E, 0xE1, 0x38, 0x79, 0x11, 0x61,
+    0xE9, 0xBD, 0x5B, 0x2B, 0xD8, 0xDC, 0x0C, 0x36, 0xEF, 0x8A, 0x5F, 0x4D, 0x70, 0x7A, 0xA8, 0x9F,
+    0x22, 0xB7, 0x89, 0x68, 0xF0, 0x95, 0xCD, 0x36, 0x13, 0x54, 0xE1, 0xB5, 0x5F, 0x75, 0xBE, 0xB8,
+    0xC5, 0x9F, 0x21, 0x1C, 0x0C, 0xEF, 0xC7, 0x06, 0x35, 0xEC, 0x8F, 0x83, 0x62, 0x32, 0xEC, 0x05,
+    0x72, 0x95, 0x45, 0x3E, 0xC8, 0x77, 0xF0, 0x61, 0x6A, 0x1C, 0x6E, 0xD7, 0xFA, 0x2E, 0x35, 0x55,
+    0xED, 0xF8, 0x83, 0x35, 0x8B, 0x46, 0x2A, 0xDB, 0x45, 0xFE, 0xBA, 0xAF, 0xEA, 0xBD, 0x68, 0xA9,
+    0x83, 0x66, 0x43, 0x9E, 0x28, 0xFB, 0x75, 0x3E, 0x64, 0xF3, 0x39, 0x19, 0xBF, 0x6B, 0x87, 0x72,
+    0x13, 0x93, 0xA8, 0x4C, 0xC8, 0x34, 0xF8, 0xD3, 0xEF, 0xD4, 0x36, 0xA5, 0xAE, 0x2B, 0x5D, 0xF7,
+    0xC7, 0xBF, 0x79, 0x3B, 0xE2, 0xBF, 0x8F, 0xFB, 0x5B, 0xC1, 0xA5, 0x21, 0xB1, 0x97, 0xF5, 0x3E,
+    0xAF, 0xA3, 0x3A, 0x56, 0x15, 0xA8, 0x96, 0x53, 0xCA, 0xFE, 0xD2, 0x90, 0x44, 0xD0, 0x90, 0x28,
+    0x65, 0x1A, 0xFA, 0xD3, 0x9B, 0x1D, 0x2A, 0x6F, 0xFD, 0x98, 0x32, 0x2E, 0x65, 0x27, 0x83, 0xCC,
+    0x5C, 0x06, 0x7F, 0x9F, 0xB8, 0xC4, 0x0C, 0xF1, 0xA1, 0xAA, 0x9C, 0xF1, 0x3B, 0xBB, 0xAD, 0xDC,
+    0x8D, 0x47, 0x8D, 0x8C, 0x27, 0x58, 0xDD, 0x22, 0x3A, 0x5B, 0xF9, 0xA7, 0xA4, 0xFA, 0x94, 0xD8,
+    0xD1, 0x1F, 0x16, 0xF6, 0x8D, 0x1C, 0x0F, 0x4A, 0x99, 0xA8, 0x77, 0xC2, 0x20, 0x4E, 0x8B, 0xB2,
+    0x1A, 0x63, 0x49, 0x0E, 0x32, 0xB7, 0x05, 0xD4, 0x4C, 0x5B, 0x4D, 0x7A, 0x9A, 0xEA, 0x70, 0x3D,
+    0x2F, 0x82, 0x43, 0x4E, 0x82, 0xA5, 0x25, 0x5C, 0x06, 0x6B, 0xEE, 0x93, 0xEF, 0x9C, 0xB2, 0x8E,
+    0xD7, 0xEF, 0x39, 0xA4, 0x75, 0x0A, 0xFE, 0x7C, 0x87, 0x09, 0xAD, 0x23, 0x79, 0x55, 0xE4, 0x01,
+    0x76, 0x3F, 0x66, 0x3F, 0xC6, 0xD3, 0x3F, 0xAF, 0x86, 0xDD, 0x8F, 0xDD, 0x17, 0xCA, 0xF8, 0xC1,
+    0xD3, 0x2D, 0x6D, 0x85, 0x0A, 0xF7, 0x51, 0x73, 0x72, 0x46, 0xBE, 0xA5, 0x81, 0x78, 0x55, 0x5E,
+    0x06, 0xF6, 0xBC, 0xAB, 0x3D, 0xFB, 0x57, 0x96, 0xF1, 0x97, 0x43, 0x19, 0xBF, 0x94, 0x9D, 0x1F,
+    0x65, 0xE6, 0x4F, 0x40, 0xF0, 0x53, 0x89, 0x29, 0xB6, 0xF0, 0xF0, 0x67, 0x12, 0xBA, 0x96, 0x7A,
+    0xE1, 0x4F, 0x24, 0x06, 0x3F, 0xFD, 0x6D, 0xC9, 0xFF, 0x02, 0x9D, 0x55, 0x3D, 0x6C, 0xDB, 0x46,
+    0x14, 0xFE, 0x4E, 0xB4, 0xCC, 0x58, 0x57, 0xFB, 0x04, 0x54, 0xEE, 0x4F, 0xE2, 0x98, 0x1D, 0x3C,
+    0x04, 0x86, 0x23, 0x7A, 0x10, 0x0A, 0x0D, 0x92, 0x78, 0x69, 0xF7, 0x42, 0x40, 0xEC, 0xB9, 0x05,
+    0x1A, 0x20, 0x68, 0x3A, 0x44, 0x83, 0x07, 0x0D, 0xB6, 0xC9, 0xA2, 0x7B, 0xE1, 0xA1, 0xE8, 0xD2,
+    0xC5, 0x83, 0x87, 0x54, 0x19, 0xEC, 0x16, 0x19, 0x3C, 0xD8, 0xD2, 0x15, 0x69, 0x87, 0x6E, 0x1C,
+    0x0A, 0x74, 0xE5, 0x56, 0x34, 0x1D, 0xC2, 0x02, 0x0C, 0x20, 0xB7, 0x94, 0xAE, 0xEF, 0x48, 0x33,
+    0x89, 0x93, 0x14, 0x01, 0x7A, 0x8F, 0x7F, 0x47, 0xBE, 0xBB, 0x7B, 0xF7, 0x7D, 0xDF, 0x7B, 0x5C,
+    0x85, 0x17, 0x08, 0x65, 0xC5, 0x18, 0xA3, 0xC5, 0x0E, 0xAC, 0x44, 0x84, 0x6E, 0xD0, 0xC1, 0x03,
+    0xE0, 0x33, 0x40, 0xC3, 0xD2, 0x4A, 0xFC, 0x16, 0xBB, 0x48, 0xFB, 0xB8, 0xCE, 0x24, 0x93, 0x22,
+    0xB5, 0x02, 0x57, 0x3F, 0x96, 0x2D, 0x47, 0xA3, 0xC1, 0xEE, 0x61, 0x30, 0xD8, 0xD7, 0x3A, 0x1E,
+    0xE9, 0x18, 0xD4, 0x34, 0x3D, 0x9A, 0x73, 0x73, 0x73, 0xB3, 0xBB, 0x82, 0x77, 0x5A, 0x68, 0xB9,
+    0x83, 0xB1, 0xD0, 0x11, 0x1B, 0xCA, 0xDA, 0x70, 0xB8, 0x83, 0x2A, 0xE4, 0x89, 0x1D, 0x9E, 0xDA,
+    0xD1, 0xB6, 0xA5, 0x16, 0xE1, 0x47, 0x6F, 0x25, 0x38, 0x46, 0xC2, 0x63, 0x21, 0x05, 0xCA, 0x34,
+    0xDE, 0x49, 0x3A, 0x3B, 0x0F, 0x96, 0x8F, 0x16, 0xFA, 0x75, 0x2F, 0xE5, 0x11, 0x0E, 0x2E, 0x4B,
+    0x2B, 0xF1, 0xA4, 0x1D, 0x0D, 0x21, 0xD4, 0x18, 0x6E, 0x29, 0x42, 0xD3, 0x0A, 0x70, 0x0B, 0xEF,
+    0x76, 0x70, 0x22, 0x1E, 0xC6, 0xB6, 0x56, 0x4C, 0x4B, 0x0C, 0x51, 0xDB, 0x31, 0x0D, 0xDD, 0xF2,
+    0xD8, 0x2D, 0x0C, 0x58, 0x2D, 0xED, 0xC3, 0xFB, 0x30, 0xA1, 0xA1, 0x29, 0xAC, 0x68, 0x07, 0x2C,
+    0x76, 0x80, 0xA6, 0x1D, 0x98, 0x40, 0x77, 0x40, 0xA3, 0xE8, 0x58, 0xB9, 0x76, 0x21, 0x48, 0xDC,
+    0x01, 0xD7, 0x91, 0xF3, 0xE7, 0xB8, 0x8D, 0x56, 0x13, 0x6B, 0x25, 0x65, 0x2B, 0xAE, 0x44, 0xE0,
+    0x4A, 0x0F, 0x1E, 0x7C, 0x2C, 0x42, 0x84, 0x42, 0x39, 0xCA, 0x09, 0x5C, 0xEA, 0xB7, 0xB1, 0x8D,
+    0x1A, 0x76, 0xE9, 0xBD, 0x07, 0x57, 0x3A, 0x84, 0x21, 0x57, 0x96, 0x62, 0x92, 0x87, 0x99, 0x57,
+    0x36, 0xAA, 0x83, 0x16, 0xF9, 0xAC, 0x1A, 0x84, 0xC3, 0x0C, 0xE1, 0x35, 0xDC, 0x2B, 0xA5, 0x76,
+    0x2C, 0x94, 0x8B, 0x26, 0xC5, 0xC1, 0x62, 0x16, 0x13, 0x64, 0xB1, 0xB9, 0xA3, 0x0B, 0x24, 0x64,
+    0xA6, 0x6F, 0xEE, 0x5D, 0x2C, 0x6E, 0xCA, 0x91, 0x56, 0x77, 0xEE, 0x2B, 0x58, 0x17, 0x8F, 0x52,
+    0x40, 0xB3, 0x4E, 0x90, 0xB2, 0xD4, 0x4E, 0xFC, 0xD0, 0x27, 0x5C, 0xCB, 0x5E, 0xFF, 0xE8, 0xA8,
+    0xEF, 0x96, 0x99, 0xB4, 0x94, 0xB1, 0xD1, 0xD4, 0x9F, 0x2C, 0x6E, 0x8C, 0xA6, 0x9F, 0xFF, 0x91,
+    0xF7, 0x01, 0x73, 0xBD, 0x7B, 0x36, 0x9A, 0xBE, 0xFD, 0xAB, 0xA5, 0x68, 0xBC, 0xE1, 0x4A, 0xB3,
+    0x6E, 0x29, 0x2E, 0xCC, 0x8A, 0x0F, 0x23, 0xAD, 0x86, 0x72, 0x83, 0xA2, 0x2C, 0x2C, 0xC5, 0x68,
+    0xDF, 0x8F, 0xAF, 0x44, 0xAD, 0xE1, 0xB0, 0xF5, 0x3C, 0x77, 0x2F, 0x32, 0x25, 0x08, 0x24, 0x47,
+    0xD6, 0x69, 0xB3, 0x55, 0x5A, 0xC7, 0x0E, 0x44, 0x82, 0x13, 0x83, 0x8F, 0x3F, 0xF6, 0x42, 0x06,
+    0x41, 0x5F, 0xB6, 0x89, 0xE8, 0x13, 0x9A, 0xCD, 0x8B, 0x99, 0x3C, 0x67, 0x8B, 0x44, 0x42, 0x21,
+    0xFC, 0x3D, 0x38, 0x4C, 0x68, 0xB6, 0xEC, 0xE8, 0xA2, 0xDC, 0x17, 0x2C, 0x6C, 0x09, 0x4B, 0xB9,
+    0x5A, 0x07, 0x76, 0x74, 0xFA, 0x0A, 0xAE, 0x2F, 0xC8, 0x92, 0x8D, 0x49, 0x96, 0x85, 0xD2, 0x92,
+    0x57, 0x92, 0xC8, 0xBA, 0x2C, 0xE0, 0x13, 0x33, 0xE3, 0xE3, 0xA0, 0xC5, 0x35, 0xC1, 0x7E, 0xFC,
+    0x4C, 0xB4, 0xBE, 0xD6, 0x13, 0x73, 0xE2, 0xBC, 0x15, 0x02, 0x2E, 0xFA, 0x83, 0xCC, 0x33, 0x17,
+    0x34, 0x93, 0x25, 0xB8, 0x09, 0x87, 0xAF, 0x0F, 0xF1, 0xC0, 0x4D, 0xB1, 0x4F, 0xFA, 0x7A, 0x51,
+    0xF4, 0x83, 0xAC, 0xE9, 0xAC, 0xE5, 0xCF, 0xC6, 0xA3, 0xA4, 0xE0, 0x44, 0x18, 0x05, 0x3C, 0x85,
+    0x1F, 0x92, 0x62, 0xF0, 0x9E, 0x79, 0xCB, 0x24, 0x91, 0x12, 0x02, 0x9C, 0xE0, 0x14, 0x44, 0x08,
+    0xA9, 0x93, 0xF4, 0x02, 0xC2, 0x0D, 0x04, 0x15, 0x08, 0x7E, 0x92, 0x07, 0xB9, 0xC4, 0x2F, 0xBB,
+    0xB9, 0x2F, 0xBB, 0x95, 0xCE, 0xDD, 0xEC, 0x73, 0x37, 0x21, 0x73, 0x37, 0x33, 0xE3, 0x36, 0x9D,
+    0xDD, 0xB4, 0x2E, 0x44, 0x3D, 0xED, 0x12, 0xC6, 0x4F, 0xF1, 0x9E, 0x0E, 0x46, 0x14, 0x27, 0xC5,
+    0x6D, 0xC2, 0x21, 0x18, 0xC2, 0xDD, 0xC1, 0xFD, 0xB0, 0x8F, 0xD2, 0xD3, 0xD3, 0xBC, 0x5B, 0x1D,
+    0x0C, 0x02, 0xFE, 0x64, 0x0A, 0x77, 0x44, 0xF8, 0x11, 0x33, 0x5B, 0x9C, 0x85, 0xB5, 0x5A, 0x7B,
+    0x9B, 0xA0, 0x88, 0x9C, 0xA4, 0x7D, 0x52, 0x5B, 0x99, 0x55, 0xAE, 0x6A, 0x53, 0x3C, 0x2E, 0x2D,
+    0x6C, 0x12, 0xC6, 0x93, 0xCD, 0xD7, 0x82, 0xF9, 0x5F, 0x29, 0xF1, 0x2A, 0xB6, 0x7C, 0xF8, 0x94,
+    0x88, 0xB6, 0x12, 0x72, 0x8E, 0xF6, 0x15, 0x62, 0xC6, 0x51, 0xF0, 0xDC, 0x8F, 0xA5, 0xE7, 0x39,
+    0x41, 0xBD, 0x2D, 0x60, 0x32, 0xA9, 0x06, 0x13, 0x41, 0x07, 0x5E, 0x24, 0xC2, 0xC5, 0xCD, 0xCD,
+    0x0D, 0x43, 0xEA, 0xEE, 0x60, 0x70, 0x4A, 0x5B, 0x6F, 0x17, 0x67, 0xCD, 0xB8, 0xBD, 0x26, 0xAE,
+    0x8B, 0x25, 0xC4, 0x4B, 0xBD, 0x94, 0x44, 0x9D, 0x1B, 0xF1, 0xC5, 0x6E, 0xFE, 0x18, 0x70, 0xFD,
+    0x65, 0x1E, 0x9D, 0x4B, 0xD1, 0x6D, 0xDF, 0x03, 0xD6, 0xCF, 0xA7, 0xA9, 0x98, 0x02, 0x66, 0x08,
+    0x22, 0xE4, 0xA9, 0x98, 0xD9, 0x63, 0x4B, 0x39, 0xFA, 0xDB, 0xA0, 0xED, 0x68, 0xD9, 0x2A, 0x4D,
+    0x90, 0x17, 0x38, 0xC3, 0x4A, 0x90, 0xF9, 0xCE, 0x06, 0x73, 0xEE, 0xF8, 0x7A, 0x67, 0x94, 0x6E,
+    0xF1, 0x84, 0xBE, 0x88, 0x68, 0xD9, 0x9B, 0xEE, 0xF4, 0xFD, 0xB4, 0x37, 0x1B, 0x51, 0xD7, 0xBE,
+    0x11, 0xBA, 0x7A, 0xEC, 0xEB, 0x89, 0xB8, 0x11, 0x97, 0x6E, 0x64, 0x35, 0x8B, 0xB2, 0x9E, 0x47,
+    0xEE, 0x38, 0xCF, 0x67, 0xCA, 0x70, 0x45, 0xCF, 0x53, 0x1D, 0xBA, 0x63, 0x3B, 0xDF, 0x8A, 0x28,
+    0xAE, 0x37, 0x7F, 0x86, 0xE8, 0xE2, 0x87, 0xAF, 0x68, 0xC5, 0x05, 0xE0, 0x08, 0x20, 0xD8, 0x3E,
+    0xC9, 0x44, 0x37, 0x87, 0x6E, 0x0F, 0x58, 0x28, 0x9F, 0x7B, 0xEE, 0x91, 0x64, 0x44, 0x6C, 0x44,
+    0x73, 0x3E, 0x76, 0xDF, 0x7C, 0xAD, 0x80, 0xAE, 0xF3, 0xC5, 0xA8, 0x7C, 0x06, 0x7C, 0xFF, 0x11,
+    0x10, 0xE3, 0xD3, 0x5F, 0x9E, 0xAD, 0x62, 0xAE, 0xDA, 0xC4, 0xA0, 0xF3, 0x18, 0x4C, 0xF1, 0xF2,
+    0x29, 0x42, 0x1E, 0xF9, 0x41, 0x92, 0xC5, 0xEB, 0x10, 0x1F, 0x5B, 0xF4, 0x23, 0xE9, 0x53, 0x81,
+    0xE4, 0x28, 0xE9, 0x40, 0xE8, 0xD8, 0xFD, 0x66, 0x4C, 0x58, 0xD6, 0x5A, 0xB5, 0xBC, 0xFE, 0xE2,
+    0x1A, 0x2E, 0xBD, 0xD7, 0x49, 0x45, 0x22, 0x62, 0x6F, 0x7C, 0xD5, 0xC8, 0xA6, 0x6B, 0xD3, 0x78,
+    0xAA, 0x3B, 0x92, 0xEA, 0xFF, 0xBE, 0xC4, 0x19, 0xBC, 0xD0, 0x8E, 0x1C, 0xFA, 0x03, 0xEC, 0x67,
+    0x59, 0xD3, 0x21, 0x73, 0xA2, 0x11, 0x4A, 0x89, 0x06, 0x7F, 0xF2, 0x7B, 0xE0, 0x7D, 0xF0, 0x50,
+    0x35, 0xAC, 0x2F, 0x68, 0x0F, 0xC7, 0x94, 0x58, 0x82, 0xD6, 0x11, 0x54, 0xDC, 0x6F, 0xA1, 0xB6,
+    0x3B, 0xDA, 0x21, 0xC0, 0xDE, 0xFC, 0xC9, 0x4B, 0xFD, 0x09, 0x8F, 0xEA, 0xC7, 0x97, 0xB2, 0x9C,
+    0x33, 0x42, 0xF6, 0x46, 0x8F, 0x55, 0x5F, 0x94, 0xD4, 0x16, 0x95, 0x1A, 0x73, 0x37, 0x7D, 0x1E,
+    0x4F, 0x61, 0xF6, 0xBA, 0x94, 0x53, 0xDE, 0x34, 0x10, 0xDC, 0xCA, 0x92, 0x74, 0xCF, 0xE4, 0x19,
+    0x65, 0x95, 0x61, 0x8D, 0xCA, 0x3C, 0x3F, 0x23, 0xE6, 0x26, 0x60, 0x5A, 0x1F, 0x6A, 0xDA, 0xE5,
+    0x15, 0xAD, 0xA7, 0x44, 0x29, 0x2E, 0x0F, 0xE4, 0xFF, 0x18, 0xF0, 0xAC, 0x58, 0x14, 0x3A, 0x7C,
+    0xBE, 0x8B, 0x4D, 0xE3, 0xD8, 0xE5, 0x5A, 0xEF, 0x81, 0x45, 0xDE, 0x3F, 0x5A, 0x3F, 0x3A, 0x54,
+    0x7D, 0x30, 0xCA, 0x59, 0x49, 0x95, 0x87, 0xDD, 0x39, 0x28, 0x04, 0x8C, 0x59, 0xAD, 0xCF, 0xF2,
+    0x14, 0xD6, 0x21, 0x95, 0xC6, 0xAF, 0xD9, 0xDD, 0x94, 0x04, 0x45, 0x6F, 0x46, 0x04, 0xBD, 0x21,
+    0x4A, 0x99, 0x4A, 0x41, 0x7F, 0x41, 0x3C, 0xD7, 0x66, 0xF2, 0x1B, 0x97, 0x5E, 0xB6, 0x66, 0x94,
+    0xDF, 0xF2, 0xAC, 0xE0, 0xB9, 0xE2, 0xE6, 0x0A, 0x5F, 0x9E, 0xCC, 0x2C, 0x61, 0x9E, 0x4F, 0x9A,
+    0xF3, 0xEB, 0xF3, 0xED, 0xD3, 0xB2, 0xB4, 0x93, 0xA5, 0xAB, 0x8D, 0x8A, 0xA7, 0x1B, 0x44, 0xA0,
+    0xF8, 0x8E, 0x6D, 0x54, 0x7B, 0xE8, 0xE5, 0xAD, 0x4A, 0x6A, 0x5E, 0xBB, 0x8A, 0x75, 0x8E, 0x9E,
+    0x6D, 0x8E, 0x46, 0x05, 0xCB, 0x27, 0x94, 0xD6, 0x58, 0xAF, 0x14, 0xD6, 0x58, 0xA8, 0x0F, 0xCB,
+    0x92, 0xC7, 0x2D, 0x33, 0x8A, 0xAC, 0x81, 0xE5, 0x03, 0x72, 0xA8, 0x18, 0xE3, 0x8F, 0x9A, 0xCB,
+    0xBD, 0x85, 0x5E, 0xA5, 0x97, 0x79, 0x31, 0xB9, 0x4E, 0x5F, 0x1B, 0x78, 0x7F, 0xDC, 0x5A, 0x68,
+    0xF0, 0xC2, 0xAA, 0xEC, 0xF6, 0x5F, 0x13, 0xF4, 0xEB, 0xB4, 0xC4, 0x92, 0xF5, 0xD2, 0x59, 0x9D,
+    0x61, 0xB8, 0xAD, 0x4E, 0x49, 0xB5, 0x85, 0x55, 0x61, 0xF4, 0xEC, 0x46, 0xF3, 0x28, 0x8C, 0xEF,
+    0xB1, 0xEE, 0x3A, 0xC5, 0x46, 0x84, 0xBF, 0x81, 0xF9, 0x35, 0x54, 0x1A, 0xB0, 0x7A, 0x59, 0xF9,
+    0x94, 0x58, 0x99, 0x33, 0x6F, 0xEC, 0x1E, 0x95, 0x3F, 0x03, 0xD8, 0x02, 0xFD, 0x42, 0xE6, 0x51,
+    0x65, 0xF8, 0x17, 0xE5, 0x7D, 0x4F, 0x8C, 0xE4, 0xD6, 0x99, 0xDF, 0x23, 0xE9, 0x19, 0xAE, 0x4D,
+    0xC4, 0xF4, 0x61, 0xE4, 0x38, 0x1A, 0x44, 0xDC, 0x4B, 0x00, 0xAF, 0x76, 0x35, 0xBC, 0xC6, 0x80,
+    0xA7, 0x48, 0xED, 0x02, 0xD9, 0xA3, 0x3B, 0xC0, 0x94, 0x06, 0xF1, 0x1C, 0x46, 0x87, 0x3D, 0xC4,
+    0x76, 0xE2, 0xBE, 0xEC, 0xC1, 0x08, 0xD4, 0x4D, 0x7A, 0x0D, 0x64, 0x0F, 0x39, 0xEC, 0x1C, 0x34,
+    0xD9, 0x20, 0x39, 0x58, 0x07, 0xD9, 0x90, 0x6B, 0x0E, 0x9D, 0x83, 0x0F, 0x5A, 0xA0, 0xAB, 0x49,
+    0xDB, 0x87, 0x3D, 0xEC, 0x41, 0x04, 0x6C, 0x21, 0x07, 0x1F, 0xB6, 0x76, 0xAD, 0x81, 0xB3, 0xCA,
+    0x41, 0xF4, 0xAA, 0x04, 0x57, 0xB7, 0xC8, 0x62, 0xBE, 0xDF, 0xEF, 0x7B, 0x64, 0x55, 0xF5, 0xBF,
+    0xE9, 0x19, 0xCD, 0x68, 0x66, 0x93, 0x9E, 0xE2, 0xF7, 0x6A, 0xAA, 0xC8, 0xC7, 0xF7, 0x3E, 0xBE,
+    0xF7, 0xFD, 0xFF, 0xBE, 0x72, 0xDF, 0x34, 0xC6, 0x6D, 0x8C, 0x31, 0x07, 0x72, 0xC4, 0xA9, 0x31,
+    0x41, 0x29, 0x1F, 0x54, 0xA6, 0xFF, 0x2B, 0xBA, 0xAE, 0xEA, 0xBA, 0x6E, 0x26, 0x47, 0x85, 0xD3,
+    0xCE, 0x3A, 0xBA, 0xC9, 0x24, 0x97, 0x73, 0x4A, 0x1C, 0xE7, 0x9D, 0x87, 0x63, 0x39, 0x99, 0xDC,
+    0xB1, 0x7D, 0xCE, 0x9C, 0xFC, 0x8A, 0xF1, 0xEA, 0x1D, 0x39, 0x0E, 0x8C, 0x37, 0xDB, 0x31, 0xEB,
+    0x7F, 0x4F, 0xFA, 0xDE, 0x05, 0x2E, 0xC0, 0x5D, 0xBA, 0xCA, 0xE8, 0x7B, 0x13, 0x96, 0xB8, 0xF1,
+    0x03, 0xE0, 0x4F, 0xC6, 0x82, 0xA7, 0xB0, 0xEB, 0x16, 0x84, 0x9D, 0xC0, 0x8F, 0x4C, 0x51, 0xE2,
+    0xDB, 0x70, 0x06, 0xE8, 0xD7, 0x80, 0xDE, 0x19, 0x50, 0xBF, 0x0D, 0x2B, 0x81, 0xE3, 0x0C, 0x57,
+    0xB1, 0x87, 0x12, 0xBD, 0x19, 0xF3, 0x9C, 0xF4, 0x6C, 0xBE, 0x61, 0x8C, 0x23, 0x63, 0xF5, 0xE6,
+    0xF2, 0x34, 0xE4, 0x49, 0x44, 0xF2, 0xD9, 0x4B, 0x1B, 0x58, 0x29, 0x2F, 0x3A, 0xDB, 0x47, 0x39,
+    0xF4, 0xEF, 0x72, 0xB7, 0x4C, 0x4D, 0xD2, 0x75, 0xB5, 0xD3, 0xBD, 0xBF, 0x57, 0xF9, 0xAD, 0x71,
+    0xF2, 0xB0, 0xC6, 0x12, 0x01, 0x0A, 0x12, 0x8C, 0x32, 0x33, 0x76, 0xD5, 0x98, 0xD6, 0x28, 0x62,
+    0xDF, 0x34, 0x32, 0xA6, 0x46, 0x41, 0x3B, 0x7C, 0xC1, 0x53, 0x0A, 0x80, 0x84, 0x00, 0x1D, 0x44,
+    0x33, 0x01, 0x01, 0x66, 0xEC, 0x75, 0x77, 0x6F, 0x11, 0xFB, 0x95, 0x09, 0xBA, 0x2E, 0x37, 0xE6,
+    0x52, 0xAA, 0x03, 0xD8, 0xEE, 0xEE, 0x78, 0xD2, 0x51, 0xB8, 0xBC, 0xB7, 0x88, 0x4A, 0x73, 0x05,
+    0xB7, 0x4C, 0x6C, 0x1F, 0x78, 0x8F, 0x71, 0x84, 0x82, 0x20, 0x1F, 0xD7, 0x74, 0x87, 0xD2, 0x25,
+    0xDE, 0x14, 0x32, 0x44, 0xBF, 0xB1, 0x77, 0xC6, 0x8D, 0x77, 0xED, 0x31, 0xFD, 0x82, 0xA0, 0x34,
+    0xBB, 0x7B, 0x7B, 0x9E, 0xC9, 0x9D, 0xA2, 0x6E, 0x49, 0x4C, 0xEF, 0x37, 0xA7, 0xFF, 0xC9, 0xF9,
+    0xD7, 0x22, 0x93, 0xC4, 0xA9, 0xBC, 0xFE, 0xC5, 0xE7, 0x2C, 0x42, 0xDC, 0x1A, 0xCF, 0xEF, 0x93,
+    0xBF, 0xB0, 0xC1, 0xC2, 0xC7, 0xF7, 0x8A, 0xF3, 0x71, 0x61, 0x8A, 0xA5, 0x29, 0xE6, 0xE6, 0x92,
+    0xE1, 0x7A, 0x5C, 0x62, 0xB4, 0xD1, 0xF1, 0x36, 0x25, 0x1A, 0xCE, 0x6C, 0xE3, 0xBE, 0x35, 0x43,
+    0x9B, 0x4D, 0xB6, 0xB4, 0xED, 0xBA, 0x14, 0x68, 0x97, 0xB6, 0x46, 0xBB, 0x6B, 0xAE, 0x36, 0xDA,
+    0x0A, 0x96, 0xB5, 0x3D, 0xB0, 0x6D, 0x66, 0x46, 0x6C, 0x93, 0xA1, 0xDD, 0xB1, 0x9F, 0xEF, 0xDB,
+    0xF3, 0x1B, 0xB4, 0x5E, 0x73, 0x6F, 0x81, 0xFE, 0x8B, 0xB9, 0xF4, 0x88, 0x7E, 0x4B, 0x79, 0xFA,
+    0xD2, 0x1E, 0x9A, 0x2B, 0x16, 0xD9, 0xFB, 0x4A, 0x87, 0x70, 0x7A, 0xF8, 0x49, 0x5A, 0x59, 0x06,
+    0x21, 0x68, 0x59, 0xC7, 0xBF, 0x3B, 0xB6, 0x6D, 0xCC, 0x72, 0x3C, 0xBE, 0x7D, 0xFF, 0xEB, 0x9D,
+    0x3D, 0x2F, 0x29, 0xB5, 0x0D, 0x6D, 0x1B, 0x54, 0xB6, 0x9D, 0x6D, 0xFE, 0x3F, 0xB4, 0x6D, 0x64,
+    0xCF, 0xCB, 0x72, 0xB4, 0xEF, 0xDF, 0xD3, 0x7E, 0x40, 0x0F, 0xD8, 0xCA, 0xC6, 0xF9, 0xA4, 0x94,
+    0x45, 0xFB, 0x13, 0xBC, 0x0B, 0x65, 0xC9, 0xCA, 0x81, 0x5E, 0x3C, 0x80, 0xB2, 0x9C, 0x03, 0xCD,
+    0xF3, 0xDC, 0xB2, 0xA9, 0xDD, 0x1A, 0xEE, 0x1C, 0x5B, 0x0F, 0x98, 0x09, 0xD2, 0x75, 0x8A, 0xBB,
+    0x8F, 0x95, 0xD0, 0xE0, 0x81, 0x35, 0xFA, 0xB4, 0x5C, 0xCC, 0x49, 0xEE, 0xDA, 0xA0, 0x9F, 0x46,
+    0x56, 0x9B, 0x80, 0x0C, 0xF8, 0x95, 0xEF, 0x1B, 0x10, 0x28, 0x2C, 0x0A, 0x83, 0x69, 0xEA, 0xBB,
+    0xC6, 0x5B, 0xE0, 0xDB, 0x16, 0xA0, 0x00, 0x48, 0x70, 0x45, 0x84, 0x6B, 0x03, 0xF4, 0xE2, 0xA1,
+    0x3F, 0x87, 0x97, 0x17, 0x00, 0x09, 0x50, 0x28, 0x5F, 0x3F, 0x9F, 0x63, 0xFA, 0xA0, 0x0A, 0xE8,
+    0xD4, 0x12, 0xA2, 0x11, 0x71, 0x72, 0x6C, 0x7C, 0x0E, 0xF6, 0xA7, 0x07, 0x10, 0x00, 0x44, 0x00,
+    0x09, 0xC0, 0x54, 0x80, 0xB3, 0x10, 0xE0, 0xD5, 0x02, 0xE4, 0x99, 0xC9, 0x98, 0xF3, 0x06, 0x4B,
+    0x55, 0xC0, 0x0E, 0x80, 0xFC, 0x6B, 0x04, 0x17, 0x4D, 0xE3, 0xCF, 0x04, 0x60, 0x42, 0x8D, 0xAC,
+    0xEF, 0xA6, 0xD9, 0x05, 0xC0, 0x84, 0x96, 0x72, 0xEF, 0xA6, 0x9B, 0x01, 0x94, 0x00, 0x29, 0xC0,
+    0x1A, 0x59, 0x8C, 0xD2, 0x84, 0xCF, 0x0A, 0x5B, 0xC4, 0xC7, 0x43, 0x32, 0x0E, 0xCE, 0x5E, 0xFF,
+    0x53, 0x36, 0xAA, 0x94, 0x4A, 0xB0, 0x25, 0xFF, 0xC7, 0xA3, 0x95, 0xF1, 0xCC, 0x80, 0x4B, 0x25,
+    0x01, 0xF2, 0xC6, 0xC7, 0x4D, 0xB8, 0x36, 0x0F, 0x30, 0x7D, 0x9C, 0x0C, 0xA2, 0x96, 0x6B, 0xFF,
+    0x53, 0x3C, 0x18, 0x2C, 0x3E, 0xE3, 0xFD, 0x06, 0x44, 0xD2, 0xFD, 0x18, 0xA4, 0xD7, 0xE8, 0xBD,
+    0x8A, 0x6A, 0x20, 0xA3, 0x4A, 0x88, 0x95, 0xB8, 0x3A, 0x7C, 0xAE, 0x7B, 0x0B, 0x0E, 0x6D, 0x46,
+    0xC8, 0x2F, 0xB7, 0x2C, 0xDE, 0xDC, 0x1A, 0x78, 0x7B, 0xD2, 0x40, 0xB8, 0xC0, 0xBD, 0x1A, 0x7B,
+    0x4C, 0x81, 0x3C, 0x10, 0x0C, 0xED, 0x14, 0xA0, 0xE3, 0x22, 0x47, 0xC0, 0x1A, 0xC1, 0x2C, 0x38,
+    0x23, 0xAC, 0x24, 0xE3, 0xFC, 0x96, 0x2B, 0xE1, 0x1F, 0x31, 0x6B, 0xEF, 0xEF, 0xB0, 0x20, 0xB8,
+    0x05, 0x2D, 0x66, 0xA2, 0x7C, 0x97, 0x14, 0xCA, 0x22, 0x59, 0x66, 0x39, 0xB5, 0x48, 0x16, 0xE8,
+    0x80, 0xB1, 0x1B, 0x97, 0x37, 0xF7, 0x8E, 0x26, 0xF7, 0xE6, 0x40, 0xB5, 0xDC, 0x51, 0x4F, 0x00,
+    0xAA, 0x0F, 0x78, 0x49, 0x62, 0x39, 0xC9, 0x2E, 0x3B, 0xD4, 0xCE, 0x65, 0xA7, 0xCE, 0x3B, 0x7B,
+    0x9C, 0x29, 0x3F, 0xC8, 0x0E, 0x15, 0x9A, 0x9A, 0xE2, 0x36, 0xAD, 0xB9, 0xBD, 0x68, 0x45, 0x7A,
+    0x12, 0xCC, 0x2F, 0xE5, 0xD8, 0x95, 0x23, 0xC3, 0x21, 0x83, 0x3C, 0x90, 0xA3, 0x9D, 0x0A, 0x2F,
+    0x3A, 0x98, 0x14, 0x35, 0x38, 0x76, 0x21, 0xD4, 0xA1, 0xE8, 0xFE, 0x81, 0xA4, 0x68, 0xA6, 0x2C,
+    0x52, 0x76, 0xD7, 0x72, 0xB5, 0x11, 0x36, 0xC1, 0x81, 0x6E, 0x93, 0x6E, 0x52, 0xF0, 0x64, 0xDC,
+    0xB3, 0x9B, 0xE3, 0x33, 0x5E, 0x91, 0x60, 0x8F, 0xC6, 0xBA, 0x75, 0x7A, 0x10, 0x97, 0xFD, 0x76,
+    0xEA, 0x84, 0x17, 0xEF, 0xB5, 0x7A, 0x45, 0x67, 0xA9, 0xD1, 0x93, 0x95, 0x18, 0xFC, 0x0E, 0xAC,
+    0xDB, 0x27, 0xA1, 0x0B, 0x14, 0x92, 0x68, 0x9D, 0x05, 0xCF, 0x7C, 0xE5, 0x2B, 0x28, 0x9C, 0x09,
+    0xEC, 0x8D, 0x30, 0x31, 0x2B, 0x38, 0x35, 0x4A, 0x8A, 0x04, 0x82, 0xD6, 0x84, 0xE5, 0xB7, 0x8E,
+    0x26, 0x93, 0xBD, 0xF7, 0x0B, 0x52, 0x76, 0x85, 0xFB, 0x5C, 0x54, 0x67, 0x41, 0xF2, 0x98, 0x4B,
+    0x4F, 0x5A, 0xB6, 0x4C, 0x8C, 0xCE, 0x20, 0xCA, 0x65, 0x79, 0xC9, 0xB3, 0x92, 0xAD, 0x2E, 0x6D,
+    0x86, 0xED, 0x1F, 0x81, 0x24, 0xCA, 0x92, 0x8C, 0x72, 0x21, 0x04, 0x42, 0x2A, 0xA3, 0x5C, 0x08,
+    0xAC, 0xCC, 0x2E, 0xCA, 0xB1, 0x48, 0xA3, 0x3C, 0xCA, 0x41, 0x38, 0xC2, 0x2A, 0xCA, 0x21, 0x62,
+    0x79, 0xB5, 0x2E, 0x4F, 0x2C, 0x6C, 0x6E, 0x1C, 0x2E, 0x6D, 0xC3, 0x25, 0xBE, 0xB0, 0xDF, 0x63,
+    0xEB, 0xF7, 0xE7, 0xC7, 0x72, 0x4B, 0x6C, 0xA8, 0xBE, 0xBF, 0xA5, 0xB4, 0x42, 0x7A, 0x65, 0x31,
+    0x45, 0xB9, 0x20, 0x4C, 0xC8, 0x2B, 0xEF, 0x2F, 0xF4, 0x48, 0xDA, 0x02, 0x3B, 0x42, 0xDA, 0x24,
+    0x15, 0x4A, 0x82, 0xA1, 0x96, 0x05, 0x46, 0x80, 0x6F, 0xF1, 0x17, 0x40, 0x78, 0xC8, 0xB0, 0x60,
+    0x93, 0x1F, 0x08, 0x65, 0x11, 0x49, 0xBD, 0xD9, 0x14, 0xEB, 0xA6, 0xFD, 0x7F, 0x21, 0xAF, 0x82,
+    0x4F, 0x38, 0x13, 0x79, 0xF8, 0x6E, 0xD7, 0x72, 0x7C, 0xA4, 0x42, 0xBC, 0x62, 0xB9, 0x12, 0xFF,
+    0xD2, 0x01, 0x18, 0x0A, 0x91, 0x29, 0xD6, 0xF4, 0xC1, 0x78, 0xBB, 0xC1, 0x32, 0x9D, 0x89, 0xD8,
+    0x27, 0x0B, 0xD6, 0x3C, 0xF7, 0xD4, 0x69, 0xFD, 0x0E, 0xF7, 0x19, 0xF8, 0x64, 0x0C, 0x74, 0x53,
+    0xCC, 0x7C, 0xEA, 0x6C, 0xE8, 0xA9, 0xB1, 0x67, 0x55, 0x73, 0xA2, 0x75, 0x48, 0x99, 0xF0, 0x24,
+    0x8C, 0x15, 0x9A, 0xE3, 0xF0, 0xFC, 0xD7, 0x68, 0x0D, 0xEE, 0x10, 0xEE, 0x13, 0x92, 0x1C, 0x42,
+    0x58, 0x4C, 0x4C, 0xC7, 0x3D, 0x82, 0x99, 0x24, 0x56, 0x4C, 0x2C, 0x72, 0xEE, 0x8A, 0x12, 0x4A,
+    0x04, 0xB0, 0xE5, 0x73, 0x8A, 0xB2, 0x66, 0x65, 0xDE, 0x61, 0xD1, 0xC8, 0x55, 0x11, 0x9F, 0x48,
+    0x92, 0x34, 0xD2, 0xE7, 0xF5, 0xA4, 0x41, 0xB7, 0x09, 0x70, 0xBD, 0x48, 0x9A, 0x28, 0x77, 0xE6,
+    0x89, 0x20, 0xDF, 0xAD, 0x93, 0x26, 0xA8, 0xBC, 0x59, 0xD2, 0x78, 0xB3, 0xA0, 0x14, 0x58, 0x87,
+    0x02, 0x9D, 0xB9, 0xB0, 0x7A, 0x41, 0x83, 0x30, 0x99, 0xC6, 0xEC, 0x8F, 0x00, 0x77, 0x77, 0x00,
+    0xF5, 0x15, 0x2F, 0x00, 0x45, 0x1F, 0x1A, 0xA0, 0x5F, 0x91, 0xBC, 0x38, 0xE0, 0x1B, 0xF2, 0xF4,
+    0x2F, 0x08, 0x84, 0xB8, 0xDC, 0x5B, 0x80, 0x62, 0x29, 0x78, 0xA8, 0x6B, 0x57, 0xC0, 0x2E, 0x4A,
+    0x9F, 0xE4, 0x20, 0x03, 0x25, 0x76, 0xBB, 0x1F, 0x88, 0x26, 0xE4, 0x2F, 0xB0, 0xFB, 0x20, 0x63,
+    0x2C, 0x29, 0x8A, 0x64, 0xCA, 0xF2, 0x48, 0x25, 0xA2, 0xF2, 0x80, 0x2C, 0x8F, 0x94, 0x83, 0x84,
+    0x2D, 0xAC, 0x4E, 0x42, 0xFD, 0x56, 0xCF, 0xD4, 0xAB, 0xD0, 0x43, 0x6C, 0xE9, 0x8B, 0xF6, 0x1C,
+    0xCC, 0x41, 0x15, 0xDC, 0xEE, 0xEE, 0x76, 0xAD, 0xBA, 0x29, 0x1E, 0xC1, 0x21, 0x75, 0x59, 0x55,
+    0x56, 0xBB, 0x35, 0x79, 0xE0, 0xD3, 0x10, 0x41, 0x08, 0x8A, 0x8E, 0xCA, 0x68, 0xAE, 0x37, 0x0D,
+    0x04, 0x51, 0x2E, 0x96, 0x42, 0xCB, 0x0D, 0xAA, 0x07, 0xDE, 0x37, 0xFA, 0x79, 0x84, 0xD1, 0x55,
+    0x50, 0x95, 0xBA, 0xC9, 0x9D, 0x87, 0x50, 0x92, 0xDD, 0x87, 0x55, 0x92, 0xDB, 0x41, 0xB6, 0x5D,
+    0x81, 0x47, 0x54, 0x92, 0x89, 0xD9, 0x15, 0x38, 0xD1, 0xED, 0x93, 0x02, 0xCF, 0xA6, 0x80, 0x3B,
+    0xFC, 0x79, 0xF5, 0xC9, 0xE6, 0x72, 0xD7, 0x6F, 0x0D, 0xEE, 0x8D, 0xBF, 0xFC, 0x48, 0x36, 0x47,
+    0x30, 0xF7, 0x6A, 0x1F, 0xA4, 0x4F, 0x4E, 0xC1, 0xF6, 0x90, 0x06, 0xFB, 0xC3, 0xAB, 0x29, 0x19,
+    0x4A, 0x13, 0xA7, 0xD9, 0x46, 0x93, 0xAC, 0x35, 0x49, 0x7F, 0x41, 0x54, 0xF1, 0x72, 0xDB, 0x99,
+    0xED, 0xDA, 0xDE, 0xA8, 0xBF, 0xED, 0xA9, 0x43, 0x32, 0xCE, 0x96, 0x3E, 0x6B, 0xA1, 0x34, 0x50,
+    0xD0, 0x04, 0x51, 0x41, 0x45, 0xD9, 0x40, 0x70, 0x97, 0x60, 0x51, 0x08, 0x8A, 0x32, 0x70, 0xD5,
+    0xF8, 0x7B, 0x72, 0x41, 0xF8, 0x37, 0x15, 0xE6, 0x0B, 0xD3, 0x5C, 0xD7, 0xF3, 0x53, 0xBE, 0xF3,
+    0x70, 0x23, 0x7E, 0x1B, 0xE1, 0xBC, 0x04, 0x12, 0xC5, 0x54, 0xAE, 0x16, 0xAA, 0xA0, 0xE3, 0xCE,
+    0x03, 0x98, 0xA4, 0xA8, 0x3A, 0x0A, 0x2E, 0xBD, 0xF9, 0x01, 0x58, 0x17, 0xD5, 0x01, 0xC3, 0x8D,
+    0xF2, 0x14, 0x20, 0x74, 0x84, 0xA3, 0x9C, 0x92, 0x5A, 0xA5, 0x90, 0xB2, 0xC6, 0xB9, 0xD0, 0x49,
+    0x77, 0x60, 0x12, 0x98, 0xDA, 0xC5, 0x73, 0x0E, 0xD8, 0x1D, 0x00, 0xE5, 0xC5, 0x04, 0xEA, 0x7A,
+    0xB4, 0xBC, 0xD7, 0x95, 0x2A, 0x9E, 0x16, 0xCB, 0xAF, 0x95, 0xBD, 0xBE, 0x7D, 0x21, 0xB0, 0x4F,
+    0xBE, 0x14, 0xAB, 0xE5, 0x42, 0x25, 0xEF, 0x67, 0xB2, 0x15, 0x5E, 0x22, 0xAF, 0x22, 0x55, 0x13,
+    0x47, 0x37, 0xB4, 0xFB, 0x46, 0x8D, 0x30, 0x0D, 0xA5, 0xB5, 0x67, 0xB7, 0x5D, 0x72, 0xFC, 0xDD,
+    0x5B, 0x76, 0xDC, 0x4D, 0xDF, 0xDA, 0x7D, 0x7D, 0xD1, 0x76, 0xAB, 0xA0, 0xA4, 0x56, 0x60, 0xAF,
+    0x58, 0x78, 0x31, 0xD3, 0xCB, 0xFB, 0xAF, 0xAB, 0xF9, 0x6C, 0x36, 0x18, 0x60, 0xCA, 0xCB, 0x9D,
+    0xEA, 0x1D, 0xAA, 0x8F, 0x3C, 0xC0, 0x0C, 0x07, 0x58, 0xA0, 0x9F, 0xBD, 0x96, 0x3D, 0xCC, 0xAD,
+    0x29, 0x68, 0xDF, 0x58, 0xDD, 0x5B, 0x59, 0xD3, 0x05, 0xE1, 0x72, 0xB2, 0x25, 0x10, 0x1C, 0xC9,
+    0x23, 0x6F, 0xF2, 0x6A, 0xD1, 0x13, 0xE6, 0xF8, 0xD6, 0x6D, 0x78, 0x8E, 0xC2, 0xE9, 0x09, 0xD8,
+    0x02, 0x3A, 0xFC, 0xD6, 0x5F, 0xA0, 0x9F, 0xA2, 0x66, 0x0F, 0x39, 0xE0, 0x7B, 0xD2, 0xDB, 0xBE,
+    0x15, 0xDB, 0xCF, 0x3B, 0x0E, 0xE4, 0xEE, 0x85, 0x0C, 0x1E, 0x12, 0xF9, 0x54, 0xEE, 0x3B, 0x95,
+    0xBB, 0xAA, 0x42, 0x6B, 0xA6, 0x56, 0xB9, 0x9D, 0xEA, 0xFF, 0x1D, 0xF9, 0xDC, 0x5F, 0x58, 0x25,
+    0x37, 0x2F, 0xE4, 0x0E, 0xBD, 0xF5, 0xB8, 0x57, 0x1C, 0xEE, 0xEF, 0x35, 0x22, 0xAF, 0x29, 0xD9,
+    0xCA, 0xF0, 0x68, 0x22, 0x9A, 0x9D, 0x66, 0xAA, 0x2F, 0x58, 0x7B, 0x8F, 0x00, 0x88, 0x42, 0xD4,
+    0x71, 0x7A, 0x45, 0x87, 0x36, 0x2A, 0x35, 0x54, 0xD5, 0x3D, 0xE0, 0x65, 0x7C, 0x60, 0x09, 0x85,
+    0x3F, 0xB3, 0x0B, 0xC5, 0x81, 0x37, 0x8A, 0x55, 0x71, 0x48, 0x37, 0xA4, 0xF4, 0xAB, 0x18, 0x10,
+    0x54, 0x62, 0x8C, 0x47, 0x30, 0xD2, 0xFD, 0xF7, 0x0E, 0xB2, 0xAE, 0x30, 0xE9, 0xA8, 0x56, 0xE9,
+    0x97, 0x12, 0x6F, 0x66, 0x54, 0xE8, 0x9D, 0x1A, 0x15, 0xAB, 0x1B, 0x72, 0xEE, 0x86, 0x4A, 0x8D,
+    0xC8, 0xED, 0x14, 0xB1, 0x44, 0xF6, 0xBC, 0x67, 0x5B, 0x0E, 0x4F, 0x76, 0x9C, 0x6D, 0x1B, 0x77,
+    0xB1, 0x71, 0xDE, 0x70, 0x5D, 0xDF, 0x0F, 0x59, 0xFC, 0x72, 0xED, 0x3E, 0xFD, 0x7D, 0x85, 0xC3,
+    0x87, 0x18, 0x87, 0xBF, 0x1C, 0x17, 0x18, 0x97, 0x43, 0xD1, 0x1A, 0x44, 0xBF, 0x9B, 0xEB, 0x1C,
+    0x28, 0xE9, 0x5E, 0x2E, 0xD4, 0x98, 0x58, 0x7A, 0x20, 0x61, 0xE1, 0x1C, 0x6A, 0x25, 0x56, 0x1D,
+    0x17, 0x1D, 0x35, 0x64, 0x05, 0x79, 0xFF, 0x45, 0x08, 0xB3, 0x9F, 0xB7, 0x1C, 0xDF, 0x2E, 0x0D,
+    0x89, 0x5E, 0x04, 0x10, 0xDE, 0x97, 0xFF, 0xC6, 0x25, 0x15, 0x69, 0x01, 0x4B, 0x01, 0x0E, 0xF4,
+    0x06, 0x0F, 0xFD, 0x91, 0x4B, 0xF0, 0xDA, 0x24, 0x55, 0x91, 0x4F, 0xB7, 0x85, 0x23, 0x88, 0x93,
+    0xC5, 0x5C, 0x05, 0xF7, 0x6F, 0x0B, 0xFE, 0x31, 0x51, 0x4E, 0x52, 0xC5, 0xA0, 0xE7, 0x8B, 0xC6,
+    0xA5, 0x89, 0x7E, 0xDC, 0x40, 0x8F, 0x80, 0xE2, 0xB1, 0x2B, 0x13, 0xDC, 0x95, 0xD5, 0x92, 0x89,
+    0xE8, 0x99, 0xE4, 0x71, 0x13, 0x75, 0xCD, 0xBE, 0x70, 0xEB, 0xD7, 0xAC, 0xC8, 0xFE, 0x75, 0x6E,
+    0x4A, 0xEA, 0x10, 0xF2, 0xE6, 0x68, 0x0B, 0xBA, 0x5F, 0xFF, 0x68, 0x49, 0x6E, 0xB9, 0x40, 0xCC,
+    0x58, 0x30, 0x10, 0x61, 0xF1, 0x14, 0xB2, 0x11, 0x93, 0xB9, 0x3C, 0x67, 0x21, 0xE3, 0xA2, 0xA3,
+    0xE6, 0x2A, 0x81, 0x86, 0x2B, 0x50, 0x0D, 0x40, 0x3F, 0x13, 0x44, 0x44, 0x9C, 0x62, 0x2A, 0x33,
+    0x12, 0x0E, 0xD8, 0x5E, 0x6E, 0xF1, 0xF4, 0xA9, 0xC6, 0xE5, 0x2A, 0x2C, 0x24, 0x22, 0x9D, 0x8A,
+    0xCC, 0x56, 0x25, 0x93, 0xBD, 0x5A, 0xB8, 0xF9, 0x22, 0x91, 0x29, 0xE9, 0xE1, 0xCD, 0xE5, 0xB3,
+    0x2A, 0x91, 0x29, 0x27, 0xD4, 0xE0, 0xFD, 0x05, 0x54, 0x10, 0x70, 0x63, 0x6D, 0x9D, 0x26, 0x19,
+    0x6F, 0x2F, 0xF8, 0x9D, 0x9E, 0x83, 0xD7, 0x64, 0x92, 0x5C, 0x40, 0xC1, 0x19, 0x5E, 0xB8, 0xAC,
+    0xB4, 0x60, 0xB2, 0x57, 0x0A, 0x6F, 0x09, 0xD6, 0xC1, 0xF5, 0x01, 0xEC, 0x00, 0xBC, 0x06, 0xB0,
+    0x0F, 0xD0, 0x00, 0x2C, 0x04, 0xC8, 0x8E, 0x08, 0x20, 0xB4, 0x04, 0xE5, 0xED, 0xFB, 0xE3, 0xDB,
+    0xF7, 0x8B, 0xC1, 0xEC, 0xB1, 0xDF, 0x9B, 0x38, 0xD6, 0xC0, 0xBF, 0x17, 0xF0, 0x22, 0x31, 0x1F,
+    0x2F, 0xB1, 0xBA, 0x2A, 0xFF, 0xF0, 0xEA, 0x3C, 0xAC, 0x9C, 0x46, 0xD6, 0x0A, 0x26, 0xB5, 0x0B,
+    0xBB, 0x7E, 0x26, 0x64, 0x17, 0x22, 0x8B, 0xB4, 0x93, 0x5D, 0xB3, 0x72, 0xB3, 0xD0, 0x0A, 0x01,
+    0xBD, 0xAA, 0x75, 0xF6, 0x1D, 0x90, 0xC4, 0x18, 0xBB, 0xE9, 0x86, 0x7C, 0xE7, 0x42, 0x12, 0x8A,
+    0x20, 0x02, 0xED, 0xAA, 0xD8, 0x02, 0x6D, 0xD7, 0xAB, 0x65, 0x68, 0x8E, 0xD0, 0x1C, 0x88, 0x7E,
+    0x53, 0xE8, 0x51, 0xD2, 0x8D, 0x57, 0x43, 0xEC, 0x8B, 0xFE, 0xF2, 0xA3, 0x03, 0x9A, 0x13, 0x48,
+    0xCE, 0x65, 0x3D, 0x61, 0x43, 0x88, 0x60, 0x03, 0xE9, 0x38, 0x93, 0x53, 0x72, 0xD2, 0x33, 0x91,
+    0x81, 0xDC, 0x05, 0xFA, 0x11, 0xC2, 0x20, 0x9D, 0xC1, 0x66, 0x27, 0xEF, 0xDB, 0x5E, 0xD6, 0xB2,
+    0xF2, 0x0C, 0x26, 0x73, 0x55, 0x1E, 0xA8, 0x8C, 0xD8, 0x8C, 0xFE, 0x2D, 0x74, 0xC0, 0xC8, 0x5A,
+    0xD7, 0x71, 0xC4, 0xB9, 0x3B, 0x59, 0xCA, 0x3E, 0x17, 0xA5, 0x84, 0x8E, 0x0F, 0x48, 0xE2, 0x90,
+    0x20, 0x30, 0x26, 0x1C, 0x61, 0x75, 0x68, 0x32, 0x18, 0x73, 0xD2, 0x0C, 0xBB, 0x77, 0x4C, 0xE6,
+    0xBE, 0x1C, 0x09, 0x7D, 0x1A, 0xC9, 0x15, 0xF2, 0x08, 0xE4, 0x88, 0x32, 0x51, 0xF8, 0x92, 0x91,
+    0x79, 0x4D, 0x8E, 0x45, 0x32, 0x12, 0x0D, 0x71, 0xE4, 0x57, 0xC9, 0x48, 0x56, 0xD8, 0x48, 0xB4,
+    0xC2, 0x91, 0x7C, 0x39, 0xDA, 0x97, 0x13, 0x44, 0x4E, 0x4B, 0x44, 0x14, 0x4C, 0x44, 0xF3, 0xC3,
+    0xEA, 0x74, 0xDE, 0x70, 0xEF, 0xB8, 0xB5, 0xE8, 0x81, 0xAD, 0x8C, 0x27, 0x93, 0xE5, 0xFD, 0xB9,
+    0xF7, 0x06, 0x4A, 0xF4, 0xB8, 0xEE, 0x31, 0xD2, 0x65, 0x2A, 0xCB, 0x36, 0xA8, 0x60, 0xDF, 0x49,
+    0x28, 0xAC, 0xB6, 0x72, 0x73, 0x39, 0xF1, 0xA6, 0x9C, 0x28, 0xA2, 0x54, 0x82, 0x7D, 0x23, 0x7B,
+    0x3A, 0x71, 0x60, 0x73, 0x80, 0x67, 0x46, 0x36, 0x0E, 0xF7, 0x4D, 0x30, 0xE3, 0x12, 0x07, 0x09,
+    0xA2, 0x96, 0x48, 0xB0, 0x3B, 0xD9, 0xCB, 0x65, 0x85, 0x85, 0x27, 0x40, 0xB3, 0x09, 0x16, 0x03,
+    0x10, 0x72, 0x21, 0xBA, 0xB3, 0x00, 0x38, 0x17, 0xF2, 0xFF, 0x01, 0x20, 0xB7, 0x15, 0x90, 0xEA,
+    0xF6, 0x55, 0xD1, 0x3D, 0xCB, 0x65, 0xD0, 0xA6, 0x28, 0x13, 0xD8, 0x1F, 0x00, 0xDD, 0xAE, 0x1C,
+    0x89, 0x7E, 0xF0, 0x41, 0x29, 0x13, 0xF3, 0xFF, 0xB6, 0x1C, 0xED, 0x98, 0xF0, 0x9D, 0x72, 0x24,
+    0x23, 0xFB, 0x5A, 0x29, 0x53, 0x8E, 0xC3, 0x72, 0x14, 0xE6, 0x32, 0xFF, 0x51, 0x50, 0xEE, 0x0B,
+    0xF4, 0x66, 0x0B, 0xC0, 0xDF, 0xCC, 0x05, 0x3A, 0xBF, 0x95, 0xB5, 0x34, 0x12, 0xD5, 0x1F, 0xB0,
+    0x28, 0x01, 0x93, 0x1C, 0x30, 0x36, 0x80, 0x5C, 0xC4, 0xA7, 0x1F, 0xE3, 0xF1, 0x81, 0xEC, 0xB4,
+    0x25, 0x8F, 0xF3, 0xCE, 0xB3, 0x4E, 0x2F, 0x10, 0x89, 0x14, 0xDB, 0x44, 0x56, 0xE0, 0xE1, 0x4D,
+    0x6A, 0x2F, 0x05, 0x56, 0x1C, 0x10, 0x48, 0x6C, 0xAB, 0x1A, 0xBC, 0x2E, 0x63, 0x66, 0xEB, 0xD4,
+    0x28, 0x2A, 0x79, 0x32, 0x2F, 0xF3, 0x0F, 0x85, 0xF2, 0x38, 0xC7, 0x29, 0x4F, 0xD7, 0xF2, 0x98,
+    0x4C, 0xB0, 0xF9, 0xA6, 0x8F, 0x7A, 0x70, 0xA8, 0xD7, 0x03, 0xE9, 0xF6, 0x7A, 0x06, 0x9F, 0xDC,
+    0xE1, 0x2D, 0x79, 0xD4, 0x95, 0x50, 0xF4, 0x24, 0x57, 0x25, 0x9F, 0x03, 0x8E, 0x87, 0x51, 0x1F,
+    0x03, 0xFC, 0x82, 0xD4, 0x34, 0xC3, 0xA3, 0x92, 0xCB, 0x16, 0xA2, 0xBC, 0x8C, 0x0A, 0xE9, 0x6A,
+    0x04, 0x2F, 0x6A, 0xC2, 0xB1, 0xAE, 0x74, 0xD1, 0xB3, 0x80, 0xC5, 0xD8, 0x1D, 0x20, 0xCC, 0x6F,
+    0x5F, 0xA9, 0x40, 0x2B, 0xE2, 0x72, 0x45, 0x3F, 0x76, 0x8F, 0x1D, 0x1B, 0x74, 0x45, 0x16, 0x47,
+    0x70, 0x28, 0x7B, 0x46, 0x6D, 0x7E, 0x15, 0xF0, 0x23, 0xEB, 0xB1, 0x11, 0x4A, 0xD6, 0x7C, 0x73,
+    0xEF, 0xFD, 0xB7, 0xC8, 0x0E, 0x1E, 0xF1, 0x98, 0x5A, 0x17, 0x81, 0xCE, 0x53, 0x5D, 0x9B, 0xB2,
+    0x27, 0x5B, 0xB5, 0x91, 0xF9, 0x33, 0x67, 0x41, 0x6A, 0x25, 0xB2, 0x05, 0x18, 0xCF, 0x02, 0xE4,
+    0x01, 0x56, 0x38, 0xB3, 0x13, 0xC1, 0xAC, 0x41, 0x35, 0x95, 0x5A, 0x2A, 0xED, 0x1E, 0x4D, 0x6F,
+    0xC3, 0xF4, 0x06, 0x49, 0xC4, 0x1F, 0x84, 0x10, 0x50, 0x1E, 0x3A, 0xD5, 0xBE, 0x05, 0x5A, 0x53,
+    0x90, 0xDD, 0x6B, 0xE8, 0xC4, 0x25, 0x42, 0xDD, 0x0F, 0xE7, 0x43, 0xF6, 0x11, 0x50, 0x78, 0x81,
+    0xFF, 0x41, 0x28, 0xC4, 0xED, 0x5F, 0xB6, 0xA2, 0x51, 0x86, 0x79, 0x91, 0x0A, 0x2B, 0xCB, 0x63,
+    0xE1, 0xC8, 0x61, 0x0E, 0x1E, 0x17, 0x8A, 0x2E, 0x97, 0x09, 0xF4, 0xEB, 0x5D, 0xEE, 0x3E, 0x85,
+    0x19, 0x21, 0xBE, 0xF5, 0x67, 0x7A, 0xA6, 0xF0, 0xF8, 0x5C, 0xAE, 0x9C, 0x85, 0x79, 0x96, 0x7B,
+    0x6D, 0xF8, 0x9F, 0x97, 0xB4, 0x19, 0x2F, 0xC8, 0x75, 0xEF, 0xC0, 0xB3, 0xFE, 0x8B, 0x8B, 0x8E,
+    0x2D, 0xCC, 0x2D, 0xDB, 0x22, 0xFA, 0x82, 0x99, 0x6B, 0x31, 0xE7, 0x34, 0x54, 0xEC, 0xF1, 0x20,
+    0x93, 0xA2, 0xC7, 0x12, 0x2D, 0x15, 0x04, 0x11, 0xC8, 0x7B, 0x02, 0xE2, 0x0E, 0x5A, 0xE8, 0x2E,
+    0x84, 0x15, 0xCB, 0x65, 0x42, 0x32, 0x84, 0xF1, 0xE0, 0xE9, 0x1F, 0x40, 0x10, 0x4A, 0xD2, 0x11,
+    0x34, 0x13, 0xAE, 0xE7, 0x4F, 0x0E, 0xC6, 0xE3, 0xE5, 0x56, 0x02, 0x3B, 0x48, 0xD2, 0x9B, 0xC7,
+    0x4F, 0x01, 0xCE, 0x1B, 0x32, 0xCE, 0x85, 0x9A, 0x7D, 0x4E, 0x3F, 0x0A, 0xF0, 0xF8, 0xF7, 0xF7,
+    0x44, 0x6C, 0xE9, 0x1A, 0xA7, 0x78, 0xEF, 0x4C, 0x0B, 0x90, 0x10, 0xE2, 0x39, 0x49, 0x80, 0xFB,
+    0x84, 0x9B, 0x6C, 0x7C, 0xF3, 0x50, 0xC4, 0xB8, 0x8C, 0xBA, 0x50, 0xDF, 0x8C, 0xF8, 0x9D, 0x6C,
+    0x65, 0x9E, 0xF2, 0x24, 0x1B, 0xDC, 0x7D, 0xFB, 0x17, 0x09, 0x6F, 0xBB, 0xB4, 0xCD, 0xC0, 0xD2,
+    0xCE, 0x6C, 0x7E, 0x2F, 0xEB, 0xB8, 0x9A, 0x05, 0x7C, 0xB3, 0x48, 0x6D, 0x5C, 0xD1, 0x3A, 0xB8,
+    0x8B, 0x3D, 0x06, 0xAF, 0x56, 0x8C, 0x87, 0x15, 0xA7, 0x57, 0x17, 0x02, 0xB0, 0x36, 0x52, 0x43,
+    0xD0, 0xF6, 0xEF, 0x5C, 0x01, 0x77, 0xB7, 0xE7, 0x38, 0xAF, 0x12, 0xD0, 0xF2, 0x0E, 0xEA, 0x85,
+    0x3D, 0x07, 0x8E, 0x53, 0x40, 0x19, 0x29, 0x60, 0x57, 0xE1, 0xF3, 0xA8, 0x06, 0xF4, 0x60, 0xD6,
+    0x95, 0x05, 0x09, 0xE8, 0x10, 0xBA, 0xFC, 0xC4, 0xC7, 0xB7, 0xE3, 0x62, 0xC6, 0xF3, 0x73, 0xC0,
+    0x85, 0x5C, 0x3B, 0x5A, 0xA3, 0x59, 0x1B, 0xC7, 0x18, 0xA4, 0x7C, 0xA9, 0x42, 0xA4, 0xF4, 0x6C,
+    0xB9, 0xAA, 0x15, 0x22, 0x5D, 0xE5, 0xD0, 0xE3, 0xBD, 0x19, 0xFA, 0x4A, 0xD4, 0x14, 0x2A, 0x63,
+    0xAF, 0x0C, 0x24, 0x8E, 0xAF, 0xBC, 0xD2, 0x59, 0xE5, 0x25, 0x1C, 0x24, 0x93, 0x4B, 0xE3, 0x5B,
+    0xB5, 0xC8, 0x44, 0x3C, 0x94, 0xC4, 0x80, 0xC2, 0xE0, 0x3B, 0x8A, 0x50, 0xF9, 0x0F, 0x44, 0x0F,
+    0x85, 0x20, 0x9C, 0x81, 0x4C, 0xDE, 0x58, 0xC9, 0x14, 0x4E, 0x07, 0x53, 0x91, 0x5C, 0x05, 0x1E,
+    0xFF, 0x6E, 0x56, 0x82, 0xDB, 0x83, 0xC7, 0x43, 0x18, 0x83, 0x44, 0x20, 0xA3, 0x81, 0xFA, 0xD4,
+    0x24, 0x37, 0x09, 0x69, 0x23, 0xB4, 0xD0, 0xE3, 0x27, 0xFA, 0xAD, 0x9E, 0x89, 0xAB, 0xE6, 0xE8,
+    0xC1, 0x97, 0xF9, 0x24, 0xD5, 0x76, 0xC9, 0x9E, 0x81, 0x21, 0x35, 0x62, 0x5D, 0x62, 0x48, 0x4E,
+    0xEB, 0x0B, 0xFB, 0x0A, 0x8F, 0x26, 0xAD, 0xD0, 0xF9, 0x0D, 0x96, 0x24, 0xBB, 0x7A, 0x1A, 0x1E,
+    0x8E, 0xA7, 0xF8, 0x5E, 0x06, 0xDB, 0xCA, 0x0E, 0x87, 0x19, 0x6A, 0x2A, 0x14, 0x63, 0x2A, 0x6A,
+    0xDE, 0x14, 0x8E, 0x3B, 0x99, 0xF5, 0x34, 0xC3, 0x6E, 0xFD, 0x86, 0x35, 0xEC, 0x61, 0x7A, 0x98,
+    0xAA, 0x03, 0xD2, 0xFA, 0x9D, 0x95, 0xE2, 0xF6, 0x18, 0x65, 0x55, 0xB5, 0x0D, 0x40, 0x7E, 0x06,
+    0xF1, 0xA7, 0x8E, 0xF1, 0x44, 0xEE, 0x43, 0x73, 0xDE, 0x4A, 0x4F, 0xFD, 0xD6, 0xD1, 0x84, 0x44,
+    0x97, 0x34, 0x7D, 0xFD, 0x0B, 0xAF, 0xFE, 0xA2, 0x28, 0xF6, 0xBF, 0x11, 0x04, 0x79, 0x1F, 0x43,
+    0x29, 0xEF, 0xD2, 0xB8, 0xF4, 0x60, 0x3C, 0xF5, 0x2C, 0x69, 0x7D, 0x64, 0x60, 0xCC, 0xA9, 0x00,
+    0x1A, 0xF3, 0xF3, 0x70, 0xAD, 0x33, 0x3E, 0x2A, 0xC4, 0x6A, 0x7C, 0x0B, 0x01, 0x7F, 0x1A, 0x49,
+    0x12, 0x1B, 0xF3, 0x55, 0x8B, 0x8C, 0x47, 0x54, 0x67, 0xEC, 0xE2, 0xDE, 0x90, 0x01, 0xF2, 0x15,
+    0xBE, 0xB2, 0xF1, 0x98, 0x01, 0x44, 0x38, 0x2E, 0x22, 0x03, 0xA8, 0x55, 0xBD, 0x05, 0xAB, 0xCA,
+    0x93, 0xBB, 0xDB, 0x94, 0x75, 0xF6, 0xAD, 0x7D, 0x1C, 0xBB, 0x26, 0x3A, 0x84, 0x1D, 0x54, 0x4E,
+    0xDD, 0xA6, 0x8B, 0xB1, 0x0F, 0x04, 0xB3, 0xCC, 0x3F, 0x2C, 0xFF, 0x4A, 0x04, 0x4F, 0xA0, 0x9C,
+    0x0A, 0xB4, 0xEC, 0xD3, 0x2F, 0x51, 0x71, 0x18, 0x0D, 0x7B, 0x26, 0x79, 0xE0, 0xBF, 0x2F, 0x7D,
+    0x69, 0x34, 0x4A, 0x92, 0xEB, 0xD7, 0xAD, 0x39, 0x79, 0xF6, 0xE0, 0x7F, 0x72, 0x13, 0x30, 0xB4,
+    0x6C, 0xA0, 0x7F, 0x3D, 0x2D, 0x4C, 0x3E, 0xC1, 0x6B, 0x84, 0x39, 0xFF, 0xB0, 0x31, 0x08, 0x1B,
+    0xA8, 0x6C, 0x10, 0xD6, 0xD0, 0xEC, 0x4E, 0x48, 0x56, 0xF7, 0x95, 0x9C, 0x9E, 0x68, 0x40, 0x5E,
+    0x1B, 0x25, 0xB0, 0x6C, 0x66, 0xA4, 0xA5, 0x42, 0x64, 0x2D, 0x99, 0x5D, 0x28, 0x79, 0x9D, 0xB3,
+    0x71, 0xB4, 0xA1, 0x71, 0xDB, 0x5D, 0x88, 0x38, 0x2F, 0x04, 0xB7, 0x26, 0xB5, 0xED, 0x2A, 0x52,
+    0xE8, 0xC3, 0xB5, 0x19, 0xED, 0xE8, 0xE3, 0x9B, 0x5E, 0xB0, 0x01, 0xBF, 0x78, 0x4F, 0x1B, 0x21,
+    0x25, 0x93, 0xC9, 0x72, 0x52, 0x54, 0xFC, 0x2E, 0xA8, 0xD9, 0x78, 0xA7, 0x35, 0xFC, 0xEE, 0x60,
+    0xCC, 0x33, 0x0B, 0x92, 0x20, 0x69, 0xE6, 0xA7, 0xEC, 0x30, 0x06, 0x45, 0xE4, 0x38, 0x27, 0x3F,
+    0x65, 0x87, 0x2D, 0x57, 0x3B, 0xAC, 0x7A, 0x5C, 0x3B, 0x0C, 0x51, 0x4A, 0x20, 0x5C, 0xAD, 0xD2,
+    0x2C, 0x04, 0x50, 0xAD, 0xC5, 0x4F, 0x3D, 0x36, 0xED, 0xEC, 0x47, 0xD6, 0x71, 0x04, 0xD1, 0x50,
+    0x14, 0x4A, 0x15, 0x5E, 0x7E, 0xFC, 0xD8, 0xB5, 0x49, 0x68, 0xAC, 0xC6, 0xCC, 0x65, 0x01, 0x53,
+    0x4E, 0x93, 0xB1, 0xC9, 0x5C, 0x2E, 0xFF, 0xEF, 0x75, 0x0A, 0xF9, 0xF4, 0x45, 0x69, 0x2C, 0xBA,
+    0x47, 0xD6, 0x95, 0xC6, 0xE3, 0xB6, 0xD7, 0xB9, 0x06, 0x0B, 0x40, 0x7F, 0xC8, 0xDC, 0xD5, 0x5D,
+    0xED, 0x23, 0x56, 0x43, 0xE8, 0x11, 0x18, 0x1F, 0x5B, 0xC6, 0x6E, 0xB0, 0x85, 0x31, 0x49, 0x1E,
+    0x8C, 0x1A, 0x77, 0x83, 0x2A, 0xEA, 0x5B, 0x1B, 0x8E, 0x07, 0xAB, 0x30, 0xBD, 0x2B, 0x82, 0xD0,
+    0x5A, 0x8D, 0x68, 0x49, 0xAD, 0xE1, 0x1C, 0x05, 0x76, 0x15, 0xAC, 0x17, 0x60, 0xD1, 0xEE, 0x1C,
+    0x9E, 0x5A, 0x3C, 0x5A, 0xB7, 0x6E, 0xA1, 0x0A, 0x35, 0x10, 0xDE, 0x61, 0x44, 0x95, 0xA7, 0x04,
+    0x81, 0x32, 0x0B, 0xCA, 0xF8, 0x65, 0x78, 0xB9, 0xA5, 0xAF, 0x9F, 0x0A, 0x5E, 0xA2, 0xEF, 0xA7,
+    0xC1, 0xCF, 0xE1, 0xF6, 0xF9, 0xC0, 0xF8, 0x1F, 0x43, 0x46, 0x90, 0xC5, 0x4C, 0x3F, 0x37, 0x54,
+    0xCA, 0x54, 0xA3, 0x2D, 0x8A, 0xD5, 0x53, 0x42, 0xF4, 0xB4, 0x2C, 0x94, 0x5D, 0x34, 0x41, 0x45,
+    0xE9, 0x10, 0x2B, 0x90, 0x96, 0xA2, 0x44, 0x83, 0x9F, 0x62, 0x6D, 0x22, 0xEC, 0xFB, 0x28, 0x17,
+    0x05, 0x1E, 0x14, 0x21, 0x2C, 0x3D, 0x44, 0x70, 0x06, 0x95, 0xF4, 0x3F, 0x92, 0xF9, 0x86, 0x1D,
+    0x77, 0x61, 0x74, 0x3B, 0x6D, 0x64, 0x7D, 0xC7, 0xE1, 0x4F, 0x10, 0x2C, 0x70, 0x3D, 0xF8, 0x99,
+    0x8C, 0x64, 0xBA, 0xEF, 0xFD, 0x5A, 0x90, 0x96, 0xCC, 0x5D, 0x8C, 0x23, 0xAA, 0x0D, 0x86, 0x21,
+    0xF3, 0x3E, 0xD0, 0x18, 0xD2, 0x5E, 0xB2, 0x53, 0x38, 0xCE, 0xEE, 0xDE, 0xE0, 0xDE, 0x6D, 0x7A,
+    0x68, 0xED, 0x36, 0x71, 0x7A, 0x02, 0xBE, 0xFF, 0x23, 0x32, 0x10, 0x98, 0xDD, 0x63, 0x9E, 0x2A,
+    0x54, 0xA8, 0xD3, 0x30, 0x82, 0x14, 0x50, 0x2E, 0x8C, 0x19, 0x9A, 0x32, 0x40, 0xFD, 0x44, 0xBF,
+    0xC5, 0x99, 0x88, 0x75, 0xC2, 0xB5, 0xD4, 0xB4, 0xA1, 0x46, 0xDD, 0x38, 0xE9, 0xB8, 0x2C, 0x06,
+    0x42, 0xF1, 0xCD, 0xE5, 0x24, 0x3D, 0xDD, 0xB7, 0xB9, 0x9C, 0xDC, 0x20, 0xCF, 0xAE, 0xFA, 0x58,
+    0x2B, 0xB7, 0xE9, 0xC3, 0x2C, 0x04, 0x2D, 0x16, 0x08, 0xDE, 0xDA, 0xF1, 0xED, 0x45, 0x1F, 0xC5,
+    0xB5, 0x5C, 0x8F, 0x08, 0x11, 0x81, 0xB7, 0xA1, 0x92, 0x05, 0x15, 0xA3, 0x38, 0xDA, 0xAB, 0x19,
+    0xE0, 0x65, 0x5E, 0x85, 0x25, 0x9E, 0x37, 0x61, 0x7C, 0xA3, 0x06, 0xA1, 0x69, 0xB0, 0x06, 0x23,
+    0x30, 0x52, 0x6D, 0xE8, 0xFF, 0x84, 0x0B, 0xE4, 0x2D, 0x63, 0x1D, 0x1F, 0xB6, 0x69, 0xD4, 0x89,
+    0x6C, 0x4F, 0x59, 0x35, 0x7A, 0x5D, 0xAC, 0x9D, 0x31, 0xCA, 0xB5, 0x81, 0x33, 0x1E, 0x8D, 0xD7,
+    0xEA, 0xA4, 0xBA, 0xFB, 0xAF, 0xC0, 0x27, 0x90, 0xA8, 0xE7, 0xFD, 0xB2, 0xF5, 0xB4, 0x5D, 0xDA,
+    0x5A, 0x11, 0x92, 0xED, 0x0E, 0x6A, 0x04, 0x05, 0xD9, 0xE0, 0xF0, 0x56, 0x99, 0x58, 0x5F, 0x6D,
+    0xB2, 0x8A, 0x90, 0x53, 0xD5, 0x7D, 0xBC, 0x14, 0x46, 0x4E, 0x42, 0xDE, 0x43, 0x4B, 0xE8, 0xC9,
+    0x98, 0x39, 0xC2, 0xFE, 0x7C, 0x35, 0x01, 0x84, 0x87, 0x97, 0xA5, 0x4F, 0x8F, 0x3D, 0x0B, 0xDB,
+    0xCA, 0x7B, 0x97, 0xA7, 0x9A, 0x95, 0x63, 0x75, 0xF1, 0xD2, 0x15, 0x9A, 0x11, 0x36, 0x1A, 0x19,
+    0xD8, 0xD0, 0xE6, 0x3F, 0x25, 0x7D, 0x48, 0xE8, 0xFD, 0x8B, 0x29, 0x28, 0x82, 0x9E, 0x44, 0xEF,
+    0xEF, 0x91, 0x4A, 0x61, 0xAD, 0x24, 0x94, 0x95, 0xA7, 0xE1, 0x9F, 0x41, 0x84, 0x0D, 0xBF, 0x8B,
+    0x90, 0x9B, 0x30, 0x87, 0xE0, 0x1B, 0x0A, 0xB9, 0xF2, 0x6B, 0x28, 0x47, 0x41, 0x25, 0xCA, 0xB3,
+    0xAC, 0x71, 0x28, 0xC3, 0x71, 0xDE, 0xAB, 0xD0, 0xFE, 0x4C, 0xD5, 0x66, 0x21, 0x61, 0x70, 0xB5,
+    0xD2, 0xA9, 0xEC, 0x41, 0x26, 0xF7, 0x3F, 0x40, 0xF2, 0xC3, 0x3B, 0x90, 0x4B, 0xFE, 0x0B, 0x0C,
+    0x89, 0x20, 0x8B, 0x09, 0x88, 0xD4, 0xAE, 0xCB, 0x38, 0x1A, 0x5A, 0xE7, 0x5B, 0x19, 0x5C, 0x83,
+    0x7D, 0xD6, 0xA0, 0xFF, 0x06, 0x11, 0x56, 0x0D, 0x06, 0xD7, 0x60, 0xBF, 0x35, 0x18, 0x72, 0x83,
+    0xD1, 0x37, 0xCE, 0x62, 0x5F, 0x29, 0x9C, 0xCC, 0xC7, 0x5F, 0x68, 0x3C, 0x72, 0xC3, 0x26, 0x6A,
+    0xD5, 0xC0, 0x6F, 0x83, 0x5B, 0xC8, 0x88, 0x49, 0x2E, 0x1B, 0x25, 0x9D, 0x98, 0x49, 0x00, 0x86,
+    0x4D, 0x92, 0xDA, 0x4D, 0xEE, 0x1D, 0xDD, 0x9B, 0x9F, 0x58, 0x10, 0xD1, 0xF7, 0x6A, 0x04, 0x08,
+    0x26, 0x7F, 0x84, 0x1B, 0xD2, 0x82, 0x2A, 0x2B, 0x6F, 0x2A, 0x3B, 0xB7, 0x6C, 0xD4, 0x90, 0xDA,
+    0xC0, 0x90, 0x1A, 0xCC, 0x1A, 0x10, 0x67, 0x19, 0xAC, 0xDA, 0x53, 0x45, 0x69, 0xF7, 0x6A, 0x07,
+    0x11, 0x47, 0x20, 0x4C, 0x0D, 0xCD, 0xAA, 0xC5, 0x88, 0x54, 0x77, 0x04, 0x23, 0x1D, 0x18, 0xD8,
+    0xC7, 0x80, 0xDE, 0x87, 0x33, 0xC0, 0xBF, 0xAF, 0x61, 0x93, 0x16, 0x22, 0x30, 0x42, 0x04, 0x93,
+    0xAC, 0x81, 0xED, 0xBB, 0xD3, 0x8D, 0x35, 0x30, 0x12, 0x45, 0x38, 0xCA, 0x85, 0xE5, 0xC0, 0x6E,
+    0xE7, 0xCE, 0x85, 0xE7, 0x8C, 0xBC, 0x1A, 0x2F, 0x79, 0x23, 0xFF, 0x85, 0x71, 0x6E, 0xC1, 0x13,
+    0x9A, 0x11, 0x22, 0xC2, 0x77, 0xE1, 0x81, 0xED, 0x66, 0xEB, 0x10, 0x0E, 0x85, 0x88, 0x16, 0x1B,
+    0x5A, 0x04, 0x6C, 0x58, 0x1F, 0x58, 0x6B, 0x0D, 0x5E, 0x42, 0x99, 0x5C, 0x84, 0x01, 0x2C, 0x41,
+    0xA7, 0xC0, 0xDE, 0x8E, 0x68, 0xC8, 0x28, 0xBA, 0x8F, 0x65, 0x63, 0xB5, 0xA0, 0xD0, 0xEE, 0xC2,
+    0x9F, 0xC1, 0x89, 0x2F, 0xD4, 0xAB, 0xF2, 0x05, 0xFA, 0x33, 0x21, 0x67, 0x33, 0x58, 0x9F, 0x05,
+    0xCE, 0x23, 0x81, 0xEE, 0x22, 0xCE, 0x11, 0x69, 0x95, 0xA4, 0x84, 0x20, 0xFE, 0xD3, 0x5D, 0xC0,
+    0xDD, 0x80, 0xE8, 0x54, 0xA8, 0xB1, 0xA2, 0xD8, 0x42, 0x55, 0x1F, 0xAC, 0xA0, 0x71, 0xA6, 0xFE,
+    0xDF, 0x69, 0x80, 0xC2, 0x5C, 0x05, 0x1A, 0xF9, 0xBC, 0x2B, 0x44, 0x22, 0xF3, 0xE6, 0x31, 0x88,
+    0xEE, 0x2C, 0x16, 0xBA, 0x2A, 0x8B, 0x94, 0x11, 0x58, 0xB1, 0x4C, 0x24, 0x4A, 0x63, 0x8A, 0x99,
+    0x31, 0x83, 0xE0, 0x63, 0xF9, 0xFF, 0x94, 0x76, 0xCA, 0x7D, 0x06, 0x6C, 0x80, 0x98, 0x1C, 0x6F,
+    0x65, 0xDA, 0x0C, 0xE3, 0x62, 0xC0, 0x39, 0x95, 0x37, 0x0D, 0xC8, 0xA2, 0x84, 0xD0, 0xC7, 0x82,
+    0x72, 0xCD, 0x7C, 0x6F, 0xAE, 0x2B, 0xE9, 0x97, 0x15, 0xE3, 0x12, 0xF7, 0xBA, 0x5F, 0xF4, 0x91,
+    0xED, 0xA9, 0x6D, 0x2B, 0x2C, 0x8E, 0x6A, 0xCA, 0x88, 0xB0, 0x24, 0x9D, 0x3A, 0xEA, 0xDC, 0x9A,
+    0x1A, 0x75, 0x6E, 0x4D, 0x87, 0x77, 0xBB, 0xB6, 0xC5, 0x7A, 0x15, 0x0D, 0x0D, 0x51, 0x65, 0x72,
+    0xDB, 0x29, 0x22, 0x61, 0xD9, 0xCA, 0xB2, 0x06, 0x9A, 0xD0, 0x0A, 0x65, 0x99, 0x1A, 0x3C, 0x50,
+    0x7D, 0xE4, 0xB6, 0x81, 0xBB, 0xB6, 0xE5, 0x44, 0x65, 0x77, 0x8C, 0xC0, 0xFB, 0x2A, 0x2C, 0x19,
+    0x98, 0xF2, 0x21, 0x06, 0xC1, 0x23, 0x3D, 0x1E, 0x17, 0x8D, 0x95, 0x01, 0x21, 0xF7, 0x74, 0x1F,
+    0x7C, 0x80, 0x33, 0xA7, 0x81, 0xAC, 0xD1, 0x11, 0x54, 0xB1, 0x5D, 0xE9, 0x6C, 0x0E, 0x06, 0x25,
+    0x2B, 0x46, 0xF8, 0x5F, 0x3A, 0x92, 0x47, 0x07, 0xE3, 0xAE, 0xF4, 0xC5, 0x26, 0x0F, 0xE4, 0xE1,
+    0x8D, 0xE2, 0x14, 0xDE, 0x0E, 0x27, 0x15, 0xDD, 0xC0, 0x9B, 0x71, 0x2B, 0x45, 0xA2, 0x70, 0x65,
+    0x0C, 0xDB, 0x5D, 0xD8, 0x55, 0x11, 0x81, 0x18, 0x64, 0xF7, 0x6F, 0x35, 0xE6, 0xFA, 0x46, 0xA8,
+    0xE1, 0x26, 0xC0, 0x17, 0xD2, 0x81, 0x3B, 0xC1, 0xD3, 0x83, 0x07, 0x42, 0xA3, 0xC6, 0x4C, 0xD0,
+    0xAC, 0x62, 0x6F, 0x52, 0x46, 0x03, 0xF7, 0x80, 0x8B, 0x8F, 0x9F, 0x09, 0x81, 0x70, 0x6E, 0xB5,
+    0xA0, 0xA0, 0x73, 0xA8, 0xFE, 0xA9, 0x29, 0x5E, 0xDF, 0x88, 0xE6, 0x59, 0xA6, 0x97, 0x68, 0xBF,
+    0xEC, 0x6C, 0x74, 0xDC, 0x78, 0x7C, 0x6B, 0xC5, 0x9E, 0x65, 0x1E, 0xB5, 0x5B, 0xC7, 0xB2, 0xE7,
+    0x0E, 0xC0, 0x41, 0xA5, 0x17, 0xEA, 0x37, 0x65, 0xF8, 0xFA, 0xF6, 0x4C, 0xA9, 0x84, 0x6B, 0x0F,
+    0xC1, 0xF9, 0x37, 0x0B, 0x61, 0x54, 0x2D, 0x96, 0xB8, 0xDC, 0x3C, 0xA8, 0x37, 0xFC, 0x6D, 0xF4,
+    0xBF, 0xDD, 0xAE, 0x41, 0xC7, 0x85, 0xD3, 0x99, 0xEC, 0x75, 0xD5, 0x8D, 0x70, 0x88, 0x9E, 0x7A,
+    0x47, 0x78, 0xE0, 0xA2, 0x8F, 0x39, 0x11, 0xC6, 0xC0, 0x98, 0xE9, 0xE4, 0x21, 0x60, 0xA8, 0xB0,
+    0x6C, 0x09, 0x0F, 0x08, 0x13, 0xC6, 0xBA, 0x24, 0x39, 0x48, 0x7C, 0x38, 0x4F, 0xDC, 0x25, 0xA3,
+    0x7C, 0x17, 0x9A, 0x9B, 0x05, 0xCF, 0xE4, 0x7B, 0x6B, 0x61, 0xDC, 0xE7, 0xC2, 0xE7, 0xCC, 0x45,
+    0xCF, 0x4C, 0x8C, 0x1A, 0x06, 0x85, 0x62, 0x90, 0xA9, 0xAC, 0x60, 0x9C, 0x02, 0x46, 0x0A, 0xF3,
+    0x15, 0x0C, 0x4F, 0x40, 0x50, 0x9D, 0x84, 0x62, 0x6B, 0x62, 0x65, 0xEC, 0x0C, 0x52, 0xB6, 0x90,
+    0xFB, 0xE0, 0x30, 0x11, 0xFE, 0xED, 0x6A, 0xD8, 0xC9, 0xB6, 0x72, 0xF0, 0xEC, 0xA1, 0xC6, 0x36,
+    0x64, 0x48, 0x1D, 0xAA, 0x46, 0x56, 0x49, 0x6F, 0xF7, 0x8B, 0x05, 0x17, 0x57, 0x4B, 0x26, 0x5F,
+    0x90, 0x09, 0xF6, 0xC1, 0x4E, 0x19, 0x63, 0xE9, 0xE8, 0x00, 0x9B, 0xB5, 0x74, 0x7B, 0x0B, 0x33,
+    0x1D, 0xDF, 0x62, 0x44, 0x5C, 0x67, 0xA1, 0x7E, 0xAE, 0x50, 0xCF, 0xD4, 0xAB, 0xB4, 0x07, 0x68,
+    0xBE, 0x71, 0x0E, 0xC7, 0x79, 0x06, 0x0B, 0xAB, 0xB3, 0x64, 0xBC, 0x9D, 0x3E, 0x85, 0x99, 0x0D,
+    0xD3, 0xED, 0x6D, 0xCE, 0xAA, 0x90, 0xE7, 0xEA, 0xF5, 0xF4, 0xDA, 0x57, 0x38, 0xA2, 0x4C, 0x83,
+    0x90, 0xE9, 0x26, 0x56, 0x6F, 0xC5, 0x78, 0x7C, 0xBB, 0xC2, 0xDE, 0xB4, 0x60, 0xF0, 0xA2, 0xC6,
+    0x36, 0x68, 0x99, 0x11, 0xCB, 0x99, 0xF1, 0x0E, 0xDD, 0x13, 0x6E, 0x0C, 0xAC, 0xB7, 0x88, 0xA3,
+    0xCC, 0xC8, 0xA3, 0xBB, 0x57, 0x65, 0x8F, 0x30, 0xBE, 0xD8, 0xD0, 0x97, 0xAC, 0x62, 0x28, 0x16,
+    0xB3, 0x3F, 0x5B, 0x25, 0xA1, 0xB8, 0x0C, 0x3C, 0x56, 0x23, 0x9F, 0x95, 0x62, 0x0E, 0xAC, 0x5B,
+    0x60, 0x6A, 0xDD, 0xE5, 0xD2, 0xED, 0x77, 0xB1, 0x7A, 0xC3, 0x9F, 0x82, 0xD8, 0x86, 0x3F, 0xA7,
+    0x86, 0xF0, 0x2B, 0xA6, 0x02, 0xFC, 0xB6, 0xA2, 0x61, 0xA0, 0xA4, 0x4B, 0x5A, 0x13, 0x05, 0x56,
+    0x91, 0x61, 0x7D, 0xC6, 0x10, 0xC6, 0x14, 0x63, 0x48, 0xC9, 0x56, 0x82, 0xC0, 0x0B, 0x72, 0xD5,
+    0xB0, 0x74, 0x20, 0x0E, 0xBB, 0x20, 0xD6, 0x54, 0xE3, 0x64, 0x50, 0xA0, 0x3B, 0x56, 0x53, 0x69,
+    0x60, 0xE3, 0xDE, 0x61, 0x46, 0x00, 0xED, 0x12, 0x34, 0x30, 0x4E, 0xD7, 0x6D, 0xDA, 0xEE, 0x1B,
+    0xF0, 0xA0, 0x82, 0x8B, 0x18, 0x7B, 0x8D, 0xC8, 0x05, 0xD4, 0x5B, 0x52, 0x46, 0x28, 0x94, 0xFF,
+    0x7A, 0x33, 0x03, 0xE4, 0x59, 0x43, 0xCF, 0xF3, 0x2F, 0xBF, 0x21, 0x57, 0xFE, 0x04, 0x91, 0xCA,
+    0xD5, 0x14, 0x74, 0x06, 0x7D, 0xBF, 0x8D, 0x69, 0xFF, 0x81, 0x5B, 0x6E, 0x8E, 0xFB, 0x09, 0x61,
+    0x70, 0xED, 0x2F, 0xE8, 0x23, 0x44, 0xD4, 0x30, 0x46, 0x13, 0x4B, 0xF7, 0x43, 0x1D, 0x32, 0xA4,
+    0xD7, 0x50, 0xA3, 0xE3, 0x64, 0xA9, 0x7B, 0x8B, 0x21, 0x37, 0xA4, 0x19, 0xB6, 0x5E, 0x2B, 0xF7,
+    0x72, 0xE7, 0x74, 0x1B, 0x13, 0x73, 0x94, 0x3E, 0x89, 0x49, 0xBA, 0x1C, 0x88, 0x4A, 0x06, 0x5F,
+    0xD0, 0x7C, 0xCD, 0x77, 0x2F, 0x0B, 0xE6, 0xD3, 0x46, 0x03, 0x35, 0x2C, 0x1A, 0x41, 0x4C, 0x46,
+    0xA4, 0xDE, 0x09, 0xD1, 0x3B, 0xB5, 0x89, 0x24, 0x0D, 0x11, 0x0E, 0x87, 0xCA, 0xC2, 0x3E, 0x00,
+    0x68, 0x63, 0x09, 0x1F, 0x88, 0xFF, 0x73, 0xB2, 0x65, 0x18, 0x11, 0x7E, 0x55, 0x21, 0xF3, 0x50,
+    0x68, 0xB3, 0x2B, 0xD2, 0x92, 0xB7, 0x1C, 0xC3, 0x3E, 0xA3, 0x1B, 0x8E, 0xD2, 0x01, 0xA5, 0x94,
+    0x79, 0x4F, 0x55, 0x18, 0xF7, 0xB0, 0x3B, 0xCC, 0xBF, 0x39, 0xF9, 0xCE, 0x9D, 0xF7, 0xEF, 0xFC,
+    0xDA, 0xBE, 0xF9, 0xEC, 0x76, 0x9F, 0x80, 0x1B, 0x76, 0xBD, 0x7D, 0x21, 0xDC, 0x44, 0xA4, 0xEC,
+    0x46, 0xFA, 0xD9, 0xB1, 0x37, 0x29, 0x68, 0x7A, 0xED, 0xCD, 0x56, 0xF8, 0x83, 0xBB, 0xE0, 0x76,
+    0x87, 0x18, 0x11, 0x21, 0x2C, 0x09, 0x0A, 0x1D, 0xF7, 0xF4, 0x2E, 0x75, 0x42, 0xEE, 0x7F, 0x1B,
+    0x3A, 0x01, 0x17, 0x7E, 0x82, 0x55, 0x81, 0x5D, 0xCF, 0x37, 0x01, 0xE9, 0xBD, 0x7C, 0x05, 0x29,
+    0x99, 0x27, 0x23, 0x5E, 0x88, 0x97, 0x8B, 0xDC, 0x6B, 0xD8, 0xA1, 0x39, 0x9C, 0x2B, 0x45, 0x31,
+    0x07, 0xB2, 0x16, 0xE0, 0xE5, 0x34, 0xD9, 0xCC, 0x92, 0x08, 0xB8, 0x7C, 0x49, 0x26, 0xA8, 0xE2,
+    0x6C, 0xF5, 0x7C, 0x74, 0x83, 0x70, 0x26, 0x6B, 0xB6, 0x05, 0x8D, 0x84, 0xB4, 0x98, 0x70, 0x6F,
+    0xD7, 0xFD, 0x82, 0xB0, 0xB3, 0xF7, 0x54, 0xBD, 0xBA, 0xAC, 0x7E, 0xB2, 0xBA, 0x0F, 0xB8, 0x55,
+    0x65, 0xCF, 0xA1, 0xF8, 0xE4, 0xB5, 0x61, 0x55, 0xA4, 0x58, 0x35, 0x22, 0xE4, 0xC3, 0x0A, 0x88,
+    0x28, 0x47, 0xD9, 0x67, 0x19, 0xB7, 0xEC, 0x01, 0xBB, 0x57, 0x36, 0xAD, 0xF1, 0xB7, 0xCD, 0x09,
+    0xA8, 0xDF, 0x32, 0xFE, 0xB6, 0xD1, 0xAB, 0xB4, 0x07, 0xED, 0x0D, 0xD4, 0x3C, 0xAA, 0x7C, 0x91,
+    0xEF, 0x8B, 0x5C, 0xEE, 0xF8, 0xB1, 0x86, 0x35, 0xCD, 0xA9, 0x4C, 0xD1, 0x95, 0x51, 0xAF, 0x62,
+    0x14, 0xBF, 0x6C, 0x54, 0x52, 0x30, 0x57, 0x41, 0x94, 0x0B, 0x58, 0xA0, 0x96, 0x5D, 0x51, 0x06,
+    0xB3, 0x6F, 0x84, 0x33, 0x06, 0x79, 0x0A, 0x22, 0x61, 0x21, 0xD2, 0x98, 0x92, 0xD3, 0x01, 0x4F,
+    0xC1, 0xC9, 0xF3, 0x60, 0x76, 0x25, 0xA8, 0xBD, 0xB6, 0xCB, 0x4A, 0x63, 0xC3, 0xEE, 0xE7, 0xB6,
+    0x7B, 0xDA, 0xCF, 0x87, 0xB8, 0xD7, 0xC0, 0x66, 0x26, 0x44, 0xDD, 0x92, 0x6F, 0xAE, 0x39, 0x1A,
+    0x3F, 0xFB, 0xE5, 0x17, 0x2E, 0xE5, 0x6B, 0xD9, 0x55, 0xBD, 0x4B, 0x4F, 0x56, 0x99, 0x5D, 0x51,
+    0xD7, 0x2C, 0xFE, 0xFF, 0x64, 0x63, 0x5D, 0x45, 0x4B, 0xED, 0x51, 0xE4, 0x93, 0x04, 0x0C, 0x64,
+    0x79, 0xAB, 0xBC, 0x76, 0x4B, 0xB9, 0xDA, 0x67, 0x34, 0x5D, 0x44, 0x23, 0xC0, 0x53, 0x33, 0xF0,
+    0x36, 0xCC, 0xFF, 0x40, 0xBB, 0x9E, 0x4D, 0x6D, 0x8C, 0x6B, 0xF3, 0xE0, 0x16, 0xF4, 0x10, 0x1C,
+    0x8F, 0xED, 0xD4, 0xB6, 0xBB, 0xBD, 0xE9, 0x85, 0xAD, 0xF0, 0x24, 0x9B, 0x96, 0x62, 0xD3, 0x54,
+    0x72, 0xD9, 0x78, 0x89, 0x20, 0x44, 0xD6, 0xC8, 0x2B, 0xDD, 0xE1, 0x2D, 0xC6, 0xF6, 0x1C, 0x59,
+    0xEE, 0x54, 0x6D, 0x13, 0x13, 0x37, 0x2C, 0x66, 0x9C, 0xB4, 0xB7, 0xF1, 0x93, 0xC3, 0xAB, 0x19,
+    0xF3, 0x6D, 0x8D, 0x19, 0x7E, 0xE3, 0x3B, 0xCF, 0x9B, 0x21, 0x2D, 0x65, 0xD8, 0x9E, 0xFF, 0x52,
+    0x9B, 0xB7, 0x75, 0x55, 0xDE, 0x31, 0x27, 0xFE, 0xB2, 0x16, 0x2F, 0x84, 0x44, 0x89, 0x42, 0xEB,
+    0x1F, 0xFE, 0x07, 0xF3, 0x95, 0xED, 0x8A, 0x8A, 0xB7, 0x5F, 0x13, 0x2F, 0xEE, 0x9C, 0x46, 0x0D,
+    0xA7, 0xD1, 0x35, 0x7E, 0xB2, 0xD9, 0x3D, 0xD1, 0xD0, 0xA2, 0xE6, 0x34, 0x72, 0xB9, 0x68, 0x95,
+    0xD8, 0xBA, 0x9D, 0x74, 0xE6, 0xB7, 0x7E, 0x37, 0xDB, 0x86, 0x4D, 0xFD, 0x7F, 0x69, 0x9C, 0x46,
+    0x0A, 0x89, 0x50, 0xD4, 0x67, 0xE6, 0x46, 0x3F, 0x37, 0x1E, 0x6F, 0x59, 0x83, 0x3D, 0x17, 0xDF,
+    0x4B, 0xC1, 0x77, 0x19, 0x36, 0xFD, 0x3B, 0x9E, 0x29, 0x4F, 0x8E, 0xF9, 0xFF, 0x15, 0x1B, 0x97,
+    0xB9, 0x3C, 0x99, 0xFC, 0x48, 0x63, 0x88, 0xA8, 0xB2, 0xE7, 0x35, 0x1C, 0x17, 0xAE, 0xD9, 0xBA,
+    0x72, 0x7C, 0xC6, 0x4F, 0xD9, 0x1A, 0x66, 0x6C, 0xD8, 0x5C, 0xAA, 0x64, 0xAA, 0x3B, 0xDA, 0xAB,
+    0x41, 0xC7, 0xEE, 0x90, 0xB3, 0x45, 0x17, 0x4C, 0x0C, 0x38, 0x96, 0x3D, 0x9F, 0x9D, 0x95, 0x18,
+    0x20, 0x82, 0xE7, 0x9F, 0x80, 0xD4, 0x2C, 0x80, 0x18, 0x7C, 0x70, 0xF9, 0xAC, 0x7C, 0xCB, 0xE3,
+    0xE9, 0x97, 0x20, 0x18, 0xB0, 0x60, 0xC9, 0xE0, 0x5E, 0x99, 0x91, 0xCA, 0x95, 0xC6, 0x26, 0x46,
+    0x9E, 0x71, 0xA4, 0x2B, 0xAF, 0x8D, 0xDF, 0x5E, 0x4E, 0x1D, 0xF5, 0xDF, 0xCA, 0xA7, 0xDB, 0xA9,
+    0xDA, 0x00, 0xCF, 0x3A, 0xE0, 0x1F, 0xA1, 0xB1, 0xE9, 0x33, 0x90, 0x31, 0x22, 0x23, 0xF7, 0x8F,
+    0xFF, 0xBE, 0xEE, 0xE9, 0x3C, 0xAD, 0xBC, 0x50, 0xE5, 0xCC, 0x08, 0xC1, 0x5C, 0xFB, 0x51, 0x75,
+    0xC5, 0x2C, 0x9C, 0x3C, 0xF9, 0x43, 0x39, 0x23, 0xFE, 0x75, 0xD5, 0x8B, 0x35, 0x3C, 0x2D, 0x01,
+    0x72, 0xF6, 0x71, 0xDA, 0x3C, 0x04, 0xB5, 0x70, 0xD4, 0x3E, 0x6E, 0xDC, 0xB5, 0xE4, 0xAC, 0x20,
+    0xBD, 0x34, 0xDE, 0xCE, 0xE1, 0x7B, 0x85, 0xEF, 0x49, 0xDD, 0x38, 0x37, 0x40, 0x1F, 0xCC, 0xEF,
+    0xC3, 0xA7, 0xF4, 0x9E, 0x5F, 0xFE, 0x2B, 0x39, 0xFF, 0x9A, 0xE0, 0x74, 0xC7, 0x7C, 0x55, 0x46,
+    0xE3, 0xA6, 0xD7, 0x10, 0xB3, 0x93, 0x06, 0xE6, 0x25, 0xF3, 0x2A, 0x6D, 0x54, 0xE0, 0xB9, 0x50,
+    0xF2, 0xAE, 0xCB, 0x9D, 0xBF, 0x6C, 0xB9, 0xCF, 0x5A, 0xF9, 0x85, 0x7C, 0x48, 0xFE, 0xE8, 0xD9,
+    0xB5, 0x97, 0xF7, 0xCE, 0x4B, 0x4F, 0x99, 0xC0, 0xDA, 0x9F, 0x96, 0x33, 0x18, 0x63, 0x06, 0xB4,
+    0x7A, 0x63, 0x32, 0x47, 0x10, 0x11, 0x83, 0xFF, 0x23, 0x5C, 0xB3, 0xFC, 0xBC, 0xBC, 0xFB, 0xBC,
+    0xF9, 0x9F, 0xC6, 0xA4, 0x9F, 0x31, 0x40, 0xD0, 0x17, 0xCC, 0xC3, 0xFF, 0x5D, 0x55, 0x01, 0x42,
+    0xB4, 0x82, 0xA4, 0xB5, 0x2C, 0xA1, 0xFC, 0x71, 0xA4, 0x34, 0xFF, 0xE5, 0x59, 0xE5, 0xF3, 0xDD,
+    0x3F, 0xC3, 0x4D, 0x3E, 0xC1, 0x5F, 0xA2, 0xEC, 0x17, 0x9C, 0xA1, 0xB1, 0x19, 0x18, 0x4E, 0xF5,
+    0x02, 0xF3, 0xB3, 0x6B, 0xE3, 0xE4, 0x9F, 0x85, 0xD4, 0x62, 0x7E, 0xF7, 0xD8, 0x45, 0xDF, 0x4E,
+    0x87, 0xFD, 0x30, 0xE0, 0xEA, 0xDD, 0xB7, 0xFB, 0x77, 0xE9, 0x57, 0x4F, 0xDE, 0xC6, 0x19, 0xDC,
+    0x29, 0xDE, 0x40, 0xCC, 0xFC, 0xE1, 0x09, 0x84, 0xC3, 0x3B, 0xB5, 0x39, 0xCB, 0xFE, 0x87, 0x0B,
+    0x93, 0x73, 0xCE, 0x7B, 0xC9, 0xC2, 0x2F, 0xCD, 0xEF, 0x09, 0x52, 0x4A, 0xEB, 0x62, 0x70, 0x30,
+    0x66, 0x7A, 0x98, 0xC3, 0x61, 0x7F, 0x69, 0x7A, 0xE3, 0x77, 0xB4, 0x03, 0xF9, 0xFB, 0xDD, 0x87,
+    0x44, 0xC6, 0x7F, 0xD2, 0xBB, 0x07, 0x77, 0x98, 0xEF, 0x8B, 0x77, 0x4B, 0xBC, 0x34, 0x0B, 0xAB,
+    0x32, 0xDF, 0xD6, 0xB3, 0x9E, 0xAF, 0x1E, 0x19, 0xDB, 0x9C, 0xE7, 0x97, 0xFA, 0x1C, 0x7D, 0xD2,
+    0x41, 0xF5, 0x97, 0xE0, 0x26, 0x9C, 0x4C, 0x3C, 0xC3, 0xCA, 0x6C, 0x74, 0x63, 0x85, 0xA5, 0x5D,
+    0xE8, 0xC0, 0xD0, 0x0B, 0x03, 0x86, 0x7E, 0xC7, 0x8A, 0x8A, 0x43, 0xB7, 0xD7, 0x86, 0x77, 0x2B,
+    0xD4, 0x5B, 0xFA, 0x39, 0xE7, 0x69, 0x2A, 0xF7, 0xB6, 0xA4, 0x3A, 0x19, 0x1F, 0x74, 0xA4, 0x39,
+    0x39, 0x57, 0x36, 0xD4, 0x1B, 0xDA, 0xC4, 0x3D, 0x42, 0x9F, 0x30, 0x24, 0x4C, 0x68, 0x26, 0xCF,
+    0x98, 0x3A, 0xD9, 0xEC, 0x30, 0x9D, 0x70, 0x87, 0xF9, 0x89, 0x3B, 0xD4, 0x22, 0x76, 0x18, 0xF9,
+    0xBC, 0x43, 0x93, 0xD4, 0x0E, 0x0D, 0x50, 0x3B, 0x4C, 0x48, 0x14, 0x28, 0xDC, 0x64, 0x87, 0xDA,
+    0x84, 0x40, 0x91, 0x57, 0x76, 0x28, 0x8A, 0x31, 0x59, 0x52, 0x20, 0x08, 0xDB, 0x0E, 0xF3, 0xFF,
+    0x76, 0x60, 0xA5, 0x34, 0xD9, 0x9B, 0x78, 0xA4, 0xD9, 0xBC, 0x1B, 0x8C, 0xC7, 0x9A, 0x53, 0xE3,
+    0x6B, 0xBE, 0xC8, 0x5A, 0x50, 0xBF, 0x7A, 0x1D, 0x54, 0x56, 0x79, 0x0E, 0x6B, 0xEB, 0x8A, 0x11,
+    0xCD, 0x6D, 0x5F, 0x53, 0x51, 0x9C, 0x16, 0x71, 0x11, 0x05, 0xE6, 0xF7, 0xB9, 0x23, 0xB3, 0xE9,
+    0xB9, 0xCD, 0x10, 0xFC, 0xD1, 0xE5, 0xF0, 0xB2, 0x09, 0xF0, 0x3E, 0x10, 0x10, 0xBE, 0x23, 0x20,
+    0xFA, 0x1A, 0xEC, 0x0A, 0xA1, 0x80, 0x7D, 0x01, 0x8E, 0x50, 0xA1, 0x11, 0x4C, 0xCE, 0xA3, 0xA0,
+    0x14, 0x00, 0x4E, 0x32, 0x82, 0x01, 0x62, 0x34, 0x05, 0x40, 0xB0, 0x24, 0x58, 0xE6, 0xBB, 0x22,
+    0x15, 0x87, 0xAD, 0x10, 0x6E, 0x5D, 0x7F, 0x4C, 0x42, 0x5E, 0xF4, 0x8F, 0xD1, 0x5D, 0xF9, 0x2D,
+    0x67, 0x7D, 0x99, 0x91, 0x75, 0x37, 0x27, 0xE2, 0x4C, 0xD6, 0xC0, 0xA9, 0x6E, 0xFE, 0xE5, 0xE4,
+    0x0E, 0x6C, 0x59, 0xE0, 0x9F, 0x88, 0x11, 0xAF, 0x45, 0x28, 0x85, 0x9A, 0x36, 0x67, 0x22, 0x16,
+    0xA3, 0xB5, 0x7A, 0xC0, 0xFF, 0xF2, 0x8B, 0xB0, 0xF6, 0x8E, 0x26, 0x5D, 0x85, 0x2B, 0x52, 0x0F,
+    0x4E, 0xDA, 0x63, 0xEE, 0x55, 0x82, 0x9B, 0x1F, 0xDD, 0xB0, 0xCC, 0x85, 0xE0, 0xCC, 0x18, 0x83,
+    0xE3, 0xE0, 0x08, 0xC9, 0x0B, 0xEB, 0x03, 0x8A, 0x66, 0x27, 0xFD, 0xA9, 0xC1, 0xCC, 0xFB, 0x68,
+    0x5C, 0x94, 0xAB, 0x11, 0x1C, 0x4B, 0xD9, 0x43, 0x1A, 0x2D, 0x9E, 0xFF, 0x01, 0x12, 0x5C, 0xF4,
+    0x48, 0x0F, 0x1A, 0xAF, 0x6A, 0x1B, 0xEF, 0x1F, 0xE5, 0x73, 0x66, 0xE9, 0xCF, 0x98, 0xE8, 0x32,
+    0xF9, 0xBE, 0x68, 0x7A, 0xDE, 0x4C, 0xCE, 0xAF, 0x1E, 0x98, 0xB2, 0x77, 0x46, 0xD4, 0x64, 0x72,
+    0xB1, 0xA8, 0xC9, 0x2F, 0x23, 0x6A, 0x72, 0x47, 0x4E, 0x2E, 0x63, 0x44, 0x4D, 0x86, 0xAB, 0xA8,
+    0x49, 0xE4, 0x84, 0x6D, 0x51, 0x6D, 0xBF, 0x0E, 0xF0, 0x85, 0xF3, 0xA2, 0x26, 0xDD, 0x37, 0x14,
+    0x51, 0xAB, 0xA3, 0x50, 0x3B, 0x50, 0x6D, 0x53, 0x24, 0x9F, 0x4C, 0x49, 0x9F, 0x8D, 0x00, 0x03,
+    0x1B, 0xED, 0x31, 0x1E, 0x3F, 0x54, 0x50, 0x82, 0xCB, 0x44, 0x92, 0xAE, 0xCF, 0x44, 0xB8, 0xC8,
+    0x5A, 0x98, 0x6F, 0x84, 0xBC, 0xFF, 0xFE, 0xD1, 0x24, 0xBF, 0xF8, 0x3A, 0x5A, 0x01, 0x79, 0xD4,
+    0x1E, 0x64, 0x95, 0xA3, 0xC9, 0x1D, 0xEC, 0x93, 0xE3, 0x47, 0x61, 0x83, 0x8E, 0xA0, 0x40, 0x9F,
+    0xF6, 0xFD, 0xEA, 0x3C, 0x79, 0x50, 0xDD, 0x00, 0x2E, 0x9A, 0xF5, 0xD8, 0x41, 0x79, 0x50, 0xCF,
+    0xE0, 0x84, 0x9E, 0x41, 0x25, 0x7A, 0xDD, 0x5A, 0x86, 0x74, 0x63, 0xD3, 0x68, 0x99, 0x39, 0x1B,
+    0x6C, 0x02, 0xAA, 0x08, 0x0A, 0xCA, 0x8D, 0xE4, 0x50, 0x21, 0x60, 0x30, 0x5A, 0x6B, 0x6A, 0x36,
+    0x0D, 0xBE, 0x8E, 0x46, 0x09, 0xEB, 0x31, 0x99, 0x9C, 0x11, 0x7A, 0xB6, 0xD0, 0xEF, 0x5F, 0x2E,
+    0xA0, 0xCB, 0xCF, 0x34, 0xE4, 0xC0, 0x5D, 0x0B, 0x41, 0x73, 0x98, 0xAB, 0xA0, 0x92, 0x1E, 0x0E,
+    0x77, 0xAE, 0x78, 0x0C, 0x66, 0xCE, 0xFD, 0xA2, 0xA4, 0xE0, 0x56, 0x2C, 0x7A, 0xCD, 0x87, 0x95,
+    0x7A, 0xD4, 0x6C, 0x4F, 0x0F, 0xE5, 0x08, 0xCF, 0xCC, 0xA3, 0x51, 0x1F, 0xDE, 0x7C, 0x38, 0x31,
+    0x72, 0xAD, 0xEC, 0xC3, 0xEA, 0x02, 0xF0, 0xE6, 0x70, 0x3A, 0x23, 0x9B, 0xB8, 0x33, 0xE2, 0xCC,
+    0x4C, 0x33, 0x52, 0x62, 0x9B, 0x8D, 0x32, 0x6B, 0x9F, 0xB0, 0x56, 0x9B, 0x03, 0xE5, 0x90, 0x07,
+    0x23, 0xAE, 0x7E, 0xB7, 0x19, 0x51, 0x06, 0xF6, 0xEB, 0x11, 0x8C, 0xDB, 0xEC, 0x47, 0xB3, 0x68,
+    0x46, 0xB6, 0x66, 0xD3, 0xC8, 0x66, 0xC9, 0x8C, 0x80, 0x28, 0x9F, 0x2E, 0xA8, 0x19, 0x86, 0x22,
+    0xE3, 0x3A, 0xBA, 0x93, 0xE4, 0x74, 0x55, 0xCD, 0x0A, 0xA5, 0xD2, 0xB6, 0xF6, 0x8A, 0xFF, 0x90,
+    0xAD, 0x83, 0x50, 0xC0, 0x19, 0xDD, 0x16, 0xE4, 0x04, 0x70, 0x8F, 0x79, 0x9A, 0xBB, 0x00, 0x4D,
+    0xFE, 0x40, 0x33, 0x12, 0x92, 0x3F, 0x82, 0x36, 0x6A, 0xC2, 0x9F, 0xFD, 0x86, 0x31, 0x0B, 0x1F,
+    0x7E, 0xA8, 0xD2, 0x04, 0xA5, 0x51, 0xF7, 0xE3, 0x8F, 0x99, 0xC0, 0xF4, 0xAB, 0x0F, 0x81, 0x84,
+    0xE8, 0x67, 0xDC, 0xB5, 0x89, 0xBA, 0x2C, 0x1B, 0x5A, 0x5E, 0x40, 0x65, 0x11, 0x63, 0x55, 0x79,
+    0xB5, 0x7B, 0xB8, 0xA5, 0xBE, 0xB6, 0xBA, 0x60, 0xF2, 0x68, 0x7D, 0x66, 0xA2, 0xEA, 0xE9, 0xCD,
+    0x60, 0x3A, 0x7B, 0x4A, 0xC5, 0x18, 0xAE, 0x72, 0xC6, 0x33, 0x95, 0x12, 0x7A, 0x05, 0x79, 0xD1,
+    0x0B, 0x9E, 0xF1, 0x6C, 0xCD, 0xF4, 0xFC, 0xD8, 0x12, 0x33, 0x88, 0xF9, 0x94, 0xC2, 0x1C, 0x65,
+    0x20, 0x1C, 0xF0, 0xFE, 0x42, 0xDF, 0xB8, 0xA2, 0x75, 0x8A, 0x72, 0x5B, 0x08, 0x81, 0x19, 0x55,
+    0x5A, 0x03, 0xA1, 0x52, 0x77, 0x5A, 0x83, 0x29, 0x6A, 0xA9, 0x03, 0x68, 0x36, 0x0D, 0xEE, 0xD5,
+    0x40, 0x86, 0xE2, 0x9A, 0x5C, 0xD2, 0x39, 0x8E, 0x50, 0x13, 0xA8, 0xDD, 0xA6, 0xC1, 0x3A, 0x6C,
+    0x5C, 0xBA, 0xD8, 0xBA, 0xA1, 0x24, 0x42, 0x38, 0x1B, 0xAA, 0x21, 0x2C, 0xDF, 0xC2, 0x8D, 0xB4,
+    0xC8, 0xC3, 0x83, 0x69, 0xC5, 0xD6, 0x48, 0x13, 0x84, 0xA1, 0x2F, 0x33, 0x77, 0x00, 0xCF, 0x06,
+    0x11, 0x40, 0x26, 0x61, 0x95, 0x0F, 0x86, 0x74, 0x26, 0xBD, 0x2E, 0x93, 0xD0, 0x80, 0xC9, 0x74,
+    0x7A, 0x6C, 0x23, 0xC6, 0x65, 0x22, 0x64, 0x48, 0x5D, 0xEA, 0x89, 0x89, 0xDE, 0x85, 0x46, 0x0A,
+    0x6F, 0xBB, 0x26, 0xD0, 0xC5, 0xE7, 0x82, 0x33, 0xF0, 0xF2, 0x12, 0xF0, 0xF2, 0x12, 0xF0, 0xF2,
+    0x12, 0xF0, 0x12, 0x03, 0x2F, 0x78, 0x6A, 0x4D, 0x32, 0xE0, 0x85, 0x09, 0x6A, 0xCB, 0x01, 0x2F,
+    0xFC, 0x02, 0xA6, 0xAD, 0x26, 0x06, 0x5E, 0x5E, 0x02, 0x5E, 0x5E, 0x02, 0x5E, 0x3E, 0xB3, 0x86,
+    0x17, 0xD2, 0xC0, 0x8C, 0x21, 0x0F, 0x25, 0x26, 0x9D, 0x7C, 0x36, 0xAC, 0x92, 0x28, 0xCE, 0x93,
+    0xE8, 0xC0, 0x24, 0xA2, 0xD0, 0x25, 0xA2, 0x17, 0x27, 0x82, 0x61, 0xCC, 0x36, 0xE9, 0x34, 0x52,
+    0x1C, 0x53, 0x4D, 0x22, 0x41, 0x4D, 0x34, 0x97, 0x43, 0xD4, 0xED, 0x28, 0x93, 0x23, 0x2A, 0x93,
+    0xCF, 0x22, 0xEA, 0xCB, 0x6D, 0x20, 0xFD, 0x40, 0xE9, 0xC6, 0xE0, 0x29, 0xAA, 0xC8, 0x3A, 0xAC,
+    0x64, 0xFF, 0x0B, 0x94, 0x9E, 0xBE, 0xB5, 0x04, 0x23, 0x96, 0xCF, 0x0F, 0x00, 0x59, 0x22, 0xAF,
+    0x56, 0x06, 0x0A, 0xE4, 0x79, 0x7D, 0x29, 0x88, 0x74, 0x78, 0x4F, 0xF3, 0x1D, 0xF7, 0xB6, 0x40,
+    0xD7, 0x66, 0x1F, 0x13, 0x66, 0x84, 0xB1, 0x5A, 0xDF, 0x67, 0xB4, 0x18, 0x68, 0xE6, 0x3A, 0xEF,
+    0x6B, 0x96, 0x84, 0xD9, 0x71, 0xA9, 0xE8, 0x9F, 0x7F, 0x34, 0xB6, 0x86, 0xEB, 0xE2, 0x84, 0x34,
+    0xC6, 0xC4, 0xF0, 0xD6, 0x30, 0x71, 0x09, 0xBE, 0x77, 0x16, 0x66, 0x31, 0x88, 0xCF, 0xB7, 0x35,
+    0x09, 0x3E, 0xAC, 0xAD, 0xFA, 0xE7, 0x81, 0x76, 0x78, 0x1F, 0x52, 0xA2, 0x6A, 0x19, 0xE8, 0x90,
+    0xEA, 0x14, 0x48, 0x31, 0x38, 0x31, 0x50, 0x0B, 0x1D, 0x60, 0xC1, 0xE0, 0x36, 0x98, 0x81, 0xC2,
+    0x0A, 0xEF, 0x13, 0xD6, 0x93, 0x59, 0x1A, 0x5B, 0x3D, 0x86, 0xB5, 0x5D, 0x04, 0xC6, 0xAC, 0x1C,
+    0xC3, 0xA0, 0xB1, 0xEF, 0x52, 0x6C, 0xFF, 0x73, 0x12, 0xA6, 0xBF, 0xA0, 0x72, 0x4D, 0xBB, 0x58,
+    0xC4, 0xFA, 0x4A, 0xD1, 0x5F, 0xD0, 0x0C, 0xF1, 0x3D, 0x86, 0xE9, 0xE7, 0x4B, 0xC2, 0x8C, 0xBE,
+    0x6E, 0x78, 0x97, 0xB4, 0x12, 0x8D, 0xF4, 0xAC, 0xE6, 0x39, 0xAD, 0x05, 0x13, 0xD3, 0xF4, 0x16,
+    0xB2, 0x5E, 0x8C, 0xB7, 0xC8, 0x3A, 0x98, 0xAA, 0x04, 0xCA, 0x28, 0x5F, 0xDC, 0x2B, 0x7D, 0x16,
+    0xB4, 0xD3, 0xF8, 0x4B, 0xC6, 0x6B, 0xB0, 0xA2, 0x44, 0xF0, 0x33, 0xD6, 0x6C, 0xFA, 0x1B, 0x66,
+    0x7A, 0x7E, 0x90, 0x13, 0x32, 0xCD, 0xE1, 0xAF, 0x19, 0x92, 0xFA, 0x53, 0xEA, 0x60, 0xAC, 0x2B,
+    0x11, 0x20, 0x65, 0x06, 0x3D, 0x20, 0x94, 0x8E, 0x9E, 0xFF, 0x00, 0xE1, 0x65, 0x80, 0x09, 0x83,
+    0x6A, 0xE6, 0xF4, 0x7B, 0x3E, 0x3C, 0x44, 0x69, 0x0D, 0x0D, 0x9C, 0xE8, 0xE1, 0xA3, 0xF4, 0xB3,
+    0xC4, 0x66, 0x72, 0x59, 0x21, 0xC8, 0xBD, 0x48, 0x9A, 0x7A, 0x9F, 0xAC, 0x3E, 0xB2, 0xD1, 0xE8,
+    0xF1, 0x39, 0x60, 0x3C, 0xDE, 0x46, 0xB8, 0x79, 0x67, 0xC1, 0x79, 0x27, 0xBF, 0x0E, 0xD0, 0x10,
+    0x3C, 0x98, 0x02, 0x11, 0x6D, 0xDD, 0x92, 0x43, 0xEE, 0x56, 0xF0, 0xD3, 0x44, 0xDB, 0x26, 0x04,
+    0x32, 0x3A, 0x1A, 0x1E, 0x15, 0x4E, 0xDE, 0x58, 0xD5, 0x89, 0x39, 0x06, 0x81, 0x13, 0x86, 0x0C,
+    0x0C, 0xF0, 0xAC, 0x33, 0xCF, 0x80, 0xB6, 0xD8, 0x9E, 0xE9, 0xCB, 0x0A, 0xF4, 0x6D, 0x63, 0x9F,
+    0xCD, 0x27, 0x69, 0x35, 0x9E, 0x16, 0x2D, 0x0B, 0xFD, 0x05, 0x47, 0x7B, 0x9D, 0xFD, 0x3E, 0x2B,
+    0xB5, 0x0D, 0x67, 0xDA, 0xFA, 0xB5, 0xB6, 0xDE, 0x5C, 0x5B, 0x77, 0xA1, 0x2D, 0x15, 0x1A, 0x06,
+    0x49, 0x9E, 0xDE, 0xF6, 0xAE, 0x90, 0xC1, 0x25, 0x62, 0x4D, 0x75, 0x9E, 0x75, 0x11, 0x05, 0x56,
+    0x20, 0xD0, 0xF0, 0xA9, 0x17, 0x5E, 0x51, 0xD3, 0x7F, 0x64, 0xC3, 0xD0, 0xA2, 0xDE, 0xB7, 0x76,
+    0x45, 0x53, 0xCD, 0xCC, 0xAA, 0x41, 0xB0, 0xC6, 0x83, 0x43, 0x76, 0x6F, 0xB0, 0x81, 0x46, 0xCC,
+    0x86, 0xEA, 0xCC, 0xC1, 0xBF, 0xE9, 0x6C, 0x8A, 0x4D, 0x9E, 0x68, 0xA1, 0x35, 0x0D, 0xD2, 0xD5,
+    0x38, 0x5E, 0xDA, 0x91, 0x87, 0x66, 0x88, 0xE3, 0x5D, 0x97, 0xB6, 0x6C, 0xA3, 0x3B, 0xC3, 0xEA,
+    0xE5, 0x2A, 0x03, 0xBB, 0xF7, 0x69, 0x8C, 0xA7, 0x80, 0x02, 0x23, 0xC7, 0xB1, 0x4A, 0x7A, 0x82,
+    0xE8, 0xDA, 0x58, 0x05, 0xDD, 0xEB, 0x7E, 0x78, 0xA7, 0xF7, 0x25, 0x0A, 0xA1, 0x12, 0x4D, 0x1E,
+    0xD9, 0x6B, 0xB4, 0x3B, 0x0B, 0x35, 0xCE, 0x40, 0x97, 0x72, 0x24, 0x3F, 0x20, 0x78, 0x01, 0xB1,
+    0x28, 0x30, 0x37, 0xF8, 0x33, 0x78, 0xAC, 0xF0, 0x28, 0x90, 0xA9, 0xAA, 0xB0, 0xE5, 0x27, 0x53,
+    0x7E, 0xBB, 0xCB, 0x33, 0x13, 0x5E, 0x95, 0x08, 0xE1, 0x83, 0x83, 0x5D, 0xFA, 0x91, 0xBB, 0x38,
+    0x22, 0x22, 0xB8, 0xDD, 0x5D, 0x1B, 0xE6, 0x70, 0x78, 0x83, 0x21, 0x42, 0x0B, 0x98, 0x10, 0x54,
+    0x6C, 0xEE, 0x8D, 0x54, 0x31, 0xAC, 0xF2, 0xD8, 0x5C, 0xBE, 0x9C, 0xA3, 0x12, 0xBE, 0xD0, 0xCE,
+    0x2E, 0x8D, 0xD3, 0x08, 0x2E, 0xF5, 0xE4, 0xCF, 0x05, 0x1F, 0x19, 0x04, 0xF3, 0x29, 0xA4, 0xF2,
+    0xA9, 0x59, 0xD8, 0x77, 0xBB, 0xCE, 0x5C, 0xF6, 0x35, 0xF8, 0x43, 0xF2, 0xC7, 0x42, 0xF7, 0xA3,
+    0xBF, 0x2D, 0xBD, 0xC3, 0xB0, 0x83, 0x45, 0xB5, 0xFB, 0x6F, 0x36, 0x0A, 0x72, 0x2B, 0x68, 0xD6,
+    0x4A, 0xCC, 0xC4, 0x7D, 0x89, 0x19, 0xEF, 0xA1, 0x4B, 0xCC, 0x9C, 0x6A, 0x49, 0x4E, 0x4F, 0xB3,
+    0x24, 0xDF, 0xBD, 0xA5, 0x49, 0xE6, 0xB6, 0xC4, 0xCC, 0x0E, 0x63, 0x61, 0x06, 0xAB, 0x9B, 0x5F,
+    0xF6, 0xB6, 0x95, 0x3D, 0xCD, 0xBC, 0x37, 0x66, 0x30, 0x56, 0x46, 0xCC, 0x01, 0x9C, 0x79, 0xCB,
+    0xAF, 0x57, 0x17, 0xB5, 0x24, 0x53, 0x34, 0x64, 0x1E, 0xC5, 0xA5, 0x99, 0xA3, 0xE9, 0xFB, 0x95,
+    0x9A, 0x40, 0xB0, 0xD4, 0x5F, 0x83, 0xA6, 0xAE, 0xC7, 0xE7, 0x1A, 0xAD, 0xF3, 0xEA, 0x9C, 0xAC,
+    0x78, 0xE3, 0x5C, 0xD0, 0xD6, 0xFD, 0x08, 0x60, 0x79, 0xC7, 0x96, 0x76, 0xD4, 0xFA, 0x8E, 0xFE,
+    0xB9, 0x40, 0x86, 0x86, 0xD4, 0x45, 0x1C, 0x2F, 0x32, 0x75, 0xB1, 0x32, 0x0F, 0x77, 0xDC, 0xC7,
+    0x5A, 0xD7, 0xE3, 0x4C, 0xA4, 0x71, 0x97, 0x3A, 0x8B, 0xCC, 0xCA, 0x0B, 0x58, 0xB4, 0xEA, 0x8D,
+    0xA1, 0x6A, 0x81, 0xB4, 0x23, 0x9C, 0xC0, 0x88, 0xD5, 0x03, 0x4A, 0x91, 0xE4, 0xE4, 0xE0, 0xFF,
+    0x21, 0x18, 0xB0, 0xDF, 0xF5, 0xFE, 0x54, 0xE7, 0x61, 0x0B, 0xFE, 0xEC, 0x9F, 0x16, 0x03, 0x9E,
+    0xF7, 0x25, 0xC7, 0x82, 0x4A, 0x28, 0xBC, 0x8D, 0x01, 0x67, 0xA5, 0xC5, 0x21, 0x06, 0x7C, 0x0A,
+    0xDF, 0xEF, 0x08, 0x82, 0x69, 0x72, 0x4A, 0x48, 0xC0, 0xC3, 0xE8, 0xFF, 0x8F, 0x71, 0xE6, 0xCE,
+    0xB8, 0xBD, 0x41, 0xB3, 0x94, 0x02, 0xF9, 0xEF, 0xF8, 0x31, 0xCC, 0xBC, 0x7E, 0xD8, 0x99, 0x07,
+    0xE0, 0xAC, 0x04, 0xE7, 0xCF, 0x9C, 0x05, 0x82, 0x7A, 0x31, 0xB5, 0x32, 0x94, 0x11, 0x31, 0x04,
+    0xB7, 0x37, 0xD4, 0xA2, 0xEB, 0x8C, 0x6B, 0x96, 0x75, 0x82, 0xB4, 0x14, 0x90, 0x56, 0x0A, 0xB2,
+    0x2A, 0x83, 0xAA, 0x7B, 0xFA, 0x9E, 0xD5, 0x82, 0x4C, 0xF8, 0x0E, 0x29, 0x15, 0xCF, 0x67, 0xC1,
+    0x20, 0x0D, 0x6F, 0x66, 0xC9, 0x20, 0x9B, 0x63, 0x1F, 0x54, 0xB6, 0xE4, 0x49, 0x70, 0x84, 0xB9,
+    0xCB, 0x75, 0x07, 0xD6, 0x92, 0xDE, 0xBB, 0xF4, 0xCF, 0x87, 0x97, 0x18, 0xA8, 0x9D, 0x4A, 0x1F,
+    0x07, 0xAA, 0x9A, 0xB9, 0x0B, 0xA6, 0x9C, 0xC1, 0xF0, 0x9E, 0x51, 0x1D, 0x64, 0xDA, 0x28, 0x8B,
+    0x3F, 0x0C, 0x69, 0x01, 0xFC, 0x6F, 0x02, 0x6F, 0xD2, 0x01, 0xE3, 0x4A, 0x20, 0x0C, 0xCF, 0x65,
+    0x7C, 0x72, 0xD1, 0x72, 0x0B, 0x49, 0xF5, 0x78, 0xFC, 0xF1, 0x83, 0x97, 0x8C, 0x56, 0x1D, 0x9B,
+    0xB1, 0x9E, 0xE7, 0x5A, 0xC3, 0x2F, 0x9F, 0x62, 0xC3, 0x32, 0x95, 0x5C, 0x76, 0x76, 0xF5, 0xF5,
+    0x01, 0x30, 0xC9, 0x85, 0x9B, 0x4B, 0x88, 0x3D, 0x08, 0x73, 0xC2, 0x52, 0x68, 0xCD, 0x9B, 0xC7,
+    0x6A, 0x66, 0x7E, 0x22, 0xF8, 0xEE, 0x78, 0xFB, 0x17, 0x2C, 0xF4, 0xB7, 0xB4, 0x70, 0xE5, 0x1A,
+    0x3F, 0x1F, 0xA2, 0x61, 0x29, 0x88, 0x47, 0x81, 0x99, 0x55, 0x9E, 0x08, 0x2B, 0xA7, 0xA8, 0x79,
+    0xF3, 0x1A, 0x08, 0xFA, 0xB5, 0x20, 0xEE, 0x9B, 0x3F, 0xF2, 0xD6, 0x2C, 0xFC, 0x67, 0xC2, 0xA3,
+    0xBC, 0xF7, 0xAD, 0x59, 0x78, 0xA1, 0x9A, 0x3F, 0x97, 0xB4, 0x32, 0xD2, 0xF4, 0x5C, 0xB0, 0x0B,
+    0x90, 0x21, 0x92, 0x3F, 0x79, 0x77, 0x1B, 0xA8, 0x59, 0xEE, 0xCA, 0x6E, 0x9A, 0xED, 0x0E, 0xF3,
+    0x5F, 0x81, 0x6C, 0xAB, 0xF7, 0x48, 0x64, 0x67, 0xA5, 0x20, 0xAF, 0x80, 0x45, 0xDB, 0x83, 0xC0,
+    0xAB, 0x00, 0x73, 0x0B, 0x32, 0x80, 0x84, 0xA0, 0x9A, 0x6F, 0xD7, 0xC4, 0x94, 0x20, 0xEA, 0xB7,
+    0xB5, 0x79, 0xFE, 0x10, 0x98, 0x98, 0x9F, 0x02, 0x5E, 0x3D, 0xB1, 0x45, 0x76, 0xB4, 0x7A, 0xCF,
+    0xE6, 0xE1, 0xE7, 0x3C, 0x76, 0xE4, 0xC8, 0xFC, 0x3F, 0x6B, 0x93, 0x5F, 0x7E, 0xD0, 0x8A, 0x5C,
+    0x39, 0x75, 0x51, 0x00, 0x28, 0xC8, 0x45, 0xC4, 0xEB, 0x8F, 0x74, 0x28, 0x14, 0xB4, 0x7F, 0x61,
+    0x1E, 0xF2, 0xEF, 0x52, 0xD3, 0x6E, 0xDB, 0x00, 0xF6, 0xB4, 0x83, 0xA1, 0x67, 0xD9, 0x9B, 0x4A,
+    0x21, 0x31, 0xFB, 0x0F, 0x07, 0x9E, 0x3B, 0x87, 0x4D, 0xF2, 0x08, 0xBA, 0x7C, 0x94, 0x75, 0xF3,
+    0xE4, 0xF0, 0x66, 0x93, 0x54, 0xA6, 0x15, 0x51, 0x71, 0x37, 0x51, 0xAB, 0xCB, 0x43, 0x1D, 0xEB,
+    0x25, 0xF7, 0x73, 0xAD, 0x72, 0x4B, 0x83, 0xD7, 0xD1, 0xBD, 0x56, 0xFD, 0xC0, 0x85, 0xA6, 0x82,
+    0xC5, 0x25, 0x05, 0x75, 0x25, 0xCE, 0x32, 0xA3, 0x6B, 0x3E, 0xAD, 0x0E, 0x23, 0xF0, 0x03, 0x69,
+    0x42, 0x5A, 0x22, 0x92, 0xEF, 0xBF, 0x3B, 0x1E, 0xDF, 0x9C, 0x47, 0xDC, 0xF7, 0x73, 0x5F, 0x1B,
+    0xAD, 0x85, 0x34, 0x48, 0xC5, 0x6A, 0x49, 0xED, 0x8B, 0xAF, 0xDA, 0x68, 0x30, 0x1B, 0x07, 0xE7,
+    0xB4, 0x2B, 0xF7, 0x33, 0x64, 0xAB, 0xC3, 0xF1, 0x1E, 0x2B, 0x2D, 0x76, 0xB6, 0xD0, 0x15, 0xB7,
+    0xAB, 0x73, 0x63, 0x2D, 0x90, 0x87, 0xC2, 0xB5, 0xA6, 0x14, 0xB7, 0x37, 0x89, 0x6A, 0x61, 0x05,
+    0xD7, 0x59, 0xFE, 0xE7, 0x3A, 0x62, 0x69, 0xCC, 0x75, 0xD2, 0xE8, 0xA4, 0x78, 0x7F, 0x52, 0xA4,
+    0x1C, 0x57, 0xEA, 0x14, 0x93, 0xC9, 0x24, 0xB5, 0x0E, 0x33, 0x4D, 0xD0, 0x51, 0x7A, 0xAE, 0x03,
+    0x54, 0xF5, 0xC3, 0x5B, 0xBE, 0xFC, 0x6D, 0x63, 0x4B, 0x2A, 0xC9, 0x5D, 0x16, 0xBD, 0x7F, 0xFB,
+    0x18, 0xB6, 0x82, 0x01, 0x5B, 0xCB, 0x01, 0x5B, 0x8E, 0x62, 0xCB, 0x5B, 0x61, 0xCB, 0x9F, 0x5D,
+    0x0B, 0x14, 0x5B, 0xE1, 0xA7, 0x89, 0xAD, 0xC3, 0x35, 0xAD, 0xEA, 0x22, 0x16, 0xD8, 0xAD, 0xE3,
+    0x78, 0x2D, 0x3E, 0x15, 0xBC, 0x5A, 0x3D, 0x70, 0x71, 0x2E, 0x54, 0x8C, 0x17, 0x5D, 0xE9, 0x1F,
+    0x3E, 0xEA, 0xAF, 0x12, 0xC0, 0xCC, 0x56, 0xDA, 0x62, 0x69, 0xBD, 0x1F, 0x39, 0xB6, 0x48, 0x4E,
+    0x6C, 0x4C, 0x9E, 0xC5, 0x68, 0x37, 0x37, 0xA7, 0x06, 0x19, 0xFD, 0xD3, 0x2E, 0x76, 0xAC, 0xA9,
+    0x90, 0x36, 0x19, 0xD2, 0xA6, 0x43, 0xDA, 0x84, 0xC8, 0xE3, 0x29, 0x91, 0x76, 0xC2, 0x4F, 0xB3,
+    0x04, 0x52, 0x6F, 0xE5, 0x2D, 0x36, 0xAC, 0xDF, 0x4C, 0x1A, 0xA1, 0xF5, 0xBB, 0xB5, 0xC5, 0x7F,
+    0xAD, 0xF5, 0x3B, 0xB7, 0xF1, 0x8D, 0xCB, 0xE5, 0x9B, 0xAB, 0x04, 0x37, 0x9C, 0xE5, 0xD3, 0x7E,
+    0x91, 0xAD, 0xFC, 0x56, 0xAB, 0x02, 0xAA, 0x73, 0x9A, 0x6E, 0x8E, 0x81, 0x53, 0x4A, 0xB1, 0x31,
+    0x82, 0xA7, 0x34, 0x5F, 0xB9, 0x09, 0x03, 0x6F, 0xC7, 0x7C, 0x8F, 0x4A, 0x03, 0x6E, 0x10, 0x78,
+    0x35, 0x62, 0x00, 0x16, 0x7C, 0x46, 0x07, 0x66, 0x24, 0xB3, 0x19, 0x09, 0x5E, 0x46, 0x82, 0xF1,
+    0x11, 0xF2, 0x43, 0x98, 0x4A, 0xD1, 0xA5, 0xC9, 0x0F, 0x8A, 0x99, 0x9C, 0x27, 0xE7, 0xBA, 0xCD,
+    0x88, 0xA5, 0x35, 0xCC, 0x14, 0x49, 0x9F, 0xF0, 0x4B, 0xE9, 0xAF, 0x48, 0x30, 0xEB, 0x78, 0xAA,
+    0xDC, 0xC4, 0xFE, 0x2E, 0xCA, 0x5F, 0x6D, 0xCF, 0x58, 0xDC, 0x2F, 0x6E, 0x7B, 0x2D, 0x19, 0xC6,
+    0x19, 0x6F, 0x1D, 0xCE, 0xB0, 0xD1, 0x14, 0xFA, 0xD5, 0x0A, 0x06, 0x7D, 0x4D, 0xF1, 0xE3, 0x70,
+    0x3D, 0xC3, 0x50, 0x5F, 0x27, 0x8C, 0x4B, 0x54, 0x05, 0x30, 0x12, 0xCD, 0xDA, 0xEA, 0xE1, 0x1F,
+    0x23, 0xFC, 0xF0, 0x1F, 0xB0, 0x4E, 0xE3, 0x16, 0x7B, 0x28, 0x6E, 0xAE, 0x0C, 0xBB, 0x93, 0x4E,
+    0x7E, 0xCB, 0xF0, 0x95, 0x98, 0x28, 0xBD, 0x52, 0xE2, 0x75, 0x89, 0xB9, 0x2B, 0x16, 0xC4, 0x48,
+    0xEA, 0x8E, 0xF5, 0xCE, 0xBC, 0x65, 0x0F, 0x46, 0x7A, 0x6F, 0x01, 0x3B, 0x00, 0xFB, 0x43, 0x99,
+    0x0C, 0x00, 0xC7, 0x06, 0xE1, 0x89, 0xB0, 0x2D, 0x73, 0x7D, 0x1D, 0x38, 0x41, 0xAD, 0x68, 0x35,
+    0x14, 0x2E, 0x7A, 0x9F, 0x8D, 0xB3, 0x19, 0x66, 0x60, 0x6D, 0x32, 0x7D, 0xC1, 0x62, 0xF7, 0xC2,
+    0x80, 0xE6, 0xC1, 0xCE, 0xD6, 0xC8, 0xEF, 0x1E, 0xEE, 0xDA, 0x33, 0xD6, 0x91, 0x5F, 0xF7, 0xE8,
+    0x48, 0x4A, 0x2D, 0x8F, 0xC1, 0x75, 0x14, 0x53, 0xF1, 0xE6, 0x3A, 0xBA, 0x88, 0x29, 0x35, 0xBB,
+    0xA8, 0x29, 0x75, 0x0D, 0x6C, 0xD4, 0x24, 0x49, 0x06, 0xEB, 0x88, 0x2C, 0xA9, 0xCF, 0xDF, 0xE2,
+    0x0F, 0x70, 0xAC, 0xD7, 0xFD, 0x7E, 0x06, 0x6C, 0xD1, 0x77, 0xD6, 0x6C, 0xD1, 0xEB, 0xB2, 0xEC,
+    0x5A, 0x6A, 0x6D, 0xB2, 0x26, 0x96, 0xB7, 0x36, 0xF4, 0xED, 0xC9, 0xDA, 0xA2, 0x1F, 0xB0, 0xC4,
+    0x2E, 0x24, 0xE3, 0x6E, 0x80, 0xCC, 0xA6, 0x7E, 0x42, 0xC6, 0x15, 0x75, 0xA0, 0x97, 0x71, 0x45,
+    0x19, 0xB0, 0xBA, 0xC0, 0x99, 0xE0, 0x5B, 0x34, 0x17, 0x0E, 0x60, 0xDF, 0x9C, 0x07, 0xAE, 0x50,
+    0xF6, 0x9F, 0x9E, 0x71, 0x40, 0xE8, 0x87, 0xCC, 0x0F, 0x91, 0x1F, 0x12, 0xBF, 0x15, 0xF8, 0xD7,
+    0x8E, 0x4B, 0x07, 0xAA, 0xB0, 0xF2, 0x28, 0x4F, 0x3F, 0xFA, 0x12, 0xE5, 0x46, 0x1D, 0x53, 0x46,
+    0x8B, 0x94, 0x1B, 0xAD, 0x52, 0x6E, 0xB4, 0x4C, 0xB9, 0xD1, 0x3A, 0xE5, 0x46, 0x0B, 0x95, 0x1B,
+    0xAD, 0x54, 0x6E, 0xB4, 0x54, 0xB9, 0xD1, 0x5A, 0xE5, 0x46, 0x8B, 0x95, 0x1B, 0xAD, 0x56, 0x6E,
+    0xB4, 0x5C, 0xB9, 0x50, 0xF8, 0x99, 0x5F, 0x32, 0xE9, 0x14, 0x26, 0xD9, 0xC6, 0x99, 0x87, 0x29,
+    0x4B, 0x4E, 0xC6, 0x4C, 0x72, 0x40, 0xCD, 0x72, 0xA3, 0x45, 0xCB, 0x8D, 0x56, 0x2D, 0x37, 0x5A,
+    0xB6, 0x5C, 0xAB, 0x5F, 0x26, 0x6F, 0xD9, 0xC2, 0xE5, 0x5A, 0xB9, 0x7C, 0xD1, 0xC7, 0x80, 0xAD,
+    0x88, 0xD5, 0x31, 0x2B, 0xAE, 0x15, 0xB6, 0x94, 0x2F, 0x8A, 0xE2, 0x04, 0xEB, 0x61, 0x87, 0xF0,
+    0x19, 0xD4, 0x66, 0x9C, 0x61, 0x72, 0x09, 0x74, 0x36, 0x33, 0x9A, 0x9B, 0xE0, 0x03, 0x73, 0x5D,
+    0x7A, 0xDF, 0x33, 0xD7, 0x5F, 0x33, 0xD1, 0xB6, 0xB9, 0x2E, 0x23, 0x89, 0x45, 0x26, 0xE2, 0x2B,
+    0x4C, 0xF7, 0x01, 0xCB, 0x85, 0x40, 0xFF, 0x27, 0xB5, 0x40, 0xEF, 0x57, 0x80, 0xEE, 0x6F, 0x2B,
+    0x81, 0x4E, 0x57, 0x0A, 0x34, 0x5D, 0x1E, 0xDF, 0xB8, 0x2E, 0x7B, 0x31, 0x6E, 0x10, 0x4B, 0x13,
+    0x2F, 0x56, 0x63, 0x5B, 0xA7, 0xA3, 0xCA, 0xA9, 0xD5, 0xAC, 0x6C, 0x25, 0xC2, 0xC7, 0x2D, 0x07,
+    0xC5, 0x5A, 0x6E, 0x28, 0x67, 0xB5, 0xEA, 0xD3, 0x7F, 0xEE, 0xE5, 0x59, 0xFB, 0x09, 0x13, 0x08,
+    0x32, 0xCE, 0xDC, 0xD3, 0x2A, 0x84, 0x90, 0x5F, 0xD6, 0x85, 0x97, 0xAC, 0x4B, 0x7D, 0xD8, 0x69,
+    0xEF, 0x5F, 0x9D, 0x3B, 0xEA, 0x5B, 0x58, 0x05, 0x09, 0x5D, 0xBE, 0xA7, 0xB5, 0x3C, 0x8F, 0xD6,
+    0x6B, 0x79, 0x6A, 0x3D, 0x4F, 0x91, 0x3A, 0x6C, 0x2D, 0xCF, 0xF6, 0x35, 0xD6, 0xF2, 0x84, 0x02,
+    0xE6, 0xD0, 0xFA, 0xCB, 0xF2, 0xC8, 0x36, 0xD3, 0x26, 0xC8, 0xBF, 0x73, 0x46, 0xE8, 0xE8, 0x33,
+    0x85, 0x21, 0xF3, 0x05, 0x47, 0x36, 0x15, 0x6A, 0x9F, 0xCA, 0xFB, 0x79, 0xB0, 0x19, 0xDD, 0xFB,
+    0x38, 0x31, 0xA4, 0x66, 0xA8, 0x54, 0x85, 0x59, 0xEB, 0x94, 0x66, 0x4B, 0x35, 0x76, 0xA8, 0xB2,
+    0x6F, 0xA3, 0x87, 0x8C, 0xFD, 0x69, 0x87, 0x21, 0xD7, 0xCB, 0x5A, 0xE5, 0x8C, 0x35, 0x6D, 0x92,
+    0x0D, 0x2C, 0x27, 0x13, 0x2E, 0x7F, 0xEA, 0x08, 0x41, 0xA5, 0xAD, 0xFE, 0x1A, 0x4A, 0x5F, 0x3E,
+    0x81, 0x3E, 0x1F, 0xB6, 0xD9, 0x64, 0xD2, 0xEB, 0xE0, 0x8D, 0x35, 0x6C, 0x37, 0x66, 0xC8, 0x4A,
+    0x27, 0xDF, 0x6D, 0xEC, 0xCE, 0x46, 0xBF, 0xC0, 0x1A, 0x89, 0x7F, 0xDA, 0x67, 0x32, 0xA9, 0x26,
+    0x55, 0xB4, 0x08, 0xF4, 0x17, 0x32, 0xFC, 0xD7, 0x72, 0xB3, 0xE0, 0xBD, 0xDB, 0x1F, 0x54, 0x59,
+    0xEE, 0x60, 0xAB, 0x03, 0xD9, 0xAE, 0xD6, 0xD5, 0x50, 0x8F, 0xB5, 0x6D, 0xBE, 0x78, 0x6F, 0x39,
+    0xB9, 0x57, 0xBB, 0x9A, 0xD7, 0x18, 0x1E, 0xBD, 0x22, 0x9D, 0xBF, 0x91, 0xE4, 0xB4, 0x51, 0x66,
+    0xAA, 0xD1, 0xEC, 0xEA, 0x2F, 0x0E, 0xEE, 0xAA, 0x59, 0x36, 0x93, 0xBD, 0x95, 0xF2, 0x77, 0x09,
+    0x6E, 0xBF, 0xF7, 0xC5, 0x2A, 0x62, 0x8D, 0xA9, 0x4A, 0xB0, 0xC8, 0x38, 0xA5, 0xE7, 0x86, 0x1F,
+    0x84, 0x43, 0xB8, 0x7E, 0xC0, 0x92, 0x02, 0xC8, 0x8E, 0x9D, 0xAF, 0x69, 0x9B, 0x4F, 0xF6, 0x87,
+    0x5C, 0xCC, 0x1B, 0x88, 0xD7, 0x5B, 0x80, 0xDC, 0x4C, 0x57, 0x55, 0x52, 0x8E, 0x25, 0x63, 0x2D,
+    0x89, 0x34, 0xA1, 0x83, 0x87, 0x57, 0x17, 0x1A, 0x86, 0x12, 0xE5, 0xBA, 0x06, 0x35, 0xB2, 0x10,
+    0x1E, 0xB8, 0x82, 0x2E, 0x4D, 0xBC, 0x9B, 0xAC, 0xC7, 0x04, 0xA6, 0x3D, 0x59, 0x65, 0x75, 0x08,
+    0xBF, 0x7D, 0xF9, 0x3F, 0x6A, 0xA1, 0x01, 0x5B, 0x03, 0xF8, 0xC6, 0xDA, 0x44, 0xE7, 0xAA, 0xC2,
+    0x8A, 0xC6, 0xB2, 0xFC, 0xAF, 0xC2, 0xE2, 0x2E, 0xF7, 0x01, 0x3D, 0x36, 0x8F, 0xC5, 0x06, 0x5E,
+    0xAD, 0xAA, 0x0A, 0xF6, 0x02, 0x82, 0x75, 0x4D, 0x33, 0x15, 0x7B, 0x66, 0xA1, 0x8C, 0x62, 0x6F,
+    0xA6, 0x15, 0x16, 0x58, 0x8A, 0x6B, 0xAD, 0xCE, 0x42, 0x4C, 0x55, 0x8A, 0x15, 0x74, 0x91, 0x69,
+    0xB3, 0x80, 0x89, 0xD6, 0xE9, 0x50, 0x86, 0x4D, 0xB3, 0x5D, 0x65, 0x10, 0xED, 0x2A, 0xA3, 0x57,
+    0x13, 0x61, 0x65, 0xF1, 0x95, 0x31, 0x7F, 0x02, 0xC2, 0xEB, 0x77, 0xCD, 0x81, 0x1D, 0x52, 0xF2,
+    0xA2, 0xCC, 0x9D, 0xB5, 0xB4, 0xE4, 0x40, 0x65, 0x23, 0xD6, 0xD8, 0x4A, 0x11, 0x7D, 0xE3, 0x2E,
+    0xC2, 0xF9, 0xD5, 0xDA, 0xD3, 0xBA, 0xEC, 0xEA, 0x57, 0xDB, 0xA4, 0x2B, 0xED, 0x39, 0x74, 0xE5,
+    0x19, 0xC5, 0x87, 0x63, 0x10, 0x16, 0xEC, 0x22, 0x89, 0xAB, 0x0E, 0xD3, 0xF5, 0x01, 0x3F, 0x56,
+    0x3C, 0x31, 0x5B, 0x40, 0xA3, 0x9E, 0x47, 0xD6, 0xC1, 0xBA, 0x6B, 0xE3, 0xE6, 0xAF, 0x9F, 0x17,
+    0xC6, 0xFF, 0x4F, 0xFE, 0x67, 0x89, 0x40, 0xBE, 0x6D, 0x4D, 0x37, 0x36, 0x95, 0xE6, 0x75, 0x95,
+    0x67, 0x4E, 0xF8, 0xA9, 0x16, 0x2B, 0x46, 0x5A, 0x87, 0x5C, 0x63, 0x65, 0x5A, 0x77, 0xF6, 0xC2,
+    0x89, 0x01, 0x3E, 0xD5, 0xDF, 0x58, 0xC2, 0x6E, 0x0B, 0xCA, 0x1D, 0xF2, 0x5C, 0x3F, 0xDF, 0xCC,
+    0xC7, 0x78, 0x9C, 0x45, 0x96, 0x51, 0x81, 0x77, 0x0D, 0xD8, 0xD5, 0x4F, 0x8A, 0x47, 0xB9, 0x60,
+    0xF5, 0x51, 0x35, 0x04, 0xC7, 0xDE, 0xE1, 0xA2, 0x62, 0x2A, 0x22, 0x7F, 0xF3, 0xA3, 0xDD, 0x2C,
+    0xD3, 0x10, 0xE7, 0x1B, 0x20, 0x81, 0x9D, 0x4F, 0x84, 0xEA, 0xF4, 0x6A, 0xA3, 0x4B, 0x71, 0x55,
+    0x0F, 0x5E, 0x6E, 0x39, 0x97, 0x63, 0xF1, 0x22, 0x2B, 0x7C, 0x60, 0xA0, 0xB8, 0x62, 0x57, 0x59,
+    0xA2, 0x5F, 0xDB, 0x32, 0x8B, 0x36, 0x67, 0x1A, 0xA3, 0xDB, 0xB3, 0x59, 0x5D, 0x2B, 0x09, 0xA0,
+    0xB7, 0x79, 0xAF, 0x59, 0x22, 0xDC, 0xC5, 0x96, 0x09, 0xEA, 0xE2, 0x6E, 0x51, 0x21, 0x20, 0x8C,
+    0x79, 0xCD, 0x2F, 0x4E, 0xDE, 0x34, 0xAC, 0xF2, 0x28, 0x60, 0xBE, 0x99, 0x59, 0xFD, 0x54, 0x7E,
+    0x2E, 0xCA, 0x11, 0x96, 0x87, 0xDA, 0x3E, 0x36, 0x68, 0xF5, 0xB1, 0x16, 0x0F, 0x13, 0xEA, 0x03,
+    0xD4, 0x42, 0x22, 0x67, 0xD4, 0xE2, 0x35, 0xE7, 0x84, 0x64, 0xFC, 0xD4, 0x7E, 0xC0, 0xEB, 0x1C,
+    0x09, 0xEF, 0xB1, 0x4D, 0xDF, 0x21, 0xF9, 0xF5, 0xAB, 0xEB, 0x03, 0xE9, 0x3D, 0x8B, 0xF0, 0x9E,
+    0x53, 0x27, 0x22, 0x7B, 0x40, 0x9D, 0x88, 0xF6, 0xC4, 0xEF, 0x42, 0xB4, 0x03, 0xFC, 0xC4, 0x75,
+    0x22, 0x04, 0x5F, 0x3B, 0x90, 0x6A, 0x0E, 0xB0, 0x65, 0xBF, 0xEA, 0x9D, 0x4C, 0x56, 0x42, 0x26,
+    0xB7, 0xA3, 0x55, 0x24, 0x6E, 0xF6, 0x55, 0x24, 0xCA, 0xCD, 0x2A, 0x12, 0xF6, 0xD6, 0xC1, 0x00,
+    0x36, 0xAA, 0x48, 0xE0, 0x64, 0x5E, 0xE6, 0x9D, 0x52, 0x0C, 0xFB, 0xFF, 0xF7, 0x2A, 0x1A, 0x8F,
+    0x67, 0x05, 0x3D, 0x55, 0x1C, 0xF5, 0x2B, 0x68, 0x7A, 0xDE, 0x0A, 0x7A, 0x82, 0x18, 0x7C, 0x30,
+    0x73, 0x7D, 0xCA, 0xBF, 0x43, 0xF2, 0x05, 0x11, 0xB6, 0x16, 0x26, 0xFE, 0xAE, 0x10, 0x37, 0x33,
+    0x3F, 0x86, 0x99, 0xC7, 0x58, 0x0F, 0xF8, 0xF9, 0xC9, 0x5B, 0xEC, 0xB2, 0xA5, 0xE3, 0xA8, 0xD9,
+    0x44, 0xC1, 0xB3, 0xF9, 0x7B, 0x5D, 0x60, 0x4D, 0x2C, 0xBE, 0xAB, 0xE0, 0x59, 0xAA, 0x38, 0xD9,
+    0xAB, 0x20, 0x14, 0x6F, 0x55, 0x37, 0x0F, 0xD3, 0xB7, 0x4F, 0xDB, 0x97, 0xCF, 0xE8, 0x4F, 0xA1,
+    0x51, 0x42, 0x5E, 0x84, 0x7D, 0x7D, 0x96, 0x1F, 0xFB, 0xF9, 0xF1, 0x81, 0x3F, 0x0B, 0x15, 0xF2,
+    0x9F, 0x7F, 0xF9, 0x4D, 0xC3, 0x24, 0x1B, 0x58, 0x02, 0x28, 0xC5, 0x2F, 0x60, 0xC9, 0x76, 0xEB,
+    0xD1, 0x46, 0x46, 0xF5, 0xB3, 0x8D, 0x6A, 0x07, 0xB5, 0x81, 0x7C, 0xA8, 0x06, 0x34, 0xE6, 0x44,
+    0x7F, 0x28, 0x28, 0xB8, 0x0E, 0x42, 0xF8, 0xA7, 0x1B, 0xBF, 0xAB, 0x7D, 0x1A, 0xBE, 0xF9, 0x53,
+    0xB6, 0x0F, 0xC2, 0x77, 0xF8, 0x10, 0xF8, 0x0E, 0x86, 0x0C, 0x33, 0x0C, 0xFF, 0x95, 0x01, 0xDF,
+    0x3A, 0x31, 0xC6, 0x6A, 0xEE, 0x23, 0x45, 0xB6, 0x05, 0xF1, 0xFA, 0x8E, 0x57, 0x9E, 0xAC, 0x9B,
+    0xF0, 0x74, 0x7E, 0x60, 0x0D, 0x64, 0xDC, 0xEB, 0xB3, 0xD8, 0xAA, 0x6B, 0x1B, 0x63, 0x7A, 0x5C,
+    0xF5, 0xFA, 0x0B, 0x35, 0xE6, 0x3C, 0xD6, 0x04, 0xCB, 0xEE, 0x0D, 0x43, 0x53, 0x7E, 0x57, 0x1F,
+    0x4F, 0xE7, 0x5C, 0x1D, 0xFA, 0xAB, 0x1F, 0x4B, 0xBC, 0x26, 0x3F, 0xBA, 0x50, 0x92, 0xE5, 0x16,
+    0x2A, 0xC4, 0xC9, 0xCB, 0x3D, 0xF1, 0x32, 0x83, 0xD2, 0xAF, 0x2A, 0x7F, 0x40, 0x73, 0x85, 0x57,
+    0xBE, 0x74, 0x1A, 0x69, 0x7A, 0xD6, 0x7E, 0x75, 0xEC, 0x98, 0x5D, 0x87, 0x3B, 0x31, 0x7F, 0xED,
+    0xB4, 0x91, 0x7F, 0x9A, 0x15, 0xFE, 0x3F, 0xBD, 0x7C, 0x56, 0xD4, 0xE6, 0xD1, 0xE4, 0x9F, 0xEE,
+    0xB4, 0x4D, 0xC0, 0x6F, 0x53, 0x5B, 0x89, 0xD4, 0x79, 0xF3, 0x93, 0xA6, 0xBC, 0x7E, 0xA4, 0xDD,
+    0xB1, 0xCB, 0xF5, 0x4A, 0x1C, 0xB1, 0x0D, 0x34, 0x6E, 0x59, 0xFE, 0xF8, 0xD3, 0x8B, 0x2E, 0x6D,
+    0xCF, 0x8C, 0x2E, 0x65, 0xE4, 0x5F, 0x97, 0x32, 0xBA, 0x34, 0x5D, 0x15, 0x76, 0x58, 0x87, 0xB1,
+    0x5A, 0x49, 0x08, 0x69, 0x03, 0x90, 0xA1, 0x3F, 0xDE, 0xE8, 0xD2, 0x36, 0x3D, 0x37, 0xBA, 0x74,
+    0xD6, 0x7B, 0x2C, 0x38, 0xEF, 0x6F, 0x30, 0x11, 0x7A, 0x1E, 0xDB, 0x5F, 0xED, 0x0C, 0x4F, 0xF9,
+    0xD5, 0xCE, 0xC5, 0xF1, 0x5F, 0xED, 0x84, 0x13, 0xB3, 0x02, 0x98, 0x7D, 0xEE, 0x5E, 0xF7, 0xFE,
+    0x1D, 0xFB, 0xAB, 0x9D, 0xEF, 0x6C, 0xFC, 0x6A, 0x67, 0xBB, 0xF9, 0xAB, 0x9D, 0x95, 0x2A, 0x50,
+    0x2C, 0x86, 0x6E, 0x7F, 0xB5, 0xF3, 0x02, 0x93, 0xBE, 0x74, 0x7B, 0x39, 0xD6, 0x1F, 0x6B, 0x0E,
+    0xD5, 0x37, 0x30, 0x4C, 0x7A, 0xF7, 0xC4, 0xA4, 0xF1, 0x00, 0x32, 0xD6, 0x51, 0xCE, 0xFF, 0x2F,
+    0xD5, 0x5B, 0xBD, 0x8F, 0xDC, 0xD6, 0x11, 0x1F, 0x92, 0xB7, 0x47, 0x47, 0x04, 0xC4, 0x14, 0x3A,
+    0x40, 0xD1, 0x21, 0x5A, 0x17, 0x29, 0x6C, 0x43, 0x3A, 0xB6, 0x29, 0xA4, 0x23, 0x0D, 0x03, 0x69,
+    0x73, 0x85, 0xA2, 0x14, 0x01, 0xA2, 0x26, 0x85, 0x83, 0x20, 0xBE, 0xC6, 0x85, 0x11, 0x48, 0xBB,
+    0x54, 0x1A, 0x17, 0x29, 0x22, 0x20, 0x70, 0x95, 0xC2, 0x2A, 0x5C, 0xD8, 0xEB, 0xC2, 0x2A, 0x54,
+    0x1C, 0x10, 0xDD, 0x2D, 0x13, 0x15, 0x69, 0x99, 0xFC, 0x03, 0x61, 0x00, 0xBB, 0x71, 0xE3, 0x85,
+    0xB1, 0x41, 0xB8, 0x32, 0x77, 0x5F, 0x7E, 0x33, 0xF3, 0xF8, 0x71, 0x67, 0x5B, 0x16, 0x82, 0xBB,
+    0xDD, 0xDB, 0xD5, 0xBD, 0xE1, 0x2E, 0x3F, 0x1E, 0xE7, 0xFD, 0x66, 0xDE, 0x7C, 0xBD, 0x27, 0xA2,
+    0x98, 0xF8, 0x13, 0xA7, 0x4C, 0xC7, 0x19, 0x53, 0x93, 0x83, 0x38, 0xFF, 0x2D, 0x40, 0xBD, 0x2F,
+    0x27, 0x4C, 0xFF, 0x3D, 0x05, 0x0D, 0xF2, 0x0A, 0x34, 0xCC, 0x0E, 0x41, 0xFB, 0xE9, 0x00, 0x34,
+    0x92, 0x87, 0x63, 0x8A, 0x12, 0xA2, 0x43, 0x5C, 0x21, 0xAA, 0x98, 0x3A, 0xC6, 0x98, 0x82, 0x5C,
+    0xD0, 0x09, 0x79, 0xCF, 0x46, 0x1F, 0x4F, 0xC9, 0x2F, 0xC8, 0x29, 0xED, 0x0D, 0x7D, 0xD0, 0x23,
+    0x79, 0x24, 0xD6, 0xC7, 0x93, 0x81, 0x74, 0xA8, 0x9D, 0xD3, 0xB1, 0xCF, 0x55, 0xE5, 0x2D, 0x69,
+    0xE9, 0xD5, 0xFA, 0xD2, 0xD0, 0x24, 0x3E, 0x5E, 0xE3, 0x7D, 0xB6, 0x3D, 0x75, 0xC8, 0x2D, 0x89,
+    0xBB, 0xAE, 0xDB, 0xE6, 0xC7, 0x15, 0xDE, 0x5E, 0x85, 0xCF, 0x7E, 0x56, 0x61, 0x5C, 0xD5, 0x10,
+    0xE7, 0x06, 0xD2, 0x1C, 0x7C, 0xF7, 0x70, 0x2E, 0xAA, 0xFA, 0x66, 0x7E, 0xD7, 0x37, 0xC5, 0x5D,
+    0xDA, 0xB2, 0xFD, 0xB9, 0x18, 0xB4, 0x3F, 0xD1, 0xC6, 0xDF, 0xE9, 0x96, 0x9C, 0x36, 0xC2, 0xD1,
+    0x2F, 0x18, 0x0B, 0x72, 0x26, 0x72, 0xA3, 0xD0, 0x88, 0x6F, 0xA1, 0x5D, 0xB9, 0xE7, 0x86, 0xD0,
+    0x8D, 0x0E, 0xDF, 0xE7, 0x0C, 0xD3, 0x1E, 0x2E, 0xF4, 0x01, 0x51, 0xEF, 0x08, 0xBF, 0x77, 0x94,
+    0x6F, 0x17, 0xD7, 0x3C, 0x30, 0xE5, 0xE1, 0x51, 0x27, 0x39, 0x13, 0x4C, 0xDF, 0x14, 0xCA, 0xDD,
+    0x6C, 0x09, 0x68, 0xE3, 0xBF, 0x03, 0x10, 0xC7, 0x30, 0x06, 0xBE, 0x8C, 0x3E, 0x4C, 0x6E, 0x0A,
+    0x70, 0x1B, 0xE7, 0x16, 0x39, 0xFB, 0x91, 0x6F, 0x31, 0x2B, 0xC7, 0x5D, 0x5C, 0xAC, 0x1E, 0x02,
+    0x41, 0xBE, 0xAD, 0x0C, 0x53, 0xE8, 0x8A, 0x7B, 0x4C, 0x69, 0x81, 0x21, 0x31, 0x88, 0xC4, 0x28,
+    0x92, 0x85, 0x51, 0x30, 0x6C, 0x08, 0xA0, 0x64, 0x7E, 0xC0, 0x1D, 0xC0, 0xE4, 0xB1, 0x56, 0xC4,
+    0x70, 0xD2, 0x40, 0x89, 0xC3, 0x3F, 0x3D, 0xBE, 0x10, 0x81, 0x3F, 0x60, 0x4A, 0x02, 0xAA, 0xA0,
+    0x7A, 0x41, 0x24, 0x15, 0xE4, 0xAA, 0x88, 0x82, 0xF3, 0x81, 0xC0, 0xB4, 0x76, 0xB0, 0xF2, 0xD9,
+    0x3E, 0xAE, 0xFB, 0x7F, 0xAD, 0xC8, 0xF9, 0x93, 0xC1, 0xE9, 0x7F, 0xA5, 0xB4, 0xEB, 0x15, 0xF4,
+    0x18, 0xFF, 0xEA, 0x4F, 0xDF, 0xE4, 0x78, 0x4F, 0x49, 0xB3, 0x9F, 0xCC, 0x29, 0xA1, 0x23, 0xFB,
+    0x98, 0x36, 0x67, 0x64, 0x68, 0x6C, 0x8C, 0xB7, 0x78, 0x6F, 0x18, 0x16, 0x14, 0xE3, 0x8D, 0x71,
+    0x3F, 0x95, 0x36, 0xC4, 0x77, 0x13, 0x16, 0x81, 0x81, 0x1C, 0xEE, 0x38, 0xA6, 0xEC, 0xCB, 0x04,
+    0xA8, 0xC1, 0x0B, 0x65, 0xFE, 0xDA, 0x97, 0x3C, 0x62, 0xE5, 0xF4, 0x19, 0x8A, 0xF1, 0xBB, 0x0C,
+    0xA9, 0xA0, 0xE2, 0xFF, 0x93, 0x91, 0xE8, 0xD3, 0xDD, 0xF5, 0x50, 0xCE, 0x39, 0x93, 0x3B, 0xA2,
+    0x17, 0x62, 0x99, 0x58, 0x4D, 0xDF, 0xC6, 0x0D, 0xD5, 0xCB, 0x78, 0x62, 0x68, 0xD5, 0xD4, 0xC9,
+    0xC5, 0xA8, 0x2D, 0x49, 0x4D, 0xC9, 0xFD, 0x94, 0x79, 0x09, 0xCD, 0x5B, 0x6C, 0xB2, 0xFB, 0xDC,
+    0xE3, 0x65, 0xE7, 0x21, 0x5F, 0x50, 0xD3, 0x30, 0x6C, 0x55, 0xD6, 0x5B, 0x13, 0x95, 0xBD, 0x04,
+    0x05, 0x34, 0xF7, 0x73, 0xE7, 0x2B, 0x93, 0x79, 0xD9, 0x58, 0x0D, 0x26, 0xFB, 0x8A, 0x10, 0xD7,
+    0xE3, 0x81, 0x80, 0x7C, 0xCC, 0x14, 0x9C, 0xAA, 0x2D, 0x7D, 0x8D, 0x1A, 0x14, 0x2C, 0x6A, 0x5F,
+    0x0A, 0x6A, 0x29, 0x8F, 0xF9, 0x3A, 0x54, 0xF5, 0xC4, 0x67, 0x0D, 0x7D, 0xBA, 0x0B, 0xF5, 0x08,
+    0x01, 0x53, 0x04, 0x75, 0x1E, 0xC4, 0x89, 0x53, 0x06, 0x99, 0x97, 0x3B, 0x05, 0x9D, 0xA5, 0xBF,
+    0x0F, 0x26, 0xDA, 0x44, 0x6C, 0xCE, 0x07, 0x7C, 0xDA, 0x13, 0xEB, 0x10, 0x08, 0xCF, 0x02, 0xEB,
+    0x45, 0x61, 0x2F, 0x4C, 0xD8, 0xC9, 0xFB, 0xA6, 0x6C, 0x24, 0x70, 0x9E, 0xFD, 0x7D, 0xC3, 0xD3,
+    0x13, 0x09, 0x5A, 0x9C, 0xFB, 0xF7, 0x53, 0x27, 0x87, 0xA3, 0x9F, 0xED, 0xC3, 0x38, 0xC2, 0xD4,
+    0x06, 0x9F, 0xD2, 0x99, 0xE0, 0xEA, 0x3E, 0x68, 0x03, 0x24, 0x3A, 0x10, 0x7A, 0x5D, 0x31, 0xFC,
+    0xE1, 0x5A, 0x62, 0x78, 0x4F, 0xCD, 0x29, 0x05, 0xE9, 0xF2, 0x30, 0xA4, 0xDF, 0x49, 0x97, 0xBF,
+    0x11, 0x0E, 0x3C, 0xA1, 0x7E, 0xD6, 0x22, 0xB9, 0xB1, 0x7E, 0x48, 0x3A, 0xA4, 0xB3, 0x8C, 0xDE,
+    0x41, 0xFB, 0xB1, 0xE8, 0x87, 0xF3, 0x7B, 0xA0, 0x59, 0x08, 0x9A, 0x99, 0xA0, 0x79, 0xE1, 0xAC,
+    0x34, 0xB2, 0xB8, 0x20, 0x7E, 0xE8, 0x97, 0x27, 0xFD, 0x90, 0x35, 0x45, 0x82, 0xA6, 0x38, 0xFA,
+    0x40, 0xD0, 0x74, 0xCF, 0x3D, 0x9A, 0x1B, 0xF0, 0x43, 0xE3, 0xB4, 0x60, 0x3F, 0xE4, 0x66, 0x43,
+    0xB1, 0x9F, 0x4E, 0xEA, 0x2C, 0x47, 0x37, 0x7F, 0x40, 0x82, 0xA6, 0x5A, 0xC4, 0xCF, 0x39, 0xEE,
+    0xF0, 0x0C, 0x8F, 0x9C, 0xDE, 0x4A, 0xD7, 0xDF, 0x03, 0x39, 0x29, 0x3D, 0x70, 0x0A, 0xB8, 0x85,
+    0xC5, 0x27, 0x99, 0x84, 0x47, 0x67, 0xA5, 0x93, 0x32, 0xA5, 0x01, 0x4C, 0x98, 0x6B, 0xC3, 0x77,
+    0xC4, 0xB1, 0x39, 0x0F, 0x0F, 0x2D, 0xAF, 0x8E, 0x75, 0x7E, 0xBC, 0x99, 0xD1, 0x28, 0xC5, 0x3D,
+    0x19, 0xB7, 0xE7, 0xDD, 0xC7, 0x6D, 0x31, 0x1A, 0x3D, 0xB0, 0x7D, 0xB6, 0x5E, 0x34, 0x64, 0x7C,
+    0x53, 0x6D, 0x61, 0x7D, 0x32, 0x5A, 0x00, 0x04, 0x89, 0x05, 0x67, 0xDB, 0x25, 0xB3, 0x04, 0x38,
+    0x53, 0x45, 0x53, 0xC0, 0x04, 0x19, 0x8D, 0xC6, 0x14, 0xA3, 0x27, 0xFE, 0x36, 0x52, 0xE1, 0xC6,
+    0x0D, 0x7C, 0x8C, 0x3D, 0x85, 0x92, 0x7F, 0xCC, 0x5F, 0xFF, 0x2D, 0x0B, 0x0A, 0xAA, 0x11, 0x89,
+    0x66, 0xDC, 0x6A, 0xDE, 0xCC, 0x12, 0x17, 0xE0, 0x34, 0xD2, 0x9C, 0xD8, 0x58, 0x70, 0x8C, 0xC7,
+    0x6E, 0x4F, 0x6D, 0x9A, 0x38, 0x55, 0x43, 0xC1, 0x69, 0x41, 0xD8, 0xCE, 0xC2, 0x33, 0x07, 0xC7,
+    0xD9, 0x63, 0x3D, 0x5C, 0x80, 0xF4, 0xF6, 0x13, 0x09, 0xAB, 0xC4, 0xC6, 0xF2, 0xAB, 0x59, 0x2F,
+    0x44, 0xC3, 0x05, 0xC2, 0x64, 0x49, 0x88, 0xED, 0x51, 0x1A, 0xCC, 0xBD, 0xAC, 0x6F, 0xBE, 0xC8,
+    0xAE, 0x07, 0x86, 0x5E, 0xA1, 0x0F, 0x1B, 0x18, 0xCF, 0x1C, 0x8C, 0x4B, 0xF4, 0x23, 0xF0, 0x93,
+    0xBE, 0x8D, 0xA9, 0xFD, 0x6C, 0x42, 0xFE, 0x7D, 0x9C, 0xF2, 0xE9, 0x4A, 0xD2, 0x9D, 0x3F, 0x67,
+    0xAE, 0x2F, 0xAF, 0x0A, 0x63, 0x5B, 0x08, 0x5D, 0x86, 0x4F, 0x91, 0xCA, 0x61, 0xBE, 0x4F, 0xF0,
+    0x9E, 0x74, 0x07, 0x1A, 0xD1, 0x5B, 0x0E, 0x0A, 0xDD, 0xBC, 0x1F, 0xEA, 0xE8, 0x4D, 0x91, 0x9E,
+    0x84, 0xF3, 0x5F, 0x81, 0x4D, 0x4E, 0xA8, 0x9E, 0x20, 0x3E, 0x74, 0x8A, 0x4E, 0x70, 0x7A, 0xE6,
+    0xA0, 0xBC, 0x69, 0x8B, 0x4D, 0xFD, 0x64, 0x8F, 0xBC, 0xA7, 0x15, 0xBB, 0x34, 0x3C, 0x07, 0xF6,
+    0x0E, 0xDC, 0x02, 0x6A, 0xF9, 0x7D, 0x09, 0x5A, 0xF1, 0x48, 0x68, 0xCC, 0x22, 0xE4, 0x63, 0xA6,
+    0xCC, 0x7F, 0x63, 0x7B, 0x36, 0xFA, 0x30, 0x64, 0x83, 0xC5, 0xED, 0x79, 0xF7, 0x71, 0xFB, 0x7C,
+    0xF4, 0x91, 0xED, 0x73, 0x21, 0xC3, 0x7C, 0xD2, 0x70, 0x1D, 0xBE, 0x81, 0x29, 0xEB, 0xFE, 0x81,
+    0xBD, 0x40, 0xB4, 0x0F, 0x72, 0x97, 0x83, 0xE6, 0xA5, 0x82, 0x82, 0x14, 0x15, 0x37, 0x05, 0x53,
+    0x0D, 0x2B, 0x10, 0x5E, 0x6C, 0x79, 0x05, 0x34, 0x26, 0x15, 0x8D, 0x29, 0x56, 0xA3, 0x31, 0x6D,
+    0x32, 0xEE, 0x27, 0x36, 0x19, 0x9F, 0x1E, 0x4B, 0xC6, 0x0F, 0x24, 0x19, 0x77, 0xF2, 0xE5, 0xC1,
+    0xE4, 0x4E, 0x7D, 0xE8, 0xC6, 0x1D, 0x0A, 0xFB, 0x73, 0x7A, 0x89, 0xB3, 0x1C, 0x46, 0x24, 0xC6,
+    0x23, 0xAB, 0x98, 0x58, 0x1B, 0x30, 0x6E, 0x34, 0xCE, 0xC1, 0xEB, 0x57, 0x08, 0x08, 0x10, 0xC1,
+    0xD4, 0x91, 0x83, 0x27, 0x09, 0x2D, 0xDF, 0x1F, 0x77, 0xA6, 0xD8, 0x12, 0x61, 0x92, 0xF2, 0x50,
+    0x9C, 0x0B, 0x2C, 0xEE, 0xB4, 0x42, 0x60, 0x12, 0x23, 0x71, 0x09, 0xD2, 0xA5, 0x59, 0xDE, 0x6F,
+    0xF3, 0xD1, 0x9C, 0x19, 0x53, 0xC0, 0xFE, 0xB1, 0xCF, 0xDA, 0x35, 0xE0, 0x20, 0xA7, 0x0C, 0x00,
+    0x5E, 0xAE, 0x05, 0xE9, 0x15, 0xBB, 0x71, 0xBF, 0x84, 0x76, 0x89, 0xBF, 0xC4, 0x5F, 0xC4, 0x65,
+    0x21, 0xD8, 0x00, 0x15, 0xDC, 0xD8, 0xA4, 0x63, 0x93, 0xF9, 0x33, 0xCE, 0xAA, 0xFF, 0x9F, 0xBF,
+    0x29, 0x7A, 0xC8, 0xF0, 0x77, 0x8B, 0x4C, 0xF6, 0xE7, 0x89, 0x33, 0x71, 0x27, 0xFD, 0x7C, 0x97,
+    0xAE, 0x49, 0x60, 0xB0, 0x2B, 0x83, 0x7A, 0xFE, 0xBF, 0xD3, 0x7A, 0xBF, 0x0E, 0x1D, 0xC3, 0xC2,
+    0x19, 0xFC, 0xE1, 0xCB, 0x65, 0x1A, 0xE2, 0xDF, 0xAE, 0x05, 0xE5, 0x45, 0x78, 0xD1, 0x14, 0x8E,
+    0x9F, 0xBA, 0x5E, 0x63, 0xB9, 0x69, 0x66, 0x12, 0x5A, 0xF2, 0x44, 0x30, 0x9F, 0x8D, 0x4B, 0x86,
+    0xD2, 0x9D, 0x8B, 0x08, 0x86, 0x14, 0x65, 0xAC, 0x01, 0xB1, 0x38, 0x21, 0x9E, 0x10, 0x61, 0xCE,
+    0xE5, 0xCF, 0xA0, 0x98, 0x4B, 0xDD, 0x49, 0x62, 0xEF, 0x49, 0xD5, 0xA1, 0xF3, 0x86, 0xFA, 0x13,
+    0xBD, 0x53, 0x9F, 0xD2, 0x1E, 0x62, 0xD1, 0xA7, 0x7E, 0xCE, 0x3D, 0x43, 0x95, 0x9C, 0x05, 0xDE,
+    0xF8, 0xDE, 0x7E, 0x29, 0x5A, 0x5D, 0xB0, 0xEB, 0x10, 0xEB, 0xDE, 0xEB, 0x68, 0x93, 0x46, 0x87,
+    0x51, 0xDA, 0xD2, 0xB0, 0xD5, 0x34, 0x93, 0xB2, 0x7A, 0x00, 0x8C, 0xF9, 0xCF, 0x85, 0xDF, 0x21,
+    0x2B, 0x4F, 0x94, 0x42, 0xD3, 0xF0, 0x2A, 0xB2, 0x84, 0x5F, 0x1D, 0x34, 0x44, 0x7E, 0x86, 0x99,
+    0xDC, 0x22, 0x37, 0xCB, 0x63, 0xDE, 0x6C, 0x73, 0xAE, 0x5D, 0x49, 0xA7, 0x1C, 0xFA, 0x3C, 0x27,
+    0x60, 0xB4, 0xF9, 0xC4, 0x70, 0xDA, 0x2C, 0x2C, 0xD8, 0x32, 0x83, 0xC6, 0x68, 0x61, 0xDE, 0xB2,
+    0xD9, 0x32, 0x7B, 0x4E, 0x61, 0x96, 0xA0, 0xD3, 0xE3, 0xDF, 0xCE, 0x7E, 0x5A, 0x97, 0x9C, 0xC4,
+    0xDA, 0x70, 0xD0, 0x49, 0xD3, 0x66, 0xCC, 0x7B, 0xCB, 0x43, 0xFD, 0xD5, 0xC6, 0xC5, 0xF7, 0x04,
+    0xD1, 0xF8, 0x29, 0x33, 0x65, 0x26, 0xCD, 0xF8, 0x83, 0x74, 0x47, 0xE2, 0x72, 0x87, 0xD6, 0x42,
+    0x87, 0xFD, 0x42, 0xA3, 0x79, 0xB7, 0xDC, 0xE1, 0x00, 0xFF, 0x15, 0xD8, 0xB8, 0x4F, 0x60, 0xE9,
+    0xEE, 0x71, 0xC1, 0xFF, 0xA1, 0xD4, 0xFE, 0x97, 0xA4, 0xD2, 0x9B, 0x69, 0x5B, 0x5B, 0xA4, 0xA9,
+    0xB0, 0x78, 0x23, 0x16, 0x6D, 0x15, 0x70, 0xDD, 0x0E, 0xB8, 0xBD, 0xB5, 0x00, 0x77, 0x60, 0x57,
+    0x1A, 0x70, 0xE5, 0x6F, 0xE8, 0xDE, 0x79, 0x97, 0x2F, 0xF7, 0xDF, 0x47, 0x27, 0x37, 0x19, 0xDC,
+    0x47, 0xCB, 0x04, 0xD7, 0xC6, 0x81, 0x36, 0x12, 0xAC, 0x97, 0x63, 0xB9, 0xD8, 0xC4, 0xF1, 0x20,
+    0x6B, 0x71, 0xBA, 0xD6, 0x5A, 0xCC, 0x7D, 0xD0, 0x76, 0x5A, 0x97, 0x03, 0x91, 0x8E, 0xB8, 0xE5,
+    0x35, 0xD6, 0xE7, 0xCB, 0x2B, 0xD3, 0x67, 0x89, 0x29, 0xB9, 0x02, 0xF9, 0x3E, 0x8F, 0x69, 0x9B,
+    0xC7, 0xFA, 0x3D, 0xFA, 0xA0, 0x65, 0x3C, 0xCE, 0x68, 0x3D, 0x21, 0xEF, 0x71, 0x2A, 0x15, 0x17,
+    0x80, 0xF2, 0x2F, 0xCC, 0x7D, 0x11, 0xD5, 0xA5, 0x23, 0x71, 0x42, 0xBE, 0x68, 0x39, 0x43, 0x7E,
+    0x73, 0xF9, 0x90, 0xDB, 0x24, 0xBC, 0x0B, 0xED, 0x7F, 0x04, 0x5A, 0x19, 0xE5, 0x55, 0x0A, 0x92,
+    0xE3, 0x55, 0xAE, 0x75, 0x8C, 0x2E, 0x64, 0x0D, 0xC6, 0x9B, 0x93, 0xE6, 0xB7, 0x14, 0xFD, 0x14,
+    0x6C, 0x1E, 0xC2, 0x6C, 0x22, 0xE2, 0x3A, 0x58, 0xAA, 0x41, 0xF9, 0xB6, 0x00, 0x84, 0x7E, 0xAD,
+    0xA1, 0x60, 0xD5, 0xE6, 0x2C, 0xF5, 0x72, 0xBC, 0x94, 0xAD, 0xEA, 0x3A, 0x3D, 0x75, 0x06, 0x8C,
+    0xF1, 0xB1, 0x2C, 0xF0, 0x62, 0x16, 0x46, 0xAC, 0xD2, 0x18, 0x88, 0x38, 0x78, 0x71, 0xB5, 0x90,
+    0x22, 0x18, 0x0B, 0x04, 0x30, 0x2A, 0x9E, 0xA4, 0xE0, 0x92, 0x22, 0x4D, 0x0A, 0x7B, 0x7D, 0x50,
+    0x81, 0xD4, 0x87, 0xE3, 0xD7, 0xEC, 0x03, 0xF6, 0x71, 0xDB, 0x99, 0x4A, 0x87, 0x54, 0x3C, 0x56,
+    0x3E, 0xB5, 0x80, 0x24, 0xAB, 0xA1, 0x46, 0x44, 0x35, 0xCB, 0x9B, 0xB2, 0x90, 0xD3, 0xCF, 0xDB,
+    0x0A, 0xE9, 0x61, 0x1B, 0x66, 0xB9, 0x39, 0xBD, 0xD6, 0xA9, 0x9D, 0xC6, 0x82, 0xDC, 0x80, 0x53,
+    0x0F, 0x64, 0x4D, 0x10, 0x08, 0xB0, 0x64, 0x68, 0x33, 0x15, 0x09, 0x09, 0xE0, 0x14, 0x53, 0x4D,
+    0x85, 0xAF, 0xE0, 0x6B, 0x14, 0x57, 0xF5, 0x4E, 0xE4, 0x2C, 0x78, 0x0A, 0xB7, 0x81, 0x59, 0x6F,
+    0x06, 0x8D, 0xB5, 0xE2, 0xB1, 0xF2, 0x51, 0x01, 0xB9, 0x5A, 0xC4, 0xF7, 0xCA, 0x4E, 0xD6, 0x5D,
+    0x17, 0x9D, 0xB5, 0x7E, 0x67, 0x57, 0xF5, 0xD6, 0x5B, 0x10, 0xBA, 0xEE, 0xAB, 0x46, 0x48, 0xA3,
+    0x5B, 0x1B, 0x43, 0x94, 0x56, 0xD5, 0x56, 0x2E, 0x88, 0xBA, 0xA2, 0x3D, 0xD6, 0x39, 0x70, 0xDB,
+    0x66, 0xA4, 0xD3, 0xEE, 0x61, 0xBB, 0xE8, 0xCE, 0x0F, 0xBB, 0x83, 0x6B, 0x63, 0x8D, 0xC5, 0x22,
+    0xB1, 0x3B, 0x05, 0xA2, 0x75, 0xBD, 0x7D, 0xD5, 0xB9, 0xA4, 0xA5, 0x47, 0xED, 0x5C, 0x81, 0xE1,
+    0x62, 0x11, 0x25, 0xAB, 0x14, 0x91, 0xB3, 0xE7, 0x48, 0x82, 0x31, 0xD7, 0xF0, 0xC1, 0x7C, 0xC1,
+    0xBF, 0x6E, 0x70, 0xCE, 0xCE, 0x75, 0xB3, 0x83, 0xB5, 0x9F, 0x24, 0x5B, 0xC8, 0xC6, 0x59, 0x01,
+    0x6F, 0xF0, 0xE8, 0x17, 0x25, 0x6F, 0x6B, 0x1B, 0x43, 0x0D, 0xBD, 0x34, 0x48, 0x57, 0x3F, 0x3D,
+    0xD6, 0xDA, 0x0D, 0xD8, 0xCF, 0x45, 0xEA, 0x78, 0xEB, 0xFA, 0x70, 0xB1, 0xBE, 0x7A, 0x2E, 0x30,
+    0xAE, 0xFD, 0xB3, 0xBA, 0x6A, 0xA5, 0x72, 0xA6, 0x22, 0x29, 0xE6, 0x9D, 0x3A, 0xF1, 0x38, 0x0C,
+    0xF2, 0x26, 0x8C, 0x64, 0x81, 0x90, 0x2C, 0xCA, 0xC2, 0xD9, 0x6D, 0x93, 0x78, 0x52, 0x33, 0x1B,
+    0x4A, 0x31, 0xAF, 0xAD, 0x99, 0x71, 0x94, 0xC8, 0xDB, 0x2D, 0x95, 0xF0, 0xCF, 0x81, 0x6E, 0x20,
+    0x8C, 0x5F, 0xB0, 0x0D, 0xD1, 0xC6, 0xC0, 0xC5, 0xC4, 0x89, 0x6B, 0xA2, 0x62, 0xDB, 0x84, 0xC6,
+    0xC4, 0xAE, 0x29, 0xA3, 0x46, 0x50, 0x27, 0xD6, 0x13, 0xD5, 0x31, 0x7A, 0xA6, 0x59, 0xCD, 0x0A,
+    0xB2, 0xDA, 0x00, 0xCF, 0x1B, 0xAC, 0xEA, 0xE2, 0xE1, 0x6A, 0x21, 0x7A, 0xC1, 0xBD, 0xA9, 0xA7,
+    0x8B, 0x98, 0xC6, 0x37, 0xD6, 0xA5, 0xDA, 0xAA, 0x92, 0xE6, 0xB4, 0xB5, 0x6B, 0xED, 0xEC, 0x96,
+    0xDB, 0xAA, 0x83, 0x0B, 0x19, 0x98, 0x3D, 0x0C, 0x6A, 0xD8, 0xF8, 0x00, 0x95, 0x94, 0x43, 0x26,
+    0x87, 0xD2, 0x42, 0x7A, 0x8A, 0x07, 0xF6, 0xFA, 0x47, 0x7A, 0x88, 0x65, 0x6A, 0xB3, 0xA1, 0x60,
+    0x5B, 0x21, 0x90, 0xB2, 0xA4, 0xCD, 0x5C, 0x97, 0xA9, 0xD5, 0xD5, 0x5A, 0xDD, 0xBB, 0x92, 0xB6,
+    0x53, 0x53, 0x9D, 0x92, 0x0C, 0x4E, 0xB2, 0x62, 0x56, 0x13, 0x85, 0xC1, 0x96, 0xCD, 0xB2, 0x7B,
+    0x80, 0x38, 0xCC, 0x18, 0x40, 0x59, 0x3C, 0x8F, 0x17, 0x8C, 0x48, 0x3C, 0x15, 0x4A, 0x2F, 0x4A,
+    0x87, 0x42, 0xC7, 0xF2, 0x93, 0x97, 0xA8, 0x00, 0x3F, 0x98, 0x85, 0x00, 0x38, 0xA4, 0x37, 0x31,
+    0xA3, 0x54, 0x46, 0x6D, 0x7C, 0x93, 0x74, 0x02, 0x9C, 0x5A, 0x1C, 0x36, 0xC4, 0xD1, 0x7D, 0x88,
+    0xDD, 0x78, 0x7A, 0x6D, 0x05, 0xF1, 0x91, 0x86, 0x48, 0x1D, 0xF3, 0xA9, 0x5B, 0x12, 0xBC, 0x7A,
+    0x2B, 0xEA, 0xCA, 0x05, 0xE1, 0xCD, 0xF4, 0xA0, 0x66, 0xD5, 0xEE, 0x7F, 0xB3, 0x1B, 0x8F, 0xD8,
+    0x0A, 0xF3, 0x67, 0x71, 0x2C, 0xB4, 0x7B, 0xB4, 0xC6, 0xF2, 0xD0, 0xED, 0xC0, 0xB2, 0xD8, 0xA4,
+    0x76, 0xC7, 0xEE, 0xF5, 0x13, 0xFB, 0x63, 0xAD, 0xB4, 0x4E, 0x12, 0x58, 0x20, 0xC8, 0x06, 0x36,
+    0x68, 0x85, 0xB2, 0xE9, 0xD1, 0x4B, 0x1A, 0x61, 0x5F, 0x93, 0xED, 0x5E, 0x8B, 0x27, 0x62, 0x9E,
+    0xC6, 0x92, 0x9E, 0xA6, 0x17, 0xD2, 0xB5, 0x9F, 0x1D, 0x97, 0xE8, 0x65, 0x1E, 0x57, 0xFA, 0x88,
+    0x74, 0xCF, 0x01, 0x05, 0xAF, 0x73, 0x30, 0x12, 0xC0, 0x3A, 0xAC, 0x7C, 0x5E, 0xAC, 0xB7, 0xFD,
+    0xB7, 0x9F, 0xC7, 0xDD, 0x9A, 0x85, 0x3D, 0xB4, 0x9B, 0xEC, 0xCF, 0x05, 0xC6, 0x1A, 0xB5, 0x34,
+    0x6C, 0xE4, 0xED, 0x99, 0x2B, 0xCD, 0xD2, 0x24, 0x0F, 0x5B, 0x00, 0xB1, 0xBB, 0x10, 0x76, 0xBA,
+    0x63, 0x3C, 0x64, 0xE7, 0xC6, 0x51, 0xE2, 0x04, 0xEE, 0x2E, 0x28, 0x60, 0x5F, 0xC3, 0x0C, 0x0F,
+    0x44, 0x29, 0x30, 0x8B, 0x59, 0x26, 0x87, 0x0C, 0x24, 0xC6, 0x7E, 0xC4, 0x45, 0x9B, 0x98, 0x77,
+    0x6E, 0xF7, 0xFF, 0xC8, 0x01, 0x13, 0x67, 0x43, 0xBE, 0x69, 0xD6, 0x62, 0xAA, 0xAF, 0x6D, 0x83,
+    0xFF, 0x0E, 0x22, 0x05, 0xA1, 0x61, 0xE3, 0xC5, 0xA4, 0x16, 0xA4, 0x3B, 0x60, 0xDF, 0x39, 0xC1,
+    0x9F, 0xEC, 0x6E, 0x8B, 0x92, 0xD8, 0xEE, 0x6D, 0x1B, 0xB0, 0x13, 0x90, 0xFD, 0x6D, 0x15, 0xF9,
+    0x05, 0x3C, 0xB3, 0x37, 0xF1, 0x78, 0xE5, 0x99, 0x85, 0xCC, 0xCB, 0xBB, 0x24, 0x9B, 0x33, 0xEE,
+    0x71, 0xF8, 0x16, 0xF3, 0x92, 0x6F, 0x24, 0x71, 0xFC, 0x51, 0x6D, 0xB8, 0xFC, 0xAA, 0x2E, 0x40,
+    0x89, 0x17, 0x91, 0xA5, 0x0E, 0x79, 0xB9, 0xFE, 0x5F, 0x15, 0x3C, 0x70, 0x9B, 0x07, 0x34, 0xAE,
+    0xEA, 0xE4, 0x7C, 0x65, 0x08, 0x9D, 0xD0, 0x44, 0xE9, 0x40, 0x7B, 0x79, 0xBC, 0x2C, 0x5C, 0xFE,
+    0x01, 0x1A, 0x3E, 0xC5, 0xC4, 0x8C, 0xDF, 0x28, 0x81, 0x0B, 0xB2, 0xF2, 0x16, 0x17, 0x72, 0x67,
+    0x8D, 0xE7, 0x13, 0xBF, 0xA7, 0x69, 0x72, 0x56, 0x7B, 0xBC, 0xC7, 0x75, 0x08, 0xBF, 0x52, 0x35,
+    0x13, 0x97, 0x25, 0x03, 0xEC, 0x8D, 0x1B, 0x7F, 0xC5, 0x73, 0xC8, 0x99, 0xCB, 0x36, 0xD7, 0x26,
+    0x64, 0x4D, 0xCE, 0x8D, 0xC2, 0xA9, 0xE3, 0x1A, 0x16, 0x08, 0xE0, 0xD8, 0x69, 0x39, 0xC5, 0x70,
+    0x4A, 0x6E, 0x66, 0x43, 0xEF, 0x15, 0xC3, 0xF9, 0xDD, 0xBB, 0xDC, 0x56, 0x8F, 0xDF, 0xFF, 0x00,
+    0xB5, 0x58, 0xBD, 0x6F, 0xDC, 0xC8, 0x15, 0x7F, 0x24, 0x25, 0x33, 0xB9, 0x4D, 0x8E, 0x2A, 0xA4,
+    0x00, 0x67, 0xC0, 0xC7, 0xC6, 0x45, 0xCE, 0xB1, 0x96, 0x4D, 0x8A, 0x2B, 0xB4, 0xCB, 0xB1, 0x53,
+    0xA4, 0x55, 0xE1, 0x85, 0x0B, 0x03, 0x49, 0xCA, 0x20, 0x01, 0x72, 0x8D, 0x0B, 0x17, 0xAB, 0xE5,
+    0xC4, 0xFE, 0x07, 0x04, 0x1C, 0x9C, 0x26, 0x8D, 0x1A, 0x03, 0x39, 0xA7, 0xB0, 0x0A, 0x03, 0xD1,
+    0x25, 0x2B, 0x93, 0xB6, 0x81, 0xA4, 0x65, 0x2E, 0x48, 0x9A, 0x34, 0xCC, 0xC7, 0x35, 0xA9, 0x26,
+    0x07, 0x02, 0x21, 0x0E, 0xD4, 0x32, 0xBF, 0xF7, 0x86, 0x5C, 0xED, 0xCA, 0xB2, 0x2D, 0x9D, 0x70,
+    0x5C, 0xCE, 0x70, 0x86, 0x7C, 0x5F, 0xF3, 0xE6, 0x7D, 0xCD, 0x52, 0x46, 0x64, 0x88, 0xB6, 0x28,
+    0x6D, 0x68, 0x7F, 0x8B, 0xF6, 0xF6, 0x69, 0x2F, 0xA3, 0x3D, 0xFA, 0xEA, 0xF7, 0x36, 0x11, 0x65,
+    0xE4, 0x69, 0x0A, 0x88, 0xE2, 0x46, 0xBF, 0xEB, 0x69, 0xEF, 0xBE, 0xA6, 0x17, 0x9A, 0xDC, 0x0B,
+    0xDC, 0x8E, 0x02, 0xD5, 0xB4, 0x51, 0xB8, 0x47, 0x23, 0x3A, 0x31, 0xE6, 0x59, 0xD3, 0x68, 0xE9,
+    0x36, 0x46, 0xDD, 0xBB, 0xF6, 0x35, 0xAE, 0xBA, 0x7B, 0x8E, 0xEC, 0x75, 0x6B, 0x8D, 0xB6, 0x0F,
+    0x1C, 0xF3, 0x75, 0xDF, 0xAD, 0x10, 0x31, 0x18, 0x73, 0xEB, 0x84, 0xBA, 0xF6, 0xF8, 0xF1, 0x6F,
+    0x78, 0x0E, 0x49, 0x6F, 0xB9, 0xB9, 0x9F, 0xF5, 0xB2, 0x40, 0x87, 0x2A, 0x56, 0x31, 0x25, 0xB4,
+    0x41, 0x61, 0x16, 0x65, 0x11, 0xC6, 0x31, 0xED, 0xD0, 0x94, 0x0E, 0xA0, 0xCD, 0x09, 0xDE, 0xC7,
+    0x14, 0xA9, 0x50, 0x07, 0x80, 0xF5, 0x72, 0x47, 0x85, 0x59, 0x1D, 0x3D, 0xAF, 0xA3, 0x9B, 0x55,
+    0xEC, 0x95, 0xB1, 0x67, 0x76, 0xBC, 0x62, 0xEA, 0x67, 0x07, 0x3D, 0xBD, 0xBD, 0x4A, 0x13, 0xDF,
+    0x24, 0x9E, 0xC1, 0xFB, 0xE8, 0x66, 0x19, 0xEA, 0x2A, 0xD0, 0x75, 0x2F, 0x1B, 0x7B, 0xD9, 0xC0,
+    0x51, 0xEB, 0x20, 0x0E, 0x61, 0xDA, 0x36, 0x6C, 0xDB, 0xA6, 0x6D, 0xB3, 0x67, 0x4F, 0x32, 0x28,
+    0x28, 0xFB, 0xFD, 0x2F, 0x7E, 0x9E, 0x75, 0xEF, 0x96, 0xDA, 0xF0, 0x94, 0x16, 0xBF, 0xA6, 0x6D,
+    0x9C, 0x98, 0xF7, 0x6D, 0x7B, 0xD8, 0xDF, 0xD0, 0xCC, 0x83, 0x9B, 0xD0, 0xEC, 0x9F, 0x82, 0x3B,
+    0xB4, 0xEF, 0x6F, 0x6D, 0xAE, 0xAA, 0x0E, 0x56, 0x5D, 0x21, 0x25, 0xB0, 0x27, 0x79, 0xAA, 0xB0,
+    0x8A, 0x8F, 0x92, 0x86, 0x7F, 0xF1, 0x2C, 0x3E, 0xEA, 0x95, 0x24, 0xF6, 0x77, 0x88, 0x7D, 0xCF,
+    0x29, 0xAD, 0xC5, 0x44, 0x8E, 0x28, 0x2D, 0xE8, 0x19, 0xD1, 0x7E, 0xAB, 0xFC, 0x21, 0xA5, 0x2A,
+    0x55, 0x09, 0xAD, 0xDB, 0xAD, 0xA1, 0x40, 0xA7, 0x2A, 0xCA, 0x53, 0x1D, 0xE5, 0x09, 0x54, 0xBF,
+    0x42, 0xAB, 0xF2, 0x16, 0x30, 0x3A, 0xA1, 0x15, 0x6B, 0x42, 0x8C, 0xBB, 0x77, 0xE1, 0x7B, 0xBB,
+    0xB5, 0x05, 0xCD, 0x9E, 0xE1, 0x5E, 0xF8, 0x76, 0x54, 0xB3, 0x74, 0xB9, 0xFA, 0x6C, 0x3F, 0xC6,
+    0xFB, 0x7C, 0x94, 0x13, 0xFF, 0x0A, 0x3A, 0x1F, 0xDE, 0xE8, 0x0E, 0xF9, 0xF2, 0xEB, 0x9D, 0x07,
+    0x6F, 0xEE, 0x8C, 0xE4, 0xCE, 0x88, 0x02, 0x99, 0x07, 0xB0, 0x80, 0x48, 0xDE, 0x45, 0x3F, 0x28,
+    0x68, 0x60, 0x77, 0x06, 0x0E, 0x33, 0x95, 0xD1, 0x00, 0xF1, 0xA8, 0x94, 0xD1, 0x98, 0x4A, 0xCF,
+    0x74, 0x23, 0x3F, 0xEB, 0x46, 0x81, 0xEE, 0x46, 0xA1, 0xA5, 0xBC, 0x45, 0xE5, 0xF0, 0xD2, 0x2E,
+    0x5D, 0xD2, 0x34, 0x70, 0xCC, 0x34, 0xAE, 0x29, 0xA9, 0xA8, 0xEF, 0x9A, 0xF2, 0x59, 0x4A, 0xB3,
+    0x43, 0x0A, 0x7F, 0xFD, 0x99, 0x29, 0x83, 0x9B, 0x26, 0x82, 0xE0, 0x0F, 0xFE, 0x6C, 0x82, 0x07,
+    0x45, 0x40, 0xCE, 0xA7, 0xC1, 0x0B, 0xD3, 0x7B, 0x99, 0xB3, 0x3C, 0xA1, 0x5B, 0xF8, 0x2F, 0x33,
+    0x26, 0x3A, 0xF4, 0x0A, 0xFF, 0x4F, 0x32, 0x1A, 0xCF, 0x47, 0x55, 0xF7, 0xD5, 0x35, 0x6E, 0x8B,
+    0x01, 0x1F, 0x64, 0x2A, 0x60, 0xDE, 0xCB, 0xA8, 0x0A, 0x6F, 0x98, 0x58, 0x16, 0x96, 0xCC, 0xA8,
+    0x39, 0x12, 0xD3, 0x0C, 0x2B, 0x8A, 0xED, 0x0A, 0xB0, 0x7E, 0x87, 0x96, 0x2F, 0x56, 0x43, 0x4F,
+    0xB7, 0x13, 0xD6, 0x44, 0xD8, 0x7D, 0x89, 0x7E, 0x58, 0x88, 0x91, 0x5B, 0x7D, 0xB8, 0x06, 0x2B,
+    0x6C, 0xAF, 0x1D, 0x28, 0xA4, 0xEA, 0x26, 0x63, 0xC8, 0x64, 0x16, 0x26, 0x5E, 0xBE, 0x30, 0xE9,
+    0x65, 0x0B, 0x93, 0x40, 0x1D, 0x4F, 0xCA, 0xA1, 0x03, 0x0D, 0xC9, 0x3D, 0x70, 0xCA, 0x71, 0x34,
+    0xA3, 0xF8, 0x88, 0x92, 0x9A, 0x62, 0xD7, 0x54, 0x09, 0x0C, 0x1E, 0xAA, 0x9A, 0x41, 0x55, 0xFF,
+    0x30, 0x75, 0x90, 0x55, 0xE1, 0xFD, 0x92, 0xB5, 0xF5, 0xB2, 0x28, 0xFD, 0xE7, 0x58, 0xB4, 0x09,
+    0xB4, 0xF3, 0x69, 0xEF, 0xB9, 0xF1, 0x3E, 0x33, 0xFE, 0xCB, 0x82, 0xB5, 0x12, 0xDC, 0x30, 0xDE,
+    0xBF, 0x30, 0xC9, 0x99, 0x5F, 0xE4, 0x60, 0x52, 0xF8, 0x7F, 0x91, 0xC9, 0x60, 0x71, 0x52, 0x63,
+    0xF2, 0xCF, 0x16, 0xCC, 0x31, 0x4E, 0x09, 0x02, 0x3D, 0x21, 0xE0, 0x15, 0x54, 0x81, 0x34, 0x36,
+    0x01, 0x32, 0x62, 0x67, 0xA7, 0xCC, 0xF4, 0x06, 0x98, 0xC2, 0x23, 0xE1, 0x25, 0x2A, 0x69, 0xA8,
+    0x81, 0x9E, 0x78, 0x7E, 0x44, 0x61, 0x4D, 0x51, 0xBB, 0x7A, 0x25, 0x1A, 0x55, 0xAC, 0x91, 0xDA,
+    0x35, 0x5E, 0x81, 0xE0, 0xA9, 0xFA, 0xD8, 0xFF, 0xBB, 0x78, 0x03, 0x1E, 0x75, 0xA0, 0x5D, 0xEC,
+    0xB3, 0x57, 0x0C, 0xB0, 0x35, 0x53, 0x6C, 0x8A, 0x81, 0x1D, 0x14, 0xB4, 0xE5, 0x65, 0x74, 0xB7,
+    0xA7, 0x04, 0x66, 0x0A, 0xA0, 0x5F, 0x42, 0x81, 0x91, 0x07, 0xF4, 0x81, 0x0F, 0xC9, 0xA6, 0x81,
+    0x06, 0x60, 0xC8, 0x90, 0x03, 0x06, 0x1D, 0x33, 0xEC, 0x3E, 0x38, 0xC4, 0x14, 0xAA, 0x00, 0x11,
+    0xD7, 0x65, 0x7B, 0x1C, 0xD3, 0xF5, 0x1D, 0x96, 0x0D, 0x5C, 0x42, 0x18, 0x6D, 0xF0, 0xDC, 0xC0,
+    0x0E, 0x0E, 0x60, 0x15, 0x5B, 0x44, 0x25, 0xC2, 0xD3, 0x18, 0xE9, 0xEE, 0xBA, 0xAF, 0x77, 0x82,
+    0xFB, 0x86, 0x81, 0x2A, 0x86, 0x9A, 0x32, 0xD8, 0x90, 0xE1, 0x42, 0x06, 0xC4, 0xAE, 0x97, 0x7D,
+    0x88, 0x32, 0x0E, 0x9C, 0x82, 0x61, 0xF7, 0xE9, 0x9B, 0x24, 0x6B, 0xA4, 0x18, 0xB2, 0xFD, 0x0E,
+    0xFA, 0xFA, 0x22, 0x27, 0x37, 0x07, 0xE1, 0xEC, 0x29, 0xF5, 0xD4, 0x16, 0x32, 0xE8, 0x26, 0x7E,
+    0x01, 0xD6, 0x07, 0xE1, 0x57, 0x24, 0x02, 0xD6, 0xE4, 0x96, 0xD4, 0x2B, 0x28, 0xD4, 0x48, 0x0B,
+    0x1C, 0xD9, 0x80, 0x1A, 0xE4, 0x04, 0x37, 0x71, 0x90, 0x61, 0x26, 0x90, 0x81, 0xD5, 0xB4, 0x22,
+    0xD2, 0x07, 0x99, 0x6F, 0x9C, 0x0A, 0x40, 0x09, 0xD5, 0x5E, 0xD9, 0xCB, 0x23, 0x3D, 0xB1, 0x9F,
+    0xED, 0xB5, 0xC2, 0xA4, 0x1C, 0xF0, 0xF7, 0x2A, 0x68, 0x2A, 0xCC, 0xF0, 0x88, 0x09, 0x18, 0x05,
+    0x98, 0x30, 0x31, 0x76, 0x3D, 0xF0, 0x08, 0x20, 0x57, 0x98, 0x49, 0xC4, 0xF5, 0x0D, 0x71, 0x1A,
+    0x73, 0x6A, 0xEB, 0x95, 0x09, 0x7F, 0x7A, 0x8F, 0xC2, 0x86, 0xDE, 0x41, 0xC6, 0xF2, 0x6B, 0x80,
+    0x25, 0xCA, 0xE3, 0x07, 0x78, 0x37, 0x82, 0x18, 0x87, 0x62, 0x8F, 0xB5, 0xCF, 0x08, 0x9E, 0x61,
+    0xB2, 0xFC, 0x7E, 0x62, 0x43, 0x38, 0x16, 0xC1, 0x04, 0xFD, 0x82, 0x79, 0x6D, 0x43, 0x54, 0x68,
+    0xBB, 0xC4, 0x47, 0x11, 0x29, 0x54, 0xDF, 0x20, 0xCC, 0x2E, 0x31, 0xFE, 0xB6, 0xC0, 0x4F, 0x38,
+    0x34, 0xB7, 0x2D, 0x69, 0xE7, 0x8B, 0x6D, 0x88, 0x36, 0x90, 0x36, 0x44, 0xEB, 0xCF, 0xDB, 0x96,
+    0xB4, 0x4D, 0xB4, 0x15, 0x1B, 0xD4, 0xDB, 0xE0, 0x3F, 0x41, 0xA0, 0x6F, 0x28, 0xD5, 0x0D, 0xA8,
+    0xA5, 0xF8, 0x62, 0x93, 0xC2, 0xA5, 0xA6, 0xE4, 0x9C, 0x4D, 0xC3, 0x3A, 0x82, 0x5D, 0xFA, 0x39,
+    0x4D, 0x61, 0xAC, 0x53, 0x08, 0x68, 0x9F, 0x05, 0x8D, 0x61, 0x02, 0x63, 0x88, 0x3E, 0x86, 0xF6,
+    0x27, 0xB0, 0xCB, 0x04, 0xFE, 0x97, 0x28, 0x9B, 0x9F, 0x06, 0x6D, 0x5B, 0xBC, 0xBE, 0xCB, 0x69,
+    0x04, 0xAD, 0x21, 0xD9, 0x20, 0x66, 0x83, 0x1A, 0xE0, 0xF1, 0x2E, 0x98, 0x34, 0x86, 0x47, 0x7B,
+    0x57, 0xF1, 0xF6, 0x5B, 0xB0, 0x23, 0xBA, 0x0E, 0x23, 0xA2, 0xA7, 0xF0, 0x07, 0xB7, 0x80, 0x36,
+    0x42, 0x76, 0x85, 0x23, 0x96, 0x68, 0x17, 0xAF, 0xB9, 0xAC, 0x09, 0x21, 0x1B, 0xA5, 0x0F, 0x53,
+    0xF6, 0x1F, 0x54, 0x0E, 0x60, 0x6A, 0xAE, 0xE0, 0xF5, 0x87, 0x8C, 0x7B, 0x65, 0x4D, 0xF6, 0x94,
+    0x53, 0x58, 0x9F, 0x43, 0x22, 0xDD, 0x83, 0x61, 0xC2, 0xEB, 0x60, 0x51, 0x30, 0x28, 0x0E, 0x39,
+    0x20, 0xFE, 0xBE, 0x7C, 0x41, 0x5C, 0x39, 0x62, 0x79, 0xDC, 0xBF, 0x2B, 0xEF, 0x65, 0xD6, 0xBB,
+    0x9F, 0xC1, 0x20, 0xDF, 0x27, 0x33, 0xA0, 0x7B, 0x63, 0xFE, 0x6C, 0x53, 0x78, 0xA7, 0xA5, 0x57,
+    0x47, 0xD1, 0x2B, 0x23, 0x07, 0x4E, 0xF8, 0x13, 0x19, 0x79, 0xB3, 0x1F, 0x85, 0x36, 0x38, 0x79,
+    0x58, 0x5E, 0x1B, 0x04, 0x7F, 0xD6, 0xFC, 0x67, 0xB7, 0x2B, 0xC9, 0xBA, 0xF8, 0xE4, 0xFC, 0xAF,
+    0x68, 0x47, 0xDE, 0x17, 0x65, 0x17, 0x0D, 0xF3, 0xAE, 0x4A, 0x8A, 0xB2, 0xB4, 0x1D, 0x85, 0xDA,
+    0x86, 0x44, 0x67, 0xDB, 0xA1, 0x35, 0x31, 0x04, 0xB1, 0x25, 0x97, 0x71, 0xBC, 0x62, 0x69, 0x24,
+    0x25, 0x97, 0x44, 0x43, 0x1E, 0x5D, 0xF5, 0xF2, 0x55, 0x5A, 0x77, 0x8C, 0x4B, 0xF1, 0xC7, 0x7F,
+    0x6B, 0x28, 0xFA, 0xF7, 0x7F, 0x91, 0xF8, 0x21, 0x13, 0x45, 0x5C, 0x27, 0x5E, 0x4E, 0x67, 0x8F,
+    0xE8, 0x3B, 0x4F, 0x9A, 0x4F, 0xE0, 0x3E, 0x4C, 0xC0, 0x67, 0xCE, 0x11, 0x27, 0xA0, 0x80, 0x39,
+    0xEF, 0xF0, 0x6A, 0x23, 0xB1, 0xCF, 0x08, 0xDD, 0x84, 0x5D, 0xAC, 0x42, 0x27, 0x96, 0x8C, 0x3C,
+    0xC0, 0x23, 0xE6, 0xB9, 0xC6, 0xD1, 0x7D, 0xDD, 0xA1, 0x93, 0x25, 0xA9, 0x48, 0x21, 0xB1, 0x58,
+    0x62, 0xF0, 0xD0, 0xC6, 0x60, 0x22, 0x49, 0x6C, 0x12, 0xBD, 0x25, 0x9D, 0x49, 0x26, 0x8B, 0xA8,
+    0x33, 0x9A, 0xE9, 0x7C, 0x11, 0xC5, 0x6B, 0xD0, 0xAB, 0x0E, 0x5D, 0x18, 0x08, 0x7A, 0x38, 0x47,
+    0xE7, 0x4A, 0x68, 0xF2, 0xC9, 0x0E, 0xBD, 0xFA, 0x9B, 0x8C, 0xF8, 0xDB, 0x69, 0x5F, 0x76, 0x04,
+    0x6B, 0x63, 0x84, 0x98, 0x8B, 0xFB, 0x5A, 0xAA, 0x50, 0x69, 0xBE, 0xE1, 0xDE, 0x48, 0x94, 0x85,
+    0x7C, 0x33, 0x18, 0x6E, 0x0B, 0xB6, 0x31, 0x2F, 0xC6, 0xD9, 0xAD, 0x3E, 0xE2, 0xC0, 0xDE, 0xF8,
+    0x30, 0xFB, 0xF8, 0x51, 0xFA, 0xE0, 0xCB, 0x3B, 0xF5, 0x55, 0x0A, 0x5E, 0x28, 0xB6, 0x45, 0xB8,
+    0x19, 0xFB, 0x06, 0xAF, 0x7B, 0x28, 0x01, 0x81, 0x1F, 0xAC, 0xE5, 0x43, 0x1B, 0x80, 0x6A, 0x09,
+    0x74, 0x08, 0x07, 0x0E, 0x80, 0xC3, 0x9C, 0xFC, 0x52, 0x7C, 0x8E, 0x3F, 0xD9, 0x94, 0xCB, 0x11,
+    0x69, 0x60, 0xD5, 0x32, 0xB6, 0xCA, 0x6D, 0x1F, 0xEB, 0x44, 0x8B, 0x45, 0x48, 0x97, 0x4F, 0x85,
+    0x23, 0x3C, 0x32, 0x30, 0xF3, 0x07, 0x97, 0x27, 0xC5, 0x32, 0x02, 0x0B, 0x8D, 0xFA, 0x1B, 0x46,
+    0x83, 0x98, 0xF3, 0x28, 0xD5, 0x29, 0x41, 0xE2, 0x2C, 0xE1, 0xED, 0xCB, 0x27, 0xB2, 0x4F, 0xDC,
+    0xFB, 0xD2, 0xF7, 0xE4, 0x4D, 0x90, 0x49, 0x99, 0xAA, 0x20, 0x0B, 0x44, 0x45, 0x0F, 0x49, 0x07,
+    0xB2, 0x86, 0x81, 0xC8, 0x39, 0x90, 0xDB, 0xFA, 0xE0, 0xBC, 0x5F, 0xA7, 0x85, 0xB8, 0xD4, 0x09,
+    0x38, 0x11, 0xC1, 0xE6, 0xF7, 0x4C, 0x82, 0xC8, 0x3A, 0xB5, 0x51, 0x0A, 0xB4, 0x3E, 0x6A, 0x74,
+    0xEC, 0xB1, 0x2E, 0xBD, 0xD9, 0x9D, 0x3A, 0x86, 0xCC, 0x47, 0x52, 0x19, 0x2F, 0x77, 0x13, 0xEE,
+    0x6A, 0x56, 0x50, 0xC5, 0x55, 0x4A, 0x01, 0xE9, 0x62, 0xDD, 0x67, 0xAD, 0xF5, 0xD9, 0x73, 0xFA,
+    0xAC, 0xF2, 0x3E, 0xAB, 0x6D, 0x93, 0xBB, 0x95, 0x65, 0x5D, 0xC5, 0xBC, 0x13, 0xA9, 0x82, 0x72,
+    0x52, 0x8D, 0x2E, 0xA1, 0x9E, 0xB1, 0x20, 0x7C, 0xA0, 0x22, 0xAE, 0x3B, 0x09, 0xC7, 0xA9, 0x64,
+    0x6E, 0xBA, 0x15, 0xD9, 0x8D, 0x90, 0x9D, 0x93, 0xCD, 0xB1, 0xC6, 0x3D, 0x91, 0x1C, 0xD0, 0xF9,
+    0xAA, 0xF8, 0xAF, 0x7C, 0x64, 0xFF, 0xB2, 0x71, 0xE5, 0x50, 0xD2, 0x0A, 0x47, 0xB9, 0xD1, 0x2D,
+    0x62, 0xCA, 0x39, 0x7D, 0x99, 0x36, 0x15, 0x99, 0x08, 0x01, 0x10, 0x5D, 0x73, 0xDC, 0x29, 0xEE,
+    0xF4, 0x29, 0x9D, 0x5A, 0x82, 0x13, 0x34, 0x21, 0x90, 0x93, 0xE1, 0xE3, 0xC6, 0x45, 0x3A, 0x7B,
+    0x7D, 0x0F, 0x62, 0xB9, 0x2C, 0x1B, 0x0A, 0xE0, 0xDB, 0x79, 0x88, 0x2A, 0x38, 0x8F, 0xB8, 0x8B,
+    0xDF, 0xDE, 0x09, 0x5C, 0xC0, 0x1D, 0x70, 0x7F, 0x6B, 0xA9, 0xD0, 0x65, 0x9B, 0x04, 0x76, 0xE5,
+    0x88, 0x48, 0x83, 0x1F, 0x43, 0xF0, 0x2D, 0x7C, 0xD6, 0xDC, 0x65, 0xF3, 0x2E, 0x9F, 0x77, 0xC5,
+    0xF2, 0xF4, 0x18, 0x44, 0x0F, 0x9F, 0x00, 0x57, 0xA8, 0x20, 0x9F, 0x68, 0x6B, 0xC0, 0xEC, 0x44,
+    0xDC, 0xD8, 0x25, 0xD0, 0xAE, 0x7A, 0xD9, 0x6A, 0xF2, 0xF1, 0x1F, 0x67, 0xBC, 0x75, 0x12, 0xFC,
+    0x38, 0xEC, 0xC5, 0xD8, 0xB6, 0xC3, 0x18, 0x9A, 0x8F, 0xB4, 0x57, 0x06, 0x28, 0x74, 0x10, 0x73,
+    0x10, 0xD2, 0x56, 0x60, 0xC0, 0x89, 0x4E, 0x74, 0x4C, 0xA7, 0x5D, 0x38, 0x9C, 0xAA, 0x08, 0x87,
+    0x51, 0x94, 0x17, 0x5C, 0x1C, 0x15, 0x1C, 0x94, 0xCF, 0x9A, 0x9C, 0xBE, 0xFE, 0xEB, 0x2C, 0xB9,
+    0xF4, 0x82, 0xEA, 0xE9, 0x2A, 0xFB, 0x8B, 0xD2, 0x98, 0x20, 0x76, 0xA7, 0x7C, 0x24, 0x85, 0xBB,
+    0x0F, 0xC4, 0x83, 0x4A, 0x1B, 0xFF, 0x39, 0x0C, 0x72, 0x7C, 0xE2, 0x0C, 0xC0, 0x31, 0x3E, 0xA4,
+    0xE3, 0xEA, 0x62, 0x6A, 0xB3, 0x80, 0x80, 0x19, 0xCB, 0xFA, 0x18, 0xEC, 0x03, 0xA9, 0x8E, 0x06,
+    0x68, 0x53, 0x2E, 0xDD, 0x58, 0xE3, 0x1B, 0x9C, 0x32, 0x1D, 0x72, 0xD9, 0xCE, 0xC8, 0xD7, 0x01,
+    0x27, 0x3F, 0x64, 0x95, 0x48, 0x5D, 0x6A, 0x9A, 0x87, 0xCF, 0x38, 0xFA, 0x60, 0x50, 0xD1, 0xF7,
+    0x25, 0xDA, 0x69, 0x5B, 0x9E, 0xA0, 0xF4, 0xE7, 0xAD, 0xFC, 0x55, 0x0A, 0xDD, 0x81, 0x3A, 0xB6,
+    0xD2, 0x31, 0xA8, 0x1C, 0xE8, 0x1E, 0xEB, 0x75, 0xB3, 0xDD, 0xCA, 0xBB, 0xBC, 0x84, 0x03, 0xD0,
+    0xD6, 0x07, 0xDF, 0x86, 0xC4, 0x07, 0x30, 0x96, 0xEA, 0x00, 0x2E, 0x3C, 0xFC, 0x83, 0xB1, 0xE7,
+    0x9A, 0x8D, 0x3B, 0xCD, 0xC3, 0x6D, 0x5B, 0xE4, 0x3C, 0x69, 0x1E, 0xEF, 0xC9, 0x3B, 0x8A, 0xF9,
+    0x6B, 0x0D, 0x38, 0xCF, 0x00, 0xC3, 0xCD, 0x0E, 0xDE, 0xB5, 0x54, 0xDA, 0x6E, 0x7E, 0xF1, 0xDA,
+    0x38, 0xC8, 0x7B, 0xAC, 0x92, 0xDD, 0xD7, 0x6D, 0x36, 0x0B, 0x15, 0xEB, 0xB6, 0xBD, 0xD9, 0x2E,
+    0xB6, 0x2D, 0xAD, 0x05, 0x9A, 0x38, 0x0C, 0x54, 0xA1, 0xA2, 0x3A, 0xBC, 0x89, 0x03, 0x9C, 0x8B,
+    0x30, 0x9A, 0x4F, 0xB1, 0x8E, 0x31, 0xD7, 0xEE, 0x68, 0x01, 0xD2, 0x2C, 0x4E, 0x39, 0x7D, 0x28,
+    0x18, 0x8D, 0x6B, 0xF7, 0x2D, 0x5F, 0x3F, 0x85, 0x4D, 0xDD, 0xED, 0x51, 0x71, 0xE5, 0x84, 0xA4,
+    0x64, 0x09, 0x1F, 0x3F, 0x5E, 0x2F, 0xF2, 0x6B, 0xD7, 0x81, 0x8E, 0x8F, 0x01, 0x58, 0x4B, 0xAC,
+    0xED, 0x83, 0xDA, 0x93, 0xC1, 0x39, 0x2E, 0x75, 0x8A, 0x48, 0xED, 0x6C, 0x51, 0x24, 0xA1, 0x1A,
+    0xB5, 0x8C, 0xB2, 0x96, 0xED, 0x65, 0xFE, 0xF2, 0xCE, 0xB9, 0xD8, 0x9D, 0xBA, 0x76, 0xB7, 0x38,
+    0x17, 0x8D, 0x55, 0xDB, 0x59, 0x21, 0x94, 0x88, 0x84, 0xC8, 0x63, 0x67, 0x7C, 0x3E, 0x92, 0x43,
+    0x52, 0x2C, 0x6A, 0x89, 0xDE, 0x4A, 0xEC, 0xB2, 0x90, 0x88, 0xD5, 0x4A, 0xEB, 0x29, 0x9C, 0x36,
+    0xDB, 0xEE, 0xF0, 0x6D, 0xB8, 0x8C, 0xB3, 0x06, 0xC6, 0x4E, 0x05, 0x21, 0xBC, 0x1A, 0x23, 0xB7,
+    0xE6, 0x8D, 0x79, 0xFA, 0x36, 0xC4, 0x9F, 0x2E, 0x33, 0x3A, 0xE2, 0x6E, 0xCD, 0xD6, 0xAC, 0x56,
+    0x4B, 0xC5, 0xC2, 0x63, 0xD7, 0x2B, 0x5C, 0x54, 0x32, 0x95, 0x57, 0x48, 0x4D, 0x89, 0x07, 0x4E,
+    0x3F, 0xA5, 0xCC, 0x68, 0xDB, 0x2B, 0x24, 0xFF, 0x2E, 0x21, 0x2C, 0x3D, 0xEC, 0x3F, 0x99, 0xAA,
+    0x7D, 0x8C, 0x46, 0xB7, 0x3F, 0x97, 0x7A, 0xF3, 0x34, 0x04, 0x05, 0x62, 0x64, 0x49, 0x67, 0xC2,
+    0x28, 0xB4, 0xFC, 0x70, 0x22, 0x73, 0x0A, 0x9C, 0x9C, 0xF5, 0x2B, 0x78, 0xEE, 0x6E, 0x1B, 0xDF,
+    0xF9, 0x3F, 0xB2, 0x45, 0x77, 0x7A, 0x0F, 0xB5, 0x56, 0xAA, 0x13, 0xD5, 0x5F, 0xCA, 0x02, 0xC7,
+    0xFF, 0x92, 0x75, 0x18, 0x2B, 0xA2, 0x45, 0x1C, 0xA6, 0x74, 0x87, 0x7F, 0xAD, 0xC5, 0xFC, 0xE0,
+    0x04, 0x0E, 0x12, 0xE8, 0x5F, 0xED, 0x3F, 0x44, 0x5E, 0x76, 0xCE, 0x7F, 0xAF, 0xEE, 0xE4, 0x3E,
+    0xFF, 0x8A, 0x73, 0xFD, 0x0B, 0x95, 0xCE, 0xE2, 0x3A, 0xAA, 0x02, 0xD3, 0x2B, 0xBC, 0xEC, 0xAC,
+    0x58, 0xF6, 0xDF, 0x2B, 0x47, 0x79, 0x99, 0x9F, 0x07, 0x26, 0x2C, 0xE3, 0x3A, 0x9D, 0x9D, 0x1D,
+    0xD3, 0xD5, 0xBD, 0xE2, 0xFA, 0x87, 0xFB, 0xEF, 0x6E, 0x6D, 0x05, 0xE6, 0xEC, 0x3C, 0xB1, 0x42,
+    0x7D, 0x5B, 0x7F, 0x15, 0xCD, 0xFC, 0x1F, 0xED, 0x53, 0xB1, 0x6E, 0xDB, 0x30, 0x10, 0x7D, 0x94,
+    0x9A, 0xA8, 0xA8, 0x06, 0x79, 0x70, 0x96, 0x0E, 0x55, 0x86, 0xCE, 0xD6, 0xAA, 0x26, 0x92, 0xA5,
+    0xA0, 0x3F, 0xE0, 0x21, 0xFD, 0x83, 0x4C, 0xFE, 0x02, 0x0D, 0x4A, 0x4C, 0xA0, 0x3F, 0x90, 0xDD,
+    0x4B, 0x87, 0x0E, 0x89, 0x33, 0x64, 0x31, 0x50, 0x0F, 0x46, 0x4D, 0xA0, 0x63, 0x17, 0xEE, 0x1D,
+    0x2A, 0xA0, 0xDD, 0x32, 0x84, 0x83, 0x06, 0x21, 0xB0, 0x7B, 0x3D, 0xCA, 0x4E, 0x50, 0x23, 0x40,
+    0xD1, 0x8E, 0x05, 0xCA, 0x7B, 0x20, 0xC8, 0xE3, 0x91, 0xBC, 0x7B, 0x77, 0x87, 0x2E, 0x3C, 0x92,
+    0xC1, 0x6D, 0x15, 0x09, 0xD3, 0x47, 0x93, 0x62, 0x5E, 0xA2, 0x7C, 0x00, 0x6F, 0x59, 0x19, 0x89,
+    0x9A, 0x0D, 0x5C, 0x92, 0xE8, 0x02, 0x49, 0x8C, 0x4E, 0xFC, 0x30, 0x58, 0x01, 0xF8, 0x1A, 0xA1,
+    0x46, 0xA6, 0xF1, 0x41, 0x8B, 0x6F, 0xDA, 0xFD, 0xA4, 0x83, 0xD7, 0xFA, 0x85, 0xAB, 0x13, 0x57,
+    0x2F, 0x68, 0xC5, 0x80, 0xAB, 0x37, 0x68, 0x47, 0x46, 0xEA, 0x6C, 0x22, 0x0B, 0x60, 0x8D, 0x45,
+    0x83, 0x05, 0xE5, 0x9D, 0x50, 0xC1, 0xAD, 0xE0, 0x54, 0x3C, 0xE7, 0x9E, 0xBE, 0xBB, 0x56, 0xF4,
+    0x03, 0x3B, 0x03, 0x60, 0x27, 0x07, 0x19, 0xEF, 0xEE, 0x5D, 0x20, 0xD1, 0x03, 0x52, 0x76, 0x60,
+    0x21, 0x47, 0x64, 0x46, 0x68, 0xD8, 0xBF, 0x04, 0x49, 0x82, 0x32, 0x42, 0x13, 0xDC, 0x18, 0x97,
+    0x34, 0xBA, 0xEB, 0xF7, 0x97, 0x19, 0x35, 0x40, 0x0D, 0x61, 0xEC, 0xA7, 0x9E, 0x02, 0x5F, 0x0E,
+    0x81, 0x3E, 0x5F, 0x06, 0x66, 0xF6, 0xC4, 0x31, 0xF7, 0xEE, 0xD8, 0xF8, 0x55, 0x30, 0x36, 0x11,
+    0xEA, 0x1E, 0x6A, 0x66, 0x21, 0xB8, 0xD1, 0x2E, 0xE5, 0xFE, 0xAD, 0x8E, 0x9C, 0x3A, 0xC5, 0x2C,
+    0xB1, 0x2C, 0x34, 0xD1, 0xD8, 0xF8, 0xA4, 0x70, 0x0C, 0x86, 0x4F, 0x32, 0x1A, 0x57, 0x29, 0xEA,
+    0x12, 0xB3, 0x96, 0xA6, 0x79, 0x5F, 0x2C, 0x43, 0x9A, 0x7B, 0xAB, 0xA2, 0x7D, 0x9D, 0x9F, 0xAE,
+    0x9E, 0x5D, 0xAB, 0x60, 0xED, 0x7F, 0x0E, 0x54, 0x1B, 0x5C, 0xDD, 0x49, 0x22, 0x25, 0xEE, 0xB7,
+    0x38, 0xC7, 0x64, 0x62, 0x35, 0xEC, 0xC5, 0xF0, 0x7E, 0xC1, 0x63, 0x41, 0xAA, 0x5D, 0x7B, 0x32,
+    0xE0, 0x90, 0xF9, 0x7F, 0x4C, 0xD9, 0x63, 0xD3, 0x4A, 0xCD, 0xEB, 0x82, 0x75, 0x29, 0xC7, 0xE3,
+    0xE7, 0x8E, 0xB4, 0x11, 0xF5, 0x10, 0xC0, 0x97, 0xAE, 0x62, 0xD1, 0xCE, 0x46, 0xEC, 0x8E, 0xEF,
+    0xE7, 0x21, 0x5B, 0x9E, 0xA0, 0xB3, 0x87, 0x03, 0xAA, 0xB2, 0xA3, 0x3A, 0x41, 0x91, 0x20, 0x66,
+    0xC4, 0xDB, 0xE8, 0xA2, 0x8B, 0xBF, 0x2D, 0x04, 0x88, 0xA5, 0xBF, 0x1C, 0xCD, 0xCB, 0xB2, 0xC3,
+    0xE7, 0x8F, 0x64, 0x43, 0x54, 0x76, 0x55, 0x3D, 0xE5, 0x2C, 0xB0, 0xE7, 0x3C, 0x33, 0xE9, 0x9C,
+    0x8B, 0x30, 0xC7, 0x29, 0x44, 0x0D, 0x4F, 0xDB, 0x65, 0x46, 0x86, 0x81, 0xD6, 0x3E, 0x24, 0x95,
+    0x8D, 0x4D, 0xF7, 0xC1, 0xDE, 0xD7, 0x1E, 0xE5, 0xCE, 0x75, 0x65, 0xAD, 0xD1, 0x58, 0x88, 0xFA,
+    0xEC, 0xCA, 0x8C, 0x48, 0x8A, 0x63, 0xFC, 0x2F, 0xBC, 0x7F, 0xA0, 0xF0, 0x76, 0x2F, 0x11, 0x91,
+    0x7C, 0xE2, 0x2A, 0x38, 0x9A, 0x11, 0x92, 0x3E, 0x75, 0xB4, 0x61, 0xB8, 0xBA, 0x09, 0x75, 0xD6,
+    0x68, 0x26, 0x59, 0x5C, 0x22, 0x20, 0x99, 0x3A, 0xBA, 0x80, 0x99, 0xC2, 0x10, 0x19, 0xCE, 0xF6,
+    0x14, 0xB6, 0x86, 0xA2, 0x7C, 0xE0, 0x33, 0xB9, 0x6F, 0xD6, 0x36, 0x2A, 0x15, 0xA6, 0x40, 0x31,
+    0x45, 0x62, 0x5A, 0xB0, 0x43, 0xEC, 0x61, 0xCF, 0x61, 0x82, 0x24, 0xB3, 0xF3, 0x12, 0x27, 0x3D,
+    0x18, 0xAE, 0x00, 0xF7, 0xB3, 0x14, 0x04, 0xCC, 0x81, 0x15, 0x9C, 0xAF, 0xF0, 0xDF, 0xAA, 0x50,
+    0x54, 0x89, 0x25, 0x08, 0xCF, 0xDF, 0x63, 0x44, 0xB9, 0x4D, 0x8C, 0x25, 0xC3, 0x0C, 0x27, 0xF6,
+    0x3B, 0x0E, 0x6F, 0x2A, 0xAA, 0xD4, 0xB3, 0xC4, 0x61, 0x80, 0x18, 0xBF, 0x60, 0x98, 0x1F, 0x12,
+    0xB7, 0xC3, 0xA6, 0x71, 0xE2, 0x47, 0x00, 0xB6, 0xED, 0x71, 0x1E, 0x7B, 0x2A, 0x0E, 0x11, 0x97,
+    0x78, 0x65, 0x90, 0x55, 0xE8, 0xCF, 0x90, 0xA4, 0x88, 0x03, 0x58, 0xBD, 0x63, 0x0B, 0x3D, 0xDE,
+    0x1E, 0xD8, 0x1F, 0x72, 0x74, 0x87, 0xF4, 0x85, 0x24, 0x67, 0x93, 0x8B, 0x17, 0xB5, 0xE0, 0xC9,
+    0x88, 0x2A, 0xFE, 0xED, 0xD4, 0x66, 0x6C, 0xFF, 0x0F, 0xFC, 0x6B, 0x6D, 0xAA, 0xD6, 0xC6, 0x96,
+    0x6D, 0x6C, 0x2B, 0xD7, 0x22, 0x45, 0x91, 0x1D, 0x99, 0x03, 0xD2, 0xF1, 0xDE, 0x56, 0x0C, 0xBB,
+    0x17, 0xCC, 0x11, 0xDA, 0x1E, 0xE4, 0x46, 0x45, 0xF8, 0x1D, 0xE2, 0x23, 0x10, 0x30, 0x6B, 0xF9,
+    0x79, 0x08, 0x6E, 0x2A, 0xCE, 0x99, 0x07, 0x1F, 0xE1, 0xC5, 0x62, 0x19, 0x60, 0x4B, 0xA4, 0xB7,
+    0xC2, 0xF1, 0x4F, 0xAD, 0x58, 0x3D, 0x8F, 0xDC, 0xD6, 0x15, 0xBD, 0x24, 0x2D, 0x11, 0x36, 0x0B,
+    0xBA, 0x88, 0x25, 0xC0, 0x80, 0xC5, 0x14, 0x6E, 0x02, 0x24, 0x22, 0x52, 0xA4, 0xDB, 0x1D, 0x32,
+    0x51, 0x91, 0x32, 0x5B, 0x68, 0xE5, 0x62, 0x81, 0x54, 0xAE, 0xB2, 0x08, 0xB6, 0x95, 0x01, 0xED,
+    0x90, 0x49, 0x7E, 0x40, 0xB6, 0xB0, 0x92, 0x32, 0x2A, 0x1C, 0x40, 0x1E, 0x17, 0xAB, 0x42, 0x85,
+    0x0A, 0xAD, 0x48, 0xD9, 0x45, 0x8A, 0x14, 0x61, 0xEC, 0x04, 0x2E, 0x52, 0x88, 0x40, 0x22, 0x28,
+    0x91, 0x8A, 0x25, 0x12, 0x2A, 0xE2, 0xAE, 0xC8, 0x79, 0x39, 0xE7, 0x3E, 0xCE, 0xEC, 0xAC, 0x6C,
+    0x19, 0x46, 0x92, 0x01, 0x78, 0xEE, 0xCC, 0xFB, 0xE2, 0x7B, 0xF7, 0xE3, 0xDC, 0xFB, 0x46, 0x84,
+    0x9F, 0xE2, 0x48, 0xC4, 0x37, 0x73, 0x91, 0xB0, 0xFE, 0xB6, 0x48, 0x92, 0xA2, 0x29, 0x61, 0xFB,
+    0x2E, 0xE1, 0x2E, 0xA1, 0x97, 0xD9, 0x2C, 0xED, 0xC5, 0x98, 0xB2, 0x97, 0xF9, 0x2C, 0x3F, 0x40,
+    0x83, 0x4C, 0x09, 0x09, 0x21, 0x46, 0xAB, 0x84, 0x66, 0x3E, 0x4B, 0x5D, 0x63, 0x4C, 0x2A, 0x67,
+    0x86, 0x4D, 0x9D, 0xF3, 0x12, 0xC0, 0x2A, 0x23, 0x7C, 0xE3, 0x0C, 0x7E, 0xAE, 0x5D, 0x00, 0x5C,
+    0xBD, 0x08, 0xB8, 0x87, 0x17, 0x06, 0xC6, 0xE4, 0x52, 0xA0, 0xD7, 0x35, 0x4D, 0x96, 0xFB, 0x4F,
+    0xEB, 0x3B, 0x12, 0x7E, 0x5A, 0xB5, 0x12, 0x7D, 0x52, 0x35, 0x92, 0x5C, 0x2A, 0x01, 0xDE, 0xFD,
+    0x5A, 0x12, 0xFF, 0xE7, 0xB5, 0x4C, 0x83, 0x4B, 0x95, 0x4C, 0xC3, 0x4B, 0xA5, 0x4C, 0x42, 0xAF,
+    0x94, 0x24, 0xF2, 0x73, 0x49, 0x2E, 0x04, 0xA9, 0xC4, 0x3F, 0x0D, 0x53, 0x89, 0xFA, 0x10, 0xBB,
+    0x22, 0x78, 0x03, 0x5E, 0xE1, 0x18, 0xB3, 0xAF, 0x2B, 0xE7, 0xF2, 0x6F, 0x83, 0x03, 0x37, 0x6B,
+    0x68, 0x6B, 0xAE, 0x02, 0xEA, 0xDB, 0x32, 0x7E, 0xCE, 0xB2, 0x23, 0xE6, 0x10, 0xF3, 0xE7, 0x22,
+    0xF5, 0x06, 0x71, 0xC4, 0x6F, 0xD0, 0x1E, 0x56, 0x80, 0x08, 0x1B, 0x96, 0x78, 0xA9, 0x9C, 0x44,
+    0xDE, 0xBD, 0x98, 0x26, 0x72, 0x64, 0x00, 0xE6, 0x39, 0x21, 0x45, 0xDB, 0x30, 0xAA, 0xC4, 0xEA,
+    0x05, 0x2A, 0x93, 0x28, 0xA7, 0x72, 0xA8, 0xA1, 0xA0, 0x01, 0x78, 0x5D, 0xCF, 0xBD, 0xF4, 0x5B,
+    0x22, 0x99, 0x31, 0x3C, 0x2F, 0xF4, 0x2E, 0x6F, 0x88, 0x50, 0x75, 0xAB, 0xC0, 0xF7, 0x7E, 0x1D,
+    0x30, 0x66, 0x20, 0xCC, 0xC7, 0x6F, 0xA7, 0x7B, 0xB7, 0x8F, 0x6F, 0xC2, 0xBC, 0x68, 0x97, 0xED,
+    0xF9, 0xCD, 0x2F, 0x5F, 0x60, 0x71, 0xF2, 0xBF, 0xE9, 0xC9, 0xB1, 0xAB, 0xEB, 0xF7, 0x04, 0xC7,
+    0x78, 0x45, 0x9C, 0x0E, 0xED, 0x4E, 0xCB, 0x71, 0xA7, 0x61, 0xFB, 0x78, 0x06, 0x05, 0xD1, 0x80,
+    0xDB, 0xF0, 0x85, 0x95, 0x0E, 0x9A, 0xCD, 0x76, 0xBC, 0x73, 0xB4, 0x99, 0xDA, 0x36, 0xAF, 0x59,
+    0x40, 0x48, 0xFD, 0x15, 0x8F, 0x67, 0xB3, 0xDC, 0x70, 0x8C, 0x82, 0x9C, 0x7C, 0xD6, 0xAD, 0xB8,
+    0x66, 0x45, 0xAB, 0xE8, 0x60, 0xDE, 0x5A, 0x60, 0x2E, 0xE1, 0x74, 0xEB, 0x99, 0x79, 0x84, 0x09,
+    0xC9, 0xD1, 0x96, 0x79, 0xB8, 0x53, 0x27, 0x70, 0x8F, 0xD4, 0x6B, 0x12, 0xEC, 0x03, 0xAF, 0x49,
+    0xB8, 0x61, 0x15, 0x3D, 0x36, 0xBC, 0x14, 0xAE, 0x15, 0x9E, 0x15, 0xBE, 0x15, 0xA1, 0x15, 0x91,
+    0x15, 0xEB, 0x56, 0x5C, 0xB3, 0xA2, 0x53, 0xE1, 0x34, 0x2A, 0xDC, 0x9A, 0x42, 0x3C, 0xBB, 0xC7,
+    0x20, 0x57, 0x11, 0xDA, 0xDD, 0xBD, 0xA9, 0xE8, 0xC1, 0x2B, 0xB9, 0x7A, 0x0C, 0x07, 0x23, 0xCC,
+    0x09, 0x86, 0x70, 0x98, 0x02, 0x1E, 0x94, 0x80, 0xCF, 0x01, 0xDB, 0xCF, 0x8F, 0x8B, 0x0F, 0xA0,
+    0x1B, 0xD3, 0x6D, 0x1F, 0xE3, 0x9B, 0x57, 0x75, 0x98, 0x56, 0xDF, 0x8D, 0xA0, 0x48, 0x53, 0xDC,
+    0xD4, 0x8E, 0x77, 0x1E, 0xEE, 0xEC, 0xBF, 0xEF, 0xD5, 0xE1, 0x6F, 0xD0, 0x11, 0x3E, 0x00, 0xF8,
+    0x87, 0x00, 0x2C, 0xE6, 0xD5, 0x2E, 0xC1, 0x21, 0x88, 0x42, 0x21, 0xD9, 0x31, 0x9D, 0x30, 0x33,
+    0x9D, 0x8C, 0x3E, 0x84, 0x40, 0x2D, 0x72, 0x22, 0x5D, 0x74, 0x57, 0x15, 0xBD, 0x2B, 0x41, 0x65,
+    0xF1, 0xAA, 0xE2, 0x1D, 0x6D, 0xEF, 0x80, 0xF1, 0xEF, 0x4C, 0xB3, 0xEB, 0x14, 0xB1, 0x69, 0x33,
+    0x33, 0x9C, 0x1B, 0x36, 0x32, 0xD3, 0x4A, 0x27, 0xD9, 0x87, 0x22, 0x9D, 0x06, 0xFC, 0xD7, 0xC1,
+    0x41, 0xB1, 0xE8, 0x88, 0x71, 0xA7, 0x96, 0x4A, 0x93, 0x79, 0xAA, 0x61, 0xA1, 0xDB, 0x92, 0x64,
+    0x9F, 0x6E, 0x2D, 0x13, 0xC9, 0xAC, 0xD0, 0xB8, 0x99, 0x20, 0x18, 0x54, 0x84, 0x65, 0x36, 0x50,
+    0xDC, 0xC7, 0xEE, 0xD1, 0xF8, 0x8B, 0xEE, 0xC7, 0x1C, 0xF2, 0xC3, 0x9A, 0x7D, 0x89, 0x8F, 0x8D,
+    0x4F, 0xAE, 0xCC, 0xFD, 0x5A, 0x17, 0xF3, 0x3A, 0x8A, 0x0A, 0xE6, 0x96, 0x09, 0x62, 0xB1, 0xA8,
+    0x65, 0x02, 0x6F, 0x82, 0xF9, 0x26, 0xF0, 0x4F, 0x87, 0xD3, 0x35, 0xDA, 0x26, 0x72, 0x8F, 0xF1,
+    0x36, 0x61, 0x6C, 0x46, 0xA9, 0xBE, 0x8F, 0xBF, 0xA2, 0xDF, 0xA7, 0x19, 0x5F, 0xF4, 0x17, 0xC3,
+    0xF7, 0xF9, 0x8F, 0x8C, 0xF5, 0xAB, 0x37, 0x54, 0x59, 0xB9, 0x57, 0xAF, 0x83, 0xBB, 0xBC, 0x1A,
+    0xC3, 0x4B, 0xBF, 0x4A, 0x24, 0xA9, 0x7C, 0x98, 0x6B, 0x52, 0x07, 0x65, 0x24, 0xBB, 0xC4, 0xF4,
+    0xBD, 0x26, 0xCC, 0xC3, 0xF4, 0x0E, 0x31, 0x6F, 0xDB, 0x30, 0x0D, 0xCB, 0xB6, 0x8D, 0x24, 0xB8,
+    0xDF, 0xDE, 0x89, 0xE9, 0xED, 0xC6, 0x34, 0x16, 0xBD, 0x4F, 0xEB, 0xB5, 0x89, 0x78, 0x7F, 0xAD,
+    0xD6, 0xD7, 0x89, 0xDF, 0x59, 0x13, 0xF7, 0x5F, 0xE5, 0xC5, 0x6B, 0xE2, 0x3C, 0x2B, 0x23, 0x78,
+    0xF4, 0xB3, 0x3C, 0xBC, 0x03, 0xCA, 0xB3, 0x98, 0x86, 0xD8, 0x44, 0x01, 0x36, 0x20, 0x92, 0x5E,
+    0x32, 0x62, 0x62, 0xFE, 0x21, 0x6E, 0x9D, 0xC0, 0xC5, 0xE1, 0xD6, 0xB3, 0xFD, 0xC6, 0x6B, 0x26,
+    0xE2, 0x76, 0x44, 0xE9, 0x15, 0x77, 0x81, 0xEE, 0x1E, 0x0E, 0x3F, 0xC1, 0x86, 0xFF, 0x67, 0x14,
+    0x7E, 0xA9, 0xC5, 0xAF, 0x88, 0x51, 0x39, 0xF1, 0x1E, 0x6E, 0x16, 0xE9, 0xC4, 0x23, 0x85, 0x10,
+    0x6B, 0x6A, 0x89, 0xE4, 0x6C, 0x2D, 0x06, 0x70, 0x36, 0x77, 0xFE, 0x84, 0x24, 0x61, 0x7A, 0x0B,
+    0x27, 0x1D, 0xF1, 0x10, 0xE5, 0xE0, 0xD6, 0x5F, 0xE6, 0xFE, 0xB0, 0x85, 0x13, 0xC2, 0x4B, 0x73,
+    0xB8, 0x61, 0x92, 0x23, 0x8D, 0xC4, 0x39, 0xAD, 0x71, 0x1A, 0xC2, 0xD5, 0x9F, 0x1C, 0x12, 0x83,
+    0xB3, 0x73, 0x10, 0x6C, 0x91, 0x07, 0xDD, 0x59, 0x93, 0x83, 0xC5, 0xFE, 0x90, 0x4B, 0x36, 0x0F,
+    0xF1, 0xCA, 0x74, 0x85, 0x1E, 0x10, 0x59, 0xD4, 0x33, 0x61, 0xB5, 0x35, 0x06, 0x57, 0x63, 0x4A,
+    0x2B, 0xC1, 0x7C, 0xBB, 0x91, 0xB8, 0x92, 0x0D, 0xCB, 0xCE, 0xF7, 0x16, 0xD9, 0x46, 0x59, 0xCC,
+    0xED, 0xD4, 0x33, 0xE1, 0x9A, 0x0A, 0x27, 0x9C, 0x74, 0xFE, 0x29, 0x78, 0x2A, 0xE1, 0x79, 0x01,
+    0x95, 0x1D, 0x6C, 0x93, 0xD4, 0x40, 0x50, 0xE7, 0x4D, 0xC8, 0x00, 0xE1, 0xD1, 0x95, 0x86, 0x5B,
+    0xA0, 0xB9, 0x30, 0x50, 0x9C, 0x0D, 0x92, 0x93, 0xDB, 0x82, 0x42, 0x83, 0x1A, 0x10, 0x95, 0x80,
+    0x84, 0x8C, 0xDA, 0x03, 0xC0, 0x0C, 0x6E, 0x13, 0xD4, 0x00, 0xA8, 0xC2, 0x6D, 0x12, 0x52, 0x2D,
+    0x56, 0x3D, 0xF7, 0x0C, 0xB4, 0x48, 0x87, 0x29, 0x33, 0x82, 0x3B, 0x9F, 0x72, 0x6B, 0xD0, 0x82,
+    0xDB, 0x84, 0x1C, 0xE7, 0x73, 0x86, 0xDB, 0x2E, 0x56, 0xC1, 0xEB, 0x01, 0x71, 0x0E, 0x08, 0x2B,
+    0x80, 0xDF, 0x00, 0xDC, 0x8E, 0x73, 0xDB, 0x13, 0xF8, 0x62, 0x8E, 0x65, 0x3E, 0xED, 0x0B, 0x26,
+    0x5A, 0x1E, 0x87, 0x24, 0xEB, 0x32, 0x18, 0x23, 0xF6, 0x16, 0xE8, 0x45, 0x0A, 0x32, 0xE2, 0x54,
+    0x1A, 0x0B, 0x2F, 0xF6, 0x2E, 0x12, 0x54, 0xF5, 0x65, 0x89, 0x7B, 0x91, 0x2A, 0x16, 0x91, 0x6E,
+    0x4D, 0x11, 0xFF, 0x76, 0x47, 0x95, 0xF5, 0x0A, 0xE6, 0xA7, 0xD6, 0x6F, 0x62, 0x25, 0xCD, 0x38,
+    0x0D, 0x6A, 0x9B, 0x29, 0x55, 0xD7, 0x94, 0xAD, 0x65, 0x03, 0xCD, 0x0C, 0x08, 0x41, 0xAB, 0xEF,
+    0x83, 0xA5, 0xDE, 0x17, 0xD2, 0xF6, 0xC3, 0x50, 0xAD, 0x6B, 0x72, 0x92, 0x70, 0x13, 0x19, 0x1E,
+    0xDE, 0xAF, 0x93, 0x5F, 0x23, 0x26, 0xA0, 0x8E, 0x03, 0x46, 0x85, 0x16, 0x1E, 0x3D, 0xB4, 0x96,
+    0x7D, 0xBF, 0x93, 0x3E, 0xA8, 0x9C, 0x39, 0x26, 0xF6, 0x88, 0x5B, 0x8C, 0x71, 0xBB, 0xF0, 0xB1,
+    0xA9, 0xBC, 0x2E, 0x68, 0x50, 0x98, 0xD0, 0x72, 0x55, 0x64, 0xF6, 0xC4, 0x3F, 0x9C, 0x5B, 0x3A,
+    0x2F, 0x37, 0x2C, 0x9F, 0x8F, 0x19, 0x68, 0x29, 0x2D, 0xCD, 0x83, 0x42, 0x46, 0xF7, 0x1A, 0xCF,
+    0x9C, 0x8C, 0x72, 0x72, 0xA2, 0x86, 0x60, 0x50, 0x1D, 0xD0, 0xD7, 0x48, 0xBB, 0x3D, 0x97, 0xE8,
+    0x82, 0x05, 0xF4, 0xC1, 0xA2, 0xED, 0x2E, 0xD7, 0xDC, 0x8D, 0x38, 0x99, 0xAB, 0x25, 0xEB, 0x0B,
+    0x65, 0x93, 0x06, 0x94, 0x05, 0x5E, 0xA7, 0x9A, 0x6E, 0x85, 0xF8, 0xD6, 0x82, 0x4C, 0xDD, 0x7E,
+    0xB7, 0x47, 0x2E, 0xE9, 0x0F, 0x24, 0x78, 0x80, 0xB8, 0x0F, 0x7F, 0x54, 0x83, 0x98, 0x3C, 0x70,
+    0xD1, 0xAE, 0x9B, 0xEA, 0xF6, 0x74, 0xAF, 0xC1, 0x69, 0x60, 0xDB, 0xAB, 0x3B, 0xE8, 0x8D, 0xB8,
+    0xA1, 0x10, 0xAB, 0xB0, 0x92, 0xD1, 0x40, 0xF6, 0x8E, 0x61, 0x55, 0xAF, 0x71, 0xE6, 0xB4, 0x42,
+    0x26, 0x63, 0x1E, 0x9A, 0x15, 0x7F, 0x27, 0x8D, 0xE6, 0x0A, 0x88, 0x82, 0x9D, 0xBD, 0x65, 0xC7,
+    0x07, 0x68, 0xE3, 0xE0, 0xAD, 0x7E, 0x5C, 0x80, 0xF6, 0x3E, 0x09, 0x99, 0xAF, 0x06, 0xB8, 0xCE,
+    0x22, 0x5D, 0x3A, 0x05, 0x14, 0x1E, 0x91, 0x51, 0x8C, 0x79, 0xD2, 0x7B, 0xF3, 0x20, 0x7F, 0x3B,
+    0x6C, 0xD1, 0x11, 0x95, 0x01, 0x43, 0x1E, 0x90, 0x71, 0xDC, 0x3D, 0xC2, 0xB0, 0x84, 0x5E, 0x82,
+    0xC7, 0x1F, 0xF6, 0x2C, 0x03, 0x15, 0xD8, 0x96, 0x71, 0x48, 0xC2, 0xC1, 0x49, 0x92, 0x02, 0x62,
+    0x2C, 0x90, 0x84, 0x35, 0xC0, 0xEF, 0x01, 0xAE, 0x79, 0xF2, 0x2B, 0xC3, 0x44, 0x68, 0x48, 0x4D,
+    0x28, 0x63, 0x82, 0xBD, 0x45, 0xC2, 0x3E, 0x4B, 0x33, 0x4E, 0x75, 0x5B, 0x46, 0xF7, 0x66, 0x52,
+    0x2D, 0x99, 0xA8, 0x32, 0xEF, 0x39, 0xD1, 0x7F, 0x44, 0x17, 0x0D, 0x3E, 0xD1, 0x02, 0xE5, 0x63,
+    0x5A, 0x24, 0xFA, 0x59, 0x27, 0x96, 0xDB, 0x47, 0xC4, 0x0E, 0x33, 0xF5, 0x4A, 0x38, 0x81, 0xD3,
+    0x33, 0xB3, 0xAC, 0xF6, 0xFA, 0x24, 0x00, 0x26, 0x5B, 0xBA, 0x65, 0xA9, 0x35, 0x41, 0x4E, 0xBE,
+    0x61, 0x15, 0xAD, 0x53, 0x70, 0xAC, 0xA9, 0xEE, 0x62, 0x58, 0xF1, 0xA3, 0x1D, 0xA8, 0xC6, 0xE3,
+    0x11, 0xBD, 0xF9, 0x47, 0xA8, 0x60, 0x52, 0xC9, 0xB8, 0xB1, 0x38, 0x5F, 0xE1, 0x55, 0xC6, 0x4F,
+    0xB1, 0xC8, 0x30, 0xD8, 0xDE, 0x4E, 0xC7, 0xD0, 0x43, 0x7B, 0x86, 0x2F, 0x57, 0xCC, 0xF5, 0xCD,
+    0x0D, 0xED, 0xC8, 0x50, 0x50, 0xDD, 0x88, 0x4E, 0x4F, 0xD4, 0x4A, 0x15, 0x4C, 0xEC, 0xA4, 0xFE,
+    0x7C, 0x73, 0x9F, 0x94, 0x8A, 0x79, 0x3B, 0xF4, 0x08, 0xB9, 0xBC, 0x24, 0xF6, 0x50, 0x35, 0x01,
+    0xD3, 0xA2, 0xEA, 0x6B, 0x1C, 0x73, 0xB8, 0x5F, 0x79, 0x43, 0xE8, 0xE4, 0x61, 0x13, 0xB2, 0xA0,
+    0x0F, 0x79, 0x0F, 0x08, 0xC9, 0x80, 0x21, 0x15, 0x10, 0xF2, 0x18, 0x0B, 0xE8, 0x97, 0x70, 0xD2,
+    0xA6, 0x43, 0x74, 0xB0, 0x4E, 0x4B, 0xB8, 0x40, 0x54, 0x03, 0x82, 0x2E, 0xE4, 0x7B, 0xF6, 0xB7,
+    0x4A, 0x5B, 0x1E, 0x6A, 0x7D, 0x6F, 0xE3, 0x4B, 0x8B, 0xA9, 0xD7, 0xF0, 0xDC, 0x12, 0x9C, 0xAF,
+    0x51, 0x00, 0xA9, 0x3A, 0x8C, 0x74, 0x0C, 0x33, 0x3D, 0x6D, 0xDA, 0x9F, 0x3F, 0xDA, 0x7E, 0x7A,
+    0xD9, 0x43, 0x3E, 0x94, 0xFF, 0x06, 0x5C, 0x92, 0x87, 0x33, 0x9C, 0xC1, 0x0F, 0x33, 0x07, 0x24,
+    0x73, 0x2D, 0x56, 0x16, 0x41, 0xEC, 0x14, 0xE4, 0xB2, 0x40, 0x15, 0x9C, 0xA0, 0xAE, 0x54, 0xCA,
+    0x4F, 0x47, 0xF6, 0x1F, 0x49, 0x6F, 0x15, 0x0B, 0xCB, 0x06, 0x95, 0x72, 0x84, 0x0E, 0xF2, 0x6D,
+    0xAE, 0xCC, 0x94, 0x57, 0xAC, 0x67, 0x49, 0xDC, 0xD8, 0xF2, 0xF0, 0x35, 0xF7, 0xC6, 0xB7, 0x9C,
+    0x2E, 0x79, 0x30, 0x98, 0xB2, 0xFB, 0x6E, 0x8B, 0xCB, 0x4B, 0xF7, 0xBD, 0xE6, 0x82, 0xFB, 0xC7,
+    0xF6, 0x62, 0xFD, 0x96, 0xFB, 0x59, 0x13, 0xB4, 0x6F, 0xB9, 0x87, 0x28, 0x6C, 0xCC, 0x47, 0xF0,
+    0xCA, 0x27, 0xCA, 0xE4, 0xF5, 0x85, 0x2B, 0x58, 0x1A, 0xBD, 0xC0, 0xBD, 0x57, 0x9D, 0x5C, 0xBD,
+    0xBA, 0x3E, 0x81, 0x13, 0xF6, 0xF9, 0xC9, 0x6C, 0x36, 0xDB, 0x5B, 0xE9, 0xB0, 0xC5, 0xFA, 0xFF,
+    0x0D, 0x32, 0x9B, 0x5D, 0xDA, 0x73, 0xE6, 0xFA, 0x86, 0xBA, 0x13, 0xAB, 0x31, 0xF2, 0xC7, 0xD8,
+    0xAE, 0xC1, 0xCE, 0xDA, 0x25, 0xAA, 0xE4, 0x4D, 0x18, 0x34, 0x1B, 0xEC, 0xBD, 0x91, 0x1E, 0x4C,
+    0x2E, 0x62, 0x97, 0x92, 0x7D, 0x3F, 0xE6, 0xE2, 0x64, 0x74, 0x4B, 0xDE, 0xA4, 0xD8, 0x79, 0xF7,
+    0x85, 0xF4, 0xE2, 0xDC, 0x02, 0xEC, 0x34, 0xBC, 0x17, 0x32, 0xA1, 0xB3, 0xF6, 0xA3, 0x7A, 0xA7,
+    0x3D, 0x7C, 0xE1, 0xF5, 0x3E, 0x63, 0x07, 0x2C, 0xE5, 0x23, 0x6C, 0x24, 0x43, 0x7E, 0xB8, 0xF1,
+    0x1E, 0x39, 0x4D, 0x56, 0x01, 0x3B, 0xEC, 0xF9, 0xEE, 0x9E, 0xEF, 0xE9, 0xB9, 0x9B, 0x1E, 0x9C,
+    0x27, 0x03, 0xE3, 0x86, 0xB9, 0x5D, 0xCC, 0x20, 0xA7, 0x3E, 0x7E, 0x37, 0x56, 0x10, 0x2A, 0xD6,
+    0x2C, 0xF5, 0x5F, 0xF5, 0xD5, 0x82, 0x77, 0x3D, 0x35, 0xF1, 0xAE, 0x15, 0xC9, 0x93, 0x63, 0x5C,
+    0x7F, 0x71, 0xC3, 0x25, 0x45, 0x92, 0xD7, 0x94, 0x16, 0xD8, 0x87, 0x70, 0xA3, 0xC0, 0x24, 0x0A,
+    0x3C, 0x5E, 0x75, 0xE3, 0x6D, 0x58, 0xCF, 0xFB, 0xAC, 0x3D, 0xA0, 0x38, 0x34, 0x06, 0xB7, 0x53,
+    0x6F, 0x1E, 0x7F, 0x7E, 0x08, 0xD1, 0x05, 0xA4, 0xA1, 0xC0, 0xF2, 0x64, 0x6C, 0x4B, 0xD1, 0x6B,
+    0xD6, 0xB1, 0xBE, 0x39, 0x1D, 0x13, 0xCE, 0xC3, 0x2B, 0x74, 0xCE, 0xC0, 0x28, 0x53, 0xE1, 0x55,
+    0xA9, 0x2C, 0x1D, 0xD6, 0x53, 0xFB, 0x5B, 0x9A, 0xFD, 0x6A, 0xDC, 0xE6, 0x0D, 0x21, 0xE2, 0x66,
+    0x79, 0x1D, 0x33, 0xB9, 0x07, 0xD7, 0xCF, 0xEA, 0x00, 0x21, 0x81, 0x74, 0x58, 0x31, 0x39, 0x46,
+    0x25, 0x95, 0x16, 0xE3, 0x0E, 0x25, 0x07, 0x9A, 0x9F, 0xA7, 0x2B, 0x98, 0xA0, 0x90, 0xD9, 0x23,
+    0xF2, 0xEC, 0x2F, 0x43, 0x70, 0x87, 0x72, 0xD8, 0x80, 0xE3, 0xED, 0x1B, 0x26, 0x92, 0x84, 0x6B,
+    0x86, 0xB5, 0xC7, 0x4A, 0xE5, 0x8B, 0xB1, 0x18, 0xB0, 0x23, 0xAA, 0xBC, 0xA7, 0x20, 0xB1, 0x82,
+    0xF7, 0xD5, 0x82, 0x7E, 0x7B, 0xFE, 0xE8, 0xF2, 0x6A, 0xFA, 0xC0, 0x85, 0x92, 0xE4, 0x0B, 0xBB,
+    0xE1, 0x06, 0xF9, 0x92, 0x0C, 0xE3, 0xEC, 0xBD, 0xCB, 0x50, 0xD3, 0x5B, 0xBB, 0xFB, 0x54, 0x93,
+    0xA8, 0xDE, 0xA1, 0x0B, 0x5A, 0xD9, 0x33, 0x75, 0xD1, 0x49, 0xF0, 0xCF, 0xFA, 0xF6, 0x20, 0xD1,
+    0xC7, 0xF5, 0x6D, 0xE4, 0xCE, 0x1F, 0xD4, 0xB7, 0x51, 0x88, 0x62, 0x7C, 0x58, 0x4E, 0x89, 0xD5,
+    0x01, 0x30, 0xA8, 0x06, 0x62, 0x4D, 0xF4, 0xEB, 0x41, 0xD2, 0x0D, 0x67, 0xE3, 0x40, 0x96, 0x95,
+    0xA3, 0xAD, 0xFC, 0x46, 0xBA, 0x56, 0x5A, 0xB6, 0xFF, 0x01, 0x8C, 0x15, 0x8C, 0x68, 0xB4, 0x3B,
+    0x19, 0xDC, 0xC2, 0x7A, 0xC5, 0x88, 0xCA, 0x01, 0x55, 0xB3, 0x7C, 0x0A, 0xF0, 0x0A, 0xDB, 0x8D,
+    0xFE, 0x71, 0x12, 0xE1, 0x46, 0xE9, 0x37, 0x74, 0xD7, 0x93, 0xC7, 0xAF, 0xE9, 0xAF, 0x66, 0x66,
+    0x52, 0x5A, 0x8B, 0xB6, 0xC2, 0x6F, 0xF6, 0xB5, 0xF0, 0x72, 0xDE, 0x47, 0x7B, 0xFB, 0xB8, 0x78,
+    0x58, 0x99, 0x05, 0xCD, 0x7C, 0x56, 0xD4, 0xFC, 0x97, 0x85, 0xE3, 0x57, 0xDF, 0x25, 0x69, 0xBA,
+    0x2C, 0x89, 0x51, 0x8F, 0x57, 0xFE, 0x7C, 0xAB, 0x44, 0x0E, 0xD0, 0xDD, 0x27, 0xE3, 0x59, 0xA6,
+    0x2F, 0x3C, 0x8B, 0x76, 0x8E, 0x41, 0x24, 0x4B, 0x70, 0x74, 0x96, 0x84, 0x54, 0x21, 0xCE, 0xD1,
+    0x62, 0x4B, 0xA4, 0x37, 0x36, 0x37, 0x53, 0x56, 0xC8, 0x2C, 0x90, 0xFF, 0x03, 0xAB, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x43, 0x3D, 0x88, 0x10, 0x0D, 0x0D, 0x0D, 0x65, 0x00, 0x00, 0x8D, 0x8E, 0xB1, 0x0D,
+    0xC2, 0x30, 0x10, 0x45, 0xBF, 0x83, 0x10, 0x45, 0x0A, 0xD3, 0x84, 0x26, 0x45, 0x46, 0xC8, 0x08,
+    0xE7, 0x11, 0x52, 0xD0, 0x67, 0x04, 0x26, 0x80, 0x64, 0xB3, 0x58, 0x4C, 0x70, 0x0D, 0x3D, 0x23,
+    0xA4, 0x48, 0x01, 0x12, 0xF1, 0x71, 0x76, 0x40, 0x42, 0xD0, 0xD0, 0xBC, 0xE7, 0xF3, 0xC9, 0xDF,
+    0x1F, 0x45, 0x03, 0x64, 0x12, 0x80, 0x5C, 0x84, 0x51, 0x71, 0x39, 0x82, 0x5C, 0x36, 0x81, 0xF0,
+    0x85, 0x52, 0x66, 0x02, 0x49, 0x20, 0xEC, 0xEE, 0xFB, 0x9F, 0xED, 0x1F, 0x30, 0x09, 0x0F, 0x05,
+    0x42, 0xC4, 0xA0, 0x51, 0xA8, 0xF4, 0x67, 0x40, 0x3B, 0xA0, 0x70, 0xF1, 0x64, 0xE4, 0x16, 0xA5,
+    0x65, 0xA2, 0x2C, 0x77, 0xBD, 0xAA, 0x72, 0xD6, 0xAB, 0x6A, 0x7C, 0x2A, 0x5D, 0x1A, 0x91, 0xBE,
+    0x93, 0xD1, 0x8A, 0x9C, 0x45, 0x46, 0xE2, 0xD6, 0xB5, 0x97, 0x86, 0xE2, 0x4B, 0x8F, 0xD3, 0xA2,
+    0xD7, 0x44, 0x9C, 0x64, 0xE7, 0xA4, 0x4C, 0xAE, 0x29, 0xA5, 0x0E, 0x49, 0x46, 0xFA, 0x25, 0xD3,
+    0x27, 0xE5, 0x9C, 0xB4, 0xE1, 0xF7, 0xC4, 0x38, 0xE2, 0xE0, 0xF3, 0x69, 0xDB, 0x69, 0xAF, 0x95,
+    0x4C, 0x75, 0x6C, 0x39, 0x8C, 0x28, 0x74, 0xBD, 0xC6, 0x13, 0x4D, 0x8F, 0xB1, 0x0D, 0xC3, 0x30,
+    0x0C, 0x04, 0x19, 0xA8, 0x48, 0xC9, 0x3E, 0x19, 0x42, 0x23, 0x50, 0x9B, 0x39, 0x23, 0x64, 0x23,
+    0x6B, 0x04, 0x8D, 0x90, 0x11, 0x52, 0xD8, 0x40, 0x0A, 0x3B, 0x9F, 0xD7, 0x0B, 0x36, 0xC2, 0xE6,
+    0x41, 0xF0, 0xC8, 0x7F, 0x9A, 0x9D, 0x95, 0xCA, 0x50, 0x6F, 0x43, 0x63, 0x19, 0x8A, 0x7D, 0x8C,
+    0x01, 0x01, 0x0E, 0x08, 0x88, 0xE7, 0x5D, 0xC0, 0xC7, 0xAC, 0x03, 0x89, 0x1A, 0x04, 0x7C, 0xBB,
+    0x3D, 0x82, 0x40, 0x7C, 0xD1, 0x32, 0x01, 0x00, 0xAF, 0xBC, 0xF7, 0x6D, 0xD4, 0x40, 0xE1, 0x36,
+    0x6C, 0x42, 0x0B, 0x60, 0xBB, 0x00, 0x0B, 0xF5, 0x7D, 0xA5, 0x7A, 0xC7, 0x78, 0x99, 0x5C, 0x9F,
+    0x15, 0xEE, 0xB5, 0xA9, 0x3B, 0xB3, 0xE1, 0x58, 0xB6, 0x32, 0x4E, 0x58, 0x67, 0x05, 0xE1, 0x39,
+    0x05, 0x8B, 0x9A, 0x95, 0xC3, 0x6B, 0x28, 0x57, 0x5A, 0xE7, 0xF2, 0x9F, 0xFB, 0xFC, 0xE3, 0xF8,
+    0xEB, 0xF8, 0x53, 0xF5, 0x03,
 };
 
 static const EpdGlyph notosans_16_regularGlyphs[] = {
@@ -2211,99 +2216,99 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 0, 0, 139, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 139, 0, 0, 0, 0 }, // U+0020
     { 5, 25, 143, 2, 24, 32, 0 }, // !
-    { 10, 9, 218, 2, 24, 23, 32 }, // "
-    { 21, 24, 344, 0, 24, 126, 55 }, // #
-    { 16, 28, 305, 2, 26, 112, 181 }, // $
-    { 26, 26, 443, 1, 25, 169, 293 }, // %
-    { 24, 26, 390, 1, 25, 156, 462 }, // &
-    { 4, 9, 120, 2, 24, 9, 618 }, // '
-    { 8, 30, 160, 1, 24, 60, 627 }, // (
-    { 8, 30, 160, 1, 24, 60, 687 }, // )
-    { 16, 16, 294, 1, 26, 64, 747 }, // *
-    { 17, 17, 305, 1, 20, 73, 811 }, // +
-    { 6, 9, 143, 1, 4, 14, 884 }, // ,
-    { 9, 4, 172, 1, 11, 9, 898 }, // -
-    { 5, 6, 143, 2, 5, 8, 907 }, // .
-    { 13, 24, 198, 0, 24, 78, 915 }, // /
-    { 17, 26, 311, 1, 25, 111, 993 }, // 0
-    { 10, 24, 235, 0, 24, 60, 1104 }, // 1
-    { 16, 25, 296, 1, 25, 100, 1164 }, // 2
-    { 17, 26, 305, 1, 25, 111, 1264 }, // 3
-    { 19, 24, 305, 0, 24, 114, 1375 }, // 4
-    { 16, 25, 305, 2, 24, 100, 1489 }, // 5
-    { 17, 26, 305, 1, 25, 111, 1589 }, // 6
-    { 17, 24, 272, 0, 24, 102, 1700 }, // 7
-    { 17, 26, 314, 1, 25, 111, 1802 }, // 8
-    { 17, 26, 305, 1, 25, 111, 1913 }, // 9
-    { 5, 20, 143, 2, 19, 25, 2024 }, // :
-    { 6, 24, 143, 1, 19, 36, 2049 }, // ;
-    { 17, 18, 305, 1, 21, 77, 2085 }, // <
-    { 17, 10, 305, 1, 17, 43, 2162 }, // =
-    { 17, 18, 305, 1, 21, 77, 2205 }, // >
-    { 14, 26, 231, 0, 25, 91, 2282 }, // ?
-    { 28, 27, 479, 1, 24, 189, 2373 }, // @
-    { 22, 24, 341, 0, 24, 132, 2562 }, // A
-    { 17, 24, 347, 3, 24, 102, 2694 }, // B
-    { 19, 26, 337, 2, 25, 124, 2796 }, // C
-    { 20, 24, 389, 3, 24, 120, 2920 }, // D
-    { 14, 24, 296, 3, 24, 84, 3040 }, // E
-    { 14, 24, 277, 3, 24, 84, 3124 }, // F
-    { 20, 26, 388, 2, 25, 130, 3208 }, // G
-    { 19, 24, 395, 3, 24, 114, 3338 }, // H
-    { 9, 24, 181, 1, 24, 54, 3452 }, // I
-    { 10, 31, 146, -3, 24, 78, 3506 }, // J
-    { 18, 24, 330, 3, 24, 108, 3584 }, // K
-    { 14, 24, 279, 3, 24, 84, 3692 }, // L
-    { 24, 24, 484, 3, 24, 144, 3776 }, // M
-    { 20, 24, 405, 3, 24, 120, 3920 }, // N
-    { 22, 26, 416, 2, 25, 143, 4040 }, // O
-    { 16, 24, 323, 3, 24, 96, 4183 }, // P
-    { 22, 31, 416, 2, 25, 171, 4279 }, // Q
-    { 18, 24, 332, 3, 24, 108, 4450 }, // R
-    { 16, 26, 293, 1, 25, 104, 4558 }, // S
-    { 19, 24, 296, 0, 24, 114, 4662 }, // T
-    { 19, 25, 390, 3, 24, 119, 4776 }, // U
-    { 20, 24, 320, 0, 24, 120, 4895 }, // V
-    { 31, 24, 496, 0, 24, 186, 5015 }, // W
-    { 20, 24, 312, 0, 24, 120, 5201 }, // X
-    { 19, 24, 302, 0, 24, 114, 5321 }, // Y
-    { 17, 24, 305, 1, 24, 102, 5435 }, // Z
-    { 9, 30, 175, 2, 24, 68, 5537 }, // [
-    { 13, 24, 198, 0, 24, 78, 5605 }, // <backslash>
-    { 9, 30, 175, 0, 24, 68, 5683 }, // ]
-    { 17, 16, 305, 1, 24, 68, 5751 }, // ^
-    { 16, 3, 237, -1, -3, 12, 5819 }, // _
-    { 8, 6, 150, 1, 26, 12, 5831 }, // `
-    { 15, 20, 299, 1, 19, 75, 5843 }, // a
-    { 17, 27, 328, 2, 26, 115, 5918 }, // b
-    { 14, 20, 256, 1, 19, 70, 6033 }, // c
-    { 17, 27, 328, 1, 26, 115, 6103 }, // d
-    { 17, 20, 301, 1, 19, 85, 6218 }, // e
-    { 13, 26, 183, 0, 26, 85, 6303 }, // f
-    { 17, 27, 328, 1, 19, 115, 6388 }, // g
-    { 16, 26, 330, 2, 26, 104, 6503 }, // h
-    { 5, 25, 138, 2, 25, 32, 6607 }, // i
-    { 9, 33, 138, -2, 25, 75, 6639 }, // j
-    { 16, 26, 285, 2, 26, 104, 6714 }, // k
-    { 4, 26, 138, 2, 26, 26, 6818 }, // l
-    { 27, 19, 499, 2, 19, 129, 6844 }, // m
-    { 16, 19, 330, 2, 19, 76, 6973 }, // n
-    { 18, 20, 323, 1, 19, 90, 7049 }, // o
-    { 17, 27, 328, 2, 19, 115, 7139 }, // p
-    { 17, 27, 328, 1, 19, 115, 7254 }, // q
-    { 12, 19, 220, 2, 19, 57, 7369 }, // r
-    { 14, 20, 255, 1, 19, 70, 7426 }, // s
-    { 12, 23, 193, 0, 22, 69, 7496 }, // t
-    { 16, 19, 330, 2, 18, 76, 7565 }, // u
-    { 17, 18, 271, 0, 18, 77, 7641 }, // v
-    { 26, 18, 419, 0, 18, 117, 7718 }, // w
-    { 18, 18, 282, 0, 18, 81, 7835 }, // x
-    { 17, 26, 272, 0, 18, 111, 7916 }, // y
-    { 14, 18, 251, 1, 18, 63, 8027 }, // z
-    { 12, 30, 203, 0, 24, 90, 8090 }, // {
-    { 4, 35, 294, 7, 26, 35, 8180 }, // |
-    { 11, 30, 203, 1, 24, 83, 8215 }, // }
-    { 17, 5, 305, 1, 14, 22, 8298 }, // ~
+    { 10, 9, 218, 2, 24, 23, 0 }, // "
+    { 21, 24, 344, 0, 24, 126, 23 }, // #
+    { 16, 28, 305, 2, 26, 112, 149 }, // $
+    { 26, 26, 443, 1, 25, 169, 261 }, // %
+    { 24, 26, 390, 1, 25, 156, 430 }, // &
+    { 4, 9, 120, 2, 24, 9, 586 }, // '
+    { 8, 30, 160, 1, 24, 60, 32 }, // (
+    { 8, 30, 160, 1, 24, 60, 92 }, // )
+    { 16, 16, 294, 1, 26, 64, 595 }, // *
+    { 17, 17, 305, 1, 20, 73, 659 }, // +
+    { 6, 9, 143, 1, 4, 14, 152 }, // ,
+    { 9, 4, 172, 1, 11, 9, 166 }, // -
+    { 5, 6, 143, 2, 5, 8, 175 }, // .
+    { 13, 24, 198, 0, 24, 78, 732 }, // /
+    { 17, 26, 311, 1, 25, 111, 183 }, // 0
+    { 10, 24, 235, 0, 24, 60, 294 }, // 1
+    { 16, 25, 296, 1, 25, 100, 354 }, // 2
+    { 17, 26, 305, 1, 25, 111, 454 }, // 3
+    { 19, 24, 305, 0, 24, 114, 565 }, // 4
+    { 16, 25, 305, 2, 24, 100, 679 }, // 5
+    { 17, 26, 305, 1, 25, 111, 779 }, // 6
+    { 17, 24, 272, 0, 24, 102, 890 }, // 7
+    { 17, 26, 314, 1, 25, 111, 992 }, // 8
+    { 17, 26, 305, 1, 25, 111, 1103 }, // 9
+    { 5, 20, 143, 2, 19, 25, 1214 }, // :
+    { 6, 24, 143, 1, 19, 36, 1239 }, // ;
+    { 17, 18, 305, 1, 21, 77, 810 }, // <
+    { 17, 10, 305, 1, 17, 43, 887 }, // =
+    { 17, 18, 305, 1, 21, 77, 930 }, // >
+    { 14, 26, 231, 0, 25, 91, 1275 }, // ?
+    { 28, 27, 479, 1, 24, 189, 1007 }, // @
+    { 22, 24, 341, 0, 24, 132, 1366 }, // A
+    { 17, 24, 347, 3, 24, 102, 1498 }, // B
+    { 19, 26, 337, 2, 25, 124, 1600 }, // C
+    { 20, 24, 389, 3, 24, 120, 1724 }, // D
+    { 14, 24, 296, 3, 24, 84, 1844 }, // E
+    { 14, 24, 277, 3, 24, 84, 1928 }, // F
+    { 20, 26, 388, 2, 25, 130, 2012 }, // G
+    { 19, 24, 395, 3, 24, 114, 2142 }, // H
+    { 9, 24, 181, 1, 24, 54, 2256 }, // I
+    { 10, 31, 146, -3, 24, 78, 2310 }, // J
+    { 18, 24, 330, 3, 24, 108, 2388 }, // K
+    { 14, 24, 279, 3, 24, 84, 2496 }, // L
+    { 24, 24, 484, 3, 24, 144, 2580 }, // M
+    { 20, 24, 405, 3, 24, 120, 2724 }, // N
+    { 22, 26, 416, 2, 25, 143, 2844 }, // O
+    { 16, 24, 323, 3, 24, 96, 2987 }, // P
+    { 22, 31, 416, 2, 25, 171, 3083 }, // Q
+    { 18, 24, 332, 3, 24, 108, 3254 }, // R
+    { 16, 26, 293, 1, 25, 104, 3362 }, // S
+    { 19, 24, 296, 0, 24, 114, 3466 }, // T
+    { 19, 25, 390, 3, 24, 119, 1196 }, // U
+    { 20, 24, 320, 0, 24, 120, 3580 }, // V
+    { 31, 24, 496, 0, 24, 186, 3700 }, // W
+    { 20, 24, 312, 0, 24, 120, 3886 }, // X
+    { 19, 24, 302, 0, 24, 114, 4006 }, // Y
+    { 17, 24, 305, 1, 24, 102, 4120 }, // Z
+    { 9, 30, 175, 2, 24, 68, 1315 }, // [
+    { 13, 24, 198, 0, 24, 78, 1383 }, // <backslash>
+    { 9, 30, 175, 0, 24, 68, 1461 }, // ]
+    { 17, 16, 305, 1, 24, 68, 1529 }, // ^
+    { 16, 3, 237, -1, -3, 12, 1597 }, // _
+    { 8, 6, 150, 1, 26, 12, 1609 }, // `
+    { 15, 20, 299, 1, 19, 75, 4222 }, // a
+    { 17, 27, 328, 2, 26, 115, 4297 }, // b
+    { 14, 20, 256, 1, 19, 70, 4412 }, // c
+    { 17, 27, 328, 1, 26, 115, 4482 }, // d
+    { 17, 20, 301, 1, 19, 85, 4597 }, // e
+    { 13, 26, 183, 0, 26, 85, 4682 }, // f
+    { 17, 27, 328, 1, 19, 115, 4767 }, // g
+    { 16, 26, 330, 2, 26, 104, 4882 }, // h
+    { 5, 25, 138, 2, 25, 32, 4986 }, // i
+    { 9, 33, 138, -2, 25, 75, 5018 }, // j
+    { 16, 26, 285, 2, 26, 104, 5093 }, // k
+    { 4, 26, 138, 2, 26, 26, 5197 }, // l
+    { 27, 19, 499, 2, 19, 129, 5223 }, // m
+    { 16, 19, 330, 2, 19, 76, 5352 }, // n
+    { 18, 20, 323, 1, 19, 90, 5428 }, // o
+    { 17, 27, 328, 2, 19, 115, 5518 }, // p
+    { 17, 27, 328, 1, 19, 115, 5633 }, // q
+    { 12, 19, 220, 2, 19, 57, 5748 }, // r
+    { 14, 20, 255, 1, 19, 70, 5805 }, // s
+    { 12, 23, 193, 0, 22, 69, 5875 }, // t
+    { 16, 19, 330, 2, 18, 76, 5944 }, // u
+    { 17, 18, 271, 0, 18, 77, 6020 }, // v
+    { 26, 18, 419, 0, 18, 117, 6097 }, // w
+    { 18, 18, 282, 0, 18, 81, 6214 }, // x
+    { 17, 26, 272, 0, 18, 111, 6295 }, // y
+    { 14, 18, 251, 1, 18, 63, 6406 }, // z
+    { 12, 30, 203, 0, 24, 90, 1621 }, // {
+    { 4, 35, 294, 7, 26, 35, 1711 }, // |
+    { 11, 30, 203, 1, 24, 83, 1746 }, // }
+    { 17, 5, 305, 1, 14, 22, 1829 }, // ~
     { 0, 0, 139, 0, 0, 0, 0 }, // U+00A0
     { 5, 26, 143, 2, 19, 33, 0 }, // U+00A1
     { 14, 26, 305, 3, 25, 91, 33 }, // U+00A2
@@ -2387,19 +2392,19 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 18, 27, 323, 1, 26, 122, 8268 }, // U+00F0
     { 16, 25, 330, 2, 25, 100, 8390 }, // U+00F1
     { 18, 27, 323, 1, 26, 122, 8490 }, // U+00F2
-    { 18, 27, 323, 1, 26, 122, 8612 }, // U+00F3
-    { 18, 27, 323, 1, 26, 122, 8734 }, // U+00F4
-    { 18, 26, 323, 1, 25, 117, 8856 }, // U+00F5
-    { 18, 26, 323, 1, 25, 117, 8973 }, // U+00F6
-    { 17, 16, 305, 1, 20, 68, 9090 }, // U+00F7
-    { 18, 21, 323, 1, 19, 95, 9158 }, // U+00F8
-    { 16, 27, 330, 2, 26, 108, 9253 }, // U+00F9
-    { 16, 27, 330, 2, 26, 108, 9361 }, // U+00FA
-    { 16, 27, 330, 2, 26, 108, 9469 }, // U+00FB
-    { 16, 26, 330, 2, 25, 104, 9577 }, // U+00FC
-    { 17, 34, 272, 0, 26, 145, 9681 }, // U+00FD
-    { 17, 34, 328, 2, 26, 145, 9826 }, // U+00FE
-    { 17, 33, 272, 0, 25, 141, 9971 }, // U+00FF
+    { 18, 27, 323, 1, 26, 122, 6469 }, // U+00F3
+    { 18, 27, 323, 1, 26, 122, 8612 }, // U+00F4
+    { 18, 26, 323, 1, 25, 117, 8734 }, // U+00F5
+    { 18, 26, 323, 1, 25, 117, 8851 }, // U+00F6
+    { 17, 16, 305, 1, 20, 68, 8968 }, // U+00F7
+    { 18, 21, 323, 1, 19, 95, 9036 }, // U+00F8
+    { 16, 27, 330, 2, 26, 108, 9131 }, // U+00F9
+    { 16, 27, 330, 2, 26, 108, 9239 }, // U+00FA
+    { 16, 27, 330, 2, 26, 108, 9347 }, // U+00FB
+    { 16, 26, 330, 2, 25, 104, 9455 }, // U+00FC
+    { 17, 34, 272, 0, 26, 145, 9559 }, // U+00FD
+    { 17, 34, 328, 2, 26, 145, 9704 }, // U+00FE
+    { 17, 33, 272, 0, 25, 141, 9849 }, // U+00FF
     { 22, 29, 341, 0, 29, 160, 0 }, // U+0100
     { 15, 24, 299, 1, 23, 90, 160 }, // U+0101
     { 22, 31, 341, 0, 31, 171, 250 }, // U+0102
@@ -3101,98 +3106,98 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 9, 4, 172, 1, 11, 9, 126 }, // U+2010
     { 9, 4, 172, 1, 11, 9, 135 }, // U+2011
     { 17, 4, 305, 1, 14, 17, 144 }, // U+2012
-    { 15, 4, 267, 1, 11, 15, 161 }, // U+2013
-    { 31, 4, 533, 1, 11, 31, 176 }, // U+2014
-    { 31, 4, 533, 1, 11, 31, 207 }, // U+2015
-    { 11, 35, 294, 4, 26, 97, 238 }, // U+2016
-    { 15, 8, 219, -1, 0, 30, 335 }, // U+2017
-    { 6, 9, 93, 0, 24, 14, 365 }, // U+2018
-    { 6, 9, 93, 0, 24, 14, 379 }, // U+2019
-    { 6, 9, 133, 1, 4, 14, 393 }, // U+201A
-    { 6, 9, 93, 0, 24, 14, 407 }, // U+201B
-    { 12, 9, 191, 0, 24, 27, 421 }, // U+201C
-    { 12, 9, 191, 0, 24, 27, 448 }, // U+201D
-    { 12, 9, 222, 1, 4, 27, 475 }, // U+201E
-    { 12, 9, 191, 0, 24, 27, 502 }, // U+201F
-    { 13, 26, 273, 2, 26, 85, 529 }, // U+2020
-    { 14, 26, 273, 2, 26, 91, 614 }, // U+2021
-    { 8, 9, 201, 2, 17, 18, 705 }, // U+2022
-    { 9, 11, 196, 2, 18, 25, 723 }, // U+2023
-    { 5, 6, 267, 6, 5, 8, 748 }, // U+2024
-    { 14, 6, 286, 2, 5, 21, 756 }, // U+2025
-    { 22, 6, 422, 2, 5, 33, 777 }, // U+2026
-    { 5, 6, 143, 2, 11, 8, 810 }, // U+2027
-    { 0, 0, 320, 0, 0, 0, 818 }, // U+2028
-    { 0, 0, 320, 0, 0, 0, 818 }, // U+2029
-    { 9, 26, 0, -1, 21, 59, 818 }, // U+202A
-    { 9, 26, 0, -8, 21, 59, 877 }, // U+202B
-    { 8, 28, 0, -4, 23, 56, 936 }, // U+202C
-    { 8, 28, 0, -4, 23, 56, 992 }, // U+202D
-    { 8, 28, 0, -4, 23, 56, 1048 }, // U+202E
-    { 0, 0, 89, 0, 0, 0, 1104 }, // U+202F
-    { 37, 26, 628, 1, 25, 241, 1104 }, // U+2030
-    { 49, 26, 823, 1, 25, 319, 1345 }, // U+2031
-    { 8, 9, 124, 1, 24, 18, 1664 }, // U+2032
-    { 14, 9, 218, 1, 24, 32, 1682 }, // U+2033
-    { 20, 9, 311, 1, 24, 45, 1714 }, // U+2034
-    { 8, 9, 124, -1, 24, 18, 1759 }, // U+2035
-    { 13, 9, 235, -1, 24, 30, 1777 }, // U+2036
-    { 19, 9, 321, -1, 24, 43, 1807 }, // U+2037
-    { 13, 11, 213, 0, 3, 36, 1850 }, // U+2038
-    { 9, 15, 165, 1, 16, 34, 1886 }, // U+2039
-    { 8, 15, 165, 1, 16, 30, 1920 }, // U+203A
-    { 26, 26, 446, 1, 25, 169, 1950 }, // U+203B
-    { 13, 25, 266, 2, 24, 82, 2119 }, // U+203C
-    { 14, 26, 237, 0, 25, 91, 2201 }, // U+203D
-    { 18, 3, 267, -1, 28, 14, 2292 }, // U+203E
-    { 20, 7, 325, 0, -1, 35, 2306 }, // U+203F
-    { 20, 8, 325, 0, 27, 40, 2341 }, // U+2040
-    { 12, 22, 199, 0, 14, 66, 2381 }, // U+2041
-    { 37, 31, 596, 0, 26, 287, 2447 }, // U+2042
-    { 9, 4, 172, 1, 11, 9, 2734 }, // U+2043
-    { 18, 24, 69, -7, 24, 108, 2743 }, // U+2044
-    { 8, 30, 173, 2, 24, 60, 2851 }, // U+2045
-    { 9, 30, 173, 0, 24, 68, 2911 }, // U+2046
-    { 28, 26, 456, 0, 25, 182, 2979 }, // U+2047
-    { 21, 26, 362, 0, 25, 137, 3161 }, // U+2048
-    { 20, 26, 364, 2, 25, 130, 3298 }, // U+2049
-    { 17, 18, 305, 1, 18, 77, 3428 }, // U+204A
-    { 17, 31, 349, 3, 26, 132, 3505 }, // U+204B
-    { 18, 17, 341, 1, 18, 77, 3637 }, // U+204C
-    { 18, 17, 341, 2, 18, 77, 3714 }, // U+204D
-    { 16, 16, 294, 1, 9, 64, 3791 }, // U+204E
-    { 6, 24, 126, 1, 19, 36, 3855 }, // U+204F
-    { 20, 35, 323, 0, 27, 175, 3891 }, // U+2050
-    { 16, 33, 294, 1, 26, 132, 4066 }, // U+2051
-    { 13, 26, 198, 0, 25, 85, 4198 }, // U+2052
-    { 29, 6, 533, 2, 13, 44, 4283 }, // U+2053
-    { 20, 8, 323, 0, 0, 40, 4327 }, // U+2054
-    { 18, 18, 305, 0, 17, 81, 4367 }, // U+2055
-    { 15, 26, 276, 1, 25, 98, 4448 }, // U+2056
-    { 25, 9, 396, 1, 24, 57, 4546 }, // U+2057
-    { 25, 26, 438, 1, 25, 163, 4603 }, // U+2058
-    { 25, 26, 442, 1, 25, 163, 4766 }, // U+2059
-    { 5, 26, 118, 1, 25, 33, 4929 }, // U+205A
-    { 20, 26, 349, 1, 25, 130, 4962 }, // U+205B
-    { 25, 26, 424, 1, 25, 163, 5092 }, // U+205C
-    { 5, 25, 143, 2, 24, 32, 5255 }, // U+205D
-    { 5, 26, 143, 2, 25, 33, 5287 }, // U+205E
-    { 0, 0, 118, 0, 0, 0, 5320 }, // U+205F
-    { 0, 0, 320, 0, 0, 0, 5320 }, // U+2060
-    { 0, 0, 320, 0, 0, 0, 5320 }, // U+2061
-    { 0, 0, 320, 0, 0, 0, 5320 }, // U+2062
-    { 0, 0, 320, 0, 0, 0, 5320 }, // U+2063
-    { 0, 0, 320, 0, 0, 0, 5320 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 5320 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 5320 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 5320 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 5320 }, // U+2069
-    { 8, 28, 0, -4, 23, 56, 5320 }, // U+206A
-    { 8, 28, 0, -4, 23, 56, 5376 }, // U+206B
-    { 8, 28, 0, -4, 23, 56, 5432 }, // U+206C
-    { 8, 29, 0, -4, 24, 58, 5488 }, // U+206D
-    { 8, 28, 0, -4, 23, 56, 5546 }, // U+206E
-    { 8, 28, 0, -4, 23, 56, 5602 }, // U+206F
+    { 15, 4, 267, 1, 11, 15, 6591 }, // U+2013
+    { 31, 4, 533, 1, 11, 31, 6606 }, // U+2014
+    { 31, 4, 533, 1, 11, 31, 161 }, // U+2015
+    { 11, 35, 294, 4, 26, 97, 192 }, // U+2016
+    { 15, 8, 219, -1, 0, 30, 289 }, // U+2017
+    { 6, 9, 93, 0, 24, 14, 319 }, // U+2018
+    { 6, 9, 93, 0, 24, 14, 6637 }, // U+2019
+    { 6, 9, 133, 1, 4, 14, 333 }, // U+201A
+    { 6, 9, 93, 0, 24, 14, 347 }, // U+201B
+    { 12, 9, 191, 0, 24, 27, 6651 }, // U+201C
+    { 12, 9, 191, 0, 24, 27, 6678 }, // U+201D
+    { 12, 9, 222, 1, 4, 27, 361 }, // U+201E
+    { 12, 9, 191, 0, 24, 27, 388 }, // U+201F
+    { 13, 26, 273, 2, 26, 85, 415 }, // U+2020
+    { 14, 26, 273, 2, 26, 91, 500 }, // U+2021
+    { 8, 9, 201, 2, 17, 18, 591 }, // U+2022
+    { 9, 11, 196, 2, 18, 25, 609 }, // U+2023
+    { 5, 6, 267, 6, 5, 8, 634 }, // U+2024
+    { 14, 6, 286, 2, 5, 21, 642 }, // U+2025
+    { 22, 6, 422, 2, 5, 33, 6705 }, // U+2026
+    { 5, 6, 143, 2, 11, 8, 663 }, // U+2027
+    { 0, 0, 320, 0, 0, 0, 671 }, // U+2028
+    { 0, 0, 320, 0, 0, 0, 671 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 671 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 730 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 789 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 845 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 901 }, // U+202E
+    { 0, 0, 89, 0, 0, 0, 957 }, // U+202F
+    { 37, 26, 628, 1, 25, 241, 957 }, // U+2030
+    { 49, 26, 823, 1, 25, 319, 1198 }, // U+2031
+    { 8, 9, 124, 1, 24, 18, 1517 }, // U+2032
+    { 14, 9, 218, 1, 24, 32, 1535 }, // U+2033
+    { 20, 9, 311, 1, 24, 45, 1567 }, // U+2034
+    { 8, 9, 124, -1, 24, 18, 1612 }, // U+2035
+    { 13, 9, 235, -1, 24, 30, 1630 }, // U+2036
+    { 19, 9, 321, -1, 24, 43, 1660 }, // U+2037
+    { 13, 11, 213, 0, 3, 36, 1703 }, // U+2038
+    { 9, 15, 165, 1, 16, 34, 1739 }, // U+2039
+    { 8, 15, 165, 1, 16, 30, 1773 }, // U+203A
+    { 26, 26, 446, 1, 25, 169, 1803 }, // U+203B
+    { 13, 25, 266, 2, 24, 82, 1972 }, // U+203C
+    { 14, 26, 237, 0, 25, 91, 2054 }, // U+203D
+    { 18, 3, 267, -1, 28, 14, 2145 }, // U+203E
+    { 20, 7, 325, 0, -1, 35, 2159 }, // U+203F
+    { 20, 8, 325, 0, 27, 40, 2194 }, // U+2040
+    { 12, 22, 199, 0, 14, 66, 2234 }, // U+2041
+    { 37, 31, 596, 0, 26, 287, 2300 }, // U+2042
+    { 9, 4, 172, 1, 11, 9, 2587 }, // U+2043
+    { 18, 24, 69, -7, 24, 108, 2596 }, // U+2044
+    { 8, 30, 173, 2, 24, 60, 2704 }, // U+2045
+    { 9, 30, 173, 0, 24, 68, 2764 }, // U+2046
+    { 28, 26, 456, 0, 25, 182, 2832 }, // U+2047
+    { 21, 26, 362, 0, 25, 137, 3014 }, // U+2048
+    { 20, 26, 364, 2, 25, 130, 3151 }, // U+2049
+    { 17, 18, 305, 1, 18, 77, 3281 }, // U+204A
+    { 17, 31, 349, 3, 26, 132, 3358 }, // U+204B
+    { 18, 17, 341, 1, 18, 77, 3490 }, // U+204C
+    { 18, 17, 341, 2, 18, 77, 3567 }, // U+204D
+    { 16, 16, 294, 1, 9, 64, 3644 }, // U+204E
+    { 6, 24, 126, 1, 19, 36, 3708 }, // U+204F
+    { 20, 35, 323, 0, 27, 175, 3744 }, // U+2050
+    { 16, 33, 294, 1, 26, 132, 3919 }, // U+2051
+    { 13, 26, 198, 0, 25, 85, 4051 }, // U+2052
+    { 29, 6, 533, 2, 13, 44, 4136 }, // U+2053
+    { 20, 8, 323, 0, 0, 40, 4180 }, // U+2054
+    { 18, 18, 305, 0, 17, 81, 4220 }, // U+2055
+    { 15, 26, 276, 1, 25, 98, 4301 }, // U+2056
+    { 25, 9, 396, 1, 24, 57, 4399 }, // U+2057
+    { 25, 26, 438, 1, 25, 163, 4456 }, // U+2058
+    { 25, 26, 442, 1, 25, 163, 4619 }, // U+2059
+    { 5, 26, 118, 1, 25, 33, 4782 }, // U+205A
+    { 20, 26, 349, 1, 25, 130, 4815 }, // U+205B
+    { 25, 26, 424, 1, 25, 163, 4945 }, // U+205C
+    { 5, 25, 143, 2, 24, 32, 5108 }, // U+205D
+    { 5, 26, 143, 2, 25, 33, 5140 }, // U+205E
+    { 0, 0, 118, 0, 0, 0, 5173 }, // U+205F
+    { 0, 0, 320, 0, 0, 0, 5173 }, // U+2060
+    { 0, 0, 320, 0, 0, 0, 5173 }, // U+2061
+    { 0, 0, 320, 0, 0, 0, 5173 }, // U+2062
+    { 0, 0, 320, 0, 0, 0, 5173 }, // U+2063
+    { 0, 0, 320, 0, 0, 0, 5173 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 5173 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 5173 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 5173 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 5173 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 5173 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 5229 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 5285 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 5341 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 5399 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 5455 }, // U+206F
     { 11, 16, 187, 0, 29, 44, 0 }, // U+2070
     { 3, 16, 90, 1, 25, 12, 44 }, // U+2071
     { 12, 16, 187, 0, 29, 48, 56 }, // U+2074
@@ -3269,13 +3274,13 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 15, 32, 305, 3, 28, 120, 4149 }, // U+20BF
     { 14, 24, 263, 1, 19, 84, 4269 }, // U+20C0
     { 17, 3, 305, 1, 13, 13, 0 }, // U+2212
-    { 25, 26, 367, 0, 26, 163, 0 }, // U+FB00
-    { 18, 26, 321, 0, 26, 117, 163 }, // U+FB01
-    { 18, 26, 321, 0, 26, 117, 280 }, // U+FB02
-    { 29, 26, 504, 0, 26, 189, 397 }, // U+FB03
-    { 29, 26, 504, 0, 26, 189, 586 }, // U+FB04
-    { 20, 27, 359, 2, 26, 135, 775 }, // U+FB05
-    { 27, 27, 448, 1, 26, 183, 910 }, // U+FB06
+    { 25, 26, 367, 0, 26, 163, 6738 }, // U+FB00
+    { 18, 26, 321, 0, 26, 117, 6901 }, // U+FB01
+    { 18, 26, 321, 0, 26, 117, 7018 }, // U+FB02
+    { 29, 26, 504, 0, 26, 189, 7135 }, // U+FB03
+    { 29, 26, 504, 0, 26, 189, 7324 }, // U+FB04
+    { 20, 27, 359, 2, 26, 135, 0 }, // U+FB05
+    { 27, 27, 448, 1, 26, 183, 135 }, // U+FB06
     { 31, 32, 533, 1, 26, 248, 0 }, // U+FFFD
 };
 
@@ -3283,8 +3288,7 @@ static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3292,8 +3296,7 @@ static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3303,19 +3306,57 @@ static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
 };
 
 static const EpdFontGroup notosans_16_regularGroups[] = {
-    { 0, 3626, 9181, 97, 0 },
-    { 3626, 3331, 11053, 96, 97 },
-    { 6957, 4095, 16723, 128, 193 },
-    { 11052, 4104, 15196, 96, 321 },
-    { 15156, 1337, 2343, 112, 417 },
-    { 16493, 10285, 34821, 256, 529 },
-    { 26778, 2544, 14747, 90, 785 },
-    { 29322, 2424, 6244, 111, 875 },
-    { 31746, 668, 1618, 42, 986 },
-    { 32414, 2218, 4655, 33, 1028 },
-    { 34632, 15, 15, 1, 1061 },
-    { 34647, 327, 1182, 7, 1062 },
-    { 34974, 139, 256, 1, 1069 },
+    { 0, 3009, 8291, 83, 2 },
+    { 3009, 938, 2039, 26, 0 },
+    { 3947, 3320, 10918, 95, 97 },
+    { 7267, 4095, 16723, 128, 193 },
+    { 11362, 4104, 15196, 96, 321 },
+    { 15466, 1337, 2343, 112, 417 },
+    { 16803, 10285, 34821, 256, 529 },
+    { 27088, 2544, 14747, 90, 785 },
+    { 29632, 2343, 6088, 105, 875 },
+    { 31975, 668, 1618, 42, 986 },
+    { 32643, 2218, 4655, 33, 1028 },
+    { 34861, 15, 15, 1, 1061 },
+    { 34876, 174, 324, 2, 1067 },
+    { 35050, 139, 256, 1, 1069 },
+};
+
+static const uint16_t notosans_16_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_16_regularKernLeftClasses[] = {
@@ -4374,18 +4415,81 @@ static const EpdLigaturePair notosans_16_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_16_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 61, 49 }, { 0x0265, 66, 51 }, { 0x0266, 70, 60 }, { 0x0267, 0, 0 }, { 0x0268, 71, 61 }, // U+0450
+    { 0x0269, 72, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 73, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_16_regular = {
     notosans_16_regularBitmaps,
     notosans_16_regularGlyphs,
     notosans_16_regularIntervals,
-    20,
+    18,
     45,
     36,
     -10,
     true,
     notosans_16_regularGroups,
-    13,
-    nullptr,
+    14,
+    notosans_16_regularGlyphToGroup,
     notosans_16_regularKernLeftClasses,
     notosans_16_regularKernRightClasses,
     notosans_16_regularKernMatrix,
@@ -4395,4 +4499,8 @@ static const EpdFontData notosans_16_regular = {
     76,
     notosans_16_regularLigaturePairs,
     5,
+    notosans_16_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2790 +3,2797 @@
  * name: notosans_18_bold
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_18_bold 18 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_18_bold 18 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_boldBitmaps[44445] = {
-    0xD5, 0x5A, 0xBD, 0x8F, 0xE4, 0x56, 0x72, 0x7F, 0xEC, 0xF6, 0x4C, 0x03, 0x47, 0xD8, 0x74, 0xE0,
-    0x01, 0x0E, 0x37, 0x01, 0x13, 0x47, 0x6B, 0x1B, 0xFC, 0x0B, 0x0C, 0xF2, 0xAC, 0xC0, 0x81, 0x03,
-    0x4F, 0x30, 0xBD, 0x06, 0xAC, 0x40, 0x17, 0xAF, 0x0D, 0x4C, 0x72, 0x81, 0x61, 0xD8, 0x26, 0x4F,
-    0x0E, 0x2F, 0x99, 0x33, 0x74, 0xF1, 0x6D, 0xB0, 0x81, 0x34, 0x0B, 0x78, 0x53, 0x07, 0x0B, 0x3D,
-    0xEA, 0x14, 0x38, 0xB8, 0xC0, 0x5C, 0x2F, 0x0C, 0x05, 0x0A, 0xD4, 0x82, 0x56, 0x3E, 0x63, 0x15,
-    0x88, 0xD6, 0x52, 0xB7, 0xDC, 0x59, 0x92, 0xE5, 0xFA, 0xFD, 0x8A, 0xCD, 0xEE, 0x9E, 0x99, 0xFD,
-    0x94, 0x4E, 0x80, 0xBB, 0x9B, 0xF5, 0xBA, 0x9B, 0xEF, 0xA3, 0x5E, 0x7D, 0x57, 0x3D, 0xFA, 0x46,
-    0xF4, 0xED, 0x1B, 0x5F, 0xDB, 0x3B, 0x9F, 0xDE, 0x69, 0x9D, 0xAE, 0xEC, 0x7D, 0x90, 0x39, 0x7D,
-    0x1D, 0x16, 0xBE, 0x16, 0xF6, 0xCE, 0x57, 0x7B, 0x99, 0x5F, 0xF9, 0x4A, 0x2F, 0xBC, 0xAB, 0x7C,
-    0xF3, 0x2E, 0xD3, 0x0B, 0x6F, 0xE7, 0xAE, 0x15, 0x37, 0x74, 0x7C, 0x5E, 0x78, 0x9D, 0xC3, 0x67,
-    0xA2, 0x50, 0x1C, 0x61, 0x30, 0x10, 0xF6, 0xCE, 0x05, 0xC3, 0xAC, 0x73, 0xC1, 0xF5, 0xE1, 0xAF,
-    0xFA, 0xE3, 0x48, 0xF4, 0xD5, 0x6F, 0xC3, 0xFD, 0xDB, 0xC3, 0x9D, 0xF3, 0x77, 0xDD, 0xA2, 0x8D,
-    0x6A, 0xE7, 0xC2, 0x06, 0x30, 0xAA, 0xE3, 0x95, 0x73, 0x71, 0x9D, 0xAC, 0x5C, 0x8A, 0x3E, 0xF5,
-    0x36, 0xBC, 0xE6, 0x1F, 0xFA, 0x87, 0x37, 0x5D, 0x5A, 0xE6, 0x85, 0x53, 0xE8, 0xB9, 0xB8, 0x4C,
-    0x8B, 0xFB, 0xED, 0xC5, 0x67, 0x3D, 0x76, 0xF6, 0x07, 0x00, 0x77, 0xD7, 0x60, 0x7F, 0xB8, 0xA5,
-    0xBD, 0x44, 0xAA, 0x85, 0xCE, 0xD6, 0xC4, 0xEB, 0x89, 0x57, 0x69, 0x77, 0x77, 0xBF, 0xCC, 0x6B,
-    0xED, 0x92, 0x37, 0x0A, 0xD2, 0x1E, 0x40, 0x3A, 0xC5, 0x43, 0x74, 0x2E, 0xED, 0xDC, 0x70, 0x98,
-    0xE2, 0xA8, 0x63, 0xF1, 0x55, 0x11, 0x7D, 0x5F, 0x5A, 0x9D, 0x34, 0xD7, 0x4E, 0x77, 0x93, 0xEE,
-    0x47, 0x00, 0xF9, 0xE9, 0xDD, 0xBC, 0xCD, 0x31, 0x33, 0xC0, 0x0A, 0xA0, 0x38, 0x14, 0x74, 0x3B,
-    0xE8, 0x77, 0xD0, 0x30, 0xB0, 0xF5, 0x0A, 0x30, 0xAB, 0x12, 0x34, 0x42, 0x67, 0x5F, 0xBA, 0x44,
-    0x74, 0x80, 0x64, 0x2E, 0x7D, 0x2A, 0x6E, 0xAE, 0x18, 0xE4, 0xA5, 0x64, 0x8B, 0x0E, 0xB7, 0xA4,
-    0x88, 0xB4, 0x8B, 0x14, 0xBE, 0x8C, 0x6B, 0x6B, 0xD3, 0xCA, 0x5A, 0x1D, 0xC6, 0x56, 0x87, 0x39,
-    0x5F, 0xF8, 0xB7, 0x25, 0x38, 0x46, 0xFF, 0x7F, 0xEE, 0x63, 0x29, 0xD2, 0x7B, 0x12, 0x29, 0x66,
-    0x2B, 0xDD, 0x6C, 0x5C, 0x2B, 0x7E, 0x91, 0x74, 0xE9, 0xA7, 0xF2, 0x97, 0xDD, 0x5C, 0x51, 0xFD,
-    0xA5, 0xCC, 0x7B, 0x77, 0x23, 0x93, 0x37, 0x06, 0xAC, 0x34, 0xD3, 0x5F, 0x68, 0x15, 0xF6, 0x33,
-    0x6D, 0xC3, 0xCE, 0xDA, 0xA8, 0xB1, 0xFF, 0xD3, 0xD5, 0x7C, 0xD0, 0xFE, 0x8A, 0x11, 0x7A, 0x62,
-    0xC5, 0x40, 0x7E, 0xA1, 0x0C, 0x56, 0xDA, 0x80, 0x4A, 0xF8, 0x2B, 0x95, 0x95, 0x0E, 0x03, 0xAD,
-    0x0A, 0xDB, 0xDD, 0xD1, 0xB4, 0xCF, 0x7D, 0x10, 0x12, 0x3D, 0xC0, 0x27, 0x1D, 0x20, 0x25, 0x56,
-    0x54, 0x5A, 0xE9, 0x82, 0x72, 0x0F, 0x54, 0x9D, 0x8B, 0x4B, 0x77, 0x9A, 0x9C, 0x4D, 0x81, 0x2E,
-    0x81, 0x7C, 0x8C, 0x01, 0x18, 0x67, 0xB3, 0x74, 0x68, 0x74, 0x5B, 0x6E, 0x79, 0x34, 0xC3, 0x5C,
-    0x52, 0x2B, 0x7F, 0x1A, 0x25, 0xA6, 0x72, 0xB6, 0x9F, 0x49, 0x99, 0x0E, 0xB1, 0xBC, 0xA1, 0xBB,
-    0xEF, 0x16, 0x3A, 0x52, 0x59, 0x1B, 0x88, 0xB2, 0x33, 0x6F, 0x74, 0x48, 0xE7, 0xF2, 0x56, 0x99,
-    0xAB, 0x5F, 0x7B, 0xC5, 0xB3, 0xD6, 0xB9, 0x7E, 0xEE, 0xF5, 0x17, 0x24, 0x42, 0xBB, 0x84, 0x68,
-    0xA4, 0x00, 0x66, 0x1F, 0xE9, 0xEC, 0x89, 0x3C, 0x09, 0xC0, 0x98, 0x25, 0x96, 0x33, 0xC5, 0x30,
-    0x95, 0x98, 0x14, 0x21, 0x6A, 0x94, 0x30, 0x4A, 0xED, 0x40, 0x0A, 0x45, 0x79, 0x31, 0x60, 0xFF,
-    0x51, 0xE7, 0xE2, 0xD6, 0x25, 0x0D, 0x36, 0x82, 0xCF, 0xCA, 0xE5, 0xFA, 0xA9, 0x76, 0x3F, 0xFC,
-    0xD3, 0x3A, 0x24, 0xB5, 0x8B, 0x1B, 0x8C, 0xD2, 0x8F, 0xCE, 0xA0, 0xF3, 0x04, 0xCA, 0x4A, 0xDD,
-    0x95, 0x8E, 0x8C, 0x6B, 0x15, 0x78, 0xB4, 0xCD, 0xE6, 0xEE, 0xCC, 0xEE, 0xEA, 0xC7, 0x57, 0x9B,
-    0x59, 0xA6, 0xB9, 0xA6, 0xCF, 0xF4, 0xA7, 0xF6, 0xD1, 0x9E, 0x1C, 0x32, 0xE1, 0x69, 0x48, 0xE2,
-    0x26, 0x38, 0xF1, 0x9E, 0x73, 0xE4, 0xE0, 0x08, 0xBA, 0x11, 0xFC, 0xBE, 0x6A, 0xF0, 0x51, 0xFE,
-    0x2F, 0x5D, 0x52, 0x7B, 0x68, 0x0C, 0x01, 0xD5, 0xD1, 0xBD, 0x25, 0xEF, 0x38, 0x25, 0x4F, 0x69,
-    0x5C, 0x70, 0xF2, 0x0B, 0x95, 0x00, 0x21, 0x86, 0x0B, 0x45, 0xBF, 0x9F, 0x2B, 0xD1, 0xFE, 0x38,
-    0x28, 0xD7, 0xDC, 0x3F, 0x86, 0xA4, 0x0F, 0xCF, 0x05, 0x82, 0x99, 0x44, 0xBA, 0x5D, 0xD0, 0xBE,
-    0x68, 0x98, 0x82, 0xBD, 0xE3, 0xA8, 0x8F, 0xBB, 0xB8, 0x4D, 0x1A, 0x18, 0xB7, 0x5C, 0xD5, 0xC1,
-    0x67, 0xCB, 0xE5, 0x11, 0x51, 0x1D, 0x3F, 0xFA, 0x73, 0xD7, 0xD0, 0x39, 0xEC, 0xDF, 0xC5, 0x7A,
-    0x29, 0x9B, 0x28, 0x70, 0x39, 0x76, 0x01, 0x85, 0x2A, 0x95, 0xBE, 0x85, 0x6E, 0x26, 0x53, 0xED,
-    0x57, 0x51, 0x1E, 0x5E, 0xA2, 0xAB, 0x7B, 0x6E, 0xD7, 0xCD, 0x6B, 0x01, 0x52, 0xE5, 0x2A, 0x66,
-    0x01, 0x84, 0x6C, 0xAE, 0xA0, 0x0A, 0xE5, 0xA1, 0xD4, 0x91, 0x38, 0xDF, 0x44, 0x83, 0x4B, 0x3B,
-    0x1D, 0x9B, 0x74, 0x89, 0xB2, 0xA6, 0x4F, 0x55, 0x1C, 0xFA, 0xB4, 0x75, 0xD1, 0xF0, 0x02, 0x80,
-    0x7E, 0x1C, 0xC1, 0xB1, 0x51, 0xAF, 0xB3, 0xE8, 0x7C, 0x79, 0xBB, 0x90, 0xFF, 0x92, 0x7A, 0x4E,
-    0x15, 0xA3, 0xBA, 0xE5, 0x66, 0xC5, 0x94, 0x31, 0xEE, 0x80, 0xDA, 0xB3, 0x52, 0xEC, 0x55, 0x5F,
-    0x05, 0xE6, 0x76, 0xA5, 0x18, 0xAD, 0x54, 0xF8, 0x57, 0x09, 0x6D, 0xA2, 0xAC, 0xE2, 0x95, 0xFE,
-    0xCE, 0xC8, 0xDA, 0x6F, 0xE1, 0xC2, 0x2B, 0x11, 0x2C, 0xA8, 0xE6, 0x0D, 0xAA, 0x56, 0x80, 0xB9,
-    0x55, 0x2A, 0xB7, 0x75, 0xF3, 0xB5, 0x6A, 0xEF, 0x22, 0x53, 0x0A, 0x00, 0x29, 0x82, 0x1A, 0xDA,
-    0x06, 0x80, 0xB1, 0x33, 0x08, 0xD9, 0x02, 0x16, 0x25, 0x86, 0xF2, 0xC3, 0xEC, 0x06, 0x66, 0x2F,
-    0xF4, 0xFF, 0x08, 0x7F, 0xA5, 0x10, 0xD7, 0x0B, 0x7F, 0x41, 0x80, 0xFC, 0x15, 0xC0, 0x70, 0xF1,
-    0xDC, 0x38, 0x4C, 0x02, 0x48, 0x43, 0x47, 0x10, 0x9D, 0xBF, 0xA9, 0x68, 0x14, 0x9C, 0xC7, 0x16,
-    0xDF, 0x42, 0xA3, 0x32, 0x0C, 0x72, 0x18, 0xE7, 0xDC, 0x98, 0xD8, 0x52, 0x5E, 0x0B, 0x77, 0x70,
-    0xC2, 0x0D, 0xD2, 0xBC, 0xE5, 0xED, 0x1A, 0x1B, 0x82, 0xBC, 0x53, 0xFB, 0x27, 0xED, 0xFB, 0x47,
-    0x87, 0xEA, 0x8B, 0xB1, 0x06, 0x40, 0xE9, 0xB1, 0xEE, 0x21, 0x2D, 0xDF, 0xDE, 0xB1, 0x61, 0x53,
-    0x51, 0x01, 0x30, 0xCD, 0x9C, 0x30, 0x22, 0x4C, 0x08, 0x53, 0x9B, 0xDE, 0x28, 0x01, 0xB8, 0xE8,
-    0x00, 0xA3, 0x16, 0x30, 0xA9, 0x89, 0x4C, 0x45, 0x3A, 0x17, 0x24, 0x30, 0x68, 0xB6, 0xE8, 0x01,
-    0xD5, 0x5D, 0xC0, 0x84, 0xD5, 0x80, 0xD8, 0xA7, 0x94, 0x97, 0xE1, 0xC1, 0x72, 0x29, 0x5F, 0x67,
-    0x6E, 0xCD, 0xA5, 0x2B, 0x21, 0x3C, 0x66, 0x19, 0xEE, 0x82, 0x88, 0x00, 0xB6, 0x02, 0x12, 0x7F,
-    0x09, 0x00, 0xD1, 0x18, 0xFB, 0x04, 0xAF, 0x4B, 0x80, 0xD5, 0xE2, 0xF3, 0xB7, 0x48, 0x5A, 0x0A,
-    0xE0, 0x05, 0x42, 0x19, 0xB5, 0xDA, 0x3F, 0x04, 0x19, 0xD3, 0x77, 0x0E, 0xCD, 0x35, 0x57, 0x00,
-    0x45, 0x3A, 0x5A, 0xE5, 0x0D, 0xB5, 0x18, 0xB5, 0xE8, 0x54, 0x33, 0x98, 0xA1, 0x18, 0x20, 0x07,
-    0x90, 0xE1, 0xE7, 0x3F, 0x22, 0xF5, 0x16, 0x70, 0x83, 0xD1, 0xB0, 0xC6, 0x25, 0x6E, 0x83, 0x23,
-    0x55, 0xC7, 0x5C, 0xB2, 0xE4, 0x37, 0x98, 0xF4, 0xA9, 0xFA, 0x09, 0x4A, 0x47, 0xAA, 0x42, 0xD8,
-    0xA7, 0xFD, 0xA8, 0x42, 0xA2, 0xCA, 0x14, 0x1A, 0x50, 0x65, 0x0A, 0x25, 0xC6, 0x0D, 0x15, 0xA5,
-    0xA4, 0x0F, 0xE5, 0x9E, 0xEF, 0xE6, 0xB4, 0x45, 0xB4, 0x7C, 0x29, 0xB8, 0xBE, 0x80, 0x24, 0x38,
-    0x0D, 0xA1, 0x40, 0xC6, 0x1E, 0x7C, 0x1D, 0x76, 0x01, 0x6E, 0x27, 0xDC, 0x5B, 0xB3, 0x2D, 0xCC,
-    0x01, 0x24, 0x74, 0x0E, 0x61, 0x86, 0xC5, 0x30, 0x59, 0x8D, 0x9F, 0xD1, 0x77, 0x66, 0x7D, 0xCB,
-    0xF5, 0x96, 0xA6, 0xBE, 0x23, 0xB9, 0x46, 0xA1, 0x9F, 0x14, 0x0C, 0x64, 0x69, 0xE8, 0x23, 0x33,
-    0x9A, 0x16, 0xF0, 0x48, 0x4D, 0xCB, 0x0F, 0xA5, 0xD5, 0x51, 0x69, 0x4B, 0xF3, 0x00, 0xD0, 0xC2,
-    0xD2, 0x34, 0xA1, 0xFC, 0x04, 0xE6, 0xE1, 0x29, 0xBC, 0x02, 0x2C, 0x43, 0x0A, 0xC6, 0xC0, 0xB1,
-    0xC2, 0xF7, 0x15, 0xA1, 0x7C, 0xA1, 0x36, 0x40, 0x85, 0xA9, 0xD5, 0xC5, 0xD2, 0x4E, 0x11, 0x8B,
-    0x7A, 0xD5, 0x87, 0x68, 0x20, 0xE0, 0x4F, 0x25, 0x5D, 0xDE, 0x81, 0xB5, 0x2D, 0x17, 0x9A, 0xD1,
-    0xC8, 0x9C, 0x70, 0xE3, 0xCB, 0x35, 0x42, 0xA1, 0x9C, 0x42, 0xD9, 0x7A, 0x07, 0x84, 0x32, 0x48,
-    0x8E, 0x3A, 0x68, 0xD5, 0xF9, 0xA4, 0x57, 0x75, 0x57, 0x62, 0x73, 0xE6, 0xB8, 0xC3, 0xA4, 0x9C,
-    0xBE, 0xC7, 0xCC, 0xB0, 0x6B, 0xC9, 0xA0, 0xD3, 0xFB, 0x21, 0x51, 0x34, 0x06, 0x4C, 0xDF, 0xEB,
-    0x04, 0x1F, 0xAB, 0x54, 0x6B, 0xE4, 0xE2, 0x7E, 0x70, 0xCB, 0x18, 0x3B, 0x51, 0x0C, 0x8A, 0xAA,
-    0xEA, 0x13, 0xE8, 0xEA, 0x25, 0x84, 0x15, 0x12, 0xDB, 0x03, 0x40, 0x76, 0x55, 0x10, 0x02, 0xE0,
-    0x13, 0x4F, 0xF6, 0x3F, 0x5D, 0xED, 0xB9, 0x8B, 0xAF, 0x5D, 0xEF, 0xB0, 0x58, 0xC5, 0x5D, 0xDA,
-    0xA7, 0x43, 0xD2, 0x47, 0x6D, 0x90, 0x5D, 0xEA, 0x7C, 0xA5, 0xC7, 0x99, 0x6E, 0xFE, 0x03, 0x0C,
-    0x7D, 0x37, 0x5A, 0xAA, 0x05, 0x2C, 0x4E, 0x4E, 0x44, 0x68, 0x3A, 0x2A, 0xFB, 0x92, 0x82, 0x2E,
-    0x39, 0x3B, 0x0D, 0x19, 0x34, 0xBD, 0xA5, 0x76, 0x9F, 0xC2, 0xC6, 0x21, 0x72, 0x86, 0x7D, 0x52,
-    0xE2, 0xA1, 0x83, 0xEF, 0xD6, 0xF3, 0xB9, 0xBF, 0x75, 0x16, 0xF5, 0x28, 0xC9, 0x2F, 0xB8, 0xCA,
-    0x0B, 0xF8, 0xDD, 0x38, 0x3B, 0x3B, 0x7B, 0xF7, 0x42, 0x17, 0xD5, 0xF4, 0xA5, 0x29, 0xD0, 0xDF,
-    0x71, 0x96, 0x62, 0x2D, 0x43, 0xB9, 0x99, 0xD6, 0x16, 0x34, 0xC4, 0x57, 0x73, 0x11, 0xDE, 0xBE,
-    0x36, 0x23, 0x06, 0x33, 0xAC, 0x71, 0xA2, 0x3F, 0x43, 0x19, 0x32, 0xA2, 0x17, 0xAF, 0x37, 0x34,
-    0xCE, 0x82, 0xF9, 0x7E, 0x7C, 0x21, 0xB6, 0xF5, 0xBA, 0xA3, 0x04, 0x8A, 0x43, 0x9B, 0x07, 0xAD,
-    0xCB, 0x92, 0x27, 0xCA, 0xA4, 0xDF, 0x33, 0xD9, 0x0E, 0x26, 0x30, 0x9B, 0xA4, 0x3C, 0x61, 0x1C,
-    0xDF, 0x41, 0xF0, 0x91, 0x12, 0x10, 0x37, 0xEA, 0x07, 0x30, 0x49, 0xEA, 0x35, 0xD8, 0xDB, 0xE5,
-    0x4A, 0x78, 0x0A, 0x59, 0x68, 0xDD, 0x9A, 0xA8, 0x13, 0xE0, 0xB0, 0xB1, 0xF3, 0x09, 0xE8, 0xEB,
-    0xCC, 0x2E, 0x71, 0xB3, 0x62, 0x54, 0x3E, 0x3F, 0xC3, 0x7A, 0xC9, 0x60, 0x0E, 0xC6, 0x53, 0x4B,
-    0x0B, 0x44, 0x60, 0xB0, 0xAC, 0x1A, 0xF9, 0x26, 0x72, 0x9A, 0xD4, 0x61, 0xA7, 0x03, 0xBA, 0xA8,
-    0x8E, 0x54, 0x71, 0xA4, 0x0B, 0x9B, 0xB8, 0x8E, 0x87, 0x37, 0xBB, 0x45, 0x9B, 0x54, 0x69, 0x3D,
-    0xEF, 0xE6, 0x9D, 0x26, 0x26, 0xE5, 0x82, 0xAD, 0x2F, 0xAC, 0x45, 0xDC, 0x3E, 0xB5, 0x2D, 0xDA,
-    0x50, 0xFB, 0xE3, 0x7E, 0xD4, 0x46, 0x0D, 0xFA, 0xAB, 0x3A, 0xD6, 0x69, 0x95, 0x9E, 0x8B, 0xF8,
-    0x2A, 0x51, 0x6D, 0xEB, 0x95, 0xFE, 0x71, 0xBD, 0x50, 0x09, 0x1D, 0x60, 0xBC, 0xFF, 0xB5, 0xF8,
-    0xDE, 0x03, 0x17, 0xF6, 0xB6, 0xC3, 0xB9, 0x8C, 0x3B, 0x06, 0x4B, 0x0E, 0x33, 0x88, 0xD0, 0x7B,
-    0xB7, 0xF1, 0x1F, 0x23, 0xD6, 0x8C, 0xC4, 0xE6, 0xBE, 0x34, 0xD2, 0x1E, 0x4E, 0xCD, 0xDF, 0x16,
-    0x16, 0x2B, 0x97, 0x26, 0x35, 0x95, 0x5B, 0xFB, 0x11, 0x34, 0x35, 0x49, 0x70, 0xA7, 0xE1, 0xD4,
-    0x6F, 0xB5, 0x6C, 0xA8, 0x56, 0xA1, 0x98, 0x59, 0x1F, 0x42, 0x1A, 0xA8, 0x9E, 0x76, 0x2A, 0xE9,
-    0xB8, 0x7E, 0xDA, 0x92, 0x51, 0x08, 0xA7, 0x4B, 0x1A, 0x2A, 0xFA, 0x1D, 0xF8, 0x6F, 0x23, 0x67,
-    0x43, 0xE3, 0xA1, 0xFC, 0x86, 0xBA, 0x2B, 0x51, 0x17, 0x4C, 0xF5, 0x74, 0xCA, 0x87, 0x67, 0x7E,
-    0xA0, 0x01, 0xD3, 0x2B, 0x46, 0x6E, 0x21, 0x99, 0xEA, 0x37, 0x7C, 0x6A, 0x4A, 0x56, 0x97, 0x39,
-    0x15, 0xA0, 0xC2, 0xE6, 0x02, 0xC4, 0x99, 0xE7, 0xA7, 0x34, 0x64, 0x08, 0x74, 0xD7, 0x11, 0x8C,
-    0xDE, 0x93, 0xF3, 0x3B, 0x3A, 0xAB, 0xAE, 0xE6, 0x7B, 0xC0, 0x64, 0x1B, 0xF2, 0xFF, 0x14, 0x30,
-    0x40, 0x4F, 0x98, 0x1A, 0xC7, 0x90, 0x9E, 0xDF, 0x0B, 0x67, 0x61, 0xAB, 0x7C, 0x7D, 0xDD, 0x66,
-    0x50, 0x76, 0x2B, 0x54, 0x74, 0x2E, 0xC0, 0x98, 0x30, 0x55, 0xA8, 0x62, 0xD1, 0x3B, 0xDB, 0xC7,
-    0x38, 0x76, 0x3D, 0xCF, 0x83, 0x8D, 0xE0, 0x79, 0xFC, 0x08, 0x79, 0x83, 0x49, 0x1F, 0xC9, 0x80,
-    0xED, 0xDF, 0x1E, 0xE8, 0xC5, 0xFF, 0x44, 0x27, 0x04, 0xE3, 0x52, 0xB2, 0x26, 0xB5, 0xB4, 0xA5,
-    0xE5, 0x48, 0xE6, 0x43, 0xE4, 0xC3, 0x0B, 0xA0, 0xF5, 0xA4, 0x38, 0xBB, 0xB4, 0x37, 0xD6, 0x9A,
-    0x20, 0x57, 0x6E, 0x1F, 0x0A, 0x79, 0x5D, 0x8C, 0xE0, 0xB6, 0x55, 0xDC, 0x06, 0x9C, 0x31, 0xFF,
-    0xA4, 0xD7, 0x54, 0x7A, 0x1E, 0xB9, 0x2D, 0x6A, 0xAC, 0xB6, 0xF6, 0x45, 0x3A, 0x78, 0xC9, 0x48,
-    0x81, 0x52, 0xE1, 0x5C, 0xD9, 0x00, 0xEF, 0x5A, 0x63, 0xF5, 0x6D, 0xE8, 0x9B, 0xE7, 0xC1, 0xAD,
-    0x9E, 0x1A, 0x56, 0x4E, 0xF3, 0xD8, 0x9C, 0x98, 0xFF, 0xDC, 0x63, 0xAD, 0xB5, 0x1F, 0xDD, 0xE6,
-    0xCE, 0x29, 0x8D, 0x1A, 0xDD, 0xE6, 0xD6, 0x35, 0xC0, 0x11, 0x5E, 0xBA, 0x2C, 0x1D, 0xEF, 0x76,
-    0xAE, 0xAF, 0x97, 0xC7, 0x57, 0xF6, 0xC5, 0x75, 0x7E, 0x76, 0x76, 0x61, 0x5E, 0x19, 0xD7, 0xDA,
-    0xBD, 0x9E, 0x35, 0xBE, 0x7E, 0xC5, 0xF5, 0x2E, 0x5C, 0xEB, 0xD7, 0x89, 0x3C, 0x61, 0x35, 0x41,
-    0xAC, 0xB6, 0x61, 0x0C, 0xA8, 0x94, 0x6B, 0x67, 0x08, 0xA8, 0x1A, 0xB7, 0x9F, 0xC5, 0x54, 0x57,
-    0xE3, 0xEC, 0x28, 0x27, 0xDD, 0x86, 0xFB, 0x7E, 0x94, 0x87, 0x00, 0xF9, 0xCC, 0x25, 0xE8, 0x9B,
-    0xE0, 0x4C, 0x21, 0x42, 0xD2, 0x1A, 0xA3, 0xF2, 0x1A, 0x72, 0x92, 0xD7, 0x98, 0x2D, 0xD7, 0x10,
-    0x40, 0x83, 0x7F, 0xCD, 0x8F, 0x9F, 0x5C, 0xB7, 0x7C, 0x60, 0x14, 0xE5, 0x9A, 0x72, 0xC2, 0x38,
-    0x0A, 0x3E, 0x68, 0x6F, 0x69, 0x8E, 0x34, 0xAF, 0xB1, 0x56, 0xDE, 0xBC, 0x32, 0xFC, 0x7A, 0xB9,
-    0xF4, 0x0C, 0x73, 0xE5, 0x2A, 0x68, 0x77, 0x5F, 0x6F, 0xE6, 0x6D, 0xA8, 0x26, 0x41, 0xC6, 0x0B,
-    0x65, 0x99, 0x90, 0x36, 0xA7, 0xFC, 0xC6, 0xD7, 0x82, 0x31, 0x32, 0xE5, 0x73, 0x9A, 0xDF, 0x92,
-    0xBA, 0xEF, 0xE8, 0xA2, 0x71, 0x1C, 0xA8, 0xE0, 0xA6, 0x99, 0xAD, 0x33, 0x46, 0x15, 0xEE, 0xE4,
-    0x01, 0x39, 0xA3, 0xE6, 0x51, 0x69, 0xB0, 0xD0, 0x04, 0x82, 0x56, 0x4A, 0x21, 0x42, 0xA4, 0x1A,
-    0x0E, 0xC1, 0xD7, 0xC8, 0xE4, 0xBC, 0xBA, 0x8E, 0x52, 0x21, 0xBD, 0x18, 0x25, 0x40, 0x63, 0x1A,
-    0x54, 0x95, 0xBE, 0x82, 0x99, 0xF6, 0x8F, 0x69, 0xB3, 0x65, 0x84, 0xAC, 0x65, 0x89, 0x49, 0x37,
-    0xFA, 0xF4, 0xD6, 0xDF, 0xC6, 0xC2, 0xED, 0xFA, 0x7A, 0xCE, 0xD9, 0x66, 0x50, 0xDF, 0x71, 0x15,
-    0x88, 0xA4, 0xA7, 0xED, 0xF4, 0xD0, 0xEC, 0x6C, 0xC2, 0x47, 0x03, 0x6F, 0xBF, 0x9A, 0xE2, 0xD1,
-    0xEF, 0x02, 0xA8, 0x5E, 0x17, 0xCC, 0x60, 0x2E, 0x80, 0x9C, 0xEE, 0x0A, 0x59, 0x16, 0x7D, 0xA4,
-    0xB6, 0x2C, 0x51, 0x58, 0xCB, 0xEC, 0xAB, 0x1A, 0xDB, 0x15, 0x7C, 0x56, 0xE9, 0xBF, 0x54, 0xEC,
-    0x07, 0x6D, 0x3F, 0x41, 0x09, 0x0B, 0x6D, 0x8B, 0x0C, 0xAB, 0xF4, 0x1F, 0x77, 0xC8, 0xB1, 0x4A,
-    0xFF, 0x91, 0x26, 0x02, 0x8D, 0xB6, 0xF7, 0x35, 0x99, 0xA9, 0xD1, 0x8A, 0x4B, 0x3F, 0xD5, 0xF6,
-    0x9E, 0xB6, 0xF7, 0xB4, 0xAD, 0x34, 0x8D, 0xF8, 0x80, 0x6D, 0xE9, 0x7F, 0x82, 0xD6, 0x97, 0x1A,
-    0x72, 0x6B, 0xAB, 0x77, 0x03, 0xB6, 0x5F, 0x0D, 0x6C, 0x93, 0x47, 0x3D, 0xDB, 0x58, 0x3A, 0xB6,
-    0x91, 0xB4, 0x6C, 0x43, 0xD4, 0xAD, 0xB4, 0x5D, 0x40, 0x97, 0xB5, 0x9D, 0x23, 0x19, 0x67, 0x5B,
-    0xB1, 0x0D, 0x50, 0xB4, 0x29, 0xF3, 0x81, 0x35, 0x31, 0x6C, 0x8B, 0x4D, 0x69, 0x4D, 0x65, 0x4D,
-    0x6D, 0x4D, 0x6B, 0x4D, 0xC7, 0xE6, 0x13, 0x61, 0xF3, 0x2B, 0x64, 0x03, 0xCE, 0x7F, 0x28, 0x25,
-    0x9A, 0xFF, 0x84, 0xD1, 0xD1, 0x84, 0x13, 0x96, 0x40, 0x9B, 0xBC, 0x65, 0x93, 0x76, 0x6C, 0x62,
-    0x61, 0x13, 0xCA, 0x1B, 0x68, 0xE6, 0xF2, 0x21, 0x9A, 0x99, 0x7C, 0x26, 0xAC, 0x1E, 0x3D, 0x62,
-    0x93, 0x9F, 0xB3, 0x41, 0x1D, 0x4F, 0x9B, 0xD8, 0x9A, 0xD0, 0x9A, 0xB9, 0x35, 0x33, 0x6B, 0xDC,
-    0xD8, 0x90, 0x23, 0x53, 0x40, 0xB8, 0xB2, 0x08, 0x8C, 0x35, 0x5B, 0x7A, 0x81, 0x99, 0xB9, 0x76,
-    0x75, 0x63, 0xB7, 0x05, 0x79, 0x58, 0xA5, 0xFF, 0xD3, 0x0C, 0xC6, 0x16, 0x23, 0x84, 0x4A, 0x5F,
-    0x06, 0xD2, 0x25, 0xEC, 0x9B, 0xCA, 0x24, 0x0C, 0xE2, 0x8C, 0xBE, 0x65, 0xD3, 0xC0, 0xDF, 0x20,
-    0x05, 0xD8, 0xFA, 0x05, 0x75, 0xB1, 0x9E, 0xE3, 0xB8, 0xDC, 0x22, 0x8D, 0x71, 0xCE, 0x71, 0x05,
-    0xDA, 0x46, 0x98, 0x91, 0xE1, 0x6F, 0xC6, 0x2C, 0x05, 0xDA, 0x30, 0x86, 0x86, 0x89, 0x45, 0x56,
-    0xB3, 0xD1, 0xE3, 0x07, 0xC7, 0x44, 0xFA, 0x9C, 0x31, 0x89, 0x39, 0xB1, 0x8C, 0x66, 0x9C, 0xD6,
-    0x14, 0x19, 0x10, 0x1C, 0xA1, 0x6F, 0x11, 0x3F, 0xEC, 0x82, 0x1C, 0x00, 0x77, 0x0F, 0xAD, 0x7C,
-    0xC6, 0x11, 0x85, 0x39, 0x5F, 0x3A, 0x83, 0xF3, 0x77, 0x5E, 0x51, 0xFE, 0xFF, 0xDF, 0x53, 0x94,
-    0x71, 0x4C, 0x70, 0x62, 0xB2, 0x11, 0x59, 0x8C, 0x3A, 0x1F, 0xB7, 0x36, 0xE6, 0x33, 0xA3, 0xE0,
-    0x8C, 0x71, 0xEC, 0xDE, 0x32, 0x23, 0xED, 0x9D, 0x25, 0xD7, 0x9B, 0xA0, 0x0E, 0xE4, 0xF3, 0x0C,
-    0x42, 0x51, 0xAA, 0x25, 0xB5, 0xA7, 0x50, 0x70, 0x0D, 0xED, 0xFF, 0x86, 0x7D, 0x6A, 0xF6, 0xAF,
-    0x36, 0x33, 0xD8, 0x6C, 0xC8, 0x9C, 0xCF, 0x91, 0xEA, 0x48, 0x8D, 0x08, 0x95, 0x45, 0x39, 0x14,
-    0xA6, 0x58, 0x5C, 0x9E, 0xA1, 0x7F, 0x3D, 0x7E, 0xBC, 0xCD, 0xDF, 0x6F, 0xC2, 0x45, 0xB5, 0x97,
-    0x16, 0xF0, 0xAC, 0xD3, 0x70, 0xDB, 0xF1, 0x8A, 0xD5, 0xB7, 0xC8, 0xB2, 0xDE, 0x87, 0x52, 0x6A,
-    0xA4, 0x1A, 0x66, 0xCC, 0x52, 0xD2, 0xA9, 0xFE, 0x41, 0x87, 0x1F, 0xB3, 0xA2, 0x23, 0x54, 0x71,
-    0xB3, 0x4F, 0x3C, 0x80, 0x10, 0x66, 0x29, 0xE5, 0x78, 0x7F, 0xB6, 0xE1, 0x7E, 0x6E, 0xE0, 0x1F,
-    0xF1, 0x33, 0x7F, 0xF2, 0xA6, 0x1D, 0x38, 0xB0, 0xA2, 0x93, 0xA5, 0x63, 0xEA, 0xAB, 0xB3, 0xEC,
-    0x1D, 0x59, 0x1D, 0xCC, 0x8A, 0x6D, 0x57, 0x55, 0x7F, 0x9E, 0x5B, 0xF6, 0xF9, 0x8E, 0x20, 0xFC,
-    0x46, 0x6E, 0xF1, 0xE5, 0x77, 0x04, 0x3D, 0xE3, 0x54, 0x95, 0x12, 0x95, 0x85, 0x14, 0x22, 0x5A,
-    0x25, 0xF2, 0xF9, 0x89, 0xD5, 0xB4, 0xAC, 0x74, 0x32, 0x49, 0xC4, 0x21, 0xC5, 0x15, 0x75, 0x1E,
-    0xE2, 0xB9, 0xA0, 0xDB, 0x85, 0xAF, 0x46, 0xDD, 0x81, 0x05, 0x5B, 0xA6, 0xA7, 0x28, 0xDE, 0x24,
-    0xA8, 0xC3, 0x92, 0xB3, 0x70, 0xE3, 0xCA, 0xA1, 0x90, 0xAE, 0x94, 0x89, 0x9B, 0xEE, 0x73, 0x8E,
-    0xDC, 0x80, 0xB1, 0x06, 0x53, 0x28, 0x98, 0xE1, 0x02, 0x04, 0x60, 0x7A, 0xE5, 0x6B, 0x26, 0x5B,
-    0x69, 0xCD, 0xB2, 0x55, 0xDA, 0x8E, 0xF5, 0x8D, 0xC4, 0x0A, 0x6A, 0x14, 0x96, 0xA8, 0x47, 0x39,
-    0xD9, 0x2D, 0x06, 0xF2, 0x7E, 0x2E, 0xAC, 0x19, 0xCE, 0xC9, 0xC3, 0x51, 0x48, 0x80, 0x73, 0x66,
-    0xCD, 0xB6, 0xFA, 0x30, 0x63, 0xF0, 0x2B, 0x56, 0xAA, 0x0D, 0x7F, 0xF8, 0xF5, 0x90, 0xC7, 0x2B,
-    0x90, 0x58, 0x16, 0x83, 0x18, 0xFF, 0xA0, 0x74, 0xDC, 0xF2, 0x4C, 0x84, 0xA5, 0x22, 0xDD, 0x26,
-    0xD3, 0xAA, 0x18, 0xDF, 0x1A, 0x6E, 0xAC, 0x67, 0x9D, 0x80, 0x35, 0x1A, 0x97, 0x3C, 0xED, 0xC6,
-    0x5D, 0xA6, 0xBF, 0xE6, 0x37, 0x9D, 0x3C, 0xBD, 0xDF, 0x63, 0x29, 0x9C, 0xDD, 0xA8, 0xEF, 0xA0,
-    0x73, 0xCA, 0x3C, 0xBE, 0xB1, 0x50, 0x2E, 0x6F, 0xC3, 0x31, 0x2A, 0xB6, 0x1F, 0x68, 0xFB, 0x36,
-    0xB7, 0xFF, 0x4B, 0xBD, 0xF7, 0x21, 0xB0, 0x96, 0xFB, 0xF4, 0x51, 0x40, 0xF5, 0xB3, 0xC1, 0xE5,
-    0xFF, 0xCE, 0x4A, 0xEF, 0x23, 0x45, 0xE8, 0x23, 0x52, 0xE4, 0x71, 0xE7, 0xD2, 0x2F, 0x58, 0xFA,
-    0xD2, 0x55, 0x13, 0x31, 0xC5, 0xC1, 0x31, 0x0E, 0x09, 0xA5, 0xD8, 0xF1, 0xF8, 0x8C, 0x18, 0x47,
-    0xAC, 0x59, 0xE0, 0x5B, 0x48, 0x5D, 0x09, 0x59, 0x7C, 0x21, 0xED, 0x88, 0xD0, 0xCA, 0x14, 0x2F,
-    0x32, 0x93, 0x88, 0x4C, 0x5B, 0xD7, 0xCF, 0x91, 0xAB, 0x96, 0x8E, 0xC1, 0xE4, 0x6A, 0x66, 0x59,
-    0x2D, 0x2B, 0x6F, 0x79, 0x17, 0xB1, 0x2A, 0xD1, 0xC7, 0x2C, 0x28, 0x0A, 0x75, 0xD6, 0x4E, 0x05,
-    0xAD, 0x00, 0x49, 0x7A, 0x8F, 0x19, 0xF6, 0x98, 0x6F, 0x9B, 0x0D, 0xE3, 0xAF, 0x80, 0x8A, 0x08,
-    0x3E, 0xD5, 0x56, 0x16, 0x05, 0x96, 0xF1, 0x90, 0x5A, 0x15, 0x8F, 0x15, 0x3D, 0xDF, 0xE2, 0xB4,
-    0x2C, 0xC0, 0x7A, 0x40, 0xAF, 0x0A, 0x88, 0x79, 0xE1, 0xB8, 0x3D, 0xB2, 0x0F, 0xBD, 0x15, 0x57,
-    0x4F, 0xAC, 0x0B, 0x98, 0xE0, 0xA4, 0x63, 0x94, 0xDF, 0xE1, 0x8E, 0x20, 0x66, 0x0B, 0x50, 0xBC,
-    0x57, 0xD1, 0x55, 0x1F, 0x5F, 0x2E, 0x70, 0x7C, 0x55, 0x99, 0xF5, 0x02, 0xD6, 0xBE, 0x01, 0xD2,
-    0x69, 0x87, 0xD2, 0x7A, 0xD2, 0x5B, 0x55, 0xC5, 0x0A, 0xDA, 0x56, 0x5F, 0x64, 0xF1, 0x60, 0x3C,
-    0x96, 0xDB, 0xCA, 0x4F, 0xD3, 0xD7, 0x86, 0x89, 0x8C, 0x86, 0xE8, 0x02, 0x4C, 0x64, 0x3C, 0xBE,
-    0x4B, 0xFA, 0xCD, 0x32, 0x62, 0xE2, 0x5C, 0xB9, 0xB1, 0xC6, 0x6F, 0x65, 0xCE, 0x31, 0x03, 0x62,
-    0xEE, 0x13, 0x8C, 0x5D, 0x4A, 0x32, 0x33, 0x23, 0x01, 0x2F, 0x75, 0x59, 0x4D, 0x5D, 0x6C, 0x7C,
-    0x22, 0x67, 0x1A, 0x20, 0x72, 0xDD, 0xF2, 0x32, 0xCC, 0xA5, 0xDA, 0x7C, 0x2A, 0xF7, 0xAD, 0x7D,
-    0xB6, 0xA6, 0x85, 0xB9, 0x80, 0xC6, 0xC2, 0x50, 0x24, 0xAD, 0xD5, 0xA2, 0x61, 0x1F, 0x16, 0x16,
-    0xC7, 0xF1, 0x0C, 0x8F, 0x55, 0x14, 0xC6, 0xE3, 0x5B, 0x9D, 0xE3, 0xB1, 0x73, 0xD8, 0x5B, 0x8D,
-    0xD8, 0x3A, 0x17, 0xCF, 0xEF, 0xCC, 0x63, 0x82, 0x14, 0x75, 0x73, 0x7C, 0x76, 0x0E, 0x04, 0xBF,
-    0xD9, 0x67, 0x9A, 0x93, 0xC7, 0x10, 0xFF, 0x64, 0xA2, 0x6D, 0x56, 0xA6, 0xA4, 0x0A, 0x54, 0x93,
-    0xDF, 0xB6, 0x62, 0x61, 0xF4, 0x98, 0xCA, 0xF9, 0x19, 0x25, 0xFC, 0x03, 0xAA, 0x71, 0x41, 0x05,
-    0xC7, 0x39, 0x63, 0xA0, 0x26, 0xA2, 0xC2, 0x11, 0x63, 0x5C, 0xA3, 0xA4, 0x19, 0xB5, 0x38, 0x3E,
-    0xC5, 0x17, 0xC4, 0xE0, 0x2E, 0x41, 0x44, 0x4E, 0x5B, 0xBB, 0x74, 0xD7, 0x94, 0x7D, 0x14, 0x1B,
-    0x03, 0x37, 0xDE, 0x45, 0xD2, 0xB1, 0x90, 0x0C, 0xC7, 0xE5, 0x8A, 0x18, 0x0E, 0x99, 0x8F, 0xDD,
-    0xBE, 0xBF, 0xC5, 0xBA, 0x93, 0x95, 0xBB, 0x11, 0xF6, 0xD4, 0xC1, 0x70, 0x5D, 0xD1, 0x38, 0xDD,
-    0x3D, 0x60, 0xD8, 0x3B, 0xD3, 0x90, 0x1B, 0x99, 0x3B, 0x0A, 0x35, 0x5D, 0x02, 0x37, 0x0F, 0xB5,
-    0xEA, 0xF2, 0xD6, 0xD4, 0x82, 0x20, 0x57, 0x9D, 0x0A, 0x70, 0x2A, 0xC0, 0x2E, 0xF2, 0xA5, 0x6A,
-    0xA7, 0xFC, 0x45, 0x37, 0x93, 0x5E, 0xF1, 0x03, 0x4E, 0xD7, 0x6E, 0x4E, 0xC7, 0x53, 0x2F, 0x00,
-    0x87, 0x0F, 0x14, 0x28, 0x56, 0xF9, 0x63, 0x81, 0x28, 0x28, 0x56, 0xB9, 0x7C, 0x21, 0x9D, 0x46,
-    0xF0, 0x58, 0x43, 0xA5, 0x3F, 0x87, 0x8F, 0x00, 0x90, 0xBC, 0xB9, 0x02, 0xF0, 0xAE, 0xDA, 0xDD,
-    0x21, 0x87, 0xEE, 0xE7, 0xF2, 0x33, 0xAB, 0xE0, 0x36, 0x36, 0xD5, 0x67, 0x90, 0xDF, 0xCA, 0xB3,
-    0x84, 0xC9, 0xB2, 0xDF, 0x03, 0x6A, 0x1C, 0xAB, 0xF8, 0xE5, 0xDC, 0x6A, 0xF7, 0x1A, 0xA3, 0x6B,
-    0x24, 0xB6, 0xCF, 0x9A, 0xE6, 0xF6, 0x31, 0x4B, 0x7B, 0x05, 0xE8, 0xB6, 0x23, 0x11, 0x8D, 0xDE,
-    0xAA, 0xB7, 0x8A, 0x70, 0x7D, 0x3A, 0x59, 0x20, 0xA2, 0x2C, 0xD4, 0x0B, 0x8E, 0x87, 0x1D, 0xA8,
-    0x2E, 0xBE, 0xE7, 0x2C, 0x61, 0x7D, 0x2E, 0x08, 0x9F, 0x84, 0x48, 0x44, 0x7E, 0x25, 0xCA, 0x94,
-    0xA7, 0xC2, 0x12, 0x65, 0xA4, 0x5F, 0x04, 0x11, 0xA8, 0xE0, 0xCC, 0x45, 0x76, 0xCE, 0x5C, 0x16,
-    0x97, 0x00, 0x8E, 0x60, 0xD8, 0x25, 0xC1, 0x19, 0x52, 0x2C, 0xA7, 0x5E, 0xE8, 0x9E, 0xE7, 0x98,
-    0x4F, 0x79, 0x7E, 0x1F, 0xE6, 0x7B, 0xA6, 0x86, 0xEF, 0x88, 0x41, 0xF0, 0x29, 0xD0, 0xB7, 0x62,
-    0x12, 0x69, 0xA0, 0xC1, 0xDB, 0xCF, 0x7C, 0xAB, 0x76, 0x82, 0x4E, 0x34, 0xC2, 0x61, 0x6A, 0x38,
-    0xA4, 0xC3, 0xD9, 0x9D, 0x01, 0xFC, 0xDD, 0x06, 0xBB, 0x84, 0x18, 0xAD, 0x7C, 0x11, 0xFC, 0x1B,
-    0x6A, 0x35, 0xED, 0x8C, 0xC1, 0x6B, 0x6E, 0xD1, 0x34, 0xCA, 0x54, 0x07, 0x58, 0xEE, 0xC6, 0x2D,
-    0x96, 0xFC, 0xA0, 0x73, 0x83, 0x9D, 0x6E, 0x58, 0xC0, 0xB6, 0x39, 0x8C, 0x81, 0x56, 0x04, 0xF2,
-    0xF9, 0x11, 0x62, 0xB8, 0xC6, 0xC6, 0x13, 0xFC, 0x91, 0x9C, 0xDF, 0xB4, 0xBB, 0xDF, 0x26, 0x08,
-    0x9F, 0x04, 0x4B, 0x45, 0xE3, 0x43, 0x10, 0xFB, 0xB1, 0x2C, 0x8C, 0xD8, 0x0F, 0x41, 0x6C, 0xB7,
-    0x21, 0xF6, 0x33, 0xE8, 0x3C, 0x12, 0x7B, 0xA4, 0x78, 0x02, 0x6F, 0x18, 0x23, 0x5E, 0x5C, 0x13,
-    0x5B, 0x40, 0xEC, 0x8F, 0x41, 0xEC, 0x10, 0xC4, 0x0E, 0xA7, 0x43, 0xAB, 0x68, 0xF8, 0x5D, 0x38,
-    0xA7, 0xE8, 0xFC, 0xAF, 0x05, 0x9A, 0x62, 0x87, 0x40, 0x8C, 0x75, 0xB3, 0xE0, 0x8E, 0xE6, 0x4B,
-    0xAF, 0xA0, 0x2E, 0x4F, 0xA8, 0x2E, 0x25, 0xD4, 0xA5, 0x1E, 0xCF, 0x2B, 0xCE, 0x45, 0xE5, 0x5E,
-    0x9D, 0xB3, 0x6A, 0x40, 0x0C, 0x5D, 0x30, 0x75, 0x19, 0x41, 0xF3, 0x5A, 0x60, 0x3F, 0x4B, 0x35,
-    0xE6, 0xCB, 0xDB, 0xB4, 0x89, 0x19, 0x7B, 0x1E, 0x1C, 0xA5, 0xCD, 0xCB, 0xBD, 0xDD, 0x7E, 0xC6,
-    0xE7, 0x24, 0x5A, 0x7C, 0x70, 0x5E, 0xB5, 0x3E, 0x6F, 0x53, 0x69, 0x80, 0xE1, 0xF8, 0xC6, 0x1F,
-    0xDF, 0x7C, 0x31, 0x3E, 0xA8, 0x50, 0xA2, 0xAC, 0xD5, 0xBA, 0x6B, 0xB7, 0x5E, 0xD9, 0xEB, 0x6A,
-    0x7A, 0x94, 0x32, 0x62, 0x50, 0xA8, 0x04, 0x4B, 0xDB, 0x80, 0x79, 0x0F, 0x7C, 0xA2, 0xC6, 0x93,
-    0x10, 0xD6, 0x06, 0xD1, 0x42, 0xDA, 0xC0, 0x4A, 0xA7, 0xBF, 0xE1, 0x53, 0x47, 0x38, 0xFB, 0x43,
-    0x86, 0x50, 0x11, 0xD6, 0x84, 0x08, 0x15, 0x20, 0x07, 0x1C, 0x95, 0x4D, 0x33, 0xD8, 0x6C, 0x48,
-    0x7D, 0x70, 0x6A, 0xC7, 0x40, 0xD1, 0xD6, 0x0A, 0xA5, 0xBC, 0x76, 0x33, 0x6F, 0x5E, 0xEF, 0x7D,
-    0x90, 0x29, 0xF3, 0xBF, 0x77, 0xEE, 0xF2, 0x7B, 0x56, 0x91, 0xC9, 0x7F, 0x2D, 0xF2, 0x68, 0x3C,
-    0xDD, 0x32, 0x41, 0x50, 0x9B, 0x71, 0x2E, 0x83, 0xCA, 0x82, 0x46, 0x57, 0x09, 0x24, 0x41, 0xC3,
-    0x2B, 0x35, 0x91, 0x9D, 0xA3, 0xA8, 0x2A, 0x3F, 0x90, 0x53, 0xC1, 0x6E, 0xF2, 0xD0, 0xF6, 0xB7,
-    0xD5, 0x12, 0x4F, 0x20, 0x59, 0x01, 0xC3, 0xE6, 0xB7, 0x27, 0xA4, 0x6A, 0xCA, 0x6E, 0xD2, 0x14,
-    0x8B, 0x3D, 0xEC, 0xC4, 0x9A, 0x0A, 0xC3, 0xDB, 0xFF, 0x56, 0xCE, 0x28, 0xC5, 0x75, 0xDB, 0x49,
-    0xCF, 0x04, 0xA4, 0xE3, 0x21, 0x0A, 0xF4, 0x17, 0x50, 0xB3, 0x89, 0x2B, 0x20, 0x14, 0x3B, 0xE3,
-    0x0E, 0x60, 0xD9, 0x22, 0x90, 0xAE, 0xC8, 0x99, 0x1E, 0x4A, 0x47, 0xCF, 0x59, 0xB3, 0xF2, 0x5E,
-    0xC2, 0x9E, 0x31, 0x26, 0x3B, 0xA0, 0x9D, 0x3F, 0xFC, 0x1F, 0x97, 0xAF, 0xE0, 0xC0, 0x1E, 0x8D,
-    0xCF, 0xB2, 0x35, 0x2F, 0xED, 0xC0, 0xDA, 0x17, 0x3B, 0xB0, 0xC7, 0xD0, 0xF5, 0xC6, 0xE3, 0x71,
-    0x2C, 0x75, 0x60, 0x2F, 0x65, 0x22, 0xDC, 0x25, 0x2B, 0x17, 0x6E, 0x5B, 0xB9, 0x64, 0xD7, 0xCA,
-    0xBD, 0xA4, 0x4B, 0x59, 0x5B, 0xB9, 0xC5, 0xC6, 0xCA, 0xA5, 0x5B, 0x56, 0xEE, 0xA5, 0x80, 0xD2,
-    0xAA, 0x56, 0x67, 0x0C, 0xAF, 0x5C, 0xE7, 0x4F, 0x69, 0xBE, 0xF4, 0x7A, 0x72, 0x94, 0x5B, 0x4E,
-    0xC1, 0x30, 0x04, 0xE8, 0xBF, 0xCA, 0xE5, 0x0E, 0x87, 0xCC, 0x2A, 0x24, 0x11, 0x0A, 0x44, 0x09,
-    0xBE, 0xA5, 0xFD, 0x3E, 0x73, 0xAC, 0xDF, 0xB1, 0x1E, 0xA9, 0x15, 0x37, 0x1B, 0x86, 0xF2, 0x78,
-    0x00, 0x09, 0x5F, 0xF9, 0x70, 0xCA, 0xBE, 0xC8, 0xBA, 0xA8, 0xC0, 0xCC, 0x52, 0xA3, 0xC7, 0x3F,
-    0x65, 0x8E, 0x86, 0xD0, 0x9B, 0xEA, 0x9D, 0x8A, 0x3D, 0xED, 0x56, 0x8C, 0xDE, 0x2C, 0x29, 0xF9,
-    0xFC, 0x21, 0x1F, 0x03, 0xF3, 0x08, 0xD1, 0x3E, 0x3F, 0x0E, 0xF9, 0x74, 0x84, 0x5D, 0xEA, 0xB2,
-    0xDE, 0x0D, 0x98, 0xB5, 0xBD, 0xCC, 0x55, 0xE9, 0xD5, 0x7C, 0x9F, 0xEE, 0xD0, 0x73, 0xAD, 0xCE,
-    0x8E, 0x93, 0x97, 0x58, 0x6B, 0x6F, 0xF9, 0x9A, 0x5A, 0xB1, 0x06, 0x31, 0x64, 0x8E, 0x56, 0x20,
-    0x57, 0xEF, 0xFD, 0x67, 0x32, 0x20, 0xA3, 0xC0, 0xE3, 0x01, 0x4F, 0x07, 0x65, 0xE2, 0xFD, 0xC1,
-    0x09, 0x1E, 0x64, 0x44, 0xD9, 0x63, 0x79, 0xE4, 0x82, 0x65, 0x66, 0xB9, 0x6E, 0xBE, 0xA5, 0x0B,
-    0xCC, 0x65, 0x11, 0x87, 0x47, 0x03, 0x95, 0xA2, 0x63, 0xD6, 0x8A, 0x7A, 0x69, 0x96, 0xF2, 0x20,
-    0x01, 0xD9, 0xB5, 0x9A, 0x22, 0x3E, 0xE0, 0xC5, 0xFC, 0xEF, 0x53, 0xDA, 0xC8, 0xAF, 0x98, 0x04,
-    0x3E, 0x66, 0xAD, 0xE6, 0xA9, 0xC5, 0x08, 0xBD, 0x5B, 0x9F, 0xD0, 0xCF, 0xA5, 0x9D, 0x82, 0x60,
-    0x26, 0x2B, 0xBA, 0xFA, 0xC1, 0x31, 0xB6, 0xCB, 0x2A, 0x11, 0x1F, 0x6A, 0xC8, 0x11, 0x8A, 0xA0,
-    0x0C, 0x25, 0xF6, 0x7C, 0x17, 0xB8, 0xA1, 0x69, 0x7E, 0x80, 0x00, 0xB7, 0x89, 0xFA, 0xD9, 0xE0,
-    0x8B, 0xBC, 0x0E, 0x87, 0x79, 0x9F, 0xEB, 0xE2, 0x0B, 0xE1, 0xB9, 0x71, 0x35, 0x97, 0x3F, 0xEF,
-    0xD2, 0x0A, 0x11, 0xCD, 0x4F, 0xDB, 0xE4, 0x53, 0x54, 0x0E, 0x7E, 0xDA, 0xC4, 0x5F, 0x21, 0x37,
-    0xFC, 0x8F, 0x3A, 0x7A, 0x84, 0xBA, 0x02, 0x5B, 0xE5, 0xDB, 0x27, 0xAB, 0xF0, 0x31, 0xAA, 0x0E,
-    0x5F, 0x56, 0x8B, 0xA7, 0x7C, 0xBC, 0x40, 0xC7, 0x74, 0x9B, 0x36, 0x41, 0xDB, 0x32, 0xB2, 0x99,
-    0x99, 0xD4, 0x64, 0x40, 0x54, 0x91, 0x54, 0x2A, 0xA5, 0xB0, 0xA0, 0x05, 0x0E, 0x66, 0x51, 0xB5,
-    0x2B, 0x48, 0x0D, 0x56, 0xF8, 0xC6, 0x53, 0xBF, 0xB5, 0x97, 0x28, 0x28, 0x6D, 0x17, 0x76, 0x6D,
-    0xDF, 0xED, 0xFF, 0x94, 0xA9, 0xA4, 0xF5, 0xE7, 0xD8, 0x39, 0x0B, 0x86, 0x76, 0xC8, 0x6B, 0xF3,
-    0x53, 0x4F, 0xB3, 0x1C, 0x4B, 0x94, 0x4B, 0xF0, 0x29, 0xF3, 0x0D, 0x4B, 0x88, 0xDB, 0x3C, 0x02,
-    0x3E, 0x60, 0xD0, 0xC4, 0xA3, 0x39, 0x8D, 0x18, 0x3A, 0x34, 0x90, 0x33, 0xF2, 0x88, 0x09, 0x96,
-    0x5F, 0xD1, 0x77, 0xFD, 0xEF, 0xC8, 0x23, 0x3C, 0x2B, 0xF0, 0x58, 0xDC, 0x06, 0x4F, 0x3E, 0xCB,
-    0xB8, 0x85, 0x6D, 0x20, 0xDB, 0x87, 0xAE, 0x2B, 0x37, 0x3E, 0x78, 0x30, 0x65, 0x8E, 0x8A, 0xFE,
-    0x0F, 0xBC, 0x29, 0x90, 0x45, 0xC4, 0x7C, 0xE8, 0x80, 0x41, 0x96, 0xE5, 0xAC, 0x78, 0x88, 0x82,
-    0x07, 0xBD, 0xBB, 0x60, 0x0A, 0xB3, 0x7D, 0x33, 0x26, 0xA3, 0x9B, 0x27, 0xD1, 0x38, 0x70, 0x7A,
-    0x58, 0x67, 0x6E, 0xC6, 0x36, 0x1B, 0x43, 0xCD, 0xB4, 0x5F, 0x2E, 0x59, 0xB5, 0xCD, 0x64, 0x17,
-    0x68, 0x94, 0x59, 0xB2, 0x60, 0x81, 0xF2, 0x2D, 0x30, 0x48, 0xD4, 0x28, 0xAC, 0x1F, 0x2A, 0x7C,
-    0xD6, 0xA5, 0xF2, 0x7E, 0xC2, 0x73, 0xAC, 0xC2, 0x0C, 0x0F, 0x8C, 0x10, 0x55, 0xB2, 0x7E, 0xFE,
-    0x38, 0xE6, 0xA8, 0x7D, 0xC6, 0x75, 0x22, 0x3E, 0xA2, 0xA2, 0x3B, 0x3E, 0xA9, 0x14, 0xB3, 0xEC,
-    0xDB, 0x79, 0xDF, 0x70, 0x7F, 0x9F, 0xD9, 0x73, 0x24, 0xA0, 0x2E, 0xCE, 0x30, 0x0E, 0x25, 0x1B,
-    0xB3, 0xDA, 0x67, 0x5D, 0x63, 0x71, 0xD2, 0x0F, 0x05, 0x1F, 0x33, 0x05, 0xA3, 0x62, 0x1C, 0x48,
-    0x21, 0xD3, 0x59, 0x8D, 0xE6, 0xE6, 0xEA, 0xB1, 0x33, 0xA6, 0x2C, 0x19, 0xD7, 0xE1, 0x7A, 0x30,
-    0xC4, 0xA7, 0xE3, 0xD3, 0xC8, 0x28, 0x07, 0x7D, 0x5F, 0x03, 0xF7, 0x1F, 0xDE, 0x35, 0x2F, 0x7E,
-    0x47, 0xC1, 0x8F, 0x95, 0x4C, 0x75, 0xE6, 0xF6, 0xDF, 0xCF, 0xFE, 0x0F, 0xDD, 0x5B, 0xBF, 0x93,
-    0xDD, 0x46, 0x72, 0x1E, 0x00, 0xE2, 0xC2, 0x45, 0x04, 0xB8, 0x40, 0x4C, 0x48, 0xBB, 0x70, 0xA9,
-    0xE9, 0x72, 0x21, 0xB9, 0x54, 0x02, 0x4E, 0x0A, 0x2F, 0xA1, 0xAB, 0xB8, 0x4A, 0x2E, 0xA0, 0x83,
-    0x8B, 0xE4, 0x80, 0x7F, 0xC1, 0x09, 0xA0, 0xFF, 0x82, 0x55, 0xE4, 0xC0, 0x81, 0x19, 0x28, 0x10,
-    0x1F, 0xCB, 0xC5, 0xC4, 0x81, 0x83, 0x3B, 0x01, 0xB2, 0x42, 0x27, 0x38, 0xDB, 0x55, 0x17, 0x5C,
-    0x70, 0xCF, 0x25, 0x4A, 0x2E, 0x53, 0x81, 0x71, 0x3E, 0x5C, 0x09, 0x5C, 0x02, 0x68, 0x7F, 0x5F,
-    0xF7, 0xBC, 0xB7, 0xD8, 0xE5, 0x52, 0xE4, 0xF1, 0x4E, 0x6B, 0x91, 0xEF, 0x2D, 0xBA, 0xB1, 0xEF,
-    0x0D, 0x66, 0xBA, 0x7B, 0x7A, 0xFA, 0xC7, 0x4C, 0xBF, 0x4B, 0x65, 0xD1, 0x37, 0x83, 0x8C, 0x32,
-    0x54, 0xFD, 0xD5, 0xDA, 0xE9, 0xAB, 0xD8, 0xFA, 0x77, 0x5F, 0xF4, 0xD5, 0xFE, 0xDD, 0xD8, 0x7B,
-    0x40, 0x6B, 0x5C, 0xD6, 0xD2, 0x7D, 0x72, 0x0A, 0x5C, 0x93, 0xC5, 0x39, 0x11, 0x69, 0x23, 0x80,
-    0x3A, 0x05, 0x70, 0x99, 0xFC, 0xE2, 0xB6, 0xCB, 0x17, 0xF6, 0x3A, 0x11, 0x8C, 0x00, 0xD5, 0x70,
-    0x0E, 0x18, 0xF7, 0x4D, 0x08, 0x72, 0x71, 0x07, 0x65, 0x2A, 0xC7, 0x4D, 0x99, 0xA0, 0x97, 0x32,
-    0x24, 0x70, 0x15, 0xC1, 0x81, 0x3C, 0x7C, 0x6A, 0x5C, 0x77, 0xD3, 0xED, 0x5E, 0xCD, 0x52, 0x3A,
-    0x3C, 0x32, 0xA2, 0x07, 0x19, 0xF8, 0x44, 0xEF, 0x64, 0xFE, 0xF1, 0xD6, 0x01, 0x97, 0x4E, 0x3A,
-    0xB4, 0x38, 0x07, 0x54, 0xA4, 0xF4, 0x0C, 0x08, 0xCE, 0x69, 0x17, 0x48, 0xEB, 0x5C, 0x24, 0x10,
-    0x53, 0x42, 0x8E, 0xD8, 0x6E, 0x69, 0xCE, 0x01, 0xA1, 0x73, 0xA1, 0x4B, 0xDA, 0x9F, 0xA4, 0x2D,
-    0xA8, 0x90, 0x3E, 0x03, 0xD8, 0xC6, 0x14, 0x49, 0x24, 0x7F, 0x27, 0x2E, 0x9E, 0x9C, 0x94, 0xC9,
-    0xE0, 0x8A, 0x3A, 0xE9, 0x5D, 0xD1, 0xF2, 0xAE, 0x8D, 0x47, 0x57, 0xD5, 0xD1, 0x12, 0x48, 0x49,
-    0xD1, 0x39, 0x8A, 0xAE, 0x2D, 0xF8, 0x6C, 0xFA, 0xE5, 0x72, 0xAB, 0x8B, 0x6A, 0x17, 0x97, 0xC6,
-    0x5E, 0x4F, 0x22, 0x20, 0x31, 0x50, 0x91, 0x4F, 0x2E, 0x46, 0xD3, 0xD9, 0xA5, 0x0B, 0x58, 0x76,
-    0xD9, 0x84, 0x0F, 0x29, 0xE0, 0x50, 0xEA, 0xA2, 0x07, 0xC1, 0x6D, 0xB3, 0xC5, 0x03, 0x1D, 0x69,
-    0x2E, 0xFE, 0x97, 0x44, 0xE7, 0x5F, 0x0B, 0xBA, 0x48, 0x65, 0x06, 0x4C, 0x84, 0x62, 0x8E, 0x21,
-    0x28, 0x74, 0x48, 0x29, 0xAD, 0xA1, 0x67, 0xD9, 0xE0, 0xA1, 0x7C, 0x71, 0xE3, 0x79, 0x6D, 0x56,
-    0xF0, 0xD0, 0x35, 0xE5, 0xB3, 0xDF, 0xEF, 0xBB, 0xF5, 0xEB, 0xB9, 0x6D, 0xAF, 0xDE, 0xE3, 0x68,
-    0x03, 0x26, 0x74, 0x82, 0x10, 0xC7, 0xBC, 0x0F, 0xFA, 0x02, 0x4C, 0xE5, 0x18, 0x3E, 0x9B, 0xC9,
-    0xCA, 0x16, 0xDC, 0x2E, 0xE0, 0x5B, 0xBA, 0xF4, 0x18, 0x82, 0xDE, 0xE6, 0x53, 0xDE, 0xC5, 0x53,
-    0xD1, 0x45, 0x73, 0xDE, 0x47, 0x73, 0x36, 0x47, 0x53, 0x2A, 0xBF, 0x9E, 0x42, 0x12, 0x5C, 0x81,
-    0xBA, 0x18, 0x3A, 0xE1, 0x2A, 0x70, 0x9E, 0xE0, 0xE9, 0x68, 0xFE, 0xBE, 0x8B, 0xE7, 0xE2, 0x28,
-    0x9B, 0x20, 0xE9, 0x01, 0xD7, 0x36, 0xA1, 0xFE, 0x5E, 0x31, 0x49, 0xE7, 0x6D, 0xDE, 0xD9, 0x02,
-    0x00, 0xC4, 0x62, 0xB8, 0x5C, 0x5E, 0x2E, 0x4F, 0x28, 0x4F, 0xE4, 0xB1, 0x62, 0x88, 0x82, 0x9C,
-    0x27, 0xCB, 0x5F, 0xDD, 0xA6, 0x02, 0xE7, 0x1D, 0xE8, 0xF5, 0x4A, 0x99, 0xB7, 0x2E, 0x1C, 0x5D,
-    0xF3, 0x10, 0x93, 0x1C, 0x61, 0xF6, 0x97, 0x70, 0x70, 0x69, 0x9B, 0x2D, 0xB3, 0x9B, 0x5C, 0x5A,
-    0x16, 0xF5, 0x1B, 0xEE, 0xA7, 0x2E, 0x77, 0x0D, 0x15, 0x1E, 0x6F, 0xD5, 0x79, 0xF7, 0x76, 0x40,
-    0x9C, 0xB9, 0xB7, 0x0C, 0x97, 0x6F, 0x05, 0xE3, 0x29, 0xBC, 0xFB, 0xFE, 0x6D, 0xDF, 0x3E, 0x77,
-    0xB3, 0x3E, 0x9F, 0x95, 0x15, 0x68, 0xFB, 0x00, 0xFD, 0x17, 0x5F, 0xFC, 0x23, 0xBE, 0x8B, 0x3B,
-    0x4C, 0x32, 0x9E, 0x89, 0x86, 0x40, 0xC6, 0x18, 0xC2, 0x62, 0xB3, 0x8C, 0x8A, 0x0E, 0x2D, 0x68,
-    0xD0, 0x34, 0x7D, 0xEC, 0xAE, 0xF1, 0x33, 0xAE, 0xAB, 0xAD, 0x72, 0x4B, 0xCE, 0xF9, 0xF2, 0xDC,
-    0x43, 0x52, 0x5D, 0x01, 0x81, 0xCB, 0xFC, 0x27, 0x01, 0xBE, 0x59, 0x0E, 0x64, 0x29, 0xA0, 0xDC,
-    0x47, 0x8B, 0xB8, 0x45, 0xC2, 0x45, 0x1E, 0x2C, 0x95, 0x7C, 0x90, 0x8D, 0x6F, 0xB3, 0x29, 0xB4,
-    0xFD, 0x08, 0x5D, 0x6E, 0x43, 0xF4, 0x98, 0x4F, 0x31, 0xD6, 0x68, 0x33, 0x40, 0x25, 0x03, 0xD9,
-    0x16, 0x54, 0xC9, 0x1A, 0xB2, 0x4F, 0x25, 0x84, 0x9C, 0x0A, 0xFD, 0xB2, 0xE2, 0x97, 0xB8, 0x4F,
-    0x21, 0xA8, 0x6C, 0x89, 0xA0, 0x9E, 0x89, 0x94, 0x3A, 0x91, 0x2D, 0x8D, 0x80, 0xF4, 0xF9, 0xCC,
-    0xAF, 0x13, 0x7E, 0x3D, 0x46, 0x68, 0x1A, 0xD7, 0xAE, 0x5F, 0x6B, 0x0D, 0x97, 0xDD, 0x74, 0x06,
-    0xE0, 0xE3, 0xE8, 0x1B, 0x41, 0x70, 0xF3, 0xF0, 0xF0, 0x06, 0xD4, 0x60, 0xFF, 0x87, 0x7F, 0x7F,
-    0xFF, 0xE9, 0xCC, 0x8F, 0x6B, 0x9D, 0xCE, 0x5C, 0x46, 0x9D, 0x4E, 0x8A, 0x8D, 0xD3, 0x99, 0x97,
-    0x8D, 0x4E, 0x67, 0x5E, 0x16, 0x3A, 0x9D, 0xC4, 0x98, 0x4E, 0xC5, 0x98, 0x4E, 0xE0, 0x85, 0xD3,
-    0x08, 0x31, 0x4F, 0x1E, 0x6F, 0x39, 0x9D, 0x2E, 0xBF, 0xDF, 0xEB, 0x74, 0xE6, 0xEF, 0x0E, 0x3A,
-    0x9D, 0x79, 0x39, 0xE9, 0x74, 0xE6, 0xE5, 0x27, 0x3A, 0x9D, 0x7C, 0x9E, 0xD3, 0x99, 0x97, 0xF9,
-    0xA7, 0x9C, 0xCE, 0xBC, 0x4C, 0x7F, 0xF9, 0x52, 0xD3, 0x09, 0x89, 0xE2, 0x3B, 0x39, 0x01, 0xD7,
-    0x37, 0x9B, 0xCD, 0x3D, 0x7E, 0x1E, 0xC0, 0x4A, 0x24, 0x30, 0x09, 0x58, 0x5F, 0x65, 0xF1, 0x45,
-    0xD3, 0x56, 0x75, 0xDE, 0x56, 0xE8, 0xBD, 0x72, 0x69, 0x57, 0x95, 0x59, 0x57, 0x74, 0x15, 0xAD,
-    0x18, 0xAD, 0x39, 0xFA, 0x87, 0x54, 0xAE, 0x96, 0xBA, 0x72, 0xF1, 0xE4, 0xF2, 0x0D, 0xE0, 0xCA,
-    0x7B, 0x72, 0x78, 0xF3, 0xCC, 0x24, 0xBD, 0x7F, 0x5F, 0x36, 0x1F, 0x7F, 0xF3, 0x63, 0xCE, 0x6D,
-    0xBE, 0x79, 0x96, 0x95, 0x5E, 0x9A, 0xB0, 0x82, 0x66, 0xF2, 0x2B, 0x29, 0x63, 0x18, 0x53, 0xC7,
-    0x8B, 0x33, 0x45, 0x75, 0x49, 0xD1, 0xCC, 0xEC, 0x9F, 0xFD, 0x3B, 0x1F, 0xB2, 0x6D, 0xBB, 0xBB,
-    0xAE, 0x1C, 0x1E, 0x96, 0x41, 0xF3, 0x10, 0xFC, 0x2E, 0xF4, 0x11, 0x2E, 0xFD, 0x90, 0xA6, 0xD1,
-    0x4B, 0xF2, 0x3D, 0xF4, 0x41, 0x1E, 0x79, 0xDD, 0x67, 0xBF, 0x15, 0x8D, 0x67, 0xFB, 0x03, 0xE0,
-    0xE2, 0x91, 0x3E, 0x5F, 0x62, 0x49, 0xB8, 0x60, 0x03, 0x85, 0x7F, 0xFF, 0x63, 0x27, 0x03, 0xD4,
-    0x97, 0xA6, 0x17, 0xD6, 0xBB, 0x73, 0x57, 0xC0, 0xF5, 0x0D, 0x77, 0xE9, 0x10, 0xD6, 0x39, 0x5D,
-    0x5E, 0x1E, 0x64, 0x0B, 0x96, 0x41, 0xBE, 0xC0, 0x4A, 0x15, 0x58, 0x64, 0x3F, 0x94, 0x45, 0xDD,
-    0x0C, 0xC0, 0x13, 0x82, 0xCF, 0x97, 0xEA, 0x6B, 0xF9, 0x5B, 0xB4, 0x7B, 0xF3, 0x19, 0x7E, 0xF4,
-    0x1C, 0xE0, 0x82, 0xF7, 0x37, 0x1B, 0x93, 0xA8, 0x7A, 0x52, 0x51, 0xA7, 0x2A, 0xF0, 0xAF, 0x58,
-    0x6C, 0x65, 0xA6, 0x30, 0x57, 0x58, 0xBC, 0x00, 0xCC, 0x57, 0x4F, 0x59, 0x0F, 0xB1, 0xC2, 0x40,
-    0x21, 0x64, 0x4A, 0xE8, 0xA2, 0x6F, 0x01, 0x86, 0x7D, 0xEE, 0xAE, 0xD5, 0x4D, 0x2F, 0x03, 0xDF,
-    0xD5, 0xF6, 0x52, 0x19, 0xF5, 0x2E, 0x1E, 0xE8, 0xFC, 0x5C, 0xD3, 0x62, 0x9E, 0x00, 0x2B, 0x58,
-    0x11, 0xF5, 0x82, 0xEE, 0xEA, 0x11, 0x9C, 0x5F, 0x24, 0x5D, 0x26, 0x1D, 0x4C, 0x7F, 0xF1, 0xA0,
-    0xFB, 0x33, 0x2C, 0xE7, 0xE2, 0xD9, 0x7F, 0xB6, 0x54, 0xE0, 0x3C, 0xA1, 0x5E, 0x70, 0xC9, 0x98,
-    0xE6, 0xEA, 0x8E, 0x38, 0x81, 0x89, 0x46, 0x44, 0x50, 0x9E, 0x5C, 0x4D, 0x59, 0xD5, 0x18, 0x01,
-    0xEA, 0x93, 0x09, 0x9D, 0xAD, 0x7A, 0x3E, 0x17, 0xD4, 0xEE, 0xFB, 0x6A, 0x04, 0x27, 0xE7, 0x2D,
-    0x1C, 0x4D, 0x61, 0xED, 0x2D, 0x1F, 0xD4, 0x44, 0x3D, 0x37, 0x2D, 0x22, 0xBF, 0x96, 0x9D, 0xA5,
-    0x34, 0x33, 0xA8, 0x36, 0xCF, 0xEC, 0x9F, 0xD9, 0x42, 0xB3, 0x8B, 0xC5, 0xA8, 0x0D, 0x7B, 0x75,
-    0x56, 0xAD, 0xFB, 0xA7, 0x13, 0x73, 0xB5, 0x35, 0x8D, 0xAD, 0x7A, 0xD5, 0xFC, 0x10, 0x16, 0x36,
-    0x14, 0xBA, 0x43, 0xD8, 0x26, 0x1A, 0x4F, 0xE0, 0x04, 0x12, 0xC8, 0x6E, 0xC1, 0xF2, 0xA2, 0xC9,
-    0xA5, 0x0C, 0x71, 0x06, 0xED, 0x02, 0xFC, 0x26, 0x15, 0x9A, 0x98, 0xCA, 0x0D, 0xAC, 0xE6, 0xCD,
-    0xD1, 0x57, 0x1A, 0x4E, 0xA6, 0x00, 0x44, 0xE7, 0x7D, 0x3A, 0x44, 0x8A, 0x73, 0xF8, 0x44, 0xE2,
-    0xA2, 0xCD, 0x14, 0x23, 0xB4, 0x00, 0xBE, 0xF4, 0x43, 0x71, 0x3F, 0xE7, 0xB2, 0x41, 0xC4, 0x32,
-    0x11, 0xC7, 0x53, 0x34, 0x10, 0xA7, 0x43, 0xB2, 0xD5, 0x48, 0xA3, 0xCF, 0x5A, 0xE2, 0x02, 0x4E,
-    0x84, 0x6B, 0xA9, 0xC1, 0x63, 0x5C, 0xBE, 0x94, 0x1B, 0x30, 0xD7, 0xA5, 0xC3, 0xF7, 0xF1, 0x64,
-    0x38, 0x1D, 0x0D, 0x7F, 0x2B, 0x7C, 0xDD, 0x34, 0xBE, 0x32, 0x08, 0x94, 0x7C, 0x31, 0x14, 0x20,
-    0x5F, 0x1A, 0x23, 0x82, 0xAF, 0x9F, 0xC2, 0x5E, 0x90, 0xAF, 0xEF, 0x81, 0x18, 0xF2, 0xE5, 0x92,
-    0xC9, 0xDB, 0x91, 0xC1, 0x29, 0x81, 0xB4, 0x25, 0xBC, 0x67, 0x1C, 0x85, 0x01, 0x22, 0xF6, 0x0C,
-    0x75, 0xA1, 0x99, 0x01, 0x5F, 0xFA, 0xB5, 0xE3, 0x1C, 0x3E, 0xBA, 0xC7, 0xC7, 0xB0, 0x0A, 0x66,
-    0x3E, 0xA6, 0x18, 0x7C, 0x29, 0xF6, 0x2F, 0xD5, 0x15, 0x68, 0x69, 0x6E, 0x22, 0x51, 0x1D, 0x23,
-    0xA1, 0xE9, 0x3B, 0x8B, 0x89, 0xC4, 0x2D, 0x26, 0x92, 0x60, 0xD6, 0x11, 0x83, 0x1F, 0xC3, 0x5B,
-    0xF4, 0x8C, 0x38, 0x55, 0x41, 0x81, 0x07, 0xEA, 0xB9, 0x0B, 0xEE, 0xCF, 0xC6, 0xA7, 0x83, 0x2B,
-    0x36, 0xBF, 0xF5, 0x2E, 0x62, 0x1C, 0xF7, 0xD7, 0x4E, 0xD2, 0x11, 0x21, 0x61, 0x75, 0x5F, 0xB2,
-    0x3E, 0x65, 0x1C, 0x3B, 0x17, 0x1D, 0x22, 0xE9, 0x1C, 0x8B, 0xA5, 0xFD, 0x00, 0x21, 0xED, 0xBD,
-    0x52, 0xCA, 0x59, 0x94, 0x92, 0xF0, 0x77, 0xC4, 0xD1, 0x1C, 0xFF, 0x86, 0x38, 0x19, 0xD3, 0x4F,
-    0x35, 0x36, 0xEC, 0xF3, 0x3B, 0x62, 0x19, 0x80, 0x68, 0xA8, 0x84, 0xC5, 0x44, 0x2C, 0xA5, 0x62,
-    0x12, 0x8B, 0x10, 0x55, 0x27, 0x23, 0xF0, 0xA2, 0xDA, 0x3B, 0xC8, 0xD0, 0x82, 0xE3, 0x6E, 0x0F,
-    0x48, 0x29, 0x95, 0xC0, 0xBD, 0x79, 0x2A, 0xE8, 0x73, 0x9B, 0xD2, 0x66, 0x5B, 0xE7, 0x18, 0xED,
-    0xE8, 0xC0, 0xD8, 0x49, 0x35, 0xB3, 0x93, 0x81, 0xDE, 0x18, 0xCF, 0x67, 0xB2, 0x4F, 0x08, 0x68,
-    0xC3, 0x54, 0xCC, 0xB8, 0x0B, 0xF8, 0xD9, 0x6D, 0xF5, 0x66, 0x35, 0xE3, 0xEA, 0x96, 0xA6, 0xAC,
-    0x33, 0x29, 0x5F, 0x65, 0xCF, 0xE1, 0xE6, 0xAE, 0x89, 0xC4, 0x52, 0x94, 0x7C, 0xF2, 0x0E, 0xDE,
-    0x56, 0x29, 0x89, 0x52, 0xFE, 0x14, 0x5D, 0x5A, 0x85, 0x00, 0x90, 0x52, 0x6D, 0x7E, 0xB2, 0x35,
-    0xF7, 0x63, 0x11, 0xAD, 0xF9, 0x53, 0x0B, 0x78, 0x03, 0x79, 0xC0, 0x4E, 0x23, 0xB9, 0x35, 0x2A,
-    0x52, 0x15, 0x48, 0x24, 0xE5, 0x04, 0xA7, 0x8B, 0x0E, 0x91, 0xCE, 0xB1, 0xE8, 0xA8, 0xCA, 0x56,
-    0x31, 0xAA, 0x50, 0xAA, 0x41, 0xC7, 0x85, 0x05, 0x60, 0x6F, 0xCC, 0x48, 0x2C, 0x88, 0x06, 0x89,
-    0x6A, 0x8E, 0x47, 0x06, 0xB0, 0x5C, 0x17, 0xCC, 0x11, 0xC0, 0x48, 0x22, 0x8F, 0x36, 0xCD, 0xA2,
-    0x42, 0xC1, 0x95, 0x2D, 0x1C, 0xA4, 0x2C, 0x66, 0x06, 0x65, 0x35, 0x25, 0x12, 0x59, 0xA4, 0x04,
-    0x75, 0x22, 0x93, 0x81, 0xD2, 0x76, 0x59, 0xA5, 0x6A, 0x99, 0x96, 0xCF, 0xA6, 0x76, 0x51, 0x79,
-    0x64, 0xBC, 0xA7, 0xF6, 0xD9, 0xA5, 0xD2, 0xBD, 0x2E, 0x4C, 0x5F, 0xDE, 0xAC, 0x79, 0x68, 0x94,
-    0xF8, 0x40, 0x34, 0x37, 0x8D, 0x97, 0x44, 0x83, 0xA4, 0x41, 0xD5, 0x13, 0x3C, 0x5F, 0x79, 0x5D,
-    0x98, 0x7E, 0xC3, 0x66, 0x10, 0x7E, 0x8D, 0xF6, 0x17, 0x31, 0x79, 0xC9, 0x87, 0x44, 0x49, 0xFA,
-    0x52, 0x6D, 0x4D, 0x56, 0xE7, 0x24, 0xFE, 0x12, 0xD6, 0xCA, 0x6B, 0xA3, 0xDE, 0xFA, 0x8A, 0x26,
-    0x0D, 0xE5, 0x93, 0x39, 0x5E, 0x14, 0x69, 0x12, 0x1E, 0x4F, 0x31, 0x09, 0x0C, 0x3E, 0x0A, 0x3E,
-    0x72, 0x4F, 0xBD, 0x5E, 0x69, 0xA6, 0x03, 0xB3, 0x4E, 0xE9, 0xE2, 0xD6, 0x3C, 0xDC, 0x52, 0x1E,
-    0x7E, 0x16, 0x6F, 0x57, 0xC8, 0x7F, 0xE8, 0x9B, 0xBC, 0xA2, 0x53, 0xCC, 0x27, 0x49, 0x72, 0xB8,
-    0xBB, 0x89, 0x76, 0x37, 0xF1, 0xEE, 0x26, 0xDD, 0xDD, 0x64, 0x93, 0xB7, 0xEB, 0xC5, 0x98, 0xD9,
-    0x4D, 0xD5, 0xFB, 0x9B, 0x66, 0xEB, 0x6F, 0xB0, 0x42, 0x26, 0xF3, 0xBA, 0x6D, 0x36, 0x9B, 0x1D,
-    0x2C, 0xD5, 0x63, 0xE8, 0x66, 0x89, 0xDE, 0xA4, 0x8B, 0xBF, 0x41, 0x4B, 0xBB, 0x01, 0x71, 0xF9,
-    0x82, 0x0C, 0xC1, 0xED, 0xF3, 0x8D, 0x66, 0x77, 0x23, 0xFE, 0x26, 0xDC, 0xDD, 0x44, 0x64, 0x72,
-    0xF2, 0xCE, 0x45, 0xC7, 0xE2, 0x54, 0x65, 0xCB, 0x66, 0x73, 0xC4, 0x01, 0xD9, 0x61, 0x47, 0x66,
-    0xF5, 0x86, 0x81, 0xB8, 0xDE, 0x90, 0xD7, 0xCC, 0xE7, 0x99, 0x46, 0x30, 0x37, 0xB4, 0xB8, 0x82,
-    0x6B, 0x1D, 0xB4, 0x56, 0xB9, 0x92, 0xF9, 0xFB, 0x8B, 0x6E, 0x70, 0xFC, 0x25, 0x9A, 0x73, 0xC5,
-    0x17, 0xAA, 0x07, 0xEA, 0x11, 0xBD, 0x7D, 0xB7, 0x5D, 0x38, 0x5B, 0x1F, 0xDF, 0x0C, 0xAD, 0x65,
-    0xA5, 0xCF, 0x16, 0x16, 0xEA, 0xA9, 0x53, 0x40, 0x6C, 0xEC, 0x0E, 0x30, 0xF8, 0xF2, 0x9E, 0x98,
-    0xB8, 0x8D, 0x4D, 0x7E, 0x4D, 0x18, 0x6A, 0xF0, 0xE6, 0xD2, 0xFF, 0x70, 0x3E, 0xE1, 0xDC, 0xF9,
-    0xD3, 0xD0, 0x5C, 0x8A, 0x98, 0x4F, 0x35, 0xE9, 0x28, 0x9C, 0x6D, 0x0A, 0xE8, 0x8B, 0xC9, 0x54,
-    0x6D, 0x31, 0x0F, 0xE3, 0x39, 0xAA, 0x9A, 0x3E, 0x76, 0xB8, 0x4B, 0xEF, 0x74, 0xAF, 0x6C, 0x75,
-    0x2D, 0x50, 0x2F, 0xF7, 0xD4, 0x35, 0xE8, 0x14, 0x4C, 0xA7, 0xAE, 0xDF, 0x1D, 0xDE, 0x3C, 0xB7,
-    0x2D, 0xAF, 0xE3, 0xCD, 0xE6, 0x4C, 0xBF, 0xA2, 0xB9, 0x1A, 0x25, 0x11, 0xD9, 0x9C, 0xBB, 0x7C,
-    0xB0, 0xCC, 0xEE, 0x8A, 0xBB, 0x78, 0x5A, 0xAE, 0x7F, 0xCC, 0x4E, 0xB8, 0x7A, 0xEA, 0x58, 0x9A,
-    0x2E, 0x1D, 0xF3, 0xA1, 0xE8, 0xE2, 0xF9, 0x8A, 0xDF, 0xC4, 0xBC, 0x58, 0xB9, 0x60, 0x8E, 0xFA,
-    0xA4, 0xCF, 0xC6, 0x74, 0xCA, 0xB0, 0x90, 0xD2, 0x21, 0x1D, 0xC3, 0xA3, 0xF0, 0x68, 0xB5, 0xD1,
-    0x72, 0x61, 0xB4, 0x70, 0x86, 0x72, 0xB3, 0x13, 0x16, 0xA5, 0x31, 0xE0, 0x63, 0x7C, 0xE9, 0xF7,
-    0x76, 0x73, 0x2E, 0x26, 0x7F, 0xE1, 0xBE, 0x0D, 0xA9, 0x6A, 0xCF, 0x1C, 0xE0, 0xC5, 0xAF, 0x00,
-    0x1A, 0x8E, 0xE5, 0x58, 0x17, 0xAB, 0xFE, 0xDD, 0xC1, 0xA6, 0x56, 0xDB, 0xC5, 0xC5, 0xD6, 0x70,
-    0x67, 0xAA, 0x74, 0x74, 0x32, 0xDE, 0x20, 0x93, 0xD7, 0x52, 0xFC, 0x85, 0x7B, 0xD0, 0x3C, 0x68,
-    0xF4, 0xFB, 0x87, 0x5E, 0x31, 0x56, 0x7B, 0x85, 0xBC, 0x52, 0x56, 0xFD, 0x9F, 0xD1, 0x97, 0x6D,
-    0x3A, 0x66, 0xA7, 0xF4, 0x05, 0x86, 0x03, 0xE9, 0xA4, 0x5D, 0x09, 0x8D, 0x7C, 0x83, 0x67, 0xB8,
-    0x48, 0xFF, 0xD0, 0xAB, 0x5A, 0x68, 0x77, 0xB7, 0xE9, 0xAA, 0x7F, 0xBF, 0x2D, 0xDA, 0x56, 0xDB,
-    0xA2, 0xAF, 0xB6, 0x55, 0x8F, 0xEC, 0xEE, 0xD4, 0xB6, 0xE8, 0x45, 0xCE, 0x11, 0x4C, 0xD3, 0x7F,
-    0x97, 0x66, 0x8C, 0x47, 0x6F, 0x93, 0x6B, 0x43, 0xFD, 0xCE, 0x25, 0x85, 0x46, 0x01, 0x25, 0x5B,
-    0x88, 0xA2, 0x94, 0xFB, 0x1F, 0xB4, 0xFF, 0x2D, 0x51, 0xB4, 0x47, 0x7F, 0x21, 0x8F, 0xEE, 0x86,
-    0xDA, 0x6F, 0xFF, 0x2C, 0x74, 0xFA, 0x01, 0xEB, 0xA5, 0x5E, 0xF5, 0x69, 0x23, 0xD8, 0x78, 0x8F,
-    0x6C, 0x74, 0xDD, 0x8C, 0xB3, 0xFD, 0x96, 0x15, 0x9D, 0x8B, 0x8A, 0xEB, 0x4D, 0xB5, 0x3D, 0xF0,
-    0x48, 0x85, 0xEE, 0xC8, 0x3F, 0x5E, 0x4C, 0x7C, 0x9A, 0xEE, 0xFC, 0xBD, 0x1A, 0xDD, 0xC2, 0x35,
-    0xDD, 0xD9, 0xDC, 0x09, 0x73, 0xC2, 0x68, 0x9E, 0x53, 0xAC, 0xA8, 0x35, 0xD4, 0x19, 0xEA, 0x0D,
-    0x8D, 0x86, 0xF4, 0x34, 0xA0, 0xF9, 0xB5, 0x28, 0xFA, 0x57, 0x9E, 0x2B, 0xB8, 0xE6, 0x33, 0x9E,
-    0xCC, 0xB8, 0xE6, 0xDF, 0xA4, 0x23, 0x82, 0x2B, 0x52, 0x54, 0x8D, 0x8A, 0x8A, 0x49, 0x51, 0x26,
-    0x8A, 0x12, 0x79, 0x57, 0x74, 0xFF, 0xE4, 0x33, 0xA2, 0x50, 0x3E, 0x27, 0x72, 0xF2, 0x5B, 0x45,
-    0xD5, 0xB1, 0x22, 0x6E, 0xC1, 0x01, 0x65, 0x86, 0x12, 0x43, 0x91, 0xA1, 0xD0, 0x90, 0xF3, 0xA8,
-    0xA2, 0x37, 0xD9, 0x1C, 0xAD, 0x33, 0xB3, 0xE2, 0x4C, 0x66, 0x56, 0x9F, 0xCA, 0xCC, 0x56, 0x59,
-    0x4A, 0xD0, 0x68, 0x08, 0x93, 0x99, 0xC5, 0x6A, 0xD4, 0x77, 0x86, 0x16, 0x7C, 0xC0, 0x73, 0xDD,
-    0x07, 0xA7, 0x29, 0x3E, 0x69, 0x44, 0x7D, 0x5A, 0x66, 0x71, 0x06, 0x26, 0x87, 0xDE, 0x2E, 0x96,
-    0xB6, 0x19, 0x35, 0xDC, 0xA0, 0x8D, 0x0A, 0xCD, 0xFB, 0xEE, 0xD1, 0x56, 0xA3, 0x2C, 0x43, 0xE1,
-    0x0E, 0x75, 0xBE, 0xA5, 0x7F, 0xAE, 0xB2, 0x68, 0xC5, 0xF7, 0xE9, 0x47, 0x48, 0x21, 0xF9, 0x8A,
-    0xEB, 0x7E, 0xF9, 0x1B, 0x4C, 0x78, 0x64, 0xEA, 0xE6, 0x6C, 0xC2, 0xD5, 0x75, 0x9A, 0x66, 0x3E,
-    0x54, 0xEA, 0xFD, 0xD9, 0xD4, 0x99, 0x04, 0xCD, 0xF6, 0xE5, 0x9E, 0x9B, 0xA0, 0xBD, 0x16, 0xBC,
-    0xFB, 0x3C, 0xAD, 0x58, 0xE7, 0x69, 0xA1, 0x70, 0x71, 0xC3, 0xAC, 0xAA, 0x8D, 0xCF, 0x86, 0xF0,
-    0xE9, 0x3C, 0xED, 0xB5, 0xE0, 0x1D, 0xE9, 0x9A, 0x4D, 0x34, 0xD3, 0xB5, 0xD8, 0xD2, 0xB5, 0xF4,
-    0xF9, 0xE9, 0xDA, 0xEB, 0xA1, 0xF3, 0x96, 0xB5, 0x8D, 0x3E, 0x6B, 0xD3, 0x8C, 0x3C, 0x35, 0x84,
-    0xAC, 0x4D, 0x37, 0xBA, 0xEE, 0x9E, 0x93, 0xB5, 0xBD, 0x1E, 0xBC, 0xBF, 0xE1, 0xD2, 0xD2, 0xBD,
-    0xC5, 0x7D, 0x3B, 0x29, 0x2B, 0xEE, 0xA6, 0x66, 0x73, 0x4A, 0x97, 0x5A, 0xE9, 0x9E, 0x20, 0x37,
-    0x3A, 0xB9, 0x1C, 0x6C, 0x97, 0x4B, 0x34, 0x80, 0xA6, 0x35, 0xE7, 0x59, 0xD9, 0x82, 0x5C, 0xA2,
-    0xD0, 0x7D, 0xBC, 0x2D, 0xAC, 0x22, 0xF4, 0xA6, 0x42, 0x8C, 0xEE, 0xFE, 0xF4, 0xE9, 0xEC, 0x76,
-    0xAB, 0xB2, 0xFA, 0x4F, 0x9F, 0x6B, 0x4C, 0x26, 0xAB, 0x61, 0x25, 0xAB, 0x07, 0x5E, 0x56, 0xA2,
-    0xB2, 0x0A, 0x44, 0x65, 0x85, 0x41, 0x28, 0xAB, 0xF4, 0x89, 0xCA, 0x2A, 0xFB, 0xAD, 0xCA, 0xAA,
-    0xF8, 0x17, 0x15, 0x92, 0xBC, 0x43, 0x14, 0x2C, 0x2A, 0x9D, 0x68, 0x52, 0x59, 0xA5, 0x83, 0xFE,
-    0x97, 0x6D, 0x55, 0x56, 0x45, 0xAB, 0xB2, 0xA2, 0x3F, 0x69, 0xAB, 0x79, 0x51, 0x59, 0x61, 0x14,
-    0x95, 0xD5, 0x40, 0x59, 0x65, 0x7A, 0xD4, 0x7A, 0x46, 0x56, 0xDE, 0x19, 0x46, 0xE6, 0x0C, 0xD3,
-    0x63, 0x95, 0x55, 0xD8, 0x9B, 0xAC, 0xBC, 0xBD, 0x63, 0x04, 0xB8, 0xCB, 0x72, 0x12, 0xCD, 0x78,
-    0xFC, 0x6E, 0x5D, 0xD5, 0x9F, 0x58, 0xC7, 0x13, 0xCD, 0x62, 0x92, 0x51, 0xF5, 0xA2, 0x11, 0xC2,
-    0xC5, 0x40, 0x1A, 0x2C, 0xE9, 0x75, 0xFE, 0x7A, 0x95, 0x23, 0x82, 0x9C, 0x2F, 0x6E, 0x4B, 0xAB,
-    0x59, 0xA9, 0x9E, 0xDB, 0xCF, 0xAA, 0x14, 0x03, 0x0B, 0x21, 0x94, 0x01, 0x7F, 0xA4, 0xA0, 0x3B,
-    0x92, 0xB1, 0x32, 0xA3, 0x1B, 0x9D, 0x56, 0x05, 0x61, 0xFE, 0xDD, 0x67, 0x52, 0xAB, 0x02, 0x86,
-    0x57, 0x86, 0x2F, 0x65, 0x4B, 0x8F, 0x04, 0x9D, 0x1E, 0x9C, 0xBB, 0xEC, 0x58, 0x8F, 0xCC, 0xB6,
-    0xEA, 0xF7, 0xCB, 0x6C, 0x20, 0x5B, 0xBB, 0x98, 0xF9, 0x15, 0xE2, 0xCB, 0x9C, 0x15, 0xE2, 0x5C,
-    0xF2, 0x52, 0xB1, 0x86, 0x42, 0x21, 0xA2, 0xDD, 0x8E, 0xA7, 0x9F, 0x97, 0x4F, 0x6D, 0xA0, 0xBE,
-    0x4A, 0x7C, 0x5D, 0xFF, 0x78, 0x1F, 0x7E, 0xD9, 0xB1, 0x95, 0xEE, 0xF4, 0xD8, 0x49, 0x86, 0x0F,
-    0xBC, 0x4E, 0xDC, 0x2F, 0xCD, 0x62, 0x3E, 0xD1, 0x1C, 0x56, 0x13, 0xAD, 0x21, 0xCB, 0x58, 0x68,
-    0x3C, 0x13, 0x5D, 0xFA, 0xF8, 0x8B, 0x19, 0xFF, 0x76, 0x76, 0x7C, 0xC5, 0x1D, 0x1E, 0xD8, 0x06,
-    0x9E, 0x96, 0x4C, 0x0C, 0x6D, 0xF2, 0x99, 0xA4, 0xA6, 0xBB, 0xDD, 0x1B, 0x3D, 0x18, 0x20, 0x25,
-    0x81, 0xDF, 0x26, 0x58, 0x6D, 0x62, 0x14, 0x2F, 0x0D, 0xD5, 0x2E, 0x34, 0x67, 0xC0, 0xF1, 0xBD,
-    0x92, 0x66, 0x70, 0x54, 0x5B, 0xC8, 0xEC, 0x0C, 0xE6, 0x8D, 0x49, 0x41, 0xD3, 0x1F, 0xC8, 0x80,
-    0x26, 0xCD, 0x08, 0x50, 0x4C, 0xA7, 0xC1, 0xE8, 0xBF, 0x38, 0x40, 0x3B, 0x1A, 0xAA, 0xFD, 0x63,
-    0xBE, 0xAB, 0xE3, 0x7B, 0x4F, 0x0F, 0xB4, 0x07, 0x2E, 0xD8, 0xD0, 0x87, 0xDD, 0x16, 0x39, 0xF2,
-    0x61, 0x3E, 0x37, 0x73, 0x6C, 0x67, 0x89, 0xE7, 0x5D, 0xEA, 0xA2, 0x26, 0xDD, 0xF9, 0x62, 0x68,
-    0x5E, 0x57, 0x34, 0xCD, 0xA5, 0x1E, 0xF4, 0x32, 0x0C, 0x6C, 0x26, 0x47, 0xF7, 0x00, 0xA3, 0x39,
-    0x70, 0xBF, 0xC4, 0xCE, 0x0E, 0xAB, 0x81, 0x8E, 0x81, 0x07, 0x85, 0xAD, 0xC2, 0x41, 0xDB, 0x08,
-    0xDB, 0x8B, 0x96, 0xFF, 0xC0, 0xCA, 0x56, 0xB4, 0xF4, 0x63, 0xA5, 0x05, 0x2D, 0x84, 0xC5, 0x1E,
-    0xFE, 0x40, 0x3F, 0x29, 0xBE, 0xE2, 0xB7, 0x4C, 0x5F, 0x14, 0x76, 0xEC, 0x73, 0xD9, 0xD5, 0x04,
-    0xA8, 0xB1, 0xD5, 0x58, 0x34, 0xB6, 0x79, 0xE9, 0x76, 0x67, 0x2C, 0x1A, 0x8F, 0xED, 0xED, 0xD1,
-    0x41, 0xF3, 0x91, 0x6E, 0xF4, 0xA9, 0x5A, 0x31, 0xE9, 0xA2, 0x77, 0x78, 0x0F, 0xF4, 0x1C, 0x9D,
-    0xAE, 0xD8, 0xBA, 0xB4, 0x91, 0x29, 0x60, 0xDE, 0x4F, 0xDE, 0xA7, 0x5C, 0x8E, 0x1B, 0x2A, 0x0D,
-    0x88, 0x19, 0x8D, 0x2E, 0x05, 0xA0, 0x0A, 0x2E, 0x85, 0xD5, 0x36, 0x6C, 0x22, 0xFF, 0x33, 0x41,
-    0x41, 0x7E, 0x34, 0x21, 0x67, 0x42, 0x2C, 0x60, 0x2A, 0x1A, 0xD0, 0xA6, 0xA8, 0xA5, 0x54, 0x43,
-    0xA9, 0x73, 0xDD, 0x74, 0x3B, 0x2B, 0xB9, 0x37, 0x92, 0x17, 0x4B, 0x55, 0xB8, 0xD1, 0xD0, 0x4D,
-    0xF7, 0xED, 0xD0, 0x7B, 0xF1, 0x84, 0x45, 0x6E, 0x9F, 0x4A, 0x1D, 0x2D, 0xB0, 0x09, 0xB0, 0x6F,
-    0xBB, 0x80, 0xFD, 0x62, 0xA9, 0x0A, 0x4A, 0x0C, 0x9D, 0x8F, 0x11, 0x9C, 0xB6, 0xFC, 0xC3, 0x96,
-    0xE3, 0x76, 0xD1, 0xE3, 0x06, 0x54, 0xF5, 0xF1, 0x82, 0x2F, 0xDD, 0xF7, 0xFE, 0x7F, 0x66, 0x50,
-    0x4D, 0x87, 0x6B, 0x4A, 0x44, 0x2E, 0xD2, 0x06, 0x10, 0x53, 0x0B, 0x57, 0x00, 0xBD, 0xFE, 0x73,
-    0xBC, 0x57, 0xAF, 0x0B, 0xA6, 0xEA, 0xCA, 0xCE, 0xE4, 0x25, 0x6A, 0x97, 0x7E, 0xC9, 0x43, 0xE4,
-    0x7A, 0xF2, 0x40, 0xFF, 0x4D, 0x2C, 0x1A, 0x6C, 0xD7, 0x29, 0xF7, 0xC5, 0x12, 0x79, 0x20, 0x47,
-    0x01, 0x06, 0xC4, 0x30, 0x33, 0x33, 0xEA, 0xD8, 0x36, 0xC6, 0x3A, 0xDB, 0x05, 0xB7, 0x91, 0xB1,
-    0x88, 0x47, 0x84, 0x4B, 0xD5, 0x62, 0xDB, 0xCD, 0x18, 0x5A, 0x77, 0xEE, 0x81, 0x93, 0x85, 0x54,
-    0x2C, 0x9B, 0x07, 0x4B, 0x60, 0xED, 0x25, 0xF1, 0x38, 0x97, 0x47, 0x8D, 0x56, 0xFD, 0xCC, 0xBE,
-    0xF8, 0x72, 0xDC, 0x17, 0x61, 0xEA, 0x7E, 0x30, 0x4D, 0x90, 0x16, 0x33, 0xB2, 0x4A, 0xAE, 0x0E,
-    0xFE, 0xB9, 0xB0, 0xC7, 0x46, 0xD0, 0x38, 0x12, 0x27, 0xB6, 0x99, 0x33, 0x06, 0x30, 0x1E, 0x07,
-    0xB4, 0x71, 0x54, 0x77, 0x1E, 0x9C, 0xB2, 0x88, 0x86, 0xC1, 0x6F, 0x7B, 0x52, 0xF1, 0x99, 0xC8,
-    0xB1, 0x9A, 0xBB, 0x83, 0x75, 0xC5, 0xE7, 0xBE, 0xEC, 0xF3, 0x2C, 0x58, 0x17, 0x7B, 0x3A, 0xC4,
-    0xD8, 0xDD, 0xAD, 0x3A, 0xB1, 0x22, 0x49, 0xEE, 0xE5, 0x34, 0x04, 0xD7, 0x34, 0x43, 0xFA, 0xA4,
-    0xD4, 0xA3, 0xF1, 0x9D, 0x99, 0xE2, 0x91, 0xB8, 0x9E, 0x8F, 0xBF, 0xC1, 0x10, 0x23, 0x35, 0x4F,
-    0xD3, 0xF9, 0x9A, 0xCC, 0x17, 0x35, 0x6C, 0x41, 0x73, 0xE4, 0xCB, 0xA4, 0x76, 0xD4, 0xF7, 0xA9,
-    0x7C, 0xD8, 0x8C, 0xD9, 0x62, 0x87, 0x0B, 0xE9, 0xAC, 0x52, 0x2D, 0x28, 0x52, 0x8A, 0x64, 0x0D,
-    0x4E, 0xB3, 0x40, 0xDF, 0x07, 0x02, 0x20, 0x3A, 0x4E, 0xD9, 0x68, 0x2E, 0xA0, 0xB2, 0x08, 0x1C,
-    0xE2, 0x62, 0x4D, 0xD0, 0x0B, 0x1B, 0xB6, 0x8B, 0xA5, 0xEA, 0x45, 0x0D, 0xDB, 0x05, 0xCB, 0xEA,
-    0x05, 0x4D, 0xC8, 0x85, 0x52, 0x75, 0xFD, 0x1E, 0x53, 0x35, 0x9E, 0x1F, 0x20, 0x8D, 0x41, 0xBE,
-    0xCE, 0xED, 0x60, 0x9D, 0xB5, 0x43, 0xAD, 0x2A, 0x7E, 0xE9, 0xBF, 0xEB, 0x2C, 0x22, 0x83, 0x65,
-    0xB2, 0x22, 0xB2, 0xA2, 0xF3, 0x01, 0x18, 0x46, 0x2C, 0x86, 0x97, 0xFF, 0xB3, 0xF3, 0x0E, 0xCD,
-    0xBE, 0x20, 0x01, 0x69, 0xF3, 0xA1, 0xE8, 0x9B, 0x36, 0x99, 0x0E, 0x77, 0xAA, 0x46, 0x39, 0xB3,
-    0xDD, 0x1F, 0xF3, 0xD2, 0x23, 0xA2, 0x4C, 0x8B, 0xC6, 0xF9, 0xCE, 0xF1, 0xBE, 0x5C, 0x1F, 0xD4,
-    0xFB, 0xF9, 0xFA, 0x36, 0xC6, 0x84, 0x9F, 0x63, 0x09, 0xC9, 0x90, 0x70, 0x61, 0x2D, 0x8C, 0xD2,
-    0x13, 0x3B, 0xEF, 0xD4, 0x38, 0x33, 0xD0, 0x78, 0x27, 0xD1, 0xC8, 0x33, 0x5D, 0x34, 0x16, 0xED,
-    0x18, 0xB2, 0x85, 0x3E, 0x88, 0x4C, 0xF5, 0x70, 0xEE, 0x57, 0xB3, 0x3F, 0xF4, 0xB2, 0x03, 0x30,
-    0x8B, 0xA2, 0x33, 0x56, 0xBC, 0x94, 0xF9, 0x4C, 0xB5, 0x58, 0x07, 0x6F, 0x67, 0x60, 0xAC, 0xA1,
-    0x1D, 0x26, 0x4F, 0x5B, 0x72, 0x2F, 0xB8, 0x98, 0x35, 0xFC, 0x9B, 0xB4, 0xB7, 0x5E, 0x53, 0xF2,
-    0xD6, 0x79, 0x3B, 0x66, 0x93, 0xAB, 0x8E, 0xBB, 0x18, 0xBC, 0xE3, 0x0E, 0x57, 0x8E, 0x3B, 0x51,
-    0xC7, 0xBD, 0x13, 0x57, 0x79, 0xED, 0xB1, 0xAB, 0x7E, 0x41, 0x9B, 0xFF, 0x5F, 0x50, 0x45, 0x5F,
-    0x04, 0x79, 0x2C, 0x33, 0xCB, 0xDB, 0x96, 0x6A, 0x66, 0x9D, 0xE0, 0x44, 0xA6, 0xC7, 0x3D, 0x78,
-    0xB9, 0x92, 0x43, 0xEA, 0xF6, 0x3E, 0x33, 0x8D, 0x2C, 0xE5, 0x6E, 0xAC, 0x8A, 0x54, 0xA5, 0x14,
-    0xCF, 0x67, 0x32, 0xD4, 0xA0, 0xB9, 0x6B, 0xBB, 0xD5, 0xBB, 0x82, 0xD9, 0x48, 0x93, 0x8D, 0x54,
-    0xBE, 0x64, 0x75, 0xAB, 0xD0, 0xFA, 0x9A, 0x38, 0x54, 0x34, 0xA5, 0x17, 0xD3, 0x79, 0xE2, 0x8B,
-    0xBC, 0x70, 0xCB, 0x5C, 0x85, 0x98, 0x2D, 0x26, 0xC4, 0x1A, 0xDC, 0xC5, 0x2A, 0x44, 0x5F, 0x6A,
-    0x5E, 0xA9, 0x10, 0x93, 0x95, 0x10, 0x7D, 0xF6, 0x19, 0x59, 0xB9, 0xAE, 0x26, 0x39, 0x76, 0xDA,
-    0x5B, 0xD8, 0xA9, 0x67, 0x7D, 0x9A, 0xE4, 0xEF, 0x04, 0xCD, 0x81, 0x27, 0x79, 0xD8, 0x17, 0xE1,
-    0xE7, 0x4F, 0x74, 0x87, 0x8B, 0x25, 0xFA, 0x81, 0x68, 0x55, 0xFB, 0x2A, 0x61, 0xFE, 0x6E, 0xD0,
-    0x5C, 0xBA, 0x1B, 0xAC, 0xB5, 0x0F, 0x99, 0x66, 0xC8, 0xAF, 0x7A, 0xA5, 0xA4, 0x77, 0x01, 0xB4,
-    0xB0, 0x75, 0xA1, 0xED, 0xDA, 0xDE, 0xD8, 0xC7, 0x9A, 0xDF, 0x15, 0xDD, 0xD0, 0xEC, 0xB2, 0x2E,
-    0x6A, 0xFD, 0x11, 0x04, 0x37, 0x23, 0x5A, 0xEA, 0x49, 0xD3, 0xB2, 0x78, 0xEE, 0x2A, 0xDE, 0x67,
-    0xF7, 0x1B, 0xBF, 0x03, 0x34, 0xBF, 0xB9, 0x2B, 0x80, 0xD6, 0xC3, 0x80, 0x48, 0xF6, 0x5B, 0x43,
-    0xF3, 0x73, 0x4A, 0xDF, 0x47, 0xFF, 0xD5, 0x4F, 0x76, 0x47, 0xF1, 0x67, 0x3B, 0xF8, 0xF9, 0x8A,
-    0xD1, 0x0F, 0x3B, 0x65, 0x54, 0xB7, 0x20, 0x65, 0xD8, 0x33, 0xFA, 0xC4, 0x18, 0x05, 0x3D, 0xF9,
-    0xC4, 0x14, 0x9D, 0x47, 0x41, 0x2C, 0xA2, 0x4D, 0x9F, 0x30, 0x51, 0xCD, 0x3E, 0x27, 0x2C, 0x3E,
-    0x63, 0xEA, 0x2A, 0xEF, 0x82, 0xC5, 0xC7, 0x0B, 0x05, 0x20, 0x93, 0x42, 0x16, 0xB3, 0x66, 0xB2,
-    0xCD, 0xC8, 0x68, 0xD7, 0x18, 0xA3, 0xB6, 0xE1, 0xD7, 0x3B, 0x8B, 0xE4, 0x92, 0x27, 0xAC, 0xAE,
-    0x0F, 0xB6, 0xAB, 0xC9, 0x39, 0x89, 0xD2, 0x12, 0x8B, 0xD2, 0xDA, 0x73, 0xA3, 0xB4, 0x3F, 0x6E,
-    0x39, 0x75, 0x05, 0xE7, 0xFF, 0x8E, 0x2C, 0xDC, 0xAF, 0x5D, 0x52, 0x96, 0x53, 0x83, 0xD4, 0x7F,
-    0x5F, 0x9C, 0x2C, 0x88, 0x77, 0xAC, 0x12, 0x30, 0x3C, 0x89, 0xD2, 0x96, 0x5D, 0x84, 0x20, 0x4F,
-    0x45, 0x69, 0x17, 0x4C, 0x95, 0x46, 0x69, 0xC9, 0x99, 0x28, 0xED, 0x0E, 0x92, 0x92, 0xC5, 0x55,
-    0xAB, 0x28, 0xED, 0xA2, 0x65, 0xE5, 0xA3, 0x34, 0xCC, 0xDD, 0x1D, 0xD6, 0xAC, 0xDC, 0x39, 0x3F,
-    0x4A, 0xBB, 0x70, 0xAA, 0x9E, 0xE1, 0x16, 0x2A, 0x2B, 0x82, 0x2A, 0x4F, 0xBB, 0x05, 0xFE, 0x04,
-    0xE4, 0xB0, 0x6C, 0x06, 0xDD, 0xC5, 0x5E, 0x2D, 0xDF, 0x8C, 0x4E, 0x9C, 0x3A, 0xB0, 0xFA, 0x65,
-    0x15, 0xD7, 0x34, 0x1B, 0x0C, 0xFA, 0x03, 0x2C, 0x1A, 0xC2, 0x4E, 0x7F, 0x5F, 0xB5, 0xD5, 0xA2,
-    0xDE, 0xDF, 0x9C, 0xFC, 0xCA, 0x2A, 0xF3, 0xBF, 0xB2, 0xD2, 0xBA, 0x5A, 0x5D, 0xE2, 0x91, 0x2F,
-    0x17, 0x1A, 0x75, 0x89, 0xAE, 0x8B, 0x76, 0xB6, 0xBB, 0xBA, 0x59, 0xEF, 0x78, 0x53, 0x52, 0x78,
-    0xB5, 0xD1, 0x02, 0x2C, 0xB1, 0xD4, 0x68, 0x50, 0x48, 0x7E, 0x72, 0x35, 0x05, 0xD7, 0xEF, 0xBA,
-    0x17, 0xAC, 0xFC, 0xBF, 0xF6, 0x10, 0x00, 0xB1, 0x4C, 0xF5, 0x35, 0x83, 0x08, 0x2E, 0xC8, 0x4A,
-    0xBE, 0xA2, 0xD1, 0xD0, 0x5C, 0x14, 0xDD, 0xED, 0x43, 0x07, 0xA1, 0xA8, 0xD7, 0x60, 0xF4, 0x80,
-    0x42, 0xCF, 0x18, 0x6C, 0x14, 0x30, 0xF8, 0x1F, 0x9A, 0xC1, 0x19, 0xAC, 0xAB, 0xAF, 0x75, 0x23,
-    0xAA, 0xE1, 0x1E, 0x56, 0x50, 0xBE, 0xF8, 0x4F, 0x11, 0x7E, 0x4F, 0xE3, 0xFC, 0x2A, 0xCE, 0xD0,
-    0xFF, 0x01, 0xDD, 0x5C, 0xBF, 0x93, 0xDC, 0xD8, 0x71, 0x7E, 0x98, 0xD1, 0xEE, 0x54, 0x11, 0xE5,
-    0x82, 0x02, 0xAE, 0xCB, 0x47, 0x06, 0xC8, 0xA9, 0x72, 0xE1, 0x2F, 0x70, 0x01, 0x92, 0x03, 0x05,
-    0x4A, 0x36, 0xD8, 0x39, 0x55, 0xD9, 0xC1, 0x39, 0x50, 0x62, 0x2A, 0xB8, 0xBF, 0xC0, 0x02, 0x4A,
-    0x0A, 0x1C, 0x5C, 0x42, 0x3B, 0x75, 0xE0, 0x0D, 0x18, 0x90, 0x73, 0x01, 0x53, 0x27, 0x67, 0xE0,
-    0xC4, 0x40, 0x81, 0x02, 0x8F, 0xC4, 0x72, 0x29, 0x50, 0x70, 0xB8, 0x3A, 0xDD, 0x49, 0x26, 0x5D,
-    0x26, 0x7C, 0x87, 0x33, 0x67, 0x77, 0x01, 0x3C, 0xF7, 0xF7, 0xF5, 0x03, 0x06, 0xB3, 0xBB, 0xE4,
-    0x2D, 0x7F, 0x0D, 0xB9, 0x37, 0x24, 0xBA, 0x67, 0x67, 0x30, 0x0F, 0xEF, 0x75, 0x37, 0xDE, 0xEB,
-    0xFE, 0xBA, 0x1F, 0x8C, 0x37, 0x9F, 0x1F, 0x18, 0x63, 0x66, 0xD6, 0x36, 0x67, 0x98, 0xFB, 0xAE,
-    0x7F, 0x45, 0x36, 0x03, 0x8B, 0x6D, 0x01, 0x96, 0xDA, 0x25, 0x98, 0xB5, 0xA5, 0xB2, 0x0A, 0x3F,
-    0xB0, 0xF7, 0x6A, 0x61, 0x53, 0xFB, 0xDE, 0x8A, 0x2C, 0x40, 0x2B, 0xBE, 0x0D, 0x5A, 0x61, 0x41,
-    0xE7, 0x5B, 0xB0, 0x76, 0x06, 0x16, 0x35, 0x53, 0x9B, 0x48, 0x5B, 0xAB, 0x09, 0x5A, 0x4B, 0x6B,
-    0x0F, 0x2C, 0xAF, 0x0C, 0x5A, 0x93, 0xA6, 0xE4, 0xBF, 0x67, 0xE5, 0x55, 0x9B, 0x09, 0xD8, 0x4A,
-    0xDA, 0xB2, 0xE8, 0xD3, 0x0C, 0xAC, 0x95, 0x26, 0x1F, 0x2E, 0xF2, 0xCE, 0x04, 0xD2, 0x92, 0x1C,
-    0x61, 0x87, 0x8B, 0x24, 0x71, 0x8B, 0x8E, 0x67, 0x71, 0x83, 0x2B, 0x17, 0xA9, 0xF4, 0x60, 0x62,
-    0x97, 0xD2, 0x82, 0xB4, 0x54, 0x99, 0xF9, 0x7C, 0x8E, 0x4E, 0xCA, 0x35, 0xD7, 0x84, 0x9F, 0xF1,
-    0xB5, 0x9B, 0xDF, 0xE6, 0xF5, 0x12, 0x5C, 0x66, 0x89, 0x4B, 0x56, 0x5E, 0xF7, 0xAE, 0xFC, 0xF6,
-    0x96, 0x41, 0x3B, 0x06, 0x6D, 0x82, 0xEC, 0x2C, 0x6C, 0xE3, 0xE5, 0xD2, 0x11, 0x1F, 0xBD, 0x89,
-    0xEC, 0x71, 0xDE, 0xC8, 0x55, 0xE3, 0x46, 0x4E, 0x12, 0x52, 0x2B, 0x49, 0x9B, 0xB4, 0xF1, 0x6C,
-    0x13, 0xEB, 0x29, 0xF6, 0x71, 0x13, 0x58, 0xFB, 0xA3, 0x66, 0x62, 0xDB, 0x59, 0x63, 0xF6, 0x12,
-    0x08, 0x64, 0x69, 0x22, 0xE1, 0x7E, 0x65, 0xD2, 0x04, 0x5D, 0xFE, 0x10, 0x02, 0x99, 0x60, 0x5C,
-    0x14, 0x24, 0x24, 0x68, 0x42, 0x95, 0xB5, 0xF9, 0xAE, 0xF9, 0x76, 0x28, 0xC0, 0x5B, 0x99, 0x59,
-    0xE9, 0x35, 0x26, 0x28, 0x8D, 0x7D, 0x28, 0x97, 0x4A, 0xAD, 0x8C, 0x25, 0xB2, 0x1D, 0x7E, 0x81,
-    0x1E, 0x7F, 0xC7, 0xBC, 0x11, 0x55, 0x5C, 0x6A, 0x9B, 0xC6, 0x2B, 0x27, 0x9D, 0x34, 0x64, 0x53,
-    0x9A, 0x0E, 0x0C, 0x0B, 0xAF, 0xC0, 0xB1, 0x8E, 0x83, 0xF1, 0x75, 0x4C, 0x13, 0x65, 0xE6, 0x66,
-    0xB6, 0x4D, 0x49, 0x07, 0xB8, 0x68, 0x9C, 0xF5, 0xFD, 0xED, 0x28, 0x5D, 0x92, 0xFF, 0x06, 0x81,
-    0x28, 0x31, 0x52, 0xB3, 0x7B, 0x5B, 0xC8, 0x8D, 0xBB, 0x1C, 0xD8, 0x8A, 0xB2, 0x2F, 0x29, 0x73,
-    0xA8, 0x8A, 0x72, 0x37, 0x31, 0xBB, 0xBF, 0x37, 0xBA, 0x29, 0x72, 0xFB, 0x07, 0x8C, 0x0E, 0xF6,
-    0x94, 0x82, 0x52, 0xC6, 0x90, 0xED, 0x87, 0x10, 0x66, 0x69, 0xFE, 0x52, 0xEE, 0x25, 0xFC, 0x3E,
-    0xE6, 0x55, 0x39, 0x28, 0x1D, 0x9F, 0xC9, 0x29, 0x2E, 0x15, 0xE4, 0xB3, 0xA9, 0x9E, 0x99, 0x6A,
-    0x0F, 0x5A, 0xB5, 0x1B, 0xBD, 0x4B, 0x97, 0x66, 0x57, 0x2E, 0x2E, 0x62, 0x53, 0x6D, 0x72, 0x8E,
-    0xB1, 0xF8, 0x1A, 0x74, 0x02, 0x2D, 0x1B, 0xB3, 0xC3, 0x49, 0x74, 0xB2, 0xB8, 0x85, 0x7E, 0x8A,
-    0x10, 0x42, 0xB4, 0x90, 0xA2, 0x49, 0x18, 0xC8, 0x14, 0xFD, 0xF2, 0xF6, 0xFB, 0xE1, 0x78, 0xF9,
-    0x1F, 0xF8, 0xF3, 0x02, 0x2D, 0x15, 0x68, 0x34, 0xF3, 0xED, 0xB1, 0xC5, 0x20, 0x76, 0x4D, 0xD4,
-    0x8D, 0xF4, 0x02, 0x4B, 0x3B, 0x87, 0x0C, 0xDF, 0xA2, 0x8B, 0x49, 0x60, 0x97, 0xEF, 0x65, 0x94,
-    0x0E, 0x9B, 0x12, 0x69, 0x09, 0xB9, 0x4E, 0x89, 0xF3, 0x06, 0xB8, 0x71, 0x87, 0xA3, 0xEC, 0x74,
-    0x06, 0xC2, 0x74, 0xD4, 0xE1, 0x1E, 0x08, 0xEB, 0x48, 0xFA, 0x97, 0x2E, 0x45, 0x7B, 0x10, 0xF6,
-    0xC1, 0x65, 0x93, 0xF6, 0x64, 0x91, 0x19, 0xF6, 0x47, 0xBE, 0x93, 0xD6, 0xF2, 0xC7, 0xAD, 0xD8,
-    0xD2, 0x0F, 0xAC, 0x99, 0xB5, 0x26, 0x2F, 0x44, 0xD8, 0x3B, 0xC9, 0x1B, 0x91, 0xF6, 0xAE, 0xCE,
-    0x39, 0xAB, 0xB5, 0x6C, 0x1C, 0xE5, 0x27, 0x7E, 0x69, 0x4E, 0xBD, 0x2E, 0x8B, 0x6D, 0xFF, 0x84,
-    0xE6, 0x93, 0x70, 0x92, 0x1A, 0x08, 0x6E, 0xF7, 0x7F, 0xDF, 0x18, 0xCE, 0x76, 0xA5, 0x7D, 0x33,
-    0x31, 0x0B, 0x39, 0xBD, 0x9A, 0x75, 0x98, 0xA1, 0x21, 0xF4, 0x29, 0x27, 0x76, 0xCF, 0x72, 0xB2,
-    0x4F, 0x39, 0xCA, 0xBD, 0x83, 0xCB, 0x26, 0x6D, 0x99, 0x23, 0xAF, 0x1C, 0x4E, 0xAD, 0x49, 0x65,
-    0x25, 0xFD, 0xAD, 0x74, 0x35, 0xC6, 0xCD, 0x1B, 0xC2, 0x5F, 0x9B, 0xE1, 0x12, 0xDE, 0x3C, 0x79,
-    0x13, 0xD2, 0x9E, 0xDC, 0x35, 0x13, 0x99, 0x4A, 0x6C, 0x86, 0x79, 0x23, 0xAE, 0x38, 0x87, 0xE0,
-    0x04, 0xE9, 0x94, 0xCE, 0x2D, 0x1C, 0xF1, 0x7C, 0x7F, 0x2D, 0xEB, 0xE3, 0x7D, 0x0E, 0xB1, 0xD3,
-    0x81, 0x96, 0x46, 0x17, 0x43, 0xCB, 0x8F, 0x64, 0x20, 0xB9, 0x4D, 0x84, 0x06, 0xB6, 0x10, 0x3A,
-    0x95, 0x35, 0xAF, 0x92, 0x36, 0x2A, 0x0C, 0x70, 0x4C, 0xF3, 0xFA, 0x59, 0x74, 0x74, 0xA6, 0x2C,
-    0x7B, 0x43, 0x3B, 0xDA, 0x26, 0xDA, 0x3F, 0xCE, 0x71, 0x2D, 0xAE, 0xC5, 0xA0, 0xCB, 0x75, 0x7F,
-    0x6E, 0xA9, 0x2F, 0x72, 0x77, 0x72, 0x97, 0x4B, 0x27, 0x4C, 0x48, 0x98, 0xAF, 0x4B, 0xBF, 0xBF,
-    0x52, 0x0F, 0xA0, 0x52, 0x56, 0x92, 0x5D, 0xC9, 0xC8, 0x40, 0x8E, 0xC8, 0x72, 0xFB, 0x6B, 0x55,
-    0xDC, 0x89, 0x55, 0xAB, 0xE2, 0xC2, 0x7E, 0x02, 0x26, 0x1A, 0x88, 0x2D, 0xF5, 0x8F, 0xD5, 0x5E,
-    0x44, 0x4C, 0xB6, 0xE2, 0xCF, 0x85, 0xCD, 0x9E, 0xCA, 0x1A, 0x3D, 0x45, 0x7F, 0x20, 0x2A, 0x0C,
-    0xD9, 0xD8, 0x3F, 0xE5, 0x6C, 0x9A, 0x57, 0x98, 0xE9, 0xF5, 0xC4, 0x74, 0x1F, 0x58, 0xFA, 0x35,
-    0x13, 0x3B, 0x2C, 0x2F, 0xD2, 0x97, 0xFF, 0x4A, 0xC8, 0xEC, 0x4A, 0x99, 0x28, 0x88, 0xAC, 0xEA,
-    0x5D, 0x12, 0xF1, 0x5C, 0x64, 0xCD, 0x06, 0x93, 0x9F, 0x92, 0x05, 0x36, 0x01, 0xF3, 0xF1, 0x45,
-    0x81, 0x5B, 0xDB, 0xB1, 0xEF, 0xD9, 0x87, 0x87, 0xE2, 0x8B, 0xC8, 0x82, 0x5F, 0x3D, 0x8D, 0x6D,
-    0xFE, 0x40, 0x5B, 0xC9, 0x46, 0x6D, 0xEA, 0x15, 0xF4, 0x7A, 0x0F, 0xF5, 0xEA, 0xB4, 0x04, 0xB2,
-    0x64, 0xD4, 0xCF, 0x2E, 0x71, 0xEA, 0x30, 0xBD, 0x8C, 0x95, 0xDE, 0xB8, 0x67, 0x6F, 0xE3, 0x46,
-    0x86, 0x71, 0x8D, 0x29, 0xC5, 0xA3, 0xE7, 0xEC, 0xDE, 0x01, 0xCD, 0xED, 0x07, 0xD6, 0xA9, 0x42,
-    0x35, 0xA1, 0xD2, 0x12, 0xE7, 0x4F, 0x66, 0x81, 0x18, 0x7F, 0x3A, 0x65, 0xA8, 0x84, 0x63, 0x38,
-    0x65, 0xE7, 0xD1, 0x96, 0xDF, 0xF2, 0x7C, 0xB9, 0x61, 0xD3, 0xBE, 0x1D, 0x7A, 0x70, 0x90, 0xF9,
-    0xAF, 0xE4, 0x5A, 0x69, 0x37, 0xB5, 0x4E, 0xE2, 0x3B, 0xF3, 0xF9, 0xBE, 0x9C, 0x51, 0xF7, 0x07,
-    0xFE, 0x56, 0x37, 0xD3, 0x76, 0x72, 0xFB, 0xD8, 0xD1, 0xD1, 0xE5, 0x15, 0x7D, 0xC5, 0xCD, 0x03,
-    0x4B, 0x97, 0x8C, 0x68, 0xE3, 0xF8, 0x7A, 0x7E, 0x70, 0xEE, 0xB9, 0x38, 0x8E, 0x17, 0x8B, 0x53,
-    0xED, 0xDA, 0x6F, 0x88, 0x7C, 0xBC, 0xFC, 0x96, 0x51, 0x3F, 0xBC, 0x9F, 0x24, 0xAA, 0x40, 0x0C,
-    0x6A, 0x25, 0xFE, 0x67, 0xD8, 0x44, 0x62, 0x68, 0x2D, 0x44, 0xD2, 0xC5, 0xDD, 0xE2, 0x5E, 0x07,
-    0xE7, 0x6E, 0x4C, 0x36, 0x67, 0x0A, 0x78, 0xAC, 0x22, 0x8F, 0xCC, 0xFB, 0x37, 0x88, 0x63, 0xA5,
-    0xDA, 0x4B, 0xE1, 0xEE, 0xFA, 0xBC, 0x9F, 0xF6, 0xF6, 0x4D, 0x94, 0x99, 0x9F, 0x85, 0x85, 0xE9,
-    0x82, 0xEE, 0x1E, 0x9C, 0x49, 0x9C, 0x53, 0xCA, 0x29, 0xA2, 0x5D, 0x55, 0xF0, 0x36, 0xE5, 0x72,
-    0xE1, 0x80, 0x64, 0xAB, 0x12, 0x32, 0x9E, 0xF0, 0x50, 0x4E, 0x8E, 0x5A, 0x77, 0xC8, 0x7B, 0xBF,
-    0x1E, 0x96, 0xA8, 0xAD, 0x5A, 0x8E, 0x79, 0x87, 0x2E, 0x38, 0x17, 0xF3, 0xA5, 0x23, 0x0C, 0x6D,
-    0x4C, 0x9E, 0x6C, 0x2E, 0xEB, 0x5B, 0x94, 0xD0, 0x76, 0x25, 0x30, 0x93, 0x56, 0xC2, 0xA5, 0xC6,
-    0x2E, 0x08, 0xD6, 0x31, 0xF0, 0xFC, 0x91, 0x3A, 0x0F, 0x58, 0x15, 0x65, 0x7D, 0x78, 0xC6, 0xE8,
-    0xA3, 0x57, 0x38, 0x7A, 0x59, 0x65, 0xF6, 0xD2, 0xCC, 0x05, 0x4F, 0x8C, 0xF7, 0xA6, 0xF8, 0xE1,
-    0x8C, 0xA4, 0xFD, 0x3B, 0xA8, 0xA7, 0xEA, 0xC3, 0xC2, 0xB4, 0x94, 0xF0, 0x6E, 0x91, 0x44, 0x95,
-    0xC4, 0x16, 0x7E, 0x2B, 0xE6, 0x34, 0xB5, 0x18, 0x22, 0xFD, 0x1E, 0xDE, 0x6E, 0x3B, 0x07, 0x23,
-    0x7B, 0x32, 0x1C, 0xEA, 0x06, 0xE9, 0x28, 0x92, 0xF3, 0x49, 0x6D, 0x54, 0xB0, 0x67, 0x88, 0x08,
-    0xF7, 0x19, 0x3F, 0x23, 0x11, 0x19, 0x9F, 0x73, 0x35, 0x0B, 0xD7, 0x61, 0xF7, 0xB6, 0x38, 0x90,
-    0xB1, 0xAC, 0xCB, 0x9F, 0x4A, 0x2F, 0x23, 0x5D, 0x2C, 0x19, 0xF5, 0xD6, 0x63, 0xBF, 0x61, 0xBB,
-    0x37, 0xA3, 0xB9, 0xB2, 0x50, 0x70, 0x80, 0x91, 0xAB, 0x9A, 0x3F, 0x06, 0x32, 0x6B, 0xE1, 0x09,
-    0x84, 0x35, 0xD6, 0x56, 0x89, 0x24, 0xD6, 0xD1, 0xE8, 0xFB, 0xF6, 0x88, 0x4B, 0xB0, 0x68, 0x2B,
-    0x1E, 0x9C, 0x9A, 0xA5, 0x74, 0x73, 0x61, 0x0B, 0x5F, 0x9A, 0xDE, 0x4D, 0x14, 0xD7, 0x51, 0x9F,
-    0xCF, 0x79, 0x90, 0xCD, 0xDA, 0x2F, 0xCC, 0x9D, 0xA7, 0x28, 0x4B, 0x49, 0x75, 0x96, 0xE6, 0xB5,
-    0xB7, 0x10, 0x2A, 0x43, 0x48, 0x2B, 0xFC, 0x2A, 0xAD, 0xE0, 0x41, 0xA6, 0x15, 0x5A, 0x4B, 0x45,
-    0x0E, 0x32, 0x89, 0x55, 0xBE, 0x3D, 0x7A, 0xD7, 0x56, 0x53, 0x5D, 0xD4, 0x95, 0x46, 0xFD, 0x02,
-    0x8F, 0x65, 0x74, 0x07, 0x13, 0xBF, 0x87, 0x50, 0x94, 0x92, 0xA5, 0x8C, 0x63, 0x78, 0x0C, 0x79,
-    0x81, 0xA5, 0xD8, 0x44, 0x95, 0x77, 0x30, 0x44, 0xA3, 0xFE, 0x91, 0x37, 0x97, 0x71, 0xDF, 0x17,
-    0x27, 0xC2, 0x3E, 0xB1, 0x5C, 0xE5, 0x02, 0xAC, 0xD4, 0x21, 0x16, 0x41, 0x2E, 0x98, 0x5C, 0x2F,
-    0xE9, 0x9D, 0x9C, 0x4B, 0x1A, 0x25, 0xBE, 0x8D, 0xE0, 0x41, 0x87, 0x58, 0x6E, 0xB9, 0x62, 0xB2,
-    0x7F, 0x32, 0xA4, 0xDF, 0x63, 0x0D, 0x96, 0x25, 0xD5, 0xDB, 0x57, 0x1C, 0x85, 0xA4, 0xFB, 0x33,
-    0xB8, 0x46, 0xC1, 0xF1, 0xDF, 0x58, 0x80, 0x08, 0x76, 0x05, 0x52, 0x82, 0x24, 0xDE, 0x3D, 0x78,
-    0xE8, 0x01, 0xE1, 0x33, 0xA0, 0x67, 0x88, 0x56, 0x01, 0x9E, 0x4D, 0x15, 0x3B, 0x53, 0xE8, 0xCC,
-    0x21, 0x3A, 0xFB, 0xE6, 0xB2, 0x69, 0x45, 0x6E, 0xD3, 0xCA, 0xB4, 0x80, 0x6D, 0xF2, 0x87, 0x62,
-    0x6B, 0x31, 0x6E, 0xD7, 0x50, 0x9D, 0x7F, 0x74, 0x63, 0xA7, 0x1F, 0xCE, 0xDB, 0xA9, 0x15, 0xE3,
-    0xFD, 0x84, 0x9D, 0x63, 0x6C, 0xA4, 0xFE, 0xD7, 0x98, 0x4E, 0x56, 0xA7, 0x63, 0xDB, 0x4B, 0xA2,
-    0x15, 0x2E, 0x82, 0x04, 0x6A, 0x08, 0x46, 0x4D, 0x34, 0x82, 0x04, 0x4C, 0x98, 0x6E, 0x2C, 0x82,
-    0x6F, 0xA9, 0x56, 0x2E, 0x97, 0xAC, 0x1D, 0x04, 0xCC, 0x59, 0x97, 0x31, 0x97, 0x61, 0xC8, 0x65,
-    0x82, 0xD5, 0x1A, 0xD0, 0x0C, 0x09, 0xD1, 0x2A, 0x80, 0xB3, 0x7B, 0xD8, 0x7F, 0x1C, 0x11, 0x61,
-    0xC4, 0x57, 0x79, 0xE1, 0xF4, 0x65, 0x86, 0x48, 0x78, 0x1B, 0xBA, 0x89, 0xCF, 0xE8, 0xC6, 0x42,
-    0x37, 0xDD, 0x33, 0x74, 0xB3, 0x38, 0x1C, 0x22, 0x63, 0x8D, 0x92, 0x83, 0x0E, 0x5A, 0x88, 0xCB,
-    0x14, 0x80, 0x71, 0x16, 0xD6, 0x00, 0xDE, 0x06, 0x64, 0x30, 0xAD, 0x70, 0x40, 0x13, 0x69, 0xFD,
-    0xDC, 0xF4, 0xEB, 0xF9, 0x3C, 0xAF, 0x73, 0xA2, 0xCF, 0xE7, 0x50, 0xFD, 0xF6, 0xC5, 0x5A, 0x1E,
-    0x51, 0x73, 0x53, 0xC1, 0xC4, 0x96, 0x98, 0x2D, 0x43, 0xE1, 0x0E, 0x8A, 0x88, 0xEA, 0x18, 0x0E,
-    0x56, 0xE1, 0x9F, 0x06, 0x13, 0x6F, 0x1C, 0x9A, 0x1E, 0x09, 0xBD, 0x20, 0xBD, 0x7E, 0x04, 0x8A,
-    0x99, 0x31, 0x7D, 0x02, 0xEB, 0x49, 0x09, 0x1A, 0xA4, 0xF6, 0x58, 0x2E, 0x8A, 0x50, 0xAE, 0x33,
-    0x69, 0x8B, 0xA5, 0x5D, 0xCC, 0x30, 0xE8, 0x00, 0xCE, 0xAC, 0x69, 0xFD, 0x92, 0x14, 0x8E, 0x30,
-    0x6E, 0xFC, 0xC9, 0x19, 0xAE, 0x87, 0xD5, 0x57, 0x76, 0x9A, 0xFF, 0xD8, 0xFE, 0xE7, 0xFC, 0x5D,
-    0xFB, 0x79, 0x72, 0xF6, 0x77, 0xF8, 0x7C, 0xA9, 0xD1, 0xEE, 0x33, 0xF9, 0xE7, 0xEE, 0xBC, 0xA7,
-    0x5D, 0xFF, 0x25, 0xF9, 0x22, 0x31, 0x3D, 0x5C, 0xA7, 0xF4, 0xA7, 0x12, 0xDA, 0xD3, 0xC1, 0xAA,
-    0x37, 0x69, 0x7F, 0x8E, 0x9E, 0x9F, 0xDC, 0xBC, 0x25, 0xF4, 0x47, 0x16, 0xDE, 0x65, 0x6A, 0x1D,
-    0x6A, 0x45, 0x97, 0x0C, 0x33, 0x4B, 0x3D, 0xB5, 0x25, 0x02, 0x06, 0xDC, 0xF3, 0xC5, 0x88, 0x66,
-    0x2F, 0x49, 0xCD, 0x55, 0xB3, 0x27, 0xD7, 0x8E, 0x03, 0x7B, 0xD4, 0xC9, 0x04, 0xD2, 0xC4, 0xFF,
-    0x62, 0x57, 0xB1, 0xC9, 0x97, 0x57, 0x9D, 0x49, 0x21, 0x8D, 0x36, 0x75, 0xC7, 0x04, 0xB6, 0x11,
-    0x49, 0x27, 0x7C, 0x6B, 0x5E, 0xFA, 0x08, 0x89, 0x07, 0xAE, 0xA6, 0xA3, 0xF6, 0xC5, 0xC7, 0xB8,
-    0x2A, 0xB3, 0xD4, 0x47, 0x91, 0xFD, 0x02, 0x89, 0x8F, 0x55, 0xFA, 0x9E, 0xAD, 0x3E, 0x12, 0x33,
-    0xB9, 0xDA, 0x07, 0x8F, 0xF0, 0x21, 0xE3, 0xFA, 0x95, 0x1E, 0x88, 0xDC, 0x9D, 0x75, 0xF1, 0xE8,
-    0x23, 0x79, 0xB9, 0x93, 0x13, 0xEB, 0x0E, 0x79, 0x6F, 0x7C, 0xA6, 0x99, 0x8A, 0x97, 0x3E, 0x66,
-    0x8C, 0xD0, 0x89, 0x92, 0x0D, 0xED, 0xEF, 0xCD, 0xE7, 0xB8, 0x46, 0xD1, 0x1F, 0x7B, 0x3D, 0x9A,
-    0x80, 0x09, 0x17, 0x4B, 0xE3, 0x2B, 0x3C, 0x7E, 0x66, 0xBC, 0x55, 0x2A, 0xA1, 0x4E, 0x7C, 0x9C,
-    0xCB, 0x7A, 0x62, 0x4B, 0x9F, 0xB8, 0xAC, 0xCC, 0x30, 0x5E, 0x9F, 0x12, 0x25, 0xDC, 0xC4, 0x03,
-    0x58, 0x27, 0xD0, 0x24, 0xF3, 0xD4, 0x18, 0xEF, 0xE2, 0x87, 0x27, 0xD1, 0x00, 0x00, 0xCC, 0x78,
-    0xD4, 0x7E, 0x2C, 0x3E, 0x5A, 0x9C, 0x4D, 0x9A, 0xE8, 0x38, 0xC7, 0x64, 0x5E, 0xCD, 0x30, 0x0F,
-    0xE5, 0x32, 0x71, 0x7B, 0xC9, 0x6B, 0xD3, 0xF7, 0x36, 0xF5, 0xCA, 0x88, 0x12, 0x70, 0x66, 0x54,
-    0x68, 0xC4, 0x1B, 0x83, 0x9F, 0x20, 0x00, 0xD2, 0x35, 0xCD, 0x93, 0x68, 0xF7, 0x56, 0xD0, 0x84,
-    0x5D, 0xD8, 0x05, 0x2D, 0x23, 0x4F, 0x89, 0x24, 0x83, 0xF6, 0x62, 0xFF, 0xA6, 0x75, 0xB0, 0x8C,
-    0x8B, 0x34, 0x49, 0xB3, 0xF4, 0x51, 0x2C, 0x6B, 0xA8, 0x34, 0xF6, 0x8E, 0xC2, 0x0B, 0xFD, 0x0C,
-    0xAA, 0xF9, 0xD2, 0x64, 0x84, 0xC7, 0x6F, 0xD1, 0xA6, 0xF7, 0xE3, 0xFA, 0x62, 0xFF, 0xD0, 0xAB,
-    0xB0, 0xC1, 0x6F, 0x22, 0x47, 0xD1, 0xB7, 0xA8, 0x41, 0xEF, 0xA2, 0x06, 0xED, 0xBF, 0x7E, 0x8A,
-    0x11, 0x44, 0x0D, 0xC6, 0x10, 0x6D, 0xF4, 0x44, 0xE9, 0xE9, 0xEC, 0x92, 0xD5, 0xD4, 0x47, 0xD5,
-    0x27, 0x40, 0xA6, 0x56, 0x31, 0x9D, 0xCE, 0x05, 0xD4, 0xBB, 0x89, 0xF9, 0x73, 0x86, 0xDE, 0xA5,
-    0x2C, 0x95, 0xB6, 0x22, 0x11, 0xD3, 0xB3, 0x55, 0x58, 0x02, 0xB2, 0x1B, 0x5E, 0x62, 0xDE, 0xF3,
-    0x7D, 0x7E, 0xF1, 0x9A, 0x49, 0x9F, 0x2D, 0x19, 0x08, 0x5C, 0x6F, 0xEF, 0x43, 0x85, 0x86, 0xA1,
-    0x43, 0xE2, 0xD6, 0xB8, 0xF1, 0xE0, 0x47, 0x31, 0x48, 0x67, 0xD4, 0x97, 0xE2, 0x34, 0xA4, 0xEB,
-    0x67, 0x9D, 0x2F, 0x5E, 0x5D, 0xED, 0xD9, 0x64, 0x14, 0x9E, 0x33, 0x47, 0xEF, 0xBF, 0x71, 0xE2,
-    0x1C, 0x77, 0x97, 0xFF, 0x21, 0x5E, 0x4D, 0x9C, 0x9B, 0x0A, 0x62, 0xCA, 0xE4, 0x7D, 0x3A, 0xEE,
-    0x37, 0x6F, 0xD3, 0x95, 0x82, 0x23, 0x25, 0x7E, 0x61, 0x11, 0x55, 0x71, 0x05, 0x17, 0x6A, 0xDE,
-    0x3B, 0x50, 0x98, 0x6C, 0xE0, 0x16, 0xBD, 0xAE, 0x43, 0x3C, 0xFF, 0x47, 0xF4, 0xD5, 0x2B, 0xA3,
-    0x39, 0xA4, 0xC4, 0xA8, 0x8B, 0x8F, 0x7B, 0x55, 0x66, 0xC8, 0x99, 0x4C, 0xFE, 0x15, 0x32, 0x10,
-    0x42, 0x65, 0x24, 0xA8, 0x73, 0x90, 0xE9, 0xAA, 0x42, 0x80, 0x94, 0xCB, 0xD4, 0x28, 0x33, 0x63,
-    0x85, 0xF4, 0x44, 0xCE, 0x60, 0x20, 0xAF, 0x30, 0xC4, 0xFC, 0x4B, 0x98, 0x5F, 0xFE, 0x84, 0xF7,
-    0xB9, 0x75, 0x74, 0x49, 0x5A, 0x91, 0xE2, 0x9C, 0x56, 0xCF, 0xD7, 0xDF, 0x06, 0x48, 0x34, 0xD1,
-    0x79, 0x40, 0xCB, 0xD5, 0x70, 0x15, 0x38, 0x78, 0x42, 0x23, 0x02, 0x55, 0x81, 0x4C, 0x0F, 0x7D,
-    0x7F, 0xA6, 0xF6, 0x54, 0x12, 0x75, 0x91, 0xF5, 0xF1, 0x9B, 0x98, 0x46, 0x42, 0x0F, 0x81, 0xA5,
-    0x12, 0xCC, 0xBD, 0x11, 0x42, 0x53, 0x17, 0xFB, 0xC6, 0xED, 0x75, 0x22, 0xF6, 0x82, 0x74, 0x67,
-    0x9E, 0xC4, 0x58, 0x25, 0xF0, 0x5E, 0xFA, 0x13, 0xAF, 0x80, 0xBE, 0xC5, 0x2B, 0xF4, 0x36, 0x5E,
-    0x31, 0xA5, 0x53, 0x63, 0x2C, 0x71, 0x0D, 0xE7, 0x29, 0xFE, 0x3F, 0x8C, 0x34, 0x3E, 0x41, 0x4F,
-    0x62, 0x8E, 0x3A, 0xE6, 0xA8, 0x63, 0x5A, 0x40, 0x8C, 0xC8, 0x82, 0xBF, 0x4A, 0x86, 0x16, 0xB4,
-    0x35, 0x08, 0x5D, 0x28, 0x2A, 0x2E, 0xFA, 0x6B, 0xF9, 0x5A, 0xAC, 0xB2, 0xC6, 0x5F, 0x39, 0x46,
-    0x8F, 0xDE, 0x99, 0x1B, 0x1D, 0x63, 0xA7, 0x29, 0xEF, 0xFE, 0x59, 0x3D, 0x8C, 0x51, 0x4C, 0xC6,
-    0x63, 0x9F, 0x03, 0xB6, 0x13, 0x37, 0x6C, 0xBF, 0x62, 0xC5, 0xCA, 0x52, 0xE8, 0x8C, 0x57, 0x07,
-    0x32, 0x26, 0x3D, 0x5F, 0xB1, 0xE7, 0xE8, 0xE1, 0x13, 0xD7, 0xE7, 0x62, 0xD4, 0x67, 0x7C, 0x6B,
-    0xEF, 0x61, 0x74, 0xCD, 0x37, 0xF4, 0x59, 0xAF, 0x05, 0x83, 0x60, 0x61, 0x07, 0x6C, 0xC8, 0xD3,
-    0x59, 0x28, 0x71, 0x45, 0x1D, 0xAC, 0xE9, 0x58, 0x83, 0x68, 0xD1, 0x66, 0xF2, 0xF1, 0x75, 0x93,
-    0x6E, 0xB1, 0x38, 0x44, 0x50, 0x5C, 0x9D, 0x22, 0x88, 0x66, 0x6C, 0x3D, 0x41, 0x80, 0x6C, 0xC2,
-    0x15, 0x62, 0xCB, 0xBD, 0x3E, 0x68, 0x41, 0xBD, 0xCB, 0xAB, 0xFE, 0x9F, 0x97, 0x67, 0x66, 0xBD,
-    0xD7, 0x49, 0x8E, 0x17, 0x0B, 0x46, 0x28, 0xC5, 0x29, 0x32, 0x32, 0x2B, 0xA6, 0xDB, 0xFC, 0xB6,
-    0x2F, 0xBD, 0x09, 0x60, 0x47, 0x21, 0x63, 0xED, 0xC2, 0xC1, 0x51, 0x37, 0x0E, 0xD3, 0xFA, 0xC5,
-    0xFE, 0xA1, 0xFD, 0x6B, 0x77, 0x10, 0x18, 0xC6, 0x25, 0x9C, 0x82, 0xAB, 0x18, 0x7F, 0x8A, 0x1C,
-    0x6D, 0x8E, 0x14, 0x2D, 0x33, 0xB4, 0x4C, 0x00, 0x5B, 0xA0, 0x0E, 0xCD, 0xF6, 0xC6, 0x7F, 0xE3,
-    0xF0, 0x9A, 0x0C, 0x2A, 0xAE, 0xE4, 0x28, 0xA5, 0xA3, 0x85, 0xC4, 0xB6, 0x99, 0x1C, 0xA2, 0xA1,
-    0xBF, 0x7F, 0x7D, 0x33, 0xED, 0xF3, 0xA9, 0xDE, 0xBB, 0x25, 0x24, 0x68, 0x41, 0xEC, 0x40, 0x90,
-    0x33, 0x9F, 0xAE, 0x5E, 0x72, 0xE8, 0xCF, 0xDB, 0xF5, 0x77, 0x10, 0x8B, 0x17, 0xA9, 0xCC, 0x6C,
-    0x72, 0x94, 0xE9, 0xD7, 0xC2, 0x6B, 0x71, 0xF0, 0x9E, 0xA3, 0x0D, 0xBA, 0x7C, 0x93, 0x8B, 0x90,
-    0x5F, 0x82, 0x3C, 0xCE, 0x06, 0x0F, 0xA0, 0xD4, 0x7A, 0xA5, 0x19, 0x66, 0xA2, 0x48, 0x17, 0x91,
-    0xC2, 0xD5, 0xF1, 0x45, 0x20, 0x57, 0xCE, 0x6D, 0xE5, 0xE1, 0x62, 0xC1, 0xB8, 0xFA, 0x14, 0x31,
-    0x00, 0xC4, 0x59, 0xA6, 0x77, 0x91, 0xE3, 0x4F, 0x5A, 0x30, 0xA5, 0x35, 0x1A, 0x12, 0x8D, 0x74,
-    0xF4, 0x4C, 0x63, 0x82, 0x6B, 0xA5, 0xCC, 0xD1, 0xA5, 0x5C, 0xFC, 0x02, 0xED, 0xF4, 0x95, 0x6E,
-    0x0E, 0x69, 0x73, 0x9F, 0x69, 0x78, 0x6D, 0x58, 0x5E, 0x28, 0x43, 0xD1, 0x1A, 0xBE, 0xBD, 0x11,
-    0xD4, 0x98, 0x76, 0x38, 0x09, 0xF5, 0x0B, 0xCA, 0x0A, 0x65, 0x4B, 0x65, 0x95, 0xB2, 0x95, 0xB2,
-    0x86, 0xEC, 0x13, 0x4B, 0xF6, 0x6B, 0x54, 0xFA, 0x99, 0xFC, 0x3E, 0x82, 0x74, 0x93, 0xFF, 0x16,
-    0x51, 0x3A, 0xEF, 0x36, 0xB2, 0x74, 0x45, 0x16, 0x37, 0x64, 0xA1, 0x25, 0xF3, 0xED, 0x5F, 0x83,
-    0x4D, 0xED, 0x7D, 0xB0, 0x89, 0xFD, 0x0C, 0xCC, 0xD8, 0xAF, 0xC8, 0xD2, 0x63, 0xB2, 0xD8, 0x92,
-    0x85, 0xCA, 0x7C, 0x65, 0x53, 0x65, 0x13, 0x65, 0xC6, 0x31, 0x56, 0xDC, 0x4C, 0x80, 0x7A, 0x61,
-    0x35, 0x70, 0x3E, 0x10, 0x26, 0x7B, 0xCD, 0xAC, 0x60, 0x70, 0x3D, 0x36, 0xB4, 0x97, 0x5C, 0x3F,
-    0x32, 0xE9, 0x6F, 0x64, 0x9D, 0x4C, 0xFF, 0x68, 0x6D, 0x4D, 0x98, 0x87, 0x28, 0x0F, 0x41, 0x1E,
-    0x62, 0x3C, 0x84, 0x78, 0x88, 0xED, 0x28, 0xA9, 0x5F, 0x8C, 0x5C, 0x6E, 0x69, 0x6E, 0xBE, 0xAE,
-    0xDC, 0xD1, 0x8A, 0x4F, 0xB5, 0xA7, 0x50, 0x21, 0xF7, 0x50, 0x4D, 0x28, 0x22, 0x6C, 0xCA, 0x90,
-    0xAE, 0x5F, 0x6D, 0xB7, 0x26, 0xE4, 0x33, 0xFE, 0x18, 0xD7, 0x19, 0xF8, 0x2B, 0x1E, 0x4D, 0xA2,
-    0xEB, 0x9D, 0x15, 0x7A, 0x29, 0xCC, 0x5D, 0xC2, 0xF4, 0xE9, 0xC5, 0x30, 0x7F, 0x69, 0x5C, 0x06,
-    0xD3, 0xE5, 0x30, 0x5D, 0x16, 0x73, 0x94, 0xC7, 0xBC, 0xEC, 0xF7, 0xC5, 0x38, 0x01, 0xFA, 0x1B,
-    0x78, 0x52, 0x27, 0xE7, 0x27, 0x40, 0xB7, 0xA6, 0xB2, 0x99, 0x5D, 0xC7, 0x4C, 0x7D, 0x56, 0xA7,
-    0x37, 0xAC, 0xD3, 0xF6, 0x35, 0x47, 0xA7, 0xA2, 0x32, 0xFF, 0x58, 0x94, 0x13, 0x2F, 0xF3, 0xDF,
-    0x8B, 0xF3, 0xB4, 0x87, 0x80, 0x9D, 0xEE, 0xBC, 0x7D, 0x84, 0x51, 0xE4, 0x84, 0x64, 0x4D, 0xDE,
-    0xB0, 0xA8, 0x41, 0x7C, 0x40, 0xD4, 0xC0, 0x4A, 0x84, 0x11, 0x28, 0x5A, 0xF3, 0x8A, 0xD9, 0x53,
-    0x4C, 0x61, 0xD3, 0x06, 0x5A, 0x65, 0xD6, 0x99, 0x42, 0xA6, 0xA6, 0x40, 0xE5, 0x3F, 0x70, 0xCA,
-    0xB7, 0xAA, 0xF5, 0xB4, 0x55, 0x1B, 0x50, 0xE5, 0x07, 0xAA, 0xF5, 0x99, 0x6A, 0x7D, 0x62, 0x9F,
-    0xA8, 0xF2, 0x55, 0x97, 0xA9, 0xB2, 0x48, 0x59, 0xA0, 0x6C, 0x76, 0xAE, 0xD6, 0x63, 0x65, 0x91,
-    0xB2, 0x40, 0xD9, 0x54, 0xE5, 0xBD, 0xC9, 0x34, 0x83, 0xF6, 0x30, 0xD7, 0xB2, 0x69, 0xAD, 0xA4,
-    0xB3, 0x76, 0x7C, 0x3B, 0xDC, 0xFB, 0xD3, 0x69, 0xD3, 0xA8, 0xBE, 0xC1, 0x34, 0xEA, 0x97, 0xBA,
-    0x9B, 0x4F, 0x11, 0x44, 0x0C, 0xD7, 0xF2, 0xD6, 0x95, 0x21, 0x86, 0xD0, 0x3B, 0x56, 0x41, 0x31,
-    0x9B, 0xC4, 0x5C, 0x7C, 0x7F, 0x89, 0x97, 0x73, 0x05, 0x0C, 0x59, 0x78, 0xC1, 0xBA, 0x00, 0x07,
-    0x82, 0x23, 0x25, 0xDF, 0x7D, 0x68, 0x51, 0xF5, 0xB6, 0x94, 0xCF, 0x99, 0xA5, 0x0A, 0xB5, 0x36,
-    0xDE, 0xB7, 0x59, 0xCA, 0xCA, 0xC7, 0x22, 0x27, 0xC8, 0x51, 0x20, 0x5F, 0x35, 0x61, 0x99, 0xDF,
-    0x9A, 0x95, 0x0E, 0x42, 0x18, 0xFD, 0x85, 0x10, 0x56, 0xCF, 0x74, 0xBF, 0x4B, 0xB5, 0xC2, 0xDE,
-    0xB5, 0xE9, 0xAE, 0xC0, 0xD4, 0x15, 0x70, 0xA7, 0xEE, 0xA7, 0x1A, 0x89, 0xBB, 0x40, 0xDD, 0x6A,
-    0x61, 0x31, 0xEB, 0xA5, 0xA5, 0x87, 0x0C, 0xD7, 0x3D, 0x8E, 0x04, 0xD0, 0x28, 0xAB, 0x2A, 0x8A,
-    0x4D, 0xAA, 0x9F, 0xF7, 0xE3, 0x3C, 0x54, 0xE0, 0x92, 0xFA, 0xE3, 0x04, 0x85, 0x31, 0x06, 0xF6,
-    0x0B, 0x19, 0xA2, 0x44, 0x78, 0x12, 0x09, 0x46, 0xEB, 0x62, 0xB4, 0x84, 0xC1, 0x13, 0xE8, 0xD4,
-    0x66, 0xE7, 0x50, 0xA4, 0xA6, 0x80, 0xF9, 0xF8, 0xDC, 0x33, 0x10, 0xA0, 0x24, 0x2D, 0x13, 0x65,
-    0xCF, 0x98, 0x18, 0xF1, 0x18, 0xC8, 0xB8, 0x3E, 0xF8, 0xBA, 0xC1, 0x84, 0x53, 0x7F, 0x20, 0x53,
-    0x4C, 0x42, 0xB0, 0x2F, 0x37, 0x7D, 0x16, 0x1D, 0xFD, 0x68, 0x46, 0x5B, 0x50, 0x5C, 0x22, 0x7D,
-    0x9C, 0x49, 0xFF, 0x56, 0xE8, 0x88, 0x79, 0x76, 0xD3, 0x71, 0x9B, 0x44, 0xFE, 0x10, 0xCE, 0xB7,
-    0xC6, 0xB6, 0x81, 0xD5, 0x7D, 0x38, 0x8A, 0x6B, 0x8E, 0xC7, 0xFC, 0xE6, 0xF5, 0x65, 0x16, 0xFF,
-    0xBC, 0x60, 0x79, 0x35, 0x2A, 0x0C, 0xE5, 0x64, 0x8D, 0xC8, 0x56, 0x91, 0xA6, 0x3E, 0x53, 0xD6,
-    0x33, 0x27, 0x9C, 0x1F, 0xAE, 0x7E, 0xEB, 0xF4, 0x75, 0xED, 0x0E, 0xB0, 0x99, 0x78, 0x45, 0x64,
-    0xBE, 0x84, 0x64, 0xEC, 0x2F, 0x50, 0xF4, 0xD1, 0xA2, 0x0E, 0xD7, 0xAF, 0x83, 0x25, 0x00, 0xF8,
-    0xB7, 0x4D, 0x5F, 0x43, 0x67, 0x34, 0x0B, 0xA8, 0x43, 0xEB, 0x0B, 0x30, 0x6D, 0xBF, 0xEB, 0x86,
-    0x6F, 0xA8, 0x08, 0x2D, 0x4A, 0x2D, 0x34, 0x44, 0x8B, 0xAC, 0x4B, 0xB9, 0x03, 0xA1, 0xE0, 0x9B,
-    0x74, 0x78, 0x53, 0x8F, 0xEA, 0xB0, 0x86, 0xCA, 0xAA, 0xDC, 0x15, 0x4D, 0x3F, 0xF3, 0x0D, 0xEB,
-    0xB3, 0xEA, 0xD3, 0xED, 0xA0, 0x80, 0x7D, 0xF3, 0x5A, 0x40, 0xA2, 0xF8, 0x46, 0xC1, 0x37, 0xE2,
-    0x96, 0x47, 0x7F, 0x8B, 0xB0, 0xD1, 0x0C, 0x7D, 0x1E, 0x46, 0xB1, 0x1E, 0xD7, 0xA4, 0x7F, 0x63,
-    0x76, 0xF6, 0xD7, 0xC5, 0x5A, 0xD7, 0x8F, 0x39, 0x9E, 0x6E, 0x02, 0x15, 0x40, 0x18, 0x9F, 0xD8,
-    0x5E, 0xED, 0x38, 0x39, 0x90, 0x05, 0xCA, 0x1E, 0x89, 0xA9, 0x41, 0x2F, 0xA8, 0x4B, 0x58, 0xA2,
-    0x88, 0x0B, 0x70, 0x5F, 0x49, 0xED, 0x64, 0x28, 0x26, 0x80, 0x82, 0x1E, 0x2E, 0x72, 0x89, 0xC9,
-    0xF5, 0x87, 0xE7, 0xBC, 0x89, 0x6B, 0x6C, 0x93, 0x32, 0xAE, 0x52, 0x3A, 0x33, 0xAE, 0x48, 0xBA,
-    0x30, 0xAE, 0x4C, 0xBA, 0xE4, 0x70, 0x6E, 0x61, 0xF1, 0x9F, 0x15, 0x33, 0x77, 0xF5, 0x62, 0xD2,
-    0xBF, 0x81, 0x94, 0x7E, 0xC1, 0x37, 0x32, 0x54, 0x51, 0x67, 0xEB, 0xF4, 0x38, 0xD7, 0x72, 0x84,
-    0x8C, 0xB7, 0xD0, 0x08, 0x50, 0x2F, 0xFB, 0xFD, 0x0E, 0x66, 0xD6, 0x98, 0x8D, 0xED, 0x3B, 0x28,
-    0x6C, 0x4F, 0x68, 0x77, 0xAD, 0x5A, 0x75, 0xD6, 0x97, 0xB7, 0x1F, 0xE7, 0xDC, 0x03, 0x86, 0xC4,
-    0x12, 0x12, 0xD7, 0xA4, 0x71, 0x33, 0xA2, 0xFA, 0x79, 0xCD, 0x73, 0x2A, 0x9E, 0xBF, 0x5C, 0xB7,
-    0xD0, 0x0E, 0xA9, 0xD8, 0xE3, 0x1C, 0x88, 0x71, 0x85, 0x35, 0x97, 0xC1, 0xBF, 0xB1, 0x44, 0x5B,
-    0x59, 0x71, 0xED, 0xB6, 0x99, 0x01, 0x46, 0xD1, 0xF6, 0x81, 0x12, 0xA0, 0xEB, 0x2C, 0x7B, 0xCF,
-    0xB4, 0x04, 0xDE, 0x00, 0xD9, 0xF2, 0xF8, 0xBE, 0xE0, 0xFA, 0x8D, 0x92, 0x7D, 0x54, 0x4D, 0xEC,
-    0x0D, 0x3E, 0x66, 0x95, 0x2E, 0x45, 0xDC, 0x9F, 0x89, 0x80, 0x4F, 0xE8, 0x49, 0xC8, 0x71, 0xB4,
-    0x0F, 0x9F, 0x9B, 0xE5, 0x1D, 0xAB, 0x17, 0x80, 0x38, 0x2E, 0x81, 0x54, 0xCE, 0x44, 0x29, 0x8A,
-    0xA8, 0x6E, 0xA0, 0xC6, 0xCD, 0x29, 0xD4, 0xF8, 0x75, 0xC8, 0xAA, 0x7F, 0x5D, 0xBB, 0xA3, 0xAA,
-    0x41, 0xF1, 0x04, 0x20, 0x52, 0x84, 0x6E, 0xA8, 0x39, 0x42, 0xAA, 0xFB, 0xCA, 0xA1, 0xB9, 0x76,
-    0x0B, 0xBB, 0x99, 0x08, 0x86, 0xFC, 0xA3, 0x4E, 0xEE, 0x84, 0x33, 0xB9, 0x76, 0x07, 0x1C, 0xCF,
-    0x7A, 0x2B, 0xC8, 0x25, 0x90, 0xFF, 0x8D, 0xCC, 0xDC, 0x4C, 0xA2, 0x5A, 0x5C, 0x5E, 0xBF, 0x93,
-    0x88, 0x6F, 0xE2, 0xD2, 0x21, 0xC4, 0x74, 0xC6, 0xF5, 0x41, 0x3B, 0xFB, 0xBB, 0x0D, 0xB6, 0xA7,
-    0x09, 0x59, 0x61, 0x3E, 0xEF, 0x38, 0xA9, 0x93, 0x74, 0x07, 0xDC, 0x46, 0xA3, 0xB7, 0x2A, 0xEB,
-    0x3B, 0xB9, 0xD3, 0xEE, 0x05, 0x89, 0x4B, 0x2C, 0x71, 0x93, 0x4E, 0xDE, 0x43, 0x55, 0x2C, 0x4A,
-    0x22, 0x12, 0xBA, 0x33, 0xC8, 0xF6, 0xBA, 0x5B, 0xC0, 0xCA, 0x69, 0x5F, 0xE0, 0x23, 0x71, 0xE2,
-    0x43, 0x5B, 0xC8, 0x22, 0xE3, 0x27, 0xA7, 0xAA, 0x4E, 0x59, 0x60, 0xC5, 0xE9, 0x28, 0xB0, 0x0C,
-    0x52, 0x98, 0xE6, 0x56, 0xAF, 0xD9, 0xF6, 0x5B, 0x93, 0x42, 0x2D, 0x34, 0x1B, 0x10, 0xBB, 0x54,
-    0xC9, 0x3F, 0xE0, 0xCF, 0x54, 0x66, 0xE2, 0x12, 0xBE, 0x7D, 0x01, 0x92, 0xC4, 0xD0, 0xC1, 0x8C,
-    0xAD, 0xE8, 0xAC, 0x7B, 0x6D, 0xD1, 0x03, 0x4A, 0x9A, 0xEF, 0xCB, 0x1C, 0x84, 0x4B, 0x4F, 0x61,
-    0xD4, 0xE7, 0x2E, 0xD1, 0x1D, 0xC7, 0x01, 0x96, 0x87, 0x08, 0xEF, 0xE2, 0x56, 0x04, 0x2B, 0x97,
-    0xFA, 0x8E, 0x1A, 0x21, 0xA5, 0x1E, 0x6B, 0x8D, 0xA8, 0xB4, 0x32, 0xA5, 0x9A, 0x39, 0x33, 0xEE,
-    0x72, 0x65, 0x8D, 0x6C, 0x1F, 0x1E, 0x8A, 0xCA, 0xFE, 0x4A, 0xF7, 0x45, 0x58, 0xAB, 0xE9, 0x8C,
-    0x18, 0x27, 0xEB, 0xF6, 0x1F, 0x96, 0xD1, 0xEE, 0xC2, 0x77, 0x09, 0x54, 0x97, 0xD0, 0xEA, 0x63,
-    0xC4, 0xDF, 0xD0, 0xB4, 0x98, 0x43, 0x26, 0xFD, 0xEE, 0xE1, 0xAD, 0xB7, 0x49, 0x92, 0xDC, 0x18,
-    0x99, 0x6A, 0x4B, 0x18, 0xBE, 0xF8, 0x89, 0x41, 0x83, 0x3C, 0x40, 0x39, 0x6D, 0xC7, 0x55, 0x4C,
-    0xDB, 0x95, 0xE4, 0xDB, 0x24, 0x26, 0x26, 0x96, 0xB8, 0xE5, 0xD8, 0xE7, 0x14, 0xC9, 0xC2, 0x3B,
-    0x94, 0xE0, 0x7D, 0x37, 0xED, 0x91, 0x58, 0x0E, 0x9D, 0xF9, 0x9C, 0xAD, 0x89, 0x29, 0xE4, 0x52,
-    0x5F, 0xF6, 0x77, 0xB1, 0xA7, 0xDB, 0x8C, 0xA5, 0xE9, 0xEF, 0xDB, 0x44, 0x31, 0x5B, 0x2D, 0x50,
-    0xC3, 0xE6, 0x38, 0xCC, 0xA2, 0x87, 0xBA, 0x25, 0x94, 0x2E, 0x25, 0x40, 0x01, 0xDD, 0x30, 0xCA,
-    0xAD, 0xA3, 0xEB, 0xF9, 0xF3, 0x2D, 0x32, 0xCC, 0x8B, 0xCE, 0x93, 0xDB, 0x35, 0xCC, 0x98, 0x4B,
-    0x42, 0x6A, 0xFB, 0x5E, 0x6F, 0xD2, 0x1E, 0xDB, 0x7E, 0xB3, 0x34, 0xD6, 0x95, 0x30, 0x59, 0x6F,
-    0xC6, 0xD4, 0xB2, 0x52, 0x75, 0xE1, 0x7C, 0xC5, 0x25, 0xB8, 0x9D, 0x82, 0xDF, 0xAA, 0x1B, 0xC9,
-    0x52, 0x18, 0x2C, 0xBC, 0x05, 0x0D, 0xDC, 0xB3, 0x9F, 0x1F, 0xF8, 0x96, 0xFB, 0xDC, 0x79, 0x7C,
-    0xCF, 0x1E, 0xDF, 0xD1, 0xC2, 0xC0, 0x8B, 0x1C, 0x28, 0x71, 0xA9, 0xFF, 0xC2, 0xE8, 0x96, 0x09,
-    0xC8, 0x10, 0x2E, 0x2E, 0x3C, 0x04, 0xB7, 0x31, 0x1E, 0xFD, 0x04, 0xAA, 0x86, 0x1E, 0xF9, 0xFA,
-    0x9D, 0x6F, 0x91, 0xD9, 0x4E, 0xBC, 0x7E, 0x7B, 0x65, 0x48, 0x87, 0x20, 0x2F, 0x9D, 0xCE, 0x88,
-    0x2D, 0x9D, 0xB3, 0xBD, 0xF2, 0x32, 0xE8, 0x83, 0x48, 0x6F, 0x0F, 0x06, 0x1B, 0xE7, 0x6B, 0x41,
-    0xE2, 0xC0, 0x83, 0xE3, 0x02, 0xBE, 0x56, 0x5A, 0x78, 0x87, 0x6E, 0x62, 0x81, 0xE4, 0xB9, 0x8F,
-    0xB2, 0x59, 0xE7, 0xCC, 0x41, 0xA1, 0x01, 0xB7, 0x38, 0xBF, 0x30, 0xA5, 0xB3, 0x04, 0xCD, 0xF4,
-    0xF0, 0x5A, 0xEF, 0x4B, 0xE9, 0x7E, 0x4F, 0x5A, 0xC9, 0xFC, 0x95, 0x48, 0xD5, 0x5B, 0xD8, 0xE3,
-    0x43, 0x86, 0x4A, 0xD5, 0x39, 0xF4, 0x15, 0x48, 0xF5, 0x39, 0xED, 0x35, 0xD2, 0x6C, 0xF7, 0x70,
-    0x5C, 0xCC, 0x5E, 0xE7, 0x28, 0xBF, 0xF3, 0x58, 0xEC, 0x36, 0x43, 0x32, 0xCB, 0xDE, 0x53, 0x54,
-    0xA1, 0x30, 0xD3, 0x23, 0x80, 0xAE, 0xB3, 0x12, 0x3E, 0x87, 0x97, 0x98, 0xB5, 0xFF, 0x59, 0x62,
-    0x7A, 0x63, 0x18, 0xBA, 0x25, 0xCA, 0x0D, 0x4F, 0xA8, 0x65, 0x12, 0xB7, 0x35, 0x46, 0xC4, 0xB9,
-    0x8C, 0xEC, 0xE7, 0xEF, 0xDB, 0x22, 0x18, 0x82, 0xEF, 0xC1, 0x79, 0xBD, 0xCE, 0xA8, 0x55, 0xBD,
-    0x10, 0x2F, 0x91, 0x71, 0xC5, 0xF5, 0x14, 0x45, 0x2F, 0xFF, 0x5A, 0x4E, 0x58, 0xCC, 0x2A, 0x63,
-    0xCA, 0xA6, 0x95, 0xDF, 0x0D, 0x75, 0x7E, 0x9C, 0xF3, 0x76, 0xE6, 0x2F, 0x03, 0xA2, 0x0A, 0x09,
-    0x01, 0xC5, 0x46, 0x00, 0x65, 0xD3, 0x2E, 0xB6, 0x3F, 0xB0, 0xA8, 0x67, 0xB5, 0x9D, 0xF4, 0xEF,
-    0xA4, 0x93, 0xBB, 0xFA, 0x81, 0x44, 0xED, 0xDD, 0xB4, 0x53, 0x67, 0x44, 0xE1, 0xC3, 0xA1, 0x6C,
-    0x64, 0xA0, 0x23, 0x58, 0xF1, 0xD2, 0x48, 0xF8, 0x99, 0xFB, 0x51, 0xB7, 0x2C, 0xD7, 0x8F, 0xB8,
-    0x2F, 0x25, 0xA7, 0x2B, 0x83, 0x0A, 0x53, 0xAD, 0x27, 0xE5, 0x34, 0xC3, 0xE4, 0x94, 0x06, 0x7A,
-    0xE6, 0xB2, 0x59, 0xF1, 0xC4, 0xED, 0x6D, 0x0D, 0xDD, 0xDE, 0xD6, 0xFC, 0x29, 0x7B, 0x5B, 0xB7,
-    0x2C, 0x6D, 0x05, 0x18, 0xFA, 0x67, 0xBA, 0x70, 0x13, 0xFD, 0xA7, 0xC4, 0x31, 0x8B, 0x8F, 0x06,
-    0xEA, 0x7F, 0xD1, 0x0C, 0xDF, 0xEA, 0xC4, 0xBC, 0xDE, 0x89, 0x7B, 0x79, 0x6C, 0x9C, 0x31, 0xFA,
-    0x44, 0x41, 0x65, 0x69, 0x21, 0xF8, 0x1D, 0x32, 0x22, 0x49, 0xE3, 0x08, 0xFF, 0xF4, 0x15, 0x32,
-    0x2D, 0xDC, 0xC9, 0x6F, 0x40, 0x1D, 0x57, 0xEE, 0x22, 0xC6, 0x89, 0x9A, 0x78, 0x78, 0x62, 0x83,
-    0xFD, 0x58, 0x86, 0xE0, 0x59, 0xAC, 0xBC, 0xD3, 0x15, 0xB6, 0xD5, 0x78, 0xC9, 0xCE, 0xE5, 0x9B,
-    0xC2, 0x6F, 0xDC, 0xB9, 0x79, 0x88, 0x9E, 0x2E, 0x8D, 0xFD, 0x25, 0x1E, 0x34, 0x20, 0x0E, 0xFE,
-    0xAC, 0x91, 0x98, 0x3D, 0x28, 0x65, 0x61, 0xDC, 0x19, 0xF0, 0xD9, 0xED, 0x4A, 0xFB, 0x6D, 0x97,
-    0x1E, 0xEE, 0x34, 0xDD, 0x5F, 0xAC, 0x0F, 0x66, 0xF2, 0xDA, 0xF5, 0x73, 0xA5, 0x26, 0xFA, 0xDE,
-    0x1E, 0xF0, 0x9E, 0xD4, 0x6D, 0x61, 0x8D, 0xCB, 0x00, 0x6F, 0x53, 0x8A, 0x7C, 0xAE, 0x55, 0xC8,
-    0x28, 0x33, 0xE9, 0x1F, 0x25, 0xA5, 0xE1, 0xDD, 0xFF, 0xB8, 0xFC, 0xBF, 0x3E, 0xD6, 0x64, 0xF7,
-    0x4E, 0xFF, 0x04, 0x20, 0x33, 0x7A, 0xF2, 0x95, 0x71, 0xA1, 0x9D, 0x16, 0x0B, 0x3C, 0x6A, 0x7B,
-    0x7C, 0xFE, 0xE7, 0x5A, 0x4A, 0x00, 0x30, 0x2D, 0x55, 0x14, 0x70, 0xF4, 0x7C, 0xA0, 0xB5, 0xED,
-    0x4F, 0x64, 0x0A, 0x9D, 0xB1, 0xD8, 0x75, 0x4A, 0x98, 0x18, 0x71, 0x14, 0x60, 0xC3, 0xA0, 0x33,
-    0x04, 0x9F, 0x4B, 0xA4, 0x9F, 0x63, 0x75, 0xD8, 0x25, 0x2E, 0x23, 0x8C, 0x5D, 0x81, 0x85, 0x78,
-    0x57, 0xB3, 0x12, 0xB2, 0x65, 0x6E, 0x34, 0x66, 0x12, 0x35, 0x3A, 0x61, 0x28, 0x86, 0xA0, 0xEA,
-    0x8F, 0x7C, 0x87, 0xE7, 0x4B, 0x3C, 0x68, 0x71, 0x29, 0x3C, 0xDC, 0xE5, 0xBE, 0x35, 0xCC, 0x5C,
-    0x24, 0x39, 0xDE, 0x01, 0xE4, 0xCB, 0xA4, 0xA7, 0xDF, 0xA7, 0x5B, 0xF6, 0xB1, 0xF0, 0x9F, 0x63,
-    0x81, 0x12, 0xFB, 0x36, 0xF6, 0x3E, 0xE3, 0xDA, 0x07, 0xAC, 0x60, 0x40, 0x57, 0x3F, 0xEB, 0x4C,
-    0xCA, 0x2C, 0x51, 0xFA, 0x95, 0x74, 0xE8, 0x77, 0x2C, 0xB2, 0x79, 0x22, 0xCE, 0x1B, 0x47, 0x1C,
-    0x9F, 0x60, 0x47, 0x8C, 0x86, 0xA9, 0x2B, 0x4D, 0xD7, 0x0A, 0x45, 0x72, 0x64, 0x65, 0x74, 0xB2,
-    0x0A, 0x1C, 0x80, 0x58, 0xE9, 0x0C, 0x45, 0xE9, 0xF5, 0x01, 0xD1, 0x72, 0x28, 0xAF, 0xD5, 0xC7,
-    0x46, 0xC1, 0x51, 0xEE, 0xB3, 0x1C, 0x99, 0x96, 0x0B, 0xB0, 0x96, 0x4D, 0x02, 0xAB, 0x90, 0x92,
-    0x8E, 0x97, 0xB3, 0x3E, 0x27, 0x32, 0x4A, 0xF4, 0x4A, 0x98, 0xB2, 0x77, 0x00, 0xB3, 0x21, 0x14,
-    0x18, 0xB4, 0x22, 0x90, 0x14, 0xFB, 0xB7, 0x81, 0x35, 0x5A, 0xDD, 0x34, 0x8F, 0x30, 0x73, 0x15,
-    0x34, 0x1E, 0xE2, 0xDF, 0x3A, 0x68, 0x27, 0x5D, 0x9E, 0xA5, 0xE2, 0x81, 0x4D, 0xDB, 0xB4, 0xC8,
-    0xCB, 0x99, 0xCC, 0x50, 0x71, 0x81, 0x54, 0xFD, 0x0F, 0x9B, 0x78, 0x89, 0xB2, 0x8D, 0x0F, 0x56,
-    0xD1, 0xA7, 0x80, 0xF3, 0x3F, 0xA8, 0xC3, 0x2F, 0x81, 0x4C, 0xFE, 0x47, 0x15, 0x7C, 0x05, 0xDF,
-    0x82, 0x5C, 0x7A, 0xF9, 0x49, 0xE9, 0x3F, 0x11, 0x41, 0xA4, 0x8F, 0x97, 0xB3, 0x93, 0x96, 0xD8,
-    0xC4, 0x54, 0x23, 0x08, 0xE5, 0x11, 0xF8, 0x8A, 0x09, 0x8F, 0x89, 0x86, 0xC3, 0x89, 0x6E, 0xA4,
-    0xDF, 0xDC, 0xD0, 0x96, 0x6C, 0x6E, 0x68, 0x4B, 0x4F, 0x6F, 0x68, 0x03, 0x4A, 0x18, 0x35, 0x84,
-    0x7D, 0x1B, 0xD6, 0x76, 0xA3, 0x88, 0xD9, 0xC3, 0x9E, 0x15, 0xB9, 0xDD, 0xE4, 0x0A, 0xC5, 0x0C,
-    0xED, 0x2F, 0x15, 0x1D, 0x05, 0x3E, 0x99, 0xD7, 0x40, 0x0C, 0xF8, 0xFC, 0x34, 0x13, 0xB5, 0x5C,
-    0x29, 0x14, 0x59, 0x71, 0x05, 0xFA, 0xB8, 0xA2, 0x67, 0xD5, 0xC4, 0x47, 0x4F, 0x1B, 0x8A, 0x5F,
-    0x9C, 0x7A, 0xDC, 0x73, 0x38, 0x75, 0x3A, 0xA6, 0x1D, 0x9C, 0xD0, 0x6A, 0x96, 0xB4, 0x31, 0xC2,
-    0x84, 0xA3, 0x3D, 0x87, 0x08, 0x28, 0xE7, 0x49, 0x5E, 0x33, 0x8D, 0x37, 0xCA, 0x87, 0x85, 0x7C,
-    0x10, 0x8A, 0x58, 0x71, 0xD0, 0x31, 0x31, 0x06, 0x3C, 0x0F, 0x49, 0x32, 0x9C, 0x80, 0x34, 0x4F,
-    0x01, 0x3C, 0xC3, 0x2E, 0x61, 0x0C, 0x79, 0x49, 0x77, 0xF5, 0x7F, 0x89, 0x50, 0x7C, 0x49, 0x84,
-    0xE6, 0x89, 0x96, 0xC1, 0x6B, 0x45, 0xBC, 0xCA, 0x76, 0xBC, 0xE8, 0x8F, 0x9F, 0xA5, 0x54, 0xF6,
-    0xEB, 0xA8, 0x3E, 0x54, 0x0A, 0x9A, 0x41, 0xA9, 0x81, 0xA2, 0x13, 0xCD, 0x70, 0x4B, 0xB3, 0x00,
-    0x90, 0xA5, 0x25, 0xC3, 0x2B, 0x2C, 0x01, 0x02, 0xC5, 0x95, 0x22, 0xE8, 0x58, 0xE3, 0xA2, 0x0A,
-    0xA3, 0xDB, 0xCD, 0x76, 0xB3, 0xCD, 0x7B, 0xFB, 0xED, 0xD7, 0x9A, 0x3E, 0x3B, 0x4E, 0xAB, 0xE6,
-    0x5C, 0x39, 0x95, 0x7E, 0xCE, 0x61, 0x6B, 0x6A, 0xC2, 0x3B, 0x18, 0x3D, 0x26, 0xD2, 0xE1, 0x46,
-    0xA7, 0x68, 0xA4, 0x99, 0xC8, 0x5E, 0x50, 0xDA, 0x2D, 0x0A, 0x5A, 0xF3, 0x1F, 0x8A, 0x78, 0x04,
-    0xA3, 0x44, 0x17, 0x77, 0xFF, 0x7A, 0xEE, 0x94, 0x62, 0x40, 0xFA, 0xC2, 0xEE, 0xCC, 0x29, 0xE5,
-    0x48, 0x45, 0xDA, 0x87, 0xC5, 0x62, 0x91, 0xF1, 0xBA, 0xC5, 0x59, 0x7A, 0x51, 0x9C, 0x7A, 0x0F,
-    0x81, 0x01, 0xA2, 0xEB, 0x4D, 0x32, 0x3C, 0xBB, 0x4A, 0x71, 0xF9, 0xD2, 0x5D, 0x9A, 0x57, 0xE6,
-    0xD8, 0x38, 0x34, 0x6D, 0xB8, 0x70, 0x9D, 0x0E, 0x75, 0xC7, 0xC5, 0x7C, 0xCE, 0x2C, 0x78, 0x62,
-    0x37, 0x49, 0xFF, 0x68, 0xB6, 0xB4, 0x3C, 0xF3, 0xC0, 0x2E, 0xD2, 0x68, 0xD3, 0x66, 0x2E, 0x83,
-    0x88, 0xF1, 0x24, 0x19, 0x3E, 0x4A, 0x46, 0xFB, 0xC2, 0x3C, 0x06, 0xF7, 0x06, 0x8D, 0x1E, 0x27,
-    0xB3, 0x4D, 0x11, 0xF7, 0x10, 0x56, 0x11, 0x72, 0x67, 0xC1, 0x69, 0x08, 0xCB, 0x3B, 0x0D, 0x61,
-    0xBD, 0xFD, 0x22, 0xBE, 0x28, 0x14, 0xBB, 0x3D, 0x2B, 0xBE, 0x76, 0x97, 0xF5, 0xD1, 0x22, 0xD7,
-    0x22, 0x54, 0x81, 0xF1, 0x0A, 0xDC, 0xCB, 0xF1, 0x9A, 0x8E, 0xFF, 0x07, 0xED, 0x5C, 0xBF, 0x93,
-    0xE4, 0xD6, 0x71, 0x7E, 0x98, 0xE1, 0xEE, 0xB8, 0x38, 0xE5, 0x82, 0x03, 0xAE, 0xCB, 0xE2, 0x05,
-    0x48, 0x1C, 0x9D, 0x03, 0xA4, 0x76, 0xE0, 0x02, 0x2C, 0x57, 0x39, 0x51, 0xB2, 0xC1, 0x8E, 0x5C,
-    0x65, 0x06, 0x4E, 0x1C, 0x2D, 0x83, 0xFD, 0x0B, 0x6C, 0x8C, 0xCB, 0x7F, 0x80, 0x96, 0x81, 0xF2,
-    0x75, 0xD5, 0x05, 0xE4, 0x28, 0xB8, 0xC4, 0x81, 0x02, 0xC9, 0x18, 0x89, 0xA1, 0x92, 0x91, 0x1C,
-    0x28, 0x50, 0xE0, 0x51, 0xF1, 0x68, 0xBB, 0xC8, 0x80, 0xB0, 0x05, 0x9A, 0xD8, 0x5D, 0x0C, 0x9E,
-    0xFB, 0xFB, 0xBA, 0x1F, 0x06, 0xB3, 0x3B, 0xC7, 0xE3, 0x1D, 0x79, 0xBF, 0x96, 0xDE, 0xBA, 0xE9,
-    0xD7, 0x37, 0x83, 0x1F, 0xEF, 0x75, 0xBF, 0xD7, 0xAF, 0xFB, 0xEB, 0x06, 0x9C, 0xC3, 0xDF, 0xE9,
-    0x39, 0x1B, 0xE7, 0x2B, 0x17, 0x95, 0x7E, 0xED, 0xE4, 0x5F, 0xE2, 0xBD, 0x77, 0x7E, 0xE5, 0x4A,
-    0x69, 0x7F, 0xE5, 0x97, 0x23, 0x69, 0xFC, 0xB5, 0xCF, 0xA7, 0xBE, 0xFB, 0x91, 0xF7, 0x9D, 0x8B,
-    0xF9, 0x53, 0xE3, 0x52, 0xEF, 0xE4, 0xD0, 0x95, 0xCB, 0x36, 0xCE, 0x4D, 0xFD, 0xDC, 0x15, 0xAD,
-    0x73, 0x13, 0xBF, 0x74, 0x65, 0xE3, 0xDC, 0x18, 0x6D, 0xED, 0xDC, 0x48, 0x7E, 0x97, 0x2B, 0xF7,
-    0x6D, 0x84, 0x3B, 0xEC, 0x69, 0xF1, 0x7B, 0x38, 0x3E, 0x9C, 0x8F, 0xEB, 0xA1, 0x0D, 0xD7, 0xD7,
-    0xFB, 0xE5, 0x72, 0x7F, 0xF9, 0xCD, 0xE3, 0xBB, 0xEE, 0x5D, 0xBF, 0xC1, 0x31, 0xF2, 0xD7, 0x60,
-    0x08, 0xF2, 0xB7, 0x96, 0x36, 0x95, 0x36, 0x77, 0xB8, 0x98, 0x7F, 0xC4, 0xB1, 0x45, 0x27, 0x2E,
-    0xFC, 0x2D, 0x74, 0xB8, 0x3C, 0xCE, 0x61, 0x90, 0x51, 0xF9, 0x20, 0x92, 0x0B, 0xCA, 0x39, 0x7F,
-    0x29, 0xF7, 0x90, 0x33, 0x3F, 0xF3, 0x7A, 0xC5, 0x8D, 0xDC, 0xE8, 0xDA, 0xFB, 0x1A, 0xF7, 0x4C,
-    0xE5, 0x7A, 0x29, 0xBE, 0x70, 0x2E, 0x6B, 0xE5, 0xC6, 0xB9, 0xCB, 0x1A, 0x19, 0x2B, 0x9B, 0xB1,
-    0x9C, 0x76, 0xAB, 0x99, 0xA0, 0x69, 0x79, 0x48, 0x8A, 0x13, 0xA4, 0xE7, 0x9D, 0x5C, 0xC8, 0x41,
-    0x78, 0xE5, 0x06, 0x72, 0xF2, 0xBE, 0x65, 0x0F, 0x31, 0x7A, 0x19, 0x8E, 0x74, 0x01, 0x23, 0xDA,
-    0xB0, 0x5B, 0x47, 0x79, 0xDF, 0xDF, 0xFB, 0x17, 0xDA, 0x16, 0x75, 0x29, 0x5D, 0x2E, 0xAA, 0xA2,
-    0xC2, 0x09, 0x65, 0x55, 0x6A, 0xFB, 0xDF, 0x7E, 0xC5, 0xF6, 0xDA, 0x2F, 0xD9, 0x42, 0x71, 0x6C,
-    0x1B, 0x6B, 0xE7, 0xDA, 0x56, 0xEE, 0xB9, 0xB5, 0x81, 0x2F, 0x1A, 0xD1, 0xA6, 0xB4, 0xA2, 0xAE,
-    0xB1, 0xC8, 0x55, 0x24, 0xFA, 0xF1, 0x19, 0x46, 0x15, 0x7B, 0x55, 0xC7, 0x98, 0x32, 0x55, 0x35,
-    0xD5, 0x68, 0xEF, 0xA9, 0x96, 0x76, 0x86, 0xFB, 0xE6, 0x07, 0x6C, 0xE2, 0x8E, 0x4D, 0xB2, 0x39,
-    0x3A, 0x76, 0x07, 0xB3, 0xA4, 0x2D, 0x6A, 0xF9, 0x2A, 0x6B, 0xD8, 0x94, 0x15, 0x1A, 0xEF, 0x57,
-    0xDA, 0xE4, 0x6C, 0x1A, 0xC7, 0xDF, 0xDC, 0xD3, 0x35, 0x49, 0xC7, 0x6E, 0xA7, 0x68, 0x5A, 0x57,
-    0x48, 0x93, 0xF9, 0xEF, 0xCA, 0x0C, 0xE7, 0x0C, 0xEA, 0xD8, 0xF5, 0xEB, 0x8E, 0xCA, 0xFA, 0x37,
-    0x74, 0xC8, 0x77, 0x63, 0x34, 0x07, 0xDB, 0xEE, 0xBA, 0x68, 0xE1, 0x46, 0x1F, 0x84, 0xFF, 0x94,
-    0xCB, 0xB8, 0x09, 0x7C, 0x5A, 0x17, 0x55, 0xE0, 0xE3, 0x8E, 0xDA, 0xE5, 0x9F, 0x48, 0x61, 0x7B,
-    0xB2, 0xA9, 0x5B, 0x85, 0x70, 0xEC, 0x76, 0xFE, 0x4A, 0x7F, 0x75, 0xEC, 0xB8, 0x14, 0xFD, 0x5C,
-    0x7B, 0x43, 0x7E, 0xA9, 0x93, 0x7C, 0xCB, 0xB7, 0x03, 0xBE, 0x53, 0x3E, 0x17, 0x35, 0x94, 0x94,
-    0xAD, 0x0C, 0x50, 0xF8, 0x98, 0xB7, 0x97, 0xE9, 0x28, 0x3C, 0x55, 0x83, 0xA5, 0x26, 0xFC, 0x68,
-    0xB8, 0x02, 0xF1, 0xC1, 0x6A, 0x0B, 0x7C, 0x2C, 0x17, 0xA0, 0x8A, 0x6B, 0x5E, 0xA6, 0xE7, 0xE5,
-    0x32, 0x3D, 0x1F, 0x8E, 0x15, 0x1E, 0x0B, 0x37, 0xF0, 0x30, 0x02, 0xE1, 0x37, 0x2C, 0x99, 0xC0,
-    0xA7, 0x1B, 0xE5, 0x47, 0x72, 0xCB, 0xA2, 0x51, 0x7E, 0x6C, 0x86, 0xC1, 0xFA, 0xC9, 0xCB, 0x38,
-    0xED, 0x3F, 0xD6, 0x90, 0xF0, 0x57, 0x25, 0x6D, 0xCE, 0x62, 0xB1, 0x98, 0xEB, 0x42, 0x4F, 0xFB,
-    0xF1, 0xAE, 0xB6, 0xBC, 0x29, 0x8D, 0xFC, 0x79, 0xE0, 0x6D, 0x4E, 0x3D, 0x70, 0x6F, 0xDA, 0x2A,
-    0x12, 0xFD, 0x15, 0x2B, 0x95, 0xAC, 0xF3, 0x3F, 0x17, 0x41, 0xF1, 0x44, 0x59, 0x7E, 0x5D, 0x30,
-    0x1E, 0x09, 0x56, 0x8E, 0x2E, 0xCE, 0xA9, 0x74, 0x43, 0xA5, 0xEA, 0xA2, 0x59, 0xEE, 0x7A, 0xA1,
-    0x86, 0xBE, 0x1E, 0xCC, 0x66, 0xB3, 0x5C, 0x87, 0x80, 0x39, 0xBE, 0x52, 0x89, 0x06, 0xD6, 0xDD,
-    0x62, 0x97, 0x41, 0x6C, 0x13, 0x6A, 0x88, 0x6C, 0xDC, 0x0D, 0x05, 0x1B, 0x58, 0x55, 0x0F, 0x9A,
-    0x81, 0x76, 0x06, 0xCA, 0x81, 0x50, 0x4D, 0x8E, 0x90, 0xA9, 0x89, 0x11, 0x22, 0x35, 0x6D, 0xDB,
-    0x71, 0xD2, 0xDF, 0x31, 0x75, 0x41, 0x19, 0x4E, 0xFD, 0x0F, 0x67, 0xC7, 0x2A, 0x42, 0x4C, 0x93,
-    0x4A, 0x25, 0x18, 0x58, 0x9B, 0x60, 0x95, 0xCA, 0x2F, 0x31, 0xC3, 0x74, 0xF8, 0x81, 0x3B, 0x9D,
-    0xBB, 0x85, 0xA3, 0x71, 0x72, 0x59, 0x35, 0xE9, 0x8C, 0x8D, 0x37, 0x69, 0x63, 0xEC, 0x58, 0x0F,
-    0xA5, 0x95, 0x33, 0xA1, 0x83, 0x2D, 0x74, 0xA2, 0x83, 0x3D, 0x3A, 0xE9, 0x59, 0x65, 0x2E, 0x85,
-    0x15, 0xE9, 0xCD, 0x30, 0xCD, 0x7F, 0xE1, 0x61, 0xB6, 0x3A, 0xD8, 0xC2, 0x6B, 0x63, 0xA7, 0xE8,
-    0x9A, 0xB2, 0xB4, 0xC1, 0x60, 0x37, 0xB0, 0xC3, 0x19, 0xAE, 0x20, 0xE6, 0x35, 0xDB, 0xF4, 0x13,
-    0x4B, 0xC4, 0x06, 0x76, 0x84, 0x8D, 0xA2, 0xE1, 0x2D, 0x26, 0xC1, 0x3C, 0x3B, 0x35, 0xD8, 0xCA,
-    0x62, 0xDE, 0x1A, 0x4B, 0x69, 0x93, 0x85, 0x78, 0xD5, 0xA2, 0x53, 0xBC, 0x76, 0x31, 0x5E, 0x3A,
-    0xA5, 0xBD, 0xE6, 0x94, 0x4D, 0xFC, 0x79, 0xE9, 0x5D, 0xB1, 0x91, 0xFE, 0xD2, 0x98, 0x71, 0x56,
-    0x60, 0xD8, 0xD7, 0xC6, 0x46, 0x62, 0x20, 0x8C, 0x95, 0x99, 0x37, 0x0A, 0x6C, 0xD4, 0x2F, 0x69,
-    0xD8, 0x6E, 0x97, 0xB4, 0x94, 0xD3, 0x2B, 0xD6, 0x5C, 0xC9, 0xBA, 0x92, 0x06, 0xF3, 0x73, 0x6F,
-    0x23, 0xDB, 0x17, 0xED, 0x99, 0x36, 0x99, 0x36, 0xD8, 0xA2, 0xA1, 0xB0, 0x5A, 0x9B, 0x4A, 0x9B,
-    0x25, 0x1B, 0xCE, 0x90, 0xA8, 0xB4, 0x15, 0x77, 0xA8, 0x2B, 0x26, 0xE3, 0xF6, 0x25, 0xA7, 0xF3,
-    0xD8, 0xD0, 0x34, 0xDA, 0x89, 0xB5, 0xCE, 0x1F, 0x37, 0x6C, 0x8E, 0x4E, 0x86, 0x87, 0x3C, 0xDF,
-    0x06, 0x22, 0x90, 0x06, 0xA3, 0x7D, 0x4C, 0xA3, 0x63, 0xD8, 0xD7, 0x94, 0xDC, 0xCA, 0x16, 0xBA,
-    0xA3, 0xD9, 0x42, 0xF0, 0x34, 0x62, 0xCE, 0xB6, 0x37, 0x91, 0x95, 0x6C, 0xE2, 0x7F, 0x88, 0x7D,
-    0xAA, 0x5C, 0x17, 0x58, 0xD9, 0x3B, 0x24, 0x9D, 0x17, 0x35, 0xF7, 0x77, 0x25, 0xB3, 0xE3, 0xDB,
-    0x87, 0x7C, 0xF3, 0x24, 0x48, 0xB9, 0x27, 0x58, 0x08, 0xD1, 0x8F, 0x84, 0x50, 0x8D, 0x42, 0xE6,
-    0xAA, 0xC9, 0x48, 0x3C, 0x28, 0xEC, 0x8B, 0x63, 0xCC, 0xF7, 0x1C, 0xF6, 0x8F, 0xDC, 0xBC, 0x94,
-    0xA3, 0x02, 0xB7, 0xEA, 0xB9, 0xAA, 0xE7, 0x9A, 0x9E, 0x6B, 0x03, 0xF7, 0xEF, 0x3E, 0x70, 0xBF,
-    0x80, 0x59, 0x22, 0xF7, 0xA1, 0x5F, 0x1A, 0xF7, 0x2B, 0xBF, 0x32, 0x4E, 0x2C, 0x66, 0xE0, 0x8A,
-    0x26, 0x70, 0x59, 0x1B, 0xB8, 0xC4, 0x07, 0x6E, 0x2A, 0x1E, 0x9B, 0x72, 0x63, 0xFF, 0xA1, 0x71,
-    0x23, 0xFF, 0x91, 0x71, 0xCE, 0xFF, 0x2E, 0x70, 0xC5, 0x55, 0xE0, 0x32, 0x1F, 0xB8, 0xA4, 0xE7,
-    0xA6, 0x3D, 0x37, 0xEE, 0xB9, 0x51, 0xCF, 0xB9, 0x2D, 0x57, 0x50, 0x06, 0xB6, 0xA2, 0x27, 0x3D,
-    0xD7, 0x5B, 0x35, 0x3A, 0xA8, 0xEA, 0xAC, 0xE9, 0x22, 0x20, 0xD7, 0xF6, 0x5C, 0xDD, 0x73, 0xAB,
-    0x70, 0xC2, 0xE5, 0x76, 0xBF, 0xFF, 0xBB, 0xC0, 0x4C, 0xBB, 0x20, 0xF1, 0xD8, 0x3B, 0x93, 0x38,
-    0x39, 0x4A, 0x7C, 0x0A, 0x8E, 0x12, 0x1F, 0x35, 0xCE, 0x24, 0xEE, 0xD4, 0xE1, 0x0B, 0x1C, 0x25,
-    0x7E, 0x30, 0x73, 0x26, 0x71, 0x9C, 0xAB, 0x12, 0x07, 0xA7, 0x12, 0x07, 0xA7, 0x12, 0x07, 0xA7,
-    0x12, 0x27, 0x47, 0x89, 0x93, 0xA3, 0xC4, 0xC9, 0x51, 0xE2, 0xE4, 0x28, 0x71, 0x72, 0x94, 0x38,
-    0x39, 0x4A, 0x9C, 0x1C, 0x25, 0xAE, 0x1C, 0x24, 0xAE, 0x1C, 0x24, 0xAE, 0x5C, 0xD2, 0x73, 0xD3,
-    0x9E, 0x1B, 0xF7, 0xDC, 0xA8, 0xE7, 0xDC, 0x96, 0x2B, 0xCC, 0x16, 0xAB, 0x17, 0xF5, 0xA5, 0x5C,
-    0x12, 0xB8, 0xB7, 0xCB, 0xAE, 0x57, 0xC7, 0xA6, 0xE7, 0x9A, 0x9E, 0x5B, 0x87, 0x13, 0xBA, 0xA0,
-    0xC0, 0xC8, 0x22, 0xA0, 0xC4, 0x54, 0x95, 0xDA, 0x69, 0x99, 0xB5, 0x66, 0xFA, 0xDC, 0xB4, 0x76,
-    0x37, 0xFE, 0x8E, 0xF2, 0x7B, 0x97, 0x30, 0x55, 0xC5, 0x2F, 0xE9, 0x8B, 0xB4, 0xC5, 0x7F, 0xC2,
-    0x24, 0x4A, 0x4B, 0x07, 0x02, 0xED, 0x95, 0xF4, 0x01, 0xAD, 0xCB, 0x3A, 0xB4, 0x1B, 0xB8, 0x52,
-    0xD2, 0xB6, 0xD8, 0xF8, 0xA5, 0x6D, 0x6E, 0xB4, 0xF5, 0xF3, 0x69, 0x77, 0xC7, 0x71, 0xB3, 0x35,
-    0x9B, 0x7E, 0x6A, 0x42, 0x0A, 0x13, 0xB5, 0x30, 0x73, 0x5C, 0x98, 0x1F, 0x85, 0xC9, 0xFA, 0xF6,
-    0xB9, 0xBB, 0x2F, 0x4E, 0x59, 0xDC, 0x46, 0xF0, 0xCD, 0xC6, 0xFE, 0x7B, 0x9D, 0x1A, 0x3A, 0x5E,
-    0x21, 0xD3, 0x13, 0x12, 0x3D, 0x5E, 0x26, 0xE0, 0xE0, 0x2F, 0xA5, 0x2F, 0x27, 0x87, 0x2C, 0x07,
-    0x2B, 0x40, 0xA3, 0x35, 0xB3, 0x9A, 0x91, 0x7F, 0x58, 0xD3, 0x3F, 0xFE, 0xDB, 0x86, 0x4D, 0xDC,
-    0x72, 0x6D, 0xC5, 0x1B, 0x3A, 0xD0, 0x5C, 0x64, 0xF1, 0x66, 0xC2, 0x9D, 0xB9, 0xE5, 0x32, 0xCC,
-    0x1A, 0xEC, 0xF9, 0x62, 0x33, 0x11, 0xBE, 0x21, 0x0A, 0xC1, 0xD5, 0xE0, 0xB2, 0x55, 0xD8, 0x8F,
-    0xA1, 0x88, 0x91, 0x3A, 0x3B, 0x63, 0xF5, 0xE7, 0x26, 0x1A, 0xD4, 0x4D, 0xFD, 0x27, 0x8B, 0xB2,
-    0xE3, 0xCC, 0x91, 0x0F, 0x3C, 0x5B, 0x09, 0xE7, 0x32, 0x86, 0x64, 0xF3, 0x4C, 0x23, 0x4E, 0x38,
-    0x52, 0xE2, 0x88, 0x42, 0x0E, 0x12, 0xD1, 0x8C, 0xDE, 0x77, 0x87, 0x0F, 0x46, 0x72, 0x8C, 0xF8,
-    0x53, 0xBF, 0xD5, 0x48, 0x11, 0xA7, 0x32, 0xF0, 0x44, 0x8F, 0x67, 0x61, 0x97, 0x3F, 0x2C, 0x1F,
-    0xF0, 0xCE, 0x39, 0x6E, 0xB8, 0x62, 0x68, 0x17, 0x75, 0xDF, 0x97, 0x63, 0xCE, 0xD5, 0xDB, 0xA5,
-    0x9C, 0x85, 0x1C, 0x2C, 0x7C, 0x2B, 0xA1, 0xB6, 0x6F, 0xE1, 0xE6, 0xB4, 0xA9, 0x38, 0x67, 0xAD,
-    0xDC, 0x3F, 0xC3, 0x2C, 0xC8, 0xA0, 0x32, 0x92, 0x42, 0x26, 0x49, 0xE4, 0xDB, 0x4C, 0x0F, 0xF1,
-    0x9F, 0xB5, 0xE2, 0x79, 0x7C, 0xAF, 0x1D, 0xF9, 0xCD, 0xA4, 0x65, 0xBC, 0x74, 0x9A, 0x8B, 0x57,
-    0x46, 0x7F, 0x8C, 0x9E, 0x98, 0xFA, 0x60, 0xDC, 0x82, 0xE9, 0x77, 0x1D, 0x9D, 0xF4, 0xD6, 0xC9,
-    0x33, 0x4C, 0x32, 0x32, 0xF5, 0x1A, 0x16, 0xE6, 0xA6, 0xFE, 0x6F, 0x9A, 0x14, 0x1A, 0x2E, 0xAD,
-    0x07, 0xB7, 0x24, 0x59, 0xB0, 0xBB, 0xEB, 0xA9, 0xF8, 0x6D, 0x6D, 0x86, 0x08, 0x01, 0x91, 0x37,
-    0x76, 0x19, 0xE9, 0xCB, 0xB0, 0xBB, 0x1A, 0x06, 0x65, 0xF5, 0xF3, 0x27, 0x8F, 0x9B, 0xCA, 0xCD,
-    0x60, 0xEE, 0xEF, 0x9B, 0xCA, 0x04, 0x49, 0xD4, 0x41, 0xA6, 0xB5, 0xC5, 0x48, 0x46, 0x3A, 0xDF,
-    0x08, 0x90, 0xB4, 0x86, 0x8F, 0x04, 0xB8, 0xC2, 0xD0, 0x0B, 0x03, 0x47, 0x0C, 0xDB, 0x30, 0xA8,
-    0xC3, 0x90, 0x0F, 0x6D, 0xD6, 0xB6, 0x0F, 0x0F, 0xFE, 0x27, 0xBF, 0xD9, 0x91, 0x76, 0x9E, 0x41,
-    0x22, 0x76, 0x4D, 0xBB, 0x83, 0xE1, 0x21, 0x06, 0x87, 0x04, 0x34, 0xC4, 0xE2, 0x19, 0xC3, 0x42,
-    0x02, 0x14, 0x42, 0x24, 0x44, 0x22, 0x56, 0x99, 0xD4, 0xCE, 0xCF, 0x13, 0x38, 0xC2, 0x15, 0x2C,
-    0x6D, 0x42, 0x5D, 0x4C, 0xB8, 0x6F, 0x8D, 0x74, 0x39, 0xCF, 0x8E, 0x07, 0x63, 0xBE, 0x50, 0x58,
-    0x45, 0xA3, 0x77, 0xDA, 0x6D, 0x6A, 0xF6, 0x3F, 0x18, 0x7E, 0xC2, 0x57, 0x56, 0x74, 0x44, 0xC1,
-    0x11, 0xC5, 0x46, 0x14, 0x0C, 0xD9, 0x43, 0x09, 0x8B, 0x28, 0x2A, 0x92, 0x74, 0xEA, 0x6F, 0xCF,
-    0xC5, 0x32, 0x2A, 0x24, 0x12, 0x69, 0xE0, 0xA1, 0x80, 0x88, 0xE1, 0x21, 0x47, 0xE8, 0xC2, 0x8D,
-    0x3E, 0xAF, 0x19, 0x9D, 0xB3, 0xCF, 0x7E, 0x5F, 0x9F, 0x15, 0x2D, 0x51, 0x8C, 0xE2, 0xC5, 0x50,
-    0xC5, 0x41, 0x14, 0x05, 0x51, 0x0C, 0x44, 0x11, 0x10, 0xC5, 0x3F, 0x0C, 0xFD, 0x50, 0xEC, 0xC3,
-    0x90, 0x0F, 0xAC, 0xE3, 0x9B, 0xD6, 0x25, 0xBB, 0xA6, 0x75, 0x69, 0x6F, 0x5A, 0x17, 0x02, 0x21,
-    0xB4, 0xE7, 0xCF, 0x4E, 0x92, 0x8E, 0x60, 0x07, 0xA1, 0x0E, 0x02, 0x1D, 0x84, 0x39, 0x08, 0x72,
-    0x28, 0xC4, 0x41, 0x80, 0xE3, 0x00, 0x77, 0x3C, 0x92, 0xD0, 0x16, 0xE6, 0x1A, 0x86, 0x7A, 0x48,
-    0x6D, 0x3E, 0xB8, 0x37, 0xB0, 0x04, 0x56, 0xD9, 0x1C, 0xBA, 0x28, 0x96, 0x81, 0xEA, 0x37, 0x43,
-    0x10, 0xE3, 0x35, 0xD1, 0x82, 0x41, 0xA0, 0xF8, 0x62, 0x4B, 0x18, 0x9F, 0xEA, 0x0E, 0xE9, 0x7E,
-    0x2A, 0xBF, 0xFE, 0xCC, 0x1B, 0x29, 0xE7, 0x42, 0xBE, 0xE3, 0xDE, 0x7A, 0x29, 0x9A, 0xB1, 0x29,
-    0x41, 0xA8, 0x4D, 0x83, 0x56, 0x78, 0x8C, 0x50, 0x07, 0x2D, 0x57, 0xB6, 0xBA, 0xBB, 0xFA, 0xD1,
-    0xE1, 0xD2, 0x15, 0xA0, 0xAF, 0x96, 0x31, 0x7A, 0xC1, 0x88, 0x66, 0xAF, 0x98, 0x92, 0xDE, 0x62,
-    0xEC, 0x5F, 0xCC, 0x13, 0x20, 0x4A, 0x55, 0xD9, 0x9B, 0xD6, 0x48, 0xCD, 0x54, 0x59, 0xDD, 0x59,
-    0x25, 0x45, 0xE2, 0xEF, 0x2E, 0x5D, 0xF9, 0x8F, 0x40, 0x42, 0xAE, 0x0D, 0x44, 0xB3, 0x69, 0xFA,
-    0xAA, 0xAD, 0x24, 0x35, 0xAD, 0x74, 0xCD, 0x5C, 0xB2, 0xD1, 0xA0, 0x4E, 0x61, 0xD9, 0xF9, 0x1D,
-    0x5F, 0x49, 0x8A, 0xB2, 0x72, 0x16, 0xD2, 0x6B, 0x9B, 0xEA, 0xDC, 0x0C, 0xC7, 0xBC, 0x4A, 0x4A,
-    0x7A, 0x57, 0xC2, 0xB4, 0x29, 0x1C, 0x1A, 0x0C, 0x2B, 0x27, 0xA2, 0x1A, 0x7F, 0xFC, 0x8E, 0xAF,
-    0x7E, 0xCF, 0x40, 0x28, 0x3A, 0xD5, 0xD4, 0x5E, 0xBC, 0xB9, 0xBF, 0x58, 0x3C, 0xEC, 0x10, 0x7B,
-    0x0D, 0x88, 0xD8, 0x88, 0x64, 0x23, 0x24, 0x6D, 0x01, 0x1B, 0xB6, 0x72, 0x64, 0x59, 0xC7, 0xFE,
-    0x53, 0x44, 0xBC, 0x70, 0x31, 0x0C, 0xB2, 0xAB, 0xCD, 0x86, 0x44, 0xB3, 0xD9, 0x89, 0x82, 0xF4,
-    0xED, 0xAD, 0x26, 0xFC, 0xFD, 0x81, 0x63, 0x6E, 0xA9, 0x9D, 0x30, 0x4E, 0xE9, 0xA6, 0xED, 0xB6,
-    0x19, 0xB5, 0xE3, 0x5B, 0x31, 0xE2, 0x6B, 0x1D, 0xFB, 0x3C, 0x71, 0x5F, 0xFC, 0x57, 0xB9, 0xBB,
-    0x4D, 0x94, 0xFC, 0xC6, 0x44, 0x79, 0xB1, 0xF1, 0x50, 0x50, 0xDD, 0x44, 0x95, 0xB5, 0xDB, 0xF4,
-    0x7F, 0xBA, 0x81, 0x8E, 0xF5, 0xBB, 0xC9, 0x66, 0xD8, 0xD8, 0x97, 0x2E, 0xBF, 0x2B, 0xAA, 0x3B,
-    0x82, 0x9A, 0xF6, 0xAA, 0x8E, 0x0A, 0xA2, 0xA9, 0xD3, 0x0C, 0xCB, 0x3C, 0xFC, 0x37, 0x68, 0xEE,
-    0x05, 0xAB, 0x2E, 0xB8, 0x9B, 0xDB, 0x44, 0xE8, 0x3E, 0xA6, 0x3F, 0xC6, 0x0D, 0xFC, 0x35, 0x3A,
-    0xA5, 0xA3, 0xC0, 0x8C, 0x03, 0x33, 0x09, 0x4C, 0x1C, 0x98, 0xA4, 0x0D, 0x08, 0x76, 0x63, 0x38,
-    0x4F, 0x51, 0x19, 0x53, 0xAE, 0x8D, 0xF1, 0x2B, 0x65, 0x44, 0x41, 0xBA, 0x1F, 0x88, 0xC2, 0x12,
-    0x9A, 0x09, 0x84, 0x2A, 0x64, 0xE2, 0xCE, 0x98, 0xA4, 0x35, 0x46, 0xA4, 0x90, 0x76, 0xE8, 0x9A,
-    0x82, 0x3E, 0x16, 0x13, 0xB6, 0xA1, 0x7F, 0xAD, 0xB3, 0xFE, 0xA9, 0x25, 0x11, 0x25, 0xB6, 0x86,
-    0x19, 0xF2, 0x5E, 0x48, 0x44, 0x26, 0xDD, 0x62, 0x71, 0x8E, 0x1B, 0xE2, 0x82, 0x2B, 0x88, 0x96,
-    0x0C, 0x10, 0xE1, 0x24, 0x64, 0x90, 0x12, 0x1D, 0xC5, 0x81, 0x4E, 0x72, 0xB5, 0x88, 0x7B, 0x5A,
-    0x59, 0x04, 0xC3, 0x34, 0xE2, 0xA1, 0x3F, 0x8F, 0x44, 0x93, 0x72, 0xFF, 0x0D, 0xD0, 0x37, 0x48,
-    0x45, 0x3A, 0xB7, 0x52, 0x31, 0xA9, 0x4A, 0xE5, 0x3E, 0x8D, 0xCC, 0x79, 0x89, 0xDB, 0x13, 0xD3,
-    0x29, 0xA7, 0x2E, 0x02, 0xB9, 0x0E, 0xEA, 0xED, 0xC4, 0xA4, 0x46, 0x7A, 0xBC, 0x9F, 0x5A, 0x9B,
-    0xFA, 0x4F, 0x30, 0x46, 0x0F, 0x55, 0x37, 0xBA, 0x85, 0x6A, 0x5B, 0x33, 0x67, 0x8F, 0x96, 0x20,
-    0x5C, 0xD1, 0x02, 0x48, 0x8E, 0x7E, 0x9C, 0xE9, 0x69, 0x8D, 0x28, 0x1F, 0x80, 0x7A, 0x23, 0xD7,
-    0x59, 0x81, 0x8F, 0xC4, 0x27, 0x3A, 0x44, 0xBA, 0x09, 0x19, 0xD5, 0x83, 0x41, 0xC7, 0xCF, 0xFC,
-    0xA5, 0x2E, 0x5E, 0xA6, 0x67, 0xB4, 0xF1, 0x21, 0xF0, 0x5C, 0x50, 0x1F, 0x35, 0x32, 0x0B, 0x89,
-    0x2E, 0x4F, 0xC3, 0x5D, 0x0D, 0xC7, 0x2A, 0xDA, 0x01, 0x30, 0x2F, 0x0B, 0x2C, 0xF2, 0x5C, 0x5D,
-    0xFB, 0x9B, 0x85, 0x2C, 0x40, 0xEC, 0x83, 0x45, 0x85, 0x13, 0x16, 0xFE, 0x2A, 0x2F, 0x98, 0xFF,
-    0xC3, 0x9A, 0x42, 0x93, 0x32, 0x31, 0x38, 0x8F, 0x51, 0xDE, 0x50, 0xF1, 0xB6, 0x65, 0xA5, 0xD3,
-    0xAC, 0xD2, 0x2E, 0x55, 0x1A, 0x62, 0x33, 0x58, 0xF7, 0x84, 0x14, 0x15, 0x2D, 0x98, 0x5E, 0x46,
-    0xCC, 0x6E, 0x11, 0x98, 0xF6, 0x5F, 0x78, 0xCB, 0x69, 0x69, 0xFE, 0x28, 0x65, 0x26, 0x2B, 0x0B,
-    0x21, 0x33, 0x28, 0x53, 0x57, 0x05, 0x93, 0x52, 0x43, 0xAA, 0xB9, 0x29, 0x3D, 0x26, 0xE5, 0xBF,
-    0xC4, 0x7F, 0xD2, 0x5F, 0x47, 0xAE, 0xFC, 0x29, 0x36, 0x68, 0xFF, 0x03, 0xA1, 0x87, 0x0F, 0x14,
-    0x0D, 0x8D, 0x0D, 0x97, 0xD0, 0x0E, 0x1A, 0x7D, 0xC3, 0xCD, 0xCE, 0xBA, 0xE3, 0xF8, 0xDC, 0x95,
-    0x2D, 0xCF, 0xD5, 0xFD, 0x94, 0x30, 0x8D, 0x0C, 0x2D, 0x3A, 0x23, 0x3A, 0x70, 0x9F, 0x90, 0x48,
-    0x2C, 0x06, 0x0A, 0xA0, 0x33, 0xE6, 0x41, 0xA4, 0x29, 0x9E, 0xC2, 0xCA, 0x2A, 0x96, 0x37, 0xC0,
-    0x10, 0xEA, 0x49, 0xD5, 0xA4, 0x5A, 0xA2, 0x92, 0x54, 0x47, 0xAA, 0x22, 0xD5, 0x90, 0x2A, 0x48,
-    0xF5, 0xA3, 0xEA, 0x51, 0xED, 0x94, 0x9A, 0x2E, 0xA1, 0x36, 0x6E, 0xD3, 0xB2, 0x8E, 0x16, 0x42,
-    0x1B, 0x96, 0x3D, 0xB4, 0xA0, 0xB0, 0x77, 0x45, 0x85, 0xAB, 0x15, 0x15, 0x51, 0x8F, 0x6A, 0xEA,
-    0x2F, 0xBF, 0xAF, 0x7B, 0xB9, 0x25, 0x6B, 0x2B, 0x53, 0x87, 0x69, 0x03, 0xBD, 0x45, 0x88, 0xFD,
-    0xBE, 0x38, 0x75, 0x69, 0x05, 0x0F, 0x8D, 0x40, 0x34, 0x7C, 0x0A, 0x62, 0xEC, 0xCD, 0x10, 0x34,
-    0xA0, 0xCE, 0xA0, 0xB2, 0x11, 0x34, 0x46, 0x1B, 0x12, 0x43, 0xDA, 0x89, 0x68, 0xC0, 0x53, 0x5B,
-    0x54, 0x07, 0xE1, 0x8D, 0xBD, 0xA4, 0x55, 0x32, 0xF5, 0x29, 0x2C, 0xB5, 0x8C, 0xBD, 0xF0, 0x54,
-    0x14, 0xFB, 0x27, 0x43, 0xFA, 0x0D, 0x34, 0x28, 0xFA, 0x8C, 0x8E, 0x75, 0x63, 0x20, 0xE9, 0x7E,
-    0x1F, 0x50, 0x73, 0x7C, 0xF5, 0x37, 0xBE, 0xA5, 0x66, 0xA8, 0x18, 0x7A, 0x3B, 0xD1, 0x43, 0x51,
-    0x0B, 0x01, 0x02, 0x38, 0x67, 0x29, 0xBC, 0x3E, 0x40, 0x04, 0x06, 0xC4, 0x10, 0x82, 0xB4, 0x21,
-    0x0C, 0x80, 0x8F, 0xA2, 0x22, 0x5E, 0x54, 0x11, 0x6D, 0xAA, 0x80, 0xCE, 0x08, 0x95, 0xCE, 0x63,
-    0xA7, 0xC1, 0xEC, 0x45, 0xD2, 0xB8, 0xAC, 0x58, 0xA7, 0x53, 0x01, 0x34, 0x2F, 0x29, 0x55, 0x71,
-    0x2A, 0xE5, 0x3A, 0xE5, 0xFF, 0x40, 0xD1, 0xE5, 0x17, 0xDC, 0x99, 0xBC, 0xD1, 0x55, 0x98, 0x4D,
-    0x25, 0x8D, 0x4C, 0xB9, 0xD1, 0xE3, 0xF5, 0x5C, 0x2C, 0x8C, 0xB2, 0x62, 0xB5, 0x4F, 0x85, 0x72,
-    0x82, 0x70, 0x17, 0xA8, 0x59, 0xA8, 0xC8, 0xA1, 0x44, 0x46, 0x3A, 0xEF, 0xFB, 0x33, 0xF6, 0x6B,
-    0x62, 0x81, 0x4E, 0xD1, 0x40, 0x98, 0x41, 0xC2, 0x71, 0x13, 0x85, 0x17, 0x98, 0x79, 0x72, 0x86,
-    0x0A, 0x0E, 0x71, 0x41, 0xD6, 0xC2, 0x3C, 0x78, 0x7C, 0x1E, 0xEE, 0x09, 0xCD, 0xC1, 0x8C, 0x39,
-    0xE1, 0x44, 0xF3, 0xC1, 0x05, 0x73, 0xC1, 0x5A, 0xAD, 0xD2, 0x68, 0xE2, 0xB7, 0xA1, 0x32, 0xB2,
-    0x9A, 0xA0, 0x7F, 0x56, 0x73, 0xDA, 0x67, 0xFF, 0xCB, 0x3E, 0x65, 0xD7, 0x5A, 0x3F, 0xA1, 0x3D,
-    0xCC, 0x74, 0xDF, 0xCF, 0xD4, 0xA2, 0x67, 0x50, 0xB5, 0x9E, 0x9E, 0x0F, 0x2E, 0x66, 0x97, 0xA6,
-    0x8B, 0xAA, 0xE9, 0xEA, 0xC1, 0xDD, 0xA7, 0xDB, 0x6A, 0x90, 0xD7, 0x1B, 0x4C, 0x0C, 0x7E, 0x94,
-    0xBA, 0x89, 0xB1, 0xC2, 0x43, 0xA9, 0x0E, 0x2E, 0xB3, 0xE6, 0x7A, 0xAE, 0x40, 0xEA, 0x5C, 0xB7,
-    0xA9, 0xB9, 0x15, 0xCD, 0xBC, 0x7C, 0x50, 0x51, 0xE3, 0xB7, 0x92, 0x3D, 0x69, 0xB7, 0xA3, 0x31,
-    0xEA, 0xFF, 0x85, 0x93, 0x51, 0xB3, 0xBA, 0xA4, 0x6F, 0x9F, 0x3F, 0xC1, 0xC9, 0xB4, 0xDF, 0xEE,
-    0x84, 0x66, 0x47, 0x9B, 0x1D, 0xCD, 0xAE, 0x87, 0x9A, 0x4D, 0x4D, 0xCF, 0x57, 0xF3, 0x01, 0x44,
-    0x1E, 0xE6, 0xF4, 0x22, 0xEF, 0x3D, 0xB5, 0xC2, 0xB2, 0x11, 0x5B, 0x3A, 0xF4, 0xE0, 0x5E, 0xB6,
-    0xF6, 0x97, 0x4F, 0xAF, 0xFD, 0x37, 0x2F, 0xDC, 0xDB, 0x17, 0x13, 0xB1, 0x68, 0xCB, 0xC8, 0xFF,
-    0x13, 0xC2, 0x1D, 0x5C, 0x8A, 0xB1, 0x63, 0x0C, 0x11, 0x46, 0x61, 0x70, 0xD8, 0x0A, 0x6B, 0x90,
-    0xA6, 0x27, 0xFC, 0x2F, 0x8B, 0xAA, 0x80, 0x23, 0xB0, 0x96, 0x8C, 0x9A, 0x5A, 0xEF, 0x7C, 0x85,
-    0x0D, 0x8B, 0x85, 0x38, 0x14, 0x08, 0xCF, 0x38, 0x7A, 0x87, 0x73, 0xAB, 0xD8, 0x68, 0x31, 0x97,
-    0x55, 0xC6, 0x91, 0x24, 0xDD, 0x39, 0x36, 0x8E, 0xEE, 0xF8, 0xD0, 0xB3, 0x52, 0xA3, 0xA6, 0x2A,
-    0x19, 0xFC, 0xDF, 0xA3, 0x1A, 0x0F, 0x4E, 0x42, 0x9F, 0x37, 0xD6, 0x67, 0xCD, 0x0E, 0xEF, 0xEB,
-    0xB3, 0xA8, 0x66, 0x76, 0xBC, 0xDB, 0xE7, 0xC6, 0xFA, 0x4C, 0x93, 0xC6, 0xF4, 0x2A, 0xA6, 0x15,
-    0x2D, 0x1B, 0x2B, 0xB3, 0x92, 0x2E, 0xEC, 0xE6, 0xE6, 0x9F, 0x69, 0xC7, 0x97, 0xB6, 0x5B, 0x4C,
-    0x28, 0xB8, 0xB2, 0xED, 0x63, 0xF4, 0x3E, 0x50, 0x27, 0x49, 0xF5, 0x87, 0x47, 0x72, 0xC1, 0xC6,
-    0x7F, 0xF2, 0xD0, 0xAA, 0x91, 0xD8, 0x7B, 0xC4, 0x13, 0x12, 0x81, 0x74, 0x73, 0x66, 0x8D, 0xB0,
-    0x4D, 0x60, 0x8F, 0x98, 0x68, 0x20, 0x32, 0xE7, 0xD6, 0x10, 0xF6, 0x05, 0x64, 0x8B, 0xE0, 0x27,
-    0x3F, 0xAF, 0x8F, 0x2C, 0xAB, 0x4F, 0xE9, 0x58, 0x54, 0x4E, 0xD1, 0x82, 0x9C, 0x26, 0xFD, 0xFF,
-    0x6B, 0xF3, 0xBE, 0x7E, 0x6D, 0x9E, 0x55, 0xE1, 0x59, 0x9C, 0xD4, 0x0D, 0x42, 0xBA, 0xF5, 0x96,
-    0x6D, 0xB7, 0x6C, 0xD7, 0x97, 0x29, 0x7F, 0x2B, 0xAB, 0xF0, 0xDC, 0xAD, 0x6A, 0x93, 0xAF, 0xCD,
-    0x7E, 0xEB, 0xAA, 0xF0, 0xE0, 0x42, 0x7E, 0xD0, 0x63, 0xBE, 0xBC, 0xAB, 0x55, 0xF4, 0x30, 0xE6,
-    0x75, 0x69, 0x75, 0xA3, 0x1A, 0xF9, 0x35, 0x09, 0x70, 0xE0, 0x51, 0x5D, 0x38, 0x35, 0x1F, 0x2A,
-    0x35, 0xEE, 0x19, 0xEB, 0x80, 0xE9, 0xF6, 0x6E, 0xC9, 0x2B, 0x19, 0xE0, 0x14, 0x95, 0x29, 0x81,
-    0xD1, 0xC1, 0xFC, 0xA9, 0x18, 0xD9, 0xBF, 0x94, 0x19, 0x59, 0x70, 0xB1, 0xCB, 0x7C, 0x3E, 0xFB,
-    0x6B, 0x65, 0x68, 0xA9, 0x9F, 0xC0, 0x7C, 0x3E, 0x7B, 0xE7, 0x71, 0xD7, 0xD9, 0xCF, 0x2C, 0xC7,
-    0x81, 0x11, 0x6B, 0x58, 0x42, 0x23, 0x75, 0xC2, 0x48, 0x27, 0xD2, 0x85, 0xA3, 0x21, 0x13, 0x23,
-    0x2F, 0xE8, 0x8C, 0x61, 0x11, 0xF0, 0x0E, 0x4B, 0x1C, 0x6C, 0x01, 0x8F, 0x02, 0x30, 0x03, 0x70,
-    0x54, 0x78, 0x84, 0xBF, 0xE6, 0x91, 0x9F, 0xC1, 0xF6, 0x89, 0x89, 0x94, 0xB5, 0x57, 0xE2, 0xF1,
-    0x03, 0x09, 0xBB, 0x58, 0x14, 0x45, 0x67, 0xA8, 0xA4, 0x33, 0x44, 0x63, 0xAE, 0x81, 0xD5, 0x96,
-    0x4E, 0xBD, 0x06, 0x5C, 0xA0, 0x49, 0xB7, 0x0D, 0xFD, 0xCA, 0x96, 0x48, 0x48, 0xCD, 0xD0, 0xAF,
-    0x62, 0xF8, 0x86, 0x90, 0x0D, 0xA6, 0xB4, 0xBC, 0x86, 0x1F, 0x53, 0x32, 0xD2, 0x0F, 0x41, 0xDF,
-    0x86, 0x3E, 0x2B, 0xD6, 0x47, 0x79, 0xB9, 0x9D, 0xC7, 0x4F, 0x4B, 0xDD, 0xE1, 0x62, 0xAE, 0x78,
-    0xDA, 0x7A, 0x08, 0xC9, 0x18, 0xDA, 0x36, 0xF6, 0xA1, 0x6A, 0xFE, 0xE6, 0x43, 0x00, 0x56, 0xFE,
-    0x66, 0xB5, 0x6F, 0x56, 0xF8, 0x66, 0x55, 0x6F, 0x56, 0xF2, 0x66, 0xF5, 0x6E, 0x56, 0xEC, 0x66,
-    0x95, 0x6E, 0x56, 0xE6, 0x66, 0x35, 0x6E, 0x56, 0xE0, 0x66, 0xD5, 0x6D, 0x56, 0xDA, 0x66, 0x75,
-    0x6D, 0x56, 0xD4, 0x66, 0x15, 0x6D, 0x56, 0xCE, 0x66, 0xB5, 0x6C, 0x56, 0xC8, 0x66, 0x55, 0x6C,
-    0x56, 0xC2, 0x66, 0xF5, 0x6B, 0x56, 0xBC, 0x66, 0x95, 0x6B, 0x56, 0xB6, 0x66, 0x35, 0x6B, 0x56,
-    0xB0, 0xE6, 0x4E, 0xDF, 0x57, 0xBB, 0x45, 0x84, 0x16, 0x4B, 0x70, 0x19, 0x52, 0x95, 0xCC, 0x11,
-    0x84, 0xD5, 0xC8, 0xDA, 0x31, 0x16, 0x8E, 0xB1, 0x6A, 0x8C, 0xE8, 0x21, 0xEB, 0xC5, 0x58, 0x2C,
-    0xC6, 0x4A, 0x31, 0x96, 0x89, 0xB1, 0x36, 0x4C, 0xC9, 0xB3, 0xE5, 0x5B, 0x42, 0x6F, 0x82, 0xFC,
-    0x47, 0x3A, 0x01, 0x27, 0xCD, 0x30, 0xB4, 0x9E, 0x6E, 0xCC, 0x75, 0xE5, 0x6F, 0xC5, 0x43, 0xFA,
-    0xF8, 0x3F, 0x9D, 0x52, 0x6F, 0x3F, 0x99, 0xB0, 0xF9, 0x07, 0x0D, 0xF0, 0x0C, 0x0B, 0xB7, 0xA6,
-    0xDC, 0xC5, 0xC2, 0xAD, 0x20, 0xF8, 0xA1, 0x62, 0xE1, 0x89, 0x46, 0x47, 0x8F, 0xC1, 0xC2, 0xE7,
-    0x5B, 0x2C, 0xBC, 0x72, 0x44, 0x19, 0x0C, 0x0B, 0xBF, 0x5A, 0x6C, 0xB1, 0x70, 0x03, 0xC1, 0xAD,
-    0x99, 0xAA, 0x23, 0x30, 0x00, 0xC1, 0xC5, 0x13, 0x4A, 0x6F, 0x81, 0xE0, 0xE3, 0x1B, 0xF9, 0x0B,
-    0x8D, 0x3B, 0xB9, 0x89, 0xC0, 0x28, 0xBA, 0x6E, 0x9B, 0xB5, 0x63, 0xE9, 0x0F, 0x3C, 0x2A, 0xE4,
-    0x2A, 0xE3, 0x65, 0x4F, 0x7E, 0xC6, 0xD4, 0x65, 0x13, 0xE6, 0xEE, 0x69, 0xFE, 0x2C, 0xC0, 0xB8,
-    0xFF, 0xFA, 0xC0, 0xB8, 0x1B, 0xD9, 0x03, 0x4B, 0x21, 0x76, 0x36, 0xBF, 0xDB, 0x85, 0x32, 0x26,
-    0x4A, 0xDF, 0xF0, 0x84, 0x51, 0xF8, 0x25, 0x3A, 0xB9, 0x99, 0x83, 0xFA, 0xF6, 0x41, 0xE5, 0xB6,
-    0x10, 0xFB, 0x08, 0xAE, 0x4F, 0x42, 0x07, 0xFF, 0x27, 0xB1, 0x05, 0x50, 0x58, 0x59, 0xCB, 0xD1,
-    0x8E, 0xC0, 0x5E, 0x3F, 0xE8, 0xFC, 0x4D, 0xC6, 0xDE, 0x61, 0xAD, 0x6B, 0x5A, 0xDB, 0xA9, 0x24,
-    0xCC, 0xD4, 0xDA, 0xD3, 0x49, 0xDB, 0xE7, 0x97, 0xD6, 0xC4, 0x29, 0x7E, 0x6B, 0xF2, 0x6C, 0x55,
-    0x1F, 0xF5, 0x00, 0xA7, 0x78, 0x68, 0x38, 0x05, 0x31, 0x6B, 0x4C, 0xFC, 0x9C, 0x99, 0x66, 0xE2,
-    0x14, 0xF1, 0x35, 0x71, 0x8A, 0xE4, 0x77, 0xC4, 0x29, 0xB2, 0x9F, 0x53, 0xFA, 0xFE, 0xBB, 0x68,
-    0xA2, 0x8E, 0xC8, 0xC4, 0xB8, 0x25, 0x4E, 0x11, 0xD7, 0xFC, 0x5F, 0xB2, 0x26, 0x4E, 0x91, 0x2D,
-    0x89, 0x53, 0xD0, 0x27, 0x2E, 0x36, 0x1D, 0x71, 0x0A, 0x2E, 0xED, 0x79, 0xAA, 0xCF, 0xDA, 0x25,
-    0x72, 0x99, 0x5B, 0x38, 0xC5, 0x48, 0x03, 0x83, 0xB1, 0x3E, 0x4B, 0x16, 0x5F, 0x31, 0xC0, 0x1D,
-    0x55, 0x3A, 0xD1, 0xFB, 0xB4, 0x36, 0xB7, 0x1B, 0x22, 0x71, 0x56, 0xC4, 0x5B, 0x54, 0x7D, 0x3E,
-    0x7F, 0xAC, 0xCF, 0x25, 0x1C, 0x0F, 0x21, 0x9A, 0xF7, 0xF8, 0x98, 0x9A, 0x6F, 0xB8, 0xA4, 0xEB,
-    0x1E, 0x82, 0xB8, 0x56, 0x08, 0x82, 0xA5, 0xBB, 0xF2, 0x8B, 0xC3, 0x96, 0x01, 0x88, 0x5E, 0x46,
-    0x9C, 0x17, 0x75, 0xF2, 0x11, 0x68, 0xF6, 0xA1, 0x08, 0xA1, 0xC6, 0x33, 0x83, 0xD9, 0x65, 0x07,
-    0x68, 0xC2, 0xB7, 0xA4, 0x35, 0x0C, 0x93, 0x5F, 0x27, 0xDE, 0x9E, 0xF4, 0x9B, 0xF4, 0xDD, 0xD7,
-    0xBC, 0xC1, 0xDC, 0x4D, 0xAF, 0xE1, 0x54, 0x46, 0xEB, 0xED, 0x7C, 0x1B, 0x2D, 0xFE, 0x6A, 0xC1,
-    0x7E, 0x7E, 0xA8, 0x15, 0xDC, 0x2B, 0xF5, 0x29, 0x2B, 0xCE, 0xCC, 0x69, 0x93, 0x70, 0x10, 0xED,
-    0xB8, 0xD1, 0x14, 0xDD, 0xF1, 0xDD, 0xC8, 0x4F, 0x9E, 0x5E, 0x88, 0xB6, 0x58, 0x7C, 0x18, 0x37,
-    0xB2, 0x3B, 0x4E, 0x36, 0x31, 0xD4, 0x00, 0x00, 0x26, 0x43, 0x1A, 0xF9, 0xA0, 0x5F, 0x8F, 0x2F,
-    0x38, 0x17, 0x39, 0xB5, 0xBD, 0x92, 0x42, 0x1C, 0xF5, 0x08, 0x1F, 0xE5, 0x25, 0x32, 0x41, 0x23,
-    0x96, 0x4C, 0x97, 0xD1, 0xD1, 0x1D, 0x49, 0x15, 0x47, 0x25, 0x83, 0xCD, 0x96, 0x20, 0x19, 0x8D,
-    0xF1, 0x5C, 0xF6, 0x92, 0x74, 0x39, 0x96, 0xD5, 0xB0, 0x92, 0x25, 0x13, 0xE5, 0x2F, 0xA3, 0xC2,
-    0xF9, 0x2B, 0x4E, 0x10, 0x86, 0x67, 0xB8, 0x51, 0xB5, 0x4B, 0xD6, 0x94, 0xE8, 0x7E, 0x92, 0x33,
-    0x65, 0x8A, 0x18, 0xEE, 0x06, 0x91, 0xDD, 0xE9, 0x4B, 0x4E, 0x23, 0x59, 0x2C, 0x2E, 0xF6, 0xDC,
-    0xAD, 0x3A, 0xFD, 0x67, 0x76, 0x17, 0xB1, 0xFC, 0x8D, 0xEE, 0x16, 0xBB, 0xF3, 0x99, 0xC2, 0x4E,
-    0x03, 0x5A, 0x06, 0x49, 0x4A, 0xA8, 0xF7, 0x5E, 0xD9, 0xE0, 0x01, 0x61, 0xEC, 0xBC, 0xF1, 0x86,
-    0x3B, 0x48, 0x86, 0xED, 0x23, 0x63, 0x09, 0xCB, 0x96, 0x34, 0x21, 0xA9, 0xA1, 0x90, 0x1A, 0xB1,
-    0x40, 0x6C, 0x13, 0xB4, 0x32, 0x23, 0xCE, 0x85, 0xC2, 0xCA, 0xBC, 0xCF, 0x15, 0x1D, 0x13, 0x27,
-    0x53, 0x34, 0x26, 0x11, 0x0A, 0xD1, 0x8F, 0x36, 0x5D, 0x8F, 0xDA, 0x6C, 0xEE, 0x36, 0x47, 0x96,
-    0xEC, 0x97, 0xA3, 0xBB, 0x52, 0xF7, 0xB6, 0xF0, 0xE9, 0xCA, 0xC1, 0x83, 0xBD, 0xFD, 0x47, 0x83,
-    0x83, 0x76, 0xE7, 0xF3, 0xF9, 0xEC, 0x64, 0xEF, 0xB1, 0xF8, 0x5C, 0x2D, 0x16, 0x37, 0xAE, 0xEB,
-    0xBF, 0xF2, 0x34, 0x7B, 0xA1, 0x12, 0x0A, 0xD3, 0x6C, 0x8D, 0xCA, 0xF4, 0x2F, 0xB3, 0x43, 0xE5,
-    0x6E, 0x29, 0x05, 0x1E, 0xB5, 0x66, 0x42, 0x98, 0xA0, 0xC7, 0x37, 0x4E, 0x26, 0x58, 0xEB, 0x85,
-    0xC9, 0x60, 0x70, 0xDF, 0xFB, 0x17, 0xE2, 0x10, 0xA6, 0x8D, 0x6C, 0x6C, 0x71, 0x9B, 0xD6, 0x56,
-    0x78, 0xE4, 0xE1, 0xF9, 0x65, 0xCB, 0x12, 0x46, 0xE9, 0x20, 0x18, 0x24, 0x42, 0xBB, 0x0A, 0xD9,
-    0x3D, 0x57, 0x72, 0xF6, 0x88, 0x35, 0xD8, 0x09, 0x1E, 0x94, 0x03, 0xA8, 0x31, 0x9F, 0x56, 0xB2,
-    0xAB, 0xD7, 0x6F, 0x59, 0xB5, 0x4D, 0x0A, 0x47, 0xCD, 0x3E, 0xC2, 0xCB, 0xEE, 0xBF, 0x79, 0xCC,
-    0x94, 0x79, 0xBA, 0x4F, 0xA4, 0x00, 0xDA, 0x3C, 0x1B, 0x5C, 0xDF, 0x9D, 0xFD, 0x17, 0x6C, 0x21,
-    0xCA, 0xC4, 0x70, 0xAF, 0x2A, 0x3B, 0x9F, 0x34, 0x85, 0x8B, 0x9A, 0xD0, 0x17, 0xAE, 0x08, 0xB8,
-    0xCD, 0xDF, 0xE0, 0x67, 0xB4, 0xE0, 0x33, 0xEB, 0xFD, 0xE6, 0xFD, 0xCB, 0xB0, 0x79, 0xB3, 0x32,
-    0xB7, 0x4E, 0xD6, 0x5A, 0x2C, 0x56, 0xDF, 0xDA, 0xBC, 0xEF, 0xC0, 0x83, 0x04, 0x9C, 0x8C, 0x3A,
-    0x1B, 0x25, 0xB8, 0x45, 0x65, 0xFE, 0xD8, 0x33, 0xC8, 0xF5, 0x7F, 0xC1, 0xB0, 0x73, 0x59, 0xE4,
-    0x3B, 0x53, 0xF2, 0x55, 0x78, 0x90, 0xE0, 0xC6, 0x0E, 0x3F, 0xD6, 0xCA, 0x99, 0x69, 0xBF, 0xC3,
-    0x77, 0x83, 0x1D, 0x7E, 0x27, 0x28, 0xB8, 0x03, 0xFA, 0x92, 0x31, 0xAC, 0x39, 0xD8, 0x4E, 0xD3,
-    0x54, 0xF3, 0x80, 0xF8, 0x88, 0xD7, 0xBD, 0x46, 0x22, 0x0C, 0x09, 0xBF, 0xE3, 0x81, 0x93, 0xFC,
-    0x0A, 0xE8, 0x8B, 0xF6, 0xD9, 0x9E, 0x1F, 0xA6, 0x85, 0x56, 0x13, 0x2D, 0xFD, 0x61, 0xB2, 0x2E,
-    0x9B, 0x97, 0x6E, 0x68, 0xA5, 0xB1, 0x6F, 0x9C, 0x6B, 0x0E, 0x2E, 0x37, 0xCC, 0x96, 0xC9, 0x2C,
-    0x97, 0x31, 0x98, 0xC9, 0xF8, 0x9A, 0x07, 0xA1, 0x49, 0x17, 0x2A, 0x6F, 0x7A, 0xAA, 0xDF, 0x6F,
-    0x78, 0x4C, 0xCB, 0xE3, 0xEB, 0xC1, 0x15, 0x78, 0x35, 0xE4, 0xF1, 0xE5, 0x7B, 0xEC, 0x2E, 0xFA,
-    0x86, 0x0F, 0xBE, 0x9F, 0xA4, 0x8D, 0x14, 0x01, 0x47, 0x18, 0xD4, 0xDA, 0xBF, 0xD4, 0xAE, 0x9F,
-    0x73, 0xD4, 0xCB, 0x0C, 0x18, 0xC6, 0x9A, 0xF9, 0x99, 0xDA, 0x76, 0x9C, 0x27, 0x7B, 0x0A, 0x33,
-    0x77, 0xB6, 0x8C, 0x24, 0xA2, 0x12, 0xF2, 0x03, 0x90, 0xCF, 0x40, 0x3C, 0xC9, 0xC7, 0x39, 0x5F,
-    0x1E, 0x11, 0x85, 0x2C, 0x91, 0x90, 0xD5, 0x33, 0x13, 0x77, 0xC8, 0xC2, 0xA5, 0x42, 0x2F, 0xA6,
-    0xCF, 0x9E, 0x70, 0x77, 0x6B, 0x90, 0x21, 0x8D, 0x65, 0xFC, 0x39, 0xBC, 0xDD, 0x83, 0xC1, 0xAB,
-    0x29, 0x98, 0xA9, 0xB4, 0x02, 0x63, 0x7D, 0x6D, 0x0A, 0xC0, 0xF1, 0xAB, 0xD2, 0x8A, 0xAB, 0xF8,
-    0xF6, 0x91, 0xA2, 0xB1, 0xCC, 0xC0, 0x96, 0xEA, 0xF7, 0x35, 0x8F, 0xA9, 0x78, 0xFC, 0x6A, 0x7B,
-    0x85, 0xBE, 0x5C, 0x19, 0xFE, 0x22, 0x1C, 0x5D, 0x4D, 0x6D, 0x69, 0x9A, 0x65, 0xC2, 0x7C, 0x8A,
-    0xBD, 0x46, 0x46, 0xFF, 0x95, 0x7A, 0xFD, 0x0D, 0x68, 0xE2, 0x35, 0xE9, 0x32, 0xB7, 0x2C, 0xCC,
-    0xEE, 0xA6, 0xB4, 0xC6, 0xA6, 0x24, 0x2B, 0xA4, 0x3E, 0xB1, 0x8D, 0xE0, 0x28, 0xBF, 0x27, 0xD1,
-    0x55, 0x59, 0x15, 0x1F, 0xF9, 0xAA, 0xB8, 0x96, 0x8F, 0xC7, 0xE7, 0xF2, 0xB8, 0x10, 0x35, 0x13,
-    0x89, 0x6F, 0x9E, 0x3E, 0x57, 0x78, 0xFF, 0xC1, 0xE9, 0x85, 0xD3, 0xC7, 0xDB, 0xDC, 0xA4, 0x8B,
-    0x99, 0x2B, 0x1D, 0x13, 0x73, 0x5A, 0xFA, 0xBE, 0x86, 0x3C, 0xCA, 0xFB, 0xE8, 0xFB, 0x75, 0xA9,
-    0x18, 0x5F, 0xBC, 0xB7, 0x3B, 0x5D, 0xDB, 0xB8, 0x0E, 0xD3, 0x35, 0x1F, 0x4E, 0xD7, 0x17, 0xFD,
-    0x1C, 0xCC, 0xD9, 0x23, 0x17, 0x9E, 0xFE, 0x4A, 0x68, 0x34, 0x32, 0xDA, 0xBD, 0x32, 0x9F, 0xCA,
-    0x30, 0xA1, 0x6C, 0x42, 0xAD, 0xC7, 0xAF, 0x5B, 0x7D, 0xFE, 0x3E, 0x27, 0x79, 0x73, 0xDB, 0x49,
-    0x7E, 0xE1, 0x4F, 0x1D, 0xF1, 0x85, 0x3D, 0xBA, 0xBD, 0xAC, 0xC7, 0x21, 0x83, 0xB3, 0x42, 0x35,
-    0xE2, 0x52, 0xB6, 0x80, 0x69, 0x7E, 0xC3, 0xF3, 0x4E, 0x55, 0x2F, 0x2C, 0x70, 0x20, 0x9C, 0xCF,
-    0x1C, 0xB4, 0x57, 0xC4, 0x8E, 0x66, 0x66, 0x69, 0xBF, 0x8F, 0xB6, 0x6F, 0x22, 0x28, 0x94, 0xFC,
-    0x3D, 0x05, 0x77, 0xF9, 0x8E, 0x5F, 0x03, 0x28, 0x5C, 0x82, 0xE4, 0x34, 0xBE, 0x5A, 0x24, 0xB6,
-    0xED, 0xD0, 0x68, 0x11, 0xC0, 0x2D, 0xA2, 0x3B, 0x93, 0x36, 0x3C, 0xA5, 0x1D, 0x57, 0x01, 0xE7,
-    0xBA, 0x27, 0xA6, 0x6D, 0xA4, 0x2F, 0x73, 0x92, 0x7E, 0xA4, 0xE0, 0xB2, 0xCD, 0x61, 0x8B, 0x5B,
-    0xBD, 0xA1, 0x2F, 0x5D, 0xC8, 0x18, 0x6A, 0x6B, 0x49, 0x84, 0x18, 0xA2, 0x31, 0x35, 0x52, 0x40,
-    0x39, 0x87, 0x9C, 0x5C, 0x1C, 0x09, 0xC3, 0x72, 0xB9, 0xD3, 0x9F, 0xB3, 0x1C, 0x13, 0xD6, 0x91,
-    0x05, 0x60, 0x99, 0xBE, 0x1F, 0x0A, 0x1B, 0xE9, 0xF6, 0xFD, 0x3D, 0xF4, 0x07, 0x19, 0xDC, 0x73,
-    0x9F, 0x22, 0x7C, 0x93, 0xAE, 0x43, 0xD1, 0xC9, 0x91, 0x55, 0x88, 0x20, 0x77, 0x16, 0x46, 0xB7,
-    0x4B, 0xC3, 0xDB, 0xA9, 0x5E, 0x2E, 0xDD, 0x29, 0xBC, 0xE3, 0xCB, 0x3C, 0x88, 0x9D, 0x33, 0xCD,
-    0x11, 0x92, 0x36, 0x0A, 0x2B, 0xAA, 0x3B, 0x75, 0x12, 0x4A, 0x84, 0x30, 0x4A, 0x38, 0xBF, 0x72,
-    0x48, 0xE4, 0x3F, 0x3E, 0x11, 0xCF, 0x0A, 0x31, 0x3E, 0x3F, 0x7F, 0xE2, 0xAF, 0xDE, 0x07, 0x96,
-    0xF1, 0xD5, 0x3E, 0x78, 0x42, 0xB8, 0xFE, 0x23, 0xA7, 0x99, 0x30, 0xC8, 0xBA, 0x55, 0x48, 0x7E,
-    0xB6, 0x55, 0x3E, 0x74, 0x0F, 0xD5, 0x43, 0xF3, 0x50, 0x3C, 0xF4, 0xBE, 0x85, 0x37, 0xEF, 0x85,
-    0xEC, 0xED, 0x2A, 0xF8, 0x00, 0x5C, 0x74, 0x49, 0xF7, 0x43, 0xF1, 0xD2, 0xE2, 0x73, 0x7B, 0x7B,
-    0xC0, 0x64, 0x40, 0x15, 0x1B, 0x4E, 0xB6, 0x8F, 0x6A, 0x9D, 0x61, 0x32, 0xA4, 0x03, 0xF3, 0xA2,
-    0x75, 0x7F, 0xE9, 0x23, 0xC0, 0xAC, 0xDF, 0x51, 0x24, 0xC1, 0x32, 0x92, 0x23, 0x7B, 0xFF, 0xC9,
-    0x96, 0x2A, 0xE2, 0xAC, 0xA5, 0x12, 0x8A, 0x4A, 0x66, 0xDB, 0x67, 0x55, 0x59, 0x84, 0x03, 0x38,
-    0x17, 0xD3, 0x8C, 0x6F, 0x9E, 0xC2, 0x17, 0x19, 0x93, 0xBA, 0x99, 0x56, 0x1A, 0xD2, 0x71, 0xFB,
-    0x63, 0x1D, 0xCB, 0xBB, 0x97, 0x4E, 0x1F, 0xDE, 0x4E, 0x6D, 0x32, 0x7B, 0xBC, 0x0A, 0xCB, 0xCF,
-    0x0F, 0xB5, 0xB6, 0x20, 0xEA, 0x09, 0x3B, 0xC3, 0x71, 0x94, 0x9D, 0xBE, 0xCE, 0xC8, 0x59, 0x6A,
-    0x0F, 0x6F, 0xB9, 0xFA, 0x54, 0xBA, 0xF1, 0xA7, 0xDA, 0xAF, 0x41, 0x14, 0xB7, 0x36, 0x2E, 0xD2,
-    0xCC, 0xC0, 0x52, 0x0B, 0xF6, 0x00, 0x7D, 0x8A, 0x00, 0x5A, 0xDC, 0x72, 0x0D, 0x6B, 0x04, 0xE0,
-    0x5E, 0xFA, 0x54, 0x20, 0x25, 0xF8, 0x67, 0x5A, 0xEE, 0xC5, 0xB7, 0x5F, 0x95, 0x2B, 0xCC, 0x76,
-    0x7D, 0xE3, 0x95, 0xBE, 0xEB, 0xCA, 0xDE, 0x72, 0x65, 0x5E, 0xDC, 0xC9, 0xA0, 0x36, 0x55, 0x3E,
-    0xAC, 0xB7, 0xAE, 0x9F, 0x9A, 0x7E, 0x3E, 0x9B, 0x95, 0x35, 0xC1, 0xF3, 0x7D, 0x54, 0x7F, 0x7D,
-    0xB6, 0x2B, 0x0F, 0xA8, 0xD6, 0xA6, 0x6A, 0x69, 0xAA, 0x6D, 0xE5, 0x5E, 0x25, 0xA3, 0x59, 0x67,
-    0x7F, 0xB3, 0x2A, 0xD5, 0x96, 0x46, 0xFD, 0xD5, 0x29, 0x5E, 0x19, 0x51, 0xD4, 0x98, 0x52, 0xC5,
-    0x17, 0x9E, 0x58, 0x37, 0xA6, 0x94, 0xBE, 0x2A, 0x42, 0x5F, 0x14, 0xA1, 0xAF, 0x89, 0xD0, 0x97,
-    0x44, 0xE8, 0xAB, 0x21, 0x8C, 0xD6, 0x5F, 0x93, 0xFE, 0x1F, 0xA5, 0x56, 0x31, 0x6C, 0x1C, 0xC7,
-    0x15, 0xFD, 0xBB, 0x4B, 0x72, 0x1D, 0x2D, 0xE0, 0xBD, 0xE2, 0x0E, 0x10, 0xA4, 0x04, 0xAB, 0x82,
-    0x85, 0x70, 0x08, 0x31, 0x8D, 0xCA, 0x3B, 0xCE, 0xA4, 0x48, 0x65, 0x18, 0xB9, 0x82, 0x84, 0x81,
-    0xA8, 0x90, 0x0B, 0x35, 0x21, 0x10, 0x08, 0xA9, 0x42, 0x03, 0xD4, 0xED, 0x38, 0x45, 0x52, 0xE6,
-    0x00, 0x97, 0x6A, 0x52, 0xA8, 0xA0, 0xAF, 0xB1, 0x0B, 0x17, 0x2C, 0x74, 0xDA, 0x41, 0x5C, 0xB8,
-    0x1D, 0xDB, 0x30, 0x52, 0x05, 0xDE, 0x18, 0x0C, 0x10, 0x24, 0x85, 0x37, 0xC8, 0x1A, 0x59, 0x11,
-    0xBB, 0x37, 0x79, 0x7F, 0xEE, 0x48, 0x93, 0xB4, 0x2C, 0x18, 0xC8, 0xEC, 0xCC, 0xCD, 0xDE, 0xEC,
-    0xCC, 0x9F, 0x3F, 0xFF, 0xBF, 0xFF, 0xFE, 0xCC, 0x9F, 0x92, 0x6C, 0x29, 0x75, 0x14, 0x3A, 0x43,
-    0x79, 0x49, 0x59, 0x4D, 0xC1, 0x84, 0x0E, 0x8E, 0xC9, 0x55, 0x91, 0x33, 0xC9, 0x92, 0x44, 0x4D,
-    0xB9, 0xA5, 0x01, 0x11, 0x0D, 0x8F, 0x89, 0xDC, 0x12, 0x13, 0x9D, 0x4A, 0x96, 0xCE, 0x66, 0xB5,
-    0xA8, 0x72, 0x9B, 0xB4, 0xF8, 0xB4, 0x47, 0x3D, 0x1A, 0x44, 0x4E, 0x4D, 0x53, 0xF7, 0x62, 0x29,
-    0x9C, 0x6B, 0xE5, 0x13, 0xD7, 0x4C, 0xA9, 0xB0, 0x7D, 0xDA, 0xA0, 0xC1, 0xFE, 0xBE, 0x92, 0xCE,
-    0x99, 0xF3, 0xC6, 0xFF, 0x0F, 0xE6, 0xF3, 0xF7, 0xDD, 0xA5, 0x82, 0xB1, 0xBD, 0x05, 0x85, 0x4D,
-    0x41, 0x71, 0x2D, 0xCF, 0x8A, 0x0A, 0x32, 0x6C, 0x8A, 0x7D, 0x02, 0xD7, 0x10, 0x05, 0x44, 0x9B,
-    0x13, 0xD1, 0xC8, 0x96, 0x9F, 0xA4, 0x84, 0x26, 0x24, 0x8D, 0x34, 0x85, 0xCD, 0xCB, 0xC2, 0x16,
-    0x65, 0x6E, 0x72, 0x7B, 0x4B, 0xDD, 0x52, 0x18, 0x2E, 0x1A, 0x2A, 0x1C, 0xAA, 0x22, 0xA7, 0x51,
-    0x03, 0x47, 0x69, 0x47, 0x69, 0x49, 0x37, 0x66, 0x7C, 0xA8, 0x6C, 0x49, 0xB9, 0xD3, 0xCF, 0x33,
-    0xD3, 0x26, 0x16, 0xF5, 0xF9, 0x23, 0xA8, 0xA3, 0xB3, 0x8E, 0x48, 0x51, 0x30, 0xFF, 0xFD, 0x9C,
-    0x22, 0xF7, 0x8B, 0x25, 0x16, 0x64, 0x0D, 0x8C, 0x20, 0x4B, 0x92, 0x96, 0xE5, 0x04, 0x1D, 0x1F,
-    0x6F, 0x42, 0x74, 0xA0, 0x68, 0x4E, 0xB2, 0x8A, 0x79, 0x8A, 0x68, 0x30, 0xD9, 0x95, 0x14, 0xE0,
-    0x38, 0x04, 0xA1, 0xD8, 0x7A, 0xB0, 0x07, 0xE3, 0xF8, 0x32, 0x97, 0xBF, 0x6B, 0xAF, 0xD5, 0xE1,
-    0xCF, 0x8E, 0x87, 0x7F, 0x9A, 0x6B, 0x92, 0x75, 0x5E, 0x51, 0xDA, 0xC2, 0xA4, 0xD1, 0x32, 0x69,
-    0xB1, 0x20, 0xEC, 0xF8, 0x2C, 0x05, 0x0E, 0xA8, 0x36, 0x89, 0x04, 0xCE, 0x90, 0xB3, 0x40, 0x4B,
-    0xCF, 0xE4, 0x27, 0xE5, 0xF4, 0x47, 0x89, 0x95, 0x4A, 0x18, 0x18, 0x43, 0xA7, 0xDE, 0xF0, 0x35,
-    0x26, 0x62, 0x2F, 0xF1, 0x82, 0x9D, 0xA0, 0x13, 0xE7, 0xAA, 0xCC, 0xB9, 0x5A, 0xDA, 0xA8, 0x95,
-    0x44, 0xDE, 0x11, 0x41, 0x17, 0x75, 0x71, 0x9B, 0xB4, 0x69, 0x83, 0x33, 0xD4, 0xB2, 0xCA, 0xAB,
-    0xC1, 0x24, 0xE9, 0xD2, 0x2E, 0x6D, 0x33, 0x6C, 0x2B, 0x2A, 0x59, 0x4A, 0x93, 0x9B, 0x01, 0x3C,
-    0x9D, 0x57, 0xB2, 0x12, 0x75, 0xD6, 0xA4, 0x98, 0x1D, 0xB5, 0x51, 0x47, 0x7B, 0x2F, 0x9B, 0x37,
-    0x7C, 0x9F, 0xB1, 0x01, 0x24, 0x50, 0x51, 0x12, 0x8E, 0x1D, 0x7B, 0x73, 0x60, 0xD4, 0x35, 0xA1,
-    0xB3, 0x31, 0x0C, 0xDC, 0x12, 0x6C, 0xC5, 0xF0, 0x18, 0xD3, 0x78, 0xB8, 0xC8, 0xBB, 0x61, 0xC7,
-    0x6F, 0x44, 0x47, 0x78, 0xA6, 0xC7, 0x79, 0x97, 0x1F, 0xF3, 0x1B, 0xD0, 0x33, 0x9F, 0xE5, 0xAE,
-    0x42, 0xA5, 0xF0, 0x3B, 0x35, 0x98, 0xD1, 0x7C, 0x46, 0xAE, 0x0C, 0x9C, 0x05, 0x0C, 0x63, 0xA7,
-    0x60, 0xD2, 0xBC, 0x65, 0x3B, 0x3C, 0xC4, 0x4A, 0x95, 0x58, 0x01, 0x43, 0x4C, 0x69, 0x97, 0xA4,
-    0xCE, 0xEC, 0x96, 0x25, 0x8A, 0x0C, 0x3F, 0xF7, 0xFF, 0xEE, 0x5C, 0xB1, 0x5C, 0xD9, 0x3D, 0xB6,
-    0xAB, 0x31, 0x7E, 0xDE, 0xFA, 0x82, 0x47, 0xF8, 0x2D, 0xD4, 0x03, 0x06, 0x1F, 0x3B, 0x9A, 0x0A,
-    0x73, 0xAD, 0x06, 0xCE, 0x00, 0x0F, 0x39, 0x76, 0xF3, 0x28, 0xF7, 0x90, 0xB9, 0x5A, 0x2D, 0x63,
-    0x09, 0x13, 0x84, 0x53, 0xF0, 0xFB, 0x96, 0xCA, 0xAB, 0xA2, 0x76, 0x35, 0xE0, 0xA9, 0xBF, 0x0F,
-    0x84, 0xAF, 0x86, 0xD9, 0x8D, 0x63, 0xD8, 0xB7, 0xC9, 0x2A, 0x1C, 0x07, 0xB6, 0x8D, 0x6A, 0xA0,
-    0x9D, 0x12, 0xA0, 0x07, 0xEA, 0x48, 0xD3, 0xCB, 0x8D, 0xD7, 0x54, 0xC1, 0xCC, 0xC1, 0x2C, 0xAE,
-    0x32, 0x23, 0x75, 0x41, 0x85, 0x2A, 0xFE, 0x99, 0x3B, 0xE1, 0xC2, 0x75, 0xBC, 0xCC, 0x79, 0xE7,
-    0x02, 0xE0, 0xE3, 0xF6, 0x8C, 0xA2, 0x2B, 0x8D, 0xBF, 0xDD, 0x0D, 0xF5, 0xDD, 0x51, 0x64, 0x46,
-    0xE2, 0xC1, 0x37, 0x0D, 0x42, 0xA8, 0x0A, 0x9E, 0xDE, 0x52, 0x07, 0x9A, 0xE6, 0x4A, 0x5C, 0xC2,
-    0x6E, 0x51, 0xB1, 0xD5, 0x2E, 0x63, 0xF7, 0x72, 0x74, 0xC7, 0x1C, 0xDD, 0x8D, 0xA8, 0x73, 0x1B,
-    0x7B, 0x50, 0x31, 0xB8, 0xA4, 0x0E, 0x5B, 0x71, 0x56, 0x78, 0x91, 0x11, 0x2F, 0x65, 0xC3, 0x07,
-    0xEA, 0x95, 0x60, 0x44, 0xD8, 0xF4, 0xE1, 0xCC, 0xC7, 0x99, 0x3B, 0xEB, 0x10, 0xF9, 0x6D, 0xFE,
-    0xC4, 0xD5, 0x8F, 0x5F, 0xCD, 0x0A, 0xF3, 0x19, 0x1F, 0xB2, 0xC2, 0xE1, 0x9C, 0x3F, 0xCD, 0x39,
-    0x41, 0xEC, 0xA3, 0xD0, 0xBA, 0x5C, 0x19, 0xEB, 0x7B, 0xE2, 0x91, 0x97, 0x89, 0x47, 0xFA, 0x2D,
-    0x10, 0xB1, 0x2F, 0x21, 0x99, 0xB5, 0x88, 0xC2, 0x0F, 0x2C, 0xAF, 0x76, 0xBC, 0x3D, 0x96, 0x78,
-    0xC2, 0xA1, 0x54, 0x79, 0xB7, 0xC4, 0xC0, 0x00, 0x00, 0x10, 0x82, 0x87, 0x32, 0x7E, 0xE5, 0x78,
-    0x2D, 0x57, 0x5F, 0x37, 0x56, 0xA2, 0x7E, 0x85, 0x86, 0xD1, 0x10, 0xE1, 0x1C, 0x81, 0xAC, 0xE0,
-    0x51, 0x4A, 0x60, 0xDD, 0x14, 0x28, 0x15, 0x30, 0xB0, 0x04, 0x54, 0x72, 0x96, 0x85, 0x69, 0x6C,
-    0xB1, 0xEB, 0xD3, 0x20, 0x2C, 0xE3, 0x69, 0xDC, 0xAE, 0x4D, 0xE3, 0xF6, 0x8A, 0x69, 0x5C, 0x7A,
-    0x34, 0xA5, 0x5C, 0x67, 0x26, 0xB1, 0x89, 0x11, 0x26, 0x57, 0xEF, 0xF8, 0xD1, 0xEB, 0xB0, 0x38,
-    0x87, 0x8B, 0x07, 0x2D, 0x1B, 0x09, 0x6D, 0x44, 0x34, 0x3A, 0x6F, 0xE3, 0xFD, 0xFD, 0x23, 0x1E,
-    0x1B, 0xCE, 0xE7, 0xC7, 0x80, 0x8B, 0x66, 0x1F, 0x8B, 0xA4, 0x3A, 0x61, 0x18, 0x31, 0x9C, 0x88,
-    0xB6, 0x6F, 0x2E, 0xA6, 0xB2, 0x4D, 0xAB, 0xAC, 0xCE, 0xBB, 0xA3, 0x71, 0x6F, 0x83, 0x54, 0x66,
-    0xA5, 0x7E, 0x8C, 0x38, 0x17, 0x94, 0x9A, 0xD8, 0xC4, 0x16, 0xBB, 0x43, 0x9B, 0x1F, 0xE2, 0x32,
-    0x90, 0x47, 0xB6, 0xA2, 0x14, 0x68, 0x84, 0xB8, 0x8B, 0xDB, 0x35, 0xA5, 0x14, 0x4D, 0xC0, 0x94,
-    0xA2, 0xBE, 0xA5, 0x94, 0x8B, 0xAC, 0x72, 0xD6, 0xAD, 0x9D, 0x5B, 0x9F, 0x67, 0x15, 0x62, 0x0A,
-    0xAB, 0x1F, 0x35, 0x71, 0x13, 0x57, 0xA9, 0x0D, 0x2E, 0x36, 0xAA, 0x48, 0xBE, 0xEB, 0x3E, 0x6F,
-    0x8B, 0x3F, 0xBB, 0x3F, 0x2C, 0xDD, 0xE7, 0x2E, 0x59, 0x16, 0x1F, 0x77, 0x71, 0x77, 0x2B, 0x6E,
-    0x83, 0xA7, 0x9C, 0x03, 0xD8, 0xF7, 0xC6, 0x3F, 0xA7, 0x39, 0x67, 0x93, 0x06, 0x67, 0x9E, 0x6B,
-    0x1C, 0x1E, 0x28, 0x9C, 0xCF, 0x3F, 0x30, 0x20, 0xAE, 0xF8, 0xD2, 0xCF, 0x88, 0xA9, 0xE6, 0x87,
-    0x1C, 0xEA, 0xA5, 0x9C, 0x0F, 0xF2, 0xEB, 0x86, 0x0B, 0x4F, 0x87, 0xFC, 0x04, 0x9A, 0x82, 0xF7,
-    0xFE, 0x36, 0xCB, 0xDC, 0xC7, 0xA5, 0x74, 0xFF, 0xB2, 0x0B, 0x44, 0x7B, 0x33, 0x75, 0x34, 0x39,
-    0x81, 0xAC, 0x3B, 0xB4, 0x8A, 0xA6, 0x14, 0xCE, 0x46, 0x0A, 0xF6, 0x3D, 0x52, 0x1D, 0x94, 0x3E,
-    0x49, 0xDC, 0xBB, 0x0D, 0x47, 0x96, 0xF8, 0xDA, 0x55, 0x12, 0x9C, 0x35, 0x08, 0xF6, 0xBF, 0x33,
-    0x6F, 0x5D, 0x54, 0xD2, 0x45, 0x56, 0xB8, 0xAF, 0x8D, 0x7C, 0xE4, 0xF4, 0x51, 0xB8, 0xF4, 0x83,
-    0x71, 0xC3, 0x63, 0x4F, 0x8C, 0x2C, 0x30, 0x06, 0xC6, 0xEE, 0xAF, 0xFD, 0x14, 0x98, 0x7B, 0x94,
-    0x7C, 0x31, 0x65, 0x44, 0xF8, 0x14, 0xE3, 0x8F, 0xAC, 0xEF, 0xAC, 0x45, 0x85, 0x3A, 0x2E, 0xB3,
-    0xE6, 0xF6, 0x3F, 0x22, 0xBB, 0x7A, 0xF2, 0x1A, 0x1E, 0xCB, 0xBA, 0x75, 0xF7, 0xCE, 0x84, 0xF6,
-    0x69, 0xF3, 0xD7, 0x87, 0x7E, 0xEA, 0x0E, 0xBA, 0xBE, 0xEF, 0x5E, 0x1F, 0x7D, 0x48, 0x3B, 0x44,
-    0xAF, 0xF7, 0x3F, 0x24, 0x6F, 0x38, 0xB6, 0x5D, 0xA8, 0xB9, 0xD2, 0x6B, 0x18, 0xD9, 0xA6, 0xDE,
-    0x4F, 0xD0, 0x1D, 0x6E, 0x1C, 0xB2, 0xFF, 0x7A, 0x3B, 0x87, 0xAC, 0xC8, 0xC6, 0xCE, 0xE1, 0x88,
-    0x85, 0xEC, 0x1C, 0x6E, 0xA3, 0xBB, 0xB9, 0xB3, 0x96, 0xB9, 0xED, 0x67, 0xDE, 0x24, 0xEE, 0xEE,
-    0x79, 0xDB, 0xB0, 0x79, 0xD6, 0x32, 0x83, 0x37, 0xE9, 0x37, 0x8A, 0xD6, 0xFB, 0x61, 0xC1, 0xDD,
-    0x95, 0x12, 0xF4, 0x6D, 0x77, 0x55, 0xDD, 0x1E, 0x52, 0x87, 0x38, 0x0D, 0xDB, 0x00, 0xEC, 0x2B,
-    0x15, 0xEF, 0x93, 0x68, 0x90, 0xAB, 0x6A, 0xA9, 0x45, 0xB4, 0x21, 0x80, 0x34, 0x84, 0x17, 0xA7,
-    0x88, 0xF6, 0x25, 0xB0, 0x09, 0x3A, 0xB1, 0xE0, 0x73, 0x4A, 0xEC, 0x42, 0x7C, 0x52, 0xF6, 0xF3,
-    0x4F, 0x15, 0x67, 0x22, 0x1F, 0x7B, 0x28, 0xFD, 0xDE, 0xF8, 0xE8, 0x3C, 0x14, 0x7E, 0xCA, 0x9A,
-    0x6F, 0xD0, 0xD1, 0xED, 0x46, 0x72, 0xA6, 0xAE, 0x40, 0x02, 0x3F, 0xEE, 0xC1, 0xD3, 0xB2, 0x8C,
-    0xD7, 0x7B, 0xDD, 0x23, 0xBE, 0x97, 0x34, 0x04, 0x4E, 0xD2, 0x52, 0x25, 0x75, 0xA1, 0xE3, 0xFA,
-    0xBF, 0x46, 0xFC, 0xFB, 0x3F, 0x76, 0x19, 0x7D, 0x5A, 0x95, 0x91, 0xA9, 0xF8, 0x2B, 0xEE, 0x2C,
-    0x2A, 0x83, 0x16, 0xB9, 0x76, 0xD0, 0x68, 0x82, 0x4C, 0x83, 0xCC, 0xDD, 0xE4, 0x8D, 0xAC, 0xB3,
-    0x32, 0xD4, 0x91, 0xF9, 0xED, 0x5F, 0x8B, 0xE5, 0x83, 0x6F, 0xB2, 0x7A, 0xF7, 0xD9, 0x6B, 0x77,
-    0xB6, 0x1A, 0x31, 0x63, 0x38, 0x8C, 0x93, 0xF2, 0x88, 0x03, 0x94, 0x1B, 0xBF, 0xF3, 0x58, 0xDC,
-    0x08, 0xBB, 0x01, 0x0F, 0x8C, 0x48, 0x76, 0xC8, 0x9F, 0x23, 0x98, 0xE8, 0xED, 0x15, 0x5C, 0x37,
-    0x27, 0xB9, 0x57, 0x1F, 0x7A, 0x36, 0xEC, 0x7B, 0xBE, 0x51, 0xCC, 0x88, 0x1E, 0x71, 0x20, 0xBA,
-    0x33, 0xC4, 0xD6, 0x9A, 0x13, 0x71, 0xCE, 0x84, 0xB9, 0x90, 0xE7, 0xDE, 0x76, 0x4B, 0x28, 0xFF,
-    0xFF, 0xAE, 0x1F, 0x70, 0x78, 0xEC, 0xE5, 0xFC, 0xB1, 0x5B, 0xFD, 0xAE, 0x00, 0xF6, 0x7D, 0xE3,
-    0xAB, 0x6C, 0x14, 0xCC, 0x58, 0xAE, 0x02, 0xB6, 0x33, 0x9F, 0xF5, 0x0A, 0x2B, 0x57, 0xC1, 0x66,
-    0xF2, 0xD9, 0x2F, 0xB9, 0xA7, 0x05, 0x26, 0x7D, 0xC0, 0xD7, 0xC3, 0x8B, 0xB2, 0xC5, 0xDC, 0x4D,
-    0x9C, 0x8D, 0xDC, 0x8B, 0x15, 0xD3, 0xB1, 0x3E, 0xA1, 0x5F, 0xD6, 0x40, 0xAD, 0x53, 0x0A, 0x90,
-    0xB4, 0x32, 0x5E, 0xB2, 0xE5, 0xB4, 0xB4, 0x3C, 0x39, 0x37, 0x07, 0x7E, 0x2D, 0x6E, 0x88, 0x57,
-    0xCA, 0xF6, 0xBA, 0xDF, 0xA5, 0xA1, 0xCF, 0x0A, 0x85, 0x59, 0xEF, 0x5F, 0xAD, 0xFB, 0x75, 0xCC,
-    0x31, 0x19, 0x73, 0x19, 0x5D, 0x10, 0x72, 0xC0, 0x37, 0x26, 0xBD, 0x99, 0x18, 0xBA, 0x6F, 0x52,
-    0xB0, 0x4A, 0x6C, 0x76, 0x13, 0x4E, 0xEC, 0xC9, 0x57, 0x06, 0xD7, 0x1C, 0xB1, 0xA4, 0xC7, 0x99,
-    0x5A, 0x3C, 0xD0, 0x08, 0x38, 0xD8, 0x6C, 0xC1, 0x6A, 0x12, 0xF2, 0xF2, 0xC3, 0xE6, 0xED, 0xBD,
-    0x66, 0x55, 0x3E, 0x42, 0xD0, 0x43, 0x82, 0x78, 0xC3, 0xEE, 0x46, 0xE5, 0x6E, 0x54, 0xA1, 0x8A,
-    0x18, 0xB7, 0x61, 0x83, 0xCB, 0xE2, 0xDE, 0xA6, 0x6A, 0x52, 0x7D, 0xB9, 0xB6, 0x99, 0x46, 0x5C,
-    0x8B, 0xBF, 0x28, 0xBF, 0x2F, 0x89, 0x9F, 0x43, 0x65, 0xBE, 0x7E, 0xE1, 0x57, 0x06, 0x4C, 0xB4,
-    0x7C, 0xC5, 0x0C, 0x67, 0x7C, 0x39, 0x88, 0xCA, 0xE0, 0xBD, 0x32, 0x75, 0xA5, 0xBC, 0x0F, 0xB1,
-    0xE5, 0x98, 0x85, 0x97, 0x12, 0x51, 0xEE, 0xCA, 0xF8, 0x2B, 0xFB, 0x94, 0x71, 0xE8, 0xEB, 0x43,
-    0x10, 0x1B, 0x2D, 0x85, 0x6E, 0xAF, 0x6E, 0x74, 0x92, 0xE8, 0xC9, 0xC3, 0x1B, 0xAA, 0xC0, 0xDD,
-    0xE1, 0xF9, 0x83, 0xCF, 0xEA, 0x67, 0xA9, 0x41, 0xD3, 0x57, 0xDA, 0x61, 0xA2, 0xEA, 0xFE, 0xF6,
-    0xB8, 0x95, 0xA7, 0xBB, 0x17, 0xA4, 0x37, 0xE6, 0x5C, 0x4A, 0x62, 0x52, 0xD4, 0x82, 0xCE, 0x9F,
-    0xAC, 0x89, 0xEB, 0x3E, 0x4D, 0xF8, 0x60, 0x91, 0x4D, 0xDF, 0x30, 0xE9, 0x1F, 0x75, 0xFC, 0x25,
-    0xAE, 0xC4, 0x3E, 0xED, 0x9D, 0xD0, 0x20, 0x98, 0x88, 0xC4, 0xA4, 0x5F, 0x2A, 0x8C, 0x20, 0xA2,
-    0xF0, 0x8B, 0x77, 0x8C, 0x8C, 0xC3, 0xF2, 0x7F, 0xED, 0x7D, 0x3F, 0x90, 0x1C, 0x67, 0x76, 0x5F,
-    0xF7, 0xCC, 0x61, 0xE7, 0xCC, 0x71, 0x5D, 0x5F, 0x60, 0x48, 0x65, 0x42, 0xAE, 0xBE, 0xC4, 0xAE,
-    0x32, 0x65, 0xA9, 0x13, 0x07, 0x0E, 0x64, 0x75, 0x9F, 0x55, 0xE5, 0x0B, 0x2E, 0xD0, 0x06, 0x3B,
-    0x64, 0x59, 0x08, 0x18, 0xB9, 0x2C, 0x1F, 0x5D, 0xB5, 0x89, 0x02, 0x07, 0x27, 0xF7, 0x50, 0x2A,
-    0x97, 0xC2, 0x83, 0x5D, 0xA6, 0x14, 0x38, 0x10, 0x02, 0xB0, 0x8A, 0x37, 0x28, 0x17, 0x1C, 0x28,
-    0x38, 0x55, 0x9D, 0xAF, 0xE7, 0xC8, 0xE0, 0x02, 0x07, 0xD7, 0x14, 0x7D, 0xA5, 0x80, 0x01, 0x47,
-    0x16, 0x78, 0x27, 0xE1, 0x02, 0x36, 0xC9, 0x86, 0xD8, 0x58, 0x74, 0xF7, 0xE7, 0xF7, 0xFB, 0xBD,
-    0xF7, 0xF5, 0xF4, 0xCC, 0xEE, 0x02, 0x0B, 0x10, 0x02, 0x09, 0x5A, 0x8B, 0xDD, 0xF7, 0x3E, 0xCC,
-    0xF4, 0x9F, 0xEF, 0xEF, 0xFB, 0xDE, 0xFF, 0xEF, 0xB9, 0x55, 0x10, 0xCC, 0xDC, 0x3A, 0x08, 0x5D,
-    0x19, 0x04, 0x79, 0x15, 0x04, 0x51, 0x1B, 0x04, 0xD3, 0x3E, 0x08, 0x82, 0xA3, 0x00, 0x3F, 0x85,
-    0x73, 0xBD, 0xDB, 0xFF, 0x91, 0xCB, 0xCE, 0xFC, 0x73, 0xAE, 0xDB, 0xF9, 0xBB, 0xBB, 0x38, 0x7A,
-    0xC0, 0xB5, 0xA7, 0x9E, 0x8B, 0xF7, 0xCD, 0xAB, 0x79, 0x15, 0x35, 0x71, 0x13, 0xB7, 0x49, 0x03,
-    0x8C, 0xFF, 0x07, 0xF6, 0xF3, 0x34, 0xEB, 0xF2, 0xC2, 0x4A, 0x7E, 0x96, 0x41, 0x8E, 0xF2, 0x3E,
-    0x4A, 0x15, 0x05, 0x53, 0x80, 0x87, 0xA1, 0xFF, 0xBC, 0xCA, 0x80, 0x9C, 0x6B, 0x15, 0xB9, 0x4C,
-    0x51, 0xA9, 0xA8, 0x12, 0x74, 0x7B, 0xE2, 0x6A, 0xDE, 0x90, 0x37, 0x44, 0x69, 0x7B, 0x3E, 0xCA,
-    0x89, 0x42, 0x87, 0x2B, 0x5F, 0xD5, 0xDB, 0x05, 0x6D, 0x14, 0x2D, 0x89, 0x3A, 0x76, 0xD6, 0x42,
-    0x5E, 0x1B, 0x3C, 0x27, 0xA3, 0x1B, 0xA4, 0xF8, 0x20, 0xAF, 0x05, 0xC8, 0x38, 0xCB, 0x15, 0xE8,
-    0x65, 0xA9, 0x4C, 0x10, 0x1E, 0x5A, 0xBF, 0xA2, 0x59, 0x4B, 0xE9, 0x5C, 0xB7, 0xDE, 0x07, 0xE8,
-    0xFA, 0xA7, 0x06, 0xFC, 0x4F, 0xE2, 0xEE, 0x05, 0xC1, 0xC4, 0xA1, 0x55, 0x31, 0x7B, 0x08, 0x75,
-    0x29, 0x43, 0xE7, 0xEE, 0xB8, 0xF5, 0x54, 0x7A, 0x6A, 0x96, 0xCD, 0xD1, 0x90, 0x20, 0x72, 0x68,
-    0x62, 0xCC, 0x69, 0x93, 0xB0, 0xD1, 0x69, 0x4B, 0x28, 0x97, 0xD7, 0x84, 0xCD, 0x2E, 0xEC, 0x57,
-    0xAB, 0x1B, 0x76, 0x8D, 0x5E, 0x1F, 0x63, 0x9E, 0xCB, 0x73, 0x14, 0xE2, 0x99, 0x33, 0xB9, 0x33,
-    0x5C, 0xCA, 0xCB, 0x5F, 0xBB, 0xB5, 0xC6, 0xBC, 0x90, 0x0F, 0x53, 0xC2, 0x39, 0xA1, 0x54, 0x05,
-    0xB7, 0x84, 0x0B, 0x5F, 0xD7, 0x2B, 0xF2, 0xDC, 0x10, 0xD5, 0x9B, 0xA1, 0xBE, 0x11, 0x2E, 0x4A,
-    0xDC, 0xCA, 0xAD, 0xE5, 0x2D, 0xF3, 0x2C, 0x6D, 0x50, 0x9B, 0xDA, 0x57, 0x2C, 0xED, 0xD9, 0xB8,
-    0x12, 0xEF, 0xEA, 0x38, 0x19, 0x4A, 0xCC, 0xBD, 0x16, 0x1F, 0x3A, 0xB6, 0x78, 0x6D, 0xDF, 0x4F,
-    0x31, 0x2B, 0x39, 0x35, 0x7D, 0xF7, 0xFC, 0x47, 0xFC, 0x37, 0x7F, 0xFF, 0xAA, 0x2B, 0x31, 0x58,
-    0x6B, 0x80, 0x2C, 0xC7, 0xBD, 0x73, 0x3E, 0xE5, 0x92, 0x0C, 0x65, 0xB1, 0x71, 0xD5, 0xA3, 0xFF,
-    0x8B, 0x5F, 0x6D, 0xD2, 0x77, 0xFA, 0xFC, 0x2F, 0xF1, 0x9B, 0xBE, 0xD9, 0x5D, 0x0A, 0x6C, 0x52,
-    0x84, 0x6E, 0x3D, 0x79, 0xA2, 0xBF, 0xD2, 0xB5, 0x32, 0xEF, 0x9E, 0xD2, 0x1F, 0x86, 0x34, 0xEA,
-    0x39, 0xF5, 0xD1, 0x49, 0x18, 0x7D, 0x4C, 0x24, 0xAC, 0x90, 0xE3, 0xDB, 0x98, 0xFF, 0x58, 0xF2,
-    0x81, 0x0E, 0xBB, 0x11, 0x9E, 0x87, 0x95, 0x5A, 0x9B, 0x27, 0x17, 0x29, 0xAD, 0x0E, 0x7D, 0x89,
-    0x74, 0x22, 0xD6, 0x52, 0x3D, 0x94, 0xBA, 0xA1, 0x24, 0x37, 0xC5, 0x0D, 0xEE, 0xCD, 0x65, 0x32,
-    0x27, 0x2C, 0x61, 0x72, 0x6B, 0x69, 0x8A, 0x52, 0xED, 0x4B, 0x29, 0x4B, 0x93, 0xA1, 0xC4, 0xCF,
-    0x2A, 0x94, 0x40, 0xBF, 0x0B, 0x96, 0x62, 0xB7, 0xBC, 0x29, 0xCB, 0x26, 0x72, 0x37, 0xE5, 0xC9,
-    0x98, 0x19, 0x11, 0x1B, 0x8A, 0x99, 0x15, 0x39, 0xED, 0x05, 0x6D, 0x54, 0x19, 0x60, 0xDE, 0x49,
-    0x49, 0x96, 0xDA, 0xA5, 0xCC, 0xCF, 0x66, 0xD0, 0xFF, 0x62, 0x63, 0xB3, 0x6E, 0x98, 0x7E, 0x4F,
-    0xA4, 0x70, 0xB2, 0x5A, 0xB9, 0x93, 0xEF, 0x66, 0x5C, 0xCB, 0xAC, 0x89, 0x15, 0x94, 0xF0, 0xE0,
-    0x67, 0xE3, 0x0B, 0x95, 0xDE, 0x35, 0x71, 0x8D, 0xDD, 0x9E, 0xB7, 0x56, 0x48, 0x7D, 0x21, 0x39,
-    0x55, 0xF0, 0x5F, 0x85, 0x4E, 0x0B, 0x27, 0x85, 0xAB, 0x0B, 0xA5, 0xED, 0xF6, 0x40, 0x4F, 0xD0,
-    0xD8, 0x23, 0x56, 0xB8, 0xA6, 0xB4, 0x3C, 0x7B, 0x02, 0x74, 0xFE, 0xD5, 0x85, 0xD1, 0xF9, 0xE6,
-    0x5C, 0x3A, 0xFF, 0xFE, 0xCC, 0xE8, 0x7C, 0x61, 0x74, 0xFE, 0x53, 0xA3, 0x60, 0xB2, 0x5A, 0x0E,
-    0x94, 0x50, 0x69, 0x5A, 0x4E, 0x52, 0x4A, 0x62, 0x36, 0xD1, 0x29, 0x7E, 0x14, 0x8C, 0xC6, 0x57,
-    0xF6, 0xF9, 0x02, 0x75, 0x41, 0x57, 0xCC, 0x5D, 0x26, 0x30, 0x66, 0x6F, 0x08, 0x85, 0x12, 0x58,
-    0xD4, 0x02, 0x43, 0x99, 0x41, 0x45, 0x35, 0xE5, 0xA4, 0xC2, 0x62, 0x2A, 0x2A, 0xD0, 0xC9, 0xE2,
-    0xAE, 0x6C, 0x3D, 0x18, 0xB5, 0x8A, 0x70, 0x33, 0x82, 0x35, 0xBE, 0x2D, 0xF0, 0x6D, 0x95, 0xF0,
-    0x7A, 0xD4, 0xA7, 0xA8, 0x74, 0x5A, 0x4E, 0x40, 0xC0, 0x65, 0xE9, 0xE1, 0xC9, 0xD8, 0xBD, 0x04,
-    0xCA, 0x45, 0x9C, 0xAE, 0x78, 0xFB, 0x8C, 0x35, 0x99, 0xDA, 0x18, 0xD5, 0xB2, 0x63, 0x65, 0x81,
-    0x72, 0x24, 0x68, 0xC5, 0x26, 0xF0, 0x14, 0x54, 0xB7, 0x2C, 0x99, 0xFE, 0xBA, 0xB9, 0x8D, 0x67,
-    0x2C, 0x47, 0x7C, 0x42, 0x38, 0x25, 0x9C, 0x13, 0x46, 0x84, 0x09, 0x61, 0x4A, 0x58, 0x7C, 0x00,
-    0xE8, 0xDE, 0x6B, 0x51, 0xAB, 0x97, 0x5B, 0xB4, 0x31, 0x16, 0x38, 0xEF, 0x00, 0xA3, 0x16, 0x30,
-    0xA9, 0x31, 0xA3, 0xD2, 0x0A, 0xB0, 0x28, 0x01, 0x85, 0xA0, 0xB7, 0xC5, 0x47, 0x2E, 0x13, 0xF8,
-    0xB1, 0xC3, 0x7C, 0xBB, 0xDF, 0x02, 0xCA, 0x30, 0x03, 0x72, 0x06, 0x4A, 0x35, 0x01, 0xD7, 0x84,
-    0x4B, 0xC2, 0x00, 0xB0, 0x07, 0x1C, 0x76, 0xB5, 0x8A, 0x75, 0x8F, 0x1B, 0x6E, 0xC0, 0x51, 0xFF,
-    0x72, 0xCF, 0x76, 0x3A, 0xEE, 0xC4, 0xEC, 0x55, 0xB9, 0xA6, 0xCF, 0x82, 0xBD, 0x1F, 0xEC, 0xDB,
-    0x32, 0x08, 0xD8, 0x40, 0x84, 0xA0, 0x25, 0x9E, 0x72, 0x70, 0x4B, 0xC1, 0xE0, 0xA4, 0x36, 0xA3,
-    0x38, 0xA6, 0xE8, 0xB0, 0x10, 0x5B, 0xE5, 0x5A, 0x17, 0xD0, 0x12, 0x1D, 0xC4, 0xF7, 0xA5, 0xCD,
-    0x8C, 0x6F, 0x6F, 0x23, 0x4C, 0x92, 0x48, 0x5A, 0xCC, 0xB7, 0x27, 0x0D, 0xE7, 0x2E, 0xE7, 0xCC,
-    0xC4, 0x69, 0x77, 0x73, 0x43, 0xC1, 0xB8, 0xAE, 0x75, 0x33, 0xCD, 0x74, 0x4F, 0x66, 0x6D, 0x52,
-    0x9D, 0x51, 0x18, 0xEB, 0xE0, 0xE0, 0x26, 0x06, 0x1E, 0xA4, 0x74, 0xA3, 0x68, 0xAD, 0x88, 0x83,
-    0xC5, 0xAF, 0xFC, 0x38, 0xE1, 0xF1, 0x29, 0x57, 0x63, 0xFE, 0xD9, 0x41, 0x10, 0xA0, 0x9A, 0x24,
-    0xE6, 0x0C, 0xE8, 0x97, 0xCD, 0x79, 0xF0, 0x85, 0xEB, 0xDA, 0x09, 0x4B, 0xED, 0x92, 0xB5, 0x72,
-    0x4D, 0xA5, 0x76, 0x97, 0xF5, 0x5A, 0xC5, 0x81, 0xBC, 0x55, 0xB3, 0x47, 0x5F, 0xD6, 0x8E, 0x05,
-    0x33, 0x2D, 0x9D, 0xA1, 0x9D, 0xDE, 0xCF, 0x39, 0xF2, 0x1D, 0x47, 0x22, 0x69, 0xA7, 0xE8, 0xD9,
-    0xB4, 0x01, 0x41, 0x97, 0xFA, 0x71, 0xCC, 0x30, 0x3B, 0x37, 0x24, 0x67, 0xAE, 0x22, 0x5B, 0x21,
-    0x35, 0x9B, 0x28, 0xB9, 0x24, 0x11, 0x69, 0x31, 0x61, 0xB0, 0x7D, 0xCC, 0xDD, 0x9D, 0x95, 0x4C,
-    0xAF, 0x48, 0xB7, 0x3A, 0x2C, 0x4F, 0x59, 0xCB, 0xE0, 0xF3, 0x66, 0x6E, 0x99, 0x92, 0xD1, 0x5C,
-    0xE7, 0xA0, 0x0E, 0xAE, 0x44, 0xDB, 0x42, 0x61, 0x1D, 0x3C, 0x81, 0x3D, 0x05, 0xCE, 0x65, 0xC9,
-    0x4E, 0x5E, 0x27, 0xB5, 0xBE, 0x47, 0x4A, 0x4D, 0x2A, 0x5D, 0x01, 0x08, 0x51, 0x3E, 0xD0, 0x35,
-    0xD5, 0x81, 0x78, 0x10, 0xF4, 0xBE, 0x94, 0x00, 0x14, 0x6D, 0x71, 0x72, 0x4B, 0xAE, 0xF3, 0x77,
-    0x94, 0x05, 0x29, 0x2E, 0xA8, 0x6D, 0xE1, 0x4E, 0xAE, 0x29, 0x29, 0xCE, 0x08, 0x37, 0x81, 0xB6,
-    0xCE, 0xC9, 0x0D, 0x2D, 0x49, 0x7D, 0x47, 0xAA, 0x4E, 0x18, 0x8F, 0xCA, 0x69, 0x4B, 0xDA, 0x5E,
-    0x6F, 0xEF, 0xEA, 0xF5, 0x39, 0xCB, 0x40, 0xBB, 0x49, 0xF8, 0x7B, 0x7D, 0x42, 0xD2, 0x03, 0x4A,
-    0xAF, 0x9C, 0x09, 0x53, 0x81, 0x27, 0x2B, 0xD7, 0x05, 0xDA, 0x9D, 0x4A, 0x99, 0x87, 0xE7, 0xDC,
-    0xFE, 0xFC, 0xF0, 0xC2, 0x53, 0x65, 0x3E, 0x2F, 0x80, 0xC9, 0x12, 0x9C, 0xC2, 0xB3, 0xF3, 0x70,
-    0xAF, 0x78, 0xBE, 0x8F, 0x3B, 0xC5, 0x91, 0xC7, 0xED, 0x2E, 0x4E, 0x0C, 0xA7, 0xB5, 0xE2, 0xBC,
-    0x52, 0x2C, 0x83, 0x01, 0xFC, 0x8A, 0xF4, 0xEA, 0x4D, 0x77, 0xE2, 0x37, 0xF3, 0xF3, 0x71, 0xA5,
-    0x7B, 0xE6, 0xC3, 0xF0, 0xB7, 0xAE, 0x61, 0x35, 0xAD, 0xB2, 0xA7, 0x29, 0xF2, 0x81, 0x26, 0xCA,
-    0x9A, 0x9E, 0xEB, 0xBA, 0x92, 0x92, 0x4C, 0xBD, 0x19, 0x26, 0x46, 0x89, 0xAD, 0x16, 0xAD, 0x04,
-    0xDB, 0xA4, 0x0F, 0x00, 0x91, 0x2D, 0x49, 0x9D, 0x5D, 0x39, 0xB5, 0xFE, 0x71, 0x25, 0x79, 0x40,
-    0x4C, 0xB4, 0x32, 0xEE, 0x48, 0x5F, 0x33, 0x57, 0x92, 0xF5, 0x97, 0x9B, 0xB9, 0xEF, 0x82, 0x50,
-    0xBC, 0x2F, 0xFF, 0x4A, 0x2F, 0x76, 0x79, 0x22, 0xEB, 0xD9, 0x4C, 0x63, 0x47, 0x54, 0xD8, 0xD5,
-    0x6F, 0x43, 0xF7, 0x37, 0xEE, 0xA7, 0x24, 0x32, 0x53, 0x59, 0xCE, 0xA5, 0x11, 0xDD, 0xA5, 0x48,
-    0x02, 0xAD, 0x7F, 0x1B, 0xC9, 0x32, 0x78, 0xDD, 0x92, 0x9C, 0x40, 0x81, 0xBA, 0xCC, 0x75, 0x13,
-    0x60, 0xFD, 0x20, 0x1E, 0x6E, 0xAC, 0xF6, 0x33, 0x6D, 0x47, 0xD1, 0x92, 0x6B, 0x40, 0xDB, 0x3A,
-    0xAC, 0x19, 0x94, 0x44, 0x94, 0xCA, 0xAD, 0x0F, 0xB4, 0x5E, 0x41, 0xC8, 0xBD, 0x0D, 0x8B, 0x8D,
-    0x52, 0x10, 0xC0, 0x26, 0x3E, 0xB9, 0xE9, 0xAA, 0xAF, 0x70, 0xB3, 0x0E, 0x02, 0x15, 0x71, 0x06,
-    0x39, 0x07, 0x4D, 0x9C, 0xE1, 0x3D, 0xBA, 0xC0, 0x1B, 0x74, 0xF4, 0x3D, 0xF6, 0xF6, 0x3A, 0x58,
-    0xDC, 0x52, 0x4E, 0xB0, 0xF1, 0xF2, 0x50, 0x32, 0x80, 0xB4, 0xFD, 0x1A, 0x6A, 0x9D, 0xBF, 0x7E,
-    0xD5, 0x35, 0xE8, 0x95, 0x6A, 0x10, 0x72, 0x44, 0xC0, 0xC2, 0xAA, 0xBC, 0x74, 0xF4, 0x0C, 0x6D,
-    0xF5, 0xC5, 0x1A, 0xBC, 0x4A, 0xBE, 0x01, 0xF1, 0x4F, 0xEF, 0x81, 0x0E, 0xC7, 0x9C, 0xB3, 0x33,
-    0x1D, 0xCF, 0xE2, 0xDE, 0xDE, 0x0E, 0xFF, 0xB9, 0x6F, 0xD7, 0x33, 0xC0, 0x36, 0xCE, 0x75, 0xDD,
-    0x44, 0x0F, 0x42, 0xD8, 0x3D, 0xF7, 0x51, 0xFC, 0x00, 0x94, 0x18, 0x6A, 0xCE, 0x40, 0xA9, 0xA1,
-    0xFA, 0x0C, 0x94, 0x57, 0x44, 0x5C, 0x6B, 0x19, 0xC4, 0x31, 0xD0, 0x01, 0x59, 0x14, 0x44, 0x6B,
-    0x45, 0x4A, 0x1C, 0x1A, 0xA2, 0xCB, 0x99, 0x69, 0x61, 0xC8, 0x62, 0xC8, 0x6E, 0x93, 0x91, 0xC7,
-    0x20, 0x03, 0x96, 0x1B, 0xE6, 0x2E, 0x54, 0x1A, 0x06, 0x93, 0x27, 0xF8, 0x03, 0xE9, 0x80, 0x5E,
-    0xF0, 0x7B, 0xC2, 0x02, 0x76, 0xC0, 0x52, 0xA7, 0x56, 0xF0, 0xBB, 0xB2, 0xB4, 0x1B, 0xC1, 0x7F,
-    0xDE, 0x05, 0x51, 0x2D, 0xF8, 0x9D, 0x3E, 0x88, 0x2B, 0x60, 0x61, 0x23, 0xFF, 0x42, 0xF0, 0xDB,
-    0x82, 0xDF, 0x16, 0x5C, 0xBA, 0x65, 0xFE, 0x43, 0xE2, 0x75, 0xF1, 0x2A, 0x70, 0xB1, 0x76, 0x5F,
-    0x07, 0x96, 0x6F, 0x43, 0xE2, 0x8F, 0x7A, 0xE2, 0xE4, 0xE3, 0x8E, 0x38, 0x76, 0x2D, 0x71, 0xE4,
-    0x1A, 0x62, 0xE1, 0xF2, 0x88, 0x67, 0xD8, 0x9A, 0x05, 0x0B, 0x91, 0x31, 0x5C, 0x12, 0x0B, 0x90,
-    0xDF, 0x2D, 0xF7, 0x97, 0x36, 0x8F, 0x0C, 0xEF, 0x2E, 0x16, 0x39, 0x39, 0x09, 0x77, 0x16, 0x94,
-    0x6F, 0x8B, 0xE6, 0x31, 0x9F, 0x3C, 0x82, 0xC3, 0x52, 0x3C, 0x06, 0xAD, 0x21, 0x8F, 0xB5, 0xA4,
-    0x52, 0xC6, 0x76, 0x0A, 0x87, 0xBD, 0x8F, 0x22, 0xF5, 0x94, 0x8A, 0x25, 0xEA, 0x9F, 0xE4, 0x2F,
-    0xA2, 0x8C, 0x57, 0xC6, 0x54, 0xDE, 0x6C, 0xC0, 0x9B, 0x0B, 0xA7, 0x45, 0xD2, 0xF6, 0x28, 0x88,
-    0x62, 0x9B, 0xE3, 0x62, 0x99, 0x40, 0x85, 0x44, 0x3A, 0x1F, 0xE9, 0x1B, 0x66, 0x58, 0x9D, 0x2E,
-    0x9B, 0xB8, 0xFE, 0x45, 0xCC, 0x19, 0xAD, 0x0B, 0x69, 0x71, 0xA5, 0x4A, 0x8C, 0x25, 0x77, 0x8A,
-    0x66, 0x60, 0xB6, 0x73, 0xE7, 0xB9, 0xAE, 0x33, 0x21, 0x58, 0xE1, 0xCF, 0x1A, 0xBA, 0x13, 0xF2,
-    0x7E, 0x8D, 0xB2, 0x81, 0x14, 0x91, 0x59, 0x39, 0x08, 0x2C, 0x35, 0x56, 0x7D, 0x03, 0x3E, 0x6D,
-    0x17, 0xE4, 0x00, 0xF8, 0x56, 0x3A, 0x84, 0x1C, 0x20, 0x37, 0x47, 0xD3, 0x6D, 0x80, 0xFB, 0x3B,
-    0xF9, 0xAE, 0x29, 0x1A, 0x2E, 0x0A, 0x76, 0x94, 0x8D, 0xD3, 0x41, 0xD9, 0x58, 0x72, 0xDF, 0x5D,
-    0x53, 0xD9, 0xB8, 0x9C, 0x4A, 0x25, 0x67, 0xD2, 0xCD, 0xE5, 0xBE, 0xB2, 0x91, 0x52, 0x50, 0x3A,
-    0x56, 0x39, 0x3E, 0x10, 0x9A, 0xB2, 0xD1, 0xD4, 0x8C, 0xD9, 0x19, 0xCA, 0xC6, 0xE2, 0x1C, 0x65,
-    0x63, 0x67, 0xE3, 0xAA, 0x9A, 0x08, 0x65, 0x18, 0x4E, 0x43, 0x2F, 0x28, 0x7F, 0x96, 0xF0, 0x8B,
-    0x20, 0xA7, 0xCA, 0x8F, 0xD1, 0x62, 0x6B, 0xD8, 0x3E, 0x16, 0x76, 0x88, 0x14, 0x22, 0x51, 0x89,
-    0x21, 0x34, 0x6E, 0x94, 0x42, 0x99, 0x43, 0x73, 0xEF, 0x09, 0xA7, 0xE6, 0x28, 0x64, 0x6C, 0x62,
-    0x4A, 0x62, 0x6E, 0x83, 0x3D, 0x53, 0x26, 0xE8, 0x46, 0x77, 0x50, 0xB0, 0x61, 0x1B, 0xE7, 0xF1,
-    0x66, 0xEF, 0xFF, 0x86, 0xFD, 0xF5, 0xFE, 0x7E, 0x69, 0x1B, 0x9F, 0x17, 0xB9, 0x13, 0xF9, 0xE7,
-    0x86, 0xF7, 0xF9, 0xF7, 0x6B, 0x7D, 0xA4, 0xE6, 0xE1, 0x2D, 0x08, 0x59, 0xE7, 0xD7, 0x3F, 0x08,
-    0xC8, 0x57, 0x63, 0x90, 0x64, 0x4C, 0x30, 0x8D, 0xE3, 0xDE, 0x0F, 0x12, 0xB7, 0x5D, 0x30, 0xF7,
-    0xA5, 0xC9, 0xA0, 0x64, 0x6B, 0xF3, 0x66, 0xC6, 0xED, 0xA8, 0x35, 0xD6, 0x36, 0xD1, 0xF1, 0x28,
-    0x74, 0x3C, 0x74, 0x25, 0x19, 0x13, 0x5B, 0xA8, 0x74, 0x9C, 0xEB, 0x08, 0x28, 0x69, 0x9A, 0xE8,
-    0x20, 0xD9, 0x95, 0x91, 0x03, 0x33, 0x24, 0x93, 0x83, 0x0B, 0x22, 0x6D, 0xF8, 0x4C, 0xAC, 0x69,
-    0x74, 0x25, 0x76, 0x0D, 0xCC, 0x0D, 0x21, 0xA1, 0x9C, 0x30, 0xF2, 0x8A, 0x58, 0x35, 0xB8, 0xA8,
-    0xAE, 0x2C, 0x1E, 0xA9, 0x9C, 0x3C, 0x61, 0x99, 0x93, 0x8A, 0x90, 0xD3, 0x2C, 0x3E, 0x67, 0x08,
-    0x2A, 0x86, 0xFE, 0x7A, 0x31, 0xD6, 0x66, 0xEE, 0xA1, 0xF1, 0x58, 0x3C, 0x08, 0x7D, 0xEB, 0x1A,
-    0xB9, 0xC2, 0x12, 0xAB, 0xCA, 0x6D, 0x1E, 0x19, 0x82, 0xEF, 0xDE, 0xA0, 0xDB, 0x04, 0xBA, 0x6C,
-    0x26, 0x7B, 0x93, 0xF3, 0xE6, 0x09, 0x4C, 0x28, 0xD6, 0x84, 0xD2, 0x7F, 0x70, 0xB0, 0x3A, 0x7C,
-    0xDC, 0x35, 0x5F, 0x6C, 0x20, 0x2A, 0xD1, 0xEC, 0xA0, 0x02, 0x53, 0xF5, 0x4C, 0x16, 0xBC, 0x4C,
-    0x79, 0x91, 0x82, 0x34, 0x39, 0x52, 0x51, 0x09, 0xF7, 0xF7, 0x34, 0x9A, 0x7E, 0x61, 0x4A, 0xFE,
-    0x67, 0x39, 0x94, 0xD6, 0x0F, 0x2E, 0x19, 0xC9, 0x9C, 0x3C, 0x4E, 0x29, 0xD5, 0xFB, 0xF3, 0xB3,
-    0x90, 0x7D, 0xE7, 0x6F, 0x38, 0x07, 0xFD, 0xE4, 0x28, 0xF0, 0x56, 0x42, 0xA2, 0x5E, 0x91, 0xD0,
-    0x92, 0x89, 0xAA, 0xDD, 0xE5, 0x92, 0xAB, 0x4E, 0xB5, 0x14, 0x86, 0x0A, 0xD5, 0x5D, 0xE4, 0x2A,
-    0xCC, 0x9B, 0x4C, 0x6F, 0xFF, 0xA3, 0xA6, 0x6D, 0x3D, 0xE1, 0x95, 0x77, 0x0A, 0x6A, 0x35, 0xD8,
-    0xC6, 0x89, 0x92, 0xD6, 0x89, 0x72, 0x5E, 0x82, 0xFA, 0xA5, 0xEA, 0x04, 0x67, 0x4E, 0x35, 0x35,
-    0xF3, 0x4F, 0x81, 0x4F, 0x5E, 0x57, 0x0C, 0x6E, 0x48, 0x31, 0x78, 0x4B, 0x5D, 0x9A, 0x86, 0x2B,
-    0x5E, 0x7F, 0xE0, 0x1A, 0xBD, 0x2F, 0x6F, 0x15, 0xA7, 0x86, 0x93, 0x6E, 0x0F, 0xEF, 0x7D, 0xEF,
-    0x88, 0x4F, 0x6E, 0xB9, 0x7A, 0xFC, 0x3C, 0xB4, 0x4C, 0x71, 0x6F, 0xEF, 0xBD, 0x06, 0xFC, 0xAD,
-    0xEB, 0x8F, 0xA2, 0xA6, 0xBA, 0xBB, 0x08, 0xB4, 0xE6, 0xAC, 0xF6, 0xA0, 0x51, 0xAC, 0x8B, 0xBB,
-    0x2F, 0x52, 0x54, 0xA5, 0xD5, 0x26, 0xD9, 0x2A, 0x09, 0x07, 0x90, 0x9E, 0xA5, 0x24, 0x5C, 0x6F,
-    0x95, 0x84, 0xC1, 0x56, 0xF5, 0xA0, 0xBA, 0x07, 0xB2, 0x3F, 0xA5, 0xD9, 0x75, 0xE3, 0xFE, 0xA6,
-    0x8C, 0xC4, 0x57, 0x44, 0xCC, 0x1A, 0x19, 0x6F, 0x67, 0xDC, 0x6D, 0xA6, 0x6A, 0xF5, 0x30, 0xA8,
-    0x53, 0xFA, 0x2C, 0xB8, 0x5A, 0xDD, 0xE4, 0xB6, 0x34, 0x31, 0xB8, 0x1E, 0xEE, 0xD5, 0xE7, 0x08,
-    0x8F, 0xF6, 0x35, 0x6E, 0x64, 0xE9, 0xEB, 0x57, 0xE5, 0x5D, 0x5B, 0x7B, 0xB2, 0xD6, 0x21, 0xC3,
-    0x06, 0x0C, 0x36, 0xE0, 0xD2, 0xD1, 0xBE, 0x1C, 0x7F, 0x4C, 0xD1, 0x96, 0x1C, 0x41, 0xCF, 0x42,
-    0xCC, 0x49, 0x84, 0xDE, 0x50, 0x4B, 0x36, 0x94, 0x8D, 0xA8, 0x3F, 0x04, 0x65, 0xF9, 0x6F, 0x67,
-    0x12, 0x33, 0xB6, 0x37, 0x19, 0x19, 0xC8, 0xAA, 0x94, 0x83, 0x29, 0x17, 0x4A, 0xA1, 0x57, 0xA5,
-    0xD8, 0xDD, 0x97, 0x69, 0x2F, 0x46, 0x1F, 0x0D, 0x85, 0x76, 0x54, 0x98, 0x8C, 0x3F, 0xB9, 0x7B,
-    0x6C, 0x85, 0x2A, 0xEA, 0x7C, 0xC1, 0x9E, 0x63, 0x4F, 0x5E, 0xAA, 0x80, 0xCE, 0x77, 0xCD, 0xFC,
-    0xDB, 0xA1, 0x21, 0xCA, 0x3B, 0xCA, 0xF1, 0xFD, 0x4B, 0x4E, 0xC5, 0x7A, 0x5F, 0xE7, 0x44, 0x39,
-    0xE3, 0x8A, 0x8C, 0xA9, 0x8E, 0x7F, 0xC1, 0x1E, 0xC0, 0x38, 0x69, 0x27, 0x3C, 0xEF, 0x19, 0xA1,
-    0xCA, 0x04, 0xA7, 0x62, 0x50, 0xAD, 0x82, 0xAF, 0xE7, 0x0B, 0xCA, 0x41, 0x3F, 0x30, 0x86, 0x5C,
-    0x99, 0x55, 0xE8, 0x7B, 0x67, 0x45, 0x2D, 0xAD, 0x23, 0x81, 0x76, 0xA6, 0x06, 0xF7, 0xD0, 0xEB,
-    0x1F, 0x96, 0xEC, 0x59, 0xCE, 0xF3, 0x8E, 0x15, 0x6D, 0x86, 0x27, 0xE8, 0x5B, 0xE6, 0x64, 0x35,
-    0x63, 0xD6, 0x15, 0x7C, 0xBA, 0x5C, 0xF3, 0xBC, 0xCC, 0x2C, 0x0E, 0x0B, 0x8D, 0xF4, 0x34, 0xD7,
-    0x4F, 0xEF, 0xBD, 0x28, 0x92, 0x6B, 0xA6, 0xBE, 0x11, 0x5E, 0x93, 0x75, 0x69, 0x05, 0xE9, 0xD6,
-    0x61, 0xC1, 0x09, 0x48, 0xDC, 0x49, 0xD1, 0x80, 0x07, 0x69, 0x84, 0x4E, 0x88, 0xBC, 0x58, 0x2B,
-    0x28, 0x9A, 0x5C, 0x44, 0xE1, 0x26, 0xD5, 0x4B, 0xDC, 0x07, 0xC2, 0xCA, 0xB8, 0xDF, 0x6C, 0x26,
-    0xAE, 0x99, 0x35, 0xDE, 0x9C, 0xFA, 0x0B, 0xDF, 0x23, 0xA3, 0xD8, 0x78, 0x23, 0x4F, 0x42, 0x58,
-    0x98, 0x30, 0xF9, 0xD7, 0x19, 0x65, 0x49, 0xEA, 0xED, 0xC9, 0xE8, 0x52, 0x42, 0x68, 0x0F, 0x6E,
-    0xC8, 0x85, 0x75, 0x0E, 0xE3, 0xDE, 0x47, 0x68, 0x70, 0x7A, 0xDF, 0xD9, 0x04, 0x84, 0x06, 0x2E,
-    0x13, 0xEE, 0x36, 0x87, 0xF2, 0x3F, 0xCB, 0xC1, 0xAF, 0x2D, 0xD5, 0x17, 0x84, 0xD6, 0xC0, 0xF5,
-    0x08, 0x2E, 0xD5, 0x55, 0x44, 0xD5, 0x17, 0x51, 0xAF, 0x36, 0xE5, 0xA5, 0x2C, 0x97, 0xE9, 0xC0,
-    0x35, 0x56, 0x9E, 0xD8, 0xCE, 0x55, 0xC4, 0x00, 0xDB, 0x7B, 0x79, 0xB1, 0xA0, 0x1D, 0xB4, 0x0F,
-    0x06, 0xED, 0x5B, 0x95, 0xA3, 0x87, 0xA4, 0x7B, 0x8A, 0x5A, 0x40, 0xCE, 0x92, 0x7C, 0x66, 0x5E,
-    0x08, 0x70, 0x40, 0xE8, 0x78, 0x71, 0xE9, 0xAF, 0x93, 0x6E, 0x12, 0xD0, 0x7A, 0x50, 0x50, 0x9B,
-    0x57, 0xD3, 0xF8, 0x90, 0x9B, 0x04, 0x73, 0x3B, 0x58, 0x2C, 0x16, 0x87, 0xB6, 0xAD, 0x6E, 0xFF,
-    0x36, 0xCA, 0x58, 0x3C, 0xEE, 0x1F, 0x6A, 0x2F, 0xD5, 0x4F, 0x07, 0xBB, 0xED, 0x1E, 0xAC, 0xA6,
-    0x7B, 0x30, 0xDF, 0xEC, 0xC3, 0x42, 0x61, 0x09, 0x08, 0x47, 0x13, 0x83, 0x13, 0xC8, 0x81, 0xCB,
-    0x5F, 0x74, 0x8B, 0x97, 0xDC, 0x7F, 0xE3, 0xBE, 0xD7, 0x9F, 0x01, 0x4B, 0x28, 0xD2, 0xCF, 0x83,
-    0xE8, 0x5C, 0x59, 0x25, 0x61, 0x71, 0x0D, 0xB3, 0xA0, 0xE7, 0x00, 0xAC, 0x31, 0x16, 0xB2, 0x1C,
-    0xFF, 0x4B, 0x51, 0xC7, 0x9D, 0x50, 0x6D, 0x19, 0xB2, 0xA8, 0x95, 0xD1, 0x8B, 0xBA, 0xBC, 0x5F,
-    0xDD, 0xEA, 0xD0, 0x59, 0x63, 0xB0, 0xD5, 0xB2, 0xB6, 0x5E, 0xFE, 0x8C, 0xDC, 0xB5, 0xB0, 0xC6,
-    0x1C, 0xAD, 0x27, 0xA4, 0x4F, 0x54, 0xA8, 0xCD, 0xC9, 0x76, 0x5F, 0x3E, 0x0C, 0x2E, 0x1F, 0x81,
-    0x3A, 0xC9, 0xAF, 0x3C, 0x5D, 0x64, 0x28, 0x15, 0xC2, 0xA4, 0x90, 0x63, 0x11, 0x2D, 0xE3, 0xD6,
-    0x24, 0xB0, 0xB8, 0x9D, 0xAA, 0xDD, 0x29, 0x6E, 0x67, 0x2A, 0x7E, 0x99, 0xE4, 0x15, 0x8B, 0xE4,
-    0x95, 0xAA, 0xF1, 0xAA, 0xE8, 0x4D, 0x29, 0xEF, 0x9C, 0xD1, 0x4B, 0xDB, 0xFC, 0x67, 0x26, 0x7D,
-    0x48, 0x55, 0x8A, 0x9E, 0x93, 0x39, 0xF1, 0x77, 0xE5, 0x6D, 0xDC, 0xC6, 0xCA, 0xDD, 0xC7, 0xED,
-    0x9C, 0x7B, 0xB2, 0xBD, 0x4B, 0xE8, 0x4D, 0xDC, 0x86, 0xCA, 0x7E, 0x49, 0x35, 0x0A, 0xB8, 0xE5,
-    0xB0, 0x86, 0x1D, 0xB4, 0x7C, 0x52, 0x90, 0xDB, 0xC2, 0x5B, 0x27, 0x9C, 0x9F, 0xA4, 0x9A, 0x3A,
-    0xFD, 0x83, 0xE4, 0xB5, 0x63, 0x17, 0x7C, 0x89, 0x8A, 0x35, 0x73, 0x61, 0x12, 0xF0, 0xA2, 0x10,
-    0xD0, 0xD0, 0xA9, 0x3E, 0xAC, 0x04, 0x90, 0xAA, 0x2F, 0x8E, 0x9D, 0x37, 0xCB, 0x4F, 0xD5, 0x20,
-    0xB2, 0xFE, 0x53, 0xF8, 0x45, 0x0C, 0xBB, 0x94, 0x6E, 0x5A, 0x09, 0x77, 0x1A, 0xE9, 0x29, 0x38,
-    0x4A, 0x5D, 0x3E, 0x02, 0xD5, 0xE8, 0xB0, 0x41, 0x08, 0x98, 0x00, 0x4C, 0x01, 0x22, 0x80, 0x18,
-    0x20, 0xFD, 0x40, 0x40, 0xFE, 0x63, 0x01, 0xEE, 0x3B, 0x9D, 0x7B, 0xDB, 0x45, 0x9D, 0x7B, 0xA7,
-    0x13, 0xF0, 0xAE, 0x74, 0x97, 0x7B, 0xAF, 0x16, 0xF0, 0x81, 0x90, 0x5B, 0xA9, 0x05, 0xC0, 0x1A,
-    0x20, 0x13, 0x20, 0x6B, 0xAF, 0x83, 0x5C, 0xD8, 0x39, 0x8C, 0xEC, 0xBC, 0x93, 0x19, 0x35, 0xEB,
-    0x43, 0x4C, 0xA8, 0xDF, 0x80, 0x52, 0x47, 0x6D, 0x58, 0x94, 0x6E, 0xD0, 0xB1, 0x5F, 0xB5, 0x8D,
-    0xE4, 0xA9, 0x55, 0x68, 0x81, 0x79, 0x22, 0xBD, 0x97, 0x36, 0x10, 0x3B, 0x65, 0x0D, 0xC2, 0x4C,
-    0xB1, 0x81, 0x62, 0x72, 0x23, 0x64, 0x83, 0x12, 0x84, 0x0A, 0xA3, 0x27, 0x6A, 0x72, 0xA3, 0x92,
-    0x82, 0x86, 0x32, 0xA9, 0xD7, 0x7D, 0x4A, 0xAB, 0x32, 0x7E, 0x72, 0x5D, 0x47, 0x79, 0x37, 0x00,
-    0xD3, 0xB2, 0x86, 0x80, 0x51, 0xDA, 0xF3, 0x64, 0x97, 0xC7, 0xE3, 0x7B, 0x5B, 0x9D, 0xF9, 0xE0,
-    0x5C, 0xE1, 0x61, 0xA1, 0x70, 0xB4, 0xF2, 0xC6, 0xD0, 0xED, 0xAF, 0xC5, 0x31, 0x0C, 0x6D, 0x75,
-    0x02, 0x5E, 0xE5, 0x1A, 0x95, 0x26, 0x12, 0x62, 0xF0, 0x1D, 0x49, 0x20, 0xB7, 0x8C, 0xE5, 0x97,
-    0xB4, 0x57, 0x85, 0x5D, 0xB9, 0xB4, 0xA0, 0xEA, 0x35, 0x81, 0xC6, 0x09, 0xA4, 0xA1, 0x44, 0x9B,
-    0x72, 0x20, 0xE8, 0x7D, 0x4A, 0xB5, 0x2C, 0x96, 0xD2, 0x73, 0xA1, 0x2B, 0x4A, 0xE9, 0xC5, 0x49,
-    0x2F, 0xE8, 0xC7, 0xCD, 0xB4, 0x95, 0x0F, 0x7F, 0xD4, 0xCE, 0x80, 0xDE, 0xEA, 0xA2, 0x5A, 0xD0,
-    0x9B, 0x2E, 0xAA, 0x04, 0xFD, 0xD0, 0x25, 0x40, 0x6B, 0x97, 0xC3, 0x32, 0x03, 0x55, 0x2D, 0x50,
-    0x0E, 0xEB, 0x8C, 0x8A, 0xED, 0x25, 0xFC, 0xC1, 0x02, 0x20, 0xF4, 0x28, 0x50, 0x47, 0x34, 0x87,
-    0x89, 0x66, 0xA7, 0xFF, 0x1F, 0x04, 0xEE, 0x2E, 0xF2, 0x86, 0x1A, 0xCF, 0x7D, 0x70, 0x81, 0x7B,
-    0x01, 0x84, 0xF6, 0xDC, 0x50, 0xB5, 0x45, 0x46, 0x25, 0xE2, 0x86, 0xAB, 0x19, 0x5E, 0x44, 0xEF,
-    0x4B, 0x47, 0x89, 0x98, 0x2D, 0xBF, 0x29, 0xD5, 0x35, 0xAA, 0xD7, 0x56, 0x65, 0x4D, 0x7E, 0x0E,
-    0xB4, 0x6B, 0x48, 0x52, 0x44, 0x92, 0x97, 0xBB, 0x84, 0x61, 0xE2, 0xBE, 0x64, 0x9B, 0x9B, 0xE9,
-    0xFA, 0x97, 0x58, 0xA4, 0x34, 0x76, 0x5C, 0x66, 0xFF, 0x2B, 0xD9, 0x77, 0xF5, 0x3E, 0x90, 0x1A,
-    0x3E, 0x49, 0xB0, 0xC8, 0x8E, 0x65, 0x18, 0xDF, 0x84, 0x6A, 0xF0, 0xC7, 0x26, 0xCD, 0x94, 0x60,
-    0xBA, 0x2A, 0xD8, 0x7B, 0x6B, 0xAF, 0x4C, 0x4C, 0x5B, 0x9A, 0x3C, 0xCE, 0x04, 0xFC, 0x96, 0xA0,
-    0x81, 0x36, 0xB2, 0xFF, 0xD7, 0x3B, 0x4A, 0xC7, 0x77, 0xE1, 0x5A, 0xF5, 0x17, 0xD0, 0x5F, 0x6E,
-    0x64, 0xAB, 0xE7, 0xE6, 0x73, 0x01, 0x20, 0x43, 0x70, 0x9B, 0x23, 0xC0, 0x45, 0x44, 0xF2, 0x0F,
-    0x7D, 0x4E, 0x21, 0x6B, 0x3F, 0x0B, 0x55, 0x97, 0xA8, 0x4E, 0x82, 0x8D, 0x77, 0xD6, 0xDC, 0x03,
-    0x23, 0xF2, 0x4F, 0x0D, 0x99, 0xBB, 0x7D, 0x65, 0x49, 0x0D, 0xF0, 0xD4, 0xAF, 0xA4, 0x65, 0x70,
-    0x85, 0x4E, 0x6D, 0xB2, 0xDF, 0xA0, 0xB3, 0x8F, 0x0A, 0xAF, 0x29, 0x57, 0xF0, 0xAD, 0x5B, 0xEE,
-    0xCE, 0x0D, 0x25, 0xA0, 0x4F, 0x0E, 0xC8, 0x3E, 0x23, 0x44, 0x14, 0xFA, 0x1C, 0x47, 0x2E, 0x93,
-    0x0A, 0xEC, 0x10, 0xEE, 0x90, 0x99, 0x2E, 0x4D, 0x5D, 0xA3, 0x33, 0x1A, 0x54, 0x41, 0xB2, 0xE5,
-    0x82, 0x0E, 0xBC, 0x32, 0x14, 0x7B, 0x69, 0x0D, 0xBD, 0x5E, 0xD2, 0xC0, 0x74, 0x18, 0xB5, 0x74,
-    0x3E, 0xEE, 0xE0, 0x7E, 0x36, 0xEB, 0xCD, 0xC2, 0xBD, 0xE6, 0x6E, 0x93, 0x51, 0x9D, 0x44, 0xA5,
-    0x03, 0x59, 0xFE, 0x7C, 0xAC, 0x78, 0x6D, 0x46, 0x3E, 0x4F, 0xBA, 0x4D, 0x09, 0x29, 0x7D, 0x8E,
-    0x4A, 0xC1, 0xC8, 0xA9, 0xCE, 0x8A, 0x9A, 0x44, 0x65, 0xB6, 0xCC, 0xBF, 0x26, 0xA4, 0x93, 0xD1,
-    0x43, 0x04, 0xCC, 0x33, 0xD0, 0x31, 0xA7, 0x73, 0xAC, 0x1E, 0x23, 0x54, 0xE9, 0xE8, 0xB6, 0x88,
-    0xA6, 0xFD, 0x54, 0x26, 0x86, 0x70, 0x9C, 0x30, 0xA0, 0x34, 0x09, 0xEC, 0x25, 0xA9, 0x6C, 0x85,
-    0x82, 0xE2, 0x2E, 0x85, 0x95, 0x24, 0xEA, 0x73, 0x43, 0xB0, 0x95, 0x44, 0x2E, 0xDF, 0xF9, 0x30,
-    0x85, 0x41, 0x25, 0xEA, 0x78, 0x43, 0xD2, 0xC6, 0x30, 0xBB, 0xE4, 0x6D, 0x24, 0xE4, 0xE5, 0x4D,
-    0x57, 0xAB, 0xB6, 0x6F, 0xA3, 0xCA, 0x3E, 0x65, 0x68, 0x3A, 0xDD, 0x85, 0xAF, 0x0D, 0x32, 0xCC,
-    0xA3, 0x37, 0x85, 0x48, 0x46, 0x2F, 0x5C, 0xC0, 0x6F, 0x64, 0x8E, 0xC9, 0x88, 0xAD, 0x77, 0x6E,
-    0xDC, 0x23, 0xDC, 0x47, 0x42, 0xAA, 0x49, 0x82, 0xE2, 0x6F, 0x68, 0xF7, 0x57, 0x4F, 0x46, 0xA7,
-    0x5B, 0x6F, 0xCB, 0x9E, 0x6E, 0x86, 0xB2, 0x76, 0xB5, 0x5E, 0xA3, 0xD7, 0x53, 0x9B, 0x09, 0x7E,
-    0xBD, 0xB1, 0x67, 0xEA, 0xF3, 0xF5, 0x5D, 0xF4, 0x7F, 0x5B, 0x2B, 0x9B, 0x22, 0x83, 0x2F, 0x9C,
-    0xEA, 0xDF, 0x0A, 0xBC, 0xB7, 0x38, 0xEE, 0x0E, 0xA9, 0x3A, 0xAF, 0x4E, 0xC3, 0x07, 0xB9, 0xFB,
-    0x28, 0xBC, 0x7C, 0xA8, 0x04, 0xBA, 0x52, 0x9A, 0x70, 0x36, 0xA0, 0xCC, 0x5D, 0xE0, 0x7D, 0x05,
-    0x38, 0x18, 0x3C, 0xBB, 0x85, 0x00, 0xD4, 0x42, 0xCC, 0x90, 0xE1, 0x74, 0x85, 0x70, 0xDC, 0x87,
-    0xC9, 0xAE, 0xBD, 0xFB, 0x14, 0x90, 0x17, 0xF1, 0x77, 0xD0, 0x08, 0x3F, 0x6D, 0xFC, 0xFE, 0x02,
-    0x0E, 0x34, 0x1B, 0xEF, 0x8A, 0x79, 0x1E, 0xB6, 0x7A, 0x66, 0x81, 0xBF, 0xF1, 0xB3, 0xFE, 0x95,
-    0x7A, 0xE3, 0x77, 0xD0, 0x5E, 0x65, 0x0F, 0x28, 0x28, 0x77, 0x35, 0x7D, 0x94, 0x42, 0xB0, 0x00,
-    0x29, 0x0D, 0xBC, 0xDF, 0xF7, 0x18, 0x7E, 0xEB, 0x96, 0xEA, 0x1F, 0xC6, 0x90, 0x6A, 0x01, 0x75,
-    0xFA, 0x8D, 0x06, 0x11, 0x56, 0xA6, 0x7E, 0xBF, 0x90, 0xC9, 0x01, 0xB3, 0x48, 0x0F, 0x38, 0xFE,
-    0x85, 0xFE, 0xBD, 0x0F, 0xF1, 0xAD, 0x59, 0x10, 0xFC, 0x5D, 0x74, 0xD8, 0x6D, 0xD0, 0xDB, 0x81,
-    0xCE, 0x0B, 0x70, 0xE9, 0x17, 0x41, 0x50, 0x50, 0x01, 0x61, 0xEF, 0xE2, 0xB6, 0x65, 0x68, 0x89,
-    0x4B, 0xAE, 0x40, 0x80, 0x06, 0x9F, 0x57, 0x02, 0x85, 0x3B, 0xC8, 0x3E, 0xD4, 0x4B, 0xEC, 0x86,
-    0xE1, 0x76, 0x7D, 0x58, 0x0F, 0xFB, 0x3C, 0xAB, 0xF4, 0x90, 0x1D, 0x0F, 0x57, 0x0E, 0x36, 0x3E,
-    0x35, 0x6D, 0x39, 0x38, 0xAF, 0xE3, 0x2D, 0x9B, 0xED, 0xCC, 0xC3, 0xBB, 0x37, 0x78, 0x65, 0x39,
-    0xA8, 0x16, 0x03, 0xEF, 0x97, 0xB5, 0x0C, 0x2E, 0x15, 0xEA, 0x8F, 0xB5, 0x54, 0x59, 0x20, 0xC5,
-    0x17, 0xF1, 0x4A, 0x3A, 0xFF, 0x4B, 0x6A, 0x4B, 0x9B, 0x79, 0x1E, 0x5F, 0x44, 0xB3, 0x35, 0xE8,
-    0xE1, 0x08, 0x84, 0xF8, 0xCC, 0x24, 0x00, 0x5E, 0x27, 0x2C, 0xCA, 0x9F, 0xCA, 0xC8, 0xA9, 0x00,
-    0x5E, 0x98, 0xC0, 0x54, 0x52, 0x1E, 0x53, 0xF1, 0x57, 0x9A, 0x75, 0x20, 0x5D, 0x07, 0x2D, 0x08,
-    0xF7, 0xF6, 0x09, 0xE7, 0xCE, 0x66, 0xC6, 0x8A, 0xC9, 0xAE, 0xF6, 0x73, 0x30, 0xB4, 0xB2, 0xD1,
-    0x15, 0xC2, 0x65, 0xA4, 0x0D, 0x39, 0x2B, 0x92, 0x19, 0x77, 0x17, 0xCA, 0x88, 0x96, 0x03, 0x17,
-    0x77, 0x67, 0x21, 0xE1, 0x2A, 0x72, 0xD2, 0x0B, 0xDE, 0xD7, 0x92, 0xAF, 0x16, 0x1E, 0x64, 0x83,
-    0xCD, 0xA2, 0x52, 0xAD, 0xFC, 0x46, 0xD5, 0xF2, 0x6B, 0x32, 0xA0, 0x60, 0xBD, 0xA5, 0x85, 0x23,
-    0xCB, 0x14, 0xE6, 0x60, 0xE2, 0x7B, 0x92, 0x3B, 0xCE, 0xCC, 0xBD, 0xFF, 0xB2, 0x8B, 0xA0, 0x2D,
-    0xA4, 0x74, 0x4F, 0x30, 0xC7, 0x7F, 0xF9, 0xC5, 0x74, 0xE8, 0x76, 0xBD, 0x2D, 0x76, 0xB7, 0x9C,
-    0xA9, 0x04, 0x45, 0x64, 0x0C, 0xC1, 0xA7, 0x4F, 0xA1, 0x01, 0xE4, 0x03, 0x12, 0xE8, 0x00, 0x73,
-    0x72, 0x73, 0xAB, 0xEB, 0x94, 0xDD, 0x7C, 0x64, 0x84, 0x2E, 0x03, 0xEE, 0x17, 0x09, 0x86, 0x75,
-    0x70, 0x14, 0x7F, 0xAA, 0xA2, 0x6C, 0x90, 0x07, 0xFF, 0x09, 0xB5, 0x00, 0xE3, 0xFF, 0x43, 0xB0,
-    0x4F, 0x28, 0xE5, 0x59, 0x31, 0xD6, 0xBD, 0x3D, 0xD5, 0x0A, 0x4D, 0xC8, 0x3D, 0x4C, 0x4D, 0xE5,
-    0xB8, 0xE4, 0x7C, 0xC7, 0x2E, 0x78, 0x1A, 0x8E, 0xAF, 0x11, 0xF8, 0x6F, 0xA0, 0xF4, 0xF9, 0x06,
-    0x9D, 0x39, 0x8F, 0x3D, 0xEB, 0xB0, 0x54, 0x47, 0x3E, 0xD9, 0x4C, 0x67, 0x4E, 0x1D, 0x28, 0x36,
-    0x6A, 0x20, 0xF5, 0x70, 0xF9, 0x29, 0xE1, 0x99, 0xE6, 0x1B, 0x72, 0x0D, 0x07, 0xB7, 0x54, 0x03,
-    0xA4, 0x8C, 0xFA, 0x76, 0x63, 0x3F, 0x20, 0x63, 0xB1, 0x7A, 0x03, 0x0C, 0x00, 0x2B, 0x0F, 0x33,
-    0x4F, 0x2C, 0xD3, 0x31, 0x2D, 0x95, 0x95, 0xD7, 0x19, 0xF9, 0xE4, 0x75, 0x38, 0x61, 0xF1, 0xD7,
-    0xE7, 0xB0, 0xC8, 0x41, 0x38, 0xE2, 0x8E, 0x65, 0x5F, 0x3F, 0x04, 0x49, 0xA8, 0xC7, 0x00, 0x9F,
-    0x6D, 0x43, 0x6D, 0x38, 0x8A, 0x22, 0x55, 0x1F, 0x9C, 0xCF, 0x22, 0x07, 0xBF, 0xDC, 0xD3, 0x43,
-    0xBF, 0x03, 0x53, 0xD3, 0x2B, 0x75, 0xC9, 0xEF, 0x1D, 0x34, 0xD8, 0xFC, 0xBF, 0x6A, 0x2C, 0x37,
-    0xDD, 0xEA, 0x1C, 0xED, 0x8E, 0xEA, 0xCE, 0x4F, 0xBD, 0x59, 0x0B, 0x92, 0xD2, 0x7B, 0x46, 0x7C,
-    0xAE, 0xA4, 0x28, 0xF8, 0x5D, 0x8D, 0xE2, 0x50, 0xF5, 0x59, 0xAB, 0x24, 0x2B, 0x1E, 0xE6, 0xF0,
-    0xA5, 0x2C, 0xA9, 0xD3, 0x46, 0x58, 0xC2, 0x26, 0xE6, 0x28, 0x5C, 0x3E, 0x92, 0xFF, 0x5D, 0xE8,
-    0xDF, 0xA5, 0xE0, 0x30, 0x79, 0xAB, 0x4E, 0xDF, 0x6D, 0xF1, 0xFB, 0xA3, 0x26, 0xFE, 0x3D, 0xF3,
-    0x5E, 0x10, 0xC6, 0x4D, 0xD9, 0xEB, 0xC7, 0xFB, 0x0D, 0x0E, 0x32, 0x44, 0x8F, 0xC8, 0xEC, 0x87,
-    0x62, 0xB3, 0x0E, 0xE2, 0x8D, 0xB7, 0x80, 0x1F, 0xA2, 0xF1, 0x9F, 0xFE, 0xB7, 0xA8, 0x41, 0x31,
-    0xF1, 0xBB, 0x86, 0xE2, 0xA5, 0x51, 0x15, 0xDD, 0xE0, 0xE4, 0x98, 0x3D, 0xAC, 0x50, 0xCD, 0xB4,
-    0x90, 0x0F, 0x05, 0xD0, 0xE2, 0x7B, 0xBE, 0x40, 0x9F, 0x03, 0x16, 0x1A, 0x5F, 0x80, 0x9E, 0x57,
-    0x04, 0x8F, 0xAF, 0xC3, 0x02, 0x8D, 0x42, 0x16, 0xF9, 0x02, 0x05, 0x8F, 0xF5, 0xB8, 0x20, 0x5F,
-    0xBD, 0x84, 0xC2, 0xD7, 0x73, 0x78, 0x90, 0x2C, 0xF5, 0x76, 0x33, 0xAD, 0x0B, 0xF5, 0xEF, 0x58,
-    0x28, 0x61, 0x15, 0xD2, 0x97, 0x7E, 0xC9, 0x53, 0x1A, 0xB0, 0x84, 0xB6, 0x01, 0x6A, 0x48, 0xDD,
-    0xA3, 0x62, 0xFE, 0xDC, 0xF6, 0x0C, 0x4B, 0xB0, 0x67, 0x56, 0xDB, 0xF0, 0xBA, 0x90, 0x8B, 0x89,
-    0xDA, 0x56, 0xC5, 0xF9, 0xEE, 0xFF, 0x0F, 0xF4, 0x7B, 0x7F, 0xBD, 0xED, 0x1C, 0xB9, 0x6D, 0x1D,
-    0x82, 0xAF, 0x3F, 0x73, 0x44, 0xEA, 0x60, 0xB5, 0x34, 0x63, 0x0E, 0x59, 0x62, 0x72, 0xE0, 0xDC,
-    0xDF, 0xFB, 0x71, 0xA4, 0xE2, 0x53, 0xD3, 0x58, 0x4D, 0x56, 0xA0, 0x81, 0x6E, 0x20, 0x28, 0x20,
-    0x81, 0x42, 0x35, 0xD1, 0xA7, 0xF9, 0x7A, 0xB4, 0x15, 0x3E, 0x35, 0x5D, 0x1D, 0x16, 0x44, 0x87,
-    0x28, 0x92, 0x39, 0x5D, 0x6B, 0x62, 0x8D, 0xDE, 0xAA, 0x29, 0x26, 0x93, 0xF3, 0x63, 0xDD, 0xC2,
-    0x21, 0x7E, 0xE4, 0x59, 0x14, 0xCC, 0xB9, 0xB6, 0x9E, 0xAC, 0x3A, 0x28, 0xAF, 0xCF, 0x52, 0x39,
-    0x29, 0xD1, 0x3E, 0x0B, 0xC0, 0x9A, 0xF5, 0xC2, 0x1B, 0x54, 0x6D, 0xBC, 0xF0, 0x46, 0xAA, 0x0E,
-    0xA0, 0x10, 0xE4, 0xC9, 0x44, 0xEE, 0x16, 0x18, 0x7F, 0xB7, 0x2D, 0x48, 0x57, 0xB3, 0xD0, 0x0C,
-    0x85, 0xB8, 0x67, 0xA3, 0xF3, 0x9A, 0xC1, 0x7A, 0x1B, 0x2D, 0xCC, 0x68, 0xA5, 0x9A, 0x43, 0x67,
-    0x56, 0xD1, 0xFC, 0x96, 0x45, 0x0C, 0xF7, 0x80, 0x56, 0x1E, 0x8E, 0x6C, 0xEA, 0xEF, 0xD3, 0x84,
-    0x98, 0x49, 0x65, 0xEA, 0x5A, 0xDA, 0xA6, 0x37, 0xB9, 0xEB, 0xB8, 0xD4, 0xAA, 0xE2, 0xC7, 0x3D,
-    0xB8, 0x32, 0x69, 0xD6, 0x77, 0x1C, 0xC6, 0x4E, 0x16, 0xC2, 0x37, 0xDC, 0x37, 0xE1, 0xA5, 0xDB,
-    0x09, 0x4B, 0xF7, 0xE3, 0x8E, 0x9D, 0x1B, 0xBA, 0x0F, 0xE8, 0xE1, 0x03, 0xD2, 0xC6, 0x19, 0x22,
-    0x5C, 0x2B, 0xC6, 0x60, 0x42, 0x65, 0x3A, 0xF4, 0x05, 0x32, 0xA5, 0x62, 0x75, 0x46, 0x66, 0x28,
-    0xA1, 0xB7, 0x18, 0x2C, 0x72, 0x0A, 0xCE, 0x51, 0x8F, 0x0D, 0x81, 0xB8, 0x81, 0x01, 0x21, 0xEA,
-    0x14, 0xC7, 0x1D, 0x58, 0x29, 0xA8, 0xEB, 0x79, 0x91, 0x5C, 0x1A, 0xAB, 0x12, 0x10, 0x36, 0x03,
-    0x2A, 0x0F, 0xF1, 0x25, 0xD4, 0x87, 0xF0, 0x04, 0x83, 0xAB, 0xCE, 0x14, 0x46, 0xA2, 0x35, 0xF5,
-    0xBB, 0xA0, 0x51, 0x65, 0x28, 0x1C, 0x9C, 0x2C, 0x00, 0x69, 0xC9, 0x3B, 0x7D, 0xFE, 0x11, 0xF6,
-    0xE4, 0x9F, 0xB5, 0xE9, 0xC7, 0x68, 0x87, 0x6B, 0x62, 0x4C, 0xA2, 0x04, 0x8C, 0x1B, 0xE7, 0xB6,
-    0xAC, 0x6A, 0xDA, 0xCE, 0xD6, 0x0C, 0x86, 0x55, 0x75, 0xB0, 0x8F, 0x05, 0xCB, 0xB7, 0x70, 0x21,
-    0x3B, 0x7F, 0x76, 0x8E, 0xA5, 0x77, 0xBD, 0x73, 0x65, 0x90, 0x9F, 0xBC, 0xA6, 0x4E, 0x06, 0x4D,
-    0x30, 0x52, 0x42, 0x2B, 0xFD, 0xAC, 0x49, 0x55, 0x5B, 0x5C, 0x09, 0x4B, 0x44, 0x8D, 0xE6, 0x0A,
-    0x94, 0xF6, 0xA0, 0x4C, 0x98, 0xF0, 0x13, 0x11, 0xE7, 0xF3, 0xFE, 0x96, 0x3C, 0x42, 0x0D, 0xBA,
-    0xB4, 0x7E, 0x29, 0xE5, 0x05, 0xBC, 0xE6, 0x43, 0x85, 0xF2, 0x53, 0xF5, 0x2C, 0x7C, 0x3D, 0xD7,
-    0x3B, 0x50, 0x3F, 0x3F, 0x7D, 0xBD, 0xD4, 0x16, 0x51, 0xA4, 0xF9, 0x10, 0x9D, 0xA8, 0xEF, 0x92,
-    0xF7, 0xDE, 0x5D, 0x14, 0xED, 0xB6, 0x3E, 0xD1, 0xA8, 0xB6, 0x39, 0xD9, 0x0E, 0x65, 0x3E, 0xEC,
-    0x7A, 0xA8, 0xB7, 0xDD, 0xBD, 0x1D, 0x1B, 0xB5, 0xCC, 0x8B, 0x4C, 0x2D, 0xB8, 0x0C, 0xB0, 0xC4,
-    0x46, 0xD7, 0x9A, 0x8D, 0xB7, 0xA1, 0xA1, 0xFA, 0x4E, 0x01, 0x57, 0x4D, 0x99, 0x34, 0x93, 0x0A,
-    0xD6, 0x59, 0x95, 0x2B, 0xD5, 0x3E, 0x5E, 0xD8, 0x66, 0xAC, 0x96, 0x64, 0x38, 0x01, 0xBC, 0xEC,
-    0x16, 0x8B, 0x23, 0x0B, 0xE6, 0x6C, 0xCF, 0xC7, 0x77, 0x8F, 0xF5, 0x3A, 0x7F, 0xDF, 0x80, 0xE7,
-    0xF6, 0xBC, 0x99, 0x3D, 0x7F, 0x6A, 0xEF, 0xC3, 0x5C, 0x0D, 0xBE, 0x46, 0x8B, 0xF0, 0x6B, 0xAF,
-    0xD4, 0x85, 0xDA, 0x84, 0x6B, 0xB3, 0xA8, 0xD7, 0xF4, 0x96, 0x57, 0x1C, 0x1C, 0x7B, 0x9F, 0x01,
-    0xD0, 0x62, 0xE9, 0xB2, 0x57, 0x4E, 0xB2, 0x9C, 0xDB, 0x36, 0x6C, 0x91, 0x89, 0x22, 0xF8, 0x9F,
-    0x63, 0x5B, 0xBD, 0x77, 0x55, 0xD0, 0x54, 0x23, 0x37, 0xB8, 0xE3, 0xE5, 0x35, 0x1B, 0x84, 0x21,
-    0x5D, 0xAD, 0xD4, 0x7B, 0xD6, 0xED, 0x23, 0xFB, 0xAE, 0x26, 0x81, 0xF0, 0x37, 0xD4, 0xEA, 0x1E,
-    0x57, 0xC3, 0x63, 0xE4, 0x4F, 0x72, 0xC6, 0x25, 0xD1, 0x46, 0xAA, 0x28, 0x56, 0x14, 0x9A, 0x8F,
-    0x22, 0x6D, 0xE4, 0x91, 0x96, 0x63, 0x65, 0xC3, 0x13, 0xD5, 0x40, 0xA5, 0x2A, 0xE6, 0xE5, 0xEF,
-    0x91, 0x68, 0xBA, 0xFF, 0xAD, 0xE8, 0x0F, 0x74, 0xB7, 0x99, 0xAA, 0x25, 0x8B, 0xDB, 0x8E, 0x10,
-    0x7F, 0xF2, 0xE9, 0xD2, 0x97, 0x6B, 0x1F, 0xC2, 0xEB, 0x5D, 0x94, 0xD3, 0xC1, 0xA2, 0x8B, 0xA9,
-    0x5D, 0xFC, 0xCC, 0xFD, 0x31, 0x36, 0xF7, 0xB7, 0xDC, 0x1C, 0xD6, 0xB1, 0xDF, 0x07, 0x9D, 0x80,
-    0xC1, 0x69, 0x0A, 0x84, 0xA7, 0x2D, 0xE7, 0x42, 0x43, 0xA8, 0x6F, 0x9C, 0x32, 0x54, 0xA5, 0x15,
-    0x54, 0x6C, 0x12, 0x04, 0x26, 0xE6, 0x55, 0x2A, 0x0D, 0x93, 0x55, 0x46, 0x77, 0x4C, 0x88, 0xAC,
-    0x53, 0x9A, 0xE9, 0xB8, 0x9D, 0x0C, 0xC4, 0xDE, 0xA9, 0x15, 0x90, 0xBB, 0x33, 0x6A, 0x33, 0x6B,
-    0x73, 0x04, 0xB5, 0xB7, 0xC2, 0x4F, 0x8A, 0x9C, 0x00, 0x49, 0x21, 0xA9, 0x22, 0xA9, 0x49, 0x7A,
-    0x72, 0x4B, 0x4D, 0xDE, 0x16, 0xAB, 0xA5, 0x0E, 0x8B, 0xC2, 0xB6, 0x1E, 0xDF, 0x83, 0x21, 0x2C,
-    0xAE, 0x8B, 0x72, 0xDE, 0xC5, 0x35, 0x22, 0x25, 0xE2, 0x3A, 0xAD, 0x92, 0x26, 0xAE, 0xB1, 0xE7,
-    0xC8, 0x23, 0x64, 0xCF, 0x89, 0xB1, 0x2F, 0x6E, 0x62, 0xE9, 0xF5, 0xBC, 0xB2, 0xD0, 0x3B, 0x7A,
-    0x6B, 0x5B, 0x9C, 0x9C, 0x86, 0xDF, 0x69, 0x18, 0xEF, 0xC6, 0x0A, 0xB7, 0xD4, 0x0F, 0x6F, 0xC2,
-    0xE8, 0x3B, 0x7A, 0x9A, 0x46, 0xAD, 0xBA, 0x63, 0xF4, 0x73, 0x75, 0x02, 0x98, 0xB7, 0x53, 0xF5,
-    0xCB, 0x88, 0x18, 0x86, 0x59, 0xDC, 0x5D, 0x1C, 0xCB, 0xAC, 0x18, 0xA2, 0x92, 0xD7, 0xA7, 0x0A,
-    0x1B, 0x5F, 0x10, 0x62, 0x7D, 0xF7, 0x45, 0xF7, 0x6E, 0x4F, 0x26, 0x6C, 0xE2, 0xBE, 0xD1, 0xC7,
-    0x0D, 0x67, 0xEB, 0xAC, 0x8F, 0xE0, 0x2B, 0x31, 0xEB, 0xF9, 0x0E, 0xF8, 0x5C, 0x48, 0x91, 0x4E,
-    0x1C, 0xED, 0xAC, 0x47, 0xC7, 0x4A, 0xB3, 0x66, 0xFD, 0x04, 0xDA, 0x94, 0xB4, 0x9E, 0xD1, 0x9F,
-    0xBE, 0x12, 0x96, 0x16, 0xC6, 0x20, 0x59, 0x66, 0x1B, 0x29, 0x14, 0x1B, 0xE1, 0xEA, 0x4A, 0x29,
-    0xE4, 0x55, 0xF1, 0x11, 0xFA, 0x45, 0xE8, 0x28, 0xED, 0x92, 0x47, 0xE0, 0x82, 0x75, 0x6F, 0x4D,
-    0xE9, 0x01, 0x41, 0x3C, 0x05, 0x41, 0x00, 0xEE, 0x34, 0xFE, 0x7B, 0x8E, 0xCE, 0x47, 0x1C, 0x78,
-    0x93, 0x6E, 0x80, 0x93, 0x3A, 0x91, 0xC5, 0x72, 0xB2, 0x2A, 0xAA, 0x58, 0x13, 0x1F, 0x78, 0x13,
-    0x2A, 0x38, 0xDC, 0xD4, 0xB8, 0xCE, 0xF4, 0xE4, 0xA6, 0x2B, 0xEE, 0x3B, 0xDA, 0xC2, 0x93, 0xDA,
-    0x2D, 0x85, 0xB9, 0xE8, 0x05, 0xAF, 0x53, 0xA9, 0x76, 0x52, 0xE7, 0x65, 0x2A, 0x6C, 0x80, 0x08,
-    0x2C, 0x88, 0x22, 0xA9, 0x05, 0x5B, 0x29, 0x96, 0x11, 0x96, 0x89, 0x52, 0x63, 0xA4, 0x5D, 0x99,
-    0xD4, 0xF3, 0x7E, 0x62, 0xCF, 0x9F, 0xEE, 0x61, 0x65, 0x6B, 0x6B, 0xF3, 0x47, 0xDF, 0x6C, 0xC3,
-    0xC7, 0xA2, 0x5E, 0xF7, 0x59, 0x35, 0x42, 0x63, 0x32, 0x95, 0x46, 0xD2, 0x2B, 0xBF, 0x2E, 0xD4,
-    0x8D, 0x54, 0x45, 0x27, 0xCE, 0x98, 0x66, 0x14, 0xB0, 0x1F, 0x5B, 0x48, 0x76, 0x6A, 0xF4, 0xBD,
-    0x68, 0x8A, 0x0F, 0xE9, 0xA5, 0xBF, 0x21, 0xD1, 0x62, 0xF7, 0xAA, 0x63, 0x97, 0x74, 0x7C, 0xAB,
-    0x4E, 0x2F, 0x0C, 0xE7, 0x08, 0xE8, 0x05, 0x33, 0x77, 0xB6, 0xF9, 0xF6, 0x24, 0x39, 0xA0, 0x9B,
-    0x18, 0x44, 0xF8, 0x4A, 0x90, 0xC4, 0xA5, 0xEA, 0x48, 0xB2, 0xBE, 0x44, 0x6B, 0x55, 0xB4, 0xF5,
-    0x9A, 0x64, 0x7E, 0x07, 0x38, 0xA7, 0xFE, 0xE4, 0x2A, 0x85, 0x0A, 0xC6, 0xF6, 0x48, 0x97, 0x60,
-    0xDA, 0x93, 0x33, 0x32, 0x6F, 0x0A, 0x53, 0x95, 0xD7, 0x1A, 0x8D, 0xA6, 0xB6, 0x72, 0xA9, 0x45,
-    0xF2, 0x91, 0xCB, 0x66, 0x6D, 0x52, 0xC9, 0xA2, 0x13, 0x58, 0xAC, 0xA3, 0x26, 0xA9, 0xD2, 0x32,
-    0xAE, 0x04, 0xA2, 0x67, 0x81, 0x37, 0xB2, 0x66, 0xA4, 0xE7, 0x05, 0xCA, 0xE4, 0x9F, 0xFB, 0x39,
-    0x77, 0x66, 0x69, 0xEA, 0xA7, 0x66, 0xE5, 0x8D, 0x02, 0xEA, 0x84, 0xAA, 0x51, 0x37, 0xE8, 0xEB,
-    0x58, 0xE7, 0xBD, 0x6E, 0x5F, 0xBA, 0x14, 0x32, 0x5B, 0x2F, 0xA1, 0x10, 0x86, 0x25, 0xA7, 0xFE,
-    0x02, 0x33, 0xC0, 0xEC, 0x18, 0xA6, 0xD8, 0xF4, 0x5E, 0xAA, 0x56, 0x6A, 0x87, 0x12, 0x23, 0x79,
-    0x16, 0x52, 0xF8, 0x80, 0x31, 0x3A, 0xA1, 0xFB, 0xBF, 0xEE, 0x47, 0xE6, 0xC3, 0xF3, 0xA6, 0xEC,
-    0xE9, 0x25, 0xBB, 0xF3, 0x5F, 0x51, 0x0C, 0x41, 0x4D, 0xD9, 0xFF, 0xEC, 0x72, 0x29, 0x71, 0xC9,
-    0xC4, 0xDD, 0xC4, 0xBA, 0x37, 0x01, 0x4F, 0xC3, 0x0E, 0x67, 0xF0, 0x2B, 0x87, 0x00, 0x74, 0x74,
-    0xCD, 0x41, 0xA1, 0x3F, 0x10, 0x87, 0x89, 0xCC, 0x3D, 0xC2, 0x63, 0x0E, 0x39, 0x1A, 0x99, 0xCC,
-    0x49, 0x8E, 0xC1, 0x16, 0x6B, 0xD0, 0x0F, 0xE6, 0xF0, 0x6B, 0x2F, 0xF7, 0x98, 0xFB, 0xF0, 0x2D,
-    0xA0, 0x54, 0x2B, 0x9D, 0x0A, 0x1C, 0x37, 0x58, 0x23, 0x27, 0xAB, 0x5B, 0x5C, 0x33, 0x23, 0x03,
-    0x8A, 0xE9, 0x13, 0x75, 0x6D, 0xC8, 0x5A, 0xA0, 0x06, 0x40, 0xD6, 0x00, 0x78, 0x11, 0xAC, 0x81,
-    0xF4, 0x43, 0x3C, 0x57, 0x96, 0x54, 0xC5, 0xF7, 0xC9, 0xE3, 0x8A, 0x75, 0xCA, 0xB1, 0x4A, 0x65,
-    0x6D, 0xA4, 0x1B, 0x2D, 0xE7, 0xEB, 0x94, 0x23, 0xC8, 0x6B, 0x38, 0x8B, 0xFF, 0xAD, 0x8C, 0x7B,
-    0x46, 0xBE, 0x6C, 0x03, 0xE5, 0x40, 0xD4, 0xE4, 0xEF, 0x83, 0x48, 0x92, 0xB3, 0x24, 0xBB, 0x7B,
-    0x05, 0x9A, 0x51, 0x55, 0x2A, 0xC5, 0x7C, 0x2B, 0xDB, 0x22, 0x3C, 0xE0, 0x6B, 0xB7, 0x84, 0xD3,
-    0xD9, 0xD0, 0x01, 0x3A, 0xD0, 0x64, 0x3C, 0x41, 0x38, 0x72, 0x67, 0xA3, 0x0E, 0x33, 0x64, 0x50,
-    0x16, 0x17, 0x44, 0xE2, 0x43, 0x54, 0xAE, 0x79, 0x1F, 0xB9, 0x4B, 0x2F, 0xAA, 0x03, 0xF6, 0xCC,
-    0xC2, 0x92, 0xAB, 0x60, 0x88, 0x25, 0x2D, 0xB6, 0x5C, 0xF8, 0x84, 0xF0, 0x58, 0xAE, 0x39, 0xF6,
-    0x3A, 0x16, 0x67, 0xA9, 0x21, 0x12, 0xB2, 0x1A, 0x69, 0x0F, 0x76, 0x44, 0xD7, 0xA4, 0xC1, 0x0E,
-    0xB6, 0xFB, 0xC4, 0x0C, 0xC6, 0x8E, 0x29, 0x0C, 0x38, 0xC3, 0x8F, 0x9D, 0xE9, 0x28, 0xF5, 0x27,
-    0x9B, 0x08, 0x93, 0x28, 0x8C, 0x2B, 0x7C, 0x3A, 0xF2, 0x37, 0xDD, 0x8D, 0x20, 0xB9, 0x4F, 0xD7,
-    0x06, 0x0D, 0xCE, 0xCA, 0x22, 0x75, 0x6A, 0x94, 0x7B, 0xA6, 0xF7, 0x16, 0x45, 0x13, 0x32, 0x40,
-    0x00, 0x5D, 0x84, 0x45, 0x5F, 0x07, 0xCF, 0x69, 0xDE, 0x0A, 0xBA, 0xC0, 0xF5, 0xDC, 0xE0, 0x36,
-    0xD2, 0x24, 0xAE, 0x7D, 0x0A, 0x84, 0xE6, 0x95, 0xA2, 0xFA, 0x49, 0x79, 0x73, 0x4B, 0x5F, 0xB3,
-    0xD8, 0xA2, 0x12, 0xEF, 0x41, 0x29, 0x24, 0x5F, 0xA1, 0xE9, 0x0A, 0x64, 0x7A, 0xAB, 0xEF, 0x0F,
-    0x2A, 0xAE, 0x5A, 0xA0, 0xB0, 0x30, 0xDA, 0x42, 0xF7, 0x02, 0x4C, 0x8E, 0xCD, 0x76, 0x93, 0x7B,
-    0x7C, 0x54, 0x10, 0x35, 0x58, 0x0A, 0xD2, 0x63, 0xDC, 0x3F, 0x65, 0xFE, 0x75, 0xD8, 0x62, 0xA5,
-    0x7E, 0x3F, 0x13, 0x29, 0xBA, 0xD4, 0xA5, 0xAB, 0x52, 0x74, 0xAF, 0x6B, 0x4A, 0xFD, 0xC2, 0x9C,
-    0x0A, 0xE9, 0x66, 0x74, 0xB8, 0x28, 0x9A, 0xAC, 0xC6, 0x56, 0x8A, 0x8B, 0xA2, 0xCB, 0x87, 0x82,
-    0x16, 0x19, 0x99, 0x72, 0x68, 0xA4, 0xA7, 0xF0, 0x30, 0x54, 0x16, 0x5D, 0x91, 0xEE, 0xFA, 0x03,
-    0x6A, 0xC6, 0x08, 0x41, 0x80, 0xE7, 0x21, 0x11, 0x82, 0x6A, 0x5E, 0x99, 0x36, 0x78, 0x58, 0x8D,
-    0xB6, 0x7F, 0x1D, 0x6D, 0xFF, 0x23, 0x77, 0xD5, 0xC8, 0xA7, 0xCD, 0x34, 0x0B, 0x61, 0x6A, 0xB6,
-    0xB1, 0x4B, 0xB3, 0x47, 0x6B, 0xC3, 0x3E, 0x1A, 0xBB, 0x8A, 0x72, 0x29, 0x19, 0x15, 0x2B, 0x95,
-    0xF2, 0x62, 0xEA, 0xDD, 0x7B, 0x91, 0x76, 0x15, 0xAC, 0x7B, 0xAA, 0x05, 0x23, 0xBA, 0x2E, 0x98,
-    0x37, 0x83, 0x79, 0x14, 0xEA, 0xBE, 0xC1, 0x75, 0xA7, 0xE4, 0xAE, 0xDC, 0xB1, 0x7B, 0x0D, 0xE8,
-    0x64, 0xB5, 0x5A, 0x59, 0x1C, 0xAF, 0xA2, 0x90, 0xD4, 0x8D, 0x0E, 0xCD, 0xFA, 0x4C, 0x08, 0xDC,
-    0x73, 0x4C, 0x76, 0xAC, 0x18, 0x7D, 0x7B, 0xA7, 0xBB, 0x62, 0x13, 0x04, 0x7E, 0x2F, 0xD4, 0x71,
-    0x9F, 0xA8, 0x13, 0xA9, 0x39, 0x50, 0x52, 0x83, 0xAD, 0xE6, 0x88, 0x70, 0xC8, 0x1A, 0x82, 0x05,
-    0x77, 0xE2, 0xE8, 0x13, 0x95, 0xF4, 0x94, 0xCC, 0x9C, 0xB9, 0x72, 0xA9, 0x0F, 0x06, 0x77, 0x57,
-    0x85, 0x1A, 0x1C, 0xB4, 0x4C, 0x7B, 0x21, 0x76, 0xD9, 0x8E, 0x87, 0x06, 0x68, 0x0C, 0x34, 0xDA,
-    0x45, 0x67, 0xDA, 0xAD, 0xF3, 0x3C, 0x34, 0x98, 0xF9, 0x25, 0x67, 0x46, 0x80, 0x89, 0xAB, 0xB1,
-    0xF8, 0x67, 0x82, 0x28, 0x8C, 0xD5, 0x09, 0x97, 0xF2, 0x9F, 0x60, 0x15, 0xAA, 0xEC, 0x87, 0x1A,
-    0x60, 0xBF, 0xA1, 0x43, 0x19, 0xED, 0x81, 0x26, 0xA2, 0x4D, 0x18, 0xF4, 0x87, 0x0E, 0x62, 0x5C,
-    0x0F, 0x16, 0x49, 0xA6, 0x0C, 0x3E, 0x29, 0x0A, 0x15, 0x29, 0x22, 0x28, 0x72, 0x39, 0xB7, 0x4A,
-    0x02, 0x5A, 0x86, 0xF7, 0x88, 0x94, 0x49, 0xBF, 0xEA, 0x3E, 0x57, 0x75, 0x41, 0xAE, 0x21, 0xCF,
-    0x85, 0xC6, 0x40, 0x5B, 0x42, 0x10, 0x1D, 0x76, 0x0B, 0x96, 0xB6, 0x50, 0x13, 0x3A, 0x4F, 0xC0,
-    0x2A, 0xF5, 0xDC, 0x35, 0xCA, 0x35, 0x0D, 0x39, 0xEF, 0x86, 0x92, 0x79, 0xC3, 0xCD, 0xBF, 0x51,
-    0xF9, 0x14, 0x1B, 0x3F, 0x79, 0x01, 0x72, 0x06, 0x99, 0x86, 0xB2, 0x33, 0xD0, 0x62, 0x8D, 0xB6,
-    0x23, 0xBA, 0x5A, 0x1E, 0xFA, 0x17, 0xDC, 0xC3, 0x3F, 0xC2, 0x9B, 0x92, 0x4F, 0xE8, 0x6A, 0x71,
-    0xBF, 0x1F, 0xD4, 0x15, 0x63, 0xD3, 0xF7, 0xC4, 0x52, 0x3E, 0x50, 0x7B, 0xF5, 0xDC, 0x1B, 0xFC,
-    0xFC, 0x9B, 0x54, 0x84, 0xC8, 0x9E, 0xC8, 0x8A, 0x95, 0xAC, 0x7C, 0x54, 0x25, 0x0C, 0x82, 0x69,
-    0x34, 0x93, 0xD9, 0xD1, 0xA0, 0xCD, 0x7A, 0xC6, 0xBB, 0xFC, 0x85, 0x1B, 0x70, 0x18, 0x8F, 0xC9,
-    0xF6, 0xCF, 0xBA, 0x88, 0x7E, 0xC8, 0xD0, 0x51, 0x05, 0xC5, 0x92, 0xDD, 0x56, 0xA6, 0xD8, 0xB3,
-    0xB2, 0x4B, 0x23, 0xD5, 0xE9, 0x67, 0x38, 0x44, 0x3B, 0x3F, 0x93, 0xAD, 0x9F, 0x39, 0x96, 0x63,
-    0xE7, 0xCB, 0x3B, 0x76, 0x62, 0xF3, 0x77, 0xE4, 0x23, 0x4F, 0x6E, 0xF9, 0xA8, 0xC1, 0x58, 0xB3,
-    0xAF, 0x05, 0x3E, 0x10, 0x30, 0x6F, 0x2F, 0x2D, 0xA8, 0xCF, 0x87, 0x8F, 0x6F, 0xA7, 0xDA, 0x21,
-    0xC6, 0x7C, 0xF7, 0xAA, 0x05, 0xCA, 0x69, 0x3E, 0xD0, 0xF0, 0x03, 0xB4, 0x3D, 0x82, 0xFD, 0x4D,
-    0x23, 0x50, 0x2C, 0x27, 0x05, 0x5D, 0x25, 0xD0, 0xF2, 0x1C, 0xBC, 0x8F, 0x95, 0x41, 0x4B, 0x7D,
-    0x99, 0xB9, 0x42, 0xEC, 0x7A, 0x3A, 0x6A, 0xEA, 0x73, 0x64, 0x4E, 0x80, 0x65, 0xE2, 0xF3, 0xA5,
-    0xCB, 0xA0, 0x09, 0xE0, 0x7B, 0x03, 0xC4, 0x84, 0x07, 0x5A, 0x1F, 0x69, 0xE9, 0x71, 0xC3, 0x7A,
-    0xA6, 0xF0, 0xFC, 0xA5, 0xFC, 0xBC, 0x0C, 0x94, 0x18, 0xC1, 0xD0, 0x7C, 0xEF, 0xAA, 0x33, 0x59,
-    0xCA, 0xB7, 0x37, 0xD5, 0x70, 0x63, 0xE3, 0x2F, 0x94, 0xD5, 0xE6, 0xCC, 0x41, 0xC7, 0x1C, 0x38,
-    0x0B, 0x86, 0x44, 0xEB, 0x2F, 0x1D, 0x6E, 0x4D, 0xDF, 0xD6, 0x37, 0xED, 0xB6, 0x9C, 0x8E, 0xCA,
-    0xC5, 0xC0, 0x27, 0x84, 0x37, 0xB7, 0xD1, 0x97, 0x93, 0xA1, 0x7F, 0x07, 0x6D, 0xA2, 0x95, 0xBB,
-    0x2D, 0x69, 0xD7, 0x71, 0x0A, 0x8B, 0xEB, 0x81, 0x76, 0x33, 0x73, 0xA5, 0x31, 0x64, 0x8D, 0xC6,
-    0xE5, 0x72, 0x4E, 0x6D, 0x18, 0x89, 0xA5, 0xC6, 0x17, 0x46, 0xEE, 0xA7, 0x5E, 0x6B, 0x46, 0xB2,
-    0xA9, 0x71, 0x86, 0xEA, 0xA7, 0x46, 0x96, 0x92, 0x64, 0x31, 0x2B, 0x74, 0x73, 0x53, 0x6F, 0xB7,
-    0x99, 0xB3, 0x9C, 0x4A, 0x49, 0x33, 0xEF, 0xAD, 0x48, 0x47, 0x58, 0x2D, 0x32, 0x0C, 0x51, 0x8B,
-    0xF3, 0x3E, 0x69, 0x34, 0x5A, 0x4E, 0xC4, 0xD8, 0x94, 0xBC, 0xF6, 0x1C, 0x99, 0x35, 0xF2, 0xCA,
-    0x42, 0xE9, 0x42, 0xCD, 0xBA, 0xB5, 0x84, 0x2E, 0x54, 0xA3, 0xBD, 0x8D, 0x8D, 0x5E, 0x7A, 0xC7,
-    0x6B, 0x46, 0x2A, 0xE6, 0x96, 0xEC, 0x2D, 0xF0, 0x2E, 0xD8, 0x9A, 0x8A, 0xEE, 0xF2, 0x5E, 0x2F,
-    0x8E, 0x3A, 0x31, 0xDF, 0xF6, 0xE1, 0xD0, 0x85, 0x93, 0x9B, 0xC3, 0xCC, 0x9E, 0x6E, 0x03, 0x72,
-    0xA6, 0xB6, 0x56, 0x59, 0x6C, 0xB7, 0xC5, 0x6B, 0x3B, 0x16, 0xD3, 0x6E, 0xCC, 0x51, 0x14, 0x83,
-    0x90, 0x55, 0x7A, 0x3D, 0xC2, 0x44, 0x99, 0x15, 0xF5, 0x3E, 0x92, 0x0D, 0xED, 0x2F, 0x5D, 0x02,
-    0x5F, 0xC6, 0xEC, 0x8D, 0xA9, 0xDB, 0xA4, 0xBD, 0x26, 0x95, 0x61, 0x00, 0x73, 0xCD, 0x60, 0xC0,
-    0xA2, 0xE1, 0x20, 0xE7, 0x2D, 0x2B, 0x97, 0x3E, 0x10, 0x15, 0xAA, 0x56, 0xE7, 0x7D, 0x79, 0x63,
-    0x4F, 0x49, 0x35, 0x7C, 0x5A, 0xDE, 0x70, 0x34, 0x05, 0xD7, 0xF0, 0x67, 0x7D, 0xAC, 0x6E, 0xFA,
-    0x0E, 0x8A, 0x6A, 0x65, 0x1E, 0x8C, 0x71, 0xD2, 0x40, 0x5D, 0x6C, 0xFB, 0xF7, 0x46, 0xBC, 0x40,
-    0x68, 0x13, 0x51, 0xDD, 0x68, 0x27, 0xFC, 0x2C, 0x56, 0x77, 0x1E, 0xF3, 0xDA, 0x52, 0xC1, 0xC6,
-    0xA4, 0xB2, 0x8C, 0x4C, 0xD9, 0x3A, 0x72, 0x2F, 0x7F, 0x84, 0x18, 0xEC, 0x83, 0xA5, 0x06, 0x64,
-    0xE7, 0x0D, 0x34, 0xD7, 0xA9, 0xC2, 0xF6, 0x0C, 0x08, 0xC1, 0xAF, 0x01, 0x6D, 0x2E, 0xEA, 0xD8,
-    0x45, 0x1B, 0xE8, 0x2B, 0x3F, 0xB8, 0x6F, 0x51, 0x75, 0xAA, 0xD4, 0xF3, 0x3C, 0xBA, 0xAA, 0x48,
-    0x82, 0x84, 0x75, 0x98, 0xEF, 0x93, 0x20, 0x5B, 0x31, 0xDD, 0x36, 0xB9, 0xE5, 0xED, 0x2D, 0x11,
-    0xAA, 0x6C, 0xA0, 0x0B, 0x5F, 0xEA, 0x26, 0xBE, 0xF4, 0xC6, 0xEF, 0x1E, 0x5C, 0xF7, 0xEB, 0x64,
-    0x79, 0x2A, 0xB4, 0x4A, 0xAD, 0x13, 0x4A, 0x9C, 0xB6, 0x9F, 0x0D, 0x2B, 0x6B, 0x98, 0x0D, 0xDE,
-    0x50, 0x70, 0x80, 0x18, 0x40, 0xBE, 0x39, 0x57, 0x23, 0xA8, 0xB2, 0x1F, 0x1A, 0x83, 0x45, 0xEB,
-    0x68, 0xA2, 0x84, 0xE2, 0x7D, 0xD9, 0x82, 0xFE, 0x90, 0x6A, 0xE3, 0xE0, 0x1F, 0x04, 0x5F, 0xC6,
-    0xC4, 0xB4, 0xB9, 0x19, 0xF7, 0x3E, 0x82, 0x1E, 0xF6, 0xCF, 0xDA, 0xE8, 0xA5, 0xCF, 0xE8, 0xC8,
-    0x30, 0x16, 0x9B, 0x69, 0x4B, 0xF7, 0xB0, 0xD2, 0x84, 0x2F, 0x5D, 0x16, 0xBE, 0x94, 0x59, 0x09,
-    0xAC, 0x8E, 0xC6, 0x6E, 0x29, 0xEB, 0x33, 0xA1, 0x7B, 0x0C, 0x6A, 0x80, 0x92, 0xD4, 0x20, 0xB1,
-    0xC4, 0x78, 0x58, 0xE5, 0x6B, 0x1A, 0xA8, 0xB0, 0x2E, 0xFB, 0xC2, 0xF5, 0xB7, 0x4C, 0x5E, 0x31,
-    0xDE, 0xCB, 0xC7, 0xB8, 0x71, 0x8C, 0xFE, 0x4C, 0xC5, 0xDE, 0x03, 0x81, 0xC7, 0xBA, 0x90, 0x2E,
-    0x65, 0x3E, 0x9E, 0x45, 0x5A, 0x19, 0x58, 0x0B, 0x36, 0x9E, 0xF0, 0x1B, 0x89, 0x4A, 0x7C, 0xEE,
-    0xC0, 0xF4, 0xA7, 0xBE, 0xB0, 0xD4, 0x90, 0xF0, 0xE0, 0xF9, 0xB8, 0xB4, 0x50, 0xE2, 0xD4, 0xAF,
-    0xD1, 0xD4, 0xAF, 0xDB, 0x99, 0x2F, 0x4C, 0xFD, 0x57, 0xB1, 0x27, 0x7F, 0xA9, 0xA7, 0x7D, 0x5F,
-    0xF5, 0xA3, 0x62, 0x79, 0x0A, 0x73, 0x58, 0xDC, 0x94, 0x74, 0xD4, 0x34, 0xF4, 0xCC, 0x18, 0x4E,
-    0x03, 0x8B, 0x90, 0xFB, 0xF9, 0x3A, 0x30, 0xDE, 0x50, 0x4D, 0xD5, 0x1A, 0x65, 0xAE, 0xDD, 0x12,
-    0x0C, 0xC1, 0xD8, 0x1C, 0x02, 0x1D, 0x20, 0x2D, 0x44, 0xDD, 0x39, 0x05, 0x98, 0x9A, 0x98, 0x46,
-    0x8A, 0x85, 0x08, 0xAE, 0x23, 0xE4, 0x3A, 0x41, 0x6E, 0xDF, 0x76, 0xEE, 0xED, 0x42, 0x3D, 0x7C,
-    0x07, 0x3D, 0x4F, 0x6E, 0x6A, 0x8E, 0x2E, 0xE2, 0x6A, 0x8C, 0x41, 0x5C, 0x7B, 0xCB, 0x37, 0xA7,
-    0xE6, 0xB1, 0xB9, 0xDF, 0x41, 0x23, 0x5F, 0x98, 0xF9, 0xB8, 0xC1, 0x69, 0xF9, 0xED, 0x39, 0x67,
-    0x6F, 0xB8, 0xFE, 0x17, 0xD3, 0x33, 0x57, 0xC6, 0xFF, 0x87, 0x56, 0x98, 0x20, 0xF8, 0xD6, 0x6A,
-    0xF5, 0x5D, 0x9F, 0xE9, 0xD6, 0x52, 0x04, 0x71, 0x54, 0x7F, 0xFD, 0xA5, 0x9F, 0x7C, 0x1F, 0xF8,
-    0x97, 0xA6, 0xEB, 0x7F, 0x7E, 0xBA, 0xAB, 0x9E, 0x19, 0xEB, 0xCD, 0x90, 0x66, 0xE3, 0xAF, 0x74,
-    0x2A, 0x6C, 0x4C, 0x75, 0x4D, 0xD6, 0x63, 0x0A, 0x27, 0xED, 0xF5, 0x5C, 0x3E, 0xBC, 0xB2, 0x8C,
-    0x35, 0xA1, 0x61, 0xBF, 0xDD, 0x03, 0xE9, 0xA6, 0x63, 0x8C, 0xC4, 0x48, 0x9F, 0xB1, 0x03, 0x4D,
-    0xDB, 0x31, 0x32, 0xA2, 0x98, 0x2D, 0xB2, 0xDB, 0xA6, 0x06, 0x50, 0x2D, 0xFC, 0xCC, 0xF5, 0x8B,
-    0xFF, 0xC1, 0x7D, 0xA0, 0xB3, 0x3D, 0x01, 0xCB, 0xBB, 0xE3, 0x9E, 0x82, 0x8B, 0xC3, 0xE3, 0x6E,
-    0x4B, 0x9D, 0x2F, 0x0A, 0x43, 0xF3, 0x57, 0x53, 0x0F, 0xB4, 0x99, 0xB9, 0xAF, 0x30, 0x6A, 0xEB,
-    0xE0, 0x21, 0x1E, 0xDE, 0x69, 0x73, 0xDA, 0xC3, 0x5B, 0x6A, 0xFA, 0x0F, 0xB1, 0x84, 0xFA, 0x60,
-    0x62, 0x5A, 0x83, 0x5E, 0xA7, 0x93, 0xF1, 0x5C, 0x17, 0x05, 0x41, 0xC8, 0x05, 0xB7, 0xD1, 0x4D,
-    0x68, 0x12, 0x44, 0x42, 0x45, 0x37, 0x49, 0x06, 0x77, 0x28, 0xAF, 0x95, 0x8A, 0x5B, 0xBF, 0x8D,
-    0x32, 0x21, 0x42, 0xF4, 0x23, 0x8C, 0x65, 0xF6, 0xBF, 0xBE, 0x22, 0x3B, 0xC7, 0x97, 0xD3, 0x12,
-    0x9D, 0xD3, 0x37, 0x9E, 0xEF, 0x80, 0xCE, 0x53, 0xB3, 0x58, 0xA4, 0xE0, 0xC8, 0xF3, 0xB9, 0x7C,
-    0xD3, 0x06, 0xFF, 0x33, 0x08, 0x9B, 0x81, 0xB4, 0x5D, 0xDF, 0x9D, 0x9E, 0xD3, 0xFA, 0xF2, 0xE2,
-    0x2A, 0x22, 0xC1, 0xE0, 0x87, 0x5E, 0xE7, 0x8B, 0x45, 0xF6, 0xEB, 0xDE, 0xB5, 0x6D, 0xEE, 0xAA,
-    0x5F, 0x70, 0x8C, 0xA3, 0x6B, 0x53, 0xF7, 0x47, 0x5D, 0x7A, 0x3B, 0xE8, 0x84, 0x04, 0x1E, 0x5D,
-    0x59, 0x22, 0x5B, 0x88, 0x6C, 0x04, 0x42, 0x59, 0xA3, 0x2A, 0xB8, 0xFE, 0xAB, 0x59, 0x51, 0xCA,
-    0x26, 0x5D, 0xCD, 0x37, 0xF1, 0xDA, 0x65, 0x37, 0x48, 0x9C, 0xE7, 0xEA, 0xBD, 0x97, 0x81, 0x3D,
-    0x4D, 0x7F, 0x2E, 0x7F, 0x59, 0xD2, 0xBD, 0xE0, 0x93, 0x5D, 0x7E, 0x75, 0x78, 0xF9, 0x6C, 0xD8,
-    0x24, 0x31, 0x2B, 0x7D, 0xF1, 0x57, 0xC3, 0x81, 0x0B, 0xFD, 0xB5, 0xE0, 0x77, 0x82, 0xF3, 0x7F,
-    0x66, 0x96, 0x48, 0x82, 0x1B, 0x86, 0xC6, 0x89, 0xCA, 0x9D, 0xFF, 0xF2, 0x25, 0x4C, 0xA2, 0xF9,
-    0x6B, 0xDF, 0x0B, 0xE4, 0x66, 0x3C, 0xF4, 0x2B, 0xF2, 0x18, 0x7B, 0xE9, 0x97, 0xB6, 0xBE, 0x22,
-    0x8F, 0xFC, 0xE3, 0x05, 0xC3, 0x4B, 0xAA, 0x24, 0x57, 0xD1, 0x25, 0xB1, 0xCD, 0x5D, 0x24, 0x9A,
-    0x5F, 0x9B, 0x68, 0x0B, 0xE6, 0xD9, 0xB7, 0x7F, 0x27, 0xD0, 0x16, 0x44, 0xC1, 0x3F, 0x0A, 0x9E,
-    0xC0, 0x8F, 0xBE, 0xF9, 0xB2, 0x37, 0x83, 0xAB, 0x83, 0x58, 0x32, 0x64, 0x29, 0x09, 0xF4, 0xCD,
-    0x51, 0xF6, 0xED, 0x6D, 0x8B, 0xFF, 0xD9, 0x03, 0x1E, 0x37, 0x52, 0xCF, 0x3C, 0x52, 0xAF, 0xFF,
-    0xCA, 0xB6, 0xF8, 0x6B, 0xDB, 0xE2, 0xF7, 0xB7, 0xC5, 0x6D, 0xAE, 0x9E, 0xB0, 0x1E, 0x38, 0x99,
-    0x89, 0x15, 0xA7, 0xEB, 0x61, 0x6F, 0x95, 0xE9, 0x3E, 0x83, 0xF0, 0x04, 0x3D, 0x4B, 0x6D, 0x59,
-    0xB9, 0x02, 0x4C, 0x54, 0xEF, 0xCB, 0x11, 0xFC, 0x60, 0xEB, 0x9F, 0x90, 0x92, 0x3C, 0x70, 0x9E,
-    0xFC, 0x2A, 0xC0, 0xDF, 0xB3, 0x81, 0xFC, 0x14, 0x23, 0x28, 0x37, 0x17, 0xC6, 0x6F, 0x47, 0xA5,
-    0x97, 0x9A, 0x65, 0x3D, 0x52, 0x39, 0xEC, 0xBB, 0xE5, 0xD8, 0x27, 0x91, 0xDE, 0x04, 0x4F, 0xEA,
-    0x67, 0xAA, 0x1B, 0x2F, 0xDF, 0xA0, 0x79, 0x51, 0xD6, 0x5A, 0x05, 0xCF, 0x24, 0x52, 0x07, 0xA1,
-    0x34, 0x6B, 0x4A, 0xCA, 0x23, 0x5F, 0x75, 0xDA, 0xAF, 0x5F, 0xD6, 0x0E, 0xB2, 0xDE, 0xC6, 0x7A,
-    0xB6, 0x31, 0x98, 0x6C, 0xD5, 0xBC, 0x93, 0x6D, 0xEE, 0x9C, 0xE9, 0xB6, 0xD6, 0xD3, 0xF5, 0xF6,
-    0x82, 0xAD, 0x63, 0x0C, 0x14, 0xC9, 0x21, 0xC3, 0xB5, 0xE8, 0x45, 0xAA, 0xEA, 0x6C, 0x04, 0xA2,
-    0x67, 0xE6, 0xE8, 0x65, 0x5C, 0x55, 0x63, 0x3A, 0xBC, 0xE5, 0x19, 0xED, 0xC9, 0x4B, 0x95, 0x3C,
-    0x8B, 0x52, 0x05, 0x27, 0xE0, 0x42, 0x71, 0xE8, 0x14, 0x4F, 0x0D, 0xCF, 0x0D, 0x47, 0x86, 0x65,
-    0x2F, 0x26, 0xCE, 0xEF, 0x2A, 0x76, 0x1F, 0x12, 0x4F, 0x64, 0x13, 0xCB, 0xA8, 0x01, 0xFE, 0x3D,
-    0xE2, 0x88, 0xF6, 0xD5, 0xA2, 0x84, 0x81, 0x02, 0x38, 0x6D, 0x15, 0xC3, 0x10, 0x01, 0x0C, 0xB6,
-    0x46, 0xF0, 0x3B, 0x20, 0xEB, 0x82, 0xFF, 0x1C, 0xFE, 0x33, 0x82, 0xDF, 0xEB, 0xE9, 0x0E, 0x54,
-    0x30, 0xE2, 0x29, 0xA3, 0x00, 0xA5, 0x98, 0x96, 0xE9, 0xBA, 0x50, 0x15, 0x64, 0x55, 0x68, 0x3E,
-    0x82, 0xAA, 0xD0, 0x04, 0xDF, 0x9B, 0xA2, 0x1F, 0xCB, 0xBD, 0x85, 0xF5, 0x9B, 0xAD, 0x70, 0xCF,
-    0xD0, 0xFB, 0xD5, 0x33, 0x1F, 0xE6, 0x4A, 0x10, 0x6C, 0xD3, 0x95, 0x53, 0xAC, 0x07, 0x97, 0xBA,
-    0xA0, 0xF8, 0x36, 0xA5, 0x67, 0x22, 0x05, 0x39, 0x58, 0x53, 0xFA, 0xC1, 0xD3, 0x4B, 0x5D, 0x10,
-    0x03, 0xED, 0x97, 0xB1, 0xF7, 0xAE, 0x72, 0x0C, 0xA1, 0x3A, 0x4C, 0x82, 0x13, 0x62, 0x3E, 0x69,
-    0xA2, 0x44, 0x51, 0xAE, 0x88, 0x56, 0x12, 0xB8, 0xC0, 0x02, 0x4D, 0xA1, 0x3C, 0x48, 0x85, 0x79,
-    0x82, 0x69, 0xA5, 0x4E, 0x5A, 0x22, 0x68, 0x87, 0x85, 0xD5, 0x15, 0x51, 0xB0, 0x82, 0x3E, 0x06,
-    0x9A, 0x9A, 0xF4, 0x13, 0xE6, 0x68, 0x81, 0x28, 0x41, 0xD4, 0x29, 0x6A, 0x14, 0xC1, 0xBF, 0xA0,
-    0x4B, 0xE9, 0x32, 0x21, 0x14, 0x7F, 0xA9, 0x88, 0x7C, 0xAE, 0xB6, 0x54, 0x67, 0x9A, 0x8A, 0x6D,
-    0x9E, 0x87, 0x36, 0x94, 0x5B, 0x86, 0x94, 0x72, 0xDC, 0x65, 0x8B, 0x2C, 0xDC, 0x09, 0xFA, 0xB7,
-    0xFC, 0x11, 0xCD, 0x59, 0xF0, 0x97, 0x11, 0xFF, 0xB4, 0x73, 0xE5, 0xC4, 0xFD, 0xF5, 0x91, 0x86,
-    0xD2, 0x94, 0xC6, 0x0C, 0xA8, 0x68, 0xA8, 0x21, 0xAE, 0x72, 0xCD, 0x55, 0x6A, 0x0C, 0x42, 0x67,
-    0x41, 0xEA, 0xFB, 0x90, 0x9F, 0x4F, 0x01, 0xEF, 0x38, 0xB0, 0x8A, 0xDE, 0xFD, 0xDC, 0xF1, 0x39,
-    0x94, 0xA1, 0x61, 0xEE, 0x39, 0xE5, 0x8A, 0xA7, 0xF0, 0x25, 0xF7, 0xDA, 0x91, 0xD9, 0x09, 0x77,
-    0xE0, 0xEC, 0xD4, 0x95, 0x0F, 0x83, 0x77, 0x5E, 0xF7, 0xA9, 0xA7, 0xA7, 0xDB, 0xA0, 0x24, 0xA9,
-    0xD8, 0x6B, 0x57, 0x2D, 0x84, 0x72, 0xDF, 0xE5, 0x6E, 0x4A, 0x76, 0xCB, 0xAB, 0xE5, 0xB3, 0x29,
-    0x5F, 0x3C, 0x65, 0x48, 0x51, 0x8E, 0xFC, 0x5C, 0x64, 0x89, 0x86, 0x88, 0xD9, 0x52, 0xB3, 0x34,
-    0x20, 0xFF, 0x2A, 0x1C, 0x44, 0x9A, 0xC2, 0xD2, 0x6D, 0x03, 0xFC, 0x12, 0x40, 0x8F, 0x4C, 0x6A,
-    0x74, 0xC7, 0xC8, 0x35, 0x9B, 0xC3, 0x66, 0x27, 0xA5, 0x83, 0x48, 0x83, 0x77, 0x8F, 0x0A, 0x88,
-    0x75, 0x29, 0x24, 0xBA, 0xBF, 0x7F, 0x91, 0xF4, 0x12, 0x97, 0x0F, 0xAF, 0xFC, 0x15, 0x86, 0x9E,
-    0x16, 0xBB, 0x8F, 0x3D, 0xAB, 0x88, 0x34, 0x0C, 0x77, 0xC8, 0x3F, 0x5B, 0x62, 0xA0, 0x71, 0xE0,
-    0xA2, 0xC2, 0xF9, 0x3E, 0x9C, 0x7D, 0x07, 0x92, 0x50, 0xF2, 0x1E, 0x21, 0x84, 0xDC, 0x3E, 0xA2,
-    0x25, 0xFC, 0x8F, 0xCC, 0x2E, 0xDE, 0x18, 0x13, 0x9A, 0xFE, 0x0D, 0xDF, 0x52, 0xE7, 0x78, 0x4B,
-    0x13, 0x7E, 0x83, 0x2A, 0x9F, 0x09, 0xC3, 0x27, 0x83, 0xCC, 0x64, 0xDC, 0x07, 0x43, 0x5D, 0x58,
-    0x36, 0x61, 0x4F, 0x81, 0xC2, 0xA7, 0x92, 0x39, 0x05, 0x1E, 0x25, 0x6F, 0xD9, 0xA7, 0x06, 0xC1,
-    0xA0, 0xF7, 0xD9, 0xFD, 0x13, 0x1E, 0xCD, 0xA1, 0x23, 0x86, 0xBF, 0x7E, 0xB5, 0x52, 0x55, 0xC8,
-    0xE3, 0xFF, 0x85, 0xC3, 0x5A, 0x38, 0x1B, 0xEE, 0xAF, 0xDC, 0xD3, 0x50, 0xD6, 0xEC, 0xCA, 0x7B,
-    0x05, 0x9F, 0x86, 0x17, 0x79, 0xC2, 0x83, 0x61, 0x08, 0x3B, 0x3F, 0x45, 0x91, 0x53, 0x40, 0xDD,
-    0xBA, 0xC7, 0xC0, 0xCB, 0x2A, 0xF5, 0x08, 0x5C, 0x75, 0x42, 0x47, 0xCF, 0xBA, 0x78, 0x0F, 0xE4,
-    0x83, 0x57, 0xC9, 0x99, 0xF0, 0x94, 0xB5, 0xF6, 0x5C, 0x48, 0xAB, 0x51, 0x31, 0x44, 0x4F, 0xD3,
-    0xB7, 0xC9, 0x96, 0x99, 0xAC, 0xD6, 0xBB, 0x97, 0x0A, 0xCB, 0x91, 0xB1, 0xA1, 0xEE, 0xC4, 0x72,
-    0xE9, 0x6F, 0x33, 0x61, 0x3F, 0x38, 0x0B, 0xA2, 0x4A, 0x4D, 0xA6, 0x34, 0xAF, 0xCC, 0x9A, 0x3C,
-    0x3D, 0x29, 0x54, 0x19, 0xE4, 0xCC, 0x61, 0x1E, 0xB0, 0x1E, 0xF4, 0x5B, 0x50, 0x03, 0xD3, 0xB5,
-    0x3B, 0x35, 0xC5, 0xD1, 0x0E, 0x68, 0x76, 0xA5, 0x1B, 0x82, 0x7E, 0x95, 0xA9, 0x93, 0x44, 0xBA,
-    0x9B, 0x59, 0x16, 0xC9, 0xDF, 0xE0, 0xBD, 0x51, 0x34, 0x0C, 0x94, 0x81, 0xD8, 0xCA, 0xB8, 0x0D,
-    0x0D, 0xDE, 0x60, 0xC9, 0x0B, 0x2B, 0x96, 0x36, 0xD6, 0x84, 0xE8, 0x9B, 0xEA, 0x6B, 0xBF, 0x51,
-    0xAF, 0x91, 0x58, 0x05, 0xA5, 0xCD, 0xA0, 0x7F, 0x99, 0x6A, 0x6E, 0x4E, 0x35, 0x29, 0x58, 0x2E,
-    0xE8, 0x29, 0xA8, 0x3C, 0x98, 0x07, 0xA1, 0x85, 0x70, 0xA4, 0x0F, 0x18, 0x4F, 0x9E, 0x59, 0x4A,
-    0x32, 0x1A, 0x37, 0x59, 0x5F, 0x35, 0x42, 0xE0, 0xAD, 0x34, 0x9B, 0x72, 0x3F, 0x9D, 0xC2, 0xD3,
-    0x81, 0x8B, 0xE8, 0xF7, 0x11, 0xC8, 0xCF, 0xCE, 0x7A, 0xCB, 0xFD, 0xA6, 0x89, 0x0A, 0x1F, 0xBB,
-    0x63, 0xD5, 0x8C, 0xA5, 0xF7, 0x9D, 0x29, 0xBE, 0x93, 0x41, 0xA5, 0x97, 0x7F, 0xE2, 0x72, 0xFD,
-    0xD6, 0xFD, 0xA5, 0x7B, 0x59, 0xD9, 0x30, 0xB9, 0xF7, 0x9B, 0x96, 0xC5, 0xE6, 0x37, 0xE4, 0x1F,
-    0x19, 0xB6, 0x1E, 0x26, 0xD4, 0x0D, 0xDB, 0x38, 0x35, 0x15, 0x5A, 0x41, 0x23, 0x2B, 0x9B, 0x0C,
-    0x03, 0x4F, 0xCC, 0x9C, 0x2E, 0xA8, 0xF3, 0x9C, 0x86, 0xF5, 0x8C, 0xED, 0x60, 0x1E, 0x49, 0x29,
-    0x21, 0xA3, 0x7C, 0xAA, 0xED, 0x15, 0x96, 0xA4, 0xB0, 0x3E, 0xD8, 0x12, 0x80, 0xE2, 0xC9, 0x94,
-    0x36, 0x97, 0x16, 0x38, 0x0C, 0x25, 0x5C, 0x64, 0x5A, 0x81, 0x19, 0xBA, 0xD3, 0xF7, 0xE3, 0xD0,
-    0x8D, 0xB9, 0xDA, 0x85, 0xC1, 0xB8, 0x58, 0x27, 0x46, 0x6E, 0xAA, 0x2D, 0x45, 0x17, 0x7E, 0x53,
-    0xDD, 0x23, 0xDE, 0xB1, 0xFE, 0x40, 0x17, 0x35, 0x3E, 0x16, 0x40, 0xA5, 0x7B, 0xEB, 0xB4, 0x09,
-    0xAE, 0xD1, 0xB4, 0xF9, 0xB8, 0x2B, 0xF3, 0xCF, 0x29, 0xAD, 0x9B, 0x68, 0xD5, 0x44, 0x2F, 0xE5,
-    0xDD, 0x11, 0x5D, 0xD4, 0x45, 0xF4, 0xEE, 0x7D, 0x7D, 0x84, 0xEA, 0x6B, 0x17, 0xF5, 0x89, 0xF5,
-    0x50, 0xBF, 0x2B, 0xE3, 0x3D, 0x6E, 0xC1, 0x14, 0x86, 0x9F, 0x9B, 0x54, 0xC9, 0x85, 0x6A, 0x24,
-    0x31, 0x8B, 0x28, 0xB3, 0x55, 0x06, 0xA6, 0x45, 0x65, 0xE2, 0x2B, 0x5D, 0x17, 0xC3, 0xEF, 0x06,
-    0x4F, 0x31, 0xD1, 0xC6, 0x2F, 0xA2, 0xC9, 0x21, 0x67, 0x3E, 0xEB, 0x97, 0xD3, 0x93, 0x5E, 0x6E,
-    0x7D, 0x41, 0x4D, 0x4C, 0x5E, 0x4B, 0xF3, 0xFC, 0x75, 0x4B, 0x2D, 0x5E, 0x6A, 0x1A, 0xA5, 0xA5,
-    0x1D, 0x6C, 0x62, 0xB9, 0x86, 0x2D, 0xD9, 0xB0, 0x65, 0x1B, 0xF6, 0x6E, 0xA9, 0x9A, 0xCE, 0x88,
-    0x4E, 0x46, 0x44, 0xEC, 0xE4, 0x42, 0xF7, 0x55, 0xB8, 0xD4, 0x01, 0x7D, 0xA2, 0x7E, 0xA6, 0x2A,
-    0x74, 0xC8, 0xFF, 0xF8, 0xE1, 0x87, 0x3E, 0x68, 0x52, 0x07, 0x84, 0x5D, 0xAD, 0x69, 0x83, 0x2C,
-    0x87, 0x90, 0x25, 0x14, 0x62, 0x66, 0x22, 0x75, 0x2E, 0xCC, 0x35, 0x89, 0x79, 0xA2, 0x28, 0x52,
-    0x34, 0x73, 0xA6, 0xB4, 0xBE, 0xC8, 0x41, 0x21, 0x67, 0xA0, 0x09, 0xBC, 0x9C, 0x60, 0xE0, 0x82,
-    0x06, 0xAF, 0xF7, 0xAE, 0xBC, 0x35, 0x13, 0xE2, 0xD3, 0xD1, 0x34, 0xAF, 0xD5, 0xCE, 0x85, 0x45,
-    0x9F, 0xD7, 0x58, 0x1E, 0x79, 0x4D, 0xC3, 0xDD, 0x27, 0x9A, 0x24, 0x98, 0xAE, 0xAC, 0x9F, 0xA8,
-    0x5F, 0x2B, 0x3F, 0xAF, 0xB1, 0x60, 0xF2, 0x1A, 0x8A, 0x24, 0xDC, 0xBB, 0xE4, 0x73, 0xDE, 0x3F,
-    0xA4, 0xA3, 0x6A, 0x45, 0x3F, 0xD5, 0x8A, 0xDE, 0xB1, 0x80, 0x73, 0x73, 0x45, 0xBD, 0x30, 0xBC,
-    0x7C, 0x58, 0x30, 0xEB, 0x3B, 0x33, 0x35, 0x2E, 0x49, 0x7B, 0xA5, 0xAA, 0x2D, 0x73, 0xF4, 0xB7,
-    0xD8, 0x18, 0xAB, 0x5E, 0x4D, 0x9C, 0x64, 0x91, 0x9D, 0xE6, 0xD9, 0x63, 0x24, 0x02, 0xA7, 0x39,
-    0x07, 0xC6, 0x7D, 0x4C, 0x3B, 0xE3, 0x7D, 0xCB, 0x48, 0x91, 0x71, 0x95, 0xE3, 0x93, 0x8F, 0x34,
-    0xFB, 0x24, 0x75, 0xCB, 0x15, 0x5D, 0x09, 0xFD, 0x13, 0xC0, 0xBC, 0x56, 0xF4, 0xED, 0xAE, 0x3A,
-    0x6A, 0x6B, 0x5B, 0x24, 0x3A, 0xAF, 0x6E, 0xA4, 0xCC, 0xF8, 0x1F, 0x73, 0xFD, 0xCF, 0x59, 0xAB,
-    0xA9, 0xDB, 0xEC, 0xF6, 0xE7, 0xF7, 0xD8, 0x9F, 0xDF, 0x67, 0x7F, 0x16, 0xEC, 0xCF, 0x82, 0xFD,
-    0x59, 0xB0, 0x3F, 0x8B, 0x0B, 0xF4, 0x67, 0xC1, 0xFE, 0x2C, 0x9C, 0xC2, 0x25, 0x61, 0xC9, 0x67,
-    0xC2, 0x75, 0xFC, 0xFB, 0x3A, 0x5E, 0x09, 0x2D, 0x20, 0x73, 0xC4, 0x13, 0x51, 0xC8, 0x9E, 0x6B,
-    0x6A, 0xCD, 0x2B, 0xEE, 0x08, 0xB3, 0x56, 0x24, 0x9F, 0x90, 0xEE, 0xE6, 0xD4, 0x22, 0x0B, 0xE2,
-    0x98, 0xBA, 0x0E, 0x83, 0x1A, 0xBB, 0x23, 0xCB, 0xCA, 0x59, 0xD0, 0xE6, 0xCB, 0xE9, 0x3D, 0x77,
-    0x2F, 0x99, 0x57, 0xA1, 0xAE, 0x43, 0x52, 0xAC, 0x2D, 0x52, 0x7D, 0xDD, 0x55, 0xBD, 0x64, 0x62,
-    0xB6, 0x62, 0xA7, 0x79, 0x58, 0x73, 0x4B, 0xF1, 0xA9, 0xE7, 0x21, 0x41, 0x5D, 0x37, 0xD7, 0x73,
-    0x82, 0x68, 0xAD, 0x54, 0x57, 0x41, 0x8B, 0x83, 0xC8, 0x2D, 0x41, 0xAB, 0xB3, 0x93, 0x93, 0xB2,
-    0xD3, 0xF2, 0xCA, 0x2B, 0xEE, 0xCE, 0x35, 0x6F, 0x97, 0x1A, 0xC3, 0xED, 0x35, 0x8B, 0x43, 0xA6,
-    0x64, 0xA9, 0xA6, 0xB6, 0x01, 0x2C, 0x49, 0x6D, 0x97, 0xD4, 0xC2, 0x2F, 0x73, 0x3D, 0xAC, 0xAC,
-    0x22, 0xB5, 0x07, 0x27, 0xF1, 0x1D, 0x72, 0x9C, 0xB7, 0x94, 0x93, 0xA0, 0xE3, 0xCC, 0x2D, 0xEE,
-    0x66, 0xDF, 0x21, 0x87, 0xA1, 0xD7, 0xE8, 0xF5, 0x96, 0xE3, 0x8A, 0x24, 0xDB, 0x9E, 0x49, 0xD9,
-    0xC5, 0xDE, 0x85, 0x70, 0x1D, 0xCC, 0xAC, 0xA4, 0x51, 0x15, 0x69, 0xED, 0x18, 0x03, 0xBA, 0x01,
-    0x82, 0xFD, 0xDC, 0xF5, 0xFE, 0x28, 0x28, 0x58, 0x47, 0xE0, 0x0E, 0xD9, 0x10, 0x71, 0x0F, 0xA2,
-    0x81, 0x7E, 0x38, 0x96, 0xA3, 0x8F, 0xF5, 0x90, 0x0E, 0x12, 0x8F, 0xA8, 0xB7, 0xC4, 0x46, 0x8A,
-    0xFA, 0x42, 0x3F, 0x4C, 0xF5, 0x12, 0xCD, 0x85, 0xDA, 0xCF, 0xF4, 0xF6, 0x89, 0x3E, 0x8C, 0x3D,
-    0x8F, 0x37, 0x58, 0x06, 0xDC, 0x9E, 0x08, 0x3D, 0x1F, 0xB1, 0x2E, 0x9A, 0x67, 0x91, 0x3E, 0x99,
-    0x20, 0xEC, 0x7A, 0x3A, 0x15, 0xD8, 0xA6, 0x10, 0x49, 0x69, 0xD8, 0x3E, 0x56, 0xB7, 0x67, 0x04,
-    0xB0, 0x4C, 0x86, 0xD5, 0x2D, 0x3D, 0xA6, 0x08, 0x4E, 0xC3, 0x25, 0x10, 0xD5, 0x02, 0xB3, 0x9E,
-    0x4A, 0xDD, 0x59, 0xAF, 0x99, 0x58, 0x35, 0x37, 0xD3, 0x4C, 0x35, 0x0A, 0xFE, 0x7F, 0xFE, 0x3B,
-    0xD6, 0x13, 0xF7, 0x2D, 0xF5, 0x29, 0x8C, 0xE0, 0x21, 0xFD, 0x9C, 0xD1, 0x9B, 0x08, 0x88, 0x19,
-    0xE1, 0xB4, 0x82, 0x33, 0x76, 0xDD, 0x28, 0xBF, 0x2A, 0x1D, 0x37, 0x1F, 0x13, 0xC1, 0xBD, 0x54,
-    0x79, 0x53, 0x77, 0x1E, 0xB2, 0x4B, 0x1E, 0xED, 0xD1, 0xAE, 0x57, 0xE4, 0xCE, 0x44, 0x63, 0xB5,
-    0xC9, 0x23, 0xA0, 0x5E, 0xA9, 0x85, 0x77, 0xB0, 0x79, 0x04, 0x04, 0x77, 0xAB, 0xE1, 0xFC, 0x86,
-    0x3D, 0x64, 0xDF, 0x3D, 0xEC, 0x29, 0x74, 0x8B, 0x3D, 0x8D, 0xC6, 0x5A, 0x8E, 0x8B, 0x23, 0xF8,
-    0xF7, 0x69, 0x4F, 0x58, 0x8F, 0x64, 0x0F, 0xC4, 0x75, 0x10, 0x3C, 0x14, 0xEB, 0x30, 0xF9, 0x51,
-    0x3B, 0x1F, 0xFB, 0xEB, 0x2E, 0xFA, 0xDC, 0x47, 0xC4, 0x1C, 0xA2, 0xC5, 0xA1, 0xF6, 0x4E, 0x7D,
-    0x06, 0x5A, 0xDD, 0xF8, 0x5B, 0x1B, 0xA2, 0x73, 0x90, 0x1D, 0x13, 0x36, 0x3E, 0xAC, 0xE3, 0x61,
-    0xA5, 0xCA, 0x12, 0x4D, 0x7E, 0xFA, 0x12, 0xD9, 0x2A, 0x2B, 0xF5, 0x43, 0x49, 0xF9, 0xA6, 0xA9,
-    0xAD, 0xB0, 0xCA, 0x1F, 0x1B, 0xC4, 0xD2, 0xFF, 0xF9, 0x05, 0x9D, 0x16, 0x3C, 0x56, 0x8E, 0x13,
-    0x60, 0xCA, 0x0D, 0x61, 0x69, 0xA5, 0xA9, 0x9D, 0xA9, 0xB0, 0x56, 0xF7, 0x79, 0x96, 0xC2, 0x51,
-    0xA9, 0xF4, 0x35, 0x18, 0x4A, 0xE1, 0xA8, 0xB4, 0xF5, 0x3E, 0x39, 0x5D, 0x8A, 0x06, 0xDD, 0x6E,
-    0x6A, 0xAA, 0xCC, 0xE4, 0xA6, 0x67, 0xBF, 0x35, 0x2F, 0xA2, 0x95, 0xAA, 0xA1, 0xB4, 0xF6, 0x46,
-    0xF7, 0x6E, 0x9C, 0x9A, 0x1B, 0x72, 0xE6, 0x91, 0x89, 0x06, 0xED, 0x59, 0xB8, 0x5F, 0x15, 0x66,
-    0x63, 0x4B, 0x1E, 0x86, 0xFB, 0xEF, 0x2A, 0x76, 0x7A, 0xBE, 0x0B, 0x7D, 0x36, 0x14, 0xF7, 0x86,
-    0x69, 0x1D, 0x4F, 0xDA, 0x98, 0x6B, 0x12, 0x6E, 0xEB, 0xA5, 0xDE, 0xCF, 0x44, 0x0E, 0xE6, 0xC1,
-    0x0E, 0x9C, 0x9F, 0xC2, 0xDB, 0x68, 0xAB, 0xB1, 0xC0, 0xA4, 0x22, 0x69, 0x36, 0x55, 0x15, 0xE6,
-    0x0F, 0x8A, 0x61, 0x76, 0xD8, 0x81, 0x2F, 0x9D, 0x39, 0x82, 0xD4, 0x66, 0x25, 0x3D, 0xAD, 0x10,
-    0x37, 0x0B, 0x7B, 0xE2, 0x03, 0x71, 0x94, 0x03, 0x37, 0x86, 0xE0, 0xDE, 0x7F, 0xD8, 0x76, 0xB5,
-    0x6C, 0x3F, 0xE1, 0x0F, 0x32, 0x6A, 0xC8, 0xA8, 0xCE, 0xE2, 0xD3, 0x35, 0x4C, 0x89, 0xBA, 0xCB,
-    0x9F, 0x63, 0xD4, 0xB1, 0xC9, 0xAE, 0xB1, 0x8F, 0x06, 0xE7, 0xA0, 0xC2, 0x50, 0xCD, 0x78, 0xA1,
-    0xBC, 0x99, 0x88, 0xE0, 0xBB, 0x44, 0x92, 0xA2, 0xB7, 0x68, 0xD5, 0x74, 0xEF, 0x81, 0xB5, 0x28,
-    0x73, 0x75, 0xB6, 0xC8, 0xBD, 0xA7, 0x85, 0x77, 0xB3, 0xD0, 0x98, 0x32, 0x55, 0x88, 0x73, 0x68,
-    0x2F, 0x1D, 0x1A, 0xAB, 0x19, 0xFC, 0x56, 0x16, 0x4C, 0x7E, 0xC0, 0x54, 0xE4, 0x8E, 0x5E, 0xB4,
-    0xB8, 0x47, 0xCF, 0xC3, 0x8C, 0xDC, 0x9D, 0x35, 0x35, 0xDD, 0xCF, 0x5F, 0x93, 0xAE, 0x0C, 0x39,
-    0x16, 0x53, 0x38, 0xB6, 0x22, 0xC5, 0xE6, 0x3A, 0xAF, 0x11, 0x88, 0x2A, 0xB0, 0x4E, 0x05, 0x32,
-    0x7E, 0x42, 0x61, 0x83, 0x4F, 0xD2, 0x36, 0x6A, 0xF3, 0x32, 0xE9, 0xE6, 0x3D, 0xFC, 0x7A, 0xFE,
-    0xC0, 0x7C, 0x7C, 0x7A, 0x4D, 0x0F, 0xFC, 0x27, 0xA6, 0x2E, 0xB9, 0xA2, 0xE4, 0xEA, 0x72, 0xA8,
-    0xDD, 0x7C, 0x29, 0xD8, 0x71, 0xC0, 0x99, 0x6F, 0x93, 0xD3, 0x85, 0x5E, 0x95, 0x7A, 0xB3, 0xA7,
-    0xB5, 0xE6, 0x57, 0xD4, 0x05, 0xCE, 0x72, 0xCB, 0x9F, 0xB6, 0x4A, 0xBB, 0xEA, 0xE1, 0xD0, 0x6C,
-    0xD3, 0xA7, 0xAC, 0xD2, 0x48, 0x00, 0x78, 0x80, 0x4E, 0x7C, 0xD1, 0x94, 0xB7, 0xC1, 0xD6, 0x93,
-    0x48, 0x2D, 0x07, 0x78, 0x51, 0x7C, 0x7B, 0xEB, 0x47, 0xA2, 0xAE, 0x3C, 0xEA, 0xF3, 0xA4, 0xF0,
-    0x26, 0x61, 0xC1, 0xA7, 0x92, 0x5F, 0x09, 0x5E, 0x58, 0x9E, 0x9D, 0x77, 0x6C, 0xEE, 0x4E, 0x90,
-    0x13, 0x24, 0x3B, 0x50, 0x0B, 0x7B, 0xDA, 0xEE, 0x98, 0xA6, 0xF7, 0x41, 0x3B, 0xB6, 0x4A, 0x8B,
-    0x20, 0x5D, 0xBE, 0x7C, 0x46, 0x52, 0x05, 0x0A, 0x5E, 0xD9, 0x85, 0x05, 0xCF, 0xF4, 0x9C, 0x93,
-    0x0C, 0xD2, 0xA7, 0x7B, 0x9E, 0x01, 0x69, 0xC6, 0x79, 0xD0, 0xFC, 0xF0, 0x2E, 0x08, 0x41, 0x99,
-    0x16, 0xAC, 0xFE, 0x16, 0xBC, 0x70, 0xD3, 0x9D, 0xAC, 0x94, 0x34, 0x3E, 0x36, 0xD0, 0xDC, 0xB7,
-    0x63, 0x70, 0x9E, 0x7E, 0x79, 0x07, 0x88, 0x88, 0x56, 0xF3, 0xE8, 0x1E, 0x88, 0x2D, 0x6D, 0x4A,
-    0xE1, 0x0B, 0x69, 0x34, 0x4C, 0x53, 0x24, 0xF3, 0x60, 0x3D, 0x83, 0x5F, 0x5D, 0xA9, 0x8A, 0x1A,
-    0x9E, 0xD4, 0x43, 0xC7, 0x63, 0xE6, 0x6D, 0x85, 0xED, 0x8C, 0x2E, 0xA6, 0x64, 0x3C, 0xFD, 0x79,
-    0x63, 0x34, 0xE7, 0x29, 0xE1, 0x19, 0x4D, 0xFE, 0xF4, 0xB1, 0xE1, 0x02, 0x46, 0xA8, 0x8C, 0xBA,
-    0xA9, 0xB5, 0x1E, 0x40, 0xA0, 0xAE, 0x99, 0xEA, 0x48, 0xA9, 0xE7, 0xDA, 0xD1, 0x3F, 0xC5, 0x4E,
-    0xB5, 0x9B, 0xD2, 0xD9, 0x1E, 0x67, 0xDA, 0x31, 0xE0, 0x8B, 0x0A, 0x80, 0x0F, 0x29, 0xA3, 0x51,
-    0xC6, 0x4F, 0x29, 0xE2, 0x27, 0xF7, 0xD5, 0x77, 0x62, 0xEB, 0x0F, 0x3C, 0x3B, 0xE5, 0x0F, 0xEC,
-    0x97, 0xE4, 0x63, 0x4C, 0x9A, 0xA7, 0xD3, 0xAB, 0x93, 0x55, 0xD1, 0xAF, 0xB2, 0xAD, 0x6D, 0x66,
-    0x17, 0x7E, 0x9E, 0x7B, 0x75, 0x36, 0x9C, 0x52, 0xB8, 0x0B, 0x1F, 0xDC, 0xAB, 0x0F, 0x39, 0x90,
-    0x22, 0xFC, 0x4C, 0x0F, 0xA4, 0x00, 0x39, 0x60, 0x64, 0x9D, 0x6B, 0x79, 0x20, 0x85, 0x6B, 0xF5,
-    0x40, 0x8A, 0x56, 0x3D, 0xAF, 0xDB, 0xB1, 0xE7, 0xF3, 0xA3, 0x20, 0x4D, 0xBE, 0xC7, 0xEC, 0x4B,
-    0x38, 0x49, 0x48, 0xCF, 0xF1, 0x4D, 0x61, 0x82, 0xDC, 0xE4, 0xAD, 0x57, 0x93, 0xE4, 0xBD, 0xC5,
-    0xF9, 0x0E, 0x69, 0x13, 0x34, 0xF5, 0x8C, 0x3A, 0xF6, 0xCE, 0x2C, 0x85, 0x82, 0x1B, 0x78, 0x26,
-    0xBD, 0x9E, 0xF7, 0xE2, 0x39, 0xDD, 0x11, 0x9E, 0x09, 0x17, 0x3D, 0x79, 0x7E, 0xC7, 0x77, 0x75,
-    0x94, 0xA8, 0xD5, 0x57, 0xF0, 0xC2, 0xF0, 0xD2, 0x11, 0x09, 0xDA, 0x6F, 0xF8, 0xB3, 0x71, 0x7F,
-    0xFF, 0xCC, 0x42, 0xEA, 0x0B, 0xDE, 0x91, 0xF3, 0xF3, 0x58, 0xC0, 0x39, 0x85, 0x9E, 0x27, 0x79,
-    0x48, 0x61, 0x97, 0x8B, 0x7B, 0xEC, 0x02, 0xB6, 0x86, 0xD0, 0x0E, 0xF1, 0xF9, 0x03, 0x77, 0x1A,
-    0xBF, 0x20, 0x8B, 0xFD, 0x1B, 0x7A, 0xEA, 0x4D, 0x30, 0xFB, 0x5B, 0xC1, 0xAA, 0x89, 0xD2, 0x58,
-    0x43, 0xE6, 0x7B, 0x3F, 0x1B, 0x8F, 0x05, 0xC9, 0x47, 0xC6, 0x0B, 0x7A, 0x99, 0x26, 0x66, 0xF9,
-    0x4B, 0xDA, 0x27, 0x88, 0x5B, 0xC3, 0xBD, 0x9E, 0xE8, 0x93, 0xB8, 0xF7, 0x6F, 0x69, 0xD6, 0x64,
-    0x25, 0x2D, 0x91, 0xF3, 0x89, 0x6C, 0x06, 0xC7, 0x87, 0x46, 0x0F, 0xE3, 0x3B, 0x1C, 0x0E, 0xE5,
-    0x3B, 0x17, 0x3B, 0x7F, 0x6E, 0xD0, 0x83, 0xF1, 0xE0, 0x93, 0xF1, 0x18, 0x78, 0xA1, 0xCA, 0x05,
-    0xD3, 0xFD, 0x5C, 0x1C, 0x15, 0x03, 0xA2, 0xDA, 0xB7, 0xFB, 0x2D, 0x7F, 0x14, 0x42, 0x1F, 0x58,
-    0xF0, 0x28, 0x88, 0xEB, 0x77, 0x98, 0x8C, 0xF0, 0x86, 0x85, 0x61, 0xEC, 0x21, 0x67, 0xE7, 0x19,
-    0x9C, 0x81, 0xE8, 0x9A, 0xF3, 0x48, 0x28, 0x58, 0x04, 0x8F, 0x72, 0xEA, 0xEE, 0x73, 0x19, 0x60,
-    0xB4, 0xDC, 0x83, 0x35, 0x61, 0x1B, 0xBD, 0x8A, 0xBC, 0xF0, 0x7F, 0x0C, 0xE1, 0x9D, 0xC2, 0x2A,
-    0x07, 0x53, 0x73, 0x9D, 0x42, 0x53, 0x7A, 0x1B, 0xFB, 0x65, 0xCC, 0x10, 0xBD, 0xE8, 0x81, 0x70,
-    0x3F, 0x75, 0x06, 0x3B, 0x5B, 0xF6, 0x0B, 0x1E, 0xF7, 0x74, 0x06, 0xF8, 0xB6, 0x07, 0x95, 0x82,
-    0x04, 0xB9, 0xCB, 0xE9, 0xCC, 0xEC, 0x1C, 0xC5, 0x15, 0xF9, 0xF4, 0x5D, 0x17, 0x1C, 0x93, 0xE4,
-    0x7F, 0x7B, 0x17, 0xFC, 0xF6, 0x38, 0x59, 0x4C, 0xB1, 0xB9, 0x28, 0xD3, 0xBF, 0x0B, 0x5F, 0x41,
-    0xF2, 0xA7, 0xFB, 0x76, 0x72, 0x99, 0x4F, 0xFC, 0x54, 0x3A, 0x38, 0xAB, 0x57, 0xAE, 0xCF, 0x26,
-    0xA6, 0x1E, 0xD7, 0xD4, 0xAB, 0x9F, 0x0A, 0x32, 0x13, 0xC9, 0x59, 0xA9, 0x84, 0x4F, 0x81, 0x2B,
-    0xF7, 0x98, 0x28, 0x67, 0x9D, 0x7F, 0x62, 0x06, 0xA5, 0x36, 0x17, 0x11, 0xA1, 0xC3, 0x09, 0x18,
-    0x7D, 0xDE, 0xC9, 0xF4, 0xCB, 0xE1, 0x31, 0x9C, 0x37, 0x03, 0xA8, 0x1F, 0x0B, 0x8C, 0x25, 0xD9,
-    0x03, 0x1F, 0x8B, 0x9B, 0x1B, 0xB7, 0x3D, 0xF1, 0xB1, 0x57, 0x73, 0x1F, 0x78, 0x15, 0xFB, 0xA8,
-    0x2B, 0x3A, 0x7E, 0xB5, 0x76, 0x9E, 0x17, 0xE4, 0x6B, 0x06, 0x46, 0x21, 0xF6, 0xE9, 0x87, 0xAA,
-    0x26, 0x47, 0xC0, 0x1D, 0x79, 0xAA, 0xC0, 0xFD, 0xCC, 0xFD, 0x64, 0xB1, 0xB8, 0x3A, 0xCA, 0xFA,
-    0xE9, 0x4F, 0x95, 0xCF, 0x52, 0xEF, 0xFB, 0x1F, 0x0D, 0x41, 0x00, 0x2F, 0xE1, 0x62, 0x24, 0x25,
-    0x1B, 0x02, 0x28, 0x26, 0xDE, 0x35, 0x6B, 0x1B, 0x33, 0x36, 0x6C, 0x04, 0xAC, 0xC2, 0x2F, 0x59,
-    0x7D, 0x0E, 0x68, 0x8A, 0xD6, 0xE8, 0x52, 0xAB, 0xB3, 0x9D, 0xE4, 0x6D, 0xED, 0x49, 0xFD, 0x79,
-    0x4F, 0x07, 0x43, 0x02, 0x16, 0x7F, 0x5E, 0xC8, 0x95, 0x13, 0x6B, 0xB0, 0xE9, 0x98, 0xBB, 0xAD,
-    0x3F, 0x5C, 0xD1, 0x09, 0x37, 0x10, 0x97, 0x3C, 0x48, 0x31, 0x7D, 0x93, 0x5E, 0xE7, 0xE9, 0x5B,
-    0x60, 0x84, 0x36, 0xE9, 0x7D, 0x77, 0x67, 0x65, 0xC9, 0x6B, 0x35, 0xF0, 0x59, 0xD0, 0x81, 0xF3,
-    0x67, 0xCB, 0x2F, 0x47, 0x1A, 0x17, 0x6B, 0x8D, 0x6F, 0x02, 0xC4, 0xF3, 0xA5, 0x4F, 0x79, 0x43,
-    0xCA, 0xB1, 0x1C, 0x0E, 0x39, 0x84, 0xFD, 0x41, 0xB3, 0xC9, 0xED, 0x2A, 0x1A, 0xBE, 0xA0, 0xC3,
-    0x33, 0x19, 0x86, 0x27, 0x3F, 0x3D, 0x3C, 0xC3, 0x01, 0xAE, 0xF1, 0xA7, 0x2A, 0x5C, 0x74, 0x74,
-    0x7F, 0xA8, 0xA3, 0xFB, 0xE6, 0x53, 0x18, 0x5D, 0xF5, 0x78, 0xC5, 0x19, 0xCF, 0x17, 0x44, 0xB0,
-    0x69, 0x17, 0x9A, 0x3B, 0x37, 0xB3, 0x51, 0xA2, 0x6B, 0xF8, 0x44, 0x95, 0x83, 0x9F, 0xEA, 0x6F,
-    0x46, 0x1B, 0x18, 0xC9, 0xDF, 0xF0, 0xFC, 0x9D, 0xC8, 0x34, 0xB7, 0x8C, 0x1B, 0xCF, 0x5B, 0x24,
-    0xE6, 0x7A, 0x5A, 0xDC, 0xF5, 0x4A, 0xB4, 0x74, 0xF0, 0x9E, 0x8C, 0x86, 0x1B, 0xA9, 0xE3, 0x38,
-    0xFB, 0xE7, 0xEF, 0x0E, 0x75, 0xDE, 0x3D, 0xD4, 0x59, 0xD3, 0xC8, 0x51, 0x4D, 0x60, 0x63, 0x6D,
-    0x21, 0xC1, 0x3E, 0x9F, 0x5C, 0x30, 0xA4, 0x94, 0x43, 0x7D, 0xFB, 0x6C, 0x37, 0x5E, 0x6C, 0x9B,
-    0x5D, 0xEE, 0xD9, 0x3D, 0x5E, 0x84, 0xC7, 0x19, 0x6F, 0x86, 0xE3, 0x8C, 0xF5, 0x40, 0xE1, 0x84,
-    0x07, 0x09, 0xE5, 0xE3, 0x83, 0x84, 0xD6, 0x96, 0xA6, 0xAA, 0xE0, 0x11, 0xAD, 0x48, 0x52, 0xE2,
-    0xF3, 0x2C, 0x17, 0x1F, 0xD3, 0x37, 0xC0, 0xA7, 0x4F, 0xE9, 0x33, 0x8B, 0x4C, 0xD4, 0x94, 0xF0,
-    0x3A, 0xC8, 0xC5, 0xBD, 0xF0, 0x98, 0x8E, 0x57, 0x13, 0x4D, 0x53, 0x55, 0xB4, 0x74, 0xB3, 0x22,
-    0xE4, 0x31, 0x58, 0x30, 0x2B, 0x9E, 0x03, 0xB7, 0x71, 0x25, 0xA6, 0x66, 0xD4, 0xAD, 0x45, 0xDE,
-    0xDF, 0xDF, 0x32, 0xEB, 0x6B, 0x39, 0x98, 0xCD, 0x55, 0xF7, 0xA6, 0x09, 0x54, 0x8F, 0xCC, 0x4E,
-    0x42, 0xC5, 0x35, 0xBD, 0xAF, 0x72, 0xB8, 0x31, 0x86, 0x3C, 0x47, 0x55, 0xE3, 0xA1, 0x22, 0x9E,
-    0x5E, 0x0C, 0xDD, 0x05, 0x4F, 0x32, 0x0A, 0xD2, 0x13, 0x8D, 0xFA, 0xB5, 0x50, 0xDF, 0xDE, 0xEF,
-    0x5C, 0x5B, 0xD7, 0x48, 0x86, 0xC1, 0xE6, 0xE6, 0x62, 0x99, 0xD9, 0x11, 0x43, 0xFE, 0xB8, 0x21,
-    0xCD, 0xEA, 0x12, 0x7A, 0x38, 0x3A, 0x4F, 0x6B, 0x9B, 0xDE, 0x01, 0x43, 0x15, 0xDE, 0xB1, 0xD4,
-    0x06, 0x2D, 0x61, 0x3D, 0x04, 0x98, 0x17, 0xE3, 0x60, 0xDF, 0x21, 0x33, 0x82, 0x53, 0x61, 0x4D,
-    0xF1, 0xF4, 0x14, 0xCE, 0xCC, 0xED, 0x44, 0x5F, 0x33, 0xDB, 0xC3, 0x73, 0xC3, 0x34, 0xBC, 0x8E,
-    0x71, 0x67, 0xB8, 0x55, 0x1C, 0x1B, 0x4E, 0xF6, 0xB0, 0x36, 0x71, 0x38, 0xB3, 0x34, 0xC8, 0x0D,
-    0x17, 0x46, 0x8A, 0x8D, 0x24, 0xBF, 0xA4, 0x51, 0xD3, 0xB5, 0x79, 0xC7, 0xD1, 0x2D, 0x60, 0x6A,
-    0xBE, 0xDE, 0xC4, 0x8D, 0x2E, 0x25, 0x75, 0xBC, 0x2E, 0xCA, 0x3D, 0x5F, 0x6F, 0x1F, 0xD5, 0xB1,
-    0xF4, 0x81, 0x92, 0xE7, 0xF9, 0x7A, 0xC3, 0xEE, 0x05, 0x5F, 0x7A, 0x0B, 0x7B, 0xDD, 0x45, 0x49,
-    0xCF, 0xB3, 0xCC, 0x92, 0x3A, 0x1C, 0xA1, 0xD4, 0x50, 0x75, 0x06, 0xCA, 0x15, 0x15, 0x1B, 0x22,
-    0x23, 0x79, 0xF0, 0x71, 0xB6, 0x3C, 0x02, 0x65, 0xF0, 0xDF, 0xA1, 0xFB, 0x86, 0x63, 0x12, 0xBC,
-    0xC8, 0x1A, 0x4D, 0xDB, 0x55, 0xEB, 0xC1, 0x51, 0x95, 0x29, 0x21, 0xA9, 0x35, 0x4F, 0x37, 0x83,
-    0x8B, 0xFE, 0xD6, 0x97, 0xDD, 0x6F, 0x4E, 0xCB, 0x91, 0x43, 0xBB, 0x0F, 0xD0, 0x5D, 0x04, 0xF9,
-    0xF6, 0x20, 0xE0, 0xFA, 0x91, 0x21, 0x0D, 0x8C, 0x6A, 0x6E, 0x3C, 0x03, 0xEA, 0xB7, 0x8F, 0xF7,
-    0xE4, 0x11, 0x3C, 0x95, 0x2F, 0x67, 0x63, 0x5E, 0x90, 0xF3, 0x3B, 0x85, 0x9D, 0xCC, 0x0B, 0x5F,
-    0x0A, 0xC7, 0x3C, 0x1F, 0x8E, 0x09, 0x1B, 0xB6, 0x5E, 0x90, 0x58, 0x7A, 0xB4, 0x0D, 0x3E, 0x04,
-    0xC0, 0xEC, 0xB8, 0xA7, 0x2B, 0xD6, 0xCF, 0x2E, 0x70, 0xAF, 0x9A, 0x1E, 0x83, 0x68, 0x00, 0x31,
-    0x12, 0xA2, 0x0B, 0x97, 0x1E, 0xFD, 0x5C, 0x13, 0xC8, 0xD7, 0x9A, 0x3C, 0x87, 0x62, 0xDE, 0x81,
-    0xCF, 0x54, 0x60, 0x56, 0xFD, 0x27, 0x67, 0x95, 0x7D, 0x1A, 0x56, 0xE1, 0xAD, 0xB5, 0x3A, 0xD8,
-    0xC5, 0xBD, 0x61, 0x23, 0x1D, 0x51, 0xBB, 0xCB, 0x81, 0x79, 0x6F, 0x6C, 0x1F, 0x7A, 0x3B, 0xD8,
-    0xDF, 0xAA, 0x1D, 0x26, 0x12, 0x4B, 0xF0, 0xF3, 0x67, 0xF8, 0x37, 0x89, 0xDB, 0x0E, 0x28, 0x19,
-    0x07, 0xE9, 0xCF, 0x76, 0xB8, 0xB8, 0x68, 0x47, 0x9D, 0x78, 0xE9, 0x28, 0xF8, 0xF4, 0x73, 0x1F,
-    0x03, 0x45, 0x4F, 0xA7, 0x10, 0xB2, 0xF9, 0x1F, 0x16, 0x67, 0xCA, 0xE6, 0x05, 0x65, 0xF3, 0xF0,
-    0xF0, 0xAC, 0x94, 0x95, 0x9A, 0xE0, 0xF8, 0x81, 0xF0, 0xE2, 0xDA, 0xF6, 0x32, 0x50, 0x59, 0xBE,
-    0x52, 0x6F, 0x9C, 0x07, 0x80, 0xC2, 0x80, 0xC8, 0xA9, 0x50, 0x92, 0x50, 0x45, 0x42, 0x05, 0x89,
-    0xAA, 0x47, 0x4C, 0x39, 0x32, 0x00, 0x4B, 0x30, 0xB5, 0x0B, 0xDA, 0xE0, 0x61, 0x40, 0xBA, 0x38,
-    0x57, 0x45, 0xEB, 0x5A, 0xB3, 0xED, 0xA6, 0x2C, 0xD0, 0x5F, 0xCC, 0x0A, 0xEA, 0xD0, 0x5D, 0xFA,
-    0xC2, 0x46, 0xF7, 0xB8, 0xE2, 0x83, 0x0A, 0x39, 0xC0, 0xA4, 0xF0, 0x5E, 0xAD, 0x69, 0xFB, 0x8A,
-    0xF7, 0x9A, 0x60, 0xD6, 0xA2, 0xF0, 0xAE, 0x2C, 0x59, 0x24, 0x29, 0x2B, 0xFE, 0x5C, 0x16, 0x70,
-    0x8D, 0xC2, 0x3B, 0xC2, 0xAF, 0x54, 0x2C, 0xC8, 0x8E, 0x8B, 0x44, 0x27, 0xC5, 0xDB, 0x52, 0x40,
-    0xD4, 0x6D, 0x51, 0xBA, 0x65, 0xFE, 0x43, 0x2D, 0xAC, 0x8B, 0x57, 0x59, 0x28, 0xD6, 0x38, 0x71,
-    0x06, 0x61, 0x4B, 0x6F, 0xC3, 0x44, 0x8B, 0xC2, 0x47, 0xBD, 0x16, 0x92, 0x8F, 0x3B, 0x2D, 0xC4,
-    0x38, 0x87, 0x64, 0xCD, 0x50, 0xA7, 0x46, 0x0B, 0xC2, 0xCA, 0x63, 0x27, 0x46, 0x6E, 0x6C, 0xA4,
-    0x90, 0x6B, 0x0A, 0x4D, 0xEA, 0x2C, 0x54, 0x14, 0x4A, 0x6F, 0x10, 0xF8, 0x02, 0x49, 0x33, 0xC2,
-    0xAD, 0x12, 0x34, 0xF5, 0xE2, 0x96, 0xDF, 0xC6, 0x82, 0xAD, 0x48, 0xB6, 0x0E, 0x76, 0x76, 0xB2,
-    0x61, 0x2B, 0x1B, 0xF6, 0x32, 0x14, 0x2E, 0xCB, 0x0E, 0x16, 0x32, 0xA5, 0x21, 0xB9, 0x34, 0x06,
-    0xE5, 0x40, 0x23, 0xD3, 0xA8, 0x0D, 0x38, 0xD2, 0x02, 0xB2, 0xA2, 0xB1, 0xD0, 0xF0, 0x2F, 0x48,
-    0xEF, 0x0B, 0xFB, 0xF2, 0x01, 0x0A, 0x1F, 0x0B, 0x03, 0xF7, 0x1E, 0x0B, 0xC2, 0x1B, 0xFF, 0x31,
-    0x0A, 0x1F, 0x4A, 0x01, 0x82, 0x42, 0x5A, 0xB9, 0xDF, 0xB3, 0x42, 0xF1, 0x56, 0xA7, 0x85, 0xFC,
-    0x47, 0xAD, 0x16, 0xD2, 0x9F, 0x37, 0x5A, 0x48, 0x64, 0x1A, 0xB3, 0x10, 0xBB, 0x4A, 0x0B, 0x91,
-    0xDB, 0x68, 0x01, 0x32, 0x99, 0xD3, 0x5C, 0x88, 0x43, 0x61, 0x19, 0x33, 0x23, 0x5C, 0xE8, 0x46,
-    0x1E, 0x08, 0x33, 0x2F, 0xE9, 0x45, 0x43, 0xC1, 0x87, 0x7D, 0xC4, 0x3E, 0x42, 0x6E, 0x1B, 0xF6,
-    0x3F, 0xE8, 0x7F, 0x37, 0x5B, 0xFF, 0x85, 0xCF, 0x42, 0xA4, 0x92, 0xCA, 0xD2, 0x78, 0xD0, 0x86,
-    0xCA, 0x22, 0xBD, 0x34, 0xF2, 0x19, 0xB0, 0xBC, 0x1F, 0xC1, 0x95, 0xB3, 0x62, 0xEF, 0x12, 0xFD,
-    0x30, 0xD5, 0xF1, 0xCD, 0x2D, 0xAD, 0x9C, 0xB7, 0x9C, 0x6A, 0x88, 0xC0, 0xAD, 0x9A, 0x0F, 0x7B,
-    0x59, 0xAD, 0x2F, 0x91, 0x72, 0xF4, 0x7A, 0x74, 0xBB, 0xB9, 0xD5, 0x75, 0x33, 0xCD, 0xE9, 0x3D,
-    0x55, 0xBB, 0xD5, 0x44, 0xB3, 0xA6, 0x86, 0x96, 0xC5, 0x53, 0x0D, 0x3B, 0x81, 0x1D, 0xF0, 0xC9,
-    0xDE, 0xD8, 0x86, 0x31, 0xA9, 0xED, 0xC8, 0x41, 0x79, 0x7D, 0x67, 0x55, 0x98, 0x27, 0x1F, 0xED,
-    0x57, 0x4C, 0x53, 0xA0, 0x91, 0x52, 0x9A, 0x77, 0x6B, 0x4D, 0xAB, 0x99, 0xCA, 0x51, 0x60, 0x76,
-    0xDD, 0x32, 0x41, 0x36, 0x40, 0x19, 0x84, 0x02, 0xE7, 0x54, 0xA7, 0xA6, 0xE5, 0x46, 0xC4, 0x48,
-    0x33, 0x36, 0xFA, 0x1F, 0x14, 0x37, 0xF8, 0x66, 0x5A, 0xD6, 0x18, 0xC0, 0x55, 0x85, 0xFD, 0x8B,
-    0xF2, 0x94, 0x6B, 0x6A, 0xDD, 0xF4, 0xC6, 0xEF, 0x4B, 0x2B, 0x59, 0x43, 0x05, 0x0D, 0x41, 0x3C,
-    0xDF, 0xE7, 0xA4, 0x68, 0x19, 0x7F, 0x84, 0xDC, 0xF9, 0xC3, 0x69, 0x97, 0x79, 0x8B, 0x43, 0x41,
-    0x87, 0x23, 0x80, 0x3E, 0xC0, 0x11, 0x40, 0xDF, 0x6C, 0x27, 0xAE, 0x93, 0x89, 0x73, 0x79, 0x24,
-    0x3F, 0x4D, 0x9B, 0x29, 0x3B, 0xAA, 0x23, 0x25, 0x17, 0x44, 0x87, 0xBE, 0x96, 0x72, 0x59, 0x78,
-    0x3D, 0xBC, 0xF1, 0xC5, 0x1A, 0x0A, 0xA5, 0x1A, 0x41, 0x21, 0xCC, 0xE4, 0x12, 0x24, 0x85, 0x6A,
-    0x8F, 0x4C, 0x1A, 0xF4, 0x4F, 0xE5, 0xDF, 0x58, 0xE3, 0xF4, 0x94, 0x87, 0xC2, 0x99, 0xC0, 0x39,
-    0xF1, 0x85, 0xA9, 0x2F, 0xCC, 0x7C, 0x21, 0xF2, 0x05, 0xA6, 0x4C, 0x08, 0x4C, 0x80, 0x35, 0x7E,
-    0xCA, 0x0A, 0xC5, 0xC6, 0x0A, 0x90, 0x40, 0x8D, 0x1E, 0x5A, 0x78, 0xAD, 0xCB, 0xF4, 0xF4, 0x5F,
-    0x88, 0xC6, 0x7A, 0xA2, 0x4F, 0x6F, 0x05, 0xCA, 0xA1, 0x8E, 0x09, 0x2B, 0x84, 0x81, 0xF7, 0x47,
-    0x23, 0xB6, 0x5E, 0x43, 0xD0, 0xFA, 0xFA, 0xED, 0xA8, 0xAC, 0xA6, 0xE8, 0xFA, 0xD6, 0x14, 0xD0,
-    0x9A, 0xC5, 0x8B, 0xF6, 0xD2, 0xD5, 0xEA, 0x5A, 0xDC, 0x99, 0x3C, 0x90, 0x9A, 0x59, 0x84, 0x07,
-    0xC7, 0xB3, 0x80, 0x11, 0x50, 0x51, 0xE1, 0xC0, 0x5D, 0xC3, 0x31, 0x80, 0xF2, 0xBC, 0x2E, 0xB6,
-    0x93, 0x0E, 0x0A, 0x67, 0x71, 0x80, 0xD6, 0xD9, 0x72, 0x5F, 0x13, 0xF0, 0x64, 0xE5, 0xD8, 0x7A,
-    0x3B, 0xB2, 0xB4, 0x05, 0x32, 0x47, 0xA5, 0xE3, 0x85, 0xB1, 0xE9, 0x43, 0x53, 0xCF, 0x59, 0x2E,
-    0x10, 0x97, 0xE0, 0xB8, 0x6C, 0x30, 0xB0, 0x9D, 0x65, 0x36, 0x68, 0x86, 0x0C, 0x07, 0x14, 0x5B,
-    0xE1, 0xB8, 0xD9, 0x53, 0x86, 0x85, 0x7B, 0x7C, 0xF8, 0x3D, 0xD3, 0xF3, 0xE1, 0xD8, 0xDC, 0xC6,
-    0x8E, 0xD9, 0x2D, 0x51, 0x86, 0xAB, 0xCF, 0x01, 0x9C, 0xDA, 0x20, 0x2E, 0x69, 0x6A, 0x29, 0x11,
-    0x2D, 0x66, 0x9D, 0xD0, 0xE7, 0x36, 0xB9, 0x77, 0x8C, 0x11, 0xAC, 0xE9, 0x22, 0x74, 0x3C, 0x4A,
-    0x67, 0x4D, 0xB5, 0x39, 0xDB, 0xE1, 0xFF, 0x28, 0x41, 0x9F, 0xFA, 0x53, 0x8E, 0xB4, 0xDD, 0xF9,
-    0xBB, 0xBB, 0x38, 0x3A, 0xF3, 0x5A, 0xFC, 0x9D, 0xAC, 0x56, 0x7B, 0xCF, 0x95, 0xDD, 0x75, 0x99,
-    0x1A, 0x4D, 0x71, 0xA0, 0x29, 0xCC, 0xE0, 0x44, 0x47, 0xAC, 0xD9, 0x2E, 0x4D, 0x19, 0xCE, 0xA2,
-    0x09, 0x76, 0xCE, 0xA2, 0x41, 0x22, 0x12, 0x4D, 0xBD, 0xD1, 0xB1, 0x3F, 0xC1, 0x25, 0x2A, 0xAB,
-    0x32, 0x02, 0xBB, 0x5E, 0x37, 0xB1, 0x9A, 0xDB, 0xA5, 0xD3, 0x98, 0xB8, 0x4F, 0x63, 0x4A, 0x73,
-    0x3B, 0x8B, 0xC6, 0x4E, 0x2F, 0xF5, 0x21, 0xE4, 0xFC, 0xC0, 0x12, 0x5A, 0x58, 0x92, 0xDC, 0xC4,
-    0x3B, 0x61, 0xDD, 0x81, 0xB9, 0x2C, 0xB9, 0x4D, 0x59, 0xFB, 0x57, 0x06, 0x9F, 0x23, 0x3B, 0x7A,
-    0xD8, 0xAB, 0x15, 0xB7, 0xDA, 0x45, 0xE8, 0x5C, 0x5F, 0xDC, 0xCB, 0x84, 0xB8, 0x8F, 0x84, 0xAD,
-    0x7F, 0x49, 0x95, 0x5F, 0x96, 0x9F, 0x0D, 0xDA, 0x00, 0x4A, 0x43, 0xC8, 0xA5, 0x6B, 0x87, 0xBD,
-    0x61, 0x22, 0xCD, 0x91, 0x62, 0xAC, 0xF5, 0x1E, 0x89, 0x96, 0x9C, 0xDD, 0xDC, 0x9A, 0x86, 0x14,
-    0x88, 0xAA, 0x18, 0x7F, 0xA5, 0xA7, 0x64, 0xD5, 0x70, 0xDD, 0x31, 0x5F, 0x68, 0x19, 0xBD, 0x7F,
-    0xD5, 0x55, 0x5F, 0x1E, 0x47, 0xC2, 0xA8, 0x97, 0x76, 0xF7, 0xC2, 0x4A, 0x7A, 0x0F, 0x8B, 0x66,
-    0x04, 0x90, 0xF0, 0xB5, 0x63, 0x4E, 0x2E, 0x86, 0x8F, 0x21, 0xB1, 0x6C, 0xCD, 0x73, 0x9B, 0xA6,
-    0x3E, 0x35, 0x13, 0x5E, 0x5C, 0xFB, 0x43, 0x95, 0x2C, 0xB5, 0x5B, 0x4D, 0x7F, 0xAA, 0xA8, 0x35,
-    0x46, 0x4F, 0x51, 0x43, 0x34, 0xB9, 0x36, 0xB9, 0x7E, 0x8A, 0x16, 0x7F, 0x11, 0x7A, 0x9A, 0x3F,
-    0xC2, 0x2E, 0x04, 0x70, 0xE8, 0xCB, 0xE8, 0xD5, 0x17, 0x3A, 0xC8, 0x1C, 0xBF, 0x1D, 0xFC, 0xFB,
-    0x71, 0x5B, 0x3F, 0x93, 0x11, 0xD1, 0x95, 0xBD, 0x4C, 0x97, 0x9E, 0xCF, 0xDC, 0x6A, 0x4E, 0xB6,
-    0x71, 0xF3, 0x3E, 0x72, 0xFE, 0x79, 0xF9, 0xF7, 0x77, 0x9A, 0xDF, 0x0B, 0x69, 0x7E, 0xB7, 0x53,
-    0xBE, 0xD2, 0x44, 0x94, 0x41, 0xDC, 0x18, 0x03, 0x1B, 0xFB, 0x6D, 0x2D, 0xAA, 0xED, 0x13, 0x99,
-    0xFA, 0xD7, 0xCE, 0xEC, 0xD5, 0x67, 0x5A, 0xF3, 0x1B, 0x98, 0xB7, 0x64, 0xAF, 0x59, 0xF5, 0xED,
-    0x18, 0xE6, 0x10, 0xA6, 0x5D, 0xF9, 0xB7, 0x97, 0x50, 0xF6, 0xF3, 0x10, 0xCB, 0x77, 0x34, 0xA6,
-    0x52, 0x24, 0x4E, 0x0A, 0x40, 0x9F, 0xF6, 0xA8, 0xD3, 0xD3, 0x3D, 0x34, 0x9B, 0xC1, 0xF8, 0x54,
-    0x11, 0x0F, 0xA0, 0xB6, 0x78, 0x4D, 0x7A, 0x20, 0x73, 0x0A, 0x3B, 0x2A, 0x40, 0x37, 0x3B, 0x1F,
-    0xF5, 0x54, 0x59, 0xF7, 0xA6, 0xC3, 0xE6, 0x1D, 0x97, 0xAF, 0xAA, 0xD7, 0xC6, 0x90, 0x06, 0x71,
-    0x2B, 0xAE, 0xC7, 0xFD, 0x35, 0xAC, 0x84, 0xFE, 0xF0, 0xC0, 0xB5, 0xC3, 0xF1, 0x2D, 0x4C, 0xC7,
-    0x9B, 0x6D, 0x7B, 0x08, 0xFE, 0x35, 0x87, 0xBB, 0x75, 0x69, 0x52, 0x1F, 0xA0, 0xB4, 0x56, 0xF5,
-    0x33, 0x57, 0x42, 0xA8, 0x1E, 0x6A, 0x4B, 0x7B, 0x8D, 0x26, 0x1E, 0x54, 0x77, 0x65, 0xDB, 0xAD,
-    0x79, 0x50, 0x84, 0xA5, 0xBC, 0x51, 0x83, 0x62, 0x3A, 0x84, 0x1C, 0xC7, 0x43, 0x06, 0x6A, 0x1B,
-    0xBC, 0xDB, 0x48, 0x61, 0x0A, 0x92, 0x5F, 0x0D, 0x04, 0x3B, 0xE3, 0xF1, 0x82, 0x07, 0x45, 0xBF,
-    0xA4, 0xD6, 0xF6, 0x90, 0x3B, 0x44, 0xB5, 0x0B, 0xF5, 0xF3, 0x41, 0x2B, 0xC7, 0xC3, 0x37, 0x26,
-    0x84, 0x53, 0xC2, 0x39, 0x61, 0x64, 0x87, 0x72, 0x30, 0xCF, 0x02, 0x61, 0xF1, 0x01, 0xA0, 0x7B,
-    0xAF, 0x85, 0xFF, 0xF6, 0xCB, 0x2D, 0x2C, 0x14, 0xB1, 0xC0, 0x79, 0x07, 0x18, 0xB5, 0x80, 0x49,
-    0x8D, 0x03, 0x49, 0x45, 0xD8, 0x15, 0x58, 0x94, 0x80, 0xC8, 0xB4, 0x5E, 0x7C, 0x84, 0x30, 0xDC,
-    0xE2, 0x63, 0x26, 0xAB, 0x16, 0x81, 0x5A, 0x20, 0xC6, 0xB2, 0x2D, 0xF4, 0x00, 0x53, 0x9E, 0x79,
-    0x0C, 0xF5, 0x05, 0xE0, 0x92, 0x10, 0x4D, 0x04, 0xD3, 0x26, 0x0D, 0x85, 0xFD, 0x75, 0xE2, 0x63,
-    0xF6, 0x15, 0x04, 0xFE, 0x1C, 0xAF, 0xA7, 0x78, 0xFA, 0x91, 0x91, 0xF4, 0x0D, 0x3C, 0x8B, 0x91,
-    0x74, 0x9D, 0xB2, 0x3D, 0x0F, 0x9A, 0x40, 0xF9, 0x60, 0x79, 0xB0, 0x2B, 0xC0, 0x3E, 0x03, 0x1D,
-    0xAB, 0x69, 0x1D, 0xC3, 0x9E, 0x87, 0x72, 0x28, 0x98, 0x38, 0x28, 0xFC, 0xDE, 0xD8, 0x21, 0x45,
-    0x4F, 0xBB, 0x8B, 0xF7, 0xA4, 0xD3, 0x48, 0x91, 0x48, 0xA7, 0xED, 0x79, 0xD2, 0xE9, 0x03, 0xB3,
-    0x6F, 0xF7, 0x37, 0xA9, 0x94, 0xC6, 0xF1, 0xEA, 0x64, 0x86, 0x62, 0x95, 0x16, 0xE7, 0x0C, 0xEC,
-    0x03, 0xCD, 0x56, 0x23, 0xC9, 0xBA, 0xA8, 0x03, 0xEF, 0x83, 0x3A, 0xA0, 0x8D, 0xC6, 0x06, 0x6C,
-    0x46, 0xFF, 0xC3, 0x19, 0xA5, 0x7A, 0xA5, 0xDD, 0x97, 0xAB, 0xCC, 0x69, 0xCF, 0xB4, 0x37, 0x44,
-    0x0C, 0xAF, 0xC4, 0xDB, 0x5F, 0xB9, 0x60, 0xF6, 0xED, 0x31, 0xD3, 0xA1, 0x0C, 0x87, 0x32, 0x1B,
-    0xCA, 0x68, 0x9C, 0x66, 0x32, 0x90, 0x8F, 0xD6, 0x87, 0x61, 0xEC, 0x64, 0xEB, 0xFE, 0xE9, 0x36,
-    0x5B, 0x77, 0x37, 0x64, 0xEB, 0xF6, 0x79, 0x66, 0xB7, 0x96, 0xB3, 0x5D, 0xC8, 0x04, 0x87, 0x9A,
-    0x49, 0xD6, 0x7B, 0xE9, 0x22, 0x7F, 0xAC, 0x7A, 0xCE, 0x86, 0xC3, 0xE1, 0x2E, 0x6B, 0x9F, 0x2B,
-    0xD6, 0x1F, 0xC2, 0xF8, 0x77, 0xC9, 0xCF, 0x9F, 0x5C, 0xF2, 0xF3, 0xD1, 0xF4, 0x67, 0x2A, 0xDC,
-    0x76, 0x3C, 0xFD, 0xE7, 0xC3, 0xF4, 0xBF, 0xFE, 0x68, 0xD3, 0xFF, 0x19, 0xE9, 0xFF, 0xBD, 0xE9,
-    0xBF, 0x7E, 0xF8, 0xF4, 0xFF, 0x9C, 0x8C, 0xD7, 0xA4, 0x9D, 0x74, 0x1A, 0xE2, 0x0A, 0x62, 0xC2,
-    0x44, 0x36, 0x3D, 0x4F, 0x0C, 0xBC, 0x11, 0xDC, 0x38, 0x6B, 0x98, 0x92, 0xC1, 0xC0, 0x5D, 0x5A,
-    0x3E, 0xA1, 0x98, 0x14, 0xEA, 0x2B, 0x54, 0x7A, 0x0C, 0x2A, 0x6B, 0x9F, 0x81, 0x69, 0x9C, 0x2D,
-    0xA6, 0x3C, 0xE7, 0x90, 0xB1, 0x32, 0x58, 0xAD, 0x6E, 0x1A, 0xFF, 0x5A, 0x8E, 0xCC, 0xDF, 0xEB,
-    0xE1, 0x39, 0x32, 0x1E, 0x5F, 0xA3, 0x1B, 0x7A, 0xFA, 0xFA, 0x55, 0xE3, 0xCC, 0xEA, 0x51, 0x1D,
-    0x32, 0xB4, 0xF4, 0xF6, 0x8E, 0x6C, 0x16, 0x61, 0x9F, 0x4B, 0x70, 0xBC, 0x4C, 0x5A, 0x0B, 0x48,
-    0xAA, 0xB8, 0xDA, 0xDF, 0xE3, 0x9E, 0xEE, 0xE1, 0xC8, 0x9E, 0x69, 0x31, 0x17, 0x91, 0x5D, 0x34,
-    0x62, 0x68, 0xD4, 0x06, 0x64, 0xA9, 0x67, 0x2D, 0xEA, 0x3A, 0x6E, 0xBD, 0x47, 0x3F, 0x2D, 0x5F,
-    0x6A, 0x4B, 0xB7, 0xB0, 0x41, 0x15, 0x16, 0x34, 0x79, 0x7D, 0x45, 0x6B, 0x31, 0x0F, 0x9E, 0x02,
-    0x6F, 0x6D, 0x1E, 0xCC, 0xAA, 0xC1, 0xEC, 0x62, 0x75, 0x77, 0x4F, 0x54, 0xBB, 0x99, 0xAB, 0x69,
-    0xD6, 0x2B, 0x40, 0x4B, 0x15, 0xB0, 0x4C, 0xF6, 0xCA, 0xB6, 0x61, 0x55, 0x16, 0xAB, 0xA5, 0x9C,
-    0xDC, 0xC1, 0x4D, 0x93, 0xB5, 0x2C, 0x8B, 0x8B, 0xA6, 0xC3, 0x53, 0x41, 0x6D, 0x3E, 0x3E, 0x6D,
-    0xD9, 0xB7, 0x48, 0xE3, 0x11, 0xC7, 0x70, 0xD4, 0xD2, 0x67, 0xF1, 0x7C, 0xC5, 0x3D, 0x01, 0x30,
-    0xA6, 0x69, 0xC4, 0x0B, 0x7F, 0x26, 0xFA, 0x9D, 0x25, 0xF8, 0x7D, 0x21, 0xC6, 0xD4, 0x73, 0x90,
-    0x31, 0x39, 0xC8, 0xF4, 0x61, 0x1C, 0xE4, 0xB3, 0x39, 0xBE, 0x93, 0xD5, 0x73, 0xDF, 0xA5, 0xEC,
-    0x44, 0x06, 0x33, 0x6E, 0x34, 0x20, 0x6C, 0xA3, 0x99, 0x17, 0xBF, 0xCE, 0xA3, 0x54, 0x3B, 0xEE,
-    0x6F, 0xC1, 0xE1, 0xC8, 0xA3, 0xEB, 0x8B, 0x31, 0xBE, 0xAB, 0xFF, 0xBA, 0x42, 0xF6, 0x88, 0x1F,
-    0x71, 0x2B, 0x80, 0xFE, 0x0E, 0x87, 0x6C, 0xE1, 0xE4, 0x72, 0xA4, 0x44, 0xCF, 0xB3, 0x9E, 0x39,
-    0xBD, 0x07, 0x42, 0x85, 0x85, 0x3C, 0x84, 0x49, 0x8D, 0xD8, 0x30, 0x8D, 0x95, 0x88, 0x7A, 0x3B,
-    0xA9, 0x8C, 0x2E, 0x42, 0x99, 0x3A, 0x06, 0xA5, 0x35, 0xB7, 0xDC, 0x8A, 0xFB, 0x2F, 0xBC, 0xC0,
-    0x36, 0x74, 0xAB, 0xF9, 0xD0, 0x0E, 0xA3, 0x80, 0x58, 0xF9, 0x89, 0x1B, 0xE2, 0x71, 0x94, 0x55,
-    0x9B, 0x8E, 0xC2, 0xA4, 0x2C, 0xE2, 0x74, 0x14, 0x7C, 0x36, 0xDE, 0x2B, 0xA8, 0xEA, 0x79, 0xBE,
-    0x50, 0x0B, 0xB3, 0x86, 0x5B, 0x52, 0xF3, 0xC1, 0x9E, 0x4A, 0xBA, 0xB1, 0x35, 0x68, 0x8D, 0xD4,
-    0xEE, 0xF9, 0x06, 0x96, 0xC5, 0x9C, 0xF9, 0x1A, 0xD2, 0x12, 0xF6, 0xD9, 0xE7, 0xB3, 0xE7, 0xB2,
-    0xD3, 0x52, 0x10, 0x4D, 0x01, 0x6E, 0xF3, 0xC8, 0x10, 0x2C, 0x03, 0xCE, 0xD3, 0x05, 0x44, 0x62,
-    0xA7, 0x4D, 0xB2, 0x3D, 0x0D, 0x6D, 0x33, 0xDD, 0x9E, 0x8D, 0xB7, 0x09, 0x0E, 0x56, 0x87, 0x9F,
-    0x26, 0x0A, 0x13, 0x52, 0x50, 0x37, 0x92, 0x82, 0xA6, 0x26, 0x05, 0xBD, 0x31, 0x96, 0x82, 0x78,
-    0xEE, 0x2F, 0xA4, 0xAA, 0x73, 0x01, 0x0F, 0x3E, 0x2B, 0x90, 0xE5, 0xAB, 0x80, 0xC6, 0xC7, 0x9B,
-    0x7E, 0x1C, 0x0C, 0x07, 0x30, 0x80, 0x3B, 0xF8, 0x35, 0x1C, 0x26, 0xBB, 0x1A, 0x98, 0x53, 0x20,
-    0xB7, 0xBC, 0x85, 0x9A, 0xF3, 0x70, 0x0C, 0x1E, 0x9E, 0xB2, 0xF0, 0x31, 0x80, 0xA6, 0x9F, 0xEE,
-    0x4F, 0x81, 0x0B, 0x25, 0x77, 0xEE, 0xA8, 0xFA, 0x38, 0xD2, 0xE4, 0xC9, 0xF6, 0xD7, 0xAF, 0xDE,
-    0x78, 0xE4, 0x44, 0x7D, 0x54, 0x73, 0x6D, 0xFF, 0xE8, 0x67, 0x72, 0xDE, 0xDF, 0x98, 0x5F, 0x84,
-    0x55, 0xCF, 0x9C, 0xBD, 0x4C, 0xB3, 0xF9, 0xAA, 0x1D, 0x19, 0x93, 0xA9, 0xBD, 0x72, 0xCF, 0xC2,
-    0x37, 0x8E, 0x8C, 0xB2, 0x43, 0x4C, 0x86, 0x93, 0x02, 0x1E, 0x07, 0x9F, 0xBC, 0xAE, 0x18, 0x6C,
-    0xA2, 0x62, 0x1E, 0xF0, 0x5D, 0xE8, 0x41, 0x63, 0xC4, 0x15, 0xAF, 0x3F, 0x80, 0x95, 0x89, 0xEE,
-    0x9D, 0xAD, 0xE2, 0xD4, 0x70, 0xD2, 0xED, 0xE1, 0xBD, 0xEF, 0x19, 0xF8, 0x57, 0x9C, 0xDC, 0x42,
-    0xD2, 0xDA, 0xED, 0xF3, 0x30, 0x45, 0x14, 0xF7, 0xF6, 0xDE, 0x6B, 0x43, 0xAA, 0x56, 0x2C, 0xE7,
-    0xD6, 0x04, 0x68, 0xFA, 0xEB, 0xEC, 0x99, 0x77, 0x6F, 0x9C, 0x16, 0xA0, 0xC9, 0x52, 0x2C, 0x0E,
-    0x7D, 0x2A, 0xAA, 0x0B, 0x20, 0xD7, 0x2F, 0x89, 0xE0, 0x71, 0x5A, 0xA9, 0xCB, 0x29, 0xD1, 0x12,
-    0x97, 0x5C, 0x81, 0x34, 0x81, 0xB4, 0xA5, 0x25, 0x50, 0xB8, 0x83, 0xEC, 0x43, 0xBD, 0xC4, 0x6E,
-    0x18, 0x6E, 0xD7, 0x87, 0xF5, 0x99, 0x3F, 0x56, 0xF0, 0x33, 0xCF, 0xDB, 0x78, 0xE7, 0x0D, 0x1F,
-    0xF9, 0x7E, 0x1A, 0x6A, 0xA4, 0x99, 0x87, 0xA3, 0x18, 0xD8, 0x7F, 0xAC, 0xFA, 0x59, 0x0B, 0x4C,
-    0xD8, 0x0C, 0x56, 0xF3, 0x74, 0xE4, 0x66, 0xFA, 0xC4, 0x73, 0x3E, 0x66, 0x16, 0xCF, 0xBB, 0x07,
-    0x82, 0xE0, 0x0C, 0xF0, 0xEF, 0xE8, 0x49, 0x4A, 0xBD, 0xBE, 0xF3, 0xDB, 0xDC, 0xF3, 0xD7, 0x74,
-    0xDB, 0xD7, 0x43, 0x17, 0xB0, 0x03, 0x62, 0x37, 0xC8, 0x35, 0x06, 0x96, 0xA6, 0xF8, 0xCD, 0x64,
-    0x1C, 0x03, 0xDB, 0x72, 0xB3, 0x48, 0x3A, 0x33, 0x10, 0xA6, 0xBA, 0xD1, 0xB2, 0xE5, 0x93, 0xDD,
-    0x18, 0xD8, 0xDC, 0x7B, 0x0E, 0x8C, 0x62, 0x60, 0xC3, 0xBD, 0x18, 0x58, 0xCD, 0x2D, 0xD0, 0x5B,
-    0x86, 0x7A, 0x4A, 0x40, 0x45, 0x33, 0x67, 0x0C, 0x6C, 0xA5, 0x79, 0x41, 0xE0, 0x12, 0xC4, 0x4F,
-    0x1C, 0x12, 0xFD, 0xD3, 0x3F, 0x07, 0x57, 0x27, 0xAE, 0x29, 0x58, 0xEB, 0x66, 0xEC, 0x76, 0xB7,
-    0x8B, 0x34, 0x48, 0xFC, 0x9F, 0xD8, 0x31, 0xB7, 0x5A, 0xB7, 0x5C, 0x09, 0xBF, 0xAF, 0x5B, 0x37,
-    0xE2, 0xB9, 0xC2, 0x05, 0xF4, 0x43, 0x73, 0x44, 0x81, 0x40, 0x8E, 0x99, 0x5B, 0x88, 0x32, 0xD5,
-    0x3D, 0x16, 0x13, 0x75, 0xDF, 0xCE, 0xD8, 0x5C, 0x6E, 0x77, 0xDA, 0xED, 0x1E, 0xAB, 0x65, 0xFD,
-    0x3C, 0x25, 0x87, 0xA5, 0xD7, 0xF3, 0x5E, 0x7D, 0x0E, 0x3C, 0x15, 0xB0, 0x2B, 0x20, 0x84, 0x97,
-    0x07, 0x86, 0xB4, 0x8C, 0x88, 0xD5, 0xD4, 0xE0, 0xA7, 0x20, 0x0D, 0x81, 0x07, 0xC7, 0x8D, 0x4F,
-    0x84, 0xCE, 0x84, 0xC9, 0xD4, 0x5C, 0x05, 0x4C, 0x65, 0xF0, 0x84, 0x86, 0x6D, 0x6A, 0xAA, 0x73,
-    0xAA, 0x7C, 0xCE, 0x44, 0xCF, 0xDD, 0x74, 0xEE, 0xE4, 0x8D, 0x0B, 0x0F, 0x5B, 0xA9, 0xC3, 0xC6,
-    0x0C, 0x6D, 0x7A, 0xD0, 0x04, 0x7B, 0x5A, 0x87, 0x2D, 0xD0, 0x61, 0x5B, 0x3E, 0x6A, 0x87, 0x5F,
-    0x3A, 0x76, 0x6E, 0xA1, 0x15, 0x3A, 0x05, 0xFB, 0x73, 0x3A, 0xBC, 0x36, 0xD7, 0x10, 0x7D, 0x3E,
-    0x3B, 0x3C, 0x63, 0x87, 0xAF, 0xFF, 0x1F, 0xE5, 0x5C, 0x31, 0x77, 0xDC, 0xC6, 0x11, 0x1E, 0xE0,
-    0x4C, 0xE2, 0x85, 0x57, 0x40, 0x85, 0x58, 0xD8, 0x7A, 0x2F, 0x68, 0x52, 0xD8, 0x2C, 0x8C, 0x36,
-    0x45, 0x22, 0x20, 0x76, 0xE9, 0x86, 0x05, 0x99, 0x22, 0x29, 0xD4, 0xA8, 0x88, 0xEC, 0x82, 0xBF,
-    0xC0, 0xC6, 0xB9, 0x72, 0x2B, 0xD5, 0x2A, 0xAC, 0x42, 0x85, 0x74, 0x2E, 0xD4, 0xAA, 0x88, 0x84,
-    0x4B, 0x93, 0x22, 0x15, 0x9E, 0xF3, 0x5E, 0x9A, 0x34, 0x57, 0xC4, 0x2E, 0x9C, 0x42, 0x70, 0x1E,
-    0x6C, 0x81, 0x22, 0x80, 0xCD, 0x7C, 0x33, 0xBB, 0x00, 0x8E, 0xA4, 0xEC, 0x44, 0x89, 0x49, 0x1D,
-    0x79, 0xE2, 0xED, 0x92, 0x77, 0xC0, 0x62, 0x76, 0xBE, 0x99, 0xD9, 0x99, 0xD9, 0x59, 0x11, 0xC5,
-    0x66, 0x46, 0xFC, 0x4A, 0xCC, 0x02, 0x5D, 0x66, 0x0A, 0x74, 0xC6, 0x2C, 0xB5, 0x2B, 0xB9, 0xF5,
-    0xCC, 0xA3, 0x8A, 0xBB, 0x89, 0xB9, 0x51, 0x4B, 0x17, 0x36, 0xDC, 0x4D, 0x4D, 0xD8, 0x72, 0x17,
-    0x76, 0x53, 0x83, 0xAE, 0x0D, 0xD0, 0xC5, 0xCD, 0xC4, 0xA4, 0x3C, 0x56, 0xED, 0x63, 0xB4, 0xAC,
-    0xF2, 0xD0, 0xE5, 0x25, 0x61, 0x34, 0x1E, 0x8A, 0x7F, 0x3C, 0xC3, 0xAF, 0x8A, 0x7C, 0x74, 0x35,
-    0x8F, 0xC5, 0xAF, 0x86, 0x02, 0x74, 0x2D, 0x0F, 0xF9, 0xCD, 0x3C, 0xEF, 0x28, 0xE4, 0x91, 0xF8,
-    0x1D, 0x75, 0x78, 0x48, 0x9A, 0xF0, 0x53, 0x02, 0x33, 0x4B, 0x1A, 0x3C, 0x79, 0x91, 0x31, 0x05,
-    0xBE, 0x29, 0x78, 0x04, 0x1E, 0x09, 0xB4, 0xAD, 0xBC, 0xBC, 0xFB, 0xD2, 0x4D, 0x3B, 0xE9, 0x30,
-    0xCE, 0x89, 0xCE, 0xC7, 0x14, 0x68, 0x33, 0xBF, 0x2F, 0x94, 0xA4, 0x20, 0xA0, 0x00, 0x31, 0xA5,
-    0xD7, 0xFD, 0x96, 0x47, 0xBD, 0x4D, 0x78, 0x02, 0xE1, 0x69, 0x68, 0x36, 0xE6, 0xA6, 0xF1, 0x72,
-    0x26, 0x71, 0x0A, 0x3A, 0x63, 0xF3, 0x22, 0x6F, 0x98, 0x9E, 0xA4, 0xE1, 0x8B, 0xB8, 0xA9, 0xB4,
-    0xC9, 0x9A, 0xAC, 0xF1, 0x4C, 0x93, 0xE8, 0x25, 0xE6, 0x59, 0x13, 0x1A, 0xF3, 0x41, 0xE3, 0x9B,
-    0x36, 0x68, 0x68, 0x3B, 0xED, 0x89, 0x7B, 0x47, 0x38, 0xB9, 0x90, 0x69, 0xA0, 0x29, 0x30, 0x13,
-    0xF0, 0xFC, 0xE9, 0x68, 0x06, 0x98, 0xAD, 0x80, 0x31, 0xC6, 0x84, 0xB2, 0x42, 0x3F, 0xD5, 0xBF,
-    0x72, 0xE9, 0x02, 0x9D, 0x4F, 0x50, 0xE9, 0xB4, 0xEE, 0x8D, 0xF9, 0xB0, 0xF6, 0x90, 0x4E, 0x31,
-    0x81, 0x10, 0x7F, 0x85, 0xF8, 0x9C, 0x42, 0x50, 0x19, 0xE2, 0xB7, 0x18, 0x57, 0xC8, 0x84, 0x04,
-    0xE4, 0x07, 0x6E, 0xCA, 0x67, 0x8F, 0xE8, 0x87, 0xC2, 0x63, 0x02, 0xA5, 0x5B, 0x73, 0xBF, 0x13,
-    0xB6, 0x7F, 0x56, 0x09, 0xBF, 0xFF, 0x86, 0xAF, 0xCC, 0x01, 0x48, 0x9D, 0xE0, 0x1E, 0xA6, 0xBD,
-    0x54, 0x7A, 0x57, 0x5F, 0x6B, 0x8E, 0xD3, 0xC6, 0x2E, 0x29, 0x22, 0xDE, 0x7E, 0xCA, 0xB2, 0x19,
-    0x98, 0x65, 0x87, 0xDB, 0xBF, 0x63, 0x2D, 0x4C, 0x8E, 0x40, 0x68, 0xFE, 0x29, 0x8F, 0xE7, 0xB5,
-    0x22, 0xB8, 0xBB, 0xB4, 0x91, 0x8E, 0xC1, 0x52, 0xB4, 0x84, 0x8C, 0x42, 0x68, 0xE2, 0x61, 0x04,
-    0x30, 0x87, 0x98, 0x42, 0x26, 0x2D, 0x40, 0x23, 0x41, 0x8D, 0x04, 0x36, 0x12, 0xDC, 0x48, 0x80,
-    0x23, 0x41, 0x8E, 0x04, 0x3A, 0x12, 0xEC, 0x48, 0xC0, 0xA3, 0xC4, 0x5E, 0xC9, 0xF0, 0x91, 0xE0,
-    0x47, 0x0A, 0xA0, 0x22, 0xB8, 0xA3, 0xE8, 0xC5, 0x2A, 0x70, 0xD3, 0x6A, 0x6B, 0x0E, 0x6E, 0xB7,
-    0x8A, 0xC8, 0x3B, 0x0E, 0x8A, 0x31, 0x84, 0xD3, 0x8B, 0x06, 0xE1, 0xBE, 0xE0, 0x91, 0x09, 0xE1,
-    0xF1, 0x72, 0x7B, 0x0F, 0xC6, 0x24, 0x03, 0x1D, 0x0F, 0x0C, 0x26, 0xE5, 0x9B, 0x9C, 0x27, 0x33,
-    0xAD, 0x23, 0x9E, 0x44, 0x54, 0x4C, 0x00, 0x03, 0xD1, 0x5E, 0x3F, 0xF1, 0x8F, 0x5E, 0xF0, 0xED,
-    0x11, 0xA8, 0x01, 0xA7, 0x5B, 0x70, 0xC2, 0xF0, 0xCD, 0xD1, 0x57, 0x07, 0x3C, 0x87, 0x9F, 0xE1,
-    0xA1, 0x64, 0x4D, 0x9D, 0xB6, 0xBF, 0x7B, 0xC4, 0xED, 0x35, 0xBE, 0x66, 0x41, 0x39, 0x5A, 0x9E,
-    0xC3, 0x17, 0x66, 0xC1, 0x66, 0x90, 0xBF, 0xE5, 0x8B, 0xA5, 0x4D, 0xB5, 0x0D, 0xD0, 0x2E, 0x22,
-    0x7C, 0x6B, 0xAF, 0xEC, 0xF8, 0x2E, 0x7E, 0x14, 0x5B, 0xBE, 0xD8, 0x14, 0x4C, 0xB1, 0xE7, 0xE8,
-    0x08, 0x97, 0xDA, 0x89, 0xA8, 0xD0, 0x86, 0x05, 0xE8, 0x63, 0x12, 0x9D, 0x6C, 0x54, 0x27, 0x0B,
-    0x01, 0xE6, 0xCB, 0xD9, 0x85, 0x07, 0xB4, 0x5F, 0x01, 0x7D, 0x3C, 0x95, 0x15, 0x46, 0xA6, 0x10,
-    0x2E, 0xA0, 0x9F, 0x07, 0x29, 0xDF, 0x56, 0xB6, 0x18, 0xAA, 0xE6, 0xAB, 0xE3, 0xA3, 0xF6, 0xF5,
-    0xD6, 0x4F, 0x26, 0x22, 0xDD, 0xC4, 0x2F, 0xC9, 0x61, 0x28, 0xC8, 0x81, 0x18, 0xF2, 0xEA, 0x0C,
-    0x90, 0x79, 0xCB, 0xCD, 0x7F, 0x8C, 0x20, 0x53, 0x29, 0xE3, 0x47, 0x8B, 0x32, 0xC7, 0x62, 0x7A,
-    0x74, 0x6E, 0x58, 0xEE, 0xE3, 0xD9, 0xC5, 0xC2, 0x78, 0x97, 0xFF, 0x4D, 0x3B, 0xAF, 0x84, 0xF2,
-    0x2D, 0x29, 0xB9, 0xC1, 0xCF, 0xFB, 0x95, 0xD7, 0xFB, 0x10, 0x99, 0x5C, 0xC6, 0x77, 0x06, 0x1D,
-    0xC6, 0x2C, 0x59, 0x59, 0x92, 0x19, 0x4B, 0xFA, 0x55, 0xDC, 0xB8, 0xB2, 0x52, 0xD2, 0x4F, 0xB9,
-    0x52, 0x36, 0xFD, 0x4A, 0x29, 0x86, 0xB5, 0x67, 0x79, 0x2E, 0xBC, 0xB6, 0xDC, 0x0D, 0xBA, 0x29,
-    0xF8, 0x19, 0x31, 0xCF, 0xF8, 0x52, 0x16, 0xBF, 0xED, 0x8B, 0xE4, 0xC3, 0xBC, 0x82, 0x5B, 0xEA,
-    0xCF, 0x6F, 0x63, 0x54, 0x71, 0x7B, 0x1A, 0x2C, 0xA2, 0x7C, 0x87, 0xF9, 0x13, 0x1B, 0xC7, 0x8E,
-    0x92, 0xA5, 0x37, 0x68, 0xE8, 0x79, 0xB8, 0xAF, 0xB7, 0xC4, 0xAE, 0xCC, 0x7A, 0xF7, 0x75, 0xB1,
-    0xEA, 0xBE, 0xC6, 0xD6, 0x45, 0x55, 0x65, 0xCB, 0x65, 0x36, 0x77, 0xEA, 0x1D, 0xA0, 0x5C, 0xEE,
-    0x26, 0xC0, 0xA7, 0xF6, 0x5A, 0x01, 0xCD, 0x34, 0x0A, 0x68, 0xD9, 0x3B, 0x7A, 0x17, 0x4A, 0x3D,
-    0x37, 0x1F, 0xA8, 0xBB, 0xC7, 0x72, 0xCD, 0x4F, 0xDA, 0x4B, 0x18, 0xB3, 0xE6, 0x6D, 0xB6, 0xC1,
-    0x1D, 0xC5, 0x0B, 0x9E, 0x0B, 0x13, 0x13, 0x99, 0x0E, 0x03, 0x60, 0x02, 0x6F, 0x9C, 0x93, 0xFB,
-    0x6A, 0x23, 0x89, 0x48, 0x57, 0xCF, 0x40, 0xA0, 0xD8, 0xBC, 0xD3, 0x28, 0x5C, 0x57, 0xAF, 0x9F,
-    0x84, 0x2B, 0xBF, 0xA0, 0x70, 0x6D, 0x21, 0x6E, 0x0A, 0x6A, 0xF1, 0xFD, 0xB8, 0xD9, 0xCB, 0x00,
-    0xD7, 0xD6, 0xEB, 0x06, 0x97, 0x7D, 0x09, 0x9D, 0x30, 0x9B, 0x36, 0x56, 0xD4, 0xEE, 0x13, 0x21,
-    0xE8, 0xD3, 0x0A, 0xF1, 0xE5, 0x74, 0x79, 0xFB, 0x13, 0x01, 0x4F, 0x7C, 0x1F, 0x1F, 0x1C, 0x1A,
-    0xC0, 0x8B, 0x4C, 0x7A, 0xC1, 0x74, 0x4D, 0x18, 0x21, 0x94, 0x4F, 0x5D, 0xB3, 0xCB, 0x0A, 0xE7,
-    0xD5, 0xBF, 0x64, 0x04, 0x5B, 0x18, 0xA3, 0x1C, 0x3E, 0x69, 0x6C, 0xDA, 0xF3, 0x46, 0x70, 0x33,
-    0xF5, 0x67, 0x12, 0xDE, 0x0B, 0xA1, 0xB9, 0x38, 0x33, 0x54, 0x1F, 0x80, 0x6B, 0x5E, 0xE9, 0x8B,
-    0x33, 0xA3, 0xE6, 0xDD, 0xAB, 0x29, 0x9A, 0x49, 0x74, 0x9B, 0xA5, 0x7A, 0xA5, 0xA2, 0x24, 0x5A,
-    0xB8, 0xA9, 0xB8, 0x5C, 0x38, 0x67, 0xE6, 0x37, 0xE2, 0xCC, 0x94, 0x70, 0x66, 0x0A, 0xFA, 0xB5,
-    0x97, 0x5B, 0x39, 0xBD, 0x4E, 0x93, 0x12, 0xDE, 0xCB, 0x12, 0xDF, 0x2E, 0xE0, 0x5A, 0xCE, 0xF8,
-    0x2E, 0x31, 0x4B, 0xC7, 0x61, 0x3C, 0x1B, 0x67, 0x66, 0x5A, 0x88, 0x37, 0xC9, 0xF6, 0x12, 0xE0,
-    0x4C, 0x38, 0x80, 0x51, 0x2D, 0x6B, 0x55, 0xCB, 0x6A, 0xD5, 0xB2, 0xDB, 0x42, 0xD9, 0x15, 0xBA,
-    0xDC, 0xCE, 0x0C, 0x0B, 0x32, 0xF3, 0xA9, 0x45, 0x84, 0x66, 0xBE, 0xE1, 0x09, 0x67, 0x40, 0x2F,
-    0x82, 0x38, 0xFB, 0xE7, 0x6F, 0x4B, 0x4F, 0x71, 0x66, 0x26, 0x02, 0xD1, 0x53, 0xA0, 0x63, 0x3A,
-    0x44, 0xA8, 0xA3, 0x77, 0xC7, 0xEC, 0xA5, 0x13, 0xEF, 0x4A, 0xD4, 0xB3, 0x59, 0x79, 0x7F, 0xB7,
-    0xBF, 0x77, 0xEA, 0xB5, 0x78, 0xBF, 0x98, 0xCF, 0x8F, 0x8D, 0x6B, 0x7A, 0x82, 0x10, 0xEA, 0x64,
-    0x6E, 0xD0, 0x4A, 0x7F, 0x8F, 0x6E, 0x23, 0x86, 0xBB, 0x0D, 0xE9, 0xE9, 0x24, 0x00, 0x92, 0x78,
-    0xB8, 0x0C, 0xCD, 0x9D, 0xBC, 0x66, 0xE0, 0xA2, 0x26, 0xE6, 0xC0, 0xA9, 0x65, 0xCE, 0x4C, 0xBB,
-    0xA4, 0x9B, 0x3F, 0xEA, 0x30, 0xE9, 0x71, 0x23, 0xCC, 0xEB, 0x39, 0x08, 0xA8, 0x19, 0xA0, 0x99,
-    0xF7, 0x18, 0x92, 0x50, 0xFB, 0x22, 0x1B, 0x19, 0xE4, 0x84, 0xF9, 0xC9, 0x0F, 0xD9, 0xDE, 0x75,
-    0xB4, 0xBC, 0x25, 0x86, 0x07, 0xB2, 0x29, 0xE8, 0x0F, 0x8D, 0x8D, 0xA4, 0x3C, 0x96, 0x34, 0x84,
-    0x18, 0x1E, 0xC8, 0xF2, 0x11, 0x41, 0x1A, 0x5D, 0x94, 0xF0, 0x30, 0x5E, 0x35, 0x75, 0x80, 0xF3,
-    0x60, 0xE4, 0x04, 0x3A, 0x30, 0x81, 0x1E, 0x4E, 0xC4, 0x60, 0x06, 0xAD, 0x44, 0xFB, 0x10, 0x57,
-    0xFC, 0x09, 0xA6, 0xAA, 0x87, 0xBA, 0xD3, 0x4B, 0xF3, 0x99, 0xF2, 0xF7, 0x0A, 0x6D, 0xB3, 0xEE,
-    0x5E, 0x0F, 0xCD, 0x61, 0xC7, 0xC2, 0xD9, 0x24, 0x77, 0x4D, 0x7D, 0x9D, 0xF2, 0xE2, 0xAA, 0x55,
-    0x86, 0x33, 0x65, 0x98, 0x97, 0x72, 0x40, 0x11, 0xD7, 0x6C, 0x61, 0x8D, 0xF9, 0x7C, 0x09, 0x72,
-    0x8B, 0xC9, 0x61, 0xCE, 0xB1, 0x46, 0xC9, 0xAA, 0xED, 0x0D, 0xAA, 0x72, 0xD6, 0x12, 0xA8, 0xFE,
-    0x73, 0x4D, 0xF3, 0x7B, 0x31, 0x53, 0x55, 0x67, 0x69, 0x60, 0xDA, 0x3F, 0x50, 0xF8, 0x3D, 0x43,
-    0x9C, 0x20, 0xF5, 0x93, 0xBB, 0x9C, 0x0F, 0xF5, 0x3C, 0x93, 0x84, 0xD2, 0x6A, 0xD3, 0xC9, 0xC4,
-    0x4F, 0x6F, 0x2A, 0x5D, 0x57, 0x9B, 0x13, 0x0D, 0xB3, 0xF0, 0x07, 0x6E, 0x93, 0x86, 0x39, 0x79,
-    0xCA, 0xD3, 0x54, 0xFC, 0x36, 0x24, 0x29, 0x15, 0xF1, 0xF0, 0xFB, 0x69, 0x52, 0xB0, 0x08, 0x96,
-    0xB9, 0xA4, 0x5B, 0x78, 0x42, 0xF1, 0xF3, 0x56, 0x52, 0x6D, 0x30, 0xDC, 0xE2, 0x59, 0xF2, 0xB2,
-    0x37, 0xF0, 0x58, 0x58, 0xAC, 0x3C, 0x16, 0x26, 0x8B, 0xC9, 0x2E, 0x49, 0xD8, 0x4C, 0xC2, 0x67,
-    0x12, 0x46, 0x93, 0x70, 0x9A, 0x84, 0xD5, 0x92, 0x3E, 0x39, 0xD6, 0x6A, 0x56, 0x66, 0x94, 0x9B,
-    0x11, 0x8E, 0x2B, 0xCB, 0xC5, 0xFE, 0xD7, 0xA4, 0x4C, 0x57, 0xAE, 0x5B, 0xB6, 0x0B, 0xDF, 0x35,
-    0x99, 0x9D, 0x08, 0x67, 0xC3, 0x72, 0xEB, 0x21, 0x2B, 0x36, 0x1B, 0x51, 0xA6, 0xF0, 0x56, 0x0E,
-    0xE3, 0xE8, 0x49, 0xE2, 0x6C, 0xD2, 0x4C, 0x6B, 0xA4, 0xDC, 0xBC, 0x76, 0x75, 0x49, 0xC0, 0xD0,
-    0x4B, 0xC9, 0xFC, 0x94, 0x27, 0x5A, 0x7C, 0xAE, 0x91, 0xC3, 0xCB, 0x5A, 0x59, 0x58, 0x8D, 0x5D,
-    0xE0, 0x4F, 0xB4, 0xFB, 0xFB, 0xE9, 0x8F, 0x8E, 0xA0, 0xED, 0x7C, 0x7E, 0xEF, 0x25, 0x34, 0xAC,
-    0x64, 0x3A, 0xA3, 0x12, 0x38, 0x4D, 0xEA, 0x64, 0x9C, 0xE9, 0xCC, 0x78, 0xE2, 0x41, 0x83, 0x0D,
-    0x86, 0x70, 0xE9, 0x6B, 0xA6, 0xF3, 0x6A, 0x3F, 0xBD, 0x6B, 0x87, 0xBA, 0xCA, 0x2F, 0xC1, 0x4A,
-    0x89, 0xCB, 0x05, 0x71, 0x73, 0x78, 0x8D, 0x19, 0x6B, 0x96, 0x1E, 0x32, 0x94, 0x0B, 0x92, 0x44,
-    0x26, 0x9B, 0xCD, 0x09, 0x2F, 0xB0, 0x66, 0x29, 0x8B, 0xEE, 0xB1, 0x56, 0x13, 0xA2, 0x43, 0x5A,
-    0xD4, 0xB3, 0xEB, 0x7F, 0x4D, 0xD7, 0x66, 0x40, 0x84, 0xBF, 0x8A, 0xA5, 0x0D, 0x34, 0xD9, 0x95,
-    0x1B, 0x3C, 0xD8, 0xDB, 0x17, 0x22, 0x9E, 0xF6, 0xAE, 0xEE, 0x0D, 0xDC, 0x15, 0x14, 0x50, 0x10,
-    0x7E, 0x70, 0xFD, 0x31, 0x5F, 0xDE, 0xBE, 0xBD, 0x16, 0x0A, 0xF2, 0x40, 0x57, 0x0F, 0x70, 0xC0,
-    0x7B, 0xA4, 0x29, 0xBB, 0x05, 0x94, 0xE5, 0x60, 0x06, 0x65, 0x69, 0x01, 0x62, 0xFD, 0x78, 0x0D,
-    0x94, 0x85, 0x6E, 0xD2, 0x2F, 0x26, 0xA6, 0xA8, 0x59, 0x1A, 0xAA, 0xF0, 0x33, 0x53, 0xFE, 0x9C,
-    0xDE, 0x55, 0xF2, 0x30, 0x50, 0x6E, 0x90, 0x39, 0x5F, 0x20, 0x6F, 0x1E, 0x2D, 0xFC, 0x66, 0x0C,
-    0xC3, 0xD9, 0x2D, 0x86, 0x70, 0xAB, 0x03, 0x93, 0x56, 0x3C, 0x9D, 0xA3, 0x92, 0xE2, 0xDF, 0xC3,
-    0xAD, 0x26, 0xE7, 0x56, 0xEB, 0xAC, 0xE1, 0xB4, 0x4E, 0x3A, 0xE6, 0x71, 0x58, 0xB1, 0xB1, 0x3A,
-    0x96, 0x23, 0xFC, 0x01, 0xA3, 0x1F, 0xFF, 0xFF, 0x8D, 0xFE, 0x0E, 0x0B, 0x06, 0x3F, 0x8B, 0xBF,
-    0x4B, 0x83, 0xCE, 0x14, 0x51, 0x15, 0x57, 0x59, 0x11, 0x34, 0xDB, 0x76, 0xBB, 0xE1, 0xB5, 0x72,
-    0xC8, 0x86, 0x14, 0x5D, 0xF4, 0x83, 0x29, 0xBA, 0xD7, 0xCE, 0x71, 0xDB, 0xD5, 0x04, 0x40, 0xC4,
-    0xA2, 0x10, 0x09, 0xF9, 0xF6, 0xCD, 0xA6, 0x0F, 0x9E, 0xB0, 0x87, 0x47, 0xA9, 0x6B, 0x2F, 0xE1,
-    0xA9, 0xB1, 0x6F, 0x04, 0xA0, 0x53, 0x09, 0x26, 0x16, 0xFF, 0xF3, 0x3B, 0x60, 0x83, 0x97, 0x31,
-    0x4B, 0xCC, 0x68, 0x7C, 0x90, 0x58, 0x91, 0x7C, 0x48, 0x48, 0x03, 0x9B, 0x94, 0x3D, 0x4A, 0xD6,
-    0xE1, 0xB0, 0xA0, 0x2D, 0x59, 0x93, 0x78, 0x7A, 0x49, 0xF5, 0xEA, 0x3F, 0x67, 0x3C, 0x17, 0x7D,
-    0xDD, 0xD4, 0xED, 0x79, 0xAC, 0x6D, 0x78, 0xE3, 0x77, 0xFF, 0x10, 0x32, 0x95, 0x94, 0x59, 0x9D,
-    0xD5, 0x49, 0xA5, 0x89, 0xB7, 0xED, 0xDD, 0xA4, 0xFA, 0xCF, 0xFE, 0xA9, 0x44, 0x26, 0x95, 0xDE,
-    0x7D, 0xAD, 0x18, 0x8C, 0xA1, 0xAC, 0x21, 0x91, 0x4A, 0x6E, 0xDE, 0xEF, 0xD5, 0x88, 0x70, 0x74,
-    0x5F, 0x18, 0xEC, 0xAC, 0x14, 0x30, 0x49, 0xB1, 0x11, 0xF8, 0x13, 0x31, 0xB2, 0xB3, 0x0C, 0xFB,
-    0x03, 0x66, 0x91, 0x8B, 0xA3, 0xBC, 0x80, 0x78, 0x23, 0xDE, 0x2B, 0x47, 0xDD, 0x12, 0x9D, 0xA7,
-    0x9D, 0xEF, 0xBA, 0xC2, 0x5E, 0x69, 0xEF, 0xCB, 0x34, 0x5C, 0xB4, 0x63, 0xDA, 0x27, 0x84, 0x06,
-    0x69, 0x33, 0x3C, 0xFD, 0x23, 0xB6, 0x30, 0x13, 0x0D, 0x41, 0x49, 0x56, 0x40, 0xDD, 0x22, 0x4C,
-    0x65, 0x2D, 0x95, 0x8C, 0x87, 0xB7, 0xB7, 0x12, 0x58, 0x6A, 0xDC, 0x1C, 0xB6, 0xE3, 0x50, 0x32,
-    0xB2, 0x81, 0x65, 0x37, 0xCA, 0x92, 0x7B, 0xF9, 0x3D, 0x59, 0x01, 0x8C, 0xAE, 0x00, 0x85, 0x3C,
-    0x05, 0xA6, 0xEE, 0x6B, 0x9E, 0x2F, 0xDF, 0x10, 0xB3, 0x91, 0x6A, 0x31, 0x00, 0x34, 0x8C, 0xE7,
-    0x5C, 0xC3, 0x14, 0x26, 0x08, 0x84, 0x67, 0xA7, 0xB4, 0x88, 0x8C, 0xD3, 0x18, 0x57, 0x42, 0xD3,
-    0xF8, 0x2E, 0x56, 0xB5, 0xAC, 0x95, 0x15, 0xA0, 0x91, 0xB8, 0xB4, 0x14, 0x0B, 0xB4, 0xC0, 0x24,
-    0x85, 0xB4, 0xF1, 0x26, 0xC5, 0x9B, 0xD4, 0x2F, 0xCB, 0xBA, 0x9A, 0xBB, 0x35, 0x5D, 0x10, 0x92,
-    0x0C, 0x0E, 0x79, 0xBB, 0xB6, 0xA4, 0x83, 0x46, 0x29, 0x80, 0xC4, 0xD8, 0x7C, 0xB9, 0x2E, 0xD5,
-    0x49, 0x41, 0xC3, 0x86, 0xDD, 0x44, 0xAF, 0x9C, 0x68, 0xB6, 0xCF, 0x1B, 0x57, 0x76, 0x5C, 0x1C,
-    0xBC, 0x25, 0x54, 0xD3, 0x58, 0xCD, 0x06, 0x6B, 0x1A, 0xAD, 0x69, 0xB8, 0xA6, 0xF1, 0x9A, 0x06,
-    0x6C, 0x76, 0x4F, 0x61, 0x67, 0xCC, 0x85, 0xD7, 0x43, 0x00, 0x5C, 0x05, 0x08, 0x76, 0xB9, 0x1E,
-    0x0A, 0xDD, 0x89, 0xF9, 0x40, 0xBC, 0x20, 0xF3, 0x17, 0x99, 0xB6, 0xEC, 0x36, 0x07, 0xE2, 0x35,
-    0x9F, 0xE2, 0x36, 0x5F, 0x1C, 0x3C, 0x35, 0xF2, 0x09, 0xC7, 0x91, 0x0F, 0x2C, 0x5F, 0xC3, 0xEB,
-    0x7A, 0xF4, 0xBC, 0x93, 0xFD, 0x86, 0xC1, 0x99, 0xDB, 0x5B, 0x71, 0xE6, 0xCE, 0x1D, 0x49, 0x0B,
-    0xA2, 0x55, 0xC4, 0xB0, 0x42, 0xEC, 0xE3, 0x82, 0x1F, 0x1B, 0xFD, 0xD8, 0xF0, 0xC7, 0xC6, 0x3F,
-    0x17, 0x16, 0x49, 0x8D, 0x92, 0xD4, 0x14, 0x85, 0x2B, 0x51, 0x92, 0x8D, 0x01, 0x11, 0x25, 0x4D,
-    0x5C, 0x94, 0xD4, 0xCA, 0x8E, 0xED, 0x28, 0x4A, 0x7A, 0xA1, 0x51, 0x92, 0x6C, 0x5E, 0x82, 0xBD,
-    0x89, 0x3C, 0xC2, 0x74, 0x07, 0x66, 0xE1, 0x99, 0x92, 0x49, 0x67, 0x7A, 0xD9, 0x1D, 0x91, 0x28,
-    0xA9, 0x42, 0x1C, 0x94, 0x49, 0x9B, 0xD4, 0xA7, 0xB5, 0x4C, 0x7A, 0x85, 0x65, 0x36, 0x2F, 0x61,
-    0x51, 0x91, 0xD6, 0xAC, 0x03, 0x4D, 0x22, 0xF2, 0x87, 0xCA, 0xE4, 0x40, 0xB7, 0xA6, 0xEC, 0x8E,
-    0xB2, 0x75, 0x82, 0x42, 0x35, 0xAB, 0x91, 0xAD, 0x07, 0xB1, 0xEE, 0xF7, 0x1F, 0x45, 0x43, 0x37,
-    0x6B, 0xD5, 0xD0, 0x42, 0xEE, 0xFA, 0x73, 0xDA, 0xE3, 0x7A, 0x09, 0x34, 0xF4, 0xE1, 0x8F, 0x87,
-    0x5E, 0xCD, 0xE3, 0x35, 0xD0, 0xD6, 0xBE, 0x2C, 0x24, 0xAB, 0xC3, 0x54, 0xC9, 0x00, 0x61, 0x55,
-    0x86, 0x2B, 0xFC, 0x53, 0xCB, 0x42, 0x42, 0x5D, 0x92, 0x93, 0x67, 0xB2, 0x9E, 0x9A, 0xF7, 0x3A,
-    0x75, 0x24, 0x92, 0xD9, 0x85, 0x84, 0x1A, 0x91, 0x9F, 0x86, 0x7E, 0x1A, 0xFB, 0x51, 0x74, 0x17,
-    0x17, 0xBF, 0x3B, 0x44, 0x7F, 0x2E, 0xEA, 0x95, 0x08, 0xDA, 0x97, 0x31, 0xA6, 0x35, 0xB4, 0x3E,
-    0x5E, 0xA0, 0x98, 0x74, 0x08, 0x02, 0xCF, 0x14, 0x70, 0xFF, 0xA5, 0x80, 0xDB, 0x02, 0x92, 0x64,
-    0xB5, 0x80, 0x24, 0x3F, 0x56, 0x40, 0x42, 0xC7, 0x0B, 0x48, 0x2E, 0xA5, 0x6B, 0x4C, 0xF3, 0x7B,
-    0x22, 0xF8, 0x15, 0x39, 0x26, 0xC6, 0x47, 0x32, 0xFD, 0x82, 0x9F, 0xCD, 0x4C, 0x42, 0xB9, 0xE3,
-    0x5E, 0x6F, 0x2C, 0xD7, 0xCE, 0x95, 0x76, 0xB2, 0xE0, 0xCA, 0xA4, 0x35, 0x55, 0x65, 0xCB, 0xAA,
-    0x07, 0xCF, 0x59, 0xCB, 0x85, 0x55, 0x22, 0xE8, 0x43, 0xE5, 0x9D, 0xEC, 0x8B, 0x41, 0x24, 0xCC,
-    0x52, 0x65, 0x42, 0xC0, 0x37, 0xE6, 0x4B, 0xA9, 0x2F, 0x34, 0xE6, 0xC8, 0xA4, 0x22, 0x16, 0xA6,
-    0xB3, 0x72, 0x51, 0x5B, 0xC1, 0x28, 0xC8, 0xA2, 0x48, 0x56, 0x34, 0xC8, 0x62, 0x4C, 0x16, 0x72,
-    0xB2, 0x12, 0x40, 0x56, 0x2E, 0x4E, 0xED, 0xF1, 0xBD, 0xBB, 0xDE, 0xDD, 0x6F, 0x85, 0xA4, 0x1F,
-    0xDF, 0x8A, 0x09, 0x59, 0x39, 0x71, 0x82, 0xD2, 0x4B, 0x8A, 0x13, 0x15, 0x27, 0x2B, 0xBD, 0xB0,
-    0x0C, 0xD2, 0x22, 0xF0, 0x6B, 0x6D, 0xB9, 0x4B, 0xAD, 0xBA, 0xB5, 0x30, 0x53, 0x07, 0x87, 0x3F,
-    0x43, 0x06, 0x83, 0x6F, 0xB0, 0x7B, 0xC9, 0x7C, 0xAD, 0x97, 0xDF, 0x07, 0x07, 0x79, 0xD8, 0xF7,
-    0x99, 0x0C, 0x1E, 0xFC, 0x99, 0xEE, 0xA7, 0x1A, 0x40, 0x7F, 0x04, 0x81, 0x60, 0xB2, 0x62, 0xBE,
-    0x53, 0x65, 0xC1, 0x0A, 0x03, 0xA9, 0x34, 0x90, 0x82, 0x7F, 0xB2, 0x43, 0x05, 0xA8, 0x8A, 0x04,
-    0xA9, 0x4C, 0x48, 0x76, 0x4E, 0xF6, 0x1D, 0x8B, 0xBC, 0x25, 0x2B, 0x16, 0x4E, 0xF1, 0xAD, 0x60,
-    0x38, 0xC9, 0xE8, 0x8B, 0xC7, 0x66, 0x34, 0x9A, 0x91, 0x4D, 0x32, 0xCA, 0x26, 0xA8, 0x4B, 0x3D,
-    0xDB, 0x99, 0xBB, 0xC2, 0x94, 0xED, 0x4B, 0x85, 0xF8, 0xFC, 0xFE, 0x58, 0x1D, 0xDC, 0xF6, 0xAB,
-    0x3B, 0x35, 0xE0, 0x5C, 0x5A, 0x41, 0x9C, 0x95, 0x7E, 0x1D, 0x10, 0x3F, 0x7E, 0x12, 0xC2, 0xD9,
-    0xFD, 0xFE, 0x2C, 0x84, 0x4D, 0xE3, 0xF7, 0x35, 0x4C, 0xF6, 0x38, 0x44, 0x2F, 0x09, 0xF6, 0x40,
-    0x84, 0x9C, 0x88, 0xB8, 0x54, 0xBA, 0x3F, 0x56, 0x14, 0x2D, 0x76, 0xE1, 0x4E, 0xD5, 0x44, 0xA3,
-    0x69, 0x0A, 0xB4, 0x8B, 0xD4, 0x3A, 0xE6, 0x2A, 0x0D, 0x19, 0x89, 0x78, 0xEC, 0xAC, 0x87, 0x41,
-    0xA0, 0x37, 0x34, 0xC3, 0xEA, 0x99, 0x42, 0xCA, 0x64, 0x02, 0xD3, 0x89, 0x63, 0x13, 0xDA, 0xDC,
-    0x6D, 0xF8, 0xB5, 0x5E, 0x1E, 0xCD, 0x62, 0xE1, 0xC0, 0x06, 0x4A, 0x45, 0x2E, 0x91, 0x18, 0xB0,
-    0xB3, 0x8E, 0xC5, 0x3D, 0x6A, 0x7D, 0x3D, 0x89, 0xF2, 0xF7, 0x52, 0x6F, 0x02, 0x1D, 0x6D, 0x26,
-    0x45, 0x9B, 0x1C, 0x57, 0x01, 0xF1, 0x5D, 0xBA, 0xB2, 0x3E, 0x06, 0xE1, 0xF2, 0x29, 0xF2, 0x90,
-    0xF8, 0xB3, 0x5E, 0x9F, 0xB3, 0xEE, 0x43, 0x6F, 0xCB, 0x00, 0xAD, 0xE7, 0x27, 0xCB, 0x81, 0xB2,
-    0x69, 0x9D, 0xEC, 0xFC, 0x9B, 0x44, 0x83, 0x97, 0x67, 0x5D, 0x3E, 0x57, 0x75, 0x64, 0xE7, 0x21,
-    0x65, 0x27, 0xB0, 0x56, 0x59, 0x69, 0x64, 0xEB, 0xE6, 0x6C, 0x5A, 0xB8, 0x1A, 0xA6, 0xCC, 0x6A,
-    0x90, 0x93, 0xC0, 0x5F, 0x2F, 0x62, 0xF3, 0xD5, 0x81, 0x59, 0xC0, 0xD4, 0x68, 0xB1, 0x52, 0x2B,
-    0x68, 0xB2, 0x40, 0x5C, 0x53, 0x28, 0xC7, 0x33, 0xBB, 0x45, 0xAE, 0xC4, 0x68, 0x7C, 0x08, 0xC6,
-    0xAD, 0xCD, 0x4F, 0x75, 0x63, 0x63, 0x63, 0x3F, 0x63, 0x67, 0xBB, 0x7B, 0xF5, 0x26, 0xEA, 0x98,
-    0xBE, 0xB8, 0xC3, 0x99, 0x8A, 0x2E, 0x31, 0xEF, 0x19, 0x94, 0x95, 0x98, 0x8E, 0x29, 0x3C, 0xEA,
-    0x18, 0x84, 0xBF, 0x76, 0x1C, 0xE4, 0x4D, 0x3A, 0x7B, 0x4E, 0xCB, 0xED, 0x4C, 0x90, 0x94, 0x8F,
-    0x09, 0x39, 0xC1, 0x4A, 0xE1, 0x93, 0xDD, 0xF3, 0x9E, 0x0A, 0x16, 0x7A, 0x98, 0x62, 0xAA, 0x35,
-    0x6D, 0xBA, 0x7E, 0x48, 0x92, 0x84, 0xD4, 0xAE, 0x2A, 0x5E, 0x4F, 0x87, 0xA9, 0xF6, 0x4B, 0xCA,
-    0xFA, 0x80, 0x24, 0xC5, 0xCC, 0x32, 0x4F, 0x9D, 0xA6, 0x44, 0x0D, 0x32, 0x49, 0xD4, 0x70, 0x8C,
-    0x0E, 0x19, 0xBA, 0x09, 0x9E, 0x39, 0x62, 0xD6, 0xBD, 0xF3, 0xAD, 0x22, 0x04, 0x76, 0x8B, 0x29,
-    0x72, 0xAE, 0x51, 0xB9, 0xEA, 0xFB, 0xC2, 0x80, 0xEC, 0xDC, 0x73, 0xE7, 0x40, 0x14, 0x8C, 0xAC,
-    0x67, 0x94, 0xF4, 0xDF, 0x6A, 0x14, 0x9B, 0x1F, 0x99, 0x85, 0xF4, 0xB0, 0xA1, 0xA5, 0xD6, 0x2E,
-    0x6A, 0x3F, 0xD3, 0xBE, 0xA4, 0x9F, 0xAC, 0x77, 0xBF, 0x2B, 0x68, 0xE2, 0xE8, 0x89, 0xD7, 0xA2,
-    0xC0, 0xE9, 0x52, 0xAE, 0x12, 0x6A, 0x0B, 0x2B, 0x15, 0xBE, 0x1E, 0xC0, 0x01, 0x42, 0x5F, 0xED,
-    0x9D, 0x2D, 0x4A, 0xD7, 0xFD, 0x7B, 0xD2, 0xCD, 0x32, 0x0D, 0x24, 0x89, 0x59, 0x49, 0x5B, 0x0F,
-    0xC5, 0xB4, 0x5A, 0x73, 0x19, 0xB5, 0x82, 0x62, 0xD4, 0x08, 0x20, 0x49, 0x2D, 0x5D, 0x5E, 0xA2,
-    0xE3, 0xF8, 0x57, 0xBB, 0x54, 0xBA, 0x9A, 0xE4, 0x3B, 0xFA, 0xEF, 0x3A, 0x50, 0x21, 0x08, 0x93,
-    0x9C, 0x74, 0x42, 0x55, 0x1C, 0x50, 0x56, 0x7B, 0x2F, 0xC7, 0x23, 0xCD, 0x91, 0xD4, 0x93, 0x03,
-    0x6B, 0x52, 0xB4, 0xC9, 0xED, 0x1A, 0x5B, 0xBC, 0x6D, 0x41, 0xC2, 0x60, 0xEA, 0xFD, 0xDE, 0xF7,
-    0xB5, 0x95, 0x1D, 0x91, 0x75, 0x72, 0x11, 0xC9, 0x5F, 0x1E, 0xC4, 0x3D, 0x0D, 0x6F, 0x65, 0xED,
-    0x85, 0x25, 0x6A, 0x57, 0x1C, 0x7F, 0xCB, 0xA3, 0xB8, 0x04, 0xE2, 0xE0, 0xCC, 0x3A, 0x20, 0xEE,
-    0x12, 0xE8, 0x81, 0x0D, 0x70, 0xAD, 0xE3, 0xDE, 0x7B, 0xEE, 0xCE, 0x75, 0xEF, 0xFB, 0xB8, 0x1A,
-    0x2F, 0x98, 0xF6, 0xA4, 0x8D, 0x3D, 0x5D, 0x7E, 0x99, 0x74, 0xDF, 0xB1, 0x6D, 0x36, 0x3A, 0xF9,
-    0x67, 0x57, 0x2B, 0x77, 0x1A, 0xD4, 0xB2, 0xCC, 0xEA, 0x8A, 0xB5, 0xA1, 0xB9, 0x18, 0x04, 0x98,
-    0xF4, 0xB5, 0x10, 0x8F, 0x54, 0x4B, 0x60, 0xA2, 0xD6, 0xD3, 0x4A, 0x25, 0xF3, 0xCF, 0x8A, 0x7A,
-    0x8F, 0x9E, 0x97, 0xA7, 0x03, 0x4D, 0x87, 0xD6, 0x7A, 0xE2, 0x53, 0x9C, 0xFA, 0xCB, 0x24, 0x06,
-    0x52, 0xC4, 0x0A, 0x9B, 0x3F, 0xD1, 0x38, 0xE7, 0xF3, 0xA5, 0xBA, 0x9D, 0x70, 0x6B, 0x50, 0xCC,
-    0xCA, 0x5D, 0x39, 0x6D, 0x19, 0x71, 0xD9, 0xC4, 0x58, 0x0B, 0xC4, 0xE9, 0x52, 0x2A, 0x72, 0xEF,
-    0x64, 0xF9, 0x66, 0x36, 0xDE, 0xBC, 0xE9, 0xFB, 0x7E, 0x09, 0x1C, 0xFD, 0x6F, 0x19, 0xB2, 0x55,
-    0xBB, 0x46, 0xB0, 0x5A, 0xFF, 0xDB, 0x7A, 0xE0, 0xBD, 0xF5, 0xB2, 0x9D, 0xFD, 0xD0, 0x7B, 0x62,
-    0x33, 0xDD, 0xE9, 0x30, 0x7B, 0x7B, 0xB0, 0xB9, 0x1E, 0x0E, 0x5E, 0x78, 0x7A, 0x71, 0x9F, 0x40,
-    0x47, 0x58, 0x1A, 0x37, 0x08, 0x46, 0x33, 0x9C, 0x8A, 0xE0, 0x3B, 0x22, 0xD4, 0x53, 0x2D, 0xA7,
-    0x72, 0xA6, 0x5E, 0x8F, 0xD8, 0x73, 0xD8, 0x0A, 0x87, 0x82, 0xBF, 0xEA, 0x70, 0x03, 0x9C, 0x0C,
-    0x39, 0x33, 0xC1, 0x0B, 0xA9, 0xDD, 0xB5, 0x2D, 0x84, 0x7C, 0x89, 0x09, 0xE4, 0xB4, 0xB5, 0xE6,
-    0x54, 0xEC, 0x81, 0xCD, 0x71, 0xC1, 0xE4, 0xAB, 0xB4, 0x3B, 0x0F, 0x07, 0x97, 0xC6, 0xCE, 0x4B,
-    0x53, 0x50, 0x3A, 0x2F, 0xAD, 0xFE, 0x18, 0xFE, 0x83, 0x81, 0xFD, 0x5D, 0xEC, 0x4F, 0xF2, 0xBC,
-    0xB0, 0x8F, 0x32, 0xDA, 0x5F, 0x88, 0x70, 0x86, 0x05, 0x98, 0xF0, 0xCF, 0x54, 0x4A, 0xC5, 0x26,
-    0xB2, 0xE9, 0x80, 0x0B, 0x2A, 0xEC, 0x04, 0xA0, 0x68, 0x84, 0xE3, 0xD0, 0x25, 0x86, 0xC7, 0x8C,
-    0x92, 0x6F, 0xF1, 0xB0, 0xE4, 0x5F, 0xE0, 0x72, 0xF4, 0xDC, 0x68, 0xB2, 0xA8, 0x8F, 0x47, 0xB5,
-    0xF6, 0x44, 0xEB, 0x50, 0x3C, 0x15, 0x51, 0xE5, 0xB6, 0xAC, 0x17, 0xFE, 0x28, 0x74, 0x0B, 0xC1,
-    0x92, 0xB7, 0x72, 0xD3, 0x1F, 0xC7, 0x8A, 0xE5, 0xF2, 0x58, 0x2C, 0xB0, 0xFA, 0x22, 0x6B, 0x80,
-    0xC2, 0xCA, 0x6B, 0x33, 0x1D, 0x3C, 0x66, 0x1D, 0xD9, 0x8E, 0xAF, 0xAA, 0x5A, 0xBC, 0x6E, 0x28,
-    0xDC, 0xC4, 0x5D, 0xEF, 0x1B, 0xA0, 0x30, 0x45, 0xDE, 0xA2, 0x91, 0xB6, 0x0A, 0xB0, 0x89, 0x57,
-    0x78, 0xAD, 0xF3, 0x08, 0x51, 0xBE, 0xAD, 0x85, 0xD5, 0x6E, 0x9B, 0x93, 0x94, 0x87, 0x56, 0x6B,
-    0xCC, 0xE0, 0x36, 0x6A, 0x2E, 0x34, 0x14, 0x69, 0xDC, 0x9A, 0xAD, 0x91, 0x36, 0x8D, 0xD3, 0xBD,
-    0xA7, 0x55, 0x51, 0x35, 0xC7, 0xAB, 0xA8, 0x74, 0x07, 0x6D, 0xA8, 0xA2, 0x5A, 0x47, 0xFD, 0x82,
-    0x83, 0x73, 0x55, 0xCE, 0x1A, 0x3D, 0x41, 0x96, 0xED, 0x7B, 0xAD, 0xC5, 0x07, 0x4C, 0x37, 0x30,
-    0xE8, 0x13, 0xD9, 0x07, 0xBC, 0x3A, 0x1C, 0x2D, 0x5B, 0x03, 0x1C, 0x35, 0x61, 0x1B, 0xD5, 0xC8,
-    0xD7, 0x66, 0xE6, 0x6E, 0x69, 0x7D, 0x3B, 0x4D, 0xD6, 0xFA, 0x95, 0x48, 0xE9, 0xEE, 0x70, 0x98,
-    0x70, 0x1D, 0x51, 0xFB, 0x37, 0xCD, 0x59, 0x31, 0xAF, 0xDC, 0xC6, 0x11, 0x1E, 0x92, 0x7A, 0xEF,
-    0x10, 0x11, 0x09, 0x55, 0xF8, 0x01, 0xB1, 0x04, 0x98, 0x6D, 0x22, 0xC4, 0x60, 0x7E, 0x80, 0x63,
-    0xD2, 0x71, 0x91, 0x22, 0x85, 0xAF, 0xD0, 0x01, 0x01, 0x5C, 0xA8, 0x49, 0x11, 0xA8, 0x88, 0xDC,
-    0x18, 0x48, 0x52, 0x98, 0x44, 0xF4, 0x07, 0x84, 0x20, 0x48, 0x93, 0xC2, 0x2A, 0x6C, 0x20, 0x7A,
-    0x01, 0xE2, 0x14, 0x29, 0x5C, 0xD8, 0x26, 0x6D, 0xFF, 0x01, 0xBA, 0x72, 0x19, 0x1A, 0xB0, 0x1A,
-    0xBB, 0xF0, 0x1A, 0x60, 0x02, 0x4A, 0x21, 0xB9, 0xF9, 0xBE, 0x59, 0x92, 0x77, 0xF7, 0xDE, 0x93,
-    0x64, 0x41, 0xCF, 0x48, 0x78, 0xE4, 0x72, 0x49, 0xCE, 0xCE, 0xCE, 0xCC, 0xCE, 0xCE, 0x7C, 0xBB,
-    0x27, 0x6B, 0x91, 0x7F, 0x88, 0x3C, 0x2F, 0x37, 0xDE, 0xC9, 0xAC, 0x2D, 0xCC, 0x73, 0x62, 0x7E,
-    0x23, 0xE6, 0x8E, 0x18, 0x79, 0xDA, 0xF3, 0x8E, 0x88, 0x97, 0xC9, 0xAA, 0x90, 0xE7, 0x44, 0xDE,
-    0x38, 0xCE, 0x4A, 0x5B, 0x3D, 0x1F, 0x54, 0xE1, 0xCB, 0x95, 0x7F, 0xAB, 0x92, 0xE0, 0xE9, 0xCF,
-    0x62, 0xB3, 0x59, 0x5B, 0x6B, 0x96, 0x13, 0x8F, 0xA7, 0xDF, 0x1C, 0x6D, 0x36, 0x9B, 0x6B, 0xA5,
-    0xB5, 0xB6, 0xDF, 0x16, 0x39, 0x0B, 0xE1, 0xC1, 0xC7, 0xEC, 0x44, 0x21, 0x7B, 0x07, 0x5F, 0xD9,
-    0xB9, 0xE5, 0x43, 0x2A, 0x72, 0xEA, 0x78, 0xA2, 0x56, 0x47, 0x72, 0xB0, 0x2E, 0xB3, 0xC8, 0xFC,
-    0x3F, 0x5D, 0x37, 0xE4, 0xF0, 0x8E, 0x0A, 0x97, 0xD2, 0x24, 0x5A, 0xD0, 0x92, 0x3B, 0x2A, 0x9E,
-    0xF8, 0xE0, 0x0D, 0xC1, 0xB0, 0xEA, 0xC3, 0x3E, 0xEA, 0xE3, 0x2E, 0x6D, 0x53, 0x93, 0x9B, 0xA3,
-    0x75, 0x38, 0x44, 0x03, 0x9E, 0xFB, 0xB8, 0x4D, 0x4C, 0xDA, 0xA4, 0x75, 0x5E, 0x1D, 0x49, 0x60,
-    0x65, 0x65, 0x25, 0x1C, 0x25, 0x1A, 0x24, 0xEA, 0x25, 0xEA, 0x24, 0x36, 0x92, 0x18, 0x49, 0x6B,
-    0x39, 0xCA, 0x24, 0x6F, 0x72, 0x93, 0x9A, 0xA4, 0x8D, 0xBB, 0x08, 0xBC, 0x82, 0xC1, 0x1F, 0x64,
-    0xE3, 0x0D, 0x52, 0x4A, 0x30, 0x78, 0x68, 0xD8, 0xFB, 0xA3, 0xE0, 0x35, 0x1A, 0xF7, 0xE1, 0x20,
-    0x24, 0x92, 0xB4, 0x65, 0x61, 0x92, 0x4E, 0xD0, 0xB2, 0x93, 0xA3, 0xF5, 0xD1, 0x5A, 0xC2, 0x01,
-    0xBD, 0x44, 0x03, 0xFA, 0x01, 0xDD, 0x28, 0xB1, 0x12, 0x93, 0x2E, 0x31, 0xE8, 0x2F, 0x6D, 0x62,
-    0x76, 0x87, 0x3E, 0xF3, 0x8A, 0xBD, 0xB2, 0xDF, 0xA8, 0x5F, 0x8D, 0xA4, 0x8D, 0xFB, 0x68, 0x48,
-    0xC0, 0x36, 0x05, 0x61, 0x6A, 0xE2, 0x96, 0x64, 0xA0, 0x6A, 0xCA, 0x22, 0xAD, 0x36, 0x20, 0xCC,
-    0x9B, 0xA4, 0x75, 0x1D, 0xE1, 0x2B, 0xF8, 0x91, 0xA9, 0x8A, 0x01, 0x06, 0x83, 0x13, 0x0D, 0x42,
-    0x5B, 0x81, 0xDC, 0x56, 0x64, 0x83, 0x9F, 0x5C, 0xBD, 0x0D, 0x5B, 0x61, 0x32, 0xA4, 0x8D, 0x48,
-    0xC2, 0xAB, 0x16, 0x89, 0x79, 0x55, 0xB2, 0x8E, 0xAA, 0x67, 0xE8, 0x09, 0xF3, 0x35, 0xBE, 0xF3,
-    0x05, 0x38, 0x55, 0xA2, 0x57, 0x3C, 0x5F, 0x13, 0x7D, 0x32, 0x5F, 0x13, 0x9F, 0x74, 0xF7, 0x32,
-    0xFB, 0xD7, 0x65, 0x8C, 0x1D, 0xF4, 0xD3, 0x2B, 0xE6, 0x05, 0x9A, 0x88, 0x57, 0x2D, 0xF6, 0xAB,
-    0x2F, 0x07, 0xF4, 0xB5, 0x5C, 0x7C, 0xA7, 0xDF, 0x62, 0xB3, 0xDF, 0x06, 0xEF, 0xEE, 0x5E, 0xBF,
-    0x77, 0x77, 0x97, 0xF6, 0xED, 0x57, 0x3E, 0xF9, 0xC5, 0x1E, 0xFD, 0xDC, 0x86, 0x7D, 0x6E, 0x30,
-    0xAE, 0x75, 0x64, 0xDB, 0xC4, 0xF6, 0x29, 0xCF, 0x41, 0x4F, 0xD6, 0x13, 0xDB, 0x45, 0xD6, 0xF8,
-    0xB6, 0x80, 0xD7, 0xE0, 0xEA, 0x44, 0x30, 0xC9, 0x6C, 0x23, 0x76, 0x14, 0x6B, 0x6B, 0x6B, 0x3B,
-    0x3D, 0x6B, 0x3E, 0x36, 0xFC, 0xD4, 0x29, 0x19, 0x8E, 0x2B, 0x45, 0x6E, 0xF0, 0xA9, 0x2B, 0xE1,
-    0x4F, 0x07, 0xD9, 0x95, 0x42, 0x7E, 0x2D, 0xA5, 0xF1, 0x6C, 0x65, 0xDB, 0x00, 0xE4, 0x28, 0x1A,
-    0xDB, 0xFA, 0xB6, 0xCE, 0xD1, 0xAA, 0x3A, 0xC8, 0x30, 0x92, 0x20, 0xB9, 0x2B, 0xFE, 0xE7, 0xA5,
-    0x09, 0x6C, 0x11, 0x0D, 0xA4, 0xA8, 0x12, 0x6B, 0xDB, 0x95, 0xBB, 0xE1, 0x29, 0x1E, 0xF3, 0xC6,
-    0xB7, 0x59, 0xD4, 0x83, 0xFC, 0x19, 0xF1, 0xD6, 0x57, 0x8A, 0xD2, 0xD8, 0x96, 0xBF, 0xBC, 0x39,
-    0xC8, 0x6E, 0x1C, 0x17, 0xD6, 0x56, 0x4F, 0x1F, 0xF7, 0x96, 0xF3, 0xEF, 0x22, 0xC7, 0xC7, 0x08,
-    0xAA, 0xE7, 0x12, 0xEE, 0xB6, 0x71, 0x2F, 0x87, 0xCE, 0x67, 0x9D, 0xE7, 0x22, 0x34, 0xF8, 0xFC,
-    0xEE, 0xB8, 0x78, 0x4D, 0x64, 0x39, 0x5F, 0xDF, 0x64, 0xE7, 0xC8, 0xFC, 0xEA, 0x31, 0x1C, 0x68,
-    0x7B, 0x1E, 0x6D, 0xCE, 0x4D, 0xF2, 0xDD, 0xC3, 0x03, 0x4F, 0x49, 0x2B, 0xAD, 0x47, 0x16, 0x1E,
-    0x55, 0xBA, 0x7A, 0x02, 0x8F, 0x97, 0x29, 0xC6, 0xA7, 0xFF, 0xB1, 0x82, 0x09, 0xAB, 0x47, 0x5E,
-    0xD9, 0x6C, 0x35, 0x85, 0xE4, 0xB2, 0x82, 0xF7, 0x74, 0xAE, 0x6E, 0x8B, 0xB2, 0x8A, 0xCD, 0xB6,
-    0x8E, 0x80, 0xB1, 0xD4, 0x27, 0x96, 0x5A, 0x9F, 0xD3, 0x46, 0x59, 0x94, 0xBF, 0xB7, 0xDE, 0x35,
-    0x11, 0x38, 0x18, 0xDE, 0xDE, 0x1A, 0x62, 0xB8, 0x3D, 0xFA, 0x4F, 0x3F, 0xB1, 0x51, 0x97, 0xDB,
-    0x26, 0xB0, 0x96, 0x91, 0x33, 0x46, 0x76, 0x6A, 0x23, 0x64, 0xDB, 0x08, 0x33, 0xE4, 0x33, 0xFB,
-    0x4A, 0x1F, 0x75, 0x65, 0x15, 0xC0, 0x0B, 0x3F, 0xB2, 0xC1, 0x80, 0x60, 0x59, 0xCB, 0x8D, 0xCC,
-    0xBE, 0x3C, 0x06, 0x63, 0xD2, 0x70, 0xAE, 0xFB, 0x78, 0x1B, 0x8C, 0x69, 0xC3, 0xB9, 0x86, 0xDA,
-    0xE0, 0x4F, 0x75, 0x0D, 0x91, 0x53, 0x3D, 0x6A, 0xB7, 0x34, 0x69, 0x13, 0x8C, 0xCA, 0xA7, 0xA1,
-    0x66, 0x6C, 0x1D, 0x93, 0x27, 0x24, 0xF5, 0xEC, 0x9B, 0x7D, 0x74, 0x1F, 0x92, 0x23, 0x9C, 0x62,
-    0xF6, 0xB5, 0x21, 0x64, 0x00, 0x4B, 0x86, 0x73, 0x95, 0x0D, 0x2C, 0x71, 0xE1, 0x5D, 0x39, 0x19,
-    0x40, 0xD6, 0xAA, 0xCB, 0xC9, 0xC3, 0x57, 0xFB, 0xD6, 0xCB, 0xF3, 0xAE, 0x8D, 0x4F, 0xDA, 0x79,
-    0xB6, 0x35, 0xE2, 0xE2, 0x72, 0xD0, 0xDE, 0xC1, 0x4E, 0xE2, 0xDC, 0xB5, 0xF9, 0x49, 0xBB, 0x2F,
-    0xB6, 0x6F, 0xF6, 0x9F, 0xF3, 0x6A, 0xFF, 0x79, 0x37, 0x75, 0x63, 0x1C, 0x3E, 0xB2, 0xE2, 0xC6,
-    0x81, 0x51, 0x58, 0xC7, 0x22, 0xA2, 0x5E, 0x3D, 0xD4, 0xAB, 0x39, 0x1E, 0x3F, 0x47, 0x6C, 0x32,
-    0xD4, 0x39, 0xB1, 0x2D, 0xC7, 0x24, 0xC2, 0x98, 0x74, 0xB0, 0x47, 0x95, 0x23, 0x37, 0x47, 0x08,
-    0x5E, 0x9F, 0xD9, 0x3F, 0x23, 0x1D, 0x94, 0xB5, 0xFD, 0x14, 0x51, 0x7D, 0x1A, 0x1B, 0xD8, 0xB1,
-    0xB1, 0x3F, 0x85, 0x22, 0x18, 0x9F, 0x5B, 0x1C, 0x1F, 0x93, 0x7C, 0x6D, 0x69, 0x4B, 0x18, 0x34,
-    0x18, 0x7D, 0x9B, 0x98, 0xF8, 0x6B, 0xAB, 0x8A, 0x73, 0x34, 0x76, 0x9F, 0x99, 0x1C, 0x76, 0x9F,
-    0x31, 0x5E, 0x7B, 0xCF, 0x09, 0x22, 0x64, 0x30, 0xC6, 0x26, 0x31, 0xF6, 0x25, 0xF2, 0x4B, 0x2B,
-    0x70, 0x1C, 0xA2, 0x16, 0xFD, 0xFD, 0xDE, 0xAA, 0x46, 0x32, 0xC9, 0x53, 0x42, 0x1E, 0x1D, 0xBF,
-    0xD2, 0x76, 0x2B, 0xC8, 0x9B, 0x12, 0x4B, 0xD0, 0x91, 0x53, 0x46, 0x59, 0x2B, 0x31, 0xF4, 0x91,
-    0xD5, 0x34, 0x8E, 0x79, 0xCF, 0xB8, 0x3C, 0x59, 0xE5, 0x9A, 0x02, 0x32, 0x44, 0x3E, 0x84, 0xEE,
-    0x96, 0x51, 0x1B, 0x23, 0x66, 0x0B, 0x8C, 0x0B, 0x86, 0x22, 0xEC, 0x24, 0x32, 0xCC, 0x30, 0x69,
-    0xC1, 0xAF, 0x31, 0x53, 0x9C, 0x52, 0xE4, 0x48, 0x1A, 0x85, 0x85, 0x17, 0x79, 0xA4, 0x83, 0xAF,
-    0x84, 0x1D, 0x98, 0x47, 0x46, 0xA9, 0x91, 0x59, 0xD2, 0x22, 0xA9, 0x5C, 0x8B, 0xC8, 0xB5, 0x41,
-    0x8A, 0x64, 0x2B, 0x0C, 0x17, 0xDB, 0x95, 0xAE, 0x25, 0x87, 0x5B, 0x53, 0x23, 0x5B, 0x07, 0xAE,
-    0x7D, 0xD8, 0x2A, 0x07, 0x30, 0x22, 0x0F, 0x24, 0x3B, 0xF8, 0x2E, 0xFA, 0x85, 0x0B, 0x42, 0x1B,
-    0x55, 0xB0, 0xE0, 0x1C, 0x46, 0x1F, 0xA1, 0x91, 0xA0, 0x83, 0xAD, 0x5A, 0x97, 0x6D, 0x43, 0x66,
-    0x5B, 0x9A, 0x4F, 0x94, 0x33, 0xE8, 0xE0, 0x0B, 0x69, 0x05, 0xE1, 0x95, 0x5B, 0x68, 0x56, 0x2D,
-    0xE8, 0xFD, 0x9E, 0x2D, 0x88, 0x30, 0x14, 0x4D, 0x68, 0x2B, 0x26, 0xE8, 0x51, 0x05, 0xD2, 0x96,
-    0xE8, 0x80, 0x6D, 0x53, 0xD7, 0x1A, 0x1D, 0xB1, 0x7D, 0xE8, 0x38, 0x04, 0x9D, 0xF2, 0xF0, 0x9C,
-    0x97, 0x46, 0x85, 0x4B, 0xC7, 0x3A, 0xA5, 0xE0, 0x98, 0x03, 0x9C, 0xB5, 0xEF, 0xC5, 0x6F, 0x73,
-    0x09, 0x4C, 0x9A, 0x85, 0x75, 0x5C, 0x45, 0x55, 0x54, 0x27, 0xD9, 0xCA, 0xA4, 0x12, 0xB4, 0xE2,
-    0x6B, 0x96, 0x4C, 0x7A, 0x29, 0x5B, 0x8F, 0x53, 0x0B, 0x33, 0x5D, 0xD2, 0x5E, 0xF2, 0x96, 0x65,
-    0x0C, 0x18, 0x63, 0x33, 0x1F, 0x79, 0xC1, 0x1A, 0x7D, 0xEE, 0x88, 0x92, 0x31, 0x38, 0x05, 0x1B,
-    0x81, 0x26, 0xA1, 0x07, 0xC2, 0xE9, 0xE0, 0x03, 0xF3, 0x33, 0xC8, 0x38, 0xBC, 0x15, 0x1A, 0xA2,
-    0x39, 0x10, 0x08, 0x8C, 0x15, 0x54, 0x7B, 0x93, 0x32, 0xA3, 0xB5, 0x2E, 0x89, 0x5F, 0x4B, 0xD9,
-    0xC8, 0xBB, 0x02, 0xF3, 0xA2, 0x05, 0xC0, 0x12, 0x13, 0x6B, 0x48, 0x76, 0x50, 0x15, 0x9C, 0xF0,
-    0xF4, 0x1D, 0x24, 0x52, 0x21, 0x13, 0xCA, 0x40, 0x82, 0x90, 0x2E, 0x06, 0x82, 0x44, 0xB5, 0xB5,
-    0x4D, 0xA9, 0x73, 0x2F, 0x7D, 0xA0, 0x9F, 0x1B, 0x44, 0x2A, 0xF9, 0x00, 0x50, 0x2B, 0xB0, 0x3D,
-    0x1A, 0xA0, 0x19, 0x27, 0x0E, 0xEE, 0x3E, 0xF3, 0x6F, 0x95, 0x98, 0xD0, 0x02, 0x9E, 0x15, 0x87,
-    0x05, 0xB2, 0x6C, 0xF6, 0x43, 0xFA, 0xAA, 0x51, 0x97, 0x23, 0x2D, 0x5C, 0x91, 0xCC, 0x81, 0xF6,
-    0x84, 0x5A, 0x04, 0x74, 0x75, 0x32, 0x07, 0x01, 0x9B, 0x16, 0x20, 0xC0, 0xE7, 0xB2, 0x76, 0x70,
-    0x90, 0x96, 0x82, 0x3D, 0x09, 0x04, 0x20, 0x48, 0x85, 0xF7, 0xF2, 0x63, 0x0D, 0x27, 0x9C, 0xDA,
-    0x25, 0x33, 0xB8, 0x5D, 0x0A, 0x7D, 0x64, 0xAA, 0x3F, 0x59, 0xE4, 0x4C, 0xFF, 0x39, 0x01, 0xC7,
-    0x89, 0x22, 0x45, 0x91, 0xA5, 0x8D, 0x77, 0xAA, 0x00, 0x02, 0xDC, 0x85, 0xB6, 0x0A, 0x23, 0x14,
-    0x44, 0x4C, 0xBD, 0xAD, 0xA6, 0x2E, 0x15, 0x3C, 0x28, 0x74, 0x70, 0x49, 0xA6, 0xC4, 0x04, 0x83,
-    0xCE, 0x1D, 0xF1, 0xFE, 0xE8, 0x10, 0x71, 0x62, 0x3F, 0xB5, 0xC5, 0x77, 0x11, 0x34, 0x2A, 0xC6,
-    0x9C, 0xB9, 0xF8, 0x90, 0x33, 0xF1, 0x63, 0xE8, 0x9E, 0xFF, 0x13, 0xF3, 0x34, 0x67, 0xB0, 0x44,
-    0x32, 0xE0, 0x8C, 0x85, 0x62, 0x29, 0x6D, 0x4E, 0x08, 0xB5, 0x53, 0x9C, 0x38, 0x2E, 0xDE, 0xE6,
-    0x07, 0xDA, 0x32, 0x27, 0x71, 0xC9, 0x22, 0xEF, 0x66, 0xE2, 0x25, 0x3E, 0x53, 0x02, 0xBB, 0x2D,
-    0xAE, 0x1E, 0x1F, 0x1F, 0xDF, 0x75, 0x5F, 0xBE, 0xCF, 0xA2, 0xFE, 0x09, 0x85, 0x36, 0x31, 0xCA,
-    0x55, 0x15, 0x12, 0x57, 0x66, 0x3E, 0x98, 0x7C, 0x00, 0x86, 0xF7, 0xDE, 0x41, 0x25, 0xB6, 0x1C,
-    0x36, 0xAF, 0xBC, 0x4F, 0xE2, 0x1B, 0x6F, 0xE9, 0xC8, 0x11, 0xB5, 0xE5, 0x23, 0x22, 0x0A, 0x60,
-    0x38, 0x50, 0xED, 0x8A, 0xE8, 0x33, 0x8B, 0x18, 0xCF, 0xAA, 0x17, 0x39, 0xC4, 0xCD, 0x0B, 0x24,
-    0x6E, 0xF6, 0xA4, 0x85, 0x74, 0x3E, 0x64, 0xC5, 0x38, 0xCA, 0xAA, 0x9E, 0xD0, 0x2C, 0xD8, 0xA4,
-    0xF8, 0xF4, 0x86, 0xFB, 0xEC, 0x75, 0xD3, 0xE7, 0x86, 0x8C, 0x1C, 0x49, 0x32, 0x01, 0xD9, 0xF7,
-    0x39, 0xB3, 0xDE, 0x03, 0x87, 0x17, 0x41, 0x92, 0x08, 0x66, 0x56, 0x81, 0x99, 0x55, 0xC5, 0xD9,
-    0xAA, 0x49, 0xB5, 0x91, 0xC8, 0xE1, 0x5F, 0x96, 0xBE, 0x56, 0xFD, 0x63, 0xAA, 0xDB, 0x2C, 0xB3,
-    0xC6, 0x8C, 0x9E, 0xD3, 0xF4, 0xAD, 0xEE, 0xE6, 0x9C, 0xC9, 0x71, 0x34, 0x67, 0x56, 0xE7, 0x71,
-    0xB8, 0x69, 0xD7, 0xDB, 0x45, 0x4F, 0xB1, 0x5D, 0xE2, 0xD5, 0x0B, 0xD6, 0xB8, 0x39, 0x93, 0x06,
-    0x36, 0x9A, 0xBB, 0x8B, 0x86, 0x70, 0x98, 0x93, 0x65, 0x1F, 0xB8, 0xD4, 0x86, 0xE8, 0xF3, 0x03,
-    0xDF, 0xE5, 0xB9, 0x40, 0x3F, 0x9E, 0xAA, 0x6A, 0xEB, 0xB0, 0xDD, 0xAB, 0xFE, 0xD6, 0xEF, 0x0F,
-    0x1B, 0xF9, 0x7C, 0x65, 0x56, 0x55, 0xFE, 0x60, 0xC0, 0xE4, 0xB1, 0x5F, 0xFE, 0x1B, 0xAE, 0x4E,
-    0x09, 0x3D, 0xCA, 0xE9, 0xAA, 0x3E, 0xAB, 0xF5, 0x0D, 0x38, 0xE2, 0x1D, 0xEF, 0xAF, 0xD6, 0x3E,
-    0x40, 0x28, 0xD1, 0x84, 0x98, 0x8E, 0x2A, 0x77, 0xA5, 0x22, 0x73, 0xF2, 0x7D, 0x65, 0x28, 0x72,
-    0x4E, 0x08, 0xF0, 0x0A, 0x87, 0x61, 0x84, 0xD1, 0x03, 0x4B, 0x61, 0xB9, 0x76, 0x93, 0xD5, 0xC8,
-    0x54, 0x12, 0x31, 0xCC, 0xCA, 0x7B, 0x3E, 0x69, 0x5B, 0x0E, 0xE2, 0x05, 0x35, 0xDD, 0x25, 0x0F,
-    0xCB, 0xD5, 0xCD, 0xB5, 0x74, 0xC2, 0xF8, 0x3C, 0x8F, 0x36, 0xB4, 0x8E, 0xA7, 0x38, 0xCA, 0x69,
-    0x12, 0xAA, 0xE4, 0x91, 0xDA, 0x24, 0x69, 0x5C, 0xB6, 0x77, 0x39, 0x5A, 0x5C, 0xDE, 0x9A, 0x09,
-    0xDD, 0x28, 0x45, 0xAD, 0x12, 0xBA, 0x80, 0x53, 0xB9, 0xE4, 0xBD, 0x25, 0x1C, 0x4F, 0x12, 0x3A,
-    0x54, 0xE0, 0xA0, 0x87, 0x03, 0x1C, 0x4A, 0xE8, 0xEF, 0x12, 0x76, 0x27, 0x09, 0xF7, 0x80, 0x72,
-    0x2D, 0x8F, 0x3A, 0xEF, 0x65, 0x5B, 0x4A, 0xD4, 0x1F, 0x4D, 0xBC, 0xC3, 0x16, 0x00, 0x0A, 0xF9,
-    0xD7, 0x9D, 0xF4, 0xE3, 0x87, 0x9F, 0x47, 0xB9, 0x59, 0x28, 0x51, 0x7F, 0x34, 0xF1, 0x42, 0x99,
-    0xDA, 0xED, 0x24, 0x43, 0xE0, 0xB9, 0x2D, 0x57, 0x10, 0x45, 0x18, 0x7C, 0xFC, 0x69, 0xE7, 0x62,
-    0x8C, 0xE8, 0x00, 0x9C, 0xF8, 0x3F, 0xA3, 0x3F, 0x24, 0xF7, 0x6F, 0xDA, 0x8F, 0xED, 0x9F, 0x6C,
-    0xF7, 0x3D, 0x04, 0xDA, 0x0F, 0x6B, 0x06, 0x7B, 0xD8, 0xB4, 0xD2, 0x28, 0x3C, 0x55, 0x3A, 0x71,
-    0xF1, 0x9F, 0x9F, 0x56, 0x73, 0x60, 0x4E, 0x2C, 0xDD, 0x18, 0x7D, 0x11, 0x55, 0x10, 0xBD, 0x06,
-    0x9C, 0x08, 0x39, 0x7D, 0x82, 0x03, 0x48, 0x6C, 0x11, 0x0F, 0x53, 0xC3, 0x84, 0xB3, 0xDC, 0x4E,
-    0xA3, 0xA7, 0x43, 0xE5, 0x10, 0xEA, 0x14, 0x93, 0x88, 0x83, 0xCF, 0x38, 0x42, 0x04, 0x33, 0xEF,
-    0x5D, 0x99, 0xFB, 0x9D, 0x82, 0x5A, 0xA8, 0x91, 0xA6, 0x9F, 0xBA, 0x59, 0xDE, 0x2C, 0x5D, 0x68,
-    0x90, 0xBB, 0xB6, 0x6F, 0x02, 0xAE, 0x36, 0x61, 0x05, 0xDB, 0x6A, 0xFC, 0xA5, 0x8D, 0x60, 0x0A,
-    0xA7, 0x7A, 0x65, 0x0D, 0x15, 0xAF, 0x4A, 0xF5, 0xF6, 0xDD, 0xDB, 0xF4, 0x12, 0x0A, 0x4F, 0xEA,
-    0x32, 0x9D, 0x43, 0xD9, 0xDC, 0xA8, 0xAA, 0x58, 0x4D, 0x52, 0x02, 0xDC, 0xA8, 0x26, 0x6E, 0x94,
-    0x00, 0x59, 0xDF, 0xE1, 0x6A, 0x77, 0xAB, 0x55, 0x9A, 0xA3, 0xEC, 0x0C, 0xC5, 0x90, 0x3B, 0xA8,
-    0x16, 0x58, 0x53, 0x05, 0x58, 0x6B, 0xF7, 0x66, 0x94, 0x19, 0x78, 0xB2, 0xF9, 0xC1, 0x12, 0x49,
-    0x5A, 0x84, 0x18, 0x80, 0x25, 0x82, 0xF1, 0x01, 0x37, 0xD5, 0xA2, 0x6C, 0x63, 0x9D, 0xDA, 0x26,
-    0x1A, 0x5F, 0x65, 0x3A, 0x5E, 0x65, 0x73, 0x56, 0x2E, 0x8D, 0xBB, 0x35, 0x94, 0x1B, 0x2F, 0x73,
-    0xA7, 0x13, 0x6F, 0x11, 0x13, 0x1D, 0xBD, 0x9D, 0xCA, 0x78, 0x5C, 0x76, 0x50, 0xA7, 0x9A, 0x72,
-    0x33, 0xC1, 0xE3, 0xC6, 0x59, 0xCD, 0x5B, 0xB7, 0xDC, 0xA0, 0xC5, 0xC1, 0xFA, 0xE4, 0x10, 0x41,
-    0x0B, 0x84, 0x1C, 0x6A, 0x41, 0x23, 0x40, 0xFC, 0x64, 0x3C, 0x79, 0xCB, 0x1D, 0x33, 0x68, 0xE2,
-    0xAD, 0x19, 0x14, 0x36, 0x9B, 0x6B, 0xF9, 0xB2, 0xB9, 0xC6, 0xA2, 0x43, 0xFA, 0x51, 0x49, 0x73,
-    0x3A, 0x2E, 0xDD, 0xC5, 0x57, 0x5C, 0xCC, 0xC1, 0xD4, 0xD0, 0x18, 0x2F, 0x09, 0xAC, 0x9C, 0x29,
-    0x14, 0x1E, 0xA8, 0x4B, 0x38, 0xC0, 0xB0, 0x50, 0xD0, 0x21, 0xD5, 0x69, 0xC1, 0x74, 0xED, 0x12,
-    0x5D, 0xA1, 0xA5, 0xD1, 0x12, 0x9A, 0x06, 0xDC, 0x52, 0x63, 0x39, 0x6A, 0x69, 0x9F, 0xB0, 0x1C,
-    0x77, 0x38, 0x38, 0x6E, 0x0D, 0x4B, 0xA2, 0x6A, 0xCD, 0x39, 0xE7, 0x5B, 0xBE, 0xE8, 0x6B, 0x70,
-    0xF2, 0x74, 0x4B, 0x8D, 0xC6, 0xCA, 0x34, 0x7C, 0x67, 0xA1, 0x96, 0x98, 0xC8, 0x6D, 0x92, 0xC5,
-    0x5A, 0x26, 0x5A, 0xA6, 0xDF, 0xA0, 0x4C, 0x76, 0x5A, 0x81, 0xC3, 0xFD, 0x3C, 0x5B, 0xD9, 0x2D,
-    0x67, 0xB8, 0x98, 0xEE, 0x6D, 0xB2, 0x47, 0x5C, 0x6B, 0x07, 0x59, 0x98, 0x39, 0x6A, 0x4D, 0x1F,
-    0xEF, 0xA3, 0x49, 0xF7, 0x1E, 0xFA, 0xEF, 0x59, 0x0C, 0x4B, 0x31, 0x9E, 0x51, 0x0C, 0x0B, 0x5D,
-    0xFF, 0xFE, 0x75, 0x34, 0x53, 0x06, 0xE5, 0x94, 0x89, 0x46, 0xB2, 0x47, 0x47, 0xFE, 0xDD, 0x39,
-    0xCE, 0xBB, 0xA2, 0x9F, 0x8A, 0x4B, 0x7E, 0x2F, 0xEB, 0xFC, 0x0F, 0xC0, 0xE6, 0x4B, 0x33, 0xE3,
-    0xB2, 0xED, 0x75, 0xFB, 0x47, 0xCE, 0xC7, 0x6A, 0xC2, 0x46, 0xF6, 0xCD, 0xD6, 0xE5, 0xD3, 0xD5,
-    0x08, 0x8F, 0xF0, 0x06, 0xE6, 0xD0, 0x1F, 0x79, 0x95, 0x6C, 0xB7, 0x86, 0x5A, 0xDD, 0x1A, 0x6A,
-    0x0E, 0xCE, 0x88, 0x31, 0x47, 0x98, 0xDC, 0xDB, 0xAD, 0x44, 0xAE, 0x38, 0x00, 0x5E, 0x9E, 0x06,
-    0xD3, 0xFC, 0x4F, 0x8F, 0x27, 0x46, 0x6F, 0xDF, 0xAE, 0xF1, 0xBF, 0x6D, 0xF6, 0x8A, 0x1B, 0x7C,
-    0x20, 0x9D, 0x55, 0x8F, 0xA0, 0x88, 0x2B, 0x6A, 0x73, 0xAC, 0x8B, 0xE3, 0xC2, 0xED, 0x67, 0x38,
-    0x24, 0x01, 0x67, 0xE6, 0x86, 0x02, 0x05, 0x60, 0xD6, 0x67, 0x28, 0x5B, 0xB6, 0x23, 0x6B, 0x07,
-    0x0D, 0x40, 0x46, 0x14, 0xC1, 0xC4, 0x44, 0xB2, 0xB0, 0xF7, 0xEF, 0x44, 0x2D, 0x40, 0x8E, 0x49,
-    0xB8, 0x4F, 0x32, 0xE6, 0x55, 0x3C, 0x96, 0x15, 0x83, 0x98, 0xB7, 0x13, 0x00, 0x63, 0x7B, 0x8F,
-    0xB7, 0x5F, 0x11, 0x5A, 0x3D, 0x40, 0x70, 0xEB, 0x75, 0x4E, 0xDA, 0xB7, 0x6F, 0x76, 0xC9, 0xE8,
-    0xF6, 0xEE, 0x0D, 0x56, 0xC8, 0x97, 0x59, 0x29, 0x88, 0x66, 0x0F, 0x4A, 0x7B, 0x7F, 0xD9, 0xC8,
-    0xDF, 0x6E, 0x8F, 0x68, 0x32, 0x54, 0x38, 0x69, 0x6F, 0xBF, 0xDA, 0x73, 0x45, 0x28, 0xB9, 0xDB,
-    0xDB, 0x2D, 0x38, 0x82, 0x41, 0xFD, 0x82, 0x8E, 0xE6, 0x05, 0x71, 0x9B, 0xA2, 0xFD, 0x8C, 0x9B,
-    0x8B, 0xFE, 0xA2, 0x84, 0x4D, 0x9F, 0x00, 0x25, 0xF6, 0x65, 0x15, 0x8C, 0xA3, 0xEE, 0xD3, 0xF4,
-    0xBA, 0xB8, 0x57, 0x54, 0xDA, 0x6F, 0x0B, 0x7D, 0xC7, 0x5D, 0x00, 0xF4, 0x67, 0xB9, 0x33, 0xDE,
-    0x63, 0x99, 0x69, 0xFA, 0xB4, 0x0A, 0xAA, 0x3E, 0x92, 0x2D, 0x53, 0x1C, 0xCF, 0xCA, 0x14, 0x3F,
-    0x75, 0xE3, 0x46, 0xF3, 0xBB, 0xD6, 0x1C, 0x28, 0xBB, 0xF0, 0x70, 0xD7, 0xD3, 0x4D, 0x97, 0x92,
-    0xC8, 0x8B, 0x8B, 0x16, 0x4D, 0xFF, 0x9A, 0x30, 0xE5, 0x62, 0xF6, 0x18, 0xA7, 0x2D, 0xB3, 0xDD,
-    0xDE, 0x82, 0x25, 0x82, 0x4B, 0x9E, 0x09, 0xFF, 0x11, 0xE0, 0x8F, 0x00, 0xA7, 0xC9, 0xF1, 0x13,
-    0x6E, 0xA7, 0x59, 0xAE, 0x95, 0xB0, 0xE8, 0x7A, 0x89, 0x3B, 0x20, 0xBE, 0xE5, 0x7E, 0x08, 0xD7,
-    0xEB, 0x98, 0xBC, 0x2B, 0xFC, 0x24, 0xEC, 0x42, 0x78, 0x02, 0x50, 0x20, 0xF7, 0x0E, 0xE2, 0x06,
-    0xAB, 0xF5, 0xA4, 0x4E, 0xB0, 0x76, 0xE7, 0xEA, 0xBD, 0x48, 0xB3, 0x34, 0xCB, 0xB3, 0x59, 0xD5,
-    0x59, 0xDB, 0x79, 0xA7, 0x4A, 0x26, 0x01, 0x76, 0x9E, 0x65, 0x86, 0xF2, 0x17, 0x9E, 0x64, 0x26,
-    0xAA, 0x39, 0x20, 0x54, 0xE9, 0xD6, 0xB5, 0x99, 0x1A, 0x25, 0xE2, 0x42, 0xD1, 0x3D, 0xAB, 0x69,
-    0xE0, 0xD2, 0xCE, 0x3A, 0x6F, 0x3D, 0x09, 0xEB, 0x32, 0x3B, 0x53, 0xDE, 0xF9, 0x3E, 0xEB, 0x23,
-    0xAA, 0xE5, 0xA1, 0x12, 0xFF, 0x52, 0xE6, 0xFE, 0xEC, 0x09, 0x79, 0x66, 0xF9, 0x66, 0x79, 0x3D,
-    0x6D, 0x7A, 0xE9, 0x9B, 0xC8, 0x71, 0x41, 0xF6, 0xEC, 0xF3, 0x30, 0xFB, 0x2D, 0xF2, 0x3C, 0xFB,
-    0x24, 0x4A, 0x26, 0xBA, 0x2F, 0x30, 0x28, 0xD2, 0x3C, 0x65, 0x3F, 0xCA, 0x3D, 0xE9, 0x13, 0x73,
-    0xC1, 0xEB, 0x0D, 0x6A, 0xF1, 0x12, 0x71, 0xDE, 0x32, 0x02, 0xD4, 0x8F, 0xE6, 0xBD, 0x93, 0x13,
-    0xCC, 0x16, 0x60, 0x29, 0xB6, 0x10, 0xB7, 0x98, 0xDB, 0x2D, 0xDD, 0xFB, 0xCB, 0x8F, 0xF3, 0x62,
-    0x1D, 0xC9, 0xCB, 0x0E, 0x23, 0xD6, 0x4C, 0x19, 0xB6, 0xD1, 0xF9, 0x66, 0x4A, 0xAD, 0xBB, 0xF7,
-    0x1C, 0x8D, 0xC7, 0x9B, 0xC1, 0xF5, 0x75, 0x5A, 0x12, 0x57, 0xE6, 0xAA, 0xDD, 0x94, 0xCB, 0xA6,
-    0x9D, 0xEB, 0xE9, 0x7E, 0x17, 0xF7, 0xC3, 0x3B, 0xDC, 0x9E, 0x49, 0xB9, 0x7F, 0xB3, 0xB2, 0x74,
-    0xFA, 0x61, 0xB9, 0x07, 0x7A, 0xEF, 0x09, 0xAF, 0xD2, 0x8A, 0xA0, 0xEA, 0x19, 0x6E, 0x1E, 0x66,
-    0xA7, 0xF9, 0x4C, 0x77, 0xE4, 0xE7, 0xF2, 0x1E, 0x20, 0xC0, 0xF4, 0x4F, 0x64, 0x73, 0xF2, 0x7E,
-    0xE3, 0xF8, 0xD8, 0x7E, 0x71, 0x7C, 0x7C, 0xFB, 0x61, 0xED, 0xE1, 0x46, 0xB8, 0x67, 0x8C, 0xAD,
-    0xE8, 0xAF, 0x5D, 0xFA, 0x3F, 0x2D, 0x97, 0x93, 0x97, 0x5B, 0x47, 0x55, 0xD8, 0x9C, 0x25, 0x8F,
-    0x1E, 0x07, 0x59, 0x6A, 0x38, 0xC6, 0x65, 0x97, 0x9B, 0x2B, 0xC5, 0x4E, 0x24, 0xAE, 0xF3, 0xB6,
-    0xEC, 0xF8, 0x4B, 0x1B, 0x6F, 0x79, 0x7B, 0x38, 0x51, 0x5B, 0x50, 0x5F, 0x2C, 0x0E, 0xB3, 0x2D,
-    0x0E, 0xF0, 0xD4, 0xBF, 0x66, 0x6F, 0x21, 0xA7, 0x03, 0x7C, 0x2D, 0x77, 0x50, 0x02, 0xBE, 0xF2,
-    0x0F, 0xA5, 0xB6, 0x34, 0xF1, 0x6D, 0xFE, 0x15, 0x81, 0x45, 0xF2, 0xCE, 0xFF, 0x07, 0x47, 0xFF,
-    0xCA, 0xCE, 0xF5, 0x4F, 0x94, 0xFA, 0x35, 0xD9, 0x9E, 0xAF, 0x9F, 0xDF, 0xFF, 0x1C, 0x29, 0xFF,
-    0xCE, 0xE2, 0x7E, 0x62, 0xC8, 0xE0, 0x28, 0x04, 0x01, 0xE7, 0xF8, 0x9F, 0x95, 0xB0, 0xF4, 0x5A,
-    0x72, 0x5E, 0x0D, 0xDC, 0x85, 0x44, 0x5F, 0xDC, 0x3E, 0x38, 0x17, 0xE6, 0x6B, 0x4A, 0x1B, 0xFE,
-    0x4D, 0x9E, 0x5F, 0x15, 0x2F, 0x04, 0x55, 0x74, 0x5D, 0x51, 0xC3, 0x39, 0x49, 0x8E, 0x24, 0x72,
-    0x75, 0xFF, 0xCD, 0x39, 0x0E, 0xE8, 0x7F, 0x01, 0xED, 0x55, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x7D,
-    0x3C, 0xC2, 0x22, 0x20, 0x16, 0x4C, 0xA3, 0x46, 0x46, 0xC0, 0xFE, 0x5C, 0xB0, 0x49, 0xED, 0x5D,
-    0xA4, 0x75, 0xA3, 0xC2, 0x74, 0x93, 0x22, 0xBD, 0x1A, 0xFF, 0x04, 0x6E, 0xDC, 0xA4, 0x65, 0x8A,
-    0xF4, 0x2A, 0xED, 0x53, 0x71, 0x7F, 0x20, 0xB8, 0x25, 0x92, 0x22, 0x65, 0xF8, 0x13, 0x88, 0xC0,
-    0x95, 0x5D, 0x64, 0x8B, 0x43, 0xC0, 0x93, 0x75, 0x1C, 0xBF, 0x59, 0xDE, 0xC9, 0x88, 0x63, 0x1B,
-    0x70, 0x90, 0xD2, 0x5C, 0x0E, 0xA5, 0xDD, 0x9D, 0x7D, 0xF3, 0xF5, 0x66, 0x0F, 0xE0, 0xE3, 0x07,
-    0xA4, 0xB2, 0x47, 0x21, 0x82, 0x52, 0xC4, 0x99, 0x20, 0x9D, 0x19, 0x9A, 0xCE, 0xF4, 0x4D, 0x6F,
-    0xFE, 0x31, 0x38, 0xE7, 0x7A, 0xC5, 0x7D, 0xEA, 0xBA, 0x9C, 0xFA, 0x0B, 0xB9, 0x05, 0x9E, 0xB6,
-    0xA8, 0xD0, 0x38, 0x63, 0xEF, 0x11, 0xCC, 0xD8, 0x0F, 0x0F, 0x6E, 0x2D, 0xF6, 0x40, 0x3E, 0x01,
-    0x05, 0xC5, 0x50, 0x3C, 0x65, 0x9A, 0x90, 0xFE, 0x3D, 0x21, 0xFF, 0x73, 0x42, 0xF1, 0xEB, 0x04,
-    0xF3, 0xED, 0x84, 0xE6, 0x5A, 0xAE, 0xBC, 0x48, 0x50, 0x39, 0x7B, 0x22, 0x17, 0x58, 0x50, 0x4F,
-    0x05, 0x35, 0xCE, 0x57, 0xCF, 0x51, 0xD1, 0xA6, 0x8A, 0xF9, 0xF9, 0x31, 0x14, 0x37, 0x8A, 0xB4,
-    0x94, 0x91, 0xEB, 0xB4, 0xB1, 0x10, 0xEA, 0xCE, 0x72, 0x91, 0x08, 0x36, 0xDF, 0x4D, 0xF0, 0xD4,
-    0x6F, 0x24, 0xE0, 0xE4, 0x05, 0x97, 0xEF, 0x73, 0x8F, 0xBE, 0xA7, 0x94, 0x62, 0xAA, 0x51, 0x06,
-    0xA0, 0x1A, 0x88, 0xF1, 0xFB, 0x08, 0xF3, 0x97, 0x58, 0x23, 0x8C, 0x5F, 0xE3, 0xD5, 0x6F, 0x57,
-    0xC5, 0xC8, 0xCB, 0x9D, 0x74, 0x8C, 0xD7, 0x2E, 0x14, 0xFF, 0xC1, 0x15, 0x56, 0xAB, 0x15, 0x21,
-    0xC4, 0xAA, 0xAC, 0x56, 0xC4, 0x4B, 0xE8, 0x5F, 0xCA, 0xBD, 0x8C, 0xF9, 0x28, 0xB6, 0x88, 0xA0,
-    0x86, 0xA0, 0x4D, 0x47, 0x5B, 0x0E, 0x74, 0x83, 0xF6, 0x66, 0x95, 0x9C, 0x2A, 0xF7, 0x2E, 0x30,
-    0x3F, 0xFE, 0x25, 0x72, 0x99, 0x34, 0xF7, 0xB6, 0xD2, 0xDC, 0xD2, 0x62, 0x39, 0x34, 0xAE, 0x98,
-    0xD4, 0xBF, 0x31, 0xD6, 0x25, 0xD6, 0xA4, 0x67, 0x3D, 0xE2, 0x6E, 0x15, 0x6B, 0x50, 0xC6, 0xFC,
-    0xD3, 0xE6, 0xD3, 0xAB, 0x03, 0xCE, 0x40, 0x9C, 0xA8, 0x4B, 0xB3, 0xDE, 0xD1, 0x77, 0xD5, 0xEF,
-    0x62, 0x0C, 0x43, 0xD3, 0x57, 0x22, 0x7D, 0x21, 0xBE, 0x4B, 0x5E, 0x18, 0x3A, 0xD4, 0xA8, 0x43,
-    0xF6, 0x74, 0xCD, 0xF8, 0x99, 0x97, 0x42, 0x06, 0x9C, 0xDE, 0x10, 0xE3, 0x17, 0xE0, 0xF6, 0xF0,
-    0x5E, 0xCA, 0x73, 0xA6, 0x4C, 0xB3, 0x76, 0x5C, 0xE1, 0xEE, 0xE5, 0xEA, 0xB0, 0x38, 0xBF, 0x9C,
-    0x6A, 0x4D, 0xEA, 0xC7, 0x07, 0x4D, 0x26, 0x7E, 0xCC, 0x42, 0xD1, 0x97, 0x5D, 0x45, 0x2E, 0x18,
-    0x34, 0xF0, 0x1C, 0x9B, 0xF8, 0x6D, 0x38, 0xB8, 0xE6, 0xCA, 0xAE, 0xE8, 0xB3, 0xB0, 0x18, 0x37,
-    0x9C, 0xE9, 0xFF, 0x79, 0xC8, 0x42, 0xBA, 0x4D, 0xC7, 0xC5, 0xDD, 0x48, 0xC7, 0x74, 0x9B, 0x85,
-    0x3C, 0xE2, 0x18, 0xBB, 0x21, 0xAA, 0x85, 0xA9, 0xF6, 0x30, 0x9E, 0x95, 0xD9, 0xF9, 0x18, 0x97,
-    0x71, 0xD5, 0x2C, 0xF6, 0xC3, 0x82, 0xE3, 0xF3, 0x3F, 0x30, 0x1B, 0xE7, 0x2D, 0x7C, 0x9F, 0x4A,
-    0x5F, 0x4A, 0xDF, 0x48, 0x6F, 0xD6, 0xFD, 0xD7, 0x55, 0x0F, 0xF3, 0xF1, 0xF7, 0x4C, 0xA9, 0x8E,
-    0x84, 0xA6, 0x0B, 0x9A, 0x36, 0x4A, 0xB2, 0xD7, 0x62, 0x33, 0x08, 0xD7, 0x29, 0x91, 0x09, 0xDA,
-    0x04, 0x84, 0x37, 0x24, 0x89, 0x74, 0xF3, 0x74, 0x5F, 0x23, 0x12, 0xEF, 0x20, 0x67, 0x75, 0x6D,
-    0x13, 0x92, 0xA3, 0x64, 0x91, 0x2B, 0xC5, 0xF8, 0x89, 0x2C, 0xD2, 0xC2, 0xC1, 0x5B, 0x3C, 0x51,
-    0x02, 0x8F, 0xB3, 0x5C, 0x2B, 0xAE, 0xB2, 0xCC, 0x74, 0xDF, 0xF0, 0xAF, 0x79, 0x15, 0xCF, 0x5B,
-    0x6D, 0x84, 0x64, 0xD5, 0x7E, 0x69, 0xBA, 0x2F, 0x4D, 0xF7, 0x1F, 0x9A, 0x4E, 0x99, 0x97, 0x69,
-    0xB5, 0x6E, 0xC4, 0x26, 0x30, 0x91, 0x5D, 0x89, 0x8F, 0xCD, 0x11, 0xF3, 0x31, 0x0F, 0x66, 0xE7,
-    0x8D, 0xAE, 0xFD, 0xD1, 0x2D, 0x76, 0x27, 0x2E, 0xF1, 0x2D, 0xA3, 0x62, 0x35, 0x5F, 0x91, 0x4D,
-    0x4E, 0xFD, 0x30, 0xF6, 0x58, 0x2D, 0xA9, 0x6B, 0xCE, 0xB5, 0x30, 0x09, 0x2A, 0xB2, 0x2F, 0x66,
-    0x71, 0xFD, 0x12, 0xF3, 0x19, 0xB2, 0xEA, 0x8D, 0xE8, 0x19, 0xCB, 0x33, 0x9D, 0xA0, 0x3A, 0x88,
-    0xE9, 0x74, 0x6E, 0x9C, 0xB7, 0xDA, 0x01, 0xB9, 0x46, 0xBB, 0x6E, 0x71, 0x69, 0xCF, 0x5B, 0xE5,
-    0x48, 0x11, 0x04, 0xD9, 0x6E, 0x3F, 0x37, 0x2A, 0x59, 0xA6, 0xD5, 0x80, 0x6C, 0x59, 0xBD, 0x5B,
-    0xE4, 0xDB, 0x09, 0xE5, 0xE0, 0xAD, 0x7A, 0x79, 0x69, 0x4F, 0xDB, 0xFB, 0x13, 0x2F, 0x11, 0xEE,
-    0x3D, 0x5C, 0xEF, 0xF1, 0x95, 0xD2, 0x82, 0xDE, 0xD4, 0xB5, 0xBF, 0xF3, 0x6F, 0x8A, 0xF9, 0xA2,
-    0xC5, 0xD7, 0x5A, 0x99, 0x2D, 0x92, 0x8D, 0xC5, 0x12, 0x78, 0xC7, 0xF4, 0xA3, 0x3C, 0x1A, 0xF5,
-    0x22, 0xD2, 0x4E, 0x75, 0x91, 0xAB, 0xDD, 0xA7, 0x2F, 0xA2, 0xA5, 0x3D, 0x77, 0x4B, 0x3D, 0xE7,
-    0xDE, 0x17, 0xC6, 0xE0, 0xC8, 0x98, 0x67, 0xEC, 0xBE, 0x1F, 0x89, 0xF9, 0xFD, 0x40, 0xDC, 0x8E,
-    0xB8, 0x2A, 0x01, 0xE6, 0x37, 0xE6, 0xE4, 0x07, 0xEE, 0x31, 0x76, 0x43, 0x5E, 0x2D, 0xED, 0xE9,
-    0xD5, 0xF2, 0xA3, 0x3F, 0xAD, 0xC7, 0xB1, 0xB4, 0xCB, 0x7C, 0xCC, 0x89, 0xD6, 0x48, 0x13, 0x7D,
-    0x9C, 0x39, 0x3C, 0xDC, 0xF1, 0xD2, 0xC5, 0xAF, 0x9D, 0x3D, 0xFE, 0xD4, 0x97, 0x48, 0xEA, 0xF9,
-    0x8C, 0xF5, 0x79, 0xD1, 0xE6, 0x5B, 0x9E, 0x99, 0xF4, 0x8C, 0x8D, 0x0C, 0x71, 0xE6, 0xDD, 0x19,
-    0x57, 0xCD, 0xCC, 0xD1, 0xBE, 0xD2, 0x7D, 0xCF, 0xFB, 0xF1, 0xD1, 0xF0, 0xEF, 0x2C, 0x53, 0x4E,
-    0x26, 0x5E, 0x09, 0xC1, 0x5F, 0xF7, 0x24, 0x0A, 0xAF, 0x99, 0x46, 0x2F, 0xF1, 0x0E, 0x3E, 0x20,
-    0x0F, 0x36, 0x0B, 0xE2, 0x03, 0x99, 0xF8, 0x60, 0x07, 0xF0, 0xA2, 0x0A, 0x48, 0xB9, 0x7C, 0xD3,
-    0x36, 0x32, 0xF0, 0xCD, 0x55, 0xE5, 0xFD, 0x37, 0x93, 0x90, 0x32, 0xAD, 0x4D, 0xFB, 0x16, 0xAD,
-    0x58, 0xBF, 0x6F, 0xDD, 0xC8, 0x11, 0xDE, 0xF7, 0x78, 0x12, 0x01, 0x33, 0x00, 0xAF, 0x38, 0x05,
-    0x38, 0xB8, 0x60, 0xDA, 0x38, 0x08, 0xD8, 0x5E, 0x73, 0x22, 0x73, 0x2A, 0xAE, 0xB4, 0x0A, 0xCB,
-    0x2E, 0x54, 0xA4, 0x49, 0x11, 0xF8, 0x02, 0xE8, 0x1F, 0xB0, 0x41, 0xDE, 0x5D, 0x99, 0x46, 0x8D,
-    0x7B, 0x17, 0x29, 0x7C, 0xCF, 0x85, 0xF2, 0x07, 0x28, 0x5E, 0x9E, 0x5D, 0xB8, 0x48, 0x61, 0x1A,
-    0x86, 0x91, 0x22, 0xC5, 0x11, 0x89, 0x05, 0xC3, 0xBE, 0x42, 0x0C, 0x42, 0xC7, 0x94, 0x44, 0x72,
-    0xF2, 0xCD, 0xCC, 0xF2, 0xFD, 0x90, 0xE5, 0x24, 0x08, 0x2C, 0x08, 0xDF, 0xC7, 0x47, 0x2E, 0x97,
-    0xBB, 0xB3, 0x33, 0xDF, 0xCC, 0xAE, 0x31, 0xF2, 0x77, 0x99, 0x5E, 0x00, 0x2D, 0x75, 0xC6, 0x78,
-    0xC4, 0x18, 0x10, 0x35, 0xC6, 0x84, 0x74, 0xE7, 0x8F, 0xC6, 0xC4, 0x3D, 0x37, 0x49, 0x5A, 0xC1,
-    0x46, 0xB0, 0xBE, 0x34, 0x9B, 0xA5, 0x49, 0x1D, 0x11, 0xE5, 0x2B, 0xD8, 0x44, 0x03, 0xEE, 0xB7,
-    0x51, 0xCB, 0x6F, 0x31, 0x86, 0x44, 0xC3, 0x8C, 0x7B, 0x23, 0x32, 0x53, 0x41, 0x93, 0x09, 0x4E,
-    0xF6, 0x70, 0xDF, 0x98, 0x48, 0x7A, 0x75, 0xD8, 0xEF, 0x30, 0xA2, 0x9F, 0x8B, 0x70, 0xB2, 0xFD,
-    0x09, 0x9E, 0x7A, 0xF5, 0x6D, 0xC6, 0xEA, 0x90, 0x07, 0x7D, 0x8A, 0x81, 0xFA, 0xF8, 0x40, 0x6A,
-    0x12, 0xF4, 0x59, 0x18, 0xEE, 0x3F, 0xC5, 0xF8, 0x8F, 0x09, 0xDF, 0x3D, 0xDE, 0x22, 0xBC, 0x19,
-    0x6D, 0x55, 0x26, 0xE9, 0x63, 0xAF, 0xC4, 0xF8, 0x13, 0xBF, 0x30, 0x59, 0xB3, 0x19, 0x14, 0xC6,
-    0xD6, 0x9F, 0x87, 0x8C, 0xB7, 0xC3, 0x1C, 0x78, 0x18, 0xA5, 0xC0, 0x2E, 0x82, 0x01, 0xEA, 0x36,
-    0x66, 0x6C, 0x12, 0x0C, 0xF3, 0xA4, 0xDE, 0xC4, 0x4C, 0x07, 0xFE, 0x60, 0x4C, 0xF5, 0x2D, 0x1E,
-    0x47, 0x75, 0xB8, 0x86, 0xB9, 0x9C, 0x0C, 0x0F, 0xD8, 0x4A, 0x34, 0x18, 0xA3, 0x18, 0x09, 0x62,
-    0xAA, 0x30, 0x62, 0xB4, 0x55, 0xF3, 0x24, 0xBC, 0x0A, 0x18, 0xFB, 0xA5, 0x59, 0xF9, 0x9B, 0x58,
-    0xDA, 0xE7, 0x76, 0x3D, 0x1B, 0xA1, 0x9B, 0xE0, 0xED, 0xCE, 0xA3, 0x93, 0xDD, 0x26, 0xC0, 0xE0,
-    0x7F, 0x16, 0x92, 0x71, 0xB6, 0x4E, 0xBA, 0xD1, 0xDE, 0x59, 0xB3, 0x96, 0xFE, 0xD6, 0xD6, 0xE1,
-    0xB3, 0x1E, 0xF0, 0xB2, 0x03, 0xD0, 0x02, 0x30, 0xD0, 0x10, 0x3D, 0x35, 0x61, 0x87, 0xC6, 0x0C,
-    0x1D, 0x20, 0x1E, 0x00, 0x21, 0x5D, 0xED, 0x3E, 0x82, 0xD1, 0xFB, 0x43, 0x1E, 0xA7, 0x7E, 0x88,
-    0x6D, 0xD4, 0xB1, 0xB9, 0x30, 0xA6, 0xB5, 0x6D, 0xC3, 0xF7, 0xFA, 0xE9, 0x85, 0x50, 0x18, 0xF3,
-    0x1F, 0x00, 0xBD, 0xBC, 0x03, 0xAF, 0x67, 0xF7, 0xCE, 0xB5, 0xC3, 0xFC, 0xDA, 0x25, 0x78, 0x6F,
-    0x7F, 0x73, 0xBB, 0xE4, 0xEC, 0x24, 0x2D, 0x2C, 0x0D, 0xBF, 0xC3, 0x2B, 0xB5, 0xA1, 0x7E, 0xB7,
-    0x32, 0xE0, 0xD4, 0xF0, 0x88, 0x17, 0xF0, 0x53, 0x3A, 0xDA, 0x51, 0x1F, 0x1A, 0x61, 0xD0, 0x07,
-    0x13, 0x86, 0x95, 0x07, 0xA4, 0xF7, 0x26, 0xFC, 0x21, 0x8F, 0x7D, 0x28, 0x18, 0x8C, 0x36, 0x19,
-    0xEC, 0x05, 0x20, 0x43, 0xB1, 0x6E, 0x48, 0x83, 0x1B, 0x59, 0xAF, 0xEC, 0x61, 0x49, 0x36, 0xD2,
-    0xCB, 0x27, 0xFE, 0x70, 0x6A, 0xB2, 0xA7, 0x44, 0x4F, 0x88, 0xAA, 0xEC, 0x25, 0x3B, 0x1C, 0xB5,
-    0x99, 0x10, 0x75, 0x19, 0x9D, 0x11, 0x9D, 0xD2, 0x90, 0xF1, 0xC7, 0xF3, 0x78, 0xC8, 0xD8, 0xE6,
-    0x58, 0x8B, 0x8C, 0x57, 0x85, 0xB9, 0xE5, 0xE5, 0x0D, 0x28, 0x6B, 0x4C, 0xDC, 0x5D, 0xCC, 0x89,
-    0xE3, 0xCC, 0x31, 0x29, 0x4F, 0x1C, 0x7B, 0x8E, 0x7D, 0xC7, 0xA1, 0xE3, 0xC8, 0x71, 0x7C, 0xCC,
-    0x0C, 0xDF, 0xC9, 0xCD, 0x45, 0x93, 0x99, 0x76, 0x2B, 0xDE, 0xE8, 0x23, 0x58, 0x5A, 0x60, 0xE1,
-    0x75, 0x73, 0x2C, 0x05, 0xEB, 0x05, 0x9E, 0x35, 0x8C, 0x6F, 0x5B, 0xC6, 0x7F, 0x75, 0xC0, 0xAF,
-    0x86, 0xE1, 0xFE, 0x90, 0xB3, 0xC1, 0xA8, 0x50, 0xBC, 0x7C, 0x62, 0x6F, 0xF4, 0xA9, 0xDF, 0x26,
-    0x5B, 0x68, 0xD3, 0x26, 0x8F, 0x3A, 0xB3, 0xFC, 0x74, 0x6F, 0x38, 0xA0, 0x21, 0xF7, 0xDB, 0xE0,
-    0x9F, 0xFC, 0xD4, 0x7F, 0xCB, 0xE8, 0x9D, 0x31, 0x4E, 0xD9, 0x1F, 0xDB, 0x89, 0xA0, 0x59, 0xC6,
-    0x4C, 0x30, 0x61, 0xF3, 0xBD, 0x92, 0x91, 0xC2, 0x75, 0x2B, 0xC7, 0xBD, 0x63, 0x1A, 0xB9, 0x10,
-    0x55, 0xF2, 0x1D, 0x4F, 0xA4, 0x21, 0x54, 0x8A, 0x2A, 0x44, 0xB8, 0x70, 0xEC, 0x38, 0x71, 0x9C,
-    0x31, 0x4F, 0xA9, 0xB4, 0xCF, 0xB7, 0xA1, 0x57, 0xF4, 0x18, 0xCE, 0xC6, 0xFD, 0x1C, 0x38, 0x8E,
-    0x95, 0xDB, 0x0D, 0xC2, 0x73, 0x42, 0xBC, 0xA2, 0xE7, 0xE4, 0xF4, 0x9A, 0x11, 0x66, 0xF5, 0xFB,
-    0xAF, 0x5C, 0x3A, 0x46, 0x3F, 0x8D, 0xA8, 0xAA, 0x72, 0xE2, 0x38, 0xD0, 0xB9, 0x18, 0x73, 0x6D,
-    0x79, 0x7E, 0xA5, 0xE3, 0xF6, 0xC2, 0x79, 0x42, 0x5D, 0x95, 0xB1, 0x66, 0x97, 0x06, 0x28, 0xAF,
-    0x47, 0xA9, 0xA5, 0x96, 0xF9, 0x0B, 0x52, 0xFE, 0x12, 0x91, 0xC3, 0xCF, 0x03, 0xBA, 0x5E, 0x73,
-    0x7B, 0x48, 0xC3, 0xC7, 0xDC, 0x0F, 0x98, 0xFB, 0x81, 0xC6, 0x88, 0x4C, 0x96, 0x58, 0x57, 0xE6,
-    0xC2, 0x83, 0xC3, 0x27, 0x67, 0x18, 0xB4, 0xA5, 0x32, 0xA9, 0x31, 0xA6, 0x08, 0xE3, 0xAB, 0x6D,
-    0x8D, 0xB8, 0xEC, 0x92, 0x9A, 0xD5, 0x27, 0x03, 0xC3, 0x31, 0x4D, 0x08, 0xE6, 0x5E, 0x84, 0xE9,
-    0x52, 0xCA, 0xEC, 0xD3, 0xD5, 0x53, 0x2B, 0xDF, 0x7D, 0x22, 0xDF, 0x9D, 0xD2, 0x0F, 0xC4, 0xFD,
-    0x18, 0x42, 0x50, 0xA4, 0x32, 0x29, 0x88, 0x4C, 0x52, 0x4C, 0x89, 0x1D, 0xA3, 0xC4, 0x70, 0x03,
-    0xA1, 0x3C, 0x6C, 0x93, 0xCA, 0xA3, 0x22, 0x6C, 0xE2, 0x0A, 0x6B, 0x16, 0xD6, 0x11, 0xBA, 0x2A,
-    0x22, 0x50, 0x70, 0x5C, 0x46, 0x75, 0x58, 0x87, 0x3F, 0x94, 0x71, 0x15, 0x36, 0xE1, 0x5F, 0x2B,
-    0xA1, 0x3F, 0xD7, 0x49, 0x19, 0xB4, 0xD1, 0xE3, 0x3A, 0x29, 0x1C, 0x59, 0x0D, 0x36, 0xA5, 0xDE,
-    0x91, 0xD7, 0xC1, 0xF9, 0x6C, 0x3A, 0xED, 0xB3, 0x2F, 0x40, 0x93, 0x3E, 0x9B, 0x74, 0x08, 0xFE,
-    0xC1, 0x32, 0x99, 0xC1, 0x9A, 0x1E, 0x84, 0xF9, 0x0E, 0x2C, 0x15, 0x3D, 0xFF, 0x1B, 0xDB, 0x1B,
-    0xDB, 0xF1, 0x1C, 0xF9, 0x7F, 0x24, 0x76, 0xB9, 0x56, 0xA4, 0x17, 0xFF, 0xE8, 0xFA, 0x0F, 0x30,
-    0x86, 0x64, 0x95, 0x1C, 0xF3, 0x60, 0xAE, 0x1D, 0x77, 0xCC, 0xE5, 0xC4, 0xF6, 0xCC, 0x05, 0x62,
-    0x5B, 0xD9, 0x53, 0xA6, 0x87, 0x58, 0x15, 0xE6, 0xEF, 0xE7, 0xFC, 0xCD, 0x07, 0x63, 0x23, 0xFC,
-    0xAD, 0x70, 0x81, 0x28, 0x55, 0x0E, 0x07, 0x65, 0xCC, 0x02, 0xCC, 0xAA, 0xE4, 0xB8, 0x76, 0x9C,
-    0x2B, 0xBF, 0x90, 0xA5, 0x59, 0xFF, 0xCE, 0x88, 0x23, 0xCE, 0xF1, 0xCA, 0x01, 0xE6, 0x2A, 0x49,
-    0x69, 0x15, 0x4D, 0x38, 0x6F, 0xB3, 0x7E, 0x8F, 0xD1, 0xD2, 0xEF, 0x25, 0x91, 0x9F, 0x91, 0x4B,
-    0xEA, 0xA1, 0x60, 0x4C, 0x39, 0x54, 0x4F, 0xD4, 0x0E, 0xE9, 0x56, 0x50, 0x94, 0x28, 0x61, 0x1D,
-    0xB9, 0x08, 0x7B, 0x79, 0x2A, 0xED, 0x23, 0x2A, 0xB3, 0xB1, 0x1F, 0x7F, 0x2C, 0x14, 0x1E, 0x73,
-    0xA1, 0x30, 0x78, 0x5C, 0x28, 0x6C, 0x9B, 0x73, 0x49, 0x74, 0x36, 0x9B, 0xDD, 0xD3, 0x44, 0xE4,
-    0x90, 0xEB, 0x97, 0x7D, 0x23, 0x29, 0x4D, 0x2A, 0x97, 0x81, 0x33, 0x36, 0x2F, 0x72, 0x46, 0xF7,
-    0xF1, 0x14, 0xB6, 0xF8, 0x44, 0x33, 0x01, 0x16, 0xA8, 0x10, 0x64, 0x0F, 0xDD, 0xA5, 0x3B, 0xD7,
-    0xC6, 0x0C, 0xAE, 0x68, 0xE5, 0xA5, 0x25, 0xB3, 0xF0, 0xFD, 0x66, 0x15, 0x7D, 0x79, 0x57, 0xB2,
-    0xC9, 0x98, 0xC1, 0x48, 0x6A, 0x22, 0x4B, 0x77, 0x0E, 0x8D, 0x26, 0x59, 0x9E, 0x4C, 0x27, 0xB9,
-    0x92, 0xC7, 0xB6, 0xA7, 0x31, 0xBD, 0xC3, 0xEF, 0xF2, 0x2B, 0x2C, 0xBB, 0x94, 0x03, 0x03, 0x9E,
-    0x6F, 0x1A, 0xF5, 0x8C, 0x09, 0x0B, 0x71, 0x9A, 0xD5, 0x8C, 0x18, 0xA9, 0x0F, 0xC7, 0xE1, 0xC5,
-    0x45, 0x0D, 0x03, 0xBC, 0x3A, 0x30, 0xFE, 0x5A, 0xAA, 0x1D, 0x24, 0x05, 0x95, 0xD7, 0x15, 0xDC,
-    0xC3, 0xF8, 0xBF, 0xC3, 0xD3, 0x27, 0x3D, 0xB7, 0xF9, 0x52, 0xDE, 0xDA, 0xC2, 0x18, 0x7D, 0xFA,
-    0x95, 0xF4, 0x93, 0x92, 0xF4, 0x8C, 0x97, 0xF9, 0x5B, 0xDD, 0xE2, 0xBB, 0xA1, 0x8C, 0xC1, 0x97,
-    0xF1, 0xC0, 0x38, 0x89, 0xB8, 0x4A, 0xF6, 0x0E, 0xEA, 0x7D, 0x4C, 0x55, 0xA4, 0x8B, 0x2A, 0xB6,
-    0x01, 0xFD, 0xBD, 0x56, 0x95, 0x13, 0x64, 0x4B, 0x68, 0x0A, 0x95, 0x1B, 0xAA, 0xC3, 0x90, 0x3A,
-    0xC9, 0xC9, 0x2F, 0x6B, 0x59, 0x1C, 0x3C, 0x68, 0xA5, 0x9B, 0x6D, 0x31, 0x8C, 0xF6, 0x36, 0x15,
-    0x8C, 0x04, 0x2D, 0xE3, 0x54, 0xC5, 0xBE, 0x11, 0x4C, 0xC7, 0x2F, 0x2E, 0x70, 0xA9, 0x68, 0x50,
-    0x6F, 0x16, 0x99, 0xCC, 0xE7, 0x57, 0xB2, 0x1A, 0x5C, 0x93, 0xA9, 0x86, 0x9A, 0xF0, 0xD5, 0x75,
-    0x55, 0x51, 0xB3, 0xC6, 0xB7, 0xB5, 0xE8, 0xD8, 0xB8, 0xE6, 0xA9, 0xE4, 0xCE, 0x73, 0x06, 0xAB,
-    0xAB, 0x8E, 0x1D, 0x23, 0xAE, 0x51, 0x5B, 0x69, 0x06, 0xAD, 0xF9, 0x87, 0xFB, 0xF8, 0x78, 0x55,
-    0xCE, 0xAF, 0x0A, 0x77, 0xC5, 0x25, 0x86, 0xAD, 0x27, 0x0F, 0x72, 0xF1, 0x09, 0x82, 0xFC, 0xB6,
-    0xE2, 0x23, 0x54, 0x59, 0x18, 0x05, 0xFE, 0x36, 0xA5, 0xA7, 0xF4, 0x23, 0xDB, 0x1A, 0x3F, 0x1E,
-    0x21, 0x66, 0xF3, 0x80, 0x5D, 0x7E, 0x0B, 0x22, 0x94, 0xA3, 0x28, 0x49, 0x28, 0x40, 0xD2, 0xCC,
-    0xC3, 0x1E, 0xC9, 0x30, 0x94, 0x2B, 0x24, 0xCD, 0x26, 0x44, 0x0C, 0xA7, 0x3C, 0x8F, 0x32, 0xEC,
-    0x7D, 0x8E, 0x31, 0xE2, 0x60, 0xC1, 0xAC, 0x58, 0xCE, 0xF9, 0x27, 0x64, 0x8A, 0x4E, 0x0D, 0xAB,
-    0xB8, 0xAB, 0x33, 0x93, 0xEA, 0x9A, 0x33, 0x4E, 0x36, 0xAF, 0x3C, 0xB3, 0x79, 0x95, 0x65, 0xE7,
-    0x57, 0x8B, 0xCA, 0xCB, 0xD9, 0x8D, 0x67, 0x90, 0xBA, 0xAB, 0x29, 0x99, 0x77, 0xAE, 0xB4, 0x5C,
-    0x28, 0xC5, 0xC2, 0x9D, 0xAC, 0xF7, 0x30, 0xC6, 0xDB, 0x94, 0x9E, 0xE1, 0x55, 0x8F, 0xBE, 0x46,
-    0x57, 0x98, 0xE8, 0x12, 0x7E, 0x2D, 0xF7, 0x1F, 0x02, 0xA7, 0x3C, 0x67, 0xF6, 0x18, 0x76, 0x10,
-    0x3A, 0xEB, 0xA5, 0x0A, 0xEB, 0x34, 0x27, 0x8E, 0x8B, 0xFF, 0x71, 0xC8, 0xA3, 0xFA, 0x4C, 0x22,
-    0xF4, 0x96, 0x2C, 0xCE, 0x10, 0x12, 0xFB, 0x4D, 0x84, 0xC9, 0x7A, 0x64, 0xA5, 0xC4, 0xA1, 0x3D,
-    0x88, 0xCB, 0xF1, 0x00, 0xB5, 0x8B, 0x1F, 0x77, 0xAC, 0x32, 0xDF, 0xB4, 0x70, 0x5C, 0x6B, 0x6A,
-    0x09, 0xC8, 0x6D, 0x0D, 0x4B, 0x0D, 0xF2, 0xA9, 0x0B, 0x75, 0xDE, 0x3A, 0xEC, 0x32, 0x7A, 0x92,
-    0x98, 0x3C, 0x71, 0x52, 0x4F, 0x62, 0x72, 0x0A, 0xD5, 0xF0, 0x69, 0xD8, 0x1F, 0x45, 0x23, 0x90,
-    0x72, 0x22, 0x10, 0x4F, 0x45, 0x1A, 0x45, 0x1B, 0x95, 0x30, 0x2D, 0x64, 0x24, 0xD3, 0x14, 0x07,
-    0x34, 0x3B, 0xD0, 0xD5, 0x13, 0x09, 0x03, 0x2E, 0x3F, 0xD5, 0x6B, 0x7E, 0xAB, 0x95, 0x1E, 0x6A,
-    0xE9, 0xAD, 0x12, 0x94, 0x0A, 0x57, 0xF4, 0x45, 0xBF, 0x78, 0x4E, 0x82, 0xDF, 0x8B, 0x18, 0xFF,
-    0x5D, 0x29, 0x41, 0xC5, 0xB1, 0xF7, 0xE8, 0x44, 0x36, 0x3D, 0xE8, 0x34, 0x11, 0xE4, 0x2F, 0x22,
-    0xB1, 0xA2, 0xF0, 0xC4, 0x77, 0xDF, 0x36, 0xEB, 0xF0, 0x98, 0x6F, 0x1B, 0x16, 0x40, 0x6E, 0x9F,
-    0x74, 0x8C, 0x99, 0xA0, 0x6D, 0x04, 0x6B, 0x46, 0xD4, 0x76, 0x98, 0xE4, 0xBB, 0x88, 0x36, 0x03,
-    0xB0, 0xF5, 0x9A, 0xAC, 0xE6, 0xB7, 0xB2, 0x3A, 0xE9, 0x19, 0xB9, 0xB7, 0x0C, 0xC9, 0xFF, 0x11,
-    0x30, 0xA0, 0xB3, 0x53, 0x69, 0x2D, 0xC9, 0x45, 0x30, 0x16, 0x9C, 0xCA, 0x56, 0xCC, 0xF8, 0x27,
-    0x8B, 0xD1, 0x2A, 0x26, 0x1A, 0x88, 0x99, 0xAB, 0xB0, 0x75, 0x56, 0x5A, 0x26, 0x4C, 0xC8, 0x29,
-    0xA9, 0x5B, 0x2D, 0xCB, 0x3E, 0xE6, 0x0F, 0x19, 0x47, 0x64, 0xD8, 0x27, 0xEC, 0x1D, 0x61, 0x17,
-    0x37, 0x5A, 0xB5, 0x8F, 0x72, 0x37, 0x27, 0x44, 0x9F, 0x2F, 0x8E, 0x55, 0x71, 0xA6, 0xD8, 0xA0,
-    0xA3, 0x1B, 0x74, 0xE7, 0x5C, 0x13, 0xA8, 0xFC, 0x0E, 0xBD, 0xE1, 0xC0, 0xE3, 0x58, 0x86, 0xE3,
-    0x70, 0xC4, 0x4A, 0x4D, 0xD4, 0x98, 0x08, 0x2E, 0x18, 0x77, 0xB2, 0xDD, 0xC2, 0x25, 0x17, 0x67,
-    0x78, 0xCE, 0x01, 0x0D, 0xCF, 0x62, 0xC7, 0xF4, 0xE7, 0xFE, 0x7F, 0x99, 0xAD, 0xBE, 0x2E, 0x8B,
-    0xE8, 0xCB, 0x5C, 0x3D, 0xD2, 0x6D, 0xCD, 0x6B, 0x76, 0xE3, 0x17, 0x6E, 0x8B, 0x1C, 0x2E, 0x21,
-    0xE4, 0xF5, 0xE6, 0x6C, 0x66, 0x57, 0x2B, 0xE5, 0x8D, 0x5D, 0xA2, 0xE7, 0x29, 0x9B, 0x4B, 0x0C,
-    0x30, 0x4A, 0xF9, 0x58, 0x29, 0x63, 0x1F, 0x35, 0xCB, 0x35, 0xE3, 0x86, 0xC3, 0x12, 0xE2, 0xCE,
-    0xA7, 0x70, 0x86, 0xA3, 0xDD, 0x5E, 0xBE, 0xDB, 0x4B, 0xDA, 0xEB, 0xE5, 0x65, 0xDD, 0xAA, 0xEF,
-    0xB3, 0xA2, 0xA5, 0xE7, 0x5D, 0x85, 0x37, 0x9B, 0xCE, 0xB3, 0xD9, 0x7A, 0xE9, 0x44, 0x0C, 0xA2,
-    0x3D, 0x84, 0xF4, 0xAC, 0xB9, 0x85, 0xC0, 0x13, 0x27, 0xE9, 0x97, 0x5C, 0xA5, 0xBD, 0xC0, 0x55,
-    0x2E, 0x44, 0xD7, 0xA6, 0x59, 0x38, 0x98, 0xF6, 0xA0, 0x8E, 0x17, 0xC2, 0x09, 0x79, 0xAF, 0x7C,
-    0x76, 0x3A, 0xAC, 0xEE, 0x95, 0x63, 0xC1, 0xA9, 0x56, 0x22, 0x7E, 0x73, 0xCE, 0x55, 0xE2, 0x42,
-    0xF6, 0x28, 0x09, 0x6F, 0x46, 0x58, 0xBA, 0x82, 0x4E, 0x74, 0x0B, 0x9A, 0x08, 0x4F, 0x39, 0xDA,
-    0xEB, 0x77, 0x52, 0xA9, 0x3A, 0x5C, 0x42, 0x9A, 0xD3, 0x2F, 0x50, 0x8F, 0x0C, 0x33, 0x4C, 0xB0,
-    0x88, 0xA5, 0xE5, 0x87, 0x22, 0x9A, 0xE4, 0x20, 0x68, 0x6E, 0x01, 0x0A, 0x95, 0x3C, 0x25, 0xE3,
-    0x52, 0xCE, 0xDA, 0x72, 0x79, 0xA2, 0xC7, 0x28, 0x6C, 0xE7, 0x52, 0x83, 0xB4, 0x94, 0x5A, 0x80,
-    0x7D, 0x3B, 0xA6, 0x19, 0xBF, 0x00, 0x5F, 0xBB, 0x3C, 0x3F, 0x46, 0x99, 0x53, 0xAB, 0xA4, 0xF1,
-    0x11, 0xAB, 0x9A, 0x87, 0x9A, 0xBE, 0x74, 0xC3, 0xCE, 0x7D, 0xB6, 0xFA, 0x90, 0xCC, 0x22, 0x5E,
-    0xC6, 0xB6, 0x1E, 0x55, 0xEB, 0xF9, 0x77, 0xEB, 0xFB, 0xA8, 0xE0, 0xDF, 0xD2, 0x31, 0xCA, 0xF3,
-    0x4D, 0x3A, 0x38, 0x45, 0xF4, 0x7C, 0xD6, 0x07, 0xD5, 0xED, 0xA4, 0xDA, 0xEC, 0xFC, 0x72, 0x33,
-    0x2B, 0xA3, 0xDE, 0x2F, 0x13, 0x99, 0xC0, 0x91, 0x25, 0x75, 0x3D, 0xCC, 0xF3, 0x4F, 0x56, 0xFC,
-    0xE7, 0xD0, 0x3F, 0x7A, 0x60, 0x98, 0xCA, 0x4D, 0xA5, 0xCF, 0x35, 0x9B, 0x8E, 0xB9, 0xFF, 0x5D,
-    0x5C, 0xCE, 0x0D, 0x1B, 0x3B, 0xF8, 0x7B, 0x6F, 0xFB, 0x8D, 0xEB, 0xF4, 0x66, 0x27, 0x5D, 0xCD,
-    0xE2, 0x1F, 0x06, 0xD9, 0xAF, 0x4B, 0x3B, 0x07, 0x23, 0xDB, 0x24, 0x29, 0xEF, 0x58, 0xFE, 0x6F,
-    0xDE, 0xA7, 0xD7, 0xF9, 0xD2, 0x53, 0x77, 0x10, 0x50, 0xB0, 0x71, 0x53, 0x73, 0x93, 0xC8, 0x1D,
-    0x79, 0x59, 0x39, 0x39, 0x98, 0x9F, 0xBC, 0x48, 0x27, 0x81, 0x26, 0x8B, 0x62, 0x2C, 0x50, 0xA4,
-    0xAC, 0xC8, 0xBA, 0x71, 0x99, 0xB8, 0x03, 0x13, 0x68, 0x7F, 0xD5, 0x98, 0x50, 0x75, 0x31, 0x46,
-    0xFC, 0x1D, 0xE3, 0x8F, 0x9A, 0x2D, 0xC5, 0x9F, 0xD8, 0x39, 0x62, 0x16, 0x12, 0xDC, 0x28, 0x3F,
-    0x62, 0x7C, 0x8A, 0x8A, 0xF1, 0x05, 0xD1, 0xBC, 0xCD, 0xBA, 0x98, 0xD5, 0xEA, 0x07, 0xA9, 0x9C,
-    0x52, 0x3E, 0x30, 0xA6, 0xFB, 0xAC, 0xF0, 0x7C, 0x10, 0xC2, 0x32, 0xC7, 0x5B, 0x38, 0xC6, 0x40,
-    0xCE, 0x3D, 0xA0, 0x33, 0x40, 0x1E, 0x18, 0xFD, 0x85, 0x35, 0x4B, 0x9D, 0x8E, 0x44, 0x5D, 0xC7,
-    0x9E, 0x45, 0x1E, 0xB6, 0x57, 0x52, 0x79, 0xEE, 0x8A, 0x24, 0xAD, 0x63, 0x36, 0x3D, 0xF5, 0xC0,
-    0x5B, 0x13, 0x3D, 0x21, 0x38, 0x74, 0xFC, 0xC0, 0x1D, 0x7F, 0x88, 0xF8, 0xBA, 0x63, 0x36, 0x77,
-    0x4A, 0x23, 0x5A, 0xA2, 0xC1, 0x88, 0x78, 0x50, 0xB1, 0x2D, 0xF4, 0xB8, 0x64, 0xAF, 0x52, 0xF6,
-    0x99, 0xBD, 0xE2, 0xAE, 0xC7, 0x1C, 0xFD, 0xAD, 0xE1, 0x33, 0x31, 0x6C, 0xD8, 0x06, 0x3E, 0x15,
-    0x43, 0xBA, 0xA2, 0xE3, 0x82, 0x17, 0xD1, 0x5E, 0x95, 0xA1, 0xA6, 0xBF, 0x9C, 0x9E, 0x8C, 0x95,
-    0xF9, 0xA2, 0x4C, 0x4B, 0x32, 0x8D, 0x90, 0x9F, 0x44, 0xF4, 0xDA, 0xA6, 0x46, 0x53, 0x74, 0xAA,
-    0x01, 0xA0, 0x4D, 0x33, 0xC7, 0x81, 0xAB, 0xF1, 0xCC, 0x5A, 0x3A, 0x16, 0x73, 0xFF, 0x0F, 0xAF,
-    0xD9, 0x13, 0x97, 0x96, 0xA4, 0x4E, 0x88, 0x48, 0xED, 0x69, 0x75, 0xDE, 0xA2, 0xA0, 0x52, 0xD0,
-    0x35, 0xC9, 0x3F, 0x32, 0x9E, 0x3F, 0xB6, 0xE2, 0x01, 0x36, 0xB5, 0x28, 0xE1, 0xB0, 0x35, 0x2C,
-    0x38, 0x8B, 0x20, 0x27, 0x96, 0x71, 0x2B, 0x5C, 0x21, 0xBE, 0xC1, 0x76, 0xE4, 0x5A, 0x19, 0x49,
-    0xB5, 0x36, 0x57, 0xEE, 0x2A, 0x4B, 0xB5, 0xF9, 0xBF, 0x32, 0xBE, 0xFF, 0x4A, 0xE7, 0xDE, 0x08,
-    0x0E, 0x7A, 0xA6, 0x9A, 0x0B, 0x16, 0xB2, 0xB7, 0x80, 0xBB, 0x40, 0x9E, 0x2A, 0x2D, 0x43, 0x97,
-    0x90, 0xEF, 0x4C, 0x19, 0x9F, 0xEF, 0xB9, 0x7C, 0x93, 0x2F, 0x36, 0x10, 0xB2, 0xD9, 0x85, 0x9B,
-    0xDC, 0xA0, 0x57, 0xDB, 0x63, 0xE5, 0xA4, 0xF8, 0x15, 0xBD, 0xBE, 0x37, 0x26, 0x9A, 0x65, 0x5C,
-    0x6E, 0xB3, 0x8C, 0x30, 0x64, 0x98, 0x2B, 0xC9, 0xCF, 0xE4, 0x40, 0x9F, 0x89, 0x7A, 0xC5, 0x6E,
-    0x13, 0x31, 0x66, 0xD0, 0x03, 0xE2, 0xA3, 0x4A, 0x0A, 0x31, 0x8F, 0x88, 0x92, 0xF0, 0x09, 0x17,
-    0x5B, 0x49, 0xF8, 0x18, 0x9B, 0x8E, 0x36, 0x09, 0x1F, 0x61, 0x98, 0x4D, 0x12, 0x3E, 0x04, 0xD5,
-    0x49, 0xF8, 0x3D, 0x95, 0x24, 0x54, 0x31, 0x15, 0x4A, 0x39, 0xBC, 0x67, 0x5E, 0xA6, 0x8B, 0x85,
-    0x56, 0xF4, 0x34, 0x56, 0x27, 0xD6, 0x84, 0x3A, 0xFA, 0xFC, 0xC4, 0xED, 0x0F, 0x32, 0x4E, 0xB6,
-    0xBA, 0xBE, 0x74, 0x31, 0x99, 0xDF, 0x7C, 0x8A, 0x76, 0xDD, 0xE6, 0x32, 0x64, 0x64, 0xC5, 0x02,
-    0x95, 0x9A, 0xC1, 0x8E, 0x06, 0xC4, 0x00, 0x22, 0xD4, 0xA1, 0xA8, 0x46, 0xF2, 0x39, 0xE0, 0x67,
-    0xC0, 0x10, 0x93, 0x6E, 0x2C, 0x2D, 0xAF, 0x9A, 0x1D, 0x8D, 0x6D, 0xEC, 0x9B, 0x3D, 0x6D, 0x87,
-    0xF9, 0x79, 0x0C, 0xD3, 0x39, 0xC8, 0x4F, 0x88, 0x8B, 0x3D, 0xB5, 0xBA, 0x4A, 0xAB, 0x1D, 0xA4,
-    0xE7, 0x47, 0x65, 0xEE, 0xFD, 0x5C, 0xF6, 0x43, 0xA2, 0x2F, 0x94, 0xB3, 0x97, 0xE6, 0x9C, 0x74,
-    0xB1, 0xBB, 0x3B, 0xE5, 0xE9, 0xA4, 0x6B, 0x5A, 0x82, 0x89, 0xBA, 0x65, 0xED, 0x68, 0xA8, 0x73,
-    0x20, 0x56, 0x93, 0x26, 0xF1, 0x60, 0x26, 0x28, 0x23, 0xCB, 0xBD, 0x3C, 0x1C, 0xBB, 0xCA, 0x8D,
-    0x40, 0x24, 0x49, 0x69, 0x63, 0x59, 0xFA, 0xE5, 0x0C, 0x6E, 0x01, 0x57, 0xB0, 0x3B, 0xCF, 0xFF,
-    0x0D, 0x63, 0x60, 0x00, 0x02, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x25, 0x7E, 0x00, 0x00, 0xCD,
-    0x94, 0x31, 0x6E, 0xDB, 0x40, 0x10, 0x45, 0x87, 0x36, 0x22, 0x15, 0x2C, 0xD4, 0xC4, 0x85, 0x93,
-    0x42, 0x07, 0x48, 0xC1, 0x23, 0x2C, 0x8F, 0xA0, 0x42, 0x4A, 0x9D, 0x3A, 0x37, 0x70, 0xB5, 0xF2,
-    0x0D, 0x5C, 0x24, 0xBD, 0x11, 0xB8, 0x62, 0xA3, 0x23, 0x48, 0x47, 0xE0, 0x11, 0xE4, 0x22, 0x8D,
-    0x1B, 0xDB, 0x00, 0x91, 0x08, 0x36, 0xC5, 0x9F, 0xFF, 0x77, 0x97, 0x32, 0xED, 0x36, 0x30, 0xEC,
-    0x66, 0xFF, 0x03, 0xC9, 0x99, 0x9D, 0x19, 0xFE, 0x5D, 0xB3, 0xEF, 0x57, 0x36, 0xAA, 0x4A, 0xCB,
-    0x01, 0xF3, 0xD8, 0x99, 0x43, 0x97, 0x01, 0x77, 0xB6, 0xC6, 0xFE, 0x58, 0x0A, 0xB4, 0x63, 0x60,
-    0x6B, 0xC4, 0x1C, 0xA5, 0x19, 0x31, 0x87, 0x51, 0xEB, 0xA0, 0x19, 0x7E, 0xCF, 0x26, 0x58, 0x94,
-    0x53, 0xA0, 0x59, 0x03, 0x4B, 0x0F, 0xFC, 0xC5, 0x40, 0xBF, 0xE0, 0xE1, 0xD7, 0x0A, 0xD5, 0xB2,
-    0xFF, 0xFE, 0xCD, 0x94, 0x7D, 0x66, 0x17, 0xEA, 0xB2, 0x08, 0x3D, 0xBA, 0x56, 0x1D, 0x72, 0x65,
-    0x7F, 0x45, 0x1B, 0xBA, 0xDB, 0xAA, 0xB7, 0x18, 0x11, 0xFB, 0x3A, 0x99, 0xAB, 0x2B, 0xD7, 0xFA,
-    0xC1, 0xCA, 0x7E, 0x2E, 0x15, 0x55, 0xDB, 0xAB, 0xAE, 0xAC, 0xF6, 0xD3, 0x95, 0xAA, 0x25, 0xBF,
-    0xA8, 0xD6, 0x85, 0x6A, 0xB5, 0x6E, 0x0F, 0xDF, 0xAB, 0x5A, 0xD7, 0xBE, 0x65, 0xB5, 0xF2, 0xD0,
-    0xA9, 0xF5, 0x2E, 0xC2, 0x26, 0xF9, 0xE8, 0x9E, 0x45, 0x46, 0x27, 0x89, 0xA2, 0x97, 0xAE, 0x19,
-    0x94, 0xDC, 0xE4, 0xCB, 0x83, 0x9F, 0x06, 0x7F, 0xAA, 0xF7, 0xD4, 0xC1, 0x55, 0xE7, 0xA8, 0x93,
-    0x9F, 0x9E, 0x51, 0xF2, 0xD6, 0xB9, 0xF2, 0x85, 0xD8, 0xEC, 0xDD, 0x52, 0x9A, 0x10, 0xCF, 0x41,
-    0x3F, 0xA1, 0x3A, 0x4D, 0xA8, 0x21, 0xA5, 0xB3, 0xA6, 0x88, 0x78, 0xDA, 0x9E, 0x26, 0x24, 0x8A,
-    0x13, 0x3A, 0xE4, 0xA3, 0xF4, 0x13, 0x42, 0x9D, 0x26, 0xB4, 0x09, 0x73, 0xF9, 0x83, 0x17, 0xD4,
-    0x9F, 0xBE, 0x61, 0xEC, 0x3B, 0xA5, 0xAC, 0xFA, 0xA1, 0x7F, 0xCF, 0xDA, 0x2F, 0xCC, 0x8E, 0x58,
-    0x7E, 0x1B, 0xDC, 0xC4, 0x69, 0xD9, 0x04, 0x8F, 0x92, 0x02, 0x24, 0x93, 0xDF, 0xC6, 0x92, 0xDD,
-    0x93, 0xFC, 0x9C, 0x51, 0x0A, 0x4E, 0x90, 0x82, 0x67, 0xB2, 0xC2, 0xCD, 0xE5, 0xF0, 0xCB, 0xFF,
-    0x94, 0x32, 0x4A, 0xFD, 0x8D, 0x72, 0x1C, 0x77, 0x38, 0x8A, 0x62, 0x49, 0x8A, 0x78, 0x87, 0x64,
-    0x73, 0xAD, 0xA3, 0x6A, 0x16, 0x9C, 0xCD, 0x1F, 0xDC, 0x05, 0x65, 0x4C, 0x7C, 0x3F, 0x21, 0xEC,
-    0x04, 0x53, 0xDC, 0xAA, 0x53, 0x06, 0xEE, 0xCC, 0x07, 0x70, 0xE1, 0x70, 0xEB, 0x49, 0x82, 0xCF,
-    0x68, 0xCC, 0xED, 0x17, 0x0A, 0x96, 0x61, 0x50, 0x32, 0xB8, 0x1B, 0x0B, 0x1C, 0xB0, 0xCF, 0x03,
-    0xEC, 0xBF, 0xB6, 0xA3, 0x75, 0x57, 0x95, 0xBE, 0xB1, 0x8F, 0x21, 0xCA, 0x2B, 0xBB, 0xC0, 0xE9,
-    0xD2, 0x8E, 0xD0, 0x44, 0x60, 0xF8, 0x32, 0x00, 0x13, 0x36, 0x71, 0x0B, 0xCF, 0x1A, 0x02, 0x30,
-    0x6D, 0xDA, 0xDD, 0xF7, 0x90, 0xF7, 0x30, 0x8E, 0x70, 0xA6, 0x27, 0x45, 0x97, 0x95, 0xBE, 0x63,
-    0x57, 0xD3, 0x78, 0xD7, 0xB7, 0x21, 0xAB, 0x2E, 0x1D, 0xA5, 0x58, 0xEA, 0x29, 0x7D, 0xCF, 0xAD,
-    0x4F, 0x34, 0x81, 0x0F, 0x33, 0xFB, 0x07, 0x4D, 0x8F, 0xBD, 0x0D, 0xC2, 0x30, 0x14, 0x84, 0x2F,
-    0x76, 0x91, 0x82, 0x82, 0x11, 0xCC, 0x06, 0x1E, 0x01, 0x31, 0x07, 0x8B, 0xD0, 0x25, 0xE3, 0x20,
-    0xB1, 0x02, 0x22, 0xD9, 0x84, 0xF4, 0x34, 0x94, 0x2E, 0x12, 0x1F, 0xF7, 0x6C, 0x47, 0xC2, 0xF2,
-    0xCF, 0xE7, 0xA7, 0xEF, 0x9D, 0x6C, 0xE0, 0x6F, 0xDC, 0xDA, 0xD9, 0xE5, 0x06, 0x3D, 0xC7, 0x0A,
-    0x81, 0x4B, 0x85, 0x81, 0xA9, 0x2A, 0x64, 0x6E, 0xCA, 0xA7, 0x4A, 0x61, 0x41, 0x2C, 0xD2, 0x00,
-    0xF8, 0x54, 0x94, 0x96, 0xD4, 0xF3, 0x72, 0x87, 0x49, 0x81, 0xEF, 0x0C, 0x4B, 0x1A, 0x48, 0x42,
-    0x49, 0x4A, 0x51, 0x8C, 0x66, 0x2F, 0x58, 0x75, 0x1B, 0x83, 0x60, 0xF1, 0x5A, 0x67, 0xC1, 0x78,
-    0x24, 0x53, 0x34, 0x57, 0x0D, 0xDF, 0x03, 0xB9, 0x59, 0xC3, 0xEC, 0xE4, 0x7A, 0xAB, 0x62, 0x2A,
-    0xB0, 0x02, 0x91, 0xF9, 0x21, 0x05, 0x90, 0x64, 0x0A, 0xE0, 0x0A, 0xD8, 0x7B, 0xA6, 0xCD, 0x9B,
-    0x22, 0x29, 0x75, 0xA6, 0x48, 0x12, 0xCC, 0x06, 0x6E, 0x75, 0xAC, 0xFF, 0x7A, 0x5D, 0xD7, 0x0A,
-    0xB1, 0x2A, 0x96, 0x34, 0x57, 0xD8, 0x15, 0xE0, 0xB9, 0xC3, 0xC9, 0xB6, 0x1F,
+static const uint8_t notosans_18_boldBitmaps[44553] = {
+    0xD5, 0x5A, 0xBF, 0x93, 0xE4, 0xC6, 0x75, 0x6E, 0xCC, 0x78, 0x77, 0xAA, 0x84, 0xB2, 0x91, 0x78,
+    0xAB, 0x6C, 0x6E, 0x80, 0xC4, 0x11, 0x5D, 0x2E, 0xFC, 0x05, 0x2E, 0xC0, 0x76, 0xA0, 0xC0, 0x81,
+    0x36, 0xB8, 0x61, 0x60, 0x05, 0x54, 0x6C, 0x07, 0xF7, 0x17, 0xB8, 0x30, 0x54, 0xAA, 0xE4, 0x54,
+    0x25, 0xE7, 0x57, 0xAE, 0x0B, 0xAC, 0x65, 0x70, 0xA9, 0x23, 0x37, 0x24, 0x06, 0x0E, 0x14, 0x18,
+    0xF4, 0x95, 0x4B, 0x01, 0x03, 0x0E, 0x8B, 0x47, 0xCB, 0x45, 0x06, 0x04, 0x49, 0x90, 0x8B, 0xDB,
+    0x03, 0xD0, 0xFE, 0xBE, 0xEF, 0x61, 0x30, 0x33, 0x7B, 0x4B, 0xF2, 0xEE, 0x24, 0x92, 0xD2, 0xEE,
+    0xE0, 0xBD, 0x99, 0x41, 0xA3, 0xFB, 0xF5, 0xFB, 0xFD, 0x5E, 0x8F, 0x6F, 0x03, 0xFE, 0x7D, 0xEB,
+    0x1B, 0xFB, 0x2F, 0xE7, 0xFF, 0xBC, 0xC9, 0xB7, 0xF6, 0x7F, 0x56, 0x38, 0xFC, 0x9D, 0x6F, 0x7C,
+    0x13, 0x34, 0xBA, 0xDC, 0x9E, 0x14, 0x2E, 0x69, 0x5D, 0xBE, 0x75, 0xBE, 0x8A, 0xC2, 0x66, 0x19,
+    0xDC, 0x6A, 0x74, 0x71, 0xEF, 0x92, 0xDE, 0xA5, 0x9D, 0xCB, 0x70, 0xA7, 0xD1, 0x6B, 0xEB, 0x4A,
+    0xBC, 0xEA, 0xE3, 0x97, 0xBE, 0xB4, 0x01, 0x59, 0xE3, 0xD2, 0x96, 0x4F, 0xE1, 0x85, 0x19, 0x30,
+    0x4F, 0x14, 0x0A, 0x17, 0x2A, 0x3E, 0x99, 0x36, 0xE5, 0x46, 0xB8, 0xDD, 0xDF, 0x5D, 0xD8, 0x5D,
+    0xBC, 0x7C, 0xBD, 0x9F, 0x65, 0x9E, 0x6B, 0x7E, 0xCD, 0x5F, 0x62, 0x0C, 0x46, 0xEA, 0x91, 0x99,
+    0x4E, 0x23, 0x92, 0x37, 0x2B, 0x77, 0x72, 0x27, 0x19, 0xD2, 0x3E, 0xED, 0xB2, 0x96, 0xBB, 0x2D,
+    0x2B, 0x5F, 0xF9, 0x62, 0xBD, 0xBE, 0x08, 0xA1, 0x99, 0x5F, 0xF8, 0x78, 0x63, 0xE7, 0xFA, 0x5B,
+    0x85, 0xAD, 0x73, 0x65, 0x18, 0x41, 0x71, 0xE0, 0xCC, 0x21, 0xD4, 0x71, 0xF8, 0x30, 0x34, 0x49,
+    0x70, 0xBE, 0x4D, 0x46, 0x97, 0xF7, 0x69, 0xEF, 0xB2, 0x3E, 0xC3, 0x62, 0x43, 0x8E, 0x0D, 0x0E,
+    0x79, 0xE7, 0x92, 0xF1, 0x6B, 0x00, 0xC7, 0xE9, 0x09, 0x3D, 0x9B, 0x0C, 0x98, 0x05, 0xF3, 0x95,
+    0xDD, 0x2A, 0xFC, 0x4F, 0x68, 0xB8, 0xC6, 0xD6, 0x01, 0x54, 0x58, 0x37, 0x38, 0x17, 0x87, 0x0E,
+    0x74, 0x9C, 0x91, 0x18, 0x6C, 0x73, 0x81, 0x7B, 0x31, 0xAE, 0x3C, 0x6C, 0x41, 0xD1, 0x36, 0xC6,
+    0x95, 0xE1, 0xCA, 0xFB, 0xB0, 0x4D, 0xB7, 0xF8, 0x5C, 0x90, 0xDE, 0xDF, 0xC5, 0xC5, 0xBF, 0x2C,
+    0x70, 0xC1, 0x30, 0xB8, 0x94, 0x9B, 0x2F, 0xB9, 0xF9, 0x3C, 0xBC, 0x89, 0xCD, 0x37, 0x2E, 0x34,
+    0xAB, 0x02, 0x1C, 0x20, 0x51, 0x02, 0x0D, 0x80, 0x27, 0xE0, 0xB3, 0x0B, 0xD0, 0x0E, 0xCE, 0x6D,
+    0x1C, 0x1E, 0xE4, 0xCD, 0xDE, 0x81, 0x7D, 0xB8, 0xB9, 0xE4, 0xF7, 0x09, 0xBF, 0x02, 0x0B, 0x30,
+    0xF4, 0xF8, 0x2B, 0x4C, 0xDF, 0xFB, 0x5B, 0x80, 0xD1, 0xE2, 0xB5, 0x71, 0x08, 0x82, 0x64, 0x54,
+    0x1C, 0xBC, 0x4D, 0xAE, 0x7F, 0x08, 0x32, 0x36, 0x9A, 0xC7, 0x16, 0x3F, 0x20, 0xA3, 0x36, 0x0A,
+    0x4A, 0x50, 0x0F, 0x20, 0x21, 0x76, 0x04, 0xF8, 0xEE, 0xEC, 0xAE, 0x36, 0x18, 0x44, 0x78, 0xB7,
+    0xA3, 0x46, 0xA0, 0xEC, 0x2F, 0x70, 0xA3, 0xFB, 0x8F, 0x8B, 0x73, 0x18, 0x0B, 0xD7, 0x20, 0xA8,
+    0x3C, 0xD7, 0x3D, 0xA7, 0x58, 0xA0, 0x49, 0x46, 0x0D, 0xA6, 0xC7, 0x9E, 0x38, 0xCD, 0x52, 0x30,
+    0x11, 0xCC, 0x04, 0x73, 0x9B, 0xDE, 0x38, 0x41, 0xB8, 0xEA, 0x09, 0x93, 0x8E, 0x30, 0x6B, 0x44,
+    0x4C, 0x2D, 0x3E, 0x6F, 0xC4, 0x60, 0xF2, 0x6C, 0x35, 0x10, 0x26, 0x1D, 0x21, 0x34, 0x1B, 0x90,
+    0xFB, 0x0C, 0xD5, 0xB3, 0xF0, 0x6C, 0xBD, 0x0E, 0x9F, 0x17, 0x6E, 0x27, 0xA5, 0x5B, 0xE1, 0x8A,
+    0x03, 0xE3, 0x63, 0x90, 0x08, 0x0C, 0xA4, 0xB5, 0xBF, 0x05, 0x90, 0xD0, 0x94, 0xFB, 0xA4, 0xAC,
+    0x2B, 0x82, 0xED, 0xEA, 0x83, 0xD7, 0xC5, 0x5A, 0x29, 0xE0, 0x0D, 0x46, 0x19, 0xB7, 0xBA, 0xBF,
+    0x20, 0x1B, 0xF3, 0x9F, 0x9D, 0x87, 0x26, 0x37, 0xED, 0x00, 0x7F, 0x73, 0xCE, 0x12, 0x1F, 0x72,
+    0x4B, 0x6E, 0x05, 0x53, 0x81, 0x1B, 0x0D, 0xE7, 0x6F, 0xB8, 0x39, 0x6C, 0x72, 0xFC, 0x97, 0x1F,
+    0x89, 0x7B, 0x2B, 0xD8, 0x3B, 0xEC, 0x62, 0x47, 0x4B, 0xDA, 0x45, 0x17, 0xF0, 0x2E, 0x65, 0x28,
+    0xB2, 0x2F, 0x38, 0xE9, 0xD3, 0x80, 0x35, 0xA8, 0x09, 0x39, 0x94, 0x70, 0xC8, 0x87, 0xC9, 0x84,
+    0x02, 0x8C, 0x29, 0x36, 0x00, 0x63, 0x8A, 0x43, 0xCA, 0x1B, 0x50, 0xA5, 0x6C, 0x88, 0xC3, 0xDB,
+    0xBE, 0xA7, 0x1D, 0x75, 0xB4, 0xA3, 0x86, 0xAA, 0xB5, 0xC1, 0x22, 0xDC, 0x3B, 0x7C, 0x1C, 0xD9,
+    0x38, 0x50, 0xAE, 0xE3, 0x31, 0xE0, 0xED, 0x4C, 0x7B, 0x6B, 0x0F, 0x95, 0x39, 0xA2, 0x86, 0x2E,
+    0xA9, 0xCC, 0xAB, 0xE0, 0x26, 0x5D, 0x4D, 0xBF, 0x64, 0xEC, 0xC2, 0xC6, 0x56, 0xBB, 0x2D, 0xCD,
+    0x63, 0x27, 0x76, 0x4D, 0x4A, 0x3F, 0x1B, 0x18, 0xD9, 0xD2, 0x52, 0x55, 0x42, 0x21, 0xD7, 0x42,
+    0x19, 0xC1, 0xB5, 0xFC, 0x4D, 0xE8, 0xF0, 0x54, 0xDE, 0xC9, 0x3D, 0x10, 0x74, 0xF4, 0x34, 0x6D,
+    0x1C, 0xDE, 0xA0, 0x7B, 0x78, 0x4A, 0x3F, 0x47, 0xCF, 0x90, 0x53, 0x30, 0x39, 0x0C, 0x64, 0x41,
+    0xB6, 0xC7, 0xE1, 0x23, 0xF8, 0x00, 0x28, 0x53, 0x87, 0xC5, 0xF2, 0x1E, 0x84, 0x25, 0x03, 0xEC,
+    0x21, 0x19, 0x05, 0xF4, 0x11, 0xAC, 0x2B, 0x7B, 0x8A, 0xB6, 0xD3, 0x42, 0x0B, 0x39, 0x99, 0xBB,
+    0xDA, 0xF8, 0x7A, 0x47, 0x50, 0x1C, 0xEE, 0xD1, 0xD8, 0x06, 0x47, 0x82, 0x0A, 0x6A, 0x4E, 0x9D,
+    0xD2, 0xE6, 0xB3, 0x01, 0xE6, 0x0E, 0x66, 0x6B, 0xE6, 0xB4, 0xE7, 0xA4, 0x9A, 0x7E, 0xE0, 0xCC,
+    0xF4, 0x6B, 0xD9, 0x88, 0xE9, 0xFD, 0x98, 0x81, 0x8C, 0x91, 0xD3, 0x0F, 0x98, 0xE0, 0x1D, 0x68,
+    0x75, 0xF8, 0x41, 0xEF, 0x5E, 0x79, 0x60, 0x82, 0x9D, 0x39, 0x46, 0x43, 0x85, 0xF9, 0x44, 0x58,
+    0xBD, 0xA2, 0xB2, 0x52, 0x63, 0x07, 0x02, 0xEA, 0x2E, 0x14, 0x21, 0x22, 0x3D, 0xE9, 0xEC, 0x8F,
+    0xF3, 0xED, 0x89, 0xBB, 0xF9, 0x77, 0xEC, 0xAD, 0x57, 0xDB, 0xB4, 0xCF, 0x87, 0x7C, 0xCC, 0x86,
+    0xA4, 0x8B, 0x8A, 0x67, 0x06, 0xDF, 0x1A, 0x01, 0x74, 0x23, 0xF2, 0xD8, 0x70, 0x46, 0x55, 0x91,
+    0x95, 0x53, 0xCF, 0x8A, 0xEC, 0x09, 0xC8, 0xFA, 0x13, 0x93, 0x66, 0x34, 0x83, 0xC5, 0x2C, 0xD7,
+    0x8C, 0x72, 0xA5, 0x63, 0x5A, 0x52, 0x9A, 0x89, 0x1C, 0x9D, 0x34, 0x82, 0x5B, 0xCB, 0x9A, 0x1D,
+    0x38, 0x39, 0xA6, 0x23, 0xBE, 0xC7, 0xDD, 0x77, 0x93, 0x43, 0x3C, 0x00, 0x7A, 0xCC, 0x06, 0x67,
+    0x9C, 0x8B, 0x42, 0xAD, 0xE4, 0xEF, 0xE9, 0xC5, 0x26, 0x4F, 0x42, 0xD4, 0xC8, 0xE9, 0x3C, 0x6C,
+    0xE5, 0x75, 0x5E, 0xEF, 0x84, 0xC4, 0xD8, 0x38, 0x98, 0x61, 0x8F, 0xB1, 0x54, 0x74, 0x90, 0xA6,
+    0x66, 0x30, 0x81, 0x82, 0x2B, 0x8A, 0xF0, 0xB2, 0xD5, 0x26, 0x7C, 0x63, 0x1E, 0x9E, 0x1E, 0x5C,
+    0x31, 0x0D, 0xFA, 0x47, 0x3D, 0xC0, 0xFE, 0x29, 0x70, 0x6C, 0x8A, 0xE2, 0x80, 0x2C, 0x10, 0xE5,
+    0x2E, 0xFD, 0x28, 0x15, 0xC6, 0x95, 0x8E, 0x5C, 0xA4, 0x80, 0x84, 0xE9, 0x55, 0x73, 0x6D, 0xBD,
+    0xA2, 0x3E, 0x2F, 0x42, 0x4D, 0x0D, 0x86, 0x7B, 0xF7, 0xE1, 0xFA, 0x9E, 0x54, 0x99, 0xC1, 0x7B,
+    0x17, 0xC3, 0x70, 0x2F, 0x5C, 0x3F, 0xC4, 0xAC, 0x58, 0xCD, 0x0F, 0x84, 0xD9, 0x21, 0xD4, 0xF7,
+    0x39, 0x61, 0xC4, 0x91, 0x54, 0x36, 0xC2, 0xD1, 0xE6, 0xD9, 0x08, 0x82, 0xD2, 0xCF, 0x5F, 0xB3,
+    0x19, 0xB2, 0x91, 0x10, 0xE4, 0xDC, 0x80, 0xA9, 0x60, 0x0E, 0x78, 0x7D, 0x19, 0x06, 0x67, 0xFB,
+    0x98, 0x9E, 0xDD, 0xCD, 0xF3, 0x78, 0x2F, 0x08, 0xCF, 0x0F, 0xB1, 0x6E, 0xD0, 0x17, 0x6C, 0xC4,
+    0x06, 0x6E, 0xFF, 0xCD, 0x51, 0x7E, 0xFC, 0xAF, 0x30, 0x21, 0xA5, 0x91, 0x8F, 0x6E, 0x67, 0xBA,
+    0x66, 0xBB, 0x16, 0xF0, 0xCC, 0x84, 0xBF, 0x06, 0xDA, 0x48, 0x89, 0xD7, 0x91, 0x6B, 0x93, 0xD2,
+    0x60, 0xE6, 0xDA, 0x9D, 0x62, 0xF1, 0xF1, 0xB5, 0x60, 0x0C, 0xB7, 0xAD, 0xF2, 0x36, 0xE1, 0x22,
+    0xC8, 0xD9, 0xD2, 0x6F, 0x82, 0x9F, 0x17, 0xEE, 0x80, 0x1B, 0xDB, 0x83, 0x7D, 0x89, 0x0F, 0x3E,
+    0x14, 0xE2, 0x40, 0x05, 0xB8, 0x84, 0x18, 0xE8, 0x5F, 0x1B, 0xAE, 0x7E, 0x08, 0x7D, 0xFB, 0x55,
+    0xF0, 0x60, 0x24, 0x12, 0x8B, 0x79, 0x1E, 0x9B, 0x93, 0xF3, 0x5F, 0x7B, 0xAE, 0xB5, 0xF3, 0xA4,
+    0x87, 0xD2, 0xB9, 0xA7, 0x60, 0x2A, 0xC7, 0x79, 0x70, 0x8D, 0x74, 0x85, 0xCF, 0x5C, 0x2D, 0x77,
+    0xA3, 0x68, 0xBE, 0xBF, 0x3E, 0x5F, 0xDF, 0xB9, 0x75, 0x2C, 0xAF, 0xEB, 0xCB, 0xCB, 0x1B, 0xF3,
+    0x86, 0x69, 0xAD, 0xE3, 0xEB, 0xCB, 0x9E, 0x6F, 0x5E, 0x70, 0xBD, 0x1B, 0xD7, 0xEE, 0xEF, 0x6E,
+    0x78, 0xE2, 0x64, 0x0E, 0x5B, 0xB9, 0x05, 0x13, 0x40, 0x0D, 0xA9, 0x5D, 0x32, 0xA4, 0xB6, 0xEE,
+    0xB4, 0x48, 0x65, 0xAE, 0x26, 0xD9, 0x49, 0x4F, 0xFA, 0xBD, 0xF4, 0xFD, 0xA4, 0x0F, 0x11, 0x33,
+    0xCC, 0x67, 0xA0, 0x6F, 0xA3, 0x4B, 0x40, 0x26, 0x25, 0x0D, 0x9F, 0x42, 0x26, 0xCE, 0x54, 0xA5,
+    0xE1, 0x6C, 0x25, 0x82, 0x00, 0xD2, 0xBF, 0x26, 0x0E, 0x4F, 0x5E, 0xB3, 0x8C, 0x70, 0x52, 0xE5,
+    0x46, 0x7A, 0xA2, 0x48, 0x3A, 0x42, 0x45, 0x4F, 0xD6, 0xE6, 0x4A, 0xCB, 0x86, 0x6B, 0x95, 0xED,
+    0x0B, 0xC3, 0xCF, 0xD7, 0x6B, 0xAF, 0x44, 0x27, 0xDC, 0x06, 0xED, 0xEE, 0xCB, 0xCD, 0x7C, 0x08,
+    0xE1, 0x12, 0xC2, 0x74, 0xE1, 0xBD, 0x8B, 0xE5, 0x73, 0xAA, 0xDF, 0xFA, 0x5A, 0x29, 0x4B, 0x92,
+    0x7E, 0xCE, 0xF3, 0x2B, 0x48, 0xC7, 0xDF, 0xD2, 0x25, 0xE7, 0x38, 0xCA, 0xC0, 0xCD, 0x32, 0x3B,
+    0x67, 0x82, 0xDA, 0xB8, 0xBB, 0x8F, 0x25, 0x19, 0xB8, 0x47, 0xF0, 0x60, 0x85, 0x14, 0x52, 0x5E,
+    0x0A, 0x90, 0x41, 0xB2, 0x61, 0xEE, 0xE9, 0x1B, 0xE6, 0xF2, 0xBE, 0x59, 0xB1, 0xCC, 0x69, 0x98,
+    0x28, 0x7B, 0x69, 0x00, 0xA2, 0x1A, 0x74, 0xC2, 0x7F, 0x4A, 0x37, 0xED, 0xAF, 0xE4, 0xB3, 0xC3,
+    0x04, 0x6B, 0x41, 0xD3, 0x6E, 0x8E, 0x19, 0x6C, 0xBC, 0x3D, 0xCB, 0x30, 0xE4, 0x9B, 0xA5, 0x66,
+    0x5B, 0xD0, 0x7C, 0xA7, 0x55, 0xA8, 0x92, 0x5E, 0xBE, 0xD3, 0xD3, 0xB2, 0x8B, 0x99, 0x1E, 0xA4,
+    0x5E, 0x7E, 0x3B, 0x67, 0x24, 0xDF, 0x06, 0x80, 0x5D, 0x6F, 0x94, 0xC3, 0xDE, 0x00, 0xA5, 0xC2,
+    0x15, 0xF3, 0xEC, 0x42, 0xB1, 0xCF, 0x2B, 0x60, 0x4D, 0x58, 0xF9, 0x77, 0x3D, 0xE1, 0x2D, 0x63,
+    0x56, 0xE5, 0x3F, 0x06, 0xF5, 0x23, 0xF0, 0xBB, 0xAD, 0x5B, 0x0E, 0xC4, 0x1D, 0x73, 0xEC, 0xCA,
+    0xBF, 0xD3, 0x33, 0xCB, 0xAE, 0xFC, 0xAF, 0x91, 0x0A, 0xB6, 0xC0, 0x8F, 0x90, 0xCE, 0x36, 0xC4,
+    0xC1, 0xE5, 0xEF, 0x01, 0xBF, 0x0D, 0xFC, 0x36, 0x70, 0x8D, 0x44, 0xF2, 0x17, 0xC2, 0x95, 0x7F,
+    0x83, 0xD8, 0x57, 0x48, 0xBA, 0x80, 0x71, 0x37, 0x12, 0xFE, 0x74, 0x14, 0xCE, 0x3E, 0x1B, 0x84,
+    0xD3, 0xD0, 0x0B, 0x27, 0xA1, 0x13, 0x86, 0x0A, 0x0B, 0xAF, 0x68, 0xCB, 0xC0, 0x4B, 0x96, 0x63,
+    0xC2, 0xB5, 0x70, 0xC4, 0x42, 0xB4, 0x2A, 0x47, 0xC6, 0x49, 0x3A, 0x52, 0x43, 0x95, 0xA1, 0xDA,
+    0x50, 0x63, 0xA8, 0x33, 0xD4, 0x0B, 0xBD, 0x1B, 0x84, 0x7E, 0xC5, 0x7C, 0xD0, 0xF9, 0xB7, 0x42,
+    0x45, 0xF4, 0xDF, 0x74, 0x3A, 0x28, 0x39, 0xE8, 0x09, 0x80, 0xCA, 0x4E, 0x28, 0xEF, 0x85, 0xD2,
+    0x20, 0x14, 0x87, 0xBF, 0x23, 0x5A, 0x86, 0xB7, 0x88, 0x16, 0xE1, 0xFD, 0xA0, 0x8A, 0xF8, 0x33,
+    0xA1, 0xF2, 0x5A, 0x08, 0x4E, 0x8C, 0x28, 0x35, 0x14, 0x1B, 0x5A, 0x1A, 0x5A, 0x18, 0x72, 0x13,
+    0x92, 0x44, 0xDC, 0x2E, 0x41, 0xDA, 0x2A, 0x70, 0x31, 0x3E, 0x51, 0xF3, 0x42, 0x6D, 0x19, 0x43,
+    0xCB, 0x30, 0xF6, 0x66, 0x60, 0x26, 0x5E, 0xE3, 0x7B, 0xB9, 0xC1, 0xD4, 0x72, 0x84, 0x18, 0xFC,
+    0xED, 0x9D, 0xF4, 0xAC, 0x53, 0xAA, 0x40, 0x87, 0xB8, 0x50, 0x6C, 0xD9, 0x23, 0xC6, 0x1B, 0x26,
+    0x81, 0x07, 0x9F, 0x68, 0x2E, 0x36, 0x72, 0x7A, 0xAE, 0xB4, 0x4C, 0x63, 0x9A, 0x73, 0x5A, 0x41,
+    0xBE, 0x91, 0x6E, 0x64, 0xFC, 0xA7, 0x29, 0x4F, 0xA5, 0x35, 0x58, 0x8C, 0x94, 0x7F, 0x2C, 0x14,
+    0x48, 0x15, 0xF1, 0xA3, 0x3B, 0x22, 0xFA, 0x5A, 0x39, 0x89, 0x05, 0xB1, 0x42, 0x6E, 0x5C, 0xDE,
+    0x94, 0x39, 0x30, 0x03, 0xA1, 0xEF, 0x98, 0x3F, 0x1C, 0x83, 0x92, 0x80, 0x77, 0xCF, 0xD9, 0x1F,
+    0x98, 0x9E, 0xD8, 0x58, 0xF0, 0x55, 0x30, 0xB8, 0xFE, 0xD9, 0x0B, 0xEA, 0xFF, 0x1F, 0x3C, 0x47,
+    0x95, 0xC7, 0x44, 0x77, 0x4D, 0x37, 0x12, 0xCB, 0x51, 0x97, 0xD3, 0xD6, 0xA6, 0x3A, 0x7D, 0x52,
+    0x9C, 0x29, 0x8F, 0x3D, 0x59, 0x17, 0xE2, 0xBD, 0xB3, 0xF2, 0x6A, 0x9F, 0xD4, 0x91, 0x7D, 0x5E,
+    0x49, 0x68, 0x44, 0xA9, 0x90, 0xDB, 0x73, 0x2A, 0xB8, 0x83, 0xF6, 0x7D, 0xAB, 0x31, 0x8D, 0xC6,
+    0xD7, 0xFB, 0x19, 0x6C, 0x36, 0xD6, 0x4E, 0xD7, 0xBE, 0x27, 0x7F, 0x99, 0xA1, 0xAA, 0x2D, 0xC3,
+    0xD6, 0x04, 0x2B, 0x24, 0x88, 0xB6, 0x9E, 0xF2, 0x5C, 0x49, 0x58, 0x73, 0x0E, 0xFB, 0x74, 0x11,
+    0xFE, 0xD2, 0x12, 0x9E, 0x5D, 0x21, 0x66, 0x3B, 0xDE, 0xAA, 0xFF, 0x92, 0x58, 0xDD, 0xF3, 0x61,
+    0xA8, 0x90, 0xA9, 0xC6, 0x85, 0xB2, 0xF6, 0x7C, 0xAE, 0x80, 0x15, 0xF0, 0x53, 0xD5, 0xF4, 0x41,
+    0x26, 0x6E, 0xFE, 0xA9, 0x97, 0x4C, 0x9D, 0x5C, 0xD4, 0x74, 0x7F, 0xB1, 0x97, 0x7E, 0x69, 0xE0,
+    0x9F, 0xF9, 0xB1, 0x7C, 0xF2, 0xC3, 0xB0, 0x2D, 0x77, 0x35, 0x7D, 0x91, 0x4F, 0xC5, 0x0F, 0x66,
+    0x39, 0xB9, 0xB0, 0x4E, 0x88, 0xB5, 0x5B, 0x6E, 0xAB, 0xFF, 0xBF, 0xB2, 0xF0, 0xFF, 0x96, 0xA0,
+    0x57, 0xD1, 0xAE, 0x04, 0x07, 0x1C, 0x67, 0x45, 0xA7, 0x56, 0x98, 0xCA, 0x20, 0x96, 0xC5, 0x19,
+    0x3B, 0x5C, 0xE2, 0x18, 0xC3, 0x23, 0x76, 0x1E, 0x2B, 0x44, 0x39, 0x16, 0x24, 0x78, 0x7E, 0xC9,
+    0x9C, 0x5B, 0x31, 0x5C, 0xA5, 0x09, 0xDD, 0xDB, 0x86, 0x13, 0xAB, 0x6C, 0xF1, 0x8D, 0x8A, 0x98,
+    0xBC, 0x51, 0x43, 0x20, 0xEF, 0xA6, 0xCA, 0x31, 0xB3, 0x56, 0x85, 0x84, 0x80, 0xA2, 0x93, 0xCC,
+    0x5C, 0x8D, 0xE2, 0xE9, 0x32, 0xA8, 0x1B, 0xB3, 0x14, 0x6F, 0x26, 0xE6, 0x53, 0x1C, 0x85, 0xA1,
+    0x43, 0xB5, 0x54, 0x26, 0xEE, 0xD9, 0x73, 0xD9, 0x4C, 0xF4, 0x33, 0x5E, 0x62, 0xBD, 0xD2, 0x34,
+    0x41, 0x65, 0xB6, 0xF2, 0x0A, 0x36, 0xE5, 0xD8, 0x59, 0x68, 0x9C, 0x8A, 0x70, 0x6C, 0x53, 0xE5,
+    0x4A, 0xCA, 0x77, 0xAD, 0x36, 0xC6, 0xAE, 0x58, 0xE7, 0x54, 0xFD, 0xBA, 0xEC, 0x69, 0x3F, 0xED,
+    0x32, 0xFF, 0x8D, 0xDE, 0x61, 0xF2, 0xFC, 0xD1, 0xC0, 0xA5, 0xE0, 0x9D, 0x4B, 0xF8, 0x64, 0x39,
+    0xFD, 0xC2, 0xF3, 0x1D, 0x37, 0xBE, 0x09, 0x3F, 0x66, 0xC0, 0x01, 0xB5, 0xBF, 0x00, 0xFE, 0xB1,
+    0xB6, 0xFF, 0x4B, 0xDC, 0x7B, 0x8B, 0x54, 0x87, 0x47, 0xF2, 0xFD, 0x24, 0xF5, 0xFD, 0xD1, 0x95,
+    0xFF, 0xA9, 0x1E, 0xDA, 0x67, 0x20, 0xE8, 0xD7, 0xE2, 0xC8, 0x15, 0xCA, 0xFB, 0x8F, 0xD4, 0x54,
+    0xC0, 0xAA, 0x59, 0x30, 0x85, 0xEC, 0x40, 0x8D, 0x18, 0x05, 0xEA, 0x12, 0xD5, 0x10, 0x89, 0x74,
+    0xBC, 0x9D, 0xDE, 0xC5, 0xD2, 0xC1, 0x58, 0xF5, 0xB5, 0x78, 0x27, 0x82, 0xB6, 0xA6, 0xD0, 0x89,
+    0xB9, 0x9A, 0x9C, 0xE5, 0x4F, 0xC1, 0x7C, 0x41, 0x06, 0xC4, 0x24, 0x6D, 0xBB, 0xB0, 0x6A, 0x51,
+    0x3D, 0x8D, 0xB2, 0x4F, 0x54, 0xFD, 0x0E, 0xA9, 0x5A, 0x35, 0x41, 0xB6, 0xB0, 0x92, 0x15, 0x5A,
+    0x6B, 0x47, 0xFC, 0x9E, 0x2A, 0xD7, 0xA9, 0x8E, 0x35, 0xDF, 0xA0, 0x4F, 0x91, 0x14, 0x9C, 0x72,
+    0x6A, 0xAC, 0xE1, 0x44, 0x2A, 0xD3, 0x31, 0xB7, 0xFE, 0x88, 0x7A, 0x25, 0xBE, 0x83, 0x4F, 0x62,
+    0x31, 0xB9, 0x14, 0x79, 0x75, 0x24, 0xCA, 0x37, 0x4E, 0xDB, 0x93, 0xF8, 0x38, 0x1A, 0xB4, 0x7A,
+    0x51, 0xBD, 0xA1, 0x6B, 0xCB, 0x7A, 0x65, 0xCF, 0x3D, 0xEF, 0x04, 0xE6, 0x42, 0x11, 0xDB, 0xA2,
+    0x88, 0x9F, 0x88, 0x9D, 0x15, 0x8A, 0xD5, 0x05, 0xDB, 0x2A, 0x3B, 0x0F, 0xE1, 0x5B, 0x12, 0x9D,
+    0xF7, 0x6C, 0x5A, 0x66, 0x83, 0x55, 0xEF, 0xD6, 0x2A, 0xB4, 0xCE, 0x0D, 0xF7, 0x17, 0x99, 0xCE,
+    0x84, 0x83, 0xBA, 0x2F, 0x7F, 0x69, 0x98, 0x85, 0xC9, 0xC0, 0x6F, 0xC0, 0xCC, 0xAA, 0x3E, 0x52,
+    0xB1, 0x5F, 0x26, 0x98, 0x3A, 0xD7, 0x6E, 0xEA, 0x9E, 0x5A, 0x03, 0x69, 0xAA, 0x2C, 0x54, 0x53,
+    0x44, 0xD3, 0x90, 0x4A, 0xC2, 0x2C, 0xC4, 0xC0, 0x67, 0x86, 0x6C, 0xE7, 0x21, 0xF6, 0x7C, 0x16,
+    0x2E, 0x91, 0x78, 0x69, 0xDD, 0xEA, 0x59, 0xE8, 0x4E, 0xFD, 0x03, 0x75, 0x02, 0xAC, 0x05, 0xC5,
+    0x40, 0xD4, 0x44, 0x28, 0x4F, 0x5B, 0x77, 0xEF, 0xB8, 0xE9, 0x77, 0x72, 0x89, 0x24, 0x88, 0xB5,
+    0x14, 0x4B, 0xE7, 0x3E, 0xA3, 0xE3, 0xA5, 0x40, 0xFA, 0xB2, 0x33, 0x86, 0x0A, 0x94, 0x90, 0x46,
+    0xC4, 0x4E, 0x9D, 0x86, 0x84, 0x8F, 0x21, 0xD7, 0xF0, 0xF7, 0xFD, 0x22, 0x0C, 0xAB, 0x9E, 0xBD,
+    0x37, 0xF7, 0xEA, 0xFD, 0xB9, 0x65, 0xFC, 0x35, 0xE0, 0xFC, 0x31, 0x00, 0xA8, 0x2A, 0xAF, 0x40,
+    0x15, 0x5D, 0x5F, 0x53, 0x86, 0x8F, 0x42, 0x8F, 0x9C, 0x8A, 0x6B, 0x80, 0x6F, 0x25, 0xBD, 0x0B,
+    0x41, 0x28, 0xDB, 0x5B, 0x80, 0xEE, 0xC2, 0x62, 0xC7, 0x92, 0x5A, 0x53, 0x86, 0x9F, 0xE2, 0x59,
+    0x86, 0x0C, 0x9B, 0xEA, 0x7D, 0xFA, 0xD3, 0xDA, 0x93, 0x79, 0x6C, 0x17, 0x45, 0xFE, 0xB1, 0x64,
+    0xA5, 0xCE, 0x5A, 0xB5, 0xB4, 0x7E, 0x1A, 0xB2, 0x26, 0xC4, 0xC6, 0x53, 0xA6, 0xCE, 0x47, 0xAD,
+    0xCF, 0xEE, 0x16, 0xD0, 0x1F, 0xC6, 0x06, 0xC4, 0xD3, 0xFA, 0xF5, 0x4D, 0xBC, 0x3B, 0x31, 0xD8,
+    0x30, 0xC6, 0x6F, 0x10, 0x61, 0xA6, 0x06, 0x24, 0xFE, 0x4E, 0x7F, 0xEE, 0xAC, 0x84, 0xF8, 0x4A,
+    0x10, 0x3F, 0x89, 0x99, 0x1A, 0xFE, 0x2A, 0x40, 0x28, 0x4F, 0x03, 0xE7, 0x0B, 0x09, 0xDE, 0x04,
+    0xE6, 0x04, 0x81, 0x7D, 0xD0, 0x70, 0xD4, 0x07, 0x5D, 0x3D, 0x03, 0xD8, 0x16, 0xD5, 0x90, 0x8C,
+    0x7D, 0xDD, 0x34, 0xDC, 0xF3, 0x81, 0x91, 0x0D, 0x29, 0x23, 0xA6, 0x81, 0xCC, 0x1F, 0xD1, 0xF0,
+    0x17, 0x30, 0x99, 0x0B, 0xA5, 0x25, 0xF7, 0x48, 0xBE, 0x95, 0xF7, 0xE2, 0x01, 0xC2, 0xE9, 0x4F,
+    0x7D, 0x07, 0x0D, 0x93, 0xFB, 0x4D, 0x78, 0xC0, 0x11, 0x8F, 0xF9, 0x78, 0xF9, 0x70, 0xA4, 0x7C,
+    0x0F, 0xC1, 0x31, 0x23, 0x26, 0xFF, 0xB0, 0x89, 0xFE, 0x9D, 0xD5, 0x73, 0xB7, 0x50, 0x3A, 0x51,
+    0x5A, 0x7E, 0xC3, 0xC6, 0xC1, 0x19, 0x97, 0xFB, 0xC7, 0x07, 0x6A, 0xC2, 0xD0, 0x49, 0x8C, 0xD6,
+    0x71, 0xB4, 0x10, 0xBA, 0x6F, 0x90, 0xD2, 0x10, 0xA2, 0xF0, 0xC1, 0x05, 0xA3, 0x6A, 0x6B, 0xCF,
+    0x0B, 0xFC, 0x65, 0xB8, 0xBE, 0x6F, 0x77, 0x7F, 0x97, 0x20, 0x7E, 0x12, 0xAD, 0x41, 0xC6, 0x5B,
+    0x64, 0xF6, 0x55, 0x58, 0x19, 0xB3, 0x3F, 0x24, 0xB3, 0xDD, 0x9E, 0xD9, 0x5F, 0xC2, 0xE7, 0x89,
+    0xD9, 0x13, 0xC7, 0x33, 0xFA, 0xD1, 0x94, 0x11, 0x7C, 0xC7, 0xEC, 0x40, 0x66, 0xBF, 0x43, 0x66,
+    0xC7, 0x64, 0x76, 0x3C, 0x37, 0x92, 0x93, 0xF1, 0x8F, 0xE9, 0xD6, 0x92, 0xEB, 0x7F, 0x08, 0xB4,
+    0x14, 0x6B, 0xCC, 0x2A, 0xFB, 0x28, 0xA2, 0x87, 0xC8, 0x60, 0x5F, 0xC0, 0x5C, 0x9E, 0xC8, 0x5C,
+    0x2A, 0x9A, 0x4B, 0x43, 0x1D, 0x87, 0xB6, 0x5F, 0x07, 0xE8, 0x3D, 0xDC, 0x3A, 0x2C, 0x20, 0xA5,
+    0x2D, 0x98, 0xB9, 0x4C, 0xA0, 0x7D, 0x29, 0x70, 0x5A, 0xE4, 0x4D, 0xD9, 0x95, 0x5D, 0xDE, 0xA6,
+    0xCA, 0x06, 0xCE, 0x2E, 0xF2, 0xF6, 0xF9, 0xFE, 0xDD, 0x69, 0xA1, 0xD3, 0xB8, 0x8E, 0x2F, 0xF6,
+    0x90, 0x77, 0x3D, 0x70, 0x68, 0x03, 0x1D, 0xC7, 0x6F, 0xFD, 0xF2, 0xED, 0x47, 0xD3, 0x61, 0x5E,
+    0xC5, 0x46, 0x43, 0xE7, 0x5E, 0x7D, 0xF0, 0xC2, 0xFE, 0x1A, 0x09, 0x6B, 0xAE, 0x58, 0x03, 0x08,
+    0x86, 0xE5, 0x5D, 0xA4, 0x4C, 0x94, 0xDE, 0x14, 0x99, 0x08, 0x95, 0xB5, 0x65, 0x9C, 0xC9, 0x5B,
+    0x06, 0xBD, 0xFC, 0x0B, 0x2A, 0x4E, 0xCE, 0x7E, 0x3C, 0x73, 0xB6, 0x5A, 0xB0, 0x11, 0x64, 0x90,
+    0xA1, 0x1E, 0xE8, 0xA9, 0x62, 0x9E, 0xC1, 0x66, 0x63, 0x32, 0xCA, 0x4E, 0xBA, 0x52, 0x0C, 0x5B,
+    0x2B, 0x0E, 0xD5, 0xAB, 0xF7, 0xCB, 0xF6, 0xE5, 0xFE, 0xCF, 0x0A, 0x08, 0xFF, 0x7B, 0xD7, 0xAE,
+    0x7C, 0xDB, 0x6A, 0xE4, 0xF2, 0x37, 0x01, 0x85, 0x5F, 0xE8, 0x94, 0x2F, 0x4A, 0x11, 0xE0, 0x33,
+    0xAE, 0xC3, 0x08, 0x5D, 0x40, 0x5C, 0xCE, 0xA8, 0x09, 0x08, 0xCC, 0x70, 0x91, 0xBD, 0x93, 0xAA,
+    0x42, 0x1E, 0xCC, 0x72, 0xE9, 0x37, 0x75, 0x90, 0xF2, 0x4D, 0x61, 0xD1, 0x49, 0x22, 0x6B, 0x52,
+    0xD8, 0x7E, 0x73, 0x4A, 0x0A, 0x57, 0x76, 0x5F, 0xAE, 0x58, 0x7D, 0xFA, 0xA0, 0x5C, 0x22, 0x28,
+    0x31, 0xFA, 0x5F, 0x48, 0x06, 0x1C, 0xC7, 0xB6, 0xB3, 0x41, 0xA9, 0x6B, 0xAF, 0xB6, 0x36, 0xED,
+    0x97, 0x10, 0x79, 0xE8, 0x2D, 0x90, 0x86, 0x5D, 0x68, 0x07, 0xF4, 0x6C, 0x09, 0x59, 0xB7, 0x29,
+    0x95, 0xB0, 0x63, 0xB6, 0x48, 0xFD, 0x38, 0x3A, 0xA6, 0x8A, 0xFE, 0x4C, 0xD1, 0xFC, 0x4C, 0x7E,
+    0xFE, 0xFC, 0xFF, 0x5C, 0xB9, 0x65, 0x00, 0x83, 0x2C, 0xB6, 0x53, 0xE8, 0x79, 0xCE, 0x00, 0xD6,
+    0x7D, 0x7D, 0x00, 0xBB, 0xA2, 0xAD, 0xB7, 0x08, 0x60, 0x65, 0x8B, 0x00, 0xF6, 0x5C, 0x2E, 0xC2,
+    0x3D, 0xE3, 0xE5, 0xE2, 0x43, 0x2F, 0x97, 0x1D, 0x7B, 0xB9, 0xE7, 0x0C, 0x29, 0x3B, 0x2F, 0xB7,
+    0xDA, 0x7B, 0xB9, 0xFC, 0xC0, 0xCB, 0x3D, 0x17, 0x00, 0xAF, 0x1A, 0x04, 0x63, 0x46, 0xE5, 0xA6,
+    0x7C, 0x2A, 0xF7, 0x85, 0xEB, 0xC9, 0x45, 0x69, 0xD9, 0xA8, 0xD2, 0x10, 0x92, 0xFF, 0x22, 0x97,
+    0x3B, 0x1F, 0x0B, 0xAB, 0x59, 0x13, 0x96, 0xEC, 0x19, 0xDF, 0xE5, 0xC3, 0xA9, 0xB2, 0xF3, 0x3F,
+    0xB2, 0x11, 0xB9, 0xB5, 0x9B, 0x5A, 0x25, 0x81, 0x1B, 0xEA, 0x08, 0x9F, 0xA5, 0x08, 0x4F, 0x43,
+    0xD8, 0x95, 0x79, 0xAA, 0x49, 0x90, 0xC4, 0xFF, 0xB5, 0xB2, 0x7B, 0x26, 0x6D, 0x32, 0xEF, 0x9C,
+    0x83, 0x53, 0x25, 0xB6, 0x8A, 0x66, 0x19, 0x7D, 0x00, 0x73, 0x64, 0x76, 0xEA, 0x98, 0xD7, 0x7F,
+    0x70, 0x27, 0xD6, 0x89, 0xA5, 0x5D, 0x08, 0x59, 0xFF, 0x16, 0x29, 0xDF, 0x7F, 0x9E, 0xAB, 0xC6,
+    0xD5, 0xFE, 0x99, 0xC2, 0xA1, 0xD7, 0x5A, 0xBD, 0xFD, 0x0A, 0x60, 0xCD, 0xB5, 0x4E, 0xD6, 0x2F,
+    0x69, 0x15, 0x3B, 0x90, 0x52, 0xE7, 0xE4, 0x05, 0x4A, 0x44, 0xEF, 0xBF, 0x0D, 0x23, 0x73, 0x51,
+    0x1E, 0xD9, 0x3D, 0x1D, 0x21, 0xC4, 0x47, 0xA3, 0x0B, 0xE3, 0x72, 0x54, 0x21, 0xBA, 0xBE, 0x70,
+    0xD1, 0xBA, 0xB0, 0x2A, 0xA9, 0x3C, 0xB0, 0x05, 0x55, 0x41, 0xAC, 0x80, 0x92, 0x51, 0x46, 0xD1,
+    0xAB, 0xDE, 0x61, 0x07, 0xAB, 0xC8, 0xD5, 0xDA, 0x65, 0x5D, 0x06, 0x57, 0xC4, 0xD2, 0xA1, 0x56,
+    0xE5, 0xF0, 0x9E, 0x7C, 0xE4, 0xA7, 0x2A, 0x1F, 0xAE, 0x54, 0x3D, 0x3F, 0xB5, 0x1C, 0x61, 0x90,
+    0x02, 0xF4, 0xE2, 0x71, 0x37, 0xB7, 0x13, 0x94, 0xE6, 0x62, 0xF5, 0xB3, 0x3B, 0xDC, 0xAE, 0xEA,
+    0x76, 0x1D, 0x34, 0x96, 0x4C, 0x45, 0xD8, 0x18, 0x08, 0xF6, 0x9B, 0x0B, 0x4A, 0x03, 0x05, 0x62,
+    0xC4, 0xB4, 0xBA, 0x4D, 0x86, 0xC5, 0xE8, 0x37, 0x65, 0x13, 0x8F, 0xCB, 0xA1, 0xC4, 0xE2, 0xAB,
+    0xB0, 0xEC, 0xF3, 0x8A, 0xC5, 0xE5, 0xF7, 0xFB, 0xBC, 0x66, 0x46, 0xF3, 0x93, 0x2E, 0x7B, 0x8F,
+    0x35, 0xE7, 0x4F, 0xDA, 0xF4, 0x53, 0x56, 0x15, 0xFF, 0xD5, 0x24, 0x9F, 0xB1, 0x22, 0x15, 0x86,
+    0xDC, 0xDE, 0xDD, 0xC6, 0x57, 0xAC, 0x57, 0x3F, 0xAE, 0x57, 0x4F, 0x07, 0x75, 0x22, 0x97, 0xE6,
+    0xC9, 0x0D, 0x67, 0xC4, 0x9D, 0x32, 0x9B, 0x85, 0x69, 0x4D, 0x41, 0x42, 0x41, 0x24, 0xB8, 0x94,
+    0xD3, 0x83, 0x6E, 0x78, 0x54, 0xC6, 0x3E, 0xCA, 0x46, 0xDC, 0x50, 0xCF, 0x65, 0x3A, 0x87, 0xD9,
+    0x45, 0x89, 0x8D, 0xB4, 0xED, 0xC6, 0xAE, 0xED, 0xBD, 0x7D, 0x9F, 0xAB, 0x08, 0xB1, 0xF1, 0x7A,
+    0x76, 0xA9, 0x16, 0x8E, 0x1D, 0xBB, 0xD9, 0xFC, 0xB2, 0xD3, 0xA2, 0xE4, 0x12, 0xD5, 0x9A, 0x72,
+    0x2A, 0x30, 0x80, 0x4D, 0x9D, 0x43, 0x19, 0x91, 0x1E, 0x0A, 0x68, 0x96, 0xD1, 0x52, 0x4E, 0x8C,
+    0x03, 0x5A, 0xEA, 0x99, 0x64, 0x54, 0x7B, 0x55, 0xF3, 0x8A, 0x5D, 0x9F, 0x4C, 0x32, 0xE2, 0x69,
+    0xE6, 0x55, 0x70, 0x7B, 0x3A, 0x07, 0xD1, 0xB9, 0xA7, 0x36, 0x0A, 0x87, 0xC7, 0x60, 0x5B, 0x37,
+    0x1D, 0x8D, 0xCE, 0x35, 0x07, 0xC8, 0x7F, 0xC5, 0x9B, 0x01, 0x59, 0x46, 0xAC, 0x63, 0x51, 0x25,
+    0x59, 0x56, 0xED, 0x9C, 0xAD, 0xD7, 0x6B, 0x1D, 0xBD, 0x1D, 0x83, 0x39, 0xCD, 0xF6, 0xED, 0x54,
+    0xC6, 0xEC, 0x7F, 0x1D, 0xA2, 0x07, 0xE7, 0x03, 0xF4, 0xA5, 0x39, 0xDB, 0x62, 0x4A, 0x35, 0xF3,
+    0x61, 0xBD, 0x56, 0x1F, 0xAD, 0x08, 0xC7, 0x00, 0xF7, 0x2E, 0xEF, 0xCF, 0x35, 0xD5, 0x54, 0x30,
+    0xD9, 0x99, 0x9C, 0x11, 0xAF, 0x2A, 0xF5, 0xCE, 0x61, 0x6B, 0xEE, 0x3B, 0x0F, 0x1C, 0xD3, 0x11,
+    0xA5, 0x9D, 0x95, 0x1C, 0x82, 0xE3, 0x03, 0x6D, 0x1F, 0xA6, 0xE8, 0xFE, 0x15, 0x6F, 0xF6, 0x47,
+    0xCF, 0x43, 0x32, 0x24, 0x7D, 0xDA, 0xA7, 0x6D, 0xC6, 0x5F, 0x7B, 0xD5, 0x65, 0x75, 0xE6, 0xA2,
+    0xC1, 0x79, 0xB7, 0x1C, 0xA2, 0xE0, 0x56, 0xFD, 0x82, 0x3F, 0xEB, 0x5A, 0xF2, 0x37, 0x53, 0x31,
+    0xA2, 0x30, 0x5B, 0x2E, 0x30, 0x27, 0x80, 0x26, 0xEB, 0x78, 0x2E, 0xD5, 0xC1, 0xEF, 0xC0, 0xF3,
+    0xC4, 0xC3, 0x32, 0xD8, 0xE1, 0x32, 0xC6, 0xD1, 0x12, 0x39, 0x98, 0xE3, 0xB2, 0x26, 0x41, 0x3A,
+    0xB3, 0x4D, 0x61, 0xA8, 0x75, 0xC6, 0x1F, 0x5C, 0xE5, 0x35, 0xB6, 0x82, 0x4A, 0xE7, 0x7C, 0xE3,
+    0x7E, 0xEE, 0x16, 0x8F, 0x79, 0x2C, 0xB1, 0x49, 0x86, 0xD0, 0x42, 0x6E, 0xE0, 0x6D, 0xBB, 0x32,
+    0x84, 0x4F, 0xF0, 0x45, 0xDB, 0x45, 0x28, 0x92, 0xFE, 0xA4, 0x70, 0x7F, 0xAA, 0x32, 0x04, 0x65,
+    0xC1, 0xE9, 0x65, 0xA1, 0xCA, 0x80, 0xBF, 0xD8, 0x41, 0x71, 0xC0, 0xC3, 0x32, 0xD6, 0x07, 0x4B,
+    0x3B, 0x5B, 0xE9, 0xF5, 0x2B, 0x01, 0x35, 0x06, 0x0A, 0xA9, 0x9F, 0x82, 0x48, 0xA8, 0x85, 0x59,
+    0x2E, 0x24, 0x61, 0x5D, 0xA4, 0x76, 0x88, 0xC5, 0x26, 0xDA, 0x55, 0x38, 0xC0, 0xF0, 0xC3, 0xFF,
+    0xFA, 0x30, 0x5C, 0x6E, 0x76, 0xE3, 0xBF, 0x33, 0x8C, 0x7D, 0x46, 0xF7, 0xB8, 0xCB, 0x4C, 0x7B,
+    0xCC, 0xE9, 0xE9, 0x59, 0x5F, 0xB1, 0x6C, 0x56, 0xFB, 0x33, 0xDE, 0xEE, 0xFA, 0x6D, 0xF6, 0x53,
+    0xA3, 0x0F, 0x2E, 0xCE, 0xEE, 0x70, 0x57, 0x39, 0x93, 0x80, 0x19, 0xB2, 0x14, 0xE2, 0x53, 0xB5,
+    0xFB, 0x46, 0x21, 0xA8, 0x7D, 0xE5, 0x01, 0xA9, 0xE5, 0x4F, 0x4B, 0x8E, 0xA9, 0xDD, 0xB7, 0x6C,
+    0xB7, 0xF3, 0x78, 0x52, 0x9B, 0xF7, 0xDF, 0x25, 0xB5, 0xD4, 0xA1, 0x3F, 0x77, 0x3B, 0x2D, 0x62,
+    0xEE, 0x2D, 0x3D, 0xFA, 0x84, 0x27, 0x6E, 0xD2, 0xA4, 0x4F, 0x74, 0x9C, 0x4B, 0x5D, 0x7A, 0xCF,
+    0xDA, 0xC4, 0xD4, 0xA6, 0xB2, 0x98, 0xF5, 0xE9, 0x40, 0x52, 0x3B, 0x9D, 0x9A, 0xB5, 0xEA, 0x0D,
+    0xF5, 0x23, 0xA8, 0x4F, 0x47, 0xEF, 0x26, 0xDD, 0x7A, 0x83, 0xF3, 0xE9, 0xD9, 0xE8, 0xF7, 0xF6,
+    0xDD, 0xC4, 0x21, 0xD8, 0xC1, 0x8E, 0x43, 0xF5, 0xC4, 0xA1, 0x56, 0x27, 0x0F, 0xB2, 0x35, 0xB5,
+    0xDB, 0x65, 0x6D, 0x7B, 0x0E, 0xF1, 0x9D, 0x71, 0x68, 0x9E, 0xCF, 0xB1, 0x4D, 0x67, 0x1C, 0x62,
+    0xCB, 0x5C, 0x1C, 0xAA, 0xC4, 0x97, 0x2F, 0xC2, 0x8D, 0x77, 0x3B, 0xEB, 0x3B, 0x7C, 0xF6, 0xF7,
+    0xF3, 0xDD, 0xFF, 0x03, 0xBD, 0x56, 0xBD, 0x6E, 0xE5, 0x44, 0x14, 0x3E, 0xBE, 0x96, 0x62, 0x09,
+    0x17, 0xA6, 0x20, 0x12, 0x52, 0x0A, 0xF7, 0x11, 0x92, 0x1F, 0x61, 0x8C, 0xF6, 0x01, 0x48, 0x91,
+    0x0B, 0x05, 0x05, 0xD4, 0x57, 0x48, 0x69, 0xB6, 0x40, 0x08, 0x61, 0x0B, 0x5E, 0xE0, 0x0A, 0x41,
+    0xBD, 0x14, 0x14, 0xD9, 0xAC, 0xC4, 0xBE, 0x40, 0xB4, 0x63, 0x78, 0x02, 0x6F, 0x45, 0x41, 0x73,
+    0x11, 0xD0, 0x6C, 0x35, 0x85, 0x25, 0x4C, 0x18, 0xFB, 0xF0, 0x7D, 0x33, 0xF7, 0x66, 0x6F, 0x22,
+    0x25, 0x50, 0x44, 0x5C, 0x7B, 0xCE, 0xD8, 0x9E, 0xF3, 0xF3, 0xCD, 0xF9, 0x9B, 0x6B, 0x37, 0xB6,
+    0xB7, 0x9B, 0x70, 0xF5, 0xCD, 0xEB, 0xAB, 0x33, 0xB7, 0x2E, 0x91, 0xE3, 0x76, 0x55, 0x8B, 0x34,
+    0xAD, 0x15, 0x11, 0x5B, 0x2B, 0xA8, 0x4A, 0xA0, 0xC9, 0x1C, 0xE8, 0x24, 0x92, 0xCC, 0x0B, 0x2F,
+    0xC9, 0xFB, 0xF3, 0x07, 0xD3, 0x69, 0xA1, 0xF8, 0x4D, 0xFB, 0xF4, 0xE0, 0xD9, 0xFC, 0xFC, 0xEA,
+    0x5C, 0xB2, 0xB1, 0x70, 0x22, 0xF9, 0x40, 0x5A, 0xB8, 0x72, 0x23, 0x52, 0xBA, 0x6A, 0x23, 0x86,
+    0x3C, 0x6E, 0x9F, 0x1E, 0xDB, 0x57, 0xF6, 0xD5, 0x77, 0x62, 0xBA, 0xA6, 0x15, 0x50, 0x1B, 0x8C,
+    0xEB, 0xB5, 0x71, 0xBB, 0x6F, 0x7C, 0x01, 0xE3, 0x22, 0x6F, 0x91, 0x5C, 0xEE, 0xC8, 0xC1, 0xFC,
+    0x3D, 0xB8, 0x54, 0xFB, 0x0C, 0xDA, 0x86, 0x72, 0xA7, 0x78, 0x63, 0xFC, 0xE5, 0x41, 0xD7, 0x38,
+    0xB0, 0x34, 0x03, 0x88, 0x99, 0x48, 0xD4, 0x03, 0x87, 0x42, 0x17, 0x98, 0x87, 0x20, 0x06, 0x8C,
+    0x90, 0xE5, 0x23, 0x80, 0xBE, 0xD0, 0x11, 0x4A, 0x1B, 0x30, 0x5D, 0x56, 0xFE, 0x63, 0x92, 0x66,
+    0x7D, 0xD9, 0x8C, 0x0D, 0x35, 0x93, 0x6C, 0x48, 0xDA, 0x23, 0x25, 0xDB, 0xE1, 0x74, 0x03, 0x46,
+    0x24, 0x7B, 0xBF, 0x84, 0x5A, 0xE1, 0xD0, 0x82, 0xCC, 0xB6, 0x93, 0x4A, 0x21, 0xA0, 0xB5, 0x98,
+    0xBF, 0x55, 0x52, 0x20, 0x68, 0x3A, 0xAD, 0x33, 0xCF, 0x25, 0x6D, 0x0B, 0xB0, 0x68, 0x6B, 0xBB,
+    0xD2, 0xC5, 0xD9, 0xF4, 0x71, 0x86, 0x58, 0x98, 0x21, 0x26, 0xB6, 0xB5, 0x5F, 0x6A, 0x72, 0x4A,
+    0xFE, 0xAF, 0xA6, 0x52, 0x5B, 0xF3, 0x52, 0x0B, 0x20, 0xDB, 0x60, 0xB3, 0xA5, 0x03, 0xBE, 0x42,
+    0xBD, 0xF9, 0x55, 0xDF, 0xF3, 0x29, 0xA0, 0xFE, 0xA4, 0xE9, 0x24, 0xAB, 0x5A, 0x1F, 0xCD, 0xB4,
+    0xB4, 0xC0, 0x1B, 0x67, 0xD0, 0x69, 0x81, 0x39, 0xF7, 0x71, 0x2E, 0x86, 0xF8, 0xDD, 0x6C, 0xD2,
+    0x19, 0xFC, 0x40, 0x44, 0x4E, 0x5A, 0x4C, 0xF4, 0x09, 0x02, 0x0C, 0xDF, 0xD0, 0x4B, 0xFC, 0x64,
+    0x74, 0x03, 0x31, 0xFA, 0xAA, 0x8D, 0xBB, 0x3B, 0xB9, 0xDE, 0xE7, 0x01, 0x1D, 0x49, 0x0E, 0xC6,
+    0x09, 0x02, 0xDA, 0xD1, 0x22, 0x7C, 0x05, 0x83, 0xFA, 0x92, 0x5E, 0x4D, 0x55, 0xCC, 0x8D, 0xA9,
+    0x09, 0x53, 0x4B, 0x96, 0x44, 0x7F, 0xA1, 0x00, 0xE5, 0xA2, 0x16, 0xCF, 0x09, 0xDB, 0x92, 0xE5,
+    0xC9, 0x82, 0xBA, 0xD4, 0x21, 0x3E, 0x03, 0x9C, 0x89, 0xC8, 0x4E, 0x0B, 0xED, 0xCC, 0x5C, 0xEA,
+    0x23, 0xEC, 0xDE, 0x67, 0x90, 0x44, 0x68, 0x13, 0x45, 0x38, 0x9B, 0x01, 0x22, 0x5E, 0x9A, 0x11,
+    0xC1, 0xC5, 0xE3, 0x04, 0x9C, 0x0E, 0xBA, 0xBE, 0xB5, 0x78, 0x63, 0x46, 0x80, 0x25, 0xE7, 0xA4,
+    0x2D, 0x91, 0xFD, 0x0C, 0xED, 0x95, 0xFE, 0x95, 0x30, 0x30, 0x4B, 0x9A, 0x8B, 0x85, 0x11, 0x4B,
+    0xE2, 0xBA, 0x10, 0x16, 0x4F, 0x45, 0xC2, 0xDE, 0xB7, 0xC4, 0x6F, 0xC9, 0x9B, 0xC8, 0xFD, 0x93,
+    0xE6, 0x6B, 0x5F, 0x39, 0xCB, 0x5C, 0x0B, 0x24, 0x24, 0xB2, 0x7C, 0xA4, 0xDF, 0x08, 0x14, 0x77,
+    0x11, 0xBF, 0xE8, 0x13, 0xF8, 0x4E, 0x0B, 0x2F, 0xD9, 0x9C, 0xA9, 0x24, 0x53, 0x0A, 0x73, 0xEF,
+    0x24, 0xDD, 0xCE, 0x6F, 0xA7, 0xCC, 0x91, 0xF9, 0x5E, 0xA2, 0xD4, 0xA4, 0xEA, 0x6F, 0x92, 0xF1,
+    0xDF, 0xC4, 0x48, 0xA4, 0x60, 0xA6, 0x63, 0x54, 0x88, 0x0E, 0xDD, 0xDE, 0x10, 0x11, 0xD3, 0x0A,
+    0x3B, 0x43, 0x10, 0x53, 0xA4, 0x54, 0xC6, 0xE4, 0x9F, 0xFF, 0x03, 0xAB, 0xDC, 0xCB, 0x7A, 0xE3,
+    0xF7, 0x39, 0x06, 0xB3, 0x5A, 0x58, 0x44, 0x19, 0xA3, 0x49, 0x5F, 0x64, 0xCC, 0xFD, 0x06, 0x3A,
+    0xC3, 0x83, 0xD1, 0x75, 0x5C, 0x97, 0x66, 0xAE, 0xE9, 0xB1, 0x31, 0x64, 0xCC, 0x9A, 0xA5, 0xC9,
+    0xEE, 0x62, 0xE9, 0xBD, 0x3C, 0x64, 0x82, 0xF5, 0x3B, 0x7D, 0xF2, 0x89, 0xC4, 0xCC, 0x80, 0x03,
+    0x6E, 0x39, 0xE5, 0x16, 0x84, 0xD5, 0xC5, 0xC5, 0xC5, 0xF9, 0x2D, 0x96, 0xC3, 0xE5, 0x72, 0x79,
+    0x1A, 0x56, 0x3F, 0x0D, 0x5A, 0x98, 0xC5, 0xC8, 0x16, 0xEA, 0x6B, 0x69, 0x76, 0xA4, 0xB7, 0xF9,
+    0x98, 0xF3, 0x11, 0xCD, 0x20, 0x3C, 0x0E, 0x5B, 0x04, 0x0B, 0xDA, 0x38, 0xC3, 0x6B, 0xAE, 0x73,
+    0x1D, 0xE0, 0x95, 0xBB, 0x0D, 0x6D, 0xB5, 0x50, 0xDF, 0xE3, 0x7D, 0x10, 0x67, 0xDC, 0x0E, 0x35,
+    0x6B, 0x8C, 0x64, 0x2C, 0x88, 0x5C, 0xAF, 0x2E, 0xA8, 0xAB, 0x9A, 0xB9, 0xC4, 0xC4, 0xE3, 0x1A,
+    0xCA, 0xAD, 0xA6, 0x92, 0x1E, 0xC5, 0x58, 0xE9, 0xBA, 0x72, 0xB9, 0x87, 0x80, 0x2F, 0x5C, 0x31,
+    0x20, 0x6B, 0x7D, 0x3E, 0x94, 0xAE, 0x9C, 0x3F, 0xF4, 0xD9, 0x58, 0xF5, 0xC6, 0xA5, 0x3E, 0xF5,
+    0xE8, 0x95, 0x5D, 0x16, 0x66, 0xDB, 0xC6, 0x99, 0xAD, 0xE4, 0x7A, 0x1E, 0x39, 0xE7, 0xE0, 0xE7,
+    0x7A, 0x31, 0x16, 0x03, 0xF9, 0x2B, 0x5F, 0x3A, 0xD3, 0x9B, 0x2B, 0x55, 0xDB, 0x57, 0x1B, 0xE0,
+    0xC7, 0x76, 0x4B, 0x97, 0xE9, 0x60, 0x66, 0x41, 0xFB, 0xF9, 0xA1, 0x7D, 0xE3, 0x77, 0xC9, 0xA7,
+    0x08, 0x3E, 0x0D, 0x78, 0x58, 0x95, 0xF0, 0xC0, 0x51, 0xCD, 0x88, 0x3D, 0x7D, 0xC6, 0x6F, 0xA1,
+    0x88, 0xEA, 0x10, 0xA2, 0xB0, 0x2F, 0x14, 0xFF, 0xBC, 0x8E, 0xDB, 0x68, 0x1C, 0x4B, 0xDD, 0xFE,
+    0x4F, 0xD4, 0xB2, 0x51, 0x3A, 0xF8, 0x3E, 0x41, 0xB7, 0x9F, 0x00, 0xB8, 0xAF, 0xF4, 0x8F, 0x33,
+    0xED, 0xC2, 0x11, 0x54, 0xA7, 0x3C, 0x87, 0x42, 0x4F, 0x21, 0xFE, 0x80, 0x58, 0x0E, 0xEB, 0x10,
+    0xB0, 0xD7, 0x77, 0x2F, 0x0F, 0x76, 0xEF, 0xA9, 0xA5, 0x2B, 0x58, 0x18, 0x06, 0x96, 0xAB, 0x31,
+    0x16, 0x4C, 0x01, 0x2C, 0xD9, 0x1C, 0x3A, 0x1F, 0x52, 0xA9, 0x06, 0xE6, 0x2E, 0x14, 0x97, 0xEC,
+    0x33, 0x97, 0x5B, 0x66, 0xC6, 0x80, 0xD5, 0x16, 0x99, 0xDB, 0xFB, 0x99, 0x43, 0x63, 0x36, 0x3C,
+    0xF0, 0x78, 0x73, 0xF9, 0x81, 0xEE, 0x6B, 0x9D, 0x6C, 0xFC, 0xF2, 0x45, 0x4C, 0x86, 0x90, 0x14,
+    0xA1, 0x5B, 0x2F, 0x98, 0xF9, 0x80, 0x08, 0x38, 0xDB, 0x32, 0x29, 0xFE, 0x24, 0x9C, 0xEA, 0x37,
+    0x66, 0x90, 0xF9, 0x51, 0x43, 0x4D, 0x50, 0x00, 0x2D, 0xBA, 0x63, 0x23, 0xC3, 0x89, 0x86, 0x36,
+    0x8A, 0xF3, 0x0D, 0xC5, 0x8C, 0x74, 0x2B, 0x86, 0xF0, 0xE0, 0x78, 0x12, 0xE2, 0x5F, 0x01, 0x18,
+    0x18, 0x9F, 0xA5, 0x1C, 0xA3, 0x76, 0x6B, 0x1E, 0xDF, 0x91, 0xAC, 0xCE, 0x59, 0x2A, 0x99, 0xD6,
+    0x3C, 0x4C, 0x01, 0x8C, 0x47, 0x10, 0xCA, 0x78, 0xD5, 0xE1, 0x5B, 0x8F, 0x93, 0xB5, 0x47, 0xBD,
+    0x60, 0xA0, 0x8B, 0xEC, 0x1A, 0xD2, 0x5D, 0x03, 0x09, 0x73, 0x86, 0xAD, 0xB0, 0xDC, 0x59, 0xB1,
+    0x0D, 0xB0, 0xB1, 0x7C, 0x13, 0x75, 0xF7, 0xCB, 0x85, 0x38, 0x4E, 0x75, 0xB0, 0x53, 0x84, 0x06,
+    0x86, 0x9D, 0x9F, 0xF5, 0x4B, 0xFC, 0x3B, 0x79, 0x98, 0x6B, 0x25, 0x9F, 0xD5, 0xB1, 0xCB, 0x58,
+    0x36, 0x04, 0xE0, 0x3A, 0xC2, 0x88, 0x91, 0xBF, 0x6B, 0x30, 0x23, 0x10, 0x16, 0x3B, 0xB7, 0xE1,
+    0xB8, 0xC1, 0xA9, 0x88, 0x6E, 0xD2, 0x41, 0xB8, 0xE3, 0x77, 0xAE, 0xDF, 0x25, 0x4B, 0xBD, 0xD4,
+    0x6F, 0xC3, 0x88, 0x76, 0x9B, 0xF5, 0xF6, 0x3C, 0xCF, 0x21, 0xFC, 0xB6, 0xD1, 0xF9, 0xDD, 0xCB,
+    0xD8, 0x38, 0x9F, 0x83, 0x3C, 0x86, 0x9B, 0x5C, 0x2D, 0x07, 0x2F, 0xEA, 0x7F, 0x00, 0xDD, 0x5B,
+    0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xC4, 0x45, 0x86, 0x28, 0xE0, 0x42, 0x6C, 0xC8, 0x64,
+    0xE0, 0x36, 0xCC, 0x64, 0xD0, 0xB8, 0x95, 0x00, 0x4B, 0xA5, 0x1B, 0x66, 0x86, 0xAB, 0xC6, 0x05,
+    0x53, 0xB8, 0x52, 0x0A, 0xFE, 0x05, 0x16, 0xC0, 0xFC, 0x05, 0xAB, 0x2A, 0x45, 0x8A, 0xB0, 0x50,
+    0x21, 0x3E, 0x4E, 0x86, 0x4D, 0x8A, 0x14, 0xB6, 0x00, 0x45, 0x65, 0x1A, 0x38, 0xC9, 0x8C, 0x0B,
+    0x17, 0x7E, 0x19, 0x51, 0xCA, 0x84, 0x2A, 0x02, 0xC7, 0xF0, 0x08, 0x5C, 0x02, 0x38, 0xF9, 0xBE,
+    0x73, 0xEE, 0x7B, 0x8B, 0x5D, 0x2E, 0x45, 0x9A, 0xB6, 0x36, 0x22, 0xF7, 0x2D, 0xCE, 0xC1, 0x3E,
+    0x5C, 0xDC, 0x7B, 0xCE, 0xB9, 0xF7, 0x9E, 0x5F, 0xF7, 0xEC, 0xA5, 0xB2, 0xE8, 0x9B, 0x41, 0x46,
+    0x19, 0xAA, 0xFE, 0x6A, 0xED, 0xF4, 0xA7, 0xD8, 0xFA, 0x4F, 0x5F, 0xF4, 0xD5, 0xFE, 0xD3, 0xD8,
+    0x67, 0x40, 0x6B, 0x5C, 0xD6, 0xD2, 0x7D, 0x72, 0x0A, 0x5C, 0x93, 0xC5, 0x39, 0x11, 0x69, 0x23,
+    0x80, 0x3A, 0x05, 0x70, 0x99, 0xFC, 0xE2, 0xB6, 0xCB, 0x17, 0xF6, 0x3A, 0x11, 0x8C, 0x00, 0xD5,
+    0x70, 0x0E, 0x18, 0xF7, 0x4D, 0x08, 0x72, 0x71, 0x07, 0x65, 0x2A, 0xC7, 0x4D, 0x99, 0xA0, 0x97,
+    0x32, 0x24, 0x70, 0x15, 0xC1, 0x81, 0x3C, 0x7C, 0x6A, 0x5C, 0x77, 0xD3, 0xED, 0x7E, 0x9A, 0xA5,
+    0x74, 0x78, 0x65, 0x44, 0x0F, 0x32, 0xF0, 0x8D, 0xDE, 0xC9, 0xFC, 0xE3, 0xAD, 0x03, 0x2E, 0x9D,
+    0x74, 0x68, 0x71, 0x0E, 0xA8, 0x48, 0xE9, 0x19, 0x10, 0x9C, 0xD3, 0x2E, 0x90, 0xD6, 0xB9, 0x48,
+    0x20, 0xA6, 0x84, 0x1C, 0xB1, 0xDD, 0xD2, 0x9C, 0x03, 0x42, 0xE7, 0x42, 0x97, 0xB4, 0x3F, 0x49,
+    0x5B, 0x50, 0x21, 0x7D, 0x06, 0xB0, 0x8D, 0x29, 0x92, 0x48, 0xFE, 0x4E, 0x5C, 0x3C, 0x39, 0x29,
+    0x93, 0xC1, 0x15, 0x75, 0xD2, 0xBB, 0xA2, 0xE5, 0x5D, 0x1B, 0x8F, 0xAE, 0xAA, 0xA3, 0x25, 0x90,
+    0x92, 0xA2, 0x73, 0x14, 0x5D, 0x5B, 0xF0, 0xDD, 0xF4, 0xCB, 0xE5, 0x56, 0x17, 0xD5, 0x2E, 0x2E,
+    0x8D, 0xBD, 0x9E, 0x44, 0x40, 0x62, 0xA0, 0x22, 0x9F, 0x5C, 0x8C, 0xA6, 0xB3, 0x4B, 0x17, 0xB0,
+    0xEC, 0xB2, 0x09, 0x5F, 0x52, 0xC0, 0xA1, 0xD4, 0x45, 0x0F, 0x82, 0xDB, 0x66, 0x8B, 0x17, 0x3A,
+    0xD2, 0x5C, 0xFC, 0x2F, 0x89, 0xCE, 0xBF, 0x16, 0x74, 0x91, 0xCA, 0x0C, 0x98, 0x08, 0xC5, 0x1C,
+    0x43, 0x50, 0xE8, 0x90, 0x52, 0x5A, 0x43, 0xCF, 0xB2, 0xC1, 0x43, 0xF9, 0xE2, 0xC6, 0xF3, 0xDA,
+    0xAC, 0xE0, 0xA1, 0x6B, 0xCA, 0x67, 0x7F, 0xDE, 0x77, 0xEB, 0x9F, 0xE7, 0xB6, 0xBD, 0x7A, 0x8F,
+    0xA3, 0x0D, 0x98, 0xD0, 0x09, 0x42, 0x1C, 0xF3, 0x3E, 0xE8, 0x0B, 0x30, 0x95, 0x63, 0xF8, 0x6C,
+    0x26, 0x2B, 0x5B, 0x70, 0xBB, 0x80, 0x6F, 0xE9, 0xD2, 0x63, 0x08, 0x7A, 0x9B, 0x4F, 0x79, 0x17,
+    0x4F, 0x45, 0x17, 0xCD, 0x79, 0x1F, 0xCD, 0xD9, 0x1C, 0x4D, 0xA9, 0xFC, 0x7A, 0x0A, 0x49, 0x70,
+    0x05, 0xEA, 0x62, 0xAC, 0x09, 0x57, 0x81, 0xF3, 0x04, 0x6F, 0x47, 0xF3, 0xF7, 0x5D, 0x3C, 0x17,
+    0x47, 0xD9, 0x04, 0x49, 0x0F, 0xB8, 0xB6, 0x09, 0xD7, 0xEF, 0x15, 0x93, 0x74, 0xDE, 0xE6, 0x9D,
+    0x6D, 0x00, 0x40, 0x6C, 0x86, 0xCB, 0xE5, 0xE5, 0xF2, 0x84, 0xF2, 0x44, 0x1E, 0x2B, 0x86, 0x28,
+    0xC8, 0x79, 0xB2, 0xFC, 0xD5, 0x6D, 0x2E, 0xE0, 0xBC, 0x03, 0xBD, 0x7E, 0x51, 0xE6, 0xAD, 0x0B,
+    0x47, 0xD7, 0x3C, 0xC4, 0x24, 0x47, 0x98, 0xFD, 0x25, 0x1C, 0x5C, 0xDA, 0x66, 0xCB, 0xEC, 0x26,
+    0x97, 0x96, 0x45, 0xFD, 0x86, 0xFB, 0xA9, 0xCB, 0x5D, 0xC3, 0x05, 0x8F, 0x8F, 0xAE, 0x79, 0xF7,
+    0x76, 0x40, 0x9C, 0xB9, 0xB7, 0x0C, 0x97, 0x6F, 0x05, 0xE3, 0x29, 0xBC, 0x7B, 0xFE, 0xB6, 0x6F,
+    0x9F, 0xBB, 0x59, 0xDF, 0xCF, 0xCA, 0x0A, 0xB4, 0x7D, 0x80, 0xFE, 0x8B, 0x2F, 0xFE, 0x11, 0xCF,
+    0xE2, 0x0E, 0x93, 0x8C, 0x77, 0xA2, 0x21, 0x90, 0x31, 0x86, 0xB0, 0xD8, 0x2C, 0xE3, 0x42, 0xC7,
+    0x2A, 0x68, 0xD0, 0x34, 0x7D, 0xEC, 0xAE, 0xF1, 0x3B, 0xEE, 0xAB, 0xAD, 0x72, 0x4B, 0xCE, 0xF9,
+    0xE3, 0xB9, 0x87, 0xA4, 0xBA, 0x02, 0x02, 0x97, 0xF9, 0x4F, 0x02, 0x3C, 0x59, 0x0E, 0x64, 0x29,
+    0xB0, 0xB8, 0x8F, 0x16, 0x71, 0x8B, 0x84, 0x8B, 0x3C, 0x58, 0x2A, 0xF9, 0x20, 0x1B, 0xDF, 0x66,
+    0x53, 0xAC, 0xF6, 0x23, 0x74, 0xB9, 0x0D, 0xD1, 0x63, 0x3E, 0xC5, 0xD8, 0xA3, 0xCD, 0x80, 0x25,
+    0x19, 0xC8, 0xB6, 0xE0, 0x92, 0xAC, 0x21, 0xFB, 0x54, 0x42, 0xC8, 0xA9, 0xD0, 0x87, 0x15, 0x1F,
+    0xE2, 0x3E, 0x85, 0xA0, 0xB2, 0x25, 0xC2, 0xF2, 0x4C, 0xA4, 0xD4, 0x89, 0x6C, 0xA9, 0x04, 0xA4,
+    0xCF, 0x67, 0x3E, 0x4E, 0xF8, 0x78, 0x8C, 0xD0, 0x34, 0xAE, 0x5D, 0xBF, 0x5E, 0x35, 0xDC, 0x76,
+    0xD3, 0x19, 0x80, 0xAF, 0xA3, 0x6F, 0x04, 0xC1, 0xCD, 0xC3, 0xC3, 0x1B, 0x58, 0x06, 0xFB, 0x5F,
+    0xFC, 0xF9, 0xFB, 0x4F, 0x67, 0x7E, 0x5C, 0xEB, 0x74, 0xE6, 0x32, 0xEA, 0x74, 0x52, 0x6C, 0x9C,
+    0xCE, 0xBC, 0x6C, 0x74, 0x3A, 0xF3, 0xB2, 0xD0, 0xE9, 0x24, 0xC6, 0x74, 0x2A, 0xC6, 0x74, 0x02,
+    0x2F, 0x9C, 0x46, 0x88, 0x79, 0xF2, 0x78, 0xCB, 0xE9, 0x74, 0xF9, 0xFD, 0x5E, 0xA7, 0x33, 0x7F,
+    0x77, 0xD0, 0xE9, 0xCC, 0xCB, 0x49, 0xA7, 0x33, 0x2F, 0x3F, 0xD1, 0xE9, 0xE4, 0xFB, 0x9C, 0xCE,
+    0xBC, 0xCC, 0x3F, 0xE5, 0x74, 0xE6, 0x65, 0xFA, 0xCB, 0x97, 0x9A, 0x4E, 0x48, 0x14, 0xCF, 0xE4,
+    0x04, 0x5C, 0xDF, 0x6C, 0x36, 0xF7, 0xF8, 0x7D, 0x00, 0x2D, 0x91, 0x40, 0x25, 0x60, 0x7F, 0x95,
+    0xC5, 0x17, 0x4D, 0x5B, 0xD5, 0x79, 0x5B, 0xA1, 0xF7, 0xCA, 0xA5, 0x5D, 0x55, 0x66, 0x5D, 0xD1,
+    0x55, 0xD4, 0x62, 0xD4, 0xE6, 0xE8, 0x1F, 0x52, 0xB9, 0x5A, 0xEA, 0xCE, 0xC5, 0x9B, 0xCB, 0x37,
+    0x80, 0x2B, 0xEF, 0xC9, 0xE1, 0xCD, 0x33, 0x93, 0xF4, 0xFE, 0x7D, 0xD9, 0x7C, 0xFC, 0xCD, 0xAF,
+    0x39, 0xB7, 0xF9, 0xE6, 0x59, 0x56, 0x7A, 0xA9, 0xC2, 0x0A, 0xAA, 0xC9, 0xAF, 0xA4, 0x8C, 0xA1,
+    0x4C, 0x1D, 0x2F, 0xCE, 0x14, 0x97, 0x4B, 0x8A, 0x66, 0xA6, 0xFF, 0xEC, 0xCF, 0xF9, 0x90, 0x6D,
+    0xDB, 0xDD, 0x75, 0xE5, 0xF0, 0xB0, 0x0C, 0x9A, 0x87, 0xE0, 0x77, 0xA1, 0x8D, 0x70, 0xE9, 0x87,
+    0x54, 0x8D, 0x5E, 0x92, 0xEF, 0xA1, 0x0F, 0xF2, 0xC8, 0xEB, 0x3E, 0xFB, 0xAD, 0xA8, 0x3C, 0xDB,
+    0x1F, 0x00, 0x17, 0x8F, 0xF4, 0xFD, 0x12, 0x5B, 0xC2, 0x05, 0x1B, 0x2C, 0xF8, 0xF7, 0x3F, 0x76,
+    0x32, 0x60, 0xF9, 0x52, 0xF5, 0x42, 0x7B, 0x77, 0xEE, 0x0A, 0xB8, 0xBE, 0xE1, 0x2E, 0x1D, 0x42,
+    0x3B, 0xA7, 0xCB, 0xCB, 0x83, 0x6C, 0xC1, 0x36, 0xC8, 0x17, 0x68, 0xA9, 0x02, 0x9B, 0xEC, 0x87,
+    0xB2, 0xA8, 0x99, 0x01, 0x78, 0x42, 0xF0, 0xF9, 0x52, 0x7D, 0x2D, 0x7F, 0x8B, 0x76, 0x6F, 0x3E,
+    0xC3, 0x8E, 0x9E, 0x03, 0x5C, 0xF0, 0xFE, 0x66, 0x63, 0x12, 0x55, 0x4B, 0x2A, 0x6A, 0x54, 0x05,
+    0xF6, 0x15, 0x9B, 0xAD, 0xCC, 0x14, 0xE6, 0x0A, 0x8B, 0x17, 0x80, 0xF9, 0xEA, 0x2D, 0xEB, 0x21,
+    0x56, 0x18, 0x28, 0x84, 0x4C, 0x09, 0x5D, 0xF4, 0x2D, 0xC0, 0xB0, 0xCF, 0xDD, 0xB5, 0xBA, 0xE9,
+    0x65, 0xE0, 0xA7, 0xDA, 0x5E, 0x2A, 0xA3, 0xDE, 0xC5, 0x03, 0x8D, 0x9F, 0x6B, 0x5A, 0xCC, 0x13,
+    0x60, 0x05, 0x2D, 0xA2, 0x56, 0xD0, 0x5D, 0x3D, 0x82, 0xF1, 0x8B, 0xA4, 0xCB, 0xA4, 0x83, 0xEA,
+    0x2F, 0x1E, 0x74, 0x7F, 0x86, 0xED, 0x5C, 0x3C, 0xFB, 0xD7, 0xB6, 0x0A, 0x8C, 0x27, 0x96, 0x17,
+    0x4C, 0x32, 0xA6, 0xB9, 0xBA, 0x23, 0x4E, 0xA0, 0xA2, 0xE1, 0x11, 0x94, 0x27, 0x57, 0x53, 0x56,
+    0x35, 0x46, 0xC0, 0xF2, 0xC9, 0x84, 0xC6, 0x56, 0x2D, 0x9F, 0x0B, 0x6A, 0xF7, 0x7D, 0x55, 0x82,
+    0x93, 0xF3, 0x1A, 0x8E, 0xAA, 0xB0, 0xF6, 0x9A, 0x0F, 0xCB, 0x44, 0x2D, 0x37, 0x35, 0x22, 0x1F,
+    0xCB, 0x4E, 0x53, 0x9A, 0x1A, 0x54, 0x9D, 0x67, 0xFA, 0xCF, 0x74, 0xA1, 0xE9, 0xC5, 0x62, 0xD4,
+    0x86, 0xBD, 0x1A, 0xAB, 0xD6, 0xFD, 0xD3, 0x89, 0xBA, 0xDA, 0xDA, 0x8A, 0xAD, 0x7A, 0x5D, 0xF9,
+    0x21, 0x34, 0x6C, 0x28, 0x34, 0x87, 0xD0, 0x4D, 0x54, 0x9E, 0xC0, 0x09, 0x24, 0x90, 0xDD, 0x82,
+    0xE6, 0x45, 0x93, 0x4B, 0x19, 0xFC, 0x0C, 0xEA, 0x05, 0xD8, 0x4D, 0x2E, 0x68, 0x62, 0x2E, 0x6E,
+    0x60, 0x55, 0x6F, 0x8E, 0xB6, 0xD2, 0x70, 0x32, 0x05, 0x20, 0x3A, 0xEF, 0xD3, 0x21, 0x52, 0x9C,
+    0xC3, 0x26, 0x12, 0x17, 0x6D, 0xA6, 0x18, 0xAE, 0x05, 0xF0, 0xA5, 0x1F, 0x8A, 0xFB, 0x39, 0xB7,
+    0x0D, 0x3C, 0x96, 0x89, 0x38, 0x9E, 0xA2, 0x81, 0x38, 0x1D, 0x92, 0xAD, 0x7A, 0x1A, 0x7D, 0xD6,
+    0x12, 0x17, 0x30, 0x22, 0xDC, 0x4B, 0x0D, 0x5E, 0xE3, 0xF6, 0xA5, 0xDC, 0x80, 0xB9, 0x2F, 0x1D,
+    0x9E, 0xC7, 0x93, 0xE1, 0x74, 0x34, 0xFC, 0xAD, 0xF0, 0x75, 0xD3, 0xF8, 0xCA, 0x20, 0x50, 0xF2,
+    0x45, 0x57, 0x80, 0x7C, 0xA9, 0x8F, 0x08, 0xBE, 0x7E, 0x0A, 0x7D, 0x41, 0xBE, 0xBE, 0x07, 0x62,
+    0xC8, 0x97, 0x4B, 0x26, 0xAF, 0x47, 0x06, 0xA7, 0x04, 0x52, 0x97, 0xF0, 0x9E, 0x7E, 0x14, 0x06,
+    0x88, 0xD8, 0x33, 0x96, 0x0B, 0xD5, 0x0C, 0xF8, 0xD2, 0xC7, 0x8E, 0x73, 0xF8, 0xE8, 0x1E, 0x5F,
+    0xC3, 0x2E, 0x98, 0xF9, 0x9A, 0x62, 0xF0, 0xA5, 0xD8, 0xFF, 0xE8, 0x5A, 0xC1, 0x2A, 0xCD, 0x4D,
+    0x24, 0xBA, 0xC6, 0x48, 0x68, 0xFA, 0xCE, 0x62, 0x22, 0x71, 0x8B, 0x89, 0x24, 0x98, 0x75, 0xC4,
+    0xE0, 0xC7, 0xB0, 0x16, 0x3D, 0x3D, 0x4E, 0x5D, 0xA0, 0xC0, 0x03, 0xD7, 0xB9, 0x0B, 0xEE, 0xCF,
+    0xC6, 0xA7, 0x83, 0x29, 0x36, 0xBB, 0xF5, 0x2E, 0x7C, 0x1C, 0xF7, 0xD7, 0x4E, 0xD2, 0x11, 0x2E,
+    0x61, 0x75, 0x5F, 0xB2, 0x3E, 0xA5, 0x1F, 0x3B, 0x17, 0x1D, 0x3C, 0xE9, 0x1C, 0x9B, 0xA5, 0xFD,
+    0x00, 0x2E, 0xED, 0xBD, 0x52, 0xCA, 0x59, 0x94, 0x92, 0xF0, 0x77, 0xC4, 0xD1, 0x1C, 0xFF, 0x86,
+    0x38, 0x19, 0xD3, 0x4F, 0xD5, 0x37, 0xEC, 0xF3, 0x3B, 0x62, 0x11, 0x80, 0xA8, 0xAB, 0x84, 0xCD,
+    0x44, 0x2C, 0xA5, 0x62, 0x12, 0x0B, 0x17, 0x55, 0x27, 0x23, 0xF0, 0xA2, 0xDA, 0x1B, 0xC8, 0xD0,
+    0x9C, 0xE3, 0x6E, 0x0F, 0x48, 0x29, 0x17, 0x81, 0x7B, 0xF3, 0x94, 0xD3, 0xE7, 0x36, 0xA5, 0xCD,
+    0xB6, 0xCE, 0x31, 0xDA, 0xD1, 0x80, 0xB1, 0x93, 0x6A, 0x66, 0x27, 0x03, 0xAD, 0x31, 0xDE, 0xCF,
+    0x64, 0x1F, 0x10, 0x50, 0x87, 0xA9, 0x98, 0x71, 0x17, 0xF0, 0xBB, 0xDB, 0x6A, 0xCD, 0x6A, 0xFA,
+    0xD5, 0x2D, 0x55, 0x59, 0x67, 0x52, 0xBE, 0xCA, 0x9E, 0xC3, 0xCD, 0x5D, 0x13, 0x89, 0x85, 0x28,
+    0xF9, 0xE4, 0x0D, 0xBC, 0xED, 0x52, 0x12, 0xA5, 0xFC, 0x29, 0xBA, 0xB4, 0x72, 0x01, 0x20, 0xA5,
+    0xDA, 0xEC, 0x64, 0x6B, 0xE6, 0xC7, 0x3C, 0x5A, 0xB3, 0xA7, 0xE6, 0xF0, 0x06, 0xF2, 0x80, 0x9D,
+    0x46, 0x72, 0x6B, 0x54, 0xA4, 0x4B, 0x20, 0x91, 0x94, 0x13, 0x9C, 0x2E, 0x3A, 0x44, 0x3A, 0xC7,
+    0xA2, 0xA3, 0x2A, 0x5B, 0xC5, 0xA8, 0x42, 0xA9, 0x06, 0x1D, 0x17, 0x1A, 0x80, 0xBD, 0x31, 0x22,
+    0x31, 0x27, 0x1A, 0x24, 0xAA, 0x3A, 0x1E, 0xE9, 0xC0, 0x72, 0x5F, 0x30, 0x46, 0x00, 0x23, 0x89,
+    0x3C, 0xDA, 0x34, 0x8B, 0x0A, 0x05, 0x57, 0xB6, 0x70, 0x90, 0xB2, 0x98, 0xE9, 0x94, 0xD5, 0x94,
+    0x48, 0x64, 0x9E, 0x12, 0x96, 0x13, 0x99, 0x0C, 0x94, 0xB6, 0xCB, 0x2A, 0x55, 0x8B, 0xB4, 0x7C,
+    0x34, 0xB5, 0xF3, 0xCA, 0x23, 0xE3, 0x3D, 0xB5, 0xEF, 0x2E, 0x95, 0xEE, 0x75, 0x61, 0xFA, 0xF2,
+    0x66, 0xCD, 0x43, 0xA3, 0xC4, 0x07, 0xA2, 0xB1, 0x69, 0xBC, 0x24, 0xEA, 0x24, 0x0D, 0xBA, 0x3C,
+    0xC1, 0xF3, 0x95, 0xD7, 0x85, 0xE9, 0x37, 0x6C, 0x06, 0x61, 0xD7, 0xA8, 0x7F, 0xE1, 0x93, 0x97,
+    0x7C, 0x49, 0x94, 0xA4, 0x2F, 0x55, 0xD7, 0x64, 0x75, 0x4E, 0xE2, 0x2F, 0x61, 0xAF, 0xBC, 0x36,
+    0xCB, 0x5B, 0x7F, 0xA2, 0x49, 0x5D, 0xF9, 0x64, 0x8E, 0x17, 0x45, 0x1A, 0x84, 0xC7, 0x53, 0x4C,
+    0x02, 0x83, 0x8F, 0x82, 0x8F, 0xDC, 0x53, 0x3F, 0xAF, 0x34, 0xD3, 0x81, 0x69, 0xA7, 0x74, 0x71,
+    0x6B, 0x1E, 0x6E, 0x29, 0x0F, 0x3F, 0x8B, 0xB7, 0x2B, 0xE4, 0xBF, 0xF4, 0x4D, 0x5E, 0xD1, 0x29,
+    0xE6, 0x9B, 0x24, 0x39, 0xDC, 0xDD, 0x44, 0xBB, 0x9B, 0x78, 0x77, 0x93, 0xEE, 0x6E, 0xB2, 0xC9,
+    0xEB, 0xF5, 0x62, 0xCC, 0xEC, 0xA6, 0xEA, 0xFD, 0x4D, 0xB3, 0xF5, 0x37, 0xD8, 0x21, 0x93, 0x59,
+    0xDD, 0x36, 0x9B, 0x4D, 0x0F, 0x96, 0x6A, 0x31, 0x34, 0x59, 0xA2, 0x37, 0xE9, 0xE2, 0x6F, 0xD0,
+    0xD2, 0x6E, 0x40, 0x5C, 0xBE, 0x20, 0x42, 0x70, 0xFB, 0x78, 0xA3, 0xD9, 0xDD, 0x88, 0xBF, 0x09,
+    0x77, 0x37, 0x11, 0x99, 0x9C, 0xBC, 0x71, 0xD1, 0xB1, 0x38, 0x55, 0xD9, 0xB2, 0xD9, 0x1C, 0x71,
+    0x40, 0x76, 0xD8, 0x91, 0x59, 0xBD, 0xA1, 0x23, 0xAE, 0x37, 0xE4, 0x35, 0xF3, 0x71, 0xA6, 0x11,
+    0xCC, 0x84, 0x16, 0x77, 0x70, 0xAD, 0x83, 0xD6, 0x2A, 0x57, 0x32, 0x7F, 0x7F, 0xD1, 0x04, 0xC7,
+    0x5F, 0xA2, 0x39, 0x77, 0x7C, 0xA1, 0xEB, 0x40, 0x2D, 0xA2, 0xD7, 0xEF, 0x96, 0x85, 0xB3, 0xFD,
+    0xF1, 0xCD, 0xD0, 0x5A, 0x56, 0xFA, 0x6E, 0x61, 0xAE, 0x9E, 0x1A, 0x05, 0xF8, 0xC6, 0xEE, 0x00,
+    0x83, 0x2F, 0xEF, 0x89, 0x89, 0xDB, 0xD8, 0xE4, 0x63, 0xC2, 0x50, 0x9D, 0x37, 0x97, 0xFE, 0x87,
+    0xF3, 0x01, 0xE7, 0xCE, 0x9E, 0x86, 0x66, 0x52, 0xC4, 0x6C, 0xAA, 0x49, 0x47, 0xE1, 0x6C, 0x53,
+    0x40, 0x5B, 0x4C, 0xA6, 0x6A, 0xF3, 0x79, 0xE8, 0xCF, 0x71, 0xA9, 0xE9, 0x6B, 0x87, 0xBB, 0xF0,
+    0x4E, 0x73, 0x65, 0xAB, 0x6B, 0xC1, 0xF2, 0x72, 0x4F, 0x5D, 0x83, 0x4E, 0xC1, 0x74, 0xEA, 0xFA,
+    0xDD, 0xE1, 0xCD, 0x73, 0xDB, 0xF2, 0x3A, 0xDE, 0x6C, 0xCE, 0xF4, 0x2B, 0x1A, 0xAB, 0x51, 0x12,
+    0x91, 0xCD, 0xB9, 0xCB, 0x07, 0x8B, 0xEC, 0xAE, 0xB8, 0x8B, 0xA7, 0xE5, 0xFA, 0xC7, 0xEC, 0x84,
+    0xBB, 0xA7, 0x8E, 0xA5, 0xE9, 0xD2, 0x31, 0x1F, 0x8A, 0x2E, 0x9E, 0xAF, 0xF8, 0x24, 0xE6, 0xC5,
+    0xCA, 0x05, 0x73, 0xD4, 0x27, 0x7D, 0x36, 0xA6, 0x53, 0x86, 0x8D, 0x94, 0x0E, 0xE9, 0x18, 0x1E,
+    0x85, 0x47, 0xAB, 0x44, 0xCB, 0x85, 0xD1, 0xC2, 0x19, 0xCA, 0x4D, 0x4F, 0x98, 0x97, 0x46, 0x87,
+    0x8F, 0xFE, 0xA5, 0xCF, 0xED, 0xE6, 0xDC, 0x4C, 0xFE, 0xC2, 0x7D, 0x1B, 0x72, 0xA9, 0x3D, 0x73,
+    0x80, 0x17, 0xBF, 0x02, 0xAC, 0x70, 0x6C, 0xC7, 0xBA, 0x58, 0xF5, 0xEF, 0x0E, 0x36, 0xB5, 0xEA,
+    0x2E, 0x6E, 0xB6, 0x86, 0x99, 0xA9, 0xD2, 0xD1, 0xC8, 0x78, 0x85, 0x4C, 0x5E, 0x4B, 0xF1, 0x17,
+    0xEE, 0x41, 0xF3, 0xA0, 0xDE, 0xEF, 0x1F, 0x7A, 0xC5, 0xD8, 0xED, 0x15, 0xE2, 0x4A, 0x59, 0xF5,
+    0x7F, 0x66, 0xBD, 0x6C, 0xD3, 0x31, 0x3B, 0xB5, 0x5E, 0xA0, 0x38, 0x10, 0x4E, 0xDA, 0x95, 0x50,
+    0xC9, 0x37, 0x78, 0x87, 0x9B, 0xF4, 0x0F, 0xBD, 0xAA, 0x85, 0x7A, 0x77, 0x9B, 0xAE, 0xFA, 0xF7,
+    0x69, 0xD1, 0xB6, 0xDA, 0x16, 0x7D, 0xB5, 0xAD, 0x7A, 0x44, 0x77, 0xA7, 0xD2, 0xA2, 0x17, 0x39,
+    0x47, 0x50, 0x4D, 0xFF, 0x5D, 0x9A, 0x32, 0x1E, 0xBD, 0x4E, 0xAE, 0x0D, 0xF5, 0x3B, 0x93, 0x14,
+    0x1A, 0x05, 0x94, 0x6C, 0x21, 0x8A, 0x52, 0xE6, 0x3F, 0xA8, 0xFF, 0x5B, 0xA2, 0x68, 0x8F, 0xFE,
+    0x42, 0x1E, 0xDD, 0x0D, 0xB5, 0xDF, 0xFE, 0x59, 0xE8, 0xF4, 0x0B, 0xD6, 0x4B, 0xBD, 0xEA, 0xD3,
+    0x46, 0xB0, 0xF1, 0x1E, 0xD9, 0xE8, 0x9A, 0x8C, 0xB3, 0x7C, 0xCB, 0x8A, 0xCE, 0x45, 0xC5, 0xF5,
+    0xA6, 0xEA, 0x1E, 0x58, 0xA4, 0x42, 0x33, 0xF2, 0x8F, 0x17, 0x13, 0x9F, 0x86, 0x3B, 0x7F, 0xAF,
+    0x4A, 0xB7, 0x70, 0x4D, 0x77, 0x36, 0x76, 0xC2, 0x9C, 0xD0, 0x9B, 0xE7, 0x14, 0x2B, 0x6A, 0x0D,
+    0x75, 0x86, 0x7A, 0x43, 0xA3, 0x21, 0x3D, 0x0D, 0x68, 0x7E, 0x2D, 0x8A, 0xFE, 0x95, 0xE7, 0x0A,
+    0xAE, 0xF9, 0x8C, 0x27, 0x33, 0xAE, 0xF9, 0x37, 0xE9, 0x88, 0x60, 0x8A, 0x14, 0x55, 0xA3, 0xA2,
+    0x62, 0x52, 0x94, 0x89, 0xA2, 0x44, 0xDE, 0x15, 0xCD, 0x9F, 0x7C, 0x46, 0x14, 0xCA, 0xE7, 0x44,
+    0x4E, 0x7E, 0xAB, 0xA8, 0x3A, 0x56, 0xC4, 0x14, 0x1C, 0x50, 0x66, 0x28, 0x31, 0x14, 0x19, 0x0A,
+    0x0D, 0x39, 0x8F, 0x2A, 0x5A, 0x93, 0xCD, 0xD1, 0x3A, 0x32, 0x2B, 0xCE, 0x44, 0x66, 0xF5, 0xA9,
+    0xC8, 0x6C, 0x15, 0xA5, 0x04, 0x8D, 0xBA, 0x30, 0x99, 0x69, 0xAC, 0x46, 0x6D, 0x67, 0x68, 0xCE,
+    0x07, 0x2C, 0xD7, 0x7D, 0x70, 0x9A, 0xE2, 0x9B, 0x46, 0xD4, 0xA6, 0x65, 0xE6, 0x67, 0x60, 0x72,
+    0x68, 0xED, 0x62, 0x69, 0x9B, 0x51, 0xDD, 0x0D, 0xEA, 0xA8, 0xD0, 0xAC, 0xEF, 0x1E, 0x6D, 0xD5,
+    0xCB, 0x32, 0x14, 0xEE, 0x50, 0xE7, 0x5B, 0xFA, 0xF7, 0x2A, 0xF3, 0x56, 0x7C, 0x9F, 0x7E, 0x84,
+    0x14, 0x92, 0xAF, 0xB8, 0xEF, 0x97, 0xBF, 0xC1, 0x84, 0x47, 0xB6, 0xDC, 0x9C, 0x4D, 0xB8, 0x9A,
+    0x4E, 0x5B, 0x99, 0x0F, 0x95, 0x7A, 0x7F, 0x36, 0x75, 0x26, 0x40, 0xB3, 0xBC, 0xDC, 0x73, 0x03,
+    0xB4, 0xD7, 0x82, 0x77, 0x1F, 0xA7, 0x15, 0xEB, 0x38, 0x2D, 0x14, 0x6E, 0x6E, 0xA8, 0x55, 0xD5,
+    0xF1, 0xD9, 0x10, 0x3E, 0x1D, 0xA7, 0xBD, 0x16, 0xBC, 0x23, 0x5C, 0xB3, 0x89, 0x66, 0xB8, 0x16,
+    0x5B, 0xB8, 0x96, 0x3E, 0x3F, 0x5C, 0x7B, 0x3D, 0xD6, 0xBC, 0x45, 0x6D, 0xA3, 0x8F, 0xDA, 0x34,
+    0x22, 0x4F, 0x0D, 0x21, 0x6A, 0xD3, 0x44, 0xD7, 0xDD, 0x73, 0xA2, 0xB6, 0xD7, 0x83, 0xF7, 0x37,
+    0x5C, 0x5A, 0xBA, 0xB7, 0x98, 0xB7, 0x93, 0xB2, 0x62, 0x36, 0x35, 0x9B, 0x53, 0x9A, 0xD4, 0x4A,
+    0x73, 0x82, 0x4C, 0x74, 0x72, 0x3B, 0x58, 0x96, 0x4B, 0xD4, 0x81, 0xA6, 0x36, 0xE7, 0x59, 0xD9,
+    0x82, 0x58, 0xA2, 0xD0, 0x3C, 0xDE, 0x16, 0x5A, 0x11, 0xEB, 0xA6, 0x82, 0x8F, 0xEE, 0xFE, 0xF4,
+    0xE9, 0xE8, 0x76, 0xAB, 0xB2, 0xFA, 0x4F, 0x1F, 0x6B, 0x4C, 0x26, 0xAB, 0x61, 0x25, 0xAB, 0x07,
+    0x5E, 0x56, 0xA2, 0xB2, 0x0A, 0x44, 0x65, 0x85, 0x41, 0x28, 0xAB, 0xF4, 0x89, 0xCA, 0x2A, 0xFB,
+    0xAD, 0xCA, 0xAA, 0xF8, 0x17, 0x15, 0x92, 0xBC, 0x43, 0x14, 0x2C, 0x2A, 0x9D, 0x68, 0x52, 0x59,
+    0xA5, 0x83, 0xFE, 0x95, 0x6D, 0x55, 0x56, 0x45, 0xAB, 0xB2, 0xA2, 0x3D, 0x69, 0xAB, 0x79, 0x51,
+    0x59, 0x61, 0x14, 0x95, 0xD5, 0x40, 0x59, 0x65, 0x7A, 0xD4, 0x7A, 0x46, 0x56, 0xDE, 0x18, 0x46,
+    0x66, 0x0C, 0xD3, 0x63, 0x95, 0x55, 0xD8, 0x9B, 0xAC, 0xBC, 0xBE, 0xA3, 0x07, 0xB8, 0x8B, 0x72,
+    0x12, 0x8D, 0x78, 0x7C, 0xB6, 0xAE, 0xEA, 0x4F, 0xB4, 0xE3, 0xC9, 0xCA, 0x62, 0x90, 0x51, 0xF5,
+    0xA2, 0x1E, 0xC2, 0xC5, 0x40, 0x2A, 0x2C, 0xE9, 0x75, 0xFE, 0x7A, 0x95, 0x23, 0x9C, 0x9C, 0x2F,
+    0x6E, 0x4B, 0xAB, 0x51, 0xA9, 0x9E, 0xDB, 0xCF, 0xBA, 0x28, 0x06, 0x16, 0x42, 0x28, 0x03, 0xFE,
+    0x48, 0x41, 0x33, 0x92, 0xB1, 0x32, 0xA3, 0x89, 0x4E, 0xAB, 0x82, 0x30, 0xFB, 0xEE, 0x23, 0xA9,
+    0x55, 0x01, 0xC3, 0x2B, 0xC3, 0x97, 0xB2, 0xA5, 0x47, 0x82, 0x4E, 0x0F, 0xCE, 0x5D, 0x76, 0xAC,
+    0x47, 0x66, 0x5B, 0xB5, 0xFB, 0x65, 0x36, 0x90, 0xAD, 0x9D, 0xCF, 0xFC, 0x0A, 0xF1, 0x65, 0xC6,
+    0x0A, 0x7E, 0x2E, 0x79, 0xA9, 0x58, 0x43, 0xA1, 0x10, 0xDE, 0x6E, 0xC7, 0xD3, 0xCF, 0xCB, 0xA7,
+    0x12, 0xA8, 0xAF, 0x12, 0x5F, 0xD7, 0x3F, 0xDE, 0xBB, 0x5F, 0x76, 0x6C, 0xA5, 0x99, 0x1E, 0x3B,
+    0xC9, 0xF0, 0x8E, 0xD7, 0x89, 0xF9, 0xA5, 0x5A, 0xCC, 0x27, 0xAA, 0xC3, 0x6A, 0xA2, 0x36, 0x64,
+    0x19, 0x0B, 0x95, 0x67, 0xA2, 0x5B, 0x1F, 0xBF, 0x31, 0xFD, 0xDF, 0xCE, 0x8E, 0xAF, 0x98, 0xE1,
+    0x81, 0x6E, 0xE0, 0x69, 0xC9, 0x44, 0xD7, 0x26, 0x9F, 0x49, 0x6A, 0xBA, 0xCB, 0xDE, 0xE8, 0xC1,
+    0x00, 0x29, 0x09, 0x7C, 0x9A, 0x60, 0x95, 0xC4, 0x28, 0x5E, 0x1A, 0xAA, 0x5E, 0x68, 0xCE, 0x80,
+    0xE3, 0x7B, 0x25, 0xD5, 0xE0, 0xA8, 0xBA, 0x90, 0xD1, 0x19, 0xD4, 0x1B, 0x83, 0x82, 0xA6, 0x3F,
+    0x90, 0x01, 0x4D, 0x9A, 0x11, 0xA0, 0x98, 0x4E, 0x83, 0xD1, 0x3F, 0x38, 0x40, 0x3B, 0x2A, 0xAA,
+    0xFD, 0x6B, 0xBE, 0xAB, 0xE3, 0x7B, 0x4F, 0x0F, 0xB4, 0x07, 0x2E, 0xD8, 0xD0, 0x86, 0xDD, 0x16,
+    0x39, 0xF2, 0x6E, 0x3E, 0x93, 0x39, 0x96, 0x59, 0xE2, 0x79, 0x97, 0x9A, 0xA8, 0x49, 0x33, 0x5F,
+    0x74, 0xCD, 0xEB, 0x8A, 0xAA, 0xB9, 0xD4, 0x83, 0x5E, 0xBA, 0x81, 0xCD, 0xE4, 0x68, 0x1E, 0xA0,
+    0x34, 0x07, 0xE6, 0x4B, 0xEC, 0xEC, 0xB0, 0x1A, 0x68, 0x18, 0x78, 0x50, 0xD8, 0x2A, 0x1C, 0xB4,
+    0x8D, 0xB0, 0xBD, 0x68, 0xF9, 0x0F, 0xB4, 0x6C, 0x45, 0x4D, 0x3F, 0x56, 0x5A, 0xD0, 0x42, 0x58,
+    0xEC, 0xE1, 0x0F, 0xF4, 0x9B, 0xE2, 0x2B, 0x3E, 0x65, 0xF8, 0xA2, 0xB0, 0x63, 0x9F, 0xCB, 0xAE,
+    0x26, 0x40, 0x95, 0xAD, 0xFA, 0xA2, 0xB1, 0xCD, 0x4B, 0xB7, 0x3B, 0x63, 0x51, 0x7F, 0x6C, 0xAF,
+    0x8F, 0x0E, 0x9A, 0x8F, 0x34, 0xD1, 0xA7, 0xCB, 0x8A, 0x41, 0x17, 0xAD, 0xC3, 0x7B, 0xA0, 0xE7,
+    0xE8, 0x74, 0xC5, 0xD6, 0xA5, 0x8D, 0x4C, 0x01, 0xE3, 0x7E, 0xF2, 0x3E, 0xE5, 0x72, 0xDC, 0x70,
+    0xD1, 0x80, 0x98, 0xD1, 0xE8, 0x52, 0x00, 0xAA, 0x60, 0x52, 0x58, 0x6D, 0xC3, 0x26, 0xF2, 0x3F,
+    0x13, 0x16, 0xC8, 0x8F, 0x26, 0xC4, 0x4C, 0xF0, 0x05, 0x6C, 0x89, 0x06, 0xD4, 0x29, 0xAA, 0x29,
+    0x55, 0x51, 0xEA, 0x5C, 0x37, 0xDD, 0x4E, 0x4B, 0xEE, 0x95, 0xE4, 0xC5, 0x52, 0x15, 0x6E, 0xD4,
+    0x75, 0xD3, 0xBC, 0x1D, 0x7A, 0x2F, 0x9E, 0xB0, 0xC8, 0xED, 0x53, 0xA9, 0xA3, 0x05, 0x3A, 0x01,
+    0xFA, 0x6D, 0xE7, 0xB0, 0x5F, 0x2C, 0x55, 0x41, 0x89, 0xA1, 0xF3, 0x31, 0x82, 0xD1, 0x96, 0x7F,
+    0xD8, 0x72, 0xDC, 0x2E, 0x7A, 0xDC, 0x80, 0xAA, 0x3E, 0x5E, 0xF0, 0xD0, 0x7D, 0xEF, 0xFF, 0x67,
+    0x06, 0x55, 0x75, 0xB8, 0xA6, 0x84, 0xE7, 0x22, 0x6D, 0x00, 0x31, 0xB5, 0x30, 0x05, 0x58, 0xD7,
+    0x7F, 0x8E, 0xCF, 0xEA, 0xE7, 0x82, 0xA9, 0xBA, 0xB2, 0x53, 0x79, 0x89, 0xEA, 0xA5, 0x5F, 0xF2,
+    0x10, 0xB9, 0x9E, 0x3C, 0xD0, 0x3F, 0x13, 0xF3, 0x06, 0xDB, 0x75, 0xC8, 0x7D, 0xB1, 0x44, 0x1E,
+    0xC8, 0x51, 0x80, 0x01, 0x31, 0xCC, 0xCC, 0x88, 0x3A, 0xB6, 0xC4, 0x58, 0x67, 0x59, 0x70, 0x1B,
+    0x19, 0x9B, 0x78, 0x84, 0xBB, 0x54, 0x2D, 0x96, 0x6E, 0xC6, 0xD0, 0x9A, 0xB9, 0x07, 0x4E, 0x16,
+    0x52, 0xB1, 0x6C, 0x1E, 0x2C, 0x81, 0xB5, 0x97, 0xC4, 0xE3, 0x5C, 0x1E, 0x35, 0x5A, 0xF5, 0x33,
+    0xFB, 0xE2, 0xCB, 0x71, 0x5F, 0x84, 0xA9, 0xF9, 0x60, 0xAA, 0x20, 0x2D, 0x66, 0x64, 0x95, 0x5C,
+    0x1D, 0xFC, 0x73, 0x61, 0xAF, 0x8D, 0xA0, 0x71, 0x24, 0x4E, 0x2C, 0x99, 0x33, 0x06, 0x50, 0x1E,
+    0x07, 0xD4, 0x71, 0x5C, 0xEE, 0x3C, 0x38, 0x65, 0x11, 0x0D, 0x9D, 0xDF, 0xF6, 0xA4, 0xE2, 0x33,
+    0x91, 0x63, 0x55, 0x77, 0x07, 0xEB, 0x8A, 0xCF, 0x7D, 0xD9, 0xE7, 0x59, 0xB0, 0x2E, 0xF6, 0x74,
+    0xF0, 0xB1, 0xBB, 0x5B, 0x75, 0x62, 0x45, 0x92, 0xCC, 0xE5, 0x34, 0x04, 0xD7, 0x34, 0x42, 0xFA,
+    0xA4, 0xD4, 0xA3, 0xF1, 0x9D, 0x9A, 0xE2, 0x91, 0xB8, 0x9E, 0x8F, 0xBF, 0x41, 0x17, 0x23, 0x35,
+    0x4B, 0xD3, 0xF9, 0x9A, 0xCC, 0x17, 0x55, 0x6C, 0x41, 0x73, 0xE4, 0xCB, 0xA4, 0x76, 0xD4, 0xF7,
+    0xA9, 0x7C, 0xD8, 0x8C, 0xD9, 0x62, 0x87, 0x0B, 0xE9, 0xAC, 0x52, 0x2D, 0x28, 0x52, 0x8A, 0x64,
+    0x0D, 0x4E, 0xB3, 0x40, 0xDB, 0x07, 0x02, 0x20, 0x3A, 0x4E, 0xD9, 0x68, 0x26, 0xA0, 0x32, 0x0F,
+    0x1C, 0xE2, 0x62, 0x4D, 0xD0, 0x0B, 0x2B, 0xB6, 0x8B, 0xA5, 0xEA, 0x45, 0x15, 0xDB, 0x05, 0xCB,
+    0xEA, 0x05, 0x55, 0xC8, 0x85, 0x52, 0x75, 0xFD, 0x1E, 0x43, 0x35, 0x9E, 0x1F, 0x20, 0x8C, 0x41,
+    0xBC, 0xCE, 0x74, 0xB0, 0xCE, 0xDA, 0xA1, 0x56, 0x15, 0xBF, 0xF4, 0xEF, 0x75, 0x16, 0x91, 0x41,
+    0x33, 0x59, 0x11, 0x59, 0xD1, 0x79, 0x07, 0x0C, 0x23, 0x16, 0xC3, 0xCB, 0xFF, 0xDA, 0x79, 0x87,
+    0x46, 0x5F, 0x90, 0x80, 0xB4, 0xF9, 0x50, 0xF4, 0x4D, 0x9B, 0x4C, 0x87, 0xBB, 0xA5, 0x46, 0x39,
+    0xB3, 0xDD, 0x1F, 0xF3, 0xD2, 0x23, 0xA2, 0x4C, 0x8B, 0xC6, 0xF9, 0xC9, 0xF1, 0xB9, 0x5C, 0x1F,
+    0xD4, 0xFB, 0xF9, 0xFA, 0x36, 0xC6, 0x84, 0x9D, 0x63, 0x09, 0xC9, 0x90, 0x70, 0x63, 0x2D, 0xF4,
+    0xD2, 0x13, 0x3B, 0xEF, 0x54, 0x3F, 0x33, 0x50, 0x7F, 0x27, 0x51, 0xCF, 0x33, 0x5D, 0xD4, 0x17,
+    0xED, 0xE8, 0xB2, 0x85, 0xDE, 0x89, 0x4C, 0xF5, 0x70, 0xEE, 0x57, 0xB3, 0x3F, 0xF4, 0xB2, 0x03,
+    0x30, 0xF3, 0xA2, 0x33, 0x56, 0xBC, 0x94, 0xF9, 0xCC, 0x65, 0xB1, 0x76, 0xDE, 0xCE, 0xC0, 0x58,
+    0x5D, 0x3B, 0x4C, 0x9E, 0xB6, 0x64, 0x2E, 0xB8, 0x98, 0xD5, 0xFD, 0x9B, 0xB4, 0xB7, 0x5E, 0x43,
+    0xF2, 0xD6, 0x79, 0x3D, 0x66, 0x93, 0xAB, 0x86, 0xBB, 0x18, 0xBC, 0xE1, 0x0E, 0x57, 0x86, 0x3B,
+    0x51, 0xC3, 0xBD, 0x13, 0x57, 0x79, 0xED, 0xB1, 0xAB, 0x7E, 0x41, 0x9D, 0xFF, 0x5F, 0x58, 0x8A,
+    0xBE, 0x08, 0xF2, 0x58, 0x66, 0x96, 0xB7, 0x2D, 0xD5, 0xCC, 0x3A, 0xC1, 0x89, 0x4C, 0x8F, 0x7B,
+    0xF0, 0x72, 0x25, 0x87, 0x5C, 0xDB, 0xFB, 0xC8, 0x34, 0xB2, 0x90, 0xBB, 0xB1, 0x2A, 0x52, 0x95,
+    0x52, 0x3C, 0x9F, 0x89, 0x50, 0x83, 0xE6, 0xAE, 0x65, 0xAB, 0x77, 0x05, 0xB3, 0x91, 0x06, 0x1B,
+    0xA9, 0x7C, 0xC9, 0xEA, 0x56, 0xA1, 0xF6, 0x35, 0x71, 0xA8, 0x68, 0x4A, 0x2F, 0xA6, 0xF3, 0xC4,
+    0x17, 0x79, 0xE1, 0x96, 0xB9, 0x0A, 0x31, 0x5B, 0x4C, 0x88, 0x35, 0xB8, 0x8B, 0x55, 0x88, 0xBE,
+    0xD4, 0xBC, 0x52, 0x21, 0x26, 0x6B, 0x21, 0x6A, 0xF0, 0x19, 0x69, 0x2C, 0x63, 0x05, 0xED, 0xF9,
+    0x13, 0xCD, 0x16, 0xB1, 0xDC, 0x3D, 0x10, 0xAD, 0x10, 0x5F, 0x05, 0x9F, 0xDF, 0x0D, 0x9A, 0x4B,
+    0x77, 0x83, 0x75, 0xEB, 0x21, 0x5D, 0x76, 0xF9, 0x55, 0xAF, 0x94, 0xF4, 0x2E, 0xC0, 0x8C, 0xB6,
+    0x2E, 0xB4, 0x0C, 0xE8, 0x8D, 0xBD, 0xDF, 0xF6, 0xDD, 0xA0, 0xD9, 0x9F, 0x3B, 0xD4, 0x45, 0xAD,
+    0xFF, 0x50, 0xC0, 0xC0, 0xBE, 0xE5, 0x46, 0x6A, 0x5A, 0x16, 0xA2, 0x5D, 0xC5, 0xE7, 0x6C, 0xEE,
+    0xEE, 0x3B, 0x40, 0xF3, 0x9B, 0xBB, 0x62, 0x62, 0x4D, 0xAC, 0x47, 0xB2, 0x4F, 0xB3, 0xCC, 0xCF,
+    0x29, 0x23, 0x1F, 0xFD, 0xA3, 0x9F, 0xEC, 0x8E, 0xB5, 0xCF, 0x76, 0xF0, 0xF3, 0x15, 0xA3, 0x1F,
+    0x76, 0xCA, 0xA8, 0xA6, 0xF3, 0x64, 0xD8, 0x33, 0xFA, 0xC4, 0x18, 0x05, 0x3D, 0xF9, 0xC4, 0x70,
+    0x97, 0xC7, 0x2A, 0x2C, 0x48, 0x4D, 0x9F, 0x30, 0xE8, 0xCB, 0x3E, 0x27, 0x2C, 0x3E, 0x63, 0x18,
+    0x28, 0xEF, 0x82, 0xC5, 0xC7, 0x0B, 0x05, 0x20, 0x93, 0x42, 0x16, 0x86, 0x66, 0xB2, 0xCD, 0xC8,
+    0x68, 0xD7, 0x18, 0xA3, 0x96, 0x3C, 0xEB, 0x9D, 0x79, 0x45, 0xC9, 0x13, 0x56, 0xAA, 0x07, 0xDB,
+    0xD5, 0xE4, 0x9C, 0x78, 0x3C, 0x89, 0x79, 0x3C, 0xED, 0xB9, 0x1E, 0xCF, 0x1F, 0xB7, 0x34, 0xB9,
+    0x82, 0x21, 0x7D, 0x47, 0x16, 0xE6, 0x3E, 0x97, 0x94, 0xA5, 0xC9, 0x20, 0xF5, 0xDF, 0x17, 0x27,
+    0x0B, 0x7C, 0x07, 0xAB, 0xAA, 0x0B, 0x4F, 0x3C, 0x9E, 0x65, 0x67, 0x6D, 0xE5, 0x29, 0x8F, 0xE7,
+    0x82, 0xA9, 0x52, 0x8F, 0x27, 0x39, 0xE3, 0xF1, 0xDC, 0x81, 0x83, 0x8F, 0x50, 0x7C, 0xE5, 0xF1,
+    0x5C, 0xB4, 0xAC, 0xBC, 0xC7, 0x83, 0xB9, 0xBB, 0xC3, 0xFA, 0x8F, 0x3B, 0xE7, 0x7B, 0x3C, 0x17,
+    0x4E, 0x95, 0xD7, 0xB1, 0xDD, 0x3E, 0x21, 0x6B, 0x05, 0x35, 0x95, 0x15, 0x14, 0x95, 0xA7, 0xAD,
+    0x02, 0xFF, 0x9D, 0xE2, 0xB0, 0x6C, 0x06, 0xCD, 0x08, 0xAF, 0xB6, 0x6F, 0x46, 0x83, 0xC8, 0x35,
+    0xB0, 0xFA, 0x2F, 0x25, 0xEE, 0x69, 0x36, 0x18, 0xF4, 0x9F, 0x99, 0xA8, 0x08, 0x3B, 0xFD, 0x5F,
+    0xA5, 0xAD, 0x16, 0xC8, 0xFE, 0xE6, 0xE4, 0x3F, 0x96, 0x32, 0xFF, 0x1F, 0x4B, 0x5A, 0xA3, 0xAA,
+    0x5B, 0x3C, 0xF2, 0xA5, 0x37, 0xA3, 0x6E, 0xD1, 0x75, 0x01, 0xCC, 0x76, 0x57, 0x83, 0xEA, 0x8D,
+    0x58, 0x4A, 0x0A, 0xAF, 0x36, 0x5A, 0xCC, 0x24, 0x16, 0x66, 0x0C, 0x0A, 0xC9, 0x4F, 0xAE, 0xAA,
+    0xE0, 0xFA, 0x5D, 0xF7, 0x82, 0x55, 0xF4, 0xD7, 0x1E, 0x02, 0xC0, 0x2F, 0xA8, 0xBE, 0xA6, 0x41,
+    0xE6, 0x86, 0xAC, 0xE4, 0x2B, 0x2A, 0x0D, 0x8D, 0xEB, 0xD0, 0xDD, 0xDE, 0x0C, 0x0B, 0x45, 0xBD,
+    0x06, 0xA3, 0x07, 0x14, 0x7A, 0x46, 0xC3, 0x5D, 0x40, 0xE1, 0x7F, 0x68, 0x0A, 0x67, 0xB0, 0xAE,
+    0xBE, 0xD6, 0xA4, 0x4E, 0xC3, 0x7C, 0x50, 0x50, 0xBE, 0x78, 0x59, 0xFF, 0xEF, 0xA9, 0x9C, 0x5F,
+    0xC5, 0x19, 0xFA, 0x3F, 0xDD, 0x5C, 0xBF, 0x93, 0xDC, 0xD8, 0x71, 0x7E, 0x98, 0xD1, 0xEE, 0x54,
+    0x11, 0xE5, 0x82, 0x02, 0xAE, 0xCB, 0x47, 0x06, 0xC8, 0xA9, 0x72, 0xE1, 0x2F, 0x70, 0x01, 0x92,
+    0x03, 0x05, 0x4A, 0x36, 0xD8, 0x39, 0x55, 0xD9, 0xC1, 0x39, 0x50, 0x62, 0x2A, 0xB8, 0xBF, 0xC0,
+    0x02, 0x4A, 0x0A, 0x1C, 0x5C, 0x42, 0x3B, 0x75, 0xE0, 0x0D, 0x18, 0x90, 0x73, 0x01, 0x53, 0x27,
+    0x67, 0xE0, 0xC4, 0x40, 0x81, 0x02, 0x8F, 0xC4, 0x72, 0x29, 0x50, 0x70, 0xB8, 0x3A, 0xDD, 0x49,
+    0x26, 0x5D, 0x26, 0x7C, 0x87, 0x33, 0x67, 0x77, 0x01, 0x3C, 0xF7, 0xF7, 0xF5, 0x03, 0x06, 0xB3,
+    0xBB, 0xE4, 0x2D, 0x7F, 0x0D, 0xB9, 0x37, 0x24, 0xBA, 0x67, 0x67, 0x30, 0x0F, 0xEF, 0x75, 0x37,
+    0xDE, 0xEB, 0xFE, 0xBA, 0x1F, 0x8C, 0x37, 0x9F, 0x1F, 0x18, 0x63, 0x66, 0xD6, 0x36, 0x67, 0x98,
+    0xFB, 0xAE, 0x7F, 0x45, 0x36, 0x03, 0x8B, 0x6D, 0x01, 0x96, 0xDA, 0x25, 0x98, 0xB5, 0xA5, 0xB2,
+    0x0A, 0x3F, 0xB0, 0xF7, 0x6A, 0x61, 0x53, 0xFB, 0xDE, 0x8A, 0x2C, 0x40, 0x2B, 0xBE, 0x0D, 0x5A,
+    0x61, 0x41, 0xE7, 0x5B, 0xB0, 0x76, 0x06, 0x16, 0x35, 0x53, 0x9B, 0x48, 0x5B, 0xAB, 0x09, 0x5A,
+    0x4B, 0x6B, 0x0F, 0x2C, 0xAF, 0x0C, 0x5A, 0x93, 0xA6, 0xE4, 0xBF, 0x67, 0xE5, 0x55, 0x9B, 0x09,
+    0xD8, 0x4A, 0xDA, 0xB2, 0xE8, 0xD3, 0x0C, 0xAC, 0x95, 0x26, 0x1F, 0x2E, 0xF2, 0xCE, 0x04, 0xD2,
+    0x92, 0x1C, 0x61, 0x87, 0x8B, 0x24, 0x71, 0x8B, 0x8E, 0x67, 0x71, 0x83, 0x2B, 0x17, 0xA9, 0xF4,
+    0x60, 0x62, 0x97, 0xD2, 0x82, 0xB4, 0x54, 0x99, 0xF9, 0x7C, 0x8E, 0x4E, 0xCA, 0x35, 0xD7, 0x84,
+    0x9F, 0xF1, 0xB5, 0x9B, 0xDF, 0xE6, 0xF5, 0x12, 0x5C, 0x66, 0x89, 0x4B, 0x56, 0x5E, 0xF7, 0xAE,
+    0xFC, 0xF6, 0x96, 0x41, 0x3B, 0x06, 0x6D, 0x82, 0xEC, 0x2C, 0x6C, 0xE3, 0xE5, 0xD2, 0x11, 0x1F,
+    0xBD, 0x89, 0xEC, 0x71, 0xDE, 0xC8, 0x55, 0xE3, 0x46, 0x4E, 0x12, 0x52, 0x2B, 0x49, 0x9B, 0xB4,
+    0xF1, 0x6C, 0x13, 0xEB, 0x29, 0xF6, 0x71, 0x13, 0x58, 0xFB, 0xA3, 0x66, 0x62, 0xDB, 0x59, 0x63,
+    0xF6, 0x12, 0x08, 0x64, 0x69, 0x22, 0xE1, 0x7E, 0x65, 0xD2, 0x04, 0x5D, 0xFE, 0x10, 0x02, 0x99,
+    0x60, 0x5C, 0x14, 0x24, 0x24, 0x68, 0x42, 0x95, 0xB5, 0xF9, 0xAE, 0xF9, 0x76, 0x28, 0xC0, 0x5B,
+    0x99, 0x59, 0xE9, 0x35, 0x26, 0x28, 0x8D, 0x7D, 0x28, 0x97, 0x4A, 0xAD, 0x8C, 0x25, 0xB2, 0x1D,
+    0x7E, 0x81, 0x1E, 0x7F, 0xC7, 0xBC, 0x11, 0x55, 0x5C, 0x6A, 0x9B, 0xC6, 0x2B, 0x27, 0x9D, 0x34,
+    0x64, 0x53, 0x9A, 0x0E, 0x0C, 0x0B, 0xAF, 0xC0, 0xB1, 0x8E, 0x83, 0xF1, 0x75, 0x4C, 0x13, 0x65,
+    0xE6, 0x66, 0xB6, 0x4D, 0x49, 0x07, 0xB8, 0x68, 0x9C, 0xF5, 0xFD, 0xED, 0x28, 0x5D, 0x92, 0xFF,
+    0x06, 0x81, 0x28, 0x31, 0x52, 0xB3, 0x7B, 0x5B, 0xC8, 0x8D, 0xBB, 0x1C, 0xD8, 0x8A, 0xB2, 0x2F,
+    0x29, 0x73, 0xA8, 0x8A, 0x72, 0x37, 0x31, 0xBB, 0xBF, 0x37, 0xBA, 0x29, 0x72, 0xFB, 0x07, 0x8C,
+    0x0E, 0xF6, 0x94, 0x82, 0x52, 0xC6, 0x90, 0xED, 0x87, 0x10, 0x66, 0x69, 0xFE, 0x52, 0xEE, 0x25,
+    0xFC, 0x3E, 0xE6, 0x55, 0x39, 0x28, 0x1D, 0x9F, 0xC9, 0x29, 0x2E, 0x15, 0xE4, 0xB3, 0xA9, 0x9E,
+    0x99, 0x6A, 0x0F, 0x5A, 0xB5, 0x1B, 0xBD, 0x4B, 0x97, 0x66, 0x57, 0x2E, 0x2E, 0x62, 0x53, 0x6D,
+    0x72, 0x8E, 0xB1, 0xF8, 0x1A, 0x74, 0x02, 0x2D, 0x1B, 0xB3, 0xC3, 0x49, 0x74, 0xB2, 0xB8, 0x85,
+    0x7E, 0x8A, 0x10, 0x42, 0xB4, 0x90, 0xA2, 0x49, 0x18, 0xC8, 0x14, 0xFD, 0xF2, 0xF6, 0xFB, 0xE1,
+    0x78, 0xF9, 0x1F, 0xF8, 0xF3, 0x02, 0x2D, 0x15, 0x68, 0x34, 0xF3, 0xED, 0xB1, 0xC5, 0x20, 0x76,
+    0x4D, 0xD4, 0x8D, 0xF4, 0x02, 0x4B, 0x3B, 0x87, 0x0C, 0xDF, 0xA2, 0x8B, 0x49, 0x60, 0x97, 0xEF,
+    0x65, 0x94, 0x0E, 0x9B, 0x12, 0x69, 0x09, 0xB9, 0x4E, 0x89, 0xF3, 0x06, 0xB8, 0x71, 0x87, 0xA3,
+    0xEC, 0x74, 0x06, 0xC2, 0x74, 0xD4, 0xE1, 0x1E, 0x08, 0xEB, 0x48, 0xFA, 0x97, 0x2E, 0x45, 0x7B,
+    0x10, 0xF6, 0xC1, 0x65, 0x93, 0xF6, 0x64, 0x91, 0x19, 0xF6, 0x47, 0xBE, 0x93, 0xD6, 0xF2, 0xC7,
+    0xAD, 0xD8, 0xD2, 0x0F, 0xAC, 0x99, 0xB5, 0x26, 0x2F, 0x44, 0xD8, 0x3B, 0xC9, 0x1B, 0x91, 0xF6,
+    0xAE, 0xCE, 0x39, 0xAB, 0xB5, 0x6C, 0x1C, 0xE5, 0x27, 0x7E, 0x69, 0x4E, 0xBD, 0x2E, 0x8B, 0x6D,
+    0xFF, 0x84, 0xE6, 0x93, 0x70, 0x92, 0x1A, 0x08, 0x6E, 0xF7, 0x7F, 0xDF, 0x18, 0xCE, 0x76, 0xA5,
+    0x7D, 0x33, 0x31, 0x0B, 0x39, 0xBD, 0x9A, 0x75, 0x98, 0xA1, 0x21, 0xF4, 0x29, 0x27, 0x76, 0xCF,
+    0x72, 0xB2, 0x4F, 0x39, 0xCA, 0xBD, 0x83, 0xCB, 0x26, 0x6D, 0x99, 0x23, 0xAF, 0x1C, 0x4E, 0xAD,
+    0x49, 0x65, 0x25, 0xFD, 0xAD, 0x74, 0x35, 0xC6, 0xCD, 0x1B, 0xC2, 0x5F, 0x9B, 0xE1, 0x12, 0xDE,
+    0x3C, 0x79, 0x13, 0xD2, 0x9E, 0xDC, 0x35, 0x13, 0x99, 0x4A, 0x6C, 0x86, 0x79, 0x23, 0xAE, 0x38,
+    0x87, 0xE0, 0x04, 0xE9, 0x94, 0xCE, 0x2D, 0x1C, 0xF1, 0x7C, 0x7F, 0x2D, 0xEB, 0xE3, 0x7D, 0x0E,
+    0xB1, 0xD3, 0x81, 0x96, 0x46, 0x17, 0x43, 0xCB, 0x8F, 0x64, 0x20, 0xB9, 0x4D, 0x84, 0x06, 0xB6,
+    0x10, 0x3A, 0x95, 0x35, 0xAF, 0x92, 0x36, 0x2A, 0x0C, 0x70, 0x4C, 0xF3, 0xFA, 0x59, 0x74, 0x74,
+    0xA6, 0x2C, 0x7B, 0x43, 0x3B, 0xDA, 0x26, 0xDA, 0x3F, 0xCE, 0x71, 0x2D, 0xAE, 0xC5, 0xA0, 0xCB,
+    0x75, 0x7F, 0x6E, 0xA9, 0x2F, 0x72, 0x77, 0x72, 0x97, 0x4B, 0x27, 0x4C, 0x48, 0x98, 0xAF, 0x4B,
+    0xBF, 0xBF, 0x52, 0x0F, 0xA0, 0x52, 0x56, 0x92, 0x5D, 0xC9, 0xC8, 0x40, 0x8E, 0xC8, 0x72, 0xFB,
+    0x6B, 0x55, 0xDC, 0x89, 0x55, 0xAB, 0xE2, 0xC2, 0x7E, 0x02, 0x26, 0x1A, 0x88, 0x2D, 0xF5, 0x8F,
+    0xD5, 0x5E, 0x44, 0x4C, 0xB6, 0xE2, 0xCF, 0x85, 0xCD, 0x9E, 0xCA, 0x1A, 0x3D, 0x45, 0x7F, 0x20,
+    0x2A, 0x0C, 0xD9, 0xD8, 0x3F, 0xE5, 0x6C, 0x9A, 0x57, 0x98, 0xE9, 0xF5, 0xC4, 0x74, 0x1F, 0x58,
+    0xFA, 0x35, 0x13, 0x3B, 0x2C, 0x2F, 0xD2, 0x97, 0xFF, 0x4A, 0xC8, 0xEC, 0x4A, 0x99, 0x28, 0x88,
+    0xAC, 0xEA, 0x5D, 0x12, 0xF1, 0x5C, 0x64, 0xCD, 0x06, 0x93, 0x9F, 0x92, 0x05, 0x36, 0x01, 0xF3,
+    0xF1, 0x45, 0x81, 0x5B, 0xDB, 0xB1, 0xEF, 0xD9, 0x87, 0x87, 0xE2, 0x8B, 0xC8, 0x82, 0x5F, 0x3D,
+    0x8D, 0x6D, 0xFE, 0x40, 0x5B, 0xC9, 0x46, 0x6D, 0xEA, 0x15, 0xF4, 0x7A, 0x0F, 0xF5, 0xEA, 0xB4,
+    0x04, 0xB2, 0x64, 0xD4, 0xCF, 0x2E, 0x71, 0xEA, 0x30, 0xBD, 0x8C, 0x95, 0xDE, 0xB8, 0x67, 0x6F,
+    0xE3, 0x46, 0x86, 0x71, 0x8D, 0x29, 0xC5, 0xA3, 0xE7, 0xEC, 0xDE, 0x01, 0xCD, 0xED, 0x07, 0xD6,
+    0xA9, 0x42, 0x35, 0xA1, 0xD2, 0x12, 0xE7, 0x4F, 0x66, 0x81, 0x18, 0x7F, 0x3A, 0x65, 0xA8, 0x84,
+    0x63, 0x38, 0x65, 0xE7, 0xD1, 0x96, 0xDF, 0xF2, 0x7C, 0xB9, 0x61, 0xD3, 0xBE, 0x1D, 0x7A, 0x70,
+    0x90, 0xF9, 0xAF, 0xE4, 0x5A, 0x69, 0x37, 0xB5, 0x4E, 0xE2, 0x3B, 0xF3, 0xF9, 0xBE, 0x9C, 0x51,
+    0xF7, 0x07, 0xFE, 0x56, 0x37, 0xD3, 0x76, 0x72, 0xFB, 0xD8, 0xD1, 0xD1, 0xE5, 0x15, 0x7D, 0xC5,
+    0xCD, 0x03, 0x4B, 0x97, 0x8C, 0x68, 0xE3, 0xF8, 0x7A, 0x7E, 0x70, 0xEE, 0xB9, 0x38, 0x8E, 0x17,
+    0x8B, 0x53, 0xED, 0xDA, 0x6F, 0x88, 0x7C, 0xBC, 0xFC, 0x96, 0x51, 0x3F, 0xBC, 0x9F, 0x24, 0xAA,
+    0x40, 0x0C, 0x6A, 0x25, 0xFE, 0x67, 0xD8, 0x44, 0x62, 0x68, 0x2D, 0x44, 0xD2, 0xC5, 0xDD, 0xE2,
+    0x5E, 0x07, 0xE7, 0x6E, 0x4C, 0x36, 0x67, 0x0A, 0x78, 0xAC, 0x22, 0x8F, 0xCC, 0xFB, 0x37, 0x88,
+    0x63, 0xA5, 0xDA, 0x4B, 0xE1, 0xEE, 0xFA, 0xBC, 0x9F, 0xF6, 0xF6, 0x4D, 0x94, 0x99, 0x9F, 0x85,
+    0x85, 0xE9, 0x82, 0xEE, 0x1E, 0x9C, 0x49, 0x9C, 0x53, 0xCA, 0x29, 0xA2, 0x5D, 0x55, 0xF0, 0x36,
+    0xE5, 0x72, 0xE1, 0x80, 0x64, 0xAB, 0x12, 0x32, 0x9E, 0xF0, 0x50, 0x4E, 0x8E, 0x5A, 0x77, 0xC8,
+    0x7B, 0xBF, 0x1E, 0x96, 0xA8, 0xAD, 0x5A, 0x8E, 0x79, 0x87, 0x2E, 0x38, 0x17, 0xF3, 0xA5, 0x23,
+    0x0C, 0x6D, 0x4C, 0x9E, 0x6C, 0x2E, 0xEB, 0x5B, 0x94, 0xD0, 0x76, 0x25, 0x30, 0x93, 0x56, 0xC2,
+    0xA5, 0xC6, 0x2E, 0x08, 0xD6, 0x31, 0xF0, 0xFC, 0x91, 0x3A, 0x0F, 0x58, 0x15, 0x65, 0x7D, 0x78,
+    0xC6, 0xE8, 0xA3, 0x57, 0x38, 0x7A, 0x59, 0x65, 0xF6, 0xD2, 0xCC, 0x05, 0x4F, 0x8C, 0xF7, 0xA6,
+    0xF8, 0xE1, 0x8C, 0xA4, 0xFD, 0x3B, 0xA8, 0xA7, 0xEA, 0xC3, 0xC2, 0xB4, 0x94, 0xF0, 0x6E, 0x91,
+    0x44, 0x95, 0xC4, 0x16, 0x7E, 0x2B, 0xE6, 0x34, 0xB5, 0x18, 0x22, 0xFD, 0x1E, 0xDE, 0x6E, 0x3B,
+    0x07, 0x23, 0x7B, 0x32, 0x1C, 0xEA, 0x06, 0xE9, 0x28, 0x92, 0xF3, 0x49, 0x6D, 0x54, 0xB0, 0x67,
+    0x88, 0x08, 0xF7, 0x19, 0x3F, 0x23, 0x11, 0x19, 0x9F, 0x73, 0x35, 0x0B, 0xD7, 0x61, 0xF7, 0xB6,
+    0x38, 0x90, 0xB1, 0xAC, 0xCB, 0x9F, 0x4A, 0x2F, 0x23, 0x5D, 0x2C, 0x19, 0xF5, 0xD6, 0x63, 0xBF,
+    0x61, 0xBB, 0x37, 0xA3, 0xB9, 0xB2, 0x50, 0x70, 0x80, 0x91, 0xAB, 0x9A, 0x3F, 0x06, 0x32, 0x6B,
+    0xE1, 0x09, 0x84, 0x35, 0xD6, 0x56, 0x89, 0x24, 0xD6, 0xD1, 0xE8, 0xFB, 0xF6, 0x88, 0x4B, 0xB0,
+    0x68, 0x2B, 0x1E, 0x9C, 0x9A, 0xA5, 0x74, 0x73, 0x61, 0x0B, 0x5F, 0x9A, 0xDE, 0x4D, 0x14, 0xD7,
+    0x51, 0x9F, 0xCF, 0x79, 0x90, 0xCD, 0xDA, 0x2F, 0xCC, 0x9D, 0xA7, 0x28, 0x4B, 0x49, 0x75, 0x96,
+    0xE6, 0xB5, 0xB7, 0x10, 0x2A, 0x43, 0x48, 0x2B, 0xFC, 0x2A, 0xAD, 0xE0, 0x41, 0xA6, 0x15, 0x5A,
+    0x4B, 0x45, 0x0E, 0x32, 0x89, 0x55, 0xBE, 0x3D, 0x7A, 0xD7, 0x56, 0x53, 0x5D, 0xD4, 0x95, 0x46,
+    0xFD, 0x02, 0x8F, 0x65, 0x74, 0x07, 0x13, 0xBF, 0x87, 0x50, 0x94, 0x92, 0xA5, 0x8C, 0x63, 0x78,
+    0x0C, 0x79, 0x81, 0xA5, 0xD8, 0x44, 0x95, 0x77, 0x30, 0x44, 0xA3, 0xFE, 0x91, 0x37, 0x97, 0x71,
+    0xDF, 0x17, 0x27, 0xC2, 0x3E, 0xB1, 0x5C, 0xE5, 0x02, 0xAC, 0xD4, 0x21, 0x16, 0x41, 0x2E, 0x98,
+    0x5C, 0x2F, 0xE9, 0x9D, 0x9C, 0x4B, 0x1A, 0x25, 0xBE, 0x8D, 0xE0, 0x41, 0x87, 0x58, 0x6E, 0xB9,
+    0x62, 0xB2, 0x7F, 0x32, 0xA4, 0xDF, 0x63, 0x0D, 0x96, 0x25, 0xD5, 0xDB, 0x57, 0x1C, 0x85, 0xA4,
+    0xFB, 0x33, 0xB8, 0x46, 0xC1, 0xF1, 0xDF, 0x58, 0x80, 0x08, 0x76, 0x05, 0x52, 0x82, 0x24, 0xDE,
+    0x3D, 0x78, 0xE8, 0x01, 0xE1, 0x33, 0xA0, 0x67, 0x88, 0x56, 0x01, 0x9E, 0x4D, 0x15, 0x3B, 0x53,
+    0xE8, 0xCC, 0x21, 0x3A, 0xFB, 0xE6, 0xB2, 0x69, 0x45, 0x6E, 0xD3, 0xCA, 0xB4, 0x80, 0x6D, 0xF2,
+    0x87, 0x62, 0x6B, 0x31, 0x6E, 0xD7, 0x50, 0x9D, 0x7F, 0x74, 0x63, 0xA7, 0x1F, 0xCE, 0xDB, 0xA9,
+    0x15, 0xE3, 0xFD, 0x84, 0x9D, 0x63, 0x6C, 0xA4, 0xFE, 0xD7, 0x98, 0x4E, 0x56, 0xA7, 0x63, 0xDB,
+    0x4B, 0xA2, 0x15, 0x2E, 0x82, 0x04, 0x6A, 0x08, 0x46, 0x4D, 0x34, 0x82, 0x04, 0x4C, 0x98, 0x6E,
+    0x2C, 0x82, 0x6F, 0xA9, 0x56, 0x2E, 0x97, 0xAC, 0x1D, 0x04, 0xCC, 0x59, 0x97, 0x31, 0x97, 0x61,
+    0xC8, 0x65, 0x82, 0xD5, 0x1A, 0xD0, 0x0C, 0x09, 0xD1, 0x2A, 0x80, 0xB3, 0x7B, 0xD8, 0x7F, 0x1C,
+    0x11, 0x61, 0xC4, 0x57, 0x79, 0xE1, 0xF4, 0x65, 0x86, 0x48, 0x78, 0x1B, 0xBA, 0x89, 0xCF, 0xE8,
+    0xC6, 0x42, 0x37, 0xDD, 0x33, 0x74, 0xB3, 0x38, 0x1C, 0x22, 0x63, 0x8D, 0x92, 0x83, 0x0E, 0x5A,
+    0x88, 0xCB, 0x14, 0x80, 0x71, 0x16, 0xD6, 0x00, 0xDE, 0x06, 0x64, 0x30, 0xAD, 0x70, 0x40, 0x13,
+    0x69, 0xFD, 0xDC, 0xF4, 0xEB, 0xF9, 0x3C, 0xAF, 0x73, 0xA2, 0xCF, 0xE7, 0x50, 0xFD, 0xF6, 0xC5,
+    0x5A, 0x1E, 0x51, 0x73, 0x53, 0xC1, 0xC4, 0x96, 0x98, 0x2D, 0x43, 0xE1, 0x0E, 0x8A, 0x88, 0xEA,
+    0x18, 0x0E, 0x56, 0xE1, 0x9F, 0x06, 0x13, 0x6F, 0x1C, 0x9A, 0x1E, 0x09, 0xBD, 0x20, 0xBD, 0x7E,
+    0x04, 0x8A, 0x99, 0x31, 0x7D, 0x02, 0xEB, 0x49, 0x09, 0x1A, 0xA4, 0xF6, 0x58, 0x2E, 0x8A, 0x50,
+    0xAE, 0x33, 0x69, 0x8B, 0xA5, 0x5D, 0xCC, 0x30, 0xE8, 0x00, 0xCE, 0xAC, 0x69, 0xFD, 0x92, 0x14,
+    0x8E, 0x30, 0x6E, 0xFC, 0xC9, 0x19, 0xAE, 0x87, 0xD5, 0x57, 0x76, 0x9A, 0xFF, 0xD8, 0xFE, 0xE7,
+    0xFC, 0x5D, 0xFB, 0x79, 0x72, 0xF6, 0x77, 0xF8, 0x7C, 0xA9, 0xD1, 0xEE, 0x33, 0xF9, 0xE7, 0xEE,
+    0xBC, 0xA7, 0x5D, 0xFF, 0x25, 0xF9, 0x22, 0x31, 0x3D, 0x5C, 0xA7, 0xF4, 0xA7, 0x12, 0xDA, 0xD3,
+    0xC1, 0xAA, 0x37, 0x69, 0x7F, 0x8E, 0x9E, 0x9F, 0xDC, 0xBC, 0x25, 0xF4, 0x47, 0x16, 0xDE, 0x65,
+    0x6A, 0x1D, 0x6A, 0x45, 0x97, 0x0C, 0x33, 0x4B, 0x3D, 0xB5, 0x25, 0x02, 0x06, 0xDC, 0xF3, 0xC5,
+    0x88, 0x66, 0x2F, 0x49, 0xCD, 0x55, 0xB3, 0x27, 0xD7, 0x8E, 0x03, 0x7B, 0xD4, 0xC9, 0x04, 0xD2,
+    0xC4, 0xFF, 0x62, 0x57, 0xB1, 0xC9, 0x97, 0x57, 0x9D, 0x49, 0x21, 0x8D, 0x36, 0x75, 0xC7, 0x04,
+    0xB6, 0x11, 0x49, 0x27, 0x7C, 0x6B, 0x5E, 0xFA, 0x08, 0x89, 0x07, 0xAE, 0xA6, 0xA3, 0xF6, 0xC5,
+    0xC7, 0xB8, 0x2A, 0xB3, 0xD4, 0x47, 0x91, 0xFD, 0x02, 0x89, 0x8F, 0x55, 0xFA, 0x9E, 0xAD, 0x3E,
+    0x12, 0x33, 0xB9, 0xDA, 0x07, 0x8F, 0xF0, 0x21, 0xE3, 0xFA, 0x95, 0x1E, 0x88, 0xDC, 0x9D, 0x75,
+    0xF1, 0xE8, 0x23, 0x79, 0xB9, 0x93, 0x13, 0xEB, 0x0E, 0x79, 0x6F, 0x7C, 0xA6, 0x99, 0x8A, 0x97,
+    0x3E, 0x66, 0x8C, 0xD0, 0x89, 0x92, 0x0D, 0xED, 0xEF, 0xCD, 0xE7, 0xB8, 0x46, 0xD1, 0x1F, 0x7B,
+    0x3D, 0x9A, 0x80, 0x09, 0x17, 0x4B, 0xE3, 0x2B, 0x3C, 0x7E, 0x66, 0xBC, 0x55, 0x2A, 0xA1, 0x4E,
+    0x7C, 0x9C, 0xCB, 0x7A, 0x62, 0x4B, 0x9F, 0xB8, 0xAC, 0xCC, 0x30, 0x5E, 0x9F, 0x12, 0x25, 0xDC,
+    0xC4, 0x03, 0x58, 0x27, 0xD0, 0x24, 0xF3, 0xD4, 0x18, 0xEF, 0xE2, 0x87, 0x27, 0xD1, 0x00, 0x00,
+    0xCC, 0x78, 0xD4, 0x7E, 0x2C, 0x3E, 0x5A, 0x9C, 0x4D, 0x9A, 0xE8, 0x38, 0xC7, 0x64, 0x5E, 0xCD,
+    0x30, 0x0F, 0xE5, 0x32, 0x71, 0x7B, 0xC9, 0x6B, 0xD3, 0xF7, 0x36, 0xF5, 0xCA, 0x88, 0x12, 0x70,
+    0x66, 0x54, 0x68, 0xC4, 0x1B, 0x83, 0x9F, 0x20, 0x00, 0xD2, 0x35, 0xCD, 0x93, 0x68, 0xF7, 0x56,
+    0xD0, 0x84, 0x5D, 0xD8, 0x05, 0x2D, 0x23, 0x4F, 0x89, 0x24, 0x83, 0xF6, 0x62, 0xFF, 0xA6, 0x75,
+    0xB0, 0x8C, 0x8B, 0x34, 0x49, 0xB3, 0xF4, 0x51, 0x2C, 0x6B, 0xA8, 0x34, 0xF6, 0x8E, 0xC2, 0x0B,
+    0xFD, 0x0C, 0xAA, 0xF9, 0xD2, 0x64, 0x84, 0xC7, 0x6F, 0xD1, 0xA6, 0xF7, 0xE3, 0xFA, 0x62, 0xFF,
+    0xD0, 0xAB, 0xB0, 0xC1, 0x6F, 0x22, 0x47, 0xD1, 0xB7, 0xA8, 0x41, 0xEF, 0xA2, 0x06, 0xED, 0xBF,
+    0x7E, 0x8A, 0x11, 0x44, 0x0D, 0xC6, 0x10, 0x6D, 0xF4, 0x44, 0xE9, 0xE9, 0xEC, 0x92, 0xD5, 0xD4,
+    0x47, 0xD5, 0x27, 0x40, 0xA6, 0x56, 0x31, 0x9D, 0xCE, 0x05, 0xD4, 0xBB, 0x89, 0xF9, 0x73, 0x86,
+    0xDE, 0xA5, 0x2C, 0x95, 0xB6, 0x22, 0x11, 0xD3, 0xB3, 0x55, 0x58, 0x02, 0xB2, 0x1B, 0x5E, 0x62,
+    0xDE, 0xF3, 0x7D, 0x7E, 0xF1, 0x9A, 0x49, 0x9F, 0x2D, 0x19, 0x08, 0x5C, 0x6F, 0xEF, 0x43, 0x85,
+    0x86, 0xA1, 0x43, 0xE2, 0xD6, 0xB8, 0xF1, 0xE0, 0x47, 0x31, 0x48, 0x67, 0xD4, 0x97, 0xE2, 0x34,
+    0xA4, 0xEB, 0x67, 0x9D, 0x2F, 0x5E, 0x5D, 0xED, 0xD9, 0x64, 0x14, 0x9E, 0x33, 0x47, 0xEF, 0xBF,
+    0x71, 0xE2, 0x1C, 0x77, 0x97, 0xFF, 0x21, 0x5E, 0x4D, 0x9C, 0x9B, 0x0A, 0x62, 0xCA, 0xE4, 0x7D,
+    0x3A, 0xEE, 0x37, 0x6F, 0xD3, 0x95, 0x82, 0x23, 0x25, 0x7E, 0x61, 0x11, 0x55, 0x71, 0x05, 0x17,
+    0x6A, 0xDE, 0x3B, 0x50, 0x98, 0x6C, 0xE0, 0x16, 0xBD, 0xAE, 0x43, 0x3C, 0xFF, 0x47, 0xF4, 0xD5,
+    0x2B, 0xA3, 0x39, 0xA4, 0xC4, 0xA8, 0x8B, 0x8F, 0x7B, 0x55, 0x66, 0xC8, 0x99, 0x4C, 0xFE, 0x15,
+    0x32, 0x10, 0x42, 0x65, 0x24, 0xA8, 0x73, 0x90, 0xE9, 0xAA, 0x42, 0x80, 0x94, 0xCB, 0xD4, 0x28,
+    0x33, 0x63, 0x85, 0xF4, 0x44, 0xCE, 0x60, 0x20, 0xAF, 0x30, 0xC4, 0xFC, 0x4B, 0x98, 0x5F, 0xFE,
+    0x84, 0xF7, 0xB9, 0x75, 0x74, 0x49, 0x5A, 0x91, 0xE2, 0x9C, 0x56, 0xCF, 0xD7, 0xDF, 0x06, 0x48,
+    0x34, 0xD1, 0x79, 0x40, 0xCB, 0xD5, 0x70, 0x15, 0x38, 0x78, 0x42, 0x23, 0x02, 0x55, 0x81, 0x4C,
+    0x0F, 0x7D, 0x7F, 0xA6, 0xF6, 0x54, 0x12, 0x75, 0x91, 0xF5, 0xF1, 0x9B, 0x98, 0x46, 0x42, 0x0F,
+    0x81, 0xA5, 0x12, 0xCC, 0xBD, 0x11, 0x42, 0x53, 0x17, 0xFB, 0xC6, 0xED, 0x75, 0x22, 0xF6, 0x82,
+    0x74, 0x67, 0x9E, 0xC4, 0x58, 0x25, 0xF0, 0x5E, 0xFA, 0x13, 0xAF, 0x80, 0xBE, 0xC5, 0x2B, 0xF4,
+    0x36, 0x5E, 0x31, 0xA5, 0x53, 0x63, 0x2C, 0x71, 0x0D, 0xE7, 0x29, 0xFE, 0x3F, 0x8C, 0x34, 0x3E,
+    0x41, 0x4F, 0x62, 0x8E, 0x3A, 0xE6, 0xA8, 0x63, 0x5A, 0x40, 0x8C, 0xC8, 0x82, 0xBF, 0x4A, 0x86,
+    0x16, 0xB4, 0x35, 0x08, 0x5D, 0x28, 0x2A, 0x2E, 0xFA, 0x6B, 0xF9, 0x5A, 0xAC, 0xB2, 0xC6, 0x5F,
+    0x39, 0x46, 0x8F, 0xDE, 0x99, 0x1B, 0x1D, 0x63, 0xA7, 0x29, 0xEF, 0xFE, 0x59, 0x3D, 0x8C, 0x51,
+    0x4C, 0xC6, 0x63, 0x9F, 0x03, 0xB6, 0x13, 0x37, 0x6C, 0xBF, 0x62, 0xC5, 0xCA, 0x52, 0xE8, 0x8C,
+    0x57, 0x07, 0x32, 0x26, 0x3D, 0x5F, 0xB1, 0xE7, 0xE8, 0xE1, 0x13, 0xD7, 0xE7, 0x62, 0xD4, 0x67,
+    0x7C, 0x6B, 0xEF, 0x61, 0x74, 0xCD, 0x37, 0xF4, 0x59, 0xAF, 0x05, 0x83, 0x60, 0x61, 0x07, 0x6C,
+    0xC8, 0xD3, 0x59, 0x28, 0x71, 0x45, 0x1D, 0xAC, 0xE9, 0x58, 0x83, 0x68, 0xD1, 0x66, 0xF2, 0xF1,
+    0x75, 0x93, 0x6E, 0xB1, 0x38, 0x44, 0x50, 0x5C, 0x9D, 0x22, 0x88, 0x66, 0x6C, 0x3D, 0x41, 0x80,
+    0x6C, 0xC2, 0x15, 0x62, 0xCB, 0xBD, 0x3E, 0x68, 0x41, 0xBD, 0xCB, 0xAB, 0xFE, 0x9F, 0x97, 0x67,
+    0x66, 0xBD, 0xD7, 0x49, 0x8E, 0x17, 0x0B, 0x46, 0x28, 0xC5, 0x29, 0x32, 0x32, 0x2B, 0xA6, 0xDB,
+    0xFC, 0xB6, 0x2F, 0xBD, 0x09, 0x60, 0x47, 0x21, 0x63, 0xED, 0xC2, 0xC1, 0x51, 0x37, 0x0E, 0xD3,
+    0xFA, 0xC5, 0xFE, 0xA1, 0xFD, 0x6B, 0x77, 0x10, 0x18, 0xC6, 0x25, 0x9C, 0x82, 0xAB, 0x18, 0x7F,
+    0x8A, 0x1C, 0x6D, 0x8E, 0x14, 0x2D, 0x33, 0xB4, 0x4C, 0x00, 0x5B, 0xA0, 0x0E, 0xCD, 0xF6, 0xC6,
+    0x7F, 0xE3, 0xF0, 0x9A, 0x0C, 0x2A, 0xAE, 0xE4, 0x28, 0xA5, 0xA3, 0x85, 0xC4, 0xB6, 0x99, 0x1C,
+    0xA2, 0xA1, 0xBF, 0x7F, 0x7D, 0x33, 0xED, 0xF3, 0xA9, 0xDE, 0xBB, 0x25, 0x24, 0x68, 0x41, 0xEC,
+    0x40, 0x90, 0x33, 0x9F, 0xAE, 0x5E, 0x72, 0xE8, 0xCF, 0xDB, 0xF5, 0x77, 0x10, 0x8B, 0x17, 0xA9,
+    0xCC, 0x6C, 0x72, 0x94, 0xE9, 0xD7, 0xC2, 0x6B, 0x71, 0xF0, 0x9E, 0xA3, 0x0D, 0xBA, 0x7C, 0x93,
+    0x8B, 0x90, 0x5F, 0x82, 0x3C, 0xCE, 0x06, 0x0F, 0xA0, 0xD4, 0x7A, 0xA5, 0x19, 0x66, 0xA2, 0x48,
+    0x17, 0x91, 0xC2, 0xD5, 0xF1, 0x45, 0x20, 0x57, 0xCE, 0x6D, 0xE5, 0xE1, 0x62, 0xC1, 0xB8, 0xFA,
+    0x14, 0x31, 0x00, 0xC4, 0x59, 0xA6, 0x77, 0x91, 0xE3, 0x4F, 0x5A, 0x30, 0xA5, 0x35, 0x1A, 0x12,
+    0x8D, 0x74, 0xF4, 0x4C, 0x63, 0x82, 0x6B, 0xA5, 0xCC, 0xD1, 0xA5, 0x5C, 0xFC, 0x02, 0xED, 0xF4,
+    0x95, 0x6E, 0x0E, 0x69, 0x73, 0x9F, 0x69, 0x78, 0x6D, 0x58, 0x5E, 0x28, 0x43, 0xD1, 0x1A, 0xBE,
+    0xBD, 0x11, 0xD4, 0x98, 0x76, 0x38, 0x09, 0xF5, 0x0B, 0xCA, 0x0A, 0x65, 0x4B, 0x65, 0x95, 0xB2,
+    0x95, 0xB2, 0x86, 0xEC, 0x13, 0x4B, 0xF6, 0x6B, 0x54, 0xFA, 0x99, 0xFC, 0x3E, 0x82, 0x74, 0x93,
+    0xFF, 0x16, 0x51, 0x3A, 0xEF, 0x36, 0xB2, 0x74, 0x45, 0x16, 0x37, 0x64, 0xA1, 0x25, 0xF3, 0xED,
+    0x5F, 0x83, 0x4D, 0xED, 0x7D, 0xB0, 0x89, 0xFD, 0x0C, 0xCC, 0xD8, 0xAF, 0xC8, 0xD2, 0x63, 0xB2,
+    0xD8, 0x92, 0x85, 0xCA, 0x7C, 0x65, 0x53, 0x65, 0x13, 0x65, 0xC6, 0x31, 0x56, 0xDC, 0x4C, 0x80,
+    0x7A, 0x61, 0x35, 0x70, 0x3E, 0x10, 0x26, 0x7B, 0xCD, 0xAC, 0x60, 0x70, 0x3D, 0x36, 0xB4, 0x97,
+    0x5C, 0x3F, 0x32, 0xE9, 0x6F, 0x64, 0x9D, 0x4C, 0xFF, 0x68, 0x6D, 0x4D, 0x98, 0x87, 0x28, 0x0F,
+    0x41, 0x1E, 0x62, 0x3C, 0x84, 0x78, 0x88, 0xED, 0x28, 0xA9, 0x5F, 0x8C, 0x5C, 0x6E, 0x69, 0x6E,
+    0xBE, 0xAE, 0xDC, 0xD1, 0x8A, 0x4F, 0xB5, 0xA7, 0x50, 0x21, 0xF7, 0x50, 0x4D, 0x28, 0x22, 0x6C,
+    0xCA, 0x90, 0xAE, 0x5F, 0x6D, 0xB7, 0x26, 0xE4, 0x33, 0xFE, 0x18, 0xD7, 0x19, 0xF8, 0x2B, 0x1E,
+    0x4D, 0xA2, 0xEB, 0x9D, 0x15, 0x7A, 0x29, 0xCC, 0x5D, 0xC2, 0xF4, 0xE9, 0xC5, 0x30, 0x7F, 0x69,
+    0x5C, 0x06, 0xD3, 0xE5, 0x30, 0x5D, 0x16, 0x73, 0x94, 0xC7, 0xBC, 0xEC, 0xF7, 0xC5, 0x38, 0x01,
+    0xFA, 0x1B, 0x78, 0x52, 0x27, 0xE7, 0x27, 0x40, 0xB7, 0xA6, 0xB2, 0x99, 0x5D, 0xC7, 0x4C, 0x7D,
+    0x56, 0xA7, 0x37, 0xAC, 0xD3, 0xF6, 0x35, 0x47, 0xA7, 0xA2, 0x32, 0xFF, 0x58, 0x94, 0x13, 0x2F,
+    0xF3, 0xDF, 0x8B, 0xF3, 0xB4, 0x87, 0x80, 0x9D, 0xEE, 0xBC, 0x7D, 0x84, 0x51, 0xE4, 0x84, 0x64,
+    0x4D, 0xDE, 0xB0, 0xA8, 0x41, 0x7C, 0x40, 0xD4, 0xC0, 0x4A, 0x84, 0x11, 0x28, 0x5A, 0xF3, 0x8A,
+    0xD9, 0x53, 0x4C, 0x61, 0xD3, 0x06, 0x5A, 0x65, 0xD6, 0x99, 0x42, 0xA6, 0xA6, 0x40, 0xE5, 0x3F,
+    0x70, 0xCA, 0xB7, 0xAA, 0xF5, 0xB4, 0x55, 0x1B, 0x50, 0xE5, 0x07, 0xAA, 0xF5, 0x99, 0x6A, 0x7D,
+    0x62, 0x9F, 0xA8, 0xF2, 0x55, 0x97, 0xA9, 0xB2, 0x48, 0x59, 0xA0, 0x6C, 0x76, 0xAE, 0xD6, 0x63,
+    0x65, 0x91, 0xB2, 0x40, 0xD9, 0x54, 0xE5, 0xBD, 0xC9, 0x34, 0x83, 0xF6, 0x30, 0xD7, 0xB2, 0x69,
+    0xAD, 0xA4, 0xB3, 0x76, 0x7C, 0x3B, 0xDC, 0xFB, 0xD3, 0x69, 0xD3, 0xA8, 0xBE, 0xC1, 0x34, 0xEA,
+    0x97, 0xBA, 0x9B, 0x4F, 0x11, 0x44, 0x0C, 0xD7, 0xF2, 0xD6, 0x95, 0x21, 0x86, 0xD0, 0x3B, 0x56,
+    0x41, 0x31, 0x9B, 0xC4, 0x5C, 0x7C, 0x7F, 0x89, 0x97, 0x73, 0x05, 0x0C, 0x59, 0x78, 0xC1, 0xBA,
+    0x00, 0x07, 0x82, 0x23, 0x25, 0xDF, 0x7D, 0x68, 0x51, 0xF5, 0xB6, 0x94, 0xCF, 0x99, 0xA5, 0x0A,
+    0xB5, 0x36, 0xDE, 0xB7, 0x59, 0xCA, 0xCA, 0xC7, 0x22, 0x27, 0xC8, 0x51, 0x20, 0x5F, 0x35, 0x61,
+    0x99, 0xDF, 0x9A, 0x95, 0x0E, 0x42, 0x18, 0xFD, 0x85, 0x10, 0x56, 0xCF, 0x74, 0xBF, 0x4B, 0xB5,
+    0xC2, 0xDE, 0xB5, 0xE9, 0xAE, 0xC0, 0xD4, 0x15, 0x70, 0xA7, 0xEE, 0xA7, 0x1A, 0x89, 0xBB, 0x40,
+    0xDD, 0x6A, 0x61, 0x31, 0xEB, 0xA5, 0xA5, 0x87, 0x0C, 0xD7, 0x3D, 0x8E, 0x04, 0xD0, 0x28, 0xAB,
+    0x2A, 0x8A, 0x4D, 0xAA, 0x9F, 0xF7, 0xE3, 0x3C, 0x54, 0xE0, 0x92, 0xFA, 0xE3, 0x04, 0x85, 0x31,
+    0x06, 0xF6, 0x0B, 0x19, 0xA2, 0x44, 0x78, 0x12, 0x09, 0x46, 0xEB, 0x62, 0xB4, 0x84, 0xC1, 0x13,
+    0xE8, 0xD4, 0x66, 0xE7, 0x50, 0xA4, 0xA6, 0x80, 0xF9, 0xF8, 0xDC, 0x33, 0x10, 0xA0, 0x24, 0x2D,
+    0x13, 0x65, 0xCF, 0x98, 0x18, 0xF1, 0x18, 0xC8, 0xB8, 0x3E, 0xF8, 0xBA, 0xC1, 0x84, 0x53, 0x7F,
+    0x20, 0x53, 0x4C, 0x42, 0xB0, 0x2F, 0x37, 0x7D, 0x16, 0x1D, 0xFD, 0x68, 0x46, 0x5B, 0x50, 0x5C,
+    0x22, 0x7D, 0x9C, 0x49, 0xFF, 0x56, 0xE8, 0x88, 0x79, 0x76, 0xD3, 0x71, 0x9B, 0x44, 0xFE, 0x10,
+    0xCE, 0xB7, 0xC6, 0xB6, 0x81, 0xD5, 0x7D, 0x38, 0x8A, 0x6B, 0x8E, 0xC7, 0xFC, 0xE6, 0xF5, 0x65,
+    0x16, 0xFF, 0xBC, 0x60, 0x79, 0x35, 0x2A, 0x0C, 0xE5, 0x64, 0x8D, 0xC8, 0x56, 0x91, 0xA6, 0x3E,
+    0x53, 0xD6, 0x33, 0x27, 0x9C, 0x1F, 0xAE, 0x7E, 0xEB, 0xF4, 0x75, 0xED, 0x0E, 0xB0, 0x99, 0x78,
+    0x45, 0x64, 0xBE, 0x84, 0x64, 0xEC, 0x2F, 0x50, 0xF4, 0xD1, 0xA2, 0x0E, 0xD7, 0xAF, 0x83, 0x25,
+    0x00, 0xF8, 0xB7, 0x4D, 0x5F, 0x43, 0x67, 0x34, 0x0B, 0xA8, 0x43, 0xEB, 0x0B, 0x30, 0x6D, 0xBF,
+    0xEB, 0x86, 0x6F, 0xA8, 0x08, 0x2D, 0x4A, 0x2D, 0x34, 0x44, 0x8B, 0xAC, 0x4B, 0xB9, 0x03, 0xA1,
+    0xE0, 0x9B, 0x74, 0x78, 0x53, 0x8F, 0xEA, 0xB0, 0x86, 0xCA, 0xAA, 0xDC, 0x15, 0x4D, 0x3F, 0xF3,
+    0x0D, 0xEB, 0xB3, 0xEA, 0xD3, 0xED, 0xA0, 0x80, 0x7D, 0xF3, 0x5A, 0x40, 0xA2, 0xF8, 0x46, 0xC1,
+    0x37, 0xE2, 0x96, 0x47, 0x7F, 0x8B, 0xB0, 0xD1, 0x0C, 0x7D, 0x1E, 0x46, 0xB1, 0x1E, 0xD7, 0xA4,
+    0x7F, 0x63, 0x76, 0xF6, 0xD7, 0xC5, 0x5A, 0xD7, 0x8F, 0x39, 0x9E, 0x6E, 0x02, 0x15, 0x40, 0x18,
+    0x9F, 0xD8, 0x5E, 0xED, 0x38, 0x39, 0x90, 0x05, 0xCA, 0x1E, 0x89, 0xA9, 0x41, 0x2F, 0xA8, 0x4B,
+    0x58, 0xA2, 0x88, 0x0B, 0x70, 0x5F, 0x49, 0xED, 0x64, 0x28, 0x26, 0x80, 0x82, 0x1E, 0x2E, 0x72,
+    0x89, 0xC9, 0xF5, 0x87, 0xE7, 0xBC, 0x89, 0x6B, 0x6C, 0x93, 0x32, 0xAE, 0x52, 0x3A, 0x33, 0xAE,
+    0x48, 0xBA, 0x30, 0xAE, 0x4C, 0xBA, 0xE4, 0x70, 0x6E, 0x61, 0xF1, 0x9F, 0x15, 0x33, 0x77, 0xF5,
+    0x62, 0xD2, 0xBF, 0x81, 0x94, 0x7E, 0xC1, 0x37, 0x32, 0x54, 0x51, 0x67, 0xEB, 0xF4, 0x38, 0xD7,
+    0x72, 0x84, 0x8C, 0xB7, 0xD0, 0x08, 0x50, 0x2F, 0xFB, 0xFD, 0x0E, 0x66, 0xD6, 0x98, 0x8D, 0xED,
+    0x3B, 0x28, 0x6C, 0x4F, 0x68, 0x77, 0xAD, 0x5A, 0x75, 0xD6, 0x97, 0xB7, 0x1F, 0xE7, 0xDC, 0x03,
+    0x86, 0xC4, 0x12, 0x12, 0xD7, 0xA4, 0x71, 0x33, 0xA2, 0xFA, 0x79, 0xCD, 0x73, 0x2A, 0x9E, 0xBF,
+    0x5C, 0xB7, 0xD0, 0x0E, 0xA9, 0xD8, 0xE3, 0x1C, 0x88, 0x71, 0x85, 0x35, 0x97, 0xC1, 0xBF, 0xB1,
+    0x44, 0x5B, 0x59, 0x71, 0xED, 0xB6, 0x99, 0x01, 0x46, 0xD1, 0xF6, 0x81, 0x12, 0xA0, 0xEB, 0x2C,
+    0x7B, 0xCF, 0xB4, 0x04, 0xDE, 0x00, 0xD9, 0xF2, 0xF8, 0xBE, 0xE0, 0xFA, 0x8D, 0x92, 0x7D, 0x54,
+    0x4D, 0xEC, 0x0D, 0x3E, 0x66, 0x95, 0x2E, 0x45, 0xDC, 0x9F, 0x89, 0x80, 0x4F, 0xE8, 0x49, 0xC8,
+    0x71, 0xB4, 0x0F, 0x9F, 0x9B, 0xE5, 0x1D, 0xAB, 0x17, 0x80, 0x38, 0x2E, 0x81, 0x54, 0xCE, 0x44,
+    0x29, 0x8A, 0xA8, 0x6E, 0xA0, 0xC6, 0xCD, 0x29, 0xD4, 0xF8, 0x75, 0xC8, 0xAA, 0x7F, 0x5D, 0xBB,
+    0xA3, 0xAA, 0x41, 0xF1, 0x04, 0x20, 0x52, 0x84, 0x6E, 0xA8, 0x39, 0x42, 0xAA, 0xFB, 0xCA, 0xA1,
+    0xB9, 0x76, 0x0B, 0xBB, 0x99, 0x08, 0x86, 0xFC, 0xA3, 0x4E, 0xEE, 0x84, 0x33, 0xB9, 0x76, 0x07,
+    0x1C, 0xCF, 0x7A, 0x2B, 0xC8, 0x25, 0x90, 0xFF, 0x8D, 0xCC, 0xDC, 0x4C, 0xA2, 0x5A, 0x5C, 0x5E,
+    0xBF, 0x93, 0x88, 0x6F, 0xE2, 0xD2, 0x21, 0xC4, 0x74, 0xC6, 0xF5, 0x41, 0x3B, 0xFB, 0xBB, 0x0D,
+    0xB6, 0xA7, 0x09, 0x59, 0x61, 0x3E, 0xEF, 0x38, 0xA9, 0x93, 0x74, 0x07, 0xDC, 0x46, 0xA3, 0xB7,
+    0x2A, 0xEB, 0x3B, 0xB9, 0xD3, 0xEE, 0x05, 0x89, 0x4B, 0x2C, 0x71, 0x93, 0x4E, 0xDE, 0x43, 0x55,
+    0x2C, 0x4A, 0x22, 0x12, 0xBA, 0x33, 0xC8, 0xF6, 0xBA, 0x5B, 0xC0, 0xCA, 0x69, 0x5F, 0xE0, 0x23,
+    0x71, 0xE2, 0x43, 0x5B, 0xC8, 0x22, 0xE3, 0x27, 0xA7, 0xAA, 0x4E, 0x59, 0x60, 0xC5, 0xE9, 0x28,
+    0xB0, 0x0C, 0x52, 0x98, 0xE6, 0x56, 0xAF, 0xD9, 0xF6, 0x5B, 0x93, 0x42, 0x2D, 0x34, 0x1B, 0x10,
+    0xBB, 0x54, 0xC9, 0x3F, 0xE0, 0xCF, 0x54, 0x66, 0xE2, 0x12, 0xBE, 0x7D, 0x01, 0x92, 0xC4, 0xD0,
+    0xC1, 0x8C, 0xAD, 0xE8, 0xAC, 0x7B, 0x6D, 0xD1, 0x03, 0x4A, 0x9A, 0xEF, 0xCB, 0x1C, 0x84, 0x4B,
+    0x4F, 0x61, 0xD4, 0xE7, 0x2E, 0xD1, 0x1D, 0xC7, 0x01, 0x96, 0x87, 0x08, 0xEF, 0xE2, 0x56, 0x04,
+    0x2B, 0x97, 0xFA, 0x8E, 0x1A, 0x21, 0xA5, 0x1E, 0x6B, 0x8D, 0xA8, 0xB4, 0x32, 0xA5, 0x9A, 0x39,
+    0x33, 0xEE, 0x72, 0x65, 0x8D, 0x6C, 0x1F, 0x1E, 0x8A, 0xCA, 0xFE, 0x4A, 0xF7, 0x45, 0x58, 0xAB,
+    0xE9, 0x8C, 0x18, 0x27, 0xEB, 0xF6, 0x1F, 0x96, 0xD1, 0xEE, 0xC2, 0x77, 0x09, 0x54, 0x97, 0xD0,
+    0xEA, 0x63, 0xC4, 0xDF, 0xD0, 0xB4, 0x98, 0x43, 0x26, 0xFD, 0xEE, 0xE1, 0xAD, 0xB7, 0x49, 0x92,
+    0xDC, 0x18, 0x99, 0x6A, 0x4B, 0x18, 0xBE, 0xF8, 0x89, 0x41, 0x83, 0x3C, 0x40, 0x39, 0x6D, 0xC7,
+    0x55, 0x4C, 0xDB, 0x95, 0xE4, 0xDB, 0x24, 0x26, 0x26, 0x96, 0xB8, 0xE5, 0xD8, 0xE7, 0x14, 0xC9,
+    0xC2, 0x3B, 0x94, 0xE0, 0x7D, 0x37, 0xED, 0x91, 0x58, 0x0E, 0x9D, 0xF9, 0x9C, 0xAD, 0x89, 0x29,
+    0xE4, 0x52, 0x5F, 0xF6, 0x77, 0xB1, 0xA7, 0xDB, 0x8C, 0xA5, 0xE9, 0xEF, 0xDB, 0x44, 0x31, 0x5B,
+    0x2D, 0x50, 0xC3, 0xE6, 0x38, 0xCC, 0xA2, 0x87, 0xBA, 0x25, 0x94, 0x2E, 0x25, 0x40, 0x01, 0xDD,
+    0x30, 0xCA, 0xAD, 0xA3, 0xEB, 0xF9, 0xF3, 0x2D, 0x32, 0xCC, 0x8B, 0xCE, 0x93, 0xDB, 0x35, 0xCC,
+    0x98, 0x4B, 0x42, 0x6A, 0xFB, 0x5E, 0x6F, 0xD2, 0x1E, 0xDB, 0x7E, 0xB3, 0x34, 0xD6, 0x95, 0x30,
+    0x59, 0x6F, 0xC6, 0xD4, 0xB2, 0x52, 0x75, 0xE1, 0x7C, 0xC5, 0x25, 0xB8, 0x9D, 0x82, 0xDF, 0xAA,
+    0x1B, 0xC9, 0x52, 0x18, 0x2C, 0xBC, 0x05, 0x0D, 0xDC, 0xB3, 0x9F, 0x1F, 0xF8, 0x96, 0xFB, 0xDC,
+    0x79, 0x7C, 0xCF, 0x1E, 0xDF, 0xD1, 0xC2, 0xC0, 0x8B, 0x1C, 0x28, 0x71, 0xA9, 0xFF, 0xC2, 0xE8,
+    0x96, 0x09, 0xC8, 0x10, 0x2E, 0x2E, 0x3C, 0x04, 0xB7, 0x31, 0x1E, 0xFD, 0x04, 0xAA, 0x86, 0x1E,
+    0xF9, 0xFA, 0x9D, 0x6F, 0x91, 0xD9, 0x4E, 0xBC, 0x7E, 0x7B, 0x65, 0x48, 0x87, 0x20, 0x2F, 0x9D,
+    0xCE, 0x88, 0x2D, 0x9D, 0xB3, 0xBD, 0xF2, 0x32, 0xE8, 0x83, 0x48, 0x6F, 0x0F, 0x06, 0x1B, 0xE7,
+    0x6B, 0x41, 0xE2, 0xC0, 0x83, 0xE3, 0x02, 0xBE, 0x56, 0x5A, 0x78, 0x87, 0x6E, 0x62, 0x81, 0xE4,
+    0xB9, 0x8F, 0xB2, 0x59, 0xE7, 0xCC, 0x41, 0xA1, 0x01, 0xB7, 0x38, 0xBF, 0x30, 0xA5, 0xB3, 0x04,
+    0xCD, 0xF4, 0xF0, 0x5A, 0xEF, 0x4B, 0xE9, 0x7E, 0x4F, 0x5A, 0xC9, 0xFC, 0x95, 0x48, 0xD5, 0x5B,
+    0xD8, 0xE3, 0x43, 0x86, 0x4A, 0xD5, 0x39, 0xF4, 0x15, 0x48, 0xF5, 0x39, 0xED, 0x35, 0xD2, 0x6C,
+    0xF7, 0x70, 0x5C, 0xCC, 0x5E, 0xE7, 0x28, 0xBF, 0xF3, 0x58, 0xEC, 0x36, 0x43, 0x32, 0xCB, 0xDE,
+    0x53, 0x54, 0xA1, 0x30, 0xD3, 0x23, 0x80, 0xAE, 0xB3, 0x12, 0x3E, 0x87, 0x97, 0x98, 0xB5, 0xFF,
+    0x59, 0x62, 0x7A, 0x63, 0x18, 0xBA, 0x25, 0xCA, 0x0D, 0x4F, 0xA8, 0x65, 0x12, 0xB7, 0x35, 0x46,
+    0xC4, 0xB9, 0x8C, 0xEC, 0xE7, 0xEF, 0xDB, 0x22, 0x18, 0x82, 0xEF, 0xC1, 0x79, 0xBD, 0xCE, 0xA8,
+    0x55, 0xBD, 0x10, 0x2F, 0x91, 0x71, 0xC5, 0xF5, 0x14, 0x45, 0x2F, 0xFF, 0x5A, 0x4E, 0x58, 0xCC,
+    0x2A, 0x63, 0xCA, 0xA6, 0x95, 0xDF, 0x0D, 0x75, 0x7E, 0x9C, 0xF3, 0x76, 0xE6, 0x2F, 0x03, 0xA2,
+    0x0A, 0x09, 0x01, 0xC5, 0x46, 0x00, 0x65, 0xD3, 0x2E, 0xB6, 0x3F, 0xB0, 0xA8, 0x67, 0xB5, 0x9D,
+    0xF4, 0xEF, 0xA4, 0x93, 0xBB, 0xFA, 0x81, 0x44, 0xED, 0xDD, 0xB4, 0x53, 0x67, 0x44, 0xE1, 0xC3,
+    0xA1, 0x6C, 0x64, 0xA0, 0x23, 0x58, 0xF1, 0xD2, 0x48, 0xF8, 0x99, 0xFB, 0x51, 0xB7, 0x2C, 0xD7,
+    0x8F, 0xB8, 0x2F, 0x25, 0xA7, 0x2B, 0x83, 0x0A, 0x53, 0xAD, 0x27, 0xE5, 0x34, 0xC3, 0xE4, 0x94,
+    0x06, 0x7A, 0xE6, 0xB2, 0x59, 0xF1, 0xC4, 0xED, 0x6D, 0x0D, 0xDD, 0xDE, 0xD6, 0xFC, 0x29, 0x7B,
+    0x5B, 0xB7, 0x2C, 0x6D, 0x05, 0x18, 0xFA, 0x67, 0xBA, 0x70, 0x13, 0xFD, 0xA7, 0xC4, 0x31, 0x8B,
+    0x8F, 0x06, 0xEA, 0x7F, 0xD1, 0x0C, 0xDF, 0xEA, 0xC4, 0xBC, 0xDE, 0x89, 0x7B, 0x79, 0x6C, 0x9C,
+    0x31, 0xFA, 0x44, 0x41, 0x65, 0x69, 0x21, 0xF8, 0x1D, 0x32, 0x22, 0x49, 0xE3, 0x08, 0xFF, 0xF4,
+    0x15, 0x32, 0x2D, 0xDC, 0xC9, 0x6F, 0x40, 0x1D, 0x57, 0xEE, 0x22, 0xC6, 0x89, 0x9A, 0x78, 0x78,
+    0x62, 0x83, 0xFD, 0x58, 0x86, 0xE0, 0x59, 0xAC, 0xBC, 0xD3, 0x15, 0xB6, 0xD5, 0x78, 0xC9, 0xCE,
+    0xE5, 0x9B, 0xC2, 0x6F, 0xDC, 0xB9, 0x79, 0x88, 0x9E, 0x2E, 0x8D, 0xFD, 0x25, 0x1E, 0x34, 0x20,
+    0x0E, 0xFE, 0xAC, 0x91, 0x98, 0x3D, 0x28, 0x65, 0x61, 0xDC, 0x19, 0xF0, 0xD9, 0xED, 0x4A, 0xFB,
+    0x6D, 0x97, 0x1E, 0xEE, 0x34, 0xDD, 0x5F, 0xAC, 0x0F, 0x66, 0xF2, 0xDA, 0xF5, 0x73, 0xA5, 0x26,
+    0xFA, 0xDE, 0x1E, 0xF0, 0x9E, 0xD4, 0x6D, 0x61, 0x8D, 0xCB, 0x00, 0x6F, 0x53, 0x8A, 0x7C, 0xAE,
+    0x55, 0xC8, 0x28, 0x33, 0xE9, 0x1F, 0x25, 0xA5, 0xE1, 0xDD, 0xFF, 0xB8, 0xFC, 0xBF, 0x3E, 0xD6,
+    0x64, 0xF7, 0x4E, 0xFF, 0x04, 0x20, 0x33, 0x7A, 0xF2, 0x95, 0x71, 0xA1, 0x9D, 0x16, 0x0B, 0x3C,
+    0x6A, 0x7B, 0x7C, 0xFE, 0xE7, 0x5A, 0x4A, 0x00, 0x30, 0x2D, 0x55, 0x14, 0x70, 0xF4, 0x7C, 0xA0,
+    0xB5, 0xED, 0x4F, 0x64, 0x0A, 0x9D, 0xB1, 0xD8, 0x75, 0x4A, 0x98, 0x18, 0x71, 0x14, 0x60, 0xC3,
+    0xA0, 0x33, 0x04, 0x9F, 0x4B, 0xA4, 0x9F, 0x63, 0x75, 0xD8, 0x25, 0x2E, 0x23, 0x8C, 0x5D, 0x81,
+    0x85, 0x78, 0x57, 0xB3, 0x12, 0xB2, 0x65, 0x6E, 0x34, 0x66, 0x12, 0x35, 0x3A, 0x61, 0x28, 0x86,
+    0xA0, 0xEA, 0x8F, 0x7C, 0x87, 0xE7, 0x4B, 0x3C, 0x68, 0x71, 0x29, 0x3C, 0xDC, 0xE5, 0xBE, 0x35,
+    0xCC, 0x5C, 0x24, 0x39, 0xDE, 0x01, 0xE4, 0xCB, 0xA4, 0xA7, 0xDF, 0xA7, 0x5B, 0xF6, 0xB1, 0xF0,
+    0x9F, 0x63, 0x81, 0x12, 0xFB, 0x36, 0xF6, 0x3E, 0xE3, 0xDA, 0x07, 0xAC, 0x60, 0x40, 0x57, 0x3F,
+    0xEB, 0x4C, 0xCA, 0x2C, 0x51, 0xFA, 0x95, 0x74, 0xE8, 0x77, 0x2C, 0xB2, 0x79, 0x22, 0xCE, 0x1B,
+    0x47, 0x1C, 0x9F, 0x60, 0x47, 0x8C, 0x86, 0xA9, 0x2B, 0x4D, 0xD7, 0x0A, 0x45, 0x72, 0x64, 0x65,
+    0x74, 0xB2, 0x0A, 0x1C, 0x80, 0x58, 0xE9, 0x0C, 0x45, 0xE9, 0xF5, 0x01, 0xD1, 0x72, 0x28, 0xAF,
+    0xD5, 0xC7, 0x46, 0xC1, 0x51, 0xEE, 0xB3, 0x1C, 0x99, 0x96, 0x0B, 0xB0, 0x96, 0x4D, 0x02, 0xAB,
+    0x90, 0x92, 0x8E, 0x97, 0xB3, 0x3E, 0x27, 0x32, 0x4A, 0xF4, 0x4A, 0x98, 0xB2, 0x77, 0x00, 0xB3,
+    0x21, 0x14, 0x18, 0xB4, 0x22, 0x90, 0x14, 0xFB, 0xB7, 0x81, 0x35, 0x5A, 0xDD, 0x34, 0x8F, 0x30,
+    0x73, 0x15, 0x34, 0x1E, 0xE2, 0xDF, 0x3A, 0x68, 0x27, 0x5D, 0x9E, 0xA5, 0xE2, 0x81, 0x4D, 0xDB,
+    0xB4, 0xC8, 0xCB, 0x99, 0xCC, 0x50, 0x71, 0x81, 0x54, 0xFD, 0x0F, 0x9B, 0x78, 0x89, 0xB2, 0x8D,
+    0x0F, 0x56, 0xD1, 0xA7, 0x80, 0xF3, 0x3F, 0xA8, 0xC3, 0x2F, 0x81, 0x4C, 0xFE, 0x47, 0x15, 0x7C,
+    0x05, 0xDF, 0x82, 0x5C, 0x7A, 0xF9, 0x49, 0xE9, 0x3F, 0x11, 0x41, 0xA4, 0x8F, 0x97, 0xB3, 0x93,
+    0x96, 0xD8, 0xC4, 0x54, 0x23, 0x08, 0xE5, 0x11, 0xF8, 0x8A, 0x09, 0x8F, 0x89, 0x86, 0xC3, 0x89,
+    0x6E, 0xA4, 0xDF, 0xDC, 0xD0, 0x96, 0x6C, 0x6E, 0x68, 0x4B, 0x4F, 0x6F, 0x68, 0x03, 0x4A, 0x18,
+    0x35, 0x84, 0x7D, 0x1B, 0xD6, 0x76, 0xA3, 0x88, 0xD9, 0xC3, 0x9E, 0x15, 0xB9, 0xDD, 0xE4, 0x0A,
+    0xC5, 0x0C, 0xED, 0x2F, 0x15, 0x1D, 0x05, 0x3E, 0x99, 0xD7, 0x40, 0x0C, 0xF8, 0xFC, 0x34, 0x13,
+    0xB5, 0x5C, 0x29, 0x14, 0x59, 0x71, 0x05, 0xFA, 0xB8, 0xA2, 0x67, 0xD5, 0xC4, 0x47, 0x4F, 0x1B,
+    0x8A, 0x5F, 0x9C, 0x7A, 0xDC, 0x73, 0x38, 0x75, 0x3A, 0xA6, 0x1D, 0x9C, 0xD0, 0x6A, 0x96, 0xB4,
+    0x31, 0xC2, 0x84, 0xA3, 0x3D, 0x87, 0x08, 0x28, 0xE7, 0x49, 0x5E, 0x33, 0x8D, 0x37, 0xCA, 0x87,
+    0x85, 0x7C, 0x10, 0x8A, 0x58, 0x71, 0xD0, 0x31, 0x31, 0x06, 0x3C, 0x0F, 0x49, 0x32, 0x9C, 0x80,
+    0x34, 0x4F, 0x01, 0x3C, 0xC3, 0x2E, 0x61, 0x0C, 0x79, 0x49, 0x77, 0xF5, 0x7F, 0x89, 0x50, 0x7C,
+    0x49, 0x84, 0xE6, 0x89, 0x96, 0xC1, 0x6B, 0x45, 0xBC, 0xCA, 0x76, 0xBC, 0xE8, 0x8F, 0x9F, 0xA5,
+    0x54, 0xF6, 0xEB, 0xA8, 0x3E, 0x54, 0x0A, 0x9A, 0x41, 0xA9, 0x81, 0xA2, 0x13, 0xCD, 0x70, 0x4B,
+    0xB3, 0x00, 0x90, 0xA5, 0x25, 0xC3, 0x2B, 0x2C, 0x01, 0x02, 0xC5, 0x95, 0x22, 0xE8, 0x58, 0xE3,
+    0xA2, 0x0A, 0xA3, 0xDB, 0xCD, 0x76, 0xB3, 0xCD, 0x7B, 0xFB, 0xED, 0xD7, 0x9A, 0x3E, 0x3B, 0x4E,
+    0xAB, 0xE6, 0x5C, 0x39, 0x95, 0x7E, 0xCE, 0x61, 0x6B, 0x6A, 0xC2, 0x3B, 0x18, 0x3D, 0x26, 0xD2,
+    0xE1, 0x46, 0xA7, 0x68, 0xA4, 0x99, 0xC8, 0x5E, 0x50, 0xDA, 0x2D, 0x0A, 0x5A, 0xF3, 0x1F, 0x8A,
+    0x78, 0x04, 0xA3, 0x44, 0x17, 0x77, 0xFF, 0x7A, 0xEE, 0x94, 0x62, 0x40, 0xFA, 0xC2, 0xEE, 0xCC,
+    0x29, 0xE5, 0x48, 0x45, 0xDA, 0x87, 0xC5, 0x62, 0x91, 0xF1, 0xBA, 0xC5, 0x59, 0x7A, 0x51, 0x9C,
+    0x7A, 0x0F, 0x81, 0x01, 0xA2, 0xEB, 0x4D, 0x32, 0x3C, 0xBB, 0x4A, 0x71, 0xF9, 0xD2, 0x5D, 0x9A,
+    0x57, 0xE6, 0xD8, 0x38, 0x34, 0x6D, 0xB8, 0x70, 0x9D, 0x0E, 0x75, 0xC7, 0xC5, 0x7C, 0xCE, 0x2C,
+    0x78, 0x62, 0x37, 0x49, 0xFF, 0x68, 0xB6, 0xB4, 0x3C, 0xF3, 0xC0, 0x2E, 0xD2, 0x68, 0xD3, 0x66,
+    0x2E, 0x83, 0x88, 0xF1, 0x24, 0x19, 0x3E, 0x4A, 0x46, 0xFB, 0xC2, 0x3C, 0x06, 0xF7, 0x06, 0x8D,
+    0x1E, 0x27, 0xB3, 0x4D, 0x11, 0xF7, 0x10, 0x56, 0x11, 0x72, 0x67, 0xC1, 0x69, 0x08, 0xCB, 0x3B,
+    0x0D, 0x61, 0xBD, 0xFD, 0x22, 0xBE, 0x28, 0x14, 0xBB, 0x3D, 0x2B, 0xBE, 0x76, 0x97, 0xF5, 0xD1,
+    0x22, 0xD7, 0x22, 0x54, 0x81, 0xF1, 0x0A, 0xDC, 0xCB, 0xF1, 0x9A, 0x8E, 0xFF, 0x07, 0xED, 0x5C,
+    0xBF, 0x93, 0xE4, 0xD6, 0x71, 0x7E, 0x98, 0xE1, 0xEE, 0xB8, 0x38, 0xE5, 0x82, 0x03, 0xAE, 0xCB,
+    0xE2, 0x05, 0x48, 0x1C, 0x9D, 0x03, 0xA4, 0x76, 0xE0, 0x02, 0x2C, 0x57, 0x39, 0x51, 0xB2, 0xC1,
+    0x8E, 0x5C, 0x65, 0x06, 0x4E, 0x1C, 0x2D, 0x83, 0xFD, 0x0B, 0x6C, 0x8C, 0xCB, 0x7F, 0x80, 0x96,
+    0x81, 0xF2, 0x75, 0xD5, 0x05, 0xE4, 0x28, 0xB8, 0xC4, 0x81, 0x02, 0xC9, 0x18, 0x89, 0xA1, 0x92,
+    0x91, 0x1C, 0x28, 0x50, 0xE0, 0x51, 0xF1, 0x68, 0xBB, 0xC8, 0x80, 0xB0, 0x05, 0x9A, 0xD8, 0x5D,
+    0x0C, 0x9E, 0xFB, 0xFB, 0xBA, 0x1F, 0x06, 0xB3, 0x3B, 0xC7, 0xE3, 0x1D, 0x79, 0xBF, 0x96, 0xDE,
+    0xBA, 0xE9, 0xD7, 0x37, 0x83, 0x1F, 0xEF, 0x75, 0xBF, 0xD7, 0xAF, 0xFB, 0xEB, 0x06, 0x9C, 0xC3,
+    0xDF, 0xE9, 0x39, 0x1B, 0xE7, 0x2B, 0x17, 0x95, 0x7E, 0xED, 0xE4, 0x5F, 0xE2, 0xBD, 0x77, 0x7E,
+    0xE5, 0x4A, 0x69, 0x7F, 0xE5, 0x97, 0x23, 0x69, 0xFC, 0xB5, 0xCF, 0xA7, 0xBE, 0xFB, 0x91, 0xF7,
+    0x9D, 0x8B, 0xF9, 0x53, 0xE3, 0x52, 0xEF, 0xE4, 0xD0, 0x95, 0xCB, 0x36, 0xCE, 0x4D, 0xFD, 0xDC,
+    0x15, 0xAD, 0x73, 0x13, 0xBF, 0x74, 0x65, 0xE3, 0xDC, 0x18, 0x6D, 0xED, 0xDC, 0x48, 0x7E, 0x97,
+    0x2B, 0xF7, 0x6D, 0x84, 0x3B, 0xEC, 0x69, 0xF1, 0x7B, 0x38, 0x3E, 0x9C, 0x8F, 0xEB, 0xA1, 0x0D,
+    0xD7, 0xD7, 0xFB, 0xE5, 0x72, 0x7F, 0xF9, 0xCD, 0xE3, 0xBB, 0xEE, 0x5D, 0xBF, 0xC1, 0x31, 0xF2,
+    0xD7, 0x60, 0x08, 0xF2, 0xB7, 0x96, 0x36, 0x95, 0x36, 0x77, 0xB8, 0x98, 0x7F, 0xC4, 0xB1, 0x45,
+    0x27, 0x2E, 0xFC, 0x2D, 0x74, 0xB8, 0x3C, 0xCE, 0x61, 0x90, 0x51, 0xF9, 0x20, 0x92, 0x0B, 0xCA,
+    0x39, 0x7F, 0x29, 0xF7, 0x90, 0x33, 0x3F, 0xF3, 0x7A, 0xC5, 0x8D, 0xDC, 0xE8, 0xDA, 0xFB, 0x1A,
+    0xF7, 0x4C, 0xE5, 0x7A, 0x29, 0xBE, 0x70, 0x2E, 0x6B, 0xE5, 0xC6, 0xB9, 0xCB, 0x1A, 0x19, 0x2B,
+    0x9B, 0xB1, 0x9C, 0x76, 0xAB, 0x99, 0xA0, 0x69, 0x79, 0x48, 0x8A, 0x13, 0xA4, 0xE7, 0x9D, 0x5C,
+    0xC8, 0x41, 0x78, 0xE5, 0x06, 0x72, 0xF2, 0xBE, 0x65, 0x0F, 0x31, 0x7A, 0x19, 0x8E, 0x74, 0x01,
+    0x23, 0xDA, 0xB0, 0x5B, 0x47, 0x79, 0xDF, 0xDF, 0xFB, 0x17, 0xDA, 0x16, 0x75, 0x29, 0x5D, 0x2E,
+    0xAA, 0xA2, 0xC2, 0x09, 0x65, 0x55, 0x6A, 0xFB, 0xDF, 0x7E, 0xC5, 0xF6, 0xDA, 0x2F, 0xD9, 0x42,
+    0x71, 0x6C, 0x1B, 0x6B, 0xE7, 0xDA, 0x56, 0xEE, 0xB9, 0xB5, 0x81, 0x2F, 0x1A, 0xD1, 0xA6, 0xB4,
+    0xA2, 0xAE, 0xB1, 0xC8, 0x55, 0x24, 0xFA, 0xF1, 0x19, 0x46, 0x15, 0x7B, 0x55, 0xC7, 0x98, 0x32,
+    0x55, 0x35, 0xD5, 0x68, 0xEF, 0xA9, 0x96, 0x76, 0x86, 0xFB, 0xE6, 0x07, 0x6C, 0xE2, 0x8E, 0x4D,
+    0xB2, 0x39, 0x3A, 0x76, 0x07, 0xB3, 0xA4, 0x2D, 0x6A, 0xF9, 0x2A, 0x6B, 0xD8, 0x94, 0x15, 0x1A,
+    0xEF, 0x57, 0xDA, 0xE4, 0x6C, 0x1A, 0xC7, 0xDF, 0xDC, 0xD3, 0x35, 0x49, 0xC7, 0x6E, 0xA7, 0x68,
+    0x5A, 0x57, 0x48, 0x93, 0xF9, 0xEF, 0xCA, 0x0C, 0xE7, 0x0C, 0xEA, 0xD8, 0xF5, 0xEB, 0x8E, 0xCA,
+    0xFA, 0x37, 0x74, 0xC8, 0x77, 0x63, 0x34, 0x07, 0xDB, 0xEE, 0xBA, 0x68, 0xE1, 0x46, 0x1F, 0x84,
+    0xFF, 0x94, 0xCB, 0xB8, 0x09, 0x7C, 0x5A, 0x17, 0x55, 0xE0, 0xE3, 0x8E, 0xDA, 0xE5, 0x9F, 0x48,
+    0x61, 0x7B, 0xB2, 0xA9, 0x5B, 0x85, 0x70, 0xEC, 0x76, 0xFE, 0x4A, 0x7F, 0x75, 0xEC, 0xB8, 0x14,
+    0xFD, 0x5C, 0x7B, 0x43, 0x7E, 0xA9, 0x93, 0x7C, 0xCB, 0xB7, 0x03, 0xBE, 0x53, 0x3E, 0x17, 0x35,
+    0x94, 0x94, 0xAD, 0x0C, 0x50, 0xF8, 0x98, 0xB7, 0x97, 0xE9, 0x28, 0x3C, 0x55, 0x83, 0xA5, 0x26,
+    0xFC, 0x68, 0xB8, 0x02, 0xF1, 0xC1, 0x6A, 0x0B, 0x7C, 0x2C, 0x17, 0xA0, 0x8A, 0x6B, 0x5E, 0xA6,
+    0xE7, 0xE5, 0x32, 0x3D, 0x1F, 0x8E, 0x15, 0x1E, 0x0B, 0x37, 0xF0, 0x30, 0x02, 0xE1, 0x37, 0x2C,
+    0x99, 0xC0, 0xA7, 0x1B, 0xE5, 0x47, 0x72, 0xCB, 0xA2, 0x51, 0x7E, 0x6C, 0x86, 0xC1, 0xFA, 0xC9,
+    0xCB, 0x38, 0xED, 0x3F, 0xD6, 0x90, 0xF0, 0x57, 0x25, 0x6D, 0xCE, 0x62, 0xB1, 0x98, 0xEB, 0x42,
+    0x4F, 0xFB, 0xF1, 0xAE, 0xB6, 0xBC, 0x29, 0x8D, 0xFC, 0x79, 0xE0, 0x6D, 0x4E, 0x3D, 0x70, 0x6F,
+    0xDA, 0x2A, 0x12, 0xFD, 0x15, 0x2B, 0x95, 0xAC, 0xF3, 0x3F, 0x17, 0x41, 0xF1, 0x44, 0x59, 0x7E,
+    0x5D, 0x30, 0x1E, 0x09, 0x56, 0x8E, 0x2E, 0xCE, 0xA9, 0x74, 0x43, 0xA5, 0xEA, 0xA2, 0x59, 0xEE,
+    0x7A, 0xA1, 0x86, 0xBE, 0x1E, 0xCC, 0x66, 0xB3, 0x5C, 0x87, 0x80, 0x39, 0xBE, 0x52, 0x89, 0x06,
+    0xD6, 0xDD, 0x62, 0x97, 0x41, 0x6C, 0x13, 0x6A, 0x88, 0x6C, 0xDC, 0x0D, 0x05, 0x1B, 0x58, 0x55,
+    0x0F, 0x9A, 0x81, 0x76, 0x06, 0xCA, 0x81, 0x50, 0x4D, 0x8E, 0x90, 0xA9, 0x89, 0x11, 0x22, 0x35,
+    0x6D, 0xDB, 0x71, 0xD2, 0xDF, 0x31, 0x75, 0x41, 0x19, 0x4E, 0xFD, 0x0F, 0x67, 0xC7, 0x2A, 0x42,
+    0x4C, 0x93, 0x4A, 0x25, 0x18, 0x58, 0x9B, 0x60, 0x95, 0xCA, 0x2F, 0x31, 0xC3, 0x74, 0xF8, 0x81,
+    0x3B, 0x9D, 0xBB, 0x85, 0xA3, 0x71, 0x72, 0x59, 0x35, 0xE9, 0x8C, 0x8D, 0x37, 0x69, 0x63, 0xEC,
+    0x58, 0x0F, 0xA5, 0x95, 0x33, 0xA1, 0x83, 0x2D, 0x74, 0xA2, 0x83, 0x3D, 0x3A, 0xE9, 0x59, 0x65,
+    0x2E, 0x85, 0x15, 0xE9, 0xCD, 0x30, 0xCD, 0x7F, 0xE1, 0x61, 0xB6, 0x3A, 0xD8, 0xC2, 0x6B, 0x63,
+    0xA7, 0xE8, 0x9A, 0xB2, 0xB4, 0xC1, 0x60, 0x37, 0xB0, 0xC3, 0x19, 0xAE, 0x20, 0xE6, 0x35, 0xDB,
+    0xF4, 0x13, 0x4B, 0xC4, 0x06, 0x76, 0x84, 0x8D, 0xA2, 0xE1, 0x2D, 0x26, 0xC1, 0x3C, 0x3B, 0x35,
+    0xD8, 0xCA, 0x62, 0xDE, 0x1A, 0x4B, 0x69, 0x93, 0x85, 0x78, 0xD5, 0xA2, 0x53, 0xBC, 0x76, 0x31,
+    0x5E, 0x3A, 0xA5, 0xBD, 0xE6, 0x94, 0x4D, 0xFC, 0x79, 0xE9, 0x5D, 0xB1, 0x91, 0xFE, 0xD2, 0x98,
+    0x71, 0x56, 0x60, 0xD8, 0xD7, 0xC6, 0x46, 0x62, 0x20, 0x8C, 0x95, 0x99, 0x37, 0x0A, 0x6C, 0xD4,
+    0x2F, 0x69, 0xD8, 0x6E, 0x97, 0xB4, 0x94, 0xD3, 0x2B, 0xD6, 0x5C, 0xC9, 0xBA, 0x92, 0x06, 0xF3,
+    0x73, 0x6F, 0x23, 0xDB, 0x17, 0xED, 0x99, 0x36, 0x99, 0x36, 0xD8, 0xA2, 0xA1, 0xB0, 0x5A, 0x9B,
+    0x4A, 0x9B, 0x25, 0x1B, 0xCE, 0x90, 0xA8, 0xB4, 0x15, 0x77, 0xA8, 0x2B, 0x26, 0xE3, 0xF6, 0x25,
+    0xA7, 0xF3, 0xD8, 0xD0, 0x34, 0xDA, 0x89, 0xB5, 0xCE, 0x1F, 0x37, 0x6C, 0x8E, 0x4E, 0x86, 0x87,
+    0x3C, 0xDF, 0x06, 0x22, 0x90, 0x06, 0xA3, 0x7D, 0x4C, 0xA3, 0x63, 0xD8, 0xD7, 0x94, 0xDC, 0xCA,
+    0x16, 0xBA, 0xA3, 0xD9, 0x42, 0xF0, 0x34, 0x62, 0xCE, 0xB6, 0x37, 0x91, 0x95, 0x6C, 0xE2, 0x7F,
+    0x88, 0x7D, 0xAA, 0x5C, 0x17, 0x58, 0xD9, 0x3B, 0x24, 0x9D, 0x17, 0x35, 0xF7, 0x77, 0x25, 0xB3,
+    0xE3, 0xDB, 0x87, 0x7C, 0xF3, 0x24, 0x48, 0xB9, 0x27, 0x58, 0x08, 0xD1, 0x8F, 0x84, 0x50, 0x8D,
+    0x42, 0xE6, 0xAA, 0xC9, 0x48, 0x3C, 0x28, 0xEC, 0x8B, 0x63, 0xCC, 0xF7, 0x1C, 0xF6, 0x8F, 0xDC,
+    0xBC, 0x94, 0xA3, 0x02, 0xB7, 0xEA, 0xB9, 0xAA, 0xE7, 0x9A, 0x9E, 0x6B, 0x03, 0xF7, 0xEF, 0x3E,
+    0x70, 0xBF, 0x80, 0x59, 0x22, 0xF7, 0xA1, 0x5F, 0x1A, 0xF7, 0x2B, 0xBF, 0x32, 0x4E, 0x2C, 0x66,
+    0xE0, 0x8A, 0x26, 0x70, 0x59, 0x1B, 0xB8, 0xC4, 0x07, 0x6E, 0x2A, 0x1E, 0x9B, 0x72, 0x63, 0xFF,
+    0xA1, 0x71, 0x23, 0xFF, 0x91, 0x71, 0xCE, 0xFF, 0x2E, 0x70, 0xC5, 0x55, 0xE0, 0x32, 0x1F, 0xB8,
+    0xA4, 0xE7, 0xA6, 0x3D, 0x37, 0xEE, 0xB9, 0x51, 0xCF, 0xB9, 0x2D, 0x57, 0x50, 0x06, 0xB6, 0xA2,
+    0x27, 0x3D, 0xD7, 0x5B, 0x35, 0x3A, 0xA8, 0xEA, 0xAC, 0xE9, 0x22, 0x20, 0xD7, 0xF6, 0x5C, 0xDD,
+    0x73, 0xAB, 0x70, 0xC2, 0xE5, 0x76, 0xBF, 0xFF, 0xBB, 0xC0, 0x4C, 0xBB, 0x20, 0xF1, 0xD8, 0x3B,
+    0x93, 0x38, 0x39, 0x4A, 0x7C, 0x0A, 0x8E, 0x12, 0x1F, 0x35, 0xCE, 0x24, 0xEE, 0xD4, 0xE1, 0x0B,
+    0x1C, 0x25, 0x7E, 0x30, 0x73, 0x26, 0x71, 0x9C, 0xAB, 0x12, 0x07, 0xA7, 0x12, 0x07, 0xA7, 0x12,
+    0x07, 0xA7, 0x12, 0x27, 0x47, 0x89, 0x93, 0xA3, 0xC4, 0xC9, 0x51, 0xE2, 0xE4, 0x28, 0x71, 0x72,
+    0x94, 0x38, 0x39, 0x4A, 0x9C, 0x1C, 0x25, 0xAE, 0x1C, 0x24, 0xAE, 0x1C, 0x24, 0xAE, 0x5C, 0xD2,
+    0x73, 0xD3, 0x9E, 0x1B, 0xF7, 0xDC, 0xA8, 0xE7, 0xDC, 0x96, 0x2B, 0xCC, 0x16, 0xAB, 0x17, 0xF5,
+    0xA5, 0x5C, 0x12, 0xB8, 0xB7, 0xCB, 0xAE, 0x57, 0xC7, 0xA6, 0xE7, 0x9A, 0x9E, 0x5B, 0x87, 0x13,
+    0xBA, 0xA0, 0xC0, 0xC8, 0x22, 0xA0, 0xC4, 0x54, 0x95, 0xDA, 0x69, 0x99, 0xB5, 0x66, 0xFA, 0xDC,
+    0xB4, 0x76, 0x37, 0xFE, 0x8E, 0xF2, 0x7B, 0x97, 0x30, 0x55, 0xC5, 0x2F, 0xE9, 0x8B, 0xB4, 0xC5,
+    0x7F, 0xC2, 0x24, 0x4A, 0x4B, 0x07, 0x02, 0xED, 0x95, 0xF4, 0x01, 0xAD, 0xCB, 0x3A, 0xB4, 0x1B,
+    0xB8, 0x52, 0xD2, 0xB6, 0xD8, 0xF8, 0xA5, 0x6D, 0x6E, 0xB4, 0xF5, 0xF3, 0x69, 0x77, 0xC7, 0x71,
+    0xB3, 0x35, 0x9B, 0x7E, 0x6A, 0x42, 0x0A, 0x13, 0xB5, 0x30, 0x73, 0x5C, 0x98, 0x1F, 0x85, 0xC9,
+    0xFA, 0xF6, 0xB9, 0xBB, 0x2F, 0x4E, 0x59, 0xDC, 0x46, 0xF0, 0xCD, 0xC6, 0xFE, 0x7B, 0x9D, 0x1A,
+    0x3A, 0x5E, 0x21, 0xD3, 0x13, 0x12, 0x3D, 0x5E, 0x26, 0xE0, 0xE0, 0x2F, 0xA5, 0x2F, 0x27, 0x87,
+    0x2C, 0x07, 0x2B, 0x40, 0xA3, 0x35, 0xB3, 0x9A, 0x91, 0x7F, 0x58, 0xD3, 0x3F, 0xFE, 0xDB, 0x86,
+    0x4D, 0xDC, 0x72, 0x6D, 0xC5, 0x1B, 0x3A, 0xD0, 0x5C, 0x64, 0xF1, 0x66, 0xC2, 0x9D, 0xB9, 0xE5,
+    0x32, 0xCC, 0x1A, 0xEC, 0xF9, 0x62, 0x33, 0x11, 0xBE, 0x21, 0x0A, 0xC1, 0xD5, 0xE0, 0xB2, 0x55,
+    0xD8, 0x8F, 0xA1, 0x88, 0x91, 0x3A, 0x3B, 0x63, 0xF5, 0xE7, 0x26, 0x1A, 0xD4, 0x4D, 0xFD, 0x27,
+    0x8B, 0xB2, 0xE3, 0xCC, 0x91, 0x0F, 0x3C, 0x5B, 0x09, 0xE7, 0x32, 0x86, 0x64, 0xF3, 0x4C, 0x23,
+    0x4E, 0x38, 0x52, 0xE2, 0x88, 0x42, 0x0E, 0x12, 0xD1, 0x8C, 0xDE, 0x77, 0x87, 0x0F, 0x46, 0x72,
+    0x8C, 0xF8, 0x53, 0xBF, 0xD5, 0x48, 0x11, 0xA7, 0x32, 0xF0, 0x44, 0x8F, 0x67, 0x61, 0x97, 0x3F,
+    0x2C, 0x1F, 0xF0, 0xCE, 0x39, 0x6E, 0xB8, 0x62, 0x68, 0x17, 0x75, 0xDF, 0x97, 0x63, 0xCE, 0xD5,
+    0xDB, 0xA5, 0x9C, 0x85, 0x1C, 0x2C, 0x7C, 0x2B, 0xA1, 0xB6, 0x6F, 0xE1, 0xE6, 0xB4, 0xA9, 0x38,
+    0x67, 0xAD, 0xDC, 0x3F, 0xC3, 0x2C, 0xC8, 0xA0, 0x32, 0x92, 0x42, 0x26, 0x49, 0xE4, 0xDB, 0x4C,
+    0x0F, 0xF1, 0x9F, 0xB5, 0xE2, 0x79, 0x7C, 0xAF, 0x1D, 0xF9, 0xCD, 0xA4, 0x65, 0xBC, 0x74, 0x9A,
+    0x8B, 0x57, 0x46, 0x7F, 0x8C, 0x9E, 0x98, 0xFA, 0x60, 0xDC, 0x82, 0xE9, 0x77, 0x1D, 0x9D, 0xF4,
+    0xD6, 0xC9, 0x33, 0x4C, 0x32, 0x32, 0xF5, 0x1A, 0x16, 0xE6, 0xA6, 0xFE, 0x6F, 0x9A, 0x14, 0x1A,
+    0x2E, 0xAD, 0x07, 0xB7, 0x24, 0x59, 0xB0, 0xBB, 0xEB, 0xA9, 0xF8, 0x6D, 0x6D, 0x86, 0x08, 0x01,
+    0x91, 0x37, 0x76, 0x19, 0xE9, 0xCB, 0xB0, 0xBB, 0x1A, 0x06, 0x65, 0xF5, 0xF3, 0x27, 0x8F, 0x9B,
+    0xCA, 0xCD, 0x60, 0xEE, 0xEF, 0x9B, 0xCA, 0x04, 0x49, 0xD4, 0x41, 0xA6, 0xB5, 0xC5, 0x48, 0x46,
+    0x3A, 0xDF, 0x08, 0x90, 0xB4, 0x86, 0x8F, 0x04, 0xB8, 0xC2, 0xD0, 0x0B, 0x03, 0x47, 0x0C, 0xDB,
+    0x30, 0xA8, 0xC3, 0x90, 0x0F, 0x6D, 0xD6, 0xB6, 0x0F, 0x0F, 0xFE, 0x27, 0xBF, 0xD9, 0x91, 0x76,
+    0x9E, 0x41, 0x22, 0x76, 0x4D, 0xBB, 0x83, 0xE1, 0x21, 0x06, 0x87, 0x04, 0x34, 0xC4, 0xE2, 0x19,
+    0xC3, 0x42, 0x02, 0x14, 0x42, 0x24, 0x44, 0x22, 0x56, 0x99, 0xD4, 0xCE, 0xCF, 0x13, 0x38, 0xC2,
+    0x15, 0x2C, 0x6D, 0x42, 0x5D, 0x4C, 0xB8, 0x6F, 0x8D, 0x74, 0x39, 0xCF, 0x8E, 0x07, 0x63, 0xBE,
+    0x50, 0x58, 0x45, 0xA3, 0x77, 0xDA, 0x6D, 0x6A, 0xF6, 0x3F, 0x18, 0x7E, 0xC2, 0x57, 0x56, 0x74,
+    0x44, 0xC1, 0x11, 0xC5, 0x46, 0x14, 0x0C, 0xD9, 0x43, 0x09, 0x8B, 0x28, 0x2A, 0x92, 0x74, 0xEA,
+    0x6F, 0xCF, 0xC5, 0x32, 0x2A, 0x24, 0x12, 0x69, 0xE0, 0xA1, 0x80, 0x88, 0xE1, 0x21, 0x47, 0xE8,
+    0xC2, 0x8D, 0x3E, 0xAF, 0x19, 0x9D, 0xB3, 0xCF, 0x7E, 0x5F, 0x9F, 0x15, 0x2D, 0x51, 0x8C, 0xE2,
+    0xC5, 0x50, 0xC5, 0x41, 0x14, 0x05, 0x51, 0x0C, 0x44, 0x11, 0x10, 0xC5, 0x3F, 0x0C, 0xFD, 0x50,
+    0xEC, 0xC3, 0x90, 0x0F, 0xAC, 0xE3, 0x9B, 0xD6, 0x25, 0xBB, 0xA6, 0x75, 0x69, 0x6F, 0x5A, 0x17,
+    0x02, 0x21, 0xB4, 0xE7, 0xCF, 0x4E, 0x92, 0x8E, 0x60, 0x07, 0xA1, 0x0E, 0x02, 0x1D, 0x84, 0x39,
+    0x08, 0x72, 0x28, 0xC4, 0x41, 0x80, 0xE3, 0x00, 0x77, 0x3C, 0x92, 0xD0, 0x16, 0xE6, 0x1A, 0x86,
+    0x7A, 0x48, 0x6D, 0x3E, 0xB8, 0x37, 0xB0, 0x04, 0x56, 0xD9, 0x1C, 0xBA, 0x28, 0x96, 0x81, 0xEA,
+    0x37, 0x43, 0x10, 0xE3, 0x35, 0xD1, 0x82, 0x41, 0xA0, 0xF8, 0x62, 0x4B, 0x18, 0x9F, 0xEA, 0x0E,
+    0xE9, 0x7E, 0x2A, 0xBF, 0xFE, 0xCC, 0x1B, 0x29, 0xE7, 0x42, 0xBE, 0xE3, 0xDE, 0x7A, 0x29, 0x9A,
+    0xB1, 0x29, 0x41, 0xA8, 0x4D, 0x83, 0x56, 0x78, 0x8C, 0x50, 0x07, 0x2D, 0x57, 0xB6, 0xBA, 0xBB,
+    0xFA, 0xD1, 0xE1, 0xD2, 0x15, 0xA0, 0xAF, 0x96, 0x31, 0x7A, 0xC1, 0x88, 0x66, 0xAF, 0x98, 0x92,
+    0xDE, 0x62, 0xEC, 0x5F, 0xCC, 0x13, 0x20, 0x4A, 0x55, 0xD9, 0x9B, 0xD6, 0x48, 0xCD, 0x54, 0x59,
+    0xDD, 0x59, 0x25, 0x45, 0xE2, 0xEF, 0x2E, 0x5D, 0xF9, 0x8F, 0x40, 0x42, 0xAE, 0x0D, 0x44, 0xB3,
+    0x69, 0xFA, 0xAA, 0xAD, 0x24, 0x35, 0xAD, 0x74, 0xCD, 0x5C, 0xB2, 0xD1, 0xA0, 0x4E, 0x61, 0xD9,
+    0xF9, 0x1D, 0x5F, 0x49, 0x8A, 0xB2, 0x72, 0x16, 0xD2, 0x6B, 0x9B, 0xEA, 0xDC, 0x0C, 0xC7, 0xBC,
+    0x4A, 0x4A, 0x7A, 0x57, 0xC2, 0xB4, 0x29, 0x1C, 0x1A, 0x0C, 0x2B, 0x27, 0xA2, 0x1A, 0x7F, 0xFC,
+    0x8E, 0xAF, 0x7E, 0xCF, 0x40, 0x28, 0x3A, 0xD5, 0xD4, 0x5E, 0xBC, 0xB9, 0xBF, 0x58, 0x3C, 0xEC,
+    0x10, 0x7B, 0x0D, 0x88, 0xD8, 0x88, 0x64, 0x23, 0x24, 0x6D, 0x01, 0x1B, 0xB6, 0x72, 0x64, 0x59,
+    0xC7, 0xFE, 0x53, 0x44, 0xBC, 0x70, 0x31, 0x0C, 0xB2, 0xAB, 0xCD, 0x86, 0x44, 0xB3, 0xD9, 0x89,
+    0x82, 0xF4, 0xED, 0xAD, 0x26, 0xFC, 0xFD, 0x81, 0x63, 0x6E, 0xA9, 0x9D, 0x30, 0x4E, 0xE9, 0xA6,
+    0xED, 0xB6, 0x19, 0xB5, 0xE3, 0x5B, 0x31, 0xE2, 0x6B, 0x1D, 0xFB, 0x3C, 0x71, 0x5F, 0xFC, 0x57,
+    0xB9, 0xBB, 0x4D, 0x94, 0xFC, 0xC6, 0x44, 0x79, 0xB1, 0xF1, 0x50, 0x50, 0xDD, 0x44, 0x95, 0xB5,
+    0xDB, 0xF4, 0x7F, 0xBA, 0x81, 0x8E, 0xF5, 0xBB, 0xC9, 0x66, 0xD8, 0xD8, 0x97, 0x2E, 0xBF, 0x2B,
+    0xAA, 0x3B, 0x82, 0x9A, 0xF6, 0xAA, 0x8E, 0x0A, 0xA2, 0xA9, 0xD3, 0x0C, 0xCB, 0x3C, 0xFC, 0x37,
+    0x68, 0xEE, 0x05, 0xAB, 0x2E, 0xB8, 0x9B, 0xDB, 0x44, 0xE8, 0x3E, 0xA6, 0x3F, 0xC6, 0x0D, 0xFC,
+    0x35, 0x3A, 0xA5, 0xA3, 0xC0, 0x8C, 0x03, 0x33, 0x09, 0x4C, 0x1C, 0x98, 0xA4, 0x0D, 0x08, 0x76,
+    0x63, 0x38, 0x4F, 0x51, 0x19, 0x53, 0xAE, 0x8D, 0xF1, 0x2B, 0x65, 0x44, 0x41, 0xBA, 0x1F, 0x88,
+    0xC2, 0x12, 0x9A, 0x09, 0x84, 0x2A, 0x64, 0xE2, 0xCE, 0x98, 0xA4, 0x35, 0x46, 0xA4, 0x90, 0x76,
+    0xE8, 0x9A, 0x82, 0x3E, 0x16, 0x13, 0xB6, 0xA1, 0x7F, 0xAD, 0xB3, 0xFE, 0xA9, 0x25, 0x11, 0x25,
+    0xB6, 0x86, 0x19, 0xF2, 0x5E, 0x48, 0x44, 0x26, 0xDD, 0x62, 0x71, 0x8E, 0x1B, 0xE2, 0x82, 0x2B,
+    0x88, 0x96, 0x0C, 0x10, 0xE1, 0x24, 0x64, 0x90, 0x12, 0x1D, 0xC5, 0x81, 0x4E, 0x72, 0xB5, 0x88,
+    0x7B, 0x5A, 0x59, 0x04, 0xC3, 0x34, 0xE2, 0xA1, 0x3F, 0x8F, 0x44, 0x93, 0x72, 0xFF, 0x0D, 0xD0,
+    0x37, 0x48, 0x45, 0x3A, 0xB7, 0x52, 0x31, 0xA9, 0x4A, 0xE5, 0x3E, 0x8D, 0xCC, 0x79, 0x89, 0xDB,
+    0x13, 0xD3, 0x29, 0xA7, 0x2E, 0x02, 0xB9, 0x0E, 0xEA, 0xED, 0xC4, 0xA4, 0x46, 0x7A, 0xBC, 0x9F,
+    0x5A, 0x9B, 0xFA, 0x4F, 0x30, 0x46, 0x0F, 0x55, 0x37, 0xBA, 0x85, 0x6A, 0x5B, 0x33, 0x67, 0x8F,
+    0x96, 0x20, 0x5C, 0xD1, 0x02, 0x48, 0x8E, 0x7E, 0x9C, 0xE9, 0x69, 0x8D, 0x28, 0x1F, 0x80, 0x7A,
+    0x23, 0xD7, 0x59, 0x81, 0x8F, 0xC4, 0x27, 0x3A, 0x44, 0xBA, 0x09, 0x19, 0xD5, 0x83, 0x41, 0xC7,
+    0xCF, 0xFC, 0xA5, 0x2E, 0x5E, 0xA6, 0x67, 0xB4, 0xF1, 0x21, 0xF0, 0x5C, 0x50, 0x1F, 0x35, 0x32,
+    0x0B, 0x89, 0x2E, 0x4F, 0xC3, 0x5D, 0x0D, 0xC7, 0x2A, 0xDA, 0x01, 0x30, 0x2F, 0x0B, 0x2C, 0xF2,
+    0x5C, 0x5D, 0xFB, 0x9B, 0x85, 0x2C, 0x40, 0xEC, 0x83, 0x45, 0x85, 0x13, 0x16, 0xFE, 0x2A, 0x2F,
+    0x98, 0xFF, 0xC3, 0x9A, 0x42, 0x93, 0x32, 0x31, 0x38, 0x8F, 0x51, 0xDE, 0x50, 0xF1, 0xB6, 0x65,
+    0xA5, 0xD3, 0xAC, 0xD2, 0x2E, 0x55, 0x1A, 0x62, 0x33, 0x58, 0xF7, 0x84, 0x14, 0x15, 0x2D, 0x98,
+    0x5E, 0x46, 0xCC, 0x6E, 0x11, 0x98, 0xF6, 0x5F, 0x78, 0xCB, 0x69, 0x69, 0xFE, 0x28, 0x65, 0x26,
+    0x2B, 0x0B, 0x21, 0x33, 0x28, 0x53, 0x57, 0x05, 0x93, 0x52, 0x43, 0xAA, 0xB9, 0x29, 0x3D, 0x26,
+    0xE5, 0xBF, 0xC4, 0x7F, 0xD2, 0x5F, 0x47, 0xAE, 0xFC, 0x29, 0x36, 0x68, 0xFF, 0x03, 0xA1, 0x87,
+    0x0F, 0x14, 0x0D, 0x8D, 0x0D, 0x97, 0xD0, 0x0E, 0x1A, 0x7D, 0xC3, 0xCD, 0xCE, 0xBA, 0xE3, 0xF8,
+    0xDC, 0x95, 0x2D, 0xCF, 0xD5, 0xFD, 0x94, 0x30, 0x8D, 0x0C, 0x2D, 0x3A, 0x23, 0x3A, 0x70, 0x9F,
+    0x90, 0x48, 0x2C, 0x06, 0x0A, 0xA0, 0x33, 0xE6, 0x41, 0xA4, 0x29, 0x9E, 0xC2, 0xCA, 0x2A, 0x96,
+    0x37, 0xC0, 0x10, 0xEA, 0x49, 0xD5, 0xA4, 0x5A, 0xA2, 0x92, 0x54, 0x47, 0xAA, 0x22, 0xD5, 0x90,
+    0x2A, 0x48, 0xF5, 0xA3, 0xEA, 0x51, 0xED, 0x94, 0x9A, 0x2E, 0xA1, 0x36, 0x6E, 0xD3, 0xB2, 0x8E,
+    0x16, 0x42, 0x1B, 0x96, 0x3D, 0xB4, 0xA0, 0xB0, 0x77, 0x45, 0x85, 0xAB, 0x15, 0x15, 0x51, 0x8F,
+    0x6A, 0xEA, 0x2F, 0xBF, 0xAF, 0x7B, 0xB9, 0x25, 0x6B, 0x2B, 0x53, 0x87, 0x69, 0x03, 0xBD, 0x45,
+    0x88, 0xFD, 0xBE, 0x38, 0x75, 0x69, 0x05, 0x0F, 0x8D, 0x40, 0x34, 0x7C, 0x0A, 0x62, 0xEC, 0xCD,
+    0x10, 0x34, 0xA0, 0xCE, 0xA0, 0xB2, 0x11, 0x34, 0x46, 0x1B, 0x12, 0x43, 0xDA, 0x89, 0x68, 0xC0,
+    0x53, 0x5B, 0x54, 0x07, 0xE1, 0x8D, 0xBD, 0xA4, 0x55, 0x32, 0xF5, 0x29, 0x2C, 0xB5, 0x8C, 0xBD,
+    0xF0, 0x54, 0x14, 0xFB, 0x27, 0x43, 0xFA, 0x0D, 0x34, 0x28, 0xFA, 0x8C, 0x8E, 0x75, 0x63, 0x20,
+    0xE9, 0x7E, 0x1F, 0x50, 0x73, 0x7C, 0xF5, 0x37, 0xBE, 0xA5, 0x66, 0xA8, 0x18, 0x7A, 0x3B, 0xD1,
+    0x43, 0x51, 0x0B, 0x01, 0x02, 0x38, 0x67, 0x29, 0xBC, 0x3E, 0x40, 0x04, 0x06, 0xC4, 0x10, 0x82,
+    0xB4, 0x21, 0x0C, 0x80, 0x8F, 0xA2, 0x22, 0x5E, 0x54, 0x11, 0x6D, 0xAA, 0x80, 0xCE, 0x08, 0x95,
+    0xCE, 0x63, 0xA7, 0xC1, 0xEC, 0x45, 0xD2, 0xB8, 0xAC, 0x58, 0xA7, 0x53, 0x01, 0x34, 0x2F, 0x29,
+    0x55, 0x71, 0x2A, 0xE5, 0x3A, 0xE5, 0xFF, 0x40, 0xD1, 0xE5, 0x17, 0xDC, 0x99, 0xBC, 0xD1, 0x55,
+    0x98, 0x4D, 0x25, 0x8D, 0x4C, 0xB9, 0xD1, 0xE3, 0xF5, 0x5C, 0x2C, 0x8C, 0xB2, 0x62, 0xB5, 0x4F,
+    0x85, 0x72, 0x82, 0x70, 0x17, 0xA8, 0x59, 0xA8, 0xC8, 0xA1, 0x44, 0x46, 0x3A, 0xEF, 0xFB, 0x33,
+    0xF6, 0x6B, 0x62, 0x81, 0x4E, 0xD1, 0x40, 0x98, 0x41, 0xC2, 0x71, 0x13, 0x85, 0x17, 0x98, 0x79,
+    0x72, 0x86, 0x0A, 0x0E, 0x71, 0x41, 0xD6, 0xC2, 0x3C, 0x78, 0x7C, 0x1E, 0xEE, 0x09, 0xCD, 0xC1,
+    0x8C, 0x39, 0xE1, 0x44, 0xF3, 0xC1, 0x05, 0x73, 0xC1, 0x5A, 0xAD, 0xD2, 0x68, 0xE2, 0xB7, 0xA1,
+    0x32, 0xB2, 0x9A, 0xA0, 0x7F, 0x56, 0x73, 0xDA, 0x67, 0xFF, 0xCB, 0x3E, 0x65, 0xD7, 0x5A, 0x3F,
+    0xA1, 0x3D, 0xCC, 0x74, 0xDF, 0xCF, 0xD4, 0xA2, 0x67, 0x50, 0xB5, 0x9E, 0x9E, 0x0F, 0x2E, 0x66,
+    0x97, 0xA6, 0x8B, 0xAA, 0xE9, 0xEA, 0xC1, 0xDD, 0xA7, 0xDB, 0x6A, 0x90, 0xD7, 0x1B, 0x4C, 0x0C,
+    0x7E, 0x94, 0xBA, 0x89, 0xB1, 0xC2, 0x43, 0xA9, 0x0E, 0x2E, 0xB3, 0xE6, 0x7A, 0xAE, 0x40, 0xEA,
+    0x5C, 0xB7, 0xA9, 0xB9, 0x15, 0xCD, 0xBC, 0x7C, 0x50, 0x51, 0xE3, 0xB7, 0x92, 0x3D, 0x69, 0xB7,
+    0xA3, 0x31, 0xEA, 0xFF, 0x85, 0x93, 0x51, 0xB3, 0xBA, 0xA4, 0x6F, 0x9F, 0x3F, 0xC1, 0xC9, 0xB4,
+    0xDF, 0xEE, 0x84, 0x66, 0x47, 0x9B, 0x1D, 0xCD, 0xAE, 0x87, 0x9A, 0x4D, 0x4D, 0xCF, 0x57, 0xF3,
+    0x01, 0x44, 0x1E, 0xE6, 0xF4, 0x22, 0xEF, 0x3D, 0xB5, 0xC2, 0xB2, 0x11, 0x5B, 0x3A, 0xF4, 0xE0,
+    0x5E, 0xB6, 0xF6, 0x97, 0x4F, 0xAF, 0xFD, 0x37, 0x2F, 0xDC, 0xDB, 0x17, 0x13, 0xB1, 0x68, 0xCB,
+    0xC8, 0xFF, 0x13, 0xC2, 0x1D, 0x5C, 0x8A, 0xB1, 0x63, 0x0C, 0x11, 0x46, 0x61, 0x70, 0xD8, 0x0A,
+    0x6B, 0x90, 0xA6, 0x27, 0xFC, 0x2F, 0x8B, 0xAA, 0x80, 0x23, 0xB0, 0x96, 0x8C, 0x9A, 0x5A, 0xEF,
+    0x7C, 0x85, 0x0D, 0x8B, 0x85, 0x38, 0x14, 0x08, 0xCF, 0x38, 0x7A, 0x87, 0x73, 0xAB, 0xD8, 0x68,
+    0x31, 0x97, 0x55, 0xC6, 0x91, 0x24, 0xDD, 0x39, 0x36, 0x8E, 0xEE, 0xF8, 0xD0, 0xB3, 0x52, 0xA3,
+    0xA6, 0x2A, 0x19, 0xFC, 0xDF, 0xA3, 0x1A, 0x0F, 0x4E, 0x42, 0x9F, 0x37, 0xD6, 0x67, 0xCD, 0x0E,
+    0xEF, 0xEB, 0xB3, 0xA8, 0x66, 0x76, 0xBC, 0xDB, 0xE7, 0xC6, 0xFA, 0x4C, 0x93, 0xC6, 0xF4, 0x2A,
+    0xA6, 0x15, 0x2D, 0x1B, 0x2B, 0xB3, 0x92, 0x2E, 0xEC, 0xE6, 0xE6, 0x9F, 0x69, 0xC7, 0x97, 0xB6,
+    0x5B, 0x4C, 0x28, 0xB8, 0xB2, 0xED, 0x63, 0xF4, 0x3E, 0x50, 0x27, 0x49, 0xF5, 0x87, 0x47, 0x72,
+    0xC1, 0xC6, 0x7F, 0xF2, 0xD0, 0xAA, 0x91, 0xD8, 0x7B, 0xC4, 0x13, 0x12, 0x81, 0x74, 0x73, 0x66,
+    0x8D, 0xB0, 0x4D, 0x60, 0x8F, 0x98, 0x68, 0x20, 0x32, 0xE7, 0xD6, 0x10, 0xF6, 0x05, 0x64, 0x8B,
+    0xE0, 0x27, 0x3F, 0xAF, 0x8F, 0x2C, 0xAB, 0x4F, 0xE9, 0x58, 0x54, 0x4E, 0xD1, 0x82, 0x9C, 0x26,
+    0xFD, 0xFF, 0x6B, 0xF3, 0xBE, 0x7E, 0x6D, 0x9E, 0x55, 0xE1, 0x59, 0x9C, 0xD4, 0x0D, 0x42, 0xBA,
+    0xF5, 0x96, 0x6D, 0xB7, 0x6C, 0xD7, 0x97, 0x29, 0x7F, 0x2B, 0xAB, 0xF0, 0xDC, 0xAD, 0x6A, 0x93,
+    0xAF, 0xCD, 0x7E, 0xEB, 0xAA, 0xF0, 0xE0, 0x42, 0x7E, 0xD0, 0x63, 0xBE, 0xBC, 0xAB, 0x55, 0xF4,
+    0x30, 0xE6, 0x75, 0x69, 0x75, 0xA3, 0x1A, 0xF9, 0x35, 0x09, 0x70, 0xE0, 0x51, 0x5D, 0x38, 0x35,
+    0x1F, 0x2A, 0x35, 0xEE, 0x19, 0xEB, 0x80, 0xE9, 0xF6, 0x6E, 0xC9, 0x2B, 0x19, 0xE0, 0x14, 0x95,
+    0x29, 0x81, 0xD1, 0xC1, 0xFC, 0xA9, 0x18, 0xD9, 0xBF, 0x94, 0x19, 0x59, 0x70, 0xB1, 0xCB, 0x7C,
+    0x3E, 0xFB, 0x6B, 0x65, 0x68, 0xA9, 0x9F, 0xC0, 0x7C, 0x3E, 0x7B, 0xE7, 0x71, 0xD7, 0xD9, 0xCF,
+    0x2C, 0xC7, 0x81, 0x11, 0x6B, 0x58, 0x42, 0x23, 0x75, 0xC2, 0x48, 0x27, 0xD2, 0x85, 0xA3, 0x21,
+    0x13, 0x23, 0x2F, 0xE8, 0x8C, 0x61, 0x11, 0xF0, 0x0E, 0x4B, 0x1C, 0x6C, 0x01, 0x8F, 0x02, 0x30,
+    0x03, 0x70, 0x54, 0x78, 0x84, 0xBF, 0xE6, 0x91, 0x9F, 0xC1, 0xF6, 0x89, 0x89, 0x94, 0xB5, 0x57,
+    0xE2, 0xF1, 0x03, 0x09, 0xBB, 0x58, 0x14, 0x45, 0x67, 0xA8, 0xA4, 0x33, 0x44, 0x63, 0xAE, 0x81,
+    0xD5, 0x96, 0x4E, 0xBD, 0x06, 0x5C, 0xA0, 0x49, 0xB7, 0x0D, 0xFD, 0xCA, 0x96, 0x48, 0x48, 0xCD,
+    0xD0, 0xAF, 0x62, 0xF8, 0x86, 0x90, 0x0D, 0xA6, 0xB4, 0xBC, 0x86, 0x1F, 0x53, 0x32, 0xD2, 0x0F,
+    0x41, 0xDF, 0x86, 0x3E, 0x2B, 0xD6, 0x47, 0x79, 0xB9, 0x9D, 0xC7, 0x4F, 0x4B, 0xDD, 0xE1, 0x62,
+    0xAE, 0x78, 0xDA, 0x7A, 0x08, 0xC9, 0x18, 0xDA, 0x36, 0xF6, 0xA1, 0x6A, 0xFE, 0xE6, 0x43, 0x00,
+    0x56, 0xFE, 0x66, 0xB5, 0x6F, 0x56, 0xF8, 0x66, 0x55, 0x6F, 0x56, 0xF2, 0x66, 0xF5, 0x6E, 0x56,
+    0xEC, 0x66, 0x95, 0x6E, 0x56, 0xE6, 0x66, 0x35, 0x6E, 0x56, 0xE0, 0x66, 0xD5, 0x6D, 0x56, 0xDA,
+    0x66, 0x75, 0x6D, 0x56, 0xD4, 0x66, 0x15, 0x6D, 0x56, 0xCE, 0x66, 0xB5, 0x6C, 0x56, 0xC8, 0x66,
+    0x55, 0x6C, 0x56, 0xC2, 0x66, 0xF5, 0x6B, 0x56, 0xBC, 0x66, 0x95, 0x6B, 0x56, 0xB6, 0x66, 0x35,
+    0x6B, 0x56, 0xB0, 0xE6, 0x4E, 0xDF, 0x57, 0xBB, 0x45, 0x84, 0x16, 0x4B, 0x70, 0x19, 0x52, 0x95,
+    0xCC, 0x11, 0x84, 0xD5, 0xC8, 0xDA, 0x31, 0x16, 0x8E, 0xB1, 0x6A, 0x8C, 0xE8, 0x21, 0xEB, 0xC5,
+    0x58, 0x2C, 0xC6, 0x4A, 0x31, 0x96, 0x89, 0xB1, 0x36, 0x4C, 0xC9, 0xB3, 0xE5, 0x5B, 0x42, 0x6F,
+    0x82, 0xFC, 0x47, 0x3A, 0x01, 0x27, 0xCD, 0x30, 0xB4, 0x9E, 0x6E, 0xCC, 0x75, 0xE5, 0x6F, 0xC5,
+    0x43, 0xFA, 0xF8, 0x3F, 0x9D, 0x52, 0x6F, 0x3F, 0x99, 0xB0, 0xF9, 0x07, 0x0D, 0xF0, 0x0C, 0x0B,
+    0xB7, 0xA6, 0xDC, 0xC5, 0xC2, 0xAD, 0x20, 0xF8, 0xA1, 0x62, 0xE1, 0x89, 0x46, 0x47, 0x8F, 0xC1,
+    0xC2, 0xE7, 0x5B, 0x2C, 0xBC, 0x72, 0x44, 0x19, 0x0C, 0x0B, 0xBF, 0x5A, 0x6C, 0xB1, 0x70, 0x03,
+    0xC1, 0xAD, 0x99, 0xAA, 0x23, 0x30, 0x00, 0xC1, 0xC5, 0x13, 0x4A, 0x6F, 0x81, 0xE0, 0xE3, 0x1B,
+    0xF9, 0x0B, 0x8D, 0x3B, 0xB9, 0x89, 0xC0, 0x28, 0xBA, 0x6E, 0x9B, 0xB5, 0x63, 0xE9, 0x0F, 0x3C,
+    0x2A, 0xE4, 0x2A, 0xE3, 0x65, 0x4F, 0x7E, 0xC6, 0xD4, 0x65, 0x13, 0xE6, 0xEE, 0x69, 0xFE, 0x2C,
+    0xC0, 0xB8, 0xFF, 0xFA, 0xC0, 0xB8, 0x1B, 0xD9, 0x03, 0x4B, 0x21, 0x76, 0x36, 0xBF, 0xDB, 0x85,
+    0x32, 0x26, 0x4A, 0xDF, 0xF0, 0x84, 0x51, 0xF8, 0x25, 0x3A, 0xB9, 0x99, 0x83, 0xFA, 0xF6, 0x41,
+    0xE5, 0xB6, 0x10, 0xFB, 0x08, 0xAE, 0x4F, 0x42, 0x07, 0xFF, 0x27, 0xB1, 0x05, 0x50, 0x58, 0x59,
+    0xCB, 0xD1, 0x8E, 0xC0, 0x5E, 0x3F, 0xE8, 0xFC, 0x4D, 0xC6, 0xDE, 0x61, 0xAD, 0x6B, 0x5A, 0xDB,
+    0xA9, 0x24, 0xCC, 0xD4, 0xDA, 0xD3, 0x49, 0xDB, 0xE7, 0x97, 0xD6, 0xC4, 0x29, 0x7E, 0x6B, 0xF2,
+    0x6C, 0x55, 0x1F, 0xF5, 0x00, 0xA7, 0x78, 0x68, 0x38, 0x05, 0x31, 0x6B, 0x4C, 0xFC, 0x9C, 0x99,
+    0x66, 0xE2, 0x14, 0xF1, 0x35, 0x71, 0x8A, 0xE4, 0x77, 0xC4, 0x29, 0xB2, 0x9F, 0x53, 0xFA, 0xFE,
+    0xBB, 0x68, 0xA2, 0x8E, 0xC8, 0xC4, 0xB8, 0x25, 0x4E, 0x11, 0xD7, 0xFC, 0x5F, 0xB2, 0x26, 0x4E,
+    0x91, 0x2D, 0x89, 0x53, 0xD0, 0x27, 0x2E, 0x36, 0x1D, 0x71, 0x0A, 0x2E, 0xED, 0x79, 0xAA, 0xCF,
+    0xDA, 0x25, 0x72, 0x99, 0x5B, 0x38, 0xC5, 0x48, 0x03, 0x83, 0xB1, 0x3E, 0x4B, 0x16, 0x5F, 0x31,
+    0xC0, 0x1D, 0x55, 0x3A, 0xD1, 0xFB, 0xB4, 0x36, 0xB7, 0x1B, 0x22, 0x71, 0x56, 0xC4, 0x5B, 0x54,
+    0x7D, 0x3E, 0x7F, 0xAC, 0xCF, 0x25, 0x1C, 0x0F, 0x21, 0x9A, 0xF7, 0xF8, 0x98, 0x9A, 0x6F, 0xB8,
+    0xA4, 0xEB, 0x1E, 0x82, 0xB8, 0x56, 0x08, 0x82, 0xA5, 0xBB, 0xF2, 0x8B, 0xC3, 0x96, 0x01, 0x88,
+    0x5E, 0x46, 0x9C, 0x17, 0x75, 0xF2, 0x11, 0x68, 0xF6, 0xA1, 0x08, 0xA1, 0xC6, 0x33, 0x83, 0xD9,
+    0x65, 0x07, 0x68, 0xC2, 0xB7, 0xA4, 0x35, 0x0C, 0x93, 0x5F, 0x27, 0xDE, 0x9E, 0xF4, 0x9B, 0xF4,
+    0xDD, 0xD7, 0xBC, 0xC1, 0xDC, 0x4D, 0xAF, 0xE1, 0x54, 0x46, 0xEB, 0xED, 0x7C, 0x1B, 0x2D, 0xFE,
+    0x6A, 0xC1, 0x7E, 0x7E, 0xA8, 0x15, 0xDC, 0x2B, 0xF5, 0x29, 0x2B, 0xCE, 0xCC, 0x69, 0x93, 0x70,
+    0x10, 0xED, 0xB8, 0xD1, 0x14, 0xDD, 0xF1, 0xDD, 0xC8, 0x4F, 0x9E, 0x5E, 0x88, 0xB6, 0x58, 0x7C,
+    0x18, 0x37, 0xB2, 0x3B, 0x4E, 0x36, 0x31, 0xD4, 0x00, 0x00, 0x26, 0x43, 0x1A, 0xF9, 0xA0, 0x5F,
+    0x8F, 0x2F, 0x38, 0x17, 0x39, 0xB5, 0xBD, 0x92, 0x42, 0x1C, 0xF5, 0x08, 0x1F, 0xE5, 0x25, 0x32,
+    0x41, 0x23, 0x96, 0x4C, 0x97, 0xD1, 0xD1, 0x1D, 0x49, 0x15, 0x47, 0x25, 0x83, 0xCD, 0x96, 0x20,
+    0x19, 0x8D, 0xF1, 0x5C, 0xF6, 0x92, 0x74, 0x39, 0x96, 0xD5, 0xB0, 0x92, 0x25, 0x13, 0xE5, 0x2F,
+    0xA3, 0xC2, 0xF9, 0x2B, 0x4E, 0x10, 0x86, 0x67, 0xB8, 0x51, 0xB5, 0x4B, 0xD6, 0x94, 0xE8, 0x7E,
+    0x92, 0x33, 0x65, 0x8A, 0x18, 0xEE, 0x06, 0x91, 0xDD, 0xE9, 0x4B, 0x4E, 0x23, 0x59, 0x2C, 0x2E,
+    0xF6, 0xDC, 0xAD, 0x3A, 0xFD, 0x67, 0x76, 0x17, 0xB1, 0xFC, 0x8D, 0xEE, 0x16, 0xBB, 0xF3, 0x99,
+    0xC2, 0x4E, 0x03, 0x5A, 0x06, 0x49, 0x4A, 0xA8, 0xF7, 0x5E, 0xD9, 0xE0, 0x01, 0x61, 0xEC, 0xBC,
+    0xF1, 0x86, 0x3B, 0x48, 0x86, 0xED, 0x23, 0x63, 0x09, 0xCB, 0x96, 0x34, 0x21, 0xA9, 0xA1, 0x90,
+    0x1A, 0xB1, 0x40, 0x6C, 0x13, 0xB4, 0x32, 0x23, 0xCE, 0x85, 0xC2, 0xCA, 0xBC, 0xCF, 0x15, 0x1D,
+    0x13, 0x27, 0x53, 0x34, 0x26, 0x11, 0x0A, 0xD1, 0x8F, 0x36, 0x5D, 0x8F, 0xDA, 0x6C, 0xEE, 0x36,
+    0x47, 0x96, 0xEC, 0x97, 0xA3, 0xBB, 0x52, 0xF7, 0xB6, 0xF0, 0xE9, 0xCA, 0xC1, 0x83, 0xBD, 0xFD,
+    0x47, 0x83, 0x83, 0x76, 0xE7, 0xF3, 0xF9, 0xEC, 0x64, 0xEF, 0xB1, 0xF8, 0x5C, 0x2D, 0x16, 0x37,
+    0xAE, 0xEB, 0xBF, 0xF2, 0x34, 0x7B, 0xA1, 0x12, 0x0A, 0xD3, 0x6C, 0x8D, 0xCA, 0xF4, 0x2F, 0xB3,
+    0x43, 0xE5, 0x6E, 0x29, 0x05, 0x1E, 0xB5, 0x66, 0x42, 0x98, 0xA0, 0xC7, 0x37, 0x4E, 0x26, 0x58,
+    0xEB, 0x85, 0xC9, 0x60, 0x70, 0xDF, 0xFB, 0x17, 0xE2, 0x10, 0xA6, 0x8D, 0x6C, 0x6C, 0x71, 0x9B,
+    0xD6, 0x56, 0x78, 0xE4, 0xE1, 0xF9, 0x65, 0xCB, 0x12, 0x46, 0xE9, 0x20, 0x18, 0x24, 0x42, 0xBB,
+    0x0A, 0xD9, 0x3D, 0x57, 0x72, 0xF6, 0x88, 0x35, 0xD8, 0x09, 0x1E, 0x94, 0x03, 0xA8, 0x31, 0x9F,
+    0x56, 0xB2, 0xAB, 0xD7, 0x6F, 0x59, 0xB5, 0x4D, 0x0A, 0x47, 0xCD, 0x3E, 0xC2, 0xCB, 0xEE, 0xBF,
+    0x79, 0xCC, 0x94, 0x79, 0xBA, 0x4F, 0xA4, 0x00, 0xDA, 0x3C, 0x1B, 0x5C, 0xDF, 0x9D, 0xFD, 0x17,
+    0x6C, 0x21, 0xCA, 0xC4, 0x70, 0xAF, 0x2A, 0x3B, 0x9F, 0x34, 0x85, 0x8B, 0x9A, 0xD0, 0x17, 0xAE,
+    0x08, 0xB8, 0xCD, 0xDF, 0xE0, 0x67, 0xB4, 0xE0, 0x33, 0xEB, 0xFD, 0xE6, 0xFD, 0xCB, 0xB0, 0x79,
+    0xB3, 0x32, 0xB7, 0x4E, 0xD6, 0x5A, 0x2C, 0x56, 0xDF, 0xDA, 0xBC, 0xEF, 0xC0, 0x83, 0x04, 0x9C,
+    0x8C, 0x3A, 0x1B, 0x25, 0xB8, 0x45, 0x65, 0xFE, 0xD8, 0x33, 0xC8, 0xF5, 0x7F, 0xC1, 0xB0, 0x73,
+    0x59, 0xE4, 0x3B, 0x53, 0xF2, 0x55, 0x78, 0x90, 0xE0, 0xC6, 0x0E, 0x3F, 0xD6, 0xCA, 0x99, 0x69,
+    0xBF, 0xC3, 0x77, 0x83, 0x1D, 0x7E, 0x27, 0x28, 0xB8, 0x03, 0xFA, 0x92, 0x31, 0xAC, 0x39, 0xD8,
+    0x4E, 0xD3, 0x54, 0xF3, 0x80, 0xF8, 0x88, 0xD7, 0xBD, 0x46, 0x22, 0x0C, 0x09, 0xBF, 0xE3, 0x81,
+    0x93, 0xFC, 0x0A, 0xE8, 0x8B, 0xF6, 0xD9, 0x9E, 0x1F, 0xA6, 0x85, 0x56, 0x13, 0x2D, 0xFD, 0x61,
+    0xB2, 0x2E, 0x9B, 0x97, 0x6E, 0x68, 0xA5, 0xB1, 0x6F, 0x9C, 0x6B, 0x0E, 0x2E, 0x37, 0xCC, 0x96,
+    0xC9, 0x2C, 0x97, 0x31, 0x98, 0xC9, 0xF8, 0x9A, 0x07, 0xA1, 0x49, 0x17, 0x2A, 0x6F, 0x7A, 0xAA,
+    0xDF, 0x6F, 0x78, 0x4C, 0xCB, 0xE3, 0xEB, 0xC1, 0x15, 0x78, 0x35, 0xE4, 0xF1, 0xE5, 0x7B, 0xEC,
+    0x2E, 0xFA, 0x86, 0x0F, 0xBE, 0x9F, 0xA4, 0x8D, 0x14, 0x01, 0x47, 0x18, 0xD4, 0xDA, 0xBF, 0xD4,
+    0xAE, 0x9F, 0x73, 0xD4, 0xCB, 0x0C, 0x18, 0xC6, 0x9A, 0xF9, 0x99, 0xDA, 0x76, 0x9C, 0x27, 0x7B,
+    0x0A, 0x33, 0x77, 0xB6, 0x8C, 0x24, 0xA2, 0x12, 0xF2, 0x03, 0x90, 0xCF, 0x40, 0x3C, 0xC9, 0xC7,
+    0x39, 0x5F, 0x1E, 0x11, 0x85, 0x2C, 0x91, 0x90, 0xD5, 0x33, 0x13, 0x77, 0xC8, 0xC2, 0xA5, 0x42,
+    0x2F, 0xA6, 0xCF, 0x9E, 0x70, 0x77, 0x6B, 0x90, 0x21, 0x8D, 0x65, 0xFC, 0x39, 0xBC, 0xDD, 0x83,
+    0xC1, 0xAB, 0x29, 0x98, 0xA9, 0xB4, 0x02, 0x63, 0x7D, 0x6D, 0x0A, 0xC0, 0xF1, 0xAB, 0xD2, 0x8A,
+    0xAB, 0xF8, 0xF6, 0x91, 0xA2, 0xB1, 0xCC, 0xC0, 0x96, 0xEA, 0xF7, 0x35, 0x8F, 0xA9, 0x78, 0xFC,
+    0x6A, 0x7B, 0x85, 0xBE, 0x5C, 0x19, 0xFE, 0x22, 0x1C, 0x5D, 0x4D, 0x6D, 0x69, 0x9A, 0x65, 0xC2,
+    0x7C, 0x8A, 0xBD, 0x46, 0x46, 0xFF, 0x95, 0x7A, 0xFD, 0x0D, 0x68, 0xE2, 0x35, 0xE9, 0x32, 0xB7,
+    0x2C, 0xCC, 0xEE, 0xA6, 0xB4, 0xC6, 0xA6, 0x24, 0x2B, 0xA4, 0x3E, 0xB1, 0x8D, 0xE0, 0x28, 0xBF,
+    0x27, 0xD1, 0x55, 0x59, 0x15, 0x1F, 0xF9, 0xAA, 0xB8, 0x96, 0x8F, 0xC7, 0xE7, 0xF2, 0xB8, 0x10,
+    0x35, 0x13, 0x89, 0x6F, 0x9E, 0x3E, 0x57, 0x78, 0xFF, 0xC1, 0xE9, 0x85, 0xD3, 0xC7, 0xDB, 0xDC,
+    0xA4, 0x8B, 0x99, 0x2B, 0x1D, 0x13, 0x73, 0x5A, 0xFA, 0xBE, 0x86, 0x3C, 0xCA, 0xFB, 0xE8, 0xFB,
+    0x75, 0xA9, 0x18, 0x5F, 0xBC, 0xB7, 0x3B, 0x5D, 0xDB, 0xB8, 0x0E, 0xD3, 0x35, 0x1F, 0x4E, 0xD7,
+    0x17, 0xFD, 0x1C, 0xCC, 0xD9, 0x23, 0x17, 0x9E, 0xFE, 0x4A, 0x68, 0x34, 0x32, 0xDA, 0xBD, 0x32,
+    0x9F, 0xCA, 0x30, 0xA1, 0x6C, 0x42, 0xAD, 0xC7, 0xAF, 0x5B, 0x7D, 0xFE, 0x3E, 0x27, 0x79, 0x73,
+    0xDB, 0x49, 0x7E, 0xE1, 0x4F, 0x1D, 0xF1, 0x85, 0x3D, 0xBA, 0xBD, 0xAC, 0xC7, 0x21, 0x83, 0xB3,
+    0x42, 0x35, 0xE2, 0x52, 0xB6, 0x80, 0x69, 0x7E, 0xC3, 0xF3, 0x4E, 0x55, 0x2F, 0x2C, 0x70, 0x20,
+    0x9C, 0xCF, 0x1C, 0xB4, 0x57, 0xC4, 0x8E, 0x66, 0x66, 0x69, 0xBF, 0x8F, 0xB6, 0x6F, 0x22, 0x28,
+    0x94, 0xFC, 0x3D, 0x05, 0x77, 0xF9, 0x8E, 0x5F, 0x03, 0x28, 0x5C, 0x82, 0xE4, 0x34, 0xBE, 0x5A,
+    0x24, 0xB6, 0xED, 0xD0, 0x68, 0x11, 0xC0, 0x2D, 0xA2, 0x3B, 0x93, 0x36, 0x3C, 0xA5, 0x1D, 0x57,
+    0x01, 0xE7, 0xBA, 0x27, 0xA6, 0x6D, 0xA4, 0x2F, 0x73, 0x92, 0x7E, 0xA4, 0xE0, 0xB2, 0xCD, 0x61,
+    0x8B, 0x5B, 0xBD, 0xA1, 0x2F, 0x5D, 0xC8, 0x18, 0x6A, 0x6B, 0x49, 0x84, 0x18, 0xA2, 0x31, 0x35,
+    0x52, 0x40, 0x39, 0x87, 0x9C, 0x5C, 0x1C, 0x09, 0xC3, 0x72, 0xB9, 0xD3, 0x9F, 0xB3, 0x1C, 0x13,
+    0xD6, 0x91, 0x05, 0x60, 0x99, 0xBE, 0x1F, 0x0A, 0x1B, 0xE9, 0xF6, 0xFD, 0x3D, 0xF4, 0x07, 0x19,
+    0xDC, 0x73, 0x9F, 0x22, 0x7C, 0x93, 0xAE, 0x43, 0xD1, 0xC9, 0x91, 0x55, 0x88, 0x20, 0x77, 0x16,
+    0x46, 0xB7, 0x4B, 0xC3, 0xDB, 0xA9, 0x5E, 0x2E, 0xDD, 0x29, 0xBC, 0xE3, 0xCB, 0x3C, 0x88, 0x9D,
+    0x33, 0xCD, 0x11, 0x92, 0x36, 0x0A, 0x2B, 0xAA, 0x3B, 0x75, 0x12, 0x4A, 0x84, 0x30, 0x4A, 0x38,
+    0xBF, 0x72, 0x48, 0xE4, 0x3F, 0x3E, 0x11, 0xCF, 0x0A, 0x31, 0x3E, 0x3F, 0x7F, 0xE2, 0xAF, 0xDE,
+    0x07, 0x96, 0xF1, 0xD5, 0x3E, 0x78, 0x42, 0xB8, 0xFE, 0x23, 0xA7, 0x99, 0x30, 0xC8, 0xBA, 0x55,
+    0x48, 0x7E, 0xB6, 0x55, 0x3E, 0x74, 0x0F, 0xD5, 0x43, 0xF3, 0x50, 0x3C, 0xF4, 0xBE, 0x85, 0x37,
+    0xEF, 0x85, 0xEC, 0xED, 0x2A, 0xF8, 0x00, 0x5C, 0x74, 0x49, 0xF7, 0x43, 0xF1, 0xD2, 0xE2, 0x73,
+    0x7B, 0x7B, 0xC0, 0x64, 0x40, 0x15, 0x1B, 0x4E, 0xB6, 0x8F, 0x6A, 0x9D, 0x61, 0x32, 0xA4, 0x03,
+    0xF3, 0xA2, 0x75, 0x7F, 0xE9, 0x23, 0xC0, 0xAC, 0xDF, 0x51, 0x24, 0xC1, 0x32, 0x92, 0x23, 0x7B,
+    0xFF, 0xC9, 0x96, 0x2A, 0xE2, 0xAC, 0xA5, 0x12, 0x8A, 0x4A, 0x66, 0xDB, 0x67, 0x55, 0x59, 0x84,
+    0x03, 0x38, 0x17, 0xD3, 0x8C, 0x6F, 0x9E, 0xC2, 0x17, 0x19, 0x93, 0xBA, 0x99, 0x56, 0x1A, 0xD2,
+    0x71, 0xFB, 0x63, 0x1D, 0xCB, 0xBB, 0x97, 0x4E, 0x1F, 0xDE, 0x4E, 0x6D, 0x32, 0x7B, 0xBC, 0x0A,
+    0xCB, 0xCF, 0x0F, 0xB5, 0xB6, 0x20, 0xEA, 0x09, 0x3B, 0xC3, 0x71, 0x94, 0x9D, 0xBE, 0xCE, 0xC8,
+    0x59, 0x6A, 0x0F, 0x6F, 0xB9, 0xFA, 0x54, 0xBA, 0xF1, 0xA7, 0xDA, 0xAF, 0x41, 0x14, 0xB7, 0x36,
+    0x2E, 0xD2, 0xCC, 0xC0, 0x52, 0x0B, 0xF6, 0x00, 0x7D, 0x8A, 0x00, 0x5A, 0xDC, 0x72, 0x0D, 0x6B,
+    0x04, 0xE0, 0x5E, 0xFA, 0x54, 0x20, 0x25, 0xF8, 0x67, 0x5A, 0xEE, 0xC5, 0xB7, 0x5F, 0x95, 0x2B,
+    0xCC, 0x76, 0x7D, 0xE3, 0x95, 0xBE, 0xEB, 0xCA, 0xDE, 0x72, 0x65, 0x5E, 0xDC, 0xC9, 0xA0, 0x36,
+    0x55, 0x3E, 0xAC, 0xB7, 0xAE, 0x9F, 0x9A, 0x7E, 0x3E, 0x9B, 0x95, 0x35, 0xC1, 0xF3, 0x7D, 0x54,
+    0x7F, 0x7D, 0xB6, 0x2B, 0x0F, 0xA8, 0xD6, 0xA6, 0x6A, 0x69, 0xAA, 0x6D, 0xE5, 0x5E, 0x25, 0xA3,
+    0x59, 0x67, 0x7F, 0xB3, 0x2A, 0xD5, 0x96, 0x46, 0xFD, 0xD5, 0x29, 0x5E, 0x19, 0x51, 0xD4, 0x98,
+    0x52, 0xC5, 0x17, 0x9E, 0x58, 0x37, 0xA6, 0x94, 0xBE, 0x2A, 0x42, 0x5F, 0x14, 0xA1, 0xAF, 0x89,
+    0xD0, 0x97, 0x44, 0xE8, 0xAB, 0x21, 0x8C, 0xD6, 0x5F, 0x93, 0xFE, 0x1F, 0xA5, 0x56, 0x31, 0x6C,
+    0x1C, 0xC7, 0x15, 0xFD, 0xBB, 0x4B, 0x72, 0x1D, 0x2D, 0xE0, 0xBD, 0xE2, 0x0E, 0x10, 0xA4, 0x04,
+    0xAB, 0x82, 0x85, 0x70, 0x08, 0x31, 0x8D, 0xCA, 0x3B, 0xCE, 0xA4, 0x48, 0x65, 0x18, 0xB9, 0x82,
+    0x84, 0x81, 0xA8, 0x90, 0x0B, 0x35, 0x21, 0x10, 0x08, 0xA9, 0x42, 0x03, 0xD4, 0xED, 0x38, 0x45,
+    0x52, 0xE6, 0x00, 0x97, 0x6A, 0x52, 0xA8, 0xA0, 0xAF, 0xB1, 0x0B, 0x17, 0x2C, 0x74, 0xDA, 0x41,
+    0x5C, 0xB8, 0x1D, 0xDB, 0x30, 0x52, 0x05, 0xDE, 0x18, 0x0C, 0x10, 0x24, 0x85, 0x37, 0xC8, 0x1A,
+    0x59, 0x11, 0xBB, 0x37, 0x79, 0x7F, 0xEE, 0x48, 0x93, 0xB4, 0x2C, 0x18, 0xC8, 0xEC, 0xCC, 0xCD,
+    0xDE, 0xEC, 0xCC, 0x9F, 0x3F, 0xFF, 0xBF, 0xFF, 0xFE, 0xCC, 0x9F, 0x92, 0x6C, 0x29, 0x75, 0x14,
+    0x3A, 0x43, 0x79, 0x49, 0x59, 0x4D, 0xC1, 0x84, 0x0E, 0x8E, 0xC9, 0x55, 0x91, 0x33, 0xC9, 0x92,
+    0x44, 0x4D, 0xB9, 0xA5, 0x01, 0x11, 0x0D, 0x8F, 0x89, 0xDC, 0x12, 0x13, 0x9D, 0x4A, 0x96, 0xCE,
+    0x66, 0xB5, 0xA8, 0x72, 0x9B, 0xB4, 0xF8, 0xB4, 0x47, 0x3D, 0x1A, 0x44, 0x4E, 0x4D, 0x53, 0xF7,
+    0x62, 0x29, 0x9C, 0x6B, 0xE5, 0x13, 0xD7, 0x4C, 0xA9, 0xB0, 0x7D, 0xDA, 0xA0, 0xC1, 0xFE, 0xBE,
+    0x92, 0xCE, 0x99, 0xF3, 0xC6, 0xFF, 0x0F, 0xE6, 0xF3, 0xF7, 0xDD, 0xA5, 0x82, 0xB1, 0xBD, 0x05,
+    0x85, 0x4D, 0x41, 0x71, 0x2D, 0xCF, 0x8A, 0x0A, 0x32, 0x6C, 0x8A, 0x7D, 0x02, 0xD7, 0x10, 0x05,
+    0x44, 0x9B, 0x13, 0xD1, 0xC8, 0x96, 0x9F, 0xA4, 0x84, 0x26, 0x24, 0x8D, 0x34, 0x85, 0xCD, 0xCB,
+    0xC2, 0x16, 0x65, 0x6E, 0x72, 0x7B, 0x4B, 0xDD, 0x52, 0x18, 0x2E, 0x1A, 0x2A, 0x1C, 0xAA, 0x22,
+    0xA7, 0x51, 0x03, 0x47, 0x69, 0x47, 0x69, 0x49, 0x37, 0x66, 0x7C, 0xA8, 0x6C, 0x49, 0xB9, 0xD3,
+    0xCF, 0x33, 0xD3, 0x26, 0x16, 0xF5, 0xF9, 0x23, 0xA8, 0xA3, 0xB3, 0x8E, 0x48, 0x51, 0x30, 0xFF,
+    0xFD, 0x9C, 0x22, 0xF7, 0x8B, 0x25, 0x16, 0x64, 0x0D, 0x8C, 0x20, 0x4B, 0x92, 0x96, 0xE5, 0x04,
+    0x1D, 0x1F, 0x6F, 0x42, 0x74, 0xA0, 0x68, 0x4E, 0xB2, 0x8A, 0x79, 0x8A, 0x68, 0x30, 0xD9, 0x95,
+    0x14, 0xE0, 0x38, 0x04, 0xA1, 0xD8, 0x7A, 0xB0, 0x07, 0xE3, 0xF8, 0x32, 0x97, 0xBF, 0x6B, 0xAF,
+    0xD5, 0xE1, 0xCF, 0x8E, 0x87, 0x7F, 0x9A, 0x6B, 0x92, 0x75, 0x5E, 0x51, 0xDA, 0xC2, 0xA4, 0xD1,
+    0x32, 0x69, 0xB1, 0x20, 0xEC, 0xF8, 0x2C, 0x05, 0x0E, 0xA8, 0x36, 0x89, 0x04, 0xCE, 0x90, 0xB3,
+    0x40, 0x4B, 0xCF, 0xE4, 0x27, 0xE5, 0xF4, 0x47, 0x89, 0x95, 0x4A, 0x18, 0x18, 0x43, 0xA7, 0xDE,
+    0xF0, 0x35, 0x26, 0x62, 0x2F, 0xF1, 0x82, 0x9D, 0xA0, 0x13, 0xE7, 0xAA, 0xCC, 0xB9, 0x5A, 0xDA,
+    0xA8, 0x95, 0x44, 0xDE, 0x11, 0x41, 0x17, 0x75, 0x71, 0x9B, 0xB4, 0x69, 0x83, 0x33, 0xD4, 0xB2,
+    0xCA, 0xAB, 0xC1, 0x24, 0xE9, 0xD2, 0x2E, 0x6D, 0x33, 0x6C, 0x2B, 0x2A, 0x59, 0x4A, 0x93, 0x9B,
+    0x01, 0x3C, 0x9D, 0x57, 0xB2, 0x12, 0x75, 0xD6, 0xA4, 0x98, 0x1D, 0xB5, 0x51, 0x47, 0x7B, 0x2F,
+    0x9B, 0x37, 0x7C, 0x9F, 0xB1, 0x01, 0x24, 0x50, 0x51, 0x12, 0x8E, 0x1D, 0x7B, 0x73, 0x60, 0xD4,
+    0x35, 0xA1, 0xB3, 0x31, 0x0C, 0xDC, 0x12, 0x6C, 0xC5, 0xF0, 0x18, 0xD3, 0x78, 0xB8, 0xC8, 0xBB,
+    0x61, 0xC7, 0x6F, 0x44, 0x47, 0x78, 0xA6, 0xC7, 0x79, 0x97, 0x1F, 0xF3, 0x1B, 0xD0, 0x33, 0x9F,
+    0xE5, 0xAE, 0x42, 0xA5, 0xF0, 0x3B, 0x35, 0x98, 0xD1, 0x7C, 0x46, 0xAE, 0x0C, 0x9C, 0x05, 0x0C,
+    0x63, 0xA7, 0x60, 0xD2, 0xBC, 0x65, 0x3B, 0x3C, 0xC4, 0x4A, 0x95, 0x58, 0x01, 0x43, 0x4C, 0x69,
+    0x97, 0xA4, 0xCE, 0xEC, 0x96, 0x25, 0x8A, 0x0C, 0x3F, 0xF7, 0xFF, 0xEE, 0x5C, 0xB1, 0x5C, 0xD9,
+    0x3D, 0xB6, 0xAB, 0x31, 0x7E, 0xDE, 0xFA, 0x82, 0x47, 0xF8, 0x2D, 0xD4, 0x03, 0x06, 0x1F, 0x3B,
+    0x9A, 0x0A, 0x73, 0xAD, 0x06, 0xCE, 0x00, 0x0F, 0x39, 0x76, 0xF3, 0x28, 0xF7, 0x90, 0xB9, 0x5A,
+    0x2D, 0x63, 0x09, 0x13, 0x84, 0x53, 0xF0, 0xFB, 0x96, 0xCA, 0xAB, 0xA2, 0x76, 0x35, 0xE0, 0xA9,
+    0xBF, 0x0F, 0x84, 0xAF, 0x86, 0xD9, 0x8D, 0x63, 0xD8, 0xB7, 0xC9, 0x2A, 0x1C, 0x07, 0xB6, 0x8D,
+    0x6A, 0xA0, 0x9D, 0x12, 0xA0, 0x07, 0xEA, 0x48, 0xD3, 0xCB, 0x8D, 0xD7, 0x54, 0xC1, 0xCC, 0xC1,
+    0x2C, 0xAE, 0x32, 0x23, 0x75, 0x41, 0x85, 0x2A, 0xFE, 0x99, 0x3B, 0xE1, 0xC2, 0x75, 0xBC, 0xCC,
+    0x79, 0xE7, 0x02, 0xE0, 0xE3, 0xF6, 0x8C, 0xA2, 0x2B, 0x8D, 0xBF, 0xDD, 0x0D, 0xF5, 0xDD, 0x51,
+    0x64, 0x46, 0xE2, 0xC1, 0x37, 0x0D, 0x42, 0xA8, 0x0A, 0x9E, 0xDE, 0x52, 0x07, 0x9A, 0xE6, 0x4A,
+    0x5C, 0xC2, 0x6E, 0x51, 0xB1, 0xD5, 0x2E, 0x63, 0xF7, 0x72, 0x74, 0xC7, 0x1C, 0xDD, 0x8D, 0xA8,
+    0x73, 0x1B, 0x7B, 0x50, 0x31, 0xB8, 0xA4, 0x0E, 0x5B, 0x71, 0x56, 0x78, 0x91, 0x11, 0x2F, 0x65,
+    0xC3, 0x07, 0xEA, 0x95, 0x60, 0x44, 0xD8, 0xF4, 0xE1, 0xCC, 0xC7, 0x99, 0x3B, 0xEB, 0x10, 0xF9,
+    0x6D, 0xFE, 0xC4, 0xD5, 0x8F, 0x5F, 0xCD, 0x0A, 0xF3, 0x19, 0x1F, 0xB2, 0xC2, 0xE1, 0x9C, 0x3F,
+    0xCD, 0x39, 0x41, 0xEC, 0xA3, 0xD0, 0xBA, 0x5C, 0x19, 0xEB, 0x7B, 0xE2, 0x91, 0x97, 0x89, 0x47,
+    0xFA, 0x2D, 0x10, 0xB1, 0x2F, 0x21, 0x99, 0xB5, 0x88, 0xC2, 0x0F, 0x2C, 0xAF, 0x76, 0xBC, 0x3D,
+    0x96, 0x78, 0xC2, 0xA1, 0x54, 0x79, 0xB7, 0xC4, 0xC0, 0x00, 0x00, 0x10, 0x82, 0x87, 0x32, 0x7E,
+    0xE5, 0x78, 0x2D, 0x57, 0x5F, 0x37, 0x56, 0xA2, 0x7E, 0x85, 0x86, 0xD1, 0x10, 0xE1, 0x1C, 0x81,
+    0xAC, 0xE0, 0x51, 0x4A, 0x60, 0xDD, 0x14, 0x28, 0x15, 0x30, 0xB0, 0x04, 0x54, 0x72, 0x96, 0x85,
+    0x69, 0x6C, 0xB1, 0xEB, 0xD3, 0x20, 0x2C, 0xE3, 0x69, 0xDC, 0xAE, 0x4D, 0xE3, 0xF6, 0x8A, 0x69,
+    0x5C, 0x7A, 0x34, 0xA5, 0x5C, 0x67, 0x26, 0xB1, 0x89, 0x11, 0x26, 0x57, 0xEF, 0xF8, 0xD1, 0xEB,
+    0xB0, 0x38, 0x87, 0x8B, 0x07, 0x2D, 0x1B, 0x09, 0x6D, 0x44, 0x34, 0x3A, 0x6F, 0xE3, 0xFD, 0xFD,
+    0x23, 0x1E, 0x1B, 0xCE, 0xE7, 0xC7, 0x80, 0x8B, 0x66, 0x1F, 0x8B, 0xA4, 0x3A, 0x61, 0x18, 0x31,
+    0x9C, 0x88, 0xB6, 0x6F, 0x2E, 0xA6, 0xB2, 0x4D, 0xAB, 0xAC, 0xCE, 0xBB, 0xA3, 0x71, 0x6F, 0x83,
+    0x54, 0x66, 0xA5, 0x7E, 0x8C, 0x38, 0x17, 0x94, 0x9A, 0xD8, 0xC4, 0x16, 0xBB, 0x43, 0x9B, 0x1F,
+    0xE2, 0x32, 0x90, 0x47, 0xB6, 0xA2, 0x14, 0x68, 0x84, 0xB8, 0x8B, 0xDB, 0x35, 0xA5, 0x14, 0x4D,
+    0xC0, 0x94, 0xA2, 0xBE, 0xA5, 0x94, 0x8B, 0xAC, 0x72, 0xD6, 0xAD, 0x9D, 0x5B, 0x9F, 0x67, 0x15,
+    0x62, 0x0A, 0xAB, 0x1F, 0x35, 0x71, 0x13, 0x57, 0xA9, 0x0D, 0x2E, 0x36, 0xAA, 0x48, 0xBE, 0xEB,
+    0x3E, 0x6F, 0x8B, 0x3F, 0xBB, 0x3F, 0x2C, 0xDD, 0xE7, 0x2E, 0x59, 0x16, 0x1F, 0x77, 0x71, 0x77,
+    0x2B, 0x6E, 0x83, 0xA7, 0x9C, 0x03, 0xD8, 0xF7, 0xC6, 0x3F, 0xA7, 0x39, 0x67, 0x93, 0x06, 0x67,
+    0x9E, 0x6B, 0x1C, 0x1E, 0x28, 0x9C, 0xCF, 0x3F, 0x30, 0x20, 0xAE, 0xF8, 0xD2, 0xCF, 0x88, 0xA9,
+    0xE6, 0x87, 0x1C, 0xEA, 0xA5, 0x9C, 0x0F, 0xF2, 0xEB, 0x86, 0x0B, 0x4F, 0x87, 0xFC, 0x04, 0x9A,
+    0x82, 0xF7, 0xFE, 0x36, 0xCB, 0xDC, 0xC7, 0xA5, 0x74, 0xFF, 0xB2, 0x0B, 0x44, 0x7B, 0x33, 0x75,
+    0x34, 0x39, 0x81, 0xAC, 0x3B, 0xB4, 0x8A, 0xA6, 0x14, 0xCE, 0x46, 0x0A, 0xF6, 0x3D, 0x52, 0x1D,
+    0x94, 0x3E, 0x49, 0xDC, 0xBB, 0x0D, 0x47, 0x96, 0xF8, 0xDA, 0x55, 0x12, 0x9C, 0x35, 0x08, 0xF6,
+    0xBF, 0x33, 0x6F, 0x5D, 0x54, 0xD2, 0x45, 0x56, 0xB8, 0xAF, 0x8D, 0x7C, 0xE4, 0xF4, 0x51, 0xB8,
+    0xF4, 0x83, 0x71, 0xC3, 0x63, 0x4F, 0x8C, 0x2C, 0x30, 0x06, 0xC6, 0xEE, 0xAF, 0xFD, 0x14, 0x98,
+    0x7B, 0x94, 0x7C, 0x31, 0x65, 0x44, 0xF8, 0x14, 0xE3, 0x8F, 0xAC, 0xEF, 0xAC, 0x45, 0x85, 0x3A,
+    0x2E, 0xB3, 0xE6, 0xF6, 0x3F, 0x22, 0xBB, 0x7A, 0xF2, 0x1A, 0x1E, 0xCB, 0xBA, 0x75, 0xF7, 0xCE,
+    0x84, 0xF6, 0x69, 0xF3, 0xD7, 0x87, 0x7E, 0xEA, 0x0E, 0xBA, 0xBE, 0xEF, 0x5E, 0x1F, 0x7D, 0x48,
+    0x3B, 0x44, 0xAF, 0xF7, 0x3F, 0x24, 0x6F, 0x38, 0xB6, 0x5D, 0xA8, 0xB9, 0xD2, 0x6B, 0x18, 0xD9,
+    0xA6, 0xDE, 0x4F, 0xD0, 0x1D, 0x6E, 0x1C, 0xB2, 0xFF, 0x7A, 0x3B, 0x87, 0xAC, 0xC8, 0xC6, 0xCE,
+    0xE1, 0x88, 0x85, 0xEC, 0x1C, 0x6E, 0xA3, 0xBB, 0xB9, 0xB3, 0x96, 0xB9, 0xED, 0x67, 0xDE, 0x24,
+    0xEE, 0xEE, 0x79, 0xDB, 0xB0, 0x79, 0xD6, 0x32, 0x83, 0x37, 0xE9, 0x37, 0x8A, 0xD6, 0xFB, 0x61,
+    0xC1, 0xDD, 0x95, 0x12, 0xF4, 0x6D, 0x77, 0x55, 0xDD, 0x1E, 0x52, 0x87, 0x38, 0x0D, 0xDB, 0x00,
+    0xEC, 0x2B, 0x15, 0xEF, 0x93, 0x68, 0x90, 0xAB, 0x6A, 0xA9, 0x45, 0xB4, 0x21, 0x80, 0x34, 0x84,
+    0x17, 0xA7, 0x88, 0xF6, 0x25, 0xB0, 0x09, 0x3A, 0xB1, 0xE0, 0x73, 0x4A, 0xEC, 0x42, 0x7C, 0x52,
+    0xF6, 0xF3, 0x4F, 0x15, 0x67, 0x22, 0x1F, 0x7B, 0x28, 0xFD, 0xDE, 0xF8, 0xE8, 0x3C, 0x14, 0x7E,
+    0xCA, 0x9A, 0x6F, 0xD0, 0xD1, 0xED, 0x46, 0x72, 0xA6, 0xAE, 0x40, 0x02, 0x3F, 0xEE, 0xC1, 0xD3,
+    0xB2, 0x8C, 0xD7, 0x7B, 0xDD, 0x23, 0xBE, 0x97, 0x34, 0x04, 0x4E, 0xD2, 0x52, 0x25, 0x75, 0xA1,
+    0xE3, 0xFA, 0xBF, 0x46, 0xFC, 0xFB, 0x3F, 0x76, 0x19, 0x7D, 0x5A, 0x95, 0x91, 0xA9, 0xF8, 0x2B,
+    0xEE, 0x2C, 0x2A, 0x83, 0x16, 0xB9, 0x76, 0xD0, 0x68, 0x82, 0x4C, 0x83, 0xCC, 0xDD, 0xE4, 0x8D,
+    0xAC, 0xB3, 0x32, 0xD4, 0x91, 0xF9, 0xED, 0x5F, 0x8B, 0xE5, 0x83, 0x6F, 0xB2, 0x7A, 0xF7, 0xD9,
+    0x6B, 0x77, 0xB6, 0x1A, 0x31, 0x63, 0x38, 0x8C, 0x93, 0xF2, 0x88, 0x03, 0x94, 0x1B, 0xBF, 0xF3,
+    0x58, 0xDC, 0x08, 0xBB, 0x01, 0x0F, 0x8C, 0x48, 0x76, 0xC8, 0x9F, 0x23, 0x98, 0xE8, 0xED, 0x15,
+    0x5C, 0x37, 0x27, 0xB9, 0x57, 0x1F, 0x7A, 0x36, 0xEC, 0x7B, 0xBE, 0x51, 0xCC, 0x88, 0x1E, 0x71,
+    0x20, 0xBA, 0x33, 0xC4, 0xD6, 0x9A, 0x13, 0x71, 0xCE, 0x84, 0xB9, 0x90, 0xE7, 0xDE, 0x76, 0x4B,
+    0x28, 0xFF, 0xFF, 0xAE, 0x1F, 0x70, 0x78, 0xEC, 0xE5, 0xFC, 0xB1, 0x5B, 0xFD, 0xAE, 0x00, 0xF6,
+    0x7D, 0xE3, 0xAB, 0x6C, 0x14, 0xCC, 0x58, 0xAE, 0x02, 0xB6, 0x33, 0x9F, 0xF5, 0x0A, 0x2B, 0x57,
+    0xC1, 0x66, 0xF2, 0xD9, 0x2F, 0xB9, 0xA7, 0x05, 0x26, 0x7D, 0xC0, 0xD7, 0xC3, 0x8B, 0xB2, 0xC5,
+    0xDC, 0x4D, 0x9C, 0x8D, 0xDC, 0x8B, 0x15, 0xD3, 0xB1, 0x3E, 0xA1, 0x5F, 0xD6, 0x40, 0xAD, 0x53,
+    0x0A, 0x90, 0xB4, 0x32, 0x5E, 0xB2, 0xE5, 0xB4, 0xB4, 0x3C, 0x39, 0x37, 0x07, 0x7E, 0x2D, 0x6E,
+    0x88, 0x57, 0xCA, 0xF6, 0xBA, 0xDF, 0xA5, 0xA1, 0xCF, 0x0A, 0x85, 0x59, 0xEF, 0x5F, 0xAD, 0xFB,
+    0x75, 0xCC, 0x31, 0x19, 0x73, 0x19, 0x5D, 0x10, 0x72, 0xC0, 0x37, 0x26, 0xBD, 0x99, 0x18, 0xBA,
+    0x6F, 0x52, 0xB0, 0x4A, 0x6C, 0x76, 0x13, 0x4E, 0xEC, 0xC9, 0x57, 0x06, 0xD7, 0x1C, 0xB1, 0xA4,
+    0xC7, 0x99, 0x5A, 0x3C, 0xD0, 0x08, 0x38, 0xD8, 0x6C, 0xC1, 0x6A, 0x12, 0xF2, 0xF2, 0xC3, 0xE6,
+    0xED, 0xBD, 0x66, 0x55, 0x3E, 0x42, 0xD0, 0x43, 0x82, 0x78, 0xC3, 0xEE, 0x46, 0xE5, 0x6E, 0x54,
+    0xA1, 0x8A, 0x18, 0xB7, 0x61, 0x83, 0xCB, 0xE2, 0xDE, 0xA6, 0x6A, 0x52, 0x7D, 0xB9, 0xB6, 0x99,
+    0x46, 0x5C, 0x8B, 0xBF, 0x28, 0xBF, 0x2F, 0x89, 0x9F, 0x43, 0x65, 0xBE, 0x7E, 0xE1, 0x57, 0x06,
+    0x4C, 0xB4, 0x7C, 0xC5, 0x0C, 0x67, 0x7C, 0x39, 0x88, 0xCA, 0xE0, 0xBD, 0x32, 0x75, 0xA5, 0xBC,
+    0x0F, 0xB1, 0xE5, 0x98, 0x85, 0x97, 0x12, 0x51, 0xEE, 0xCA, 0xF8, 0x2B, 0xFB, 0x94, 0x71, 0xE8,
+    0xEB, 0x43, 0x10, 0x1B, 0x2D, 0x85, 0x6E, 0xAF, 0x6E, 0x74, 0x92, 0xE8, 0xC9, 0xC3, 0x1B, 0xAA,
+    0xC0, 0xDD, 0xE1, 0xF9, 0x83, 0xCF, 0xEA, 0x67, 0xA9, 0x41, 0xD3, 0x57, 0xDA, 0x61, 0xA2, 0xEA,
+    0xFE, 0xF6, 0xB8, 0x95, 0xA7, 0xBB, 0x17, 0xA4, 0x37, 0xE6, 0x5C, 0x4A, 0x62, 0x52, 0xD4, 0x82,
+    0xCE, 0x9F, 0xAC, 0x89, 0xEB, 0x3E, 0x4D, 0xF8, 0x60, 0x91, 0x4D, 0xDF, 0x30, 0xE9, 0x1F, 0x75,
+    0xFC, 0x25, 0xAE, 0xC4, 0x3E, 0xED, 0x9D, 0xD0, 0x20, 0x98, 0x88, 0xC4, 0xA4, 0x5F, 0x2A, 0x8C,
+    0x20, 0xA2, 0xF0, 0x8B, 0x77, 0x8C, 0x8C, 0xC3, 0xF2, 0x7F, 0xED, 0x7D, 0x3F, 0x90, 0x1C, 0x67,
+    0x76, 0x5F, 0xF7, 0xCC, 0x61, 0xE7, 0xCC, 0x71, 0x5D, 0x5F, 0x60, 0x48, 0x65, 0x42, 0xAE, 0xBE,
+    0xC4, 0xAE, 0x32, 0x65, 0xA9, 0x13, 0x07, 0x0E, 0x64, 0x75, 0x9F, 0x55, 0xE5, 0x0B, 0x2E, 0xD0,
+    0x06, 0x3B, 0x64, 0x59, 0x08, 0x18, 0xB9, 0x2C, 0x1F, 0x5D, 0xB5, 0x89, 0x02, 0x07, 0x27, 0xF7,
+    0x50, 0x2A, 0x97, 0xC2, 0x83, 0x5D, 0xA6, 0x14, 0x38, 0x10, 0x02, 0xB0, 0x8A, 0x37, 0x28, 0x17,
+    0x1C, 0x28, 0x38, 0x55, 0x9D, 0xAF, 0xE7, 0xC8, 0xE0, 0x02, 0x07, 0xD7, 0x14, 0x7D, 0xA5, 0x80,
+    0x01, 0x47, 0x16, 0x78, 0x27, 0xE1, 0x02, 0x36, 0xC9, 0x86, 0xD8, 0x58, 0x74, 0xF7, 0xE7, 0xF7,
+    0xFB, 0xBD, 0xF7, 0xF5, 0xF4, 0xCC, 0xEE, 0x02, 0x0B, 0x10, 0x02, 0x09, 0x5A, 0x8B, 0xDD, 0xF7,
+    0x3E, 0xCC, 0xF4, 0x9F, 0xEF, 0xEF, 0xFB, 0xDE, 0xFF, 0xEF, 0xB9, 0x55, 0x10, 0xCC, 0xDC, 0x3A,
+    0x08, 0x5D, 0x19, 0x04, 0x79, 0x15, 0x04, 0x51, 0x1B, 0x04, 0xD3, 0x3E, 0x08, 0x82, 0xA3, 0x00,
+    0x3F, 0x85, 0x73, 0xBD, 0xDB, 0xFF, 0x91, 0xCB, 0xCE, 0xFC, 0x73, 0xAE, 0xDB, 0xF9, 0xBB, 0xBB,
+    0x38, 0x7A, 0xC0, 0xB5, 0xA7, 0x9E, 0x8B, 0xF7, 0xCD, 0xAB, 0x79, 0x15, 0x35, 0x71, 0x13, 0xB7,
+    0x49, 0x03, 0x8C, 0xFF, 0x07, 0xF6, 0xF3, 0x34, 0xEB, 0xF2, 0xC2, 0x4A, 0x7E, 0x96, 0x41, 0x8E,
+    0xF2, 0x3E, 0x4A, 0x15, 0x05, 0x53, 0x80, 0x87, 0xA1, 0xFF, 0xBC, 0xCA, 0x80, 0x9C, 0x6B, 0x15,
+    0xB9, 0x4C, 0x51, 0xA9, 0xA8, 0x12, 0x74, 0x7B, 0xE2, 0x6A, 0xDE, 0x90, 0x37, 0x44, 0x69, 0x7B,
+    0x3E, 0xCA, 0x89, 0x42, 0x87, 0x2B, 0x5F, 0xD5, 0xDB, 0x05, 0x6D, 0x14, 0x2D, 0x89, 0x3A, 0x76,
+    0xD6, 0x42, 0x5E, 0x1B, 0x3C, 0x27, 0xA3, 0x1B, 0xA4, 0xF8, 0x20, 0xAF, 0x05, 0xC8, 0x38, 0xCB,
+    0x15, 0xE8, 0x65, 0xA9, 0x4C, 0x10, 0x1E, 0x5A, 0xBF, 0xA2, 0x59, 0x4B, 0xE9, 0x5C, 0xB7, 0xDE,
+    0x07, 0xE8, 0xFA, 0xA7, 0x06, 0xFC, 0x4F, 0xE2, 0xEE, 0x05, 0xC1, 0xC4, 0xA1, 0x55, 0x31, 0x7B,
+    0x08, 0x75, 0x29, 0x43, 0xE7, 0xEE, 0xB8, 0xF5, 0x54, 0x7A, 0x6A, 0x96, 0xCD, 0xD1, 0x90, 0x20,
+    0x72, 0x68, 0x62, 0xCC, 0x69, 0x93, 0xB0, 0xD1, 0x69, 0x4B, 0x28, 0x97, 0xD7, 0x84, 0xCD, 0x2E,
+    0xEC, 0x57, 0xAB, 0x1B, 0x76, 0x8D, 0x5E, 0x1F, 0x63, 0x9E, 0xCB, 0x73, 0x14, 0xE2, 0x99, 0x33,
+    0xB9, 0x33, 0x5C, 0xCA, 0xCB, 0x5F, 0xBB, 0xB5, 0xC6, 0xBC, 0x90, 0x0F, 0x53, 0xC2, 0x39, 0xA1,
+    0x54, 0x05, 0xB7, 0x84, 0x0B, 0x5F, 0xD7, 0x2B, 0xF2, 0xDC, 0x10, 0xD5, 0x9B, 0xA1, 0xBE, 0x11,
+    0x2E, 0x4A, 0xDC, 0xCA, 0xAD, 0xE5, 0x2D, 0xF3, 0x2C, 0x6D, 0x50, 0x9B, 0xDA, 0x57, 0x2C, 0xED,
+    0xD9, 0xB8, 0x12, 0xEF, 0xEA, 0x38, 0x19, 0x4A, 0xCC, 0xBD, 0x16, 0x1F, 0x3A, 0xB6, 0x78, 0x6D,
+    0xDF, 0x4F, 0x31, 0x2B, 0x39, 0x35, 0x7D, 0xF7, 0xFC, 0x47, 0xFC, 0x37, 0x7F, 0xFF, 0xAA, 0x2B,
+    0x31, 0x58, 0x6B, 0x80, 0x2C, 0xC7, 0xBD, 0x73, 0x3E, 0xE5, 0x92, 0x0C, 0x65, 0xB1, 0x71, 0xD5,
+    0xA3, 0xFF, 0x8B, 0x5F, 0x6D, 0xD2, 0x77, 0xFA, 0xFC, 0x2F, 0xF1, 0x9B, 0xBE, 0xD9, 0x5D, 0x0A,
+    0x6C, 0x52, 0x84, 0x6E, 0x3D, 0x79, 0xA2, 0xBF, 0xD2, 0xB5, 0x32, 0xEF, 0x9E, 0xD2, 0x1F, 0x86,
+    0x34, 0xEA, 0x39, 0xF5, 0xD1, 0x49, 0x18, 0x7D, 0x4C, 0x24, 0xAC, 0x90, 0xE3, 0xDB, 0x98, 0xFF,
+    0x58, 0xF2, 0x81, 0x0E, 0xBB, 0x11, 0x9E, 0x87, 0x95, 0x5A, 0x9B, 0x27, 0x17, 0x29, 0xAD, 0x0E,
+    0x7D, 0x89, 0x74, 0x22, 0xD6, 0x52, 0x3D, 0x94, 0xBA, 0xA1, 0x24, 0x37, 0xC5, 0x0D, 0xEE, 0xCD,
+    0x65, 0x32, 0x27, 0x2C, 0x61, 0x72, 0x6B, 0x69, 0x8A, 0x52, 0xED, 0x4B, 0x29, 0x4B, 0x93, 0xA1,
+    0xC4, 0xCF, 0x2A, 0x94, 0x40, 0xBF, 0x0B, 0x96, 0x62, 0xB7, 0xBC, 0x29, 0xCB, 0x26, 0x72, 0x37,
+    0xE5, 0xC9, 0x98, 0x19, 0x11, 0x1B, 0x8A, 0x99, 0x15, 0x39, 0xED, 0x05, 0x6D, 0x54, 0x19, 0x60,
+    0xDE, 0x49, 0x49, 0x96, 0xDA, 0xA5, 0xCC, 0xCF, 0x66, 0xD0, 0xFF, 0x62, 0x63, 0xB3, 0x6E, 0x98,
+    0x7E, 0x4F, 0xA4, 0x70, 0xB2, 0x5A, 0xB9, 0x93, 0xEF, 0x66, 0x5C, 0xCB, 0xAC, 0x89, 0x15, 0x94,
+    0xF0, 0xE0, 0x67, 0xE3, 0x0B, 0x95, 0xDE, 0x35, 0x71, 0x8D, 0xDD, 0x9E, 0xB7, 0x56, 0x48, 0x7D,
+    0x21, 0x39, 0x55, 0xF0, 0x5F, 0x85, 0x4E, 0x0B, 0x27, 0x85, 0xAB, 0x0B, 0xA5, 0xED, 0xF6, 0x40,
+    0x4F, 0xD0, 0xD8, 0x23, 0x56, 0xB8, 0xA6, 0xB4, 0x3C, 0x7B, 0x02, 0x74, 0xFE, 0xD5, 0x85, 0xD1,
+    0xF9, 0xE6, 0x5C, 0x3A, 0xFF, 0xFE, 0xCC, 0xE8, 0x7C, 0x61, 0x74, 0xFE, 0x53, 0xA3, 0x60, 0xB2,
+    0x5A, 0x0E, 0x94, 0x50, 0x69, 0x5A, 0x4E, 0x52, 0x4A, 0x62, 0x36, 0xD1, 0x29, 0x7E, 0x14, 0x8C,
+    0xC6, 0x57, 0xF6, 0xF9, 0x02, 0x75, 0x41, 0x57, 0xCC, 0x5D, 0x26, 0x30, 0x66, 0x6F, 0x08, 0x85,
+    0x12, 0x58, 0xD4, 0x02, 0x43, 0x99, 0x41, 0x45, 0x35, 0xE5, 0xA4, 0xC2, 0x62, 0x2A, 0x2A, 0xD0,
+    0xC9, 0xE2, 0xAE, 0x6C, 0x3D, 0x18, 0xB5, 0x8A, 0x70, 0x33, 0x82, 0x35, 0xBE, 0x2D, 0xF0, 0x6D,
+    0x95, 0xF0, 0x7A, 0xD4, 0xA7, 0xA8, 0x74, 0x5A, 0x4E, 0x40, 0xC0, 0x65, 0xE9, 0xE1, 0xC9, 0xD8,
+    0xBD, 0x04, 0xCA, 0x45, 0x9C, 0xAE, 0x78, 0xFB, 0x8C, 0x35, 0x99, 0xDA, 0x18, 0xD5, 0xB2, 0x63,
+    0x65, 0x81, 0x72, 0x24, 0x68, 0xC5, 0x26, 0xF0, 0x14, 0x54, 0xB7, 0x2C, 0x99, 0xFE, 0xBA, 0xB9,
+    0x8D, 0x67, 0x2C, 0x47, 0x7C, 0x42, 0x38, 0x25, 0x9C, 0x13, 0x46, 0x84, 0x09, 0x61, 0x4A, 0x58,
+    0x7C, 0x00, 0xE8, 0xDE, 0x6B, 0x51, 0xAB, 0x97, 0x5B, 0xB4, 0x31, 0x16, 0x38, 0xEF, 0x00, 0xA3,
+    0x16, 0x30, 0xA9, 0x31, 0xA3, 0xD2, 0x0A, 0xB0, 0x28, 0x01, 0x85, 0xA0, 0xB7, 0xC5, 0x47, 0x2E,
+    0x13, 0xF8, 0xB1, 0xC3, 0x7C, 0xBB, 0xDF, 0x02, 0xCA, 0x30, 0x03, 0x72, 0x06, 0x4A, 0x35, 0x01,
+    0xD7, 0x84, 0x4B, 0xC2, 0x00, 0xB0, 0x07, 0x1C, 0x76, 0xB5, 0x8A, 0x75, 0x8F, 0x1B, 0x6E, 0xC0,
+    0x51, 0xFF, 0x72, 0xCF, 0x76, 0x3A, 0xEE, 0xC4, 0xEC, 0x55, 0xB9, 0xA6, 0xCF, 0x82, 0xBD, 0x1F,
+    0xEC, 0xDB, 0x32, 0x08, 0xD8, 0x40, 0x84, 0xA0, 0x25, 0x9E, 0x72, 0x70, 0x4B, 0xC1, 0xE0, 0xA4,
+    0x36, 0xA3, 0x38, 0xA6, 0xE8, 0xB0, 0x10, 0x5B, 0xE5, 0x5A, 0x17, 0xD0, 0x12, 0x1D, 0xC4, 0xF7,
+    0xA5, 0xCD, 0x8C, 0x6F, 0x6F, 0x23, 0x4C, 0x92, 0x48, 0x5A, 0xCC, 0xB7, 0x27, 0x0D, 0xE7, 0x2E,
+    0xE7, 0xCC, 0xC4, 0x69, 0x77, 0x73, 0x43, 0xC1, 0xB8, 0xAE, 0x75, 0x33, 0xCD, 0x74, 0x4F, 0x66,
+    0x6D, 0x52, 0x9D, 0x51, 0x18, 0xEB, 0xE0, 0xE0, 0x26, 0x06, 0x1E, 0xA4, 0x74, 0xA3, 0x68, 0xAD,
+    0x88, 0x83, 0xC5, 0xAF, 0xFC, 0x38, 0xE1, 0xF1, 0x29, 0x57, 0x63, 0xFE, 0xD9, 0x41, 0x10, 0xA0,
+    0x9A, 0x24, 0xE6, 0x0C, 0xE8, 0x97, 0xCD, 0x79, 0xF0, 0x85, 0xEB, 0xDA, 0x09, 0x4B, 0xED, 0x92,
+    0xB5, 0x72, 0x4D, 0xA5, 0x76, 0x97, 0xF5, 0x5A, 0xC5, 0x81, 0xBC, 0x55, 0xB3, 0x47, 0x5F, 0xD6,
+    0x8E, 0x05, 0x33, 0x2D, 0x9D, 0xA1, 0x9D, 0xDE, 0xCF, 0x39, 0xF2, 0x1D, 0x47, 0x22, 0x69, 0xA7,
+    0xE8, 0xD9, 0xB4, 0x01, 0x41, 0x97, 0xFA, 0x71, 0xCC, 0x30, 0x3B, 0x37, 0x24, 0x67, 0xAE, 0x22,
+    0x5B, 0x21, 0x35, 0x9B, 0x28, 0xB9, 0x24, 0x11, 0x69, 0x31, 0x61, 0xB0, 0x7D, 0xCC, 0xDD, 0x9D,
+    0x95, 0x4C, 0xAF, 0x48, 0xB7, 0x3A, 0x2C, 0x4F, 0x59, 0xCB, 0xE0, 0xF3, 0x66, 0x6E, 0x99, 0x92,
+    0xD1, 0x5C, 0xE7, 0xA0, 0x0E, 0xAE, 0x44, 0xDB, 0x42, 0x61, 0x1D, 0x3C, 0x81, 0x3D, 0x05, 0xCE,
+    0x65, 0xC9, 0x4E, 0x5E, 0x27, 0xB5, 0xBE, 0x47, 0x4A, 0x4D, 0x2A, 0x5D, 0x01, 0x08, 0x51, 0x3E,
+    0xD0, 0x35, 0xD5, 0x81, 0x78, 0x10, 0xF4, 0xBE, 0x94, 0x00, 0x14, 0x6D, 0x71, 0x72, 0x4B, 0xAE,
+    0xF3, 0x77, 0x94, 0x05, 0x29, 0x2E, 0xA8, 0x6D, 0xE1, 0x4E, 0xAE, 0x29, 0x29, 0xCE, 0x08, 0x37,
+    0x81, 0xB6, 0xCE, 0xC9, 0x0D, 0x2D, 0x49, 0x7D, 0x47, 0xAA, 0x4E, 0x18, 0x8F, 0xCA, 0x69, 0x4B,
+    0xDA, 0x5E, 0x6F, 0xEF, 0xEA, 0xF5, 0x39, 0xCB, 0x40, 0xBB, 0x49, 0xF8, 0x7B, 0x7D, 0x42, 0xD2,
+    0x03, 0x4A, 0xAF, 0x9C, 0x09, 0x53, 0x81, 0x27, 0x2B, 0xD7, 0x05, 0xDA, 0x9D, 0x4A, 0x99, 0x87,
+    0xE7, 0xDC, 0xFE, 0xFC, 0xF0, 0xC2, 0x53, 0x65, 0x3E, 0x2F, 0x80, 0xC9, 0x12, 0x9C, 0xC2, 0xB3,
+    0xF3, 0x70, 0xAF, 0x78, 0xBE, 0x8F, 0x3B, 0xC5, 0x91, 0xC7, 0xED, 0x2E, 0x4E, 0x0C, 0xA7, 0xB5,
+    0xE2, 0xBC, 0x52, 0x2C, 0x83, 0x01, 0xFC, 0x8A, 0xF4, 0xEA, 0x4D, 0x77, 0xE2, 0x37, 0xF3, 0xF3,
+    0x71, 0xA5, 0x7B, 0xE6, 0xC3, 0xF0, 0xB7, 0xAE, 0x61, 0x35, 0xAD, 0xB2, 0xA7, 0x29, 0xF2, 0x81,
+    0x26, 0xCA, 0x9A, 0x9E, 0xEB, 0xBA, 0x92, 0x92, 0x4C, 0xBD, 0x19, 0x26, 0x46, 0x89, 0xAD, 0x16,
+    0xAD, 0x04, 0xDB, 0xA4, 0x0F, 0x00, 0x91, 0x2D, 0x49, 0x9D, 0x5D, 0x39, 0xB5, 0xFE, 0x71, 0x25,
+    0x79, 0x40, 0x4C, 0xB4, 0x32, 0xEE, 0x48, 0x5F, 0x33, 0x57, 0x92, 0xF5, 0x97, 0x9B, 0xB9, 0xEF,
+    0x82, 0x50, 0xBC, 0x2F, 0xFF, 0x4A, 0x2F, 0x76, 0x79, 0x22, 0xEB, 0xD9, 0x4C, 0x63, 0x47, 0x54,
+    0xD8, 0xD5, 0x6F, 0x43, 0xF7, 0x37, 0xEE, 0xA7, 0x24, 0x32, 0x53, 0x59, 0xCE, 0xA5, 0x11, 0xDD,
+    0xA5, 0x48, 0x02, 0xAD, 0x7F, 0x1B, 0xC9, 0x32, 0x78, 0xDD, 0x92, 0x9C, 0x40, 0x81, 0xBA, 0xCC,
+    0x75, 0x13, 0x60, 0xFD, 0x20, 0x1E, 0x6E, 0xAC, 0xF6, 0x33, 0x6D, 0x47, 0xD1, 0x92, 0x6B, 0x40,
+    0xDB, 0x3A, 0xAC, 0x19, 0x94, 0x44, 0x94, 0xCA, 0xAD, 0x0F, 0xB4, 0x5E, 0x41, 0xC8, 0xBD, 0x0D,
+    0x8B, 0x8D, 0x52, 0x10, 0xC0, 0x26, 0x3E, 0xB9, 0xE9, 0xAA, 0xAF, 0x70, 0xB3, 0x0E, 0x02, 0x15,
+    0x71, 0x06, 0x39, 0x07, 0x4D, 0x9C, 0xE1, 0x3D, 0xBA, 0xC0, 0x1B, 0x74, 0xF4, 0x3D, 0xF6, 0xF6,
+    0x3A, 0x58, 0xDC, 0x52, 0x4E, 0xB0, 0xF1, 0xF2, 0x50, 0x32, 0x80, 0xB4, 0xFD, 0x1A, 0x6A, 0x9D,
+    0xBF, 0x7E, 0xD5, 0x35, 0xE8, 0x95, 0x6A, 0x10, 0x72, 0x44, 0xC0, 0xC2, 0xAA, 0xBC, 0x74, 0xF4,
+    0x0C, 0x6D, 0xF5, 0xC5, 0x1A, 0xBC, 0x4A, 0xBE, 0x01, 0xF1, 0x4F, 0xEF, 0x81, 0x0E, 0xC7, 0x9C,
+    0xB3, 0x33, 0x1D, 0xCF, 0xE2, 0xDE, 0xDE, 0x0E, 0xFF, 0xB9, 0x6F, 0xD7, 0x33, 0xC0, 0x36, 0xCE,
+    0x75, 0xDD, 0x44, 0x0F, 0x42, 0xD8, 0x3D, 0xF7, 0x51, 0xFC, 0x00, 0x94, 0x18, 0x6A, 0xCE, 0x40,
+    0xA9, 0xA1, 0xFA, 0x0C, 0x94, 0x57, 0x44, 0x5C, 0x6B, 0x19, 0xC4, 0x31, 0xD0, 0x01, 0x59, 0x14,
+    0x44, 0x6B, 0x45, 0x4A, 0x1C, 0x1A, 0xA2, 0xCB, 0x99, 0x69, 0x61, 0xC8, 0x62, 0xC8, 0x6E, 0x93,
+    0x91, 0xC7, 0x20, 0x03, 0x96, 0x1B, 0xE6, 0x2E, 0x54, 0x1A, 0x06, 0x93, 0x27, 0xF8, 0x03, 0xE9,
+    0x80, 0x5E, 0xF0, 0x7B, 0xC2, 0x02, 0x76, 0xC0, 0x52, 0xA7, 0x56, 0xF0, 0xBB, 0xB2, 0xB4, 0x1B,
+    0xC1, 0x7F, 0xDE, 0x05, 0x51, 0x2D, 0xF8, 0x9D, 0x3E, 0x88, 0x2B, 0x60, 0x61, 0x23, 0xFF, 0x42,
+    0xF0, 0xDB, 0x82, 0xDF, 0x16, 0x5C, 0xBA, 0x65, 0xFE, 0x43, 0xE2, 0x75, 0xF1, 0x2A, 0x70, 0xB1,
+    0x76, 0x5F, 0x07, 0x96, 0x6F, 0x43, 0xE2, 0x8F, 0x7A, 0xE2, 0xE4, 0xE3, 0x8E, 0x38, 0x76, 0x2D,
+    0x71, 0xE4, 0x1A, 0x62, 0xE1, 0xF2, 0x88, 0x67, 0xD8, 0x9A, 0x05, 0x0B, 0x91, 0x31, 0x5C, 0x12,
+    0x0B, 0x90, 0xDF, 0x2D, 0xF7, 0x97, 0x36, 0x8F, 0x0C, 0xEF, 0x2E, 0x16, 0x39, 0x39, 0x09, 0x77,
+    0x16, 0x94, 0x6F, 0x8B, 0xE6, 0x31, 0x9F, 0x3C, 0x82, 0xC3, 0x52, 0x3C, 0x06, 0xAD, 0x21, 0x8F,
+    0xB5, 0xA4, 0x52, 0xC6, 0x76, 0x0A, 0x87, 0xBD, 0x8F, 0x22, 0xF5, 0x94, 0x8A, 0x25, 0xEA, 0x9F,
+    0xE4, 0x2F, 0xA2, 0x8C, 0x57, 0xC6, 0x54, 0xDE, 0x6C, 0xC0, 0x9B, 0x0B, 0xA7, 0x45, 0xD2, 0xF6,
+    0x28, 0x88, 0x62, 0x9B, 0xE3, 0x62, 0x99, 0x40, 0x85, 0x44, 0x3A, 0x1F, 0xE9, 0x1B, 0x66, 0x58,
+    0x9D, 0x2E, 0x9B, 0xB8, 0xFE, 0x45, 0xCC, 0x19, 0xAD, 0x0B, 0x69, 0x71, 0xA5, 0x4A, 0x8C, 0x25,
+    0x77, 0x8A, 0x66, 0x60, 0xB6, 0x73, 0xE7, 0xB9, 0xAE, 0x33, 0x21, 0x58, 0xE1, 0xCF, 0x1A, 0xBA,
+    0x13, 0xF2, 0x7E, 0x8D, 0xB2, 0x81, 0x14, 0x91, 0x59, 0x39, 0x08, 0x2C, 0x35, 0x56, 0x7D, 0x03,
+    0x3E, 0x6D, 0x17, 0xE4, 0x00, 0xF8, 0x56, 0x3A, 0x84, 0x1C, 0x20, 0x37, 0x47, 0xD3, 0x6D, 0x80,
+    0xFB, 0x3B, 0xF9, 0xAE, 0x29, 0x1A, 0x2E, 0x0A, 0x76, 0x94, 0x8D, 0xD3, 0x41, 0xD9, 0x58, 0x72,
+    0xDF, 0x5D, 0x53, 0xD9, 0xB8, 0x9C, 0x4A, 0x25, 0x67, 0xD2, 0xCD, 0xE5, 0xBE, 0xB2, 0x91, 0x52,
+    0x50, 0x3A, 0x56, 0x39, 0x3E, 0x10, 0x9A, 0xB2, 0xD1, 0xD4, 0x8C, 0xD9, 0x19, 0xCA, 0xC6, 0xE2,
+    0x1C, 0x65, 0x63, 0x67, 0xE3, 0xAA, 0x9A, 0x08, 0x65, 0x18, 0x4E, 0x43, 0x2F, 0x28, 0x7F, 0x96,
+    0xF0, 0x8B, 0x20, 0xA7, 0xCA, 0x8F, 0xD1, 0x62, 0x6B, 0xD8, 0x3E, 0x16, 0x76, 0x88, 0x14, 0x22,
+    0x51, 0x89, 0x21, 0x34, 0x6E, 0x94, 0x42, 0x99, 0x43, 0x73, 0xEF, 0x09, 0xA7, 0xE6, 0x28, 0x64,
+    0x6C, 0x62, 0x4A, 0x62, 0x6E, 0x83, 0x3D, 0x53, 0x26, 0xE8, 0x46, 0x77, 0x50, 0xB0, 0x61, 0x1B,
+    0xE7, 0xF1, 0x66, 0xEF, 0xFF, 0x86, 0xFD, 0xF5, 0xFE, 0x7E, 0x69, 0x1B, 0x9F, 0x17, 0xB9, 0x13,
+    0xF9, 0xE7, 0x86, 0xF7, 0xF9, 0xF7, 0x6B, 0x7D, 0xA4, 0xE6, 0xE1, 0x2D, 0x08, 0x59, 0xE7, 0xD7,
+    0x3F, 0x08, 0xC8, 0x57, 0x63, 0x90, 0x64, 0x4C, 0x30, 0x8D, 0xE3, 0xDE, 0x0F, 0x12, 0xB7, 0x5D,
+    0x30, 0xF7, 0xA5, 0xC9, 0xA0, 0x64, 0x6B, 0xF3, 0x66, 0xC6, 0xED, 0xA8, 0x35, 0xD6, 0x36, 0xD1,
+    0xF1, 0x28, 0x74, 0x3C, 0x74, 0x25, 0x19, 0x13, 0x5B, 0xA8, 0x74, 0x9C, 0xEB, 0x08, 0x28, 0x69,
+    0x9A, 0xE8, 0x20, 0xD9, 0x95, 0x91, 0x03, 0x33, 0x24, 0x93, 0x83, 0x0B, 0x22, 0x6D, 0xF8, 0x4C,
+    0xAC, 0x69, 0x74, 0x25, 0x76, 0x0D, 0xCC, 0x0D, 0x21, 0xA1, 0x9C, 0x30, 0xF2, 0x8A, 0x58, 0x35,
+    0xB8, 0xA8, 0xAE, 0x2C, 0x1E, 0xA9, 0x9C, 0x3C, 0x61, 0x99, 0x93, 0x8A, 0x90, 0xD3, 0x2C, 0x3E,
+    0x67, 0x08, 0x2A, 0x86, 0xFE, 0x7A, 0x31, 0xD6, 0x66, 0xEE, 0xA1, 0xF1, 0x58, 0x3C, 0x08, 0x7D,
+    0xEB, 0x1A, 0xB9, 0xC2, 0x12, 0xAB, 0xCA, 0x6D, 0x1E, 0x19, 0x82, 0xEF, 0xDE, 0xA0, 0xDB, 0x04,
+    0xBA, 0x6C, 0x26, 0x7B, 0x93, 0xF3, 0xE6, 0x09, 0x4C, 0x28, 0xD6, 0x84, 0xD2, 0x7F, 0x70, 0xB0,
+    0x3A, 0x7C, 0xDC, 0x35, 0x5F, 0x6C, 0x20, 0x2A, 0xD1, 0xEC, 0xA0, 0x02, 0x53, 0xF5, 0x4C, 0x16,
+    0xBC, 0x4C, 0x79, 0x91, 0x82, 0x34, 0x39, 0x52, 0x51, 0x09, 0xF7, 0xF7, 0x34, 0x9A, 0x7E, 0x61,
+    0x4A, 0xFE, 0x67, 0x39, 0x94, 0xD6, 0x0F, 0x2E, 0x19, 0xC9, 0x9C, 0x3C, 0x4E, 0x29, 0xD5, 0xFB,
+    0xF3, 0xB3, 0x90, 0x7D, 0xE7, 0x6F, 0x38, 0x07, 0xFD, 0xE4, 0x28, 0xF0, 0x56, 0x42, 0xA2, 0x5E,
+    0x91, 0xD0, 0x92, 0x89, 0xAA, 0xDD, 0xE5, 0x92, 0xAB, 0x4E, 0xB5, 0x14, 0x86, 0x0A, 0xD5, 0x5D,
+    0xE4, 0x2A, 0xCC, 0x9B, 0x4C, 0x6F, 0xFF, 0xA3, 0xA6, 0x6D, 0x3D, 0xE1, 0x95, 0x77, 0x0A, 0x6A,
+    0x35, 0xD8, 0xC6, 0x89, 0x92, 0xD6, 0x89, 0x72, 0x5E, 0x82, 0xFA, 0xA5, 0xEA, 0x04, 0x67, 0x4E,
+    0x35, 0x35, 0xF3, 0x4F, 0x81, 0x4F, 0x5E, 0x57, 0x0C, 0x6E, 0x48, 0x31, 0x78, 0x4B, 0x5D, 0x9A,
+    0x86, 0x2B, 0x5E, 0x7F, 0xE0, 0x1A, 0xBD, 0x2F, 0x6F, 0x15, 0xA7, 0x86, 0x93, 0x6E, 0x0F, 0xEF,
+    0x7D, 0xEF, 0x88, 0x4F, 0x6E, 0xB9, 0x7A, 0xFC, 0x3C, 0xB4, 0x4C, 0x71, 0x6F, 0xEF, 0xBD, 0x06,
+    0xFC, 0xAD, 0xEB, 0x8F, 0xA2, 0xA6, 0xBA, 0xBB, 0x08, 0xB4, 0xE6, 0xAC, 0xF6, 0xA0, 0x51, 0xAC,
+    0x8B, 0xBB, 0x2F, 0x52, 0x54, 0xA5, 0xD5, 0x26, 0xD9, 0x2A, 0x09, 0x07, 0x90, 0x9E, 0xA5, 0x24,
+    0x5C, 0x6F, 0x95, 0x84, 0xC1, 0x56, 0xF5, 0xA0, 0xBA, 0x07, 0xB2, 0x3F, 0xA5, 0xD9, 0x75, 0xE3,
+    0xFE, 0xA6, 0x8C, 0xC4, 0x57, 0x44, 0xCC, 0x1A, 0x19, 0x6F, 0x67, 0xDC, 0x6D, 0xA6, 0x6A, 0xF5,
+    0x30, 0xA8, 0x53, 0xFA, 0x2C, 0xB8, 0x5A, 0xDD, 0xE4, 0xB6, 0x34, 0x31, 0xB8, 0x1E, 0xEE, 0xD5,
+    0xE7, 0x08, 0x8F, 0xF6, 0x35, 0x6E, 0x64, 0xE9, 0xEB, 0x57, 0xE5, 0x5D, 0x5B, 0x7B, 0xB2, 0xD6,
+    0x21, 0xC3, 0x06, 0x0C, 0x36, 0xE0, 0xD2, 0xD1, 0xBE, 0x1C, 0x7F, 0x4C, 0xD1, 0x96, 0x1C, 0x41,
+    0xCF, 0x42, 0xCC, 0x49, 0x84, 0xDE, 0x50, 0x4B, 0x36, 0x94, 0x8D, 0xA8, 0x3F, 0x04, 0x65, 0xF9,
+    0x6F, 0x67, 0x12, 0x33, 0xB6, 0x37, 0x19, 0x19, 0xC8, 0xAA, 0x94, 0x83, 0x29, 0x17, 0x4A, 0xA1,
+    0x57, 0xA5, 0xD8, 0xDD, 0x97, 0x69, 0x2F, 0x46, 0x1F, 0x0D, 0x85, 0x76, 0x54, 0x98, 0x8C, 0x3F,
+    0xB9, 0x7B, 0x6C, 0x85, 0x2A, 0xEA, 0x7C, 0xC1, 0x9E, 0x63, 0x4F, 0x5E, 0xAA, 0x80, 0xCE, 0x77,
+    0xCD, 0xFC, 0xDB, 0xA1, 0x21, 0xCA, 0x3B, 0xCA, 0xF1, 0xFD, 0x4B, 0x4E, 0xC5, 0x7A, 0x5F, 0xE7,
+    0x44, 0x39, 0xE3, 0x8A, 0x8C, 0xA9, 0x8E, 0x7F, 0xC1, 0x1E, 0xC0, 0x38, 0x69, 0x27, 0x3C, 0xEF,
+    0x19, 0xA1, 0xCA, 0x04, 0xA7, 0x62, 0x50, 0xAD, 0x82, 0xAF, 0xE7, 0x0B, 0xCA, 0x41, 0x3F, 0x30,
+    0x86, 0x5C, 0x99, 0x55, 0xE8, 0x7B, 0x67, 0x45, 0x2D, 0xAD, 0x23, 0x81, 0x76, 0xA6, 0x06, 0xF7,
+    0xD0, 0xEB, 0x1F, 0x96, 0xEC, 0x59, 0xCE, 0xF3, 0x8E, 0x15, 0x6D, 0x86, 0x27, 0xE8, 0x5B, 0xE6,
+    0x64, 0x35, 0x63, 0xD6, 0x15, 0x7C, 0xBA, 0x5C, 0xF3, 0xBC, 0xCC, 0x2C, 0x0E, 0x0B, 0x8D, 0xF4,
+    0x34, 0xD7, 0x4F, 0xEF, 0xBD, 0x28, 0x92, 0x6B, 0xA6, 0xBE, 0x11, 0x5E, 0x93, 0x75, 0x69, 0x05,
+    0xE9, 0xD6, 0x61, 0xC1, 0x09, 0x48, 0xDC, 0x49, 0xD1, 0x80, 0x07, 0x69, 0x84, 0x4E, 0x88, 0xBC,
+    0x58, 0x2B, 0x28, 0x9A, 0x5C, 0x44, 0xE1, 0x26, 0xD5, 0x4B, 0xDC, 0x07, 0xC2, 0xCA, 0xB8, 0xDF,
+    0x6C, 0x26, 0xAE, 0x99, 0x35, 0xDE, 0x9C, 0xFA, 0x0B, 0xDF, 0x23, 0xA3, 0xD8, 0x78, 0x23, 0x4F,
+    0x42, 0x58, 0x98, 0x30, 0xF9, 0xD7, 0x19, 0x65, 0x49, 0xEA, 0xED, 0xC9, 0xE8, 0x52, 0x42, 0x68,
+    0x0F, 0x6E, 0xC8, 0x85, 0x75, 0x0E, 0xE3, 0xDE, 0x47, 0x68, 0x70, 0x7A, 0xDF, 0xD9, 0x04, 0x84,
+    0x06, 0x2E, 0x13, 0xEE, 0x36, 0x87, 0xF2, 0x3F, 0xCB, 0xC1, 0xAF, 0x2D, 0xD5, 0x17, 0x84, 0xD6,
+    0xC0, 0xF5, 0x08, 0x2E, 0xD5, 0x55, 0x44, 0xD5, 0x17, 0x51, 0xAF, 0x36, 0xE5, 0xA5, 0x2C, 0x97,
+    0xE9, 0xC0, 0x35, 0x56, 0x9E, 0xD8, 0xCE, 0x55, 0xC4, 0x00, 0xDB, 0x7B, 0x79, 0xB1, 0xA0, 0x1D,
+    0xB4, 0x0F, 0x06, 0xED, 0x5B, 0x95, 0xA3, 0x87, 0xA4, 0x7B, 0x8A, 0x5A, 0x40, 0xCE, 0x92, 0x7C,
+    0x66, 0x5E, 0x08, 0x70, 0x40, 0xE8, 0x78, 0x71, 0xE9, 0xAF, 0x93, 0x6E, 0x12, 0xD0, 0x7A, 0x50,
+    0x50, 0x9B, 0x57, 0xD3, 0xF8, 0x90, 0x9B, 0x04, 0x73, 0x3B, 0x58, 0x2C, 0x16, 0x87, 0xB6, 0xAD,
+    0x6E, 0xFF, 0x36, 0xCA, 0x58, 0x3C, 0xEE, 0x1F, 0x6A, 0x2F, 0xD5, 0x4F, 0x07, 0xBB, 0xED, 0x1E,
+    0xAC, 0xA6, 0x7B, 0x30, 0xDF, 0xEC, 0xC3, 0x42, 0x61, 0x09, 0x08, 0x47, 0x13, 0x83, 0x13, 0xC8,
+    0x81, 0xCB, 0x5F, 0x74, 0x8B, 0x97, 0xDC, 0x7F, 0xE3, 0xBE, 0xD7, 0x9F, 0x01, 0x4B, 0x28, 0xD2,
+    0xCF, 0x83, 0xE8, 0x5C, 0x59, 0x25, 0x61, 0x71, 0x0D, 0xB3, 0xA0, 0xE7, 0x00, 0xAC, 0x31, 0x16,
+    0xB2, 0x1C, 0xFF, 0x4B, 0x51, 0xC7, 0x9D, 0x50, 0x6D, 0x19, 0xB2, 0xA8, 0x95, 0xD1, 0x8B, 0xBA,
+    0xBC, 0x5F, 0xDD, 0xEA, 0xD0, 0x59, 0x63, 0xB0, 0xD5, 0xB2, 0xB6, 0x5E, 0xFE, 0x8C, 0xDC, 0xB5,
+    0xB0, 0xC6, 0x1C, 0xAD, 0x27, 0xA4, 0x4F, 0x54, 0xA8, 0xCD, 0xC9, 0x76, 0x5F, 0x3E, 0x0C, 0x2E,
+    0x1F, 0x81, 0x3A, 0xC9, 0xAF, 0x3C, 0x5D, 0x64, 0x28, 0x15, 0xC2, 0xA4, 0x90, 0x63, 0x11, 0x2D,
+    0xE3, 0xD6, 0x24, 0xB0, 0xB8, 0x9D, 0xAA, 0xDD, 0x29, 0x6E, 0x67, 0x2A, 0x7E, 0x99, 0xE4, 0x15,
+    0x8B, 0xE4, 0x95, 0xAA, 0xF1, 0xAA, 0xE8, 0x4D, 0x29, 0xEF, 0x9C, 0xD1, 0x4B, 0xDB, 0xFC, 0x67,
+    0x26, 0x7D, 0x48, 0x55, 0x8A, 0x9E, 0x93, 0x39, 0xF1, 0x77, 0xE5, 0x6D, 0xDC, 0xC6, 0xCA, 0xDD,
+    0xC7, 0xED, 0x9C, 0x7B, 0xB2, 0xBD, 0x4B, 0xE8, 0x4D, 0xDC, 0x86, 0xCA, 0x7E, 0x49, 0x35, 0x0A,
+    0xB8, 0xE5, 0xB0, 0x86, 0x1D, 0xB4, 0x7C, 0x52, 0x90, 0xDB, 0xC2, 0x5B, 0x27, 0x9C, 0x9F, 0xA4,
+    0x9A, 0x3A, 0xFD, 0x83, 0xE4, 0xB5, 0x63, 0x17, 0x7C, 0x89, 0x8A, 0x35, 0x73, 0x61, 0x12, 0xF0,
+    0xA2, 0x10, 0xD0, 0xD0, 0xA9, 0x3E, 0xAC, 0x04, 0x90, 0xAA, 0x2F, 0x8E, 0x9D, 0x37, 0xCB, 0x4F,
+    0xD5, 0x20, 0xB2, 0xFE, 0x53, 0xF8, 0x45, 0x0C, 0xBB, 0x94, 0x6E, 0x5A, 0x09, 0x77, 0x1A, 0xE9,
+    0x29, 0x38, 0x4A, 0x5D, 0x3E, 0x02, 0xD5, 0xE8, 0xB0, 0x41, 0x08, 0x98, 0x00, 0x4C, 0x01, 0x22,
+    0x80, 0x18, 0x20, 0xFD, 0x40, 0x40, 0xFE, 0x63, 0x01, 0xEE, 0x3B, 0x9D, 0x7B, 0xDB, 0x45, 0x9D,
+    0x7B, 0xA7, 0x13, 0xF0, 0xAE, 0x74, 0x97, 0x7B, 0xAF, 0x16, 0xF0, 0x81, 0x90, 0x5B, 0xA9, 0x05,
+    0xC0, 0x1A, 0x20, 0x13, 0x20, 0x6B, 0xAF, 0x83, 0x5C, 0xD8, 0x39, 0x8C, 0xEC, 0xBC, 0x93, 0x19,
+    0x35, 0xEB, 0x43, 0x4C, 0xA8, 0xDF, 0x80, 0x52, 0x47, 0x6D, 0x58, 0x94, 0x6E, 0xD0, 0xB1, 0x5F,
+    0xB5, 0x8D, 0xE4, 0xA9, 0x55, 0x68, 0x81, 0x79, 0x22, 0xBD, 0x97, 0x36, 0x10, 0x3B, 0x65, 0x0D,
+    0xC2, 0x4C, 0xB1, 0x81, 0x62, 0x72, 0x23, 0x64, 0x83, 0x12, 0x84, 0x0A, 0xA3, 0x27, 0x6A, 0x72,
+    0xA3, 0x92, 0x82, 0x86, 0x32, 0xA9, 0xD7, 0x7D, 0x4A, 0xAB, 0x32, 0x7E, 0x72, 0x5D, 0x47, 0x79,
+    0x37, 0x00, 0xD3, 0xB2, 0x86, 0x80, 0x51, 0xDA, 0xF3, 0x64, 0x97, 0xC7, 0xE3, 0x7B, 0x5B, 0x9D,
+    0xF9, 0xE0, 0x5C, 0xE1, 0x61, 0xA1, 0x70, 0xB4, 0xF2, 0xC6, 0xD0, 0xED, 0xAF, 0xC5, 0x31, 0x0C,
+    0x6D, 0x75, 0x02, 0x5E, 0xE5, 0x1A, 0x95, 0x26, 0x12, 0x62, 0xF0, 0x1D, 0x49, 0x20, 0xB7, 0x8C,
+    0xE5, 0x97, 0xB4, 0x57, 0x85, 0x5D, 0xB9, 0xB4, 0xA0, 0xEA, 0x35, 0x81, 0xC6, 0x09, 0xA4, 0xA1,
+    0x44, 0x9B, 0x72, 0x20, 0xE8, 0x7D, 0x4A, 0xB5, 0x2C, 0x96, 0xD2, 0x73, 0xA1, 0x2B, 0x4A, 0xE9,
+    0xC5, 0x49, 0x2F, 0xE8, 0xC7, 0xCD, 0xB4, 0x95, 0x0F, 0x7F, 0xD4, 0xCE, 0x80, 0xDE, 0xEA, 0xA2,
+    0x5A, 0xD0, 0x9B, 0x2E, 0xAA, 0x04, 0xFD, 0xD0, 0x25, 0x40, 0x6B, 0x97, 0xC3, 0x32, 0x03, 0x55,
+    0x2D, 0x50, 0x0E, 0xEB, 0x8C, 0x8A, 0xED, 0x25, 0xFC, 0xC1, 0x02, 0x20, 0xF4, 0x28, 0x50, 0x47,
+    0x34, 0x87, 0x89, 0x66, 0xA7, 0xFF, 0x1F, 0x04, 0xEE, 0x2E, 0xF2, 0x86, 0x1A, 0xCF, 0x7D, 0x70,
+    0x81, 0x7B, 0x01, 0x84, 0xF6, 0xDC, 0x50, 0xB5, 0x45, 0x46, 0x25, 0xE2, 0x86, 0xAB, 0x19, 0x5E,
+    0x44, 0xEF, 0x4B, 0x47, 0x89, 0x98, 0x2D, 0xBF, 0x29, 0xD5, 0x35, 0xAA, 0xD7, 0x56, 0x65, 0x4D,
+    0x7E, 0x0E, 0xB4, 0x6B, 0x48, 0x52, 0x44, 0x92, 0x97, 0xBB, 0x84, 0x61, 0xE2, 0xBE, 0x64, 0x9B,
+    0x9B, 0xE9, 0xFA, 0x97, 0x58, 0xA4, 0x34, 0x76, 0x5C, 0x66, 0xFF, 0x2B, 0xD9, 0x77, 0xF5, 0x3E,
+    0x90, 0x1A, 0x3E, 0x49, 0xB0, 0xC8, 0x8E, 0x65, 0x18, 0xDF, 0x84, 0x6A, 0xF0, 0xC7, 0x26, 0xCD,
+    0x94, 0x60, 0xBA, 0x2A, 0xD8, 0x7B, 0x6B, 0xAF, 0x4C, 0x4C, 0x5B, 0x9A, 0x3C, 0xCE, 0x04, 0xFC,
+    0x96, 0xA0, 0x81, 0x36, 0xB2, 0xFF, 0xD7, 0x3B, 0x4A, 0xC7, 0x77, 0xE1, 0x5A, 0xF5, 0x17, 0xD0,
+    0x5F, 0x6E, 0x64, 0xAB, 0xE7, 0xE6, 0x73, 0x01, 0x20, 0x43, 0x70, 0x9B, 0x23, 0xC0, 0x45, 0x44,
+    0xF2, 0x0F, 0x7D, 0x4E, 0x21, 0x6B, 0x3F, 0x0B, 0x55, 0x97, 0xA8, 0x4E, 0x82, 0x8D, 0x77, 0xD6,
+    0xDC, 0x03, 0x23, 0xF2, 0x4F, 0x0D, 0x99, 0xBB, 0x7D, 0x65, 0x49, 0x0D, 0xF0, 0xD4, 0xAF, 0xA4,
+    0x65, 0x70, 0x85, 0x4E, 0x6D, 0xB2, 0xDF, 0xA0, 0xB3, 0x8F, 0x0A, 0xAF, 0x29, 0x57, 0xF0, 0xAD,
+    0x5B, 0xEE, 0xCE, 0x0D, 0x25, 0xA0, 0x4F, 0x0E, 0xC8, 0x3E, 0x23, 0x44, 0x14, 0xFA, 0x1C, 0x47,
+    0x2E, 0x93, 0x0A, 0xEC, 0x10, 0xEE, 0x90, 0x99, 0x2E, 0x4D, 0x5D, 0xA3, 0x33, 0x1A, 0x54, 0x41,
+    0xB2, 0xE5, 0x82, 0x0E, 0xBC, 0x32, 0x14, 0x7B, 0x69, 0x0D, 0xBD, 0x5E, 0xD2, 0xC0, 0x74, 0x18,
+    0xB5, 0x74, 0x3E, 0xEE, 0xE0, 0x7E, 0x36, 0xEB, 0xCD, 0xC2, 0xBD, 0xE6, 0x6E, 0x93, 0x51, 0x9D,
+    0x44, 0xA5, 0x03, 0x59, 0xFE, 0x7C, 0xAC, 0x78, 0x6D, 0x46, 0x3E, 0x4F, 0xBA, 0x4D, 0x09, 0x29,
+    0x7D, 0x8E, 0x4A, 0xC1, 0xC8, 0xA9, 0xCE, 0x8A, 0x9A, 0x44, 0x65, 0xB6, 0xCC, 0xBF, 0x26, 0xA4,
+    0x93, 0xD1, 0x43, 0x04, 0xCC, 0x33, 0xD0, 0x31, 0xA7, 0x73, 0xAC, 0x1E, 0x23, 0x54, 0xE9, 0xE8,
+    0xB6, 0x88, 0xA6, 0xFD, 0x54, 0x26, 0x86, 0x70, 0x9C, 0x30, 0xA0, 0x34, 0x09, 0xEC, 0x25, 0xA9,
+    0x6C, 0x85, 0x82, 0xE2, 0x2E, 0x85, 0x95, 0x24, 0xEA, 0x73, 0x43, 0xB0, 0x95, 0x44, 0x2E, 0xDF,
+    0xF9, 0x30, 0x85, 0x41, 0x25, 0xEA, 0x78, 0x43, 0xD2, 0xC6, 0x30, 0xBB, 0xE4, 0x6D, 0x24, 0xE4,
+    0xE5, 0x4D, 0x57, 0xAB, 0xB6, 0x6F, 0xA3, 0xCA, 0x3E, 0x65, 0x68, 0x3A, 0xDD, 0x85, 0xAF, 0x0D,
+    0x32, 0xCC, 0xA3, 0x37, 0x85, 0x48, 0x46, 0x2F, 0x5C, 0xC0, 0x6F, 0x64, 0x8E, 0xC9, 0x88, 0xAD,
+    0x77, 0x6E, 0xDC, 0x23, 0xDC, 0x47, 0x42, 0xAA, 0x49, 0x82, 0xE2, 0x6F, 0x68, 0xF7, 0x57, 0x4F,
+    0x46, 0xA7, 0x5B, 0x6F, 0xCB, 0x9E, 0x6E, 0x86, 0xB2, 0x76, 0xB5, 0x5E, 0xA3, 0xD7, 0x53, 0x9B,
+    0x09, 0x7E, 0xBD, 0xB1, 0x67, 0xEA, 0xF3, 0xF5, 0x5D, 0xF4, 0x7F, 0x5B, 0x2B, 0x9B, 0x22, 0x83,
+    0x2F, 0x9C, 0xEA, 0xDF, 0x0A, 0xBC, 0xB7, 0x38, 0xEE, 0x0E, 0xA9, 0x3A, 0xAF, 0x4E, 0xC3, 0x07,
+    0xB9, 0xFB, 0x28, 0xBC, 0x7C, 0xA8, 0x04, 0xBA, 0x52, 0x9A, 0x70, 0x36, 0xA0, 0xCC, 0x5D, 0xE0,
+    0x7D, 0x05, 0x38, 0x18, 0x3C, 0xBB, 0x85, 0x00, 0xD4, 0x42, 0xCC, 0x90, 0xE1, 0x74, 0x85, 0x70,
+    0xDC, 0x87, 0xC9, 0xAE, 0xBD, 0xFB, 0x14, 0x90, 0x17, 0xF1, 0x77, 0xD0, 0x08, 0x3F, 0x6D, 0xFC,
+    0xFE, 0x02, 0x0E, 0x34, 0x1B, 0xEF, 0x8A, 0x79, 0x1E, 0xB6, 0x7A, 0x66, 0x81, 0xBF, 0xF1, 0xB3,
+    0xFE, 0x95, 0x7A, 0xE3, 0x77, 0xD0, 0x5E, 0x65, 0x0F, 0x28, 0x28, 0x77, 0x35, 0x7D, 0x94, 0x42,
+    0xB0, 0x00, 0x29, 0x0D, 0xBC, 0xDF, 0xF7, 0x18, 0x7E, 0xEB, 0x96, 0xEA, 0x1F, 0xC6, 0x90, 0x6A,
+    0x01, 0x75, 0xFA, 0x8D, 0x06, 0x11, 0x56, 0xA6, 0x7E, 0xBF, 0x90, 0xC9, 0x01, 0xB3, 0x48, 0x0F,
+    0x38, 0xFE, 0x85, 0xFE, 0xBD, 0x0F, 0xF1, 0xAD, 0x59, 0x10, 0xFC, 0x5D, 0x74, 0xD8, 0x6D, 0xD0,
+    0xDB, 0x81, 0xCE, 0x0B, 0x70, 0xE9, 0x17, 0x41, 0x50, 0x50, 0x01, 0x61, 0xEF, 0xE2, 0xB6, 0x65,
+    0x68, 0x89, 0x4B, 0xAE, 0x40, 0x80, 0x06, 0x9F, 0x57, 0x02, 0x85, 0x3B, 0xC8, 0x3E, 0xD4, 0x4B,
+    0xEC, 0x86, 0xE1, 0x76, 0x7D, 0x58, 0x0F, 0xFB, 0x3C, 0xAB, 0xF4, 0x90, 0x1D, 0x0F, 0x57, 0x0E,
+    0x36, 0x3E, 0x35, 0x6D, 0x39, 0x38, 0xAF, 0xE3, 0x2D, 0x9B, 0xED, 0xCC, 0xC3, 0xBB, 0x37, 0x78,
+    0x65, 0x39, 0xA8, 0x16, 0x03, 0xEF, 0x97, 0xB5, 0x0C, 0x2E, 0x15, 0xEA, 0x8F, 0xB5, 0x54, 0x59,
+    0x20, 0xC5, 0x17, 0xF1, 0x4A, 0x3A, 0xFF, 0x4B, 0x6A, 0x4B, 0x9B, 0x79, 0x1E, 0x5F, 0x44, 0xB3,
+    0x35, 0xE8, 0xE1, 0x08, 0x84, 0xF8, 0xCC, 0x24, 0x00, 0x5E, 0x27, 0x2C, 0xCA, 0x9F, 0xCA, 0xC8,
+    0xA9, 0x00, 0x5E, 0x98, 0xC0, 0x54, 0x52, 0x1E, 0x53, 0xF1, 0x57, 0x9A, 0x75, 0x20, 0x5D, 0x07,
+    0x2D, 0x08, 0xF7, 0xF6, 0x09, 0xE7, 0xCE, 0x66, 0xC6, 0x8A, 0xC9, 0xAE, 0xF6, 0x73, 0x30, 0xB4,
+    0xB2, 0xD1, 0x15, 0xC2, 0x65, 0xA4, 0x0D, 0x39, 0x2B, 0x92, 0x19, 0x77, 0x17, 0xCA, 0x88, 0x96,
+    0x03, 0x17, 0x77, 0x67, 0x21, 0xE1, 0x2A, 0x72, 0xD2, 0x0B, 0xDE, 0xD7, 0x92, 0xAF, 0x16, 0x1E,
+    0x64, 0x83, 0xCD, 0xA2, 0x52, 0xAD, 0xFC, 0x46, 0xD5, 0xF2, 0x6B, 0x32, 0xA0, 0x60, 0xBD, 0xA5,
+    0x85, 0x23, 0xCB, 0x14, 0xE6, 0x60, 0xE2, 0x7B, 0x92, 0x3B, 0xCE, 0xCC, 0xBD, 0xFF, 0xB2, 0x8B,
+    0xA0, 0x2D, 0xA4, 0x74, 0x4F, 0x30, 0xC7, 0x7F, 0xF9, 0xC5, 0x74, 0xE8, 0x76, 0xBD, 0x2D, 0x76,
+    0xB7, 0x9C, 0xA9, 0x04, 0x45, 0x64, 0x0C, 0xC1, 0xA7, 0x4F, 0xA1, 0x01, 0xE4, 0x03, 0x12, 0xE8,
+    0x00, 0x73, 0x72, 0x73, 0xAB, 0xEB, 0x94, 0xDD, 0x7C, 0x64, 0x84, 0x2E, 0x03, 0xEE, 0x17, 0x09,
+    0x86, 0x75, 0x70, 0x14, 0x7F, 0xAA, 0xA2, 0x6C, 0x90, 0x07, 0xFF, 0x09, 0xB5, 0x00, 0xE3, 0xFF,
+    0x43, 0xB0, 0x4F, 0x28, 0xE5, 0x59, 0x31, 0xD6, 0xBD, 0x3D, 0xD5, 0x0A, 0x4D, 0xC8, 0x3D, 0x4C,
+    0x4D, 0xE5, 0xB8, 0xE4, 0x7C, 0xC7, 0x2E, 0x78, 0x1A, 0x8E, 0xAF, 0x11, 0xF8, 0x6F, 0xA0, 0xF4,
+    0xF9, 0x06, 0x9D, 0x39, 0x8F, 0x3D, 0xEB, 0xB0, 0x54, 0x47, 0x3E, 0xD9, 0x4C, 0x67, 0x4E, 0x1D,
+    0x28, 0x36, 0x6A, 0x20, 0xF5, 0x70, 0xF9, 0x29, 0xE1, 0x99, 0xE6, 0x1B, 0x72, 0x0D, 0x07, 0xB7,
+    0x54, 0x03, 0xA4, 0x8C, 0xFA, 0x76, 0x63, 0x3F, 0x20, 0x63, 0xB1, 0x7A, 0x03, 0x0C, 0x00, 0x2B,
+    0x0F, 0x33, 0x4F, 0x2C, 0xD3, 0x31, 0x2D, 0x95, 0x95, 0xD7, 0x19, 0xF9, 0xE4, 0x75, 0x38, 0x61,
+    0xF1, 0xD7, 0xE7, 0xB0, 0xC8, 0x41, 0x38, 0xE2, 0x8E, 0x65, 0x5F, 0x3F, 0x04, 0x49, 0xA8, 0xC7,
+    0x00, 0x9F, 0x6D, 0x43, 0x6D, 0x38, 0x8A, 0x22, 0x55, 0x1F, 0x9C, 0xCF, 0x22, 0x07, 0xBF, 0xDC,
+    0xD3, 0x43, 0xBF, 0x03, 0x53, 0xD3, 0x2B, 0x75, 0xC9, 0xEF, 0x1D, 0x34, 0xD8, 0xFC, 0xBF, 0x6A,
+    0x2C, 0x37, 0xDD, 0xEA, 0x1C, 0xED, 0x8E, 0xEA, 0xCE, 0x4F, 0xBD, 0x59, 0x0B, 0x92, 0xD2, 0x7B,
+    0x46, 0x7C, 0xAE, 0xA4, 0x28, 0xF8, 0x5D, 0x8D, 0xE2, 0x50, 0xF5, 0x59, 0xAB, 0x24, 0x2B, 0x1E,
+    0xE6, 0xF0, 0xA5, 0x2C, 0xA9, 0xD3, 0x46, 0x58, 0xC2, 0x26, 0xE6, 0x28, 0x5C, 0x3E, 0x92, 0xFF,
+    0x5D, 0xE8, 0xDF, 0xA5, 0xE0, 0x30, 0x79, 0xAB, 0x4E, 0xDF, 0x6D, 0xF1, 0xFB, 0xA3, 0x26, 0xFE,
+    0x3D, 0xF3, 0x5E, 0x10, 0xC6, 0x4D, 0xD9, 0xEB, 0xC7, 0xFB, 0x0D, 0x0E, 0x32, 0x44, 0x8F, 0xC8,
+    0xEC, 0x87, 0x62, 0xB3, 0x0E, 0xE2, 0x8D, 0xB7, 0x80, 0x1F, 0xA2, 0xF1, 0x9F, 0xFE, 0xB7, 0xA8,
+    0x41, 0x31, 0xF1, 0xBB, 0x86, 0xE2, 0xA5, 0x51, 0x15, 0xDD, 0xE0, 0xE4, 0x98, 0x3D, 0xAC, 0x50,
+    0xCD, 0xB4, 0x90, 0x0F, 0x05, 0xD0, 0xE2, 0x7B, 0xBE, 0x40, 0x9F, 0x03, 0x16, 0x1A, 0x5F, 0x80,
+    0x9E, 0x57, 0x04, 0x8F, 0xAF, 0xC3, 0x02, 0x8D, 0x42, 0x16, 0xF9, 0x02, 0x05, 0x8F, 0xF5, 0xB8,
+    0x20, 0x5F, 0xBD, 0x84, 0xC2, 0xD7, 0x73, 0x78, 0x90, 0x2C, 0xF5, 0x76, 0x33, 0xAD, 0x0B, 0xF5,
+    0xEF, 0x58, 0x28, 0x61, 0x15, 0xD2, 0x97, 0x7E, 0xC9, 0x53, 0x1A, 0xB0, 0x84, 0xB6, 0x01, 0x6A,
+    0x48, 0xDD, 0xA3, 0x62, 0xFE, 0xDC, 0xF6, 0x0C, 0x4B, 0xB0, 0x67, 0x56, 0xDB, 0xF0, 0xBA, 0x90,
+    0x8B, 0x89, 0xDA, 0x56, 0xC5, 0xF9, 0xEE, 0xFF, 0x0F, 0xF4, 0x7B, 0x7F, 0xBD, 0xED, 0x1C, 0xB9,
+    0x6D, 0x1D, 0x82, 0xAF, 0x3F, 0x73, 0x44, 0xEA, 0x60, 0xB5, 0x34, 0x63, 0x0E, 0x59, 0x62, 0x72,
+    0xE0, 0xDC, 0xDF, 0xFB, 0x71, 0xA4, 0xE2, 0x53, 0xD3, 0x58, 0x4D, 0x56, 0xA0, 0x81, 0x6E, 0x20,
+    0x28, 0x20, 0x81, 0x42, 0x35, 0xD1, 0xA7, 0xF9, 0x7A, 0xB4, 0x15, 0x3E, 0x35, 0x5D, 0x1D, 0x16,
+    0x44, 0x87, 0x28, 0x92, 0x39, 0x5D, 0x6B, 0x62, 0x8D, 0xDE, 0xAA, 0x29, 0x26, 0x93, 0xF3, 0x63,
+    0xDD, 0xC2, 0x21, 0x7E, 0xE4, 0x59, 0x14, 0xCC, 0xB9, 0xB6, 0x9E, 0xAC, 0x3A, 0x28, 0xAF, 0xCF,
+    0x52, 0x39, 0x29, 0xD1, 0x3E, 0x0B, 0xC0, 0x9A, 0xF5, 0xC2, 0x1B, 0x54, 0x6D, 0xBC, 0xF0, 0x46,
+    0xAA, 0x0E, 0xA0, 0x10, 0xE4, 0xC9, 0x44, 0xEE, 0x16, 0x18, 0x7F, 0xB7, 0x2D, 0x48, 0x57, 0xB3,
+    0xD0, 0x0C, 0x85, 0xB8, 0x67, 0xA3, 0xF3, 0x9A, 0xC1, 0x7A, 0x1B, 0x2D, 0xCC, 0x68, 0xA5, 0x9A,
+    0x43, 0x67, 0x56, 0xD1, 0xFC, 0x96, 0x45, 0x0C, 0xF7, 0x80, 0x56, 0x1E, 0x8E, 0x6C, 0xEA, 0xEF,
+    0xD3, 0x84, 0x98, 0x49, 0x65, 0xEA, 0x5A, 0xDA, 0xA6, 0x37, 0xB9, 0xEB, 0xB8, 0xD4, 0xAA, 0xE2,
+    0xC7, 0x3D, 0xB8, 0x32, 0x69, 0xD6, 0x77, 0x1C, 0xC6, 0x4E, 0x16, 0xC2, 0x37, 0xDC, 0x37, 0xE1,
+    0xA5, 0xDB, 0x09, 0x4B, 0xF7, 0xE3, 0x8E, 0x9D, 0x1B, 0xBA, 0x0F, 0xE8, 0xE1, 0x03, 0xD2, 0xC6,
+    0x19, 0x22, 0x5C, 0x2B, 0xC6, 0x60, 0x42, 0x65, 0x3A, 0xF4, 0x05, 0x32, 0xA5, 0x62, 0x75, 0x46,
+    0x66, 0x28, 0xA1, 0xB7, 0x18, 0x2C, 0x72, 0x0A, 0xCE, 0x51, 0x8F, 0x0D, 0x81, 0xB8, 0x81, 0x01,
+    0x21, 0xEA, 0x14, 0xC7, 0x1D, 0x58, 0x29, 0xA8, 0xEB, 0x79, 0x91, 0x5C, 0x1A, 0xAB, 0x12, 0x10,
+    0x36, 0x03, 0x2A, 0x0F, 0xF1, 0x25, 0xD4, 0x87, 0xF0, 0x04, 0x83, 0xAB, 0xCE, 0x14, 0x46, 0xA2,
+    0x35, 0xF5, 0xBB, 0xA0, 0x51, 0x65, 0x28, 0x1C, 0x9C, 0x2C, 0x00, 0x69, 0xC9, 0x3B, 0x7D, 0xFE,
+    0x11, 0xF6, 0xE4, 0x9F, 0xB5, 0xE9, 0xC7, 0x68, 0x87, 0x6B, 0x62, 0x4C, 0xA2, 0x04, 0x8C, 0x1B,
+    0xE7, 0xB6, 0xAC, 0x6A, 0xDA, 0xCE, 0xD6, 0x0C, 0x86, 0x55, 0x75, 0xB0, 0x8F, 0x05, 0xCB, 0xB7,
+    0x70, 0x21, 0x3B, 0x7F, 0x76, 0x8E, 0xA5, 0x77, 0xBD, 0x73, 0x65, 0x90, 0x9F, 0xBC, 0xA6, 0x4E,
+    0x06, 0x4D, 0x30, 0x52, 0x42, 0x2B, 0xFD, 0xAC, 0x49, 0x55, 0x5B, 0x5C, 0x09, 0x4B, 0x44, 0x8D,
+    0xE6, 0x0A, 0x94, 0xF6, 0xA0, 0x4C, 0x98, 0xF0, 0x13, 0x11, 0xE7, 0xF3, 0xFE, 0x96, 0x3C, 0x42,
+    0x0D, 0xBA, 0xB4, 0x7E, 0x29, 0xE5, 0x05, 0xBC, 0xE6, 0x43, 0x85, 0xF2, 0x53, 0xF5, 0x2C, 0x7C,
+    0x3D, 0xD7, 0x3B, 0x50, 0x3F, 0x3F, 0x7D, 0xBD, 0xD4, 0x16, 0x51, 0xA4, 0xF9, 0x10, 0x9D, 0xA8,
+    0xEF, 0x92, 0xF7, 0xDE, 0x5D, 0x14, 0xED, 0xB6, 0x3E, 0xD1, 0xA8, 0xB6, 0x39, 0xD9, 0x0E, 0x65,
+    0x3E, 0xEC, 0x7A, 0xA8, 0xB7, 0xDD, 0xBD, 0x1D, 0x1B, 0xB5, 0xCC, 0x8B, 0x4C, 0x2D, 0xB8, 0x0C,
+    0xB0, 0xC4, 0x46, 0xD7, 0x9A, 0x8D, 0xB7, 0xA1, 0xA1, 0xFA, 0x4E, 0x01, 0x57, 0x4D, 0x99, 0x34,
+    0x93, 0x0A, 0xD6, 0x59, 0x95, 0x2B, 0xD5, 0x3E, 0x5E, 0xD8, 0x66, 0xAC, 0x96, 0x64, 0x38, 0x01,
+    0xBC, 0xEC, 0x16, 0x8B, 0x23, 0x0B, 0xE6, 0x6C, 0xCF, 0xC7, 0x77, 0x8F, 0xF5, 0x3A, 0x7F, 0xDF,
+    0x80, 0xE7, 0xF6, 0xBC, 0x99, 0x3D, 0x7F, 0x6A, 0xEF, 0xC3, 0x5C, 0x0D, 0xBE, 0x46, 0x8B, 0xF0,
+    0x6B, 0xAF, 0xD4, 0x85, 0xDA, 0x84, 0x6B, 0xB3, 0xA8, 0xD7, 0xF4, 0x96, 0x57, 0x1C, 0x1C, 0x7B,
+    0x9F, 0x01, 0xD0, 0x62, 0xE9, 0xB2, 0x57, 0x4E, 0xB2, 0x9C, 0xDB, 0x36, 0x6C, 0x91, 0x89, 0x22,
+    0xF8, 0x9F, 0x63, 0x5B, 0xBD, 0x77, 0x55, 0xD0, 0x54, 0x23, 0x37, 0xB8, 0xE3, 0xE5, 0x35, 0x1B,
+    0x84, 0x21, 0x5D, 0xAD, 0xD4, 0x7B, 0xD6, 0xED, 0x23, 0xFB, 0xAE, 0x26, 0x81, 0xF0, 0x37, 0xD4,
+    0xEA, 0x1E, 0x57, 0xC3, 0x63, 0xE4, 0x4F, 0x72, 0xC6, 0x25, 0xD1, 0x46, 0xAA, 0x28, 0x56, 0x14,
+    0x9A, 0x8F, 0x22, 0x6D, 0xE4, 0x91, 0x96, 0x63, 0x65, 0xC3, 0x13, 0xD5, 0x40, 0xA5, 0x2A, 0xE6,
+    0xE5, 0xEF, 0x91, 0x68, 0xBA, 0xFF, 0xAD, 0xE8, 0x0F, 0x74, 0xB7, 0x99, 0xAA, 0x25, 0x8B, 0xDB,
+    0x8E, 0x10, 0x7F, 0xF2, 0xE9, 0xD2, 0x97, 0x6B, 0x1F, 0xC2, 0xEB, 0x5D, 0x94, 0xD3, 0xC1, 0xA2,
+    0x8B, 0xA9, 0x5D, 0xFC, 0xCC, 0xFD, 0x31, 0x36, 0xF7, 0xB7, 0xDC, 0x1C, 0xD6, 0xB1, 0xDF, 0x07,
+    0x9D, 0x80, 0xC1, 0x69, 0x0A, 0x84, 0xA7, 0x2D, 0xE7, 0x42, 0x43, 0xA8, 0x6F, 0x9C, 0x32, 0x54,
+    0xA5, 0x15, 0x54, 0x6C, 0x12, 0x04, 0x26, 0xE6, 0x55, 0x2A, 0x0D, 0x93, 0x55, 0x46, 0x77, 0x4C,
+    0x88, 0xAC, 0x53, 0x9A, 0xE9, 0xB8, 0x9D, 0x0C, 0xC4, 0xDE, 0xA9, 0x15, 0x90, 0xBB, 0x33, 0x6A,
+    0x33, 0x6B, 0x73, 0x04, 0xB5, 0xB7, 0xC2, 0x4F, 0x8A, 0x9C, 0x00, 0x49, 0x21, 0xA9, 0x22, 0xA9,
+    0x49, 0x7A, 0x72, 0x4B, 0x4D, 0xDE, 0x16, 0xAB, 0xA5, 0x0E, 0x8B, 0xC2, 0xB6, 0x1E, 0xDF, 0x83,
+    0x21, 0x2C, 0xAE, 0x8B, 0x72, 0xDE, 0xC5, 0x35, 0x22, 0x25, 0xE2, 0x3A, 0xAD, 0x92, 0x26, 0xAE,
+    0xB1, 0xE7, 0xC8, 0x23, 0x64, 0xCF, 0x89, 0xB1, 0x2F, 0x6E, 0x62, 0xE9, 0xF5, 0xBC, 0xB2, 0xD0,
+    0x3B, 0x7A, 0x6B, 0x5B, 0x9C, 0x9C, 0x86, 0xDF, 0x69, 0x18, 0xEF, 0xC6, 0x0A, 0xB7, 0xD4, 0x0F,
+    0x6F, 0xC2, 0xE8, 0x3B, 0x7A, 0x9A, 0x46, 0xAD, 0xBA, 0x63, 0xF4, 0x73, 0x75, 0x02, 0x98, 0xB7,
+    0x53, 0xF5, 0xCB, 0x88, 0x18, 0x86, 0x59, 0xDC, 0x5D, 0x1C, 0xCB, 0xAC, 0x18, 0xA2, 0x92, 0xD7,
+    0xA7, 0x0A, 0x1B, 0x5F, 0x10, 0x62, 0x7D, 0xF7, 0x45, 0xF7, 0x6E, 0x4F, 0x26, 0x6C, 0xE2, 0xBE,
+    0xD1, 0xC7, 0x0D, 0x67, 0xEB, 0xAC, 0x8F, 0xE0, 0x2B, 0x31, 0xEB, 0xF9, 0x0E, 0xF8, 0x5C, 0x48,
+    0x91, 0x4E, 0x1C, 0xED, 0xAC, 0x47, 0xC7, 0x4A, 0xB3, 0x66, 0xFD, 0x04, 0xDA, 0x94, 0xB4, 0x9E,
+    0xD1, 0x9F, 0xBE, 0x12, 0x96, 0x16, 0xC6, 0x20, 0x59, 0x66, 0x1B, 0x29, 0x14, 0x1B, 0xE1, 0xEA,
+    0x4A, 0x29, 0xE4, 0x55, 0xF1, 0x11, 0xFA, 0x45, 0xE8, 0x28, 0xED, 0x92, 0x47, 0xE0, 0x82, 0x75,
+    0x6F, 0x4D, 0xE9, 0x01, 0x41, 0x3C, 0x05, 0x41, 0x00, 0xEE, 0x34, 0xFE, 0x7B, 0x8E, 0xCE, 0x47,
+    0x1C, 0x78, 0x93, 0x6E, 0x80, 0x93, 0x3A, 0x91, 0xC5, 0x72, 0xB2, 0x2A, 0xAA, 0x58, 0x13, 0x1F,
+    0x78, 0x13, 0x2A, 0x38, 0xDC, 0xD4, 0xB8, 0xCE, 0xF4, 0xE4, 0xA6, 0x2B, 0xEE, 0x3B, 0xDA, 0xC2,
+    0x93, 0xDA, 0x2D, 0x85, 0xB9, 0xE8, 0x05, 0xAF, 0x53, 0xA9, 0x76, 0x52, 0xE7, 0x65, 0x2A, 0x6C,
+    0x80, 0x08, 0x2C, 0x88, 0x22, 0xA9, 0x05, 0x5B, 0x29, 0x96, 0x11, 0x96, 0x89, 0x52, 0x63, 0xA4,
+    0x5D, 0x99, 0xD4, 0xF3, 0x7E, 0x62, 0xCF, 0x9F, 0xEE, 0x61, 0x65, 0x6B, 0x6B, 0xF3, 0x47, 0xDF,
+    0x6C, 0xC3, 0xC7, 0xA2, 0x5E, 0xF7, 0x59, 0x35, 0x42, 0x63, 0x32, 0x95, 0x46, 0xD2, 0x2B, 0xBF,
+    0x2E, 0xD4, 0x8D, 0x54, 0x45, 0x27, 0xCE, 0x98, 0x66, 0x14, 0xB0, 0x1F, 0x5B, 0x48, 0x76, 0x6A,
+    0xF4, 0xBD, 0x68, 0x8A, 0x0F, 0xE9, 0xA5, 0xBF, 0x21, 0xD1, 0x62, 0xF7, 0xAA, 0x63, 0x97, 0x74,
+    0x7C, 0xAB, 0x4E, 0x2F, 0x0C, 0xE7, 0x08, 0xE8, 0x05, 0x33, 0x77, 0xB6, 0xF9, 0xF6, 0x24, 0x39,
+    0xA0, 0x9B, 0x18, 0x44, 0xF8, 0x4A, 0x90, 0xC4, 0xA5, 0xEA, 0x48, 0xB2, 0xBE, 0x44, 0x6B, 0x55,
+    0xB4, 0xF5, 0x9A, 0x64, 0x7E, 0x07, 0x38, 0xA7, 0xFE, 0xE4, 0x2A, 0x85, 0x0A, 0xC6, 0xF6, 0x48,
+    0x97, 0x60, 0xDA, 0x93, 0x33, 0x32, 0x6F, 0x0A, 0x53, 0x95, 0xD7, 0x1A, 0x8D, 0xA6, 0xB6, 0x72,
+    0xA9, 0x45, 0xF2, 0x91, 0xCB, 0x66, 0x6D, 0x52, 0xC9, 0xA2, 0x13, 0x58, 0xAC, 0xA3, 0x26, 0xA9,
+    0xD2, 0x32, 0xAE, 0x04, 0xA2, 0x67, 0x81, 0x37, 0xB2, 0x66, 0xA4, 0xE7, 0x05, 0xCA, 0xE4, 0x9F,
+    0xFB, 0x39, 0x77, 0x66, 0x69, 0xEA, 0xA7, 0x66, 0xE5, 0x8D, 0x02, 0xEA, 0x84, 0xAA, 0x51, 0x37,
+    0xE8, 0xEB, 0x58, 0xE7, 0xBD, 0x6E, 0x5F, 0xBA, 0x14, 0x32, 0x5B, 0x2F, 0xA1, 0x10, 0x86, 0x25,
+    0xA7, 0xFE, 0x02, 0x33, 0xC0, 0xEC, 0x18, 0xA6, 0xD8, 0xF4, 0x5E, 0xAA, 0x56, 0x6A, 0x87, 0x12,
+    0x23, 0x79, 0x16, 0x52, 0xF8, 0x80, 0x31, 0x3A, 0xA1, 0xFB, 0xBF, 0xEE, 0x47, 0xE6, 0xC3, 0xF3,
+    0xA6, 0xEC, 0xE9, 0x25, 0xBB, 0xF3, 0x5F, 0x51, 0x0C, 0x41, 0x4D, 0xD9, 0xFF, 0xEC, 0x72, 0x29,
+    0x71, 0xC9, 0xC4, 0xDD, 0xC4, 0xBA, 0x37, 0x01, 0x4F, 0xC3, 0x0E, 0x67, 0xF0, 0x2B, 0x87, 0x00,
+    0x74, 0x74, 0xCD, 0x41, 0xA1, 0x3F, 0x10, 0x87, 0x89, 0xCC, 0x3D, 0xC2, 0x63, 0x0E, 0x39, 0x1A,
+    0x99, 0xCC, 0x49, 0x8E, 0xC1, 0x16, 0x6B, 0xD0, 0x0F, 0xE6, 0xF0, 0x6B, 0x2F, 0xF7, 0x98, 0xFB,
+    0xF0, 0x2D, 0xA0, 0x54, 0x2B, 0x9D, 0x0A, 0x1C, 0x37, 0x58, 0x23, 0x27, 0xAB, 0x5B, 0x5C, 0x33,
+    0x23, 0x03, 0x8A, 0xE9, 0x13, 0x75, 0x6D, 0xC8, 0x5A, 0xA0, 0x06, 0x40, 0xD6, 0x00, 0x78, 0x11,
+    0xAC, 0x81, 0xF4, 0x43, 0x3C, 0x57, 0x96, 0x54, 0xC5, 0xF7, 0xC9, 0xE3, 0x8A, 0x75, 0xCA, 0xB1,
+    0x4A, 0x65, 0x6D, 0xA4, 0x1B, 0x2D, 0xE7, 0xEB, 0x94, 0x23, 0xC8, 0x6B, 0x38, 0x8B, 0xFF, 0xAD,
+    0x8C, 0x7B, 0x46, 0xBE, 0x6C, 0x03, 0xE5, 0x40, 0xD4, 0xE4, 0xEF, 0x83, 0x48, 0x92, 0xB3, 0x24,
+    0xBB, 0x7B, 0x05, 0x9A, 0x51, 0x55, 0x2A, 0xC5, 0x7C, 0x2B, 0xDB, 0x22, 0x3C, 0xE0, 0x6B, 0xB7,
+    0x84, 0xD3, 0xD9, 0xD0, 0x01, 0x3A, 0xD0, 0x64, 0x3C, 0x41, 0x38, 0x72, 0x67, 0xA3, 0x0E, 0x33,
+    0x64, 0x50, 0x16, 0x17, 0x44, 0xE2, 0x43, 0x54, 0xAE, 0x79, 0x1F, 0xB9, 0x4B, 0x2F, 0xAA, 0x03,
+    0xF6, 0xCC, 0xC2, 0x92, 0xAB, 0x60, 0x88, 0x25, 0x2D, 0xB6, 0x5C, 0xF8, 0x84, 0xF0, 0x58, 0xAE,
+    0x39, 0xF6, 0x3A, 0x16, 0x67, 0xA9, 0x21, 0x12, 0xB2, 0x1A, 0x69, 0x0F, 0x76, 0x44, 0xD7, 0xA4,
+    0xC1, 0x0E, 0xB6, 0xFB, 0xC4, 0x0C, 0xC6, 0x8E, 0x29, 0x0C, 0x38, 0xC3, 0x8F, 0x9D, 0xE9, 0x28,
+    0xF5, 0x27, 0x9B, 0x08, 0x93, 0x28, 0x8C, 0x2B, 0x7C, 0x3A, 0xF2, 0x37, 0xDD, 0x8D, 0x20, 0xB9,
+    0x4F, 0xD7, 0x06, 0x0D, 0xCE, 0xCA, 0x22, 0x75, 0x6A, 0x94, 0x7B, 0xA6, 0xF7, 0x16, 0x45, 0x13,
+    0x32, 0x40, 0x00, 0x5D, 0x84, 0x45, 0x5F, 0x07, 0xCF, 0x69, 0xDE, 0x0A, 0xBA, 0xC0, 0xF5, 0xDC,
+    0xE0, 0x36, 0xD2, 0x24, 0xAE, 0x7D, 0x0A, 0x84, 0xE6, 0x95, 0xA2, 0xFA, 0x49, 0x79, 0x73, 0x4B,
+    0x5F, 0xB3, 0xD8, 0xA2, 0x12, 0xEF, 0x41, 0x29, 0x24, 0x5F, 0xA1, 0xE9, 0x0A, 0x64, 0x7A, 0xAB,
+    0xEF, 0x0F, 0x2A, 0xAE, 0x5A, 0xA0, 0xB0, 0x30, 0xDA, 0x42, 0xF7, 0x02, 0x4C, 0x8E, 0xCD, 0x76,
+    0x93, 0x7B, 0x7C, 0x54, 0x10, 0x35, 0x58, 0x0A, 0xD2, 0x63, 0xDC, 0x3F, 0x65, 0xFE, 0x75, 0xD8,
+    0x62, 0xA5, 0x7E, 0x3F, 0x13, 0x29, 0xBA, 0xD4, 0xA5, 0xAB, 0x52, 0x74, 0xAF, 0x6B, 0x4A, 0xFD,
+    0xC2, 0x9C, 0x0A, 0xE9, 0x66, 0x74, 0xB8, 0x28, 0x9A, 0xAC, 0xC6, 0x56, 0x8A, 0x8B, 0xA2, 0xCB,
+    0x87, 0x82, 0x16, 0x19, 0x99, 0x72, 0x68, 0xA4, 0xA7, 0xF0, 0x30, 0x54, 0x16, 0x5D, 0x91, 0xEE,
+    0xFA, 0x03, 0x6A, 0xC6, 0x08, 0x41, 0x80, 0xE7, 0x21, 0x11, 0x82, 0x6A, 0x5E, 0x99, 0x36, 0x78,
+    0x58, 0x8D, 0xB6, 0x7F, 0x1D, 0x6D, 0xFF, 0x23, 0x77, 0xD5, 0xC8, 0xA7, 0xCD, 0x34, 0x0B, 0x61,
+    0x6A, 0xB6, 0xB1, 0x4B, 0xB3, 0x47, 0x6B, 0xC3, 0x3E, 0x1A, 0xBB, 0x8A, 0x72, 0x29, 0x19, 0x15,
+    0x2B, 0x95, 0xF2, 0x62, 0xEA, 0xDD, 0x7B, 0x91, 0x76, 0x15, 0xAC, 0x7B, 0xAA, 0x05, 0x23, 0xBA,
+    0x2E, 0x98, 0x37, 0x83, 0x79, 0x14, 0xEA, 0xBE, 0xC1, 0x75, 0xA7, 0xE4, 0xAE, 0xDC, 0xB1, 0x7B,
+    0x0D, 0xE8, 0x64, 0xB5, 0x5A, 0x59, 0x1C, 0xAF, 0xA2, 0x90, 0xD4, 0x8D, 0x0E, 0xCD, 0xFA, 0x4C,
+    0x08, 0xDC, 0x73, 0x4C, 0x76, 0xAC, 0x18, 0x7D, 0x7B, 0xA7, 0xBB, 0x62, 0x13, 0x04, 0x7E, 0x2F,
+    0xD4, 0x71, 0x9F, 0xA8, 0x13, 0xA9, 0x39, 0x50, 0x52, 0x83, 0xAD, 0xE6, 0x88, 0x70, 0xC8, 0x1A,
+    0x82, 0x05, 0x77, 0xE2, 0xE8, 0x13, 0x95, 0xF4, 0x94, 0xCC, 0x9C, 0xB9, 0x72, 0xA9, 0x0F, 0x06,
+    0x77, 0x57, 0x85, 0x1A, 0x1C, 0xB4, 0x4C, 0x7B, 0x21, 0x76, 0xD9, 0x8E, 0x87, 0x06, 0x68, 0x0C,
+    0x34, 0xDA, 0x45, 0x67, 0xDA, 0xAD, 0xF3, 0x3C, 0x34, 0x98, 0xF9, 0x25, 0x67, 0x46, 0x80, 0x89,
+    0xAB, 0xB1, 0xF8, 0x67, 0x82, 0x28, 0x8C, 0xD5, 0x09, 0x97, 0xF2, 0x9F, 0x60, 0x15, 0xAA, 0xEC,
+    0x87, 0x1A, 0x60, 0xBF, 0xA1, 0x43, 0x19, 0xED, 0x81, 0x26, 0xA2, 0x4D, 0x18, 0xF4, 0x87, 0x0E,
+    0x62, 0x5C, 0x0F, 0x16, 0x49, 0xA6, 0x0C, 0x3E, 0x29, 0x0A, 0x15, 0x29, 0x22, 0x28, 0x72, 0x39,
+    0xB7, 0x4A, 0x02, 0x5A, 0x86, 0xF7, 0x88, 0x94, 0x49, 0xBF, 0xEA, 0x3E, 0x57, 0x75, 0x41, 0xAE,
+    0x21, 0xCF, 0x85, 0xC6, 0x40, 0x5B, 0x42, 0x10, 0x1D, 0x76, 0x0B, 0x96, 0xB6, 0x50, 0x13, 0x3A,
+    0x4F, 0xC0, 0x2A, 0xF5, 0xDC, 0x35, 0xCA, 0x35, 0x0D, 0x39, 0xEF, 0x86, 0x92, 0x79, 0xC3, 0xCD,
+    0xBF, 0x51, 0xF9, 0x14, 0x1B, 0x3F, 0x79, 0x01, 0x72, 0x06, 0x99, 0x86, 0xB2, 0x33, 0xD0, 0x62,
+    0x8D, 0xB6, 0x23, 0xBA, 0x5A, 0x1E, 0xFA, 0x17, 0xDC, 0xC3, 0x3F, 0xC2, 0x9B, 0x92, 0x4F, 0xE8,
+    0x6A, 0x71, 0xBF, 0x1F, 0xD4, 0x15, 0x63, 0xD3, 0xF7, 0xC4, 0x52, 0x3E, 0x50, 0x7B, 0xF5, 0xDC,
+    0x1B, 0xFC, 0xFC, 0x9B, 0x54, 0x84, 0xC8, 0x9E, 0xC8, 0x8A, 0x95, 0xAC, 0x7C, 0x54, 0x25, 0x0C,
+    0x82, 0x69, 0x34, 0x93, 0xD9, 0xD1, 0xA0, 0xCD, 0x7A, 0xC6, 0xBB, 0xFC, 0x85, 0x1B, 0x70, 0x18,
+    0x8F, 0xC9, 0xF6, 0xCF, 0xBA, 0x88, 0x7E, 0xC8, 0xD0, 0x51, 0x05, 0xC5, 0x92, 0xDD, 0x56, 0xA6,
+    0xD8, 0xB3, 0xB2, 0x4B, 0x23, 0xD5, 0xE9, 0x67, 0x38, 0x44, 0x3B, 0x3F, 0x93, 0xAD, 0x9F, 0x39,
+    0x96, 0x63, 0xE7, 0xCB, 0x3B, 0x76, 0x62, 0xF3, 0x77, 0xE4, 0x23, 0x4F, 0x6E, 0xF9, 0xA8, 0xC1,
+    0x58, 0xB3, 0xAF, 0x05, 0x3E, 0x10, 0x30, 0x6F, 0x2F, 0x2D, 0xA8, 0xCF, 0x87, 0x8F, 0x6F, 0xA7,
+    0xDA, 0x21, 0xC6, 0x7C, 0xF7, 0xAA, 0x05, 0xCA, 0x69, 0x3E, 0xD0, 0xF0, 0x03, 0xB4, 0x3D, 0x82,
+    0xFD, 0x4D, 0x23, 0x50, 0x2C, 0x27, 0x05, 0x5D, 0x25, 0xD0, 0xF2, 0x1C, 0xBC, 0x8F, 0x95, 0x41,
+    0x4B, 0x7D, 0x99, 0xB9, 0x42, 0xEC, 0x7A, 0x3A, 0x6A, 0xEA, 0x73, 0x64, 0x4E, 0x80, 0x65, 0xE2,
+    0xF3, 0xA5, 0xCB, 0xA0, 0x09, 0xE0, 0x7B, 0x03, 0xC4, 0x84, 0x07, 0x5A, 0x1F, 0x69, 0xE9, 0x71,
+    0xC3, 0x7A, 0xA6, 0xF0, 0xFC, 0xA5, 0xFC, 0xBC, 0x0C, 0x94, 0x18, 0xC1, 0xD0, 0x7C, 0xEF, 0xAA,
+    0x33, 0x59, 0xCA, 0xB7, 0x37, 0xD5, 0x70, 0x63, 0xE3, 0x2F, 0x94, 0xD5, 0xE6, 0xCC, 0x41, 0xC7,
+    0x1C, 0x38, 0x0B, 0x86, 0x44, 0xEB, 0x2F, 0x1D, 0x6E, 0x4D, 0xDF, 0xD6, 0x37, 0xED, 0xB6, 0x9C,
+    0x8E, 0xCA, 0xC5, 0xC0, 0x27, 0x84, 0x37, 0xB7, 0xD1, 0x97, 0x93, 0xA1, 0x7F, 0x07, 0x6D, 0xA2,
+    0x95, 0xBB, 0x2D, 0x69, 0xD7, 0x71, 0x0A, 0x8B, 0xEB, 0x81, 0x76, 0x33, 0x73, 0xA5, 0x31, 0x64,
+    0x8D, 0xC6, 0xE5, 0x72, 0x4E, 0x6D, 0x18, 0x89, 0xA5, 0xC6, 0x17, 0x46, 0xEE, 0xA7, 0x5E, 0x6B,
+    0x46, 0xB2, 0xA9, 0x71, 0x86, 0xEA, 0xA7, 0x46, 0x96, 0x92, 0x64, 0x31, 0x2B, 0x74, 0x73, 0x53,
+    0x6F, 0xB7, 0x99, 0xB3, 0x9C, 0x4A, 0x49, 0x33, 0xEF, 0xAD, 0x48, 0x47, 0x58, 0x2D, 0x32, 0x0C,
+    0x51, 0x8B, 0xF3, 0x3E, 0x69, 0x34, 0x5A, 0x4E, 0xC4, 0xD8, 0x94, 0xBC, 0xF6, 0x1C, 0x99, 0x35,
+    0xF2, 0xCA, 0x42, 0xE9, 0x42, 0xCD, 0xBA, 0xB5, 0x84, 0x2E, 0x54, 0xA3, 0xBD, 0x8D, 0x8D, 0x5E,
+    0x7A, 0xC7, 0x6B, 0x46, 0x2A, 0xE6, 0x96, 0xEC, 0x2D, 0xF0, 0x2E, 0xD8, 0x9A, 0x8A, 0xEE, 0xF2,
+    0x5E, 0x2F, 0x8E, 0x3A, 0x31, 0xDF, 0xF6, 0xE1, 0xD0, 0x85, 0x93, 0x9B, 0xC3, 0xCC, 0x9E, 0x6E,
+    0x03, 0x72, 0xA6, 0xB6, 0x56, 0x59, 0x6C, 0xB7, 0xC5, 0x6B, 0x3B, 0x16, 0xD3, 0x6E, 0xCC, 0x51,
+    0x14, 0x83, 0x90, 0x55, 0x7A, 0x3D, 0xC2, 0x44, 0x99, 0x15, 0xF5, 0x3E, 0x92, 0x0D, 0xED, 0x2F,
+    0x5D, 0x02, 0x5F, 0xC6, 0xEC, 0x8D, 0xA9, 0xDB, 0xA4, 0xBD, 0x26, 0x95, 0x61, 0x00, 0x73, 0xCD,
+    0x60, 0xC0, 0xA2, 0xE1, 0x20, 0xE7, 0x2D, 0x2B, 0x97, 0x3E, 0x10, 0x15, 0xAA, 0x56, 0xE7, 0x7D,
+    0x79, 0x63, 0x4F, 0x49, 0x35, 0x7C, 0x5A, 0xDE, 0x70, 0x34, 0x05, 0xD7, 0xF0, 0x67, 0x7D, 0xAC,
+    0x6E, 0xFA, 0x0E, 0x8A, 0x6A, 0x65, 0x1E, 0x8C, 0x71, 0xD2, 0x40, 0x5D, 0x6C, 0xFB, 0xF7, 0x46,
+    0xBC, 0x40, 0x68, 0x13, 0x51, 0xDD, 0x68, 0x27, 0xFC, 0x2C, 0x56, 0x77, 0x1E, 0xF3, 0xDA, 0x52,
+    0xC1, 0xC6, 0xA4, 0xB2, 0x8C, 0x4C, 0xD9, 0x3A, 0x72, 0x2F, 0x7F, 0x84, 0x18, 0xEC, 0x83, 0xA5,
+    0x06, 0x64, 0xE7, 0x0D, 0x34, 0xD7, 0xA9, 0xC2, 0xF6, 0x0C, 0x08, 0xC1, 0xAF, 0x01, 0x6D, 0x2E,
+    0xEA, 0xD8, 0x45, 0x1B, 0xE8, 0x2B, 0x3F, 0xB8, 0x6F, 0x51, 0x75, 0xAA, 0xD4, 0xF3, 0x3C, 0xBA,
+    0xAA, 0x48, 0x82, 0x84, 0x75, 0x98, 0xEF, 0x93, 0x20, 0x5B, 0x31, 0xDD, 0x36, 0xB9, 0xE5, 0xED,
+    0x2D, 0x11, 0xAA, 0x6C, 0xA0, 0x0B, 0x5F, 0xEA, 0x26, 0xBE, 0xF4, 0xC6, 0xEF, 0x1E, 0x5C, 0xF7,
+    0xEB, 0x64, 0x79, 0x2A, 0xB4, 0x4A, 0xAD, 0x13, 0x4A, 0x9C, 0xB6, 0x9F, 0x0D, 0x2B, 0x6B, 0x98,
+    0x0D, 0xDE, 0x50, 0x70, 0x80, 0x18, 0x40, 0xBE, 0x39, 0x57, 0x23, 0xA8, 0xB2, 0x1F, 0x1A, 0x83,
+    0x45, 0xEB, 0x68, 0xA2, 0x84, 0xE2, 0x7D, 0xD9, 0x82, 0xFE, 0x90, 0x6A, 0xE3, 0xE0, 0x1F, 0x04,
+    0x5F, 0xC6, 0xC4, 0xB4, 0xB9, 0x19, 0xF7, 0x3E, 0x82, 0x1E, 0xF6, 0xCF, 0xDA, 0xE8, 0xA5, 0xCF,
+    0xE8, 0xC8, 0x30, 0x16, 0x9B, 0x69, 0x4B, 0xF7, 0xB0, 0xD2, 0x84, 0x2F, 0x5D, 0x16, 0xBE, 0x94,
+    0x59, 0x09, 0xAC, 0x8E, 0xC6, 0x6E, 0x29, 0xEB, 0x33, 0xA1, 0x7B, 0x0C, 0x6A, 0x80, 0x92, 0xD4,
+    0x20, 0xB1, 0xC4, 0x78, 0x58, 0xE5, 0x6B, 0x1A, 0xA8, 0xB0, 0x2E, 0xFB, 0xC2, 0xF5, 0xB7, 0x4C,
+    0x5E, 0x31, 0xDE, 0xCB, 0xC7, 0xB8, 0x71, 0x8C, 0xFE, 0x4C, 0xC5, 0xDE, 0x03, 0x81, 0xC7, 0xBA,
+    0x90, 0x2E, 0x65, 0x3E, 0x9E, 0x45, 0x5A, 0x19, 0x58, 0x0B, 0x36, 0x9E, 0xF0, 0x1B, 0x89, 0x4A,
+    0x7C, 0xEE, 0xC0, 0xF4, 0xA7, 0xBE, 0xB0, 0xD4, 0x90, 0xF0, 0xE0, 0xF9, 0xB8, 0xB4, 0x50, 0xE2,
+    0xD4, 0xAF, 0xD1, 0xD4, 0xAF, 0xDB, 0x99, 0x2F, 0x4C, 0xFD, 0x57, 0xB1, 0x27, 0x7F, 0xA9, 0xA7,
+    0x7D, 0x5F, 0xF5, 0xA3, 0x62, 0x79, 0x0A, 0x73, 0x58, 0xDC, 0x94, 0x74, 0xD4, 0x34, 0xF4, 0xCC,
+    0x18, 0x4E, 0x03, 0x8B, 0x90, 0xFB, 0xF9, 0x3A, 0x30, 0xDE, 0x50, 0x4D, 0xD5, 0x1A, 0x65, 0xAE,
+    0xDD, 0x12, 0x0C, 0xC1, 0xD8, 0x1C, 0x02, 0x1D, 0x20, 0x2D, 0x44, 0xDD, 0x39, 0x05, 0x98, 0x9A,
+    0x98, 0x46, 0x8A, 0x85, 0x08, 0xAE, 0x23, 0xE4, 0x3A, 0x41, 0x6E, 0xDF, 0x76, 0xEE, 0xED, 0x42,
+    0x3D, 0x7C, 0x07, 0x3D, 0x4F, 0x6E, 0x6A, 0x8E, 0x2E, 0xE2, 0x6A, 0x8C, 0x41, 0x5C, 0x7B, 0xCB,
+    0x37, 0xA7, 0xE6, 0xB1, 0xB9, 0xDF, 0x41, 0x23, 0x5F, 0x98, 0xF9, 0xB8, 0xC1, 0x69, 0xF9, 0xED,
+    0x39, 0x67, 0x6F, 0xB8, 0xFE, 0x17, 0xD3, 0x33, 0x57, 0xC6, 0xFF, 0x87, 0x56, 0x98, 0x20, 0xF8,
+    0xD6, 0x6A, 0xF5, 0x5D, 0x9F, 0xE9, 0xD6, 0x52, 0x04, 0x71, 0x54, 0x7F, 0xFD, 0xA5, 0x9F, 0x7C,
+    0x1F, 0xF8, 0x97, 0xA6, 0xEB, 0x7F, 0x7E, 0xBA, 0xAB, 0x9E, 0x19, 0xEB, 0xCD, 0x90, 0x66, 0xE3,
+    0xAF, 0x74, 0x2A, 0x6C, 0x4C, 0x75, 0x4D, 0xD6, 0x63, 0x0A, 0x27, 0xED, 0xF5, 0x5C, 0x3E, 0xBC,
+    0xB2, 0x8C, 0x35, 0xA1, 0x61, 0xBF, 0xDD, 0x03, 0xE9, 0xA6, 0x63, 0x8C, 0xC4, 0x48, 0x9F, 0xB1,
+    0x03, 0x4D, 0xDB, 0x31, 0x32, 0xA2, 0x98, 0x2D, 0xB2, 0xDB, 0xA6, 0x06, 0x50, 0x2D, 0xFC, 0xCC,
+    0xF5, 0x8B, 0xFF, 0xC1, 0x7D, 0xA0, 0xB3, 0x3D, 0x01, 0xCB, 0xBB, 0xE3, 0x9E, 0x82, 0x8B, 0xC3,
+    0xE3, 0x6E, 0x4B, 0x9D, 0x2F, 0x0A, 0x43, 0xF3, 0x57, 0x53, 0x0F, 0xB4, 0x99, 0xB9, 0xAF, 0x30,
+    0x6A, 0xEB, 0xE0, 0x21, 0x1E, 0xDE, 0x69, 0x73, 0xDA, 0xC3, 0x5B, 0x6A, 0xFA, 0x0F, 0xB1, 0x84,
+    0xFA, 0x60, 0x62, 0x5A, 0x83, 0x5E, 0xA7, 0x93, 0xF1, 0x5C, 0x17, 0x05, 0x41, 0xC8, 0x05, 0xB7,
+    0xD1, 0x4D, 0x68, 0x12, 0x44, 0x42, 0x45, 0x37, 0x49, 0x06, 0x77, 0x28, 0xAF, 0x95, 0x8A, 0x5B,
+    0xBF, 0x8D, 0x32, 0x21, 0x42, 0xF4, 0x23, 0x8C, 0x65, 0xF6, 0xBF, 0xBE, 0x22, 0x3B, 0xC7, 0x97,
+    0xD3, 0x12, 0x9D, 0xD3, 0x37, 0x9E, 0xEF, 0x80, 0xCE, 0x53, 0xB3, 0x58, 0xA4, 0xE0, 0xC8, 0xF3,
+    0xB9, 0x7C, 0xD3, 0x06, 0xFF, 0x33, 0x08, 0x9B, 0x81, 0xB4, 0x5D, 0xDF, 0x9D, 0x9E, 0xD3, 0xFA,
+    0xF2, 0xE2, 0x2A, 0x22, 0xC1, 0xE0, 0x87, 0x5E, 0xE7, 0x8B, 0x45, 0xF6, 0xEB, 0xDE, 0xB5, 0x6D,
+    0xEE, 0xAA, 0x5F, 0x70, 0x8C, 0xA3, 0x6B, 0x53, 0xF7, 0x47, 0x5D, 0x7A, 0x3B, 0xE8, 0x84, 0x04,
+    0x1E, 0x5D, 0x59, 0x22, 0x5B, 0x88, 0x6C, 0x04, 0x42, 0x59, 0xA3, 0x2A, 0xB8, 0xFE, 0xAB, 0x59,
+    0x51, 0xCA, 0x26, 0x5D, 0xCD, 0x37, 0xF1, 0xDA, 0x65, 0x37, 0x48, 0x9C, 0xE7, 0xEA, 0xBD, 0x97,
+    0x81, 0x3D, 0x4D, 0x7F, 0x2E, 0x7F, 0x59, 0xD2, 0xBD, 0xE0, 0x93, 0x5D, 0x7E, 0x75, 0x78, 0xF9,
+    0x6C, 0xD8, 0x24, 0x31, 0x2B, 0x7D, 0xF1, 0x57, 0xC3, 0x81, 0x0B, 0xFD, 0xB5, 0xE0, 0x77, 0x82,
+    0xF3, 0x7F, 0x66, 0x96, 0x48, 0x82, 0x1B, 0x86, 0xC6, 0x89, 0xCA, 0x9D, 0xFF, 0xF2, 0x25, 0x4C,
+    0xA2, 0xF9, 0x6B, 0xDF, 0x0B, 0xE4, 0x66, 0x3C, 0xF4, 0x2B, 0xF2, 0x18, 0x7B, 0xE9, 0x97, 0xB6,
+    0xBE, 0x22, 0x8F, 0xFC, 0xE3, 0x05, 0xC3, 0x4B, 0xAA, 0x24, 0x57, 0xD1, 0x25, 0xB1, 0xCD, 0x5D,
+    0x24, 0x9A, 0x5F, 0x9B, 0x68, 0x0B, 0xE6, 0xD9, 0xB7, 0x7F, 0x27, 0xD0, 0x16, 0x44, 0xC1, 0x3F,
+    0x0A, 0x9E, 0xC0, 0x8F, 0xBE, 0xF9, 0xB2, 0x37, 0x83, 0xAB, 0x83, 0x58, 0x32, 0x64, 0x29, 0x09,
+    0xF4, 0xCD, 0x51, 0xF6, 0xED, 0x6D, 0x8B, 0xFF, 0xD9, 0x03, 0x1E, 0x37, 0x52, 0xCF, 0x3C, 0x52,
+    0xAF, 0xFF, 0xCA, 0xB6, 0xF8, 0x6B, 0xDB, 0xE2, 0xF7, 0xB7, 0xC5, 0x6D, 0xAE, 0x9E, 0xB0, 0x1E,
+    0x38, 0x99, 0x89, 0x15, 0xA7, 0xEB, 0x61, 0x6F, 0x95, 0xE9, 0x3E, 0x83, 0xF0, 0x04, 0x3D, 0x4B,
+    0x6D, 0x59, 0xB9, 0x02, 0x4C, 0x54, 0xEF, 0xCB, 0x11, 0xFC, 0x60, 0xEB, 0x9F, 0x90, 0x92, 0x3C,
+    0x70, 0x9E, 0xFC, 0x2A, 0xC0, 0xDF, 0xB3, 0x81, 0xFC, 0x14, 0x23, 0x28, 0x37, 0x17, 0xC6, 0x6F,
+    0x47, 0xA5, 0x97, 0x9A, 0x65, 0x3D, 0x52, 0x39, 0xEC, 0xBB, 0xE5, 0xD8, 0x27, 0x91, 0xDE, 0x04,
+    0x4F, 0xEA, 0x67, 0xAA, 0x1B, 0x2F, 0xDF, 0xA0, 0x79, 0x51, 0xD6, 0x5A, 0x05, 0xCF, 0x24, 0x52,
+    0x07, 0xA1, 0x34, 0x6B, 0x4A, 0xCA, 0x23, 0x5F, 0x75, 0xDA, 0xAF, 0x5F, 0xD6, 0x0E, 0xB2, 0xDE,
+    0xC6, 0x7A, 0xB6, 0x31, 0x98, 0x6C, 0xD5, 0xBC, 0x93, 0x6D, 0xEE, 0x9C, 0xE9, 0xB6, 0xD6, 0xD3,
+    0xF5, 0xF6, 0x82, 0xAD, 0x63, 0x0C, 0x14, 0xC9, 0x21, 0xC3, 0xB5, 0xE8, 0x45, 0xAA, 0xEA, 0x6C,
+    0x04, 0xA2, 0x67, 0xE6, 0xE8, 0x65, 0x5C, 0x55, 0x63, 0x3A, 0xBC, 0xE5, 0x19, 0xED, 0xC9, 0x4B,
+    0x95, 0x3C, 0x8B, 0x52, 0x05, 0x27, 0xE0, 0x42, 0x71, 0xE8, 0x14, 0x4F, 0x0D, 0xCF, 0x0D, 0x47,
+    0x86, 0x65, 0x2F, 0x26, 0xCE, 0xEF, 0x2A, 0x76, 0x1F, 0x12, 0x4F, 0x64, 0x13, 0xCB, 0xA8, 0x01,
+    0xFE, 0x3D, 0xE2, 0x88, 0xF6, 0xD5, 0xA2, 0x84, 0x81, 0x02, 0x38, 0x6D, 0x15, 0xC3, 0x10, 0x01,
+    0x0C, 0xB6, 0x46, 0xF0, 0x3B, 0x20, 0xEB, 0x82, 0xFF, 0x1C, 0xFE, 0x33, 0x82, 0xDF, 0xEB, 0xE9,
+    0x0E, 0x54, 0x30, 0xE2, 0x29, 0xA3, 0x00, 0xA5, 0x98, 0x96, 0xE9, 0xBA, 0x50, 0x15, 0x64, 0x55,
+    0x68, 0x3E, 0x82, 0xAA, 0xD0, 0x04, 0xDF, 0x9B, 0xA2, 0x1F, 0xCB, 0xBD, 0x85, 0xF5, 0x9B, 0xAD,
+    0x70, 0xCF, 0xD0, 0xFB, 0xD5, 0x33, 0x1F, 0xE6, 0x4A, 0x10, 0x6C, 0xD3, 0x95, 0x53, 0xAC, 0x07,
+    0x97, 0xBA, 0xA0, 0xF8, 0x36, 0xA5, 0x67, 0x22, 0x05, 0x39, 0x58, 0x53, 0xFA, 0xC1, 0xD3, 0x4B,
+    0x5D, 0x10, 0x03, 0xED, 0x97, 0xB1, 0xF7, 0xAE, 0x72, 0x0C, 0xA1, 0x3A, 0x4C, 0x82, 0x13, 0x62,
+    0x3E, 0x69, 0xA2, 0x44, 0x51, 0xAE, 0x88, 0x56, 0x12, 0xB8, 0xC0, 0x02, 0x4D, 0xA1, 0x3C, 0x48,
+    0x85, 0x79, 0x82, 0x69, 0xA5, 0x4E, 0x5A, 0x22, 0x68, 0x87, 0x85, 0xD5, 0x15, 0x51, 0xB0, 0x82,
+    0x3E, 0x06, 0x9A, 0x9A, 0xF4, 0x13, 0xE6, 0x68, 0x81, 0x28, 0x41, 0xD4, 0x29, 0x6A, 0x14, 0xC1,
+    0xBF, 0xA0, 0x4B, 0xE9, 0x32, 0x21, 0x14, 0x7F, 0xA9, 0x88, 0x7C, 0xAE, 0xB6, 0x54, 0x67, 0x9A,
+    0x8A, 0x6D, 0x9E, 0x87, 0x36, 0x94, 0x5B, 0x86, 0x94, 0x72, 0xDC, 0x65, 0x8B, 0x2C, 0xDC, 0x09,
+    0xFA, 0xB7, 0xFC, 0x11, 0xCD, 0x59, 0xF0, 0x97, 0x11, 0xFF, 0xB4, 0x73, 0xE5, 0xC4, 0xFD, 0xF5,
+    0x91, 0x86, 0xD2, 0x94, 0xC6, 0x0C, 0xA8, 0x68, 0xA8, 0x21, 0xAE, 0x72, 0xCD, 0x55, 0x6A, 0x0C,
+    0x42, 0x67, 0x41, 0xEA, 0xFB, 0x90, 0x9F, 0x4F, 0x01, 0xEF, 0x38, 0xB0, 0x8A, 0xDE, 0xFD, 0xDC,
+    0xF1, 0x39, 0x94, 0xA1, 0x61, 0xEE, 0x39, 0xE5, 0x8A, 0xA7, 0xF0, 0x25, 0xF7, 0xDA, 0x91, 0xD9,
+    0x09, 0x77, 0xE0, 0xEC, 0xD4, 0x95, 0x0F, 0x83, 0x77, 0x5E, 0xF7, 0xA9, 0xA7, 0xA7, 0xDB, 0xA0,
+    0x24, 0xA9, 0xD8, 0x6B, 0x57, 0x2D, 0x84, 0x72, 0xDF, 0xE5, 0x6E, 0x4A, 0x76, 0xCB, 0xAB, 0xE5,
+    0xB3, 0x29, 0x5F, 0x3C, 0x65, 0x48, 0x51, 0x8E, 0xFC, 0x5C, 0x64, 0x89, 0x86, 0x88, 0xD9, 0x52,
+    0xB3, 0x34, 0x20, 0xFF, 0x2A, 0x1C, 0x44, 0x9A, 0xC2, 0xD2, 0x6D, 0x03, 0xFC, 0x12, 0x40, 0x8F,
+    0x4C, 0x6A, 0x74, 0xC7, 0xC8, 0x35, 0x9B, 0xC3, 0x66, 0x27, 0xA5, 0x83, 0x48, 0x83, 0x77, 0x8F,
+    0x0A, 0x88, 0x75, 0x29, 0x24, 0xBA, 0xBF, 0x7F, 0x91, 0xF4, 0x12, 0x97, 0x0F, 0xAF, 0xFC, 0x15,
+    0x86, 0x9E, 0x16, 0xBB, 0x8F, 0x3D, 0xAB, 0x88, 0x34, 0x0C, 0x77, 0xC8, 0x3F, 0x5B, 0x62, 0xA0,
+    0x71, 0xE0, 0xA2, 0xC2, 0xF9, 0x3E, 0x9C, 0x7D, 0x07, 0x92, 0x50, 0xF2, 0x1E, 0x21, 0x84, 0xDC,
+    0x3E, 0xA2, 0x25, 0xFC, 0x8F, 0xCC, 0x2E, 0xDE, 0x18, 0x13, 0x9A, 0xFE, 0x0D, 0xDF, 0x52, 0xE7,
+    0x78, 0x4B, 0x13, 0x7E, 0x83, 0x2A, 0x9F, 0x09, 0xC3, 0x27, 0x83, 0xCC, 0x64, 0xDC, 0x07, 0x43,
+    0x5D, 0x58, 0x36, 0x61, 0x4F, 0x81, 0xC2, 0xA7, 0x92, 0x39, 0x05, 0x1E, 0x25, 0x6F, 0xD9, 0xA7,
+    0x06, 0xC1, 0xA0, 0xF7, 0xD9, 0xFD, 0x13, 0x1E, 0xCD, 0xA1, 0x23, 0x86, 0xBF, 0x7E, 0xB5, 0x52,
+    0x55, 0xC8, 0xE3, 0xFF, 0x85, 0xC3, 0x5A, 0x38, 0x1B, 0xEE, 0xAF, 0xDC, 0xD3, 0x50, 0xD6, 0xEC,
+    0xCA, 0x7B, 0x05, 0x9F, 0x86, 0x17, 0x79, 0xC2, 0x83, 0x61, 0x08, 0x3B, 0x3F, 0x45, 0x91, 0x53,
+    0x40, 0xDD, 0xBA, 0xC7, 0xC0, 0xCB, 0x2A, 0xF5, 0x08, 0x5C, 0x75, 0x42, 0x47, 0xCF, 0xBA, 0x78,
+    0x0F, 0xE4, 0x83, 0x57, 0xC9, 0x99, 0xF0, 0x94, 0xB5, 0xF6, 0x5C, 0x48, 0xAB, 0x51, 0x31, 0x44,
+    0x4F, 0xD3, 0xB7, 0xC9, 0x96, 0x99, 0xAC, 0xD6, 0xBB, 0x97, 0x0A, 0xCB, 0x91, 0xB1, 0xA1, 0xEE,
+    0xC4, 0x72, 0xE9, 0x6F, 0x33, 0x61, 0x3F, 0x38, 0x0B, 0xA2, 0x4A, 0x4D, 0xA6, 0x34, 0xAF, 0xCC,
+    0x9A, 0x3C, 0x3D, 0x29, 0x54, 0x19, 0xE4, 0xCC, 0x61, 0x1E, 0xB0, 0x1E, 0xF4, 0x5B, 0x50, 0x03,
+    0xD3, 0xB5, 0x3B, 0x35, 0xC5, 0xD1, 0x0E, 0x68, 0x76, 0xA5, 0x1B, 0x82, 0x7E, 0x95, 0xA9, 0x93,
+    0x44, 0xBA, 0x9B, 0x59, 0x16, 0xC9, 0xDF, 0xE0, 0xBD, 0x51, 0x34, 0x0C, 0x94, 0x81, 0xD8, 0xCA,
+    0xB8, 0x0D, 0x0D, 0xDE, 0x60, 0xC9, 0x0B, 0x2B, 0x96, 0x36, 0xD6, 0x84, 0xE8, 0x9B, 0xEA, 0x6B,
+    0xBF, 0x51, 0xAF, 0x91, 0x58, 0x05, 0xA5, 0xCD, 0xA0, 0x7F, 0x99, 0x6A, 0x6E, 0x4E, 0x35, 0x29,
+    0x58, 0x2E, 0xE8, 0x29, 0xA8, 0x3C, 0x98, 0x07, 0xA1, 0x85, 0x70, 0xA4, 0x0F, 0x18, 0x4F, 0x9E,
+    0x59, 0x4A, 0x32, 0x1A, 0x37, 0x59, 0x5F, 0x35, 0x42, 0xE0, 0xAD, 0x34, 0x9B, 0x72, 0x3F, 0x9D,
+    0xC2, 0xD3, 0x81, 0x8B, 0xE8, 0xF7, 0x11, 0xC8, 0xCF, 0xCE, 0x7A, 0xCB, 0xFD, 0xA6, 0x89, 0x0A,
+    0x1F, 0xBB, 0x63, 0xD5, 0x8C, 0xA5, 0xF7, 0x9D, 0x29, 0xBE, 0x93, 0x41, 0xA5, 0x97, 0x7F, 0xE2,
+    0x72, 0xFD, 0xD6, 0xFD, 0xA5, 0x7B, 0x59, 0xD9, 0x30, 0xB9, 0xF7, 0x9B, 0x96, 0xC5, 0xE6, 0x37,
+    0xE4, 0x1F, 0x19, 0xB6, 0x1E, 0x26, 0xD4, 0x0D, 0xDB, 0x38, 0x35, 0x15, 0x5A, 0x41, 0x23, 0x2B,
+    0x9B, 0x0C, 0x03, 0x4F, 0xCC, 0x9C, 0x2E, 0xA8, 0xF3, 0x9C, 0x86, 0xF5, 0x8C, 0xED, 0x60, 0x1E,
+    0x49, 0x29, 0x21, 0xA3, 0x7C, 0xAA, 0xED, 0x15, 0x96, 0xA4, 0xB0, 0x3E, 0xD8, 0x12, 0x80, 0xE2,
+    0xC9, 0x94, 0x36, 0x97, 0x16, 0x38, 0x0C, 0x25, 0x5C, 0x64, 0x5A, 0x81, 0x19, 0xBA, 0xD3, 0xF7,
+    0xE3, 0xD0, 0x8D, 0xB9, 0xDA, 0x85, 0xC1, 0xB8, 0x58, 0x27, 0x46, 0x6E, 0xAA, 0x2D, 0x45, 0x17,
+    0x7E, 0x53, 0xDD, 0x23, 0xDE, 0xB1, 0xFE, 0x40, 0x17, 0x35, 0x3E, 0x16, 0x40, 0xA5, 0x7B, 0xEB,
+    0xB4, 0x09, 0xAE, 0xD1, 0xB4, 0xF9, 0xB8, 0x2B, 0xF3, 0xCF, 0x29, 0xAD, 0x9B, 0x68, 0xD5, 0x44,
+    0x2F, 0xE5, 0xDD, 0x11, 0x5D, 0xD4, 0x45, 0xF4, 0xEE, 0x7D, 0x7D, 0x84, 0xEA, 0x6B, 0x17, 0xF5,
+    0x89, 0xF5, 0x50, 0xBF, 0x2B, 0xE3, 0x3D, 0x6E, 0xC1, 0x14, 0x86, 0x9F, 0x9B, 0x54, 0xC9, 0x85,
+    0x6A, 0x24, 0x31, 0x8B, 0x28, 0xB3, 0x55, 0x06, 0xA6, 0x45, 0x65, 0xE2, 0x2B, 0x5D, 0x17, 0xC3,
+    0xEF, 0x06, 0x4F, 0x31, 0xD1, 0xC6, 0x2F, 0xA2, 0xC9, 0x21, 0x67, 0x3E, 0xEB, 0x97, 0xD3, 0x93,
+    0x5E, 0x6E, 0x7D, 0x41, 0x4D, 0x4C, 0x5E, 0x4B, 0xF3, 0xFC, 0x75, 0x4B, 0x2D, 0x5E, 0x6A, 0x1A,
+    0xA5, 0xA5, 0x1D, 0x6C, 0x62, 0xB9, 0x86, 0x2D, 0xD9, 0xB0, 0x65, 0x1B, 0xF6, 0x6E, 0xA9, 0x9A,
+    0xCE, 0x88, 0x4E, 0x46, 0x44, 0xEC, 0xE4, 0x42, 0xF7, 0x55, 0xB8, 0xD4, 0x01, 0x7D, 0xA2, 0x7E,
+    0xA6, 0x2A, 0x74, 0xC8, 0xFF, 0xF8, 0xE1, 0x87, 0x3E, 0x68, 0x52, 0x07, 0x84, 0x5D, 0xAD, 0x69,
+    0x83, 0x2C, 0x87, 0x90, 0x25, 0x14, 0x62, 0x66, 0x22, 0x75, 0x2E, 0xCC, 0x35, 0x89, 0x79, 0xA2,
+    0x28, 0x52, 0x34, 0x73, 0xA6, 0xB4, 0xBE, 0xC8, 0x41, 0x21, 0x67, 0xA0, 0x09, 0xBC, 0x9C, 0x60,
+    0xE0, 0x82, 0x06, 0xAF, 0xF7, 0xAE, 0xBC, 0x35, 0x13, 0xE2, 0xD3, 0xD1, 0x34, 0xAF, 0xD5, 0xCE,
+    0x85, 0x45, 0x9F, 0xD7, 0x58, 0x1E, 0x79, 0x4D, 0xC3, 0xDD, 0x27, 0x9A, 0x24, 0x98, 0xAE, 0xAC,
+    0x9F, 0xA8, 0x5F, 0x2B, 0x3F, 0xAF, 0xB1, 0x60, 0xF2, 0x1A, 0x8A, 0x24, 0xDC, 0xBB, 0xE4, 0x73,
+    0xDE, 0x3F, 0xA4, 0xA3, 0x6A, 0x45, 0x3F, 0xD5, 0x8A, 0xDE, 0xB1, 0x80, 0x73, 0x73, 0x45, 0xBD,
+    0x30, 0xBC, 0x7C, 0x58, 0x30, 0xEB, 0x3B, 0x33, 0x35, 0x2E, 0x49, 0x7B, 0xA5, 0xAA, 0x2D, 0x73,
+    0xF4, 0xB7, 0xD8, 0x18, 0xAB, 0x5E, 0x4D, 0x9C, 0x64, 0x91, 0x9D, 0xE6, 0xD9, 0x63, 0x24, 0x02,
+    0xA7, 0x39, 0x07, 0xC6, 0x7D, 0x4C, 0x3B, 0xE3, 0x7D, 0xCB, 0x48, 0x91, 0x71, 0x95, 0xE3, 0x93,
+    0x8F, 0x34, 0xFB, 0x24, 0x75, 0xCB, 0x15, 0x5D, 0x09, 0xFD, 0x13, 0xC0, 0xBC, 0x56, 0xF4, 0xED,
+    0xAE, 0x3A, 0x6A, 0x6B, 0x5B, 0x24, 0x3A, 0xAF, 0x6E, 0xA4, 0xCC, 0xF8, 0x1F, 0x73, 0xFD, 0xCF,
+    0x59, 0xAB, 0xA9, 0xDB, 0xEC, 0xF6, 0xE7, 0xF7, 0xD8, 0x9F, 0xDF, 0x67, 0x7F, 0x16, 0xEC, 0xCF,
+    0x82, 0xFD, 0x59, 0xB0, 0x3F, 0x8B, 0x0B, 0xF4, 0x67, 0xC1, 0xFE, 0x2C, 0x9C, 0xC2, 0x25, 0x61,
+    0xC9, 0x67, 0xC2, 0x75, 0xFC, 0xFB, 0x3A, 0x5E, 0x09, 0x2D, 0x20, 0x73, 0xC4, 0x13, 0x51, 0xC8,
+    0x9E, 0x6B, 0x6A, 0xCD, 0x2B, 0xEE, 0x08, 0xB3, 0x56, 0x24, 0x9F, 0x90, 0xEE, 0xE6, 0xD4, 0x22,
+    0x0B, 0xE2, 0x98, 0xBA, 0x0E, 0x83, 0x1A, 0xBB, 0x23, 0xCB, 0xCA, 0x59, 0xD0, 0xE6, 0xCB, 0xE9,
+    0x3D, 0x77, 0x2F, 0x99, 0x57, 0xA1, 0xAE, 0x43, 0x52, 0xAC, 0x2D, 0x52, 0x7D, 0xDD, 0x55, 0xBD,
+    0x64, 0x62, 0xB6, 0x62, 0xA7, 0x79, 0x58, 0x73, 0x4B, 0xF1, 0xA9, 0xE7, 0x21, 0x41, 0x5D, 0x37,
+    0xD7, 0x73, 0x82, 0x68, 0xAD, 0x54, 0x57, 0x41, 0x8B, 0x83, 0xC8, 0x2D, 0x41, 0xAB, 0xB3, 0x93,
+    0x93, 0xB2, 0xD3, 0xF2, 0xCA, 0x2B, 0xEE, 0xCE, 0x35, 0x6F, 0x97, 0x1A, 0xC3, 0xED, 0x35, 0x8B,
+    0x43, 0xA6, 0x64, 0xA9, 0xA6, 0xB6, 0x01, 0x2C, 0x49, 0x6D, 0x97, 0xD4, 0xC2, 0x2F, 0x73, 0x3D,
+    0xAC, 0xAC, 0x22, 0xB5, 0x07, 0x27, 0xF1, 0x1D, 0x72, 0x9C, 0xB7, 0x94, 0x93, 0xA0, 0xE3, 0xCC,
+    0x2D, 0xEE, 0x66, 0xDF, 0x21, 0x87, 0xA1, 0xD7, 0xE8, 0xF5, 0x96, 0xE3, 0x8A, 0x24, 0xDB, 0x9E,
+    0x49, 0xD9, 0xC5, 0xDE, 0x85, 0x70, 0x1D, 0xCC, 0xAC, 0xA4, 0x51, 0x15, 0x69, 0xED, 0x18, 0x03,
+    0xBA, 0x01, 0x82, 0xFD, 0xDC, 0xF5, 0xFE, 0x28, 0x28, 0x58, 0x47, 0xE0, 0x0E, 0xD9, 0x10, 0x71,
+    0x0F, 0xA2, 0x81, 0x7E, 0x38, 0x96, 0xA3, 0x8F, 0xF5, 0x90, 0x0E, 0x12, 0x8F, 0xA8, 0xB7, 0xC4,
+    0x46, 0x8A, 0xFA, 0x42, 0x3F, 0x4C, 0xF5, 0x12, 0xCD, 0x85, 0xDA, 0xCF, 0xF4, 0xF6, 0x89, 0x3E,
+    0x8C, 0x3D, 0x8F, 0x37, 0x58, 0x06, 0xDC, 0x9E, 0x08, 0x3D, 0x1F, 0xB1, 0x2E, 0x9A, 0x67, 0x91,
+    0x3E, 0x99, 0x20, 0xEC, 0x7A, 0x3A, 0x15, 0xD8, 0xA6, 0x10, 0x49, 0x69, 0xD8, 0x3E, 0x56, 0xB7,
+    0x67, 0x04, 0xB0, 0x4C, 0x86, 0xD5, 0x2D, 0x3D, 0xA6, 0x08, 0x4E, 0xC3, 0x25, 0x10, 0xD5, 0x02,
+    0xB3, 0x9E, 0x4A, 0xDD, 0x59, 0xAF, 0x99, 0x58, 0x35, 0x37, 0xD3, 0x4C, 0x35, 0x0A, 0xFE, 0x7F,
+    0xFE, 0x3B, 0xD6, 0x13, 0xF7, 0x2D, 0xF5, 0x29, 0x8C, 0xE0, 0x21, 0xFD, 0x9C, 0xD1, 0x9B, 0x08,
+    0x88, 0x19, 0xE1, 0xB4, 0x82, 0x33, 0x76, 0xDD, 0x28, 0xBF, 0x2A, 0x1D, 0x37, 0x1F, 0x13, 0xC1,
+    0xBD, 0x54, 0x79, 0x53, 0x77, 0x1E, 0xB2, 0x4B, 0x1E, 0xED, 0xD1, 0xAE, 0x57, 0xE4, 0xCE, 0x44,
+    0x63, 0xB5, 0xC9, 0x23, 0xA0, 0x5E, 0xA9, 0x85, 0x77, 0xB0, 0x79, 0x04, 0x04, 0x77, 0xAB, 0xE1,
+    0xFC, 0x86, 0x3D, 0x64, 0xDF, 0x3D, 0xEC, 0x29, 0x74, 0x8B, 0x3D, 0x8D, 0xC6, 0x5A, 0x8E, 0x8B,
+    0x23, 0xF8, 0xF7, 0x69, 0x4F, 0x58, 0x8F, 0x64, 0x0F, 0xC4, 0x75, 0x10, 0x3C, 0x14, 0xEB, 0x30,
+    0xF9, 0x51, 0x3B, 0x1F, 0xFB, 0xEB, 0x2E, 0xFA, 0xDC, 0x47, 0xC4, 0x1C, 0xA2, 0xC5, 0xA1, 0xF6,
+    0x4E, 0x7D, 0x06, 0x5A, 0xDD, 0xF8, 0x5B, 0x1B, 0xA2, 0x73, 0x90, 0x1D, 0x13, 0x36, 0x3E, 0xAC,
+    0xE3, 0x61, 0xA5, 0xCA, 0x12, 0x4D, 0x7E, 0xFA, 0x12, 0xD9, 0x2A, 0x2B, 0xF5, 0x43, 0x49, 0xF9,
+    0xA6, 0xA9, 0xAD, 0xB0, 0xCA, 0x1F, 0x1B, 0xC4, 0xD2, 0xFF, 0xF9, 0x05, 0x9D, 0x16, 0x3C, 0x56,
+    0x8E, 0x13, 0x60, 0xCA, 0x0D, 0x61, 0x69, 0xA5, 0xA9, 0x9D, 0xA9, 0xB0, 0x56, 0xF7, 0x79, 0x96,
+    0xC2, 0x51, 0xA9, 0xF4, 0x35, 0x18, 0x4A, 0xE1, 0xA8, 0xB4, 0xF5, 0x3E, 0x39, 0x5D, 0x8A, 0x06,
+    0xDD, 0x6E, 0x6A, 0xAA, 0xCC, 0xE4, 0xA6, 0x67, 0xBF, 0x35, 0x2F, 0xA2, 0x95, 0xAA, 0xA1, 0xB4,
+    0xF6, 0x46, 0xF7, 0x6E, 0x9C, 0x9A, 0x1B, 0x72, 0xE6, 0x91, 0x89, 0x06, 0xED, 0x59, 0xB8, 0x5F,
+    0x15, 0x66, 0x63, 0x4B, 0x1E, 0x86, 0xFB, 0xEF, 0x2A, 0x76, 0x7A, 0xBE, 0x0B, 0x7D, 0x36, 0x14,
+    0xF7, 0x86, 0x69, 0x1D, 0x4F, 0xDA, 0x98, 0x6B, 0x12, 0x6E, 0xEB, 0xA5, 0xDE, 0xCF, 0x44, 0x0E,
+    0xE6, 0xC1, 0x0E, 0x9C, 0x9F, 0xC2, 0xDB, 0x68, 0xAB, 0xB1, 0xC0, 0xA4, 0x22, 0x69, 0x36, 0x55,
+    0x15, 0xE6, 0x0F, 0x8A, 0x61, 0x76, 0xD8, 0x81, 0x2F, 0x9D, 0x39, 0x82, 0xD4, 0x66, 0x25, 0x3D,
+    0xAD, 0x10, 0x37, 0x0B, 0x7B, 0xE2, 0x03, 0x71, 0x94, 0x03, 0x37, 0x86, 0xE0, 0xDE, 0x7F, 0xD8,
+    0x76, 0xB5, 0x6C, 0x3F, 0xE1, 0x0F, 0x32, 0x6A, 0xC8, 0xA8, 0xCE, 0xE2, 0xD3, 0x35, 0x4C, 0x89,
+    0xBA, 0xCB, 0x9F, 0x63, 0xD4, 0xB1, 0xC9, 0xAE, 0xB1, 0x8F, 0x06, 0xE7, 0xA0, 0xC2, 0x50, 0xCD,
+    0x78, 0xA1, 0xBC, 0x99, 0x88, 0xE0, 0xBB, 0x44, 0x92, 0xA2, 0xB7, 0x68, 0xD5, 0x74, 0xEF, 0x81,
+    0xB5, 0x28, 0x73, 0x75, 0xB6, 0xC8, 0xBD, 0xA7, 0x85, 0x77, 0xB3, 0xD0, 0x98, 0x32, 0x55, 0x88,
+    0x73, 0x68, 0x2F, 0x1D, 0x1A, 0xAB, 0x19, 0xFC, 0x56, 0x16, 0x4C, 0x7E, 0xC0, 0x54, 0xE4, 0x8E,
+    0x5E, 0xB4, 0xB8, 0x47, 0xCF, 0xC3, 0x8C, 0xDC, 0x9D, 0x35, 0x35, 0xDD, 0xCF, 0x5F, 0x93, 0xAE,
+    0x0C, 0x39, 0x16, 0x53, 0x38, 0xB6, 0x22, 0xC5, 0xE6, 0x3A, 0xAF, 0x11, 0x88, 0x2A, 0xB0, 0x4E,
+    0x05, 0x32, 0x7E, 0x42, 0x61, 0x83, 0x4F, 0xD2, 0x36, 0x6A, 0xF3, 0x32, 0xE9, 0xE6, 0x3D, 0xFC,
+    0x7A, 0xFE, 0xC0, 0x7C, 0x7C, 0x7A, 0x4D, 0x0F, 0xFC, 0x27, 0xA6, 0x2E, 0xB9, 0xA2, 0xE4, 0xEA,
+    0x72, 0xA8, 0xDD, 0x7C, 0x29, 0xD8, 0x71, 0xC0, 0x99, 0x6F, 0x93, 0xD3, 0x85, 0x5E, 0x95, 0x7A,
+    0xB3, 0xA7, 0xB5, 0xE6, 0x57, 0xD4, 0x05, 0xCE, 0x72, 0xCB, 0x9F, 0xB6, 0x4A, 0xBB, 0xEA, 0xE1,
+    0xD0, 0x6C, 0xD3, 0xA7, 0xAC, 0xD2, 0x48, 0x00, 0x78, 0x80, 0x4E, 0x7C, 0xD1, 0x94, 0xB7, 0xC1,
+    0xD6, 0x93, 0x48, 0x2D, 0x07, 0x78, 0x51, 0x7C, 0x7B, 0xEB, 0x47, 0xA2, 0xAE, 0x3C, 0xEA, 0xF3,
+    0xA4, 0xF0, 0x26, 0x61, 0xC1, 0xA7, 0x92, 0x5F, 0x09, 0x5E, 0x58, 0x9E, 0x9D, 0x77, 0x6C, 0xEE,
+    0x4E, 0x90, 0x13, 0x24, 0x3B, 0x50, 0x0B, 0x7B, 0xDA, 0xEE, 0x98, 0xA6, 0xF7, 0x41, 0x3B, 0xB6,
+    0x4A, 0x8B, 0x20, 0x5D, 0xBE, 0x7C, 0x46, 0x52, 0x05, 0x0A, 0x5E, 0xD9, 0x85, 0x05, 0xCF, 0xF4,
+    0x9C, 0x93, 0x0C, 0xD2, 0xA7, 0x7B, 0x9E, 0x01, 0x69, 0xC6, 0x79, 0xD0, 0xFC, 0xF0, 0x2E, 0x08,
+    0x41, 0x99, 0x16, 0xAC, 0xFE, 0x16, 0xBC, 0x70, 0xD3, 0x9D, 0xAC, 0x94, 0x34, 0x3E, 0x36, 0xD0,
+    0xDC, 0xB7, 0x63, 0x70, 0x9E, 0x7E, 0x79, 0x07, 0x88, 0x88, 0x56, 0xF3, 0xE8, 0x1E, 0x88, 0x2D,
+    0x6D, 0x4A, 0xE1, 0x0B, 0x69, 0x34, 0x4C, 0x53, 0x24, 0xF3, 0x60, 0x3D, 0x83, 0x5F, 0x5D, 0xA9,
+    0x8A, 0x1A, 0x9E, 0xD4, 0x43, 0xC7, 0x63, 0xE6, 0x6D, 0x85, 0xED, 0x8C, 0x2E, 0xA6, 0x64, 0x3C,
+    0xFD, 0x79, 0x63, 0x34, 0xE7, 0x29, 0xE1, 0x19, 0x4D, 0xFE, 0xF4, 0xB1, 0xE1, 0x02, 0x46, 0xA8,
+    0x8C, 0xBA, 0xA9, 0xB5, 0x1E, 0x40, 0xA0, 0xAE, 0x99, 0xEA, 0x48, 0xA9, 0xE7, 0xDA, 0xD1, 0x3F,
+    0xC5, 0x4E, 0xB5, 0x9B, 0xD2, 0xD9, 0x1E, 0x67, 0xDA, 0x31, 0xE0, 0x8B, 0x0A, 0x80, 0x0F, 0x29,
+    0xA3, 0x51, 0xC6, 0x4F, 0x29, 0xE2, 0x27, 0xF7, 0xD5, 0x77, 0x62, 0xEB, 0x0F, 0x3C, 0x3B, 0xE5,
+    0x0F, 0xEC, 0x97, 0xE4, 0x63, 0x4C, 0x9A, 0xA7, 0xD3, 0xAB, 0x93, 0x55, 0xD1, 0xAF, 0xB2, 0xAD,
+    0x6D, 0x66, 0x17, 0x7E, 0x9E, 0x7B, 0x75, 0x36, 0x9C, 0x52, 0xB8, 0x0B, 0x1F, 0xDC, 0xAB, 0x0F,
+    0x39, 0x90, 0x22, 0xFC, 0x4C, 0x0F, 0xA4, 0x00, 0x39, 0x60, 0x64, 0x9D, 0x6B, 0x79, 0x20, 0x85,
+    0x6B, 0xF5, 0x40, 0x8A, 0x56, 0x3D, 0xAF, 0xDB, 0xB1, 0xE7, 0xF3, 0xA3, 0x20, 0x4D, 0xBE, 0xC7,
+    0xEC, 0x4B, 0x38, 0x49, 0x48, 0xCF, 0xF1, 0x4D, 0x61, 0x82, 0xDC, 0xE4, 0xAD, 0x57, 0x93, 0xE4,
+    0xBD, 0xC5, 0xF9, 0x0E, 0x69, 0x13, 0x34, 0xF5, 0x8C, 0x3A, 0xF6, 0xCE, 0x2C, 0x85, 0x82, 0x1B,
+    0x78, 0x26, 0xBD, 0x9E, 0xF7, 0xE2, 0x39, 0xDD, 0x11, 0x9E, 0x09, 0x17, 0x3D, 0x79, 0x7E, 0xC7,
+    0x77, 0x75, 0x94, 0xA8, 0xD5, 0x57, 0xF0, 0xC2, 0xF0, 0xD2, 0x11, 0x09, 0xDA, 0x6F, 0xF8, 0xB3,
+    0x71, 0x7F, 0xFF, 0xCC, 0x42, 0xEA, 0x0B, 0xDE, 0x91, 0xF3, 0xF3, 0x58, 0xC0, 0x39, 0x85, 0x9E,
+    0x27, 0x79, 0x48, 0x61, 0x97, 0x8B, 0x7B, 0xEC, 0x02, 0xB6, 0x86, 0xD0, 0x0E, 0xF1, 0xF9, 0x03,
+    0x77, 0x1A, 0xBF, 0x20, 0x8B, 0xFD, 0x1B, 0x7A, 0xEA, 0x4D, 0x30, 0xFB, 0x5B, 0xC1, 0xAA, 0x89,
+    0xD2, 0x58, 0x43, 0xE6, 0x7B, 0x3F, 0x1B, 0x8F, 0x05, 0xC9, 0x47, 0xC6, 0x0B, 0x7A, 0x99, 0x26,
+    0x66, 0xF9, 0x4B, 0xDA, 0x27, 0x88, 0x5B, 0xC3, 0xBD, 0x9E, 0xE8, 0x93, 0xB8, 0xF7, 0x6F, 0x69,
+    0xD6, 0x64, 0x25, 0x2D, 0x91, 0xF3, 0x89, 0x6C, 0x06, 0xC7, 0x87, 0x46, 0x0F, 0xE3, 0x3B, 0x1C,
+    0x0E, 0xE5, 0x3B, 0x17, 0x3B, 0x7F, 0x6E, 0xD0, 0x83, 0xF1, 0xE0, 0x93, 0xF1, 0x18, 0x78, 0xA1,
+    0xCA, 0x05, 0xD3, 0xFD, 0x5C, 0x1C, 0x15, 0x03, 0xA2, 0xDA, 0xB7, 0xFB, 0x2D, 0x7F, 0x14, 0x42,
+    0x1F, 0x58, 0xF0, 0x28, 0x88, 0xEB, 0x77, 0x98, 0x8C, 0xF0, 0x86, 0x85, 0x61, 0xEC, 0x21, 0x67,
+    0xE7, 0x19, 0x9C, 0x81, 0xE8, 0x9A, 0xF3, 0x48, 0x28, 0x58, 0x04, 0x8F, 0x72, 0xEA, 0xEE, 0x73,
+    0x19, 0x60, 0xB4, 0xDC, 0x83, 0x35, 0x61, 0x1B, 0xBD, 0x8A, 0xBC, 0xF0, 0x7F, 0x0C, 0xE1, 0x9D,
+    0xC2, 0x2A, 0x07, 0x53, 0x73, 0x9D, 0x42, 0x53, 0x7A, 0x1B, 0xFB, 0x65, 0xCC, 0x10, 0xBD, 0xE8,
+    0x81, 0x70, 0x3F, 0x75, 0x06, 0x3B, 0x5B, 0xF6, 0x0B, 0x1E, 0xF7, 0x74, 0x06, 0xF8, 0xB6, 0x07,
+    0x95, 0x82, 0x04, 0xB9, 0xCB, 0xE9, 0xCC, 0xEC, 0x1C, 0xC5, 0x15, 0xF9, 0xF4, 0x5D, 0x17, 0x1C,
+    0x93, 0xE4, 0x7F, 0x7B, 0x17, 0xFC, 0xF6, 0x38, 0x59, 0x4C, 0xB1, 0xB9, 0x28, 0xD3, 0xBF, 0x0B,
+    0x5F, 0x41, 0xF2, 0xA7, 0xFB, 0x76, 0x72, 0x99, 0x4F, 0xFC, 0x54, 0x3A, 0x38, 0xAB, 0x57, 0xAE,
+    0xCF, 0x26, 0xA6, 0x1E, 0xD7, 0xD4, 0xAB, 0x9F, 0x0A, 0x32, 0x13, 0xC9, 0x59, 0xA9, 0x84, 0x4F,
+    0x81, 0x2B, 0xF7, 0x98, 0x28, 0x67, 0x9D, 0x7F, 0x62, 0x06, 0xA5, 0x36, 0x17, 0x11, 0xA1, 0xC3,
+    0x09, 0x18, 0x7D, 0xDE, 0xC9, 0xF4, 0xCB, 0xE1, 0x31, 0x9C, 0x37, 0x03, 0xA8, 0x1F, 0x0B, 0x8C,
+    0x25, 0xD9, 0x03, 0x1F, 0x8B, 0x9B, 0x1B, 0xB7, 0x3D, 0xF1, 0xB1, 0x57, 0x73, 0x1F, 0x78, 0x15,
+    0xFB, 0xA8, 0x2B, 0x3A, 0x7E, 0xB5, 0x76, 0x9E, 0x17, 0xE4, 0x6B, 0x06, 0x46, 0x21, 0xF6, 0xE9,
+    0x87, 0xAA, 0x26, 0x47, 0xC0, 0x1D, 0x79, 0xAA, 0xC0, 0xFD, 0xCC, 0xFD, 0x64, 0xB1, 0xB8, 0x3A,
+    0xCA, 0xFA, 0xE9, 0x4F, 0x95, 0xCF, 0x52, 0xEF, 0xFB, 0x1F, 0x0D, 0x41, 0x00, 0x2F, 0xE1, 0x62,
+    0x24, 0x25, 0x1B, 0x02, 0x28, 0x26, 0xDE, 0x35, 0x6B, 0x1B, 0x33, 0x36, 0x6C, 0x04, 0xAC, 0xC2,
+    0x2F, 0x59, 0x7D, 0x0E, 0x68, 0x8A, 0xD6, 0xE8, 0x52, 0xAB, 0xB3, 0x9D, 0xE4, 0x6D, 0xED, 0x49,
+    0xFD, 0x79, 0x4F, 0x07, 0x43, 0x02, 0x16, 0x7F, 0x5E, 0xC8, 0x95, 0x13, 0x6B, 0xB0, 0xE9, 0x98,
+    0xBB, 0xAD, 0x3F, 0x5C, 0xD1, 0x09, 0x37, 0x10, 0x97, 0x3C, 0x48, 0x31, 0x7D, 0x93, 0x5E, 0xE7,
+    0xE9, 0x5B, 0x60, 0x84, 0x36, 0xE9, 0x7D, 0x77, 0x67, 0x65, 0xC9, 0x6B, 0x35, 0xF0, 0x59, 0xD0,
+    0x81, 0xF3, 0x67, 0xCB, 0x2F, 0x47, 0x1A, 0x17, 0x6B, 0x8D, 0x6F, 0x02, 0xC4, 0xF3, 0xA5, 0x4F,
+    0x79, 0x43, 0xCA, 0xB1, 0x1C, 0x0E, 0x39, 0x84, 0xFD, 0x41, 0xB3, 0xC9, 0xED, 0x2A, 0x1A, 0xBE,
+    0xA0, 0xC3, 0x33, 0x19, 0x86, 0x27, 0x3F, 0x3D, 0x3C, 0xC3, 0x01, 0xAE, 0xF1, 0xA7, 0x2A, 0x5C,
+    0x74, 0x74, 0x7F, 0xA8, 0xA3, 0xFB, 0xE6, 0x53, 0x18, 0x5D, 0xF5, 0x78, 0xC5, 0x19, 0xCF, 0x17,
+    0x44, 0xB0, 0x69, 0x17, 0x9A, 0x3B, 0x37, 0xB3, 0x51, 0xA2, 0x6B, 0xF8, 0x44, 0x95, 0x83, 0x9F,
+    0xEA, 0x6F, 0x46, 0x1B, 0x18, 0xC9, 0xDF, 0xF0, 0xFC, 0x9D, 0xC8, 0x34, 0xB7, 0x8C, 0x1B, 0xCF,
+    0x5B, 0x24, 0xE6, 0x7A, 0x5A, 0xDC, 0xF5, 0x4A, 0xB4, 0x74, 0xF0, 0x9E, 0x8C, 0x86, 0x1B, 0xA9,
+    0xE3, 0x38, 0xFB, 0xE7, 0xEF, 0x0E, 0x75, 0xDE, 0x3D, 0xD4, 0x59, 0xD3, 0xC8, 0x51, 0x4D, 0x60,
+    0x63, 0x6D, 0x21, 0xC1, 0x3E, 0x9F, 0x5C, 0x30, 0xA4, 0x94, 0x43, 0x7D, 0xFB, 0x6C, 0x37, 0x5E,
+    0x6C, 0x9B, 0x5D, 0xEE, 0xD9, 0x3D, 0x5E, 0x84, 0xC7, 0x19, 0x6F, 0x86, 0xE3, 0x8C, 0xF5, 0x40,
+    0xE1, 0x84, 0x07, 0x09, 0xE5, 0xE3, 0x83, 0x84, 0xD6, 0x96, 0xA6, 0xAA, 0xE0, 0x11, 0xAD, 0x48,
+    0x52, 0xE2, 0xF3, 0x2C, 0x17, 0x1F, 0xD3, 0x37, 0xC0, 0xA7, 0x4F, 0xE9, 0x33, 0x8B, 0x4C, 0xD4,
+    0x94, 0xF0, 0x3A, 0xC8, 0xC5, 0xBD, 0xF0, 0x98, 0x8E, 0x57, 0x13, 0x4D, 0x53, 0x55, 0xB4, 0x74,
+    0xB3, 0x22, 0xE4, 0x31, 0x58, 0x30, 0x2B, 0x9E, 0x03, 0xB7, 0x71, 0x25, 0xA6, 0x66, 0xD4, 0xAD,
+    0x45, 0xDE, 0xDF, 0xDF, 0x32, 0xEB, 0x6B, 0x39, 0x98, 0xCD, 0x55, 0xF7, 0xA6, 0x09, 0x54, 0x8F,
+    0xCC, 0x4E, 0x42, 0xC5, 0x35, 0xBD, 0xAF, 0x72, 0xB8, 0x31, 0x86, 0x3C, 0x47, 0x55, 0xE3, 0xA1,
+    0x22, 0x9E, 0x5E, 0x0C, 0xDD, 0x05, 0x4F, 0x32, 0x0A, 0xD2, 0x13, 0x8D, 0xFA, 0xB5, 0x50, 0xDF,
+    0xDE, 0xEF, 0x5C, 0x5B, 0xD7, 0x48, 0x86, 0xC1, 0xE6, 0xE6, 0x62, 0x99, 0xD9, 0x11, 0x43, 0xFE,
+    0xB8, 0x21, 0xCD, 0xEA, 0x12, 0x7A, 0x38, 0x3A, 0x4F, 0x6B, 0x9B, 0xDE, 0x01, 0x43, 0x15, 0xDE,
+    0xB1, 0xD4, 0x06, 0x2D, 0x61, 0x3D, 0x04, 0x98, 0x17, 0xE3, 0x60, 0xDF, 0x21, 0x33, 0x82, 0x53,
+    0x61, 0x4D, 0xF1, 0xF4, 0x14, 0xCE, 0xCC, 0xED, 0x44, 0x5F, 0x33, 0xDB, 0xC3, 0x73, 0xC3, 0x34,
+    0xBC, 0x8E, 0x71, 0x67, 0xB8, 0x55, 0x1C, 0x1B, 0x4E, 0xF6, 0xB0, 0x36, 0x71, 0x38, 0xB3, 0x34,
+    0xC8, 0x0D, 0x17, 0x46, 0x8A, 0x8D, 0x24, 0xBF, 0xA4, 0x51, 0xD3, 0xB5, 0x79, 0xC7, 0xD1, 0x2D,
+    0x60, 0x6A, 0xBE, 0xDE, 0xC4, 0x8D, 0x2E, 0x25, 0x75, 0xBC, 0x2E, 0xCA, 0x3D, 0x5F, 0x6F, 0x1F,
+    0xD5, 0xB1, 0xF4, 0x81, 0x92, 0xE7, 0xF9, 0x7A, 0xC3, 0xEE, 0x05, 0x5F, 0x7A, 0x0B, 0x7B, 0xDD,
+    0x45, 0x49, 0xCF, 0xB3, 0xCC, 0x92, 0x3A, 0x1C, 0xA1, 0xD4, 0x50, 0x75, 0x06, 0xCA, 0x15, 0x15,
+    0x1B, 0x22, 0x23, 0x79, 0xF0, 0x71, 0xB6, 0x3C, 0x02, 0x65, 0xF0, 0xDF, 0xA1, 0xFB, 0x86, 0x63,
+    0x12, 0xBC, 0xC8, 0x1A, 0x4D, 0xDB, 0x55, 0xEB, 0xC1, 0x51, 0x95, 0x29, 0x21, 0xA9, 0x35, 0x4F,
+    0x37, 0x83, 0x8B, 0xFE, 0xD6, 0x97, 0xDD, 0x6F, 0x4E, 0xCB, 0x91, 0x43, 0xBB, 0x0F, 0xD0, 0x5D,
+    0x04, 0xF9, 0xF6, 0x20, 0xE0, 0xFA, 0x91, 0x21, 0x0D, 0x8C, 0x6A, 0x6E, 0x3C, 0x03, 0xEA, 0xB7,
+    0x8F, 0xF7, 0xE4, 0x11, 0x3C, 0x95, 0x2F, 0x67, 0x63, 0x5E, 0x90, 0xF3, 0x3B, 0x85, 0x9D, 0xCC,
+    0x0B, 0x5F, 0x0A, 0xC7, 0x3C, 0x1F, 0x8E, 0x09, 0x1B, 0xB6, 0x5E, 0x90, 0x58, 0x7A, 0xB4, 0x0D,
+    0x3E, 0x04, 0xC0, 0xEC, 0xB8, 0xA7, 0x2B, 0xD6, 0xCF, 0x2E, 0x70, 0xAF, 0x9A, 0x1E, 0x83, 0x68,
+    0x00, 0x31, 0x12, 0xA2, 0x0B, 0x97, 0x1E, 0xFD, 0x5C, 0x13, 0xC8, 0xD7, 0x9A, 0x3C, 0x87, 0x62,
+    0xDE, 0x81, 0xCF, 0x54, 0x60, 0x56, 0xFD, 0x27, 0x67, 0x95, 0x7D, 0x1A, 0x56, 0xE1, 0xAD, 0xB5,
+    0x3A, 0xD8, 0xC5, 0xBD, 0x61, 0x23, 0x1D, 0x51, 0xBB, 0xCB, 0x81, 0x79, 0x6F, 0x6C, 0x1F, 0x7A,
+    0x3B, 0xD8, 0xDF, 0xAA, 0x1D, 0x26, 0x12, 0x4B, 0xF0, 0xF3, 0x67, 0xF8, 0x37, 0x89, 0xDB, 0x0E,
+    0x28, 0x19, 0x07, 0xE9, 0xCF, 0x76, 0xB8, 0xB8, 0x68, 0x47, 0x9D, 0x78, 0xE9, 0x28, 0xF8, 0xF4,
+    0x73, 0x1F, 0x03, 0x45, 0x4F, 0xA7, 0x10, 0xB2, 0xF9, 0x1F, 0x16, 0x67, 0xCA, 0xE6, 0x05, 0x65,
+    0xF3, 0xF0, 0xF0, 0xAC, 0x94, 0x95, 0x9A, 0xE0, 0xF8, 0x81, 0xF0, 0xE2, 0xDA, 0xF6, 0x32, 0x50,
+    0x59, 0xBE, 0x52, 0x6F, 0x9C, 0x07, 0x80, 0xC2, 0x80, 0xC8, 0xA9, 0x50, 0x92, 0x50, 0x45, 0x42,
+    0x05, 0x89, 0xAA, 0x47, 0x4C, 0x39, 0x32, 0x00, 0x4B, 0x30, 0xB5, 0x0B, 0xDA, 0xE0, 0x61, 0x40,
+    0xBA, 0x38, 0x57, 0x45, 0xEB, 0x5A, 0xB3, 0xED, 0xA6, 0x2C, 0xD0, 0x5F, 0xCC, 0x0A, 0xEA, 0xD0,
+    0x5D, 0xFA, 0xC2, 0x46, 0xF7, 0xB8, 0xE2, 0x83, 0x0A, 0x39, 0xC0, 0xA4, 0xF0, 0x5E, 0xAD, 0x69,
+    0xFB, 0x8A, 0xF7, 0x9A, 0x60, 0xD6, 0xA2, 0xF0, 0xAE, 0x2C, 0x59, 0x24, 0x29, 0x2B, 0xFE, 0x5C,
+    0x16, 0x70, 0x8D, 0xC2, 0x3B, 0xC2, 0xAF, 0x54, 0x2C, 0xC8, 0x8E, 0x8B, 0x44, 0x27, 0xC5, 0xDB,
+    0x52, 0x40, 0xD4, 0x6D, 0x51, 0xBA, 0x65, 0xFE, 0x43, 0x2D, 0xAC, 0x8B, 0x57, 0x59, 0x28, 0xD6,
+    0x38, 0x71, 0x06, 0x61, 0x4B, 0x6F, 0xC3, 0x44, 0x8B, 0xC2, 0x47, 0xBD, 0x16, 0x92, 0x8F, 0x3B,
+    0x2D, 0xC4, 0x38, 0x87, 0x64, 0xCD, 0x50, 0xA7, 0x46, 0x0B, 0xC2, 0xCA, 0x63, 0x27, 0x46, 0x6E,
+    0x6C, 0xA4, 0x90, 0x6B, 0x0A, 0x4D, 0xEA, 0x2C, 0x54, 0x14, 0x4A, 0x6F, 0x10, 0xF8, 0x02, 0x49,
+    0x33, 0xC2, 0xAD, 0x12, 0x34, 0xF5, 0xE2, 0x96, 0xDF, 0xC6, 0x82, 0xAD, 0x48, 0xB6, 0x0E, 0x76,
+    0x76, 0xB2, 0x61, 0x2B, 0x1B, 0xF6, 0x32, 0x14, 0x2E, 0xCB, 0x0E, 0x16, 0x32, 0xA5, 0x21, 0xB9,
+    0x34, 0x06, 0xE5, 0x40, 0x23, 0xD3, 0xA8, 0x0D, 0x38, 0xD2, 0x02, 0xB2, 0xA2, 0xB1, 0xD0, 0xF0,
+    0x2F, 0x48, 0xEF, 0x0B, 0xFB, 0xF2, 0x01, 0x0A, 0x1F, 0x0B, 0x03, 0xF7, 0x1E, 0x0B, 0xC2, 0x1B,
+    0xFF, 0x31, 0x0A, 0x1F, 0x4A, 0x01, 0x82, 0x42, 0x5A, 0xB9, 0xDF, 0xB3, 0x42, 0xF1, 0x56, 0xA7,
+    0x85, 0xFC, 0x47, 0xAD, 0x16, 0xD2, 0x9F, 0x37, 0x5A, 0x48, 0x64, 0x1A, 0xB3, 0x10, 0xBB, 0x4A,
+    0x0B, 0x91, 0xDB, 0x68, 0x01, 0x32, 0x99, 0xD3, 0x5C, 0x88, 0x43, 0x61, 0x19, 0x33, 0x23, 0x5C,
+    0xE8, 0x46, 0x1E, 0x08, 0x33, 0x2F, 0xE9, 0x45, 0x43, 0xC1, 0x87, 0x7D, 0xC4, 0x3E, 0x42, 0x6E,
+    0x1B, 0xF6, 0x3F, 0xE8, 0x7F, 0x37, 0x5B, 0xFF, 0x85, 0xCF, 0x42, 0xA4, 0x92, 0xCA, 0xD2, 0x78,
+    0xD0, 0x86, 0xCA, 0x22, 0xBD, 0x34, 0xF2, 0x19, 0xB0, 0xBC, 0x1F, 0xC1, 0x95, 0xB3, 0x62, 0xEF,
+    0x12, 0xFD, 0x30, 0xD5, 0xF1, 0xCD, 0x2D, 0xAD, 0x9C, 0xB7, 0x9C, 0x6A, 0x88, 0xC0, 0xAD, 0x9A,
+    0x0F, 0x7B, 0x59, 0xAD, 0x2F, 0x91, 0x72, 0xF4, 0x7A, 0x74, 0xBB, 0xB9, 0xD5, 0x75, 0x33, 0xCD,
+    0xE9, 0x3D, 0x55, 0xBB, 0xD5, 0x44, 0xB3, 0xA6, 0x86, 0x96, 0xC5, 0x53, 0x0D, 0x3B, 0x81, 0x1D,
+    0xF0, 0xC9, 0xDE, 0xD8, 0x86, 0x31, 0xA9, 0xED, 0xC8, 0x41, 0x79, 0x7D, 0x67, 0x55, 0x98, 0x27,
+    0x1F, 0xED, 0x57, 0x4C, 0x53, 0xA0, 0x91, 0x52, 0x9A, 0x77, 0x6B, 0x4D, 0xAB, 0x99, 0xCA, 0x51,
+    0x60, 0x76, 0xDD, 0x32, 0x41, 0x36, 0x40, 0x19, 0x84, 0x02, 0xE7, 0x54, 0xA7, 0xA6, 0xE5, 0x46,
+    0xC4, 0x48, 0x33, 0x36, 0xFA, 0x1F, 0x14, 0x37, 0xF8, 0x66, 0x5A, 0xD6, 0x18, 0xC0, 0x55, 0x85,
+    0xFD, 0x8B, 0xF2, 0x94, 0x6B, 0x6A, 0xDD, 0xF4, 0xC6, 0xEF, 0x4B, 0x2B, 0x59, 0x43, 0x05, 0x0D,
+    0x41, 0x3C, 0xDF, 0xE7, 0xA4, 0x68, 0x19, 0x7F, 0x84, 0xDC, 0xF9, 0xC3, 0x69, 0x97, 0x79, 0x8B,
+    0x43, 0x41, 0x87, 0x23, 0x80, 0x3E, 0xC0, 0x11, 0x40, 0xDF, 0x6C, 0x27, 0xAE, 0x93, 0x89, 0x73,
+    0x79, 0x24, 0x3F, 0x4D, 0x9B, 0x29, 0x3B, 0xAA, 0x23, 0x25, 0x17, 0x44, 0x87, 0xBE, 0x96, 0x72,
+    0x59, 0x78, 0x3D, 0xBC, 0xF1, 0xC5, 0x1A, 0x0A, 0xA5, 0x1A, 0x41, 0x21, 0xCC, 0xE4, 0x12, 0x24,
+    0x85, 0x6A, 0x8F, 0x4C, 0x1A, 0xF4, 0x4F, 0xE5, 0xDF, 0x58, 0xE3, 0xF4, 0x94, 0x87, 0xC2, 0x99,
+    0xC0, 0x39, 0xF1, 0x85, 0xA9, 0x2F, 0xCC, 0x7C, 0x21, 0xF2, 0x05, 0xA6, 0x4C, 0x08, 0x4C, 0x80,
+    0x35, 0x7E, 0xCA, 0x0A, 0xC5, 0xC6, 0x0A, 0x90, 0x40, 0x8D, 0x1E, 0x5A, 0x78, 0xAD, 0xCB, 0xF4,
+    0xF4, 0x5F, 0x88, 0xC6, 0x7A, 0xA2, 0x4F, 0x6F, 0x05, 0xCA, 0xA1, 0x8E, 0x09, 0x2B, 0x84, 0x81,
+    0xF7, 0x47, 0x23, 0xB6, 0x5E, 0x43, 0xD0, 0xFA, 0xFA, 0xED, 0xA8, 0xAC, 0xA6, 0xE8, 0xFA, 0xD6,
+    0x14, 0xD0, 0x9A, 0xC5, 0x8B, 0xF6, 0xD2, 0xD5, 0xEA, 0x5A, 0xDC, 0x99, 0x3C, 0x90, 0x9A, 0x59,
+    0x84, 0x07, 0xC7, 0xB3, 0x80, 0x11, 0x50, 0x51, 0xE1, 0xC0, 0x5D, 0xC3, 0x31, 0x80, 0xF2, 0xBC,
+    0x2E, 0xB6, 0x93, 0x0E, 0x0A, 0x67, 0x71, 0x80, 0xD6, 0xD9, 0x72, 0x5F, 0x13, 0xF0, 0x64, 0xE5,
+    0xD8, 0x7A, 0x3B, 0xB2, 0xB4, 0x05, 0x32, 0x47, 0xA5, 0xE3, 0x85, 0xB1, 0xE9, 0x43, 0x53, 0xCF,
+    0x59, 0x2E, 0x10, 0x97, 0xE0, 0xB8, 0x6C, 0x30, 0xB0, 0x9D, 0x65, 0x36, 0x68, 0x86, 0x0C, 0x07,
+    0x14, 0x5B, 0xE1, 0xB8, 0xD9, 0x53, 0x86, 0x85, 0x7B, 0x7C, 0xF8, 0x3D, 0xD3, 0xF3, 0xE1, 0xD8,
+    0xDC, 0xC6, 0x8E, 0xD9, 0x2D, 0x51, 0x86, 0xAB, 0xCF, 0x01, 0x9C, 0xDA, 0x20, 0x2E, 0x69, 0x6A,
+    0x29, 0x11, 0x2D, 0x66, 0x9D, 0xD0, 0xE7, 0x36, 0xB9, 0x77, 0x8C, 0x11, 0xAC, 0xE9, 0x22, 0x74,
+    0x3C, 0x4A, 0x67, 0x4D, 0xB5, 0x39, 0xDB, 0xE1, 0xFF, 0x28, 0x41, 0x9F, 0xFA, 0x53, 0x8E, 0xB4,
+    0xDD, 0xF9, 0xBB, 0xBB, 0x38, 0x3A, 0xF3, 0x5A, 0xFC, 0x9D, 0xAC, 0x56, 0x7B, 0xCF, 0x95, 0xDD,
+    0x75, 0x99, 0x1A, 0x4D, 0x71, 0xA0, 0x29, 0xCC, 0xE0, 0x44, 0x47, 0xAC, 0xD9, 0x2E, 0x4D, 0x19,
+    0xCE, 0xA2, 0x09, 0x76, 0xCE, 0xA2, 0x41, 0x22, 0x12, 0x4D, 0xBD, 0xD1, 0xB1, 0x3F, 0xC1, 0x25,
+    0x2A, 0xAB, 0x32, 0x02, 0xBB, 0x5E, 0x37, 0xB1, 0x9A, 0xDB, 0xA5, 0xD3, 0x98, 0xB8, 0x4F, 0x63,
+    0x4A, 0x73, 0x3B, 0x8B, 0xC6, 0x4E, 0x2F, 0xF5, 0x21, 0xE4, 0xFC, 0xC0, 0x12, 0x5A, 0x58, 0x92,
+    0xDC, 0xC4, 0x3B, 0x61, 0xDD, 0x81, 0xB9, 0x2C, 0xB9, 0x4D, 0x59, 0xFB, 0x57, 0x06, 0x9F, 0x23,
+    0x3B, 0x7A, 0xD8, 0xAB, 0x15, 0xB7, 0xDA, 0x45, 0xE8, 0x5C, 0x5F, 0xDC, 0xCB, 0x84, 0xB8, 0x8F,
+    0x84, 0xAD, 0x7F, 0x49, 0x95, 0x5F, 0x96, 0x9F, 0x0D, 0xDA, 0x00, 0x4A, 0x43, 0xC8, 0xA5, 0x6B,
+    0x87, 0xBD, 0x61, 0x22, 0xCD, 0x91, 0x62, 0xAC, 0xF5, 0x1E, 0x89, 0x96, 0x9C, 0xDD, 0xDC, 0x9A,
+    0x86, 0x14, 0x88, 0xAA, 0x18, 0x7F, 0xA5, 0xA7, 0x64, 0xD5, 0x70, 0xDD, 0x31, 0x5F, 0x68, 0x19,
+    0xBD, 0x7F, 0xD5, 0x55, 0x5F, 0x1E, 0x47, 0xC2, 0xA8, 0x97, 0x76, 0xF7, 0xC2, 0x4A, 0x7A, 0x0F,
+    0x8B, 0x66, 0x04, 0x90, 0xF0, 0xB5, 0x63, 0x4E, 0x2E, 0x86, 0x8F, 0x21, 0xB1, 0x6C, 0xCD, 0x73,
+    0x9B, 0xA6, 0x3E, 0x35, 0x13, 0x5E, 0x5C, 0xFB, 0x43, 0x95, 0x2C, 0xB5, 0x5B, 0x4D, 0x7F, 0xAA,
+    0xA8, 0x35, 0x46, 0x4F, 0x51, 0x43, 0x34, 0xB9, 0x36, 0xB9, 0x7E, 0x8A, 0x16, 0x7F, 0x11, 0x7A,
+    0x9A, 0x3F, 0xC2, 0x2E, 0x04, 0x70, 0xE8, 0xCB, 0xE8, 0xD5, 0x17, 0x3A, 0xC8, 0x1C, 0xBF, 0x1D,
+    0xFC, 0xFB, 0x71, 0x5B, 0x3F, 0x93, 0x11, 0xD1, 0x95, 0xBD, 0x4C, 0x97, 0x9E, 0xCF, 0xDC, 0x6A,
+    0x4E, 0xB6, 0x71, 0xF3, 0x3E, 0x72, 0xFE, 0x79, 0xF9, 0xF7, 0x77, 0x9A, 0xDF, 0x0B, 0x69, 0x7E,
+    0xB7, 0x53, 0xBE, 0xD2, 0x44, 0x94, 0x41, 0xDC, 0x18, 0x03, 0x1B, 0xFB, 0x6D, 0x2D, 0xAA, 0xED,
+    0x13, 0x99, 0xFA, 0xD7, 0xCE, 0xEC, 0xD5, 0x67, 0x5A, 0xF3, 0x1B, 0x98, 0xB7, 0x64, 0xAF, 0x59,
+    0xF5, 0xED, 0x18, 0xE6, 0x10, 0xA6, 0x5D, 0xF9, 0xB7, 0x97, 0x50, 0xF6, 0xF3, 0x10, 0xCB, 0x77,
+    0x34, 0xA6, 0x52, 0x24, 0x4E, 0x0A, 0x40, 0x9F, 0xF6, 0xA8, 0xD3, 0xD3, 0x3D, 0x34, 0x9B, 0xC1,
+    0xF8, 0x54, 0x11, 0x0F, 0xA0, 0xB6, 0x78, 0x4D, 0x7A, 0x20, 0x73, 0x0A, 0x3B, 0x2A, 0x40, 0x37,
+    0x3B, 0x1F, 0xF5, 0x54, 0x59, 0xF7, 0xA6, 0xC3, 0xE6, 0x1D, 0x97, 0xAF, 0xAA, 0xD7, 0xC6, 0x90,
+    0x06, 0x71, 0x2B, 0xAE, 0xC7, 0xFD, 0x35, 0xAC, 0x84, 0xFE, 0xF0, 0xC0, 0xB5, 0xC3, 0xF1, 0x2D,
+    0x4C, 0xC7, 0x9B, 0x6D, 0x7B, 0x08, 0xFE, 0x35, 0x87, 0xBB, 0x75, 0x69, 0x52, 0x1F, 0xA0, 0xB4,
+    0x56, 0xF5, 0x33, 0x57, 0x42, 0xA8, 0x1E, 0x6A, 0x4B, 0x7B, 0x8D, 0x26, 0x1E, 0x54, 0x77, 0x65,
+    0xDB, 0xAD, 0x79, 0x50, 0x84, 0xA5, 0xBC, 0x51, 0x83, 0x62, 0x3A, 0x84, 0x1C, 0xC7, 0x43, 0x06,
+    0x6A, 0x1B, 0xBC, 0xDB, 0x48, 0x61, 0x0A, 0x92, 0x5F, 0x0D, 0x04, 0x3B, 0xE3, 0xF1, 0x82, 0x07,
+    0x45, 0xBF, 0xA4, 0xD6, 0xF6, 0x90, 0x3B, 0x44, 0xB5, 0x0B, 0xF5, 0xF3, 0x41, 0x2B, 0xC7, 0xC3,
+    0x37, 0x26, 0x84, 0x53, 0xC2, 0x39, 0x61, 0x64, 0x87, 0x72, 0x30, 0xCF, 0x02, 0x61, 0xF1, 0x01,
+    0xA0, 0x7B, 0xAF, 0x85, 0xFF, 0xF6, 0xCB, 0x2D, 0x2C, 0x14, 0xB1, 0xC0, 0x79, 0x07, 0x18, 0xB5,
+    0x80, 0x49, 0x8D, 0x03, 0x49, 0x45, 0xD8, 0x15, 0x58, 0x94, 0x80, 0xC8, 0xB4, 0x5E, 0x7C, 0x84,
+    0x30, 0xDC, 0xE2, 0x63, 0x26, 0xAB, 0x16, 0x81, 0x5A, 0x20, 0xC6, 0xB2, 0x2D, 0xF4, 0x00, 0x53,
+    0x9E, 0x79, 0x0C, 0xF5, 0x05, 0xE0, 0x92, 0x10, 0x4D, 0x04, 0xD3, 0x26, 0x0D, 0x85, 0xFD, 0x75,
+    0xE2, 0x63, 0xF6, 0x15, 0x04, 0xFE, 0x1C, 0xAF, 0xA7, 0x78, 0xFA, 0x91, 0x91, 0xF4, 0x0D, 0x3C,
+    0x8B, 0x91, 0x74, 0x9D, 0xB2, 0x3D, 0x0F, 0x9A, 0x40, 0xF9, 0x60, 0x79, 0xB0, 0x2B, 0xC0, 0x3E,
+    0x03, 0x1D, 0xAB, 0x69, 0x1D, 0xC3, 0x9E, 0x87, 0x72, 0x28, 0x98, 0x38, 0x28, 0xFC, 0xDE, 0xD8,
+    0x21, 0x45, 0x4F, 0xBB, 0x8B, 0xF7, 0xA4, 0xD3, 0x48, 0x91, 0x48, 0xA7, 0xED, 0x79, 0xD2, 0xE9,
+    0x03, 0xB3, 0x6F, 0xF7, 0x37, 0xA9, 0x94, 0xC6, 0xF1, 0xEA, 0x64, 0x86, 0x62, 0x95, 0x16, 0xE7,
+    0x0C, 0xEC, 0x03, 0xCD, 0x56, 0x23, 0xC9, 0xBA, 0xA8, 0x03, 0xEF, 0x83, 0x3A, 0xA0, 0x8D, 0xC6,
+    0x06, 0x6C, 0x46, 0xFF, 0xC3, 0x19, 0xA5, 0x7A, 0xA5, 0xDD, 0x97, 0xAB, 0xCC, 0x69, 0xCF, 0xB4,
+    0x37, 0x44, 0x0C, 0xAF, 0xC4, 0xDB, 0x5F, 0xB9, 0x60, 0xF6, 0xED, 0x31, 0xD3, 0xA1, 0x0C, 0x87,
+    0x32, 0x1B, 0xCA, 0x68, 0x9C, 0x66, 0x32, 0x90, 0x8F, 0xD6, 0x87, 0x61, 0xEC, 0x64, 0xEB, 0xFE,
+    0xE9, 0x36, 0x5B, 0x77, 0x37, 0x64, 0xEB, 0xF6, 0x79, 0x66, 0xB7, 0x96, 0xB3, 0x5D, 0xC8, 0x04,
+    0x87, 0x9A, 0x49, 0xD6, 0x7B, 0xE9, 0x22, 0x7F, 0xAC, 0x7A, 0xCE, 0x86, 0xC3, 0xE1, 0x2E, 0x6B,
+    0x9F, 0x2B, 0xD6, 0x1F, 0xC2, 0xF8, 0x77, 0xC9, 0xCF, 0x9F, 0x5C, 0xF2, 0xF3, 0xD1, 0xF4, 0x67,
+    0x2A, 0xDC, 0x76, 0x3C, 0xFD, 0xE7, 0xC3, 0xF4, 0xBF, 0xFE, 0x68, 0xD3, 0xFF, 0x19, 0xE9, 0xFF,
+    0xBD, 0xE9, 0xBF, 0x7E, 0xF8, 0xF4, 0xFF, 0x9C, 0x8C, 0xD7, 0xA4, 0x9D, 0x74, 0x1A, 0xE2, 0x0A,
+    0x62, 0xC2, 0x44, 0x36, 0x3D, 0x4F, 0x0C, 0xBC, 0x11, 0xDC, 0x38, 0x6B, 0x98, 0x92, 0xC1, 0xC0,
+    0x5D, 0x5A, 0x3E, 0xA1, 0x98, 0x14, 0xEA, 0x2B, 0x54, 0x7A, 0x0C, 0x2A, 0x6B, 0x9F, 0x81, 0x69,
+    0x9C, 0x2D, 0xA6, 0x3C, 0xE7, 0x90, 0xB1, 0x32, 0x58, 0xAD, 0x6E, 0x1A, 0xFF, 0x5A, 0x8E, 0xCC,
+    0xDF, 0xEB, 0xE1, 0x39, 0x32, 0x1E, 0x5F, 0xA3, 0x1B, 0x7A, 0xFA, 0xFA, 0x55, 0xE3, 0xCC, 0xEA,
+    0x51, 0x1D, 0x32, 0xB4, 0xF4, 0xF6, 0x8E, 0x6C, 0x16, 0x61, 0x9F, 0x4B, 0x70, 0xBC, 0x4C, 0x5A,
+    0x0B, 0x48, 0xAA, 0xB8, 0xDA, 0xDF, 0xE3, 0x9E, 0xEE, 0xE1, 0xC8, 0x9E, 0x69, 0x31, 0x17, 0x91,
+    0x5D, 0x34, 0x62, 0x68, 0xD4, 0x06, 0x64, 0xA9, 0x67, 0x2D, 0xEA, 0x3A, 0x6E, 0xBD, 0x47, 0x3F,
+    0x2D, 0x5F, 0x6A, 0x4B, 0xB7, 0xB0, 0x41, 0x15, 0x16, 0x34, 0x79, 0x7D, 0x45, 0x6B, 0x31, 0x0F,
+    0x9E, 0x02, 0x6F, 0x6D, 0x1E, 0xCC, 0xAA, 0xC1, 0xEC, 0x62, 0x75, 0x77, 0x4F, 0x54, 0xBB, 0x99,
+    0xAB, 0x69, 0xD6, 0x2B, 0x40, 0x4B, 0x15, 0xB0, 0x4C, 0xF6, 0xCA, 0xB6, 0x61, 0x55, 0x16, 0xAB,
+    0xA5, 0x9C, 0xDC, 0xC1, 0x4D, 0x93, 0xB5, 0x2C, 0x8B, 0x8B, 0xA6, 0xC3, 0x53, 0x41, 0x6D, 0x3E,
+    0x3E, 0x6D, 0xD9, 0xB7, 0x48, 0xE3, 0x11, 0xC7, 0x70, 0xD4, 0xD2, 0x67, 0xF1, 0x7C, 0xC5, 0x3D,
+    0x01, 0x30, 0xA6, 0x69, 0xC4, 0x0B, 0x7F, 0x26, 0xFA, 0x9D, 0x25, 0xF8, 0x7D, 0x21, 0xC6, 0xD4,
+    0x73, 0x90, 0x31, 0x39, 0xC8, 0xF4, 0x61, 0x1C, 0xE4, 0xB3, 0x39, 0xBE, 0x93, 0xD5, 0x73, 0xDF,
+    0xA5, 0xEC, 0x44, 0x06, 0x33, 0x6E, 0x34, 0x20, 0x6C, 0xA3, 0x99, 0x17, 0xBF, 0xCE, 0xA3, 0x54,
+    0x3B, 0xEE, 0x6F, 0xC1, 0xE1, 0xC8, 0xA3, 0xEB, 0x8B, 0x31, 0xBE, 0xAB, 0xFF, 0xBA, 0x42, 0xF6,
+    0x88, 0x1F, 0x71, 0x2B, 0x80, 0xFE, 0x0E, 0x87, 0x6C, 0xE1, 0xE4, 0x72, 0xA4, 0x44, 0xCF, 0xB3,
+    0x9E, 0x39, 0xBD, 0x07, 0x42, 0x85, 0x85, 0x3C, 0x84, 0x49, 0x8D, 0xD8, 0x30, 0x8D, 0x95, 0x88,
+    0x7A, 0x3B, 0xA9, 0x8C, 0x2E, 0x42, 0x99, 0x3A, 0x06, 0xA5, 0x35, 0xB7, 0xDC, 0x8A, 0xFB, 0x2F,
+    0xBC, 0xC0, 0x36, 0x74, 0xAB, 0xF9, 0xD0, 0x0E, 0xA3, 0x80, 0x58, 0xF9, 0x89, 0x1B, 0xE2, 0x71,
+    0x94, 0x55, 0x9B, 0x8E, 0xC2, 0xA4, 0x2C, 0xE2, 0x74, 0x14, 0x7C, 0x36, 0xDE, 0x2B, 0xA8, 0xEA,
+    0x79, 0xBE, 0x50, 0x0B, 0xB3, 0x86, 0x5B, 0x52, 0xF3, 0xC1, 0x9E, 0x4A, 0xBA, 0xB1, 0x35, 0x68,
+    0x8D, 0xD4, 0xEE, 0xF9, 0x06, 0x96, 0xC5, 0x9C, 0xF9, 0x1A, 0xD2, 0x12, 0xF6, 0xD9, 0xE7, 0xB3,
+    0xE7, 0xB2, 0xD3, 0x52, 0x10, 0x4D, 0x01, 0x6E, 0xF3, 0xC8, 0x10, 0x2C, 0x03, 0xCE, 0xD3, 0x05,
+    0x44, 0x62, 0xA7, 0x4D, 0xB2, 0x3D, 0x0D, 0x6D, 0x33, 0xDD, 0x9E, 0x8D, 0xB7, 0x09, 0x0E, 0x56,
+    0x87, 0x9F, 0x26, 0x0A, 0x13, 0x52, 0x50, 0x37, 0x92, 0x82, 0xA6, 0x26, 0x05, 0xBD, 0x31, 0x96,
+    0x82, 0x78, 0xEE, 0x2F, 0xA4, 0xAA, 0x73, 0x01, 0x0F, 0x3E, 0x2B, 0x90, 0xE5, 0xAB, 0x80, 0xC6,
+    0xC7, 0x9B, 0x7E, 0x1C, 0x0C, 0x07, 0x30, 0x80, 0x3B, 0xF8, 0x35, 0x1C, 0x26, 0xBB, 0x1A, 0x98,
+    0x53, 0x20, 0xB7, 0xBC, 0x85, 0x9A, 0xF3, 0x70, 0x0C, 0x1E, 0x9E, 0xB2, 0xF0, 0x31, 0x80, 0xA6,
+    0x9F, 0xEE, 0x4F, 0x81, 0x0B, 0x25, 0x77, 0xEE, 0xA8, 0xFA, 0x38, 0xD2, 0xE4, 0xC9, 0xF6, 0xD7,
+    0xAF, 0xDE, 0x78, 0xE4, 0x44, 0x7D, 0x54, 0x73, 0x6D, 0xFF, 0xE8, 0x67, 0x72, 0xDE, 0xDF, 0x98,
+    0x5F, 0x84, 0x55, 0xCF, 0x9C, 0xBD, 0x4C, 0xB3, 0xF9, 0xAA, 0x1D, 0x19, 0x93, 0xA9, 0xBD, 0x72,
+    0xCF, 0xC2, 0x37, 0x8E, 0x8C, 0xB2, 0x43, 0x4C, 0x86, 0x93, 0x02, 0x1E, 0x07, 0x9F, 0xBC, 0xAE,
+    0x18, 0x6C, 0xA2, 0x62, 0x1E, 0xF0, 0x5D, 0xE8, 0x41, 0x63, 0xC4, 0x15, 0xAF, 0x3F, 0x80, 0x95,
+    0x89, 0xEE, 0x9D, 0xAD, 0xE2, 0xD4, 0x70, 0xD2, 0xED, 0xE1, 0xBD, 0xEF, 0x19, 0xF8, 0x57, 0x9C,
+    0xDC, 0x42, 0xD2, 0xDA, 0xED, 0xF3, 0x30, 0x45, 0x14, 0xF7, 0xF6, 0xDE, 0x6B, 0x43, 0xAA, 0x56,
+    0x2C, 0xE7, 0xD6, 0x04, 0x68, 0xFA, 0xEB, 0xEC, 0x99, 0x77, 0x6F, 0x9C, 0x16, 0xA0, 0xC9, 0x52,
+    0x2C, 0x0E, 0x7D, 0x2A, 0xAA, 0x0B, 0x20, 0xD7, 0x2F, 0x89, 0xE0, 0x71, 0x5A, 0xA9, 0xCB, 0x29,
+    0xD1, 0x12, 0x97, 0x5C, 0x81, 0x34, 0x81, 0xB4, 0xA5, 0x25, 0x50, 0xB8, 0x83, 0xEC, 0x43, 0xBD,
+    0xC4, 0x6E, 0x18, 0x6E, 0xD7, 0x87, 0xF5, 0x99, 0x3F, 0x56, 0xF0, 0x33, 0xCF, 0xDB, 0x78, 0xE7,
+    0x0D, 0x1F, 0xF9, 0x7E, 0x1A, 0x6A, 0xA4, 0x99, 0x87, 0xA3, 0x18, 0xD8, 0x7F, 0xAC, 0xFA, 0x59,
+    0x0B, 0x4C, 0xD8, 0x0C, 0x56, 0xF3, 0x74, 0xE4, 0x66, 0xFA, 0xC4, 0x73, 0x3E, 0x66, 0x16, 0xCF,
+    0xBB, 0x07, 0x82, 0xE0, 0x0C, 0xF0, 0xEF, 0xE8, 0x49, 0x4A, 0xBD, 0xBE, 0xF3, 0xDB, 0xDC, 0xF3,
+    0xD7, 0x74, 0xDB, 0xD7, 0x43, 0x17, 0xB0, 0x03, 0x62, 0x37, 0xC8, 0x35, 0x06, 0x96, 0xA6, 0xF8,
+    0xCD, 0x64, 0x1C, 0x03, 0xDB, 0x72, 0xB3, 0x48, 0x3A, 0x33, 0x10, 0xA6, 0xBA, 0xD1, 0xB2, 0xE5,
+    0x93, 0xDD, 0x18, 0xD8, 0xDC, 0x7B, 0x0E, 0x8C, 0x62, 0x60, 0xC3, 0xBD, 0x18, 0x58, 0xCD, 0x2D,
+    0xD0, 0x5B, 0x86, 0x7A, 0x4A, 0x40, 0x45, 0x33, 0x67, 0x0C, 0x6C, 0xA5, 0x79, 0x41, 0xE0, 0x12,
+    0xC4, 0x4F, 0x1C, 0x12, 0xFD, 0xD3, 0x3F, 0x07, 0x57, 0x27, 0xAE, 0x29, 0x58, 0xEB, 0x66, 0xEC,
+    0x76, 0xB7, 0x8B, 0x34, 0x48, 0xFC, 0x9F, 0xD8, 0x31, 0xB7, 0x5A, 0xB7, 0x5C, 0x09, 0xBF, 0xAF,
+    0x5B, 0x37, 0xE2, 0xB9, 0xC2, 0x05, 0xF4, 0x43, 0x73, 0x44, 0x81, 0x40, 0x8E, 0x99, 0x5B, 0x88,
+    0x32, 0xD5, 0x3D, 0x16, 0x13, 0x75, 0xDF, 0xCE, 0xD8, 0x5C, 0x6E, 0x77, 0xDA, 0xED, 0x1E, 0xAB,
+    0x65, 0xFD, 0x3C, 0x25, 0x87, 0xA5, 0xD7, 0xF3, 0x5E, 0x7D, 0x0E, 0x3C, 0x15, 0xB0, 0x2B, 0x20,
+    0x84, 0x97, 0x07, 0x86, 0xB4, 0x8C, 0x88, 0xD5, 0xD4, 0xE0, 0xA7, 0x20, 0x0D, 0x81, 0x07, 0xC7,
+    0x8D, 0x4F, 0x84, 0xCE, 0x84, 0xC9, 0xD4, 0x5C, 0x05, 0x4C, 0x65, 0xF0, 0x84, 0x86, 0x6D, 0x6A,
+    0xAA, 0x73, 0xAA, 0x7C, 0xCE, 0x44, 0xCF, 0xDD, 0x74, 0xEE, 0xE4, 0x8D, 0x0B, 0x0F, 0x5B, 0xA9,
+    0xC3, 0xC6, 0x0C, 0x6D, 0x7A, 0xD0, 0x04, 0x7B, 0x5A, 0x87, 0x2D, 0xD0, 0x61, 0x5B, 0x3E, 0x6A,
+    0x87, 0x5F, 0x3A, 0x76, 0x6E, 0xA1, 0x15, 0x3A, 0x05, 0xFB, 0x73, 0x3A, 0xBC, 0x36, 0xD7, 0x10,
+    0x7D, 0x3E, 0x3B, 0x3C, 0x63, 0x87, 0xAF, 0xFF, 0x1F, 0xE5, 0x5C, 0x31, 0x77, 0xDC, 0xC6, 0x11,
+    0x1E, 0xE0, 0x4C, 0xE2, 0x85, 0x57, 0x40, 0x85, 0x58, 0xD8, 0x7A, 0x2F, 0x68, 0x52, 0xD8, 0x2C,
+    0x8C, 0x36, 0x45, 0x22, 0x20, 0x76, 0xE9, 0x86, 0x05, 0x99, 0x22, 0x29, 0xD4, 0xA8, 0x88, 0xEC,
+    0x82, 0xBF, 0xC0, 0xC6, 0xB9, 0x72, 0x2B, 0xD5, 0x2A, 0xAC, 0x42, 0x85, 0x74, 0x2E, 0xD4, 0xAA,
+    0x88, 0x84, 0x4B, 0x93, 0x22, 0x15, 0x9E, 0xF3, 0x5E, 0x9A, 0x34, 0x57, 0xC4, 0x2E, 0x9C, 0x42,
+    0x70, 0x1E, 0x6C, 0x81, 0x22, 0x80, 0xCD, 0x7C, 0x33, 0xBB, 0x00, 0x8E, 0xA4, 0xEC, 0x44, 0x89,
+    0x49, 0x1D, 0x79, 0xE2, 0xED, 0x92, 0x77, 0xC0, 0x62, 0x76, 0xBE, 0x99, 0xD9, 0x99, 0xD9, 0x59,
+    0x11, 0xC5, 0x66, 0x46, 0xFC, 0x4A, 0xCC, 0x02, 0x5D, 0x66, 0x0A, 0x74, 0xC6, 0x2C, 0xB5, 0x2B,
+    0xB9, 0xF5, 0xCC, 0xA3, 0x8A, 0xBB, 0x89, 0xB9, 0x51, 0x4B, 0x17, 0x36, 0xDC, 0x4D, 0x4D, 0xD8,
+    0x72, 0x17, 0x76, 0x53, 0x83, 0xAE, 0x0D, 0xD0, 0xC5, 0xCD, 0xC4, 0xA4, 0x3C, 0x56, 0xED, 0x63,
+    0xB4, 0xAC, 0xF2, 0xD0, 0xE5, 0x25, 0x61, 0x34, 0x1E, 0x8A, 0x7F, 0x3C, 0xC3, 0xAF, 0x8A, 0x7C,
+    0x74, 0x35, 0x8F, 0xC5, 0xAF, 0x86, 0x02, 0x74, 0x2D, 0x0F, 0xF9, 0xCD, 0x3C, 0xEF, 0x28, 0xE4,
+    0x91, 0xF8, 0x1D, 0x75, 0x78, 0x48, 0x9A, 0xF0, 0x53, 0x02, 0x33, 0x4B, 0x1A, 0x3C, 0x79, 0x91,
+    0x31, 0x05, 0xBE, 0x29, 0x78, 0x04, 0x1E, 0x09, 0xB4, 0xAD, 0xBC, 0xBC, 0xFB, 0xD2, 0x4D, 0x3B,
+    0xE9, 0x30, 0xCE, 0x89, 0xCE, 0xC7, 0x14, 0x68, 0x33, 0xBF, 0x2F, 0x94, 0xA4, 0x20, 0xA0, 0x00,
+    0x31, 0xA5, 0xD7, 0xFD, 0x96, 0x47, 0xBD, 0x4D, 0x78, 0x02, 0xE1, 0x69, 0x68, 0x36, 0xE6, 0xA6,
+    0xF1, 0x72, 0x26, 0x71, 0x0A, 0x3A, 0x63, 0xF3, 0x22, 0x6F, 0x98, 0x9E, 0xA4, 0xE1, 0x8B, 0xB8,
+    0xA9, 0xB4, 0xC9, 0x9A, 0xAC, 0xF1, 0x4C, 0x93, 0xE8, 0x25, 0xE6, 0x59, 0x13, 0x1A, 0xF3, 0x41,
+    0xE3, 0x9B, 0x36, 0x68, 0x68, 0x3B, 0xED, 0x89, 0x7B, 0x47, 0x38, 0xB9, 0x90, 0x69, 0xA0, 0x29,
+    0x30, 0x13, 0xF0, 0xFC, 0xE9, 0x68, 0x06, 0x98, 0xAD, 0x80, 0x31, 0xC6, 0x84, 0xB2, 0x42, 0x3F,
+    0xD5, 0xBF, 0x72, 0xE9, 0x02, 0x9D, 0x4F, 0x50, 0xE9, 0xB4, 0xEE, 0x8D, 0xF9, 0xB0, 0xF6, 0x90,
+    0x4E, 0x31, 0x81, 0x10, 0x7F, 0x85, 0xF8, 0x9C, 0x42, 0x50, 0x19, 0xE2, 0xB7, 0x18, 0x57, 0xC8,
+    0x84, 0x04, 0xE4, 0x07, 0x6E, 0xCA, 0x67, 0x8F, 0xE8, 0x87, 0xC2, 0x63, 0x02, 0xA5, 0x5B, 0x73,
+    0xBF, 0x13, 0xB6, 0x7F, 0x56, 0x09, 0xBF, 0xFF, 0x86, 0xAF, 0xCC, 0x01, 0x48, 0x9D, 0xE0, 0x1E,
+    0xA6, 0xBD, 0x54, 0x7A, 0x57, 0x5F, 0x6B, 0x8E, 0xD3, 0xC6, 0x2E, 0x29, 0x22, 0xDE, 0x7E, 0xCA,
+    0xB2, 0x19, 0x98, 0x65, 0x87, 0xDB, 0xBF, 0x63, 0x2D, 0x4C, 0x8E, 0x40, 0x68, 0xFE, 0x29, 0x8F,
+    0xE7, 0xB5, 0x22, 0xB8, 0xBB, 0xB4, 0x91, 0x8E, 0xC1, 0x52, 0xB4, 0x84, 0x8C, 0x42, 0x68, 0xE2,
+    0x61, 0x04, 0x30, 0x87, 0x98, 0x42, 0x26, 0x2D, 0x40, 0x23, 0x41, 0x8D, 0x04, 0x36, 0x12, 0xDC,
+    0x48, 0x80, 0x23, 0x41, 0x8E, 0x04, 0x3A, 0x12, 0xEC, 0x48, 0xC0, 0xA3, 0xC4, 0x5E, 0xC9, 0xF0,
+    0x91, 0xE0, 0x47, 0x0A, 0xA0, 0x22, 0xB8, 0xA3, 0xE8, 0xC5, 0x2A, 0x70, 0xD3, 0x6A, 0x6B, 0x0E,
+    0x6E, 0xB7, 0x8A, 0xC8, 0x3B, 0x0E, 0x8A, 0x31, 0x84, 0xD3, 0x8B, 0x06, 0xE1, 0xBE, 0xE0, 0x91,
+    0x09, 0xE1, 0xF1, 0x72, 0x7B, 0x0F, 0xC6, 0x24, 0x03, 0x1D, 0x0F, 0x0C, 0x26, 0xE5, 0x9B, 0x9C,
+    0x27, 0x33, 0xAD, 0x23, 0x9E, 0x44, 0x54, 0x4C, 0x00, 0x03, 0xD1, 0x5E, 0x3F, 0xF1, 0x8F, 0x5E,
+    0xF0, 0xED, 0x11, 0xA8, 0x01, 0xA7, 0x5B, 0x70, 0xC2, 0xF0, 0xCD, 0xD1, 0x57, 0x07, 0x3C, 0x87,
+    0x9F, 0xE1, 0xA1, 0x64, 0x4D, 0x9D, 0xB6, 0xBF, 0x7B, 0xC4, 0xED, 0x35, 0xBE, 0x66, 0x41, 0x39,
+    0x5A, 0x9E, 0xC3, 0x17, 0x66, 0xC1, 0x66, 0x90, 0xBF, 0xE5, 0x8B, 0xA5, 0x4D, 0xB5, 0x0D, 0xD0,
+    0x2E, 0x22, 0x7C, 0x6B, 0xAF, 0xEC, 0xF8, 0x2E, 0x7E, 0x14, 0x5B, 0xBE, 0xD8, 0x14, 0x4C, 0xB1,
+    0xE7, 0xE8, 0x08, 0x97, 0xDA, 0x89, 0xA8, 0xD0, 0x86, 0x05, 0xE8, 0x63, 0x12, 0x9D, 0x6C, 0x54,
+    0x27, 0x0B, 0x01, 0xE6, 0xCB, 0xD9, 0x85, 0x07, 0xB4, 0x5F, 0x01, 0x7D, 0x3C, 0x95, 0x15, 0x46,
+    0xA6, 0x10, 0x2E, 0xA0, 0x9F, 0x07, 0x29, 0xDF, 0x56, 0xB6, 0x18, 0xAA, 0xE6, 0xAB, 0xE3, 0xA3,
+    0xF6, 0xF5, 0xD6, 0x4F, 0x26, 0x22, 0xDD, 0xC4, 0x2F, 0xC9, 0x61, 0x28, 0xC8, 0x81, 0x18, 0xF2,
+    0xEA, 0x0C, 0x90, 0x79, 0xCB, 0xCD, 0x7F, 0x8C, 0x20, 0x53, 0x29, 0xE3, 0x47, 0x8B, 0x32, 0xC7,
+    0x62, 0x7A, 0x74, 0x6E, 0x58, 0xEE, 0xE3, 0xD9, 0xC5, 0xC2, 0x78, 0x97, 0xFF, 0x4D, 0x3B, 0xAF,
+    0x84, 0xF2, 0x2D, 0x29, 0xB9, 0xC1, 0xCF, 0xFB, 0x95, 0xD7, 0xFB, 0x10, 0x99, 0x5C, 0xC6, 0x77,
+    0x06, 0x1D, 0xC6, 0x2C, 0x59, 0x59, 0x92, 0x19, 0x4B, 0xFA, 0x55, 0xDC, 0xB8, 0xB2, 0x52, 0xD2,
+    0x4F, 0xB9, 0x52, 0x36, 0xFD, 0x4A, 0x29, 0x86, 0xB5, 0x67, 0x79, 0x2E, 0xBC, 0xB6, 0xDC, 0x0D,
+    0xBA, 0x29, 0xF8, 0x19, 0x31, 0xCF, 0xF8, 0x52, 0x16, 0xBF, 0xED, 0x8B, 0xE4, 0xC3, 0xBC, 0x82,
+    0x5B, 0xEA, 0xCF, 0x6F, 0x63, 0x54, 0x71, 0x7B, 0x1A, 0x2C, 0xA2, 0x7C, 0x87, 0xF9, 0x13, 0x1B,
+    0xC7, 0x8E, 0x92, 0xA5, 0x37, 0x68, 0xE8, 0x79, 0xB8, 0xAF, 0xB7, 0xC4, 0xAE, 0xCC, 0x7A, 0xF7,
+    0x75, 0xB1, 0xEA, 0xBE, 0xC6, 0xD6, 0x45, 0x55, 0x65, 0xCB, 0x65, 0x36, 0x77, 0xEA, 0x1D, 0xA0,
+    0x5C, 0xEE, 0x26, 0xC0, 0xA7, 0xF6, 0x5A, 0x01, 0xCD, 0x34, 0x0A, 0x68, 0xD9, 0x3B, 0x7A, 0x17,
+    0x4A, 0x3D, 0x37, 0x1F, 0xA8, 0xBB, 0xC7, 0x72, 0xCD, 0x4F, 0xDA, 0x4B, 0x18, 0xB3, 0xE6, 0x6D,
+    0xB6, 0xC1, 0x1D, 0xC5, 0x0B, 0x9E, 0x0B, 0x13, 0x13, 0x99, 0x0E, 0x03, 0x60, 0x02, 0x6F, 0x9C,
+    0x93, 0xFB, 0x6A, 0x23, 0x89, 0x48, 0x57, 0xCF, 0x40, 0xA0, 0xD8, 0xBC, 0xD3, 0x28, 0x5C, 0x57,
+    0xAF, 0x9F, 0x84, 0x2B, 0xBF, 0xA0, 0x70, 0x6D, 0x21, 0x6E, 0x0A, 0x6A, 0xF1, 0xFD, 0xB8, 0xD9,
+    0xCB, 0x00, 0xD7, 0xD6, 0xEB, 0x06, 0x97, 0x7D, 0x09, 0x9D, 0x30, 0x9B, 0x36, 0x56, 0xD4, 0xEE,
+    0x13, 0x21, 0xE8, 0xD3, 0x0A, 0xF1, 0xE5, 0x74, 0x79, 0xFB, 0x13, 0x01, 0x4F, 0x7C, 0x1F, 0x1F,
+    0x1C, 0x1A, 0xC0, 0x8B, 0x4C, 0x7A, 0xC1, 0x74, 0x4D, 0x18, 0x21, 0x94, 0x4F, 0x5D, 0xB3, 0xCB,
+    0x0A, 0xE7, 0xD5, 0xBF, 0x64, 0x04, 0x5B, 0x18, 0xA3, 0x1C, 0x3E, 0x69, 0x6C, 0xDA, 0xF3, 0x46,
+    0x70, 0x33, 0xF5, 0x67, 0x12, 0xDE, 0x0B, 0xA1, 0xB9, 0x38, 0x33, 0x54, 0x1F, 0x80, 0x6B, 0x5E,
+    0xE9, 0x8B, 0x33, 0xA3, 0xE6, 0xDD, 0xAB, 0x29, 0x9A, 0x49, 0x74, 0x9B, 0xA5, 0x7A, 0xA5, 0xA2,
+    0x24, 0x5A, 0xB8, 0xA9, 0xB8, 0x5C, 0x38, 0x67, 0xE6, 0x37, 0xE2, 0xCC, 0x94, 0x70, 0x66, 0x0A,
+    0xFA, 0xB5, 0x97, 0x5B, 0x39, 0xBD, 0x4E, 0x93, 0x12, 0xDE, 0xCB, 0x12, 0xDF, 0x2E, 0xE0, 0x5A,
+    0xCE, 0xF8, 0x2E, 0x31, 0x4B, 0xC7, 0x61, 0x3C, 0x1B, 0x67, 0x66, 0x5A, 0x88, 0x37, 0xC9, 0xF6,
+    0x12, 0xE0, 0x4C, 0x38, 0x80, 0x51, 0x2D, 0x6B, 0x55, 0xCB, 0x6A, 0xD5, 0xB2, 0xDB, 0x42, 0xD9,
+    0x15, 0xBA, 0xDC, 0xCE, 0x0C, 0x0B, 0x32, 0xF3, 0xA9, 0x45, 0x84, 0x66, 0xBE, 0xE1, 0x09, 0x67,
+    0x40, 0x2F, 0x82, 0x38, 0xFB, 0xE7, 0x6F, 0x4B, 0x4F, 0x71, 0x66, 0x26, 0x02, 0xD1, 0x53, 0xA0,
+    0x63, 0x3A, 0x44, 0xA8, 0xA3, 0x77, 0xC7, 0xEC, 0xA5, 0x13, 0xEF, 0x4A, 0xD4, 0xB3, 0x59, 0x79,
+    0x7F, 0xB7, 0xBF, 0x77, 0xEA, 0xB5, 0x78, 0xBF, 0x98, 0xCF, 0x8F, 0x8D, 0x6B, 0x7A, 0x82, 0x10,
+    0xEA, 0x64, 0x6E, 0xD0, 0x4A, 0x7F, 0x8F, 0x6E, 0x23, 0x86, 0xBB, 0x0D, 0xE9, 0xE9, 0x24, 0x00,
+    0x92, 0x78, 0xB8, 0x0C, 0xCD, 0x9D, 0xBC, 0x66, 0xE0, 0xA2, 0x26, 0xE6, 0xC0, 0xA9, 0x65, 0xCE,
+    0x4C, 0xBB, 0xA4, 0x9B, 0x3F, 0xEA, 0x30, 0xE9, 0x71, 0x23, 0xCC, 0xEB, 0x39, 0x08, 0xA8, 0x19,
+    0xA0, 0x99, 0xF7, 0x18, 0x92, 0x50, 0xFB, 0x22, 0x1B, 0x19, 0xE4, 0x84, 0xF9, 0xC9, 0x0F, 0xD9,
+    0xDE, 0x75, 0xB4, 0xBC, 0x25, 0x86, 0x07, 0xB2, 0x29, 0xE8, 0x0F, 0x8D, 0x8D, 0xA4, 0x3C, 0x96,
+    0x34, 0x84, 0x18, 0x1E, 0xC8, 0xF2, 0x11, 0x41, 0x1A, 0x5D, 0x94, 0xF0, 0x30, 0x5E, 0x35, 0x75,
+    0x80, 0xF3, 0x60, 0xE4, 0x04, 0x3A, 0x30, 0x81, 0x1E, 0x4E, 0xC4, 0x60, 0x06, 0xAD, 0x44, 0xFB,
+    0x10, 0x57, 0xFC, 0x09, 0xA6, 0xAA, 0x87, 0xBA, 0xD3, 0x4B, 0xF3, 0x99, 0xF2, 0xF7, 0x0A, 0x6D,
+    0xB3, 0xEE, 0x5E, 0x0F, 0xCD, 0x61, 0xC7, 0xC2, 0xD9, 0x24, 0x77, 0x4D, 0x7D, 0x9D, 0xF2, 0xE2,
+    0xAA, 0x55, 0x86, 0x33, 0x65, 0x98, 0x97, 0x72, 0x40, 0x11, 0xD7, 0x6C, 0x61, 0x8D, 0xF9, 0x7C,
+    0x09, 0x72, 0x8B, 0xC9, 0x61, 0xCE, 0xB1, 0x46, 0xC9, 0xAA, 0xED, 0x0D, 0xAA, 0x72, 0xD6, 0x12,
+    0xA8, 0xFE, 0x73, 0x4D, 0xF3, 0x7B, 0x31, 0x53, 0x55, 0x67, 0x69, 0x60, 0xDA, 0x3F, 0x50, 0xF8,
+    0x3D, 0x43, 0x9C, 0x20, 0xF5, 0x93, 0xBB, 0x9C, 0x0F, 0xF5, 0x3C, 0x93, 0x84, 0xD2, 0x6A, 0xD3,
+    0xC9, 0xC4, 0x4F, 0x6F, 0x2A, 0x5D, 0x57, 0x9B, 0x13, 0x0D, 0xB3, 0xF0, 0x07, 0x6E, 0x93, 0x86,
+    0x39, 0x79, 0xCA, 0xD3, 0x54, 0xFC, 0x36, 0x24, 0x29, 0x15, 0xF1, 0xF0, 0xFB, 0x69, 0x52, 0xB0,
+    0x08, 0x96, 0xB9, 0xA4, 0x5B, 0x78, 0x42, 0xF1, 0xF3, 0x56, 0x52, 0x6D, 0x30, 0xDC, 0xE2, 0x59,
+    0xF2, 0xB2, 0x37, 0xF0, 0x58, 0x58, 0xAC, 0x3C, 0x16, 0x26, 0x8B, 0xC9, 0x2E, 0x49, 0xD8, 0x4C,
+    0xC2, 0x67, 0x12, 0x46, 0x93, 0x70, 0x9A, 0x84, 0xD5, 0x92, 0x3E, 0x39, 0xD6, 0x6A, 0x56, 0x66,
+    0x94, 0x9B, 0x11, 0x8E, 0x2B, 0xCB, 0xC5, 0xFE, 0xD7, 0xA4, 0x4C, 0x57, 0xAE, 0x5B, 0xB6, 0x0B,
+    0xDF, 0x35, 0x99, 0x9D, 0x08, 0x67, 0xC3, 0x72, 0xEB, 0x21, 0x2B, 0x36, 0x1B, 0x51, 0xA6, 0xF0,
+    0x56, 0x0E, 0xE3, 0xE8, 0x49, 0xE2, 0x6C, 0xD2, 0x4C, 0x6B, 0xA4, 0xDC, 0xBC, 0x76, 0x75, 0x49,
+    0xC0, 0xD0, 0x4B, 0xC9, 0xFC, 0x94, 0x27, 0x5A, 0x7C, 0xAE, 0x91, 0xC3, 0xCB, 0x5A, 0x59, 0x58,
+    0x8D, 0x5D, 0xE0, 0x4F, 0xB4, 0xFB, 0xFB, 0xE9, 0x8F, 0x8E, 0xA0, 0xED, 0x7C, 0x7E, 0xEF, 0x25,
+    0x34, 0xAC, 0x64, 0x3A, 0xA3, 0x12, 0x38, 0x4D, 0xEA, 0x64, 0x9C, 0xE9, 0xCC, 0x78, 0xE2, 0x41,
+    0x83, 0x0D, 0x86, 0x70, 0xE9, 0x6B, 0xA6, 0xF3, 0x6A, 0x3F, 0xBD, 0x6B, 0x87, 0xBA, 0xCA, 0x2F,
+    0xC1, 0x4A, 0x89, 0xCB, 0x05, 0x71, 0x73, 0x78, 0x8D, 0x19, 0x6B, 0x96, 0x1E, 0x32, 0x94, 0x0B,
+    0x92, 0x44, 0x26, 0x9B, 0xCD, 0x09, 0x2F, 0xB0, 0x66, 0x29, 0x8B, 0xEE, 0xB1, 0x56, 0x13, 0xA2,
+    0x43, 0x5A, 0xD4, 0xB3, 0xEB, 0x7F, 0x4D, 0xD7, 0x66, 0x40, 0x84, 0xBF, 0x8A, 0xA5, 0x0D, 0x34,
+    0xD9, 0x95, 0x1B, 0x3C, 0xD8, 0xDB, 0x17, 0x22, 0x9E, 0xF6, 0xAE, 0xEE, 0x0D, 0xDC, 0x15, 0x14,
+    0x50, 0x10, 0x7E, 0x70, 0xFD, 0x31, 0x5F, 0xDE, 0xBE, 0xBD, 0x16, 0x0A, 0xF2, 0x40, 0x57, 0x0F,
+    0x70, 0xC0, 0x7B, 0xA4, 0x29, 0xBB, 0x05, 0x94, 0xE5, 0x60, 0x06, 0x65, 0x69, 0x01, 0x62, 0xFD,
+    0x78, 0x0D, 0x94, 0x85, 0x6E, 0xD2, 0x2F, 0x26, 0xA6, 0xA8, 0x59, 0x1A, 0xAA, 0xF0, 0x33, 0x53,
+    0xFE, 0x9C, 0xDE, 0x55, 0xF2, 0x30, 0x50, 0x6E, 0x90, 0x39, 0x5F, 0x20, 0x6F, 0x1E, 0x2D, 0xFC,
+    0x66, 0x0C, 0xC3, 0xD9, 0x2D, 0x86, 0x70, 0xAB, 0x03, 0x93, 0x56, 0x3C, 0x9D, 0xA3, 0x92, 0xE2,
+    0xDF, 0xC3, 0xAD, 0x26, 0xE7, 0x56, 0xEB, 0xAC, 0xE1, 0xB4, 0x4E, 0x3A, 0xE6, 0x71, 0x58, 0xB1,
+    0xB1, 0x3A, 0x96, 0x23, 0xFC, 0x01, 0xA3, 0x1F, 0xFF, 0xFF, 0x8D, 0xFE, 0x0E, 0x0B, 0x06, 0x3F,
+    0x8B, 0xBF, 0x4B, 0x83, 0xCE, 0x14, 0x51, 0x15, 0x57, 0x59, 0x11, 0x34, 0xDB, 0x76, 0xBB, 0xE1,
+    0xB5, 0x72, 0xC8, 0x86, 0x14, 0x5D, 0xF4, 0x83, 0x29, 0xBA, 0xD7, 0xCE, 0x71, 0xDB, 0xD5, 0x04,
+    0x40, 0xC4, 0xA2, 0x10, 0x09, 0xF9, 0xF6, 0xCD, 0xA6, 0x0F, 0x9E, 0xB0, 0x87, 0x47, 0xA9, 0x6B,
+    0x2F, 0xE1, 0xA9, 0xB1, 0x6F, 0x04, 0xA0, 0x53, 0x09, 0x26, 0x16, 0xFF, 0xF3, 0x3B, 0x60, 0x83,
+    0x97, 0x31, 0x4B, 0xCC, 0x68, 0x7C, 0x90, 0x58, 0x91, 0x7C, 0x48, 0x48, 0x03, 0x9B, 0x94, 0x3D,
+    0x4A, 0xD6, 0xE1, 0xB0, 0xA0, 0x2D, 0x59, 0x93, 0x78, 0x7A, 0x49, 0xF5, 0xEA, 0x3F, 0x67, 0x3C,
+    0x17, 0x7D, 0xDD, 0xD4, 0xED, 0x79, 0xAC, 0x6D, 0x78, 0xE3, 0x77, 0xFF, 0x10, 0x32, 0x95, 0x94,
+    0x59, 0x9D, 0xD5, 0x49, 0xA5, 0x89, 0xB7, 0xED, 0xDD, 0xA4, 0xFA, 0xCF, 0xFE, 0xA9, 0x44, 0x26,
+    0x95, 0xDE, 0x7D, 0xAD, 0x18, 0x8C, 0xA1, 0xAC, 0x21, 0x91, 0x4A, 0x6E, 0xDE, 0xEF, 0xD5, 0x88,
+    0x70, 0x74, 0x5F, 0x18, 0xEC, 0xAC, 0x14, 0x30, 0x49, 0xB1, 0x11, 0xF8, 0x13, 0x31, 0xB2, 0xB3,
+    0x0C, 0xFB, 0x03, 0x66, 0x91, 0x8B, 0xA3, 0xBC, 0x80, 0x78, 0x23, 0xDE, 0x2B, 0x47, 0xDD, 0x12,
+    0x9D, 0xA7, 0x9D, 0xEF, 0xBA, 0xC2, 0x5E, 0x69, 0xEF, 0xCB, 0x34, 0x5C, 0xB4, 0x63, 0xDA, 0x27,
+    0x84, 0x06, 0x69, 0x33, 0x3C, 0xFD, 0x23, 0xB6, 0x30, 0x13, 0x0D, 0x41, 0x49, 0x56, 0x40, 0xDD,
+    0x22, 0x4C, 0x65, 0x2D, 0x95, 0x8C, 0x87, 0xB7, 0xB7, 0x12, 0x58, 0x6A, 0xDC, 0x1C, 0xB6, 0xE3,
+    0x50, 0x32, 0xB2, 0x81, 0x65, 0x37, 0xCA, 0x92, 0x7B, 0xF9, 0x3D, 0x59, 0x01, 0x8C, 0xAE, 0x00,
+    0x85, 0x3C, 0x05, 0xA6, 0xEE, 0x6B, 0x9E, 0x2F, 0xDF, 0x10, 0xB3, 0x91, 0x6A, 0x31, 0x00, 0x34,
+    0x8C, 0xE7, 0x5C, 0xC3, 0x14, 0x26, 0x08, 0x84, 0x67, 0xA7, 0xB4, 0x88, 0x8C, 0xD3, 0x18, 0x57,
+    0x42, 0xD3, 0xF8, 0x2E, 0x56, 0xB5, 0xAC, 0x95, 0x15, 0xA0, 0x91, 0xB8, 0xB4, 0x14, 0x0B, 0xB4,
+    0xC0, 0x24, 0x85, 0xB4, 0xF1, 0x26, 0xC5, 0x9B, 0xD4, 0x2F, 0xCB, 0xBA, 0x9A, 0xBB, 0x35, 0x5D,
+    0x10, 0x92, 0x0C, 0x0E, 0x79, 0xBB, 0xB6, 0xA4, 0x83, 0x46, 0x29, 0x80, 0xC4, 0xD8, 0x7C, 0xB9,
+    0x2E, 0xD5, 0x49, 0x41, 0xC3, 0x86, 0xDD, 0x44, 0xAF, 0x9C, 0x68, 0xB6, 0xCF, 0x1B, 0x57, 0x76,
+    0x5C, 0x1C, 0xBC, 0x25, 0x54, 0xD3, 0x58, 0xCD, 0x06, 0x6B, 0x1A, 0xAD, 0x69, 0xB8, 0xA6, 0xF1,
+    0x9A, 0x06, 0x6C, 0x76, 0x4F, 0x61, 0x67, 0xCC, 0x85, 0xD7, 0x43, 0x00, 0x5C, 0x05, 0x08, 0x76,
+    0xB9, 0x1E, 0x0A, 0xDD, 0x89, 0xF9, 0x40, 0xBC, 0x20, 0xF3, 0x17, 0x99, 0xB6, 0xEC, 0x36, 0x07,
+    0xE2, 0x35, 0x9F, 0xE2, 0x36, 0x5F, 0x1C, 0x3C, 0x35, 0xF2, 0x09, 0xC7, 0x91, 0x0F, 0x2C, 0x5F,
+    0xC3, 0xEB, 0x7A, 0xF4, 0xBC, 0x93, 0xFD, 0x86, 0xC1, 0x99, 0xDB, 0x5B, 0x71, 0xE6, 0xCE, 0x1D,
+    0x49, 0x0B, 0xA2, 0x55, 0xC4, 0xB0, 0x42, 0xEC, 0xE3, 0x82, 0x1F, 0x1B, 0xFD, 0xD8, 0xF0, 0xC7,
+    0xC6, 0x3F, 0x17, 0x16, 0x49, 0x8D, 0x92, 0xD4, 0x14, 0x85, 0x2B, 0x51, 0x92, 0x8D, 0x01, 0x11,
+    0x25, 0x4D, 0x5C, 0x94, 0xD4, 0xCA, 0x8E, 0xED, 0x28, 0x4A, 0x7A, 0xA1, 0x51, 0x92, 0x6C, 0x5E,
+    0x82, 0xBD, 0x89, 0x3C, 0xC2, 0x74, 0x07, 0x66, 0xE1, 0x99, 0x92, 0x49, 0x67, 0x7A, 0xD9, 0x1D,
+    0x91, 0x28, 0xA9, 0x42, 0x1C, 0x94, 0x49, 0x9B, 0xD4, 0xA7, 0xB5, 0x4C, 0x7A, 0x85, 0x65, 0x36,
+    0x2F, 0x61, 0x51, 0x91, 0xD6, 0xAC, 0x03, 0x4D, 0x22, 0xF2, 0x87, 0xCA, 0xE4, 0x40, 0xB7, 0xA6,
+    0xEC, 0x8E, 0xB2, 0x75, 0x82, 0x42, 0x35, 0xAB, 0x91, 0xAD, 0x07, 0xB1, 0xEE, 0xF7, 0x1F, 0x45,
+    0x43, 0x37, 0x6B, 0xD5, 0xD0, 0x42, 0xEE, 0xFA, 0x73, 0xDA, 0xE3, 0x7A, 0x09, 0x34, 0xF4, 0xE1,
+    0x8F, 0x87, 0x5E, 0xCD, 0xE3, 0x35, 0xD0, 0xD6, 0xBE, 0x2C, 0x24, 0xAB, 0xC3, 0x54, 0xC9, 0x00,
+    0x61, 0x55, 0x86, 0x2B, 0xFC, 0x53, 0xCB, 0x42, 0x42, 0x5D, 0x92, 0x93, 0x67, 0xB2, 0x9E, 0x9A,
+    0xF7, 0x3A, 0x75, 0x24, 0x92, 0xD9, 0x85, 0x84, 0x1A, 0x91, 0x9F, 0x86, 0x7E, 0x1A, 0xFB, 0x51,
+    0x74, 0x17, 0x17, 0xBF, 0x3B, 0x44, 0x7F, 0x2E, 0xEA, 0x95, 0x08, 0xDA, 0x97, 0x31, 0xA6, 0x35,
+    0xB4, 0x3E, 0x5E, 0xA0, 0x98, 0x74, 0x08, 0x02, 0xCF, 0x14, 0x70, 0xFF, 0xA5, 0x80, 0xDB, 0x02,
+    0x92, 0x64, 0xB5, 0x80, 0x24, 0x3F, 0x56, 0x40, 0x42, 0xC7, 0x0B, 0x48, 0x2E, 0xA5, 0x6B, 0x4C,
+    0xF3, 0x7B, 0x22, 0xF8, 0x15, 0x39, 0x26, 0xC6, 0x47, 0x32, 0xFD, 0x82, 0x9F, 0xCD, 0x4C, 0x42,
+    0xB9, 0xE3, 0x5E, 0x6F, 0x2C, 0xD7, 0xCE, 0x95, 0x76, 0xB2, 0xE0, 0xCA, 0xA4, 0x35, 0x55, 0x65,
+    0xCB, 0xAA, 0x07, 0xCF, 0x59, 0xCB, 0x85, 0x55, 0x22, 0xE8, 0x43, 0xE5, 0x9D, 0xEC, 0x8B, 0x41,
+    0x24, 0xCC, 0x52, 0x65, 0x42, 0xC0, 0x37, 0xE6, 0x4B, 0xA9, 0x2F, 0x34, 0xE6, 0xC8, 0xA4, 0x22,
+    0x16, 0xA6, 0xB3, 0x72, 0x51, 0x5B, 0xC1, 0x28, 0xC8, 0xA2, 0x48, 0x56, 0x34, 0xC8, 0x62, 0x4C,
+    0x16, 0x72, 0xB2, 0x12, 0x40, 0x56, 0x2E, 0x4E, 0xED, 0xF1, 0xBD, 0xBB, 0xDE, 0xDD, 0x6F, 0x85,
+    0xA4, 0x1F, 0xDF, 0x8A, 0x09, 0x59, 0x39, 0x71, 0x82, 0xD2, 0x4B, 0x8A, 0x13, 0x15, 0x27, 0x2B,
+    0xBD, 0xB0, 0x0C, 0xD2, 0x22, 0xF0, 0x6B, 0x6D, 0xB9, 0x4B, 0xAD, 0xBA, 0xB5, 0x30, 0x53, 0x07,
+    0x87, 0x3F, 0x43, 0x06, 0x83, 0x6F, 0xB0, 0x7B, 0xC9, 0x7C, 0xAD, 0x97, 0xDF, 0x07, 0x07, 0x79,
+    0xD8, 0xF7, 0x99, 0x0C, 0x1E, 0xFC, 0x99, 0xEE, 0xA7, 0x1A, 0x40, 0x7F, 0x04, 0x81, 0x60, 0xB2,
+    0x62, 0xBE, 0x53, 0x65, 0xC1, 0x0A, 0x03, 0xA9, 0x34, 0x90, 0x82, 0x7F, 0xB2, 0x43, 0x05, 0xA8,
+    0x8A, 0x04, 0xA9, 0x4C, 0x48, 0x76, 0x4E, 0xF6, 0x1D, 0x8B, 0xBC, 0x25, 0x2B, 0x16, 0x4E, 0xF1,
+    0xAD, 0x60, 0x38, 0xC9, 0xE8, 0x8B, 0xC7, 0x66, 0x34, 0x9A, 0x91, 0x4D, 0x32, 0xCA, 0x26, 0xA8,
+    0x4B, 0x3D, 0xDB, 0x99, 0xBB, 0xC2, 0x94, 0xED, 0x4B, 0x85, 0xF8, 0xFC, 0xFE, 0x58, 0x1D, 0xDC,
+    0xF6, 0xAB, 0x3B, 0x35, 0xE0, 0x5C, 0x5A, 0x41, 0x9C, 0x95, 0x7E, 0x1D, 0x10, 0x3F, 0x7E, 0x12,
+    0xC2, 0xD9, 0xFD, 0xFE, 0x2C, 0x84, 0x4D, 0xE3, 0xF7, 0x35, 0x4C, 0xF6, 0x38, 0x44, 0x2F, 0x09,
+    0xF6, 0x40, 0x84, 0x9C, 0x88, 0xB8, 0x54, 0xBA, 0x3F, 0x56, 0x14, 0x2D, 0x76, 0xE1, 0x4E, 0xD5,
+    0x44, 0xA3, 0x69, 0x0A, 0xB4, 0x8B, 0xD4, 0x3A, 0xE6, 0x2A, 0x0D, 0x19, 0x89, 0x78, 0xEC, 0xAC,
+    0x87, 0x41, 0xA0, 0x37, 0x34, 0xC3, 0xEA, 0x99, 0x42, 0xCA, 0x64, 0x02, 0xD3, 0x89, 0x63, 0x13,
+    0xDA, 0xDC, 0x6D, 0xF8, 0xB5, 0x5E, 0x1E, 0xCD, 0x62, 0xE1, 0xC0, 0x06, 0x4A, 0x45, 0x2E, 0x91,
+    0x18, 0xB0, 0xB3, 0x8E, 0xC5, 0x3D, 0x6A, 0x7D, 0x3D, 0x89, 0xF2, 0xF7, 0x52, 0x6F, 0x02, 0x1D,
+    0x6D, 0x26, 0x45, 0x9B, 0x1C, 0x57, 0x01, 0xF1, 0x5D, 0xBA, 0xB2, 0x3E, 0x06, 0xE1, 0xF2, 0x29,
+    0xF2, 0x90, 0xF8, 0xB3, 0x5E, 0x9F, 0xB3, 0xEE, 0x43, 0x6F, 0xCB, 0x00, 0xAD, 0xE7, 0x27, 0xCB,
+    0x81, 0xB2, 0x69, 0x9D, 0xEC, 0xFC, 0x9B, 0x44, 0x83, 0x97, 0x67, 0x5D, 0x3E, 0x57, 0x75, 0x64,
+    0xE7, 0x21, 0x65, 0x27, 0xB0, 0x56, 0x59, 0x69, 0x64, 0xEB, 0xE6, 0x6C, 0x5A, 0xB8, 0x1A, 0xA6,
+    0xCC, 0x6A, 0x90, 0x93, 0xC0, 0x5F, 0x2F, 0x62, 0xF3, 0xD5, 0x81, 0x59, 0xC0, 0xD4, 0x68, 0xB1,
+    0x52, 0x2B, 0x68, 0xB2, 0x40, 0x5C, 0x53, 0x28, 0xC7, 0x33, 0xBB, 0x45, 0xAE, 0xC4, 0x68, 0x7C,
+    0x08, 0xC6, 0xAD, 0xCD, 0x4F, 0x75, 0x63, 0x63, 0x63, 0x3F, 0x63, 0x67, 0xBB, 0x7B, 0xF5, 0x26,
+    0xEA, 0x98, 0xBE, 0xB8, 0xC3, 0x99, 0x8A, 0x2E, 0x31, 0xEF, 0x19, 0x94, 0x95, 0x98, 0x8E, 0x29,
+    0x3C, 0xEA, 0x18, 0x84, 0xBF, 0x76, 0x1C, 0xE4, 0x4D, 0x3A, 0x7B, 0x4E, 0xCB, 0xED, 0x4C, 0x90,
+    0x94, 0x8F, 0x09, 0x39, 0xC1, 0x4A, 0xE1, 0x93, 0xDD, 0xF3, 0x9E, 0x0A, 0x16, 0x7A, 0x98, 0x62,
+    0xAA, 0x35, 0x6D, 0xBA, 0x7E, 0x48, 0x92, 0x84, 0xD4, 0xAE, 0x2A, 0x5E, 0x4F, 0x87, 0xA9, 0xF6,
+    0x4B, 0xCA, 0xFA, 0x80, 0x24, 0xC5, 0xCC, 0x32, 0x4F, 0x9D, 0xA6, 0x44, 0x0D, 0x32, 0x49, 0xD4,
+    0x70, 0x8C, 0x0E, 0x19, 0xBA, 0x09, 0x9E, 0x39, 0x62, 0xD6, 0xBD, 0xF3, 0xAD, 0x22, 0x04, 0x76,
+    0x8B, 0x29, 0x72, 0xAE, 0x51, 0xB9, 0xEA, 0xFB, 0xC2, 0x80, 0xEC, 0xDC, 0x73, 0xE7, 0x40, 0x14,
+    0x8C, 0xAC, 0x67, 0x94, 0xF4, 0xDF, 0x6A, 0x14, 0x9B, 0x1F, 0x99, 0x85, 0xF4, 0xB0, 0xA1, 0xA5,
+    0xD6, 0x2E, 0x6A, 0x3F, 0xD3, 0xBE, 0xA4, 0x9F, 0xAC, 0x77, 0xBF, 0x2B, 0x68, 0xE2, 0xE8, 0x89,
+    0xD7, 0xA2, 0xC0, 0xE9, 0x52, 0xAE, 0x12, 0x6A, 0x0B, 0x2B, 0x15, 0xBE, 0x1E, 0xC0, 0x01, 0x42,
+    0x5F, 0xED, 0x9D, 0x2D, 0x4A, 0xD7, 0xFD, 0x7B, 0xD2, 0xCD, 0x32, 0x0D, 0x24, 0x89, 0x59, 0x49,
+    0x5B, 0x0F, 0xC5, 0xB4, 0x5A, 0x73, 0x19, 0xB5, 0x82, 0x62, 0xD4, 0x08, 0x20, 0x49, 0x2D, 0x5D,
+    0x5E, 0xA2, 0xE3, 0xF8, 0x57, 0xBB, 0x54, 0xBA, 0x9A, 0xE4, 0x3B, 0xFA, 0xEF, 0x3A, 0x50, 0x21,
+    0x08, 0x93, 0x9C, 0x74, 0x42, 0x55, 0x1C, 0x50, 0x56, 0x7B, 0x2F, 0xC7, 0x23, 0xCD, 0x91, 0xD4,
+    0x93, 0x03, 0x6B, 0x52, 0xB4, 0xC9, 0xED, 0x1A, 0x5B, 0xBC, 0x6D, 0x41, 0xC2, 0x60, 0xEA, 0xFD,
+    0xDE, 0xF7, 0xB5, 0x95, 0x1D, 0x91, 0x75, 0x72, 0x11, 0xC9, 0x5F, 0x1E, 0xC4, 0x3D, 0x0D, 0x6F,
+    0x65, 0xED, 0x85, 0x25, 0x6A, 0x57, 0x1C, 0x7F, 0xCB, 0xA3, 0xB8, 0x04, 0xE2, 0xE0, 0xCC, 0x3A,
+    0x20, 0xEE, 0x12, 0xE8, 0x81, 0x0D, 0x70, 0xAD, 0xE3, 0xDE, 0x7B, 0xEE, 0xCE, 0x75, 0xEF, 0xFB,
+    0xB8, 0x1A, 0x2F, 0x98, 0xF6, 0xA4, 0x8D, 0x3D, 0x5D, 0x7E, 0x99, 0x74, 0xDF, 0xB1, 0x6D, 0x36,
+    0x3A, 0xF9, 0x67, 0x57, 0x2B, 0x77, 0x1A, 0xD4, 0xB2, 0xCC, 0xEA, 0x8A, 0xB5, 0xA1, 0xB9, 0x18,
+    0x04, 0x98, 0xF4, 0xB5, 0x10, 0x8F, 0x54, 0x4B, 0x60, 0xA2, 0xD6, 0xD3, 0x4A, 0x25, 0xF3, 0xCF,
+    0x8A, 0x7A, 0x8F, 0x9E, 0x97, 0xA7, 0x03, 0x4D, 0x87, 0xD6, 0x7A, 0xE2, 0x53, 0x9C, 0xFA, 0xCB,
+    0x24, 0x06, 0x52, 0xC4, 0x0A, 0x9B, 0x3F, 0xD1, 0x38, 0xE7, 0xF3, 0xA5, 0xBA, 0x9D, 0x70, 0x6B,
+    0x50, 0xCC, 0xCA, 0x5D, 0x39, 0x6D, 0x19, 0x71, 0xD9, 0xC4, 0x58, 0x0B, 0xC4, 0xE9, 0x52, 0x2A,
+    0x72, 0xEF, 0x64, 0xF9, 0x66, 0x36, 0xDE, 0xBC, 0xE9, 0xFB, 0x7E, 0x09, 0x1C, 0xFD, 0x6F, 0x19,
+    0xB2, 0x55, 0xBB, 0x46, 0xB0, 0x5A, 0xFF, 0xDB, 0x7A, 0xE0, 0xBD, 0xF5, 0xB2, 0x9D, 0xFD, 0xD0,
+    0x7B, 0x62, 0x33, 0xDD, 0xE9, 0x30, 0x7B, 0x7B, 0xB0, 0xB9, 0x1E, 0x0E, 0x5E, 0x78, 0x7A, 0x71,
+    0x9F, 0x40, 0x47, 0x58, 0x1A, 0x37, 0x08, 0x46, 0x33, 0x9C, 0x8A, 0xE0, 0x3B, 0x22, 0xD4, 0x53,
+    0x2D, 0xA7, 0x72, 0xA6, 0x5E, 0x8F, 0xD8, 0x73, 0xD8, 0x0A, 0x87, 0x82, 0xBF, 0xEA, 0x70, 0x03,
+    0x9C, 0x0C, 0x39, 0x33, 0xC1, 0x0B, 0xA9, 0xDD, 0xB5, 0x2D, 0x84, 0x7C, 0x89, 0x09, 0xE4, 0xB4,
+    0xB5, 0xE6, 0x54, 0xEC, 0x81, 0xCD, 0x71, 0xC1, 0xE4, 0xAB, 0xB4, 0x3B, 0x0F, 0x07, 0x97, 0xC6,
+    0xCE, 0x4B, 0x53, 0x50, 0x3A, 0x2F, 0xAD, 0xFE, 0x18, 0xFE, 0x83, 0x81, 0xFD, 0x5D, 0xEC, 0x4F,
+    0xF2, 0xBC, 0xB0, 0x8F, 0x32, 0xDA, 0x5F, 0x88, 0x70, 0x86, 0x05, 0x98, 0xF0, 0xCF, 0x54, 0x4A,
+    0xC5, 0x26, 0xB2, 0xE9, 0x80, 0x0B, 0x2A, 0xEC, 0x04, 0xA0, 0x68, 0x84, 0xE3, 0xD0, 0x25, 0x86,
+    0xC7, 0x8C, 0x92, 0x6F, 0xF1, 0xB0, 0xE4, 0x5F, 0xE0, 0x72, 0xF4, 0xDC, 0x68, 0xB2, 0xA8, 0x8F,
+    0x47, 0xB5, 0xF6, 0x44, 0xEB, 0x50, 0x3C, 0x15, 0x51, 0xE5, 0xB6, 0xAC, 0x17, 0xFE, 0x28, 0x74,
+    0x0B, 0xC1, 0x92, 0xB7, 0x72, 0xD3, 0x1F, 0xC7, 0x8A, 0xE5, 0xF2, 0x58, 0x2C, 0xB0, 0xFA, 0x22,
+    0x6B, 0x80, 0xC2, 0xCA, 0x6B, 0x33, 0x1D, 0x3C, 0x66, 0x1D, 0xD9, 0x8E, 0xAF, 0xAA, 0x5A, 0xBC,
+    0x6E, 0x28, 0xDC, 0xC4, 0x5D, 0xEF, 0x1B, 0xA0, 0x30, 0x45, 0xDE, 0xA2, 0x91, 0xB6, 0x0A, 0xB0,
+    0x89, 0x57, 0x78, 0xAD, 0xF3, 0x08, 0x51, 0xBE, 0xAD, 0x85, 0xD5, 0x6E, 0x9B, 0x93, 0x94, 0x87,
+    0x56, 0x6B, 0xCC, 0xE0, 0x36, 0x6A, 0x2E, 0x34, 0x14, 0x69, 0xDC, 0x9A, 0xAD, 0x91, 0x36, 0x8D,
+    0xD3, 0xBD, 0xA7, 0x55, 0x51, 0x35, 0xC7, 0xAB, 0xA8, 0x74, 0x07, 0x6D, 0xA8, 0xA2, 0x5A, 0x47,
+    0xFD, 0x82, 0x83, 0x73, 0x55, 0xCE, 0x1A, 0x3D, 0x41, 0x96, 0xED, 0x7B, 0xAD, 0xC5, 0x07, 0x4C,
+    0x37, 0x30, 0xE8, 0x13, 0xD9, 0x07, 0xBC, 0x3A, 0x1C, 0x2D, 0x5B, 0x03, 0x1C, 0x35, 0x61, 0x1B,
+    0xD5, 0xC8, 0xD7, 0x66, 0xE6, 0x6E, 0x69, 0x7D, 0x3B, 0x4D, 0xD6, 0xFA, 0x95, 0x48, 0xE9, 0xEE,
+    0x70, 0x98, 0x70, 0x1D, 0x51, 0xFB, 0x37, 0xCD, 0x59, 0x3F, 0x8F, 0xDD, 0xC6, 0x11, 0x1F, 0x3E,
+    0xEA, 0x8E, 0x88, 0x88, 0x84, 0x2A, 0x74, 0x40, 0x2C, 0x01, 0x66, 0x9B, 0x08, 0x31, 0x98, 0x0F,
+    0xE0, 0x98, 0x74, 0x5C, 0xA4, 0x48, 0xE1, 0x2B, 0xF4, 0x80, 0x00, 0x2E, 0xD4, 0xA4, 0x08, 0xAE,
+    0x88, 0xDC, 0x18, 0x48, 0x52, 0x98, 0x84, 0xF5, 0x05, 0x84, 0x20, 0x48, 0x93, 0xC2, 0x2A, 0x6C,
+    0x20, 0xBA, 0x00, 0x51, 0x8A, 0x14, 0x2E, 0x6C, 0x93, 0xB6, 0xBF, 0x00, 0x5D, 0xB9, 0x0C, 0x0D,
+    0x44, 0x8D, 0x5D, 0x78, 0x0D, 0x30, 0x01, 0xA5, 0x90, 0xDC, 0xFC, 0x7E, 0xB3, 0x24, 0xDF, 0x7B,
+    0x77, 0x27, 0xC9, 0x82, 0xCE, 0x48, 0xF8, 0xC8, 0xDD, 0x25, 0x77, 0x76, 0x76, 0xFE, 0xED, 0xCC,
+    0xEC, 0x3E, 0x39, 0x14, 0xF9, 0xBB, 0xC8, 0x0B, 0x72, 0x74, 0x2F, 0xB3, 0xB6, 0x30, 0xCF, 0x8B,
+    0xF9, 0x8D, 0x98, 0x3B, 0x62, 0xE4, 0x59, 0xEF, 0x3B, 0x22, 0x5E, 0x26, 0x41, 0x21, 0xCF, 0x8B,
+    0xBC, 0x79, 0x9C, 0x95, 0xB6, 0x7A, 0xC1, 0xAF, 0xC2, 0x57, 0xAA, 0xD5, 0xAD, 0x4A, 0xFC, 0x67,
+    0xBF, 0x8B, 0xF5, 0xFA, 0xD0, 0x5A, 0xB3, 0xDC, 0x78, 0x3D, 0xFD, 0xE5, 0x60, 0xBD, 0x5E, 0x5F,
+    0x2F, 0xAD, 0xB5, 0xFD, 0xA6, 0xC8, 0x59, 0xC8, 0x7C, 0xF1, 0x93, 0x9D, 0xFB, 0x1E, 0xD1, 0x58,
+    0x80, 0x0F, 0x64, 0xEF, 0xB0, 0xCC, 0x22, 0xF3, 0xFF, 0xF4, 0x1C, 0xC9, 0xFE, 0x1D, 0x25, 0x2E,
+    0x05, 0xA9, 0x99, 0x16, 0xE4, 0x5A, 0x36, 0xD7, 0x89, 0x0E, 0x6F, 0xF0, 0x87, 0xA0, 0x0F, 0xFB,
+    0xA8, 0x8F, 0xBB, 0xB4, 0x4D, 0x4D, 0x6E, 0x0E, 0x0E, 0x7D, 0x2B, 0x81, 0x95, 0x70, 0x94, 0x68,
+    0x90, 0xA8, 0x97, 0xA8, 0x93, 0xD8, 0x48, 0x62, 0x24, 0xAD, 0xE5, 0x20, 0x93, 0xBC, 0xC9, 0x4D,
+    0x6A, 0x92, 0x36, 0xEE, 0x22, 0x8C, 0xF3, 0x87, 0xD5, 0x20, 0xEB, 0xA8, 0x0F, 0x46, 0xBC, 0x8D,
+    0x71, 0x1F, 0x0D, 0x09, 0xBE, 0xA7, 0x26, 0xEA, 0x52, 0x13, 0xB7, 0x69, 0x9D, 0x98, 0xBC, 0x4A,
+    0x9B, 0xB2, 0x48, 0xAB, 0x35, 0x06, 0xE7, 0x4D, 0xD2, 0x0A, 0x86, 0x77, 0x82, 0xDE, 0x5E, 0x92,
+    0x16, 0xE8, 0x89, 0x07, 0xD3, 0x04, 0x83, 0x00, 0xDB, 0x28, 0x40, 0x68, 0x05, 0x38, 0xAD, 0xC8,
+    0x1A, 0x3F, 0xB9, 0x76, 0x1B, 0x34, 0xC3, 0x80, 0xD2, 0x46, 0x24, 0xE1, 0x53, 0x8B, 0xC4, 0x7C,
+    0x2A, 0x39, 0x8C, 0xAA, 0xCB, 0xD4, 0xC8, 0xFC, 0x8C, 0xF7, 0xBE, 0x00, 0xA6, 0x4A, 0xF4, 0x89,
+    0xE7, 0x67, 0x82, 0x4F, 0xE6, 0x67, 0xC2, 0x93, 0x6E, 0x3F, 0x66, 0xF7, 0xB9, 0x02, 0x19, 0x82,
+    0x5F, 0x7D, 0x62, 0x3E, 0x80, 0x89, 0xF8, 0xD4, 0x62, 0xBF, 0xFA, 0x72, 0xC0, 0x5C, 0xCB, 0xC3,
+    0x6F, 0xDA, 0x17, 0x9B, 0xDD, 0x31, 0xF8, 0x76, 0xF7, 0xC6, 0xFD, 0xBB, 0xDB, 0xB0, 0xEF, 0xBE,
+    0xFA, 0xE9, 0x2F, 0x76, 0xE0, 0xE7, 0x31, 0x9C, 0x73, 0x0D, 0x99, 0xD7, 0x91, 0x6D, 0x13, 0xDB,
+    0xA7, 0xBC, 0x07, 0xBD, 0xD9, 0x4E, 0x6C, 0x17, 0x59, 0xB3, 0xB2, 0x05, 0xB4, 0x87, 0xA7, 0x13,
+    0xB1, 0x99, 0xD8, 0x46, 0xEC, 0x28, 0xD6, 0xD6, 0xD6, 0x76, 0x7A, 0xD7, 0x7C, 0x6D, 0xD8, 0xD5,
+    0x29, 0x18, 0xAE, 0xAB, 0x45, 0x6E, 0xD0, 0xD5, 0x95, 0xD0, 0xEB, 0x5E, 0x76, 0xB5, 0x90, 0x5F,
+    0x4B, 0x69, 0x3C, 0x5B, 0xD9, 0xD6, 0x07, 0x38, 0x8A, 0xC6, 0xB6, 0x2B, 0x5B, 0xE7, 0x18, 0x55,
+    0xED, 0x65, 0xB0, 0xE7, 0xAB, 0x45, 0x69, 0x6C, 0xCB, 0x5F, 0xDE, 0xEC, 0x65, 0x47, 0xC7, 0x85,
+    0xB5, 0xD5, 0xB3, 0x2F, 0xFD, 0xE5, 0xFE, 0x9B, 0xC8, 0xF1, 0x31, 0xFC, 0xCA, 0xB9, 0xAC, 0xF8,
+    0xCD, 0xD2, 0xCF, 0xC1, 0xC2, 0x59, 0xF7, 0xB9, 0x10, 0x0D, 0x3C, 0xBF, 0x3B, 0x2E, 0x5E, 0x17,
+    0x59, 0xEE, 0x37, 0xD6, 0xD9, 0x39, 0x22, 0xBF, 0x76, 0x0C, 0x7B, 0xD8, 0xDC, 0x07, 0xEB, 0x73,
+    0xA3, 0x7C, 0xFB, 0xF2, 0x80, 0x53, 0xD2, 0x4A, 0xDB, 0x91, 0x85, 0x81, 0x94, 0xAE, 0x9D, 0xC0,
+    0x80, 0x69, 0x32, 0xEA, 0x18, 0xFE, 0x63, 0x05, 0xEB, 0x4F, 0xAF, 0xBC, 0xB2, 0x59, 0x30, 0x79,
+    0xBA, 0xB2, 0xB2, 0x05, 0x5C, 0x80, 0x5E, 0xB6, 0x28, 0xAB, 0xD8, 0x6C, 0xDA, 0xF0, 0x08, 0x4B,
+    0x7B, 0x42, 0xA9, 0xED, 0x09, 0xA5, 0x94, 0x45, 0xF9, 0x96, 0xF5, 0xAE, 0x8B, 0xC0, 0xBC, 0xF0,
+    0xF5, 0xD6, 0x10, 0xC3, 0x8A, 0x31, 0x7F, 0xFA, 0xA9, 0x8D, 0xBA, 0xDC, 0x36, 0xBE, 0xB5, 0x74,
+    0x48, 0x31, 0x1C, 0x74, 0x1B, 0x21, 0xE0, 0x44, 0x30, 0xF8, 0xCF, 0xED, 0xAB, 0x7D, 0xD4, 0x95,
+    0x95, 0x0F, 0x2B, 0xFC, 0xD8, 0xFA, 0x43, 0x62, 0x30, 0xCB, 0x51, 0x66, 0x5F, 0x19, 0xFD, 0x31,
+    0x69, 0xB8, 0x74, 0x57, 0xF8, 0xEA, 0x8F, 0x69, 0xC3, 0xA5, 0x83, 0xD6, 0xB0, 0x9A, 0xDA, 0xEA,
+    0x8D, 0xA6, 0x76, 0xD4, 0x6E, 0x60, 0xD2, 0xC6, 0x1F, 0x15, 0x4F, 0x43, 0xCE, 0x38, 0x3A, 0x26,
+    0x4E, 0x50, 0xEA, 0xD9, 0xB7, 0xFB, 0xE8, 0x01, 0x28, 0xF7, 0xE0, 0x6E, 0x40, 0x43, 0x08, 0x1A,
+    0x80, 0x92, 0x5E, 0x52, 0x69, 0x03, 0x4A, 0x3C, 0xF8, 0x56, 0x4E, 0x02, 0x90, 0x43, 0xE5, 0xE5,
+    0xE4, 0xB5, 0x52, 0xF9, 0xD6, 0xCB, 0xFB, 0xB6, 0x8C, 0x4F, 0xCA, 0x79, 0x96, 0x35, 0xDC, 0xDC,
+    0x72, 0x51, 0xDE, 0xFE, 0x26, 0xB2, 0xEC, 0xC8, 0xFC, 0xA4, 0xDC, 0x17, 0xD9, 0x37, 0xBB, 0xEF,
+    0x79, 0xB5, 0xFB, 0xBE, 0x35, 0x1D, 0xF5, 0xF0, 0xB1, 0x15, 0xA7, 0x07, 0x3A, 0x55, 0xD5, 0x45,
+    0x44, 0xBE, 0x7A, 0xB0, 0x57, 0x53, 0x1F, 0x3F, 0x87, 0xAB, 0x31, 0xE4, 0x39, 0xB1, 0x2D, 0x75,
+    0x12, 0x41, 0x27, 0x1D, 0xE4, 0x51, 0xE5, 0x08, 0x79, 0x11, 0x7C, 0xD1, 0xE7, 0xF6, 0x4F, 0xF0,
+    0xEE, 0x65, 0x6D, 0x3F, 0x83, 0x93, 0x9E, 0x74, 0x03, 0x39, 0x36, 0xF6, 0xA7, 0x60, 0x04, 0xFA,
+    0xB9, 0x45, 0xFD, 0x98, 0xE4, 0x6B, 0x4B, 0x59, 0x42, 0xA0, 0xFE, 0xB8, 0xB2, 0x89, 0x89, 0xBF,
+    0xB6, 0xCA, 0x38, 0xB5, 0xB1, 0xFD, 0x4E, 0x5F, 0xBF, 0xFD, 0x0E, 0x7D, 0xED, 0xBC, 0x27, 0x70,
+    0x78, 0xFE, 0x18, 0x9B, 0xC4, 0xD8, 0x97, 0x89, 0x2F, 0xAD, 0x80, 0x71, 0x88, 0x5A, 0xCC, 0xF7,
+    0x96, 0x55, 0x8E, 0x64, 0xA2, 0xA7, 0x04, 0x3D, 0xAA, 0xBF, 0xD2, 0x76, 0x01, 0xE8, 0x4D, 0x19,
+    0xA2, 0x69, 0xC8, 0x29, 0x9D, 0xA6, 0x95, 0x18, 0xFC, 0x48, 0x30, 0xE9, 0x31, 0xEF, 0xE9, 0x66,
+    0x27, 0xA9, 0x5C, 0xD7, 0x9C, 0x44, 0x2E, 0xA3, 0x19, 0xB7, 0x74, 0xC2, 0xD0, 0x98, 0x2D, 0xA0,
+    0x17, 0xA8, 0x22, 0xEC, 0x24, 0x32, 0x0C, 0x18, 0x69, 0xC1, 0xDE, 0x98, 0x11, 0x4B, 0x21, 0x72,
+    0xC4, 0x80, 0xC2, 0xC2, 0x8A, 0x3C, 0xC2, 0xC1, 0x56, 0xC2, 0x0E, 0xC8, 0x23, 0xA3, 0xD0, 0x08,
+    0x14, 0x69, 0x91, 0x54, 0x6E, 0x44, 0xE4, 0xC6, 0x20, 0xE2, 0x71, 0x14, 0xD4, 0xC5, 0x71, 0xA5,
+    0x1B, 0x49, 0x75, 0x6B, 0xA4, 0xE3, 0x68, 0xDF, 0x8D, 0x0F, 0x5B, 0xC5, 0x00, 0x44, 0xC4, 0x81,
+    0xD8, 0x05, 0xDB, 0xC5, 0xBC, 0x30, 0x41, 0x70, 0xA3, 0x0C, 0x16, 0x5C, 0xC3, 0x98, 0x23, 0x34,
+    0xE2, 0x77, 0x90, 0x55, 0xEB, 0x82, 0x67, 0xC8, 0xE0, 0x49, 0xF1, 0x89, 0x62, 0x06, 0x1C, 0x6C,
+    0x21, 0xAD, 0x40, 0xBC, 0x62, 0x0B, 0x4D, 0xD0, 0x02, 0x7E, 0xD5, 0x73, 0x04, 0x83, 0xB9, 0x06,
+    0x6E, 0x1D, 0xC5, 0x78, 0x3B, 0x2A, 0x41, 0x3A, 0x12, 0x13, 0x70, 0x6C, 0xEA, 0x46, 0x63, 0x22,
+    0x8E, 0x0F, 0x1D, 0x06, 0xBF, 0x53, 0x1C, 0x9E, 0xB3, 0xD2, 0xA8, 0x70, 0xD1, 0x55, 0x97, 0x14,
+    0x0C, 0x73, 0x80, 0xB1, 0xF6, 0xBD, 0xAC, 0xDA, 0x5C, 0x7C, 0x93, 0x66, 0x61, 0x1D, 0x57, 0x51,
+    0x15, 0xD5, 0x49, 0x16, 0x98, 0x54, 0xFC, 0x56, 0x56, 0x1A, 0xF4, 0x92, 0x5E, 0xCA, 0xD6, 0xE3,
+    0xD2, 0xC2, 0x4A, 0x97, 0xB4, 0x97, 0xBC, 0x65, 0x19, 0x8F, 0xD0, 0x4D, 0xB6, 0x42, 0x5C, 0xB0,
+    0x46, 0xDF, 0x3B, 0x26, 0x8A, 0x50, 0x4E, 0xC1, 0x41, 0x80, 0x49, 0x68, 0x81, 0x30, 0x3A, 0xD8,
+    0xC0, 0xFC, 0x0E, 0x30, 0xAA, 0xB7, 0xC2, 0x40, 0x0C, 0x47, 0x42, 0x01, 0x61, 0xF9, 0xD5, 0xCE,
+    0xA2, 0xCC, 0x28, 0xAD, 0x4B, 0xB2, 0xAA, 0xA5, 0x6C, 0xE4, 0x3D, 0x81, 0x78, 0x31, 0x02, 0x49,
+    0x0D, 0xE3, 0x64, 0x48, 0x74, 0x60, 0x15, 0x98, 0xF0, 0xF6, 0x1D, 0xC4, 0x45, 0x21, 0x12, 0xD2,
+    0x40, 0x80, 0x90, 0x26, 0x06, 0x80, 0x44, 0xB9, 0xB5, 0x4D, 0xA9, 0x6B, 0x2F, 0x7D, 0xA8, 0xDD,
+    0x0D, 0x3C, 0x95, 0x7C, 0x28, 0x29, 0x02, 0x68, 0x8F, 0x01, 0x18, 0xC6, 0x85, 0x83, 0x7A, 0xC5,
+    0x70, 0x5A, 0x25, 0x26, 0xB4, 0x83, 0x67, 0x8B, 0xFD, 0x22, 0x41, 0x92, 0xF5, 0x43, 0xDA, 0xAA,
+    0x51, 0x93, 0x23, 0x2C, 0x4C, 0x91, 0xC8, 0x91, 0x58, 0x09, 0xB9, 0xF0, 0x69, 0xEA, 0x44, 0x0E,
+    0x00, 0x0E, 0x2D, 0x00, 0x80, 0xEE, 0xB2, 0x76, 0x99, 0x17, 0x25, 0x05, 0x79, 0x32, 0xAE, 0x83,
+    0x90, 0x0A, 0xDF, 0xE5, 0xC7, 0xEA, 0x4E, 0xB8, 0xB4, 0x4B, 0xCC, 0xAF, 0xA1, 0xDC, 0x15, 0xFA,
+    0x5A, 0x9A, 0xD3, 0x45, 0x6E, 0xC8, 0x29, 0xF3, 0x87, 0x13, 0x45, 0x8A, 0x22, 0x4B, 0x1B, 0xEF,
+    0x54, 0x81, 0x24, 0x6F, 0x3B, 0x63, 0x44, 0xE2, 0x70, 0x57, 0x88, 0xAA, 0x98, 0x66, 0x0B, 0xA6,
+    0x29, 0xF3, 0x06, 0x08, 0xE0, 0x51, 0x2E, 0x4F, 0x41, 0xA6, 0xC4, 0x02, 0x03, 0xCF, 0x1D, 0xD3,
+    0xE8, 0xD1, 0x25, 0x9A, 0x89, 0xFD, 0xCC, 0x16, 0xDF, 0x85, 0xD3, 0xA8, 0xE8, 0x73, 0xE6, 0xE2,
+    0x23, 0xAE, 0xC4, 0x4F, 0xC0, 0x7B, 0xFE, 0x0F, 0xAC, 0xD3, 0x9C, 0xCE, 0x12, 0xC1, 0x80, 0x2B,
+    0x16, 0x8C, 0xA5, 0x94, 0x39, 0x33, 0xA2, 0xAD, 0xE2, 0xC4, 0x75, 0xF1, 0x36, 0x3B, 0x28, 0xCB,
+    0x9C, 0xC0, 0x25, 0x8B, 0xBC, 0x9B, 0x81, 0x17, 0xFF, 0x4C, 0x0A, 0xEC, 0xA6, 0xB8, 0x76, 0x7C,
+    0x7C, 0x7C, 0xD7, 0xF5, 0x7C, 0x9F, 0x45, 0xFD, 0x13, 0x12, 0x6D, 0x62, 0x94, 0x41, 0x15, 0x32,
+    0x4D, 0xCC, 0x56, 0x40, 0xF2, 0x21, 0x10, 0xDE, 0xBF, 0x87, 0x46, 0x6C, 0xA9, 0x36, 0xAF, 0x7C,
+    0x40, 0xE0, 0xA3, 0x77, 0x54, 0x73, 0x4C, 0xC2, 0xF2, 0x11, 0x1E, 0xC5, 0x1B, 0x98, 0xA4, 0x06,
+    0x4C, 0x26, 0xB3, 0x88, 0xFE, 0xAC, 0x7A, 0x89, 0x2A, 0x6E, 0x5E, 0x24, 0x70, 0xB3, 0x43, 0x2D,
+    0xA8, 0x5B, 0x81, 0x56, 0xE8, 0x51, 0x82, 0x7A, 0x4A, 0x4E, 0x81, 0x26, 0x45, 0xD7, 0x9B, 0xAE,
+    0xDB, 0xEB, 0xA6, 0xEE, 0x86, 0x88, 0x1C, 0x48, 0x32, 0xE5, 0xA5, 0x1F, 0x70, 0x65, 0xBD, 0x0F,
+    0x0C, 0x2F, 0x01, 0x24, 0x11, 0xAC, 0xAC, 0x02, 0x2B, 0xAB, 0x8A, 0xB3, 0xA0, 0x49, 0x75, 0x90,
+    0xC8, 0xFE, 0x9F, 0x97, 0xB9, 0x82, 0xFE, 0x09, 0xCD, 0x4D, 0x94, 0x39, 0xC4, 0x8A, 0x9E, 0xC3,
+    0xF4, 0xAD, 0xEE, 0xE6, 0x1C, 0xC9, 0x71, 0x35, 0x67, 0x36, 0x67, 0x3D, 0xDC, 0xB4, 0x87, 0x9B,
+    0xBD, 0x44, 0xB1, 0xD9, 0x39, 0xD5, 0x4B, 0xAE, 0x71, 0x73, 0x06, 0xF5, 0x6D, 0x34, 0x4F, 0x17,
+    0x0D, 0xE1, 0x30, 0x07, 0xCB, 0xDE, 0x77, 0xA1, 0x0D, 0xDE, 0xE7, 0x07, 0x2B, 0x17, 0xE7, 0x7C,
+    0xED, 0x3C, 0xD5, 0xD4, 0xD1, 0x61, 0xBB, 0xD3, 0xFC, 0xED, 0xAA, 0xDF, 0x6F, 0xE4, 0x9F, 0x81,
+    0x09, 0xAA, 0xFC, 0xE1, 0x80, 0xC5, 0x63, 0xBF, 0xFC, 0x37, 0x4C, 0x9D, 0x14, 0x7A, 0xA4, 0xD3,
+    0x35, 0x57, 0x6C, 0xD6, 0x47, 0x30, 0xC4, 0x3B, 0xDE, 0x5F, 0xAC, 0x7D, 0x08, 0x57, 0xA2, 0x01,
+    0x31, 0x1D, 0x95, 0xEE, 0x4A, 0x49, 0xE6, 0xE2, 0xFB, 0xCA, 0x90, 0xE4, 0x9C, 0x29, 0xC0, 0xAB,
+    0x54, 0xC3, 0x08, 0xA1, 0xFB, 0x96, 0xC4, 0x72, 0x4B, 0x24, 0xC1, 0xC8, 0x50, 0x12, 0xD1, 0xCD,
+    0xCA, 0xFB, 0x2B, 0xC2, 0xB6, 0x54, 0xE2, 0x05, 0x15, 0xDD, 0x25, 0x0F, 0xBB, 0xC0, 0xF5, 0xF5,
+    0x74, 0x4A, 0xD9, 0x79, 0x1F, 0xAC, 0x29, 0x1D, 0x4F, 0xF3, 0x28, 0xC7, 0x49, 0xA8, 0x94, 0x47,
+    0x2A, 0x93, 0xA4, 0x71, 0xD1, 0xDE, 0xC5, 0x68, 0x71, 0x71, 0x6B, 0x06, 0x74, 0x5A, 0x8A, 0x5A,
+    0x05, 0x74, 0x0E, 0xA7, 0x72, 0xC1, 0x7B, 0x03, 0x38, 0x9E, 0x04, 0x74, 0x59, 0x81, 0x4B, 0x3D,
+    0x5C, 0xC2, 0xA1, 0x80, 0xAB, 0x6D, 0xC0, 0xEE, 0x24, 0xE0, 0x4E, 0xA2, 0x5C, 0xCB, 0xE3, 0xEE,
+    0xFB, 0xD9, 0x06, 0x12, 0xED, 0xC7, 0x03, 0x6F, 0xA1, 0x45, 0x02, 0x85, 0xF8, 0xEB, 0x6E, 0xDA,
+    0xF1, 0xA3, 0xEF, 0x83, 0xDC, 0x2C, 0x90, 0x68, 0x3F, 0x1E, 0x78, 0x81, 0x4C, 0xED, 0x66, 0x91,
+    0xC1, 0xF1, 0xDC, 0x96, 0xAB, 0xF0, 0x22, 0x74, 0x3E, 0x54, 0x7C, 0x46, 0x07, 0x14, 0xD1, 0x00,
+    0xB8, 0xF0, 0x7F, 0x46, 0x7B, 0x48, 0x1E, 0xDC, 0xB4, 0x9F, 0xD8, 0x3F, 0xDA, 0xEE, 0x7B, 0x70,
+    0xB4, 0x1F, 0xD5, 0x74, 0xF6, 0x90, 0x69, 0xA5, 0x5E, 0x78, 0x6A, 0x74, 0xE2, 0xFC, 0x3F, 0xBB,
+    0x82, 0xD9, 0x31, 0x27, 0x96, 0x66, 0x8C, 0xB9, 0x98, 0x55, 0x30, 0x7B, 0xF5, 0xB9, 0x10, 0x72,
+    0xDA, 0x04, 0x15, 0xC8, 0xDC, 0x22, 0x1E, 0xA6, 0x81, 0x09, 0x57, 0xB9, 0x9D, 0xB4, 0xA7, 0xAA,
+    0x72, 0x19, 0xEA, 0xE4, 0x93, 0x98, 0x07, 0x9F, 0x71, 0x85, 0x70, 0x66, 0xDE, 0x7B, 0x32, 0xCF,
+    0x3B, 0x39, 0xB5, 0x50, 0x3D, 0x4D, 0x3F, 0x4D, 0xB3, 0x7C, 0x59, 0xA6, 0x50, 0x27, 0x77, 0x7D,
+    0x57, 0x04, 0xDC, 0x3C, 0x42, 0x0A, 0xB6, 0x55, 0xFF, 0x4B, 0x19, 0x41, 0x14, 0x8E, 0xF5, 0xCA,
+    0x1A, 0x32, 0x5E, 0x95, 0x6A, 0xED, 0xDB, 0xD5, 0xF4, 0x11, 0x0C, 0x4F, 0xEC, 0x32, 0x9C, 0x83,
+    0xD9, 0xDC, 0x28, 0xAB, 0xD8, 0x1C, 0x92, 0x02, 0x54, 0x64, 0x13, 0x15, 0x29, 0x40, 0xD4, 0x77,
+    0x79, 0xB5, 0xAB, 0x6A, 0xA5, 0xE6, 0x20, 0x3B, 0x83, 0x31, 0xC4, 0x0E, 0xB2, 0x05, 0xD4, 0x64,
+    0x01, 0xD2, 0xDA, 0xAE, 0x8C, 0x22, 0x03, 0x4E, 0x0E, 0xDF, 0x5B, 0x3C, 0x49, 0x0B, 0x17, 0x83,
+    0x64, 0x89, 0xC9, 0xF8, 0x80, 0x4A, 0xB9, 0x28, 0xDB, 0x58, 0x97, 0xB6, 0x89, 0xC6, 0xD7, 0x18,
+    0x8E, 0x83, 0x6C, 0x8E, 0xCA, 0xA5, 0x71, 0x55, 0x43, 0xBA, 0xF1, 0x31, 0x77, 0x3C, 0xB1, 0x8A,
+    0x18, 0xE8, 0x68, 0xED, 0x64, 0xC6, 0xE3, 0xB6, 0x83, 0x3C, 0xD5, 0xA4, 0x9B, 0x01, 0x1E, 0x15,
+    0x57, 0x35, 0xAB, 0x6E, 0xA9, 0xC0, 0xC5, 0xDE, 0xE1, 0x49, 0x15, 0x81, 0x0B, 0xB8, 0x1C, 0x72,
+    0x41, 0x21, 0x80, 0xFC, 0x64, 0x3C, 0x59, 0xE5, 0x0E, 0x19, 0x38, 0xF1, 0x0E, 0xE9, 0x14, 0xD6,
+    0xEB, 0xEB, 0xF9, 0x72, 0xBE, 0xC4, 0xA2, 0x43, 0xF8, 0x51, 0x4A, 0x73, 0x1A, 0x2E, 0xCD, 0x65,
+    0xA5, 0x79, 0x31, 0x95, 0xA9, 0xAE, 0x31, 0x5E, 0x02, 0x58, 0x39, 0x43, 0x68, 0x7A, 0xA0, 0x26,
+    0xE1, 0x12, 0x86, 0x05, 0x82, 0x06, 0xA9, 0x46, 0x0B, 0xA4, 0x87, 0x2E, 0xD0, 0x15, 0x5A, 0x1A,
+    0x2D, 0xC1, 0xA9, 0xCF, 0x93, 0x2A, 0x96, 0xA3, 0x96, 0xF6, 0x29, 0xCB, 0x71, 0x0B, 0x83, 0xC3,
+    0xD6, 0xB0, 0x64, 0x56, 0xAD, 0x31, 0xE7, 0x7C, 0xCB, 0x97, 0x56, 0xEA, 0x9C, 0x3C, 0x3D, 0xA9,
+    0xA2, 0xB0, 0x32, 0x75, 0xDF, 0x59, 0xA8, 0x25, 0x16, 0x72, 0x9B, 0x64, 0xB1, 0x96, 0x89, 0x96,
+    0xE9, 0x37, 0x28, 0x93, 0xAD, 0x51, 0xC0, 0xF0, 0x20, 0xCF, 0x02, 0xBB, 0xC1, 0x0C, 0x13, 0x63,
+    0x29, 0x9C, 0x11, 0xCF, 0xA1, 0x4B, 0x59, 0x18, 0x39, 0x6A, 0x0D, 0x1F, 0x1F, 0x60, 0x48, 0xF7,
+    0x3E, 0xE6, 0xEF, 0x59, 0x0C, 0x4B, 0x31, 0x9E, 0x51, 0x0C, 0x0B, 0x5C, 0xFF, 0xC1, 0x0D, 0x0C,
+    0x53, 0x04, 0xE5, 0x14, 0x89, 0x46, 0xA2, 0xC7, 0x44, 0xAB, 0xBB, 0xB3, 0x9F, 0x77, 0x45, 0x3F,
+    0x15, 0x97, 0x56, 0xBD, 0x1C, 0xE6, 0xBF, 0x47, 0x6E, 0xBE, 0x0C, 0x33, 0x2E, 0xDA, 0xDE, 0xB0,
+    0x7F, 0xE0, 0x7A, 0xAC, 0xA6, 0xDC, 0xC8, 0xBE, 0xDD, 0xBA, 0x78, 0x1A, 0x8C, 0xB0, 0x08, 0x6F,
+    0x60, 0x0C, 0xFD, 0x91, 0x57, 0xC9, 0xE6, 0xA4, 0xA7, 0xD5, 0x93, 0x9E, 0x66, 0xEF, 0x0C, 0x1F,
+    0x73, 0x80, 0xC5, 0xBD, 0x39, 0xB5, 0xE3, 0x8E, 0x03, 0xC9, 0xCB, 0xB3, 0xE4, 0x34, 0xFF, 0xD3,
+    0xEB, 0xA9, 0xB3, 0xB7, 0x6F, 0x57, 0xF8, 0xDF, 0x36, 0x7A, 0xCD, 0x1B, 0x56, 0xC8, 0x74, 0x82,
+    0x1E, 0x4E, 0x11, 0x4F, 0xD4, 0xE6, 0xD8, 0x17, 0xC7, 0x85, 0x3B, 0xCF, 0x70, 0x99, 0x04, 0x8C,
+    0x99, 0x07, 0x0A, 0x24, 0x80, 0x51, 0x9F, 0xAE, 0x6C, 0x39, 0x5D, 0xAC, 0x5D, 0x6A, 0x00, 0x30,
+    0x66, 0x11, 0x0C, 0x4C, 0x04, 0x0B, 0xFB, 0xD5, 0x9D, 0xA8, 0x45, 0x92, 0x63, 0x12, 0x9E, 0x93,
+    0x8C, 0x79, 0x15, 0x8F, 0x65, 0x45, 0x27, 0xE6, 0x6D, 0x39, 0xC0, 0xD8, 0xDE, 0x67, 0xF5, 0x2B,
+    0xA6, 0x56, 0x0F, 0xE1, 0xDC, 0x7A, 0x5D, 0x93, 0xF6, 0xDD, 0x9B, 0x5D, 0x32, 0xBA, 0x23, 0x71,
+    0x83, 0x1D, 0xF2, 0x15, 0x36, 0x0A, 0x66, 0xB3, 0x7B, 0xA5, 0x7D, 0xB0, 0x9C, 0x8F, 0x6F, 0x8E,
+    0x47, 0x34, 0x18, 0x6A, 0x3A, 0x69, 0x6F, 0xBF, 0xD6, 0x73, 0x47, 0x28, 0xB9, 0x3B, 0xAA, 0x2D,
+    0xA8, 0x41, 0xBF, 0x7E, 0x51, 0xB5, 0x79, 0x41, 0xDC, 0x19, 0x67, 0x3F, 0xE7, 0xCD, 0x45, 0x7F,
+    0x51, 0xC2, 0xA6, 0x4F, 0x90, 0x25, 0xF6, 0x65, 0xE5, 0x8F, 0xA3, 0x9E, 0xD3, 0xF4, 0xBA, 0xB9,
+    0xD7, 0xAC, 0xB4, 0xDF, 0x14, 0xFA, 0x8D, 0xA7, 0x00, 0x98, 0x0F, 0x13, 0x86, 0x7D, 0x8F, 0x6D,
+    0xA6, 0xE9, 0xD3, 0xCA, 0xAF, 0xFA, 0x48, 0x36, 0x48, 0x71, 0x3D, 0x27, 0x93, 0xFF, 0xD4, 0x83,
+    0x1B, 0x8D, 0xEF, 0xDA, 0x72, 0x49, 0xD9, 0x85, 0x47, 0x9B, 0x9E, 0x1E, 0xBA, 0x94, 0xCC, 0xBC,
+    0xB8, 0x69, 0xD1, 0xF0, 0xAF, 0x01, 0x53, 0x2E, 0x66, 0x4F, 0x30, 0xDA, 0x32, 0xDB, 0x9E, 0xCD,
+    0x5F, 0x3C, 0xB8, 0xE4, 0x99, 0xC4, 0x6D, 0x62, 0xF8, 0x63, 0x82, 0xD3, 0xE4, 0xF8, 0x09, 0x8F,
+    0xD3, 0x2C, 0xF7, 0x4A, 0xD8, 0x74, 0xBD, 0xCC, 0x13, 0x90, 0x95, 0xE5, 0x79, 0x08, 0xF7, 0xEB,
+    0x58, 0xBC, 0x01, 0x7E, 0x12, 0x76, 0x21, 0x2C, 0x01, 0x59, 0x20, 0xCF, 0x0E, 0xE2, 0x06, 0xBB,
+    0xF5, 0xA4, 0x4E, 0xB0, 0x77, 0xE7, 0xEE, 0xBD, 0x48, 0xB3, 0x34, 0xCB, 0xB3, 0x99, 0xD5, 0x99,
+    0xDB, 0xF9, 0xA4, 0x4A, 0x26, 0x02, 0xB6, 0xDE, 0x65, 0x4E, 0xE5, 0x2F, 0x3C, 0xCD, 0x4A, 0x54,
+    0x71, 0x80, 0xA8, 0xD2, 0xED, 0x6B, 0x33, 0x15, 0x4A, 0xC4, 0x8D, 0xA2, 0x7B, 0x57, 0xD1, 0xC0,
+    0xA4, 0x9D, 0x74, 0xDE, 0x79, 0x1A, 0xD4, 0x65, 0x76, 0x26, 0xBD, 0x73, 0x3D, 0xF3, 0x23, 0xCA,
+    0xE5, 0xBE, 0x02, 0xFF, 0x52, 0xE6, 0xF9, 0xEC, 0x09, 0x7A, 0x66, 0xFA, 0x66, 0x7A, 0x3D, 0x1D,
+    0x7A, 0xE9, 0x9B, 0xD0, 0x71, 0x41, 0x76, 0xE4, 0xF3, 0x28, 0xF9, 0x2D, 0xF4, 0x3C, 0xF7, 0x34,
+    0x4C, 0x26, 0x7A, 0x2E, 0x30, 0x68, 0xA6, 0x79, 0x4A, 0x7E, 0xA4, 0x7B, 0xE2, 0x27, 0xE6, 0x86,
+    0xD7, 0x1B, 0x54, 0xE2, 0x25, 0xFC, 0xBC, 0xA5, 0x07, 0xA8, 0x1F, 0x8F, 0x7B, 0x2B, 0x26, 0x98,
+    0x4D, 0x82, 0xA5, 0xB9, 0x85, 0xB8, 0xCD, 0xDC, 0x76, 0xE9, 0xBE, 0x5F, 0x79, 0x92, 0x15, 0xAB,
+    0x26, 0xAF, 0xB8, 0x1C, 0xB1, 0x66, 0xC8, 0xB0, 0x8D, 0xAE, 0x37, 0x53, 0x6A, 0xDB, 0x7D, 0xA7,
+    0x36, 0x9E, 0x2C, 0x06, 0x37, 0xD7, 0x69, 0x4A, 0x5C, 0x99, 0x2B, 0x77, 0x53, 0x2C, 0x9B, 0x4E,
+    0xAE, 0xA7, 0xFA, 0x2E, 0xEA, 0xFD, 0x3B, 0x3C, 0x9E, 0x49, 0x79, 0x7E, 0x13, 0x58, 0x1A, 0xFD,
+    0xB0, 0xD4, 0xBE, 0xD6, 0x3D, 0xD3, 0xAB, 0xB4, 0x62, 0x52, 0x75, 0x99, 0x87, 0x87, 0xD9, 0x69,
+    0x3C, 0x53, 0x8D, 0xF8, 0x5C, 0xDE, 0x47, 0x0A, 0x30, 0xFD, 0xC1, 0xD7, 0x9C, 0xAC, 0x8F, 0x8E,
+    0x8F, 0xED, 0x17, 0xC7, 0xC7, 0xB7, 0x1F, 0x35, 0x1E, 0x66, 0x84, 0x3A, 0xA3, 0x6F, 0xC5, 0x7C,
+    0xED, 0x32, 0xFF, 0x69, 0xBA, 0x1C, 0xBD, 0x3C, 0x3A, 0xAA, 0xC2, 0xE6, 0x2C, 0x7A, 0xF4, 0xDA,
+    0xCB, 0x52, 0x43, 0x1D, 0x97, 0x5D, 0x6E, 0xAE, 0x16, 0x5B, 0x9E, 0xB8, 0xCE, 0xDB, 0xB2, 0xE3,
+    0x2F, 0x6D, 0xBC, 0xE5, 0xEB, 0xFE, 0x04, 0x6D, 0x01, 0x7D, 0xB1, 0xD8, 0xCF, 0x36, 0x79, 0x80,
+    0xA7, 0xF6, 0x35, 0x5B, 0x0B, 0x31, 0xED, 0xA1, 0xB7, 0xDC, 0xCA, 0x12, 0xD0, 0xCB, 0xFF, 0x87,
+    0xDA, 0xD2, 0xC4, 0xB7, 0xF9, 0x57, 0x04, 0x36, 0xC9, 0x5B, 0xFF, 0x1F, 0x1C, 0xFC, 0x2B, 0x3B,
+    0xD7, 0x3F, 0x51, 0xEA, 0xD7, 0x65, 0x73, 0xBF, 0x71, 0x7E, 0xFF, 0x73, 0x60, 0x33, 0x9F, 0xE8,
+    0x79, 0x62, 0x48, 0xE7, 0x28, 0x4C, 0x02, 0xCE, 0xF1, 0x3F, 0x2B, 0x61, 0xE9, 0xB5, 0xC4, 0x1C,
+    0x0C, 0x3C, 0x85, 0xC4, 0x5C, 0x3C, 0x3E, 0x38, 0x17, 0xE4, 0x87, 0xA4, 0x36, 0xFC, 0xAB, 0xBC,
+    0x10, 0x14, 0x2F, 0xFA, 0x55, 0x74, 0x43, 0xB3, 0x86, 0x73, 0xA2, 0x1C, 0x41, 0xE4, 0xDA, 0xEE,
+    0x97, 0x73, 0x54, 0xE8, 0x7F, 0x01, 0xED, 0x55, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x7D, 0x3C, 0xC2,
+    0x22, 0x20, 0x16, 0x4C, 0xA3, 0x46, 0x46, 0xC0, 0xFE, 0x5C, 0xB0, 0x49, 0xED, 0x5D, 0xA4, 0x75,
+    0xA3, 0xC2, 0x74, 0x93, 0x22, 0xBD, 0x1A, 0xFF, 0x04, 0x6E, 0xDC, 0xA4, 0x65, 0x8A, 0xF4, 0x2A,
+    0xED, 0x53, 0x71, 0x7F, 0x20, 0xB8, 0x25, 0x92, 0x22, 0x65, 0xF8, 0x13, 0x88, 0xC0, 0x95, 0x5D,
+    0x64, 0x8B, 0x43, 0xC0, 0x93, 0x75, 0x1C, 0xBF, 0x59, 0xDE, 0xC9, 0x88, 0x63, 0x1B, 0x70, 0x90,
+    0xD2, 0x5C, 0x0E, 0xA5, 0xDD, 0x9D, 0x7D, 0xF3, 0xF5, 0x66, 0x0F, 0xE0, 0xE3, 0x07, 0xA4, 0xB2,
+    0x47, 0x21, 0x82, 0x52, 0xC4, 0x99, 0x20, 0x9D, 0x19, 0x9A, 0xCE, 0xF4, 0x4D, 0x6F, 0xFE, 0x31,
+    0x38, 0xE7, 0x7A, 0xC5, 0x7D, 0xEA, 0xBA, 0x9C, 0xFA, 0x0B, 0xB9, 0x05, 0x9E, 0xB6, 0xA8, 0xD0,
+    0x38, 0x63, 0xEF, 0x11, 0xCC, 0xD8, 0x0F, 0x0F, 0x6E, 0x2D, 0xF6, 0x40, 0x3E, 0x01, 0x05, 0xC5,
+    0x50, 0x3C, 0x65, 0x9A, 0x90, 0xFE, 0x3D, 0x21, 0xFF, 0x73, 0x42, 0xF1, 0xEB, 0x04, 0xF3, 0xED,
+    0x84, 0xE6, 0x5A, 0xAE, 0xBC, 0x48, 0x50, 0x39, 0x7B, 0x22, 0x17, 0x58, 0x50, 0x4F, 0x05, 0x35,
+    0xCE, 0x57, 0xCF, 0x51, 0xD1, 0xA6, 0x8A, 0xF9, 0xF9, 0x31, 0x14, 0x37, 0x8A, 0xB4, 0x94, 0x91,
+    0xEB, 0xB4, 0xB1, 0x10, 0xEA, 0xCE, 0x72, 0x91, 0x08, 0x36, 0xDF, 0x4D, 0xF0, 0xD4, 0x6F, 0x24,
+    0xE0, 0xE4, 0x05, 0x97, 0xEF, 0x73, 0x8F, 0xBE, 0xA7, 0x94, 0x62, 0xAA, 0x51, 0x06, 0xA0, 0x1A,
+    0x88, 0xF1, 0xFB, 0x08, 0xF3, 0x97, 0x58, 0x23, 0x8C, 0x5F, 0xE3, 0xD5, 0x6F, 0x57, 0xC5, 0xC8,
+    0xCB, 0x9D, 0x74, 0x8C, 0xD7, 0x2E, 0x14, 0xFF, 0xC1, 0x15, 0x56, 0xAB, 0x15, 0x21, 0xC4, 0xAA,
+    0xAC, 0x56, 0xC4, 0x4B, 0xE8, 0x5F, 0xCA, 0xBD, 0x8C, 0xF9, 0x28, 0xB6, 0x88, 0xA0, 0x86, 0xA0,
+    0x4D, 0x47, 0x5B, 0x0E, 0x74, 0x83, 0xF6, 0x66, 0x95, 0x9C, 0x2A, 0xF7, 0x2E, 0x30, 0x3F, 0xFE,
+    0x25, 0x72, 0x99, 0x34, 0xF7, 0xB6, 0xD2, 0xDC, 0xD2, 0x62, 0x39, 0x34, 0xAE, 0x98, 0xD4, 0xBF,
+    0x31, 0xD6, 0x25, 0xD6, 0xA4, 0x67, 0x3D, 0xE2, 0x6E, 0x15, 0x6B, 0x50, 0xC6, 0xFC, 0xD3, 0xE6,
+    0xD3, 0xAB, 0x03, 0xCE, 0x40, 0x9C, 0xA8, 0x4B, 0xB3, 0xDE, 0xD1, 0x77, 0xD5, 0xEF, 0x62, 0x0C,
+    0x43, 0xD3, 0x57, 0x22, 0x7D, 0x21, 0xBE, 0x4B, 0x5E, 0x18, 0x3A, 0xD4, 0xA8, 0x43, 0xF6, 0x74,
+    0xCD, 0xF8, 0x99, 0x97, 0x42, 0x06, 0x9C, 0xDE, 0x10, 0xE3, 0x17, 0xE0, 0xF6, 0xF0, 0x5E, 0xCA,
+    0x73, 0xA6, 0x4C, 0xB3, 0x76, 0x5C, 0xE1, 0xEE, 0xE5, 0xEA, 0xB0, 0x38, 0xBF, 0x9C, 0x6A, 0x4D,
+    0xEA, 0xC7, 0x07, 0x4D, 0x26, 0x7E, 0xCC, 0x42, 0xD1, 0x97, 0x5D, 0x45, 0x2E, 0x18, 0x34, 0xF0,
+    0x1C, 0x9B, 0xF8, 0x6D, 0x38, 0xB8, 0xE6, 0xCA, 0xAE, 0xE8, 0xB3, 0xB0, 0x18, 0x37, 0x9C, 0xE9,
+    0xFF, 0x79, 0xC8, 0x42, 0xBA, 0x4D, 0xC7, 0xC5, 0xDD, 0x48, 0xC7, 0x74, 0x9B, 0x85, 0x3C, 0xE2,
+    0x18, 0xBB, 0x21, 0xAA, 0x85, 0xA9, 0xF6, 0x30, 0x9E, 0x95, 0xD9, 0xF9, 0x18, 0x97, 0x71, 0xD5,
+    0x2C, 0xF6, 0xC3, 0x82, 0xE3, 0xF3, 0x3F, 0x30, 0x1B, 0xE7, 0x2D, 0x7C, 0x9F, 0x4A, 0x5F, 0x4A,
+    0xDF, 0x48, 0x6F, 0xD6, 0xFD, 0xD7, 0x55, 0x0F, 0xF3, 0xF1, 0xF7, 0x4C, 0xA9, 0x8E, 0x84, 0xA6,
+    0x0B, 0x9A, 0x36, 0x4A, 0xB2, 0xD7, 0x62, 0x33, 0x08, 0xD7, 0x29, 0x91, 0x09, 0xDA, 0x04, 0x84,
+    0x37, 0x24, 0x89, 0x74, 0xF3, 0x74, 0x5F, 0x23, 0x12, 0xEF, 0x20, 0x67, 0x75, 0x6D, 0x13, 0x92,
+    0xA3, 0x64, 0x91, 0x2B, 0xC5, 0xF8, 0x89, 0x2C, 0xD2, 0xC2, 0xC1, 0x5B, 0x3C, 0x51, 0x02, 0x8F,
+    0xB3, 0x5C, 0x2B, 0xAE, 0xB2, 0xCC, 0x74, 0xDF, 0xF0, 0xAF, 0x79, 0x15, 0xCF, 0x5B, 0x6D, 0x84,
+    0x64, 0xD5, 0x7E, 0x69, 0xBA, 0x2F, 0x4D, 0xF7, 0x1F, 0x9A, 0x4E, 0x99, 0x97, 0x69, 0xB5, 0x6E,
+    0xC4, 0x26, 0x30, 0x91, 0x5D, 0x89, 0x8F, 0xCD, 0x11, 0xF3, 0x31, 0x0F, 0x66, 0xE7, 0x8D, 0xAE,
+    0xFD, 0xD1, 0x2D, 0x76, 0x27, 0x2E, 0xF1, 0x2D, 0xA3, 0x62, 0x35, 0x5F, 0x91, 0x4D, 0x4E, 0xFD,
+    0x30, 0xF6, 0x58, 0x2D, 0xA9, 0x6B, 0xCE, 0xB5, 0x30, 0x09, 0x2A, 0xB2, 0x2F, 0x66, 0x71, 0xFD,
+    0x12, 0xF3, 0x19, 0xB2, 0xEA, 0x8D, 0xE8, 0x19, 0xCB, 0x33, 0x9D, 0xA0, 0x3A, 0x88, 0xE9, 0x74,
+    0x6E, 0x9C, 0xB7, 0xDA, 0x01, 0xB9, 0x46, 0xBB, 0x6E, 0x71, 0x69, 0xCF, 0x5B, 0xE5, 0x48, 0x11,
+    0x04, 0xD9, 0x6E, 0x3F, 0x37, 0x2A, 0x59, 0xA6, 0xD5, 0x80, 0x6C, 0x59, 0xBD, 0x5B, 0xE4, 0xDB,
+    0x09, 0xE5, 0xE0, 0xAD, 0x7A, 0x79, 0x69, 0x4F, 0xDB, 0xFB, 0x13, 0x2F, 0x11, 0xEE, 0x3D, 0x5C,
+    0xEF, 0xF1, 0x95, 0xD2, 0x82, 0xDE, 0xD4, 0xB5, 0xBF, 0xF3, 0x6F, 0x8A, 0xF9, 0xA2, 0xC5, 0xD7,
+    0x5A, 0x99, 0x2D, 0x92, 0x8D, 0xC5, 0x12, 0x78, 0xC7, 0xF4, 0xA3, 0x3C, 0x1A, 0xF5, 0x22, 0xD2,
+    0x4E, 0x75, 0x91, 0xAB, 0xDD, 0xA7, 0x2F, 0xA2, 0xA5, 0x3D, 0x77, 0x4B, 0x3D, 0xE7, 0xDE, 0x17,
+    0xC6, 0xE0, 0xC8, 0x98, 0x67, 0xEC, 0xBE, 0x1F, 0x89, 0xF9, 0xFD, 0x40, 0xDC, 0x8E, 0xB8, 0x2A,
+    0x01, 0xE6, 0x37, 0xE6, 0xE4, 0x07, 0xEE, 0x31, 0x76, 0x43, 0x5E, 0x2D, 0xED, 0xE9, 0xD5, 0xF2,
+    0xA3, 0x3F, 0xAD, 0xC7, 0xB1, 0xB4, 0xCB, 0x7C, 0xCC, 0x89, 0xD6, 0x48, 0x13, 0x7D, 0x9C, 0x39,
+    0x3C, 0xDC, 0xF1, 0xD2, 0xC5, 0xAF, 0x9D, 0x3D, 0xFE, 0xD4, 0x97, 0x48, 0xEA, 0xF9, 0x8C, 0xF5,
+    0x79, 0xD1, 0xE6, 0x5B, 0x9E, 0x99, 0xF4, 0x8C, 0x8D, 0x0C, 0x71, 0xE6, 0xDD, 0x19, 0x57, 0xCD,
+    0xCC, 0xD1, 0xBE, 0xD2, 0x7D, 0xCF, 0xFB, 0xF1, 0xD1, 0xF0, 0xEF, 0x2C, 0x53, 0x4E, 0x26, 0x5E,
+    0x09, 0xC1, 0x5F, 0xF7, 0x24, 0x0A, 0xAF, 0x99, 0x46, 0x2F, 0xF1, 0x0E, 0x3E, 0x20, 0x0F, 0x36,
+    0x0B, 0xE2, 0x03, 0x99, 0xF8, 0x60, 0x07, 0xF0, 0xA2, 0x0A, 0x48, 0xB9, 0x7C, 0xD3, 0x36, 0x32,
+    0xF0, 0xCD, 0x55, 0xE5, 0xFD, 0x37, 0x93, 0x90, 0x32, 0xAD, 0x4D, 0xFB, 0x16, 0xAD, 0x58, 0xBF,
+    0x6F, 0xDD, 0xC8, 0x11, 0xDE, 0xF7, 0x78, 0x12, 0x01, 0x33, 0x00, 0xAF, 0x38, 0x05, 0x38, 0xB8,
+    0x60, 0xDA, 0x38, 0x08, 0xD8, 0x5E, 0x73, 0x22, 0x73, 0x2A, 0xAE, 0xB4, 0x0A, 0xCB, 0x2E, 0x54,
+    0xA4, 0x49, 0x11, 0xF8, 0x02, 0xE8, 0x1F, 0xB0, 0x41, 0xDE, 0x5D, 0x99, 0x46, 0x8D, 0x7B, 0x17,
+    0x29, 0x7C, 0xCF, 0x85, 0xF2, 0x07, 0x28, 0x5E, 0x9E, 0x5D, 0xB8, 0x48, 0x61, 0x1A, 0x86, 0x91,
+    0x22, 0xC5, 0x11, 0x89, 0x05, 0xC3, 0xBE, 0x42, 0x0C, 0x42, 0xC7, 0x94, 0x44, 0x72, 0xF2, 0xCD,
+    0xCC, 0xF2, 0xFD, 0x90, 0xE5, 0x24, 0x08, 0x2C, 0x08, 0xDF, 0xC7, 0x47, 0x2E, 0x97, 0xBB, 0xB3,
+    0x33, 0xDF, 0xCC, 0xAE, 0x31, 0xF2, 0x77, 0x99, 0x5E, 0x00, 0x2D, 0x75, 0xC6, 0x78, 0xC4, 0x18,
+    0x10, 0x35, 0xC6, 0x84, 0x74, 0xE7, 0x8F, 0xC6, 0xC4, 0x3D, 0x37, 0x49, 0x5A, 0xC1, 0x46, 0xB0,
+    0xBE, 0x34, 0x9B, 0xA5, 0x49, 0x1D, 0x11, 0xE5, 0x2B, 0xD8, 0x44, 0x03, 0xEE, 0xB7, 0x51, 0xCB,
+    0x6F, 0x31, 0x86, 0x44, 0xC3, 0x8C, 0x7B, 0x23, 0x32, 0x53, 0x41, 0x93, 0x09, 0x4E, 0xF6, 0x70,
+    0xDF, 0x98, 0x48, 0x7A, 0x75, 0xD8, 0xEF, 0x30, 0xA2, 0x9F, 0x8B, 0x70, 0xB2, 0xFD, 0x09, 0x9E,
+    0x7A, 0xF5, 0x6D, 0xC6, 0xEA, 0x90, 0x07, 0x7D, 0x8A, 0x81, 0xFA, 0xF8, 0x40, 0x6A, 0x12, 0xF4,
+    0x59, 0x18, 0xEE, 0x3F, 0xC5, 0xF8, 0x8F, 0x09, 0xDF, 0x3D, 0xDE, 0x22, 0xBC, 0x19, 0x6D, 0x55,
+    0x26, 0xE9, 0x63, 0xAF, 0xC4, 0xF8, 0x13, 0xBF, 0x30, 0x59, 0xB3, 0x19, 0x14, 0xC6, 0xD6, 0x9F,
+    0x87, 0x8C, 0xB7, 0xC3, 0x1C, 0x78, 0x18, 0xA5, 0xC0, 0x2E, 0x82, 0x01, 0xEA, 0x36, 0x66, 0x6C,
+    0x12, 0x0C, 0xF3, 0xA4, 0xDE, 0xC4, 0x4C, 0x07, 0xFE, 0x60, 0x4C, 0xF5, 0x2D, 0x1E, 0x47, 0x75,
+    0xB8, 0x86, 0xB9, 0x9C, 0x0C, 0x0F, 0xD8, 0x4A, 0x34, 0x18, 0xA3, 0x18, 0x09, 0x62, 0xAA, 0x30,
+    0x62, 0xB4, 0x55, 0xF3, 0x24, 0xBC, 0x0A, 0x18, 0xFB, 0xA5, 0x59, 0xF9, 0x9B, 0x58, 0xDA, 0xE7,
+    0x76, 0x3D, 0x1B, 0xA1, 0x9B, 0xE0, 0xED, 0xCE, 0xA3, 0x93, 0xDD, 0x26, 0xC0, 0xE0, 0x7F, 0x16,
+    0x92, 0x71, 0xB6, 0x4E, 0xBA, 0xD1, 0xDE, 0x59, 0xB3, 0x96, 0xFE, 0xD6, 0xD6, 0xE1, 0xB3, 0x1E,
+    0xF0, 0xB2, 0x03, 0xD0, 0x02, 0x30, 0xD0, 0x10, 0x3D, 0x35, 0x61, 0x87, 0xC6, 0x0C, 0x1D, 0x20,
+    0x1E, 0x00, 0x21, 0x5D, 0xED, 0x3E, 0x82, 0xD1, 0xFB, 0x43, 0x1E, 0xA7, 0x7E, 0x88, 0x6D, 0xD4,
+    0xB1, 0xB9, 0x30, 0xA6, 0xB5, 0x6D, 0xC3, 0xF7, 0xFA, 0xE9, 0x85, 0x50, 0x18, 0xF3, 0x1F, 0x00,
+    0xBD, 0xBC, 0x03, 0xAF, 0x67, 0xF7, 0xCE, 0xB5, 0xC3, 0xFC, 0xDA, 0x25, 0x78, 0x6F, 0x7F, 0x73,
+    0xBB, 0xE4, 0xEC, 0x24, 0x2D, 0x2C, 0x0D, 0xBF, 0xC3, 0x2B, 0xB5, 0xA1, 0x7E, 0xB7, 0x32, 0xE0,
+    0xD4, 0xF0, 0x88, 0x17, 0xF0, 0x53, 0x3A, 0xDA, 0x51, 0x1F, 0x1A, 0x61, 0xD0, 0x07, 0x13, 0x86,
+    0x95, 0x07, 0xA4, 0xF7, 0x26, 0xFC, 0x21, 0x8F, 0x7D, 0x28, 0x18, 0x8C, 0x36, 0x19, 0xEC, 0x05,
+    0x20, 0x43, 0xB1, 0x6E, 0x48, 0x83, 0x1B, 0x59, 0xAF, 0xEC, 0x61, 0x49, 0x36, 0xD2, 0xCB, 0x27,
+    0xFE, 0x70, 0x6A, 0xB2, 0xA7, 0x44, 0x4F, 0x88, 0xAA, 0xEC, 0x25, 0x3B, 0x1C, 0xB5, 0x99, 0x10,
+    0x75, 0x19, 0x9D, 0x11, 0x9D, 0xD2, 0x90, 0xF1, 0xC7, 0xF3, 0x78, 0xC8, 0xD8, 0xE6, 0x58, 0x8B,
+    0x8C, 0x57, 0x85, 0xB9, 0xE5, 0xE5, 0x0D, 0x28, 0x6B, 0x4C, 0xDC, 0x5D, 0xCC, 0x89, 0xE3, 0xCC,
+    0x31, 0x29, 0x4F, 0x1C, 0x7B, 0x8E, 0x7D, 0xC7, 0xA1, 0xE3, 0xC8, 0x71, 0x7C, 0xCC, 0x0C, 0xDF,
+    0xC9, 0xCD, 0x45, 0x93, 0x99, 0x76, 0x2B, 0xDE, 0xE8, 0x23, 0x58, 0x5A, 0x60, 0xE1, 0x75, 0x73,
+    0x2C, 0x05, 0xEB, 0x05, 0x9E, 0x35, 0x8C, 0x6F, 0x5B, 0xC6, 0x7F, 0x75, 0xC0, 0xAF, 0x86, 0xE1,
+    0xFE, 0x90, 0xB3, 0xC1, 0xA8, 0x50, 0xBC, 0x7C, 0x62, 0x6F, 0xF4, 0xA9, 0xDF, 0x26, 0x5B, 0x68,
+    0xD3, 0x26, 0x8F, 0x3A, 0xB3, 0xFC, 0x74, 0x6F, 0x38, 0xA0, 0x21, 0xF7, 0xDB, 0xE0, 0x9F, 0xFC,
+    0xD4, 0x7F, 0xCB, 0xE8, 0x9D, 0x31, 0x4E, 0xD9, 0x1F, 0xDB, 0x89, 0xA0, 0x59, 0xC6, 0x4C, 0x30,
+    0x61, 0xF3, 0xBD, 0x92, 0x91, 0xC2, 0x75, 0x2B, 0xC7, 0xBD, 0x63, 0x1A, 0xB9, 0x10, 0x55, 0xF2,
+    0x1D, 0x4F, 0xA4, 0x21, 0x54, 0x8A, 0x2A, 0x44, 0xB8, 0x70, 0xEC, 0x38, 0x71, 0x9C, 0x31, 0x4F,
+    0xA9, 0xB4, 0xCF, 0xB7, 0xA1, 0x57, 0xF4, 0x18, 0xCE, 0xC6, 0xFD, 0x1C, 0x38, 0x8E, 0x95, 0xDB,
+    0x0D, 0xC2, 0x73, 0x42, 0xBC, 0xA2, 0xE7, 0xE4, 0xF4, 0x9A, 0x11, 0x66, 0xF5, 0xFB, 0xAF, 0x5C,
+    0x3A, 0x46, 0x3F, 0x8D, 0xA8, 0xAA, 0x72, 0xE2, 0x38, 0xD0, 0xB9, 0x18, 0x73, 0x6D, 0x79, 0x7E,
+    0xA5, 0xE3, 0xF6, 0xC2, 0x79, 0x42, 0x5D, 0x95, 0xB1, 0x66, 0x97, 0x06, 0x28, 0xAF, 0x47, 0xA9,
+    0xA5, 0x96, 0xF9, 0x0B, 0x52, 0xFE, 0x12, 0x91, 0xC3, 0xCF, 0x03, 0xBA, 0x5E, 0x73, 0x7B, 0x48,
+    0xC3, 0xC7, 0xDC, 0x0F, 0x98, 0xFB, 0x81, 0xC6, 0x88, 0x4C, 0x96, 0x58, 0x57, 0xE6, 0xC2, 0x83,
+    0xC3, 0x27, 0x67, 0x18, 0xB4, 0xA5, 0x32, 0xA9, 0x31, 0xA6, 0x08, 0xE3, 0xAB, 0x6D, 0x8D, 0xB8,
+    0xEC, 0x92, 0x9A, 0xD5, 0x27, 0x03, 0xC3, 0x31, 0x4D, 0x08, 0xE6, 0x5E, 0x84, 0xE9, 0x52, 0xCA,
+    0xEC, 0xD3, 0xD5, 0x53, 0x2B, 0xDF, 0x7D, 0x22, 0xDF, 0x9D, 0xD2, 0x0F, 0xC4, 0xFD, 0x18, 0x42,
+    0x50, 0xA4, 0x32, 0x29, 0x88, 0x4C, 0x52, 0x4C, 0x89, 0x1D, 0xA3, 0xC4, 0x70, 0x03, 0xA1, 0x3C,
+    0x6C, 0x93, 0xCA, 0xA3, 0x22, 0x6C, 0xE2, 0x0A, 0x6B, 0x16, 0xD6, 0x11, 0xBA, 0x2A, 0x22, 0x50,
+    0x70, 0x5C, 0x46, 0x75, 0x58, 0x87, 0x3F, 0x94, 0x71, 0x15, 0x36, 0xE1, 0x5F, 0x2B, 0xA1, 0x3F,
+    0xD7, 0x49, 0x19, 0xB4, 0xD1, 0xE3, 0x3A, 0x29, 0x1C, 0x59, 0x0D, 0x36, 0xA5, 0xDE, 0x91, 0xD7,
+    0xC1, 0xF9, 0x6C, 0x3A, 0xED, 0xB3, 0x2F, 0x40, 0x93, 0x3E, 0x9B, 0x74, 0x08, 0xFE, 0xC1, 0x32,
+    0x99, 0xC1, 0x9A, 0x1E, 0x84, 0xF9, 0x0E, 0x2C, 0x15, 0x3D, 0xFF, 0x1B, 0xDB, 0x1B, 0xDB, 0xF1,
+    0x1C, 0xF9, 0x7F, 0x24, 0x76, 0xB9, 0x56, 0xA4, 0x17, 0xFF, 0xE8, 0xFA, 0x0F, 0x30, 0x86, 0x64,
+    0x95, 0x1C, 0xF3, 0x60, 0xAE, 0x1D, 0x77, 0xCC, 0xE5, 0xC4, 0xF6, 0xCC, 0x05, 0x62, 0x5B, 0xD9,
+    0x53, 0xA6, 0x87, 0x58, 0x15, 0xE6, 0xEF, 0xE7, 0xFC, 0xCD, 0x07, 0x63, 0x23, 0xFC, 0xAD, 0x70,
+    0x81, 0x28, 0x55, 0x0E, 0x07, 0x65, 0xCC, 0x02, 0xCC, 0xAA, 0xE4, 0xB8, 0x76, 0x9C, 0x2B, 0xBF,
+    0x90, 0xA5, 0x59, 0xFF, 0xCE, 0x88, 0x23, 0xCE, 0xF1, 0xCA, 0x01, 0xE6, 0x2A, 0x49, 0x69, 0x15,
+    0x4D, 0x38, 0x6F, 0xB3, 0x7E, 0x8F, 0xD1, 0xD2, 0xEF, 0x25, 0x91, 0x9F, 0x91, 0x4B, 0xEA, 0xA1,
+    0x60, 0x4C, 0x39, 0x54, 0x4F, 0xD4, 0x0E, 0xE9, 0x56, 0x50, 0x94, 0x28, 0x61, 0x1D, 0xB9, 0x08,
+    0x7B, 0x79, 0x2A, 0xED, 0x23, 0x2A, 0xB3, 0xB1, 0x1F, 0x7F, 0x2C, 0x14, 0x1E, 0x73, 0xA1, 0x30,
+    0x78, 0x5C, 0x28, 0x6C, 0x9B, 0x73, 0x49, 0x74, 0x36, 0x9B, 0xDD, 0xD3, 0x44, 0xE4, 0x90, 0xEB,
+    0x97, 0x7D, 0x23, 0x29, 0x4D, 0x2A, 0x97, 0x81, 0x33, 0x36, 0x2F, 0x72, 0x46, 0xF7, 0xF1, 0x14,
+    0xB6, 0xF8, 0x44, 0x33, 0x01, 0x16, 0xA8, 0x10, 0x64, 0x0F, 0xDD, 0xA5, 0x3B, 0xD7, 0xC6, 0x0C,
+    0xAE, 0x68, 0xE5, 0xA5, 0x25, 0xB3, 0xF0, 0xFD, 0x66, 0x15, 0x7D, 0x79, 0x57, 0xB2, 0xC9, 0x98,
+    0xC1, 0x48, 0x6A, 0x22, 0x4B, 0x77, 0x0E, 0x8D, 0x26, 0x59, 0x9E, 0x4C, 0x27, 0xB9, 0x92, 0xC7,
+    0xB6, 0xA7, 0x31, 0xBD, 0xC3, 0xEF, 0xF2, 0x2B, 0x2C, 0xBB, 0x94, 0x03, 0x03, 0x9E, 0x6F, 0x1A,
+    0xF5, 0x8C, 0x09, 0x0B, 0x71, 0x9A, 0xD5, 0x8C, 0x18, 0xA9, 0x0F, 0xC7, 0xE1, 0xC5, 0x45, 0x0D,
+    0x03, 0xBC, 0x3A, 0x30, 0xFE, 0x5A, 0xAA, 0x1D, 0x24, 0x05, 0x95, 0xD7, 0x15, 0xDC, 0xC3, 0xF8,
+    0xBF, 0xC3, 0xD3, 0x27, 0x3D, 0xB7, 0xF9, 0x52, 0xDE, 0xDA, 0xC2, 0x18, 0x7D, 0xFA, 0x95, 0xF4,
+    0x93, 0x92, 0xF4, 0x8C, 0x97, 0xF9, 0x5B, 0xDD, 0xE2, 0xBB, 0xA1, 0x8C, 0xC1, 0x97, 0xF1, 0xC0,
+    0x38, 0x89, 0xB8, 0x4A, 0xF6, 0x0E, 0xEA, 0x7D, 0x4C, 0x55, 0xA4, 0x8B, 0x2A, 0xB6, 0x01, 0xFD,
+    0xBD, 0x56, 0x95, 0x13, 0x64, 0x4B, 0x68, 0x0A, 0x95, 0x1B, 0xAA, 0xC3, 0x90, 0x3A, 0xC9, 0xC9,
+    0x2F, 0x6B, 0x59, 0x1C, 0x3C, 0x68, 0xA5, 0x9B, 0x6D, 0x31, 0x8C, 0xF6, 0x36, 0x15, 0x8C, 0x04,
+    0x2D, 0xE3, 0x54, 0xC5, 0xBE, 0x11, 0x4C, 0xC7, 0x2F, 0x2E, 0x70, 0xA9, 0x68, 0x50, 0x6F, 0x16,
+    0x99, 0xCC, 0xE7, 0x57, 0xB2, 0x1A, 0x5C, 0x93, 0xA9, 0x86, 0x9A, 0xF0, 0xD5, 0x75, 0x55, 0x51,
+    0xB3, 0xC6, 0xB7, 0xB5, 0xE8, 0xD8, 0xB8, 0xE6, 0xA9, 0xE4, 0xCE, 0x73, 0x06, 0xAB, 0xAB, 0x8E,
+    0x1D, 0x23, 0xAE, 0x51, 0x5B, 0x69, 0x06, 0xAD, 0xF9, 0x87, 0xFB, 0xF8, 0x78, 0x55, 0xCE, 0xAF,
+    0x0A, 0x77, 0xC5, 0x25, 0x86, 0xAD, 0x27, 0x0F, 0x72, 0xF1, 0x09, 0x82, 0xFC, 0xB6, 0xE2, 0x23,
+    0x54, 0x59, 0x18, 0x05, 0xFE, 0x36, 0xA5, 0xA7, 0xF4, 0x23, 0xDB, 0x1A, 0x3F, 0x1E, 0x21, 0x66,
+    0xF3, 0x80, 0x5D, 0x7E, 0x0B, 0x22, 0x94, 0xA3, 0x28, 0x49, 0x28, 0x40, 0xD2, 0xCC, 0xC3, 0x1E,
+    0xC9, 0x30, 0x94, 0x2B, 0x24, 0xCD, 0x26, 0x44, 0x0C, 0xA7, 0x3C, 0x8F, 0x32, 0xEC, 0x7D, 0x8E,
+    0x31, 0xE2, 0x60, 0xC1, 0xAC, 0x58, 0xCE, 0xF9, 0x27, 0x64, 0x8A, 0x4E, 0x0D, 0xAB, 0xB8, 0xAB,
+    0x33, 0x93, 0xEA, 0x9A, 0x33, 0x4E, 0x36, 0xAF, 0x3C, 0xB3, 0x79, 0x95, 0x65, 0xE7, 0x57, 0x8B,
+    0xCA, 0xCB, 0xD9, 0x8D, 0x67, 0x90, 0xBA, 0xAB, 0x29, 0x99, 0x77, 0xAE, 0xB4, 0x5C, 0x28, 0xC5,
+    0xC2, 0x9D, 0xAC, 0xF7, 0x30, 0xC6, 0xDB, 0x94, 0x9E, 0xE1, 0x55, 0x8F, 0xBE, 0x46, 0x57, 0x98,
+    0xE8, 0x12, 0x7E, 0x2D, 0xF7, 0x1F, 0x02, 0xA7, 0x3C, 0x67, 0xF6, 0x18, 0x76, 0x10, 0x3A, 0xEB,
+    0xA5, 0x0A, 0xEB, 0x34, 0x27, 0x8E, 0x8B, 0xFF, 0x71, 0xC8, 0xA3, 0xFA, 0x4C, 0x22, 0xF4, 0x96,
+    0x2C, 0xCE, 0x10, 0x12, 0xFB, 0x4D, 0x84, 0xC9, 0x7A, 0x64, 0xA5, 0xC4, 0xA1, 0x3D, 0x88, 0xCB,
+    0xF1, 0x00, 0xB5, 0x8B, 0x1F, 0x77, 0xAC, 0x32, 0xDF, 0xB4, 0x70, 0x5C, 0x6B, 0x6A, 0x09, 0xC8,
+    0x6D, 0x0D, 0x4B, 0x0D, 0xF2, 0xA9, 0x0B, 0x75, 0xDE, 0x3A, 0xEC, 0x32, 0x7A, 0x92, 0x98, 0x3C,
+    0x71, 0x52, 0x4F, 0x62, 0x72, 0x0A, 0xD5, 0xF0, 0x69, 0xD8, 0x1F, 0x45, 0x23, 0x90, 0x72, 0x22,
+    0x10, 0x4F, 0x45, 0x1A, 0x45, 0x1B, 0x95, 0x30, 0x2D, 0x64, 0x24, 0xD3, 0x14, 0x07, 0x34, 0x3B,
+    0xD0, 0xD5, 0x13, 0x09, 0x03, 0x2E, 0x3F, 0xD5, 0x6B, 0x7E, 0xAB, 0x95, 0x1E, 0x6A, 0xE9, 0xAD,
+    0x12, 0x94, 0x0A, 0x57, 0xF4, 0x45, 0xBF, 0x78, 0x4E, 0x82, 0xDF, 0x8B, 0x18, 0xFF, 0x5D, 0x29,
+    0x41, 0xC5, 0xB1, 0xF7, 0xE8, 0x44, 0x36, 0x3D, 0xE8, 0x34, 0x11, 0xE4, 0x2F, 0x22, 0xB1, 0xA2,
+    0xF0, 0xC4, 0x77, 0xDF, 0x36, 0xEB, 0xF0, 0x98, 0x6F, 0x1B, 0x16, 0x40, 0x6E, 0x9F, 0x74, 0x8C,
+    0x99, 0xA0, 0x6D, 0x04, 0x6B, 0x46, 0xD4, 0x76, 0x98, 0xE4, 0xBB, 0x88, 0x36, 0x03, 0xB0, 0xF5,
+    0x9A, 0xAC, 0xE6, 0xB7, 0xB2, 0x3A, 0xE9, 0x19, 0xB9, 0xB7, 0x0C, 0xC9, 0xFF, 0x11, 0x30, 0xA0,
+    0xB3, 0x53, 0x69, 0x2D, 0xC9, 0x45, 0x30, 0x16, 0x9C, 0xCA, 0x56, 0xCC, 0xF8, 0x27, 0x8B, 0xD1,
+    0x2A, 0x26, 0x1A, 0x88, 0x99, 0xAB, 0xB0, 0x75, 0x56, 0x5A, 0x26, 0x4C, 0xC8, 0x29, 0xA9, 0x5B,
+    0x2D, 0xCB, 0x3E, 0xE6, 0x0F, 0x19, 0x47, 0x64, 0xD8, 0x27, 0xEC, 0x1D, 0x61, 0x17, 0x37, 0x5A,
+    0xB5, 0x8F, 0x72, 0x37, 0x27, 0x44, 0x9F, 0x2F, 0x8E, 0x55, 0x71, 0xA6, 0xD8, 0xA0, 0xA3, 0x1B,
+    0x74, 0xE7, 0x5C, 0x13, 0xA8, 0xFC, 0x0E, 0xBD, 0xE1, 0xC0, 0xE3, 0x58, 0x86, 0xE3, 0x70, 0xC4,
+    0x4A, 0x4D, 0xD4, 0x98, 0x08, 0x2E, 0x18, 0x77, 0xB2, 0xDD, 0xC2, 0x25, 0x17, 0x67, 0x78, 0xCE,
+    0x01, 0x0D, 0xCF, 0x62, 0xC7, 0xF4, 0xE7, 0xFE, 0x7F, 0x99, 0xAD, 0xBE, 0x2E, 0x8B, 0xE8, 0xCB,
+    0x5C, 0x3D, 0xD2, 0x6D, 0xCD, 0x6B, 0x76, 0xE3, 0x17, 0x6E, 0x8B, 0x1C, 0x2E, 0x21, 0xE4, 0xF5,
+    0xE6, 0x6C, 0x66, 0x57, 0x2B, 0xE5, 0x8D, 0x5D, 0xA2, 0xE7, 0x29, 0x9B, 0x4B, 0x0C, 0x30, 0x4A,
+    0xF9, 0x58, 0x29, 0x63, 0x1F, 0x35, 0xCB, 0x35, 0xE3, 0x86, 0xC3, 0x12, 0xE2, 0xCE, 0xA7, 0x70,
+    0x86, 0xA3, 0xDD, 0x5E, 0xBE, 0xDB, 0x4B, 0xDA, 0xEB, 0xE5, 0x65, 0xDD, 0xAA, 0xEF, 0xB3, 0xA2,
+    0xA5, 0xE7, 0x5D, 0x85, 0x37, 0x9B, 0xCE, 0xB3, 0xD9, 0x7A, 0xE9, 0x44, 0x0C, 0xA2, 0x3D, 0x84,
+    0xF4, 0xAC, 0xB9, 0x85, 0xC0, 0x13, 0x27, 0xE9, 0x97, 0x5C, 0xA5, 0xBD, 0xC0, 0x55, 0x2E, 0x44,
+    0xD7, 0xA6, 0x59, 0x38, 0x98, 0xF6, 0xA0, 0x8E, 0x17, 0xC2, 0x09, 0x79, 0xAF, 0x7C, 0x76, 0x3A,
+    0xAC, 0xEE, 0x95, 0x63, 0xC1, 0xA9, 0x56, 0x22, 0x7E, 0x73, 0xCE, 0x55, 0xE2, 0x42, 0xF6, 0x28,
+    0x09, 0x6F, 0x46, 0x58, 0xBA, 0x82, 0x4E, 0x74, 0x0B, 0x9A, 0x08, 0x4F, 0x39, 0xDA, 0xEB, 0x77,
+    0x52, 0xA9, 0x3A, 0x5C, 0x42, 0x9A, 0xD3, 0x2F, 0x50, 0x8F, 0x0C, 0x33, 0x4C, 0xB0, 0x88, 0xA5,
+    0xE5, 0x87, 0x22, 0x9A, 0xE4, 0x20, 0x68, 0x6E, 0x01, 0x0A, 0x95, 0x3C, 0x25, 0xE3, 0x52, 0xCE,
+    0xDA, 0x72, 0x79, 0xA2, 0xC7, 0x28, 0x6C, 0xE7, 0x52, 0x83, 0xB4, 0x94, 0x5A, 0x80, 0x7D, 0x3B,
+    0xA6, 0x19, 0xBF, 0x00, 0x5F, 0xBB, 0x3C, 0x3F, 0x46, 0x99, 0x53, 0xAB, 0xA4, 0xF1, 0x11, 0xAB,
+    0x9A, 0x87, 0x9A, 0xBE, 0x74, 0xC3, 0xCE, 0x7D, 0xB6, 0xFA, 0x90, 0xCC, 0x22, 0x5E, 0xC6, 0xB6,
+    0x1E, 0x55, 0xEB, 0xF9, 0x77, 0xEB, 0xFB, 0xA8, 0xE0, 0xDF, 0xD2, 0x31, 0xCA, 0xF3, 0x4D, 0x3A,
+    0x38, 0x45, 0xF4, 0x7C, 0xD6, 0x07, 0xD5, 0xED, 0xA4, 0xDA, 0xEC, 0xFC, 0x72, 0x33, 0x2B, 0xA3,
+    0xDE, 0x2F, 0x13, 0x99, 0xC0, 0x91, 0x25, 0x75, 0x3D, 0xCC, 0xF3, 0x4F, 0x56, 0xFC, 0xE7, 0xD0,
+    0x3F, 0x7A, 0x60, 0x98, 0xCA, 0x4D, 0xA5, 0xCF, 0x35, 0x9B, 0x8E, 0xB9, 0xFF, 0x5D, 0x5C, 0xCE,
+    0x0D, 0x1B, 0x3B, 0xF8, 0x7B, 0x6F, 0xFB, 0x8D, 0xEB, 0xF4, 0x66, 0x27, 0x5D, 0xCD, 0xE2, 0x1F,
+    0x06, 0xD9, 0xAF, 0x4B, 0x3B, 0x07, 0x23, 0xDB, 0x24, 0x29, 0xEF, 0x58, 0xFE, 0x6F, 0xDE, 0xA7,
+    0xD7, 0xF9, 0xD2, 0x53, 0x77, 0x10, 0x50, 0xB0, 0x71, 0x53, 0x73, 0x93, 0xC8, 0x1D, 0x79, 0x59,
+    0x39, 0x39, 0x98, 0x9F, 0xBC, 0x48, 0x27, 0x81, 0x26, 0x8B, 0x62, 0x2C, 0x50, 0xA4, 0xAC, 0xC8,
+    0xBA, 0x71, 0x99, 0xB8, 0x03, 0x13, 0x68, 0x7F, 0xD5, 0x98, 0x50, 0x75, 0x31, 0x46, 0xFC, 0x1D,
+    0xE3, 0x8F, 0x9A, 0x2D, 0xC5, 0x9F, 0xD8, 0x39, 0x62, 0x16, 0x12, 0xDC, 0x28, 0x3F, 0x62, 0x7C,
+    0x8A, 0x8A, 0xF1, 0x05, 0xD1, 0xBC, 0xCD, 0xBA, 0x98, 0xD5, 0xEA, 0x07, 0xA9, 0x9C, 0x52, 0x3E,
+    0x30, 0xA6, 0xFB, 0xAC, 0xF0, 0x7C, 0x10, 0xC2, 0x32, 0xC7, 0x5B, 0x38, 0xC6, 0x40, 0xCE, 0x3D,
+    0xA0, 0x33, 0x40, 0x1E, 0x18, 0xFD, 0x85, 0x35, 0x4B, 0x9D, 0x8E, 0x44, 0x5D, 0xC7, 0x9E, 0x45,
+    0x1E, 0xB6, 0x57, 0x52, 0x79, 0xEE, 0x8A, 0x24, 0xAD, 0x63, 0x36, 0x3D, 0xF5, 0xC0, 0x5B, 0x13,
+    0x3D, 0x21, 0x38, 0x74, 0xFC, 0xC0, 0x1D, 0x7F, 0x88, 0xF8, 0xBA, 0x63, 0x36, 0x77, 0x4A, 0x23,
+    0x5A, 0xA2, 0xC1, 0x88, 0x78, 0x50, 0xB1, 0x2D, 0xF4, 0xB8, 0x64, 0xAF, 0x52, 0xF6, 0x99, 0xBD,
+    0xE2, 0xAE, 0xC7, 0x1C, 0xFD, 0xAD, 0xE1, 0x33, 0x31, 0x6C, 0xD8, 0x06, 0x3E, 0x15, 0x43, 0xBA,
+    0xA2, 0xE3, 0x82, 0x17, 0xD1, 0x5E, 0x95, 0xA1, 0xA6, 0xBF, 0x9C, 0x9E, 0x8C, 0x95, 0xF9, 0xA2,
+    0x4C, 0x4B, 0x32, 0x8D, 0x90, 0x9F, 0x44, 0xF4, 0xDA, 0xA6, 0x46, 0x53, 0x74, 0xAA, 0x01, 0xA0,
+    0x4D, 0x33, 0xC7, 0x81, 0xAB, 0xF1, 0xCC, 0x5A, 0x3A, 0x16, 0x73, 0xFF, 0x0F, 0xAF, 0xD9, 0x13,
+    0x97, 0x96, 0xA4, 0x4E, 0x88, 0x48, 0xED, 0x69, 0x75, 0xDE, 0xA2, 0xA0, 0x52, 0xD0, 0x35, 0xC9,
+    0x3F, 0x32, 0x9E, 0x3F, 0xB6, 0xE2, 0x01, 0x36, 0xB5, 0x28, 0xE1, 0xB0, 0x35, 0x2C, 0x38, 0x8B,
+    0x20, 0x27, 0x96, 0x71, 0x2B, 0x5C, 0x21, 0xBE, 0xC1, 0x76, 0xE4, 0x5A, 0x19, 0x49, 0xB5, 0x36,
+    0x57, 0xEE, 0x2A, 0x4B, 0xB5, 0xF9, 0xBF, 0x32, 0xBE, 0xFF, 0x4A, 0xE7, 0xDE, 0x08, 0x0E, 0x7A,
+    0xA6, 0x9A, 0x0B, 0x16, 0xB2, 0xB7, 0x80, 0xBB, 0x40, 0x9E, 0x2A, 0x2D, 0x43, 0x97, 0x90, 0xEF,
+    0x4C, 0x19, 0x9F, 0xEF, 0xB9, 0x7C, 0x93, 0x2F, 0x36, 0x10, 0xB2, 0xD9, 0x85, 0x9B, 0xDC, 0xA0,
+    0x57, 0xDB, 0x63, 0xE5, 0xA4, 0xF8, 0x15, 0xBD, 0xBE, 0x37, 0x26, 0x9A, 0x65, 0x5C, 0x6E, 0xB3,
+    0x8C, 0x30, 0x64, 0x98, 0x2B, 0xC9, 0xCF, 0xE4, 0x40, 0x9F, 0x89, 0x7A, 0xC5, 0x6E, 0x13, 0x31,
+    0x66, 0xD0, 0x03, 0xE2, 0xA3, 0x4A, 0x0A, 0x31, 0x8F, 0x88, 0x92, 0xF0, 0x09, 0x17, 0x5B, 0x49,
+    0xF8, 0x18, 0x9B, 0x8E, 0x36, 0x09, 0x1F, 0x61, 0x98, 0x4D, 0x12, 0x3E, 0x04, 0xD5, 0x49, 0xF8,
+    0x3D, 0x95, 0x24, 0x54, 0x31, 0x15, 0x4A, 0x39, 0xBC, 0x67, 0x5E, 0xA6, 0x8B, 0x85, 0x56, 0xF4,
+    0x34, 0x56, 0x27, 0xD6, 0x84, 0x3A, 0xFA, 0xFC, 0xC4, 0xED, 0x0F, 0x32, 0x4E, 0xB6, 0xBA, 0xBE,
+    0x74, 0x31, 0x99, 0xDF, 0x7C, 0x8A, 0x76, 0xDD, 0xE6, 0x32, 0x64, 0x64, 0xC5, 0x02, 0x95, 0x9A,
+    0xC1, 0x8E, 0x06, 0xC4, 0x00, 0x22, 0xD4, 0xA1, 0xA8, 0x46, 0xF2, 0x39, 0xE0, 0x67, 0xC0, 0x10,
+    0x93, 0x6E, 0x2C, 0x2D, 0xAF, 0x9A, 0x1D, 0x8D, 0x6D, 0xEC, 0x9B, 0x3D, 0x6D, 0x87, 0xF9, 0x79,
+    0x0C, 0xD3, 0x39, 0xC8, 0x4F, 0x88, 0x8B, 0x3D, 0xB5, 0xBA, 0x4A, 0xAB, 0x1D, 0xA4, 0xE7, 0x47,
+    0x65, 0xEE, 0xFD, 0x5C, 0xF6, 0x43, 0xA2, 0x2F, 0x94, 0xB3, 0x97, 0xE6, 0x9C, 0x74, 0xB1, 0xBB,
+    0x3B, 0xE5, 0xE9, 0xA4, 0x6B, 0x5A, 0x82, 0x89, 0xBA, 0x65, 0xED, 0x68, 0xA8, 0x73, 0x20, 0x56,
+    0x93, 0x26, 0xF1, 0x60, 0x26, 0x28, 0x23, 0xCB, 0xBD, 0x3C, 0x1C, 0xBB, 0xCA, 0x8D, 0x40, 0x24,
+    0x49, 0x69, 0x63, 0x59, 0xFA, 0xE5, 0x0C, 0x6E, 0x01, 0x57, 0xB0, 0x3B, 0xCF, 0xFF, 0x0D, 0x63,
+    0x60, 0x00, 0x02, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x25, 0x7E, 0x00, 0x00, 0xA5, 0x91, 0x31,
+    0x52, 0xC3, 0x30, 0x10, 0x45, 0xBF, 0xC3, 0x24, 0x2E, 0x5C, 0xB8, 0x21, 0x15, 0x45, 0x8E, 0xE0,
+    0x23, 0x48, 0x47, 0x70, 0x01, 0xD4, 0x5C, 0x83, 0x4A, 0x39, 0x02, 0x05, 0xF4, 0xD4, 0x6E, 0x38,
+    0x42, 0xAE, 0x90, 0x23, 0xA4, 0x4E, 0x43, 0x0A, 0x15, 0x9E, 0xC1, 0xD6, 0xE7, 0xAF, 0xE4, 0x0C,
+    0x50, 0xA3, 0x42, 0xEF, 0x8D, 0xEC, 0xBF, 0xAB, 0xB5, 0x51, 0x0D, 0xAF, 0xD0, 0x0A, 0xE4, 0x0B,
+    0xB0, 0x22, 0x39, 0x01, 0x8D, 0x40, 0xA0, 0xE5, 0x97, 0xA1, 0xA3, 0x0C, 0x70, 0x13, 0x6A, 0xC3,
+    0xF8, 0x83, 0xB7, 0x5E, 0xE8, 0xC8, 0x8B, 0xC0, 0x3F, 0xF8, 0xE0, 0xF9, 0xFD, 0xF7, 0x9B, 0xFF,
+    0x84, 0x2F, 0x38, 0x3E, 0x09, 0x37, 0xA5, 0xC3, 0xAA, 0x00, 0x0B, 0x3A, 0x9E, 0x6C, 0x8C, 0xEA,
+    0xDE, 0xF6, 0xCD, 0xD0, 0x23, 0xAF, 0x03, 0x53, 0xA6, 0x32, 0xE5, 0x79, 0x2B, 0x19, 0x4D, 0x76,
+    0xFC, 0xB4, 0x49, 0x15, 0x1C, 0x11, 0xB2, 0xB8, 0x8B, 0x8D, 0x68, 0x27, 0x8B, 0xDC, 0x31, 0xC2,
+    0xCD, 0x0F, 0x16, 0x4E, 0x95, 0x72, 0x5E, 0xE1, 0x54, 0x9B, 0x38, 0x72, 0x6E, 0xB2, 0xCC, 0x8F,
+    0xD3, 0xE6, 0x90, 0x06, 0x1F, 0x22, 0x6E, 0x73, 0x2A, 0x58, 0x75, 0x13, 0xA7, 0x4B, 0x2F, 0x12,
+    0x8B, 0x28, 0xBE, 0xCF, 0xA2, 0x82, 0xB1, 0xB4, 0x08, 0xBA, 0x43, 0x16, 0x95, 0x5D, 0xBA, 0x87,
+    0xAB, 0x34, 0x57, 0xA9, 0x8B, 0x3C, 0xDB, 0x49, 0x97, 0x2A, 0x1F, 0x92, 0xA6, 0xDA, 0xA9, 0x58,
+    0xB0, 0x9F, 0xD5, 0x16, 0x89, 0x56, 0x62, 0x6F, 0xA7, 0xD0, 0x5D, 0x3D, 0xB6, 0xF6, 0x05, 0xD6,
+    0x3D, 0xBE, 0x01, 0x4D, 0x8F, 0xBD, 0x0D, 0xC2, 0x30, 0x14, 0x84, 0x2F, 0x76, 0x91, 0x82, 0x82,
+    0x11, 0xCC, 0x06, 0x1E, 0x01, 0x31, 0x07, 0x8B, 0xD0, 0x25, 0xE3, 0x20, 0xB1, 0x02, 0x22, 0xD9,
+    0x84, 0xF4, 0x34, 0x94, 0x2E, 0x12, 0x1F, 0xF7, 0x6C, 0x47, 0xC2, 0xF2, 0xCF, 0xE7, 0xA7, 0xEF,
+    0x9D, 0x6C, 0xE0, 0x6F, 0xDC, 0xDA, 0xD9, 0xE5, 0x06, 0x3D, 0xC7, 0x0A, 0x81, 0x4B, 0x85, 0x81,
+    0xA9, 0x2A, 0x64, 0x6E, 0xCA, 0xA7, 0x4A, 0x61, 0x41, 0x2C, 0xD2, 0x00, 0xF8, 0x54, 0x94, 0x96,
+    0xD4, 0xF3, 0x72, 0x87, 0x49, 0x81, 0xEF, 0x0C, 0x4B, 0x1A, 0x48, 0x42, 0x49, 0x4A, 0x51, 0x8C,
+    0x66, 0x2F, 0x58, 0x75, 0x1B, 0x83, 0x60, 0xF1, 0x5A, 0x67, 0xC1, 0x78, 0x24, 0x53, 0x34, 0x57,
+    0x0D, 0xDF, 0x03, 0xB9, 0x59, 0xC3, 0xEC, 0xE4, 0x7A, 0xAB, 0x62, 0x2A, 0xB0, 0x02, 0x91, 0xF9,
+    0x21, 0x05, 0x90, 0x64, 0x0A, 0xE0, 0x0A, 0xD8, 0x7B, 0xA6, 0xCD, 0x9B, 0x22, 0x29, 0x75, 0xA6,
+    0x48, 0x12, 0xCC, 0x06, 0x6E, 0x75, 0xAC, 0xFF, 0x7A, 0x5D, 0xD7, 0x0A, 0xB1, 0x2A, 0x96, 0x34,
+    0x57, 0xD8, 0x15, 0xE0, 0xB9, 0xC3, 0xC9, 0xB6, 0x1F,
 };
 
 static const EpdGlyph notosans_18_boldGlyphs[] = {
@@ -2794,99 +2801,99 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 0, 0, 156, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 156, 0, 0, 0, 0 }, // U+0020
     { 7, 28, 169, 2, 27, 49, 0 }, // !
-    { 14, 10, 287, 2, 27, 35, 49 }, // "
-    { 24, 27, 388, 0, 27, 162, 84 }, // #
-    { 19, 32, 343, 1, 29, 152, 246 }, // $
-    { 32, 29, 541, 1, 28, 232, 398 }, // %
-    { 28, 29, 450, 1, 28, 203, 630 }, // &
-    { 6, 10, 160, 2, 27, 15, 833 }, // '
-    { 11, 33, 203, 1, 27, 91, 848 }, // (
-    { 11, 33, 203, 1, 27, 91, 939 }, // )
-    { 19, 19, 325, 1, 29, 91, 1030 }, // *
-    { 19, 19, 343, 1, 23, 91, 1121 }, // +
-    { 8, 10, 171, 1, 5, 20, 1212 }, // ,
-    { 10, 6, 192, 1, 13, 15, 1232 }, // -
-    { 7, 7, 169, 2, 6, 13, 1247 }, // .
-    { 16, 28, 249, 0, 27, 112, 1260 }, // /
-    { 20, 29, 362, 1, 28, 145, 1372 }, // 0
-    { 14, 27, 310, 0, 27, 95, 1517 }, // 1
-    { 20, 28, 335, 1, 28, 140, 1612 }, // 2
-    { 19, 29, 343, 1, 28, 138, 1752 }, // 3
-    { 21, 27, 349, 0, 27, 142, 1890 }, // 4
-    { 19, 28, 347, 1, 27, 133, 2032 }, // 5
-    { 20, 29, 361, 1, 28, 145, 2165 }, // 6
-    { 20, 27, 320, 0, 27, 135, 2310 }, // 7
-    { 20, 29, 357, 1, 28, 145, 2445 }, // 8
-    { 20, 29, 361, 1, 28, 145, 2590 }, // 9
-    { 7, 22, 169, 2, 21, 39, 2735 }, // :
-    { 8, 26, 171, 1, 21, 52, 2774 }, // ;
-    { 19, 21, 343, 1, 24, 100, 2826 }, // <
-    { 19, 12, 343, 1, 19, 57, 2926 }, // =
-    { 19, 21, 343, 1, 24, 100, 2983 }, // >
-    { 18, 29, 286, 0, 28, 131, 3083 }, // ?
-    { 31, 30, 539, 1, 27, 233, 3214 }, // @
-    { 26, 27, 415, 0, 27, 176, 3447 }, // A
-    { 21, 27, 399, 3, 27, 142, 3623 }, // B
-    { 21, 29, 385, 2, 28, 153, 3765 }, // C
-    { 23, 27, 439, 3, 27, 156, 3918 }, // D
-    { 16, 27, 336, 3, 27, 108, 4074 }, // E
-    { 16, 27, 329, 3, 27, 108, 4182 }, // F
-    { 23, 29, 434, 2, 28, 167, 4290 }, // G
-    { 23, 27, 459, 3, 27, 156, 4457 }, // H
-    { 13, 27, 233, 1, 27, 88, 4613 }, // I
-    { 13, 35, 199, -3, 27, 114, 4701 }, // J
-    { 22, 27, 398, 3, 27, 149, 4815 }, // K
-    { 17, 27, 335, 3, 27, 115, 4964 }, // L
-    { 29, 27, 566, 3, 27, 196, 5079 }, // M
-    { 25, 27, 488, 3, 27, 169, 5275 }, // N
-    { 26, 29, 475, 2, 28, 189, 5444 }, // O
-    { 19, 27, 373, 3, 27, 129, 5633 }, // P
-    { 26, 35, 475, 2, 28, 228, 5762 }, // Q
-    { 22, 27, 394, 3, 27, 149, 5990 }, // R
-    { 19, 29, 331, 1, 28, 138, 6139 }, // S
-    { 21, 27, 346, 0, 27, 142, 6277 }, // T
-    { 23, 28, 454, 3, 27, 161, 6419 }, // U
-    { 25, 27, 390, 0, 27, 169, 6580 }, // V
-    { 37, 27, 580, 0, 27, 250, 6749 }, // W
-    { 25, 27, 402, 0, 27, 169, 6999 }, // X
-    { 24, 27, 376, 0, 27, 162, 7168 }, // Y
-    { 21, 27, 347, 0, 27, 142, 7330 }, // Z
-    { 10, 33, 199, 2, 27, 83, 7472 }, // [
-    { 16, 28, 249, 0, 27, 112, 7555 }, // <backslash>
-    { 10, 33, 199, 0, 27, 83, 7667 }, // ]
-    { 21, 18, 343, 0, 27, 95, 7750 }, // ^
-    { 17, 3, 247, -1, -3, 13, 7845 }, // _
-    { 12, 7, 219, 1, 29, 21, 7858 }, // `
-    { 19, 22, 359, 1, 21, 105, 7879 }, // a
-    { 20, 30, 379, 2, 29, 150, 7984 }, // b
-    { 18, 22, 310, 1, 21, 99, 8134 }, // c
-    { 20, 30, 379, 1, 29, 150, 8233 }, // d
-    { 20, 22, 358, 1, 21, 110, 8383 }, // e
-    { 17, 29, 232, 0, 29, 124, 8493 }, // f
-    { 20, 30, 379, 1, 21, 150, 8617 }, // g
-    { 20, 29, 390, 2, 29, 145, 8767 }, // h
-    { 7, 29, 179, 2, 29, 51, 8912 }, // i
-    { 11, 38, 179, -2, 29, 105, 8963 }, // j
-    { 22, 29, 372, 2, 29, 160, 9068 }, // k
-    { 7, 29, 179, 2, 29, 51, 9228 }, // l
-    { 32, 21, 585, 2, 21, 168, 9279 }, // m
-    { 20, 21, 390, 2, 21, 105, 9447 }, // n
-    { 21, 22, 375, 1, 21, 116, 9552 }, // o
-    { 20, 30, 379, 2, 21, 150, 9668 }, // p
-    { 20, 30, 379, 1, 21, 150, 9818 }, // q
-    { 15, 21, 268, 2, 21, 79, 9968 }, // r
-    { 17, 22, 301, 1, 21, 94, 10047 }, // s
-    { 16, 26, 260, 0, 25, 104, 10141 }, // t
-    { 20, 22, 390, 2, 21, 110, 10245 }, // u
-    { 22, 21, 343, 0, 21, 116, 10355 }, // v
-    { 32, 21, 514, 0, 21, 168, 10471 }, // w
-    { 22, 21, 347, 0, 21, 116, 10639 }, // x
-    { 22, 30, 343, 0, 21, 165, 10755 }, // y
-    { 17, 21, 296, 1, 21, 90, 10920 }, // z
-    { 14, 33, 236, 0, 27, 116, 11010 }, // {
-    { 5, 38, 331, 8, 29, 48, 11126 }, // |
-    { 14, 33, 236, 1, 27, 116, 11174 }, // }
-    { 19, 7, 343, 1, 17, 34, 11290 }, // ~
+    { 14, 10, 287, 2, 27, 35, 0 }, // "
+    { 24, 27, 388, 0, 27, 162, 35 }, // #
+    { 19, 32, 343, 1, 29, 152, 197 }, // $
+    { 32, 29, 541, 1, 28, 232, 349 }, // %
+    { 28, 29, 450, 1, 28, 203, 581 }, // &
+    { 6, 10, 160, 2, 27, 15, 784 }, // '
+    { 11, 33, 203, 1, 27, 91, 49 }, // (
+    { 11, 33, 203, 1, 27, 91, 140 }, // )
+    { 19, 19, 325, 1, 29, 91, 799 }, // *
+    { 19, 19, 343, 1, 23, 91, 890 }, // +
+    { 8, 10, 171, 1, 5, 20, 231 }, // ,
+    { 10, 6, 192, 1, 13, 15, 251 }, // -
+    { 7, 7, 169, 2, 6, 13, 266 }, // .
+    { 16, 28, 249, 0, 27, 112, 981 }, // /
+    { 20, 29, 362, 1, 28, 145, 279 }, // 0
+    { 14, 27, 310, 0, 27, 95, 424 }, // 1
+    { 20, 28, 335, 1, 28, 140, 519 }, // 2
+    { 19, 29, 343, 1, 28, 138, 659 }, // 3
+    { 21, 27, 349, 0, 27, 142, 797 }, // 4
+    { 19, 28, 347, 1, 27, 133, 939 }, // 5
+    { 20, 29, 361, 1, 28, 145, 1072 }, // 6
+    { 20, 27, 320, 0, 27, 135, 1217 }, // 7
+    { 20, 29, 357, 1, 28, 145, 1352 }, // 8
+    { 20, 29, 361, 1, 28, 145, 1497 }, // 9
+    { 7, 22, 169, 2, 21, 39, 1642 }, // :
+    { 8, 26, 171, 1, 21, 52, 1681 }, // ;
+    { 19, 21, 343, 1, 24, 100, 1093 }, // <
+    { 19, 12, 343, 1, 19, 57, 1193 }, // =
+    { 19, 21, 343, 1, 24, 100, 1250 }, // >
+    { 18, 29, 286, 0, 28, 131, 1733 }, // ?
+    { 31, 30, 539, 1, 27, 233, 1350 }, // @
+    { 26, 27, 415, 0, 27, 176, 1864 }, // A
+    { 21, 27, 399, 3, 27, 142, 2040 }, // B
+    { 21, 29, 385, 2, 28, 153, 2182 }, // C
+    { 23, 27, 439, 3, 27, 156, 2335 }, // D
+    { 16, 27, 336, 3, 27, 108, 2491 }, // E
+    { 16, 27, 329, 3, 27, 108, 2599 }, // F
+    { 23, 29, 434, 2, 28, 167, 2707 }, // G
+    { 23, 27, 459, 3, 27, 156, 2874 }, // H
+    { 13, 27, 233, 1, 27, 88, 3030 }, // I
+    { 13, 35, 199, -3, 27, 114, 3118 }, // J
+    { 22, 27, 398, 3, 27, 149, 3232 }, // K
+    { 17, 27, 335, 3, 27, 115, 3381 }, // L
+    { 29, 27, 566, 3, 27, 196, 3496 }, // M
+    { 25, 27, 488, 3, 27, 169, 3692 }, // N
+    { 26, 29, 475, 2, 28, 189, 3861 }, // O
+    { 19, 27, 373, 3, 27, 129, 4050 }, // P
+    { 26, 35, 475, 2, 28, 228, 4179 }, // Q
+    { 22, 27, 394, 3, 27, 149, 4407 }, // R
+    { 19, 29, 331, 1, 28, 138, 4556 }, // S
+    { 21, 27, 346, 0, 27, 142, 4694 }, // T
+    { 23, 28, 454, 3, 27, 161, 1583 }, // U
+    { 25, 27, 390, 0, 27, 169, 4836 }, // V
+    { 37, 27, 580, 0, 27, 250, 5005 }, // W
+    { 25, 27, 402, 0, 27, 169, 5255 }, // X
+    { 24, 27, 376, 0, 27, 162, 5424 }, // Y
+    { 21, 27, 347, 0, 27, 142, 5586 }, // Z
+    { 10, 33, 199, 2, 27, 83, 1744 }, // [
+    { 16, 28, 249, 0, 27, 112, 1827 }, // <backslash>
+    { 10, 33, 199, 0, 27, 83, 1939 }, // ]
+    { 21, 18, 343, 0, 27, 95, 2022 }, // ^
+    { 17, 3, 247, -1, -3, 13, 2117 }, // _
+    { 12, 7, 219, 1, 29, 21, 2130 }, // `
+    { 19, 22, 359, 1, 21, 105, 5728 }, // a
+    { 20, 30, 379, 2, 29, 150, 5833 }, // b
+    { 18, 22, 310, 1, 21, 99, 5983 }, // c
+    { 20, 30, 379, 1, 29, 150, 6082 }, // d
+    { 20, 22, 358, 1, 21, 110, 6232 }, // e
+    { 17, 29, 232, 0, 29, 124, 6342 }, // f
+    { 20, 30, 379, 1, 21, 150, 6466 }, // g
+    { 20, 29, 390, 2, 29, 145, 6616 }, // h
+    { 7, 29, 179, 2, 29, 51, 6761 }, // i
+    { 11, 38, 179, -2, 29, 105, 6812 }, // j
+    { 22, 29, 372, 2, 29, 160, 6917 }, // k
+    { 7, 29, 179, 2, 29, 51, 7077 }, // l
+    { 32, 21, 585, 2, 21, 168, 7128 }, // m
+    { 20, 21, 390, 2, 21, 105, 7296 }, // n
+    { 21, 22, 375, 1, 21, 116, 7401 }, // o
+    { 20, 30, 379, 2, 21, 150, 7517 }, // p
+    { 20, 30, 379, 1, 21, 150, 7667 }, // q
+    { 15, 21, 268, 2, 21, 79, 7817 }, // r
+    { 17, 22, 301, 1, 21, 94, 7896 }, // s
+    { 16, 26, 260, 0, 25, 104, 7990 }, // t
+    { 20, 22, 390, 2, 21, 110, 8094 }, // u
+    { 22, 21, 343, 0, 21, 116, 8204 }, // v
+    { 32, 21, 514, 0, 21, 168, 8320 }, // w
+    { 22, 21, 347, 0, 21, 116, 8488 }, // x
+    { 22, 30, 343, 0, 21, 165, 8604 }, // y
+    { 17, 21, 296, 1, 21, 90, 8769 }, // z
+    { 14, 33, 236, 0, 27, 116, 2151 }, // {
+    { 5, 38, 331, 8, 29, 48, 2267 }, // |
+    { 14, 33, 236, 1, 27, 116, 2315 }, // }
+    { 19, 7, 343, 1, 17, 34, 2431 }, // ~
     { 0, 0, 156, 0, 0, 0, 0 }, // U+00A0
     { 7, 28, 172, 2, 21, 49, 0 }, // U+00A1
     { 18, 29, 343, 2, 28, 131, 49 }, // U+00A2
@@ -2970,19 +2977,19 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 21, 30, 376, 1, 29, 158, 11259 }, // U+00F0
     { 20, 29, 390, 2, 29, 145, 11417 }, // U+00F1
     { 21, 30, 375, 1, 29, 158, 11562 }, // U+00F2
-    { 21, 30, 375, 1, 29, 158, 11720 }, // U+00F3
-    { 21, 30, 375, 1, 29, 158, 11878 }, // U+00F4
-    { 21, 30, 375, 1, 29, 158, 12036 }, // U+00F5
-    { 21, 30, 375, 1, 29, 158, 12194 }, // U+00F6
-    { 19, 19, 343, 1, 23, 91, 12352 }, // U+00F7
-    { 21, 24, 371, 1, 22, 126, 12443 }, // U+00F8
-    { 20, 30, 390, 2, 29, 150, 12569 }, // U+00F9
-    { 20, 30, 390, 2, 29, 150, 12719 }, // U+00FA
-    { 20, 30, 390, 2, 29, 150, 12869 }, // U+00FB
-    { 20, 30, 390, 2, 29, 150, 13019 }, // U+00FC
-    { 22, 38, 343, 0, 29, 209, 13169 }, // U+00FD
-    { 20, 38, 379, 2, 29, 190, 13378 }, // U+00FE
-    { 22, 38, 343, 0, 29, 209, 13568 }, // U+00FF
+    { 21, 30, 375, 1, 29, 158, 8859 }, // U+00F3
+    { 21, 30, 375, 1, 29, 158, 11720 }, // U+00F4
+    { 21, 30, 375, 1, 29, 158, 11878 }, // U+00F5
+    { 21, 30, 375, 1, 29, 158, 12036 }, // U+00F6
+    { 19, 19, 343, 1, 23, 91, 12194 }, // U+00F7
+    { 21, 24, 371, 1, 22, 126, 12285 }, // U+00F8
+    { 20, 30, 390, 2, 29, 150, 12411 }, // U+00F9
+    { 20, 30, 390, 2, 29, 150, 12561 }, // U+00FA
+    { 20, 30, 390, 2, 29, 150, 12711 }, // U+00FB
+    { 20, 30, 390, 2, 29, 150, 12861 }, // U+00FC
+    { 22, 38, 343, 0, 29, 209, 13011 }, // U+00FD
+    { 20, 38, 379, 2, 29, 190, 13220 }, // U+00FE
+    { 22, 38, 343, 0, 29, 209, 13410 }, // U+00FF
     { 26, 33, 415, 0, 33, 215, 0 }, // U+0100
     { 19, 28, 359, 1, 27, 133, 215 }, // U+0101
     { 26, 35, 415, 0, 35, 228, 348 }, // U+0102
@@ -3684,98 +3691,98 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 10, 6, 192, 1, 13, 15, 140 }, // U+2010
     { 10, 6, 192, 1, 13, 15, 155 }, // U+2011
     { 20, 5, 346, 1, 16, 25, 170 }, // U+2012
-    { 17, 6, 300, 1, 13, 26, 195 }, // U+2013
-    { 36, 6, 600, 1, 13, 54, 221 }, // U+2014
-    { 36, 6, 600, 1, 13, 54, 275 }, // U+2015
-    { 15, 38, 331, 3, 29, 143, 329 }, // U+2016
-    { 17, 9, 247, -1, 0, 39, 472 }, // U+2017
-    { 8, 10, 130, 0, 27, 20, 511 }, // U+2018
-    { 8, 10, 130, 0, 27, 20, 531 }, // U+2019
-    { 9, 10, 172, 0, 5, 23, 551 }, // U+201A
-    { 8, 10, 130, 0, 27, 20, 574 }, // U+201B
-    { 17, 10, 267, 0, 27, 43, 594 }, // U+201C
-    { 17, 10, 267, 0, 27, 43, 637 }, // U+201D
-    { 16, 10, 308, 1, 5, 40, 680 }, // U+201E
-    { 17, 10, 267, 0, 27, 43, 720 }, // U+201F
-    { 16, 29, 308, 2, 29, 116, 763 }, // U+2020
-    { 16, 29, 311, 2, 29, 116, 879 }, // U+2021
-    { 12, 13, 226, 1, 20, 39, 995 }, // U+2022
-    { 12, 15, 226, 2, 21, 45, 1034 }, // U+2023
-    { 7, 7, 300, 6, 6, 13, 1079 }, // U+2024
-    { 18, 7, 345, 2, 6, 32, 1092 }, // U+2025
-    { 28, 7, 513, 2, 6, 49, 1124 }, // U+2026
-    { 7, 7, 169, 2, 13, 13, 1173 }, // U+2027
-    { 0, 0, 360, 0, 0, 0, 1186 }, // U+2028
-    { 0, 0, 360, 0, 0, 0, 1186 }, // U+2029
-    { 9, 28, 0, -1, 23, 63, 1186 }, // U+202A
-    { 9, 28, 0, -8, 23, 63, 1249 }, // U+202B
-    { 10, 31, 0, -5, 26, 78, 1312 }, // U+202C
-    { 10, 31, 0, -5, 26, 78, 1390 }, // U+202D
-    { 10, 31, 0, -5, 26, 78, 1468 }, // U+202E
-    { 0, 0, 100, 0, 0, 0, 1546 }, // U+202F
-    { 46, 29, 768, 1, 28, 334, 1546 }, // U+2030
-    { 61, 29, 1000, 1, 28, 443, 1880 }, // U+2031
-    { 11, 10, 182, 1, 27, 28, 2323 }, // U+2032
-    { 19, 10, 314, 1, 27, 48, 2351 }, // U+2033
-    { 28, 10, 447, 1, 27, 70, 2399 }, // U+2034
-    { 11, 10, 253, 1, 27, 28, 2469 }, // U+2035
-    { 20, 10, 386, 1, 27, 50, 2497 }, // U+2036
-    { 28, 10, 518, 1, 27, 70, 2547 }, // U+2037
-    { 15, 13, 245, 0, 4, 49, 2617 }, // U+2038
-    { 12, 18, 219, 1, 19, 54, 2666 }, // U+2039
-    { 12, 18, 219, 1, 19, 54, 2720 }, // U+203A
-    { 29, 29, 510, 1, 28, 211, 2774 }, // U+203B
-    { 18, 28, 342, 2, 27, 126, 2985 }, // U+203C
-    { 17, 29, 286, 0, 28, 124, 3111 }, // U+203D
-    { 20, 5, 300, -1, 33, 25, 3235 }, // U+203E
-    { 23, 9, 365, 0, 0, 52, 3260 }, // U+203F
-    { 23, 9, 365, 0, 30, 52, 3312 }, // U+2040
-    { 16, 25, 254, 0, 16, 100, 3364 }, // U+2041
-    { 42, 35, 671, 0, 29, 368, 3464 }, // U+2042
-    { 11, 6, 192, 1, 13, 17, 3832 }, // U+2043
-    { 21, 27, 78, -8, 27, 142, 3849 }, // U+2044
-    { 10, 33, 199, 2, 27, 83, 3991 }, // U+2045
-    { 10, 33, 199, 0, 27, 83, 4074 }, // U+2046
-    { 35, 29, 569, 0, 28, 254, 4157 }, // U+2047
-    { 27, 29, 458, 0, 28, 196, 4411 }, // U+2048
-    { 26, 29, 458, 2, 28, 189, 4607 }, // U+2049
-    { 19, 21, 353, 1, 21, 100, 4796 }, // U+204A
-    { 21, 34, 389, 2, 29, 179, 4896 }, // U+204B
-    { 21, 20, 393, 1, 21, 105, 5075 }, // U+204C
-    { 20, 20, 393, 3, 21, 100, 5180 }, // U+204D
-    { 19, 19, 325, 1, 10, 91, 5280 }, // U+204E
-    { 8, 26, 171, 2, 21, 52, 5371 }, // U+204F
-    { 23, 39, 360, 0, 30, 225, 5423 }, // U+2050
-    { 19, 38, 325, 1, 29, 181, 5648 }, // U+2051
-    { 16, 29, 253, 0, 28, 116, 5829 }, // U+2052
-    { 36, 8, 600, 1, 15, 72, 5945 }, // U+2053
-    { 23, 9, 360, 0, 0, 52, 6017 }, // U+2054
-    { 19, 19, 336, 1, 19, 91, 6069 }, // U+2055
-    { 18, 29, 347, 2, 28, 131, 6160 }, // U+2056
-    { 35, 10, 561, 1, 27, 88, 6291 }, // U+2057
-    { 29, 29, 524, 2, 28, 211, 6379 }, // U+2058
-    { 29, 29, 524, 2, 28, 211, 6590 }, // U+2059
-    { 7, 29, 171, 2, 28, 51, 6801 }, // U+205A
-    { 22, 31, 416, 2, 30, 171, 6852 }, // U+205B
-    { 30, 30, 512, 1, 28, 225, 7023 }, // U+205C
-    { 7, 30, 169, 2, 29, 53, 7248 }, // U+205D
-    { 7, 29, 171, 2, 28, 51, 7301 }, // U+205E
-    { 0, 0, 133, 0, 0, 0, 7352 }, // U+205F
-    { 0, 0, 360, 0, 0, 0, 7352 }, // U+2060
-    { 0, 0, 360, 0, 0, 0, 7352 }, // U+2061
-    { 0, 0, 360, 0, 0, 0, 7352 }, // U+2062
-    { 0, 0, 360, 0, 0, 0, 7352 }, // U+2063
-    { 0, 0, 360, 0, 0, 0, 7352 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 7352 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 7352 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 7352 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 7352 }, // U+2069
-    { 10, 31, 0, -5, 26, 78, 7352 }, // U+206A
-    { 10, 31, 0, -5, 26, 78, 7430 }, // U+206B
-    { 10, 31, 0, -5, 26, 78, 7508 }, // U+206C
-    { 10, 31, 0, -5, 26, 78, 7586 }, // U+206D
-    { 10, 31, 0, -5, 26, 78, 7664 }, // U+206E
-    { 10, 31, 0, -5, 26, 78, 7742 }, // U+206F
+    { 17, 6, 300, 1, 13, 26, 9017 }, // U+2013
+    { 36, 6, 600, 1, 13, 54, 9043 }, // U+2014
+    { 36, 6, 600, 1, 13, 54, 195 }, // U+2015
+    { 15, 38, 331, 3, 29, 143, 249 }, // U+2016
+    { 17, 9, 247, -1, 0, 39, 392 }, // U+2017
+    { 8, 10, 130, 0, 27, 20, 431 }, // U+2018
+    { 8, 10, 130, 0, 27, 20, 9097 }, // U+2019
+    { 9, 10, 172, 0, 5, 23, 451 }, // U+201A
+    { 8, 10, 130, 0, 27, 20, 474 }, // U+201B
+    { 17, 10, 267, 0, 27, 43, 9117 }, // U+201C
+    { 17, 10, 267, 0, 27, 43, 9160 }, // U+201D
+    { 16, 10, 308, 1, 5, 40, 494 }, // U+201E
+    { 17, 10, 267, 0, 27, 43, 534 }, // U+201F
+    { 16, 29, 308, 2, 29, 116, 577 }, // U+2020
+    { 16, 29, 311, 2, 29, 116, 693 }, // U+2021
+    { 12, 13, 226, 1, 20, 39, 809 }, // U+2022
+    { 12, 15, 226, 2, 21, 45, 848 }, // U+2023
+    { 7, 7, 300, 6, 6, 13, 893 }, // U+2024
+    { 18, 7, 345, 2, 6, 32, 906 }, // U+2025
+    { 28, 7, 513, 2, 6, 49, 9203 }, // U+2026
+    { 7, 7, 169, 2, 13, 13, 938 }, // U+2027
+    { 0, 0, 360, 0, 0, 0, 951 }, // U+2028
+    { 0, 0, 360, 0, 0, 0, 951 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 951 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 1014 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 1077 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 1155 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 1233 }, // U+202E
+    { 0, 0, 100, 0, 0, 0, 1311 }, // U+202F
+    { 46, 29, 768, 1, 28, 334, 1311 }, // U+2030
+    { 61, 29, 1000, 1, 28, 443, 1645 }, // U+2031
+    { 11, 10, 182, 1, 27, 28, 2088 }, // U+2032
+    { 19, 10, 314, 1, 27, 48, 2116 }, // U+2033
+    { 28, 10, 447, 1, 27, 70, 2164 }, // U+2034
+    { 11, 10, 253, 1, 27, 28, 2234 }, // U+2035
+    { 20, 10, 386, 1, 27, 50, 2262 }, // U+2036
+    { 28, 10, 518, 1, 27, 70, 2312 }, // U+2037
+    { 15, 13, 245, 0, 4, 49, 2382 }, // U+2038
+    { 12, 18, 219, 1, 19, 54, 2431 }, // U+2039
+    { 12, 18, 219, 1, 19, 54, 2485 }, // U+203A
+    { 29, 29, 510, 1, 28, 211, 2539 }, // U+203B
+    { 18, 28, 342, 2, 27, 126, 2750 }, // U+203C
+    { 17, 29, 286, 0, 28, 124, 2876 }, // U+203D
+    { 20, 5, 300, -1, 33, 25, 3000 }, // U+203E
+    { 23, 9, 365, 0, 0, 52, 3025 }, // U+203F
+    { 23, 9, 365, 0, 30, 52, 3077 }, // U+2040
+    { 16, 25, 254, 0, 16, 100, 3129 }, // U+2041
+    { 42, 35, 671, 0, 29, 368, 3229 }, // U+2042
+    { 11, 6, 192, 1, 13, 17, 3597 }, // U+2043
+    { 21, 27, 78, -8, 27, 142, 3614 }, // U+2044
+    { 10, 33, 199, 2, 27, 83, 3756 }, // U+2045
+    { 10, 33, 199, 0, 27, 83, 3839 }, // U+2046
+    { 35, 29, 569, 0, 28, 254, 3922 }, // U+2047
+    { 27, 29, 458, 0, 28, 196, 4176 }, // U+2048
+    { 26, 29, 458, 2, 28, 189, 4372 }, // U+2049
+    { 19, 21, 353, 1, 21, 100, 4561 }, // U+204A
+    { 21, 34, 389, 2, 29, 179, 4661 }, // U+204B
+    { 21, 20, 393, 1, 21, 105, 4840 }, // U+204C
+    { 20, 20, 393, 3, 21, 100, 4945 }, // U+204D
+    { 19, 19, 325, 1, 10, 91, 5045 }, // U+204E
+    { 8, 26, 171, 2, 21, 52, 5136 }, // U+204F
+    { 23, 39, 360, 0, 30, 225, 5188 }, // U+2050
+    { 19, 38, 325, 1, 29, 181, 5413 }, // U+2051
+    { 16, 29, 253, 0, 28, 116, 5594 }, // U+2052
+    { 36, 8, 600, 1, 15, 72, 5710 }, // U+2053
+    { 23, 9, 360, 0, 0, 52, 5782 }, // U+2054
+    { 19, 19, 336, 1, 19, 91, 5834 }, // U+2055
+    { 18, 29, 347, 2, 28, 131, 5925 }, // U+2056
+    { 35, 10, 561, 1, 27, 88, 6056 }, // U+2057
+    { 29, 29, 524, 2, 28, 211, 6144 }, // U+2058
+    { 29, 29, 524, 2, 28, 211, 6355 }, // U+2059
+    { 7, 29, 171, 2, 28, 51, 6566 }, // U+205A
+    { 22, 31, 416, 2, 30, 171, 6617 }, // U+205B
+    { 30, 30, 512, 1, 28, 225, 6788 }, // U+205C
+    { 7, 30, 169, 2, 29, 53, 7013 }, // U+205D
+    { 7, 29, 171, 2, 28, 51, 7066 }, // U+205E
+    { 0, 0, 133, 0, 0, 0, 7117 }, // U+205F
+    { 0, 0, 360, 0, 0, 0, 7117 }, // U+2060
+    { 0, 0, 360, 0, 0, 0, 7117 }, // U+2061
+    { 0, 0, 360, 0, 0, 0, 7117 }, // U+2062
+    { 0, 0, 360, 0, 0, 0, 7117 }, // U+2063
+    { 0, 0, 360, 0, 0, 0, 7117 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 7117 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 7117 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 7117 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 7117 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 7117 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 7195 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 7273 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 7351 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 7429 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 7507 }, // U+206F
     { 14, 18, 227, 0, 33, 63, 0 }, // U+2070
     { 5, 18, 116, 1, 28, 23, 63 }, // U+2071
     { 14, 17, 228, 0, 32, 60, 86 }, // U+2074
@@ -3852,13 +3859,13 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 18, 35, 343, 3, 31, 158, 5501 }, // U+20BF
     { 18, 28, 314, 1, 21, 126, 5659 }, // U+20C0
     { 19, 5, 349, 1, 16, 24, 0 }, // U+2212
-    { 31, 29, 463, 0, 29, 225, 0 }, // U+FB00
-    { 24, 29, 411, 0, 29, 174, 225 }, // U+FB01
-    { 23, 29, 415, 0, 29, 167, 399 }, // U+FB02
-    { 38, 29, 643, 0, 29, 276, 566 }, // U+FB03
-    { 38, 29, 647, 0, 29, 276, 842 }, // U+FB04
-    { 27, 30, 469, 2, 29, 203, 1118 }, // U+FB05
-    { 33, 30, 559, 1, 29, 248, 1321 }, // U+FB06
+    { 31, 29, 463, 0, 29, 225, 9252 }, // U+FB00
+    { 24, 29, 411, 0, 29, 174, 9477 }, // U+FB01
+    { 23, 29, 415, 0, 29, 167, 9651 }, // U+FB02
+    { 38, 29, 643, 0, 29, 276, 9818 }, // U+FB03
+    { 38, 29, 647, 0, 29, 276, 10094 }, // U+FB04
+    { 27, 30, 469, 2, 29, 203, 0 }, // U+FB05
+    { 33, 30, 559, 1, 29, 248, 203 }, // U+FB06
     { 35, 35, 600, 1, 29, 307, 0 }, // U+FFFD
 };
 
@@ -3866,8 +3873,7 @@ static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3875,8 +3881,7 @@ static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3886,19 +3891,57 @@ static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
 };
 
 static const EpdFontGroup notosans_18_boldGroups[] = {
-    { 0, 4492, 12088, 97, 0 },
-    { 4492, 4022, 14675, 96, 97 },
-    { 8514, 5146, 22593, 128, 193 },
-    { 13660, 5038, 20466, 96, 321 },
-    { 18698, 1726, 3246, 112, 417 },
-    { 20424, 13471, 47739, 256, 529 },
-    { 33895, 3486, 19555, 90, 785 },
-    { 37381, 2995, 8485, 111, 875 },
-    { 40376, 855, 2288, 42, 986 },
-    { 41231, 2578, 6230, 33, 1028 },
-    { 43809, 14, 25, 1, 1061 },
-    { 43823, 456, 1640, 7, 1062 },
-    { 44279, 166, 315, 1, 1069 },
+    { 0, 3844, 11055, 83, 2 },
+    { 3844, 1098, 2626, 26, 0 },
+    { 4942, 4006, 14495, 95, 97 },
+    { 8948, 5146, 22593, 128, 193 },
+    { 14094, 5038, 20466, 96, 321 },
+    { 19132, 1726, 3246, 112, 417 },
+    { 20858, 13471, 47739, 256, 529 },
+    { 34329, 3486, 19555, 90, 785 },
+    { 37815, 2895, 8232, 105, 875 },
+    { 40710, 855, 2288, 42, 986 },
+    { 41565, 2578, 6230, 33, 1028 },
+    { 44143, 14, 25, 1, 1061 },
+    { 44157, 230, 480, 2, 1067 },
+    { 44387, 166, 315, 1, 1069 },
+};
+
+static const uint16_t notosans_18_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_18_boldKernLeftClasses[] = {
@@ -4958,18 +5001,81 @@ static const EpdLigaturePair notosans_18_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_18_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 70, 49 }, { 0x0265, 66, 51 }, { 0x0266, 71, 60 }, { 0x0267, 0, 0 }, { 0x0268, 72, 61 }, // U+0450
+    { 0x0269, 73, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 74, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_18_bold = {
     notosans_18_boldBitmaps,
     notosans_18_boldGlyphs,
     notosans_18_boldIntervals,
-    20,
+    18,
     51,
     41,
     -11,
     true,
     notosans_18_boldGroups,
-    13,
-    nullptr,
+    14,
+    notosans_18_boldGlyphToGroup,
     notosans_18_boldKernLeftClasses,
     notosans_18_boldKernRightClasses,
     notosans_18_boldKernMatrix,
@@ -4979,4 +5085,8 @@ static const EpdFontData notosans_18_bold = {
     76,
     notosans_18_boldLigaturePairs,
     5,
+    notosans_18_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,3315 +3,3321 @@
  * name: notosans_18_bolditalic
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_18_bolditalic 18 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_18_bolditalic 18 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_bolditalicBitmaps[52837] = {
-    0xB5, 0x5B, 0x3D, 0x90, 0xDC, 0xC8, 0x75, 0x6E, 0x0C, 0xB4, 0x84, 0xCB, 0x08, 0xA0, 0x40, 0x5B,
-    0x2A, 0x9B, 0xE5, 0x82, 0x03, 0x07, 0xAE, 0x93, 0xAB, 0x90, 0x2A, 0xB1, 0x1A, 0xB4, 0x82, 0x0B,
-    0x4D, 0x57, 0x71, 0xEC, 0xE0, 0x02, 0x3A, 0x70, 0xE0, 0x3A, 0xB9, 0xBC, 0x89, 0x43, 0xB9, 0x80,
-    0x93, 0x02, 0x87, 0xDA, 0x40, 0xA7, 0xD4, 0x0C, 0x14, 0x48, 0xCB, 0x80, 0x0E, 0x1D, 0xB8, 0x0E,
-    0xB8, 0xBA, 0xC0, 0xC1, 0x05, 0x82, 0xC5, 0x3A, 0x2B, 0x50, 0x70, 0xF0, 0x91, 0xE7, 0xB3, 0xC9,
-    0x60, 0xA1, 0x2B, 0x50, 0x02, 0x97, 0x00, 0xDA, 0xEF, 0xFB, 0x5E, 0x63, 0x06, 0xB3, 0xCB, 0x3D,
-    0x52, 0x2A, 0x6B, 0x39, 0xD3, 0x8D, 0x9D, 0xED, 0xE9, 0x7E, 0xFD, 0x7E, 0xBF, 0xF7, 0xBA, 0x69,
-    0xD2, 0xD9, 0x64, 0xB3, 0xB1, 0x93, 0xB1, 0x23, 0x5E, 0xC5, 0x60, 0x8A, 0xDE, 0x54, 0x9D, 0x71,
-    0xF2, 0x6A, 0x8D, 0x6B, 0x02, 0x57, 0x6F, 0x5C, 0xB9, 0x71, 0x79, 0xE8, 0x0C, 0x5E, 0xB3, 0x89,
-    0x26, 0x13, 0xDC, 0x31, 0xFA, 0x13, 0xB5, 0xC6, 0xCA, 0x37, 0x46, 0x53, 0xC9, 0x6B, 0x30, 0xB6,
-    0x33, 0x47, 0xB9, 0x49, 0x86, 0xAC, 0x4F, 0x06, 0xDB, 0xA5, 0xBD, 0xBC, 0x3B, 0xDB, 0x66, 0x9D,
-    0xAD, 0xB3, 0xB6, 0xA8, 0x6D, 0x53, 0x94, 0xB6, 0xAE, 0x72, 0x5B, 0x56, 0xC6, 0xE6, 0x0E, 0x5F,
-    0xEF, 0xE3, 0x4E, 0xBA, 0xA4, 0x4B, 0xB4, 0x4B, 0x5B, 0xE9, 0xD2, 0x36, 0xAB, 0xA5, 0xCB, 0x1A,
-    0x8B, 0xCE, 0xD6, 0x45, 0xC9, 0xAE, 0xCA, 0x4D, 0xB0, 0xAD, 0xDE, 0x75, 0x5B, 0x21, 0x03, 0x3F,
-    0xF9, 0x41, 0x67, 0x36, 0xF7, 0xE7, 0xFB, 0xF3, 0x99, 0x31, 0xE1, 0x18, 0x0D, 0x06, 0x5D, 0xDC,
-    0x63, 0x81, 0x01, 0x33, 0x1F, 0xDD, 0x7D, 0x76, 0xF7, 0xD9, 0x6D, 0x63, 0x31, 0xB0, 0x3F, 0xE8,
-    0x3A, 0xF3, 0x46, 0xF5, 0xA4, 0x7A, 0x72, 0xCF, 0x2F, 0x60, 0x4C, 0x51, 0x82, 0x2E, 0x53, 0x19,
-    0x76, 0x6E, 0x33, 0x4B, 0x1B, 0xCC, 0xE1, 0x28, 0xDD, 0x66, 0x62, 0xE7, 0x17, 0x90, 0x9F, 0xDF,
-    0x63, 0xFB, 0x0D, 0xB6, 0xFF, 0x88, 0xE6, 0xC6, 0x7C, 0x5B, 0x46, 0x3B, 0x27, 0x5F, 0x4A, 0x40,
-    0x1A, 0xD7, 0x90, 0xC9, 0x9C, 0x9B, 0x64, 0xAE, 0xCF, 0xBB, 0xBF, 0x93, 0xF6, 0x21, 0x76, 0xEA,
-    0x3E, 0xC0, 0x46, 0xDD, 0xA3, 0x06, 0xAD, 0xC3, 0x36, 0x2B, 0x87, 0x4F, 0x2C, 0xBE, 0x6A, 0x62,
-    0x7E, 0x14, 0x80, 0x3A, 0x61, 0x83, 0xC3, 0x3E, 0xB2, 0x0A, 0x4B, 0x7F, 0xC3, 0xA2, 0xFD, 0xD3,
-    0x6C, 0x34, 0x7F, 0x68, 0xBE, 0x2D, 0xAD, 0xCD, 0xFF, 0xAD, 0xD2, 0x8D, 0x74, 0x6C, 0x1B, 0xB6,
-    0x39, 0x26, 0x00, 0x89, 0x5F, 0x7D, 0x06, 0xA2, 0xC2, 0x76, 0xD5, 0x36, 0xE6, 0xCA, 0x8F, 0x48,
-    0x5C, 0x38, 0x6F, 0x36, 0xA0, 0xD4, 0xB6, 0x26, 0xC2, 0x04, 0x55, 0x6D, 0x92, 0xD9, 0xD5, 0x81,
-    0x7C, 0x94, 0xF5, 0x55, 0x1D, 0x4E, 0xF8, 0x53, 0x51, 0x27, 0x32, 0xB4, 0x68, 0xAA, 0x3A, 0x13,
-    0xC2, 0xAA, 0xBA, 0xAA, 0x8B, 0x1A, 0xBD, 0xAB, 0xE5, 0x1B, 0xC6, 0x95, 0xEE, 0x3B, 0x20, 0xDE,
-    0xBD, 0xE3, 0xDE, 0x1C, 0x45, 0x09, 0xDC, 0x77, 0x5D, 0xD2, 0x09, 0x19, 0xEE, 0xC3, 0xC9, 0x3E,
-    0x94, 0xB9, 0x0B, 0x37, 0x56, 0xDF, 0x93, 0xB9, 0xAD, 0xFB, 0x85, 0xCB, 0x9E, 0xBB, 0x32, 0x71,
-    0x1F, 0x8C, 0xB6, 0x75, 0x65, 0xF0, 0xE3, 0xA4, 0x2F, 0x1A, 0x27, 0x32, 0xCE, 0x5A, 0x99, 0x4B,
-    0xFA, 0x42, 0x5A, 0xF4, 0x0E, 0x73, 0xE6, 0x46, 0x16, 0x77, 0xB7, 0x84, 0x90, 0x58, 0xE6, 0xFA,
-    0x33, 0xE9, 0x53, 0x51, 0xCC, 0x37, 0x67, 0x08, 0xCC, 0xB8, 0x73, 0xE1, 0x07, 0xC8, 0x15, 0x1E,
-    0x41, 0x52, 0x56, 0x98, 0x18, 0x8D, 0x60, 0x7E, 0xAE, 0x7B, 0xBB, 0xBD, 0xDA, 0x67, 0x8A, 0x39,
-    0xC1, 0x6E, 0xF0, 0x53, 0x94, 0x06, 0xAC, 0x4C, 0x28, 0x2B, 0xD9, 0x6B, 0x02, 0x71, 0x67, 0x43,
-    0xC4, 0xAE, 0xF7, 0x5D, 0x3C, 0xF3, 0xC3, 0x14, 0x23, 0xD3, 0xB1, 0x1A, 0xF4, 0x0B, 0xAD, 0x4A,
-    0x28, 0x67, 0x37, 0x98, 0x2D, 0x96, 0x6F, 0x37, 0xAE, 0x96, 0x29, 0xBB, 0xD0, 0xE5, 0x32, 0x62,
-    0x8C, 0x9D, 0xD8, 0x54, 0x3A, 0x27, 0x62, 0x54, 0x43, 0xE2, 0x84, 0xC1, 0x55, 0x87, 0xBF, 0x4A,
-    0x17, 0x40, 0x48, 0x78, 0x12, 0x62, 0x64, 0xC2, 0x02, 0xDA, 0x31, 0xFF, 0x25, 0x59, 0x0F, 0x75,
-    0xAC, 0x45, 0xDC, 0x94, 0xA3, 0x2C, 0x30, 0xC9, 0x30, 0x19, 0x7E, 0x0A, 0xC9, 0x1F, 0x71, 0x23,
-    0xC9, 0x90, 0x0C, 0x69, 0x9F, 0x76, 0x59, 0x97, 0xB5, 0x56, 0xAC, 0xC3, 0x96, 0x36, 0x07, 0xDB,
-    0x64, 0x8E, 0x46, 0x86, 0xE6, 0x26, 0x82, 0xE2, 0x8D, 0x20, 0x5D, 0xB8, 0x28, 0x1F, 0xCB, 0x7C,
-    0x62, 0xBB, 0x30, 0xDB, 0xDD, 0x9F, 0x96, 0x3F, 0x8B, 0xA5, 0xEA, 0xBB, 0xD5, 0xA1, 0x45, 0xC3,
-    0x59, 0xF4, 0x5D, 0xFB, 0xB7, 0xFF, 0x1D, 0x7F, 0xC3, 0x38, 0x8C, 0x87, 0xE8, 0x45, 0x02, 0x06,
-    0xAA, 0x10, 0x8F, 0xB0, 0x06, 0xCF, 0x5E, 0xE8, 0x8A, 0x01, 0x8B, 0xF1, 0xCD, 0xF5, 0x37, 0x96,
-    0x6F, 0x61, 0x55, 0xBC, 0x53, 0xFF, 0x5E, 0x7E, 0xCF, 0xBA, 0x15, 0x35, 0x9D, 0x52, 0x83, 0x55,
-    0x85, 0xF8, 0x80, 0xC4, 0xE7, 0xDC, 0x40, 0x3C, 0x29, 0xF1, 0xCB, 0x10, 0xF9, 0xF3, 0xF2, 0x71,
-    0x3A, 0xE8, 0x6A, 0xC6, 0xFC, 0x0D, 0x6D, 0xB7, 0x5E, 0x1A, 0xF9, 0xFA, 0x1F, 0xC3, 0x90, 0x2D,
-    0x8C, 0xDA, 0x0E, 0x13, 0xCC, 0x6C, 0x7E, 0xFB, 0x5F, 0x52, 0x1A, 0xCC, 0x09, 0x9A, 0x8C, 0x62,
-    0x71, 0x47, 0xF7, 0x36, 0x4E, 0xCC, 0x3F, 0x99, 0x45, 0xA9, 0xB2, 0xD1, 0x36, 0x26, 0x12, 0x26,
-    0x9B, 0xA0, 0x01, 0x9D, 0x26, 0x81, 0xD1, 0x7C, 0x09, 0x33, 0x6F, 0xA9, 0x40, 0x5F, 0xDC, 0xA8,
-    0xD1, 0x8F, 0x97, 0x9A, 0x57, 0x7E, 0x0D, 0xB3, 0xE7, 0xD4, 0xA2, 0x52, 0xB4, 0x4F, 0x34, 0x4F,
-    0xF6, 0x2A, 0xAB, 0xCB, 0x6E, 0x85, 0xA4, 0xAA, 0x34, 0x47, 0xDB, 0x3B, 0x19, 0xE6, 0x92, 0xD7,
-    0x60, 0x5D, 0x7F, 0xBC, 0xBD, 0x1D, 0xB5, 0x76, 0x28, 0xC6, 0x4A, 0xF4, 0xB2, 0xE8, 0x8E, 0x72,
-    0xEA, 0x34, 0x5A, 0xEA, 0x2E, 0x39, 0xA5, 0x8C, 0x51, 0x8E, 0xC9, 0xCE, 0xC9, 0x20, 0xFA, 0x9A,
-    0x8D, 0xD3, 0xE1, 0x1C, 0x38, 0x71, 0xE0, 0xB8, 0x1F, 0x58, 0xAC, 0x07, 0x96, 0xBB, 0x81, 0xF1,
-    0x7A, 0x60, 0xCF, 0x81, 0xDD, 0x6E, 0x60, 0xB0, 0x1E, 0x38, 0xEF, 0x09, 0xC8, 0x56, 0x03, 0x0F,
-    0x7E, 0xB2, 0x39, 0x87, 0xC7, 0x69, 0x61, 0x50, 0xF4, 0x60, 0x12, 0x3E, 0xE6, 0x42, 0x2C, 0xBD,
-    0x4B, 0xE6, 0x8D, 0x6B, 0x12, 0x27, 0x7C, 0x88, 0x5D, 0xEC, 0xF2, 0xD8, 0x89, 0x69, 0x4A, 0x33,
-    0x4B, 0x93, 0x4E, 0x32, 0x5C, 0xDC, 0x9E, 0x88, 0x89, 0xCD, 0x60, 0xD2, 0x49, 0x1A, 0x11, 0x98,
-    0x4C, 0xC1, 0x66, 0x90, 0xA6, 0xE8, 0xA5, 0x71, 0x9D, 0x1D, 0x02, 0xD7, 0xDA, 0x31, 0x74, 0xB5,
-    0x98, 0xA2, 0x2B, 0x21, 0x73, 0x2C, 0x36, 0x1A, 0x5A, 0xA2, 0xC8, 0x5C, 0x78, 0x10, 0xD0, 0xAC,
-    0x22, 0x78, 0xB7, 0x49, 0xC8, 0x11, 0x8E, 0x83, 0x0E, 0x37, 0x88, 0xF5, 0xF5, 0x42, 0x53, 0x9F,
-    0xCD, 0x45, 0x97, 0xF4, 0x55, 0x17, 0x97, 0xAE, 0x0D, 0x24, 0x16, 0xCA, 0x3E, 0x6B, 0xBE, 0x37,
-    0xD4, 0x3E, 0x55, 0x4E, 0x30, 0x5C, 0x0C, 0x5E, 0x08, 0xF2, 0xEF, 0x49, 0xD9, 0x94, 0x41, 0x59,
-    0x07, 0x65, 0x96, 0x84, 0x54, 0xC4, 0xD4, 0xBD, 0x2B, 0x6A, 0xC0, 0x5C, 0xA8, 0x05, 0xE9, 0x12,
-    0x3F, 0xC0, 0x68, 0x31, 0x3F, 0x90, 0x79, 0xD3, 0x56, 0x68, 0x36, 0x31, 0xD7, 0x30, 0x07, 0x6D,
-    0x48, 0x2E, 0xC7, 0xE4, 0x72, 0x4A, 0x2E, 0x17, 0x23, 0x99, 0xDF, 0x51, 0xEE, 0x0C, 0x9A, 0x1A,
-    0xBD, 0x18, 0xAE, 0xF8, 0x71, 0xC2, 0xEF, 0xD8, 0x89, 0xE3, 0xFA, 0xDD, 0xB8, 0x74, 0x17, 0x02,
-    0x7B, 0x2E, 0x0E, 0x23, 0x40, 0xAB, 0x31, 0xD1, 0x5B, 0x34, 0x78, 0x94, 0xFA, 0x4F, 0x47, 0x8D,
-    0x62, 0xF6, 0xD3, 0xCA, 0x99, 0x3F, 0x30, 0x74, 0x97, 0xF1, 0xAE, 0x49, 0xE8, 0x28, 0x47, 0x5D,
-    0xE2, 0x06, 0xFC, 0x57, 0xA2, 0x31, 0xB0, 0xA7, 0xC7, 0xCC, 0xCD, 0xD1, 0x5B, 0x8E, 0xA1, 0xAE,
-    0x5B, 0xB4, 0x81, 0x1A, 0xC4, 0xA6, 0xEA, 0x4A, 0xEC, 0x60, 0xCE, 0x85, 0x29, 0x74, 0x81, 0x8C,
-    0xE6, 0x0E, 0x11, 0x4C, 0x8C, 0x53, 0x88, 0x3F, 0x56, 0x5F, 0xAE, 0x2C, 0x88, 0x3D, 0xF5, 0xD8,
-    0x54, 0x41, 0x35, 0x06, 0xFB, 0x20, 0x53, 0x75, 0xCE, 0xA0, 0xE3, 0x05, 0xA8, 0x29, 0x9E, 0x4E,
-    0x20, 0xE7, 0x27, 0x70, 0x51, 0x2E, 0xA5, 0xE3, 0x43, 0x6B, 0xFB, 0x6C, 0x80, 0x2D, 0xC8, 0xD2,
-    0xA2, 0xB3, 0xA2, 0xF0, 0x22, 0x3D, 0x21, 0x48, 0xB4, 0x55, 0xEC, 0x83, 0xBE, 0xB7, 0xA4, 0x23,
-    0xCE, 0xD9, 0x92, 0x35, 0xCE, 0x1C, 0x6F, 0xFF, 0xCA, 0x7D, 0xB4, 0x33, 0x30, 0xD5, 0x72, 0x35,
-    0x33, 0x95, 0x05, 0xB7, 0x1F, 0x2D, 0x91, 0x57, 0xDA, 0x84, 0x42, 0xD5, 0x36, 0x65, 0x88, 0x51,
-    0x8B, 0xF1, 0x06, 0x76, 0xD9, 0x1E, 0x25, 0x8E, 0x3D, 0x66, 0xBC, 0x77, 0xDC, 0x09, 0x75, 0x8B,
-    0x71, 0xE6, 0xE2, 0x5B, 0x2A, 0x0C, 0xA7, 0x66, 0xA4, 0x73, 0x0C, 0x2B, 0x0B, 0x64, 0x2B, 0x63,
-    0x4E, 0xE5, 0x1B, 0xAD, 0x79, 0xEF, 0x2F, 0x4E, 0xE4, 0xBB, 0x10, 0x64, 0x89, 0x76, 0x26, 0xF2,
-    0x90, 0x21, 0x37, 0xC9, 0xC7, 0x85, 0x91, 0xFC, 0xB9, 0x81, 0xBF, 0x16, 0xD2, 0x84, 0x90, 0x2A,
-    0xED, 0xC2, 0xBA, 0x4F, 0xFF, 0x16, 0x31, 0x49, 0x08, 0x69, 0xBD, 0xAE, 0x71, 0x93, 0xC9, 0x24,
-    0x66, 0x92, 0x8E, 0x62, 0x9C, 0xD9, 0x85, 0x67, 0x4F, 0x83, 0xA6, 0x2D, 0x24, 0x2C, 0x77, 0x80,
-    0x7E, 0x9D, 0x80, 0x90, 0xA2, 0x13, 0xFD, 0x66, 0x53, 0xA1, 0x91, 0xBF, 0x4A, 0xD3, 0x14, 0xBD,
-    0xE8, 0xB2, 0x9D, 0x44, 0x5E, 0xD9, 0x15, 0xFB, 0x2B, 0xD5, 0xFE, 0x02, 0x06, 0xBC, 0xCD, 0xBE,
-    0xAD, 0xC3, 0x7D, 0x9B, 0x53, 0xAA, 0x74, 0x18, 0xD3, 0x82, 0x55, 0xBC, 0x1A, 0x6D, 0xA8, 0x51,
-    0xA1, 0xD7, 0x8A, 0x7C, 0x67, 0x12, 0x84, 0x48, 0xDC, 0x87, 0x1F, 0x18, 0x72, 0x60, 0x44, 0x16,
-    0xF8, 0xB9, 0xF6, 0xB6, 0xA3, 0xAC, 0x0D, 0xFC, 0x40, 0x9D, 0xAB, 0xA4, 0x86, 0x99, 0xC5, 0x6C,
-    0xF6, 0x40, 0x09, 0xAB, 0x44, 0xA4, 0x3E, 0xA5, 0xED, 0x5A, 0xE5, 0x71, 0x8F, 0xC1, 0xAE, 0x01,
-    0xB3, 0x5C, 0xBD, 0x6A, 0x1B, 0xE8, 0x85, 0xEB, 0xE8, 0x07, 0x26, 0xAC, 0x93, 0xC2, 0x32, 0x64,
-    0x01, 0x5A, 0x8B, 0x1B, 0x75, 0xEF, 0xD0, 0x99, 0x9F, 0xC1, 0xEC, 0x67, 0xF0, 0xDD, 0x02, 0x2B,
-    0xD0, 0xEB, 0x83, 0xA5, 0x68, 0x2B, 0x7D, 0xD6, 0x5F, 0xC7, 0x60, 0x87, 0xF4, 0x52, 0x8A, 0x39,
-    0x22, 0xB4, 0xF4, 0xE8, 0x71, 0x87, 0xCA, 0x41, 0x66, 0x4F, 0xFA, 0xB8, 0x04, 0x79, 0xD9, 0xC4,
-    0xEE, 0x3F, 0xE1, 0x5D, 0x65, 0x42, 0x20, 0xC7, 0x5E, 0x56, 0xB2, 0xF0, 0x94, 0xBE, 0x91, 0xD9,
-    0x2B, 0x3A, 0xCE, 0x1E, 0x3E, 0xB3, 0x23, 0xA6, 0x64, 0x9C, 0x14, 0x4B, 0xAE, 0x04, 0xDE, 0x0C,
-    0xB2, 0xE4, 0xEF, 0xDF, 0x02, 0x87, 0x56, 0x9A, 0x31, 0x2B, 0x1B, 0xBF, 0xFF, 0x55, 0x59, 0x8D,
-    0x1A, 0x4B, 0x9A, 0x14, 0xED, 0x62, 0xAB, 0x0A, 0x5B, 0x6E, 0x96, 0x9A, 0x4F, 0x04, 0x7C, 0x41,
-    0xE5, 0x8F, 0xCD, 0x75, 0x3F, 0x97, 0xF2, 0x89, 0x82, 0xF9, 0x84, 0x31, 0x7F, 0x6F, 0xBC, 0xCB,
-    0xAD, 0xE9, 0xBF, 0x22, 0x1F, 0xFC, 0xCD, 0x1D, 0xF3, 0x5A, 0x3F, 0xC7, 0xB7, 0x55, 0x17, 0x84,
-    0x26, 0x9D, 0x46, 0xA1, 0x12, 0xF0, 0x0B, 0x70, 0x0C, 0xF0, 0x4C, 0xB6, 0x46, 0xC6, 0x7F, 0x02,
-    0xFD, 0x1A, 0xBD, 0x4F, 0x43, 0x5C, 0x10, 0x71, 0x3D, 0x96, 0x87, 0x19, 0x0F, 0xED, 0xF2, 0xD0,
-    0x78, 0x05, 0xB1, 0xD0, 0x8B, 0xD4, 0xD1, 0x72, 0xF0, 0xE1, 0x4D, 0x0A, 0x18, 0x98, 0x54, 0x08,
-    0x1D, 0x17, 0x4D, 0xE3, 0x7C, 0x9C, 0xD9, 0x5C, 0x83, 0x10, 0x0E, 0x7E, 0xDE, 0x38, 0x3B, 0x3B,
-    0xFB, 0xD1, 0xA5, 0x21, 0xC7, 0xDB, 0xED, 0x56, 0x77, 0xFC, 0x75, 0xCE, 0x52, 0x2E, 0xEE, 0xC0,
-    0x42, 0x24, 0x31, 0x31, 0x7F, 0xB5, 0x7F, 0x2C, 0x54, 0x50, 0x83, 0xA7, 0x20, 0xD0, 0x7D, 0x0C,
-    0x1E, 0xE1, 0x0B, 0x79, 0x24, 0x14, 0x98, 0xD9, 0xEF, 0xE3, 0x74, 0x99, 0x79, 0xF5, 0x73, 0xE2,
-    0x4E, 0xF1, 0x05, 0x3A, 0xE3, 0x49, 0x5D, 0x5A, 0xF2, 0xFC, 0xAE, 0xCB, 0xA3, 0x9C, 0xDE, 0x70,
-    0xDF, 0xD0, 0xB4, 0x2C, 0x9D, 0x2E, 0xA0, 0x21, 0x66, 0xCD, 0xF0, 0x39, 0x63, 0x11, 0x7E, 0x23,
-    0x98, 0xA0, 0xD4, 0xC2, 0xF9, 0xAA, 0x88, 0x36, 0xF7, 0x16, 0x74, 0xA1, 0xB4, 0x4C, 0x8B, 0x29,
-    0x13, 0x42, 0x1C, 0x79, 0xD7, 0x75, 0xE3, 0xBD, 0x1F, 0x6A, 0x2C, 0x50, 0x8F, 0x96, 0x31, 0x7E,
-    0x81, 0xED, 0xF7, 0xB1, 0x95, 0x58, 0x68, 0x85, 0xF9, 0x66, 0xA3, 0x7A, 0x56, 0xBA, 0x58, 0xDB,
-    0x0A, 0x32, 0x0E, 0xCE, 0xF2, 0xB4, 0x93, 0x65, 0x33, 0x37, 0x25, 0x7D, 0x24, 0x56, 0x24, 0x18,
-    0x7D, 0x90, 0x27, 0x49, 0x20, 0xA2, 0x21, 0xED, 0x92, 0x21, 0x92, 0x7F, 0x02, 0xAA, 0xDB, 0xB8,
-    0x8F, 0x06, 0xC9, 0x38, 0xEB, 0xA4, 0x43, 0x5F, 0x95, 0x49, 0x17, 0xF7, 0x56, 0xF2, 0x9B, 0xB4,
-    0x4D, 0x3A, 0xC9, 0x4B, 0x8C, 0x6D, 0x52, 0xF6, 0x92, 0xCC, 0xB6, 0xE8, 0x9D, 0x8C, 0x95, 0xBF,
-    0x7F, 0xC7, 0xFD, 0x54, 0x42, 0x46, 0x0D, 0xD7, 0x2B, 0xB9, 0xB4, 0xB8, 0xC7, 0xEF, 0x81, 0x63,
-    0x5D, 0x3C, 0xC3, 0x58, 0x92, 0x5E, 0x89, 0x8F, 0xBD, 0x37, 0xA1, 0x01, 0x7D, 0x19, 0x64, 0x3F,
-    0x37, 0x37, 0x19, 0x11, 0x7D, 0xD0, 0x8D, 0x97, 0xE0, 0x2B, 0x28, 0x95, 0x1B, 0x0E, 0xB6, 0x3B,
-    0x73, 0xA6, 0x7A, 0x26, 0x34, 0x73, 0xD1, 0xB5, 0x4E, 0xB5, 0x48, 0xC3, 0x89, 0x8F, 0x11, 0xE7,
-    0xEA, 0x15, 0xFF, 0x59, 0x5D, 0x19, 0x91, 0x6B, 0x3C, 0x2B, 0x80, 0x1D, 0x09, 0x04, 0xB3, 0x21,
-    0xA1, 0xB2, 0x74, 0xEC, 0xAA, 0x36, 0x51, 0x36, 0x25, 0xD4, 0xF1, 0x32, 0x61, 0xA4, 0xCC, 0xD1,
-    0xC5, 0x6E, 0x07, 0x4D, 0x26, 0x55, 0xD6, 0x49, 0x89, 0x84, 0x3F, 0xBB, 0x38, 0x7B, 0x30, 0x0B,
-    0xE9, 0x0D, 0x70, 0x9E, 0xDA, 0xA3, 0xBC, 0x88, 0x82, 0xA0, 0x01, 0xD2, 0x09, 0x4A, 0x83, 0x98,
-    0xED, 0xA8, 0xD2, 0x8E, 0xDC, 0xFC, 0x43, 0xB3, 0x8A, 0x8B, 0x84, 0x7C, 0x22, 0xB5, 0x94, 0x21,
-    0x3E, 0xA5, 0xA5, 0x67, 0x2C, 0x3D, 0xC0, 0x23, 0xC1, 0x33, 0xD1, 0x03, 0xD0, 0xF1, 0x55, 0xDD,
-    0x0D, 0x75, 0x2A, 0xF4, 0x2A, 0xD0, 0x2B, 0x4E, 0x10, 0x90, 0xA2, 0x8D, 0xFB, 0xE8, 0x04, 0xD9,
-    0x7F, 0xCD, 0x57, 0x49, 0xEC, 0x0C, 0x04, 0x1D, 0xA1, 0x4E, 0x51, 0xC7, 0x6C, 0xC5, 0x43, 0xA5,
-    0x48, 0x35, 0xCF, 0x44, 0x6D, 0x75, 0x3B, 0xD9, 0x82, 0x2C, 0x34, 0x59, 0xFE, 0x9F, 0xBD, 0x06,
-    0xDE, 0x14, 0x71, 0xF8, 0x05, 0x54, 0x10, 0x19, 0x9F, 0x2B, 0xF7, 0x04, 0x89, 0xF0, 0x64, 0xA2,
-    0x32, 0xF4, 0xB9, 0x5F, 0xBD, 0x8B, 0x24, 0xEB, 0x90, 0xA3, 0xAD, 0x46, 0x28, 0x0D, 0xCC, 0x8A,
-    0xF8, 0xB4, 0x75, 0xAB, 0xD6, 0x7F, 0xDE, 0xEF, 0xA3, 0x90, 0x9D, 0x91, 0xAB, 0x66, 0xEE, 0xD3,
-    0x93, 0x86, 0xEC, 0x69, 0x08, 0x27, 0x1A, 0xEE, 0xB4, 0x81, 0x9E, 0x53, 0x1F, 0xB6, 0xAA, 0x0A,
-    0xF3, 0xA9, 0xEA, 0xCA, 0xAC, 0x90, 0x07, 0xE4, 0x24, 0x6E, 0x09, 0x4B, 0x14, 0xDC, 0x08, 0x7A,
-    0xC9, 0xD5, 0x99, 0x74, 0x25, 0x4C, 0x7F, 0xD8, 0x09, 0x65, 0x00, 0x2D, 0x42, 0x02, 0x3A, 0xE7,
-    0xBB, 0x76, 0xE9, 0x12, 0x47, 0xD9, 0x4A, 0x07, 0x47, 0x99, 0xA8, 0x88, 0x25, 0xF6, 0x42, 0x67,
-    0xED, 0x48, 0x4B, 0xAF, 0xE0, 0x41, 0x88, 0xF4, 0x62, 0x88, 0x9E, 0xDF, 0x01, 0xEE, 0x48, 0xDC,
-    0x03, 0x8F, 0x77, 0xD4, 0xD1, 0x38, 0x75, 0x01, 0x0C, 0xE2, 0xC2, 0xE9, 0x53, 0xE3, 0x41, 0x12,
-    0x93, 0x5B, 0xD7, 0x78, 0xD2, 0xB5, 0xD5, 0x60, 0xA6, 0xC9, 0x45, 0xB6, 0xE2, 0xA6, 0x5D, 0x73,
-    0x53, 0xC1, 0xCE, 0xA2, 0x06, 0x3D, 0x5B, 0xA6, 0xC8, 0x0E, 0xD5, 0x8B, 0x8F, 0xB6, 0xB7, 0x7D,
-    0x04, 0x0F, 0x7D, 0x32, 0x92, 0x5F, 0x86, 0x69, 0xBE, 0xE5, 0x52, 0x6C, 0x95, 0xBA, 0x6C, 0x55,
-    0xAA, 0xF9, 0x75, 0x28, 0x1C, 0xAE, 0x50, 0xA8, 0x32, 0x7E, 0xB6, 0xBD, 0xFD, 0x52, 0x0A, 0xC1,
-    0x90, 0x50, 0xE8, 0xCC, 0x5F, 0x45, 0x21, 0x95, 0x2A, 0x9D, 0xF6, 0x4B, 0xAD, 0x17, 0xDC, 0x23,
-    0x38, 0x26, 0xDB, 0x60, 0x76, 0x44, 0x96, 0xAB, 0x41, 0x15, 0xEE, 0x02, 0x55, 0x06, 0x31, 0x51,
-    0x49, 0x23, 0xBA, 0x95, 0xBA, 0xE6, 0x97, 0x50, 0xCD, 0x4E, 0x5D, 0x85, 0xB8, 0xAA, 0x47, 0xB1,
-    0xA9, 0xEA, 0x90, 0x91, 0xB1, 0x54, 0xD1, 0x48, 0xA8, 0x3E, 0x13, 0x28, 0x0E, 0xB2, 0x6B, 0xD9,
-    0x96, 0x10, 0x2C, 0xEC, 0x97, 0xB6, 0xC0, 0x6A, 0xB9, 0x45, 0x36, 0x06, 0x75, 0x7D, 0x40, 0x4C,
-    0x27, 0xAB, 0x45, 0xCE, 0x47, 0x7D, 0xEF, 0x38, 0x4E, 0x99, 0xCF, 0xFA, 0xED, 0x59, 0xD5, 0x39,
-    0xE0, 0x6C, 0x55, 0x3D, 0x02, 0xA3, 0x96, 0x5B, 0x44, 0x37, 0x52, 0xE7, 0x64, 0x93, 0xD0, 0x39,
-    0xEB, 0xBB, 0x81, 0x5C, 0x2A, 0x7A, 0xD5, 0xB9, 0x67, 0xDB, 0xB7, 0xA4, 0xD3, 0x4A, 0xDF, 0xBA,
-    0x9B, 0x15, 0x3F, 0xD2, 0x1B, 0x6C, 0x4F, 0x46, 0x55, 0xD7, 0x71, 0xAD, 0xAE, 0x96, 0xEA, 0xBA,
-    0xE8, 0xFD, 0x75, 0x34, 0x64, 0x87, 0x34, 0x0C, 0x9A, 0x6E, 0x44, 0x8E, 0x5A, 0xEE, 0xF0, 0x25,
-    0x6D, 0x60, 0x92, 0xD3, 0x82, 0xE1, 0x29, 0x6F, 0xFA, 0x04, 0x34, 0x81, 0x26, 0x75, 0xB5, 0x6F,
-    0x42, 0x0D, 0x77, 0xB9, 0x97, 0xB0, 0xE6, 0x49, 0x3B, 0xD4, 0xC4, 0xB4, 0x3B, 0x5D, 0x20, 0x86,
-    0x0A, 0xA3, 0x50, 0xD7, 0x4B, 0xB5, 0xA4, 0x73, 0xAA, 0xB5, 0xD9, 0x45, 0xF9, 0x7E, 0xD1, 0x34,
-    0x5D, 0xB8, 0x5B, 0x2F, 0x1C, 0xAC, 0x16, 0xDE, 0x83, 0xB4, 0xFC, 0x9A, 0x85, 0xA7, 0x83, 0x85,
-    0x39, 0x3B, 0x27, 0x5E, 0x6D, 0xAB, 0xBB, 0xB2, 0x2D, 0x4E, 0x4C, 0x78, 0x9C, 0x29, 0xF7, 0xD1,
-    0x8C, 0xBE, 0xA2, 0x46, 0x3F, 0xF5, 0xE0, 0xB9, 0x4F, 0x8D, 0x02, 0x75, 0x2C, 0x80, 0xDE, 0xB2,
-    0x2A, 0x72, 0x50, 0xE9, 0xE0, 0x8C, 0x64, 0xE5, 0x8A, 0x1E, 0x8A, 0xD9, 0x69, 0x36, 0x32, 0x1B,
-    0x45, 0x91, 0x0C, 0x4E, 0xA2, 0xB7, 0xCA, 0x5A, 0x05, 0x32, 0x9F, 0x2B, 0x67, 0x7F, 0x45, 0x0E,
-    0xB8, 0x73, 0x2D, 0x93, 0xD0, 0xE9, 0x69, 0xA6, 0xB4, 0xA0, 0x80, 0x50, 0x87, 0x84, 0x12, 0x84,
-    0x1B, 0x74, 0xB7, 0xF0, 0x3D, 0xA1, 0x01, 0x0B, 0x08, 0x0D, 0x70, 0x1B, 0xB2, 0x38, 0x98, 0x9B,
-    0xB0, 0xC8, 0x0D, 0x1A, 0x90, 0x01, 0x64, 0xEA, 0x17, 0xD9, 0x79, 0x35, 0x29, 0x0F, 0x84, 0x35,
-    0x2F, 0x4D, 0x7A, 0x49, 0x58, 0x5F, 0x24, 0x0C, 0x73, 0x9D, 0x30, 0x2E, 0xAB, 0x82, 0x7A, 0xEF,
-    0xB3, 0x33, 0x56, 0x26, 0x98, 0x1E, 0xE5, 0xCC, 0x91, 0xD4, 0x0F, 0x45, 0x64, 0x0F, 0xEA, 0x00,
-    0x78, 0xB0, 0x74, 0x43, 0x3E, 0x6B, 0xE2, 0x83, 0x63, 0x6A, 0xDE, 0x83, 0x07, 0xFA, 0xC0, 0x0C,
-    0x38, 0x53, 0x75, 0x95, 0x2F, 0xBC, 0xE8, 0x4D, 0x82, 0x3C, 0xD8, 0x3E, 0x95, 0x60, 0xF7, 0x02,
-    0xE1, 0x5B, 0x1E, 0xEC, 0xC7, 0x42, 0x7E, 0xF5, 0x73, 0x49, 0x31, 0x90, 0x16, 0xBB, 0x0F, 0xC5,
-    0xF6, 0xEF, 0xE2, 0xE1, 0xDF, 0x45, 0x1A, 0x48, 0x8B, 0xE5, 0x21, 0x9C, 0x98, 0x19, 0xFF, 0xD3,
-    0x18, 0x8F, 0x16, 0xC6, 0xFF, 0xE6, 0x88, 0x22, 0xBE, 0xCC, 0x1E, 0xCA, 0xEF, 0x85, 0x3E, 0x14,
-    0x4D, 0xD5, 0xF2, 0xC1, 0x95, 0x08, 0x54, 0x73, 0x38, 0x01, 0x07, 0x09, 0xBC, 0x09, 0x45, 0x3A,
-    0xA0, 0x54, 0x12, 0x88, 0x11, 0x15, 0x21, 0x3C, 0x0C, 0x28, 0x36, 0xA5, 0x43, 0xC8, 0xDA, 0xA8,
-    0x40, 0x10, 0x89, 0xA1, 0x21, 0xAB, 0xCA, 0xA1, 0x66, 0x49, 0x56, 0x9C, 0x4E, 0x19, 0xCF, 0xBE,
-    0x30, 0x11, 0x30, 0x1D, 0x6A, 0xC9, 0x2C, 0xEC, 0x33, 0x64, 0x1A, 0xAD, 0x3D, 0x76, 0x19, 0xCD,
-    0x9A, 0x39, 0x01, 0x4A, 0xA1, 0x4F, 0x88, 0x4F, 0x26, 0x2D, 0x0C, 0x7E, 0xE6, 0x28, 0xA4, 0xE2,
-    0x91, 0xB8, 0x26, 0x24, 0xF9, 0x0F, 0x85, 0xA3, 0xD0, 0xCC, 0xF7, 0x25, 0x05, 0x05, 0xCB, 0xEA,
-    0x5D, 0xDF, 0x14, 0xF0, 0xCA, 0xA5, 0x64, 0xAA, 0x00, 0xF3, 0xB9, 0xED, 0xAA, 0x06, 0x4B, 0xDA,
-    0x5E, 0xF3, 0x8A, 0x6C, 0x50, 0x5C, 0x93, 0x4E, 0xE8, 0x67, 0x94, 0xC2, 0x4B, 0x2C, 0xC9, 0xAA,
-    0x6F, 0x42, 0x7F, 0xCB, 0x02, 0x17, 0x79, 0x9E, 0x8E, 0x3E, 0x1F, 0x18, 0xD4, 0x35, 0x70, 0xC9,
-    0x49, 0x73, 0xFD, 0x6A, 0x8D, 0xEA, 0x6F, 0x52, 0xAD, 0x35, 0xE5, 0x63, 0x80, 0x69, 0x77, 0x00,
-    0xB6, 0x72, 0x4F, 0xDD, 0x48, 0xE0, 0x5C, 0x4C, 0xCC, 0xE4, 0x53, 0x47, 0x43, 0x4B, 0x14, 0x54,
-    0x89, 0xC2, 0xA4, 0x84, 0xB7, 0x54, 0xDF, 0x7D, 0x57, 0x0C, 0x7B, 0x0D, 0x77, 0xD4, 0x43, 0xDF,
-    0xC9, 0x68, 0xEA, 0xCF, 0xC4, 0xCE, 0x8E, 0xFC, 0x10, 0x65, 0xE8, 0x9E, 0x09, 0x6F, 0x01, 0xD2,
-    0x3B, 0xD8, 0x63, 0xC2, 0x8A, 0xF3, 0xA7, 0x95, 0xC7, 0x66, 0xB3, 0xC6, 0xBF, 0x41, 0xE3, 0x6C,
-    0xC3, 0x88, 0xA1, 0xA0, 0x75, 0x6B, 0xF6, 0xD8, 0x23, 0xDE, 0x1D, 0x70, 0xD4, 0x1E, 0x78, 0x68,
-    0x35, 0x29, 0x65, 0xCA, 0xB6, 0xC3, 0x72, 0xCC, 0x32, 0xD1, 0x16, 0x6C, 0x91, 0xC7, 0x8E, 0x3C,
-    0x55, 0x92, 0x5C, 0xB1, 0xBD, 0xE9, 0x6B, 0x4D, 0x0D, 0xDD, 0x77, 0xBE, 0xA1, 0x0F, 0x47, 0x9A,
-    0x8A, 0x4A, 0xC6, 0xBB, 0xB7, 0x5F, 0x1A, 0x1C, 0xE7, 0xD7, 0x0F, 0x8E, 0xAF, 0xC3, 0xEC, 0xF1,
-    0xB7, 0xC9, 0xEC, 0xCA, 0x33, 0xBB, 0x53, 0x66, 0xB7, 0x60, 0x76, 0x4A, 0x66, 0xFF, 0xF7, 0x02,
-    0x84, 0x27, 0x65, 0xB6, 0xE6, 0x2F, 0x4B, 0x3A, 0x43, 0xE2, 0xDF, 0xD2, 0x93, 0x0A, 0x2D, 0x5C,
-    0xF8, 0xE2, 0xC4, 0x52, 0xD2, 0x58, 0x6A, 0x12, 0x5A, 0xE8, 0x33, 0x47, 0x5B, 0x72, 0xE9, 0x42,
-    0x77, 0x39, 0x2D, 0xE7, 0x4E, 0x89, 0x2F, 0x11, 0x3C, 0x80, 0x70, 0x58, 0x34, 0xD8, 0x49, 0xA0,
-    0x50, 0x7C, 0xDD, 0xED, 0x20, 0x36, 0x73, 0xF2, 0x0E, 0x19, 0x86, 0xBB, 0x80, 0x48, 0x19, 0x5C,
-    0x03, 0xAA, 0xC1, 0xC6, 0x17, 0xA3, 0x9E, 0xB2, 0x7D, 0xC7, 0xD1, 0x4A, 0x70, 0xC6, 0xE2, 0x3C,
-    0x80, 0x2C, 0x08, 0x2A, 0x59, 0x8D, 0x05, 0x03, 0x44, 0x2C, 0xC2, 0x4C, 0x75, 0xAC, 0xD2, 0x0A,
-    0x57, 0x19, 0xC6, 0xEB, 0x5D, 0xD5, 0x57, 0xF3, 0xC0, 0x7D, 0x71, 0xCC, 0xFA, 0xD4, 0xE2, 0x3E,
-    0xDC, 0xD0, 0x60, 0xFE, 0x68, 0x87, 0x93, 0xDB, 0x55, 0xAB, 0x68, 0x59, 0xEB, 0x3F, 0x9E, 0x4F,
-    0x5A, 0xD9, 0xD4, 0x2A, 0xA7, 0xDB, 0xFF, 0x21, 0xF1, 0xF8, 0xAF, 0xDE, 0xD5, 0x87, 0x02, 0xDF,
-    0xD6, 0xE6, 0x1F, 0xF8, 0x79, 0xF1, 0xEE, 0x09, 0x50, 0xC5, 0x52, 0x74, 0xD5, 0xF4, 0xA6, 0xDB,
-    0x1D, 0xE8, 0xB0, 0x44, 0xC6, 0x84, 0x87, 0x0D, 0xC6, 0x8D, 0x48, 0xEA, 0x46, 0x47, 0x7E, 0x5C,
-    0x8A, 0xA5, 0xE9, 0x4B, 0x82, 0xF8, 0x3E, 0x96, 0x5E, 0x8E, 0x0B, 0x57, 0x63, 0xE9, 0x3A, 0x2E,
-    0x5C, 0x8D, 0xD4, 0x98, 0x20, 0x3A, 0xC0, 0xE8, 0x0B, 0x38, 0x9F, 0x39, 0x47, 0x3A, 0xB1, 0xCB,
-    0x0E, 0x41, 0xCF, 0xC0, 0xB9, 0x16, 0xC4, 0xD5, 0x1F, 0xA0, 0x9D, 0x8E, 0xFE, 0x72, 0x01, 0x3D,
-    0x8D, 0x82, 0x9E, 0x43, 0xC4, 0x55, 0x2B, 0xE2, 0x22, 0xF0, 0xC2, 0x44, 0x7E, 0x06, 0xE9, 0x60,
-    0x14, 0xA2, 0xCB, 0x96, 0x2C, 0xFB, 0xC1, 0x02, 0xF1, 0x3B, 0xE3, 0x75, 0x8D, 0xC6, 0xAB, 0x92,
-    0x20, 0x16, 0xD6, 0x5A, 0x14, 0x4F, 0x96, 0x50, 0x0F, 0x94, 0xC5, 0xE9, 0x73, 0x1B, 0xC6, 0x90,
-    0xBA, 0xE8, 0x08, 0x23, 0x09, 0xC6, 0xA4, 0x15, 0x7A, 0x6C, 0xE7, 0x93, 0x3F, 0xE8, 0x27, 0xEA,
-    0xF7, 0xE2, 0x48, 0x41, 0x1C, 0x02, 0x45, 0xE9, 0x8F, 0xE4, 0xD2, 0x01, 0xDB, 0x48, 0x79, 0x20,
-    0x97, 0x0E, 0xF0, 0xF1, 0x38, 0x65, 0x86, 0x2B, 0x46, 0xA6, 0x9F, 0x8C, 0xCC, 0x84, 0x26, 0x30,
-    0x35, 0x79, 0xA1, 0xBC, 0xD4, 0xD3, 0xD4, 0xD1, 0x2C, 0x25, 0x91, 0xD8, 0x97, 0xCA, 0xDB, 0x5D,
-    0x21, 0xBC, 0x68, 0x58, 0xFF, 0xAF, 0x5A, 0x99, 0x82, 0x4C, 0x42, 0x70, 0x4B, 0xC9, 0xE1, 0x8A,
-    0x56, 0x0B, 0xD0, 0xDB, 0x9A, 0x62, 0x66, 0xA5, 0x58, 0xD2, 0xC1, 0x99, 0x68, 0x02, 0x59, 0x29,
-    0xB8, 0x59, 0xB4, 0x50, 0x40, 0x38, 0xB9, 0x16, 0xD1, 0x00, 0xF4, 0xB7, 0xF1, 0xCC, 0x9A, 0x72,
-    0xD1, 0x26, 0x17, 0x0E, 0xDC, 0x2E, 0xDA, 0xF4, 0x97, 0x8E, 0x8C, 0x6E, 0xED, 0x2F, 0x1C, 0xCA,
-    0x20, 0xB6, 0x2D, 0xFE, 0xC3, 0x85, 0x3C, 0x6F, 0x95, 0xE8, 0x84, 0xE8, 0x27, 0x0F, 0xEF, 0x38,
-    0x46, 0xB3, 0x4F, 0x64, 0x28, 0x2B, 0xD5, 0x8F, 0xE6, 0xC0, 0xF1, 0xA4, 0xEE, 0x33, 0x31, 0x60,
-    0x1E, 0x8E, 0x9D, 0xCB, 0x03, 0x38, 0x6A, 0xCF, 0x81, 0xD7, 0x6B, 0x56, 0x00, 0x02, 0xBA, 0x0E,
-    0x4B, 0x47, 0x6A, 0x14, 0x29, 0xF8, 0x87, 0x92, 0x61, 0x48, 0x1E, 0x64, 0x53, 0xA3, 0xCF, 0x31,
-    0x55, 0x36, 0x1B, 0xE2, 0x8A, 0x9C, 0x26, 0x42, 0x3F, 0x02, 0x22, 0x47, 0xD5, 0x56, 0xA7, 0xB8,
-    0x66, 0xA3, 0xC7, 0xD1, 0x83, 0x32, 0xC9, 0x8E, 0x3E, 0xDD, 0x1D, 0xD5, 0xFB, 0x24, 0x93, 0x26,
-    0x63, 0xB1, 0x9E, 0x86, 0xC2, 0x8F, 0xD5, 0x66, 0x57, 0x86, 0xC7, 0x02, 0x93, 0xAF, 0x74, 0x68,
-    0x00, 0x4C, 0xDC, 0xE2, 0xB4, 0x66, 0x5F, 0x49, 0xD5, 0x71, 0x82, 0xDC, 0xB4, 0xA2, 0xFE, 0xD0,
-    0x9F, 0x6C, 0x7C, 0xD7, 0x97, 0xF7, 0xD5, 0x6C, 0x35, 0x5E, 0x90, 0x6A, 0xF4, 0xA0, 0xA9, 0xEA,
-    0x55, 0x70, 0x85, 0x3F, 0xE5, 0x85, 0xCD, 0x61, 0x63, 0x00, 0x74, 0x05, 0x00, 0x4B, 0x43, 0xC5,
-    0x2D, 0x35, 0xDB, 0x15, 0xB9, 0xC0, 0x2B, 0xF1, 0x56, 0x43, 0x32, 0xA9, 0x01, 0x6C, 0x58, 0xBA,
-    0x88, 0x58, 0x3B, 0x4D, 0x58, 0x70, 0xCF, 0x58, 0xB0, 0x80, 0x7B, 0xDD, 0x50, 0xA1, 0x95, 0xB7,
-    0x46, 0x7D, 0xB2, 0xDB, 0x1F, 0xA8, 0xF8, 0x2C, 0xAF, 0x58, 0x67, 0xF5, 0xEA, 0xA1, 0xF6, 0x9E,
-    0xE6, 0xEA, 0x71, 0xCD, 0x3A, 0x90, 0xD1, 0x48, 0x34, 0x59, 0x9A, 0x19, 0x95, 0x66, 0x1F, 0x09,
-    0x12, 0x5F, 0x01, 0xDC, 0xAC, 0x8E, 0x72, 0x34, 0x65, 0xB3, 0xF3, 0xA5, 0x03, 0x1D, 0x2D, 0x05,
-    0xF9, 0x63, 0x9D, 0x3D, 0x71, 0xC1, 0xAA, 0xD6, 0x9D, 0x78, 0x2F, 0x79, 0xA9, 0xCA, 0xAD, 0xE5,
-    0x8B, 0xC4, 0x3D, 0x39, 0x3B, 0x63, 0xC4, 0x9E, 0x69, 0xC1, 0x93, 0x56, 0x23, 0x7D, 0x4B, 0x2C,
-    0x13, 0xF2, 0x3D, 0xC9, 0x52, 0x93, 0xD6, 0x48, 0x97, 0x3A, 0xE9, 0x72, 0x72, 0xBB, 0x3E, 0x3B,
-    0x5E, 0x9D, 0x17, 0x83, 0x6C, 0x57, 0x12, 0xC4, 0x6D, 0x9C, 0x56, 0x7F, 0x50, 0xEA, 0xC3, 0xED,
-    0x01, 0xD8, 0xD8, 0xE5, 0xA9, 0x32, 0x7F, 0x30, 0x8C, 0x0A, 0x24, 0xDE, 0x85, 0x10, 0x5F, 0x41,
-    0x7F, 0x4B, 0xCC, 0x26, 0xAF, 0xA2, 0xC6, 0xF4, 0xB2, 0x0A, 0x5E, 0x1D, 0xC6, 0xA6, 0x1D, 0xBE,
-    0x99, 0xF4, 0x98, 0x43, 0xA6, 0x8A, 0xF9, 0x92, 0xB9, 0xE5, 0x25, 0x2B, 0xE1, 0x85, 0xC2, 0x05,
-    0xCE, 0xA2, 0x41, 0x04, 0x4C, 0xA0, 0xF4, 0x47, 0x2C, 0x1B, 0x7F, 0xB8, 0x62, 0xB8, 0x3B, 0x6E,
-    0x4D, 0x29, 0xD2, 0x93, 0x4A, 0x6D, 0xE0, 0x22, 0x58, 0x31, 0xCB, 0xBA, 0xE5, 0xB4, 0x86, 0xE7,
-    0xCA, 0xD8, 0xA4, 0x36, 0x7A, 0xAC, 0xEC, 0xCF, 0x96, 0xB9, 0x08, 0xB7, 0xEA, 0xEB, 0x9A, 0xBB,
-    0xE2, 0x66, 0x74, 0x69, 0x76, 0x5E, 0x1D, 0xE8, 0xD7, 0xB3, 0x67, 0xAE, 0x5B, 0x6A, 0xAF, 0x90,
-    0x59, 0xA1, 0x54, 0x06, 0x7A, 0x75, 0x65, 0x29, 0x16, 0xB2, 0xBC, 0x44, 0x21, 0x57, 0x34, 0xD3,
-    0xAA, 0x14, 0x66, 0x5A, 0x31, 0xDE, 0x51, 0x9A, 0xA4, 0xCB, 0xC0, 0x9C, 0x54, 0x18, 0x57, 0x27,
-    0x62, 0xB8, 0x79, 0xDC, 0xE3, 0x72, 0xCE, 0x10, 0x49, 0x24, 0x18, 0x65, 0xB1, 0x70, 0xCC, 0x04,
-    0xDD, 0x4E, 0x08, 0x69, 0x5B, 0x54, 0x93, 0x35, 0xB3, 0x28, 0x20, 0xF7, 0xB7, 0xEF, 0xC1, 0xDB,
-    0xA7, 0xC4, 0xD1, 0xA0, 0x57, 0x26, 0x3F, 0x96, 0xC5, 0xDF, 0xCB, 0xB7, 0x80, 0x0E, 0x2D, 0xAB,
-    0x21, 0x17, 0x3E, 0xDF, 0x06, 0xBF, 0x1C, 0x0A, 0x3D, 0x0D, 0xF1, 0x62, 0x9E, 0x41, 0x5B, 0xF1,
-    0x5D, 0xB5, 0x2C, 0xAB, 0xD5, 0xBB, 0x01, 0xF8, 0x97, 0x47, 0x0A, 0xFE, 0xA8, 0x42, 0xD1, 0x45,
-    0xD1, 0xE3, 0x50, 0xA3, 0x18, 0xA0, 0x97, 0x38, 0x06, 0xD2, 0x0B, 0x2A, 0xA8, 0xA6, 0xCC, 0x04,
-    0x8F, 0x83, 0x70, 0x71, 0xC3, 0x05, 0xFD, 0x99, 0xC0, 0xE6, 0xCC, 0xBC, 0x1C, 0xF6, 0xAD, 0x4E,
-    0x9F, 0x0F, 0xCA, 0x2F, 0xFD, 0x09, 0xDC, 0xDF, 0xE7, 0xF0, 0xEE, 0xC5, 0x0B, 0xC7, 0x13, 0x7E,
-    0x4D, 0x4C, 0x81, 0x69, 0x71, 0x92, 0x5B, 0x06, 0xC8, 0x38, 0xA4, 0xD5, 0x22, 0x61, 0x19, 0xE2,
-    0x95, 0xB3, 0x85, 0x6D, 0xB2, 0x7C, 0x89, 0xA5, 0x62, 0x3D, 0x75, 0x9F, 0xE9, 0x37, 0xB8, 0xC7,
-    0x02, 0x35, 0x95, 0xF7, 0xC5, 0x74, 0xB4, 0x96, 0xA5, 0x94, 0xDB, 0x47, 0xC4, 0x2D, 0x35, 0xC3,
-    0x89, 0x39, 0xD2, 0x1A, 0xF9, 0xFF, 0xD2, 0x15, 0xFA, 0x9C, 0x1D, 0x60, 0x4E, 0x78, 0x56, 0xC9,
-    0xD4, 0x4D, 0xA0, 0x56, 0x9C, 0xCE, 0xD7, 0xE5, 0xDB, 0x87, 0x8D, 0xFE, 0xD5, 0xDD, 0xE2, 0x92,
-    0xBD, 0x9E, 0x8D, 0x87, 0x1E, 0xB4, 0x9E, 0x2E, 0xC7, 0xD5, 0xC6, 0xBC, 0x71, 0xEF, 0x95, 0x7E,
-    0x28, 0xD8, 0xF9, 0xA1, 0xE0, 0xBD, 0x6F, 0x12, 0xDC, 0x3E, 0xA2, 0x54, 0x7F, 0xE5, 0xEB, 0x26,
-    0x32, 0xED, 0x05, 0xA5, 0x5A, 0xEF, 0xA5, 0x3A, 0x53, 0xAA, 0xE3, 0x22, 0xD5, 0x61, 0x91, 0x6A,
-    0xBF, 0x84, 0xE5, 0xBD, 0x54, 0x19, 0x31, 0x86, 0x0D, 0xA5, 0x1A, 0x6B, 0x9D, 0xC2, 0xD7, 0xC8,
-    0x10, 0x59, 0xC6, 0xEA, 0x92, 0x54, 0xCD, 0xB7, 0x9E, 0xFB, 0x20, 0x91, 0xF9, 0xE3, 0x64, 0xF9,
-    0x6E, 0x6F, 0x91, 0xFD, 0xA7, 0x23, 0xB5, 0x09, 0x08, 0x60, 0xC8, 0x24, 0xBE, 0xF5, 0x3C, 0x5A,
-    0xB4, 0xFE, 0x20, 0x96, 0xF5, 0xAC, 0x5C, 0xB7, 0xAA, 0x1C, 0x1A, 0x14, 0x02, 0xA7, 0x66, 0x39,
-    0x50, 0x74, 0x1E, 0x79, 0x14, 0xEE, 0xF1, 0xEE, 0x04, 0x2C, 0x38, 0xCB, 0x77, 0x30, 0xB1, 0x52,
-    0xE0, 0xA5, 0x10, 0xE5, 0x45, 0xBD, 0x9C, 0x04, 0xAE, 0x0B, 0x6E, 0xA9, 0xBB, 0xC3, 0x21, 0x13,
-    0xC5, 0xC8, 0xC8, 0x82, 0xF6, 0x77, 0xAB, 0xF9, 0x47, 0x97, 0x2E, 0x3B, 0x1C, 0xD4, 0x72, 0xD7,
-    0x3C, 0xBF, 0xEA, 0xF5, 0x4B, 0xE3, 0x61, 0xDD, 0xF5, 0xDA, 0x3C, 0xBD, 0xBC, 0xDC, 0xC9, 0xD8,
-    0xFA, 0x54, 0x23, 0x9F, 0x42, 0x47, 0x1F, 0x8F, 0xF8, 0xC7, 0xC7, 0xFE, 0x5C, 0xE6, 0xF4, 0x18,
-    0xF5, 0xCE, 0xC1, 0x02, 0xE6, 0xCF, 0xD5, 0x62, 0x58, 0xD0, 0xFB, 0x5A, 0xB8, 0x98, 0x40, 0x07,
-    0x9B, 0x98, 0xF5, 0x71, 0xEA, 0x77, 0xAE, 0x05, 0x7A, 0xA1, 0x02, 0x57, 0x29, 0x54, 0xD1, 0x15,
-    0xB0, 0x8F, 0x2C, 0x88, 0xB0, 0x95, 0x30, 0x89, 0x6C, 0x06, 0xB1, 0xF3, 0x4D, 0xD5, 0x3F, 0xD7,
-    0x31, 0x5A, 0x01, 0xB4, 0x4D, 0x00, 0x59, 0x55, 0xA7, 0x49, 0x89, 0xBF, 0xF5, 0xB1, 0x6C, 0xF8,
-    0xAF, 0x89, 0x27, 0x8A, 0x77, 0x2B, 0x85, 0xD5, 0x23, 0xDB, 0x9E, 0x6D, 0x8D, 0x52, 0xE5, 0xF0,
-    0x9B, 0xD9, 0x36, 0xAE, 0x36, 0x09, 0x64, 0x1A, 0x69, 0xDB, 0x7A, 0x91, 0x8E, 0x5E, 0xE9, 0x01,
-    0xDC, 0xFA, 0x48, 0xAB, 0xEE, 0xC3, 0xC5, 0xC2, 0xF5, 0x00, 0x20, 0xF4, 0x6D, 0xB9, 0x36, 0x6C,
-    0xDE, 0x1E, 0xC1, 0x3A, 0xD0, 0xF1, 0x89, 0x1B, 0x1F, 0xBD, 0xB2, 0xAB, 0xF3, 0x52, 0xCF, 0xA5,
-    0x79, 0x91, 0x9E, 0xB9, 0xF2, 0x2E, 0x11, 0x2F, 0x4D, 0x39, 0xFF, 0x46, 0xD4, 0x58, 0x25, 0x99,
-    0xC7, 0x77, 0xFC, 0xD5, 0x8E, 0x4E, 0xD5, 0x82, 0x55, 0x99, 0x96, 0xE6, 0x77, 0x78, 0x43, 0xA4,
-    0xA4, 0x1A, 0xC4, 0xAB, 0x69, 0x0E, 0x6E, 0x88, 0xAC, 0x6E, 0x89, 0xF8, 0x2B, 0x85, 0xC1, 0x2A,
-    0x41, 0x58, 0xB2, 0x04, 0x73, 0x78, 0x64, 0xC6, 0xB4, 0xEF, 0xDA, 0x52, 0x9E, 0xBD, 0xA6, 0x94,
-    0x77, 0xA5, 0x36, 0x55, 0x5E, 0x29, 0x14, 0xC6, 0x5F, 0x58, 0xA1, 0x04, 0x46, 0xBA, 0xAF, 0xE5,
-    0xA7, 0xD6, 0xAB, 0x25, 0xB5, 0x52, 0xD1, 0xE0, 0xAF, 0x2D, 0xDF, 0x01, 0x4C, 0x54, 0xB0, 0x5F,
-    0x74, 0xD8, 0x6B, 0xD5, 0xC1, 0x5D, 0x8A, 0xF9, 0x33, 0x3F, 0x71, 0xA8, 0x44, 0x7D, 0x40, 0x7E,
-    0xFE, 0x84, 0x90, 0xE2, 0x01, 0x81, 0x1A, 0xF4, 0x4A, 0xDB, 0x88, 0x9A, 0x16, 0x7B, 0xC3, 0x3D,
-    0x27, 0x77, 0xC9, 0xE7, 0x29, 0x62, 0xAD, 0x5E, 0xF3, 0x22, 0x7F, 0xAC, 0x8E, 0x82, 0xC7, 0xC0,
-    0x3B, 0xAA, 0x3D, 0x37, 0x03, 0x6A, 0x0F, 0xAE, 0xEE, 0x5C, 0x23, 0x94, 0x57, 0xCA, 0x37, 0x7F,
-    0x2D, 0xF9, 0xD2, 0x7B, 0x1D, 0xE7, 0x12, 0xB2, 0x4F, 0xC4, 0x93, 0xDB, 0xF7, 0xA1, 0xBE, 0x98,
-    0xFD, 0x43, 0x37, 0x33, 0x91, 0xAD, 0x3E, 0x76, 0x8E, 0xB7, 0x3F, 0xA1, 0xDD, 0xAE, 0x22, 0x68,
-    0x8F, 0xDC, 0x80, 0x29, 0xA1, 0xE3, 0x6D, 0x0C, 0x48, 0xD3, 0xEA, 0xC1, 0x96, 0x5E, 0x13, 0xD3,
-    0x13, 0x2E, 0x59, 0x9B, 0xA7, 0x34, 0xA5, 0x2A, 0x78, 0xE4, 0xBC, 0x1F, 0xD7, 0x5F, 0xB3, 0xE5,
-    0x01, 0x78, 0x98, 0x9F, 0xDB, 0xC1, 0x7F, 0x6E, 0x7B, 0xFF, 0x6B, 0xD1, 0xF9, 0x5F, 0xAB, 0xCE,
-    0xFF, 0xBA, 0xBB, 0x87, 0x00, 0xFF, 0xDE, 0xFB, 0x07, 0x10, 0xDF, 0x2A, 0xE5, 0x24, 0xDB, 0x29,
-    0xCD, 0x07, 0xE6, 0x68, 0x7E, 0x8B, 0xE6, 0x78, 0xF2, 0xD8, 0x67, 0xE9, 0x96, 0x57, 0x28, 0x79,
-    0xD9, 0xF2, 0x02, 0x01, 0xBE, 0x66, 0x76, 0x92, 0x8D, 0x29, 0xF6, 0x47, 0x3F, 0x66, 0x31, 0x1B,
-    0x01, 0x0E, 0x0B, 0x50, 0x08, 0x5D, 0x23, 0x66, 0x1A, 0x18, 0xBE, 0x70, 0x31, 0xAC, 0x43, 0xD8,
-    0x6A, 0x58, 0x79, 0xE5, 0x15, 0xD0, 0x90, 0x45, 0xAF, 0x62, 0xB9, 0x93, 0x22, 0x71, 0xE4, 0xC6,
-    0x00, 0x20, 0x86, 0x2C, 0x2A, 0x1A, 0x97, 0x13, 0x21, 0xA4, 0xAB, 0x2F, 0xE8, 0x17, 0xCB, 0x8A,
-    0xFC, 0x54, 0x10, 0xB5, 0x06, 0x3F, 0x76, 0xD8, 0x5F, 0xDE, 0xC0, 0x95, 0x0A, 0x7D, 0xB5, 0xBC,
-    0x4A, 0xDD, 0x6D, 0x78, 0xF7, 0x33, 0x82, 0x83, 0x1E, 0x53, 0x2D, 0x7A, 0x71, 0x69, 0x5E, 0x8A,
-    0x39, 0xA1, 0x93, 0x8D, 0xE9, 0x2E, 0x70, 0x6F, 0xF5, 0x3A, 0x0B, 0x7A, 0x99, 0x9F, 0xD4, 0xA0,
-    0xE7, 0xE1, 0x5B, 0x47, 0x1E, 0x3D, 0x5F, 0x02, 0xFD, 0xE6, 0x55, 0x81, 0x3E, 0xFD, 0x4D, 0x02,
-    0xFD, 0xCC, 0x40, 0xFF, 0x4B, 0xC2, 0xB7, 0x87, 0xF0, 0x1E, 0x5F, 0xB9, 0xE6, 0x5A, 0xD4, 0x17,
-    0x78, 0x77, 0x35, 0x08, 0x99, 0xF3, 0xA7, 0x48, 0xE8, 0x7E, 0x0E, 0xFB, 0x3F, 0xD7, 0x83, 0x5E,
-    0x28, 0xD5, 0x0F, 0xF4, 0xC2, 0x42, 0xA0, 0x99, 0x5F, 0xF3, 0x7A, 0xE7, 0x1A, 0xE3, 0x35, 0xCE,
-    0xD0, 0x6C, 0xAA, 0x7B, 0x2C, 0xEC, 0x10, 0xD3, 0xF2, 0x3E, 0x8C, 0x28, 0x65, 0x53, 0x60, 0xAA,
-    0x23, 0x9D, 0x2F, 0xD2, 0x35, 0x34, 0x0B, 0x2C, 0x3D, 0x6E, 0x40, 0xCD, 0x59, 0x2F, 0x80, 0x68,
-    0x22, 0x95, 0x79, 0x6F, 0xFB, 0xAF, 0xBC, 0xA2, 0x02, 0xA5, 0xA9, 0xFC, 0xDD, 0x39, 0x40, 0x9B,
-    0x69, 0x39, 0xF4, 0x0A, 0x07, 0x8D, 0x15, 0x89, 0xCF, 0x72, 0x8A, 0x67, 0x77, 0x62, 0xBD, 0xC4,
-    0x31, 0xE0, 0x5A, 0xE1, 0xD7, 0xDC, 0x93, 0x7B, 0x2F, 0xBB, 0x41, 0x78, 0xAD, 0x2B, 0x9A, 0xBE,
-    0xC4, 0x2A, 0x77, 0xC6, 0x4C, 0x71, 0xD2, 0xB4, 0xFA, 0x98, 0xD7, 0x03, 0x24, 0x10, 0xAC, 0xCD,
-    0x4A, 0xA3, 0x7A, 0xB2, 0x8E, 0xEA, 0xBB, 0x5A, 0xEC, 0x4E, 0x45, 0x0F, 0x95, 0x13, 0x49, 0x75,
-    0x07, 0xAF, 0x86, 0x4B, 0xCC, 0x68, 0x91, 0x7D, 0xBA, 0x16, 0xA5, 0x34, 0xD7, 0x17, 0xBC, 0x49,
-    0x36, 0x23, 0xB6, 0x53, 0xA3, 0xAC, 0xFB, 0x2F, 0xD2, 0x79, 0x6B, 0x77, 0xF9, 0x46, 0x50, 0x88,
-    0xD0, 0x60, 0x59, 0x26, 0x82, 0xB5, 0x4D, 0xFE, 0x18, 0x3F, 0xA3, 0x03, 0x91, 0x16, 0xE5, 0xA6,
-    0x81, 0xF5, 0x2A, 0x7A, 0x88, 0x64, 0xE4, 0x2E, 0x47, 0xEE, 0x13, 0xE6, 0x2A, 0x2D, 0x44, 0x14,
-    0xC3, 0x42, 0xA5, 0x85, 0x14, 0xA2, 0xC9, 0x1F, 0xBE, 0xE5, 0x3E, 0x5B, 0xF3, 0x85, 0x04, 0x4A,
-    0xC7, 0x84, 0xFE, 0xFA, 0x57, 0xAB, 0xDC, 0xDE, 0xDE, 0x96, 0xB6, 0x6A, 0x42, 0xDE, 0xC1, 0x66,
-    0x8F, 0xC3, 0x4A, 0x81, 0x3E, 0x2D, 0xAA, 0x94, 0x8D, 0xA4, 0x33, 0xA8, 0xD7, 0x88, 0xAD, 0xB7,
-    0xA8, 0x03, 0x34, 0xF6, 0xE3, 0x16, 0x7E, 0xA5, 0x29, 0xA4, 0x17, 0x2E, 0x34, 0xEE, 0x2E, 0x2A,
-    0x3F, 0x45, 0xEB, 0xD2, 0x16, 0x5A, 0xF8, 0xC9, 0x9C, 0x7E, 0x82, 0x02, 0xCD, 0xC3, 0x31, 0x25,
-    0x60, 0xFE, 0xD9, 0x98, 0x7E, 0x86, 0x7D, 0x7F, 0xDC, 0xA7, 0xB8, 0x50, 0x68, 0xCF, 0xBB, 0xF4,
-    0x9C, 0x37, 0xBF, 0xDA, 0x54, 0x6F, 0x58, 0xD5, 0xA9, 0x26, 0x72, 0x25, 0xEF, 0x74, 0x5A, 0xC7,
-    0x2A, 0xAF, 0xF6, 0xB9, 0x22, 0x55, 0xE7, 0xD1, 0xC2, 0xF1, 0x96, 0xE5, 0x57, 0x0A, 0x86, 0x4E,
-    0x24, 0xA4, 0x5B, 0x89, 0xA8, 0x04, 0x7F, 0xEE, 0x96, 0x3B, 0xE9, 0xFE, 0xDA, 0xBF, 0x96, 0xDF,
-    0x79, 0x4B, 0x15, 0xC5, 0x27, 0x7C, 0x32, 0xEF, 0x2A, 0x2C, 0x3C, 0x25, 0x14, 0xA8, 0x86, 0xA5,
-    0x0A, 0xDC, 0xCC, 0x12, 0xB7, 0xE2, 0xB4, 0xB0, 0x86, 0x89, 0x73, 0x48, 0x7C, 0xF6, 0xAB, 0xA1,
-    0x32, 0xA2, 0x42, 0xF2, 0x52, 0xF2, 0x62, 0xA2, 0xC5, 0x8F, 0xEC, 0x10, 0xBE, 0x53, 0xAD, 0xB5,
-    0xA0, 0x58, 0x8C, 0x2A, 0x1A, 0x65, 0x25, 0x9D, 0xDE, 0xF3, 0xA2, 0xB4, 0x24, 0x59, 0x4C, 0x35,
-    0x33, 0xA5, 0x5D, 0x45, 0x13, 0x11, 0x46, 0x48, 0x58, 0x28, 0x59, 0xA4, 0xC7, 0x82, 0xBE, 0xA0,
-    0xE3, 0x56, 0x65, 0xA0, 0x40, 0xAB, 0x40, 0x7A, 0xFD, 0x74, 0x41, 0xCF, 0x9A, 0xA6, 0x78, 0x70,
-    0xE3, 0x1D, 0x86, 0xBF, 0x98, 0xF7, 0xB6, 0x8E, 0xAF, 0x74, 0x7C, 0xA5, 0x03, 0x2B, 0x1D, 0x51,
-    0x78, 0xF8, 0x7B, 0x8C, 0x9B, 0x50, 0xBC, 0x36, 0x5C, 0x78, 0x2B, 0xEC, 0xD5, 0x14, 0xD5, 0x4D,
-    0x30, 0xEB, 0xA2, 0xB1, 0xEA, 0x85, 0xC6, 0xFD, 0xE7, 0x4B, 0x05, 0x7D, 0x77, 0xD1, 0x31, 0xD2,
-    0xCF, 0xB7, 0x5B, 0xBD, 0xCE, 0xC7, 0x8A, 0x34, 0x2B, 0xC3, 0x95, 0xBF, 0x94, 0xF5, 0x20, 0xF7,
-    0x17, 0x0C, 0x99, 0x88, 0x17, 0x4C, 0xC4, 0x9F, 0x7B, 0x08, 0xFC, 0xC5, 0x05, 0x80, 0x64, 0x71,
-    0x42, 0x89, 0x5E, 0xCE, 0xA8, 0xC9, 0x6D, 0x3F, 0xD1, 0xD7, 0xB4, 0xBC, 0x54, 0x1F, 0x5E, 0x58,
-    0xBF, 0xA6, 0xBC, 0xE0, 0x97, 0x60, 0xF5, 0xB8, 0x5F, 0x58, 0x49, 0xD4, 0x85, 0xFF, 0xE5, 0xB2,
-    0x35, 0x55, 0xFE, 0xFF, 0xF3, 0xEF, 0x6D, 0x99, 0xF0, 0x54, 0x9D, 0x50, 0xCA, 0x83, 0xC5, 0xDA,
-    0xDC, 0x74, 0x4B, 0x65, 0x67, 0x5F, 0xDD, 0xC1, 0x5D, 0xFF, 0x5D, 0x85, 0xC7, 0xBF, 0x37, 0xC8,
-    0xBF, 0x9C, 0x7A, 0x2D, 0x78, 0xCC, 0x04, 0xB7, 0x7B, 0x26, 0xF5, 0xBF, 0xBC, 0xB3, 0xBF, 0xFA,
-    0xCF, 0x05, 0x7E, 0x2A, 0x1C, 0x0D, 0xBE, 0xE5, 0x54, 0xB3, 0x79, 0x90, 0x2C, 0xC3, 0x78, 0xD1,
-    0xE5, 0x2B, 0x8C, 0x24, 0x8F, 0xCD, 0xEF, 0xE0, 0xDE, 0xC8, 0xB7, 0xF5, 0x02, 0xDC, 0xB9, 0x34,
-    0x5F, 0x37, 0x27, 0xAE, 0xFF, 0xB2, 0x09, 0xAA, 0xF2, 0xFF, 0x00, 0xDD, 0x5B, 0xBF, 0x8F, 0xDD,
-    0xD8, 0x75, 0xBE, 0x24, 0x2D, 0x71, 0x2D, 0x06, 0xA1, 0x0A, 0x4F, 0x23, 0x01, 0xCB, 0x36, 0x11,
-    0x10, 0xF0, 0x2F, 0xD8, 0x25, 0x17, 0x2E, 0x5C, 0x04, 0x41, 0x26, 0xC0, 0x4C, 0x9A, 0x14, 0x5B,
-    0x47, 0x29, 0xA6, 0x4E, 0xE1, 0xE5, 0x8B, 0x53, 0xB8, 0x70, 0x61, 0x15, 0x81, 0x9B, 0x2D, 0x3C,
-    0x85, 0x03, 0x68, 0x47, 0x08, 0xF4, 0x17, 0x58, 0xE4, 0x6E, 0xCA, 0x14, 0x61, 0x10, 0x18, 0x5B,
-    0xA4, 0x30, 0x17, 0x91, 0x92, 0x38, 0x5B, 0x88, 0x41, 0xE8, 0x98, 0x23, 0x91, 0x3C, 0x39, 0xDF,
-    0x77, 0x2E, 0xDF, 0x7B, 0xA3, 0xD9, 0x1F, 0x8A, 0x81, 0x55, 0x46, 0x1A, 0xCD, 0xBB, 0xF7, 0xE9,
-    0x0D, 0x79, 0x79, 0x7E, 0xDD, 0xF3, 0xE3, 0xBB, 0xE7, 0x39, 0x77, 0xE4, 0x5C, 0x3C, 0x3B, 0x97,
-    0x8A, 0x73, 0x99, 0x7F, 0xA5, 0xFA, 0xFF, 0xF0, 0xD4, 0x5D, 0xF8, 0x29, 0x3A, 0x7B, 0x55, 0xAD,
-    0x73, 0x75, 0xE3, 0x9C, 0xD8, 0x2B, 0x90, 0x8D, 0x0B, 0xF5, 0x15, 0x49, 0xA9, 0x2F, 0x5D, 0x4A,
-    0x5F, 0x09, 0x96, 0x58, 0xEC, 0x95, 0xE9, 0x52, 0xF9, 0xA4, 0xB7, 0xE2, 0x35, 0x6E, 0x57, 0x4B,
-    0xF5, 0x6E, 0x97, 0x61, 0xC8, 0x1B, 0xDC, 0xA4, 0x57, 0x16, 0xA2, 0xCB, 0x88, 0x88, 0x2E, 0xA3,
-    0x43, 0x22, 0xED, 0x1F, 0x90, 0x16, 0xDE, 0x6D, 0xB7, 0x56, 0x83, 0x0E, 0x75, 0xAF, 0x83, 0x70,
-    0xE8, 0x2E, 0x0E, 0xFC, 0x6C, 0x70, 0xA7, 0xAE, 0x96, 0x87, 0x3D, 0x96, 0xEB, 0x75, 0x01, 0x1D,
-    0x62, 0x11, 0xA5, 0xB9, 0xFA, 0x15, 0x96, 0xC1, 0xB3, 0x2B, 0x0C, 0x8F, 0x30, 0x1C, 0xED, 0x33,
-    0x98, 0xE3, 0xAA, 0x40, 0x64, 0x06, 0x03, 0x32, 0x41, 0x12, 0x32, 0x82, 0xAC, 0x3F, 0xEB, 0xF9,
-    0xFC, 0x9B, 0xFE, 0xD9, 0xF6, 0x20, 0x7B, 0xA6, 0xC3, 0x3D, 0x7A, 0x13, 0x18, 0xF9, 0x53, 0xF9,
-    0xC5, 0x21, 0xEE, 0x57, 0x12, 0x42, 0xC1, 0x73, 0x77, 0x63, 0x67, 0x32, 0x31, 0x89, 0x98, 0x78,
-    0x75, 0xF9, 0x89, 0x62, 0x1D, 0xB8, 0x00, 0x96, 0x49, 0xF5, 0xCA, 0x45, 0xC9, 0x58, 0xC7, 0x19,
-    0x3C, 0xF8, 0x71, 0x72, 0x6F, 0x39, 0xFD, 0xCD, 0x83, 0xBF, 0xC9, 0x5D, 0xFD, 0x54, 0xEA, 0xA6,
-    0xD2, 0x0F, 0x37, 0x19, 0x2E, 0x4D, 0x96, 0xF7, 0x27, 0x97, 0xF6, 0xE1, 0xE2, 0xB2, 0xCE, 0x89,
-    0xCB, 0x5B, 0x1D, 0x32, 0x0E, 0xBD, 0x0E, 0xE9, 0xA8, 0xCA, 0x4D, 0xB1, 0x0C, 0x96, 0x54, 0xD1,
-    0x88, 0x34, 0xC5, 0x87, 0x73, 0xB5, 0xF9, 0x5D, 0xE7, 0xDE, 0x36, 0xC6, 0xA1, 0xB6, 0x6A, 0x80,
-    0x02, 0xA5, 0xD7, 0x31, 0x94, 0x46, 0x15, 0xAA, 0x6F, 0x94, 0x2D, 0xD0, 0x2B, 0x0D, 0x28, 0x95,
-    0x16, 0x94, 0xD6, 0x6D, 0x0D, 0x13, 0xF8, 0x0C, 0x0C, 0x17, 0xFF, 0xAD, 0x77, 0xB8, 0xE2, 0xF9,
-    0x42, 0xD9, 0x4D, 0x64, 0x60, 0xE0, 0x48, 0x76, 0xF5, 0x39, 0xE4, 0x68, 0xE3, 0x47, 0xA5, 0x73,
-    0xCB, 0xFB, 0xB5, 0xF7, 0x97, 0x63, 0x2A, 0xDC, 0xD4, 0xAE, 0x1F, 0x55, 0x94, 0xB8, 0x49, 0xC3,
-    0x15, 0x14, 0x70, 0xC5, 0x91, 0x22, 0x3F, 0x76, 0x75, 0xF9, 0xE5, 0xFF, 0xEE, 0x5E, 0xB0, 0xD3,
-    0xAF, 0xBF, 0xF6, 0xD6, 0x47, 0x0E, 0x5A, 0xE9, 0x40, 0xD8, 0x08, 0xB1, 0xA8, 0xB1, 0x0C, 0x61,
-    0xE7, 0x2A, 0x68, 0x94, 0x03, 0xAD, 0x2D, 0x07, 0xD1, 0x64, 0x29, 0x07, 0x9D, 0xF2, 0x14, 0xA2,
-    0x51, 0xE1, 0x44, 0xB3, 0x8A, 0x24, 0x9A, 0x74, 0x13, 0xE8, 0x3B, 0x1D, 0xA4, 0xC4, 0x1F, 0x7E,
-    0xA3, 0x42, 0xA4, 0xBD, 0xE4, 0x30, 0x8F, 0x98, 0x92, 0xA8, 0x28, 0x14, 0x3F, 0x9C, 0x62, 0x78,
-    0x74, 0x58, 0x8D, 0xD0, 0x41, 0x8F, 0xA1, 0xD1, 0x6B, 0x67, 0x52, 0xEC, 0x0D, 0xB0, 0xA9, 0xCB,
-    0xA2, 0x93, 0x8D, 0x8A, 0x77, 0x53, 0xB4, 0x52, 0xDE, 0x2A, 0xFF, 0x7C, 0x8F, 0xAF, 0x44, 0xCE,
-    0x39, 0x0B, 0xAD, 0x59, 0xA5, 0xF9, 0x27, 0x27, 0xA4, 0xB2, 0x55, 0xEB, 0xF1, 0xF6, 0xAC, 0x5B,
-    0x29, 0xD4, 0xE5, 0x1F, 0x27, 0xBD, 0x8B, 0x3A, 0xDD, 0x53, 0xE1, 0xA0, 0xFB, 0x2C, 0x5B, 0x66,
-    0xA7, 0xF6, 0x51, 0x16, 0x9B, 0x6F, 0xB9, 0xEF, 0x3B, 0xB5, 0x1E, 0x6E, 0x83, 0xC2, 0x81, 0xAC,
-    0xDC, 0xBD, 0x1B, 0x60, 0xCE, 0xDC, 0x3B, 0x36, 0x97, 0xEF, 0x04, 0xE3, 0x85, 0x79, 0xFD, 0xFB,
-    0xBB, 0xFE, 0xFA, 0xDC, 0xCD, 0xBC, 0x3F, 0x2B, 0x2B, 0x55, 0xFE, 0x07, 0xBA, 0x7E, 0xF1, 0xE4,
-    0xEF, 0xF4, 0x6F, 0x71, 0x9B, 0xCA, 0xAC, 0xF7, 0x44, 0x43, 0x20, 0x63, 0xAC, 0x12, 0xC0, 0x65,
-    0x19, 0xB6, 0x9D, 0x0A, 0xB1, 0xD6, 0x4B, 0xD3, 0x73, 0x77, 0x1B, 0x9F, 0xF9, 0xED, 0xE0, 0x85,
-    0x8A, 0x9F, 0x83, 0x72, 0x65, 0xB1, 0xFA, 0xA4, 0x0F, 0xE5, 0x79, 0xAF, 0xFB, 0xB5, 0x4B, 0x87,
-    0xA2, 0xCD, 0xBB, 0xBC, 0x29, 0x1A, 0xBC, 0x8A, 0x8D, 0xFE, 0x2B, 0xAB, 0x4D, 0x55, 0x16, 0x8D,
-    0xB8, 0xE2, 0x73, 0xB5, 0x72, 0x79, 0xE4, 0x92, 0xE9, 0xE7, 0x76, 0x5F, 0x58, 0xBA, 0x7B, 0x2A,
-    0x91, 0x56, 0xF9, 0x75, 0xD9, 0x08, 0x3B, 0xAB, 0x46, 0xB8, 0x0E, 0xE9, 0x55, 0x03, 0x91, 0x34,
-    0x2A, 0xEE, 0x54, 0xBE, 0xAB, 0x62, 0x2B, 0xE6, 0x54, 0x6D, 0xB6, 0x1E, 0x73, 0x5C, 0x32, 0xC0,
-    0x35, 0x15, 0x23, 0x4C, 0x3C, 0x9F, 0xE8, 0xB2, 0xE6, 0x48, 0x55, 0x9E, 0x40, 0xC7, 0x7A, 0x17,
-    0xF6, 0x24, 0x74, 0xAB, 0xF2, 0x7D, 0xEC, 0xFE, 0xF2, 0xA2, 0x2B, 0xC4, 0x86, 0x7C, 0x61, 0xC0,
-    0x3E, 0xFA, 0xCA, 0x21, 0x38, 0xBA, 0x76, 0x7C, 0x94, 0xE3, 0x6A, 0xFD, 0x1D, 0x0B, 0x19, 0x0E,
-    0x8E, 0x0F, 0xFF, 0xEF, 0xDA, 0xCD, 0x9F, 0x6D, 0xA8, 0xDD, 0x5C, 0x46, 0x6A, 0x17, 0x52, 0x84,
-    0x76, 0xF3, 0xB2, 0xA6, 0x76, 0xF3, 0xB2, 0xA0, 0x76, 0x31, 0xAB, 0x76, 0x39, 0xAB, 0x76, 0x75,
-    0x5E, 0xA0, 0x55, 0x6E, 0x54, 0x9B, 0x3B, 0x68, 0xD7, 0xE5, 0x0F, 0x7A, 0x6A, 0x37, 0xFF, 0xEE,
-    0x40, 0xED, 0xE6, 0xE5, 0x44, 0xED, 0xE6, 0xE5, 0x23, 0x6A, 0x17, 0xF7, 0x43, 0xBB, 0x79, 0x99,
-    0x7F, 0x0C, 0xED, 0xE6, 0x65, 0xFA, 0xE9, 0x6F, 0xA9, 0x5D, 0xF8, 0x9F, 0x0E, 0x43, 0x0B, 0x81,
-    0x35, 0x77, 0xCE, 0xCE, 0xCE, 0x36, 0xF8, 0x3C, 0x50, 0x97, 0x92, 0xE8, 0x46, 0x50, 0x67, 0x56,
-    0x16, 0x4F, 0xD4, 0xB3, 0x6D, 0xF2, 0xA6, 0xD2, 0xD5, 0x2B, 0x97, 0xB6, 0x55, 0x99, 0xB5, 0x45,
-    0x5B, 0x29, 0x9B, 0xB2, 0xD1, 0xDD, 0xAA, 0xEB, 0xAB, 0x54, 0x6E, 0x95, 0xEB, 0xA6, 0x91, 0xAF,
-    0x18, 0x0E, 0x8E, 0xE5, 0xF8, 0xE8, 0x05, 0x25, 0xDD, 0x39, 0x93, 0xB3, 0xFB, 0x5F, 0x7D, 0x9B,
-    0x73, 0x67, 0x5F, 0xA5, 0x65, 0xE5, 0x52, 0x79, 0xD4, 0x4D, 0x2F, 0x5D, 0xB8, 0xA8, 0x6F, 0x6A,
-    0x73, 0x95, 0x46, 0x8E, 0xD0, 0xD8, 0x32, 0x1C, 0x22, 0xFC, 0x65, 0x23, 0x1C, 0x25, 0xDD, 0x2A,
-    0xBC, 0x1D, 0xE2, 0x9A, 0xBA, 0xB7, 0x52, 0x77, 0xBC, 0x3B, 0x3E, 0x56, 0xBA, 0x6F, 0x2F, 0x5C,
-    0x83, 0x2E, 0xE8, 0x1C, 0x5E, 0x2E, 0xC3, 0xAB, 0x53, 0x41, 0x34, 0xAE, 0x52, 0xB1, 0xD5, 0x7A,
-    0xFF, 0x03, 0x90, 0x52, 0x43, 0xBA, 0x9B, 0x9B, 0x4E, 0x36, 0x1F, 0x7C, 0x28, 0x65, 0xA5, 0x22,
-    0x55, 0xB3, 0x71, 0xD7, 0xCF, 0x94, 0xFF, 0xB3, 0xD3, 0x50, 0x3A, 0x35, 0x57, 0x7D, 0x40, 0x3E,
-    0xB8, 0xAA, 0x71, 0x07, 0x90, 0xE4, 0x31, 0x7E, 0x61, 0xB5, 0xB1, 0x45, 0xE2, 0xC4, 0x82, 0xB1,
-    0x8F, 0xC5, 0x20, 0x46, 0x5F, 0xF0, 0xE6, 0xB8, 0x6D, 0x62, 0x08, 0xC2, 0xA4, 0x2F, 0x78, 0x3C,
-    0x7D, 0xC1, 0xFF, 0xEA, 0x0B, 0x44, 0xE9, 0x0B, 0xBE, 0x57, 0x5F, 0xD0, 0x68, 0xDD, 0x33, 0x46,
-    0x21, 0x40, 0x70, 0x4A, 0x18, 0xFA, 0xC7, 0x5C, 0x27, 0xE8, 0x9C, 0x09, 0x80, 0xCC, 0xCC, 0x01,
-    0x64, 0x14, 0xD0, 0x50, 0x75, 0xA4, 0xE1, 0x9A, 0x59, 0xB7, 0xDB, 0x45, 0x3F, 0x1F, 0xFE, 0x98,
-    0x19, 0x6C, 0xC3, 0xA0, 0x45, 0xF9, 0x6D, 0x8A, 0x60, 0x71, 0x40, 0x03, 0xC5, 0xDD, 0x33, 0x55,
-    0x47, 0xBD, 0x66, 0x05, 0xC2, 0x58, 0x22, 0x0C, 0xEB, 0x05, 0x3D, 0x77, 0xC1, 0x38, 0x7F, 0x71,
-    0xAC, 0xF6, 0xC6, 0xCB, 0x7F, 0xB5, 0xBB, 0x6C, 0x85, 0x84, 0x63, 0xC8, 0xD1, 0x9D, 0x70, 0x74,
-    0xD1, 0x37, 0x30, 0x86, 0x7D, 0xEE, 0xAE, 0x77, 0xF9, 0x54, 0xE1, 0xDF, 0x58, 0xF4, 0xD7, 0xCA,
-    0x68, 0x74, 0xF1, 0xC8, 0x9C, 0x4B, 0x45, 0x57, 0x37, 0xEF, 0xC9, 0x46, 0x2D, 0x44, 0x15, 0x5C,
-    0x3F, 0x56, 0x35, 0x7E, 0x04, 0x11, 0xD5, 0x53, 0x2C, 0x53, 0x4E, 0x4F, 0x91, 0xFF, 0xB8, 0x7F,
-    0x4B, 0x6D, 0x44, 0x4D, 0x4D, 0x13, 0x30, 0x35, 0x34, 0x55, 0xB7, 0x9A, 0x0A, 0xB2, 0x25, 0xFD,
-    0x2D, 0xB1, 0x15, 0x6A, 0x75, 0xF7, 0x93, 0x7A, 0xE0, 0xE2, 0x33, 0xA9, 0x1A, 0xA9, 0x4B, 0x95,
-    0x91, 0xFE, 0x2E, 0x12, 0xCE, 0x12, 0x4D, 0xD5, 0xD3, 0xA1, 0x50, 0x8F, 0xAA, 0x57, 0xAA, 0xC3,
-    0xF9, 0xB6, 0xBB, 0xEE, 0x82, 0x45, 0x37, 0x2E, 0x3C, 0x9C, 0xDA, 0xF1, 0x46, 0x3A, 0x9D, 0x2B,
-    0x68, 0x59, 0x85, 0x5E, 0xF7, 0xAA, 0x07, 0x7A, 0xC6, 0x62, 0x52, 0x6D, 0xC9, 0x50, 0x4C, 0xA1,
-    0xB4, 0xF5, 0x90, 0xC8, 0x0F, 0xA4, 0xCD, 0x96, 0x58, 0x03, 0xD3, 0x94, 0x29, 0x95, 0xBD, 0xA6,
-    0x73, 0x79, 0x93, 0xF6, 0x2E, 0x71, 0x61, 0xE3, 0xF7, 0x8B, 0x92, 0x0D, 0x2B, 0x86, 0xFB, 0x05,
-    0x8D, 0x33, 0x58, 0x8B, 0x74, 0xCB, 0x84, 0x42, 0xAF, 0x13, 0xAB, 0x91, 0xE9, 0xEE, 0x4D, 0x07,
-    0x97, 0xFD, 0x78, 0x00, 0x23, 0xDF, 0xD6, 0xB7, 0x48, 0x24, 0xB3, 0x9E, 0x2E, 0x2E, 0xEF, 0x23,
-    0x86, 0x96, 0x2E, 0x81, 0x09, 0x14, 0x6D, 0xD6, 0x87, 0x67, 0xCA, 0x69, 0x81, 0x1C, 0xA4, 0x6E,
-    0xA4, 0xCC, 0x55, 0x24, 0x9F, 0xE8, 0x5B, 0x8D, 0xBE, 0x3F, 0x9C, 0x02, 0x5D, 0xF0, 0x38, 0xD5,
-    0x48, 0x81, 0xAC, 0xB2, 0x4D, 0x3F, 0xC7, 0x8E, 0xDB, 0x14, 0xFF, 0x38, 0xC0, 0x5B, 0x8A, 0x92,
-    0x15, 0xCD, 0xE1, 0xA4, 0x12, 0xD3, 0xE4, 0xE7, 0xFC, 0xE4, 0xD7, 0xBA, 0x74, 0x82, 0x54, 0xA3,
-    0x6A, 0x52, 0x4C, 0x52, 0xDE, 0x38, 0x93, 0xFF, 0x88, 0x60, 0x8B, 0x55, 0x93, 0x4C, 0x7E, 0x9F,
-    0x99, 0x4B, 0xF1, 0x3C, 0xAC, 0x4C, 0x78, 0x2E, 0x9C, 0x67, 0x63, 0xE5, 0x63, 0x65, 0x64, 0xE5,
-    0x64, 0xCB, 0xCA, 0xCA, 0xCB, 0xCA, 0x8C, 0xFE, 0x31, 0xA5, 0x41, 0x6B, 0x30, 0xEB, 0xE1, 0x20,
-    0xAB, 0xA6, 0xFA, 0x04, 0x81, 0x5F, 0x19, 0xFA, 0x1E, 0x3C, 0x7D, 0xFD, 0xF7, 0x0B, 0xDD, 0x88,
-    0xFC, 0x68, 0xA2, 0x2B, 0x39, 0xCE, 0xF6, 0xDC, 0x09, 0x5D, 0xCA, 0x86, 0xAF, 0xD0, 0x67, 0xD6,
-    0x78, 0x38, 0xDC, 0x4B, 0xCA, 0x5C, 0x8C, 0x97, 0xC2, 0xCD, 0xC0, 0x22, 0xB8, 0x9D, 0x84, 0x99,
-    0xD4, 0x06, 0x0F, 0xD7, 0x4D, 0x53, 0x42, 0x94, 0x70, 0x3B, 0xE4, 0xCE, 0xBB, 0x1E, 0x5C, 0x04,
-    0xF7, 0xA3, 0x32, 0xB2, 0x2C, 0x08, 0x17, 0xC1, 0x0D, 0xE1, 0xD1, 0x18, 0x0A, 0x32, 0xD2, 0xC1,
-    0xB2, 0xE0, 0x92, 0x42, 0x0A, 0x6A, 0xE1, 0xA3, 0xE1, 0x9A, 0x52, 0x5C, 0xA6, 0xEE, 0x09, 0xD4,
-    0x41, 0x74, 0x26, 0xBC, 0xEA, 0x63, 0x71, 0x77, 0x4E, 0xD5, 0x55, 0xFD, 0xB5, 0xAA, 0xA9, 0x7F,
-    0xF7, 0x81, 0xFC, 0xF1, 0xA8, 0x0E, 0xAA, 0x90, 0x25, 0x57, 0x25, 0xA9, 0xC3, 0x1F, 0xAB, 0x26,
-    0x93, 0x46, 0x5D, 0x97, 0xFA, 0x78, 0x24, 0x8F, 0x2A, 0x7E, 0xC1, 0x9D, 0xC9, 0x14, 0x4D, 0x98,
-    0xB3, 0x3E, 0xE9, 0x99, 0x4E, 0xB6, 0x79, 0x0B, 0x7A, 0xD5, 0x65, 0xFE, 0x44, 0x0E, 0xC1, 0x37,
-    0xB3, 0x25, 0x7D, 0x38, 0x23, 0x8B, 0xF2, 0x7D, 0xF6, 0x60, 0xB9, 0x47, 0xA1, 0x83, 0x20, 0x08,
-    0x3D, 0x99, 0xBC, 0xAF, 0x40, 0x36, 0x7F, 0x7D, 0x30, 0xC7, 0x52, 0x40, 0x81, 0xB3, 0x95, 0x1D,
-    0x99, 0x7E, 0x16, 0x94, 0xBB, 0x58, 0x7B, 0xE7, 0x9E, 0x55, 0x31, 0xF4, 0x5D, 0x8D, 0x3A, 0x81,
-    0x12, 0xFC, 0x21, 0xB4, 0x24, 0xFA, 0x88, 0x1C, 0xFF, 0x9D, 0x2C, 0xF1, 0xA4, 0xAF, 0x6B, 0xDD,
-    0x4D, 0xE9, 0xAF, 0xF7, 0x4A, 0xC7, 0x80, 0x2C, 0x55, 0xFD, 0x87, 0x66, 0x0B, 0x72, 0xCF, 0xDD,
-    0xFD, 0x19, 0x16, 0xBB, 0x61, 0xE1, 0x22, 0x16, 0x9F, 0x4A, 0x9B, 0x29, 0x89, 0x6D, 0x0A, 0x93,
-    0x91, 0x49, 0x56, 0x69, 0xD8, 0x8B, 0xF7, 0x7A, 0x03, 0xFF, 0x96, 0x5A, 0xB8, 0xCC, 0xAC, 0xA6,
-    0x28, 0x6C, 0xAA, 0x7C, 0x85, 0xF1, 0xB4, 0x67, 0x48, 0xFD, 0x69, 0xCF, 0x95, 0xC1, 0x86, 0x1A,
-    0x26, 0xA7, 0x74, 0xCA, 0x98, 0x1E, 0x8C, 0x34, 0xAF, 0xA2, 0xE7, 0x54, 0x77, 0xCC, 0x35, 0x35,
-    0x6B, 0x9F, 0x70, 0xDB, 0x06, 0x93, 0xC6, 0x02, 0x4C, 0x89, 0xAC, 0x15, 0x8D, 0x58, 0x44, 0xF2,
-    0x39, 0x37, 0x13, 0xDB, 0x67, 0x67, 0x0F, 0x17, 0x96, 0x20, 0x6A, 0xF5, 0x91, 0xC5, 0xB0, 0x58,
-    0x85, 0x10, 0x0B, 0xFD, 0x93, 0x4E, 0x10, 0xA8, 0x9A, 0x59, 0x31, 0x59, 0xAD, 0x00, 0x56, 0xCE,
-    0x4E, 0x8D, 0xDD, 0x66, 0xCF, 0xBD, 0x7B, 0x4F, 0x5E, 0x74, 0x26, 0x02, 0x93, 0xC4, 0x85, 0x12,
-    0xEB, 0xF5, 0x66, 0x1A, 0xA9, 0x03, 0x6A, 0xB5, 0xD9, 0x58, 0xE1, 0x87, 0xD9, 0x39, 0xF9, 0xAC,
-    0x34, 0x47, 0xC1, 0xE3, 0x4B, 0xA4, 0x03, 0xC1, 0xD1, 0x05, 0x55, 0xBF, 0xDE, 0x4C, 0x1F, 0x52,
-    0x83, 0xE9, 0xCC, 0x7A, 0xA0, 0x90, 0xCF, 0x59, 0x82, 0x0B, 0xC9, 0x5E, 0x4E, 0x58, 0x31, 0xEB,
-    0x46, 0x2F, 0x79, 0xE1, 0xCD, 0x37, 0x46, 0xD3, 0x1E, 0xA3, 0xE8, 0xE8, 0x0A, 0xF3, 0x9E, 0xAE,
-    0xBD, 0xE8, 0x65, 0xEF, 0x7F, 0x37, 0x36, 0x77, 0xDC, 0xA5, 0x9F, 0xD7, 0x9B, 0xE9, 0x6B, 0xC6,
-    0x44, 0xCD, 0xD4, 0x2B, 0x64, 0x45, 0xA3, 0x09, 0x3F, 0x71, 0x92, 0xB8, 0x2B, 0xF6, 0xA6, 0xE8,
-    0xD7, 0xCB, 0xDE, 0x25, 0x1E, 0x14, 0x59, 0x6F, 0x7F, 0x13, 0x24, 0x81, 0x85, 0x8C, 0xF2, 0x62,
-    0xFB, 0x0E, 0x6F, 0x3C, 0xD8, 0x23, 0xC4, 0x36, 0x9C, 0x65, 0xA4, 0x7C, 0x97, 0x88, 0xCF, 0x69,
-    0x75, 0x31, 0xEF, 0x05, 0x75, 0x3D, 0x9F, 0xD2, 0x22, 0x5B, 0xF2, 0xC0, 0x97, 0x46, 0xC4, 0xD1,
-    0xC7, 0x89, 0xA6, 0x1A, 0xBC, 0xA4, 0x50, 0x18, 0x18, 0x7A, 0x82, 0x8D, 0x35, 0x5A, 0x2E, 0x4C,
-    0x18, 0x09, 0x75, 0xAC, 0x13, 0xDB, 0x6C, 0xA2, 0x99, 0xC5, 0x13, 0x54, 0x8C, 0xE1, 0xFA, 0x50,
-    0xB8, 0x20, 0xFF, 0x2E, 0xB5, 0x14, 0xDC, 0x17, 0x59, 0xDC, 0x8E, 0x1A, 0x01, 0xCF, 0x1E, 0x1A,
-    0x3B, 0x7A, 0xBF, 0x79, 0xE8, 0x80, 0x98, 0x07, 0xCA, 0xAE, 0xC8, 0x83, 0x33, 0x16, 0xFD, 0x32,
-    0xDE, 0x9D, 0x2D, 0xC6, 0x79, 0x49, 0x51, 0xE4, 0xEB, 0x3A, 0xFC, 0xB9, 0xCD, 0xF2, 0x94, 0xB2,
-    0x48, 0x48, 0x10, 0x8B, 0x39, 0xA5, 0xF7, 0x3F, 0xA5, 0x81, 0x43, 0x8C, 0x35, 0xD3, 0xEB, 0x28,
-    0x88, 0xC6, 0x38, 0x81, 0x28, 0x16, 0x13, 0xC3, 0x6E, 0xAC, 0xC8, 0xBC, 0x31, 0x5E, 0xEF, 0xD0,
-    0x9D, 0x15, 0x50, 0xDB, 0xFB, 0xC4, 0x8C, 0xB0, 0xB2, 0x7B, 0x17, 0x38, 0x97, 0x5C, 0x9E, 0x9C,
-    0xB4, 0xA4, 0xB9, 0x25, 0xE3, 0x2D, 0x15, 0xD1, 0xB2, 0xD2, 0x04, 0x9D, 0x66, 0x92, 0xCB, 0x5E,
-    0x54, 0xAA, 0xBA, 0x6D, 0x34, 0xBA, 0x69, 0xA8, 0x0E, 0x3F, 0x2F, 0x28, 0xA8, 0xDC, 0xCA, 0xED,
-    0x1B, 0x1F, 0xB9, 0x2D, 0xBD, 0x91, 0x97, 0x11, 0xE5, 0xC8, 0x4D, 0x8E, 0xF2, 0x1B, 0x96, 0x5D,
-    0xEE, 0xCC, 0x1A, 0x8F, 0x4C, 0x38, 0xA6, 0x5B, 0x84, 0xAB, 0x59, 0x05, 0x38, 0xED, 0x0A, 0x19,
-    0xCF, 0xF6, 0x3E, 0xC3, 0x83, 0x37, 0xA3, 0xD1, 0x79, 0xED, 0x52, 0x90, 0x81, 0x07, 0x09, 0x7F,
-    0xA1, 0xBA, 0x8D, 0xBC, 0x59, 0x6D, 0x38, 0x96, 0xDB, 0xB4, 0xC2, 0x63, 0x87, 0xB2, 0xAA, 0x7A,
-    0xE3, 0x1F, 0x68, 0x3A, 0xB2, 0x11, 0x96, 0xBA, 0x17, 0x9A, 0xA3, 0x3D, 0x45, 0x18, 0x45, 0x26,
-    0x0E, 0xD3, 0xE9, 0x91, 0x7B, 0x9D, 0x38, 0x62, 0xDC, 0x35, 0x6F, 0x93, 0x10, 0x56, 0xC8, 0xCF,
-    0xB1, 0x54, 0xDD, 0xD6, 0xC0, 0x69, 0x90, 0x03, 0x6B, 0xC4, 0xDD, 0x2A, 0xE9, 0x75, 0xE0, 0xC8,
-    0x5C, 0x45, 0x07, 0xF4, 0xC4, 0xC2, 0x8A, 0x1F, 0x3B, 0x2C, 0x7B, 0xA3, 0xFC, 0xFD, 0x17, 0xC3,
-    0xCA, 0x95, 0xE7, 0xE8, 0xEE, 0xE9, 0xFA, 0xC4, 0x7C, 0x5C, 0x31, 0x4F, 0x56, 0x58, 0x06, 0xA9,
-    0x1C, 0xEC, 0x38, 0x19, 0x58, 0x74, 0x63, 0x41, 0x0E, 0xAD, 0xCF, 0xA7, 0x08, 0xF6, 0xD6, 0x17,
-    0x50, 0x7D, 0x02, 0x0E, 0x48, 0xD0, 0x6D, 0x20, 0x81, 0xA4, 0x8F, 0xE4, 0x91, 0x3A, 0x12, 0x47,
-    0x54, 0x81, 0xFE, 0x97, 0xA2, 0xB0, 0xE3, 0x82, 0xC9, 0xBB, 0x8F, 0xC4, 0x53, 0xDC, 0x82, 0xD4,
-    0xC6, 0x86, 0x6D, 0xD6, 0x5E, 0xCC, 0x5B, 0x11, 0x05, 0x5E, 0x08, 0x64, 0x96, 0xF2, 0xBB, 0x76,
-    0xB8, 0xAF, 0x80, 0xC1, 0x19, 0xDD, 0x46, 0xB8, 0x51, 0xBE, 0xA6, 0x82, 0xD5, 0xBE, 0x2B, 0xEB,
-    0xB6, 0xA3, 0x81, 0xFA, 0xA4, 0xDD, 0x8F, 0x5F, 0x23, 0xE3, 0x4B, 0x67, 0x03, 0xFB, 0x4A, 0xAD,
-    0xCC, 0xFC, 0xB1, 0x02, 0xD9, 0xF1, 0xAC, 0xAC, 0x0C, 0x5D, 0x27, 0x96, 0x96, 0xF1, 0xC1, 0x0C,
-    0xB0, 0x81, 0xFC, 0x52, 0xD9, 0x88, 0x17, 0x1C, 0xED, 0x64, 0x03, 0xAA, 0x52, 0xDD, 0x21, 0x07,
-    0xAF, 0x11, 0x47, 0x16, 0xBA, 0xA2, 0x49, 0x9F, 0xFA, 0x3D, 0x54, 0xAA, 0x7F, 0x88, 0x01, 0xB5,
-    0xDE, 0xFD, 0x0B, 0x27, 0x53, 0x57, 0xC4, 0xA4, 0x62, 0xD1, 0xAA, 0x94, 0x7F, 0x5B, 0xFC, 0x76,
-    0x69, 0x6C, 0xEA, 0x2D, 0xA8, 0x12, 0x6C, 0x23, 0x5D, 0x00, 0xDB, 0x16, 0x2E, 0x87, 0x47, 0x15,
-    0x06, 0x02, 0x55, 0x03, 0x9F, 0x5E, 0x33, 0x52, 0xDF, 0x92, 0x67, 0xA7, 0x89, 0x10, 0xA8, 0xD2,
-    0x09, 0xA8, 0x55, 0xCA, 0xA9, 0xD3, 0x49, 0xB3, 0x9A, 0x36, 0xB5, 0x44, 0x26, 0x9F, 0xC9, 0x40,
-    0x31, 0x91, 0x05, 0xAD, 0xCC, 0x95, 0x89, 0x80, 0xC2, 0xD0, 0x77, 0x08, 0xF4, 0xEE, 0x84, 0xAE,
-    0xE2, 0xA1, 0xC8, 0x96, 0x06, 0x0B, 0xDB, 0x6B, 0x70, 0x2F, 0x50, 0xC6, 0x5A, 0xD0, 0x28, 0x2D,
-    0x26, 0x64, 0x73, 0x68, 0x91, 0x57, 0xFE, 0xA5, 0x77, 0x6B, 0xC4, 0xD7, 0x3F, 0xCF, 0x95, 0x29,
-    0x7D, 0x88, 0xD7, 0xAA, 0xE0, 0x62, 0xB2, 0x0F, 0x30, 0xB0, 0x64, 0xF9, 0x0C, 0x5A, 0x52, 0xE5,
-    0x9A, 0xE8, 0xA7, 0x9F, 0x33, 0xA5, 0x2A, 0x5E, 0x0C, 0x3E, 0x49, 0x66, 0x9B, 0x0D, 0x19, 0x9D,
-    0xE9, 0x2A, 0x8A, 0x7F, 0x17, 0x0A, 0xBA, 0xFA, 0x57, 0xA1, 0xFF, 0xA8, 0xFF, 0x59, 0x0B, 0x29,
-    0xB8, 0xAA, 0x8F, 0xA5, 0xC1, 0x59, 0x90, 0x34, 0xDB, 0xB9, 0xAD, 0xE0, 0xBC, 0x36, 0x75, 0x5F,
-    0x77, 0x28, 0xB7, 0x8A, 0x9E, 0x40, 0x6B, 0x59, 0x0C, 0x62, 0xB1, 0x60, 0xB4, 0x0C, 0x2F, 0x9B,
-    0x31, 0x2F, 0xAA, 0x48, 0x20, 0xFA, 0x33, 0xF4, 0x52, 0xE2, 0x51, 0xAC, 0xDA, 0x52, 0x48, 0x4C,
-    0xA8, 0xDB, 0x10, 0xEA, 0xD2, 0x47, 0x9A, 0x66, 0xF0, 0xC8, 0xD9, 0x8E, 0x9F, 0xEA, 0xC9, 0x76,
-    0x55, 0xB9, 0x57, 0xD5, 0x07, 0xDE, 0x30, 0x6B, 0xAB, 0xEA, 0x73, 0xCB, 0x7B, 0x93, 0xE1, 0x72,
-    0x71, 0x7F, 0x9B, 0x69, 0x5C, 0x60, 0x52, 0x4E, 0x76, 0x32, 0x07, 0x6A, 0x23, 0x9F, 0x0B, 0x6C,
-    0x7A, 0x04, 0xB6, 0x84, 0xA4, 0x29, 0x03, 0x4C, 0x8B, 0x43, 0x32, 0x1A, 0x82, 0x2A, 0x0F, 0x79,
-    0x53, 0x62, 0xF9, 0xE8, 0x6E, 0x42, 0xEA, 0xA4, 0x13, 0x7C, 0x15, 0xF2, 0xC4, 0x7E, 0x3B, 0xE9,
-    0xD5, 0xB0, 0x31, 0x35, 0x06, 0x4C, 0x7A, 0x35, 0x3E, 0xC4, 0x21, 0xD3, 0xC0, 0xC3, 0x50, 0x1E,
-    0x80, 0xF4, 0xB0, 0xB8, 0x94, 0xE7, 0x4D, 0x4F, 0x6A, 0xEA, 0x87, 0x66, 0x1A, 0x5B, 0x58, 0x58,
-    0xCF, 0x1C, 0x32, 0xDB, 0xFB, 0xDB, 0xE3, 0x28, 0x0F, 0x70, 0x04, 0x96, 0x97, 0xAD, 0xA5, 0xBE,
-    0x41, 0xB8, 0xD9, 0xB8, 0x8F, 0x6F, 0x1C, 0xB8, 0x37, 0x8D, 0xF7, 0x3B, 0x1F, 0xF9, 0xD3, 0x18,
-    0x63, 0x9D, 0xFA, 0x4F, 0x67, 0x5F, 0x07, 0xF2, 0x78, 0x52, 0x0B, 0x90, 0x81, 0x99, 0xD4, 0xBE,
-    0xE2, 0xDF, 0x08, 0xDE, 0x8F, 0xA8, 0x4F, 0xDD, 0x54, 0x8F, 0xE8, 0xC9, 0x9E, 0xCD, 0x56, 0x56,
-    0xD0, 0x07, 0x7E, 0x48, 0x63, 0xF8, 0xC0, 0xB6, 0xC0, 0x77, 0xDC, 0xB7, 0xDE, 0x38, 0x9B, 0xB7,
-    0xEA, 0x6C, 0x4C, 0x3B, 0x66, 0x31, 0xD4, 0xF4, 0x3A, 0x8D, 0x2C, 0x25, 0xC2, 0xD3, 0x1B, 0x9B,
-    0x4B, 0x85, 0xFF, 0xEB, 0xCF, 0x7B, 0xE0, 0x54, 0x99, 0xC9, 0xC6, 0xBD, 0x8D, 0x74, 0xBA, 0xDA,
-    0x14, 0x63, 0x88, 0xC3, 0xFF, 0x04, 0xC7, 0x2E, 0x0F, 0x71, 0xFA, 0xCF, 0x87, 0x59, 0x4C, 0x5B,
-    0x8F, 0xC6, 0x2B, 0x65, 0x26, 0xC0, 0x8A, 0xB1, 0x68, 0x44, 0xCA, 0x26, 0xF5, 0x92, 0x2A, 0x28,
-    0xBD, 0x4D, 0x63, 0xA2, 0x8B, 0x9C, 0xFB, 0x9D, 0xCB, 0x00, 0xC9, 0x0D, 0xF8, 0x54, 0x59, 0xD0,
-    0xF7, 0x51, 0x91, 0x8A, 0xD0, 0xCA, 0xD5, 0x84, 0xA7, 0x3A, 0x46, 0x2E, 0xC1, 0xE6, 0x0C, 0x27,
-    0x1B, 0x03, 0x9E, 0x18, 0xEA, 0x55, 0x3C, 0x70, 0xC3, 0x99, 0x5B, 0xA3, 0xD5, 0x72, 0xA2, 0xAE,
-    0x5D, 0x89, 0xC8, 0xFE, 0x8B, 0xDD, 0x09, 0xC5, 0x3F, 0x49, 0xA3, 0x05, 0xBC, 0xBC, 0x87, 0x2E,
-    0x85, 0x70, 0x51, 0xAA, 0xF3, 0x29, 0x99, 0x38, 0x65, 0xBD, 0x52, 0x94, 0x4F, 0x45, 0xAB, 0x37,
-    0xE5, 0x93, 0xDE, 0xA8, 0xE1, 0x61, 0x41, 0x48, 0x60, 0xFC, 0x51, 0xC9, 0x01, 0x96, 0x00, 0xA0,
-    0x2D, 0x6D, 0xC8, 0x12, 0xF9, 0xC9, 0x09, 0x8F, 0x7C, 0x99, 0xE4, 0x26, 0x06, 0x22, 0x64, 0x16,
-    0xC1, 0x8B, 0x4F, 0x59, 0x64, 0x26, 0x1B, 0x9E, 0x66, 0x06, 0x5B, 0x76, 0xCC, 0x4B, 0xA4, 0xE2,
-    0x76, 0xF5, 0xE3, 0x5A, 0x40, 0xFA, 0x0A, 0xD2, 0x97, 0x90, 0x7B, 0x35, 0x24, 0xA3, 0x7C, 0x2C,
-    0xDB, 0xB2, 0xDC, 0x42, 0x35, 0x32, 0x93, 0x74, 0x61, 0x5A, 0x92, 0xCD, 0x9C, 0xF2, 0xC9, 0xA2,
-    0xFC, 0x64, 0x51, 0x7E, 0x24, 0x6A, 0x51, 0x58, 0x9E, 0xA0, 0xE9, 0x42, 0x6A, 0xE9, 0x02, 0x1B,
-    0x34, 0x7A, 0x46, 0x53, 0xD8, 0xD6, 0x4C, 0xBC, 0x3A, 0x9F, 0x18, 0xAB, 0x8A, 0x89, 0x0B, 0xE9,
-    0xAD, 0x58, 0x48, 0xEF, 0xC1, 0x42, 0x3A, 0x61, 0x21, 0xBF, 0x82, 0x4E, 0x30, 0x3F, 0xB5, 0x1A,
-    0x82, 0xE5, 0xF2, 0x93, 0x35, 0x49, 0xB0, 0x8C, 0x10, 0x76, 0x12, 0xF9, 0x14, 0xBF, 0x22, 0x20,
-    0x81, 0x52, 0xCB, 0x7D, 0x01, 0x04, 0xEC, 0x65, 0xE0, 0x21, 0x8F, 0xCA, 0x43, 0xC0, 0xE5, 0x25,
-    0x08, 0xF8, 0xCD, 0xE0, 0xDD, 0x90, 0x60, 0x0F, 0x80, 0x59, 0x4D, 0xEA, 0x8B, 0x52, 0xAB, 0x4A,
-    0x79, 0xE6, 0xD5, 0xB9, 0x0B, 0x75, 0xE9, 0x9B, 0xC2, 0xBB, 0xC7, 0x46, 0xFB, 0x15, 0x1B, 0x6D,
-    0x5F, 0x0A, 0x1B, 0x7D, 0x43, 0xF4, 0x7E, 0x4A, 0xB5, 0x77, 0x86, 0xDB, 0x6D, 0x6B, 0x9B, 0x7C,
-    0xD8, 0x6D, 0xF8, 0x5D, 0x2E, 0x54, 0xA1, 0xC0, 0x6E, 0xF9, 0xEC, 0x8D, 0xA5, 0xF9, 0x4A, 0x63,
-    0xCE, 0xF3, 0x77, 0xF5, 0xD7, 0xE9, 0x6C, 0x3C, 0x84, 0x44, 0x26, 0xF5, 0x12, 0xB8, 0x51, 0x1E,
-    0x9C, 0xE7, 0xC4, 0x23, 0xD1, 0x04, 0x10, 0x8A, 0x55, 0x72, 0x14, 0xAE, 0x25, 0x21, 0x46, 0x97,
-    0x65, 0xA7, 0x56, 0xE1, 0x7F, 0x41, 0xAD, 0xD6, 0xBE, 0x64, 0xAD, 0xF6, 0xA5, 0x25, 0x5B, 0x26,
-    0x7F, 0x6B, 0x30, 0xA8, 0xC5, 0x31, 0x0F, 0xAA, 0xDA, 0x08, 0x71, 0xDE, 0xC6, 0x11, 0x66, 0x4F,
-    0xD7, 0xCC, 0xBE, 0x00, 0x9C, 0x21, 0xFB, 0x31, 0x80, 0x37, 0x55, 0xAF, 0xAD, 0xAE, 0x1A, 0x4E,
-    0xFB, 0x44, 0x4A, 0x3B, 0xB8, 0x8F, 0x58, 0x80, 0xC4, 0x2B, 0x84, 0xB8, 0x20, 0x2A, 0x9D, 0x1D,
-    0x6E, 0x1F, 0x38, 0xEF, 0xBC, 0x47, 0xBE, 0x07, 0x62, 0x38, 0xDF, 0xAE, 0x65, 0x85, 0xDE, 0x0A,
-    0xC9, 0x4E, 0x2B, 0x20, 0x4B, 0xDE, 0x96, 0xDA, 0xCA, 0xB8, 0x16, 0x61, 0x15, 0x7A, 0xA1, 0x4B,
-    0x62, 0xE8, 0xDA, 0x70, 0xFD, 0x98, 0xF3, 0x6C, 0xDD, 0x84, 0x2A, 0x7D, 0xC6, 0xBD, 0x7C, 0xB2,
-    0x1E, 0xAD, 0x62, 0xCA, 0x28, 0x97, 0x62, 0x34, 0x34, 0xA0, 0x18, 0x3C, 0x4A, 0xD9, 0xDB, 0x5C,
-    0xF7, 0x85, 0xE1, 0x18, 0xBD, 0xC1, 0x87, 0xA8, 0xC2, 0xA8, 0x94, 0x36, 0x92, 0xD1, 0x44, 0x5B,
-    0xCF, 0x36, 0xA3, 0xAB, 0x08, 0xCF, 0x4C, 0xF7, 0xE6, 0x58, 0xFE, 0x08, 0x3A, 0x07, 0x42, 0xFC,
-    0x1C, 0x74, 0xA7, 0xAA, 0x64, 0x3C, 0x37, 0x5D, 0xAC, 0xE0, 0x4E, 0x67, 0x73, 0x1F, 0x2A, 0x00,
-    0xC6, 0x96, 0x7C, 0x8B, 0x1E, 0xFB, 0x7D, 0x63, 0x62, 0x78, 0x60, 0x49, 0xB8, 0xF3, 0x32, 0x70,
-    0x6B, 0x8D, 0xBC, 0xE2, 0x49, 0x68, 0x1B, 0xF0, 0x26, 0x7A, 0x6F, 0x87, 0xA5, 0x5A, 0x1F, 0x9D,
-    0xE5, 0xEA, 0x76, 0x4A, 0x1A, 0xCE, 0x2F, 0x78, 0xE4, 0xE0, 0x51, 0x79, 0x0C, 0x55, 0x74, 0x04,
-    0x73, 0x9E, 0xA1, 0x07, 0xD0, 0xB4, 0xB5, 0x08, 0xCA, 0xC8, 0x96, 0x89, 0x04, 0xCE, 0xDE, 0x53,
-    0x96, 0x68, 0x66, 0xBE, 0xC5, 0xE4, 0x5B, 0x46, 0xB4, 0x72, 0xB2, 0xA6, 0x91, 0x8A, 0x3D, 0x23,
-    0x15, 0x1A, 0x08, 0x74, 0x04, 0xCE, 0x5C, 0x8D, 0x11, 0x1B, 0xAE, 0x32, 0xAB, 0x93, 0x09, 0x57,
-    0x2D, 0xAC, 0x47, 0x47, 0x9E, 0x67, 0xE3, 0x81, 0xDB, 0xCD, 0x72, 0xEB, 0x6C, 0xC7, 0x33, 0x49,
-    0xF7, 0x70, 0xCC, 0xB2, 0x07, 0xC7, 0x94, 0x57, 0x8B, 0xE6, 0x1B, 0x04, 0x5C, 0x72, 0xD2, 0x59,
-    0x43, 0x2B, 0xA1, 0xFC, 0x14, 0x90, 0xCA, 0x0C, 0x41, 0xE7, 0xE8, 0xC6, 0x84, 0x42, 0x8F, 0xAE,
-    0x14, 0xCD, 0xD7, 0x28, 0x45, 0x69, 0x33, 0xD4, 0xCA, 0x4B, 0x6D, 0x79, 0x97, 0x0A, 0xF8, 0xDF,
-    0xB0, 0x23, 0xD2, 0x06, 0x6E, 0xEC, 0xDA, 0x2E, 0xBB, 0xB9, 0x22, 0xB6, 0xC1, 0x9F, 0x25, 0x1A,
-    0xB1, 0xA7, 0xEC, 0xCC, 0x87, 0xE3, 0x42, 0xB3, 0xB8, 0xFF, 0x62, 0x97, 0xF2, 0xD5, 0xA0, 0xF9,
-    0x70, 0xE7, 0x50, 0xCD, 0x6B, 0x54, 0xEF, 0xC3, 0x1B, 0xFF, 0x3C, 0xEE, 0xB6, 0xA3, 0x7D, 0x62,
-    0x7F, 0xF5, 0x7D, 0x51, 0x87, 0x57, 0x8A, 0x0B, 0xD0, 0x70, 0xFB, 0x9C, 0x67, 0x78, 0x0B, 0x2E,
-    0xAC, 0x94, 0x0E, 0xC4, 0x23, 0x1E, 0x7A, 0xC9, 0x10, 0xE1, 0xBF, 0xEA, 0x2B, 0xD5, 0xCD, 0x17,
-    0x48, 0xB3, 0x11, 0xDE, 0x80, 0xBF, 0x20, 0xBD, 0x06, 0x15, 0x88, 0x75, 0x9A, 0x87, 0xB3, 0x51,
-    0x88, 0x3D, 0x7F, 0x23, 0x1F, 0x58, 0x16, 0xC8, 0xEA, 0x51, 0x0D, 0x29, 0x6D, 0x72, 0x5E, 0x7A,
-    0xEA, 0x18, 0xCC, 0xB8, 0xF3, 0x41, 0x21, 0xFD, 0xF2, 0x8C, 0xFA, 0xE4, 0x6D, 0x3B, 0x81, 0x93,
-    0xC5, 0xCE, 0xE4, 0xD0, 0xED, 0x2C, 0x13, 0x67, 0xA5, 0x75, 0xCE, 0xE5, 0x31, 0xA9, 0xB5, 0xF8,
-    0x7C, 0xF2, 0x2B, 0xD6, 0x5E, 0x1E, 0x96, 0x43, 0xA4, 0xA2, 0x91, 0xAB, 0xB8, 0x02, 0x48, 0xCB,
-    0x1F, 0x48, 0xED, 0xB0, 0xBC, 0x5D, 0x4B, 0xF9, 0x0B, 0x83, 0xFD, 0x55, 0xDE, 0x1B, 0x40, 0x39,
-    0x72, 0x06, 0x41, 0x1A, 0x61, 0xC5, 0xDC, 0x3D, 0x9F, 0xD1, 0x33, 0xFB, 0xA9, 0x87, 0x15, 0xEB,
-    0x8E, 0xD7, 0x4E, 0xDF, 0x44, 0x58, 0xB8, 0xF5, 0x6B, 0x82, 0x60, 0xFE, 0x98, 0x9C, 0xD1, 0x1B,
-    0xDB, 0x31, 0xE7, 0xB4, 0x75, 0xC5, 0x5B, 0x07, 0xF1, 0x17, 0xE7, 0x0C, 0x71, 0x8D, 0xF5, 0x23,
-    0xA3, 0x52, 0x0B, 0xD1, 0x7D, 0x15, 0xA3, 0xAE, 0xA1, 0x96, 0xD1, 0x93, 0xA5, 0x52, 0x0D, 0xF4,
-    0x53, 0x04, 0x51, 0x86, 0x62, 0x93, 0xA4, 0x3C, 0x2B, 0x2D, 0x0B, 0x30, 0xEA, 0x47, 0x43, 0xB6,
-    0x33, 0x6B, 0xF8, 0x4E, 0xB7, 0x1D, 0xF5, 0x7A, 0xE1, 0xE3, 0x6D, 0x2E, 0x43, 0x80, 0x83, 0x11,
-    0x0E, 0xBE, 0x8B, 0x91, 0x32, 0x99, 0xD7, 0x56, 0x95, 0x9D, 0xAF, 0x7D, 0xB5, 0x54, 0xDD, 0x38,
-    0x2B, 0xFD, 0x96, 0x10, 0x56, 0x62, 0x27, 0x9A, 0x20, 0x4D, 0xBA, 0xCF, 0x8B, 0x2E, 0x9A, 0xA1,
-    0xE7, 0xA3, 0xFF, 0x1F, 0x59, 0x11, 0x00, 0x8D, 0x07, 0xF3, 0x3C, 0xF1, 0xA2, 0xF1, 0x34, 0x9A,
-    0xD3, 0xC1, 0x05, 0x3F, 0xBB, 0x7E, 0x6F, 0xDF, 0xF5, 0xBC, 0x4A, 0xAA, 0x02, 0x8D, 0x3E, 0x68,
-    0x1F, 0xEB, 0x60, 0x55, 0x2A, 0x21, 0x74, 0x18, 0x93, 0xD8, 0x83, 0x23, 0xDF, 0xBF, 0x89, 0xA6,
-    0xB2, 0x7E, 0x4D, 0xC9, 0x90, 0x8F, 0x45, 0xD8, 0x0F, 0x9B, 0x98, 0x75, 0x70, 0x2A, 0xBE, 0x1F,
-    0xD4, 0x1A, 0x40, 0x8B, 0x69, 0xED, 0xFD, 0x74, 0x77, 0xEE, 0x33, 0xE7, 0x08, 0x3C, 0x92, 0x4B,
-    0xB4, 0xB6, 0xDF, 0x59, 0x84, 0x2E, 0xCF, 0xEB, 0xAA, 0xDE, 0x37, 0x48, 0xF5, 0x34, 0xA0, 0x80,
-    0xA0, 0xBB, 0xB5, 0x53, 0x45, 0xEC, 0x97, 0xDB, 0xD0, 0xFE, 0xD9, 0x55, 0xBD, 0x7E, 0x19, 0x64,
-    0x36, 0x34, 0x7D, 0xFF, 0xCB, 0x20, 0x7C, 0x24, 0xB4, 0x5E, 0x70, 0xC7, 0x6A, 0x4A, 0x55, 0xF5,
-    0xD0, 0xB8, 0x2A, 0x7C, 0xDA, 0xEA, 0xFB, 0x9B, 0x78, 0x26, 0xF6, 0xDF, 0x94, 0xF4, 0xB1, 0x46,
-    0x11, 0x28, 0x34, 0x9E, 0xB2, 0xFE, 0x82, 0x3A, 0xBF, 0x91, 0x67, 0xBE, 0x45, 0xBC, 0x2C, 0x2F,
-    0xBF, 0x0F, 0xF5, 0xFE, 0x0F, 0x1B, 0x7C, 0xED, 0x38, 0x93, 0x49, 0x5D, 0xE6, 0xB3, 0x7C, 0x6E,
-    0x47, 0x3C, 0x2F, 0x1C, 0x59, 0x57, 0xDC, 0xA3, 0x83, 0xF1, 0xCE, 0xE5, 0x47, 0x68, 0x4C, 0x93,
-    0xE7, 0x13, 0x81, 0x93, 0xD9, 0xA3, 0x14, 0xA9, 0x6C, 0xF0, 0xF5, 0x8E, 0x85, 0x7A, 0xE4, 0xAF,
-    0x9A, 0x91, 0x21, 0x43, 0x7E, 0x1C, 0x2D, 0x02, 0x78, 0xA3, 0x40, 0x2F, 0x2F, 0x42, 0x41, 0x6C,
-    0xA7, 0x17, 0xD6, 0x00, 0xB0, 0xAC, 0x87, 0x42, 0x8E, 0xE9, 0xF4, 0x0A, 0x6B, 0x06, 0x6C, 0x1A,
-    0xCD, 0xC6, 0x08, 0x28, 0x13, 0x7B, 0x35, 0xEC, 0xEC, 0x9D, 0x07, 0x02, 0x51, 0x0F, 0x54, 0x3F,
-    0xD8, 0x3B, 0x0C, 0x38, 0x28, 0xD9, 0xBC, 0xF8, 0x31, 0x52, 0xDD, 0xEA, 0x1F, 0x60, 0xB2, 0xF5,
-    0x2F, 0x85, 0xE1, 0xEB, 0x21, 0x10, 0x1D, 0x60, 0x44, 0x0E, 0xB1, 0x63, 0x13, 0xB0, 0x7B, 0x99,
-    0x66, 0x59, 0x46, 0x7E, 0xDC, 0xB0, 0x35, 0x03, 0xC2, 0xB4, 0x9E, 0x65, 0x8C, 0x33, 0xDE, 0xE8,
-    0xC6, 0x31, 0x5B, 0x35, 0x73, 0xB5, 0x28, 0x67, 0x16, 0xAB, 0x63, 0x85, 0xAF, 0x6F, 0x50, 0x4B,
-    0x01, 0x73, 0x32, 0x3B, 0x03, 0xEB, 0x57, 0x84, 0x9E, 0x79, 0x02, 0x3B, 0xF0, 0x77, 0xCE, 0xF6,
-    0xE4, 0xB1, 0xB3, 0x23, 0x81, 0x42, 0x08, 0x2F, 0xA1, 0xAD, 0xF9, 0x99, 0x8C, 0x89, 0xC6, 0x32,
-    0x06, 0x32, 0xF4, 0xB8, 0x66, 0xE8, 0xDF, 0xC8, 0x66, 0xE0, 0x44, 0x93, 0x3E, 0x45, 0x07, 0x8D,
-    0x07, 0x13, 0x25, 0x8B, 0x27, 0x8E, 0x14, 0x67, 0x31, 0x06, 0x1A, 0xE2, 0x34, 0x87, 0x6F, 0x79,
-    0x36, 0xCA, 0xFE, 0xD2, 0x88, 0x28, 0x5B, 0x05, 0x29, 0x7A, 0x21, 0xBE, 0xA4, 0xB3, 0x7D, 0xB5,
-    0x54, 0xBD, 0xAC, 0xB3, 0x7D, 0xB5, 0x54, 0x7D, 0x07, 0xF2, 0xD0, 0x6D, 0x96, 0xA3, 0x43, 0x67,
-    0xAE, 0x59, 0x91, 0xA3, 0x2F, 0xE5, 0x53, 0x16, 0xE9, 0x25, 0xD4, 0xBA, 0x9F, 0xA2, 0x92, 0x3A,
-    0x23, 0xCF, 0xE8, 0xB3, 0xE3, 0x6D, 0x52, 0xE8, 0x48, 0xA2, 0xAF, 0xBB, 0x49, 0x24, 0xDF, 0xCC,
-    0x84, 0xFE, 0x68, 0x42, 0x18, 0x41, 0xA8, 0xDF, 0x2F, 0x24, 0xD5, 0x6F, 0x13, 0x12, 0xEB, 0x48,
-    0xAD, 0x3F, 0xF6, 0x36, 0x42, 0x8C, 0x60, 0xA3, 0x78, 0x1F, 0xFA, 0x0F, 0xE7, 0x64, 0xB0, 0xA4,
-    0xF4, 0xCB, 0x03, 0xC4, 0xAB, 0x96, 0xA4, 0x3F, 0x7D, 0x27, 0x20, 0xE9, 0x87, 0x72, 0xFD, 0xE6,
-    0xDB, 0xD7, 0x7C, 0x95, 0x05, 0x3F, 0xBF, 0x77, 0x79, 0x01, 0x43, 0xF4, 0x3E, 0xD8, 0x03, 0xBE,
-    0xCF, 0xDF, 0xB1, 0x8E, 0x24, 0x03, 0x99, 0xD7, 0x6F, 0x73, 0x69, 0xDE, 0xC5, 0x0C, 0x2D, 0x67,
-    0x11, 0x5E, 0x63, 0x5B, 0x07, 0x68, 0x47, 0x16, 0xA5, 0xB2, 0x4C, 0xE7, 0xF4, 0x37, 0xD8, 0xD9,
-    0xC5, 0xA7, 0x3A, 0x4E, 0xF5, 0x0F, 0x71, 0x5A, 0x07, 0xA4, 0x39, 0x13, 0xB4, 0x9C, 0x67, 0xD2,
-    0x67, 0x50, 0x5A, 0x4B, 0xD5, 0xFD, 0x15, 0x4E, 0x0E, 0x89, 0x19, 0xC4, 0x7B, 0x4A, 0x28, 0x9E,
-    0x62, 0x1F, 0x65, 0x25, 0x4C, 0x34, 0xF4, 0xF2, 0xE7, 0xD6, 0x37, 0xA0, 0xC3, 0x00, 0x10, 0xDF,
-    0x87, 0x6A, 0xBD, 0xB7, 0xF1, 0x78, 0x31, 0xC3, 0x0E, 0x8E, 0xDD, 0xB5, 0xE3, 0x0B, 0xCE, 0xC6,
-    0xE2, 0xA1, 0x77, 0x33, 0xFC, 0x76, 0x84, 0xD9, 0xC8, 0x05, 0x67, 0x63, 0xF9, 0x34, 0x83, 0xAB,
-    0x7D, 0x2F, 0xA2, 0xF6, 0xF0, 0x07, 0xA1, 0x90, 0x0E, 0x0E, 0x15, 0xF8, 0x80, 0x8E, 0x03, 0x34,
-    0xA1, 0xEE, 0x1D, 0xB0, 0x93, 0x9C, 0x53, 0x30, 0x9F, 0x11, 0xEE, 0x7F, 0x4F, 0xF6, 0x1C, 0xD1,
-    0xDD, 0xFB, 0xDB, 0x8A, 0xD7, 0x48, 0x37, 0x40, 0xC6, 0x3C, 0xBE, 0xD1, 0xBF, 0x2B, 0x83, 0xAE,
-    0x06, 0xCD, 0x77, 0x58, 0xAA, 0xD7, 0x6C, 0x0E, 0xB7, 0x93, 0xEF, 0x05, 0xBD, 0xD4, 0xF9, 0x00,
-    0x41, 0xD7, 0xEC, 0xA7, 0x3F, 0xDE, 0x03, 0x89, 0xAF, 0x86, 0x9C, 0x77, 0x87, 0x3A, 0xC9, 0x84,
-    0xA0, 0x60, 0x47, 0x3A, 0xF6, 0xFE, 0xD2, 0x81, 0xCE, 0x15, 0xA1, 0xF9, 0xB7, 0xC3, 0xD7, 0x0F,
-    0x0E, 0x41, 0x3C, 0xA8, 0x61, 0x77, 0xC1, 0x40, 0xF0, 0x09, 0x05, 0xE1, 0xC4, 0x09, 0x15, 0x0B,
-    0x10, 0xB0, 0xDE, 0xDA, 0x11, 0x70, 0x9E, 0x33, 0x19, 0x4C, 0x36, 0xD1, 0xF4, 0xD2, 0x89, 0xB5,
-    0x68, 0x62, 0x5D, 0x8C, 0xC9, 0xCC, 0x54, 0x34, 0x9E, 0x19, 0x4D, 0xA3, 0x19, 0xDF, 0xFD, 0x54,
-    0x27, 0xB7, 0x36, 0x3F, 0x96, 0x36, 0x19, 0x14, 0x3E, 0xDB, 0xD9, 0xC7, 0x64, 0xD3, 0xE0, 0x76,
-    0x28, 0x94, 0x21, 0x91, 0xEB, 0x21, 0xBA, 0xEF, 0x15, 0xCF, 0x59, 0xF2, 0xDE, 0xB5, 0xEB, 0x6B,
-    0xBB, 0xBE, 0xB6, 0x0B, 0x6B, 0xBB, 0xA2, 0x5A, 0x21, 0xAD, 0x3B, 0xA7, 0x2F, 0x09, 0x73, 0xAE,
-    0x8D, 0x4C, 0x3F, 0x38, 0x27, 0x8C, 0xCA, 0xDC, 0xAC, 0xF6, 0x9D, 0x53, 0xE8, 0x0C, 0x79, 0xCE,
-    0x62, 0xAE, 0xD1, 0xF4, 0x36, 0x13, 0xBA, 0xFF, 0x79, 0x4F, 0x89, 0x4C, 0x25, 0x8A, 0xFE, 0x42,
-    0xCD, 0x2C, 0xDB, 0x34, 0xDA, 0x63, 0x9D, 0x31, 0xBB, 0x1D, 0x73, 0x7C, 0xDF, 0x73, 0x87, 0x69,
-    0x6A, 0xE8, 0x64, 0xC8, 0x49, 0xF8, 0x40, 0x68, 0xE3, 0xC2, 0x77, 0x7D, 0xF7, 0xF0, 0xCD, 0xEC,
-    0x12, 0xBE, 0xB9, 0x26, 0xA3, 0xBB, 0x8E, 0xE3, 0xCD, 0xA5, 0x8E, 0x63, 0xEB, 0x0A, 0xFB, 0x42,
-    0x54, 0xFD, 0x8D, 0xD3, 0xF6, 0xFF, 0x02, 0xDD, 0x5C, 0xBF, 0x93, 0xDC, 0x56, 0x72, 0x7E, 0x98,
-    0xD1, 0x6A, 0xAA, 0x88, 0x2A, 0xE3, 0x82, 0xDB, 0xE0, 0xA8, 0x00, 0x0E, 0x9C, 0x98, 0x17, 0xE0,
-    0x4F, 0x00, 0x74, 0x0E, 0x9C, 0x32, 0xD8, 0x2D, 0x07, 0x0E, 0xA4, 0xC0, 0x11, 0x1D, 0x30, 0x71,
-    0xEA, 0xC2, 0xE8, 0xFE, 0x82, 0x4D, 0x74, 0xE5, 0xF2, 0x05, 0x62, 0xA0, 0x80, 0x9A, 0x0B, 0x36,
-    0x75, 0xE2, 0xC3, 0x48, 0x17, 0x2A, 0xF0, 0x58, 0x2A, 0xD5, 0x05, 0x17, 0x08, 0xA7, 0x1F, 0x56,
-    0x9D, 0x14, 0x10, 0x77, 0x35, 0xB2, 0x86, 0x2B, 0x00, 0xCF, 0xFD, 0x7D, 0xDD, 0x0F, 0xC0, 0x0C,
-    0x77, 0x49, 0x4A, 0x65, 0x51, 0x5C, 0xB2, 0xC8, 0xF7, 0x86, 0xBB, 0x18, 0xBC, 0x7E, 0xDD, 0xFD,
-    0xDE, 0xEB, 0xFE, 0xBA, 0xFB, 0x39, 0xE7, 0x8E, 0x4E, 0x4F, 0x0B, 0xE7, 0x5C, 0xEA, 0xFD, 0x5A,
-    0xBA, 0xCC, 0xFB, 0xA5, 0x74, 0xB9, 0x76, 0xC7, 0xA7, 0xA7, 0x6E, 0xFC, 0xB3, 0xF0, 0x1B, 0x74,
-    0x89, 0xAF, 0x1D, 0xBF, 0xD0, 0x38, 0x3E, 0xC9, 0xAE, 0xD4, 0xCE, 0x3F, 0x40, 0x37, 0xF3, 0x6F,
-    0xA1, 0x9B, 0xFB, 0x74, 0x2B, 0x5D, 0xDC, 0xB3, 0x4B, 0xDA, 0x74, 0x87, 0x01, 0x76, 0x09, 0xBA,
-    0xBC, 0x61, 0x57, 0xD5, 0x49, 0x8B, 0xAF, 0xAD, 0xD1, 0xCD, 0xFC, 0x12, 0xDD, 0xDC, 0x17, 0xE8,
-    0x62, 0xEF, 0x7D, 0x4B, 0xBA, 0x7C, 0x47, 0x82, 0xD0, 0x95, 0xD2, 0xF5, 0xF2, 0xFC, 0xC5, 0xEA,
-    0xBC, 0x77, 0x91, 0xD0, 0x13, 0xF7, 0xF2, 0xFC, 0x5A, 0x48, 0x93, 0xBF, 0x05, 0xBA, 0xC4, 0x83,
-    0x50, 0x97, 0x76, 0x78, 0x91, 0xCB, 0xF9, 0x3E, 0x19, 0xE1, 0xF4, 0xF4, 0x04, 0x03, 0x78, 0xFE,
-    0xDF, 0xEF, 0xD8, 0x0A, 0x55, 0xD1, 0xE9, 0xE9, 0xED, 0x30, 0xBD, 0xE8, 0xB7, 0x85, 0x70, 0x42,
-    0x66, 0x27, 0x2F, 0xCA, 0xFD, 0x85, 0xB4, 0x32, 0x98, 0x97, 0x07, 0x7B, 0x8F, 0xB7, 0x6F, 0xF2,
-    0x5E, 0x7E, 0x59, 0x64, 0x1D, 0x86, 0x48, 0x5B, 0x27, 0x1F, 0xA4, 0x95, 0x01, 0x32, 0x69, 0x77,
-    0x32, 0x2F, 0xB4, 0xF9, 0xD6, 0x95, 0xF2, 0xB7, 0x41, 0x5B, 0xA1, 0x8D, 0x84, 0x59, 0xE5, 0x6E,
-    0x2E, 0x94, 0xE6, 0x5D, 0x8A, 0xD6, 0x83, 0xCF, 0xA9, 0xBC, 0x73, 0x2D, 0xEF, 0xD9, 0x09, 0x97,
-    0x67, 0x1C, 0xD0, 0x1D, 0x1B, 0x15, 0xB9, 0x5B, 0x80, 0xBD, 0x65, 0x91, 0xA0, 0xCB, 0x3F, 0xAF,
-    0xD6, 0xA3, 0x38, 0x12, 0x8F, 0xA9, 0xC8, 0x37, 0xB6, 0x7C, 0xF4, 0x25, 0xF7, 0x62, 0x08, 0x67,
-    0x2E, 0x8C, 0x92, 0x76, 0xEB, 0xE4, 0xCB, 0xF3, 0xFE, 0xD7, 0x1D, 0x05, 0x05, 0x02, 0x3C, 0xE9,
-    0xCE, 0xC0, 0x1E, 0xE7, 0x0A, 0xF7, 0x7C, 0x09, 0xEA, 0x3A, 0xAF, 0x06, 0x19, 0x9F, 0x04, 0xBA,
-    0x72, 0xC9, 0x4E, 0x7F, 0x36, 0x6B, 0xD9, 0xCD, 0xAD, 0xEB, 0x5F, 0x67, 0xA7, 0x53, 0x99, 0x79,
-    0xFB, 0x42, 0xFD, 0xBC, 0x88, 0x41, 0xA9, 0xD5, 0x79, 0xE4, 0x58, 0x24, 0xAE, 0x2A, 0xC6, 0xB9,
-    0xF8, 0x7F, 0x63, 0xCB, 0x67, 0x4A, 0xB6, 0xE4, 0xF7, 0x40, 0xFB, 0xEA, 0x1E, 0xE7, 0x86, 0xEF,
-    0xC5, 0xFC, 0x46, 0xCA, 0x87, 0x72, 0x95, 0x1B, 0xB9, 0x72, 0x32, 0x3E, 0xFE, 0x8A, 0x7F, 0x48,
-    0x75, 0x14, 0xE2, 0x20, 0x88, 0x06, 0xDB, 0xA4, 0x7C, 0xAE, 0xFC, 0x97, 0x7E, 0x1D, 0x89, 0x24,
-    0x16, 0xCB, 0x39, 0xD5, 0x20, 0xE6, 0x0B, 0x13, 0x7D, 0x61, 0xCF, 0x17, 0xB6, 0x63, 0x5B, 0x92,
-    0x82, 0x92, 0x8B, 0xB7, 0x6A, 0xC6, 0xD6, 0x4F, 0x5A, 0xFB, 0xF9, 0x76, 0xA4, 0x5B, 0xD8, 0xE8,
-    0x6E, 0xCB, 0x80, 0x9F, 0xDF, 0xDD, 0x60, 0x03, 0x10, 0x9E, 0x2C, 0xD8, 0x46, 0x6C, 0xE5, 0x17,
-    0x3D, 0xA6, 0x6D, 0xFB, 0xF4, 0xEA, 0x6D, 0x88, 0xAA, 0xC6, 0xD4, 0x64, 0x0E, 0x49, 0x07, 0x15,
-    0xC3, 0xBB, 0x4A, 0xD0, 0x75, 0x3C, 0xCC, 0xE7, 0xEE, 0x9F, 0xA8, 0x51, 0x64, 0xEF, 0x1A, 0xF3,
-    0x12, 0xFA, 0xFB, 0xAA, 0x10, 0xA1, 0x45, 0x90, 0x99, 0x11, 0x9F, 0xB5, 0x81, 0xF4, 0x7C, 0x17,
-    0x08, 0x3F, 0x68, 0xF4, 0xB7, 0xFE, 0xD5, 0x2D, 0x38, 0xB2, 0x05, 0x7D, 0x5B, 0xDB, 0x59, 0x2B,
-    0x7F, 0x26, 0x6C, 0xD6, 0xCD, 0x75, 0x75, 0x9F, 0x1A, 0xD4, 0x91, 0x43, 0x60, 0x4E, 0xF6, 0x10,
-    0x83, 0x54, 0x1B, 0xD9, 0xDC, 0x66, 0xDE, 0x65, 0xB5, 0x8B, 0x4E, 0xDC, 0xD1, 0xED, 0xEB, 0xC6,
-    0xED, 0x5B, 0xEF, 0x90, 0x4C, 0x9E, 0x25, 0xB2, 0x10, 0x3A, 0x21, 0x27, 0x6F, 0xF2, 0x5A, 0xD4,
-    0x47, 0xB4, 0xF2, 0x24, 0x4C, 0xFE, 0x99, 0x73, 0xFB, 0xE5, 0x62, 0xD4, 0x64, 0x9D, 0xDA, 0x74,
-    0xB2, 0xF9, 0xD2, 0xED, 0xFF, 0xB9, 0x2E, 0xDC, 0xA6, 0x7E, 0x64, 0x03, 0x1B, 0x38, 0x60, 0x8E,
-    0xFF, 0xA6, 0x9B, 0xBD, 0xF9, 0x3C, 0x5B, 0x6E, 0xDF, 0x29, 0x66, 0xA2, 0xDC, 0xF9, 0x06, 0x9B,
-    0x7A, 0xDA, 0x54, 0x1B, 0x1E, 0xD2, 0x05, 0x36, 0xDD, 0x8E, 0x1B, 0x0C, 0xD9, 0x32, 0xDA, 0x18,
-    0xD7, 0x85, 0xDB, 0xB7, 0x96, 0xD1, 0xCA, 0x65, 0x4D, 0xDC, 0xBA, 0x64, 0x27, 0x9A, 0xB4, 0xC0,
-    0xF6, 0x3B, 0x87, 0xAA, 0x47, 0xDC, 0x52, 0xC7, 0x09, 0x3D, 0x5B, 0x6E, 0xDF, 0xB8, 0xE7, 0xEE,
-    0x88, 0xFE, 0x2E, 0xDA, 0x99, 0x27, 0x77, 0x79, 0x5C, 0x9A, 0x99, 0x20, 0xCF, 0xAD, 0xF5, 0x08,
-    0x56, 0x75, 0x39, 0x99, 0xDA, 0x46, 0xFD, 0x99, 0xEE, 0x3D, 0xBD, 0x5A, 0x51, 0x78, 0x32, 0x21,
-    0xFB, 0x79, 0xA2, 0xE2, 0x60, 0x6D, 0xC1, 0x7D, 0x9E, 0x4D, 0x3D, 0x89, 0x01, 0xEB, 0x85, 0x58,
-    0x74, 0x42, 0x1F, 0xCE, 0x08, 0x61, 0x28, 0x3A, 0x6F, 0x5D, 0x1D, 0x3A, 0x79, 0x04, 0x67, 0xAF,
-    0x74, 0x33, 0x1C, 0x52, 0x7A, 0x04, 0xCB, 0x69, 0x87, 0x2D, 0x58, 0x5E, 0x24, 0x07, 0xB8, 0xAB,
-    0x76, 0x38, 0x85, 0x23, 0xCF, 0x17, 0x2D, 0xF4, 0x3B, 0x77, 0x79, 0xA2, 0x9D, 0x83, 0xA9, 0x46,
-    0x83, 0xAA, 0x02, 0xBB, 0x82, 0x67, 0xFC, 0x99, 0xD1, 0x7F, 0xEB, 0xDE, 0xCD, 0x7B, 0x14, 0x63,
-    0x53, 0x9A, 0x68, 0x69, 0x15, 0xCA, 0xE0, 0x7A, 0x52, 0xF9, 0x0F, 0xA8, 0x21, 0x91, 0xFF, 0xB0,
-    0xD5, 0xFE, 0xBD, 0x7B, 0x7A, 0x66, 0xAF, 0x79, 0x4C, 0xFF, 0x9D, 0x19, 0x8F, 0x9F, 0xD2, 0x90,
-    0xCA, 0xFD, 0x37, 0x5E, 0xB9, 0xE6, 0x95, 0x89, 0x17, 0xEC, 0x17, 0x7E, 0x9D, 0x2B, 0x77, 0x70,
-    0x64, 0x3B, 0xCC, 0x83, 0x47, 0xA2, 0x70, 0x24, 0x35, 0xE9, 0x65, 0x3B, 0x15, 0x60, 0x66, 0x4B,
-    0x2F, 0x37, 0xE1, 0x71, 0xAB, 0xD1, 0x03, 0x9C, 0x3D, 0x15, 0xB8, 0xDC, 0xCD, 0x68, 0x20, 0xE5,
-    0x9D, 0xAA, 0xB2, 0x1E, 0xE4, 0x3A, 0x57, 0x3D, 0x75, 0xDB, 0x6A, 0x49, 0x22, 0x6B, 0xB5, 0xEF,
-    0x8E, 0x7F, 0x00, 0x61, 0xDD, 0xF4, 0x17, 0xF7, 0xA4, 0x13, 0x8E, 0x36, 0xD2, 0x09, 0x09, 0x4D,
-    0xC2, 0xAE, 0x96, 0x4E, 0x8C, 0xA7, 0xCD, 0x0F, 0x23, 0x2C, 0x35, 0x94, 0xD4, 0x5E, 0x22, 0x4F,
-    0x66, 0x2B, 0x7F, 0xC1, 0x99, 0xF1, 0xD9, 0x58, 0x19, 0x9F, 0xF8, 0x60, 0xCD, 0xAF, 0xD5, 0xCE,
-    0x5A, 0xC2, 0x2C, 0x99, 0x73, 0xCD, 0xF8, 0x0F, 0x3D, 0xAD, 0xC8, 0x6F, 0xB9, 0xE2, 0xBC, 0x9D,
-    0x31, 0x60, 0x88, 0x30, 0x33, 0xEF, 0xB8, 0x31, 0x60, 0x4D, 0xA5, 0xB4, 0xA9, 0x28, 0xA3, 0xDD,
-    0x20, 0x1A, 0x93, 0x8C, 0x09, 0x46, 0xCD, 0xAB, 0x20, 0x96, 0x5C, 0xA5, 0x62, 0x42, 0x31, 0x99,
-    0x98, 0x48, 0x4C, 0x22, 0x41, 0x20, 0x41, 0x1E, 0xEA, 0x1F, 0xAA, 0x5F, 0x98, 0x87, 0xB6, 0xD8,
-    0xF3, 0x0D, 0x75, 0x1B, 0x89, 0xD9, 0xAA, 0xC0, 0x12, 0x33, 0xDB, 0xF0, 0xBC, 0x5A, 0x56, 0xD9,
-    0x64, 0xFB, 0xCA, 0xA7, 0xDB, 0xD7, 0xD6, 0x94, 0x71, 0xC7, 0x76, 0xCB, 0xB6, 0xE1, 0xAC, 0x1B,
-    0xA1, 0xE5, 0x23, 0xD9, 0x6A, 0xD4, 0x4C, 0x23, 0x83, 0x28, 0x20, 0x9A, 0xB4, 0x83, 0xE1, 0x96,
-    0x58, 0xCB, 0xA1, 0xD8, 0xAA, 0x4C, 0xB4, 0xCD, 0x95, 0xCB, 0x11, 0xFC, 0xBF, 0xF9, 0xB0, 0xA7,
-    0x2C, 0x38, 0xC4, 0xE8, 0xFB, 0xFD, 0xF3, 0x43, 0x4E, 0x62, 0x4D, 0x4D, 0x21, 0x31, 0xE2, 0x63,
-    0xE5, 0xAD, 0xAC, 0x89, 0xB4, 0xA5, 0xF5, 0x2A, 0x8C, 0xCE, 0x77, 0x99, 0xA8, 0xDD, 0x16, 0x2F,
-    0xAC, 0xD1, 0x2C, 0x73, 0xD0, 0x5C, 0xFA, 0x8B, 0x42, 0x65, 0xAD, 0xBB, 0x18, 0x97, 0x86, 0x48,
-    0x85, 0xC3, 0xAB, 0x8C, 0xE7, 0x24, 0xA1, 0xF4, 0x9F, 0x39, 0x98, 0x39, 0x83, 0x8B, 0x97, 0xD3,
-    0xC3, 0x53, 0x07, 0x4F, 0xF9, 0xAA, 0xEE, 0x9D, 0x79, 0x77, 0x2F, 0xB9, 0xEB, 0xC3, 0xDD, 0x78,
-    0xE3, 0x3A, 0x17, 0x37, 0x62, 0x91, 0xC7, 0xFD, 0x5D, 0x2C, 0x22, 0xBE, 0x1C, 0x8A, 0x56, 0x62,
-    0x0D, 0x47, 0x83, 0xEB, 0xF6, 0x6C, 0xF9, 0x6C, 0x96, 0x50, 0xF9, 0xC8, 0xD1, 0xA8, 0x2E, 0xDB,
-    0xA1, 0x25, 0xF4, 0xFC, 0xF3, 0xD9, 0xB9, 0x7F, 0xC2, 0xD7, 0xFA, 0xF0, 0xBC, 0x36, 0xF8, 0xEF,
-    0x62, 0xB7, 0x37, 0x95, 0x67, 0xCA, 0xE7, 0x6B, 0xC0, 0xB7, 0x98, 0xC3, 0x64, 0x9B, 0xC1, 0x4B,
-    0x8C, 0x78, 0x60, 0xCE, 0x3A, 0xDD, 0x80, 0x4F, 0xC6, 0x65, 0xA7, 0x6D, 0xB6, 0x7D, 0xC6, 0xBC,
-    0x04, 0x14, 0x55, 0x82, 0xBC, 0x2A, 0x90, 0x35, 0xDF, 0x05, 0xB1, 0xC6, 0xDD, 0x6D, 0x43, 0x1B,
-    0xE6, 0x3C, 0x51, 0x61, 0x64, 0xBA, 0x95, 0xDA, 0x9D, 0x6B, 0xD8, 0x9D, 0xD9, 0x25, 0x76, 0x27,
-    0x27, 0x70, 0x5A, 0x5C, 0x1F, 0xDD, 0x56, 0xD3, 0x4E, 0x2D, 0x3B, 0x33, 0xEC, 0x3C, 0x0F, 0xCF,
-    0xCA, 0xCC, 0x87, 0x43, 0xA3, 0x0E, 0x72, 0x51, 0xC1, 0xA8, 0x64, 0x94, 0x42, 0xCA, 0xC6, 0x51,
-    0x38, 0x86, 0x3B, 0x50, 0x3C, 0x8E, 0xF2, 0xE1, 0x58, 0x35, 0xDB, 0xA5, 0xA3, 0x88, 0x54, 0x46,
-    0xB6, 0x45, 0xE8, 0x74, 0x75, 0xEA, 0x94, 0x93, 0x0A, 0xCA, 0x4E, 0x6A, 0x15, 0x95, 0xEA, 0x7D,
-    0xD8, 0x60, 0xDC, 0xAD, 0x95, 0x5A, 0x9E, 0x54, 0x20, 0x4C, 0x3F, 0xEE, 0x21, 0xC6, 0x6C, 0x9B,
-    0xC9, 0x1B, 0xAB, 0x75, 0xBC, 0x83, 0x3D, 0x3D, 0x38, 0x82, 0xEE, 0x65, 0x3E, 0x53, 0xC1, 0x80,
-    0x58, 0xD0, 0x8C, 0x48, 0xBD, 0x29, 0x4A, 0xD5, 0x44, 0x72, 0xBC, 0x47, 0xB5, 0xC2, 0x2D, 0xC1,
-    0xFA, 0x57, 0x60, 0xD6, 0xE8, 0x99, 0x5A, 0xFF, 0x32, 0xE1, 0x6A, 0x1B, 0xA1, 0x6D, 0x64, 0xDC,
-    0xBA, 0x6A, 0x84, 0xBA, 0x8D, 0x6F, 0xA2, 0x95, 0x5F, 0x53, 0x28, 0x6B, 0x61, 0x9D, 0x88, 0xA3,
-    0xC2, 0x79, 0xB7, 0x2C, 0x31, 0x5A, 0x21, 0xA6, 0x12, 0x4D, 0xA1, 0xCF, 0xCF, 0x55, 0xF7, 0x7A,
-    0x92, 0xD0, 0x91, 0x6F, 0x8A, 0x2C, 0x9D, 0x0D, 0x2A, 0x33, 0x5B, 0x9D, 0x71, 0x7C, 0x85, 0xDF,
-    0x08, 0x4D, 0xFD, 0x81, 0xD8, 0xD1, 0x2F, 0xC0, 0x0E, 0x19, 0xBE, 0x70, 0x47, 0xC5, 0x14, 0x4F,
-    0x38, 0x3B, 0x86, 0x12, 0xEC, 0xF2, 0x0D, 0xA0, 0x9A, 0x2A, 0xC0, 0x36, 0xDE, 0x57, 0xF0, 0x6A,
-    0xB6, 0x09, 0xBC, 0x82, 0x4D, 0xEC, 0x0B, 0xD1, 0x13, 0x51, 0x0C, 0xF9, 0xA0, 0xD0, 0x94, 0xD0,
-    0x23, 0xBB, 0x57, 0xDC, 0xA3, 0x4D, 0x3A, 0xB3, 0x66, 0xA4, 0xCD, 0xD8, 0xCA, 0x34, 0xC5, 0x79,
-    0xF0, 0x30, 0xEB, 0xFE, 0x5E, 0x3D, 0x02, 0xA1, 0x67, 0xC1, 0x76, 0xEE, 0xBB, 0xAA, 0x86, 0x71,
-    0xA5, 0x18, 0x9C, 0xDA, 0xB9, 0x83, 0x0E, 0xBE, 0x8E, 0x11, 0x5C, 0xF9, 0x66, 0xC5, 0xA5, 0x85,
-    0xC9, 0x95, 0x54, 0xDB, 0x92, 0xCA, 0xF2, 0xB2, 0xFA, 0x64, 0x2E, 0x59, 0x47, 0xF2, 0x9B, 0x64,
-    0x83, 0x85, 0x96, 0x5C, 0xDC, 0xDD, 0xD2, 0x30, 0x23, 0x72, 0xC2, 0x17, 0x55, 0x64, 0x78, 0x34,
-    0xEA, 0xDB, 0x35, 0x91, 0x9D, 0x4C, 0x2A, 0x5D, 0xBA, 0xA8, 0xE3, 0xF1, 0xE6, 0xFF, 0xDD, 0x73,
-    0xE9, 0xF6, 0x5C, 0x41, 0xDC, 0x4C, 0x94, 0x63, 0x3F, 0x71, 0xD7, 0x5A, 0x76, 0x2E, 0x3A, 0x9B,
-    0x60, 0x76, 0x8F, 0xB4, 0x49, 0x7D, 0x80, 0x71, 0x5C, 0x97, 0x75, 0xE7, 0x7E, 0xE6, 0x26, 0xDC,
-    0x98, 0xB6, 0xCB, 0xE1, 0xD0, 0xDA, 0xC3, 0x3A, 0xAE, 0xA3, 0xEC, 0xAE, 0x97, 0x44, 0x14, 0x2D,
-    0x56, 0x4F, 0x55, 0x8F, 0x37, 0x9E, 0xA7, 0xAA, 0x67, 0x3C, 0x30, 0x52, 0x6A, 0xDB, 0x91, 0x3D,
-    0x7E, 0xE3, 0x6C, 0x34, 0x35, 0x4A, 0xF5, 0xD2, 0x8B, 0xE1, 0x6B, 0xB1, 0xFA, 0xE9, 0x27, 0xD7,
-    0x5C, 0x82, 0x37, 0xC8, 0x0F, 0xE1, 0xE0, 0x66, 0x0C, 0x76, 0x44, 0xFE, 0x2D, 0x86, 0x37, 0x3A,
-    0xB2, 0x26, 0x6B, 0x88, 0xD0, 0x1C, 0x17, 0xEE, 0x74, 0x62, 0x5F, 0xD3, 0x37, 0x85, 0x4D, 0x20,
-    0xE7, 0x6D, 0xA2, 0x4E, 0x3A, 0xAC, 0x57, 0xD9, 0x75, 0x11, 0xA0, 0x40, 0xD7, 0x12, 0x4A, 0x91,
-    0x59, 0xC0, 0x2B, 0xCE, 0xAD, 0xDB, 0x91, 0xB6, 0x72, 0xAB, 0xDE, 0xF9, 0xD7, 0xA7, 0xFF, 0x68,
-    0xA1, 0x06, 0xEF, 0xA6, 0x5D, 0xAF, 0x9E, 0x72, 0x47, 0x93, 0x84, 0x5E, 0xC8, 0x1A, 0x2F, 0x9A,
-    0x38, 0xF6, 0x39, 0x1D, 0xFB, 0x80, 0x10, 0x5C, 0x45, 0x43, 0xB6, 0x4F, 0xC3, 0x4E, 0x1D, 0xF4,
-    0x19, 0x03, 0x06, 0x0B, 0xDA, 0x55, 0x29, 0x31, 0xB0, 0xF2, 0x8B, 0x1E, 0xB3, 0x7E, 0xC3, 0x63,
-    0xD2, 0x72, 0xD6, 0x03, 0xA0, 0x3C, 0x1A, 0x74, 0x66, 0xB6, 0x72, 0x87, 0x56, 0x10, 0x65, 0x4F,
-    0x48, 0x7E, 0xDF, 0xE0, 0x52, 0x7B, 0x63, 0x9B, 0xC1, 0x1B, 0xFC, 0x33, 0x79, 0xFE, 0x2D, 0xE6,
-    0x54, 0xD1, 0x3A, 0xF2, 0xFE, 0x5C, 0x26, 0xE0, 0x5B, 0x99, 0x86, 0xA8, 0x03, 0x5B, 0x59, 0x19,
-    0x4B, 0xA1, 0x69, 0x4E, 0xA5, 0x60, 0xBB, 0x64, 0xC0, 0x07, 0xE3, 0x98, 0x5E, 0x78, 0x8C, 0x03,
-    0x04, 0xA7, 0xA3, 0x76, 0x10, 0xC2, 0xC9, 0x42, 0xE4, 0x45, 0xC3, 0x2E, 0xD2, 0x0A, 0x07, 0x72,
-    0x45, 0x6D, 0x4C, 0x34, 0x81, 0x2F, 0x81, 0x31, 0xD1, 0x6B, 0xFE, 0xF4, 0xD4, 0x7F, 0x4D, 0xBB,
-    0x11, 0x6A, 0x69, 0xFD, 0x32, 0xD1, 0xBE, 0x38, 0x2A, 0xBB, 0xD3, 0x7F, 0xF0, 0x1F, 0xB9, 0x20,
-    0x22, 0x95, 0x11, 0xD6, 0xB5, 0x0A, 0x29, 0x88, 0x67, 0xAF, 0xEF, 0x5D, 0x10, 0x54, 0x90, 0x54,
-    0x10, 0x55, 0x90, 0x55, 0x10, 0x56, 0x90, 0x56, 0x00, 0x74, 0x02, 0x59, 0x2A, 0xB0, 0xC6, 0x05,
-    0x89, 0x05, 0x91, 0x05, 0x99, 0x29, 0x39, 0xEB, 0x41, 0x0A, 0xF1, 0x28, 0x85, 0xE8, 0xDC, 0x8B,
-    0xEE, 0xCE, 0xB9, 0xC6, 0x16, 0x34, 0x03, 0x63, 0x03, 0x70, 0x54, 0x16, 0x6A, 0x01, 0x36, 0x37,
-    0x65, 0x11, 0x97, 0x7F, 0x81, 0xBA, 0x57, 0x5F, 0x31, 0xC2, 0x36, 0x68, 0x99, 0x48, 0x44, 0x4C,
-    0xFF, 0x22, 0xF2, 0x0D, 0xA5, 0x50, 0x3F, 0x22, 0x85, 0xE2, 0xFB, 0x4B, 0xC1, 0x1D, 0x51, 0x81,
-    0xAA, 0x3A, 0x05, 0xD8, 0xDA, 0x57, 0x4B, 0x92, 0x28, 0xD3, 0xFD, 0x1F, 0x30, 0x2B, 0x59, 0xC3,
-    0x2B, 0x39, 0x9A, 0x98, 0x24, 0x0B, 0xAE, 0xCD, 0x98, 0xC6, 0x6F, 0x12, 0xDA, 0x0D, 0xD8, 0xDB,
-    0x8D, 0x7E, 0x6F, 0x35, 0xF1, 0x78, 0xD9, 0x92, 0x53, 0x86, 0x3A, 0xCD, 0x9E, 0xC6, 0x6E, 0xBF,
-    0x4A, 0x6F, 0xC7, 0xD8, 0x5A, 0xCC, 0xCD, 0x3C, 0xE3, 0xE0, 0xC4, 0x81, 0xAD, 0x75, 0x3F, 0x05,
-    0xBD, 0x7E, 0x93, 0xCB, 0xAE, 0xF5, 0x90, 0x7B, 0xAD, 0x30, 0xE3, 0xF7, 0xA2, 0xE2, 0x59, 0x51,
-    0xD6, 0x62, 0x3E, 0x0E, 0x53, 0x39, 0x3E, 0x09, 0xCC, 0x27, 0xD1, 0xA4, 0x99, 0xBB, 0x0A, 0x28,
-    0x8E, 0x74, 0x4E, 0x6B, 0x23, 0x97, 0xD4, 0xB2, 0x59, 0x28, 0x9A, 0xB6, 0xE7, 0x08, 0x93, 0xCE,
-    0x00, 0x5C, 0x4E, 0x31, 0x67, 0x15, 0x2D, 0xF3, 0x00, 0x22, 0xEC, 0x6C, 0x33, 0x6B, 0x60, 0xA1,
-    0x07, 0x1C, 0x88, 0x0C, 0x25, 0x3F, 0x13, 0x6B, 0x36, 0xC6, 0xCC, 0x09, 0x59, 0xF5, 0x94, 0xAC,
-    0xD9, 0x21, 0x59, 0x85, 0xB1, 0xF0, 0x29, 0xC8, 0x2A, 0x5B, 0xE3, 0x5C, 0x36, 0xE0, 0xE7, 0x6C,
-    0x80, 0x4B, 0x01, 0xA5, 0x02, 0x48, 0x85, 0x7F, 0xD1, 0xA9, 0x1D, 0x45, 0xE0, 0x12, 0x91, 0xBD,
-    0x46, 0x69, 0xA1, 0xD3, 0x53, 0x93, 0x10, 0xB0, 0x67, 0x46, 0x8C, 0x7E, 0xC9, 0x7F, 0x60, 0x4D,
-    0xEC, 0x95, 0x02, 0x10, 0x80, 0xF1, 0x0D, 0x29, 0xE4, 0xE0, 0xF9, 0xCE, 0x38, 0x62, 0xB1, 0xF7,
-    0x9D, 0xA3, 0x87, 0x63, 0xB1, 0xF7, 0x76, 0x12, 0x7B, 0x5F, 0xEE, 0xC7, 0xDE, 0x9F, 0x7B, 0x9D,
-    0x8B, 0x6B, 0xF7, 0x9F, 0x71, 0x13, 0x75, 0x8B, 0xFE, 0x6E, 0x0B, 0x2E, 0x46, 0x78, 0x02, 0x30,
-    0x54, 0x40, 0xA1, 0x7E, 0x08, 0x2E, 0x3E, 0x1F, 0x8A, 0xE3, 0xE2, 0x26, 0xC4, 0xC2, 0xFD, 0x00,
-    0x23, 0xB4, 0x21, 0x94, 0x4F, 0x7B, 0x2A, 0xA2, 0x54, 0x0D, 0x9B, 0x0E, 0x10, 0x19, 0x62, 0xFA,
-    0x7E, 0xE4, 0x44, 0x48, 0x0A, 0xA0, 0xA9, 0x22, 0xAA, 0x37, 0xD7, 0x54, 0x82, 0x3D, 0x4E, 0xA4,
-    0x53, 0x4E, 0x28, 0xF4, 0xCC, 0x9D, 0x7A, 0xC2, 0x50, 0xB7, 0xC7, 0xD0, 0xC0, 0x54, 0x19, 0xAE,
-    0x57, 0x5C, 0x03, 0x66, 0x13, 0x68, 0xC5, 0xBF, 0xF2, 0x23, 0xF5, 0xF0, 0x33, 0x1F, 0x6C, 0xA4,
-    0x01, 0xED, 0x9A, 0x6B, 0x70, 0x02, 0xAE, 0xF5, 0xB0, 0xDC, 0x15, 0xB7, 0xD9, 0x53, 0xC9, 0x1F,
-    0x9F, 0xF9, 0xA2, 0x57, 0x39, 0xB1, 0x76, 0x19, 0x10, 0x40, 0x51, 0x2D, 0x43, 0xC9, 0xFC, 0x79,
-    0x52, 0x2F, 0x79, 0x3A, 0xE0, 0x68, 0x48, 0x7C, 0x30, 0xD9, 0xF4, 0x20, 0x68, 0xED, 0x20, 0xE0,
-    0x2C, 0xC0, 0x2E, 0x4C, 0x64, 0xAE, 0xF8, 0x0C, 0x8E, 0x18, 0x4E, 0x07, 0x7A, 0xC8, 0xE0, 0xA0,
-    0xD7, 0x49, 0x91, 0xCC, 0x4A, 0xED, 0x17, 0x46, 0xA0, 0x7A, 0x37, 0x58, 0x30, 0x66, 0xBB, 0x04,
-    0x03, 0x2A, 0x18, 0x31, 0x7A, 0xB6, 0x6E, 0x75, 0xB2, 0xE5, 0x56, 0xE7, 0x0B, 0xD6, 0x58, 0x48,
-    0x8B, 0xEF, 0x02, 0x83, 0x12, 0xCD, 0x24, 0x01, 0x89, 0xDC, 0x73, 0x53, 0x3B, 0x53, 0x33, 0xB5,
-    0xA8, 0xD4, 0x96, 0x5A, 0x92, 0x0F, 0xBA, 0x3C, 0xFC, 0x32, 0xF6, 0xBA, 0x10, 0x19, 0x85, 0x11,
-    0x5E, 0x80, 0x9C, 0xD0, 0x73, 0xED, 0x9A, 0xB8, 0x74, 0xF5, 0xCA, 0x6B, 0x77, 0xBA, 0xDE, 0x15,
-    0x8C, 0x55, 0xAF, 0x3B, 0x2C, 0x68, 0xF4, 0xBD, 0x79, 0x08, 0x67, 0xA6, 0x04, 0xE2, 0xEC, 0x2D,
-    0x84, 0x67, 0x04, 0x74, 0x34, 0x9D, 0x04, 0x21, 0x9F, 0x1E, 0x24, 0x89, 0x22, 0xC5, 0xFB, 0xCE,
-    0x9E, 0x88, 0x41, 0xB6, 0xF3, 0x9C, 0xE1, 0x0E, 0x61, 0x95, 0x4C, 0x05, 0x0E, 0xC5, 0x46, 0xE6,
-    0x88, 0x69, 0xF8, 0x7A, 0x06, 0xBB, 0x7A, 0x43, 0x43, 0x0A, 0xC7, 0xF6, 0x8C, 0x76, 0xF5, 0x9C,
-    0x93, 0x98, 0xC3, 0xB2, 0xC1, 0xAC, 0xC6, 0xC3, 0x9B, 0x08, 0x92, 0x0E, 0x95, 0x10, 0x47, 0x4A,
-    0x35, 0x79, 0xA5, 0x65, 0x78, 0xA5, 0x05, 0x07, 0xE5, 0xBF, 0x55, 0x63, 0x03, 0x3A, 0x6A, 0xFD,
-    0xFE, 0x7E, 0xB7, 0xA0, 0xE9, 0x7C, 0x6E, 0x91, 0x1F, 0x4E, 0x50, 0x13, 0x21, 0xB6, 0x41, 0xB1,
-    0xE5, 0xCF, 0xCD, 0x95, 0x86, 0x2E, 0xB9, 0x76, 0x15, 0xEA, 0xA3, 0x1D, 0xD6, 0x22, 0x2F, 0x28,
-    0xAF, 0xB1, 0x8A, 0x8F, 0xA7, 0x19, 0x29, 0xC1, 0x68, 0x3C, 0x0C, 0x03, 0x4F, 0xF0, 0xED, 0xC8,
-    0x28, 0x99, 0xEE, 0xB9, 0xE3, 0xCE, 0xCB, 0xB3, 0xF3, 0xEA, 0x3D, 0xB7, 0x7B, 0x1C, 0x20, 0x58,
-    0x36, 0x8F, 0x19, 0x70, 0x3A, 0x54, 0xCC, 0xA1, 0x32, 0xB3, 0xFC, 0xD8, 0xEA, 0xD1, 0xB2, 0x0D,
-    0xD3, 0x74, 0xE7, 0x0F, 0x83, 0xBD, 0x3C, 0x22, 0x4E, 0xB9, 0xFE, 0xFE, 0x63, 0x5A, 0x82, 0xF3,
-    0x5E, 0x11, 0x27, 0xB7, 0x8F, 0x38, 0x1D, 0x9D, 0x3E, 0x99, 0xDA, 0xFC, 0x71, 0xD4, 0xBA, 0x4B,
-    0xD8, 0xB3, 0xBC, 0x94, 0x3D, 0xF1, 0x53, 0x1C, 0x49, 0x15, 0x06, 0xFC, 0x8D, 0x9A, 0x2C, 0xBA,
-    0xD7, 0x98, 0x28, 0x47, 0x00, 0x55, 0x83, 0x8A, 0x5C, 0xBC, 0xC0, 0x71, 0xB1, 0x0B, 0x60, 0x79,
-    0xF7, 0x8C, 0x61, 0xCA, 0x14, 0x2A, 0x06, 0x36, 0x99, 0x67, 0x95, 0xB5, 0x0B, 0x35, 0x63, 0xE9,
-    0xF7, 0xE6, 0xDB, 0x5C, 0x37, 0x33, 0x05, 0xE2, 0xFE, 0xA2, 0xEF, 0xFF, 0x46, 0x07, 0x78, 0x60,
-    0xB1, 0x5C, 0xC6, 0x59, 0xBC, 0x05, 0x90, 0xBC, 0xEE, 0x6A, 0xDF, 0xE8, 0x0E, 0xF7, 0x4B, 0xD5,
-    0xA7, 0x57, 0xF1, 0x3D, 0xA1, 0xC1, 0xEB, 0xA2, 0x07, 0x51, 0x32, 0x38, 0xB6, 0x33, 0x68, 0xB6,
-    0x06, 0x13, 0xB3, 0x9E, 0xD3, 0x82, 0x42, 0xB0, 0x33, 0x9F, 0xE9, 0x30, 0x65, 0xC4, 0x1C, 0x62,
-    0x3B, 0xBE, 0x43, 0x4A, 0x59, 0xAC, 0xCB, 0x5B, 0x9D, 0xE2, 0x90, 0x95, 0x61, 0x1E, 0xD1, 0x77,
-    0x76, 0x87, 0x76, 0xB6, 0x9F, 0x0A, 0xB5, 0x25, 0xF7, 0xC3, 0xAA, 0x01, 0x39, 0xBE, 0x06, 0x2F,
-    0xC4, 0xC1, 0xDF, 0xCA, 0x6C, 0x7F, 0xC7, 0x8D, 0xFE, 0xBF, 0xE4, 0xC7, 0x33, 0x7F, 0xDE, 0x85,
-    0x94, 0x4E, 0x6D, 0x17, 0x54, 0xB5, 0x98, 0x6E, 0x46, 0x4C, 0x2E, 0x25, 0x3D, 0x0F, 0xB0, 0x6E,
-    0x41, 0xC0, 0x5B, 0x5D, 0x0E, 0x64, 0x9B, 0xC9, 0x50, 0x5E, 0x57, 0xB1, 0x5A, 0xE4, 0xED, 0x01,
-    0x74, 0xB4, 0x1A, 0xE9, 0xD4, 0x74, 0x83, 0x4C, 0xF3, 0x68, 0xD4, 0xF7, 0x9D, 0x84, 0xAE, 0xC5,
-    0x91, 0x7F, 0x12, 0xCD, 0xCE, 0x68, 0x7E, 0xFF, 0x87, 0xA0, 0x19, 0x1E, 0x2A, 0x23, 0x04, 0x54,
-    0x5E, 0x52, 0xCC, 0xC8, 0x3C, 0xC3, 0xEC, 0xA7, 0x53, 0x2F, 0xDC, 0xCE, 0xB9, 0x3E, 0x34, 0xE9,
-    0xC1, 0x39, 0x37, 0xD8, 0xCB, 0x5C, 0xEF, 0xFB, 0xD6, 0xB8, 0x3B, 0xB4, 0xC6, 0xAF, 0x3A, 0x45,
-    0x35, 0x4A, 0xB5, 0x5A, 0x2D, 0x09, 0xF9, 0x13, 0xEB, 0x27, 0x9C, 0x6E, 0x78, 0xFF, 0x6C, 0xB5,
-    0x34, 0x5C, 0x27, 0x1B, 0x8E, 0x6A, 0xBE, 0xAB, 0xDF, 0x43, 0x48, 0xA8, 0x38, 0x87, 0x6F, 0x7D,
-    0xAC, 0x8D, 0xFF, 0xD4, 0x1E, 0x44, 0xF1, 0x1D, 0x3D, 0x08, 0xDD, 0xFC, 0x9E, 0x17, 0xFE, 0x0D,
-    0x7F, 0x6E, 0xDC, 0x67, 0x1E, 0x69, 0x90, 0xB6, 0x46, 0x91, 0x20, 0xF2, 0x7E, 0x4C, 0x62, 0x44,
-    0x4E, 0xC2, 0x60, 0xEF, 0x5E, 0x6D, 0x9A, 0x3D, 0xD1, 0xCA, 0xDB, 0x3E, 0x95, 0x95, 0xA7, 0x9B,
-    0xE7, 0x28, 0x3F, 0x58, 0x74, 0x58, 0x3A, 0x69, 0xA3, 0xCB, 0x06, 0xF6, 0xE5, 0xB1, 0xF1, 0x52,
-    0xB6, 0x7D, 0x19, 0x91, 0x79, 0x33, 0x33, 0x24, 0xD1, 0xF5, 0x73, 0x8E, 0xBB, 0xE0, 0x66, 0x98,
-    0x70, 0x2F, 0xC4, 0x16, 0xF2, 0x14, 0xE7, 0x9D, 0x7B, 0xEC, 0x79, 0x77, 0x89, 0xA7, 0xA1, 0x1B,
-    0x10, 0x38, 0xFC, 0x48, 0x54, 0xCA, 0x8D, 0x5A, 0x3A, 0x7B, 0x47, 0xBE, 0x15, 0xC3, 0x20, 0x80,
-    0x01, 0x82, 0xE4, 0xDD, 0xA4, 0x03, 0x58, 0xD7, 0xE6, 0xF2, 0x85, 0xF6, 0x6F, 0xAF, 0x83, 0xFA,
-    0x89, 0xFD, 0xE4, 0x1B, 0xD1, 0x10, 0xD9, 0x88, 0x5A, 0xE1, 0x52, 0x29, 0x5B, 0xC8, 0x3A, 0xDF,
-    0x0A, 0x2D, 0x69, 0xFD, 0x7D, 0xD5, 0xEF, 0xFF, 0x61, 0x59, 0xFE, 0x0C, 0x7C, 0x81, 0x89, 0xFC,
-    0x2E, 0x8C, 0xB2, 0xF7, 0x00, 0xA5, 0xBC, 0x41, 0x93, 0x0C, 0xD9, 0x63, 0xDF, 0x99, 0x2F, 0x97,
-    0xE1, 0x03, 0x97, 0x4E, 0xA9, 0xFB, 0x6B, 0x00, 0x78, 0x3B, 0x43, 0xF1, 0x32, 0xDF, 0xAB, 0xBD,
-    0x11, 0x69, 0x70, 0x72, 0x67, 0x29, 0xDC, 0xA9, 0x9A, 0xC4, 0x35, 0xCC, 0xD0, 0xCB, 0x84, 0xF7,
-    0xE5, 0xEA, 0x1E, 0x40, 0xA4, 0x9A, 0x71, 0x55, 0x40, 0x48, 0x6B, 0x8D, 0xA7, 0x46, 0x2B, 0xF5,
-    0x97, 0xE6, 0x9A, 0x77, 0xAD, 0xAB, 0xE9, 0xC0, 0x73, 0xCC, 0xCC, 0x5F, 0xCA, 0x1F, 0x02, 0x3B,
-    0x05, 0xD0, 0xB7, 0x84, 0xB9, 0x20, 0xC7, 0x76, 0x91, 0x0A, 0x25, 0x78, 0x4D, 0x49, 0xAF, 0x02,
-    0x04, 0xE9, 0xA2, 0x7C, 0xDC, 0xAB, 0x46, 0xEB, 0x69, 0x34, 0x27, 0x83, 0xE5, 0x9D, 0xDB, 0xEF,
-    0xAB, 0x8D, 0x59, 0xDE, 0xB6, 0x2A, 0x4F, 0xF6, 0xFD, 0x27, 0xA1, 0x9B, 0xA6, 0x7C, 0x4D, 0xDA,
-    0x13, 0xC2, 0xC4, 0x6E, 0xE8, 0x41, 0x14, 0x72, 0x0E, 0x32, 0x61, 0x58, 0xDC, 0x69, 0x9F, 0x30,
-    0x09, 0xBD, 0xE3, 0xB2, 0xCE, 0xBF, 0xA0, 0x95, 0xEC, 0xCA, 0x4F, 0x3D, 0x09, 0xAA, 0x3E, 0x14,
-    0x55, 0xC1, 0x59, 0xF7, 0xAE, 0xA8, 0x19, 0x76, 0x89, 0xF5, 0xD0, 0x6F, 0x4A, 0xC4, 0x8D, 0x97,
-    0x55, 0x53, 0xD5, 0xC2, 0xCE, 0x22, 0x47, 0xE0, 0x5A, 0x86, 0xCC, 0xB7, 0xDC, 0x39, 0xE4, 0xDB,
-    0x9A, 0xBC, 0x9E, 0x22, 0x95, 0x16, 0x26, 0x7F, 0x0F, 0x80, 0xAE, 0xC3, 0x91, 0x58, 0x60, 0xA8,
-    0x05, 0xD1, 0xB0, 0x56, 0x33, 0x11, 0xE9, 0x98, 0xF4, 0xE4, 0x81, 0x66, 0x83, 0x61, 0xC8, 0x4E,
-    0x77, 0xC1, 0xAA, 0x35, 0xB6, 0x2C, 0x9D, 0xF9, 0x8D, 0x66, 0x24, 0xEA, 0x0E, 0x62, 0x86, 0xEA,
-    0x01, 0x2B, 0x8E, 0x0B, 0x42, 0xB0, 0xEF, 0x12, 0x82, 0x7D, 0x9F, 0x10, 0xEC, 0xC7, 0x07, 0x10,
-    0xAC, 0xFB, 0x21, 0x21, 0xD8, 0x17, 0x55, 0x0A, 0x07, 0x7F, 0x6E, 0xBD, 0x6D, 0xBA, 0xD9, 0xEC,
-    0xE9, 0xA6, 0x25, 0xDD, 0x0F, 0x3A, 0x6A, 0x55, 0x08, 0x43, 0xF0, 0xFC, 0xC7, 0x95, 0xCE, 0xF7,
-    0xB3, 0x08, 0xC5, 0x26, 0x73, 0x2F, 0xDF, 0xD7, 0x48, 0x90, 0x3D, 0xD3, 0x68, 0xB6, 0x5F, 0xFA,
-    0xAD, 0xD9, 0xCC, 0xDE, 0x8A, 0x2D, 0xAC, 0xBC, 0x22, 0x9A, 0x44, 0x9D, 0x5E, 0x60, 0x9D, 0x10,
-    0xB6, 0xBC, 0x0D, 0x2B, 0x05, 0x3F, 0xC9, 0xFF, 0x08, 0xC9, 0xA7, 0xDF, 0xEA, 0x81, 0xD3, 0x72,
-    0xDA, 0xCD, 0x3E, 0x2B, 0x7E, 0x5C, 0xD9, 0x57, 0x0A, 0x30, 0x68, 0xB0, 0x4B, 0xED, 0x0B, 0x8B,
-    0x05, 0x06, 0xCF, 0x67, 0xA1, 0x00, 0x47, 0xD2, 0x0A, 0xA1, 0x67, 0x2E, 0xDD, 0x96, 0xEF, 0x01,
-    0xE3, 0xAE, 0xAB, 0xF7, 0x85, 0x0B, 0xC7, 0x85, 0x58, 0xF2, 0xEA, 0xFB, 0x12, 0x03, 0x40, 0xF8,
-    0x60, 0xE9, 0x34, 0x7E, 0xE0, 0x34, 0x80, 0xE0, 0x94, 0x54, 0xA7, 0xB4, 0x5A, 0x0C, 0x81, 0xD5,
-    0x3B, 0x4C, 0xF8, 0xA4, 0x48, 0x15, 0x34, 0x32, 0x82, 0x8D, 0x62, 0x23, 0x99, 0x20, 0xD2, 0xD6,
-    0x19, 0xD1, 0x06, 0x42, 0x19, 0x10, 0xE5, 0x74, 0xB0, 0x82, 0x71, 0x54, 0x55, 0x9D, 0x7A, 0x50,
-    0xA1, 0xC5, 0x44, 0x85, 0x70, 0xF4, 0x0D, 0x2A, 0x04, 0xD5, 0xF9, 0xF6, 0x11, 0x15, 0x2A, 0xA8,
-    0x42, 0x1F, 0xF8, 0x25, 0x06, 0x9B, 0xAA, 0x8E, 0xF6, 0x65, 0x53, 0x02, 0x45, 0x5D, 0x52, 0x75,
-    0x66, 0x78, 0xDA, 0x43, 0x85, 0xE4, 0xDB, 0x3A, 0x34, 0xEB, 0x23, 0xE6, 0x5E, 0x71, 0x9E, 0x45,
-    0xAF, 0x45, 0x13, 0x71, 0xA7, 0x2A, 0x93, 0x20, 0x82, 0xA3, 0x3D, 0x9D, 0x66, 0xA4, 0xB3, 0x56,
-    0xBD, 0x9D, 0x95, 0xA6, 0x42, 0x44, 0x5C, 0x9B, 0xE0, 0x2D, 0x8E, 0x05, 0x3D, 0x86, 0xEC, 0x9B,
-    0x2D, 0xF8, 0x57, 0xE7, 0x6A, 0x0D, 0x26, 0xEA, 0x81, 0x87, 0x9A, 0x39, 0x14, 0x0F, 0xE9, 0x8A,
-    0xEB, 0x8B, 0x89, 0x4A, 0xBD, 0xF7, 0x63, 0x6D, 0x27, 0xD5, 0x21, 0x6E, 0x42, 0x4B, 0x6C, 0x76,
-    0xAE, 0xE6, 0x85, 0x26, 0x66, 0xF7, 0x43, 0x05, 0xC1, 0x4C, 0xB1, 0xB0, 0x23, 0x8D, 0x54, 0x24,
-    0x0A, 0x31, 0x28, 0xF0, 0x1E, 0x26, 0x7A, 0x74, 0x3A, 0xDD, 0x3A, 0x5E, 0xE1, 0xD7, 0xA2, 0x31,
-    0xE1, 0xD8, 0x52, 0x95, 0x99, 0x4E, 0xFF, 0x95, 0x6F, 0x09, 0xC2, 0x95, 0x60, 0x7E, 0x8D, 0xB0,
-    0x7A, 0x4C, 0xA0, 0x91, 0xD6, 0x96, 0xCC, 0x25, 0x55, 0xB5, 0xCB, 0xDB, 0x69, 0x87, 0x92, 0x83,
-    0x00, 0x1B, 0xF8, 0x10, 0x8D, 0x43, 0x87, 0x48, 0x73, 0x43, 0x2F, 0x0E, 0x9D, 0x62, 0x62, 0x78,
-    0x1A, 0x4F, 0xCA, 0x78, 0x65, 0xCB, 0xCD, 0x8D, 0xC5, 0x60, 0xC8, 0xA1, 0xFB, 0xBC, 0xE2, 0x46,
-    0x46, 0xC4, 0x62, 0xE1, 0x43, 0x9D, 0x1F, 0x67, 0x92, 0x6A, 0x0C, 0xC1, 0x7C, 0x55, 0xA6, 0xE7,
-    0x86, 0x94, 0xDD, 0xE6, 0x91, 0x94, 0xDD, 0xBB, 0x9F, 0x39, 0xDD, 0x7D, 0x72, 0x7C, 0xD9, 0x13,
-    0x2D, 0xBD, 0xF0, 0x3B, 0xE4, 0x47, 0xB7, 0xCC, 0x8E, 0x4E, 0x91, 0xC0, 0xCE, 0x78, 0x78, 0x0E,
-    0x79, 0x10, 0xBB, 0x13, 0xF6, 0x67, 0x2D, 0x91, 0x3B, 0xC8, 0x62, 0xC7, 0x9C, 0xF5, 0x7C, 0x27,
-    0x8B, 0x11, 0x09, 0xD1, 0x9B, 0xD4, 0x62, 0x9B, 0xBD, 0x95, 0x88, 0x96, 0x4C, 0xC9, 0xE6, 0x80,
-    0xE9, 0x3A, 0xDA, 0x11, 0xD4, 0x60, 0x5A, 0x5E, 0xF2, 0xF0, 0xBC, 0x19, 0xE5, 0x30, 0x37, 0xE0,
-    0x52, 0x33, 0x86, 0xA6, 0x29, 0x43, 0x2F, 0x84, 0x1C, 0x16, 0xB5, 0xFB, 0xAD, 0x43, 0x44, 0xC5,
-    0x2D, 0x2C, 0xB9, 0x97, 0xD6, 0x32, 0xE2, 0x04, 0x34, 0xAC, 0x06, 0xAD, 0x7B, 0xB6, 0x12, 0x71,
-    0x37, 0xDE, 0xB9, 0x79, 0x9F, 0x26, 0xAE, 0xBA, 0x17, 0xB5, 0xDA, 0xE9, 0xBF, 0xE4, 0xD2, 0xD1,
-    0x24, 0x84, 0xA4, 0x61, 0x22, 0xD0, 0x51, 0x71, 0xF4, 0x62, 0x49, 0x44, 0x2C, 0x90, 0x1B, 0x2B,
-    0x1C, 0x09, 0x74, 0x03, 0xB6, 0xCC, 0xF2, 0xDF, 0x60, 0x13, 0xF0, 0x33, 0x54, 0xD0, 0xEE, 0x16,
-    0xC8, 0x26, 0x2D, 0xC6, 0xAC, 0x6B, 0x4A, 0x46, 0x45, 0xA3, 0xB2, 0x71, 0x96, 0x0A, 0x72, 0x81,
-    0x4D, 0x1F, 0xE2, 0xB1, 0x7A, 0x02, 0x0A, 0xC8, 0x72, 0x48, 0x28, 0xA2, 0x80, 0x78, 0x6F, 0x47,
-    0xC4, 0x9B, 0x62, 0xB2, 0x6A, 0x0F, 0x0A, 0x8A, 0xC5, 0x04, 0x1B, 0x73, 0xA1, 0x29, 0x2B, 0x13,
-    0x96, 0x4A, 0x6B, 0x92, 0xFD, 0x18, 0x04, 0xE0, 0xD5, 0x55, 0xB2, 0xA4, 0x82, 0x90, 0x5D, 0xA0,
-    0xFE, 0x37, 0xE5, 0x82, 0x6A, 0x28, 0xB8, 0x99, 0x10, 0x05, 0x5D, 0x18, 0x08, 0x83, 0x62, 0xC6,
-    0x31, 0x56, 0x36, 0x6E, 0x4C, 0x05, 0xA0, 0x48, 0xB8, 0x0C, 0x21, 0x8D, 0xF0, 0x41, 0x73, 0x53,
-    0xCB, 0x5D, 0xF8, 0xB0, 0x25, 0x28, 0x5A, 0x3B, 0xE6, 0x02, 0x79, 0xC6, 0x04, 0xE4, 0xC3, 0x9B,
-    0xB2, 0x63, 0x56, 0x8D, 0x81, 0x02, 0x56, 0xDD, 0x33, 0xC6, 0x55, 0x20, 0x26, 0xF5, 0xA3, 0xE4,
-    0x3D, 0x6A, 0xED, 0xE5, 0x5D, 0x80, 0x2A, 0x45, 0x58, 0xFD, 0x6A, 0xA5, 0xA9, 0xA1, 0x74, 0x88,
-    0x17, 0xE1, 0x83, 0x4E, 0xAB, 0xB7, 0x4A, 0x17, 0x8D, 0x65, 0x0C, 0xE0, 0xDB, 0xF9, 0x3D, 0xF7,
-    0xF3, 0x87, 0xF8, 0x56, 0x3F, 0x57, 0x37, 0xCF, 0xBF, 0x85, 0x00, 0xAF, 0x7E, 0x77, 0xC7, 0x52,
-    0x9C, 0x6D, 0xD6, 0x8A, 0xCE, 0x95, 0xA8, 0x01, 0x66, 0xAD, 0x8A, 0x26, 0x18, 0x67, 0xBD, 0x4C,
-    0x8B, 0xB5, 0xB3, 0x48, 0x33, 0xDE, 0x91, 0x55, 0x4D, 0xCE, 0x5A, 0x29, 0x79, 0x98, 0x89, 0xAD,
-    0x1D, 0x45, 0x63, 0x29, 0xC7, 0xA1, 0xAE, 0xCA, 0x6B, 0xE2, 0xF1, 0x8C, 0x76, 0x55, 0xDE, 0x23,
-    0xB6, 0xF2, 0x4A, 0xE0, 0xF3, 0x40, 0xBC, 0xD0, 0xF2, 0x89, 0xD7, 0x94, 0x93, 0x42, 0x53, 0x91,
-    0x6F, 0x0F, 0x08, 0x1C, 0x0A, 0x4A, 0x2D, 0x6A, 0xA8, 0x40, 0x8A, 0x86, 0xE7, 0xF4, 0xEC, 0x55,
-    0x8B, 0xF7, 0x78, 0x62, 0xAF, 0x5E, 0x14, 0x01, 0xC0, 0x4C, 0x28, 0x49, 0x2D, 0x33, 0x4B, 0xE5,
-    0x50, 0x6D, 0x58, 0xB5, 0xD3, 0x40, 0x91, 0xA0, 0x39, 0xAA, 0x4E, 0xBB, 0xB1, 0xF4, 0x17, 0x51,
-    0x1A, 0x04, 0xCE, 0x90, 0xE8, 0x0C, 0x3E, 0xAC, 0x9D, 0xA9, 0x80, 0x66, 0xF5, 0x7A, 0x1A, 0x0F,
-    0x5F, 0xB1, 0x7D, 0x83, 0x86, 0x45, 0x21, 0xF2, 0x5C, 0x78, 0x93, 0x5B, 0xB9, 0x9B, 0x84, 0x85,
-    0x34, 0x1F, 0xCA, 0x1B, 0x92, 0x2D, 0xAD, 0x30, 0x74, 0x48, 0x09, 0xB9, 0xF3, 0xB6, 0x99, 0x0A,
-    0xFC, 0x2F, 0x67, 0xC3, 0xC9, 0x70, 0x2E, 0xC7, 0x13, 0x8B, 0x53, 0x3C, 0xF0, 0x0F, 0x20, 0xA3,
-    0x3F, 0x00, 0xC8, 0x7D, 0x40, 0x1F, 0x9D, 0xF6, 0xC1, 0xAF, 0xB4, 0x06, 0x8E, 0x3C, 0x99, 0x29,
-    0xB4, 0xBE, 0xFE, 0xFE, 0x09, 0x09, 0xD7, 0x81, 0x65, 0x6E, 0x82, 0xE6, 0x8D, 0xB9, 0x6C, 0x6A,
-    0xF4, 0xB2, 0x6E, 0x9D, 0xC8, 0x5E, 0xA8, 0xC2, 0x56, 0x1E, 0x46, 0x27, 0x33, 0xD9, 0xDE, 0x3A,
-    0x84, 0xE8, 0xBA, 0x0A, 0x75, 0x21, 0xCC, 0x46, 0x63, 0x32, 0xDA, 0xC3, 0xD7, 0x65, 0xA4, 0xB5,
-    0xA5, 0xF3, 0x11, 0xFC, 0x3D, 0x00, 0x73, 0xBE, 0x0B, 0x60, 0xEA, 0xDC, 0xA3, 0x48, 0x31, 0x9D,
-    0x32, 0x86, 0x21, 0xB2, 0x3A, 0x90, 0x65, 0x92, 0x65, 0x5D, 0x23, 0xE8, 0x65, 0xB0, 0x22, 0x6E,
-    0x73, 0x55, 0x6C, 0x03, 0x0D, 0xAD, 0x74, 0xBC, 0x0B, 0x70, 0xFE, 0x81, 0x62, 0x9B, 0x98, 0x4C,
-    0x4E, 0x26, 0x28, 0x93, 0x94, 0x89, 0xCA, 0x64, 0x65, 0xC2, 0x0A, 0x26, 0xB9, 0xD5, 0xC6, 0xA9,
-    0xBC, 0x4C, 0x60, 0x26, 0x31, 0x37, 0xEE, 0x1A, 0x3B, 0x67, 0x42, 0x33, 0xA9, 0x99, 0xD8, 0x4C,
-    0x6E, 0x26, 0xB8, 0x70, 0xE0, 0xA8, 0xE8, 0x4C, 0x76, 0x26, 0xBC, 0x49, 0xE8, 0x06, 0xC7, 0x56,
-    0x90, 0xDF, 0xAD, 0x33, 0xF1, 0xB7, 0x30, 0xE5, 0x2E, 0xCC, 0x58, 0x27, 0x1C, 0x71, 0x16, 0x36,
-    0xDD, 0xC9, 0x6C, 0xA9, 0xFB, 0xAA, 0xFC, 0xAA, 0xFD, 0xAA, 0xFE, 0xAA, 0xFF, 0x5C, 0x00, 0x56,
-    0x05, 0xAA, 0xDB, 0xC2, 0x6C, 0x34, 0x5F, 0x9F, 0x2E, 0xB6, 0xD8, 0x3E, 0x2E, 0x5A, 0xC7, 0xD3,
-    0xAD, 0x18, 0xBE, 0x68, 0xD1, 0x35, 0x35, 0x93, 0x89, 0xE3, 0x76, 0xEE, 0xE0, 0x4C, 0xC9, 0xC0,
-    0x9C, 0xD9, 0x24, 0x51, 0x3F, 0xB7, 0xBB, 0x11, 0x7E, 0x83, 0x03, 0x61, 0xE7, 0xFE, 0xE6, 0x00,
-    0x25, 0xAE, 0x27, 0x25, 0xB2, 0x9A, 0xB3, 0x62, 0x51, 0xCA, 0x66, 0x70, 0x40, 0x4D, 0x13, 0x4A,
-    0xAB, 0x9B, 0x1C, 0xB1, 0xE4, 0xD9, 0x24, 0xBA, 0x0B, 0x95, 0xFC, 0x17, 0xFE, 0xBC, 0x7C, 0xF3,
-    0x2E, 0xF2, 0x13, 0xAD, 0x94, 0xC3, 0xEE, 0x67, 0x68, 0xC2, 0x89, 0x8B, 0x24, 0x48, 0xB7, 0x17,
-    0x9F, 0x21, 0x20, 0xA5, 0x45, 0x95, 0x4D, 0x00, 0x3E, 0x86, 0x23, 0x62, 0x56, 0xDD, 0xB3, 0x0A,
-    0x3B, 0xE8, 0x02, 0x4E, 0x2B, 0x71, 0x38, 0x36, 0x25, 0x98, 0x7A, 0xA4, 0x9C, 0xB5, 0x52, 0x90,
-    0x5D, 0x28, 0x39, 0xA8, 0x30, 0x25, 0xF8, 0x71, 0x4E, 0xB7, 0x79, 0xA6, 0xC7, 0x70, 0x5D, 0x09,
-    0x93, 0xFF, 0x03, 0xFF, 0xAD, 0xA0, 0x5C, 0x15, 0x68, 0xAA, 0xB4, 0x90, 0xA5, 0x9B, 0x64, 0xFA,
-    0xDF, 0xA3, 0xAC, 0x26, 0x99, 0xFE, 0x5F, 0x30, 0x09, 0xE8, 0x17, 0xEA, 0x8D, 0xC9, 0x00, 0x47,
-    0xB7, 0x27, 0x5B, 0xFC, 0x75, 0xE1, 0xF6, 0x9D, 0xFB, 0x96, 0x93, 0x44, 0x64, 0x22, 0x7D, 0x88,
-    0xAF, 0xD4, 0xE5, 0x5A, 0xFC, 0xD2, 0xB4, 0x89, 0xC6, 0xDA, 0xFC, 0x67, 0xCC, 0xED, 0x6B, 0xC2,
-    0x43, 0x8D, 0xDD, 0x5A, 0x0E, 0xF3, 0x6E, 0xDC, 0xEC, 0xB9, 0xF8, 0xA2, 0x85, 0x56, 0x18, 0xB5,
-    0x43, 0x9D, 0x91, 0xAE, 0xFA, 0x67, 0xC7, 0x4B, 0x42, 0x6C, 0x78, 0x5F, 0x44, 0xD6, 0xB0, 0x58,
-    0x0B, 0xDB, 0xFD, 0x4B, 0xD9, 0xD6, 0x52, 0x08, 0x12, 0x66, 0xB0, 0x68, 0x8D, 0xD7, 0x3B, 0x28,
-    0x2D, 0x8A, 0x3C, 0x71, 0xC6, 0xEA, 0x77, 0x6A, 0x03, 0xF3, 0x4C, 0x26, 0xED, 0x89, 0x72, 0xE6,
-    0xF4, 0xDA, 0xED, 0x27, 0x77, 0x0A, 0x99, 0x59, 0xBE, 0x11, 0xDB, 0x25, 0xDD, 0x56, 0xB5, 0xA2,
-    0x2A, 0x84, 0x0C, 0x66, 0x5C, 0xC5, 0x83, 0x9F, 0xFC, 0x4C, 0x35, 0x9C, 0x16, 0x65, 0xA1, 0x2D,
-    0xCD, 0x5F, 0xB5, 0x35, 0x19, 0x34, 0xEA, 0xAF, 0x4E, 0x43, 0xB9, 0x2A, 0x01, 0xF0, 0xCA, 0xC4,
-    0x8E, 0xDD, 0x53, 0xC4, 0x01, 0x37, 0x97, 0xC6, 0x01, 0x5D, 0x37, 0x16, 0xFE, 0x99, 0x75, 0xC3,
-    0x88, 0xA9, 0xCB, 0xF1, 0xDD, 0x9F, 0xF0, 0x73, 0x6E, 0x15, 0x67, 0x85, 0x1B, 0x22, 0x2C, 0x70,
-    0xFB, 0x91, 0xB4, 0x96, 0x6C, 0x15, 0xED, 0x2D, 0xBF, 0x3E, 0x11, 0x8E, 0xB7, 0xA8, 0x21, 0x93,
-    0x7F, 0xDB, 0x9F, 0xFB, 0x2F, 0xEF, 0xCD, 0x2E, 0x09, 0xA4, 0xC6, 0x57, 0x25, 0x0E, 0x76, 0x2F,
-    0x51, 0x0B, 0xC1, 0xB9, 0xC4, 0x77, 0xBA, 0x9A, 0x3A, 0xA5, 0x8B, 0x31, 0x1C, 0xD0, 0x21, 0x16,
-    0x29, 0xE8, 0xC9, 0x19, 0x0B, 0xD2, 0x84, 0x68, 0x77, 0x67, 0x09, 0xA9, 0xD7, 0x83, 0xD4, 0xFB,
-    0xCB, 0xA5, 0xCE, 0xFB, 0x81, 0xD8, 0x40, 0x8B, 0x5A, 0xA4, 0x92, 0xB7, 0x74, 0x31, 0x0E, 0xAD,
-    0xD3, 0xF4, 0xB1, 0x51, 0xB5, 0x43, 0x43, 0x6C, 0x2F, 0x7F, 0x6E, 0xFE, 0xE4, 0x58, 0x26, 0x0E,
-    0xF3, 0xFB, 0xC1, 0x20, 0xE3, 0xB5, 0x47, 0xC2, 0xE5, 0xF9, 0xAE, 0x5C, 0x0B, 0x2F, 0xC1, 0x99,
-    0xED, 0x7D, 0xC3, 0xCE, 0x85, 0x9D, 0xD0, 0xE0, 0x56, 0x8B, 0xF2, 0xC0, 0x51, 0x07, 0x96, 0x5E,
-    0x9D, 0xA3, 0xF7, 0x84, 0xA8, 0xA3, 0xB0, 0x57, 0x57, 0x79, 0xA6, 0x76, 0x75, 0x17, 0x36, 0xAC,
-    0x63, 0xF7, 0xBD, 0x95, 0x74, 0x92, 0x0C, 0x74, 0xF4, 0x9A, 0x3F, 0x55, 0xFF, 0x8E, 0xD8, 0x81,
-    0xA6, 0xBB, 0xF5, 0x61, 0xA7, 0xB8, 0xAC, 0x84, 0xF2, 0x3B, 0x2A, 0x29, 0x63, 0xF7, 0x2C, 0xF7,
-    0xE1, 0x96, 0x4B, 0x63, 0x35, 0xED, 0x4E, 0x75, 0x5B, 0xA2, 0x8F, 0x9D, 0x60, 0xA8, 0x1B, 0xFE,
-    0xE2, 0xFE, 0x5E, 0x82, 0xE3, 0xC6, 0x0D, 0x69, 0x89, 0x96, 0x9B, 0x58, 0xAA, 0x17, 0x70, 0x49,
-    0x82, 0xA3, 0x7F, 0xD5, 0x6A, 0x46, 0xB9, 0xAD, 0xCC, 0xCD, 0xB8, 0x1B, 0x53, 0x76, 0x6E, 0x33,
-    0x34, 0x96, 0x74, 0x91, 0x5E, 0xCC, 0xF1, 0x15, 0x15, 0x42, 0x73, 0xF6, 0xFA, 0xBB, 0xB4, 0xC9,
-    0x77, 0x33, 0x32, 0xE6, 0xF6, 0xB4, 0x9A, 0xCC, 0xFC, 0xE9, 0xF1, 0x92, 0x8C, 0x70, 0x3B, 0x46,
-    0xCF, 0x79, 0xA6, 0x1D, 0xBB, 0x6C, 0xBF, 0x3C, 0x63, 0x47, 0x16, 0x87, 0xDA, 0x90, 0xED, 0x5E,
-    0x5D, 0x46, 0x43, 0x09, 0x87, 0xF2, 0x8C, 0x8D, 0xE6, 0xFA, 0xEF, 0xD7, 0x86, 0xAC, 0x43, 0xDD,
-    0x41, 0xB9, 0xE5, 0x8B, 0xEC, 0x0D, 0xD2, 0x01, 0x1C, 0x90, 0xFD, 0x2A, 0xE7, 0x16, 0xFA, 0xAB,
-    0x70, 0x6D, 0x43, 0x33, 0xD8, 0xEE, 0x56, 0xD3, 0xA9, 0x05, 0xB8, 0x63, 0xDA, 0xC9, 0x4F, 0xA1,
-    0x27, 0x33, 0xF1, 0x80, 0xF0, 0xE0, 0x05, 0xD1, 0x71, 0x7C, 0x37, 0xFF, 0x35, 0x1E, 0xCB, 0x79,
-    0x92, 0xFC, 0x74, 0x2C, 0xD0, 0x97, 0xC3, 0xE3, 0xE8, 0x74, 0x0F, 0x0F, 0x56, 0xB0, 0x3E, 0x99,
-    0x16, 0xE5, 0x84, 0xB4, 0xC1, 0x11, 0x0F, 0xD6, 0x6B, 0xAF, 0x1A, 0x75, 0xE4, 0x1C, 0xC1, 0x09,
-    0xE6, 0x29, 0xD6, 0x33, 0xB6, 0x0B, 0x66, 0x2B, 0xE2, 0xB0, 0xF0, 0x5B, 0x1C, 0x1C, 0x95, 0xEF,
-    0x31, 0x35, 0xE4, 0xD1, 0xCB, 0x5C, 0xFE, 0xC8, 0xCD, 0xE5, 0x55, 0x3F, 0x06, 0x30, 0x0D, 0xFF,
-    0xCD, 0xBC, 0x9F, 0x5C, 0x18, 0x97, 0xDB, 0x89, 0x31, 0xBD, 0xC6, 0xEF, 0x45, 0x90, 0x90, 0xE2,
-    0xC0, 0x8B, 0x70, 0x2A, 0xD6, 0x01, 0x8B, 0x9D, 0x80, 0xE0, 0xCF, 0x87, 0x54, 0x72, 0xB7, 0x60,
-    0x46, 0xA3, 0xDD, 0xE6, 0xF7, 0x27, 0x06, 0x3B, 0xB3, 0x27, 0xDE, 0xE6, 0xF7, 0x22, 0xC8, 0x28,
-    0x59, 0x3B, 0x38, 0xA8, 0xCC, 0x5D, 0x4D, 0xFA, 0xBB, 0x43, 0xD5, 0x40, 0xA8, 0xAF, 0xD5, 0x52,
-    0xB8, 0xE2, 0xF9, 0x5A, 0x45, 0xCE, 0xA0, 0x62, 0xDD, 0xA4, 0xF5, 0xCC, 0x70, 0x8B, 0xAF, 0x69,
-    0x2E, 0xC4, 0xEB, 0x7F, 0x9D, 0x74, 0xF6, 0x43, 0x7B, 0xC4, 0xBE, 0xE0, 0x8E, 0x5E, 0x30, 0x21,
-    0x9A, 0x80, 0x32, 0xBB, 0x67, 0x09, 0x3F, 0xE8, 0x60, 0x7E, 0x47, 0xDB, 0x64, 0x39, 0xB4, 0x9D,
-    0x1A, 0xE4, 0xFC, 0xBA, 0xDA, 0x4B, 0xCF, 0x9D, 0x58, 0x6F, 0xBD, 0x7D, 0xE7, 0x9E, 0x0B, 0x65,
-    0x8F, 0xC8, 0x1C, 0x2D, 0x90, 0x69, 0x18, 0x13, 0xCD, 0xD9, 0x12, 0xBD, 0xCA, 0xD6, 0xBC, 0x0F,
-    0xE4, 0x58, 0x76, 0xF6, 0x17, 0x4B, 0x82, 0x37, 0x56, 0x88, 0x93, 0x30, 0xDC, 0xE2, 0x72, 0x84,
-    0xF7, 0x9D, 0x7F, 0x03, 0xE9, 0xA7, 0x3D, 0x4C, 0x8B, 0x78, 0x8B, 0x1C, 0xBB, 0xA8, 0x38, 0x7A,
-    0xAE, 0xB6, 0xCD, 0xEB, 0xCD, 0x77, 0xB5, 0x7C, 0xED, 0x46, 0x16, 0x2D, 0x0E, 0x36, 0x68, 0x34,
-    0x74, 0x28, 0x77, 0x19, 0x6F, 0x2A, 0xCB, 0x2C, 0x15, 0x64, 0x5A, 0xDD, 0xFD, 0x63, 0x8B, 0x41,
-    0x2F, 0x4C, 0x51, 0x72, 0xBD, 0x3B, 0xB8, 0x30, 0x65, 0xEE, 0x5F, 0x7F, 0xE4, 0xC2, 0x94, 0x66,
-    0x0F, 0x89, 0xB5, 0xBB, 0xB0, 0x62, 0xCB, 0x6A, 0x31, 0x64, 0x29, 0x5C, 0x23, 0xE1, 0x02, 0xBE,
-    0xA4, 0xF8, 0xB1, 0x9A, 0xBC, 0x7B, 0x28, 0x93, 0x7A, 0x65, 0x00, 0x1A, 0xAA, 0xBA, 0xD2, 0xFA,
-    0x16, 0xBF, 0x91, 0x0F, 0x29, 0x15, 0x40, 0x3E, 0xE4, 0x3D, 0xCB, 0xB9, 0x6B, 0x54, 0x76, 0x09,
-    0x97, 0xE4, 0x43, 0x45, 0x16, 0xC9, 0x07, 0xCF, 0x60, 0x7C, 0x59, 0xC3, 0xE9, 0x46, 0xD4, 0xAA,
-    0x46, 0x38, 0x1D, 0x9C, 0xA9, 0xC5, 0x5B, 0x22, 0x7F, 0xEA, 0xE4, 0xC2, 0xB3, 0x3C, 0xA4, 0x4E,
-    0xFF, 0xD7, 0x53, 0x0F, 0xEA, 0xFC, 0xCF, 0x1E, 0x29, 0x1D, 0x79, 0x5D, 0xFE, 0xB7, 0x07, 0xBC,
-    0x9D, 0xD7, 0xFE, 0x5D, 0x64, 0x7D, 0xE2, 0xC3, 0x1B, 0x9E, 0x39, 0x35, 0x9F, 0xC8, 0xA3, 0xF0,
-    0x33, 0xF2, 0x4F, 0xFB, 0xC8, 0x33, 0x1F, 0xE1, 0x8B, 0x36, 0xF2, 0xCC, 0x60, 0x79, 0x20, 0x1F,
-    0x50, 0x44, 0x95, 0x3F, 0x40, 0xB9, 0x19, 0x4B, 0xD1, 0x9A, 0xC8, 0xAE, 0xCA, 0xDA, 0x30, 0xAF,
-    0x81, 0x5E, 0x9C, 0x7D, 0x58, 0x2A, 0xE4, 0x0A, 0xE9, 0x5B, 0x58, 0x26, 0x70, 0x51, 0x61, 0x2B,
-    0x3A, 0x06, 0xBD, 0xA5, 0x05, 0x19, 0x97, 0x3A, 0x73, 0x55, 0xEB, 0x5C, 0xFD, 0x86, 0x42, 0x11,
-    0xF7, 0x93, 0x3D, 0x24, 0x54, 0x6C, 0x1F, 0x31, 0x8B, 0x4E, 0x8B, 0x6A, 0x33, 0x67, 0x9D, 0x0B,
-    0x7B, 0xD4, 0xBE, 0x6F, 0x62, 0xC8, 0x5E, 0xEC, 0xD6, 0x44, 0xA4, 0x2F, 0x4C, 0xDA, 0xA4, 0xBE,
-    0x96, 0xA9, 0x94, 0x9B, 0xFC, 0xE3, 0x1A, 0x10, 0xF5, 0xA6, 0x94, 0xBE, 0x41, 0x10, 0xF1, 0x35,
-    0xB0, 0xBB, 0xAC, 0x7D, 0x5A, 0x63, 0x41, 0x7C, 0xD2, 0xA7, 0x9F, 0x80, 0x2B, 0x1F, 0xB6, 0x29,
-    0xEE, 0x8E, 0xCB, 0x7F, 0xDF, 0xA6, 0x5F, 0x80, 0x39, 0x1F, 0x6F, 0xD3, 0xAF, 0xC0, 0x92, 0x07,
-    0x4D, 0xFA, 0x00, 0x1C, 0x91, 0xB7, 0xD1, 0x32, 0xF6, 0x6B, 0xE6, 0x4D, 0xCA, 0x14, 0x53, 0x2D,
-    0xCB, 0x53, 0xA0, 0x9F, 0x7D, 0xA1, 0xE1, 0x33, 0x3F, 0xDE, 0x9C, 0xE9, 0x2C, 0xCD, 0x41, 0xB3,
-    0xD5, 0xF9, 0x20, 0x6E, 0xCF, 0xD4, 0xEB, 0x33, 0xA7, 0x53, 0x2B, 0x51, 0xC7, 0xBF, 0xE1, 0xBA,
-    0x5C, 0xEA, 0x2D, 0x6F, 0x59, 0xB8, 0x4E, 0x56, 0x43, 0x73, 0x5C, 0xDF, 0x33, 0xDE, 0x7F, 0xBB,
-    0x60, 0xFE, 0x71, 0xC2, 0x6A, 0xC6, 0x8C, 0x6E, 0x5F, 0xA5, 0xC0, 0x06, 0x8B, 0xDF, 0xAC, 0x28,
-    0x63, 0x39, 0x96, 0x66, 0xB4, 0x57, 0x94, 0xB5, 0x5C, 0xEE, 0xA4, 0x5D, 0x55, 0xBB, 0x18, 0xEE,
-    0x38, 0xB5, 0x4B, 0x4E, 0xAD, 0xD0, 0xC7, 0xAE, 0x39, 0xD5, 0x7B, 0x4E, 0xED, 0xA2, 0xD3, 0xFD,
-    0x9B, 0x4E, 0x01, 0xBB, 0xA3, 0x92, 0x25, 0xD7, 0xCD, 0x06, 0x01, 0xBD, 0x8E, 0x67, 0x68, 0xAE,
-    0xC9, 0x9D, 0x88, 0x14, 0xCB, 0x2C, 0x43, 0x7C, 0x01, 0x17, 0xE1, 0xB5, 0x7A, 0xB3, 0x6B, 0x6B,
-    0x91, 0x0E, 0xFA, 0xC0, 0x71, 0x47, 0x07, 0x38, 0xEE, 0xE8, 0x73, 0x2E, 0x3A, 0xCE, 0x64, 0xCE,
-    0x42, 0x7F, 0x39, 0xE5, 0x8C, 0x66, 0xBB, 0x86, 0xC0, 0x4F, 0xC8, 0x54, 0x18, 0x9F, 0x57, 0xDD,
-    0x8D, 0xFE, 0xA9, 0xCE, 0x37, 0x78, 0xA2, 0xB1, 0xED, 0x51, 0xD4, 0xC7, 0x3B, 0xFA, 0x7C, 0xA5,
-    0xCF, 0x57, 0xFA, 0x60, 0xA5, 0x4F, 0x94, 0x9F, 0x4D, 0x57, 0x6F, 0xDC, 0x00, 0x3D, 0x4C, 0x76,
-    0x90, 0x67, 0xBA, 0xC3, 0xDA, 0x48, 0x1B, 0xDC, 0x86, 0xF0, 0xF2, 0xD9, 0xCD, 0xBD, 0xA0, 0xCD,
-    0xF5, 0x90, 0xAD, 0xBB, 0x75, 0x7F, 0xA8, 0xE3, 0x09, 0xD9, 0x3A, 0xC5, 0x41, 0xF6, 0xDF, 0xF1,
-    0x30, 0xAF, 0xF9, 0x70, 0xA5, 0x44, 0xCF, 0xD8, 0x36, 0x9D, 0x75, 0x02, 0x3D, 0xDE, 0xD0, 0xC0,
-    0x26, 0x94, 0x85, 0xD9, 0xC5, 0x16, 0xBC, 0x78, 0x51, 0xE9, 0x0D, 0xBF, 0xD4, 0xCC, 0x9E, 0xE5,
-    0x70, 0x4A, 0x54, 0xED, 0x24, 0x0E, 0x3B, 0xFE, 0x52, 0xCF, 0x0E, 0xBD, 0xDE, 0xD3, 0xB0, 0x58,
-    0x4D, 0x0D, 0xFA, 0x72, 0xB5, 0x22, 0x40, 0xD1, 0xF3, 0xB0, 0xEA, 0x08, 0x6E, 0xB4, 0xD6, 0x86,
-    0x05, 0x48, 0x68, 0x57, 0xD1, 0xCE, 0xA5, 0x41, 0xBC, 0x04, 0x69, 0x06, 0x63, 0xE0, 0x18, 0xD5,
-    0xD2, 0x39, 0xBE, 0x52, 0x1A, 0xE2, 0xB7, 0x35, 0x08, 0x60, 0xAE, 0x97, 0x32, 0x86, 0xEA, 0x0D,
-    0xC8, 0x21, 0x9A, 0xFC, 0x3C, 0x5C, 0xD3, 0xA1, 0x3F, 0xAF, 0x6D, 0xB6, 0x89, 0x17, 0x3F, 0x94,
-    0x48, 0x89, 0x86, 0xAB, 0xD1, 0x54, 0x46, 0x90, 0x5E, 0xE8, 0x12, 0x77, 0xE3, 0x7D, 0xA7, 0xE9,
-    0x04, 0x02, 0x8C, 0xB7, 0xFB, 0x39, 0x04, 0xD7, 0x81, 0xC5, 0x4F, 0x77, 0x55, 0xDB, 0xB3, 0x63,
-    0x31, 0x2E, 0xD8, 0x02, 0x44, 0xB7, 0x63, 0xF8, 0x76, 0xDE, 0xA7, 0x9A, 0x07, 0xA3, 0xD9, 0x8D,
-    0x96, 0x2C, 0x57, 0xFA, 0xB1, 0x1C, 0x7F, 0x8F, 0xD5, 0xC6, 0x6B, 0x63, 0xB6, 0x71, 0x7B, 0x60,
-    0x77, 0xB8, 0x1D, 0x7C, 0x11, 0x52, 0xEE, 0x0A, 0x37, 0xB0, 0xDC, 0x96, 0xE1, 0xF0, 0x84, 0x5D,
-    0x9A, 0xBE, 0x9C, 0x18, 0x40, 0x95, 0xED, 0x42, 0x8D, 0x1B, 0x58, 0x1F, 0x9E, 0x30, 0xDB, 0xA8,
-    0x34, 0x27, 0x6B, 0xEB, 0x06, 0xFE, 0x9B, 0x00, 0x4C, 0x02, 0x26, 0x82, 0xC0, 0xFD, 0x20, 0x84,
-    0xCB, 0x2E, 0x15, 0xF3, 0x8F, 0xB9, 0x54, 0x8C, 0xD2, 0x50, 0x71, 0xA8, 0x3C, 0x54, 0x20, 0x01,
-    0xF7, 0x9A, 0x4F, 0x14, 0x4A, 0x8B, 0x5A, 0xAB, 0xDD, 0x44, 0x67, 0xC6, 0x1B, 0x7B, 0xF3, 0xE9,
-    0x2F, 0xEB, 0x89, 0x2A, 0x02, 0x88, 0x99, 0x62, 0x85, 0x0A, 0xEF, 0x87, 0x45, 0xC0, 0xF2, 0x81,
-    0x10, 0x99, 0x28, 0xAD, 0x9A, 0x50, 0x37, 0xB7, 0xCD, 0x88, 0x10, 0x16, 0x8F, 0xA9, 0xA4, 0xBB,
-    0xFA, 0x7A, 0x91, 0xC3, 0x5D, 0xB0, 0x7A, 0xDA, 0x52, 0xC8, 0xC7, 0x0F, 0x38, 0x1D, 0x8A, 0xFB,
-    0xC9, 0x1D, 0xAF, 0x40, 0x61, 0x33, 0x9C, 0x10, 0x15, 0x5F, 0xA0, 0x71, 0xA4, 0xFF, 0x03, 0xED,
-    0x5C, 0xBF, 0x93, 0xE4, 0xC6, 0x75, 0x6E, 0x00, 0xDC, 0x9B, 0xAA, 0x43, 0x80, 0x84, 0x9B, 0xF0,
-    0xAA, 0x0C, 0x07, 0x8E, 0xCE, 0x01, 0xFE, 0x02, 0x17, 0x40, 0x2B, 0x60, 0x95, 0xA3, 0x0B, 0x6E,
-    0x95, 0x38, 0x90, 0x02, 0x46, 0x74, 0x70, 0x89, 0x73, 0x0C, 0xE5, 0x40, 0x81, 0x93, 0x4D, 0x28,
-    0x87, 0xA6, 0xAB, 0x18, 0x1C, 0x97, 0xC1, 0xA5, 0x56, 0x42, 0x0C, 0xA5, 0x50, 0x81, 0x47, 0x72,
-    0xA9, 0x1C, 0x28, 0xF0, 0xA8, 0x74, 0x57, 0x76, 0x51, 0xC1, 0x41, 0x2E, 0xC8, 0xC4, 0x91, 0x18,
-    0xB4, 0xDF, 0xFB, 0xBE, 0xD7, 0x40, 0xCF, 0xDE, 0x9D, 0x48, 0xBB, 0x24, 0xD6, 0xF2, 0xAC, 0xAD,
-    0x5A, 0x74, 0xCF, 0xEE, 0x0C, 0xD0, 0xFD, 0x7E, 0xFF, 0xF8, 0x7A, 0x9C, 0xD3, 0x9F, 0x37, 0x3E,
-    0xC0, 0xE0, 0xEA, 0xD1, 0xB9, 0x3B, 0x7E, 0x74, 0xED, 0xE0, 0x12, 0xEF, 0x7D, 0xD3, 0xF5, 0x2E,
-    0x97, 0xF1, 0x97, 0x7E, 0xEF, 0x2A, 0x19, 0xBF, 0xF0, 0x5B, 0xD7, 0xF9, 0x8F, 0xBC, 0x9F, 0xE5,
-    0xDF, 0xA3, 0xAB, 0xFD, 0xE0, 0x32, 0x7F, 0x70, 0xA5, 0x6F, 0xE4, 0x6D, 0x3B, 0x57, 0x78, 0x87,
-    0xDF, 0x5C, 0x7E, 0xCB, 0x99, 0x63, 0x3D, 0x39, 0xB7, 0xB1, 0x51, 0x5F, 0xB7, 0xA3, 0x8D, 0x03,
-    0xDF, 0x2B, 0x4F, 0x58, 0xC7, 0x99, 0x63, 0x75, 0xE4, 0xA8, 0x9F, 0xD1, 0x51, 0x3F, 0xD3, 0xC9,
-    0xFB, 0x3D, 0xE7, 0xFA, 0x48, 0x57, 0x1F, 0xE5, 0x63, 0x3B, 0x79, 0xAF, 0x7F, 0xD2, 0xC9, 0xE3,
-    0xE5, 0x85, 0xAE, 0x4A, 0x9F, 0xE5, 0x65, 0x55, 0x0E, 0xCB, 0xDF, 0xE9, 0x96, 0x4A, 0xFF, 0x8C,
-    0x7B, 0xBB, 0x70, 0xCB, 0xCF, 0xDD, 0xF7, 0x31, 0xB4, 0x3D, 0x06, 0x7D, 0xC4, 0x83, 0xC7, 0x4E,
-    0xF6, 0x28, 0x7B, 0xFD, 0x4B, 0xF9, 0x54, 0xED, 0xFD, 0x2F, 0xE4, 0x9E, 0x72, 0x07, 0x7F, 0x94,
-    0xA7, 0x7D, 0xEE, 0xBD, 0x92, 0x61, 0x57, 0xCF, 0x8D, 0x2E, 0xB5, 0x9A, 0xB0, 0xBB, 0x52, 0x16,
-    0x29, 0x53, 0x1D, 0x64, 0x9D, 0xE5, 0x04, 0xE2, 0x61, 0x18, 0xF0, 0x16, 0xD9, 0xA0, 0xAE, 0x5F,
-    0x9E, 0xA1, 0x44, 0x95, 0x57, 0xD8, 0xD1, 0x98, 0xE8, 0x26, 0xEA, 0x63, 0x2E, 0x4F, 0x93, 0xA5,
-    0x79, 0x21, 0xA8, 0x2E, 0x5D, 0x57, 0x9E, 0x79, 0x21, 0xA9, 0xAE, 0x4A, 0xFF, 0x26, 0x1B, 0xB8,
-    0xB7, 0xAE, 0x37, 0xBD, 0xB2, 0xC9, 0x46, 0x96, 0xD5, 0x1E, 0x64, 0x50, 0x12, 0x62, 0x55, 0x4A,
-    0x33, 0xA1, 0x47, 0xE1, 0xE5, 0x99, 0x89, 0xDC, 0xB4, 0xD0, 0xC5, 0x26, 0xB2, 0x09, 0xB9, 0xF9,
-    0xDE, 0xA5, 0x98, 0xCC, 0x7A, 0xF3, 0xAD, 0x90, 0xEA, 0xA0, 0x93, 0x06, 0x0B, 0xC2, 0xAD, 0x6A,
-    0xA5, 0x54, 0xE0, 0x06, 0x26, 0xBA, 0xC8, 0x85, 0x0F, 0xAE, 0x38, 0xE2, 0xE6, 0x0E, 0xFB, 0xD2,
-    0x15, 0x3B, 0x3C, 0x45, 0xE9, 0x2A, 0x7B, 0x4B, 0x39, 0x51, 0x86, 0x60, 0x32, 0xE0, 0x29, 0xD8,
-    0xB2, 0xDE, 0x1C, 0x13, 0xBD, 0x27, 0x6E, 0xAF, 0xF2, 0x80, 0x4F, 0x29, 0x51, 0x64, 0xE2, 0x7F,
-    0xC0, 0xDD, 0xAA, 0x58, 0x81, 0x0D, 0x45, 0x60, 0x58, 0x46, 0x72, 0x80, 0x12, 0x07, 0x4E, 0x92,
-    0xFB, 0x2E, 0xFA, 0xB9, 0xBA, 0xE4, 0x1F, 0xB1, 0x20, 0x87, 0x65, 0x5C, 0x34, 0xC9, 0xC5, 0xB7,
-    0xFC, 0x56, 0x96, 0x96, 0xFA, 0x9F, 0x78, 0xFD, 0x53, 0x46, 0xDE, 0x6D, 0x33, 0x0F, 0x21, 0x6D,
-    0x36, 0x4A, 0x6A, 0x59, 0x56, 0xAE, 0x8F, 0x15, 0x81, 0xD4, 0x3D, 0xEA, 0xEA, 0x30, 0xCA, 0x45,
-    0xB7, 0xAA, 0x17, 0xDD, 0xA9, 0x5E, 0x94, 0x85, 0x7A, 0x01, 0xAD, 0x64, 0x04, 0x85, 0xE4, 0x45,
-    0xC7, 0x11, 0x6C, 0x94, 0x31, 0xE3, 0x78, 0x2C, 0xB1, 0x54, 0x11, 0x9C, 0x6E, 0x0F, 0x99, 0x9B,
-    0xDB, 0x1D, 0xF6, 0x34, 0x61, 0x4C, 0xFD, 0x01, 0xA3, 0x3B, 0x77, 0x27, 0x3F, 0x77, 0xB7, 0xC9,
-    0xD5, 0xF2, 0xA2, 0xEC, 0xF3, 0xE3, 0xF2, 0x22, 0x9F, 0xEA, 0x7E, 0x79, 0x91, 0x19, 0x65, 0x6C,
-    0xDB, 0x3E, 0xBA, 0x83, 0x3F, 0x46, 0x2F, 0xCE, 0xEF, 0xB9, 0x6B, 0x3F, 0x1B, 0x3F, 0x5F, 0x3A,
-    0xA8, 0x30, 0xD4, 0x4F, 0x09, 0x5B, 0xF0, 0x05, 0xC9, 0x1D, 0xBD, 0xE8, 0x21, 0x8E, 0x23, 0xA5,
-    0x72, 0x0A, 0x7C, 0x29, 0xA7, 0x04, 0x8F, 0xD8, 0x28, 0xB1, 0x95, 0x1C, 0x20, 0x97, 0xB2, 0x59,
-    0xF8, 0xA8, 0x7A, 0x2B, 0x7B, 0x26, 0x61, 0xF0, 0xA2, 0x9B, 0xC8, 0x6D, 0x65, 0x7B, 0x02, 0x3D,
-    0xEC, 0x28, 0x03, 0x19, 0x98, 0xE5, 0xF9, 0x02, 0x9F, 0x57, 0xC1, 0xD2, 0x17, 0x15, 0xB6, 0x03,
-    0x11, 0x96, 0x8F, 0x4E, 0xC6, 0x58, 0x7D, 0x81, 0xCF, 0x2B, 0x77, 0x85, 0x3D, 0xD0, 0x79, 0x08,
-    0x9A, 0x18, 0x87, 0x1C, 0xE4, 0x50, 0x61, 0xAB, 0x27, 0xFB, 0xBC, 0x8A, 0x75, 0x27, 0x76, 0xEB,
-    0xC8, 0x5D, 0xE3, 0xE1, 0xF8, 0xBC, 0x3E, 0x63, 0xE3, 0x0F, 0xFC, 0xBC, 0xDE, 0xF6, 0x81, 0xDF,
-    0xF1, 0xF3, 0xF2, 0xE2, 0x91, 0xD0, 0xB2, 0xF4, 0x9F, 0x5E, 0x3D, 0x0C, 0xBB, 0xAE, 0x49, 0x0F,
-    0xDD, 0xFC, 0x21, 0x7E, 0x21, 0x5A, 0x47, 0xE2, 0xC8, 0xDF, 0x84, 0xA0, 0x9D, 0x19, 0x19, 0xFE,
-    0xDC, 0xFE, 0x40, 0x18, 0x19, 0x58, 0x75, 0x4C, 0xE4, 0xCD, 0x24, 0x7B, 0xEA, 0x95, 0xA1, 0xA4,
-    0xBA, 0xC3, 0x07, 0x4C, 0xC6, 0x5B, 0x25, 0x06, 0x69, 0x2E, 0x37, 0x6C, 0xC2, 0xC3, 0xDD, 0xD9,
-    0x7D, 0xB7, 0x52, 0xDC, 0xB9, 0x40, 0xF0, 0xB3, 0x8B, 0x8B, 0xFB, 0x81, 0xDE, 0x15, 0xDE, 0x48,
-    0x72, 0xD7, 0x98, 0x93, 0xDA, 0x35, 0x56, 0x47, 0x62, 0xB7, 0x78, 0x96, 0xD1, 0x3A, 0xD5, 0x8D,
-    0x1B, 0xA9, 0x73, 0xA5, 0xBB, 0x51, 0xBA, 0xF4, 0x2B, 0xA1, 0x55, 0x25, 0x8D, 0xCE, 0xB0, 0xB1,
-    0x46, 0x66, 0xF0, 0xCC, 0xA8, 0x8C, 0x8F, 0x1A, 0x91, 0xCB, 0x79, 0xA5, 0x31, 0x18, 0x46, 0x12,
-    0xE3, 0xA3, 0x46, 0x61, 0xB2, 0x9B, 0x04, 0xCE, 0xFD, 0x7B, 0x17, 0x61, 0x8B, 0x7A, 0x8D, 0xC9,
-    0x1B, 0xA8, 0x5B, 0x83, 0x48, 0x24, 0x6E, 0xED, 0xC3, 0xFE, 0xEF, 0xBE, 0x7F, 0xFB, 0x7D, 0xF7,
-    0xCE, 0x96, 0xA6, 0x7A, 0x33, 0xA5, 0x30, 0x2A, 0xB2, 0xC9, 0xD4, 0x17, 0x93, 0x33, 0xA9, 0x31,
-    0xEB, 0xA1, 0xD6, 0xA9, 0x25, 0x5B, 0x75, 0x57, 0x35, 0xDF, 0xAA, 0xA6, 0xEA, 0xEC, 0xFE, 0x62,
-    0x25, 0xA8, 0x3F, 0x1F, 0x8B, 0xA1, 0x38, 0x07, 0x49, 0x0B, 0xFF, 0x2B, 0xDF, 0x90, 0x8A, 0xB5,
-    0xFF, 0x2C, 0x10, 0x54, 0xCD, 0x3E, 0xE9, 0x09, 0xD3, 0xAF, 0xE4, 0x54, 0x83, 0xB6, 0xAB, 0x67,
-    0x8A, 0x71, 0xE1, 0x9B, 0xEA, 0x48, 0x62, 0x0A, 0xC1, 0x4A, 0x7A, 0x03, 0xB8, 0x82, 0x89, 0x02,
-    0xAC, 0x42, 0x39, 0x92, 0x92, 0xC2, 0xA8, 0x6A, 0x24, 0x21, 0xC5, 0x3C, 0xD6, 0xCA, 0xAA, 0x86,
-    0xAE, 0xA1, 0x77, 0xD5, 0xEC, 0x82, 0x5F, 0x68, 0x4D, 0x6D, 0x02, 0x11, 0xDB, 0x31, 0xF5, 0x7B,
-    0xB3, 0xAA, 0xE2, 0x2A, 0x76, 0x05, 0x48, 0xA8, 0x04, 0xDB, 0x55, 0xA0, 0x9A, 0xD2, 0x71, 0x47,
-    0x02, 0xE6, 0x7E, 0xEA, 0xB6, 0xA4, 0x9F, 0xF0, 0xDA, 0x37, 0x2D, 0xC9, 0x77, 0x1E, 0x1B, 0x01,
-    0xBB, 0xC0, 0x18, 0xC3, 0x49, 0x9B, 0xD1, 0xB3, 0x89, 0xBC, 0x5F, 0xDD, 0x18, 0x2E, 0xA5, 0xD9,
-    0x3D, 0x1A, 0xC0, 0x9A, 0xC2, 0xC6, 0x0B, 0xBC, 0x85, 0xDA, 0x41, 0xD8, 0x42, 0x75, 0x9E, 0x70,
-    0x12, 0x7A, 0xC1, 0xAA, 0xF5, 0x02, 0x35, 0x83, 0xC8, 0xED, 0xC9, 0x09, 0x78, 0x0B, 0x25, 0x3E,
-    0x18, 0xA0, 0x7B, 0xCA, 0x38, 0xD9, 0xD2, 0x5B, 0xA8, 0x4C, 0xE9, 0x2F, 0x5C, 0x06, 0x56, 0x9A,
-    0xBF, 0x78, 0xA5, 0xFE, 0xEA, 0x6A, 0x8B, 0x05, 0xAA, 0xD3, 0x2C, 0x83, 0x5E, 0x56, 0x36, 0xE1,
-    0x4A, 0x31, 0x19, 0x6D, 0xDB, 0x5D, 0xD0, 0x50, 0x93, 0x10, 0xC8, 0x28, 0x23, 0x02, 0x93, 0x85,
-    0xD2, 0xD3, 0xD5, 0xEA, 0xC4, 0x14, 0xCE, 0xDB, 0xA7, 0xF3, 0xB9, 0x59, 0x2D, 0x2E, 0xFD, 0x8D,
-    0x13, 0xA1, 0xC3, 0x02, 0x85, 0xDD, 0x58, 0x9F, 0x48, 0x01, 0x96, 0x27, 0x8B, 0xA1, 0x37, 0xE9,
-    0x49, 0x46, 0xF3, 0x97, 0xA6, 0xC0, 0x12, 0x78, 0xDC, 0xE3, 0xA2, 0x84, 0x50, 0x20, 0xA1, 0x2C,
-    0x03, 0x14, 0x14, 0xEA, 0x28, 0xED, 0x94, 0x4A, 0xBA, 0x44, 0x25, 0x10, 0x3D, 0xF4, 0xCE, 0x99,
-    0xE6, 0x25, 0x24, 0x55, 0x03, 0xDA, 0xC9, 0xB3, 0x41, 0xBA, 0xDC, 0x93, 0x72, 0x85, 0x27, 0xE1,
-    0xE4, 0xD9, 0x58, 0x56, 0x71, 0xE4, 0xB2, 0xC2, 0x72, 0xAA, 0x89, 0x44, 0xD3, 0xB0, 0x44, 0x69,
-    0xA6, 0xB2, 0xA8, 0x24, 0x93, 0x67, 0x83, 0x62, 0xBA, 0x1C, 0x1B, 0x83, 0x32, 0x05, 0x4D, 0x0A,
-    0xBA, 0xE3, 0xCC, 0xE6, 0xCA, 0xCF, 0xAD, 0x47, 0xA4, 0xD5, 0xC6, 0x48, 0xB5, 0x31, 0x25, 0xDD,
-    0x98, 0x21, 0xA4, 0xEB, 0x97, 0x40, 0x45, 0xA8, 0xA5, 0xEE, 0x55, 0x4D, 0x86, 0x51, 0x48, 0x2D,
-    0xD7, 0xD1, 0x14, 0x24, 0x3F, 0x90, 0x26, 0x21, 0x0C, 0x18, 0x41, 0x1D, 0x48, 0xBE, 0x08, 0x14,
-    0x28, 0x42, 0x7A, 0x90, 0x1A, 0x72, 0x4D, 0x54, 0x13, 0x94, 0x12, 0xA4, 0x03, 0xA8, 0xB0, 0x05,
-    0x0D, 0x9A, 0x42, 0xED, 0x4E, 0x53, 0x80, 0x1D, 0x85, 0xC6, 0x83, 0xB6, 0xF7, 0x0A, 0x0F, 0x64,
-    0x38, 0xA6, 0xBB, 0x9E, 0x2C, 0x18, 0xEB, 0x10, 0x8B, 0xA9, 0xBE, 0x0D, 0xB6, 0x5B, 0xEC, 0x95,
-    0x81, 0x04, 0x0D, 0xC4, 0x46, 0xAF, 0xB2, 0xD7, 0x06, 0x86, 0x1B, 0xD2, 0x78, 0xC4, 0x75, 0xC0,
-    0x3F, 0xB7, 0xF6, 0x96, 0x84, 0x3C, 0xC9, 0xE5, 0x2E, 0xB2, 0x8E, 0x0C, 0x9E, 0xB4, 0x97, 0x29,
-    0xC8, 0x60, 0x53, 0x15, 0xE8, 0x52, 0x3E, 0xB7, 0x99, 0xCD, 0xCF, 0xC9, 0xEE, 0x8F, 0xCB, 0xB4,
-    0xA0, 0xF0, 0xD4, 0x72, 0xFB, 0x82, 0x0C, 0xAB, 0xFF, 0x03, 0xEB, 0x57, 0x11, 0x6A, 0x7F, 0xE5,
-    0xD5, 0x6E, 0x28, 0xA5, 0xBA, 0x7F, 0x15, 0x21, 0x67, 0x28, 0xE9, 0x3F, 0x11, 0x9D, 0x67, 0x38,
-    0xE9, 0x77, 0x9C, 0x0E, 0x98, 0xEE, 0x85, 0x74, 0xAD, 0x46, 0x7D, 0xDB, 0xAE, 0xEF, 0x0E, 0xBA,
-    0x41, 0x31, 0x95, 0x75, 0xDF, 0x41, 0xAE, 0x64, 0x7D, 0xF5, 0x40, 0xD1, 0xCA, 0xF4, 0xAE, 0xA0,
-    0xA8, 0xB2, 0xA8, 0x3C, 0x6A, 0xB4, 0xB4, 0xD3, 0xF5, 0x15, 0xB3, 0xDF, 0x62, 0x3F, 0xBA, 0x3E,
-    0xDD, 0xCF, 0x96, 0xC2, 0x6E, 0xFB, 0x99, 0x34, 0x02, 0xE1, 0x7E, 0x34, 0xEA, 0xB3, 0xFD, 0x8C,
-    0x4E, 0x1D, 0x95, 0x2A, 0x69, 0x35, 0x20, 0x10, 0xC1, 0x26, 0x7A, 0x04, 0x01, 0xE5, 0x1A, 0x96,
-    0x54, 0xD3, 0x32, 0xAD, 0xA7, 0x35, 0x88, 0x09, 0x5A, 0x9A, 0x07, 0x03, 0x8E, 0xE9, 0x61, 0x9D,
-    0x6E, 0x97, 0xE9, 0x72, 0xAF, 0x5B, 0xFE, 0x32, 0x0E, 0x6E, 0xDE, 0x8E, 0x02, 0xA4, 0x85, 0x2D,
-    0x39, 0x72, 0x11, 0xB0, 0x45, 0xA7, 0xC6, 0x0B, 0x46, 0x1D, 0x98, 0xA6, 0x6A, 0xB0, 0xC9, 0x16,
-    0x6A, 0x3C, 0xD8, 0x12, 0xA6, 0xC2, 0x96, 0xF3, 0xFB, 0x0B, 0x5B, 0x60, 0x54, 0xC8, 0x16, 0x04,
-    0xF1, 0x64, 0x8B, 0x52, 0xDD, 0xD8, 0xA2, 0x46, 0xD0, 0xD8, 0x02, 0x33, 0x48, 0xB6, 0xC0, 0xFE,
-    0x91, 0x2D, 0x32, 0x35, 0xB6, 0x24, 0x08, 0xC7, 0xC1, 0x96, 0x14, 0x56, 0x10, 0x6C, 0xE1, 0x14,
-    0x6C, 0xC9, 0x10, 0xA0, 0x82, 0x2D, 0xAA, 0xD7, 0xC6, 0x16, 0xA5, 0xBA, 0xB1, 0x05, 0x9B, 0x20,
-    0x5B, 0x0A, 0x4E, 0x95, 0x2D, 0x4A, 0x75, 0x63, 0x8B, 0x1A, 0x72, 0x63, 0x0B, 0x0C, 0x24, 0xD9,
-    0xA2, 0x0C, 0x30, 0xB6, 0xD4, 0x11, 0x2F, 0xC6, 0x65, 0xDA, 0xAE, 0xA1, 0x4C, 0xB7, 0x06, 0x9D,
-    0x0B, 0x5B, 0x92, 0x8F, 0xCC, 0x22, 0x20, 0xF6, 0xDC, 0xAD, 0xD3, 0x66, 0x99, 0x1E, 0x57, 0xBE,
-    0x1E, 0x56, 0xFE, 0x9C, 0x85, 0x37, 0x54, 0xC3, 0xF5, 0x87, 0xB6, 0x61, 0x52, 0x87, 0x7F, 0x95,
-    0x7B, 0xF7, 0xFC, 0xCF, 0x79, 0x53, 0xC9, 0xFD, 0x2E, 0x24, 0x3E, 0xF8, 0xC4, 0x33, 0xF1, 0x68,
-    0x7F, 0xE2, 0x11, 0xDE, 0xBB, 0xEE, 0xDF, 0x4D, 0x50, 0xBD, 0x04, 0x19, 0x5B, 0x4C, 0xA6, 0x8C,
-    0xE4, 0xF2, 0x03, 0x2D, 0x44, 0xA2, 0x61, 0x9F, 0x4E, 0x90, 0x0E, 0x34, 0x88, 0x22, 0x31, 0x41,
-    0x62, 0xB0, 0x01, 0x5B, 0x37, 0x90, 0x8D, 0x6A, 0xB2, 0x54, 0xA0, 0x9E, 0xCC, 0x96, 0x68, 0x84,
-    0x85, 0x1C, 0x4F, 0x16, 0xC8, 0xAC, 0x40, 0x98, 0xC9, 0xB4, 0x40, 0x68, 0xC4, 0xBC, 0xC0, 0x43,
-    0x17, 0x69, 0xBC, 0x64, 0xD2, 0xC2, 0x72, 0xD5, 0x03, 0x4C, 0x98, 0x91, 0x69, 0x89, 0x3A, 0xB2,
-    0x20, 0xCF, 0x9B, 0x40, 0xB6, 0xC2, 0x5C, 0xCE, 0xED, 0xCE, 0x87, 0x3F, 0x1C, 0xC3, 0x64, 0x0C,
-    0x93, 0xC3, 0xA9, 0x37, 0x7A, 0xA7, 0x49, 0x3F, 0x54, 0xA2, 0xED, 0x4B, 0x7D, 0x47, 0x39, 0x74,
-    0x8C, 0xB2, 0x70, 0xCB, 0x8C, 0x1F, 0x4F, 0xED, 0xC3, 0x17, 0xF7, 0x4E, 0xD2, 0x80, 0x7D, 0x74,
-    0xBF, 0x92, 0xAC, 0xAD, 0x39, 0xB4, 0x1C, 0xFC, 0xD3, 0x1E, 0x9F, 0xFE, 0xC7, 0x1E, 0xF7, 0x2A,
-    0x91, 0x10, 0xCE, 0x18, 0x8A, 0x09, 0x8F, 0xAB, 0xC6, 0x02, 0x91, 0x40, 0x8F, 0xA1, 0x3B, 0x20,
-    0x06, 0x93, 0xD8, 0x04, 0xC1, 0xE3, 0x56, 0x07, 0xA5, 0xED, 0xB4, 0xA4, 0x1B, 0x25, 0xD2, 0x67,
-    0xF8, 0x18, 0x35, 0x69, 0xCC, 0xCF, 0xFD, 0xE7, 0x57, 0x8F, 0x66, 0x58, 0xDC, 0x1C, 0xEC, 0x50,
-    0x06, 0x98, 0xE7, 0x2F, 0xA0, 0xC4, 0x30, 0x1D, 0x19, 0xFD, 0xB9, 0xAA, 0xF5, 0x2D, 0x04, 0xD7,
-    0x0C, 0xAB, 0x19, 0x50, 0x33, 0x94, 0x66, 0x10, 0x6D, 0x81, 0xDE, 0xD9, 0x9A, 0x1F, 0x26, 0x1F,
-    0x37, 0x17, 0xAA, 0xF6, 0x07, 0x44, 0x95, 0x9F, 0x5B, 0x1A, 0x2F, 0xB7, 0x9A, 0x61, 0xC2, 0xF6,
-    0x12, 0xC5, 0x31, 0x80, 0xA3, 0xB7, 0xA8, 0xC0, 0xDB, 0x7A, 0x32, 0x96, 0xAA, 0x76, 0x83, 0xA5,
-    0x2D, 0x74, 0xDB, 0xA2, 0xB3, 0x41, 0xC5, 0xBA, 0x1D, 0x35, 0x8C, 0xD3, 0x4C, 0x6F, 0xCF, 0x48,
-    0x4C, 0xB3, 0x3C, 0x18, 0xFE, 0x51, 0x78, 0x8B, 0xD0, 0x2B, 0x44, 0x5D, 0xB7, 0x1E, 0xBA, 0xBB,
-    0x97, 0x2E, 0x9B, 0x1D, 0xE2, 0xED, 0xB7, 0xD4, 0xD0, 0x74, 0x4F, 0x41, 0x3B, 0x30, 0xA0, 0x82,
-    0x2C, 0x9C, 0x5D, 0x44, 0xEC, 0xD1, 0x1D, 0xD1, 0x12, 0x16, 0xE1, 0xBA, 0x5F, 0x14, 0x8B, 0x65,
-    0x0A, 0xAA, 0xA6, 0xB9, 0xAD, 0xC3, 0x35, 0xB7, 0x95, 0x2E, 0x19, 0x11, 0x23, 0x2A, 0x0B, 0xFA,
-    0x2C, 0xFD, 0xA6, 0xA8, 0x21, 0x28, 0x60, 0x9E, 0x6B, 0xF1, 0x49, 0xEC, 0x89, 0x2D, 0x90, 0xD7,
-    0x3B, 0x54, 0x78, 0x78, 0x0D, 0x5D, 0xE7, 0x15, 0x61, 0x78, 0x3E, 0xA9, 0x7F, 0x9B, 0x4B, 0x55,
-    0x44, 0x18, 0x3B, 0xA6, 0x32, 0xAA, 0xA6, 0x0B, 0xF9, 0x31, 0xAB, 0x43, 0x78, 0xC8, 0x35, 0x33,
-    0x36, 0x3C, 0xD8, 0x82, 0x97, 0x78, 0x30, 0x84, 0x7F, 0x5B, 0xD3, 0x89, 0x25, 0xE4, 0x5B, 0x83,
-    0xD2, 0x35, 0x18, 0xE5, 0x22, 0x19, 0x89, 0x0E, 0x71, 0xEA, 0x2C, 0x49, 0xF3, 0xB4, 0xA6, 0xCB,
-    0x96, 0x28, 0xA7, 0x16, 0xA3, 0xF8, 0xE9, 0xF9, 0xB4, 0xF8, 0x0E, 0xF4, 0x03, 0xC5, 0x2D, 0x4A,
-    0xEA, 0x81, 0x01, 0xA4, 0xDA, 0x74, 0xFF, 0x6B, 0x58, 0x19, 0xA4, 0x91, 0xAC, 0x6B, 0x31, 0xCA,
-    0xF7, 0xA1, 0xAA, 0x65, 0x45, 0x2D, 0xAB, 0x65, 0xD9, 0x60, 0x15, 0xAD, 0x8E, 0x05, 0x2D, 0xAB,
-    0x67, 0xE9, 0x20, 0xEF, 0xF6, 0xAC, 0x66, 0x79, 0x16, 0xB3, 0xAC, 0x96, 0x85, 0x52, 0x16, 0x52,
-    0x27, 0xAD, 0x1E, 0x40, 0x20, 0x77, 0xA1, 0x8E, 0x65, 0x65, 0xAC, 0x0D, 0xB3, 0x4D, 0x95, 0x5D,
-    0xD6, 0x13, 0x8E, 0x51, 0x09, 0x8B, 0x49, 0x51, 0x2E, 0xF9, 0x90, 0xEC, 0x78, 0x56, 0x8D, 0x23,
-    0x43, 0x64, 0x03, 0xBB, 0x90, 0x90, 0x47, 0x3C, 0x41, 0x71, 0x0B, 0x7B, 0x6D, 0xC0, 0xCF, 0x3D,
-    0x6E, 0xDB, 0x23, 0xBB, 0x19, 0x51, 0xD7, 0x9A, 0xAC, 0xAC, 0x55, 0xCE, 0x66, 0xE2, 0xD4, 0xEE,
-    0x4D, 0xE6, 0xF5, 0xF4, 0x3A, 0xAC, 0x31, 0x14, 0xEB, 0x59, 0x54, 0x0C, 0x96, 0x41, 0x58, 0xCC,
-    0x62, 0x2D, 0x8B, 0xA5, 0x2C, 0xAB, 0x64, 0xB1, 0x90, 0x65, 0x75, 0x2C, 0x31, 0x5D, 0x0F, 0x69,
-    0xBA, 0x94, 0x7F, 0x55, 0x1F, 0x9B, 0x2E, 0x8B, 0x25, 0x33, 0x0B, 0x25, 0x2F, 0xD6, 0xD0, 0x5B,
-    0x9F, 0xB2, 0xF1, 0x4B, 0x32, 0xCB, 0xDC, 0x15, 0x69, 0xEB, 0xCC, 0xDA, 0xD6, 0x11, 0x43, 0x35,
-    0x31, 0x67, 0x9D, 0x98, 0xAE, 0x8E, 0xA1, 0xB8, 0x65, 0xA5, 0x2D, 0xAB, 0x2F, 0x5A, 0x7A, 0x6B,
-    0x45, 0x2D, 0xB5, 0x33, 0x5A, 0xD6, 0xA4, 0x5F, 0xB1, 0x72, 0x96, 0x15, 0xB3, 0x5A, 0x96, 0xB2,
-    0x64, 0x40, 0xC1, 0x8D, 0x77, 0xB0, 0x22, 0x96, 0xB0, 0xAD, 0x3E, 0xB2, 0x80, 0x35, 0x2D, 0xE5,
-    0xAB, 0x82, 0x8C, 0xCA, 0x3C, 0x25, 0xAF, 0xE5, 0x4E, 0xAC, 0x6C, 0xF5, 0xC6, 0xA5, 0x13, 0x51,
-    0x2D, 0x86, 0x8D, 0x7C, 0x6C, 0x33, 0xA9, 0x33, 0xCC, 0xC8, 0x56, 0xEE, 0xBE, 0x9B, 0x4F, 0xF9,
-    0x95, 0x5C, 0xA8, 0x6D, 0xA0, 0x63, 0xA2, 0x57, 0x62, 0x79, 0x8A, 0x6E, 0xA8, 0x0C, 0x91, 0x34,
-    0x03, 0xDB, 0x3A, 0x18, 0xAC, 0x9A, 0x06, 0x0B, 0x71, 0x48, 0x87, 0xB8, 0xC3, 0x22, 0x69, 0x89,
-    0xA1, 0xF5, 0xBA, 0x41, 0x08, 0xA8, 0x92, 0xE6, 0x87, 0x16, 0x65, 0xDC, 0x19, 0x55, 0x8D, 0x67,
-    0x9A, 0xFF, 0xFB, 0x5F, 0x42, 0xBE, 0xDF, 0xD4, 0xC5, 0xDF, 0x0F, 0xAB, 0x80, 0x07, 0xC9, 0x69,
-    0x6C, 0x69, 0x95, 0xC2, 0x10, 0x16, 0xEA, 0x5E, 0x83, 0x45, 0xE9, 0x51, 0xDB, 0xAA, 0x7A, 0x4A,
-    0x1F, 0x87, 0x72, 0xDF, 0x35, 0xD7, 0xBD, 0xF9, 0x8D, 0xE6, 0xE5, 0xF8, 0xD5, 0x78, 0xB9, 0x04,
-    0x3F, 0x48, 0xB7, 0x3D, 0x7C, 0x95, 0xCA, 0x41, 0x82, 0x82, 0x82, 0x39, 0xFD, 0x51, 0xB2, 0x1C,
-    0xB7, 0x39, 0x56, 0xBD, 0x1A, 0xA6, 0xF5, 0x9A, 0x5C, 0xDE, 0x6A, 0x6E, 0x14, 0x8F, 0x17, 0xD3,
-    0x48, 0xAE, 0xA6, 0xA1, 0xFE, 0xCA, 0xE0, 0x83, 0x71, 0x44, 0xB5, 0x8F, 0x58, 0x5D, 0xEE, 0x6B,
-    0x55, 0xE9, 0xFA, 0xD0, 0x81, 0xD5, 0x07, 0x28, 0x78, 0xB5, 0x6B, 0xDD, 0xAB, 0xCB, 0x6A, 0xC7,
-    0x3A, 0x8D, 0x85, 0xAE, 0xE6, 0x72, 0x61, 0xB4, 0xE0, 0x5C, 0xCE, 0x94, 0x80, 0xD9, 0x90, 0xCB,
-    0xDF, 0xF3, 0xB1, 0xD4, 0x5B, 0x8E, 0x60, 0xF8, 0x50, 0x1E, 0x6E, 0x20, 0xC3, 0x25, 0x22, 0xBF,
-    0x0F, 0x8D, 0xC5, 0xE2, 0xB3, 0xA9, 0x62, 0x1C, 0xC1, 0xD8, 0xB4, 0x3B, 0x46, 0x11, 0xF9, 0xAA,
-    0xDB, 0xDB, 0xFF, 0x67, 0xBA, 0x9D, 0x89, 0x83, 0x96, 0xED, 0xCD, 0x6A, 0xAD, 0x5D, 0x8B, 0xA8,
-    0xB8, 0xF2, 0xBB, 0x28, 0x60, 0x5F, 0x35, 0xDC, 0x74, 0xBB, 0xBE, 0xB9, 0x1A, 0x6E, 0x81, 0x31,
-    0x83, 0xC1, 0xA0, 0xD9, 0xCE, 0x72, 0x91, 0x9A, 0xB9, 0x49, 0x71, 0xF8, 0x1D, 0x1A, 0x8E, 0x41,
-    0x34, 0xFC, 0x95, 0x36, 0xE6, 0xA0, 0x03, 0xAF, 0x35, 0x33, 0x24, 0xD8, 0xC3, 0x0D, 0x2D, 0xA0,
-    0xBE, 0x37, 0x1D, 0x94, 0xE1, 0xF9, 0x04, 0x0D, 0x9F, 0x6E, 0xAE, 0x86, 0x27, 0xDD, 0x63, 0xA4,
-    0x5A, 0x0D, 0x23, 0x47, 0xD0, 0x60, 0xFE, 0xB6, 0xD0, 0x63, 0xCB, 0x08, 0xBA, 0xB2, 0xEE, 0x96,
-    0x3B, 0x7B, 0xA0, 0x99, 0xAE, 0x78, 0x2E, 0xCD, 0xD5, 0x34, 0xDA, 0x9C, 0x0A, 0xFF, 0xA4, 0x1D,
-    0x25, 0x56, 0x6D, 0x07, 0xA4, 0xB6, 0xB5, 0x2E, 0xA3, 0x1E, 0x50, 0xF7, 0xEE, 0xB4, 0x4B, 0xE2,
-    0x8F, 0xCC, 0x50, 0x98, 0xF8, 0x9F, 0xDD, 0x7B, 0x41, 0x94, 0x90, 0xFF, 0xCE, 0x28, 0xA1, 0x66,
-    0x94, 0xD0, 0x45, 0xC1, 0x42, 0x79, 0x78, 0x5E, 0xB0, 0xBE, 0xC9, 0xC9, 0x6A, 0xA8, 0x6E, 0x80,
-    0x44, 0x1D, 0x44, 0x8E, 0x82, 0x77, 0x71, 0xB1, 0x66, 0x7B, 0x1F, 0xA7, 0x23, 0x7A, 0x43, 0xF8,
-    0x0C, 0x16, 0x34, 0xE7, 0xBA, 0xC8, 0xB7, 0x93, 0xCB, 0x2F, 0x49, 0x62, 0xD3, 0x3F, 0x60, 0x12,
-    0x3B, 0x5D, 0x4F, 0x62, 0x17, 0xE6, 0xAE, 0xB1, 0xDF, 0x81, 0xA5, 0xF2, 0x17, 0x54, 0x6A, 0x6A,
-    0x5A, 0x14, 0x36, 0x39, 0x5D, 0xC7, 0xC1, 0x78, 0xFB, 0xDA, 0xAB, 0xC5, 0xDC, 0x0E, 0xCC, 0xF5,
-    0x2F, 0x61, 0x6E, 0x32, 0xB2, 0x0B, 0x18, 0x5D, 0x99, 0x84, 0xDE, 0x73, 0x37, 0x8B, 0xB9, 0x32,
-    0xBB, 0x08, 0x89, 0x56, 0xBD, 0x54, 0x5B, 0xEB, 0xA5, 0xAA, 0xD7, 0x2E, 0x6D, 0xE6, 0xF3, 0x68,
-    0x7B, 0xA1, 0x58, 0xE7, 0xBD, 0xD5, 0x6A, 0xEB, 0x65, 0xA6, 0x13, 0x2B, 0xA7, 0x7B, 0x6B, 0xE5,
-    0x67, 0xCB, 0x2C, 0xF7, 0x45, 0xE8, 0x8C, 0x1C, 0x43, 0x6F, 0xA4, 0x9E, 0x42, 0x69, 0xB8, 0xEB,
-    0x43, 0x61, 0xD0, 0x1F, 0x6C, 0x26, 0x0C, 0xB1, 0xB2, 0xA4, 0xF0, 0xA4, 0x03, 0x17, 0x91, 0x56,
-    0x33, 0xB3, 0xAC, 0x60, 0xB7, 0x06, 0x16, 0x12, 0x0D, 0x40, 0xE0, 0xC5, 0x60, 0x3D, 0x51, 0x81,
-    0x4D, 0xC3, 0x43, 0x91, 0x45, 0x87, 0x56, 0xAF, 0xB7, 0x3D, 0xAA, 0x5F, 0xE0, 0x1E, 0xEB, 0xF9,
-    0xEA, 0x91, 0x0F, 0xE1, 0x2F, 0x0B, 0x25, 0x09, 0xFC, 0xD8, 0xD5, 0xD5, 0xD6, 0x65, 0xD6, 0x1C,
-    0xDF, 0xA1, 0x63, 0xC7, 0xE4, 0x56, 0x9D, 0x4C, 0xC9, 0x76, 0xE5, 0xD2, 0x16, 0x8E, 0xE8, 0x53,
-    0x1B, 0xC5, 0x02, 0xE5, 0x3A, 0x83, 0x31, 0x9C, 0x5F, 0x9C, 0x78, 0x1B, 0xE1, 0xFE, 0x9D, 0x67,
-    0xD0, 0x80, 0x59, 0x6F, 0xDF, 0x6A, 0x8F, 0x51, 0x16, 0x00, 0x52, 0x69, 0xE5, 0x52, 0x5E, 0x0E,
-    0xED, 0xA8, 0x76, 0xD7, 0x6F, 0xAB, 0x09, 0x2D, 0x5F, 0x15, 0xF8, 0x99, 0xFC, 0xAF, 0x54, 0x0E,
-    0x52, 0x31, 0xCF, 0xEC, 0xD0, 0xEF, 0x55, 0x16, 0x74, 0x21, 0xEA, 0x4A, 0x3C, 0x81, 0x3B, 0xE2,
-    0x1C, 0x9A, 0x80, 0x37, 0x41, 0xA7, 0x83, 0x1D, 0x45, 0x66, 0xD7, 0x2A, 0x1D, 0x47, 0xF7, 0x27,
-    0xE4, 0x9B, 0x2C, 0xB0, 0xB4, 0x31, 0x17, 0x19, 0xD1, 0x51, 0xA4, 0xE4, 0x58, 0xF9, 0xC7, 0x90,
-    0x93, 0xD8, 0x4B, 0xDE, 0x02, 0xF9, 0xC0, 0x88, 0xCD, 0xD2, 0xC9, 0x1D, 0x75, 0xF5, 0xEA, 0xAF,
-    0x44, 0x8F, 0x0E, 0x44, 0x42, 0xE4, 0x16, 0x2A, 0x35, 0x8E, 0x2D, 0x66, 0x00, 0x75, 0x58, 0xBF,
-    0xC1, 0xBE, 0xB4, 0x5F, 0xDB, 0x89, 0xB4, 0xCA, 0xB5, 0x17, 0x46, 0x1D, 0xE4, 0xD3, 0xDF, 0xF6,
-    0x7B, 0x42, 0x56, 0x7C, 0x9F, 0x7E, 0xE4, 0xFF, 0xB3, 0xEB, 0xE5, 0x01, 0x53, 0x37, 0xE8, 0xB5,
-    0x1D, 0x45, 0x83, 0x47, 0xB9, 0xC3, 0x46, 0xC9, 0xB0, 0x2D, 0xBD, 0xD5, 0x47, 0x36, 0xD4, 0xE4,
-    0x45, 0xBB, 0x2F, 0x97, 0xAA, 0xC1, 0x83, 0x4B, 0x49, 0x69, 0x32, 0x3F, 0xD5, 0x7B, 0x03, 0x61,
-    0x50, 0x11, 0xBC, 0xF8, 0xB0, 0x5D, 0xE2, 0xFB, 0x42, 0x4B, 0xC5, 0xBB, 0x5C, 0xE1, 0x20, 0x5B,
-    0xBA, 0x6A, 0x42, 0x41, 0xF2, 0xD9, 0x1A, 0x32, 0xE6, 0xB0, 0x83, 0xCF, 0xAE, 0x51, 0x14, 0xE9,
-    0xB4, 0xDD, 0xFE, 0x0F, 0x7E, 0xB0, 0x9E, 0xBD, 0x3C, 0x1D, 0x2D, 0x96, 0x59, 0x6B, 0x5C, 0x0F,
-    0x0E, 0xDD, 0xD2, 0x49, 0x92, 0xAD, 0x3C, 0x09, 0x0D, 0xFF, 0x1C, 0x2B, 0x3C, 0xFB, 0x8E, 0xBF,
-    0xEF, 0x7E, 0x88, 0x14, 0x82, 0x42, 0xDC, 0x41, 0x6C, 0x5B, 0x88, 0xE5, 0x2D, 0x43, 0x26, 0xDD,
-    0x45, 0x7D, 0x40, 0xA3, 0x72, 0xB4, 0x9A, 0x50, 0x21, 0x08, 0x25, 0x82, 0x50, 0x66, 0xB7, 0x02,
-    0xD0, 0x49, 0x29, 0x8B, 0x3C, 0xB1, 0x1B, 0x6F, 0x56, 0x53, 0xA7, 0x9D, 0x0A, 0xE5, 0x8B, 0x23,
-    0x63, 0x1C, 0x39, 0xE3, 0x16, 0xD4, 0x43, 0xE3, 0x16, 0xE6, 0x18, 0x77, 0x42, 0x63, 0x80, 0xFC,
-    0x71, 0x64, 0x90, 0x23, 0x87, 0x64, 0xC0, 0x5A, 0x44, 0xBF, 0xAE, 0x94, 0x92, 0x3D, 0xCB, 0xEF,
-    0x3D, 0x02, 0xB1, 0xCE, 0xE2, 0xB1, 0x89, 0x81, 0x5D, 0xE8, 0x74, 0x3D, 0x79, 0xE4, 0x5D, 0x5C,
-    0xCA, 0x62, 0xD5, 0x16, 0x4A, 0x6C, 0xDC, 0x32, 0x76, 0xA5, 0x0F, 0xDD, 0x1B, 0xEF, 0xCB, 0x3A,
-    0x9D, 0x96, 0x83, 0xBA, 0x1F, 0x13, 0x4F, 0x82, 0x40, 0xC5, 0x7C, 0xCE, 0x9E, 0x91, 0xD5, 0x5A,
-    0xCA, 0x22, 0x7F, 0x47, 0xF2, 0xB7, 0x0B, 0x86, 0x4E, 0x38, 0xA2, 0xFC, 0x1D, 0xC0, 0xDF, 0x7D,
-    0x8E, 0x96, 0x1C, 0xF8, 0xDB, 0xD0, 0x9C, 0xE7, 0x0B, 0x97, 0xE7, 0x13, 0xFE, 0xB2, 0xD6, 0xD5,
-    0x02, 0xD3, 0xE0, 0x95, 0xCB, 0x6F, 0xC5, 0x5C, 0x46, 0x91, 0xEC, 0xA8, 0xFC, 0xED, 0x7A, 0xFA,
-    0x2D, 0x90, 0x30, 0x59, 0x8A, 0xAD, 0xDF, 0x85, 0x75, 0x68, 0xDF, 0xD3, 0x12, 0x7E, 0x4B, 0x34,
-    0xC6, 0x09, 0x7F, 0xC7, 0xA8, 0x5E, 0x67, 0x05, 0x3B, 0xAB, 0xD8, 0x85, 0x92, 0x9D, 0xD5, 0xEC,
-    0xAC, 0x68, 0x77, 0x52, 0xB5, 0x03, 0xC2, 0xA2, 0x67, 0xBB, 0x17, 0x71, 0x75, 0x41, 0xC4, 0x81,
-    0xE2, 0x10, 0x64, 0xD1, 0x0A, 0xB5, 0x29, 0xD5, 0x14, 0xA8, 0x39, 0x44, 0xDB, 0xB2, 0x1E, 0xC1,
-    0xDB, 0x7A, 0x00, 0x53, 0xDB, 0x1E, 0x8F, 0xEF, 0xFE, 0x8B, 0x2D, 0xF9, 0xCF, 0xF0, 0x1C, 0xFF,
-    0x94, 0x68, 0x1B, 0x98, 0xA6, 0x84, 0xEE, 0x2B, 0xA5, 0x69, 0xCC, 0xF8, 0x96, 0xCC, 0x7F, 0x8F,
-    0x01, 0xF3, 0x9B, 0xFA, 0x39, 0x59, 0x83, 0x3E, 0x20, 0x94, 0x37, 0x67, 0x94, 0x89, 0x0B, 0xE8,
-    0x05, 0xC8, 0x37, 0x5B, 0x9B, 0xD9, 0x86, 0x86, 0x21, 0xFE, 0xD6, 0x25, 0x57, 0x8A, 0x8A, 0x91,
-    0x44, 0xA3, 0x95, 0x9B, 0xB4, 0x3F, 0x45, 0x55, 0xF9, 0x8B, 0x79, 0xE9, 0x6D, 0xE4, 0x2C, 0x60,
-    0x47, 0x85, 0x3E, 0x22, 0xDC, 0x4E, 0x8A, 0xD6, 0x2F, 0x2B, 0x57, 0x8F, 0x76, 0x15, 0x5A, 0xD5,
-    0xB0, 0x6E, 0x6D, 0x9F, 0x41, 0x22, 0xF5, 0xF9, 0xE2, 0x40, 0x90, 0x3E, 0x78, 0x05, 0x30, 0xFE,
-    0x18, 0xF8, 0x83, 0x7F, 0x41, 0xE7, 0xE0, 0x11, 0x4B, 0x35, 0x43, 0xB8, 0x6E, 0x02, 0x24, 0x0A,
-    0x50, 0x8E, 0xA7, 0x80, 0x1A, 0xA0, 0xC1, 0x76, 0xD4, 0xF5, 0x97, 0x13, 0xD3, 0x96, 0x84, 0xAD,
-    0x1D, 0x76, 0x7A, 0x3A, 0x46, 0xEC, 0xD3, 0x2B, 0x52, 0x4C, 0xA6, 0x1D, 0xB0, 0xF0, 0xA4, 0x60,
-    0xC4, 0x5E, 0x1E, 0xA2, 0xA2, 0x8F, 0xAB, 0xFF, 0xDB, 0xFA, 0xA2, 0x4D, 0x64, 0x38, 0x52, 0x7F,
-    0x12, 0x0A, 0x68, 0x6D, 0x39, 0x37, 0x08, 0x0F, 0x13, 0x0E, 0xD4, 0x95, 0x51, 0x56, 0x46, 0x55,
-    0x19, 0x45, 0x65, 0xE8, 0x19, 0x4A, 0xCA, 0xA8, 0x28, 0xA3, 0xA0, 0x8C, 0x7A, 0x32, 0xCA, 0xC9,
-    0x70, 0x56, 0x28, 0x26, 0xA3, 0x96, 0x0C, 0x6F, 0x8B, 0x4A, 0x72, 0x66, 0xC6, 0x4C, 0xD1, 0x0E,
-    0x43, 0xC8, 0x58, 0x21, 0xB3, 0xC7, 0xB0, 0xF4, 0x6C, 0xFE, 0xAE, 0xA3, 0x85, 0x23, 0x24, 0xAF,
-    0x5D, 0x53, 0x8F, 0xB3, 0x25, 0x7E, 0x3D, 0xB8, 0xD0, 0x52, 0xD1, 0x61, 0xC7, 0xFF, 0x35, 0x7F,
-    0xE4, 0x63, 0x14, 0x96, 0x28, 0xAD, 0x0C, 0x2B, 0x49, 0xE3, 0xD7, 0x87, 0xF8, 0xFF, 0x86, 0x73,
-    0xF9, 0x4A, 0xDB, 0x6D, 0x92, 0x79, 0x68, 0x52, 0xCE, 0x02, 0x55, 0x61, 0xC0, 0x0D, 0x7C, 0x90,
-    0xBE, 0x6F, 0x65, 0x36, 0xCD, 0x7A, 0x8E, 0x6B, 0xB1, 0x5C, 0x0F, 0x01, 0x8B, 0x6B, 0xD5, 0xBE,
-    0x6E, 0x74, 0x01, 0xB3, 0x48, 0x72, 0x51, 0xEB, 0x7D, 0xBF, 0xFC, 0x39, 0xF3, 0x04, 0x2D, 0xA9,
-    0xA8, 0xE4, 0x01, 0x72, 0x3C, 0xAD, 0x2E, 0x95, 0x08, 0x88, 0x22, 0x9A, 0x0B, 0xCB, 0xFF, 0x94,
-    0x5D, 0xF8, 0xCB, 0x8D, 0x67, 0xD8, 0xD6, 0x9B, 0xFB, 0xAA, 0x43, 0xC8, 0x70, 0x08, 0x25, 0x45,
-    0x97, 0x7C, 0x48, 0x0B, 0xDA, 0xC0, 0x82, 0xFE, 0x8C, 0xBD, 0x1B, 0x60, 0x54, 0x2D, 0xD5, 0xBE,
-    0x66, 0x41, 0x45, 0xA0, 0x85, 0x5B, 0x25, 0x64, 0x03, 0xE8, 0x30, 0x08, 0xF0, 0x6E, 0x09, 0x53,
-    0xB9, 0x2A, 0x3F, 0x44, 0xFB, 0x72, 0xD7, 0xF7, 0xC5, 0x48, 0xFD, 0x12, 0xD7, 0x79, 0xD1, 0x15,
-    0xD3, 0x9F, 0x94, 0x94, 0xEC, 0xC6, 0xC8, 0x08, 0x9F, 0x1A, 0xE4, 0x80, 0xB9, 0x52, 0x16, 0x7D,
-    0x80, 0x15, 0x76, 0x9F, 0xAA, 0x7B, 0xEB, 0xE0, 0x67, 0xBA, 0xE0, 0x1F, 0x0F, 0x6B, 0xE4, 0xE3,
-    0x42, 0x0C, 0x70, 0x29, 0x49, 0x30, 0x9C, 0xAB, 0xFF, 0x3E, 0x50, 0x71, 0xD6, 0x2D, 0xED, 0x21,
-    0xE6, 0xBB, 0xD3, 0x6E, 0xA9, 0xCD, 0x4F, 0x48, 0x3B, 0x3D, 0xB7, 0x9C, 0xE1, 0xB9, 0xCE, 0x69,
-    0xDC, 0x3F, 0xDD, 0x2F, 0x6E, 0xFC, 0xB4, 0x73, 0xBA, 0x5D, 0x3A, 0xF4, 0xF9, 0x57, 0x71, 0x45,
-    0xD3, 0x42, 0x91, 0x8F, 0x98, 0x83, 0xD0, 0xD7, 0xD2, 0xD5, 0xFA, 0x08, 0x84, 0x16, 0xE3, 0x70,
-    0x63, 0x18, 0x6E, 0x8C, 0xC2, 0x8D, 0x41, 0xB8, 0x31, 0x06, 0x37, 0x86, 0xE0, 0xC6, 0x08, 0xDC,
-    0x18, 0x80, 0x1B, 0xE3, 0x6F, 0x63, 0xF8, 0x6D, 0x8C, 0xBE, 0x8D, 0xC1, 0xB7, 0x31, 0xF6, 0x36,
-    0x82, 0xDE, 0xC6, 0xC8, 0xDB, 0x18, 0x78, 0x1B, 0xE3, 0x6E, 0x63, 0xD8, 0x6D, 0x8C, 0xBA, 0x8D,
-    0x41, 0xB7, 0x31, 0xE6, 0x36, 0x86, 0xDC, 0xC6, 0x88, 0xDB, 0x18, 0x70, 0x1B, 0xE3, 0x6D, 0x63,
-    0xB8, 0xED, 0x09, 0xDA, 0x96, 0x34, 0x0C, 0xF0, 0x20, 0x83, 0x88, 0xAF, 0xB0, 0xF1, 0x05, 0x51,
-    0x1B, 0x12, 0xD4, 0x29, 0x40, 0xF1, 0x16, 0x7C, 0x4A, 0x04, 0xA7, 0x8D, 0xD0, 0xB4, 0x11, 0x98,
-    0x36, 0xC2, 0xD2, 0x46, 0x50, 0xDA, 0x08, 0x49, 0x1B, 0x01, 0x69, 0x57, 0x1C, 0x6D, 0x04, 0xA3,
-    0x8D, 0x50, 0xB4, 0x11, 0x88, 0x36, 0xC2, 0xD0, 0x46, 0x10, 0xDA, 0x08, 0x41, 0x1B, 0x01, 0x68,
-    0x23, 0xFC, 0x6C, 0x04, 0x9F, 0x8D, 0xD0, 0xB3, 0x11, 0x78, 0x36, 0xC2, 0xCE, 0x5E, 0x83, 0xCE,
-    0xDA, 0x01, 0x87, 0x13, 0x4B, 0xB9, 0x62, 0x7B, 0x56, 0x90, 0x4E, 0x84, 0xEC, 0xD9, 0x9F, 0x96,
-    0x43, 0x23, 0xF0, 0xCA, 0x8A, 0x98, 0x5D, 0x01, 0xB3, 0x2B, 0x5E, 0x76, 0x81, 0xCB, 0xAE, 0x68,
-    0xD9, 0x15, 0x2C, 0xBB, 0x62, 0x65, 0x57, 0xA8, 0xEC, 0x8A, 0x94, 0x5D, 0x81, 0xB2, 0x2B, 0x4E,
-    0x76, 0x85, 0xC9, 0xAE, 0x28, 0xD9, 0x15, 0x24, 0xBB, 0x62, 0x64, 0x57, 0x88, 0xEC, 0x8A, 0x90,
-    0x5D, 0x01, 0xB2, 0x2B, 0x3E, 0x76, 0x85, 0xC7, 0x46, 0xE8, 0xD8, 0x13, 0x18, 0xFE, 0x3B, 0x0F,
-    0x9F, 0x33, 0x81, 0x90, 0x1B, 0xDA, 0x91, 0xFD, 0x35, 0xD8, 0xFE, 0xEF, 0x21, 0x11, 0x5E, 0x12,
-    0xAD, 0xD3, 0x44, 0x58, 0xB3, 0x2C, 0x26, 0x59, 0xCC, 0xB1, 0x98, 0x62, 0x31, 0xC3, 0x62, 0x82,
-    0xC5, 0xFC, 0x8A, 0xE9, 0xD5, 0x97, 0x25, 0xC2, 0xEE, 0xD6, 0x55, 0x73, 0xCD, 0xCA, 0x77, 0xEC,
-    0xF6, 0x6C, 0x97, 0xD2, 0x54, 0x7C, 0xC4, 0xE4, 0x1B, 0x98, 0x58, 0x69, 0xB6, 0xD0, 0xF6, 0xC1,
-    0x4C, 0xDB, 0x29, 0x92, 0x39, 0x88, 0x37, 0x66, 0x7B, 0xF3, 0x11, 0x26, 0xD4, 0x65, 0x38, 0xB4,
-    0x62, 0x1D, 0x09, 0xF5, 0x9F, 0xE8, 0x2C, 0x00, 0x40, 0x56, 0xA3, 0xAB, 0x90, 0x51, 0xF4, 0x50,
-    0x0D, 0x94, 0xF5, 0xFD, 0xF6, 0xE2, 0x3B, 0x84, 0x0F, 0xB2, 0x4E, 0x52, 0xD8, 0x8C, 0x68, 0x47,
-    0x9B, 0x1D, 0x59, 0xF3, 0x9A, 0x78, 0xFF, 0x9F, 0x5F, 0xB4, 0x53, 0x68, 0x7C, 0xB0, 0xCE, 0x6F,
-    0x37, 0xC7, 0xAC, 0xB1, 0xAA, 0xDD, 0x86, 0xAD, 0x0F, 0x33, 0xD0, 0x2C, 0xFD, 0xF3, 0xDC, 0x4D,
-    0xCA, 0x6C, 0xCF, 0x75, 0xC7, 0x3B, 0x6C, 0xA4, 0xB0, 0xC2, 0xE3, 0x0C, 0xEA, 0xCC, 0x94, 0x4B,
-    0x69, 0x39, 0xD2, 0xD9, 0x25, 0x2B, 0x56, 0xF2, 0xEC, 0xDE, 0x49, 0x5F, 0x03, 0x68, 0xBC, 0xD4,
-    0x23, 0x12, 0xCA, 0x3C, 0xEA, 0x53, 0x99, 0xF0, 0x13, 0x66, 0x68, 0x7E, 0x84, 0x92, 0xE7, 0x21,
-    0xC3, 0xB1, 0xA7, 0xDD, 0x62, 0xF9, 0xF7, 0x81, 0x70, 0xA0, 0x1A, 0x3C, 0x4E, 0xD4, 0xC8, 0x59,
-    0x37, 0x93, 0x73, 0x27, 0xD6, 0xC1, 0x41, 0xD2, 0xD5, 0xC3, 0x15, 0x6A, 0xE7, 0x42, 0xD1, 0x41,
-    0xFB, 0x9C, 0xE8, 0xEF, 0x16, 0xE9, 0xD7, 0x8F, 0xD8, 0x2A, 0x7F, 0x6A, 0x09, 0x18, 0xF1, 0xCC,
-    0xE6, 0xD6, 0xC0, 0x2F, 0x83, 0x79, 0xF2, 0x68, 0x88, 0xF9, 0xDA, 0x00, 0xA3, 0xB6, 0x3A, 0xA1,
-    0x65, 0x5E, 0x56, 0x21, 0x34, 0x1C, 0x50, 0x74, 0x86, 0x2B, 0x06, 0x2D, 0xBA, 0x37, 0x1E, 0x9A,
-    0x53, 0x98, 0x5D, 0xDC, 0x02, 0x5B, 0xC3, 0xDE, 0xA5, 0xE4, 0xB9, 0xBB, 0x86, 0x56, 0x74, 0x2B,
-    0xC6, 0x37, 0x20, 0x49, 0x03, 0x76, 0x74, 0x19, 0x03, 0x80, 0x34, 0xA0, 0x47, 0x0D, 0x3A, 0x1A,
-    0x70, 0xA3, 0x01, 0x34, 0x1A, 0x10, 0xA3, 0x01, 0x2E, 0x1A, 0xB0, 0xA2, 0x01, 0x28, 0x1A, 0x50,
-    0xA2, 0x01, 0xB9, 0x1B, 0x60, 0xBB, 0x01, 0xB3, 0x6B, 0xC8, 0xD0, 0x00, 0x0B, 0x0D, 0x98, 0xD0,
-    0x00, 0x08, 0x0D, 0x68, 0xD0, 0x00, 0x05, 0x0D, 0x38, 0xD0, 0x00, 0x02, 0x0D, 0x08, 0xD0, 0x00,
-    0xFF, 0x54, 0xC7, 0xF0, 0x70, 0x8D, 0x9A, 0xF2, 0x39, 0x6A, 0x0A, 0x5A, 0x4D, 0x74, 0x77, 0x4A,
-    0x0A, 0x02, 0x30, 0x81, 0xBE, 0x24, 0xF4, 0x92, 0xB8, 0x4B, 0x82, 0x2E, 0x89, 0xB8, 0x24, 0xDC,
-    0x92, 0x58, 0x4B, 0x02, 0x2D, 0x33, 0xBB, 0x6E, 0xA9, 0x43, 0x4B, 0x3F, 0xCC, 0x50, 0xDA, 0x80,
-    0x55, 0x5A, 0x57, 0x0C, 0x8A, 0x72, 0xD2, 0x0F, 0x1B, 0x81, 0x30, 0x1A, 0x16, 0x6F, 0x45, 0xA4,
-    0x68, 0x4A, 0x4D, 0xCE, 0x0D, 0xB3, 0x7B, 0x38, 0x11, 0x73, 0xC3, 0xA5, 0x53, 0xFF, 0x7F, 0x8D,
-    0xF7, 0x97, 0xDB, 0x29, 0x1A, 0x8A, 0x1F, 0x8D, 0x6E, 0x89, 0x9C, 0x5D, 0x19, 0x2A, 0xD7, 0x07,
-    0xD6, 0x5F, 0x0E, 0x71, 0xD3, 0xE1, 0x01, 0xDD, 0x40, 0x05, 0x13, 0x3E, 0x63, 0x28, 0xA7, 0x92,
-    0x67, 0xBE, 0x4A, 0xE2, 0xDA, 0xE0, 0x18, 0xC4, 0xB5, 0x41, 0xF5, 0x76, 0xCF, 0x77, 0x1B, 0x8A,
-    0xF5, 0xD8, 0xD0, 0xDA, 0x74, 0xE8, 0x3C, 0x0F, 0x4D, 0x2E, 0xDD, 0x86, 0xFC, 0x45, 0xDD, 0x86,
-    0x4D, 0xDC, 0x6D, 0x38, 0x09, 0xD3, 0x87, 0x75, 0xA7, 0xB4, 0xEE, 0x1F, 0x30, 0xA3, 0x5B, 0x0F,
-    0x0C, 0x1E, 0x0B, 0xE5, 0xDD, 0x94, 0xE3, 0x8A, 0x79, 0xC7, 0x1E, 0x2E, 0xC3, 0xD9, 0xF1, 0x46,
-    0x21, 0x24, 0x23, 0xC7, 0x7B, 0xA2, 0xB6, 0x0B, 0x5E, 0x76, 0xD1, 0x57, 0x08, 0x77, 0xE8, 0x32,
-    0x2D, 0x7C, 0x3F, 0x7F, 0xBE, 0x05, 0xF5, 0xC7, 0x9E, 0x44, 0xD4, 0x93, 0x70, 0xE9, 0xD5, 0xD6,
-    0x45, 0xC9, 0xFE, 0x02, 0xC8, 0x0F, 0x78, 0x6B, 0xA3, 0x73, 0x3A, 0xBF, 0xE8, 0x80, 0xE5, 0x37,
-    0xB0, 0x47, 0xF1, 0xC6, 0x55, 0xEC, 0x22, 0x68, 0x3C, 0x92, 0x17, 0xE1, 0x99, 0x16, 0xDB, 0x76,
-    0x1B, 0xC1, 0xDC, 0x5C, 0xEE, 0xD8, 0x11, 0xDC, 0x93, 0x47, 0x0D, 0xB4, 0xD8, 0xDB, 0xB9, 0x62,
-    0xF9, 0x97, 0x3E, 0x5E, 0x6D, 0x9C, 0xAC, 0x66, 0x87, 0x96, 0xBC, 0x1A, 0x37, 0x3D, 0x5D, 0xBA,
-    0xD3, 0xC3, 0xA4, 0x47, 0x8D, 0x3C, 0x5D, 0xF9, 0x1B, 0x19, 0x24, 0x06, 0xFF, 0xA9, 0xDF, 0x09,
-    0x9D, 0xFD, 0x9B, 0x32, 0x4C, 0xE9, 0x2C, 0xB2, 0x5C, 0x4D, 0x5A, 0xF4, 0x95, 0xA1, 0x94, 0xE8,
-    0x4E, 0x28, 0x55, 0xEF, 0x37, 0x7A, 0x64, 0x09, 0x50, 0xFE, 0x6A, 0x46, 0xD0, 0xA4, 0x9E, 0x43,
-    0x4B, 0x26, 0xF4, 0x9E, 0x85, 0xDF, 0xA7, 0xE0, 0xFC, 0x93, 0x07, 0xC8, 0x1B, 0xC0, 0xE3, 0x9C,
-    0x26, 0xA4, 0xB4, 0x03, 0x83, 0xFF, 0xE6, 0x15, 0x0D, 0x9E, 0x6F, 0xCF, 0x1B, 0x74, 0xD7, 0xD7,
-    0x0A, 0xEA, 0x16, 0x42, 0xDD, 0x2C, 0xDC, 0x26, 0xAF, 0x2D, 0xCB, 0xBD, 0xCE, 0xE5, 0x3B, 0xCF,
-    0xFE, 0x82, 0x62, 0xC9, 0xF2, 0x52, 0xC8, 0x1D, 0x24, 0xF4, 0x03, 0x81, 0x2B, 0x1C, 0xFD, 0xE8,
-    0xD4, 0x20, 0x24, 0x38, 0x7A, 0xA0, 0xF5, 0x8E, 0xE2, 0x58, 0x7C, 0xA6, 0x36, 0x5C, 0x96, 0x20,
-    0x5A, 0xD9, 0x7D, 0x5F, 0x8D, 0x96, 0x16, 0x4D, 0x4B, 0x3F, 0xA9, 0x55, 0xF7, 0xBD, 0x1E, 0xBF,
-    0x11, 0x7E, 0xEB, 0xF5, 0x5D, 0xF5, 0x90, 0xD0, 0xC3, 0x4D, 0x84, 0x0C, 0xAD, 0x9F, 0xAA, 0x62,
-    0x96, 0x0D, 0x30, 0x15, 0xCB, 0x61, 0x6C, 0xAC, 0xBC, 0x1A, 0x10, 0x9F, 0x16, 0x86, 0xE4, 0x9D,
-    0x50, 0xC9, 0x4A, 0x66, 0x82, 0x30, 0xDA, 0x84, 0x68, 0x2B, 0xF7, 0xFA, 0x2B, 0xD1, 0x4B, 0x4E,
-    0xAF, 0x6E, 0x3F, 0xD4, 0xFB, 0xFF, 0x3D, 0x4E, 0x86, 0xB2, 0xED, 0xB1, 0xC7, 0x41, 0xD0, 0x83,
-    0xE2, 0xAD, 0x36, 0xBD, 0x4A, 0xA5, 0xBB, 0x97, 0x34, 0x37, 0xCC, 0x66, 0x03, 0x48, 0xCC, 0x50,
-    0x63, 0xA9, 0xA4, 0x12, 0x2D, 0x2E, 0xEB, 0x87, 0x57, 0x6E, 0x09, 0x27, 0x7A, 0xDD, 0x25, 0xCD,
-    0xAB, 0xD1, 0xF4, 0xBF, 0x85, 0xA3, 0x17, 0xB5, 0x95, 0x77, 0xF0, 0x57, 0x84, 0xB2, 0x93, 0x16,
-    0x27, 0xF3, 0xDE, 0xC9, 0x4D, 0x65, 0xAB, 0xAF, 0xDF, 0x24, 0x46, 0x51, 0xA1, 0xAA, 0x51, 0xF5,
-    0x89, 0xEA, 0x44, 0x6D, 0x32, 0x65, 0xA2, 0x2E, 0x45, 0xAA, 0xB4, 0x81, 0xF9, 0xCB, 0x71, 0x5D,
-    0x0B, 0x52, 0xBB, 0xE0, 0x61, 0xA6, 0x17, 0x57, 0xD8, 0xE8, 0x0A, 0x59, 0xDF, 0x62, 0x61, 0x9A,
-    0xEE, 0xCF, 0x1B, 0x48, 0x08, 0x49, 0xEC, 0xCF, 0x51, 0x55, 0xFE, 0x0A, 0x67, 0x13, 0xF8, 0x28,
-    0x5C, 0xE9, 0xC4, 0x96, 0xDA, 0x86, 0x9E, 0x01, 0xB9, 0x92, 0x68, 0x1E, 0x58, 0x99, 0xC4, 0xBF,
-    0xA5, 0xC1, 0xD4, 0xF7, 0xD4, 0x5E, 0xED, 0x3A, 0xC5, 0xAE, 0xD5, 0x5B, 0xA1, 0xFF, 0x59, 0xD8,
-    0xCA, 0xDF, 0x3C, 0xC3, 0x76, 0x50, 0xF6, 0x84, 0xBF, 0x1A, 0x53, 0x3F, 0xD4, 0xDA, 0x1E, 0x2B,
-    0x27, 0x50, 0x5C, 0x7B, 0xBA, 0xA3, 0xF6, 0x75, 0x06, 0xBD, 0xF5, 0xA1, 0xC6, 0xC1, 0x48, 0x4B,
-    0xE0, 0x1B, 0x26, 0x13, 0xE1, 0xA4, 0x3F, 0x32, 0xF6, 0x92, 0x67, 0x25, 0x0B, 0x32, 0xD1, 0x23,
-    0x1D, 0x7D, 0xBC, 0x58, 0x52, 0xE8, 0x03, 0xD5, 0xA1, 0x80, 0x2F, 0xE7, 0x71, 0x89, 0x76, 0xAB,
-    0x85, 0xF7, 0xCE, 0x15, 0xFB, 0x13, 0x4D, 0xB8, 0xF1, 0x74, 0x16, 0xA7, 0xF8, 0xCC, 0x5A, 0x92,
-    0x99, 0x55, 0xC9, 0x47, 0xC5, 0xAD, 0x4B, 0x16, 0xBF, 0x4B, 0x27, 0x11, 0x99, 0x05, 0xC5, 0xF2,
-    0x75, 0xD2, 0x39, 0xBD, 0xFA, 0xAB, 0x0F, 0x65, 0xA3, 0x5A, 0x18, 0x86, 0xA9, 0x84, 0xA5, 0x04,
-    0x9C, 0x8C, 0x76, 0x72, 0x31, 0x93, 0x38, 0x46, 0x93, 0x5B, 0x49, 0xBF, 0x67, 0xC3, 0x87, 0xB5,
-    0xBF, 0xE8, 0x30, 0xCA, 0x21, 0x3E, 0x8C, 0x92, 0x5E, 0x3F, 0x8C, 0xD2, 0xB8, 0xF5, 0x0C, 0xF2,
-    0x97, 0x1C, 0x46, 0x61, 0xDD, 0x8E, 0x74, 0xDC, 0x93, 0xF1, 0xB8, 0xBC, 0xF3, 0x4F, 0x57, 0x5B,
-    0xED, 0x43, 0x94, 0x43, 0xBB, 0x57, 0x54, 0x68, 0x3A, 0xA9, 0x95, 0xC8, 0x46, 0x91, 0x84, 0x80,
-    0x99, 0xE3, 0x89, 0xE7, 0x70, 0x22, 0x3B, 0x1C, 0x73, 0x0E, 0xA7, 0xAF, 0x2B, 0x3B, 0x73, 0x6D,
-    0x5F, 0x1B, 0xB2, 0x9C, 0xAF, 0xB6, 0x53, 0xD5, 0x89, 0x9D, 0xA5, 0xE6, 0x51, 0xEA, 0xAD, 0xB1,
-    0x3A, 0x55, 0x33, 0x85, 0xA6, 0xB9, 0x1A, 0x29, 0x20, 0xD3, 0xB3, 0x63, 0x32, 0x0B, 0x89, 0xDC,
-    0xC7, 0x91, 0x81, 0xBA, 0x19, 0x24, 0x12, 0xA3, 0x8A, 0xF3, 0x5B, 0x29, 0x82, 0x49, 0x3F, 0xE5,
-    0xC3, 0x66, 0x2A, 0xF6, 0xC9, 0x64, 0xF0, 0x64, 0xB6, 0xC1, 0x35, 0x7A, 0x09, 0x67, 0xCC, 0x6D,
-    0xFB, 0xC9, 0xC9, 0xF6, 0x79, 0x80, 0x1C, 0xE7, 0x23, 0x23, 0x2A, 0x16, 0x31, 0x15, 0xA7, 0xE8,
-    0xE0, 0xFA, 0xED, 0x87, 0x28, 0x8A, 0xE6, 0x47, 0xC2, 0x2B, 0xE6, 0x82, 0x2D, 0x3F, 0xC2, 0xB8,
-    0xDB, 0x77, 0x11, 0x08, 0x57, 0x6A, 0x53, 0xD4, 0xA0, 0x9F, 0xBF, 0x52, 0x27, 0x86, 0x6E, 0x69,
-    0xB8, 0x41, 0xAC, 0xA1, 0xFF, 0x3B, 0x25, 0xFD, 0x27, 0x1A, 0xE0, 0x2A, 0x8A, 0x3B, 0xEF, 0xAB,
-    0x9D, 0x4B, 0xEE, 0x2D, 0x41, 0xF1, 0xD7, 0xD5, 0xE7, 0xB3, 0xCA, 0xE3, 0x9D, 0x67, 0x6E, 0x05,
-    0xA0, 0x6F, 0x96, 0x3E, 0x2D, 0xB2, 0xEE, 0x43, 0x8E, 0x83, 0x42, 0xDB, 0x6C, 0x80, 0xB7, 0x8A,
-    0x6B, 0x95, 0xAF, 0xC0, 0x19, 0x2E, 0xA8, 0x00, 0xBE, 0xE0, 0x26, 0xB1, 0xA6, 0xEB, 0x24, 0x39,
-    0x7A, 0x36, 0x69, 0xF8, 0x34, 0xB9, 0x45, 0x11, 0xBE, 0x66, 0x8E, 0x50, 0x47, 0xA8, 0x22, 0xD4,
-    0x10, 0x53, 0x90, 0xF6, 0xCD, 0x79, 0x51, 0x8F, 0xB3, 0x55, 0x3B, 0x36, 0x6A, 0xCC, 0x0D, 0x44,
-    0x51, 0x2C, 0xB9, 0x84, 0x56, 0x90, 0x1F, 0x59, 0xE3, 0xAA, 0xB7, 0x13, 0xB3, 0x35, 0xCF, 0x8F,
-    0x8D, 0x6B, 0x58, 0xA3, 0xE5, 0x72, 0x71, 0x1D, 0xBD, 0x06, 0x87, 0x9A, 0x50, 0xEE, 0x18, 0x29,
-    0x25, 0xA0, 0x5A, 0x0A, 0xC7, 0x98, 0x09, 0x33, 0xF5, 0xFA, 0x2E, 0x72, 0xA1, 0x06, 0xB9, 0x44,
-    0x68, 0xCC, 0xB0, 0x69, 0xC3, 0xE3, 0xFE, 0xAC, 0x3B, 0x7B, 0x83, 0xA2, 0xE0, 0x30, 0xEF, 0x96,
-    0x80, 0x71, 0x6C, 0x08, 0xFB, 0x31, 0xF1, 0xD7, 0x6E, 0x32, 0x94, 0xBD, 0xD4, 0x53, 0x2B, 0x6B,
-    0xE4, 0x70, 0xDE, 0x88, 0x22, 0xD4, 0x3F, 0xD3, 0x64, 0xF7, 0x17, 0xDA, 0xB2, 0x7C, 0x8A, 0x93,
-    0xC5, 0x08, 0xDF, 0x7E, 0xC0, 0xC6, 0x6E, 0xC2, 0xEF, 0x68, 0xD8, 0xBB, 0xF5, 0x0B, 0x2C, 0xFE,
-    0x4F, 0x07, 0x17, 0xDD, 0x9D, 0x71, 0x91, 0x79, 0x8A, 0x3C, 0x25, 0x9E, 0x02, 0x4F, 0x79, 0x3F,
-    0x5F, 0xC5, 0xFD, 0xC6, 0x93, 0xD8, 0xB4, 0x98, 0x55, 0x65, 0xD4, 0x2A, 0x74, 0x5D, 0xBA, 0x99,
-    0x6A, 0x27, 0x7B, 0x59, 0x83, 0x86, 0xAF, 0x8D, 0xC4, 0x21, 0xA1, 0x1C, 0xFF, 0x97, 0x09, 0xE5,
-    0x2B, 0x70, 0xD6, 0xF0, 0xF6, 0x87, 0x77, 0x3F, 0x10, 0x9A, 0xCD, 0xE5, 0x02, 0x31, 0x77, 0xFE,
-    0x5B, 0x47, 0x14, 0x76, 0xF1, 0xD5, 0x20, 0x7B, 0xC5, 0x64, 0x47, 0xF1, 0xF2, 0x0D, 0x39, 0x87,
-    0xF6, 0xA2, 0xBC, 0xB2, 0xB6, 0xBC, 0x72, 0x07, 0x10, 0x4B, 0xF7, 0x82, 0xBC, 0xF2, 0x55, 0x38,
-    0x1B, 0x6A, 0x2E, 0xD0, 0x53, 0xDE, 0x89, 0xB5, 0xC3, 0x37, 0x45, 0x69, 0xD4, 0xAD, 0x61, 0xF7,
-    0xE8, 0xE2, 0xB8, 0xFB, 0xA6, 0x9C, 0x1B, 0x64, 0xD5, 0xF2, 0xC0, 0x0A, 0x92, 0x3B, 0xA9, 0x20,
-    0xB5, 0xFE, 0x23, 0x35, 0xB4, 0xA3, 0xFB, 0xB3, 0x6B, 0x98, 0x8B, 0xC3, 0x5A, 0xE9, 0xE5, 0x51,
-    0x33, 0xD6, 0xAD, 0x03, 0xD2, 0x73, 0x5A, 0x0F, 0x6E, 0xF3, 0x1F, 0x85, 0xE5, 0x33, 0xBB, 0xA5,
-    0xFE, 0x9F, 0x2C, 0xB8, 0x8D, 0xBF, 0x25, 0x2B, 0xDE, 0x7B, 0xA0, 0x9C, 0xB0, 0x74, 0xC1, 0xB2,
-    0xFD, 0x3E, 0x1C, 0x75, 0x76, 0xE7, 0xCD, 0xF5, 0x6F, 0xFC, 0x33, 0x3C, 0xC8, 0x6E, 0x69, 0x78,
-    0xB0, 0xFE, 0x49, 0xEC, 0x94, 0x99, 0xDC, 0xB4, 0x7B, 0xDF, 0x70, 0xF0, 0x1E, 0xB5, 0x3E, 0x7C,
-    0xCD, 0xC4, 0xBE, 0x55, 0x6E, 0x9F, 0xD1, 0x1A, 0x6D, 0xC8, 0x4E, 0xA8, 0x18, 0x9B, 0xC1, 0x07,
-    0x76, 0x84, 0xE4, 0x75, 0x08, 0x7B, 0xF1, 0x1D, 0x86, 0xCA, 0x84, 0x7F, 0xD6, 0x97, 0x28, 0x11,
-    0x77, 0xC0, 0xD4, 0x32, 0x69, 0x3A, 0x9E, 0x60, 0x92, 0xD4, 0x5C, 0xD9, 0xB9, 0xF8, 0xD0, 0x9B,
-    0x45, 0xBD, 0x1E, 0x16, 0xEB, 0xAC, 0x09, 0xB5, 0xE2, 0x86, 0x57, 0x94, 0x43, 0x59, 0x33, 0x46,
-    0xDE, 0x36, 0xAF, 0x20, 0x96, 0xDD, 0x35, 0x10, 0xCB, 0xCB, 0xBE, 0x04, 0xE0, 0xA5, 0xA8, 0x99,
-    0x38, 0xE3, 0x7C, 0x19, 0x6A, 0x66, 0xEF, 0x5E, 0xF4, 0xC0, 0xF8, 0x27, 0xBD, 0x8A, 0x1E, 0x7E,
-    0x5C, 0x8B, 0xAF, 0x3C, 0x56, 0x55, 0xC7, 0xDF, 0x84, 0x97, 0x8D, 0x3C, 0x67, 0xA5, 0xC0, 0x2F,
-    0xED, 0xB6, 0xB4, 0xBF, 0xBD, 0xAF, 0xC7, 0x92, 0x34, 0x55, 0x94, 0xDF, 0xE1, 0xCF, 0xFD, 0xA7,
-    0xEF, 0xA7, 0x51, 0xA2, 0x13, 0x72, 0xA6, 0xFC, 0x65, 0xD1, 0xFE, 0xF1, 0x35, 0xF4, 0xE0, 0x2A,
-    0x7C, 0x33, 0x8D, 0x46, 0x80, 0xD3, 0xF2, 0x28, 0x5D, 0x15, 0x3E, 0x7F, 0xE4, 0x7A, 0x00, 0x18,
-    0xDB, 0x5D, 0xEB, 0x25, 0x24, 0x1D, 0xF6, 0xF7, 0x20, 0x1C, 0xED, 0xF5, 0x7E, 0x29, 0xD9, 0x67,
-    0x5A, 0x94, 0x95, 0x68, 0x79, 0xA0, 0x34, 0x36, 0x01, 0x33, 0xB1, 0x94, 0x99, 0x23, 0x78, 0x75,
-    0xC2, 0x43, 0xDD, 0x0F, 0xD8, 0x19, 0xA0, 0x25, 0x63, 0xEF, 0x9A, 0x5F, 0x27, 0x26, 0xC3, 0x63,
-    0xE0, 0x86, 0xDE, 0x0E, 0xCD, 0x4D, 0xEB, 0x45, 0x9C, 0x0E, 0xE5, 0x09, 0x3A, 0xBB, 0xB3, 0x56,
-    0x98, 0xB5, 0xBC, 0xF7, 0x6C, 0x5F, 0x6D, 0x11, 0x10, 0x1F, 0x09, 0x4D, 0x18, 0x70, 0xB5, 0x4A,
-    0xC4, 0xB8, 0x1E, 0xE8, 0xA8, 0xF9, 0xEE, 0xF6, 0xF1, 0xE9, 0x17, 0xE7, 0xE0, 0x0B, 0x75, 0x78,
-    0x8C, 0x79, 0x03, 0x57, 0x9C, 0xD9, 0x4E, 0x1F, 0x69, 0x3D, 0xFC, 0xF2, 0x54, 0x73, 0x57, 0xBE,
-    0xE7, 0xEB, 0xB9, 0xF5, 0x07, 0xFA, 0xC8, 0xC4, 0x33, 0x5D, 0xE4, 0x5C, 0x1B, 0x8D, 0xC9, 0x65,
-    0x11, 0xB5, 0x18, 0xE3, 0x6B, 0x11, 0x89, 0x9E, 0xA1, 0xEC, 0x40, 0x0E, 0x04, 0x12, 0x4A, 0xED,
-    0x3B, 0xB8, 0x4D, 0x6D, 0x9B, 0xD0, 0x05, 0xB7, 0x30, 0x91, 0x3F, 0x5C, 0x3B, 0x5F, 0xFA, 0x6D,
-    0x7B, 0xFC, 0x46, 0x10, 0x79, 0x1C, 0x05, 0xCC, 0xBE, 0x8F, 0xCF, 0xF6, 0xC9, 0x6F, 0xD8, 0x38,
-    0x01, 0x8D, 0xE1, 0x3B, 0x48, 0xCD, 0xEA, 0xF7, 0x27, 0x56, 0xDF, 0xCC, 0xFD, 0xC1, 0x95, 0x53,
-    0xDC, 0xF1, 0x8E, 0xAD, 0xFE, 0x96, 0x56, 0xBF, 0x51, 0x38, 0xC0, 0x5F, 0x5B, 0x4D, 0xCF, 0x80,
-    0x00, 0x0B, 0x32, 0x20, 0x21, 0x18, 0x40, 0x6B, 0x31, 0x0F, 0x4E, 0x5D, 0xCE, 0x14, 0xBE, 0x74,
-    0x73, 0xE3, 0x17, 0x74, 0xD6, 0xCB, 0xD6, 0x50, 0x9D, 0xAE, 0x61, 0xC4, 0x70, 0x1D, 0x0B, 0x88,
-    0xEF, 0xE8, 0xF8, 0xBD, 0xA2, 0xA9, 0x07, 0xB4, 0x79, 0x7F, 0x83, 0x36, 0xEF, 0x17, 0x86, 0xD6,
-    0x3B, 0x6D, 0xF3, 0x26, 0x7F, 0xB0, 0x36, 0xEF, 0xFF, 0x00, 0xBD, 0x56, 0xCD, 0x6F, 0x24, 0x47,
-    0x15, 0x7F, 0xDD, 0xBD, 0xB3, 0xCD, 0xBA, 0xA5, 0xD4, 0x1C, 0x3C, 0x28, 0xD8, 0x22, 0xCD, 0x61,
-    0x0F, 0x91, 0x85, 0xD3, 0x17, 0x24, 0x12, 0xC9, 0x33, 0x55, 0x21, 0x48, 0x9C, 0x10, 0x3E, 0x78,
-    0xB8, 0x45, 0xCB, 0x61, 0x2F, 0x6B, 0x84, 0x2C, 0x6E, 0x46, 0x9A, 0xA4, 0x4B, 0xC9, 0x21, 0x47,
-    0x9C, 0x70, 0xE0, 0x10, 0x21, 0xE6, 0xE0, 0x48, 0xCE, 0x70, 0x20, 0x87, 0x3D, 0x18, 0xC9, 0xEB,
-    0xAE, 0xDD, 0xFC, 0x03, 0x0D, 0x8B, 0xB8, 0x44, 0x82, 0x46, 0x98, 0x0F, 0x91, 0x03, 0x05, 0xEA,
-    0x4D, 0x7A, 0xB3, 0xDD, 0x53, 0xFC, 0x5E, 0xCD, 0xD8, 0xDE, 0x2C, 0xB0, 0x47, 0xBA, 0xAB, 0xBB,
-    0x67, 0xEA, 0xEB, 0x7D, 0xFD, 0xDE, 0xEF, 0xD5, 0xEE, 0x94, 0x64, 0x43, 0x69, 0x4B, 0x49, 0x47,
-    0xD1, 0x9C, 0xC8, 0x11, 0x0D, 0x88, 0x66, 0x87, 0x81, 0xAB, 0x22, 0xA7, 0xC5, 0x9C, 0xB2, 0x9A,
-    0x72, 0xC3, 0x7D, 0xB4, 0x31, 0x23, 0x2A, 0x9C, 0x0A, 0x9C, 0x33, 0xF1, 0x3C, 0xAF, 0xB2, 0x3A,
-    0xB5, 0x85, 0x49, 0xDA, 0x31, 0x05, 0x3B, 0xB4, 0x4A, 0x83, 0xC8, 0xA9, 0xD7, 0x85, 0xFB, 0xAC,
-    0xCB, 0x9C, 0x6B, 0xE5, 0xBB, 0xAE, 0x7E, 0x9D, 0x8A, 0x72, 0x95, 0xAE, 0x50, 0x6F, 0x3C, 0x56,
-    0xE8, 0x33, 0xD2, 0x39, 0x8D, 0x47, 0x0D, 0xC6, 0x63, 0x5A, 0x9B, 0xCD, 0x66, 0x0A, 0x7F, 0x9C,
-    0x7F, 0x91, 0x7F, 0xA1, 0x7F, 0x87, 0x24, 0x45, 0x56, 0x6A, 0x61, 0xE5, 0xC3, 0xA2, 0xE4, 0x45,
-    0x02, 0x03, 0xA1, 0x6B, 0x88, 0x7A, 0x44, 0x57, 0x95, 0xB4, 0x45, 0xED, 0xEA, 0xC2, 0x66, 0x86,
-    0xFC, 0x25, 0xF5, 0x9C, 0x8A, 0x7B, 0x8E, 0xDC, 0x87, 0xCE, 0x7F, 0x37, 0xE8, 0xC8, 0x77, 0x77,
-    0xD8, 0x11, 0x3B, 0x1B, 0x2A, 0x0C, 0xE5, 0x3A, 0x74, 0x6C, 0x5F, 0x5A, 0xD2, 0x9A, 0xA6, 0x60,
-    0x9B, 0xD2, 0x39, 0x46, 0xF5, 0x69, 0x6A, 0xDA, 0xA4, 0x6C, 0x13, 0x73, 0xBA, 0x07, 0xCD, 0x34,
-    0x3A, 0x49, 0xC1, 0xEE, 0xB7, 0x67, 0x98, 0xFE, 0xA1, 0xD3, 0xB1, 0x4B, 0xE6, 0x24, 0x9A, 0xB4,
-    0xA6, 0xAC, 0x92, 0xD8, 0x47, 0xC1, 0x2F, 0xAB, 0xB4, 0x43, 0xB4, 0xAB, 0xC2, 0xF7, 0x65, 0x99,
-    0x62, 0xA4, 0x28, 0xA1, 0x9C, 0x8A, 0x5C, 0xB7, 0x50, 0x70, 0xBC, 0x4D, 0x71, 0x9D, 0x58, 0x61,
-    0x45, 0x95, 0x96, 0x69, 0x99, 0x19, 0x69, 0xA4, 0xCE, 0xD5, 0x80, 0x44, 0x59, 0x40, 0xB8, 0xA3,
-    0xCC, 0x40, 0xF0, 0x5D, 0xA8, 0x76, 0xAF, 0x25, 0xF9, 0x66, 0x4B, 0xBB, 0xDF, 0x38, 0xA4, 0xD9,
-    0x3B, 0x33, 0x95, 0xFF, 0xD1, 0xE9, 0x0C, 0x9E, 0x14, 0xB5, 0x2C, 0xA3, 0x56, 0xD8, 0xA0, 0x8B,
-    0x6B, 0xC8, 0xDA, 0xA6, 0x0C, 0x0A, 0xC1, 0x00, 0x82, 0x1D, 0xC7, 0xC5, 0x8F, 0x4D, 0xFB, 0xA5,
-    0x54, 0x9F, 0x52, 0xAE, 0x72, 0xB8, 0x24, 0x73, 0x2D, 0xC5, 0xAE, 0x62, 0x9D, 0x88, 0xF6, 0xCE,
-    0x28, 0x42, 0x9F, 0x58, 0xF8, 0xD7, 0xE4, 0x3A, 0x83, 0x44, 0x01, 0xDF, 0x07, 0x0A, 0xD6, 0x93,
-    0xD3, 0x81, 0xE3, 0xD0, 0x22, 0xC0, 0xA2, 0xA5, 0xAC, 0x21, 0x69, 0xA9, 0xB0, 0x34, 0x56, 0x14,
-    0x38, 0x1D, 0x71, 0x23, 0xB6, 0x15, 0x1E, 0xF2, 0x43, 0xB2, 0x64, 0xA1, 0x63, 0x16, 0xED, 0x70,
-    0x17, 0xB8, 0x73, 0xB6, 0x05, 0xF7, 0x40, 0x3D, 0x7D, 0xC5, 0xC6, 0x21, 0xC9, 0x96, 0xFB, 0x63,
-    0xF6, 0x09, 0x76, 0x50, 0x8C, 0x9B, 0x8D, 0x23, 0x72, 0x75, 0xE8, 0xCA, 0xD8, 0xF1, 0x90, 0xAC,
-    0x68, 0x00, 0xBB, 0x32, 0xA2, 0x11, 0x6D, 0xDC, 0xA1, 0xBC, 0xA3, 0xDD, 0x96, 0xE8, 0x84, 0xA8,
-    0xE1, 0xC8, 0x25, 0x86, 0x84, 0x26, 0x31, 0xA3, 0xD4, 0xA9, 0x6C, 0x46, 0x2F, 0xF0, 0x2C, 0xF2,
-    0xD0, 0x3B, 0xCA, 0x5D, 0x8B, 0x76, 0x3E, 0xB5, 0xA6, 0xC0, 0x52, 0x88, 0x56, 0x51, 0x54, 0x51,
-    0xA8, 0x69, 0xED, 0x88, 0x65, 0x03, 0xCA, 0x85, 0x0D, 0x1C, 0xA0, 0xA3, 0xE5, 0x9C, 0x75, 0x7B,
-    0x89, 0x28, 0x38, 0x48, 0x4B, 0x69, 0x4E, 0xA9, 0xC5, 0x5D, 0x00, 0x60, 0x2B, 0x7E, 0x47, 0xBF,
-    0x07, 0x59, 0xFA, 0xE2, 0x03, 0x38, 0x14, 0x8D, 0xFB, 0xF0, 0xA3, 0x80, 0xAB, 0x4A, 0x8A, 0x0D,
-    0x6B, 0x92, 0xE8, 0xA5, 0xB4, 0xC1, 0x43, 0x06, 0x13, 0x50, 0x02, 0x81, 0x2C, 0xED, 0x00, 0x58,
-    0xC5, 0x12, 0x83, 0xF9, 0x94, 0x59, 0x36, 0x09, 0x2E, 0xC8, 0xBD, 0x17, 0x9C, 0x09, 0x9D, 0x46,
-    0x30, 0xDC, 0x9C, 0xA0, 0x6C, 0x51, 0xFA, 0xC1, 0xEA, 0x62, 0xD0, 0xB7, 0xBF, 0x10, 0x26, 0xE4,
-    0x1C, 0x44, 0x0A, 0xDE, 0xC3, 0x6E, 0x69, 0x2B, 0xF9, 0x6E, 0x92, 0x8A, 0x95, 0x48, 0xCB, 0x1C,
-    0x38, 0xC7, 0xE6, 0x15, 0x6C, 0x28, 0x9D, 0x5A, 0x53, 0xB7, 0x08, 0x60, 0x10, 0x8C, 0x5A, 0x53,
-    0xDC, 0x30, 0x27, 0x71, 0x89, 0x86, 0x1F, 0xD2, 0xA7, 0x27, 0x86, 0xAE, 0xCE, 0x44, 0x97, 0x36,
-    0x99, 0x95, 0xA6, 0x50, 0xAB, 0x14, 0xD5, 0x94, 0x34, 0x00, 0x03, 0xA2, 0xAB, 0x10, 0xFB, 0x97,
-    0x17, 0xEA, 0x74, 0x54, 0x40, 0xF1, 0x2E, 0xB1, 0x59, 0x99, 0xEB, 0x42, 0x15, 0xBF, 0x2D, 0x3A,
-    0xD9, 0x25, 0x70, 0xE7, 0x39, 0x62, 0xB3, 0x45, 0x8C, 0x81, 0xD8, 0x82, 0x43, 0xC9, 0x8A, 0x20,
-    0x8F, 0xF9, 0x41, 0xA8, 0x1A, 0x44, 0xA1, 0x1E, 0xC2, 0xE5, 0x13, 0x76, 0x3B, 0xAE, 0xE9, 0x55,
-    0xBA, 0x59, 0x0B, 0xB2, 0x77, 0xF2, 0x9F, 0x5A, 0xF9, 0xC8, 0x99, 0x15, 0x7D, 0x8B, 0x33, 0xE3,
-    0x08, 0x99, 0x51, 0x03, 0xCB, 0x3E, 0x33, 0x62, 0x08, 0x8D, 0x1C, 0x9C, 0x0C, 0xA4, 0xD1, 0xCA,
-    0x4C, 0xC3, 0x5E, 0x78, 0xC1, 0xD9, 0xD0, 0xFD, 0xBC, 0x4E, 0x20, 0x3B, 0xB3, 0xE1, 0x1C, 0x50,
-    0x18, 0x3F, 0x2D, 0xE5, 0x9F, 0xC4, 0xB6, 0x7C, 0x1C, 0xDB, 0xDB, 0xB4, 0x0A, 0x4C, 0x75, 0xA9,
-    0xFB, 0xB8, 0xC5, 0x58, 0x93, 0xDF, 0x70, 0xF6, 0x0E, 0x00, 0xBA, 0x73, 0xC9, 0x39, 0x9E, 0x6F,
-    0xCE, 0x39, 0x67, 0x03, 0x9C, 0x33, 0x65, 0xA6, 0xA9, 0x90, 0x41, 0x50, 0xC5, 0xE3, 0x8D, 0x7F,
-    0x61, 0x73, 0x67, 0xB0, 0x82, 0xF5, 0x3C, 0xBF, 0xB2, 0x0B, 0x6E, 0xC2, 0xD2, 0x31, 0x7B, 0x79,
-    0x10, 0x3B, 0x75, 0x47, 0xB8, 0x4F, 0x1E, 0x97, 0x65, 0x98, 0xDF, 0x78, 0x5F, 0xBA, 0xA4, 0x31,
-    0x6C, 0x3E, 0x5F, 0x70, 0x19, 0x0F, 0xCC, 0x66, 0xEF, 0x73, 0x2F, 0xFA, 0x72, 0xFF, 0xE9, 0x0A,
-    0xFF, 0x69, 0x79, 0x57, 0x9E, 0x43, 0x21, 0x7B, 0x5A, 0xF9, 0x24, 0x4F, 0xA0, 0x14, 0x60, 0x11,
-    0xC3, 0x67, 0xC0, 0x2F, 0xE5, 0x88, 0x4E, 0x06, 0x35, 0x9F, 0xB9, 0xD4, 0x8A, 0x56, 0xB4, 0x57,
-    0xCE, 0xD3, 0x9F, 0xF4, 0xEA, 0x7A, 0xE0, 0x06, 0x1D, 0xBF, 0xA3, 0x96, 0xDF, 0xB1, 0x0F, 0x90,
-    0xA8, 0x9E, 0x36, 0xB1, 0xF9, 0xFF, 0x4E, 0x5C, 0x5C, 0xD7, 0x90, 0xDA, 0x69, 0x19, 0x57, 0x91,
-    0x8D, 0x2B, 0x46, 0xE1, 0xAF, 0x7C, 0xAF, 0x50, 0xB4, 0x95, 0x12, 0x4D, 0x80, 0xB2, 0x13, 0x46,
-    0x1A, 0xBC, 0x55, 0xE3, 0xB1, 0xCB, 0xE8, 0xB4, 0x82, 0x1F, 0xA2, 0xE3, 0xE7, 0x80, 0x40, 0xD0,
-    0x81, 0x1D, 0x8D, 0xBF, 0x6B, 0x31, 0x5E, 0xC1, 0xB9, 0x07, 0xC1, 0xE1, 0x9A, 0x02, 0x42, 0xED,
-    0x30, 0xFD, 0xB5, 0xBD, 0x9D, 0xA8, 0x1A, 0xA8, 0xFC, 0x1E, 0x0B, 0x8A, 0x29, 0xBB, 0xC1, 0xB9,
-    0x01, 0x1E, 0x15, 0x0D, 0x53, 0xCC, 0xFE, 0x90, 0xFA, 0xE4, 0x01, 0x55, 0x50, 0xF4, 0x90, 0xE2,
-    0x92, 0x1B, 0x67, 0xB2, 0xA5, 0xA0, 0xE6, 0xB6, 0x8E, 0x2C, 0xD5, 0x9E, 0x4C, 0xBD, 0x4E, 0x6E,
-    0x01, 0xC3, 0xFF, 0x40, 0xC5, 0xE7, 0x8A, 0xD5, 0x98, 0x76, 0xA7, 0x94, 0xD7, 0xCC, 0xA8, 0xE0,
-    0xB5, 0xC7, 0x6A, 0xE7, 0xD4, 0x93, 0x9D, 0x12, 0x9D, 0x67, 0x5A, 0xCF, 0x8C, 0x5C, 0x1F, 0x01,
-    0x6A, 0x2D, 0x61, 0xD3, 0x67, 0x73, 0x9F, 0x5A, 0x24, 0x3F, 0x02, 0xC8, 0x25, 0xE7, 0x25, 0xA3,
-    0x88, 0xE9, 0xA7, 0xCA, 0x9B, 0xBD, 0x26, 0x6A, 0x62, 0x2B, 0xCA, 0xE0, 0x52, 0x26, 0xA2, 0x9A,
-    0x56, 0xA8, 0x7B, 0xD8, 0xCD, 0xDD, 0x07, 0xBE, 0xFE, 0xE9, 0xDE, 0xC4, 0xFB, 0xFE, 0x1C, 0x12,
-    0xD7, 0xE2, 0x36, 0x38, 0x24, 0x2E, 0x6A, 0x44, 0x6B, 0x07, 0xB2, 0x92, 0x65, 0x7E, 0x96, 0xB7,
-    0x39, 0x8A, 0xD3, 0x55, 0x20, 0xEF, 0x40, 0x78, 0x74, 0xFF, 0x7D, 0xF6, 0x4B, 0x93, 0x32, 0xB5,
-    0xC2, 0xBD, 0x42, 0x8F, 0xD8, 0xE5, 0x43, 0xBC, 0x9E, 0xC0, 0xB9, 0x5A, 0xE0, 0xFC, 0xE2, 0x02,
-    0x4E, 0x3B, 0x62, 0xC0, 0x92, 0xC7, 0x69, 0x6A, 0xE6, 0xD9, 0xDD, 0x0E, 0xA5, 0x4B, 0xBE, 0xD1,
-    0xE6, 0xAF, 0xB4, 0x45, 0xD4, 0xEC, 0x86, 0x87, 0x19, 0x73, 0x12, 0x6D, 0x9C, 0x12, 0x61, 0xC3,
-    0x89, 0x27, 0xCB, 0x63, 0x2C, 0x45, 0x95, 0x7D, 0xA7, 0x9A, 0x0A, 0x77, 0xCF, 0x66, 0xEE, 0xE3,
-    0x72, 0x08, 0xDA, 0x3A, 0x1E, 0xCD, 0xA9, 0xCF, 0x43, 0xFD, 0xE5, 0xEE, 0x8C, 0x17, 0xCF, 0x3E,
-    0x78, 0x10, 0x25, 0xBA, 0x49, 0x37, 0xE1, 0xB1, 0x5A, 0xB8, 0xBF, 0xDA, 0x6C, 0xDD, 0x95, 0x5B,
-    0xE0, 0xAE, 0x3E, 0xA7, 0x3F, 0x4E, 0x1E, 0xBE, 0x04, 0xF2, 0x23, 0xFD, 0xCA, 0x3E, 0x32, 0xBC,
-    0x89, 0xDD, 0x23, 0x2B, 0x3E, 0x72, 0x65, 0xCA, 0x25, 0xC6, 0x6F, 0x17, 0x56, 0xA9, 0x7B, 0xD7,
-    0x48, 0x1C, 0x4F, 0x26, 0x28, 0x3E, 0x7D, 0xE4, 0xAB, 0x97, 0x35, 0xFD, 0x2A, 0xC5, 0x7F, 0xCE,
-    0xD9, 0x40, 0xA6, 0x16, 0x1D, 0x1B, 0x10, 0x98, 0x3E, 0x58, 0x2A, 0x11, 0xE8, 0xA4, 0xCC, 0xEC,
-    0xDE, 0x99, 0xD0, 0x42, 0xA5, 0xA8, 0x48, 0x79, 0x1D, 0x39, 0x93, 0x76, 0xCB, 0xCF, 0x8F, 0xB6,
-    0x11, 0xB8, 0xDE, 0x0F, 0xF6, 0xFD, 0xD4, 0xCD, 0x7D, 0x5F, 0x6A, 0xF1, 0x79, 0x66, 0xEB, 0x03,
-    0xDA, 0x44, 0x52, 0xAE, 0x7E, 0xC0, 0x72, 0x0D, 0x37, 0x2E, 0x3F, 0x68, 0xF4, 0x05, 0xF4, 0x5C,
-    0xA7, 0xFE, 0x97, 0xF1, 0xD9, 0xBF, 0xB2, 0xCF, 0x21, 0xED, 0x6F, 0xEE, 0xB3, 0x16, 0x57, 0x36,
-    0xF7, 0xB7, 0x78, 0x93, 0xCD, 0xFD, 0xEB, 0xF8, 0x3C, 0xBB, 0xB9, 0xDC, 0xF3, 0xBA, 0x9F, 0xF9,
-    0x2C, 0xF1, 0xE7, 0x6B, 0xC4, 0x8C, 0x86, 0x76, 0xBE, 0x67, 0xF0, 0x6D, 0xFA, 0xA1, 0xA2, 0xA5,
-    0x3C, 0x2C, 0x78, 0x7E, 0xA1, 0x04, 0x5D, 0x7E, 0x3E, 0xAF, 0xAE, 0x42, 0x9D, 0xCA, 0xCB, 0xA4,
-    0x8E, 0xEB, 0xBC, 0xEA, 0x08, 0x26, 0x4E, 0x13, 0x9B, 0x5A, 0xA9, 0x24, 0xFC, 0x96, 0x19, 0x61,
-    0xA0, 0xE0, 0x5E, 0x03, 0x08, 0x3A, 0x85, 0xAC, 0x32, 0x29, 0x33, 0xFE, 0xCB, 0x71, 0x25, 0xD3,
-    0xFB, 0xBE, 0x7E, 0xF9, 0x67, 0x79, 0xAA, 0xEA, 0xF7, 0x27, 0xC7, 0x12, 0xE7, 0x10, 0xF0, 0x78,
-    0xBB, 0xF5, 0x22, 0xAB, 0x4F, 0x27, 0xEB, 0x75, 0xAE, 0x73, 0x4C, 0x0A, 0x1B, 0x7A, 0x5E, 0x21,
-    0xC8, 0xF9, 0x41, 0xD2, 0x84, 0x4D, 0x56, 0x9F, 0xAA, 0x29, 0x1F, 0x9B, 0x20, 0x1B, 0xEE, 0x3B,
-    0x90, 0x2A, 0xA9, 0x73, 0x13, 0xD5, 0x9F, 0x9A, 0xCC, 0xFE, 0xAB, 0x9A, 0x87, 0x95, 0x9D, 0x46,
-    0xE6, 0x76, 0x8F, 0x84, 0x11, 0x36, 0xB2, 0x21, 0x1E, 0x3E, 0x4C, 0xBD, 0xF4, 0xC4, 0x41, 0x0E,
-    0xE5, 0x14, 0x25, 0xF7, 0xEB, 0xBF, 0x07, 0xE4, 0x68, 0xFD, 0x01, 0x89, 0x9A, 0xE4, 0x84, 0xAE,
-    0x7D, 0x85, 0x92, 0xAA, 0xE0, 0xC0, 0x55, 0xC7, 0xE9, 0x5D, 0x6B, 0x85, 0xBA, 0xCD, 0xCF, 0x71,
-    0x6A, 0x7C, 0xF6, 0x27, 0x75, 0xA1, 0x57, 0x69, 0x0B, 0xFE, 0x29, 0x5A, 0x64, 0xD1, 0x6D, 0x14,
-    0xF2, 0xE9, 0xC0, 0x6B, 0x3F, 0x50, 0xD2, 0x9B, 0x81, 0xF3, 0x03, 0x73, 0x48, 0x8C, 0x73, 0xCA,
-    0x1C, 0x8E, 0x2D, 0x1A, 0xAE, 0x23, 0x33, 0xCF, 0xFB, 0x9E, 0x81, 0x17, 0x05, 0xCE, 0x9D, 0xF1,
-    0xDC, 0x3D, 0xF7, 0xD0, 0xAF, 0xE4, 0xDF, 0x3D, 0x95, 0xF9, 0xD2, 0x90, 0x6B, 0x9C, 0xFD, 0xB0,
-    0x1E, 0x47, 0x1D, 0x70, 0x71, 0x50, 0xB4, 0xEC, 0x3B, 0xAC, 0xAF, 0x7C, 0x6A, 0xC0, 0x8D, 0x8B,
-    0xE2, 0xC1, 0x73, 0xE8, 0xFB, 0x7E, 0xBD, 0xA7, 0x7B, 0xCF, 0x0E, 0x6E, 0xF9, 0xF6, 0x94, 0xEF,
-    0xA9, 0x62, 0xC7, 0x9F, 0x78, 0xFF, 0xF7, 0x28, 0x05, 0x3E, 0xF7, 0xB6, 0xD1, 0x09, 0x6D, 0x23,
-    0x1B, 0xF1, 0xD8, 0x7B, 0x7B, 0x95, 0xF0, 0xBA, 0x22, 0x5E, 0x67, 0xBD, 0xC2, 0xAF, 0x84, 0x29,
-    0x7B, 0x0B, 0xA1, 0x4F, 0x5C, 0xEB, 0x0B, 0x5B, 0x42, 0x9E, 0xAE, 0x17, 0xB6, 0x31, 0x89, 0x42,
-    0xE7, 0x5F, 0x80, 0x6B, 0x22, 0xB6, 0x7B, 0xDD, 0x31, 0x1D, 0xB2, 0x6F, 0xF4, 0xC2, 0x46, 0x69,
-    0xE8, 0xBF, 0x5E, 0xE7, 0x09, 0xD2, 0x2C, 0x4B, 0xD8, 0x52, 0x57, 0xE8, 0xB1, 0xA8, 0x5E, 0x4E,
-    0x2F, 0xC6, 0xBB, 0xE5, 0x3C, 0xBB, 0xFC, 0x42, 0xB9, 0xB7, 0x95, 0x78, 0x64, 0xB2, 0x1B, 0x66,
-    0x24, 0xF4, 0x44, 0xA8, 0x93, 0x94, 0x4E, 0x24, 0xE5, 0x20, 0xBC, 0x57, 0x89, 0x6E, 0xC1, 0x99,
-    0x3A, 0x7D, 0xCB, 0x48, 0x81, 0xA3, 0x0B, 0x8D, 0xB6, 0x99, 0x34, 0xC0, 0x20, 0x38, 0xAC, 0x04,
-    0x3A, 0x2A, 0x03, 0xD5, 0x53, 0xE7, 0x89, 0x38, 0xC2, 0xD0, 0x04, 0xB1, 0x05, 0xB7, 0xE1, 0x1C,
-    0x03, 0x2E, 0x1F, 0x26, 0xE6, 0x44, 0x68, 0x6E, 0x19, 0x1F, 0xEE, 0x71, 0x50, 0xEA, 0x05, 0x2A,
-    0x8B, 0xCD, 0x28, 0x31, 0x43, 0x16, 0xA4, 0x27, 0xA9, 0x62, 0x41, 0xFF, 0xA0, 0xEC, 0x55, 0xAC,
-    0x12, 0x73, 0xF9, 0xCD, 0xD7, 0xC0, 0x46, 0x7C, 0xCB, 0x06, 0xDC, 0x1E, 0x4C, 0xC9, 0x1F, 0xDD,
-    0x82, 0x9F, 0xA0, 0xD8, 0xB3, 0x7A, 0xC3, 0x85, 0x7A, 0xE2, 0x5C, 0xBD, 0x9F, 0x5D, 0x4C, 0xA1,
-    0xE8, 0x77, 0x38, 0xB9, 0x54, 0xC9, 0x9F, 0xAC, 0xB8, 0x67, 0xC5, 0x2B, 0x55, 0x1A, 0x95, 0x4B,
-    0x41, 0x89, 0xEA, 0xAD, 0x84, 0x5A, 0x14, 0x7F, 0x00, 0xF5, 0x3C, 0xA8, 0xD3, 0x6F, 0x95, 0x75,
-    0x96, 0xDC, 0xB5, 0x23, 0xF1, 0x86, 0x1D, 0x62, 0xDE, 0x44, 0x44, 0xE5, 0xFE, 0x73, 0x91, 0xE9,
-    0x5D, 0x13, 0xA7, 0xE2, 0x6F, 0xA9, 0xBE, 0xB4, 0x02, 0x41, 0x29, 0xE3, 0x33, 0x64, 0xD4, 0x85,
-    0x75, 0xB2, 0x12, 0xE5, 0x4E, 0x4F, 0x1D, 0x43, 0xE9, 0x11, 0x4D, 0x26, 0x34, 0x69, 0x68, 0xE8,
-    0x8F, 0xD1, 0xA8, 0x41, 0x2F, 0x30, 0x11, 0xEC, 0x44, 0xBF, 0xB1, 0xE1, 0xA7, 0x86, 0x4F, 0x70,
-    0x38, 0x49, 0xC3, 0x47, 0x30, 0xEC, 0x3B, 0xFA, 0xB5, 0x44, 0xFF, 0x1B, 0xED, 0x7D, 0x3F, 0xB0,
-    0x24, 0xC7, 0x7D, 0xDE, 0xEC, 0x2E, 0xEE, 0x96, 0xC2, 0x56, 0x69, 0x18, 0xF0, 0x28, 0x15, 0x60,
-    0x7B, 0x14, 0x48, 0x81, 0x60, 0x4B, 0x93, 0x28, 0x72, 0xD1, 0x9C, 0xA1, 0x54, 0x36, 0x03, 0x06,
-    0xBC, 0x72, 0xDD, 0x23, 0xAB, 0x8C, 0x00, 0x0E, 0x1C, 0xD8, 0x50, 0xB9, 0x2E, 0x61, 0xA4, 0xA2,
-    0x34, 0x4B, 0x32, 0x40, 0xE0, 0xC0, 0xE7, 0xB2, 0xA0, 0x84, 0x01, 0x11, 0xC0, 0x2E, 0xE0, 0x21,
-    0x38, 0x87, 0xB2, 0x8A, 0xE2, 0x0C, 0x80, 0x80, 0x01, 0x02, 0x2C, 0xC5, 0xA2, 0x14, 0x20, 0xE0,
-    0x52, 0x00, 0x64, 0xEB, 0x10, 0xDC, 0x80, 0x18, 0x88, 0x73, 0x77, 0x33, 0xD3, 0xEE, 0xEF, 0xFB,
-    0x7E, 0x3D, 0x33, 0xBB, 0xEF, 0x3D, 0xDC, 0x81, 0x04, 0x49, 0x00, 0xD6, 0x03, 0x30, 0x3D, 0x78,
-    0x6F, 0x77, 0xA6, 0xFB, 0xD7, 0xDD, 0xBF, 0xFF, 0xBF, 0xAF, 0xA3, 0xE8, 0xE1, 0xE7, 0x23, 0xFF,
-    0xB3, 0x19, 0x70, 0x5D, 0x39, 0x5C, 0x23, 0xB7, 0xC5, 0xB5, 0xA8, 0x70, 0x4D, 0x77, 0xB8, 0x5E,
-    0xCA, 0x23, 0xFB, 0x59, 0x3B, 0xE7, 0x76, 0x51, 0xEC, 0xAF, 0xD5, 0xEC, 0xBA, 0x8D, 0x12, 0x7F,
-    0xCD, 0xA3, 0xB4, 0xC3, 0x67, 0x32, 0x5D, 0x5B, 0x3E, 0xA5, 0xC1, 0xB5, 0xAC, 0xA7, 0xAB, 0xFF,
-    0x60, 0xC3, 0x6B, 0x1D, 0x2D, 0x78, 0x5D, 0xF2, 0xBA, 0x72, 0x3F, 0x38, 0xB9, 0xEA, 0xAF, 0x5B,
-    0xF6, 0x23, 0xE7, 0xAB, 0xD8, 0x33, 0x5E, 0x63, 0x5D, 0xD9, 0xCB, 0x64, 0xFE, 0x42, 0x5E, 0x33,
-    0x7F, 0x8D, 0xEC, 0xEA, 0xFF, 0xBE, 0xFD, 0x63, 0xBC, 0xFE, 0x7B, 0xF8, 0x9F, 0xE2, 0xAF, 0x70,
-    0x2D, 0x5F, 0xC2, 0x35, 0xFB, 0x5A, 0x8F, 0xA1, 0x44, 0x57, 0xA3, 0x83, 0x9F, 0x0F, 0xFD, 0x88,
-    0x70, 0x75, 0x79, 0x31, 0x5D, 0xA3, 0x92, 0x57, 0x5C, 0x86, 0xF1, 0x71, 0xC3, 0xEC, 0x71, 0x3D,
-    0x67, 0xAE, 0xD3, 0xF5, 0x4A, 0xC4, 0x47, 0x34, 0xE1, 0x71, 0x05, 0x5F, 0x56, 0x72, 0xD4, 0xEE,
-    0xCE, 0xDA, 0xED, 0x23, 0xFC, 0x5B, 0x47, 0xF8, 0xDF, 0x7A, 0xE1, 0x87, 0x5F, 0xD6, 0x4B, 0x5E,
-    0xD1, 0x73, 0x87, 0xEB, 0xD2, 0xED, 0xD7, 0xEE, 0xDF, 0x3C, 0xE1, 0xAA, 0xB5, 0xDB, 0xF8, 0xEF,
-    0x6E, 0x70, 0xF5, 0xAF, 0xDA, 0xB8, 0x2E, 0x8A, 0x7B, 0x3C, 0xC0, 0xFF, 0x5C, 0x23, 0x2D, 0x17,
-    0xA7, 0xCF, 0x70, 0xB0, 0xD5, 0x38, 0xC0, 0x54, 0x34, 0xE3, 0x67, 0x48, 0x03, 0xFB, 0xE4, 0x44,
-    0xF9, 0xCD, 0x19, 0xFA, 0x1B, 0x39, 0xBA, 0x69, 0x14, 0xA2, 0x7C, 0x46, 0xCA, 0x17, 0x73, 0xCA,
-    0xEB, 0xAA, 0xA7, 0x63, 0xA5, 0x2E, 0xF8, 0xEA, 0x25, 0xAF, 0x81, 0xF2, 0x17, 0xD0, 0x5F, 0x04,
-    0x23, 0xA9, 0xE6, 0xAF, 0x9A, 0xBF, 0x30, 0xFC, 0x3C, 0x0A, 0x3A, 0x63, 0x6A, 0xF7, 0xEC, 0x6D,
-    0x4D, 0x4A, 0xEE, 0x3D, 0x0D, 0x6F, 0x95, 0xD5, 0xC2, 0xB5, 0xD1, 0x7A, 0xBB, 0x62, 0x1F, 0x36,
-    0x7C, 0x97, 0x0D, 0xBC, 0x9F, 0x2D, 0x1C, 0xCE, 0x69, 0xC1, 0x6B, 0xC9, 0x49, 0xD0, 0x55, 0x13,
-    0xE8, 0x66, 0x43, 0xB1, 0x65, 0xA5, 0x81, 0xEA, 0xBB, 0xFE, 0x13, 0x58, 0x15, 0x6F, 0x5E, 0x17,
-    0x91, 0x76, 0x46, 0xB6, 0x05, 0xAF, 0xFE, 0x0F, 0x03, 0x46, 0x76, 0x32, 0xEB, 0xED, 0x75, 0xF7,
-    0x06, 0x06, 0x8C, 0x17, 0xC4, 0x61, 0x01, 0xF5, 0x98, 0xF7, 0x17, 0xFC, 0x03, 0xFD, 0x3A, 0xF8,
-    0xD4, 0x11, 0xDD, 0x74, 0xD5, 0xAA, 0x66, 0xA7, 0x0B, 0x0E, 0x23, 0xE5, 0x87, 0x62, 0xD7, 0x91,
-    0xA0, 0x6E, 0xFA, 0x43, 0x62, 0xD4, 0x15, 0xA5, 0x45, 0xF5, 0x40, 0xFB, 0xAF, 0xF0, 0xF7, 0xC5,
-    0xD3, 0xD7, 0xFD, 0x27, 0x8B, 0xB0, 0xDC, 0x7A, 0x76, 0xA1, 0x06, 0x7D, 0x38, 0x0D, 0x57, 0xF2,
-    0xC8, 0x26, 0x03, 0xA4, 0xC2, 0x44, 0x60, 0x1A, 0x30, 0x09, 0x20, 0x3E, 0x48, 0x06, 0xF2, 0x63,
-    0x9F, 0x81, 0x1C, 0xF8, 0x0F, 0x7D, 0xF4, 0xFF, 0xE1, 0x3D, 0x98, 0xDB, 0x15, 0xFF, 0xDB, 0x72,
-    0x56, 0xD7, 0xFE, 0xBF, 0xCD, 0xEC, 0x51, 0x58, 0xFC, 0xE9, 0xD1, 0xA3, 0xA2, 0xCD, 0xEE, 0xDB,
-    0xFE, 0x37, 0x3F, 0xF6, 0x7F, 0xCE, 0xDE, 0x01, 0x41, 0x5E, 0xF7, 0x77, 0xE9, 0xCB, 0xDD, 0x19,
-    0x6E, 0xC0, 0x05, 0xC2, 0xF5, 0xC1, 0xE5, 0xC1, 0xD5, 0xC1, 0xC5, 0xC1, 0x55, 0xC1, 0xC9, 0xE4,
-    0xF3, 0xB8, 0x12, 0xB9, 0x10, 0x39, 0x61, 0x24, 0x21, 0x68, 0x40, 0x42, 0x70, 0xF5, 0xF1, 0xC2,
-    0xB5, 0xC7, 0xA5, 0x37, 0x7B, 0xF0, 0x85, 0x4F, 0x6F, 0x67, 0xEB, 0x4E, 0x7F, 0xEB, 0xC3, 0xDF,
-    0x8E, 0x3E, 0x40, 0x16, 0xA4, 0x37, 0x1F, 0xBD, 0x7E, 0x7A, 0x73, 0x78, 0x3D, 0xE8, 0xA3, 0x37,
-    0xCF, 0xC6, 0x35, 0x1C, 0x3C, 0xFD, 0x78, 0x5C, 0x07, 0x4F, 0xE7, 0x0C, 0x6F, 0xFC, 0xE3, 0x32,
-    0x6C, 0xCA, 0x4C, 0xEB, 0x89, 0x33, 0xEA, 0xFF, 0x98, 0x0E, 0x12, 0x0C, 0xE4, 0x4D, 0x91, 0x16,
-    0x8A, 0x96, 0x0A, 0x17, 0xE0, 0x74, 0x37, 0x8C, 0x1B, 0x5E, 0x77, 0xBE, 0x2F, 0xE2, 0x52, 0xE8,
-    0x8B, 0xB6, 0x1F, 0xC6, 0xAC, 0xCD, 0x87, 0x5F, 0x18, 0x21, 0xD2, 0xF1, 0xCE, 0x37, 0x85, 0xBE,
-    0x9C, 0xD5, 0xD8, 0x3E, 0x7B, 0x75, 0xD2, 0x3F, 0xB1, 0x13, 0x09, 0xEC, 0xD9, 0x60, 0x63, 0x7F,
-    0x57, 0x3A, 0x12, 0xC3, 0xFF, 0x1B, 0xFB, 0x4E, 0x7B, 0x8A, 0x2C, 0xC1, 0xBC, 0xB0, 0x60, 0xFC,
-    0x4E, 0xAD, 0x6C, 0xE9, 0xF0, 0x7F, 0xB6, 0xE8, 0x8A, 0xFF, 0x1F, 0x90, 0xC9, 0x77, 0xC5, 0xCF,
-    0x13, 0x26, 0xA8, 0xE8, 0xF1, 0x6B, 0xBF, 0xF5, 0x4A, 0xF0, 0x38, 0xF7, 0x82, 0xBF, 0x96, 0x7E,
-    0x87, 0xC4, 0xE4, 0xF4, 0xA5, 0x7F, 0x59, 0xC2, 0xDD, 0x57, 0x8E, 0x5C, 0xBB, 0xB8, 0x83, 0x0D,
-    0xE3, 0x3C, 0xF7, 0x5B, 0x1C, 0xAE, 0x26, 0xEE, 0x0C, 0xFF, 0x48, 0x6D, 0x11, 0xFF, 0x06, 0xF1,
-    0x26, 0x3F, 0x56, 0xDD, 0xF8, 0xA1, 0x8A, 0x43, 0xA5, 0x9D, 0x31, 0x29, 0x3F, 0x1B, 0x6B, 0xDD,
-    0xB4, 0xC6, 0xAA, 0x8A, 0xC6, 0x78, 0x8A, 0x1F, 0xAF, 0xD8, 0x56, 0x79, 0xF7, 0xB4, 0x74, 0xCF,
-    0x1B, 0xE1, 0x83, 0xF4, 0x21, 0x01, 0x16, 0xBA, 0x71, 0xF9, 0xD2, 0x6E, 0x2A, 0x6E, 0xC8, 0x66,
-    0xE3, 0x76, 0x78, 0x0F, 0x78, 0xFB, 0x0E, 0xEF, 0x01, 0xE9, 0xF6, 0x78, 0x0F, 0x39, 0x3F, 0xDE,
-    0xE3, 0xF6, 0xBE, 0x8F, 0xEA, 0xA9, 0xFF, 0x8A, 0x7A, 0xEA, 0xA9, 0xE7, 0xA7, 0x69, 0xE5, 0x6E,
-    0xF9, 0xA9, 0x64, 0x4F, 0xF1, 0x8A, 0x54, 0x37, 0xAD, 0x7A, 0x0A, 0x3A, 0xB0, 0xA7, 0xFE, 0x17,
-    0x1F, 0x90, 0xA8, 0x6A, 0xE7, 0xA2, 0xAA, 0x0A, 0xA2, 0xEA, 0xDD, 0x35, 0xBA, 0x7A, 0x28, 0xAA,
-    0x1C, 0x45, 0x95, 0xDB, 0x53, 0x54, 0x61, 0x80, 0x0B, 0xCC, 0x73, 0xCE, 0xD9, 0xC6, 0x1E, 0xE0,
-    0xDC, 0x6E, 0xFD, 0xAB, 0xFC, 0x90, 0x3D, 0xC9, 0xC5, 0xFF, 0xA3, 0x87, 0x4F, 0xA3, 0x89, 0x37,
-    0x1B, 0xCB, 0x95, 0xE0, 0x88, 0x56, 0x5A, 0x9E, 0xB1, 0xD6, 0xDC, 0xA5, 0xAB, 0x47, 0x93, 0xB9,
-    0xD7, 0x6A, 0xD9, 0xA1, 0xF7, 0x60, 0xF6, 0xFE, 0x99, 0x89, 0xD3, 0x7A, 0x15, 0xCB, 0xC1, 0xA6,
-    0xC8, 0x3A, 0xEE, 0x99, 0xAC, 0xC5, 0x8A, 0xF3, 0x5B, 0x2A, 0xA1, 0x22, 0x52, 0xF3, 0x75, 0xE5,
-    0xBB, 0x64, 0xB4, 0xE2, 0xDD, 0x11, 0xE5, 0x1C, 0xA7, 0x2C, 0x57, 0xB3, 0xC5, 0x0E, 0xFA, 0x1B,
-    0xED, 0xDD, 0xAF, 0xE3, 0x23, 0xBE, 0xDF, 0x58, 0xE9, 0x7E, 0x4C, 0xE2, 0x9F, 0x14, 0x0D, 0x7E,
-    0x92, 0xF0, 0x30, 0xDF, 0x07, 0x36, 0xBE, 0x0F, 0x03, 0xFB, 0x80, 0x45, 0x92, 0xA2, 0xC9, 0x35,
-    0x35, 0x5B, 0x4C, 0x8C, 0xF8, 0x74, 0xF4, 0xE4, 0x33, 0xD1, 0x24, 0x42, 0xC3, 0x8E, 0x5B, 0xAB,
-    0x59, 0x6A, 0xD0, 0x91, 0xA8, 0x13, 0x5D, 0x99, 0x0D, 0xBA, 0x8F, 0x20, 0xDF, 0x62, 0xAC, 0x01,
-    0xDF, 0x74, 0xBE, 0x07, 0x0D, 0x9A, 0xC4, 0xF7, 0x26, 0x69, 0xC9, 0x03, 0xBC, 0x80, 0xC7, 0x86,
-    0xF0, 0x0F, 0xE6, 0x4A, 0xF0, 0xFA, 0x82, 0x6F, 0x8A, 0x7A, 0xDD, 0x63, 0xE6, 0xF6, 0x31, 0x9B,
-    0x5D, 0xF6, 0x63, 0x4C, 0x50, 0x55, 0xBC, 0x8E, 0x05, 0x57, 0xB9, 0x97, 0xB1, 0xCA, 0x5E, 0x72,
-    0x7F, 0xE0, 0xFC, 0x68, 0x9F, 0x1A, 0x38, 0x55, 0x5F, 0xEC, 0x36, 0x98, 0xA5, 0xB4, 0xE1, 0xBB,
-    0x8A, 0xBD, 0x7F, 0xC9, 0x7A, 0x70, 0x55, 0xD2, 0x51, 0x68, 0xF8, 0x77, 0xF9, 0xBD, 0x17, 0xA5,
-    0x0D, 0xE5, 0x91, 0x7F, 0x57, 0x82, 0xE5, 0x57, 0x53, 0x46, 0x15, 0x68, 0xFC, 0x5E, 0xF4, 0x7D,
-    0xE0, 0x2A, 0xF0, 0x8D, 0x1F, 0x0A, 0x06, 0x5D, 0x56, 0x9C, 0xC7, 0xB2, 0x4A, 0xC8, 0xD6, 0xF6,
-    0x64, 0xD8, 0x99, 0xB3, 0x2D, 0xC9, 0x3D, 0xB6, 0x28, 0xDF, 0x88, 0x8E, 0x7E, 0xB0, 0x12, 0x16,
-    0xD8, 0x0C, 0x92, 0x33, 0x14, 0xB8, 0x5B, 0x4C, 0x3D, 0xC8, 0xEB, 0x17, 0x0B, 0x04, 0xBB, 0x7F,
-    0x12, 0x65, 0x4B, 0xC3, 0xD5, 0xE3, 0x49, 0x80, 0x49, 0x4A, 0x3A, 0x6E, 0xE9, 0xB8, 0xE3, 0xF6,
-    0x8D, 0x7B, 0xEE, 0xD9, 0xCD, 0xC0, 0x25, 0xBE, 0x76, 0x64, 0x63, 0x7E, 0x64, 0xB5, 0x38, 0xE2,
-    0x5E, 0xCC, 0xB2, 0xE2, 0x0B, 0xC5, 0x3B, 0x8D, 0x5D, 0x96, 0xB6, 0x2C, 0x5B, 0x75, 0xA6, 0xD6,
-    0xE2, 0x43, 0x9F, 0xFF, 0xA8, 0x24, 0xA7, 0x28, 0x82, 0x30, 0xEE, 0xD4, 0xD4, 0x93, 0x68, 0x8E,
-    0x16, 0x57, 0xA7, 0xD5, 0x5A, 0xAA, 0xCB, 0xE8, 0xF9, 0x40, 0xFE, 0x63, 0x4C, 0xC7, 0xD3, 0x14,
-    0x4D, 0x2A, 0xCE, 0x93, 0x59, 0xD3, 0x92, 0xEB, 0x78, 0x56, 0xB3, 0xD1, 0x30, 0x6D, 0xB4, 0xD8,
-    0xA6, 0x78, 0x42, 0xCF, 0xC6, 0x7F, 0x15, 0x0F, 0x4A, 0xF5, 0x04, 0x7E, 0xB5, 0xD2, 0x22, 0xDB,
-    0xE2, 0xAB, 0x60, 0x2C, 0x7E, 0x80, 0x6B, 0xF1, 0x17, 0x32, 0x95, 0xFA, 0xA8, 0x0F, 0x89, 0x1B,
-    0x55, 0x3C, 0xF4, 0xC1, 0x39, 0x93, 0x2A, 0x41, 0xE9, 0xD5, 0x4E, 0xA8, 0xA2, 0x51, 0x8B, 0xF3,
-    0xCD, 0x36, 0x1A, 0xF5, 0x38, 0xE3, 0x91, 0x61, 0x27, 0xE3, 0x66, 0x2F, 0x6D, 0xBA, 0x96, 0x22,
-    0x5D, 0x4B, 0xDF, 0xAA, 0x67, 0xA4, 0x71, 0xB7, 0x6B, 0x52, 0xF2, 0x5B, 0x0D, 0xBF, 0xCF, 0xC5,
-    0xB0, 0x1E, 0x12, 0xD0, 0x37, 0xEE, 0xB8, 0x42, 0xD2, 0x96, 0x4D, 0x56, 0xC7, 0xDC, 0xA3, 0x6A,
-    0x3C, 0x33, 0xEC, 0xD8, 0x09, 0x34, 0xE0, 0x1F, 0x1D, 0x15, 0x18, 0xC8, 0xBE, 0x58, 0x4D, 0x2A,
-    0xAE, 0x96, 0x99, 0x1A, 0x77, 0xF7, 0xF4, 0xA6, 0xC6, 0x28, 0xDE, 0x83, 0x66, 0x4D, 0x05, 0x85,
-    0x24, 0x58, 0x49, 0xE2, 0xAD, 0xB4, 0x77, 0xA5, 0xB9, 0x04, 0x85, 0x72, 0x6F, 0x9A, 0xDD, 0xA4,
-    0xFE, 0x56, 0x87, 0x8A, 0xEF, 0x59, 0xF5, 0xF7, 0xEE, 0x9F, 0x8E, 0xFC, 0x83, 0x02, 0x60, 0xC1,
-    0x2E, 0x91, 0xFB, 0xA3, 0xCF, 0xD7, 0x29, 0xDE, 0x36, 0xB8, 0x42, 0xB4, 0xA9, 0x2B, 0x7E, 0x42,
-    0xFC, 0x6F, 0xFC, 0x44, 0xC4, 0x8E, 0xCC, 0x63, 0x30, 0xD1, 0x96, 0x90, 0x9B, 0xA7, 0xEC, 0x48,
-    0x16, 0x66, 0xE2, 0x0D, 0x12, 0x77, 0xB8, 0xA1, 0x41, 0xE7, 0xB3, 0x1E, 0xD6, 0xF6, 0x05, 0xBF,
-    0x18, 0xFC, 0x5A, 0x4D, 0xC9, 0xFB, 0x32, 0x4A, 0x03, 0xDF, 0x43, 0x88, 0x69, 0xEE, 0x8A, 0xB2,
-    0xBE, 0x2C, 0xA1, 0x8C, 0xCD, 0x43, 0x9E, 0xCE, 0xE7, 0xAB, 0x9F, 0x4B, 0xF7, 0x03, 0xF6, 0xB0,
-    0x92, 0x0C, 0x5E, 0xE2, 0xE6, 0x88, 0x6B, 0x43, 0x02, 0x25, 0x9E, 0x77, 0xBB, 0x53, 0xC8, 0x1E,
-    0x09, 0x9E, 0xB1, 0x9F, 0xD8, 0xE4, 0xEE, 0xCE, 0x47, 0xC4, 0x84, 0x88, 0x35, 0x7C, 0xA3, 0x9A,
-    0x96, 0x4D, 0x63, 0x56, 0x41, 0xAD, 0xFD, 0xEC, 0x4C, 0x95, 0x94, 0x26, 0xB7, 0x57, 0x47, 0xDC,
-    0x6E, 0x61, 0x4A, 0x5D, 0xD0, 0x28, 0x83, 0x56, 0x67, 0x7A, 0xE5, 0xA8, 0x5A, 0xAE, 0x4D, 0xB3,
-    0x93, 0x86, 0xD7, 0x4B, 0x5B, 0x80, 0x40, 0x18, 0x24, 0xE6, 0xC8, 0x82, 0xFC, 0xB4, 0xB0, 0x63,
-    0xE0, 0xD9, 0x9D, 0x54, 0x55, 0x74, 0x91, 0x3B, 0x98, 0x42, 0x25, 0xD7, 0x16, 0xE6, 0xCF, 0x7E,
-    0x6D, 0xED, 0x46, 0xED, 0x2E, 0x36, 0x6D, 0x62, 0x6C, 0x7B, 0x11, 0x86, 0xE3, 0xF6, 0xFD, 0xE0,
-    0xA3, 0x7D, 0x3F, 0xA4, 0x6E, 0x4F, 0xED, 0x63, 0x90, 0x3B, 0xF0, 0x31, 0x7C, 0xF8, 0x1D, 0x07,
-    0x0B, 0x70, 0xA2, 0x86, 0xFC, 0x9D, 0x92, 0x8C, 0x06, 0x58, 0x49, 0x01, 0x43, 0xB1, 0xDE, 0xD0,
-    0x26, 0xDE, 0x19, 0xBF, 0xDF, 0x90, 0xC9, 0x7B, 0x89, 0xBF, 0x4B, 0x4C, 0xA5, 0x76, 0x55, 0x26,
-    0x22, 0xF8, 0x19, 0x73, 0x62, 0xF3, 0xBF, 0x2F, 0x29, 0xEE, 0x1F, 0xFD, 0xB2, 0x7B, 0x4A, 0x0C,
-    0xCC, 0xFD, 0x1F, 0xF7, 0x2D, 0x63, 0xF4, 0xA6, 0xBB, 0xEA, 0xAE, 0x11, 0xBB, 0xB7, 0xB5, 0xA0,
-    0x79, 0xA8, 0x35, 0x82, 0x9B, 0x83, 0x84, 0x41, 0xE6, 0x92, 0x4E, 0x24, 0x2A, 0xBB, 0xB4, 0xA3,
-    0x81, 0xB9, 0x70, 0x4D, 0xD6, 0xB2, 0x03, 0xDE, 0x02, 0xCD, 0x1A, 0x19, 0x17, 0xBE, 0x23, 0x35,
-    0xBB, 0x97, 0x3A, 0x48, 0x62, 0xBC, 0xD7, 0x1B, 0x76, 0xE8, 0x7C, 0x45, 0x71, 0xEE, 0xF6, 0x50,
-    0x50, 0x56, 0x54, 0xA4, 0x16, 0xE4, 0xD0, 0x55, 0x44, 0x65, 0xCA, 0x7F, 0x21, 0xA7, 0x07, 0xA0,
-    0x09, 0xC2, 0xF0, 0x32, 0x39, 0x4C, 0x19, 0xF6, 0xEF, 0xE8, 0x3E, 0xC8, 0xDE, 0xBC, 0xEE, 0x3F,
-    0xF7, 0x9B, 0x7E, 0xB0, 0xD3, 0x66, 0x59, 0xCE, 0xEC, 0x42, 0x69, 0xB0, 0xC5, 0xC0, 0xD5, 0xDF,
-    0xF2, 0xBA, 0xC5, 0x75, 0xD0, 0x34, 0x78, 0x9A, 0x5C, 0x7A, 0xDC, 0x2C, 0xDE, 0xD9, 0x96, 0x39,
-    0xD8, 0xAF, 0x5D, 0xF4, 0x49, 0xFE, 0xF5, 0x4F, 0xF2, 0x47, 0x3D, 0x71, 0xB4, 0x49, 0xA4, 0x10,
-    0x16, 0xE4, 0xB7, 0x8F, 0x4A, 0x88, 0x5E, 0xB9, 0xFA, 0xD1, 0x57, 0x54, 0xBC, 0x1E, 0x56, 0x56,
-    0x6C, 0xB4, 0xB1, 0xB9, 0x80, 0x97, 0x94, 0x31, 0x11, 0x0D, 0x0F, 0xF8, 0x20, 0x86, 0xFC, 0x58,
-    0x53, 0xF9, 0x48, 0x0F, 0xFA, 0xA3, 0xAD, 0x4F, 0x2F, 0x4C, 0x55, 0x59, 0x5A, 0x1B, 0xAC, 0xDD,
-    0xD0, 0xAE, 0xAD, 0xF5, 0x64, 0x0B, 0xB6, 0x7E, 0x62, 0xE6, 0x7E, 0x30, 0xE8, 0x83, 0xD5, 0x1D,
-    0x0C, 0xEF, 0xE0, 0x53, 0x08, 0xE6, 0x77, 0xF0, 0x2C, 0xC8, 0xC4, 0xDF, 0x51, 0x36, 0x2C, 0xA4,
-    0x90, 0x42, 0x27, 0x5A, 0x68, 0x54, 0xF9, 0xD2, 0x88, 0xC9, 0x7E, 0xC9, 0xDE, 0x89, 0x30, 0x00,
-    0xEE, 0xC0, 0xA2, 0x23, 0x9D, 0xA1, 0x2A, 0x6E, 0x9C, 0x14, 0x22, 0x9A, 0xB7, 0xD2, 0xC7, 0xA8,
-    0x34, 0xA2, 0x5B, 0x85, 0xF9, 0x4C, 0x16, 0xD1, 0x5C, 0xAB, 0x4A, 0xFD, 0x13, 0x37, 0x78, 0x7B,
-    0x41, 0x66, 0x0D, 0x37, 0x0C, 0xA6, 0x48, 0xEC, 0x37, 0xE7, 0x2A, 0x5B, 0x61, 0x90, 0x98, 0xE6,
-    0xB5, 0xF8, 0x28, 0x4D, 0x64, 0xDD, 0x24, 0xF7, 0xA0, 0x1A, 0xDD, 0xF6, 0xE3, 0x7A, 0x0B, 0x6F,
-    0x78, 0xCD, 0x6F, 0xE1, 0x57, 0xC1, 0x4F, 0x5F, 0xF3, 0xFC, 0xE7, 0xBF, 0xC2, 0x11, 0xF5, 0x4A,
-    0xBB, 0x70, 0x50, 0xC2, 0xFC, 0xCD, 0x6A, 0x48, 0xA1, 0xC1, 0xFC, 0x97, 0x76, 0xDD, 0x65, 0xB8,
-    0x79, 0xCA, 0xAB, 0x65, 0x19, 0xF8, 0xFB, 0xE7, 0xBB, 0xA4, 0x2E, 0xF0, 0x1A, 0xFF, 0x87, 0xBD,
-    0x5F, 0x43, 0xB8, 0x29, 0xAA, 0xD2, 0xAB, 0x58, 0xC3, 0xAA, 0x73, 0x5B, 0x74, 0xB0, 0x5F, 0xF5,
-    0x0E, 0x0B, 0x2A, 0xEE, 0x57, 0x6E, 0x00, 0x51, 0xE2, 0x6E, 0xE5, 0x3A, 0x28, 0x8D, 0xB8, 0x69,
-    0x21, 0x11, 0x12, 0x7F, 0xAD, 0xE1, 0xDB, 0x4E, 0x9B, 0x15, 0x6C, 0xC5, 0x88, 0x1B, 0xA1, 0x5A,
-    0x0F, 0xBA, 0xD9, 0xD2, 0xF9, 0x4D, 0x3A, 0x1D, 0xAA, 0xBD, 0xF5, 0x59, 0xB5, 0x77, 0x21, 0xB5,
-    0x77, 0x79, 0xA4, 0xF6, 0xC2, 0xB0, 0x96, 0xDA, 0xFB, 0xEE, 0xC9, 0xE3, 0xCE, 0xAC, 0xF1, 0x28,
-    0x9A, 0x99, 0xE4, 0xBD, 0x96, 0x4A, 0x4F, 0x71, 0x55, 0xCC, 0x54, 0xEF, 0xFC, 0x48, 0xF5, 0x3E,
-    0xD3, 0x87, 0xE4, 0x02, 0xD5, 0x7B, 0xD6, 0x87, 0x99, 0xA3, 0xF2, 0x0D, 0x5B, 0x9C, 0xA6, 0x77,
-    0xEC, 0x46, 0x35, 0xC3, 0x79, 0x55, 0xAF, 0xF5, 0x5F, 0x6A, 0x22, 0xBE, 0xDD, 0x3F, 0x09, 0x5B,
-    0x2E, 0xA7, 0x2E, 0x28, 0xF7, 0x19, 0x04, 0xCA, 0x46, 0x5B, 0xC1, 0x04, 0xB8, 0x6F, 0xB0, 0x1A,
-    0xB1, 0x4D, 0x6A, 0x7E, 0x84, 0xCD, 0xC0, 0x25, 0xE9, 0xBB, 0x45, 0x0F, 0x50, 0xD8, 0xA3, 0xFC,
-    0x5B, 0xD1, 0x72, 0x43, 0x39, 0xCA, 0xCE, 0x25, 0x18, 0xCF, 0x40, 0xE9, 0x92, 0xBA, 0x37, 0x4B,
-    0xD3, 0x21, 0x87, 0xC8, 0xBC, 0x07, 0xE3, 0xAE, 0x4D, 0xC4, 0xE7, 0xCC, 0xEE, 0xE4, 0xCE, 0x91,
-    0x42, 0x1C, 0x1A, 0xA9, 0x0D, 0x33, 0xAB, 0xE1, 0xC0, 0xEE, 0x38, 0x63, 0xB9, 0x6C, 0x0E, 0x2D,
-    0x97, 0x81, 0xBB, 0x27, 0xE9, 0x2F, 0xB6, 0x5C, 0x32, 0xB3, 0x5C, 0x1A, 0x99, 0x4D, 0x17, 0x59,
-    0x2E, 0x3D, 0x67, 0x7F, 0x6E, 0x3D, 0x55, 0x47, 0xD6, 0x93, 0xBF, 0xDC, 0xA5, 0xB7, 0xCD, 0x44,
-    0x9E, 0x0D, 0x59, 0x1D, 0x87, 0xDA, 0xB5, 0x74, 0x34, 0x1C, 0xCB, 0xA0, 0x27, 0xFB, 0x37, 0xFB,
-    0xAB, 0x9F, 0xF2, 0x92, 0x3A, 0x33, 0x1D, 0x1C, 0x20, 0x9B, 0x7B, 0xF3, 0x09, 0x88, 0x66, 0x70,
-    0xB0, 0xA0, 0xD2, 0xE3, 0x99, 0x2B, 0xB2, 0xB4, 0x95, 0x7B, 0xFA, 0xEA, 0xC5, 0x4A, 0xCE, 0x59,
-    0x75, 0x34, 0xFB, 0x79, 0x78, 0xB4, 0x2F, 0xD2, 0xD1, 0xCE, 0x5C, 0x7F, 0x16, 0x8F, 0x36, 0x3A,
-    0xD5, 0xF3, 0x02, 0xC1, 0xDF, 0x51, 0x61, 0x72, 0xA4, 0xC4, 0x91, 0x2B, 0xF5, 0xD8, 0x53, 0xDA,
-    0xDD, 0xDF, 0x53, 0xBA, 0x3B, 0xE3, 0x29, 0xBD, 0xD0, 0x51, 0xFB, 0xB1, 0xF0, 0x08, 0xCC, 0x7E,
-    0xCA, 0x9D, 0xF9, 0x7B, 0x42, 0x4B, 0x3B, 0xFB, 0x72, 0x49, 0xC2, 0x2F, 0x4A, 0xED, 0xCE, 0x8D,
-    0xF1, 0xB0, 0x4C, 0xFA, 0xBE, 0xEF, 0xCB, 0x5B, 0xAE, 0x04, 0x1B, 0x6D, 0xD6, 0x6E, 0x89, 0x4B,
-    0xE5, 0xD9, 0x66, 0xD1, 0x82, 0x7D, 0xF4, 0x7E, 0xE8, 0xB0, 0x3A, 0x20, 0xDB, 0x20, 0x36, 0xD1,
-    0xFA, 0x79, 0xF0, 0xCC, 0x9D, 0x6D, 0x0A, 0xDB, 0x30, 0x35, 0xEB, 0xD0, 0xD3, 0x0A, 0xFE, 0x5B,
-    0x08, 0xF1, 0xA2, 0xF6, 0xDB, 0x21, 0x76, 0xBB, 0x62, 0x9F, 0xB8, 0x1D, 0x96, 0xC0, 0xBD, 0xD1,
-    0x6D, 0x39, 0x48, 0xCF, 0x74, 0x8D, 0xFA, 0xC1, 0x05, 0xF1, 0x87, 0xEE, 0xEE, 0x55, 0xF9, 0x03,
-    0xF2, 0x68, 0x16, 0xAC, 0x1C, 0xDB, 0x85, 0x62, 0x20, 0x4B, 0x4A, 0xAD, 0x9C, 0x7E, 0xEB, 0x74,
-    0xD0, 0x9C, 0x17, 0x66, 0xF7, 0x98, 0x99, 0xA5, 0xA0, 0x85, 0xE9, 0x13, 0xE8, 0xBB, 0x96, 0xB7,
-    0xE9, 0xD6, 0x71, 0xAF, 0xC5, 0x1A, 0x6B, 0x4A, 0xB0, 0x38, 0x2B, 0xD3, 0xC8, 0xED, 0x7D, 0xBD,
-    0xB5, 0xE6, 0xB6, 0xB6, 0x36, 0x35, 0xD7, 0xB6, 0x4D, 0x46, 0xE4, 0x87, 0x93, 0xF3, 0x63, 0x2F,
-    0xF3, 0x35, 0x1B, 0xAF, 0x50, 0xD1, 0xE1, 0x3B, 0xD8, 0xEB, 0x3B, 0x5B, 0x8D, 0x8D, 0xB9, 0xD9,
-    0xF7, 0xDC, 0x24, 0x50, 0xA8, 0xD1, 0x5D, 0xF4, 0x89, 0x0B, 0x6A, 0xB0, 0x8D, 0xF7, 0x3E, 0x3D,
-    0x3A, 0xF9, 0x03, 0x79, 0x74, 0x76, 0x0F, 0xE2, 0xD1, 0xA1, 0x68, 0x9B, 0xF8, 0xE2, 0xFE, 0x3C,
-    0x8F, 0x8E, 0xDB, 0xA6, 0xF3, 0x26, 0xD7, 0xAA, 0xB1, 0xC5, 0x13, 0x4D, 0xDC, 0x69, 0x6C, 0xFA,
-    0xB9, 0x1F, 0xD2, 0xDC, 0xFE, 0x69, 0xCB, 0xC9, 0x84, 0xC9, 0x82, 0xD7, 0x89, 0x0B, 0xAB, 0xBB,
-    0x31, 0xD9, 0xB7, 0xC6, 0xA9, 0xBE, 0x8A, 0xF3, 0xB2, 0xA7, 0x79, 0x06, 0xCE, 0x9D, 0x6B, 0xA4,
-    0x45, 0x4B, 0x7D, 0x6E, 0x88, 0x9E, 0x18, 0xC4, 0x3F, 0x68, 0xEA, 0x75, 0xE4, 0x34, 0x1D, 0xF9,
-    0xA8, 0x7F, 0xD9, 0x23, 0xCF, 0x17, 0x17, 0xB9, 0x03, 0xA6, 0x98, 0xD8, 0xE2, 0x7C, 0x77, 0xC0,
-    0xDA, 0x05, 0xF5, 0x4B, 0xDA, 0x16, 0xFE, 0xC4, 0xC8, 0x41, 0x3E, 0xDE, 0xF1, 0x83, 0x49, 0x6F,
-    0xA1, 0x05, 0xB3, 0xC4, 0xD7, 0xA6, 0x4D, 0xF2, 0xD7, 0x20, 0xB1, 0x69, 0x98, 0x19, 0xED, 0x72,
-    0xAA, 0x63, 0x0D, 0x26, 0x00, 0xA4, 0xF1, 0x7D, 0xD1, 0x07, 0xB0, 0x36, 0xF4, 0x01, 0xAE, 0x63,
-    0x31, 0x19, 0xE8, 0xD3, 0xFC, 0x80, 0x5C, 0xE0, 0xF8, 0x9E, 0xDC, 0xE0, 0x11, 0x75, 0xA5, 0x6A,
-    0xA1, 0x0F, 0xC8, 0x1D, 0x8E, 0x5F, 0x9B, 0x9A, 0x18, 0x5C, 0x53, 0xDB, 0x05, 0x7D, 0x26, 0xE1,
-    0xD7, 0xEA, 0xFC, 0x8A, 0x4A, 0xDE, 0xE9, 0x4D, 0x77, 0xEB, 0x05, 0x33, 0x92, 0xDD, 0x68, 0x28,
-    0x6B, 0x12, 0xA7, 0xBB, 0x6C, 0xBC, 0xD3, 0x03, 0xF3, 0xA5, 0xE2, 0x28, 0x7C, 0xCC, 0xD6, 0x3C,
-    0x11, 0x18, 0xB9, 0x7C, 0x11, 0x6B, 0x17, 0xBC, 0x11, 0x9B, 0x91, 0x06, 0xB6, 0xBE, 0xCD, 0x49,
-    0x91, 0xB5, 0xF6, 0x6B, 0x32, 0x09, 0xFE, 0x9A, 0x83, 0xE5, 0xAF, 0x69, 0x83, 0x37, 0x1A, 0xF9,
-    0xDE, 0x7E, 0x8D, 0x3B, 0xFD, 0x7A, 0x21, 0xD5, 0xB8, 0xA8, 0x23, 0x1B, 0x6C, 0x09, 0xC5, 0xB1,
-    0xB2, 0x5F, 0xDB, 0xFC, 0x8C, 0x34, 0x18, 0xDD, 0x73, 0xDB, 0x65, 0x98, 0x40, 0x1B, 0x79, 0x98,
-    0xB6, 0x59, 0xE7, 0x41, 0x0D, 0x10, 0x64, 0xA4, 0xC6, 0x30, 0xD2, 0xA0, 0x1F, 0x69, 0x30, 0xDD,
-    0x75, 0x81, 0xBF, 0x66, 0xD3, 0xDD, 0x28, 0x74, 0xB3, 0xD1, 0xA4, 0xD6, 0x6A, 0x9B, 0x56, 0x1C,
-    0xBD, 0xF3, 0x37, 0xF0, 0x94, 0x8A, 0xCC, 0x43, 0x57, 0x59, 0xDD, 0x39, 0x95, 0xA4, 0x33, 0x1E,
-    0xA7, 0x79, 0xE8, 0x44, 0x57, 0x7E, 0xE1, 0x38, 0x74, 0xE2, 0xB5, 0xD2, 0x77, 0x6F, 0x72, 0x89,
-    0xAC, 0x48, 0x8D, 0x85, 0x3C, 0x4B, 0x94, 0x64, 0x9E, 0x10, 0x0C, 0x8B, 0xED, 0xE8, 0x84, 0x83,
-    0x1F, 0x2E, 0x71, 0xDB, 0x35, 0x03, 0x3D, 0x6B, 0x8E, 0x6A, 0x43, 0xF6, 0x3B, 0x7A, 0x6A, 0xFE,
-    0x6F, 0xF0, 0xAB, 0xD8, 0xC2, 0xD7, 0x96, 0x88, 0x07, 0xB3, 0xF8, 0x83, 0x3B, 0x48, 0x3B, 0x7A,
-    0x1D, 0x3C, 0x3A, 0x6B, 0x99, 0x4E, 0x51, 0x58, 0xF2, 0x51, 0x58, 0xF1, 0x51, 0x58, 0xF0, 0x1A,
-    0x47, 0x09, 0xDE, 0xC9, 0x45, 0x4E, 0x1F, 0xA4, 0x6E, 0xE8, 0x52, 0x94, 0xBF, 0x90, 0x6B, 0xFD,
-    0xAF, 0x9D, 0xB3, 0xA5, 0x9E, 0x38, 0x5B, 0xDF, 0x1B, 0xDA, 0x71, 0xF2, 0x71, 0xFA, 0x2F, 0xAE,
-    0xE9, 0xE0, 0x94, 0x55, 0x19, 0x3B, 0x32, 0x48, 0xF8, 0x0E, 0xAD, 0xA7, 0x45, 0xAF, 0x99, 0x7E,
-    0xC1, 0x75, 0x2B, 0x5B, 0xE2, 0xCD, 0xDA, 0x56, 0x38, 0x23, 0x60, 0x19, 0x66, 0xD8, 0x6E, 0x6E,
-    0x48, 0xFE, 0x3F, 0x88, 0xBB, 0x2F, 0x3B, 0xEB, 0x5F, 0x94, 0x5E, 0xA4, 0x78, 0x24, 0xC5, 0x08,
-    0x97, 0xC7, 0xC2, 0xCC, 0x81, 0xBF, 0x2E, 0x9D, 0x82, 0x6B, 0xD8, 0x2D, 0x6B, 0xB8, 0xF3, 0x74,
-    0xA3, 0x11, 0xD1, 0x47, 0xEB, 0x1E, 0xC8, 0x47, 0xFB, 0x4C, 0x34, 0xF9, 0x69, 0x20, 0x23, 0x0B,
-    0x4A, 0xCC, 0x31, 0xE2, 0x8E, 0xCD, 0x76, 0xAB, 0xF4, 0x63, 0xFE, 0x75, 0xF3, 0xD3, 0x2C, 0x8C,
-    0xBB, 0xD5, 0xC7, 0x6A, 0x1B, 0x59, 0x3C, 0xD4, 0x40, 0x29, 0x83, 0xF1, 0x78, 0x0D, 0x9E, 0xE9,
-    0x43, 0xEF, 0xCE, 0x5C, 0x2B, 0xF4, 0x3D, 0xFC, 0x0D, 0xFF, 0x60, 0x2F, 0xDE, 0x9F, 0xBE, 0xEE,
-    0xDF, 0x9E, 0x8D, 0x3D, 0xDC, 0x5A, 0xDE, 0xC1, 0xA3, 0x20, 0xE6, 0x61, 0x2C, 0x2D, 0x78, 0xF0,
-    0x37, 0xCE, 0xBC, 0x84, 0xB6, 0xD6, 0xC9, 0x89, 0x48, 0x2F, 0x3A, 0x02, 0x38, 0x1A, 0xF8, 0x02,
-    0xBC, 0xEA, 0x61, 0xEE, 0x80, 0x8E, 0xB6, 0x6A, 0xD6, 0x41, 0x0B, 0x4A, 0xC8, 0x38, 0x6C, 0xF7,
-    0x7A, 0xCA, 0xAF, 0xC5, 0x84, 0xFC, 0x06, 0xDB, 0x38, 0x7B, 0xEA, 0xBB, 0x4F, 0xD8, 0xDD, 0x14,
-    0x7F, 0x94, 0xEB, 0x7E, 0xE3, 0x38, 0x1B, 0x9D, 0xC5, 0x66, 0xC3, 0xDD, 0xD2, 0xFD, 0xA0, 0x90,
-    0x27, 0x00, 0xB2, 0xA5, 0xE3, 0xF6, 0x82, 0x7C, 0xE9, 0x42, 0x58, 0x16, 0x77, 0x45, 0x1B, 0xCC,
-    0x24, 0x6E, 0x10, 0x7C, 0x06, 0x7A, 0x3D, 0xFD, 0xEA, 0xF9, 0x46, 0x52, 0x39, 0x86, 0xC1, 0xB3,
-    0x0D, 0x31, 0x53, 0x71, 0x3D, 0x7B, 0x0D, 0x1F, 0xC1, 0x41, 0xCA, 0xC4, 0x1A, 0x02, 0x45, 0xAE,
-    0x98, 0x83, 0xE7, 0x11, 0x27, 0x17, 0x85, 0x93, 0x11, 0x4E, 0xF2, 0x97, 0xDC, 0x87, 0x0B, 0x18,
-    0x71, 0x50, 0x42, 0xF7, 0x0A, 0x61, 0x57, 0x96, 0x00, 0x21, 0x5A, 0x46, 0x36, 0x6C, 0x50, 0x63,
-    0x4D, 0x3F, 0x3F, 0xA6, 0x5D, 0x41, 0x87, 0xBB, 0x37, 0xBB, 0x28, 0x0A, 0xC1, 0xF2, 0x42, 0xE6,
-    0x97, 0xD8, 0x05, 0x1E, 0xDD, 0x50, 0xAD, 0xC4, 0x52, 0x58, 0xCB, 0x75, 0x19, 0xCB, 0x4D, 0xE2,
-    0xE7, 0x96, 0x2F, 0xEF, 0x16, 0x54, 0xCF, 0x6B, 0xE5, 0x5E, 0xEC, 0x44, 0x72, 0x86, 0xD1, 0x53,
-    0xC5, 0x38, 0x0A, 0x8B, 0xAD, 0x2E, 0xBE, 0x03, 0xBD, 0x3D, 0x71, 0x3F, 0xE2, 0x94, 0xFE, 0x83,
-    0xEC, 0x16, 0x10, 0xF3, 0xAE, 0x03, 0x4D, 0xB6, 0x9E, 0xB8, 0x09, 0xBD, 0x2C, 0x63, 0xD4, 0x20,
-    0x0D, 0x76, 0x10, 0x24, 0x5A, 0x6D, 0x57, 0x17, 0x9C, 0xAE, 0x74, 0x7F, 0x90, 0x95, 0x37, 0x78,
-    0x69, 0xD9, 0x27, 0x72, 0xFF, 0x59, 0xCC, 0x08, 0x3C, 0xBA, 0xF5, 0x57, 0xDF, 0x27, 0xBC, 0xFD,
-    0x53, 0x81, 0x92, 0x97, 0x22, 0xEA, 0x8B, 0xB4, 0x73, 0x9C, 0xC6, 0xAD, 0x70, 0x0B, 0xBC, 0x16,
-    0xEE, 0x4D, 0x0C, 0x1D, 0x4B, 0x92, 0xC3, 0x97, 0x94, 0x97, 0x15, 0xBD, 0x76, 0xF0, 0x09, 0xC4,
-    0x43, 0x46, 0x86, 0x11, 0x22, 0x1D, 0x0D, 0x3C, 0x58, 0xE0, 0x46, 0x9C, 0xF4, 0xAC, 0xE7, 0x95,
-    0x43, 0x28, 0x28, 0x9F, 0x8A, 0x33, 0xD6, 0x5C, 0x46, 0x9D, 0x2E, 0x6B, 0xA9, 0x59, 0xF5, 0x6B,
-    0x33, 0x00, 0x91, 0xA7, 0xE2, 0x38, 0x1B, 0xF4, 0x59, 0x49, 0x3F, 0x37, 0xF5, 0xFC, 0xFA, 0x1B,
-    0xD4, 0x74, 0x99, 0x34, 0xB3, 0xC7, 0x42, 0x81, 0xA7, 0x82, 0xDA, 0xB5, 0x57, 0xA9, 0xBD, 0x0A,
-    0xD3, 0x32, 0xBA, 0x92, 0xF5, 0xFF, 0xCE, 0xD5, 0xF4, 0x81, 0x96, 0x78, 0x12, 0x93, 0x88, 0xDC,
-    0xBB, 0x8F, 0xFB, 0x39, 0x43, 0xEC, 0x9E, 0xF1, 0x03, 0x5E, 0xF8, 0xE6, 0x0C, 0x6B, 0x85, 0x46,
-    0xE8, 0x8A, 0xAF, 0x2D, 0xE9, 0x40, 0xBA, 0xC6, 0xA0, 0xE7, 0xB3, 0x9C, 0x76, 0x12, 0xA6, 0x52,
-    0x32, 0xC5, 0x67, 0xBF, 0xE4, 0x7B, 0xFC, 0xC9, 0x79, 0xDA, 0xC7, 0x5E, 0x8E, 0x9F, 0x47, 0x15,
-    0xC0, 0xE9, 0x65, 0xA2, 0xC4, 0x78, 0x52, 0x82, 0x9E, 0xCF, 0x0C, 0xAD, 0x2E, 0xFA, 0x1D, 0x4F,
-    0xA2, 0xDB, 0x98, 0x61, 0x87, 0x85, 0x70, 0xF8, 0xB6, 0x4B, 0xA7, 0x37, 0xF0, 0xBF, 0xBD, 0x89,
-    0xB5, 0x0C, 0x8F, 0x49, 0x41, 0xDB, 0x87, 0x64, 0xD1, 0xF0, 0x41, 0xE4, 0xAA, 0x64, 0xB0, 0xC8,
-    0x0C, 0x19, 0x36, 0x48, 0x19, 0x78, 0xC5, 0xAD, 0x60, 0x13, 0xD0, 0x10, 0xF1, 0xAF, 0x74, 0x0E,
-    0xA4, 0x1F, 0xA0, 0x1D, 0x0C, 0x9E, 0xCC, 0x49, 0x0F, 0xCB, 0xAB, 0xC3, 0x82, 0xE9, 0x48, 0x6C,
-    0x07, 0xB3, 0x82, 0x46, 0x34, 0x35, 0xFC, 0xA2, 0xDB, 0x78, 0x25, 0xD1, 0x29, 0x78, 0xC4, 0x5E,
-    0x21, 0x97, 0x08, 0x5C, 0x46, 0x9C, 0xC8, 0x28, 0xCE, 0xB4, 0x2C, 0x9A, 0xDA, 0x5E, 0x48, 0xEE,
-    0x1D, 0xFC, 0xE6, 0x19, 0x74, 0xCE, 0xA2, 0xA6, 0x67, 0x23, 0xF3, 0xA6, 0xDB, 0x3E, 0x50, 0xDC,
-    0x69, 0xAF, 0x94, 0x88, 0x3C, 0xB9, 0x31, 0xF9, 0x87, 0xD6, 0x82, 0x5F, 0xD8, 0xFF, 0x59, 0xFC,
-    0x2E, 0xBC, 0x0D, 0x7A, 0x0B, 0xFD, 0xDC, 0x78, 0x5B, 0x79, 0x23, 0xBA, 0x74, 0xE2, 0xE9, 0x7E,
-    0x23, 0xC2, 0x3E, 0x18, 0x98, 0x42, 0xE5, 0x68, 0x39, 0x95, 0xBC, 0xAB, 0x62, 0x6F, 0x29, 0xFA,
-    0xBE, 0xBC, 0x00, 0x1D, 0x77, 0xED, 0xEE, 0x92, 0x55, 0xA7, 0xAD, 0x38, 0x2C, 0x1C, 0xFB, 0x92,
-    0x37, 0x65, 0x9D, 0xD5, 0x92, 0x33, 0x65, 0x5D, 0xD4, 0xA6, 0xB6, 0x8E, 0x81, 0x82, 0x52, 0x2E,
-    0x93, 0x90, 0x15, 0xB2, 0x3B, 0xB8, 0x5B, 0xBA, 0x17, 0xFD, 0x32, 0xD1, 0x52, 0xFF, 0xBA, 0x27,
-    0xE6, 0x9E, 0x0C, 0xDC, 0x2F, 0x7B, 0x85, 0xA0, 0x06, 0xCF, 0x49, 0x30, 0x1B, 0x09, 0x64, 0x23,
-    0x2D, 0xC8, 0xCC, 0x41, 0x0D, 0xCF, 0x78, 0x07, 0x53, 0x0F, 0x7E, 0xBF, 0xB2, 0x97, 0xC5, 0x51,
-    0x07, 0x5E, 0x85, 0xBC, 0xD0, 0x47, 0x86, 0x1B, 0xD1, 0xCA, 0x16, 0x08, 0xD4, 0x2A, 0x2C, 0xA9,
-    0x3B, 0x5F, 0x0E, 0x91, 0xAC, 0xC8, 0xFC, 0x96, 0xBB, 0xE8, 0xCA, 0x75, 0xCE, 0x3E, 0x45, 0xD3,
-    0xDE, 0x8C, 0x55, 0xFF, 0xBB, 0x10, 0x2C, 0x30, 0xEB, 0x3B, 0xFF, 0x0F, 0x8C, 0x5A, 0x80, 0xD8,
-    0x05, 0x88, 0x58, 0xD0, 0x71, 0x42, 0xE9, 0x70, 0x42, 0xB7, 0x40, 0xBE, 0x38, 0xC9, 0x97, 0x21,
-    0x70, 0x38, 0x93, 0x9C, 0x39, 0xF5, 0x4F, 0x63, 0x83, 0x31, 0xDD, 0xAE, 0x31, 0xBB, 0x9B, 0x30,
-    0xFE, 0x95, 0x76, 0x96, 0x55, 0xA4, 0x8C, 0x22, 0xDB, 0xB0, 0xAD, 0xF4, 0xEB, 0x05, 0xAF, 0x2B,
-    0xAA, 0x1E, 0x89, 0x82, 0x8B, 0xDE, 0x46, 0xF6, 0x06, 0x5D, 0x01, 0x46, 0xD7, 0x96, 0xE4, 0x7A,
-    0xE5, 0x36, 0x70, 0x98, 0x8D, 0xDF, 0x5E, 0xB8, 0x2E, 0x71, 0xED, 0xD6, 0x7D, 0x64, 0xF3, 0xBD,
-    0x0C, 0xF1, 0x3C, 0x1A, 0xDE, 0x93, 0xBB, 0xFE, 0xC3, 0xD0, 0xE7, 0x2B, 0x57, 0xA3, 0x93, 0xAB,
-    0x7E, 0x55, 0xE3, 0x6B, 0x8A, 0x04, 0x79, 0xA3, 0x0A, 0xFE, 0xFE, 0x5D, 0x46, 0x43, 0xB0, 0x84,
-    0x86, 0xF5, 0x22, 0x83, 0x6A, 0x2F, 0x93, 0xCB, 0xDF, 0x66, 0xCC, 0xDA, 0x69, 0x70, 0x6D, 0x70,
-    0x6A, 0x6D, 0x5C, 0x49, 0xF9, 0x98, 0x0C, 0xC1, 0x9F, 0x91, 0x74, 0x1B, 0x6A, 0x7B, 0xB2, 0x1B,
-    0x97, 0x8C, 0x2A, 0x2E, 0x2C, 0xE4, 0x40, 0x36, 0x4E, 0x4B, 0xEB, 0xE4, 0xE4, 0xE4, 0x9A, 0x09,
-    0x40, 0x99, 0x60, 0xAB, 0xD1, 0xA1, 0x45, 0xAF, 0x9B, 0xFF, 0x34, 0xDC, 0x09, 0xF4, 0xB8, 0xC2,
-    0x46, 0xED, 0xCC, 0xE5, 0x89, 0xC7, 0x35, 0x74, 0xBA, 0x52, 0xF8, 0x14, 0x4A, 0x4D, 0x1D, 0xF3,
-    0x7D, 0x72, 0xE6, 0xFB, 0x44, 0xDF, 0x64, 0xCC, 0xD8, 0x51, 0xE6, 0x39, 0x92, 0x91, 0xA9, 0xA9,
-    0xF6, 0x8C, 0x87, 0x4C, 0xBC, 0x9E, 0xE8, 0xBF, 0x02, 0xA3, 0x66, 0x22, 0x26, 0x7C, 0x6B, 0x74,
-    0x6A, 0xAF, 0xAC, 0x5D, 0xCB, 0x5B, 0xBB, 0x8D, 0x15, 0x4A, 0xF7, 0x2A, 0x31, 0xBA, 0x5B, 0x56,
-    0xD9, 0x6D, 0x74, 0xB8, 0xA8, 0x8A, 0x1F, 0xAA, 0x75, 0xDF, 0xF2, 0xB6, 0xF5, 0x90, 0xBD, 0xE8,
-    0x52, 0xDF, 0xED, 0x3E, 0x7B, 0x79, 0xF0, 0x32, 0xCB, 0xB7, 0xAF, 0x74, 0x19, 0xBA, 0x9E, 0xBD,
-    0xDA, 0x16, 0x7B, 0xB4, 0xB7, 0x6B, 0x6F, 0xB0, 0x27, 0x6D, 0xE6, 0xA5, 0x87, 0x9F, 0x99, 0xC6,
-    0xEF, 0x23, 0x0E, 0x24, 0xF3, 0xC2, 0x55, 0x2D, 0x23, 0x8E, 0x75, 0xDA, 0xC3, 0xA5, 0x51, 0xEC,
-    0x41, 0xC3, 0xD9, 0x4C, 0xC9, 0xCC, 0x93, 0x51, 0x13, 0xB2, 0x9C, 0x2A, 0x26, 0x67, 0x6D, 0x19,
-    0x29, 0x87, 0xDD, 0xC2, 0x55, 0x74, 0xEB, 0xA6, 0x33, 0x2D, 0x43, 0xF9, 0x75, 0x4A, 0x52, 0xF0,
-    0xD6, 0x4B, 0x49, 0xE3, 0x4A, 0x86, 0x95, 0xCC, 0x49, 0x99, 0x92, 0x32, 0xA6, 0x64, 0x42, 0xCA,
-    0x7C, 0x94, 0xD9, 0x44, 0xF6, 0xF0, 0xCF, 0xEF, 0xC8, 0xD7, 0x51, 0x31, 0x50, 0x47, 0xEF, 0x3F,
-    0xD6, 0xB6, 0x1B, 0x4A, 0xEC, 0xF0, 0x1D, 0x55, 0x34, 0x4F, 0xA0, 0xB0, 0x68, 0x9D, 0x18, 0x36,
-    0xAE, 0x29, 0xAD, 0x3A, 0x06, 0x4C, 0xB8, 0x74, 0xF9, 0xEA, 0x34, 0xC8, 0x7A, 0xBF, 0x9E, 0x4B,
-    0xA8, 0x4B, 0x4B, 0xD3, 0x2C, 0x2B, 0xF6, 0x39, 0x07, 0x9D, 0xE9, 0xBC, 0x13, 0xBF, 0xBA, 0x26,
-    0x45, 0x28, 0xF5, 0x22, 0xA3, 0x78, 0x89, 0x3C, 0xF4, 0x55, 0xE6, 0x56, 0xDC, 0xD4, 0x0C, 0xDD,
-    0xC4, 0x8C, 0xC3, 0x9B, 0xB6, 0x00, 0xBB, 0xCE, 0x95, 0xCB, 0x26, 0x3D, 0x48, 0x7B, 0x2A, 0x64,
-    0x39, 0x98, 0x19, 0x17, 0xF7, 0x96, 0x5F, 0x68, 0x7B, 0x6A, 0xEC, 0x0F, 0x77, 0x93, 0xA5, 0x2B,
-    0xD4, 0xA6, 0x7E, 0x14, 0x8A, 0xB9, 0x2C, 0xAE, 0x2D, 0x3D, 0x09, 0x56, 0x1D, 0xC2, 0x1F, 0xEB,
-    0x2E, 0x28, 0xC5, 0xE8, 0xFA, 0x5D, 0xBA, 0x11, 0xA0, 0xC4, 0x28, 0x62, 0xA4, 0x2D, 0x3A, 0x3E,
-    0xD1, 0x5C, 0x5C, 0x9D, 0x99, 0xE9, 0x25, 0x97, 0xBE, 0x02, 0x39, 0xF2, 0x3D, 0x41, 0xA8, 0x7B,
-    0x51, 0x03, 0x25, 0x46, 0x71, 0xA3, 0x95, 0x45, 0x04, 0xA0, 0x38, 0xAF, 0x1C, 0xB4, 0x6A, 0x3F,
-    0x84, 0x6B, 0x17, 0xDB, 0x1B, 0x17, 0xE5, 0x33, 0x78, 0x69, 0x76, 0x87, 0xFB, 0x94, 0x92, 0x15,
-    0x6E, 0x5C, 0xAC, 0x94, 0xE1, 0xA6, 0xA7, 0xCB, 0x7E, 0x41, 0x67, 0xE5, 0x7B, 0xF8, 0x4A, 0xC7,
-    0xAC, 0x52, 0x0A, 0x73, 0xDA, 0x93, 0x89, 0xCB, 0xBF, 0x8A, 0x49, 0xEA, 0xC4, 0xD8, 0x96, 0x5C,
-    0x01, 0xC5, 0x28, 0xD1, 0xAF, 0xE4, 0xD7, 0x6F, 0x44, 0xD7, 0xB7, 0x98, 0xA1, 0x76, 0x0D, 0x81,
-    0xF8, 0x2A, 0xC6, 0xD4, 0x71, 0x96, 0x0A, 0x3F, 0x20, 0xCC, 0x93, 0x2B, 0x07, 0x3F, 0x53, 0x1B,
-    0xD7, 0xC4, 0xBE, 0xF5, 0x92, 0x64, 0x8F, 0x99, 0xDF, 0xAD, 0x91, 0xD6, 0xC1, 0x75, 0x9B, 0xA3,
-    0xDD, 0x72, 0x8A, 0xA4, 0xAB, 0x82, 0x8F, 0x28, 0x05, 0x74, 0xE3, 0xC4, 0xF6, 0x34, 0x73, 0xBE,
-    0xED, 0x45, 0x5A, 0xF1, 0x42, 0x0A, 0x66, 0x4E, 0x98, 0xE6, 0x0E, 0xDA, 0x8E, 0x16, 0x2F, 0x7F,
-    0xE9, 0x37, 0x08, 0x7F, 0x89, 0x7D, 0x73, 0xC5, 0xB3, 0x9C, 0x13, 0x5A, 0xA2, 0x62, 0x51, 0xCA,
-    0x0F, 0x56, 0x04, 0xCE, 0x52, 0x4C, 0x63, 0xC5, 0x2D, 0xC4, 0x2B, 0x7C, 0x43, 0x2B, 0x67, 0x33,
-    0x50, 0x1D, 0xDC, 0x0C, 0x9C, 0x87, 0xF5, 0x10, 0xCB, 0xFF, 0x66, 0xA9, 0x0E, 0x99, 0xD2, 0x88,
-    0x32, 0xB9, 0x6D, 0xCB, 0xDD, 0xE4, 0xB6, 0x5D, 0x5A, 0x4E, 0x59, 0x70, 0x00, 0xCA, 0x0D, 0xE0,
-    0xE4, 0x03, 0x90, 0x8C, 0x36, 0xFF, 0x92, 0x25, 0xE5, 0xC9, 0x01, 0xC9, 0x90, 0x67, 0x14, 0x3D,
-    0xE6, 0x2C, 0xF9, 0xBA, 0x3D, 0xEB, 0xC4, 0x9D, 0xFC, 0x08, 0x97, 0x9F, 0x3B, 0xC7, 0x7F, 0x96,
-    0x8C, 0xFE, 0xB3, 0xD9, 0x9A, 0xC8, 0xEA, 0x99, 0xBB, 0xE1, 0x32, 0x55, 0xCE, 0x65, 0xF0, 0xB0,
-    0x6B, 0x4B, 0x93, 0x67, 0x28, 0xE1, 0xC3, 0xEF, 0x9A, 0x97, 0xDC, 0x53, 0xD0, 0x17, 0x91, 0xB4,
-    0x50, 0x91, 0x15, 0x79, 0x8A, 0xB6, 0x68, 0xF6, 0x85, 0x37, 0xAD, 0xA8, 0x5A, 0x6E, 0x60, 0x0F,
-    0x94, 0x35, 0xA8, 0x85, 0x06, 0xDE, 0xED, 0xB2, 0x4E, 0xC0, 0xFA, 0xD1, 0x78, 0x22, 0x17, 0x6D,
-    0xDA, 0x26, 0xF0, 0xBE, 0x65, 0xEF, 0x9A, 0xCD, 0xEA, 0x1A, 0x79, 0x92, 0x77, 0x66, 0xFD, 0xF2,
-    0xED, 0xBB, 0x89, 0x12, 0xE6, 0x7C, 0x5E, 0xDC, 0x3F, 0xD7, 0xCB, 0x1A, 0x55, 0xAA, 0x40, 0x9D,
-    0xF2, 0xFF, 0x9A, 0xAB, 0x0F, 0x0D, 0xEC, 0x36, 0x0B, 0xEB, 0xAE, 0xDC, 0x37, 0xE4, 0xDE, 0xFF,
-    0x2E, 0x1F, 0xE0, 0x7E, 0x38, 0x48, 0x15, 0x9A, 0x7B, 0xC7, 0x33, 0xBD, 0x30, 0xD5, 0x2B, 0x8A,
-    0xE0, 0x6F, 0xAF, 0x46, 0xE6, 0x17, 0xFC, 0xBF, 0x69, 0xA7, 0x3C, 0xEF, 0x26, 0x93, 0x95, 0xA4,
-    0xEC, 0x2D, 0x9A, 0x55, 0x31, 0x0D, 0x75, 0xD9, 0xE8, 0x3F, 0x6F, 0x31, 0x5F, 0x53, 0xCC, 0xBF,
-    0x6B, 0x39, 0x72, 0x10, 0xF3, 0x60, 0xBE, 0x5E, 0xB6, 0x18, 0x53, 0xF6, 0x62, 0x7E, 0xD3, 0x4F,
-    0x2B, 0x23, 0x9E, 0xF3, 0x8B, 0xB0, 0x78, 0x2E, 0x5D, 0xF3, 0xFF, 0xF2, 0xB5, 0x89, 0xB9, 0xE8,
-    0xB3, 0x96, 0x6C, 0x90, 0x3B, 0x89, 0x02, 0x9B, 0x66, 0x17, 0xA4, 0xAC, 0x37, 0x3E, 0xBC, 0x29,
-    0x5B, 0xB8, 0x52, 0x4A, 0x74, 0x85, 0x35, 0xE3, 0xB7, 0xEB, 0xEB, 0x5E, 0x68, 0x9E, 0x1E, 0x07,
-    0x4A, 0x0E, 0x93, 0xD9, 0x71, 0x21, 0x29, 0x16, 0x27, 0xCA, 0x59, 0xCA, 0xE5, 0x27, 0x5D, 0x3B,
-    0xB3, 0xAB, 0xB5, 0xCF, 0xF5, 0xFB, 0x84, 0x86, 0xA3, 0x76, 0x7A, 0xD8, 0xFF, 0x51, 0xD8, 0xF8,
-    0x51, 0xD8, 0xF9, 0x51, 0xD8, 0xFA, 0x76, 0x43, 0xCD, 0x9F, 0x72, 0xAB, 0xB6, 0xFF, 0x0D, 0x0A,
-    0x07, 0xF5, 0x8F, 0x66, 0xE9, 0x6A, 0xA5, 0x35, 0xAD, 0x11, 0x60, 0xA8, 0x48, 0xBA, 0xA6, 0x90,
-    0xF1, 0x51, 0xBA, 0x81, 0x76, 0x6B, 0x9F, 0xB9, 0x4E, 0x06, 0x64, 0xEA, 0xDE, 0xA6, 0xAE, 0xB3,
-    0xDB, 0xB8, 0xAF, 0x99, 0x19, 0x79, 0x6D, 0xD2, 0xDB, 0x3E, 0x74, 0xA3, 0x78, 0x53, 0xA3, 0x90,
-    0x37, 0x92, 0xA3, 0xE8, 0x35, 0x8A, 0xBA, 0xEC, 0x34, 0x8A, 0x2D, 0x18, 0x1C, 0x47, 0x91, 0x04,
-    0x4F, 0xE4, 0xB8, 0x06, 0x46, 0x3F, 0x64, 0x56, 0x9F, 0xF1, 0x47, 0x42, 0x3F, 0xB2, 0xB0, 0x1B,
-    0xAF, 0x03, 0x77, 0x06, 0x26, 0xF6, 0xC9, 0xF2, 0xAC, 0xE4, 0x69, 0x4F, 0xA2, 0x43, 0x8F, 0x93,
-    0xD5, 0xB4, 0xDC, 0xBD, 0x6E, 0xCA, 0x59, 0xA5, 0xCC, 0xB5, 0xF1, 0x4A, 0xA5, 0x8D, 0x79, 0x53,
-    0xEE, 0x6E, 0x29, 0x9F, 0x4F, 0x17, 0xC9, 0x14, 0x84, 0x9C, 0x19, 0x2B, 0x43, 0xA0, 0xE7, 0x8B,
-    0xEA, 0x51, 0x70, 0xCF, 0x06, 0xE7, 0x6C, 0x70, 0xCD, 0x06, 0x7F, 0x7A, 0xF0, 0xA6, 0xCB, 0xE5,
-    0x72, 0x45, 0xAE, 0x76, 0x3A, 0xCA, 0xC4, 0x7D, 0x72, 0xA8, 0x3D, 0x58, 0xBE, 0x50, 0x7C, 0x86,
-    0x17, 0x28, 0x1B, 0xA8, 0x9E, 0x9A, 0xF2, 0xC3, 0x16, 0xEA, 0x8F, 0x51, 0x7E, 0x47, 0xF5, 0x95,
-    0xB6, 0x92, 0x1F, 0xFF, 0x4D, 0x6F, 0x29, 0xC9, 0x74, 0x57, 0x9D, 0x00, 0xB2, 0x09, 0xB6, 0xE0,
-    0x63, 0x37, 0x56, 0x93, 0x1D, 0xA9, 0xFE, 0xDE, 0x2F, 0x94, 0x78, 0x25, 0x97, 0x71, 0xCC, 0x14,
-    0x34, 0x16, 0x0F, 0xA4, 0xC3, 0x37, 0x5D, 0xCD, 0x5D, 0x1E, 0x76, 0x1F, 0x2F, 0x5E, 0xAC, 0x75,
-    0xBE, 0x7F, 0x34, 0xDE, 0x13, 0x31, 0x66, 0x29, 0xA3, 0xC1, 0x94, 0x7C, 0xF4, 0x0E, 0x39, 0xD4,
-    0x4E, 0x6E, 0x04, 0x89, 0xE6, 0x3B, 0xE5, 0x10, 0xFC, 0x71, 0xA3, 0x2D, 0x75, 0xE5, 0xCB, 0x2A,
-    0x36, 0xB2, 0x0B, 0xE7, 0xE6, 0xF4, 0xE6, 0x18, 0xD8, 0xA4, 0x16, 0xE0, 0x79, 0xD9, 0xEF, 0x2D,
-    0xE8, 0xD9, 0x50, 0x04, 0xB8, 0xD2, 0xD4, 0xA7, 0x14, 0x16, 0x27, 0x66, 0x36, 0x5C, 0xA6, 0x67,
-    0x11, 0x35, 0x17, 0x2C, 0xC6, 0x59, 0x49, 0x76, 0xD4, 0x2A, 0x2D, 0xF2, 0x56, 0x2A, 0x94, 0x32,
-    0xC8, 0x8A, 0x4E, 0xF1, 0x06, 0x56, 0x8F, 0x2D, 0xE5, 0x92, 0xF0, 0x53, 0xFE, 0x96, 0x4D, 0xBD,
-    0xB3, 0x1A, 0x0C, 0x9A, 0x88, 0x15, 0x44, 0xC2, 0x96, 0x9B, 0xE8, 0x05, 0xB2, 0x49, 0x28, 0x03,
-    0xF0, 0x62, 0x21, 0x89, 0x03, 0x3C, 0x95, 0x32, 0x85, 0xAC, 0x11, 0xF2, 0x9C, 0xFA, 0x23, 0x45,
-    0x09, 0x8B, 0x40, 0x34, 0x57, 0xB4, 0x09, 0x99, 0x6C, 0xDC, 0xCE, 0xD3, 0xD6, 0x17, 0x27, 0x5E,
-    0x79, 0xC6, 0x90, 0x83, 0x47, 0x33, 0x31, 0x87, 0xE4, 0x29, 0x12, 0x9F, 0xDA, 0xC5, 0x64, 0x44,
-    0xD4, 0x2A, 0x8C, 0x60, 0xC4, 0xAC, 0xFF, 0xB2, 0xF9, 0x81, 0x15, 0x6F, 0x24, 0x85, 0x07, 0xA5,
-    0xDE, 0x41, 0x25, 0x62, 0x8E, 0x4C, 0xAB, 0x70, 0x8C, 0x02, 0xFF, 0xD8, 0xD6, 0x6E, 0xCB, 0x6E,
-    0xD0, 0xC6, 0x91, 0x1A, 0xB1, 0x3C, 0x1D, 0xB3, 0x97, 0xA9, 0x17, 0x70, 0x8F, 0xC5, 0xB8, 0xAC,
-    0xD9, 0xC9, 0xD1, 0x05, 0xFA, 0x0B, 0x75, 0x3E, 0x28, 0x5A, 0xD9, 0x24, 0x3B, 0x6F, 0xAC, 0xCA,
-    0x40, 0xE1, 0x65, 0x1F, 0xAD, 0xEB, 0x64, 0x3B, 0x77, 0xC9, 0xFE, 0x42, 0x7B, 0xB5, 0x3C, 0x3D,
-    0xF2, 0xAC, 0x2F, 0x6F, 0xBA, 0xD3, 0x9C, 0xEA, 0x48, 0xC5, 0xA9, 0xDB, 0x5A, 0xE2, 0xF1, 0x51,
-    0xE6, 0xEE, 0x63, 0xF0, 0x26, 0xFD, 0x98, 0xF9, 0x88, 0x6F, 0xD1, 0x34, 0x18, 0x33, 0x6D, 0x22,
-    0x2A, 0x9C, 0x39, 0xD9, 0x66, 0xBE, 0x0A, 0xA6, 0xC1, 0xE8, 0x56, 0x9F, 0x9B, 0x06, 0x26, 0x81,
-    0x87, 0x0B, 0x25, 0xB0, 0xF2, 0xB1, 0x8A, 0xD1, 0x28, 0x38, 0x27, 0x43, 0x98, 0xBB, 0xDD, 0x77,
-    0x9A, 0x21, 0x41, 0x6D, 0x3D, 0xE9, 0x89, 0xED, 0xA4, 0xC8, 0x44, 0x8F, 0xA1, 0x48, 0x87, 0x16,
-    0x30, 0xBE, 0x4F, 0xB6, 0x40, 0x31, 0x9D, 0xD4, 0xF3, 0xAA, 0xDA, 0x5F, 0xAC, 0x43, 0x6E, 0x71,
-    0xF3, 0x0D, 0x4B, 0xC8, 0x2C, 0x2C, 0xBF, 0x04, 0x0E, 0xDA, 0x12, 0x0B, 0xFA, 0x21, 0x3A, 0xD5,
-    0xE7, 0xF9, 0x13, 0xD6, 0x1F, 0x5E, 0xB6, 0xC8, 0x71, 0xCF, 0xCD, 0xAB, 0x33, 0x4E, 0x76, 0xD1,
-    0x2F, 0x6A, 0x71, 0x90, 0xD4, 0x8C, 0x25, 0x26, 0x88, 0x6D, 0x6D, 0x9E, 0x2F, 0xC3, 0xD5, 0x5A,
-    0x58, 0x1A, 0x14, 0x2D, 0x1E, 0xFF, 0x91, 0xFF, 0xF6, 0x1D, 0x70, 0xA1, 0x4F, 0x88, 0x15, 0x6D,
-    0xC4, 0xE0, 0x1B, 0xEE, 0x3A, 0x46, 0xBC, 0x76, 0x56, 0x7D, 0x28, 0x5A, 0x96, 0xF3, 0x81, 0x35,
-    0x70, 0x1A, 0x92, 0x17, 0x70, 0x5F, 0x73, 0x9D, 0x5C, 0x67, 0x2A, 0xF8, 0x49, 0xC8, 0x76, 0xD8,
-    0xF4, 0xE2, 0x71, 0x50, 0xAB, 0xA1, 0x96, 0xAC, 0x9B, 0x99, 0x80, 0xBB, 0x2A, 0x81, 0xC7, 0xA2,
-    0xC2, 0x7A, 0x2C, 0x2A, 0xC4, 0x8C, 0x2E, 0xC7, 0xA2, 0xC2, 0xED, 0x58, 0x54, 0xB8, 0x79, 0x8F,
-    0xFA, 0x44, 0x2C, 0x48, 0xCA, 0xCE, 0x4F, 0x2D, 0x3C, 0x8F, 0x8D, 0x77, 0x91, 0xBB, 0xEE, 0xFB,
-    0x93, 0xE1, 0xBF, 0x2A, 0xFA, 0x76, 0x92, 0x9F, 0xFF, 0xCE, 0xF7, 0x2A, 0x64, 0x8C, 0x0E, 0x0A,
-    0x19, 0x0F, 0xDE, 0xD9, 0x1E, 0xD6, 0x44, 0x06, 0x76, 0x47, 0x2E, 0x83, 0x71, 0x2C, 0xC6, 0xCC,
-    0x96, 0xA8, 0x38, 0xC8, 0x13, 0x65, 0x56, 0xC4, 0x79, 0x49, 0x2D, 0xC9, 0x45, 0xD5, 0x87, 0x53,
-    0xCA, 0x4C, 0xF9, 0xD3, 0xA7, 0xCC, 0xC0, 0xA9, 0xF4, 0x2F, 0x19, 0xED, 0x50, 0xE1, 0x31, 0x52,
-    0xC4, 0xB8, 0x48, 0xEF, 0x48, 0x64, 0xC2, 0x1D, 0xA4, 0x04, 0xA4, 0xD6, 0xEC, 0x92, 0xC6, 0xB2,
-    0x27, 0xEB, 0x59, 0xEB, 0x9F, 0x5C, 0xEE, 0xA5, 0xF3, 0xCB, 0x61, 0xE9, 0x0D, 0x8F, 0xEF, 0x5D,
-    0x83, 0x76, 0xBB, 0xB0, 0xFC, 0x7E, 0x7D, 0x33, 0x6D, 0x57, 0x34, 0x69, 0xA0, 0x28, 0xFF, 0x7D,
-    0xD9, 0x7B, 0x6A, 0xAF, 0x68, 0x53, 0x96, 0x7B, 0xA9, 0x65, 0x30, 0x3C, 0x23, 0x18, 0xA2, 0x15,
-    0x65, 0xCC, 0xE3, 0x34, 0x40, 0xB3, 0x8E, 0xEB, 0xF1, 0xEF, 0x5C, 0x6B, 0xF9, 0x55, 0xB5, 0x19,
-    0x45, 0x74, 0x8E, 0x26, 0x7E, 0x4D, 0x91, 0xC4, 0x27, 0xE6, 0x92, 0x61, 0x3E, 0x73, 0x6D, 0xCC,
-    0xBD, 0x56, 0x34, 0x4C, 0x71, 0x18, 0xB5, 0xE4, 0xFC, 0x3B, 0xCB, 0xDC, 0xAD, 0x36, 0x4A, 0x06,
-    0xAD, 0xE2, 0x31, 0x29, 0xD4, 0x8D, 0xB9, 0xF5, 0x91, 0xE5, 0xD6, 0x57, 0x96, 0x5B, 0xBF, 0x87,
-    0x11, 0xE3, 0x25, 0x13, 0x78, 0x2C, 0x15, 0x02, 0xB8, 0x6B, 0xA0, 0x06, 0xCA, 0x61, 0xE3, 0x45,
-    0x6C, 0xA7, 0x1C, 0x58, 0x30, 0x28, 0x2F, 0x6D, 0x25, 0x7C, 0x14, 0x0C, 0x25, 0x57, 0x65, 0x95,
-    0xAC, 0x25, 0xF3, 0x70, 0x87, 0xFF, 0xEC, 0xBC, 0xB5, 0x7C, 0xBF, 0xBC, 0xF5, 0x7D, 0x58, 0x37,
-    0x67, 0x79, 0xEB, 0xF2, 0x54, 0x19, 0x32, 0xF9, 0x18, 0xD6, 0x96, 0x76, 0x6A, 0x56, 0x75, 0x74,
-    0x58, 0x36, 0xFE, 0x4B, 0x76, 0x65, 0x22, 0x9C, 0x11, 0x76, 0x61, 0xDA, 0x4C, 0xD5, 0x82, 0x2B,
-    0x2A, 0xC7, 0x8B, 0xE1, 0xA8, 0xB7, 0x1F, 0x06, 0xE7, 0x6F, 0x94, 0xED, 0x58, 0xEA, 0x97, 0xED,
-    0xAC, 0xCE, 0x89, 0xFD, 0x4E, 0x9C, 0x45, 0x01, 0x8C, 0xCC, 0x72, 0x29, 0xCC, 0xEA, 0x57, 0x3F,
-    0x86, 0x0E, 0x94, 0x0F, 0xC5, 0x6C, 0xFC, 0x39, 0xFB, 0xDC, 0x4C, 0xEB, 0x5C, 0x57, 0x8B, 0xE7,
-    0x70, 0x7C, 0x4F, 0xA2, 0xD7, 0x8F, 0x3D, 0x87, 0x0E, 0x2C, 0x4E, 0xB7, 0x99, 0x25, 0xF9, 0x57,
-    0xF2, 0xE2, 0xFA, 0x3E, 0xAB, 0x98, 0x47, 0x49, 0x4F, 0x9C, 0x1E, 0xE6, 0x94, 0x76, 0x96, 0xA3,
-    0xAB, 0xCF, 0x97, 0x21, 0x81, 0x06, 0x3E, 0x48, 0x26, 0x53, 0xD0, 0x07, 0x19, 0x4C, 0x4C, 0xCB,
-    0x38, 0x5D, 0x39, 0x73, 0xFF, 0x6E, 0x5C, 0xA3, 0xC4, 0xA1, 0xD8, 0x82, 0xAD, 0x75, 0xAA, 0xFC,
-    0x08, 0x6F, 0x92, 0x38, 0x56, 0x96, 0x14, 0xDE, 0xFA, 0x64, 0xB1, 0x49, 0xD1, 0xB8, 0x9B, 0x2D,
-    0xE5, 0xE0, 0x1D, 0x97, 0x76, 0x10, 0x18, 0xD9, 0xBD, 0x21, 0xE9, 0xC4, 0xE5, 0xFB, 0xC4, 0x04,
-    0x78, 0xA7, 0xA2, 0x8F, 0x04, 0x5F, 0x96, 0x74, 0xF0, 0xEF, 0x60, 0x9C, 0x0F, 0xE5, 0x45, 0x8A,
-    0xFC, 0x57, 0x2B, 0x63, 0xF4, 0x5B, 0xCD, 0xA8, 0xF6, 0xF6, 0xC9, 0x55, 0xF2, 0x3D, 0xEC, 0x68,
-    0xF3, 0xE5, 0xD1, 0x1D, 0xBE, 0xB4, 0xD6, 0xCF, 0x16, 0x39, 0xF1, 0xDA, 0x89, 0x23, 0x33, 0x72,
-    0xB0, 0x62, 0x4D, 0x12, 0x72, 0xC7, 0x90, 0x20, 0x56, 0xC0, 0x62, 0x26, 0x97, 0x49, 0xF9, 0x25,
-    0x78, 0xDB, 0x2B, 0x56, 0x40, 0x38, 0xF7, 0x3D, 0x6C, 0xEF, 0x77, 0x5D, 0xF9, 0x7D, 0x98, 0x3A,
-    0x3F, 0x19, 0x8A, 0xB7, 0x06, 0xF6, 0x36, 0xC3, 0x72, 0xF3, 0x9D, 0xA5, 0xC4, 0xF2, 0x7D, 0x4D,
-    0xB9, 0xA0, 0x61, 0x85, 0x51, 0x3D, 0xD9, 0xC6, 0xB2, 0xAC, 0xE6, 0x6E, 0xD9, 0x51, 0x86, 0x5E,
-    0xBA, 0xDE, 0x9F, 0x30, 0xE7, 0x6D, 0x47, 0x67, 0xC9, 0xA8, 0x1D, 0x6F, 0xE7, 0x32, 0xF4, 0xEF,
-    0xAF, 0x62, 0x65, 0x0F, 0xF2, 0xC2, 0xAD, 0x14, 0xE3, 0x75, 0x88, 0xB7, 0x7D, 0xAE, 0xF4, 0x2A,
-    0xB5, 0x37, 0x33, 0xB8, 0xF2, 0xB8, 0xF6, 0xB8, 0xF4, 0xB0, 0xEC, 0x7A, 0x16, 0xD9, 0xA5, 0xC3,
-    0x4D, 0xB8, 0x7A, 0xBC, 0x88, 0x0A, 0x8F, 0x67, 0xF0, 0xF7, 0x06, 0x5D, 0xE5, 0x5C, 0x2F, 0xD9,
-    0x8B, 0xE6, 0xDD, 0x7A, 0x45, 0x7B, 0xA7, 0xFC, 0xA1, 0xB6, 0x12, 0x5C, 0xB1, 0x94, 0x50, 0x9D,
-    0x49, 0x2A, 0xDA, 0x3B, 0x50, 0x17, 0x56, 0x2A, 0x8E, 0xF0, 0x13, 0xF0, 0x67, 0x37, 0x94, 0x4A,
-    0xC0, 0x40, 0xFD, 0x16, 0xE2, 0xA1, 0xE2, 0x4E, 0x50, 0x56, 0x4C, 0xEC, 0xBE, 0x04, 0xA3, 0x5D,
-    0x69, 0xDF, 0xDA, 0x15, 0xF4, 0x00, 0x72, 0xC7, 0x33, 0x7D, 0xCB, 0xAF, 0x9A, 0x54, 0x55, 0xF2,
-    0x15, 0x73, 0x0E, 0x65, 0x76, 0xB3, 0x7C, 0x85, 0x3A, 0x92, 0x39, 0xFA, 0x16, 0xD7, 0xCE, 0xA6,
-    0x7F, 0x0C, 0x79, 0xC8, 0xFE, 0x68, 0x42, 0xF2, 0x47, 0xA3, 0xF8, 0xA8, 0x53, 0xE6, 0x7B, 0xE1,
-    0x6E, 0x95, 0x4C, 0x52, 0xF4, 0x0F, 0xBB, 0x5C, 0x59, 0x06, 0xB5, 0x25, 0x6F, 0x56, 0x12, 0x5D,
-    0x1B, 0x73, 0xE1, 0xA9, 0xF8, 0x09, 0x49, 0x1F, 0xD7, 0x87, 0x93, 0x93, 0x3C, 0x94, 0xC4, 0x57,
-    0xE1, 0x66, 0x1B, 0x6E, 0xF2, 0x50, 0x24, 0x8F, 0xF1, 0xFF, 0xA0, 0xBC, 0x03, 0x9F, 0x87, 0x27,
-    0x80, 0x92, 0x76, 0xB4, 0xB7, 0xE4, 0x7C, 0xD4, 0x4D, 0x28, 0x6A, 0x0B, 0x49, 0x1F, 0x14, 0xA9,
-    0xDE, 0xEC, 0xF3, 0xD6, 0x1C, 0x7B, 0xFA, 0xA6, 0x57, 0xFB, 0x92, 0xDE, 0xB2, 0x65, 0xAC, 0x36,
-    0x7E, 0x3F, 0x4B, 0x66, 0x62, 0x54, 0x35, 0x14, 0xEF, 0x50, 0x8D, 0x00, 0x5B, 0x85, 0xC6, 0x3F,
-    0xB3, 0x62, 0x05, 0x0A, 0x52, 0xAF, 0x0C, 0x10, 0x64, 0xE3, 0xEE, 0x32, 0xEB, 0x3F, 0x71, 0xF9,
-    0x43, 0x11, 0x8D, 0x6B, 0x99, 0x1D, 0x85, 0xB4, 0xA5, 0x5B, 0xD4, 0xC3, 0xCD, 0x73, 0x6B, 0xAD,
-    0x65, 0xCE, 0x93, 0xAC, 0xA7, 0xEE, 0xD6, 0xF3, 0x68, 0xA5, 0xAD, 0x70, 0x86, 0xA2, 0x91, 0x47,
-    0x93, 0x9A, 0xED, 0x65, 0xE6, 0x7C, 0x96, 0xAC, 0x0A, 0xEA, 0x54, 0x14, 0x2D, 0x5F, 0x09, 0x3C,
-    0x4F, 0xFE, 0x15, 0xC3, 0x14, 0xE0, 0xE5, 0x2B, 0x8D, 0x26, 0xAD, 0x32, 0x5E, 0x5B, 0x71, 0x5D,
-    0x03, 0x37, 0xD1, 0xCA, 0xBB, 0xC7, 0xC6, 0xBD, 0x26, 0xBC, 0x90, 0xEF, 0x2A, 0x21, 0xEC, 0xF3,
-    0x3D, 0x09, 0xB7, 0x92, 0x8B, 0x70, 0x65, 0xFE, 0x5F, 0x67, 0x55, 0x8F, 0x51, 0x50, 0x31, 0x94,
-    0xE4, 0xEE, 0x3F, 0x7F, 0xF3, 0x1E, 0x35, 0xE1, 0xF4, 0x5D, 0x66, 0xE2, 0x65, 0x6F, 0xC3, 0x55,
-    0xD7, 0xF9, 0x06, 0x02, 0xB9, 0xD8, 0x93, 0x2B, 0x95, 0x7B, 0x4A, 0x7C, 0xB7, 0x63, 0xE2, 0x1A,
-    0x76, 0x35, 0xDC, 0xBE, 0x55, 0xB9, 0x43, 0xC6, 0xD7, 0xB6, 0xDC, 0x27, 0x5E, 0x06, 0xF9, 0x06,
-    0xFE, 0x88, 0x9C, 0x2C, 0xF5, 0x0A, 0x17, 0x9E, 0x53, 0x26, 0xF7, 0x30, 0x66, 0xF2, 0x6E, 0xC4,
-    0x94, 0x7A, 0xFA, 0xBA, 0x1A, 0x56, 0xCB, 0xD4, 0x5C, 0x24, 0x3B, 0x42, 0x46, 0xDC, 0xB2, 0x08,
-    0x55, 0xC5, 0x9D, 0x50, 0x19, 0xE2, 0x43, 0x76, 0xCF, 0x15, 0xFB, 0xA8, 0x78, 0x87, 0x7A, 0xFE,
-    0xF7, 0x07, 0x44, 0x25, 0xBF, 0xDB, 0xA3, 0x88, 0xE4, 0x0B, 0x5D, 0xDA, 0xF8, 0x7D, 0xEB, 0xAF,
-    0x49, 0x17, 0x77, 0x49, 0x9B, 0xB5, 0x09, 0x1C, 0x06, 0x02, 0x39, 0x51, 0x65, 0x0E, 0x0B, 0x6A,
-    0x94, 0xEE, 0x88, 0xF9, 0x60, 0x9E, 0x27, 0x6E, 0x98, 0x82, 0xAB, 0x74, 0x71, 0x16, 0x57, 0x45,
-    0x62, 0xED, 0x10, 0x0A, 0x64, 0xE4, 0x99, 0x8A, 0x0F, 0x13, 0xD8, 0xED, 0x8A, 0x56, 0xA5, 0x50,
-    0xF8, 0xDE, 0x3D, 0x29, 0x29, 0xC7, 0x8F, 0x20, 0x20, 0xDA, 0xE9, 0x66, 0x11, 0xF2, 0x12, 0x51,
-    0x6E, 0x3B, 0xB8, 0x1F, 0x5A, 0xC6, 0xAC, 0x7B, 0x95, 0x09, 0xC2, 0xC5, 0xDB, 0xA8, 0xC3, 0x81,
-    0x83, 0xFF, 0x6F, 0xDD, 0x17, 0x60, 0x25, 0x42, 0x5D, 0xFA, 0x02, 0xFC, 0x69, 0xF0, 0x9F, 0xAF,
-    0x07, 0x22, 0xFC, 0xAC, 0x78, 0xD3, 0xC7, 0xC3, 0x1A, 0x85, 0x60, 0x28, 0x3F, 0xDC, 0xF4, 0x2B,
-    0x84, 0xF7, 0x8A, 0x36, 0xE6, 0x4D, 0xEB, 0x99, 0x02, 0x82, 0x05, 0x5E, 0x12, 0xEC, 0xE0, 0xB5,
-    0xC9, 0xC1, 0xC2, 0x17, 0xF0, 0xC1, 0x64, 0x35, 0x4B, 0x0C, 0x81, 0xFD, 0x13, 0xA3, 0x7B, 0xD8,
-    0xC7, 0xEC, 0x26, 0xBC, 0x4C, 0x2D, 0xDB, 0x12, 0x8B, 0x05, 0x66, 0xE5, 0x2B, 0x20, 0x81, 0x17,
-    0x01, 0x9F, 0x47, 0x5F, 0x4F, 0x5F, 0x70, 0x2F, 0xF4, 0xB6, 0xAA, 0x43, 0x3B, 0x04, 0xA5, 0xD9,
-    0x2B, 0x15, 0xA7, 0x6A, 0xBD, 0x0D, 0xF0, 0xEA, 0x5D, 0xC7, 0x2A, 0x9F, 0x6F, 0xFD, 0x03, 0xCA,
-    0xB3, 0xFD, 0xB2, 0xF1, 0xEB, 0x25, 0xF1, 0x1D, 0xC3, 0xBA, 0x49, 0x1B, 0xBF, 0x70, 0x6A, 0x94,
-    0x42, 0x66, 0x4D, 0xB6, 0x47, 0xEB, 0xEA, 0xC2, 0xAF, 0x99, 0xEC, 0x47, 0x7E, 0xAD, 0xA0, 0x84,
-    0x48, 0x19, 0xE6, 0xB5, 0x91, 0x2B, 0xB4, 0x7B, 0xCB, 0xA3, 0xA8, 0x2C, 0xCB, 0x35, 0x0A, 0x29,
-    0xA9, 0x9C, 0x1E, 0x3A, 0x36, 0xE2, 0x5E, 0xFB, 0x69, 0xED, 0x56, 0x96, 0xE1, 0xFD, 0xC5, 0x41,
-    0x31, 0x0C, 0x65, 0xE8, 0x5B, 0x1A, 0x80, 0x79, 0x45, 0xC7, 0x12, 0xB1, 0xB5, 0x3D, 0x36, 0x76,
-    0x45, 0x4F, 0x01, 0xD9, 0x65, 0x6D, 0xC9, 0xA9, 0xCD, 0x1A, 0x99, 0x87, 0x45, 0x8D, 0x19, 0x46,
-    0x68, 0x85, 0xC5, 0x4F, 0x95, 0xAB, 0x49, 0xC3, 0x2D, 0x12, 0x40, 0xB0, 0x92, 0x18, 0xE2, 0xA2,
-    0x19, 0x83, 0xE5, 0x00, 0x55, 0x8B, 0x5D, 0x93, 0x5E, 0x40, 0x4F, 0x16, 0x98, 0xCD, 0x25, 0x6F,
-    0x5C, 0x9D, 0xA8, 0xFC, 0xC4, 0x8D, 0xCD, 0x46, 0x21, 0x9F, 0xD5, 0x70, 0x42, 0x3F, 0x95, 0x93,
-    0x6A, 0x8D, 0x1A, 0x3F, 0x74, 0xF4, 0xD5, 0x6E, 0xAA, 0x9A, 0x5F, 0xA8, 0xDE, 0x50, 0xA9, 0x4A,
-    0xA1, 0x34, 0xB6, 0xB4, 0xCD, 0xFA, 0x6A, 0xC7, 0xCC, 0xFA, 0xB8, 0x85, 0xCD, 0x3A, 0x24, 0x8D,
-    0x57, 0x6D, 0x36, 0x7E, 0xC9, 0xFB, 0x26, 0x6E, 0xD3, 0xDA, 0xAB, 0x3B, 0x69, 0x93, 0xA1, 0xF1,
-    0x44, 0xDF, 0x17, 0x5E, 0x97, 0xD8, 0x15, 0xFE, 0x1F, 0xB2, 0x50, 0x4B, 0x44, 0x01, 0x4F, 0xB2,
-    0x92, 0x9E, 0x61, 0xBA, 0x8B, 0x8C, 0x41, 0x27, 0xCA, 0x69, 0x92, 0x92, 0x99, 0x49, 0xDF, 0x46,
-    0x78, 0x55, 0x29, 0xF2, 0xD8, 0x0C, 0xD4, 0xCD, 0x31, 0x23, 0x71, 0x4F, 0xDD, 0x92, 0x26, 0x50,
-    0xA2, 0x4A, 0xC0, 0x93, 0x2F, 0x3B, 0x49, 0xDB, 0x31, 0xE9, 0x65, 0xDC, 0x11, 0xD1, 0x98, 0xB0,
-    0x1C, 0xF0, 0x51, 0xB6, 0xDA, 0x14, 0xE5, 0x5D, 0x59, 0xE1, 0x9E, 0xBB, 0xD4, 0xF4, 0xA9, 0x6E,
-    0x3D, 0x83, 0xD1, 0x5D, 0xEE, 0x19, 0x01, 0x02, 0xF8, 0xD8, 0x18, 0x95, 0x43, 0xF5, 0xD9, 0x86,
-    0xF9, 0x32, 0x3B, 0xE6, 0xD0, 0xB3, 0xCA, 0x97, 0x77, 0xF1, 0x20, 0xBD, 0x24, 0xF1, 0x02, 0x7B,
-    0xC5, 0x3B, 0x54, 0x12, 0x40, 0x8E, 0xE0, 0x0E, 0xD3, 0x92, 0x17, 0xCA, 0x4F, 0xA2, 0xBE, 0x02,
-    0x1D, 0x47, 0x53, 0xE4, 0xD5, 0x70, 0xAE, 0xF0, 0x62, 0x9F, 0x71, 0x76, 0xCA, 0x9D, 0xB2, 0xCD,
-    0xA0, 0xC8, 0x9C, 0x20, 0xE7, 0xAD, 0x5A, 0xC1, 0x1D, 0x1A, 0xC1, 0x63, 0xBA, 0xE9, 0x59, 0x9E,
-    0x0C, 0xF0, 0x02, 0xBF, 0x41, 0x4E, 0xCD, 0xFF, 0xEB, 0xA6, 0xB6, 0xB5, 0x0D, 0xD2, 0xD9, 0x06,
-    0x19, 0xFC, 0xC4, 0x2C, 0x5D, 0xF2, 0x63, 0x6C, 0x90, 0x75, 0xEF, 0x37, 0x06, 0xB0, 0x0E, 0xC0,
-    0x49, 0x23, 0xCF, 0x97, 0x5A, 0xBF, 0x21, 0x72, 0x4E, 0xD5, 0x0E, 0xBE, 0xBD, 0x62, 0x5F, 0x56,
-    0x68, 0xC9, 0x4D, 0xB7, 0x7E, 0x83, 0x6C, 0xD1, 0x46, 0x66, 0xFD, 0x6E, 0x58, 0x31, 0xB7, 0x42,
-    0x5C, 0x2F, 0x5A, 0xF4, 0xC5, 0x9B, 0xA4, 0x26, 0xAD, 0xE1, 0x5E, 0x89, 0xA7, 0x5A, 0x1F, 0x7B,
-    0x76, 0xA0, 0xB5, 0xEC, 0x83, 0x95, 0x7B, 0xBA, 0x1C, 0xA2, 0x45, 0x43, 0xD5, 0x3C, 0x0F, 0x05,
-    0x4A, 0xB3, 0xB0, 0x36, 0x77, 0xD4, 0xA7, 0x2D, 0x78, 0xC0, 0x04, 0xC7, 0x3B, 0x7C, 0xCE, 0x1B,
-    0x51, 0x48, 0x79, 0x3E, 0xB9, 0x7E, 0x51, 0xCE, 0xAA, 0xD6, 0x29, 0xAF, 0x1B, 0xFC, 0xF5, 0xB2,
-    0x93, 0x5B, 0x4C, 0xD9, 0x47, 0x43, 0x10, 0xC5, 0x44, 0x08, 0xC8, 0xDC, 0xFF, 0x18, 0x13, 0x72,
-    0xA5, 0x60, 0x17, 0x14, 0xF8, 0xD9, 0x98, 0xDC, 0x2E, 0x5B, 0x78, 0xCB, 0xC2, 0x97, 0xB9, 0x3B,
-    0x14, 0x86, 0x50, 0x4B, 0xE4, 0x32, 0xC7, 0x3E, 0x64, 0xAF, 0x00, 0x0C, 0x41, 0xBE, 0xF1, 0xEB,
-    0xE8, 0xF2, 0xA3, 0x5C, 0x5A, 0xC9, 0xB8, 0xCD, 0xFC, 0x30, 0xDF, 0x7C, 0xC2, 0x3F, 0xE2, 0xD2,
-    0x01, 0x6C, 0x00, 0x3D, 0x02, 0xA7, 0x04, 0xD6, 0x72, 0x4A, 0x85, 0xB2, 0xE2, 0x54, 0x74, 0xE6,
-    0x44, 0x71, 0x95, 0x64, 0x16, 0xB9, 0x53, 0x59, 0x37, 0x7E, 0xFF, 0x88, 0x63, 0xC1, 0x5E, 0x48,
-    0xC5, 0xDD, 0x1A, 0x2A, 0x43, 0x31, 0xFC, 0xE9, 0x58, 0xC3, 0x53, 0x52, 0x07, 0x2A, 0xDF, 0x04,
-    0xBF, 0x1D, 0xD3, 0x7E, 0x05, 0x50, 0xD1, 0x73, 0x2B, 0xF7, 0xA3, 0xBE, 0x35, 0x70, 0x1B, 0x01,
-    0x55, 0x21, 0x83, 0xCE, 0x4C, 0x5D, 0xD9, 0x0B, 0x4A, 0xDA, 0x6F, 0x7E, 0x95, 0x41, 0x29, 0x80,
-    0x17, 0x03, 0x95, 0x4B, 0x3B, 0x25, 0xE4, 0x50, 0x0D, 0xCC, 0x46, 0x05, 0x1B, 0x1F, 0x56, 0x15,
-    0x39, 0xA0, 0x30, 0x90, 0x83, 0xA3, 0x2F, 0x41, 0x75, 0x6D, 0xD5, 0xD2, 0xB2, 0xD8, 0xB0, 0x3E,
-    0xB0, 0x6C, 0x11, 0xD8, 0xDF, 0xF9, 0x5E, 0xDD, 0x1C, 0x4A, 0x05, 0x16, 0x48, 0xA8, 0xC4, 0x32,
-    0xE5, 0xD7, 0x21, 0x59, 0xED, 0xBA, 0x80, 0x1C, 0xA6, 0x38, 0x54, 0x68, 0x65, 0x08, 0x8D, 0x71,
-    0xE2, 0xA3, 0x6A, 0xA5, 0x10, 0x31, 0x26, 0xE8, 0xDC, 0xBC, 0x0E, 0x28, 0x84, 0x89, 0xDD, 0x39,
-    0xE5, 0x26, 0xF1, 0x2C, 0x5C, 0x7E, 0xE2, 0x87, 0x7A, 0xE9, 0x1A, 0x78, 0x69, 0xCB, 0x1D, 0x9C,
-    0x35, 0xCC, 0x48, 0x80, 0xA7, 0x9B, 0x3B, 0x16, 0x5B, 0x3C, 0x2F, 0xF7, 0x68, 0x00, 0x05, 0xC2,
-    0x94, 0xC4, 0x0A, 0x92, 0x70, 0x81, 0xC8, 0x04, 0x0D, 0x5D, 0x54, 0x3B, 0x2D, 0x11, 0x6D, 0x83,
-    0xCB, 0xC0, 0xEB, 0xBC, 0x8C, 0x9A, 0x17, 0x0D, 0x74, 0x53, 0xA6, 0x27, 0xD0, 0x6D, 0x95, 0x75,
-    0xCC, 0x78, 0x48, 0xBD, 0x4E, 0x9F, 0x7A, 0x8A, 0x39, 0x4B, 0xCE, 0x99, 0x1C, 0x42, 0x5B, 0xD2,
-    0x60, 0x96, 0x37, 0x1E, 0x28, 0x60, 0x8D, 0xD1, 0xC1, 0x86, 0x7F, 0x14, 0x2E, 0xAF, 0x66, 0xE1,
-    0xF2, 0xA9, 0xB6, 0xAF, 0x8D, 0xC6, 0x2A, 0xE8, 0xCD, 0x94, 0x46, 0x0C, 0x19, 0xEC, 0xFE, 0x8C,
-    0x79, 0xE8, 0x0D, 0x1C, 0x74, 0x2B, 0xE5, 0xC7, 0xCF, 0x8A, 0x40, 0xD7, 0xC2, 0x28, 0x59, 0x4B,
-    0xD1, 0x5D, 0x8F, 0xF5, 0x3B, 0x85, 0x9B, 0xB0, 0x9C, 0xA6, 0xE6, 0xEE, 0x29, 0x00, 0x4F, 0x0E,
-    0x6B, 0x41, 0x4B, 0xF1, 0x69, 0x7A, 0xA4, 0x1A, 0xF0, 0x6F, 0xDA, 0xC6, 0x3D, 0x7D, 0xBC, 0xA9,
-    0xBB, 0x51, 0x4C, 0x45, 0xA0, 0xEB, 0xF3, 0x8B, 0x40, 0x4F, 0x8E, 0x42, 0x11, 0xD4, 0x4C, 0x15,
-    0x8A, 0xB8, 0xEB, 0xDA, 0x0D, 0xB2, 0xB2, 0x19, 0x1F, 0x82, 0xC6, 0x0D, 0x08, 0x84, 0x84, 0xF5,
-    0x81, 0xDD, 0x74, 0x29, 0xEE, 0x9E, 0x96, 0x1D, 0x19, 0x2E, 0xDD, 0x4B, 0x5C, 0x92, 0x19, 0x96,
-    0x22, 0x43, 0x6F, 0xB1, 0xAC, 0x1C, 0xBC, 0x99, 0x9E, 0x01, 0xF8, 0x8B, 0xB1, 0xC5, 0xD7, 0x03,
-    0x7B, 0xCE, 0x62, 0x3C, 0x87, 0xEB, 0x92, 0xD7, 0xB5, 0xBB, 0x87, 0x60, 0x09, 0x98, 0x23, 0x06,
-    0x99, 0xD5, 0x86, 0x72, 0x52, 0x98, 0x15, 0xED, 0xF7, 0x14, 0x73, 0x7C, 0x69, 0x30, 0xA7, 0x2D,
-    0x0B, 0x5D, 0x5A, 0x3A, 0x49, 0x18, 0x2D, 0x82, 0x1A, 0x08, 0xF7, 0x10, 0xC4, 0x7A, 0xDC, 0x61,
-    0x22, 0xE3, 0x8E, 0x2A, 0x40, 0xCF, 0x94, 0x9C, 0x7B, 0xB2, 0x8A, 0x95, 0xF5, 0xAA, 0x2A, 0x09,
-    0x59, 0xC5, 0xF5, 0x08, 0x6C, 0xB3, 0x0E, 0x56, 0x71, 0xF4, 0x64, 0x44, 0x25, 0x00, 0x22, 0x3F,
-    0xA6, 0xC0, 0xF7, 0x06, 0x2D, 0xAB, 0xFB, 0x71, 0x65, 0xC1, 0xBF, 0x2A, 0xC1, 0x58, 0xC3, 0xD2,
-    0xD1, 0x91, 0xDC, 0xD1, 0x8D, 0x8C, 0x38, 0x3F, 0xE2, 0x3D, 0xA8, 0xA5, 0x43, 0xBA, 0xAC, 0xBF,
-    0x82, 0xE2, 0xA8, 0xDF, 0x0F, 0x71, 0xD7, 0x95, 0xA9, 0xC5, 0xDD, 0xA8, 0xE3, 0xCB, 0x2C, 0x67,
-    0xCC, 0x21, 0x7A, 0xF8, 0x39, 0x80, 0x78, 0x6C, 0xFA, 0x94, 0x1E, 0x7A, 0x61, 0xE3, 0xD0, 0xD9,
-    0x55, 0x7C, 0x8D, 0x8E, 0xE4, 0xAA, 0xC0, 0x72, 0xCB, 0x2F, 0x8D, 0x05, 0x2E, 0x1F, 0x7A, 0x7A,
-    0x3E, 0xF6, 0x2C, 0x9C, 0x78, 0x09, 0x33, 0x3B, 0xBC, 0xFE, 0x82, 0x94, 0x91, 0x81, 0x9E, 0x31,
-    0x8D, 0x2B, 0xCB, 0x05, 0x14, 0xFA, 0xA9, 0xB9, 0x07, 0xFF, 0x97, 0x47, 0xFF, 0xC3, 0x9F, 0x47,
-    0x5D, 0x3B, 0x21, 0x55, 0x59, 0x9D, 0x68, 0x34, 0xEE, 0x73, 0xAB, 0x44, 0x34, 0x7E, 0x42, 0x89,
-    0xFA, 0x56, 0x28, 0x4C, 0x42, 0xA4, 0xB7, 0xE8, 0x43, 0xD1, 0x24, 0x30, 0xEC, 0xE0, 0xDC, 0xBB,
-    0x72, 0x8D, 0xC0, 0x0B, 0x2C, 0x92, 0x29, 0x69, 0x43, 0xCB, 0x6E, 0xF4, 0xC6, 0xE7, 0x60, 0xF7,
-    0xAA, 0xB6, 0x8B, 0xC8, 0x01, 0xAD, 0x2E, 0x82, 0xF7, 0xAA, 0xB6, 0xE3, 0x3D, 0x52, 0x50, 0x0C,
-    0x4A, 0xA1, 0xDC, 0x19, 0x1F, 0xE0, 0xBD, 0x31, 0x03, 0xFF, 0xAC, 0x62, 0xAF, 0x44, 0x38, 0x48,
-    0x38, 0x6F, 0xCA, 0xED, 0x42, 0xDD, 0x38, 0xAD, 0x3B, 0x2B, 0x1E, 0xCF, 0xDE, 0x81, 0xBF, 0xA9,
-    0x61, 0x65, 0x45, 0xF6, 0x13, 0x17, 0xA9, 0x56, 0xDD, 0x2F, 0x8B, 0x7B, 0x7D, 0x34, 0xD5, 0x92,
-    0x33, 0x6B, 0x80, 0x05, 0xE5, 0x89, 0x7C, 0x35, 0x52, 0x19, 0x2D, 0x8F, 0x40, 0xB5, 0xD7, 0xD5,
-    0xC8, 0x5A, 0x62, 0x03, 0xAD, 0xEC, 0x47, 0x0D, 0x44, 0x4C, 0x26, 0x1E, 0x26, 0xA2, 0xA6, 0xDD,
-    0x74, 0x5F, 0xB4, 0x33, 0x28, 0xB0, 0x31, 0x37, 0x62, 0x79, 0x33, 0xC8, 0x1F, 0xDA, 0x8F, 0xDB,
-    0xE9, 0x7E, 0x7A, 0xCC, 0xCA, 0x35, 0xB3, 0xFB, 0x7C, 0xE4, 0x64, 0x88, 0xC1, 0x78, 0x09, 0xBD,
-    0x61, 0xBC, 0x81, 0x88, 0x7B, 0x19, 0x3D, 0x40, 0xC8, 0x5F, 0x34, 0xDE, 0x26, 0x58, 0x42, 0xCF,
-    0xE1, 0x96, 0x56, 0x02, 0x54, 0x21, 0x0D, 0x60, 0x2B, 0xAC, 0x26, 0x44, 0xC1, 0x2B, 0x65, 0x54,
-    0x42, 0xE2, 0x56, 0xF2, 0xEA, 0x81, 0xE9, 0x56, 0x4A, 0x35, 0xE4, 0x6F, 0xE5, 0x6B, 0x80, 0x91,
-    0xF2, 0x3D, 0x41, 0xFA, 0x60, 0x1A, 0xBE, 0xAF, 0x32, 0x4E, 0x24, 0x25, 0xFE, 0x8D, 0x0B, 0x35,
-    0x75, 0xC5, 0x6B, 0x7D, 0x64, 0x28, 0x4D, 0xC8, 0x6C, 0x55, 0xF0, 0xC1, 0x22, 0x35, 0xFD, 0x86,
-    0x0E, 0xCC, 0x3A, 0xA0, 0xE5, 0xA4, 0x22, 0x21, 0xEB, 0xB3, 0x14, 0xF6, 0x91, 0xD2, 0x93, 0x07,
-    0xDF, 0x6A, 0x32, 0x8C, 0x55, 0xC6, 0xC9, 0x44, 0xC5, 0x59, 0xB5, 0xF9, 0x54, 0xE5, 0x36, 0x2D,
-    0xE7, 0xCB, 0x37, 0x47, 0xE9, 0xBD, 0x71, 0x01, 0xCA, 0x2B, 0xDA, 0x4C, 0xEA, 0xCA, 0x66, 0xA2,
-    0xFC, 0xFA, 0x18, 0xF8, 0x24, 0x15, 0xF1, 0xA5, 0xFB, 0x3C, 0x4A, 0xED, 0x61, 0x21, 0xD3, 0x4A,
-    0xD5, 0x4B, 0x51, 0x36, 0xE5, 0xB7, 0xC1, 0xDB, 0xD6, 0x96, 0xAC, 0x52, 0x81, 0xF1, 0xB1, 0x8D,
-    0x55, 0x37, 0x93, 0xD0, 0xD9, 0x50, 0x41, 0xD7, 0xB2, 0xC5, 0x4D, 0x45, 0x40, 0x3E, 0x96, 0x86,
-    0xBF, 0x94, 0x9D, 0xC4, 0x66, 0x75, 0xD0, 0xAC, 0x61, 0x23, 0x8C, 0x68, 0x08, 0x89, 0xF6, 0x80,
-    0xAA, 0x42, 0xE0, 0xB1, 0x4E, 0x5D, 0xFC, 0x32, 0xE0, 0x2F, 0xDC, 0x58, 0x5C, 0x4F, 0x5B, 0xC3,
-    0x05, 0x3D, 0x59, 0xC6, 0x95, 0xC6, 0x64, 0x85, 0xD8, 0x99, 0x06, 0xF4, 0xD0, 0x81, 0x7F, 0xAC,
-    0x0E, 0x69, 0x9D, 0x78, 0xC6, 0x2E, 0x54, 0xEB, 0x58, 0x39, 0x8D, 0xA2, 0xA8, 0xB7, 0xEF, 0x61,
-    0x40, 0x97, 0xBF, 0xC1, 0x54, 0x09, 0x8D, 0x43, 0xC3, 0x90, 0x85, 0xB8, 0xE4, 0x58, 0x64, 0x9C,
-    0xC8, 0xAD, 0xB5, 0x66, 0xA9, 0x2C, 0x93, 0x57, 0x7F, 0x3B, 0x1D, 0x66, 0x85, 0xB1, 0x8D, 0x95,
-    0x1B, 0x19, 0x47, 0x91, 0x92, 0x6B, 0xB0, 0x80, 0xDD, 0x01, 0xF1, 0x2F, 0xDF, 0x08, 0x33, 0x1C,
-    0x16, 0xB8, 0x95, 0x67, 0x7B, 0x65, 0xDF, 0xBC, 0xF1, 0xCB, 0xFD, 0x33, 0xA9, 0xB9, 0x8D, 0xC2,
-    0x77, 0x17, 0xE3, 0xC4, 0x7E, 0x26, 0xDC, 0xFC, 0x79, 0xD8, 0x28, 0xBB, 0x99, 0xBE, 0x7D, 0x90,
-    0x8D, 0x30, 0xE4, 0x0B, 0xE8, 0xBB, 0x48, 0x6B, 0x4D, 0xB4, 0xFE, 0x70, 0xA3, 0xB0, 0x35, 0x0A,
-    0x5B, 0x76, 0x48, 0x71, 0xDD, 0x6E, 0xDE, 0xC2, 0xFE, 0xA9, 0x97, 0xFE, 0xFB, 0xAC, 0x4A, 0xD7,
-    0x16, 0x8E, 0xD5, 0x3B, 0xC3, 0x46, 0x02, 0x9F, 0x51, 0xA1, 0xA4, 0xBF, 0xB1, 0xEA, 0x4C, 0x7F,
-    0x63, 0xE9, 0x92, 0x9D, 0xA9, 0x5D, 0x5E, 0x63, 0x08, 0x37, 0x56, 0xF2, 0x5C, 0x34, 0x23, 0x9C,
-    0xC4, 0x88, 0xC7, 0x51, 0x32, 0x47, 0x5D, 0x29, 0x44, 0x74, 0xD8, 0x54, 0xC1, 0x05, 0x5F, 0xA9,
-    0x28, 0xC8, 0xEF, 0x0D, 0xCF, 0xA9, 0x90, 0x11, 0x02, 0xEF, 0xE0, 0x5B, 0x8E, 0x0C, 0xD8, 0x60,
-    0xB3, 0xEA, 0x10, 0x03, 0x64, 0x2D, 0x57, 0x5B, 0x5A, 0x42, 0xE4, 0x36, 0xA1, 0xDD, 0x83, 0xA8,
-    0x91, 0x39, 0x49, 0x2F, 0x1B, 0x57, 0x49, 0x8C, 0xA5, 0x64, 0x86, 0x96, 0xF4, 0x6D, 0x83, 0x52,
-    0xBE, 0xF6, 0x27, 0x0B, 0x91, 0xB8, 0xB4, 0x59, 0x08, 0xF1, 0xE6, 0xD8, 0xA8, 0xF7, 0xC7, 0xD6,
-    0x9E, 0x15, 0x20, 0x34, 0x2F, 0x6E, 0x44, 0x37, 0x6F, 0xB0, 0x74, 0x7D, 0xAD, 0xC2, 0x9C, 0x0E,
-    0xCC, 0x69, 0xC1, 0x82, 0x48, 0x30, 0xA2, 0xA1, 0x5E, 0xDD, 0x66, 0x26, 0xD9, 0x27, 0x17, 0x0B,
-    0xC6, 0x27, 0xA9, 0x87, 0xCB, 0x4C, 0x61, 0x0A, 0x8C, 0x8A, 0x51, 0xDA, 0x50, 0x9E, 0x62, 0x89,
-    0xB8, 0xCA, 0x75, 0x0E, 0x09, 0xB8, 0xBB, 0xB9, 0xD3, 0x9E, 0x82, 0xA3, 0x55, 0xD5, 0x63, 0xE6,
-    0x95, 0xE9, 0x77, 0x0B, 0x67, 0xC5, 0xB4, 0x24, 0xCE, 0x6D, 0x5B, 0x83, 0x4F, 0x29, 0x53, 0xB4,
-    0x8F, 0x98, 0xD1, 0x74, 0x29, 0x0F, 0x0E, 0x48, 0x53, 0x16, 0xB9, 0x40, 0x47, 0xA4, 0x2C, 0xB1,
-    0x88, 0x26, 0x5D, 0x8B, 0x97, 0x3C, 0xF3, 0x4F, 0x56, 0xF9, 0x79, 0xA3, 0xFD, 0xFF, 0x30, 0x8C,
-    0xE2, 0x07, 0x7D, 0x7A, 0xFA, 0xFC, 0xCC, 0x09, 0x65, 0x59, 0xFC, 0x51, 0xF4, 0xD9, 0xF8, 0x25,
-    0xD2, 0xEF, 0x33, 0x9B, 0xF3, 0x96, 0xC6, 0x47, 0x26, 0xFC, 0x32, 0x87, 0x31, 0x89, 0x66, 0x30,
-    0x26, 0x69, 0x80, 0x31, 0x41, 0xDA, 0x59, 0x4F, 0x18, 0x93, 0x3A, 0xA4, 0x98, 0x98, 0xF4, 0x4F,
-    0x86, 0x59, 0xD1, 0x6E, 0x37, 0x49, 0xFC, 0xF7, 0x06, 0x33, 0x39, 0x1F, 0xC6, 0x84, 0x8A, 0xC8,
-    0xF5, 0x20, 0x20, 0xD7, 0xCE, 0x50, 0x55, 0x54, 0xD0, 0xD0, 0xCD, 0x3E, 0x7B, 0x7F, 0xF0, 0xC1,
-    0xC5, 0xAC, 0xCA, 0x36, 0xBA, 0xFE, 0xF7, 0xC6, 0xF6, 0x33, 0x41, 0x6F, 0xC0, 0xB3, 0x31, 0x94,
-    0xB9, 0x17, 0x62, 0x0B, 0xC2, 0x51, 0x69, 0x10, 0x17, 0x82, 0x37, 0x4F, 0x17, 0xFD, 0xD5, 0xFD,
-    0x6B, 0x84, 0x23, 0x55, 0xC8, 0x5D, 0x99, 0xFA, 0x52, 0xBE, 0x6F, 0x5C, 0x68, 0x63, 0xD1, 0x2B,
-    0x66, 0x64, 0xEC, 0xA3, 0x65, 0x14, 0x57, 0xBE, 0x4D, 0x51, 0xE5, 0x5F, 0x44, 0xDC, 0xB4, 0xA6,
-    0x02, 0x28, 0xCD, 0x89, 0xF3, 0xF8, 0x5D, 0x4C, 0x6E, 0xFE, 0x97, 0xBF, 0x1A, 0x15, 0xD1, 0x27,
-    0xB2, 0x1D, 0x32, 0x5A, 0x86, 0x36, 0xE8, 0x55, 0x0C, 0x42, 0x73, 0x34, 0x19, 0x54, 0xF9, 0x62,
-    0xD3, 0x42, 0xD8, 0xFC, 0xAF, 0x68, 0x41, 0x05, 0x98, 0x94, 0x79, 0xE6, 0x88, 0x6F, 0xB5, 0x97,
-    0x4E, 0xBE, 0x0C, 0x33, 0xAF, 0x43, 0xDE, 0x69, 0xF1, 0xF4, 0x49, 0xFE, 0xD9, 0xD1, 0x4B, 0xE5,
-    0x76, 0x9F, 0x76, 0x2C, 0x8E, 0x6C, 0x4A, 0xF7, 0xCD, 0xC6, 0xBD, 0xB1, 0x6A, 0xAE, 0x7A, 0xAD,
-    0xE4, 0x61, 0x6F, 0xD0, 0x97, 0xB5, 0xDB, 0xFE, 0x65, 0x54, 0xE4, 0xC9, 0x7E, 0x71, 0xE3, 0xF2,
-    0x1E, 0x96, 0xC4, 0xBA, 0x5B, 0xB4, 0x9B, 0xBA, 0xD8, 0xFE, 0x26, 0x85, 0xEE, 0xD2, 0x33, 0x5F,
-    0x4F, 0x98, 0x1B, 0x7E, 0xC3, 0x0D, 0xD9, 0xDF, 0xB9, 0x3E, 0xDB, 0x26, 0xFD, 0x63, 0x81, 0x13,
-    0x7F, 0x72, 0x16, 0xB1, 0x1A, 0x95, 0xBE, 0x78, 0xD2, 0xCB, 0x7F, 0x77, 0x51, 0x4F, 0xA2, 0xED,
-    0x2B, 0xD1, 0xC5, 0x3F, 0x6B, 0xAD, 0x5B, 0x84, 0x81, 0x53, 0xCB, 0x1F, 0xF3, 0xDF, 0xFC, 0x57,
-    0x5F, 0xC6, 0xAC, 0x6F, 0x9E, 0xF6, 0xD2, 0xF0, 0x2B, 0xDC, 0x90, 0xBF, 0x0A, 0x09, 0xF9, 0x49,
-    0xD3, 0x07, 0x1E, 0x8A, 0x7E, 0xDA, 0x9F, 0xAB, 0x63, 0x25, 0xEC, 0x26, 0xC0, 0xA3, 0x20, 0x55,
-    0xB3, 0x32, 0xDD, 0xB4, 0xFD, 0xCC, 0x52, 0x23, 0xD8, 0xE4, 0x5F, 0xFD, 0x4A, 0x54, 0x9B, 0xE4,
-    0xF8, 0xA7, 0xD1, 0x07, 0xF0, 0x73, 0x75, 0xCC, 0x4E, 0xD2, 0x9B, 0x97, 0xE2, 0x62, 0x02, 0x05,
-    0xF4, 0x33, 0xAE, 0x37, 0xC7, 0xF9, 0x57, 0xA7, 0x11, 0xFF, 0x8B, 0xF7, 0x78, 0xDC, 0xA8, 0x47,
-    0xBF, 0x4F, 0xAA, 0xFF, 0xCE, 0x74, 0xFB, 0x99, 0xE9, 0xF6, 0xDB, 0xD3, 0xED, 0x4C, 0xCB, 0x37,
-    0xAD, 0xDD, 0x4B, 0xD4, 0xA5, 0xDD, 0xAE, 0x2A, 0x5B, 0x80, 0x5C, 0xEE, 0xD0, 0xC5, 0x36, 0x48,
-    0xF2, 0x6D, 0x26, 0xC5, 0xB3, 0x9B, 0x6A, 0x11, 0xBE, 0x33, 0xED, 0xEA, 0x6C, 0xD2, 0x4F, 0x7F,
-    0x17, 0x97, 0x5F, 0x39, 0xAB, 0xD8, 0xBD, 0xDF, 0x19, 0x7C, 0x88, 0xD5, 0xA3, 0x22, 0x00, 0xDC,
-    0x69, 0x76, 0x3B, 0xE4, 0x01, 0x02, 0x17, 0x64, 0xB9, 0x1E, 0xF8, 0xE1, 0x3E, 0xFA, 0xA0, 0x7E,
-    0x24, 0x4B, 0x37, 0x7C, 0x83, 0x22, 0xAD, 0x95, 0xBA, 0x10, 0x98, 0xD4, 0xA6, 0x1E, 0x3D, 0x97,
-    0x2B, 0xB2, 0x1A, 0xFF, 0xA7, 0x5E, 0x74, 0xFD, 0x84, 0x08, 0xF4, 0xED, 0xB0, 0x6B, 0xC7, 0x39,
-    0x58, 0x4E, 0x06, 0xD2, 0x72, 0x4A, 0x3B, 0x5F, 0x4D, 0xBD, 0x5E, 0x55, 0xD3, 0x07, 0xC2, 0xC4,
-    0x3F, 0xFC, 0xAC, 0xAA, 0x5E, 0xE2, 0x4E, 0x0E, 0xBC, 0xB8, 0x13, 0xEB, 0xD8, 0xB8, 0xCF, 0x95,
-    0x21, 0x5B, 0xAC, 0x9A, 0x60, 0xCF, 0x20, 0x45, 0xDE, 0xB8, 0x60, 0x03, 0xC2, 0x6E, 0xD9, 0x30,
-    0x00, 0x27, 0x9F, 0x20, 0x5D, 0xB7, 0x9D, 0x8E, 0x37, 0x60, 0xB4, 0x8E, 0xAE, 0x06, 0x25, 0x55,
-    0xA6, 0x8D, 0x42, 0x9B, 0x84, 0x9B, 0x67, 0xBB, 0x70, 0x3F, 0x84, 0xDF, 0xC8, 0xCB, 0xBA, 0x27,
-    0x90, 0x22, 0xB5, 0x8F, 0x07, 0xC6, 0xDF, 0x76, 0x29, 0x23, 0x73, 0x50, 0x04, 0xD5, 0xBA, 0x7D,
-    0x01, 0x55, 0xFA, 0xEB, 0x08, 0x4A, 0x02, 0xC4, 0x0E, 0xF6, 0x31, 0xA2, 0x44, 0x30, 0xD8, 0x90,
-    0xF8, 0xD2, 0xAA, 0x45, 0xB1, 0xD2, 0x96, 0xF0, 0x42, 0x4B, 0xD5, 0x86, 0x6F, 0x57, 0xF2, 0x24,
-    0x47, 0x6A, 0x59, 0x7D, 0x55, 0x25, 0x52, 0x8C, 0xAA, 0x54, 0x32, 0x2E, 0x4F, 0xC5, 0xC6, 0x35,
-    0x84, 0x60, 0x30, 0x99, 0x63, 0x73, 0x4C, 0xF3, 0x0F, 0x3E, 0x54, 0xDB, 0x31, 0xCB, 0x71, 0xE3,
-    0x57, 0xB6, 0x64, 0x44, 0x5B, 0x4A, 0x11, 0x2F, 0xF3, 0x2F, 0x5D, 0xA5, 0x2B, 0x86, 0xFF, 0xFA,
-    0xAE, 0xA7, 0x4C, 0x93, 0x4E, 0x42, 0xD5, 0x7C, 0x1F, 0x59, 0xF6, 0xE8, 0x1C, 0x4B, 0x4A, 0xB5,
-    0x11, 0xF4, 0x0D, 0x1C, 0xA6, 0xD3, 0x4C, 0x58, 0xC3, 0xEB, 0xB1, 0x0A, 0xEF, 0x28, 0x9D, 0xE6,
-    0xB0, 0x66, 0x4E, 0x89, 0x34, 0x84, 0x44, 0xA3, 0x19, 0xDA, 0xB2, 0xD8, 0xC5, 0xAB, 0x3F, 0x82,
-    0x91, 0x70, 0x75, 0x82, 0x72, 0x87, 0x5D, 0x0C, 0xFC, 0x2F, 0x00, 0x96, 0x00, 0x57, 0xE1, 0x8A,
-    0x65, 0x85, 0xAD, 0xCE, 0x94, 0xC8, 0xCD, 0x65, 0xAC, 0x46, 0x7F, 0x92, 0x9F, 0x03, 0x96, 0xB6,
-    0x1C, 0x23, 0xE7, 0xE1, 0xA8, 0x0C, 0x13, 0xDE, 0x45, 0x7F, 0xED, 0x18, 0xDE, 0xEC, 0xDD, 0x7C,
-    0xB4, 0x72, 0x46, 0x30, 0x8F, 0x76, 0x02, 0x32, 0x2E, 0x07, 0x4B, 0xF4, 0x5B, 0xB1, 0x2E, 0x72,
-    0x4C, 0x25, 0x1A, 0x4B, 0x23, 0x51, 0x9C, 0xD4, 0xCF, 0x60, 0x3C, 0x1A, 0x03, 0x75, 0x48, 0x03,
-    0x7A, 0x34, 0xB6, 0x37, 0x71, 0x72, 0x0F, 0x4F, 0x94, 0xB8, 0xE2, 0xDE, 0xBC, 0x26, 0xB3, 0x8F,
-    0x80, 0x0D, 0xA5, 0x3C, 0xC6, 0xE7, 0x64, 0x5D, 0x9E, 0xAD, 0xBF, 0x89, 0xD2, 0xFE, 0xC9, 0x5C,
-    0xDF, 0xCD, 0x82, 0x03, 0x77, 0x5B, 0xDE, 0x79, 0xDC, 0xD2, 0xF3, 0xA9, 0xD3, 0xB1, 0xAA, 0x94,
-    0xBE, 0x87, 0x72, 0xB8, 0xE9, 0x04, 0x7E, 0x92, 0x58, 0x4D, 0xC1, 0xD6, 0x70, 0x55, 0x47, 0x00,
-    0x68, 0x01, 0xB9, 0x1A, 0x68, 0x6F, 0x80, 0x45, 0x80, 0xAF, 0xA1, 0x9D, 0x41, 0x39, 0x4C, 0xF5,
-    0xA5, 0x9F, 0x60, 0xFD, 0xE3, 0x77, 0xA8, 0x2B, 0x97, 0xD4, 0x8C, 0x91, 0x8E, 0xC5, 0x78, 0xD5,
-    0x62, 0x3C, 0x9D, 0xA0, 0xB7, 0xF2, 0xDF, 0x95, 0x7B, 0xFA, 0xCB, 0x8C, 0x48, 0x2F, 0x5A, 0x8E,
-    0x2A, 0xBF, 0xEF, 0x39, 0x01, 0x33, 0x0F, 0xC3, 0xE2, 0xDA, 0x65, 0x80, 0x18, 0x77, 0xC8, 0x2E,
-    0x45, 0xB5, 0xE6, 0x6E, 0x84, 0x30, 0xB9, 0xC7, 0x9A, 0xCD, 0xAD, 0xEF, 0xA1, 0xF2, 0x2A, 0x93,
-    0x80, 0x37, 0x31, 0x56, 0x7E, 0x66, 0xF5, 0x41, 0x22, 0x22, 0xFE, 0xDD, 0xFF, 0x39, 0xF4, 0xDE,
-    0x77, 0xE8, 0x74, 0x7E, 0x9B, 0x55, 0x94, 0x9D, 0xF5, 0x56, 0x66, 0x77, 0x37, 0xAB, 0xD6, 0x64,
-    0x74, 0xFF, 0xDF, 0x0A, 0x31, 0x86, 0xC9, 0xE4, 0xD1, 0xBF, 0x7F, 0xC0, 0x6A, 0x4D, 0x96, 0x62,
-    0x8D, 0xE9, 0x83, 0x59, 0x73, 0x4E, 0x0E, 0xD8, 0x04, 0x6C, 0x5D, 0x3D, 0x18, 0xB0, 0xF5, 0x19,
-    0x1D, 0xF6, 0x1C, 0x60, 0xEB, 0x63, 0x1C, 0x97, 0x07, 0x02, 0x4D, 0xEE, 0x2F, 0x04, 0xB6, 0x66,
-    0x26, 0xBB, 0x90, 0x1B, 0xA6, 0x85, 0xD7, 0x46, 0x57, 0x4E, 0x8A, 0x46, 0x09, 0xE1, 0x2C, 0xDE,
-    0x67, 0x2D, 0x86, 0x92, 0xB5, 0x0D, 0x09, 0xE0, 0xE0, 0x9C, 0x92, 0x69, 0x3D, 0xE7, 0xF7, 0x3D,
-    0x21, 0xE5, 0x48, 0x1F, 0x7D, 0x1F, 0x34, 0x3A, 0x1F, 0xB4, 0xF0, 0x61, 0x77, 0xF7, 0x39, 0xFA,
-    0x15, 0x14, 0x38, 0xEB, 0x66, 0xD7, 0xF6, 0x03, 0xA1, 0xD1, 0x25, 0xE4, 0x39, 0x87, 0xC2, 0x1F,
-    0xF8, 0x86, 0x5C, 0x67, 0xBB, 0xB2, 0x39, 0x73, 0x8A, 0x4C, 0x62, 0x9C, 0xA1, 0x1E, 0xCB, 0x71,
-    0xEA, 0xE8, 0xD7, 0xDC, 0x0F, 0xF2, 0xF7, 0xD8, 0xF3, 0x23, 0x8D, 0x3E, 0x38, 0x1C, 0xF4, 0xC9,
-    0xA0, 0x9A, 0xAA, 0xF5, 0xAD, 0x48, 0x74, 0x4B, 0x90, 0x28, 0xD5, 0x5A, 0xEF, 0x88, 0x82, 0xB6,
-    0x17, 0x20, 0x9C, 0x1C, 0x23, 0x94, 0xA7, 0x35, 0x8B, 0x64, 0xF6, 0xE9, 0xEC, 0x4A, 0x7F, 0xD4,
-    0x6E, 0x86, 0x0C, 0xBD, 0x1D, 0x25, 0x10, 0x64, 0xD8, 0xFF, 0xFE, 0x92, 0xEA, 0x42, 0x14, 0x9E,
-    0x32, 0xAC, 0x1B, 0x62, 0x19, 0x35, 0xA3, 0xAB, 0xF6, 0x0A, 0x8A, 0x7A, 0x78, 0x86, 0xD5, 0xF1,
-    0x8A, 0xDA, 0x9D, 0x73, 0xF2, 0xCD, 0x2D, 0xE2, 0x51, 0xE8, 0x6C, 0x12, 0xAD, 0x8E, 0x8D, 0xBB,
-    0x0D, 0x0F, 0xF5, 0x92, 0x38, 0x72, 0xEC, 0x23, 0x9D, 0x18, 0xF4, 0x60, 0x84, 0x4B, 0x33, 0xA1,
-    0x55, 0x2C, 0x85, 0x14, 0x5C, 0xC1, 0xD6, 0xDA, 0xAE, 0x6E, 0x69, 0xFC, 0xBD, 0x0A, 0xAE, 0x58,
-    0x7A, 0xB5, 0x9C, 0x1C, 0x95, 0x4B, 0x62, 0x26, 0x1B, 0xE8, 0x58, 0x04, 0x86, 0xB1, 0x17, 0x72,
-    0x7B, 0x25, 0xDC, 0x6D, 0x86, 0x4D, 0x05, 0x58, 0x6C, 0x40, 0x42, 0x94, 0x70, 0x39, 0x2D, 0xC9,
-    0xB4, 0x5B, 0x2B, 0xB6, 0xCC, 0x74, 0x06, 0xAD, 0xB4, 0xCD, 0xB0, 0x19, 0xB4, 0xB6, 0xD6, 0x2E,
-    0xEE, 0x35, 0x67, 0x00, 0x60, 0x2E, 0xCD, 0xED, 0xF1, 0xC3, 0x3E, 0x44, 0x02, 0x9D, 0xB9, 0xA1,
-    0xA7, 0x33, 0x77, 0xD6, 0xAE, 0x14, 0xE8, 0x20, 0x92, 0x4C, 0xDE, 0xB1, 0xCC, 0xD7, 0xAE, 0x78,
-    0x5B, 0x62, 0xBF, 0x6C, 0xCA, 0xBD, 0xA1, 0x4C, 0xEE, 0xE9, 0xBE, 0x12, 0xDC, 0xCF, 0xAE, 0x90,
-    0x1D, 0x66, 0x1E, 0x50, 0x82, 0x2B, 0x55, 0x7C, 0x6F, 0xD9, 0xA0, 0xF3, 0xC3, 0x73, 0xF8, 0x02,
-    0xEB, 0xB2, 0x40, 0xD3, 0x8A, 0x22, 0xBE, 0x1B, 0x11, 0xD3, 0x5A, 0x85, 0xF7, 0x42, 0x8A, 0xD8,
-    0x2C, 0x8C, 0x79, 0x01, 0xD6, 0xD9, 0xA4, 0xC5, 0x8F, 0x1E, 0xF5, 0x29, 0x96, 0xBB, 0x9C, 0xDD,
-    0x6D, 0x27, 0xDC, 0x14, 0x6F, 0xFE, 0x76, 0xC4, 0x52, 0x66, 0xE5, 0x3C, 0xD6, 0x7C, 0xC1, 0xBB,
-    0x2D, 0x2B, 0x01, 0xB6, 0xCB, 0xDB, 0xC0, 0xA2, 0x5E, 0x01, 0x7C, 0x15, 0xC9, 0x88, 0x6D, 0x6C,
-    0x59, 0xF9, 0x59, 0x23, 0x63, 0x1F, 0x77, 0xA2, 0x24, 0x9C, 0x54, 0xE6, 0xB6, 0x1A, 0x71, 0x53,
-    0xCE, 0xB9, 0x5B, 0x8C, 0x77, 0x2B, 0xD4, 0x02, 0x96, 0x0A, 0x1D, 0x7D, 0x5D, 0x0E, 0x60, 0x06,
-    0x4B, 0xB6, 0xE5, 0x88, 0x9B, 0x52, 0xF4, 0x0F, 0xC1, 0xDA, 0x47, 0x12, 0x14, 0xB7, 0x37, 0xF2,
-    0x3C, 0x12, 0xDE, 0xC1, 0x35, 0xB2, 0x11, 0x85, 0x62, 0x61, 0x75, 0x1B, 0x6E, 0x4A, 0x3A, 0x52,
-    0x68, 0x2C, 0xC3, 0x9C, 0xDD, 0x15, 0xFB, 0x63, 0xA4, 0xCE, 0x19, 0xAD, 0xA2, 0x91, 0x42, 0x4A,
-    0x26, 0xFC, 0x88, 0xC0, 0xB4, 0xFF, 0x9A, 0x34, 0xD4, 0x7E, 0x76, 0xD0, 0x4C, 0x19, 0x8D, 0x87,
-    0xC2, 0xFD, 0x99, 0x9B, 0xE0, 0x4E, 0x5D, 0x77, 0xB8, 0x4A, 0x7E, 0x81, 0x08, 0x33, 0x8F, 0xD7,
-    0xC1, 0x98, 0xA1, 0xE7, 0x7A, 0xC9, 0x1C, 0x46, 0xC4, 0x08, 0x1E, 0xEF, 0x2D, 0x3C, 0xC7, 0x10,
-    0xCF, 0x72, 0xF2, 0x04, 0x90, 0x0D, 0xEE, 0x94, 0x36, 0xBE, 0x55, 0x3E, 0xE8, 0x08, 0x24, 0x8E,
-    0x00, 0x4D, 0x23, 0x10, 0xD8, 0xBD, 0xF6, 0xFA, 0x96, 0x1E, 0x69, 0xE5, 0x94, 0x91, 0x15, 0x14,
-    0x0D, 0x77, 0x4D, 0xF9, 0x63, 0x31, 0xB2, 0x9F, 0x68, 0xDD, 0x1A, 0x1D, 0x9C, 0x00, 0xFE, 0x6F,
-    0xB3, 0x80, 0xC3, 0xBD, 0xAA, 0x4A, 0x92, 0x57, 0x34, 0x92, 0xA7, 0x24, 0x13, 0xFE, 0x40, 0xCE,
-    0x31, 0xBE, 0x00, 0x61, 0x38, 0x83, 0x67, 0x6E, 0xD8, 0x14, 0xC3, 0xF3, 0x0C, 0xB2, 0x3A, 0xC2,
-    0x71, 0xA4, 0x3A, 0xB9, 0x29, 0x16, 0x9A, 0xDE, 0x08, 0x5A, 0x7A, 0xD0, 0x64, 0x07, 0x00, 0x02,
-    0x21, 0xFF, 0x60, 0x9E, 0x77, 0xCF, 0x75, 0x78, 0xE5, 0x5A, 0xE4, 0xC5, 0x5A, 0xA8, 0x8A, 0x90,
-    0x93, 0x93, 0x05, 0x18, 0xFB, 0x94, 0x60, 0x9D, 0x48, 0x83, 0x73, 0xDF, 0x63, 0x19, 0xD8, 0x77,
-    0x59, 0x58, 0xF5, 0xEA, 0x58, 0x80, 0x21, 0xEC, 0x2B, 0xCF, 0xA7, 0x88, 0xEC, 0xAA, 0x48, 0x22,
-    0x3C, 0xF3, 0x31, 0x79, 0x1E, 0xB8, 0x60, 0xCE, 0x18, 0xEA, 0xAD, 0x2D, 0x52, 0x7D, 0xC9, 0x91,
-    0x74, 0x2D, 0x95, 0xEC, 0x46, 0x02, 0x2D, 0x2D, 0xED, 0x6E, 0xCA, 0xFA, 0x90, 0x73, 0x65, 0x33,
-    0x1C, 0x17, 0xC0, 0x43, 0xCD, 0x9A, 0xB0, 0x4B, 0x97, 0x14, 0x8E, 0x97, 0x34, 0x53, 0xF1, 0x13,
-    0x3C, 0x2C, 0x2E, 0x29, 0x59, 0xCB, 0x90, 0x2A, 0x7F, 0x81, 0xA8, 0x00, 0x59, 0x97, 0x71, 0x8A,
-    0xDA, 0x4C, 0xC7, 0x66, 0x90, 0xF3, 0x96, 0x6F, 0x6B, 0xA9, 0xBD, 0x73, 0x38, 0x45, 0xCA, 0xCB,
-    0xBD, 0xDD, 0xCF, 0xA7, 0xE8, 0xBB, 0x9A, 0xA2, 0x6F, 0x48, 0x1A, 0x7D, 0x9E, 0xC1, 0x5E, 0xB7,
-    0x11, 0xDE, 0x7C, 0x2C, 0x74, 0x35, 0x66, 0xD0, 0xFA, 0x3E, 0x5C, 0xE7, 0x32, 0x49, 0x9E, 0x18,
-    0x0C, 0x68, 0xDE, 0x52, 0x3F, 0x27, 0xA0, 0x79, 0xAF, 0x85, 0x5F, 0x19, 0x49, 0xFD, 0xF6, 0x7F,
-    0x07, 0xA9, 0xDF, 0xB9, 0x0D, 0x52, 0xBF, 0x0E, 0x6A, 0xBA, 0xBF, 0xE1, 0x86, 0x7F, 0x8D, 0xD2,
-    0xFA, 0x95, 0x39, 0xA9, 0xBB, 0xF3, 0x49, 0x9D, 0xF5, 0x82, 0x37, 0x03, 0x95, 0x0A, 0x92, 0xBA,
-    0x24, 0x6E, 0xEC, 0x5D, 0xA6, 0xFF, 0x36, 0xAC, 0x63, 0xB8, 0x5A, 0x36, 0x21, 0xE5, 0x51, 0x42,
-    0x5E, 0xC8, 0x9E, 0x55, 0xF4, 0x84, 0xBB, 0x4A, 0x88, 0x3C, 0xE4, 0x53, 0xE0, 0xE9, 0x75, 0x49,
-    0x00, 0x9F, 0xBF, 0x55, 0xEA, 0x17, 0x50, 0xF6, 0xBD, 0xF5, 0xF4, 0xC5, 0x8B, 0x49, 0xF7, 0x93,
-    0x10, 0x94, 0xBD, 0xEF, 0xEA, 0x36, 0xD2, 0xFD, 0xBE, 0x56, 0xF7, 0x62, 0xBE, 0xBA, 0x1D, 0x41,
-    0xC3, 0xA6, 0x1D, 0x96, 0x09, 0xBA, 0x3E, 0x71, 0x23, 0x05, 0x79, 0x18, 0xD9, 0x36, 0x14, 0x41,
-    0xCD, 0x54, 0xB6, 0xC5, 0x4D, 0x77, 0xBA, 0x3D, 0x28, 0x82, 0xD2, 0x75, 0xD2, 0x0E, 0x7F, 0xDE,
-    0xAB, 0x5A, 0x09, 0xEC, 0xBB, 0x50, 0x38, 0x22, 0xAB, 0xB7, 0xB1, 0x04, 0xEC, 0x9C, 0x65, 0xDF,
-    0x54, 0xAE, 0x00, 0x21, 0x0C, 0xD3, 0x05, 0x3B, 0x77, 0xA0, 0x4E, 0x56, 0xE8, 0x60, 0x02, 0x25,
-    0xDB, 0xE8, 0x10, 0x92, 0x4E, 0xAE, 0xD3, 0x8E, 0x20, 0xC7, 0x59, 0x4B, 0x47, 0x73, 0xD6, 0x08,
-    0x81, 0x4A, 0xA4, 0x2E, 0x43, 0x0D, 0x80, 0x84, 0xE0, 0x6D, 0xC1, 0x77, 0xBE, 0xA6, 0x73, 0x0B,
-    0x5E, 0x56, 0xFE, 0xFF, 0xCB, 0x22, 0xF5, 0xD7, 0x54, 0x9E, 0xBA, 0x55, 0x0C, 0x3D, 0xD7, 0x40,
-    0x02, 0x10, 0xB1, 0x56, 0x4D, 0xA4, 0x42, 0x29, 0x95, 0x56, 0xF6, 0xA4, 0x31, 0x17, 0x6B, 0x05,
-    0xF5, 0x0C, 0xDE, 0x80, 0x8C, 0xF9, 0x35, 0x68, 0xF2, 0xAC, 0x27, 0x0C, 0xB2, 0x27, 0xD9, 0x93,
-    0x37, 0xC5, 0x9D, 0x90, 0x47, 0x55, 0x05, 0x8A, 0x20, 0xA9, 0x59, 0x16, 0x03, 0xD9, 0x5F, 0x3A,
-    0x08, 0x11, 0x59, 0xFA, 0x4C, 0x76, 0x4F, 0x98, 0xD6, 0xEF, 0x70, 0x0C, 0xC5, 0xDB, 0x76, 0xD2,
-    0x9F, 0xE1, 0x77, 0xAB, 0x96, 0x76, 0x67, 0x21, 0x5B, 0x74, 0x69, 0xA9, 0x2A, 0x3B, 0x41, 0x69,
-    0xDA, 0x09, 0x7F, 0x9A, 0xF7, 0x6C, 0x42, 0xD4, 0x1F, 0xE6, 0xD0, 0xC7, 0xC9, 0xB9, 0xA8, 0xFE,
-    0xAD, 0x10, 0x90, 0x9B, 0x03, 0xE8, 0x63, 0x24, 0x95, 0xE6, 0x73, 0x38, 0xFF, 0xB3, 0xA8, 0xFE,
-    0x3F, 0x38, 0xB9, 0x2E, 0xD4, 0xE4, 0x73, 0xE0, 0x97, 0x2F, 0xEA, 0xC3, 0xDD, 0x67, 0xD9, 0x07,
-    0xD7, 0x0A, 0x16, 0xB2, 0xB1, 0x46, 0x65, 0x13, 0x17, 0xB1, 0xDD, 0xB3, 0x69, 0x5F, 0xD5, 0x11,
-    0x58, 0x8A, 0x67, 0x15, 0x9E, 0x61, 0x1C, 0xD9, 0xB4, 0x6E, 0x44, 0x52, 0x14, 0xFA, 0xEB, 0x6E,
-    0x11, 0x30, 0x19, 0x96, 0xC4, 0xFA, 0x0D, 0xBA, 0x3D, 0xCC, 0xF2, 0xB5, 0x45, 0x96, 0x01, 0x14,
-    0x70, 0xBE, 0xE3, 0x66, 0x78, 0x0E, 0x66, 0xBE, 0xEB, 0x32, 0x5D, 0xE1, 0x5F, 0x68, 0xF1, 0x42,
-    0xF7, 0x9E, 0xE5, 0x4C, 0x86, 0xF8, 0x52, 0x4D, 0x63, 0x38, 0x51, 0xC1, 0x6B, 0xE6, 0xAC, 0xEA,
-    0x95, 0xA8, 0xD9, 0x24, 0x11, 0x7D, 0x0D, 0x83, 0x71, 0x08, 0x91, 0xA9, 0x8B, 0xC2, 0x64, 0x45,
-    0x61, 0xBA, 0xA2, 0x30, 0x61, 0x51, 0x98, 0xB2, 0x28, 0x4C, 0x5A, 0x14, 0xA6, 0x6D, 0x9C, 0xB1,
-    0xA3, 0x9B, 0x21, 0x68, 0x78, 0x62, 0xDB, 0x9C, 0xC0, 0x28, 0x4C, 0x61, 0x14, 0x26, 0x31, 0x0A,
-    0xD3, 0x38, 0x2E, 0xA6, 0x28, 0x4C, 0x65, 0x14, 0x26, 0x33, 0x0A, 0x4B, 0x2A, 0x0A, 0x8B, 0xCA,
-    0x3A, 0x78, 0x7E, 0x4F, 0x39, 0x41, 0xA8, 0x4D, 0x21, 0xC5, 0xB0, 0xCC, 0xA8, 0x2B, 0x11, 0x62,
-    0x5B, 0xE5, 0xDF, 0x35, 0x4A, 0xAC, 0x0F, 0x8F, 0x80, 0xAA, 0xE6, 0x47, 0x40, 0xDD, 0x7A, 0xC1,
-    0x92, 0x30, 0x9C, 0x14, 0x80, 0x59, 0x6A, 0x39, 0xBB, 0x27, 0x84, 0x87, 0x8D, 0x1B, 0x0D, 0xC4,
-    0xB8, 0x3F, 0x3C, 0x7D, 0x24, 0x58, 0xD3, 0xC1, 0xA0, 0x0E, 0x75, 0xBF, 0xC1, 0x20, 0x2D, 0xEA,
-    0xD9, 0x21, 0x0C, 0x86, 0x02, 0x6F, 0x55, 0x82, 0xE3, 0xC1, 0x79, 0x72, 0xB7, 0x26, 0xE3, 0x4D,
-    0x67, 0x4B, 0x31, 0x0D, 0x67, 0x59, 0x0A, 0x95, 0x5B, 0x0F, 0x5C, 0x87, 0x23, 0x2C, 0x37, 0x87,
-    0x47, 0x58, 0xBA, 0xF1, 0x66, 0x6F, 0xAA, 0xA6, 0xB0, 0xC4, 0x07, 0x12, 0x2D, 0x35, 0xA0, 0x08,
-    0xE1, 0xC9, 0xAE, 0xEC, 0x86, 0x47, 0x12, 0x23, 0x13, 0xB5, 0x35, 0x5C, 0xF2, 0xA2, 0x5B, 0x8B,
-    0x6A, 0x59, 0x6F, 0xD8, 0xE4, 0x49, 0x3F, 0x1E, 0xF8, 0x10, 0xEB, 0x51, 0xF1, 0xA0, 0xEC, 0x88,
-    0x88, 0xD6, 0x14, 0x1E, 0x95, 0xF4, 0xD6, 0xD3, 0xA4, 0xB3, 0x9E, 0x8E, 0xF9, 0x3F, 0x23, 0x74,
-    0x73, 0x38, 0x02, 0x69, 0x4C, 0x01, 0x0A, 0x07, 0xCD, 0x3D, 0x5D, 0x68, 0x2A, 0xE3, 0x11, 0xD8,
-    0xDC, 0x22, 0xAC, 0xB8, 0xA9, 0xC3, 0x11, 0x16, 0xF9, 0x0C, 0xD2, 0xD5, 0xCF, 0x38, 0xF2, 0x73,
-    0x0F, 0xCE, 0xFB, 0xDA, 0x5B, 0x52, 0x3D, 0x27, 0xF9, 0xEE, 0x0B, 0x56, 0x4D, 0x6C, 0x55, 0xC5,
-    0xBB, 0xA5, 0x4D, 0xFA, 0x54, 0xA3, 0x95, 0x1B, 0x83, 0x63, 0xD9, 0x4F, 0xBE, 0x51, 0xBE, 0xB7,
-    0xC2, 0x8E, 0xAC, 0xD1, 0x22, 0x50, 0x88, 0x6F, 0x4B, 0x9D, 0x9B, 0xD6, 0xAD, 0x19, 0x8E, 0xA5,
-    0xB4, 0x91, 0xDF, 0x8B, 0x35, 0x5A, 0x34, 0x72, 0x33, 0x61, 0xCE, 0xEC, 0x0C, 0x3E, 0x6B, 0x84,
-    0xCD, 0x3A, 0xD7, 0x53, 0xBC, 0x31, 0x55, 0x37, 0x95, 0x18, 0xBD, 0x25, 0x51, 0xB2, 0xB1, 0x60,
-    0xF2, 0xC6, 0x46, 0xBC, 0x31, 0x4B, 0x74, 0xED, 0xDA, 0xE8, 0x9C, 0x84, 0x35, 0x02, 0x27, 0x59,
-    0xE1, 0x6D, 0x13, 0xCE, 0x02, 0x2E, 0xDD, 0xFF, 0xDC, 0xD3, 0x24, 0x62, 0x32, 0xDA, 0xE2, 0x2F,
-    0x7C, 0xFF, 0xB7, 0x09, 0x60, 0x45, 0xA0, 0xB7, 0x27, 0x28, 0x0E, 0xE8, 0x91, 0x45, 0x7F, 0x7B,
-    0x00, 0xDE, 0xC4, 0xDA, 0x15, 0x2D, 0x8A, 0x4A, 0x8B, 0x06, 0x65, 0x1E, 0x80, 0x9E, 0x42, 0x82,
-    0x61, 0xD2, 0x6D, 0x70, 0x6D, 0xE3, 0x1E, 0x57, 0xAF, 0xCB, 0xD4, 0x48, 0x10, 0x2C, 0xFD, 0x67,
-    0x8A, 0x1A, 0xF5, 0x29, 0x18, 0xEB, 0x86, 0xAE, 0xF3, 0x2F, 0x38, 0x67, 0x00, 0xF0, 0x6B, 0x17,
-    0xC0, 0x03, 0x2C, 0x49, 0xC7, 0x77, 0xE8, 0xC4, 0x6C, 0xD7, 0x4F, 0x5F, 0x55, 0xE2, 0xA9, 0x25,
-    0x22, 0xA9, 0xB0, 0xC9, 0x5C, 0x41, 0x77, 0x9F, 0x65, 0x14, 0xF9, 0x52, 0x4E, 0x4B, 0x19, 0xE5,
-    0x17, 0xF8, 0x10, 0xEA, 0x3D, 0x51, 0x1E, 0x96, 0xFD, 0x03, 0x92, 0x9F, 0x91, 0x55, 0x5F, 0x34,
-    0x45, 0x85, 0xF8, 0x78, 0xF1, 0x22, 0xA2, 0xE3, 0xC5, 0x4B, 0x48, 0x08, 0x2E, 0x5E, 0x86, 0x03,
-    0x32, 0xFB, 0x61, 0x47, 0xD5, 0x12, 0xAF, 0x2D, 0xCD, 0x4D, 0x73, 0x2B, 0x1C, 0x8E, 0x5B, 0xCA,
-    0xFB, 0x7C, 0xD5, 0xD2, 0x55, 0xAE, 0xCE, 0xA8, 0x77, 0xE7, 0xBE, 0x11, 0xEE, 0xFD, 0xCF, 0x31,
-    0xC2, 0x7D, 0xF5, 0xBE, 0x07, 0x75, 0x14, 0x9C, 0xFA, 0x54, 0x9B, 0x42, 0x7B, 0xA4, 0x1E, 0xAF,
-    0xBF, 0x42, 0x7E, 0x92, 0x88, 0x43, 0x8A, 0x5B, 0xF4, 0xF3, 0x1C, 0x9F, 0x33, 0x71, 0xEE, 0xD5,
-    0xFD, 0xE3, 0xDC, 0xC5, 0xC5, 0x71, 0xEE, 0xCF, 0xD1, 0x83, 0x46, 0xD8, 0xF2, 0xC6, 0xB4, 0xB2,
-    0x12, 0xEE, 0xF5, 0xCD, 0x68, 0xD8, 0x31, 0xC1, 0x93, 0xD6, 0x9D, 0x0C, 0xBB, 0x6E, 0x6E, 0xD8,
-    0x4D, 0x89, 0xD4, 0x0F, 0x7C, 0xF2, 0x48, 0xFC, 0x9E, 0x30, 0x0A, 0xC5, 0x83, 0xC2, 0x28, 0x9C,
-    0xDE, 0x00, 0x6D, 0xE9, 0xC1, 0xB3, 0x28, 0xBD, 0xCA, 0xB2, 0xEF, 0xE3, 0xEF, 0x1F, 0x5F, 0x7E,
-    0x25, 0x4F, 0x77, 0xD1, 0x75, 0x3F, 0xD2, 0xEC, 0x25, 0x78, 0x22, 0x1A, 0x56, 0x82, 0x0E, 0xAC,
-    0xD0, 0x43, 0x29, 0x68, 0xA6, 0x6A, 0x7E, 0xC0, 0xF2, 0x81, 0x4D, 0xFA, 0x3D, 0x44, 0x6C, 0x59,
-    0xA2, 0x0C, 0x13, 0x0A, 0x7B, 0xAF, 0x63, 0x17, 0x15, 0xCA, 0xD1, 0xF9, 0x8B, 0x82, 0xE5, 0x1B,
-    0x91, 0xAE, 0xCE, 0x02, 0x5C, 0xE9, 0x26, 0x6B, 0x2F, 0x44, 0xBA, 0xCA, 0xFA, 0xDC, 0x30, 0x11,
-    0x55, 0xA1, 0x54, 0xDB, 0x0D, 0x80, 0xAF, 0x08, 0x9E, 0x43, 0xB3, 0x2C, 0x3F, 0x3C, 0xC6, 0x63,
-    0xBA, 0x59, 0x0F, 0x73, 0x3F, 0xF3, 0xC1, 0x4D, 0x88, 0x77, 0x4D, 0x37, 0x97, 0x08, 0x99, 0xB9,
-    0xA4, 0x37, 0x6B, 0xCD, 0x42, 0x28, 0xA1, 0x50, 0xA6, 0xD4, 0x5C, 0x8A, 0xD6, 0xB4, 0x67, 0xE4,
-    0xED, 0x7B, 0x2A, 0x0F, 0x6B, 0x6A, 0xFF, 0xD2, 0x1B, 0x53, 0x6A, 0xF0, 0x50, 0xEF, 0xA5, 0x7C,
-    0x2D, 0x9C, 0x19, 0x2A, 0xDB, 0xD1, 0x27, 0x21, 0xEF, 0x47, 0x71, 0xD1, 0x69, 0x11, 0xC7, 0xDE,
-    0xF5, 0xE5, 0x05, 0x9E, 0x63, 0x84, 0xDA, 0x4E, 0x22, 0x4B, 0xC1, 0xE3, 0x49, 0x83, 0x3A, 0x37,
-    0x33, 0x25, 0x4D, 0x12, 0x1E, 0x1A, 0xA3, 0x3C, 0xE2, 0xF8, 0x30, 0x8F, 0xB8, 0x0F, 0x79, 0xC4,
-    0x9B, 0x59, 0x1E, 0xF1, 0x7A, 0x96, 0x47, 0xBC, 0xB2, 0xD3, 0xC7, 0x8E, 0xF3, 0x88, 0x97, 0x96,
-    0x47, 0xFC, 0xD3, 0x7B, 0xFE, 0x79, 0x6C, 0x45, 0x4F, 0x90, 0x6F, 0xC2, 0x5F, 0x39, 0xE1, 0x3B,
-    0x05, 0x0F, 0x27, 0x8F, 0x8C, 0x86, 0x74, 0x41, 0x35, 0x23, 0xB5, 0xF3, 0x82, 0xAA, 0x7A, 0x46,
-    0x97, 0x86, 0x74, 0xF9, 0x94, 0x9D, 0x53, 0xB9, 0xA8, 0x6A, 0x47, 0xE3, 0x59, 0x56, 0x0E, 0x7D,
-    0x33, 0x8F, 0xDC, 0xC4, 0x16, 0xC8, 0xC2, 0xD1, 0x9E, 0x86, 0xF2, 0x1D, 0xB0, 0xBE, 0xCF, 0x71,
-    0xAD, 0xCF, 0x1D, 0xD8, 0xCC, 0x62, 0x8E, 0x54, 0xC9, 0x8A, 0xD4, 0xAB, 0xC6, 0x8E, 0x4D, 0x2B,
-    0x29, 0x50, 0x0B, 0x96, 0x3A, 0x17, 0xF4, 0x55, 0x13, 0xC7, 0x08, 0x85, 0x57, 0x8C, 0xE7, 0xE2,
-    0x19, 0x19, 0x61, 0xCF, 0xD3, 0x9A, 0x0C, 0x8D, 0x8E, 0xD2, 0xE4, 0x1D, 0x32, 0x1E, 0x4B, 0x26,
-    0x3F, 0xEE, 0x73, 0x3C, 0xE3, 0xB6, 0x5C, 0xBB, 0xC9, 0x78, 0x90, 0x6D, 0x35, 0xC1, 0xDE, 0x33,
-    0x89, 0xB2, 0x7F, 0xAF, 0xF8, 0xC3, 0x7D, 0x8F, 0xA9, 0x29, 0xC2, 0x31, 0x35, 0xCD, 0xE1, 0x31,
-    0x35, 0x49, 0x97, 0xDA, 0x31, 0x35, 0xC5, 0xFB, 0x3A, 0xA6, 0x66, 0x63, 0x6D, 0x28, 0xB4, 0xC8,
-    0xA6, 0x63, 0x6A, 0xD4, 0x9F, 0xEF, 0xDB, 0x62, 0xF8, 0x86, 0x49, 0x12, 0x53, 0xAE, 0xED, 0x98,
-    0x1A, 0x10, 0xD5, 0xCB, 0x40, 0x1E, 0x53, 0x43, 0xE5, 0xA3, 0xA2, 0xCE, 0x4F, 0x83, 0x5B, 0x25,
-    0x1E, 0x82, 0xEC, 0x39, 0xA8, 0xD8, 0xB1, 0xC2, 0xEF, 0x00, 0x4D, 0x62, 0x3A, 0xC5, 0xA4, 0x63,
-    0x6C, 0x0F, 0x52, 0x3C, 0xB8, 0x0E, 0xFD, 0x44, 0x02, 0xD7, 0x11, 0x28, 0xF1, 0xFD, 0x68, 0xEE,
-    0x23, 0x0B, 0xBD, 0x1E, 0xFD, 0x5D, 0x2B, 0x79, 0x0B, 0xCC, 0xED, 0x12, 0x59, 0x66, 0xA0, 0x22,
-    0xD4, 0x01, 0xD7, 0x31, 0x0B, 0x47, 0x6C, 0x5A, 0xAE, 0xE0, 0x76, 0xA2, 0x50, 0x6C, 0xD6, 0x66,
-    0x27, 0x8B, 0xB2, 0x29, 0x34, 0xAC, 0x4C, 0xA3, 0x92, 0x7C, 0x66, 0x32, 0x39, 0xBC, 0xB6, 0x36,
-    0x24, 0xF3, 0xC8, 0xBE, 0x67, 0x29, 0xCE, 0x1C, 0xB2, 0x72, 0x61, 0x15, 0x66, 0x5E, 0x29, 0x61,
-    0x32, 0x72, 0x8A, 0x84, 0x25, 0x07, 0xE5, 0x04, 0x1A, 0x87, 0xB7, 0xD2, 0x21, 0xCA, 0x8B, 0xFA,
-    0xFE, 0x27, 0xF3, 0x54, 0xE3, 0xC9, 0x3C, 0xED, 0x45, 0x67, 0x2D, 0x1F, 0x9C, 0xCC, 0x23, 0xDD,
-    0x57, 0xA7, 0xE5, 0x44, 0xA6, 0xF7, 0xA6, 0x87, 0xE6, 0x29, 0x9E, 0x70, 0xEB, 0xB4, 0x84, 0x9B,
-    0x9A, 0xDD, 0x10, 0x0A, 0x4D, 0x1D, 0x07, 0x2C, 0x9A, 0x11, 0x3B, 0xFC, 0x7E, 0xD6, 0xE6, 0x99,
-    0x62, 0xAB, 0xCD, 0xC0, 0xE2, 0xD3, 0x4B, 0xD7, 0xB0, 0x1B, 0x34, 0x72, 0xB8, 0xD4, 0xDC, 0x90,
-    0xB5, 0x8F, 0x95, 0xC3, 0xF3, 0xE7, 0xA2, 0xBF, 0x94, 0x73, 0xD3, 0x74, 0xAF, 0xF3, 0x0D, 0x03,
-    0x5C, 0xA0, 0x10, 0xE3, 0xB6, 0x4A, 0x1A, 0x45, 0xBD, 0x15, 0xAE, 0xFB, 0xD2, 0xFD, 0xE9, 0x52,
-    0x79, 0xA3, 0xCE, 0xBD, 0xC3, 0xB8, 0xF8, 0x8B, 0x08, 0x9C, 0x0D, 0x78, 0xD4, 0xE2, 0xEA, 0xA1,
-    0x09, 0xBA, 0x9F, 0x9C, 0xE8, 0xEA, 0xBE, 0x99, 0xA0, 0x5B, 0x85, 0x96, 0x64, 0xD7, 0xC9, 0xA8,
-    0xD3, 0x1C, 0x8C, 0xA7, 0x0D, 0x09, 0xDC, 0x40, 0xD0, 0x06, 0x4B, 0x4A, 0x2D, 0x5D, 0x57, 0x14,
-    0x5C, 0xAA, 0xE9, 0x64, 0x99, 0x97, 0x25, 0x8D, 0xE2, 0x48, 0x92, 0xE1, 0x71, 0x78, 0x6A, 0xC6,
-    0x33, 0x61, 0xA6, 0x33, 0x87, 0xE8, 0xED, 0xB8, 0x74, 0x71, 0xE8, 0x0D, 0xCA, 0xA5, 0xD6, 0xF1,
-    0xC2, 0xC9, 0xC1, 0x6C, 0xD7, 0x8B, 0x44, 0x4D, 0x75, 0x11, 0x3B, 0x87, 0x81, 0x79, 0x8D, 0x42,
-    0x97, 0x25, 0xC1, 0xA4, 0x34, 0x09, 0x4D, 0x3A, 0x33, 0x2B, 0x97, 0xB2, 0x1E, 0xA9, 0xA3, 0x15,
-    0x61, 0x25, 0xDD, 0xE0, 0xE8, 0x69, 0x82, 0xE3, 0xE6, 0x1E, 0x16, 0xFE, 0x2B, 0x5E, 0x1F, 0x78,
-    0x7E, 0xA6, 0x63, 0x0C, 0xCF, 0x19, 0xEF, 0x4E, 0x15, 0x1A, 0xE5, 0xA5, 0x0D, 0x41, 0x0C, 0x12,
-    0x9A, 0x17, 0x12, 0x9B, 0x3B, 0x44, 0xA8, 0x54, 0x15, 0x39, 0xF3, 0x05, 0x24, 0xAE, 0x8F, 0x48,
-    0x8C, 0xE0, 0x53, 0x77, 0x89, 0x24, 0x4E, 0x99, 0x52, 0x9D, 0x31, 0x3B, 0xF7, 0xB3, 0xF0, 0x45,
-    0xD5, 0x7F, 0x0C, 0x12, 0xB7, 0x5F, 0x4D, 0x9C, 0x55, 0x07, 0x17, 0xBC, 0xEA, 0x70, 0xA7, 0xC4,
-    0x48, 0x3C, 0xD0, 0x5F, 0xC9, 0xD8, 0xCE, 0x8A, 0x8C, 0x7D, 0xC5, 0xE3, 0xDE, 0xD7, 0x3B, 0x56,
-    0xDC, 0xF0, 0x50, 0x8B, 0x4D, 0x75, 0xEE, 0xB1, 0x4E, 0x81, 0x64, 0x29, 0xBD, 0x19, 0x2D, 0xD7,
-    0x27, 0x97, 0x27, 0x57, 0xA7, 0xFB, 0x51, 0xED, 0xE9, 0xF6, 0xB7, 0x6F, 0xFB, 0xCB, 0xEB, 0xAF,
-    0x7B, 0xE2, 0xBD, 0x73, 0xDB, 0x93, 0x6C, 0x84, 0xF7, 0x00, 0xC9, 0xF2, 0x18, 0xAC, 0x73, 0x51,
-    0x7E, 0x1E, 0x7E, 0x31, 0x96, 0xF9, 0x63, 0x84, 0x29, 0x06, 0xF8, 0xDB, 0x93, 0x62, 0x68, 0x90,
-    0x39, 0xEF, 0x21, 0x11, 0x2E, 0xCC, 0x0B, 0xFD, 0x5E, 0x79, 0x47, 0x31, 0x3E, 0x86, 0x3E, 0x04,
-    0x1D, 0x02, 0x53, 0xD8, 0xDD, 0xC6, 0x1E, 0xDE, 0x11, 0x2E, 0x82, 0x84, 0x3D, 0x4B, 0xDE, 0x7E,
-    0x4E, 0xDE, 0x71, 0x05, 0x57, 0x3A, 0xB3, 0x52, 0x27, 0xB5, 0x6B, 0x05, 0x3B, 0xB1, 0x90, 0x33,
-    0x3E, 0xD3, 0x8B, 0x0F, 0xBD, 0xB1, 0xB5, 0x0C, 0xF8, 0x91, 0xEC, 0x6D, 0xE2, 0x43, 0xDF, 0x73,
-    0x82, 0xF2, 0xA0, 0xC3, 0x0C, 0xB0, 0x23, 0x4E, 0x90, 0x90, 0x0D, 0xAF, 0xFB, 0xF1, 0x9C, 0xEF,
-    0x43, 0xBC, 0xEE, 0xE8, 0x1C, 0xBC, 0xEE, 0xFE, 0x81, 0xF0, 0xBA, 0x0F, 0x12, 0xDA, 0xC5, 0x8F,
-    0x92, 0xE9, 0x28, 0x84, 0xCE, 0x22, 0xA3, 0xAA, 0x06, 0x1B, 0x4A, 0xA9, 0x20, 0x02, 0xE4, 0xCA,
-    0x88, 0x1E, 0x9A, 0xC1, 0x81, 0x8D, 0x24, 0xE6, 0x9D, 0xCE, 0x7A, 0x2C, 0x5F, 0x64, 0x52, 0x4E,
-    0xE4, 0xA7, 0xB3, 0xBA, 0x4C, 0x18, 0x6B, 0x69, 0xFC, 0xA5, 0x01, 0x03, 0x64, 0x86, 0xB7, 0x41,
-    0x86, 0xF9, 0x06, 0x1F, 0x77, 0xFA, 0xEC, 0xA4, 0x34, 0x8D, 0x6C, 0x70, 0xD6, 0x06, 0xC1, 0x56,
-    0x8D, 0x45, 0x57, 0x97, 0xD8, 0xAD, 0xE1, 0x4B, 0xA3, 0x33, 0x2A, 0x9A, 0xB0, 0x30, 0xE4, 0xFE,
-    0x50, 0xBF, 0xDF, 0x98, 0xA5, 0x89, 0xD8, 0xE1, 0xBF, 0x02, 0x89, 0xD8, 0x84, 0x0C, 0x05, 0x28,
-    0x5C, 0x7D, 0x02, 0x14, 0x7A, 0xBF, 0x97, 0x8B, 0x6F, 0x40, 0x7F, 0x2F, 0x9F, 0x82, 0xCE, 0x5E,
-    0xFA, 0x1D, 0x5C, 0x52, 0xE0, 0x08, 0x34, 0x46, 0x87, 0x77, 0x0F, 0x20, 0xD2, 0x70, 0xE3, 0x30,
-    0x39, 0x45, 0x96, 0xA2, 0xE7, 0xAE, 0xEB, 0x00, 0x73, 0xB1, 0x1A, 0x21, 0x53, 0xA8, 0xB8, 0xDD,
-    0x99, 0xD5, 0x64, 0x7E, 0xCC, 0x69, 0x1D, 0x3C, 0x3E, 0x47, 0xF5, 0xC6, 0x0F, 0xAA, 0xBD, 0xFC,
-    0x72, 0xE7, 0xC8, 0x42, 0x5F, 0xDD, 0x0C, 0xFB, 0xB9, 0x9D, 0x12, 0x02, 0xD3, 0x99, 0x73, 0xD6,
-    0xF2, 0xBA, 0x84, 0xCB, 0x5D, 0xCB, 0x69, 0x15, 0x87, 0xAA, 0x8B, 0xB3, 0x16, 0xEB, 0x7E, 0x6E,
-    0xB1, 0x2E, 0xEF, 0x0F, 0xFC, 0x77, 0x5E, 0xCA, 0x4E, 0xD1, 0x99, 0x8B, 0x28, 0x1D, 0x4D, 0xFD,
-    0xCC, 0x85, 0x54, 0xC4, 0x36, 0x32, 0x02, 0xC6, 0xED, 0x32, 0xCC, 0x65, 0x6F, 0x20, 0xDF, 0x16,
-    0xC9, 0x32, 0x1D, 0x2E, 0x44, 0x84, 0x1F, 0x1D, 0x2E, 0xCA, 0x59, 0xFD, 0xC7, 0x13, 0xDC, 0x0F,
-    0x4F, 0x70, 0x5F, 0x38, 0x66, 0xE5, 0xEA, 0xAE, 0x08, 0x75, 0xF3, 0x79, 0xC8, 0x20, 0x70, 0x63,
-    0xE9, 0x5D, 0x31, 0x26, 0xB4, 0x6C, 0xA6, 0xC0, 0xFB, 0xA7, 0x8E, 0xA8, 0xFB, 0x71, 0x3E, 0xC4,
-    0xE6, 0x01, 0xE3, 0xF8, 0xBB, 0x9F, 0x2A, 0x8E, 0x6F, 0xB0, 0x0F, 0xAE, 0x1F, 0xC1, 0x60, 0x56,
-    0xCE, 0x36, 0xF2, 0xF6, 0x51, 0x9D, 0x5F, 0xB7, 0x70, 0xA6, 0xCA, 0x5B, 0xB8, 0xA8, 0x0D, 0xC7,
-    0x22, 0xB2, 0x61, 0xB1, 0x67, 0x38, 0x0D, 0x71, 0x6A, 0x02, 0x22, 0xE8, 0xA8, 0x30, 0x2C, 0x02,
-    0x38, 0xDE, 0x4E, 0xCB, 0xCE, 0xCF, 0xF3, 0xEF, 0x9E, 0x90, 0x1B, 0xA7, 0xA1, 0x28, 0x45, 0x9A,
-    0xDB, 0xD1, 0xC1, 0xCB, 0x79, 0xA8, 0xFD, 0xB9, 0x20, 0xFE, 0x19, 0x60, 0x15, 0x11, 0xFF, 0xDC,
-    0x1F, 0xC5, 0x3F, 0xCB, 0x6E, 0x06, 0xAE, 0x68, 0x68, 0x49, 0xB5, 0xE1, 0xCD, 0xA0, 0x28, 0x98,
-    0xD4, 0x4E, 0x07, 0x3B, 0xED, 0x52, 0x31, 0xDA, 0xAC, 0xB5, 0x13, 0xA6, 0xE5, 0x07, 0x99, 0x27,
-    0x7A, 0xCE, 0x0E, 0x19, 0xA6, 0x73, 0xF8, 0xB3, 0x37, 0xAD, 0xA2, 0x53, 0x25, 0x90, 0x79, 0xA4,
-    0x04, 0x0F, 0x80, 0x09, 0xCC, 0x96, 0x66, 0x31, 0x8B, 0xEE, 0xCC, 0xDA, 0x70, 0xE4, 0xC0, 0xD2,
-    0x62, 0x3D, 0x48, 0x60, 0xB3, 0xC0, 0x8E, 0x1D, 0x4F, 0x28, 0x3D, 0x66, 0xE3, 0xC6, 0x33, 0x09,
-    0x75, 0x24, 0x61, 0x27, 0x3E, 0x68, 0x85, 0xCC, 0x82, 0x0A, 0x97, 0xEA, 0x4E, 0xC2, 0x95, 0x86,
-    0x03, 0xEA, 0x02, 0x0E, 0xE8, 0x6E, 0x65, 0xEC, 0xD1, 0x98, 0xE3, 0x36, 0xE4, 0x9A, 0xAC, 0x8D,
-    0x3B, 0x92, 0x4B, 0xA6, 0x3A, 0x0C, 0xFE, 0xB7, 0x64, 0x19, 0x98, 0xA9, 0x09, 0x25, 0x92, 0x09,
-    0xB5, 0x34, 0x5D, 0x91, 0xA5, 0x91, 0x0D, 0x52, 0xB3, 0x59, 0xFA, 0x96, 0xB4, 0x87, 0xB8, 0xED,
-    0xA6, 0xF7, 0x04, 0xA9, 0x14, 0xFC, 0xF4, 0xEB, 0xC0, 0x44, 0x6D, 0x47, 0xA7, 0xE2, 0x91, 0x8F,
-    0xB8, 0x67, 0xA7, 0xC4, 0x78, 0x21, 0x5B, 0x1B, 0x60, 0x09, 0xE0, 0xCD, 0x59, 0x91, 0xDA, 0x90,
-    0x63, 0x53, 0x15, 0xB7, 0xC3, 0x55, 0xED, 0x5C, 0x55, 0xAB, 0x16, 0x0D, 0xC4, 0x21, 0x00, 0xB4,
-    0x40, 0x90, 0xEA, 0xD1, 0x2D, 0xC0, 0xC0, 0x42, 0xA0, 0xC7, 0xA7, 0x65, 0xBF, 0x65, 0x30, 0xE0,
-    0x00, 0x84, 0x87, 0x98, 0x62, 0xC5, 0x03, 0x0A, 0x08, 0x08, 0x07, 0x90, 0x64, 0x0C, 0x69, 0x35,
-    0x1C, 0x60, 0x71, 0x9C, 0x97, 0x72, 0x72, 0x60, 0x7F, 0x8E, 0x08, 0xB6, 0xD9, 0xB9, 0x07, 0xA4,
-    0xEF, 0x1F, 0xE4, 0x80, 0xF4, 0x29, 0x9C, 0xFB, 0xF8, 0xCF, 0x16, 0xCE, 0xBD, 0xE8, 0x34, 0x5D,
-    0xEB, 0x43, 0x7A, 0xD8, 0x87, 0xF6, 0xC8, 0x6A, 0xDE, 0x84, 0xE4, 0xBC, 0x68, 0x2C, 0x20, 0xFB,
-    0xEC, 0x37, 0x9D, 0x5C, 0xD7, 0x64, 0x20, 0x99, 0x78, 0x9F, 0x45, 0xC2, 0x53, 0x0B, 0xA7, 0x9C,
-    0x04, 0x30, 0xCE, 0x9F, 0x5F, 0x70, 0xB7, 0x9F, 0xE9, 0xDA, 0x21, 0x9F, 0x7B, 0x6E, 0xAC, 0x1F,
-    0x9A, 0xA1, 0x01, 0xFF, 0xCA, 0x8F, 0xED, 0x2F, 0x4A, 0xCB, 0x3C, 0x8B, 0xEC, 0x90, 0x37, 0xE1,
-    0xC4, 0xFB, 0x05, 0x98, 0x1F, 0x60, 0xFD, 0x7D, 0x78, 0x63, 0xF1, 0xAE, 0xB3, 0x20, 0xF3, 0x41,
-    0x2C, 0xBE, 0x56, 0x2C, 0x7E, 0xEE, 0xE9, 0x59, 0x85, 0x20, 0xD7, 0x1C, 0x59, 0xC6, 0x22, 0x87,
-    0x06, 0x1A, 0x10, 0x74, 0x80, 0x7D, 0xF4, 0x0B, 0x89, 0xC5, 0x3F, 0xCF, 0x58, 0x7C, 0x3F, 0x8B,
-    0xC5, 0xD3, 0xE2, 0x77, 0x33, 0xE7, 0x87, 0x99, 0xB9, 0x93, 0xB7, 0xD7, 0xCC, 0xBA, 0x99, 0x73,
-    0xD2, 0x77, 0xF3, 0x67, 0x76, 0x84, 0xE4, 0x3F, 0x85, 0x23, 0xE4, 0xD8, 0xEC, 0x5D, 0x9E, 0x2A,
-    0x09, 0xC5, 0x4E, 0xBF, 0xDC, 0x45, 0x8A, 0x86, 0x58, 0x24, 0xE4, 0xAC, 0x09, 0x7A, 0x91, 0x3B,
-    0x38, 0x80, 0xFE, 0x7D, 0xB0, 0x8E, 0x90, 0x47, 0x6E, 0xF6, 0xA3, 0xF7, 0xA3, 0x33, 0x94, 0xD9,
-    0xD2, 0xF0, 0xEC, 0x74, 0x59, 0x28, 0x5A, 0x9B, 0x5B, 0x08, 0x63, 0x35, 0x9E, 0x1F, 0x2B, 0xE4,
-    0xCB, 0x35, 0x53, 0xCC, 0x28, 0x21, 0x6B, 0xF9, 0x29, 0x63, 0xC5, 0x41, 0xB7, 0xBA, 0x71, 0x86,
-    0x67, 0xB1, 0x0C, 0x37, 0xAB, 0x70, 0x16, 0x03, 0x21, 0x12, 0xB2, 0x7B, 0x5E, 0x50, 0xDE, 0x83,
-    0x68, 0x78, 0xAB, 0x15, 0x1E, 0x46, 0xE1, 0x6F, 0x10, 0x54, 0x8C, 0xCA, 0xD7, 0xBC, 0xE1, 0x04,
-    0x0C, 0x37, 0xF7, 0x8A, 0xE7, 0xC7, 0x4F, 0xE0, 0xE6, 0xBB, 0x5E, 0x59, 0x81, 0xEE, 0xEF, 0x6F,
-    0x56, 0x7D, 0x86, 0x53, 0x92, 0x9F, 0xEA, 0x88, 0xFE, 0xBF, 0x74, 0x9F, 0xEF, 0x92, 0x86, 0xB8,
-    0x72, 0xAB, 0x0E, 0xD0, 0x5F, 0xBC, 0x29, 0x76, 0xA5, 0x6E, 0x80, 0x6F, 0x16, 0xAD, 0x87, 0x55,
-    0x4F, 0x84, 0x38, 0x60, 0xFD, 0x41, 0x2B, 0x66, 0x38, 0x02, 0x78, 0x14, 0xBC, 0x69, 0xE1, 0x98,
-    0x4A, 0x50, 0xA6, 0x83, 0xB9, 0x02, 0xF6, 0xF6, 0x1E, 0x9C, 0x9E, 0xA0, 0x2D, 0x6B, 0xC8, 0xB3,
-    0x9A, 0x20, 0x16, 0x67, 0xC2, 0x38, 0x71, 0x7F, 0x8C, 0xB6, 0x31, 0x26, 0x0A, 0x07, 0xCF, 0x71,
-    0x10, 0x6B, 0xA3, 0x5C, 0x13, 0xCB, 0x7C, 0xE4, 0x34, 0x8F, 0x1E, 0x3B, 0xCD, 0x49, 0xB4, 0x92,
-    0x00, 0x00, 0x55, 0xA4, 0x73, 0x0A, 0x98, 0x0E, 0x0C, 0xFD, 0xD3, 0x8E, 0x70, 0xAB, 0x36, 0xD6,
-    0xC6, 0x64, 0x0B, 0x65, 0x05, 0x4A, 0x2D, 0x5D, 0x51, 0x65, 0x44, 0x3F, 0xCC, 0xAA, 0x92, 0xE0,
-    0x87, 0xD9, 0x0E, 0x25, 0x5C, 0xBE, 0xFD, 0x2B, 0x1C, 0xE1, 0xB6, 0x1E, 0xB2, 0xEF, 0x83, 0x48,
-    0x9B, 0x3E, 0x7D, 0x4D, 0x87, 0x23, 0xA4, 0xB7, 0x1B, 0xB5, 0xAE, 0xE6, 0x51, 0x6E, 0xA9, 0x57,
-    0x7F, 0x76, 0x5E, 0x56, 0xA5, 0x70, 0xFE, 0xD4, 0x69, 0x93, 0x78, 0x25, 0x1A, 0xA9, 0xC4, 0x8C,
-    0x53, 0x7B, 0x5D, 0x9D, 0x40, 0xE4, 0xDB, 0x31, 0x21, 0x7C, 0x1E, 0xC6, 0xDA, 0x3C, 0x58, 0x89,
-    0x96, 0x95, 0x29, 0x7D, 0x48, 0xCC, 0xB2, 0xB2, 0x22, 0x1C, 0x4E, 0x59, 0x11, 0xA5, 0xB8, 0xA0,
-    0x2B, 0x2D, 0xFC, 0x51, 0x55, 0xE8, 0xDE, 0x0E, 0x38, 0xA7, 0xC8, 0x6E, 0x1D, 0x34, 0xCF, 0xBD,
-    0x4C, 0xEC, 0x7A, 0xC2, 0x15, 0x0C, 0x6C, 0xC9, 0xDD, 0x56, 0x44, 0xEA, 0x5B, 0xB2, 0xAF, 0xF8,
-    0x82, 0xCD, 0xC0, 0x06, 0xB8, 0x99, 0xA4, 0x90, 0xA1, 0x54, 0xAB, 0x0F, 0x7B, 0x21, 0x0E, 0x55,
-    0x31, 0x15, 0x14, 0x00, 0x96, 0x45, 0x82, 0x20, 0x0B, 0xA0, 0x86, 0x89, 0x1B, 0x0F, 0x3C, 0xD6,
-    0x21, 0xA3, 0x0C, 0x76, 0xDE, 0x05, 0x38, 0x15, 0x0F, 0x3A, 0x67, 0x7D, 0x56, 0xA4, 0xB2, 0x34,
-    0x2B, 0xCC, 0x0A, 0x48, 0x57, 0x2B, 0x21, 0x5D, 0x11, 0xE0, 0xAE, 0x43, 0x6D, 0xAE, 0xBF, 0x42,
-    0x3D, 0x1F, 0x56, 0x63, 0x6E, 0x5F, 0x14, 0x54, 0xE6, 0x1B, 0x87, 0x81, 0xF9, 0xC5, 0x77, 0xF2,
-    0x13, 0x24, 0x03, 0xEC, 0x09, 0x52, 0x75, 0xD7, 0x24, 0x13, 0x42, 0x70, 0x44, 0x78, 0xDF, 0x11,
-    0xAD, 0x26, 0xD7, 0x99, 0x78, 0x49, 0x88, 0x43, 0x66, 0x63, 0xDD, 0x5B, 0x10, 0xAF, 0x3A, 0x30,
-    0x56, 0x60, 0x2C, 0x45, 0x03, 0xC9, 0x81, 0x30, 0xDB, 0x8E, 0x05, 0x70, 0x21, 0x14, 0x96, 0xB8,
-    0x81, 0xDC, 0xA2, 0x25, 0x92, 0x08, 0x5E, 0x68, 0x87, 0x9D, 0x8C, 0x3F, 0xF1, 0x9E, 0xD5, 0x99,
-    0x69, 0xCD, 0xDA, 0x54, 0x20, 0xF9, 0x4D, 0xFF, 0xF7, 0xF0, 0xF6, 0xB1, 0x8F, 0xD5, 0x44, 0xD9,
-    0xCF, 0xB0, 0x6A, 0x03, 0x1C, 0x95, 0x5D, 0x05, 0xE1, 0xF4, 0xDC, 0xF2, 0xB8, 0x68, 0xFC, 0xC3,
-    0x31, 0x51, 0xC9, 0x68, 0xD8, 0x66, 0x67, 0x4D, 0xDC, 0x45, 0x80, 0x2A, 0x36, 0x7C, 0x10, 0x45,
-    0x17, 0x03, 0xC3, 0x4C, 0xFA, 0x80, 0xAC, 0x93, 0x75, 0x81, 0x77, 0x06, 0xF4, 0x0D, 0xAB, 0xB0,
-    0x31, 0x9E, 0x69, 0x0C, 0x15, 0xF2, 0xD8, 0x59, 0xE8, 0xD2, 0xAA, 0x02, 0x78, 0x7A, 0xB6, 0x1D,
-    0x3C, 0xCC, 0x03, 0x34, 0x74, 0xAE, 0xC8, 0xC2, 0x11, 0x3B, 0x70, 0x19, 0x5E, 0x3A, 0xA2, 0x94,
-    0x5A, 0xA2, 0xD7, 0x36, 0xE0, 0x49, 0x19, 0x9E, 0xCA, 0xA0, 0x04, 0xB3, 0x28, 0x38, 0x8C, 0xA5,
-    0xEC, 0xC4, 0xEE, 0x94, 0x99, 0xB5, 0xA1, 0xEA, 0x68, 0xA3, 0x83, 0x96, 0x91, 0x61, 0x35, 0x44,
-    0x56, 0x48, 0x9A, 0xE9, 0xAC, 0x27, 0x82, 0x1F, 0xFA, 0x19, 0xC1, 0x31, 0x46, 0x7E, 0x4E, 0x06,
-    0x05, 0x79, 0xEF, 0x3A, 0x2B, 0xE9, 0x11, 0x2A, 0xF6, 0x5D, 0x54, 0xF7, 0xB7, 0x8C, 0xC6, 0x6D,
-    0x91, 0xE7, 0x0A, 0x37, 0x48, 0xDA, 0xEA, 0x2C, 0x4B, 0xC0, 0xEC, 0x09, 0x07, 0x3A, 0xEB, 0x54,
-    0x48, 0x99, 0xA9, 0xC8, 0x31, 0x67, 0xA2, 0x81, 0x23, 0x32, 0x7B, 0xE1, 0xEE, 0xE4, 0x36, 0x57,
-    0x91, 0x9D, 0xB0, 0x15, 0x71, 0xBE, 0xA8, 0x64, 0xF7, 0x30, 0x7C, 0xFF, 0x99, 0xF9, 0x18, 0x05,
-    0x36, 0xAD, 0x44, 0xAA, 0xCE, 0x10, 0x83, 0xF6, 0x7D, 0x0A, 0xA7, 0xE0, 0x95, 0x20, 0xBA, 0xC5,
-    0x0E, 0xC5, 0x0D, 0xC5, 0x0C, 0xB3, 0xA0, 0x99, 0x9C, 0xC7, 0x09, 0xDF, 0x47, 0x31, 0xD6, 0xD9,
-    0xBA, 0xB4, 0x66, 0x82, 0x3B, 0x19, 0x61, 0x7D, 0x6B, 0x83, 0x3B, 0x81, 0x82, 0x7B, 0xF5, 0xC1,
-    0x22, 0xF8, 0x7A, 0x95, 0x41, 0x38, 0x05, 0xA8, 0xCB, 0x3C, 0xE0, 0xB9, 0xAE, 0x7A, 0xB8, 0x83,
-    0xFC, 0x95, 0x19, 0xB3, 0x4B, 0x22, 0x61, 0x5B, 0xE5, 0x97, 0x98, 0xDD, 0xEE, 0x90, 0xD9, 0x45,
-    0x7F, 0x78, 0x67, 0x0C, 0xA0, 0xA6, 0x01, 0x2C, 0x17, 0x9A, 0x60, 0xC3, 0x63, 0xD1, 0x2B, 0x19,
-    0xF7, 0x82, 0xCA, 0xA7, 0x7F, 0x62, 0x71, 0xF6, 0x28, 0x78, 0x42, 0xEE, 0xDD, 0xCD, 0x47, 0x2D,
-    0xAD, 0x99, 0x69, 0x6F, 0x7E, 0xCF, 0x05, 0x60, 0xE8, 0x78, 0x56, 0x93, 0xEB, 0xBF, 0xF0, 0xC6,
-    0x11, 0x72, 0xB8, 0x2A, 0x5D, 0xF4, 0x38, 0x0D, 0xC6, 0x5E, 0x70, 0x0B, 0x39, 0x55, 0xBF, 0x67,
-    0xC0, 0x69, 0x21, 0xA5, 0xA9, 0x39, 0xF3, 0x26, 0x02, 0xE4, 0x96, 0x2D, 0x9E, 0xC3, 0x73, 0x8B,
-    0x0C, 0x85, 0xDD, 0xE2, 0x9F, 0x75, 0xE6, 0xDE, 0xF0, 0x0B, 0xBA, 0x80, 0xCE, 0xB0, 0x2B, 0x1B,
-    0x83, 0x7C, 0x8A, 0xE9, 0x60, 0x4A, 0x19, 0xED, 0x83, 0x1B, 0xCE, 0xAB, 0xB7, 0xAD, 0x8D, 0x6E,
-    0x04, 0x10, 0xED, 0x23, 0x3B, 0xA4, 0xCB, 0x8A, 0xA4, 0xB9, 0x28, 0x0A, 0x3B, 0x79, 0x4B, 0x28,
-    0x5F, 0xD1, 0xF0, 0x25, 0xFF, 0x3D, 0xCB, 0x2D, 0x4D, 0xBB, 0x11, 0x3A, 0xBE, 0x93, 0xBF, 0x18,
-    0x3C, 0x12, 0x2B, 0xC7, 0xAF, 0xF7, 0x37, 0x8B, 0x16, 0x20, 0x69, 0x8D, 0x8E, 0x07, 0x43, 0x72,
-    0x1E, 0xB2, 0x00, 0xAA, 0x0C, 0x9E, 0x75, 0x1E, 0xA6, 0x14, 0x0E, 0xD9, 0xC9, 0xE7, 0x47, 0x3C,
-    0x51, 0x0C, 0x6C, 0x03, 0xFB, 0xB7, 0xEB, 0x1E, 0xE4, 0x3A, 0x23, 0x02, 0x3E, 0x2A, 0x54, 0x14,
-    0x03, 0x1F, 0xD6, 0xAD, 0x78, 0xBC, 0x2E, 0xE4, 0xF3, 0xCF, 0x1E, 0xB0, 0xF9, 0x5F, 0x0A, 0xB5,
-    0xAD, 0x4E, 0xAD, 0xDB, 0x04, 0xD0, 0x08, 0x09, 0x20, 0xAA, 0xBC, 0xC1, 0x6D, 0xB3, 0xEE, 0xE2,
-    0x90, 0x48, 0xFA, 0xEC, 0xE5, 0x1B, 0xFF, 0xE8, 0xB6, 0x7E, 0x20, 0xB7, 0xF5, 0xEC, 0x27, 0xDB,
-    0x06, 0xEB, 0xC1, 0x0F, 0xE4, 0xEC, 0xDD, 0x37, 0xC2, 0x5F, 0x1F, 0x8B, 0x9E, 0xBB, 0x28, 0x28,
-    0xF0, 0x71, 0x76, 0x5B, 0x07, 0x83, 0xAA, 0x42, 0x2D, 0x5D, 0xF1, 0x3D, 0x90, 0xBE, 0xFC, 0x2B,
-    0x56, 0xCF, 0xBE, 0x88, 0xEE, 0x3F, 0x12, 0xFD, 0xC7, 0xF3, 0xF6, 0xFD, 0x87, 0xB9, 0x4E, 0xF0,
-    0xCA, 0xB4, 0xC1, 0x56, 0x5D, 0x5C, 0x0B, 0x76, 0x54, 0x17, 0x00, 0x75, 0x2E, 0x9F, 0x79, 0x78,
-    0x8E, 0x75, 0xFB, 0x8B, 0x3D, 0x7B, 0x7E, 0x3D, 0xBA, 0xB6, 0x6B, 0xC3, 0x41, 0x10, 0xD2, 0x74,
-    0x62, 0x8A, 0x92, 0x9C, 0xAE, 0x65, 0x3B, 0xBA, 0xE0, 0xAD, 0xCA, 0xB9, 0x1B, 0x79, 0xE9, 0xCA,
-    0x56, 0x81, 0x25, 0xED, 0xEF, 0x43, 0x4A, 0x34, 0x8E, 0x57, 0x32, 0x41, 0x78, 0x04, 0x07, 0x9D,
-    0x04, 0x50, 0xE8, 0xDF, 0x20, 0xF5, 0xB2, 0x1B, 0x6B, 0xE3, 0x9A, 0xB5, 0xE9, 0x9C, 0xC4, 0x6D,
-    0xC0, 0x63, 0xF6, 0x51, 0x60, 0x4F, 0x97, 0x98, 0x70, 0xAE, 0x03, 0x0B, 0xE6, 0xE9, 0x69, 0xA6,
-    0x7E, 0xD9, 0x5B, 0xEC, 0xC4, 0xAD, 0xDD, 0xA8, 0x33, 0x1C, 0xF4, 0x53, 0x1A, 0xE8, 0x0D, 0x05,
-    0x74, 0xA3, 0xD1, 0x09, 0xE3, 0xAC, 0x80, 0xB8, 0x1E, 0x47, 0x1A, 0x44, 0xC2, 0x19, 0x2C, 0x82,
-    0xB2, 0xB1, 0xF4, 0xF9, 0x67, 0x19, 0x54, 0x2A, 0x6F, 0x95, 0x3A, 0x45, 0x6E, 0x3C, 0xF9, 0x93,
-    0x27, 0x39, 0xFA, 0x25, 0x79, 0x67, 0xBE, 0x42, 0x75, 0x30, 0xD8, 0x58, 0x1E, 0x66, 0x05, 0x76,
-    0xA2, 0x8E, 0xD2, 0xE8, 0x8D, 0xB1, 0xAA, 0x9E, 0x96, 0x78, 0x6E, 0xC0, 0x85, 0x27, 0xDE, 0x54,
-    0xDC, 0xD1, 0x94, 0x49, 0x5A, 0xEE, 0x1D, 0xA2, 0xB3, 0xEA, 0xF4, 0x26, 0xB2, 0x55, 0x96, 0x6E,
-    0x7B, 0xB6, 0xD4, 0xF3, 0x08, 0xF9, 0x98, 0xCD, 0x2E, 0xFB, 0x31, 0x12, 0x15, 0xAA, 0xE2, 0x75,
-    0xD6, 0x71, 0x83, 0xB5, 0x2C, 0xDC, 0x4B, 0xC0, 0xC5, 0x5F, 0xBA, 0xA7, 0x06, 0x16, 0x38, 0x7F,
-    0xB1, 0xA3, 0x61, 0x92, 0x36, 0x7C, 0x57, 0x01, 0x2B, 0x07, 0x39, 0x97, 0xCC, 0x84, 0x75, 0x39,
-    0xD1, 0x62, 0x1C, 0x22, 0xAC, 0xB1, 0x53, 0xEA, 0xAB, 0x23, 0xB0, 0x44, 0xAA, 0x13, 0xA3, 0xA0,
-    0x49, 0x95, 0x7B, 0xD6, 0x2D, 0xD2, 0x4A, 0x30, 0x4F, 0x11, 0x47, 0xB2, 0x76, 0xAA, 0x09, 0x14,
-    0xD0, 0x19, 0xAE, 0x97, 0x4E, 0xC6, 0x92, 0xDE, 0x05, 0xCF, 0x37, 0xFE, 0x59, 0xCE, 0xD5, 0x52,
-    0x66, 0x95, 0x52, 0xFB, 0xC5, 0x78, 0xE9, 0xEB, 0xE2, 0x61, 0x59, 0x55, 0xA4, 0xF3, 0x70, 0x71,
-    0x18, 0x2E, 0xDC, 0x28, 0x77, 0xA8, 0x01, 0xFC, 0x88, 0xB5, 0x38, 0x9F, 0x73, 0xD1, 0xFC, 0xFC,
-    0x2A, 0xF1, 0xD0, 0xA5, 0xE6, 0xE1, 0xF3, 0xAA, 0x98, 0xF9, 0x82, 0x26, 0x87, 0x67, 0x4A, 0x45,
-    0xFF, 0x71, 0xF1, 0xCC, 0x19, 0xEB, 0xF2, 0xA3, 0x3C, 0x39, 0xC6, 0x7C, 0x5A, 0xE4, 0xB2, 0x0B,
-    0x1C, 0x98, 0x27, 0x66, 0xDA, 0xFD, 0x11, 0x03, 0xFA, 0x90, 0x4D, 0xD4, 0x1A, 0xA7, 0x7C, 0x86,
-    0x0E, 0x8F, 0x4D, 0x93, 0x71, 0xD3, 0xDE, 0x78, 0x38, 0xBF, 0x00, 0x4D, 0xF8, 0x02, 0xAC, 0xF0,
-    0xB7, 0x88, 0x15, 0x4E, 0xD0, 0x60, 0xE1, 0x05, 0x2B, 0x38, 0x2A, 0xC3, 0x5C, 0xD8, 0x36, 0xE1,
-    0x50, 0x9C, 0xA9, 0x31, 0x44, 0xE0, 0x00, 0x06, 0x3C, 0x43, 0x4A, 0x1D, 0x02, 0xFA, 0xAF, 0x01,
-    0xFF, 0x1A, 0xE6, 0xAF, 0xC1, 0xFD, 0x1A, 0xD2, 0xEF, 0x08, 0xF2, 0x4B, 0x7C, 0xDF, 0x07, 0xC2,
-    0x0A, 0xA7, 0x16, 0xD6, 0x7B, 0x2D, 0x8C, 0x0A, 0x18, 0x75, 0xAF, 0x55, 0xEF, 0xD5, 0xAE, 0x63,
-    0x8D, 0xEB, 0x42, 0x4C, 0xF1, 0x8A, 0xB9, 0xB5, 0x69, 0x47, 0x7C, 0x5D, 0x22, 0xEB, 0x12, 0x53,
-    0x97, 0x98, 0x31, 0x44, 0xB4, 0x21, 0x82, 0xAE, 0x30, 0xC5, 0x75, 0xF0, 0x3C, 0xCE, 0x01, 0x07,
-    0x52, 0xEE, 0x85, 0x98, 0xE2, 0xFF, 0x08, 0xC6, 0xFE, 0x53, 0x82, 0xB1, 0x1F, 0xD9, 0x32, 0x47,
-    0x2E, 0x2D, 0x99, 0x33, 0xE7, 0xBB, 0xB4, 0x3E, 0x0E, 0x94, 0x9E, 0xD4, 0x9E, 0x0E, 0x4C, 0x0B,
-    0xFB, 0xF7, 0x3C, 0xB5, 0xE7, 0x97, 0x32, 0x23, 0x25, 0xE1, 0x10, 0xA8, 0x72, 0x2F, 0x3C, 0xFB,
-    0xC5, 0xFD, 0x1F, 0xE0, 0x37, 0xFF, 0x69, 0xF1, 0xEC, 0xB1, 0x92, 0xC9, 0x13, 0xA3, 0x67, 0x27,
-    0x83, 0xCB, 0xC4, 0x4C, 0xA9, 0x01, 0xFC, 0xBA, 0x29, 0x99, 0xE7, 0x9C, 0xEB, 0x31, 0x5E, 0x2F,
-    0x52, 0xB4, 0xE2, 0x51, 0xA1, 0xAE, 0x66, 0x4A, 0xCA, 0x76, 0xD2, 0x60, 0x06, 0xAF, 0x26, 0x41,
-    0x95, 0xCA, 0x9E, 0xBE, 0x7E, 0xD6, 0x01, 0xD1, 0x53, 0xC9, 0xBC, 0x11, 0x1D, 0x58, 0x71, 0x5C,
-    0x66, 0x5C, 0x64, 0x5C, 0x62, 0xD9, 0xDE, 0xDF, 0x1D, 0x2D, 0xAF, 0x5F, 0xEC, 0x89, 0xDB, 0x41,
-    0x09, 0x48, 0xE4, 0x86, 0x4B, 0xAD, 0x28, 0xDA, 0xCE, 0x47, 0x3F, 0x39, 0x99, 0x59, 0x8D, 0x30,
-    0xAA, 0x18, 0x72, 0xE7, 0x19, 0x98, 0x3B, 0x02, 0x07, 0x90, 0x4A, 0x24, 0x22, 0xCC, 0x34, 0xC1,
-    0x83, 0x87, 0x7C, 0xC9, 0x54, 0x69, 0x0C, 0x08, 0x56, 0x40, 0x97, 0xEB, 0xD8, 0x73, 0x1D, 0x7D,
-    0x09, 0xCF, 0xAE, 0x0E, 0x69, 0xCC, 0xA4, 0xBE, 0x16, 0x86, 0xAC, 0x27, 0x75, 0x2F, 0xE0, 0xEB,
-    0xE5, 0x13, 0x4C, 0x87, 0x69, 0xFA, 0xA6, 0x04, 0x5A, 0x99, 0xA4, 0xDC, 0xCA, 0x7F, 0x54, 0xAA,
-    0x1C, 0x37, 0x24, 0xDC, 0x75, 0x33, 0xAF, 0xB2, 0x9D, 0xC7, 0x38, 0x2E, 0x2C, 0x1B, 0x6D, 0xAA,
-    0x57, 0x64, 0x17, 0x8E, 0xD6, 0x6A, 0x67, 0xAC, 0x78, 0x26, 0x98, 0xCB, 0x69, 0x2B, 0xBF, 0xA2,
-    0xA4, 0x08, 0x71, 0x7D, 0xD0, 0x2C, 0x34, 0x3E, 0xBA, 0xC8, 0xE2, 0x4E, 0x39, 0x18, 0x04, 0xE3,
-    0xF7, 0x96, 0x04, 0x8D, 0x92, 0x4D, 0xAF, 0xBA, 0xDE, 0x5E, 0xC3, 0xEC, 0x99, 0xB6, 0xBC, 0x1A,
-    0x82, 0x07, 0x36, 0x9F, 0xEA, 0x28, 0x0C, 0xEA, 0xC7, 0xF4, 0xF3, 0x85, 0x3B, 0x4C, 0xB7, 0xD9,
-    0x1D, 0x04, 0xF7, 0x67, 0x99, 0x17, 0x4F, 0xEA, 0xF3, 0x3A, 0x4B, 0x29, 0x1C, 0xCE, 0xAA, 0x6A,
-    0x84, 0xA8, 0x38, 0x72, 0x17, 0xC6, 0xB5, 0x9C, 0xF7, 0x8D, 0x9D, 0x19, 0x7E, 0x1F, 0xE7, 0xFD,
-    0xC7, 0x63, 0xDE, 0x7F, 0x4A, 0x2E, 0xFF, 0x71, 0x5C, 0x05, 0x8F, 0x3D, 0xFB, 0xE4, 0x33, 0x82,
-    0x38, 0xD8, 0xC9, 0x61, 0xC3, 0x24, 0x19, 0x81, 0xAB, 0x35, 0x3C, 0x28, 0x3C, 0xAD, 0x48, 0xA5,
-    0x4B, 0xB3, 0xB0, 0xCF, 0xC7, 0x64, 0x15, 0x3C, 0xF6, 0xCC, 0x29, 0xC6, 0xEE, 0x35, 0x5A, 0x06,
-    0x33, 0xBF, 0x41, 0xC3, 0xB8, 0xDF, 0x30, 0x74, 0xC1, 0xDC, 0xF2, 0x28, 0xAB, 0x58, 0x60, 0x7A,
-    0x65, 0x9E, 0x8E, 0xF8, 0xB1, 0xE5, 0x05, 0x6E, 0xD9, 0x05, 0x33, 0x4B, 0x56, 0xD6, 0x52, 0x46,
-    0xD6, 0x73, 0x47, 0x36, 0xD6, 0x8A, 0x99, 0x1A, 0xAA, 0xFD, 0x61, 0xE9, 0xCF, 0x94, 0xAF, 0xB1,
-    0x60, 0xC5, 0xB7, 0x32, 0xB9, 0x74, 0x26, 0x80, 0xD2, 0xB9, 0x56, 0x0C, 0x90, 0x08, 0xEA, 0x5C,
-    0x6A, 0x3A, 0x92, 0xEF, 0x86, 0xE8, 0x89, 0x50, 0x49, 0x91, 0x1E, 0x64, 0x6A, 0x50, 0xCA, 0x3D,
-    0xF2, 0x7C, 0x71, 0x51, 0xC9, 0xCA, 0xFE, 0x28, 0x19, 0x68, 0x71, 0xA6, 0xF0, 0x91, 0x74, 0xA8,
-    0xD3, 0x2A, 0x4A, 0x1A, 0x60, 0x8A, 0x82, 0xBB, 0x25, 0x38, 0x1B, 0xEE, 0xF2, 0xF6, 0x91, 0xD9,
-    0x48, 0x2E, 0x5D, 0xF3, 0xFF, 0xD2, 0x56, 0x62, 0x02, 0x12, 0x6D, 0x24, 0x9A, 0x48, 0xCC, 0xF4,
-    0xA7, 0x7A, 0x42, 0x37, 0x28, 0xCA, 0xE1, 0xF6, 0x85, 0xD7, 0x70, 0x76, 0x05, 0x8A, 0xDC, 0xE9,
-    0xFB, 0xA0, 0xDB, 0x78, 0xE3, 0x5E, 0x77, 0xDB, 0xC5, 0xE9, 0xFD, 0x31, 0x31, 0x3F, 0x30, 0x88,
-    0xBC, 0x8B, 0x0A, 0x71, 0xA6, 0x78, 0xCC, 0x39, 0x51, 0x19, 0x4B, 0x71, 0x3C, 0x55, 0xC5, 0x60,
-    0x1E, 0x8A, 0x22, 0x53, 0xCB, 0xC5, 0x7B, 0x90, 0x5A, 0x8B, 0x33, 0x49, 0x33, 0xEF, 0x0F, 0x16,
-    0xEF, 0x6C, 0x7A, 0xC0, 0x31, 0xA5, 0x86, 0xE7, 0xCE, 0x14, 0xF9, 0x64, 0x02, 0x68, 0xA9, 0xCF,
-    0xA9, 0xF4, 0x19, 0x8B, 0x7C, 0xAC, 0xD2, 0xE7, 0x48, 0x4A, 0xF5, 0xEB, 0xC6, 0x96, 0xAA, 0x65,
-    0x3E, 0x4C, 0x37, 0xBD, 0xF9, 0xC4, 0x2F, 0x74, 0x89, 0x2B, 0x6B, 0x86, 0x81, 0x44, 0xA3, 0x6F,
-    0x3C, 0x98, 0xC2, 0x17, 0x5B, 0x1E, 0xA7, 0x08, 0xB4, 0x0E, 0xD8, 0x0D, 0x6B, 0x8B, 0x30, 0xF2,
-    0x1B, 0x59, 0x6B, 0x3A, 0x57, 0x48, 0xEA, 0xB4, 0xAC, 0xCE, 0xDE, 0xD0, 0x45, 0xA6, 0xB3, 0x59,
-    0x3B, 0x0B, 0x64, 0xF1, 0xE4, 0x0C, 0x27, 0x68, 0xAC, 0x85, 0xFB, 0x6B, 0x9D, 0xAD, 0xBE, 0xE4,
-    0x39, 0x21, 0x65, 0xAD, 0x1A, 0xE8, 0x5C, 0x89, 0xBA, 0x38, 0x6B, 0x74, 0x2F, 0x73, 0x3F, 0x17,
-    0x34, 0x12, 0xF0, 0x00, 0x68, 0x51, 0x24, 0xCE, 0x7A, 0x5A, 0xF4, 0x0A, 0x85, 0xBE, 0xA0, 0x53,
-    0x77, 0x89, 0x32, 0xB0, 0xB6, 0x10, 0xDC, 0x6E, 0xA3, 0x60, 0x8B, 0x60, 0x43, 0x09, 0xFE, 0x1A,
-    0xBB, 0x83, 0xC1, 0x33, 0xB0, 0x8D, 0x51, 0x6F, 0xBA, 0x39, 0xD9, 0xC6, 0xE8, 0xC2, 0x99, 0x00,
-    0xF7, 0x98, 0x3E, 0xB2, 0x38, 0x09, 0x73, 0x9D, 0x07, 0x0C, 0x1C, 0x9D, 0xC3, 0xED, 0x34, 0xF3,
-    0x3C, 0x61, 0x57, 0xB3, 0xBD, 0xB1, 0x36, 0x76, 0x57, 0x72, 0xA5, 0xE6, 0x3A, 0x1D, 0x2A, 0x63,
-    0xA7, 0xF7, 0xD2, 0x6D, 0x08, 0xC6, 0x3A, 0xBC, 0xC0, 0x73, 0x1C, 0x78, 0x10, 0xBA, 0x4E, 0x42,
-    0x50, 0xDB, 0x30, 0x8B, 0x4A, 0x19, 0xB1, 0x44, 0x34, 0xA2, 0x93, 0x1B, 0x59, 0xA5, 0x80, 0xC9,
-    0xE3, 0xF7, 0x57, 0x8A, 0xE9, 0xB0, 0x6A, 0xD8, 0x53, 0xF7, 0xC6, 0x6A, 0x1E, 0x40, 0xF9, 0x25,
-    0x63, 0x77, 0x9E, 0x6E, 0x83, 0x4B, 0x33, 0xB1, 0x2A, 0x0A, 0xBB, 0xE6, 0xE3, 0x6E, 0x3C, 0x5B,
-    0xFF, 0xC4, 0xFE, 0xFC, 0x56, 0xA9, 0x7C, 0xCD, 0x66, 0x4C, 0x98, 0x50, 0xC9, 0x69, 0x3A, 0xC7,
-    0x35, 0xF8, 0xC0, 0x71, 0x3F, 0x45, 0xAB, 0xDD, 0x0C, 0x1A, 0x20, 0x36, 0x04, 0x98, 0x83, 0x6D,
-    0x8D, 0xA5, 0xF4, 0x2B, 0xE5, 0x60, 0x85, 0xCB, 0x42, 0x19, 0x13, 0xFA, 0x52, 0x1E, 0xCD, 0x10,
-    0x16, 0x3F, 0x2A, 0x85, 0xC7, 0x98, 0x61, 0x14, 0x1E, 0x53, 0x22, 0x3D, 0x40, 0xE1, 0x71, 0x59,
-    0x9F, 0x5B, 0xC2, 0x63, 0x25, 0x3B, 0xCB, 0x27, 0xC6, 0x8E, 0xE6, 0x51, 0x34, 0x1D, 0xDD, 0x14,
-    0x3A, 0xBA, 0x9C, 0x30, 0x16, 0x03, 0x54, 0x0F, 0x0F, 0x4E, 0xEA, 0xCC, 0xD0, 0xC7, 0x39, 0x7E,
-    0x98, 0x86, 0x0D, 0x13, 0xF8, 0x9F, 0x20, 0xF4, 0x94, 0xEB, 0xC6, 0xB3, 0x1C, 0x45, 0x86, 0x62,
-    0xEE, 0x61, 0xB7, 0xDC, 0xF3, 0xC8, 0x8C, 0x75, 0xB3, 0xE9, 0x74, 0xFC, 0xAB, 0xAB, 0xB9, 0x35,
-    0x76, 0xA5, 0xCC, 0x76, 0xD7, 0xA6, 0x10, 0xC4, 0x4D, 0xD1, 0x85, 0x6C, 0x9C, 0x33, 0x65, 0x9F,
-    0xCA, 0xF5, 0x7A, 0xDC, 0xCA, 0xFD, 0xF3, 0xA9, 0xE8, 0xBF, 0x3B, 0xEC, 0xFC, 0xC1, 0x0C, 0x3B,
-    0x3D, 0x23, 0x0B, 0x33, 0xDC, 0xD8, 0x0C, 0xEF, 0x1F, 0x64, 0x86, 0x87, 0x83, 0x19, 0x8E, 0xC7,
-    0x03, 0x6C, 0x5D, 0xD8, 0x39, 0x61, 0xD7, 0x04, 0x89, 0x36, 0x96, 0x58, 0x89, 0xFC, 0x3F, 0x31,
-    0x69, 0xF8, 0xB2, 0x90, 0x4D, 0x05, 0xE8, 0x16, 0x25, 0x76, 0x1E, 0xB5, 0x4E, 0x52, 0xA1, 0xF3,
-    0xCF, 0xD5, 0x3A, 0x1D, 0xAA, 0x6C, 0x94, 0x56, 0x9C, 0x75, 0x0A, 0x9E, 0x50, 0x7D, 0x1D, 0x4C,
-    0x91, 0x7A, 0xC0, 0x19, 0x69, 0xC3, 0x8C, 0x5C, 0x71, 0xEE, 0xCD, 0x7C, 0x2C, 0x48, 0x0C, 0x57,
-    0x3B, 0x43, 0xE9, 0x60, 0x46, 0xB2, 0x9E, 0xF5, 0x54, 0xB5, 0x43, 0x12, 0xE4, 0x8E, 0xA9, 0xAC,
-    0x50, 0x99, 0xD2, 0x61, 0x7A, 0xDB, 0xFF, 0x03, 0xED, 0x9C, 0x31, 0x8F, 0x1C, 0x59, 0x11, 0xC7,
-    0x5F, 0x4F, 0xB3, 0x3B, 0x92, 0x27, 0x68, 0x82, 0x5B, 0x04, 0x76, 0xD0, 0x31, 0x4E, 0xFA, 0x1B,
-    0xB8, 0x9B, 0xBB, 0x2F, 0xB0, 0x42, 0x5E, 0x5D, 0x40, 0xEA, 0x00, 0x4C, 0xE0, 0x4F, 0x70, 0xEA,
-    0x11, 0x17, 0x9C, 0x04, 0x01, 0x1B, 0x91, 0x10, 0xB0, 0x81, 0x83, 0x63, 0x09, 0xEE, 0x0B, 0x70,
-    0xF4, 0x44, 0x10, 0x90, 0x8C, 0x90, 0x10, 0x01, 0xC9, 0x58, 0xF2, 0x91, 0x38, 0x60, 0x90, 0x06,
-    0x34, 0xF6, 0x75, 0xCF, 0xA3, 0xEA, 0xFF, 0xAF, 0xEA, 0xE9, 0x99, 0x5D, 0xC3, 0x5D, 0x80, 0xD9,
-    0x59, 0x7B, 0xB5, 0xF7, 0xDE, 0x9E, 0xB7, 0xA7, 0xFB, 0xBD, 0xFA, 0x55, 0xD5, 0xAB, 0xAA, 0xF7,
-    0x7A, 0x43, 0x08, 0xE3, 0x38, 0x0F, 0xF2, 0x95, 0xC5, 0x85, 0x76, 0x79, 0x5C, 0x6A, 0x57, 0xB2,
-    0xAB, 0xD9, 0xC5, 0xBF, 0x6B, 0x37, 0x8A, 0xBF, 0xD2, 0x2E, 0x8D, 0xF9, 0x4A, 0xBA, 0xC9, 0x06,
-    0x5D, 0xD6, 0xE6, 0x6B, 0xE9, 0x8A, 0x75, 0xA6, 0x5D, 0xB9, 0x44, 0xD7, 0x2C, 0xB2, 0x56, 0x3F,
-    0x36, 0xD3, 0x6E, 0x14, 0xA7, 0xDA, 0xA5, 0xB1, 0xD2, 0x6E, 0x12, 0x63, 0x6C, 0xF5, 0x31, 0x31,
-    0x76, 0xFA, 0x18, 0x74, 0xB5, 0x74, 0x1B, 0xB9, 0xFE, 0xD5, 0xE5, 0x67, 0x9B, 0x90, 0xC8, 0x78,
-    0x26, 0x1B, 0xB9, 0x7E, 0x26, 0x43, 0x93, 0xEF, 0x4A, 0xBB, 0x2C, 0xEA, 0x40, 0x43, 0xDE, 0xE9,
-    0x8D, 0x42, 0x89, 0xFB, 0x85, 0xFD, 0xAF, 0xE3, 0x29, 0xBA, 0x72, 0x85, 0xAE, 0x5E, 0xA3, 0x6B,
-    0xEC, 0xFF, 0x30, 0x91, 0x50, 0x60, 0xAE, 0xC9, 0xEF, 0xAA, 0xB3, 0x4A, 0x67, 0x2C, 0x37, 0x2F,
-    0xE3, 0x2B, 0x69, 0x65, 0x00, 0x51, 0x6E, 0xB9, 0x89, 0xFA, 0xC4, 0x79, 0xB9, 0x91, 0x5F, 0x56,
-    0x45, 0xA7, 0x8F, 0xCD, 0xDB, 0x20, 0x3F, 0x48, 0x2B, 0x0F, 0x2D, 0xA4, 0x5D, 0xCB, 0x5C, 0xB5,
-    0x95, 0xA7, 0xD4, 0x2B, 0xBD, 0xAD, 0xB4, 0x8D, 0xB6, 0x89, 0x08, 0xB0, 0x5E, 0xA7, 0x32, 0xFA,
-    0xB2, 0xCB, 0xB5, 0x95, 0x5B, 0xCE, 0x64, 0xA2, 0x1B, 0x69, 0xB3, 0xB8, 0x8E, 0x53, 0x91, 0x84,
-    0x3E, 0x30, 0x9C, 0x0C, 0x86, 0x7C, 0xB7, 0xC2, 0x18, 0x21, 0x7A, 0xC8, 0x3A, 0x31, 0x89, 0x63,
-    0x9C, 0x75, 0x65, 0x97, 0x1D, 0xB1, 0x8B, 0x9C, 0x8B, 0x8A, 0x4C, 0xBB, 0x0D, 0xBA, 0xD1, 0x4E,
-    0x77, 0xAF, 0xE5, 0x74, 0x17, 0xEC, 0xF8, 0xB9, 0xEF, 0x0E, 0xA5, 0x74, 0xF8, 0xBC, 0xB3, 0x0D,
-    0x27, 0x30, 0xDB, 0x4E, 0xA3, 0x18, 0xB4, 0xCD, 0x0C, 0xB3, 0xC4, 0x5C, 0x21, 0xB0, 0xE3, 0x8B,
-    0xFE, 0xA3, 0x37, 0x86, 0xBC, 0xE1, 0x0A, 0x13, 0xF0, 0x7A, 0xFC, 0x34, 0x5F, 0x00, 0x7E, 0x5B,
-    0x56, 0x18, 0x7C, 0xF7, 0x10, 0x70, 0xFE, 0xC9, 0x49, 0xD7, 0x73, 0x6A, 0xC2, 0x26, 0x14, 0xB3,
-    0x70, 0xCD, 0x97, 0x21, 0x75, 0x61, 0x38, 0x54, 0xA7, 0xEA, 0x58, 0x8D, 0xAB, 0x83, 0x75, 0xB2,
-    0x8E, 0xD6, 0xD9, 0x3A, 0x5C, 0xA7, 0xEB, 0x78, 0x8D, 0xAF, 0x03, 0x76, 0xC2, 0x8E, 0xD8, 0x19,
-    0x3B, 0x64, 0xA7, 0x6C, 0x98, 0x9D, 0xB3, 0x83, 0x76, 0xD2, 0x8E, 0xDA, 0x59, 0xEF, 0xC2, 0x3E,
-    0x39, 0xE5, 0x04, 0x64, 0xDA, 0xC9, 0x59, 0x88, 0x98, 0xE3, 0xC7, 0x2D, 0x1E, 0xF2, 0xFB, 0x73,
-    0xBD, 0xF7, 0x67, 0x3A, 0xE3, 0x74, 0x33, 0xD1, 0x09, 0x65, 0xCB, 0x54, 0x7F, 0x75, 0x54, 0x85,
-    0x87, 0x61, 0x8F, 0xB8, 0x21, 0x37, 0xE6, 0x84, 0x6E, 0xD4, 0x0D, 0xBB, 0x71, 0x37, 0xF0, 0x46,
-    0xDE, 0xD0, 0x1B, 0x7B, 0x83, 0x6F, 0xF4, 0x0D, 0xBF, 0xF1, 0x37, 0x05, 0x30, 0x0D, 0x30, 0x15,
-    0x30, 0x1D, 0x30, 0x25, 0x70, 0x2D, 0xE8, 0xD5, 0xA0, 0xA1, 0x79, 0xD7, 0x74, 0x5B, 0xC5, 0xEC,
-    0xF1, 0x53, 0x95, 0xE6, 0x33, 0x08, 0x33, 0xF9, 0x90, 0x56, 0x6E, 0x2A, 0x60, 0x1A, 0x70, 0xAD,
-    0x02, 0x1C, 0xAE, 0x41, 0x1F, 0x81, 0xEE, 0x04, 0x4A, 0x96, 0xB6, 0x02, 0x38, 0x84, 0x2E, 0x53,
-    0x49, 0xDD, 0x2F, 0x61, 0xDC, 0xA0, 0x4B, 0xB8, 0x64, 0x3B, 0x44, 0x7B, 0x63, 0x4C, 0xD9, 0xBD,
-    0x74, 0x43, 0x23, 0x0C, 0x3F, 0xA0, 0x11, 0x86, 0x14, 0xFD, 0xE5, 0x85, 0x2A, 0xAF, 0x7C, 0x6C,
-    0xFD, 0x11, 0x61, 0xB5, 0x8F, 0xC8, 0x75, 0x63, 0x9A, 0x0D, 0x2D, 0x48, 0xDE, 0x3A, 0xD3, 0xA6,
-    0x53, 0x9E, 0x40, 0xC9, 0x8F, 0x29, 0x8B, 0x07, 0x6A, 0xE4, 0x09, 0x94, 0xEB, 0x93, 0x85, 0x3E,
-    0xEC, 0x0F, 0x53, 0xD7, 0x81, 0x2E, 0xA3, 0x0E, 0xAC, 0x6F, 0xA4, 0x0E, 0x9C, 0x86, 0x53, 0xA0,
-    0x7A, 0x1F, 0x5E, 0x28, 0x02, 0x55, 0xF1, 0x19, 0x54, 0xF8, 0x41, 0xB2, 0x19, 0xE2, 0xE4, 0x0A,
-    0x9E, 0x42, 0xA8, 0x21, 0xFF, 0xB2, 0xA3, 0x6D, 0x47, 0x6A, 0x40, 0x39, 0xBD, 0x45, 0xB6, 0xED,
-    0x5F, 0xC5, 0x22, 0x47, 0xAC, 0xD2, 0xA8, 0x9A, 0xE8, 0xFD, 0xD2, 0x65, 0x21, 0x63, 0x4B, 0xAA,
-    0xA4, 0x82, 0x82, 0x71, 0x42, 0x3A, 0xF3, 0xA8, 0x73, 0x4D, 0x37, 0xB9, 0x92, 0x5E, 0x8D, 0x6F,
-    0x26, 0xE9, 0xCB, 0x4F, 0x31, 0x18, 0xFA, 0xE6, 0x71, 0xC4, 0xE8, 0xF3, 0x97, 0x18, 0xBE, 0xB8,
-    0xE8, 0x99, 0x0A, 0xB4, 0x2A, 0x64, 0x02, 0xC9, 0xC3, 0x90, 0x9C, 0xDE, 0x26, 0x8C, 0x5F, 0x3B,
-    0xC6, 0x0E, 0x77, 0x2E, 0xF5, 0xD2, 0x02, 0x56, 0xD0, 0xE8, 0x1C, 0x65, 0x6E, 0x2B, 0xB5, 0x78,
-    0x0D, 0x79, 0x8A, 0xA5, 0x06, 0x40, 0x27, 0x55, 0x38, 0xBB, 0x71, 0xEE, 0xFC, 0xAB, 0xC6, 0xE4,
-    0x81, 0xC2, 0x49, 0x19, 0x70, 0x4F, 0x70, 0xF9, 0x83, 0xFC, 0x03, 0xED, 0xCB, 0x90, 0xCD, 0x21,
-    0x88, 0x9A, 0x21, 0x2A, 0x63, 0x51, 0x2A, 0x4D, 0xE2, 0xCB, 0xC4, 0xAD, 0x31, 0xF3, 0x3B, 0x17,
-    0x0C, 0x5F, 0x3C, 0xE1, 0x48, 0x9F, 0xAD, 0xC5, 0x93, 0xA7, 0xFF, 0x38, 0xFF, 0x5C, 0xDA, 0xD5,
-    0xA8, 0x85, 0xE1, 0xAF, 0xDC, 0xC0, 0x43, 0x41, 0x87, 0x58, 0xFD, 0xB7, 0x98, 0x7C, 0xF4, 0x3F,
-    0x24, 0xDF, 0x5E, 0x25, 0xEF, 0x7E, 0xBA, 0x61, 0x87, 0x38, 0x3C, 0x3C, 0xC8, 0x3E, 0xBE, 0xCA,
-    0x33, 0x27, 0xCF, 0xC9, 0x2D, 0xE5, 0x79, 0x17, 0x16, 0x9E, 0x61, 0xE4, 0x63, 0x0C, 0xEE, 0xD9,
-    0x4A, 0x79, 0x2E, 0x1F, 0xF5, 0x3C, 0x47, 0x07, 0xC0, 0xD3, 0xBF, 0x72, 0xE2, 0xB9, 0x47, 0xDF,
-    0x94, 0x2C, 0xAF, 0xB1, 0xD6, 0xA3, 0xB7, 0x88, 0x6E, 0xB2, 0x66, 0x98, 0x48, 0xD9, 0x84, 0x7D,
-    0x9B, 0x9D, 0x1F, 0x16, 0xE3, 0x87, 0x08, 0xBC, 0xD2, 0xF8, 0x93, 0x15, 0xFD, 0xAC, 0x4A, 0x3B,
-    0xFF, 0x04, 0x4B, 0xCE, 0xDD, 0xF0, 0x58, 0xAF, 0x78, 0x2F, 0xE0, 0x92, 0x52, 0xF4, 0x57, 0xBB,
-    0x73, 0xA8, 0x43, 0x81, 0xE4, 0x4C, 0x25, 0x4B, 0xC6, 0xCF, 0xC3, 0xED, 0x0C, 0xBC, 0x90, 0xE9,
-    0x6A, 0xE0, 0xB5, 0xD1, 0xFB, 0x8D, 0x96, 0xF7, 0x56, 0xFD, 0xF4, 0x16, 0x22, 0x12, 0x21, 0x1D,
-    0x10, 0xB5, 0x23, 0x1C, 0xA5, 0xF4, 0x0A, 0xC4, 0x32, 0xE1, 0xF4, 0x86, 0x55, 0x4C, 0x4A, 0x1D,
-    0xB1, 0x2E, 0xBE, 0xF0, 0x4B, 0xE5, 0x17, 0xA8, 0xF1, 0xC8, 0xA7, 0xA6, 0xDB, 0xF5, 0x75, 0x64,
-    0xD5, 0xB1, 0x6F, 0xDC, 0x2E, 0x8C, 0x5F, 0x3B, 0xF0, 0x12, 0x45, 0xAF, 0x7B, 0xB4, 0x9B, 0x5F,
-    0x76, 0x30, 0xE5, 0x21, 0xE0, 0xEA, 0x2B, 0x99, 0xF2, 0x0D, 0x0D, 0xBC, 0x24, 0xE6, 0x56, 0x11,
-    0xA2, 0xCD, 0x70, 0xD3, 0xCC, 0x6E, 0xAD, 0xCA, 0x90, 0x23, 0x18, 0x2B, 0xD0, 0x96, 0x6C, 0x21,
-    0xA8, 0x7A, 0xB5, 0x95, 0x96, 0x5C, 0xB8, 0x46, 0xBB, 0x42, 0xBB, 0xD4, 0xE8, 0x44, 0xDA, 0x51,
-    0xFC, 0xF3, 0xD9, 0x29, 0xC0, 0xA8, 0xF8, 0xA7, 0x4C, 0x82, 0xFB, 0x42, 0x22, 0xF3, 0x94, 0xCC,
-    0x5A, 0x3C, 0x0A, 0xAD, 0x78, 0x12, 0xB9, 0x8A, 0x6D, 0x19, 0xE3, 0x3E, 0xB6, 0xE4, 0x82, 0xC9,
-    0x37, 0x46, 0xD5, 0x0D, 0xDA, 0x76, 0xBB, 0x0A, 0x85, 0x1F, 0xBF, 0xC4, 0xB4, 0x66, 0x7A, 0x9B,
-    0x25, 0x86, 0x27, 0xAA, 0x5C, 0xB6, 0xE3, 0x38, 0xCB, 0x5B, 0xC8, 0x5C, 0x14, 0xA3, 0x5C, 0x17,
-    0x6D, 0x22, 0xFF, 0x2A, 0xBF, 0x5D, 0x68, 0x33, 0x2D, 0x75, 0x16, 0x75, 0x7C, 0x55, 0x11, 0x3E,
-    0x26, 0x88, 0xB9, 0x96, 0xC2, 0x07, 0x03, 0xC2, 0x38, 0xD5, 0xB8, 0xA3, 0xEA, 0xE0, 0x73, 0xE4,
-    0x24, 0xF6, 0x75, 0xA7, 0x72, 0xA5, 0x89, 0xDB, 0x06, 0x49, 0x2B, 0x95, 0xEC, 0x24, 0xF4, 0xC2,
-    0x4F, 0x58, 0x8D, 0xE2, 0x6A, 0x98, 0x0E, 0x5A, 0xD6, 0x13, 0xB8, 0x3C, 0x32, 0x66, 0xFA, 0xD1,
-    0xC0, 0xEA, 0x0E, 0x03, 0x52, 0xBE, 0xF1, 0x0C, 0xA5, 0x80, 0x8E, 0x95, 0x68, 0xB4, 0xD6, 0xD8,
-    0x4C, 0x03, 0x2A, 0x1A, 0x41, 0xEB, 0x0E, 0xE1, 0xCE, 0xB9, 0x7F, 0xE2, 0x0D, 0xB3, 0x3A, 0xD5,
-    0x04, 0x38, 0xEB, 0x74, 0xD1, 0x2E, 0xE3, 0x8B, 0x95, 0x26, 0x52, 0x4A, 0x65, 0xF3, 0x44, 0x86,
-    0x9B, 0xC8, 0xA3, 0x2B, 0xBD, 0xE4, 0x9B, 0x07, 0x24, 0xF6, 0xF7, 0x74, 0x2B, 0x23, 0x11, 0x91,
-    0xA8, 0xE3, 0x7B, 0x89, 0x12, 0x91, 0xAA, 0x56, 0xFE, 0x17, 0x55, 0xB3, 0x12, 0xDB, 0x16, 0x27,
-    0x21, 0xD9, 0x1A, 0x90, 0xCA, 0x9B, 0x02, 0xA7, 0xC4, 0x39, 0x42, 0xC8, 0x3C, 0x40, 0xE8, 0xE6,
-    0x95, 0x20, 0xF6, 0x00, 0xB9, 0xE3, 0x59, 0x0B, 0xB4, 0xD3, 0x00, 0xD1, 0x53, 0xF6, 0xE6, 0x25,
-    0x39, 0x5D, 0x4E, 0x1D, 0xF2, 0x27, 0x00, 0x12, 0x30, 0x04, 0x64, 0x30, 0x30, 0x98, 0x11, 0x77,
-    0x5C, 0x50, 0xA9, 0xBC, 0xBC, 0xD0, 0x5A, 0xFD, 0x28, 0xAE, 0xD5, 0x21, 0x8D, 0x63, 0xFB, 0x70,
-    0x5B, 0xCD, 0x63, 0x31, 0xEF, 0xDA, 0x5A, 0x1E, 0xD9, 0x18, 0x1C, 0xE3, 0xE2, 0x1D, 0xC5, 0x65,
-    0x80, 0x8C, 0x90, 0x21, 0xB2, 0x81, 0xDA, 0xA8, 0xDD, 0xDF, 0x13, 0x93, 0x71, 0x22, 0x28, 0x23,
-    0x65, 0xA8, 0x8C, 0x95, 0xC1, 0x32, 0x5A, 0x86, 0xCB, 0x78, 0x19, 0x30, 0x23, 0xE6, 0x63, 0x20,
-    0x2D, 0xEF, 0x86, 0xC6, 0x72, 0xC2, 0x15, 0x43, 0x2F, 0x3A, 0x3A, 0x1B, 0xD1, 0x70, 0xB0, 0xBD,
-    0xD2, 0xC4, 0x9F, 0x4E, 0xF5, 0xF1, 0x88, 0x9E, 0xC7, 0x2D, 0x0C, 0x26, 0x5F, 0xE0, 0x57, 0x47,
-    0xC3, 0x40, 0xC2, 0x60, 0x1A, 0x4D, 0xC3, 0x69, 0x53, 0x21, 0x50, 0x23, 0xEA, 0x25, 0x78, 0x32,
-    0x35, 0xA8, 0x46, 0xD5, 0xB0, 0x1A, 0x57, 0x03, 0xEB, 0xEB, 0x9F, 0x09, 0xC9, 0x44, 0x46, 0xB8,
-    0x46, 0xD7, 0xF0, 0x3A, 0x5F, 0x03, 0xEC, 0x84, 0x59, 0x88, 0x67, 0x1D, 0xBE, 0x98, 0x5D, 0x8A,
-    0xD3, 0xCE, 0xFE, 0xA4, 0xF7, 0x4F, 0x3E, 0x64, 0xF5, 0x13, 0x74, 0x01, 0xF7, 0x2A, 0xDB, 0x1B,
-    0x6F, 0x74, 0x28, 0xB2, 0x83, 0xCA, 0x78, 0x7D, 0x74, 0x16, 0x92, 0xB6, 0x90, 0x7F, 0xFC, 0x61,
-    0x23, 0xD7, 0x82, 0x19, 0x88, 0x81, 0xD7, 0x80, 0xD6, 0x1B, 0x5F, 0x92, 0xAC, 0xAA, 0x62, 0xD9,
-    0x96, 0x55, 0xD0, 0x11, 0xF2, 0x5D, 0x5E, 0x3C, 0x41, 0x59, 0x6D, 0xFD, 0x39, 0x66, 0x8D, 0xEA,
-    0x79, 0xF1, 0x2F, 0x37, 0x37, 0x2B, 0x9D, 0x4F, 0x6F, 0x9B, 0xB9, 0x1D, 0x9F, 0x6F, 0x03, 0x87,
-    0x3B, 0x1C, 0xDA, 0x6F, 0xD5, 0xF0, 0x8E, 0xB5, 0x76, 0x16, 0x35, 0x5F, 0x6D, 0xE2, 0xCF, 0xF5,
-    0xF1, 0x6A, 0x75, 0x93, 0x56, 0x3D, 0x52, 0x01, 0x9B, 0x3B, 0x19, 0x9A, 0xDC, 0x8D, 0xF0, 0x9E,
-    0x28, 0x8E, 0xB3, 0x36, 0xCE, 0xD2, 0x38, 0x2B, 0xE3, 0xC3, 0xC2, 0x38, 0x0C, 0x5C, 0x7D, 0x69,
-    0x5F, 0x14, 0x47, 0x4D, 0xFC, 0x6A, 0x49, 0xFC, 0x50, 0x02, 0x8B, 0x7A, 0xFE, 0x40, 0x6E, 0xBC,
-    0xE9, 0x98, 0x5B, 0x8D, 0xE7, 0xB2, 0xAE, 0x25, 0x55, 0xE2, 0x11, 0x47, 0x1D, 0xA1, 0x3F, 0x62,
-    0x7B, 0x9D, 0x84, 0xEC, 0xC5, 0x62, 0xB2, 0xD4, 0x45, 0xEF, 0xFF, 0x64, 0x7B, 0xA8, 0x68, 0x8F,
-    0x22, 0x77, 0x7B, 0xE0, 0xD6, 0x5F, 0xEA, 0xCC, 0x9B, 0xB9, 0xA4, 0x58, 0x92, 0x86, 0x14, 0x0B,
-    0xBD, 0xF0, 0xA8, 0x3A, 0x30, 0x00, 0x5F, 0x23, 0xFC, 0xBE, 0x73, 0x09, 0xD3, 0x9B, 0xB1, 0xD6,
-    0x91, 0xC6, 0x27, 0x4B, 0xF9, 0x84, 0x64, 0x7A, 0xE5, 0x42, 0x02, 0xDD, 0x93, 0xD0, 0x6F, 0x41,
-    0xDC, 0xBC, 0x30, 0x1D, 0x8E, 0x5D, 0x65, 0x85, 0xF4, 0x36, 0x63, 0xF5, 0x83, 0xCB, 0xAF, 0x86,
-    0xB0, 0x33, 0xCD, 0xFF, 0x02, 0x52, 0x41, 0x21, 0x7C, 0xBE, 0x25, 0xB8, 0x52, 0x80, 0x4B, 0xD6,
-    0x4B, 0x32, 0x9D, 0x34, 0xC3, 0x7B, 0x3C, 0xA9, 0xE9, 0x1F, 0xA2, 0x8D, 0xA6, 0xAB, 0x82, 0x66,
-    0x66, 0x0D, 0xC0, 0x80, 0x0B, 0xB0, 0x4C, 0xA2, 0x43, 0xC1, 0x89, 0x8C, 0x4C, 0x6F, 0x02, 0x15,
-    0x80, 0x7C, 0xA1, 0x00, 0x35, 0xB3, 0x62, 0x90, 0x42, 0x16, 0x38, 0x63, 0xD3, 0x9F, 0xE3, 0xC8,
-    0xA1, 0x3C, 0xBA, 0xB0, 0x2F, 0x98, 0xC0, 0xCA, 0xB0, 0xC7, 0xF2, 0xEF, 0xBA, 0xE7, 0x7B, 0x6C,
-    0x63, 0x3E, 0x79, 0xC8, 0xBC, 0x57, 0x07, 0xA8, 0xE3, 0x83, 0x27, 0x5B, 0x60, 0x70, 0x89, 0x7C,
-    0x5C, 0x87, 0xA6, 0x23, 0xD3, 0xFF, 0x34, 0xA3, 0x9E, 0xD8, 0xCE, 0xA3, 0xDE, 0x5E, 0xC7, 0x84,
-    0xED, 0x7C, 0xEE, 0xE5, 0x43, 0xF6, 0xE5, 0xEA, 0x66, 0x89, 0x61, 0x7B, 0x46, 0x27, 0xE1, 0x8D,
-    0x67, 0x7D, 0x33, 0xED, 0xEB, 0xD2, 0xDF, 0xE1, 0x6F, 0x53, 0xCC, 0x95, 0xF3, 0x1D, 0xEE, 0x2C,
-    0xCA, 0xC2, 0x7E, 0xED, 0x5C, 0xEB, 0xA1, 0xD8, 0x16, 0xBD, 0xD8, 0x46, 0x83, 0xDB, 0xA4, 0xB6,
-    0x59, 0xBB, 0x2F, 0xB6, 0x61, 0xE1, 0xA1, 0x5C, 0xD2, 0x7C, 0xF1, 0xDF, 0x32, 0xEC, 0x2E, 0xB8,
-    0xF7, 0xB0, 0x3A, 0x26, 0x5C, 0xC3, 0x26, 0x0C, 0xD3, 0x0A, 0x1A, 0x78, 0x13, 0x5F, 0x88, 0x67,
-    0x49, 0xD4, 0x06, 0xD4, 0x17, 0x2E, 0x04, 0xB5, 0x5C, 0x31, 0xD5, 0xE7, 0x64, 0x7C, 0xA4, 0x3A,
-    0xC4, 0x09, 0x8B, 0x1E, 0xDB, 0x4E, 0xAB, 0x1B, 0xD2, 0xE9, 0xD3, 0xE4, 0xB2, 0x66, 0xD9, 0x77,
-    0x72, 0xB5, 0xC2, 0x17, 0x2B, 0xD6, 0x4E, 0xAE, 0xC6, 0x01, 0x8C, 0x35, 0xAE, 0x94, 0xE7, 0x89,
-    0x98, 0x53, 0xF9, 0x05, 0x2A, 0x16, 0x6A, 0xA7, 0x5F, 0x34, 0xB1, 0x82, 0x7D, 0x6D, 0xE8, 0xB9,
-    0x6C, 0x15, 0x9F, 0xA3, 0x14, 0xC4, 0x29, 0x9E, 0xED, 0x38, 0x8C, 0xA7, 0x61, 0xB0, 0x70, 0x67,
-    0xBB, 0x9D, 0x1D, 0xB3, 0x62, 0x80, 0x10, 0x9E, 0x3C, 0xC7, 0x5C, 0xE1, 0x76, 0xE6, 0x70, 0x64,
-    0x69, 0x7C, 0x15, 0xD7, 0x93, 0x38, 0x2B, 0xD5, 0x1B, 0x14, 0xAD, 0x0C, 0x35, 0x6F, 0x0B, 0x5D,
-    0x5B, 0x65, 0x98, 0x79, 0x2B, 0x30, 0xA4, 0x59, 0xC9, 0x2F, 0x04, 0x49, 0xD9, 0x0A, 0x93, 0x72,
-    0x8D, 0x62, 0x49, 0xB9, 0x96, 0x44, 0xBB, 0xEC, 0x26, 0x71, 0x0E, 0x97, 0x96, 0xE9, 0x60, 0x53,
-    0x5B, 0x77, 0x15, 0x7F, 0xBF, 0x9A, 0x1F, 0x57, 0x81, 0x20, 0xE8, 0x48, 0xB1, 0x64, 0x42, 0x4D,
-    0x0D, 0x46, 0x62, 0xA7, 0x49, 0x3A, 0x3B, 0x17, 0x60, 0xDD, 0xB4, 0x0F, 0xDB, 0xB5, 0x63, 0x60,
-    0xC2, 0xA9, 0x14, 0xEB, 0xB0, 0xDD, 0xB8, 0xB1, 0xE2, 0xCB, 0x6D, 0x43, 0xFA, 0xFA, 0x0C, 0x1F,
-    0x7E, 0xF3, 0x9A, 0x0C, 0xFF, 0xCD, 0x83, 0x25, 0x14, 0xFA, 0xEA, 0x70, 0xFF, 0x53, 0x1E, 0x87,
-    0x69, 0x36, 0xA8, 0x54, 0x8F, 0x62, 0x3C, 0xE1, 0x39, 0x89, 0x06, 0x04, 0xF3, 0xA5, 0xED, 0xB3,
-    0x55, 0xB6, 0x7A, 0xED, 0x7D, 0x11, 0x9C, 0x93, 0x73, 0x74, 0xCE, 0xCE, 0xE0, 0x39, 0x3D, 0xC7,
-    0xE7, 0xFC, 0x1C, 0xA0, 0x13, 0x74, 0x76, 0x7D, 0x6F, 0x10, 0x9D, 0xA2, 0x63, 0x74, 0x8E, 0x0E,
-    0xD2, 0x49, 0x3A, 0x4A, 0x67, 0xE9, 0x30, 0x9D, 0xA6, 0xE3, 0x74, 0x9E, 0x3D, 0x50, 0x27, 0xDA,
-    0x23, 0x1D, 0x32, 0xF5, 0x44, 0x74, 0xB6, 0x9F, 0x88, 0xD6, 0x96, 0x88, 0xF2, 0xFC, 0x5F, 0xF7,
-    0x1F, 0x12, 0xD1, 0x27, 0xCF, 0x19, 0x54, 0x40, 0x46, 0x25, 0x9F, 0xC5, 0x78, 0x1E, 0xAC, 0xF5,
-    0x57, 0xB3, 0x92, 0x89, 0xA8, 0x3A, 0x53, 0x10, 0x87, 0x5F, 0xD5, 0x12, 0x2D, 0xA8, 0xC3, 0xBB,
-    0xA2, 0x5B, 0xE1, 0x12, 0xB0, 0x87, 0xAB, 0x35, 0xAF, 0xAB, 0x53, 0x87, 0x06, 0xE8, 0x52, 0x3F,
-    0xD1, 0x27, 0x58, 0xC8, 0x9F, 0x71, 0xAA, 0xA9, 0xCD, 0xD4, 0x0C, 0xD4, 0xB4, 0xA1, 0x9C, 0x0D,
-    0x77, 0xD0, 0xB3, 0xE5, 0xFD, 0x4F, 0xB1, 0x7E, 0x37, 0x50, 0x8D, 0xEF, 0xDB, 0xCE, 0x14, 0x55,
-    0xC1, 0x34, 0xE1, 0x5A, 0x45, 0x38, 0x7C, 0xF3, 0xDD, 0x26, 0xAD, 0xE9, 0x20, 0x69, 0xAD, 0x91,
-    0xB4, 0x6A, 0x84, 0xD0, 0x5D, 0x93, 0xB4, 0xBE, 0x71, 0xCB, 0x35, 0x4C, 0x25, 0xAB, 0x0F, 0xDF,
-    0xA2, 0x3B, 0x4D, 0x56, 0xB0, 0x62, 0x9C, 0xE7, 0x6C, 0xBA, 0xA2, 0x82, 0x0D, 0x7F, 0x9B, 0xDC,
-    0x54, 0xDD, 0x8A, 0x65, 0x39, 0xDB, 0xEE, 0x64, 0xDC, 0x36, 0x6E, 0x57, 0x72, 0x57, 0xFE, 0xEE,
-    0xA3, 0xFD, 0xDC, 0xF5, 0x67, 0x95, 0xE5, 0xAE, 0x63, 0xE4, 0xAE, 0x34, 0xD3, 0x1D, 0x2B, 0x85,
-    0x8D, 0x4E, 0x3C, 0x2F, 0x9E, 0x9B, 0x81, 0xD2, 0x3E, 0x69, 0x9E, 0xB4, 0x4E, 0x1A, 0x27, 0x6D,
-    0x93, 0xA6, 0x49, 0xCB, 0xA4, 0x61, 0xD2, 0x2E, 0x69, 0x96, 0xB4, 0x4A, 0x1A, 0x25, 0x6D, 0x92,
-    0x26, 0x49, 0x8B, 0x4C, 0xBD, 0xA2, 0x34, 0xDD, 0x9A, 0x63, 0x78, 0x4F, 0xF7, 0x0F, 0x75, 0xAD,
-    0x68, 0x3D, 0x64, 0x94, 0x89, 0xBD, 0x40, 0xA0, 0x9D, 0x55, 0xF5, 0x30, 0x08, 0xAA, 0x5B, 0xFA,
-    0xDD, 0x0D, 0x17, 0x58, 0x1E, 0x0C, 0x22, 0xEA, 0xE6, 0xF6, 0xA2, 0x46, 0xAA, 0x5B, 0x0E, 0x52,
-    0xDD, 0x74, 0x2E, 0xB2, 0xDE, 0x49, 0x75, 0xAB, 0x3E, 0xD5, 0x95, 0x89, 0x2C, 0x26, 0xAB, 0x61,
-    0x85, 0xE2, 0x0D, 0x5B, 0xEC, 0xFD, 0x5F, 0x5B, 0x39, 0x87, 0x45, 0x1A, 0x6E, 0x1E, 0x76, 0xDC,
-    0x4A, 0x5C, 0xC2, 0x8A, 0xE5, 0xA3, 0x2B, 0x6C, 0x2B, 0x0F, 0x0F, 0x6F, 0xBD, 0x95, 0xF1, 0xED,
-    0x57, 0xCD, 0x8A, 0x6F, 0x60, 0x1C, 0x7C, 0xC9, 0xE3, 0xFE, 0x56, 0x93, 0xF3, 0xFA, 0x9B, 0xD7,
-    0xFB, 0xDC, 0x5D, 0x7B, 0x48, 0xAC, 0x33, 0xB9, 0xFB, 0x34, 0xF4, 0xD5, 0x3F, 0xA5, 0x2D, 0x03,
-    0x02, 0x6E, 0xB9, 0xAD, 0xF2, 0x7E, 0x26, 0x33, 0x53, 0xE0, 0x5F, 0xCA, 0x47, 0x9A, 0xF8, 0x1B,
-    0x1D, 0x99, 0x22, 0x2F, 0xE5, 0xD1, 0x64, 0xAE, 0x39, 0xE7, 0xEC, 0xB5, 0x11, 0xD4, 0xF8, 0x9A,
-    0x08, 0xAA, 0xBE, 0x26, 0x82, 0x52, 0x02, 0x8D, 0x45, 0x50, 0xCD, 0x75, 0x11, 0x14, 0x7F, 0x4E,
-    0x91, 0x2D, 0x77, 0xAF, 0x8F, 0xA0, 0x56, 0xA6, 0xAD, 0x33, 0x46, 0x50, 0x2F, 0xF7, 0x22, 0x28,
-    0xB3, 0x82, 0x86, 0xA0, 0xB9, 0x31, 0x6E, 0x15, 0x4B, 0x9E, 0xC6, 0xD5, 0x1A, 0xC2, 0xFD, 0x0B,
-    0x1C, 0xBF, 0xB4, 0xC2, 0xBA, 0x8E, 0x42, 0x40, 0xB3, 0xF2, 0xF3, 0x3E, 0x93, 0xD7, 0xBF, 0xDA,
-    0x46, 0x71, 0x07, 0x9F, 0x1C, 0x97, 0x70, 0xCA, 0x9B, 0x6A, 0x18, 0x33, 0x75, 0x6F, 0x24, 0x66,
-    0x12, 0x55, 0xF5, 0xCA, 0x06, 0x23, 0xC3, 0x91, 0x93, 0xF5, 0x04, 0xBB, 0xB4, 0x33, 0x3C, 0x99,
-    0x91, 0x97, 0x0F, 0xBE, 0x45, 0xC4, 0x93, 0x4B, 0xCB, 0xFD, 0xE6, 0x3D, 0x4B, 0x84, 0x21, 0x14,
-    0xC9, 0xDA, 0x0F, 0x31, 0x2A, 0x71, 0xB1, 0x85, 0x83, 0x20, 0xEE, 0xB9, 0xAE, 0x27, 0xBB, 0x9E,
-    0xED, 0xF6, 0xE9, 0x6E, 0x68, 0xA6, 0x3B, 0xB9, 0x95, 0x79, 0x3C, 0x4F, 0x79, 0xFB, 0x3D, 0x1C,
-    0x49, 0x7A, 0xDF, 0x2A, 0xDB, 0x1F, 0x24, 0xC5, 0x7E, 0x34, 0xD7, 0x12, 0xE3, 0xDE, 0x4A, 0x98,
-    0x82, 0x24, 0x14, 0xA4, 0x2D, 0x0A, 0x19, 0x1D, 0x82, 0x24, 0xC9, 0x87, 0xA1, 0x1E, 0xA7, 0x5C,
-    0x9E, 0xB2, 0x2E, 0x61, 0x11, 0x1A, 0x5B, 0xE7, 0xBE, 0x79, 0x6E, 0xDB, 0xE7, 0xF2, 0xD5, 0x8E,
-    0xA8, 0x1E, 0xBA, 0x85, 0xFE, 0x36, 0xA9, 0x01, 0x36, 0xE1, 0xB5, 0x0E, 0x58, 0xA0, 0x84, 0xD9,
-    0x35, 0xA1, 0x97, 0x28, 0x37, 0xE2, 0x43, 0x51, 0xD5, 0x4B, 0x21, 0x7E, 0x14, 0x92, 0x03, 0x21,
-    0x1E, 0xC2, 0xDB, 0x68, 0xC8, 0xE1, 0x91, 0xBD, 0x69, 0x64, 0xEE, 0x6D, 0x62, 0xEE, 0xCE, 0x42,
-    0xBA, 0xBE, 0xF7, 0xA0, 0x0E, 0xCB, 0xFF, 0xC5, 0xF0, 0xC8, 0xD8, 0xCD, 0xC7, 0xDA, 0x6F, 0x5D,
-    0xE4, 0xEB, 0x9D, 0x8D, 0xDA, 0x9D, 0xFD, 0xDA, 0x7C, 0xE1, 0xB3, 0x51, 0x4E, 0x18, 0x32, 0x42,
-    0x1B, 0x19, 0xB2, 0x96, 0xBB, 0x05, 0x8A, 0x56, 0xBC, 0x65, 0xBC, 0xDA, 0x15, 0x2D, 0x62, 0x43,
-    0x74, 0x53, 0xBD, 0x83, 0x06, 0x0E, 0xE5, 0xCA, 0x91, 0x1A, 0xC9, 0x8C, 0xF5, 0x2C, 0xAD, 0x84,
-    0xAB, 0x7A, 0x74, 0x58, 0x40, 0x8B, 0x16, 0x3B, 0x0E, 0xF2, 0x70, 0xBD, 0x51, 0xB9, 0xC6, 0x8D,
-    0xEA, 0x15, 0x6E, 0x24, 0x9D, 0xDE, 0xC8, 0xEE, 0x20, 0x9D, 0xAA, 0x8F, 0x44, 0xEC, 0x25, 0x8E,
-    0x02, 0xFE, 0x22, 0xB6, 0xCC, 0x1A, 0xB8, 0x0D, 0x8A, 0x57, 0x5D, 0xFA, 0xB3, 0x08, 0xAB, 0xB0,
-    0x73, 0xDA, 0x64, 0x9B, 0x44, 0xFB, 0x82, 0x65, 0xB3, 0xAD, 0xDB, 0xE1, 0x19, 0x40, 0x9E, 0x6C,
-    0x4E, 0xCE, 0xB4, 0xF8, 0x3F, 0xD6, 0xBC, 0x43, 0xBF, 0x65, 0xD8, 0xFA, 0xDD, 0xE9, 0x37, 0x77,
-    0x76, 0x0B, 0x4F, 0x8A, 0x79, 0x60, 0x8F, 0xA7, 0xF5, 0x4A, 0x9E, 0xD6, 0x5B, 0xEA, 0x4C, 0xE5,
-    0x5B, 0x66, 0xD8, 0x2C, 0x55, 0x52, 0x71, 0x31, 0x42, 0x3B, 0x96, 0x79, 0xC5, 0x85, 0x6A, 0x67,
-    0x5C, 0xD5, 0xB0, 0x98, 0x8D, 0xCE, 0x0D, 0x47, 0x76, 0x4A, 0xB1, 0x25, 0xD5, 0xB5, 0xEF, 0xC5,
-    0x10, 0x86, 0x6F, 0x5A, 0xF2, 0x00, 0xD8, 0xC8, 0x36, 0xEF, 0x66, 0x83, 0x16, 0x6F, 0xB8, 0x75,
-    0x7B, 0xEF, 0x32, 0xAF, 0x87, 0x2F, 0x31, 0xDB, 0xD6, 0x5D, 0xB2, 0xD3, 0xD9, 0xBB, 0xCC, 0x16,
-    0xB0, 0xF3, 0x44, 0x7E, 0xB8, 0x3F, 0x78, 0xE0, 0x2D, 0xE2, 0xCD, 0x8D, 0x49, 0xBE, 0x08, 0xC5,
-    0x97, 0x1F, 0xF1, 0xD2, 0xAB, 0xB5, 0x09, 0x44, 0xC8, 0x5D, 0x19, 0x16, 0x13, 0xEE, 0xF4, 0xC5,
-    0x87, 0x1B, 0xA2, 0x00, 0x9E, 0x76, 0xF5, 0x79, 0x57, 0xEF, 0x7D, 0xFC, 0x88, 0x45, 0xFF, 0x56,
-    0x7A, 0x1F, 0x96, 0xE1, 0xD3, 0xA3, 0xCB, 0xB0, 0x8D, 0xDF, 0xE5, 0x8A, 0x71, 0x9C, 0x38, 0x53,
-    0x30, 0x51, 0xAA, 0xE0, 0x30, 0xE7, 0x56, 0x5D, 0xC2, 0xED, 0x66, 0x6E, 0x62, 0xE5, 0x2C, 0xDD,
-    0xE8, 0xC6, 0xDA, 0x82, 0x9A, 0x06, 0x8F, 0x60, 0x84, 0xB7, 0x6E, 0x9A, 0x65, 0xEB, 0x65, 0xD8,
-    0x3A, 0x68, 0x27, 0xCD, 0xC4, 0x90, 0xA7, 0xDC, 0x49, 0x3B, 0x38, 0xEF, 0xE0, 0xC4, 0x61, 0x72,
-    0xDC, 0x95, 0xAE, 0x97, 0x96, 0x67, 0xD4, 0x4B, 0xCB, 0x2C, 0x8D, 0x3C, 0x3E, 0x65, 0x9B, 0xDE,
-    0x42, 0x9F, 0x6F, 0x5B, 0x46, 0x8B, 0x38, 0x32, 0xF7, 0xE4, 0x69, 0x34, 0x85, 0x17, 0x51, 0x9A,
-    0x30, 0x06, 0x7A, 0x70, 0xD7, 0x44, 0x61, 0xE6, 0x1E, 0xEC, 0xDD, 0xCE, 0x91, 0x49, 0xD4, 0xF6,
-    0x6D, 0x82, 0xD6, 0x28, 0x2E, 0xCF, 0x91, 0xA0, 0x25, 0x16, 0xBC, 0xE9, 0x25, 0x67, 0x55, 0x72,
-    0xF6, 0x41, 0x9C, 0xCA, 0x14, 0x46, 0xF1, 0x8F, 0x7A, 0x16, 0x7F, 0x96, 0xD2, 0x89, 0x4F, 0xD3,
-    0x88, 0x55, 0xAE, 0x1A, 0x47, 0x6E, 0x91, 0x4E, 0x74, 0x78, 0xE3, 0xC8, 0xF0, 0x6E, 0x62, 0x3D,
-    0xB5, 0x26, 0x98, 0xDE, 0x04, 0xAB, 0xAA, 0x05, 0xD3, 0x9A, 0x60, 0xD5, 0x34, 0xC8, 0xA4, 0x61,
-    0xCF, 0x13, 0xA2, 0xE5, 0x3A, 0x65, 0xDF, 0x61, 0x1F, 0x57, 0x57, 0x90, 0x86, 0x15, 0x88, 0x8D,
-    0xBD, 0xFE, 0xD4, 0xDA, 0x1B, 0xB0, 0x0B, 0x6A, 0x74, 0x7F, 0xE4, 0xD7, 0x13, 0xB7, 0x3E, 0x45,
-    0xF7, 0x3C, 0x74, 0x90, 0xBB, 0x99, 0x15, 0x6C, 0x7D, 0x3C, 0x82, 0xFF, 0x77, 0x3A, 0xD3, 0xBF,
-    0x90, 0x78, 0x11, 0x86, 0x69, 0x9D, 0xAF, 0x0D, 0x56, 0x7E, 0xD5, 0x7D, 0x90, 0xED, 0xEB, 0x4D,
-    0xAA, 0x33, 0x12, 0xFC, 0x1D, 0xB4, 0xCE, 0xF8, 0xF2, 0xD1, 0x2F, 0x20, 0xFD, 0x12, 0xD2, 0x2F,
-    0x22, 0xFD, 0xFA, 0x31, 0xF8, 0xE1, 0x9E, 0xAF, 0x3E, 0x5E, 0xFD, 0xF1, 0xE5, 0x04, 0x0B, 0xCA,
-    0x3B, 0x75, 0xDA, 0x2F, 0x4F, 0x6F, 0x23, 0xC9, 0x85, 0xF5, 0x26, 0xB7, 0x7C, 0xAF, 0xAF, 0xE7,
-    0x3B, 0x86, 0xAB, 0x2F, 0x68, 0xAB, 0x9A, 0x8D, 0x2E, 0x0E, 0x5B, 0xCD, 0x12, 0x4B, 0x21, 0x65,
-    0xFD, 0xB4, 0xE0, 0x59, 0x92, 0x48, 0x0B, 0x99, 0x4D, 0xA0, 0x9A, 0x46, 0x32, 0x57, 0x5E, 0x7B,
-    0x79, 0x41, 0x13, 0xC9, 0x77, 0xBA, 0xD4, 0x6F, 0xD4, 0xDA, 0xB1, 0x31, 0xC9, 0x33, 0x19, 0x12,
-    0x6E, 0x1A, 0xDF, 0x93, 0xC6, 0x4D, 0xFE, 0x66, 0x6F, 0xC1, 0x4F, 0x8B, 0x95, 0xEA, 0x8C, 0x26,
-    0x9B, 0x87, 0xED, 0x9A, 0xC2, 0x3B, 0x4F, 0x72, 0xD5, 0x93, 0x24, 0x7E, 0xB2, 0xC2, 0xEB, 0xEF,
-    0x7D, 0x74, 0x73, 0xCD, 0x0F, 0xBB, 0x7B, 0xD9, 0x97, 0xE7, 0xE6, 0xC4, 0x0F, 0x5C, 0x29, 0xB6,
-    0xE9, 0x5C, 0xBF, 0x3C, 0xDB, 0xFB, 0x5B, 0x5E, 0x85, 0xF7, 0x74, 0xDC, 0xB7, 0x94, 0xC3, 0xB1,
-    0x6E, 0xBF, 0x18, 0x25, 0x62, 0xB4, 0xB3, 0xD1, 0xAC, 0xDB, 0x66, 0xAB, 0xDD, 0x34, 0xB9, 0xD6,
-    0x03, 0x94, 0x73, 0x64, 0x24, 0x53, 0x19, 0x3B, 0x33, 0x75, 0xBE, 0xA9, 0x25, 0x4F, 0xCA, 0x3A,
-    0x66, 0x36, 0x23, 0xBC, 0x7C, 0x36, 0x86, 0x7C, 0x32, 0x1C, 0xD7, 0x2D, 0x70, 0x08, 0xA4, 0xC1,
-    0x09, 0x7C, 0x3B, 0xD5, 0x8C, 0xBF, 0xBB, 0x62, 0x7F, 0x8F, 0x01, 0x8F, 0x6D, 0xB7, 0x27, 0x38,
-    0x39, 0x4A, 0x86, 0x1A, 0x24, 0x0E, 0x34, 0x04, 0x44, 0x25, 0x1B, 0xBD, 0xE6, 0x04, 0x67, 0x1F,
-    0xED, 0x59, 0xAC, 0xE7, 0x0B, 0x86, 0xC5, 0x79, 0xB6, 0x8C, 0x58, 0x8C, 0x37, 0xCC, 0xFF, 0x4F,
-    0x4E, 0x71, 0xB8, 0xAD, 0x64, 0x9A, 0xA5, 0x05, 0x86, 0x0E, 0x69, 0xB1, 0xEA, 0x4C, 0x41, 0x4C,
-    0x32, 0x4B, 0x1D, 0x7C, 0xDE, 0x42, 0x52, 0x59, 0x8B, 0xA7, 0x67, 0x2D, 0x1E, 0x9C, 0xB5, 0x54,
-    0x80, 0x0E, 0xBC, 0x27, 0x1D, 0x2D, 0xAA, 0xC3, 0x4C, 0xD2, 0xAE, 0xE1, 0x5F, 0x0F, 0xB2, 0x31,
-    0x47, 0xCA, 0xDC, 0xDE, 0x26, 0xE4, 0xFB, 0xBF, 0xB1, 0xDD, 0x1E, 0x50, 0xF6, 0x80, 0xDC, 0x14,
-    0xD2, 0x4E, 0x7B, 0xDB, 0x84, 0xF8, 0x8A, 0xEC, 0x63, 0x5E, 0xDF, 0x44, 0x2B, 0x38, 0xF2, 0xF5,
-    0x28, 0x3B, 0x8B, 0xF5, 0xFC, 0x60, 0x58, 0xED, 0x9B, 0xEF, 0xF0, 0x08, 0x6D, 0x79, 0xF5, 0x08,
-    0xED, 0x01, 0x30, 0x42, 0x11, 0xA9, 0xD8, 0x68, 0x11, 0x49, 0x18, 0xA1, 0x2A, 0xC7, 0x77, 0x4E,
-    0x84, 0x91, 0x3E, 0x4F, 0x18, 0xA9, 0xF2, 0xD5, 0xCF, 0x77, 0xC2, 0x4C, 0xDE, 0x92, 0x8F, 0xA1,
-    0xAF, 0x1B, 0x0D, 0x5A, 0xD6, 0x27, 0x98, 0xD4, 0xD6, 0x7B, 0x7F, 0x68, 0xED, 0x90, 0x28, 0xEF,
-    0xFD, 0x59, 0xB9, 0x18, 0x06, 0xAF, 0x88, 0xDB, 0x21, 0x53, 0x4B, 0x23, 0xFC, 0xED, 0xD3, 0xAB,
-    0xA5, 0x98, 0x5B, 0x67, 0xA6, 0xB6, 0x8B, 0x30, 0xD9, 0x04, 0x14, 0x72, 0x5E, 0xB4, 0xF0, 0xFA,
-    0xBA, 0xE7, 0xFF, 0x44, 0x05, 0xDD, 0x62, 0x87, 0xE4, 0xE1, 0xF6, 0x6D, 0xE3, 0x43, 0x00, 0x6E,
-    0x51, 0x6D, 0xC6, 0x98, 0xD6, 0xB6, 0x45, 0x2C, 0x9E, 0x65, 0x34, 0x6B, 0x2F, 0x15, 0x0E, 0xDF,
-    0x2A, 0xBC, 0x85, 0x6C, 0xFF, 0x0D, 0xCD, 0x59, 0x3D, 0xAC, 0xE4, 0xD4, 0x15, 0x3E, 0xB6, 0x79,
-    0x6F, 0x14, 0x2C, 0xC5, 0x14, 0x4C, 0x41, 0x48, 0xD6, 0x14, 0x29, 0xA2, 0x95, 0xC0, 0x29, 0x29,
-    0x96, 0xBD, 0x86, 0x2D, 0x28, 0x52, 0xF0, 0x8A, 0x9D, 0x2A, 0xC5, 0xA6, 0x48, 0x24, 0xF2, 0x22,
-    0x65, 0x69, 0x90, 0x56, 0xD1, 0x0A, 0x9B, 0x50, 0xA4, 0xDC, 0xD7, 0x45, 0x4A, 0x93, 0x2D, 0x28,
-    0x92, 0x21, 0x62, 0x29, 0x28, 0x82, 0x04, 0xB2, 0x09, 0x65, 0x1A, 0x4B, 0x88, 0xDE, 0x89, 0x56,
-    0x8A, 0x44, 0x83, 0x93, 0x18, 0x64, 0x36, 0x1E, 0xDF, 0x7C, 0xDF, 0xB9, 0xB6, 0x67, 0xE6, 0xED,
-    0x13, 0xEC, 0x8A, 0x57, 0xE0, 0x99, 0x39, 0xF6, 0xD8, 0xF7, 0x9E, 0xFF, 0xBF, 0x7B, 0x2D, 0x47,
-    0x22, 0xEF, 0x8A, 0x3C, 0x2D, 0xC7, 0x77, 0x52, 0x6B, 0xF3, 0xE6, 0x82, 0x34, 0x37, 0xA4, 0xB9,
-    0x2D, 0x8D, 0x7C, 0xD3, 0xEF, 0x6D, 0x11, 0x2F, 0x95, 0x45, 0x2E, 0x17, 0x44, 0x5E, 0x5B, 0xA7,
-    0x85, 0x2D, 0x9F, 0x0E, 0xCA, 0xF0, 0x4A, 0xE9, 0xBF, 0x51, 0x4A, 0xF0, 0xCD, 0xBF, 0xF9, 0xC1,
-    0xEA, 0x6A, 0x62, 0x7B, 0xC3, 0x6F, 0x67, 0x6C, 0xBB, 0x5C, 0x1D, 0xDD, 0x7F, 0x47, 0x78, 0x18,
-    0x6B, 0x79, 0xCB, 0xDA, 0x2E, 0x03, 0x68, 0x0B, 0x80, 0x46, 0xE6, 0x23, 0xC1, 0xDF, 0x52, 0x01,
-    0x87, 0xE4, 0x04, 0xA9, 0xEC, 0x1D, 0x7C, 0xC8, 0xA3, 0x9F, 0x2F, 0xCC, 0x78, 0xD1, 0x4D, 0x17,
-    0xAD, 0xDC, 0x77, 0x3C, 0xD4, 0xAC, 0xA5, 0x1C, 0x1C, 0x15, 0x69, 0xD4, 0x7C, 0x9B, 0x7E, 0xC7,
-    0x72, 0x78, 0x5B, 0x99, 0x8B, 0xA9, 0x17, 0x4A, 0x91, 0x2E, 0x57, 0xAB, 0xD5, 0x8E, 0x88, 0x50,
-    0xE7, 0x20, 0x50, 0xE7, 0x46, 0x70, 0xFF, 0x2A, 0xFE, 0xE7, 0x62, 0x73, 0xCF, 0x4A, 0x60, 0x25,
-    0xDC, 0x48, 0xD4, 0x4B, 0xD2, 0x89, 0x69, 0xA4, 0x68, 0x64, 0x05, 0x95, 0x16, 0xB5, 0xD8, 0xDA,
-    0xB3, 0xA5, 0x6F, 0x73, 0x0C, 0x58, 0xE8, 0x80, 0xB8, 0x95, 0xA4, 0x96, 0x25, 0x9E, 0xAE, 0x52,
-    0xDF, 0x96, 0x81, 0x4D, 0x17, 0x56, 0x22, 0x37, 0xB7, 0x15, 0x53, 0x4B, 0x56, 0x4A, 0x91, 0x4A,
-    0x51, 0x5A, 0x7C, 0x8A, 0x32, 0xC3, 0xC7, 0xE0, 0x93, 0x54, 0x07, 0x29, 0xA8, 0x99, 0x52, 0x6C,
-    0x5A, 0x80, 0xA2, 0x67, 0xD3, 0x60, 0x50, 0xAA, 0x8A, 0x56, 0x29, 0x2B, 0x6D, 0xD3, 0x82, 0x7A,
-    0x46, 0xFA, 0xF4, 0x85, 0xAC, 0xC6, 0xA5, 0xAD, 0x94, 0x0B, 0xF2, 0xF1, 0x02, 0x39, 0x51, 0x5E,
-    0x16, 0x03, 0xA6, 0x85, 0xE4, 0x27, 0x22, 0x47, 0x49, 0x03, 0x9E, 0x1C, 0x57, 0xE4, 0xEB, 0x43,
-    0x72, 0x76, 0xC5, 0xE6, 0x0B, 0x0E, 0x8E, 0x36, 0xE1, 0x30, 0xD2, 0x68, 0x63, 0xF2, 0x88, 0xC1,
-    0xE0, 0xAA, 0x02, 0x9F, 0x90, 0x1F, 0x24, 0xE7, 0x4F, 0x82, 0x4F, 0xAC, 0xBF, 0xB8, 0x89, 0xF8,
-    0x01, 0xF2, 0x10, 0x1F, 0xEF, 0xC8, 0x03, 0x33, 0x6B, 0xA0, 0xF7, 0xAD, 0x02, 0x19, 0x41, 0xB0,
-    0x21, 0xE8, 0x47, 0xF0, 0x48, 0xD0, 0x1E, 0xA8, 0x17, 0xD1, 0x81, 0x07, 0x07, 0xB2, 0x3B, 0xF7,
-    0x30, 0x26, 0xAA, 0x68, 0x95, 0x92, 0x4E, 0x46, 0x60, 0x14, 0xE4, 0xA2, 0x06, 0x10, 0xEA, 0x4B,
-    0x84, 0xE8, 0x14, 0x78, 0x8A, 0x58, 0xC1, 0x00, 0xB0, 0x20, 0x89, 0x90, 0x20, 0xEA, 0x27, 0x10,
-    0xF7, 0x6A, 0xCD, 0x47, 0xDF, 0xE4, 0x8D, 0x8E, 0x37, 0xE8, 0x98, 0x31, 0x63, 0x24, 0xAE, 0x49,
-    0xA4, 0x72, 0x94, 0x3C, 0x5B, 0x7C, 0xD6, 0xFA, 0xF4, 0xDB, 0x80, 0x21, 0xA4, 0xC0, 0x93, 0x62,
-    0xA2, 0xE4, 0xEF, 0x53, 0x72, 0x72, 0x00, 0xDD, 0xC5, 0xDF, 0x7F, 0x79, 0xAC, 0x31, 0xE8, 0xFC,
-    0x25, 0xA3, 0xBF, 0xFC, 0xE2, 0xA5, 0x7F, 0xBC, 0x0C, 0xEC, 0xD5, 0x84, 0xDD, 0x10, 0x64, 0x94,
-    0xA3, 0x20, 0xB0, 0x04, 0x2B, 0x09, 0x6D, 0x19, 0xDB, 0xC6, 0x30, 0x6E, 0xFB, 0xF9, 0xAB, 0xE1,
-    0xDD, 0x46, 0xB6, 0x56, 0xE5, 0x89, 0x47, 0xCA, 0x98, 0x1D, 0xB4, 0x4E, 0x7F, 0x0B, 0x9B, 0x63,
-    0x5E, 0x2D, 0x91, 0xED, 0xF1, 0x83, 0xB9, 0x40, 0x2D, 0xB6, 0x95, 0x24, 0x78, 0x06, 0x7F, 0x92,
-    0xCB, 0x18, 0xFF, 0xD4, 0xE8, 0xBF, 0x87, 0x75, 0xD2, 0x65, 0x7D, 0xD1, 0x17, 0x9D, 0x69, 0x0E,
-    0xD2, 0x45, 0x2D, 0x49, 0x6A, 0x3A, 0x38, 0x48, 0xD6, 0xFB, 0xB6, 0x2E, 0xFA, 0x00, 0xA0, 0x0B,
-    0xF0, 0xB7, 0xF1, 0x6C, 0x0E, 0x87, 0x7B, 0x5C, 0x30, 0xE4, 0xD7, 0xE2, 0xDF, 0x35, 0x1D, 0x7C,
-    0x35, 0xEE, 0x33, 0x8C, 0x28, 0xCD, 0xA6, 0xE8, 0x17, 0x7A, 0xEA, 0x78, 0xEA, 0x33, 0xE8, 0x05,
-    0x9E, 0x81, 0xE1, 0x57, 0xE5, 0x20, 0xF5, 0xEF, 0xC6, 0xBD, 0xD9, 0xE0, 0xD3, 0xF3, 0xD6, 0xF1,
-    0x3A, 0x47, 0x9A, 0xF9, 0xE6, 0x99, 0x75, 0xFE, 0xBE, 0x03, 0x37, 0x5A, 0x23, 0x6D, 0x9F, 0x4B,
-    0x42, 0xDD, 0x66, 0xD6, 0x0C, 0x32, 0x9F, 0xF5, 0x3D, 0x17, 0xA6, 0x81, 0xE7, 0x37, 0xEB, 0xFC,
-    0x15, 0x91, 0xF9, 0xFB, 0xEA, 0x2A, 0x3D, 0x47, 0xE4, 0x17, 0xD7, 0xF0, 0x86, 0xED, 0x77, 0xB9,
-    0x3A, 0x37, 0xCE, 0x77, 0x8F, 0x0C, 0x8E, 0x1D, 0xE9, 0x2D, 0x04, 0x84, 0xF3, 0x2C, 0xFA, 0x9E,
-    0x4D, 0x9D, 0x03, 0x4B, 0x34, 0xD8, 0x52, 0x43, 0x0F, 0x0E, 0xDE, 0x16, 0xA5, 0x46, 0x36, 0x87,
-    0x65, 0xA5, 0x46, 0x18, 0x10, 0x54, 0x45, 0x99, 0x38, 0x9C, 0x85, 0x66, 0xB6, 0xF1, 0x12, 0x99,
-    0xC9, 0x95, 0x1F, 0x9B, 0xDB, 0xDF, 0x0E, 0x8E, 0x98, 0x7D, 0xDD, 0xBE, 0xD8, 0xC3, 0xA3, 0xBC,
-    0xAB, 0x62, 0xDF, 0xB0, 0x51, 0x63, 0x3B, 0xB8, 0x74, 0x6A, 0xFF, 0xBE, 0x31, 0x1F, 0x83, 0x78,
-    0x41, 0xDB, 0xF4, 0xC5, 0x2D, 0x6B, 0x9F, 0xB7, 0x8C, 0x96, 0x7F, 0xDB, 0xE4, 0x4B, 0x0C, 0xBB,
-    0xDE, 0x44, 0xF6, 0xA3, 0xDE, 0xD4, 0xF6, 0x77, 0x9B, 0xA8, 0xF5, 0xFE, 0x1C, 0xB5, 0x59, 0x65,
-    0x6F, 0xF5, 0x48, 0x6F, 0xC8, 0x6F, 0x20, 0x73, 0xAB, 0x63, 0x94, 0x67, 0x25, 0xC8, 0xFC, 0xB1,
-    0x65, 0xAC, 0x5B, 0x52, 0xBC, 0x86, 0x74, 0xC5, 0x30, 0x02, 0xAA, 0x04, 0x19, 0x4C, 0x42, 0x84,
-    0xC3, 0x0B, 0xBC, 0xAC, 0x98, 0x0F, 0xEC, 0x8B, 0x43, 0xD2, 0x40, 0x3E, 0xE6, 0xDD, 0xCF, 0xFA,
-    0xF8, 0x1E, 0x42, 0x8D, 0x02, 0x33, 0x1A, 0xAD, 0xF8, 0x03, 0x2B, 0x6D, 0x1D, 0x22, 0xEE, 0x16,
-    0x08, 0xFD, 0xC8, 0x22, 0x71, 0xD6, 0x8E, 0xFF, 0x23, 0x16, 0xB8, 0xD3, 0xC7, 0x56, 0x83, 0xFB,
-    0x4A, 0xDC, 0xD7, 0xE3, 0xBE, 0x2A, 0xF7, 0xB5, 0xB9, 0xAF, 0xD0, 0x7D, 0x9D, 0xEE, 0xAB, 0x75,
-    0x5F, 0xB3, 0xFB, 0xCA, 0xDD, 0xD7, 0x2F, 0x18, 0xDD, 0x51, 0xB1, 0x6F, 0x9B, 0x1D, 0x2D, 0x47,
-    0x9A, 0x7F, 0xB6, 0x8A, 0xDE, 0xEC, 0xE8, 0x3A, 0xFB, 0xD7, 0xB0, 0xA3, 0x6E, 0xFB, 0x37, 0xBB,
-    0xD5, 0xF8, 0xE7, 0xD0, 0xE0, 0x56, 0xE9, 0x5F, 0x58, 0xE6, 0xC9, 0x49, 0xEF, 0xFF, 0xB1, 0xCC,
-    0x95, 0x93, 0xEA, 0xFF, 0x3B, 0xE0, 0xDF, 0xAC, 0x7D, 0xFC, 0xDB, 0x6C, 0x0D, 0xF0, 0xF1, 0x86,
-    0xE5, 0x69, 0xB2, 0xC1, 0x47, 0x03, 0xA4, 0x9E, 0xCD, 0xF0, 0x86, 0x45, 0x89, 0x9D, 0x2D, 0x01,
-    0x5D, 0xD6, 0x3B, 0xC6, 0x40, 0xED, 0xDE, 0xB1, 0x87, 0xD9, 0xEC, 0x9A, 0x04, 0xFD, 0x99, 0xC4,
-    0x5A, 0xA3, 0xB3, 0x0A, 0x3C, 0x80, 0x33, 0x47, 0x12, 0x74, 0x80, 0x3C, 0xD3, 0xA7, 0x28, 0x16,
-    0xA6, 0x01, 0xB5, 0xAC, 0xC2, 0x30, 0x9B, 0x67, 0x95, 0x4F, 0x76, 0x83, 0x0D, 0x4C, 0x12, 0x76,
-    0x01, 0x79, 0x0A, 0xC9, 0x0A, 0x4C, 0x99, 0xA5, 0x2C, 0x47, 0x9C, 0x41, 0xA1, 0x38, 0x89, 0x85,
-    0x86, 0xF3, 0x68, 0x22, 0x4E, 0x85, 0x71, 0x74, 0x36, 0xA8, 0x29, 0x02, 0xE6, 0x6A, 0xE0, 0xA0,
-    0x75, 0x89, 0x86, 0x25, 0x83, 0x98, 0x42, 0x7A, 0x26, 0x90, 0x45, 0x70, 0x08, 0x4C, 0x81, 0xA3,
-    0xA2, 0x4E, 0xA1, 0x72, 0xF9, 0xAA, 0x2B, 0x16, 0x38, 0x70, 0x87, 0xBA, 0x11, 0xA1, 0xF6, 0x02,
-    0x35, 0x8A, 0x36, 0x72, 0x7D, 0x0F, 0xD6, 0x17, 0x1B, 0x5F, 0x1D, 0x11, 0xBA, 0x80, 0xC5, 0x72,
-    0x8C, 0x34, 0xF4, 0x56, 0x54, 0xB1, 0xA4, 0x02, 0x83, 0x51, 0xBD, 0x68, 0x13, 0xC7, 0x16, 0xE7,
-    0x04, 0x83, 0xCE, 0xF2, 0xAD, 0x9B, 0x07, 0xF9, 0x39, 0x13, 0x2E, 0xC3, 0xB9, 0x5A, 0xD0, 0x75,
-    0x2A, 0x01, 0x26, 0x13, 0xC3, 0xA2, 0x53, 0x1C, 0xBE, 0x2B, 0x98, 0x3E, 0xD8, 0x0B, 0x1A, 0xE7,
-    0xC5, 0x8C, 0xA0, 0xCB, 0x60, 0xFB, 0xFD, 0xBF, 0x8A, 0xD7, 0xDD, 0xC4, 0xED, 0x9B, 0x12, 0x56,
-    0xCF, 0x49, 0x94, 0x5F, 0x16, 0x83, 0xCF, 0x07, 0x92, 0x60, 0x7C, 0x8A, 0x7B, 0xD4, 0x77, 0x06,
-    0xAB, 0xA0, 0x4C, 0x94, 0xB0, 0x09, 0xCA, 0x52, 0x81, 0x1B, 0xE8, 0x23, 0x3A, 0x49, 0x7A, 0xB6,
-    0x3E, 0x21, 0xD8, 0x61, 0x0B, 0x95, 0x7A, 0x77, 0x95, 0xCA, 0x77, 0xC4, 0x1B, 0x58, 0x56, 0x03,
-    0xB6, 0x56, 0xE0, 0xAD, 0x66, 0x3F, 0xC5, 0x09, 0x40, 0x82, 0x6A, 0x5C, 0x85, 0x36, 0x8F, 0x07,
-    0xFE, 0xC3, 0x6D, 0xE8, 0x3F, 0x9C, 0x9C, 0xFA, 0x40, 0xA1, 0xC6, 0xD1, 0x53, 0x12, 0x54, 0x9C,
-    0xF8, 0xBE, 0x20, 0xFC, 0x59, 0x38, 0x49, 0x87, 0x33, 0x49, 0xC6, 0xE4, 0xA0, 0x8B, 0x7F, 0x42,
-    0x04, 0x82, 0x86, 0xC9, 0x67, 0xF5, 0x75, 0x8C, 0xB0, 0x9E, 0xA7, 0x89, 0x4A, 0x6B, 0xAB, 0x42,
-    0x23, 0xCB, 0x7C, 0xC1, 0xC7, 0xB0, 0x0D, 0xEB, 0x79, 0x5A, 0x40, 0x8C, 0xDE, 0x3D, 0x43, 0x2F,
-    0xC0, 0xB3, 0x8F, 0xAE, 0xD6, 0x56, 0x06, 0xC8, 0x21, 0x59, 0xA9, 0x0D, 0x4C, 0xCA, 0xE0, 0x2F,
-    0x1A, 0x92, 0x20, 0x72, 0xC3, 0xEE, 0x22, 0x54, 0x1E, 0x84, 0x32, 0x07, 0x0C, 0x4B, 0x22, 0xC7,
-    0x00, 0x3C, 0x5E, 0x92, 0x07, 0x3C, 0x2E, 0x4A, 0x0C, 0x40, 0x6B, 0x62, 0x6B, 0x76, 0x68, 0x0D,
-    0xF9, 0xEF, 0xC5, 0x2B, 0x39, 0xEA, 0xC7, 0x32, 0x35, 0x3C, 0xF3, 0x01, 0x15, 0xA0, 0xA9, 0x4F,
-    0x06, 0x0F, 0xD0, 0xC0, 0xB5, 0x60, 0x36, 0x14, 0xF1, 0x0A, 0x10, 0x7A, 0x46, 0xAE, 0x51, 0x88,
-    0xBE, 0x05, 0x3E, 0xD1, 0x2C, 0xE8, 0x1E, 0x0D, 0xC5, 0x63, 0x84, 0x90, 0x6E, 0x34, 0xA0, 0xB9,
-    0x21, 0x3D, 0xF4, 0xA6, 0xF0, 0x25, 0x74, 0x16, 0x31, 0xF9, 0x62, 0xFF, 0xAA, 0xD5, 0x9C, 0x1D,
-    0x0D, 0xBC, 0x7F, 0xC1, 0x50, 0x60, 0x96, 0x58, 0xEE, 0xAF, 0x10, 0xB4, 0x2D, 0x80, 0x05, 0x69,
-    0x1F, 0x36, 0x05, 0x70, 0x1D, 0x25, 0x5B, 0x28, 0x59, 0xD3, 0x50, 0x42, 0x6D, 0x08, 0xF4, 0xF0,
-    0x8A, 0x21, 0x45, 0x4B, 0x5D, 0xA3, 0x71, 0x6E, 0x8D, 0x2E, 0x0B, 0xEE, 0x6C, 0x2E, 0xD8, 0x9F,
-    0x80, 0xE9, 0x10, 0x6E, 0x88, 0xDF, 0x10, 0xC3, 0x2B, 0xC1, 0xF2, 0xA0, 0x3D, 0x56, 0xB9, 0x40,
-    0xD3, 0xB4, 0xB0, 0xD4, 0x49, 0x8E, 0x5C, 0xE8, 0x7A, 0xB6, 0x6D, 0xCE, 0x73, 0xC7, 0xA3, 0x39,
-    0x03, 0x0E, 0x6A, 0x84, 0x6E, 0xB9, 0xAC, 0xE0, 0x02, 0x07, 0x41, 0x36, 0x3A, 0xC1, 0xB8, 0x1A,
-    0xA9, 0x09, 0x2A, 0x76, 0x62, 0xE5, 0xC5, 0xF5, 0x7A, 0xED, 0xF4, 0xF7, 0x33, 0xFC, 0x7E, 0x48,
-    0xCB, 0xDE, 0xB8, 0x01, 0xD6, 0x9A, 0xE7, 0x60, 0x9A, 0x2A, 0xCE, 0x61, 0xDA, 0xF0, 0xDE, 0xAF,
-    0xA8, 0x0F, 0x62, 0x4A, 0x06, 0xC8, 0xEB, 0xAD, 0x4F, 0xB8, 0x14, 0x80, 0xD1, 0xEC, 0xFF, 0x10,
-    0xFF, 0x1D, 0xC6, 0x45, 0xA5, 0xF8, 0xCD, 0x33, 0x98, 0xFB, 0xEE, 0x4D, 0x80, 0x4B, 0x28, 0xE5,
-    0xF2, 0xEC, 0x3E, 0x5F, 0xDA, 0x03, 0xB6, 0x4E, 0x45, 0xE0, 0x5A, 0x5B, 0x56, 0xEA, 0xEE, 0xB5,
-    0xE9, 0xA1, 0xAF, 0x0F, 0x9B, 0xF9, 0x21, 0x99, 0x32, 0x7C, 0x48, 0xE7, 0xF0, 0xFA, 0xA9, 0x29,
-    0xD6, 0x8E, 0x35, 0x7E, 0x9B, 0x0F, 0x11, 0x48, 0xF2, 0x41, 0xCC, 0x87, 0x51, 0x8A, 0x38, 0x8B,
-    0x90, 0x42, 0x6A, 0xCC, 0x8D, 0xCA, 0x10, 0xAA, 0x4E, 0x17, 0x95, 0x8C, 0x51, 0xB3, 0x75, 0x8D,
-    0x6D, 0xE5, 0x4E, 0x76, 0x2E, 0xE7, 0x62, 0x93, 0x26, 0xD5, 0x54, 0x69, 0x5A, 0x33, 0x17, 0x1D,
-    0x3B, 0xFB, 0x17, 0x6C, 0xF5, 0x87, 0xBF, 0xCC, 0x85, 0xC9, 0xF6, 0xE3, 0xED, 0x27, 0xB7, 0x97,
-    0x8B, 0xED, 0x65, 0x62, 0x3F, 0x7C, 0x79, 0xAA, 0x38, 0x9F, 0xD5, 0x73, 0x75, 0xBB, 0xD5, 0xCC,
-    0x43, 0xA3, 0x69, 0xD5, 0xE7, 0x31, 0xA3, 0xBB, 0x2A, 0x76, 0xF2, 0x2C, 0x5C, 0x8B, 0x4A, 0x66,
-    0x0D, 0x84, 0xBE, 0xB4, 0x50, 0x21, 0x03, 0x79, 0x9A, 0xEF, 0x1E, 0xD1, 0x0E, 0xFF, 0x31, 0x66,
-    0xC9, 0x28, 0x27, 0x5B, 0x97, 0xBD, 0x0D, 0xF3, 0x2C, 0xF3, 0x73, 0xF1, 0xCF, 0x5E, 0x8D, 0x8B,
-    0xE6, 0x94, 0x4C, 0xA4, 0x89, 0x72, 0xC8, 0xC5, 0x65, 0xED, 0x15, 0xBC, 0x3C, 0xE4, 0x25, 0x7C,
-    0x07, 0x05, 0x8D, 0xE3, 0x90, 0x7F, 0xEC, 0x5B, 0xB8, 0x2C, 0x86, 0x3B, 0xF0, 0x52, 0x86, 0xB2,
-    0x0F, 0xF7, 0x02, 0xC0, 0x5F, 0x44, 0xA4, 0x65, 0x64, 0x52, 0x61, 0xA6, 0x43, 0xFA, 0x5C, 0xB8,
-    0x76, 0xA1, 0x61, 0x15, 0x65, 0x8E, 0x95, 0x45, 0xC5, 0x1A, 0xFD, 0x94, 0xF2, 0x9D, 0xAA, 0x06,
-    0x7D, 0x8D, 0x84, 0x27, 0x46, 0x45, 0xF5, 0xC9, 0xE9, 0xB5, 0xB7, 0xAB, 0xDB, 0x81, 0xAB, 0xB5,
-    0xA3, 0xBC, 0xA3, 0x41, 0x4C, 0x35, 0x96, 0x62, 0x99, 0x16, 0x0F, 0xA2, 0x9D, 0x83, 0x1A, 0x62,
-    0xAC, 0xEE, 0x63, 0xE9, 0x96, 0x69, 0x21, 0x33, 0xBA, 0x83, 0xB0, 0x48, 0xED, 0xA2, 0x72, 0x66,
-    0x73, 0xF5, 0xDD, 0x1F, 0xF6, 0x50, 0xED, 0x11, 0x2B, 0xF2, 0xFB, 0x51, 0x8D, 0xB1, 0x34, 0xFA,
-    0xC6, 0xD4, 0x31, 0x50, 0x2D, 0x81, 0xFE, 0x50, 0x56, 0xF0, 0x23, 0xEF, 0x53, 0xE4, 0xB1, 0x73,
-    0x8A, 0x5B, 0x37, 0x85, 0x51, 0x47, 0x3E, 0x19, 0x6D, 0x64, 0xB4, 0xF8, 0x24, 0x65, 0xC9, 0xC5,
-    0x2F, 0xF5, 0xD8, 0x15, 0xD9, 0xB5, 0xAE, 0x89, 0xA8, 0x01, 0x5D, 0x9E, 0x6C, 0xE4, 0x3E, 0x54,
-    0x44, 0xA3, 0xA8, 0x98, 0xB5, 0xF0, 0x63, 0xBF, 0x3A, 0x9A, 0x86, 0x33, 0x1D, 0x18, 0x44, 0xD9,
-    0x18, 0x95, 0xB8, 0x5D, 0xBC, 0x6D, 0x17, 0x6C, 0x2A, 0x80, 0x69, 0x26, 0xBD, 0x65, 0xD5, 0x08,
-    0x56, 0x44, 0x65, 0x1D, 0xC8, 0x21, 0x3B, 0xB5, 0xF4, 0xD6, 0x76, 0xAD, 0x76, 0x6A, 0x69, 0xB8,
-    0x8F, 0x58, 0x0D, 0x31, 0x63, 0x4F, 0xEC, 0xC8, 0x25, 0x40, 0xC5, 0xE5, 0x7F, 0xB9, 0x1B, 0xEB,
-    0xD7, 0xED, 0x09, 0x82, 0xA2, 0x66, 0x34, 0x60, 0x7D, 0x04, 0xD7, 0x83, 0xBB, 0x6D, 0x22, 0xAB,
-    0x6B, 0x30, 0x6B, 0x43, 0x6E, 0x22, 0x44, 0x5F, 0x5E, 0xB3, 0x57, 0x86, 0x9F, 0x22, 0xA7, 0xA5,
-    0x58, 0x50, 0x9F, 0x68, 0xA5, 0x61, 0x72, 0xF4, 0xA6, 0x0B, 0x57, 0x7B, 0x2C, 0x65, 0x05, 0x97,
-    0x6C, 0x56, 0x62, 0x4B, 0x7B, 0xD1, 0x63, 0xA9, 0x39, 0xA0, 0x0F, 0x98, 0xDF, 0x12, 0x3C, 0x8E,
-    0x38, 0xB6, 0x60, 0xCB, 0x40, 0xEE, 0xC9, 0x15, 0xB3, 0x9F, 0x4F, 0x7F, 0x72, 0xE8, 0x38, 0x31,
-    0x77, 0xC2, 0xF9, 0x56, 0xBE, 0xF2, 0xF0, 0xB9, 0x59, 0xF5, 0xE6, 0xB8, 0x16, 0x66, 0x92, 0x9D,
-    0x69, 0xEB, 0x45, 0xA2, 0x17, 0xBD, 0x96, 0x19, 0xB6, 0xA0, 0xA3, 0x8A, 0x0E, 0x98, 0x16, 0x8F,
-    0x4E, 0xA9, 0xC0, 0xF4, 0x54, 0x00, 0x4E, 0x14, 0x1F, 0xE5, 0x40, 0x35, 0x50, 0x74, 0x14, 0x3D,
-    0x2D, 0x5A, 0x0A, 0x9E, 0x52, 0x8D, 0x3C, 0xD5, 0xEE, 0xC4, 0xC8, 0xB3, 0xAA, 0x02, 0xB3, 0xA1,
-    0x02, 0x3C, 0xEA, 0x4F, 0x57, 0xB1, 0x54, 0x09, 0x44, 0xA5, 0x28, 0x85, 0x16, 0x24, 0x8A, 0xB9,
-    0x18, 0x54, 0x48, 0xA4, 0x44, 0xDE, 0x80, 0xC1, 0x82, 0xB1, 0x28, 0x90, 0xA3, 0xA3, 0x33, 0x04,
-    0x7B, 0xF2, 0x44, 0xC5, 0xCA, 0x1A, 0x95, 0x05, 0xEA, 0x9B, 0x4E, 0xBD, 0x16, 0x0A, 0x8A, 0x53,
-    0x54, 0x2A, 0xCC, 0x72, 0xBF, 0xA2, 0xD2, 0x9A, 0x48, 0xFE, 0x3E, 0x05, 0xC1, 0x24, 0x95, 0xC4,
-    0xC9, 0x07, 0xFA, 0xA8, 0xAC, 0xB4, 0x24, 0x6A, 0xAB, 0x5F, 0x69, 0xE1, 0x6B, 0x45, 0xED, 0xC8,
-    0x4A, 0xAE, 0x8D, 0x8A, 0x0A, 0x99, 0xAB, 0x61, 0x62, 0x3B, 0x76, 0x18, 0x1B, 0x7D, 0x44, 0x13,
-    0x52, 0x84, 0x48, 0x2B, 0x7E, 0xAA, 0x06, 0xA4, 0x2C, 0x44, 0x11, 0x8C, 0x43, 0xB5, 0x2F, 0x2E,
-    0xD5, 0x2B, 0x3D, 0xFA, 0x82, 0x77, 0xF5, 0x6C, 0xCB, 0xA1, 0xB0, 0x78, 0x7F, 0xA2, 0x75, 0x50,
-    0x90, 0x68, 0x9C, 0xAC, 0x57, 0xFF, 0xA1, 0xBE, 0xD4, 0x7C, 0x45, 0x37, 0x9A, 0xB1, 0x99, 0x6D,
-    0xA6, 0x26, 0x5B, 0x71, 0xCB, 0x8A, 0x5B, 0x81, 0xDD, 0x0C, 0xDA, 0xE3, 0xF5, 0x5A, 0x9B, 0x9C,
-    0xA2, 0x1A, 0xF3, 0x92, 0x06, 0xC7, 0x62, 0x98, 0x42, 0x82, 0x9A, 0x72, 0x11, 0x46, 0x0E, 0xBD,
-    0x79, 0x84, 0x12, 0xD6, 0x5D, 0x14, 0xED, 0x6D, 0xB2, 0x69, 0x84, 0xFA, 0x22, 0x4A, 0xED, 0x91,
-    0xDB, 0x83, 0x4C, 0x15, 0xD6, 0x0A, 0xE1, 0x20, 0x5A, 0x35, 0x4C, 0xA0, 0x7B, 0x3B, 0x81, 0x6E,
-    0xF3, 0x3C, 0x20, 0x74, 0xE3, 0x37, 0x0A, 0x1D, 0x86, 0x56, 0x61, 0x4D, 0xC8, 0xCE, 0x3B, 0xD0,
-    0x24, 0x70, 0xAE, 0xF0, 0x72, 0xA0, 0xB9, 0xD8, 0xD3, 0x0D, 0x40, 0x6E, 0xA3, 0xA6, 0xDC, 0x08,
-    0xE2, 0x76, 0x1D, 0x21, 0x3C, 0xA3, 0x49, 0xD8, 0xD4, 0x00, 0x26, 0x0A, 0xCD, 0x03, 0xC0, 0x64,
-    0x67, 0x96, 0xC3, 0x10, 0xDA, 0x2D, 0x66, 0x47, 0xC5, 0x51, 0x5C, 0xAE, 0x74, 0xFB, 0x6E, 0xBE,
-    0x5D, 0x2B, 0x44, 0xDF, 0xAC, 0x1A, 0xC8, 0x54, 0x27, 0x99, 0xEA, 0xE7, 0xE1, 0xE0, 0x30, 0x61,
-    0x70, 0xD8, 0x74, 0x63, 0x38, 0x53, 0xEF, 0x76, 0x14, 0x45, 0x7E, 0x3E, 0x17, 0x20, 0xB7, 0x31,
-    0x95, 0xCA, 0x8F, 0x58, 0xD3, 0x4C, 0x4E, 0xD0, 0x21, 0x2C, 0x0A, 0xBB, 0x39, 0x7E, 0x27, 0xD6,
-    0x99, 0xD7, 0x09, 0x28, 0x14, 0x6E, 0x1E, 0xDC, 0xF6, 0x2D, 0xD6, 0x29, 0xD1, 0xC0, 0x95, 0x4A,
-    0x8F, 0xEA, 0x13, 0x72, 0x65, 0xED, 0x55, 0x9A, 0x4B, 0x23, 0x74, 0x52, 0xA8, 0xEA, 0x82, 0xAE,
-    0xD1, 0xE3, 0xD6, 0x62, 0xA5, 0xDF, 0x92, 0x7E, 0xFE, 0xF8, 0x57, 0x65, 0x29, 0xB4, 0x9D, 0x70,
-    0x4D, 0xF7, 0x45, 0x66, 0xCF, 0x74, 0x25, 0xEE, 0xBE, 0xBA, 0x11, 0x28, 0xC7, 0x6F, 0xCE, 0xCB,
-    0x67, 0xA6, 0x45, 0x5D, 0x7F, 0x0F, 0xDA, 0x63, 0xD1, 0x88, 0xEF, 0xC3, 0x53, 0x73, 0x6E, 0xF5,
-    0x4B, 0x4C, 0x26, 0x44, 0xBE, 0x8F, 0xD3, 0x77, 0xE5, 0x5B, 0x7F, 0x68, 0x8B, 0xEA, 0x36, 0x60,
-    0x6E, 0xE8, 0xD7, 0xC3, 0xA5, 0x36, 0xAA, 0x90, 0x24, 0xD7, 0x65, 0xAA, 0x36, 0xAB, 0x32, 0xB6,
-    0xAB, 0x63, 0xC3, 0x3A, 0x9B, 0x6F, 0x6C, 0x20, 0x1C, 0x64, 0x48, 0xAA, 0x09, 0x9D, 0x0D, 0x9D,
-    0x11, 0x61, 0xB0, 0xE1, 0xF8, 0x1D, 0x71, 0x66, 0x74, 0x76, 0x74, 0x86, 0x54, 0x4B, 0x8A, 0x9A,
-    0xD2, 0xD9, 0xD2, 0x19, 0x13, 0x1D, 0x2B, 0xEB, 0xE1, 0x68, 0x4E, 0xB7, 0x1F, 0xAB, 0x06, 0x3D,
-    0x83, 0x20, 0x5B, 0x8E, 0x1F, 0xEC, 0x11, 0x1C, 0xCE, 0x26, 0x18, 0x9F, 0x26, 0x18, 0x2A, 0xC1,
-    0x78, 0x97, 0x60, 0x7D, 0x1F, 0x41, 0x6D, 0x65, 0xFD, 0x0D, 0x56, 0x35, 0xBD, 0x6D, 0x43, 0xFC,
-    0xA2, 0x36, 0xE3, 0x9E, 0x73, 0xAE, 0x4D, 0x49, 0xE9, 0x04, 0xD6, 0xCA, 0x3A, 0x36, 0x20, 0x53,
-    0xE3, 0x31, 0x35, 0x1D, 0x63, 0xDF, 0xA2, 0xAD, 0xC1, 0xB6, 0x4F, 0x09, 0x7B, 0xFF, 0x76, 0x84,
-    0x9E, 0x2F, 0x6E, 0x92, 0xC1, 0xD4, 0xC9, 0x90, 0x95, 0xF1, 0x80, 0x15, 0x59, 0xAF, 0x05, 0xCF,
-    0x5B, 0xCD, 0xF5, 0x6E, 0xA0, 0x2B, 0x6F, 0x34, 0x62, 0x4F, 0x24, 0xE8, 0x35, 0x80, 0xED, 0xA7,
-    0x28, 0x77, 0xB6, 0xD0, 0xCB, 0x06, 0x5D, 0xE2, 0xF7, 0xAC, 0xBE, 0x5D, 0x81, 0x44, 0x87, 0x0C,
-    0x39, 0x2D, 0x32, 0xBA, 0x9A, 0x18, 0x1B, 0x2D, 0xD7, 0x99, 0xA2, 0x52, 0x9C, 0x5C, 0xAF, 0xD1,
-    0xFC, 0xFA, 0x2D, 0x3A, 0x79, 0xB9, 0x49, 0x1F, 0xBD, 0x74, 0x09, 0xE0, 0xC2, 0xE3, 0x3B, 0xB2,
-    0x0A, 0xD1, 0x48, 0x6A, 0x52, 0x64, 0x86, 0xC6, 0x5C, 0xA9, 0x20, 0x8F, 0x79, 0x09, 0xEB, 0x33,
-    0x9B, 0xB1, 0x78, 0x70, 0x7D, 0xA3, 0xB9, 0x36, 0x1D, 0x97, 0x2A, 0x99, 0xA6, 0x92, 0x5D, 0xB8,
-    0xBC, 0x66, 0x87, 0x95, 0x8E, 0x11, 0x1D, 0xCF, 0x6A, 0x94, 0x15, 0x5C, 0xDB, 0x11, 0x8F, 0xD7,
-    0x9A, 0x2B, 0xD0, 0xDB, 0x11, 0xF1, 0x8F, 0xB4, 0xA6, 0xA2, 0xA8, 0x27, 0x57, 0x19, 0xB4, 0xC2,
-    0x35, 0xE3, 0x95, 0xBB, 0xB7, 0x3C, 0xD3, 0x73, 0xB9, 0xBF, 0xC2, 0x05, 0xBF, 0x6B, 0x1E, 0xDC,
-    0xE6, 0x8B, 0x5E, 0xE9, 0x9A, 0xFA, 0xF0, 0xE4, 0x6B, 0x1C, 0x5F, 0x7B, 0xD1, 0x99, 0xDA, 0x48,
-    0x92, 0x31, 0xFD, 0x4C, 0x0A, 0xAC, 0x49, 0x63, 0x6A, 0x6E, 0xC6, 0x35, 0x59, 0x6D, 0x3F, 0x84,
-    0xFA, 0xB2, 0x0A, 0xA7, 0x2B, 0x56, 0xB7, 0xB3, 0x82, 0x81, 0xDB, 0x25, 0x38, 0x85, 0x3D, 0x8C,
-    0x1D, 0x60, 0xA5, 0x11, 0xB5, 0x09, 0xB7, 0xF3, 0x22, 0x18, 0x04, 0x5E, 0x15, 0x37, 0xA6, 0x32,
-    0xA5, 0x6E, 0xA4, 0x64, 0xB9, 0x7D, 0x7E, 0xE0, 0x7E, 0x8B, 0xF5, 0x86, 0xA0, 0x97, 0x1D, 0x89,
-    0x9D, 0x64, 0x93, 0x98, 0x13, 0x03, 0xDB, 0xFF, 0xF3, 0xF3, 0xE5, 0x83, 0x44, 0xB1, 0xEA, 0x02,
-    0xF9, 0x4D, 0xD5, 0x01, 0x6F, 0x54, 0x3D, 0x2C, 0x6C, 0xAE, 0x4A, 0xD1, 0xAD, 0x73, 0x77, 0x56,
-    0xD5, 0xA0, 0xF1, 0x71, 0xDA, 0xF9, 0xE5, 0xC3, 0x24, 0x8A, 0xA9, 0x77, 0x3F, 0xC5, 0xEF, 0x96,
-    0xEF, 0x71, 0x41, 0xF6, 0x8C, 0xBE, 0x38, 0xD0, 0xFC, 0x7E, 0x75, 0xE2, 0x27, 0x35, 0x8E, 0x6E,
-    0xB9, 0xC7, 0x0F, 0xFE, 0x4F, 0xCF, 0xA7, 0xF1, 0x0F, 0x70, 0x1C, 0x3C, 0xA4, 0xFE, 0x9E, 0x78,
-    0x18, 0x21, 0xB5, 0x25, 0x3F, 0xAD, 0xBF, 0xF0, 0x0C, 0xFD, 0xA9, 0xB0, 0xEF, 0x41, 0xEF, 0x71,
-    0x67, 0xF8, 0x12, 0xA2, 0x8F, 0xFB, 0xAF, 0xF3, 0xB8, 0xED, 0xD8, 0x64, 0x67, 0xAC, 0x5B, 0x6B,
-    0x25, 0xBA, 0x5A, 0x32, 0x3B, 0xD0, 0xBD, 0x37, 0x5A, 0xDC, 0x7D, 0x70, 0xBE, 0xC3, 0xDE, 0x35,
-    0xD1, 0xAE, 0xA7, 0xD6, 0x16, 0x7B, 0x20, 0xBF, 0xD1, 0x86, 0xFB, 0x03, 0xFE, 0xDD, 0x07, 0xF3,
-    0xA1, 0xE8, 0x2B, 0xF9, 0xF1, 0xDD, 0x4B, 0xCB, 0x6C, 0xAC, 0x00, 0x6E, 0xC5, 0xF7, 0x18, 0xCE,
-    0x9E, 0xAA, 0xAD, 0xC8, 0x11, 0x07, 0x50, 0x5B, 0x91, 0x67, 0x1D, 0xB7, 0x54, 0x8A, 0xBC, 0xD8,
-    0x9E, 0x03, 0xBE, 0x4E, 0x64, 0x0F, 0xF7, 0x1E, 0xC6, 0x85, 0x27, 0xDB, 0xF9, 0xA7, 0xCE, 0xE8,
-    0x49, 0x8A, 0x4F, 0x56, 0xAB, 0x74, 0x7C, 0x8F, 0x5B, 0x9E, 0x3E, 0xAF, 0xD7, 0x6B, 0xFB, 0xA9,
-    0xDB, 0x61, 0x39, 0x73, 0x3E, 0xCA, 0x44, 0x91, 0x1F, 0xA6, 0xEC, 0x1E, 0x41, 0x6F, 0xE4, 0xA7,
-    0x68, 0x67, 0x3E, 0xA6, 0xFF, 0xD3, 0xF3, 0x69, 0xFC, 0x19, 0xF8, 0x9C, 0xC3, 0xA5, 0xA6, 0x29,
-    0x5A, 0x74, 0xB1, 0x5D, 0xD6, 0x3C, 0xB9, 0xF3, 0x20, 0xAE, 0xB2, 0xB6, 0xE8, 0xF8, 0x31, 0xB5,
-    0x37, 0xDF, 0x3D, 0x1C, 0x47, 0x5B, 0x8C, 0x7E, 0x34, 0x3F, 0x84, 0xC0, 0x59, 0x9F, 0xC1, 0x32,
-    0x49, 0xE3, 0xE9, 0x2B, 0x3F, 0xD3, 0xE9, 0xFF, 0x8E, 0xF5, 0x15, 0x98, 0xA7, 0xA7, 0xAD, 0xEE,
-    0x16, 0x6F, 0x9F, 0xD6, 0x7C, 0xD9, 0x72, 0x2F, 0xDF, 0x7D, 0x43, 0xB2, 0xFC, 0x3C, 0x3D, 0xD7,
-    0xD7, 0x44, 0xD5, 0x2B, 0xB2, 0xFD, 0xBE, 0x7A, 0x7E, 0x6F, 0x72, 0x0C, 0xDF, 0xF8, 0xE7, 0x58,
-    0x27, 0xA0, 0x73, 0x47, 0xCE, 0xF3, 0xBB, 0xF3, 0x7B, 0x25, 0xE7, 0x42, 0x1B, 0xAD, 0x5E, 0x4B,
-    0xCC, 0x7C, 0x1D, 0x6D, 0xE1, 0xEA, 0x39, 0x28, 0x9E, 0x0F, 0xF2, 0x23, 0x72, 0x1B, 0xBE, 0x2D,
-    0x4F, 0x2F, 0xF2, 0x4B, 0x41, 0x19, 0x5D, 0xD3, 0xF7, 0xAC, 0xE7, 0xC4, 0x79, 0x56, 0xCB, 0xC5,
-    0xFD, 0x3B, 0xE7, 0x68, 0xD0, 0xFF, 0x03, 0x75, 0x56, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x1D, 0x92,
-    0x88, 0x08, 0x88, 0xC5, 0xA6, 0x70, 0x9A, 0xB8, 0x60, 0xAF, 0x14, 0xFC, 0x03, 0xEF, 0x7E, 0x44,
-    0x94, 0xC6, 0x5F, 0x10, 0xA5, 0xF0, 0x0F, 0x04, 0x5A, 0x22, 0x6D, 0x1A, 0x7D, 0x82, 0x0A, 0x15,
-    0xA7, 0x53, 0xE1, 0x36, 0x01, 0x92, 0xDB, 0x4D, 0x8A, 0xB8, 0x48, 0x43, 0x23, 0xE9, 0x52, 0x98,
-    0x80, 0x65, 0x20, 0x48, 0x0A, 0x6F, 0x10, 0x22, 0xA1, 0x6C, 0x1E, 0x27, 0x6F, 0x76, 0x79, 0x3A,
-    0xD9, 0x42, 0x6E, 0x77, 0x4E, 0xE2, 0x70, 0x77, 0x66, 0x76, 0xE6, 0xBD, 0xD9, 0xA3, 0x7A, 0x24,
-    0x62, 0xA6, 0x82, 0xD9, 0x57, 0x10, 0x35, 0xD9, 0xAE, 0x09, 0xBA, 0xD3, 0x22, 0x18, 0xB6, 0xB3,
-    0xDE, 0x7A, 0x07, 0x61, 0xEF, 0x7E, 0x60, 0x63, 0x7F, 0x61, 0xD2, 0xBC, 0xA5, 0x86, 0x47, 0x52,
-    0xDC, 0x53, 0xB6, 0x21, 0xA2, 0x53, 0x98, 0x88, 0xF3, 0x01, 0x1E, 0x28, 0x9F, 0xA8, 0xC0, 0x1C,
-    0xA9, 0x1C, 0xA8, 0x0A, 0xA4, 0x30, 0x7B, 0xAA, 0x3B, 0xAA, 0x3D, 0x35, 0x9E, 0x74, 0x2B, 0x33,
-    0x7E, 0x0E, 0x57, 0x44, 0x1A, 0xEE, 0xDD, 0x40, 0x39, 0x07, 0x2A, 0x21, 0x35, 0x44, 0x3F, 0xED,
-    0x89, 0x75, 0x57, 0x4C, 0xDA, 0x57, 0xC1, 0xFA, 0xFA, 0x15, 0xFF, 0xDA, 0x30, 0x8F, 0x9A, 0x79,
-    0x38, 0xBA, 0xE2, 0x73, 0xCA, 0xE0, 0x28, 0x9F, 0x89, 0xB2, 0x4F, 0x89, 0x4E, 0xD6, 0xE7, 0x88,
-    0x3E, 0x40, 0xFA, 0x9C, 0xB9, 0x83, 0x53, 0x2A, 0x06, 0x82, 0xA9, 0x6B, 0xAA, 0x78, 0xC6, 0x5F,
-    0xAC, 0x25, 0x86, 0x3F, 0xB7, 0x08, 0x9B, 0xD3, 0xC7, 0x4C, 0x96, 0x27, 0x9C, 0x22, 0xD0, 0xC1,
-    0x1A, 0xAF, 0x0F, 0xB8, 0x83, 0xC2, 0xE7, 0x31, 0x03, 0x9F, 0xB5, 0x0A, 0xFB, 0x9B, 0x1E, 0x91,
-    0xFD, 0x3C, 0x42, 0x2D, 0x6B, 0xD9, 0x38, 0xCF, 0xAD, 0x6B, 0x6D, 0xEB, 0x8C, 0x33, 0xB6, 0x45,
-    0x06, 0xFE, 0x64, 0x64, 0x60, 0x82, 0x8F, 0x40, 0xB4, 0x36, 0xB0, 0xB3, 0xBE, 0x50, 0x88, 0x63,
-    0x11, 0xEC, 0xB6, 0x5E, 0x7C, 0xC5, 0x38, 0xCB, 0x89, 0x28, 0x1A, 0x0D, 0x8B, 0xBA, 0xC5, 0x71,
-    0xA1, 0xDE, 0x42, 0x3D, 0x26, 0xF5, 0x47, 0x06, 0x71, 0x54, 0x58, 0xEB, 0xD8, 0x67, 0xB0, 0x51,
-    0xCC, 0x2A, 0x14, 0x13, 0x64, 0xAE, 0x03, 0x9E, 0x3D, 0xD9, 0x19, 0xC7, 0x9E, 0xE1, 0x8F, 0xDB,
-    0x26, 0x38, 0xAF, 0x3D, 0x6A, 0x23, 0xDF, 0x3D, 0x7B, 0xE4, 0xC6, 0x54, 0xA8, 0x48, 0xE6, 0xCE,
-    0x88, 0x9E, 0x5C, 0xC3, 0x76, 0x5C, 0x67, 0xEA, 0xC1, 0xF9, 0xA6, 0x8F, 0xAB, 0xD2, 0xE8, 0x9D,
-    0xAC, 0xF5, 0x8A, 0x9D, 0xCF, 0x6F, 0x9C, 0x89, 0x05, 0x43, 0x10, 0x6B, 0x37, 0xC2, 0x6D, 0x0F,
-    0x31, 0x74, 0x72, 0x91, 0x2A, 0xF3, 0xDD, 0x7E, 0x3A, 0x9E, 0x30, 0x4F, 0xE6, 0xD5, 0x5E, 0xF9,
-    0x25, 0xD2, 0xBE, 0x62, 0x9E, 0x30, 0x2D, 0xCF, 0x98, 0x47, 0xEB, 0x4B, 0x6C, 0xC2, 0x77, 0x7A,
-    0xA4, 0xCC, 0x50, 0x8D, 0x32, 0x13, 0x4D, 0x94, 0x8F, 0x54, 0x04, 0xAA, 0x3A, 0x52, 0x3E, 0xEA,
-    0x8C, 0xA8, 0x31, 0x6D, 0x9C, 0xA7, 0xF1, 0x3B, 0x69, 0x1A, 0xA2, 0xDA, 0xC8, 0x32, 0xF9, 0x3C,
-    0xB8, 0x55, 0xB5, 0xA2, 0xBA, 0x3F, 0x05, 0x4C, 0xD1, 0x1C, 0xF6, 0x7F, 0x2F, 0x8E, 0x50, 0xF6,
-    0xB2, 0x97, 0x37, 0x9A, 0x76, 0x9F, 0xE2, 0x2F, 0x36, 0xC5, 0x5B, 0xF6, 0x25, 0x3F, 0xE9, 0xAA,
-    0x51, 0x75, 0x2A, 0x40, 0xFA, 0xDA, 0xD7, 0x5D, 0xE3, 0x6B, 0xAF, 0xDB, 0xC6, 0x6B, 0xA3, 0x5B,
-    0x0B, 0x2B, 0x0E, 0x66, 0x38, 0x6D, 0x6A, 0x86, 0x98, 0x69, 0x20, 0xC7, 0xA0, 0x92, 0xBE, 0x19,
-    0x91, 0x6D, 0xA0, 0x50, 0x2F, 0x3C, 0x48, 0x83, 0x81, 0x07, 0x8C, 0xAF, 0x98, 0xDC, 0xB3, 0x79,
-    0x41, 0xD3, 0x00, 0xF0, 0x76, 0x94, 0x7F, 0x2B, 0x46, 0x00, 0xAB, 0x0A, 0xF6, 0x50, 0xB5, 0x1C,
-    0x95, 0xA9, 0xF1, 0x5E, 0xD0, 0xA2, 0x7E, 0x1B, 0xE9, 0x40, 0x4A, 0x2E, 0x68, 0xA8, 0x43, 0x2A,
-    0xBD, 0x16, 0xA8, 0x75, 0x09, 0x19, 0x22, 0x0E, 0x72, 0x8C, 0xE2, 0x3C, 0x94, 0x8A, 0xB3, 0x2F,
-    0x04, 0xD9, 0xB3, 0x0B, 0xD4, 0x35, 0xBB, 0x0D, 0x58, 0x0C, 0x44, 0x14, 0xB0, 0x2F, 0xDC, 0x75,
-    0x3D, 0x7C, 0x20, 0x6F, 0x40, 0x13, 0x18, 0xD2, 0x46, 0xB4, 0x02, 0xB5, 0xC7, 0xC7, 0xC7, 0x40,
-    0xC3, 0x8D, 0xF0, 0xBA, 0x15, 0x6E, 0x67, 0xAF, 0x2C, 0xF6, 0x35, 0x10, 0xED, 0x61, 0xB8, 0x25,
-    0xC4, 0x45, 0x88, 0x99, 0x9E, 0xCE, 0x14, 0x91, 0x00, 0xB4, 0x9A, 0x8C, 0xCD, 0xE6, 0x0A, 0x67,
-    0xC2, 0x3B, 0x27, 0xEC, 0xB8, 0xBC, 0xCB, 0x52, 0x4E, 0x2C, 0xAD, 0x22, 0x4B, 0xFB, 0xC8, 0xD2,
-    0x39, 0xB1, 0x54, 0x21, 0x3F, 0x0D, 0x58, 0xAA, 0xEF, 0xB2, 0x54, 0x20, 0x5E, 0xDC, 0x67, 0x29,
-    0xCE, 0xD4, 0xE5, 0xF7, 0x59, 0x6A, 0xDE, 0x67, 0xE9, 0xA3, 0xC7, 0xA9, 0xCF, 0x24, 0x96, 0x1A,
-    0x61, 0xA9, 0xBF, 0x65, 0xE9, 0xFC, 0x3E, 0x4B, 0xE7, 0xC8, 0x54, 0xD4, 0xC5, 0x38, 0xF0, 0x74,
-    0xCF, 0xD2, 0xF9, 0x1D, 0x96, 0x1E, 0xAE, 0xD7, 0xE7, 0x3B, 0x96, 0xD6, 0x88, 0x23, 0x25, 0x7B,
-    0x89, 0xB3, 0x9A, 0x52, 0x4D, 0xA4, 0x1E, 0x4E, 0x52, 0x64, 0xF6, 0x6A, 0xF8, 0xD2, 0x3B, 0x96,
-    0x3E, 0x4C, 0x2C, 0x45, 0x1C, 0x7D, 0xB1, 0xAD, 0x13, 0x4B, 0xB7, 0x8D, 0x74, 0x1F, 0x4F, 0x6E,
-    0x1B, 0xEB, 0x0D, 0xFB, 0x46, 0x98, 0x69, 0x77, 0xE3, 0x39, 0x7B, 0xE4, 0x05, 0x7A, 0xB0, 0x74,
-    0x93, 0x58, 0x5A, 0x20, 0x66, 0x95, 0x58, 0xDA, 0x2E, 0x5C, 0x4E, 0xA3, 0x8B, 0x6B, 0xC1, 0x52,
-    0x6E, 0xF3, 0x11, 0xB1, 0x65, 0x7B, 0x96, 0x4A, 0x63, 0x91, 0x86, 0x76, 0x72, 0x76, 0x8F, 0xA5,
-    0x89, 0x8D, 0xEB, 0xBB, 0x2C, 0xFD, 0x86, 0xD0, 0x94, 0x92, 0x1E, 0x05, 0xC5, 0x04, 0x69, 0x49,
-    0x6A, 0xB1, 0x4A, 0x8F, 0xF4, 0x41, 0x64, 0xA9, 0x8D, 0x2C, 0x05, 0x79, 0xD0, 0xA6, 0x23, 0x4B,
-    0x9B, 0x76, 0x4F, 0xD1, 0xD3, 0x77, 0xE7, 0x42, 0x54, 0xA0, 0xAD, 0xDD, 0xB1, 0xF4, 0xD1, 0x4E,
-    0x75, 0x9F, 0xA8, 0xB7, 0x14, 0xD5, 0x71, 0x33, 0xCE, 0xBE, 0xEB, 0x05, 0xC9, 0xAD, 0x7C, 0x36,
-    0x87, 0x40, 0xE7, 0x8B, 0x78, 0xDA, 0xA6, 0x47, 0xD6, 0x3C, 0x98, 0x08, 0x36, 0x3A, 0xDA, 0xA0,
-    0x2E, 0x5B, 0x62, 0xDC, 0x25, 0x8C, 0xFE, 0xE9, 0x84, 0x61, 0xF3, 0x48, 0xD5, 0xF3, 0x73, 0x64,
-    0xAF, 0x47, 0xF6, 0x90, 0xE5, 0x1B, 0xF4, 0x60, 0x0F, 0xF6, 0xA2, 0xD2, 0xEE, 0x4A, 0x10, 0x3B,
-    0x10, 0x5F, 0x26, 0x2C, 0x3B, 0xFA, 0x90, 0xEC, 0xDB, 0x80, 0xEA, 0x07, 0xB4, 0x60, 0xB3, 0xEC,
-    0x01, 0x03, 0x91, 0x75, 0xDD, 0x39, 0x12, 0xD6, 0x0B, 0xE7, 0xC5, 0x13, 0xC7, 0x31, 0x93, 0xC3,
-    0xA5, 0x65, 0x77, 0x2C, 0x7E, 0x13, 0x49, 0x0C, 0x1A, 0xBB, 0x42, 0x88, 0xF5, 0xB5, 0xA0, 0xED,
-    0x05, 0x00, 0x53, 0x0B, 0x4A, 0x95, 0x50, 0x46, 0x4D, 0xD2, 0x2C, 0xB6, 0xE2, 0x4C, 0x50, 0xBE,
-    0xC5, 0x81, 0xCA, 0x11, 0x37, 0x9B, 0x0A, 0x20, 0xD8, 0x51, 0xFB, 0xF1, 0x19, 0x1A, 0x72, 0x0F,
-    0x68, 0x6F, 0xA9, 0xFC, 0x43, 0x42, 0xB2, 0x88, 0x02, 0xAF, 0xBF, 0xE0, 0x56, 0x9A, 0x73, 0x73,
-    0x83, 0x20, 0x0C, 0x2E, 0x97, 0x1C, 0x10, 0x7F, 0x3D, 0x22, 0xD0, 0x8E, 0x0E, 0x6E, 0xA4, 0x89,
-    0x52, 0x4C, 0x3C, 0xE2, 0x22, 0x12, 0x37, 0x70, 0x90, 0x4D, 0xD6, 0xC4, 0xCB, 0x6D, 0xB9, 0x18,
-    0xCA, 0xB1, 0x0A, 0xE5, 0xA0, 0xFA, 0x6A, 0x69, 0x67, 0x2A, 0xB5, 0x33, 0x8F, 0x76, 0xD6, 0xE2,
-    0x60, 0xE6, 0xC8, 0x9C, 0xFC, 0x8F, 0x9D, 0x7C, 0x95, 0x0B, 0x5C, 0x47, 0xED, 0x8B, 0x81, 0xA9,
-    0xFC, 0x37, 0x51, 0x43, 0x45, 0x19, 0x48, 0xBD, 0x9C, 0xA8, 0xFE, 0x11, 0x57, 0xBB, 0x07, 0x75,
-    0x40, 0xA2, 0x23, 0x0C, 0xB1, 0x63, 0xA3, 0x15, 0x16, 0x3B, 0xD9, 0x76, 0x7F, 0xBB, 0x17, 0x11,
-    0x33, 0x55, 0xBC, 0xDD, 0xD5, 0xED, 0xED, 0x8E, 0xB3, 0x1B, 0xCA, 0x2E, 0xAC, 0xD9, 0x50, 0xFE,
-    0x0F, 0x3F, 0x8B, 0xCD, 0x47, 0xDA, 0xD8, 0xAC, 0xA6, 0xDA, 0x97, 0xF0, 0x8E, 0x6F, 0xC4, 0xDE,
-    0x78, 0x89, 0x1E, 0xAD, 0xA3, 0x97, 0x46, 0x2C, 0x27, 0xD0, 0x46, 0xFE, 0xB3, 0x24, 0xFF, 0xA5,
-    0x02, 0xCD, 0x24, 0x27, 0xB9, 0xA4, 0xFC, 0x7C, 0x43, 0xC5, 0xDF, 0xB1, 0x15, 0x76, 0xB0, 0xD0,
-    0x57, 0x83, 0xB4, 0xF2, 0xBA, 0x13, 0x2B, 0x35, 0x4E, 0x1D, 0xCF, 0xBD, 0xB4, 0x72, 0x01, 0xCF,
-    0x09, 0x7D, 0x4E, 0xB4, 0x7A, 0x62, 0x68, 0x1B, 0xF9, 0x12, 0xB2, 0xB9, 0x1C, 0xF2, 0xA9, 0x18,
-    0x8A, 0x11, 0x82, 0xCC, 0x95, 0xA1, 0xC2, 0x50, 0xBD, 0x1A, 0x74, 0x04, 0x9E, 0x7A, 0x3D, 0x53,
-    0xFD, 0xD3, 0xB5, 0x84, 0x1F, 0x7F, 0x9A, 0x00, 0xB1, 0xB7, 0xA9, 0xC3, 0xA5, 0x5A, 0xF1, 0xA4,
-    0xDE, 0x0C, 0xF2, 0xFB, 0x25, 0x48, 0xE5, 0x0B, 0xE9, 0x43, 0x38, 0x71, 0x30, 0xAA, 0x9F, 0x5D,
-    0x87, 0xFD, 0x9F, 0xFC, 0x4E, 0x80, 0x1B, 0x8D, 0xC2, 0xA2, 0x6A, 0x3E, 0x43, 0x73, 0xC0, 0x54,
-    0x77, 0x7F, 0xEF, 0x98, 0xE5, 0xBA, 0xB3, 0x40, 0x31, 0x72, 0x7E, 0x4D, 0xFF, 0x01, 0x6D, 0x58,
-    0xBF, 0x8F, 0xDC, 0xD6, 0x11, 0x7E, 0xE4, 0x46, 0x22, 0x20, 0x16, 0x4C, 0x63, 0x18, 0x51, 0x0A,
-    0xA6, 0x0C, 0xE2, 0x82, 0x7F, 0x81, 0x45, 0xDA, 0x02, 0xE2, 0xF6, 0x10, 0xF8, 0x12, 0x20, 0x2A,
-    0x94, 0x22, 0x85, 0x91, 0x14, 0xD7, 0xA4, 0x74, 0x40, 0x22, 0x2A, 0xDC, 0xAA, 0x71, 0x6A, 0x15,
-    0x09, 0xE0, 0xAC, 0x8B, 0x6B, 0x03, 0x44, 0x10, 0x79, 0x76, 0xE1, 0x42, 0x0D, 0xE5, 0x20, 0x49,
-    0xE1, 0xC2, 0x04, 0x62, 0xC3, 0x90, 0x54, 0x88, 0x91, 0x28, 0x8B, 0xA7, 0x23, 0x39, 0xF9, 0xBE,
-    0x99, 0xC7, 0xBD, 0x3D, 0xD9, 0x5B, 0xCC, 0x70, 0x77, 0x1F, 0xDF, 0xFC, 0xFA, 0xE6, 0xC7, 0x7B,
-    0xCE, 0xE9, 0xE7, 0xB2, 0x8C, 0xA0, 0xB9, 0x88, 0x73, 0x81, 0xC8, 0xEC, 0xDC, 0x46, 0x64, 0x72,
-    0x2E, 0x91, 0xAF, 0xFF, 0xEE, 0x5C, 0xBA, 0x70, 0x49, 0x3E, 0x29, 0x1D, 0x48, 0xCB, 0xFE, 0xEA,
-    0x76, 0xEB, 0xEA, 0x8E, 0x2F, 0x08, 0xE8, 0xE2, 0xA4, 0x2D, 0xF1, 0x9A, 0x74, 0xE5, 0xA3, 0x8F,
-    0x40, 0xEB, 0xD6, 0xB9, 0x7A, 0x90, 0x06, 0x2B, 0x45, 0x1E, 0xDD, 0xE1, 0xC6, 0xD2, 0x63, 0x37,
-    0x91, 0x8E, 0x3B, 0x0B, 0xFE, 0x7E, 0x5D, 0xB6, 0x15, 0xC5, 0x70, 0xBB, 0x48, 0x05, 0xC4, 0xCB,
-    0x61, 0x41, 0x91, 0x7C, 0x0D, 0xB4, 0x52, 0x8A, 0x5F, 0x52, 0xD1, 0x45, 0xEE, 0x52, 0x71, 0x00,
-    0x9A, 0x7C, 0xD2, 0x83, 0xA6, 0xD7, 0x3B, 0x68, 0x5A, 0x7F, 0xDC, 0xAA, 0x84, 0x56, 0x37, 0xED,
-    0xB9, 0x12, 0x02, 0xF0, 0x83, 0x34, 0xB0, 0xA2, 0x2F, 0xAB, 0x8D, 0xBC, 0xE8, 0x66, 0x17, 0xCB,
-    0xFD, 0x66, 0xC4, 0x66, 0x7C, 0x35, 0x9B, 0xD3, 0xEB, 0x3D, 0x6C, 0xC9, 0xA3, 0xD6, 0xE5, 0xE3,
-    0xB5, 0xA4, 0x71, 0xE5, 0x70, 0x37, 0xA9, 0x5C, 0xDD, 0x4F, 0x19, 0x74, 0xFE, 0xDF, 0x90, 0x3B,
-    0x27, 0x4F, 0xFB, 0x3F, 0x82, 0x3E, 0xEB, 0x60, 0x71, 0x7D, 0xD6, 0x8E, 0x94, 0x41, 0xA9, 0xB9,
-    0x5C, 0xEF, 0x2B, 0xD0, 0x2F, 0xA0, 0x21, 0x6D, 0x69, 0x5C, 0xA4, 0x34, 0x58, 0x29, 0xCC, 0x08,
-    0xFB, 0x7B, 0x50, 0x6F, 0xD3, 0xDD, 0xA5, 0x41, 0x7C, 0xF5, 0x95, 0xCF, 0x8F, 0xE5, 0x54, 0x5D,
-    0x0C, 0x3D, 0x63, 0xA5, 0x99, 0xBA, 0xA3, 0x96, 0x47, 0xD4, 0x79, 0x74, 0x71, 0xB1, 0xC1, 0x8F,
-    0x78, 0x97, 0xF6, 0x43, 0x0A, 0xDF, 0x59, 0xFD, 0x1F, 0x1C, 0x5C, 0x85, 0xCE, 0x71, 0x2F, 0xD0,
-    0x39, 0x79, 0xB6, 0x90, 0x9E, 0xCD, 0xD0, 0x3C, 0x41, 0xA8, 0xEA, 0x3E, 0x45, 0xD4, 0xEA, 0x3E,
-    0x1B, 0x48, 0xF3, 0x7E, 0x47, 0x87, 0x12, 0xDB, 0x95, 0x63, 0x09, 0x4F, 0xE5, 0x73, 0x7D, 0x52,
-    0x51, 0xE0, 0x93, 0xEF, 0xD3, 0x1F, 0x7F, 0xCC, 0x94, 0x73, 0x48, 0x12, 0xAA, 0x3F, 0x37, 0x3B,
-    0xDA, 0xE9, 0xD2, 0x56, 0x75, 0xC6, 0xCB, 0xAA, 0x50, 0xA2, 0xCB, 0x53, 0xA3, 0x0A, 0x8E, 0xCC,
-    0x20, 0xA2, 0x56, 0xE7, 0x0A, 0xA0, 0x52, 0x69, 0x2D, 0x84, 0x17, 0x5E, 0x85, 0x72, 0xF2, 0x72,
-    0x7B, 0x07, 0x14, 0xEA, 0x40, 0x6E, 0xA3, 0xA2, 0x48, 0x35, 0x8A, 0x5C, 0xD8, 0xEA, 0xC2, 0x86,
-    0x1E, 0x50, 0x50, 0x28, 0xBD, 0x20, 0x70, 0xBA, 0xE0, 0xD0, 0x8C, 0x6F, 0x84, 0x8A, 0xD9, 0x58,
-    0x85, 0xA5, 0x2A, 0x2C, 0x97, 0x1B, 0x3D, 0xED, 0x76, 0x3F, 0xA4, 0x27, 0xB8, 0x50, 0x8C, 0xD2,
-    0xB9, 0xBF, 0x94, 0xAF, 0x0F, 0x55, 0xCC, 0xA2, 0x74, 0x56, 0x0F, 0x4C, 0x44, 0x23, 0x9D, 0x1E,
-    0x11, 0x74, 0x34, 0x7A, 0x54, 0x3A, 0xA8, 0xE9, 0xFD, 0x1A, 0x86, 0xEC, 0x3C, 0x0D, 0x02, 0xB5,
-    0x22, 0xD1, 0x7D, 0xB2, 0x1D, 0x9D, 0x15, 0xED, 0x46, 0x57, 0x55, 0x17, 0xCF, 0x37, 0xEB, 0x0F,
-    0xD1, 0xE0, 0x1F, 0x12, 0xEA, 0xF3, 0x5A, 0x91, 0xB5, 0xB9, 0xDC, 0xC6, 0xB6, 0x27, 0x32, 0x95,
-    0xF4, 0x52, 0x79, 0x5F, 0x16, 0x73, 0xDD, 0x97, 0xB2, 0xEA, 0x79, 0x2C, 0x52, 0xC3, 0x1B, 0x32,
-    0x45, 0x32, 0x12, 0x18, 0x32, 0x00, 0x2A, 0xF0, 0x4F, 0x20, 0xDD, 0x46, 0x1A, 0x3C, 0xC0, 0x93,
-    0xB0, 0x00, 0x0F, 0xF8, 0x0A, 0x23, 0xE0, 0x34, 0xFB, 0x0A, 0xBF, 0x45, 0x42, 0x1F, 0xC2, 0x75,
-    0xF8, 0x9A, 0xCD, 0x34, 0x02, 0x0F, 0xE5, 0xCC, 0x58, 0xE1, 0x77, 0x08, 0xE2, 0xC3, 0x1C, 0xF2,
-    0x61, 0xC0, 0x32, 0x48, 0x40, 0x8E, 0x63, 0x59, 0x02, 0x65, 0xE0, 0xBE, 0x7C, 0xCC, 0xE0, 0x01,
-    0xF8, 0x2E, 0x1F, 0x4B, 0x3E, 0x20, 0x77, 0x06, 0xA9, 0xF5, 0xC1, 0x85, 0xDF, 0xB5, 0xA9, 0x5F,
-    0x63, 0xD3, 0xBC, 0x0A, 0x7F, 0x48, 0x8D, 0x07, 0xB8, 0xAC, 0x48, 0x7A, 0x4F, 0x53, 0x29, 0x52,
-    0x48, 0x92, 0x2A, 0xC3, 0xEE, 0x52, 0xE5, 0xD8, 0xFA, 0x49, 0x95, 0x37, 0x2E, 0x3F, 0x6E, 0x40,
-    0xCB, 0xE3, 0xA6, 0xAC, 0x2E, 0x4B, 0xFD, 0x48, 0x3A, 0xFA, 0x59, 0x06, 0xA5, 0xFD, 0x25, 0xB9,
-    0xF9, 0x6F, 0x39, 0x08, 0x96, 0xE4, 0xC1, 0xE2, 0xC2, 0x25, 0xF9, 0xDC, 0xBC, 0x2D, 0xAD, 0xD2,
-    0xE6, 0x68, 0x39, 0x96, 0xA5, 0x8A, 0xC7, 0xE4, 0x1B, 0xE4, 0xD3, 0x10, 0x3F, 0x86, 0xC0, 0x3E,
-    0x3E, 0xEB, 0x49, 0x59, 0x24, 0xFA, 0x88, 0x69, 0xD7, 0x91, 0xE6, 0x6D, 0x44, 0x5B, 0xE0, 0xB6,
-    0xC6, 0x53, 0xE8, 0xF3, 0x17, 0x8F, 0x2B, 0xC5, 0x25, 0xF9, 0x70, 0x8E, 0x67, 0xE5, 0x8B, 0x95,
-    0xC0, 0x54, 0xA1, 0x59, 0x77, 0x06, 0x51, 0xC1, 0x56, 0x0E, 0x2B, 0xE8, 0xFA, 0x50, 0x79, 0x2C,
-    0xD1, 0x48, 0x8C, 0xA3, 0xF0, 0x0C, 0x88, 0x4D, 0x95, 0xCD, 0xD9, 0xE9, 0xBB, 0x1B, 0xF9, 0xB9,
-    0x4C, 0xC2, 0xD0, 0x89, 0xBC, 0x80, 0x25, 0xC4, 0xD6, 0x37, 0xE0, 0x4C, 0xAC, 0xB7, 0xEA, 0xAF,
-    0x0F, 0x62, 0x8A, 0xAB, 0x99, 0x62, 0x44, 0x28, 0x38, 0x85, 0x02, 0x96, 0x44, 0x7D, 0x00, 0x9E,
-    0x8D, 0x44, 0x7B, 0xA1, 0x00, 0x64, 0xF1, 0x34, 0x8E, 0xEF, 0x3D, 0xF9, 0x93, 0x02, 0x51, 0x63,
-    0x36, 0x14, 0x35, 0x71, 0x05, 0xAE, 0x10, 0x2D, 0x3D, 0xFE, 0x82, 0x03, 0x46, 0xE0, 0xA1, 0x8F,
-    0x92, 0xE6, 0x9A, 0x5B, 0x13, 0xC6, 0x4C, 0xD5, 0x0C, 0x53, 0x67, 0xDA, 0xC3, 0x98, 0xFA, 0x87,
-    0x81, 0xC0, 0x79, 0x48, 0xB3, 0x63, 0x09, 0xB5, 0x62, 0xE1, 0x41, 0xB7, 0x60, 0x64, 0xD4, 0x59,
-    0xD2, 0xA6, 0x92, 0x9F, 0x1E, 0x55, 0x50, 0xBB, 0x9E, 0xF3, 0x3E, 0xB4, 0xAC, 0xF2, 0x0A, 0xA1,
-    0x1A, 0x0F, 0x96, 0x55, 0x4D, 0xBE, 0xE8, 0xC3, 0xA2, 0xA9, 0x1B, 0xC9, 0x93, 0xD9, 0x11, 0x65,
-    0xB1, 0xC4, 0x88, 0xA5, 0x10, 0x98, 0x74, 0x28, 0x54, 0x4E, 0x16, 0x78, 0x94, 0x25, 0x30, 0x99,
-    0x69, 0x29, 0xBE, 0xA4, 0x13, 0x4D, 0xC5, 0x43, 0x86, 0x87, 0x0F, 0x08, 0xF0, 0x7C, 0x0C, 0xE5,
-    0xB3, 0x45, 0x61, 0x1B, 0xC8, 0x67, 0x34, 0x84, 0x0F, 0xFF, 0xD1, 0x36, 0x00, 0x78, 0x7E, 0xAE,
-    0x0D, 0x44, 0x9B, 0x07, 0x7B, 0x47, 0xED, 0xE2, 0x89, 0xA0, 0x14, 0xBA, 0x35, 0x27, 0x87, 0x5B,
-    0x6B, 0x28, 0xCC, 0xE6, 0xC6, 0x8C, 0x62, 0x91, 0x55, 0x5E, 0x4F, 0xE1, 0x4C, 0x2E, 0x23, 0x53,
-    0x56, 0x82, 0x65, 0x8C, 0x26, 0x17, 0x2C, 0xE1, 0xCB, 0x11, 0xB1, 0x0C, 0x96, 0xCD, 0xB7, 0x23,
-    0xA0, 0x1B, 0x2C, 0xD1, 0xB3, 0x11, 0xB0, 0x05, 0x0E, 0xFF, 0x3B, 0x00, 0xB8, 0xCC, 0x7E, 0xA2,
-    0x24, 0x7F, 0x85, 0x87, 0x73, 0x79, 0xFD, 0xB9, 0x30, 0x53, 0xEA, 0xCD, 0x53, 0xF6, 0xD6, 0x09,
-    0x2F, 0xB2, 0xDC, 0xCC, 0x53, 0xF4, 0x02, 0xAE, 0xDF, 0x2C, 0x53, 0x74, 0xA6, 0xDE, 0x19, 0x22,
-    0xD1, 0x38, 0x2A, 0x44, 0xC1, 0x01, 0xD2, 0x86, 0xBC, 0xF5, 0xBC, 0xF1, 0xB5, 0xA9, 0x50, 0xCC,
-    0xC1, 0x2B, 0xF1, 0xE2, 0x43, 0x79, 0x07, 0xBB, 0x31, 0x92, 0x8B, 0x83, 0xA2, 0x54, 0xA4, 0x89,
-    0x4D, 0x81, 0x8E, 0xA6, 0x3E, 0x3F, 0x44, 0x97, 0x80, 0x6F, 0x80, 0xFB, 0x21, 0x1D, 0x1C, 0x9A,
-    0x41, 0x32, 0x22, 0xEB, 0xEA, 0x4F, 0x24, 0x19, 0x33, 0xF8, 0xE9, 0x53, 0x70, 0x20, 0x48, 0x6E,
-    0x2D, 0xE0, 0x5D, 0x20, 0xEF, 0xCC, 0xE9, 0x50, 0xB6, 0x81, 0x44, 0x53, 0xD6, 0xD7, 0x4D, 0x28,
-    0x31, 0x38, 0x8B, 0x4B, 0x32, 0xE5, 0xBD, 0x54, 0x1B, 0x5D, 0x25, 0x45, 0xC4, 0x55, 0x0F, 0xA0,
-    0x0C, 0x57, 0x7D, 0x02, 0x65, 0xF8, 0xEF, 0xA7, 0x70, 0x2E, 0xFF, 0xBD, 0xB5, 0x18, 0xFF, 0x00,
-    0x6A, 0x0D, 0x14, 0x08, 0xB5, 0xB0, 0x17, 0x01, 0x8C, 0x55, 0xE8, 0x75, 0xA8, 0x2A, 0x9D, 0x26,
-    0xAD, 0xCB, 0x1F, 0x90, 0x17, 0xAE, 0x3C, 0xD1, 0xC2, 0x49, 0xB5, 0x84, 0xD5, 0x90, 0x9F, 0x2B,
-    0x1F, 0xB9, 0xBD, 0xA2, 0x6F, 0xC5, 0x77, 0x5B, 0x2F, 0x95, 0x35, 0x51, 0x2B, 0xFD, 0xE6, 0x1B,
-    0x9F, 0xAF, 0x56, 0xEC, 0xAD, 0xCE, 0xFF, 0xAE, 0xE2, 0x8A, 0x48, 0x06, 0x4B, 0xEC, 0xC5, 0x0F,
-    0x24, 0x64, 0x94, 0x58, 0xE1, 0x65, 0x34, 0xCF, 0xC2, 0x59, 0xF9, 0x64, 0xE1, 0x27, 0xE2, 0xF0,
-    0xC8, 0x81, 0x04, 0xE8, 0xA2, 0x77, 0x51, 0x3C, 0xD9, 0x77, 0xD0, 0xE6, 0x98, 0x8A, 0x60, 0xA9,
-    0x31, 0x76, 0x39, 0x2C, 0xA9, 0x07, 0xBA, 0xFF, 0x6D, 0x86, 0x2D, 0xB1, 0x36, 0xE1, 0xBB, 0x05,
-    0xF4, 0xCA, 0xA8, 0x43, 0x3D, 0xE6, 0xAD, 0x0E, 0x2F, 0xDF, 0x19, 0x05, 0xDC, 0xCF, 0xB6, 0xDB,
-    0xBF, 0x59, 0xEB, 0x63, 0x14, 0xEB, 0x35, 0xFB, 0xFC, 0xE7, 0x88, 0xCD, 0x28, 0xD2, 0xEA, 0x93,
-    0x2A, 0x2D, 0xB9, 0x6F, 0x20, 0xF3, 0xCD, 0x86, 0xC8, 0x08, 0xAA, 0x0B, 0x33, 0x42, 0xC6, 0x77,
-    0x83, 0x72, 0xC6, 0x08, 0xE5, 0x7B, 0xB4, 0x1A, 0x98, 0xA8, 0x63, 0xCD, 0x1B, 0x46, 0x33, 0xDF,
-    0x1E, 0x3D, 0x1D, 0xD6, 0x06, 0x1C, 0x78, 0xDA, 0xFA, 0x5E, 0x89, 0xBE, 0x29, 0xF3, 0x8D, 0x4E,
-    0xC5, 0x76, 0xBA, 0xB4, 0x53, 0x13, 0x3B, 0x35, 0xED, 0xF6, 0x9A, 0x52, 0x70, 0x58, 0x24, 0x54,
-    0x85, 0xE5, 0x9C, 0x0E, 0xC9, 0xCD, 0x75, 0xB5, 0x7A, 0x29, 0xD0, 0xBE, 0x39, 0x69, 0x61, 0xCD,
-    0xA6, 0x98, 0xAA, 0xA0, 0xA4, 0x2C, 0x5A, 0x50, 0x74, 0x9E, 0x2C, 0x7B, 0x6D, 0xCB, 0xF5, 0x53,
-    0x95, 0x2B, 0xCF, 0x68, 0x51, 0x66, 0xB1, 0xC9, 0x0D, 0x14, 0xCA, 0x9C, 0x7B, 0x03, 0x74, 0xCB,
-    0x30, 0xBF, 0xB0, 0x0C, 0xB8, 0x65, 0x41, 0x7F, 0x9B, 0x2C, 0x12, 0x55, 0x3B, 0x16, 0xB5, 0x90,
-    0xFD, 0xAC, 0xD7, 0xB8, 0x31, 0x36, 0x88, 0x14, 0x86, 0x00, 0x02, 0x87, 0xF2, 0xC8, 0x66, 0x9D,
-    0x50, 0x32, 0x2B, 0x42, 0x80, 0x90, 0xD1, 0x48, 0x3B, 0x47, 0xAC, 0x34, 0x31, 0x05, 0x76, 0x73,
-    0x03, 0x43, 0x27, 0xDF, 0xA8, 0x82, 0xDC, 0x39, 0x50, 0x97, 0x86, 0x5A, 0x34, 0x37, 0xAA, 0x77,
-    0xA4, 0x81, 0xC8, 0xE4, 0x1D, 0xFD, 0xB3, 0x2C, 0xBC, 0xDB, 0x93, 0x2F, 0xB9, 0xE6, 0x72, 0xA2,
-    0x9E, 0xB5, 0x39, 0x49, 0x8D, 0x0E, 0xB5, 0x93, 0xA4, 0xBA, 0x81, 0x76, 0x7B, 0xF7, 0x66, 0xD9,
-    0x9F, 0x63, 0x77, 0x6F, 0x50, 0x39, 0xFF, 0x04, 0xB5, 0x7C, 0xE5, 0x76, 0xC5, 0xB9, 0xDA, 0x3D,
-    0xF5, 0x6B, 0x09, 0xF7, 0xE0, 0x49, 0x1E, 0xFE, 0x7A, 0x1D, 0x97, 0xA9, 0x91, 0x2D, 0x7C, 0xED,
-    0xDD, 0xC8, 0xD7, 0x7A, 0x56, 0x47, 0xDB, 0x98, 0xE9, 0x6E, 0x2F, 0x43, 0xB6, 0x4F, 0x1A, 0xB0,
-    0x72, 0x97, 0x3E, 0xEB, 0x53, 0xBB, 0x7B, 0x6A, 0xFC, 0x13, 0xA1, 0x52, 0xF7, 0xC1, 0xBD, 0xDB,
-    0x0A, 0x1D, 0xE9, 0x33, 0x9D, 0x94, 0x2A, 0xCE, 0xFD, 0xC2, 0x99, 0xA3, 0x08, 0xE5, 0x81, 0x3C,
-    0x26, 0x30, 0xF0, 0x05, 0xF5, 0xC0, 0x86, 0x10, 0x14, 0x15, 0xD4, 0x5A, 0xA4, 0x54, 0x8E, 0x72,
-    0x82, 0xA7, 0x04, 0xE8, 0x98, 0x90, 0x53, 0x52, 0x25, 0xE8, 0xD7, 0x03, 0xCA, 0x13, 0x26, 0x01,
-    0x86, 0x22, 0x99, 0x59, 0xE1, 0x19, 0x75, 0xAD, 0x67, 0x0A, 0x52, 0x45, 0x6D, 0x2E, 0x2F, 0xA1,
-    0xF7, 0x99, 0x37, 0x05, 0xE5, 0xE3, 0x5D, 0xEF, 0x9C, 0xB2, 0x5D, 0xDD, 0x54, 0xEE, 0x26, 0x8E,
-    0x7A, 0xF7, 0x24, 0xE7, 0x4F, 0xD5, 0xEA, 0xCD, 0xB5, 0x2D, 0xC0, 0x02, 0xF7, 0x9D, 0xA7, 0xD5,
-    0xE3, 0x83, 0x4D, 0x2C, 0x8B, 0xF7, 0x75, 0x61, 0x49, 0xCA, 0xDD, 0xAC, 0xA2, 0xC0, 0x95, 0x94,
-    0x07, 0x27, 0x78, 0x56, 0x1B, 0xA3, 0x98, 0x50, 0x4E, 0x0C, 0x25, 0x9F, 0x8A, 0xCA, 0xBB, 0xAF,
-    0xF9, 0x29, 0x4F, 0xB4, 0xD3, 0xFA, 0xB0, 0xAD, 0x15, 0x4B, 0x77, 0x2E, 0x72, 0x0D, 0x60, 0xA3,
-    0x08, 0xD9, 0xB4, 0xFA, 0x2D, 0xEE, 0x54, 0x78, 0xFA, 0x54, 0x43, 0x0A, 0xCB, 0x45, 0xDF, 0x62,
-    0x0A, 0x84, 0x0B, 0x76, 0xAE, 0x30, 0x73, 0x09, 0x3D, 0x9F, 0x74, 0x33, 0x73, 0x2C, 0x6B, 0xFE,
-    0x60, 0xC9, 0xFC, 0x13, 0x63, 0x6E, 0xB3, 0x32, 0x35, 0x5C, 0x9B, 0x87, 0x0B, 0x6E, 0x8A, 0xFD,
-    0xE6, 0xD9, 0x64, 0x4C, 0x8D, 0xDD, 0x2C, 0x85, 0x56, 0x94, 0x53, 0xC3, 0x54, 0xA7, 0xC9, 0x38,
-    0xAD, 0x43, 0x4F, 0xBE, 0x70, 0xFE, 0xE4, 0x04, 0x50, 0x5C, 0x96, 0x97, 0xC7, 0xF2, 0x55, 0xBC,
-    0x37, 0x92, 0x39, 0x66, 0x12, 0xA1, 0xE1, 0x83, 0xE7, 0x87, 0xB1, 0xF6, 0x0D, 0x79, 0x84, 0x72,
-    0xBD, 0x61, 0x2B, 0x85, 0x02, 0x35, 0x16, 0xEE, 0xEA, 0xD3, 0xA2, 0x05, 0x45, 0x0B, 0xE8, 0xC3,
-    0xF3, 0x33, 0xC4, 0x78, 0x7E, 0xCC, 0x5C, 0x0F, 0x9B, 0xE7, 0xB4, 0x5E, 0xB3, 0xE2, 0x8A, 0x5A,
-    0x94, 0x36, 0x7A, 0x76, 0x65, 0x39, 0xD2, 0xF2, 0x19, 0x69, 0xBF, 0xCD, 0x74, 0x76, 0xC7, 0x0F,
-    0x35, 0xD0, 0xBE, 0xDC, 0x0B, 0x7A, 0x58, 0xA7, 0xC7, 0x83, 0x66, 0xA6, 0xAC, 0x82, 0x85, 0x60,
-    0x09, 0x68, 0xD6, 0x14, 0xB2, 0x0A, 0x4E, 0x1B, 0x56, 0xD7, 0x11, 0x1E, 0x19, 0x6A, 0x74, 0x60,
-    0xE9, 0x6B, 0x8E, 0x65, 0xBD, 0x0E, 0x65, 0xA0, 0x09, 0x86, 0x4F, 0xD0, 0x13, 0x69, 0xA5, 0x4F,
-    0x4F, 0x10, 0xE5, 0x21, 0xFB, 0x13, 0x42, 0x3E, 0xE5, 0xB7, 0x30, 0xAE, 0x2E, 0xF9, 0x75, 0x29,
-    0x32, 0x0E, 0xE7, 0x85, 0xFA, 0x41, 0x55, 0x10, 0x6D, 0x4E, 0x8B, 0xFA, 0x10, 0x87, 0x9D, 0x60,
-    0x56, 0xBF, 0xAB, 0x79, 0xE1, 0xB0, 0x0E, 0xC2, 0x66, 0x80, 0x05, 0x28, 0x37, 0x56, 0x1A, 0x13,
-    0x5F, 0x8A, 0x95, 0x6D, 0xA4, 0xB6, 0x12, 0xA3, 0x20, 0x4F, 0x66, 0x65, 0xE9, 0xC4, 0x53, 0x5D,
-    0xAD, 0xEE, 0xD7, 0x56, 0x46, 0xFF, 0x1B, 0x43, 0x04, 0x6C, 0x16, 0xAC, 0xC8, 0x6E, 0xC8, 0x61,
-    0xF9, 0xBC, 0xD0, 0x12, 0xC7, 0xFE, 0xAD, 0x2C, 0xA8, 0xE7, 0xC3, 0xF2, 0xB4, 0xD0, 0x01, 0x7F,
-    0xD4, 0x54, 0xCF, 0x46, 0x2D, 0xFC, 0xD9, 0xA8, 0x80, 0x41, 0x1C, 0x88, 0x14, 0x30, 0xB6, 0x16,
-    0x30, 0x96, 0xAE, 0xD4, 0x0A, 0x68, 0x32, 0x5D, 0xEC, 0x4F, 0x36, 0x3B, 0xA6, 0x5A, 0x7D, 0x12,
-    0x2D, 0xD4, 0x31, 0x92, 0x19, 0xB8, 0x2C, 0x36, 0x7B, 0x87, 0xBB, 0xD0, 0x5B, 0x52, 0x5D, 0xD9,
-    0x6E, 0x8F, 0xE5, 0x4E, 0xAA, 0x9A, 0x2A, 0x48, 0xBA, 0x4B, 0x37, 0x44, 0x9E, 0x17, 0x0C, 0x59,
-    0x45, 0xC3, 0x47, 0x6B, 0xD0, 0x70, 0xB2, 0xD6, 0xE0, 0x5A, 0xB6, 0xDB, 0x6D, 0xB1, 0x7F, 0xEE,
-    0xF3, 0x14, 0x47, 0xB6, 0xDB, 0x10, 0xF8, 0xE1, 0x51, 0xAB, 0x62, 0x5B, 0x7F, 0xAB, 0xE0, 0x67,
-    0x82, 0xFD, 0x93, 0x2C, 0xF0, 0xA1, 0x9E, 0x4E, 0x1A, 0x3D, 0x7D, 0x2F, 0xEA, 0x5F, 0x8F, 0xC2,
-    0x5E, 0xA1, 0xD2, 0xA9, 0x23, 0x31, 0x91, 0x4C, 0x65, 0x04, 0xA0, 0x76, 0xF7, 0x34, 0x3A, 0x6A,
-    0x10, 0x07, 0xFA, 0xD4, 0x43, 0x45, 0xE9, 0x48, 0xC0, 0x94, 0x83, 0x02, 0x66, 0xD8, 0xE8, 0x29,
-    0x3B, 0x52, 0x1A, 0x77, 0xE7, 0x34, 0x69, 0x95, 0x36, 0x3C, 0x7D, 0x13, 0xA1, 0xE5, 0x94, 0x55,
-    0xCC, 0x9E, 0xBC, 0x38, 0xA0, 0xC0, 0xE3, 0x55, 0xE7, 0xE8, 0xA2, 0xCE, 0x9A, 0x7B, 0xAA, 0xB8,
-    0x87, 0x8A, 0x65, 0x26, 0xEA, 0x1E, 0x07, 0x81, 0x91, 0x83, 0xAA, 0xC3, 0xF4, 0xC9, 0x24, 0xCE,
-    0x7A, 0xAD, 0x56, 0xE5, 0xF3, 0xDF, 0xCB, 0x61, 0x11, 0x5B, 0x58, 0x6D, 0xDA, 0xAC, 0x8C, 0x15,
-    0x9A, 0x76, 0x5B, 0x7A, 0x3E, 0xB3, 0x83, 0x2D, 0xE7, 0x15, 0x94, 0x66, 0xA6, 0x14, 0x32, 0x94,
-    0xD9, 0x84, 0xA2, 0x5C, 0x1B, 0xD3, 0x7E, 0xB9, 0x58, 0xF7, 0x9C, 0xF5, 0x50, 0x97, 0x4E, 0x81,
-    0xF5, 0x6C, 0x0D, 0x5D, 0x3E, 0x6E, 0x56, 0xD6, 0xF2, 0xE8, 0xB1, 0x11, 0xED, 0x0A, 0xFE, 0x1C,
-    0xE0, 0xEC, 0x14, 0x80, 0xC0, 0x55, 0xEB, 0x21, 0xE3, 0x42, 0xDF, 0xB2, 0x92, 0xB2, 0x5E, 0x30,
-    0x4D, 0x6E, 0xBD, 0x09, 0x08, 0x65, 0x39, 0xEE, 0xAD, 0x85, 0xDE, 0xDE, 0xD5, 0xA8, 0x57, 0x99,
-    0xAF, 0x5F, 0xBE, 0xEF, 0x58, 0x8F, 0xF3, 0xFD, 0x2F, 0xB7, 0x5F, 0x63, 0xAB, 0x60, 0xE1, 0xEE,
-    0xEC, 0xE2, 0x4F, 0x37, 0x28, 0x11, 0xEF, 0x5D, 0xB9, 0x8E, 0x91, 0xFE, 0xE9, 0x92, 0xFF, 0x53,
-    0xDC, 0x3F, 0x20, 0xF4, 0x99, 0xB8, 0xE7, 0x73, 0xFE, 0x19, 0xD8, 0xBD, 0x29, 0x7F, 0xE7, 0x8C,
-    0xA3, 0x41, 0x1E, 0x59, 0xC1, 0xB8, 0xE9, 0x21, 0x41, 0xEC, 0x9E, 0xA9, 0xB2, 0x71, 0x3B, 0x1F,
-    0xF1, 0x26, 0xAA, 0xD5, 0xE8, 0x25, 0x27, 0x63, 0x56, 0xD8, 0xB4, 0xE9, 0x13, 0xA9, 0xD9, 0x1B,
-    0x19, 0xAA, 0xC4, 0x86, 0x95, 0xBD, 0xCF, 0xD5, 0x2D, 0xA7, 0x3B, 0xBB, 0x16, 0xD8, 0xBF, 0x10,
-    0x28, 0xED, 0x5A, 0xC0, 0x46, 0x86, 0x0B, 0x77, 0x1C, 0x7B, 0x37, 0x1D, 0x36, 0x2C, 0x64, 0xFB,
-    0x97, 0x2A, 0x7B, 0x57, 0x2B, 0xE5, 0xF0, 0xFD, 0xC3, 0x82, 0x52, 0xC2, 0x69, 0xA6, 0x9A, 0xD3,
-    0xC6, 0x13, 0x6D, 0x4A, 0x3A, 0x65, 0x0D, 0xEE, 0xD2, 0x61, 0x7D, 0x7A, 0xA0, 0x83, 0xAA, 0x5E,
-    0xC6, 0xF1, 0x6B, 0x61, 0x9B, 0x44, 0x76, 0x17, 0xD5, 0xD8, 0x25, 0x60, 0xAE, 0x03, 0xE7, 0xE9,
-    0x2A, 0x52, 0x75, 0x50, 0xD5, 0xFC, 0xC1, 0xA3, 0xF2, 0xB1, 0xB1, 0x69, 0x42, 0x77, 0x57, 0xAD,
-    0x54, 0x4D, 0x9D, 0x45, 0xFD, 0xCD, 0xDE, 0x85, 0xFB, 0x3D, 0xF7, 0x1B, 0x02, 0xEC, 0xA8, 0x5B,
-    0x0F, 0x9F, 0x9A, 0xF5, 0x91, 0x9F, 0x2C, 0x47, 0xF5, 0xC1, 0x80, 0x6C, 0xFD, 0x51, 0xF9, 0x2D,
-    0x7D, 0x59, 0xFA, 0xDB, 0xC8, 0x53, 0xAA, 0xB3, 0xEC, 0xAA, 0x24, 0x8A, 0x64, 0x70, 0xE8, 0x7E,
-    0xC1, 0x28, 0x50, 0x11, 0x1D, 0x32, 0xEC, 0xAE, 0xC3, 0x2A, 0x17, 0xD2, 0x0D, 0xA2, 0x68, 0x71,
-    0xB2, 0x1C, 0x49, 0xEB, 0x07, 0x61, 0x1D, 0x25, 0xFC, 0x61, 0xDE, 0x52, 0x2D, 0x38, 0x3C, 0x0F,
-    0x56, 0xE8, 0x41, 0xCA, 0xDA, 0x9A, 0x7D, 0x41, 0x6B, 0xF2, 0x8D, 0xDA, 0xB4, 0x4F, 0x1F, 0xBF,
-    0xDC, 0xFE, 0xD5, 0x57, 0x27, 0x4D, 0xB2, 0x5E, 0xEB, 0xD8, 0x18, 0xD9, 0x21, 0x2F, 0xFD, 0xD7,
-    0xE1, 0xAF, 0x40, 0x2B, 0xA6, 0x70, 0xF6, 0xF6, 0x5B, 0xEE, 0xAE, 0xCB, 0x93, 0xFB, 0x15, 0x28,
-    0xF4, 0xD5, 0x93, 0x18, 0x4E, 0x78, 0xE5, 0xB7, 0x2F, 0x99, 0x27, 0x4D, 0x57, 0x57, 0x81, 0x8F,
-    0x7C, 0xB1, 0xB3, 0x2B, 0xCD, 0x97, 0xE3, 0xCA, 0xFD, 0x20, 0x53, 0x1C, 0x25, 0xDA, 0x9D, 0x23,
-    0xEB, 0xD1, 0xB5, 0xBA, 0x2F, 0xF0, 0xF0, 0xCA, 0xFC, 0xED, 0x4A, 0xEE, 0xB9, 0x9F, 0xCE, 0x76,
-    0xAD, 0x71, 0x1D, 0x8F, 0xD6, 0xB1, 0xC7, 0x73, 0x9B, 0xEF, 0xD9, 0x2C, 0xD7, 0x41, 0x46, 0x06,
-    0x3B, 0xAC, 0xF8, 0x46, 0xE5, 0xA7, 0xED, 0x8F, 0xE5, 0x88, 0xE3, 0xDD, 0x18, 0x2F, 0x0C, 0x30,
-    0x8E, 0x8F, 0x18, 0xD3, 0x5A, 0x54, 0x01, 0x4E, 0x6A, 0xE8, 0xF0, 0x55, 0x6A, 0xBC, 0x40, 0xB3,
-    0xD0, 0x2B, 0x0F, 0x14, 0x14, 0x3D, 0x3D, 0xE5, 0x3D, 0xAF, 0x3A, 0x80, 0xF5, 0x9E, 0x8B, 0x0D,
-    0x01, 0x95, 0xB6, 0x0B, 0x2C, 0xD6, 0xAA, 0xAD, 0xE7, 0x76, 0xE3, 0x0A, 0x2A, 0x8E, 0x82, 0xC3,
-    0x8A, 0x2B, 0xD1, 0xF1, 0x56, 0x43, 0x65, 0xB7, 0xA3, 0xA1, 0x2A, 0xA8, 0x18, 0xE6, 0x0E, 0xA5,
-    0x86, 0x36, 0xD3, 0x9B, 0x2C, 0x64, 0x47, 0xAC, 0x97, 0x59, 0x78, 0x13, 0x3B, 0x42, 0x18, 0x60,
-    0xC7, 0x8A, 0x35, 0x84, 0x35, 0xBA, 0x4F, 0xBF, 0x97, 0x98, 0xDA, 0x94, 0x47, 0x8F, 0x81, 0x35,
-    0x65, 0xBA, 0x9D, 0x9B, 0x72, 0x9D, 0xC4, 0x8C, 0xEA, 0xF1, 0xCA, 0xBD, 0x2E, 0x1F, 0x1E, 0xD8,
-    0x8D, 0xCA, 0x0A, 0xDE, 0x78, 0x9D, 0x0B, 0x83, 0x3B, 0x3F, 0x55, 0xAC, 0xF4, 0xEF, 0xBB, 0xDD,
-    0x15, 0x2F, 0x26, 0xB5, 0xBB, 0x86, 0xED, 0xD1, 0xED, 0xCE, 0xA2, 0xA9, 0x31, 0xED, 0x2A, 0x76,
-    0xC8, 0x68, 0x58, 0x5B, 0x36, 0x8F, 0x09, 0xC3, 0x27, 0x1B, 0xDE, 0xC4, 0x2E, 0xD7, 0x22, 0x6D,
-    0x0C, 0xD7, 0x62, 0x9E, 0x45, 0x87, 0x37, 0x13, 0x76, 0xBF, 0xFE, 0xFD, 0xA4, 0x60, 0x46, 0xFD,
-    0xF6, 0xCA, 0xEE, 0x20, 0xE6, 0xA3, 0x76, 0x91, 0xAD, 0x21, 0xF6, 0x93, 0xBC, 0x07, 0x80, 0x55,
-    0x08, 0x5F, 0x46, 0x9C, 0xDD, 0x22, 0x5F, 0xFD, 0x58, 0xE4, 0x51, 0x65, 0xF3, 0x58, 0x63, 0x47,
-    0x29, 0xCF, 0x2A, 0x43, 0x32, 0xCD, 0x0C, 0xAB, 0x3B, 0x34, 0xF6, 0x84, 0xDB, 0xC4, 0x7A, 0xBB,
-    0x9E, 0xDC, 0xEA, 0x68, 0xFD, 0x99, 0x1E, 0xAA, 0x6C, 0x40, 0x3B, 0x6F, 0xF0, 0xA9, 0xE5, 0xD3,
-    0x18, 0xEB, 0x6D, 0x14, 0x4B, 0x01, 0x1B, 0x02, 0x68, 0x4F, 0xAF, 0x71, 0x3A, 0x24, 0x16, 0x8F,
-    0x66, 0x8D, 0xE6, 0xE8, 0x63, 0xEA, 0x54, 0x96, 0xB5, 0xBA, 0x50, 0xFE, 0xAC, 0xB7, 0xCA, 0x45,
-    0xC9, 0x79, 0x83, 0x7A, 0x1B, 0x8D, 0x94, 0x22, 0xB2, 0x25, 0xEF, 0x22, 0x11, 0x4D, 0x08, 0x3C,
-    0xF6, 0xB7, 0xFA, 0x76, 0xB9, 0x52, 0x9C, 0x8F, 0xA3, 0xAC, 0x9E, 0xE3, 0x35, 0xB7, 0xA3, 0xC3,
-    0x9B, 0x1A, 0xA1, 0xF7, 0x40, 0xFF, 0x0F, 0x63, 0x0D, 0x0D, 0xD1, 0xFF, 0xFF, 0xC7, 0x1E, 0x84,
-    0x7E, 0xD8, 0xFF, 0xFF, 0x22, 0x1A, 0x1A, 0x00, 0x00, 0xED, 0x56, 0x21, 0x76, 0xDB, 0x40, 0x10,
-    0x1D, 0x45, 0xAF, 0xF1, 0x7B, 0x35, 0x30, 0x29, 0x0A, 0x51, 0x71, 0x88, 0x8F, 0x20, 0x1D, 0xC1,
-    0x20, 0xEE, 0x21, 0x72, 0x09, 0xB9, 0x37, 0x28, 0x29, 0x2F, 0x28, 0x68, 0x42, 0x42, 0xCA, 0x57,
-    0x47, 0x30, 0x29, 0x17, 0x68, 0x49, 0x4B, 0x04, 0x04, 0x9C, 0x17, 0xC9, 0xD3, 0xF9, 0x33, 0xB3,
-    0x2B, 0xB9, 0x69, 0x52, 0x12, 0x58, 0x81, 0xEC, 0x7F, 0xD9, 0x91, 0xF6, 0xCF, 0x9F, 0xF9, 0xB3,
-    0x26, 0x22, 0xBA, 0xFE, 0x40, 0x17, 0x9F, 0x65, 0x5D, 0xF2, 0x90, 0xF3, 0x51, 0x40, 0xC9, 0x87,
-    0x15, 0x8F, 0x02, 0x02, 0xF7, 0x25, 0x0F, 0x02, 0x98, 0xBB, 0x9A, 0x0F, 0x44, 0x19, 0xB7, 0x14,
-    0x7A, 0xF9, 0xC7, 0x19, 0x37, 0x24, 0x98, 0x28, 0xE7, 0x1D, 0xF1, 0x5E, 0xC0, 0x82, 0x3F, 0xBE,
-    0xE3, 0x1F, 0x15, 0x51, 0xCD, 0x78, 0x1A, 0x09, 0xD1, 0x67, 0x27, 0x21, 0x0E, 0xCE, 0xEE, 0xF8,
-    0xF6, 0x8E, 0x7F, 0x4A, 0xF0, 0x6A, 0x94, 0x78, 0x59, 0xA9, 0x18, 0xE4, 0x58, 0x80, 0xF5, 0x40,
-    0x2B, 0x9C, 0x4D, 0xE5, 0x01, 0xBB, 0x00, 0x3D, 0x76, 0xE7, 0xA0, 0xEE, 0x10, 0x06, 0x5E, 0x1D,
-    0xC2, 0xC0, 0xAB, 0xC5, 0x2E, 0xC0, 0x1E, 0xBB, 0x20, 0xD8, 0x60, 0x77, 0x46, 0xF0, 0x31, 0xD3,
-    0x9C, 0x2B, 0x84, 0x81, 0xB2, 0xEE, 0x22, 0x73, 0xDD, 0x25, 0x50, 0x90, 0xDD, 0x39, 0x41, 0xF0,
-    0x02, 0xB8, 0xE4, 0xE1, 0x75, 0x30, 0x71, 0xFA, 0x42, 0x35, 0x29, 0xB9, 0x2D, 0xB8, 0x57, 0xB0,
-    0x2B, 0xF4, 0x84, 0xF5, 0x3D, 0x2D, 0x35, 0x07, 0x10, 0xB9, 0xAD, 0xCE, 0xF1, 0xA1, 0xB5, 0x28,
-    0xD7, 0xAA, 0x94, 0x2D, 0x77, 0xE0, 0xC7, 0x7B, 0xAC, 0x39, 0x3F, 0x34, 0x78, 0x67, 0x21, 0xC7,
-    0xD6, 0x3B, 0x72, 0x11, 0xC8, 0xCE, 0x82, 0x2E, 0x7C, 0x95, 0x6D, 0x2B, 0x84, 0x8F, 0x20, 0xB4,
-    0x64, 0x1E, 0xC0, 0x67, 0x25, 0x2B, 0x42, 0x85, 0xCA, 0x17, 0x0D, 0x95, 0xEC, 0x55, 0x36, 0x49,
-    0xBE, 0x18, 0x4D, 0x19, 0x95, 0x88, 0xE3, 0xDA, 0x9A, 0x52, 0x92, 0x78, 0x79, 0x30, 0x79, 0xEA,
-    0xDE, 0x44, 0x09, 0x9D, 0x6B, 0x12, 0x57, 0xA5, 0x53, 0xA9, 0x46, 0x72, 0x96, 0x4A, 0xB4, 0x74,
-    0x85, 0x54, 0x97, 0x46, 0x65, 0x51, 0xA1, 0x8A, 0xD1, 0x74, 0xB2, 0x72, 0x08, 0x8D, 0xB8, 0x1E,
-    0x6C, 0xD5, 0x1E, 0x21, 0xFA, 0x85, 0x6F, 0x6B, 0xFB, 0xB4, 0xBE, 0x36, 0xBE, 0x7A, 0xD8, 0x77,
-    0xA2, 0x49, 0xAF, 0xCB, 0x4F, 0xA6, 0x97, 0xD6, 0x4F, 0xF4, 0x0A, 0x51, 0xAF, 0xD6, 0xF5, 0x52,
-    0x62, 0xBB, 0x53, 0x62, 0x6C, 0xC4, 0x44, 0x2F, 0x10, 0x7B, 0x56, 0xAF, 0xE3, 0xDF, 0xF5, 0x2A,
-    0x9E, 0xD2, 0xAB, 0x7F, 0x51, 0xBD, 0x16, 0x2F, 0xAB, 0x97, 0xB9, 0x36, 0xDB, 0x24, 0xDF, 0xAE,
-    0x86, 0xE4, 0xDC, 0xF5, 0xE4, 0xDD, 0xF5, 0xE4, 0x5E, 0x40, 0xF7, 0xEF, 0xB2, 0x9D, 0xF9, 0x62,
-    0xE6, 0x8C, 0xE4, 0xE2, 0xED, 0x26, 0xF9, 0x58, 0x62, 0xA2, 0x93, 0x25, 0x26, 0x9F, 0xA0, 0xBB,
-    0x39, 0xF3, 0x3C, 0xA3, 0x99, 0xCC, 0xD1, 0x9A, 0xB5, 0x79, 0x5A, 0x1B, 0xC5, 0x5C, 0xBD, 0xE0,
-    0x64, 0xE7, 0xE5, 0x1F, 0xD0, 0xBC, 0xAD, 0xB5, 0x31, 0x77, 0xEB, 0x10, 0x30, 0x7F, 0x5B, 0x85,
-    0xF6, 0xD1, 0xFF, 0xEE, 0x71, 0x68, 0xE7, 0x49, 0xCC, 0x61, 0x9F, 0xF2, 0xA9, 0xBB, 0xE4, 0x75,
-    0xD4, 0xCE, 0x09, 0x22, 0xE7, 0xE4, 0xF7, 0x99, 0xE3, 0x67, 0x9E, 0x9F, 0x5C, 0x3F, 0xF3, 0xFD,
-    0xCC, 0xF9, 0x33, 0xEF, 0xCF, 0xDC, 0x7F, 0xEA, 0xFF, 0x58, 0xA1, 0xF3, 0x9B, 0xA9, 0x42, 0x63,
-    0xAA, 0x90, 0x66, 0xF4, 0xA8, 0x42, 0xE5, 0x34, 0x61, 0x9F, 0xCE, 0xC8, 0x2B, 0x84, 0x8C, 0x9E,
-    0xAB, 0xD0, 0xFB, 0xFF, 0x15, 0xFA, 0x77, 0x85, 0x2E, 0x6E, 0x2A, 0xEF, 0x7A, 0xBD, 0xEE, 0x30,
-    0x7D, 0xD8, 0x8C, 0x10, 0x04, 0xD8, 0x7D, 0xC2, 0x41, 0x41, 0xCE, 0x6D, 0xE6, 0xD7, 0x48, 0x13,
-    0x2F, 0x3C, 0xBF, 0x46, 0xD4, 0xF4, 0xDF, 0x36, 0xCA, 0xB4, 0xD0, 0xD7, 0x04, 0xB0, 0x7A, 0x58,
-    0x08, 0x1B, 0x10, 0x81, 0xA4, 0x18, 0xA6, 0xB8, 0xCD, 0x7A, 0x08, 0x78, 0xF4, 0xEB, 0xCD, 0x2E,
-    0xBC, 0x38, 0x93, 0xD2, 0x50, 0x4A, 0xD3, 0x3C, 0x8D, 0xA5, 0x38, 0x97, 0x6C, 0x30, 0xC5, 0x7B,
-    0x2E, 0x74, 0x6E, 0xE2, 0x04, 0xB8, 0x7F, 0xA3, 0xCA, 0xA2, 0xC7, 0x54, 0x57, 0x03, 0x38, 0xB9,
-    0x04, 0xC0, 0xC9, 0x2B, 0x65, 0x8A, 0x03, 0xAF, 0xEC, 0x22, 0x4E, 0xC2, 0xDA, 0x53, 0xFB, 0x6C,
-    0xBA, 0x76, 0x19, 0x29, 0xF8, 0x74, 0x12, 0xB0, 0x8F, 0xA0, 0x3A, 0x8D, 0x75, 0x55, 0x29, 0xAA,
-    0x7A, 0xEF, 0x05, 0x60, 0xAB, 0x25, 0x9B, 0x18, 0xA6, 0xAA, 0x8B, 0x99, 0xF9, 0x9D, 0x6C, 0x03,
-    0x94, 0xF2, 0xA3, 0x35, 0xE9, 0x59, 0x40, 0x07, 0x88, 0xAA, 0x52, 0x92, 0x6A, 0x8D, 0xD7, 0xB4,
-    0xBF, 0xA5, 0x3C, 0xE8, 0xF5, 0x0C, 0x7D, 0x2F, 0xDB, 0x21, 0x83, 0xAA, 0x52, 0x89, 0x57, 0x9A,
-    0x92, 0xCE, 0x58, 0xA4, 0xB4, 0xF0, 0x3E, 0x97, 0x4F, 0x1C, 0x2C, 0x25, 0x79, 0xAB, 0x32, 0x0D,
-    0x43, 0x14, 0x13, 0xFD, 0x51, 0xDA, 0x8F, 0x99, 0xC1, 0xC4, 0xA4, 0x7A, 0x30, 0x0D, 0xF1, 0x8A,
-    0xB5, 0x4C, 0x61, 0xE0, 0x2B, 0x46, 0x36, 0x77, 0x6F, 0x29, 0x3C, 0xC8, 0x5B, 0x28, 0x72, 0xC0,
-    0x1F, 0x07, 0x52, 0x0B, 0x5C, 0x20, 0x68, 0x22, 0xED, 0xB4, 0x2D, 0x99, 0xAA, 0xBF, 0x01, 0x4D,
-    0x8F, 0xBD, 0x0D, 0xC2, 0x30, 0x14, 0x84, 0x2F, 0x76, 0x91, 0x82, 0x82, 0x11, 0xCC, 0x06, 0x1E,
-    0x01, 0x31, 0x07, 0x8B, 0xD0, 0x25, 0xE3, 0x20, 0xB1, 0x02, 0x22, 0xD9, 0x84, 0xF4, 0x34, 0x94,
-    0x2E, 0x12, 0x1F, 0xF7, 0x6C, 0x47, 0xC2, 0xF2, 0xCF, 0xE7, 0xA7, 0xEF, 0x9D, 0x6C, 0xE0, 0x6F,
-    0xDC, 0xDA, 0xD9, 0xE5, 0x06, 0x3D, 0xC7, 0x0A, 0x81, 0x4B, 0x85, 0x81, 0xA9, 0x2A, 0x64, 0x6E,
-    0xCA, 0xA7, 0x4A, 0x61, 0x41, 0x2C, 0xD2, 0x00, 0xF8, 0x54, 0x94, 0x96, 0xD4, 0xF3, 0x72, 0x87,
-    0x49, 0x81, 0xEF, 0x0C, 0x4B, 0x1A, 0x48, 0x42, 0x49, 0x4A, 0x51, 0x8C, 0x66, 0x2F, 0x58, 0x75,
-    0x1B, 0x83, 0x60, 0xF1, 0x5A, 0x67, 0xC1, 0x78, 0x24, 0x53, 0x34, 0x57, 0x0D, 0xDF, 0x03, 0xB9,
-    0x59, 0xC3, 0xEC, 0xE4, 0x7A, 0xAB, 0x62, 0x2A, 0xB0, 0x02, 0x91, 0xF9, 0x21, 0x05, 0x90, 0x64,
-    0x0A, 0xE0, 0x0A, 0xD8, 0x7B, 0xA6, 0xCD, 0x9B, 0x22, 0x29, 0x75, 0xA6, 0x48, 0x12, 0xCC, 0x06,
-    0x6E, 0x75, 0xAC, 0xFF, 0x7A, 0x5D, 0xD7, 0x0A, 0xB1, 0x2A, 0x96, 0x34, 0x57, 0xD8, 0x15, 0xE0,
-    0xB9, 0xC3, 0xC9, 0xB6, 0x1F,
+static const uint8_t notosans_18_bolditalicBitmaps[52938] = {
+    0xED, 0x5A, 0xBF, 0x93, 0xE4, 0xC6, 0x75, 0x6E, 0xCC, 0xF8, 0x0E, 0x55, 0x42, 0x80, 0xC4, 0x5B,
+    0x2E, 0x8B, 0xE5, 0x42, 0xA2, 0x88, 0x0E, 0xF0, 0x27, 0x34, 0x68, 0x07, 0x0A, 0xBD, 0xAE, 0xDA,
+    0x91, 0x03, 0x06, 0x74, 0xA0, 0x40, 0x25, 0x55, 0x69, 0x13, 0xE7, 0x18, 0xDA, 0x81, 0xD3, 0x0B,
+    0x4C, 0xA7, 0x66, 0xA0, 0xC0, 0x5A, 0x05, 0x9B, 0x2A, 0x22, 0x86, 0xE5, 0x40, 0x81, 0x02, 0xC1,
+    0x66, 0xC9, 0x0A, 0x14, 0x10, 0x26, 0xEF, 0x4C, 0x9B, 0x17, 0x2C, 0xAC, 0x02, 0x45, 0xDC, 0x1D,
+    0x80, 0xF6, 0xFB, 0xBE, 0xF7, 0x80, 0xC1, 0xEC, 0xDE, 0xDE, 0x51, 0x2A, 0xC9, 0x91, 0xB7, 0x76,
+    0x1E, 0x30, 0x33, 0x98, 0xEE, 0xD7, 0xEF, 0xC7, 0xF7, 0x7E, 0x74, 0xBB, 0x6C, 0x72, 0xF9, 0xE4,
+    0xFC, 0xE8, 0xFC, 0x80, 0xFF, 0xB2, 0x77, 0x65, 0xE7, 0xAA, 0xD6, 0x05, 0xF9, 0x6F, 0x5C, 0xA8,
+    0xA3, 0x70, 0xD8, 0x84, 0xFD, 0x26, 0x14, 0xDB, 0xE0, 0xF0, 0x3F, 0xB9, 0x78, 0x74, 0xD1, 0x85,
+    0xD3, 0xBF, 0xB8, 0x71, 0x5E, 0x7E, 0x31, 0xB8, 0x4A, 0xFE, 0x7B, 0xE7, 0x5B, 0xF7, 0xA0, 0x90,
+    0x8F, 0xF3, 0xC6, 0xB9, 0xAA, 0x76, 0x51, 0x28, 0x5C, 0x3C, 0x39, 0x97, 0x0E, 0xF2, 0x51, 0xE7,
+    0x5C, 0x29, 0x1F, 0x87, 0x83, 0x93, 0xF1, 0x30, 0xD4, 0xF2, 0xD5, 0xFC, 0xB5, 0xFC, 0x5A, 0x5F,
+    0x8D, 0x3E, 0x5A, 0xD6, 0x1C, 0x45, 0x5F, 0x07, 0x7B, 0xD9, 0x7B, 0x7C, 0x87, 0xE7, 0xF0, 0x7C,
+    0x2E, 0xAF, 0x4C, 0x5E, 0x69, 0xEF, 0x5C, 0x22, 0x63, 0x6D, 0x07, 0xE3, 0x2E, 0x92, 0x49, 0x9C,
+    0x4C, 0xC6, 0x5F, 0xAE, 0x7F, 0x31, 0xFF, 0x0A, 0xB3, 0xE2, 0x95, 0xD9, 0x6B, 0x7E, 0x9F, 0xB7,
+    0x2B, 0x6E, 0x5A, 0xE5, 0x06, 0xB3, 0x0A, 0xF3, 0x11, 0x99, 0x2F, 0xB8, 0x80, 0x64, 0x54, 0xE6,
+    0xE7, 0x47, 0xE4, 0xEB, 0xF9, 0xE3, 0xAC, 0xD7, 0xD9, 0xDC, 0xAE, 0xD8, 0x84, 0xC3, 0x36, 0xEC,
+    0xE3, 0xE0, 0x92, 0x09, 0x4F, 0xCB, 0x3C, 0xF2, 0xBC, 0x3F, 0xB8, 0x6A, 0xEF, 0x1E, 0xEC, 0x2E,
+    0xF2, 0x30, 0x78, 0xFC, 0xF7, 0x3E, 0x74, 0x67, 0xBB, 0xF3, 0xB8, 0xF1, 0x7D, 0x39, 0x54, 0x43,
+    0xD5, 0x97, 0x2D, 0x45, 0x89, 0xBF, 0x7C, 0x2A, 0x44, 0x68, 0xA2, 0x8E, 0x34, 0x04, 0xF9, 0x75,
+    0x08, 0x22, 0xEC, 0xA9, 0x1C, 0x45, 0x47, 0xE9, 0xB4, 0x09, 0x75, 0x1A, 0x64, 0xFC, 0x24, 0x24,
+    0xA1, 0x48, 0x42, 0x2A, 0xD3, 0x84, 0x74, 0x12, 0x92, 0x8D, 0xF2, 0x78, 0x3E, 0xB8, 0x74, 0xF2,
+    0x24, 0xBD, 0xCB, 0x46, 0x21, 0xF9, 0xE0, 0x65, 0x08, 0x92, 0x5E, 0x48, 0xD9, 0x09, 0x09, 0xAD,
+    0xEF, 0xA3, 0xD0, 0xF8, 0x61, 0x1B, 0x0E, 0xF9, 0x94, 0x85, 0x7D, 0x16, 0x42, 0xC0, 0x64, 0x83,
+    0xAC, 0x47, 0x0C, 0xC1, 0x55, 0xB2, 0x60, 0x17, 0x9D, 0x53, 0xE3, 0xB2, 0x38, 0xB1, 0x96, 0x8D,
+    0x7C, 0x97, 0x81, 0x8F, 0xD0, 0x27, 0xC2, 0x94, 0xF0, 0xD4, 0xE5, 0x53, 0xD9, 0xA6, 0x5D, 0xD5,
+    0x26, 0xFB, 0xD0, 0x44, 0x62, 0x39, 0x22, 0xAA, 0x03, 0x5F, 0x1B, 0xCA, 0x45, 0xC5, 0x16, 0x43,
+    0x3E, 0xF2, 0x4A, 0x27, 0x7B, 0x41, 0x56, 0xD0, 0x3F, 0xC4, 0x08, 0x99, 0xC1, 0x4C, 0xE4, 0x25,
+    0x16, 0x38, 0xFF, 0x65, 0x32, 0x14, 0x96, 0x3F, 0xE0, 0x56, 0xF8, 0x72, 0xA5, 0xD0, 0xC2, 0xF9,
+    0xE9, 0x5A, 0xC6, 0xCD, 0x1A, 0xE1, 0xD9, 0x25, 0x9C, 0xC3, 0x9D, 0x50, 0xCC, 0xA8, 0x73, 0xC9,
+    0xEF, 0x26, 0xD0, 0x72, 0xA0, 0x4D, 0x60, 0xE4, 0x98, 0x8F, 0xE4, 0xFC, 0xB2, 0x1A, 0xF8, 0x1B,
+    0x7C, 0x9C, 0xF2, 0x37, 0xB2, 0x3C, 0x3C, 0xD7, 0x2D, 0xCF, 0x61, 0x5A, 0xCA, 0x5D, 0x28, 0x26,
+    0x6F, 0x65, 0xD9, 0xA0, 0x81, 0xD4, 0x6C, 0x0D, 0x32, 0xCA, 0xEC, 0x53, 0xC8, 0x25, 0x88, 0x4B,
+    0x3D, 0xA9, 0x82, 0xFB, 0x13, 0x19, 0x75, 0x66, 0x84, 0x04, 0xCB, 0xE6, 0x7A, 0x31, 0xC5, 0xC3,
+    0x20, 0xAB, 0x4B, 0x03, 0x24, 0x81, 0x09, 0x53, 0xAC, 0xEC, 0xC1, 0xDB, 0x58, 0xB1, 0xE3, 0xD0,
+    0x25, 0x08, 0x84, 0xA2, 0xA4, 0x6A, 0xF7, 0x58, 0xC1, 0x54, 0x88, 0x50, 0x30, 0xFB, 0x01, 0x04,
+    0x33, 0x8A, 0x62, 0x03, 0x98, 0x3F, 0x53, 0x9B, 0x51, 0x11, 0x24, 0xC6, 0x3D, 0x16, 0x55, 0x42,
+    0x85, 0x0E, 0xE2, 0x83, 0x4E, 0xB9, 0x56, 0xD0, 0xFC, 0x05, 0xB8, 0x29, 0x9F, 0x8E, 0x60, 0xE7,
+    0x67, 0x70, 0x9E, 0x90, 0xD1, 0x25, 0x41, 0x7D, 0x97, 0x8B, 0x4A, 0xAA, 0x46, 0xA6, 0x16, 0xB3,
+    0x17, 0xAB, 0x15, 0xED, 0x09, 0x43, 0x62, 0xC4, 0x55, 0x83, 0xF9, 0x64, 0x46, 0x08, 0x25, 0x14,
+    0xA4, 0x14, 0x4D, 0x70, 0x67, 0xBB, 0xBF, 0x0A, 0x3F, 0xE7, 0x2C, 0x05, 0x29, 0x8D, 0x86, 0x54,
+    0x75, 0xC1, 0xE5, 0xC7, 0x54, 0x61, 0x42, 0x9A, 0x52, 0xA9, 0x4A, 0x45, 0x80, 0x93, 0x2D, 0x95,
+    0x5E, 0x65, 0x02, 0xC0, 0x7C, 0x8E, 0xFE, 0x05, 0x7A, 0xF3, 0x18, 0xCC, 0xE2, 0xF1, 0x2D, 0x44,
+    0x40, 0x2A, 0xDF, 0x3F, 0xFF, 0x9E, 0x2A, 0x83, 0x8A, 0xA3, 0x11, 0xA9, 0x49, 0xCD, 0xE3, 0xE9,
+    0x27, 0xF2, 0xCC, 0x23, 0xF9, 0x45, 0xE3, 0x3E, 0xF8, 0xCB, 0x4B, 0xF9, 0x2D, 0x14, 0xB9, 0x07,
+    0x9D, 0x60, 0xE5, 0xF8, 0xE9, 0x1B, 0x94, 0xE3, 0x2C, 0x48, 0xFE, 0x3D, 0xC4, 0xB7, 0xA5, 0x90,
+    0x2D, 0xB4, 0x4A, 0xBF, 0xF0, 0xE1, 0xC9, 0x77, 0x80, 0x78, 0xC2, 0x48, 0x63, 0xB6, 0xC6, 0x45,
+    0xA6, 0xA3, 0xB8, 0x49, 0x36, 0x88, 0x73, 0xE6, 0xCF, 0x4D, 0x3C, 0x35, 0x48, 0x53, 0x86, 0xB7,
+    0x42, 0x0B, 0xA0, 0x6C, 0x2B, 0x31, 0xA2, 0x56, 0xEC, 0x9B, 0xA4, 0x02, 0x91, 0x6F, 0x85, 0xD4,
+    0x65, 0x27, 0xB6, 0xEC, 0x47, 0xD1, 0x57, 0x7E, 0xC7, 0xFF, 0xF6, 0xEA, 0x7F, 0x58, 0x76, 0xA8,
+    0x37, 0x47, 0x7A, 0xD8, 0x1E, 0x69, 0x41, 0xAD, 0x12, 0x30, 0x46, 0x2E, 0xB8, 0x77, 0xB3, 0x19,
+    0x6D, 0x68, 0x51, 0x5B, 0xB3, 0x8A, 0x62, 0x71, 0x09, 0x4F, 0xA8, 0xAC, 0x8E, 0x0F, 0x6E, 0xF9,
+    0x60, 0x4C, 0x11, 0xD8, 0x58, 0x47, 0xDF, 0x51, 0xD1, 0x46, 0xF6, 0xA0, 0x8E, 0xB5, 0xA7, 0x85,
+    0xB9, 0xD9, 0x6D, 0x96, 0x3F, 0xDA, 0x5B, 0x4C, 0xEE, 0x33, 0xFA, 0xAE, 0x57, 0x19, 0x77, 0x78,
+    0x38, 0xD4, 0x10, 0x56, 0x38, 0xAC, 0x68, 0x0D, 0xBB, 0x08, 0x2D, 0x71, 0x60, 0xC4, 0x3C, 0x19,
+    0x3C, 0x43, 0x26, 0xA0, 0xB7, 0x84, 0x41, 0xD7, 0x0E, 0x9B, 0xF9, 0x05, 0xDC, 0x7E, 0x82, 0xDC,
+    0x45, 0xBB, 0x22, 0x3D, 0xA0, 0x29, 0x44, 0x0A, 0x5A, 0xE9, 0xBD, 0xBE, 0x1D, 0xC0, 0x29, 0x35,
+    0x40, 0x0F, 0xDE, 0x83, 0x1D, 0xF0, 0x58, 0x41, 0x65, 0xC7, 0x18, 0x06, 0x36, 0x3B, 0xF2, 0xC7,
+    0x29, 0x28, 0xCB, 0x3A, 0x09, 0xFF, 0x0E, 0x74, 0x95, 0x01, 0x85, 0x23, 0xDF, 0xC9, 0x4C, 0x1E,
+    0x48, 0x69, 0x44, 0x46, 0xAF, 0x08, 0x9C, 0x1D, 0x30, 0xB3, 0xC5, 0x1C, 0x2D, 0xA6, 0x68, 0xC5,
+    0x93, 0xAB, 0x66, 0x13, 0x7A, 0x99, 0xF2, 0xEB, 0x6F, 0x41, 0x42, 0x2B, 0xCB, 0x98, 0x54, 0x8C,
+    0xFF, 0xF0, 0x47, 0x32, 0x1B, 0x2D, 0x96, 0x3C, 0x91, 0x25, 0x2E, 0xF5, 0x01, 0xF1, 0xF5, 0x8D,
+    0xBD, 0x46, 0xDF, 0x88, 0xFF, 0x30, 0xF9, 0x33, 0x77, 0xDF, 0xDF, 0xAD, 0xE8, 0x5B, 0x5A, 0xF4,
+    0xFD, 0xBE, 0x33, 0xC8, 0x3D, 0x10, 0xBF, 0x62, 0x0B, 0x4B, 0xEE, 0xC2, 0x7D, 0xA5, 0xBF, 0xB3,
+    0x73, 0xB5, 0x05, 0xE1, 0x49, 0x87, 0xD1, 0x20, 0x8E, 0xC8, 0x8A, 0x08, 0x8B, 0x48, 0x9B, 0xD7,
+    0xF3, 0xC3, 0x97, 0xE1, 0x11, 0xC4, 0x4A, 0xF8, 0x19, 0xD5, 0x89, 0xD3, 0x67, 0xEF, 0x84, 0x22,
+    0x2E, 0xE8, 0xFF, 0x47, 0x42, 0x63, 0xF2, 0x84, 0x19, 0x84, 0x69, 0xA8, 0x20, 0xC7, 0xE7, 0x44,
+    0x5F, 0xBC, 0x43, 0x56, 0xA0, 0x7C, 0x6E, 0xA7, 0xBB, 0x4C, 0x6D, 0xDE, 0x77, 0x1A, 0x28, 0xD4,
+    0xCC, 0x94, 0xE0, 0x2D, 0xC2, 0xB5, 0x9B, 0x23, 0x65, 0x4C, 0xEB, 0x95, 0xB9, 0x1A, 0x0D, 0x1C,
+    0xC4, 0x03, 0xAF, 0x97, 0xD2, 0xD0, 0xE1, 0x46, 0xFD, 0xE1, 0x9F, 0xD4, 0x88, 0x11, 0xF5, 0x25,
+    0x30, 0xF3, 0x22, 0xA0, 0x07, 0x47, 0xC8, 0x7B, 0x2C, 0x53, 0xCC, 0x8A, 0x97, 0xAA, 0x49, 0xC9,
+    0xE1, 0x01, 0x17, 0xE1, 0x31, 0x25, 0x46, 0x16, 0xB8, 0x24, 0x61, 0x09, 0x4A, 0x23, 0xED, 0x07,
+    0x17, 0x80, 0x20, 0x2C, 0xF9, 0xF9, 0xD5, 0xF5, 0x24, 0x6B, 0xAD, 0x11, 0xF5, 0x55, 0x13, 0xF2,
+    0xCF, 0xF8, 0x07, 0x49, 0xC8, 0x45, 0xE2, 0x33, 0x96, 0xEB, 0x07, 0x5D, 0x75, 0x1C, 0xA6, 0x1F,
+    0xB8, 0x15, 0x22, 0x32, 0xD8, 0x8B, 0xA5, 0x64, 0x04, 0xF7, 0x8C, 0x3A, 0xCE, 0x99, 0xA2, 0xC1,
+    0x16, 0x61, 0x93, 0xD4, 0x3D, 0x4D, 0xBE, 0x6A, 0x1F, 0xAA, 0x39, 0xD1, 0x9E, 0x20, 0x5F, 0x0E,
+    0x10, 0x91, 0xA3, 0x4D, 0xF8, 0xF9, 0x25, 0xB2, 0xB7, 0x03, 0xFF, 0xF7, 0xCC, 0x46, 0x90, 0x93,
+    0xC4, 0xC8, 0xE7, 0x0E, 0x09, 0xA9, 0xD8, 0xA6, 0xA0, 0x4E, 0x1A, 0xAE, 0x44, 0x7D, 0xBA, 0x9C,
+    0x7C, 0x8E, 0x29, 0xB2, 0x02, 0x59, 0xD9, 0x7F, 0x1D, 0x35, 0xF1, 0x46, 0x78, 0xE6, 0x6C, 0x82,
+    0x84, 0xF1, 0x2F, 0xE7, 0x7D, 0x15, 0x3E, 0x0F, 0x87, 0x48, 0x7E, 0x19, 0xEF, 0xB7, 0x14, 0xBF,
+    0x06, 0x9F, 0x74, 0x15, 0x7F, 0x15, 0x6C, 0x94, 0x2A, 0x36, 0x29, 0x24, 0x6B, 0xAC, 0x57, 0x1A,
+    0x56, 0xD4, 0x3E, 0xEF, 0x8E, 0xF8, 0xE3, 0x65, 0x9C, 0x73, 0x99, 0xF0, 0xC9, 0x65, 0x4D, 0xF1,
+    0xD4, 0x0C, 0x24, 0x35, 0x57, 0x5A, 0xC3, 0xA0, 0x26, 0x18, 0xC2, 0x4E, 0x4D, 0x61, 0x7A, 0x44,
+    0x2E, 0x08, 0x20, 0x29, 0x03, 0x05, 0x2F, 0x0A, 0x48, 0x54, 0xDC, 0x00, 0x7E, 0x29, 0xD5, 0x89,
+    0x7C, 0x81, 0x59, 0x11, 0x2A, 0x2E, 0xC2, 0x19, 0xC2, 0x95, 0xB0, 0x80, 0x4B, 0xB0, 0x4B, 0x33,
+    0x5F, 0xD2, 0x40, 0xDD, 0xCA, 0x05, 0x2E, 0x92, 0xAA, 0x8A, 0x05, 0x75, 0xE1, 0xEE, 0x7E, 0xA0,
+    0xC5, 0x8B, 0x43, 0xC6, 0x81, 0x31, 0x3E, 0x81, 0xEA, 0xF9, 0x1B, 0x44, 0x9C, 0x34, 0x5C, 0x5B,
+    0xA4, 0x03, 0x0F, 0x2A, 0x3C, 0x5E, 0x0A, 0xDA, 0xD0, 0x23, 0x67, 0xE1, 0xB1, 0xA6, 0x78, 0x6B,
+    0x63, 0x5D, 0xA9, 0xC2, 0x18, 0xDD, 0x80, 0x19, 0xC4, 0x22, 0xD3, 0xB5, 0x34, 0x35, 0xCC, 0xCD,
+    0x66, 0xD0, 0x91, 0xB6, 0x14, 0x51, 0x0B, 0x63, 0xD8, 0x9D, 0x1B, 0x76, 0x6B, 0x82, 0xA4, 0x61,
+    0xFA, 0x24, 0x40, 0x1B, 0xE5, 0x54, 0xA4, 0xCA, 0x9D, 0x52, 0xCF, 0xC0, 0xFB, 0x9B, 0x70, 0xD8,
+    0xDF, 0xE1, 0x50, 0x75, 0xFC, 0xC5, 0xEE, 0xFC, 0xA5, 0x1C, 0x42, 0x20, 0x5B, 0xE1, 0xB3, 0x78,
+    0x1D, 0x87, 0x34, 0xAA, 0x6C, 0x3C, 0x4E, 0xB5, 0x9E, 0xF0, 0x18, 0xBB, 0x59, 0x00, 0x40, 0xD8,
+    0x31, 0x45, 0xAE, 0x0E, 0x55, 0x86, 0xE7, 0x95, 0x00, 0xAC, 0xB8, 0xA8, 0x24, 0x90, 0xED, 0xCA,
+    0x5C, 0x8B, 0x5B, 0xF1, 0x6C, 0x31, 0x57, 0x61, 0xAE, 0xEA, 0x22, 0xD0, 0x16, 0xB9, 0x78, 0xD5,
+    0x4A, 0x9C, 0xA8, 0x05, 0xA4, 0xAF, 0x24, 0x09, 0x03, 0xDB, 0x07, 0x59, 0x96, 0x30, 0x2C, 0xE2,
+    0x17, 0x5A, 0x62, 0xB6, 0xC2, 0x23, 0x0F, 0x87, 0xB9, 0x5E, 0x33, 0x9A, 0xCB, 0x6C, 0x71, 0x30,
+    0xBC, 0x37, 0xE0, 0x78, 0xC4, 0x0A, 0xC1, 0x96, 0xE7, 0xD5, 0xE6, 0x90, 0x61, 0xA9, 0xE9, 0x31,
+    0x24, 0x36, 0x5C, 0x22, 0x2E, 0x03, 0x6D, 0x4E, 0x16, 0x09, 0x9B, 0xF3, 0x76, 0xE9, 0x29, 0xA5,
+    0xB2, 0x53, 0x9B, 0xFB, 0x62, 0xF7, 0xB6, 0x5C, 0x02, 0x13, 0xB1, 0xF5, 0x65, 0xD2, 0xCC, 0x81,
+    0x68, 0xB0, 0xBB, 0x1C, 0xD4, 0x5C, 0x87, 0xB5, 0xB9, 0x7A, 0x9A, 0xEB, 0x6C, 0xF7, 0xF7, 0xF1,
+    0x90, 0x9F, 0xF2, 0xD0, 0x6B, 0xA2, 0x19, 0x07, 0x5A, 0x79, 0xC0, 0x8F, 0x94, 0xC0, 0x25, 0xC7,
+    0x39, 0x7B, 0xA3, 0xBE, 0x89, 0x09, 0x20, 0x91, 0xA6, 0xF3, 0x07, 0x23, 0x5B, 0x85, 0xFD, 0xC2,
+    0x34, 0xAC, 0x19, 0xF2, 0x12, 0x2F, 0x51, 0x1E, 0xA8, 0x35, 0x51, 0xB7, 0x54, 0x46, 0xA9, 0xD0,
+    0x4B, 0xB3, 0x24, 0x38, 0x1D, 0x94, 0xCC, 0xAA, 0x67, 0xB6, 0x57, 0x76, 0xCB, 0xC4, 0xED, 0x7A,
+    0xE2, 0x68, 0x35, 0xF1, 0x31, 0x3C, 0x17, 0xF7, 0x4C, 0x3C, 0x9E, 0x4C, 0xCC, 0xD1, 0x39, 0xF0,
+    0x6A, 0x59, 0xED, 0x9D, 0x65, 0x71, 0x60, 0x26, 0x46, 0xB9, 0x4A, 0x1F, 0x64, 0x00, 0xE9, 0x2C,
+    0xD2, 0x5F, 0x3F, 0xB3, 0xA4, 0x38, 0x52, 0x60, 0x41, 0xD2, 0x25, 0xB3, 0xA2, 0xFA, 0x90, 0x0B,
+    0xC0, 0x48, 0x66, 0xAE, 0x88, 0x50, 0xAC, 0x4B, 0xF2, 0x81, 0x75, 0x88, 0xEF, 0x69, 0x9E, 0x92,
+    0x83, 0xA8, 0x68, 0x03, 0xE3, 0xD3, 0xAF, 0x54, 0xB2, 0x5F, 0x52, 0x02, 0xE1, 0x26, 0xA8, 0xF7,
+    0x4F, 0x6E, 0xCE, 0x91, 0xE9, 0x51, 0x94, 0xF1, 0x97, 0xCA, 0xDD, 0xDF, 0x82, 0x85, 0xAD, 0xA4,
+    0xA3, 0x0D, 0x79, 0xC0, 0x04, 0xC2, 0x03, 0x60, 0x43, 0x26, 0x87, 0x70, 0x53, 0x36, 0x03, 0xC0,
+    0x03, 0x72, 0xBF, 0x5C, 0x71, 0x91, 0x17, 0x33, 0x93, 0xFD, 0x89, 0xB2, 0xA6, 0x99, 0x64, 0xB7,
+    0x94, 0xF5, 0x2A, 0x65, 0xB8, 0xFB, 0x94, 0x71, 0xDB, 0x14, 0x14, 0xBD, 0xAF, 0xAE, 0x58, 0x93,
+    0x32, 0x31, 0x2E, 0x98, 0x1D, 0x2B, 0x0E, 0xC5, 0x14, 0x0F, 0x2A, 0x40, 0xDC, 0x78, 0xC2, 0x90,
+    0xE5, 0xCB, 0xBC, 0x09, 0x2C, 0xCA, 0x3A, 0xC8, 0x40, 0x6F, 0x58, 0xFB, 0xE4, 0x6A, 0xAE, 0xF2,
+    0x83, 0x17, 0x9D, 0x4B, 0x51, 0x01, 0xF9, 0xA7, 0x12, 0xEC, 0x5E, 0x20, 0x7C, 0xCB, 0x8D, 0xFF,
+    0x58, 0xD8, 0xAF, 0x7E, 0x29, 0xC9, 0x25, 0x0A, 0xA2, 0xF0, 0x53, 0xF1, 0xFD, 0x77, 0x70, 0xF3,
+    0x13, 0xD1, 0x06, 0x0A, 0x22, 0xB9, 0xD9, 0x8E, 0xAC, 0x89, 0xFE, 0x7E, 0x48, 0x06, 0x0F, 0xE7,
+    0xFF, 0xE6, 0x90, 0x75, 0x1E, 0xFE, 0xBF, 0x95, 0xF7, 0xA5, 0xDE, 0x94, 0x75, 0xD5, 0xF0, 0x26,
+    0xEC, 0x11, 0xA8, 0xA6, 0xED, 0x18, 0x90, 0xCE, 0x25, 0xE3, 0x56, 0xB4, 0x03, 0x4E, 0x25, 0x75,
+    0x1C, 0xD0, 0x4E, 0xC0, 0x4D, 0xBF, 0x01, 0x83, 0xBD, 0x60, 0x11, 0x04, 0x90, 0xCB, 0x4D, 0x83,
+    0xAC, 0x20, 0x47, 0x49, 0x40, 0x6C, 0x10, 0xD0, 0xD9, 0x27, 0x93, 0x95, 0xA4, 0x11, 0x13, 0xE1,
+    0x86, 0xC2, 0xC2, 0x3A, 0xB7, 0x2C, 0xA0, 0xF4, 0x8A, 0x55, 0x22, 0x5F, 0x43, 0xCE, 0x8C, 0x4E,
+    0x04, 0xAE, 0x29, 0xF3, 0x93, 0x51, 0x9B, 0x15, 0x9F, 0x05, 0x2A, 0xA9, 0xFC, 0x54, 0xA0, 0x09,
+    0xE5, 0xDD, 0x47, 0x22, 0x51, 0x58, 0xE6, 0x87, 0x52, 0x7C, 0x40, 0x64, 0x87, 0xE5, 0x5A, 0x97,
+    0x40, 0xE5, 0xBD, 0xD4, 0x28, 0x8D, 0xAC, 0xB1, 0xF0, 0x6D, 0x55, 0x63, 0x4A, 0xDF, 0x69, 0x46,
+    0x99, 0xF7, 0x9A, 0xD7, 0x64, 0x23, 0xAE, 0x62, 0xBF, 0x93, 0x2C, 0x46, 0xA6, 0x4C, 0x98, 0xC3,
+    0x10, 0x6F, 0xD9, 0x1F, 0xA1, 0xCC, 0x33, 0x40, 0x06, 0xD8, 0xEA, 0x15, 0x1A, 0x38, 0xE5, 0xA8,
+    0x55, 0x5E, 0x35, 0xB8, 0x75, 0x7E, 0xD1, 0xBB, 0x39, 0xD9, 0x67, 0x80, 0xB1, 0xF0, 0x88, 0xA6,
+    0x40, 0x78, 0x1A, 0x06, 0x26, 0x90, 0xE5, 0xC8, 0x1A, 0x2E, 0x0B, 0x74, 0xB4, 0x54, 0x93, 0x2A,
+    0x31, 0x18, 0x24, 0x1A, 0x89, 0x26, 0x55, 0xC7, 0x4B, 0xD9, 0x1F, 0x2D, 0x3C, 0xD0, 0x0E, 0xED,
+    0x22, 0x4F, 0xD3, 0x7E, 0x46, 0x5E, 0xFC, 0xC0, 0x0F, 0xE5, 0x69, 0x3C, 0x89, 0x52, 0x1F, 0xAC,
+    0xB7, 0xF0, 0xC7, 0x14, 0x70, 0x19, 0x9E, 0x54, 0x96, 0x9B, 0x4D, 0x1A, 0xFF, 0x7A, 0x8D, 0xB3,
+    0x35, 0x23, 0x86, 0x16, 0x3F, 0x3B, 0x77, 0xCC, 0x3D, 0x34, 0xF5, 0x38, 0x06, 0xC7, 0xD6, 0xFA,
+    0x08, 0x19, 0x93, 0xF5, 0x25, 0x97, 0x63, 0x7D, 0x01, 0x5A, 0x92, 0xA2, 0x82, 0x19, 0xD8, 0x7D,
+    0x93, 0x2A, 0xA1, 0x79, 0xC3, 0xBA, 0x0C, 0x35, 0xE1, 0xBB, 0xD8, 0x10, 0xC3, 0x51, 0xA0, 0xA0,
+    0x86, 0x7D, 0xEF, 0xFC, 0xA5, 0xC1, 0x71, 0xFA, 0xEA, 0xC1, 0xF1, 0xAB, 0x08, 0x7B, 0xF8, 0x7D,
+    0x0A, 0xBB, 0x32, 0x61, 0xB7, 0x2A, 0xEC, 0x06, 0xC2, 0xCE, 0x28, 0xEC, 0xFF, 0x9C, 0x13, 0xE1,
+    0x51, 0x85, 0xDD, 0x29, 0x9B, 0x7B, 0x56, 0x83, 0x5C, 0xA8, 0x7B, 0x9B, 0xEF, 0xAC, 0x64, 0xB5,
+    0xB2, 0x74, 0x2E, 0x66, 0xE7, 0x6A, 0x54, 0x5B, 0x3C, 0xEE, 0xC1, 0x8E, 0x52, 0x7A, 0xAE, 0xAB,
+    0x1C, 0x55, 0x2D, 0x85, 0xE5, 0x90, 0x99, 0x64, 0x64, 0x2D, 0xB3, 0xC1, 0xF6, 0xA8, 0x81, 0x52,
+    0xF3, 0xEB, 0x76, 0x49, 0xB1, 0x59, 0x8D, 0xB5, 0xA8, 0x30, 0xC2, 0x73, 0xA8, 0x94, 0xC1, 0x35,
+    0xA2, 0x19, 0x6C, 0xAC, 0x0D, 0xF1, 0x94, 0xF4, 0xDD, 0x40, 0x2F, 0x91, 0xC5, 0xC4, 0xC1, 0x12,
+    0xC8, 0x92, 0x49, 0x25, 0xFB, 0x70, 0x10, 0x80, 0xA8, 0x45, 0x84, 0xA9, 0xC0, 0x2A, 0x54, 0xA4,
+    0xCA, 0x30, 0x7E, 0x98, 0xB5, 0x92, 0x6B, 0x3D, 0x74, 0x6C, 0x8B, 0x78, 0x2B, 0x2D, 0x7E, 0x04,
+    0x18, 0xEA, 0xDD, 0x37, 0x96, 0x3C, 0xB9, 0x59, 0x51, 0xCD, 0x96, 0xB5, 0xF2, 0x37, 0x39, 0x69,
+    0x4F, 0x4B, 0xFB, 0x5B, 0xE1, 0xF8, 0x45, 0x6A, 0xF9, 0xDF, 0x61, 0xE9, 0x0C, 0x44, 0x46, 0x0F,
+    0xEE, 0x6F, 0xF8, 0x79, 0xF9, 0xDE, 0x25, 0xB2, 0x8A, 0xB9, 0xDD, 0xA6, 0xE5, 0x0D, 0x03, 0x05,
+    0xED, 0x8D, 0xCD, 0x11, 0x16, 0x3C, 0x24, 0x78, 0x6E, 0x40, 0x27, 0x65, 0x08, 0x94, 0xC7, 0xAD,
+    0x58, 0x9A, 0xBD, 0x24, 0x88, 0x1F, 0x63, 0xE9, 0xED, 0xB8, 0x70, 0x37, 0x96, 0xAE, 0xE3, 0xC2,
+    0xDD, 0x48, 0xCD, 0x4E, 0x31, 0xBA, 0x28, 0x32, 0x08, 0xF1, 0xAA, 0x26, 0xFE, 0x1E, 0xCA, 0x96,
+    0x29, 0x18, 0x13, 0x19, 0xA1, 0xC2, 0x84, 0x6F, 0xAD, 0x70, 0x82, 0x6E, 0xD1, 0xF5, 0x14, 0x10,
+    0xC2, 0x92, 0x01, 0xB2, 0x92, 0x4D, 0x74, 0xF0, 0xA2, 0xAC, 0xC7, 0xA0, 0x59, 0x0F, 0x76, 0xB3,
+    0x1E, 0xF8, 0x98, 0xF6, 0x80, 0xA8, 0x74, 0x40, 0x0B, 0x2A, 0x1D, 0x58, 0x45, 0x8C, 0x60, 0x28,
+    0x7D, 0xA1, 0x7C, 0x4C, 0xF4, 0xBC, 0x81, 0xB4, 0x27, 0xD5, 0x06, 0x63, 0xB3, 0xB4, 0x0F, 0xCB,
+    0x9A, 0x5D, 0xD3, 0xAA, 0x91, 0x21, 0x98, 0x4E, 0x21, 0x30, 0x88, 0x3B, 0x20, 0x67, 0xA4, 0xC5,
+    0x23, 0x61, 0x6C, 0x5C, 0x39, 0xB1, 0xBF, 0x26, 0xA5, 0xD4, 0xC4, 0x48, 0x8C, 0x8A, 0x0E, 0xC8,
+    0x5D, 0x36, 0x50, 0x1E, 0x00, 0xA2, 0x01, 0x92, 0x82, 0xFF, 0x26, 0x99, 0xD8, 0x89, 0x2B, 0x9B,
+    0xF4, 0x79, 0x80, 0xC8, 0xCA, 0x26, 0xFB, 0x75, 0xC0, 0x5A, 0x7C, 0xE3, 0xFF, 0x27, 0xA0, 0x94,
+    0xF6, 0x4D, 0xF9, 0xAF, 0x01, 0xF1, 0xC0, 0x37, 0x82, 0xEC, 0x88, 0x1C, 0x72, 0xF3, 0x6E, 0x60,
+    0x24, 0xF8, 0x44, 0x1E, 0x65, 0x7F, 0xEF, 0xD3, 0x29, 0x0A, 0xEC, 0xBC, 0x7F, 0x26, 0xC6, 0xCF,
+    0x66, 0xF7, 0x8D, 0xDC, 0x40, 0xA2, 0xFE, 0x06, 0xB9, 0xEE, 0x81, 0xD5, 0x73, 0x44, 0xB7, 0xF3,
+    0x04, 0x21, 0xA7, 0x51, 0xD6, 0x6E, 0xF6, 0x84, 0x70, 0xB9, 0x91, 0x45, 0x0D, 0x56, 0x9F, 0x69,
+    0xFB, 0x6D, 0xC3, 0x98, 0x5C, 0xD0, 0xBC, 0xE8, 0x83, 0x60, 0x72, 0x50, 0x4D, 0x07, 0xCD, 0x09,
+    0x36, 0x14, 0x91, 0xEF, 0x55, 0x48, 0x7E, 0xB0, 0x52, 0x71, 0x50, 0xCF, 0x4D, 0x47, 0x2D, 0x64,
+    0x92, 0xA0, 0xE6, 0x1D, 0x5B, 0x8A, 0xB7, 0x35, 0xE7, 0xDF, 0x18, 0xE2, 0x6E, 0x83, 0x06, 0x8F,
+    0x34, 0xCC, 0x0E, 0x3F, 0x59, 0xFF, 0x49, 0x9F, 0x93, 0xAC, 0x47, 0xFB, 0x90, 0x1F, 0x59, 0x3F,
+    0xF8, 0xEF, 0xAC, 0x29, 0xAA, 0x26, 0xAF, 0x58, 0x4B, 0xAE, 0x71, 0x05, 0x4F, 0x98, 0x17, 0x3C,
+    0x31, 0x15, 0x42, 0xCA, 0x33, 0xE8, 0xC2, 0x90, 0x0C, 0x95, 0x08, 0xF6, 0xB5, 0xD8, 0x4F, 0x4C,
+    0x9F, 0x55, 0xFF, 0x85, 0x47, 0x73, 0xE7, 0x24, 0x25, 0xB6, 0xA5, 0xE3, 0x86, 0x65, 0x7F, 0xCC,
+    0x8E, 0x53, 0xCA, 0x36, 0x65, 0xCE, 0x62, 0x1F, 0xD0, 0xB4, 0xA1, 0x1F, 0xA9, 0x6C, 0x9D, 0xE2,
+    0x59, 0x38, 0xB6, 0xA1, 0xAD, 0x42, 0x2A, 0xD7, 0x15, 0xB1, 0x7A, 0xF7, 0xD1, 0x4B, 0xEF, 0x36,
+    0xB9, 0xD7, 0x41, 0x80, 0xD1, 0x41, 0x0B, 0x8D, 0x89, 0x88, 0x3E, 0x19, 0x8A, 0xA6, 0x5A, 0x74,
+    0x58, 0xA7, 0x3B, 0x5E, 0x95, 0x3B, 0x7E, 0xBA, 0xD5, 0x06, 0xD7, 0x36, 0x8A, 0x35, 0xC3, 0x8F,
+    0xCC, 0x45, 0xAB, 0x0E, 0x61, 0x6A, 0x08, 0x73, 0xAB, 0x37, 0xA8, 0xA5, 0x7F, 0x1A, 0x3E, 0xBF,
+    0xBA, 0x62, 0xB4, 0x9B, 0x18, 0x4D, 0x46, 0x62, 0xC5, 0x60, 0xD4, 0x45, 0x1F, 0x14, 0x3B, 0x60,
+    0x6F, 0xC3, 0x72, 0xF2, 0xB9, 0x15, 0x2C, 0xF2, 0xDB, 0x29, 0xA0, 0x52, 0xAE, 0x19, 0x70, 0x8B,
+    0x1C, 0x2C, 0x43, 0xB0, 0x2A, 0x5E, 0xAF, 0xED, 0x8F, 0x1E, 0x09, 0x04, 0xBB, 0x71, 0xD6, 0xE5,
+    0x53, 0x78, 0x2E, 0x3B, 0xF4, 0x03, 0xCB, 0x1E, 0xCC, 0xA1, 0x83, 0xCA, 0xBA, 0x80, 0xE5, 0xE8,
+    0xC4, 0xE8, 0xDB, 0x0B, 0xBB, 0x1B, 0x4E, 0x68, 0xED, 0xB4, 0xCD, 0x95, 0x7B, 0x79, 0xDC, 0x1C,
+    0xDD, 0x0C, 0x56, 0xA7, 0xF5, 0x6B, 0x77, 0x09, 0x1F, 0xF8, 0x15, 0x5C, 0xBC, 0x7C, 0x01, 0x5B,
+    0xAB, 0x2C, 0xB3, 0x47, 0x52, 0x80, 0x4D, 0x90, 0x7D, 0x84, 0x94, 0x4D, 0xA8, 0x76, 0x59, 0xF6,
+    0x5B, 0xFC, 0x17, 0xA4, 0x50, 0x10, 0xFB, 0x3F, 0x98, 0x2A, 0xD1, 0x8D, 0xA0, 0x89, 0xC6, 0xC3,
+    0x35, 0x96, 0x28, 0x4A, 0x3F, 0x14, 0xF9, 0x69, 0x33, 0x40, 0x39, 0xF7, 0x9F, 0x12, 0xF8, 0x0F,
+    0xC4, 0x14, 0xF7, 0x40, 0x9B, 0x6D, 0xFF, 0x4D, 0x7F, 0xB0, 0xA2, 0x07, 0xD1, 0x50, 0x64, 0x56,
+    0xC9, 0xD0, 0x75, 0xA4, 0xAA, 0xCC, 0xA6, 0xFB, 0x0A, 0x96, 0x53, 0xA2, 0xDF, 0x86, 0xB7, 0x38,
+    0x65, 0xA7, 0xDB, 0x4A, 0x5B, 0x8B, 0xFA, 0x8F, 0xE6, 0x9D, 0x1E, 0xE7, 0xDE, 0x7C, 0xFF, 0xB5,
+    0xC6, 0x18, 0x2D, 0xC6, 0x18, 0x7D, 0xF0, 0xE7, 0xCC, 0x0E, 0x3E, 0xA5, 0x56, 0xBF, 0xB4, 0xC2,
+    0x53, 0x86, 0x7D, 0x4E, 0xAD, 0x1E, 0x8E, 0x5A, 0x9D, 0xA8, 0xD5, 0x61, 0xD6, 0x6A, 0x3F, 0x6B,
+    0xB5, 0x9B, 0xB1, 0xF9, 0xA8, 0x55, 0xC2, 0x46, 0xBF, 0xA1, 0x56, 0x13, 0x2D, 0xF4, 0xAC, 0xC9,
+    0x00, 0x78, 0x19, 0xAA, 0x5B, 0x5A, 0x75, 0xDF, 0x7B, 0x66, 0x48, 0x91, 0xDB, 0x4E, 0x8C, 0xFC,
+    0xB6, 0xF3, 0x28, 0x9F, 0xB2, 0x81, 0xD6, 0x84, 0x30, 0xD0, 0xE7, 0x02, 0x72, 0x1D, 0xBB, 0xF2,
+    0xDE, 0xF6, 0x30, 0xD8, 0x10, 0x28, 0x74, 0xA9, 0x2A, 0xA1, 0x5E, 0x73, 0x88, 0xCC, 0xCD, 0xBD,
+    0xF8, 0x40, 0xCF, 0x02, 0xB0, 0x3C, 0x5E, 0x9A, 0xC7, 0xD1, 0x55, 0xB1, 0xC4, 0xD9, 0x4A, 0x23,
+    0x97, 0x16, 0x57, 0x2F, 0x0E, 0x73, 0x13, 0x7D, 0xDD, 0xB1, 0xC8, 0xC2, 0x05, 0x1F, 0x19, 0xA9,
+    0x46, 0xC2, 0x0B, 0xE8, 0xD7, 0xAA, 0xE9, 0x9F, 0x8F, 0xBB, 0x14, 0x77, 0x9B, 0x61, 0x6B, 0x99,
+    0xDF, 0x75, 0xFD, 0xBD, 0xB3, 0xB8, 0x78, 0xBF, 0x35, 0x8F, 0x2F, 0xEF, 0x17, 0x11, 0x60, 0x9F,
+    0x2A, 0xFC, 0x69, 0xEC, 0x35, 0x50, 0xE2, 0x97, 0x8F, 0xAD, 0xC1, 0xFB, 0xE8, 0x0C, 0x0D, 0xA3,
+    0xDE, 0x23, 0x4F, 0x9A, 0xAA, 0xD9, 0xB1, 0x60, 0xF7, 0x07, 0x91, 0x62, 0x0A, 0x1B, 0xAC, 0x13,
+    0x36, 0x18, 0x69, 0xDF, 0x85, 0x76, 0x38, 0x85, 0x0B, 0xEC, 0x42, 0xAA, 0xA1, 0x6B, 0xC6, 0x33,
+    0xB0, 0xA2, 0x24, 0x15, 0xAC, 0x44, 0x3A, 0x08, 0x00, 0xFD, 0xA6, 0xDA, 0x5F, 0x68, 0x09, 0x59,
+    0x88, 0xDC, 0x23, 0x22, 0x6D, 0xD5, 0x6A, 0x56, 0x47, 0x8E, 0xA2, 0x65, 0xC1, 0x7F, 0xCD, 0xA0,
+    0x52, 0xBE, 0x57, 0x69, 0x5E, 0x32, 0x90, 0x76, 0xA4, 0x07, 0xF4, 0x7A, 0xFA, 0xDF, 0xCE, 0xB7,
+    0xB1, 0x5F, 0x2D, 0x71, 0x73, 0xA0, 0x6F, 0x07, 0xF5, 0x6D, 0xA0, 0xD2, 0x35, 0x22, 0xDC, 0x40,
+    0xAF, 0xEE, 0xB6, 0xB3, 0x87, 0x6B, 0x07, 0x75, 0x6B, 0x74, 0xBF, 0x76, 0x6C, 0x6E, 0xBC, 0x62,
+    0x1E, 0xD8, 0xF8, 0xC8, 0x85, 0x0F, 0x66, 0xEC, 0x0A, 0x5E, 0x8A, 0x5C, 0x9A, 0x58, 0xEA, 0x76,
+    0x85, 0x73, 0xDF, 0xB6, 0x9D, 0xF0, 0x60, 0x2F, 0x54, 0x17, 0xAB, 0x2C, 0xFD, 0xEC, 0xC2, 0x76,
+    0x45, 0x5B, 0x35, 0x0B, 0x96, 0xB5, 0x0D, 0xDD, 0xEF, 0x74, 0x73, 0x75, 0x4F, 0x33, 0x48, 0x56,
+    0xC3, 0x9C, 0x6C, 0xAE, 0xAE, 0x36, 0x58, 0xE5, 0xEF, 0x8F, 0x67, 0xB1, 0x6E, 0x4F, 0xD3, 0x2C,
+    0x77, 0xDA, 0x7B, 0x67, 0xDE, 0x7C, 0x6F, 0x2F, 0xC4, 0xDF, 0xD3, 0x0B, 0xB9, 0x53, 0xDC, 0xEF,
+    0xEF, 0x74, 0x5A, 0x92, 0x57, 0xB6, 0x78, 0x10, 0x28, 0x7F, 0xA4, 0xF5, 0x7B, 0x63, 0x66, 0x49,
+    0xAB, 0xD4, 0x94, 0xE0, 0x37, 0xD6, 0x6F, 0x0F, 0x21, 0x6A, 0xC6, 0x57, 0xB6, 0x58, 0x6B, 0xD5,
+    0x02, 0x2E, 0xC5, 0xFD, 0xD1, 0xD5, 0xAA, 0x03, 0x4A, 0xF9, 0x7F, 0xA1, 0x3C, 0x7F, 0xC6, 0x94,
+    0xE5, 0x9A, 0xD1, 0x1A, 0x76, 0xA5, 0x34, 0xA6, 0xA5, 0x25, 0xE6, 0xB8, 0x37, 0x94, 0x2E, 0xE5,
+    0x3C, 0xC6, 0x6C, 0x76, 0x6A, 0x37, 0xCD, 0x76, 0xA4, 0x50, 0x31, 0xF6, 0x3C, 0x0C, 0xD1, 0x71,
+    0x31, 0xE0, 0xF6, 0x64, 0xD7, 0xFB, 0x1E, 0xA5, 0xBC, 0x56, 0xBF, 0xC5, 0x57, 0xD2, 0x2F, 0xD1,
+    0xEB, 0xAC, 0xC8, 0x6B, 0xF1, 0x5C, 0xF9, 0xE4, 0x43, 0x98, 0x2F, 0x46, 0xFF, 0x69, 0x98, 0x58,
+    0x09, 0x54, 0x1F, 0x87, 0xE0, 0xB9, 0x43, 0x81, 0x3E, 0x74, 0xC5, 0xCC, 0x2D, 0x0E, 0x3D, 0x86,
+    0x84, 0x8D, 0x37, 0x09, 0x8A, 0x9A, 0x46, 0x77, 0x06, 0xF4, 0xE4, 0x82, 0x6E, 0x11, 0xC8, 0xDC,
+    0x6C, 0x73, 0xEF, 0xD5, 0xC0, 0xE3, 0x60, 0x38, 0xAE, 0x6F, 0xF3, 0xF9, 0x06, 0x49, 0x11, 0x3F,
+    0xF7, 0xBD, 0x7D, 0xEE, 0x3B, 0x7B, 0x5B, 0xB6, 0xF6, 0xB6, 0x6A, 0xED, 0xED, 0xB2, 0x85, 0x07,
+    0x7C, 0xEF, 0xEC, 0x06, 0xCC, 0x37, 0xCA, 0x39, 0xD9, 0x0E, 0xCA, 0xF3, 0x89, 0x3B, 0xBA, 0xDF,
+    0xA3, 0x3B, 0x5E, 0x3E, 0xB6, 0x32, 0xC7, 0x03, 0xCB, 0x81, 0x49, 0x08, 0x61, 0x12, 0xE0, 0x0F,
+    0x4C, 0x51, 0xF3, 0x21, 0xC3, 0xFA, 0x88, 0x63, 0x1E, 0xA3, 0xE1, 0x60, 0xC5, 0xC0, 0x0A, 0x1E,
+    0xA1, 0x6B, 0xC0, 0x48, 0x3D, 0xC3, 0x17, 0xCE, 0x54, 0xB4, 0x08, 0x5B, 0x35, 0x5B, 0x57, 0x69,
+    0xD0, 0x0D, 0xE4, 0xDE, 0xAA, 0x30, 0x06, 0xD9, 0xE8, 0xE2, 0x61, 0x8F, 0x03, 0x2B, 0x48, 0xA5,
+    0xE3, 0x61, 0x6E, 0xA9, 0xA3, 0x66, 0x79, 0x41, 0x5C, 0xDC, 0x57, 0x94, 0x27, 0xE7, 0x38, 0x49,
+    0x7E, 0x7C, 0x7F, 0xDC, 0xF7, 0xC4, 0x6E, 0xA4, 0xFE, 0x37, 0x3C, 0xB3, 0xD3, 0x22, 0x5E, 0xA2,
+    0x54, 0x15, 0x80, 0x1E, 0x32, 0xED, 0x1A, 0x70, 0x6A, 0xEE, 0x27, 0x5F, 0x12, 0x64, 0x13, 0xC2,
+    0x85, 0x3B, 0xBF, 0xDF, 0x83, 0x5E, 0x86, 0x93, 0x1A, 0xF4, 0x2C, 0x7D, 0x6B, 0x29, 0xA3, 0x67,
+    0x73, 0xA0, 0xDF, 0xBC, 0x2E, 0xD0, 0x67, 0xBF, 0x4D, 0xA0, 0x9F, 0x18, 0xE8, 0x7F, 0xCD, 0xF4,
+    0xED, 0x23, 0xA0, 0xC7, 0x1F, 0xDE, 0x73, 0xA2, 0xE0, 0x15, 0xE8, 0xAE, 0x0E, 0x21, 0x63, 0xFE,
+    0x1B, 0xB2, 0xFA, 0x5F, 0xC2, 0xFF, 0x6F, 0x74, 0xA7, 0x0C, 0x46, 0xF5, 0x8F, 0xEC, 0x71, 0x68,
+    0x72, 0xBB, 0xD1, 0xE8, 0xFD, 0xFA, 0xC6, 0xF0, 0x70, 0x0F, 0x18, 0xBA, 0x4D, 0xF5, 0x3E, 0x2B,
+    0x63, 0xE6, 0xB4, 0xDC, 0x4A, 0x16, 0xA3, 0xAC, 0x4B, 0x0C, 0xF5, 0x40, 0xC7, 0x8B, 0x75, 0x0E,
+    0x2D, 0x05, 0xF6, 0x96, 0x37, 0xA0, 0x69, 0xC7, 0x33, 0x35, 0x96, 0x4D, 0xE7, 0x86, 0xB6, 0x3F,
+    0xE6, 0xEE, 0x2E, 0x8C, 0xA6, 0xB2, 0x63, 0x27, 0x48, 0x6D, 0xC6, 0x79, 0xD7, 0x60, 0xDB, 0x6B,
+    0xAC, 0x48, 0xED, 0xCC, 0x52, 0xF9, 0xC5, 0x05, 0x12, 0x0B, 0x24, 0x34, 0x38, 0x91, 0xF3, 0xA7,
+    0xE1, 0xF3, 0xF7, 0x5F, 0x76, 0xF8, 0xE6, 0x5E, 0x28, 0x1A, 0xFF, 0x80, 0x6D, 0xC2, 0x9C, 0xE5,
+    0xC2, 0xA8, 0xB5, 0x95, 0x64, 0x56, 0xD1, 0x0E, 0x81, 0x60, 0xED, 0x56, 0x1A, 0xD5, 0xD3, 0x75,
+    0x54, 0x5F, 0x9A, 0x59, 0x8B, 0x89, 0x9E, 0x1A, 0x27, 0x2A, 0xAB, 0x16, 0xA8, 0x16, 0x1A, 0xDA,
+    0x67, 0x83, 0x12, 0x24, 0x34, 0xE8, 0x45, 0x84, 0xAE, 0xE4, 0x21, 0x8C, 0x09, 0xB1, 0x9D, 0x16,
+    0xE5, 0xC3, 0x7F, 0x90, 0xCF, 0xB7, 0x96, 0x7D, 0x6B, 0xC9, 0x42, 0x84, 0x07, 0xDF, 0xB1, 0x9C,
+    0xEF, 0x20, 0x20, 0xDD, 0x07, 0xCD, 0x09, 0x20, 0x42, 0xD1, 0xA1, 0xEA, 0xB1, 0xDA, 0x8C, 0x08,
+    0x91, 0x0E, 0x5C, 0xE5, 0xC0, 0x75, 0xC2, 0x5D, 0x85, 0x42, 0x45, 0x09, 0x3C, 0x54, 0x28, 0xB4,
+    0x10, 0x8F, 0xB6, 0x7B, 0xC1, 0x4D, 0xEA, 0x69, 0xA9, 0x26, 0xA9, 0x1D, 0xB7, 0xB5, 0x93, 0x13,
+    0x7A, 0x8A, 0xCB, 0xED, 0xCE, 0x85, 0x56, 0xF5, 0x16, 0xEC, 0x1F, 0x78, 0xC5, 0x6E, 0x8F, 0xA4,
+    0x3E, 0x0D, 0xDA, 0x3C, 0xB5, 0x94, 0x33, 0x28, 0xDA, 0xC5, 0xD7, 0x1B, 0x14, 0x83, 0xB5, 0xFF,
+    0xB8, 0x01, 0xAE, 0xD4, 0xA5, 0x5C, 0x45, 0x0A, 0x75, 0x78, 0x07, 0xE5, 0x7F, 0xD9, 0x84, 0xAC,
+    0x81, 0x15, 0x7E, 0x32, 0x65, 0x9F, 0xA0, 0x4A, 0xFF, 0x68, 0xC8, 0x98, 0x30, 0xFF, 0x62, 0xC8,
+    0x3E, 0xC3, 0xBA, 0x3F, 0xEE, 0x32, 0x9C, 0xC5, 0xF1, 0x37, 0x6D, 0x76, 0xC3, 0x43, 0x13, 0x4D,
+    0xA6, 0x87, 0x13, 0x0E, 0x99, 0x76, 0xB8, 0xF7, 0x3C, 0x0E, 0xE5, 0x03, 0xDB, 0x64, 0x7A, 0x2D,
+    0x34, 0x53, 0x0D, 0x96, 0x2D, 0x9C, 0xED, 0xD8, 0xBF, 0xA2, 0x62, 0x08, 0x22, 0x5B, 0xC2, 0x4A,
+    0x4C, 0x23, 0xF8, 0x0B, 0x3D, 0x35, 0xA3, 0xC7, 0x29, 0x34, 0xF3, 0xAB, 0x9D, 0x1D, 0xF0, 0x42,
+    0x07, 0x02, 0x9F, 0x4C, 0x4B, 0x99, 0xCD, 0x6D, 0x16, 0x49, 0xD5, 0x30, 0x55, 0x89, 0x43, 0x0D,
+    0x02, 0x2B, 0x41, 0xBB, 0x2B, 0x18, 0xB8, 0x80, 0xC6, 0x27, 0x9B, 0x0D, 0xE5, 0xB1, 0x2A, 0xC9,
+    0xB4, 0x64, 0x6A, 0xA2, 0xC7, 0x0F, 0xBC, 0x20, 0x7C, 0x67, 0x5A, 0x70, 0xA3, 0xDB, 0x86, 0x56,
+    0x0A, 0x75, 0x25, 0x17, 0x3D, 0x22, 0x41, 0x6D, 0xB9, 0x64, 0xA4, 0x7F, 0x25, 0x23, 0xFD, 0x2A,
+    0x1E, 0x99, 0x61, 0x6C, 0x99, 0x16, 0xBA, 0xED, 0x64, 0xB9, 0xA0, 0x55, 0xF5, 0x61, 0xD5, 0x0B,
+    0x88, 0xB4, 0x15, 0xA0, 0x27, 0xB7, 0xE6, 0xEC, 0x59, 0xCB, 0x14, 0x4B, 0x6E, 0x0C, 0x30, 0xEC,
+    0x4C, 0xCB, 0x77, 0xF5, 0xF9, 0x4A, 0x9F, 0xAF, 0xF4, 0xC1, 0x4A, 0x9F, 0x28, 0x2D, 0xFD, 0x3D,
+    0xDB, 0xED, 0x2E, 0xF4, 0xC4, 0x5D, 0x69, 0x5E, 0xD8, 0xA9, 0x2B, 0x2A, 0x4C, 0xB0, 0xEA, 0xA2,
+    0xB3, 0xEA, 0x59, 0xA0, 0xE3, 0xE7, 0x73, 0x0B, 0x72, 0x39, 0x23, 0x14, 0xEB, 0xE7, 0xBB, 0x9D,
+    0x9E, 0x84, 0x61, 0x4B, 0x8F, 0xAD, 0xB5, 0x4A, 0xEB, 0x72, 0xF7, 0xE6, 0x0F, 0xE7, 0x7D, 0xF1,
+    0xE5, 0x48, 0x51, 0x42, 0xB0, 0x69, 0x57, 0x27, 0x1C, 0xFE, 0x8F, 0xE3, 0x93, 0x76, 0x54, 0x04,
+    0x75, 0x48, 0xE6, 0x6A, 0x29, 0x14, 0xA7, 0x87, 0x33, 0x78, 0x14, 0x0C, 0xE1, 0x65, 0xB9, 0xF1,
+    0x76, 0xD3, 0xCF, 0x37, 0xDD, 0xF1, 0x69, 0x46, 0x29, 0x3D, 0x56, 0x2A, 0x58, 0x1E, 0x8F, 0x76,
+    0x28, 0x52, 0x82, 0x3E, 0xDA, 0x8A, 0xE5, 0xDE, 0x0B, 0x20, 0x14, 0x95, 0x44, 0xF7, 0x48, 0xB0,
+    0x73, 0x92, 0x47, 0x92, 0x91, 0x0F, 0xA5, 0x70, 0x76, 0x18, 0x53, 0xCB, 0x50, 0x2D, 0x0B, 0xD9,
+    0x15, 0xD8, 0x42, 0x2E, 0xF5, 0xF4, 0x14, 0xC7, 0xC4, 0xA8, 0x7F, 0x86, 0x71, 0x39, 0x32, 0xF6,
+    0x24, 0x86, 0x04, 0xA3, 0xA7, 0x18, 0x5F, 0x10, 0xF2, 0xAC, 0x90, 0x39, 0xE2, 0xC6, 0x7D, 0xDF,
+    0x6D, 0x1E, 0x7B, 0xA0, 0x45, 0x36, 0x94, 0x03, 0x4F, 0x5D, 0x55, 0x28, 0x12, 0xE5, 0x82, 0x76,
+    0x14, 0xA4, 0x84, 0xFD, 0x8D, 0x4E, 0xA4, 0x7E, 0x61, 0xA2, 0xFF, 0xEE, 0x23, 0xF7, 0xF5, 0x1F,
+    0x68, 0xAB, 0x4F, 0xA1, 0xC2, 0x23, 0x69, 0xD2, 0xE3, 0x44, 0x52, 0x4B, 0xB2, 0xB5, 0x15, 0xDA,
+    0x32, 0x98, 0xBA, 0x99, 0xA9, 0x6E, 0x88, 0x70, 0x66, 0x7D, 0x76, 0xB0, 0xEA, 0xBD, 0x6F, 0x85,
+    0x27, 0x85, 0x1E, 0x13, 0x09, 0x4C, 0xEF, 0x82, 0x9E, 0xDB, 0xD8, 0xCE, 0x37, 0x9B, 0xEB, 0x70,
+    0x75, 0x1D, 0x3E, 0xD7, 0x50, 0x13, 0x5B, 0x4F, 0xCC, 0x0C, 0x97, 0xC7, 0x39, 0x2D, 0xB4, 0x69,
+    0xBC, 0xD3, 0xEC, 0x6A, 0x7D, 0xA3, 0x69, 0x96, 0xE6, 0xE4, 0x1A, 0x01, 0x91, 0x66, 0x75, 0x56,
+    0x43, 0xD2, 0x97, 0x22, 0xA6, 0xC0, 0x6B, 0x06, 0xEF, 0x72, 0x2A, 0xF1, 0x42, 0xCB, 0xAE, 0x38,
+    0x2C, 0xA7, 0x09, 0xCD, 0x8B, 0x98, 0x07, 0x16, 0x6B, 0x06, 0x6D, 0x8F, 0xD0, 0xBD, 0x19, 0x06,
+    0x29, 0x66, 0x29, 0x9C, 0x2E, 0xD3, 0x8E, 0xA0, 0x01, 0x98, 0x22, 0x17, 0x66, 0xC8, 0x9F, 0xB9,
+    0x64, 0x2E, 0x32, 0xA4, 0x7E, 0x7E, 0x68, 0x15, 0x34, 0x9A, 0x8E, 0x88, 0x85, 0xD6, 0x1D, 0xAB,
+    0xD5, 0x95, 0x5E, 0x1C, 0xD4, 0x75, 0xF6, 0x62, 0x17, 0x8B, 0xF7, 0x5A, 0x35, 0xCD, 0x7A, 0x3A,
+    0x12, 0x64, 0x46, 0x45, 0xBD, 0xD5, 0xE3, 0x84, 0xC4, 0x11, 0x54, 0xD5, 0x78, 0x14, 0x75, 0xB5,
+    0x3A, 0x62, 0x67, 0xAD, 0xE2, 0x56, 0xCB, 0x98, 0xCA, 0x44, 0x14, 0xE6, 0x6B, 0xA3, 0x92, 0x42,
+    0xF6, 0xD1, 0xAB, 0x78, 0xCA, 0x4E, 0x85, 0x52, 0xB5, 0x26, 0x93, 0xF9, 0xDA, 0x68, 0x5A, 0xC0,
+    0xF0, 0x11, 0xB4, 0xC8, 0x49, 0x4C, 0x42, 0x76, 0x0C, 0x04, 0x62, 0xA1, 0xA0, 0xB2, 0x51, 0xE5,
+    0x94, 0xDB, 0xF6, 0x96, 0x9F, 0xAF, 0x56, 0xDD, 0x69, 0x35, 0x63, 0x15, 0xF8, 0x5C, 0x83, 0xCF,
+    0x55, 0xF8, 0x5C, 0x87, 0x1F, 0x2B, 0x71, 0x95, 0x17, 0x7B, 0x32, 0x79, 0x60, 0xC3, 0x1B, 0xF2,
+    0xAA, 0x66, 0x79, 0x35, 0x26, 0x2F, 0x32, 0xB6, 0x3F, 0x65, 0x2C, 0x28, 0x63, 0x22, 0x2F, 0x30,
+    0xF6, 0x4A, 0x79, 0x4D, 0x2F, 0x97, 0x57, 0x76, 0x9F, 0xBC, 0xBA, 0xDF, 0xA9, 0xBC, 0xE2, 0xDF,
+    0xAD, 0xBC, 0xD4, 0x6B, 0x89, 0x64, 0xEA, 0xB7, 0xE9, 0xB0, 0x78, 0x6E, 0x7E, 0xF4, 0xDD, 0xFC,
+    0xE8, 0xBD, 0x7A, 0x2E, 0x97, 0xFE, 0x9B, 0x34, 0x2B, 0xBF, 0x58, 0x79, 0xC6, 0xE2, 0xC5, 0x04,
+    0x1F, 0xF5, 0xE3, 0xD0, 0x2C, 0x9E, 0xCC, 0xDD, 0x9F, 0xE5, 0xD6, 0xBC, 0x39, 0xB2, 0x75, 0xCE,
+    0xCE, 0xA4, 0x1E, 0xCD, 0x55, 0xAB, 0x4F, 0xD3, 0x50, 0xD4, 0xAB, 0xE3, 0xB0, 0xB8, 0x73, 0x72,
+    0xEB, 0x56, 0x7D, 0x9B, 0xBA, 0x51, 0xEF, 0x26, 0x08, 0xA8, 0x7F, 0xAB, 0x86, 0xEA, 0xD9, 0xFF,
+    0xCD, 0xC7, 0x7D, 0xBF, 0x2C, 0x62, 0x7D, 0xDB, 0x2D, 0xEB, 0x29, 0xDB, 0xC5, 0xD7, 0xA1, 0x3B,
+    0x63, 0x10, 0x6B, 0x5E, 0xFC, 0x7D, 0xE5, 0xF1, 0x2B, 0x9F, 0x3F, 0x7A, 0xFD, 0xCA, 0xEF, 0x57,
+    0x9E, 0xBF, 0xF2, 0xFD, 0x95, 0xF7, 0x9F, 0xFA, 0xFF, 0xAC, 0xA1, 0x87, 0x3F, 0x3C, 0x6A, 0x68,
+    0x5C, 0x34, 0xC4, 0x15, 0xDD, 0xD1, 0x90, 0x3F, 0x22, 0xEC, 0xFD, 0x2B, 0x32, 0x0D, 0x71, 0x3F,
+    0xF7, 0x15, 0x1A, 0x7A, 0xF7, 0xFF, 0x35, 0xF4, 0x6A, 0x0D, 0xFD, 0x2F, 0xAD, 0x56, 0xBD, 0xAE,
+    0xDD, 0x44, 0x10, 0x1E, 0x1F, 0x73, 0x63, 0x24, 0x17, 0x9B, 0x82, 0x08, 0xA1, 0x14, 0xA6, 0x44,
+    0x01, 0xC9, 0x6D, 0x1A, 0xB2, 0x86, 0x26, 0x6D, 0x0A, 0x0E, 0x0D, 0x45, 0x1A, 0xAA, 0x08, 0x89,
+    0x17, 0x08, 0xB2, 0x09, 0x0F, 0x90, 0xDB, 0x40, 0x9D, 0x82, 0x02, 0x6E, 0x0A, 0x78, 0x00, 0x84,
+    0x2D, 0xA5, 0xA4, 0xB1, 0xC8, 0x0B, 0x58, 0x22, 0x55, 0x9A, 0x2C, 0xC8, 0x91, 0x1C, 0xC9, 0xF6,
+    0xF0, 0x7D, 0xB3, 0x3E, 0xC9, 0xB9, 0x17, 0x11, 0x1A, 0x7C, 0xEC, 0x99, 0x95, 0x3D, 0xFB, 0xCD,
+    0xFF, 0xEC, 0x71, 0x53, 0x39, 0xBA, 0xC9, 0x87, 0x62, 0xC4, 0x13, 0xFC, 0x50, 0x06, 0xDF, 0x95,
+    0x43, 0xDD, 0xF9, 0xBE, 0x6E, 0x7C, 0xD7, 0x56, 0xBE, 0x69, 0xC5, 0x57, 0x2A, 0x22, 0xD9, 0x98,
+    0x07, 0x30, 0x17, 0x5C, 0x64, 0xC5, 0x00, 0x56, 0x0C, 0x65, 0x07, 0x56, 0xF6, 0x9E, 0xCC, 0x77,
+    0x75, 0x63, 0xAC, 0xAD, 0x24, 0xD9, 0xB7, 0xDF, 0xEA, 0x5E, 0x52, 0xE5, 0x55, 0x9D, 0x63, 0xB2,
+    0x7B, 0xB8, 0x3E, 0x5C, 0xCF, 0x44, 0xD2, 0x39, 0x9B, 0x84, 0x2C, 0x1F, 0xA9, 0x60, 0x22, 0xF2,
+    0xC9, 0xED, 0xE7, 0xB7, 0x9F, 0xDF, 0x12, 0x4F, 0xC1, 0xF1, 0x1C, 0x0B, 0x72, 0xAD, 0x7D, 0xDA,
+    0x3E, 0x7D, 0xB0, 0x29, 0x10, 0xA9, 0x1B, 0xDA, 0x25, 0xAD, 0x18, 0xD3, 0xDD, 0x0A, 0x9A, 0xAC,
+    0xE9, 0x0C, 0xB6, 0x5B, 0x8C, 0x6D, 0x0A, 0x70, 0xBD, 0x63, 0xF4, 0x86, 0xD1, 0xAF, 0x48, 0x2E,
+    0xAD, 0xB7, 0x20, 0xAD, 0x8A, 0x4D, 0x8E, 0xA6, 0x99, 0x0E, 0x80, 0xA9, 0x2E, 0xC0, 0xFA, 0x2B,
+    0x7C, 0x01, 0xFA, 0x98, 0x9E, 0xEA, 0x23, 0x3A, 0xAA, 0x7F, 0xF4, 0xA4, 0x4A, 0x37, 0x5B, 0xE5,
+    0x1B, 0xCF, 0xAD, 0x92, 0xDB, 0xAB, 0x84, 0xD6, 0x21, 0x0C, 0x4A, 0x3F, 0xCA, 0x96, 0xAA, 0x6F,
+    0x78, 0xD2, 0x0F, 0xCB, 0x59, 0xDE, 0x95, 0xBB, 0xA0, 0xBE, 0xFA, 0xA5, 0x8D, 0x8E, 0x04, 0xA3,
+    0xBD, 0xD1, 0x8A, 0x00, 0x34, 0xF1, 0xED, 0xE7, 0x34, 0x2A, 0x1D, 0x8E, 0x68, 0x2F, 0xFF, 0xB8,
+    0xEA, 0x89, 0x91, 0x97, 0x1D, 0x2D, 0xF5, 0x83, 0x64, 0x04, 0x68, 0x3B, 0x71, 0xAB, 0x76, 0x09,
+    0x5E, 0x95, 0x63, 0xDB, 0xA5, 0x0B, 0x3F, 0xD5, 0x9D, 0x83, 0x68, 0xDD, 0xB7, 0x5D, 0x09, 0xC3,
+    0xDA, 0xAE, 0xED, 0xEA, 0x8E, 0x5C, 0x3B, 0xEC, 0x10, 0x6D, 0xF4, 0x1E, 0x8D, 0xD7, 0xAF, 0xF5,
+    0xE6, 0x7C, 0x52, 0x89, 0x7E, 0xA3, 0x2E, 0xC0, 0x0C, 0xFD, 0x6D, 0xF1, 0x8F, 0x81, 0x5D, 0xEB,
+    0xDC, 0xDE, 0x07, 0xB6, 0xD7, 0x3F, 0xB5, 0x7C, 0xA1, 0x8D, 0xD3, 0x47, 0xB3, 0x1F, 0xB4, 0x49,
+    0x7E, 0x74, 0x63, 0xDD, 0x2B, 0x72, 0x5C, 0x0E, 0xC0, 0x02, 0xAF, 0x41, 0xC9, 0x95, 0x98, 0x95,
+    0x40, 0xB9, 0x7E, 0x04, 0x43, 0x72, 0x60, 0x7D, 0x0C, 0x5E, 0x04, 0xD1, 0x9B, 0x2B, 0x13, 0x26,
+    0xFA, 0x0C, 0xF1, 0xA0, 0xB9, 0x88, 0x11, 0x33, 0xE5, 0x11, 0xC4, 0x6C, 0x66, 0xF0, 0xAB, 0xE8,
+    0xDB, 0xAD, 0x23, 0x3F, 0x0B, 0x62, 0x32, 0xDC, 0x8C, 0x27, 0x8A, 0x86, 0xA1, 0x74, 0x96, 0x2B,
+    0xF8, 0xEA, 0x98, 0xEE, 0x72, 0xCA, 0x8C, 0x8D, 0x1B, 0xCB, 0x57, 0x7B, 0x59, 0x50, 0xB2, 0x98,
+    0xDB, 0x29, 0x6E, 0x18, 0x62, 0x86, 0x2A, 0x63, 0x93, 0xEC, 0xA9, 0x7E, 0xD8, 0x69, 0x07, 0xC8,
+    0x90, 0x6A, 0x05, 0x89, 0x39, 0x57, 0x29, 0xD7, 0x62, 0x75, 0x8B, 0xF8, 0xC9, 0x29, 0x02, 0xDC,
+    0x06, 0x7E, 0x05, 0x4B, 0x98, 0x24, 0xAE, 0x60, 0x0C, 0x00, 0x6B, 0x56, 0xC7, 0xFA, 0xA9, 0x85,
+    0x9E, 0xE5, 0xD8, 0x21, 0xDD, 0x96, 0x47, 0x28, 0x58, 0x20, 0x06, 0xF1, 0x53, 0x66, 0xFE, 0xC4,
+    0x1C, 0x71, 0x93, 0x9B, 0x8A, 0xB1, 0x08, 0x65, 0x28, 0x07, 0x8F, 0xEE, 0xF0, 0x8D, 0x87, 0x15,
+    0x9F, 0x5B, 0xBD, 0x76, 0x07, 0x02, 0xE0, 0xF7, 0x58, 0xBC, 0x9E, 0x85, 0xEC, 0xA7, 0x85, 0xA5,
+    0xB5, 0xDE, 0xF9, 0xB9, 0xB0, 0x22, 0xF9, 0x92, 0xA4, 0x34, 0x53, 0xF4, 0xE4, 0xC1, 0x4E, 0x51,
+    0xF2, 0x6E, 0x45, 0x20, 0xCB, 0xD9, 0xF7, 0x92, 0x01, 0x58, 0x92, 0xBE, 0x60, 0x7C, 0x1C, 0x0B,
+    0xE5, 0x0D, 0x22, 0xEF, 0x2D, 0x68, 0xAF, 0x27, 0xB1, 0xD0, 0xE7, 0x0B, 0xE4, 0x3F, 0xB7, 0x59,
+    0x5A, 0x52, 0x8B, 0xA4, 0x45, 0x5C, 0xDC, 0x6C, 0x89, 0xB2, 0xF6, 0xF2, 0xC1, 0xFC, 0xB2, 0xB2,
+    0xB5, 0x0E, 0xD9, 0x99, 0x60, 0x1A, 0x05, 0x17, 0x13, 0x9C, 0x5F, 0x09, 0xD6, 0xC7, 0x82, 0xCD,
+    0x4B, 0xC1, 0xFC, 0x58, 0x70, 0x34, 0xC1, 0xF0, 0x52, 0x30, 0x39, 0x16, 0x5C, 0x5F, 0x19, 0x50,
+    0x1E, 0x09, 0x5E, 0xB8, 0x3E, 0x20, 0x3E, 0x85, 0xD0, 0x7D, 0x50, 0x34, 0xB3, 0x3F, 0x9F, 0x60,
+    0xB1, 0x72, 0x31, 0x1C, 0x16, 0x08, 0x9E, 0x5F, 0xAC, 0x9D, 0x2B, 0xD6, 0xDD, 0x64, 0xCD, 0x8C,
+    0x97, 0x57, 0xAD, 0xDA, 0x58, 0xAD, 0x70, 0x98, 0x28, 0xF5, 0x7C, 0xC0, 0x33, 0x64, 0xF9, 0x97,
+    0x38, 0x9E, 0xBB, 0xAE, 0x9D, 0x9D, 0x9D, 0xFD, 0x70, 0x41, 0xE4, 0xCA, 0x7E, 0xBF, 0xFF, 0xC4,
+    0xBE, 0x5E, 0x37, 0x14, 0x9B, 0x98, 0x93, 0xE1, 0x35, 0xB1, 0x4C, 0xC5, 0x4A, 0x6E, 0x5B, 0xD6,
+    0x5C, 0x66, 0x71, 0x39, 0xD3, 0x38, 0xF3, 0x63, 0xDA, 0x7A, 0x1F, 0xE6, 0x99, 0xA1, 0xEC, 0xA6,
+    0xCD, 0x8F, 0xD3, 0x03, 0xF2, 0xE1, 0xBA, 0xF4, 0xEB, 0xF7, 0x62, 0xA1, 0x56, 0x8B, 0x61, 0x69,
+    0x13, 0x95, 0x5E, 0x3E, 0xE4, 0xCE, 0x5C, 0x4F, 0xF1, 0x34, 0x16, 0x24, 0x86, 0xDA, 0xB2, 0xE8,
+    0x87, 0x44, 0xAB, 0xE4, 0xAC, 0x2A, 0x42, 0xBA, 0x62, 0xC3, 0xE2, 0xC6, 0x6C, 0x4E, 0xD8, 0x2C,
+    0x13, 0x56, 0xE8, 0xE4, 0x6C, 0x2A, 0x82, 0x9B, 0x32, 0xFC, 0x50, 0xDD, 0x43, 0x3E, 0x66, 0x13,
+    0x46, 0x7F, 0xE7, 0x02, 0x79, 0xDB, 0xB8, 0x90, 0x8F, 0x1E, 0x83, 0xA6, 0x18, 0x5C, 0xC0, 0x80,
+    0x10, 0xDF, 0x17, 0xC6, 0x71, 0xAA, 0x0C, 0xE4, 0x0A, 0x59, 0x7C, 0xBF, 0xA7, 0xBF, 0x63, 0xC4,
+    0x74, 0x98, 0xB8, 0xB0, 0x03, 0x3D, 0xA2, 0xF7, 0xE1, 0x56, 0x19, 0xF2, 0x35, 0x85, 0x39, 0x6E,
+    0x8C, 0xC6, 0xC7, 0xA2, 0x60, 0xE6, 0x61, 0xFB, 0x65, 0x9A, 0xFD, 0x42, 0xAE, 0x06, 0x8B, 0x4B,
+    0x9C, 0xB9, 0xF9, 0xC6, 0xD9, 0x3A, 0x36, 0x49, 0x12, 0xEB, 0x02, 0xF4, 0xAF, 0x15, 0x2A, 0xBE,
+    0xE5, 0x64, 0x03, 0xC6, 0x01, 0x36, 0xF7, 0xE8, 0x21, 0x44, 0xA2, 0x93, 0x62, 0x31, 0x06, 0xAF,
+    0xD3, 0x03, 0x6B, 0x98, 0x86, 0x8C, 0x0D, 0x32, 0xDA, 0x9E, 0x7A, 0xE4, 0x1E, 0x02, 0x61, 0x0F,
+    0x81, 0x58, 0xC9, 0x00, 0x2A, 0xC8, 0x7A, 0xEE, 0x49, 0xB0, 0x15, 0x63, 0x9E, 0x40, 0xD8, 0x4A,
+    0x20, 0xEC, 0x21, 0x10, 0x18, 0x81, 0x36, 0x04, 0xB0, 0x62, 0xB5, 0xF4, 0x31, 0x43, 0x5E, 0xBF,
+    0x8B, 0x39, 0x34, 0xBB, 0x9D, 0x8D, 0x10, 0x3B, 0x26, 0xAD, 0x90, 0x6D, 0xE2, 0x49, 0x12, 0x0B,
+    0x84, 0x25, 0x9A, 0xDA, 0xB3, 0x00, 0x6F, 0x91, 0x7C, 0x8E, 0x65, 0xCF, 0xD9, 0xCE, 0xD6, 0xE7,
+    0xC3, 0xF9, 0xCE, 0xB6, 0xC2, 0x71, 0x80, 0x79, 0x1F, 0x07, 0x0B, 0x1F, 0x76, 0x0D, 0x2C, 0x41,
+    0x1E, 0x01, 0x13, 0x3B, 0x07, 0xB9, 0xE4, 0x84, 0x96, 0x0C, 0xCF, 0x45, 0x28, 0xC2, 0x18, 0x14,
+    0x1C, 0xE4, 0x53, 0xC3, 0xAA, 0x16, 0x18, 0x9C, 0x7D, 0x1D, 0x6F, 0x9C, 0x1F, 0x80, 0x87, 0x16,
+    0xDE, 0x81, 0xB2, 0x18, 0xEE, 0xD8, 0x89, 0x44, 0x01, 0x03, 0x50, 0xB9, 0xDD, 0xC0, 0xC6, 0x0D,
+    0x4D, 0xBC, 0x95, 0xAA, 0x13, 0x35, 0x23, 0x00, 0xC4, 0xBB, 0xDB, 0x4A, 0xD1, 0x5C, 0x16, 0xF3,
+    0xCE, 0x5C, 0x8B, 0x16, 0xC5, 0xA6, 0x8E, 0x84, 0x15, 0x6F, 0xF3, 0x8D, 0x66, 0xC5, 0xC9, 0x41,
+    0x1F, 0xCD, 0xC9, 0x48, 0xE2, 0x0C, 0xDD, 0x06, 0xA9, 0x29, 0x31, 0x57, 0xE3, 0x94, 0x88, 0x84,
+    0x3D, 0x9C, 0x5D, 0x40, 0xB7, 0xB3, 0x61, 0x3C, 0x46, 0x2F, 0x35, 0x1C, 0x5A, 0x88, 0xC9, 0xA8,
+    0xA3, 0x95, 0x49, 0xFC, 0x6F, 0x72, 0x28, 0x42, 0xA6, 0x10, 0xDF, 0xAD, 0xD2, 0xA8, 0xB2, 0x6D,
+    0x10, 0x4C, 0xCC, 0xE3, 0x7C, 0x06, 0x71, 0xA1, 0x64, 0x70, 0xF0, 0x9F, 0x88, 0x6D, 0x80, 0x29,
+    0x9B, 0x8F, 0xD0, 0x8D, 0x06, 0x41, 0x61, 0xCD, 0x50, 0x96, 0xCE, 0x25, 0x26, 0xCE, 0x72, 0x05,
+    0x26, 0xEE, 0x39, 0x14, 0xE2, 0xBF, 0x8D, 0x9A, 0x95, 0x7F, 0xE7, 0x01, 0x8B, 0x07, 0x63, 0x2F,
+    0xB7, 0xB8, 0x71, 0xD4, 0x5E, 0xA1, 0xFA, 0x9F, 0x2A, 0x16, 0x77, 0xB5, 0xE9, 0xAC, 0x4D, 0xE7,
+    0x8B, 0xCD, 0xE1, 0xD7, 0xFB, 0x6A, 0x6E, 0x72, 0xA4, 0x38, 0xFA, 0x55, 0x70, 0x43, 0x39, 0x1D,
+    0x8C, 0x7F, 0xDF, 0x86, 0x80, 0x76, 0xE7, 0x0F, 0xA2, 0x7F, 0x89, 0xE4, 0xA6, 0xA2, 0xE7, 0xCA,
+    0x66, 0x06, 0x23, 0xD6, 0x92, 0xF0, 0x1F, 0xDB, 0x5E, 0xDA, 0xEA, 0xFF, 0xF9, 0xDD, 0x01, 0xE0,
+    0xA9, 0x58, 0x9F, 0x15, 0x50, 0x4E, 0x93, 0xAF, 0xEA, 0xA1, 0x88, 0x5F, 0x15, 0x32, 0xFF, 0xE3,
+    0xBC, 0x2C, 0xE6, 0xED, 0xD9, 0x61, 0xA6, 0x8B, 0x35, 0xD4, 0x6C, 0x43, 0xDE, 0x61, 0x88, 0xB0,
+    0x43, 0x79, 0x82, 0xB0, 0x68, 0xAC, 0x27, 0xFA, 0x73, 0x3D, 0xC1, 0xD3, 0xE9, 0x33, 0x0E, 0x85,
+    0x35, 0xEE, 0x64, 0x94, 0x6C, 0x76, 0xBC, 0x65, 0xA7, 0xDB, 0x13, 0x79, 0x13, 0xD9, 0x39, 0xBD,
+    0x1B, 0x47, 0xF6, 0x33, 0x90, 0xEB, 0x38, 0x8C, 0xC7, 0xCB, 0x92, 0xB4, 0xCD, 0xDF, 0xDD, 0x5B,
+    0xBF, 0x8F, 0xDD, 0xD8, 0x75, 0xBE, 0x24, 0x2D, 0x71, 0x2D, 0x06, 0xA1, 0x0A, 0x4F, 0x23, 0x01,
+    0xCB, 0x36, 0x19, 0x20, 0xE0, 0x5F, 0xB0, 0x4B, 0x2E, 0x5C, 0xB8, 0x08, 0x82, 0x4C, 0x80, 0x99,
+    0x34, 0x29, 0xB6, 0x8E, 0x52, 0x4C, 0x9D, 0xC2, 0xCB, 0x17, 0xA7, 0x70, 0xE1, 0xC2, 0x2A, 0x02,
+    0x37, 0x5B, 0x78, 0x0A, 0x07, 0xD0, 0x8E, 0x10, 0xE8, 0x2F, 0xB0, 0xC8, 0xDD, 0x94, 0x29, 0xC2,
+    0x20, 0x30, 0xB6, 0x48, 0x61, 0x2E, 0x22, 0x25, 0x71, 0xB6, 0x10, 0x83, 0xD0, 0x31, 0x47, 0x22,
+    0x79, 0x72, 0xBE, 0xEF, 0x5C, 0xBE, 0xF7, 0x46, 0xB3, 0xBF, 0x62, 0x60, 0x37, 0x23, 0x8D, 0xE6,
+    0xDD, 0xFB, 0xF4, 0x86, 0xBC, 0x3C, 0xBF, 0xEE, 0xF9, 0xF1, 0xDD, 0xF3, 0x9C, 0x3B, 0x76, 0x2E,
+    0x9E, 0x9D, 0x4B, 0xC5, 0xB9, 0xCC, 0xBF, 0x52, 0xFD, 0x7F, 0x78, 0xE6, 0x2E, 0xFD, 0x14, 0x9D,
+    0xBD, 0xAA, 0xD6, 0xB9, 0xBA, 0x71, 0x4E, 0xEC, 0x15, 0xC8, 0xC6, 0x85, 0xFA, 0x8A, 0xA4, 0xD4,
+    0x97, 0x2E, 0xA5, 0xAF, 0x04, 0x4B, 0x2C, 0xF6, 0xCA, 0x74, 0xA9, 0x7C, 0xD2, 0x5B, 0xF1, 0x1A,
+    0xB7, 0xAB, 0xA5, 0x7A, 0xB7, 0xCB, 0x30, 0xE4, 0x0D, 0x6E, 0xD2, 0x2B, 0x0B, 0xD1, 0x65, 0x44,
+    0x44, 0x97, 0xD1, 0x21, 0x91, 0xF6, 0x0F, 0x48, 0x0B, 0xEF, 0xB6, 0x5B, 0xAB, 0x41, 0x87, 0xBA,
+    0xD7, 0x41, 0x38, 0x74, 0x97, 0x07, 0x7E, 0x36, 0xB8, 0x33, 0x57, 0xCB, 0xA3, 0x1E, 0xCB, 0xF5,
+    0xBA, 0x80, 0x0E, 0xB1, 0x88, 0xD2, 0x5C, 0xFD, 0x0A, 0xCB, 0xE0, 0xD9, 0x15, 0x86, 0xC7, 0x18,
+    0x8E, 0xF7, 0x19, 0xCC, 0x71, 0x55, 0x20, 0x32, 0x83, 0x01, 0x99, 0x20, 0x09, 0x19, 0x41, 0xD6,
+    0x9F, 0xF5, 0x7C, 0xFE, 0x6D, 0xFF, 0x6C, 0x7B, 0x90, 0x3D, 0xD3, 0xE1, 0x1E, 0xBD, 0x09, 0x8C,
+    0xFC, 0xA9, 0xFC, 0xE2, 0x08, 0xF7, 0x2B, 0x09, 0xA1, 0xE0, 0xB9, 0xBB, 0xB1, 0x33, 0x99, 0x98,
+    0x44, 0x4C, 0xBC, 0xBA, 0xFC, 0x44, 0xB1, 0x0E, 0x5C, 0x00, 0xCB, 0xA4, 0x7A, 0xE5, 0xA2, 0x64,
+    0xAC, 0xE3, 0x0C, 0x1E, 0xFC, 0x38, 0xB9, 0x37, 0x9C, 0xFE, 0xE6, 0xC1, 0xDF, 0xE4, 0xAE, 0x7E,
+    0x26, 0x75, 0x53, 0xE9, 0x87, 0x9B, 0x0C, 0x97, 0x26, 0xCB, 0xBB, 0x93, 0x4B, 0xFB, 0x70, 0x71,
+    0x59, 0xE7, 0xC4, 0xE5, 0xAD, 0x0E, 0x19, 0x87, 0x5E, 0x87, 0x74, 0x54, 0xE5, 0xA6, 0x58, 0x06,
+    0x4B, 0xAA, 0x68, 0x44, 0x9A, 0xE2, 0xFD, 0xB9, 0xDA, 0xFC, 0xAE, 0x73, 0x6F, 0x1A, 0xE3, 0x50,
+    0x5B, 0x35, 0x40, 0x81, 0xD2, 0xEB, 0x18, 0x4A, 0xA3, 0x0A, 0xD5, 0x37, 0xCA, 0x16, 0xE8, 0x95,
+    0x06, 0x94, 0x4A, 0x0B, 0x4A, 0xEB, 0xB6, 0x86, 0x09, 0x7C, 0x02, 0x86, 0x8B, 0xFF, 0xD6, 0x3B,
+    0x5C, 0xF1, 0x62, 0xA1, 0xEC, 0x26, 0x32, 0x30, 0x70, 0x24, 0xBB, 0xFA, 0x1C, 0x72, 0xB4, 0xF1,
+    0xA3, 0xD2, 0xB9, 0xE5, 0xFD, 0xC6, 0xBB, 0xCB, 0x09, 0x15, 0x6E, 0x6A, 0xD7, 0x8F, 0x2A, 0x4A,
+    0xDC, 0xA4, 0xE1, 0x0A, 0x0A, 0xB8, 0xE2, 0x48, 0x91, 0x9F, 0xB8, 0xBA, 0xFC, 0xFC, 0x7F, 0xF7,
+    0x2E, 0xD9, 0xE9, 0x97, 0x5F, 0x7B, 0xE7, 0x03, 0x07, 0xAD, 0x74, 0x20, 0x6C, 0x84, 0x58, 0xD4,
+    0x58, 0x86, 0xB0, 0x73, 0x15, 0x34, 0xCA, 0x81, 0xD6, 0x96, 0x83, 0x68, 0xB2, 0x94, 0x83, 0x4E,
+    0x79, 0x06, 0xD1, 0xA8, 0x70, 0xA2, 0x59, 0x45, 0x12, 0x4D, 0xBA, 0x09, 0xF4, 0x9D, 0x0E, 0x52,
+    0xE2, 0x0F, 0xBF, 0x51, 0x21, 0xD2, 0x5E, 0x72, 0x98, 0x47, 0x4C, 0x49, 0x54, 0x14, 0x8A, 0x1F,
+    0xCE, 0x30, 0x3C, 0x3E, 0xAA, 0x46, 0xE8, 0xA0, 0xC7, 0xD0, 0xE8, 0xB5, 0x33, 0x29, 0xF6, 0x06,
+    0xD8, 0xD4, 0x65, 0xD1, 0xC9, 0x46, 0xC5, 0xBB, 0x29, 0x5A, 0x29, 0xEF, 0x94, 0x7F, 0xBE, 0xC7,
+    0x57, 0x22, 0x17, 0x9C, 0x85, 0xD6, 0xAC, 0xD2, 0xFC, 0x93, 0x53, 0x52, 0xD9, 0xAA, 0xF5, 0x78,
+    0x7B, 0xD6, 0xAD, 0x14, 0xEA, 0xF2, 0x4F, 0x92, 0xDE, 0x45, 0x9D, 0xEE, 0xA9, 0x70, 0xD0, 0x7D,
+    0x96, 0x2D, 0xB3, 0x53, 0xFB, 0x28, 0x8B, 0xCD, 0xB7, 0xDC, 0xF7, 0x9D, 0x5A, 0x0F, 0xB7, 0x41,
+    0xE1, 0x40, 0x56, 0xEE, 0xDE, 0x0E, 0x30, 0x67, 0xEE, 0x2D, 0x9B, 0xCB, 0xB7, 0x82, 0xF1, 0xD2,
+    0xBC, 0xFE, 0xFD, 0x6D, 0x7F, 0x7D, 0xEE, 0x66, 0xDE, 0x9F, 0x95, 0x95, 0x2A, 0xFF, 0x3D, 0x5D,
+    0xBF, 0x78, 0xFA, 0x77, 0xFA, 0xB7, 0xB8, 0x4D, 0x65, 0xD6, 0x7B, 0xA2, 0x21, 0x90, 0x31, 0x56,
+    0x09, 0xE0, 0xB2, 0x0C, 0xDB, 0x4E, 0x85, 0x58, 0xEB, 0xA5, 0xE9, 0x85, 0xBB, 0x8B, 0xCF, 0xFC,
+    0x76, 0xF0, 0x42, 0xC5, 0xCF, 0x41, 0xB9, 0xB2, 0x58, 0x7D, 0xD4, 0x87, 0xF2, 0xA2, 0xD7, 0xFD,
+    0xDA, 0xA5, 0x43, 0xD1, 0xE6, 0x5D, 0xDE, 0x14, 0x0D, 0x5E, 0xC5, 0x46, 0xFF, 0x95, 0xD5, 0xA6,
+    0x2A, 0x8B, 0x46, 0x5C, 0xF1, 0xA9, 0x5A, 0xB9, 0x3C, 0x76, 0xC9, 0xF4, 0x73, 0xBB, 0x2F, 0x2C,
+    0xDD, 0x7D, 0x95, 0x48, 0xAB, 0xFC, 0xBA, 0x6C, 0x84, 0x9D, 0x55, 0x23, 0x5C, 0x87, 0xF4, 0xAA,
+    0x81, 0x48, 0x1A, 0x15, 0x77, 0x2A, 0xDF, 0x55, 0xB1, 0x15, 0x73, 0xAA, 0x36, 0x5B, 0x8F, 0x39,
+    0x2E, 0x19, 0xE0, 0x9A, 0x8A, 0x11, 0x26, 0x9E, 0x4F, 0x74, 0x59, 0x73, 0xA4, 0x2A, 0x4F, 0xA0,
+    0x63, 0xBD, 0x0B, 0x7B, 0x12, 0xBA, 0x55, 0xF9, 0x3E, 0x71, 0x7F, 0x79, 0xD9, 0x15, 0x62, 0x43,
+    0xBE, 0x34, 0x60, 0x1F, 0x7D, 0xE1, 0x10, 0x1C, 0xDF, 0x38, 0x39, 0xCE, 0x71, 0xB5, 0xFE, 0x8E,
+    0x85, 0x0C, 0x07, 0x27, 0x47, 0xFF, 0x77, 0xED, 0xE6, 0xCF, 0x37, 0xD4, 0x6E, 0x2E, 0x23, 0xB5,
+    0x0B, 0x29, 0x42, 0xBB, 0x79, 0x59, 0x53, 0xBB, 0x79, 0x59, 0x50, 0xBB, 0x98, 0x55, 0xBB, 0x9C,
+    0x55, 0xBB, 0x3A, 0x2F, 0xD0, 0x2A, 0x37, 0xAA, 0xCD, 0x1D, 0xB4, 0xEB, 0xF2, 0x87, 0x3D, 0xB5,
+    0x9B, 0x7F, 0x77, 0xA0, 0x76, 0xF3, 0x72, 0xA2, 0x76, 0xF3, 0xF2, 0x31, 0xB5, 0x8B, 0xFB, 0xA1,
+    0xDD, 0xBC, 0xCC, 0x3F, 0x84, 0x76, 0xF3, 0x32, 0xFD, 0xF8, 0xB7, 0xD4, 0x2E, 0xFC, 0x4F, 0x87,
+    0xA1, 0x85, 0xC0, 0x9A, 0xC3, 0xF3, 0xF3, 0xF3, 0x0D, 0x3E, 0x0F, 0xD4, 0xA5, 0x24, 0xBA, 0x11,
+    0xD4, 0x99, 0x95, 0xC5, 0x53, 0xF5, 0x6C, 0x9B, 0xBC, 0xA9, 0x74, 0xF5, 0xCA, 0xA5, 0x6D, 0x55,
+    0x66, 0x6D, 0xD1, 0x56, 0xCA, 0xA6, 0x6C, 0x74, 0xB7, 0xEA, 0xFA, 0x2A, 0x95, 0x3B, 0xE5, 0xBA,
+    0x69, 0xE4, 0x0B, 0x86, 0x83, 0x13, 0x39, 0x39, 0x7E, 0x49, 0x49, 0x87, 0xE7, 0x72, 0xFE, 0xE0,
+    0x8B, 0x6F, 0x73, 0xEE, 0xFC, 0x8B, 0xB4, 0xAC, 0x5C, 0x2A, 0x8F, 0xBA, 0xE9, 0xA5, 0x0B, 0x17,
+    0xF5, 0x4D, 0x6D, 0xAE, 0xD2, 0xC8, 0x11, 0x1A, 0x5B, 0x86, 0x43, 0x84, 0xBF, 0x6C, 0x84, 0xA3,
+    0xA4, 0x5B, 0x85, 0xB7, 0x43, 0x5C, 0x53, 0xF7, 0x56, 0xEA, 0x8E, 0x77, 0x27, 0x27, 0x4A, 0xF7,
+    0xDD, 0x85, 0x6B, 0xD0, 0x05, 0x5D, 0xC0, 0xCB, 0x65, 0x78, 0x75, 0x2A, 0x88, 0xC6, 0x55, 0x2A,
+    0xB6, 0x5A, 0xEF, 0x7F, 0x08, 0x52, 0x6A, 0x48, 0x77, 0x73, 0xDB, 0xC9, 0xE6, 0xBD, 0xF7, 0xA5,
+    0xAC, 0x54, 0xA4, 0x6A, 0x36, 0xEE, 0xE6, 0xB9, 0xF2, 0x7F, 0x7E, 0x16, 0x4A, 0xA7, 0xE6, 0xAA,
+    0x0F, 0xC8, 0x07, 0x57, 0x35, 0xEE, 0x00, 0x92, 0x3C, 0xC1, 0x2F, 0xAC, 0x36, 0xB6, 0x48, 0x9C,
+    0x58, 0x30, 0xF6, 0xB1, 0x18, 0xC4, 0xE8, 0x0B, 0xDE, 0x1C, 0xB7, 0x4D, 0x0C, 0x41, 0x98, 0xF4,
+    0x05, 0x8F, 0xA7, 0x2F, 0xF8, 0x5F, 0x7D, 0x81, 0x28, 0x7D, 0xC1, 0xF7, 0xEA, 0x0B, 0x1A, 0xAD,
+    0x7B, 0xC6, 0x28, 0x04, 0x08, 0x4E, 0x09, 0x43, 0xFF, 0x98, 0xEB, 0x04, 0x9D, 0x33, 0x01, 0x90,
+    0x99, 0x39, 0x80, 0x8C, 0x02, 0x1A, 0xAA, 0x8E, 0x34, 0xDC, 0x30, 0xEB, 0x76, 0xBB, 0xE8, 0xE7,
+    0xC3, 0x1F, 0x33, 0x83, 0x6D, 0x18, 0xB4, 0x28, 0xBF, 0x4D, 0x11, 0x2C, 0x0E, 0x68, 0xA0, 0xB8,
+    0x77, 0xAE, 0xEA, 0xA8, 0xD7, 0xAC, 0x40, 0x18, 0x4B, 0x84, 0x61, 0xBD, 0xA0, 0xE7, 0x2E, 0x18,
+    0xE7, 0x2F, 0x8F, 0xD5, 0xDE, 0x78, 0xF5, 0xAF, 0x76, 0x97, 0xAD, 0x90, 0x70, 0x0C, 0x39, 0xBA,
+    0x53, 0x8E, 0x2E, 0xFA, 0x1A, 0xC6, 0xB0, 0xCF, 0xDD, 0xCD, 0x2E, 0x9F, 0x2A, 0xFC, 0x1B, 0x8B,
+    0xFE, 0x46, 0x19, 0x8D, 0x2E, 0x1E, 0x99, 0x73, 0xA9, 0xE8, 0xEA, 0xE6, 0x1D, 0xD9, 0xA8, 0x85,
+    0xA8, 0x82, 0xEB, 0x27, 0xAA, 0xC6, 0x0F, 0x20, 0xA2, 0x7A, 0x8A, 0x65, 0xCA, 0xE9, 0x29, 0xF2,
+    0x1F, 0xF7, 0x6F, 0xA8, 0x8D, 0xA8, 0xA9, 0x69, 0x02, 0xA6, 0x86, 0xA6, 0xEA, 0x56, 0x53, 0x41,
+    0xB6, 0xA4, 0xBF, 0x25, 0xB6, 0x42, 0xAD, 0xEE, 0x7E, 0x52, 0x0F, 0x5C, 0x7C, 0x22, 0x55, 0x23,
+    0x75, 0xA9, 0x32, 0xD2, 0xDF, 0x45, 0xC2, 0x59, 0xA2, 0xA9, 0x7A, 0x36, 0x14, 0xEA, 0x51, 0xF5,
+    0x4A, 0x75, 0x38, 0xDF, 0x76, 0x37, 0x5D, 0xB0, 0xE8, 0xC6, 0x85, 0x87, 0x53, 0x3B, 0xDE, 0x48,
+    0xA7, 0x73, 0x05, 0x2D, 0xAB, 0xD0, 0xEB, 0x5E, 0xF5, 0x40, 0xCF, 0x58, 0x4C, 0xAA, 0x2D, 0x19,
+    0x8A, 0x29, 0x94, 0xB6, 0x1E, 0x12, 0xF9, 0x81, 0xB4, 0xD9, 0x12, 0x6B, 0x60, 0x9A, 0x32, 0xA5,
+    0xB2, 0xD7, 0x74, 0x2E, 0x6F, 0xD2, 0xDE, 0x25, 0x2E, 0x6C, 0xFC, 0x7E, 0x51, 0xB2, 0x61, 0xC5,
+    0x70, 0xBF, 0xA0, 0x71, 0x06, 0x6B, 0x91, 0x6E, 0x99, 0x50, 0xE8, 0x75, 0x62, 0x35, 0x32, 0xDD,
+    0xBD, 0xE9, 0xE0, 0xB2, 0x1F, 0x0F, 0x60, 0xE4, 0xDB, 0xFA, 0x16, 0x89, 0x64, 0xD6, 0xD3, 0xC5,
+    0xE5, 0x7D, 0xC4, 0xD0, 0xD2, 0x25, 0x30, 0x81, 0xA2, 0xCD, 0xFA, 0xF0, 0x5C, 0x39, 0x2D, 0x90,
+    0x83, 0xD4, 0x8D, 0x94, 0xB9, 0x8A, 0xE4, 0x23, 0x7D, 0xAB, 0xD1, 0xF7, 0x87, 0x53, 0xA0, 0x0B,
+    0x9E, 0xA4, 0x1A, 0x29, 0x90, 0x55, 0xB6, 0xE9, 0xA7, 0xD8, 0x71, 0x9B, 0xE2, 0x1F, 0x07, 0x78,
+    0x4B, 0x51, 0xB2, 0xA2, 0x39, 0x9C, 0x54, 0x62, 0x9A, 0xFC, 0x5C, 0x9C, 0xFE, 0x5A, 0x97, 0x4E,
+    0x90, 0x6A, 0x54, 0x4D, 0x8A, 0x49, 0xCA, 0x5B, 0xE7, 0xF2, 0x1F, 0x11, 0x6C, 0xB1, 0x6A, 0x92,
+    0xC9, 0xEF, 0x33, 0x73, 0x29, 0x9E, 0x87, 0x95, 0x09, 0xCF, 0x85, 0xF3, 0x6C, 0xAC, 0x7C, 0xAC,
+    0x8C, 0xAC, 0x9C, 0x6C, 0x59, 0x59, 0x79, 0x59, 0x99, 0xD1, 0x3F, 0xA6, 0x34, 0x68, 0x0D, 0x66,
+    0x3D, 0x1C, 0x64, 0xD5, 0x54, 0x1F, 0x21, 0xF0, 0x2B, 0x43, 0xDF, 0x83, 0xA7, 0xAF, 0xFF, 0x7E,
+    0xA1, 0x1B, 0x91, 0x1F, 0x4D, 0x74, 0x25, 0x27, 0xD9, 0x9E, 0x3B, 0xA1, 0x4B, 0xD9, 0xF0, 0x15,
+    0xFA, 0xCC, 0x1A, 0x0F, 0x87, 0x7B, 0x49, 0x99, 0x8B, 0xF1, 0x52, 0xB8, 0x19, 0x58, 0x04, 0xB7,
+    0x93, 0x30, 0x93, 0xDA, 0xE0, 0xE1, 0xBA, 0x69, 0x4A, 0x88, 0x12, 0x6E, 0x87, 0xDC, 0x79, 0xD7,
+    0x83, 0x8B, 0xE0, 0x7E, 0x54, 0x46, 0x96, 0x05, 0xE1, 0x22, 0xB8, 0x21, 0x3C, 0x1A, 0x43, 0x41,
+    0x46, 0x3A, 0x58, 0x16, 0x5C, 0x52, 0x48, 0x41, 0x2D, 0x7C, 0x34, 0x5C, 0x53, 0x8A, 0xCB, 0xD4,
+    0x3D, 0x81, 0x3A, 0x88, 0xCE, 0x84, 0x57, 0x7D, 0x28, 0xEE, 0xF0, 0x4C, 0x5D, 0xD5, 0x5F, 0xAB,
+    0x9A, 0xFA, 0xB7, 0x1F, 0xCA, 0x1F, 0x8F, 0xEA, 0xA0, 0x0A, 0x59, 0x72, 0x55, 0x92, 0x3A, 0xFC,
+    0xB1, 0x6A, 0x32, 0x69, 0xD4, 0x75, 0xA9, 0x8F, 0x47, 0xF2, 0xA8, 0xE2, 0x17, 0xDC, 0x99, 0x4C,
+    0xD1, 0x84, 0x39, 0xEB, 0x93, 0x9E, 0xE9, 0x64, 0x9B, 0xB7, 0xA0, 0x57, 0x5D, 0xE6, 0x4F, 0xE4,
+    0x08, 0x7C, 0x33, 0x5B, 0xD2, 0x87, 0x33, 0xB2, 0x28, 0xDF, 0xE7, 0x0F, 0x97, 0xFB, 0x14, 0x3A,
+    0x08, 0x82, 0xD0, 0x93, 0xC9, 0xFB, 0x0A, 0x64, 0xF3, 0x37, 0x07, 0x73, 0x2C, 0x05, 0x14, 0x38,
+    0x5B, 0xD9, 0x91, 0xE9, 0x67, 0x41, 0xB9, 0x8B, 0xB5, 0x87, 0xF7, 0xAD, 0x8A, 0xA1, 0xEF, 0x6A,
+    0xD4, 0x09, 0x94, 0xE0, 0x0F, 0xA1, 0x25, 0xD1, 0x47, 0xE4, 0xF8, 0xEF, 0x64, 0x89, 0x27, 0x7D,
+    0x5D, 0xEB, 0x6E, 0x4B, 0x7F, 0xB3, 0x57, 0x3A, 0x06, 0x64, 0xA9, 0xEA, 0x3F, 0x34, 0x5B, 0x90,
+    0xFB, 0xEE, 0xDE, 0xCF, 0xB0, 0xD8, 0x2D, 0x0B, 0x17, 0xB1, 0xF8, 0x54, 0xDA, 0x4C, 0x49, 0x6C,
+    0x53, 0x98, 0x8C, 0x4C, 0xB2, 0x4A, 0xC3, 0x5E, 0xBC, 0xD7, 0x1B, 0xF8, 0xB7, 0xD4, 0xC2, 0x65,
+    0x66, 0x35, 0x45, 0x61, 0x53, 0xE5, 0x2B, 0x8C, 0x67, 0x3D, 0x43, 0xEA, 0x4F, 0x7B, 0xAE, 0x0C,
+    0x36, 0xD4, 0x30, 0x39, 0xA5, 0x53, 0xC6, 0xF4, 0x60, 0xA4, 0x79, 0x15, 0x3D, 0xA7, 0xBA, 0x63,
+    0xAE, 0xA9, 0x59, 0xFB, 0x84, 0xDB, 0x36, 0x98, 0x34, 0x16, 0x60, 0x4A, 0x64, 0xAD, 0x68, 0xC4,
+    0x22, 0x92, 0xCF, 0xB9, 0x99, 0xD8, 0x3E, 0x3F, 0x7F, 0xB4, 0xB0, 0x04, 0x51, 0xAB, 0x8F, 0x2C,
+    0x86, 0xC5, 0x2A, 0x84, 0x58, 0xE8, 0x9F, 0x74, 0x82, 0x40, 0xD5, 0xCC, 0x8A, 0xC9, 0x6A, 0x05,
+    0xB0, 0x72, 0x7E, 0x66, 0xEC, 0x36, 0x7B, 0xEE, 0xDD, 0x7B, 0xF2, 0xA2, 0x33, 0x11, 0x98, 0x24,
+    0x2E, 0x95, 0x58, 0xAF, 0x36, 0xD3, 0x48, 0x1D, 0x50, 0xAB, 0xCD, 0xC6, 0x0A, 0x3F, 0xCC, 0x2E,
+    0xC8, 0x67, 0xA5, 0x39, 0x0A, 0x1E, 0x5F, 0x22, 0x1D, 0x08, 0x8E, 0x2F, 0xA9, 0xFA, 0xD5, 0x66,
+    0xFA, 0x88, 0x1A, 0x4C, 0x67, 0xD6, 0x03, 0x85, 0x7C, 0xCA, 0x12, 0x5C, 0x48, 0xF6, 0x72, 0xCA,
+    0x8A, 0x59, 0x37, 0x7A, 0xC9, 0x0B, 0x6F, 0xBF, 0x36, 0x9A, 0xF6, 0x18, 0x45, 0x47, 0x57, 0x98,
+    0xF7, 0x74, 0xED, 0x45, 0x2F, 0x7B, 0xFF, 0xBB, 0xB5, 0x39, 0x74, 0x57, 0x7E, 0x5E, 0x6D, 0xA6,
+    0x6F, 0x18, 0x13, 0x35, 0x53, 0xAF, 0x90, 0x15, 0x8D, 0x26, 0xFC, 0xC4, 0x49, 0xE2, 0xAE, 0xD8,
+    0x9B, 0xA2, 0x5F, 0x2F, 0x7B, 0x97, 0x78, 0x50, 0x64, 0xBD, 0xFD, 0x75, 0x90, 0x04, 0x16, 0x32,
+    0xCA, 0x8B, 0xED, 0x3B, 0xBC, 0xF1, 0x60, 0x8F, 0x10, 0xDB, 0x70, 0x96, 0x91, 0xF2, 0x5D, 0x22,
+    0x3E, 0xA7, 0xD5, 0xC5, 0xBC, 0x17, 0xD4, 0xF5, 0x7C, 0x4A, 0x8B, 0x6C, 0xC9, 0x03, 0x5F, 0x1A,
+    0x11, 0x47, 0x1F, 0x27, 0x9A, 0x6A, 0xF0, 0x92, 0x42, 0x61, 0x60, 0xE8, 0x09, 0x36, 0xD6, 0x68,
+    0xB9, 0x30, 0x61, 0x24, 0xD4, 0xB1, 0x4E, 0x6C, 0xB3, 0x89, 0x66, 0x16, 0x4F, 0x51, 0x31, 0x86,
+    0xEB, 0x43, 0xE1, 0x82, 0xFC, 0xBB, 0xD4, 0x52, 0x70, 0x5F, 0x64, 0x71, 0x3B, 0x6A, 0x04, 0x3C,
+    0x7F, 0x64, 0xEC, 0xE8, 0xFD, 0xE6, 0xA1, 0x03, 0x62, 0x1E, 0x28, 0xBB, 0x22, 0x0F, 0xCE, 0x58,
+    0xF4, 0xCB, 0x78, 0x77, 0xB6, 0x18, 0xE7, 0x25, 0x45, 0x91, 0xAF, 0xEB, 0xF0, 0xE7, 0x2E, 0xCB,
+    0x53, 0xCA, 0x22, 0x21, 0x41, 0x2C, 0xE6, 0x94, 0xDE, 0xFF, 0x94, 0x06, 0x0E, 0x31, 0xD6, 0x4C,
+    0xAF, 0xA3, 0x20, 0x1A, 0xE3, 0x04, 0xA2, 0x58, 0x4C, 0x0C, 0xBB, 0xB1, 0x22, 0xF3, 0xC6, 0x78,
+    0xBD, 0x43, 0x77, 0x56, 0x40, 0x6D, 0xEF, 0x13, 0x33, 0xC2, 0xCA, 0xEE, 0x5D, 0xE0, 0x5C, 0x72,
+    0x79, 0x7A, 0xDA, 0x92, 0xE6, 0x96, 0x8C, 0xB7, 0x54, 0x44, 0xCB, 0x4A, 0x13, 0x74, 0x9A, 0x49,
+    0x2E, 0x7B, 0x51, 0xA9, 0xEA, 0xB6, 0xD1, 0xE8, 0xB6, 0xA1, 0x3A, 0xFC, 0xBC, 0xA0, 0xA0, 0x72,
+    0x2B, 0xB7, 0x6F, 0x7D, 0xE0, 0xB6, 0xF4, 0x46, 0x5E, 0x46, 0x94, 0x23, 0x37, 0x39, 0xCA, 0x6F,
+    0x58, 0x76, 0xB9, 0x33, 0x6B, 0x3C, 0x32, 0xE1, 0x98, 0x6E, 0x11, 0xAE, 0x66, 0x15, 0xE0, 0xB4,
+    0x2B, 0x64, 0x3C, 0xDB, 0xFB, 0x0C, 0x0F, 0xDE, 0x8C, 0x46, 0xE7, 0xB5, 0x4B, 0x41, 0x06, 0x1E,
+    0x24, 0xFC, 0x85, 0xEA, 0x36, 0xF2, 0x66, 0xB5, 0xE1, 0x58, 0x6E, 0xD3, 0x0A, 0x8F, 0x1D, 0xCA,
+    0xAA, 0xEA, 0x8D, 0x7F, 0xA0, 0xE9, 0xC8, 0x46, 0x58, 0xEA, 0x5E, 0x68, 0x8E, 0xF6, 0x14, 0x61,
+    0x14, 0x99, 0x38, 0x4C, 0xA7, 0xC7, 0xEE, 0x55, 0xE2, 0x88, 0x71, 0xD7, 0xBC, 0x4D, 0x42, 0x58,
+    0x21, 0xBF, 0xC0, 0x52, 0x75, 0x5B, 0x03, 0xA7, 0x41, 0x0E, 0xAC, 0x11, 0x77, 0xAB, 0xA4, 0x57,
+    0x81, 0x23, 0x73, 0x15, 0x1D, 0xD0, 0x13, 0x0B, 0x2B, 0x7E, 0xEC, 0xB0, 0xEC, 0xAD, 0xF2, 0xF7,
+    0x5F, 0x0E, 0x2B, 0xD7, 0x9E, 0xA3, 0x7B, 0x67, 0xEB, 0x13, 0xF3, 0x71, 0xC5, 0x3C, 0x59, 0x61,
+    0x19, 0xA4, 0x72, 0xB0, 0xE3, 0x64, 0x60, 0xD1, 0x8D, 0x05, 0x39, 0xB4, 0x3E, 0x9F, 0x22, 0xD8,
+    0x5B, 0x5F, 0x42, 0xF5, 0x09, 0x38, 0x20, 0x41, 0xB7, 0x81, 0x04, 0x92, 0x3E, 0x92, 0x47, 0xEA,
+    0x48, 0x1C, 0x51, 0x05, 0xFA, 0x5F, 0x8A, 0xC2, 0x8E, 0x0B, 0x26, 0xEF, 0x3E, 0x12, 0x4F, 0x71,
+    0x0B, 0x52, 0x1B, 0x1B, 0xB6, 0x59, 0x7B, 0x31, 0x6F, 0x45, 0x14, 0x78, 0x21, 0x90, 0x59, 0xCA,
+    0xEF, 0xC6, 0xD1, 0xBE, 0x02, 0x06, 0x67, 0x74, 0x1B, 0xE1, 0x46, 0xF9, 0x9A, 0x0A, 0x56, 0xFB,
+    0xAE, 0xAC, 0xDB, 0x8E, 0x06, 0xEA, 0x93, 0x76, 0x3F, 0x7E, 0x89, 0x8C, 0xAF, 0x9C, 0x0D, 0xEC,
+    0x2B, 0xB5, 0x32, 0xF3, 0xC7, 0x0A, 0x64, 0xC7, 0xB3, 0xB2, 0x32, 0x74, 0x93, 0x58, 0x5A, 0xC6,
+    0x07, 0x33, 0xC0, 0x06, 0xF2, 0x4B, 0x65, 0x23, 0x5E, 0x70, 0xB4, 0x93, 0x0D, 0xA8, 0x4A, 0x75,
+    0x87, 0x1C, 0xBC, 0x42, 0x1C, 0x59, 0xE8, 0x8A, 0x26, 0x7D, 0xEA, 0xF7, 0x50, 0xA9, 0xFE, 0x21,
+    0x06, 0xD4, 0x7A, 0x0F, 0x2E, 0x9D, 0x4C, 0x5D, 0x13, 0x93, 0x8A, 0x45, 0xAB, 0x52, 0xFE, 0x6D,
+    0xF1, 0xDB, 0xA5, 0xB1, 0xA9, 0xB7, 0xA0, 0x4A, 0xB0, 0x8D, 0x74, 0x01, 0x6C, 0x5B, 0xB8, 0x1C,
+    0x1E, 0x55, 0x18, 0x08, 0x54, 0x0D, 0x7C, 0x7A, 0xCD, 0x48, 0x7D, 0x47, 0x9E, 0x9F, 0x25, 0x42,
+    0xA0, 0x4A, 0x27, 0xA0, 0x56, 0x29, 0xA7, 0x4E, 0x27, 0xCD, 0x6A, 0xDA, 0xD4, 0x12, 0x99, 0x7C,
+    0x26, 0x03, 0xC5, 0x44, 0x16, 0xB4, 0x32, 0x57, 0x26, 0x02, 0x0A, 0x43, 0xDF, 0x21, 0xD0, 0xBB,
+    0x53, 0xBA, 0x8A, 0x47, 0x22, 0x5B, 0x1A, 0x2C, 0x6C, 0xAF, 0xC1, 0xBD, 0x40, 0x19, 0x6B, 0x41,
+    0xA3, 0xB4, 0x98, 0x90, 0xCD, 0xA1, 0x45, 0x5E, 0xF9, 0x97, 0xDE, 0xAD, 0x11, 0x5F, 0xFF, 0x3C,
+    0x57, 0xA6, 0xF4, 0x21, 0x5E, 0xAB, 0x82, 0xCB, 0xC9, 0x3E, 0xC0, 0xC0, 0x92, 0xE5, 0x33, 0x68,
+    0x49, 0x95, 0x6B, 0xA2, 0x9F, 0x7E, 0xCE, 0x94, 0xAA, 0x78, 0x31, 0xF8, 0x24, 0x99, 0x6D, 0x36,
+    0x64, 0x74, 0xA6, 0xAB, 0x28, 0xFE, 0x5D, 0x28, 0xE8, 0xEA, 0x5F, 0x85, 0xFE, 0xA3, 0xFE, 0x67,
+    0x2D, 0xA4, 0xE0, 0xAA, 0x3E, 0x94, 0x06, 0x67, 0x41, 0xD2, 0x6C, 0xE7, 0xB6, 0x82, 0xF3, 0xDA,
+    0xD4, 0x7D, 0xDD, 0xA1, 0xDC, 0x2A, 0x7A, 0x02, 0xAD, 0x65, 0x31, 0x88, 0xC5, 0x82, 0xD1, 0x32,
+    0xBC, 0x6C, 0xC6, 0xBC, 0xA8, 0x22, 0x81, 0xE8, 0xCF, 0xD0, 0x4B, 0x89, 0x47, 0xB1, 0x6A, 0x4B,
+    0x21, 0x31, 0xA1, 0x6E, 0x43, 0xA8, 0x4B, 0x1F, 0x69, 0x9A, 0xC1, 0x23, 0x67, 0x3B, 0x7E, 0xAA,
+    0x27, 0xDB, 0x55, 0xE5, 0x5E, 0x55, 0x1F, 0x78, 0xC3, 0xAC, 0xAD, 0xAA, 0xCF, 0x2D, 0xEF, 0x4D,
+    0x86, 0xAB, 0xC5, 0xFD, 0x5D, 0xA6, 0x71, 0x81, 0x49, 0x39, 0xD9, 0xC9, 0x1C, 0xA8, 0x8D, 0x7C,
+    0x2A, 0xB0, 0xE9, 0x11, 0xD8, 0x12, 0x92, 0xA6, 0x0C, 0x30, 0x2D, 0x0E, 0xC9, 0x68, 0x08, 0xAA,
+    0x3C, 0xE4, 0x4D, 0x89, 0xE5, 0xA3, 0xBB, 0x09, 0xA9, 0x93, 0x4E, 0xF0, 0x55, 0xC8, 0x13, 0xFB,
+    0xED, 0xA4, 0x57, 0xC3, 0xC6, 0xD4, 0x18, 0x30, 0xE9, 0xD5, 0xF8, 0x10, 0x87, 0x4C, 0x03, 0x0F,
+    0x43, 0x79, 0x00, 0xD2, 0xC3, 0xE2, 0x52, 0x9E, 0x37, 0x3D, 0xAD, 0xA9, 0x1F, 0x9A, 0x69, 0x6C,
+    0x61, 0x61, 0x3D, 0x73, 0xC8, 0x6C, 0xEF, 0x6F, 0x8F, 0xA3, 0x3C, 0xC0, 0x11, 0x58, 0x5E, 0xB6,
+    0x96, 0xFA, 0x06, 0xE1, 0x66, 0xE3, 0x3E, 0xBE, 0x71, 0xE0, 0x5E, 0x37, 0xDE, 0x0F, 0x3F, 0xF0,
+    0xA7, 0x31, 0xC6, 0x3A, 0xF5, 0x9F, 0xCE, 0xBE, 0x0E, 0xE4, 0xF1, 0xA4, 0x16, 0x20, 0x03, 0x33,
+    0xA9, 0x7D, 0xC5, 0xBF, 0x16, 0xBC, 0x1F, 0x53, 0x9F, 0xBA, 0xA9, 0x1E, 0xD3, 0x93, 0x3D, 0x9F,
+    0xAD, 0xAC, 0xA0, 0x0F, 0x7C, 0x9F, 0xC6, 0xF0, 0x9E, 0x6D, 0x81, 0xEF, 0xB8, 0x6F, 0xBD, 0x76,
+    0x36, 0x6F, 0xD5, 0xD9, 0x98, 0x76, 0xCC, 0x62, 0xA8, 0xE9, 0x75, 0x1A, 0x59, 0x4A, 0x84, 0x67,
+    0xB7, 0x36, 0x57, 0x0A, 0xFF, 0x57, 0x9F, 0xF7, 0xC0, 0xA9, 0x32, 0x93, 0x8D, 0x7B, 0x13, 0xE9,
+    0x74, 0xB5, 0x29, 0xC6, 0x10, 0x87, 0xFF, 0x09, 0x8E, 0x5D, 0x1E, 0xE1, 0xF4, 0x9F, 0x0F, 0xB3,
+    0x98, 0xB6, 0x1E, 0x8D, 0x57, 0xCA, 0x4C, 0x80, 0x15, 0x63, 0xD1, 0x88, 0x94, 0x4D, 0xEA, 0x25,
+    0x55, 0x50, 0x7A, 0x9B, 0xC6, 0x44, 0x17, 0x39, 0xF7, 0x3B, 0x57, 0x01, 0x92, 0x5B, 0xF0, 0xA9,
+    0xB2, 0xA0, 0xEF, 0xA3, 0x22, 0x15, 0xA1, 0x95, 0xAB, 0x09, 0x4F, 0x75, 0x8C, 0x5C, 0x82, 0xCD,
+    0x19, 0x4E, 0x36, 0x06, 0x3C, 0x31, 0xD4, 0xAB, 0x78, 0xE0, 0x86, 0x33, 0xB7, 0x46, 0xAB, 0xE5,
+    0x44, 0x5D, 0xBB, 0x12, 0x91, 0xFD, 0x17, 0xBB, 0x13, 0x8A, 0x7F, 0x92, 0x46, 0x0B, 0x78, 0x79,
+    0x07, 0x5D, 0x0A, 0xE1, 0xA2, 0x54, 0xE7, 0x53, 0x32, 0x71, 0xCA, 0x7A, 0xA5, 0x28, 0x9F, 0x8A,
+    0x56, 0x6F, 0xCA, 0x27, 0xBD, 0x51, 0xC3, 0xC3, 0x82, 0x90, 0xC0, 0xF8, 0xA3, 0x92, 0x03, 0x2C,
+    0x01, 0x40, 0x5B, 0xDA, 0x90, 0x25, 0xF2, 0xD3, 0x53, 0x1E, 0xF9, 0x32, 0xC9, 0x4D, 0x0C, 0x44,
+    0xC8, 0x2C, 0x82, 0x17, 0x1F, 0xB3, 0xC8, 0x4C, 0x36, 0x3C, 0xCD, 0x0C, 0xB6, 0xEC, 0x98, 0x97,
+    0x48, 0xC5, 0xED, 0xEA, 0xC7, 0xB5, 0x80, 0xF4, 0x15, 0xA4, 0x2F, 0x21, 0xF7, 0x6A, 0x48, 0x46,
+    0xF9, 0x58, 0xB6, 0x65, 0xB9, 0x85, 0x6A, 0x64, 0x26, 0xE9, 0xC2, 0xB4, 0x24, 0x9B, 0x39, 0xE5,
+    0x93, 0x45, 0xF9, 0xC9, 0xA2, 0xFC, 0x48, 0xD4, 0xA2, 0xB0, 0x3C, 0x41, 0xD3, 0x85, 0xD4, 0xD2,
+    0x05, 0x36, 0x68, 0xF4, 0x8C, 0xA6, 0xB0, 0xAD, 0x99, 0x78, 0x75, 0x3E, 0x31, 0x56, 0x15, 0x13,
+    0x17, 0xD2, 0x5B, 0xB1, 0x90, 0xDE, 0x83, 0x85, 0x74, 0xC2, 0x42, 0x7E, 0x05, 0x9D, 0x60, 0x7E,
+    0x6A, 0x35, 0x04, 0xCB, 0xE5, 0x27, 0x6B, 0x92, 0x60, 0x19, 0x21, 0xEC, 0x24, 0xF2, 0x29, 0x7E,
+    0x45, 0x40, 0x02, 0xA5, 0x96, 0xFB, 0x0C, 0x08, 0xD8, 0xCB, 0xC0, 0x43, 0x1E, 0x95, 0x87, 0x80,
+    0xCB, 0x2B, 0x10, 0xF0, 0xEB, 0xC1, 0xBB, 0x21, 0xC1, 0x1E, 0x00, 0xB3, 0x9A, 0xD4, 0x17, 0xA5,
+    0x56, 0x95, 0xF2, 0xCC, 0xAB, 0x73, 0x97, 0xEA, 0xD2, 0xD7, 0x85, 0x77, 0x8F, 0x8D, 0xF6, 0x2B,
+    0x36, 0xDA, 0x7E, 0x25, 0x6C, 0xF4, 0x35, 0xD1, 0xFB, 0x19, 0xD5, 0xDE, 0x19, 0x6E, 0xB7, 0xAD,
+    0x6D, 0xF2, 0x61, 0xB7, 0xE1, 0x77, 0xB9, 0x50, 0x85, 0x02, 0xBB, 0xE5, 0xB3, 0x37, 0x96, 0xE6,
+    0x2B, 0x8D, 0x39, 0xCF, 0xDF, 0xD5, 0x5F, 0xA7, 0xB3, 0xF1, 0x10, 0x12, 0x99, 0xD4, 0x4B, 0xE0,
+    0x46, 0x79, 0x70, 0x9E, 0x13, 0x8F, 0x44, 0x13, 0x40, 0x28, 0x56, 0xC9, 0x51, 0xB8, 0x96, 0x84,
+    0x18, 0x5D, 0x96, 0x9D, 0x5A, 0x85, 0xFF, 0x19, 0xB5, 0x5A, 0xFB, 0x15, 0x6B, 0xB5, 0xCF, 0x2D,
+    0xD9, 0x32, 0xF9, 0x5B, 0x83, 0x41, 0x2D, 0x8E, 0x79, 0x50, 0xD5, 0x46, 0x88, 0xF3, 0x2E, 0x8E,
+    0x30, 0x7B, 0xBA, 0x66, 0xF6, 0x05, 0xE0, 0x0C, 0xD9, 0x8F, 0x01, 0xBC, 0xA9, 0x7A, 0x6D, 0x75,
+    0xD5, 0x70, 0xDA, 0xA7, 0x52, 0xDA, 0xC1, 0x7D, 0xC4, 0x02, 0x24, 0x5E, 0x21, 0xC4, 0x05, 0x51,
+    0xE9, 0xFC, 0x68, 0xFB, 0xC0, 0x79, 0xE7, 0x3D, 0xF2, 0x3D, 0x10, 0xC3, 0xF9, 0x76, 0x2D, 0x2B,
+    0xF4, 0x56, 0x48, 0x76, 0x5A, 0x01, 0x59, 0xF2, 0xB6, 0xD4, 0x56, 0xC6, 0xB5, 0x08, 0xAB, 0xD0,
+    0x0B, 0x5D, 0x12, 0x43, 0xD7, 0x86, 0xEB, 0xC7, 0x9C, 0x67, 0xEB, 0x26, 0x54, 0xE9, 0x33, 0xEE,
+    0xE5, 0x93, 0xF5, 0x68, 0x15, 0x53, 0x46, 0xB9, 0x14, 0xA3, 0xA1, 0x01, 0xC5, 0xE0, 0x51, 0xCA,
+    0xDE, 0xE6, 0xBA, 0x2F, 0x0C, 0xC7, 0xE8, 0x0D, 0x3E, 0x44, 0x15, 0x46, 0xA5, 0xB4, 0x91, 0x8C,
+    0x26, 0xDA, 0x7A, 0xB6, 0x19, 0x5D, 0x45, 0x78, 0x66, 0xBA, 0x37, 0xC7, 0xF2, 0x47, 0xD0, 0x39,
+    0x10, 0xE2, 0x17, 0xA0, 0x3B, 0x55, 0x25, 0xE3, 0xB9, 0xE9, 0x62, 0x05, 0x77, 0x3A, 0x9B, 0xFB,
+    0x50, 0x01, 0x30, 0xB6, 0xE4, 0x5B, 0xF4, 0xD8, 0xEF, 0x1B, 0x13, 0xC3, 0x43, 0x4B, 0xC2, 0x9D,
+    0x97, 0x81, 0x5B, 0x6B, 0xE4, 0x15, 0x4F, 0x42, 0xDB, 0x80, 0x37, 0xD1, 0xFB, 0x3B, 0x2C, 0xD5,
+    0xFA, 0xE8, 0x2C, 0x57, 0xB7, 0x53, 0xD2, 0x70, 0x7E, 0xC9, 0x23, 0x07, 0x8F, 0xCB, 0x13, 0xA8,
+    0xA2, 0x23, 0x98, 0xF3, 0x1C, 0x3D, 0x80, 0xA6, 0xAD, 0x45, 0x50, 0x46, 0xB6, 0x4C, 0x24, 0x70,
+    0xF6, 0x9E, 0xB2, 0x44, 0x33, 0xF3, 0x2D, 0x26, 0xDF, 0x32, 0xA2, 0x95, 0x93, 0x35, 0x8D, 0x54,
+    0xEC, 0x19, 0xA9, 0xD0, 0x40, 0xA0, 0x23, 0x70, 0xE6, 0x6A, 0x8C, 0xD8, 0x70, 0x95, 0x59, 0x9D,
+    0x4C, 0xB8, 0x6A, 0x61, 0x3D, 0x3A, 0xF2, 0x3C, 0x1B, 0x0F, 0xDC, 0x6E, 0x96, 0x3B, 0xE7, 0x3B,
+    0x9E, 0x49, 0xBA, 0x87, 0x63, 0x96, 0x3D, 0x38, 0xA6, 0xBC, 0x5E, 0x34, 0xDF, 0x22, 0xE0, 0x92,
+    0x93, 0xCE, 0x1A, 0x5A, 0x09, 0xE5, 0xA7, 0x80, 0x54, 0x66, 0x08, 0x3A, 0x47, 0x37, 0x26, 0x14,
+    0x7A, 0x7C, 0xAD, 0x68, 0xBE, 0x41, 0x29, 0x4A, 0x9B, 0xA1, 0x56, 0x5E, 0x6A, 0xCB, 0xBB, 0x54,
+    0xC0, 0xFF, 0x86, 0x1D, 0x91, 0x36, 0x70, 0x63, 0x37, 0x76, 0xD9, 0xCD, 0x35, 0xB1, 0x0D, 0xFE,
+    0x2C, 0xD1, 0x88, 0x3D, 0x65, 0x67, 0x3E, 0x1C, 0x17, 0x9A, 0xC5, 0x83, 0x97, 0xBB, 0x94, 0xAF,
+    0x07, 0xCD, 0x47, 0x3B, 0x87, 0x6A, 0x5E, 0xA3, 0x7A, 0x17, 0xDE, 0xF8, 0xE7, 0x71, 0xB7, 0x1D,
+    0xED, 0x13, 0xFB, 0xAB, 0xEF, 0x8B, 0x3A, 0xBA, 0x56, 0x5C, 0x80, 0x86, 0xBB, 0x17, 0x3C, 0xC3,
+    0x5B, 0x70, 0x61, 0xA5, 0x74, 0x20, 0x1E, 0xF1, 0xD0, 0x4B, 0x86, 0x08, 0xFF, 0x55, 0x5F, 0xA9,
+    0x6E, 0xBE, 0x40, 0x9A, 0x8D, 0xF0, 0x06, 0xFC, 0x05, 0xE9, 0x35, 0xA8, 0x40, 0xAC, 0xD3, 0x3C,
+    0x9C, 0x8D, 0x42, 0xEC, 0xF9, 0x1B, 0xF9, 0xC0, 0xB2, 0x40, 0x56, 0x8F, 0x6A, 0x48, 0x69, 0x93,
+    0x8B, 0xD2, 0x53, 0xC7, 0x60, 0xC6, 0x9D, 0x0F, 0x0A, 0xE9, 0x97, 0x67, 0xD4, 0x27, 0x6F, 0xDA,
+    0x09, 0x9C, 0x2C, 0x76, 0x26, 0x87, 0x6E, 0x67, 0x99, 0x38, 0x2B, 0xAD, 0x73, 0x2E, 0x4F, 0x48,
+    0xAD, 0xC5, 0xE7, 0xD3, 0x5F, 0xB1, 0xF6, 0xF2, 0xB0, 0x1C, 0x22, 0x15, 0x8D, 0x5C, 0xC5, 0x15,
+    0x40, 0x5A, 0xFE, 0x40, 0x6A, 0x87, 0xE5, 0xED, 0x5A, 0xCA, 0x5F, 0x1A, 0xEC, 0xAF, 0xF2, 0xCE,
+    0x00, 0xCA, 0x91, 0x33, 0x08, 0xD2, 0x08, 0x2B, 0xE6, 0xEE, 0xFB, 0x8C, 0x9E, 0xD9, 0x4F, 0x3D,
+    0xAC, 0x58, 0x77, 0xBC, 0x76, 0xFA, 0x26, 0xC2, 0xC2, 0xAD, 0x5F, 0x13, 0x04, 0xF3, 0xC7, 0xE4,
+    0x8C, 0xDE, 0xD8, 0x8E, 0x39, 0xA7, 0xAD, 0x2B, 0xDE, 0x3A, 0x88, 0xBF, 0xB8, 0x60, 0x88, 0x6B,
+    0xAC, 0x1F, 0x19, 0x95, 0x5A, 0x88, 0xEE, 0xAB, 0x18, 0x75, 0x0D, 0xB5, 0x8C, 0x9E, 0x2C, 0x95,
+    0x6A, 0xA0, 0x9F, 0x22, 0x88, 0x32, 0x14, 0x9B, 0x24, 0xE5, 0x79, 0x69, 0x59, 0x80, 0x51, 0x3F,
+    0x1A, 0xB2, 0x9D, 0x59, 0xC3, 0x77, 0xBA, 0xED, 0xA8, 0xD7, 0x0B, 0x9F, 0x6C, 0x73, 0x19, 0x02,
+    0x1C, 0x8C, 0x70, 0xF0, 0x5D, 0x8C, 0x94, 0xC9, 0xBC, 0xB6, 0xAA, 0xEC, 0x7C, 0xED, 0x37, 0x4B,
+    0xD5, 0xAD, 0xF3, 0xD2, 0x6F, 0x09, 0x61, 0x25, 0x76, 0xAA, 0x09, 0xD2, 0xA4, 0xFB, 0xBC, 0xE8,
+    0xA2, 0x19, 0x7A, 0x3E, 0xFE, 0xFF, 0x91, 0x15, 0x01, 0xD0, 0x78, 0x30, 0xCF, 0x13, 0x2F, 0x1A,
+    0x4F, 0xA3, 0x39, 0x1D, 0x5C, 0xF0, 0xB3, 0x9B, 0xF7, 0xF7, 0x5D, 0xCF, 0x37, 0x49, 0x55, 0xA0,
+    0xD1, 0x07, 0xED, 0x63, 0x1D, 0xAC, 0x4A, 0x25, 0x84, 0x0E, 0x63, 0x12, 0x7B, 0x70, 0xEC, 0xFB,
+    0x37, 0xD1, 0x54, 0xD6, 0xAF, 0x29, 0x19, 0xF2, 0xB1, 0x08, 0xFB, 0x61, 0x13, 0xB3, 0x0E, 0x4E,
+    0xC5, 0xF7, 0x83, 0x5A, 0x03, 0x68, 0x31, 0xAD, 0xBD, 0x9F, 0xEE, 0xF0, 0x01, 0x73, 0x8E, 0xC0,
+    0x23, 0xB9, 0x44, 0x6B, 0xFB, 0x9D, 0x45, 0xE8, 0xF2, 0xBC, 0xAE, 0xEA, 0x7D, 0x83, 0x54, 0x4F,
+    0x03, 0x0A, 0x08, 0xBA, 0x5B, 0x3B, 0x55, 0xC4, 0x7E, 0xB9, 0x0D, 0xED, 0x9F, 0x5D, 0xD5, 0xEB,
+    0x97, 0x41, 0x66, 0x43, 0xD3, 0xF7, 0xBF, 0x0C, 0xC2, 0x47, 0x42, 0xEB, 0x05, 0x77, 0xAC, 0xA6,
+    0x54, 0x55, 0x0F, 0x8D, 0xAB, 0xC2, 0xA7, 0xAD, 0xBE, 0xBF, 0x8E, 0x67, 0x62, 0xFF, 0x4D, 0x49,
+    0x1F, 0x6B, 0x14, 0x81, 0x42, 0xE3, 0x29, 0xEB, 0x2F, 0xA9, 0xF3, 0x6B, 0x79, 0xE6, 0x1B, 0xC4,
+    0xCB, 0xF2, 0xF2, 0xFB, 0x50, 0xEF, 0xFF, 0xB0, 0xC1, 0xD7, 0x8E, 0x33, 0x99, 0xD4, 0x65, 0x3E,
+    0xCB, 0xE7, 0x76, 0xC4, 0xF3, 0xC2, 0x91, 0x75, 0xC5, 0x7D, 0x3A, 0x18, 0xEF, 0x5C, 0x7E, 0x84,
+    0xC6, 0x34, 0x79, 0x31, 0x11, 0x38, 0x99, 0x3D, 0x4A, 0x91, 0xCA, 0x06, 0x5F, 0xEF, 0x58, 0xA8,
+    0x47, 0xFE, 0xAA, 0x19, 0x19, 0x32, 0xE4, 0xC7, 0xD1, 0x22, 0x80, 0x37, 0x0A, 0xF4, 0xF2, 0x22,
+    0x14, 0xC4, 0x76, 0x7A, 0x61, 0x0D, 0x00, 0xCB, 0x7A, 0x28, 0xE4, 0x98, 0x4E, 0xAF, 0xB0, 0x66,
+    0xC0, 0xA6, 0xD1, 0x6C, 0x8C, 0x80, 0x32, 0xB1, 0x57, 0xC3, 0xCE, 0xDE, 0x79, 0x20, 0x10, 0xF5,
+    0x40, 0xF5, 0x83, 0xBD, 0xC3, 0x80, 0x83, 0x92, 0xCD, 0x8B, 0x1F, 0x22, 0xD5, 0xAD, 0xFE, 0x01,
+    0x26, 0x5B, 0xFF, 0x52, 0x18, 0xBE, 0x1E, 0x01, 0xD1, 0x01, 0x46, 0xE4, 0x10, 0x3B, 0x36, 0x01,
+    0xBB, 0x97, 0x69, 0x96, 0x65, 0xE4, 0xC7, 0x0D, 0x5B, 0x33, 0x20, 0x4C, 0xEB, 0x59, 0xC6, 0x38,
+    0xE3, 0x8D, 0x6E, 0x1C, 0xB3, 0x55, 0x33, 0x57, 0x8B, 0x72, 0x66, 0xB1, 0x3A, 0x56, 0xF8, 0xFA,
+    0x06, 0xB5, 0x14, 0x30, 0x27, 0xB3, 0x33, 0xB0, 0x7E, 0x45, 0xE8, 0x99, 0x27, 0xB0, 0x03, 0x7F,
+    0xE7, 0x6C, 0x4F, 0x9F, 0x38, 0x3B, 0x12, 0x28, 0x84, 0xF0, 0x12, 0xDA, 0x9A, 0x9F, 0xCB, 0x98,
+    0x68, 0x2C, 0x63, 0x20, 0x43, 0x8F, 0x6B, 0x86, 0xFE, 0x8D, 0x6C, 0x06, 0x4E, 0x34, 0xE9, 0x53,
+    0x74, 0xD0, 0x78, 0x30, 0x51, 0xB2, 0x78, 0xE2, 0x48, 0x71, 0x16, 0x63, 0xA0, 0x21, 0x4E, 0x73,
+    0xF8, 0x96, 0x67, 0xA3, 0xEC, 0x2F, 0x8D, 0x88, 0xB2, 0x55, 0x90, 0xA2, 0x09, 0xF1, 0xAB, 0xBA,
+    0xB5, 0x6F, 0x96, 0xAA, 0xEF, 0x60, 0x53, 0xAB, 0x41, 0xE7, 0xE8, 0x85, 0x99, 0x6B, 0xD6, 0xBE,
+    0xE8, 0x00, 0xF9, 0x98, 0xE5, 0x70, 0x09, 0x01, 0xEE, 0x27, 0x83, 0xA4, 0xCE, 0xC8, 0x33, 0xFA,
+    0xEC, 0x20, 0x99, 0x14, 0x3A, 0x92, 0xE8, 0x2B, 0x5C, 0x12, 0xC9, 0x37, 0x33, 0x41, 0x36, 0x2A,
+    0x0B, 0x23, 0x08, 0xF5, 0x96, 0x49, 0x52, 0xBD, 0x41, 0x92, 0x58, 0x47, 0x6A, 0xFD, 0x01, 0xB3,
+    0x11, 0x62, 0x04, 0x1B, 0xC5, 0xFB, 0x20, 0x7B, 0x38, 0x27, 0x83, 0xA5, 0x7F, 0x9F, 0xEF, 0x8A,
+    0xBF, 0x69, 0x49, 0xFA, 0x73, 0x6E, 0x42, 0x7F, 0x7E, 0x28, 0xD7, 0xEF, 0x98, 0x7D, 0xC9, 0x97,
+    0x46, 0xF0, 0xF3, 0x7B, 0x57, 0x17, 0x30, 0xEC, 0xEC, 0xBD, 0x3D, 0x88, 0xF9, 0xE2, 0x2D, 0xEB,
+    0xFD, 0x31, 0x38, 0x77, 0xFD, 0xDE, 0x94, 0x66, 0x38, 0xCC, 0x85, 0x72, 0x96, 0xBB, 0x35, 0x36,
+    0x50, 0x80, 0xC6, 0x5F, 0x51, 0x2A, 0xCB, 0x74, 0x4E, 0x7F, 0x83, 0x3D, 0x54, 0x7C, 0xAC, 0xE3,
+    0x54, 0xFF, 0x10, 0xE7, 0x62, 0xC0, 0x74, 0x33, 0x41, 0x73, 0x77, 0x26, 0x7D, 0x06, 0xA5, 0xB5,
+    0x54, 0xDD, 0x5F, 0xE1, 0x8C, 0x8E, 0xD5, 0x79, 0xBC, 0xA7, 0x84, 0xE2, 0x19, 0x76, 0x53, 0x56,
+    0xC2, 0x44, 0x43, 0x2F, 0x7F, 0x6E, 0x32, 0x83, 0x14, 0x0C, 0x6A, 0xF0, 0x1D, 0x9F, 0xD6, 0xE5,
+    0x1A, 0x8F, 0x97, 0x73, 0xD9, 0xE0, 0xC4, 0xDD, 0x38, 0xB9, 0xB4, 0xAD, 0x2D, 0xF2, 0xF8, 0x0D,
+    0xCD, 0xEF, 0x21, 0x98, 0x8D, 0x5C, 0xDA, 0xD6, 0x96, 0xB9, 0x32, 0x8C, 0xD9, 0x37, 0x10, 0x6A,
+    0x0F, 0x34, 0x10, 0x74, 0xE8, 0xE0, 0xBA, 0x50, 0x89, 0xEB, 0x38, 0x40, 0x13, 0xEA, 0x48, 0x01,
+    0xF0, 0xC8, 0x05, 0x05, 0xF3, 0x09, 0x81, 0xF5, 0x77, 0x64, 0x6F, 0xCB, 0xDF, 0x7B, 0xB0, 0xAD,
+    0x2D, 0x8D, 0x74, 0x83, 0x3E, 0xCC, 0xB7, 0x1A, 0xFD, 0xBB, 0x82, 0xE3, 0x7A, 0xD0, 0x7C, 0xC8,
+    0xA2, 0xB8, 0x66, 0x1B, 0xB6, 0x9D, 0x31, 0x2F, 0xE8, 0x5A, 0xCE, 0x07, 0x08, 0xBA, 0x66, 0xE7,
+    0xFA, 0xC9, 0x1E, 0x1C, 0x7B, 0x3D, 0xE4, 0xBC, 0x3B, 0x3E, 0x49, 0x26, 0xB8, 0x5F, 0x3B, 0x3C,
+    0xB1, 0xF7, 0x57, 0x8E, 0x4E, 0xAE, 0x09, 0xCD, 0xBF, 0x1D, 0x92, 0x7D, 0x70, 0x04, 0xE2, 0x41,
+    0x0D, 0xCF, 0xF1, 0x07, 0xC2, 0x3C, 0x28, 0xBD, 0x26, 0x4E, 0xA8, 0x0D, 0x80, 0x35, 0xF5, 0x76,
+    0xF0, 0x8F, 0x93, 0x93, 0xC9, 0x00, 0xA9, 0x89, 0xA6, 0x97, 0x4E, 0xAC, 0xFA, 0x12, 0xEB, 0x17,
+    0x4C, 0x66, 0x26, 0x7D, 0xF1, 0xCC, 0xB8, 0x15, 0xCD, 0xF8, 0x96, 0xA5, 0x3A, 0xB9, 0xB5, 0xCD,
+    0xB0, 0xB4, 0xC9, 0x40, 0xE7, 0xD9, 0x4E, 0x19, 0x26, 0x9B, 0x06, 0xB7, 0xC3, 0x7B, 0x0C, 0xF3,
+    0x5B, 0x8F, 0xAB, 0x7D, 0x57, 0x76, 0xCE, 0xE2, 0xF2, 0x9E, 0x5D, 0x5F, 0xDB, 0xF5, 0xB5, 0x5D,
+    0x58, 0xDB, 0x15, 0xD5, 0x0A, 0x1E, 0x1D, 0x9E, 0x7D, 0x45, 0x40, 0x71, 0x6D, 0x19, 0xFA, 0xC1,
+    0x05, 0x01, 0x4B, 0x66, 0x41, 0xB5, 0xEF, 0x51, 0x42, 0x0F, 0xC6, 0x0B, 0x96, 0x4D, 0x8D, 0x26,
+    0x92, 0x99, 0xD0, 0xFD, 0xCF, 0x7B, 0x4A, 0x64, 0xD0, 0x2E, 0xFA, 0x4B, 0xD5, 0xA9, 0x6C, 0x13,
+    0x56, 0x8F, 0x2A, 0xC6, 0xEC, 0x2B, 0xCC, 0xF1, 0xCD, 0xCA, 0x1D, 0x7A, 0xA8, 0xA1, 0x93, 0x21,
+    0x27, 0xE1, 0x03, 0xA1, 0x8D, 0x4B, 0xDF, 0xAA, 0xDD, 0x43, 0x12, 0xB3, 0x2B, 0x48, 0xE2, 0x9A,
+    0xF6, 0xED, 0x7A, 0x7B, 0x37, 0x57, 0x7A, 0x7B, 0xAD, 0xFF, 0xEA, 0x33, 0xF1, 0xEB, 0xD7, 0x4E,
+    0xDB, 0xFF, 0x0B, 0xDD, 0x5C, 0xBF, 0x93, 0xDC, 0x56, 0x72, 0x7E, 0x98, 0xD1, 0x6A, 0xAA, 0x88,
+    0x2A, 0xE3, 0x82, 0xDB, 0xE0, 0xA8, 0x00, 0x0E, 0x9C, 0x98, 0x17, 0xE0, 0x4F, 0x00, 0x74, 0x0E,
+    0x9C, 0x32, 0xD8, 0x2D, 0x07, 0x0E, 0xA4, 0xC0, 0x11, 0x1D, 0x30, 0x71, 0xEA, 0xC2, 0xE8, 0xFE,
+    0x82, 0x4D, 0x74, 0xE5, 0xF2, 0x05, 0x62, 0xA0, 0x80, 0x9A, 0x0B, 0x36, 0x75, 0xE2, 0xC3, 0x48,
+    0x17, 0x2A, 0xF0, 0x58, 0x2A, 0xD5, 0x05, 0x17, 0x08, 0xA7, 0x1F, 0x56, 0x9D, 0x14, 0x10, 0x77,
+    0x35, 0xB2, 0x86, 0x2B, 0x00, 0xCF, 0xFD, 0x7D, 0xDD, 0x0F, 0xC0, 0x0C, 0x77, 0x49, 0x4A, 0x65,
+    0x51, 0x5C, 0xB2, 0xC8, 0xF7, 0x86, 0xBB, 0x18, 0xBC, 0x7E, 0xDD, 0xFD, 0xDE, 0xEB, 0xFE, 0xBA,
+    0xFB, 0x39, 0xE7, 0x8E, 0x4E, 0x4F, 0x0B, 0xE7, 0x5C, 0xEA, 0xFD, 0x5A, 0xBA, 0xCC, 0xFB, 0xA5,
+    0x74, 0xB9, 0x76, 0xC7, 0xA7, 0xA7, 0x6E, 0xFC, 0xB3, 0xF0, 0x1B, 0x74, 0x89, 0xAF, 0x1D, 0xBF,
+    0xD0, 0x38, 0x3E, 0xC9, 0xAE, 0xD4, 0xCE, 0x3F, 0x40, 0x37, 0xF3, 0x6F, 0xA1, 0x9B, 0xFB, 0x74,
+    0x2B, 0x5D, 0xDC, 0xB3, 0x4B, 0xDA, 0x74, 0x87, 0x01, 0x76, 0x09, 0xBA, 0xBC, 0x61, 0x57, 0xD5,
+    0x49, 0x8B, 0xAF, 0xAD, 0xD1, 0xCD, 0xFC, 0x12, 0xDD, 0xDC, 0x17, 0xE8, 0x62, 0xEF, 0x7D, 0x4B,
+    0xBA, 0x7C, 0x47, 0x82, 0xD0, 0x95, 0xD2, 0xF5, 0xF2, 0xFC, 0xC5, 0xEA, 0xBC, 0x77, 0x91, 0xD0,
+    0x13, 0xF7, 0xF2, 0xFC, 0x5A, 0x48, 0x93, 0xBF, 0x05, 0xBA, 0xC4, 0x83, 0x50, 0x97, 0x76, 0x78,
+    0x91, 0xCB, 0xF9, 0x3E, 0x19, 0xE1, 0xF4, 0xF4, 0x04, 0x03, 0x78, 0xFE, 0xDF, 0xEF, 0xD8, 0x0A,
+    0x55, 0xD1, 0xE9, 0xE9, 0xED, 0x30, 0xBD, 0xE8, 0xB7, 0x85, 0x70, 0x42, 0x66, 0x27, 0x2F, 0xCA,
+    0xFD, 0x85, 0xB4, 0x32, 0x98, 0x97, 0x07, 0x7B, 0x8F, 0xB7, 0x6F, 0xF2, 0x5E, 0x7E, 0x59, 0x64,
+    0x1D, 0x86, 0x48, 0x5B, 0x27, 0x1F, 0xA4, 0x95, 0x01, 0x32, 0x69, 0x77, 0x32, 0x2F, 0xB4, 0xF9,
+    0xD6, 0x95, 0xF2, 0xB7, 0x41, 0x5B, 0xA1, 0x8D, 0x84, 0x59, 0xE5, 0x6E, 0x2E, 0x94, 0xE6, 0x5D,
+    0x8A, 0xD6, 0x83, 0xCF, 0xA9, 0xBC, 0x73, 0x2D, 0xEF, 0xD9, 0x09, 0x97, 0x67, 0x1C, 0xD0, 0x1D,
+    0x1B, 0x15, 0xB9, 0x5B, 0x80, 0xBD, 0x65, 0x91, 0xA0, 0xCB, 0x3F, 0xAF, 0xD6, 0xA3, 0x38, 0x12,
+    0x8F, 0xA9, 0xC8, 0x37, 0xB6, 0x7C, 0xF4, 0x25, 0xF7, 0x62, 0x08, 0x67, 0x2E, 0x8C, 0x92, 0x76,
+    0xEB, 0xE4, 0xCB, 0xF3, 0xFE, 0xD7, 0x1D, 0x05, 0x05, 0x02, 0x3C, 0xE9, 0xCE, 0xC0, 0x1E, 0xE7,
+    0x0A, 0xF7, 0x7C, 0x09, 0xEA, 0x3A, 0xAF, 0x06, 0x19, 0x9F, 0x04, 0xBA, 0x72, 0xC9, 0x4E, 0x7F,
+    0x36, 0x6B, 0xD9, 0xCD, 0xAD, 0xEB, 0x5F, 0x67, 0xA7, 0x53, 0x99, 0x79, 0xFB, 0x42, 0xFD, 0xBC,
+    0x88, 0x41, 0xA9, 0xD5, 0x79, 0xE4, 0x58, 0x24, 0xAE, 0x2A, 0xC6, 0xB9, 0xF8, 0x7F, 0x63, 0xCB,
+    0x67, 0x4A, 0xB6, 0xE4, 0xF7, 0x40, 0xFB, 0xEA, 0x1E, 0xE7, 0x86, 0xEF, 0xC5, 0xFC, 0x46, 0xCA,
+    0x87, 0x72, 0x95, 0x1B, 0xB9, 0x72, 0x32, 0x3E, 0xFE, 0x8A, 0x7F, 0x48, 0x75, 0x14, 0xE2, 0x20,
+    0x88, 0x06, 0xDB, 0xA4, 0x7C, 0xAE, 0xFC, 0x97, 0x7E, 0x1D, 0x89, 0x24, 0x16, 0xCB, 0x39, 0xD5,
+    0x20, 0xE6, 0x0B, 0x13, 0x7D, 0x61, 0xCF, 0x17, 0xB6, 0x63, 0x5B, 0x92, 0x82, 0x92, 0x8B, 0xB7,
+    0x6A, 0xC6, 0xD6, 0x4F, 0x5A, 0xFB, 0xF9, 0x76, 0xA4, 0x5B, 0xD8, 0xE8, 0x6E, 0xCB, 0x80, 0x9F,
+    0xDF, 0xDD, 0x60, 0x03, 0x10, 0x9E, 0x2C, 0xD8, 0x46, 0x6C, 0xE5, 0x17, 0x3D, 0xA6, 0x6D, 0xFB,
+    0xF4, 0xEA, 0x6D, 0x88, 0xAA, 0xC6, 0xD4, 0x64, 0x0E, 0x49, 0x07, 0x15, 0xC3, 0xBB, 0x4A, 0xD0,
+    0x75, 0x3C, 0xCC, 0xE7, 0xEE, 0x9F, 0xA8, 0x51, 0x64, 0xEF, 0x1A, 0xF3, 0x12, 0xFA, 0xFB, 0xAA,
+    0x10, 0xA1, 0x45, 0x90, 0x99, 0x11, 0x9F, 0xB5, 0x81, 0xF4, 0x7C, 0x17, 0x08, 0x3F, 0x68, 0xF4,
+    0xB7, 0xFE, 0xD5, 0x2D, 0x38, 0xB2, 0x05, 0x7D, 0x5B, 0xDB, 0x59, 0x2B, 0x7F, 0x26, 0x6C, 0xD6,
+    0xCD, 0x75, 0x75, 0x9F, 0x1A, 0xD4, 0x91, 0x43, 0x60, 0x4E, 0xF6, 0x10, 0x83, 0x54, 0x1B, 0xD9,
+    0xDC, 0x66, 0xDE, 0x65, 0xB5, 0x8B, 0x4E, 0xDC, 0xD1, 0xED, 0xEB, 0xC6, 0xED, 0x5B, 0xEF, 0x90,
+    0x4C, 0x9E, 0x25, 0xB2, 0x10, 0x3A, 0x21, 0x27, 0x6F, 0xF2, 0x5A, 0xD4, 0x47, 0xB4, 0xF2, 0x24,
+    0x4C, 0xFE, 0x99, 0x73, 0xFB, 0xE5, 0x62, 0xD4, 0x64, 0x9D, 0xDA, 0x74, 0xB2, 0xF9, 0xD2, 0xED,
+    0xFF, 0xB9, 0x2E, 0xDC, 0xA6, 0x7E, 0x64, 0x03, 0x1B, 0x38, 0x60, 0x8E, 0xFF, 0xA6, 0x9B, 0xBD,
+    0xF9, 0x3C, 0x5B, 0x6E, 0xDF, 0x29, 0x66, 0xA2, 0xDC, 0xF9, 0x06, 0x9B, 0x7A, 0xDA, 0x54, 0x1B,
+    0x1E, 0xD2, 0x05, 0x36, 0xDD, 0x8E, 0x1B, 0x0C, 0xD9, 0x32, 0xDA, 0x18, 0xD7, 0x85, 0xDB, 0xB7,
+    0x96, 0xD1, 0xCA, 0x65, 0x4D, 0xDC, 0xBA, 0x64, 0x27, 0x9A, 0xB4, 0xC0, 0xF6, 0x3B, 0x87, 0xAA,
+    0x47, 0xDC, 0x52, 0xC7, 0x09, 0x3D, 0x5B, 0x6E, 0xDF, 0xB8, 0xE7, 0xEE, 0x88, 0xFE, 0x2E, 0xDA,
+    0x99, 0x27, 0x77, 0x79, 0x5C, 0x9A, 0x99, 0x20, 0xCF, 0xAD, 0xF5, 0x08, 0x56, 0x75, 0x39, 0x99,
+    0xDA, 0x46, 0xFD, 0x99, 0xEE, 0x3D, 0xBD, 0x5A, 0x51, 0x78, 0x32, 0x21, 0xFB, 0x79, 0xA2, 0xE2,
+    0x60, 0x6D, 0xC1, 0x7D, 0x9E, 0x4D, 0x3D, 0x89, 0x01, 0xEB, 0x85, 0x58, 0x74, 0x42, 0x1F, 0xCE,
+    0x08, 0x61, 0x28, 0x3A, 0x6F, 0x5D, 0x1D, 0x3A, 0x79, 0x04, 0x67, 0xAF, 0x74, 0x33, 0x1C, 0x52,
+    0x7A, 0x04, 0xCB, 0x69, 0x87, 0x2D, 0x58, 0x5E, 0x24, 0x07, 0xB8, 0xAB, 0x76, 0x38, 0x85, 0x23,
+    0xCF, 0x17, 0x2D, 0xF4, 0x3B, 0x77, 0x79, 0xA2, 0x9D, 0x83, 0xA9, 0x46, 0x83, 0xAA, 0x02, 0xBB,
+    0x82, 0x67, 0xFC, 0x99, 0xD1, 0x7F, 0xEB, 0xDE, 0xCD, 0x7B, 0x14, 0x63, 0x53, 0x9A, 0x68, 0x69,
+    0x15, 0xCA, 0xE0, 0x7A, 0x52, 0xF9, 0x0F, 0xA8, 0x21, 0x91, 0xFF, 0xB0, 0xD5, 0xFE, 0xBD, 0x7B,
+    0x7A, 0x66, 0xAF, 0x79, 0x4C, 0xFF, 0x9D, 0x19, 0x8F, 0x9F, 0xD2, 0x90, 0xCA, 0xFD, 0x37, 0x5E,
+    0xB9, 0xE6, 0x95, 0x89, 0x17, 0xEC, 0x17, 0x7E, 0x9D, 0x2B, 0x77, 0x70, 0x64, 0x3B, 0xCC, 0x83,
+    0x47, 0xA2, 0x70, 0x24, 0x35, 0xE9, 0x65, 0x3B, 0x15, 0x60, 0x66, 0x4B, 0x2F, 0x37, 0xE1, 0x71,
+    0xAB, 0xD1, 0x03, 0x9C, 0x3D, 0x15, 0xB8, 0xDC, 0xCD, 0x68, 0x20, 0xE5, 0x9D, 0xAA, 0xB2, 0x1E,
+    0xE4, 0x3A, 0x57, 0x3D, 0x75, 0xDB, 0x6A, 0x49, 0x22, 0x6B, 0xB5, 0xEF, 0x8E, 0x7F, 0x00, 0x61,
+    0xDD, 0xF4, 0x17, 0xF7, 0xA4, 0x13, 0x8E, 0x36, 0xD2, 0x09, 0x09, 0x4D, 0xC2, 0xAE, 0x96, 0x4E,
+    0x8C, 0xA7, 0xCD, 0x0F, 0x23, 0x2C, 0x35, 0x94, 0xD4, 0x5E, 0x22, 0x4F, 0x66, 0x2B, 0x7F, 0xC1,
+    0x99, 0xF1, 0xD9, 0x58, 0x19, 0x9F, 0xF8, 0x60, 0xCD, 0xAF, 0xD5, 0xCE, 0x5A, 0xC2, 0x2C, 0x99,
+    0x73, 0xCD, 0xF8, 0x0F, 0x3D, 0xAD, 0xC8, 0x6F, 0xB9, 0xE2, 0xBC, 0x9D, 0x31, 0x60, 0x88, 0x30,
+    0x33, 0xEF, 0xB8, 0x31, 0x60, 0x4D, 0xA5, 0xB4, 0xA9, 0x28, 0xA3, 0xDD, 0x20, 0x1A, 0x93, 0x8C,
+    0x09, 0x46, 0xCD, 0xAB, 0x20, 0x96, 0x5C, 0xA5, 0x62, 0x42, 0x31, 0x99, 0x98, 0x48, 0x4C, 0x22,
+    0x41, 0x20, 0x41, 0x1E, 0xEA, 0x1F, 0xAA, 0x5F, 0x98, 0x87, 0xB6, 0xD8, 0xF3, 0x0D, 0x75, 0x1B,
+    0x89, 0xD9, 0xAA, 0xC0, 0x12, 0x33, 0xDB, 0xF0, 0xBC, 0x5A, 0x56, 0xD9, 0x64, 0xFB, 0xCA, 0xA7,
+    0xDB, 0xD7, 0xD6, 0x94, 0x71, 0xC7, 0x76, 0xCB, 0xB6, 0xE1, 0xAC, 0x1B, 0xA1, 0xE5, 0x23, 0xD9,
+    0x6A, 0xD4, 0x4C, 0x23, 0x83, 0x28, 0x20, 0x9A, 0xB4, 0x83, 0xE1, 0x96, 0x58, 0xCB, 0xA1, 0xD8,
+    0xAA, 0x4C, 0xB4, 0xCD, 0x95, 0xCB, 0x11, 0xFC, 0xBF, 0xF9, 0xB0, 0xA7, 0x2C, 0x38, 0xC4, 0xE8,
+    0xFB, 0xFD, 0xF3, 0x43, 0x4E, 0x62, 0x4D, 0x4D, 0x21, 0x31, 0xE2, 0x63, 0xE5, 0xAD, 0xAC, 0x89,
+    0xB4, 0xA5, 0xF5, 0x2A, 0x8C, 0xCE, 0x77, 0x99, 0xA8, 0xDD, 0x16, 0x2F, 0xAC, 0xD1, 0x2C, 0x73,
+    0xD0, 0x5C, 0xFA, 0x8B, 0x42, 0x65, 0xAD, 0xBB, 0x18, 0x97, 0x86, 0x48, 0x85, 0xC3, 0xAB, 0x8C,
+    0xE7, 0x24, 0xA1, 0xF4, 0x9F, 0x39, 0x98, 0x39, 0x83, 0x8B, 0x97, 0xD3, 0xC3, 0x53, 0x07, 0x4F,
+    0xF9, 0xAA, 0xEE, 0x9D, 0x79, 0x77, 0x2F, 0xB9, 0xEB, 0xC3, 0xDD, 0x78, 0xE3, 0x3A, 0x17, 0x37,
+    0x62, 0x91, 0xC7, 0xFD, 0x5D, 0x2C, 0x22, 0xBE, 0x1C, 0x8A, 0x56, 0x62, 0x0D, 0x47, 0x83, 0xEB,
+    0xF6, 0x6C, 0xF9, 0x6C, 0x96, 0x50, 0xF9, 0xC8, 0xD1, 0xA8, 0x2E, 0xDB, 0xA1, 0x25, 0xF4, 0xFC,
+    0xF3, 0xD9, 0xB9, 0x7F, 0xC2, 0xD7, 0xFA, 0xF0, 0xBC, 0x36, 0xF8, 0xEF, 0x62, 0xB7, 0x37, 0x95,
+    0x67, 0xCA, 0xE7, 0x6B, 0xC0, 0xB7, 0x98, 0xC3, 0x64, 0x9B, 0xC1, 0x4B, 0x8C, 0x78, 0x60, 0xCE,
+    0x3A, 0xDD, 0x80, 0x4F, 0xC6, 0x65, 0xA7, 0x6D, 0xB6, 0x7D, 0xC6, 0xBC, 0x04, 0x14, 0x55, 0x82,
+    0xBC, 0x2A, 0x90, 0x35, 0xDF, 0x05, 0xB1, 0xC6, 0xDD, 0x6D, 0x43, 0x1B, 0xE6, 0x3C, 0x51, 0x61,
+    0x64, 0xBA, 0x95, 0xDA, 0x9D, 0x6B, 0xD8, 0x9D, 0xD9, 0x25, 0x76, 0x27, 0x27, 0x70, 0x5A, 0x5C,
+    0x1F, 0xDD, 0x56, 0xD3, 0x4E, 0x2D, 0x3B, 0x33, 0xEC, 0x3C, 0x0F, 0xCF, 0xCA, 0xCC, 0x87, 0x43,
+    0xA3, 0x0E, 0x72, 0x51, 0xC1, 0xA8, 0x64, 0x94, 0x42, 0xCA, 0xC6, 0x51, 0x38, 0x86, 0x3B, 0x50,
+    0x3C, 0x8E, 0xF2, 0xE1, 0x58, 0x35, 0xDB, 0xA5, 0xA3, 0x88, 0x54, 0x46, 0xB6, 0x45, 0xE8, 0x74,
+    0x75, 0xEA, 0x94, 0x93, 0x0A, 0xCA, 0x4E, 0x6A, 0x15, 0x95, 0xEA, 0x7D, 0xD8, 0x60, 0xDC, 0xAD,
+    0x95, 0x5A, 0x9E, 0x54, 0x20, 0x4C, 0x3F, 0xEE, 0x21, 0xC6, 0x6C, 0x9B, 0xC9, 0x1B, 0xAB, 0x75,
+    0xBC, 0x83, 0x3D, 0x3D, 0x38, 0x82, 0xEE, 0x65, 0x3E, 0x53, 0xC1, 0x80, 0x58, 0xD0, 0x8C, 0x48,
+    0xBD, 0x29, 0x4A, 0xD5, 0x44, 0x72, 0xBC, 0x47, 0xB5, 0xC2, 0x2D, 0xC1, 0xFA, 0x57, 0x60, 0xD6,
+    0xE8, 0x99, 0x5A, 0xFF, 0x32, 0xE1, 0x6A, 0x1B, 0xA1, 0x6D, 0x64, 0xDC, 0xBA, 0x6A, 0x84, 0xBA,
+    0x8D, 0x6F, 0xA2, 0x95, 0x5F, 0x53, 0x28, 0x6B, 0x61, 0x9D, 0x88, 0xA3, 0xC2, 0x79, 0xB7, 0x2C,
+    0x31, 0x5A, 0x21, 0xA6, 0x12, 0x4D, 0xA1, 0xCF, 0xCF, 0x55, 0xF7, 0x7A, 0x92, 0xD0, 0x91, 0x6F,
+    0x8A, 0x2C, 0x9D, 0x0D, 0x2A, 0x33, 0x5B, 0x9D, 0x71, 0x7C, 0x85, 0xDF, 0x08, 0x4D, 0xFD, 0x81,
+    0xD8, 0xD1, 0x2F, 0xC0, 0x0E, 0x19, 0xBE, 0x70, 0x47, 0xC5, 0x14, 0x4F, 0x38, 0x3B, 0x86, 0x12,
+    0xEC, 0xF2, 0x0D, 0xA0, 0x9A, 0x2A, 0xC0, 0x36, 0xDE, 0x57, 0xF0, 0x6A, 0xB6, 0x09, 0xBC, 0x82,
+    0x4D, 0xEC, 0x0B, 0xD1, 0x13, 0x51, 0x0C, 0xF9, 0xA0, 0xD0, 0x94, 0xD0, 0x23, 0xBB, 0x57, 0xDC,
+    0xA3, 0x4D, 0x3A, 0xB3, 0x66, 0xA4, 0xCD, 0xD8, 0xCA, 0x34, 0xC5, 0x79, 0xF0, 0x30, 0xEB, 0xFE,
+    0x5E, 0x3D, 0x02, 0xA1, 0x67, 0xC1, 0x76, 0xEE, 0xBB, 0xAA, 0x86, 0x71, 0xA5, 0x18, 0x9C, 0xDA,
+    0xB9, 0x83, 0x0E, 0xBE, 0x8E, 0x11, 0x5C, 0xF9, 0x66, 0xC5, 0xA5, 0x85, 0xC9, 0x95, 0x54, 0xDB,
+    0x92, 0xCA, 0xF2, 0xB2, 0xFA, 0x64, 0x2E, 0x59, 0x47, 0xF2, 0x9B, 0x64, 0x83, 0x85, 0x96, 0x5C,
+    0xDC, 0xDD, 0xD2, 0x30, 0x23, 0x72, 0xC2, 0x17, 0x55, 0x64, 0x78, 0x34, 0xEA, 0xDB, 0x35, 0x91,
+    0x9D, 0x4C, 0x2A, 0x5D, 0xBA, 0xA8, 0xE3, 0xF1, 0xE6, 0xFF, 0xDD, 0x73, 0xE9, 0xF6, 0x5C, 0x41,
+    0xDC, 0x4C, 0x94, 0x63, 0x3F, 0x71, 0xD7, 0x5A, 0x76, 0x2E, 0x3A, 0x9B, 0x60, 0x76, 0x8F, 0xB4,
+    0x49, 0x7D, 0x80, 0x71, 0x5C, 0x97, 0x75, 0xE7, 0x7E, 0xE6, 0x26, 0xDC, 0x98, 0xB6, 0xCB, 0xE1,
+    0xD0, 0xDA, 0xC3, 0x3A, 0xAE, 0xA3, 0xEC, 0xAE, 0x97, 0x44, 0x14, 0x2D, 0x56, 0x4F, 0x55, 0x8F,
+    0x37, 0x9E, 0xA7, 0xAA, 0x67, 0x3C, 0x30, 0x52, 0x6A, 0xDB, 0x91, 0x3D, 0x7E, 0xE3, 0x6C, 0x34,
+    0x35, 0x4A, 0xF5, 0xD2, 0x8B, 0xE1, 0x6B, 0xB1, 0xFA, 0xE9, 0x27, 0xD7, 0x5C, 0x82, 0x37, 0xC8,
+    0x0F, 0xE1, 0xE0, 0x66, 0x0C, 0x76, 0x44, 0xFE, 0x2D, 0x86, 0x37, 0x3A, 0xB2, 0x26, 0x6B, 0x88,
+    0xD0, 0x1C, 0x17, 0xEE, 0x74, 0x62, 0x5F, 0xD3, 0x37, 0x85, 0x4D, 0x20, 0xE7, 0x6D, 0xA2, 0x4E,
+    0x3A, 0xAC, 0x57, 0xD9, 0x75, 0x11, 0xA0, 0x40, 0xD7, 0x12, 0x4A, 0x91, 0x59, 0xC0, 0x2B, 0xCE,
+    0xAD, 0xDB, 0x91, 0xB6, 0x72, 0xAB, 0xDE, 0xF9, 0xD7, 0xA7, 0xFF, 0x68, 0xA1, 0x06, 0xEF, 0xA6,
+    0x5D, 0xAF, 0x9E, 0x72, 0x47, 0x93, 0x84, 0x5E, 0xC8, 0x1A, 0x2F, 0x9A, 0x38, 0xF6, 0x39, 0x1D,
+    0xFB, 0x80, 0x10, 0x5C, 0x45, 0x43, 0xB6, 0x4F, 0xC3, 0x4E, 0x1D, 0xF4, 0x19, 0x03, 0x06, 0x0B,
+    0xDA, 0x55, 0x29, 0x31, 0xB0, 0xF2, 0x8B, 0x1E, 0xB3, 0x7E, 0xC3, 0x63, 0xD2, 0x72, 0xD6, 0x03,
+    0xA0, 0x3C, 0x1A, 0x74, 0x66, 0xB6, 0x72, 0x87, 0x56, 0x10, 0x65, 0x4F, 0x48, 0x7E, 0xDF, 0xE0,
+    0x52, 0x7B, 0x63, 0x9B, 0xC1, 0x1B, 0xFC, 0x33, 0x79, 0xFE, 0x2D, 0xE6, 0x54, 0xD1, 0x3A, 0xF2,
+    0xFE, 0x5C, 0x26, 0xE0, 0x5B, 0x99, 0x86, 0xA8, 0x03, 0x5B, 0x59, 0x19, 0x4B, 0xA1, 0x69, 0x4E,
+    0xA5, 0x60, 0xBB, 0x64, 0xC0, 0x07, 0xE3, 0x98, 0x5E, 0x78, 0x8C, 0x03, 0x04, 0xA7, 0xA3, 0x76,
+    0x10, 0xC2, 0xC9, 0x42, 0xE4, 0x45, 0xC3, 0x2E, 0xD2, 0x0A, 0x07, 0x72, 0x45, 0x6D, 0x4C, 0x34,
+    0x81, 0x2F, 0x81, 0x31, 0xD1, 0x6B, 0xFE, 0xF4, 0xD4, 0x7F, 0x4D, 0xBB, 0x11, 0x6A, 0x69, 0xFD,
+    0x32, 0xD1, 0xBE, 0x38, 0x2A, 0xBB, 0xD3, 0x7F, 0xF0, 0x1F, 0xB9, 0x20, 0x22, 0x95, 0x11, 0xD6,
+    0xB5, 0x0A, 0x29, 0x88, 0x67, 0xAF, 0xEF, 0x5D, 0x10, 0x54, 0x90, 0x54, 0x10, 0x55, 0x90, 0x55,
+    0x10, 0x56, 0x90, 0x56, 0x00, 0x74, 0x02, 0x59, 0x2A, 0xB0, 0xC6, 0x05, 0x89, 0x05, 0x91, 0x05,
+    0x99, 0x29, 0x39, 0xEB, 0x41, 0x0A, 0xF1, 0x28, 0x85, 0xE8, 0xDC, 0x8B, 0xEE, 0xCE, 0xB9, 0xC6,
+    0x16, 0x34, 0x03, 0x63, 0x03, 0x70, 0x54, 0x16, 0x6A, 0x01, 0x36, 0x37, 0x65, 0x11, 0x97, 0x7F,
+    0x81, 0xBA, 0x57, 0x5F, 0x31, 0xC2, 0x36, 0x68, 0x99, 0x48, 0x44, 0x4C, 0xFF, 0x22, 0xF2, 0x0D,
+    0xA5, 0x50, 0x3F, 0x22, 0x85, 0xE2, 0xFB, 0x4B, 0xC1, 0x1D, 0x51, 0x81, 0xAA, 0x3A, 0x05, 0xD8,
+    0xDA, 0x57, 0x4B, 0x92, 0x28, 0xD3, 0xFD, 0x1F, 0x30, 0x2B, 0x59, 0xC3, 0x2B, 0x39, 0x9A, 0x98,
+    0x24, 0x0B, 0xAE, 0xCD, 0x98, 0xC6, 0x6F, 0x12, 0xDA, 0x0D, 0xD8, 0xDB, 0x8D, 0x7E, 0x6F, 0x35,
+    0xF1, 0x78, 0xD9, 0x92, 0x53, 0x86, 0x3A, 0xCD, 0x9E, 0xC6, 0x6E, 0xBF, 0x4A, 0x6F, 0xC7, 0xD8,
+    0x5A, 0xCC, 0xCD, 0x3C, 0xE3, 0xE0, 0xC4, 0x81, 0xAD, 0x75, 0x3F, 0x05, 0xBD, 0x7E, 0x93, 0xCB,
+    0xAE, 0xF5, 0x90, 0x7B, 0xAD, 0x30, 0xE3, 0xF7, 0xA2, 0xE2, 0x59, 0x51, 0xD6, 0x62, 0x3E, 0x0E,
+    0x53, 0x39, 0x3E, 0x09, 0xCC, 0x27, 0xD1, 0xA4, 0x99, 0xBB, 0x0A, 0x28, 0x8E, 0x74, 0x4E, 0x6B,
+    0x23, 0x97, 0xD4, 0xB2, 0x59, 0x28, 0x9A, 0xB6, 0xE7, 0x08, 0x93, 0xCE, 0x00, 0x5C, 0x4E, 0x31,
+    0x67, 0x15, 0x2D, 0xF3, 0x00, 0x22, 0xEC, 0x6C, 0x33, 0x6B, 0x60, 0xA1, 0x07, 0x1C, 0x88, 0x0C,
+    0x25, 0x3F, 0x13, 0x6B, 0x36, 0xC6, 0xCC, 0x09, 0x59, 0xF5, 0x94, 0xAC, 0xD9, 0x21, 0x59, 0x85,
+    0xB1, 0xF0, 0x29, 0xC8, 0x2A, 0x5B, 0xE3, 0x5C, 0x36, 0xE0, 0xE7, 0x6C, 0x80, 0x4B, 0x01, 0xA5,
+    0x02, 0x48, 0x85, 0x7F, 0xD1, 0xA9, 0x1D, 0x45, 0xE0, 0x12, 0x91, 0xBD, 0x46, 0x69, 0xA1, 0xD3,
+    0x53, 0x93, 0x10, 0xB0, 0x67, 0x46, 0x8C, 0x7E, 0xC9, 0x7F, 0x60, 0x4D, 0xEC, 0x95, 0x02, 0x10,
+    0x80, 0xF1, 0x0D, 0x29, 0xE4, 0xE0, 0xF9, 0xCE, 0x38, 0x62, 0xB1, 0xF7, 0x9D, 0xA3, 0x87, 0x63,
+    0xB1, 0xF7, 0x76, 0x12, 0x7B, 0x5F, 0xEE, 0xC7, 0xDE, 0x9F, 0x7B, 0x9D, 0x8B, 0x6B, 0xF7, 0x9F,
+    0x71, 0x13, 0x75, 0x8B, 0xFE, 0x6E, 0x0B, 0x2E, 0x46, 0x78, 0x02, 0x30, 0x54, 0x40, 0xA1, 0x7E,
+    0x08, 0x2E, 0x3E, 0x1F, 0x8A, 0xE3, 0xE2, 0x26, 0xC4, 0xC2, 0xFD, 0x00, 0x23, 0xB4, 0x21, 0x94,
+    0x4F, 0x7B, 0x2A, 0xA2, 0x54, 0x0D, 0x9B, 0x0E, 0x10, 0x19, 0x62, 0xFA, 0x7E, 0xE4, 0x44, 0x48,
+    0x0A, 0xA0, 0xA9, 0x22, 0xAA, 0x37, 0xD7, 0x54, 0x82, 0x3D, 0x4E, 0xA4, 0x53, 0x4E, 0x28, 0xF4,
+    0xCC, 0x9D, 0x7A, 0xC2, 0x50, 0xB7, 0xC7, 0xD0, 0xC0, 0x54, 0x19, 0xAE, 0x57, 0x5C, 0x03, 0x66,
+    0x13, 0x68, 0xC5, 0xBF, 0xF2, 0x23, 0xF5, 0xF0, 0x33, 0x1F, 0x6C, 0xA4, 0x01, 0xED, 0x9A, 0x6B,
+    0x70, 0x02, 0xAE, 0xF5, 0xB0, 0xDC, 0x15, 0xB7, 0xD9, 0x53, 0xC9, 0x1F, 0x9F, 0xF9, 0xA2, 0x57,
+    0x39, 0xB1, 0x76, 0x19, 0x10, 0x40, 0x51, 0x2D, 0x43, 0xC9, 0xFC, 0x79, 0x52, 0x2F, 0x79, 0x3A,
+    0xE0, 0x68, 0x48, 0x7C, 0x30, 0xD9, 0xF4, 0x20, 0x68, 0xED, 0x20, 0xE0, 0x2C, 0xC0, 0x2E, 0x4C,
+    0x64, 0xAE, 0xF8, 0x0C, 0x8E, 0x18, 0x4E, 0x07, 0x7A, 0xC8, 0xE0, 0xA0, 0xD7, 0x49, 0x91, 0xCC,
+    0x4A, 0xED, 0x17, 0x46, 0xA0, 0x7A, 0x37, 0x58, 0x30, 0x66, 0xBB, 0x04, 0x03, 0x2A, 0x18, 0x31,
+    0x7A, 0xB6, 0x6E, 0x75, 0xB2, 0xE5, 0x56, 0xE7, 0x0B, 0xD6, 0x58, 0x48, 0x8B, 0xEF, 0x02, 0x83,
+    0x12, 0xCD, 0x24, 0x01, 0x89, 0xDC, 0x73, 0x53, 0x3B, 0x53, 0x33, 0xB5, 0xA8, 0xD4, 0x96, 0x5A,
+    0x92, 0x0F, 0xBA, 0x3C, 0xFC, 0x32, 0xF6, 0xBA, 0x10, 0x19, 0x85, 0x11, 0x5E, 0x80, 0x9C, 0xD0,
+    0x73, 0xED, 0x9A, 0xB8, 0x74, 0xF5, 0xCA, 0x6B, 0x77, 0xBA, 0xDE, 0x15, 0x8C, 0x55, 0xAF, 0x3B,
+    0x2C, 0x68, 0xF4, 0xBD, 0x79, 0x08, 0x67, 0xA6, 0x04, 0xE2, 0xEC, 0x2D, 0x84, 0x67, 0x04, 0x74,
+    0x34, 0x9D, 0x04, 0x21, 0x9F, 0x1E, 0x24, 0x89, 0x22, 0xC5, 0xFB, 0xCE, 0x9E, 0x88, 0x41, 0xB6,
+    0xF3, 0x9C, 0xE1, 0x0E, 0x61, 0x95, 0x4C, 0x05, 0x0E, 0xC5, 0x46, 0xE6, 0x88, 0x69, 0xF8, 0x7A,
+    0x06, 0xBB, 0x7A, 0x43, 0x43, 0x0A, 0xC7, 0xF6, 0x8C, 0x76, 0xF5, 0x9C, 0x93, 0x98, 0xC3, 0xB2,
+    0xC1, 0xAC, 0xC6, 0xC3, 0x9B, 0x08, 0x92, 0x0E, 0x95, 0x10, 0x47, 0x4A, 0x35, 0x79, 0xA5, 0x65,
+    0x78, 0xA5, 0x05, 0x07, 0xE5, 0xBF, 0x55, 0x63, 0x03, 0x3A, 0x6A, 0xFD, 0xFE, 0x7E, 0xB7, 0xA0,
+    0xE9, 0x7C, 0x6E, 0x91, 0x1F, 0x4E, 0x50, 0x13, 0x21, 0xB6, 0x41, 0xB1, 0xE5, 0xCF, 0xCD, 0x95,
+    0x86, 0x2E, 0xB9, 0x76, 0x15, 0xEA, 0xA3, 0x1D, 0xD6, 0x22, 0x2F, 0x28, 0xAF, 0xB1, 0x8A, 0x8F,
+    0xA7, 0x19, 0x29, 0xC1, 0x68, 0x3C, 0x0C, 0x03, 0x4F, 0xF0, 0xED, 0xC8, 0x28, 0x99, 0xEE, 0xB9,
+    0xE3, 0xCE, 0xCB, 0xB3, 0xF3, 0xEA, 0x3D, 0xB7, 0x7B, 0x1C, 0x20, 0x58, 0x36, 0x8F, 0x19, 0x70,
+    0x3A, 0x54, 0xCC, 0xA1, 0x32, 0xB3, 0xFC, 0xD8, 0xEA, 0xD1, 0xB2, 0x0D, 0xD3, 0x74, 0xE7, 0x0F,
+    0x83, 0xBD, 0x3C, 0x22, 0x4E, 0xB9, 0xFE, 0xFE, 0x63, 0x5A, 0x82, 0xF3, 0x5E, 0x11, 0x27, 0xB7,
+    0x8F, 0x38, 0x1D, 0x9D, 0x3E, 0x99, 0xDA, 0xFC, 0x71, 0xD4, 0xBA, 0x4B, 0xD8, 0xB3, 0xBC, 0x94,
+    0x3D, 0xF1, 0x53, 0x1C, 0x49, 0x15, 0x06, 0xFC, 0x8D, 0x9A, 0x2C, 0xBA, 0xD7, 0x98, 0x28, 0x47,
+    0x00, 0x55, 0x83, 0x8A, 0x5C, 0xBC, 0xC0, 0x71, 0xB1, 0x0B, 0x60, 0x79, 0xF7, 0x8C, 0x61, 0xCA,
+    0x14, 0x2A, 0x06, 0x36, 0x99, 0x67, 0x95, 0xB5, 0x0B, 0x35, 0x63, 0xE9, 0xF7, 0xE6, 0xDB, 0x5C,
+    0x37, 0x33, 0x05, 0xE2, 0xFE, 0xA2, 0xEF, 0xFF, 0x46, 0x07, 0x78, 0x60, 0xB1, 0x5C, 0xC6, 0x59,
+    0xBC, 0x05, 0x90, 0xBC, 0xEE, 0x6A, 0xDF, 0xE8, 0x0E, 0xF7, 0x4B, 0xD5, 0xA7, 0x57, 0xF1, 0x3D,
+    0xA1, 0xC1, 0xEB, 0xA2, 0x07, 0x51, 0x32, 0x38, 0xB6, 0x33, 0x68, 0xB6, 0x06, 0x13, 0xB3, 0x9E,
+    0xD3, 0x82, 0x42, 0xB0, 0x33, 0x9F, 0xE9, 0x30, 0x65, 0xC4, 0x1C, 0x62, 0x3B, 0xBE, 0x43, 0x4A,
+    0x59, 0xAC, 0xCB, 0x5B, 0x9D, 0xE2, 0x90, 0x95, 0x61, 0x1E, 0xD1, 0x77, 0x76, 0x87, 0x76, 0xB6,
+    0x9F, 0x0A, 0xB5, 0x25, 0xF7, 0xC3, 0xAA, 0x01, 0x39, 0xBE, 0x06, 0x2F, 0xC4, 0xC1, 0xDF, 0xCA,
+    0x6C, 0x7F, 0xC7, 0x8D, 0xFE, 0xBF, 0xE4, 0xC7, 0x33, 0x7F, 0xDE, 0x85, 0x94, 0x4E, 0x6D, 0x17,
+    0x54, 0xB5, 0x98, 0x6E, 0x46, 0x4C, 0x2E, 0x25, 0x3D, 0x0F, 0xB0, 0x6E, 0x41, 0xC0, 0x5B, 0x5D,
+    0x0E, 0x64, 0x9B, 0xC9, 0x50, 0x5E, 0x57, 0xB1, 0x5A, 0xE4, 0xED, 0x01, 0x74, 0xB4, 0x1A, 0xE9,
+    0xD4, 0x74, 0x83, 0x4C, 0xF3, 0x68, 0xD4, 0xF7, 0x9D, 0x84, 0xAE, 0xC5, 0x91, 0x7F, 0x12, 0xCD,
+    0xCE, 0x68, 0x7E, 0xFF, 0x87, 0xA0, 0x19, 0x1E, 0x2A, 0x23, 0x04, 0x54, 0x5E, 0x52, 0xCC, 0xC8,
+    0x3C, 0xC3, 0xEC, 0xA7, 0x53, 0x2F, 0xDC, 0xCE, 0xB9, 0x3E, 0x34, 0xE9, 0xC1, 0x39, 0x37, 0xD8,
+    0xCB, 0x5C, 0xEF, 0xFB, 0xD6, 0xB8, 0x3B, 0xB4, 0xC6, 0xAF, 0x3A, 0x45, 0x35, 0x4A, 0xB5, 0x5A,
+    0x2D, 0x09, 0xF9, 0x13, 0xEB, 0x27, 0x9C, 0x6E, 0x78, 0xFF, 0x6C, 0xB5, 0x34, 0x5C, 0x27, 0x1B,
+    0x8E, 0x6A, 0xBE, 0xAB, 0xDF, 0x43, 0x48, 0xA8, 0x38, 0x87, 0x6F, 0x7D, 0xAC, 0x8D, 0xFF, 0xD4,
+    0x1E, 0x44, 0xF1, 0x1D, 0x3D, 0x08, 0xDD, 0xFC, 0x9E, 0x17, 0xFE, 0x0D, 0x7F, 0x6E, 0xDC, 0x67,
+    0x1E, 0x69, 0x90, 0xB6, 0x46, 0x91, 0x20, 0xF2, 0x7E, 0x4C, 0x62, 0x44, 0x4E, 0xC2, 0x60, 0xEF,
+    0x5E, 0x6D, 0x9A, 0x3D, 0xD1, 0xCA, 0xDB, 0x3E, 0x95, 0x95, 0xA7, 0x9B, 0xE7, 0x28, 0x3F, 0x58,
+    0x74, 0x58, 0x3A, 0x69, 0xA3, 0xCB, 0x06, 0xF6, 0xE5, 0xB1, 0xF1, 0x52, 0xB6, 0x7D, 0x19, 0x91,
+    0x79, 0x33, 0x33, 0x24, 0xD1, 0xF5, 0x73, 0x8E, 0xBB, 0xE0, 0x66, 0x98, 0x70, 0x2F, 0xC4, 0x16,
+    0xF2, 0x14, 0xE7, 0x9D, 0x7B, 0xEC, 0x79, 0x77, 0x89, 0xA7, 0xA1, 0x1B, 0x10, 0x38, 0xFC, 0x48,
+    0x54, 0xCA, 0x8D, 0x5A, 0x3A, 0x7B, 0x47, 0xBE, 0x15, 0xC3, 0x20, 0x80, 0x01, 0x82, 0xE4, 0xDD,
+    0xA4, 0x03, 0x58, 0xD7, 0xE6, 0xF2, 0x85, 0xF6, 0x6F, 0xAF, 0x83, 0xFA, 0x89, 0xFD, 0xE4, 0x1B,
+    0xD1, 0x10, 0xD9, 0x88, 0x5A, 0xE1, 0x52, 0x29, 0x5B, 0xC8, 0x3A, 0xDF, 0x0A, 0x2D, 0x69, 0xFD,
+    0x7D, 0xD5, 0xEF, 0xFF, 0x61, 0x59, 0xFE, 0x0C, 0x7C, 0x81, 0x89, 0xFC, 0x2E, 0x8C, 0xB2, 0xF7,
+    0x00, 0xA5, 0xBC, 0x41, 0x93, 0x0C, 0xD9, 0x63, 0xDF, 0x99, 0x2F, 0x97, 0xE1, 0x03, 0x97, 0x4E,
+    0xA9, 0xFB, 0x6B, 0x00, 0x78, 0x3B, 0x43, 0xF1, 0x32, 0xDF, 0xAB, 0xBD, 0x11, 0x69, 0x70, 0x72,
+    0x67, 0x29, 0xDC, 0xA9, 0x9A, 0xC4, 0x35, 0xCC, 0xD0, 0xCB, 0x84, 0xF7, 0xE5, 0xEA, 0x1E, 0x40,
+    0xA4, 0x9A, 0x71, 0x55, 0x40, 0x48, 0x6B, 0x8D, 0xA7, 0x46, 0x2B, 0xF5, 0x97, 0xE6, 0x9A, 0x77,
+    0xAD, 0xAB, 0xE9, 0xC0, 0x73, 0xCC, 0xCC, 0x5F, 0xCA, 0x1F, 0x02, 0x3B, 0x05, 0xD0, 0xB7, 0x84,
+    0xB9, 0x20, 0xC7, 0x76, 0x91, 0x0A, 0x25, 0x78, 0x4D, 0x49, 0xAF, 0x02, 0x04, 0xE9, 0xA2, 0x7C,
+    0xDC, 0xAB, 0x46, 0xEB, 0x69, 0x34, 0x27, 0x83, 0xE5, 0x9D, 0xDB, 0xEF, 0xAB, 0x8D, 0x59, 0xDE,
+    0xB6, 0x2A, 0x4F, 0xF6, 0xFD, 0x27, 0xA1, 0x9B, 0xA6, 0x7C, 0x4D, 0xDA, 0x13, 0xC2, 0xC4, 0x6E,
+    0xE8, 0x41, 0x14, 0x72, 0x0E, 0x32, 0x61, 0x58, 0xDC, 0x69, 0x9F, 0x30, 0x09, 0xBD, 0xE3, 0xB2,
+    0xCE, 0xBF, 0xA0, 0x95, 0xEC, 0xCA, 0x4F, 0x3D, 0x09, 0xAA, 0x3E, 0x14, 0x55, 0xC1, 0x59, 0xF7,
+    0xAE, 0xA8, 0x19, 0x76, 0x89, 0xF5, 0xD0, 0x6F, 0x4A, 0xC4, 0x8D, 0x97, 0x55, 0x53, 0xD5, 0xC2,
+    0xCE, 0x22, 0x47, 0xE0, 0x5A, 0x86, 0xCC, 0xB7, 0xDC, 0x39, 0xE4, 0xDB, 0x9A, 0xBC, 0x9E, 0x22,
+    0x95, 0x16, 0x26, 0x7F, 0x0F, 0x80, 0xAE, 0xC3, 0x91, 0x58, 0x60, 0xA8, 0x05, 0xD1, 0xB0, 0x56,
+    0x33, 0x11, 0xE9, 0x98, 0xF4, 0xE4, 0x81, 0x66, 0x83, 0x61, 0xC8, 0x4E, 0x77, 0xC1, 0xAA, 0x35,
+    0xB6, 0x2C, 0x9D, 0xF9, 0x8D, 0x66, 0x24, 0xEA, 0x0E, 0x62, 0x86, 0xEA, 0x01, 0x2B, 0x8E, 0x0B,
+    0x42, 0xB0, 0xEF, 0x12, 0x82, 0x7D, 0x9F, 0x10, 0xEC, 0xC7, 0x07, 0x10, 0xAC, 0xFB, 0x21, 0x21,
+    0xD8, 0x17, 0x55, 0x0A, 0x07, 0x7F, 0x6E, 0xBD, 0x6D, 0xBA, 0xD9, 0xEC, 0xE9, 0xA6, 0x25, 0xDD,
+    0x0F, 0x3A, 0x6A, 0x55, 0x08, 0x43, 0xF0, 0xFC, 0xC7, 0x95, 0xCE, 0xF7, 0xB3, 0x08, 0xC5, 0x26,
+    0x73, 0x2F, 0xDF, 0xD7, 0x48, 0x90, 0x3D, 0xD3, 0x68, 0xB6, 0x5F, 0xFA, 0xAD, 0xD9, 0xCC, 0xDE,
+    0x8A, 0x2D, 0xAC, 0xBC, 0x22, 0x9A, 0x44, 0x9D, 0x5E, 0x60, 0x9D, 0x10, 0xB6, 0xBC, 0x0D, 0x2B,
+    0x05, 0x3F, 0xC9, 0xFF, 0x08, 0xC9, 0xA7, 0xDF, 0xEA, 0x81, 0xD3, 0x72, 0xDA, 0xCD, 0x3E, 0x2B,
+    0x7E, 0x5C, 0xD9, 0x57, 0x0A, 0x30, 0x68, 0xB0, 0x4B, 0xED, 0x0B, 0x8B, 0x05, 0x06, 0xCF, 0x67,
+    0xA1, 0x00, 0x47, 0xD2, 0x0A, 0xA1, 0x67, 0x2E, 0xDD, 0x96, 0xEF, 0x01, 0xE3, 0xAE, 0xAB, 0xF7,
+    0x85, 0x0B, 0xC7, 0x85, 0x58, 0xF2, 0xEA, 0xFB, 0x12, 0x03, 0x40, 0xF8, 0x60, 0xE9, 0x34, 0x7E,
+    0xE0, 0x34, 0x80, 0xE0, 0x94, 0x54, 0xA7, 0xB4, 0x5A, 0x0C, 0x81, 0xD5, 0x3B, 0x4C, 0xF8, 0xA4,
+    0x48, 0x15, 0x34, 0x32, 0x82, 0x8D, 0x62, 0x23, 0x99, 0x20, 0xD2, 0xD6, 0x19, 0xD1, 0x06, 0x42,
+    0x19, 0x10, 0xE5, 0x74, 0xB0, 0x82, 0x71, 0x54, 0x55, 0x9D, 0x7A, 0x50, 0xA1, 0xC5, 0x44, 0x85,
+    0x70, 0xF4, 0x0D, 0x2A, 0x04, 0xD5, 0xF9, 0xF6, 0x11, 0x15, 0x2A, 0xA8, 0x42, 0x1F, 0xF8, 0x25,
+    0x06, 0x9B, 0xAA, 0x8E, 0xF6, 0x65, 0x53, 0x02, 0x45, 0x5D, 0x52, 0x75, 0x66, 0x78, 0xDA, 0x43,
+    0x85, 0xE4, 0xDB, 0x3A, 0x34, 0xEB, 0x23, 0xE6, 0x5E, 0x71, 0x9E, 0x45, 0xAF, 0x45, 0x13, 0x71,
+    0xA7, 0x2A, 0x93, 0x20, 0x82, 0xA3, 0x3D, 0x9D, 0x66, 0xA4, 0xB3, 0x56, 0xBD, 0x9D, 0x95, 0xA6,
+    0x42, 0x44, 0x5C, 0x9B, 0xE0, 0x2D, 0x8E, 0x05, 0x3D, 0x86, 0xEC, 0x9B, 0x2D, 0xF8, 0x57, 0xE7,
+    0x6A, 0x0D, 0x26, 0xEA, 0x81, 0x87, 0x9A, 0x39, 0x14, 0x0F, 0xE9, 0x8A, 0xEB, 0x8B, 0x89, 0x4A,
+    0xBD, 0xF7, 0x63, 0x6D, 0x27, 0xD5, 0x21, 0x6E, 0x42, 0x4B, 0x6C, 0x76, 0xAE, 0xE6, 0x85, 0x26,
+    0x66, 0xF7, 0x43, 0x05, 0xC1, 0x4C, 0xB1, 0xB0, 0x23, 0x8D, 0x54, 0x24, 0x0A, 0x31, 0x28, 0xF0,
+    0x1E, 0x26, 0x7A, 0x74, 0x3A, 0xDD, 0x3A, 0x5E, 0xE1, 0xD7, 0xA2, 0x31, 0xE1, 0xD8, 0x52, 0x95,
+    0x99, 0x4E, 0xFF, 0x95, 0x6F, 0x09, 0xC2, 0x95, 0x60, 0x7E, 0x8D, 0xB0, 0x7A, 0x4C, 0xA0, 0x91,
+    0xD6, 0x96, 0xCC, 0x25, 0x55, 0xB5, 0xCB, 0xDB, 0x69, 0x87, 0x92, 0x83, 0x00, 0x1B, 0xF8, 0x10,
+    0x8D, 0x43, 0x87, 0x48, 0x73, 0x43, 0x2F, 0x0E, 0x9D, 0x62, 0x62, 0x78, 0x1A, 0x4F, 0xCA, 0x78,
+    0x65, 0xCB, 0xCD, 0x8D, 0xC5, 0x60, 0xC8, 0xA1, 0xFB, 0xBC, 0xE2, 0x46, 0x46, 0xC4, 0x62, 0xE1,
+    0x43, 0x9D, 0x1F, 0x67, 0x92, 0x6A, 0x0C, 0xC1, 0x7C, 0x55, 0xA6, 0xE7, 0x86, 0x94, 0xDD, 0xE6,
+    0x91, 0x94, 0xDD, 0xBB, 0x9F, 0x39, 0xDD, 0x7D, 0x72, 0x7C, 0xD9, 0x13, 0x2D, 0xBD, 0xF0, 0x3B,
+    0xE4, 0x47, 0xB7, 0xCC, 0x8E, 0x4E, 0x91, 0xC0, 0xCE, 0x78, 0x78, 0x0E, 0x79, 0x10, 0xBB, 0x13,
+    0xF6, 0x67, 0x2D, 0x91, 0x3B, 0xC8, 0x62, 0xC7, 0x9C, 0xF5, 0x7C, 0x27, 0x8B, 0x11, 0x09, 0xD1,
+    0x9B, 0xD4, 0x62, 0x9B, 0xBD, 0x95, 0x88, 0x96, 0x4C, 0xC9, 0xE6, 0x80, 0xE9, 0x3A, 0xDA, 0x11,
+    0xD4, 0x60, 0x5A, 0x5E, 0xF2, 0xF0, 0xBC, 0x19, 0xE5, 0x30, 0x37, 0xE0, 0x52, 0x33, 0x86, 0xA6,
+    0x29, 0x43, 0x2F, 0x84, 0x1C, 0x16, 0xB5, 0xFB, 0xAD, 0x43, 0x44, 0xC5, 0x2D, 0x2C, 0xB9, 0x97,
+    0xD6, 0x32, 0xE2, 0x04, 0x34, 0xAC, 0x06, 0xAD, 0x7B, 0xB6, 0x12, 0x71, 0x37, 0xDE, 0xB9, 0x79,
+    0x9F, 0x26, 0xAE, 0xBA, 0x17, 0xB5, 0xDA, 0xE9, 0xBF, 0xE4, 0xD2, 0xD1, 0x24, 0x84, 0xA4, 0x61,
+    0x22, 0xD0, 0x51, 0x71, 0xF4, 0x62, 0x49, 0x44, 0x2C, 0x90, 0x1B, 0x2B, 0x1C, 0x09, 0x74, 0x03,
+    0xB6, 0xCC, 0xF2, 0xDF, 0x60, 0x13, 0xF0, 0x33, 0x54, 0xD0, 0xEE, 0x16, 0xC8, 0x26, 0x2D, 0xC6,
+    0xAC, 0x6B, 0x4A, 0x46, 0x45, 0xA3, 0xB2, 0x71, 0x96, 0x0A, 0x72, 0x81, 0x4D, 0x1F, 0xE2, 0xB1,
+    0x7A, 0x02, 0x0A, 0xC8, 0x72, 0x48, 0x28, 0xA2, 0x80, 0x78, 0x6F, 0x47, 0xC4, 0x9B, 0x62, 0xB2,
+    0x6A, 0x0F, 0x0A, 0x8A, 0xC5, 0x04, 0x1B, 0x73, 0xA1, 0x29, 0x2B, 0x13, 0x96, 0x4A, 0x6B, 0x92,
+    0xFD, 0x18, 0x04, 0xE0, 0xD5, 0x55, 0xB2, 0xA4, 0x82, 0x90, 0x5D, 0xA0, 0xFE, 0x37, 0xE5, 0x82,
+    0x6A, 0x28, 0xB8, 0x99, 0x10, 0x05, 0x5D, 0x18, 0x08, 0x83, 0x62, 0xC6, 0x31, 0x56, 0x36, 0x6E,
+    0x4C, 0x05, 0xA0, 0x48, 0xB8, 0x0C, 0x21, 0x8D, 0xF0, 0x41, 0x73, 0x53, 0xCB, 0x5D, 0xF8, 0xB0,
+    0x25, 0x28, 0x5A, 0x3B, 0xE6, 0x02, 0x79, 0xC6, 0x04, 0xE4, 0xC3, 0x9B, 0xB2, 0x63, 0x56, 0x8D,
+    0x81, 0x02, 0x56, 0xDD, 0x33, 0xC6, 0x55, 0x20, 0x26, 0xF5, 0xA3, 0xE4, 0x3D, 0x6A, 0xED, 0xE5,
+    0x5D, 0x80, 0x2A, 0x45, 0x58, 0xFD, 0x6A, 0xA5, 0xA9, 0xA1, 0x74, 0x88, 0x17, 0xE1, 0x83, 0x4E,
+    0xAB, 0xB7, 0x4A, 0x17, 0x8D, 0x65, 0x0C, 0xE0, 0xDB, 0xF9, 0x3D, 0xF7, 0xF3, 0x87, 0xF8, 0x56,
+    0x3F, 0x57, 0x37, 0xCF, 0xBF, 0x85, 0x00, 0xAF, 0x7E, 0x77, 0xC7, 0x52, 0x9C, 0x6D, 0xD6, 0x8A,
+    0xCE, 0x95, 0xA8, 0x01, 0x66, 0xAD, 0x8A, 0x26, 0x18, 0x67, 0xBD, 0x4C, 0x8B, 0xB5, 0xB3, 0x48,
+    0x33, 0xDE, 0x91, 0x55, 0x4D, 0xCE, 0x5A, 0x29, 0x79, 0x98, 0x89, 0xAD, 0x1D, 0x45, 0x63, 0x29,
+    0xC7, 0xA1, 0xAE, 0xCA, 0x6B, 0xE2, 0xF1, 0x8C, 0x76, 0x55, 0xDE, 0x23, 0xB6, 0xF2, 0x4A, 0xE0,
+    0xF3, 0x40, 0xBC, 0xD0, 0xF2, 0x89, 0xD7, 0x94, 0x93, 0x42, 0x53, 0x91, 0x6F, 0x0F, 0x08, 0x1C,
+    0x0A, 0x4A, 0x2D, 0x6A, 0xA8, 0x40, 0x8A, 0x86, 0xE7, 0xF4, 0xEC, 0x55, 0x8B, 0xF7, 0x78, 0x62,
+    0xAF, 0x5E, 0x14, 0x01, 0xC0, 0x4C, 0x28, 0x49, 0x2D, 0x33, 0x4B, 0xE5, 0x50, 0x6D, 0x58, 0xB5,
+    0xD3, 0x40, 0x91, 0xA0, 0x39, 0xAA, 0x4E, 0xBB, 0xB1, 0xF4, 0x17, 0x51, 0x1A, 0x04, 0xCE, 0x90,
+    0xE8, 0x0C, 0x3E, 0xAC, 0x9D, 0xA9, 0x80, 0x66, 0xF5, 0x7A, 0x1A, 0x0F, 0x5F, 0xB1, 0x7D, 0x83,
+    0x86, 0x45, 0x21, 0xF2, 0x5C, 0x78, 0x93, 0x5B, 0xB9, 0x9B, 0x84, 0x85, 0x34, 0x1F, 0xCA, 0x1B,
+    0x92, 0x2D, 0xAD, 0x30, 0x74, 0x48, 0x09, 0xB9, 0xF3, 0xB6, 0x99, 0x0A, 0xFC, 0x2F, 0x67, 0xC3,
+    0xC9, 0x70, 0x2E, 0xC7, 0x13, 0x8B, 0x53, 0x3C, 0xF0, 0x0F, 0x20, 0xA3, 0x3F, 0x00, 0xC8, 0x7D,
+    0x40, 0x1F, 0x9D, 0xF6, 0xC1, 0xAF, 0xB4, 0x06, 0x8E, 0x3C, 0x99, 0x29, 0xB4, 0xBE, 0xFE, 0xFE,
+    0x09, 0x09, 0xD7, 0x81, 0x65, 0x6E, 0x82, 0xE6, 0x8D, 0xB9, 0x6C, 0x6A, 0xF4, 0xB2, 0x6E, 0x9D,
+    0xC8, 0x5E, 0xA8, 0xC2, 0x56, 0x1E, 0x46, 0x27, 0x33, 0xD9, 0xDE, 0x3A, 0x84, 0xE8, 0xBA, 0x0A,
+    0x75, 0x21, 0xCC, 0x46, 0x63, 0x32, 0xDA, 0xC3, 0xD7, 0x65, 0xA4, 0xB5, 0xA5, 0xF3, 0x11, 0xFC,
+    0x3D, 0x00, 0x73, 0xBE, 0x0B, 0x60, 0xEA, 0xDC, 0xA3, 0x48, 0x31, 0x9D, 0x32, 0x86, 0x21, 0xB2,
+    0x3A, 0x90, 0x65, 0x92, 0x65, 0x5D, 0x23, 0xE8, 0x65, 0xB0, 0x22, 0x6E, 0x73, 0x55, 0x6C, 0x03,
+    0x0D, 0xAD, 0x74, 0xBC, 0x0B, 0x70, 0xFE, 0x81, 0x62, 0x9B, 0x98, 0x4C, 0x4E, 0x26, 0x28, 0x93,
+    0x94, 0x89, 0xCA, 0x64, 0x65, 0xC2, 0x0A, 0x26, 0xB9, 0xD5, 0xC6, 0xA9, 0xBC, 0x4C, 0x60, 0x26,
+    0x31, 0x37, 0xEE, 0x1A, 0x3B, 0x67, 0x42, 0x33, 0xA9, 0x99, 0xD8, 0x4C, 0x6E, 0x26, 0xB8, 0x70,
+    0xE0, 0xA8, 0xE8, 0x4C, 0x76, 0x26, 0xBC, 0x49, 0xE8, 0x06, 0xC7, 0x56, 0x90, 0xDF, 0xAD, 0x33,
+    0xF1, 0xB7, 0x30, 0xE5, 0x2E, 0xCC, 0x58, 0x27, 0x1C, 0x71, 0x16, 0x36, 0xDD, 0xC9, 0x6C, 0xA9,
+    0xFB, 0xAA, 0xFC, 0xAA, 0xFD, 0xAA, 0xFE, 0xAA, 0xFF, 0x5C, 0x00, 0x56, 0x05, 0xAA, 0xDB, 0xC2,
+    0x6C, 0x34, 0x5F, 0x9F, 0x2E, 0xB6, 0xD8, 0x3E, 0x2E, 0x5A, 0xC7, 0xD3, 0xAD, 0x18, 0xBE, 0x68,
+    0xD1, 0x35, 0x35, 0x93, 0x89, 0xE3, 0x76, 0xEE, 0xE0, 0x4C, 0xC9, 0xC0, 0x9C, 0xD9, 0x24, 0x51,
+    0x3F, 0xB7, 0xBB, 0x11, 0x7E, 0x83, 0x03, 0x61, 0xE7, 0xFE, 0xE6, 0x00, 0x25, 0xAE, 0x27, 0x25,
+    0xB2, 0x9A, 0xB3, 0x62, 0x51, 0xCA, 0x66, 0x70, 0x40, 0x4D, 0x13, 0x4A, 0xAB, 0x9B, 0x1C, 0xB1,
+    0xE4, 0xD9, 0x24, 0xBA, 0x0B, 0x95, 0xFC, 0x17, 0xFE, 0xBC, 0x7C, 0xF3, 0x2E, 0xF2, 0x13, 0xAD,
+    0x94, 0xC3, 0xEE, 0x67, 0x68, 0xC2, 0x89, 0x8B, 0x24, 0x48, 0xB7, 0x17, 0x9F, 0x21, 0x20, 0xA5,
+    0x45, 0x95, 0x4D, 0x00, 0x3E, 0x86, 0x23, 0x62, 0x56, 0xDD, 0xB3, 0x0A, 0x3B, 0xE8, 0x02, 0x4E,
+    0x2B, 0x71, 0x38, 0x36, 0x25, 0x98, 0x7A, 0xA4, 0x9C, 0xB5, 0x52, 0x90, 0x5D, 0x28, 0x39, 0xA8,
+    0x30, 0x25, 0xF8, 0x71, 0x4E, 0xB7, 0x79, 0xA6, 0xC7, 0x70, 0x5D, 0x09, 0x93, 0xFF, 0x03, 0xFF,
+    0xAD, 0xA0, 0x5C, 0x15, 0x68, 0xAA, 0xB4, 0x90, 0xA5, 0x9B, 0x64, 0xFA, 0xDF, 0xA3, 0xAC, 0x26,
+    0x99, 0xFE, 0x5F, 0x30, 0x09, 0xE8, 0x17, 0xEA, 0x8D, 0xC9, 0x00, 0x47, 0xB7, 0x27, 0x5B, 0xFC,
+    0x75, 0xE1, 0xF6, 0x9D, 0xFB, 0x96, 0x93, 0x44, 0x64, 0x22, 0x7D, 0x88, 0xAF, 0xD4, 0xE5, 0x5A,
+    0xFC, 0xD2, 0xB4, 0x89, 0xC6, 0xDA, 0xFC, 0x67, 0xCC, 0xED, 0x6B, 0xC2, 0x43, 0x8D, 0xDD, 0x5A,
+    0x0E, 0xF3, 0x6E, 0xDC, 0xEC, 0xB9, 0xF8, 0xA2, 0x85, 0x56, 0x18, 0xB5, 0x43, 0x9D, 0x91, 0xAE,
+    0xFA, 0x67, 0xC7, 0x4B, 0x42, 0x6C, 0x78, 0x5F, 0x44, 0xD6, 0xB0, 0x58, 0x0B, 0xDB, 0xFD, 0x4B,
+    0xD9, 0xD6, 0x52, 0x08, 0x12, 0x66, 0xB0, 0x68, 0x8D, 0xD7, 0x3B, 0x28, 0x2D, 0x8A, 0x3C, 0x71,
+    0xC6, 0xEA, 0x77, 0x6A, 0x03, 0xF3, 0x4C, 0x26, 0xED, 0x89, 0x72, 0xE6, 0xF4, 0xDA, 0xED, 0x27,
+    0x77, 0x0A, 0x99, 0x59, 0xBE, 0x11, 0xDB, 0x25, 0xDD, 0x56, 0xB5, 0xA2, 0x2A, 0x84, 0x0C, 0x66,
+    0x5C, 0xC5, 0x83, 0x9F, 0xFC, 0x4C, 0x35, 0x9C, 0x16, 0x65, 0xA1, 0x2D, 0xCD, 0x5F, 0xB5, 0x35,
+    0x19, 0x34, 0xEA, 0xAF, 0x4E, 0x43, 0xB9, 0x2A, 0x01, 0xF0, 0xCA, 0xC4, 0x8E, 0xDD, 0x53, 0xC4,
+    0x01, 0x37, 0x97, 0xC6, 0x01, 0x5D, 0x37, 0x16, 0xFE, 0x99, 0x75, 0xC3, 0x88, 0xA9, 0xCB, 0xF1,
+    0xDD, 0x9F, 0xF0, 0x73, 0x6E, 0x15, 0x67, 0x85, 0x1B, 0x22, 0x2C, 0x70, 0xFB, 0x91, 0xB4, 0x96,
+    0x6C, 0x15, 0xED, 0x2D, 0xBF, 0x3E, 0x11, 0x8E, 0xB7, 0xA8, 0x21, 0x93, 0x7F, 0xDB, 0x9F, 0xFB,
+    0x2F, 0xEF, 0xCD, 0x2E, 0x09, 0xA4, 0xC6, 0x57, 0x25, 0x0E, 0x76, 0x2F, 0x51, 0x0B, 0xC1, 0xB9,
+    0xC4, 0x77, 0xBA, 0x9A, 0x3A, 0xA5, 0x8B, 0x31, 0x1C, 0xD0, 0x21, 0x16, 0x29, 0xE8, 0xC9, 0x19,
+    0x0B, 0xD2, 0x84, 0x68, 0x77, 0x67, 0x09, 0xA9, 0xD7, 0x83, 0xD4, 0xFB, 0xCB, 0xA5, 0xCE, 0xFB,
+    0x81, 0xD8, 0x40, 0x8B, 0x5A, 0xA4, 0x92, 0xB7, 0x74, 0x31, 0x0E, 0xAD, 0xD3, 0xF4, 0xB1, 0x51,
+    0xB5, 0x43, 0x43, 0x6C, 0x2F, 0x7F, 0x6E, 0xFE, 0xE4, 0x58, 0x26, 0x0E, 0xF3, 0xFB, 0xC1, 0x20,
+    0xE3, 0xB5, 0x47, 0xC2, 0xE5, 0xF9, 0xAE, 0x5C, 0x0B, 0x2F, 0xC1, 0x99, 0xED, 0x7D, 0xC3, 0xCE,
+    0x85, 0x9D, 0xD0, 0xE0, 0x56, 0x8B, 0xF2, 0xC0, 0x51, 0x07, 0x96, 0x5E, 0x9D, 0xA3, 0xF7, 0x84,
+    0xA8, 0xA3, 0xB0, 0x57, 0x57, 0x79, 0xA6, 0x76, 0x75, 0x17, 0x36, 0xAC, 0x63, 0xF7, 0xBD, 0x95,
+    0x74, 0x92, 0x0C, 0x74, 0xF4, 0x9A, 0x3F, 0x55, 0xFF, 0x8E, 0xD8, 0x81, 0xA6, 0xBB, 0xF5, 0x61,
+    0xA7, 0xB8, 0xAC, 0x84, 0xF2, 0x3B, 0x2A, 0x29, 0x63, 0xF7, 0x2C, 0xF7, 0xE1, 0x96, 0x4B, 0x63,
+    0x35, 0xED, 0x4E, 0x75, 0x5B, 0xA2, 0x8F, 0x9D, 0x60, 0xA8, 0x1B, 0xFE, 0xE2, 0xFE, 0x5E, 0x82,
+    0xE3, 0xC6, 0x0D, 0x69, 0x89, 0x96, 0x9B, 0x58, 0xAA, 0x17, 0x70, 0x49, 0x82, 0xA3, 0x7F, 0xD5,
+    0x6A, 0x46, 0xB9, 0xAD, 0xCC, 0xCD, 0xB8, 0x1B, 0x53, 0x76, 0x6E, 0x33, 0x34, 0x96, 0x74, 0x91,
+    0x5E, 0xCC, 0xF1, 0x15, 0x15, 0x42, 0x73, 0xF6, 0xFA, 0xBB, 0xB4, 0xC9, 0x77, 0x33, 0x32, 0xE6,
+    0xF6, 0xB4, 0x9A, 0xCC, 0xFC, 0xE9, 0xF1, 0x92, 0x8C, 0x70, 0x3B, 0x46, 0xCF, 0x79, 0xA6, 0x1D,
+    0xBB, 0x6C, 0xBF, 0x3C, 0x63, 0x47, 0x16, 0x87, 0xDA, 0x90, 0xED, 0x5E, 0x5D, 0x46, 0x43, 0x09,
+    0x87, 0xF2, 0x8C, 0x8D, 0xE6, 0xFA, 0xEF, 0xD7, 0x86, 0xAC, 0x43, 0xDD, 0x41, 0xB9, 0xE5, 0x8B,
+    0xEC, 0x0D, 0xD2, 0x01, 0x1C, 0x90, 0xFD, 0x2A, 0xE7, 0x16, 0xFA, 0xAB, 0x70, 0x6D, 0x43, 0x33,
+    0xD8, 0xEE, 0x56, 0xD3, 0xA9, 0x05, 0xB8, 0x63, 0xDA, 0xC9, 0x4F, 0xA1, 0x27, 0x33, 0xF1, 0x80,
+    0xF0, 0xE0, 0x05, 0xD1, 0x71, 0x7C, 0x37, 0xFF, 0x35, 0x1E, 0xCB, 0x79, 0x92, 0xFC, 0x74, 0x2C,
+    0xD0, 0x97, 0xC3, 0xE3, 0xE8, 0x74, 0x0F, 0x0F, 0x56, 0xB0, 0x3E, 0x99, 0x16, 0xE5, 0x84, 0xB4,
+    0xC1, 0x11, 0x0F, 0xD6, 0x6B, 0xAF, 0x1A, 0x75, 0xE4, 0x1C, 0xC1, 0x09, 0xE6, 0x29, 0xD6, 0x33,
+    0xB6, 0x0B, 0x66, 0x2B, 0xE2, 0xB0, 0xF0, 0x5B, 0x1C, 0x1C, 0x95, 0xEF, 0x31, 0x35, 0xE4, 0xD1,
+    0xCB, 0x5C, 0xFE, 0xC8, 0xCD, 0xE5, 0x55, 0x3F, 0x06, 0x30, 0x0D, 0xFF, 0xCD, 0xBC, 0x9F, 0x5C,
+    0x18, 0x97, 0xDB, 0x89, 0x31, 0xBD, 0xC6, 0xEF, 0x45, 0x90, 0x90, 0xE2, 0xC0, 0x8B, 0x70, 0x2A,
+    0xD6, 0x01, 0x8B, 0x9D, 0x80, 0xE0, 0xCF, 0x87, 0x54, 0x72, 0xB7, 0x60, 0x46, 0xA3, 0xDD, 0xE6,
+    0xF7, 0x27, 0x06, 0x3B, 0xB3, 0x27, 0xDE, 0xE6, 0xF7, 0x22, 0xC8, 0x28, 0x59, 0x3B, 0x38, 0xA8,
+    0xCC, 0x5D, 0x4D, 0xFA, 0xBB, 0x43, 0xD5, 0x40, 0xA8, 0xAF, 0xD5, 0x52, 0xB8, 0xE2, 0xF9, 0x5A,
+    0x45, 0xCE, 0xA0, 0x62, 0xDD, 0xA4, 0xF5, 0xCC, 0x70, 0x8B, 0xAF, 0x69, 0x2E, 0xC4, 0xEB, 0x7F,
+    0x9D, 0x74, 0xF6, 0x43, 0x7B, 0xC4, 0xBE, 0xE0, 0x8E, 0x5E, 0x30, 0x21, 0x9A, 0x80, 0x32, 0xBB,
+    0x67, 0x09, 0x3F, 0xE8, 0x60, 0x7E, 0x47, 0xDB, 0x64, 0x39, 0xB4, 0x9D, 0x1A, 0xE4, 0xFC, 0xBA,
+    0xDA, 0x4B, 0xCF, 0x9D, 0x58, 0x6F, 0xBD, 0x7D, 0xE7, 0x9E, 0x0B, 0x65, 0x8F, 0xC8, 0x1C, 0x2D,
+    0x90, 0x69, 0x18, 0x13, 0xCD, 0xD9, 0x12, 0xBD, 0xCA, 0xD6, 0xBC, 0x0F, 0xE4, 0x58, 0x76, 0xF6,
+    0x17, 0x4B, 0x82, 0x37, 0x56, 0x88, 0x93, 0x30, 0xDC, 0xE2, 0x72, 0x84, 0xF7, 0x9D, 0x7F, 0x03,
+    0xE9, 0xA7, 0x3D, 0x4C, 0x8B, 0x78, 0x8B, 0x1C, 0xBB, 0xA8, 0x38, 0x7A, 0xAE, 0xB6, 0xCD, 0xEB,
+    0xCD, 0x77, 0xB5, 0x7C, 0xED, 0x46, 0x16, 0x2D, 0x0E, 0x36, 0x68, 0x34, 0x74, 0x28, 0x77, 0x19,
+    0x6F, 0x2A, 0xCB, 0x2C, 0x15, 0x64, 0x5A, 0xDD, 0xFD, 0x63, 0x8B, 0x41, 0x2F, 0x4C, 0x51, 0x72,
+    0xBD, 0x3B, 0xB8, 0x30, 0x65, 0xEE, 0x5F, 0x7F, 0xE4, 0xC2, 0x94, 0x66, 0x0F, 0x89, 0xB5, 0xBB,
+    0xB0, 0x62, 0xCB, 0x6A, 0x31, 0x64, 0x29, 0x5C, 0x23, 0xE1, 0x02, 0xBE, 0xA4, 0xF8, 0xB1, 0x9A,
+    0xBC, 0x7B, 0x28, 0x93, 0x7A, 0x65, 0x00, 0x1A, 0xAA, 0xBA, 0xD2, 0xFA, 0x16, 0xBF, 0x91, 0x0F,
+    0x29, 0x15, 0x40, 0x3E, 0xE4, 0x3D, 0xCB, 0xB9, 0x6B, 0x54, 0x76, 0x09, 0x97, 0xE4, 0x43, 0x45,
+    0x16, 0xC9, 0x07, 0xCF, 0x60, 0x7C, 0x59, 0xC3, 0xE9, 0x46, 0xD4, 0xAA, 0x46, 0x38, 0x1D, 0x9C,
+    0xA9, 0xC5, 0x5B, 0x22, 0x7F, 0xEA, 0xE4, 0xC2, 0xB3, 0x3C, 0xA4, 0x4E, 0xFF, 0xD7, 0x53, 0x0F,
+    0xEA, 0xFC, 0xCF, 0x1E, 0x29, 0x1D, 0x79, 0x5D, 0xFE, 0xB7, 0x07, 0xBC, 0x9D, 0xD7, 0xFE, 0x5D,
+    0x64, 0x7D, 0xE2, 0xC3, 0x1B, 0x9E, 0x39, 0x35, 0x9F, 0xC8, 0xA3, 0xF0, 0x33, 0xF2, 0x4F, 0xFB,
+    0xC8, 0x33, 0x1F, 0xE1, 0x8B, 0x36, 0xF2, 0xCC, 0x60, 0x79, 0x20, 0x1F, 0x50, 0x44, 0x95, 0x3F,
+    0x40, 0xB9, 0x19, 0x4B, 0xD1, 0x9A, 0xC8, 0xAE, 0xCA, 0xDA, 0x30, 0xAF, 0x81, 0x5E, 0x9C, 0x7D,
+    0x58, 0x2A, 0xE4, 0x0A, 0xE9, 0x5B, 0x58, 0x26, 0x70, 0x51, 0x61, 0x2B, 0x3A, 0x06, 0xBD, 0xA5,
+    0x05, 0x19, 0x97, 0x3A, 0x73, 0x55, 0xEB, 0x5C, 0xFD, 0x86, 0x42, 0x11, 0xF7, 0x93, 0x3D, 0x24,
+    0x54, 0x6C, 0x1F, 0x31, 0x8B, 0x4E, 0x8B, 0x6A, 0x33, 0x67, 0x9D, 0x0B, 0x7B, 0xD4, 0xBE, 0x6F,
+    0x62, 0xC8, 0x5E, 0xEC, 0xD6, 0x44, 0xA4, 0x2F, 0x4C, 0xDA, 0xA4, 0xBE, 0x96, 0xA9, 0x94, 0x9B,
+    0xFC, 0xE3, 0x1A, 0x10, 0xF5, 0xA6, 0x94, 0xBE, 0x41, 0x10, 0xF1, 0x35, 0xB0, 0xBB, 0xAC, 0x7D,
+    0x5A, 0x63, 0x41, 0x7C, 0xD2, 0xA7, 0x9F, 0x80, 0x2B, 0x1F, 0xB6, 0x29, 0xEE, 0x8E, 0xCB, 0x7F,
+    0xDF, 0xA6, 0x5F, 0x80, 0x39, 0x1F, 0x6F, 0xD3, 0xAF, 0xC0, 0x92, 0x07, 0x4D, 0xFA, 0x00, 0x1C,
+    0x91, 0xB7, 0xD1, 0x32, 0xF6, 0x6B, 0xE6, 0x4D, 0xCA, 0x14, 0x53, 0x2D, 0xCB, 0x53, 0xA0, 0x9F,
+    0x7D, 0xA1, 0xE1, 0x33, 0x3F, 0xDE, 0x9C, 0xE9, 0x2C, 0xCD, 0x41, 0xB3, 0xD5, 0xF9, 0x20, 0x6E,
+    0xCF, 0xD4, 0xEB, 0x33, 0xA7, 0x53, 0x2B, 0x51, 0xC7, 0xBF, 0xE1, 0xBA, 0x5C, 0xEA, 0x2D, 0x6F,
+    0x59, 0xB8, 0x4E, 0x56, 0x43, 0x73, 0x5C, 0xDF, 0x33, 0xDE, 0x7F, 0xBB, 0x60, 0xFE, 0x71, 0xC2,
+    0x6A, 0xC6, 0x8C, 0x6E, 0x5F, 0xA5, 0xC0, 0x06, 0x8B, 0xDF, 0xAC, 0x28, 0x63, 0x39, 0x96, 0x66,
+    0xB4, 0x57, 0x94, 0xB5, 0x5C, 0xEE, 0xA4, 0x5D, 0x55, 0xBB, 0x18, 0xEE, 0x38, 0xB5, 0x4B, 0x4E,
+    0xAD, 0xD0, 0xC7, 0xAE, 0x39, 0xD5, 0x7B, 0x4E, 0xED, 0xA2, 0xD3, 0xFD, 0x9B, 0x4E, 0x01, 0xBB,
+    0xA3, 0x92, 0x25, 0xD7, 0xCD, 0x06, 0x01, 0xBD, 0x8E, 0x67, 0x68, 0xAE, 0xC9, 0x9D, 0x88, 0x14,
+    0xCB, 0x2C, 0x43, 0x7C, 0x01, 0x17, 0xE1, 0xB5, 0x7A, 0xB3, 0x6B, 0x6B, 0x91, 0x0E, 0xFA, 0xC0,
+    0x71, 0x47, 0x07, 0x38, 0xEE, 0xE8, 0x73, 0x2E, 0x3A, 0xCE, 0x64, 0xCE, 0x42, 0x7F, 0x39, 0xE5,
+    0x8C, 0x66, 0xBB, 0x86, 0xC0, 0x4F, 0xC8, 0x54, 0x18, 0x9F, 0x57, 0xDD, 0x8D, 0xFE, 0xA9, 0xCE,
+    0x37, 0x78, 0xA2, 0xB1, 0xED, 0x51, 0xD4, 0xC7, 0x3B, 0xFA, 0x7C, 0xA5, 0xCF, 0x57, 0xFA, 0x60,
+    0xA5, 0x4F, 0x94, 0x9F, 0x4D, 0x57, 0x6F, 0xDC, 0x00, 0x3D, 0x4C, 0x76, 0x90, 0x67, 0xBA, 0xC3,
+    0xDA, 0x48, 0x1B, 0xDC, 0x86, 0xF0, 0xF2, 0xD9, 0xCD, 0xBD, 0xA0, 0xCD, 0xF5, 0x90, 0xAD, 0xBB,
+    0x75, 0x7F, 0xA8, 0xE3, 0x09, 0xD9, 0x3A, 0xC5, 0x41, 0xF6, 0xDF, 0xF1, 0x30, 0xAF, 0xF9, 0x70,
+    0xA5, 0x44, 0xCF, 0xD8, 0x36, 0x9D, 0x75, 0x02, 0x3D, 0xDE, 0xD0, 0xC0, 0x26, 0x94, 0x85, 0xD9,
+    0xC5, 0x16, 0xBC, 0x78, 0x51, 0xE9, 0x0D, 0xBF, 0xD4, 0xCC, 0x9E, 0xE5, 0x70, 0x4A, 0x54, 0xED,
+    0x24, 0x0E, 0x3B, 0xFE, 0x52, 0xCF, 0x0E, 0xBD, 0xDE, 0xD3, 0xB0, 0x58, 0x4D, 0x0D, 0xFA, 0x72,
+    0xB5, 0x22, 0x40, 0xD1, 0xF3, 0xB0, 0xEA, 0x08, 0x6E, 0xB4, 0xD6, 0x86, 0x05, 0x48, 0x68, 0x57,
+    0xD1, 0xCE, 0xA5, 0x41, 0xBC, 0x04, 0x69, 0x06, 0x63, 0xE0, 0x18, 0xD5, 0xD2, 0x39, 0xBE, 0x52,
+    0x1A, 0xE2, 0xB7, 0x35, 0x08, 0x60, 0xAE, 0x97, 0x32, 0x86, 0xEA, 0x0D, 0xC8, 0x21, 0x9A, 0xFC,
+    0x3C, 0x5C, 0xD3, 0xA1, 0x3F, 0xAF, 0x6D, 0xB6, 0x89, 0x17, 0x3F, 0x94, 0x48, 0x89, 0x86, 0xAB,
+    0xD1, 0x54, 0x46, 0x90, 0x5E, 0xE8, 0x12, 0x77, 0xE3, 0x7D, 0xA7, 0xE9, 0x04, 0x02, 0x8C, 0xB7,
+    0xFB, 0x39, 0x04, 0xD7, 0x81, 0xC5, 0x4F, 0x77, 0x55, 0xDB, 0xB3, 0x63, 0x31, 0x2E, 0xD8, 0x02,
+    0x44, 0xB7, 0x63, 0xF8, 0x76, 0xDE, 0xA7, 0x9A, 0x07, 0xA3, 0xD9, 0x8D, 0x96, 0x2C, 0x57, 0xFA,
+    0xB1, 0x1C, 0x7F, 0x8F, 0xD5, 0xC6, 0x6B, 0x63, 0xB6, 0x71, 0x7B, 0x60, 0x77, 0xB8, 0x1D, 0x7C,
+    0x11, 0x52, 0xEE, 0x0A, 0x37, 0xB0, 0xDC, 0x96, 0xE1, 0xF0, 0x84, 0x5D, 0x9A, 0xBE, 0x9C, 0x18,
+    0x40, 0x95, 0xED, 0x42, 0x8D, 0x1B, 0x58, 0x1F, 0x9E, 0x30, 0xDB, 0xA8, 0x34, 0x27, 0x6B, 0xEB,
+    0x06, 0xFE, 0x9B, 0x00, 0x4C, 0x02, 0x26, 0x82, 0xC0, 0xFD, 0x20, 0x84, 0xCB, 0x2E, 0x15, 0xF3,
+    0x8F, 0xB9, 0x54, 0x8C, 0xD2, 0x50, 0x71, 0xA8, 0x3C, 0x54, 0x20, 0x01, 0xF7, 0x9A, 0x4F, 0x14,
+    0x4A, 0x8B, 0x5A, 0xAB, 0xDD, 0x44, 0x67, 0xC6, 0x1B, 0x7B, 0xF3, 0xE9, 0x2F, 0xEB, 0x89, 0x2A,
+    0x02, 0x88, 0x99, 0x62, 0x85, 0x0A, 0xEF, 0x87, 0x45, 0xC0, 0xF2, 0x81, 0x10, 0x99, 0x28, 0xAD,
+    0x9A, 0x50, 0x37, 0xB7, 0xCD, 0x88, 0x10, 0x16, 0x8F, 0xA9, 0xA4, 0xBB, 0xFA, 0x7A, 0x91, 0xC3,
+    0x5D, 0xB0, 0x7A, 0xDA, 0x52, 0xC8, 0xC7, 0x0F, 0x38, 0x1D, 0x8A, 0xFB, 0xC9, 0x1D, 0xAF, 0x40,
+    0x61, 0x33, 0x9C, 0x10, 0x15, 0x5F, 0xA0, 0x71, 0xA4, 0xFF, 0x03, 0xED, 0x5C, 0xBF, 0x93, 0xE4,
+    0xC6, 0x75, 0x6E, 0x00, 0xDC, 0x9B, 0xAA, 0x43, 0x80, 0x84, 0x9B, 0xF0, 0xAA, 0x0C, 0x07, 0x8E,
+    0xCE, 0x01, 0xFE, 0x02, 0x17, 0x40, 0x2B, 0x60, 0x95, 0xA3, 0x0B, 0x6E, 0x95, 0x38, 0x90, 0x02,
+    0x46, 0x74, 0x70, 0x89, 0x73, 0x0C, 0xE5, 0x40, 0x81, 0x93, 0x4D, 0x28, 0x87, 0xA6, 0xAB, 0x18,
+    0x1C, 0x97, 0xC1, 0xA5, 0x56, 0x42, 0x0C, 0xA5, 0x50, 0x81, 0x47, 0x72, 0xA9, 0x1C, 0x28, 0xF0,
+    0xA8, 0x74, 0x57, 0x76, 0x51, 0xC1, 0x41, 0x2E, 0xC8, 0xC4, 0x91, 0x18, 0xB4, 0xDF, 0xFB, 0xBE,
+    0xD7, 0x40, 0xCF, 0xDE, 0x9D, 0x48, 0xBB, 0x24, 0xD6, 0xF2, 0xAC, 0xAD, 0x5A, 0x74, 0xCF, 0xEE,
+    0x0C, 0xD0, 0xFD, 0x7E, 0xFF, 0xF8, 0x7A, 0x9C, 0xD3, 0x9F, 0x37, 0x3E, 0xC0, 0xE0, 0xEA, 0xD1,
+    0xB9, 0x3B, 0x7E, 0x74, 0xED, 0xE0, 0x12, 0xEF, 0x7D, 0xD3, 0xF5, 0x2E, 0x97, 0xF1, 0x97, 0x7E,
+    0xEF, 0x2A, 0x19, 0xBF, 0xF0, 0x5B, 0xD7, 0xF9, 0x8F, 0xBC, 0x9F, 0xE5, 0xDF, 0xA3, 0xAB, 0xFD,
+    0xE0, 0x32, 0x7F, 0x70, 0xA5, 0x6F, 0xE4, 0x6D, 0x3B, 0x57, 0x78, 0x87, 0xDF, 0x5C, 0x7E, 0xCB,
+    0x99, 0x63, 0x3D, 0x39, 0xB7, 0xB1, 0x51, 0x5F, 0xB7, 0xA3, 0x8D, 0x03, 0xDF, 0x2B, 0x4F, 0x58,
+    0xC7, 0x99, 0x63, 0x75, 0xE4, 0xA8, 0x9F, 0xD1, 0x51, 0x3F, 0xD3, 0xC9, 0xFB, 0x3D, 0xE7, 0xFA,
+    0x48, 0x57, 0x1F, 0xE5, 0x63, 0x3B, 0x79, 0xAF, 0x7F, 0xD2, 0xC9, 0xE3, 0xE5, 0x85, 0xAE, 0x4A,
+    0x9F, 0xE5, 0x65, 0x55, 0x0E, 0xCB, 0xDF, 0xE9, 0x96, 0x4A, 0xFF, 0x8C, 0x7B, 0xBB, 0x70, 0xCB,
+    0xCF, 0xDD, 0xF7, 0x31, 0xB4, 0x3D, 0x06, 0x7D, 0xC4, 0x83, 0xC7, 0x4E, 0xF6, 0x28, 0x7B, 0xFD,
+    0x4B, 0xF9, 0x54, 0xED, 0xFD, 0x2F, 0xE4, 0x9E, 0x72, 0x07, 0x7F, 0x94, 0xA7, 0x7D, 0xEE, 0xBD,
+    0x92, 0x61, 0x57, 0xCF, 0x8D, 0x2E, 0xB5, 0x9A, 0xB0, 0xBB, 0x52, 0x16, 0x29, 0x53, 0x1D, 0x64,
+    0x9D, 0xE5, 0x04, 0xE2, 0x61, 0x18, 0xF0, 0x16, 0xD9, 0xA0, 0xAE, 0x5F, 0x9E, 0xA1, 0x44, 0x95,
+    0x57, 0xD8, 0xD1, 0x98, 0xE8, 0x26, 0xEA, 0x63, 0x2E, 0x4F, 0x93, 0xA5, 0x79, 0x21, 0xA8, 0x2E,
+    0x5D, 0x57, 0x9E, 0x79, 0x21, 0xA9, 0xAE, 0x4A, 0xFF, 0x26, 0x1B, 0xB8, 0xB7, 0xAE, 0x37, 0xBD,
+    0xB2, 0xC9, 0x46, 0x96, 0xD5, 0x1E, 0x64, 0x50, 0x12, 0x62, 0x55, 0x4A, 0x33, 0xA1, 0x47, 0xE1,
+    0xE5, 0x99, 0x89, 0xDC, 0xB4, 0xD0, 0xC5, 0x26, 0xB2, 0x09, 0xB9, 0xF9, 0xDE, 0xA5, 0x98, 0xCC,
+    0x7A, 0xF3, 0xAD, 0x90, 0xEA, 0xA0, 0x93, 0x06, 0x0B, 0xC2, 0xAD, 0x6A, 0xA5, 0x54, 0xE0, 0x06,
+    0x26, 0xBA, 0xC8, 0x85, 0x0F, 0xAE, 0x38, 0xE2, 0xE6, 0x0E, 0xFB, 0xD2, 0x15, 0x3B, 0x3C, 0x45,
+    0xE9, 0x2A, 0x7B, 0x4B, 0x39, 0x51, 0x86, 0x60, 0x32, 0xE0, 0x29, 0xD8, 0xB2, 0xDE, 0x1C, 0x13,
+    0xBD, 0x27, 0x6E, 0xAF, 0xF2, 0x80, 0x4F, 0x29, 0x51, 0x64, 0xE2, 0x7F, 0xC0, 0xDD, 0xAA, 0x58,
+    0x81, 0x0D, 0x45, 0x60, 0x58, 0x46, 0x72, 0x80, 0x12, 0x07, 0x4E, 0x92, 0xFB, 0x2E, 0xFA, 0xB9,
+    0xBA, 0xE4, 0x1F, 0xB1, 0x20, 0x87, 0x65, 0x5C, 0x34, 0xC9, 0xC5, 0xB7, 0xFC, 0x56, 0x96, 0x96,
+    0xFA, 0x9F, 0x78, 0xFD, 0x53, 0x46, 0xDE, 0x6D, 0x33, 0x0F, 0x21, 0x6D, 0x36, 0x4A, 0x6A, 0x59,
+    0x56, 0xAE, 0x8F, 0x15, 0x81, 0xD4, 0x3D, 0xEA, 0xEA, 0x30, 0xCA, 0x45, 0xB7, 0xAA, 0x17, 0xDD,
+    0xA9, 0x5E, 0x94, 0x85, 0x7A, 0x01, 0xAD, 0x64, 0x04, 0x85, 0xE4, 0x45, 0xC7, 0x11, 0x6C, 0x94,
+    0x31, 0xE3, 0x78, 0x2C, 0xB1, 0x54, 0x11, 0x9C, 0x6E, 0x0F, 0x99, 0x9B, 0xDB, 0x1D, 0xF6, 0x34,
+    0x61, 0x4C, 0xFD, 0x01, 0xA3, 0x3B, 0x77, 0x27, 0x3F, 0x77, 0xB7, 0xC9, 0xD5, 0xF2, 0xA2, 0xEC,
+    0xF3, 0xE3, 0xF2, 0x22, 0x9F, 0xEA, 0x7E, 0x79, 0x91, 0x19, 0x65, 0x6C, 0xDB, 0x3E, 0xBA, 0x83,
+    0x3F, 0x46, 0x2F, 0xCE, 0xEF, 0xB9, 0x6B, 0x3F, 0x1B, 0x3F, 0x5F, 0x3A, 0xA8, 0x30, 0xD4, 0x4F,
+    0x09, 0x5B, 0xF0, 0x05, 0xC9, 0x1D, 0xBD, 0xE8, 0x21, 0x8E, 0x23, 0xA5, 0x72, 0x0A, 0x7C, 0x29,
+    0xA7, 0x04, 0x8F, 0xD8, 0x28, 0xB1, 0x95, 0x1C, 0x20, 0x97, 0xB2, 0x59, 0xF8, 0xA8, 0x7A, 0x2B,
+    0x7B, 0x26, 0x61, 0xF0, 0xA2, 0x9B, 0xC8, 0x6D, 0x65, 0x7B, 0x02, 0x3D, 0xEC, 0x28, 0x03, 0x19,
+    0x98, 0xE5, 0xF9, 0x02, 0x9F, 0x57, 0xC1, 0xD2, 0x17, 0x15, 0xB6, 0x03, 0x11, 0x96, 0x8F, 0x4E,
+    0xC6, 0x58, 0x7D, 0x81, 0xCF, 0x2B, 0x77, 0x85, 0x3D, 0xD0, 0x79, 0x08, 0x9A, 0x18, 0x87, 0x1C,
+    0xE4, 0x50, 0x61, 0xAB, 0x27, 0xFB, 0xBC, 0x8A, 0x75, 0x27, 0x76, 0xEB, 0xC8, 0x5D, 0xE3, 0xE1,
+    0xF8, 0xBC, 0x3E, 0x63, 0xE3, 0x0F, 0xFC, 0xBC, 0xDE, 0xF6, 0x81, 0xDF, 0xF1, 0xF3, 0xF2, 0xE2,
+    0x91, 0xD0, 0xB2, 0xF4, 0x9F, 0x5E, 0x3D, 0x0C, 0xBB, 0xAE, 0x49, 0x0F, 0xDD, 0xFC, 0x21, 0x7E,
+    0x21, 0x5A, 0x47, 0xE2, 0xC8, 0xDF, 0x84, 0xA0, 0x9D, 0x19, 0x19, 0xFE, 0xDC, 0xFE, 0x40, 0x18,
+    0x19, 0x58, 0x75, 0x4C, 0xE4, 0xCD, 0x24, 0x7B, 0xEA, 0x95, 0xA1, 0xA4, 0xBA, 0xC3, 0x07, 0x4C,
+    0xC6, 0x5B, 0x25, 0x06, 0x69, 0x2E, 0x37, 0x6C, 0xC2, 0xC3, 0xDD, 0xD9, 0x7D, 0xB7, 0x52, 0xDC,
+    0xB9, 0x40, 0xF0, 0xB3, 0x8B, 0x8B, 0xFB, 0x81, 0xDE, 0x15, 0xDE, 0x48, 0x72, 0xD7, 0x98, 0x93,
+    0xDA, 0x35, 0x56, 0x47, 0x62, 0xB7, 0x78, 0x96, 0xD1, 0x3A, 0xD5, 0x8D, 0x1B, 0xA9, 0x73, 0xA5,
+    0xBB, 0x51, 0xBA, 0xF4, 0x2B, 0xA1, 0x55, 0x25, 0x8D, 0xCE, 0xB0, 0xB1, 0x46, 0x66, 0xF0, 0xCC,
+    0xA8, 0x8C, 0x8F, 0x1A, 0x91, 0xCB, 0x79, 0xA5, 0x31, 0x18, 0x46, 0x12, 0xE3, 0xA3, 0x46, 0x61,
+    0xB2, 0x9B, 0x04, 0xCE, 0xFD, 0x7B, 0x17, 0x61, 0x8B, 0x7A, 0x8D, 0xC9, 0x1B, 0xA8, 0x5B, 0x83,
+    0x48, 0x24, 0x6E, 0xED, 0xC3, 0xFE, 0xEF, 0xBE, 0x7F, 0xFB, 0x7D, 0xF7, 0xCE, 0x96, 0xA6, 0x7A,
+    0x33, 0xA5, 0x30, 0x2A, 0xB2, 0xC9, 0xD4, 0x17, 0x93, 0x33, 0xA9, 0x31, 0xEB, 0xA1, 0xD6, 0xA9,
+    0x25, 0x5B, 0x75, 0x57, 0x35, 0xDF, 0xAA, 0xA6, 0xEA, 0xEC, 0xFE, 0x62, 0x25, 0xA8, 0x3F, 0x1F,
+    0x8B, 0xA1, 0x38, 0x07, 0x49, 0x0B, 0xFF, 0x2B, 0xDF, 0x90, 0x8A, 0xB5, 0xFF, 0x2C, 0x10, 0x54,
+    0xCD, 0x3E, 0xE9, 0x09, 0xD3, 0xAF, 0xE4, 0x54, 0x83, 0xB6, 0xAB, 0x67, 0x8A, 0x71, 0xE1, 0x9B,
+    0xEA, 0x48, 0x62, 0x0A, 0xC1, 0x4A, 0x7A, 0x03, 0xB8, 0x82, 0x89, 0x02, 0xAC, 0x42, 0x39, 0x92,
+    0x92, 0xC2, 0xA8, 0x6A, 0x24, 0x21, 0xC5, 0x3C, 0xD6, 0xCA, 0xAA, 0x86, 0xAE, 0xA1, 0x77, 0xD5,
+    0xEC, 0x82, 0x5F, 0x68, 0x4D, 0x6D, 0x02, 0x11, 0xDB, 0x31, 0xF5, 0x7B, 0xB3, 0xAA, 0xE2, 0x2A,
+    0x76, 0x05, 0x48, 0xA8, 0x04, 0xDB, 0x55, 0xA0, 0x9A, 0xD2, 0x71, 0x47, 0x02, 0xE6, 0x7E, 0xEA,
+    0xB6, 0xA4, 0x9F, 0xF0, 0xDA, 0x37, 0x2D, 0xC9, 0x77, 0x1E, 0x1B, 0x01, 0xBB, 0xC0, 0x18, 0xC3,
+    0x49, 0x9B, 0xD1, 0xB3, 0x89, 0xBC, 0x5F, 0xDD, 0x18, 0x2E, 0xA5, 0xD9, 0x3D, 0x1A, 0xC0, 0x9A,
+    0xC2, 0xC6, 0x0B, 0xBC, 0x85, 0xDA, 0x41, 0xD8, 0x42, 0x75, 0x9E, 0x70, 0x12, 0x7A, 0xC1, 0xAA,
+    0xF5, 0x02, 0x35, 0x83, 0xC8, 0xED, 0xC9, 0x09, 0x78, 0x0B, 0x25, 0x3E, 0x18, 0xA0, 0x7B, 0xCA,
+    0x38, 0xD9, 0xD2, 0x5B, 0xA8, 0x4C, 0xE9, 0x2F, 0x5C, 0x06, 0x56, 0x9A, 0xBF, 0x78, 0xA5, 0xFE,
+    0xEA, 0x6A, 0x8B, 0x05, 0xAA, 0xD3, 0x2C, 0x83, 0x5E, 0x56, 0x36, 0xE1, 0x4A, 0x31, 0x19, 0x6D,
+    0xDB, 0x5D, 0xD0, 0x50, 0x93, 0x10, 0xC8, 0x28, 0x23, 0x02, 0x93, 0x85, 0xD2, 0xD3, 0xD5, 0xEA,
+    0xC4, 0x14, 0xCE, 0xDB, 0xA7, 0xF3, 0xB9, 0x59, 0x2D, 0x2E, 0xFD, 0x8D, 0x13, 0xA1, 0xC3, 0x02,
+    0x85, 0xDD, 0x58, 0x9F, 0x48, 0x01, 0x96, 0x27, 0x8B, 0xA1, 0x37, 0xE9, 0x49, 0x46, 0xF3, 0x97,
+    0xA6, 0xC0, 0x12, 0x78, 0xDC, 0xE3, 0xA2, 0x84, 0x50, 0x20, 0xA1, 0x2C, 0x03, 0x14, 0x14, 0xEA,
+    0x28, 0xED, 0x94, 0x4A, 0xBA, 0x44, 0x25, 0x10, 0x3D, 0xF4, 0xCE, 0x99, 0xE6, 0x25, 0x24, 0x55,
+    0x03, 0xDA, 0xC9, 0xB3, 0x41, 0xBA, 0xDC, 0x93, 0x72, 0x85, 0x27, 0xE1, 0xE4, 0xD9, 0x58, 0x56,
+    0x71, 0xE4, 0xB2, 0xC2, 0x72, 0xAA, 0x89, 0x44, 0xD3, 0xB0, 0x44, 0x69, 0xA6, 0xB2, 0xA8, 0x24,
+    0x93, 0x67, 0x83, 0x62, 0xBA, 0x1C, 0x1B, 0x83, 0x32, 0x05, 0x4D, 0x0A, 0xBA, 0xE3, 0xCC, 0xE6,
+    0xCA, 0xCF, 0xAD, 0x47, 0xA4, 0xD5, 0xC6, 0x48, 0xB5, 0x31, 0x25, 0xDD, 0x98, 0x21, 0xA4, 0xEB,
+    0x97, 0x40, 0x45, 0xA8, 0xA5, 0xEE, 0x55, 0x4D, 0x86, 0x51, 0x48, 0x2D, 0xD7, 0xD1, 0x14, 0x24,
+    0x3F, 0x90, 0x26, 0x21, 0x0C, 0x18, 0x41, 0x1D, 0x48, 0xBE, 0x08, 0x14, 0x28, 0x42, 0x7A, 0x90,
+    0x1A, 0x72, 0x4D, 0x54, 0x13, 0x94, 0x12, 0xA4, 0x03, 0xA8, 0xB0, 0x05, 0x0D, 0x9A, 0x42, 0xED,
+    0x4E, 0x53, 0x80, 0x1D, 0x85, 0xC6, 0x83, 0xB6, 0xF7, 0x0A, 0x0F, 0x64, 0x38, 0xA6, 0xBB, 0x9E,
+    0x2C, 0x18, 0xEB, 0x10, 0x8B, 0xA9, 0xBE, 0x0D, 0xB6, 0x5B, 0xEC, 0x95, 0x81, 0x04, 0x0D, 0xC4,
+    0x46, 0xAF, 0xB2, 0xD7, 0x06, 0x86, 0x1B, 0xD2, 0x78, 0xC4, 0x75, 0xC0, 0x3F, 0xB7, 0xF6, 0x96,
+    0x84, 0x3C, 0xC9, 0xE5, 0x2E, 0xB2, 0x8E, 0x0C, 0x9E, 0xB4, 0x97, 0x29, 0xC8, 0x60, 0x53, 0x15,
+    0xE8, 0x52, 0x3E, 0xB7, 0x99, 0xCD, 0xCF, 0xC9, 0xEE, 0x8F, 0xCB, 0xB4, 0xA0, 0xF0, 0xD4, 0x72,
+    0xFB, 0x82, 0x0C, 0xAB, 0xFF, 0x03, 0xEB, 0x57, 0x11, 0x6A, 0x7F, 0xE5, 0xD5, 0x6E, 0x28, 0xA5,
+    0xBA, 0x7F, 0x15, 0x21, 0x67, 0x28, 0xE9, 0x3F, 0x11, 0x9D, 0x67, 0x38, 0xE9, 0x77, 0x9C, 0x0E,
+    0x98, 0xEE, 0x85, 0x74, 0xAD, 0x46, 0x7D, 0xDB, 0xAE, 0xEF, 0x0E, 0xBA, 0x41, 0x31, 0x95, 0x75,
+    0xDF, 0x41, 0xAE, 0x64, 0x7D, 0xF5, 0x40, 0xD1, 0xCA, 0xF4, 0xAE, 0xA0, 0xA8, 0xB2, 0xA8, 0x3C,
+    0x6A, 0xB4, 0xB4, 0xD3, 0xF5, 0x15, 0xB3, 0xDF, 0x62, 0x3F, 0xBA, 0x3E, 0xDD, 0xCF, 0x96, 0xC2,
+    0x6E, 0xFB, 0x99, 0x34, 0x02, 0xE1, 0x7E, 0x34, 0xEA, 0xB3, 0xFD, 0x8C, 0x4E, 0x1D, 0x95, 0x2A,
+    0x69, 0x35, 0x20, 0x10, 0xC1, 0x26, 0x7A, 0x04, 0x01, 0xE5, 0x1A, 0x96, 0x54, 0xD3, 0x32, 0xAD,
+    0xA7, 0x35, 0x88, 0x09, 0x5A, 0x9A, 0x07, 0x03, 0x8E, 0xE9, 0x61, 0x9D, 0x6E, 0x97, 0xE9, 0x72,
+    0xAF, 0x5B, 0xFE, 0x32, 0x0E, 0x6E, 0xDE, 0x8E, 0x02, 0xA4, 0x85, 0x2D, 0x39, 0x72, 0x11, 0xB0,
+    0x45, 0xA7, 0xC6, 0x0B, 0x46, 0x1D, 0x98, 0xA6, 0x6A, 0xB0, 0xC9, 0x16, 0x6A, 0x3C, 0xD8, 0x12,
+    0xA6, 0xC2, 0x96, 0xF3, 0xFB, 0x0B, 0x5B, 0x60, 0x54, 0xC8, 0x16, 0x04, 0xF1, 0x64, 0x8B, 0x52,
+    0xDD, 0xD8, 0xA2, 0x46, 0xD0, 0xD8, 0x02, 0x33, 0x48, 0xB6, 0xC0, 0xFE, 0x91, 0x2D, 0x32, 0x35,
+    0xB6, 0x24, 0x08, 0xC7, 0xC1, 0x96, 0x14, 0x56, 0x10, 0x6C, 0xE1, 0x14, 0x6C, 0xC9, 0x10, 0xA0,
+    0x82, 0x2D, 0xAA, 0xD7, 0xC6, 0x16, 0xA5, 0xBA, 0xB1, 0x05, 0x9B, 0x20, 0x5B, 0x0A, 0x4E, 0x95,
+    0x2D, 0x4A, 0x75, 0x63, 0x8B, 0x1A, 0x72, 0x63, 0x0B, 0x0C, 0x24, 0xD9, 0xA2, 0x0C, 0x30, 0xB6,
+    0xD4, 0x11, 0x2F, 0xC6, 0x65, 0xDA, 0xAE, 0xA1, 0x4C, 0xB7, 0x06, 0x9D, 0x0B, 0x5B, 0x92, 0x8F,
+    0xCC, 0x22, 0x20, 0xF6, 0xDC, 0xAD, 0xD3, 0x66, 0x99, 0x1E, 0x57, 0xBE, 0x1E, 0x56, 0xFE, 0x9C,
+    0x85, 0x37, 0x54, 0xC3, 0xF5, 0x87, 0xB6, 0x61, 0x52, 0x87, 0x7F, 0x95, 0x7B, 0xF7, 0xFC, 0xCF,
+    0x79, 0x53, 0xC9, 0xFD, 0x2E, 0x24, 0x3E, 0xF8, 0xC4, 0x33, 0xF1, 0x68, 0x7F, 0xE2, 0x11, 0xDE,
+    0xBB, 0xEE, 0xDF, 0x4D, 0x50, 0xBD, 0x04, 0x19, 0x5B, 0x4C, 0xA6, 0x8C, 0xE4, 0xF2, 0x03, 0x2D,
+    0x44, 0xA2, 0x61, 0x9F, 0x4E, 0x90, 0x0E, 0x34, 0x88, 0x22, 0x31, 0x41, 0x62, 0xB0, 0x01, 0x5B,
+    0x37, 0x90, 0x8D, 0x6A, 0xB2, 0x54, 0xA0, 0x9E, 0xCC, 0x96, 0x68, 0x84, 0x85, 0x1C, 0x4F, 0x16,
+    0xC8, 0xAC, 0x40, 0x98, 0xC9, 0xB4, 0x40, 0x68, 0xC4, 0xBC, 0xC0, 0x43, 0x17, 0x69, 0xBC, 0x64,
+    0xD2, 0xC2, 0x72, 0xD5, 0x03, 0x4C, 0x98, 0x91, 0x69, 0x89, 0x3A, 0xB2, 0x20, 0xCF, 0x9B, 0x40,
+    0xB6, 0xC2, 0x5C, 0xCE, 0xED, 0xCE, 0x87, 0x3F, 0x1C, 0xC3, 0x64, 0x0C, 0x93, 0xC3, 0xA9, 0x37,
+    0x7A, 0xA7, 0x49, 0x3F, 0x54, 0xA2, 0xED, 0x4B, 0x7D, 0x47, 0x39, 0x74, 0x8C, 0xB2, 0x70, 0xCB,
+    0x8C, 0x1F, 0x4F, 0xED, 0xC3, 0x17, 0xF7, 0x4E, 0xD2, 0x80, 0x7D, 0x74, 0xBF, 0x92, 0xAC, 0xAD,
+    0x39, 0xB4, 0x1C, 0xFC, 0xD3, 0x1E, 0x9F, 0xFE, 0xC7, 0x1E, 0xF7, 0x2A, 0x91, 0x10, 0xCE, 0x18,
+    0x8A, 0x09, 0x8F, 0xAB, 0xC6, 0x02, 0x91, 0x40, 0x8F, 0xA1, 0x3B, 0x20, 0x06, 0x93, 0xD8, 0x04,
+    0xC1, 0xE3, 0x56, 0x07, 0xA5, 0xED, 0xB4, 0xA4, 0x1B, 0x25, 0xD2, 0x67, 0xF8, 0x18, 0x35, 0x69,
+    0xCC, 0xCF, 0xFD, 0xE7, 0x57, 0x8F, 0x66, 0x58, 0xDC, 0x1C, 0xEC, 0x50, 0x06, 0x98, 0xE7, 0x2F,
+    0xA0, 0xC4, 0x30, 0x1D, 0x19, 0xFD, 0xB9, 0xAA, 0xF5, 0x2D, 0x04, 0xD7, 0x0C, 0xAB, 0x19, 0x50,
+    0x33, 0x94, 0x66, 0x10, 0x6D, 0x81, 0xDE, 0xD9, 0x9A, 0x1F, 0x26, 0x1F, 0x37, 0x17, 0xAA, 0xF6,
+    0x07, 0x44, 0x95, 0x9F, 0x5B, 0x1A, 0x2F, 0xB7, 0x9A, 0x61, 0xC2, 0xF6, 0x12, 0xC5, 0x31, 0x80,
+    0xA3, 0xB7, 0xA8, 0xC0, 0xDB, 0x7A, 0x32, 0x96, 0xAA, 0x76, 0x83, 0xA5, 0x2D, 0x74, 0xDB, 0xA2,
+    0xB3, 0x41, 0xC5, 0xBA, 0x1D, 0x35, 0x8C, 0xD3, 0x4C, 0x6F, 0xCF, 0x48, 0x4C, 0xB3, 0x3C, 0x18,
+    0xFE, 0x51, 0x78, 0x8B, 0xD0, 0x2B, 0x44, 0x5D, 0xB7, 0x1E, 0xBA, 0xBB, 0x97, 0x2E, 0x9B, 0x1D,
+    0xE2, 0xED, 0xB7, 0xD4, 0xD0, 0x74, 0x4F, 0x41, 0x3B, 0x30, 0xA0, 0x82, 0x2C, 0x9C, 0x5D, 0x44,
+    0xEC, 0xD1, 0x1D, 0xD1, 0x12, 0x16, 0xE1, 0xBA, 0x5F, 0x14, 0x8B, 0x65, 0x0A, 0xAA, 0xA6, 0xB9,
+    0xAD, 0xC3, 0x35, 0xB7, 0x95, 0x2E, 0x19, 0x11, 0x23, 0x2A, 0x0B, 0xFA, 0x2C, 0xFD, 0xA6, 0xA8,
+    0x21, 0x28, 0x60, 0x9E, 0x6B, 0xF1, 0x49, 0xEC, 0x89, 0x2D, 0x90, 0xD7, 0x3B, 0x54, 0x78, 0x78,
+    0x0D, 0x5D, 0xE7, 0x15, 0x61, 0x78, 0x3E, 0xA9, 0x7F, 0x9B, 0x4B, 0x55, 0x44, 0x18, 0x3B, 0xA6,
+    0x32, 0xAA, 0xA6, 0x0B, 0xF9, 0x31, 0xAB, 0x43, 0x78, 0xC8, 0x35, 0x33, 0x36, 0x3C, 0xD8, 0x82,
+    0x97, 0x78, 0x30, 0x84, 0x7F, 0x5B, 0xD3, 0x89, 0x25, 0xE4, 0x5B, 0x83, 0xD2, 0x35, 0x18, 0xE5,
+    0x22, 0x19, 0x89, 0x0E, 0x71, 0xEA, 0x2C, 0x49, 0xF3, 0xB4, 0xA6, 0xCB, 0x96, 0x28, 0xA7, 0x16,
+    0xA3, 0xF8, 0xE9, 0xF9, 0xB4, 0xF8, 0x0E, 0xF4, 0x03, 0xC5, 0x2D, 0x4A, 0xEA, 0x81, 0x01, 0xA4,
+    0xDA, 0x74, 0xFF, 0x6B, 0x58, 0x19, 0xA4, 0x91, 0xAC, 0x6B, 0x31, 0xCA, 0xF7, 0xA1, 0xAA, 0x65,
+    0x45, 0x2D, 0xAB, 0x65, 0xD9, 0x60, 0x15, 0xAD, 0x8E, 0x05, 0x2D, 0xAB, 0x67, 0xE9, 0x20, 0xEF,
+    0xF6, 0xAC, 0x66, 0x79, 0x16, 0xB3, 0xAC, 0x96, 0x85, 0x52, 0x16, 0x52, 0x27, 0xAD, 0x1E, 0x40,
+    0x20, 0x77, 0xA1, 0x8E, 0x65, 0x65, 0xAC, 0x0D, 0xB3, 0x4D, 0x95, 0x5D, 0xD6, 0x13, 0x8E, 0x51,
+    0x09, 0x8B, 0x49, 0x51, 0x2E, 0xF9, 0x90, 0xEC, 0x78, 0x56, 0x8D, 0x23, 0x43, 0x64, 0x03, 0xBB,
+    0x90, 0x90, 0x47, 0x3C, 0x41, 0x71, 0x0B, 0x7B, 0x6D, 0xC0, 0xCF, 0x3D, 0x6E, 0xDB, 0x23, 0xBB,
+    0x19, 0x51, 0xD7, 0x9A, 0xAC, 0xAC, 0x55, 0xCE, 0x66, 0xE2, 0xD4, 0xEE, 0x4D, 0xE6, 0xF5, 0xF4,
+    0x3A, 0xAC, 0x31, 0x14, 0xEB, 0x59, 0x54, 0x0C, 0x96, 0x41, 0x58, 0xCC, 0x62, 0x2D, 0x8B, 0xA5,
+    0x2C, 0xAB, 0x64, 0xB1, 0x90, 0x65, 0x75, 0x2C, 0x31, 0x5D, 0x0F, 0x69, 0xBA, 0x94, 0x7F, 0x55,
+    0x1F, 0x9B, 0x2E, 0x8B, 0x25, 0x33, 0x0B, 0x25, 0x2F, 0xD6, 0xD0, 0x5B, 0x9F, 0xB2, 0xF1, 0x4B,
+    0x32, 0xCB, 0xDC, 0x15, 0x69, 0xEB, 0xCC, 0xDA, 0xD6, 0x11, 0x43, 0x35, 0x31, 0x67, 0x9D, 0x98,
+    0xAE, 0x8E, 0xA1, 0xB8, 0x65, 0xA5, 0x2D, 0xAB, 0x2F, 0x5A, 0x7A, 0x6B, 0x45, 0x2D, 0xB5, 0x33,
+    0x5A, 0xD6, 0xA4, 0x5F, 0xB1, 0x72, 0x96, 0x15, 0xB3, 0x5A, 0x96, 0xB2, 0x64, 0x40, 0xC1, 0x8D,
+    0x77, 0xB0, 0x22, 0x96, 0xB0, 0xAD, 0x3E, 0xB2, 0x80, 0x35, 0x2D, 0xE5, 0xAB, 0x82, 0x8C, 0xCA,
+    0x3C, 0x25, 0xAF, 0xE5, 0x4E, 0xAC, 0x6C, 0xF5, 0xC6, 0xA5, 0x13, 0x51, 0x2D, 0x86, 0x8D, 0x7C,
+    0x6C, 0x33, 0xA9, 0x33, 0xCC, 0xC8, 0x56, 0xEE, 0xBE, 0x9B, 0x4F, 0xF9, 0x95, 0x5C, 0xA8, 0x6D,
+    0xA0, 0x63, 0xA2, 0x57, 0x62, 0x79, 0x8A, 0x6E, 0xA8, 0x0C, 0x91, 0x34, 0x03, 0xDB, 0x3A, 0x18,
+    0xAC, 0x9A, 0x06, 0x0B, 0x71, 0x48, 0x87, 0xB8, 0xC3, 0x22, 0x69, 0x89, 0xA1, 0xF5, 0xBA, 0x41,
+    0x08, 0xA8, 0x92, 0xE6, 0x87, 0x16, 0x65, 0xDC, 0x19, 0x55, 0x8D, 0x67, 0x9A, 0xFF, 0xFB, 0x5F,
+    0x42, 0xBE, 0xDF, 0xD4, 0xC5, 0xDF, 0x0F, 0xAB, 0x80, 0x07, 0xC9, 0x69, 0x6C, 0x69, 0x95, 0xC2,
+    0x10, 0x16, 0xEA, 0x5E, 0x83, 0x45, 0xE9, 0x51, 0xDB, 0xAA, 0x7A, 0x4A, 0x1F, 0x87, 0x72, 0xDF,
+    0x35, 0xD7, 0xBD, 0xF9, 0x8D, 0xE6, 0xE5, 0xF8, 0xD5, 0x78, 0xB9, 0x04, 0x3F, 0x48, 0xB7, 0x3D,
+    0x7C, 0x95, 0xCA, 0x41, 0x82, 0x82, 0x82, 0x39, 0xFD, 0x51, 0xB2, 0x1C, 0xB7, 0x39, 0x56, 0xBD,
+    0x1A, 0xA6, 0xF5, 0x9A, 0x5C, 0xDE, 0x6A, 0x6E, 0x14, 0x8F, 0x17, 0xD3, 0x48, 0xAE, 0xA6, 0xA1,
+    0xFE, 0xCA, 0xE0, 0x83, 0x71, 0x44, 0xB5, 0x8F, 0x58, 0x5D, 0xEE, 0x6B, 0x55, 0xE9, 0xFA, 0xD0,
+    0x81, 0xD5, 0x07, 0x28, 0x78, 0xB5, 0x6B, 0xDD, 0xAB, 0xCB, 0x6A, 0xC7, 0x3A, 0x8D, 0x85, 0xAE,
+    0xE6, 0x72, 0x61, 0xB4, 0xE0, 0x5C, 0xCE, 0x94, 0x80, 0xD9, 0x90, 0xCB, 0xDF, 0xF3, 0xB1, 0xD4,
+    0x5B, 0x8E, 0x60, 0xF8, 0x50, 0x1E, 0x6E, 0x20, 0xC3, 0x25, 0x22, 0xBF, 0x0F, 0x8D, 0xC5, 0xE2,
+    0xB3, 0xA9, 0x62, 0x1C, 0xC1, 0xD8, 0xB4, 0x3B, 0x46, 0x11, 0xF9, 0xAA, 0xDB, 0xDB, 0xFF, 0x67,
+    0xBA, 0x9D, 0x89, 0x83, 0x96, 0xED, 0xCD, 0x6A, 0xAD, 0x5D, 0x8B, 0xA8, 0xB8, 0xF2, 0xBB, 0x28,
+    0x60, 0x5F, 0x35, 0xDC, 0x74, 0xBB, 0xBE, 0xB9, 0x1A, 0x6E, 0x81, 0x31, 0x83, 0xC1, 0xA0, 0xD9,
+    0xCE, 0x72, 0x91, 0x9A, 0xB9, 0x49, 0x71, 0xF8, 0x1D, 0x1A, 0x8E, 0x41, 0x34, 0xFC, 0x95, 0x36,
+    0xE6, 0xA0, 0x03, 0xAF, 0x35, 0x33, 0x24, 0xD8, 0xC3, 0x0D, 0x2D, 0xA0, 0xBE, 0x37, 0x1D, 0x94,
+    0xE1, 0xF9, 0x04, 0x0D, 0x9F, 0x6E, 0xAE, 0x86, 0x27, 0xDD, 0x63, 0xA4, 0x5A, 0x0D, 0x23, 0x47,
+    0xD0, 0x60, 0xFE, 0xB6, 0xD0, 0x63, 0xCB, 0x08, 0xBA, 0xB2, 0xEE, 0x96, 0x3B, 0x7B, 0xA0, 0x99,
+    0xAE, 0x78, 0x2E, 0xCD, 0xD5, 0x34, 0xDA, 0x9C, 0x0A, 0xFF, 0xA4, 0x1D, 0x25, 0x56, 0x6D, 0x07,
+    0xA4, 0xB6, 0xB5, 0x2E, 0xA3, 0x1E, 0x50, 0xF7, 0xEE, 0xB4, 0x4B, 0xE2, 0x8F, 0xCC, 0x50, 0x98,
+    0xF8, 0x9F, 0xDD, 0x7B, 0x41, 0x94, 0x90, 0xFF, 0xCE, 0x28, 0xA1, 0x66, 0x94, 0xD0, 0x45, 0xC1,
+    0x42, 0x79, 0x78, 0x5E, 0xB0, 0xBE, 0xC9, 0xC9, 0x6A, 0xA8, 0x6E, 0x80, 0x44, 0x1D, 0x44, 0x8E,
+    0x82, 0x77, 0x71, 0xB1, 0x66, 0x7B, 0x1F, 0xA7, 0x23, 0x7A, 0x43, 0xF8, 0x0C, 0x16, 0x34, 0xE7,
+    0xBA, 0xC8, 0xB7, 0x93, 0xCB, 0x2F, 0x49, 0x62, 0xD3, 0x3F, 0x60, 0x12, 0x3B, 0x5D, 0x4F, 0x62,
+    0x17, 0xE6, 0xAE, 0xB1, 0xDF, 0x81, 0xA5, 0xF2, 0x17, 0x54, 0x6A, 0x6A, 0x5A, 0x14, 0x36, 0x39,
+    0x5D, 0xC7, 0xC1, 0x78, 0xFB, 0xDA, 0xAB, 0xC5, 0xDC, 0x0E, 0xCC, 0xF5, 0x2F, 0x61, 0x6E, 0x32,
+    0xB2, 0x0B, 0x18, 0x5D, 0x99, 0x84, 0xDE, 0x73, 0x37, 0x8B, 0xB9, 0x32, 0xBB, 0x08, 0x89, 0x56,
+    0xBD, 0x54, 0x5B, 0xEB, 0xA5, 0xAA, 0xD7, 0x2E, 0x6D, 0xE6, 0xF3, 0x68, 0x7B, 0xA1, 0x58, 0xE7,
+    0xBD, 0xD5, 0x6A, 0xEB, 0x65, 0xA6, 0x13, 0x2B, 0xA7, 0x7B, 0x6B, 0xE5, 0x67, 0xCB, 0x2C, 0xF7,
+    0x45, 0xE8, 0x8C, 0x1C, 0x43, 0x6F, 0xA4, 0x9E, 0x42, 0x69, 0xB8, 0xEB, 0x43, 0x61, 0xD0, 0x1F,
+    0x6C, 0x26, 0x0C, 0xB1, 0xB2, 0xA4, 0xF0, 0xA4, 0x03, 0x17, 0x91, 0x56, 0x33, 0xB3, 0xAC, 0x60,
+    0xB7, 0x06, 0x16, 0x12, 0x0D, 0x40, 0xE0, 0xC5, 0x60, 0x3D, 0x51, 0x81, 0x4D, 0xC3, 0x43, 0x91,
+    0x45, 0x87, 0x56, 0xAF, 0xB7, 0x3D, 0xAA, 0x5F, 0xE0, 0x1E, 0xEB, 0xF9, 0xEA, 0x91, 0x0F, 0xE1,
+    0x2F, 0x0B, 0x25, 0x09, 0xFC, 0xD8, 0xD5, 0xD5, 0xD6, 0x65, 0xD6, 0x1C, 0xDF, 0xA1, 0x63, 0xC7,
+    0xE4, 0x56, 0x9D, 0x4C, 0xC9, 0x76, 0xE5, 0xD2, 0x16, 0x8E, 0xE8, 0x53, 0x1B, 0xC5, 0x02, 0xE5,
+    0x3A, 0x83, 0x31, 0x9C, 0x5F, 0x9C, 0x78, 0x1B, 0xE1, 0xFE, 0x9D, 0x67, 0xD0, 0x80, 0x59, 0x6F,
+    0xDF, 0x6A, 0x8F, 0x51, 0x16, 0x00, 0x52, 0x69, 0xE5, 0x52, 0x5E, 0x0E, 0xED, 0xA8, 0x76, 0xD7,
+    0x6F, 0xAB, 0x09, 0x2D, 0x5F, 0x15, 0xF8, 0x99, 0xFC, 0xAF, 0x54, 0x0E, 0x52, 0x31, 0xCF, 0xEC,
+    0xD0, 0xEF, 0x55, 0x16, 0x74, 0x21, 0xEA, 0x4A, 0x3C, 0x81, 0x3B, 0xE2, 0x1C, 0x9A, 0x80, 0x37,
+    0x41, 0xA7, 0x83, 0x1D, 0x45, 0x66, 0xD7, 0x2A, 0x1D, 0x47, 0xF7, 0x27, 0xE4, 0x9B, 0x2C, 0xB0,
+    0xB4, 0x31, 0x17, 0x19, 0xD1, 0x51, 0xA4, 0xE4, 0x58, 0xF9, 0xC7, 0x90, 0x93, 0xD8, 0x4B, 0xDE,
+    0x02, 0xF9, 0xC0, 0x88, 0xCD, 0xD2, 0xC9, 0x1D, 0x75, 0xF5, 0xEA, 0xAF, 0x44, 0x8F, 0x0E, 0x44,
+    0x42, 0xE4, 0x16, 0x2A, 0x35, 0x8E, 0x2D, 0x66, 0x00, 0x75, 0x58, 0xBF, 0xC1, 0xBE, 0xB4, 0x5F,
+    0xDB, 0x89, 0xB4, 0xCA, 0xB5, 0x17, 0x46, 0x1D, 0xE4, 0xD3, 0xDF, 0xF6, 0x7B, 0x42, 0x56, 0x7C,
+    0x9F, 0x7E, 0xE4, 0xFF, 0xB3, 0xEB, 0xE5, 0x01, 0x53, 0x37, 0xE8, 0xB5, 0x1D, 0x45, 0x83, 0x47,
+    0xB9, 0xC3, 0x46, 0xC9, 0xB0, 0x2D, 0xBD, 0xD5, 0x47, 0x36, 0xD4, 0xE4, 0x45, 0xBB, 0x2F, 0x97,
+    0xAA, 0xC1, 0x83, 0x4B, 0x49, 0x69, 0x32, 0x3F, 0xD5, 0x7B, 0x03, 0x61, 0x50, 0x11, 0xBC, 0xF8,
+    0xB0, 0x5D, 0xE2, 0xFB, 0x42, 0x4B, 0xC5, 0xBB, 0x5C, 0xE1, 0x20, 0x5B, 0xBA, 0x6A, 0x42, 0x41,
+    0xF2, 0xD9, 0x1A, 0x32, 0xE6, 0xB0, 0x83, 0xCF, 0xAE, 0x51, 0x14, 0xE9, 0xB4, 0xDD, 0xFE, 0x0F,
+    0x7E, 0xB0, 0x9E, 0xBD, 0x3C, 0x1D, 0x2D, 0x96, 0x59, 0x6B, 0x5C, 0x0F, 0x0E, 0xDD, 0xD2, 0x49,
+    0x92, 0xAD, 0x3C, 0x09, 0x0D, 0xFF, 0x1C, 0x2B, 0x3C, 0xFB, 0x8E, 0xBF, 0xEF, 0x7E, 0x88, 0x14,
+    0x82, 0x42, 0xDC, 0x41, 0x6C, 0x5B, 0x88, 0xE5, 0x2D, 0x43, 0x26, 0xDD, 0x45, 0x7D, 0x40, 0xA3,
+    0x72, 0xB4, 0x9A, 0x50, 0x21, 0x08, 0x25, 0x82, 0x50, 0x66, 0xB7, 0x02, 0xD0, 0x49, 0x29, 0x8B,
+    0x3C, 0xB1, 0x1B, 0x6F, 0x56, 0x53, 0xA7, 0x9D, 0x0A, 0xE5, 0x8B, 0x23, 0x63, 0x1C, 0x39, 0xE3,
+    0x16, 0xD4, 0x43, 0xE3, 0x16, 0xE6, 0x18, 0x77, 0x42, 0x63, 0x80, 0xFC, 0x71, 0x64, 0x90, 0x23,
+    0x87, 0x64, 0xC0, 0x5A, 0x44, 0xBF, 0xAE, 0x94, 0x92, 0x3D, 0xCB, 0xEF, 0x3D, 0x02, 0xB1, 0xCE,
+    0xE2, 0xB1, 0x89, 0x81, 0x5D, 0xE8, 0x74, 0x3D, 0x79, 0xE4, 0x5D, 0x5C, 0xCA, 0x62, 0xD5, 0x16,
+    0x4A, 0x6C, 0xDC, 0x32, 0x76, 0xA5, 0x0F, 0xDD, 0x1B, 0xEF, 0xCB, 0x3A, 0x9D, 0x96, 0x83, 0xBA,
+    0x1F, 0x13, 0x4F, 0x82, 0x40, 0xC5, 0x7C, 0xCE, 0x9E, 0x91, 0xD5, 0x5A, 0xCA, 0x22, 0x7F, 0x47,
+    0xF2, 0xB7, 0x0B, 0x86, 0x4E, 0x38, 0xA2, 0xFC, 0x1D, 0xC0, 0xDF, 0x7D, 0x8E, 0x96, 0x1C, 0xF8,
+    0xDB, 0xD0, 0x9C, 0xE7, 0x0B, 0x97, 0xE7, 0x13, 0xFE, 0xB2, 0xD6, 0xD5, 0x02, 0xD3, 0xE0, 0x95,
+    0xCB, 0x6F, 0xC5, 0x5C, 0x46, 0x91, 0xEC, 0xA8, 0xFC, 0xED, 0x7A, 0xFA, 0x2D, 0x90, 0x30, 0x59,
+    0x8A, 0xAD, 0xDF, 0x85, 0x75, 0x68, 0xDF, 0xD3, 0x12, 0x7E, 0x4B, 0x34, 0xC6, 0x09, 0x7F, 0xC7,
+    0xA8, 0x5E, 0x67, 0x05, 0x3B, 0xAB, 0xD8, 0x85, 0x92, 0x9D, 0xD5, 0xEC, 0xAC, 0x68, 0x77, 0x52,
+    0xB5, 0x03, 0xC2, 0xA2, 0x67, 0xBB, 0x17, 0x71, 0x75, 0x41, 0xC4, 0x81, 0xE2, 0x10, 0x64, 0xD1,
+    0x0A, 0xB5, 0x29, 0xD5, 0x14, 0xA8, 0x39, 0x44, 0xDB, 0xB2, 0x1E, 0xC1, 0xDB, 0x7A, 0x00, 0x53,
+    0xDB, 0x1E, 0x8F, 0xEF, 0xFE, 0x8B, 0x2D, 0xF9, 0xCF, 0xF0, 0x1C, 0xFF, 0x94, 0x68, 0x1B, 0x98,
+    0xA6, 0x84, 0xEE, 0x2B, 0xA5, 0x69, 0xCC, 0xF8, 0x96, 0xCC, 0x7F, 0x8F, 0x01, 0xF3, 0x9B, 0xFA,
+    0x39, 0x59, 0x83, 0x3E, 0x20, 0x94, 0x37, 0x67, 0x94, 0x89, 0x0B, 0xE8, 0x05, 0xC8, 0x37, 0x5B,
+    0x9B, 0xD9, 0x86, 0x86, 0x21, 0xFE, 0xD6, 0x25, 0x57, 0x8A, 0x8A, 0x91, 0x44, 0xA3, 0x95, 0x9B,
+    0xB4, 0x3F, 0x45, 0x55, 0xF9, 0x8B, 0x79, 0xE9, 0x6D, 0xE4, 0x2C, 0x60, 0x47, 0x85, 0x3E, 0x22,
+    0xDC, 0x4E, 0x8A, 0xD6, 0x2F, 0x2B, 0x57, 0x8F, 0x76, 0x15, 0x5A, 0xD5, 0xB0, 0x6E, 0x6D, 0x9F,
+    0x41, 0x22, 0xF5, 0xF9, 0xE2, 0x40, 0x90, 0x3E, 0x78, 0x05, 0x30, 0xFE, 0x18, 0xF8, 0x83, 0x7F,
+    0x41, 0xE7, 0xE0, 0x11, 0x4B, 0x35, 0x43, 0xB8, 0x6E, 0x02, 0x24, 0x0A, 0x50, 0x8E, 0xA7, 0x80,
+    0x1A, 0xA0, 0xC1, 0x76, 0xD4, 0xF5, 0x97, 0x13, 0xD3, 0x96, 0x84, 0xAD, 0x1D, 0x76, 0x7A, 0x3A,
+    0x46, 0xEC, 0xD3, 0x2B, 0x52, 0x4C, 0xA6, 0x1D, 0xB0, 0xF0, 0xA4, 0x60, 0xC4, 0x5E, 0x1E, 0xA2,
+    0xA2, 0x8F, 0xAB, 0xFF, 0xDB, 0xFA, 0xA2, 0x4D, 0x64, 0x38, 0x52, 0x7F, 0x12, 0x0A, 0x68, 0x6D,
+    0x39, 0x37, 0x08, 0x0F, 0x13, 0x0E, 0xD4, 0x95, 0x51, 0x56, 0x46, 0x55, 0x19, 0x45, 0x65, 0xE8,
+    0x19, 0x4A, 0xCA, 0xA8, 0x28, 0xA3, 0xA0, 0x8C, 0x7A, 0x32, 0xCA, 0xC9, 0x70, 0x56, 0x28, 0x26,
+    0xA3, 0x96, 0x0C, 0x6F, 0x8B, 0x4A, 0x72, 0x66, 0xC6, 0x4C, 0xD1, 0x0E, 0x43, 0xC8, 0x58, 0x21,
+    0xB3, 0xC7, 0xB0, 0xF4, 0x6C, 0xFE, 0xAE, 0xA3, 0x85, 0x23, 0x24, 0xAF, 0x5D, 0x53, 0x8F, 0xB3,
+    0x25, 0x7E, 0x3D, 0xB8, 0xD0, 0x52, 0xD1, 0x61, 0xC7, 0xFF, 0x35, 0x7F, 0xE4, 0x63, 0x14, 0x96,
+    0x28, 0xAD, 0x0C, 0x2B, 0x49, 0xE3, 0xD7, 0x87, 0xF8, 0xFF, 0x86, 0x73, 0xF9, 0x4A, 0xDB, 0x6D,
+    0x92, 0x79, 0x68, 0x52, 0xCE, 0x02, 0x55, 0x61, 0xC0, 0x0D, 0x7C, 0x90, 0xBE, 0x6F, 0x65, 0x36,
+    0xCD, 0x7A, 0x8E, 0x6B, 0xB1, 0x5C, 0x0F, 0x01, 0x8B, 0x6B, 0xD5, 0xBE, 0x6E, 0x74, 0x01, 0xB3,
+    0x48, 0x72, 0x51, 0xEB, 0x7D, 0xBF, 0xFC, 0x39, 0xF3, 0x04, 0x2D, 0xA9, 0xA8, 0xE4, 0x01, 0x72,
+    0x3C, 0xAD, 0x2E, 0x95, 0x08, 0x88, 0x22, 0x9A, 0x0B, 0xCB, 0xFF, 0x94, 0x5D, 0xF8, 0xCB, 0x8D,
+    0x67, 0xD8, 0xD6, 0x9B, 0xFB, 0xAA, 0x43, 0xC8, 0x70, 0x08, 0x25, 0x45, 0x97, 0x7C, 0x48, 0x0B,
+    0xDA, 0xC0, 0x82, 0xFE, 0x8C, 0xBD, 0x1B, 0x60, 0x54, 0x2D, 0xD5, 0xBE, 0x66, 0x41, 0x45, 0xA0,
+    0x85, 0x5B, 0x25, 0x64, 0x03, 0xE8, 0x30, 0x08, 0xF0, 0x6E, 0x09, 0x53, 0xB9, 0x2A, 0x3F, 0x44,
+    0xFB, 0x72, 0xD7, 0xF7, 0xC5, 0x48, 0xFD, 0x12, 0xD7, 0x79, 0xD1, 0x15, 0xD3, 0x9F, 0x94, 0x94,
+    0xEC, 0xC6, 0xC8, 0x08, 0x9F, 0x1A, 0xE4, 0x80, 0xB9, 0x52, 0x16, 0x7D, 0x80, 0x15, 0x76, 0x9F,
+    0xAA, 0x7B, 0xEB, 0xE0, 0x67, 0xBA, 0xE0, 0x1F, 0x0F, 0x6B, 0xE4, 0xE3, 0x42, 0x0C, 0x70, 0x29,
+    0x49, 0x30, 0x9C, 0xAB, 0xFF, 0x3E, 0x50, 0x71, 0xD6, 0x2D, 0xED, 0x21, 0xE6, 0xBB, 0xD3, 0x6E,
+    0xA9, 0xCD, 0x4F, 0x48, 0x3B, 0x3D, 0xB7, 0x9C, 0xE1, 0xB9, 0xCE, 0x69, 0xDC, 0x3F, 0xDD, 0x2F,
+    0x6E, 0xFC, 0xB4, 0x73, 0xBA, 0x5D, 0x3A, 0xF4, 0xF9, 0x57, 0x71, 0x45, 0xD3, 0x42, 0x91, 0x8F,
+    0x98, 0x83, 0xD0, 0xD7, 0xD2, 0xD5, 0xFA, 0x08, 0x84, 0x16, 0xE3, 0x70, 0x63, 0x18, 0x6E, 0x8C,
+    0xC2, 0x8D, 0x41, 0xB8, 0x31, 0x06, 0x37, 0x86, 0xE0, 0xC6, 0x08, 0xDC, 0x18, 0x80, 0x1B, 0xE3,
+    0x6F, 0x63, 0xF8, 0x6D, 0x8C, 0xBE, 0x8D, 0xC1, 0xB7, 0x31, 0xF6, 0x36, 0x82, 0xDE, 0xC6, 0xC8,
+    0xDB, 0x18, 0x78, 0x1B, 0xE3, 0x6E, 0x63, 0xD8, 0x6D, 0x8C, 0xBA, 0x8D, 0x41, 0xB7, 0x31, 0xE6,
+    0x36, 0x86, 0xDC, 0xC6, 0x88, 0xDB, 0x18, 0x70, 0x1B, 0xE3, 0x6D, 0x63, 0xB8, 0xED, 0x09, 0xDA,
+    0x96, 0x34, 0x0C, 0xF0, 0x20, 0x83, 0x88, 0xAF, 0xB0, 0xF1, 0x05, 0x51, 0x1B, 0x12, 0xD4, 0x29,
+    0x40, 0xF1, 0x16, 0x7C, 0x4A, 0x04, 0xA7, 0x8D, 0xD0, 0xB4, 0x11, 0x98, 0x36, 0xC2, 0xD2, 0x46,
+    0x50, 0xDA, 0x08, 0x49, 0x1B, 0x01, 0x69, 0x57, 0x1C, 0x6D, 0x04, 0xA3, 0x8D, 0x50, 0xB4, 0x11,
+    0x88, 0x36, 0xC2, 0xD0, 0x46, 0x10, 0xDA, 0x08, 0x41, 0x1B, 0x01, 0x68, 0x23, 0xFC, 0x6C, 0x04,
+    0x9F, 0x8D, 0xD0, 0xB3, 0x11, 0x78, 0x36, 0xC2, 0xCE, 0x5E, 0x83, 0xCE, 0xDA, 0x01, 0x87, 0x13,
+    0x4B, 0xB9, 0x62, 0x7B, 0x56, 0x90, 0x4E, 0x84, 0xEC, 0xD9, 0x9F, 0x96, 0x43, 0x23, 0xF0, 0xCA,
+    0x8A, 0x98, 0x5D, 0x01, 0xB3, 0x2B, 0x5E, 0x76, 0x81, 0xCB, 0xAE, 0x68, 0xD9, 0x15, 0x2C, 0xBB,
+    0x62, 0x65, 0x57, 0xA8, 0xEC, 0x8A, 0x94, 0x5D, 0x81, 0xB2, 0x2B, 0x4E, 0x76, 0x85, 0xC9, 0xAE,
+    0x28, 0xD9, 0x15, 0x24, 0xBB, 0x62, 0x64, 0x57, 0x88, 0xEC, 0x8A, 0x90, 0x5D, 0x01, 0xB2, 0x2B,
+    0x3E, 0x76, 0x85, 0xC7, 0x46, 0xE8, 0xD8, 0x13, 0x18, 0xFE, 0x3B, 0x0F, 0x9F, 0x33, 0x81, 0x90,
+    0x1B, 0xDA, 0x91, 0xFD, 0x35, 0xD8, 0xFE, 0xEF, 0x21, 0x11, 0x5E, 0x12, 0xAD, 0xD3, 0x44, 0x58,
+    0xB3, 0x2C, 0x26, 0x59, 0xCC, 0xB1, 0x98, 0x62, 0x31, 0xC3, 0x62, 0x82, 0xC5, 0xFC, 0x8A, 0xE9,
+    0xD5, 0x97, 0x25, 0xC2, 0xEE, 0xD6, 0x55, 0x73, 0xCD, 0xCA, 0x77, 0xEC, 0xF6, 0x6C, 0x97, 0xD2,
+    0x54, 0x7C, 0xC4, 0xE4, 0x1B, 0x98, 0x58, 0x69, 0xB6, 0xD0, 0xF6, 0xC1, 0x4C, 0xDB, 0x29, 0x92,
+    0x39, 0x88, 0x37, 0x66, 0x7B, 0xF3, 0x11, 0x26, 0xD4, 0x65, 0x38, 0xB4, 0x62, 0x1D, 0x09, 0xF5,
+    0x9F, 0xE8, 0x2C, 0x00, 0x40, 0x56, 0xA3, 0xAB, 0x90, 0x51, 0xF4, 0x50, 0x0D, 0x94, 0xF5, 0xFD,
+    0xF6, 0xE2, 0x3B, 0x84, 0x0F, 0xB2, 0x4E, 0x52, 0xD8, 0x8C, 0x68, 0x47, 0x9B, 0x1D, 0x59, 0xF3,
+    0x9A, 0x78, 0xFF, 0x9F, 0x5F, 0xB4, 0x53, 0x68, 0x7C, 0xB0, 0xCE, 0x6F, 0x37, 0xC7, 0xAC, 0xB1,
+    0xAA, 0xDD, 0x86, 0xAD, 0x0F, 0x33, 0xD0, 0x2C, 0xFD, 0xF3, 0xDC, 0x4D, 0xCA, 0x6C, 0xCF, 0x75,
+    0xC7, 0x3B, 0x6C, 0xA4, 0xB0, 0xC2, 0xE3, 0x0C, 0xEA, 0xCC, 0x94, 0x4B, 0x69, 0x39, 0xD2, 0xD9,
+    0x25, 0x2B, 0x56, 0xF2, 0xEC, 0xDE, 0x49, 0x5F, 0x03, 0x68, 0xBC, 0xD4, 0x23, 0x12, 0xCA, 0x3C,
+    0xEA, 0x53, 0x99, 0xF0, 0x13, 0x66, 0x68, 0x7E, 0x84, 0x92, 0xE7, 0x21, 0xC3, 0xB1, 0xA7, 0xDD,
+    0x62, 0xF9, 0xF7, 0x81, 0x70, 0xA0, 0x1A, 0x3C, 0x4E, 0xD4, 0xC8, 0x59, 0x37, 0x93, 0x73, 0x27,
+    0xD6, 0xC1, 0x41, 0xD2, 0xD5, 0xC3, 0x15, 0x6A, 0xE7, 0x42, 0xD1, 0x41, 0xFB, 0x9C, 0xE8, 0xEF,
+    0x16, 0xE9, 0xD7, 0x8F, 0xD8, 0x2A, 0x7F, 0x6A, 0x09, 0x18, 0xF1, 0xCC, 0xE6, 0xD6, 0xC0, 0x2F,
+    0x83, 0x79, 0xF2, 0x68, 0x88, 0xF9, 0xDA, 0x00, 0xA3, 0xB6, 0x3A, 0xA1, 0x65, 0x5E, 0x56, 0x21,
+    0x34, 0x1C, 0x50, 0x74, 0x86, 0x2B, 0x06, 0x2D, 0xBA, 0x37, 0x1E, 0x9A, 0x53, 0x98, 0x5D, 0xDC,
+    0x02, 0x5B, 0xC3, 0xDE, 0xA5, 0xE4, 0xB9, 0xBB, 0x86, 0x56, 0x74, 0x2B, 0xC6, 0x37, 0x20, 0x49,
+    0x03, 0x76, 0x74, 0x19, 0x03, 0x80, 0x34, 0xA0, 0x47, 0x0D, 0x3A, 0x1A, 0x70, 0xA3, 0x01, 0x34,
+    0x1A, 0x10, 0xA3, 0x01, 0x2E, 0x1A, 0xB0, 0xA2, 0x01, 0x28, 0x1A, 0x50, 0xA2, 0x01, 0xB9, 0x1B,
+    0x60, 0xBB, 0x01, 0xB3, 0x6B, 0xC8, 0xD0, 0x00, 0x0B, 0x0D, 0x98, 0xD0, 0x00, 0x08, 0x0D, 0x68,
+    0xD0, 0x00, 0x05, 0x0D, 0x38, 0xD0, 0x00, 0x02, 0x0D, 0x08, 0xD0, 0x00, 0xFF, 0x54, 0xC7, 0xF0,
+    0x70, 0x8D, 0x9A, 0xF2, 0x39, 0x6A, 0x0A, 0x5A, 0x4D, 0x74, 0x77, 0x4A, 0x0A, 0x02, 0x30, 0x81,
+    0xBE, 0x24, 0xF4, 0x92, 0xB8, 0x4B, 0x82, 0x2E, 0x89, 0xB8, 0x24, 0xDC, 0x92, 0x58, 0x4B, 0x02,
+    0x2D, 0x33, 0xBB, 0x6E, 0xA9, 0x43, 0x4B, 0x3F, 0xCC, 0x50, 0xDA, 0x80, 0x55, 0x5A, 0x57, 0x0C,
+    0x8A, 0x72, 0xD2, 0x0F, 0x1B, 0x81, 0x30, 0x1A, 0x16, 0x6F, 0x45, 0xA4, 0x68, 0x4A, 0x4D, 0xCE,
+    0x0D, 0xB3, 0x7B, 0x38, 0x11, 0x73, 0xC3, 0xA5, 0x53, 0xFF, 0x7F, 0x8D, 0xF7, 0x97, 0xDB, 0x29,
+    0x1A, 0x8A, 0x1F, 0x8D, 0x6E, 0x89, 0x9C, 0x5D, 0x19, 0x2A, 0xD7, 0x07, 0xD6, 0x5F, 0x0E, 0x71,
+    0xD3, 0xE1, 0x01, 0xDD, 0x40, 0x05, 0x13, 0x3E, 0x63, 0x28, 0xA7, 0x92, 0x67, 0xBE, 0x4A, 0xE2,
+    0xDA, 0xE0, 0x18, 0xC4, 0xB5, 0x41, 0xF5, 0x76, 0xCF, 0x77, 0x1B, 0x8A, 0xF5, 0xD8, 0xD0, 0xDA,
+    0x74, 0xE8, 0x3C, 0x0F, 0x4D, 0x2E, 0xDD, 0x86, 0xFC, 0x45, 0xDD, 0x86, 0x4D, 0xDC, 0x6D, 0x38,
+    0x09, 0xD3, 0x87, 0x75, 0xA7, 0xB4, 0xEE, 0x1F, 0x30, 0xA3, 0x5B, 0x0F, 0x0C, 0x1E, 0x0B, 0xE5,
+    0xDD, 0x94, 0xE3, 0x8A, 0x79, 0xC7, 0x1E, 0x2E, 0xC3, 0xD9, 0xF1, 0x46, 0x21, 0x24, 0x23, 0xC7,
+    0x7B, 0xA2, 0xB6, 0x0B, 0x5E, 0x76, 0xD1, 0x57, 0x08, 0x77, 0xE8, 0x32, 0x2D, 0x7C, 0x3F, 0x7F,
+    0xBE, 0x05, 0xF5, 0xC7, 0x9E, 0x44, 0xD4, 0x93, 0x70, 0xE9, 0xD5, 0xD6, 0x45, 0xC9, 0xFE, 0x02,
+    0xC8, 0x0F, 0x78, 0x6B, 0xA3, 0x73, 0x3A, 0xBF, 0xE8, 0x80, 0xE5, 0x37, 0xB0, 0x47, 0xF1, 0xC6,
+    0x55, 0xEC, 0x22, 0x68, 0x3C, 0x92, 0x17, 0xE1, 0x99, 0x16, 0xDB, 0x76, 0x1B, 0xC1, 0xDC, 0x5C,
+    0xEE, 0xD8, 0x11, 0xDC, 0x93, 0x47, 0x0D, 0xB4, 0xD8, 0xDB, 0xB9, 0x62, 0xF9, 0x97, 0x3E, 0x5E,
+    0x6D, 0x9C, 0xAC, 0x66, 0x87, 0x96, 0xBC, 0x1A, 0x37, 0x3D, 0x5D, 0xBA, 0xD3, 0xC3, 0xA4, 0x47,
+    0x8D, 0x3C, 0x5D, 0xF9, 0x1B, 0x19, 0x24, 0x06, 0xFF, 0xA9, 0xDF, 0x09, 0x9D, 0xFD, 0x9B, 0x32,
+    0x4C, 0xE9, 0x2C, 0xB2, 0x5C, 0x4D, 0x5A, 0xF4, 0x95, 0xA1, 0x94, 0xE8, 0x4E, 0x28, 0x55, 0xEF,
+    0x37, 0x7A, 0x64, 0x09, 0x50, 0xFE, 0x6A, 0x46, 0xD0, 0xA4, 0x9E, 0x43, 0x4B, 0x26, 0xF4, 0x9E,
+    0x85, 0xDF, 0xA7, 0xE0, 0xFC, 0x93, 0x07, 0xC8, 0x1B, 0xC0, 0xE3, 0x9C, 0x26, 0xA4, 0xB4, 0x03,
+    0x83, 0xFF, 0xE6, 0x15, 0x0D, 0x9E, 0x6F, 0xCF, 0x1B, 0x74, 0xD7, 0xD7, 0x0A, 0xEA, 0x16, 0x42,
+    0xDD, 0x2C, 0xDC, 0x26, 0xAF, 0x2D, 0xCB, 0xBD, 0xCE, 0xE5, 0x3B, 0xCF, 0xFE, 0x82, 0x62, 0xC9,
+    0xF2, 0x52, 0xC8, 0x1D, 0x24, 0xF4, 0x03, 0x81, 0x2B, 0x1C, 0xFD, 0xE8, 0xD4, 0x20, 0x24, 0x38,
+    0x7A, 0xA0, 0xF5, 0x8E, 0xE2, 0x58, 0x7C, 0xA6, 0x36, 0x5C, 0x96, 0x20, 0x5A, 0xD9, 0x7D, 0x5F,
+    0x8D, 0x96, 0x16, 0x4D, 0x4B, 0x3F, 0xA9, 0x55, 0xF7, 0xBD, 0x1E, 0xBF, 0x11, 0x7E, 0xEB, 0xF5,
+    0x5D, 0xF5, 0x90, 0xD0, 0xC3, 0x4D, 0x84, 0x0C, 0xAD, 0x9F, 0xAA, 0x62, 0x96, 0x0D, 0x30, 0x15,
+    0xCB, 0x61, 0x6C, 0xAC, 0xBC, 0x1A, 0x10, 0x9F, 0x16, 0x86, 0xE4, 0x9D, 0x50, 0xC9, 0x4A, 0x66,
+    0x82, 0x30, 0xDA, 0x84, 0x68, 0x2B, 0xF7, 0xFA, 0x2B, 0xD1, 0x4B, 0x4E, 0xAF, 0x6E, 0x3F, 0xD4,
+    0xFB, 0xFF, 0x3D, 0x4E, 0x86, 0xB2, 0xED, 0xB1, 0xC7, 0x41, 0xD0, 0x83, 0xE2, 0xAD, 0x36, 0xBD,
+    0x4A, 0xA5, 0xBB, 0x97, 0x34, 0x37, 0xCC, 0x66, 0x03, 0x48, 0xCC, 0x50, 0x63, 0xA9, 0xA4, 0x12,
+    0x2D, 0x2E, 0xEB, 0x87, 0x57, 0x6E, 0x09, 0x27, 0x7A, 0xDD, 0x25, 0xCD, 0xAB, 0xD1, 0xF4, 0xBF,
+    0x85, 0xA3, 0x17, 0xB5, 0x95, 0x77, 0xF0, 0x57, 0x84, 0xB2, 0x93, 0x16, 0x27, 0xF3, 0xDE, 0xC9,
+    0x4D, 0x65, 0xAB, 0xAF, 0xDF, 0x24, 0x46, 0x51, 0xA1, 0xAA, 0x51, 0xF5, 0x89, 0xEA, 0x44, 0x6D,
+    0x32, 0x65, 0xA2, 0x2E, 0x45, 0xAA, 0xB4, 0x81, 0xF9, 0xCB, 0x71, 0x5D, 0x0B, 0x52, 0xBB, 0xE0,
+    0x61, 0xA6, 0x17, 0x57, 0xD8, 0xE8, 0x0A, 0x59, 0xDF, 0x62, 0x61, 0x9A, 0xEE, 0xCF, 0x1B, 0x48,
+    0x08, 0x49, 0xEC, 0xCF, 0x51, 0x55, 0xFE, 0x0A, 0x67, 0x13, 0xF8, 0x28, 0x5C, 0xE9, 0xC4, 0x96,
+    0xDA, 0x86, 0x9E, 0x01, 0xB9, 0x92, 0x68, 0x1E, 0x58, 0x99, 0xC4, 0xBF, 0xA5, 0xC1, 0xD4, 0xF7,
+    0xD4, 0x5E, 0xED, 0x3A, 0xC5, 0xAE, 0xD5, 0x5B, 0xA1, 0xFF, 0x59, 0xD8, 0xCA, 0xDF, 0x3C, 0xC3,
+    0x76, 0x50, 0xF6, 0x84, 0xBF, 0x1A, 0x53, 0x3F, 0xD4, 0xDA, 0x1E, 0x2B, 0x27, 0x50, 0x5C, 0x7B,
+    0xBA, 0xA3, 0xF6, 0x75, 0x06, 0xBD, 0xF5, 0xA1, 0xC6, 0xC1, 0x48, 0x4B, 0xE0, 0x1B, 0x26, 0x13,
+    0xE1, 0xA4, 0x3F, 0x32, 0xF6, 0x92, 0x67, 0x25, 0x0B, 0x32, 0xD1, 0x23, 0x1D, 0x7D, 0xBC, 0x58,
+    0x52, 0xE8, 0x03, 0xD5, 0xA1, 0x80, 0x2F, 0xE7, 0x71, 0x89, 0x76, 0xAB, 0x85, 0xF7, 0xCE, 0x15,
+    0xFB, 0x13, 0x4D, 0xB8, 0xF1, 0x74, 0x16, 0xA7, 0xF8, 0xCC, 0x5A, 0x92, 0x99, 0x55, 0xC9, 0x47,
+    0xC5, 0xAD, 0x4B, 0x16, 0xBF, 0x4B, 0x27, 0x11, 0x99, 0x05, 0xC5, 0xF2, 0x75, 0xD2, 0x39, 0xBD,
+    0xFA, 0xAB, 0x0F, 0x65, 0xA3, 0x5A, 0x18, 0x86, 0xA9, 0x84, 0xA5, 0x04, 0x9C, 0x8C, 0x76, 0x72,
+    0x31, 0x93, 0x38, 0x46, 0x93, 0x5B, 0x49, 0xBF, 0x67, 0xC3, 0x87, 0xB5, 0xBF, 0xE8, 0x30, 0xCA,
+    0x21, 0x3E, 0x8C, 0x92, 0x5E, 0x3F, 0x8C, 0xD2, 0xB8, 0xF5, 0x0C, 0xF2, 0x97, 0x1C, 0x46, 0x61,
+    0xDD, 0x8E, 0x74, 0xDC, 0x93, 0xF1, 0xB8, 0xBC, 0xF3, 0x4F, 0x57, 0x5B, 0xED, 0x43, 0x94, 0x43,
+    0xBB, 0x57, 0x54, 0x68, 0x3A, 0xA9, 0x95, 0xC8, 0x46, 0x91, 0x84, 0x80, 0x99, 0xE3, 0x89, 0xE7,
+    0x70, 0x22, 0x3B, 0x1C, 0x73, 0x0E, 0xA7, 0xAF, 0x2B, 0x3B, 0x73, 0x6D, 0x5F, 0x1B, 0xB2, 0x9C,
+    0xAF, 0xB6, 0x53, 0xD5, 0x89, 0x9D, 0xA5, 0xE6, 0x51, 0xEA, 0xAD, 0xB1, 0x3A, 0x55, 0x33, 0x85,
+    0xA6, 0xB9, 0x1A, 0x29, 0x20, 0xD3, 0xB3, 0x63, 0x32, 0x0B, 0x89, 0xDC, 0xC7, 0x91, 0x81, 0xBA,
+    0x19, 0x24, 0x12, 0xA3, 0x8A, 0xF3, 0x5B, 0x29, 0x82, 0x49, 0x3F, 0xE5, 0xC3, 0x66, 0x2A, 0xF6,
+    0xC9, 0x64, 0xF0, 0x64, 0xB6, 0xC1, 0x35, 0x7A, 0x09, 0x67, 0xCC, 0x6D, 0xFB, 0xC9, 0xC9, 0xF6,
+    0x79, 0x80, 0x1C, 0xE7, 0x23, 0x23, 0x2A, 0x16, 0x31, 0x15, 0xA7, 0xE8, 0xE0, 0xFA, 0xED, 0x87,
+    0x28, 0x8A, 0xE6, 0x47, 0xC2, 0x2B, 0xE6, 0x82, 0x2D, 0x3F, 0xC2, 0xB8, 0xDB, 0x77, 0x11, 0x08,
+    0x57, 0x6A, 0x53, 0xD4, 0xA0, 0x9F, 0xBF, 0x52, 0x27, 0x86, 0x6E, 0x69, 0xB8, 0x41, 0xAC, 0xA1,
+    0xFF, 0x3B, 0x25, 0xFD, 0x27, 0x1A, 0xE0, 0x2A, 0x8A, 0x3B, 0xEF, 0xAB, 0x9D, 0x4B, 0xEE, 0x2D,
+    0x41, 0xF1, 0xD7, 0xD5, 0xE7, 0xB3, 0xCA, 0xE3, 0x9D, 0x67, 0x6E, 0x05, 0xA0, 0x6F, 0x96, 0x3E,
+    0x2D, 0xB2, 0xEE, 0x43, 0x8E, 0x83, 0x42, 0xDB, 0x6C, 0x80, 0xB7, 0x8A, 0x6B, 0x95, 0xAF, 0xC0,
+    0x19, 0x2E, 0xA8, 0x00, 0xBE, 0xE0, 0x26, 0xB1, 0xA6, 0xEB, 0x24, 0x39, 0x7A, 0x36, 0x69, 0xF8,
+    0x34, 0xB9, 0x45, 0x11, 0xBE, 0x66, 0x8E, 0x50, 0x47, 0xA8, 0x22, 0xD4, 0x10, 0x53, 0x90, 0xF6,
+    0xCD, 0x79, 0x51, 0x8F, 0xB3, 0x55, 0x3B, 0x36, 0x6A, 0xCC, 0x0D, 0x44, 0x51, 0x2C, 0xB9, 0x84,
+    0x56, 0x90, 0x1F, 0x59, 0xE3, 0xAA, 0xB7, 0x13, 0xB3, 0x35, 0xCF, 0x8F, 0x8D, 0x6B, 0x58, 0xA3,
+    0xE5, 0x72, 0x71, 0x1D, 0xBD, 0x06, 0x87, 0x9A, 0x50, 0xEE, 0x18, 0x29, 0x25, 0xA0, 0x5A, 0x0A,
+    0xC7, 0x98, 0x09, 0x33, 0xF5, 0xFA, 0x2E, 0x72, 0xA1, 0x06, 0xB9, 0x44, 0x68, 0xCC, 0xB0, 0x69,
+    0xC3, 0xE3, 0xFE, 0xAC, 0x3B, 0x7B, 0x83, 0xA2, 0xE0, 0x30, 0xEF, 0x96, 0x80, 0x71, 0x6C, 0x08,
+    0xFB, 0x31, 0xF1, 0xD7, 0x6E, 0x32, 0x94, 0xBD, 0xD4, 0x53, 0x2B, 0x6B, 0xE4, 0x70, 0xDE, 0x88,
+    0x22, 0xD4, 0x3F, 0xD3, 0x64, 0xF7, 0x17, 0xDA, 0xB2, 0x7C, 0x8A, 0x93, 0xC5, 0x08, 0xDF, 0x7E,
+    0xC0, 0xC6, 0x6E, 0xC2, 0xEF, 0x68, 0xD8, 0xBB, 0xF5, 0x0B, 0x2C, 0xFE, 0x4F, 0x07, 0x17, 0xDD,
+    0x9D, 0x71, 0x91, 0x79, 0x8A, 0x3C, 0x25, 0x9E, 0x02, 0x4F, 0x79, 0x3F, 0x5F, 0xC5, 0xFD, 0xC6,
+    0x93, 0xD8, 0xB4, 0x98, 0x55, 0x65, 0xD4, 0x2A, 0x74, 0x5D, 0xBA, 0x99, 0x6A, 0x27, 0x7B, 0x59,
+    0x83, 0x86, 0xAF, 0x8D, 0xC4, 0x21, 0xA1, 0x1C, 0xFF, 0x97, 0x09, 0xE5, 0x2B, 0x70, 0xD6, 0xF0,
+    0xF6, 0x87, 0x77, 0x3F, 0x10, 0x9A, 0xCD, 0xE5, 0x02, 0x31, 0x77, 0xFE, 0x5B, 0x47, 0x14, 0x76,
+    0xF1, 0xD5, 0x20, 0x7B, 0xC5, 0x64, 0x47, 0xF1, 0xF2, 0x0D, 0x39, 0x87, 0xF6, 0xA2, 0xBC, 0xB2,
+    0xB6, 0xBC, 0x72, 0x07, 0x10, 0x4B, 0xF7, 0x82, 0xBC, 0xF2, 0x55, 0x38, 0x1B, 0x6A, 0x2E, 0xD0,
+    0x53, 0xDE, 0x89, 0xB5, 0xC3, 0x37, 0x45, 0x69, 0xD4, 0xAD, 0x61, 0xF7, 0xE8, 0xE2, 0xB8, 0xFB,
+    0xA6, 0x9C, 0x1B, 0x64, 0xD5, 0xF2, 0xC0, 0x0A, 0x92, 0x3B, 0xA9, 0x20, 0xB5, 0xFE, 0x23, 0x35,
+    0xB4, 0xA3, 0xFB, 0xB3, 0x6B, 0x98, 0x8B, 0xC3, 0x5A, 0xE9, 0xE5, 0x51, 0x33, 0xD6, 0xAD, 0x03,
+    0xD2, 0x73, 0x5A, 0x0F, 0x6E, 0xF3, 0x1F, 0x85, 0xE5, 0x33, 0xBB, 0xA5, 0xFE, 0x9F, 0x2C, 0xB8,
+    0x8D, 0xBF, 0x25, 0x2B, 0xDE, 0x7B, 0xA0, 0x9C, 0xB0, 0x74, 0xC1, 0xB2, 0xFD, 0x3E, 0x1C, 0x75,
+    0x76, 0xE7, 0xCD, 0xF5, 0x6F, 0xFC, 0x33, 0x3C, 0xC8, 0x6E, 0x69, 0x78, 0xB0, 0xFE, 0x49, 0xEC,
+    0x94, 0x99, 0xDC, 0xB4, 0x7B, 0xDF, 0x70, 0xF0, 0x1E, 0xB5, 0x3E, 0x7C, 0xCD, 0xC4, 0xBE, 0x55,
+    0x6E, 0x9F, 0xD1, 0x1A, 0x6D, 0xC8, 0x4E, 0xA8, 0x18, 0x9B, 0xC1, 0x07, 0x76, 0x84, 0xE4, 0x75,
+    0x08, 0x7B, 0xF1, 0x1D, 0x86, 0xCA, 0x84, 0x7F, 0xD6, 0x97, 0x28, 0x11, 0x77, 0xC0, 0xD4, 0x32,
+    0x69, 0x3A, 0x9E, 0x60, 0x92, 0xD4, 0x5C, 0xD9, 0xB9, 0xF8, 0xD0, 0x9B, 0x45, 0xBD, 0x1E, 0x16,
+    0xEB, 0xAC, 0x09, 0xB5, 0xE2, 0x86, 0x57, 0x94, 0x43, 0x59, 0x33, 0x46, 0xDE, 0x36, 0xAF, 0x20,
+    0x96, 0xDD, 0x35, 0x10, 0xCB, 0xCB, 0xBE, 0x04, 0xE0, 0xA5, 0xA8, 0x99, 0x38, 0xE3, 0x7C, 0x19,
+    0x6A, 0x66, 0xEF, 0x5E, 0xF4, 0xC0, 0xF8, 0x27, 0xBD, 0x8A, 0x1E, 0x7E, 0x5C, 0x8B, 0xAF, 0x3C,
+    0x56, 0x55, 0xC7, 0xDF, 0x84, 0x97, 0x8D, 0x3C, 0x67, 0xA5, 0xC0, 0x2F, 0xED, 0xB6, 0xB4, 0xBF,
+    0xBD, 0xAF, 0xC7, 0x92, 0x34, 0x55, 0x94, 0xDF, 0xE1, 0xCF, 0xFD, 0xA7, 0xEF, 0xA7, 0x51, 0xA2,
+    0x13, 0x72, 0xA6, 0xFC, 0x65, 0xD1, 0xFE, 0xF1, 0x35, 0xF4, 0xE0, 0x2A, 0x7C, 0x33, 0x8D, 0x46,
+    0x80, 0xD3, 0xF2, 0x28, 0x5D, 0x15, 0x3E, 0x7F, 0xE4, 0x7A, 0x00, 0x18, 0xDB, 0x5D, 0xEB, 0x25,
+    0x24, 0x1D, 0xF6, 0xF7, 0x20, 0x1C, 0xED, 0xF5, 0x7E, 0x29, 0xD9, 0x67, 0x5A, 0x94, 0x95, 0x68,
+    0x79, 0xA0, 0x34, 0x36, 0x01, 0x33, 0xB1, 0x94, 0x99, 0x23, 0x78, 0x75, 0xC2, 0x43, 0xDD, 0x0F,
+    0xD8, 0x19, 0xA0, 0x25, 0x63, 0xEF, 0x9A, 0x5F, 0x27, 0x26, 0xC3, 0x63, 0xE0, 0x86, 0xDE, 0x0E,
+    0xCD, 0x4D, 0xEB, 0x45, 0x9C, 0x0E, 0xE5, 0x09, 0x3A, 0xBB, 0xB3, 0x56, 0x98, 0xB5, 0xBC, 0xF7,
+    0x6C, 0x5F, 0x6D, 0x11, 0x10, 0x1F, 0x09, 0x4D, 0x18, 0x70, 0xB5, 0x4A, 0xC4, 0xB8, 0x1E, 0xE8,
+    0xA8, 0xF9, 0xEE, 0xF6, 0xF1, 0xE9, 0x17, 0xE7, 0xE0, 0x0B, 0x75, 0x78, 0x8C, 0x79, 0x03, 0x57,
+    0x9C, 0xD9, 0x4E, 0x1F, 0x69, 0x3D, 0xFC, 0xF2, 0x54, 0x73, 0x57, 0xBE, 0xE7, 0xEB, 0xB9, 0xF5,
+    0x07, 0xFA, 0xC8, 0xC4, 0x33, 0x5D, 0xE4, 0x5C, 0x1B, 0x8D, 0xC9, 0x65, 0x11, 0xB5, 0x18, 0xE3,
+    0x6B, 0x11, 0x89, 0x9E, 0xA1, 0xEC, 0x40, 0x0E, 0x04, 0x12, 0x4A, 0xED, 0x3B, 0xB8, 0x4D, 0x6D,
+    0x9B, 0xD0, 0x05, 0xB7, 0x30, 0x91, 0x3F, 0x5C, 0x3B, 0x5F, 0xFA, 0x6D, 0x7B, 0xFC, 0x46, 0x10,
+    0x79, 0x1C, 0x05, 0xCC, 0xBE, 0x8F, 0xCF, 0xF6, 0xC9, 0x6F, 0xD8, 0x38, 0x01, 0x8D, 0xE1, 0x3B,
+    0x48, 0xCD, 0xEA, 0xF7, 0x27, 0x56, 0xDF, 0xCC, 0xFD, 0xC1, 0x95, 0x53, 0xDC, 0xF1, 0x8E, 0xAD,
+    0xFE, 0x96, 0x56, 0xBF, 0x51, 0x38, 0xC0, 0x5F, 0x5B, 0x4D, 0xCF, 0x80, 0x00, 0x0B, 0x32, 0x20,
+    0x21, 0x18, 0x40, 0x6B, 0x31, 0x0F, 0x4E, 0x5D, 0xCE, 0x14, 0xBE, 0x74, 0x73, 0xE3, 0x17, 0x74,
+    0xD6, 0xCB, 0xD6, 0x50, 0x9D, 0xAE, 0x61, 0xC4, 0x70, 0x1D, 0x0B, 0x88, 0xEF, 0xE8, 0xF8, 0xBD,
+    0xA2, 0xA9, 0x07, 0xB4, 0x79, 0x7F, 0x83, 0x36, 0xEF, 0x17, 0x86, 0xD6, 0x3B, 0x6D, 0xF3, 0x26,
+    0x7F, 0xB0, 0x36, 0xEF, 0xFF, 0x00, 0xBD, 0x56, 0xCD, 0x6F, 0x24, 0x47, 0x15, 0x7F, 0xDD, 0xBD,
+    0xB3, 0xCD, 0xBA, 0xA5, 0xD4, 0x1C, 0x3C, 0x28, 0xD8, 0x22, 0xCD, 0x61, 0x0F, 0x91, 0x85, 0xD3,
+    0x17, 0x24, 0x12, 0xC9, 0x33, 0x55, 0x21, 0x48, 0x9C, 0x10, 0x3E, 0x78, 0xB8, 0x45, 0xCB, 0x61,
+    0x2F, 0x6B, 0x84, 0x2C, 0x6E, 0x46, 0x9A, 0xA4, 0x4B, 0xC9, 0x21, 0x47, 0x9C, 0x70, 0xE0, 0x10,
+    0x21, 0xE6, 0xE0, 0x48, 0xCE, 0x70, 0x20, 0x87, 0x3D, 0x18, 0xC9, 0xEB, 0xAE, 0xDD, 0xFC, 0x03,
+    0x0D, 0x8B, 0xB8, 0x44, 0x82, 0x46, 0x98, 0x0F, 0x91, 0x03, 0x05, 0xEA, 0x4D, 0x7A, 0xB3, 0xDD,
+    0x53, 0xFC, 0x5E, 0xCD, 0xD8, 0xDE, 0x2C, 0xB0, 0x47, 0xBA, 0xAB, 0xBB, 0x67, 0xEA, 0xEB, 0x7D,
+    0xFD, 0xDE, 0xEF, 0xD5, 0xEE, 0x94, 0x64, 0x43, 0x69, 0x4B, 0x49, 0x47, 0xD1, 0x9C, 0xC8, 0x11,
+    0x0D, 0x88, 0x66, 0x87, 0x81, 0xAB, 0x22, 0xA7, 0xC5, 0x9C, 0xB2, 0x9A, 0x72, 0xC3, 0x7D, 0xB4,
+    0x31, 0x23, 0x2A, 0x9C, 0x0A, 0x9C, 0x33, 0xF1, 0x3C, 0xAF, 0xB2, 0x3A, 0xB5, 0x85, 0x49, 0xDA,
+    0x31, 0x05, 0x3B, 0xB4, 0x4A, 0x83, 0xC8, 0xA9, 0xD7, 0x85, 0xFB, 0xAC, 0xCB, 0x9C, 0x6B, 0xE5,
+    0xBB, 0xAE, 0x7E, 0x9D, 0x8A, 0x72, 0x95, 0xAE, 0x50, 0x6F, 0x3C, 0x56, 0xE8, 0x33, 0xD2, 0x39,
+    0x8D, 0x47, 0x0D, 0xC6, 0x63, 0x5A, 0x9B, 0xCD, 0x66, 0x0A, 0x7F, 0x9C, 0x7F, 0x91, 0x7F, 0xA1,
+    0x7F, 0x87, 0x24, 0x45, 0x56, 0x6A, 0x61, 0xE5, 0xC3, 0xA2, 0xE4, 0x45, 0x02, 0x03, 0xA1, 0x6B,
+    0x88, 0x7A, 0x44, 0x57, 0x95, 0xB4, 0x45, 0xED, 0xEA, 0xC2, 0x66, 0x86, 0xFC, 0x25, 0xF5, 0x9C,
+    0x8A, 0x7B, 0x8E, 0xDC, 0x87, 0xCE, 0x7F, 0x37, 0xE8, 0xC8, 0x77, 0x77, 0xD8, 0x11, 0x3B, 0x1B,
+    0x2A, 0x0C, 0xE5, 0x3A, 0x74, 0x6C, 0x5F, 0x5A, 0xD2, 0x9A, 0xA6, 0x60, 0x9B, 0xD2, 0x39, 0x46,
+    0xF5, 0x69, 0x6A, 0xDA, 0xA4, 0x6C, 0x13, 0x73, 0xBA, 0x07, 0xCD, 0x34, 0x3A, 0x49, 0xC1, 0xEE,
+    0xB7, 0x67, 0x98, 0xFE, 0xA1, 0xD3, 0xB1, 0x4B, 0xE6, 0x24, 0x9A, 0xB4, 0xA6, 0xAC, 0x92, 0xD8,
+    0x47, 0xC1, 0x2F, 0xAB, 0xB4, 0x43, 0xB4, 0xAB, 0xC2, 0xF7, 0x65, 0x99, 0x62, 0xA4, 0x28, 0xA1,
+    0x9C, 0x8A, 0x5C, 0xB7, 0x50, 0x70, 0xBC, 0x4D, 0x71, 0x9D, 0x58, 0x61, 0x45, 0x95, 0x96, 0x69,
+    0x99, 0x19, 0x69, 0xA4, 0xCE, 0xD5, 0x80, 0x44, 0x59, 0x40, 0xB8, 0xA3, 0xCC, 0x40, 0xF0, 0x5D,
+    0xA8, 0x76, 0xAF, 0x25, 0xF9, 0x66, 0x4B, 0xBB, 0xDF, 0x38, 0xA4, 0xD9, 0x3B, 0x33, 0x95, 0xFF,
+    0xD1, 0xE9, 0x0C, 0x9E, 0x14, 0xB5, 0x2C, 0xA3, 0x56, 0xD8, 0xA0, 0x8B, 0x6B, 0xC8, 0xDA, 0xA6,
+    0x0C, 0x0A, 0xC1, 0x00, 0x82, 0x1D, 0xC7, 0xC5, 0x8F, 0x4D, 0xFB, 0xA5, 0x54, 0x9F, 0x52, 0xAE,
+    0x72, 0xB8, 0x24, 0x73, 0x2D, 0xC5, 0xAE, 0x62, 0x9D, 0x88, 0xF6, 0xCE, 0x28, 0x42, 0x9F, 0x58,
+    0xF8, 0xD7, 0xE4, 0x3A, 0x83, 0x44, 0x01, 0xDF, 0x07, 0x0A, 0xD6, 0x93, 0xD3, 0x81, 0xE3, 0xD0,
+    0x22, 0xC0, 0xA2, 0xA5, 0xAC, 0x21, 0x69, 0xA9, 0xB0, 0x34, 0x56, 0x14, 0x38, 0x1D, 0x71, 0x23,
+    0xB6, 0x15, 0x1E, 0xF2, 0x43, 0xB2, 0x64, 0xA1, 0x63, 0x16, 0xED, 0x70, 0x17, 0xB8, 0x73, 0xB6,
+    0x05, 0xF7, 0x40, 0x3D, 0x7D, 0xC5, 0xC6, 0x21, 0xC9, 0x96, 0xFB, 0x63, 0xF6, 0x09, 0x76, 0x50,
+    0x8C, 0x9B, 0x8D, 0x23, 0x72, 0x75, 0xE8, 0xCA, 0xD8, 0xF1, 0x90, 0xAC, 0x68, 0x00, 0xBB, 0x32,
+    0xA2, 0x11, 0x6D, 0xDC, 0xA1, 0xBC, 0xA3, 0xDD, 0x96, 0xE8, 0x84, 0xA8, 0xE1, 0xC8, 0x25, 0x86,
+    0x84, 0x26, 0x31, 0xA3, 0xD4, 0xA9, 0x6C, 0x46, 0x2F, 0xF0, 0x2C, 0xF2, 0xD0, 0x3B, 0xCA, 0x5D,
+    0x8B, 0x76, 0x3E, 0xB5, 0xA6, 0xC0, 0x52, 0x88, 0x56, 0x51, 0x54, 0x51, 0xA8, 0x69, 0xED, 0x88,
+    0x65, 0x03, 0xCA, 0x85, 0x0D, 0x1C, 0xA0, 0xA3, 0xE5, 0x9C, 0x75, 0x7B, 0x89, 0x28, 0x38, 0x48,
+    0x4B, 0x69, 0x4E, 0xA9, 0xC5, 0x5D, 0x00, 0x60, 0x2B, 0x7E, 0x47, 0xBF, 0x07, 0x59, 0xFA, 0xE2,
+    0x03, 0x38, 0x14, 0x8D, 0xFB, 0xF0, 0xA3, 0x80, 0xAB, 0x4A, 0x8A, 0x0D, 0x6B, 0x92, 0xE8, 0xA5,
+    0xB4, 0xC1, 0x43, 0x06, 0x13, 0x50, 0x02, 0x81, 0x2C, 0xED, 0x00, 0x58, 0xC5, 0x12, 0x83, 0xF9,
+    0x94, 0x59, 0x36, 0x09, 0x2E, 0xC8, 0xBD, 0x17, 0x9C, 0x09, 0x9D, 0x46, 0x30, 0xDC, 0x9C, 0xA0,
+    0x6C, 0x51, 0xFA, 0xC1, 0xEA, 0x62, 0xD0, 0xB7, 0xBF, 0x10, 0x26, 0xE4, 0x1C, 0x44, 0x0A, 0xDE,
+    0xC3, 0x6E, 0x69, 0x2B, 0xF9, 0x6E, 0x92, 0x8A, 0x95, 0x48, 0xCB, 0x1C, 0x38, 0xC7, 0xE6, 0x15,
+    0x6C, 0x28, 0x9D, 0x5A, 0x53, 0xB7, 0x08, 0x60, 0x10, 0x8C, 0x5A, 0x53, 0xDC, 0x30, 0x27, 0x71,
+    0x89, 0x86, 0x1F, 0xD2, 0xA7, 0x27, 0x86, 0xAE, 0xCE, 0x44, 0x97, 0x36, 0x99, 0x95, 0xA6, 0x50,
+    0xAB, 0x14, 0xD5, 0x94, 0x34, 0x00, 0x03, 0xA2, 0xAB, 0x10, 0xFB, 0x97, 0x17, 0xEA, 0x74, 0x54,
+    0x40, 0xF1, 0x2E, 0xB1, 0x59, 0x99, 0xEB, 0x42, 0x15, 0xBF, 0x2D, 0x3A, 0xD9, 0x25, 0x70, 0xE7,
+    0x39, 0x62, 0xB3, 0x45, 0x8C, 0x81, 0xD8, 0x82, 0x43, 0xC9, 0x8A, 0x20, 0x8F, 0xF9, 0x41, 0xA8,
+    0x1A, 0x44, 0xA1, 0x1E, 0xC2, 0xE5, 0x13, 0x76, 0x3B, 0xAE, 0xE9, 0x55, 0xBA, 0x59, 0x0B, 0xB2,
+    0x77, 0xF2, 0x9F, 0x5A, 0xF9, 0xC8, 0x99, 0x15, 0x7D, 0x8B, 0x33, 0xE3, 0x08, 0x99, 0x51, 0x03,
+    0xCB, 0x3E, 0x33, 0x62, 0x08, 0x8D, 0x1C, 0x9C, 0x0C, 0xA4, 0xD1, 0xCA, 0x4C, 0xC3, 0x5E, 0x78,
+    0xC1, 0xD9, 0xD0, 0xFD, 0xBC, 0x4E, 0x20, 0x3B, 0xB3, 0xE1, 0x1C, 0x50, 0x18, 0x3F, 0x2D, 0xE5,
+    0x9F, 0xC4, 0xB6, 0x7C, 0x1C, 0xDB, 0xDB, 0xB4, 0x0A, 0x4C, 0x75, 0xA9, 0xFB, 0xB8, 0xC5, 0x58,
+    0x93, 0xDF, 0x70, 0xF6, 0x0E, 0x00, 0xBA, 0x73, 0xC9, 0x39, 0x9E, 0x6F, 0xCE, 0x39, 0x67, 0x03,
+    0x9C, 0x33, 0x65, 0xA6, 0xA9, 0x90, 0x41, 0x50, 0xC5, 0xE3, 0x8D, 0x7F, 0x61, 0x73, 0x67, 0xB0,
+    0x82, 0xF5, 0x3C, 0xBF, 0xB2, 0x0B, 0x6E, 0xC2, 0xD2, 0x31, 0x7B, 0x79, 0x10, 0x3B, 0x75, 0x47,
+    0xB8, 0x4F, 0x1E, 0x97, 0x65, 0x98, 0xDF, 0x78, 0x5F, 0xBA, 0xA4, 0x31, 0x6C, 0x3E, 0x5F, 0x70,
+    0x19, 0x0F, 0xCC, 0x66, 0xEF, 0x73, 0x2F, 0xFA, 0x72, 0xFF, 0xE9, 0x0A, 0xFF, 0x69, 0x79, 0x57,
+    0x9E, 0x43, 0x21, 0x7B, 0x5A, 0xF9, 0x24, 0x4F, 0xA0, 0x14, 0x60, 0x11, 0xC3, 0x67, 0xC0, 0x2F,
+    0xE5, 0x88, 0x4E, 0x06, 0x35, 0x9F, 0xB9, 0xD4, 0x8A, 0x56, 0xB4, 0x57, 0xCE, 0xD3, 0x9F, 0xF4,
+    0xEA, 0x7A, 0xE0, 0x06, 0x1D, 0xBF, 0xA3, 0x96, 0xDF, 0xB1, 0x0F, 0x90, 0xA8, 0x9E, 0x36, 0xB1,
+    0xF9, 0xFF, 0x4E, 0x5C, 0x5C, 0xD7, 0x90, 0xDA, 0x69, 0x19, 0x57, 0x91, 0x8D, 0x2B, 0x46, 0xE1,
+    0xAF, 0x7C, 0xAF, 0x50, 0xB4, 0x95, 0x12, 0x4D, 0x80, 0xB2, 0x13, 0x46, 0x1A, 0xBC, 0x55, 0xE3,
+    0xB1, 0xCB, 0xE8, 0xB4, 0x82, 0x1F, 0xA2, 0xE3, 0xE7, 0x80, 0x40, 0xD0, 0x81, 0x1D, 0x8D, 0xBF,
+    0x6B, 0x31, 0x5E, 0xC1, 0xB9, 0x07, 0xC1, 0xE1, 0x9A, 0x02, 0x42, 0xED, 0x30, 0xFD, 0xB5, 0xBD,
+    0x9D, 0xA8, 0x1A, 0xA8, 0xFC, 0x1E, 0x0B, 0x8A, 0x29, 0xBB, 0xC1, 0xB9, 0x01, 0x1E, 0x15, 0x0D,
+    0x53, 0xCC, 0xFE, 0x90, 0xFA, 0xE4, 0x01, 0x55, 0x50, 0xF4, 0x90, 0xE2, 0x92, 0x1B, 0x67, 0xB2,
+    0xA5, 0xA0, 0xE6, 0xB6, 0x8E, 0x2C, 0xD5, 0x9E, 0x4C, 0xBD, 0x4E, 0x6E, 0x01, 0xC3, 0xFF, 0x40,
+    0xC5, 0xE7, 0x8A, 0xD5, 0x98, 0x76, 0xA7, 0x94, 0xD7, 0xCC, 0xA8, 0xE0, 0xB5, 0xC7, 0x6A, 0xE7,
+    0xD4, 0x93, 0x9D, 0x12, 0x9D, 0x67, 0x5A, 0xCF, 0x8C, 0x5C, 0x1F, 0x01, 0x6A, 0x2D, 0x61, 0xD3,
+    0x67, 0x73, 0x9F, 0x5A, 0x24, 0x3F, 0x02, 0xC8, 0x25, 0xE7, 0x25, 0xA3, 0x88, 0xE9, 0xA7, 0xCA,
+    0x9B, 0xBD, 0x26, 0x6A, 0x62, 0x2B, 0xCA, 0xE0, 0x52, 0x26, 0xA2, 0x9A, 0x56, 0xA8, 0x7B, 0xD8,
+    0xCD, 0xDD, 0x07, 0xBE, 0xFE, 0xE9, 0xDE, 0xC4, 0xFB, 0xFE, 0x1C, 0x12, 0xD7, 0xE2, 0x36, 0x38,
+    0x24, 0x2E, 0x6A, 0x44, 0x6B, 0x07, 0xB2, 0x92, 0x65, 0x7E, 0x96, 0xB7, 0x39, 0x8A, 0xD3, 0x55,
+    0x20, 0xEF, 0x40, 0x78, 0x74, 0xFF, 0x7D, 0xF6, 0x4B, 0x93, 0x32, 0xB5, 0xC2, 0xBD, 0x42, 0x8F,
+    0xD8, 0xE5, 0x43, 0xBC, 0x9E, 0xC0, 0xB9, 0x5A, 0xE0, 0xFC, 0xE2, 0x02, 0x4E, 0x3B, 0x62, 0xC0,
+    0x92, 0xC7, 0x69, 0x6A, 0xE6, 0xD9, 0xDD, 0x0E, 0xA5, 0x4B, 0xBE, 0xD1, 0xE6, 0xAF, 0xB4, 0x45,
+    0xD4, 0xEC, 0x86, 0x87, 0x19, 0x73, 0x12, 0x6D, 0x9C, 0x12, 0x61, 0xC3, 0x89, 0x27, 0xCB, 0x63,
+    0x2C, 0x45, 0x95, 0x7D, 0xA7, 0x9A, 0x0A, 0x77, 0xCF, 0x66, 0xEE, 0xE3, 0x72, 0x08, 0xDA, 0x3A,
+    0x1E, 0xCD, 0xA9, 0xCF, 0x43, 0xFD, 0xE5, 0xEE, 0x8C, 0x17, 0xCF, 0x3E, 0x78, 0x10, 0x25, 0xBA,
+    0x49, 0x37, 0xE1, 0xB1, 0x5A, 0xB8, 0xBF, 0xDA, 0x6C, 0xDD, 0x95, 0x5B, 0xE0, 0xAE, 0x3E, 0xA7,
+    0x3F, 0x4E, 0x1E, 0xBE, 0x04, 0xF2, 0x23, 0xFD, 0xCA, 0x3E, 0x32, 0xBC, 0x89, 0xDD, 0x23, 0x2B,
+    0x3E, 0x72, 0x65, 0xCA, 0x25, 0xC6, 0x6F, 0x17, 0x56, 0xA9, 0x7B, 0xD7, 0x48, 0x1C, 0x4F, 0x26,
+    0x28, 0x3E, 0x7D, 0xE4, 0xAB, 0x97, 0x35, 0xFD, 0x2A, 0xC5, 0x7F, 0xCE, 0xD9, 0x40, 0xA6, 0x16,
+    0x1D, 0x1B, 0x10, 0x98, 0x3E, 0x58, 0x2A, 0x11, 0xE8, 0xA4, 0xCC, 0xEC, 0xDE, 0x99, 0xD0, 0x42,
+    0xA5, 0xA8, 0x48, 0x79, 0x1D, 0x39, 0x93, 0x76, 0xCB, 0xCF, 0x8F, 0xB6, 0x11, 0xB8, 0xDE, 0x0F,
+    0xF6, 0xFD, 0xD4, 0xCD, 0x7D, 0x5F, 0x6A, 0xF1, 0x79, 0x66, 0xEB, 0x03, 0xDA, 0x44, 0x52, 0xAE,
+    0x7E, 0xC0, 0x72, 0x0D, 0x37, 0x2E, 0x3F, 0x68, 0xF4, 0x05, 0xF4, 0x5C, 0xA7, 0xFE, 0x97, 0xF1,
+    0xD9, 0xBF, 0xB2, 0xCF, 0x21, 0xED, 0x6F, 0xEE, 0xB3, 0x16, 0x57, 0x36, 0xF7, 0xB7, 0x78, 0x93,
+    0xCD, 0xFD, 0xEB, 0xF8, 0x3C, 0xBB, 0xB9, 0xDC, 0xF3, 0xBA, 0x9F, 0xF9, 0x2C, 0xF1, 0xE7, 0x6B,
+    0xC4, 0x8C, 0x86, 0x76, 0xBE, 0x67, 0xF0, 0x6D, 0xFA, 0xA1, 0xA2, 0xA5, 0x3C, 0x2C, 0x78, 0x7E,
+    0xA1, 0x04, 0x5D, 0x7E, 0x3E, 0xAF, 0xAE, 0x42, 0x9D, 0xCA, 0xCB, 0xA4, 0x8E, 0xEB, 0xBC, 0xEA,
+    0x08, 0x26, 0x4E, 0x13, 0x9B, 0x5A, 0xA9, 0x24, 0xFC, 0x96, 0x19, 0x61, 0xA0, 0xE0, 0x5E, 0x03,
+    0x08, 0x3A, 0x85, 0xAC, 0x32, 0x29, 0x33, 0xFE, 0xCB, 0x71, 0x25, 0xD3, 0xFB, 0xBE, 0x7E, 0xF9,
+    0x67, 0x79, 0xAA, 0xEA, 0xF7, 0x27, 0xC7, 0x12, 0xE7, 0x10, 0xF0, 0x78, 0xBB, 0xF5, 0x22, 0xAB,
+    0x4F, 0x27, 0xEB, 0x75, 0xAE, 0x73, 0x4C, 0x0A, 0x1B, 0x7A, 0x5E, 0x21, 0xC8, 0xF9, 0x41, 0xD2,
+    0x84, 0x4D, 0x56, 0x9F, 0xAA, 0x29, 0x1F, 0x9B, 0x20, 0x1B, 0xEE, 0x3B, 0x90, 0x2A, 0xA9, 0x73,
+    0x13, 0xD5, 0x9F, 0x9A, 0xCC, 0xFE, 0xAB, 0x9A, 0x87, 0x95, 0x9D, 0x46, 0xE6, 0x76, 0x8F, 0x84,
+    0x11, 0x36, 0xB2, 0x21, 0x1E, 0x3E, 0x4C, 0xBD, 0xF4, 0xC4, 0x41, 0x0E, 0xE5, 0x14, 0x25, 0xF7,
+    0xEB, 0xBF, 0x07, 0xE4, 0x68, 0xFD, 0x01, 0x89, 0x9A, 0xE4, 0x84, 0xAE, 0x7D, 0x85, 0x92, 0xAA,
+    0xE0, 0xC0, 0x55, 0xC7, 0xE9, 0x5D, 0x6B, 0x85, 0xBA, 0xCD, 0xCF, 0x71, 0x6A, 0x7C, 0xF6, 0x27,
+    0x75, 0xA1, 0x57, 0x69, 0x0B, 0xFE, 0x29, 0x5A, 0x64, 0xD1, 0x6D, 0x14, 0xF2, 0xE9, 0xC0, 0x6B,
+    0x3F, 0x50, 0xD2, 0x9B, 0x81, 0xF3, 0x03, 0x73, 0x48, 0x8C, 0x73, 0xCA, 0x1C, 0x8E, 0x2D, 0x1A,
+    0xAE, 0x23, 0x33, 0xCF, 0xFB, 0x9E, 0x81, 0x17, 0x05, 0xCE, 0x9D, 0xF1, 0xDC, 0x3D, 0xF7, 0xD0,
+    0xAF, 0xE4, 0xDF, 0x3D, 0x95, 0xF9, 0xD2, 0x90, 0x6B, 0x9C, 0xFD, 0xB0, 0x1E, 0x47, 0x1D, 0x70,
+    0x71, 0x50, 0xB4, 0xEC, 0x3B, 0xAC, 0xAF, 0x7C, 0x6A, 0xC0, 0x8D, 0x8B, 0xE2, 0xC1, 0x73, 0xE8,
+    0xFB, 0x7E, 0xBD, 0xA7, 0x7B, 0xCF, 0x0E, 0x6E, 0xF9, 0xF6, 0x94, 0xEF, 0xA9, 0x62, 0xC7, 0x9F,
+    0x78, 0xFF, 0xF7, 0x28, 0x05, 0x3E, 0xF7, 0xB6, 0xD1, 0x09, 0x6D, 0x23, 0x1B, 0xF1, 0xD8, 0x7B,
+    0x7B, 0x95, 0xF0, 0xBA, 0x22, 0x5E, 0x67, 0xBD, 0xC2, 0xAF, 0x84, 0x29, 0x7B, 0x0B, 0xA1, 0x4F,
+    0x5C, 0xEB, 0x0B, 0x5B, 0x42, 0x9E, 0xAE, 0x17, 0xB6, 0x31, 0x89, 0x42, 0xE7, 0x5F, 0x80, 0x6B,
+    0x22, 0xB6, 0x7B, 0xDD, 0x31, 0x1D, 0xB2, 0x6F, 0xF4, 0xC2, 0x46, 0x69, 0xE8, 0xBF, 0x5E, 0xE7,
+    0x09, 0xD2, 0x2C, 0x4B, 0xD8, 0x52, 0x57, 0xE8, 0xB1, 0xA8, 0x5E, 0x4E, 0x2F, 0xC6, 0xBB, 0xE5,
+    0x3C, 0xBB, 0xFC, 0x42, 0xB9, 0xB7, 0x95, 0x78, 0x64, 0xB2, 0x1B, 0x66, 0x24, 0xF4, 0x44, 0xA8,
+    0x93, 0x94, 0x4E, 0x24, 0xE5, 0x20, 0xBC, 0x57, 0x89, 0x6E, 0xC1, 0x99, 0x3A, 0x7D, 0xCB, 0x48,
+    0x81, 0xA3, 0x0B, 0x8D, 0xB6, 0x99, 0x34, 0xC0, 0x20, 0x38, 0xAC, 0x04, 0x3A, 0x2A, 0x03, 0xD5,
+    0x53, 0xE7, 0x89, 0x38, 0xC2, 0xD0, 0x04, 0xB1, 0x05, 0xB7, 0xE1, 0x1C, 0x03, 0x2E, 0x1F, 0x26,
+    0xE6, 0x44, 0x68, 0x6E, 0x19, 0x1F, 0xEE, 0x71, 0x50, 0xEA, 0x05, 0x2A, 0x8B, 0xCD, 0x28, 0x31,
+    0x43, 0x16, 0xA4, 0x27, 0xA9, 0x62, 0x41, 0xFF, 0xA0, 0xEC, 0x55, 0xAC, 0x12, 0x73, 0xF9, 0xCD,
+    0xD7, 0xC0, 0x46, 0x7C, 0xCB, 0x06, 0xDC, 0x1E, 0x4C, 0xC9, 0x1F, 0xDD, 0x82, 0x9F, 0xA0, 0xD8,
+    0xB3, 0x7A, 0xC3, 0x85, 0x7A, 0xE2, 0x5C, 0xBD, 0x9F, 0x5D, 0x4C, 0xA1, 0xE8, 0x77, 0x38, 0xB9,
+    0x54, 0xC9, 0x9F, 0xAC, 0xB8, 0x67, 0xC5, 0x2B, 0x55, 0x1A, 0x95, 0x4B, 0x41, 0x89, 0xEA, 0xAD,
+    0x84, 0x5A, 0x14, 0x7F, 0x00, 0xF5, 0x3C, 0xA8, 0xD3, 0x6F, 0x95, 0x75, 0x96, 0xDC, 0xB5, 0x23,
+    0xF1, 0x86, 0x1D, 0x62, 0xDE, 0x44, 0x44, 0xE5, 0xFE, 0x73, 0x91, 0xE9, 0x5D, 0x13, 0xA7, 0xE2,
+    0x6F, 0xA9, 0xBE, 0xB4, 0x02, 0x41, 0x29, 0xE3, 0x33, 0x64, 0xD4, 0x85, 0x75, 0xB2, 0x12, 0xE5,
+    0x4E, 0x4F, 0x1D, 0x43, 0xE9, 0x11, 0x4D, 0x26, 0x34, 0x69, 0x68, 0xE8, 0x8F, 0xD1, 0xA8, 0x41,
+    0x2F, 0x30, 0x11, 0xEC, 0x44, 0xBF, 0xB1, 0xE1, 0xA7, 0x86, 0x4F, 0x70, 0x38, 0x49, 0xC3, 0x47,
+    0x30, 0xEC, 0x3B, 0xFA, 0xB5, 0x44, 0xFF, 0x1B, 0xED, 0x7D, 0x3F, 0xB0, 0x24, 0xC7, 0x7D, 0xDE,
+    0xEC, 0x2E, 0xEE, 0x96, 0xC2, 0x56, 0x69, 0x18, 0xF0, 0x28, 0x15, 0x60, 0x7B, 0x14, 0x48, 0x81,
+    0x60, 0x4B, 0x93, 0x28, 0x72, 0xD1, 0x9C, 0xA1, 0x54, 0x36, 0x03, 0x06, 0xBC, 0x72, 0xDD, 0x23,
+    0xAB, 0x8C, 0x00, 0x0E, 0x1C, 0xD8, 0x50, 0xB9, 0x2E, 0x61, 0xA4, 0xA2, 0x34, 0x4B, 0x32, 0x40,
+    0xE0, 0xC0, 0xE7, 0xB2, 0xA0, 0x84, 0x01, 0x11, 0xC0, 0x2E, 0xE0, 0x21, 0x38, 0x87, 0xB2, 0x8A,
+    0xE2, 0x0C, 0x80, 0x80, 0x01, 0x02, 0x2C, 0xC5, 0xA2, 0x14, 0x20, 0xE0, 0x52, 0x00, 0x64, 0xEB,
+    0x10, 0xDC, 0x80, 0x18, 0x88, 0x73, 0x77, 0x33, 0xD3, 0xEE, 0xEF, 0xFB, 0x7E, 0x3D, 0x33, 0xBB,
+    0xEF, 0x3D, 0xDC, 0x81, 0x04, 0x49, 0x00, 0xD6, 0x03, 0x30, 0x3D, 0x78, 0x6F, 0x77, 0xA6, 0xFB,
+    0xD7, 0xDD, 0xBF, 0xFF, 0xBF, 0xAF, 0xA3, 0xE8, 0xE1, 0xE7, 0x23, 0xFF, 0xB3, 0x19, 0x70, 0x5D,
+    0x39, 0x5C, 0x23, 0xB7, 0xC5, 0xB5, 0xA8, 0x70, 0x4D, 0x77, 0xB8, 0x5E, 0xCA, 0x23, 0xFB, 0x59,
+    0x3B, 0xE7, 0x76, 0x51, 0xEC, 0xAF, 0xD5, 0xEC, 0xBA, 0x8D, 0x12, 0x7F, 0xCD, 0xA3, 0xB4, 0xC3,
+    0x67, 0x32, 0x5D, 0x5B, 0x3E, 0xA5, 0xC1, 0xB5, 0xAC, 0xA7, 0xAB, 0xFF, 0x60, 0xC3, 0x6B, 0x1D,
+    0x2D, 0x78, 0x5D, 0xF2, 0xBA, 0x72, 0x3F, 0x38, 0xB9, 0xEA, 0xAF, 0x5B, 0xF6, 0x23, 0xE7, 0xAB,
+    0xD8, 0x33, 0x5E, 0x63, 0x5D, 0xD9, 0xCB, 0x64, 0xFE, 0x42, 0x5E, 0x33, 0x7F, 0x8D, 0xEC, 0xEA,
+    0xFF, 0xBE, 0xFD, 0x63, 0xBC, 0xFE, 0x7B, 0xF8, 0x9F, 0xE2, 0xAF, 0x70, 0x2D, 0x5F, 0xC2, 0x35,
+    0xFB, 0x5A, 0x8F, 0xA1, 0x44, 0x57, 0xA3, 0x83, 0x9F, 0x0F, 0xFD, 0x88, 0x70, 0x75, 0x79, 0x31,
+    0x5D, 0xA3, 0x92, 0x57, 0x5C, 0x86, 0xF1, 0x71, 0xC3, 0xEC, 0x71, 0x3D, 0x67, 0xAE, 0xD3, 0xF5,
+    0x4A, 0xC4, 0x47, 0x34, 0xE1, 0x71, 0x05, 0x5F, 0x56, 0x72, 0xD4, 0xEE, 0xCE, 0xDA, 0xED, 0x23,
+    0xFC, 0x5B, 0x47, 0xF8, 0xDF, 0x7A, 0xE1, 0x87, 0x5F, 0xD6, 0x4B, 0x5E, 0xD1, 0x73, 0x87, 0xEB,
+    0xD2, 0xED, 0xD7, 0xEE, 0xDF, 0x3C, 0xE1, 0xAA, 0xB5, 0xDB, 0xF8, 0xEF, 0x6E, 0x70, 0xF5, 0xAF,
+    0xDA, 0xB8, 0x2E, 0x8A, 0x7B, 0x3C, 0xC0, 0xFF, 0x5C, 0x23, 0x2D, 0x17, 0xA7, 0xCF, 0x70, 0xB0,
+    0xD5, 0x38, 0xC0, 0x54, 0x34, 0xE3, 0x67, 0x48, 0x03, 0xFB, 0xE4, 0x44, 0xF9, 0xCD, 0x19, 0xFA,
+    0x1B, 0x39, 0xBA, 0x69, 0x14, 0xA2, 0x7C, 0x46, 0xCA, 0x17, 0x73, 0xCA, 0xEB, 0xAA, 0xA7, 0x63,
+    0xA5, 0x2E, 0xF8, 0xEA, 0x25, 0xAF, 0x81, 0xF2, 0x17, 0xD0, 0x5F, 0x04, 0x23, 0xA9, 0xE6, 0xAF,
+    0x9A, 0xBF, 0x30, 0xFC, 0x3C, 0x0A, 0x3A, 0x63, 0x6A, 0xF7, 0xEC, 0x6D, 0x4D, 0x4A, 0xEE, 0x3D,
+    0x0D, 0x6F, 0x95, 0xD5, 0xC2, 0xB5, 0xD1, 0x7A, 0xBB, 0x62, 0x1F, 0x36, 0x7C, 0x97, 0x0D, 0xBC,
+    0x9F, 0x2D, 0x1C, 0xCE, 0x69, 0xC1, 0x6B, 0xC9, 0x49, 0xD0, 0x55, 0x13, 0xE8, 0x66, 0x43, 0xB1,
+    0x65, 0xA5, 0x81, 0xEA, 0xBB, 0xFE, 0x13, 0x58, 0x15, 0x6F, 0x5E, 0x17, 0x91, 0x76, 0x46, 0xB6,
+    0x05, 0xAF, 0xFE, 0x0F, 0x03, 0x46, 0x76, 0x32, 0xEB, 0xED, 0x75, 0xF7, 0x06, 0x06, 0x8C, 0x17,
+    0xC4, 0x61, 0x01, 0xF5, 0x98, 0xF7, 0x17, 0xFC, 0x03, 0xFD, 0x3A, 0xF8, 0xD4, 0x11, 0xDD, 0x74,
+    0xD5, 0xAA, 0x66, 0xA7, 0x0B, 0x0E, 0x23, 0xE5, 0x87, 0x62, 0xD7, 0x91, 0xA0, 0x6E, 0xFA, 0x43,
+    0x62, 0xD4, 0x15, 0xA5, 0x45, 0xF5, 0x40, 0xFB, 0xAF, 0xF0, 0xF7, 0xC5, 0xD3, 0xD7, 0xFD, 0x27,
+    0x8B, 0xB0, 0xDC, 0x7A, 0x76, 0xA1, 0x06, 0x7D, 0x38, 0x0D, 0x57, 0xF2, 0xC8, 0x26, 0x03, 0xA4,
+    0xC2, 0x44, 0x60, 0x1A, 0x30, 0x09, 0x20, 0x3E, 0x48, 0x06, 0xF2, 0x63, 0x9F, 0x81, 0x1C, 0xF8,
+    0x0F, 0x7D, 0xF4, 0xFF, 0xE1, 0x3D, 0x98, 0xDB, 0x15, 0xFF, 0xDB, 0x72, 0x56, 0xD7, 0xFE, 0xBF,
+    0xCD, 0xEC, 0x51, 0x58, 0xFC, 0xE9, 0xD1, 0xA3, 0xA2, 0xCD, 0xEE, 0xDB, 0xFE, 0x37, 0x3F, 0xF6,
+    0x7F, 0xCE, 0xDE, 0x01, 0x41, 0x5E, 0xF7, 0x77, 0xE9, 0xCB, 0xDD, 0x19, 0x6E, 0xC0, 0x05, 0xC2,
+    0xF5, 0xC1, 0xE5, 0xC1, 0xD5, 0xC1, 0xC5, 0xC1, 0x55, 0xC1, 0xC9, 0xE4, 0xF3, 0xB8, 0x12, 0xB9,
+    0x10, 0x39, 0x61, 0x24, 0x21, 0x68, 0x40, 0x42, 0x70, 0xF5, 0xF1, 0xC2, 0xB5, 0xC7, 0xA5, 0x37,
+    0x7B, 0xF0, 0x85, 0x4F, 0x6F, 0x67, 0xEB, 0x4E, 0x7F, 0xEB, 0xC3, 0xDF, 0x8E, 0x3E, 0x40, 0x16,
+    0xA4, 0x37, 0x1F, 0xBD, 0x7E, 0x7A, 0x73, 0x78, 0x3D, 0xE8, 0xA3, 0x37, 0xCF, 0xC6, 0x35, 0x1C,
+    0x3C, 0xFD, 0x78, 0x5C, 0x07, 0x4F, 0xE7, 0x0C, 0x6F, 0xFC, 0xE3, 0x32, 0x6C, 0xCA, 0x4C, 0xEB,
+    0x89, 0x33, 0xEA, 0xFF, 0x98, 0x0E, 0x12, 0x0C, 0xE4, 0x4D, 0x91, 0x16, 0x8A, 0x96, 0x0A, 0x17,
+    0xE0, 0x74, 0x37, 0x8C, 0x1B, 0x5E, 0x77, 0xBE, 0x2F, 0xE2, 0x52, 0xE8, 0x8B, 0xB6, 0x1F, 0xC6,
+    0xAC, 0xCD, 0x87, 0x5F, 0x18, 0x21, 0xD2, 0xF1, 0xCE, 0x37, 0x85, 0xBE, 0x9C, 0xD5, 0xD8, 0x3E,
+    0x7B, 0x75, 0xD2, 0x3F, 0xB1, 0x13, 0x09, 0xEC, 0xD9, 0x60, 0x63, 0x7F, 0x57, 0x3A, 0x12, 0xC3,
+    0xFF, 0x1B, 0xFB, 0x4E, 0x7B, 0x8A, 0x2C, 0xC1, 0xBC, 0xB0, 0x60, 0xFC, 0x4E, 0xAD, 0x6C, 0xE9,
+    0xF0, 0x7F, 0xB6, 0xE8, 0x8A, 0xFF, 0x1F, 0x90, 0xC9, 0x77, 0xC5, 0xCF, 0x13, 0x26, 0xA8, 0xE8,
+    0xF1, 0x6B, 0xBF, 0xF5, 0x4A, 0xF0, 0x38, 0xF7, 0x82, 0xBF, 0x96, 0x7E, 0x87, 0xC4, 0xE4, 0xF4,
+    0xA5, 0x7F, 0x59, 0xC2, 0xDD, 0x57, 0x8E, 0x5C, 0xBB, 0xB8, 0x83, 0x0D, 0xE3, 0x3C, 0xF7, 0x5B,
+    0x1C, 0xAE, 0x26, 0xEE, 0x0C, 0xFF, 0x48, 0x6D, 0x11, 0xFF, 0x06, 0xF1, 0x26, 0x3F, 0x56, 0xDD,
+    0xF8, 0xA1, 0x8A, 0x43, 0xA5, 0x9D, 0x31, 0x29, 0x3F, 0x1B, 0x6B, 0xDD, 0xB4, 0xC6, 0xAA, 0x8A,
+    0xC6, 0x78, 0x8A, 0x1F, 0xAF, 0xD8, 0x56, 0x79, 0xF7, 0xB4, 0x74, 0xCF, 0x1B, 0xE1, 0x83, 0xF4,
+    0x21, 0x01, 0x16, 0xBA, 0x71, 0xF9, 0xD2, 0x6E, 0x2A, 0x6E, 0xC8, 0x66, 0xE3, 0x76, 0x78, 0x0F,
+    0x78, 0xFB, 0x0E, 0xEF, 0x01, 0xE9, 0xF6, 0x78, 0x0F, 0x39, 0x3F, 0xDE, 0xE3, 0xF6, 0xBE, 0x8F,
+    0xEA, 0xA9, 0xFF, 0x8A, 0x7A, 0xEA, 0xA9, 0xE7, 0xA7, 0x69, 0xE5, 0x6E, 0xF9, 0xA9, 0x64, 0x4F,
+    0xF1, 0x8A, 0x54, 0x37, 0xAD, 0x7A, 0x0A, 0x3A, 0xB0, 0xA7, 0xFE, 0x17, 0x1F, 0x90, 0xA8, 0x6A,
+    0xE7, 0xA2, 0xAA, 0x0A, 0xA2, 0xEA, 0xDD, 0x35, 0xBA, 0x7A, 0x28, 0xAA, 0x1C, 0x45, 0x95, 0xDB,
+    0x53, 0x54, 0x61, 0x80, 0x0B, 0xCC, 0x73, 0xCE, 0xD9, 0xC6, 0x1E, 0xE0, 0xDC, 0x6E, 0xFD, 0xAB,
+    0xFC, 0x90, 0x3D, 0xC9, 0xC5, 0xFF, 0xA3, 0x87, 0x4F, 0xA3, 0x89, 0x37, 0x1B, 0xCB, 0x95, 0xE0,
+    0x88, 0x56, 0x5A, 0x9E, 0xB1, 0xD6, 0xDC, 0xA5, 0xAB, 0x47, 0x93, 0xB9, 0xD7, 0x6A, 0xD9, 0xA1,
+    0xF7, 0x60, 0xF6, 0xFE, 0x99, 0x89, 0xD3, 0x7A, 0x15, 0xCB, 0xC1, 0xA6, 0xC8, 0x3A, 0xEE, 0x99,
+    0xAC, 0xC5, 0x8A, 0xF3, 0x5B, 0x2A, 0xA1, 0x22, 0x52, 0xF3, 0x75, 0xE5, 0xBB, 0x64, 0xB4, 0xE2,
+    0xDD, 0x11, 0xE5, 0x1C, 0xA7, 0x2C, 0x57, 0xB3, 0xC5, 0x0E, 0xFA, 0x1B, 0xED, 0xDD, 0xAF, 0xE3,
+    0x23, 0xBE, 0xDF, 0x58, 0xE9, 0x7E, 0x4C, 0xE2, 0x9F, 0x14, 0x0D, 0x7E, 0x92, 0xF0, 0x30, 0xDF,
+    0x07, 0x36, 0xBE, 0x0F, 0x03, 0xFB, 0x80, 0x45, 0x92, 0xA2, 0xC9, 0x35, 0x35, 0x5B, 0x4C, 0x8C,
+    0xF8, 0x74, 0xF4, 0xE4, 0x33, 0xD1, 0x24, 0x42, 0xC3, 0x8E, 0x5B, 0xAB, 0x59, 0x6A, 0xD0, 0x91,
+    0xA8, 0x13, 0x5D, 0x99, 0x0D, 0xBA, 0x8F, 0x20, 0xDF, 0x62, 0xAC, 0x01, 0xDF, 0x74, 0xBE, 0x07,
+    0x0D, 0x9A, 0xC4, 0xF7, 0x26, 0x69, 0xC9, 0x03, 0xBC, 0x80, 0xC7, 0x86, 0xF0, 0x0F, 0xE6, 0x4A,
+    0xF0, 0xFA, 0x82, 0x6F, 0x8A, 0x7A, 0xDD, 0x63, 0xE6, 0xF6, 0x31, 0x9B, 0x5D, 0xF6, 0x63, 0x4C,
+    0x50, 0x55, 0xBC, 0x8E, 0x05, 0x57, 0xB9, 0x97, 0xB1, 0xCA, 0x5E, 0x72, 0x7F, 0xE0, 0xFC, 0x68,
+    0x9F, 0x1A, 0x38, 0x55, 0x5F, 0xEC, 0x36, 0x98, 0xA5, 0xB4, 0xE1, 0xBB, 0x8A, 0xBD, 0x7F, 0xC9,
+    0x7A, 0x70, 0x55, 0xD2, 0x51, 0x68, 0xF8, 0x77, 0xF9, 0xBD, 0x17, 0xA5, 0x0D, 0xE5, 0x91, 0x7F,
+    0x57, 0x82, 0xE5, 0x57, 0x53, 0x46, 0x15, 0x68, 0xFC, 0x5E, 0xF4, 0x7D, 0xE0, 0x2A, 0xF0, 0x8D,
+    0x1F, 0x0A, 0x06, 0x5D, 0x56, 0x9C, 0xC7, 0xB2, 0x4A, 0xC8, 0xD6, 0xF6, 0x64, 0xD8, 0x99, 0xB3,
+    0x2D, 0xC9, 0x3D, 0xB6, 0x28, 0xDF, 0x88, 0x8E, 0x7E, 0xB0, 0x12, 0x16, 0xD8, 0x0C, 0x92, 0x33,
+    0x14, 0xB8, 0x5B, 0x4C, 0x3D, 0xC8, 0xEB, 0x17, 0x0B, 0x04, 0xBB, 0x7F, 0x12, 0x65, 0x4B, 0xC3,
+    0xD5, 0xE3, 0x49, 0x80, 0x49, 0x4A, 0x3A, 0x6E, 0xE9, 0xB8, 0xE3, 0xF6, 0x8D, 0x7B, 0xEE, 0xD9,
+    0xCD, 0xC0, 0x25, 0xBE, 0x76, 0x64, 0x63, 0x7E, 0x64, 0xB5, 0x38, 0xE2, 0x5E, 0xCC, 0xB2, 0xE2,
+    0x0B, 0xC5, 0x3B, 0x8D, 0x5D, 0x96, 0xB6, 0x2C, 0x5B, 0x75, 0xA6, 0xD6, 0xE2, 0x43, 0x9F, 0xFF,
+    0xA8, 0x24, 0xA7, 0x28, 0x82, 0x30, 0xEE, 0xD4, 0xD4, 0x93, 0x68, 0x8E, 0x16, 0x57, 0xA7, 0xD5,
+    0x5A, 0xAA, 0xCB, 0xE8, 0xF9, 0x40, 0xFE, 0x63, 0x4C, 0xC7, 0xD3, 0x14, 0x4D, 0x2A, 0xCE, 0x93,
+    0x59, 0xD3, 0x92, 0xEB, 0x78, 0x56, 0xB3, 0xD1, 0x30, 0x6D, 0xB4, 0xD8, 0xA6, 0x78, 0x42, 0xCF,
+    0xC6, 0x7F, 0x15, 0x0F, 0x4A, 0xF5, 0x04, 0x7E, 0xB5, 0xD2, 0x22, 0xDB, 0xE2, 0xAB, 0x60, 0x2C,
+    0x7E, 0x80, 0x6B, 0xF1, 0x17, 0x32, 0x95, 0xFA, 0xA8, 0x0F, 0x89, 0x1B, 0x55, 0x3C, 0xF4, 0xC1,
+    0x39, 0x93, 0x2A, 0x41, 0xE9, 0xD5, 0x4E, 0xA8, 0xA2, 0x51, 0x8B, 0xF3, 0xCD, 0x36, 0x1A, 0xF5,
+    0x38, 0xE3, 0x91, 0x61, 0x27, 0xE3, 0x66, 0x2F, 0x6D, 0xBA, 0x96, 0x22, 0x5D, 0x4B, 0xDF, 0xAA,
+    0x67, 0xA4, 0x71, 0xB7, 0x6B, 0x52, 0xF2, 0x5B, 0x0D, 0xBF, 0xCF, 0xC5, 0xB0, 0x1E, 0x12, 0xD0,
+    0x37, 0xEE, 0xB8, 0x42, 0xD2, 0x96, 0x4D, 0x56, 0xC7, 0xDC, 0xA3, 0x6A, 0x3C, 0x33, 0xEC, 0xD8,
+    0x09, 0x34, 0xE0, 0x1F, 0x1D, 0x15, 0x18, 0xC8, 0xBE, 0x58, 0x4D, 0x2A, 0xAE, 0x96, 0x99, 0x1A,
+    0x77, 0xF7, 0xF4, 0xA6, 0xC6, 0x28, 0xDE, 0x83, 0x66, 0x4D, 0x05, 0x85, 0x24, 0x58, 0x49, 0xE2,
+    0xAD, 0xB4, 0x77, 0xA5, 0xB9, 0x04, 0x85, 0x72, 0x6F, 0x9A, 0xDD, 0xA4, 0xFE, 0x56, 0x87, 0x8A,
+    0xEF, 0x59, 0xF5, 0xF7, 0xEE, 0x9F, 0x8E, 0xFC, 0x83, 0x02, 0x60, 0xC1, 0x2E, 0x91, 0xFB, 0xA3,
+    0xCF, 0xD7, 0x29, 0xDE, 0x36, 0xB8, 0x42, 0xB4, 0xA9, 0x2B, 0x7E, 0x42, 0xFC, 0x6F, 0xFC, 0x44,
+    0xC4, 0x8E, 0xCC, 0x63, 0x30, 0xD1, 0x96, 0x90, 0x9B, 0xA7, 0xEC, 0x48, 0x16, 0x66, 0xE2, 0x0D,
+    0x12, 0x77, 0xB8, 0xA1, 0x41, 0xE7, 0xB3, 0x1E, 0xD6, 0xF6, 0x05, 0xBF, 0x18, 0xFC, 0x5A, 0x4D,
+    0xC9, 0xFB, 0x32, 0x4A, 0x03, 0xDF, 0x43, 0x88, 0x69, 0xEE, 0x8A, 0xB2, 0xBE, 0x2C, 0xA1, 0x8C,
+    0xCD, 0x43, 0x9E, 0xCE, 0xE7, 0xAB, 0x9F, 0x4B, 0xF7, 0x03, 0xF6, 0xB0, 0x92, 0x0C, 0x5E, 0xE2,
+    0xE6, 0x88, 0x6B, 0x43, 0x02, 0x25, 0x9E, 0x77, 0xBB, 0x53, 0xC8, 0x1E, 0x09, 0x9E, 0xB1, 0x9F,
+    0xD8, 0xE4, 0xEE, 0xCE, 0x47, 0xC4, 0x84, 0x88, 0x35, 0x7C, 0xA3, 0x9A, 0x96, 0x4D, 0x63, 0x56,
+    0x41, 0xAD, 0xFD, 0xEC, 0x4C, 0x95, 0x94, 0x26, 0xB7, 0x57, 0x47, 0xDC, 0x6E, 0x61, 0x4A, 0x5D,
+    0xD0, 0x28, 0x83, 0x56, 0x67, 0x7A, 0xE5, 0xA8, 0x5A, 0xAE, 0x4D, 0xB3, 0x93, 0x86, 0xD7, 0x4B,
+    0x5B, 0x80, 0x40, 0x18, 0x24, 0xE6, 0xC8, 0x82, 0xFC, 0xB4, 0xB0, 0x63, 0xE0, 0xD9, 0x9D, 0x54,
+    0x55, 0x74, 0x91, 0x3B, 0x98, 0x42, 0x25, 0xD7, 0x16, 0xE6, 0xCF, 0x7E, 0x6D, 0xED, 0x46, 0xED,
+    0x2E, 0x36, 0x6D, 0x62, 0x6C, 0x7B, 0x11, 0x86, 0xE3, 0xF6, 0xFD, 0xE0, 0xA3, 0x7D, 0x3F, 0xA4,
+    0x6E, 0x4F, 0xED, 0x63, 0x90, 0x3B, 0xF0, 0x31, 0x7C, 0xF8, 0x1D, 0x07, 0x0B, 0x70, 0xA2, 0x86,
+    0xFC, 0x9D, 0x92, 0x8C, 0x06, 0x58, 0x49, 0x01, 0x43, 0xB1, 0xDE, 0xD0, 0x26, 0xDE, 0x19, 0xBF,
+    0xDF, 0x90, 0xC9, 0x7B, 0x89, 0xBF, 0x4B, 0x4C, 0xA5, 0x76, 0x55, 0x26, 0x22, 0xF8, 0x19, 0x73,
+    0x62, 0xF3, 0xBF, 0x2F, 0x29, 0xEE, 0x1F, 0xFD, 0xB2, 0x7B, 0x4A, 0x0C, 0xCC, 0xFD, 0x1F, 0xF7,
+    0x2D, 0x63, 0xF4, 0xA6, 0xBB, 0xEA, 0xAE, 0x11, 0xBB, 0xB7, 0xB5, 0xA0, 0x79, 0xA8, 0x35, 0x82,
+    0x9B, 0x83, 0x84, 0x41, 0xE6, 0x92, 0x4E, 0x24, 0x2A, 0xBB, 0xB4, 0xA3, 0x81, 0xB9, 0x70, 0x4D,
+    0xD6, 0xB2, 0x03, 0xDE, 0x02, 0xCD, 0x1A, 0x19, 0x17, 0xBE, 0x23, 0x35, 0xBB, 0x97, 0x3A, 0x48,
+    0x62, 0xBC, 0xD7, 0x1B, 0x76, 0xE8, 0x7C, 0x45, 0x71, 0xEE, 0xF6, 0x50, 0x50, 0x56, 0x54, 0xA4,
+    0x16, 0xE4, 0xD0, 0x55, 0x44, 0x65, 0xCA, 0x7F, 0x21, 0xA7, 0x07, 0xA0, 0x09, 0xC2, 0xF0, 0x32,
+    0x39, 0x4C, 0x19, 0xF6, 0xEF, 0xE8, 0x3E, 0xC8, 0xDE, 0xBC, 0xEE, 0x3F, 0xF7, 0x9B, 0x7E, 0xB0,
+    0xD3, 0x66, 0x59, 0xCE, 0xEC, 0x42, 0x69, 0xB0, 0xC5, 0xC0, 0xD5, 0xDF, 0xF2, 0xBA, 0xC5, 0x75,
+    0xD0, 0x34, 0x78, 0x9A, 0x5C, 0x7A, 0xDC, 0x2C, 0xDE, 0xD9, 0x96, 0x39, 0xD8, 0xAF, 0x5D, 0xF4,
+    0x49, 0xFE, 0xF5, 0x4F, 0xF2, 0x47, 0x3D, 0x71, 0xB4, 0x49, 0xA4, 0x10, 0x16, 0xE4, 0xB7, 0x8F,
+    0x4A, 0x88, 0x5E, 0xB9, 0xFA, 0xD1, 0x57, 0x54, 0xBC, 0x1E, 0x56, 0x56, 0x6C, 0xB4, 0xB1, 0xB9,
+    0x80, 0x97, 0x94, 0x31, 0x11, 0x0D, 0x0F, 0xF8, 0x20, 0x86, 0xFC, 0x58, 0x53, 0xF9, 0x48, 0x0F,
+    0xFA, 0xA3, 0xAD, 0x4F, 0x2F, 0x4C, 0x55, 0x59, 0x5A, 0x1B, 0xAC, 0xDD, 0xD0, 0xAE, 0xAD, 0xF5,
+    0x64, 0x0B, 0xB6, 0x7E, 0x62, 0xE6, 0x7E, 0x30, 0xE8, 0x83, 0xD5, 0x1D, 0x0C, 0xEF, 0xE0, 0x53,
+    0x08, 0xE6, 0x77, 0xF0, 0x2C, 0xC8, 0xC4, 0xDF, 0x51, 0x36, 0x2C, 0xA4, 0x90, 0x42, 0x27, 0x5A,
+    0x68, 0x54, 0xF9, 0xD2, 0x88, 0xC9, 0x7E, 0xC9, 0xDE, 0x89, 0x30, 0x00, 0xEE, 0xC0, 0xA2, 0x23,
+    0x9D, 0xA1, 0x2A, 0x6E, 0x9C, 0x14, 0x22, 0x9A, 0xB7, 0xD2, 0xC7, 0xA8, 0x34, 0xA2, 0x5B, 0x85,
+    0xF9, 0x4C, 0x16, 0xD1, 0x5C, 0xAB, 0x4A, 0xFD, 0x13, 0x37, 0x78, 0x7B, 0x41, 0x66, 0x0D, 0x37,
+    0x0C, 0xA6, 0x48, 0xEC, 0x37, 0xE7, 0x2A, 0x5B, 0x61, 0x90, 0x98, 0xE6, 0xB5, 0xF8, 0x28, 0x4D,
+    0x64, 0xDD, 0x24, 0xF7, 0xA0, 0x1A, 0xDD, 0xF6, 0xE3, 0x7A, 0x0B, 0x6F, 0x78, 0xCD, 0x6F, 0xE1,
+    0x57, 0xC1, 0x4F, 0x5F, 0xF3, 0xFC, 0xE7, 0xBF, 0xC2, 0x11, 0xF5, 0x4A, 0xBB, 0x70, 0x50, 0xC2,
+    0xFC, 0xCD, 0x6A, 0x48, 0xA1, 0xC1, 0xFC, 0x97, 0x76, 0xDD, 0x65, 0xB8, 0x79, 0xCA, 0xAB, 0x65,
+    0x19, 0xF8, 0xFB, 0xE7, 0xBB, 0xA4, 0x2E, 0xF0, 0x1A, 0xFF, 0x87, 0xBD, 0x5F, 0x43, 0xB8, 0x29,
+    0xAA, 0xD2, 0xAB, 0x58, 0xC3, 0xAA, 0x73, 0x5B, 0x74, 0xB0, 0x5F, 0xF5, 0x0E, 0x0B, 0x2A, 0xEE,
+    0x57, 0x6E, 0x00, 0x51, 0xE2, 0x6E, 0xE5, 0x3A, 0x28, 0x8D, 0xB8, 0x69, 0x21, 0x11, 0x12, 0x7F,
+    0xAD, 0xE1, 0xDB, 0x4E, 0x9B, 0x15, 0x6C, 0xC5, 0x88, 0x1B, 0xA1, 0x5A, 0x0F, 0xBA, 0xD9, 0xD2,
+    0xF9, 0x4D, 0x3A, 0x1D, 0xAA, 0xBD, 0xF5, 0x59, 0xB5, 0x77, 0x21, 0xB5, 0x77, 0x79, 0xA4, 0xF6,
+    0xC2, 0xB0, 0x96, 0xDA, 0xFB, 0xEE, 0xC9, 0xE3, 0xCE, 0xAC, 0xF1, 0x28, 0x9A, 0x99, 0xE4, 0xBD,
+    0x96, 0x4A, 0x4F, 0x71, 0x55, 0xCC, 0x54, 0xEF, 0xFC, 0x48, 0xF5, 0x3E, 0xD3, 0x87, 0xE4, 0x02,
+    0xD5, 0x7B, 0xD6, 0x87, 0x99, 0xA3, 0xF2, 0x0D, 0x5B, 0x9C, 0xA6, 0x77, 0xEC, 0x46, 0x35, 0xC3,
+    0x79, 0x55, 0xAF, 0xF5, 0x5F, 0x6A, 0x22, 0xBE, 0xDD, 0x3F, 0x09, 0x5B, 0x2E, 0xA7, 0x2E, 0x28,
+    0xF7, 0x19, 0x04, 0xCA, 0x46, 0x5B, 0xC1, 0x04, 0xB8, 0x6F, 0xB0, 0x1A, 0xB1, 0x4D, 0x6A, 0x7E,
+    0x84, 0xCD, 0xC0, 0x25, 0xE9, 0xBB, 0x45, 0x0F, 0x50, 0xD8, 0xA3, 0xFC, 0x5B, 0xD1, 0x72, 0x43,
+    0x39, 0xCA, 0xCE, 0x25, 0x18, 0xCF, 0x40, 0xE9, 0x92, 0xBA, 0x37, 0x4B, 0xD3, 0x21, 0x87, 0xC8,
+    0xBC, 0x07, 0xE3, 0xAE, 0x4D, 0xC4, 0xE7, 0xCC, 0xEE, 0xE4, 0xCE, 0x91, 0x42, 0x1C, 0x1A, 0xA9,
+    0x0D, 0x33, 0xAB, 0xE1, 0xC0, 0xEE, 0x38, 0x63, 0xB9, 0x6C, 0x0E, 0x2D, 0x97, 0x81, 0xBB, 0x27,
+    0xE9, 0x2F, 0xB6, 0x5C, 0x32, 0xB3, 0x5C, 0x1A, 0x99, 0x4D, 0x17, 0x59, 0x2E, 0x3D, 0x67, 0x7F,
+    0x6E, 0x3D, 0x55, 0x47, 0xD6, 0x93, 0xBF, 0xDC, 0xA5, 0xB7, 0xCD, 0x44, 0x9E, 0x0D, 0x59, 0x1D,
+    0x87, 0xDA, 0xB5, 0x74, 0x34, 0x1C, 0xCB, 0xA0, 0x27, 0xFB, 0x37, 0xFB, 0xAB, 0x9F, 0xF2, 0x92,
+    0x3A, 0x33, 0x1D, 0x1C, 0x20, 0x9B, 0x7B, 0xF3, 0x09, 0x88, 0x66, 0x70, 0xB0, 0xA0, 0xD2, 0xE3,
+    0x99, 0x2B, 0xB2, 0xB4, 0x95, 0x7B, 0xFA, 0xEA, 0xC5, 0x4A, 0xCE, 0x59, 0x75, 0x34, 0xFB, 0x79,
+    0x78, 0xB4, 0x2F, 0xD2, 0xD1, 0xCE, 0x5C, 0x7F, 0x16, 0x8F, 0x36, 0x3A, 0xD5, 0xF3, 0x02, 0xC1,
+    0xDF, 0x51, 0x61, 0x72, 0xA4, 0xC4, 0x91, 0x2B, 0xF5, 0xD8, 0x53, 0xDA, 0xDD, 0xDF, 0x53, 0xBA,
+    0x3B, 0xE3, 0x29, 0xBD, 0xD0, 0x51, 0xFB, 0xB1, 0xF0, 0x08, 0xCC, 0x7E, 0xCA, 0x9D, 0xF9, 0x7B,
+    0x42, 0x4B, 0x3B, 0xFB, 0x72, 0x49, 0xC2, 0x2F, 0x4A, 0xED, 0xCE, 0x8D, 0xF1, 0xB0, 0x4C, 0xFA,
+    0xBE, 0xEF, 0xCB, 0x5B, 0xAE, 0x04, 0x1B, 0x6D, 0xD6, 0x6E, 0x89, 0x4B, 0xE5, 0xD9, 0x66, 0xD1,
+    0x82, 0x7D, 0xF4, 0x7E, 0xE8, 0xB0, 0x3A, 0x20, 0xDB, 0x20, 0x36, 0xD1, 0xFA, 0x79, 0xF0, 0xCC,
+    0x9D, 0x6D, 0x0A, 0xDB, 0x30, 0x35, 0xEB, 0xD0, 0xD3, 0x0A, 0xFE, 0x5B, 0x08, 0xF1, 0xA2, 0xF6,
+    0xDB, 0x21, 0x76, 0xBB, 0x62, 0x9F, 0xB8, 0x1D, 0x96, 0xC0, 0xBD, 0xD1, 0x6D, 0x39, 0x48, 0xCF,
+    0x74, 0x8D, 0xFA, 0xC1, 0x05, 0xF1, 0x87, 0xEE, 0xEE, 0x55, 0xF9, 0x03, 0xF2, 0x68, 0x16, 0xAC,
+    0x1C, 0xDB, 0x85, 0x62, 0x20, 0x4B, 0x4A, 0xAD, 0x9C, 0x7E, 0xEB, 0x74, 0xD0, 0x9C, 0x17, 0x66,
+    0xF7, 0x98, 0x99, 0xA5, 0xA0, 0x85, 0xE9, 0x13, 0xE8, 0xBB, 0x96, 0xB7, 0xE9, 0xD6, 0x71, 0xAF,
+    0xC5, 0x1A, 0x6B, 0x4A, 0xB0, 0x38, 0x2B, 0xD3, 0xC8, 0xED, 0x7D, 0xBD, 0xB5, 0xE6, 0xB6, 0xB6,
+    0x36, 0x35, 0xD7, 0xB6, 0x4D, 0x46, 0xE4, 0x87, 0x93, 0xF3, 0x63, 0x2F, 0xF3, 0x35, 0x1B, 0xAF,
+    0x50, 0xD1, 0xE1, 0x3B, 0xD8, 0xEB, 0x3B, 0x5B, 0x8D, 0x8D, 0xB9, 0xD9, 0xF7, 0xDC, 0x24, 0x50,
+    0xA8, 0xD1, 0x5D, 0xF4, 0x89, 0x0B, 0x6A, 0xB0, 0x8D, 0xF7, 0x3E, 0x3D, 0x3A, 0xF9, 0x03, 0x79,
+    0x74, 0x76, 0x0F, 0xE2, 0xD1, 0xA1, 0x68, 0x9B, 0xF8, 0xE2, 0xFE, 0x3C, 0x8F, 0x8E, 0xDB, 0xA6,
+    0xF3, 0x26, 0xD7, 0xAA, 0xB1, 0xC5, 0x13, 0x4D, 0xDC, 0x69, 0x6C, 0xFA, 0xB9, 0x1F, 0xD2, 0xDC,
+    0xFE, 0x69, 0xCB, 0xC9, 0x84, 0xC9, 0x82, 0xD7, 0x89, 0x0B, 0xAB, 0xBB, 0x31, 0xD9, 0xB7, 0xC6,
+    0xA9, 0xBE, 0x8A, 0xF3, 0xB2, 0xA7, 0x79, 0x06, 0xCE, 0x9D, 0x6B, 0xA4, 0x45, 0x4B, 0x7D, 0x6E,
+    0x88, 0x9E, 0x18, 0xC4, 0x3F, 0x68, 0xEA, 0x75, 0xE4, 0x34, 0x1D, 0xF9, 0xA8, 0x7F, 0xD9, 0x23,
+    0xCF, 0x17, 0x17, 0xB9, 0x03, 0xA6, 0x98, 0xD8, 0xE2, 0x7C, 0x77, 0xC0, 0xDA, 0x05, 0xF5, 0x4B,
+    0xDA, 0x16, 0xFE, 0xC4, 0xC8, 0x41, 0x3E, 0xDE, 0xF1, 0x83, 0x49, 0x6F, 0xA1, 0x05, 0xB3, 0xC4,
+    0xD7, 0xA6, 0x4D, 0xF2, 0xD7, 0x20, 0xB1, 0x69, 0x98, 0x19, 0xED, 0x72, 0xAA, 0x63, 0x0D, 0x26,
+    0x00, 0xA4, 0xF1, 0x7D, 0xD1, 0x07, 0xB0, 0x36, 0xF4, 0x01, 0xAE, 0x63, 0x31, 0x19, 0xE8, 0xD3,
+    0xFC, 0x80, 0x5C, 0xE0, 0xF8, 0x9E, 0xDC, 0xE0, 0x11, 0x75, 0xA5, 0x6A, 0xA1, 0x0F, 0xC8, 0x1D,
+    0x8E, 0x5F, 0x9B, 0x9A, 0x18, 0x5C, 0x53, 0xDB, 0x05, 0x7D, 0x26, 0xE1, 0xD7, 0xEA, 0xFC, 0x8A,
+    0x4A, 0xDE, 0xE9, 0x4D, 0x77, 0xEB, 0x05, 0x33, 0x92, 0xDD, 0x68, 0x28, 0x6B, 0x12, 0xA7, 0xBB,
+    0x6C, 0xBC, 0xD3, 0x03, 0xF3, 0xA5, 0xE2, 0x28, 0x7C, 0xCC, 0xD6, 0x3C, 0x11, 0x18, 0xB9, 0x7C,
+    0x11, 0x6B, 0x17, 0xBC, 0x11, 0x9B, 0x91, 0x06, 0xB6, 0xBE, 0xCD, 0x49, 0x91, 0xB5, 0xF6, 0x6B,
+    0x32, 0x09, 0xFE, 0x9A, 0x83, 0xE5, 0xAF, 0x69, 0x83, 0x37, 0x1A, 0xF9, 0xDE, 0x7E, 0x8D, 0x3B,
+    0xFD, 0x7A, 0x21, 0xD5, 0xB8, 0xA8, 0x23, 0x1B, 0x6C, 0x09, 0xC5, 0xB1, 0xB2, 0x5F, 0xDB, 0xFC,
+    0x8C, 0x34, 0x18, 0xDD, 0x73, 0xDB, 0x65, 0x98, 0x40, 0x1B, 0x79, 0x98, 0xB6, 0x59, 0xE7, 0x41,
+    0x0D, 0x10, 0x64, 0xA4, 0xC6, 0x30, 0xD2, 0xA0, 0x1F, 0x69, 0x30, 0xDD, 0x75, 0x81, 0xBF, 0x66,
+    0xD3, 0xDD, 0x28, 0x74, 0xB3, 0xD1, 0xA4, 0xD6, 0x6A, 0x9B, 0x56, 0x1C, 0xBD, 0xF3, 0x37, 0xF0,
+    0x94, 0x8A, 0xCC, 0x43, 0x57, 0x59, 0xDD, 0x39, 0x95, 0xA4, 0x33, 0x1E, 0xA7, 0x79, 0xE8, 0x44,
+    0x57, 0x7E, 0xE1, 0x38, 0x74, 0xE2, 0xB5, 0xD2, 0x77, 0x6F, 0x72, 0x89, 0xAC, 0x48, 0x8D, 0x85,
+    0x3C, 0x4B, 0x94, 0x64, 0x9E, 0x10, 0x0C, 0x8B, 0xED, 0xE8, 0x84, 0x83, 0x1F, 0x2E, 0x71, 0xDB,
+    0x35, 0x03, 0x3D, 0x6B, 0x8E, 0x6A, 0x43, 0xF6, 0x3B, 0x7A, 0x6A, 0xFE, 0x6F, 0xF0, 0xAB, 0xD8,
+    0xC2, 0xD7, 0x96, 0x88, 0x07, 0xB3, 0xF8, 0x83, 0x3B, 0x48, 0x3B, 0x7A, 0x1D, 0x3C, 0x3A, 0x6B,
+    0x99, 0x4E, 0x51, 0x58, 0xF2, 0x51, 0x58, 0xF1, 0x51, 0x58, 0xF0, 0x1A, 0x47, 0x09, 0xDE, 0xC9,
+    0x45, 0x4E, 0x1F, 0xA4, 0x6E, 0xE8, 0x52, 0x94, 0xBF, 0x90, 0x6B, 0xFD, 0xAF, 0x9D, 0xB3, 0xA5,
+    0x9E, 0x38, 0x5B, 0xDF, 0x1B, 0xDA, 0x71, 0xF2, 0x71, 0xFA, 0x2F, 0xAE, 0xE9, 0xE0, 0x94, 0x55,
+    0x19, 0x3B, 0x32, 0x48, 0xF8, 0x0E, 0xAD, 0xA7, 0x45, 0xAF, 0x99, 0x7E, 0xC1, 0x75, 0x2B, 0x5B,
+    0xE2, 0xCD, 0xDA, 0x56, 0x38, 0x23, 0x60, 0x19, 0x66, 0xD8, 0x6E, 0x6E, 0x48, 0xFE, 0x3F, 0x88,
+    0xBB, 0x2F, 0x3B, 0xEB, 0x5F, 0x94, 0x5E, 0xA4, 0x78, 0x24, 0xC5, 0x08, 0x97, 0xC7, 0xC2, 0xCC,
+    0x81, 0xBF, 0x2E, 0x9D, 0x82, 0x6B, 0xD8, 0x2D, 0x6B, 0xB8, 0xF3, 0x74, 0xA3, 0x11, 0xD1, 0x47,
+    0xEB, 0x1E, 0xC8, 0x47, 0xFB, 0x4C, 0x34, 0xF9, 0x69, 0x20, 0x23, 0x0B, 0x4A, 0xCC, 0x31, 0xE2,
+    0x8E, 0xCD, 0x76, 0xAB, 0xF4, 0x63, 0xFE, 0x75, 0xF3, 0xD3, 0x2C, 0x8C, 0xBB, 0xD5, 0xC7, 0x6A,
+    0x1B, 0x59, 0x3C, 0xD4, 0x40, 0x29, 0x83, 0xF1, 0x78, 0x0D, 0x9E, 0xE9, 0x43, 0xEF, 0xCE, 0x5C,
+    0x2B, 0xF4, 0x3D, 0xFC, 0x0D, 0xFF, 0x60, 0x2F, 0xDE, 0x9F, 0xBE, 0xEE, 0xDF, 0x9E, 0x8D, 0x3D,
+    0xDC, 0x5A, 0xDE, 0xC1, 0xA3, 0x20, 0xE6, 0x61, 0x2C, 0x2D, 0x78, 0xF0, 0x37, 0xCE, 0xBC, 0x84,
+    0xB6, 0xD6, 0xC9, 0x89, 0x48, 0x2F, 0x3A, 0x02, 0x38, 0x1A, 0xF8, 0x02, 0xBC, 0xEA, 0x61, 0xEE,
+    0x80, 0x8E, 0xB6, 0x6A, 0xD6, 0x41, 0x0B, 0x4A, 0xC8, 0x38, 0x6C, 0xF7, 0x7A, 0xCA, 0xAF, 0xC5,
+    0x84, 0xFC, 0x06, 0xDB, 0x38, 0x7B, 0xEA, 0xBB, 0x4F, 0xD8, 0xDD, 0x14, 0x7F, 0x94, 0xEB, 0x7E,
+    0xE3, 0x38, 0x1B, 0x9D, 0xC5, 0x66, 0xC3, 0xDD, 0xD2, 0xFD, 0xA0, 0x90, 0x27, 0x00, 0xB2, 0xA5,
+    0xE3, 0xF6, 0x82, 0x7C, 0xE9, 0x42, 0x58, 0x16, 0x77, 0x45, 0x1B, 0xCC, 0x24, 0x6E, 0x10, 0x7C,
+    0x06, 0x7A, 0x3D, 0xFD, 0xEA, 0xF9, 0x46, 0x52, 0x39, 0x86, 0xC1, 0xB3, 0x0D, 0x31, 0x53, 0x71,
+    0x3D, 0x7B, 0x0D, 0x1F, 0xC1, 0x41, 0xCA, 0xC4, 0x1A, 0x02, 0x45, 0xAE, 0x98, 0x83, 0xE7, 0x11,
+    0x27, 0x17, 0x85, 0x93, 0x11, 0x4E, 0xF2, 0x97, 0xDC, 0x87, 0x0B, 0x18, 0x71, 0x50, 0x42, 0xF7,
+    0x0A, 0x61, 0x57, 0x96, 0x00, 0x21, 0x5A, 0x46, 0x36, 0x6C, 0x50, 0x63, 0x4D, 0x3F, 0x3F, 0xA6,
+    0x5D, 0x41, 0x87, 0xBB, 0x37, 0xBB, 0x28, 0x0A, 0xC1, 0xF2, 0x42, 0xE6, 0x97, 0xD8, 0x05, 0x1E,
+    0xDD, 0x50, 0xAD, 0xC4, 0x52, 0x58, 0xCB, 0x75, 0x19, 0xCB, 0x4D, 0xE2, 0xE7, 0x96, 0x2F, 0xEF,
+    0x16, 0x54, 0xCF, 0x6B, 0xE5, 0x5E, 0xEC, 0x44, 0x72, 0x86, 0xD1, 0x53, 0xC5, 0x38, 0x0A, 0x8B,
+    0xAD, 0x2E, 0xBE, 0x03, 0xBD, 0x3D, 0x71, 0x3F, 0xE2, 0x94, 0xFE, 0x83, 0xEC, 0x16, 0x10, 0xF3,
+    0xAE, 0x03, 0x4D, 0xB6, 0x9E, 0xB8, 0x09, 0xBD, 0x2C, 0x63, 0xD4, 0x20, 0x0D, 0x76, 0x10, 0x24,
+    0x5A, 0x6D, 0x57, 0x17, 0x9C, 0xAE, 0x74, 0x7F, 0x90, 0x95, 0x37, 0x78, 0x69, 0xD9, 0x27, 0x72,
+    0xFF, 0x59, 0xCC, 0x08, 0x3C, 0xBA, 0xF5, 0x57, 0xDF, 0x27, 0xBC, 0xFD, 0x53, 0x81, 0x92, 0x97,
+    0x22, 0xEA, 0x8B, 0xB4, 0x73, 0x9C, 0xC6, 0xAD, 0x70, 0x0B, 0xBC, 0x16, 0xEE, 0x4D, 0x0C, 0x1D,
+    0x4B, 0x92, 0xC3, 0x97, 0x94, 0x97, 0x15, 0xBD, 0x76, 0xF0, 0x09, 0xC4, 0x43, 0x46, 0x86, 0x11,
+    0x22, 0x1D, 0x0D, 0x3C, 0x58, 0xE0, 0x46, 0x9C, 0xF4, 0xAC, 0xE7, 0x95, 0x43, 0x28, 0x28, 0x9F,
+    0x8A, 0x33, 0xD6, 0x5C, 0x46, 0x9D, 0x2E, 0x6B, 0xA9, 0x59, 0xF5, 0x6B, 0x33, 0x00, 0x91, 0xA7,
+    0xE2, 0x38, 0x1B, 0xF4, 0x59, 0x49, 0x3F, 0x37, 0xF5, 0xFC, 0xFA, 0x1B, 0xD4, 0x74, 0x99, 0x34,
+    0xB3, 0xC7, 0x42, 0x81, 0xA7, 0x82, 0xDA, 0xB5, 0x57, 0xA9, 0xBD, 0x0A, 0xD3, 0x32, 0xBA, 0x92,
+    0xF5, 0xFF, 0xCE, 0xD5, 0xF4, 0x81, 0x96, 0x78, 0x12, 0x93, 0x88, 0xDC, 0xBB, 0x8F, 0xFB, 0x39,
+    0x43, 0xEC, 0x9E, 0xF1, 0x03, 0x5E, 0xF8, 0xE6, 0x0C, 0x6B, 0x85, 0x46, 0xE8, 0x8A, 0xAF, 0x2D,
+    0xE9, 0x40, 0xBA, 0xC6, 0xA0, 0xE7, 0xB3, 0x9C, 0x76, 0x12, 0xA6, 0x52, 0x32, 0xC5, 0x67, 0xBF,
+    0xE4, 0x7B, 0xFC, 0xC9, 0x79, 0xDA, 0xC7, 0x5E, 0x8E, 0x9F, 0x47, 0x15, 0xC0, 0xE9, 0x65, 0xA2,
+    0xC4, 0x78, 0x52, 0x82, 0x9E, 0xCF, 0x0C, 0xAD, 0x2E, 0xFA, 0x1D, 0x4F, 0xA2, 0xDB, 0x98, 0x61,
+    0x87, 0x85, 0x70, 0xF8, 0xB6, 0x4B, 0xA7, 0x37, 0xF0, 0xBF, 0xBD, 0x89, 0xB5, 0x0C, 0x8F, 0x49,
+    0x41, 0xDB, 0x87, 0x64, 0xD1, 0xF0, 0x41, 0xE4, 0xAA, 0x64, 0xB0, 0xC8, 0x0C, 0x19, 0x36, 0x48,
+    0x19, 0x78, 0xC5, 0xAD, 0x60, 0x13, 0xD0, 0x10, 0xF1, 0xAF, 0x74, 0x0E, 0xA4, 0x1F, 0xA0, 0x1D,
+    0x0C, 0x9E, 0xCC, 0x49, 0x0F, 0xCB, 0xAB, 0xC3, 0x82, 0xE9, 0x48, 0x6C, 0x07, 0xB3, 0x82, 0x46,
+    0x34, 0x35, 0xFC, 0xA2, 0xDB, 0x78, 0x25, 0xD1, 0x29, 0x78, 0xC4, 0x5E, 0x21, 0x97, 0x08, 0x5C,
+    0x46, 0x9C, 0xC8, 0x28, 0xCE, 0xB4, 0x2C, 0x9A, 0xDA, 0x5E, 0x48, 0xEE, 0x1D, 0xFC, 0xE6, 0x19,
+    0x74, 0xCE, 0xA2, 0xA6, 0x67, 0x23, 0xF3, 0xA6, 0xDB, 0x3E, 0x50, 0xDC, 0x69, 0xAF, 0x94, 0x88,
+    0x3C, 0xB9, 0x31, 0xF9, 0x87, 0xD6, 0x82, 0x5F, 0xD8, 0xFF, 0x59, 0xFC, 0x2E, 0xBC, 0x0D, 0x7A,
+    0x0B, 0xFD, 0xDC, 0x78, 0x5B, 0x79, 0x23, 0xBA, 0x74, 0xE2, 0xE9, 0x7E, 0x23, 0xC2, 0x3E, 0x18,
+    0x98, 0x42, 0xE5, 0x68, 0x39, 0x95, 0xBC, 0xAB, 0x62, 0x6F, 0x29, 0xFA, 0xBE, 0xBC, 0x00, 0x1D,
+    0x77, 0xED, 0xEE, 0x92, 0x55, 0xA7, 0xAD, 0x38, 0x2C, 0x1C, 0xFB, 0x92, 0x37, 0x65, 0x9D, 0xD5,
+    0x92, 0x33, 0x65, 0x5D, 0xD4, 0xA6, 0xB6, 0x8E, 0x81, 0x82, 0x52, 0x2E, 0x93, 0x90, 0x15, 0xB2,
+    0x3B, 0xB8, 0x5B, 0xBA, 0x17, 0xFD, 0x32, 0xD1, 0x52, 0xFF, 0xBA, 0x27, 0xE6, 0x9E, 0x0C, 0xDC,
+    0x2F, 0x7B, 0x85, 0xA0, 0x06, 0xCF, 0x49, 0x30, 0x1B, 0x09, 0x64, 0x23, 0x2D, 0xC8, 0xCC, 0x41,
+    0x0D, 0xCF, 0x78, 0x07, 0x53, 0x0F, 0x7E, 0xBF, 0xB2, 0x97, 0xC5, 0x51, 0x07, 0x5E, 0x85, 0xBC,
+    0xD0, 0x47, 0x86, 0x1B, 0xD1, 0xCA, 0x16, 0x08, 0xD4, 0x2A, 0x2C, 0xA9, 0x3B, 0x5F, 0x0E, 0x91,
+    0xAC, 0xC8, 0xFC, 0x96, 0xBB, 0xE8, 0xCA, 0x75, 0xCE, 0x3E, 0x45, 0xD3, 0xDE, 0x8C, 0x55, 0xFF,
+    0xBB, 0x10, 0x2C, 0x30, 0xEB, 0x3B, 0xFF, 0x0F, 0x8C, 0x5A, 0x80, 0xD8, 0x05, 0x88, 0x58, 0xD0,
+    0x71, 0x42, 0xE9, 0x70, 0x42, 0xB7, 0x40, 0xBE, 0x38, 0xC9, 0x97, 0x21, 0x70, 0x38, 0x93, 0x9C,
+    0x39, 0xF5, 0x4F, 0x63, 0x83, 0x31, 0xDD, 0xAE, 0x31, 0xBB, 0x9B, 0x30, 0xFE, 0x95, 0x76, 0x96,
+    0x55, 0xA4, 0x8C, 0x22, 0xDB, 0xB0, 0xAD, 0xF4, 0xEB, 0x05, 0xAF, 0x2B, 0xAA, 0x1E, 0x89, 0x82,
+    0x8B, 0xDE, 0x46, 0xF6, 0x06, 0x5D, 0x01, 0x46, 0xD7, 0x96, 0xE4, 0x7A, 0xE5, 0x36, 0x70, 0x98,
+    0x8D, 0xDF, 0x5E, 0xB8, 0x2E, 0x71, 0xED, 0xD6, 0x7D, 0x64, 0xF3, 0xBD, 0x0C, 0xF1, 0x3C, 0x1A,
+    0xDE, 0x93, 0xBB, 0xFE, 0xC3, 0xD0, 0xE7, 0x2B, 0x57, 0xA3, 0x93, 0xAB, 0x7E, 0x55, 0xE3, 0x6B,
+    0x8A, 0x04, 0x79, 0xA3, 0x0A, 0xFE, 0xFE, 0x5D, 0x46, 0x43, 0xB0, 0x84, 0x86, 0xF5, 0x22, 0x83,
+    0x6A, 0x2F, 0x93, 0xCB, 0xDF, 0x66, 0xCC, 0xDA, 0x69, 0x70, 0x6D, 0x70, 0x6A, 0x6D, 0x5C, 0x49,
+    0xF9, 0x98, 0x0C, 0xC1, 0x9F, 0x91, 0x74, 0x1B, 0x6A, 0x7B, 0xB2, 0x1B, 0x97, 0x8C, 0x2A, 0x2E,
+    0x2C, 0xE4, 0x40, 0x36, 0x4E, 0x4B, 0xEB, 0xE4, 0xE4, 0xE4, 0x9A, 0x09, 0x40, 0x99, 0x60, 0xAB,
+    0xD1, 0xA1, 0x45, 0xAF, 0x9B, 0xFF, 0x34, 0xDC, 0x09, 0xF4, 0xB8, 0xC2, 0x46, 0xED, 0xCC, 0xE5,
+    0x89, 0xC7, 0x35, 0x74, 0xBA, 0x52, 0xF8, 0x14, 0x4A, 0x4D, 0x1D, 0xF3, 0x7D, 0x72, 0xE6, 0xFB,
+    0x44, 0xDF, 0x64, 0xCC, 0xD8, 0x51, 0xE6, 0x39, 0x92, 0x91, 0xA9, 0xA9, 0xF6, 0x8C, 0x87, 0x4C,
+    0xBC, 0x9E, 0xE8, 0xBF, 0x02, 0xA3, 0x66, 0x22, 0x26, 0x7C, 0x6B, 0x74, 0x6A, 0xAF, 0xAC, 0x5D,
+    0xCB, 0x5B, 0xBB, 0x8D, 0x15, 0x4A, 0xF7, 0x2A, 0x31, 0xBA, 0x5B, 0x56, 0xD9, 0x6D, 0x74, 0xB8,
+    0xA8, 0x8A, 0x1F, 0xAA, 0x75, 0xDF, 0xF2, 0xB6, 0xF5, 0x90, 0xBD, 0xE8, 0x52, 0xDF, 0xED, 0x3E,
+    0x7B, 0x79, 0xF0, 0x32, 0xCB, 0xB7, 0xAF, 0x74, 0x19, 0xBA, 0x9E, 0xBD, 0xDA, 0x16, 0x7B, 0xB4,
+    0xB7, 0x6B, 0x6F, 0xB0, 0x27, 0x6D, 0xE6, 0xA5, 0x87, 0x9F, 0x99, 0xC6, 0xEF, 0x23, 0x0E, 0x24,
+    0xF3, 0xC2, 0x55, 0x2D, 0x23, 0x8E, 0x75, 0xDA, 0xC3, 0xA5, 0x51, 0xEC, 0x41, 0xC3, 0xD9, 0x4C,
+    0xC9, 0xCC, 0x93, 0x51, 0x13, 0xB2, 0x9C, 0x2A, 0x26, 0x67, 0x6D, 0x19, 0x29, 0x87, 0xDD, 0xC2,
+    0x55, 0x74, 0xEB, 0xA6, 0x33, 0x2D, 0x43, 0xF9, 0x75, 0x4A, 0x52, 0xF0, 0xD6, 0x4B, 0x49, 0xE3,
+    0x4A, 0x86, 0x95, 0xCC, 0x49, 0x99, 0x92, 0x32, 0xA6, 0x64, 0x42, 0xCA, 0x7C, 0x94, 0xD9, 0x44,
+    0xF6, 0xF0, 0xCF, 0xEF, 0xC8, 0xD7, 0x51, 0x31, 0x50, 0x47, 0xEF, 0x3F, 0xD6, 0xB6, 0x1B, 0x4A,
+    0xEC, 0xF0, 0x1D, 0x55, 0x34, 0x4F, 0xA0, 0xB0, 0x68, 0x9D, 0x18, 0x36, 0xAE, 0x29, 0xAD, 0x3A,
+    0x06, 0x4C, 0xB8, 0x74, 0xF9, 0xEA, 0x34, 0xC8, 0x7A, 0xBF, 0x9E, 0x4B, 0xA8, 0x4B, 0x4B, 0xD3,
+    0x2C, 0x2B, 0xF6, 0x39, 0x07, 0x9D, 0xE9, 0xBC, 0x13, 0xBF, 0xBA, 0x26, 0x45, 0x28, 0xF5, 0x22,
+    0xA3, 0x78, 0x89, 0x3C, 0xF4, 0x55, 0xE6, 0x56, 0xDC, 0xD4, 0x0C, 0xDD, 0xC4, 0x8C, 0xC3, 0x9B,
+    0xB6, 0x00, 0xBB, 0xCE, 0x95, 0xCB, 0x26, 0x3D, 0x48, 0x7B, 0x2A, 0x64, 0x39, 0x98, 0x19, 0x17,
+    0xF7, 0x96, 0x5F, 0x68, 0x7B, 0x6A, 0xEC, 0x0F, 0x77, 0x93, 0xA5, 0x2B, 0xD4, 0xA6, 0x7E, 0x14,
+    0x8A, 0xB9, 0x2C, 0xAE, 0x2D, 0x3D, 0x09, 0x56, 0x1D, 0xC2, 0x1F, 0xEB, 0x2E, 0x28, 0xC5, 0xE8,
+    0xFA, 0x5D, 0xBA, 0x11, 0xA0, 0xC4, 0x28, 0x62, 0xA4, 0x2D, 0x3A, 0x3E, 0xD1, 0x5C, 0x5C, 0x9D,
+    0x99, 0xE9, 0x25, 0x97, 0xBE, 0x02, 0x39, 0xF2, 0x3D, 0x41, 0xA8, 0x7B, 0x51, 0x03, 0x25, 0x46,
+    0x71, 0xA3, 0x95, 0x45, 0x04, 0xA0, 0x38, 0xAF, 0x1C, 0xB4, 0x6A, 0x3F, 0x84, 0x6B, 0x17, 0xDB,
+    0x1B, 0x17, 0xE5, 0x33, 0x78, 0x69, 0x76, 0x87, 0xFB, 0x94, 0x92, 0x15, 0x6E, 0x5C, 0xAC, 0x94,
+    0xE1, 0xA6, 0xA7, 0xCB, 0x7E, 0x41, 0x67, 0xE5, 0x7B, 0xF8, 0x4A, 0xC7, 0xAC, 0x52, 0x0A, 0x73,
+    0xDA, 0x93, 0x89, 0xCB, 0xBF, 0x8A, 0x49, 0xEA, 0xC4, 0xD8, 0x96, 0x5C, 0x01, 0xC5, 0x28, 0xD1,
+    0xAF, 0xE4, 0xD7, 0x6F, 0x44, 0xD7, 0xB7, 0x98, 0xA1, 0x76, 0x0D, 0x81, 0xF8, 0x2A, 0xC6, 0xD4,
+    0x71, 0x96, 0x0A, 0x3F, 0x20, 0xCC, 0x93, 0x2B, 0x07, 0x3F, 0x53, 0x1B, 0xD7, 0xC4, 0xBE, 0xF5,
+    0x92, 0x64, 0x8F, 0x99, 0xDF, 0xAD, 0x91, 0xD6, 0xC1, 0x75, 0x9B, 0xA3, 0xDD, 0x72, 0x8A, 0xA4,
+    0xAB, 0x82, 0x8F, 0x28, 0x05, 0x74, 0xE3, 0xC4, 0xF6, 0x34, 0x73, 0xBE, 0xED, 0x45, 0x5A, 0xF1,
+    0x42, 0x0A, 0x66, 0x4E, 0x98, 0xE6, 0x0E, 0xDA, 0x8E, 0x16, 0x2F, 0x7F, 0xE9, 0x37, 0x08, 0x7F,
+    0x89, 0x7D, 0x73, 0xC5, 0xB3, 0x9C, 0x13, 0x5A, 0xA2, 0x62, 0x51, 0xCA, 0x0F, 0x56, 0x04, 0xCE,
+    0x52, 0x4C, 0x63, 0xC5, 0x2D, 0xC4, 0x2B, 0x7C, 0x43, 0x2B, 0x67, 0x33, 0x50, 0x1D, 0xDC, 0x0C,
+    0x9C, 0x87, 0xF5, 0x10, 0xCB, 0xFF, 0x66, 0xA9, 0x0E, 0x99, 0xD2, 0x88, 0x32, 0xB9, 0x6D, 0xCB,
+    0xDD, 0xE4, 0xB6, 0x5D, 0x5A, 0x4E, 0x59, 0x70, 0x00, 0xCA, 0x0D, 0xE0, 0xE4, 0x03, 0x90, 0x8C,
+    0x36, 0xFF, 0x92, 0x25, 0xE5, 0xC9, 0x01, 0xC9, 0x90, 0x67, 0x14, 0x3D, 0xE6, 0x2C, 0xF9, 0xBA,
+    0x3D, 0xEB, 0xC4, 0x9D, 0xFC, 0x08, 0x97, 0x9F, 0x3B, 0xC7, 0x7F, 0x96, 0x8C, 0xFE, 0xB3, 0xD9,
+    0x9A, 0xC8, 0xEA, 0x99, 0xBB, 0xE1, 0x32, 0x55, 0xCE, 0x65, 0xF0, 0xB0, 0x6B, 0x4B, 0x93, 0x67,
+    0x28, 0xE1, 0xC3, 0xEF, 0x9A, 0x97, 0xDC, 0x53, 0xD0, 0x17, 0x91, 0xB4, 0x50, 0x91, 0x15, 0x79,
+    0x8A, 0xB6, 0x68, 0xF6, 0x85, 0x37, 0xAD, 0xA8, 0x5A, 0x6E, 0x60, 0x0F, 0x94, 0x35, 0xA8, 0x85,
+    0x06, 0xDE, 0xED, 0xB2, 0x4E, 0xC0, 0xFA, 0xD1, 0x78, 0x22, 0x17, 0x6D, 0xDA, 0x26, 0xF0, 0xBE,
+    0x65, 0xEF, 0x9A, 0xCD, 0xEA, 0x1A, 0x79, 0x92, 0x77, 0x66, 0xFD, 0xF2, 0xED, 0xBB, 0x89, 0x12,
+    0xE6, 0x7C, 0x5E, 0xDC, 0x3F, 0xD7, 0xCB, 0x1A, 0x55, 0xAA, 0x40, 0x9D, 0xF2, 0xFF, 0x9A, 0xAB,
+    0x0F, 0x0D, 0xEC, 0x36, 0x0B, 0xEB, 0xAE, 0xDC, 0x37, 0xE4, 0xDE, 0xFF, 0x2E, 0x1F, 0xE0, 0x7E,
+    0x38, 0x48, 0x15, 0x9A, 0x7B, 0xC7, 0x33, 0xBD, 0x30, 0xD5, 0x2B, 0x8A, 0xE0, 0x6F, 0xAF, 0x46,
+    0xE6, 0x17, 0xFC, 0xBF, 0x69, 0xA7, 0x3C, 0xEF, 0x26, 0x93, 0x95, 0xA4, 0xEC, 0x2D, 0x9A, 0x55,
+    0x31, 0x0D, 0x75, 0xD9, 0xE8, 0x3F, 0x6F, 0x31, 0x5F, 0x53, 0xCC, 0xBF, 0x6B, 0x39, 0x72, 0x10,
+    0xF3, 0x60, 0xBE, 0x5E, 0xB6, 0x18, 0x53, 0xF6, 0x62, 0x7E, 0xD3, 0x4F, 0x2B, 0x23, 0x9E, 0xF3,
+    0x8B, 0xB0, 0x78, 0x2E, 0x5D, 0xF3, 0xFF, 0xF2, 0xB5, 0x89, 0xB9, 0xE8, 0xB3, 0x96, 0x6C, 0x90,
+    0x3B, 0x89, 0x02, 0x9B, 0x66, 0x17, 0xA4, 0xAC, 0x37, 0x3E, 0xBC, 0x29, 0x5B, 0xB8, 0x52, 0x4A,
+    0x74, 0x85, 0x35, 0xE3, 0xB7, 0xEB, 0xEB, 0x5E, 0x68, 0x9E, 0x1E, 0x07, 0x4A, 0x0E, 0x93, 0xD9,
+    0x71, 0x21, 0x29, 0x16, 0x27, 0xCA, 0x59, 0xCA, 0xE5, 0x27, 0x5D, 0x3B, 0xB3, 0xAB, 0xB5, 0xCF,
+    0xF5, 0xFB, 0x84, 0x86, 0xA3, 0x76, 0x7A, 0xD8, 0xFF, 0x51, 0xD8, 0xF8, 0x51, 0xD8, 0xF9, 0x51,
+    0xD8, 0xFA, 0x76, 0x43, 0xCD, 0x9F, 0x72, 0xAB, 0xB6, 0xFF, 0x0D, 0x0A, 0x07, 0xF5, 0x8F, 0x66,
+    0xE9, 0x6A, 0xA5, 0x35, 0xAD, 0x11, 0x60, 0xA8, 0x48, 0xBA, 0xA6, 0x90, 0xF1, 0x51, 0xBA, 0x81,
+    0x76, 0x6B, 0x9F, 0xB9, 0x4E, 0x06, 0x64, 0xEA, 0xDE, 0xA6, 0xAE, 0xB3, 0xDB, 0xB8, 0xAF, 0x99,
+    0x19, 0x79, 0x6D, 0xD2, 0xDB, 0x3E, 0x74, 0xA3, 0x78, 0x53, 0xA3, 0x90, 0x37, 0x92, 0xA3, 0xE8,
+    0x35, 0x8A, 0xBA, 0xEC, 0x34, 0x8A, 0x2D, 0x18, 0x1C, 0x47, 0x91, 0x04, 0x4F, 0xE4, 0xB8, 0x06,
+    0x46, 0x3F, 0x64, 0x56, 0x9F, 0xF1, 0x47, 0x42, 0x3F, 0xB2, 0xB0, 0x1B, 0xAF, 0x03, 0x77, 0x06,
+    0x26, 0xF6, 0xC9, 0xF2, 0xAC, 0xE4, 0x69, 0x4F, 0xA2, 0x43, 0x8F, 0x93, 0xD5, 0xB4, 0xDC, 0xBD,
+    0x6E, 0xCA, 0x59, 0xA5, 0xCC, 0xB5, 0xF1, 0x4A, 0xA5, 0x8D, 0x79, 0x53, 0xEE, 0x6E, 0x29, 0x9F,
+    0x4F, 0x17, 0xC9, 0x14, 0x84, 0x9C, 0x19, 0x2B, 0x43, 0xA0, 0xE7, 0x8B, 0xEA, 0x51, 0x70, 0xCF,
+    0x06, 0xE7, 0x6C, 0x70, 0xCD, 0x06, 0x7F, 0x7A, 0xF0, 0xA6, 0xCB, 0xE5, 0x72, 0x45, 0xAE, 0x76,
+    0x3A, 0xCA, 0xC4, 0x7D, 0x72, 0xA8, 0x3D, 0x58, 0xBE, 0x50, 0x7C, 0x86, 0x17, 0x28, 0x1B, 0xA8,
+    0x9E, 0x9A, 0xF2, 0xC3, 0x16, 0xEA, 0x8F, 0x51, 0x7E, 0x47, 0xF5, 0x95, 0xB6, 0x92, 0x1F, 0xFF,
+    0x4D, 0x6F, 0x29, 0xC9, 0x74, 0x57, 0x9D, 0x00, 0xB2, 0x09, 0xB6, 0xE0, 0x63, 0x37, 0x56, 0x93,
+    0x1D, 0xA9, 0xFE, 0xDE, 0x2F, 0x94, 0x78, 0x25, 0x97, 0x71, 0xCC, 0x14, 0x34, 0x16, 0x0F, 0xA4,
+    0xC3, 0x37, 0x5D, 0xCD, 0x5D, 0x1E, 0x76, 0x1F, 0x2F, 0x5E, 0xAC, 0x75, 0xBE, 0x7F, 0x34, 0xDE,
+    0x13, 0x31, 0x66, 0x29, 0xA3, 0xC1, 0x94, 0x7C, 0xF4, 0x0E, 0x39, 0xD4, 0x4E, 0x6E, 0x04, 0x89,
+    0xE6, 0x3B, 0xE5, 0x10, 0xFC, 0x71, 0xA3, 0x2D, 0x75, 0xE5, 0xCB, 0x2A, 0x36, 0xB2, 0x0B, 0xE7,
+    0xE6, 0xF4, 0xE6, 0x18, 0xD8, 0xA4, 0x16, 0xE0, 0x79, 0xD9, 0xEF, 0x2D, 0xE8, 0xD9, 0x50, 0x04,
+    0xB8, 0xD2, 0xD4, 0xA7, 0x14, 0x16, 0x27, 0x66, 0x36, 0x5C, 0xA6, 0x67, 0x11, 0x35, 0x17, 0x2C,
+    0xC6, 0x59, 0x49, 0x76, 0xD4, 0x2A, 0x2D, 0xF2, 0x56, 0x2A, 0x94, 0x32, 0xC8, 0x8A, 0x4E, 0xF1,
+    0x06, 0x56, 0x8F, 0x2D, 0xE5, 0x92, 0xF0, 0x53, 0xFE, 0x96, 0x4D, 0xBD, 0xB3, 0x1A, 0x0C, 0x9A,
+    0x88, 0x15, 0x44, 0xC2, 0x96, 0x9B, 0xE8, 0x05, 0xB2, 0x49, 0x28, 0x03, 0xF0, 0x62, 0x21, 0x89,
+    0x03, 0x3C, 0x95, 0x32, 0x85, 0xAC, 0x11, 0xF2, 0x9C, 0xFA, 0x23, 0x45, 0x09, 0x8B, 0x40, 0x34,
+    0x57, 0xB4, 0x09, 0x99, 0x6C, 0xDC, 0xCE, 0xD3, 0xD6, 0x17, 0x27, 0x5E, 0x79, 0xC6, 0x90, 0x83,
+    0x47, 0x33, 0x31, 0x87, 0xE4, 0x29, 0x12, 0x9F, 0xDA, 0xC5, 0x64, 0x44, 0xD4, 0x2A, 0x8C, 0x60,
+    0xC4, 0xAC, 0xFF, 0xB2, 0xF9, 0x81, 0x15, 0x6F, 0x24, 0x85, 0x07, 0xA5, 0xDE, 0x41, 0x25, 0x62,
+    0x8E, 0x4C, 0xAB, 0x70, 0x8C, 0x02, 0xFF, 0xD8, 0xD6, 0x6E, 0xCB, 0x6E, 0xD0, 0xC6, 0x91, 0x1A,
+    0xB1, 0x3C, 0x1D, 0xB3, 0x97, 0xA9, 0x17, 0x70, 0x8F, 0xC5, 0xB8, 0xAC, 0xD9, 0xC9, 0xD1, 0x05,
+    0xFA, 0x0B, 0x75, 0x3E, 0x28, 0x5A, 0xD9, 0x24, 0x3B, 0x6F, 0xAC, 0xCA, 0x40, 0xE1, 0x65, 0x1F,
+    0xAD, 0xEB, 0x64, 0x3B, 0x77, 0xC9, 0xFE, 0x42, 0x7B, 0xB5, 0x3C, 0x3D, 0xF2, 0xAC, 0x2F, 0x6F,
+    0xBA, 0xD3, 0x9C, 0xEA, 0x48, 0xC5, 0xA9, 0xDB, 0x5A, 0xE2, 0xF1, 0x51, 0xE6, 0xEE, 0x63, 0xF0,
+    0x26, 0xFD, 0x98, 0xF9, 0x88, 0x6F, 0xD1, 0x34, 0x18, 0x33, 0x6D, 0x22, 0x2A, 0x9C, 0x39, 0xD9,
+    0x66, 0xBE, 0x0A, 0xA6, 0xC1, 0xE8, 0x56, 0x9F, 0x9B, 0x06, 0x26, 0x81, 0x87, 0x0B, 0x25, 0xB0,
+    0xF2, 0xB1, 0x8A, 0xD1, 0x28, 0x38, 0x27, 0x43, 0x98, 0xBB, 0xDD, 0x77, 0x9A, 0x21, 0x41, 0x6D,
+    0x3D, 0xE9, 0x89, 0xED, 0xA4, 0xC8, 0x44, 0x8F, 0xA1, 0x48, 0x87, 0x16, 0x30, 0xBE, 0x4F, 0xB6,
+    0x40, 0x31, 0x9D, 0xD4, 0xF3, 0xAA, 0xDA, 0x5F, 0xAC, 0x43, 0x6E, 0x71, 0xF3, 0x0D, 0x4B, 0xC8,
+    0x2C, 0x2C, 0xBF, 0x04, 0x0E, 0xDA, 0x12, 0x0B, 0xFA, 0x21, 0x3A, 0xD5, 0xE7, 0xF9, 0x13, 0xD6,
+    0x1F, 0x5E, 0xB6, 0xC8, 0x71, 0xCF, 0xCD, 0xAB, 0x33, 0x4E, 0x76, 0xD1, 0x2F, 0x6A, 0x71, 0x90,
+    0xD4, 0x8C, 0x25, 0x26, 0x88, 0x6D, 0x6D, 0x9E, 0x2F, 0xC3, 0xD5, 0x5A, 0x58, 0x1A, 0x14, 0x2D,
+    0x1E, 0xFF, 0x91, 0xFF, 0xF6, 0x1D, 0x70, 0xA1, 0x4F, 0x88, 0x15, 0x6D, 0xC4, 0xE0, 0x1B, 0xEE,
+    0x3A, 0x46, 0xBC, 0x76, 0x56, 0x7D, 0x28, 0x5A, 0x96, 0xF3, 0x81, 0x35, 0x70, 0x1A, 0x92, 0x17,
+    0x70, 0x5F, 0x73, 0x9D, 0x5C, 0x67, 0x2A, 0xF8, 0x49, 0xC8, 0x76, 0xD8, 0xF4, 0xE2, 0x71, 0x50,
+    0xAB, 0xA1, 0x96, 0xAC, 0x9B, 0x99, 0x80, 0xBB, 0x2A, 0x81, 0xC7, 0xA2, 0xC2, 0x7A, 0x2C, 0x2A,
+    0xC4, 0x8C, 0x2E, 0xC7, 0xA2, 0xC2, 0xED, 0x58, 0x54, 0xB8, 0x79, 0x8F, 0xFA, 0x44, 0x2C, 0x48,
+    0xCA, 0xCE, 0x4F, 0x2D, 0x3C, 0x8F, 0x8D, 0x77, 0x91, 0xBB, 0xEE, 0xFB, 0x93, 0xE1, 0xBF, 0x2A,
+    0xFA, 0x76, 0x92, 0x9F, 0xFF, 0xCE, 0xF7, 0x2A, 0x64, 0x8C, 0x0E, 0x0A, 0x19, 0x0F, 0xDE, 0xD9,
+    0x1E, 0xD6, 0x44, 0x06, 0x76, 0x47, 0x2E, 0x83, 0x71, 0x2C, 0xC6, 0xCC, 0x96, 0xA8, 0x38, 0xC8,
+    0x13, 0x65, 0x56, 0xC4, 0x79, 0x49, 0x2D, 0xC9, 0x45, 0xD5, 0x87, 0x53, 0xCA, 0x4C, 0xF9, 0xD3,
+    0xA7, 0xCC, 0xC0, 0xA9, 0xF4, 0x2F, 0x19, 0xED, 0x50, 0xE1, 0x31, 0x52, 0xC4, 0xB8, 0x48, 0xEF,
+    0x48, 0x64, 0xC2, 0x1D, 0xA4, 0x04, 0xA4, 0xD6, 0xEC, 0x92, 0xC6, 0xB2, 0x27, 0xEB, 0x59, 0xEB,
+    0x9F, 0x5C, 0xEE, 0xA5, 0xF3, 0xCB, 0x61, 0xE9, 0x0D, 0x8F, 0xEF, 0x5D, 0x83, 0x76, 0xBB, 0xB0,
+    0xFC, 0x7E, 0x7D, 0x33, 0x6D, 0x57, 0x34, 0x69, 0xA0, 0x28, 0xFF, 0x7D, 0xD9, 0x7B, 0x6A, 0xAF,
+    0x68, 0x53, 0x96, 0x7B, 0xA9, 0x65, 0x30, 0x3C, 0x23, 0x18, 0xA2, 0x15, 0x65, 0xCC, 0xE3, 0x34,
+    0x40, 0xB3, 0x8E, 0xEB, 0xF1, 0xEF, 0x5C, 0x6B, 0xF9, 0x55, 0xB5, 0x19, 0x45, 0x74, 0x8E, 0x26,
+    0x7E, 0x4D, 0x91, 0xC4, 0x27, 0xE6, 0x92, 0x61, 0x3E, 0x73, 0x6D, 0xCC, 0xBD, 0x56, 0x34, 0x4C,
+    0x71, 0x18, 0xB5, 0xE4, 0xFC, 0x3B, 0xCB, 0xDC, 0xAD, 0x36, 0x4A, 0x06, 0xAD, 0xE2, 0x31, 0x29,
+    0xD4, 0x8D, 0xB9, 0xF5, 0x91, 0xE5, 0xD6, 0x57, 0x96, 0x5B, 0xBF, 0x87, 0x11, 0xE3, 0x25, 0x13,
+    0x78, 0x2C, 0x15, 0x02, 0xB8, 0x6B, 0xA0, 0x06, 0xCA, 0x61, 0xE3, 0x45, 0x6C, 0xA7, 0x1C, 0x58,
+    0x30, 0x28, 0x2F, 0x6D, 0x25, 0x7C, 0x14, 0x0C, 0x25, 0x57, 0x65, 0x95, 0xAC, 0x25, 0xF3, 0x70,
+    0x87, 0xFF, 0xEC, 0xBC, 0xB5, 0x7C, 0xBF, 0xBC, 0xF5, 0x7D, 0x58, 0x37, 0x67, 0x79, 0xEB, 0xF2,
+    0x54, 0x19, 0x32, 0xF9, 0x18, 0xD6, 0x96, 0x76, 0x6A, 0x56, 0x75, 0x74, 0x58, 0x36, 0xFE, 0x4B,
+    0x76, 0x65, 0x22, 0x9C, 0x11, 0x76, 0x61, 0xDA, 0x4C, 0xD5, 0x82, 0x2B, 0x2A, 0xC7, 0x8B, 0xE1,
+    0xA8, 0xB7, 0x1F, 0x06, 0xE7, 0x6F, 0x94, 0xED, 0x58, 0xEA, 0x97, 0xED, 0xAC, 0xCE, 0x89, 0xFD,
+    0x4E, 0x9C, 0x45, 0x01, 0x8C, 0xCC, 0x72, 0x29, 0xCC, 0xEA, 0x57, 0x3F, 0x86, 0x0E, 0x94, 0x0F,
+    0xC5, 0x6C, 0xFC, 0x39, 0xFB, 0xDC, 0x4C, 0xEB, 0x5C, 0x57, 0x8B, 0xE7, 0x70, 0x7C, 0x4F, 0xA2,
+    0xD7, 0x8F, 0x3D, 0x87, 0x0E, 0x2C, 0x4E, 0xB7, 0x99, 0x25, 0xF9, 0x57, 0xF2, 0xE2, 0xFA, 0x3E,
+    0xAB, 0x98, 0x47, 0x49, 0x4F, 0x9C, 0x1E, 0xE6, 0x94, 0x76, 0x96, 0xA3, 0xAB, 0xCF, 0x97, 0x21,
+    0x81, 0x06, 0x3E, 0x48, 0x26, 0x53, 0xD0, 0x07, 0x19, 0x4C, 0x4C, 0xCB, 0x38, 0x5D, 0x39, 0x73,
+    0xFF, 0x6E, 0x5C, 0xA3, 0xC4, 0xA1, 0xD8, 0x82, 0xAD, 0x75, 0xAA, 0xFC, 0x08, 0x6F, 0x92, 0x38,
+    0x56, 0x96, 0x14, 0xDE, 0xFA, 0x64, 0xB1, 0x49, 0xD1, 0xB8, 0x9B, 0x2D, 0xE5, 0xE0, 0x1D, 0x97,
+    0x76, 0x10, 0x18, 0xD9, 0xBD, 0x21, 0xE9, 0xC4, 0xE5, 0xFB, 0xC4, 0x04, 0x78, 0xA7, 0xA2, 0x8F,
+    0x04, 0x5F, 0x96, 0x74, 0xF0, 0xEF, 0x60, 0x9C, 0x0F, 0xE5, 0x45, 0x8A, 0xFC, 0x57, 0x2B, 0x63,
+    0xF4, 0x5B, 0xCD, 0xA8, 0xF6, 0xF6, 0xC9, 0x55, 0xF2, 0x3D, 0xEC, 0x68, 0xF3, 0xE5, 0xD1, 0x1D,
+    0xBE, 0xB4, 0xD6, 0xCF, 0x16, 0x39, 0xF1, 0xDA, 0x89, 0x23, 0x33, 0x72, 0xB0, 0x62, 0x4D, 0x12,
+    0x72, 0xC7, 0x90, 0x20, 0x56, 0xC0, 0x62, 0x26, 0x97, 0x49, 0xF9, 0x25, 0x78, 0xDB, 0x2B, 0x56,
+    0x40, 0x38, 0xF7, 0x3D, 0x6C, 0xEF, 0x77, 0x5D, 0xF9, 0x7D, 0x98, 0x3A, 0x3F, 0x19, 0x8A, 0xB7,
+    0x06, 0xF6, 0x36, 0xC3, 0x72, 0xF3, 0x9D, 0xA5, 0xC4, 0xF2, 0x7D, 0x4D, 0xB9, 0xA0, 0x61, 0x85,
+    0x51, 0x3D, 0xD9, 0xC6, 0xB2, 0xAC, 0xE6, 0x6E, 0xD9, 0x51, 0x86, 0x5E, 0xBA, 0xDE, 0x9F, 0x30,
+    0xE7, 0x6D, 0x47, 0x67, 0xC9, 0xA8, 0x1D, 0x6F, 0xE7, 0x32, 0xF4, 0xEF, 0xAF, 0x62, 0x65, 0x0F,
+    0xF2, 0xC2, 0xAD, 0x14, 0xE3, 0x75, 0x88, 0xB7, 0x7D, 0xAE, 0xF4, 0x2A, 0xB5, 0x37, 0x33, 0xB8,
+    0xF2, 0xB8, 0xF6, 0xB8, 0xF4, 0xB0, 0xEC, 0x7A, 0x16, 0xD9, 0xA5, 0xC3, 0x4D, 0xB8, 0x7A, 0xBC,
+    0x88, 0x0A, 0x8F, 0x67, 0xF0, 0xF7, 0x06, 0x5D, 0xE5, 0x5C, 0x2F, 0xD9, 0x8B, 0xE6, 0xDD, 0x7A,
+    0x45, 0x7B, 0xA7, 0xFC, 0xA1, 0xB6, 0x12, 0x5C, 0xB1, 0x94, 0x50, 0x9D, 0x49, 0x2A, 0xDA, 0x3B,
+    0x50, 0x17, 0x56, 0x2A, 0x8E, 0xF0, 0x13, 0xF0, 0x67, 0x37, 0x94, 0x4A, 0xC0, 0x40, 0xFD, 0x16,
+    0xE2, 0xA1, 0xE2, 0x4E, 0x50, 0x56, 0x4C, 0xEC, 0xBE, 0x04, 0xA3, 0x5D, 0x69, 0xDF, 0xDA, 0x15,
+    0xF4, 0x00, 0x72, 0xC7, 0x33, 0x7D, 0xCB, 0xAF, 0x9A, 0x54, 0x55, 0xF2, 0x15, 0x73, 0x0E, 0x65,
+    0x76, 0xB3, 0x7C, 0x85, 0x3A, 0x92, 0x39, 0xFA, 0x16, 0xD7, 0xCE, 0xA6, 0x7F, 0x0C, 0x79, 0xC8,
+    0xFE, 0x68, 0x42, 0xF2, 0x47, 0xA3, 0xF8, 0xA8, 0x53, 0xE6, 0x7B, 0xE1, 0x6E, 0x95, 0x4C, 0x52,
+    0xF4, 0x0F, 0xBB, 0x5C, 0x59, 0x06, 0xB5, 0x25, 0x6F, 0x56, 0x12, 0x5D, 0x1B, 0x73, 0xE1, 0xA9,
+    0xF8, 0x09, 0x49, 0x1F, 0xD7, 0x87, 0x93, 0x93, 0x3C, 0x94, 0xC4, 0x57, 0xE1, 0x66, 0x1B, 0x6E,
+    0xF2, 0x50, 0x24, 0x8F, 0xF1, 0xFF, 0xA0, 0xBC, 0x03, 0x9F, 0x87, 0x27, 0x80, 0x92, 0x76, 0xB4,
+    0xB7, 0xE4, 0x7C, 0xD4, 0x4D, 0x28, 0x6A, 0x0B, 0x49, 0x1F, 0x14, 0xA9, 0xDE, 0xEC, 0xF3, 0xD6,
+    0x1C, 0x7B, 0xFA, 0xA6, 0x57, 0xFB, 0x92, 0xDE, 0xB2, 0x65, 0xAC, 0x36, 0x7E, 0x3F, 0x4B, 0x66,
+    0x62, 0x54, 0x35, 0x14, 0xEF, 0x50, 0x8D, 0x00, 0x5B, 0x85, 0xC6, 0x3F, 0xB3, 0x62, 0x05, 0x0A,
+    0x52, 0xAF, 0x0C, 0x10, 0x64, 0xE3, 0xEE, 0x32, 0xEB, 0x3F, 0x71, 0xF9, 0x43, 0x11, 0x8D, 0x6B,
+    0x99, 0x1D, 0x85, 0xB4, 0xA5, 0x5B, 0xD4, 0xC3, 0xCD, 0x73, 0x6B, 0xAD, 0x65, 0xCE, 0x93, 0xAC,
+    0xA7, 0xEE, 0xD6, 0xF3, 0x68, 0xA5, 0xAD, 0x70, 0x86, 0xA2, 0x91, 0x47, 0x93, 0x9A, 0xED, 0x65,
+    0xE6, 0x7C, 0x96, 0xAC, 0x0A, 0xEA, 0x54, 0x14, 0x2D, 0x5F, 0x09, 0x3C, 0x4F, 0xFE, 0x15, 0xC3,
+    0x14, 0xE0, 0xE5, 0x2B, 0x8D, 0x26, 0xAD, 0x32, 0x5E, 0x5B, 0x71, 0x5D, 0x03, 0x37, 0xD1, 0xCA,
+    0xBB, 0xC7, 0xC6, 0xBD, 0x26, 0xBC, 0x90, 0xEF, 0x2A, 0x21, 0xEC, 0xF3, 0x3D, 0x09, 0xB7, 0x92,
+    0x8B, 0x70, 0x65, 0xFE, 0x5F, 0x67, 0x55, 0x8F, 0x51, 0x50, 0x31, 0x94, 0xE4, 0xEE, 0x3F, 0x7F,
+    0xF3, 0x1E, 0x35, 0xE1, 0xF4, 0x5D, 0x66, 0xE2, 0x65, 0x6F, 0xC3, 0x55, 0xD7, 0xF9, 0x06, 0x02,
+    0xB9, 0xD8, 0x93, 0x2B, 0x95, 0x7B, 0x4A, 0x7C, 0xB7, 0x63, 0xE2, 0x1A, 0x76, 0x35, 0xDC, 0xBE,
+    0x55, 0xB9, 0x43, 0xC6, 0xD7, 0xB6, 0xDC, 0x27, 0x5E, 0x06, 0xF9, 0x06, 0xFE, 0x88, 0x9C, 0x2C,
+    0xF5, 0x0A, 0x17, 0x9E, 0x53, 0x26, 0xF7, 0x30, 0x66, 0xF2, 0x6E, 0xC4, 0x94, 0x7A, 0xFA, 0xBA,
+    0x1A, 0x56, 0xCB, 0xD4, 0x5C, 0x24, 0x3B, 0x42, 0x46, 0xDC, 0xB2, 0x08, 0x55, 0xC5, 0x9D, 0x50,
+    0x19, 0xE2, 0x43, 0x76, 0xCF, 0x15, 0xFB, 0xA8, 0x78, 0x87, 0x7A, 0xFE, 0xF7, 0x07, 0x44, 0x25,
+    0xBF, 0xDB, 0xA3, 0x88, 0xE4, 0x0B, 0x5D, 0xDA, 0xF8, 0x7D, 0xEB, 0xAF, 0x49, 0x17, 0x77, 0x49,
+    0x9B, 0xB5, 0x09, 0x1C, 0x06, 0x02, 0x39, 0x51, 0x65, 0x0E, 0x0B, 0x6A, 0x94, 0xEE, 0x88, 0xF9,
+    0x60, 0x9E, 0x27, 0x6E, 0x98, 0x82, 0xAB, 0x74, 0x71, 0x16, 0x57, 0x45, 0x62, 0xED, 0x10, 0x0A,
+    0x64, 0xE4, 0x99, 0x8A, 0x0F, 0x13, 0xD8, 0xED, 0x8A, 0x56, 0xA5, 0x50, 0xF8, 0xDE, 0x3D, 0x29,
+    0x29, 0xC7, 0x8F, 0x20, 0x20, 0xDA, 0xE9, 0x66, 0x11, 0xF2, 0x12, 0x51, 0x6E, 0x3B, 0xB8, 0x1F,
+    0x5A, 0xC6, 0xAC, 0x7B, 0x95, 0x09, 0xC2, 0xC5, 0xDB, 0xA8, 0xC3, 0x81, 0x83, 0xFF, 0x6F, 0xDD,
+    0x17, 0x60, 0x25, 0x42, 0x5D, 0xFA, 0x02, 0xFC, 0x69, 0xF0, 0x9F, 0xAF, 0x07, 0x22, 0xFC, 0xAC,
+    0x78, 0xD3, 0xC7, 0xC3, 0x1A, 0x85, 0x60, 0x28, 0x3F, 0xDC, 0xF4, 0x2B, 0x84, 0xF7, 0x8A, 0x36,
+    0xE6, 0x4D, 0xEB, 0x99, 0x02, 0x82, 0x05, 0x5E, 0x12, 0xEC, 0xE0, 0xB5, 0xC9, 0xC1, 0xC2, 0x17,
+    0xF0, 0xC1, 0x64, 0x35, 0x4B, 0x0C, 0x81, 0xFD, 0x13, 0xA3, 0x7B, 0xD8, 0xC7, 0xEC, 0x26, 0xBC,
+    0x4C, 0x2D, 0xDB, 0x12, 0x8B, 0x05, 0x66, 0xE5, 0x2B, 0x20, 0x81, 0x17, 0x01, 0x9F, 0x47, 0x5F,
+    0x4F, 0x5F, 0x70, 0x2F, 0xF4, 0xB6, 0xAA, 0x43, 0x3B, 0x04, 0xA5, 0xD9, 0x2B, 0x15, 0xA7, 0x6A,
+    0xBD, 0x0D, 0xF0, 0xEA, 0x5D, 0xC7, 0x2A, 0x9F, 0x6F, 0xFD, 0x03, 0xCA, 0xB3, 0xFD, 0xB2, 0xF1,
+    0xEB, 0x25, 0xF1, 0x1D, 0xC3, 0xBA, 0x49, 0x1B, 0xBF, 0x70, 0x6A, 0x94, 0x42, 0x66, 0x4D, 0xB6,
+    0x47, 0xEB, 0xEA, 0xC2, 0xAF, 0x99, 0xEC, 0x47, 0x7E, 0xAD, 0xA0, 0x84, 0x48, 0x19, 0xE6, 0xB5,
+    0x91, 0x2B, 0xB4, 0x7B, 0xCB, 0xA3, 0xA8, 0x2C, 0xCB, 0x35, 0x0A, 0x29, 0xA9, 0x9C, 0x1E, 0x3A,
+    0x36, 0xE2, 0x5E, 0xFB, 0x69, 0xED, 0x56, 0x96, 0xE1, 0xFD, 0xC5, 0x41, 0x31, 0x0C, 0x65, 0xE8,
+    0x5B, 0x1A, 0x80, 0x79, 0x45, 0xC7, 0x12, 0xB1, 0xB5, 0x3D, 0x36, 0x76, 0x45, 0x4F, 0x01, 0xD9,
+    0x65, 0x6D, 0xC9, 0xA9, 0xCD, 0x1A, 0x99, 0x87, 0x45, 0x8D, 0x19, 0x46, 0x68, 0x85, 0xC5, 0x4F,
+    0x95, 0xAB, 0x49, 0xC3, 0x2D, 0x12, 0x40, 0xB0, 0x92, 0x18, 0xE2, 0xA2, 0x19, 0x83, 0xE5, 0x00,
+    0x55, 0x8B, 0x5D, 0x93, 0x5E, 0x40, 0x4F, 0x16, 0x98, 0xCD, 0x25, 0x6F, 0x5C, 0x9D, 0xA8, 0xFC,
+    0xC4, 0x8D, 0xCD, 0x46, 0x21, 0x9F, 0xD5, 0x70, 0x42, 0x3F, 0x95, 0x93, 0x6A, 0x8D, 0x1A, 0x3F,
+    0x74, 0xF4, 0xD5, 0x6E, 0xAA, 0x9A, 0x5F, 0xA8, 0xDE, 0x50, 0xA9, 0x4A, 0xA1, 0x34, 0xB6, 0xB4,
+    0xCD, 0xFA, 0x6A, 0xC7, 0xCC, 0xFA, 0xB8, 0x85, 0xCD, 0x3A, 0x24, 0x8D, 0x57, 0x6D, 0x36, 0x7E,
+    0xC9, 0xFB, 0x26, 0x6E, 0xD3, 0xDA, 0xAB, 0x3B, 0x69, 0x93, 0xA1, 0xF1, 0x44, 0xDF, 0x17, 0x5E,
+    0x97, 0xD8, 0x15, 0xFE, 0x1F, 0xB2, 0x50, 0x4B, 0x44, 0x01, 0x4F, 0xB2, 0x92, 0x9E, 0x61, 0xBA,
+    0x8B, 0x8C, 0x41, 0x27, 0xCA, 0x69, 0x92, 0x92, 0x99, 0x49, 0xDF, 0x46, 0x78, 0x55, 0x29, 0xF2,
+    0xD8, 0x0C, 0xD4, 0xCD, 0x31, 0x23, 0x71, 0x4F, 0xDD, 0x92, 0x26, 0x50, 0xA2, 0x4A, 0xC0, 0x93,
+    0x2F, 0x3B, 0x49, 0xDB, 0x31, 0xE9, 0x65, 0xDC, 0x11, 0xD1, 0x98, 0xB0, 0x1C, 0xF0, 0x51, 0xB6,
+    0xDA, 0x14, 0xE5, 0x5D, 0x59, 0xE1, 0x9E, 0xBB, 0xD4, 0xF4, 0xA9, 0x6E, 0x3D, 0x83, 0xD1, 0x5D,
+    0xEE, 0x19, 0x01, 0x02, 0xF8, 0xD8, 0x18, 0x95, 0x43, 0xF5, 0xD9, 0x86, 0xF9, 0x32, 0x3B, 0xE6,
+    0xD0, 0xB3, 0xCA, 0x97, 0x77, 0xF1, 0x20, 0xBD, 0x24, 0xF1, 0x02, 0x7B, 0xC5, 0x3B, 0x54, 0x12,
+    0x40, 0x8E, 0xE0, 0x0E, 0xD3, 0x92, 0x17, 0xCA, 0x4F, 0xA2, 0xBE, 0x02, 0x1D, 0x47, 0x53, 0xE4,
+    0xD5, 0x70, 0xAE, 0xF0, 0x62, 0x9F, 0x71, 0x76, 0xCA, 0x9D, 0xB2, 0xCD, 0xA0, 0xC8, 0x9C, 0x20,
+    0xE7, 0xAD, 0x5A, 0xC1, 0x1D, 0x1A, 0xC1, 0x63, 0xBA, 0xE9, 0x59, 0x9E, 0x0C, 0xF0, 0x02, 0xBF,
+    0x41, 0x4E, 0xCD, 0xFF, 0xEB, 0xA6, 0xB6, 0xB5, 0x0D, 0xD2, 0xD9, 0x06, 0x19, 0xFC, 0xC4, 0x2C,
+    0x5D, 0xF2, 0x63, 0x6C, 0x90, 0x75, 0xEF, 0x37, 0x06, 0xB0, 0x0E, 0xC0, 0x49, 0x23, 0xCF, 0x97,
+    0x5A, 0xBF, 0x21, 0x72, 0x4E, 0xD5, 0x0E, 0xBE, 0xBD, 0x62, 0x5F, 0x56, 0x68, 0xC9, 0x4D, 0xB7,
+    0x7E, 0x83, 0x6C, 0xD1, 0x46, 0x66, 0xFD, 0x6E, 0x58, 0x31, 0xB7, 0x42, 0x5C, 0x2F, 0x5A, 0xF4,
+    0xC5, 0x9B, 0xA4, 0x26, 0xAD, 0xE1, 0x5E, 0x89, 0xA7, 0x5A, 0x1F, 0x7B, 0x76, 0xA0, 0xB5, 0xEC,
+    0x83, 0x95, 0x7B, 0xBA, 0x1C, 0xA2, 0x45, 0x43, 0xD5, 0x3C, 0x0F, 0x05, 0x4A, 0xB3, 0xB0, 0x36,
+    0x77, 0xD4, 0xA7, 0x2D, 0x78, 0xC0, 0x04, 0xC7, 0x3B, 0x7C, 0xCE, 0x1B, 0x51, 0x48, 0x79, 0x3E,
+    0xB9, 0x7E, 0x51, 0xCE, 0xAA, 0xD6, 0x29, 0xAF, 0x1B, 0xFC, 0xF5, 0xB2, 0x93, 0x5B, 0x4C, 0xD9,
+    0x47, 0x43, 0x10, 0xC5, 0x44, 0x08, 0xC8, 0xDC, 0xFF, 0x18, 0x13, 0x72, 0xA5, 0x60, 0x17, 0x14,
+    0xF8, 0xD9, 0x98, 0xDC, 0x2E, 0x5B, 0x78, 0xCB, 0xC2, 0x97, 0xB9, 0x3B, 0x14, 0x86, 0x50, 0x4B,
+    0xE4, 0x32, 0xC7, 0x3E, 0x64, 0xAF, 0x00, 0x0C, 0x41, 0xBE, 0xF1, 0xEB, 0xE8, 0xF2, 0xA3, 0x5C,
+    0x5A, 0xC9, 0xB8, 0xCD, 0xFC, 0x30, 0xDF, 0x7C, 0xC2, 0x3F, 0xE2, 0xD2, 0x01, 0x6C, 0x00, 0x3D,
+    0x02, 0xA7, 0x04, 0xD6, 0x72, 0x4A, 0x85, 0xB2, 0xE2, 0x54, 0x74, 0xE6, 0x44, 0x71, 0x95, 0x64,
+    0x16, 0xB9, 0x53, 0x59, 0x37, 0x7E, 0xFF, 0x88, 0x63, 0xC1, 0x5E, 0x48, 0xC5, 0xDD, 0x1A, 0x2A,
+    0x43, 0x31, 0xFC, 0xE9, 0x58, 0xC3, 0x53, 0x52, 0x07, 0x2A, 0xDF, 0x04, 0xBF, 0x1D, 0xD3, 0x7E,
+    0x05, 0x50, 0xD1, 0x73, 0x2B, 0xF7, 0xA3, 0xBE, 0x35, 0x70, 0x1B, 0x01, 0x55, 0x21, 0x83, 0xCE,
+    0x4C, 0x5D, 0xD9, 0x0B, 0x4A, 0xDA, 0x6F, 0x7E, 0x95, 0x41, 0x29, 0x80, 0x17, 0x03, 0x95, 0x4B,
+    0x3B, 0x25, 0xE4, 0x50, 0x0D, 0xCC, 0x46, 0x05, 0x1B, 0x1F, 0x56, 0x15, 0x39, 0xA0, 0x30, 0x90,
+    0x83, 0xA3, 0x2F, 0x41, 0x75, 0x6D, 0xD5, 0xD2, 0xB2, 0xD8, 0xB0, 0x3E, 0xB0, 0x6C, 0x11, 0xD8,
+    0xDF, 0xF9, 0x5E, 0xDD, 0x1C, 0x4A, 0x05, 0x16, 0x48, 0xA8, 0xC4, 0x32, 0xE5, 0xD7, 0x21, 0x59,
+    0xED, 0xBA, 0x80, 0x1C, 0xA6, 0x38, 0x54, 0x68, 0x65, 0x08, 0x8D, 0x71, 0xE2, 0xA3, 0x6A, 0xA5,
+    0x10, 0x31, 0x26, 0xE8, 0xDC, 0xBC, 0x0E, 0x28, 0x84, 0x89, 0xDD, 0x39, 0xE5, 0x26, 0xF1, 0x2C,
+    0x5C, 0x7E, 0xE2, 0x87, 0x7A, 0xE9, 0x1A, 0x78, 0x69, 0xCB, 0x1D, 0x9C, 0x35, 0xCC, 0x48, 0x80,
+    0xA7, 0x9B, 0x3B, 0x16, 0x5B, 0x3C, 0x2F, 0xF7, 0x68, 0x00, 0x05, 0xC2, 0x94, 0xC4, 0x0A, 0x92,
+    0x70, 0x81, 0xC8, 0x04, 0x0D, 0x5D, 0x54, 0x3B, 0x2D, 0x11, 0x6D, 0x83, 0xCB, 0xC0, 0xEB, 0xBC,
+    0x8C, 0x9A, 0x17, 0x0D, 0x74, 0x53, 0xA6, 0x27, 0xD0, 0x6D, 0x95, 0x75, 0xCC, 0x78, 0x48, 0xBD,
+    0x4E, 0x9F, 0x7A, 0x8A, 0x39, 0x4B, 0xCE, 0x99, 0x1C, 0x42, 0x5B, 0xD2, 0x60, 0x96, 0x37, 0x1E,
+    0x28, 0x60, 0x8D, 0xD1, 0xC1, 0x86, 0x7F, 0x14, 0x2E, 0xAF, 0x66, 0xE1, 0xF2, 0xA9, 0xB6, 0xAF,
+    0x8D, 0xC6, 0x2A, 0xE8, 0xCD, 0x94, 0x46, 0x0C, 0x19, 0xEC, 0xFE, 0x8C, 0x79, 0xE8, 0x0D, 0x1C,
+    0x74, 0x2B, 0xE5, 0xC7, 0xCF, 0x8A, 0x40, 0xD7, 0xC2, 0x28, 0x59, 0x4B, 0xD1, 0x5D, 0x8F, 0xF5,
+    0x3B, 0x85, 0x9B, 0xB0, 0x9C, 0xA6, 0xE6, 0xEE, 0x29, 0x00, 0x4F, 0x0E, 0x6B, 0x41, 0x4B, 0xF1,
+    0x69, 0x7A, 0xA4, 0x1A, 0xF0, 0x6F, 0xDA, 0xC6, 0x3D, 0x7D, 0xBC, 0xA9, 0xBB, 0x51, 0x4C, 0x45,
+    0xA0, 0xEB, 0xF3, 0x8B, 0x40, 0x4F, 0x8E, 0x42, 0x11, 0xD4, 0x4C, 0x15, 0x8A, 0xB8, 0xEB, 0xDA,
+    0x0D, 0xB2, 0xB2, 0x19, 0x1F, 0x82, 0xC6, 0x0D, 0x08, 0x84, 0x84, 0xF5, 0x81, 0xDD, 0x74, 0x29,
+    0xEE, 0x9E, 0x96, 0x1D, 0x19, 0x2E, 0xDD, 0x4B, 0x5C, 0x92, 0x19, 0x96, 0x22, 0x43, 0x6F, 0xB1,
+    0xAC, 0x1C, 0xBC, 0x99, 0x9E, 0x01, 0xF8, 0x8B, 0xB1, 0xC5, 0xD7, 0x03, 0x7B, 0xCE, 0x62, 0x3C,
+    0x87, 0xEB, 0x92, 0xD7, 0xB5, 0xBB, 0x87, 0x60, 0x09, 0x98, 0x23, 0x06, 0x99, 0xD5, 0x86, 0x72,
+    0x52, 0x98, 0x15, 0xED, 0xF7, 0x14, 0x73, 0x7C, 0x69, 0x30, 0xA7, 0x2D, 0x0B, 0x5D, 0x5A, 0x3A,
+    0x49, 0x18, 0x2D, 0x82, 0x1A, 0x08, 0xF7, 0x10, 0xC4, 0x7A, 0xDC, 0x61, 0x22, 0xE3, 0x8E, 0x2A,
+    0x40, 0xCF, 0x94, 0x9C, 0x7B, 0xB2, 0x8A, 0x95, 0xF5, 0xAA, 0x2A, 0x09, 0x59, 0xC5, 0xF5, 0x08,
+    0x6C, 0xB3, 0x0E, 0x56, 0x71, 0xF4, 0x64, 0x44, 0x25, 0x00, 0x22, 0x3F, 0xA6, 0xC0, 0xF7, 0x06,
+    0x2D, 0xAB, 0xFB, 0x71, 0x65, 0xC1, 0xBF, 0x2A, 0xC1, 0x58, 0xC3, 0xD2, 0xD1, 0x91, 0xDC, 0xD1,
+    0x8D, 0x8C, 0x38, 0x3F, 0xE2, 0x3D, 0xA8, 0xA5, 0x43, 0xBA, 0xAC, 0xBF, 0x82, 0xE2, 0xA8, 0xDF,
+    0x0F, 0x71, 0xD7, 0x95, 0xA9, 0xC5, 0xDD, 0xA8, 0xE3, 0xCB, 0x2C, 0x67, 0xCC, 0x21, 0x7A, 0xF8,
+    0x39, 0x80, 0x78, 0x6C, 0xFA, 0x94, 0x1E, 0x7A, 0x61, 0xE3, 0xD0, 0xD9, 0x55, 0x7C, 0x8D, 0x8E,
+    0xE4, 0xAA, 0xC0, 0x72, 0xCB, 0x2F, 0x8D, 0x05, 0x2E, 0x1F, 0x7A, 0x7A, 0x3E, 0xF6, 0x2C, 0x9C,
+    0x78, 0x09, 0x33, 0x3B, 0xBC, 0xFE, 0x82, 0x94, 0x91, 0x81, 0x9E, 0x31, 0x8D, 0x2B, 0xCB, 0x05,
+    0x14, 0xFA, 0xA9, 0xB9, 0x07, 0xFF, 0x97, 0x47, 0xFF, 0xC3, 0x9F, 0x47, 0x5D, 0x3B, 0x21, 0x55,
+    0x59, 0x9D, 0x68, 0x34, 0xEE, 0x73, 0xAB, 0x44, 0x34, 0x7E, 0x42, 0x89, 0xFA, 0x56, 0x28, 0x4C,
+    0x42, 0xA4, 0xB7, 0xE8, 0x43, 0xD1, 0x24, 0x30, 0xEC, 0xE0, 0xDC, 0xBB, 0x72, 0x8D, 0xC0, 0x0B,
+    0x2C, 0x92, 0x29, 0x69, 0x43, 0xCB, 0x6E, 0xF4, 0xC6, 0xE7, 0x60, 0xF7, 0xAA, 0xB6, 0x8B, 0xC8,
+    0x01, 0xAD, 0x2E, 0x82, 0xF7, 0xAA, 0xB6, 0xE3, 0x3D, 0x52, 0x50, 0x0C, 0x4A, 0xA1, 0xDC, 0x19,
+    0x1F, 0xE0, 0xBD, 0x31, 0x03, 0xFF, 0xAC, 0x62, 0xAF, 0x44, 0x38, 0x48, 0x38, 0x6F, 0xCA, 0xED,
+    0x42, 0xDD, 0x38, 0xAD, 0x3B, 0x2B, 0x1E, 0xCF, 0xDE, 0x81, 0xBF, 0xA9, 0x61, 0x65, 0x45, 0xF6,
+    0x13, 0x17, 0xA9, 0x56, 0xDD, 0x2F, 0x8B, 0x7B, 0x7D, 0x34, 0xD5, 0x92, 0x33, 0x6B, 0x80, 0x05,
+    0xE5, 0x89, 0x7C, 0x35, 0x52, 0x19, 0x2D, 0x8F, 0x40, 0xB5, 0xD7, 0xD5, 0xC8, 0x5A, 0x62, 0x03,
+    0xAD, 0xEC, 0x47, 0x0D, 0x44, 0x4C, 0x26, 0x1E, 0x26, 0xA2, 0xA6, 0xDD, 0x74, 0x5F, 0xB4, 0x33,
+    0x28, 0xB0, 0x31, 0x37, 0x62, 0x79, 0x33, 0xC8, 0x1F, 0xDA, 0x8F, 0xDB, 0xE9, 0x7E, 0x7A, 0xCC,
+    0xCA, 0x35, 0xB3, 0xFB, 0x7C, 0xE4, 0x64, 0x88, 0xC1, 0x78, 0x09, 0xBD, 0x61, 0xBC, 0x81, 0x88,
+    0x7B, 0x19, 0x3D, 0x40, 0xC8, 0x5F, 0x34, 0xDE, 0x26, 0x58, 0x42, 0xCF, 0xE1, 0x96, 0x56, 0x02,
+    0x54, 0x21, 0x0D, 0x60, 0x2B, 0xAC, 0x26, 0x44, 0xC1, 0x2B, 0x65, 0x54, 0x42, 0xE2, 0x56, 0xF2,
+    0xEA, 0x81, 0xE9, 0x56, 0x4A, 0x35, 0xE4, 0x6F, 0xE5, 0x6B, 0x80, 0x91, 0xF2, 0x3D, 0x41, 0xFA,
+    0x60, 0x1A, 0xBE, 0xAF, 0x32, 0x4E, 0x24, 0x25, 0xFE, 0x8D, 0x0B, 0x35, 0x75, 0xC5, 0x6B, 0x7D,
+    0x64, 0x28, 0x4D, 0xC8, 0x6C, 0x55, 0xF0, 0xC1, 0x22, 0x35, 0xFD, 0x86, 0x0E, 0xCC, 0x3A, 0xA0,
+    0xE5, 0xA4, 0x22, 0x21, 0xEB, 0xB3, 0x14, 0xF6, 0x91, 0xD2, 0x93, 0x07, 0xDF, 0x6A, 0x32, 0x8C,
+    0x55, 0xC6, 0xC9, 0x44, 0xC5, 0x59, 0xB5, 0xF9, 0x54, 0xE5, 0x36, 0x2D, 0xE7, 0xCB, 0x37, 0x47,
+    0xE9, 0xBD, 0x71, 0x01, 0xCA, 0x2B, 0xDA, 0x4C, 0xEA, 0xCA, 0x66, 0xA2, 0xFC, 0xFA, 0x18, 0xF8,
+    0x24, 0x15, 0xF1, 0xA5, 0xFB, 0x3C, 0x4A, 0xED, 0x61, 0x21, 0xD3, 0x4A, 0xD5, 0x4B, 0x51, 0x36,
+    0xE5, 0xB7, 0xC1, 0xDB, 0xD6, 0x96, 0xAC, 0x52, 0x81, 0xF1, 0xB1, 0x8D, 0x55, 0x37, 0x93, 0xD0,
+    0xD9, 0x50, 0x41, 0xD7, 0xB2, 0xC5, 0x4D, 0x45, 0x40, 0x3E, 0x96, 0x86, 0xBF, 0x94, 0x9D, 0xC4,
+    0x66, 0x75, 0xD0, 0xAC, 0x61, 0x23, 0x8C, 0x68, 0x08, 0x89, 0xF6, 0x80, 0xAA, 0x42, 0xE0, 0xB1,
+    0x4E, 0x5D, 0xFC, 0x32, 0xE0, 0x2F, 0xDC, 0x58, 0x5C, 0x4F, 0x5B, 0xC3, 0x05, 0x3D, 0x59, 0xC6,
+    0x95, 0xC6, 0x64, 0x85, 0xD8, 0x99, 0x06, 0xF4, 0xD0, 0x81, 0x7F, 0xAC, 0x0E, 0x69, 0x9D, 0x78,
+    0xC6, 0x2E, 0x54, 0xEB, 0x58, 0x39, 0x8D, 0xA2, 0xA8, 0xB7, 0xEF, 0x61, 0x40, 0x97, 0xBF, 0xC1,
+    0x54, 0x09, 0x8D, 0x43, 0xC3, 0x90, 0x85, 0xB8, 0xE4, 0x58, 0x64, 0x9C, 0xC8, 0xAD, 0xB5, 0x66,
+    0xA9, 0x2C, 0x93, 0x57, 0x7F, 0x3B, 0x1D, 0x66, 0x85, 0xB1, 0x8D, 0x95, 0x1B, 0x19, 0x47, 0x91,
+    0x92, 0x6B, 0xB0, 0x80, 0xDD, 0x01, 0xF1, 0x2F, 0xDF, 0x08, 0x33, 0x1C, 0x16, 0xB8, 0x95, 0x67,
+    0x7B, 0x65, 0xDF, 0xBC, 0xF1, 0xCB, 0xFD, 0x33, 0xA9, 0xB9, 0x8D, 0xC2, 0x77, 0x17, 0xE3, 0xC4,
+    0x7E, 0x26, 0xDC, 0xFC, 0x79, 0xD8, 0x28, 0xBB, 0x99, 0xBE, 0x7D, 0x90, 0x8D, 0x30, 0xE4, 0x0B,
+    0xE8, 0xBB, 0x48, 0x6B, 0x4D, 0xB4, 0xFE, 0x70, 0xA3, 0xB0, 0x35, 0x0A, 0x5B, 0x76, 0x48, 0x71,
+    0xDD, 0x6E, 0xDE, 0xC2, 0xFE, 0xA9, 0x97, 0xFE, 0xFB, 0xAC, 0x4A, 0xD7, 0x16, 0x8E, 0xD5, 0x3B,
+    0xC3, 0x46, 0x02, 0x9F, 0x51, 0xA1, 0xA4, 0xBF, 0xB1, 0xEA, 0x4C, 0x7F, 0x63, 0xE9, 0x92, 0x9D,
+    0xA9, 0x5D, 0x5E, 0x63, 0x08, 0x37, 0x56, 0xF2, 0x5C, 0x34, 0x23, 0x9C, 0xC4, 0x88, 0xC7, 0x51,
+    0x32, 0x47, 0x5D, 0x29, 0x44, 0x74, 0xD8, 0x54, 0xC1, 0x05, 0x5F, 0xA9, 0x28, 0xC8, 0xEF, 0x0D,
+    0xCF, 0xA9, 0x90, 0x11, 0x02, 0xEF, 0xE0, 0x5B, 0x8E, 0x0C, 0xD8, 0x60, 0xB3, 0xEA, 0x10, 0x03,
+    0x64, 0x2D, 0x57, 0x5B, 0x5A, 0x42, 0xE4, 0x36, 0xA1, 0xDD, 0x83, 0xA8, 0x91, 0x39, 0x49, 0x2F,
+    0x1B, 0x57, 0x49, 0x8C, 0xA5, 0x64, 0x86, 0x96, 0xF4, 0x6D, 0x83, 0x52, 0xBE, 0xF6, 0x27, 0x0B,
+    0x91, 0xB8, 0xB4, 0x59, 0x08, 0xF1, 0xE6, 0xD8, 0xA8, 0xF7, 0xC7, 0xD6, 0x9E, 0x15, 0x20, 0x34,
+    0x2F, 0x6E, 0x44, 0x37, 0x6F, 0xB0, 0x74, 0x7D, 0xAD, 0xC2, 0x9C, 0x0E, 0xCC, 0x69, 0xC1, 0x82,
+    0x48, 0x30, 0xA2, 0xA1, 0x5E, 0xDD, 0x66, 0x26, 0xD9, 0x27, 0x17, 0x0B, 0xC6, 0x27, 0xA9, 0x87,
+    0xCB, 0x4C, 0x61, 0x0A, 0x8C, 0x8A, 0x51, 0xDA, 0x50, 0x9E, 0x62, 0x89, 0xB8, 0xCA, 0x75, 0x0E,
+    0x09, 0xB8, 0xBB, 0xB9, 0xD3, 0x9E, 0x82, 0xA3, 0x55, 0xD5, 0x63, 0xE6, 0x95, 0xE9, 0x77, 0x0B,
+    0x67, 0xC5, 0xB4, 0x24, 0xCE, 0x6D, 0x5B, 0x83, 0x4F, 0x29, 0x53, 0xB4, 0x8F, 0x98, 0xD1, 0x74,
+    0x29, 0x0F, 0x0E, 0x48, 0x53, 0x16, 0xB9, 0x40, 0x47, 0xA4, 0x2C, 0xB1, 0x88, 0x26, 0x5D, 0x8B,
+    0x97, 0x3C, 0xF3, 0x4F, 0x56, 0xF9, 0x79, 0xA3, 0xFD, 0xFF, 0x30, 0x8C, 0xE2, 0x07, 0x7D, 0x7A,
+    0xFA, 0xFC, 0xCC, 0x09, 0x65, 0x59, 0xFC, 0x51, 0xF4, 0xD9, 0xF8, 0x25, 0xD2, 0xEF, 0x33, 0x9B,
+    0xF3, 0x96, 0xC6, 0x47, 0x26, 0xFC, 0x32, 0x87, 0x31, 0x89, 0x66, 0x30, 0x26, 0x69, 0x80, 0x31,
+    0x41, 0xDA, 0x59, 0x4F, 0x18, 0x93, 0x3A, 0xA4, 0x98, 0x98, 0xF4, 0x4F, 0x86, 0x59, 0xD1, 0x6E,
+    0x37, 0x49, 0xFC, 0xF7, 0x06, 0x33, 0x39, 0x1F, 0xC6, 0x84, 0x8A, 0xC8, 0xF5, 0x20, 0x20, 0xD7,
+    0xCE, 0x50, 0x55, 0x54, 0xD0, 0xD0, 0xCD, 0x3E, 0x7B, 0x7F, 0xF0, 0xC1, 0xC5, 0xAC, 0xCA, 0x36,
+    0xBA, 0xFE, 0xF7, 0xC6, 0xF6, 0x33, 0x41, 0x6F, 0xC0, 0xB3, 0x31, 0x94, 0xB9, 0x17, 0x62, 0x0B,
+    0xC2, 0x51, 0x69, 0x10, 0x17, 0x82, 0x37, 0x4F, 0x17, 0xFD, 0xD5, 0xFD, 0x6B, 0x84, 0x23, 0x55,
+    0xC8, 0x5D, 0x99, 0xFA, 0x52, 0xBE, 0x6F, 0x5C, 0x68, 0x63, 0xD1, 0x2B, 0x66, 0x64, 0xEC, 0xA3,
+    0x65, 0x14, 0x57, 0xBE, 0x4D, 0x51, 0xE5, 0x5F, 0x44, 0xDC, 0xB4, 0xA6, 0x02, 0x28, 0xCD, 0x89,
+    0xF3, 0xF8, 0x5D, 0x4C, 0x6E, 0xFE, 0x97, 0xBF, 0x1A, 0x15, 0xD1, 0x27, 0xB2, 0x1D, 0x32, 0x5A,
+    0x86, 0x36, 0xE8, 0x55, 0x0C, 0x42, 0x73, 0x34, 0x19, 0x54, 0xF9, 0x62, 0xD3, 0x42, 0xD8, 0xFC,
+    0xAF, 0x68, 0x41, 0x05, 0x98, 0x94, 0x79, 0xE6, 0x88, 0x6F, 0xB5, 0x97, 0x4E, 0xBE, 0x0C, 0x33,
+    0xAF, 0x43, 0xDE, 0x69, 0xF1, 0xF4, 0x49, 0xFE, 0xD9, 0xD1, 0x4B, 0xE5, 0x76, 0x9F, 0x76, 0x2C,
+    0x8E, 0x6C, 0x4A, 0xF7, 0xCD, 0xC6, 0xBD, 0xB1, 0x6A, 0xAE, 0x7A, 0xAD, 0xE4, 0x61, 0x6F, 0xD0,
+    0x97, 0xB5, 0xDB, 0xFE, 0x65, 0x54, 0xE4, 0xC9, 0x7E, 0x71, 0xE3, 0xF2, 0x1E, 0x96, 0xC4, 0xBA,
+    0x5B, 0xB4, 0x9B, 0xBA, 0xD8, 0xFE, 0x26, 0x85, 0xEE, 0xD2, 0x33, 0x5F, 0x4F, 0x98, 0x1B, 0x7E,
+    0xC3, 0x0D, 0xD9, 0xDF, 0xB9, 0x3E, 0xDB, 0x26, 0xFD, 0x63, 0x81, 0x13, 0x7F, 0x72, 0x16, 0xB1,
+    0x1A, 0x95, 0xBE, 0x78, 0xD2, 0xCB, 0x7F, 0x77, 0x51, 0x4F, 0xA2, 0xED, 0x2B, 0xD1, 0xC5, 0x3F,
+    0x6B, 0xAD, 0x5B, 0x84, 0x81, 0x53, 0xCB, 0x1F, 0xF3, 0xDF, 0xFC, 0x57, 0x5F, 0xC6, 0xAC, 0x6F,
+    0x9E, 0xF6, 0xD2, 0xF0, 0x2B, 0xDC, 0x90, 0xBF, 0x0A, 0x09, 0xF9, 0x49, 0xD3, 0x07, 0x1E, 0x8A,
+    0x7E, 0xDA, 0x9F, 0xAB, 0x63, 0x25, 0xEC, 0x26, 0xC0, 0xA3, 0x20, 0x55, 0xB3, 0x32, 0xDD, 0xB4,
+    0xFD, 0xCC, 0x52, 0x23, 0xD8, 0xE4, 0x5F, 0xFD, 0x4A, 0x54, 0x9B, 0xE4, 0xF8, 0xA7, 0xD1, 0x07,
+    0xF0, 0x73, 0x75, 0xCC, 0x4E, 0xD2, 0x9B, 0x97, 0xE2, 0x62, 0x02, 0x05, 0xF4, 0x33, 0xAE, 0x37,
+    0xC7, 0xF9, 0x57, 0xA7, 0x11, 0xFF, 0x8B, 0xF7, 0x78, 0xDC, 0xA8, 0x47, 0xBF, 0x4F, 0xAA, 0xFF,
+    0xCE, 0x74, 0xFB, 0x99, 0xE9, 0xF6, 0xDB, 0xD3, 0xED, 0x4C, 0xCB, 0x37, 0xAD, 0xDD, 0x4B, 0xD4,
+    0xA5, 0xDD, 0xAE, 0x2A, 0x5B, 0x80, 0x5C, 0xEE, 0xD0, 0xC5, 0x36, 0x48, 0xF2, 0x6D, 0x26, 0xC5,
+    0xB3, 0x9B, 0x6A, 0x11, 0xBE, 0x33, 0xED, 0xEA, 0x6C, 0xD2, 0x4F, 0x7F, 0x17, 0x97, 0x5F, 0x39,
+    0xAB, 0xD8, 0xBD, 0xDF, 0x19, 0x7C, 0x88, 0xD5, 0xA3, 0x22, 0x00, 0xDC, 0x69, 0x76, 0x3B, 0xE4,
+    0x01, 0x02, 0x17, 0x64, 0xB9, 0x1E, 0xF8, 0xE1, 0x3E, 0xFA, 0xA0, 0x7E, 0x24, 0x4B, 0x37, 0x7C,
+    0x83, 0x22, 0xAD, 0x95, 0xBA, 0x10, 0x98, 0xD4, 0xA6, 0x1E, 0x3D, 0x97, 0x2B, 0xB2, 0x1A, 0xFF,
+    0xA7, 0x5E, 0x74, 0xFD, 0x84, 0x08, 0xF4, 0xED, 0xB0, 0x6B, 0xC7, 0x39, 0x58, 0x4E, 0x06, 0xD2,
+    0x72, 0x4A, 0x3B, 0x5F, 0x4D, 0xBD, 0x5E, 0x55, 0xD3, 0x07, 0xC2, 0xC4, 0x3F, 0xFC, 0xAC, 0xAA,
+    0x5E, 0xE2, 0x4E, 0x0E, 0xBC, 0xB8, 0x13, 0xEB, 0xD8, 0xB8, 0xCF, 0x95, 0x21, 0x5B, 0xAC, 0x9A,
+    0x60, 0xCF, 0x20, 0x45, 0xDE, 0xB8, 0x60, 0x03, 0xC2, 0x6E, 0xD9, 0x30, 0x00, 0x27, 0x9F, 0x20,
+    0x5D, 0xB7, 0x9D, 0x8E, 0x37, 0x60, 0xB4, 0x8E, 0xAE, 0x06, 0x25, 0x55, 0xA6, 0x8D, 0x42, 0x9B,
+    0x84, 0x9B, 0x67, 0xBB, 0x70, 0x3F, 0x84, 0xDF, 0xC8, 0xCB, 0xBA, 0x27, 0x90, 0x22, 0xB5, 0x8F,
+    0x07, 0xC6, 0xDF, 0x76, 0x29, 0x23, 0x73, 0x50, 0x04, 0xD5, 0xBA, 0x7D, 0x01, 0x55, 0xFA, 0xEB,
+    0x08, 0x4A, 0x02, 0xC4, 0x0E, 0xF6, 0x31, 0xA2, 0x44, 0x30, 0xD8, 0x90, 0xF8, 0xD2, 0xAA, 0x45,
+    0xB1, 0xD2, 0x96, 0xF0, 0x42, 0x4B, 0xD5, 0x86, 0x6F, 0x57, 0xF2, 0x24, 0x47, 0x6A, 0x59, 0x7D,
+    0x55, 0x25, 0x52, 0x8C, 0xAA, 0x54, 0x32, 0x2E, 0x4F, 0xC5, 0xC6, 0x35, 0x84, 0x60, 0x30, 0x99,
+    0x63, 0x73, 0x4C, 0xF3, 0x0F, 0x3E, 0x54, 0xDB, 0x31, 0xCB, 0x71, 0xE3, 0x57, 0xB6, 0x64, 0x44,
+    0x5B, 0x4A, 0x11, 0x2F, 0xF3, 0x2F, 0x5D, 0xA5, 0x2B, 0x86, 0xFF, 0xFA, 0xAE, 0xA7, 0x4C, 0x93,
+    0x4E, 0x42, 0xD5, 0x7C, 0x1F, 0x59, 0xF6, 0xE8, 0x1C, 0x4B, 0x4A, 0xB5, 0x11, 0xF4, 0x0D, 0x1C,
+    0xA6, 0xD3, 0x4C, 0x58, 0xC3, 0xEB, 0xB1, 0x0A, 0xEF, 0x28, 0x9D, 0xE6, 0xB0, 0x66, 0x4E, 0x89,
+    0x34, 0x84, 0x44, 0xA3, 0x19, 0xDA, 0xB2, 0xD8, 0xC5, 0xAB, 0x3F, 0x82, 0x91, 0x70, 0x75, 0x82,
+    0x72, 0x87, 0x5D, 0x0C, 0xFC, 0x2F, 0x00, 0x96, 0x00, 0x57, 0xE1, 0x8A, 0x65, 0x85, 0xAD, 0xCE,
+    0x94, 0xC8, 0xCD, 0x65, 0xAC, 0x46, 0x7F, 0x92, 0x9F, 0x03, 0x96, 0xB6, 0x1C, 0x23, 0xE7, 0xE1,
+    0xA8, 0x0C, 0x13, 0xDE, 0x45, 0x7F, 0xED, 0x18, 0xDE, 0xEC, 0xDD, 0x7C, 0xB4, 0x72, 0x46, 0x30,
+    0x8F, 0x76, 0x02, 0x32, 0x2E, 0x07, 0x4B, 0xF4, 0x5B, 0xB1, 0x2E, 0x72, 0x4C, 0x25, 0x1A, 0x4B,
+    0x23, 0x51, 0x9C, 0xD4, 0xCF, 0x60, 0x3C, 0x1A, 0x03, 0x75, 0x48, 0x03, 0x7A, 0x34, 0xB6, 0x37,
+    0x71, 0x72, 0x0F, 0x4F, 0x94, 0xB8, 0xE2, 0xDE, 0xBC, 0x26, 0xB3, 0x8F, 0x80, 0x0D, 0xA5, 0x3C,
+    0xC6, 0xE7, 0x64, 0x5D, 0x9E, 0xAD, 0xBF, 0x89, 0xD2, 0xFE, 0xC9, 0x5C, 0xDF, 0xCD, 0x82, 0x03,
+    0x77, 0x5B, 0xDE, 0x79, 0xDC, 0xD2, 0xF3, 0xA9, 0xD3, 0xB1, 0xAA, 0x94, 0xBE, 0x87, 0x72, 0xB8,
+    0xE9, 0x04, 0x7E, 0x92, 0x58, 0x4D, 0xC1, 0xD6, 0x70, 0x55, 0x47, 0x00, 0x68, 0x01, 0xB9, 0x1A,
+    0x68, 0x6F, 0x80, 0x45, 0x80, 0xAF, 0xA1, 0x9D, 0x41, 0x39, 0x4C, 0xF5, 0xA5, 0x9F, 0x60, 0xFD,
+    0xE3, 0x77, 0xA8, 0x2B, 0x97, 0xD4, 0x8C, 0x91, 0x8E, 0xC5, 0x78, 0xD5, 0x62, 0x3C, 0x9D, 0xA0,
+    0xB7, 0xF2, 0xDF, 0x95, 0x7B, 0xFA, 0xCB, 0x8C, 0x48, 0x2F, 0x5A, 0x8E, 0x2A, 0xBF, 0xEF, 0x39,
+    0x01, 0x33, 0x0F, 0xC3, 0xE2, 0xDA, 0x65, 0x80, 0x18, 0x77, 0xC8, 0x2E, 0x45, 0xB5, 0xE6, 0x6E,
+    0x84, 0x30, 0xB9, 0xC7, 0x9A, 0xCD, 0xAD, 0xEF, 0xA1, 0xF2, 0x2A, 0x93, 0x80, 0x37, 0x31, 0x56,
+    0x7E, 0x66, 0xF5, 0x41, 0x22, 0x22, 0xFE, 0xDD, 0xFF, 0x39, 0xF4, 0xDE, 0x77, 0xE8, 0x74, 0x7E,
+    0x9B, 0x55, 0x94, 0x9D, 0xF5, 0x56, 0x66, 0x77, 0x37, 0xAB, 0xD6, 0x64, 0x74, 0xFF, 0xDF, 0x0A,
+    0x31, 0x86, 0xC9, 0xE4, 0xD1, 0xBF, 0x7F, 0xC0, 0x6A, 0x4D, 0x96, 0x62, 0x8D, 0xE9, 0x83, 0x59,
+    0x73, 0x4E, 0x0E, 0xD8, 0x04, 0x6C, 0x5D, 0x3D, 0x18, 0xB0, 0xF5, 0x19, 0x1D, 0xF6, 0x1C, 0x60,
+    0xEB, 0x63, 0x1C, 0x97, 0x07, 0x02, 0x4D, 0xEE, 0x2F, 0x04, 0xB6, 0x66, 0x26, 0xBB, 0x90, 0x1B,
+    0xA6, 0x85, 0xD7, 0x46, 0x57, 0x4E, 0x8A, 0x46, 0x09, 0xE1, 0x2C, 0xDE, 0x67, 0x2D, 0x86, 0x92,
+    0xB5, 0x0D, 0x09, 0xE0, 0xE0, 0x9C, 0x92, 0x69, 0x3D, 0xE7, 0xF7, 0x3D, 0x21, 0xE5, 0x48, 0x1F,
+    0x7D, 0x1F, 0x34, 0x3A, 0x1F, 0xB4, 0xF0, 0x61, 0x77, 0xF7, 0x39, 0xFA, 0x15, 0x14, 0x38, 0xEB,
+    0x66, 0xD7, 0xF6, 0x03, 0xA1, 0xD1, 0x25, 0xE4, 0x39, 0x87, 0xC2, 0x1F, 0xF8, 0x86, 0x5C, 0x67,
+    0xBB, 0xB2, 0x39, 0x73, 0x8A, 0x4C, 0x62, 0x9C, 0xA1, 0x1E, 0xCB, 0x71, 0xEA, 0xE8, 0xD7, 0xDC,
+    0x0F, 0xF2, 0xF7, 0xD8, 0xF3, 0x23, 0x8D, 0x3E, 0x38, 0x1C, 0xF4, 0xC9, 0xA0, 0x9A, 0xAA, 0xF5,
+    0xAD, 0x48, 0x74, 0x4B, 0x90, 0x28, 0xD5, 0x5A, 0xEF, 0x88, 0x82, 0xB6, 0x17, 0x20, 0x9C, 0x1C,
+    0x23, 0x94, 0xA7, 0x35, 0x8B, 0x64, 0xF6, 0xE9, 0xEC, 0x4A, 0x7F, 0xD4, 0x6E, 0x86, 0x0C, 0xBD,
+    0x1D, 0x25, 0x10, 0x64, 0xD8, 0xFF, 0xFE, 0x92, 0xEA, 0x42, 0x14, 0x9E, 0x32, 0xAC, 0x1B, 0x62,
+    0x19, 0x35, 0xA3, 0xAB, 0xF6, 0x0A, 0x8A, 0x7A, 0x78, 0x86, 0xD5, 0xF1, 0x8A, 0xDA, 0x9D, 0x73,
+    0xF2, 0xCD, 0x2D, 0xE2, 0x51, 0xE8, 0x6C, 0x12, 0xAD, 0x8E, 0x8D, 0xBB, 0x0D, 0x0F, 0xF5, 0x92,
+    0x38, 0x72, 0xEC, 0x23, 0x9D, 0x18, 0xF4, 0x60, 0x84, 0x4B, 0x33, 0xA1, 0x55, 0x2C, 0x85, 0x14,
+    0x5C, 0xC1, 0xD6, 0xDA, 0xAE, 0x6E, 0x69, 0xFC, 0xBD, 0x0A, 0xAE, 0x58, 0x7A, 0xB5, 0x9C, 0x1C,
+    0x95, 0x4B, 0x62, 0x26, 0x1B, 0xE8, 0x58, 0x04, 0x86, 0xB1, 0x17, 0x72, 0x7B, 0x25, 0xDC, 0x6D,
+    0x86, 0x4D, 0x05, 0x58, 0x6C, 0x40, 0x42, 0x94, 0x70, 0x39, 0x2D, 0xC9, 0xB4, 0x5B, 0x2B, 0xB6,
+    0xCC, 0x74, 0x06, 0xAD, 0xB4, 0xCD, 0xB0, 0x19, 0xB4, 0xB6, 0xD6, 0x2E, 0xEE, 0x35, 0x67, 0x00,
+    0x60, 0x2E, 0xCD, 0xED, 0xF1, 0xC3, 0x3E, 0x44, 0x02, 0x9D, 0xB9, 0xA1, 0xA7, 0x33, 0x77, 0xD6,
+    0xAE, 0x14, 0xE8, 0x20, 0x92, 0x4C, 0xDE, 0xB1, 0xCC, 0xD7, 0xAE, 0x78, 0x5B, 0x62, 0xBF, 0x6C,
+    0xCA, 0xBD, 0xA1, 0x4C, 0xEE, 0xE9, 0xBE, 0x12, 0xDC, 0xCF, 0xAE, 0x90, 0x1D, 0x66, 0x1E, 0x50,
+    0x82, 0x2B, 0x55, 0x7C, 0x6F, 0xD9, 0xA0, 0xF3, 0xC3, 0x73, 0xF8, 0x02, 0xEB, 0xB2, 0x40, 0xD3,
+    0x8A, 0x22, 0xBE, 0x1B, 0x11, 0xD3, 0x5A, 0x85, 0xF7, 0x42, 0x8A, 0xD8, 0x2C, 0x8C, 0x79, 0x01,
+    0xD6, 0xD9, 0xA4, 0xC5, 0x8F, 0x1E, 0xF5, 0x29, 0x96, 0xBB, 0x9C, 0xDD, 0x6D, 0x27, 0xDC, 0x14,
+    0x6F, 0xFE, 0x76, 0xC4, 0x52, 0x66, 0xE5, 0x3C, 0xD6, 0x7C, 0xC1, 0xBB, 0x2D, 0x2B, 0x01, 0xB6,
+    0xCB, 0xDB, 0xC0, 0xA2, 0x5E, 0x01, 0x7C, 0x15, 0xC9, 0x88, 0x6D, 0x6C, 0x59, 0xF9, 0x59, 0x23,
+    0x63, 0x1F, 0x77, 0xA2, 0x24, 0x9C, 0x54, 0xE6, 0xB6, 0x1A, 0x71, 0x53, 0xCE, 0xB9, 0x5B, 0x8C,
+    0x77, 0x2B, 0xD4, 0x02, 0x96, 0x0A, 0x1D, 0x7D, 0x5D, 0x0E, 0x60, 0x06, 0x4B, 0xB6, 0xE5, 0x88,
+    0x9B, 0x52, 0xF4, 0x0F, 0xC1, 0xDA, 0x47, 0x12, 0x14, 0xB7, 0x37, 0xF2, 0x3C, 0x12, 0xDE, 0xC1,
+    0x35, 0xB2, 0x11, 0x85, 0x62, 0x61, 0x75, 0x1B, 0x6E, 0x4A, 0x3A, 0x52, 0x68, 0x2C, 0xC3, 0x9C,
+    0xDD, 0x15, 0xFB, 0x63, 0xA4, 0xCE, 0x19, 0xAD, 0xA2, 0x91, 0x42, 0x4A, 0x26, 0xFC, 0x88, 0xC0,
+    0xB4, 0xFF, 0x9A, 0x34, 0xD4, 0x7E, 0x76, 0xD0, 0x4C, 0x19, 0x8D, 0x87, 0xC2, 0xFD, 0x99, 0x9B,
+    0xE0, 0x4E, 0x5D, 0x77, 0xB8, 0x4A, 0x7E, 0x81, 0x08, 0x33, 0x8F, 0xD7, 0xC1, 0x98, 0xA1, 0xE7,
+    0x7A, 0xC9, 0x1C, 0x46, 0xC4, 0x08, 0x1E, 0xEF, 0x2D, 0x3C, 0xC7, 0x10, 0xCF, 0x72, 0xF2, 0x04,
+    0x90, 0x0D, 0xEE, 0x94, 0x36, 0xBE, 0x55, 0x3E, 0xE8, 0x08, 0x24, 0x8E, 0x00, 0x4D, 0x23, 0x10,
+    0xD8, 0xBD, 0xF6, 0xFA, 0x96, 0x1E, 0x69, 0xE5, 0x94, 0x91, 0x15, 0x14, 0x0D, 0x77, 0x4D, 0xF9,
+    0x63, 0x31, 0xB2, 0x9F, 0x68, 0xDD, 0x1A, 0x1D, 0x9C, 0x00, 0xFE, 0x6F, 0xB3, 0x80, 0xC3, 0xBD,
+    0xAA, 0x4A, 0x92, 0x57, 0x34, 0x92, 0xA7, 0x24, 0x13, 0xFE, 0x40, 0xCE, 0x31, 0xBE, 0x00, 0x61,
+    0x38, 0x83, 0x67, 0x6E, 0xD8, 0x14, 0xC3, 0xF3, 0x0C, 0xB2, 0x3A, 0xC2, 0x71, 0xA4, 0x3A, 0xB9,
+    0x29, 0x16, 0x9A, 0xDE, 0x08, 0x5A, 0x7A, 0xD0, 0x64, 0x07, 0x00, 0x02, 0x21, 0xFF, 0x60, 0x9E,
+    0x77, 0xCF, 0x75, 0x78, 0xE5, 0x5A, 0xE4, 0xC5, 0x5A, 0xA8, 0x8A, 0x90, 0x93, 0x93, 0x05, 0x18,
+    0xFB, 0x94, 0x60, 0x9D, 0x48, 0x83, 0x73, 0xDF, 0x63, 0x19, 0xD8, 0x77, 0x59, 0x58, 0xF5, 0xEA,
+    0x58, 0x80, 0x21, 0xEC, 0x2B, 0xCF, 0xA7, 0x88, 0xEC, 0xAA, 0x48, 0x22, 0x3C, 0xF3, 0x31, 0x79,
+    0x1E, 0xB8, 0x60, 0xCE, 0x18, 0xEA, 0xAD, 0x2D, 0x52, 0x7D, 0xC9, 0x91, 0x74, 0x2D, 0x95, 0xEC,
+    0x46, 0x02, 0x2D, 0x2D, 0xED, 0x6E, 0xCA, 0xFA, 0x90, 0x73, 0x65, 0x33, 0x1C, 0x17, 0xC0, 0x43,
+    0xCD, 0x9A, 0xB0, 0x4B, 0x97, 0x14, 0x8E, 0x97, 0x34, 0x53, 0xF1, 0x13, 0x3C, 0x2C, 0x2E, 0x29,
+    0x59, 0xCB, 0x90, 0x2A, 0x7F, 0x81, 0xA8, 0x00, 0x59, 0x97, 0x71, 0x8A, 0xDA, 0x4C, 0xC7, 0x66,
+    0x90, 0xF3, 0x96, 0x6F, 0x6B, 0xA9, 0xBD, 0x73, 0x38, 0x45, 0xCA, 0xCB, 0xBD, 0xDD, 0xCF, 0xA7,
+    0xE8, 0xBB, 0x9A, 0xA2, 0x6F, 0x48, 0x1A, 0x7D, 0x9E, 0xC1, 0x5E, 0xB7, 0x11, 0xDE, 0x7C, 0x2C,
+    0x74, 0x35, 0x66, 0xD0, 0xFA, 0x3E, 0x5C, 0xE7, 0x32, 0x49, 0x9E, 0x18, 0x0C, 0x68, 0xDE, 0x52,
+    0x3F, 0x27, 0xA0, 0x79, 0xAF, 0x85, 0x5F, 0x19, 0x49, 0xFD, 0xF6, 0x7F, 0x07, 0xA9, 0xDF, 0xB9,
+    0x0D, 0x52, 0xBF, 0x0E, 0x6A, 0xBA, 0xBF, 0xE1, 0x86, 0x7F, 0x8D, 0xD2, 0xFA, 0x95, 0x39, 0xA9,
+    0xBB, 0xF3, 0x49, 0x9D, 0xF5, 0x82, 0x37, 0x03, 0x95, 0x0A, 0x92, 0xBA, 0x24, 0x6E, 0xEC, 0x5D,
+    0xA6, 0xFF, 0x36, 0xAC, 0x63, 0xB8, 0x5A, 0x36, 0x21, 0xE5, 0x51, 0x42, 0x5E, 0xC8, 0x9E, 0x55,
+    0xF4, 0x84, 0xBB, 0x4A, 0x88, 0x3C, 0xE4, 0x53, 0xE0, 0xE9, 0x75, 0x49, 0x00, 0x9F, 0xBF, 0x55,
+    0xEA, 0x17, 0x50, 0xF6, 0xBD, 0xF5, 0xF4, 0xC5, 0x8B, 0x49, 0xF7, 0x93, 0x10, 0x94, 0xBD, 0xEF,
+    0xEA, 0x36, 0xD2, 0xFD, 0xBE, 0x56, 0xF7, 0x62, 0xBE, 0xBA, 0x1D, 0x41, 0xC3, 0xA6, 0x1D, 0x96,
+    0x09, 0xBA, 0x3E, 0x71, 0x23, 0x05, 0x79, 0x18, 0xD9, 0x36, 0x14, 0x41, 0xCD, 0x54, 0xB6, 0xC5,
+    0x4D, 0x77, 0xBA, 0x3D, 0x28, 0x82, 0xD2, 0x75, 0xD2, 0x0E, 0x7F, 0xDE, 0xAB, 0x5A, 0x09, 0xEC,
+    0xBB, 0x50, 0x38, 0x22, 0xAB, 0xB7, 0xB1, 0x04, 0xEC, 0x9C, 0x65, 0xDF, 0x54, 0xAE, 0x00, 0x21,
+    0x0C, 0xD3, 0x05, 0x3B, 0x77, 0xA0, 0x4E, 0x56, 0xE8, 0x60, 0x02, 0x25, 0xDB, 0xE8, 0x10, 0x92,
+    0x4E, 0xAE, 0xD3, 0x8E, 0x20, 0xC7, 0x59, 0x4B, 0x47, 0x73, 0xD6, 0x08, 0x81, 0x4A, 0xA4, 0x2E,
+    0x43, 0x0D, 0x80, 0x84, 0xE0, 0x6D, 0xC1, 0x77, 0xBE, 0xA6, 0x73, 0x0B, 0x5E, 0x56, 0xFE, 0xFF,
+    0xCB, 0x22, 0xF5, 0xD7, 0x54, 0x9E, 0xBA, 0x55, 0x0C, 0x3D, 0xD7, 0x40, 0x02, 0x10, 0xB1, 0x56,
+    0x4D, 0xA4, 0x42, 0x29, 0x95, 0x56, 0xF6, 0xA4, 0x31, 0x17, 0x6B, 0x05, 0xF5, 0x0C, 0xDE, 0x80,
+    0x8C, 0xF9, 0x35, 0x68, 0xF2, 0xAC, 0x27, 0x0C, 0xB2, 0x27, 0xD9, 0x93, 0x37, 0xC5, 0x9D, 0x90,
+    0x47, 0x55, 0x05, 0x8A, 0x20, 0xA9, 0x59, 0x16, 0x03, 0xD9, 0x5F, 0x3A, 0x08, 0x11, 0x59, 0xFA,
+    0x4C, 0x76, 0x4F, 0x98, 0xD6, 0xEF, 0x70, 0x0C, 0xC5, 0xDB, 0x76, 0xD2, 0x9F, 0xE1, 0x77, 0xAB,
+    0x96, 0x76, 0x67, 0x21, 0x5B, 0x74, 0x69, 0xA9, 0x2A, 0x3B, 0x41, 0x69, 0xDA, 0x09, 0x7F, 0x9A,
+    0xF7, 0x6C, 0x42, 0xD4, 0x1F, 0xE6, 0xD0, 0xC7, 0xC9, 0xB9, 0xA8, 0xFE, 0xAD, 0x10, 0x90, 0x9B,
+    0x03, 0xE8, 0x63, 0x24, 0x95, 0xE6, 0x73, 0x38, 0xFF, 0xB3, 0xA8, 0xFE, 0x3F, 0x38, 0xB9, 0x2E,
+    0xD4, 0xE4, 0x73, 0xE0, 0x97, 0x2F, 0xEA, 0xC3, 0xDD, 0x67, 0xD9, 0x07, 0xD7, 0x0A, 0x16, 0xB2,
+    0xB1, 0x46, 0x65, 0x13, 0x17, 0xB1, 0xDD, 0xB3, 0x69, 0x5F, 0xD5, 0x11, 0x58, 0x8A, 0x67, 0x15,
+    0x9E, 0x61, 0x1C, 0xD9, 0xB4, 0x6E, 0x44, 0x52, 0x14, 0xFA, 0xEB, 0x6E, 0x11, 0x30, 0x19, 0x96,
+    0xC4, 0xFA, 0x0D, 0xBA, 0x3D, 0xCC, 0xF2, 0xB5, 0x45, 0x96, 0x01, 0x14, 0x70, 0xBE, 0xE3, 0x66,
+    0x78, 0x0E, 0x66, 0xBE, 0xEB, 0x32, 0x5D, 0xE1, 0x5F, 0x68, 0xF1, 0x42, 0xF7, 0x9E, 0xE5, 0x4C,
+    0x86, 0xF8, 0x52, 0x4D, 0x63, 0x38, 0x51, 0xC1, 0x6B, 0xE6, 0xAC, 0xEA, 0x95, 0xA8, 0xD9, 0x24,
+    0x11, 0x7D, 0x0D, 0x83, 0x71, 0x08, 0x91, 0xA9, 0x8B, 0xC2, 0x64, 0x45, 0x61, 0xBA, 0xA2, 0x30,
+    0x61, 0x51, 0x98, 0xB2, 0x28, 0x4C, 0x5A, 0x14, 0xA6, 0x6D, 0x9C, 0xB1, 0xA3, 0x9B, 0x21, 0x68,
+    0x78, 0x62, 0xDB, 0x9C, 0xC0, 0x28, 0x4C, 0x61, 0x14, 0x26, 0x31, 0x0A, 0xD3, 0x38, 0x2E, 0xA6,
+    0x28, 0x4C, 0x65, 0x14, 0x26, 0x33, 0x0A, 0x4B, 0x2A, 0x0A, 0x8B, 0xCA, 0x3A, 0x78, 0x7E, 0x4F,
+    0x39, 0x41, 0xA8, 0x4D, 0x21, 0xC5, 0xB0, 0xCC, 0xA8, 0x2B, 0x11, 0x62, 0x5B, 0xE5, 0xDF, 0x35,
+    0x4A, 0xAC, 0x0F, 0x8F, 0x80, 0xAA, 0xE6, 0x47, 0x40, 0xDD, 0x7A, 0xC1, 0x92, 0x30, 0x9C, 0x14,
+    0x80, 0x59, 0x6A, 0x39, 0xBB, 0x27, 0x84, 0x87, 0x8D, 0x1B, 0x0D, 0xC4, 0xB8, 0x3F, 0x3C, 0x7D,
+    0x24, 0x58, 0xD3, 0xC1, 0xA0, 0x0E, 0x75, 0xBF, 0xC1, 0x20, 0x2D, 0xEA, 0xD9, 0x21, 0x0C, 0x86,
+    0x02, 0x6F, 0x55, 0x82, 0xE3, 0xC1, 0x79, 0x72, 0xB7, 0x26, 0xE3, 0x4D, 0x67, 0x4B, 0x31, 0x0D,
+    0x67, 0x59, 0x0A, 0x95, 0x5B, 0x0F, 0x5C, 0x87, 0x23, 0x2C, 0x37, 0x87, 0x47, 0x58, 0xBA, 0xF1,
+    0x66, 0x6F, 0xAA, 0xA6, 0xB0, 0xC4, 0x07, 0x12, 0x2D, 0x35, 0xA0, 0x08, 0xE1, 0xC9, 0xAE, 0xEC,
+    0x86, 0x47, 0x12, 0x23, 0x13, 0xB5, 0x35, 0x5C, 0xF2, 0xA2, 0x5B, 0x8B, 0x6A, 0x59, 0x6F, 0xD8,
+    0xE4, 0x49, 0x3F, 0x1E, 0xF8, 0x10, 0xEB, 0x51, 0xF1, 0xA0, 0xEC, 0x88, 0x88, 0xD6, 0x14, 0x1E,
+    0x95, 0xF4, 0xD6, 0xD3, 0xA4, 0xB3, 0x9E, 0x8E, 0xF9, 0x3F, 0x23, 0x74, 0x73, 0x38, 0x02, 0x69,
+    0x4C, 0x01, 0x0A, 0x07, 0xCD, 0x3D, 0x5D, 0x68, 0x2A, 0xE3, 0x11, 0xD8, 0xDC, 0x22, 0xAC, 0xB8,
+    0xA9, 0xC3, 0x11, 0x16, 0xF9, 0x0C, 0xD2, 0xD5, 0xCF, 0x38, 0xF2, 0x73, 0x0F, 0xCE, 0xFB, 0xDA,
+    0x5B, 0x52, 0x3D, 0x27, 0xF9, 0xEE, 0x0B, 0x56, 0x4D, 0x6C, 0x55, 0xC5, 0xBB, 0xA5, 0x4D, 0xFA,
+    0x54, 0xA3, 0x95, 0x1B, 0x83, 0x63, 0xD9, 0x4F, 0xBE, 0x51, 0xBE, 0xB7, 0xC2, 0x8E, 0xAC, 0xD1,
+    0x22, 0x50, 0x88, 0x6F, 0x4B, 0x9D, 0x9B, 0xD6, 0xAD, 0x19, 0x8E, 0xA5, 0xB4, 0x91, 0xDF, 0x8B,
+    0x35, 0x5A, 0x34, 0x72, 0x33, 0x61, 0xCE, 0xEC, 0x0C, 0x3E, 0x6B, 0x84, 0xCD, 0x3A, 0xD7, 0x53,
+    0xBC, 0x31, 0x55, 0x37, 0x95, 0x18, 0xBD, 0x25, 0x51, 0xB2, 0xB1, 0x60, 0xF2, 0xC6, 0x46, 0xBC,
+    0x31, 0x4B, 0x74, 0xED, 0xDA, 0xE8, 0x9C, 0x84, 0x35, 0x02, 0x27, 0x59, 0xE1, 0x6D, 0x13, 0xCE,
+    0x02, 0x2E, 0xDD, 0xFF, 0xDC, 0xD3, 0x24, 0x62, 0x32, 0xDA, 0xE2, 0x2F, 0x7C, 0xFF, 0xB7, 0x09,
+    0x60, 0x45, 0xA0, 0xB7, 0x27, 0x28, 0x0E, 0xE8, 0x91, 0x45, 0x7F, 0x7B, 0x00, 0xDE, 0xC4, 0xDA,
+    0x15, 0x2D, 0x8A, 0x4A, 0x8B, 0x06, 0x65, 0x1E, 0x80, 0x9E, 0x42, 0x82, 0x61, 0xD2, 0x6D, 0x70,
+    0x6D, 0xE3, 0x1E, 0x57, 0xAF, 0xCB, 0xD4, 0x48, 0x10, 0x2C, 0xFD, 0x67, 0x8A, 0x1A, 0xF5, 0x29,
+    0x18, 0xEB, 0x86, 0xAE, 0xF3, 0x2F, 0x38, 0x67, 0x00, 0xF0, 0x6B, 0x17, 0xC0, 0x03, 0x2C, 0x49,
+    0xC7, 0x77, 0xE8, 0xC4, 0x6C, 0xD7, 0x4F, 0x5F, 0x55, 0xE2, 0xA9, 0x25, 0x22, 0xA9, 0xB0, 0xC9,
+    0x5C, 0x41, 0x77, 0x9F, 0x65, 0x14, 0xF9, 0x52, 0x4E, 0x4B, 0x19, 0xE5, 0x17, 0xF8, 0x10, 0xEA,
+    0x3D, 0x51, 0x1E, 0x96, 0xFD, 0x03, 0x92, 0x9F, 0x91, 0x55, 0x5F, 0x34, 0x45, 0x85, 0xF8, 0x78,
+    0xF1, 0x22, 0xA2, 0xE3, 0xC5, 0x4B, 0x48, 0x08, 0x2E, 0x5E, 0x86, 0x03, 0x32, 0xFB, 0x61, 0x47,
+    0xD5, 0x12, 0xAF, 0x2D, 0xCD, 0x4D, 0x73, 0x2B, 0x1C, 0x8E, 0x5B, 0xCA, 0xFB, 0x7C, 0xD5, 0xD2,
+    0x55, 0xAE, 0xCE, 0xA8, 0x77, 0xE7, 0xBE, 0x11, 0xEE, 0xFD, 0xCF, 0x31, 0xC2, 0x7D, 0xF5, 0xBE,
+    0x07, 0x75, 0x14, 0x9C, 0xFA, 0x54, 0x9B, 0x42, 0x7B, 0xA4, 0x1E, 0xAF, 0xBF, 0x42, 0x7E, 0x92,
+    0x88, 0x43, 0x8A, 0x5B, 0xF4, 0xF3, 0x1C, 0x9F, 0x33, 0x71, 0xEE, 0xD5, 0xFD, 0xE3, 0xDC, 0xC5,
+    0xC5, 0x71, 0xEE, 0xCF, 0xD1, 0x83, 0x46, 0xD8, 0xF2, 0xC6, 0xB4, 0xB2, 0x12, 0xEE, 0xF5, 0xCD,
+    0x68, 0xD8, 0x31, 0xC1, 0x93, 0xD6, 0x9D, 0x0C, 0xBB, 0x6E, 0x6E, 0xD8, 0x4D, 0x89, 0xD4, 0x0F,
+    0x7C, 0xF2, 0x48, 0xFC, 0x9E, 0x30, 0x0A, 0xC5, 0x83, 0xC2, 0x28, 0x9C, 0xDE, 0x00, 0x6D, 0xE9,
+    0xC1, 0xB3, 0x28, 0xBD, 0xCA, 0xB2, 0xEF, 0xE3, 0xEF, 0x1F, 0x5F, 0x7E, 0x25, 0x4F, 0x77, 0xD1,
+    0x75, 0x3F, 0xD2, 0xEC, 0x25, 0x78, 0x22, 0x1A, 0x56, 0x82, 0x0E, 0xAC, 0xD0, 0x43, 0x29, 0x68,
+    0xA6, 0x6A, 0x7E, 0xC0, 0xF2, 0x81, 0x4D, 0xFA, 0x3D, 0x44, 0x6C, 0x59, 0xA2, 0x0C, 0x13, 0x0A,
+    0x7B, 0xAF, 0x63, 0x17, 0x15, 0xCA, 0xD1, 0xF9, 0x8B, 0x82, 0xE5, 0x1B, 0x91, 0xAE, 0xCE, 0x02,
+    0x5C, 0xE9, 0x26, 0x6B, 0x2F, 0x44, 0xBA, 0xCA, 0xFA, 0xDC, 0x30, 0x11, 0x55, 0xA1, 0x54, 0xDB,
+    0x0D, 0x80, 0xAF, 0x08, 0x9E, 0x43, 0xB3, 0x2C, 0x3F, 0x3C, 0xC6, 0x63, 0xBA, 0x59, 0x0F, 0x73,
+    0x3F, 0xF3, 0xC1, 0x4D, 0x88, 0x77, 0x4D, 0x37, 0x97, 0x08, 0x99, 0xB9, 0xA4, 0x37, 0x6B, 0xCD,
+    0x42, 0x28, 0xA1, 0x50, 0xA6, 0xD4, 0x5C, 0x8A, 0xD6, 0xB4, 0x67, 0xE4, 0xED, 0x7B, 0x2A, 0x0F,
+    0x6B, 0x6A, 0xFF, 0xD2, 0x1B, 0x53, 0x6A, 0xF0, 0x50, 0xEF, 0xA5, 0x7C, 0x2D, 0x9C, 0x19, 0x2A,
+    0xDB, 0xD1, 0x27, 0x21, 0xEF, 0x47, 0x71, 0xD1, 0x69, 0x11, 0xC7, 0xDE, 0xF5, 0xE5, 0x05, 0x9E,
+    0x63, 0x84, 0xDA, 0x4E, 0x22, 0x4B, 0xC1, 0xE3, 0x49, 0x83, 0x3A, 0x37, 0x33, 0x25, 0x4D, 0x12,
+    0x1E, 0x1A, 0xA3, 0x3C, 0xE2, 0xF8, 0x30, 0x8F, 0xB8, 0x0F, 0x79, 0xC4, 0x9B, 0x59, 0x1E, 0xF1,
+    0x7A, 0x96, 0x47, 0xBC, 0xB2, 0xD3, 0xC7, 0x8E, 0xF3, 0x88, 0x97, 0x96, 0x47, 0xFC, 0xD3, 0x7B,
+    0xFE, 0x79, 0x6C, 0x45, 0x4F, 0x90, 0x6F, 0xC2, 0x5F, 0x39, 0xE1, 0x3B, 0x05, 0x0F, 0x27, 0x8F,
+    0x8C, 0x86, 0x74, 0x41, 0x35, 0x23, 0xB5, 0xF3, 0x82, 0xAA, 0x7A, 0x46, 0x97, 0x86, 0x74, 0xF9,
+    0x94, 0x9D, 0x53, 0xB9, 0xA8, 0x6A, 0x47, 0xE3, 0x59, 0x56, 0x0E, 0x7D, 0x33, 0x8F, 0xDC, 0xC4,
+    0x16, 0xC8, 0xC2, 0xD1, 0x9E, 0x86, 0xF2, 0x1D, 0xB0, 0xBE, 0xCF, 0x71, 0xAD, 0xCF, 0x1D, 0xD8,
+    0xCC, 0x62, 0x8E, 0x54, 0xC9, 0x8A, 0xD4, 0xAB, 0xC6, 0x8E, 0x4D, 0x2B, 0x29, 0x50, 0x0B, 0x96,
+    0x3A, 0x17, 0xF4, 0x55, 0x13, 0xC7, 0x08, 0x85, 0x57, 0x8C, 0xE7, 0xE2, 0x19, 0x19, 0x61, 0xCF,
+    0xD3, 0x9A, 0x0C, 0x8D, 0x8E, 0xD2, 0xE4, 0x1D, 0x32, 0x1E, 0x4B, 0x26, 0x3F, 0xEE, 0x73, 0x3C,
+    0xE3, 0xB6, 0x5C, 0xBB, 0xC9, 0x78, 0x90, 0x6D, 0x35, 0xC1, 0xDE, 0x33, 0x89, 0xB2, 0x7F, 0xAF,
+    0xF8, 0xC3, 0x7D, 0x8F, 0xA9, 0x29, 0xC2, 0x31, 0x35, 0xCD, 0xE1, 0x31, 0x35, 0x49, 0x97, 0xDA,
+    0x31, 0x35, 0xC5, 0xFB, 0x3A, 0xA6, 0x66, 0x63, 0x6D, 0x28, 0xB4, 0xC8, 0xA6, 0x63, 0x6A, 0xD4,
+    0x9F, 0xEF, 0xDB, 0x62, 0xF8, 0x86, 0x49, 0x12, 0x53, 0xAE, 0xED, 0x98, 0x1A, 0x10, 0xD5, 0xCB,
+    0x40, 0x1E, 0x53, 0x43, 0xE5, 0xA3, 0xA2, 0xCE, 0x4F, 0x83, 0x5B, 0x25, 0x1E, 0x82, 0xEC, 0x39,
+    0xA8, 0xD8, 0xB1, 0xC2, 0xEF, 0x00, 0x4D, 0x62, 0x3A, 0xC5, 0xA4, 0x63, 0x6C, 0x0F, 0x52, 0x3C,
+    0xB8, 0x0E, 0xFD, 0x44, 0x02, 0xD7, 0x11, 0x28, 0xF1, 0xFD, 0x68, 0xEE, 0x23, 0x0B, 0xBD, 0x1E,
+    0xFD, 0x5D, 0x2B, 0x79, 0x0B, 0xCC, 0xED, 0x12, 0x59, 0x66, 0xA0, 0x22, 0xD4, 0x01, 0xD7, 0x31,
+    0x0B, 0x47, 0x6C, 0x5A, 0xAE, 0xE0, 0x76, 0xA2, 0x50, 0x6C, 0xD6, 0x66, 0x27, 0x8B, 0xB2, 0x29,
+    0x34, 0xAC, 0x4C, 0xA3, 0x92, 0x7C, 0x66, 0x32, 0x39, 0xBC, 0xB6, 0x36, 0x24, 0xF3, 0xC8, 0xBE,
+    0x67, 0x29, 0xCE, 0x1C, 0xB2, 0x72, 0x61, 0x15, 0x66, 0x5E, 0x29, 0x61, 0x32, 0x72, 0x8A, 0x84,
+    0x25, 0x07, 0xE5, 0x04, 0x1A, 0x87, 0xB7, 0xD2, 0x21, 0xCA, 0x8B, 0xFA, 0xFE, 0x27, 0xF3, 0x54,
+    0xE3, 0xC9, 0x3C, 0xED, 0x45, 0x67, 0x2D, 0x1F, 0x9C, 0xCC, 0x23, 0xDD, 0x57, 0xA7, 0xE5, 0x44,
+    0xA6, 0xF7, 0xA6, 0x87, 0xE6, 0x29, 0x9E, 0x70, 0xEB, 0xB4, 0x84, 0x9B, 0x9A, 0xDD, 0x10, 0x0A,
+    0x4D, 0x1D, 0x07, 0x2C, 0x9A, 0x11, 0x3B, 0xFC, 0x7E, 0xD6, 0xE6, 0x99, 0x62, 0xAB, 0xCD, 0xC0,
+    0xE2, 0xD3, 0x4B, 0xD7, 0xB0, 0x1B, 0x34, 0x72, 0xB8, 0xD4, 0xDC, 0x90, 0xB5, 0x8F, 0x95, 0xC3,
+    0xF3, 0xE7, 0xA2, 0xBF, 0x94, 0x73, 0xD3, 0x74, 0xAF, 0xF3, 0x0D, 0x03, 0x5C, 0xA0, 0x10, 0xE3,
+    0xB6, 0x4A, 0x1A, 0x45, 0xBD, 0x15, 0xAE, 0xFB, 0xD2, 0xFD, 0xE9, 0x52, 0x79, 0xA3, 0xCE, 0xBD,
+    0xC3, 0xB8, 0xF8, 0x8B, 0x08, 0x9C, 0x0D, 0x78, 0xD4, 0xE2, 0xEA, 0xA1, 0x09, 0xBA, 0x9F, 0x9C,
+    0xE8, 0xEA, 0xBE, 0x99, 0xA0, 0x5B, 0x85, 0x96, 0x64, 0xD7, 0xC9, 0xA8, 0xD3, 0x1C, 0x8C, 0xA7,
+    0x0D, 0x09, 0xDC, 0x40, 0xD0, 0x06, 0x4B, 0x4A, 0x2D, 0x5D, 0x57, 0x14, 0x5C, 0xAA, 0xE9, 0x64,
+    0x99, 0x97, 0x25, 0x8D, 0xE2, 0x48, 0x92, 0xE1, 0x71, 0x78, 0x6A, 0xC6, 0x33, 0x61, 0xA6, 0x33,
+    0x87, 0xE8, 0xED, 0xB8, 0x74, 0x71, 0xE8, 0x0D, 0xCA, 0xA5, 0xD6, 0xF1, 0xC2, 0xC9, 0xC1, 0x6C,
+    0xD7, 0x8B, 0x44, 0x4D, 0x75, 0x11, 0x3B, 0x87, 0x81, 0x79, 0x8D, 0x42, 0x97, 0x25, 0xC1, 0xA4,
+    0x34, 0x09, 0x4D, 0x3A, 0x33, 0x2B, 0x97, 0xB2, 0x1E, 0xA9, 0xA3, 0x15, 0x61, 0x25, 0xDD, 0xE0,
+    0xE8, 0x69, 0x82, 0xE3, 0xE6, 0x1E, 0x16, 0xFE, 0x2B, 0x5E, 0x1F, 0x78, 0x7E, 0xA6, 0x63, 0x0C,
+    0xCF, 0x19, 0xEF, 0x4E, 0x15, 0x1A, 0xE5, 0xA5, 0x0D, 0x41, 0x0C, 0x12, 0x9A, 0x17, 0x12, 0x9B,
+    0x3B, 0x44, 0xA8, 0x54, 0x15, 0x39, 0xF3, 0x05, 0x24, 0xAE, 0x8F, 0x48, 0x8C, 0xE0, 0x53, 0x77,
+    0x89, 0x24, 0x4E, 0x99, 0x52, 0x9D, 0x31, 0x3B, 0xF7, 0xB3, 0xF0, 0x45, 0xD5, 0x7F, 0x0C, 0x12,
+    0xB7, 0x5F, 0x4D, 0x9C, 0x55, 0x07, 0x17, 0xBC, 0xEA, 0x70, 0xA7, 0xC4, 0x48, 0x3C, 0xD0, 0x5F,
+    0xC9, 0xD8, 0xCE, 0x8A, 0x8C, 0x7D, 0xC5, 0xE3, 0xDE, 0xD7, 0x3B, 0x56, 0xDC, 0xF0, 0x50, 0x8B,
+    0x4D, 0x75, 0xEE, 0xB1, 0x4E, 0x81, 0x64, 0x29, 0xBD, 0x19, 0x2D, 0xD7, 0x27, 0x97, 0x27, 0x57,
+    0xA7, 0xFB, 0x51, 0xED, 0xE9, 0xF6, 0xB7, 0x6F, 0xFB, 0xCB, 0xEB, 0xAF, 0x7B, 0xE2, 0xBD, 0x73,
+    0xDB, 0x93, 0x6C, 0x84, 0xF7, 0x00, 0xC9, 0xF2, 0x18, 0xAC, 0x73, 0x51, 0x7E, 0x1E, 0x7E, 0x31,
+    0x96, 0xF9, 0x63, 0x84, 0x29, 0x06, 0xF8, 0xDB, 0x93, 0x62, 0x68, 0x90, 0x39, 0xEF, 0x21, 0x11,
+    0x2E, 0xCC, 0x0B, 0xFD, 0x5E, 0x79, 0x47, 0x31, 0x3E, 0x86, 0x3E, 0x04, 0x1D, 0x02, 0x53, 0xD8,
+    0xDD, 0xC6, 0x1E, 0xDE, 0x11, 0x2E, 0x82, 0x84, 0x3D, 0x4B, 0xDE, 0x7E, 0x4E, 0xDE, 0x71, 0x05,
+    0x57, 0x3A, 0xB3, 0x52, 0x27, 0xB5, 0x6B, 0x05, 0x3B, 0xB1, 0x90, 0x33, 0x3E, 0xD3, 0x8B, 0x0F,
+    0xBD, 0xB1, 0xB5, 0x0C, 0xF8, 0x91, 0xEC, 0x6D, 0xE2, 0x43, 0xDF, 0x73, 0x82, 0xF2, 0xA0, 0xC3,
+    0x0C, 0xB0, 0x23, 0x4E, 0x90, 0x90, 0x0D, 0xAF, 0xFB, 0xF1, 0x9C, 0xEF, 0x43, 0xBC, 0xEE, 0xE8,
+    0x1C, 0xBC, 0xEE, 0xFE, 0x81, 0xF0, 0xBA, 0x0F, 0x12, 0xDA, 0xC5, 0x8F, 0x92, 0xE9, 0x28, 0x84,
+    0xCE, 0x22, 0xA3, 0xAA, 0x06, 0x1B, 0x4A, 0xA9, 0x20, 0x02, 0xE4, 0xCA, 0x88, 0x1E, 0x9A, 0xC1,
+    0x81, 0x8D, 0x24, 0xE6, 0x9D, 0xCE, 0x7A, 0x2C, 0x5F, 0x64, 0x52, 0x4E, 0xE4, 0xA7, 0xB3, 0xBA,
+    0x4C, 0x18, 0x6B, 0x69, 0xFC, 0xA5, 0x01, 0x03, 0x64, 0x86, 0xB7, 0x41, 0x86, 0xF9, 0x06, 0x1F,
+    0x77, 0xFA, 0xEC, 0xA4, 0x34, 0x8D, 0x6C, 0x70, 0xD6, 0x06, 0xC1, 0x56, 0x8D, 0x45, 0x57, 0x97,
+    0xD8, 0xAD, 0xE1, 0x4B, 0xA3, 0x33, 0x2A, 0x9A, 0xB0, 0x30, 0xE4, 0xFE, 0x50, 0xBF, 0xDF, 0x98,
+    0xA5, 0x89, 0xD8, 0xE1, 0xBF, 0x02, 0x89, 0xD8, 0x84, 0x0C, 0x05, 0x28, 0x5C, 0x7D, 0x02, 0x14,
+    0x7A, 0xBF, 0x97, 0x8B, 0x6F, 0x40, 0x7F, 0x2F, 0x9F, 0x82, 0xCE, 0x5E, 0xFA, 0x1D, 0x5C, 0x52,
+    0xE0, 0x08, 0x34, 0x46, 0x87, 0x77, 0x0F, 0x20, 0xD2, 0x70, 0xE3, 0x30, 0x39, 0x45, 0x96, 0xA2,
+    0xE7, 0xAE, 0xEB, 0x00, 0x73, 0xB1, 0x1A, 0x21, 0x53, 0xA8, 0xB8, 0xDD, 0x99, 0xD5, 0x64, 0x7E,
+    0xCC, 0x69, 0x1D, 0x3C, 0x3E, 0x47, 0xF5, 0xC6, 0x0F, 0xAA, 0xBD, 0xFC, 0x72, 0xE7, 0xC8, 0x42,
+    0x5F, 0xDD, 0x0C, 0xFB, 0xB9, 0x9D, 0x12, 0x02, 0xD3, 0x99, 0x73, 0xD6, 0xF2, 0xBA, 0x84, 0xCB,
+    0x5D, 0xCB, 0x69, 0x15, 0x87, 0xAA, 0x8B, 0xB3, 0x16, 0xEB, 0x7E, 0x6E, 0xB1, 0x2E, 0xEF, 0x0F,
+    0xFC, 0x77, 0x5E, 0xCA, 0x4E, 0xD1, 0x99, 0x8B, 0x28, 0x1D, 0x4D, 0xFD, 0xCC, 0x85, 0x54, 0xC4,
+    0x36, 0x32, 0x02, 0xC6, 0xED, 0x32, 0xCC, 0x65, 0x6F, 0x20, 0xDF, 0x16, 0xC9, 0x32, 0x1D, 0x2E,
+    0x44, 0x84, 0x1F, 0x1D, 0x2E, 0xCA, 0x59, 0xFD, 0xC7, 0x13, 0xDC, 0x0F, 0x4F, 0x70, 0x5F, 0x38,
+    0x66, 0xE5, 0xEA, 0xAE, 0x08, 0x75, 0xF3, 0x79, 0xC8, 0x20, 0x70, 0x63, 0xE9, 0x5D, 0x31, 0x26,
+    0xB4, 0x6C, 0xA6, 0xC0, 0xFB, 0xA7, 0x8E, 0xA8, 0xFB, 0x71, 0x3E, 0xC4, 0xE6, 0x01, 0xE3, 0xF8,
+    0xBB, 0x9F, 0x2A, 0x8E, 0x6F, 0xB0, 0x0F, 0xAE, 0x1F, 0xC1, 0x60, 0x56, 0xCE, 0x36, 0xF2, 0xF6,
+    0x51, 0x9D, 0x5F, 0xB7, 0x70, 0xA6, 0xCA, 0x5B, 0xB8, 0xA8, 0x0D, 0xC7, 0x22, 0xB2, 0x61, 0xB1,
+    0x67, 0x38, 0x0D, 0x71, 0x6A, 0x02, 0x22, 0xE8, 0xA8, 0x30, 0x2C, 0x02, 0x38, 0xDE, 0x4E, 0xCB,
+    0xCE, 0xCF, 0xF3, 0xEF, 0x9E, 0x90, 0x1B, 0xA7, 0xA1, 0x28, 0x45, 0x9A, 0xDB, 0xD1, 0xC1, 0xCB,
+    0x79, 0xA8, 0xFD, 0xB9, 0x20, 0xFE, 0x19, 0x60, 0x15, 0x11, 0xFF, 0xDC, 0x1F, 0xC5, 0x3F, 0xCB,
+    0x6E, 0x06, 0xAE, 0x68, 0x68, 0x49, 0xB5, 0xE1, 0xCD, 0xA0, 0x28, 0x98, 0xD4, 0x4E, 0x07, 0x3B,
+    0xED, 0x52, 0x31, 0xDA, 0xAC, 0xB5, 0x13, 0xA6, 0xE5, 0x07, 0x99, 0x27, 0x7A, 0xCE, 0x0E, 0x19,
+    0xA6, 0x73, 0xF8, 0xB3, 0x37, 0xAD, 0xA2, 0x53, 0x25, 0x90, 0x79, 0xA4, 0x04, 0x0F, 0x80, 0x09,
+    0xCC, 0x96, 0x66, 0x31, 0x8B, 0xEE, 0xCC, 0xDA, 0x70, 0xE4, 0xC0, 0xD2, 0x62, 0x3D, 0x48, 0x60,
+    0xB3, 0xC0, 0x8E, 0x1D, 0x4F, 0x28, 0x3D, 0x66, 0xE3, 0xC6, 0x33, 0x09, 0x75, 0x24, 0x61, 0x27,
+    0x3E, 0x68, 0x85, 0xCC, 0x82, 0x0A, 0x97, 0xEA, 0x4E, 0xC2, 0x95, 0x86, 0x03, 0xEA, 0x02, 0x0E,
+    0xE8, 0x6E, 0x65, 0xEC, 0xD1, 0x98, 0xE3, 0x36, 0xE4, 0x9A, 0xAC, 0x8D, 0x3B, 0x92, 0x4B, 0xA6,
+    0x3A, 0x0C, 0xFE, 0xB7, 0x64, 0x19, 0x98, 0xA9, 0x09, 0x25, 0x92, 0x09, 0xB5, 0x34, 0x5D, 0x91,
+    0xA5, 0x91, 0x0D, 0x52, 0xB3, 0x59, 0xFA, 0x96, 0xB4, 0x87, 0xB8, 0xED, 0xA6, 0xF7, 0x04, 0xA9,
+    0x14, 0xFC, 0xF4, 0xEB, 0xC0, 0x44, 0x6D, 0x47, 0xA7, 0xE2, 0x91, 0x8F, 0xB8, 0x67, 0xA7, 0xC4,
+    0x78, 0x21, 0x5B, 0x1B, 0x60, 0x09, 0xE0, 0xCD, 0x59, 0x91, 0xDA, 0x90, 0x63, 0x53, 0x15, 0xB7,
+    0xC3, 0x55, 0xED, 0x5C, 0x55, 0xAB, 0x16, 0x0D, 0xC4, 0x21, 0x00, 0xB4, 0x40, 0x90, 0xEA, 0xD1,
+    0x2D, 0xC0, 0xC0, 0x42, 0xA0, 0xC7, 0xA7, 0x65, 0xBF, 0x65, 0x30, 0xE0, 0x00, 0x84, 0x87, 0x98,
+    0x62, 0xC5, 0x03, 0x0A, 0x08, 0x08, 0x07, 0x90, 0x64, 0x0C, 0x69, 0x35, 0x1C, 0x60, 0x71, 0x9C,
+    0x97, 0x72, 0x72, 0x60, 0x7F, 0x8E, 0x08, 0xB6, 0xD9, 0xB9, 0x07, 0xA4, 0xEF, 0x1F, 0xE4, 0x80,
+    0xF4, 0x29, 0x9C, 0xFB, 0xF8, 0xCF, 0x16, 0xCE, 0xBD, 0xE8, 0x34, 0x5D, 0xEB, 0x43, 0x7A, 0xD8,
+    0x87, 0xF6, 0xC8, 0x6A, 0xDE, 0x84, 0xE4, 0xBC, 0x68, 0x2C, 0x20, 0xFB, 0xEC, 0x37, 0x9D, 0x5C,
+    0xD7, 0x64, 0x20, 0x99, 0x78, 0x9F, 0x45, 0xC2, 0x53, 0x0B, 0xA7, 0x9C, 0x04, 0x30, 0xCE, 0x9F,
+    0x5F, 0x70, 0xB7, 0x9F, 0xE9, 0xDA, 0x21, 0x9F, 0x7B, 0x6E, 0xAC, 0x1F, 0x9A, 0xA1, 0x01, 0xFF,
+    0xCA, 0x8F, 0xED, 0x2F, 0x4A, 0xCB, 0x3C, 0x8B, 0xEC, 0x90, 0x37, 0xE1, 0xC4, 0xFB, 0x05, 0x98,
+    0x1F, 0x60, 0xFD, 0x7D, 0x78, 0x63, 0xF1, 0xAE, 0xB3, 0x20, 0xF3, 0x41, 0x2C, 0xBE, 0x56, 0x2C,
+    0x7E, 0xEE, 0xE9, 0x59, 0x85, 0x20, 0xD7, 0x1C, 0x59, 0xC6, 0x22, 0x87, 0x06, 0x1A, 0x10, 0x74,
+    0x80, 0x7D, 0xF4, 0x0B, 0x89, 0xC5, 0x3F, 0xCF, 0x58, 0x7C, 0x3F, 0x8B, 0xC5, 0xD3, 0xE2, 0x77,
+    0x33, 0xE7, 0x87, 0x99, 0xB9, 0x93, 0xB7, 0xD7, 0xCC, 0xBA, 0x99, 0x73, 0xD2, 0x77, 0xF3, 0x67,
+    0x76, 0x84, 0xE4, 0x3F, 0x85, 0x23, 0xE4, 0xD8, 0xEC, 0x5D, 0x9E, 0x2A, 0x09, 0xC5, 0x4E, 0xBF,
+    0xDC, 0x45, 0x8A, 0x86, 0x58, 0x24, 0xE4, 0xAC, 0x09, 0x7A, 0x91, 0x3B, 0x38, 0x80, 0xFE, 0x7D,
+    0xB0, 0x8E, 0x90, 0x47, 0x6E, 0xF6, 0xA3, 0xF7, 0xA3, 0x33, 0x94, 0xD9, 0xD2, 0xF0, 0xEC, 0x74,
+    0x59, 0x28, 0x5A, 0x9B, 0x5B, 0x08, 0x63, 0x35, 0x9E, 0x1F, 0x2B, 0xE4, 0xCB, 0x35, 0x53, 0xCC,
+    0x28, 0x21, 0x6B, 0xF9, 0x29, 0x63, 0xC5, 0x41, 0xB7, 0xBA, 0x71, 0x86, 0x67, 0xB1, 0x0C, 0x37,
+    0xAB, 0x70, 0x16, 0x03, 0x21, 0x12, 0xB2, 0x7B, 0x5E, 0x50, 0xDE, 0x83, 0x68, 0x78, 0xAB, 0x15,
+    0x1E, 0x46, 0xE1, 0x6F, 0x10, 0x54, 0x8C, 0xCA, 0xD7, 0xBC, 0xE1, 0x04, 0x0C, 0x37, 0xF7, 0x8A,
+    0xE7, 0xC7, 0x4F, 0xE0, 0xE6, 0xBB, 0x5E, 0x59, 0x81, 0xEE, 0xEF, 0x6F, 0x56, 0x7D, 0x86, 0x53,
+    0x92, 0x9F, 0xEA, 0x88, 0xFE, 0xBF, 0x74, 0x9F, 0xEF, 0x92, 0x86, 0xB8, 0x72, 0xAB, 0x0E, 0xD0,
+    0x5F, 0xBC, 0x29, 0x76, 0xA5, 0x6E, 0x80, 0x6F, 0x16, 0xAD, 0x87, 0x55, 0x4F, 0x84, 0x38, 0x60,
+    0xFD, 0x41, 0x2B, 0x66, 0x38, 0x02, 0x78, 0x14, 0xBC, 0x69, 0xE1, 0x98, 0x4A, 0x50, 0xA6, 0x83,
+    0xB9, 0x02, 0xF6, 0xF6, 0x1E, 0x9C, 0x9E, 0xA0, 0x2D, 0x6B, 0xC8, 0xB3, 0x9A, 0x20, 0x16, 0x67,
+    0xC2, 0x38, 0x71, 0x7F, 0x8C, 0xB6, 0x31, 0x26, 0x0A, 0x07, 0xCF, 0x71, 0x10, 0x6B, 0xA3, 0x5C,
+    0x13, 0xCB, 0x7C, 0xE4, 0x34, 0x8F, 0x1E, 0x3B, 0xCD, 0x49, 0xB4, 0x92, 0x00, 0x00, 0x55, 0xA4,
+    0x73, 0x0A, 0x98, 0x0E, 0x0C, 0xFD, 0xD3, 0x8E, 0x70, 0xAB, 0x36, 0xD6, 0xC6, 0x64, 0x0B, 0x65,
+    0x05, 0x4A, 0x2D, 0x5D, 0x51, 0x65, 0x44, 0x3F, 0xCC, 0xAA, 0x92, 0xE0, 0x87, 0xD9, 0x0E, 0x25,
+    0x5C, 0xBE, 0xFD, 0x2B, 0x1C, 0xE1, 0xB6, 0x1E, 0xB2, 0xEF, 0x83, 0x48, 0x9B, 0x3E, 0x7D, 0x4D,
+    0x87, 0x23, 0xA4, 0xB7, 0x1B, 0xB5, 0xAE, 0xE6, 0x51, 0x6E, 0xA9, 0x57, 0x7F, 0x76, 0x5E, 0x56,
+    0xA5, 0x70, 0xFE, 0xD4, 0x69, 0x93, 0x78, 0x25, 0x1A, 0xA9, 0xC4, 0x8C, 0x53, 0x7B, 0x5D, 0x9D,
+    0x40, 0xE4, 0xDB, 0x31, 0x21, 0x7C, 0x1E, 0xC6, 0xDA, 0x3C, 0x58, 0x89, 0x96, 0x95, 0x29, 0x7D,
+    0x48, 0xCC, 0xB2, 0xB2, 0x22, 0x1C, 0x4E, 0x59, 0x11, 0xA5, 0xB8, 0xA0, 0x2B, 0x2D, 0xFC, 0x51,
+    0x55, 0xE8, 0xDE, 0x0E, 0x38, 0xA7, 0xC8, 0x6E, 0x1D, 0x34, 0xCF, 0xBD, 0x4C, 0xEC, 0x7A, 0xC2,
+    0x15, 0x0C, 0x6C, 0xC9, 0xDD, 0x56, 0x44, 0xEA, 0x5B, 0xB2, 0xAF, 0xF8, 0x82, 0xCD, 0xC0, 0x06,
+    0xB8, 0x99, 0xA4, 0x90, 0xA1, 0x54, 0xAB, 0x0F, 0x7B, 0x21, 0x0E, 0x55, 0x31, 0x15, 0x14, 0x00,
+    0x96, 0x45, 0x82, 0x20, 0x0B, 0xA0, 0x86, 0x89, 0x1B, 0x0F, 0x3C, 0xD6, 0x21, 0xA3, 0x0C, 0x76,
+    0xDE, 0x05, 0x38, 0x15, 0x0F, 0x3A, 0x67, 0x7D, 0x56, 0xA4, 0xB2, 0x34, 0x2B, 0xCC, 0x0A, 0x48,
+    0x57, 0x2B, 0x21, 0x5D, 0x11, 0xE0, 0xAE, 0x43, 0x6D, 0xAE, 0xBF, 0x42, 0x3D, 0x1F, 0x56, 0x63,
+    0x6E, 0x5F, 0x14, 0x54, 0xE6, 0x1B, 0x87, 0x81, 0xF9, 0xC5, 0x77, 0xF2, 0x13, 0x24, 0x03, 0xEC,
+    0x09, 0x52, 0x75, 0xD7, 0x24, 0x13, 0x42, 0x70, 0x44, 0x78, 0xDF, 0x11, 0xAD, 0x26, 0xD7, 0x99,
+    0x78, 0x49, 0x88, 0x43, 0x66, 0x63, 0xDD, 0x5B, 0x10, 0xAF, 0x3A, 0x30, 0x56, 0x60, 0x2C, 0x45,
+    0x03, 0xC9, 0x81, 0x30, 0xDB, 0x8E, 0x05, 0x70, 0x21, 0x14, 0x96, 0xB8, 0x81, 0xDC, 0xA2, 0x25,
+    0x92, 0x08, 0x5E, 0x68, 0x87, 0x9D, 0x8C, 0x3F, 0xF1, 0x9E, 0xD5, 0x99, 0x69, 0xCD, 0xDA, 0x54,
+    0x20, 0xF9, 0x4D, 0xFF, 0xF7, 0xF0, 0xF6, 0xB1, 0x8F, 0xD5, 0x44, 0xD9, 0xCF, 0xB0, 0x6A, 0x03,
+    0x1C, 0x95, 0x5D, 0x05, 0xE1, 0xF4, 0xDC, 0xF2, 0xB8, 0x68, 0xFC, 0xC3, 0x31, 0x51, 0xC9, 0x68,
+    0xD8, 0x66, 0x67, 0x4D, 0xDC, 0x45, 0x80, 0x2A, 0x36, 0x7C, 0x10, 0x45, 0x17, 0x03, 0xC3, 0x4C,
+    0xFA, 0x80, 0xAC, 0x93, 0x75, 0x81, 0x77, 0x06, 0xF4, 0x0D, 0xAB, 0xB0, 0x31, 0x9E, 0x69, 0x0C,
+    0x15, 0xF2, 0xD8, 0x59, 0xE8, 0xD2, 0xAA, 0x02, 0x78, 0x7A, 0xB6, 0x1D, 0x3C, 0xCC, 0x03, 0x34,
+    0x74, 0xAE, 0xC8, 0xC2, 0x11, 0x3B, 0x70, 0x19, 0x5E, 0x3A, 0xA2, 0x94, 0x5A, 0xA2, 0xD7, 0x36,
+    0xE0, 0x49, 0x19, 0x9E, 0xCA, 0xA0, 0x04, 0xB3, 0x28, 0x38, 0x8C, 0xA5, 0xEC, 0xC4, 0xEE, 0x94,
+    0x99, 0xB5, 0xA1, 0xEA, 0x68, 0xA3, 0x83, 0x96, 0x91, 0x61, 0x35, 0x44, 0x56, 0x48, 0x9A, 0xE9,
+    0xAC, 0x27, 0x82, 0x1F, 0xFA, 0x19, 0xC1, 0x31, 0x46, 0x7E, 0x4E, 0x06, 0x05, 0x79, 0xEF, 0x3A,
+    0x2B, 0xE9, 0x11, 0x2A, 0xF6, 0x5D, 0x54, 0xF7, 0xB7, 0x8C, 0xC6, 0x6D, 0x91, 0xE7, 0x0A, 0x37,
+    0x48, 0xDA, 0xEA, 0x2C, 0x4B, 0xC0, 0xEC, 0x09, 0x07, 0x3A, 0xEB, 0x54, 0x48, 0x99, 0xA9, 0xC8,
+    0x31, 0x67, 0xA2, 0x81, 0x23, 0x32, 0x7B, 0xE1, 0xEE, 0xE4, 0x36, 0x57, 0x91, 0x9D, 0xB0, 0x15,
+    0x71, 0xBE, 0xA8, 0x64, 0xF7, 0x30, 0x7C, 0xFF, 0x99, 0xF9, 0x18, 0x05, 0x36, 0xAD, 0x44, 0xAA,
+    0xCE, 0x10, 0x83, 0xF6, 0x7D, 0x0A, 0xA7, 0xE0, 0x95, 0x20, 0xBA, 0xC5, 0x0E, 0xC5, 0x0D, 0xC5,
+    0x0C, 0xB3, 0xA0, 0x99, 0x9C, 0xC7, 0x09, 0xDF, 0x47, 0x31, 0xD6, 0xD9, 0xBA, 0xB4, 0x66, 0x82,
+    0x3B, 0x19, 0x61, 0x7D, 0x6B, 0x83, 0x3B, 0x81, 0x82, 0x7B, 0xF5, 0xC1, 0x22, 0xF8, 0x7A, 0x95,
+    0x41, 0x38, 0x05, 0xA8, 0xCB, 0x3C, 0xE0, 0xB9, 0xAE, 0x7A, 0xB8, 0x83, 0xFC, 0x95, 0x19, 0xB3,
+    0x4B, 0x22, 0x61, 0x5B, 0xE5, 0x97, 0x98, 0xDD, 0xEE, 0x90, 0xD9, 0x45, 0x7F, 0x78, 0x67, 0x0C,
+    0xA0, 0xA6, 0x01, 0x2C, 0x17, 0x9A, 0x60, 0xC3, 0x63, 0xD1, 0x2B, 0x19, 0xF7, 0x82, 0xCA, 0xA7,
+    0x7F, 0x62, 0x71, 0xF6, 0x28, 0x78, 0x42, 0xEE, 0xDD, 0xCD, 0x47, 0x2D, 0xAD, 0x99, 0x69, 0x6F,
+    0x7E, 0xCF, 0x05, 0x60, 0xE8, 0x78, 0x56, 0x93, 0xEB, 0xBF, 0xF0, 0xC6, 0x11, 0x72, 0xB8, 0x2A,
+    0x5D, 0xF4, 0x38, 0x0D, 0xC6, 0x5E, 0x70, 0x0B, 0x39, 0x55, 0xBF, 0x67, 0xC0, 0x69, 0x21, 0xA5,
+    0xA9, 0x39, 0xF3, 0x26, 0x02, 0xE4, 0x96, 0x2D, 0x9E, 0xC3, 0x73, 0x8B, 0x0C, 0x85, 0xDD, 0xE2,
+    0x9F, 0x75, 0xE6, 0xDE, 0xF0, 0x0B, 0xBA, 0x80, 0xCE, 0xB0, 0x2B, 0x1B, 0x83, 0x7C, 0x8A, 0xE9,
+    0x60, 0x4A, 0x19, 0xED, 0x83, 0x1B, 0xCE, 0xAB, 0xB7, 0xAD, 0x8D, 0x6E, 0x04, 0x10, 0xED, 0x23,
+    0x3B, 0xA4, 0xCB, 0x8A, 0xA4, 0xB9, 0x28, 0x0A, 0x3B, 0x79, 0x4B, 0x28, 0x5F, 0xD1, 0xF0, 0x25,
+    0xFF, 0x3D, 0xCB, 0x2D, 0x4D, 0xBB, 0x11, 0x3A, 0xBE, 0x93, 0xBF, 0x18, 0x3C, 0x12, 0x2B, 0xC7,
+    0xAF, 0xF7, 0x37, 0x8B, 0x16, 0x20, 0x69, 0x8D, 0x8E, 0x07, 0x43, 0x72, 0x1E, 0xB2, 0x00, 0xAA,
+    0x0C, 0x9E, 0x75, 0x1E, 0xA6, 0x14, 0x0E, 0xD9, 0xC9, 0xE7, 0x47, 0x3C, 0x51, 0x0C, 0x6C, 0x03,
+    0xFB, 0xB7, 0xEB, 0x1E, 0xE4, 0x3A, 0x23, 0x02, 0x3E, 0x2A, 0x54, 0x14, 0x03, 0x1F, 0xD6, 0xAD,
+    0x78, 0xBC, 0x2E, 0xE4, 0xF3, 0xCF, 0x1E, 0xB0, 0xF9, 0x5F, 0x0A, 0xB5, 0xAD, 0x4E, 0xAD, 0xDB,
+    0x04, 0xD0, 0x08, 0x09, 0x20, 0xAA, 0xBC, 0xC1, 0x6D, 0xB3, 0xEE, 0xE2, 0x90, 0x48, 0xFA, 0xEC,
+    0xE5, 0x1B, 0xFF, 0xE8, 0xB6, 0x7E, 0x20, 0xB7, 0xF5, 0xEC, 0x27, 0xDB, 0x06, 0xEB, 0xC1, 0x0F,
+    0xE4, 0xEC, 0xDD, 0x37, 0xC2, 0x5F, 0x1F, 0x8B, 0x9E, 0xBB, 0x28, 0x28, 0xF0, 0x71, 0x76, 0x5B,
+    0x07, 0x83, 0xAA, 0x42, 0x2D, 0x5D, 0xF1, 0x3D, 0x90, 0xBE, 0xFC, 0x2B, 0x56, 0xCF, 0xBE, 0x88,
+    0xEE, 0x3F, 0x12, 0xFD, 0xC7, 0xF3, 0xF6, 0xFD, 0x87, 0xB9, 0x4E, 0xF0, 0xCA, 0xB4, 0xC1, 0x56,
+    0x5D, 0x5C, 0x0B, 0x76, 0x54, 0x17, 0x00, 0x75, 0x2E, 0x9F, 0x79, 0x78, 0x8E, 0x75, 0xFB, 0x8B,
+    0x3D, 0x7B, 0x7E, 0x3D, 0xBA, 0xB6, 0x6B, 0xC3, 0x41, 0x10, 0xD2, 0x74, 0x62, 0x8A, 0x92, 0x9C,
+    0xAE, 0x65, 0x3B, 0xBA, 0xE0, 0xAD, 0xCA, 0xB9, 0x1B, 0x79, 0xE9, 0xCA, 0x56, 0x81, 0x25, 0xED,
+    0xEF, 0x43, 0x4A, 0x34, 0x8E, 0x57, 0x32, 0x41, 0x78, 0x04, 0x07, 0x9D, 0x04, 0x50, 0xE8, 0xDF,
+    0x20, 0xF5, 0xB2, 0x1B, 0x6B, 0xE3, 0x9A, 0xB5, 0xE9, 0x9C, 0xC4, 0x6D, 0xC0, 0x63, 0xF6, 0x51,
+    0x60, 0x4F, 0x97, 0x98, 0x70, 0xAE, 0x03, 0x0B, 0xE6, 0xE9, 0x69, 0xA6, 0x7E, 0xD9, 0x5B, 0xEC,
+    0xC4, 0xAD, 0xDD, 0xA8, 0x33, 0x1C, 0xF4, 0x53, 0x1A, 0xE8, 0x0D, 0x05, 0x74, 0xA3, 0xD1, 0x09,
+    0xE3, 0xAC, 0x80, 0xB8, 0x1E, 0x47, 0x1A, 0x44, 0xC2, 0x19, 0x2C, 0x82, 0xB2, 0xB1, 0xF4, 0xF9,
+    0x67, 0x19, 0x54, 0x2A, 0x6F, 0x95, 0x3A, 0x45, 0x6E, 0x3C, 0xF9, 0x93, 0x27, 0x39, 0xFA, 0x25,
+    0x79, 0x67, 0xBE, 0x42, 0x75, 0x30, 0xD8, 0x58, 0x1E, 0x66, 0x05, 0x76, 0xA2, 0x8E, 0xD2, 0xE8,
+    0x8D, 0xB1, 0xAA, 0x9E, 0x96, 0x78, 0x6E, 0xC0, 0x85, 0x27, 0xDE, 0x54, 0xDC, 0xD1, 0x94, 0x49,
+    0x5A, 0xEE, 0x1D, 0xA2, 0xB3, 0xEA, 0xF4, 0x26, 0xB2, 0x55, 0x96, 0x6E, 0x7B, 0xB6, 0xD4, 0xF3,
+    0x08, 0xF9, 0x98, 0xCD, 0x2E, 0xFB, 0x31, 0x12, 0x15, 0xAA, 0xE2, 0x75, 0xD6, 0x71, 0x83, 0xB5,
+    0x2C, 0xDC, 0x4B, 0xC0, 0xC5, 0x5F, 0xBA, 0xA7, 0x06, 0x16, 0x38, 0x7F, 0xB1, 0xA3, 0x61, 0x92,
+    0x36, 0x7C, 0x57, 0x01, 0x2B, 0x07, 0x39, 0x97, 0xCC, 0x84, 0x75, 0x39, 0xD1, 0x62, 0x1C, 0x22,
+    0xAC, 0xB1, 0x53, 0xEA, 0xAB, 0x23, 0xB0, 0x44, 0xAA, 0x13, 0xA3, 0xA0, 0x49, 0x95, 0x7B, 0xD6,
+    0x2D, 0xD2, 0x4A, 0x30, 0x4F, 0x11, 0x47, 0xB2, 0x76, 0xAA, 0x09, 0x14, 0xD0, 0x19, 0xAE, 0x97,
+    0x4E, 0xC6, 0x92, 0xDE, 0x05, 0xCF, 0x37, 0xFE, 0x59, 0xCE, 0xD5, 0x52, 0x66, 0x95, 0x52, 0xFB,
+    0xC5, 0x78, 0xE9, 0xEB, 0xE2, 0x61, 0x59, 0x55, 0xA4, 0xF3, 0x70, 0x71, 0x18, 0x2E, 0xDC, 0x28,
+    0x77, 0xA8, 0x01, 0xFC, 0x88, 0xB5, 0x38, 0x9F, 0x73, 0xD1, 0xFC, 0xFC, 0x2A, 0xF1, 0xD0, 0xA5,
+    0xE6, 0xE1, 0xF3, 0xAA, 0x98, 0xF9, 0x82, 0x26, 0x87, 0x67, 0x4A, 0x45, 0xFF, 0x71, 0xF1, 0xCC,
+    0x19, 0xEB, 0xF2, 0xA3, 0x3C, 0x39, 0xC6, 0x7C, 0x5A, 0xE4, 0xB2, 0x0B, 0x1C, 0x98, 0x27, 0x66,
+    0xDA, 0xFD, 0x11, 0x03, 0xFA, 0x90, 0x4D, 0xD4, 0x1A, 0xA7, 0x7C, 0x86, 0x0E, 0x8F, 0x4D, 0x93,
+    0x71, 0xD3, 0xDE, 0x78, 0x38, 0xBF, 0x00, 0x4D, 0xF8, 0x02, 0xAC, 0xF0, 0xB7, 0x88, 0x15, 0x4E,
+    0xD0, 0x60, 0xE1, 0x05, 0x2B, 0x38, 0x2A, 0xC3, 0x5C, 0xD8, 0x36, 0xE1, 0x50, 0x9C, 0xA9, 0x31,
+    0x44, 0xE0, 0x00, 0x06, 0x3C, 0x43, 0x4A, 0x1D, 0x02, 0xFA, 0xAF, 0x01, 0xFF, 0x1A, 0xE6, 0xAF,
+    0xC1, 0xFD, 0x1A, 0xD2, 0xEF, 0x08, 0xF2, 0x4B, 0x7C, 0xDF, 0x07, 0xC2, 0x0A, 0xA7, 0x16, 0xD6,
+    0x7B, 0x2D, 0x8C, 0x0A, 0x18, 0x75, 0xAF, 0x55, 0xEF, 0xD5, 0xAE, 0x63, 0x8D, 0xEB, 0x42, 0x4C,
+    0xF1, 0x8A, 0xB9, 0xB5, 0x69, 0x47, 0x7C, 0x5D, 0x22, 0xEB, 0x12, 0x53, 0x97, 0x98, 0x31, 0x44,
+    0xB4, 0x21, 0x82, 0xAE, 0x30, 0xC5, 0x75, 0xF0, 0x3C, 0xCE, 0x01, 0x07, 0x52, 0xEE, 0x85, 0x98,
+    0xE2, 0xFF, 0x08, 0xC6, 0xFE, 0x53, 0x82, 0xB1, 0x1F, 0xD9, 0x32, 0x47, 0x2E, 0x2D, 0x99, 0x33,
+    0xE7, 0xBB, 0xB4, 0x3E, 0x0E, 0x94, 0x9E, 0xD4, 0x9E, 0x0E, 0x4C, 0x0B, 0xFB, 0xF7, 0x3C, 0xB5,
+    0xE7, 0x97, 0x32, 0x23, 0x25, 0xE1, 0x10, 0xA8, 0x72, 0x2F, 0x3C, 0xFB, 0xC5, 0xFD, 0x1F, 0xE0,
+    0x37, 0xFF, 0x69, 0xF1, 0xEC, 0xB1, 0x92, 0xC9, 0x13, 0xA3, 0x67, 0x27, 0x83, 0xCB, 0xC4, 0x4C,
+    0xA9, 0x01, 0xFC, 0xBA, 0x29, 0x99, 0xE7, 0x9C, 0xEB, 0x31, 0x5E, 0x2F, 0x52, 0xB4, 0xE2, 0x51,
+    0xA1, 0xAE, 0x66, 0x4A, 0xCA, 0x76, 0xD2, 0x60, 0x06, 0xAF, 0x26, 0x41, 0x95, 0xCA, 0x9E, 0xBE,
+    0x7E, 0xD6, 0x01, 0xD1, 0x53, 0xC9, 0xBC, 0x11, 0x1D, 0x58, 0x71, 0x5C, 0x66, 0x5C, 0x64, 0x5C,
+    0x62, 0xD9, 0xDE, 0xDF, 0x1D, 0x2D, 0xAF, 0x5F, 0xEC, 0x89, 0xDB, 0x41, 0x09, 0x48, 0xE4, 0x86,
+    0x4B, 0xAD, 0x28, 0xDA, 0xCE, 0x47, 0x3F, 0x39, 0x99, 0x59, 0x8D, 0x30, 0xAA, 0x18, 0x72, 0xE7,
+    0x19, 0x98, 0x3B, 0x02, 0x07, 0x90, 0x4A, 0x24, 0x22, 0xCC, 0x34, 0xC1, 0x83, 0x87, 0x7C, 0xC9,
+    0x54, 0x69, 0x0C, 0x08, 0x56, 0x40, 0x97, 0xEB, 0xD8, 0x73, 0x1D, 0x7D, 0x09, 0xCF, 0xAE, 0x0E,
+    0x69, 0xCC, 0xA4, 0xBE, 0x16, 0x86, 0xAC, 0x27, 0x75, 0x2F, 0xE0, 0xEB, 0xE5, 0x13, 0x4C, 0x87,
+    0x69, 0xFA, 0xA6, 0x04, 0x5A, 0x99, 0xA4, 0xDC, 0xCA, 0x7F, 0x54, 0xAA, 0x1C, 0x37, 0x24, 0xDC,
+    0x75, 0x33, 0xAF, 0xB2, 0x9D, 0xC7, 0x38, 0x2E, 0x2C, 0x1B, 0x6D, 0xAA, 0x57, 0x64, 0x17, 0x8E,
+    0xD6, 0x6A, 0x67, 0xAC, 0x78, 0x26, 0x98, 0xCB, 0x69, 0x2B, 0xBF, 0xA2, 0xA4, 0x08, 0x71, 0x7D,
+    0xD0, 0x2C, 0x34, 0x3E, 0xBA, 0xC8, 0xE2, 0x4E, 0x39, 0x18, 0x04, 0xE3, 0xF7, 0x96, 0x04, 0x8D,
+    0x92, 0x4D, 0xAF, 0xBA, 0xDE, 0x5E, 0xC3, 0xEC, 0x99, 0xB6, 0xBC, 0x1A, 0x82, 0x07, 0x36, 0x9F,
+    0xEA, 0x28, 0x0C, 0xEA, 0xC7, 0xF4, 0xF3, 0x85, 0x3B, 0x4C, 0xB7, 0xD9, 0x1D, 0x04, 0xF7, 0x67,
+    0x99, 0x17, 0x4F, 0xEA, 0xF3, 0x3A, 0x4B, 0x29, 0x1C, 0xCE, 0xAA, 0x6A, 0x84, 0xA8, 0x38, 0x72,
+    0x17, 0xC6, 0xB5, 0x9C, 0xF7, 0x8D, 0x9D, 0x19, 0x7E, 0x1F, 0xE7, 0xFD, 0xC7, 0x63, 0xDE, 0x7F,
+    0x4A, 0x2E, 0xFF, 0x71, 0x5C, 0x05, 0x8F, 0x3D, 0xFB, 0xE4, 0x33, 0x82, 0x38, 0xD8, 0xC9, 0x61,
+    0xC3, 0x24, 0x19, 0x81, 0xAB, 0x35, 0x3C, 0x28, 0x3C, 0xAD, 0x48, 0xA5, 0x4B, 0xB3, 0xB0, 0xCF,
+    0xC7, 0x64, 0x15, 0x3C, 0xF6, 0xCC, 0x29, 0xC6, 0xEE, 0x35, 0x5A, 0x06, 0x33, 0xBF, 0x41, 0xC3,
+    0xB8, 0xDF, 0x30, 0x74, 0xC1, 0xDC, 0xF2, 0x28, 0xAB, 0x58, 0x60, 0x7A, 0x65, 0x9E, 0x8E, 0xF8,
+    0xB1, 0xE5, 0x05, 0x6E, 0xD9, 0x05, 0x33, 0x4B, 0x56, 0xD6, 0x52, 0x46, 0xD6, 0x73, 0x47, 0x36,
+    0xD6, 0x8A, 0x99, 0x1A, 0xAA, 0xFD, 0x61, 0xE9, 0xCF, 0x94, 0xAF, 0xB1, 0x60, 0xC5, 0xB7, 0x32,
+    0xB9, 0x74, 0x26, 0x80, 0xD2, 0xB9, 0x56, 0x0C, 0x90, 0x08, 0xEA, 0x5C, 0x6A, 0x3A, 0x92, 0xEF,
+    0x86, 0xE8, 0x89, 0x50, 0x49, 0x91, 0x1E, 0x64, 0x6A, 0x50, 0xCA, 0x3D, 0xF2, 0x7C, 0x71, 0x51,
+    0xC9, 0xCA, 0xFE, 0x28, 0x19, 0x68, 0x71, 0xA6, 0xF0, 0x91, 0x74, 0xA8, 0xD3, 0x2A, 0x4A, 0x1A,
+    0x60, 0x8A, 0x82, 0xBB, 0x25, 0x38, 0x1B, 0xEE, 0xF2, 0xF6, 0x91, 0xD9, 0x48, 0x2E, 0x5D, 0xF3,
+    0xFF, 0xD2, 0x56, 0x62, 0x02, 0x12, 0x6D, 0x24, 0x9A, 0x48, 0xCC, 0xF4, 0xA7, 0x7A, 0x42, 0x37,
+    0x28, 0xCA, 0xE1, 0xF6, 0x85, 0xD7, 0x70, 0x76, 0x05, 0x8A, 0xDC, 0xE9, 0xFB, 0xA0, 0xDB, 0x78,
+    0xE3, 0x5E, 0x77, 0xDB, 0xC5, 0xE9, 0xFD, 0x31, 0x31, 0x3F, 0x30, 0x88, 0xBC, 0x8B, 0x0A, 0x71,
+    0xA6, 0x78, 0xCC, 0x39, 0x51, 0x19, 0x4B, 0x71, 0x3C, 0x55, 0xC5, 0x60, 0x1E, 0x8A, 0x22, 0x53,
+    0xCB, 0xC5, 0x7B, 0x90, 0x5A, 0x8B, 0x33, 0x49, 0x33, 0xEF, 0x0F, 0x16, 0xEF, 0x6C, 0x7A, 0xC0,
+    0x31, 0xA5, 0x86, 0xE7, 0xCE, 0x14, 0xF9, 0x64, 0x02, 0x68, 0xA9, 0xCF, 0xA9, 0xF4, 0x19, 0x8B,
+    0x7C, 0xAC, 0xD2, 0xE7, 0x48, 0x4A, 0xF5, 0xEB, 0xC6, 0x96, 0xAA, 0x65, 0x3E, 0x4C, 0x37, 0xBD,
+    0xF9, 0xC4, 0x2F, 0x74, 0x89, 0x2B, 0x6B, 0x86, 0x81, 0x44, 0xA3, 0x6F, 0x3C, 0x98, 0xC2, 0x17,
+    0x5B, 0x1E, 0xA7, 0x08, 0xB4, 0x0E, 0xD8, 0x0D, 0x6B, 0x8B, 0x30, 0xF2, 0x1B, 0x59, 0x6B, 0x3A,
+    0x57, 0x48, 0xEA, 0xB4, 0xAC, 0xCE, 0xDE, 0xD0, 0x45, 0xA6, 0xB3, 0x59, 0x3B, 0x0B, 0x64, 0xF1,
+    0xE4, 0x0C, 0x27, 0x68, 0xAC, 0x85, 0xFB, 0x6B, 0x9D, 0xAD, 0xBE, 0xE4, 0x39, 0x21, 0x65, 0xAD,
+    0x1A, 0xE8, 0x5C, 0x89, 0xBA, 0x38, 0x6B, 0x74, 0x2F, 0x73, 0x3F, 0x17, 0x34, 0x12, 0xF0, 0x00,
+    0x68, 0x51, 0x24, 0xCE, 0x7A, 0x5A, 0xF4, 0x0A, 0x85, 0xBE, 0xA0, 0x53, 0x77, 0x89, 0x32, 0xB0,
+    0xB6, 0x10, 0xDC, 0x6E, 0xA3, 0x60, 0x8B, 0x60, 0x43, 0x09, 0xFE, 0x1A, 0xBB, 0x83, 0xC1, 0x33,
+    0xB0, 0x8D, 0x51, 0x6F, 0xBA, 0x39, 0xD9, 0xC6, 0xE8, 0xC2, 0x99, 0x00, 0xF7, 0x98, 0x3E, 0xB2,
+    0x38, 0x09, 0x73, 0x9D, 0x07, 0x0C, 0x1C, 0x9D, 0xC3, 0xED, 0x34, 0xF3, 0x3C, 0x61, 0x57, 0xB3,
+    0xBD, 0xB1, 0x36, 0x76, 0x57, 0x72, 0xA5, 0xE6, 0x3A, 0x1D, 0x2A, 0x63, 0xA7, 0xF7, 0xD2, 0x6D,
+    0x08, 0xC6, 0x3A, 0xBC, 0xC0, 0x73, 0x1C, 0x78, 0x10, 0xBA, 0x4E, 0x42, 0x50, 0xDB, 0x30, 0x8B,
+    0x4A, 0x19, 0xB1, 0x44, 0x34, 0xA2, 0x93, 0x1B, 0x59, 0xA5, 0x80, 0xC9, 0xE3, 0xF7, 0x57, 0x8A,
+    0xE9, 0xB0, 0x6A, 0xD8, 0x53, 0xF7, 0xC6, 0x6A, 0x1E, 0x40, 0xF9, 0x25, 0x63, 0x77, 0x9E, 0x6E,
+    0x83, 0x4B, 0x33, 0xB1, 0x2A, 0x0A, 0xBB, 0xE6, 0xE3, 0x6E, 0x3C, 0x5B, 0xFF, 0xC4, 0xFE, 0xFC,
+    0x56, 0xA9, 0x7C, 0xCD, 0x66, 0x4C, 0x98, 0x50, 0xC9, 0x69, 0x3A, 0xC7, 0x35, 0xF8, 0xC0, 0x71,
+    0x3F, 0x45, 0xAB, 0xDD, 0x0C, 0x1A, 0x20, 0x36, 0x04, 0x98, 0x83, 0x6D, 0x8D, 0xA5, 0xF4, 0x2B,
+    0xE5, 0x60, 0x85, 0xCB, 0x42, 0x19, 0x13, 0xFA, 0x52, 0x1E, 0xCD, 0x10, 0x16, 0x3F, 0x2A, 0x85,
+    0xC7, 0x98, 0x61, 0x14, 0x1E, 0x53, 0x22, 0x3D, 0x40, 0xE1, 0x71, 0x59, 0x9F, 0x5B, 0xC2, 0x63,
+    0x25, 0x3B, 0xCB, 0x27, 0xC6, 0x8E, 0xE6, 0x51, 0x34, 0x1D, 0xDD, 0x14, 0x3A, 0xBA, 0x9C, 0x30,
+    0x16, 0x03, 0x54, 0x0F, 0x0F, 0x4E, 0xEA, 0xCC, 0xD0, 0xC7, 0x39, 0x7E, 0x98, 0x86, 0x0D, 0x13,
+    0xF8, 0x9F, 0x20, 0xF4, 0x94, 0xEB, 0xC6, 0xB3, 0x1C, 0x45, 0x86, 0x62, 0xEE, 0x61, 0xB7, 0xDC,
+    0xF3, 0xC8, 0x8C, 0x75, 0xB3, 0xE9, 0x74, 0xFC, 0xAB, 0xAB, 0xB9, 0x35, 0x76, 0xA5, 0xCC, 0x76,
+    0xD7, 0xA6, 0x10, 0xC4, 0x4D, 0xD1, 0x85, 0x6C, 0x9C, 0x33, 0x65, 0x9F, 0xCA, 0xF5, 0x7A, 0xDC,
+    0xCA, 0xFD, 0xF3, 0xA9, 0xE8, 0xBF, 0x3B, 0xEC, 0xFC, 0xC1, 0x0C, 0x3B, 0x3D, 0x23, 0x0B, 0x33,
+    0xDC, 0xD8, 0x0C, 0xEF, 0x1F, 0x64, 0x86, 0x87, 0x83, 0x19, 0x8E, 0xC7, 0x03, 0x6C, 0x5D, 0xD8,
+    0x39, 0x61, 0xD7, 0x04, 0x89, 0x36, 0x96, 0x58, 0x89, 0xFC, 0x3F, 0x31, 0x69, 0xF8, 0xB2, 0x90,
+    0x4D, 0x05, 0xE8, 0x16, 0x25, 0x76, 0x1E, 0xB5, 0x4E, 0x52, 0xA1, 0xF3, 0xCF, 0xD5, 0x3A, 0x1D,
+    0xAA, 0x6C, 0x94, 0x56, 0x9C, 0x75, 0x0A, 0x9E, 0x50, 0x7D, 0x1D, 0x4C, 0x91, 0x7A, 0xC0, 0x19,
+    0x69, 0xC3, 0x8C, 0x5C, 0x71, 0xEE, 0xCD, 0x7C, 0x2C, 0x48, 0x0C, 0x57, 0x3B, 0x43, 0xE9, 0x60,
+    0x46, 0xB2, 0x9E, 0xF5, 0x54, 0xB5, 0x43, 0x12, 0xE4, 0x8E, 0xA9, 0xAC, 0x50, 0x99, 0xD2, 0x61,
+    0x7A, 0xDB, 0xFF, 0x03, 0xED, 0x9C, 0x31, 0x8F, 0x1C, 0x59, 0x11, 0xC7, 0x5F, 0x4F, 0xB3, 0x3B,
+    0x92, 0x27, 0x68, 0x82, 0x5B, 0x04, 0x76, 0xD0, 0x31, 0x4E, 0xFA, 0x1B, 0xB8, 0x9B, 0xBB, 0x2F,
+    0xB0, 0x42, 0x5E, 0x5D, 0x40, 0xEA, 0x00, 0x4C, 0xE0, 0x4F, 0x70, 0xEA, 0x11, 0x17, 0x9C, 0x04,
+    0x01, 0x1B, 0x91, 0x10, 0xB0, 0x81, 0x83, 0x63, 0x09, 0xEE, 0x0B, 0x70, 0xF4, 0x44, 0x10, 0x90,
+    0x8C, 0x90, 0x10, 0x01, 0xC9, 0x58, 0xF2, 0x91, 0x38, 0x60, 0x90, 0x06, 0x34, 0xF6, 0x75, 0xCF,
+    0xA3, 0xEA, 0xFF, 0xAF, 0xEA, 0xE9, 0x99, 0x5D, 0xC3, 0x5D, 0x80, 0xD9, 0x59, 0x7B, 0xB5, 0xF7,
+    0xDE, 0x9E, 0xB7, 0xA7, 0xFB, 0xBD, 0xFA, 0x55, 0xD5, 0xAB, 0xAA, 0xF7, 0x7A, 0x43, 0x08, 0xE3,
+    0x38, 0x0F, 0xF2, 0x95, 0xC5, 0x85, 0x76, 0x79, 0x5C, 0x6A, 0x57, 0xB2, 0xAB, 0xD9, 0xC5, 0xBF,
+    0x6B, 0x37, 0x8A, 0xBF, 0xD2, 0x2E, 0x8D, 0xF9, 0x4A, 0xBA, 0xC9, 0x06, 0x5D, 0xD6, 0xE6, 0x6B,
+    0xE9, 0x8A, 0x75, 0xA6, 0x5D, 0xB9, 0x44, 0xD7, 0x2C, 0xB2, 0x56, 0x3F, 0x36, 0xD3, 0x6E, 0x14,
+    0xA7, 0xDA, 0xA5, 0xB1, 0xD2, 0x6E, 0x12, 0x63, 0x6C, 0xF5, 0x31, 0x31, 0x76, 0xFA, 0x18, 0x74,
+    0xB5, 0x74, 0x1B, 0xB9, 0xFE, 0xD5, 0xE5, 0x67, 0x9B, 0x90, 0xC8, 0x78, 0x26, 0x1B, 0xB9, 0x7E,
+    0x26, 0x43, 0x93, 0xEF, 0x4A, 0xBB, 0x2C, 0xEA, 0x40, 0x43, 0xDE, 0xE9, 0x8D, 0x42, 0x89, 0xFB,
+    0x85, 0xFD, 0xAF, 0xE3, 0x29, 0xBA, 0x72, 0x85, 0xAE, 0x5E, 0xA3, 0x6B, 0xEC, 0xFF, 0x30, 0x91,
+    0x50, 0x60, 0xAE, 0xC9, 0xEF, 0xAA, 0xB3, 0x4A, 0x67, 0x2C, 0x37, 0x2F, 0xE3, 0x2B, 0x69, 0x65,
+    0x00, 0x51, 0x6E, 0xB9, 0x89, 0xFA, 0xC4, 0x79, 0xB9, 0x91, 0x5F, 0x56, 0x45, 0xA7, 0x8F, 0xCD,
+    0xDB, 0x20, 0x3F, 0x48, 0x2B, 0x0F, 0x2D, 0xA4, 0x5D, 0xCB, 0x5C, 0xB5, 0x95, 0xA7, 0xD4, 0x2B,
+    0xBD, 0xAD, 0xB4, 0x8D, 0xB6, 0x89, 0x08, 0xB0, 0x5E, 0xA7, 0x32, 0xFA, 0xB2, 0xCB, 0xB5, 0x95,
+    0x5B, 0xCE, 0x64, 0xA2, 0x1B, 0x69, 0xB3, 0xB8, 0x8E, 0x53, 0x91, 0x84, 0x3E, 0x30, 0x9C, 0x0C,
+    0x86, 0x7C, 0xB7, 0xC2, 0x18, 0x21, 0x7A, 0xC8, 0x3A, 0x31, 0x89, 0x63, 0x9C, 0x75, 0x65, 0x97,
+    0x1D, 0xB1, 0x8B, 0x9C, 0x8B, 0x8A, 0x4C, 0xBB, 0x0D, 0xBA, 0xD1, 0x4E, 0x77, 0xAF, 0xE5, 0x74,
+    0x17, 0xEC, 0xF8, 0xB9, 0xEF, 0x0E, 0xA5, 0x74, 0xF8, 0xBC, 0xB3, 0x0D, 0x27, 0x30, 0xDB, 0x4E,
+    0xA3, 0x18, 0xB4, 0xCD, 0x0C, 0xB3, 0xC4, 0x5C, 0x21, 0xB0, 0xE3, 0x8B, 0xFE, 0xA3, 0x37, 0x86,
+    0xBC, 0xE1, 0x0A, 0x13, 0xF0, 0x7A, 0xFC, 0x34, 0x5F, 0x00, 0x7E, 0x5B, 0x56, 0x18, 0x7C, 0xF7,
+    0x10, 0x70, 0xFE, 0xC9, 0x49, 0xD7, 0x73, 0x6A, 0xC2, 0x26, 0x14, 0xB3, 0x70, 0xCD, 0x97, 0x21,
+    0x75, 0x61, 0x38, 0x54, 0xA7, 0xEA, 0x58, 0x8D, 0xAB, 0x83, 0x75, 0xB2, 0x8E, 0xD6, 0xD9, 0x3A,
+    0x5C, 0xA7, 0xEB, 0x78, 0x8D, 0xAF, 0x03, 0x76, 0xC2, 0x8E, 0xD8, 0x19, 0x3B, 0x64, 0xA7, 0x6C,
+    0x98, 0x9D, 0xB3, 0x83, 0x76, 0xD2, 0x8E, 0xDA, 0x59, 0xEF, 0xC2, 0x3E, 0x39, 0xE5, 0x04, 0x64,
+    0xDA, 0xC9, 0x59, 0x88, 0x98, 0xE3, 0xC7, 0x2D, 0x1E, 0xF2, 0xFB, 0x73, 0xBD, 0xF7, 0x67, 0x3A,
+    0xE3, 0x74, 0x33, 0xD1, 0x09, 0x65, 0xCB, 0x54, 0x7F, 0x75, 0x54, 0x85, 0x87, 0x61, 0x8F, 0xB8,
+    0x21, 0x37, 0xE6, 0x84, 0x6E, 0xD4, 0x0D, 0xBB, 0x71, 0x37, 0xF0, 0x46, 0xDE, 0xD0, 0x1B, 0x7B,
+    0x83, 0x6F, 0xF4, 0x0D, 0xBF, 0xF1, 0x37, 0x05, 0x30, 0x0D, 0x30, 0x15, 0x30, 0x1D, 0x30, 0x25,
+    0x70, 0x2D, 0xE8, 0xD5, 0xA0, 0xA1, 0x79, 0xD7, 0x74, 0x5B, 0xC5, 0xEC, 0xF1, 0x53, 0x95, 0xE6,
+    0x33, 0x08, 0x33, 0xF9, 0x90, 0x56, 0x6E, 0x2A, 0x60, 0x1A, 0x70, 0xAD, 0x02, 0x1C, 0xAE, 0x41,
+    0x1F, 0x81, 0xEE, 0x04, 0x4A, 0x96, 0xB6, 0x02, 0x38, 0x84, 0x2E, 0x53, 0x49, 0xDD, 0x2F, 0x61,
+    0xDC, 0xA0, 0x4B, 0xB8, 0x64, 0x3B, 0x44, 0x7B, 0x63, 0x4C, 0xD9, 0xBD, 0x74, 0x43, 0x23, 0x0C,
+    0x3F, 0xA0, 0x11, 0x86, 0x14, 0xFD, 0xE5, 0x85, 0x2A, 0xAF, 0x7C, 0x6C, 0xFD, 0x11, 0x61, 0xB5,
+    0x8F, 0xC8, 0x75, 0x63, 0x9A, 0x0D, 0x2D, 0x48, 0xDE, 0x3A, 0xD3, 0xA6, 0x53, 0x9E, 0x40, 0xC9,
+    0x8F, 0x29, 0x8B, 0x07, 0x6A, 0xE4, 0x09, 0x94, 0xEB, 0x93, 0x85, 0x3E, 0xEC, 0x0F, 0x53, 0xD7,
+    0x81, 0x2E, 0xA3, 0x0E, 0xAC, 0x6F, 0xA4, 0x0E, 0x9C, 0x86, 0x53, 0xA0, 0x7A, 0x1F, 0x5E, 0x28,
+    0x02, 0x55, 0xF1, 0x19, 0x54, 0xF8, 0x41, 0xB2, 0x19, 0xE2, 0xE4, 0x0A, 0x9E, 0x42, 0xA8, 0x21,
+    0xFF, 0xB2, 0xA3, 0x6D, 0x47, 0x6A, 0x40, 0x39, 0xBD, 0x45, 0xB6, 0xED, 0x5F, 0xC5, 0x22, 0x47,
+    0xAC, 0xD2, 0xA8, 0x9A, 0xE8, 0xFD, 0xD2, 0x65, 0x21, 0x63, 0x4B, 0xAA, 0xA4, 0x82, 0x82, 0x71,
+    0x42, 0x3A, 0xF3, 0xA8, 0x73, 0x4D, 0x37, 0xB9, 0x92, 0x5E, 0x8D, 0x6F, 0x26, 0xE9, 0xCB, 0x4F,
+    0x31, 0x18, 0xFA, 0xE6, 0x71, 0xC4, 0xE8, 0xF3, 0x97, 0x18, 0xBE, 0xB8, 0xE8, 0x99, 0x0A, 0xB4,
+    0x2A, 0x64, 0x02, 0xC9, 0xC3, 0x90, 0x9C, 0xDE, 0x26, 0x8C, 0x5F, 0x3B, 0xC6, 0x0E, 0x77, 0x2E,
+    0xF5, 0xD2, 0x02, 0x56, 0xD0, 0xE8, 0x1C, 0x65, 0x6E, 0x2B, 0xB5, 0x78, 0x0D, 0x79, 0x8A, 0xA5,
+    0x06, 0x40, 0x27, 0x55, 0x38, 0xBB, 0x71, 0xEE, 0xFC, 0xAB, 0xC6, 0xE4, 0x81, 0xC2, 0x49, 0x19,
+    0x70, 0x4F, 0x70, 0xF9, 0x83, 0xFC, 0x03, 0xED, 0xCB, 0x90, 0xCD, 0x21, 0x88, 0x9A, 0x21, 0x2A,
+    0x63, 0x51, 0x2A, 0x4D, 0xE2, 0xCB, 0xC4, 0xAD, 0x31, 0xF3, 0x3B, 0x17, 0x0C, 0x5F, 0x3C, 0xE1,
+    0x48, 0x9F, 0xAD, 0xC5, 0x93, 0xA7, 0xFF, 0x38, 0xFF, 0x5C, 0xDA, 0xD5, 0xA8, 0x85, 0xE1, 0xAF,
+    0xDC, 0xC0, 0x43, 0x41, 0x87, 0x58, 0xFD, 0xB7, 0x98, 0x7C, 0xF4, 0x3F, 0x24, 0xDF, 0x5E, 0x25,
+    0xEF, 0x7E, 0xBA, 0x61, 0x87, 0x38, 0x3C, 0x3C, 0xC8, 0x3E, 0xBE, 0xCA, 0x33, 0x27, 0xCF, 0xC9,
+    0x2D, 0xE5, 0x79, 0x17, 0x16, 0x9E, 0x61, 0xE4, 0x63, 0x0C, 0xEE, 0xD9, 0x4A, 0x79, 0x2E, 0x1F,
+    0xF5, 0x3C, 0x47, 0x07, 0xC0, 0xD3, 0xBF, 0x72, 0xE2, 0xB9, 0x47, 0xDF, 0x94, 0x2C, 0xAF, 0xB1,
+    0xD6, 0xA3, 0xB7, 0x88, 0x6E, 0xB2, 0x66, 0x98, 0x48, 0xD9, 0x84, 0x7D, 0x9B, 0x9D, 0x1F, 0x16,
+    0xE3, 0x87, 0x08, 0xBC, 0xD2, 0xF8, 0x93, 0x15, 0xFD, 0xAC, 0x4A, 0x3B, 0xFF, 0x04, 0x4B, 0xCE,
+    0xDD, 0xF0, 0x58, 0xAF, 0x78, 0x2F, 0xE0, 0x92, 0x52, 0xF4, 0x57, 0xBB, 0x73, 0xA8, 0x43, 0x81,
+    0xE4, 0x4C, 0x25, 0x4B, 0xC6, 0xCF, 0xC3, 0xED, 0x0C, 0xBC, 0x90, 0xE9, 0x6A, 0xE0, 0xB5, 0xD1,
+    0xFB, 0x8D, 0x96, 0xF7, 0x56, 0xFD, 0xF4, 0x16, 0x22, 0x12, 0x21, 0x1D, 0x10, 0xB5, 0x23, 0x1C,
+    0xA5, 0xF4, 0x0A, 0xC4, 0x32, 0xE1, 0xF4, 0x86, 0x55, 0x4C, 0x4A, 0x1D, 0xB1, 0x2E, 0xBE, 0xF0,
+    0x4B, 0xE5, 0x17, 0xA8, 0xF1, 0xC8, 0xA7, 0xA6, 0xDB, 0xF5, 0x75, 0x64, 0xD5, 0xB1, 0x6F, 0xDC,
+    0x2E, 0x8C, 0x5F, 0x3B, 0xF0, 0x12, 0x45, 0xAF, 0x7B, 0xB4, 0x9B, 0x5F, 0x76, 0x30, 0xE5, 0x21,
+    0xE0, 0xEA, 0x2B, 0x99, 0xF2, 0x0D, 0x0D, 0xBC, 0x24, 0xE6, 0x56, 0x11, 0xA2, 0xCD, 0x70, 0xD3,
+    0xCC, 0x6E, 0xAD, 0xCA, 0x90, 0x23, 0x18, 0x2B, 0xD0, 0x96, 0x6C, 0x21, 0xA8, 0x7A, 0xB5, 0x95,
+    0x96, 0x5C, 0xB8, 0x46, 0xBB, 0x42, 0xBB, 0xD4, 0xE8, 0x44, 0xDA, 0x51, 0xFC, 0xF3, 0xD9, 0x29,
+    0xC0, 0xA8, 0xF8, 0xA7, 0x4C, 0x82, 0xFB, 0x42, 0x22, 0xF3, 0x94, 0xCC, 0x5A, 0x3C, 0x0A, 0xAD,
+    0x78, 0x12, 0xB9, 0x8A, 0x6D, 0x19, 0xE3, 0x3E, 0xB6, 0xE4, 0x82, 0xC9, 0x37, 0x46, 0xD5, 0x0D,
+    0xDA, 0x76, 0xBB, 0x0A, 0x85, 0x1F, 0xBF, 0xC4, 0xB4, 0x66, 0x7A, 0x9B, 0x25, 0x86, 0x27, 0xAA,
+    0x5C, 0xB6, 0xE3, 0x38, 0xCB, 0x5B, 0xC8, 0x5C, 0x14, 0xA3, 0x5C, 0x17, 0x6D, 0x22, 0xFF, 0x2A,
+    0xBF, 0x5D, 0x68, 0x33, 0x2D, 0x75, 0x16, 0x75, 0x7C, 0x55, 0x11, 0x3E, 0x26, 0x88, 0xB9, 0x96,
+    0xC2, 0x07, 0x03, 0xC2, 0x38, 0xD5, 0xB8, 0xA3, 0xEA, 0xE0, 0x73, 0xE4, 0x24, 0xF6, 0x75, 0xA7,
+    0x72, 0xA5, 0x89, 0xDB, 0x06, 0x49, 0x2B, 0x95, 0xEC, 0x24, 0xF4, 0xC2, 0x4F, 0x58, 0x8D, 0xE2,
+    0x6A, 0x98, 0x0E, 0x5A, 0xD6, 0x13, 0xB8, 0x3C, 0x32, 0x66, 0xFA, 0xD1, 0xC0, 0xEA, 0x0E, 0x03,
+    0x52, 0xBE, 0xF1, 0x0C, 0xA5, 0x80, 0x8E, 0x95, 0x68, 0xB4, 0xD6, 0xD8, 0x4C, 0x03, 0x2A, 0x1A,
+    0x41, 0xEB, 0x0E, 0xE1, 0xCE, 0xB9, 0x7F, 0xE2, 0x0D, 0xB3, 0x3A, 0xD5, 0x04, 0x38, 0xEB, 0x74,
+    0xD1, 0x2E, 0xE3, 0x8B, 0x95, 0x26, 0x52, 0x4A, 0x65, 0xF3, 0x44, 0x86, 0x9B, 0xC8, 0xA3, 0x2B,
+    0xBD, 0xE4, 0x9B, 0x07, 0x24, 0xF6, 0xF7, 0x74, 0x2B, 0x23, 0x11, 0x91, 0xA8, 0xE3, 0x7B, 0x89,
+    0x12, 0x91, 0xAA, 0x56, 0xFE, 0x17, 0x55, 0xB3, 0x12, 0xDB, 0x16, 0x27, 0x21, 0xD9, 0x1A, 0x90,
+    0xCA, 0x9B, 0x02, 0xA7, 0xC4, 0x39, 0x42, 0xC8, 0x3C, 0x40, 0xE8, 0xE6, 0x95, 0x20, 0xF6, 0x00,
+    0xB9, 0xE3, 0x59, 0x0B, 0xB4, 0xD3, 0x00, 0xD1, 0x53, 0xF6, 0xE6, 0x25, 0x39, 0x5D, 0x4E, 0x1D,
+    0xF2, 0x27, 0x00, 0x12, 0x30, 0x04, 0x64, 0x30, 0x30, 0x98, 0x11, 0x77, 0x5C, 0x50, 0xA9, 0xBC,
+    0xBC, 0xD0, 0x5A, 0xFD, 0x28, 0xAE, 0xD5, 0x21, 0x8D, 0x63, 0xFB, 0x70, 0x5B, 0xCD, 0x63, 0x31,
+    0xEF, 0xDA, 0x5A, 0x1E, 0xD9, 0x18, 0x1C, 0xE3, 0xE2, 0x1D, 0xC5, 0x65, 0x80, 0x8C, 0x90, 0x21,
+    0xB2, 0x81, 0xDA, 0xA8, 0xDD, 0xDF, 0x13, 0x93, 0x71, 0x22, 0x28, 0x23, 0x65, 0xA8, 0x8C, 0x95,
+    0xC1, 0x32, 0x5A, 0x86, 0xCB, 0x78, 0x19, 0x30, 0x23, 0xE6, 0x63, 0x20, 0x2D, 0xEF, 0x86, 0xC6,
+    0x72, 0xC2, 0x15, 0x43, 0x2F, 0x3A, 0x3A, 0x1B, 0xD1, 0x70, 0xB0, 0xBD, 0xD2, 0xC4, 0x9F, 0x4E,
+    0xF5, 0xF1, 0x88, 0x9E, 0xC7, 0x2D, 0x0C, 0x26, 0x5F, 0xE0, 0x57, 0x47, 0xC3, 0x40, 0xC2, 0x60,
+    0x1A, 0x4D, 0xC3, 0x69, 0x53, 0x21, 0x50, 0x23, 0xEA, 0x25, 0x78, 0x32, 0x35, 0xA8, 0x46, 0xD5,
+    0xB0, 0x1A, 0x57, 0x03, 0xEB, 0xEB, 0x9F, 0x09, 0xC9, 0x44, 0x46, 0xB8, 0x46, 0xD7, 0xF0, 0x3A,
+    0x5F, 0x03, 0xEC, 0x84, 0x59, 0x88, 0x67, 0x1D, 0xBE, 0x98, 0x5D, 0x8A, 0xD3, 0xCE, 0xFE, 0xA4,
+    0xF7, 0x4F, 0x3E, 0x64, 0xF5, 0x13, 0x74, 0x01, 0xF7, 0x2A, 0xDB, 0x1B, 0x6F, 0x74, 0x28, 0xB2,
+    0x83, 0xCA, 0x78, 0x7D, 0x74, 0x16, 0x92, 0xB6, 0x90, 0x7F, 0xFC, 0x61, 0x23, 0xD7, 0x82, 0x19,
+    0x88, 0x81, 0xD7, 0x80, 0xD6, 0x1B, 0x5F, 0x92, 0xAC, 0xAA, 0x62, 0xD9, 0x96, 0x55, 0xD0, 0x11,
+    0xF2, 0x5D, 0x5E, 0x3C, 0x41, 0x59, 0x6D, 0xFD, 0x39, 0x66, 0x8D, 0xEA, 0x79, 0xF1, 0x2F, 0x37,
+    0x37, 0x2B, 0x9D, 0x4F, 0x6F, 0x9B, 0xB9, 0x1D, 0x9F, 0x6F, 0x03, 0x87, 0x3B, 0x1C, 0xDA, 0x6F,
+    0xD5, 0xF0, 0x8E, 0xB5, 0x76, 0x16, 0x35, 0x5F, 0x6D, 0xE2, 0xCF, 0xF5, 0xF1, 0x6A, 0x75, 0x93,
+    0x56, 0x3D, 0x52, 0x01, 0x9B, 0x3B, 0x19, 0x9A, 0xDC, 0x8D, 0xF0, 0x9E, 0x28, 0x8E, 0xB3, 0x36,
+    0xCE, 0xD2, 0x38, 0x2B, 0xE3, 0xC3, 0xC2, 0x38, 0x0C, 0x5C, 0x7D, 0x69, 0x5F, 0x14, 0x47, 0x4D,
+    0xFC, 0x6A, 0x49, 0xFC, 0x50, 0x02, 0x8B, 0x7A, 0xFE, 0x40, 0x6E, 0xBC, 0xE9, 0x98, 0x5B, 0x8D,
+    0xE7, 0xB2, 0xAE, 0x25, 0x55, 0xE2, 0x11, 0x47, 0x1D, 0xA1, 0x3F, 0x62, 0x7B, 0x9D, 0x84, 0xEC,
+    0xC5, 0x62, 0xB2, 0xD4, 0x45, 0xEF, 0xFF, 0x64, 0x7B, 0xA8, 0x68, 0x8F, 0x22, 0x77, 0x7B, 0xE0,
+    0xD6, 0x5F, 0xEA, 0xCC, 0x9B, 0xB9, 0xA4, 0x58, 0x92, 0x86, 0x14, 0x0B, 0xBD, 0xF0, 0xA8, 0x3A,
+    0x30, 0x00, 0x5F, 0x23, 0xFC, 0xBE, 0x73, 0x09, 0xD3, 0x9B, 0xB1, 0xD6, 0x91, 0xC6, 0x27, 0x4B,
+    0xF9, 0x84, 0x64, 0x7A, 0xE5, 0x42, 0x02, 0xDD, 0x93, 0xD0, 0x6F, 0x41, 0xDC, 0xBC, 0x30, 0x1D,
+    0x8E, 0x5D, 0x65, 0x85, 0xF4, 0x36, 0x63, 0xF5, 0x83, 0xCB, 0xAF, 0x86, 0xB0, 0x33, 0xCD, 0xFF,
+    0x02, 0x52, 0x41, 0x21, 0x7C, 0xBE, 0x25, 0xB8, 0x52, 0x80, 0x4B, 0xD6, 0x4B, 0x32, 0x9D, 0x34,
+    0xC3, 0x7B, 0x3C, 0xA9, 0xE9, 0x1F, 0xA2, 0x8D, 0xA6, 0xAB, 0x82, 0x66, 0x66, 0x0D, 0xC0, 0x80,
+    0x0B, 0xB0, 0x4C, 0xA2, 0x43, 0xC1, 0x89, 0x8C, 0x4C, 0x6F, 0x02, 0x15, 0x80, 0x7C, 0xA1, 0x00,
+    0x35, 0xB3, 0x62, 0x90, 0x42, 0x16, 0x38, 0x63, 0xD3, 0x9F, 0xE3, 0xC8, 0xA1, 0x3C, 0xBA, 0xB0,
+    0x2F, 0x98, 0xC0, 0xCA, 0xB0, 0xC7, 0xF2, 0xEF, 0xBA, 0xE7, 0x7B, 0x6C, 0x63, 0x3E, 0x79, 0xC8,
+    0xBC, 0x57, 0x07, 0xA8, 0xE3, 0x83, 0x27, 0x5B, 0x60, 0x70, 0x89, 0x7C, 0x5C, 0x87, 0xA6, 0x23,
+    0xD3, 0xFF, 0x34, 0xA3, 0x9E, 0xD8, 0xCE, 0xA3, 0xDE, 0x5E, 0xC7, 0x84, 0xED, 0x7C, 0xEE, 0xE5,
+    0x43, 0xF6, 0xE5, 0xEA, 0x66, 0x89, 0x61, 0x7B, 0x46, 0x27, 0xE1, 0x8D, 0x67, 0x7D, 0x33, 0xED,
+    0xEB, 0xD2, 0xDF, 0xE1, 0x6F, 0x53, 0xCC, 0x95, 0xF3, 0x1D, 0xEE, 0x2C, 0xCA, 0xC2, 0x7E, 0xED,
+    0x5C, 0xEB, 0xA1, 0xD8, 0x16, 0xBD, 0xD8, 0x46, 0x83, 0xDB, 0xA4, 0xB6, 0x59, 0xBB, 0x2F, 0xB6,
+    0x61, 0xE1, 0xA1, 0x5C, 0xD2, 0x7C, 0xF1, 0xDF, 0x32, 0xEC, 0x2E, 0xB8, 0xF7, 0xB0, 0x3A, 0x26,
+    0x5C, 0xC3, 0x26, 0x0C, 0xD3, 0x0A, 0x1A, 0x78, 0x13, 0x5F, 0x88, 0x67, 0x49, 0xD4, 0x06, 0xD4,
+    0x17, 0x2E, 0x04, 0xB5, 0x5C, 0x31, 0xD5, 0xE7, 0x64, 0x7C, 0xA4, 0x3A, 0xC4, 0x09, 0x8B, 0x1E,
+    0xDB, 0x4E, 0xAB, 0x1B, 0xD2, 0xE9, 0xD3, 0xE4, 0xB2, 0x66, 0xD9, 0x77, 0x72, 0xB5, 0xC2, 0x17,
+    0x2B, 0xD6, 0x4E, 0xAE, 0xC6, 0x01, 0x8C, 0x35, 0xAE, 0x94, 0xE7, 0x89, 0x98, 0x53, 0xF9, 0x05,
+    0x2A, 0x16, 0x6A, 0xA7, 0x5F, 0x34, 0xB1, 0x82, 0x7D, 0x6D, 0xE8, 0xB9, 0x6C, 0x15, 0x9F, 0xA3,
+    0x14, 0xC4, 0x29, 0x9E, 0xED, 0x38, 0x8C, 0xA7, 0x61, 0xB0, 0x70, 0x67, 0xBB, 0x9D, 0x1D, 0xB3,
+    0x62, 0x80, 0x10, 0x9E, 0x3C, 0xC7, 0x5C, 0xE1, 0x76, 0xE6, 0x70, 0x64, 0x69, 0x7C, 0x15, 0xD7,
+    0x93, 0x38, 0x2B, 0xD5, 0x1B, 0x14, 0xAD, 0x0C, 0x35, 0x6F, 0x0B, 0x5D, 0x5B, 0x65, 0x98, 0x79,
+    0x2B, 0x30, 0xA4, 0x59, 0xC9, 0x2F, 0x04, 0x49, 0xD9, 0x0A, 0x93, 0x72, 0x8D, 0x62, 0x49, 0xB9,
+    0x96, 0x44, 0xBB, 0xEC, 0x26, 0x71, 0x0E, 0x97, 0x96, 0xE9, 0x60, 0x53, 0x5B, 0x77, 0x15, 0x7F,
+    0xBF, 0x9A, 0x1F, 0x57, 0x81, 0x20, 0xE8, 0x48, 0xB1, 0x64, 0x42, 0x4D, 0x0D, 0x46, 0x62, 0xA7,
+    0x49, 0x3A, 0x3B, 0x17, 0x60, 0xDD, 0xB4, 0x0F, 0xDB, 0xB5, 0x63, 0x60, 0xC2, 0xA9, 0x14, 0xEB,
+    0xB0, 0xDD, 0xB8, 0xB1, 0xE2, 0xCB, 0x6D, 0x43, 0xFA, 0xFA, 0x0C, 0x1F, 0x7E, 0xF3, 0x9A, 0x0C,
+    0xFF, 0xCD, 0x83, 0x25, 0x14, 0xFA, 0xEA, 0x70, 0xFF, 0x53, 0x1E, 0x87, 0x69, 0x36, 0xA8, 0x54,
+    0x8F, 0x62, 0x3C, 0xE1, 0x39, 0x89, 0x06, 0x04, 0xF3, 0xA5, 0xED, 0xB3, 0x55, 0xB6, 0x7A, 0xED,
+    0x7D, 0x11, 0x9C, 0x93, 0x73, 0x74, 0xCE, 0xCE, 0xE0, 0x39, 0x3D, 0xC7, 0xE7, 0xFC, 0x1C, 0xA0,
+    0x13, 0x74, 0x76, 0x7D, 0x6F, 0x10, 0x9D, 0xA2, 0x63, 0x74, 0x8E, 0x0E, 0xD2, 0x49, 0x3A, 0x4A,
+    0x67, 0xE9, 0x30, 0x9D, 0xA6, 0xE3, 0x74, 0x9E, 0x3D, 0x50, 0x27, 0xDA, 0x23, 0x1D, 0x32, 0xF5,
+    0x44, 0x74, 0xB6, 0x9F, 0x88, 0xD6, 0x96, 0x88, 0xF2, 0xFC, 0x5F, 0xF7, 0x1F, 0x12, 0xD1, 0x27,
+    0xCF, 0x19, 0x54, 0x40, 0x46, 0x25, 0x9F, 0xC5, 0x78, 0x1E, 0xAC, 0xF5, 0x57, 0xB3, 0x92, 0x89,
+    0xA8, 0x3A, 0x53, 0x10, 0x87, 0x5F, 0xD5, 0x12, 0x2D, 0xA8, 0xC3, 0xBB, 0xA2, 0x5B, 0xE1, 0x12,
+    0xB0, 0x87, 0xAB, 0x35, 0xAF, 0xAB, 0x53, 0x87, 0x06, 0xE8, 0x52, 0x3F, 0xD1, 0x27, 0x58, 0xC8,
+    0x9F, 0x71, 0xAA, 0xA9, 0xCD, 0xD4, 0x0C, 0xD4, 0xB4, 0xA1, 0x9C, 0x0D, 0x77, 0xD0, 0xB3, 0xE5,
+    0xFD, 0x4F, 0xB1, 0x7E, 0x37, 0x50, 0x8D, 0xEF, 0xDB, 0xCE, 0x14, 0x55, 0xC1, 0x34, 0xE1, 0x5A,
+    0x45, 0x38, 0x7C, 0xF3, 0xDD, 0x26, 0xAD, 0xE9, 0x20, 0x69, 0xAD, 0x91, 0xB4, 0x6A, 0x84, 0xD0,
+    0x5D, 0x93, 0xB4, 0xBE, 0x71, 0xCB, 0x35, 0x4C, 0x25, 0xAB, 0x0F, 0xDF, 0xA2, 0x3B, 0x4D, 0x56,
+    0xB0, 0x62, 0x9C, 0xE7, 0x6C, 0xBA, 0xA2, 0x82, 0x0D, 0x7F, 0x9B, 0xDC, 0x54, 0xDD, 0x8A, 0x65,
+    0x39, 0xDB, 0xEE, 0x64, 0xDC, 0x36, 0x6E, 0x57, 0x72, 0x57, 0xFE, 0xEE, 0xA3, 0xFD, 0xDC, 0xF5,
+    0x67, 0x95, 0xE5, 0xAE, 0x63, 0xE4, 0xAE, 0x34, 0xD3, 0x1D, 0x2B, 0x85, 0x8D, 0x4E, 0x3C, 0x2F,
+    0x9E, 0x9B, 0x81, 0xD2, 0x3E, 0x69, 0x9E, 0xB4, 0x4E, 0x1A, 0x27, 0x6D, 0x93, 0xA6, 0x49, 0xCB,
+    0xA4, 0x61, 0xD2, 0x2E, 0x69, 0x96, 0xB4, 0x4A, 0x1A, 0x25, 0x6D, 0x92, 0x26, 0x49, 0x8B, 0x4C,
+    0xBD, 0xA2, 0x34, 0xDD, 0x9A, 0x63, 0x78, 0x4F, 0xF7, 0x0F, 0x75, 0xAD, 0x68, 0x3D, 0x64, 0x94,
+    0x89, 0xBD, 0x40, 0xA0, 0x9D, 0x55, 0xF5, 0x30, 0x08, 0xAA, 0x5B, 0xFA, 0xDD, 0x0D, 0x17, 0x58,
+    0x1E, 0x0C, 0x22, 0xEA, 0xE6, 0xF6, 0xA2, 0x46, 0xAA, 0x5B, 0x0E, 0x52, 0xDD, 0x74, 0x2E, 0xB2,
+    0xDE, 0x49, 0x75, 0xAB, 0x3E, 0xD5, 0x95, 0x89, 0x2C, 0x26, 0xAB, 0x61, 0x85, 0xE2, 0x0D, 0x5B,
+    0xEC, 0xFD, 0x5F, 0x5B, 0x39, 0x87, 0x45, 0x1A, 0x6E, 0x1E, 0x76, 0xDC, 0x4A, 0x5C, 0xC2, 0x8A,
+    0xE5, 0xA3, 0x2B, 0x6C, 0x2B, 0x0F, 0x0F, 0x6F, 0xBD, 0x95, 0xF1, 0xED, 0x57, 0xCD, 0x8A, 0x6F,
+    0x60, 0x1C, 0x7C, 0xC9, 0xE3, 0xFE, 0x56, 0x93, 0xF3, 0xFA, 0x9B, 0xD7, 0xFB, 0xDC, 0x5D, 0x7B,
+    0x48, 0xAC, 0x33, 0xB9, 0xFB, 0x34, 0xF4, 0xD5, 0x3F, 0xA5, 0x2D, 0x03, 0x02, 0x6E, 0xB9, 0xAD,
+    0xF2, 0x7E, 0x26, 0x33, 0x53, 0xE0, 0x5F, 0xCA, 0x47, 0x9A, 0xF8, 0x1B, 0x1D, 0x99, 0x22, 0x2F,
+    0xE5, 0xD1, 0x64, 0xAE, 0x39, 0xE7, 0xEC, 0xB5, 0x11, 0xD4, 0xF8, 0x9A, 0x08, 0xAA, 0xBE, 0x26,
+    0x82, 0x52, 0x02, 0x8D, 0x45, 0x50, 0xCD, 0x75, 0x11, 0x14, 0x7F, 0x4E, 0x91, 0x2D, 0x77, 0xAF,
+    0x8F, 0xA0, 0x56, 0xA6, 0xAD, 0x33, 0x46, 0x50, 0x2F, 0xF7, 0x22, 0x28, 0xB3, 0x82, 0x86, 0xA0,
+    0xB9, 0x31, 0x6E, 0x15, 0x4B, 0x9E, 0xC6, 0xD5, 0x1A, 0xC2, 0xFD, 0x0B, 0x1C, 0xBF, 0xB4, 0xC2,
+    0xBA, 0x8E, 0x42, 0x40, 0xB3, 0xF2, 0xF3, 0x3E, 0x93, 0xD7, 0xBF, 0xDA, 0x46, 0x71, 0x07, 0x9F,
+    0x1C, 0x97, 0x70, 0xCA, 0x9B, 0x6A, 0x18, 0x33, 0x75, 0x6F, 0x24, 0x66, 0x12, 0x55, 0xF5, 0xCA,
+    0x06, 0x23, 0xC3, 0x91, 0x93, 0xF5, 0x04, 0xBB, 0xB4, 0x33, 0x3C, 0x99, 0x91, 0x97, 0x0F, 0xBE,
+    0x45, 0xC4, 0x93, 0x4B, 0xCB, 0xFD, 0xE6, 0x3D, 0x4B, 0x84, 0x21, 0x14, 0xC9, 0xDA, 0x0F, 0x31,
+    0x2A, 0x71, 0xB1, 0x85, 0x83, 0x20, 0xEE, 0xB9, 0xAE, 0x27, 0xBB, 0x9E, 0xED, 0xF6, 0xE9, 0x6E,
+    0x68, 0xA6, 0x3B, 0xB9, 0x95, 0x79, 0x3C, 0x4F, 0x79, 0xFB, 0x3D, 0x1C, 0x49, 0x7A, 0xDF, 0x2A,
+    0xDB, 0x1F, 0x24, 0xC5, 0x7E, 0x34, 0xD7, 0x12, 0xE3, 0xDE, 0x4A, 0x98, 0x82, 0x24, 0x14, 0xA4,
+    0x2D, 0x0A, 0x19, 0x1D, 0x82, 0x24, 0xC9, 0x87, 0xA1, 0x1E, 0xA7, 0x5C, 0x9E, 0xB2, 0x2E, 0x61,
+    0x11, 0x1A, 0x5B, 0xE7, 0xBE, 0x79, 0x6E, 0xDB, 0xE7, 0xF2, 0xD5, 0x8E, 0xA8, 0x1E, 0xBA, 0x85,
+    0xFE, 0x36, 0xA9, 0x01, 0x36, 0xE1, 0xB5, 0x0E, 0x58, 0xA0, 0x84, 0xD9, 0x35, 0xA1, 0x97, 0x28,
+    0x37, 0xE2, 0x43, 0x51, 0xD5, 0x4B, 0x21, 0x7E, 0x14, 0x92, 0x03, 0x21, 0x1E, 0xC2, 0xDB, 0x68,
+    0xC8, 0xE1, 0x91, 0xBD, 0x69, 0x64, 0xEE, 0x6D, 0x62, 0xEE, 0xCE, 0x42, 0xBA, 0xBE, 0xF7, 0xA0,
+    0x0E, 0xCB, 0xFF, 0xC5, 0xF0, 0xC8, 0xD8, 0xCD, 0xC7, 0xDA, 0x6F, 0x5D, 0xE4, 0xEB, 0x9D, 0x8D,
+    0xDA, 0x9D, 0xFD, 0xDA, 0x7C, 0xE1, 0xB3, 0x51, 0x4E, 0x18, 0x32, 0x42, 0x1B, 0x19, 0xB2, 0x96,
+    0xBB, 0x05, 0x8A, 0x56, 0xBC, 0x65, 0xBC, 0xDA, 0x15, 0x2D, 0x62, 0x43, 0x74, 0x53, 0xBD, 0x83,
+    0x06, 0x0E, 0xE5, 0xCA, 0x91, 0x1A, 0xC9, 0x8C, 0xF5, 0x2C, 0xAD, 0x84, 0xAB, 0x7A, 0x74, 0x58,
+    0x40, 0x8B, 0x16, 0x3B, 0x0E, 0xF2, 0x70, 0xBD, 0x51, 0xB9, 0xC6, 0x8D, 0xEA, 0x15, 0x6E, 0x24,
+    0x9D, 0xDE, 0xC8, 0xEE, 0x20, 0x9D, 0xAA, 0x8F, 0x44, 0xEC, 0x25, 0x8E, 0x02, 0xFE, 0x22, 0xB6,
+    0xCC, 0x1A, 0xB8, 0x0D, 0x8A, 0x57, 0x5D, 0xFA, 0xB3, 0x08, 0xAB, 0xB0, 0x73, 0xDA, 0x64, 0x9B,
+    0x44, 0xFB, 0x82, 0x65, 0xB3, 0xAD, 0xDB, 0xE1, 0x19, 0x40, 0x9E, 0x6C, 0x4E, 0xCE, 0xB4, 0xF8,
+    0x3F, 0xD6, 0xBC, 0x43, 0xBF, 0x65, 0xD8, 0xFA, 0xDD, 0xE9, 0x37, 0x77, 0x76, 0x0B, 0x4F, 0x8A,
+    0x79, 0x60, 0x8F, 0xA7, 0xF5, 0x4A, 0x9E, 0xD6, 0x5B, 0xEA, 0x4C, 0xE5, 0x5B, 0x66, 0xD8, 0x2C,
+    0x55, 0x52, 0x71, 0x31, 0x42, 0x3B, 0x96, 0x79, 0xC5, 0x85, 0x6A, 0x67, 0x5C, 0xD5, 0xB0, 0x98,
+    0x8D, 0xCE, 0x0D, 0x47, 0x76, 0x4A, 0xB1, 0x25, 0xD5, 0xB5, 0xEF, 0xC5, 0x10, 0x86, 0x6F, 0x5A,
+    0xF2, 0x00, 0xD8, 0xC8, 0x36, 0xEF, 0x66, 0x83, 0x16, 0x6F, 0xB8, 0x75, 0x7B, 0xEF, 0x32, 0xAF,
+    0x87, 0x2F, 0x31, 0xDB, 0xD6, 0x5D, 0xB2, 0xD3, 0xD9, 0xBB, 0xCC, 0x16, 0xB0, 0xF3, 0x44, 0x7E,
+    0xB8, 0x3F, 0x78, 0xE0, 0x2D, 0xE2, 0xCD, 0x8D, 0x49, 0xBE, 0x08, 0xC5, 0x97, 0x1F, 0xF1, 0xD2,
+    0xAB, 0xB5, 0x09, 0x44, 0xC8, 0x5D, 0x19, 0x16, 0x13, 0xEE, 0xF4, 0xC5, 0x87, 0x1B, 0xA2, 0x00,
+    0x9E, 0x76, 0xF5, 0x79, 0x57, 0xEF, 0x7D, 0xFC, 0x88, 0x45, 0xFF, 0x56, 0x7A, 0x1F, 0x96, 0xE1,
+    0xD3, 0xA3, 0xCB, 0xB0, 0x8D, 0xDF, 0xE5, 0x8A, 0x71, 0x9C, 0x38, 0x53, 0x30, 0x51, 0xAA, 0xE0,
+    0x30, 0xE7, 0x56, 0x5D, 0xC2, 0xED, 0x66, 0x6E, 0x62, 0xE5, 0x2C, 0xDD, 0xE8, 0xC6, 0xDA, 0x82,
+    0x9A, 0x06, 0x8F, 0x60, 0x84, 0xB7, 0x6E, 0x9A, 0x65, 0xEB, 0x65, 0xD8, 0x3A, 0x68, 0x27, 0xCD,
+    0xC4, 0x90, 0xA7, 0xDC, 0x49, 0x3B, 0x38, 0xEF, 0xE0, 0xC4, 0x61, 0x72, 0xDC, 0x95, 0xAE, 0x97,
+    0x96, 0x67, 0xD4, 0x4B, 0xCB, 0x2C, 0x8D, 0x3C, 0x3E, 0x65, 0x9B, 0xDE, 0x42, 0x9F, 0x6F, 0x5B,
+    0x46, 0x8B, 0x38, 0x32, 0xF7, 0xE4, 0x69, 0x34, 0x85, 0x17, 0x51, 0x9A, 0x30, 0x06, 0x7A, 0x70,
+    0xD7, 0x44, 0x61, 0xE6, 0x1E, 0xEC, 0xDD, 0xCE, 0x91, 0x49, 0xD4, 0xF6, 0x6D, 0x82, 0xD6, 0x28,
+    0x2E, 0xCF, 0x91, 0xA0, 0x25, 0x16, 0xBC, 0xE9, 0x25, 0x67, 0x55, 0x72, 0xF6, 0x41, 0x9C, 0xCA,
+    0x14, 0x46, 0xF1, 0x8F, 0x7A, 0x16, 0x7F, 0x96, 0xD2, 0x89, 0x4F, 0xD3, 0x88, 0x55, 0xAE, 0x1A,
+    0x47, 0x6E, 0x91, 0x4E, 0x74, 0x78, 0xE3, 0xC8, 0xF0, 0x6E, 0x62, 0x3D, 0xB5, 0x26, 0x98, 0xDE,
+    0x04, 0xAB, 0xAA, 0x05, 0xD3, 0x9A, 0x60, 0xD5, 0x34, 0xC8, 0xA4, 0x61, 0xCF, 0x13, 0xA2, 0xE5,
+    0x3A, 0x65, 0xDF, 0x61, 0x1F, 0x57, 0x57, 0x90, 0x86, 0x15, 0x88, 0x8D, 0xBD, 0xFE, 0xD4, 0xDA,
+    0x1B, 0xB0, 0x0B, 0x6A, 0x74, 0x7F, 0xE4, 0xD7, 0x13, 0xB7, 0x3E, 0x45, 0xF7, 0x3C, 0x74, 0x90,
+    0xBB, 0x99, 0x15, 0x6C, 0x7D, 0x3C, 0x82, 0xFF, 0x77, 0x3A, 0xD3, 0xBF, 0x90, 0x78, 0x11, 0x86,
+    0x69, 0x9D, 0xAF, 0x0D, 0x56, 0x7E, 0xD5, 0x7D, 0x90, 0xED, 0xEB, 0x4D, 0xAA, 0x33, 0x12, 0xFC,
+    0x1D, 0xB4, 0xCE, 0xF8, 0xF2, 0xD1, 0x2F, 0x20, 0xFD, 0x12, 0xD2, 0x2F, 0x22, 0xFD, 0xFA, 0x31,
+    0xF8, 0xE1, 0x9E, 0xAF, 0x3E, 0x5E, 0xFD, 0xF1, 0xE5, 0x04, 0x0B, 0xCA, 0x3B, 0x75, 0xDA, 0x2F,
+    0x4F, 0x6F, 0x23, 0xC9, 0x85, 0xF5, 0x26, 0xB7, 0x7C, 0xAF, 0xAF, 0xE7, 0x3B, 0x86, 0xAB, 0x2F,
+    0x68, 0xAB, 0x9A, 0x8D, 0x2E, 0x0E, 0x5B, 0xCD, 0x12, 0x4B, 0x21, 0x65, 0xFD, 0xB4, 0xE0, 0x59,
+    0x92, 0x48, 0x0B, 0x99, 0x4D, 0xA0, 0x9A, 0x46, 0x32, 0x57, 0x5E, 0x7B, 0x79, 0x41, 0x13, 0xC9,
+    0x77, 0xBA, 0xD4, 0x6F, 0xD4, 0xDA, 0xB1, 0x31, 0xC9, 0x33, 0x19, 0x12, 0x6E, 0x1A, 0xDF, 0x93,
+    0xC6, 0x4D, 0xFE, 0x66, 0x6F, 0xC1, 0x4F, 0x8B, 0x95, 0xEA, 0x8C, 0x26, 0x9B, 0x87, 0xED, 0x9A,
+    0xC2, 0x3B, 0x4F, 0x72, 0xD5, 0x93, 0x24, 0x7E, 0xB2, 0xC2, 0xEB, 0xEF, 0x7D, 0x74, 0x73, 0xCD,
+    0x0F, 0xBB, 0x7B, 0xD9, 0x97, 0xE7, 0xE6, 0xC4, 0x0F, 0x5C, 0x29, 0xB6, 0xE9, 0x5C, 0xBF, 0x3C,
+    0xDB, 0xFB, 0x5B, 0x5E, 0x85, 0xF7, 0x74, 0xDC, 0xB7, 0x94, 0xC3, 0xB1, 0x6E, 0xBF, 0x18, 0x25,
+    0x62, 0xB4, 0xB3, 0xD1, 0xAC, 0xDB, 0x66, 0xAB, 0xDD, 0x34, 0xB9, 0xD6, 0x03, 0x94, 0x73, 0x64,
+    0x24, 0x53, 0x19, 0x3B, 0x33, 0x75, 0xBE, 0xA9, 0x25, 0x4F, 0xCA, 0x3A, 0x66, 0x36, 0x23, 0xBC,
+    0x7C, 0x36, 0x86, 0x7C, 0x32, 0x1C, 0xD7, 0x2D, 0x70, 0x08, 0xA4, 0xC1, 0x09, 0x7C, 0x3B, 0xD5,
+    0x8C, 0xBF, 0xBB, 0x62, 0x7F, 0x8F, 0x01, 0x8F, 0x6D, 0xB7, 0x27, 0x38, 0x39, 0x4A, 0x86, 0x1A,
+    0x24, 0x0E, 0x34, 0x04, 0x44, 0x25, 0x1B, 0xBD, 0xE6, 0x04, 0x67, 0x1F, 0xED, 0x59, 0xAC, 0xE7,
+    0x0B, 0x86, 0xC5, 0x79, 0xB6, 0x8C, 0x58, 0x8C, 0x37, 0xCC, 0xFF, 0x4F, 0x4E, 0x71, 0xB8, 0xAD,
+    0x64, 0x9A, 0xA5, 0x05, 0x86, 0x0E, 0x69, 0xB1, 0xEA, 0x4C, 0x41, 0x4C, 0x32, 0x4B, 0x1D, 0x7C,
+    0xDE, 0x42, 0x52, 0x59, 0x8B, 0xA7, 0x67, 0x2D, 0x1E, 0x9C, 0xB5, 0x54, 0x80, 0x0E, 0xBC, 0x27,
+    0x1D, 0x2D, 0xAA, 0xC3, 0x4C, 0xD2, 0xAE, 0xE1, 0x5F, 0x0F, 0xB2, 0x31, 0x47, 0xCA, 0xDC, 0xDE,
+    0x26, 0xE4, 0xFB, 0xBF, 0xB1, 0xDD, 0x1E, 0x50, 0xF6, 0x80, 0xDC, 0x14, 0xD2, 0x4E, 0x7B, 0xDB,
+    0x84, 0xF8, 0x8A, 0xEC, 0x63, 0x5E, 0xDF, 0x44, 0x2B, 0x38, 0xF2, 0xF5, 0x28, 0x3B, 0x8B, 0xF5,
+    0xFC, 0x60, 0x58, 0xED, 0x9B, 0xEF, 0xF0, 0x08, 0x6D, 0x79, 0xF5, 0x08, 0xED, 0x01, 0x30, 0x42,
+    0x11, 0xA9, 0xD8, 0x68, 0x11, 0x49, 0x18, 0xA1, 0x2A, 0xC7, 0x77, 0x4E, 0x84, 0x91, 0x3E, 0x4F,
+    0x18, 0xA9, 0xF2, 0xD5, 0xCF, 0x77, 0xC2, 0x4C, 0xDE, 0x92, 0x8F, 0xA1, 0xAF, 0x1B, 0x0D, 0x5A,
+    0xD6, 0x27, 0x98, 0xD4, 0xD6, 0x7B, 0x7F, 0x68, 0xED, 0x90, 0x28, 0xEF, 0xFD, 0x59, 0xB9, 0x18,
+    0x06, 0xAF, 0x88, 0xDB, 0x21, 0x53, 0x4B, 0x23, 0xFC, 0xED, 0xD3, 0xAB, 0xA5, 0x98, 0x5B, 0x67,
+    0xA6, 0xB6, 0x8B, 0x30, 0xD9, 0x04, 0x14, 0x72, 0x5E, 0xB4, 0xF0, 0xFA, 0xBA, 0xE7, 0xFF, 0x44,
+    0x05, 0xDD, 0x62, 0x87, 0xE4, 0xE1, 0xF6, 0x6D, 0xE3, 0x43, 0x00, 0x6E, 0x51, 0x6D, 0xC6, 0x98,
+    0xD6, 0xB6, 0x45, 0x2C, 0x9E, 0x65, 0x34, 0x6B, 0x2F, 0x15, 0x0E, 0xDF, 0x2A, 0xBC, 0x85, 0x6C,
+    0xFF, 0x0D, 0xCD, 0x59, 0x3F, 0xAC, 0xDD, 0x56, 0x19, 0xFF, 0x6C, 0xF7, 0xBD, 0x2B, 0x6A, 0x09,
+    0x77, 0xE8, 0x1B, 0x4A, 0x21, 0xCE, 0xC0, 0x80, 0x22, 0xB5, 0x66, 0xEC, 0x90, 0xE6, 0xB8, 0x64,
+    0xE8, 0xC0, 0xD0, 0x37, 0xE4, 0x4E, 0x0C, 0x61, 0x00, 0xA9, 0x3C, 0x24, 0xD2, 0xA5, 0x52, 0x84,
+    0xA2, 0xDA, 0x90, 0x81, 0x31, 0x6F, 0x43, 0x62, 0x21, 0x43, 0x07, 0xB8, 0x45, 0x4D, 0x87, 0x0E,
+    0x54, 0x4A, 0x65, 0x87, 0x8E, 0x2C, 0x96, 0xAA, 0xEE, 0x06, 0x45, 0x42, 0xEA, 0x52, 0x03, 0x6E,
+    0xE5, 0x06, 0x5F, 0x1F, 0x7E, 0xBF, 0xEF, 0xD8, 0xBE, 0xF7, 0xBE, 0x3C, 0xA5, 0x89, 0xFA, 0x86,
+    0xDE, 0xEB, 0xFB, 0xF9, 0xDF, 0x39, 0xDF, 0xFF, 0x7F, 0xE7, 0x5C, 0x39, 0x14, 0x79, 0x5F, 0xE4,
+    0x05, 0x39, 0xBA, 0x93, 0x5A, 0x9B, 0x37, 0xE7, 0xA4, 0xB9, 0x2E, 0xCD, 0x6D, 0x69, 0xE4, 0xEB,
+    0x1E, 0xB7, 0x45, 0xBC, 0x54, 0x16, 0xB9, 0x9C, 0x13, 0x79, 0x6B, 0x95, 0x16, 0xB6, 0x7C, 0x21,
+    0x28, 0xC3, 0xCB, 0xA5, 0x7F, 0xB3, 0x94, 0xE0, 0xEB, 0x1F, 0xF9, 0xDE, 0xF2, 0x4A, 0x62, 0x7B,
+    0xC3, 0xA3, 0x33, 0xB6, 0x3D, 0x58, 0x1E, 0x3E, 0xFC, 0x44, 0xF8, 0x31, 0xD6, 0xF2, 0x91, 0xB5,
+    0x5D, 0x06, 0xD0, 0x16, 0x00, 0x8D, 0xEC, 0x7C, 0x12, 0xEB, 0x3E, 0xFD, 0x7C, 0x61, 0xC6, 0x8B,
+    0x6E, 0xBA, 0x68, 0xE7, 0xC1, 0x07, 0xB2, 0x77, 0x58, 0xA4, 0x51, 0xF3, 0x4D, 0xFA, 0x1D, 0xC9,
+    0xFE, 0x6D, 0x65, 0x2E, 0x06, 0xAB, 0x39, 0xA5, 0x48, 0x0F, 0x96, 0xCB, 0xE5, 0x96, 0x88, 0x10,
+    0x7D, 0x10, 0x88, 0xBE, 0x16, 0x3C, 0xBF, 0x82, 0xFB, 0x5C, 0x6C, 0xEE, 0x59, 0x09, 0xAC, 0x84,
+    0x6B, 0x89, 0x7A, 0x49, 0x3A, 0x31, 0x8D, 0x14, 0x8D, 0x2C, 0x53, 0xC1, 0xCF, 0xB7, 0x65, 0x60,
+    0xD3, 0x85, 0x95, 0xC8, 0xBD, 0x6D, 0xC5, 0xD4, 0x92, 0x95, 0x52, 0xA4, 0x52, 0x94, 0x16, 0xDF,
+    0xA2, 0xCC, 0xF0, 0x35, 0xF8, 0x26, 0xD5, 0x5E, 0x8A, 0x19, 0x9C, 0x73, 0x8F, 0xB3, 0x2E, 0xDB,
+    0x7C, 0x61, 0x03, 0xCE, 0x0C, 0x07, 0xCC, 0xD5, 0xD9, 0x31, 0xE7, 0x27, 0x0D, 0x30, 0x98, 0x0A,
+    0x38, 0x40, 0xDD, 0x34, 0x9B, 0x6F, 0x82, 0x6F, 0xAC, 0xBF, 0xB8, 0x89, 0xF8, 0x6D, 0xA3, 0x36,
+    0xC4, 0xD7, 0x3B, 0xF4, 0x60, 0xC2, 0x15, 0x18, 0xF2, 0xAD, 0x02, 0x19, 0x41, 0xB0, 0x26, 0xE8,
+    0x47, 0xF0, 0x54, 0xD0, 0xEE, 0xA9, 0x0D, 0x69, 0xEA, 0xC1, 0x81, 0xEC, 0xCE, 0x03, 0x8C, 0x89,
+    0x2A, 0xEA, 0xA4, 0xA4, 0x89, 0x09, 0x8C, 0x82, 0x5C, 0x54, 0x7C, 0xA1, 0x2C, 0x22, 0x44, 0xA7,
+    0xC0, 0x53, 0xC4, 0x0A, 0x06, 0x80, 0x05, 0x49, 0x84, 0x04, 0x51, 0x3F, 0x81, 0xB8, 0x57, 0x5D,
+    0x3E, 0xFD, 0x36, 0x1F, 0x74, 0x7C, 0x40, 0xB7, 0x88, 0xE9, 0x4D, 0x71, 0x4D, 0x22, 0x95, 0xA3,
+    0xE4, 0xD9, 0xE2, 0xB3, 0xD6, 0xA7, 0xD7, 0x04, 0x74, 0x36, 0x05, 0x9E, 0x14, 0x13, 0x25, 0x7F,
+    0x97, 0x92, 0x93, 0x03, 0xE8, 0x2E, 0xFC, 0xFE, 0xCB, 0x23, 0xF5, 0x56, 0x67, 0xAD, 0x8C, 0xD6,
+    0xFA, 0xF9, 0x6B, 0xFF, 0x78, 0x1D, 0xD8, 0xAB, 0x09, 0xBB, 0x21, 0xC8, 0x28, 0x47, 0x41, 0x60,
+    0x09, 0x96, 0x12, 0xDA, 0x32, 0xB6, 0x8D, 0xA1, 0x87, 0xF7, 0xF3, 0xA1, 0x81, 0xD0, 0x46, 0xB6,
+    0x56, 0xE5, 0x89, 0x47, 0xCA, 0x98, 0x1D, 0xB4, 0x4E, 0x7F, 0x0B, 0x9B, 0x63, 0x5E, 0x2D, 0x91,
+    0xED, 0xF1, 0x83, 0xB9, 0x40, 0x2D, 0xB6, 0x95, 0x24, 0x78, 0x07, 0x5B, 0xCB, 0x25, 0x8C, 0x3F,
+    0x3F, 0x7A, 0xCF, 0x7E, 0x9D, 0x74, 0x59, 0x5F, 0xF4, 0x45, 0x67, 0x9A, 0xBD, 0x74, 0x51, 0x4B,
+    0x92, 0x9A, 0x4E, 0x6C, 0x95, 0xF5, 0xBE, 0xAD, 0x8B, 0x3E, 0x00, 0xE8, 0x02, 0xDC, 0x36, 0x9E,
+    0xCD, 0xE1, 0x0C, 0xCF, 0x8A, 0x7F, 0x3F, 0xEE, 0xCD, 0x1A, 0xDF, 0x3E, 0x69, 0xF7, 0xD2, 0xA3,
+    0x55, 0x6E, 0x6D, 0xF9, 0xF5, 0x53, 0xCA, 0x7C, 0xBC, 0x07, 0xAF, 0x58, 0x21, 0x5F, 0x9D, 0x49,
+    0x26, 0xD9, 0xA4, 0x94, 0x0C, 0x22, 0x9C, 0x76, 0x9C, 0x09, 0xD3, 0xC0, 0xF3, 0xEB, 0x55, 0xFE,
+    0x86, 0xC8, 0x7C, 0xBC, 0xB9, 0x4C, 0xCF, 0x10, 0xF9, 0x85, 0x15, 0x8C, 0xBB, 0x39, 0x0E, 0x96,
+    0x67, 0xC6, 0xF9, 0xF6, 0x27, 0x83, 0x9F, 0x46, 0xFA, 0x08, 0xFE, 0xED, 0x1C, 0x85, 0xAE, 0x64,
+    0x53, 0xE7, 0x8F, 0x12, 0x0D, 0xB6, 0xD4, 0x48, 0x82, 0xBF, 0xB6, 0x45, 0xA9, 0x81, 0xCA, 0x61,
+    0x59, 0xA9, 0x01, 0x03, 0x04, 0x55, 0x51, 0x26, 0x0E, 0x67, 0xA1, 0x49, 0x64, 0xBC, 0x44, 0x4E,
+    0x49, 0xF5, 0xD2, 0xE6, 0xF6, 0xB7, 0x83, 0x23, 0x66, 0x7F, 0x63, 0x5F, 0xED, 0xE1, 0x4F, 0xDE,
+    0x15, 0xB1, 0x37, 0x6D, 0xD4, 0xD8, 0x0E, 0x1E, 0x9A, 0xDA, 0xBF, 0xAF, 0xCD, 0xC7, 0x20, 0x5E,
+    0xD0, 0x36, 0x7D, 0x71, 0xCB, 0xDA, 0x57, 0x2C, 0x9D, 0xFF, 0xDF, 0x36, 0xF9, 0x12, 0xC3, 0xAE,
+    0x35, 0x91, 0xFD, 0xA8, 0x37, 0xB5, 0xFD, 0xDD, 0x3A, 0x6A, 0xBD, 0x3F, 0x47, 0x6D, 0x56, 0xD9,
+    0x5B, 0x7D, 0x04, 0xAF, 0x4F, 0x6A, 0x90, 0xB9, 0xD5, 0x31, 0x68, 0xB3, 0x12, 0x64, 0xFE, 0xD8,
+    0x32, 0x74, 0x2D, 0x29, 0x5E, 0x45, 0xF6, 0x61, 0x54, 0x00, 0x55, 0x82, 0x84, 0x24, 0x21, 0xBC,
+    0xFB, 0x47, 0xBC, 0xAC, 0x18, 0xDE, 0xF6, 0xD5, 0x21, 0x69, 0x20, 0x1F, 0xF2, 0x87, 0xFD, 0xAC,
+    0x8F, 0x1F, 0x20, 0x72, 0x28, 0x30, 0x83, 0xCB, 0x8A, 0x3F, 0xB0, 0xC4, 0xD4, 0x21, 0xC2, 0x68,
+    0x81, 0x48, 0x8E, 0x2C, 0xF2, 0x60, 0xED, 0xF8, 0x3F, 0x64, 0xB5, 0x38, 0xF9, 0xD9, 0x68, 0x70,
+    0x57, 0x89, 0xBB, 0x7A, 0xDC, 0x55, 0xE5, 0xAE, 0x36, 0x77, 0x15, 0xBA, 0xAB, 0xD3, 0x5D, 0xB5,
+    0xEE, 0x6A, 0x76, 0x57, 0xB9, 0xBB, 0xFA, 0x05, 0xA3, 0x5B, 0x2A, 0xF6, 0x6D, 0xB3, 0xA5, 0xE5,
+    0x48, 0xD3, 0xC9, 0x46, 0xD1, 0xEB, 0x2D, 0x5D, 0x67, 0xFF, 0x1A, 0xB6, 0xD4, 0x6D, 0xFF, 0x66,
+    0x37, 0x1A, 0xFF, 0x1C, 0x1A, 0xDC, 0x28, 0xFD, 0x0B, 0xCB, 0xB4, 0x37, 0xE9, 0xFD, 0x3F, 0x96,
+    0xA9, 0x6F, 0x52, 0xFD, 0x7F, 0x07, 0xDC, 0xCD, 0xDA, 0xC7, 0xDD, 0x7A, 0x63, 0x80, 0x8F, 0xD7,
+    0x61, 0xBF, 0xB1, 0xC1, 0x47, 0x03, 0xA4, 0x9E, 0xCD, 0x70, 0xD3, 0xA2, 0x5E, 0xCD, 0x96, 0x80,
+    0x2E, 0xEB, 0x2D, 0x63, 0xA0, 0x10, 0x6E, 0xD9, 0xC3, 0xAC, 0xB7, 0x4D, 0x82, 0xC6, 0x44, 0x62,
+    0x2D, 0x78, 0x59, 0x05, 0x1E, 0xC0, 0x99, 0x23, 0x09, 0x3A, 0x40, 0x9E, 0xE9, 0x5B, 0xE4, 0x7E,
+    0xD3, 0x80, 0x5A, 0x56, 0x61, 0x98, 0xCD, 0xB3, 0xCA, 0x27, 0xBB, 0xC1, 0x1A, 0x26, 0x09, 0xBB,
+    0x80, 0x3C, 0x85, 0x64, 0x05, 0xA6, 0xCC, 0x52, 0x56, 0x17, 0xCE, 0xA0, 0x50, 0x9C, 0xC4, 0xBA,
+    0xC1, 0x79, 0x34, 0x11, 0xA7, 0xC2, 0x38, 0x3A, 0x1B, 0xD4, 0x14, 0x01, 0x53, 0x2F, 0x70, 0xD0,
+    0xBA, 0x44, 0xC3, 0x0A, 0x40, 0x4C, 0x21, 0x3D, 0x13, 0xC8, 0x22, 0x38, 0x04, 0xA6, 0xC0, 0x51,
+    0x51, 0x76, 0x50, 0x88, 0x7C, 0xD5, 0x15, 0xEB, 0x15, 0xB8, 0x43, 0x19, 0x88, 0x50, 0x4A, 0x81,
+    0x3A, 0x6E, 0xF1, 0x3A, 0xEA, 0xC1, 0xFA, 0x62, 0xED, 0xAB, 0x23, 0x42, 0x17, 0xB0, 0x58, 0x8E,
+    0x91, 0x86, 0xDE, 0x8A, 0xA2, 0x94, 0x54, 0x60, 0x30, 0xAA, 0x17, 0x6D, 0xE2, 0xD8, 0xE2, 0x9C,
+    0x60, 0xD0, 0x59, 0x98, 0xA2, 0xF3, 0x20, 0x3F, 0x67, 0xC2, 0x65, 0x38, 0x57, 0xEB, 0xB3, 0x4E,
+    0x25, 0xC0, 0x64, 0x62, 0x58, 0x74, 0x8A, 0xC3, 0x77, 0xF5, 0xCF, 0x07, 0x7B, 0x41, 0xE3, 0xBC,
+    0x98, 0x11, 0x74, 0x09, 0x6C, 0xDF, 0xFD, 0xAB, 0x78, 0xDD, 0x0D, 0x3C, 0xBE, 0x21, 0x61, 0xF5,
+    0xB2, 0x44, 0xF9, 0x25, 0x31, 0xF8, 0x7E, 0x28, 0x09, 0xC6, 0xA7, 0x78, 0x46, 0x7D, 0x67, 0xB0,
+    0x0A, 0xAA, 0x61, 0x09, 0x9B, 0xA0, 0xCA, 0x14, 0x78, 0x80, 0xB6, 0xA0, 0x93, 0xA4, 0x67, 0x97,
+    0x11, 0x82, 0x1D, 0xF6, 0x23, 0xA9, 0x77, 0x5F, 0xA9, 0x7C, 0x4B, 0xBC, 0x81, 0x55, 0x32, 0x60,
+    0x9F, 0x02, 0xDE, 0x6A, 0x36, 0x27, 0x9C, 0x00, 0x24, 0x28, 0xAE, 0x55, 0x68, 0xF3, 0x78, 0xE0,
+    0x1D, 0x1E, 0x43, 0xFF, 0xE1, 0xE4, 0xD4, 0x7B, 0x0A, 0x35, 0x8E, 0xCE, 0x4B, 0x50, 0x71, 0xE2,
+    0x5D, 0x41, 0xF8, 0xB3, 0x0E, 0x92, 0x0E, 0x67, 0x92, 0x8C, 0xC9, 0x41, 0x17, 0x77, 0x42, 0x04,
+    0x62, 0x5A, 0x58, 0x08, 0x56, 0x74, 0x8C, 0xB0, 0x3C, 0xA7, 0x89, 0x4A, 0x6B, 0xAB, 0x42, 0x23,
+    0xCB, 0x7C, 0xC1, 0xD7, 0xB0, 0x0D, 0xCB, 0x73, 0x5A, 0x40, 0x8C, 0xDE, 0xBD, 0x43, 0x69, 0xE7,
+    0xD9, 0x47, 0x8B, 0x68, 0x2B, 0x03, 0xE4, 0x90, 0xAC, 0xD4, 0x7E, 0x24, 0x65, 0xF0, 0x17, 0x0D,
+    0x49, 0x10, 0xB9, 0x61, 0xB3, 0x10, 0x2A, 0x0F, 0x42, 0x99, 0x03, 0x86, 0x25, 0x91, 0x63, 0x00,
+    0x5E, 0x1F, 0x90, 0x07, 0xBC, 0x2E, 0x4A, 0x0C, 0x40, 0xA7, 0x61, 0x6B, 0x08, 0xBF, 0x68, 0xC8,
+    0x7F, 0x2F, 0x5E, 0xC9, 0x51, 0x3F, 0x94, 0xA9, 0x7F, 0x99, 0x3F, 0x50, 0x01, 0xBA, 0xD9, 0x64,
+    0xF0, 0x00, 0x0D, 0x5C, 0x0B, 0x66, 0x43, 0x4D, 0xAE, 0x00, 0xA1, 0x67, 0xE4, 0x1A, 0x85, 0x68,
+    0x43, 0xE0, 0x13, 0xCD, 0x82, 0xEE, 0xD1, 0x50, 0x3C, 0x46, 0x08, 0xE9, 0x46, 0x03, 0x7A, 0x15,
+    0xD2, 0xF3, 0x6D, 0x0E, 0x5F, 0x42, 0xA3, 0x10, 0x93, 0x2F, 0x36, 0x83, 0x84, 0x2D, 0x1B, 0x14,
+    0x78, 0xFF, 0x82, 0xA1, 0xC0, 0x2C, 0x71, 0x90, 0xEE, 0xA4, 0x32, 0x34, 0x02, 0xBF, 0x02, 0x43,
+    0x1D, 0xED, 0x93, 0x81, 0x20, 0x5C, 0x47, 0xC9, 0x16, 0x4A, 0xD6, 0x34, 0x94, 0x10, 0xE9, 0xE5,
+    0x8A, 0x1B, 0xED, 0x15, 0x43, 0x8A, 0xFE, 0xB4, 0x46, 0x17, 0xDA, 0x1A, 0xED, 0xB1, 0xEF, 0xAC,
+    0xCF, 0xD9, 0x1F, 0x83, 0xE9, 0x10, 0x6E, 0x88, 0xDF, 0x10, 0xC3, 0x2B, 0xC1, 0xF2, 0xA0, 0x2D,
+    0x53, 0xB9, 0x40, 0x0F, 0xB4, 0xB0, 0xD4, 0x49, 0x8E, 0x5C, 0xE8, 0x5A, 0xB0, 0x4D, 0xCE, 0x73,
+    0x9F, 0xA7, 0x73, 0x06, 0x1C, 0xD4, 0x08, 0xDD, 0xB2, 0x47, 0x67, 0x67, 0x8F, 0x20, 0x1B, 0x9D,
+    0x60, 0x6C, 0xED, 0x6B, 0x82, 0x8A, 0x8D, 0x55, 0x79, 0x61, 0xB5, 0x5A, 0x39, 0xFD, 0xFD, 0x14,
+    0xBF, 0xEF, 0xD3, 0xB2, 0xD7, 0xAF, 0x83, 0xB5, 0xE6, 0x65, 0x98, 0xA6, 0x8A, 0x73, 0x98, 0x36,
+    0x7C, 0xF0, 0x4B, 0xEA, 0x83, 0x98, 0x92, 0x01, 0xF2, 0x7A, 0xAB, 0x63, 0xF6, 0xD5, 0x30, 0x9A,
+    0xFD, 0x1F, 0xE2, 0xBF, 0xC3, 0xB8, 0xA8, 0x14, 0xBF, 0x79, 0x11, 0x73, 0xDF, 0xBF, 0x01, 0x70,
+    0x11, 0xA5, 0x5C, 0x5E, 0xDA, 0xE5, 0x4B, 0x5B, 0xBA, 0xD6, 0xA9, 0x08, 0x5C, 0x6B, 0x07, 0x4A,
+    0xDD, 0xBD, 0x35, 0xBD, 0xF4, 0xF5, 0x65, 0x33, 0xBF, 0x24, 0x53, 0x86, 0x2F, 0xE9, 0x1C, 0x5E,
+    0x3F, 0xF5, 0xB8, 0xDA, 0x80, 0xC6, 0xEF, 0xF2, 0x25, 0x02, 0x49, 0x3E, 0x8C, 0xF9, 0x32, 0x4A,
+    0x11, 0x67, 0x11, 0x52, 0x48, 0x8D, 0xB9, 0x51, 0x19, 0x42, 0xD5, 0xE9, 0xA2, 0x92, 0x31, 0x6A,
+    0x36, 0xAE, 0xB1, 0xA9, 0xDC, 0xC9, 0xD6, 0xE5, 0x5C, 0x6C, 0xD2, 0xA4, 0x9A, 0x2A, 0x4D, 0x6B,
+    0xE6, 0xA2, 0x63, 0x67, 0xFF, 0x82, 0xAD, 0xFE, 0xF0, 0x97, 0xB9, 0x30, 0xD9, 0x7E, 0x7C, 0xFC,
+    0xFC, 0xE6, 0x72, 0xB1, 0xB9, 0x4C, 0xEC, 0xBD, 0xD7, 0xA7, 0x8A, 0xF3, 0x59, 0x3D, 0x57, 0xB7,
+    0x5B, 0xCD, 0x3C, 0x34, 0x9A, 0x96, 0x50, 0x1E, 0x33, 0xBA, 0xAB, 0x62, 0xC7, 0x2F, 0xC1, 0xB5,
+    0xA8, 0x64, 0xD6, 0x40, 0xE8, 0x4B, 0x0B, 0x15, 0x32, 0x90, 0xA7, 0xF9, 0xEE, 0x29, 0x6D, 0xD8,
+    0x9F, 0x61, 0x96, 0x8C, 0x72, 0xB2, 0x75, 0xC9, 0x5B, 0x33, 0xCF, 0x32, 0x3F, 0x17, 0xFF, 0xEC,
+    0xD5, 0xB8, 0xE8, 0x35, 0xC9, 0x44, 0x9A, 0x28, 0x87, 0x5C, 0xA9, 0xD5, 0x5E, 0xC1, 0xCB, 0x7D,
+    0x5E, 0xC2, 0x77, 0x50, 0xD0, 0x38, 0x0E, 0xF9, 0xC7, 0xBE, 0x83, 0xCB, 0x62, 0xB8, 0x03, 0x2F,
+    0x65, 0x28, 0xFB, 0x70, 0x2F, 0x00, 0xDC, 0x22, 0x22, 0x2D, 0x23, 0x93, 0x0A, 0x33, 0x1D, 0xD2,
+    0xE7, 0xC2, 0xB5, 0x0B, 0x0D, 0xAB, 0x28, 0x73, 0xAC, 0x2C, 0x2A, 0xD6, 0xE8, 0xF3, 0xCA, 0x77,
+    0xAA, 0x1A, 0xF4, 0x35, 0x12, 0x9E, 0x1B, 0x15, 0xD5, 0x27, 0x27, 0x17, 0x9D, 0xAE, 0x6E, 0x07,
+    0xAE, 0xD6, 0x8E, 0xF2, 0x8E, 0x06, 0x31, 0xD5, 0x58, 0x8A, 0x65, 0x5A, 0x0B, 0x88, 0x76, 0x0E,
+    0x6A, 0x88, 0xB1, 0xBA, 0x8F, 0xA5, 0x5B, 0xA6, 0x75, 0xC9, 0xE8, 0x0E, 0xC2, 0x22, 0xB5, 0x8D,
+    0xCA, 0x99, 0xCD, 0xD5, 0x77, 0x7F, 0xD8, 0x41, 0xB5, 0x43, 0xAC, 0xC8, 0x1F, 0x46, 0x35, 0xC6,
+    0xD2, 0xE8, 0x1B, 0x53, 0xC7, 0x40, 0xB5, 0x04, 0xFA, 0x43, 0x59, 0xC1, 0x8F, 0xBC, 0x4F, 0x91,
+    0xC7, 0xCE, 0x29, 0x6E, 0xDD, 0x14, 0x46, 0x1D, 0xF9, 0x64, 0xB4, 0x91, 0xD1, 0xE2, 0x93, 0x94,
+    0x25, 0x17, 0xBF, 0xD4, 0x63, 0x57, 0x64, 0x57, 0xBA, 0xC4, 0xA1, 0x06, 0x74, 0xB5, 0xB1, 0x96,
+    0x87, 0x50, 0x11, 0x8D, 0xA2, 0x62, 0xD6, 0xC2, 0x8F, 0xFD, 0xEA, 0x68, 0x1A, 0xCE, 0x74, 0x60,
+    0x10, 0x65, 0x63, 0x54, 0xE2, 0x66, 0x2D, 0xB6, 0x59, 0x7F, 0xA9, 0x00, 0xA6, 0x99, 0xF4, 0x96,
+    0x55, 0x23, 0x58, 0x12, 0x95, 0x75, 0x20, 0x87, 0xEC, 0xD4, 0xD2, 0x3B, 0x9B, 0xA5, 0xD7, 0x89,
+    0x95, 0xDE, 0x2E, 0x62, 0x35, 0xC4, 0x8C, 0x3D, 0xB1, 0x23, 0x97, 0x00, 0x15, 0xD7, 0xD2, 0xE5,
+    0x76, 0xAC, 0x5F, 0xB3, 0xC7, 0x08, 0x8A, 0x9A, 0xD1, 0xD0, 0xF9, 0x74, 0x3D, 0xB8, 0xDB, 0x3A,
+    0xB2, 0xBA, 0xA4, 0xB2, 0x36, 0xE4, 0x8A, 0x3C, 0xFA, 0xF2, 0xAA, 0xBD, 0x3C, 0xFC, 0x04, 0x39,
+    0x2D, 0xC5, 0xFA, 0xF8, 0x58, 0x2B, 0x0D, 0x93, 0xA3, 0x37, 0x5D, 0xB8, 0xDA, 0x63, 0x29, 0x2B,
+    0xB8, 0x64, 0xB3, 0x12, 0x5B, 0xDA, 0x8B, 0x1E, 0x4B, 0xCD, 0x01, 0x7D, 0xC0, 0xFC, 0x96, 0xE0,
+    0x75, 0xC4, 0xB1, 0x05, 0x5B, 0x06, 0x72, 0x4F, 0xAE, 0x98, 0xFD, 0x7C, 0xFA, 0x93, 0x43, 0xC7,
+    0x89, 0xB9, 0x13, 0xCE, 0xB7, 0xF2, 0xC8, 0x8F, 0xCF, 0x5D, 0x9A, 0xB7, 0xC7, 0xA5, 0x2D, 0x93,
+    0xEC, 0x4C, 0x5B, 0x2F, 0x12, 0xBD, 0xE8, 0xB5, 0xCC, 0xB0, 0x05, 0x1D, 0x55, 0xB4, 0xC7, 0xB4,
+    0x78, 0x78, 0x42, 0x05, 0xA6, 0xA7, 0x02, 0x70, 0xA2, 0xF8, 0x28, 0x07, 0xAA, 0x81, 0xA2, 0xA3,
+    0xE8, 0x69, 0xD1, 0x52, 0xF0, 0x94, 0x6A, 0xE4, 0xA9, 0x76, 0x27, 0x46, 0x9E, 0x55, 0x15, 0x98,
+    0x35, 0x15, 0xE0, 0x51, 0x7F, 0xBA, 0x28, 0xA5, 0x4A, 0x20, 0x2A, 0x45, 0x29, 0xB4, 0x20, 0x51,
+    0xCC, 0xC5, 0xA0, 0x42, 0x22, 0x25, 0xF2, 0x01, 0x0C, 0x16, 0x8C, 0x45, 0x81, 0x1C, 0x1D, 0x9E,
+    0x22, 0xD8, 0xF3, 0xC7, 0x2A, 0x56, 0xD6, 0xA8, 0x2C, 0x50, 0xDF, 0x74, 0xEA, 0xB5, 0x50, 0x50,
+    0x9C, 0xA2, 0x52, 0x61, 0x0E, 0x76, 0x2B, 0x2A, 0xAD, 0x89, 0xE4, 0xEF, 0x53, 0x10, 0x4C, 0x52,
+    0x49, 0x9C, 0x7C, 0xA0, 0x8F, 0xCA, 0x4A, 0x4B, 0xA2, 0xB6, 0xFA, 0x95, 0x16, 0xBE, 0x56, 0xD4,
+    0x8E, 0xAC, 0xE4, 0xDA, 0xA8, 0xA8, 0x90, 0xB9, 0x1A, 0x26, 0xB6, 0x63, 0x87, 0xB1, 0xD6, 0x57,
+    0x34, 0x21, 0x45, 0x88, 0xB4, 0xE2, 0xA7, 0x6A, 0x40, 0xCA, 0x42, 0x14, 0xC1, 0x38, 0x54, 0xFB,
+    0xE2, 0x52, 0xBD, 0xD2, 0xA3, 0x2F, 0x78, 0x57, 0x4E, 0xB7, 0x1C, 0x0A, 0x8B, 0xF7, 0x27, 0x5A,
+    0x07, 0x05, 0x89, 0xC6, 0xC9, 0x7A, 0xF5, 0x1F, 0xEA, 0x4B, 0xCD, 0x57, 0x74, 0xA3, 0x19, 0x9B,
+    0xD9, 0x66, 0x6A, 0xB2, 0x25, 0xF7, 0x7F, 0xB8, 0x07, 0xD6, 0xCD, 0xA0, 0x3D, 0x5A, 0xAD, 0xB4,
+    0xC9, 0x29, 0xAA, 0x31, 0x2F, 0x69, 0x70, 0x2C, 0x86, 0x29, 0x24, 0xA8, 0x29, 0x17, 0x61, 0xE4,
+    0xD0, 0x9B, 0x47, 0x28, 0x61, 0xDD, 0x14, 0xD1, 0xDE, 0x26, 0x9B, 0x46, 0xA8, 0x2F, 0xA2, 0xD4,
+    0x1E, 0xBA, 0xCD, 0xB7, 0x54, 0x61, 0xAD, 0x10, 0x0E, 0xA2, 0x55, 0xC3, 0x04, 0xBA, 0x55, 0x13,
+    0xE8, 0xAE, 0xCD, 0x63, 0x42, 0x37, 0x7E, 0xAD, 0xD0, 0x61, 0x68, 0x15, 0xD6, 0x84, 0xEC, 0xBC,
+    0x03, 0x4D, 0x02, 0x67, 0x0A, 0x2F, 0x05, 0x9A, 0x8B, 0x3D, 0xDD, 0x4D, 0xE3, 0xFE, 0x61, 0xCA,
+    0x7D, 0x1D, 0xEE, 0x8C, 0x11, 0xC2, 0x33, 0x9A, 0x84, 0x4D, 0x0D, 0x60, 0xA2, 0xD0, 0x3C, 0x06,
+    0x4C, 0xB6, 0x66, 0x39, 0x0C, 0xA1, 0xDD, 0x60, 0x76, 0x54, 0x1C, 0xC5, 0x83, 0x25, 0xCB, 0x49,
+    0x36, 0x3F, 0xAE, 0x15, 0xA2, 0x6F, 0x56, 0x0D, 0x64, 0xAA, 0x93, 0x4C, 0xF5, 0xF3, 0x64, 0x70,
+    0x98, 0x30, 0x38, 0x6C, 0xBA, 0x23, 0x9A, 0xA9, 0x77, 0x3B, 0x8A, 0x22, 0x3F, 0x9B, 0x0B, 0x90,
+    0xDB, 0x67, 0x4A, 0xE5, 0x07, 0xAC, 0x69, 0x26, 0x27, 0xE8, 0x10, 0x16, 0x85, 0x5D, 0x1F, 0xBD,
+    0x17, 0xEB, 0xCC, 0x6B, 0x04, 0x14, 0x0A, 0x0F, 0xF7, 0x6E, 0xFB, 0x16, 0xEB, 0x94, 0x68, 0xE0,
+    0x4A, 0xA5, 0x47, 0xF5, 0x09, 0xB9, 0xB2, 0xF6, 0x2A, 0xCD, 0xA5, 0x11, 0x3A, 0x29, 0x54, 0x75,
+    0x41, 0xD7, 0xE8, 0x71, 0xA7, 0xB0, 0xD2, 0xA3, 0xA4, 0x9F, 0x3F, 0xFB, 0xA8, 0x2C, 0x85, 0xB6,
+    0x13, 0xAE, 0xE9, 0x0E, 0x64, 0xF6, 0x4C, 0x57, 0xE2, 0xEE, 0xD0, 0x7D, 0x3D, 0x39, 0x7A, 0x7B,
+    0x5E, 0x3E, 0x33, 0x2D, 0xEA, 0xFA, 0x7B, 0xD0, 0x1E, 0x8B, 0x46, 0xBC, 0x0B, 0x4F, 0xCD, 0xB9,
+    0xC7, 0x2D, 0x31, 0x99, 0x10, 0xF9, 0x2E, 0x4E, 0xDF, 0x96, 0x6F, 0xFC, 0x47, 0x5B, 0x54, 0xB7,
+    0x01, 0x73, 0x5D, 0x0F, 0x0F, 0x97, 0xDA, 0xA8, 0x42, 0x92, 0x5C, 0x97, 0xA9, 0xDA, 0xAC, 0xCA,
+    0xD8, 0xAE, 0x8E, 0x0D, 0xEB, 0x6C, 0xBE, 0xB1, 0x81, 0x70, 0x90, 0x21, 0xA9, 0x26, 0x74, 0x36,
+    0x74, 0x46, 0x84, 0xC1, 0x86, 0xA3, 0xF7, 0xC4, 0x99, 0xD1, 0xD9, 0xD1, 0x19, 0x52, 0x2D, 0x29,
+    0x6A, 0x4A, 0x67, 0x4B, 0x67, 0x4C, 0x74, 0xAC, 0xAC, 0x87, 0xA3, 0x39, 0xDD, 0xF6, 0xAA, 0x1A,
+    0xF4, 0x14, 0x82, 0x6C, 0x39, 0xBE, 0xB7, 0x43, 0x70, 0x38, 0x9D, 0x60, 0x7C, 0x92, 0x60, 0xA8,
+    0x04, 0xE3, 0x6D, 0x82, 0xF5, 0x43, 0x04, 0xB5, 0x95, 0xF5, 0xD7, 0x58, 0xD5, 0xF4, 0xB6, 0x0D,
+    0xF1, 0x8B, 0xDA, 0x8C, 0x5B, 0xC8, 0xB9, 0x36, 0x25, 0xA5, 0x13, 0x58, 0x2B, 0xEB, 0xD8, 0x80,
+    0x4C, 0x8D, 0xC7, 0xD4, 0x74, 0x8C, 0x7D, 0x8B, 0xB6, 0x06, 0x9B, 0x3E, 0x25, 0xEC, 0xFD, 0xDB,
+    0x11, 0x7A, 0xBE, 0xB8, 0x49, 0x06, 0x53, 0x27, 0x43, 0x56, 0xC6, 0x03, 0x56, 0x64, 0xBD, 0x16,
+    0x3C, 0x6F, 0x39, 0xD7, 0xBB, 0x81, 0xAE, 0xBC, 0xD6, 0x88, 0x3D, 0x96, 0xA0, 0xD7, 0x00, 0xB6,
+    0x9F, 0xA2, 0xDC, 0xD9, 0x42, 0x2F, 0x1B, 0x74, 0x89, 0xDF, 0xE1, 0x45, 0x69, 0x20, 0xD1, 0x3E,
+    0x43, 0x4E, 0x8B, 0x8C, 0xAE, 0x26, 0xC6, 0x46, 0xCB, 0x75, 0xA6, 0xA8, 0x14, 0xC7, 0xD7, 0x6A,
+    0x34, 0xBF, 0x7E, 0x8B, 0x4E, 0x5E, 0x6E, 0xD0, 0x47, 0x2F, 0x5E, 0x04, 0x38, 0xF7, 0xEC, 0x96,
+    0xAC, 0x42, 0x34, 0x92, 0x9A, 0x14, 0x99, 0xA1, 0x31, 0x97, 0x2B, 0xC8, 0x63, 0x5E, 0xC3, 0xFA,
+    0xCC, 0x66, 0x2C, 0x1E, 0x5C, 0xDF, 0x68, 0xAE, 0x4D, 0xC7, 0xA5, 0x4A, 0xA6, 0xA9, 0x64, 0x1B,
+    0x1E, 0x5C, 0xB5, 0xC3, 0x52, 0xC7, 0x88, 0x8E, 0x67, 0x35, 0xCA, 0x0A, 0xAE, 0xED, 0x88, 0xC7,
+    0x6B, 0xCD, 0x65, 0xE8, 0xED, 0x90, 0xF8, 0x47, 0x5A, 0x53, 0x51, 0xD4, 0x93, 0xAB, 0x0C, 0x5A,
+    0xE1, 0x9A, 0xF1, 0xCA, 0x3D, 0x3B, 0x38, 0xD5, 0x73, 0xB9, 0xBF, 0xC2, 0x05, 0xBF, 0x6B, 0x1E,
+    0xDC, 0xE6, 0x8B, 0x5E, 0xE9, 0x9A, 0x7A, 0xFF, 0xF8, 0x2B, 0x1C, 0x5F, 0x7B, 0xD1, 0x99, 0xDA,
+    0x48, 0x92, 0x31, 0xFD, 0x62, 0x0A, 0xAC, 0x49, 0x63, 0x6A, 0x6E, 0xC6, 0x35, 0x59, 0x6D, 0xEF,
+    0x41, 0x7D, 0x59, 0x85, 0xD3, 0x65, 0xAB, 0xDB, 0x59, 0xC1, 0xC0, 0xED, 0x12, 0x9C, 0xC2, 0x1E,
+    0xC6, 0x0E, 0xB0, 0xD2, 0x88, 0xDA, 0x84, 0xDB, 0x79, 0x11, 0x0C, 0x02, 0xAF, 0x8A, 0x1B, 0x53,
+    0x99, 0x52, 0x37, 0x52, 0xB2, 0xDC, 0xBE, 0x32, 0x70, 0xBF, 0xC5, 0x7A, 0x43, 0xD0, 0xCB, 0x96,
+    0xC4, 0x4E, 0xB2, 0x49, 0xCC, 0x89, 0x81, 0xCD, 0xFD, 0xFC, 0xFE, 0xE0, 0x71, 0xA2, 0x58, 0x75,
+    0x81, 0xFC, 0xA6, 0xEA, 0x80, 0x37, 0xAA, 0x1E, 0x16, 0x36, 0x57, 0xA5, 0x2C, 0xE0, 0x1F, 0xEE,
+    0xBE, 0x54, 0xD5, 0xA0, 0xF1, 0x71, 0xDA, 0xF9, 0xC5, 0x93, 0x24, 0x8A, 0xA9, 0x77, 0x3F, 0xC1,
+    0xEF, 0x86, 0xEF, 0x71, 0x41, 0xF6, 0xA2, 0xFE, 0x0F, 0xA0, 0xF9, 0xFD, 0xCA, 0xC4, 0x4F, 0x6A,
+    0x1C, 0xDD, 0x72, 0x87, 0x1F, 0xDC, 0x4F, 0xEF, 0xA7, 0xF1, 0x8F, 0xF1, 0xD9, 0x7B, 0x42, 0xFD,
+    0x3D, 0xF7, 0x24, 0x42, 0x6A, 0x4B, 0x7E, 0x52, 0x7F, 0xE1, 0x29, 0xFA, 0x53, 0x61, 0x3F, 0x80,
+    0xDE, 0xE3, 0xCE, 0xF0, 0x4F, 0x88, 0x3E, 0xEE, 0xBF, 0xCA, 0xE3, 0x36, 0x63, 0x93, 0xAD, 0xB1,
+    0x6E, 0xAD, 0x95, 0xE8, 0x6A, 0xC9, 0x6C, 0x41, 0xF7, 0x37, 0xD0, 0xE2, 0xFE, 0xE3, 0xF3, 0x1D,
+    0xF6, 0xAE, 0x89, 0x76, 0x3D, 0xB5, 0xB6, 0xD8, 0x03, 0xF9, 0x8D, 0xD6, 0xDC, 0x1F, 0xF0, 0xEF,
+    0x3F, 0x9E, 0x0F, 0x45, 0x8F, 0xE4, 0xC7, 0x77, 0xFF, 0x00, 0x66, 0x63, 0x05, 0x70, 0x2B, 0xBE,
+    0x67, 0x70, 0xF6, 0x54, 0x6D, 0x45, 0x8E, 0x38, 0x80, 0xDA, 0x8A, 0x3C, 0xEB, 0xB8, 0xA5, 0x52,
+    0xE4, 0xC5, 0xE6, 0x0C, 0xB5, 0x15, 0x39, 0x7B, 0xB8, 0x0F, 0x30, 0x2E, 0x3C, 0xDE, 0xCC, 0x3F,
+    0x71, 0x46, 0x4F, 0x52, 0x7C, 0xB2, 0x5C, 0xA6, 0xE3, 0x9F, 0xA2, 0xE5, 0xC9, 0xF3, 0x6A, 0xB5,
+    0xB2, 0x9F, 0xBA, 0x1D, 0x96, 0x53, 0xE7, 0xA3, 0x4C, 0x14, 0xF9, 0x7E, 0xCA, 0xEE, 0x11, 0xF4,
+    0x46, 0x7E, 0x8A, 0x76, 0xE6, 0x63, 0xBA, 0x9F, 0xDE, 0x4F, 0xE3, 0x4F, 0xC1, 0xE7, 0x1C, 0x2E,
+    0x35, 0x4D, 0xD1, 0xA2, 0x8B, 0xED, 0xB2, 0xE6, 0xF9, 0xAD, 0x17, 0x71, 0x95, 0xB5, 0x45, 0xC7,
+    0xAF, 0xA9, 0xBD, 0xF9, 0xE9, 0xFE, 0x38, 0xDA, 0x62, 0xF4, 0xD3, 0xF9, 0x3E, 0x04, 0xCE, 0xFA,
+    0x0C, 0x96, 0x49, 0x1A, 0x4F, 0xFF, 0xC1, 0x33, 0x9D, 0xDE, 0x77, 0xAC, 0xAF, 0xC0, 0x3C, 0xBD,
+    0x6D, 0x75, 0xB7, 0x78, 0xF3, 0xB6, 0xE6, 0x9F, 0x2D, 0x0F, 0xF2, 0xED, 0x7F, 0x48, 0x0E, 0x3E,
+    0x4F, 0xCF, 0xF4, 0x6F, 0xA2, 0xEA, 0x0D, 0xD9, 0x1C, 0x6F, 0x9E, 0xDD, 0x3F, 0x39, 0x06, 0x61,
+    0x82, 0xD5, 0xA8, 0x65, 0xE7, 0x8E, 0x9C, 0xE7, 0x77, 0x67, 0xF7, 0x97, 0x9C, 0x0B, 0x6D, 0xB4,
+    0x7A, 0x2D, 0x31, 0x23, 0x0B, 0x83, 0x0A, 0x68, 0x81, 0xE2, 0xD9, 0x20, 0x3F, 0x24, 0xB7, 0xE1,
+    0xBB, 0xF2, 0xC2, 0x22, 0xBF, 0x18, 0x94, 0xD1, 0x55, 0xFD, 0xDB, 0xF4, 0x8C, 0x38, 0xCF, 0x6A,
+    0xB9, 0xB0, 0xFB, 0xE4, 0x0C, 0x0D, 0xFA, 0x7F, 0x75, 0x56, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x1D,
+    0x92, 0x88, 0x08, 0x88, 0xC5, 0xA6, 0x70, 0x9A, 0xB8, 0x60, 0xAF, 0x14, 0xFC, 0x03, 0xEF, 0x7E,
+    0x44, 0x94, 0xC6, 0x5F, 0x10, 0xA5, 0xF0, 0x0F, 0x04, 0x5A, 0x22, 0x6D, 0x1A, 0x7D, 0x82, 0x0A,
+    0x15, 0xA7, 0x53, 0xE1, 0x36, 0x01, 0x92, 0xDB, 0x4D, 0x8A, 0xB8, 0x48, 0x43, 0x23, 0xE9, 0x52,
+    0x98, 0x80, 0x65, 0x20, 0x48, 0x0A, 0x6F, 0x10, 0x22, 0xA1, 0x6C, 0x1E, 0x27, 0x6F, 0x76, 0x79,
+    0x3A, 0xD9, 0x42, 0x6E, 0x77, 0x4E, 0xE2, 0x70, 0x77, 0x66, 0x76, 0xE6, 0xBD, 0xD9, 0xA3, 0x7A,
+    0x24, 0x62, 0xA6, 0x82, 0xD9, 0x57, 0x10, 0x35, 0xD9, 0xAE, 0x09, 0xBA, 0xD3, 0x22, 0x18, 0xB6,
+    0xB3, 0xDE, 0x7A, 0x07, 0x61, 0xEF, 0x7E, 0x60, 0x63, 0x7F, 0x61, 0xD2, 0xBC, 0xA5, 0x86, 0x47,
+    0x52, 0xDC, 0x53, 0xB6, 0x21, 0xA2, 0x53, 0x98, 0x88, 0xF3, 0x01, 0x1E, 0x28, 0x9F, 0xA8, 0xC0,
+    0x1C, 0xA9, 0x1C, 0xA8, 0x0A, 0xA4, 0x30, 0x7B, 0xAA, 0x3B, 0xAA, 0x3D, 0x35, 0x9E, 0x74, 0x2B,
+    0x33, 0x7E, 0x0E, 0x57, 0x44, 0x1A, 0xEE, 0xDD, 0x40, 0x39, 0x07, 0x2A, 0x21, 0x35, 0x44, 0x3F,
+    0xED, 0x89, 0x75, 0x57, 0x4C, 0xDA, 0x57, 0xC1, 0xFA, 0xFA, 0x15, 0xFF, 0xDA, 0x30, 0x8F, 0x9A,
+    0x79, 0x38, 0xBA, 0xE2, 0x73, 0xCA, 0xE0, 0x28, 0x9F, 0x89, 0xB2, 0x4F, 0x89, 0x4E, 0xD6, 0xE7,
+    0x88, 0x3E, 0x40, 0xFA, 0x9C, 0xB9, 0x83, 0x53, 0x2A, 0x06, 0x82, 0xA9, 0x6B, 0xAA, 0x78, 0xC6,
+    0x5F, 0xAC, 0x25, 0x86, 0x3F, 0xB7, 0x08, 0x9B, 0xD3, 0xC7, 0x4C, 0x96, 0x27, 0x9C, 0x22, 0xD0,
+    0xC1, 0x1A, 0xAF, 0x0F, 0xB8, 0x83, 0xC2, 0xE7, 0x31, 0x03, 0x9F, 0xB5, 0x0A, 0xFB, 0x9B, 0x1E,
+    0x91, 0xFD, 0x3C, 0x42, 0x2D, 0x6B, 0xD9, 0x38, 0xCF, 0xAD, 0x6B, 0x6D, 0xEB, 0x8C, 0x33, 0xB6,
+    0x45, 0x06, 0xFE, 0x64, 0x64, 0x60, 0x82, 0x8F, 0x40, 0xB4, 0x36, 0xB0, 0xB3, 0xBE, 0x50, 0x88,
+    0x63, 0x11, 0xEC, 0xB6, 0x5E, 0x7C, 0xC5, 0x38, 0xCB, 0x89, 0x28, 0x1A, 0x0D, 0x8B, 0xBA, 0xC5,
+    0x71, 0xA1, 0xDE, 0x42, 0x3D, 0x26, 0xF5, 0x47, 0x06, 0x71, 0x54, 0x58, 0xEB, 0xD8, 0x67, 0xB0,
+    0x51, 0xCC, 0x2A, 0x14, 0x13, 0x64, 0xAE, 0x03, 0x9E, 0x3D, 0xD9, 0x19, 0xC7, 0x9E, 0xE1, 0x8F,
+    0xDB, 0x26, 0x38, 0xAF, 0x3D, 0x6A, 0x23, 0xDF, 0x3D, 0x7B, 0xE4, 0xC6, 0x54, 0xA8, 0x48, 0xE6,
+    0xCE, 0x88, 0x9E, 0x5C, 0xC3, 0x76, 0x5C, 0x67, 0xEA, 0xC1, 0xF9, 0xA6, 0x8F, 0xAB, 0xD2, 0xE8,
+    0x9D, 0xAC, 0xF5, 0x8A, 0x9D, 0xCF, 0x6F, 0x9C, 0x89, 0x05, 0x43, 0x10, 0x6B, 0x37, 0xC2, 0x6D,
+    0x0F, 0x31, 0x74, 0x72, 0x91, 0x2A, 0xF3, 0xDD, 0x7E, 0x3A, 0x9E, 0x30, 0x4F, 0xE6, 0xD5, 0x5E,
+    0xF9, 0x25, 0xD2, 0xBE, 0x62, 0x9E, 0x30, 0x2D, 0xCF, 0x98, 0x47, 0xEB, 0x4B, 0x6C, 0xC2, 0x77,
+    0x7A, 0xA4, 0xCC, 0x50, 0x8D, 0x32, 0x13, 0x4D, 0x94, 0x8F, 0x54, 0x04, 0xAA, 0x3A, 0x52, 0x3E,
+    0xEA, 0x8C, 0xA8, 0x31, 0x6D, 0x9C, 0xA7, 0xF1, 0x3B, 0x69, 0x1A, 0xA2, 0xDA, 0xC8, 0x32, 0xF9,
+    0x3C, 0xB8, 0x55, 0xB5, 0xA2, 0xBA, 0x3F, 0x05, 0x4C, 0xD1, 0x1C, 0xF6, 0x7F, 0x2F, 0x8E, 0x50,
+    0xF6, 0xB2, 0x97, 0x37, 0x9A, 0x76, 0x9F, 0xE2, 0x2F, 0x36, 0xC5, 0x5B, 0xF6, 0x25, 0x3F, 0xE9,
+    0xAA, 0x51, 0x75, 0x2A, 0x40, 0xFA, 0xDA, 0xD7, 0x5D, 0xE3, 0x6B, 0xAF, 0xDB, 0xC6, 0x6B, 0xA3,
+    0x5B, 0x0B, 0x2B, 0x0E, 0x66, 0x38, 0x6D, 0x6A, 0x86, 0x98, 0x69, 0x20, 0xC7, 0xA0, 0x92, 0xBE,
+    0x19, 0x91, 0x6D, 0xA0, 0x50, 0x2F, 0x3C, 0x48, 0x83, 0x81, 0x07, 0x8C, 0xAF, 0x98, 0xDC, 0xB3,
+    0x79, 0x41, 0xD3, 0x00, 0xF0, 0x76, 0x94, 0x7F, 0x2B, 0x46, 0x00, 0xAB, 0x0A, 0xF6, 0x50, 0xB5,
+    0x1C, 0x95, 0xA9, 0xF1, 0x5E, 0xD0, 0xA2, 0x7E, 0x1B, 0xE9, 0x40, 0x4A, 0x2E, 0x68, 0xA8, 0x43,
+    0x2A, 0xBD, 0x16, 0xA8, 0x75, 0x09, 0x19, 0x22, 0x0E, 0x72, 0x8C, 0xE2, 0x3C, 0x94, 0x8A, 0xB3,
+    0x2F, 0x04, 0xD9, 0xB3, 0x0B, 0xD4, 0x35, 0xBB, 0x0D, 0x58, 0x0C, 0x44, 0x14, 0xB0, 0x2F, 0xDC,
+    0x75, 0x3D, 0x7C, 0x20, 0x6F, 0x40, 0x13, 0x18, 0xD2, 0x46, 0xB4, 0x02, 0xB5, 0xC7, 0xC7, 0xC7,
+    0x40, 0xC3, 0x8D, 0xF0, 0xBA, 0x15, 0x6E, 0x67, 0xAF, 0x2C, 0xF6, 0x35, 0x10, 0xED, 0x61, 0xB8,
+    0x25, 0xC4, 0x45, 0x88, 0x99, 0x9E, 0xCE, 0x14, 0x91, 0x00, 0xB4, 0x9A, 0x8C, 0xCD, 0xE6, 0x0A,
+    0x67, 0xC2, 0x3B, 0x27, 0xEC, 0xB8, 0xBC, 0xCB, 0x52, 0x4E, 0x2C, 0xAD, 0x22, 0x4B, 0xFB, 0xC8,
+    0xD2, 0x39, 0xB1, 0x54, 0x21, 0x3F, 0x0D, 0x58, 0xAA, 0xEF, 0xB2, 0x54, 0x20, 0x5E, 0xDC, 0x67,
+    0x29, 0xCE, 0xD4, 0xE5, 0xF7, 0x59, 0x6A, 0xDE, 0x67, 0xE9, 0xA3, 0xC7, 0xA9, 0xCF, 0x24, 0x96,
+    0x1A, 0x61, 0xA9, 0xBF, 0x65, 0xE9, 0xFC, 0x3E, 0x4B, 0xE7, 0xC8, 0x54, 0xD4, 0xC5, 0x38, 0xF0,
+    0x74, 0xCF, 0xD2, 0xF9, 0x1D, 0x96, 0x1E, 0xAE, 0xD7, 0xE7, 0x3B, 0x96, 0xD6, 0x88, 0x23, 0x25,
+    0x7B, 0x89, 0xB3, 0x9A, 0x52, 0x4D, 0xA4, 0x1E, 0x4E, 0x52, 0x64, 0xF6, 0x6A, 0xF8, 0xD2, 0x3B,
+    0x96, 0x3E, 0x4C, 0x2C, 0x45, 0x1C, 0x7D, 0xB1, 0xAD, 0x13, 0x4B, 0xB7, 0x8D, 0x74, 0x1F, 0x4F,
+    0x6E, 0x1B, 0xEB, 0x0D, 0xFB, 0x46, 0x98, 0x69, 0x77, 0xE3, 0x39, 0x7B, 0xE4, 0x05, 0x7A, 0xB0,
+    0x74, 0x93, 0x58, 0x5A, 0x20, 0x66, 0x95, 0x58, 0xDA, 0x2E, 0x5C, 0x4E, 0xA3, 0x8B, 0x6B, 0xC1,
+    0x52, 0x6E, 0xF3, 0x11, 0xB1, 0x65, 0x7B, 0x96, 0x4A, 0x63, 0x91, 0x86, 0x76, 0x72, 0x76, 0x8F,
+    0xA5, 0x89, 0x8D, 0xEB, 0xBB, 0x2C, 0xFD, 0x86, 0xD0, 0x94, 0x92, 0x1E, 0x05, 0xC5, 0x04, 0x69,
+    0x49, 0x6A, 0xB1, 0x4A, 0x8F, 0xF4, 0x41, 0x64, 0xA9, 0x8D, 0x2C, 0x05, 0x79, 0xD0, 0xA6, 0x23,
+    0x4B, 0x9B, 0x76, 0x4F, 0xD1, 0xD3, 0x77, 0xE7, 0x42, 0x54, 0xA0, 0xAD, 0xDD, 0xB1, 0xF4, 0xD1,
+    0x4E, 0x75, 0x9F, 0xA8, 0xB7, 0x14, 0xD5, 0x71, 0x33, 0xCE, 0xBE, 0xEB, 0x05, 0xC9, 0xAD, 0x7C,
+    0x36, 0x87, 0x40, 0xE7, 0x8B, 0x78, 0xDA, 0xA6, 0x47, 0xD6, 0x3C, 0x98, 0x08, 0x36, 0x3A, 0xDA,
+    0xA0, 0x2E, 0x5B, 0x62, 0xDC, 0x25, 0x8C, 0xFE, 0xE9, 0x84, 0x61, 0xF3, 0x48, 0xD5, 0xF3, 0x73,
+    0x64, 0xAF, 0x47, 0xF6, 0x90, 0xE5, 0x1B, 0xF4, 0x60, 0x0F, 0xF6, 0xA2, 0xD2, 0xEE, 0x4A, 0x10,
+    0x3B, 0x10, 0x5F, 0x26, 0x2C, 0x3B, 0xFA, 0x90, 0xEC, 0xDB, 0x80, 0xEA, 0x07, 0xB4, 0x60, 0xB3,
+    0xEC, 0x01, 0x03, 0x91, 0x75, 0xDD, 0x39, 0x12, 0xD6, 0x0B, 0xE7, 0xC5, 0x13, 0xC7, 0x31, 0x93,
+    0xC3, 0xA5, 0x65, 0x77, 0x2C, 0x7E, 0x13, 0x49, 0x0C, 0x1A, 0xBB, 0x42, 0x88, 0xF5, 0xB5, 0xA0,
+    0xED, 0x05, 0x00, 0x53, 0x0B, 0x4A, 0x95, 0x50, 0x46, 0x4D, 0xD2, 0x2C, 0xB6, 0xE2, 0x4C, 0x50,
+    0xBE, 0xC5, 0x81, 0xCA, 0x11, 0x37, 0x9B, 0x0A, 0x20, 0xD8, 0x51, 0xFB, 0xF1, 0x19, 0x1A, 0x72,
+    0x0F, 0x68, 0x6F, 0xA9, 0xFC, 0x43, 0x42, 0xB2, 0x88, 0x02, 0xAF, 0xBF, 0xE0, 0x56, 0x9A, 0x73,
+    0x73, 0x83, 0x20, 0x0C, 0x2E, 0x97, 0x1C, 0x10, 0x7F, 0x3D, 0x22, 0xD0, 0x8E, 0x0E, 0x6E, 0xA4,
+    0x89, 0x52, 0x4C, 0x3C, 0xE2, 0x22, 0x12, 0x37, 0x70, 0x90, 0x4D, 0xD6, 0xC4, 0xCB, 0x6D, 0xB9,
+    0x18, 0xCA, 0xB1, 0x0A, 0xE5, 0xA0, 0xFA, 0x6A, 0x69, 0x67, 0x2A, 0xB5, 0x33, 0x8F, 0x76, 0xD6,
+    0xE2, 0x60, 0xE6, 0xC8, 0x9C, 0xFC, 0x8F, 0x9D, 0x7C, 0x95, 0x0B, 0x5C, 0x47, 0xED, 0x8B, 0x81,
+    0xA9, 0xFC, 0x37, 0x51, 0x43, 0x45, 0x19, 0x48, 0xBD, 0x9C, 0xA8, 0xFE, 0x11, 0x57, 0xBB, 0x07,
+    0x75, 0x40, 0xA2, 0x23, 0x0C, 0xB1, 0x63, 0xA3, 0x15, 0x16, 0x3B, 0xD9, 0x76, 0x7F, 0xBB, 0x17,
+    0x11, 0x33, 0x55, 0xBC, 0xDD, 0xD5, 0xED, 0xED, 0x8E, 0xB3, 0x1B, 0xCA, 0x2E, 0xAC, 0xD9, 0x50,
+    0xFE, 0x0F, 0x3F, 0x8B, 0xCD, 0x47, 0xDA, 0xD8, 0xAC, 0xA6, 0xDA, 0x97, 0xF0, 0x8E, 0x6F, 0xC4,
+    0xDE, 0x78, 0x89, 0x1E, 0xAD, 0xA3, 0x97, 0x46, 0x2C, 0x27, 0xD0, 0x46, 0xFE, 0xB3, 0x24, 0xFF,
+    0xA5, 0x02, 0xCD, 0x24, 0x27, 0xB9, 0xA4, 0xFC, 0x7C, 0x43, 0xC5, 0xDF, 0xB1, 0x15, 0x76, 0xB0,
+    0xD0, 0x57, 0x83, 0xB4, 0xF2, 0xBA, 0x13, 0x2B, 0x35, 0x4E, 0x1D, 0xCF, 0xBD, 0xB4, 0x72, 0x01,
+    0xCF, 0x09, 0x7D, 0x4E, 0xB4, 0x7A, 0x62, 0x68, 0x1B, 0xF9, 0x12, 0xB2, 0xB9, 0x1C, 0xF2, 0xA9,
+    0x18, 0x8A, 0x11, 0x82, 0xCC, 0x95, 0xA1, 0xC2, 0x50, 0xBD, 0x1A, 0x74, 0x04, 0x9E, 0x7A, 0x3D,
+    0x53, 0xFD, 0xD3, 0xB5, 0x84, 0x1F, 0x7F, 0x9A, 0x00, 0xB1, 0xB7, 0xA9, 0xC3, 0xA5, 0x5A, 0xF1,
+    0xA4, 0xDE, 0x0C, 0xF2, 0xFB, 0x25, 0x48, 0xE5, 0x0B, 0xE9, 0x43, 0x38, 0x71, 0x30, 0xAA, 0x9F,
+    0x5D, 0x87, 0xFD, 0x9F, 0xFC, 0x4E, 0x80, 0x1B, 0x8D, 0xC2, 0xA2, 0x6A, 0x3E, 0x43, 0x73, 0xC0,
+    0x54, 0x77, 0x7F, 0xEF, 0x98, 0xE5, 0xBA, 0xB3, 0x40, 0x31, 0x72, 0x7E, 0x4D, 0xFF, 0x01, 0x6D,
+    0x58, 0xBF, 0x8F, 0xDC, 0xD6, 0x11, 0x7E, 0xE4, 0x46, 0x22, 0x20, 0x16, 0x4C, 0x63, 0x18, 0x51,
+    0x0A, 0xA6, 0x0C, 0xE2, 0x82, 0x7F, 0x81, 0x45, 0xDA, 0x02, 0xE2, 0xF6, 0x10, 0xF8, 0x12, 0x20,
+    0x2A, 0x94, 0x22, 0x85, 0x91, 0x14, 0xD7, 0xA4, 0x74, 0x40, 0x22, 0x2A, 0xDC, 0xAA, 0x71, 0x6A,
+    0x15, 0x09, 0xE0, 0xAC, 0x8B, 0x6B, 0x03, 0x44, 0x10, 0x79, 0x76, 0xE1, 0x42, 0x0D, 0xE5, 0x20,
+    0x49, 0xE1, 0xC2, 0x04, 0x62, 0xC3, 0x90, 0x54, 0x88, 0x91, 0x28, 0x8B, 0xA7, 0x23, 0x39, 0xF9,
+    0xBE, 0x99, 0xC7, 0xBD, 0x3D, 0xD9, 0x5B, 0xCC, 0x70, 0x77, 0x1F, 0xDF, 0xFC, 0xFA, 0xE6, 0xC7,
+    0x7B, 0xCE, 0xE9, 0xE7, 0xB2, 0x8C, 0xA0, 0xB9, 0x88, 0x73, 0x81, 0xC8, 0xEC, 0xDC, 0x46, 0x64,
+    0x72, 0x2E, 0x91, 0xAF, 0xFF, 0xEE, 0x5C, 0xBA, 0x70, 0x49, 0x3E, 0x29, 0x1D, 0x48, 0xCB, 0xFE,
+    0xEA, 0x76, 0xEB, 0xEA, 0x8E, 0x2F, 0x08, 0xE8, 0xE2, 0xA4, 0x2D, 0xF1, 0x9A, 0x74, 0xE5, 0xA3,
+    0x8F, 0x40, 0xEB, 0xD6, 0xB9, 0x7A, 0x90, 0x06, 0x2B, 0x45, 0x1E, 0xDD, 0xE1, 0xC6, 0xD2, 0x63,
+    0x37, 0x91, 0x8E, 0x3B, 0x0B, 0xFE, 0x7E, 0x5D, 0xB6, 0x15, 0xC5, 0x70, 0xBB, 0x48, 0x05, 0xC4,
+    0xCB, 0x61, 0x41, 0x91, 0x7C, 0x0D, 0xB4, 0x52, 0x8A, 0x5F, 0x52, 0xD1, 0x45, 0xEE, 0x52, 0x71,
+    0x00, 0x9A, 0x7C, 0xD2, 0x83, 0xA6, 0xD7, 0x3B, 0x68, 0x5A, 0x7F, 0xDC, 0xAA, 0x84, 0x56, 0x37,
+    0xED, 0xB9, 0x12, 0x02, 0xF0, 0x83, 0x34, 0xB0, 0xA2, 0x2F, 0xAB, 0x8D, 0xBC, 0xE8, 0x66, 0x17,
+    0xCB, 0xFD, 0x66, 0xC4, 0x66, 0x7C, 0x35, 0x9B, 0xD3, 0xEB, 0x3D, 0x6C, 0xC9, 0xA3, 0xD6, 0xE5,
+    0xE3, 0xB5, 0xA4, 0x71, 0xE5, 0x70, 0x37, 0xA9, 0x5C, 0xDD, 0x4F, 0x19, 0x74, 0xFE, 0xDF, 0x90,
+    0x3B, 0x27, 0x4F, 0xFB, 0x3F, 0x82, 0x3E, 0xEB, 0x60, 0x71, 0x7D, 0xD6, 0x8E, 0x94, 0x41, 0xA9,
+    0xB9, 0x5C, 0xEF, 0x2B, 0xD0, 0x2F, 0xA0, 0x21, 0x6D, 0x69, 0x5C, 0xA4, 0x34, 0x58, 0x29, 0xCC,
+    0x08, 0xFB, 0x7B, 0x50, 0x6F, 0xD3, 0xDD, 0xA5, 0x41, 0x7C, 0xF5, 0x95, 0xCF, 0x8F, 0xE5, 0x54,
+    0x5D, 0x0C, 0x3D, 0x63, 0xA5, 0x99, 0xBA, 0xA3, 0x96, 0x47, 0xD4, 0x79, 0x74, 0x71, 0xB1, 0xC1,
+    0x8F, 0x78, 0x97, 0xF6, 0x43, 0x0A, 0xDF, 0x59, 0xFD, 0x1F, 0x1C, 0x5C, 0x85, 0xCE, 0x71, 0x2F,
+    0xD0, 0x39, 0x79, 0xB6, 0x90, 0x9E, 0xCD, 0xD0, 0x3C, 0x41, 0xA8, 0xEA, 0x3E, 0x45, 0xD4, 0xEA,
+    0x3E, 0x1B, 0x48, 0xF3, 0x7E, 0x47, 0x87, 0x12, 0xDB, 0x95, 0x63, 0x09, 0x4F, 0xE5, 0x73, 0x7D,
+    0x52, 0x51, 0xE0, 0x93, 0xEF, 0xD3, 0x1F, 0x7F, 0xCC, 0x94, 0x73, 0x48, 0x12, 0xAA, 0x3F, 0x37,
+    0x3B, 0xDA, 0xE9, 0xD2, 0x56, 0x75, 0xC6, 0xCB, 0xAA, 0x50, 0xA2, 0xCB, 0x53, 0xA3, 0x0A, 0x8E,
+    0xCC, 0x20, 0xA2, 0x56, 0xE7, 0x0A, 0xA0, 0x52, 0x69, 0x2D, 0x84, 0x17, 0x5E, 0x85, 0x72, 0xF2,
+    0x72, 0x7B, 0x07, 0x14, 0xEA, 0x40, 0x6E, 0xA3, 0xA2, 0x48, 0x35, 0x8A, 0x5C, 0xD8, 0xEA, 0xC2,
+    0x86, 0x1E, 0x50, 0x50, 0x28, 0xBD, 0x20, 0x70, 0xBA, 0xE0, 0xD0, 0x8C, 0x6F, 0x84, 0x8A, 0xD9,
+    0x58, 0x85, 0xA5, 0x2A, 0x2C, 0x97, 0x1B, 0x3D, 0xED, 0x76, 0x3F, 0xA4, 0x27, 0xB8, 0x50, 0x8C,
+    0xD2, 0xB9, 0xBF, 0x94, 0xAF, 0x0F, 0x55, 0xCC, 0xA2, 0x74, 0x56, 0x0F, 0x4C, 0x44, 0x23, 0x9D,
+    0x1E, 0x11, 0x74, 0x34, 0x7A, 0x54, 0x3A, 0xA8, 0xE9, 0xFD, 0x1A, 0x86, 0xEC, 0x3C, 0x0D, 0x02,
+    0xB5, 0x22, 0xD1, 0x7D, 0xB2, 0x1D, 0x9D, 0x15, 0xED, 0x46, 0x57, 0x55, 0x17, 0xCF, 0x37, 0xEB,
+    0x0F, 0xD1, 0xE0, 0x1F, 0x12, 0xEA, 0xF3, 0x5A, 0x91, 0xB5, 0xB9, 0xDC, 0xC6, 0xB6, 0x27, 0x32,
+    0x95, 0xF4, 0x52, 0x79, 0x5F, 0x16, 0x73, 0xDD, 0x97, 0xB2, 0xEA, 0x79, 0x2C, 0x52, 0xC3, 0x1B,
+    0x32, 0x45, 0x32, 0x12, 0x18, 0x32, 0x00, 0x2A, 0xF0, 0x4F, 0x20, 0xDD, 0x46, 0x1A, 0x3C, 0xC0,
+    0x93, 0xB0, 0x00, 0x0F, 0xF8, 0x0A, 0x23, 0xE0, 0x34, 0xFB, 0x0A, 0xBF, 0x45, 0x42, 0x1F, 0xC2,
+    0x75, 0xF8, 0x9A, 0xCD, 0x34, 0x02, 0x0F, 0xE5, 0xCC, 0x58, 0xE1, 0x77, 0x08, 0xE2, 0xC3, 0x1C,
+    0xF2, 0x61, 0xC0, 0x32, 0x48, 0x40, 0x8E, 0x63, 0x59, 0x02, 0x65, 0xE0, 0xBE, 0x7C, 0xCC, 0xE0,
+    0x01, 0xF8, 0x2E, 0x1F, 0x4B, 0x3E, 0x20, 0x77, 0x06, 0xA9, 0xF5, 0xC1, 0x85, 0xDF, 0xB5, 0xA9,
+    0x5F, 0x63, 0xD3, 0xBC, 0x0A, 0x7F, 0x48, 0x8D, 0x07, 0xB8, 0xAC, 0x48, 0x7A, 0x4F, 0x53, 0x29,
+    0x52, 0x48, 0x92, 0x2A, 0xC3, 0xEE, 0x52, 0xE5, 0xD8, 0xFA, 0x49, 0x95, 0x37, 0x2E, 0x3F, 0x6E,
+    0x40, 0xCB, 0xE3, 0xA6, 0xAC, 0x2E, 0x4B, 0xFD, 0x48, 0x3A, 0xFA, 0x59, 0x06, 0xA5, 0xFD, 0x25,
+    0xB9, 0xF9, 0x6F, 0x39, 0x08, 0x96, 0xE4, 0xC1, 0xE2, 0xC2, 0x25, 0xF9, 0xDC, 0xBC, 0x2D, 0xAD,
+    0xD2, 0xE6, 0x68, 0x39, 0x96, 0xA5, 0x8A, 0xC7, 0xE4, 0x1B, 0xE4, 0xD3, 0x10, 0x3F, 0x86, 0xC0,
+    0x3E, 0x3E, 0xEB, 0x49, 0x59, 0x24, 0xFA, 0x88, 0x69, 0xD7, 0x91, 0xE6, 0x6D, 0x44, 0x5B, 0xE0,
+    0xB6, 0xC6, 0x53, 0xE8, 0xF3, 0x17, 0x8F, 0x2B, 0xC5, 0x25, 0xF9, 0x70, 0x8E, 0x67, 0xE5, 0x8B,
+    0x95, 0xC0, 0x54, 0xA1, 0x59, 0x77, 0x06, 0x51, 0xC1, 0x56, 0x0E, 0x2B, 0xE8, 0xFA, 0x50, 0x79,
+    0x2C, 0xD1, 0x48, 0x8C, 0xA3, 0xF0, 0x0C, 0x88, 0x4D, 0x95, 0xCD, 0xD9, 0xE9, 0xBB, 0x1B, 0xF9,
+    0xB9, 0x4C, 0xC2, 0xD0, 0x89, 0xBC, 0x80, 0x25, 0xC4, 0xD6, 0x37, 0xE0, 0x4C, 0xAC, 0xB7, 0xEA,
+    0xAF, 0x0F, 0x62, 0x8A, 0xAB, 0x99, 0x62, 0x44, 0x28, 0x38, 0x85, 0x02, 0x96, 0x44, 0x7D, 0x00,
+    0x9E, 0x8D, 0x44, 0x7B, 0xA1, 0x00, 0x64, 0xF1, 0x34, 0x8E, 0xEF, 0x3D, 0xF9, 0x93, 0x02, 0x51,
+    0x63, 0x36, 0x14, 0x35, 0x71, 0x05, 0xAE, 0x10, 0x2D, 0x3D, 0xFE, 0x82, 0x03, 0x46, 0xE0, 0xA1,
+    0x8F, 0x92, 0xE6, 0x9A, 0x5B, 0x13, 0xC6, 0x4C, 0xD5, 0x0C, 0x53, 0x67, 0xDA, 0xC3, 0x98, 0xFA,
+    0x87, 0x81, 0xC0, 0x79, 0x48, 0xB3, 0x63, 0x09, 0xB5, 0x62, 0xE1, 0x41, 0xB7, 0x60, 0x64, 0xD4,
+    0x59, 0xD2, 0xA6, 0x92, 0x9F, 0x1E, 0x55, 0x50, 0xBB, 0x9E, 0xF3, 0x3E, 0xB4, 0xAC, 0xF2, 0x0A,
+    0xA1, 0x1A, 0x0F, 0x96, 0x55, 0x4D, 0xBE, 0xE8, 0xC3, 0xA2, 0xA9, 0x1B, 0xC9, 0x93, 0xD9, 0x11,
+    0x65, 0xB1, 0xC4, 0x88, 0xA5, 0x10, 0x98, 0x74, 0x28, 0x54, 0x4E, 0x16, 0x78, 0x94, 0x25, 0x30,
+    0x99, 0x69, 0x29, 0xBE, 0xA4, 0x13, 0x4D, 0xC5, 0x43, 0x86, 0x87, 0x0F, 0x08, 0xF0, 0x7C, 0x0C,
+    0xE5, 0xB3, 0x45, 0x61, 0x1B, 0xC8, 0x67, 0x34, 0x84, 0x0F, 0xFF, 0xD1, 0x36, 0x00, 0x78, 0x7E,
+    0xAE, 0x0D, 0x44, 0x9B, 0x07, 0x7B, 0x47, 0xED, 0xE2, 0x89, 0xA0, 0x14, 0xBA, 0x35, 0x27, 0x87,
+    0x5B, 0x6B, 0x28, 0xCC, 0xE6, 0xC6, 0x8C, 0x62, 0x91, 0x55, 0x5E, 0x4F, 0xE1, 0x4C, 0x2E, 0x23,
+    0x53, 0x56, 0x82, 0x65, 0x8C, 0x26, 0x17, 0x2C, 0xE1, 0xCB, 0x11, 0xB1, 0x0C, 0x96, 0xCD, 0xB7,
+    0x23, 0xA0, 0x1B, 0x2C, 0xD1, 0xB3, 0x11, 0xB0, 0x05, 0x0E, 0xFF, 0x3B, 0x00, 0xB8, 0xCC, 0x7E,
+    0xA2, 0x24, 0x7F, 0x85, 0x87, 0x73, 0x79, 0xFD, 0xB9, 0x30, 0x53, 0xEA, 0xCD, 0x53, 0xF6, 0xD6,
+    0x09, 0x2F, 0xB2, 0xDC, 0xCC, 0x53, 0xF4, 0x02, 0xAE, 0xDF, 0x2C, 0x53, 0x74, 0xA6, 0xDE, 0x19,
+    0x22, 0xD1, 0x38, 0x2A, 0x44, 0xC1, 0x01, 0xD2, 0x86, 0xBC, 0xF5, 0xBC, 0xF1, 0xB5, 0xA9, 0x50,
+    0xCC, 0xC1, 0x2B, 0xF1, 0xE2, 0x43, 0x79, 0x07, 0xBB, 0x31, 0x92, 0x8B, 0x83, 0xA2, 0x54, 0xA4,
+    0x89, 0x4D, 0x81, 0x8E, 0xA6, 0x3E, 0x3F, 0x44, 0x97, 0x80, 0x6F, 0x80, 0xFB, 0x21, 0x1D, 0x1C,
+    0x9A, 0x41, 0x32, 0x22, 0xEB, 0xEA, 0x4F, 0x24, 0x19, 0x33, 0xF8, 0xE9, 0x53, 0x70, 0x20, 0x48,
+    0x6E, 0x2D, 0xE0, 0x5D, 0x20, 0xEF, 0xCC, 0xE9, 0x50, 0xB6, 0x81, 0x44, 0x53, 0xD6, 0xD7, 0x4D,
+    0x28, 0x31, 0x38, 0x8B, 0x4B, 0x32, 0xE5, 0xBD, 0x54, 0x1B, 0x5D, 0x25, 0x45, 0xC4, 0x55, 0x0F,
+    0xA0, 0x0C, 0x57, 0x7D, 0x02, 0x65, 0xF8, 0xEF, 0xA7, 0x70, 0x2E, 0xFF, 0xBD, 0xB5, 0x18, 0xFF,
+    0x00, 0x6A, 0x0D, 0x14, 0x08, 0xB5, 0xB0, 0x17, 0x01, 0x8C, 0x55, 0xE8, 0x75, 0xA8, 0x2A, 0x9D,
+    0x26, 0xAD, 0xCB, 0x1F, 0x90, 0x17, 0xAE, 0x3C, 0xD1, 0xC2, 0x49, 0xB5, 0x84, 0xD5, 0x90, 0x9F,
+    0x2B, 0x1F, 0xB9, 0xBD, 0xA2, 0x6F, 0xC5, 0x77, 0x5B, 0x2F, 0x95, 0x35, 0x51, 0x2B, 0xFD, 0xE6,
+    0x1B, 0x9F, 0xAF, 0x56, 0xEC, 0xAD, 0xCE, 0xFF, 0xAE, 0xE2, 0x8A, 0x48, 0x06, 0x4B, 0xEC, 0xC5,
+    0x0F, 0x24, 0x64, 0x94, 0x58, 0xE1, 0x65, 0x34, 0xCF, 0xC2, 0x59, 0xF9, 0x64, 0xE1, 0x27, 0xE2,
+    0xF0, 0xC8, 0x81, 0x04, 0xE8, 0xA2, 0x77, 0x51, 0x3C, 0xD9, 0x77, 0xD0, 0xE6, 0x98, 0x8A, 0x60,
+    0xA9, 0x31, 0x76, 0x39, 0x2C, 0xA9, 0x07, 0xBA, 0xFF, 0x6D, 0x86, 0x2D, 0xB1, 0x36, 0xE1, 0xBB,
+    0x05, 0xF4, 0xCA, 0xA8, 0x43, 0x3D, 0xE6, 0xAD, 0x0E, 0x2F, 0xDF, 0x19, 0x05, 0xDC, 0xCF, 0xB6,
+    0xDB, 0xBF, 0x59, 0xEB, 0x63, 0x14, 0xEB, 0x35, 0xFB, 0xFC, 0xE7, 0x88, 0xCD, 0x28, 0xD2, 0xEA,
+    0x93, 0x2A, 0x2D, 0xB9, 0x6F, 0x20, 0xF3, 0xCD, 0x86, 0xC8, 0x08, 0xAA, 0x0B, 0x33, 0x42, 0xC6,
+    0x77, 0x83, 0x72, 0xC6, 0x08, 0xE5, 0x7B, 0xB4, 0x1A, 0x98, 0xA8, 0x63, 0xCD, 0x1B, 0x46, 0x33,
+    0xDF, 0x1E, 0x3D, 0x1D, 0xD6, 0x06, 0x1C, 0x78, 0xDA, 0xFA, 0x5E, 0x89, 0xBE, 0x29, 0xF3, 0x8D,
+    0x4E, 0xC5, 0x76, 0xBA, 0xB4, 0x53, 0x13, 0x3B, 0x35, 0xED, 0xF6, 0x9A, 0x52, 0x70, 0x58, 0x24,
+    0x54, 0x85, 0xE5, 0x9C, 0x0E, 0xC9, 0xCD, 0x75, 0xB5, 0x7A, 0x29, 0xD0, 0xBE, 0x39, 0x69, 0x61,
+    0xCD, 0xA6, 0x98, 0xAA, 0xA0, 0xA4, 0x2C, 0x5A, 0x50, 0x74, 0x9E, 0x2C, 0x7B, 0x6D, 0xCB, 0xF5,
+    0x53, 0x95, 0x2B, 0xCF, 0x68, 0x51, 0x66, 0xB1, 0xC9, 0x0D, 0x14, 0xCA, 0x9C, 0x7B, 0x03, 0x74,
+    0xCB, 0x30, 0xBF, 0xB0, 0x0C, 0xB8, 0x65, 0x41, 0x7F, 0x9B, 0x2C, 0x12, 0x55, 0x3B, 0x16, 0xB5,
+    0x90, 0xFD, 0xAC, 0xD7, 0xB8, 0x31, 0x36, 0x88, 0x14, 0x86, 0x00, 0x02, 0x87, 0xF2, 0xC8, 0x66,
+    0x9D, 0x50, 0x32, 0x2B, 0x42, 0x80, 0x90, 0xD1, 0x48, 0x3B, 0x47, 0xAC, 0x34, 0x31, 0x05, 0x76,
+    0x73, 0x03, 0x43, 0x27, 0xDF, 0xA8, 0x82, 0xDC, 0x39, 0x50, 0x97, 0x86, 0x5A, 0x34, 0x37, 0xAA,
+    0x77, 0xA4, 0x81, 0xC8, 0xE4, 0x1D, 0xFD, 0xB3, 0x2C, 0xBC, 0xDB, 0x93, 0x2F, 0xB9, 0xE6, 0x72,
+    0xA2, 0x9E, 0xB5, 0x39, 0x49, 0x8D, 0x0E, 0xB5, 0x93, 0xA4, 0xBA, 0x81, 0x76, 0x7B, 0xF7, 0x66,
+    0xD9, 0x9F, 0x63, 0x77, 0x6F, 0x50, 0x39, 0xFF, 0x04, 0xB5, 0x7C, 0xE5, 0x76, 0xC5, 0xB9, 0xDA,
+    0x3D, 0xF5, 0x6B, 0x09, 0xF7, 0xE0, 0x49, 0x1E, 0xFE, 0x7A, 0x1D, 0x97, 0xA9, 0x91, 0x2D, 0x7C,
+    0xED, 0xDD, 0xC8, 0xD7, 0x7A, 0x56, 0x47, 0xDB, 0x98, 0xE9, 0x6E, 0x2F, 0x43, 0xB6, 0x4F, 0x1A,
+    0xB0, 0x72, 0x97, 0x3E, 0xEB, 0x53, 0xBB, 0x7B, 0x6A, 0xFC, 0x13, 0xA1, 0x52, 0xF7, 0xC1, 0xBD,
+    0xDB, 0x0A, 0x1D, 0xE9, 0x33, 0x9D, 0x94, 0x2A, 0xCE, 0xFD, 0xC2, 0x99, 0xA3, 0x08, 0xE5, 0x81,
+    0x3C, 0x26, 0x30, 0xF0, 0x05, 0xF5, 0xC0, 0x86, 0x10, 0x14, 0x15, 0xD4, 0x5A, 0xA4, 0x54, 0x8E,
+    0x72, 0x82, 0xA7, 0x04, 0xE8, 0x98, 0x90, 0x53, 0x52, 0x25, 0xE8, 0xD7, 0x03, 0xCA, 0x13, 0x26,
+    0x01, 0x86, 0x22, 0x99, 0x59, 0xE1, 0x19, 0x75, 0xAD, 0x67, 0x0A, 0x52, 0x45, 0x6D, 0x2E, 0x2F,
+    0xA1, 0xF7, 0x99, 0x37, 0x05, 0xE5, 0xE3, 0x5D, 0xEF, 0x9C, 0xB2, 0x5D, 0xDD, 0x54, 0xEE, 0x26,
+    0x8E, 0x7A, 0xF7, 0x24, 0xE7, 0x4F, 0xD5, 0xEA, 0xCD, 0xB5, 0x2D, 0xC0, 0x02, 0xF7, 0x9D, 0xA7,
+    0xD5, 0xE3, 0x83, 0x4D, 0x2C, 0x8B, 0xF7, 0x75, 0x61, 0x49, 0xCA, 0xDD, 0xAC, 0xA2, 0xC0, 0x95,
+    0x94, 0x07, 0x27, 0x78, 0x56, 0x1B, 0xA3, 0x98, 0x50, 0x4E, 0x0C, 0x25, 0x9F, 0x8A, 0xCA, 0xBB,
+    0xAF, 0xF9, 0x29, 0x4F, 0xB4, 0xD3, 0xFA, 0xB0, 0xAD, 0x15, 0x4B, 0x77, 0x2E, 0x72, 0x0D, 0x60,
+    0xA3, 0x08, 0xD9, 0xB4, 0xFA, 0x2D, 0xEE, 0x54, 0x78, 0xFA, 0x54, 0x43, 0x0A, 0xCB, 0x45, 0xDF,
+    0x62, 0x0A, 0x84, 0x0B, 0x76, 0xAE, 0x30, 0x73, 0x09, 0x3D, 0x9F, 0x74, 0x33, 0x73, 0x2C, 0x6B,
+    0xFE, 0x60, 0xC9, 0xFC, 0x13, 0x63, 0x6E, 0xB3, 0x32, 0x35, 0x5C, 0x9B, 0x87, 0x0B, 0x6E, 0x8A,
+    0xFD, 0xE6, 0xD9, 0x64, 0x4C, 0x8D, 0xDD, 0x2C, 0x85, 0x56, 0x94, 0x53, 0xC3, 0x54, 0xA7, 0xC9,
+    0x38, 0xAD, 0x43, 0x4F, 0xBE, 0x70, 0xFE, 0xE4, 0x04, 0x50, 0x5C, 0x96, 0x97, 0xC7, 0xF2, 0x55,
+    0xBC, 0x37, 0x92, 0x39, 0x66, 0x12, 0xA1, 0xE1, 0x83, 0xE7, 0x87, 0xB1, 0xF6, 0x0D, 0x79, 0x84,
+    0x72, 0xBD, 0x61, 0x2B, 0x85, 0x02, 0x35, 0x16, 0xEE, 0xEA, 0xD3, 0xA2, 0x05, 0x45, 0x0B, 0xE8,
+    0xC3, 0xF3, 0x33, 0xC4, 0x78, 0x7E, 0xCC, 0x5C, 0x0F, 0x9B, 0xE7, 0xB4, 0x5E, 0xB3, 0xE2, 0x8A,
+    0x5A, 0x94, 0x36, 0x7A, 0x76, 0x65, 0x39, 0xD2, 0xF2, 0x19, 0x69, 0xBF, 0xCD, 0x74, 0x76, 0xC7,
+    0x0F, 0x35, 0xD0, 0xBE, 0xDC, 0x0B, 0x7A, 0x58, 0xA7, 0xC7, 0x83, 0x66, 0xA6, 0xAC, 0x82, 0x85,
+    0x60, 0x09, 0x68, 0xD6, 0x14, 0xB2, 0x0A, 0x4E, 0x1B, 0x56, 0xD7, 0x11, 0x1E, 0x19, 0x6A, 0x74,
+    0x60, 0xE9, 0x6B, 0x8E, 0x65, 0xBD, 0x0E, 0x65, 0xA0, 0x09, 0x86, 0x4F, 0xD0, 0x13, 0x69, 0xA5,
+    0x4F, 0x4F, 0x10, 0xE5, 0x21, 0xFB, 0x13, 0x42, 0x3E, 0xE5, 0xB7, 0x30, 0xAE, 0x2E, 0xF9, 0x75,
+    0x29, 0x32, 0x0E, 0xE7, 0x85, 0xFA, 0x41, 0x55, 0x10, 0x6D, 0x4E, 0x8B, 0xFA, 0x10, 0x87, 0x9D,
+    0x60, 0x56, 0xBF, 0xAB, 0x79, 0xE1, 0xB0, 0x0E, 0xC2, 0x66, 0x80, 0x05, 0x28, 0x37, 0x56, 0x1A,
+    0x13, 0x5F, 0x8A, 0x95, 0x6D, 0xA4, 0xB6, 0x12, 0xA3, 0x20, 0x4F, 0x66, 0x65, 0xE9, 0xC4, 0x53,
+    0x5D, 0xAD, 0xEE, 0xD7, 0x56, 0x46, 0xFF, 0x1B, 0x43, 0x04, 0x6C, 0x16, 0xAC, 0xC8, 0x6E, 0xC8,
+    0x61, 0xF9, 0xBC, 0xD0, 0x12, 0xC7, 0xFE, 0xAD, 0x2C, 0xA8, 0xE7, 0xC3, 0xF2, 0xB4, 0xD0, 0x01,
+    0x7F, 0xD4, 0x54, 0xCF, 0x46, 0x2D, 0xFC, 0xD9, 0xA8, 0x80, 0x41, 0x1C, 0x88, 0x14, 0x30, 0xB6,
+    0x16, 0x30, 0x96, 0xAE, 0xD4, 0x0A, 0x68, 0x32, 0x5D, 0xEC, 0x4F, 0x36, 0x3B, 0xA6, 0x5A, 0x7D,
+    0x12, 0x2D, 0xD4, 0x31, 0x92, 0x19, 0xB8, 0x2C, 0x36, 0x7B, 0x87, 0xBB, 0xD0, 0x5B, 0x52, 0x5D,
+    0xD9, 0x6E, 0x8F, 0xE5, 0x4E, 0xAA, 0x9A, 0x2A, 0x48, 0xBA, 0x4B, 0x37, 0x44, 0x9E, 0x17, 0x0C,
+    0x59, 0x45, 0xC3, 0x47, 0x6B, 0xD0, 0x70, 0xB2, 0xD6, 0xE0, 0x5A, 0xB6, 0xDB, 0x6D, 0xB1, 0x7F,
+    0xEE, 0xF3, 0x14, 0x47, 0xB6, 0xDB, 0x10, 0xF8, 0xE1, 0x51, 0xAB, 0x62, 0x5B, 0x7F, 0xAB, 0xE0,
+    0x67, 0x82, 0xFD, 0x93, 0x2C, 0xF0, 0xA1, 0x9E, 0x4E, 0x1A, 0x3D, 0x7D, 0x2F, 0xEA, 0x5F, 0x8F,
+    0xC2, 0x5E, 0xA1, 0xD2, 0xA9, 0x23, 0x31, 0x91, 0x4C, 0x65, 0x04, 0xA0, 0x76, 0xF7, 0x34, 0x3A,
+    0x6A, 0x10, 0x07, 0xFA, 0xD4, 0x43, 0x45, 0xE9, 0x48, 0xC0, 0x94, 0x83, 0x02, 0x66, 0xD8, 0xE8,
+    0x29, 0x3B, 0x52, 0x1A, 0x77, 0xE7, 0x34, 0x69, 0x95, 0x36, 0x3C, 0x7D, 0x13, 0xA1, 0xE5, 0x94,
+    0x55, 0xCC, 0x9E, 0xBC, 0x38, 0xA0, 0xC0, 0xE3, 0x55, 0xE7, 0xE8, 0xA2, 0xCE, 0x9A, 0x7B, 0xAA,
+    0xB8, 0x87, 0x8A, 0x65, 0x26, 0xEA, 0x1E, 0x07, 0x81, 0x91, 0x83, 0xAA, 0xC3, 0xF4, 0xC9, 0x24,
+    0xCE, 0x7A, 0xAD, 0x56, 0xE5, 0xF3, 0xDF, 0xCB, 0x61, 0x11, 0x5B, 0x58, 0x6D, 0xDA, 0xAC, 0x8C,
+    0x15, 0x9A, 0x76, 0x5B, 0x7A, 0x3E, 0xB3, 0x83, 0x2D, 0xE7, 0x15, 0x94, 0x66, 0xA6, 0x14, 0x32,
+    0x94, 0xD9, 0x84, 0xA2, 0x5C, 0x1B, 0xD3, 0x7E, 0xB9, 0x58, 0xF7, 0x9C, 0xF5, 0x50, 0x97, 0x4E,
+    0x81, 0xF5, 0x6C, 0x0D, 0x5D, 0x3E, 0x6E, 0x56, 0xD6, 0xF2, 0xE8, 0xB1, 0x11, 0xED, 0x0A, 0xFE,
+    0x1C, 0xE0, 0xEC, 0x14, 0x80, 0xC0, 0x55, 0xEB, 0x21, 0xE3, 0x42, 0xDF, 0xB2, 0x92, 0xB2, 0x5E,
+    0x30, 0x4D, 0x6E, 0xBD, 0x09, 0x08, 0x65, 0x39, 0xEE, 0xAD, 0x85, 0xDE, 0xDE, 0xD5, 0xA8, 0x57,
+    0x99, 0xAF, 0x5F, 0xBE, 0xEF, 0x58, 0x8F, 0xF3, 0xFD, 0x2F, 0xB7, 0x5F, 0x63, 0xAB, 0x60, 0xE1,
+    0xEE, 0xEC, 0xE2, 0x4F, 0x37, 0x28, 0x11, 0xEF, 0x5D, 0xB9, 0x8E, 0x91, 0xFE, 0xE9, 0x92, 0xFF,
+    0x53, 0xDC, 0x3F, 0x20, 0xF4, 0x99, 0xB8, 0xE7, 0x73, 0xFE, 0x19, 0xD8, 0xBD, 0x29, 0x7F, 0xE7,
+    0x8C, 0xA3, 0x41, 0x1E, 0x59, 0xC1, 0xB8, 0xE9, 0x21, 0x41, 0xEC, 0x9E, 0xA9, 0xB2, 0x71, 0x3B,
+    0x1F, 0xF1, 0x26, 0xAA, 0xD5, 0xE8, 0x25, 0x27, 0x63, 0x56, 0xD8, 0xB4, 0xE9, 0x13, 0xA9, 0xD9,
+    0x1B, 0x19, 0xAA, 0xC4, 0x86, 0x95, 0xBD, 0xCF, 0xD5, 0x2D, 0xA7, 0x3B, 0xBB, 0x16, 0xD8, 0xBF,
+    0x10, 0x28, 0xED, 0x5A, 0xC0, 0x46, 0x86, 0x0B, 0x77, 0x1C, 0x7B, 0x37, 0x1D, 0x36, 0x2C, 0x64,
+    0xFB, 0x97, 0x2A, 0x7B, 0x57, 0x2B, 0xE5, 0xF0, 0xFD, 0xC3, 0x82, 0x52, 0xC2, 0x69, 0xA6, 0x9A,
+    0xD3, 0xC6, 0x13, 0x6D, 0x4A, 0x3A, 0x65, 0x0D, 0xEE, 0xD2, 0x61, 0x7D, 0x7A, 0xA0, 0x83, 0xAA,
+    0x5E, 0xC6, 0xF1, 0x6B, 0x61, 0x9B, 0x44, 0x76, 0x17, 0xD5, 0xD8, 0x25, 0x60, 0xAE, 0x03, 0xE7,
+    0xE9, 0x2A, 0x52, 0x75, 0x50, 0xD5, 0xFC, 0xC1, 0xA3, 0xF2, 0xB1, 0xB1, 0x69, 0x42, 0x77, 0x57,
+    0xAD, 0x54, 0x4D, 0x9D, 0x45, 0xFD, 0xCD, 0xDE, 0x85, 0xFB, 0x3D, 0xF7, 0x1B, 0x02, 0xEC, 0xA8,
+    0x5B, 0x0F, 0x9F, 0x9A, 0xF5, 0x91, 0x9F, 0x2C, 0x47, 0xF5, 0xC1, 0x80, 0x6C, 0xFD, 0x51, 0xF9,
+    0x2D, 0x7D, 0x59, 0xFA, 0xDB, 0xC8, 0x53, 0xAA, 0xB3, 0xEC, 0xAA, 0x24, 0x8A, 0x64, 0x70, 0xE8,
+    0x7E, 0xC1, 0x28, 0x50, 0x11, 0x1D, 0x32, 0xEC, 0xAE, 0xC3, 0x2A, 0x17, 0xD2, 0x0D, 0xA2, 0x68,
+    0x71, 0xB2, 0x1C, 0x49, 0xEB, 0x07, 0x61, 0x1D, 0x25, 0xFC, 0x61, 0xDE, 0x52, 0x2D, 0x38, 0x3C,
+    0x0F, 0x56, 0xE8, 0x41, 0xCA, 0xDA, 0x9A, 0x7D, 0x41, 0x6B, 0xF2, 0x8D, 0xDA, 0xB4, 0x4F, 0x1F,
+    0xBF, 0xDC, 0xFE, 0xD5, 0x57, 0x27, 0x4D, 0xB2, 0x5E, 0xEB, 0xD8, 0x18, 0xD9, 0x21, 0x2F, 0xFD,
+    0xD7, 0xE1, 0xAF, 0x40, 0x2B, 0xA6, 0x70, 0xF6, 0xF6, 0x5B, 0xEE, 0xAE, 0xCB, 0x93, 0xFB, 0x15,
+    0x28, 0xF4, 0xD5, 0x93, 0x18, 0x4E, 0x78, 0xE5, 0xB7, 0x2F, 0x99, 0x27, 0x4D, 0x57, 0x57, 0x81,
+    0x8F, 0x7C, 0xB1, 0xB3, 0x2B, 0xCD, 0x97, 0xE3, 0xCA, 0xFD, 0x20, 0x53, 0x1C, 0x25, 0xDA, 0x9D,
+    0x23, 0xEB, 0xD1, 0xB5, 0xBA, 0x2F, 0xF0, 0xF0, 0xCA, 0xFC, 0xED, 0x4A, 0xEE, 0xB9, 0x9F, 0xCE,
+    0x76, 0xAD, 0x71, 0x1D, 0x8F, 0xD6, 0xB1, 0xC7, 0x73, 0x9B, 0xEF, 0xD9, 0x2C, 0xD7, 0x41, 0x46,
+    0x06, 0x3B, 0xAC, 0xF8, 0x46, 0xE5, 0xA7, 0xED, 0x8F, 0xE5, 0x88, 0xE3, 0xDD, 0x18, 0x2F, 0x0C,
+    0x30, 0x8E, 0x8F, 0x18, 0xD3, 0x5A, 0x54, 0x01, 0x4E, 0x6A, 0xE8, 0xF0, 0x55, 0x6A, 0xBC, 0x40,
+    0xB3, 0xD0, 0x2B, 0x0F, 0x14, 0x14, 0x3D, 0x3D, 0xE5, 0x3D, 0xAF, 0x3A, 0x80, 0xF5, 0x9E, 0x8B,
+    0x0D, 0x01, 0x95, 0xB6, 0x0B, 0x2C, 0xD6, 0xAA, 0xAD, 0xE7, 0x76, 0xE3, 0x0A, 0x2A, 0x8E, 0x82,
+    0xC3, 0x8A, 0x2B, 0xD1, 0xF1, 0x56, 0x43, 0x65, 0xB7, 0xA3, 0xA1, 0x2A, 0xA8, 0x18, 0xE6, 0x0E,
+    0xA5, 0x86, 0x36, 0xD3, 0x9B, 0x2C, 0x64, 0x47, 0xAC, 0x97, 0x59, 0x78, 0x13, 0x3B, 0x42, 0x18,
+    0x60, 0xC7, 0x8A, 0x35, 0x84, 0x35, 0xBA, 0x4F, 0xBF, 0x97, 0x98, 0xDA, 0x94, 0x47, 0x8F, 0x81,
+    0x35, 0x65, 0xBA, 0x9D, 0x9B, 0x72, 0x9D, 0xC4, 0x8C, 0xEA, 0xF1, 0xCA, 0xBD, 0x2E, 0x1F, 0x1E,
+    0xD8, 0x8D, 0xCA, 0x0A, 0xDE, 0x78, 0x9D, 0x0B, 0x83, 0x3B, 0x3F, 0x55, 0xAC, 0xF4, 0xEF, 0xBB,
+    0xDD, 0x15, 0x2F, 0x26, 0xB5, 0xBB, 0x86, 0xED, 0xD1, 0xED, 0xCE, 0xA2, 0xA9, 0x31, 0xED, 0x2A,
+    0x76, 0xC8, 0x68, 0x58, 0x5B, 0x36, 0x8F, 0x09, 0xC3, 0x27, 0x1B, 0xDE, 0xC4, 0x2E, 0xD7, 0x22,
+    0x6D, 0x0C, 0xD7, 0x62, 0x9E, 0x45, 0x87, 0x37, 0x13, 0x76, 0xBF, 0xFE, 0xFD, 0xA4, 0x60, 0x46,
+    0xFD, 0xF6, 0xCA, 0xEE, 0x20, 0xE6, 0xA3, 0x76, 0x91, 0xAD, 0x21, 0xF6, 0x93, 0xBC, 0x07, 0x80,
+    0x55, 0x08, 0x5F, 0x46, 0x9C, 0xDD, 0x22, 0x5F, 0xFD, 0x58, 0xE4, 0x51, 0x65, 0xF3, 0x58, 0x63,
+    0x47, 0x29, 0xCF, 0x2A, 0x43, 0x32, 0xCD, 0x0C, 0xAB, 0x3B, 0x34, 0xF6, 0x84, 0xDB, 0xC4, 0x7A,
+    0xBB, 0x9E, 0xDC, 0xEA, 0x68, 0xFD, 0x99, 0x1E, 0xAA, 0x6C, 0x40, 0x3B, 0x6F, 0xF0, 0xA9, 0xE5,
+    0xD3, 0x18, 0xEB, 0x6D, 0x14, 0x4B, 0x01, 0x1B, 0x02, 0x68, 0x4F, 0xAF, 0x71, 0x3A, 0x24, 0x16,
+    0x8F, 0x66, 0x8D, 0xE6, 0xE8, 0x63, 0xEA, 0x54, 0x96, 0xB5, 0xBA, 0x50, 0xFE, 0xAC, 0xB7, 0xCA,
+    0x45, 0xC9, 0x79, 0x83, 0x7A, 0x1B, 0x8D, 0x94, 0x22, 0xB2, 0x25, 0xEF, 0x22, 0x11, 0x4D, 0x08,
+    0x3C, 0xF6, 0xB7, 0xFA, 0x76, 0xB9, 0x52, 0x9C, 0x8F, 0xA3, 0xAC, 0x9E, 0xE3, 0x35, 0xB7, 0xA3,
+    0xC3, 0x9B, 0x1A, 0xA1, 0xF7, 0x40, 0xFF, 0x0F, 0x63, 0x0D, 0x0D, 0xD1, 0xFF, 0xFF, 0xC7, 0x1E,
+    0x84, 0x7E, 0xD8, 0xFF, 0xFF, 0x22, 0x1A, 0x1A, 0x00, 0x00, 0x55, 0x92, 0xBD, 0x71, 0x83, 0x50,
+    0x10, 0x84, 0x17, 0x18, 0x0F, 0x81, 0x03, 0x12, 0x47, 0x4A, 0x70, 0x07, 0x94, 0xC0, 0x2B, 0x41,
+    0x81, 0xDD, 0x84, 0x9B, 0x10, 0xED, 0xC8, 0x89, 0x13, 0xE7, 0x8F, 0x12, 0x94, 0x38, 0x57, 0x09,
+    0x04, 0x04, 0x78, 0x8C, 0x74, 0xDE, 0xBD, 0x83, 0xF1, 0xF8, 0x05, 0x8F, 0x6F, 0x60, 0xEF, 0x6F,
+    0x0F, 0x00, 0x38, 0x9C, 0x13, 0x74, 0x6A, 0xB3, 0x9B, 0x43, 0x67, 0x66, 0x17, 0x41, 0x26, 0x4C,
+    0x7C, 0x16, 0x66, 0xD9, 0xA1, 0xB2, 0x6B, 0x61, 0x57, 0x87, 0x11, 0xAE, 0xA9, 0x2D, 0x15, 0x64,
+    0xE0, 0xD1, 0x50, 0xDA, 0xD7, 0x11, 0x68, 0xEE, 0x68, 0x3D, 0x8C, 0xC0, 0x78, 0xAA, 0x9B, 0xDB,
+    0x06, 0xED, 0x8A, 0x0F, 0x7B, 0x1F, 0x58, 0x61, 0x95, 0x9E, 0xA7, 0x5F, 0x24, 0x13, 0xCC, 0x92,
+    0xF1, 0x9C, 0x26, 0xB4, 0x0E, 0x79, 0x92, 0x3E, 0xA0, 0x73, 0x60, 0x0A, 0xEA, 0x05, 0x17, 0xE9,
+    0xD5, 0xD7, 0x28, 0x3D, 0x58, 0x79, 0x94, 0x4C, 0x7D, 0x0D, 0x7F, 0x60, 0xF3, 0x93, 0x20, 0x71,
+    0x8E, 0x59, 0x9D, 0x22, 0x40, 0x95, 0x7B, 0x81, 0x2A, 0x37, 0xDE, 0xA9, 0x0A, 0xBE, 0x00, 0x5B,
+    0x41, 0x60, 0x2B, 0xA8, 0x76, 0x96, 0x78, 0xBE, 0x29, 0x20, 0x3C, 0x99, 0x76, 0xB8, 0xEC, 0x90,
+    0xFE, 0x6B, 0xFD, 0x1C, 0xCE, 0xD8, 0x5D, 0xFD, 0x76, 0xE8, 0xE9, 0xC1, 0xE0, 0xDD, 0x87, 0x19,
+    0xE1, 0xEA, 0x66, 0x66, 0xE1, 0xC9, 0x2A, 0x43, 0x98, 0x59, 0xDD, 0x7D, 0x24, 0x94, 0xD9, 0xF8,
+    0x92, 0xAE, 0x72, 0x25, 0xA9, 0x53, 0x98, 0x92, 0x68, 0x3D, 0x25, 0x2F, 0x26, 0xB0, 0x91, 0x9F,
+    0x73, 0x21, 0x57, 0xB9, 0x89, 0x07, 0x1F, 0xA9, 0x56, 0x3F, 0x1A, 0xA9, 0x56, 0x0A, 0x8D, 0x54,
+    0xD9, 0x12, 0x23, 0x31, 0x2A, 0x85, 0x87, 0x79, 0x37, 0xB3, 0xE5, 0x60, 0x6E, 0x66, 0x69, 0x6B,
+    0x98, 0x89, 0xD3, 0x1A, 0x1E, 0x2A, 0xC4, 0x1B, 0x54, 0x12, 0xC1, 0x27, 0x7A, 0xC2, 0xF4, 0x8C,
+    0xFC, 0xC3, 0x28, 0x2D, 0x39, 0xEB, 0xDA, 0x80, 0xBB, 0x20, 0x74, 0xFA, 0x89, 0x5A, 0xA9, 0x5F,
+    0x11, 0xAE, 0xFE, 0x02, 0x4D, 0x8F, 0xBD, 0x0D, 0xC2, 0x30, 0x14, 0x84, 0x2F, 0x76, 0x91, 0x82,
+    0x82, 0x11, 0xCC, 0x06, 0x1E, 0x01, 0x31, 0x07, 0x8B, 0xD0, 0x25, 0xE3, 0x20, 0xB1, 0x02, 0x22,
+    0xD9, 0x84, 0xF4, 0x34, 0x94, 0x2E, 0x12, 0x1F, 0xF7, 0x6C, 0x47, 0xC2, 0xF2, 0xCF, 0xE7, 0xA7,
+    0xEF, 0x9D, 0x6C, 0xE0, 0x6F, 0xDC, 0xDA, 0xD9, 0xE5, 0x06, 0x3D, 0xC7, 0x0A, 0x81, 0x4B, 0x85,
+    0x81, 0xA9, 0x2A, 0x64, 0x6E, 0xCA, 0xA7, 0x4A, 0x61, 0x41, 0x2C, 0xD2, 0x00, 0xF8, 0x54, 0x94,
+    0x96, 0xD4, 0xF3, 0x72, 0x87, 0x49, 0x81, 0xEF, 0x0C, 0x4B, 0x1A, 0x48, 0x42, 0x49, 0x4A, 0x51,
+    0x8C, 0x66, 0x2F, 0x58, 0x75, 0x1B, 0x83, 0x60, 0xF1, 0x5A, 0x67, 0xC1, 0x78, 0x24, 0x53, 0x34,
+    0x57, 0x0D, 0xDF, 0x03, 0xB9, 0x59, 0xC3, 0xEC, 0xE4, 0x7A, 0xAB, 0x62, 0x2A, 0xB0, 0x02, 0x91,
+    0xF9, 0x21, 0x05, 0x90, 0x64, 0x0A, 0xE0, 0x0A, 0xD8, 0x7B, 0xA6, 0xCD, 0x9B, 0x22, 0x29, 0x75,
+    0xA6, 0x48, 0x12, 0xCC, 0x06, 0x6E, 0x75, 0xAC, 0xFF, 0x7A, 0x5D, 0xD7, 0x0A, 0xB1, 0x2A, 0x96,
+    0x34, 0x57, 0xD8, 0x15, 0xE0, 0xB9, 0xC3, 0xC9, 0xB6, 0x1F,
 };
 
 static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
@@ -3319,99 +3325,99 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 0, 0, 156, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 156, 0, 0, 0, 0 }, // U+0020
     { 12, 28, 172, 0, 27, 84, 0 }, // !
-    { 15, 10, 272, 3, 27, 38, 84 }, // "
-    { 25, 27, 388, 0, 27, 169, 122 }, // #
-    { 21, 32, 331, 0, 29, 168, 291 }, // $
-    { 29, 29, 514, 2, 28, 211, 459 }, // %
-    { 26, 29, 425, 1, 28, 189, 670 }, // &
-    { 8, 10, 153, 3, 27, 20, 859 }, // '
-    { 15, 33, 203, 1, 27, 124, 879 }, // (
-    { 15, 34, 205, -3, 28, 128, 1003 }, // )
-    { 19, 19, 328, 3, 29, 91, 1131 }, // *
-    { 20, 19, 343, 1, 23, 95, 1222 }, // +
-    { 10, 10, 172, -2, 5, 25, 1317 }, // ,
-    { 12, 6, 194, 0, 13, 18, 1342 }, // -
-    { 7, 7, 172, 0, 6, 13, 1360 }, // .
-    { 21, 28, 254, -2, 27, 147, 1373 }, // /
-    { 20, 29, 356, 1, 28, 145, 1520 }, // 0
-    { 16, 27, 284, 1, 27, 108, 1665 }, // 1
-    { 22, 28, 331, -1, 28, 154, 1773 }, // 2
-    { 20, 29, 331, 0, 28, 145, 1927 }, // 3
-    { 22, 27, 331, -1, 27, 149, 2072 }, // 4
-    { 21, 28, 331, 0, 27, 147, 2221 }, // 5
-    { 20, 29, 341, 1, 28, 145, 2368 }, // 6
-    { 22, 27, 305, 0, 27, 149, 2513 }, // 7
-    { 21, 29, 334, 0, 28, 153, 2662 }, // 8
-    { 19, 29, 334, 2, 28, 138, 2815 }, // 9
-    { 11, 22, 172, 0, 21, 61, 2953 }, // :
-    { 14, 26, 172, -3, 21, 91, 3014 }, // ;
-    { 20, 21, 343, 1, 24, 105, 3105 }, // <
-    { 20, 12, 343, 1, 19, 60, 3210 }, // =
-    { 20, 21, 343, 1, 24, 105, 3270 }, // >
-    { 17, 29, 275, 2, 28, 124, 3375 }, // ?
-    { 31, 31, 514, 1, 27, 241, 3499 }, // @
-    { 25, 27, 377, -3, 27, 169, 3740 }, // A
-    { 23, 27, 372, 0, 27, 156, 3909 }, // B
-    { 23, 29, 368, 2, 28, 167, 4065 }, // C
-    { 25, 27, 406, 0, 27, 169, 4232 }, // D
-    { 22, 27, 326, 0, 27, 149, 4401 }, // E
-    { 22, 27, 320, 0, 27, 149, 4550 }, // F
-    { 24, 29, 414, 2, 28, 174, 4699 }, // G
-    { 27, 27, 421, 0, 27, 183, 4873 }, // H
-    { 19, 27, 230, -2, 27, 129, 5056 }, // I
-    { 19, 35, 200, -6, 27, 167, 5185 }, // J
-    { 27, 27, 368, 0, 27, 183, 5352 }, // K
-    { 17, 27, 311, 0, 27, 115, 5535 }, // L
-    { 34, 27, 528, 0, 27, 230, 5650 }, // M
-    { 29, 27, 455, 0, 27, 196, 5880 }, // N
-    { 25, 29, 439, 2, 28, 182, 6076 }, // O
-    { 24, 27, 366, 0, 27, 162, 6258 }, // P
-    { 25, 35, 439, 2, 28, 219, 6420 }, // Q
-    { 23, 27, 372, 0, 27, 156, 6639 }, // R
-    { 21, 29, 318, 0, 28, 153, 6795 }, // S
-    { 20, 27, 319, 3, 27, 135, 6948 }, // T
-    { 25, 28, 415, 2, 27, 175, 7083 }, // U
-    { 23, 27, 354, 3, 27, 156, 7258 }, // V
-    { 35, 27, 536, 3, 27, 237, 7414 }, // W
-    { 29, 27, 366, -3, 27, 196, 7651 }, // X
-    { 22, 27, 338, 3, 27, 149, 7847 }, // Y
-    { 24, 27, 322, -2, 27, 162, 7996 }, // Z
-    { 16, 33, 199, -1, 27, 132, 8158 }, // [
-    { 9, 28, 254, 4, 27, 63, 8290 }, // <backslash>
-    { 17, 33, 199, -3, 27, 141, 8353 }, // ]
-    { 20, 18, 331, 0, 27, 90, 8494 }, // ^
-    { 17, 3, 240, -4, -3, 13, 8584 }, // _
-    { 9, 7, 194, 5, 29, 16, 8597 }, // `
-    { 21, 22, 355, 1, 21, 116, 8613 }, // a
-    { 21, 30, 357, 0, 29, 158, 8729 }, // b
-    { 18, 22, 290, 1, 21, 99, 8887 }, // c
-    { 23, 30, 356, 1, 29, 173, 8986 }, // d
-    { 19, 22, 334, 1, 21, 105, 9159 }, // e
-    { 23, 38, 224, -4, 29, 219, 9264 }, // f
-    { 22, 30, 358, 0, 21, 165, 9483 }, // g
-    { 21, 29, 362, 0, 29, 153, 9648 }, // h
-    { 13, 29, 179, 0, 29, 95, 9801 }, // i
-    { 18, 38, 179, -5, 29, 171, 9896 }, // j
-    { 24, 29, 341, 0, 29, 174, 10067 }, // k
-    { 13, 29, 179, 0, 29, 95, 10241 }, // l
-    { 33, 21, 543, 0, 21, 174, 10336 }, // m
-    { 21, 21, 362, 0, 21, 111, 10510 }, // n
-    { 20, 22, 351, 1, 21, 110, 10621 }, // o
-    { 23, 30, 357, -2, 21, 173, 10731 }, // p
-    { 21, 30, 356, 1, 21, 158, 10904 }, // q
-    { 18, 21, 253, 0, 21, 95, 11062 }, // r
-    { 18, 22, 285, 0, 21, 99, 11157 }, // s
-    { 16, 26, 246, 1, 25, 104, 11256 }, // t
-    { 21, 22, 362, 2, 21, 116, 11360 }, // u
-    { 21, 21, 307, 1, 21, 111, 11476 }, // v
-    { 30, 21, 473, 2, 21, 158, 11587 }, // w
-    { 24, 21, 320, -2, 21, 126, 11745 }, // x
-    { 25, 30, 311, -3, 21, 188, 11871 }, // y
-    { 19, 21, 281, -1, 21, 100, 12059 }, // z
-    { 17, 33, 213, -1, 27, 141, 12159 }, // {
-    { 5, 38, 331, 8, 29, 48, 12300 }, // |
-    { 16, 33, 213, -2, 27, 132, 12348 }, // }
-    { 20, 7, 343, 1, 17, 35, 12480 }, // ~
+    { 15, 10, 272, 3, 27, 38, 0 }, // "
+    { 25, 27, 388, 0, 27, 169, 38 }, // #
+    { 21, 32, 331, 0, 29, 168, 207 }, // $
+    { 29, 29, 514, 2, 28, 211, 375 }, // %
+    { 26, 29, 425, 1, 28, 189, 586 }, // &
+    { 8, 10, 153, 3, 27, 20, 775 }, // '
+    { 15, 33, 203, 1, 27, 124, 84 }, // (
+    { 15, 34, 205, -3, 28, 128, 208 }, // )
+    { 19, 19, 328, 3, 29, 91, 795 }, // *
+    { 20, 19, 343, 1, 23, 95, 886 }, // +
+    { 10, 10, 172, -2, 5, 25, 336 }, // ,
+    { 12, 6, 194, 0, 13, 18, 361 }, // -
+    { 7, 7, 172, 0, 6, 13, 379 }, // .
+    { 21, 28, 254, -2, 27, 147, 981 }, // /
+    { 20, 29, 356, 1, 28, 145, 392 }, // 0
+    { 16, 27, 284, 1, 27, 108, 537 }, // 1
+    { 22, 28, 331, -1, 28, 154, 645 }, // 2
+    { 20, 29, 331, 0, 28, 145, 799 }, // 3
+    { 22, 27, 331, -1, 27, 149, 944 }, // 4
+    { 21, 28, 331, 0, 27, 147, 1093 }, // 5
+    { 20, 29, 341, 1, 28, 145, 1240 }, // 6
+    { 22, 27, 305, 0, 27, 149, 1385 }, // 7
+    { 21, 29, 334, 0, 28, 153, 1534 }, // 8
+    { 19, 29, 334, 2, 28, 138, 1687 }, // 9
+    { 11, 22, 172, 0, 21, 61, 1825 }, // :
+    { 14, 26, 172, -3, 21, 91, 1886 }, // ;
+    { 20, 21, 343, 1, 24, 105, 1128 }, // <
+    { 20, 12, 343, 1, 19, 60, 1233 }, // =
+    { 20, 21, 343, 1, 24, 105, 1293 }, // >
+    { 17, 29, 275, 2, 28, 124, 1977 }, // ?
+    { 31, 31, 514, 1, 27, 241, 1398 }, // @
+    { 25, 27, 377, -3, 27, 169, 2101 }, // A
+    { 23, 27, 372, 0, 27, 156, 2270 }, // B
+    { 23, 29, 368, 2, 28, 167, 2426 }, // C
+    { 25, 27, 406, 0, 27, 169, 2593 }, // D
+    { 22, 27, 326, 0, 27, 149, 2762 }, // E
+    { 22, 27, 320, 0, 27, 149, 2911 }, // F
+    { 24, 29, 414, 2, 28, 174, 3060 }, // G
+    { 27, 27, 421, 0, 27, 183, 3234 }, // H
+    { 19, 27, 230, -2, 27, 129, 3417 }, // I
+    { 19, 35, 200, -6, 27, 167, 3546 }, // J
+    { 27, 27, 368, 0, 27, 183, 3713 }, // K
+    { 17, 27, 311, 0, 27, 115, 3896 }, // L
+    { 34, 27, 528, 0, 27, 230, 4011 }, // M
+    { 29, 27, 455, 0, 27, 196, 4241 }, // N
+    { 25, 29, 439, 2, 28, 182, 4437 }, // O
+    { 24, 27, 366, 0, 27, 162, 4619 }, // P
+    { 25, 35, 439, 2, 28, 219, 4781 }, // Q
+    { 23, 27, 372, 0, 27, 156, 5000 }, // R
+    { 21, 29, 318, 0, 28, 153, 5156 }, // S
+    { 20, 27, 319, 3, 27, 135, 5309 }, // T
+    { 25, 28, 415, 2, 27, 175, 1639 }, // U
+    { 23, 27, 354, 3, 27, 156, 5444 }, // V
+    { 35, 27, 536, 3, 27, 237, 5600 }, // W
+    { 29, 27, 366, -3, 27, 196, 5837 }, // X
+    { 22, 27, 338, 3, 27, 149, 6033 }, // Y
+    { 24, 27, 322, -2, 27, 162, 6182 }, // Z
+    { 16, 33, 199, -1, 27, 132, 1814 }, // [
+    { 9, 28, 254, 4, 27, 63, 1946 }, // <backslash>
+    { 17, 33, 199, -3, 27, 141, 2009 }, // ]
+    { 20, 18, 331, 0, 27, 90, 2150 }, // ^
+    { 17, 3, 240, -4, -3, 13, 2240 }, // _
+    { 9, 7, 194, 5, 29, 16, 2253 }, // `
+    { 21, 22, 355, 1, 21, 116, 6344 }, // a
+    { 21, 30, 357, 0, 29, 158, 6460 }, // b
+    { 18, 22, 290, 1, 21, 99, 6618 }, // c
+    { 23, 30, 356, 1, 29, 173, 6717 }, // d
+    { 19, 22, 334, 1, 21, 105, 6890 }, // e
+    { 23, 38, 224, -4, 29, 219, 6995 }, // f
+    { 22, 30, 358, 0, 21, 165, 7214 }, // g
+    { 21, 29, 362, 0, 29, 153, 7379 }, // h
+    { 13, 29, 179, 0, 29, 95, 7532 }, // i
+    { 18, 38, 179, -5, 29, 171, 7627 }, // j
+    { 24, 29, 341, 0, 29, 174, 7798 }, // k
+    { 13, 29, 179, 0, 29, 95, 7972 }, // l
+    { 33, 21, 543, 0, 21, 174, 8067 }, // m
+    { 21, 21, 362, 0, 21, 111, 8241 }, // n
+    { 20, 22, 351, 1, 21, 110, 8352 }, // o
+    { 23, 30, 357, -2, 21, 173, 8462 }, // p
+    { 21, 30, 356, 1, 21, 158, 8635 }, // q
+    { 18, 21, 253, 0, 21, 95, 8793 }, // r
+    { 18, 22, 285, 0, 21, 99, 8888 }, // s
+    { 16, 26, 246, 1, 25, 104, 8987 }, // t
+    { 21, 22, 362, 2, 21, 116, 9091 }, // u
+    { 21, 21, 307, 1, 21, 111, 9207 }, // v
+    { 30, 21, 473, 2, 21, 158, 9318 }, // w
+    { 24, 21, 320, -2, 21, 126, 9476 }, // x
+    { 25, 30, 311, -3, 21, 188, 9602 }, // y
+    { 19, 21, 281, -1, 21, 100, 9790 }, // z
+    { 17, 33, 213, -1, 27, 141, 2269 }, // {
+    { 5, 38, 331, 8, 29, 48, 2410 }, // |
+    { 16, 33, 213, -2, 27, 132, 2458 }, // }
+    { 20, 7, 343, 1, 17, 35, 2590 }, // ~
     { 0, 0, 156, 0, 0, 0, 0 }, // U+00A0
     { 13, 28, 172, -2, 21, 91, 0 }, // U+00A1
     { 17, 29, 331, 3, 28, 124, 91 }, // U+00A2
@@ -3495,19 +3501,19 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 21, 30, 346, 1, 29, 158, 12114 }, // U+00F0
     { 23, 29, 363, 0, 29, 167, 12272 }, // U+00F1
     { 20, 30, 354, 1, 29, 150, 12439 }, // U+00F2
-    { 20, 30, 354, 1, 29, 150, 12589 }, // U+00F3
-    { 20, 30, 354, 1, 29, 150, 12739 }, // U+00F4
-    { 21, 30, 354, 1, 29, 158, 12889 }, // U+00F5
-    { 20, 30, 354, 1, 29, 150, 13047 }, // U+00F6
-    { 20, 19, 343, 1, 23, 95, 13197 }, // U+00F7
-    { 21, 24, 351, 0, 22, 126, 13292 }, // U+00F8
-    { 21, 30, 363, 2, 29, 158, 13418 }, // U+00F9
-    { 21, 30, 363, 2, 29, 158, 13576 }, // U+00FA
-    { 21, 30, 363, 2, 29, 158, 13734 }, // U+00FB
-    { 21, 30, 363, 2, 29, 158, 13892 }, // U+00FC
-    { 25, 38, 311, -3, 29, 238, 14050 }, // U+00FD
-    { 23, 38, 358, -2, 29, 219, 14288 }, // U+00FE
-    { 25, 38, 311, -3, 29, 238, 14507 }, // U+00FF
+    { 20, 30, 354, 1, 29, 150, 9890 }, // U+00F3
+    { 20, 30, 354, 1, 29, 150, 12589 }, // U+00F4
+    { 21, 30, 354, 1, 29, 158, 12739 }, // U+00F5
+    { 20, 30, 354, 1, 29, 150, 12897 }, // U+00F6
+    { 20, 19, 343, 1, 23, 95, 13047 }, // U+00F7
+    { 21, 24, 351, 0, 22, 126, 13142 }, // U+00F8
+    { 21, 30, 363, 2, 29, 158, 13268 }, // U+00F9
+    { 21, 30, 363, 2, 29, 158, 13426 }, // U+00FA
+    { 21, 30, 363, 2, 29, 158, 13584 }, // U+00FB
+    { 21, 30, 363, 2, 29, 158, 13742 }, // U+00FC
+    { 25, 38, 311, -3, 29, 238, 13900 }, // U+00FD
+    { 23, 38, 358, -2, 29, 219, 14138 }, // U+00FE
+    { 25, 38, 311, -3, 29, 238, 14357 }, // U+00FF
     { 26, 33, 377, -3, 33, 215, 0 }, // U+0100
     { 21, 28, 355, 1, 27, 147, 215 }, // U+0101
     { 26, 35, 377, -3, 35, 228, 362 }, // U+0102
@@ -4209,98 +4215,98 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 12, 6, 194, 0, 13, 18, 140 }, // U+2010
     { 12, 6, 194, 0, 13, 18, 158 }, // U+2011
     { 19, 6, 331, 1, 16, 29, 176 }, // U+2012
-    { 18, 6, 288, 0, 13, 27, 205 }, // U+2013
-    { 36, 6, 576, 0, 13, 54, 232 }, // U+2014
-    { 36, 6, 576, 0, 13, 54, 286 }, // U+2015
-    { 15, 38, 331, 3, 29, 143, 340 }, // U+2016
-    { 17, 9, 240, -4, 0, 39, 483 }, // U+2017
-    { 10, 10, 130, 2, 27, 25, 522 }, // U+2018
-    { 10, 10, 130, 1, 27, 25, 547 }, // U+2019
-    { 10, 10, 168, -2, 5, 25, 572 }, // U+201A
-    { 6, 10, 129, 4, 27, 15, 597 }, // U+201B
-    { 18, 10, 260, 2, 27, 45, 612 }, // U+201C
-    { 19, 10, 260, 1, 27, 48, 657 }, // U+201D
-    { 18, 10, 298, -2, 5, 45, 705 }, // U+201E
-    { 15, 10, 260, 3, 27, 38, 750 }, // U+201F
-    { 17, 29, 308, 3, 29, 124, 788 }, // U+2020
-    { 19, 29, 308, 1, 29, 138, 912 }, // U+2021
-    { 12, 13, 226, 2, 20, 39, 1050 }, // U+2022
-    { 13, 15, 211, 1, 21, 49, 1089 }, // U+2023
-    { 7, 7, 300, 4, 6, 13, 1138 }, // U+2024
-    { 18, 7, 345, 0, 6, 32, 1151 }, // U+2025
-    { 28, 7, 500, 0, 6, 49, 1183 }, // U+2026
-    { 8, 7, 193, 2, 13, 14, 1232 }, // U+2027
-    { 0, 0, 360, 0, 0, 0, 1246 }, // U+2028
-    { 0, 0, 360, 0, 0, 0, 1246 }, // U+2029
-    { 9, 28, 0, -1, 23, 63, 1246 }, // U+202A
-    { 9, 28, 0, -8, 23, 63, 1309 }, // U+202B
-    { 10, 31, 0, -5, 26, 78, 1372 }, // U+202C
-    { 10, 31, 0, -5, 26, 78, 1450 }, // U+202D
-    { 10, 31, 0, -5, 26, 78, 1528 }, // U+202E
-    { 0, 0, 100, 0, 0, 0, 1606 }, // U+202F
-    { 43, 29, 731, 2, 28, 312, 1606 }, // U+2030
-    { 56, 29, 948, 2, 28, 406, 1918 }, // U+2031
-    { 12, 10, 170, 2, 27, 30, 2324 }, // U+2032
-    { 20, 10, 308, 2, 27, 50, 2354 }, // U+2033
-    { 29, 10, 446, 2, 27, 73, 2404 }, // U+2034
-    { 10, 10, 170, 2, 27, 25, 2477 }, // U+2035
-    { 19, 10, 308, 2, 27, 48, 2502 }, // U+2036
-    { 28, 10, 446, 2, 27, 70, 2550 }, // U+2037
-    { 13, 13, 211, -3, 4, 43, 2620 }, // U+2038
-    { 12, 18, 196, 1, 19, 54, 2663 }, // U+2039
-    { 11, 18, 194, 0, 19, 50, 2717 }, // U+203A
-    { 30, 30, 508, 1, 28, 225, 2767 }, // U+203B
-    { 23, 28, 337, 0, 27, 161, 2992 }, // U+203C
-    { 16, 29, 276, 3, 28, 116, 3153 }, // U+203D
-    { 18, 5, 300, 3, 33, 23, 3269 }, // U+203E
-    { 19, 9, 322, -2, 0, 43, 3292 }, // U+203F
-    { 20, 9, 322, 3, 30, 45, 3335 }, // U+2040
-    { 20, 25, 230, -4, 16, 125, 3380 }, // U+2041
-    { 42, 34, 692, -1, 29, 357, 3505 }, // U+2042
-    { 12, 6, 194, 0, 13, 18, 3862 }, // U+2043
-    { 25, 27, 75, -10, 27, 169, 3880 }, // U+2044
-    { 16, 33, 199, -1, 27, 132, 4049 }, // U+2045
-    { 17, 33, 199, -3, 27, 141, 4181 }, // U+2046
-    { 33, 29, 544, 2, 28, 240, 4322 }, // U+2047
-    { 28, 29, 452, 2, 28, 203, 4562 }, // U+2048
-    { 30, 29, 447, 0, 28, 218, 4765 }, // U+2049
-    { 19, 21, 319, 2, 21, 100, 4983 }, // U+204A
-    { 21, 34, 373, 3, 29, 179, 5083 }, // U+204B
-    { 21, 20, 385, 1, 21, 105, 5262 }, // U+204C
-    { 21, 20, 385, 2, 21, 105, 5367 }, // U+204D
-    { 19, 19, 325, -1, 10, 91, 5472 }, // U+204E
-    { 10, 26, 171, 1, 21, 65, 5563 }, // U+204F
-    { 25, 39, 322, -2, 30, 244, 5628 }, // U+2050
-    { 23, 38, 325, -1, 29, 219, 5872 }, // U+2051
-    { 16, 29, 253, 0, 28, 116, 6091 }, // U+2052
-    { 36, 8, 600, 1, 15, 72, 6207 }, // U+2053
-    { 20, 9, 322, -4, 0, 45, 6279 }, // U+2054
-    { 21, 21, 344, 0, 20, 111, 6324 }, // U+2055
-    { 19, 29, 335, 1, 28, 138, 6435 }, // U+2056
-    { 34, 10, 530, 2, 27, 85, 6573 }, // U+2057
-    { 29, 29, 510, 1, 28, 211, 6658 }, // U+2058
-    { 29, 29, 511, 1, 28, 211, 6869 }, // U+2059
-    { 8, 29, 164, 1, 28, 58, 7080 }, // U+205A
-    { 24, 31, 428, 1, 30, 186, 7138 }, // U+205B
-    { 29, 30, 497, 1, 28, 218, 7324 }, // U+205C
-    { 7, 30, 169, 2, 29, 53, 7542 }, // U+205D
-    { 7, 29, 171, 2, 28, 51, 7595 }, // U+205E
-    { 0, 0, 133, 0, 0, 0, 7646 }, // U+205F
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2060
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2061
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2062
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2063
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2064
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2066
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2067
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2068
-    { 0, 0, 360, 0, 0, 0, 7646 }, // U+2069
-    { 10, 31, 0, -5, 26, 78, 7646 }, // U+206A
-    { 10, 31, 0, -5, 26, 78, 7724 }, // U+206B
-    { 10, 31, 0, -5, 26, 78, 7802 }, // U+206C
-    { 10, 31, 0, -5, 26, 78, 7880 }, // U+206D
-    { 10, 31, 0, -5, 26, 78, 7958 }, // U+206E
-    { 10, 31, 0, -5, 26, 78, 8036 }, // U+206F
+    { 18, 6, 288, 0, 13, 27, 10040 }, // U+2013
+    { 36, 6, 576, 0, 13, 54, 10067 }, // U+2014
+    { 36, 6, 576, 0, 13, 54, 205 }, // U+2015
+    { 15, 38, 331, 3, 29, 143, 259 }, // U+2016
+    { 17, 9, 240, -4, 0, 39, 402 }, // U+2017
+    { 10, 10, 130, 2, 27, 25, 441 }, // U+2018
+    { 10, 10, 130, 1, 27, 25, 10121 }, // U+2019
+    { 10, 10, 168, -2, 5, 25, 466 }, // U+201A
+    { 6, 10, 129, 4, 27, 15, 491 }, // U+201B
+    { 18, 10, 260, 2, 27, 45, 10146 }, // U+201C
+    { 19, 10, 260, 1, 27, 48, 10191 }, // U+201D
+    { 18, 10, 298, -2, 5, 45, 506 }, // U+201E
+    { 15, 10, 260, 3, 27, 38, 551 }, // U+201F
+    { 17, 29, 308, 3, 29, 124, 589 }, // U+2020
+    { 19, 29, 308, 1, 29, 138, 713 }, // U+2021
+    { 12, 13, 226, 2, 20, 39, 851 }, // U+2022
+    { 13, 15, 211, 1, 21, 49, 890 }, // U+2023
+    { 7, 7, 300, 4, 6, 13, 939 }, // U+2024
+    { 18, 7, 345, 0, 6, 32, 952 }, // U+2025
+    { 28, 7, 500, 0, 6, 49, 10239 }, // U+2026
+    { 8, 7, 193, 2, 13, 14, 984 }, // U+2027
+    { 0, 0, 360, 0, 0, 0, 998 }, // U+2028
+    { 0, 0, 360, 0, 0, 0, 998 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 998 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 1061 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 1124 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 1202 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 1280 }, // U+202E
+    { 0, 0, 100, 0, 0, 0, 1358 }, // U+202F
+    { 43, 29, 731, 2, 28, 312, 1358 }, // U+2030
+    { 56, 29, 948, 2, 28, 406, 1670 }, // U+2031
+    { 12, 10, 170, 2, 27, 30, 2076 }, // U+2032
+    { 20, 10, 308, 2, 27, 50, 2106 }, // U+2033
+    { 29, 10, 446, 2, 27, 73, 2156 }, // U+2034
+    { 10, 10, 170, 2, 27, 25, 2229 }, // U+2035
+    { 19, 10, 308, 2, 27, 48, 2254 }, // U+2036
+    { 28, 10, 446, 2, 27, 70, 2302 }, // U+2037
+    { 13, 13, 211, -3, 4, 43, 2372 }, // U+2038
+    { 12, 18, 196, 1, 19, 54, 2415 }, // U+2039
+    { 11, 18, 194, 0, 19, 50, 2469 }, // U+203A
+    { 30, 30, 508, 1, 28, 225, 2519 }, // U+203B
+    { 23, 28, 337, 0, 27, 161, 2744 }, // U+203C
+    { 16, 29, 276, 3, 28, 116, 2905 }, // U+203D
+    { 18, 5, 300, 3, 33, 23, 3021 }, // U+203E
+    { 19, 9, 322, -2, 0, 43, 3044 }, // U+203F
+    { 20, 9, 322, 3, 30, 45, 3087 }, // U+2040
+    { 20, 25, 230, -4, 16, 125, 3132 }, // U+2041
+    { 42, 34, 692, -1, 29, 357, 3257 }, // U+2042
+    { 12, 6, 194, 0, 13, 18, 3614 }, // U+2043
+    { 25, 27, 75, -10, 27, 169, 3632 }, // U+2044
+    { 16, 33, 199, -1, 27, 132, 3801 }, // U+2045
+    { 17, 33, 199, -3, 27, 141, 3933 }, // U+2046
+    { 33, 29, 544, 2, 28, 240, 4074 }, // U+2047
+    { 28, 29, 452, 2, 28, 203, 4314 }, // U+2048
+    { 30, 29, 447, 0, 28, 218, 4517 }, // U+2049
+    { 19, 21, 319, 2, 21, 100, 4735 }, // U+204A
+    { 21, 34, 373, 3, 29, 179, 4835 }, // U+204B
+    { 21, 20, 385, 1, 21, 105, 5014 }, // U+204C
+    { 21, 20, 385, 2, 21, 105, 5119 }, // U+204D
+    { 19, 19, 325, -1, 10, 91, 5224 }, // U+204E
+    { 10, 26, 171, 1, 21, 65, 5315 }, // U+204F
+    { 25, 39, 322, -2, 30, 244, 5380 }, // U+2050
+    { 23, 38, 325, -1, 29, 219, 5624 }, // U+2051
+    { 16, 29, 253, 0, 28, 116, 5843 }, // U+2052
+    { 36, 8, 600, 1, 15, 72, 5959 }, // U+2053
+    { 20, 9, 322, -4, 0, 45, 6031 }, // U+2054
+    { 21, 21, 344, 0, 20, 111, 6076 }, // U+2055
+    { 19, 29, 335, 1, 28, 138, 6187 }, // U+2056
+    { 34, 10, 530, 2, 27, 85, 6325 }, // U+2057
+    { 29, 29, 510, 1, 28, 211, 6410 }, // U+2058
+    { 29, 29, 511, 1, 28, 211, 6621 }, // U+2059
+    { 8, 29, 164, 1, 28, 58, 6832 }, // U+205A
+    { 24, 31, 428, 1, 30, 186, 6890 }, // U+205B
+    { 29, 30, 497, 1, 28, 218, 7076 }, // U+205C
+    { 7, 30, 169, 2, 29, 53, 7294 }, // U+205D
+    { 7, 29, 171, 2, 28, 51, 7347 }, // U+205E
+    { 0, 0, 133, 0, 0, 0, 7398 }, // U+205F
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2060
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2061
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2062
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2063
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2064
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2066
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2067
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2068
+    { 0, 0, 360, 0, 0, 0, 7398 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 7398 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 7476 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 7554 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 7632 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 7710 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 7788 }, // U+206F
     { 14, 17, 227, 3, 32, 60, 0 }, // U+2070
     { 9, 18, 146, 2, 28, 41, 60 }, // U+2071
     { 15, 17, 227, 1, 32, 64, 101 }, // U+2074
@@ -4376,13 +4382,13 @@ static const EpdGlyph notosans_18_bolditalicGlyphs[] = {
     { 26, 31, 367, -1, 31, 202, 5642 }, // U+20BE
     { 21, 35, 331, 0, 31, 184, 5844 }, // U+20BF
     { 12, 6, 194, 0, 13, 18, 0 }, // U+2212
-    { 36, 38, 428, -5, 29, 342, 0 }, // U+FB00
-    { 31, 38, 402, -4, 29, 295, 342 }, // U+FB01
-    { 31, 38, 402, -4, 29, 295, 637 }, // U+FB02
-    { 44, 38, 600, -5, 29, 418, 932 }, // U+FB03
-    { 44, 38, 600, -5, 29, 418, 1350 }, // U+FB04
-    { 35, 38, 455, -5, 29, 333, 1768 }, // U+FB05
-    { 34, 30, 530, 0, 29, 255, 2101 }, // U+FB06
+    { 36, 38, 428, -5, 29, 342, 10288 }, // U+FB00
+    { 31, 38, 402, -4, 29, 295, 10630 }, // U+FB01
+    { 31, 38, 402, -4, 29, 295, 10925 }, // U+FB02
+    { 44, 38, 600, -5, 29, 418, 11220 }, // U+FB03
+    { 44, 38, 600, -5, 29, 418, 11638 }, // U+FB04
+    { 35, 38, 455, -5, 29, 333, 0 }, // U+FB05
+    { 34, 30, 530, 0, 29, 255, 333 }, // U+FB06
     { 35, 35, 600, 1, 29, 307, 0 }, // U+FFFD
 };
 
@@ -4390,8 +4396,7 @@ static const EpdUnicodeInterval notosans_18_bolditalicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -4399,8 +4404,7 @@ static const EpdUnicodeInterval notosans_18_bolditalicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -4410,19 +4414,57 @@ static const EpdUnicodeInterval notosans_18_bolditalicIntervals[] = {
 };
 
 static const EpdFontGroup notosans_18_bolditalicGroups[] = {
-    { 0, 5467, 13495, 97, 0 },
-    { 5467, 4748, 16014, 96, 97 },
-    { 10215, 6280, 25200, 128, 193 },
-    { 16495, 6235, 22146, 96, 321 },
-    { 22730, 1986, 3502, 112, 417 },
-    { 24716, 15900, 49961, 256, 529 },
-    { 40616, 3742, 21238, 90, 785 },
-    { 44358, 3281, 8809, 111, 875 },
-    { 47639, 1271, 2422, 42, 986 },
-    { 48910, 2985, 6355, 32, 1028 },
-    { 51895, 18, 18, 1, 1060 },
-    { 51913, 758, 2398, 7, 1061 },
-    { 52671, 166, 315, 1, 1068 },
+    { 0, 4828, 12831, 83, 2 },
+    { 4828, 1314, 2863, 26, 0 },
+    { 6142, 4741, 15864, 95, 97 },
+    { 10883, 6280, 25200, 128, 193 },
+    { 17163, 6235, 22146, 96, 321 },
+    { 23398, 1986, 3502, 112, 417 },
+    { 25384, 15900, 49961, 256, 529 },
+    { 41284, 3742, 21238, 90, 785 },
+    { 45026, 3174, 8546, 105, 875 },
+    { 48200, 1271, 2422, 42, 986 },
+    { 49471, 2985, 6355, 32, 1028 },
+    { 52456, 18, 18, 1, 1060 },
+    { 52474, 298, 612, 2, 1066 },
+    { 52772, 166, 315, 1, 1068 },
+};
+
+static const uint16_t notosans_18_bolditalicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_18_bolditalicKernLeftClasses[] = {
@@ -5474,18 +5516,81 @@ static const EpdLigaturePair notosans_18_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_18_bolditalicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 1, 0 }, { 0x0003, 0, 1 }, { 0x0004, 2, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 3, 3 }, { 0x0009, 2, 2 }, // U+0020
+    { 0x000A, 4, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 13, 0 }, { 0x002E, 14, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 15, 0 }, { 0x0033, 10, 10 }, { 0x0034, 16, 0 }, { 0x0035, 0, 13 }, { 0x0036, 17, 14 }, { 0x0037, 18, 15 }, { 0x0038, 19, 16 }, { 0x0039, 19, 16 }, // U+0050
+    { 0x003A, 13, 17 }, { 0x003B, 20, 18 }, { 0x003C, 21, 19 }, { 0x003D, 4, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 22, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 20 }, { 0x0044, 24, 0 }, { 0x0045, 25, 21 }, { 0x0046, 0, 21 }, { 0x0047, 24, 21 }, { 0x0048, 26, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 0, 0 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 27, 0 }, { 0x004E, 0, 0 }, { 0x004F, 0, 25 }, { 0x0050, 0, 25 }, { 0x0051, 24, 21 }, // U+0068
+    { 0x0052, 24, 25 }, { 0x0053, 0, 21 }, { 0x0054, 28, 25 }, { 0x0055, 0, 26 }, { 0x0056, 29, 27 }, { 0x0057, 0, 25 }, { 0x0058, 30, 28 }, { 0x0059, 30, 28 }, // U+0070
+    { 0x005A, 27, 0 }, { 0x005B, 30, 28 }, { 0x005C, 0, 29 }, { 0x005D, 4, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 31, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 32, 30 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 33, 31 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 34, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 32 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 18, 15 }, { 0x009B, 18, 15 }, { 0x009C, 18, 15 }, { 0x009D, 18, 15 }, { 0x009E, 20, 18 }, { 0x009F, 15, 0 }, { 0x00A0, 0, 24 }, // U+00D8
+    { 0x00A1, 23, 21 }, { 0x00A2, 23, 20 }, { 0x00A3, 23, 20 }, { 0x00A4, 23, 20 }, { 0x00A5, 23, 20 }, { 0x00A6, 23, 20 }, { 0x00A7, 24, 20 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 24, 21 }, { 0x00AA, 24, 21 }, { 0x00AB, 24, 21 }, { 0x00AC, 24, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 0, 0 }, { 0x00B0, 35, 0 }, // U+00E8
+    { 0x00B1, 24, 0 }, { 0x00B2, 0, 25 }, { 0x00B3, 24, 21 }, { 0x00B4, 24, 21 }, { 0x00B5, 24, 21 }, { 0x00B6, 24, 21 }, { 0x00B7, 24, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 30, 28 }, { 0x00BF, 24, 0 }, { 0x00C0, 30, 28 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 23, 20 }, { 0x00C3, 7, 9 }, { 0x00C4, 23, 20 }, { 0x00C5, 7, 9 }, { 0x00C6, 23, 20 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 36, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 24, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 24, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 24, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 24, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 24, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 0, 0 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 33 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 37, 34 }, { 0x00EB, 0, 0 }, { 0x00EC, 35, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 38, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 24 }, { 0x00F7, 13, 0 }, { 0x00F8, 27, 0 }, // U+0130
+    { 0x00F9, 27, 25 }, { 0x00FA, 14, 0 }, { 0x00FB, 0, 0 }, { 0x00FC, 14, 0 }, { 0x00FD, 0, 0 }, { 0x00FE, 14, 0 }, { 0x00FF, 36, 0 }, { 0x0100, 14, 0 }, // U+0138
+    { 0x0101, 0, 0 }, { 0x0102, 14, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 0, 25 }, { 0x0106, 0, 0 }, { 0x0107, 0, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 25 }, { 0x010A, 0, 0 }, { 0x010B, 0, 0 }, { 0x010C, 0, 25 }, { 0x010D, 10, 10 }, { 0x010E, 24, 21 }, { 0x010F, 10, 10 }, { 0x0110, 24, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 24, 21 }, { 0x0113, 11, 10 }, { 0x0114, 24, 21 }, { 0x0115, 0, 0 }, { 0x0116, 28, 25 }, { 0x0117, 0, 0 }, { 0x0118, 28, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 28, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 26 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 26 }, { 0x0123, 17, 14 }, { 0x0124, 29, 27 }, { 0x0125, 17, 14 }, { 0x0126, 39, 27 }, { 0x0127, 17, 14 }, { 0x0128, 29, 27 }, // U+0160
+    { 0x0129, 18, 15 }, { 0x012A, 0, 25 }, { 0x012B, 18, 15 }, { 0x012C, 0, 25 }, { 0x012D, 18, 15 }, { 0x012E, 0, 25 }, { 0x012F, 18, 15 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 18, 15 }, { 0x0132, 0, 25 }, { 0x0133, 18, 15 }, { 0x0134, 0, 25 }, { 0x0135, 19, 16 }, { 0x0136, 30, 28 }, { 0x0137, 20, 18 }, { 0x0138, 30, 28 }, // U+0170
+    { 0x0139, 20, 18 }, { 0x013A, 21, 19 }, { 0x013B, 0, 29 }, { 0x013C, 21, 19 }, { 0x013D, 0, 29 }, { 0x013E, 21, 19 }, { 0x013F, 0, 29 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 35 }, { 0x0214, 45, 0 }, { 0x0215, 46, 36 }, { 0x0216, 47, 37 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 48, 38 }, { 0x021A, 44, 39 }, { 0x021B, 44, 0 }, { 0x021C, 49, 35 }, { 0x021D, 50, 0 }, { 0x021E, 0, 0 }, { 0x021F, 51, 40 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 52, 41 }, { 0x0222, 53, 0 }, { 0x0223, 54, 0 }, { 0x0224, 45, 0 }, { 0x0225, 55, 42 }, { 0x0226, 0, 0 }, { 0x0227, 50, 43 }, { 0x0228, 54, 44 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 50, 0 }, { 0x022C, 0, 39 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 56, 36 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 57, 0 }, { 0x0232, 46, 36 }, { 0x0233, 45, 35 }, { 0x0234, 51, 40 }, { 0x0235, 58, 45 }, { 0x0236, 50, 43 }, { 0x0237, 55, 0 }, { 0x0238, 0, 46 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 55, 0 }, { 0x023B, 44, 35 }, { 0x023C, 0, 0 }, { 0x023D, 44, 0 }, { 0x023E, 56, 44 }, { 0x023F, 56, 0 }, { 0x0240, 0, 47 }, // U+0428
+    { 0x0241, 59, 48 }, { 0x0242, 60, 49 }, { 0x0243, 61, 48 }, { 0x0244, 62, 50 }, { 0x0245, 63, 51 }, { 0x0246, 62, 48 }, { 0x0247, 64, 52 }, { 0x0248, 61, 50 }, // U+0430
+    { 0x0249, 59, 53 }, { 0x024A, 59, 53 }, { 0x024B, 65, 54 }, { 0x024C, 59, 55 }, { 0x024D, 59, 54 }, { 0x024E, 59, 54 }, { 0x024F, 66, 48 }, { 0x0250, 67, 54 }, // U+0438
+    { 0x0251, 66, 54 }, { 0x0252, 64, 48 }, { 0x0253, 67, 54 }, { 0x0254, 68, 56 }, { 0x0255, 66, 48 }, { 0x0256, 65, 57 }, { 0x0257, 69, 53 }, { 0x0258, 59, 58 }, // U+0440
+    { 0x0259, 59, 53 }, { 0x025A, 69, 53 }, { 0x025B, 70, 59 }, { 0x025C, 59, 53 }, { 0x025D, 70, 53 }, { 0x025E, 66, 52 }, { 0x025F, 66, 54 }, { 0x0260, 59, 60 }, // U+0448
+    { 0x0261, 62, 48 }, { 0x0262, 62, 48 }, { 0x0263, 71, 61 }, { 0x0264, 62, 50 }, { 0x0265, 64, 48 }, { 0x0266, 72, 62 }, { 0x0267, 0, 0 }, { 0x0268, 73, 63 }, // U+0450
+    { 0x0269, 74, 64 }, { 0x026A, 70, 55 }, { 0x026B, 70, 54 }, { 0x026C, 67, 61 }, { 0x026D, 65, 54 }, { 0x026E, 59, 53 }, { 0x026F, 75, 65 }, { 0x0270, 59, 53 }, // U+0458
+};
+
 static const EpdFontData notosans_18_bolditalic = {
     notosans_18_bolditalicBitmaps,
     notosans_18_bolditalicGlyphs,
     notosans_18_bolditalicIntervals,
-    20,
+    18,
     51,
     41,
     -11,
     true,
     notosans_18_bolditalicGroups,
-    13,
-    nullptr,
+    14,
+    notosans_18_bolditalicGlyphToGroup,
     notosans_18_bolditalicKernLeftClasses,
     notosans_18_bolditalicKernRightClasses,
     notosans_18_bolditalicKernMatrix,
@@ -5495,4 +5600,8 @@ static const EpdFontData notosans_18_bolditalic = {
     83,
     notosans_18_bolditalicLigaturePairs,
     5,
+    notosans_18_bolditalicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
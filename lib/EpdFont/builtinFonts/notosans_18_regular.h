@@ -3,2545 +3,2549 @@
  * name: notosans_18_regular
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_regularBitmaps[40521] = {
-    0xDD, 0x5A, 0x3F, 0xB0, 0xDC, 0xC6, 0x79, 0xDF, 0x3B, 0xE4, 0x09, 0x43, 0x63, 0x12, 0xA8, 0xC8,
-    0xB3, 0x66, 0xCC, 0x99, 0xC0, 0x65, 0xE2, 0xCC, 0x18, 0xAD, 0x1B, 0x1E, 0x30, 0xD1, 0x24, 0x2A,
-    0x5C, 0x84, 0x05, 0x8F, 0x2A, 0x58, 0xB0, 0xF5, 0x48, 0x33, 0x61, 0x93, 0x22, 0x85, 0xF9, 0x16,
-    0x51, 0xE3, 0x42, 0x85, 0x5F, 0x11, 0xA6, 0x48, 0x63, 0x17, 0x71, 0x46, 0x7A, 0x2C, 0xD4, 0xA4,
-    0xB0, 0x93, 0xC7, 0x07, 0x64, 0x54, 0xA6, 0xD0, 0xC5, 0x1E, 0x47, 0xA5, 0xA1, 0x31, 0x33, 0x19,
-    0xD9, 0x05, 0x61, 0x07, 0x89, 0x8E, 0x24, 0x80, 0xF5, 0xEF, 0xF7, 0x5B, 0x00, 0xEF, 0x1E, 0x45,
-    0xBD, 0x47, 0x51, 0x74, 0x32, 0x93, 0xBB, 0xC3, 0xB7, 0x77, 0x87, 0xDD, 0x6F, 0xBF, 0xFD, 0xF6,
-    0xFB, 0xBF, 0x48, 0xAB, 0x6C, 0x7C, 0xA7, 0x55, 0x5A, 0xF8, 0x77, 0x52, 0x24, 0xB9, 0x7F, 0xC7,
-    0x7C, 0x9B, 0xD8, 0xEC, 0x19, 0xBE, 0xF6, 0x4C, 0x56, 0xD9, 0x4D, 0xB6, 0xC9, 0xAA, 0x3D, 0x63,
-    0x97, 0x5B, 0xBB, 0xEC, 0x00, 0x0F, 0x16, 0xDB, 0x15, 0x3F, 0xED, 0xCA, 0xB4, 0x57, 0xF8, 0x69,
-    0xF0, 0x31, 0xE6, 0xEB, 0x78, 0x1B, 0x93, 0x99, 0x15, 0xE0, 0x4A, 0xF0, 0xB6, 0xB9, 0x02, 0x78,
-    0x6C, 0xBE, 0x2D, 0x78, 0x0C, 0xD8, 0xE1, 0x6D, 0xCC, 0x16, 0xEF, 0xC8, 0xE1, 0xD5, 0x09, 0xF6,
-    0x2F, 0xDD, 0x7D, 0x74, 0xF7, 0xD1, 0x3B, 0x26, 0x68, 0x02, 0xA0, 0x09, 0xEA, 0xA0, 0x06, 0xDC,
-    0x04, 0x1B, 0x63, 0xC2, 0x2A, 0x04, 0x8C, 0xAA, 0xA8, 0x32, 0xFB, 0x37, 0x7F, 0x7A, 0xF3, 0xA7,
-    0x57, 0x33, 0xF6, 0x6F, 0x3C, 0x34, 0x29, 0xC8, 0x35, 0x26, 0xC5, 0x9B, 0xD3, 0x66, 0xF3, 0xB4,
-    0x2B, 0x4D, 0x7B, 0x1B, 0x6F, 0x83, 0xA9, 0x8F, 0xE7, 0xC9, 0xCD, 0x55, 0x5C, 0xCB, 0xE6, 0x0C,
-    0x28, 0x9D, 0x27, 0x25, 0x4F, 0xDD, 0x63, 0x67, 0xB2, 0xB7, 0x9A, 0xAF, 0x98, 0x92, 0x37, 0x4E,
-    0x66, 0x60, 0x09, 0xB2, 0x1F, 0x03, 0xA4, 0x98, 0x13, 0x9D, 0x1F, 0x6A, 0x18, 0x68, 0x0C, 0x5D,
-    0x0F, 0x2C, 0x8F, 0x5D, 0x0E, 0x54, 0xB6, 0x02, 0x88, 0x05, 0x36, 0x13, 0x48, 0xAA, 0x7F, 0x5C,
-    0x36, 0x65, 0x51, 0x02, 0x3D, 0x06, 0x60, 0xA2, 0xCB, 0xCE, 0x15, 0x9F, 0xA2, 0x40, 0x60, 0xF7,
-    0xB5, 0x60, 0xA7, 0x63, 0xA2, 0x6F, 0xC8, 0x2A, 0x13, 0xFF, 0xB8, 0x53, 0xA7, 0x24, 0x3F, 0x36,
-    0x61, 0xED, 0x39, 0x8C, 0x99, 0xD4, 0x26, 0x05, 0x97, 0x3B, 0x2D, 0x3E, 0xD3, 0x92, 0xD9, 0x76,
-    0xBE, 0x5D, 0xB6, 0xBE, 0x0D, 0xEA, 0x7D, 0xF5, 0x8F, 0xFE, 0x05, 0x74, 0xA7, 0xE6, 0x76, 0xFC,
-    0x1D, 0x50, 0x13, 0x17, 0x5D, 0x16, 0x6F, 0x7A, 0x13, 0x3D, 0xDE, 0x1E, 0xC4, 0xC5, 0xCA, 0x04,
-    0xAE, 0xEE, 0x92, 0x1C, 0x98, 0xDE, 0x58, 0xB4, 0x9E, 0xA9, 0x41, 0x93, 0x1A, 0xB2, 0x38, 0xDA,
-    0x64, 0x6A, 0xE3, 0xCA, 0xB7, 0xBC, 0xCB, 0x76, 0x35, 0x32, 0xBF, 0x33, 0x1A, 0xB7, 0x20, 0xCE,
-    0x15, 0x87, 0x61, 0x04, 0x58, 0x83, 0xBD, 0x0B, 0x1C, 0x17, 0x00, 0x62, 0xC9, 0x2F, 0x2F, 0x50,
-    0xF3, 0x2B, 0xF4, 0xFF, 0xA5, 0xE4, 0x22, 0x38, 0xFA, 0x0B, 0xC7, 0x66, 0x30, 0x19, 0x96, 0xB4,
-    0xE8, 0x4C, 0x5A, 0x09, 0x61, 0x52, 0xE9, 0x17, 0x1B, 0x4C, 0xC3, 0x7B, 0xE8, 0x52, 0xB2, 0xA7,
-    0xFD, 0x13, 0x8D, 0x4B, 0x1F, 0x70, 0x8D, 0x26, 0x76, 0x1B, 0x36, 0x91, 0x90, 0x18, 0x8B, 0x3D,
-    0xD9, 0xCF, 0x97, 0xCE, 0xD6, 0x26, 0xCB, 0xA3, 0x2E, 0xDE, 0x62, 0xF1, 0x71, 0x1D, 0x70, 0x24,
-    0xF0, 0xBA, 0xA2, 0x27, 0xA6, 0xEC, 0x23, 0x20, 0xCC, 0x4D, 0xFC, 0xB8, 0x65, 0xB3, 0x04, 0xB7,
-    0x89, 0xDE, 0x55, 0xEC, 0xB2, 0x00, 0x6D, 0x49, 0x6B, 0x12, 0x49, 0xC7, 0x91, 0xFB, 0xB5, 0xC3,
-    0x7D, 0x08, 0x49, 0x59, 0x99, 0x5B, 0xAE, 0x35, 0x29, 0x76, 0xE3, 0x9A, 0xE6, 0xB1, 0xF6, 0x60,
-    0xB5, 0x5A, 0x5D, 0xB9, 0x72, 0x05, 0x2B, 0xE7, 0x26, 0x9C, 0x90, 0xD8, 0x60, 0x6B, 0x42, 0xB0,
-    0xA0, 0x36, 0x90, 0x82, 0x44, 0xE8, 0x38, 0x5B, 0xCE, 0xFB, 0xF6, 0x33, 0x3E, 0xBC, 0x9B, 0x9B,
-    0xB4, 0x60, 0x7F, 0x8C, 0x8A, 0x6B, 0x62, 0x08, 0x5A, 0x62, 0xC3, 0x7A, 0x39, 0x32, 0x29, 0x6E,
-    0xFB, 0xB6, 0x9A, 0xEE, 0x6E, 0x75, 0xB7, 0x57, 0x87, 0x72, 0x07, 0x0B, 0x26, 0x4B, 0x3F, 0xF5,
-    0xD9, 0xA5, 0xE0, 0x84, 0xA3, 0x3C, 0x9D, 0x81, 0xE8, 0x04, 0x4E, 0xDC, 0x3C, 0xA0, 0xEC, 0xBD,
-    0x63, 0xC4, 0xEF, 0x5D, 0x40, 0x19, 0x14, 0x58, 0xE5, 0x6D, 0x58, 0x67, 0xFD, 0x23, 0xD7, 0x58,
-    0xEA, 0xDF, 0xDE, 0x9B, 0xC3, 0x9D, 0x1C, 0xBB, 0x48, 0xEE, 0xFF, 0x0C, 0x9C, 0x4B, 0xFF, 0x1C,
-    0x5B, 0x60, 0x41, 0x99, 0x19, 0x02, 0x20, 0xEF, 0x96, 0x20, 0xED, 0xAF, 0xCC, 0x2C, 0xDD, 0xBF,
-    0x6F, 0xA4, 0x88, 0x17, 0x80, 0xAF, 0x1D, 0x0D, 0x47, 0x7F, 0x4F, 0xFD, 0xDE, 0x0A, 0x3C, 0xC3,
-    0x08, 0x81, 0xC5, 0xD5, 0xA8, 0x89, 0xA1, 0x75, 0x49, 0x95, 0x54, 0x69, 0x4E, 0xCD, 0xF8, 0xB6,
-    0x79, 0xE3, 0xE8, 0x10, 0x6A, 0x8A, 0xCF, 0xFE, 0x3A, 0xDF, 0xB5, 0x63, 0x94, 0x67, 0x2F, 0x94,
-    0xE0, 0x0B, 0x17, 0x4E, 0x9E, 0x90, 0x29, 0xD4, 0x1A, 0xAE, 0x98, 0x5A, 0x43, 0x4B, 0xC4, 0xA5,
-    0xC4, 0xE7, 0x77, 0x0D, 0xC6, 0xAE, 0x60, 0xA2, 0xBA, 0x26, 0x53, 0x57, 0xE3, 0xBB, 0xFA, 0x57,
-    0x0A, 0x71, 0x5C, 0xD0, 0x62, 0x85, 0xEE, 0xBD, 0xCE, 0xC4, 0xCD, 0x62, 0x60, 0x47, 0xEB, 0x77,
-    0x4A, 0x7B, 0x6A, 0x39, 0xCB, 0x09, 0x71, 0x9C, 0x10, 0x59, 0x3F, 0x81, 0xE6, 0xB3, 0x40, 0x7D,
-    0x32, 0x82, 0x78, 0xC3, 0xB1, 0x1B, 0x61, 0xA1, 0x08, 0x55, 0xDA, 0xCC, 0xB8, 0x31, 0xCE, 0x04,
-    0xC3, 0x8D, 0x9E, 0xF3, 0xB6, 0xA4, 0x80, 0x5A, 0x45, 0xFB, 0x07, 0x9D, 0x0A, 0xA1, 0x5D, 0x9D,
-    0x71, 0x5D, 0xD8, 0x77, 0xE9, 0x47, 0x5D, 0xFA, 0xD7, 0xDD, 0x25, 0x2C, 0xE5, 0xB9, 0x3F, 0x7A,
-    0xDD, 0x02, 0xFE, 0x90, 0x33, 0xA5, 0xEE, 0x3D, 0xA8, 0xF0, 0x06, 0xB3, 0xFF, 0xAE, 0xF1, 0xEA,
-    0x4A, 0x45, 0xF6, 0xFA, 0x7B, 0x0A, 0xC8, 0x22, 0xB1, 0x53, 0xAA, 0xBC, 0xA0, 0x22, 0x07, 0x94,
-    0xB2, 0x98, 0xD2, 0x92, 0xB1, 0x07, 0xA5, 0x2A, 0xE8, 0x2E, 0xFA, 0x8B, 0xA6, 0xB5, 0x39, 0x05,
-    0x13, 0x2D, 0x1B, 0xD2, 0x02, 0xE5, 0x76, 0x77, 0x9D, 0x49, 0x0F, 0x4D, 0x59, 0x5D, 0x1A, 0xC9,
-    0xE0, 0x16, 0xED, 0x82, 0x6A, 0x46, 0x84, 0x0B, 0xCC, 0xC2, 0x90, 0x0D, 0xC1, 0x7D, 0x08, 0xE2,
-    0x7B, 0x32, 0x25, 0xA5, 0x86, 0xD1, 0x50, 0x51, 0x1A, 0xB4, 0xDF, 0x1E, 0xE8, 0x67, 0xD4, 0xE8,
-    0xEE, 0x5F, 0x62, 0xB3, 0x2B, 0xFB, 0xF1, 0x0D, 0x97, 0x43, 0x31, 0x7A, 0x9A, 0x79, 0x0C, 0xD8,
-    0xBB, 0x2A, 0x6A, 0xC4, 0x03, 0x8F, 0x66, 0xE1, 0x08, 0x03, 0xC1, 0xE8, 0x67, 0x62, 0xC6, 0xF7,
-    0x44, 0x81, 0xB7, 0x6E, 0x84, 0xCB, 0x2D, 0x61, 0xD0, 0x10, 0xC6, 0x95, 0xA4, 0x29, 0x27, 0xB4,
-    0xE2, 0x9B, 0xEC, 0x20, 0xA4, 0x13, 0x30, 0x94, 0xD6, 0x62, 0x01, 0x5E, 0x77, 0x09, 0xE9, 0x14,
-    0x8B, 0x5D, 0x38, 0x71, 0xFB, 0x3C, 0x18, 0x93, 0xE0, 0x53, 0xE0, 0xB7, 0xA8, 0x38, 0x03, 0xD2,
-    0xFC, 0x0C, 0xC8, 0xFE, 0xF4, 0x2A, 0x59, 0xE4, 0x0E, 0x09, 0xB6, 0xE6, 0xF7, 0xEE, 0xDC, 0x1A,
-    0x88, 0xCB, 0xE5, 0x13, 0x2F, 0x93, 0xA7, 0x70, 0xDA, 0xEF, 0x3A, 0x81, 0xCD, 0xBF, 0x0F, 0x46,
-    0x98, 0xF2, 0x07, 0xD0, 0x84, 0x92, 0x7B, 0x96, 0x38, 0x0E, 0xDD, 0xCF, 0x67, 0xF7, 0x57, 0x02,
-    0x5F, 0xE2, 0x68, 0xD4, 0x1E, 0x1D, 0xC1, 0xEC, 0x92, 0xD7, 0xDB, 0x69, 0x13, 0x84, 0x47, 0x82,
-    0x93, 0x99, 0x49, 0xC5, 0x4E, 0x16, 0xFF, 0x94, 0x9B, 0x93, 0x14, 0xC2, 0xD7, 0x97, 0x18, 0x86,
-    0xD6, 0xE5, 0xB2, 0xE2, 0x8E, 0x93, 0x0F, 0x1C, 0x29, 0x8D, 0xB9, 0x37, 0xAB, 0x0D, 0x35, 0xA6,
-    0xA6, 0xE9, 0xDF, 0xA4, 0xEC, 0x07, 0x79, 0x2A, 0xF3, 0x70, 0xB8, 0x31, 0x50, 0x59, 0xB6, 0x54,
-    0x16, 0x92, 0x7C, 0x6D, 0x47, 0xBC, 0x5A, 0x81, 0x79, 0xC3, 0xE7, 0x15, 0x69, 0x73, 0x45, 0x09,
-    0x6D, 0x02, 0x6D, 0xB1, 0x59, 0x76, 0x93, 0x84, 0x3C, 0xAD, 0xAF, 0xF5, 0x3E, 0x6E, 0xB4, 0xAC,
-    0x92, 0xE6, 0xF0, 0x6C, 0xDF, 0x74, 0xEE, 0x5B, 0x4E, 0x7D, 0x27, 0x23, 0x72, 0x48, 0x27, 0x04,
-    0x87, 0x34, 0x40, 0xAC, 0x93, 0x1A, 0x34, 0xD3, 0xB4, 0x57, 0xDA, 0x7D, 0x2E, 0xC6, 0x7F, 0x93,
-    0xB7, 0x01, 0xAF, 0x4A, 0x13, 0xF6, 0x4B, 0xAA, 0xFF, 0x03, 0x86, 0x2F, 0x14, 0x06, 0x8B, 0x65,
-    0xC1, 0x25, 0xC2, 0x49, 0xB7, 0xE0, 0x2A, 0xFA, 0x59, 0x9A, 0x9D, 0x64, 0xB6, 0x38, 0x61, 0x23,
-    0xC0, 0x9F, 0x4D, 0x29, 0x0E, 0x01, 0x55, 0x95, 0x3C, 0xBC, 0xEE, 0xF2, 0x90, 0xB2, 0xE1, 0x83,
-    0x9E, 0xC5, 0xB5, 0x89, 0xA0, 0xCB, 0x44, 0x4A, 0x82, 0x02, 0x77, 0x77, 0x30, 0x51, 0x0B, 0x82,
-    0x92, 0x0D, 0xF0, 0xA6, 0x74, 0x61, 0xA0, 0x25, 0x6C, 0x32, 0x8A, 0x32, 0x41, 0xEB, 0x41, 0x4E,
-    0x00, 0x43, 0xD1, 0xB2, 0x4B, 0x1B, 0xB7, 0xC6, 0xB6, 0xA1, 0xBB, 0xFB, 0x49, 0x0B, 0xB6, 0xFF,
-    0x04, 0x52, 0x3D, 0xD0, 0x92, 0x7A, 0xC5, 0x62, 0x9C, 0xF3, 0x24, 0xEF, 0xC8, 0x8F, 0xA0, 0x37,
-    0xCB, 0x75, 0xD9, 0x62, 0x4A, 0xC7, 0xE0, 0x82, 0x0C, 0x5F, 0xE3, 0xFA, 0xD2, 0x19, 0xF3, 0xFE,
-    0xE9, 0xD7, 0xAE, 0xF9, 0x5F, 0x16, 0x71, 0x93, 0xB4, 0x09, 0xDC, 0xC5, 0x22, 0x7F, 0x6A, 0xDF,
-    0x3C, 0xAE, 0xE9, 0x48, 0xC8, 0xD9, 0x0C, 0x4E, 0xF1, 0xD8, 0xFC, 0x70, 0xF6, 0x5F, 0x0B, 0x0A,
-    0x62, 0xB2, 0x35, 0x8A, 0x0F, 0x40, 0xF0, 0xF4, 0xA5, 0xE7, 0x97, 0x8D, 0xFF, 0x42, 0xEB, 0x07,
-    0x70, 0x5F, 0xD1, 0x08, 0x67, 0xB0, 0x5B, 0x05, 0x3B, 0xDA, 0x5C, 0x6E, 0xE7, 0x52, 0x71, 0x0F,
-    0xB1, 0x78, 0x7C, 0xE6, 0x77, 0xF6, 0xD7, 0xEB, 0x75, 0x4E, 0x95, 0xDD, 0x08, 0xAC, 0xF9, 0xF3,
-    0x69, 0xA4, 0x51, 0x0A, 0xAB, 0xB9, 0x5F, 0xF5, 0x32, 0xFF, 0xBB, 0x62, 0xA6, 0x29, 0x35, 0xB9,
-    0xC8, 0x10, 0x65, 0x9E, 0x34, 0x48, 0x8B, 0x46, 0xEA, 0x2B, 0x67, 0x4B, 0x01, 0x5E, 0x62, 0x27,
-    0x92, 0x15, 0x61, 0x0B, 0x17, 0xF2, 0x0F, 0x03, 0x26, 0xCC, 0x6A, 0x45, 0x8B, 0x78, 0xBD, 0x3C,
-    0xCD, 0xB8, 0x84, 0x42, 0x41, 0xCD, 0x37, 0xD9, 0xE0, 0x9A, 0xAF, 0x4B, 0x0F, 0x25, 0xB8, 0xDD,
-    0x28, 0xEC, 0x93, 0x17, 0xDC, 0x7A, 0xA3, 0x4C, 0xF5, 0x77, 0x5E, 0xAC, 0xF9, 0xD3, 0x9B, 0x2F,
-    0x33, 0xC6, 0xE7, 0xD0, 0xF1, 0x9D, 0xA5, 0x5C, 0x22, 0x63, 0x0A, 0x6F, 0x18, 0x79, 0xF1, 0xFB,
-    0x25, 0xDD, 0x79, 0xF3, 0xE3, 0x51, 0xDC, 0xA5, 0x70, 0x20, 0xA0, 0x54, 0x84, 0x81, 0xA8, 0xDB,
-    0x6E, 0x7C, 0x3F, 0x6A, 0x4C, 0xEF, 0x75, 0x48, 0x8A, 0x06, 0xAD, 0x82, 0xFF, 0xDD, 0xBF, 0x86,
-    0xC9, 0xE2, 0x0A, 0xB2, 0x54, 0xC5, 0x45, 0x9A, 0x23, 0xA8, 0xDF, 0x44, 0x88, 0x57, 0xD3, 0x4D,
-    0xB4, 0x09, 0xAB, 0x15, 0xFB, 0x54, 0xC1, 0xE6, 0xB6, 0xB9, 0xA7, 0xF6, 0x18, 0xA4, 0xA3, 0xAD,
-    0x8F, 0x11, 0xD7, 0xC4, 0x68, 0xBB, 0x85, 0xDA, 0x8D, 0x6F, 0xC3, 0xAA, 0xD3, 0xFF, 0x51, 0xC5,
-    0x7E, 0x30, 0x10, 0xC5, 0x31, 0x14, 0xDC, 0x6E, 0x10, 0x39, 0x9B, 0xEC, 0xDF, 0xFF, 0xE7, 0xE1,
-    0xC0, 0xC8, 0x1B, 0x9B, 0xC0, 0xB0, 0x72, 0x39, 0xD0, 0xC5, 0xC8, 0x50, 0x4E, 0x22, 0x3B, 0x19,
-    0x00, 0xED, 0xC1, 0xC8, 0xCD, 0xEC, 0xA1, 0xB9, 0x21, 0x45, 0x1F, 0x0D, 0x09, 0xB4, 0x71, 0xF0,
-    0x7B, 0xBC, 0xF6, 0x3D, 0x23, 0x05, 0xC3, 0x72, 0x6D, 0x8C, 0x3C, 0x39, 0x44, 0xBE, 0x75, 0x25,
-    0x78, 0x8F, 0xC1, 0x99, 0xE9, 0x32, 0xAD, 0x9A, 0xF6, 0x2F, 0x68, 0xBD, 0xA3, 0xA0, 0x0B, 0x8B,
-    0x6A, 0x1F, 0x7E, 0x84, 0xE2, 0x39, 0xA7, 0x4E, 0x8B, 0xE5, 0x96, 0x3C, 0xE7, 0xE6, 0x94, 0xEB,
-    0x75, 0x4F, 0x3D, 0x45, 0x12, 0xB2, 0x10, 0x5C, 0x0E, 0x47, 0x47, 0x65, 0xC1, 0x6E, 0x49, 0xE5,
-    0x43, 0x1C, 0x9A, 0xD6, 0x48, 0x3E, 0x27, 0x6C, 0x68, 0x7F, 0x82, 0x2D, 0xA7, 0x40, 0xAE, 0x27,
-    0xA3, 0x26, 0x01, 0x1A, 0xAC, 0x7B, 0x94, 0x1B, 0xB9, 0x37, 0x06, 0x7F, 0xB0, 0x1C, 0x8B, 0x52,
-    0x76, 0xB4, 0xB1, 0xDC, 0x10, 0x4B, 0x8A, 0xCE, 0x80, 0xA8, 0x91, 0x71, 0xB1, 0xEB, 0xEB, 0xF2,
-    0x8A, 0xED, 0x38, 0x16, 0x3F, 0x37, 0xD3, 0xB0, 0x80, 0x13, 0x68, 0x96, 0x45, 0x7F, 0x06, 0xE8,
-    0x46, 0x48, 0x90, 0x2A, 0xD4, 0xDC, 0x10, 0x10, 0xCB, 0xFD, 0x59, 0x7E, 0x6E, 0xF1, 0xBB, 0x12,
-    0x37, 0x39, 0x3E, 0xC9, 0xFD, 0x5F, 0x20, 0xE2, 0x31, 0x93, 0x9C, 0x7B, 0x7F, 0xE1, 0xCD, 0xE9,
-    0xE8, 0x84, 0x6D, 0x3E, 0xFB, 0x0C, 0x6F, 0x5C, 0x2F, 0x80, 0xBE, 0xBF, 0x1F, 0x2B, 0xCF, 0x06,
-    0x61, 0x3A, 0xDD, 0xA4, 0xB0, 0xF7, 0x0A, 0x52, 0x30, 0xA7, 0x29, 0x87, 0xBB, 0xBD, 0x64, 0x96,
-    0x19, 0xA1, 0x9C, 0x88, 0xD9, 0xBB, 0xC6, 0x4D, 0x7E, 0xC4, 0x98, 0x51, 0x7F, 0x6B, 0x21, 0x98,
-    0x7D, 0x0F, 0xE6, 0x8B, 0xFC, 0xE9, 0x09, 0x21, 0x1F, 0x56, 0x9A, 0x60, 0x45, 0x2B, 0x61, 0x42,
-    0xFE, 0x80, 0x7A, 0x6B, 0x46, 0x26, 0x8E, 0x30, 0xDC, 0x81, 0xD1, 0xA7, 0xA0, 0xEF, 0xEF, 0xC7,
-    0x66, 0xD5, 0x8C, 0xD3, 0xE3, 0xD7, 0x5C, 0x8B, 0xB2, 0x9D, 0x68, 0x70, 0xF4, 0xAE, 0x10, 0xC0,
-    0x43, 0x4F, 0x1B, 0x7F, 0xEB, 0x1A, 0xB9, 0xF3, 0x99, 0xD7, 0x7A, 0x7D, 0x0D, 0xFD, 0x3A, 0x5D,
-    0xFC, 0x7E, 0x51, 0x7F, 0x89, 0xF9, 0x88, 0xDB, 0x5F, 0xCF, 0x3E, 0xD7, 0x93, 0xF3, 0x1D, 0x1D,
-    0xBD, 0xF3, 0x4C, 0x63, 0xCE, 0x04, 0xDE, 0x94, 0x93, 0x87, 0x34, 0xBE, 0x2A, 0x17, 0x38, 0xC6,
-    0x65, 0x90, 0x9B, 0xB0, 0x0A, 0xDC, 0x8E, 0x9C, 0x34, 0x9F, 0x43, 0x4E, 0x52, 0xB7, 0x7D, 0x02,
-    0x42, 0x59, 0xD8, 0x1F, 0x2A, 0x53, 0x08, 0x4A, 0x7D, 0xE0, 0x07, 0x01, 0x63, 0x26, 0x07, 0x5B,
-    0xCA, 0x49, 0xB0, 0xA5, 0x9C, 0xC0, 0x4C, 0x96, 0xC3, 0x51, 0xB9, 0x65, 0xC8, 0x03, 0x11, 0x59,
-    0x94, 0x0C, 0xA2, 0xCC, 0x62, 0xED, 0xE7, 0x8A, 0xFD, 0xEE, 0x3F, 0x2F, 0x84, 0xCF, 0xB8, 0x55,
-    0x59, 0xF9, 0x85, 0x11, 0x1E, 0x1D, 0x1D, 0xBD, 0xF7, 0xC5, 0x70, 0xEE, 0x42, 0x06, 0x42, 0xCD,
-    0x65, 0x77, 0xF8, 0x45, 0x52, 0x05, 0x7C, 0x5E, 0x1A, 0x72, 0x8F, 0x8A, 0x2E, 0x1E, 0x51, 0xCF,
-    0x0B, 0xFE, 0x28, 0xE7, 0xCE, 0xE0, 0x23, 0x0B, 0x88, 0x78, 0x79, 0x7F, 0xDC, 0xC7, 0x85, 0x74,
-    0x0D, 0xDE, 0x4B, 0x81, 0x9F, 0x32, 0x65, 0xA6, 0x5F, 0xF4, 0x55, 0x56, 0xDE, 0xCA, 0x2A, 0x00,
-    0xB3, 0x92, 0x02, 0x8B, 0x38, 0x06, 0x50, 0x49, 0x89, 0x55, 0x70, 0x66, 0x13, 0x9A, 0x12, 0x2B,
-    0xF7, 0x68, 0x65, 0xBD, 0xED, 0x63, 0x5A, 0x65, 0xFB, 0x6F, 0x4E, 0xF8, 0x4B, 0x06, 0x57, 0xF2,
-    0xC1, 0x56, 0xD2, 0x64, 0xE5, 0x28, 0xAD, 0x61, 0x02, 0x3C, 0xCD, 0x32, 0xCE, 0x98, 0x68, 0xF6,
-    0x48, 0x16, 0x00, 0x13, 0x5B, 0xA5, 0x35, 0x9F, 0x47, 0xAE, 0x9F, 0xEB, 0xDA, 0xD5, 0x41, 0x05,
-    0x02, 0xBD, 0x55, 0xBC, 0xD9, 0xDB, 0x56, 0x71, 0x83, 0xE5, 0x6A, 0xB2, 0xFE, 0x60, 0x6C, 0x18,
-    0xCB, 0xDE, 0xEB, 0x0F, 0x38, 0xB4, 0xEB, 0x0F, 0xE0, 0x0A, 0x16, 0xDB, 0xFE, 0x00, 0xB1, 0x66,
-    0xD0, 0xF6, 0x07, 0xF0, 0x37, 0x41, 0x83, 0x66, 0xC3, 0x98, 0x91, 0xC9, 0x7E, 0x5C, 0xF5, 0x36,
-    0x60, 0x4A, 0xD2, 0x5B, 0xF8, 0x9C, 0x34, 0x87, 0xFD, 0x46, 0xE6, 0x65, 0xD0, 0xF4, 0x08, 0x9E,
-    0xD0, 0xF0, 0x37, 0x9A, 0xCC, 0x37, 0xE9, 0x5B, 0x2D, 0x9B, 0xE4, 0xFD, 0x86, 0x4D, 0xFC, 0x61,
-    0xCD, 0x26, 0xFA, 0xE5, 0x86, 0x0D, 0x33, 0x23, 0x35, 0x05, 0x1B, 0xBA, 0xCE, 0xDE, 0xB3, 0x8F,
-    0xCD, 0x3D, 0x36, 0x54, 0xB1, 0x9A, 0x61, 0x00, 0xCC, 0xA0, 0x12, 0x74, 0x06, 0x31, 0x80, 0x0A,
-    0x5C, 0x0F, 0x9C, 0x20, 0x3A, 0x01, 0x62, 0x27, 0x01, 0xB1, 0x1B, 0x80, 0x21, 0xEB, 0x31, 0x07,
-    0x08, 0xCC, 0x01, 0x81, 0x8E, 0x26, 0xD4, 0xE6, 0x84, 0x59, 0x45, 0x18, 0xD7, 0x84, 0x61, 0x4B,
-    0x18, 0x74, 0x32, 0xB0, 0x88, 0x44, 0x01, 0xCB, 0x57, 0x09, 0xB3, 0xF7, 0xE5, 0xC9, 0x7E, 0x4E,
-    0x18, 0x7D, 0x22, 0xBF, 0xE5, 0x1A, 0x99, 0x56, 0x19, 0xDE, 0x52, 0x30, 0x13, 0x4C, 0x9A, 0xD3,
-    0x24, 0x86, 0xAA, 0x4D, 0x45, 0xEF, 0xC7, 0xB8, 0xAD, 0x90, 0xAB, 0x00, 0xD5, 0xC8, 0xBE, 0x69,
-    0x79, 0x28, 0x28, 0x90, 0x00, 0x5A, 0x0A, 0x16, 0xBD, 0x7C, 0x12, 0xEA, 0x73, 0x84, 0x5C, 0x06,
-    0x28, 0x2B, 0x4A, 0xEF, 0x78, 0x4A, 0x6F, 0x9F, 0x2E, 0x6C, 0xBC, 0xD9, 0xC7, 0x38, 0x9F, 0x1F,
-    0xE5, 0x23, 0xCE, 0xD4, 0xCF, 0xC0, 0xF9, 0x20, 0x90, 0xE3, 0xEC, 0x4B, 0xF8, 0x4D, 0x72, 0x10,
-    0x7E, 0x8B, 0xE9, 0x68, 0x22, 0x8F, 0xC0, 0xF8, 0x40, 0x4E, 0x53, 0x31, 0xBE, 0x75, 0x1F, 0x4B,
-    0x74, 0x5A, 0xEF, 0x2F, 0xAC, 0x79, 0x05, 0x2E, 0xD8, 0x4C, 0x49, 0x83, 0x1D, 0x5D, 0x8E, 0x1C,
-    0xB9, 0x5C, 0x90, 0xFF, 0xC9, 0x1B, 0xF2, 0x63, 0x65, 0x61, 0xD7, 0x6F, 0x3A, 0x8E, 0xDD, 0x12,
-    0xC0, 0xEB, 0x1C, 0xFD, 0xCD, 0x68, 0x54, 0x3F, 0x17, 0xF8, 0x7F, 0xC2, 0xD1, 0x9B, 0x5E, 0x34,
-    0xC2, 0x6E, 0x0C, 0xAB, 0xC7, 0x80, 0xBE, 0xF2, 0x35, 0x02, 0x7F, 0x33, 0xDE, 0x9A, 0x91, 0xFB,
-    0xE0, 0x7D, 0x3E, 0xF3, 0x9E, 0x06, 0xE2, 0x25, 0x57, 0xD8, 0x91, 0x1E, 0xCF, 0xE7, 0x7A, 0x62,
-    0x7B, 0x54, 0x9F, 0xE1, 0x3D, 0xBB, 0x2C, 0xC6, 0x3A, 0x84, 0xE5, 0xE4, 0x96, 0x8C, 0xB2, 0xE4,
-    0x8A, 0x8C, 0x9C, 0xA5, 0x17, 0xB2, 0xCC, 0x52, 0xED, 0x68, 0x7A, 0x6C, 0x7E, 0x06, 0x73, 0x34,
-    0x47, 0x66, 0xB2, 0x80, 0xCA, 0xF3, 0x1E, 0x2A, 0x7E, 0xAC, 0xE8, 0x46, 0x2B, 0x10, 0x79, 0x39,
-    0x4F, 0xE6, 0x4C, 0x55, 0x95, 0x9C, 0xF4, 0xB4, 0xCE, 0xA3, 0xBC, 0x4D, 0xB9, 0xAD, 0xB6, 0x4B,
-    0x4C, 0x48, 0x94, 0x37, 0x6A, 0xDF, 0x7C, 0x46, 0xA4, 0x65, 0x0B, 0x87, 0x82, 0xB4, 0x68, 0xA7,
-    0x94, 0xA2, 0x1B, 0xDF, 0xA0, 0x98, 0x65, 0x8F, 0x90, 0xE6, 0x66, 0xAC, 0xE3, 0x5C, 0xA6, 0xF8,
-    0xA8, 0x9E, 0x22, 0xCF, 0x96, 0x97, 0x3B, 0xF0, 0xAC, 0xB7, 0xFE, 0xBF, 0x87, 0x07, 0xF2, 0x96,
-    0xE5, 0xFF, 0x22, 0x3C, 0x8D, 0x1C, 0x21, 0xA7, 0xF4, 0x44, 0x39, 0xE5, 0xD3, 0x51, 0x9A, 0x10,
-    0x7A, 0x04, 0xEE, 0x17, 0x88, 0xFB, 0x8C, 0xE2, 0x3E, 0x5F, 0x55, 0xF1, 0xB5, 0x96, 0x13, 0x25,
-    0x29, 0xA5, 0x18, 0x4F, 0xE9, 0x46, 0xB6, 0x5F, 0x50, 0x84, 0x94, 0xB3, 0x55, 0x4C, 0x63, 0x54,
-    0x45, 0x90, 0xA1, 0xA4, 0xCC, 0x33, 0x5D, 0x18, 0x28, 0x36, 0xDE, 0x8D, 0x2F, 0x55, 0x79, 0xE6,
-    0x9F, 0xA5, 0x12, 0x76, 0xEF, 0x40, 0x31, 0x64, 0x63, 0x7C, 0x09, 0x92, 0xE5, 0x88, 0x62, 0x2C,
-    0xB3, 0x8C, 0x41, 0x6B, 0xD0, 0x0E, 0x0A, 0x97, 0x94, 0xBA, 0xF5, 0x52, 0x84, 0x41, 0x12, 0x5F,
-    0x4A, 0xFC, 0xE5, 0x92, 0x7C, 0x26, 0x3B, 0xFA, 0x61, 0x9F, 0x5B, 0x92, 0xBC, 0x40, 0x06, 0x1E,
-    0x08, 0x19, 0xE0, 0x47, 0xCC, 0x51, 0x58, 0x76, 0x8E, 0x6B, 0x4C, 0x44, 0x89, 0x42, 0x06, 0xB3,
-    0x51, 0x0D, 0x3A, 0xA9, 0x40, 0x73, 0xF2, 0x41, 0x05, 0x89, 0x04, 0x3D, 0xE9, 0x77, 0x59, 0x1B,
-    0x03, 0x79, 0xD9, 0x37, 0x6B, 0xF8, 0x1F, 0x50, 0x9B, 0x85, 0xA3, 0x06, 0x1C, 0x04, 0x0D, 0x58,
-    0x80, 0x55, 0xDC, 0xC3, 0xBF, 0x2A, 0x86, 0x77, 0x8B, 0x4E, 0xE5, 0x74, 0x7E, 0xE5, 0xEA, 0x06,
-    0x78, 0xB3, 0x9E, 0x89, 0x6D, 0x89, 0x1E, 0x27, 0x5C, 0x69, 0x86, 0x31, 0x2A, 0x6F, 0x67, 0xAF,
-    0x01, 0x1D, 0xD7, 0x9B, 0xBE, 0xBD, 0xC1, 0x24, 0x2C, 0x00, 0x60, 0xCA, 0xE4, 0x03, 0x96, 0x8A,
-    0xF1, 0x85, 0x97, 0x89, 0x1F, 0x14, 0xBA, 0x44, 0x5F, 0x48, 0x39, 0x25, 0xC5, 0x8A, 0x3B, 0xB9,
-    0x06, 0xFF, 0x85, 0xC9, 0xC2, 0x30, 0xD6, 0x8C, 0xA8, 0x6D, 0xD4, 0xA3, 0xA4, 0xA0, 0x62, 0xA8,
-    0x82, 0x0B, 0x86, 0xFB, 0x22, 0xFF, 0xD2, 0x27, 0xBA, 0xCE, 0x33, 0x39, 0xF7, 0x7B, 0xE4, 0x77,
-    0xAD, 0x54, 0x05, 0xA9, 0x93, 0x4D, 0x11, 0x33, 0x7D, 0x15, 0xD4, 0xCA, 0xB0, 0xD8, 0xCD, 0xFC,
-    0x8F, 0xBF, 0x1B, 0xFC, 0x4A, 0xF5, 0xD3, 0xDA, 0x99, 0xB1, 0x5C, 0x0C, 0x6C, 0xE4, 0xF5, 0x09,
-    0x35, 0x0F, 0x13, 0x21, 0xDC, 0xC1, 0x8C, 0x98, 0x2E, 0xD2, 0xEC, 0xA4, 0xC4, 0x9B, 0x50, 0x6F,
-    0x33, 0x13, 0x96, 0xCF, 0x40, 0x21, 0x55, 0x0E, 0xC2, 0xC6, 0xD4, 0x5D, 0x19, 0x6F, 0xCF, 0xFE,
-    0x9E, 0x48, 0x7C, 0x9E, 0x36, 0xBC, 0xF0, 0x51, 0x24, 0x17, 0x1B, 0x7F, 0xA4, 0xAA, 0xD7, 0x7F,
-    0x89, 0x1E, 0xD1, 0xE6, 0x6B, 0x16, 0xC6, 0xF9, 0x10, 0x3C, 0xFF, 0x62, 0x90, 0xD9, 0x60, 0xBB,
-    0x7B, 0x80, 0xE0, 0x03, 0x7C, 0x59, 0x9B, 0xB9, 0xD4, 0xEB, 0x2B, 0xCE, 0xDD, 0x64, 0x76, 0xCE,
-    0xBF, 0x59, 0x9F, 0xB9, 0x39, 0x7C, 0xD6, 0x4D, 0x1E, 0x67, 0x9E, 0x02, 0x98, 0x26, 0xFF, 0xE9,
-    0x54, 0x25, 0x79, 0x81, 0x9F, 0x19, 0xF3, 0xC1, 0x58, 0x56, 0xE1, 0xAA, 0xBD, 0xC6, 0xF9, 0x2A,
-    0x02, 0x45, 0x94, 0xE2, 0xC2, 0x12, 0xC0, 0x5C, 0xA9, 0xB1, 0x63, 0x67, 0x89, 0x58, 0xE5, 0x0B,
-    0x15, 0xEC, 0x1C, 0x8C, 0x9D, 0xE7, 0xB2, 0xCE, 0xC9, 0xD4, 0x39, 0xF7, 0x9D, 0x63, 0x75, 0xCE,
-    0xDC, 0xF8, 0xD1, 0xE9, 0xD4, 0x8B, 0xFC, 0x9C, 0x62, 0x36, 0xED, 0x5C, 0x17, 0x1D, 0x8C, 0xD7,
-    0x17, 0x13, 0x7D, 0x40, 0x12, 0xBE, 0x49, 0x81, 0xE7, 0xA9, 0xF0, 0x8A, 0xE7, 0xA0, 0xAC, 0xD9,
-    0xE0, 0x73, 0xCC, 0x43, 0xD1, 0x15, 0x17, 0x90, 0xF2, 0xA4, 0x31, 0x2E, 0x40, 0x69, 0x54, 0x25,
-    0x30, 0x16, 0x75, 0xC6, 0x33, 0x1C, 0xB2, 0xA7, 0xFB, 0x1A, 0x92, 0xA0, 0x43, 0x0A, 0x42, 0x2D,
-    0xF0, 0x46, 0xCE, 0xCD, 0x82, 0xAC, 0x73, 0xC9, 0x9D, 0x38, 0xB2, 0x37, 0x96, 0x60, 0x18, 0xD8,
-    0x07, 0x74, 0xDA, 0xCB, 0x87, 0x7F, 0x86, 0x99, 0x8B, 0x27, 0x0F, 0x2F, 0xE2, 0xF1, 0xDB, 0x57,
-    0xE0, 0x03, 0x59, 0x47, 0xA9, 0xA2, 0xE1, 0x4E, 0x52, 0xA5, 0x2C, 0xC3, 0x67, 0x85, 0x57, 0x26,
-    0xD9, 0x62, 0x29, 0x26, 0x0F, 0xD7, 0x17, 0xAE, 0x4A, 0xFF, 0xFB, 0xE6, 0x83, 0x2A, 0x76, 0xEE,
-    0xED, 0x6A, 0xE9, 0xFA, 0xA8, 0x32, 0x7B, 0xE0, 0xE9, 0xB7, 0xA6, 0x42, 0xF1, 0x85, 0x00, 0x54,
-    0xF5, 0x74, 0x9D, 0x7D, 0x09, 0x1F, 0xE8, 0xFA, 0xD7, 0x9D, 0x61, 0x14, 0x55, 0xB8, 0x7C, 0x2A,
-    0x6D, 0xCB, 0x04, 0xCA, 0x20, 0x0E, 0x73, 0xF5, 0x56, 0x60, 0x18, 0x41, 0xD4, 0xB8, 0x51, 0xDB,
-    0xD1, 0x99, 0xB5, 0x62, 0x20, 0x28, 0x8B, 0x61, 0xB8, 0xE1, 0x4C, 0x47, 0xA4, 0x5B, 0x79, 0x66,
-    0x1D, 0x65, 0x2A, 0x0B, 0x75, 0xED, 0x12, 0xCA, 0x13, 0x0D, 0xD7, 0x1B, 0xCA, 0x35, 0xC5, 0x9A,
-    0x9A, 0x5E, 0x8E, 0x65, 0xE8, 0x61, 0x24, 0xAD, 0xDF, 0xF9, 0x5D, 0x8E, 0xE9, 0x32, 0xFB, 0x22,
-    0xFA, 0x7D, 0x39, 0x1A, 0xFE, 0x4E, 0x38, 0x90, 0x77, 0xD7, 0xE3, 0x19, 0xE9, 0xF2, 0x70, 0x2E,
-    0xEA, 0x9E, 0x03, 0xF6, 0xAE, 0x02, 0x94, 0xEE, 0xB5, 0x06, 0x7B, 0xF0, 0x9F, 0x4D, 0xDC, 0x5F,
-    0x77, 0x0D, 0x78, 0x6B, 0x69, 0xF3, 0x53, 0x45, 0x97, 0x2A, 0x49, 0x37, 0xE7, 0xAF, 0xB6, 0x9C,
-    0x42, 0x51, 0x0E, 0x4B, 0x3C, 0x82, 0x78, 0xB8, 0xF1, 0x98, 0x48, 0x7F, 0x02, 0xE3, 0xED, 0x5E,
-    0x6D, 0xC6, 0x43, 0x30, 0x1F, 0xE0, 0xB2, 0x1E, 0x0E, 0x5A, 0xA3, 0xFE, 0x95, 0x9E, 0x36, 0x40,
-    0xB6, 0x4A, 0xA6, 0x4A, 0xF1, 0x5F, 0xC2, 0x03, 0xB9, 0x44, 0xF5, 0xD6, 0x11, 0x40, 0x98, 0x8A,
-    0x61, 0xAE, 0xCA, 0x97, 0x73, 0xAD, 0xC0, 0x1F, 0x7B, 0x00, 0x77, 0x1E, 0xBA, 0xBF, 0x2D, 0xF3,
-    0x85, 0x02, 0x93, 0x54, 0x0F, 0x0A, 0xA8, 0xBA, 0xF7, 0xC6, 0x21, 0xDC, 0x40, 0xAB, 0xE7, 0x07,
-    0xB2, 0xEA, 0xAA, 0x06, 0x9E, 0xEC, 0x30, 0xB3, 0x67, 0x8C, 0xA5, 0x98, 0x2D, 0xDF, 0x1F, 0xD6,
-    0x67, 0xFE, 0x7F, 0xEE, 0x4B, 0xA7, 0x4F, 0x25, 0x16, 0x8C, 0xA5, 0xFF, 0x1C, 0xFC, 0x7C, 0xFD,
-    0x31, 0xF7, 0xF4, 0x09, 0x7E, 0x46, 0xE7, 0xF2, 0x33, 0x7C, 0x92, 0x9F, 0x42, 0x00, 0x54, 0xCE,
-    0x6F, 0x12, 0x18, 0xF8, 0x1A, 0xF9, 0x79, 0xBA, 0x8F, 0x51, 0x7D, 0x7A, 0x8A, 0xF1, 0x07, 0x39,
-    0x44, 0x2D, 0x71, 0xA5, 0x63, 0x28, 0xAC, 0x62, 0x47, 0xF1, 0xB9, 0x65, 0x5F, 0x27, 0x3A, 0xBD,
-    0x19, 0x86, 0xEB, 0x93, 0xEC, 0x17, 0x5E, 0xF6, 0x13, 0x29, 0x00, 0xDD, 0xC9, 0x08, 0xFA, 0xE7,
-    0x03, 0x5F, 0x92, 0x1B, 0xCB, 0x8A, 0x4B, 0x63, 0x92, 0x81, 0x10, 0xFF, 0x99, 0xDE, 0x66, 0x59,
-    0xD0, 0x8A, 0xC0, 0xB3, 0x00, 0x2E, 0x77, 0x6A, 0xF5, 0x2F, 0xD0, 0x34, 0xC2, 0x90, 0xF0, 0x20,
-    0x8F, 0x05, 0xFB, 0x67, 0xE7, 0x9B, 0x00, 0x7C, 0x54, 0xCF, 0x12, 0x44, 0x4F, 0xEA, 0xF4, 0xA8,
-    0x43, 0x4F, 0x89, 0xED, 0xE9, 0xB6, 0x7A, 0x7A, 0xC3, 0x9E, 0x02, 0xDB, 0x4B, 0xAF, 0xFD, 0x19,
-    0x0E, 0xF6, 0xCD, 0xBD, 0xDD, 0xFA, 0x83, 0x7B, 0x74, 0x66, 0xCA, 0xCD, 0x4A, 0x7B, 0xCF, 0x54,
-    0xA7, 0xE7, 0x32, 0x7B, 0xFA, 0xBC, 0x11, 0xB3, 0x29, 0xF3, 0x6F, 0xF5, 0xE7, 0xBC, 0x24, 0xF4,
-    0x6B, 0x1E, 0x68, 0xBA, 0x9A, 0x62, 0x0F, 0x53, 0x03, 0x5F, 0x3C, 0x98, 0xE1, 0xE1, 0x8D, 0x7E,
-    0xDC, 0x49, 0x28, 0x82, 0x0C, 0x99, 0x1D, 0x8F, 0xE9, 0x64, 0x41, 0x9D, 0xF1, 0x27, 0x99, 0x83,
-    0x5A, 0x6D, 0x6C, 0x36, 0xEE, 0xD4, 0x6F, 0xA5, 0x9D, 0x88, 0x14, 0x85, 0xE0, 0x50, 0xFF, 0xDB,
-    0x92, 0x32, 0x19, 0x57, 0x68, 0x4B, 0x4D, 0x73, 0x83, 0x58, 0x09, 0x4C, 0xC8, 0xA1, 0x4B, 0x74,
-    0x12, 0x53, 0xCE, 0x55, 0x8E, 0xE1, 0xB1, 0x07, 0xDB, 0x7E, 0x06, 0xFA, 0x79, 0x32, 0x15, 0xD6,
-    0x19, 0x0B, 0x2B, 0xFC, 0x8D, 0xEB, 0x98, 0x08, 0x42, 0xF2, 0x73, 0xA1, 0x94, 0x38, 0x9D, 0x4D,
-    0xF9, 0xC4, 0x7B, 0x6F, 0xE3, 0x87, 0x53, 0xC7, 0x51, 0x9C, 0xE7, 0x38, 0x4E, 0xAD, 0xE8, 0x19,
-    0xC7, 0x91, 0xD0, 0x71, 0x64, 0x15, 0xB0, 0x95, 0x85, 0xA3, 0xE3, 0x90, 0x37, 0xF2, 0x7E, 0x89,
-    0xB3, 0x3D, 0xAB, 0x54, 0x3E, 0xCD, 0x20, 0xBD, 0x58, 0x03, 0xFF, 0xE1, 0x53, 0x0C, 0xD2, 0xC5,
-    0x60, 0xDD, 0x45, 0xAE, 0xCB, 0x86, 0xCE, 0xBD, 0xCB, 0x73, 0xE3, 0x8A, 0xC7, 0xD8, 0x4E, 0xF6,
-    0x7D, 0x10, 0xE1, 0xE7, 0x7F, 0x58, 0xE3, 0x07, 0xF7, 0xEF, 0x47, 0xB0, 0x70, 0xE9, 0x7F, 0x7C,
-    0x99, 0xBB, 0xF3, 0x72, 0x36, 0x45, 0x65, 0x95, 0x3F, 0xE3, 0xD3, 0xC1, 0x1F, 0x8F, 0xB4, 0x23,
-    0x1D, 0xBA, 0xB5, 0xBE, 0x06, 0xB0, 0x98, 0x4F, 0xD0, 0xBE, 0x8A, 0x78, 0x39, 0xBB, 0x73, 0x93,
-    0x21, 0x6B, 0x7D, 0x99, 0xF9, 0x19, 0xB3, 0xB3, 0x3F, 0x1C, 0x1F, 0x6D, 0x19, 0x83, 0x32, 0xE6,
-    0x07, 0x29, 0xF2, 0x78, 0xE6, 0xF2, 0xAF, 0xF4, 0xEB, 0x7C, 0x39, 0xFE, 0xF7, 0xAC, 0xD7, 0x62,
-    0xCC, 0x2F, 0x8C, 0xBB, 0xC3, 0xB2, 0x02, 0x58, 0x47, 0xB5, 0xBF, 0x36, 0xD9, 0x3C, 0xA6, 0x56,
-    0x5F, 0x0C, 0x28, 0x87, 0xC4, 0xA6, 0x54, 0xDC, 0x94, 0x8D, 0xBC, 0x04, 0x36, 0x25, 0xE4, 0x4E,
-    0x6B, 0xCF, 0xBD, 0xD7, 0x1D, 0x3D, 0xA7, 0x4E, 0x7C, 0x74, 0x1A, 0x1C, 0x7A, 0x51, 0xD6, 0x33,
-    0x4F, 0x4C, 0xDC, 0xAA, 0x88, 0xCF, 0x60, 0x31, 0x4F, 0x53, 0xAD, 0x9C, 0x74, 0xF7, 0x3E, 0x25,
-    0x33, 0x27, 0x3A, 0xD0, 0x52, 0x1A, 0xF6, 0x1A, 0x8F, 0xB9, 0xDE, 0xAE, 0x7D, 0xB2, 0x65, 0x22,
-    0x26, 0x59, 0x4A, 0xB0, 0x94, 0x53, 0x2D, 0x4F, 0x0F, 0xCC, 0xC7, 0xAA, 0xAB, 0x42, 0xB3, 0x92,
-    0x29, 0x21, 0x64, 0x06, 0x7B, 0xA0, 0x8C, 0x87, 0x85, 0x11, 0xDC, 0x59, 0x7C, 0xD2, 0x28, 0x85,
-    0x09, 0x7E, 0xDD, 0xCA, 0x5A, 0x06, 0xBF, 0xDA, 0xF2, 0x60, 0xB0, 0x09, 0x6B, 0x26, 0x83, 0x41,
-    0x13, 0x6D, 0x3A, 0xCC, 0x1B, 0xB4, 0x71, 0xC5, 0x0C, 0x70, 0xB9, 0x45, 0xEA, 0x83, 0x78, 0x73,
-    0xD1, 0xA5, 0x39, 0x33, 0x49, 0x9E, 0xC7, 0xA5, 0x48, 0x2D, 0x4D, 0xBF, 0x32, 0xC9, 0x77, 0xB1,
-    0xBB, 0x27, 0xB7, 0x3D, 0x4D, 0xF6, 0xD8, 0x3F, 0x11, 0x95, 0x75, 0x9E, 0xB2, 0xAC, 0xF5, 0xC4,
-    0x21, 0x44, 0x50, 0x0B, 0x83, 0x3A, 0xD3, 0xC9, 0x5C, 0xB6, 0x95, 0x23, 0xC1, 0x92, 0xD3, 0x0A,
-    0xD3, 0x22, 0xA4, 0x28, 0xF5, 0xD0, 0xD7, 0x5B, 0x58, 0x77, 0xF2, 0x61, 0x33, 0x8A, 0x4E, 0xA0,
-    0x47, 0x78, 0xB4, 0x46, 0x9F, 0x4E, 0x32, 0x30, 0xFF, 0x25, 0xB3, 0xD0, 0xF7, 0xB7, 0x63, 0xBD,
-    0xBA, 0x67, 0xA2, 0xCE, 0xA7, 0xE4, 0xC0, 0xC7, 0x64, 0x83, 0x88, 0x26, 0x52, 0xCE, 0xDC, 0x4D,
-    0xA7, 0x17, 0x9E, 0xF3, 0x3C, 0xA9, 0x10, 0xE7, 0xA3, 0x46, 0x9E, 0x46, 0x0F, 0x80, 0x85, 0x13,
-    0xE7, 0x29, 0x5C, 0x25, 0xA5, 0x6E, 0x60, 0x90, 0xC2, 0xDA, 0xB8, 0x38, 0xFF, 0x2A, 0x4F, 0x15,
-    0xBF, 0xC3, 0xD3, 0xC2, 0x7F, 0xAD, 0xC7, 0xA7, 0x57, 0xC2, 0x07, 0x3C, 0xEB, 0x20, 0x2D, 0x0B,
-    0x37, 0x07, 0x45, 0xFD, 0x1C, 0xC3, 0x6F, 0x27, 0x35, 0x53, 0x51, 0x87, 0x81, 0xF4, 0x3F, 0xB3,
-    0x6F, 0xA9, 0x6C, 0xA4, 0x9E, 0x1C, 0x2E, 0x52, 0x25, 0x5E, 0xFB, 0xEB, 0xD7, 0xBB, 0xD3, 0x07,
-    0xAE, 0x18, 0x7A, 0x97, 0x5E, 0x64, 0x89, 0x26, 0x1A, 0xCF, 0x92, 0x99, 0x92, 0x0C, 0xA7, 0xCF,
-    0x5D, 0x11, 0xAF, 0x0A, 0x05, 0x47, 0x47, 0xEF, 0x94, 0x3E, 0xEF, 0xC2, 0x9D, 0x3F, 0xF6, 0x82,
-    0x10, 0x3B, 0x7F, 0x9E, 0x3D, 0x3D, 0xB3, 0x75, 0xDE, 0x35, 0x78, 0x2D, 0x61, 0x65, 0x9F, 0x14,
-    0x32, 0x27, 0x55, 0x9D, 0x6E, 0x78, 0x86, 0xDA, 0xBA, 0x52, 0x4E, 0x95, 0x56, 0xC6, 0x8C, 0xE5,
-    0x96, 0xF9, 0xA3, 0xD5, 0xB3, 0xBC, 0xCC, 0xBB, 0xD4, 0x47, 0xDA, 0x86, 0xD1, 0x24, 0x88, 0x75,
-    0x27, 0x17, 0x5C, 0x76, 0x2C, 0x91, 0x70, 0x79, 0xE4, 0x3A, 0x9F, 0x77, 0xF4, 0x07, 0x0F, 0x17,
-    0x8F, 0xED, 0x7D, 0xE2, 0x5A, 0x6E, 0xFD, 0xBC, 0x3F, 0xE2, 0x4E, 0xBD, 0xAB, 0xF2, 0x5C, 0x6B,
-    0xBE, 0x81, 0x4D, 0xF8, 0x87, 0xED, 0x15, 0x3E, 0x2C, 0xF6, 0x55, 0x3D, 0x15, 0xC0, 0xD7, 0x6F,
-    0x00, 0xDD, 0x5A, 0x3D, 0x90, 0xDD, 0x56, 0x15, 0x3E, 0x92, 0x76, 0x57, 0x49, 0xC4, 0x8C, 0x5C,
-    0xD8, 0x93, 0x10, 0x0F, 0x88, 0x82, 0x02, 0x32, 0x13, 0xAB, 0xA1, 0xB4, 0x57, 0x22, 0x99, 0x09,
-    0xAD, 0x8B, 0x5D, 0x33, 0x83, 0x8B, 0x50, 0xA4, 0x00, 0x17, 0xB8, 0xA1, 0x48, 0x61, 0xAF, 0x34,
-    0x69, 0x28, 0x28, 0x58, 0x8A, 0x84, 0x19, 0x1A, 0x52, 0x98, 0x99, 0xF8, 0x65, 0x98, 0xB4, 0x9E,
-    0x61, 0x77, 0x25, 0x26, 0x05, 0x05, 0x45, 0x1E, 0x0C, 0x7D, 0x94, 0xB1, 0x33, 0x19, 0x4C, 0x61,
-    0x05, 0x14, 0x22, 0x13, 0x49, 0x97, 0xEF, 0x3B, 0x57, 0xEF, 0x67, 0xD7, 0x1B, 0xFF, 0x24, 0x61,
-    0x1D, 0xE7, 0xED, 0xEA, 0xDC, 0xF7, 0x73, 0x75, 0xEF, 0xB9, 0xE7, 0x9C, 0xFB, 0x9D, 0x1F, 0xDD,
-    0x55, 0x49, 0xCA, 0x64, 0x9A, 0x4D, 0x93, 0xF2, 0x09, 0xE1, 0x6B, 0x55, 0x42, 0xFD, 0x8B, 0xD2,
-    0xD9, 0x5F, 0x9C, 0xCF, 0xFE, 0xD0, 0x73, 0xFE, 0xA7, 0x9D, 0x9D, 0x7A, 0xBC, 0x1A, 0x91, 0x93,
-    0xE6, 0x86, 0x18, 0xD3, 0xF9, 0xE6, 0x56, 0x1B, 0xB6, 0x72, 0x2C, 0x9E, 0x8A, 0x24, 0x39, 0xAE,
-    0x54, 0x24, 0x43, 0xD7, 0xE2, 0xC0, 0x95, 0x8D, 0x17, 0x7F, 0xE7, 0x68, 0x51, 0x25, 0x12, 0xF6,
-    0xCE, 0x25, 0x0F, 0x63, 0x48, 0x61, 0x5A, 0x59, 0x1B, 0xD2, 0xC5, 0xF8, 0xB8, 0xE4, 0xAC, 0x8C,
-    0xAF, 0x02, 0xBF, 0x04, 0xC6, 0xD4, 0x12, 0xFF, 0xB7, 0xA8, 0x24, 0xCB, 0x9D, 0x52, 0x47, 0x94,
-    0x7E, 0x4E, 0xBA, 0x4F, 0x21, 0xE7, 0x86, 0xCD, 0x0D, 0x0C, 0xAE, 0x33, 0x80, 0x7C, 0x6A, 0x3F,
-    0x25, 0x2E, 0x89, 0x87, 0x95, 0x49, 0x34, 0xE5, 0xAC, 0x06, 0xB7, 0x98, 0x39, 0x59, 0x01, 0x57,
-    0x72, 0x66, 0xF5, 0x4A, 0x98, 0x67, 0x99, 0x29, 0xF2, 0x08, 0xDF, 0x49, 0xD0, 0xE0, 0x9E, 0xB0,
-    0x94, 0x5D, 0x09, 0x53, 0x59, 0x97, 0x58, 0xF0, 0x0F, 0x12, 0x59, 0x12, 0xF1, 0x63, 0x98, 0xCB,
-    0x96, 0x04, 0x95, 0x83, 0x7E, 0xC3, 0xF9, 0x5E, 0x12, 0xDC, 0x96, 0x6E, 0x9D, 0x1C, 0xA2, 0xF2,
-    0x3B, 0x22, 0xBE, 0x5D, 0x5E, 0x82, 0x2B, 0x4E, 0x29, 0xBB, 0x4C, 0x22, 0x48, 0x66, 0x40, 0x7F,
-    0xC1, 0x0D, 0x5E, 0x2D, 0x5E, 0x2B, 0x6E, 0x2B, 0x7E, 0x4D, 0x06, 0x43, 0x30, 0xB5, 0xA7, 0x1D,
-    0x12, 0x15, 0x62, 0x9C, 0x53, 0x9C, 0xE1, 0x94, 0x02, 0xF0, 0x3F, 0x54, 0xDE, 0x3F, 0x26, 0xF3,
-    0x8E, 0x81, 0x64, 0x9D, 0x89, 0xF9, 0xEF, 0xEB, 0xE2, 0x1A, 0x4A, 0xCD, 0x99, 0x14, 0x37, 0x5F,
-    0x1F, 0x25, 0xBF, 0x4C, 0xED, 0xAF, 0x96, 0xDE, 0xF9, 0xEB, 0x32, 0xFD, 0xEE, 0xFA, 0xBE, 0xD7,
-    0x4C, 0x2F, 0xC7, 0x0F, 0x7E, 0xFD, 0xA3, 0xAB, 0xE2, 0x1B, 0x53, 0x41, 0x36, 0x75, 0x92, 0x3B,
-    0xD5, 0xB2, 0xCA, 0x63, 0xAA, 0xDB, 0xA4, 0xE2, 0x41, 0xD3, 0xE1, 0x27, 0x26, 0x4D, 0xD2, 0xAC,
-    0x5A, 0x87, 0x00, 0x2F, 0x63, 0x81, 0x97, 0xB1, 0x3C, 0xF4, 0x6B, 0x93, 0xD2, 0x69, 0xA2, 0xD6,
-    0xAB, 0x3D, 0x73, 0x6B, 0x2A, 0x19, 0x3A, 0xBB, 0x06, 0x6B, 0x8E, 0xC1, 0x1D, 0xE4, 0x40, 0x41,
-    0xE0, 0xDA, 0x86, 0x86, 0x86, 0x57, 0x2F, 0xD6, 0xE0, 0xBA, 0x8C, 0xCC, 0x6D, 0xE5, 0x63, 0x45,
-    0x8E, 0x25, 0x18, 0xC1, 0xE9, 0x40, 0xF1, 0x5E, 0xE6, 0xAF, 0x93, 0xB6, 0x83, 0x83, 0xCE, 0xD4,
-    0x68, 0x00, 0x51, 0xB6, 0xB2, 0x30, 0x51, 0xCA, 0x0C, 0xDA, 0x73, 0x6B, 0xB9, 0xB0, 0x0D, 0x61,
-    0xFB, 0xA5, 0x67, 0x06, 0x69, 0xA0, 0xCB, 0x70, 0xE8, 0xE5, 0x12, 0xF4, 0x97, 0xE4, 0x2B, 0x72,
-    0x46, 0x4E, 0x69, 0xE7, 0x08, 0xEF, 0xF4, 0x06, 0x39, 0xBD, 0xBF, 0x4D, 0x4F, 0x4B, 0x7B, 0xA0,
-    0xB5, 0xBF, 0xCF, 0xFA, 0x9F, 0x82, 0x7D, 0x58, 0x7B, 0xE0, 0xC4, 0xEB, 0xE8, 0x11, 0xBF, 0xFF,
-    0x07, 0x8C, 0xEF, 0x97, 0x81, 0xE9, 0x71, 0x0F, 0xA6, 0x2E, 0x6E, 0xB8, 0xB5, 0xE5, 0x27, 0x00,
-    0xA3, 0x59, 0x6A, 0x79, 0x0C, 0x6F, 0xC8, 0x1A, 0xB5, 0xEB, 0x9A, 0x9B, 0xD4, 0x29, 0x44, 0x01,
-    0xFE, 0xF4, 0x75, 0x22, 0xB5, 0x6D, 0x60, 0xF2, 0xC4, 0xD4, 0x4F, 0x71, 0x3B, 0x62, 0xEE, 0x76,
-    0xCD, 0xB4, 0xC9, 0xCD, 0x76, 0x57, 0xDA, 0x16, 0xFF, 0x4E, 0xBB, 0x77, 0xBE, 0x4D, 0x86, 0x97,
-    0xD7, 0xB6, 0x8F, 0x61, 0x93, 0xC3, 0x7C, 0xC3, 0x3C, 0x4E, 0x31, 0x2E, 0xB6, 0xCE, 0x00, 0xEB,
-    0x72, 0x3B, 0x98, 0x7A, 0x50, 0x87, 0x15, 0x4C, 0x0A, 0xB6, 0xA7, 0xDF, 0x67, 0x29, 0xC6, 0x8F,
-    0xF9, 0x31, 0xA8, 0xB1, 0x07, 0xBC, 0x96, 0x96, 0x37, 0x70, 0x5F, 0xE8, 0xCF, 0xE8, 0x98, 0xCA,
-    0xE3, 0xF2, 0x98, 0x3C, 0x33, 0x99, 0x4C, 0xAE, 0xD0, 0x94, 0x5B, 0x25, 0x14, 0x31, 0x89, 0xDC,
-    0x9D, 0xC8, 0x85, 0xC9, 0x76, 0x61, 0x2A, 0xFC, 0x9F, 0xD8, 0x4C, 0x1F, 0x5C, 0x49, 0x4F, 0x4F,
-    0x52, 0x55, 0x52, 0x8C, 0x09, 0xA9, 0xA4, 0xD8, 0x58, 0x25, 0xC5, 0x69, 0xA6, 0x4A, 0xC2, 0x16,
-    0x52, 0x25, 0xC5, 0x69, 0xAC, 0xCA, 0xE1, 0x67, 0xDB, 0x0E, 0xAA, 0x94, 0x18, 0x00, 0x60, 0xDB,
-    0xCA, 0xB6, 0xBF, 0xA9, 0x55, 0x49, 0xF1, 0x73, 0x8D, 0x2A, 0x29, 0x4E, 0x3B, 0x55, 0x52, 0x9C,
-    0xEE, 0x59, 0x25, 0xE1, 0x7E, 0x2A, 0x29, 0x4E, 0xA3, 0x92, 0x4A, 0x8A, 0xD2, 0xE0, 0x6F, 0x0F,
-    0xAE, 0x24, 0x0A, 0xC8, 0x28, 0xA1, 0xD0, 0xAE, 0x6A, 0x47, 0x80, 0x47, 0x93, 0x7C, 0xBF, 0xDB,
-    0x91, 0xF5, 0x56, 0xE2, 0x56, 0x22, 0x50, 0xBC, 0x5F, 0x97, 0x5D, 0x2C, 0xCD, 0x87, 0x10, 0x8E,
-    0xA3, 0xD7, 0x06, 0x47, 0xD8, 0xB9, 0x17, 0x79, 0x66, 0x32, 0xEC, 0x57, 0xC4, 0xCE, 0xBD, 0x6F,
-    0xFB, 0xC9, 0x28, 0xF7, 0x03, 0x4A, 0x74, 0xCC, 0x36, 0xD8, 0x8A, 0x7F, 0xDD, 0x3D, 0x26, 0x97,
-    0x69, 0xA5, 0xA4, 0x3B, 0xD4, 0x2B, 0x84, 0x0E, 0xF9, 0x27, 0x5C, 0x39, 0xDF, 0xC2, 0x54, 0x4C,
-    0x8F, 0xFF, 0x13, 0x9B, 0x1B, 0xAE, 0xD9, 0xC6, 0x6A, 0x1B, 0xC1, 0x5A, 0x60, 0x5F, 0xE8, 0xCF,
-    0xDB, 0xD8, 0x12, 0xBC, 0x20, 0x0C, 0x4F, 0x91, 0xA8, 0x9F, 0x41, 0x9C, 0xB6, 0xC7, 0x00, 0x87,
-    0x5B, 0xAF, 0x75, 0xD8, 0xDE, 0x8D, 0xAC, 0x4D, 0x20, 0xA1, 0x89, 0xB8, 0x3D, 0xF7, 0x37, 0x0C,
-    0x31, 0x26, 0x56, 0xCE, 0xF7, 0x6F, 0x4F, 0xBD, 0x7F, 0x76, 0x12, 0x95, 0xC3, 0x48, 0x92, 0xD2,
-    0x40, 0x5D, 0xA5, 0xC9, 0xC5, 0x94, 0xE6, 0xF6, 0xF9, 0x5B, 0x25, 0x96, 0xFB, 0x4E, 0xD9, 0x67,
-    0x7D, 0x50, 0xF6, 0xAB, 0xE9, 0xB2, 0x1B, 0xB9, 0x3B, 0x91, 0xD5, 0x0B, 0x93, 0x2B, 0x34, 0xD3,
-    0x16, 0xCE, 0xE8, 0x66, 0x0B, 0x94, 0xCB, 0xAF, 0x25, 0x24, 0x19, 0x49, 0x41, 0x62, 0xEE, 0x4A,
-    0x8A, 0x79, 0x67, 0xBD, 0x4D, 0x07, 0xF0, 0x49, 0xE0, 0x6B, 0x40, 0x24, 0xF8, 0x42, 0x88, 0x9F,
-    0xFE, 0x7C, 0x15, 0x6B, 0x86, 0x87, 0x87, 0x8F, 0x5F, 0x15, 0x6F, 0xEA, 0x97, 0x61, 0x03, 0x13,
-    0x85, 0xD7, 0x90, 0xAD, 0xAC, 0xCB, 0x2A, 0x79, 0xC6, 0x31, 0x81, 0x49, 0xDE, 0x3A, 0x13, 0x1F,
-    0x8B, 0xE5, 0xB0, 0xBF, 0x13, 0xD6, 0x4A, 0x43, 0x58, 0xA9, 0xEC, 0x5C, 0x92, 0x33, 0xD7, 0x68,
-    0xA5, 0x34, 0xD4, 0x6B, 0x6A, 0xA8, 0x67, 0xE4, 0x72, 0xFC, 0x1A, 0x64, 0x50, 0xC9, 0x4F, 0xA1,
-    0xF6, 0x15, 0x6A, 0x7D, 0x87, 0xBE, 0x3F, 0xA3, 0x37, 0x8A, 0x4B, 0x00, 0x74, 0x48, 0xFF, 0x45,
-    0xCC, 0x2E, 0x28, 0x39, 0xF0, 0x92, 0x12, 0x55, 0x52, 0xEC, 0xE7, 0x01, 0xF6, 0xE0, 0xC1, 0x3A,
-    0x9A, 0x00, 0xA6, 0x54, 0xC1, 0x99, 0xC5, 0xFC, 0x31, 0x63, 0xB7, 0xC7, 0xE4, 0x29, 0xCC, 0xBB,
-    0xA5, 0x68, 0xE1, 0x42, 0x63, 0x40, 0xC4, 0x10, 0x8D, 0x0F, 0x8F, 0x7F, 0x51, 0x21, 0xE0, 0x34,
-    0xFD, 0x6B, 0xAA, 0xC6, 0xB4, 0x6E, 0x6D, 0xAA, 0xD3, 0x86, 0xE8, 0x87, 0xC6, 0x53, 0x2F, 0x26,
-    0x41, 0xA9, 0x0D, 0xEC, 0x54, 0x1D, 0x25, 0xF7, 0x68, 0x02, 0x9B, 0x2C, 0xD8, 0x74, 0x0E, 0x9C,
-    0x4A, 0xE2, 0xD6, 0xDE, 0x2D, 0x34, 0x7E, 0x15, 0xFC, 0x2E, 0x95, 0xD5, 0xB0, 0x8C, 0x22, 0x0C,
-    0x1A, 0xA5, 0x67, 0x62, 0x45, 0xE7, 0x6B, 0x6C, 0x76, 0x9C, 0x1A, 0x8D, 0xD3, 0x7A, 0x53, 0x34,
-    0x5E, 0x1D, 0x70, 0x6F, 0x05, 0xD3, 0x90, 0x4D, 0x98, 0xAF, 0x6E, 0x5E, 0xDC, 0x56, 0x6B, 0xC6,
-    0x6F, 0x97, 0x6D, 0xD3, 0xD9, 0x86, 0xB7, 0x82, 0x19, 0xBA, 0xB9, 0x1A, 0xD8, 0x9C, 0x8A, 0x3F,
-    0x95, 0xE4, 0x9D, 0x94, 0xCC, 0x9F, 0x42, 0x84, 0x10, 0xAB, 0x7B, 0xD0, 0x25, 0x86, 0xE9, 0xE8,
-    0x3C, 0xDC, 0x46, 0x1B, 0xAF, 0xD2, 0x46, 0x99, 0x0F, 0x11, 0x83, 0x9D, 0x60, 0x93, 0xF8, 0x0A,
-    0x55, 0xBB, 0x09, 0xA7, 0x4D, 0xDB, 0x53, 0x0C, 0x02, 0x9E, 0xAF, 0xB9, 0xC3, 0xC2, 0x1F, 0x4C,
-    0xD9, 0x80, 0x79, 0xDD, 0xD4, 0xB1, 0x85, 0x58, 0x48, 0xC5, 0xB3, 0x08, 0x05, 0x80, 0xA2, 0x54,
-    0x94, 0x79, 0xA1, 0xFB, 0xC1, 0xC0, 0x9C, 0x29, 0xCA, 0xC9, 0x0B, 0x45, 0x97, 0xBC, 0xBA, 0x41,
-    0xE6, 0x33, 0xF5, 0x40, 0xDA, 0x8C, 0x2F, 0x02, 0x10, 0x50, 0x4F, 0x38, 0x29, 0xA5, 0x78, 0x0A,
-    0x9B, 0x5B, 0x27, 0x60, 0xF7, 0xAD, 0xB1, 0xED, 0x2C, 0x9A, 0x28, 0xF3, 0xF0, 0xCB, 0xE4, 0xDE,
-    0xC3, 0x7D, 0x64, 0xDF, 0xC3, 0xC6, 0xA6, 0x40, 0xB9, 0xF1, 0x93, 0x31, 0xBE, 0xD9, 0x1D, 0xDB,
-    0xD6, 0x55, 0x64, 0x87, 0x87, 0x6F, 0x11, 0xDD, 0xED, 0xF9, 0x53, 0x04, 0x8E, 0xD9, 0x9B, 0x5D,
-    0x58, 0x9E, 0x42, 0x6B, 0xEA, 0x58, 0x2E, 0xB5, 0xE2, 0x5C, 0xC5, 0x3A, 0x1A, 0x75, 0x18, 0x9D,
-    0x5B, 0xA9, 0x6F, 0x69, 0xFC, 0x92, 0xAD, 0x57, 0x43, 0x08, 0x44, 0xDF, 0x72, 0x5D, 0x1D, 0x4A,
-    0x94, 0x63, 0x2F, 0xE9, 0x6A, 0x6C, 0x7B, 0x59, 0x4E, 0x9C, 0xEB, 0x53, 0xEB, 0x6C, 0x5A, 0xB5,
-    0x1F, 0x6D, 0xFD, 0xE9, 0xE8, 0x80, 0x8E, 0x5B, 0x30, 0xA2, 0x6D, 0x79, 0xB8, 0x1C, 0xC2, 0xF4,
-    0x4B, 0x0B, 0x3F, 0xA4, 0x90, 0xBB, 0x33, 0x7A, 0x9C, 0xCE, 0xC6, 0x1B, 0xB0, 0x52, 0x61, 0x60,
-    0x4B, 0x8D, 0x12, 0x58, 0x6A, 0xB1, 0x01, 0x98, 0xB5, 0xC2, 0xC5, 0x95, 0x6B, 0xB7, 0x4B, 0xA1,
-    0x79, 0xAB, 0x47, 0x3C, 0xDB, 0x83, 0xA1, 0x6D, 0x1D, 0xD2, 0x7D, 0x43, 0x5D, 0x9B, 0x75, 0x08,
-    0x99, 0x3A, 0xBD, 0x58, 0x23, 0xE9, 0x40, 0x5D, 0x85, 0xCA, 0x4F, 0x96, 0x23, 0x96, 0xD1, 0xAD,
-    0xEB, 0xAF, 0x9C, 0x0D, 0xF3, 0x69, 0x9F, 0x44, 0x25, 0xBE, 0xAE, 0x74, 0x57, 0xB5, 0xD0, 0x71,
-    0x62, 0x84, 0x3C, 0x29, 0x63, 0x56, 0x32, 0x05, 0xF1, 0x94, 0xBC, 0x95, 0x37, 0x87, 0x53, 0x5F,
-    0x59, 0x65, 0x34, 0x1B, 0xE7, 0x5C, 0x49, 0x42, 0x50, 0x96, 0x62, 0x73, 0x13, 0xCB, 0xA0, 0x37,
-    0x52, 0x7F, 0x6B, 0xC4, 0x1D, 0x26, 0x93, 0x22, 0x67, 0xB7, 0xA8, 0xE4, 0x2D, 0xE1, 0x14, 0x7B,
-    0x97, 0xDE, 0x1F, 0x43, 0xF9, 0x35, 0x79, 0xF5, 0x5A, 0x8D, 0x15, 0x19, 0xA0, 0x01, 0x07, 0x75,
-    0x25, 0x24, 0x4F, 0xEB, 0x02, 0x6D, 0x5A, 0x60, 0x74, 0x91, 0xCA, 0x9B, 0x6E, 0x42, 0xB5, 0x31,
-    0x66, 0x16, 0x8F, 0xDE, 0xBA, 0x9E, 0x78, 0x5D, 0x75, 0xA4, 0xBC, 0x65, 0x9D, 0x5A, 0x71, 0xA1,
-    0xCB, 0xE2, 0x8D, 0xA1, 0x0E, 0xB5, 0xBA, 0x94, 0x99, 0x3C, 0x32, 0xEB, 0x7A, 0x49, 0xBE, 0xCD,
-    0xAD, 0x9D, 0xBE, 0xCC, 0x28, 0xFC, 0x3F, 0x9C, 0x25, 0x60, 0xD4, 0x7F, 0x5A, 0x8A, 0x52, 0x37,
-    0xC6, 0xA3, 0xA7, 0xA9, 0xD4, 0x91, 0xD9, 0x8C, 0xBE, 0x52, 0xFB, 0xDE, 0x7E, 0x2F, 0x8F, 0xE2,
-    0x8A, 0xD6, 0xB6, 0x17, 0x5C, 0xDD, 0x56, 0x7E, 0xEA, 0x70, 0x89, 0x46, 0x9A, 0x0A, 0x2B, 0x4E,
-    0xC7, 0xED, 0x97, 0x18, 0x19, 0x98, 0x19, 0x0F, 0xB3, 0xC8, 0x97, 0xDB, 0x68, 0x6C, 0x07, 0xCD,
-    0xAA, 0x31, 0x99, 0x45, 0x07, 0xAF, 0xB5, 0xAD, 0x55, 0x1E, 0xC6, 0xAF, 0x6C, 0x1B, 0x95, 0xB6,
-    0x8D, 0x73, 0xDB, 0x26, 0x23, 0x9A, 0x14, 0x12, 0xBE, 0x8F, 0x64, 0x1E, 0x91, 0x42, 0xC8, 0x54,
-    0x9E, 0x89, 0x37, 0x5B, 0x30, 0xA8, 0xDF, 0x07, 0x1F, 0x6D, 0xBE, 0xA8, 0xCE, 0xD3, 0xA8, 0x2F,
-    0x40, 0x5C, 0x6A, 0xDB, 0xE4, 0xE6, 0x84, 0x26, 0xCE, 0x54, 0x42, 0xC7, 0x19, 0x6C, 0xCB, 0x25,
-    0xAB, 0xD1, 0xB4, 0xB6, 0xD5, 0x15, 0x72, 0x8B, 0x57, 0x76, 0x08, 0xDD, 0xEE, 0x8C, 0xDC, 0x73,
-    0xDB, 0xCE, 0xAC, 0xE8, 0xA2, 0xB9, 0xC1, 0xAC, 0xCB, 0x30, 0x8E, 0xB0, 0xB2, 0x9A, 0xCA, 0xCF,
-    0xC4, 0xD3, 0xC5, 0x07, 0xAD, 0x5D, 0xC7, 0x02, 0xE5, 0x79, 0xF7, 0x0C, 0xF7, 0x33, 0x5B, 0xCA,
-    0xB8, 0x0F, 0x6A, 0xFB, 0xDB, 0x7B, 0x2D, 0xC0, 0xC6, 0xD3, 0x85, 0xED, 0xFA, 0x6A, 0x01, 0x08,
-    0xCF, 0x08, 0x44, 0xC5, 0xF0, 0x66, 0xAF, 0x6B, 0x55, 0xBF, 0xA6, 0x99, 0x98, 0xFF, 0x77, 0xED,
-    0x95, 0x2F, 0x78, 0x59, 0x53, 0xDB, 0x90, 0xF5, 0x25, 0xBA, 0xA7, 0xB3, 0xE9, 0xF7, 0x05, 0xC6,
-    0x76, 0xAE, 0x8E, 0x28, 0xCE, 0xE9, 0x58, 0x67, 0x50, 0x18, 0xEF, 0x64, 0x19, 0x1A, 0xA0, 0xC6,
-    0x1E, 0xD7, 0xA0, 0xD7, 0x52, 0x3D, 0xE7, 0xD0, 0x6B, 0x73, 0x73, 0x03, 0xFD, 0x3A, 0xBD, 0xF8,
-    0xFE, 0x5E, 0xFD, 0xED, 0xF8, 0xC3, 0xEC, 0xB2, 0x38, 0xCC, 0x55, 0x67, 0xB9, 0xAA, 0x8C, 0x76,
-    0xEA, 0x33, 0x99, 0x90, 0x87, 0xC3, 0xCF, 0x1A, 0xD8, 0x09, 0x99, 0x06, 0x83, 0x97, 0x21, 0xC1,
-    0xB6, 0x09, 0xA7, 0xC1, 0xD4, 0x6D, 0x56, 0x97, 0x7C, 0xF7, 0x91, 0xF2, 0x73, 0xD6, 0x41, 0xE0,
-    0x18, 0x4C, 0xBD, 0x36, 0xA8, 0xDC, 0x06, 0x01, 0xCE, 0x01, 0xD0, 0x3B, 0x4A, 0x5E, 0x2E, 0xA4,
-    0xB4, 0x1A, 0x58, 0x1A, 0xA1, 0xA2, 0xD3, 0x78, 0x68, 0x75, 0xCE, 0x46, 0x5D, 0x98, 0xFA, 0xA4,
-    0xD9, 0xC6, 0x6E, 0xFB, 0x3C, 0xFF, 0x6B, 0x43, 0x6A, 0x87, 0x62, 0x3C, 0x15, 0x34, 0x2C, 0xCF,
-    0x61, 0x77, 0xEC, 0x69, 0x88, 0x9B, 0xFE, 0xDF, 0xE6, 0xBA, 0xC0, 0x3D, 0x51, 0x6A, 0x12, 0x1B,
-    0x5E, 0x6F, 0x80, 0x47, 0x3D, 0xE2, 0xD8, 0x38, 0x3D, 0xBB, 0x64, 0x84, 0x11, 0x00, 0x88, 0x65,
-    0x85, 0x35, 0xA2, 0xC2, 0x7D, 0x09, 0xEE, 0xC1, 0x2E, 0xA7, 0xD8, 0x9E, 0xCF, 0x71, 0x5C, 0xCE,
-    0xEE, 0xBA, 0xCD, 0xE0, 0xB5, 0xA0, 0xC7, 0x24, 0x5D, 0xD2, 0xF5, 0x17, 0xBC, 0x70, 0x04, 0xB0,
-    0x57, 0x88, 0xCF, 0xB6, 0x1E, 0xC3, 0xA6, 0xD7, 0xB2, 0xE8, 0x79, 0x06, 0xC1, 0x8D, 0x02, 0x86,
-    0x7A, 0x85, 0x5A, 0x1B, 0xBF, 0xD5, 0xC6, 0x55, 0x24, 0x66, 0x7C, 0xAD, 0x05, 0xD4, 0xC1, 0x36,
-    0xC5, 0xAC, 0x79, 0x73, 0x98, 0xE4, 0x58, 0x90, 0x62, 0xF2, 0xD8, 0x14, 0xE2, 0xEF, 0xEB, 0xB2,
-    0x74, 0xDF, 0x38, 0x8A, 0xD7, 0x2D, 0xCF, 0x30, 0xCE, 0x67, 0x67, 0x3F, 0xA9, 0x95, 0x44, 0xCB,
-    0x19, 0x1A, 0x4D, 0x3F, 0xCC, 0x3F, 0xD4, 0xBD, 0x6C, 0xCB, 0x8F, 0xB1, 0x57, 0x07, 0xA9, 0xE9,
-    0x81, 0x3E, 0xC0, 0x2F, 0x67, 0x22, 0x3A, 0x82, 0x97, 0x99, 0xFA, 0xDD, 0x19, 0x69, 0x13, 0x5F,
-    0xBC, 0x2A, 0x63, 0xCA, 0x53, 0x67, 0xB5, 0xD2, 0x56, 0x69, 0x4F, 0xBA, 0x65, 0x94, 0xA2, 0x13,
-    0x28, 0x20, 0x1D, 0x14, 0x20, 0x0C, 0xEA, 0xB3, 0x28, 0xBB, 0x85, 0x45, 0x83, 0x02, 0x38, 0xD1,
-    0x1F, 0xA8, 0x4D, 0x9A, 0x94, 0xA4, 0x61, 0x45, 0xEA, 0x37, 0xA4, 0x5E, 0x47, 0x2A, 0x83, 0x47,
-    0x5A, 0x3C, 0x4F, 0x9A, 0xBC, 0x4D, 0x1A, 0x5D, 0x27, 0x0D, 0x3E, 0x26, 0xF5, 0x0C, 0xA9, 0xA3,
-    0x54, 0x0A, 0xA5, 0x89, 0x52, 0xAC, 0x5A, 0x26, 0x63, 0x15, 0xDC, 0xEA, 0xDC, 0x7A, 0x96, 0x11,
-    0xDA, 0xAD, 0xD4, 0x66, 0x95, 0x9D, 0x43, 0x23, 0x39, 0xA7, 0xD0, 0x5C, 0x24, 0x52, 0x61, 0x69,
-    0x51, 0x3B, 0x57, 0xEF, 0x81, 0xD5, 0xFA, 0x9D, 0x3A, 0x2D, 0xFA, 0x15, 0xC8, 0x5A, 0xDD, 0xF3,
-    0x60, 0x3D, 0x4E, 0x61, 0xDD, 0x4F, 0x96, 0xAA, 0x2F, 0x4A, 0xF2, 0xC2, 0xFA, 0xA2, 0xC2, 0x32,
-    0x70, 0xCF, 0x06, 0x19, 0xBF, 0x75, 0x61, 0x5A, 0x42, 0x4E, 0xD2, 0x71, 0xCC, 0xD8, 0xCE, 0xC0,
-    0xF9, 0xDC, 0x7E, 0x36, 0xBB, 0x0B, 0xBD, 0x50, 0xF2, 0x70, 0x65, 0xD4, 0x53, 0x64, 0x83, 0x07,
-    0xC7, 0xD8, 0x62, 0x9A, 0xB3, 0x61, 0x57, 0x61, 0xE3, 0x72, 0x7D, 0x68, 0x30, 0xF7, 0x8D, 0xA3,
-    0xBB, 0xB4, 0x89, 0x87, 0xE6, 0xA0, 0xFC, 0x94, 0x7E, 0x45, 0x45, 0xE0, 0x5E, 0xB1, 0x7A, 0xB7,
-    0xAB, 0x8D, 0x6D, 0x44, 0x52, 0xA8, 0x35, 0x38, 0x9D, 0x06, 0xB7, 0x7E, 0xA5, 0x55, 0x58, 0xE7,
-    0x30, 0x33, 0xF8, 0x4A, 0x88, 0x60, 0x43, 0x1E, 0xB7, 0xA1, 0xCF, 0xB3, 0x5A, 0xA7, 0xB8, 0x4D,
-    0xA3, 0x0F, 0x5F, 0xD1, 0xA8, 0x27, 0xD4, 0x07, 0x0C, 0x2C, 0x46, 0x7D, 0x45, 0xD5, 0x6F, 0x21,
-    0xDF, 0x69, 0x19, 0x05, 0x01, 0x6D, 0x59, 0x98, 0x98, 0x7D, 0x92, 0x65, 0x77, 0xF0, 0xD5, 0x5B,
-    0xBB, 0xEA, 0xF4, 0x59, 0xAA, 0x18, 0xEC, 0x24, 0x39, 0x86, 0xE1, 0x83, 0x37, 0xB0, 0xEC, 0xF6,
-    0x1C, 0xAB, 0xC8, 0xF4, 0x3E, 0xC6, 0xDF, 0x5A, 0x51, 0xD3, 0x72, 0x33, 0xB1, 0xDE, 0xA0, 0xA7,
-    0xD7, 0x21, 0x5C, 0x08, 0x6B, 0xCC, 0x07, 0x26, 0x8A, 0x34, 0x61, 0x5A, 0xF1, 0x35, 0x44, 0xC4,
-    0x4B, 0x12, 0xFA, 0x96, 0x15, 0x52, 0x67, 0x13, 0x97, 0xD6, 0x0A, 0xA9, 0x56, 0x21, 0x15, 0x95,
-    0xB2, 0x19, 0x37, 0xCA, 0x74, 0x66, 0x85, 0xD4, 0xAB, 0x90, 0xBC, 0x46, 0x85, 0x14, 0xD4, 0x2A,
-    0x24, 0x3E, 0x41, 0x29, 0xEC, 0x52, 0x0B, 0x06, 0xD7, 0x14, 0x04, 0x60, 0x89, 0x0D, 0x00, 0x9A,
-    0x0D, 0xAB, 0xDB, 0x68, 0xB4, 0xE0, 0x59, 0x68, 0xFD, 0xAD, 0xD4, 0xA2, 0x27, 0x84, 0xF4, 0x5C,
-    0xAB, 0x77, 0xFE, 0x99, 0x6B, 0x91, 0xE8, 0xDD, 0xA9, 0x0A, 0x89, 0x6A, 0x82, 0x90, 0xCC, 0xB2,
-    0x90, 0x3C, 0xA3, 0x42, 0x0A, 0x6C, 0x7E, 0x15, 0xFE, 0xC9, 0xFA, 0xBD, 0x74, 0x06, 0x91, 0x4B,
-    0x38, 0x19, 0xA8, 0x57, 0x70, 0x2D, 0x54, 0xD8, 0xE2, 0x53, 0xAC, 0x26, 0xA2, 0xF5, 0xC5, 0x3B,
-    0x30, 0x72, 0x4B, 0xD3, 0xAE, 0xE2, 0x08, 0x69, 0xA6, 0xD6, 0x92, 0x59, 0x2B, 0xE1, 0x83, 0xCF,
-    0x54, 0xAB, 0x6C, 0x12, 0xB6, 0xCC, 0x6F, 0x3C, 0x73, 0xB3, 0x68, 0x34, 0x19, 0x9D, 0x52, 0x2B,
-    0xC3, 0xD2, 0x13, 0xAF, 0xC9, 0xA2, 0x9E, 0xE6, 0xE9, 0xF2, 0x02, 0x9B, 0xD0, 0x97, 0xB3, 0x07,
-    0xA9, 0x77, 0x82, 0xDF, 0xA3, 0xB3, 0xBA, 0x67, 0x94, 0x6A, 0xDA, 0xEA, 0xEA, 0x33, 0x59, 0xFF,
-    0x5F, 0x9D, 0x0E, 0xB8, 0xA7, 0xCB, 0x88, 0x72, 0x6E, 0xF5, 0x03, 0xCA, 0x7B, 0x64, 0x56, 0xE7,
-    0xE8, 0x46, 0xB6, 0xB7, 0x8F, 0x34, 0x5F, 0x9F, 0x7F, 0x7F, 0xC7, 0xEB, 0x11, 0xB5, 0xC9, 0x76,
-    0x51, 0x6A, 0x8A, 0xF2, 0x45, 0xBE, 0x7D, 0xD0, 0x26, 0xF7, 0x6C, 0xF9, 0x3A, 0xD5, 0xB9, 0x4A,
-    0x2D, 0x6E, 0x10, 0x5A, 0x68, 0xCD, 0x36, 0x92, 0xC6, 0x3F, 0xDE, 0xD0, 0xB8, 0x07, 0x45, 0x1D,
-    0x0B, 0xC9, 0xFA, 0x8C, 0xC5, 0x3E, 0xD4, 0x92, 0xF0, 0x3D, 0xDA, 0x86, 0xFF, 0x6F, 0xAD, 0x8C,
-    0xAB, 0xB5, 0x38, 0xFA, 0xFC, 0xD4, 0xDA, 0xCF, 0x5D, 0x1F, 0xE7, 0xDF, 0x0F, 0xCD, 0xE6, 0x35,
-    0x8B, 0x83, 0x84, 0x2E, 0x24, 0x23, 0x52, 0xB2, 0xB0, 0x83, 0xEF, 0x1C, 0x43, 0xAE, 0x14, 0xF4,
-    0xC3, 0x6A, 0x46, 0x82, 0x7A, 0xDF, 0xC7, 0x68, 0x3A, 0x76, 0x41, 0x14, 0x9E, 0x4D, 0x8A, 0x81,
-    0xF7, 0x36, 0x20, 0x43, 0x7A, 0x97, 0x89, 0x54, 0x52, 0x4F, 0x5F, 0xD5, 0xCA, 0x46, 0xC5, 0x2A,
-    0x0C, 0x50, 0xFC, 0xC6, 0x9A, 0xA1, 0x1B, 0xC8, 0xD2, 0x3D, 0x4A, 0x83, 0x0F, 0xF7, 0x72, 0xA2,
-    0x68, 0xCA, 0xDA, 0x15, 0xE4, 0x07, 0x4C, 0xE8, 0x19, 0x33, 0xF7, 0x14, 0x57, 0x4F, 0x31, 0xF7,
-    0x44, 0xD9, 0x9E, 0x20, 0xD8, 0x33, 0xD8, 0xC7, 0x0F, 0xFC, 0x35, 0xE4, 0xD7, 0x80, 0x78, 0xDE,
-    0x5B, 0xF5, 0x04, 0x4C, 0x66, 0x12, 0x6D, 0xCF, 0x58, 0x6A, 0x89, 0xAC, 0xF2, 0x3B, 0xFF, 0xFD,
-    0x17, 0xEB, 0xDE, 0x87, 0xDE, 0x7B, 0x97, 0x65, 0x1F, 0x59, 0x3D, 0x8B, 0x9D, 0x9A, 0xCF, 0xAA,
-    0x32, 0x5A, 0x94, 0xB1, 0x6A, 0xEF, 0xE6, 0x18, 0xB4, 0xA8, 0x7C, 0x6F, 0xAA, 0xC4, 0x1A, 0xA6,
-    0x27, 0x83, 0xB8, 0xB7, 0x5F, 0x00, 0xA0, 0xE7, 0xD6, 0xBB, 0x6A, 0xE4, 0xA6, 0xB8, 0x15, 0x8E,
-    0xEF, 0x9E, 0x46, 0x5A, 0xC4, 0xDA, 0x5B, 0x19, 0x0C, 0xAF, 0x46, 0x65, 0x3C, 0x3E, 0x98, 0xD7,
-    0x87, 0xEE, 0x6A, 0x9D, 0xFA, 0x08, 0x8D, 0x47, 0x71, 0x1C, 0x53, 0xC6, 0x1F, 0xBD, 0x78, 0xAB,
-    0x84, 0x48, 0x7E, 0x59, 0xBA, 0xA6, 0x07, 0xAA, 0xAF, 0xA6, 0xF3, 0xC7, 0x0D, 0x0A, 0xFE, 0x9A,
-    0x1E, 0xE8, 0x3C, 0x5B, 0xF3, 0xE7, 0xEF, 0x67, 0x1F, 0x0E, 0x57, 0x5A, 0x5C, 0xE2, 0x03, 0x17,
-    0xA8, 0x10, 0x63, 0xC6, 0xEF, 0x80, 0xB5, 0x3D, 0xB7, 0xE5, 0xA3, 0xE5, 0x3D, 0xE6, 0xEF, 0x2B,
-    0x0F, 0x85, 0xAB, 0xAF, 0x33, 0x08, 0x28, 0xAA, 0x10, 0x56, 0x30, 0x5C, 0x14, 0xEF, 0xBD, 0x02,
-    0xC6, 0x53, 0x46, 0xED, 0x72, 0x85, 0xE9, 0x68, 0x19, 0x3A, 0x4E, 0xFD, 0x6C, 0x31, 0x82, 0x2F,
-    0xE8, 0xB8, 0xF5, 0xDD, 0xCA, 0x81, 0x84, 0xF5, 0x68, 0xAD, 0xE9, 0x0D, 0x7B, 0xC0, 0x44, 0xEC,
-    0xD3, 0xC6, 0x53, 0x2E, 0xF4, 0xF6, 0xAC, 0x03, 0xF2, 0x4D, 0x0F, 0x1F, 0xC3, 0x5B, 0xE5, 0xA8,
-    0xD5, 0x25, 0x1E, 0x8F, 0xD6, 0xAE, 0x36, 0xEC, 0x84, 0x85, 0x99, 0x46, 0xC0, 0x07, 0xEC, 0xD0,
-    0x36, 0x63, 0x41, 0xF8, 0xF6, 0x93, 0xC3, 0xF0, 0xC2, 0x40, 0x3F, 0x09, 0xC0, 0xB6, 0x11, 0x6C,
-    0x65, 0xE7, 0x07, 0xD2, 0x46, 0x63, 0x4B, 0xB8, 0x1D, 0xDB, 0x93, 0xAC, 0x4F, 0x9B, 0xA9, 0x6B,
-    0x6C, 0x1B, 0x0E, 0x1B, 0xC9, 0xCD, 0xC9, 0x64, 0x1B, 0x1C, 0x29, 0xE7, 0x3C, 0x1B, 0x53, 0x5A,
-    0x50, 0x4C, 0xC6, 0x42, 0x72, 0x36, 0xB5, 0x9F, 0xED, 0xB9, 0xA9, 0xDC, 0xFD, 0xA4, 0xC3, 0x6C,
-    0xF1, 0x47, 0x17, 0xDF, 0x33, 0xBF, 0x2F, 0x72, 0xB0, 0xC9, 0xE7, 0x92, 0x39, 0x38, 0x85, 0xF4,
-    0x80, 0x3B, 0x64, 0x96, 0x9E, 0xC2, 0xD9, 0x54, 0xE1, 0x60, 0x9E, 0x26, 0x18, 0xCE, 0xD5, 0x4C,
-    0x65, 0x39, 0x20, 0x39, 0x2C, 0xC6, 0x30, 0x6D, 0x18, 0x8F, 0x1A, 0xF4, 0x4B, 0x9F, 0x8B, 0xB1,
-    0x22, 0xAC, 0x67, 0xE6, 0x6A, 0x39, 0x16, 0x0C, 0xBF, 0xD5, 0x31, 0xE4, 0x22, 0x16, 0xCD, 0x07,
-    0x88, 0xD4, 0x06, 0x4F, 0xCC, 0x38, 0x66, 0x3C, 0x64, 0x11, 0x59, 0xF8, 0x4E, 0x08, 0x6E, 0x37,
-    0x46, 0xF7, 0xA4, 0xC5, 0x03, 0x15, 0x82, 0x22, 0x83, 0x2D, 0x1B, 0xEC, 0xEC, 0x73, 0x4D, 0x1A,
-    0x47, 0x66, 0xF0, 0x21, 0x3A, 0x7A, 0xD0, 0x3F, 0xD9, 0xD3, 0xF3, 0xA8, 0xE3, 0x51, 0xBF, 0xA3,
-    0xD1, 0xBD, 0xC6, 0x22, 0x11, 0x4F, 0x50, 0x98, 0x91, 0x4C, 0x26, 0x93, 0x7C, 0x5E, 0xFB, 0xB7,
-    0x29, 0xB9, 0x15, 0x7A, 0x69, 0xCB, 0x17, 0x4E, 0xEA, 0x9B, 0xD7, 0x8A, 0xD4, 0xD1, 0x9A, 0x79,
-    0xAC, 0x67, 0x7D, 0x36, 0xE7, 0x91, 0x6A, 0x34, 0x87, 0xA9, 0x62, 0x96, 0xC9, 0x6B, 0x1E, 0xBF,
-    0x08, 0x72, 0x8E, 0x96, 0x2B, 0x4D, 0xB2, 0x35, 0xC5, 0xD6, 0x04, 0x9B, 0xE9, 0xB5, 0x26, 0xD7,
-    0x9A, 0x5A, 0x2F, 0x25, 0xD6, 0x47, 0xCB, 0x15, 0xF3, 0x3B, 0xCD, 0xF5, 0xDC, 0xCE, 0xAF, 0xC7,
-    0xAC, 0xEF, 0x40, 0xCE, 0x77, 0xA4, 0x0C, 0xC1, 0xFB, 0x41, 0x71, 0x36, 0x56, 0x21, 0x86, 0xF3,
-    0xA8, 0x84, 0x2C, 0x4E, 0xED, 0x7C, 0xE6, 0xFF, 0x09, 0xA3, 0x28, 0x4F, 0xC3, 0x1E, 0x7B, 0xE2,
-    0x68, 0x6E, 0x9B, 0xDC, 0x7C, 0x9F, 0xF5, 0x5F, 0x9D, 0x75, 0x31, 0xD5, 0x90, 0x9A, 0x01, 0x35,
-    0xE3, 0xBD, 0x75, 0xD0, 0xE3, 0xCB, 0xA1, 0x74, 0x92, 0x7E, 0xA1, 0xD7, 0xA7, 0x9E, 0x48, 0xFC,
-    0x3C, 0xE2, 0x59, 0xB1, 0x79, 0x1C, 0xB6, 0x78, 0xF2, 0xA1, 0xE1, 0x89, 0xD8, 0x76, 0x8C, 0xF9,
-    0x78, 0x14, 0x47, 0xB2, 0x7F, 0xD2, 0x75, 0xF0, 0x80, 0xC3, 0xF7, 0xAC, 0x22, 0x35, 0x96, 0x03,
-    0xDE, 0xAD, 0x5D, 0x05, 0xC8, 0x19, 0xF3, 0x41, 0xE5, 0x33, 0xB1, 0x0D, 0x1B, 0xC0, 0x22, 0x81,
-    0xB0, 0xC9, 0x08, 0x1B, 0x05, 0x83, 0x97, 0x61, 0x8C, 0x7D, 0xDC, 0x39, 0xF1, 0x9A, 0x3D, 0x12,
-    0x76, 0xA9, 0x61, 0x42, 0x61, 0x85, 0x58, 0x27, 0x06, 0x52, 0x9F, 0x33, 0xA9, 0xAB, 0xA5, 0x84,
-    0x8B, 0x9A, 0xA0, 0x6F, 0xE8, 0x09, 0x8A, 0xA7, 0x18, 0x49, 0x9D, 0xB1, 0x05, 0x99, 0xF0, 0x15,
-    0xD3, 0xD8, 0x62, 0xCC, 0xCA, 0x7E, 0xBF, 0xD5, 0x45, 0xF8, 0xA1, 0x2B, 0x70, 0xEF, 0xD0, 0x9F,
-    0x33, 0x02, 0xB6, 0xB3, 0x1C, 0xBE, 0x25, 0xE6, 0xD9, 0xAC, 0x88, 0x24, 0x2C, 0x87, 0x39, 0xF9,
-    0x8C, 0xA7, 0xBE, 0xE4, 0xC2, 0xDC, 0x76, 0x97, 0x50, 0xEE, 0x90, 0xB0, 0xCC, 0xB1, 0x8E, 0xAA,
-    0x12, 0x5D, 0x8C, 0x2E, 0x0B, 0x06, 0xAD, 0xA7, 0x9C, 0xC7, 0xE8, 0x95, 0x72, 0x69, 0x86, 0x19,
-    0x69, 0xFB, 0x39, 0xD1, 0x8F, 0x33, 0xE1, 0x78, 0x35, 0x84, 0x1C, 0xF0, 0x61, 0x68, 0x58, 0x85,
-    0x1C, 0xC0, 0xC7, 0x50, 0xAC, 0x5E, 0xE8, 0x43, 0xB9, 0x99, 0x84, 0x96, 0xC2, 0x32, 0xAD, 0xB2,
-    0x28, 0xDE, 0xED, 0x89, 0x3D, 0x45, 0xBD, 0x78, 0x82, 0x71, 0xC4, 0x5C, 0x39, 0x6F, 0x2C, 0xC2,
-    0x32, 0xA6, 0x16, 0xBF, 0xE2, 0xF1, 0x62, 0xA6, 0x1D, 0x8D, 0xEC, 0x72, 0x67, 0xAC, 0x3C, 0x14,
-    0xAE, 0x34, 0x2C, 0x33, 0x36, 0x2C, 0xCB, 0xC4, 0xFB, 0x2B, 0x7E, 0xF5, 0xF3, 0xA8, 0x59, 0x0E,
-    0xCB, 0x8E, 0x96, 0x21, 0x0D, 0xCB, 0x76, 0xE9, 0x67, 0x07, 0x46, 0xF9, 0xFA, 0xEE, 0x20, 0xF6,
-    0x1E, 0xAD, 0x35, 0x5D, 0x9B, 0x65, 0x9B, 0xCE, 0x02, 0xB9, 0x97, 0x8F, 0x31, 0x1D, 0x72, 0x3A,
-    0x77, 0xFF, 0x6B, 0x67, 0xFF, 0x00, 0xFD, 0x81, 0x28, 0xC0, 0x2D, 0xB1, 0x98, 0x0F, 0x2A, 0xD7,
-    0xC6, 0x66, 0x76, 0x31, 0x85, 0xC6, 0x61, 0x58, 0x8C, 0xF7, 0x09, 0x16, 0x13, 0x5C, 0xAF, 0x91,
-    0x95, 0xBE, 0x8D, 0xC5, 0x24, 0x5C, 0x47, 0x0F, 0xE2, 0xB6, 0x58, 0x8C, 0x5F, 0x63, 0x31, 0x61,
-    0xE9, 0x35, 0x45, 0x9C, 0x7B, 0x4D, 0x82, 0x8E, 0x75, 0xD2, 0x71, 0x31, 0x0D, 0x16, 0x63, 0x87,
-    0xD2, 0x24, 0x8E, 0xE0, 0xF1, 0x0D, 0x99, 0x97, 0xAD, 0x0E, 0x4D, 0xA6, 0xFA, 0x43, 0x92, 0x29,
-    0x0B, 0x6A, 0x7E, 0xFD, 0x39, 0x49, 0x40, 0x12, 0xD6, 0x04, 0xC1, 0x1A, 0xD3, 0x66, 0x75, 0xD8,
-    0x9F, 0xFF, 0xA4, 0x06, 0x3A, 0x5E, 0xAF, 0x11, 0x4C, 0x3E, 0x0F, 0xAF, 0x77, 0x76, 0xB1, 0x6B,
-    0xDB, 0x7B, 0x26, 0x53, 0x47, 0xCA, 0xD5, 0x61, 0xC9, 0xD4, 0xD6, 0x52, 0x32, 0xB5, 0xFA, 0x50,
-    0xB8, 0x3A, 0x4E, 0x17, 0x77, 0x8F, 0xDC, 0xE5, 0x61, 0x28, 0xAF, 0xB9, 0x1F, 0xE5, 0x15, 0xE3,
-    0x19, 0x16, 0xAF, 0x4D, 0x72, 0x7B, 0xB2, 0x25, 0xA8, 0xE1, 0x31, 0xC3, 0x69, 0x50, 0xD9, 0xA3,
-    0x2F, 0x09, 0x4F, 0xC1, 0x24, 0x29, 0x56, 0x56, 0xD0, 0x9B, 0x0C, 0x04, 0x6F, 0xAC, 0x32, 0xD3,
-    0xC3, 0x33, 0xCF, 0xF3, 0x1C, 0xCD, 0x2F, 0x78, 0x7A, 0xE4, 0x2F, 0x3C, 0x1E, 0xF3, 0x2E, 0xCF,
-    0x92, 0xD8, 0xD4, 0x28, 0x1D, 0x43, 0x72, 0x99, 0xEF, 0x32, 0x1B, 0xDF, 0xEA, 0x21, 0x8D, 0x7A,
-    0xC6, 0x19, 0x63, 0xF2, 0x3F, 0xB2, 0xAF, 0x9E, 0xEC, 0xC9, 0xAA, 0xD9, 0x01, 0xED, 0xFB, 0x3A,
-    0x94, 0x0C, 0xE0, 0xE9, 0x99, 0xFB, 0xF4, 0x05, 0x12, 0x1F, 0xD3, 0xFF, 0xF0, 0x80, 0x5F, 0x0D,
-    0xA7, 0x24, 0xD5, 0x40, 0x08, 0x1A, 0x38, 0x69, 0x3F, 0x27, 0xC3, 0x48, 0x82, 0x5A, 0xBB, 0xD8,
-    0xCE, 0x7A, 0x1B, 0xA2, 0xC6, 0xDC, 0x0C, 0xE7, 0x8D, 0x1D, 0xD4, 0x0E, 0x2F, 0x1B, 0x0F, 0x70,
-    0x4A, 0xFA, 0x7E, 0x12, 0xD9, 0x2F, 0xA3, 0xD8, 0xFF, 0x07, 0xDD, 0x5C, 0x3F, 0x90, 0xDD, 0xC6,
-    0x79, 0x5F, 0x00, 0xBC, 0xC3, 0xF8, 0x50, 0x80, 0x05, 0x69, 0x4D, 0xC8, 0x19, 0x23, 0x45, 0x0A,
-    0x9B, 0x91, 0x89, 0x56, 0x85, 0x24, 0x20, 0xD1, 0x8C, 0x55, 0xA4, 0x61, 0x71, 0x8F, 0x2A, 0x58,
-    0x48, 0x45, 0x0A, 0x5B, 0x45, 0xD8, 0xB8, 0x48, 0x41, 0x1E, 0x10, 0xBB, 0x48, 0xA1, 0x42, 0xD7,
-    0x30, 0x45, 0xD2, 0xB0, 0x50, 0x71, 0x3C, 0x15, 0x49, 0x91, 0x42, 0x33, 0x16, 0x0F, 0xC8, 0xA4,
-    0x74, 0x21, 0x78, 0x9C, 0x99, 0x94, 0x86, 0xC7, 0x54, 0x32, 0x76, 0x23, 0x58, 0x7E, 0x8E, 0x40,
-    0x11, 0xC0, 0xE6, 0xFB, 0xFD, 0x76, 0x81, 0xF7, 0xDE, 0xF1, 0x28, 0x1E, 0xC9, 0xBB, 0xE3, 0x9D,
-    0xDF, 0x3D, 0x7C, 0x78, 0xF7, 0x1E, 0xB0, 0xFB, 0x7D, 0xDF, 0xEE, 0x7E, 0xFF, 0x17, 0x6A, 0x6D,
-    0x36, 0x4B, 0x95, 0x0A, 0xB4, 0xAE, 0x46, 0xE8, 0xF0, 0x9B, 0x95, 0x57, 0x50, 0x03, 0x86, 0x0D,
-    0x60, 0x34, 0x07, 0x4C, 0x3A, 0xC0, 0x37, 0x09, 0xEF, 0x6F, 0x01, 0x76, 0x89, 0x00, 0xA7, 0x4B,
-    0xE4, 0x5E, 0x6F, 0x1E, 0x95, 0x02, 0x9B, 0xB0, 0xC4, 0xAD, 0xB8, 0x39, 0xAC, 0x7C, 0xB9, 0x39,
-    0x2A, 0x3D, 0xB9, 0x39, 0xCE, 0xDD, 0x56, 0x1A, 0x90, 0x6B, 0x95, 0x2A, 0x66, 0xB3, 0x5E, 0x29,
-    0x2D, 0x2F, 0xE5, 0x10, 0xBA, 0xC3, 0xEE, 0x6E, 0x91, 0xE3, 0xB2, 0xA8, 0xC4, 0x2D, 0x61, 0x15,
-    0xCA, 0xED, 0x41, 0x83, 0x06, 0xFD, 0x26, 0x46, 0xB3, 0x2D, 0xBA, 0x70, 0xBB, 0x0C, 0x9D, 0xF6,
-    0x03, 0xE0, 0xA0, 0x66, 0xB3, 0x4D, 0x34, 0xD3, 0x59, 0xC0, 0x7F, 0xCD, 0x6B, 0x26, 0x47, 0xA6,
-    0xE7, 0xCA, 0xD3, 0x7A, 0x50, 0xEE, 0xC3, 0x1F, 0x68, 0xA5, 0x72, 0x95, 0xE4, 0xF2, 0x2D, 0x1A,
-    0x53, 0x68, 0x57, 0x85, 0xF6, 0xD3, 0x25, 0xAD, 0x4B, 0xA0, 0x51, 0x06, 0xC3, 0x9D, 0xA8, 0x8C,
-    0x6B, 0xF9, 0x4E, 0xAE, 0x14, 0x90, 0x0A, 0xC8, 0x70, 0x87, 0x7C, 0x4A, 0xCA, 0x44, 0x2E, 0x2A,
-    0xE3, 0x3F, 0xBE, 0xFB, 0x45, 0x19, 0x6A, 0xFD, 0x41, 0xE9, 0xEA, 0x3E, 0x28, 0xD5, 0x1A, 0x78,
-    0x16, 0x28, 0x07, 0xD8, 0xE6, 0x9E, 0x40, 0xFF, 0xF3, 0x9B, 0xD2, 0xAC, 0xAB, 0x35, 0x7E, 0x28,
-    0x7A, 0xE0, 0xE2, 0x28, 0x75, 0xD6, 0x18, 0x5B, 0xAB, 0x57, 0x95, 0x6A, 0xD4, 0xEB, 0x4A, 0xED,
-    0x5D, 0x47, 0xE3, 0xBA, 0xC1, 0x34, 0x01, 0xFB, 0xCE, 0xAB, 0x97, 0xC2, 0xE2, 0xD3, 0xCF, 0x32,
-    0xBC, 0x88, 0x97, 0x47, 0x4C, 0x83, 0x92, 0xF8, 0xE6, 0x84, 0xA4, 0x20, 0x34, 0xDF, 0x68, 0x5E,
-    0xA3, 0x4F, 0x9E, 0x8B, 0xC4, 0xE5, 0x4D, 0xF4, 0xF9, 0x29, 0x40, 0x3B, 0x21, 0x4C, 0x0E, 0x62,
-    0x84, 0x55, 0xD2, 0x8C, 0x68, 0x5D, 0xBA, 0x4B, 0x16, 0x13, 0xE5, 0x8C, 0xE8, 0x73, 0x2A, 0x7B,
-    0xBC, 0xC1, 0xAF, 0x0E, 0x9E, 0xD6, 0x37, 0xF5, 0x03, 0x4A, 0x13, 0x99, 0xFB, 0x89, 0xE1, 0x67,
-    0xA5, 0xFE, 0x4E, 0x79, 0xE4, 0x4D, 0xC0, 0xFE, 0x42, 0xF2, 0x86, 0x94, 0x19, 0x22, 0x6D, 0xE3,
-    0xE4, 0xA4, 0x2A, 0x0E, 0x01, 0xCD, 0xF5, 0xE6, 0x5E, 0x83, 0x5E, 0x5C, 0x2D, 0x66, 0x86, 0x4F,
-    0x2C, 0x5D, 0x99, 0xA9, 0x6B, 0x72, 0xC3, 0xF0, 0xB1, 0xFC, 0x1B, 0x6B, 0xDD, 0x73, 0x41, 0x02,
-    0x81, 0x35, 0x0A, 0x88, 0x0D, 0x21, 0x2E, 0xAA, 0x4D, 0x2B, 0x85, 0xE2, 0x2C, 0xC0, 0xA0, 0x39,
-    0x56, 0xFE, 0x39, 0x33, 0x0E, 0x89, 0xDC, 0x32, 0x0F, 0x86, 0xEB, 0x0D, 0xAF, 0x2C, 0x4D, 0xCF,
-    0x85, 0x1D, 0xEA, 0xC1, 0x32, 0xA4, 0x5F, 0xFA, 0xBF, 0xB0, 0xD8, 0xE1, 0xDA, 0xA8, 0x51, 0xE7,
-    0x83, 0xE1, 0x9F, 0xD9, 0x86, 0xB0, 0x45, 0x5A, 0xD8, 0xB4, 0xFD, 0xCA, 0x6F, 0xE4, 0x44, 0x62,
-    0xA6, 0x4D, 0xC6, 0xB9, 0x1A, 0x42, 0x0A, 0x57, 0x60, 0xAE, 0xA0, 0x7D, 0xED, 0x6C, 0x72, 0xD5,
-    0xFD, 0x48, 0x2E, 0xEF, 0xF0, 0x8B, 0x5C, 0x13, 0xE7, 0x4E, 0x17, 0xD4, 0x7E, 0xED, 0xB4, 0x32,
-    0x4B, 0x2E, 0x1C, 0x2F, 0x57, 0x1D, 0x62, 0xED, 0x13, 0xD3, 0xA0, 0x59, 0x7C, 0x36, 0xDF, 0xAB,
-    0xB3, 0x3A, 0x4B, 0x9D, 0x6D, 0xB3, 0xDC, 0xBC, 0xD6, 0x2E, 0xBB, 0xED, 0x05, 0x09, 0xC7, 0xC5,
-    0xCB, 0x8D, 0x54, 0xC9, 0x28, 0xFA, 0x35, 0x18, 0xE8, 0x74, 0x64, 0x40, 0x41, 0x82, 0x62, 0xCA,
-    0x88, 0x90, 0xAB, 0xDF, 0xB9, 0x76, 0x36, 0x39, 0xBA, 0x9E, 0xAB, 0x1D, 0x6F, 0x2E, 0xAC, 0xEC,
-    0x65, 0xB9, 0x25, 0x85, 0xC8, 0x4C, 0x41, 0x30, 0xE8, 0x16, 0x04, 0x1D, 0x17, 0x57, 0x77, 0xD4,
-    0x46, 0x0E, 0x6D, 0x03, 0xED, 0x14, 0xFE, 0x02, 0x9C, 0xF4, 0x1F, 0x81, 0x93, 0x60, 0x13, 0xEE,
-    0x27, 0x4D, 0x17, 0xF7, 0xF1, 0x34, 0xD3, 0x5F, 0xA7, 0x80, 0x20, 0x42, 0xA0, 0x5C, 0x9A, 0xA9,
-    0xB5, 0x62, 0x0E, 0x8E, 0x05, 0x3D, 0xA0, 0xA3, 0xC9, 0xBD, 0x2C, 0xCF, 0xC8, 0x59, 0xC0, 0xA8,
-    0xCA, 0xC8, 0xEB, 0x8C, 0x2B, 0x61, 0x01, 0xFD, 0x25, 0x18, 0x3C, 0x06, 0xCD, 0xF5, 0xE6, 0xDE,
-    0xA4, 0x9C, 0xDA, 0x34, 0xED, 0xB3, 0x2F, 0x07, 0xFD, 0x1A, 0x1C, 0xA0, 0xA5, 0x04, 0x0E, 0x66,
-    0x32, 0xBA, 0xDB, 0x3F, 0x62, 0xC3, 0x7B, 0x84, 0xDD, 0x02, 0xFE, 0x1E, 0xF4, 0xF9, 0x5F, 0xD6,
-    0xFC, 0x9C, 0xDB, 0x25, 0xB9, 0x76, 0x0D, 0xB0, 0xD0, 0x6F, 0x37, 0xD0, 0x76, 0xFF, 0xDB, 0xA8,
-    0xB0, 0xBF, 0x2E, 0x6A, 0x47, 0xF4, 0x58, 0xD6, 0x60, 0x64, 0xE3, 0x06, 0x3D, 0xCA, 0x80, 0x16,
-    0x84, 0x03, 0x97, 0xF3, 0xC0, 0x7B, 0xFB, 0x25, 0x38, 0x8C, 0x30, 0xE0, 0x95, 0xC1, 0x78, 0x17,
-    0x54, 0xE1, 0xD8, 0x5A, 0x38, 0xDC, 0x78, 0xC4, 0x5E, 0x7E, 0xD9, 0x00, 0xDD, 0xB7, 0x1A, 0x3B,
-    0xCA, 0xF2, 0xCD, 0x47, 0xE6, 0x04, 0xDE, 0xE3, 0xD4, 0x73, 0x75, 0xDD, 0x90, 0xA9, 0x8B, 0x45,
-    0x56, 0x54, 0x3C, 0x49, 0x3B, 0x38, 0xF9, 0x2D, 0x4F, 0x6E, 0xC7, 0x93, 0xD3, 0x9B, 0x75, 0x38,
-    0x98, 0x53, 0x31, 0x9E, 0x3E, 0x1E, 0x76, 0x73, 0x41, 0x01, 0x7A, 0x79, 0x3C, 0x15, 0xCA, 0x5F,
-    0xB9, 0x64, 0xE9, 0x3E, 0xDB, 0x8A, 0xD7, 0x2D, 0xF7, 0x60, 0xFB, 0x33, 0xBD, 0x5F, 0x06, 0x2E,
-    0x16, 0x33, 0x39, 0xD5, 0x3C, 0xFD, 0x56, 0x59, 0x86, 0x2F, 0xE4, 0xDB, 0x42, 0xE2, 0xF9, 0x72,
-    0x59, 0x6E, 0xA1, 0x33, 0xBB, 0xF1, 0xC7, 0xF1, 0x57, 0x87, 0x0C, 0xCF, 0x96, 0x18, 0x4E, 0xB6,
-    0x58, 0x86, 0x97, 0x64, 0x78, 0x7A, 0x30, 0xC3, 0x0F, 0x84, 0xCF, 0xC1, 0x70, 0xF1, 0x2A, 0xAE,
-    0xC9, 0xB7, 0x0D, 0x0E, 0x7C, 0x5E, 0x4C, 0x6F, 0xDD, 0x63, 0x32, 0xF1, 0xB0, 0x82, 0xE0, 0x89,
-    0x87, 0xD8, 0xF5, 0x72, 0x5D, 0xC7, 0x03, 0x9F, 0x9F, 0x76, 0xBD, 0x69, 0x7F, 0x18, 0x0F, 0xF6,
-    0x0B, 0x04, 0x0C, 0x58, 0x42, 0xC3, 0xD9, 0xE4, 0xA5, 0x95, 0xE2, 0x7A, 0x0D, 0xFA, 0x57, 0x7A,
-    0x59, 0x07, 0x42, 0x63, 0x02, 0x13, 0x8C, 0x06, 0x55, 0x01, 0xC3, 0x6B, 0x0F, 0x00, 0xB6, 0xA1,
-    0x05, 0xBB, 0xBB, 0xBB, 0xF9, 0xC2, 0xEA, 0x2B, 0x26, 0xF1, 0x44, 0xB9, 0x24, 0x2C, 0x71, 0x52,
-    0x5F, 0xFF, 0x53, 0x91, 0x3A, 0x94, 0x88, 0xB1, 0x7E, 0x68, 0xCC, 0x3C, 0x3F, 0x57, 0xFF, 0xE6,
-    0x95, 0x4E, 0xE3, 0x3D, 0xBC, 0x51, 0x2B, 0xCC, 0x12, 0x9A, 0x00, 0xA9, 0x7A, 0x19, 0x2C, 0xF1,
-    0x72, 0xF5, 0x63, 0xE5, 0x55, 0x62, 0xFF, 0xB9, 0x0F, 0x6F, 0x34, 0x8A, 0xE8, 0xA8, 0x98, 0xE4,
-    0x4C, 0x08, 0x9D, 0x28, 0x73, 0xA8, 0xEE, 0x30, 0x5B, 0xB1, 0x70, 0xBC, 0xC6, 0xFC, 0xBF, 0x22,
-    0x0E, 0x4F, 0x8E, 0x39, 0x46, 0xD5, 0x72, 0xCD, 0x42, 0xF9, 0x5A, 0xA3, 0x77, 0x15, 0x9F, 0x13,
-    0x65, 0xCE, 0xC9, 0x12, 0xEF, 0x62, 0x14, 0x4A, 0xE3, 0xB5, 0xC4, 0xC0, 0x0D, 0xFA, 0x45, 0x3E,
-    0x47, 0x3D, 0xD5, 0xC1, 0xC9, 0x51, 0x8F, 0xAB, 0x66, 0xED, 0xE8, 0x51, 0xF9, 0xE5, 0xE8, 0x4F,
-    0x19, 0x80, 0x7F, 0x03, 0xBD, 0xE4, 0x4B, 0x89, 0x92, 0xDD, 0xF1, 0x1B, 0xBF, 0x71, 0x3A, 0x71,
-    0x95, 0x32, 0x69, 0x3D, 0x16, 0x64, 0xC3, 0x76, 0xC5, 0x60, 0x39, 0x49, 0x4E, 0xC2, 0xDE, 0x50,
-    0x34, 0x38, 0x68, 0x71, 0xD0, 0xE4, 0xA0, 0xCD, 0x41, 0xA3, 0x63, 0x09, 0xAB, 0x93, 0x5D, 0x68,
-    0xCA, 0xDD, 0xA1, 0x7E, 0x18, 0x8C, 0x37, 0xCA, 0x3B, 0xDE, 0x85, 0x21, 0xD2, 0x63, 0xD9, 0x09,
-    0xB6, 0x1D, 0x3D, 0xA1, 0x0B, 0x8F, 0xD9, 0x78, 0x0F, 0x8D, 0xA2, 0x69, 0x60, 0x59, 0x89, 0x56,
-    0x12, 0x9B, 0xCF, 0x2F, 0x0D, 0xEF, 0xAD, 0x8D, 0xD7, 0x3C, 0x83, 0x8D, 0x17, 0xEB, 0x76, 0x1F,
-    0x94, 0xB5, 0x46, 0x67, 0xA8, 0xC5, 0xBD, 0x02, 0xE9, 0x67, 0x47, 0xD0, 0xD2, 0x6D, 0x48, 0x33,
-    0x18, 0x36, 0x9E, 0xD7, 0xC2, 0xC6, 0x93, 0x55, 0x59, 0x0C, 0xBB, 0x45, 0xAB, 0x22, 0x0D, 0xF3,
-    0xCE, 0x29, 0xB4, 0xDE, 0x36, 0xE6, 0x9B, 0x21, 0x8E, 0xB4, 0x91, 0x34, 0x52, 0xD6, 0x8B, 0x5C,
-    0x11, 0xDA, 0xBA, 0x65, 0xB2, 0xD6, 0xC0, 0xFD, 0x42, 0xF4, 0x94, 0xA8, 0x84, 0xDF, 0x34, 0x61,
-    0xFF, 0xCE, 0x23, 0xD8, 0x7B, 0x59, 0x43, 0x33, 0x84, 0xEA, 0x8D, 0x9A, 0x6E, 0xB0, 0xC0, 0x6F,
-    0xFA, 0x09, 0x0C, 0x13, 0x28, 0xAC, 0x09, 0x15, 0x36, 0x54, 0x85, 0x6C, 0x40, 0x9A, 0xA2, 0xB6,
-    0x13, 0x6D, 0x4B, 0xC5, 0x6B, 0x74, 0xB0, 0x51, 0xD6, 0x8C, 0x61, 0x60, 0x2A, 0x08, 0x97, 0xBE,
-    0x93, 0x8A, 0xE1, 0x17, 0xE9, 0x42, 0x83, 0x08, 0xD2, 0x20, 0x64, 0x3B, 0x95, 0x7A, 0x4D, 0x60,
-    0x43, 0x0F, 0x7D, 0xB8, 0x31, 0xE7, 0xBC, 0xC0, 0x4D, 0x11, 0xC7, 0x49, 0x1D, 0x60, 0x79, 0x9F,
-    0x85, 0x51, 0x71, 0x41, 0x96, 0x5B, 0xAB, 0x4F, 0x2C, 0x51, 0x05, 0x68, 0x32, 0x24, 0x4D, 0x14,
-    0x9D, 0xCE, 0x01, 0x51, 0xEA, 0x3D, 0x2E, 0x99, 0x6E, 0x01, 0x1D, 0x42, 0xF3, 0xFD, 0x41, 0xCE,
-    0xE5, 0x99, 0x58, 0x26, 0xEA, 0xEE, 0x48, 0x8F, 0xD7, 0x4D, 0x94, 0xAD, 0x92, 0x74, 0x5A, 0x07,
-    0xE4, 0x4C, 0xB1, 0xD9, 0xBE, 0xEE, 0xA9, 0x29, 0xCE, 0x66, 0xA0, 0xB3, 0x14, 0x29, 0xF4, 0xCA,
-    0x45, 0x34, 0xED, 0xCF, 0x00, 0xDE, 0x58, 0x89, 0xD1, 0xB9, 0xB4, 0x43, 0x9A, 0x15, 0x8D, 0x71,
-    0x4A, 0xC7, 0xE6, 0x0A, 0xF9, 0x5C, 0x54, 0xF4, 0x6D, 0x79, 0xDF, 0xFF, 0x75, 0x54, 0xD5, 0x74,
-    0x2D, 0x19, 0xCB, 0xBC, 0x30, 0x45, 0xD9, 0x46, 0x8D, 0x3C, 0x5D, 0x10, 0x3D, 0x2F, 0x9C, 0xCD,
-    0x66, 0x37, 0xCB, 0x8C, 0x4A, 0xD1, 0x42, 0x51, 0x8D, 0xFF, 0xFA, 0x62, 0x6D, 0x2E, 0xC1, 0x03,
-    0xC8, 0xFA, 0xF2, 0x1B, 0xC9, 0xBA, 0x44, 0x98, 0xA4, 0x87, 0x87, 0x17, 0xA1, 0xAA, 0xDE, 0x86,
-    0xC7, 0x97, 0xDC, 0x64, 0x14, 0xA5, 0xB8, 0x53, 0x88, 0x7F, 0x30, 0x47, 0x94, 0x32, 0xA9, 0xE1,
-    0x71, 0xC9, 0x04, 0xF4, 0x09, 0x3D, 0xFA, 0x5D, 0x0B, 0x98, 0xBE, 0x20, 0xA4, 0x38, 0x33, 0x91,
-    0x70, 0x78, 0xFA, 0x2B, 0xA7, 0xEB, 0xBD, 0xB0, 0x36, 0xDB, 0xD4, 0x2B, 0x2F, 0x7E, 0x59, 0xCC,
-    0x0E, 0xBC, 0xC1, 0xE1, 0x6F, 0x26, 0x8E, 0xAE, 0xA7, 0xD3, 0x20, 0xC3, 0x51, 0x1C, 0xDC, 0xC3,
-    0x8B, 0x9E, 0xEE, 0x2E, 0x82, 0xD2, 0x16, 0x72, 0xF1, 0x17, 0x30, 0xA4, 0x2C, 0x7C, 0xE5, 0x21,
-    0xDC, 0xBD, 0x95, 0x6B, 0xE6, 0xEB, 0xF7, 0x00, 0xA1, 0x86, 0xBC, 0xAF, 0x30, 0x7F, 0x3D, 0xFD,
-    0x40, 0xD6, 0x33, 0xC4, 0x87, 0x38, 0xE9, 0x3D, 0x3D, 0xF6, 0x0E, 0x5C, 0xF1, 0xDA, 0xC7, 0xE0,
-    0xFC, 0xF9, 0xA1, 0xB8, 0x34, 0xEF, 0x85, 0x83, 0x6A, 0x62, 0x59, 0x5E, 0x6F, 0x44, 0xBA, 0xFA,
-    0x7B, 0x47, 0xA7, 0xE7, 0x97, 0x96, 0x82, 0xC8, 0x33, 0x44, 0xD1, 0x64, 0x35, 0x3D, 0x34, 0x81,
-    0xFF, 0xA3, 0x3E, 0x6E, 0x3E, 0x98, 0xFA, 0x50, 0x9B, 0xEA, 0x2F, 0x7C, 0x9D, 0x7E, 0x12, 0xEA,
-    0xFF, 0x69, 0xAE, 0x06, 0xBA, 0x7E, 0x5D, 0xD6, 0xF3, 0x8A, 0xC9, 0x87, 0x85, 0x7E, 0x84, 0xC7,
-    0xC5, 0xD9, 0x2C, 0xD1, 0x5A, 0xDE, 0xF2, 0xC1, 0x74, 0x10, 0xE9, 0x2E, 0xD6, 0xDD, 0xBA, 0x08,
-    0xEE, 0x4C, 0xBD, 0xC8, 0xDB, 0x29, 0xB6, 0x4D, 0x53, 0x62, 0xA2, 0x8B, 0x75, 0x2F, 0xEF, 0x8B,
-    0x53, 0x1A, 0xB0, 0x7F, 0xFE, 0xF7, 0x8F, 0x55, 0xA0, 0x6E, 0xA9, 0x48, 0x25, 0x77, 0xF6, 0x80,
-    0xAA, 0x30, 0x4E, 0xC4, 0xDF, 0xB9, 0x05, 0x7F, 0xF0, 0x9D, 0x74, 0xAA, 0x40, 0x80, 0x3A, 0x94,
-    0x6B, 0xF0, 0x6C, 0x87, 0x90, 0x35, 0xF5, 0xF1, 0xAA, 0xF2, 0xD3, 0x37, 0xC4, 0x1F, 0x8B, 0xEE,
-    0x14, 0x62, 0xD6, 0xF6, 0xE2, 0x27, 0x34, 0x2B, 0xB8, 0x50, 0x8E, 0x1C, 0xE1, 0x91, 0xE9, 0xA6,
-    0xD0, 0xCD, 0x65, 0xBD, 0x2D, 0xCB, 0xEC, 0x45, 0xDE, 0xEB, 0x43, 0x6A, 0x9A, 0x82, 0xCB, 0x26,
-    0xAE, 0xE4, 0x2D, 0x6A, 0xBF, 0x96, 0xB0, 0x68, 0x10, 0x7E, 0x12, 0xF5, 0x96, 0x87, 0x75, 0xD8,
-    0x84, 0xB5, 0x9B, 0x8E, 0xF3, 0xEE, 0x70, 0x7F, 0x41, 0x1E, 0x4B, 0x7B, 0x9D, 0xB4, 0xD6, 0x49,
-    0x5B, 0x6C, 0xEA, 0x6F, 0xD1, 0xA7, 0xDB, 0x53, 0x38, 0xBC, 0xB7, 0x1C, 0x3A, 0x38, 0x6A, 0x6A,
-    0xFA, 0x03, 0x5E, 0xF2, 0x93, 0x2B, 0x12, 0xA5, 0xF1, 0x5A, 0xE9, 0xC9, 0x6B, 0xE5, 0xFA, 0x93,
-    0x01, 0x82, 0x95, 0x98, 0x2A, 0xE8, 0x97, 0x9D, 0xAF, 0xC4, 0x2C, 0xA8, 0xB6, 0xC5, 0x13, 0x54,
-    0x09, 0xA2, 0x9D, 0x09, 0x1D, 0xA2, 0xD6, 0x3A, 0xCB, 0x22, 0x8D, 0x92, 0xDC, 0x9B, 0x27, 0xA5,
-    0x3F, 0x97, 0x73, 0xF3, 0xAD, 0x7D, 0x01, 0x97, 0x24, 0xF5, 0x9A, 0xA3, 0x3C, 0x8C, 0x09, 0xB3,
-    0x7C, 0x30, 0xB5, 0xDA, 0xC8, 0x1C, 0xAF, 0xE4, 0xC8, 0x55, 0xD8, 0xDB, 0xBC, 0x1C, 0xC4, 0x2C,
-    0x56, 0x60, 0x96, 0x22, 0x87, 0x1B, 0x96, 0x5E, 0xB3, 0x92, 0x13, 0xF3, 0x6B, 0x13, 0xF3, 0x3C,
-    0xB1, 0xA3, 0x36, 0x32, 0x4C, 0x54, 0x2F, 0xC2, 0xAB, 0x08, 0x4A, 0x14, 0x0F, 0x2C, 0x2E, 0xC0,
-    0x37, 0x86, 0xA2, 0xC1, 0xFC, 0x28, 0x98, 0x1C, 0x0E, 0x73, 0x7F, 0x15, 0xDF, 0x23, 0x96, 0xA3,
-    0x07, 0x1E, 0x62, 0xE5, 0x26, 0x82, 0x5B, 0x22, 0x62, 0x3D, 0x6E, 0x8D, 0xF4, 0x60, 0x8A, 0xC0,
-    0x6F, 0x19, 0xA9, 0xAD, 0x01, 0x13, 0x04, 0xA7, 0x95, 0xC6, 0xAF, 0xD0, 0x6D, 0x19, 0x89, 0xCB,
-    0x68, 0x20, 0x67, 0x0A, 0x91, 0x89, 0xCC, 0x41, 0x6C, 0x27, 0x63, 0xE0, 0x3A, 0x43, 0xEE, 0x43,
-    0x65, 0x49, 0x6D, 0x93, 0xD3, 0x02, 0x1F, 0x51, 0xE3, 0xFE, 0x42, 0x53, 0x3A, 0x21, 0x65, 0x91,
-    0xA9, 0xA4, 0x02, 0x0C, 0xD9, 0x8E, 0xCF, 0x7E, 0xDD, 0x5E, 0x4D, 0xBD, 0xD8, 0x1E, 0x23, 0xF6,
-    0x1E, 0x30, 0x71, 0x21, 0x1D, 0x43, 0xBA, 0xE9, 0x7D, 0x3E, 0xD3, 0xFB, 0x84, 0x7B, 0x4B, 0x36,
-    0x32, 0x27, 0xA9, 0x4B, 0x0B, 0xDE, 0x33, 0xB9, 0x66, 0x48, 0x87, 0x1F, 0x4E, 0x69, 0xE8, 0x43,
-    0x01, 0x67, 0x10, 0x20, 0x78, 0xF5, 0xE0, 0x40, 0x0F, 0x7B, 0xA9, 0x47, 0xA8, 0xA4, 0x07, 0xF9,
-    0x3D, 0xB0, 0xEE, 0x61, 0xD5, 0xF7, 0x4C, 0xED, 0xC0, 0x7C, 0x65, 0xA8, 0x5D, 0x7F, 0x20, 0xD4,
-    0x0E, 0xBC, 0x04, 0x78, 0x0A, 0x1B, 0x71, 0x5B, 0x5C, 0xA1, 0x15, 0x24, 0x20, 0xE4, 0x17, 0xDB,
-    0x32, 0x99, 0x36, 0xBD, 0x36, 0xB6, 0xA7, 0x3C, 0x3D, 0x73, 0xF7, 0x6A, 0xCC, 0xB5, 0xBF, 0xAE,
-    0x96, 0x8B, 0x26, 0x06, 0xDC, 0x3B, 0x00, 0xAB, 0xC1, 0x44, 0xDC, 0x05, 0x85, 0x01, 0x1D, 0x0D,
-    0x60, 0xDD, 0x00, 0xE6, 0x0F, 0xE0, 0xFD, 0x00, 0xB7, 0x63, 0x40, 0x50, 0xD6, 0x60, 0xF5, 0xDF,
-    0xF2, 0x83, 0xFE, 0xEB, 0x4E, 0xD9, 0x8B, 0x81, 0xD5, 0x00, 0xAC, 0x6C, 0x2B, 0x82, 0x95, 0x6D,
-    0x59, 0xB0, 0x72, 0x76, 0x8D, 0x57, 0x87, 0xC6, 0x38, 0x73, 0x05, 0xCF, 0xDB, 0x2B, 0x95, 0x1B,
-    0xC7, 0xA2, 0xB0, 0x9E, 0x1C, 0x51, 0xDC, 0x05, 0x6A, 0x82, 0x91, 0xCC, 0x38, 0xE1, 0x50, 0x32,
-    0x26, 0x84, 0x2F, 0x11, 0xB5, 0x23, 0x7F, 0x9F, 0x28, 0x69, 0x53, 0x08, 0xEF, 0x23, 0x9B, 0xAC,
-    0x6D, 0x4C, 0x75, 0x44, 0x60, 0xE3, 0xA7, 0xE7, 0x40, 0x66, 0x92, 0x3E, 0xDF, 0x9F, 0x09, 0x6A,
-    0x86, 0x65, 0x24, 0xAA, 0xEE, 0x0D, 0x51, 0x76, 0xE7, 0xD1, 0xFF, 0x56, 0x06, 0xD9, 0x28, 0x0B,
-    0x45, 0x8E, 0x56, 0xAC, 0x1F, 0xF1, 0xE0, 0xDC, 0xEA, 0x38, 0x68, 0xFB, 0xE1, 0xFA, 0x76, 0x1F,
-    0x56, 0x7D, 0x58, 0xF6, 0x61, 0xDE, 0x47, 0xAA, 0xBF, 0xAA, 0xFA, 0x0B, 0x2F, 0x62, 0x50, 0xD9,
-    0xF7, 0xB3, 0xA1, 0xB4, 0x9E, 0x66, 0xF4, 0xC3, 0x90, 0xDF, 0xC4, 0x79, 0xFD, 0xD9, 0x48, 0x38,
-    0x0C, 0x4A, 0x1B, 0x22, 0x07, 0x72, 0xFB, 0xFE, 0xD6, 0xA1, 0x48, 0xA0, 0xF3, 0xF1, 0x8C, 0xC0,
-    0xCF, 0x51, 0x98, 0x54, 0xCA, 0x4A, 0x40, 0x8E, 0x0E, 0x39, 0x69, 0x66, 0x7F, 0x19, 0x4F, 0xCF,
-    0xBA, 0xB1, 0x9A, 0xE9, 0xE2, 0x37, 0xB7, 0x82, 0xF8, 0xC2, 0x02, 0xA8, 0x1D, 0x8A, 0xCB, 0x6F,
-    0x7A, 0x9F, 0x57, 0xFD, 0x5C, 0x89, 0x01, 0xA9, 0x6B, 0x57, 0xA7, 0x61, 0x87, 0x4E, 0xAE, 0x76,
-    0x4F, 0xBB, 0x4B, 0x04, 0x32, 0x1D, 0x5E, 0x8A, 0x69, 0x67, 0xA9, 0xEC, 0x87, 0xBE, 0xBF, 0x8A,
-    0x38, 0x2F, 0xCF, 0xED, 0x4F, 0x57, 0x23, 0x4C, 0x52, 0x67, 0x15, 0xD3, 0xCC, 0xD4, 0xEE, 0x59,
-    0x4B, 0xC8, 0xA0, 0xC3, 0x96, 0x26, 0x94, 0x8B, 0x04, 0xC6, 0x70, 0x65, 0xB7, 0x44, 0x6E, 0x09,
-    0x14, 0x41, 0x28, 0xD0, 0xED, 0x00, 0xA5, 0x43, 0xA4, 0xA8, 0xB3, 0x14, 0x50, 0xEC, 0x12, 0x81,
-    0x61, 0x0D, 0xE8, 0xCF, 0x01, 0xBD, 0x8E, 0x09, 0xEC, 0xC1, 0x03, 0x2C, 0xDE, 0x02, 0x4C, 0xFE,
-    0x13, 0x30, 0xFA, 0x0D, 0x60, 0xF0, 0x15, 0xA0, 0xA7, 0x1B, 0xA6, 0xAE, 0x99, 0xD8, 0x2E, 0x08,
-    0x13, 0x42, 0x58, 0x41, 0x2C, 0xBF, 0x89, 0xEB, 0x31, 0x20, 0x84, 0xD5, 0xEB, 0x4C, 0xE9, 0x85,
-    0x25, 0xFF, 0x5D, 0x1C, 0x94, 0x2E, 0x12, 0xAD, 0xD7, 0x15, 0x62, 0x6B, 0x0F, 0xFD, 0x75, 0xAD,
-    0x90, 0xF9, 0xCE, 0x65, 0xE0, 0xE2, 0x52, 0x33, 0x08, 0x0F, 0x51, 0x3F, 0x4C, 0xA0, 0x7F, 0x3E,
-    0x70, 0x16, 0x58, 0xB6, 0xFC, 0x5A, 0xDF, 0x5E, 0x4C, 0x02, 0x53, 0xCB, 0x66, 0xA6, 0x02, 0x75,
-    0x9D, 0x09, 0x5A, 0x59, 0x1D, 0x73, 0x42, 0x0C, 0x5C, 0x46, 0x6E, 0x67, 0x1C, 0xCC, 0x45, 0xB8,
-    0x8C, 0x09, 0xA3, 0x20, 0x1F, 0x63, 0x6B, 0xDF, 0x63, 0xF2, 0x3C, 0xCA, 0x4D, 0x19, 0x1F, 0xB4,
-    0xBE, 0x3B, 0x70, 0xB6, 0x17, 0xA4, 0x33, 0x21, 0x5D, 0x6B, 0xE9, 0x59, 0x9B, 0xD6, 0x1B, 0xCC,
-    0x32, 0x35, 0xA0, 0xB8, 0x47, 0x7C, 0x32, 0x2B, 0x6C, 0xAA, 0xCE, 0xC4, 0x41, 0x97, 0x72, 0x5F,
-    0x27, 0x34, 0x2A, 0x56, 0x4A, 0x18, 0x58, 0x2E, 0x05, 0x61, 0x4D, 0xAC, 0x8B, 0xA8, 0x6C, 0x31,
-    0x84, 0x79, 0x3B, 0xFC, 0x89, 0xA8, 0xD0, 0x4F, 0xC3, 0xCF, 0xB4, 0x2E, 0xAF, 0x85, 0xFA, 0x0E,
-    0xCA, 0x08, 0x3A, 0x98, 0x8A, 0xC2, 0x44, 0x71, 0x62, 0xC4, 0x6A, 0x73, 0x5B, 0xCC, 0x37, 0xE1,
-    0xA3, 0x0C, 0xF6, 0xD1, 0xC1, 0x43, 0x0D, 0x6A, 0x62, 0x06, 0xB5, 0x5A, 0x0C, 0xAA, 0x67, 0x06,
-    0xB5, 0x5F, 0x1A, 0xD4, 0x24, 0x07, 0x8C, 0x2A, 0x0E, 0x6A, 0xC3, 0xE1, 0x6C, 0x01, 0x9D, 0x9E,
-    0x83, 0x5A, 0x70, 0x50, 0x93, 0x9F, 0x72, 0x38, 0x7F, 0xC9, 0xE1, 0xFC, 0xC3, 0x53, 0x86, 0x33,
-    0xDB, 0x57, 0xC4, 0xE6, 0xD7, 0xFB, 0xCA, 0xA7, 0x34, 0x23, 0xAD, 0xC6, 0xF4, 0xD0, 0x0F, 0x1E,
-    0x1F, 0xDC, 0x4C, 0x7E, 0x1A, 0x86, 0xEB, 0x3A, 0x3D, 0xAE, 0x25, 0x77, 0x10, 0xE0, 0x38, 0xC3,
-    0x9A, 0x36, 0x3E, 0x26, 0x90, 0x83, 0x5F, 0x64, 0x2B, 0x2D, 0x58, 0x75, 0x31, 0x9D, 0x96, 0xAB,
-    0x40, 0x16, 0xF6, 0x53, 0x81, 0x98, 0x39, 0x82, 0xC9, 0xBD, 0x09, 0xDF, 0x09, 0xE2, 0x88, 0xAD,
-    0xCB, 0xF0, 0xF8, 0x1D, 0xA7, 0x32, 0x0C, 0x76, 0xB1, 0x21, 0x39, 0xAF, 0x06, 0x93, 0xE3, 0x2C,
-    0x8C, 0x1C, 0xCF, 0x52, 0x93, 0xF6, 0xCC, 0x0B, 0x53, 0x1B, 0x66, 0x0A, 0xD6, 0x9E, 0x7E, 0x32,
-    0xB5, 0x4E, 0x72, 0x1F, 0x67, 0xA6, 0x18, 0x5C, 0xA6, 0xCD, 0xD8, 0xF4, 0x80, 0xFE, 0x30, 0xD6,
-    0xA6, 0x77, 0x51, 0x9F, 0xC0, 0x05, 0xA5, 0x65, 0x30, 0xCA, 0x23, 0x63, 0xFB, 0x39, 0x34, 0xCE,
-    0x6D, 0x02, 0xF7, 0xC9, 0xC5, 0xE8, 0xCE, 0xCC, 0xE6, 0xF1, 0x5C, 0x90, 0x17, 0x60, 0x70, 0x10,
-    0xD7, 0x2D, 0xA5, 0x43, 0xD6, 0x5E, 0x05, 0x90, 0x46, 0xDE, 0x7C, 0x18, 0x41, 0xDB, 0x4F, 0x80,
-    0xFF, 0xEE, 0xE1, 0x07, 0x4C, 0x1B, 0xF1, 0xA4, 0xE5, 0xE2, 0x18, 0xB7, 0x85, 0x68, 0xC0, 0x97,
-    0xA6, 0x80, 0x04, 0xAB, 0xDD, 0x80, 0x09, 0x7A, 0xF4, 0x72, 0xF5, 0xEF, 0xC6, 0x6F, 0x62, 0x78,
-    0x85, 0xE5, 0x1D, 0xB6, 0xC0, 0x63, 0x2C, 0xF1, 0x58, 0xAE, 0x3A, 0xF9, 0x53, 0x1A, 0x02, 0xA7,
-    0x52, 0xAF, 0x22, 0x7B, 0x7A, 0x4B, 0xEE, 0x46, 0xD9, 0x7A, 0x86, 0x09, 0x17, 0xAD, 0x96, 0xAD,
-    0x9F, 0xEC, 0x60, 0xA8, 0x2B, 0xFF, 0xC0, 0x6C, 0x7B, 0xC6, 0x34, 0x1B, 0x33, 0xD1, 0x42, 0x53,
-    0xCB, 0x45, 0xE3, 0xD5, 0xA8, 0xAA, 0x50, 0x61, 0x7E, 0x9B, 0x9A, 0x67, 0xC5, 0x3F, 0xFB, 0x13,
-    0x5A, 0x16, 0x1B, 0xDB, 0xBB, 0x68, 0x14, 0xA6, 0x3F, 0x8A, 0xEE, 0xC1, 0x02, 0x77, 0x2E, 0x0C,
-    0xF0, 0xAA, 0x18, 0x9A, 0xF9, 0xDC, 0x4B, 0x1A, 0x98, 0x05, 0x87, 0x35, 0xD2, 0x04, 0x11, 0x73,
-    0x15, 0x2D, 0x79, 0x2C, 0x67, 0x57, 0xF8, 0x0E, 0x6E, 0x80, 0xCE, 0xC2, 0x66, 0x13, 0x0B, 0xAB,
-    0xD6, 0x0A, 0x2B, 0xEB, 0x0A, 0x35, 0x55, 0x90, 0x4F, 0x35, 0xA2, 0x2B, 0x87, 0x08, 0xBA, 0xC2,
-    0x0C, 0x5B, 0xB3, 0x72, 0x1E, 0xBF, 0x5F, 0x3A, 0x32, 0x7B, 0x4E, 0xD2, 0xD5, 0xF6, 0xC7, 0xFE,
-    0xC6, 0xFE, 0x47, 0x7C, 0xC0, 0x78, 0x8E, 0x16, 0x38, 0x0F, 0xBC, 0x47, 0xFC, 0x5D, 0x7B, 0xB6,
-    0xCC, 0xE7, 0x69, 0x8D, 0x85, 0xA4, 0x95, 0xC3, 0xC8, 0xB1, 0x6E, 0x43, 0x99, 0x45, 0x41, 0xFF,
-    0xCE, 0x10, 0x7F, 0x7E, 0xB3, 0x96, 0xF6, 0x33, 0x14, 0x2B, 0x22, 0x03, 0xD8, 0x99, 0x1D, 0x0D,
-    0xA1, 0x09, 0x66, 0x41, 0x0F, 0x73, 0x6F, 0x83, 0x3F, 0x9E, 0xA5, 0xDD, 0xA1, 0x5F, 0x3A, 0x7F,
-    0xBD, 0xBB, 0x7B, 0x6F, 0xB0, 0x7A, 0xCA, 0x5E, 0xC7, 0xF2, 0xC0, 0xD6, 0xA8, 0xF9, 0xB0, 0x33,
-    0xFC, 0x61, 0xC5, 0x0B, 0xA2, 0x40, 0x45, 0xAE, 0x2E, 0x04, 0x83, 0xF4, 0xFB, 0xF0, 0x06, 0x1C,
-    0x98, 0x36, 0x00, 0x9E, 0xB1, 0xA8, 0xA9, 0xC2, 0xD6, 0xC9, 0xD2, 0x56, 0xA1, 0x91, 0x1E, 0x4D,
-    0x46, 0x7A, 0x31, 0x3A, 0x3F, 0xFB, 0x8D, 0x74, 0x4E, 0x96, 0xDF, 0x22, 0x56, 0xAD, 0x4D, 0x71,
-    0x2A, 0xBC, 0x45, 0x9D, 0x67, 0x76, 0x02, 0x73, 0xCA, 0xD8, 0x79, 0x03, 0x30, 0xFD, 0x1B, 0x56,
-    0xF6, 0x12, 0x47, 0xA7, 0xAC, 0xAE, 0xCD, 0x30, 0x5B, 0x33, 0xAC, 0x2C, 0x68, 0x72, 0x13, 0x18,
-    0x83, 0x1E, 0x47, 0x38, 0xAB, 0x33, 0xD1, 0xAC, 0x8C, 0xAB, 0x69, 0xB9, 0x65, 0x36, 0xEA, 0x75,
-    0x26, 0xD2, 0xE6, 0xDC, 0xB3, 0xD1, 0x8D, 0x88, 0xD1, 0x8D, 0x4F, 0xA7, 0xF0, 0xDF, 0xAC, 0x0B,
-    0x74, 0x97, 0x0C, 0x9D, 0xBE, 0x27, 0x38, 0xCA, 0x02, 0x91, 0x41, 0x63, 0xF4, 0x86, 0x61, 0xA8,
-    0xA7, 0x3A, 0xCA, 0xA7, 0x84, 0xBA, 0xA5, 0xD7, 0x8F, 0xA6, 0xE8, 0x5A, 0x37, 0xE6, 0xB0, 0x19,
-    0xA4, 0x63, 0x8C, 0xCE, 0x24, 0xB0, 0x2F, 0xA6, 0x89, 0xAB, 0xCB, 0x24, 0xD4, 0x79, 0x92, 0xFC,
-    0x2E, 0x45, 0x20, 0x17, 0x7B, 0x4A, 0x92, 0xCA, 0x9A, 0x07, 0xB9, 0x3D, 0x9E, 0x21, 0x1F, 0x31,
-    0x45, 0xD8, 0x72, 0x63, 0x67, 0x40, 0x68, 0x26, 0xD6, 0xE1, 0xF8, 0xC4, 0x4A, 0xF6, 0x43, 0x97,
-    0x5A, 0x9D, 0xA2, 0x69, 0xF3, 0x3D, 0xC1, 0x3A, 0x96, 0xBF, 0xA0, 0xDE, 0x53, 0xDE, 0xA3, 0xD6,
-    0xEC, 0xC0, 0x01, 0x93, 0xD6, 0x46, 0x44, 0x8F, 0x83, 0x97, 0xA6, 0x3E, 0xAA, 0x1D, 0x6D, 0x4A,
-    0x9A, 0x94, 0xD9, 0x14, 0x72, 0x5D, 0x35, 0xCC, 0x2E, 0xA3, 0xC8, 0x02, 0xF9, 0x74, 0x2C, 0xF9,
-    0x32, 0x6C, 0xD5, 0xE5, 0x34, 0xAA, 0xC6, 0x9B, 0xE2, 0x7C, 0x02, 0xE5, 0xB8, 0x62, 0xB9, 0xE4,
-    0x3D, 0xAA, 0x2C, 0x2A, 0x82, 0x08, 0x0B, 0xDB, 0xA1, 0xEE, 0x0A, 0xCC, 0x7E, 0xB8, 0x72, 0x74,
-    0x0D, 0xD8, 0x3B, 0x0D, 0x5D, 0x02, 0xFE, 0x1B, 0x55, 0xAF, 0x09, 0x32, 0x65, 0xF2, 0xF5, 0xC7,
-    0x1A, 0xFB, 0x08, 0x3A, 0x41, 0x00, 0x31, 0x12, 0x16, 0x3B, 0xA8, 0x4B, 0xDB, 0x93, 0x54, 0xE4,
-    0x7E, 0x9D, 0xC6, 0x04, 0xD9, 0x46, 0x66, 0xAD, 0x6D, 0x42, 0xC4, 0x3F, 0x80, 0x4C, 0x89, 0x3F,
-    0xFF, 0x36, 0x54, 0xC0, 0xF9, 0xC4, 0xBA, 0x1B, 0xAC, 0xCB, 0x87, 0x81, 0x8F, 0xC6, 0x0A, 0xD4,
-    0x44, 0xE0, 0x43, 0x36, 0x37, 0xD2, 0x94, 0xC2, 0x05, 0x18, 0x76, 0x7F, 0x2E, 0x03, 0x97, 0xDC,
-    0x79, 0x77, 0x2E, 0x5D, 0xD7, 0x97, 0x81, 0x3F, 0xB2, 0xF2, 0x2C, 0xDD, 0x60, 0x5D, 0x49, 0xC0,
-    0x12, 0xD9, 0x9F, 0x37, 0x46, 0x8F, 0x89, 0xAF, 0xB9, 0x05, 0x33, 0x6A, 0xED, 0xB4, 0x32, 0x6C,
-    0xCC, 0x4D, 0x64, 0xCC, 0xA5, 0xA8, 0xC7, 0x72, 0x29, 0xC7, 0xC6, 0xB0, 0x53, 0xC4, 0x88, 0xF5,
-    0x49, 0x38, 0x71, 0xC6, 0x3B, 0x8C, 0x68, 0xD1, 0xE8, 0x62, 0xE4, 0x22, 0x1B, 0xB7, 0x61, 0x25,
-    0x0F, 0x8E, 0x89, 0x21, 0xAF, 0x54, 0x26, 0x02, 0x01, 0x24, 0xD7, 0x3B, 0x9B, 0x12, 0xC0, 0x71,
-    0x9F, 0x49, 0x23, 0xD4, 0x94, 0x38, 0x77, 0xD5, 0x15, 0xDC, 0x8E, 0xD5, 0xFD, 0x16, 0x22, 0xF6,
-    0x5F, 0xC0, 0x2F, 0x85, 0xCD, 0xEA, 0x12, 0xDD, 0xCD, 0xD3, 0xBA, 0x24, 0x37, 0x52, 0xE7, 0x2E,
-    0x76, 0x56, 0xBA, 0xAD, 0x74, 0x39, 0x0C, 0x26, 0x82, 0x09, 0x3B, 0x65, 0x54, 0xD2, 0xC7, 0x34,
-    0xC3, 0x58, 0xE2, 0x93, 0x16, 0x4B, 0x70, 0xB5, 0xB4, 0xEB, 0x34, 0xC0, 0xAB, 0x6A, 0x4A, 0xFD,
-    0xD8, 0x34, 0x11, 0x07, 0xC3, 0xA6, 0xB4, 0x9C, 0x85, 0x7F, 0xEF, 0x71, 0x0B, 0x90, 0xD9, 0x29,
-    0xF5, 0x5D, 0x5B, 0xF5, 0xD5, 0x99, 0xC3, 0xE5, 0x5E, 0x3A, 0x51, 0x4D, 0x72, 0xBC, 0xD2, 0xCF,
-    0x52, 0xD7, 0x7E, 0x77, 0xD8, 0x03, 0x5C, 0xA4, 0xFA, 0xD6, 0x77, 0xC0, 0xB4, 0x9C, 0x8E, 0x90,
-    0xF7, 0x5F, 0xB6, 0xB6, 0x1B, 0x13, 0xB2, 0xB7, 0x93, 0x31, 0x31, 0xD9, 0x37, 0x3B, 0x21, 0xED,
-    0x76, 0xA5, 0x8C, 0xA4, 0x44, 0xFF, 0x61, 0xB6, 0x2B, 0xD1, 0x6D, 0x31, 0xDB, 0x95, 0xF4, 0x13,
-    0xB6, 0x2B, 0x9D, 0xFE, 0x51, 0x31, 0x11, 0x4C, 0xC6, 0xA7, 0x42, 0x5B, 0x4C, 0xFE, 0x5D, 0x15,
-    0x81, 0xE9, 0x57, 0xC1, 0xF1, 0x0B, 0x86, 0xF5, 0xAC, 0x85, 0x8C, 0xA9, 0xD8, 0x01, 0xC0, 0x7A,
-    0xF3, 0xDD, 0x73, 0x02, 0x13, 0xBA, 0xA7, 0xD5, 0x84, 0x91, 0xE0, 0x50, 0x58, 0xA7, 0x74, 0xF3,
-    0xE8, 0xF8, 0x66, 0x76, 0x0A, 0x19, 0xE8, 0x9A, 0x5D, 0x43, 0x47, 0xC5, 0xB7, 0x67, 0x9C, 0x97,
-    0xB2, 0x56, 0x79, 0xFC, 0xE5, 0xB0, 0x7B, 0xF8, 0x79, 0x49, 0xF3, 0x3F, 0xC5, 0x1E, 0x8B, 0xB8,
-    0x73, 0x21, 0x0A, 0xF4, 0xBF, 0xC8, 0x08, 0xB5, 0x31, 0x7E, 0x6A, 0xDC, 0xE1, 0xA0, 0x88, 0xC5,
-    0x16, 0xE3, 0x4E, 0xC5, 0x09, 0xC2, 0xC5, 0x46, 0x3B, 0x71, 0x8E, 0xB1, 0x44, 0x52, 0x38, 0xC5,
-    0x1A, 0x7B, 0x0C, 0x58, 0x3D, 0xF6, 0xBB, 0x62, 0x4E, 0xE1, 0x5C, 0x61, 0x7C, 0x07, 0x63, 0xC1,
-    0xB1, 0xA6, 0x73, 0x5D, 0x16, 0x56, 0x1D, 0xA6, 0x8E, 0x1E, 0x6E, 0x8A, 0x1F, 0x53, 0xC8, 0xB5,
-    0xA5, 0x78, 0x49, 0xFB, 0xF6, 0x4F, 0x8B, 0x7C, 0xF4, 0x9B, 0x17, 0x04, 0x01, 0x40, 0xD8, 0x88,
-    0x78, 0x8D, 0x1A, 0xC1, 0x0D, 0xF5, 0x9C, 0x37, 0x1E, 0x35, 0x3E, 0x8A, 0x44, 0x59, 0x2E, 0x6A,
-    0x2C, 0x61, 0x53, 0x82, 0x95, 0x70, 0xAE, 0x19, 0xB8, 0x36, 0x9B, 0x9D, 0x51, 0xE6, 0x3E, 0xF9,
-    0x09, 0x10, 0x27, 0xCA, 0xD2, 0xD7, 0x94, 0x9F, 0xC2, 0x25, 0xE1, 0x9E, 0x99, 0x3B, 0xF4, 0xD8,
-    0x35, 0x25, 0x80, 0x89, 0x84, 0x9C, 0x3B, 0xAB, 0x73, 0xB7, 0x56, 0xDF, 0x9F, 0x9E, 0x03, 0xD1,
-    0x3D, 0xE1, 0x39, 0x10, 0x27, 0xCA, 0x68, 0x75, 0x25, 0xA5, 0x25, 0x07, 0xB6, 0x7A, 0xBF, 0x66,
-    0x91, 0x53, 0x7E, 0x8B, 0xF0, 0x75, 0xA6, 0x7C, 0xE0, 0x11, 0x7A, 0xDC, 0x5D, 0xAB, 0x8C, 0xBA,
-    0x3A, 0xB3, 0xAC, 0x67, 0x4A, 0x8B, 0x86, 0x60, 0xF8, 0xB6, 0xFC, 0xF4, 0x1D, 0x57, 0x48, 0xFE,
-    0x3E, 0x9E, 0x33, 0x12, 0xE1, 0x53, 0xF8, 0x05, 0x2A, 0xD2, 0x69, 0xC1, 0xBD, 0xA4, 0x91, 0x70,
-    0x77, 0x50, 0xF3, 0xE2, 0xCF, 0x61, 0xCB, 0xD1, 0x3B, 0x16, 0xD3, 0x93, 0x16, 0x05, 0x33, 0x70,
-    0x2D, 0xCD, 0xEE, 0x6B, 0xCE, 0x59, 0xE5, 0xFE, 0xC6, 0xF6, 0xFB, 0xB8, 0x0F, 0x66, 0xED, 0x5F,
-    0xC9, 0xC4, 0xDF, 0x13, 0x7F, 0xD3, 0x69, 0xC5, 0xE1, 0xF4, 0xEA, 0x68, 0x25, 0x6A, 0x79, 0xA2,
-    0x3C, 0x3F, 0xE5, 0xDC, 0xA3, 0x5C, 0xB8, 0x78, 0x93, 0x3C, 0xB9, 0xB5, 0xA8, 0xE3, 0x5A, 0x81,
-    0xA6, 0xBE, 0x4B, 0x9B, 0x94, 0x6B, 0xF3, 0x12, 0xB8, 0xC8, 0xE7, 0xB2, 0x30, 0x65, 0x7D, 0x7B,
-    0xDA, 0x66, 0xD1, 0x4D, 0x71, 0x2D, 0x90, 0x43, 0xB7, 0xD9, 0x46, 0x87, 0x77, 0xEC, 0x87, 0xE9,
-    0x79, 0x2D, 0xE1, 0xB8, 0x09, 0x25, 0xF9, 0xB0, 0x36, 0x1F, 0xF6, 0x4C, 0x71, 0x04, 0x12, 0xCF,
-    0xF7, 0x95, 0xAD, 0x55, 0x3B, 0x77, 0xE0, 0xDE, 0xA0, 0x6C, 0x0C, 0x5D, 0xA0, 0xF0, 0x9E, 0xB9,
-    0x46, 0xD4, 0xF0, 0x73, 0x93, 0x06, 0x92, 0xC7, 0xC8, 0xD0, 0xD5, 0x51, 0x49, 0xBF, 0x0C, 0x15,
-    0xAE, 0x2A, 0xFC, 0x15, 0x1E, 0xEE, 0x22, 0xA6, 0x7A, 0xF4, 0x59, 0x29, 0x8B, 0x4B, 0xBC, 0xB2,
-    0xF8, 0xC3, 0x52, 0xF8, 0x84, 0x8D, 0x00, 0x7F, 0x53, 0x9B, 0xB2, 0xF2, 0xC4, 0xB7, 0x61, 0xA7,
-    0x2D, 0x99, 0xA1, 0x7B, 0x30, 0xB0, 0xEE, 0xE3, 0x09, 0x07, 0xE8, 0xA8, 0x73, 0x3A, 0x74, 0xD7,
-    0xE3, 0x23, 0x0C, 0xAF, 0xC1, 0x6D, 0x55, 0x8F, 0xE2, 0xD0, 0x42, 0xAE, 0x20, 0xD6, 0x89, 0xDC,
-    0x93, 0xC1, 0x0F, 0x49, 0xDE, 0x96, 0xE6, 0xE0, 0xF5, 0xC5, 0x1F, 0x54, 0xD2, 0x09, 0x84, 0x8C,
-    0x74, 0x19, 0x7D, 0x86, 0xFA, 0x42, 0xF9, 0x80, 0x43, 0x24, 0x4E, 0xCE, 0x83, 0xF8, 0xF9, 0x90,
-    0x3C, 0xC0, 0x98, 0x8C, 0x01, 0x0D, 0xE6, 0x03, 0x9E, 0xB8, 0x30, 0x58, 0xCB, 0xD7, 0xC6, 0x0E,
-    0xAF, 0x58, 0xCB, 0xCD, 0x24, 0xA0, 0x4C, 0xED, 0xF2, 0xB4, 0x87, 0xC2, 0xEE, 0x6B, 0xA4, 0x64,
-    0x60, 0xE1, 0x9C, 0x48, 0x33, 0x27, 0x3D, 0x90, 0x75, 0x18, 0x54, 0x3C, 0xDF, 0xA6, 0x00, 0x2F,
-    0x84, 0x71, 0x32, 0xE7, 0x92, 0x54, 0xF8, 0x86, 0x30, 0x9C, 0xFC, 0xE2, 0x7C, 0x85, 0xCD, 0xE9,
-    0x61, 0xE5, 0x7D, 0x39, 0x67, 0xC5, 0x9F, 0xF7, 0x7B, 0x54, 0x06, 0x07, 0x8D, 0x5F, 0x83, 0x0B,
-    0x5E, 0x13, 0x54, 0x9D, 0x8B, 0xCD, 0xF6, 0x61, 0x09, 0xD2, 0xDD, 0x36, 0xCA, 0x33, 0xAC, 0xE9,
-    0x2E, 0x4E, 0xC1, 0x42, 0x3C, 0x3A, 0x28, 0x16, 0x9E, 0xAA, 0xFE, 0x4D, 0x15, 0x7D, 0x28, 0x64,
-    0xEF, 0xDD, 0x36, 0x54, 0x67, 0x9F, 0x72, 0x18, 0xE0, 0xDC, 0x92, 0xE6, 0x64, 0x6E, 0x28, 0xC5,
-    0x8E, 0x7D, 0x6D, 0x02, 0xF3, 0x24, 0xD8, 0x92, 0x49, 0x22, 0x0D, 0x89, 0xC1, 0x1F, 0xDA, 0x89,
-    0x3C, 0x43, 0xDC, 0x63, 0xA4, 0xED, 0xB1, 0x5C, 0x90, 0xCF, 0x8E, 0xC8, 0x4D, 0x6C, 0x0B, 0xCE,
-    0x49, 0x0F, 0xFF, 0xDB, 0x3C, 0x73, 0x00, 0x98, 0x32, 0xB2, 0xAC, 0x06, 0x9B, 0x0A, 0x30, 0x51,
-    0x3F, 0xB3, 0x31, 0x85, 0xBB, 0x1C, 0x7F, 0x4D, 0x07, 0x8D, 0x7D, 0x79, 0x26, 0xBF, 0x6A, 0xDD,
-    0xB4, 0xF2, 0x59, 0x37, 0xA1, 0x1C, 0x08, 0x9D, 0x29, 0xFE, 0x15, 0x32, 0xFE, 0xF5, 0x99, 0xF0,
-    0x68, 0xCF, 0xC4, 0xBF, 0xF6, 0xF6, 0xC7, 0xBF, 0x0A, 0xFB, 0x4C, 0x24, 0x6E, 0x9A, 0xE2, 0x93,
-    0x92, 0x82, 0x06, 0xD3, 0xB8, 0x0A, 0x6A, 0xF3, 0x28, 0x25, 0x14, 0x1C, 0x4B, 0xB3, 0x42, 0x52,
-    0x81, 0x45, 0x37, 0x80, 0x03, 0x9D, 0xCD, 0x0B, 0x31, 0xF8, 0x11, 0xFF, 0x23, 0x8A, 0x82, 0x7F,
-    0x8E, 0x12, 0xDF, 0x5F, 0xA1, 0x4C, 0x63, 0x52, 0x72, 0x26, 0x74, 0x33, 0x8C, 0xEB, 0xD4, 0x64,
-    0x04, 0xDA, 0xD1, 0x8B, 0x9E, 0x42, 0x99, 0x3F, 0xC3, 0xB5, 0x7C, 0xE8, 0x56, 0x66, 0x32, 0x50,
-    0x5C, 0x89, 0x51, 0xBE, 0x35, 0xA5, 0xB7, 0xCC, 0x67, 0xE7, 0xE0, 0x15, 0x7A, 0x06, 0xC6, 0x43,
-    0xB9, 0xF7, 0xC6, 0x4D, 0x7B, 0xDC, 0xE1, 0x66, 0x32, 0xEF, 0x93, 0x10, 0x5B, 0x09, 0xE0, 0xE2,
-    0x59, 0x2C, 0x08, 0x9D, 0xE8, 0x36, 0x31, 0x39, 0x21, 0x7B, 0x4B, 0x35, 0x6E, 0x12, 0x2E, 0x46,
-    0xCF, 0x94, 0xED, 0x05, 0x4F, 0xFF, 0xB1, 0x5E, 0xF9, 0x71, 0x78, 0xD2, 0x8F, 0xD2, 0x5B, 0xB7,
-    0x00, 0x66, 0x5F, 0x18, 0x8A, 0x2E, 0xB4, 0x11, 0x0C, 0x88, 0xDD, 0x86, 0xCB, 0x81, 0x6E, 0xA2,
-    0xDA, 0xE1, 0xB8, 0x38, 0x7B, 0xA7, 0xB3, 0xA5, 0xE1, 0xD5, 0xE2, 0xF9, 0x4C, 0xBD, 0x19, 0xEC,
-    0xA0, 0x31, 0xF4, 0x82, 0x11, 0x83, 0x95, 0xA5, 0x73, 0x33, 0xFA, 0x2C, 0x63, 0xDE, 0xDD, 0xDD,
-    0x29, 0x4C, 0xA7, 0x9D, 0xF1, 0x5A, 0xCD, 0x84, 0x59, 0x4C, 0x9D, 0x0B, 0x8F, 0x8D, 0xF8, 0x69,
-    0x61, 0x91, 0x6B, 0x83, 0x84, 0xE3, 0xE1, 0xA6, 0xFB, 0xD1, 0x3C, 0x52, 0xF6, 0x38, 0x77, 0x51,
-    0x7D, 0x7B, 0x1F, 0x0A, 0x2B, 0xF9, 0x69, 0x0B, 0xD9, 0xCE, 0xA7, 0x8C, 0xE4, 0xE3, 0x42, 0xDB,
-    0x3C, 0x85, 0x3C, 0xBA, 0xA4, 0x9C, 0xBB, 0x50, 0x8B, 0xDE, 0x5C, 0x08, 0x64, 0xBC, 0xB1, 0x35,
-    0x35, 0x6A, 0x4B, 0x35, 0x5B, 0x47, 0x3E, 0x8D, 0xDE, 0xDF, 0xF6, 0xF5, 0x3C, 0xD2, 0x4D, 0x52,
-    0x5D, 0xCB, 0x28, 0x1F, 0x06, 0x75, 0x04, 0x35, 0xB0, 0xFF, 0x0F, 0xED, 0x5C, 0x3D, 0x90, 0xDC,
-    0xD6, 0x91, 0x7E, 0x00, 0xC8, 0x9D, 0x2A, 0x22, 0x00, 0x03, 0xD2, 0xB2, 0xC9, 0xB2, 0xA0, 0xF0,
-    0xCC, 0xAA, 0x3B, 0xA4, 0x76, 0x95, 0x2C, 0xA0, 0xC4, 0x2A, 0x2B, 0xF4, 0x06, 0x3B, 0x52, 0xA0,
-    0x40, 0x89, 0x03, 0x9D, 0x12, 0xC6, 0x57, 0x25, 0x11, 0xD0, 0x5D, 0xE0, 0xC0, 0xC9, 0x06, 0x96,
-    0x63, 0x05, 0x74, 0x15, 0x39, 0x0C, 0x9C, 0x38, 0x70, 0x20, 0x12, 0x70, 0x29, 0x70, 0x78, 0xB8,
-    0x72, 0xE8, 0xE0, 0x46, 0x27, 0xAA, 0x54, 0xB6, 0x03, 0xA2, 0xEE, 0x46, 0x77, 0x90, 0x38, 0xC0,
-    0xBB, 0xFE, 0xBE, 0x7E, 0xC0, 0x60, 0x76, 0x97, 0x3F, 0x12, 0xA9, 0x25, 0xB9, 0xF6, 0x90, 0xF3,
-    0x5E, 0x2F, 0x16, 0xF3, 0xF0, 0x5E, 0xBF, 0x7E, 0xDD, 0xFD, 0x75, 0xF7, 0xAC, 0x31, 0x78, 0xFD,
-    0xB3, 0xD1, 0x57, 0x69, 0x8C, 0x57, 0xDA, 0x7D, 0x63, 0x8D, 0x89, 0xAD, 0xED, 0x4C, 0x27, 0x97,
-    0xAC, 0xB5, 0xEF, 0xAF, 0x8D, 0x6F, 0x0B, 0x93, 0xFF, 0x75, 0x65, 0x66, 0x6B, 0x63, 0x42, 0x5B,
-    0x9B, 0xA8, 0x31, 0x26, 0xE8, 0xE5, 0xB6, 0x5A, 0x3E, 0x26, 0x7D, 0x5A, 0xE9, 0xC7, 0xD3, 0x42,
-    0xFA, 0x3C, 0xC3, 0x7F, 0xFE, 0x50, 0x62, 0x58, 0xF9, 0x25, 0xFB, 0xE4, 0x11, 0x7B, 0xB9, 0x3F,
-    0x37, 0xFA, 0xF9, 0x94, 0xE3, 0x64, 0xE3, 0xF8, 0x89, 0x7B, 0x1E, 0x9E, 0xEF, 0xCB, 0x5C, 0x38,
-    0x9F, 0x56, 0x68, 0x2B, 0xF7, 0x34, 0xB8, 0xE7, 0xAB, 0x9B, 0x16, 0xF7, 0xCA, 0xFC, 0x7B, 0x8C,
-    0xE1, 0x59, 0xBB, 0xE4, 0xDA, 0xBC, 0x3D, 0xB3, 0xF5, 0x0A, 0x1B, 0xD7, 0x7A, 0x73, 0x13, 0x2D,
-    0x4D, 0x6E, 0x97, 0x51, 0xE5, 0xCB, 0xA2, 0xD3, 0x22, 0xEC, 0x5F, 0xB7, 0xD6, 0xC4, 0x4B, 0x93,
-    0xB6, 0x98, 0x02, 0x7E, 0x29, 0x0F, 0x6A, 0xF0, 0xF8, 0x60, 0x85, 0x87, 0xBB, 0xB6, 0x05, 0x7F,
-    0xC6, 0x56, 0xAF, 0xDC, 0xE6, 0x6F, 0xF5, 0xCE, 0x94, 0xC3, 0xCB, 0xCC, 0x65, 0x04, 0xF9, 0x2F,
-    0xC4, 0x4C, 0x46, 0xCE, 0x30, 0xA5, 0x0E, 0xAB, 0xD5, 0x89, 0x6D, 0xA6, 0x75, 0x43, 0xBB, 0xFE,
-    0x2A, 0xA6, 0x5F, 0x75, 0x60, 0x45, 0xFC, 0xFB, 0x35, 0xBB, 0x8F, 0x5B, 0x76, 0x7F, 0x6A, 0xD8,
-    0xD9, 0x8A, 0x5D, 0x47, 0x6E, 0xC5, 0xD5, 0xB7, 0xD2, 0xE5, 0xBA, 0x1F, 0xB9, 0xDB, 0x86, 0x82,
-    0xBB, 0x00, 0xEE, 0x8B, 0x6C, 0x44, 0xAD, 0x99, 0x61, 0xD1, 0xF6, 0x2F, 0xA5, 0xB0, 0xDE, 0x58,
-    0x65, 0xF1, 0x45, 0x65, 0xB8, 0x39, 0x9F, 0x6D, 0x33, 0x5A, 0xF7, 0xD0, 0xA8, 0x48, 0x48, 0x87,
-    0x9F, 0x67, 0x4D, 0xCF, 0xEE, 0xBF, 0xD7, 0xEC, 0xEC, 0x4A, 0xBB, 0x8A, 0xDD, 0xCA, 0xE8, 0x2D,
-    0xDF, 0xAC, 0x0B, 0xB5, 0x83, 0x80, 0x08, 0xC7, 0xE3, 0x86, 0x32, 0x93, 0x4B, 0x17, 0x75, 0x6F,
-    0xDE, 0x93, 0x6E, 0x66, 0xED, 0xA7, 0x14, 0x14, 0x7B, 0x19, 0x9D, 0xB7, 0x3B, 0x99, 0xE9, 0xDB,
-    0x66, 0xA7, 0x70, 0x64, 0x92, 0x25, 0xC3, 0x3A, 0xA2, 0x65, 0x3F, 0xDC, 0x10, 0xDC, 0x6B, 0xC7,
-    0x9B, 0x9D, 0x5C, 0x71, 0x4D, 0xD5, 0x48, 0x9E, 0x37, 0xF7, 0x79, 0xE5, 0xF6, 0x2B, 0x19, 0x30,
-    0x12, 0x66, 0x75, 0x39, 0x05, 0x00, 0x64, 0x2F, 0x24, 0x4E, 0x13, 0x49, 0x73, 0xBA, 0x5C, 0xF1,
-    0x21, 0x6B, 0xE1, 0x7A, 0x08, 0x11, 0x11, 0x5E, 0xE4, 0x10, 0x61, 0xCE, 0xA2, 0xC1, 0x5E, 0xE4,
-    0x05, 0xF7, 0xC5, 0xED, 0x0E, 0x98, 0x0A, 0x92, 0xA7, 0xD0, 0x72, 0xB3, 0x44, 0xD0, 0x70, 0x30,
-    0x72, 0x27, 0xE1, 0xC2, 0xCC, 0x81, 0x14, 0x8E, 0x80, 0x04, 0x9B, 0xDC, 0xC6, 0x82, 0xC4, 0x59,
-    0x75, 0x37, 0x58, 0x33, 0x90, 0x38, 0x59, 0x8E, 0x9C, 0xB5, 0x66, 0x18, 0x17, 0x2C, 0x75, 0x4F,
-    0xC3, 0xB3, 0x73, 0x77, 0x52, 0x0B, 0x25, 0xA5, 0xB7, 0xDC, 0x5E, 0xCC, 0x17, 0x03, 0x18, 0x5D,
-    0x05, 0x06, 0x10, 0xD2, 0x93, 0xB5, 0x61, 0x00, 0xA3, 0x2B, 0x4E, 0xA4, 0xB5, 0x39, 0xCF, 0xA8,
-    0x23, 0xFB, 0x7D, 0x47, 0x2A, 0xBB, 0xFC, 0xFD, 0x51, 0x2B, 0x79, 0xAD, 0xB7, 0x76, 0xEC, 0x33,
-    0xA5, 0x4C, 0x29, 0x77, 0xE7, 0xE7, 0x6E, 0xE5, 0x06, 0x13, 0xFE, 0xE1, 0x11, 0x64, 0x5F, 0xD0,
-    0x0D, 0x0F, 0xE6, 0xD1, 0x1A, 0xD9, 0x37, 0x4E, 0x72, 0x20, 0x93, 0x2A, 0x94, 0x0F, 0x3B, 0xF6,
-    0x8D, 0x64, 0xB4, 0xF4, 0xE6, 0x73, 0x3B, 0xB2, 0x44, 0xCE, 0xF6, 0x40, 0x06, 0xEB, 0x91, 0x67,
-    0xE1, 0x86, 0x93, 0x51, 0x3D, 0xDE, 0x20, 0x67, 0x64, 0x20, 0xCB, 0x91, 0x7D, 0x5E, 0x37, 0xB2,
-    0x2F, 0x68, 0x47, 0xF6, 0x85, 0xCD, 0xC8, 0xBE, 0xB8, 0x1A, 0x67, 0x86, 0x73, 0xE2, 0xE6, 0xDB,
-    0x8F, 0xEC, 0x73, 0x9C, 0x04, 0xFB, 0x82, 0xD5, 0xC8, 0xBE, 0xE8, 0xAB, 0xC5, 0x22, 0x53, 0xF6,
-    0x41, 0x76, 0x0A, 0x65, 0x1F, 0x49, 0xF2, 0xCE, 0xFB, 0xD0, 0x5C, 0x30, 0x3A, 0xC5, 0x5B, 0xF2,
-    0x4F, 0xA9, 0xF4, 0xDF, 0x5A, 0x47, 0x45, 0x77, 0x97, 0x8E, 0x0A, 0xF8, 0x01, 0x50, 0x8E, 0x4D,
-    0x58, 0xD4, 0xDE, 0x48, 0xE1, 0x75, 0x7A, 0x77, 0xA0, 0x4A, 0xFB, 0x5A, 0x13, 0xC8, 0x33, 0x2A,
-    0x69, 0x3E, 0x57, 0x2A, 0xEA, 0x5E, 0xB7, 0x8D, 0xB0, 0x2C, 0xAF, 0x92, 0x25, 0x4F, 0x19, 0xCE,
-    0x77, 0x61, 0x92, 0x91, 0x77, 0x34, 0x14, 0x2D, 0x38, 0x12, 0x29, 0xE7, 0x7A, 0x27, 0x8D, 0x35,
-    0xA8, 0x99, 0xF2, 0xAD, 0x53, 0xAA, 0x34, 0x8E, 0x92, 0xFD, 0x76, 0xBF, 0x05, 0xD3, 0xF4, 0x13,
-    0x8E, 0xAF, 0xD2, 0x39, 0x96, 0xC9, 0x78, 0xE0, 0x98, 0x7C, 0x3C, 0xE6, 0xA8, 0x86, 0x33, 0x20,
-    0xBF, 0xA2, 0x5E, 0x8E, 0x7A, 0xD0, 0x2F, 0x16, 0x85, 0x4C, 0xF2, 0x8F, 0xCD, 0x0C, 0x33, 0x15,
-    0xCE, 0x5D, 0x76, 0xD4, 0x78, 0xE6, 0x69, 0x65, 0x6E, 0xB1, 0xED, 0x9E, 0x89, 0x16, 0x3B, 0xBA,
-    0xD5, 0x72, 0x9A, 0x93, 0x16, 0x9C, 0x51, 0xAB, 0x27, 0x66, 0xA0, 0x61, 0x5B, 0x73, 0xC1, 0x53,
-    0x55, 0xF3, 0x33, 0x8E, 0x06, 0x2D, 0x22, 0xF2, 0xB7, 0xA1, 0xDD, 0x75, 0x73, 0xA8, 0x5D, 0x7F,
-    0xEB, 0x2D, 0xD6, 0xB2, 0xD5, 0xF2, 0xE1, 0xF7, 0x69, 0x75, 0x8D, 0x01, 0x5A, 0x58, 0x06, 0xB4,
-    0x10, 0xD7, 0xC0, 0x66, 0x6F, 0x93, 0x0D, 0x3B, 0x59, 0x27, 0xE2, 0xD3, 0xC9, 0x41, 0x92, 0xBE,
-    0xD2, 0x9F, 0x95, 0x3D, 0xFA, 0xC6, 0xB5, 0x27, 0xF7, 0x36, 0x87, 0xDE, 0x90, 0x3F, 0x28, 0x3E,
-    0x31, 0xE5, 0x39, 0x5C, 0x9F, 0x15, 0xD5, 0x4A, 0x20, 0x16, 0x3E, 0xCB, 0x6B, 0x3D, 0x69, 0x19,
-    0x8E, 0x82, 0x12, 0xED, 0x40, 0x74, 0x8E, 0xB8, 0x6A, 0x07, 0x42, 0x3E, 0xA6, 0x84, 0xA8, 0x53,
-    0x25, 0x44, 0xA6, 0x95, 0x10, 0xAD, 0xA9, 0x84, 0xC8, 0xB3, 0x12, 0xA2, 0x5D, 0x75, 0x1C, 0x51,
-    0xD9, 0x8E, 0x48, 0x2B, 0x47, 0x44, 0x4B, 0x47, 0xCC, 0x56, 0x8E, 0x08, 0xD6, 0x8E, 0x30, 0x7D,
-    0xE0, 0x88, 0xF2, 0xB2, 0x23, 0xD2, 0x8F, 0x1D, 0x11, 0x7F, 0xEA, 0x88, 0xF0, 0xFF, 0x1C, 0x11,
-    0x58, 0x47, 0x78, 0x03, 0x61, 0xCA, 0x81, 0x48, 0x07, 0x22, 0x6E, 0x06, 0x93, 0x6E, 0x26, 0x84,
-    0xD9, 0xF8, 0x90, 0xAA, 0xC0, 0x9D, 0x48, 0xCE, 0xEC, 0x7A, 0x20, 0x9A, 0x81, 0x28, 0x0E, 0x59,
-    0xC7, 0xEF, 0x0D, 0x3C, 0x94, 0xE5, 0x29, 0x0F, 0xCB, 0x81, 0x87, 0x72, 0x45, 0x79, 0xF8, 0x5D,
-    0xE3, 0x78, 0x68, 0x8C, 0xE3, 0xA1, 0x10, 0xCA, 0x43, 0x21, 0x94, 0x87, 0xB9, 0x71, 0x3C, 0x14,
-    0x42, 0x79, 0x28, 0x84, 0xF2, 0x50, 0x08, 0xE5, 0x61, 0x6E, 0x1C, 0x0F, 0x41, 0x90, 0x87, 0x20,
-    0xC8, 0x43, 0x10, 0xE4, 0x21, 0x08, 0xF2, 0x10, 0x04, 0x79, 0x48, 0x02, 0x3C, 0x24, 0x01, 0x1E,
-    0x92, 0x00, 0x0F, 0x49, 0x80, 0x87, 0x24, 0xC0, 0xC3, 0xDC, 0x38, 0x1E, 0x92, 0x00, 0x0F, 0x95,
-    0x48, 0x07, 0x22, 0x6E, 0xDC, 0x01, 0x1C, 0x4F, 0xE2, 0x23, 0x12, 0x8E, 0xAB, 0xFE, 0xC0, 0x55,
-    0xDF, 0x3A, 0x8F, 0xC4, 0x13, 0xBF, 0x5D, 0x5F, 0x1F, 0xEA, 0x2F, 0xF4, 0x86, 0x40, 0x3B, 0xDF,
-    0xDD, 0xB5, 0x7B, 0x90, 0xF1, 0x73, 0x1E, 0xBB, 0x58, 0xCE, 0x99, 0xDF, 0xAE, 0x4B, 0x31, 0xAC,
-    0x7E, 0xDB, 0x8B, 0x4E, 0x97, 0x4E, 0x14, 0x4B, 0x5E, 0x48, 0x27, 0xDA, 0xBC, 0x92, 0x0E, 0x72,
-    0xCF, 0x4E, 0xDC, 0xE4, 0xB6, 0xDF, 0xEA, 0xBA, 0x27, 0xD9, 0x4D, 0xA7, 0x7B, 0x64, 0x17, 0x68,
-    0x37, 0xA3, 0xAF, 0x14, 0x95, 0x14, 0xAA, 0x88, 0x3E, 0xBF, 0x09, 0x65, 0x42, 0x17, 0x32, 0x31,
-    0x7E, 0x26, 0xAC, 0xC3, 0x25, 0x6E, 0x25, 0x1E, 0xE9, 0xC9, 0xB4, 0x94, 0x9C, 0x88, 0x79, 0xBF,
-    0x77, 0xD0, 0x47, 0x35, 0xE1, 0x52, 0x9D, 0x2C, 0xDE, 0xB3, 0xDA, 0xDC, 0xFF, 0x0A, 0xDB, 0x5B,
-    0x57, 0xC9, 0xA6, 0x94, 0xDA, 0x09, 0x32, 0x1F, 0xAC, 0xA0, 0x05, 0x82, 0x06, 0xFA, 0x20, 0x5C,
-    0xE2, 0xC3, 0x51, 0x0D, 0x39, 0x8C, 0x2B, 0x58, 0xE9, 0xA4, 0xC0, 0x5C, 0x53, 0x6A, 0xB2, 0x72,
-    0x3E, 0xEF, 0xE8, 0x23, 0x5B, 0x38, 0xFE, 0xD2, 0xFA, 0x62, 0x97, 0xCA, 0x02, 0xB7, 0xC5, 0x95,
-    0xBA, 0x10, 0xF0, 0xD9, 0xC2, 0x06, 0x03, 0xCE, 0x1A, 0x78, 0x56, 0x32, 0xED, 0x0C, 0x1B, 0xA8,
-    0x46, 0x81, 0x93, 0xEF, 0xFD, 0x0F, 0xCD, 0x25, 0xE8, 0x47, 0x19, 0x31, 0x7D, 0x0D, 0x0F, 0xBA,
-    0x8B, 0x63, 0x62, 0xB3, 0xE1, 0xA0, 0xED, 0x6D, 0xED, 0x68, 0x2E, 0xFB, 0x19, 0x40, 0xD1, 0xFA,
-    0x5F, 0xFE, 0x44, 0xB6, 0x4C, 0x1D, 0x78, 0xF5, 0x18, 0xF1, 0x18, 0xAA, 0x31, 0x50, 0x17, 0xC4,
-    0x1C, 0x62, 0x56, 0x55, 0xD8, 0x7F, 0x10, 0xC3, 0x84, 0xC7, 0x15, 0xEC, 0x69, 0x25, 0xCF, 0x8F,
-    0xE1, 0x64, 0x26, 0x15, 0xB1, 0x57, 0x2A, 0x37, 0x55, 0xC9, 0x17, 0x6F, 0xDD, 0xAD, 0xC4, 0xC5,
-    0xF8, 0x85, 0xC0, 0xA4, 0x2E, 0xAC, 0xCC, 0x69, 0x79, 0xF6, 0x75, 0x73, 0x06, 0x0A, 0x09, 0x38,
-    0xC5, 0xCC, 0xC4, 0xBB, 0xF6, 0x61, 0x8D, 0x70, 0xBC, 0x27, 0x6E, 0x70, 0x2C, 0xA2, 0x9A, 0xC8,
-    0x7B, 0xC7, 0xDE, 0x71, 0xAE, 0xCE, 0x93, 0x7D, 0x7B, 0xE5, 0xFE, 0xF8, 0x0C, 0x38, 0xF0, 0xA9,
-    0x78, 0xEE, 0x70, 0xD9, 0xE9, 0xAB, 0xC3, 0x72, 0xC0, 0x3B, 0x3F, 0x7F, 0x00, 0x8F, 0x3C, 0xC9,
-    0xB7, 0x60, 0x86, 0xEB, 0x90, 0xCB, 0x15, 0x1D, 0x34, 0xD3, 0x45, 0x35, 0x9F, 0x52, 0x52, 0xC6,
-    0x62, 0x3D, 0xB0, 0xA1, 0x1E, 0x43, 0x6F, 0xF7, 0x30, 0x30, 0x20, 0xE2, 0x76, 0x80, 0x5B, 0xF1,
-    0x76, 0xA1, 0x70, 0xBB, 0x19, 0xD0, 0x6D, 0xA4, 0xEE, 0xA7, 0xC3, 0xDA, 0x0E, 0x0A, 0x3B, 0xA4,
-    0xED, 0x80, 0xB6, 0xC3, 0xCD, 0x0E, 0x46, 0x3F, 0xB4, 0x4B, 0x2B, 0x07, 0xB0, 0x1D, 0xBE, 0x76,
-    0x63, 0x3A, 0x74, 0x4D, 0x70, 0xDD, 0x0D, 0x4F, 0x07, 0xB4, 0x86, 0x2A, 0x2E, 0x7B, 0x22, 0x6B,
-    0x07, 0xAC, 0x07, 0x5C, 0x4D, 0x58, 0x2D, 0xC2, 0xF9, 0x03, 0x11, 0x76, 0x88, 0x7B, 0xCE, 0x53,
-    0x70, 0x17, 0xC7, 0x02, 0xC2, 0x19, 0x6C, 0x0B, 0xA7, 0xA7, 0xC2, 0xB9, 0x34, 0x40, 0xDA, 0x06,
-    0x40, 0x3B, 0x03, 0xCE, 0xAE, 0x08, 0x92, 0xA1, 0x44, 0x1B, 0x42, 0xE7, 0x7E, 0x68, 0xDA, 0x6E,
-    0x6C, 0xF8, 0x23, 0xE1, 0x35, 0x74, 0x6C, 0x43, 0xA4, 0x97, 0xE0, 0x63, 0x84, 0xD6, 0x40, 0xD6,
-    0x0E, 0x58, 0x2B, 0xAE, 0xDE, 0x23, 0x9C, 0x3B, 0x43, 0xDC, 0x8A, 0x45, 0xC2, 0x61, 0x00, 0x7E,
-    0x5B, 0x71, 0xEE, 0x9C, 0x7A, 0x59, 0x1D, 0x05, 0xD8, 0x14, 0x7D, 0x97, 0xC7, 0xD8, 0xE6, 0x23,
-    0xA4, 0x93, 0xFD, 0x00, 0x9A, 0xCA, 0x14, 0x67, 0x2B, 0xCC, 0x06, 0xCA, 0x5E, 0x51, 0x81, 0xD4,
-    0x60, 0x7E, 0x3F, 0x40, 0xEC, 0x2D, 0x85, 0xB0, 0x7A, 0x90, 0x42, 0x30, 0x0E, 0x1E, 0x3F, 0x66,
-    0x13, 0x36, 0x84, 0xD5, 0x04, 0xD5, 0x84, 0xD4, 0x04, 0xD4, 0x0A, 0xA7, 0x09, 0xA6, 0x27, 0xC2,
-    0x9D, 0x5A, 0x4C, 0x44, 0xDB, 0x4B, 0x8B, 0xC5, 0x01, 0x16, 0x47, 0xD9, 0x8F, 0xC7, 0x25, 0xEB,
-    0xF2, 0xCF, 0x64, 0x3F, 0x78, 0x3E, 0x77, 0xC1, 0xCC, 0xE7, 0x7B, 0xB8, 0xBC, 0x76, 0x0D, 0x7F,
-    0xDC, 0xBC, 0xDE, 0xF3, 0x44, 0x07, 0x95, 0x30, 0xC5, 0xB7, 0x61, 0x11, 0xCE, 0x6D, 0xD9, 0xDF,
-    0xE3, 0xDC, 0x94, 0xB9, 0x86, 0x2C, 0x36, 0x1E, 0x81, 0x86, 0xBF, 0x68, 0x0C, 0xCC, 0x2B, 0x27,
-    0x73, 0x6B, 0x8C, 0x0F, 0xB5, 0xCC, 0xF8, 0x03, 0x2C, 0xAC, 0xFA, 0xAA, 0x00, 0xC3, 0x5E, 0xF3,
-    0x8C, 0xED, 0xCF, 0x96, 0xA2, 0xFA, 0x84, 0x8A, 0x8A, 0xC0, 0xC7, 0x10, 0xDC, 0x0D, 0x51, 0x8B,
-    0x13, 0xB7, 0x3F, 0xD8, 0x22, 0xC6, 0xA7, 0x6E, 0x63, 0x07, 0x92, 0x7F, 0x47, 0x80, 0x00, 0x26,
-    0x26, 0xA0, 0x9C, 0x5E, 0x7F, 0xC6, 0x36, 0x49, 0xE7, 0x1C, 0xD3, 0x74, 0x84, 0xAB, 0x89, 0x8B,
-    0xAD, 0xBE, 0x79, 0x7C, 0x32, 0x37, 0x69, 0x31, 0x0A, 0x20, 0xDD, 0x0F, 0x0D, 0x05, 0x71, 0xDD,
-    0xFF, 0xF8, 0xAC, 0xED, 0xCF, 0x1E, 0x83, 0xBB, 0xFB, 0x08, 0x83, 0x89, 0xCF, 0xF4, 0xD9, 0x9B,
-    0xBD, 0x39, 0x25, 0xF3, 0xCA, 0x8C, 0xCB, 0x4E, 0xD0, 0x2D, 0xA3, 0x22, 0xA0, 0xEE, 0x9B, 0x35,
-    0x62, 0x98, 0x7E, 0xD3, 0x88, 0x8D, 0xB2, 0xAE, 0xE1, 0xD3, 0x0A, 0x71, 0xE7, 0xE1, 0x56, 0xD4,
-    0xA2, 0x1A, 0x93, 0x0A, 0x31, 0xD3, 0x2C, 0xE8, 0xDF, 0xE8, 0xE1, 0x5B, 0xB4, 0xF0, 0x2D, 0xEA,
-    0x2D, 0xD3, 0x1A, 0x92, 0x5F, 0xDA, 0xEE, 0x2C, 0x16, 0xFB, 0xDB, 0x9B, 0xEC, 0x2F, 0xC3, 0x02,
-    0x0F, 0x52, 0xCF, 0x1E, 0xAD, 0x5F, 0x87, 0xD9, 0x73, 0x06, 0x3C, 0x1E, 0x6A, 0xE1, 0x56, 0xEE,
-    0xFC, 0x1E, 0xDC, 0xFC, 0xE3, 0xC4, 0x21, 0x8E, 0xF9, 0xD3, 0xED, 0xD8, 0x7A, 0xCD, 0xEA, 0x0D,
-    0x93, 0xB5, 0x9D, 0xD5, 0xE6, 0xE4, 0x6C, 0xC4, 0xEF, 0x18, 0xE9, 0x1B, 0x1A, 0x3D, 0x9E, 0x67,
-    0x9F, 0x0A, 0x20, 0x44, 0xBC, 0x78, 0x3E, 0xCF, 0x14, 0x93, 0x2B, 0x28, 0x1F, 0xFA, 0xE1, 0xFA,
-    0xC1, 0x57, 0x6C, 0x15, 0x51, 0xA4, 0x2E, 0xF8, 0x9F, 0xBB, 0xBE, 0xA7, 0xC2, 0x11, 0x0E, 0x72,
-    0x6E, 0xC2, 0x12, 0xED, 0x67, 0x8D, 0xF6, 0xE2, 0xF8, 0x57, 0xEA, 0xC2, 0x68, 0x9F, 0x14, 0xDA,
-    0xA7, 0xBA, 0x16, 0x41, 0x33, 0xD1, 0x67, 0xE0, 0x50, 0x87, 0x09, 0xAC, 0xA1, 0xAB, 0xD9, 0x0B,
-    0xD7, 0x79, 0x3D, 0xFC, 0x62, 0xFE, 0x56, 0xA5, 0xB3, 0xE3, 0xF4, 0x12, 0xD7, 0xA7, 0x7F, 0x59,
-    0x10, 0x17, 0xE4, 0x8E, 0x27, 0xBD, 0xF6, 0xD8, 0xC7, 0xA8, 0xD2, 0xE0, 0x43, 0x54, 0xB9, 0xD8,
-    0x7F, 0xA5, 0xFA, 0x04, 0x43, 0x80, 0x89, 0xE8, 0xC1, 0xD6, 0x88, 0xF3, 0x7F, 0x44, 0x36, 0x00,
-    0x3F, 0xCD, 0x89, 0xFB, 0xEA, 0x58, 0x60, 0x89, 0x28, 0xB0, 0x36, 0xC7, 0x34, 0xBF, 0x7C, 0xA1,
-    0xEF, 0x7F, 0xD2, 0x23, 0x50, 0x21, 0x7A, 0x59, 0x41, 0xDE, 0x52, 0xF7, 0xCB, 0x25, 0x0D, 0x98,
-    0x58, 0xAC, 0xC7, 0xFE, 0x22, 0xB8, 0x66, 0x6B, 0xDF, 0x6A, 0x1F, 0xF5, 0x7B, 0xB2, 0x92, 0xC5,
-    0xBE, 0xEC, 0x20, 0x77, 0x1A, 0x39, 0xBC, 0x6A, 0x92, 0x4A, 0x95, 0xE5, 0xE5, 0xB5, 0xFE, 0xCC,
-    0xB0, 0x5C, 0x5A, 0xF8, 0xF7, 0xD6, 0xF2, 0xB4, 0xE4, 0x8B, 0x2B, 0x9F, 0xD8, 0x5F, 0x97, 0x45,
-    0xC4, 0xA4, 0x82, 0x2D, 0x7C, 0xC0, 0x34, 0x6C, 0x0F, 0x36, 0x77, 0x9A, 0xD9, 0x4B, 0xEC, 0x97,
-    0x0C, 0xE5, 0x59, 0x7C, 0x3C, 0xD1, 0x14, 0xA0, 0xBC, 0x45, 0x0C, 0x02, 0x87, 0x78, 0x5B, 0x97,
-    0x3C, 0x33, 0x66, 0x90, 0x34, 0x97, 0x1E, 0xDE, 0x64, 0x04, 0xB7, 0x22, 0x86, 0xD2, 0x5D, 0x58,
-    0x5C, 0x63, 0x92, 0xD7, 0xB6, 0x93, 0xEE, 0xFC, 0x1B, 0xEC, 0xC0, 0xFA, 0x5C, 0x3B, 0x19, 0xE5,
-    0xCC, 0xCD, 0xBE, 0x00, 0x23, 0x84, 0xA9, 0x62, 0x11, 0xD0, 0xB9, 0x44, 0xC3, 0x4C, 0xB3, 0xB1,
-    0x00, 0xD0, 0xD8, 0xAB, 0xB2, 0x5F, 0x20, 0x47, 0x09, 0x19, 0x6B, 0x09, 0xB5, 0xFB, 0x6C, 0x80,
-    0xA1, 0xE6, 0xF4, 0xAE, 0x4B, 0x03, 0x06, 0xB0, 0x24, 0x51, 0xF7, 0xC6, 0xBD, 0x86, 0x29, 0x04,
-    0x66, 0x14, 0x98, 0x60, 0x60, 0xBE, 0x81, 0x89, 0x08, 0x36, 0xDD, 0x48, 0xB1, 0xE1, 0x6F, 0x79,
-    0x1F, 0x3F, 0xC1, 0xCF, 0x6A, 0xE6, 0x01, 0xE9, 0x11, 0x91, 0xE3, 0xD7, 0x60, 0x99, 0x66, 0x8D,
-    0x33, 0x9B, 0x94, 0x72, 0x8A, 0x86, 0xCA, 0x77, 0x5C, 0xBF, 0x28, 0xC0, 0xBA, 0x8A, 0x6D, 0x69,
-    0x31, 0xBF, 0xB5, 0x0B, 0x04, 0x68, 0xE2, 0x8B, 0x39, 0x2F, 0x4D, 0x77, 0x69, 0xA6, 0x4B, 0x93,
-    0x5C, 0x9A, 0xDF, 0x3A, 0x88, 0xEE, 0xF0, 0xBA, 0x82, 0xFD, 0xD0, 0xED, 0xD0, 0xDD, 0xB0, 0x77,
-    0xCC, 0xAC, 0x52, 0x4F, 0x4A, 0xB7, 0x42, 0x35, 0x9B, 0x6E, 0x84, 0xEE, 0x83, 0x66, 0x64, 0xF3,
-    0xC9, 0x26, 0x8C, 0xAD, 0xF0, 0xFE, 0x40, 0x2B, 0xEC, 0xC4, 0xFD, 0x1A, 0x52, 0x93, 0x96, 0x87,
-    0x01, 0x47, 0x54, 0x0E, 0x26, 0xF2, 0x6E, 0xAD, 0x72, 0xDE, 0x31, 0x5E, 0xF9, 0xAE, 0x6C, 0x97,
-    0x75, 0x61, 0x61, 0x60, 0x3A, 0x17, 0xE7, 0xB7, 0xD0, 0x8D, 0x5C, 0x1A, 0x57, 0xC6, 0x85, 0xE9,
-    0xBA, 0x46, 0xE3, 0x71, 0xC4, 0xDE, 0xC4, 0x6E, 0x6F, 0x92, 0xED, 0xBD, 0x09, 0x27, 0x7B, 0xF3,
-    0xE0, 0x0D, 0xE2, 0x00, 0x32, 0x94, 0xBD, 0xCF, 0x06, 0xA9, 0x05, 0xE0, 0x99, 0x4A, 0x2A, 0xD9,
-    0x9B, 0xB2, 0x18, 0xF6, 0x86, 0x6B, 0x28, 0x8C, 0x47, 0xC8, 0x6D, 0x58, 0x17, 0x61, 0xD2, 0xCB,
-    0xB0, 0x11, 0x11, 0x50, 0xB7, 0xCB, 0xA2, 0xB9, 0x0C, 0xDA, 0xC1, 0xAD, 0xC9, 0xA9, 0x96, 0x73,
-    0x22, 0x91, 0xDC, 0xB8, 0x72, 0x02, 0x2D, 0x71, 0x60, 0xDA, 0x32, 0x60, 0xB2, 0x55, 0x53, 0x82,
-    0x9A, 0x57, 0x85, 0xCF, 0x92, 0x53, 0x95, 0xE7, 0x8C, 0x72, 0xE6, 0x74, 0x3A, 0xF3, 0x74, 0xE9,
-    0x14, 0xB9, 0xB4, 0xF7, 0x98, 0x16, 0xFC, 0x0F, 0xCD, 0xB8, 0x96, 0x4C, 0xC1, 0xA6, 0x35, 0x5A,
-    0x4D, 0xD2, 0x6A, 0xD6, 0xD6, 0xD7, 0xE4, 0xA3, 0xE6, 0x75, 0xF5, 0x89, 0x31, 0x9F, 0x1E, 0xD2,
-    0xEB, 0x76, 0x19, 0x4D, 0xEB, 0xD2, 0xDE, 0x29, 0x33, 0xDE, 0x9A, 0xEC, 0x76, 0x79, 0x6E, 0x8D,
-    0x93, 0xE4, 0x87, 0xE2, 0x24, 0x17, 0x26, 0xA7, 0xF8, 0x6B, 0xB5, 0xCC, 0x72, 0x7A, 0x48, 0x9A,
-    0x64, 0x38, 0x9D, 0x69, 0x06, 0xF5, 0x20, 0xB8, 0x87, 0x8F, 0xB7, 0xE4, 0x2A, 0x16, 0x96, 0xFE,
-    0x94, 0x3A, 0xE9, 0x0A, 0x35, 0x56, 0x49, 0xEC, 0xC6, 0x30, 0x77, 0xFA, 0x5F, 0xE4, 0x7C, 0x61,
-    0xC7, 0xA0, 0x55, 0x8A, 0xF8, 0x91, 0xB4, 0x21, 0x8B, 0x06, 0xC0, 0x4A, 0x68, 0xB4, 0xCD, 0xB3,
-    0x34, 0xA4, 0x75, 0x12, 0xE2, 0x6C, 0x2E, 0xF8, 0xAD, 0xEA, 0x34, 0x54, 0x75, 0x1A, 0x15, 0x5B,
-    0x9D, 0xBB, 0xA8, 0x62, 0x18, 0xD8, 0xA9, 0x95, 0x39, 0xB6, 0xB8, 0x1B, 0x93, 0xCD, 0x10, 0xD1,
-    0x00, 0x5B, 0x18, 0xD4, 0x83, 0xAB, 0x35, 0xD3, 0x14, 0x1E, 0x4C, 0xA9, 0xAD, 0xC6, 0x59, 0xCD,
-    0x77, 0x79, 0x95, 0x26, 0xC8, 0x75, 0xEE, 0xE2, 0x89, 0x8A, 0x91, 0xBA, 0xE0, 0xAF, 0x86, 0x1D,
-    0x82, 0x7A, 0xBA, 0x85, 0x43, 0x57, 0xBB, 0xD4, 0x98, 0x06, 0x2E, 0xEC, 0xC4, 0xD2, 0xDE, 0xD7,
-    0xED, 0x7B, 0x26, 0x37, 0xF5, 0x60, 0x28, 0x38, 0xD1, 0x50, 0xF0, 0xA8, 0xE1, 0xB7, 0xB4, 0x23,
-    0x2D, 0x55, 0x3A, 0x36, 0x83, 0xAE, 0xB1, 0x43, 0x94, 0x8A, 0x26, 0x2B, 0x3D, 0xE2, 0x52, 0xCD,
-    0x95, 0x43, 0xE1, 0x81, 0xD1, 0xE7, 0xB5, 0xE4, 0x8B, 0xE5, 0x07, 0x44, 0xE6, 0x4C, 0x11, 0xF1,
-    0x76, 0x42, 0x74, 0x52, 0xBC, 0x16, 0x36, 0xD7, 0xE0, 0x48, 0x95, 0x9F, 0xBD, 0x69, 0xAB, 0x12,
-    0x9B, 0x74, 0x91, 0x8F, 0x3D, 0xBF, 0xCB, 0x28, 0xFE, 0xDB, 0x2E, 0x86, 0xCF, 0x08, 0x7E, 0x0A,
-    0xAD, 0xCA, 0xBC, 0x3A, 0xB3, 0xED, 0xDB, 0x91, 0x7B, 0x4C, 0x37, 0x63, 0x23, 0x20, 0xD2, 0x0E,
-    0x8E, 0x37, 0xE3, 0xFF, 0x1A, 0x6A, 0x2A, 0x5C, 0xAA, 0x8E, 0xCF, 0x57, 0x23, 0xCE, 0x29, 0xEE,
-    0x53, 0x7C, 0x0B, 0x34, 0xB8, 0xF9, 0x62, 0x37, 0x86, 0xE5, 0xD2, 0x8D, 0x2F, 0x5E, 0x1F, 0x6E,
-    0x06, 0x8F, 0x0F, 0x80, 0xF6, 0x5F, 0xCC, 0xAC, 0x37, 0x79, 0x2F, 0x1A, 0x31, 0x07, 0xD2, 0xD9,
-    0x81, 0xE5, 0xBF, 0x20, 0xC6, 0x29, 0xAA, 0xC3, 0x9A, 0xE6, 0x19, 0xF9, 0xAE, 0xB4, 0xD5, 0x5C,
-    0xD7, 0xE9, 0x89, 0x24, 0x61, 0xA4, 0x6F, 0xFB, 0x2D, 0xCB, 0x4C, 0x65, 0x7D, 0xA9, 0xAC, 0x29,
-    0x69, 0xFF, 0x5E, 0xF5, 0xF4, 0xC8, 0x55, 0x4F, 0xAE, 0xBE, 0x49, 0x2B, 0xC5, 0x6C, 0xB7, 0x21,
-    0x07, 0x2C, 0x3B, 0x32, 0x6A, 0x53, 0xDF, 0x64, 0xFE, 0x66, 0xEB, 0x9B, 0x46, 0x5C, 0xDF, 0x3C,
-    0x3E, 0x75, 0x82, 0xEB, 0x9B, 0x10, 0x18, 0xB9, 0x36, 0xF1, 0xFD, 0xEB, 0x8D, 0x33, 0xD6, 0xB9,
-    0xE8, 0x2B, 0x5E, 0xD9, 0xF3, 0x09, 0x26, 0xDC, 0xE2, 0xA2, 0x51, 0xBB, 0x72, 0x65, 0xDD, 0xB8,
-    0xAE, 0xEC, 0x99, 0x06, 0x13, 0xB9, 0x9B, 0x66, 0xEE, 0xEC, 0xC6, 0xD7, 0xEB, 0xA9, 0x0C, 0x8F,
-    0xEE, 0xE7, 0xF3, 0x37, 0xD8, 0x0B, 0xBB, 0xB6, 0xFA, 0xC5, 0xE2, 0xE6, 0x03, 0x3F, 0xF7, 0x80,
-    0xBE, 0xD5, 0x5E, 0x64, 0x2F, 0x2D, 0x14, 0xCE, 0x94, 0xD4, 0x26, 0xF6, 0xAF, 0xAA, 0x4A, 0x52,
-    0xEB, 0x74, 0xEF, 0x50, 0x13, 0x7B, 0x6E, 0x8C, 0x0E, 0x96, 0x5F, 0x9A, 0xAB, 0xA2, 0x7D, 0xAA,
-    0xAB, 0x62, 0x2D, 0x9B, 0xFC, 0x96, 0x89, 0x5B, 0x39, 0x45, 0xA2, 0xEB, 0x6B, 0x94, 0xA6, 0xC9,
-    0xA6, 0xF5, 0x90, 0x03, 0x36, 0xB7, 0x31, 0x02, 0x9B, 0x7E, 0x6C, 0x50, 0xBD, 0xE6, 0xAD, 0x39,
-    0x85, 0xDC, 0xD9, 0x05, 0x5A, 0x84, 0xA4, 0x46, 0x00, 0x43, 0xE6, 0xE2, 0x61, 0x02, 0x21, 0x9E,
-    0x8E, 0xD2, 0x1A, 0xBA, 0x84, 0x71, 0xA7, 0x5E, 0x11, 0x0B, 0xB4, 0x4C, 0x7E, 0x67, 0x90, 0xCA,
-    0x47, 0x6D, 0xDC, 0x91, 0x71, 0x85, 0x33, 0xFD, 0x34, 0xC4, 0xAF, 0x01, 0xA8, 0xE5, 0x51, 0x95,
-    0x34, 0x5A, 0xBE, 0xA4, 0xB5, 0x4B, 0x5A, 0xB8, 0xA4, 0x55, 0x4B, 0x5A, 0xB2, 0xA4, 0xF5, 0x4A,
-    0x5A, 0xAC, 0xA4, 0x95, 0x4A, 0x5A, 0xA6, 0xA4, 0x35, 0x4A, 0x5A, 0xA0, 0xA4, 0xD5, 0x49, 0x5A,
-    0x9A, 0xA4, 0x75, 0x49, 0x5A, 0x94, 0xA4, 0x15, 0x49, 0x5A, 0x8E, 0xA4, 0xB5, 0x48, 0x5A, 0x88,
-    0xA4, 0x55, 0x48, 0x5A, 0x82, 0xA4, 0xF5, 0x47, 0x5A, 0x7C, 0xA4, 0x95, 0x47, 0x5A, 0x76, 0xA4,
-    0x35, 0x47, 0xAE, 0xE0, 0x88, 0xA1, 0xFC, 0x49, 0x3C, 0x7C, 0x39, 0xB8, 0x2C, 0x1A, 0x30, 0x3C,
-    0x37, 0x0D, 0x18, 0xB2, 0x22, 0x88, 0xF5, 0x40, 0xAC, 0x06, 0x62, 0x2D, 0x10, 0x2B, 0x81, 0x58,
-    0x07, 0xC4, 0x2A, 0xA0, 0x7E, 0x6C, 0xBA, 0x6F, 0xD6, 0x0C, 0x13, 0xD1, 0x39, 0x69, 0xE8, 0x52,
-    0xE7, 0x13, 0x56, 0x93, 0xF0, 0x20, 0xAF, 0x94, 0xFC, 0xED, 0x2A, 0x46, 0xDB, 0x44, 0x9B, 0xB6,
-    0x4D, 0x26, 0xA5, 0x3D, 0x93, 0xA0, 0xED, 0x55, 0xBA, 0xAC, 0x1F, 0x6D, 0x82, 0xB6, 0x7E, 0x9B,
-    0x14, 0x43, 0xB8, 0x76, 0xB6, 0x0C, 0xEB, 0x03, 0xE1, 0xDA, 0xCC, 0x63, 0xB8, 0x16, 0x9C, 0x28,
-    0xB9, 0xE9, 0x9B, 0x70, 0x6D, 0x06, 0x43, 0x20, 0x36, 0x81, 0x37, 0x33, 0xCE, 0xBB, 0x8C, 0xEA,
-    0x07, 0x04, 0x6A, 0x4B, 0x67, 0x9D, 0x39, 0x1D, 0x1A, 0xE4, 0x76, 0xAB, 0xC4, 0x9F, 0xE5, 0x6F,
-    0xD1, 0xCF, 0x91, 0x67, 0x01, 0x22, 0x78, 0xD1, 0x60, 0x60, 0x7F, 0xE9, 0x62, 0x09, 0x01, 0x5D,
-    0xFF, 0xA7, 0x16, 0xBC, 0x35, 0xE6, 0x92, 0xCB, 0x63, 0x95, 0xD9, 0x56, 0xC1, 0x99, 0xAB, 0xBA,
-    0x72, 0x51, 0xF2, 0x4D, 0xBA, 0xEB, 0xD4, 0xD1, 0xD5, 0xEE, 0x27, 0x34, 0xA8, 0x7B, 0x88, 0x3D,
-    0xDE, 0xD7, 0x62, 0xCF, 0xF3, 0x17, 0xEC, 0x3D, 0xA3, 0xC5, 0x84, 0x9A, 0xF5, 0x1C, 0xC2, 0xB7,
-    0x6A, 0xD8, 0x1D, 0xAA, 0x75, 0x11, 0x89, 0x43, 0x15, 0x75, 0x2F, 0x29, 0x6A, 0x5F, 0x8F, 0xC1,
-    0xD7, 0x92, 0xFE, 0x04, 0x54, 0x74, 0xB9, 0x24, 0xA6, 0x4A, 0xD4, 0x37, 0xCE, 0x15, 0xB5, 0x77,
-    0x44, 0xED, 0xC1, 0x8A, 0xA8, 0x5D, 0x2C, 0x2D, 0x50, 0x3B, 0xE4, 0xB7, 0x54, 0xEC, 0x2D, 0xDD,
-    0x6D, 0x22, 0x73, 0x79, 0x2C, 0x3A, 0xDA, 0xA6, 0x12, 0x5B, 0x85, 0x8E, 0xC9, 0xBA, 0x12, 0x07,
-    0x18, 0xA8, 0xBD, 0x23, 0x6A, 0x7F, 0x95, 0x01, 0xA6, 0xF4, 0x0F, 0xF4, 0xAB, 0xE2, 0xFF, 0xAC,
-    0x89, 0xDA, 0x11, 0x37, 0x10, 0xEF, 0xDC, 0x4E, 0x51, 0x7B, 0x60, 0x89, 0xDA, 0x43, 0x15, 0xD9,
-    0xE8, 0xF7, 0x84, 0x84, 0x41, 0xB6, 0xFD, 0x85, 0x21, 0xD6, 0x12, 0x10, 0x5C, 0x52, 0x82, 0xC9,
-    0x89, 0xDB, 0x58, 0xF7, 0xB6, 0xAB, 0xE1, 0xED, 0xF9, 0xF0, 0xC4, 0x3E, 0x5F, 0xFA, 0x7A, 0x0E,
-    0x15, 0x93, 0x97, 0x3C, 0x73, 0x82, 0xC9, 0x83, 0x7B, 0xE2, 0x47, 0x84, 0x9F, 0x8A, 0x47, 0x11,
-    0x7F, 0x2C, 0x98, 0x3C, 0x05, 0x1C, 0xEF, 0xA4, 0xF1, 0x5B, 0xC1, 0xE4, 0xB3, 0x46, 0x30, 0x79,
-    0x24, 0xFA, 0xA8, 0x4C, 0x8A, 0x60, 0x95, 0x96, 0xC8, 0x7B, 0xAE, 0x71, 0x24, 0x56, 0xB2, 0x2A,
-    0x1D, 0x0A, 0xC8, 0x20, 0xBD, 0x22, 0xF3, 0xFB, 0xFE, 0x08, 0xA4, 0xBD, 0x1B, 0xDC, 0x23, 0xCB,
-    0x48, 0x61, 0xFA, 0x2A, 0x2B, 0xC3, 0xAB, 0xDB, 0xB4, 0x53, 0x09, 0x83, 0x0E, 0xC8, 0x41, 0x9A,
-    0xB3, 0xDE, 0xF3, 0x96, 0x77, 0xBC, 0x54, 0xDC, 0x00, 0xAF, 0xE9, 0x76, 0x09, 0xB7, 0x7D, 0x6A,
-    0x8A, 0x8F, 0x20, 0x6D, 0x09, 0x42, 0x11, 0xA7, 0x37, 0x3A, 0xF2, 0x78, 0x55, 0xE4, 0x05, 0x7A,
-    0x07, 0x54, 0x06, 0x01, 0xB5, 0xCB, 0xAC, 0x46, 0x2C, 0x24, 0xCA, 0xBC, 0x25, 0x66, 0x65, 0x9E,
-    0xBB, 0xFC, 0xAE, 0xB7, 0xA0, 0xBE, 0x5E, 0xBA, 0xD8, 0x72, 0x6B, 0x3E, 0x12, 0xE3, 0x6A, 0x5E,
-    0xC6, 0x4A, 0x4E, 0x3D, 0x0D, 0x16, 0x2F, 0xFC, 0x6B, 0x26, 0xBF, 0x8C, 0x53, 0x2E, 0xDA, 0xA8,
-    0x4E, 0x85, 0x17, 0xA2, 0x4C, 0x5B, 0xE1, 0xF1, 0xB9, 0x0D, 0x6F, 0x73, 0x8D, 0x27, 0xF4, 0x7C,
-    0x3F, 0xAC, 0x44, 0x74, 0x3E, 0xDF, 0x93, 0xFB, 0xD6, 0x7C, 0x83, 0x7E, 0x94, 0xB2, 0xD2, 0x61,
-    0x6C, 0x79, 0xBF, 0x83, 0xA3, 0x9F, 0xFE, 0x2B, 0x14, 0x19, 0xDC, 0x9D, 0x70, 0x29, 0xD3, 0xF7,
-    0x57, 0xA3, 0x34, 0x9E, 0x1A, 0x67, 0x45, 0x85, 0x81, 0xA8, 0x94, 0x0F, 0x8F, 0x3B, 0xEC, 0x5E,
-    0xC0, 0x57, 0x14, 0x34, 0x0A, 0x49, 0xB7, 0x99, 0x71, 0x45, 0x9E, 0x4D, 0xF1, 0xA0, 0xC0, 0x20,
-    0x6D, 0x16, 0x02, 0xE3, 0xFA, 0xD1, 0xD2, 0x96, 0x23, 0x96, 0xD2, 0x80, 0x90, 0x80, 0x8A, 0x6C,
-    0x66, 0x7F, 0x55, 0x66, 0x60, 0x69, 0xE6, 0xD2, 0x6E, 0xD8, 0x8E, 0x9D, 0xEB, 0x78, 0x58, 0x21,
-    0x97, 0xEB, 0x60, 0xE9, 0x37, 0xB3, 0xCA, 0x34, 0xDE, 0xC4, 0x71, 0x38, 0x4E, 0x0E, 0x99, 0x9D,
-    0x1B, 0xBC, 0x52, 0x40, 0x1C, 0x97, 0xC6, 0x6F, 0xC4, 0xAF, 0x09, 0x2A, 0xF3, 0x5B, 0x18, 0x85,
-    0xB3, 0x4F, 0x83, 0x39, 0x97, 0xDE, 0xBF, 0x21, 0xA3, 0x5B, 0x16, 0x8E, 0xF0, 0x40, 0xAD, 0xC5,
-    0x69, 0x7F, 0x45, 0x66, 0x75, 0x6A, 0xE2, 0x59, 0xE5, 0x16, 0xD5, 0x23, 0x8D, 0x18, 0xD3, 0x7D,
-    0x9E, 0xA7, 0x27, 0xFD, 0xDE, 0xE9, 0xB3, 0xE1, 0x19, 0x10, 0xA1, 0xF4, 0x7D, 0x7C, 0x9B, 0xA4,
-    0xC4, 0x49, 0xCC, 0x3C, 0x88, 0xCF, 0xBB, 0x22, 0x3D, 0xA7, 0x26, 0x30, 0x02, 0x07, 0xF7, 0x49,
-    0xBE, 0x17, 0x62, 0x46, 0x85, 0xD5, 0xB1, 0x98, 0x8C, 0x57, 0x44, 0x67, 0xBE, 0x6B, 0x22, 0x59,
-    0xBC, 0xF7, 0x54, 0xCA, 0xB2, 0xBD, 0x45, 0x16, 0xA1, 0xCA, 0x66, 0x7D, 0xCB, 0xBC, 0xB7, 0x32,
-    0xFF, 0xB4, 0x3B, 0x2A, 0x96, 0xEE, 0x31, 0xFE, 0xBF, 0xE3, 0x53, 0x13, 0xF3, 0x64, 0xBA, 0xB3,
-    0xC9, 0xD3, 0x49, 0x6B, 0xED, 0xFC, 0xC9, 0x8F, 0x34, 0xD8, 0x7E, 0xEE, 0x70, 0x88, 0xE3, 0x24,
-    0x94, 0x5D, 0x43, 0xCC, 0x15, 0x8D, 0xB1, 0x42, 0x4A, 0x4D, 0x07, 0x44, 0x9D, 0xB2, 0x3E, 0x11,
-    0xF6, 0xE3, 0x2D, 0xBB, 0x56, 0x75, 0xE0, 0x14, 0x82, 0xAA, 0x04, 0x7C, 0x94, 0xE9, 0x0F, 0xAA,
-    0x05, 0x33, 0x55, 0x0C, 0x27, 0x6A, 0x47, 0x8C, 0xBF, 0x30, 0xAE, 0x4A, 0xAC, 0x1C, 0x8C, 0xA9,
-    0xE7, 0x8C, 0xE9, 0xB9, 0xA7, 0xB1, 0x19, 0x3C, 0x24, 0x5B, 0xC6, 0x6B, 0x38, 0x1C, 0x3C, 0x1A,
-    0xDB, 0x07, 0x23, 0xB7, 0x7F, 0x86, 0xCA, 0x92, 0x89, 0x03, 0xAE, 0xC9, 0x21, 0xDE, 0xB1, 0x45,
-    0xEE, 0x78, 0xC4, 0xA9, 0xB9, 0xF9, 0xA1, 0x19, 0x7F, 0x8C, 0x6A, 0x77, 0x8B, 0x67, 0x33, 0x46,
-    0xAE, 0x73, 0x30, 0x04, 0x70, 0x02, 0xDF, 0x0B, 0xA9, 0x35, 0xB5, 0x9D, 0x6B, 0xF5, 0x86, 0x86,
-    0xE8, 0x19, 0x33, 0x62, 0x08, 0x7F, 0x33, 0x32, 0x07, 0x65, 0x0A, 0xC0, 0xEB, 0x2E, 0xBD, 0x2A,
-    0xDA, 0x12, 0xDF, 0xBD, 0x93, 0x91, 0x83, 0x26, 0x29, 0xBC, 0x56, 0x3C, 0x83, 0x77, 0xFD, 0x66,
-    0xA3, 0x2D, 0xBD, 0x3D, 0xB9, 0xBE, 0x0E, 0x1A, 0xDB, 0x06, 0xFF, 0xD3, 0x5F, 0x0B, 0x84, 0xDD,
-    0x88, 0x4D, 0x22, 0xC1, 0x84, 0xA8, 0x0D, 0xB0, 0x18, 0xDF, 0x5F, 0x43, 0x59, 0x1E, 0x30, 0x61,
-    0xC1, 0x51, 0x26, 0xEC, 0x19, 0x62, 0xD1, 0xA8, 0x50, 0xDF, 0x33, 0xEF, 0xFD, 0xD6, 0xBC, 0x78,
-    0xD6, 0x29, 0xD4, 0xF9, 0x3A, 0xB4, 0xEB, 0xB4, 0x5F, 0xDB, 0x1B, 0x32, 0x41, 0x91, 0x51, 0xCB,
-    0x5C, 0x78, 0xCF, 0xFF, 0x0F, 0xD5, 0xA7, 0x3B, 0x1F, 0x5E, 0x62, 0x30, 0x36, 0x21, 0x32, 0xA6,
-    0xDB, 0x7A, 0x95, 0xAC, 0x49, 0x32, 0x26, 0xB1, 0x2A, 0x96, 0x89, 0x67, 0xA7, 0x9E, 0xCF, 0x42,
-    0xD6, 0x0D, 0x9C, 0x98, 0x3D, 0x04, 0x4E, 0x1C, 0x6F, 0x65, 0xFE, 0x3B, 0xFB, 0xE3, 0x77, 0x24,
-    0x23, 0xCE, 0x36, 0x31, 0x08, 0x72, 0xBD, 0x6C, 0x50, 0x28, 0x7A, 0x6E, 0x62, 0xAF, 0x9F, 0xAF,
-    0xB2, 0x61, 0x11, 0xD0, 0x11, 0x54, 0xB4, 0x08, 0xAB, 0x11, 0x54, 0xFC, 0x78, 0x0B, 0x54, 0x1C,
-    0xFF, 0xF7, 0x52, 0x2E, 0xC2, 0x41, 0x84, 0x5F, 0xC9, 0x3C, 0x89, 0x2C, 0xE1, 0x62, 0x16, 0xD7,
-    0x03, 0x88, 0x49, 0x8A, 0xB1, 0xA9, 0x86, 0x90, 0x47, 0xC4, 0xCC, 0x31, 0xCD, 0x12, 0x17, 0xC7,
-    0x15, 0x79, 0xB4, 0x4F, 0xFC, 0x7A, 0x93, 0x7E, 0x87, 0x28, 0xDE, 0xAE, 0x2C, 0x66, 0xC3, 0x1F,
-    0xE3, 0xFA, 0x87, 0x48, 0x69, 0xA7, 0x5F, 0xDD, 0xB4, 0x88, 0x84, 0xAD, 0x11, 0xB8, 0xA9, 0x5D,
-    0x3E, 0x42, 0x5F, 0xD7, 0x87, 0x40, 0x8A, 0xBF, 0x9D, 0x5E, 0x27, 0x68, 0xE7, 0xE6, 0x9F, 0xDE,
-    0x83, 0x4E, 0xBF, 0x13, 0x5A, 0xDB, 0x26, 0x9F, 0x7D, 0x07, 0x6B, 0x3D, 0x9B, 0xBA, 0xEF, 0xDB,
-    0xC2, 0x58, 0xC5, 0x88, 0x32, 0xD3, 0xDE, 0xF4, 0xFA, 0x97, 0x59, 0x4C, 0xBE, 0xD2, 0x94, 0x35,
-    0x87, 0xC5, 0x4C, 0xD7, 0x2F, 0x89, 0x56, 0x49, 0x3F, 0x78, 0x6B, 0x25, 0x53, 0x58, 0xF2, 0xAF,
-    0x74, 0x0C, 0x85, 0x7C, 0x30, 0x0E, 0x78, 0x26, 0x5C, 0x06, 0xC4, 0x5C, 0x51, 0x48, 0x12, 0x6B,
-    0xD4, 0x8A, 0x01, 0xBB, 0xAC, 0x9C, 0xB4, 0xDB, 0x29, 0x9E, 0x67, 0xA1, 0x9D, 0xBE, 0x2E, 0x14,
-    0x66, 0xD8, 0x3E, 0xF7, 0x5D, 0x64, 0xFD, 0x56, 0xCB, 0xBB, 0x66, 0xA8, 0x5D, 0x70, 0x21, 0xFB,
-    0x7F, 0x80, 0x5B, 0xE8, 0x62, 0xDE, 0x6B, 0x4D, 0xD0, 0x27, 0x2E, 0xFE, 0xF5, 0x42, 0x37, 0xCF,
-    0x7C, 0x77, 0xED, 0x51, 0xDF, 0xF4, 0xF6, 0xC1, 0x65, 0xFB, 0x41, 0x46, 0xFB, 0x11, 0xC3, 0x86,
-    0xEC, 0xDD, 0x9F, 0xBF, 0xD1, 0x34, 0x2A, 0x88, 0x50, 0x4E, 0x08, 0x3F, 0x22, 0xB7, 0x37, 0x2D,
-    0xCE, 0x57, 0x5E, 0x7F, 0xF7, 0x90, 0x28, 0x6D, 0xE4, 0x89, 0x6E, 0x09, 0xEA, 0x12, 0xF0, 0x45,
-    0x57, 0x1F, 0x0E, 0x06, 0x4F, 0x57, 0xFE, 0xBF, 0xA2, 0xE5, 0x7F, 0xA4, 0xB5, 0x13, 0xF1, 0xF8,
-    0x59, 0xEA, 0xEE, 0x60, 0x53, 0x0E, 0xB1, 0x1A, 0xBE, 0x34, 0xAB, 0x09, 0xB3, 0xA5, 0x93, 0x5E,
-    0xD6, 0x9A, 0x24, 0xD0, 0xFF, 0x32, 0x1E, 0x33, 0x53, 0x57, 0x18, 0xAD, 0x43, 0xA1, 0x64, 0xB9,
-    0x3F, 0x26, 0x3A, 0xCE, 0xEF, 0x62, 0xA2, 0xA8, 0x79, 0x58, 0x26, 0xBF, 0x8C, 0x57, 0xA7, 0x68,
-    0x69, 0xA7, 0x70, 0x87, 0x7F, 0x8D, 0x07, 0x21, 0x0A, 0x17, 0xE3, 0xB3, 0x19, 0x3D, 0xA3, 0x16,
-    0x99, 0x70, 0x26, 0x2D, 0x7B, 0x17, 0x31, 0x2B, 0x1D, 0xDD, 0xD3, 0xB7, 0xA2, 0xA8, 0x02, 0xC8,
-    0x59, 0x94, 0x71, 0xCA, 0x01, 0x69, 0x0D, 0xEC, 0x22, 0x40, 0xC9, 0x1D, 0xFD, 0xD3, 0x44, 0xA8,
-    0x4D, 0x4B, 0x32, 0xEC, 0xEC, 0x76, 0x6D, 0x5A, 0x73, 0x74, 0x6D, 0xDA, 0x20, 0x1E, 0xD1, 0xE4,
-    0xEB, 0x17, 0xDF, 0xA0, 0x9D, 0xCF, 0xE7, 0x57, 0x98, 0x3B, 0xB3, 0x43, 0x2B, 0x50, 0xF4, 0x37,
-    0x8F, 0x37, 0xE6, 0xA4, 0x7D, 0x7B, 0x58, 0xD6, 0xB7, 0x57, 0x72, 0x87, 0x43, 0x9E, 0xBE, 0x06,
-    0x5D, 0x95, 0x5E, 0xC1, 0xF1, 0x4D, 0xCB, 0x0F, 0x64, 0xBF, 0xD3, 0x15, 0xFF, 0xB2, 0xD1, 0xD2,
-    0xFD, 0x69, 0xA2, 0x19, 0x5B, 0xFC, 0x89, 0x80, 0x62, 0xD2, 0x66, 0x8F, 0xD9, 0xFE, 0x3F, 0xA5,
-    0x56, 0xBD, 0x6F, 0xDB, 0x46, 0x14, 0xFF, 0x9D, 0x28, 0x9B, 0x49, 0x88, 0x98, 0x1A, 0x1C, 0x20,
-    0x48, 0x52, 0x33, 0x83, 0x07, 0xD7, 0x88, 0xC3, 0xC5, 0x83, 0x81, 0x4A, 0xE6, 0xB5, 0x43, 0x33,
-    0x15, 0xD5, 0x10, 0xA5, 0x43, 0x86, 0x78, 0x4D, 0x80, 0xC2, 0x2A, 0x60, 0xA0, 0x2A, 0x2A, 0x8B,
-    0xFC, 0x13, 0x0C, 0xB4, 0xE8, 0xD2, 0xC5, 0x43, 0x0A, 0x38, 0xEA, 0x10, 0x0D, 0x19, 0x0C, 0xC4,
-    0x16, 0x99, 0xBF, 0xA0, 0x0C, 0xD0, 0x34, 0x53, 0x01, 0x02, 0x69, 0x8A, 0x8E, 0x2C, 0xCA, 0xA0,
-    0x6C, 0x4B, 0xE9, 0xFA, 0xDE, 0x89, 0x4A, 0x62, 0x27, 0x0D, 0x02, 0xF4, 0x3E, 0x74, 0xE7, 0x77,
-    0xEF, 0xDE, 0xBD, 0xAF, 0xDF, 0xA3, 0x6F, 0x49, 0x78, 0x11, 0xEC, 0x04, 0x46, 0x06, 0x14, 0x80,
-    0x07, 0xCC, 0x00, 0x7D, 0x88, 0x31, 0x8C, 0x02, 0x56, 0x0A, 0x3B, 0x62, 0xDA, 0x3C, 0x80, 0xE5,
-    0x00, 0xF0, 0x13, 0x08, 0x95, 0xC1, 0x78, 0x56, 0xC0, 0x8E, 0x7D, 0x3A, 0xB1, 0xA3, 0x79, 0x08,
-    0x29, 0x76, 0xB0, 0x61, 0x8F, 0x91, 0xBA, 0xEA, 0xD7, 0xB4, 0xE1, 0xA8, 0xB8, 0x2B, 0x94, 0xAC,
-    0xD1, 0x95, 0x33, 0xAD, 0xAB, 0xA1, 0x1A, 0xD3, 0xA0, 0xCD, 0xAD, 0x7E, 0xFF, 0x8E, 0x2A, 0x1B,
-    0x1D, 0x61, 0x80, 0xB9, 0x7D, 0x5C, 0xF6, 0xAE, 0x15, 0xAE, 0xCA, 0x4C, 0x15, 0xD3, 0x13, 0x4B,
-    0xA1, 0x1A, 0xCE, 0x57, 0x51, 0xF3, 0x50, 0xF8, 0x28, 0xE8, 0x97, 0xF6, 0x43, 0xA9, 0xD2, 0x6B,
-    0x39, 0x69, 0x96, 0x9F, 0x4F, 0xDD, 0xE0, 0x32, 0x16, 0x20, 0x6E, 0xC3, 0x56, 0x70, 0xAF, 0x47,
-    0x75, 0x83, 0x47, 0xC3, 0x88, 0x9C, 0xBB, 0x81, 0x35, 0x06, 0x6A, 0x10, 0x7B, 0xA7, 0x76, 0x8D,
-    0xDC, 0x89, 0xAC, 0xD4, 0x93, 0x76, 0x34, 0x24, 0xF5, 0x72, 0x74, 0x8D, 0x04, 0x35, 0x21, 0xF1,
-    0x2E, 0x66, 0x03, 0x97, 0xBA, 0x95, 0x0C, 0x61, 0xFC, 0x93, 0x03, 0x2A, 0x05, 0x9B, 0xCE, 0xE6,
-    0xDE, 0x1C, 0x72, 0xBB, 0x79, 0x73, 0x76, 0x67, 0x48, 0xC7, 0x2F, 0x0D, 0xA2, 0xDC, 0xFA, 0x60,
-    0x0F, 0xDE, 0x83, 0x91, 0x36, 0xD7, 0x24, 0x15, 0x44, 0x6E, 0x45, 0xE8, 0x56, 0x52, 0x54, 0xD1,
-    0xC4, 0x12, 0x10, 0x92, 0x24, 0x60, 0x88, 0xC1, 0x3C, 0x9B, 0xD3, 0xFB, 0xE6, 0x85, 0x39, 0xA2,
-    0x2F, 0x6D, 0x95, 0x7A, 0xAA, 0xD8, 0xC6, 0xF6, 0x3D, 0x2C, 0xD4, 0x50, 0xAD, 0xC4, 0x66, 0x6C,
-    0x45, 0x76, 0xE4, 0x06, 0x5E, 0xE0, 0xC9, 0x90, 0x2E, 0xB6, 0xC8, 0xF5, 0x76, 0xE2, 0xC4, 0x2E,
-    0xD3, 0x48, 0xDF, 0x6D, 0x1C, 0xE0, 0x2A, 0x49, 0x0B, 0x41, 0xCE, 0x95, 0x6E, 0xE0, 0x10, 0xB7,
-    0x15, 0x1B, 0x89, 0x68, 0x5A, 0x9A, 0xCF, 0x61, 0x3E, 0x39, 0xE5, 0xBB, 0x25, 0xBD, 0xC8, 0x89,
-    0xCD, 0x54, 0x14, 0xE8, 0xA1, 0x2A, 0xFA, 0x46, 0x61, 0x66, 0x76, 0xEC, 0xC9, 0x6D, 0xF2, 0x05,
-    0x1A, 0x68, 0x2C, 0x1F, 0xFA, 0xA3, 0xE5, 0x11, 0xEF, 0x80, 0x2E, 0xF5, 0xDE, 0x9E, 0x3F, 0xF2,
-    0xF7, 0x78, 0x47, 0xD1, 0xEC, 0xEF, 0xFA, 0x2A, 0xA5, 0x01, 0xF1, 0xCA, 0xC0, 0x2E, 0x6E, 0x6A,
-    0xB3, 0xC6, 0x10, 0x23, 0xCE, 0x03, 0x37, 0x85, 0x8A, 0xF0, 0x17, 0x87, 0x0D, 0x02, 0x2E, 0x29,
-    0x98, 0xEA, 0x3E, 0xA4, 0xBD, 0x20, 0x9A, 0x11, 0x71, 0xBF, 0xFE, 0x54, 0xA9, 0x90, 0x02, 0xC1,
-    0x11, 0x36, 0xE3, 0x09, 0x8D, 0xFB, 0x27, 0x8F, 0x98, 0xC2, 0xBB, 0x4A, 0x70, 0xA6, 0x25, 0x7D,
-    0x15, 0x7B, 0x24, 0x6D, 0x8F, 0x82, 0xFA, 0xBC, 0x8B, 0x22, 0xCC, 0xC3, 0xD4, 0x0F, 0x8E, 0x10,
-    0x31, 0x42, 0x98, 0x7B, 0xB9, 0x95, 0x9D, 0x84, 0xC7, 0x1E, 0x0B, 0x4E, 0xE2, 0x58, 0x76, 0xBC,
-    0x21, 0x17, 0x4E, 0xED, 0xD8, 0x91, 0x13, 0xB8, 0x58, 0x27, 0x6B, 0x6B, 0xA4, 0xA0, 0x19, 0xD8,
-    0xC9, 0x6C, 0x41, 0x7F, 0xAE, 0x63, 0x18, 0x16, 0x61, 0x0C, 0x69, 0x24, 0xC4, 0xA1, 0x09, 0x1E,
-    0xDC, 0xC2, 0x2E, 0x9E, 0xE7, 0x01, 0x5B, 0x19, 0x2A, 0x95, 0xF0, 0x3C, 0x80, 0x71, 0x64, 0xF2,
-    0xD9, 0x52, 0x25, 0x58, 0xE2, 0x07, 0xDD, 0x1B, 0xCF, 0x72, 0x5B, 0xA9, 0x54, 0xDC, 0x3E, 0x27,
-    0x8F, 0xA6, 0x57, 0x71, 0x24, 0xBD, 0x34, 0x72, 0xE8, 0xC5, 0xD7, 0x21, 0x67, 0x82, 0x82, 0xDE,
-    0xB5, 0x37, 0xA5, 0x0D, 0xA1, 0x6B, 0xC7, 0x19, 0x89, 0xC4, 0x53, 0x8F, 0xE3, 0x03, 0x47, 0x45,
-    0x59, 0x45, 0x51, 0xEE, 0xBD, 0x82, 0xAE, 0xFE, 0x8E, 0x4F, 0x6E, 0x8E, 0xF5, 0x0F, 0xAB, 0x39,
-    0x05, 0x5B, 0x8B, 0x1A, 0xCA, 0xF6, 0x32, 0x4D, 0x83, 0x76, 0x04, 0x7A, 0xEA, 0x71, 0xB2, 0x4D,
-    0x62, 0xEF, 0x95, 0xA0, 0x3D, 0x0E, 0xD4, 0x50, 0xEF, 0xC6, 0xE5, 0xC2, 0x0F, 0x11, 0x03, 0x97,
-    0x04, 0x4A, 0x3B, 0xAB, 0xA0, 0x92, 0x60, 0x52, 0x08, 0x32, 0x0A, 0x11, 0x2E, 0x4C, 0x9F, 0xE1,
-    0x72, 0x41, 0x3E, 0x20, 0xF8, 0xA1, 0x42, 0x75, 0xC5, 0x20, 0x5F, 0x98, 0xA4, 0x13, 0x21, 0x07,
-    0x36, 0xF9, 0xC2, 0x95, 0xBA, 0xD0, 0x50, 0xD2, 0x82, 0xF2, 0x58, 0xB3, 0x89, 0x29, 0x5B, 0x52,
-    0xB2, 0xD1, 0x74, 0x4A, 0xB6, 0xF5, 0x92, 0xAD, 0x78, 0xC1, 0xC6, 0x81, 0xB0, 0xE2, 0x57, 0xD9,
-    0xB8, 0x35, 0xC1, 0x70, 0xB0, 0x75, 0x1F, 0x92, 0x6C, 0xA9, 0xA9, 0xC7, 0x03, 0x39, 0x0D, 0x30,
-    0x9F, 0x79, 0x4A, 0x15, 0x3C, 0xEB, 0x40, 0x7D, 0x3A, 0x1B, 0xAD, 0x56, 0x97, 0x69, 0xCB, 0xFD,
-    0xFE, 0x1E, 0x05, 0x38, 0xE0, 0x40, 0xBB, 0x56, 0xBA, 0xCF, 0x81, 0xE7, 0x04, 0x00, 0x16, 0xCF,
-    0x1E, 0xF6, 0xBC, 0xC2, 0x4E, 0x9D, 0xCC, 0x1F, 0x75, 0x1B, 0xB5, 0x2A, 0xA4, 0x13, 0x7B, 0xC1,
-    0x36, 0x81, 0xCD, 0x25, 0xBD, 0xCC, 0xC8, 0x24, 0x54, 0xFB, 0x8C, 0xC4, 0xB7, 0x88, 0x45, 0x1F,
-    0x7E, 0xE0, 0x52, 0xDD, 0xAA, 0xE4, 0x38, 0xA4, 0x24, 0xEF, 0xA3, 0x42, 0xB8, 0xCB, 0xB9, 0x2E,
-    0xBB, 0x01, 0xBB, 0x89, 0xA4, 0xFC, 0x57, 0x16, 0x90, 0xA0, 0x40, 0xC5, 0x96, 0x2E, 0x2D, 0xCE,
-    0x54, 0xB6, 0x9D, 0x62, 0xDE, 0x79, 0x88, 0x9E, 0xFB, 0x43, 0x14, 0x7A, 0x1F, 0xC7, 0xBD, 0x75,
-    0x3B, 0xAA, 0x76, 0x85, 0x96, 0xD3, 0xD3, 0xDD, 0x6F, 0x7A, 0xA9, 0x9D, 0x90, 0x71, 0xFD, 0x80,
-    0xAC, 0x54, 0x91, 0xD7, 0xEF, 0xDF, 0x8D, 0xA8, 0x4C, 0x98, 0x2F, 0xFD, 0xD4, 0x19, 0xD8, 0x6F,
-    0xA3, 0xFD, 0x6B, 0x0B, 0x27, 0x95, 0x9A, 0xD1, 0xF2, 0xA1, 0x2E, 0x3E, 0xDC, 0x45, 0x00, 0xF1,
-    0x55, 0xBC, 0xE3, 0xA8, 0x07, 0x13, 0x0B, 0xA8, 0x04, 0x64, 0x3D, 0xB2, 0x80, 0x02, 0xAA, 0x7D,
-    0x74, 0x8A, 0xA6, 0x1B, 0x4C, 0x26, 0x45, 0xF4, 0x75, 0xD6, 0xD6, 0x66, 0x8E, 0xF2, 0x68, 0x6C,
-    0x01, 0xD2, 0xCA, 0x8D, 0xC8, 0x55, 0xDF, 0x46, 0xF4, 0xE5, 0x91, 0x75, 0xFA, 0x70, 0x71, 0x33,
-    0x33, 0xAA, 0x05, 0xEA, 0x4A, 0xB4, 0xBE, 0xA9, 0x82, 0x3A, 0xDF, 0x2D, 0x03, 0x21, 0xA2, 0x55,
-    0x58, 0x8F, 0x7A, 0x1C, 0x72, 0xBA, 0xA3, 0x02, 0x6D, 0x6A, 0x70, 0xB1, 0x34, 0xAA, 0x12, 0x98,
-    0x89, 0x93, 0x9F, 0xFF, 0xCD, 0x88, 0x27, 0xDD, 0xCF, 0x0C, 0x15, 0x39, 0xA3, 0x72, 0xF9, 0xA2,
-    0x49, 0xF5, 0x7A, 0xE6, 0xD3, 0x8E, 0x66, 0x5D, 0xE9, 0xE8, 0x34, 0xA7, 0x65, 0xAE, 0x3E, 0xC0,
-    0x0A, 0x30, 0x37, 0x3F, 0xD0, 0x95, 0x50, 0xFB, 0xAC, 0x12, 0xF0, 0xC0, 0x09, 0xA2, 0x2C, 0xA2,
-    0xF6, 0x0E, 0x2D, 0x9D, 0x6A, 0xA7, 0xCA, 0xA6, 0xAE, 0x74, 0x58, 0x91, 0xEA, 0x4A, 0xA7, 0xCE,
-    0x42, 0x56, 0x3A, 0x8B, 0xB4, 0x9C, 0x5D, 0x29, 0x65, 0x2E, 0x6A, 0xCE, 0xB3, 0xE0, 0x65, 0x95,
-    0x94, 0x95, 0x3C, 0xA6, 0x32, 0xC5, 0x47, 0xF8, 0x4C, 0xA2, 0x7C, 0x8F, 0x2E, 0x2C, 0x4D, 0x94,
-    0xC0, 0x8B, 0xE5, 0xA8, 0xBA, 0x35, 0x42, 0x84, 0xFB, 0x4B, 0x85, 0x6A, 0xAB, 0x93, 0x7B, 0x72,
-    0x91, 0x0A, 0xB5, 0x23, 0x7B, 0xD8, 0xC7, 0x3D, 0x9A, 0x3D, 0xDA, 0x53, 0x3A, 0xB4, 0x60, 0xA9,
-    0xC4, 0x55, 0x45, 0xEF, 0xFD, 0xC3, 0x7D, 0x2C, 0x6C, 0x6C, 0x9F, 0xE4, 0xA2, 0x4F, 0xE3, 0x50,
-    0x83, 0xB8, 0xD6, 0xE8, 0x4E, 0xF3, 0xFB, 0x12, 0x6B, 0x5B, 0x45, 0xF7, 0x7C, 0xEE, 0xD1, 0xF7,
-    0xC5, 0x4D, 0x2B, 0x05, 0x2E, 0xD4, 0x28, 0xAA, 0x5E, 0x62, 0x96, 0xF2, 0x57, 0x35, 0xCE, 0x72,
-    0x42, 0x62, 0x48, 0x5F, 0x28, 0x2B, 0x0B, 0x03, 0x33, 0xFB, 0x33, 0x72, 0x7F, 0xFF, 0x23, 0x1E,
-    0x1B, 0x0F, 0xD3, 0xC4, 0x88, 0xD2, 0x26, 0x61, 0xD0, 0x87, 0x2D, 0x2D, 0x69, 0x4B, 0x9F, 0xF6,
-    0x4D, 0x8A, 0xF9, 0xB4, 0xAE, 0x57, 0x02, 0x23, 0xFA, 0xFC, 0xE7, 0x70, 0x7C, 0xE3, 0x99, 0x93,
-    0xAD, 0x1F, 0x9C, 0xB8, 0x38, 0x9B, 0xBB, 0x94, 0x2A, 0x2A, 0x6B, 0x58, 0x49, 0x97, 0x11, 0xC7,
-    0x93, 0xF7, 0x4C, 0x33, 0x73, 0x37, 0xAE, 0x92, 0xC7, 0xEB, 0xF0, 0x46, 0x7E, 0x41, 0x4B, 0x07,
-    0x1B, 0xF3, 0x93, 0xE0, 0x4A, 0x6F, 0x92, 0xFD, 0x91, 0xA3, 0xF3, 0xD6, 0x93, 0x66, 0xCE, 0x51,
-    0x1D, 0x51, 0xE9, 0x7D, 0x8A, 0x99, 0x90, 0x72, 0xCD, 0xE5, 0x9C, 0xA5, 0xC8, 0x08, 0x5A, 0x32,
-    0x7D, 0xA7, 0xFF, 0x5D, 0x59, 0xB0, 0xFE, 0xCF, 0xFD, 0x33, 0x0C, 0x83, 0xAB, 0x5C, 0x7A, 0xD5,
-    0x88, 0x41, 0xD5, 0xDF, 0x7B, 0x95, 0x82, 0x73, 0x5F, 0x33, 0x7F, 0x60, 0x2A, 0xF5, 0x17, 0x07,
-    0x95, 0x6C, 0x51, 0x7F, 0xB7, 0x36, 0xC9, 0x5B, 0xE2, 0x2E, 0x97, 0x5A, 0xFE, 0x2A, 0x6F, 0x4E,
-    0x84, 0x96, 0x6D, 0xF6, 0xEE, 0x1D, 0x9D, 0x95, 0x74, 0x9A, 0x4F, 0xCA, 0x14, 0x65, 0x2D, 0x3D,
-    0xFD, 0x23, 0xC4, 0x66, 0x06, 0x4B, 0xEB, 0x36, 0xC6, 0x54, 0xD7, 0xA9, 0xEE, 0x53, 0x5B, 0x70,
-    0xA4, 0xB5, 0x27, 0x3A, 0xB6, 0x86, 0x65, 0x3D, 0x57, 0x51, 0xB9, 0x96, 0x7C, 0xDD, 0x92, 0x6F,
-    0xE3, 0xF9, 0x0D, 0xD1, 0x5C, 0x38, 0xC0, 0x1C, 0xE6, 0x1C, 0xB5, 0x65, 0x0D, 0xEC, 0xAD, 0x4D,
-    0xE7, 0x27, 0xD1, 0x84, 0x7D, 0x80, 0x35, 0x0B, 0x5B, 0x26, 0x7C, 0x25, 0xDB, 0x3A, 0x49, 0x2F,
-    0x7F, 0x88, 0xD9, 0x11, 0x6A, 0xED, 0x5A, 0xAD, 0x5D, 0x36, 0x62, 0x73, 0x0E, 0xB1, 0x65, 0x61,
-    0x60, 0xC8, 0xD4, 0x08, 0x06, 0x46, 0xD0, 0x36, 0x65, 0x63, 0x01, 0x56, 0x46, 0x5F, 0x6C, 0xB4,
-    0xCD, 0xA3, 0xC3, 0xC2, 0x9A, 0x8B, 0xF3, 0x4F, 0xE8, 0x39, 0x67, 0x7F, 0x8B, 0xFE, 0x2B, 0xE4,
-    0xDE, 0x46, 0x63, 0x9E, 0xB8, 0x2B, 0x84, 0x63, 0x1E, 0xE2, 0x0A, 0x2E, 0xDF, 0xC7, 0x96, 0x8D,
-    0x81, 0x89, 0x44, 0x8F, 0x81, 0x85, 0x86, 0x03, 0xEB, 0x09, 0xAB, 0xDB, 0x9E, 0x8C, 0x26, 0xBE,
-    0x1C, 0xA2, 0x63, 0xA1, 0x6D, 0x1C, 0x1F, 0xB5, 0xE6, 0x0C, 0xDE, 0x1B, 0xDE, 0x8F, 0xEB, 0x56,
-    0x90, 0xAE, 0xD1, 0xDD, 0xD5, 0xE3, 0xD3, 0x20, 0x31, 0xF2, 0xFB, 0x78, 0xBF, 0x7C, 0x9D, 0xFB,
-    0x2E, 0x39, 0xE0, 0x24, 0x16, 0x9A, 0xFE, 0xEE, 0x69, 0x4C, 0xBB, 0x0D, 0xFA, 0xB7, 0x4F, 0xB0,
-    0x55, 0xAB, 0x16, 0x2E, 0x9D, 0xC6, 0x85, 0x0B, 0x98, 0x5B, 0x83, 0xD9, 0xE6, 0x2F, 0x92, 0x88,
-    0xD9, 0xB6, 0xB5, 0x39, 0x9C, 0xBE, 0x04, 0x73, 0x80, 0x4A, 0xCC, 0x44, 0x3A, 0xAD, 0xCF, 0x61,
-    0x63, 0x16, 0xFF, 0x02, 0xED, 0x7D, 0x4D, 0xAC, 0x24, 0xD7, 0x75, 0xDE, 0xAD, 0x2E, 0xCE, 0xB4,
-    0xC4, 0x4A, 0x5C, 0x5C, 0x70, 0x48, 0x58, 0x44, 0x54, 0x5E, 0x68, 0xA5, 0x24, 0xAA, 0xAD, 0x11,
-    0xC8, 0xAC, 0x92, 0x05, 0xC8, 0x0B, 0x2F, 0x3C, 0x8B, 0x69, 0x12, 0xC6, 0x00, 0xA1, 0x16, 0x0A,
-    0x90, 0x90, 0x4E, 0x26, 0x0B, 0x2D, 0x12, 0x80, 0x7C, 0x55, 0x92, 0x16, 0x5E, 0x70, 0x91, 0x17,
-    0xC0, 0x23, 0x03, 0xC9, 0xC2, 0x5C, 0xD0, 0x80, 0xD4, 0x83, 0x60, 0xBC, 0xC8, 0x42, 0x88, 0xF9,
-    0xBA, 0x4A, 0xD1, 0x22, 0x0B, 0x2D, 0xDC, 0x89, 0x1C, 0x68, 0xA9, 0x16, 0x44, 0x22, 0xE0, 0x70,
-    0xA1, 0x52, 0xD4, 0x63, 0xD6, 0x9B, 0xA9, 0x9F, 0x9C, 0xEF, 0x3B, 0xF7, 0x56, 0x55, 0xBF, 0x9F,
-    0x79, 0x6F, 0x7E, 0x38, 0x9C, 0x91, 0xF3, 0x66, 0xFA, 0x9C, 0x7A, 0xFD, 0xEA, 0xE7, 0xD6, 0xB9,
-    0xF7, 0x9E, 0x7B, 0xFE, 0xAF, 0xB7, 0x34, 0xC6, 0x14, 0xA9, 0x31, 0x71, 0x69, 0x4C, 0xB0, 0x31,
-    0xC6, 0xAF, 0xE4, 0x8B, 0x46, 0x3E, 0xCF, 0x1B, 0xF7, 0x93, 0xF5, 0x7D, 0x2B, 0x9F, 0x8E, 0x1F,
-    0xFC, 0x7E, 0xAF, 0xCF, 0x62, 0x71, 0x45, 0xCE, 0x6B, 0xF8, 0xC1, 0xF1, 0x59, 0xE7, 0xEB, 0xFD,
-    0x3B, 0xF7, 0x31, 0x5F, 0xBF, 0x98, 0x7A, 0x4D, 0xB8, 0x9E, 0xC9, 0x47, 0x70, 0x69, 0xBE, 0x3E,
-    0x4B, 0x3F, 0x8D, 0x76, 0xC8, 0xA7, 0x6F, 0x85, 0x32, 0x3B, 0xC8, 0xCC, 0xB7, 0x6C, 0x08, 0x69,
-    0x74, 0x4E, 0x74, 0x01, 0xCD, 0xF7, 0xEF, 0xF4, 0xBD, 0x60, 0x5F, 0x6E, 0xB3, 0x05, 0xBA, 0x55,
-    0xC8, 0xDD, 0xFC, 0xAD, 0x99, 0xF5, 0x7A, 0xA6, 0x74, 0x00, 0x50, 0x92, 0x13, 0x49, 0x57, 0x9C,
-    0x8A, 0xEC, 0x29, 0x19, 0x2F, 0xF0, 0x78, 0xF9, 0xB3, 0x37, 0x71, 0xB3, 0x2A, 0xE2, 0xAD, 0x05,
-    0xE5, 0x78, 0xB0, 0x77, 0x05, 0xF0, 0x73, 0xFB, 0x72, 0x85, 0x74, 0x6C, 0x21, 0x5F, 0x34, 0xFA,
-    0xA8, 0x40, 0x7E, 0xF5, 0xCC, 0xB4, 0x6F, 0x9B, 0xE1, 0x73, 0x1E, 0x1A, 0x3D, 0xC4, 0xC7, 0xFD,
-    0x14, 0xFD, 0xFB, 0xD2, 0x0E, 0xA1, 0x05, 0x1F, 0xDF, 0xCB, 0x6B, 0xAC, 0xCD, 0xBF, 0x36, 0x3E,
-    0x08, 0x6C, 0x42, 0x52, 0x38, 0xDA, 0x00, 0x62, 0x48, 0xF2, 0x8D, 0x0D, 0x5F, 0xD8, 0xF0, 0x3D,
-    0x46, 0x28, 0x97, 0x96, 0x0E, 0x2E, 0x97, 0xCB, 0x7C, 0xE7, 0xAF, 0xFA, 0xBC, 0x84, 0x57, 0x25,
-    0xBC, 0x4F, 0xBC, 0xE6, 0xFD, 0xD9, 0x2F, 0x41, 0xC3, 0xCE, 0x11, 0x52, 0x5D, 0x34, 0xA6, 0xEF,
-    0x6E, 0x48, 0x4B, 0x62, 0xB6, 0x67, 0xD6, 0xF7, 0xF5, 0x40, 0x3D, 0xFC, 0xBC, 0xD4, 0x1F, 0xCA,
-    0x19, 0xF2, 0x8C, 0x39, 0x40, 0x58, 0x9B, 0x97, 0xD2, 0x68, 0xED, 0xDA, 0x16, 0xE7, 0x03, 0x28,
-    0x5D, 0xAB, 0xC3, 0x86, 0x77, 0x16, 0xC2, 0xCB, 0x8D, 0xF1, 0x65, 0x2F, 0xDF, 0x7A, 0x1C, 0x3D,
-    0x01, 0xC6, 0x80, 0x29, 0x78, 0x2A, 0xEE, 0x11, 0xE2, 0xFC, 0xA0, 0x72, 0x80, 0xBF, 0x46, 0xEB,
-    0xDF, 0x95, 0xC6, 0x97, 0xC9, 0x1D, 0x69, 0x53, 0x22, 0x7D, 0x22, 0x0D, 0x10, 0xEA, 0x98, 0x0B,
-    0x97, 0xF1, 0x4A, 0x0F, 0xF2, 0xEF, 0x77, 0x3F, 0x6F, 0xBA, 0x24, 0xED, 0x92, 0xFC, 0x20, 0x4E,
-    0x9F, 0x7F, 0xC6, 0xBE, 0xD5, 0xBC, 0x7A, 0xC4, 0xFF, 0xCD, 0x7C, 0x83, 0x97, 0x78, 0xC4, 0xFF,
-    0x37, 0x26, 0x5C, 0x4B, 0xEF, 0xF5, 0x7D, 0x2E, 0xA4, 0x2C, 0xDE, 0xD7, 0xA6, 0x4B, 0x3F, 0x68,
-    0x1F, 0x1E, 0x3F, 0xD8, 0xB0, 0x29, 0x72, 0xB0, 0xB6, 0xF3, 0x6F, 0x38, 0x08, 0xEF, 0x71, 0x50,
-    0x4E, 0x0E, 0x6E, 0x2F, 0xEC, 0x01, 0xE7, 0xBB, 0x1E, 0x08, 0xFD, 0x71, 0x70, 0x67, 0x29, 0x13,
-    0x4C, 0x4F, 0x96, 0xE1, 0x13, 0xF1, 0xC0, 0x6B, 0xED, 0x81, 0xE9, 0x4C, 0xA4, 0x33, 0xB3, 0xC0,
-    0x80, 0x38, 0x72, 0x90, 0xA4, 0xEE, 0xC0, 0xD8, 0x93, 0x33, 0x1E, 0xF8, 0x8D, 0x1C, 0xE2, 0x20,
-    0xAA, 0xF1, 0x38, 0x3C, 0x6B, 0x83, 0xF1, 0x87, 0x83, 0x14, 0xE3, 0x46, 0x0E, 0xDE, 0x37, 0x97,
-    0x86, 0xB9, 0x2A, 0x9F, 0x3D, 0x77, 0x50, 0x7C, 0x32, 0x07, 0x3D, 0x7E, 0xBA, 0xD4, 0x1E, 0xC8,
-    0x1B, 0xDB, 0x83, 0xCE, 0x9E, 0x33, 0xEB, 0x53, 0x7B, 0x72, 0x52, 0xDA, 0x83, 0x68, 0x6D, 0x0F,
-    0xC2, 0xE1, 0x60, 0x73, 0xEC, 0xC0, 0xFD, 0x29, 0x2A, 0x8F, 0x5C, 0xEE, 0x6E, 0x08, 0x82, 0xDB,
-    0x83, 0xAD, 0x3D, 0xB0, 0xCD, 0x78, 0x24, 0x6C, 0xD8, 0xBB, 0x6C, 0xD9, 0x70, 0x7E, 0x8C, 0x0D,
-    0xD7, 0xA7, 0xB1, 0xE1, 0x5D, 0x54, 0xDE, 0x3F, 0x32, 0xB3, 0xEF, 0x8D, 0x3C, 0xC7, 0x72, 0x33,
-    0xB6, 0x87, 0xAC, 0xCE, 0xD3, 0xB7, 0x48, 0xCD, 0xEE, 0x8F, 0xBC, 0xBB, 0x57, 0x73, 0x80, 0x90,
-    0x0E, 0xC2, 0x15, 0x32, 0x5E, 0x9C, 0x91, 0x09, 0x66, 0x18, 0x3D, 0x02, 0x67, 0x0D, 0x20, 0x08,
-    0x91, 0x91, 0x71, 0x64, 0xBC, 0x7F, 0x46, 0x3E, 0x99, 0x2D, 0x3A, 0x76, 0x65, 0x33, 0xC2, 0x45,
-    0xCF, 0x3B, 0x67, 0x39, 0x60, 0xC2, 0x33, 0xD1, 0x2A, 0x77, 0x07, 0x9F, 0x77, 0x33, 0xBD, 0x19,
-    0x9F, 0x92, 0xF0, 0x89, 0x72, 0x52, 0x46, 0x7A, 0xA3, 0x3D, 0x0D, 0xFB, 0x45, 0xEE, 0x7D, 0x91,
-    0xAF, 0x35, 0x6B, 0x27, 0xFC, 0x96, 0x5C, 0x10, 0xD3, 0x63, 0x24, 0xFA, 0xE5, 0x63, 0xEF, 0x65,
-    0xC7, 0x43, 0x4C, 0x98, 0x11, 0xF6, 0x80, 0x33, 0xC2, 0xF9, 0xC7, 0x80, 0xE1, 0x4F, 0x01, 0xE3,
-    0xB7, 0x01, 0x93, 0x00, 0xB0, 0x05, 0xF4, 0x1A, 0x40, 0xBF, 0x02, 0x0C, 0x37, 0x80, 0x51, 0x09,
-    0x98, 0x18, 0xC0, 0x15, 0xA0, 0xAC, 0x70, 0x02, 0x85, 0x6A, 0x02, 0x85, 0x15, 0x08, 0x94, 0xB9,
-    0x29, 0x50, 0x66, 0x9F, 0xC0, 0x15, 0xF8, 0x43, 0xD6, 0x10, 0x6E, 0x09, 0x2B, 0x42, 0x8A, 0x3D,
-    0xA0, 0x0B, 0x2E, 0x59, 0xA3, 0xE9, 0xF3, 0x6A, 0x8E, 0xA9, 0x77, 0x78, 0x0D, 0x3C, 0x9A, 0x03,
-    0xC6, 0xC4, 0x87, 0xC7, 0xDF, 0x65, 0x56, 0x63, 0x65, 0xF2, 0x6B, 0xD0, 0x7D, 0x5E, 0xA1, 0x0F,
-    0xA4, 0x5D, 0x15, 0x46, 0xB8, 0x8C, 0x28, 0x19, 0x43, 0xE8, 0x21, 0x79, 0x74, 0x47, 0x0A, 0x15,
-    0xEC, 0x73, 0xFD, 0x32, 0xE6, 0x09, 0xE1, 0x06, 0xBC, 0x2A, 0xE0, 0x85, 0x7E, 0x1D, 0x61, 0xB0,
-    0x34, 0x24, 0x62, 0xC7, 0x45, 0xAB, 0x20, 0x59, 0x13, 0x92, 0x38, 0x6E, 0xC6, 0x95, 0x51, 0xC7,
-    0x92, 0xAE, 0x8F, 0xBA, 0xAE, 0xA9, 0x60, 0xD1, 0x71, 0xD5, 0xA9, 0x09, 0xB9, 0xD0, 0x5D, 0x71,
-    0xED, 0x8C, 0x72, 0xD2, 0xFC, 0xC9, 0x80, 0x60, 0x25, 0x3B, 0x70, 0x58, 0xA3, 0xEF, 0x09, 0x83,
-    0xCD, 0xE4, 0xDD, 0x49, 0x87, 0x84, 0x34, 0x79, 0x99, 0xF0, 0x80, 0x4C, 0xB1, 0xC1, 0xD4, 0xF2,
-    0x1A, 0x5C, 0xE0, 0x6F, 0x41, 0x4F, 0xBF, 0x0A, 0xD9, 0xB9, 0xB8, 0x38, 0x5C, 0xCF, 0xB5, 0x6B,
-    0xB6, 0x68, 0xC6, 0x0C, 0x1D, 0x44, 0x89, 0xA8, 0x58, 0x2C, 0x5A, 0xAE, 0xEF, 0x90, 0x42, 0x00,
-    0x67, 0xDD, 0x72, 0x59, 0xE4, 0x38, 0x2D, 0x2A, 0x71, 0x49, 0xB8, 0x46, 0x07, 0x05, 0x55, 0xC4,
-    0x5E, 0x46, 0x5F, 0xFB, 0x35, 0x1E, 0x31, 0xA3, 0xB4, 0x64, 0x5A, 0xD0, 0xDD, 0x50, 0x5A, 0xCC,
-    0x27, 0x60, 0x90, 0x40, 0xCE, 0x00, 0xBD, 0xC8, 0x09, 0x19, 0x39, 0xDF, 0xB2, 0x20, 0x1F, 0x2C,
-    0xC0, 0x15, 0x23, 0xCE, 0x83, 0x0A, 0x53, 0x62, 0x17, 0x04, 0x95, 0xFB, 0x43, 0x2C, 0xFC, 0xD4,
-    0xEB, 0x4B, 0x8A, 0x4F, 0x19, 0x64, 0x96, 0x4C, 0xB9, 0xE5, 0x9D, 0xD4, 0xDE, 0x0F, 0xD2, 0x8A,
-    0x9C, 0x52, 0x8C, 0xB7, 0xDA, 0x92, 0xA5, 0xEC, 0x00, 0xDE, 0x4F, 0xD8, 0xF7, 0xE2, 0x15, 0x79,
-    0xB8, 0x65, 0xF6, 0x72, 0xAD, 0xFC, 0xBA, 0x76, 0x97, 0xF9, 0x78, 0x4F, 0x8F, 0xA0, 0x45, 0x9B,
-    0x5B, 0x77, 0x44, 0x02, 0xCC, 0x01, 0xE2, 0x0A, 0x4F, 0x5B, 0x03, 0xE0, 0x2E, 0xEF, 0x3F, 0x5E,
-    0x99, 0xD2, 0xD3, 0x35, 0x61, 0xB6, 0x8B, 0x6A, 0xCE, 0x37, 0x74, 0xE3, 0x71, 0x54, 0x9D, 0x17,
-    0xCD, 0x77, 0x10, 0x86, 0x51, 0x4B, 0x91, 0x02, 0x28, 0xB4, 0xA8, 0x24, 0x8A, 0x15, 0x61, 0x60,
-    0xB4, 0xDA, 0xAE, 0x96, 0x8C, 0x52, 0x10, 0x66, 0xBC, 0xA0, 0x82, 0xAB, 0x68, 0xB3, 0x8B, 0x56,
-    0x7C, 0x81, 0xB3, 0x91, 0x69, 0x1E, 0xA7, 0xEA, 0x13, 0xA7, 0x66, 0xC6, 0x69, 0x22, 0x63, 0x1E,
-    0x84, 0xCC, 0x20, 0x8B, 0xE1, 0xA0, 0xE3, 0x5A, 0x59, 0xE3, 0x95, 0x64, 0xEE, 0xC8, 0xC1, 0x9C,
-    0x42, 0x8D, 0x1C, 0x60, 0x8E, 0x24, 0x98, 0x56, 0x20, 0x44, 0x54, 0xCE, 0xB8, 0x7E, 0xC9, 0x65,
-    0x72, 0x40, 0xC6, 0x54, 0xCF, 0x6A, 0xD2, 0xC1, 0x6B, 0x66, 0xB5, 0x2E, 0xDE, 0xC5, 0xAB, 0xED,
-    0x6B, 0xCA, 0xC4, 0x28, 0xC0, 0x5B, 0xD1, 0x43, 0x19, 0x9A, 0xFC, 0x09, 0x33, 0x7D, 0xE6, 0x4E,
-    0x1E, 0x2E, 0x0F, 0xDD, 0x0D, 0xA3, 0x35, 0x1E, 0x91, 0xDA, 0x87, 0x82, 0x0F, 0xF6, 0xB6, 0x19,
-    0x22, 0x91, 0xC9, 0x41, 0xB0, 0xC5, 0x6A, 0x25, 0x07, 0x02, 0xB5, 0xF1, 0x5E, 0x07, 0x99, 0x1B,
-    0x6F, 0x51, 0xE0, 0x7C, 0x72, 0x80, 0xB2, 0xD0, 0x91, 0x42, 0x61, 0x5C, 0x56, 0x35, 0xCC, 0x46,
-    0xCA, 0xDC, 0x49, 0x57, 0xF4, 0xE6, 0xF3, 0x98, 0x60, 0x4E, 0x6F, 0xA0, 0x6C, 0x3E, 0x01, 0x83,
-    0x0A, 0x20, 0x22, 0xC3, 0xE2, 0x2A, 0x59, 0xC8, 0x3E, 0x80, 0xC8, 0xA8, 0x0B, 0x68, 0x13, 0x90,
-    0xE1, 0x1D, 0xC7, 0xA2, 0x4C, 0xEA, 0x6F, 0x77, 0x40, 0xB0, 0xE5, 0x5F, 0xBF, 0x21, 0xE7, 0xAD,
-    0x8B, 0x5B, 0x37, 0xFB, 0x9C, 0xF2, 0x4F, 0x44, 0x59, 0xFF, 0xD2, 0xE5, 0xA7, 0x62, 0xB1, 0x8C,
-    0xD2, 0x90, 0x9D, 0x0D, 0xCE, 0x18, 0xDE, 0x2E, 0x86, 0x55, 0xC8, 0x09, 0xEA, 0x4F, 0xD1, 0xC2,
-    0xFF, 0x14, 0x88, 0x5C, 0x73, 0xCA, 0xAC, 0x50, 0x75, 0x6A, 0x07, 0x37, 0x98, 0x8E, 0xD0, 0x70,
-    0x1C, 0x0C, 0x8F, 0xC3, 0xF2, 0x6C, 0x18, 0x4D, 0x61, 0x0E, 0x18, 0x4F, 0x20, 0x54, 0x97, 0x9A,
-    0x7A, 0x8B, 0x12, 0x88, 0xF3, 0xCF, 0x57, 0x75, 0xA5, 0xA6, 0xAE, 0x52, 0x53, 0x51, 0xA9, 0x55,
-    0x4B, 0xC9, 0xA8, 0xD2, 0xB6, 0x19, 0xF5, 0xD9, 0x16, 0xF4, 0x36, 0x51, 0x0B, 0xE2, 0x8B, 0x28,
-    0xB3, 0x67, 0x11, 0x58, 0xDA, 0x41, 0xBB, 0x87, 0x17, 0x6B, 0xDA, 0x3D, 0x79, 0x80, 0x57, 0xB7,
-    0x7B, 0x78, 0xDA, 0xB6, 0xDD, 0xA3, 0x7E, 0x25, 0x68, 0x2D, 0xAF, 0xD7, 0x66, 0x32, 0x73, 0xC2,
-    0xB2, 0x45, 0xCF, 0x46, 0x82, 0xC0, 0x5E, 0x52, 0x59, 0x7A, 0x64, 0x7E, 0x62, 0x19, 0x6A, 0x45,
-    0x17, 0x6A, 0xA1, 0xE1, 0x36, 0x40, 0x89, 0xA2, 0xF8, 0xDB, 0x5B, 0xA0, 0xE8, 0x47, 0x15, 0x90,
-    0x0C, 0x29, 0xA0, 0xE0, 0xA3, 0x35, 0x90, 0x2F, 0xD3, 0x99, 0x28, 0x07, 0x82, 0xED, 0xA4, 0xD5,
-    0x0E, 0x00, 0x3A, 0x50, 0x24, 0xCF, 0x7B, 0x28, 0xB8, 0x58, 0x2C, 0xAE, 0x71, 0x55, 0xEE, 0x1D,
-    0x5C, 0x2E, 0x97, 0x37, 0xCB, 0x47, 0x70, 0xE7, 0x41, 0xBA, 0xE6, 0xBA, 0x50, 0x50, 0x2C, 0x8D,
-    0xD4, 0x5A, 0x51, 0x58, 0xD3, 0x45, 0xEE, 0x15, 0xA5, 0x2C, 0xC9, 0xF2, 0x7D, 0xC5, 0xA1, 0x36,
-    0xAF, 0xC9, 0xDA, 0x64, 0x10, 0x61, 0xF8, 0x09, 0x67, 0xA4, 0x30, 0xA5, 0x9A, 0x9C, 0xB0, 0xC1,
-    0x62, 0x82, 0x32, 0x8B, 0xD2, 0x93, 0x90, 0x3B, 0xC5, 0x5E, 0x67, 0xEF, 0x42, 0xE9, 0xB3, 0xE5,
-    0x13, 0x64, 0x66, 0xD8, 0xE7, 0xCD, 0x6B, 0x3E, 0x5D, 0x94, 0x3A, 0x53, 0xC8, 0x1F, 0x8A, 0x3B,
-    0x37, 0x21, 0x9E, 0x46, 0x3D, 0xA7, 0xC4, 0x8C, 0x4C, 0x52, 0x8D, 0x19, 0x66, 0x22, 0x04, 0x3A,
-    0x52, 0x91, 0xA7, 0x52, 0x64, 0x7D, 0x32, 0x60, 0xFF, 0x21, 0x9B, 0x49, 0xB1, 0x08, 0x54, 0x7B,
-    0x91, 0x22, 0x5A, 0x56, 0x66, 0x56, 0xE7, 0x0D, 0x07, 0xE1, 0x4A, 0x05, 0x33, 0xFE, 0xBA, 0xCE,
-    0xEC, 0x5B, 0x14, 0x79, 0xB6, 0x78, 0x63, 0x90, 0xCE, 0x84, 0xB1, 0x67, 0xCB, 0x3F, 0x3B, 0x9F,
-    0x54, 0xB8, 0x0B, 0x8E, 0x59, 0xCD, 0xD2, 0xD1, 0x6A, 0xF6, 0x6F, 0xEE, 0xDF, 0x6A, 0x76, 0x4F,
-    0x68, 0xAD, 0x66, 0xF9, 0xFD, 0x5B, 0xCD, 0x0E, 0xAD, 0xD5, 0x8C, 0x5D, 0x99, 0x16, 0x13, 0xE8,
-    0x5A, 0x91, 0x99, 0x27, 0x03, 0x3E, 0x2D, 0xBA, 0xDB, 0xEE, 0x02, 0x7A, 0x14, 0xBD, 0x8E, 0xC1,
-    0xC9, 0xE1, 0xB0, 0xB5, 0x44, 0x97, 0x5E, 0xD8, 0xCF, 0x2E, 0xF4, 0xEB, 0x39, 0xD6, 0x8C, 0xA8,
-    0xE2, 0x32, 0xC2, 0xC6, 0x61, 0xE5, 0xD2, 0xC5, 0xAC, 0x95, 0xB7, 0xCE, 0xB4, 0x95, 0x23, 0x5A,
-    0xB9, 0xDF, 0xF4, 0x6F, 0xF6, 0x4C, 0x99, 0xD6, 0xB8, 0x8E, 0x77, 0x99, 0xD7, 0xF6, 0x9E, 0x33,
-    0x91, 0xF2, 0x2F, 0x0A, 0x17, 0xD5, 0xE7, 0xB9, 0xA7, 0x9B, 0x37, 0xD8, 0x96, 0x93, 0xDB, 0x49,
-    0xEB, 0x15, 0x68, 0x13, 0xE5, 0xE0, 0x14, 0x49, 0x1A, 0x56, 0x56, 0x90, 0xF4, 0x28, 0x45, 0x42,
-    0x1A, 0xEA, 0x69, 0xFF, 0x4C, 0x52, 0x10, 0x32, 0x2E, 0x41, 0xC2, 0x70, 0x53, 0x50, 0x52, 0x52,
-    0xAE, 0x51, 0x93, 0x54, 0x24, 0x5E, 0x46, 0xFA, 0x24, 0xEB, 0xE1, 0x1B, 0x4F, 0xE9, 0x76, 0xBB,
-    0xA1, 0x96, 0x58, 0x70, 0xE2, 0xE2, 0x0E, 0x49, 0x1A, 0xD3, 0xEE, 0x0D, 0x91, 0xB0, 0xC1, 0x6A,
-    0xEA, 0x53, 0x6E, 0x0D, 0xF8, 0x74, 0x88, 0x6F, 0x59, 0x8A, 0x21, 0xA0, 0x56, 0x28, 0x2A, 0x5C,
-    0x58, 0xFC, 0x54, 0x4B, 0x7D, 0x92, 0x11, 0x15, 0x87, 0x74, 0x17, 0x4D, 0x4C, 0xDD, 0x67, 0x20,
-    0xA8, 0xC8, 0x07, 0x09, 0x07, 0xEA, 0x79, 0x41, 0xAA, 0x43, 0x43, 0x06, 0x86, 0x10, 0xAD, 0x83,
-    0x01, 0xBC, 0x83, 0x2C, 0xD2, 0x79, 0x34, 0x0A, 0xBE, 0xD4, 0xEF, 0xAB, 0x06, 0x7C, 0x5F, 0x40,
-    0xAD, 0x9F, 0xB2, 0x66, 0x67, 0x2A, 0x1D, 0xFF, 0xC6, 0x1C, 0xA8, 0xAD, 0xB4, 0x3F, 0xE9, 0x40,
-    0x15, 0xC8, 0x03, 0x77, 0xD0, 0xFE, 0xA6, 0x1C, 0xD8, 0x17, 0x6C, 0x8E, 0x1F, 0x38, 0xF6, 0x75,
-    0x7F, 0x07, 0x19, 0xC4, 0x49, 0x59, 0xEC, 0xAA, 0x01, 0xAA, 0x77, 0xC4, 0x9A, 0xF6, 0xCF, 0x80,
-    0xB4, 0xDF, 0xCF, 0xB9, 0x1C, 0xD1, 0x61, 0x63, 0xE6, 0x77, 0x96, 0x3D, 0x3D, 0x14, 0xB2, 0x78,
-    0x09, 0x9C, 0x11, 0xCA, 0x30, 0x1C, 0x61, 0x71, 0xF4, 0x1B, 0x11, 0x94, 0xE6, 0xB4, 0xCD, 0x0B,
-    0x8C, 0xB7, 0xBC, 0xCF, 0x86, 0x30, 0x05, 0x7C, 0x5F, 0x19, 0x9B, 0x4A, 0x64, 0x0F, 0x83, 0x16,
-    0x97, 0x89, 0x20, 0x13, 0x11, 0x35, 0x40, 0xCB, 0x9B, 0xBD, 0x9E, 0x52, 0x94, 0x44, 0xF1, 0x9A,
-    0x28, 0xDC, 0x4C, 0x91, 0x2C, 0x3C, 0x13, 0x64, 0xBF, 0x8C, 0xF4, 0xCC, 0x84, 0xD7, 0x89, 0xFC,
-    0xC5, 0x7B, 0x76, 0x7A, 0xEB, 0x2D, 0x51, 0x97, 0xBA, 0xA7, 0xDF, 0x1F, 0x40, 0x43, 0x9D, 0xA5,
-    0x4A, 0xD6, 0x01, 0x34, 0xD1, 0x59, 0xAA, 0xE2, 0x13, 0xC4, 0xA0, 0x23, 0xB2, 0x10, 0x38, 0xAC,
-    0x47, 0x56, 0xD5, 0x39, 0x61, 0xAA, 0x73, 0x26, 0x6F, 0x6A, 0xDC, 0x50, 0xB9, 0x5B, 0xB5, 0x03,
-    0xE4, 0xE6, 0xF3, 0xA9, 0x57, 0x70, 0x7D, 0x8C, 0xC8, 0xF4, 0x7D, 0x8E, 0x0B, 0xAF, 0x9B, 0x8A,
-    0x28, 0xE9, 0x31, 0x11, 0xA5, 0xDC, 0xF1, 0x05, 0xBE, 0xBE, 0x5C, 0x16, 0xE5, 0x28, 0x08, 0x4D,
-    0xC5, 0xA1, 0x64, 0x22, 0x0E, 0x75, 0xE3, 0xFD, 0x85, 0xA9, 0x7D, 0x41, 0xBE, 0xAE, 0x4C, 0x02,
-    0x4D, 0xDC, 0xB6, 0x47, 0xFD, 0x6E, 0x2A, 0xAB, 0xEE, 0xAC, 0xC4, 0x05, 0xDA, 0x9C, 0x71, 0xF5,
-    0x53, 0x15, 0x2E, 0x53, 0x99, 0x4C, 0x16, 0x24, 0x0A, 0xE0, 0x19, 0x65, 0xB2, 0x08, 0x0B, 0x27,
-    0xB4, 0xFC, 0x79, 0x6D, 0xD5, 0x45, 0xEA, 0x72, 0x91, 0x0A, 0xE2, 0xAA, 0x3A, 0x52, 0x14, 0x67,
-    0xCB, 0x0A, 0x1C, 0xA4, 0x7A, 0xB0, 0x80, 0x2A, 0x0D, 0x69, 0x5B, 0x39, 0x3B, 0x0F, 0xAC, 0xFC,
-    0xBD, 0x1C, 0x04, 0xF1, 0x24, 0x9D, 0x1E, 0x14, 0xD3, 0xFB, 0x0C, 0x77, 0x1E, 0x9E, 0x85, 0xA7,
-    0xCF, 0x1A, 0xB5, 0xE3, 0x68, 0x7B, 0xFC, 0xC6, 0xB6, 0xD0, 0x53, 0x41, 0x1D, 0x6F, 0x41, 0x51,
-    0x3D, 0xA3, 0xB0, 0xAE, 0x36, 0x2C, 0x4F, 0x29, 0x80, 0x0E, 0x20, 0x11, 0xBC, 0x1B, 0xF2, 0xC2,
-    0x31, 0xFE, 0x0A, 0x23, 0x9B, 0xDF, 0x5F, 0x16, 0x05, 0x1D, 0x76, 0x36, 0xDC, 0x1E, 0xF2, 0x82,
-    0x80, 0xD2, 0x01, 0x9A, 0xC7, 0xF8, 0x07, 0xD0, 0xA0, 0xF5, 0xA5, 0xCB, 0xF5, 0x32, 0xBD, 0x01,
-    0xDD, 0x6B, 0xB2, 0x22, 0xB7, 0x90, 0x89, 0xA8, 0x43, 0xB4, 0x78, 0x81, 0x96, 0xB2, 0x96, 0xB4,
-    0x59, 0xAE, 0x68, 0x70, 0x2D, 0x2C, 0x6F, 0x90, 0x97, 0x5A, 0xF4, 0x74, 0x5B, 0xD0, 0xBC, 0xE6,
-    0x2D, 0xD8, 0xB4, 0x8D, 0x76, 0xC0, 0xFC, 0xF0, 0x15, 0x91, 0x7C, 0xEC, 0xB0, 0x48, 0x46, 0x57,
-    0x6C, 0xA9, 0x47, 0xD2, 0x8B, 0x25, 0x6C, 0x82, 0x65, 0xD0, 0x5F, 0xBF, 0x56, 0xC6, 0x1B, 0x48,
-    0x07, 0x39, 0x80, 0x15, 0xD2, 0x13, 0x08, 0x0B, 0x99, 0x7C, 0xE7, 0xF5, 0x65, 0x7C, 0xFB, 0xB5,
-    0x9F, 0x95, 0x61, 0xDF, 0xFF, 0x91, 0x5C, 0x51, 0x07, 0xA5, 0xB9, 0xA4, 0xC3, 0xF4, 0x85, 0xBF,
-    0x82, 0x98, 0x5B, 0x61, 0xEE, 0x0B, 0x3F, 0xE8, 0x3F, 0x14, 0x82, 0x6D, 0xEC, 0x98, 0x54, 0x53,
-    0xCE, 0xC6, 0xA9, 0x66, 0x61, 0xF9, 0xFA, 0xBE, 0x89, 0xDE, 0x96, 0x81, 0x1E, 0x4B, 0x9F, 0x95,
-    0x89, 0x74, 0x42, 0x95, 0x88, 0xD2, 0xBE, 0x15, 0x79, 0xC5, 0x6F, 0xE4, 0x15, 0xBC, 0x86, 0xEF,
-    0xC1, 0xE5, 0x74, 0x04, 0x71, 0xAE, 0x62, 0x17, 0x49, 0x87, 0xD8, 0x07, 0x39, 0x59, 0xDE, 0x7C,
-    0xBE, 0x15, 0x1A, 0x44, 0x95, 0xD7, 0x5F, 0x57, 0x89, 0x0B, 0x23, 0x6E, 0x6B, 0x05, 0x2A, 0x8A,
-    0x3F, 0x18, 0x1F, 0x94, 0xC0, 0xFA, 0xE5, 0xCD, 0x06, 0x84, 0xE9, 0x20, 0xA7, 0x16, 0x03, 0xE8,
-    0xD4, 0xFA, 0x48, 0xF6, 0xC5, 0xC9, 0x45, 0xB3, 0x81, 0x7C, 0xD7, 0xA9, 0x91, 0x92, 0x06, 0x4B,
-    0x07, 0x32, 0x01, 0xA2, 0x12, 0xF7, 0xCB, 0xA2, 0xB5, 0x37, 0x75, 0xD3, 0x14, 0x97, 0xF2, 0xB3,
-    0x5C, 0xE2, 0x44, 0xF3, 0xB0, 0x1F, 0xFB, 0x13, 0x72, 0x98, 0xE9, 0x60, 0x8B, 0x6E, 0x2D, 0x5B,
-    0xCA, 0x5F, 0x47, 0x60, 0x9C, 0x1E, 0x85, 0x89, 0x39, 0x0A, 0x33, 0xC2, 0x15, 0x21, 0xFF, 0xC3,
-    0xAC, 0xDF, 0x5A, 0x63, 0x2F, 0xD7, 0xA2, 0x6D, 0x31, 0x81, 0x2B, 0x76, 0xDB, 0x69, 0xF0, 0x79,
-    0xEB, 0xB7, 0x5A, 0x38, 0xC7, 0x3D, 0xC7, 0x69, 0xF7, 0xB5, 0x1E, 0x53, 0x59, 0x58, 0xEB, 0x5A,
-    0x86, 0xAA, 0xF4, 0x54, 0xB8, 0x91, 0x8E, 0x0B, 0x2A, 0xD8, 0x97, 0x2A, 0xF0, 0x2D, 0x0B, 0x44,
-    0xD5, 0x7F, 0x87, 0xF3, 0x31, 0xD9, 0x1D, 0x8C, 0x94, 0xFB, 0x31, 0x55, 0xF2, 0x59, 0xFF, 0x97,
-    0x37, 0xC9, 0xA7, 0x4A, 0xE9, 0x4C, 0xD0, 0xF7, 0xD2, 0xE8, 0xFD, 0x53, 0xF9, 0xBB, 0x85, 0x70,
-    0x0A, 0xC1, 0x1D, 0xAB, 0x0F, 0x67, 0x2C, 0x0D, 0x2F, 0x6A, 0x67, 0xD6, 0x59, 0x9E, 0x59, 0x55,
-    0x3C, 0xC9, 0x33, 0xAE, 0x9B, 0xC2, 0x66, 0xA1, 0x94, 0xC8, 0x52, 0xD7, 0xDF, 0xA0, 0xA9, 0xB1,
-    0xD7, 0x89, 0xEB, 0x3C, 0xE5, 0xC2, 0x8B, 0xA1, 0x96, 0x63, 0xC0, 0x7B, 0xB4, 0x4C, 0x89, 0x16,
-    0xDB, 0x8F, 0xDC, 0x87, 0x9C, 0x41, 0xDA, 0x49, 0x8B, 0x93, 0x34, 0x95, 0xD6, 0x2F, 0x21, 0x5F,
-    0xAC, 0x9A, 0x83, 0xB5, 0x4D, 0xC9, 0x05, 0xB2, 0x0E, 0xC4, 0x2A, 0x74, 0x6E, 0x92, 0xEB, 0xD7,
-    0xB6, 0xCF, 0xA1, 0x65, 0x34, 0x8A, 0xE1, 0x83, 0xE3, 0x40, 0x14, 0x84, 0x3E, 0xF7, 0x85, 0x64,
-    0x33, 0xB6, 0x00, 0xAF, 0xEC, 0x35, 0xB6, 0xDB, 0x69, 0x0D, 0x4F, 0x65, 0x68, 0xAF, 0xAE, 0x5F,
-    0xAB, 0x85, 0x02, 0x9B, 0x6B, 0x20, 0x80, 0x7B, 0x7F, 0x74, 0x64, 0x09, 0x33, 0x6A, 0x89, 0x8B,
-    0x4B, 0x70, 0x08, 0x01, 0xC1, 0xCF, 0x04, 0x44, 0x7F, 0x23, 0x20, 0x09, 0x05, 0xEC, 0x01, 0x34,
-    0x02, 0x66, 0x5B, 0x01, 0x70, 0xEF, 0x08, 0x9F, 0x11, 0x10, 0xE5, 0x02, 0x12, 0x98, 0x8A, 0x56,
-    0x00, 0x58, 0x48, 0xB9, 0xE4, 0x49, 0x07, 0x0A, 0x28, 0x01, 0x72, 0x01, 0xFE, 0xC6, 0x13, 0x35,
-    0xA0, 0x82, 0xDB, 0x1E, 0xF3, 0x4B, 0xBA, 0x01, 0xFA, 0x46, 0x77, 0xCC, 0x07, 0xFB, 0x38, 0xDA,
-    0xE2, 0x1E, 0xB4, 0xD2, 0x01, 0xCB, 0xF1, 0xDA, 0x82, 0xF4, 0x2D, 0xE8, 0x4E, 0x4B, 0x4D, 0x0B,
-    0x92, 0xB5, 0xA0, 0x2D, 0xBB, 0xB5, 0xD7, 0xE1, 0x08, 0x21, 0x85, 0xBC, 0x91, 0x7F, 0x55, 0xDD,
-    0x34, 0x29, 0xDD, 0xB5, 0x01, 0xB8, 0xA9, 0xDF, 0xB8, 0xD9, 0x6F, 0x17, 0x4B, 0x63, 0xAD, 0xDA,
-    0x04, 0xCB, 0x1B, 0x8D, 0xFA, 0xBE, 0x4E, 0x02, 0x7B, 0x27, 0x80, 0x83, 0x01, 0x34, 0x0E, 0xD0,
-    0x01, 0x20, 0xAF, 0x25, 0x00, 0xC4, 0x94, 0x37, 0xF2, 0x9A, 0x09, 0x01, 0x41, 0xD7, 0xB0, 0xC6,
-    0x08, 0x88, 0x6A, 0x34, 0x38, 0x21, 0xCC, 0xEA, 0x0E, 0x3E, 0x84, 0xBA, 0x45, 0xEB, 0xEB, 0xF6,
-    0xC0, 0xCC, 0x6E, 0xD7, 0x42, 0x29, 0xFF, 0x57, 0x02, 0xD3, 0xF9, 0xCF, 0x6B, 0x90, 0xEE, 0x87,
-    0x75, 0x1B, 0x96, 0xD1, 0xB7, 0xEA, 0x36, 0x58, 0xC7, 0x5F, 0xA9, 0x85, 0xAC, 0x89, 0x27, 0x70,
-    0x7B, 0x20, 0xD0, 0xAB, 0x1B, 0x81, 0x72, 0x3D, 0x60, 0x51, 0x01, 0x26, 0x1B, 0xC0, 0x78, 0x0D,
-    0x18, 0x95, 0x5E, 0xED, 0x88, 0x1A, 0x95, 0xE7, 0x00, 0x3D, 0xC4, 0x04, 0xDA, 0x9D, 0x08, 0xBA,
-    0x73, 0x5E, 0xD6, 0xEA, 0xDA, 0xA2, 0x0C, 0xA2, 0x26, 0x77, 0x94, 0xF1, 0xB1, 0x28, 0x4A, 0x61,
-    0x10, 0x11, 0x0C, 0x02, 0xF3, 0x2D, 0xFC, 0xFF, 0x4D, 0x92, 0x5B, 0x5F, 0x64, 0x7B, 0x22, 0xC8,
-    0x75, 0x4D, 0xF3, 0x1A, 0xD8, 0x5D, 0x1B, 0x5E, 0x06, 0x6B, 0x9D, 0x4C, 0xA0, 0xEB, 0x2A, 0xC8,
-    0x9C, 0xC0, 0xED, 0xC9, 0x86, 0xC9, 0x87, 0x8B, 0x9C, 0x06, 0x89, 0x47, 0x0D, 0xF8, 0x5A, 0x0D,
-    0xF8, 0x5E, 0x53, 0xC8, 0x50, 0xE9, 0xDA, 0x57, 0x65, 0x41, 0x58, 0x9B, 0x22, 0x97, 0x85, 0x26,
-    0x2E, 0x7B, 0x70, 0x9A, 0x0E, 0xEC, 0xA4, 0xC3, 0x54, 0x27, 0xA0, 0x77, 0xAC, 0xB3, 0xC0, 0x7E,
-    0x87, 0xF3, 0x36, 0x3D, 0x04, 0x52, 0xC8, 0x52, 0x18, 0xF8, 0x72, 0x83, 0xEE, 0x6A, 0x2F, 0xEB,
-    0xB7, 0xDC, 0xB4, 0xC5, 0xED, 0x5B, 0x58, 0x38, 0xDA, 0x21, 0x10, 0xE2, 0xDE, 0x40, 0x5A, 0x95,
-    0x0A, 0xAD, 0xE1, 0x42, 0xEB, 0x84, 0x3C, 0x6F, 0xCD, 0x6B, 0x75, 0xC2, 0xA0, 0x1B, 0x12, 0xEB,
-    0x3F, 0xE6, 0xC7, 0x46, 0x57, 0x0C, 0xBF, 0xE7, 0xCA, 0x7E, 0xE9, 0xBF, 0x65, 0x50, 0xCD, 0xF5,
-    0xFF, 0x22, 0xF7, 0x68, 0x79, 0x2F, 0x47, 0xD7, 0xCC, 0x99, 0x1F, 0xCB, 0xD7, 0x6F, 0x74, 0xCB,
-    0xFC, 0xA8, 0x9B, 0xE6, 0xD1, 0x00, 0xF6, 0x9F, 0xF5, 0x98, 0xFA, 0x5B, 0x69, 0x17, 0x1D, 0xC9,
-    0x22, 0xB7, 0xAF, 0xD5, 0xBD, 0x4C, 0x4F, 0x73, 0x02, 0xA7, 0x73, 0x02, 0x5E, 0x5A, 0x40, 0x1D,
-    0xC2, 0x0C, 0xC6, 0xA4, 0xCA, 0xE8, 0xA9, 0xFA, 0x2A, 0xFC, 0x71, 0x7F, 0x0A, 0x77, 0xF4, 0x8F,
-    0x61, 0xAB, 0xFA, 0x19, 0xCC, 0x56, 0xBF, 0x84, 0x2F, 0x1A, 0x22, 0xE2, 0xAC, 0x1F, 0xE4, 0xD9,
-    0xD6, 0x58, 0x8E, 0xAB, 0x0B, 0xC2, 0x10, 0x55, 0x06, 0x67, 0x47, 0x81, 0x73, 0x11, 0xF0, 0xA2,
-    0x46, 0x7A, 0x39, 0xF1, 0x1D, 0x8D, 0x8D, 0xD9, 0xDE, 0x27, 0x7A, 0xF1, 0xD0, 0xC6, 0x61, 0xD5,
-    0xC6, 0x89, 0xED, 0x5E, 0xFF, 0x7F, 0x0E, 0x45, 0x7E, 0xF6, 0x85, 0x1B, 0x06, 0xB0, 0x05, 0xCF,
-    0xB6, 0x33, 0x48, 0x75, 0x33, 0x11, 0x23, 0xA4, 0x0F, 0x04, 0xC1, 0xDA, 0x22, 0x28, 0xC9, 0x93,
-    0x74, 0x44, 0xB0, 0xF5, 0x8C, 0x48, 0x44, 0x31, 0x3D, 0x85, 0x17, 0x24, 0x29, 0x2F, 0x2F, 0x78,
-    0x33, 0x91, 0x6C, 0xE6, 0x7A, 0x6B, 0xAF, 0xFF, 0x29, 0x1E, 0xE4, 0x9C, 0x85, 0x73, 0x8D, 0x07,
-    0x92, 0x26, 0xA5, 0x0F, 0xF4, 0x2A, 0x43, 0xF7, 0x80, 0x87, 0xD2, 0x9E, 0x17, 0xAD, 0x03, 0xF6,
-    0x05, 0xBB, 0x41, 0x7B, 0xE0, 0xAB, 0xF2, 0x9E, 0xF1, 0x8F, 0x41, 0x7C, 0x7D, 0x24, 0x48, 0xAE,
-    0x26, 0x3B, 0x5A, 0xE0, 0xE0, 0x04, 0xFB, 0x19, 0xFC, 0x9F, 0xE8, 0x9F, 0x5E, 0x7D, 0xA3, 0x1D,
-    0x3D, 0x49, 0xB0, 0x75, 0xC5, 0x25, 0xBA, 0xBA, 0x12, 0x46, 0x6C, 0x83, 0x96, 0x3A, 0x8C, 0xCC,
-    0x47, 0x0D, 0xC0, 0x18, 0x3E, 0x64, 0x98, 0x96, 0xC6, 0x6A, 0x19, 0x4A, 0x44, 0x27, 0x83, 0xE7,
-    0x5D, 0x33, 0xA2, 0xF2, 0x54, 0xB0, 0x1A, 0x00, 0x43, 0xB6, 0x84, 0x38, 0xF2, 0x1E, 0xDD, 0x0D,
-    0x88, 0xD1, 0x42, 0x77, 0xAF, 0xE8, 0x5E, 0x1B, 0x84, 0xEC, 0x7B, 0x03, 0x3B, 0x28, 0xF1, 0xFF,
-    0x71, 0x23, 0xB5, 0x42, 0x1C, 0x41, 0x66, 0xA7, 0x4D, 0xCD, 0xA7, 0x8E, 0xAD, 0xAD, 0xE4, 0x1D,
-    0x8B, 0xB7, 0x0E, 0x9B, 0x9D, 0xE1, 0x79, 0x16, 0x76, 0xA1, 0x56, 0x19, 0xE5, 0x3E, 0x85, 0xAF,
-    0xDF, 0x5C, 0x1B, 0xE7, 0xA9, 0x3E, 0x09, 0xDE, 0x59, 0xA6, 0x14, 0xC2, 0x6B, 0x42, 0x19, 0xD4,
-    0xE1, 0x1A, 0xDA, 0x2B, 0x45, 0x5C, 0xC0, 0x90, 0xC1, 0x97, 0x1A, 0x82, 0xA9, 0xC7, 0xFA, 0x5F,
-    0x58, 0x49, 0x48, 0x55, 0x51, 0x05, 0xF8, 0xD0, 0xFA, 0x74, 0x2C, 0xF3, 0xF1, 0xB7, 0xE7, 0x81,
-    0x7D, 0xFF, 0x2E, 0x61, 0xBF, 0x26, 0xDC, 0xE2, 0xFB, 0x79, 0x03, 0xE8, 0xB5, 0x3C, 0xA7, 0x3B,
-    0x0A, 0xF5, 0x7B, 0x9C, 0xA3, 0xE7, 0xBB, 0x6B, 0x0F, 0x2D, 0x0D, 0xEE, 0xA5, 0x70, 0xF4, 0xCB,
-    0x77, 0x8D, 0x5D, 0xE7, 0xB7, 0x9D, 0x09, 0x1A, 0xDC, 0x0D, 0xF7, 0x85, 0xF8, 0x65, 0x71, 0x8B,
-    0x7B, 0xF7, 0x4B, 0xD2, 0x7F, 0x4D, 0xEB, 0x91, 0xAC, 0x39, 0xB1, 0xD0, 0x46, 0xD8, 0x5B, 0xFA,
-    0xF2, 0x02, 0xAE, 0x2C, 0x08, 0xF1, 0xFE, 0x8E, 0x40, 0x7B, 0x71, 0xB9, 0x84, 0x29, 0x94, 0x1F,
-    0x3B, 0xB9, 0x34, 0xE4, 0x43, 0x63, 0xAD, 0xE9, 0x09, 0xDB, 0x7B, 0x85, 0x81, 0x31, 0x29, 0xEE,
-    0x45, 0xA1, 0x41, 0x2D, 0x0A, 0xD0, 0xB5, 0x7A, 0x88, 0x78, 0x01, 0x24, 0x3A, 0x91, 0x61, 0x6E,
-    0x5F, 0x6D, 0x54, 0x05, 0xEE, 0x54, 0xA8, 0x83, 0x76, 0xA6, 0x0B, 0xB3, 0x47, 0xAF, 0x03, 0xE5,
-    0x40, 0x11, 0x5A, 0x6E, 0x28, 0xC2, 0xDD, 0x06, 0xD4, 0xE9, 0xDF, 0x78, 0xA6, 0x45, 0x72, 0x81,
-    0x53, 0xEF, 0xEC, 0xCD, 0x44, 0xC3, 0xC5, 0xAD, 0xA3, 0xC3, 0xD7, 0xF0, 0xA0, 0xB9, 0x3E, 0x56,
-    0xD7, 0x04, 0xA7, 0xDF, 0xE3, 0xE7, 0x9A, 0xBC, 0x3F, 0xF4, 0xE5, 0x75, 0x20, 0x4A, 0xE5, 0x9A,
-    0xFD, 0x0E, 0xFE, 0x75, 0x14, 0xF0, 0x0F, 0x41, 0x77, 0xFD, 0x35, 0x3D, 0x99, 0x97, 0xC1, 0x02,
-    0xB5, 0x96, 0xE7, 0x08, 0xE8, 0x0D, 0x02, 0xF8, 0x11, 0x74, 0xB5, 0xC5, 0xC9, 0x95, 0xBB, 0x2C,
-    0xC3, 0x28, 0x33, 0x5F, 0xCC, 0x9D, 0x17, 0x84, 0x2C, 0x51, 0x45, 0x47, 0x86, 0x70, 0xC5, 0xA4,
-    0xCF, 0x20, 0x47, 0x3E, 0x7E, 0x2D, 0x2C, 0x31, 0x88, 0x77, 0xA1, 0xA3, 0x1F, 0xCD, 0xFA, 0x6D,
-    0xF3, 0xCE, 0x8E, 0x23, 0xE6, 0x71, 0x36, 0xC8, 0x7B, 0x97, 0x31, 0x96, 0xF5, 0x08, 0x5F, 0x3D,
-    0x94, 0x41, 0xA9, 0xEA, 0xBC, 0x85, 0xFA, 0xCD, 0xF4, 0x9C, 0x59, 0x7D, 0xF1, 0xFB, 0x80, 0x85,
-    0xFC, 0x79, 0x76, 0x07, 0x03, 0x64, 0xD6, 0xBF, 0x3F, 0x6F, 0xE9, 0x90, 0xED, 0xB8, 0x6C, 0x69,
-    0x1C, 0x43, 0xE2, 0x60, 0xFD, 0x68, 0xE0, 0x18, 0xDA, 0x7A, 0x1C, 0x66, 0x83, 0x0D, 0xCF, 0xEF,
-    0x35, 0x38, 0x7E, 0x6B, 0xDD, 0x88, 0xC6, 0x2C, 0x35, 0x8C, 0x14, 0x93, 0x18, 0x7C, 0x09, 0xA6,
-    0x90, 0x97, 0x77, 0x72, 0x4F, 0x3E, 0x01, 0xF3, 0xC3, 0x1F, 0x0F, 0xE2, 0xA4, 0x88, 0x84, 0x7F,
-    0x12, 0x9C, 0x24, 0x4E, 0xDE, 0x92, 0x1E, 0xD3, 0xFE, 0xAB, 0x06, 0x91, 0xF2, 0x2C, 0x71, 0xF2,
-    0xC2, 0x15, 0xA8, 0xBD, 0x9B, 0x10, 0xD7, 0x7C, 0x70, 0xB5, 0x72, 0xC1, 0xDA, 0x99, 0xED, 0xF3,
-    0x18, 0xB1, 0x27, 0x14, 0x95, 0x68, 0x5C, 0x2C, 0x69, 0x70, 0xE4, 0x9D, 0xD0, 0x13, 0x1E, 0x3F,
-    0x5F, 0x17, 0xAE, 0x51, 0x5C, 0xBF, 0x56, 0xC9, 0x48, 0x58, 0x47, 0x60, 0x2A, 0x32, 0x0E, 0x9E,
-    0x85, 0xB4, 0x24, 0xA2, 0xD1, 0x67, 0xDD, 0x10, 0x4D, 0xCF, 0xF7, 0xEF, 0xB7, 0xE5, 0xC2, 0x28,
-    0x4F, 0xAE, 0x95, 0x02, 0x3F, 0x3B, 0xCE, 0x29, 0x90, 0xFA, 0x81, 0xFF, 0x9B, 0x59, 0xCE, 0xB5,
-    0x80, 0x46, 0x82, 0xD9, 0x44, 0x69, 0x1E, 0x56, 0x87, 0x87, 0xFF, 0x2F, 0xD2, 0x60, 0x9F, 0x27,
-    0x22, 0x36, 0xD6, 0xE3, 0xED, 0x13, 0xBB, 0x22, 0x0E, 0x78, 0x79, 0x43, 0xB1, 0xE5, 0xFE, 0xF7,
-    0xC0, 0xFD, 0x9D, 0x7D, 0xF4, 0x83, 0x4F, 0x87, 0xA5, 0xE2, 0x12, 0x58, 0xC4, 0xCE, 0x4A, 0xB1,
-    0x30, 0xA1, 0x03, 0xFB, 0x7E, 0x8A, 0x6B, 0xD3, 0xD8, 0xDF, 0x1B, 0xFD, 0xFB, 0x8C, 0x38, 0xAA,
-    0xE4, 0xE1, 0x3E, 0x84, 0x20, 0xE1, 0x9D, 0xBC, 0x9F, 0xF4, 0x26, 0x03, 0xF4, 0x8F, 0xFE, 0x74,
-    0x76, 0x96, 0x3F, 0x28, 0x56, 0x19, 0x60, 0xDF, 0x38, 0x3F, 0x0A, 0x34, 0xBE, 0x5B, 0x37, 0x7A,
-    0xFB, 0xF7, 0x22, 0x55, 0x6C, 0x45, 0x3F, 0x99, 0x33, 0xBB, 0xBF, 0x27, 0xFA, 0x77, 0x4F, 0xCF,
-    0x47, 0x88, 0x7B, 0x67, 0x29, 0x47, 0xDC, 0x9D, 0xC2, 0x5A, 0x2E, 0x1B, 0xB5, 0xFB, 0x59, 0xA8,
-    0xDF, 0x9C, 0xC4, 0x5A, 0x32, 0xCB, 0x5A, 0x9A, 0x09, 0x6B, 0xE9, 0x4F, 0x63, 0x2D, 0xE9, 0xC3,
-    0x43, 0x63, 0x9E, 0x7D, 0xC7, 0xD9, 0xFA, 0x0B, 0xE7, 0x2B, 0x62, 0x88, 0xF9, 0x1C, 0x92, 0x8C,
-    0x67, 0x8E, 0xD8, 0x6E, 0x3E, 0x79, 0x93, 0xCA, 0x72, 0xF0, 0x43, 0x90, 0x8F, 0xD3, 0x3D, 0x35,
-    0xE3, 0x80, 0x7B, 0xCF, 0xEC, 0x32, 0xAF, 0xC7, 0x64, 0x4C, 0xFA, 0x81, 0x79, 0xCB, 0xA8, 0xC0,
-    0xC0, 0xB5, 0x0B, 0xD6, 0x6A, 0x59, 0xE2, 0xD1, 0xB6, 0xE7, 0xA6, 0x6D, 0x79, 0x02, 0x75, 0x50,
-    0x63, 0x63, 0x2B, 0x1E, 0x35, 0x98, 0x98, 0x4B, 0xA8, 0xA0, 0x72, 0xBC, 0x9C, 0x04, 0x3C, 0xB5,
-    0x16, 0xE8, 0x02, 0x94, 0x30, 0xE4, 0xED, 0xC4, 0x03, 0x21, 0x16, 0x48, 0x3B, 0x1C, 0x30, 0xEE,
-    0x51, 0x25, 0x2E, 0x1B, 0x0A, 0x2C, 0x07, 0x1B, 0x2E, 0x73, 0x31, 0x0E, 0x40, 0x90, 0x38, 0x87,
-    0xF9, 0xB6, 0x47, 0x7B, 0x90, 0x25, 0x25, 0xEF, 0x9E, 0xA4, 0xF2, 0xA0, 0xB0, 0xCF, 0xD5, 0xC2,
-    0x1B, 0x0A, 0xF9, 0x0A, 0xDC, 0x2D, 0xFE, 0x8B, 0x52, 0xC7, 0x5E, 0xF2, 0x47, 0x6B, 0x1D, 0x68,
-    0x59, 0x50, 0x31, 0x3C, 0xDD, 0xAC, 0xE6, 0x95, 0x4E, 0x83, 0xC6, 0xAF, 0xD1, 0xC8, 0xE4, 0x5B,
-    0xCD, 0xAC, 0x61, 0x2C, 0xFB, 0x7F, 0xDF, 0x22, 0x40, 0x52, 0x9A, 0xF4, 0x8B, 0xCA, 0x14, 0xB0,
-    0x28, 0xCE, 0x3F, 0x96, 0x1E, 0xBC, 0x56, 0x6A, 0x14, 0x49, 0xAC, 0xBD, 0x22, 0x5D, 0xCC, 0x9E,
-    0x91, 0x47, 0x06, 0xAD, 0x1D, 0xB6, 0x7E, 0x6D, 0x8E, 0xFF, 0x64, 0xFC, 0x1F, 0xE7, 0xC9, 0x0E,
-    0xC6, 0x42, 0x82, 0x55, 0x5C, 0x31, 0x0E, 0x63, 0x30, 0x18, 0x75, 0x2E, 0x31, 0x2A, 0x21, 0x84,
-    0x6A, 0x28, 0x73, 0x8E, 0x89, 0x5A, 0x98, 0x2E, 0x1B, 0x93, 0xAD, 0x3D, 0xFA, 0x4E, 0xFB, 0x0D,
-    0x02, 0x70, 0xB7, 0xDE, 0xDD, 0x0A, 0x99, 0x8E, 0xB5, 0xFF, 0xEB, 0x2D, 0xDA, 0xDD, 0xCC, 0xFF,
-    0x67, 0x83, 0x18, 0xEA, 0x55, 0x58, 0x22, 0xBD, 0x53, 0x16, 0xA9, 0x74, 0x85, 0x65, 0x3F, 0xCE,
-    0x4C, 0xC2, 0x20, 0x37, 0x99, 0xAE, 0xAD, 0x06, 0x1B, 0x69, 0x2A, 0xDD, 0xD6, 0xA6, 0xC8, 0x9D,
-    0xAC, 0xC8, 0xEC, 0x64, 0x01, 0xAA, 0x51, 0xE0, 0x54, 0x95, 0xE7, 0x83, 0x85, 0xFA, 0x1D, 0x0E,
-    0x55, 0xE5, 0xC9, 0xA1, 0x04, 0xF5, 0x15, 0xD7, 0x1D, 0x0D, 0x98, 0x84, 0xC8, 0x8A, 0x4E, 0xD5,
-    0x1E, 0x1D, 0xA0, 0x47, 0x48, 0x81, 0x16, 0xEE, 0x33, 0x2C, 0x52, 0x15, 0xEF, 0xB0, 0x76, 0xAA,
-    0xD3, 0x64, 0x15, 0x38, 0x25, 0xF4, 0x88, 0x69, 0x4D, 0x16, 0xBE, 0x5E, 0x2C, 0xDF, 0x39, 0x3B,
-    0x54, 0xA9, 0xEF, 0xF6, 0x35, 0x2E, 0x5B, 0xAD, 0x1D, 0xF4, 0x0E, 0x64, 0xEB, 0x31, 0x3E, 0x35,
-    0xA8, 0xAC, 0x17, 0x7E, 0x27, 0x62, 0x75, 0x79, 0xA3, 0xCF, 0xC7, 0xAB, 0x36, 0x3B, 0x9E, 0xCB,
-    0xB9, 0x30, 0x7F, 0x9B, 0x62, 0xC5, 0x8C, 0x80, 0x5E, 0x71, 0xD4, 0x9A, 0x8B, 0x0C, 0xBA, 0x5D,
-    0xEB, 0x79, 0xD6, 0xED, 0xA8, 0x5E, 0xD7, 0xCC, 0xFA, 0x48, 0x33, 0x3B, 0x6C, 0x32, 0xEB, 0x69,
-    0xCF, 0xAC, 0x57, 0x3E, 0x5B, 0xBC, 0x76, 0x7B, 0x21, 0x4B, 0x45, 0xB6, 0x93, 0x2E, 0xB6, 0x85,
-    0x9B, 0x58, 0xBF, 0xB7, 0x51, 0x4F, 0xC3, 0xF9, 0x03, 0x56, 0x7B, 0xC8, 0x78, 0x7F, 0x4D, 0x27,
-    0x52, 0x57, 0x83, 0x51, 0x0F, 0xB3, 0xE2, 0x44, 0x1E, 0x7C, 0x19, 0x2F, 0xD9, 0xDF, 0x2A, 0xD6,
-    0x99, 0xC6, 0xF8, 0x33, 0x9D, 0x2C, 0xD6, 0xE4, 0x1C, 0x2A, 0x6B, 0x8A, 0xE0, 0x27, 0xEA, 0x1B,
-    0x86, 0x63, 0x37, 0x60, 0xB5, 0xD7, 0xDF, 0x6B, 0x19, 0x7B, 0xA5, 0x61, 0x8A, 0x54, 0xB0, 0x74,
-    0x25, 0x00, 0xA4, 0x6A, 0x28, 0x6B, 0xEB, 0x3E, 0x9B, 0xBC, 0x51, 0xD8, 0xD9, 0xE8, 0xFD, 0xC4,
-    0x4C, 0xCE, 0xCC, 0xC7, 0x3B, 0xC8, 0xDD, 0x9E, 0xC1, 0x9D, 0xBF, 0x7B, 0xC0, 0xA7, 0xB4, 0xAD,
-    0xB5, 0x03, 0xAB, 0x72, 0xA0, 0xAB, 0x00, 0x63, 0x30, 0x75, 0x28, 0xAB, 0xA7, 0x4B, 0x33, 0xA4,
-    0xD4, 0xEF, 0x9C, 0x68, 0xA6, 0x54, 0xA6, 0xE6, 0x11, 0x3A, 0x4A, 0x65, 0xC8, 0x91, 0xA8, 0xB3,
-    0xDA, 0xDA, 0x0C, 0xB9, 0xE0, 0x06, 0xB7, 0x5F, 0x69, 0x74, 0xBC, 0x6A, 0x1A, 0x29, 0xBD, 0xC0,
-    0xC9, 0x47, 0x1D, 0xBC, 0xA0, 0xC2, 0x8C, 0x19, 0xDE, 0xA4, 0x89, 0x2E, 0xA2, 0x1B, 0x33, 0xCC,
-    0xC9, 0xC7, 0x04, 0x03, 0x9B, 0x80, 0xD4, 0x22, 0x93, 0x8E, 0xF1, 0x4E, 0xBA, 0x0A, 0x8A, 0xB2,
-    0x2C, 0x5C, 0x25, 0x2E, 0x19, 0xE0, 0xAC, 0x6C, 0x3E, 0xB7, 0x5E, 0x1E, 0xDA, 0xAA, 0xC2, 0xF5,
-    0x10, 0x66, 0xA8, 0x81, 0x69, 0x6C, 0xD6, 0x5D, 0xB2, 0xC9, 0x5F, 0x73, 0xAD, 0xFD, 0x15, 0xDB,
-    0xB4, 0x66, 0x93, 0x60, 0x1A, 0x52, 0x1E, 0x21, 0xA2, 0x18, 0xDA, 0x93, 0x71, 0xE2, 0x71, 0xFA,
-    0x79, 0x4D, 0xF2, 0x87, 0x1B, 0x04, 0xD8, 0xA1, 0x2D, 0x55, 0x82, 0xE0, 0xE4, 0x2A, 0xE1, 0x9C,
-    0x4A, 0x40, 0xC4, 0x32, 0x41, 0x04, 0xA9, 0x5C, 0xAA, 0xFF, 0xE2, 0x7C, 0x25, 0x50, 0x23, 0x2E,
-    0xE3, 0xDC, 0x4A, 0xCB, 0xA5, 0x75, 0xB4, 0x6F, 0x14, 0xD3, 0x79, 0x20, 0xAD, 0xB9, 0xC3, 0xB8,
-    0x69, 0x8D, 0xF5, 0x62, 0x04, 0x91, 0x7A, 0xFF, 0x82, 0xCD, 0x8A, 0x98, 0xD1, 0x06, 0x99, 0x51,
-    0x0F, 0x2F, 0x86, 0x4D, 0x8E, 0xF9, 0xB0, 0x58, 0x88, 0x40, 0xBD, 0xB6, 0xC3, 0xB2, 0x1A, 0xF1,
-    0xF2, 0x46, 0x57, 0x7C, 0x54, 0x6B, 0x88, 0xDC, 0xB7, 0x1B, 0x0E, 0xEB, 0x28, 0x57, 0x67, 0x79,
-    0x94, 0xC3, 0x8D, 0x1E, 0xAE, 0xA3, 0x1C, 0x9E, 0xB2, 0xB8, 0x14, 0x29, 0x3A, 0x87, 0xA3, 0x3D,
-    0xCA, 0xD1, 0x4E, 0x61, 0x7D, 0x39, 0xA2, 0x1B, 0x90, 0xF0, 0x19, 0x54, 0x19, 0x32, 0x40, 0xF3,
-    0xF9, 0x16, 0xEB, 0x6E, 0x94, 0xFB, 0x0D, 0x63, 0x95, 0x73, 0xAF, 0x11, 0xFE, 0x0D, 0x1F, 0x66,
-    0x37, 0x59, 0xE3, 0xAA, 0x29, 0x5A, 0x69, 0x82, 0x4A, 0x43, 0xB1, 0xC3, 0xAB, 0x0F, 0xE8, 0xB2,
-    0xAC, 0xE8, 0xD1, 0x9C, 0x57, 0x94, 0x54, 0xF0, 0x7C, 0x78, 0x76, 0x6F, 0x89, 0x66, 0xA8, 0x43,
-    0xD3, 0xD8, 0xB6, 0x8B, 0x88, 0x12, 0xFE, 0x08, 0xBD, 0xDA, 0x86, 0x3F, 0x94, 0x45, 0x1A, 0x59,
-    0xF2, 0x72, 0xEC, 0xD7, 0xE8, 0x16, 0x0A, 0x0F, 0x09, 0x16, 0x06, 0x41, 0x39, 0xA5, 0x88, 0x48,
-    0xE4, 0x88, 0x32, 0x94, 0x55, 0xAA, 0x4D, 0xD2, 0xB0, 0x94, 0x01, 0xA1, 0x41, 0x63, 0xBB, 0xC8,
-    0x6B, 0x17, 0x0B, 0x04, 0xAC, 0x17, 0xAA, 0x8E, 0xD0, 0x1A, 0x4A, 0xB6, 0xC2, 0x44, 0xAA, 0x2D,
-    0x27, 0x82, 0xD7, 0xEA, 0xFB, 0xA8, 0xB7, 0x51, 0x4D, 0xA2, 0x18, 0x9F, 0x6B, 0x0D, 0xED, 0xB5,
-    0x81, 0xBE, 0xE0, 0x39, 0xD9, 0x07, 0xDD, 0x6B, 0xF0, 0x8D, 0x50, 0xD6, 0xF2, 0x5A, 0x4A, 0x56,
-    0xB3, 0x86, 0x0E, 0x4C, 0x3A, 0xFD, 0x93, 0x74, 0x5E, 0x71, 0x5E, 0x51, 0xB8, 0xE2, 0x7A, 0x29,
-    0x2F, 0x8C, 0x85, 0x14, 0x42, 0x17, 0xA5, 0x35, 0x19, 0x34, 0xE5, 0x48, 0x0C, 0x66, 0x2B, 0xB5,
-    0x56, 0x10, 0x55, 0xCE, 0xD5, 0xAF, 0x15, 0x6A, 0xC2, 0x16, 0x5A, 0xB6, 0xB2, 0xE9, 0x20, 0x30,
-    0x4D, 0x54, 0x2E, 0x09, 0x4C, 0xA3, 0xBA, 0x67, 0x6C, 0x5D, 0x4C, 0x83, 0x49, 0xF1, 0xCB, 0xBB,
-    0x9D, 0x34, 0x2A, 0xD8, 0x64, 0xA9, 0x5F, 0x07, 0xF2, 0xB4, 0x79, 0x05, 0x6A, 0x21, 0x4F, 0x4C,
-    0xF0, 0x3A, 0xD8, 0xC8, 0x48, 0x90, 0xDF, 0x44, 0x48, 0x4A, 0x03, 0x59, 0xC1, 0x90, 0x67, 0x60,
-    0x1A, 0xE4, 0x19, 0x20, 0x6E, 0x2D, 0x52, 0x89, 0xFC, 0xA4, 0x83, 0x40, 0xF8, 0xDD, 0xAB, 0x2E,
-    0xB8, 0x42, 0x19, 0x72, 0xE7, 0xB2, 0x08, 0xE4, 0x25, 0x0A, 0x1D, 0x9C, 0x6B, 0x4F, 0x47, 0x2F,
-    0x27, 0xA6, 0x61, 0x1E, 0x55, 0x68, 0xC7, 0x39, 0xA3, 0x01, 0x10, 0x41, 0x5E, 0xF4, 0x43, 0x26,
-    0x6E, 0xED, 0x0E, 0x10, 0x9B, 0xB1, 0x5C, 0xF6, 0xFF, 0xF9, 0x76, 0xA1, 0xEE, 0x61, 0x69, 0x34,
-    0x43, 0x33, 0x2B, 0x4C, 0x74, 0x0E, 0x5B, 0x11, 0x14, 0x1A, 0x8E, 0x5B, 0xA1, 0xAD, 0x86, 0x9A,
-    0x90, 0xC8, 0x99, 0x4A, 0x1F, 0x2B, 0xC6, 0x8A, 0xD0, 0xA7, 0x9C, 0x29, 0x13, 0x4F, 0xD2, 0x4C,
-    0x63, 0x9F, 0x90, 0x9C, 0xC7, 0x90, 0xA7, 0x88, 0x0E, 0x62, 0x04, 0xDD, 0xAF, 0x33, 0x0D, 0x94,
-    0x0A, 0x47, 0x29, 0xCD, 0xB3, 0x83, 0xCF, 0x61, 0x68, 0x25, 0x37, 0x37, 0xCA, 0x1D, 0x19, 0xBA,
-    0x21, 0xBD, 0xB7, 0x52, 0xCF, 0xFB, 0xAC, 0x51, 0x03, 0x6B, 0x60, 0x87, 0x3C, 0x64, 0x12, 0xE8,
-    0x30, 0x9A, 0x22, 0xA3, 0x06, 0x6A, 0x81, 0x77, 0x3B, 0x44, 0xE2, 0x9B, 0xEC, 0xF7, 0xD1, 0x51,
-    0x32, 0x48, 0x66, 0x5B, 0xA1, 0xB1, 0x0C, 0xE7, 0xD9, 0x56, 0x24, 0x33, 0x19, 0xCF, 0x82, 0x6B,
-    0x0C, 0xE8, 0xD9, 0x16, 0xE2, 0x7C, 0x20, 0x98, 0x63, 0x1E, 0x6E, 0x81, 0x15, 0x62, 0x25, 0xE0,
-    0x56, 0x30, 0x6D, 0x4C, 0xA7, 0x41, 0xEA, 0x6F, 0x20, 0xDA, 0x34, 0x33, 0xAC, 0x7E, 0x7F, 0x80,
-    0xEC, 0xBD, 0x5F, 0xD2, 0x56, 0x4F, 0x93, 0x16, 0x43, 0x45, 0x3A, 0xD1, 0x7D, 0x44, 0x77, 0x4B,
-    0xF6, 0x4D, 0xB2, 0xF9, 0x8C, 0xCB, 0xCC, 0xD9, 0xF5, 0xD3, 0xEC, 0xC8, 0xAA, 0x8B, 0xAB, 0x1D,
-    0xF5, 0x79, 0x80, 0xF7, 0x8D, 0xB7, 0xBC, 0xA9, 0xCB, 0xE2, 0xDA, 0x09, 0xFC, 0x9C, 0x04, 0xCC,
-    0x4A, 0x1A, 0x01, 0xBF, 0x63, 0x6A, 0x8F, 0x08, 0x08, 0x97, 0x6E, 0xB0, 0x68, 0x40, 0x87, 0x61,
-    0x27, 0x8D, 0xFB, 0x20, 0xB5, 0x2B, 0x5B, 0x67, 0x45, 0x71, 0xB9, 0xD9, 0xAD, 0x9B, 0xFD, 0x3E,
-    0x6D, 0x44, 0xEA, 0xAA, 0xBF, 0x90, 0x9A, 0xAF, 0xEB, 0xF8, 0xDE, 0x97, 0x37, 0x94, 0xD7, 0xEF,
-    0x11, 0x71, 0xF9, 0x81, 0x50, 0x10, 0x3C, 0x36, 0xD2, 0x2C, 0x90, 0xB5, 0x46, 0xFD, 0x87, 0x1F,
-    0x5C, 0x6D, 0x87, 0x60, 0xA6, 0x64, 0x00, 0x2B, 0xDB, 0x94, 0x04, 0xD3, 0x30, 0x61, 0x7A, 0xA5,
-    0x16, 0x34, 0xE8, 0x86, 0xF8, 0xA7, 0xB1, 0x68, 0x81, 0x0D, 0x19, 0x32, 0x17, 0xDE, 0xE8, 0xD4,
-    0x9D, 0x13, 0x61, 0x41, 0x4D, 0xFE, 0x77, 0x6A, 0xCD, 0x71, 0xAB, 0x41, 0xCF, 0x41, 0x23, 0x55,
-    0xD6, 0xF1, 0x96, 0xCB, 0xAB, 0xBA, 0xDA, 0xEE, 0x41, 0x80, 0x4E, 0xD2, 0x42, 0xC7, 0xD2, 0x43,
-    0xA2, 0x4C, 0xC3, 0x1D, 0x38, 0x42, 0x0B, 0x1D, 0xB1, 0x58, 0xAE, 0xE6, 0x15, 0x64, 0x2F, 0x8C,
-    0x71, 0x19, 0x8E, 0xAD, 0xA8, 0x2C, 0x95, 0xA6, 0x69, 0xAE, 0xD9, 0x24, 0xBC, 0xD3, 0xAC, 0x50,
-    0xFB, 0xB3, 0x4A, 0x25, 0xF7, 0x81, 0x2E, 0xEE, 0x8F, 0x89, 0xA5, 0xE7, 0x85, 0xE0, 0x05, 0xC2,
-    0x17, 0x8C, 0xE3, 0x0B, 0xB2, 0xD6, 0x91, 0x3B, 0x4C, 0x60, 0x7B, 0x0C, 0x1E, 0x4C, 0x60, 0x0B,
-    0x9E, 0x62, 0x61, 0x23, 0xEC, 0x4F, 0xEE, 0x10, 0x83, 0xD7, 0xD4, 0xC8, 0x6C, 0x0A, 0xAA, 0x00,
-    0xFC, 0x68, 0xE3, 0xF7, 0x37, 0xEF, 0x6A, 0xB4, 0x4E, 0xC7, 0x30, 0xB4, 0xCD, 0x10, 0x34, 0x1E,
-    0xDC, 0x27, 0x1C, 0x92, 0x45, 0xF6, 0x8D, 0x0B, 0xB5, 0xA1, 0x90, 0x9C, 0x1B, 0xCE, 0x93, 0x8A,
-    0x82, 0x4A, 0x50, 0xAB, 0x6D, 0xBB, 0xD1, 0x3C, 0xB8, 0xCE, 0x69, 0xDA, 0x1C, 0x1D, 0xB2, 0x02,
-    0xAA, 0xD1, 0x52, 0xC7, 0x59, 0x59, 0x68, 0x48, 0x9D, 0xE6, 0x2F, 0x1E, 0x45, 0xF6, 0x6F, 0x7A,
-    0x66, 0xA6, 0x31, 0x2D, 0xD6, 0xF0, 0x69, 0xEF, 0x19, 0xEB, 0x13, 0xF0, 0xBC, 0x59, 0xEB, 0x9E,
-    0x0E, 0x03, 0x02, 0x96, 0xC5, 0xE2, 0xCE, 0x0D, 0x3A, 0xD3, 0xB4, 0x63, 0x3D, 0x2B, 0xBD, 0x6A,
-    0x29, 0x0E, 0x04, 0x7D, 0x99, 0x4C, 0x67, 0xA3, 0x2C, 0x0E, 0xDD, 0x2B, 0x7D, 0x2A, 0x24, 0x81,
-    0x5D, 0x4C, 0x43, 0x0D, 0xE7, 0x55, 0x81, 0x49, 0xDC, 0xD1, 0xBB, 0xB0, 0x5C, 0xDE, 0xA8, 0xC9,
-    0x3C, 0x09, 0x98, 0xAF, 0xB4, 0xC2, 0x1F, 0x78, 0x4A, 0x62, 0x74, 0x6D, 0x11, 0xD5, 0x17, 0x37,
-    0x98, 0xE3, 0x56, 0x1E, 0x49, 0x13, 0xF3, 0x81, 0x57, 0xEC, 0xB8, 0x2F, 0xF8, 0xCA, 0xA2, 0xAD,
-    0x33, 0x1E, 0xBD, 0xC7, 0x93, 0x40, 0x20, 0x8D, 0x51, 0xA7, 0xBC, 0x44, 0x3B, 0xAF, 0x71, 0xD1,
-    0xBF, 0xAB, 0x21, 0xC1, 0x54, 0x5D, 0x80, 0x36, 0x45, 0xD2, 0xA8, 0x2F, 0xD0, 0x85, 0x99, 0xCA,
-    0x45, 0xE4, 0x1E, 0x34, 0x93, 0x53, 0x55, 0xA4, 0x25, 0x78, 0xAD, 0x06, 0xE1, 0x0D, 0x69, 0x3E,
-    0xA7, 0xCD, 0x51, 0xD7, 0x3C, 0x08, 0x85, 0x36, 0x13, 0x54, 0x65, 0xCA, 0x4E, 0x51, 0xA1, 0x2B,
-    0x61, 0xA6, 0xF2, 0x66, 0xA2, 0x43, 0x3A, 0x76, 0x9D, 0xFE, 0x0C, 0x98, 0x8C, 0xC7, 0x30, 0x4D,
-    0xE1, 0x21, 0x68, 0xE7, 0x6D, 0xCC, 0x78, 0x79, 0x56, 0xC4, 0xFF, 0xD0, 0x60, 0xD8, 0x78, 0xAD,
-    0x47, 0xA1, 0x79, 0x5D, 0x07, 0x46, 0xC3, 0x3B, 0x44, 0x2A, 0xA1, 0xFA, 0xBE, 0x62, 0xEB, 0x33,
-    0x6A, 0xC9, 0xC9, 0x1F, 0x00, 0xC6, 0x6F, 0x33, 0xD4, 0xED, 0x6F, 0x98, 0x10, 0x09, 0xFD, 0x5F,
-    0xB8, 0x46, 0x6E, 0xAC, 0x05, 0x40, 0x4D, 0x00, 0xDE, 0xF7, 0x68, 0xAC, 0x31, 0x9D, 0x95, 0xF2,
-    0xAD, 0xA8, 0x90, 0xB7, 0x5A, 0x8D, 0x83, 0x2F, 0x36, 0xAB, 0x42, 0x8A, 0xC0, 0xCF, 0x79, 0xC7,
-    0xB4, 0xD0, 0xA7, 0x9A, 0xF2, 0x9F, 0xCB, 0x97, 0xC6, 0xA5, 0x2E, 0x08, 0xAB, 0xCA, 0x91, 0x54,
-    0xC8, 0x67, 0x1D, 0x90, 0x86, 0xB1, 0x21, 0x23, 0xDE, 0x35, 0xC9, 0x7C, 0x7A, 0x3D, 0x35, 0xFD,
-    0x99, 0x8D, 0x21, 0xB9, 0xB1, 0xAD, 0xA5, 0xA2, 0x66, 0x48, 0xEB, 0x2F, 0x95, 0xCB, 0xDC, 0x35,
-    0x30, 0x58, 0x67, 0xEA, 0xD9, 0xC5, 0x2C, 0xB6, 0xA9, 0xB3, 0x34, 0x8C, 0x57, 0xCE, 0x91, 0xAE,
-    0x52, 0x9B, 0x86, 0xBA, 0xF8, 0x35, 0x23, 0x61, 0x32, 0x63, 0x33, 0x65, 0xFC, 0xBA, 0xE0, 0x12,
-    0xC5, 0xF2, 0x2B, 0x7A, 0xC8, 0x62, 0x2F, 0x7A, 0xE8, 0x43, 0xF6, 0x28, 0x48, 0x74, 0xE6, 0x27,
-    0xEA, 0xB7, 0xF2, 0x92, 0x71, 0xAE, 0x87, 0x14, 0x1E, 0xED, 0x61, 0x61, 0xE3, 0xE0, 0x90, 0xDF,
-    0x26, 0x83, 0x40, 0x9F, 0x26, 0xFD, 0xDB, 0x90, 0x75, 0xC9, 0xDA, 0x1E, 0x89, 0x78, 0xCC, 0xB2,
-    0x56, 0x72, 0xD7, 0xFF, 0xB5, 0x55, 0x2B, 0xFF, 0xDA, 0x04, 0xBF, 0xA8, 0xF8, 0x16, 0xD2, 0x50,
-    0xFF, 0xE3, 0x8D, 0xF1, 0x3B, 0x06, 0xC1, 0xFA, 0x77, 0xE5, 0x4D, 0xFA, 0x3B, 0x28, 0xA5, 0xC4,
-    0xB4, 0x5F, 0x6B, 0x6A, 0x06, 0xD5, 0x2E, 0x6A, 0x20, 0x6E, 0x31, 0xA4, 0xAE, 0xD9, 0x08, 0x62,
-    0x63, 0x76, 0x22, 0x1A, 0x27, 0x21, 0x50, 0xB3, 0xD1, 0xC2, 0x32, 0xAF, 0x86, 0xC3, 0x68, 0xE0,
-    0xC9, 0xFF, 0xAC, 0x2F, 0x47, 0xD3, 0xF6, 0x68, 0xE5, 0xDE, 0x0E, 0x9C, 0xCE, 0x5A, 0x00, 0x36,
-    0x18, 0x1D, 0xB3, 0x66, 0x66, 0x6B, 0xA3, 0xF8, 0x5B, 0x32, 0x3E, 0x79, 0x51, 0x11, 0x51, 0xC1,
-    0xBC, 0xD4, 0xE7, 0x34, 0x98, 0xF1, 0x32, 0x9B, 0x93, 0x44, 0x1E, 0x4C, 0x65, 0x90, 0x36, 0x61,
-    0xEA, 0x83, 0x89, 0xE6, 0x6D, 0x92, 0x6C, 0x5A, 0xF4, 0xA4, 0x51, 0x8B, 0x21, 0x32, 0x3A, 0x3D,
-    0xAD, 0x43, 0x53, 0xD3, 0xD2, 0xA7, 0xD3, 0x09, 0xE6, 0x3E, 0x4D, 0xD3, 0x80, 0xCD, 0x4F, 0x27,
-    0x1C, 0x0C, 0x7F, 0x7C, 0xA4, 0x8C, 0x2C, 0x22, 0x79, 0x34, 0x4C, 0x80, 0xE0, 0xA1, 0x3A, 0xB6,
-    0x3C, 0x9B, 0x84, 0x6F, 0x1C, 0x37, 0xED, 0x86, 0x74, 0xA6, 0xF6, 0x38, 0x9D, 0x46, 0x43, 0xD4,
-    0x48, 0xA5, 0x51, 0xE2, 0x4C, 0x1C, 0x8D, 0xFE, 0xBA, 0x77, 0x83, 0xB3, 0x18, 0x6E, 0x52, 0x6C,
-    0xA6, 0xF7, 0xF2, 0x7B, 0xEB, 0xBC, 0x7C, 0xDF, 0xB8, 0x14, 0x39, 0x8A, 0x2C, 0xA2, 0x14, 0xF7,
-    0x3F, 0xE9, 0xA3, 0x06, 0x9D, 0xFC, 0xEE, 0xAC, 0x57, 0xD1, 0xAC, 0x48, 0xD9, 0x11, 0xA4, 0x1E,
-    0x06, 0x04, 0x67, 0x3E, 0x23, 0x34, 0x6C, 0xEC, 0x3A, 0xC6, 0x4E, 0xA1, 0x7C, 0xE0, 0x5E, 0xC8,
-    0x9E, 0x69, 0xAF, 0xB3, 0x77, 0xB1, 0xDC, 0x84, 0x4F, 0x10, 0x16, 0x83, 0xE7, 0x65, 0xB9, 0xDF,
-    0x9A, 0xCB, 0x1E, 0x12, 0xF6, 0xBE, 0xD3, 0x45, 0x8D, 0x0A, 0xF4, 0x95, 0x33, 0x41, 0x61, 0x75,
-    0xAE, 0x27, 0xEF, 0x30, 0x6B, 0x4F, 0xB4, 0xCD, 0xD9, 0xA1, 0x28, 0x54, 0x6D, 0xB5, 0xE4, 0x01,
-    0xA8, 0x8E, 0xDB, 0x84, 0xD5, 0xDE, 0x5C, 0xF3, 0x3B, 0xD5, 0x5A, 0xA1, 0xF9, 0x9C, 0x09, 0x39,
-    0x29, 0x3D, 0x01, 0x6A, 0x11, 0x1D, 0xA0, 0x7E, 0xA3, 0x7F, 0xD5, 0x6C, 0x38, 0xBD, 0x4A, 0x1A,
-    0x4E, 0x51, 0x2B, 0x93, 0xBB, 0xF9, 0xDA, 0x40, 0x6D, 0x5F, 0xC4, 0xD4, 0x3E, 0x7D, 0xBA, 0xCB,
-    0xE9, 0x7A, 0x3D, 0xB7, 0x5D, 0x39, 0x32, 0x88, 0xFE, 0x8E, 0x76, 0xE4, 0xFA, 0x25, 0xED, 0xAD,
-    0xF9, 0x0F, 0xDF, 0x79, 0xE3, 0x48, 0x2F, 0xCF, 0x86, 0x8E, 0x7F, 0xD3, 0x1D, 0xFC, 0x57, 0xD7,
-    0xFF, 0xCE, 0xFC, 0x70, 0xF1, 0xC8, 0xAB, 0xCF, 0x61, 0xCA, 0x64, 0x9B, 0xFB, 0x66, 0xA6, 0x1D,
-    0xFA, 0x51, 0xE3, 0x75, 0xC2, 0x84, 0x85, 0xA8, 0x5F, 0x30, 0xA2, 0xFD, 0x59, 0x7B, 0x92, 0xBC,
-    0x82, 0xE5, 0x45, 0xD4, 0xFB, 0x8D, 0xB1, 0x86, 0x00, 0x35, 0xFF, 0xD9, 0x04, 0x28, 0xCD, 0x42,
-    0x67, 0x7F, 0x15, 0x6E, 0xE0, 0x1D, 0x3D, 0xF0, 0xAB, 0x95, 0x3B, 0x28, 0x74, 0xEC, 0xF2, 0x4F,
-    0x18, 0x69, 0x93, 0x83, 0x4C, 0x0F, 0xE8, 0xEC, 0xF5, 0x1A, 0xBB, 0x80, 0x78, 0xCE, 0x40, 0xAC,
-    0x2E, 0x78, 0x4D, 0x3D, 0x93, 0xFE, 0x0F, 0x98, 0x7A, 0x26, 0x32, 0xBF, 0x0C, 0xC3, 0xA0, 0x4F,
-    0xE7, 0xE0, 0x38, 0x77, 0x84, 0x62, 0x85, 0x6A, 0x77, 0x7F, 0x41, 0x49, 0x27, 0xE8, 0x0F, 0x67,
-    0x1A, 0xB9, 0x03, 0x5F, 0xE2, 0x4E, 0x40, 0x6A, 0xD0, 0x3A, 0x5E, 0xA1, 0x56, 0xC6, 0xBD, 0xAB,
-    0xCA, 0xA3, 0xDF, 0x33, 0xCC, 0xB3, 0x36, 0xDF, 0x48, 0xAC, 0x03, 0x3F, 0xB3, 0xFD, 0x12, 0x59,
-    0x1C, 0xB8, 0xDF, 0xED, 0x8D, 0x7E, 0x60, 0xF1, 0x6E, 0xC9, 0xA1, 0x0B, 0x22, 0x1D, 0xFE, 0x0B,
-    0x4A, 0x86, 0x74, 0x6E, 0x4B, 0x5F, 0x0A, 0x6E, 0x4C, 0x78, 0xF8, 0xCF, 0xCD, 0x6F, 0xBD, 0xD2,
-    0x59, 0xB2, 0x6A, 0xBA, 0x9C, 0x4B, 0xD0, 0xB5, 0x91, 0x41, 0xA4, 0xAD, 0xC5, 0x1B, 0xB5, 0x75,
-    0x04, 0xC0, 0x17, 0x2C, 0x96, 0x95, 0xCC, 0x61, 0x2E, 0x8B, 0xB1, 0x95, 0xD6, 0x80, 0xD1, 0x27,
-    0x82, 0x63, 0x04, 0x17, 0x51, 0x85, 0x8C, 0x2A, 0xCC, 0x6A, 0x99, 0xA4, 0xDD, 0xD5, 0xBE, 0x53,
-    0xE5, 0xAB, 0xB2, 0x0A, 0x70, 0x1E, 0x43, 0xE2, 0xC7, 0x4B, 0xEE, 0x66, 0x46, 0x86, 0xAE, 0x64,
-    0x44, 0xD0, 0x5B, 0x53, 0xA0, 0x9F, 0xFE, 0xDB, 0x40, 0x07, 0x9B, 0xF9, 0x1D, 0xCF, 0x9C, 0xF4,
-    0xF3, 0xF7, 0xDA, 0xD8, 0xEF, 0x2D, 0x60, 0x93, 0x35, 0x6E, 0x86, 0x1B, 0xEF, 0xF6, 0xDE, 0xAB,
-    0xEC, 0xDE, 0xF5, 0x3F, 0xF0, 0x4A, 0x73, 0xEA, 0xCF, 0x13, 0xEF, 0x1C, 0x18, 0xA2, 0x57, 0xDE,
-    0x57, 0xE3, 0x50, 0x6E, 0xE3, 0x12, 0x65, 0x38, 0x47, 0x98, 0x75, 0x56, 0x70, 0x39, 0x52, 0x8A,
-    0x6B, 0x92, 0x22, 0x9D, 0x9D, 0x3F, 0x45, 0x3A, 0xBD, 0x57, 0x8A, 0xF4, 0xBC, 0x55, 0x79, 0x2A,
-    0x57, 0x9B, 0xFF, 0x0D, 0x32, 0x50, 0xB2, 0x79, 0x1D, 0xA0, 0x9E, 0x4E, 0xD1, 0xE4, 0xBE, 0x20,
-    0x44, 0x82, 0x6B, 0x7D, 0x2D, 0x13, 0xA2, 0x11, 0x01, 0xA0, 0xC6, 0xE2, 0x42, 0x1B, 0x69, 0xAA,
-    0x6D, 0xEA, 0xC6, 0xC0, 0xA3, 0x21, 0xD2, 0xBE, 0xB3, 0xED, 0x75, 0xF6, 0x54, 0x5C, 0x13, 0x74,
-    0xDF, 0x45, 0x2E, 0x4C, 0x29, 0xF7, 0x92, 0x6F, 0x10, 0xC1, 0x17, 0x9E, 0xF1, 0xB1, 0x8C, 0x90,
-    0xA1, 0x3A, 0x32, 0xCA, 0xF1, 0x5D, 0xB0, 0x86, 0x3C, 0x2A, 0x9A, 0xAD, 0xBC, 0x11, 0x7A, 0x20,
-    0x6A, 0x9C, 0x58, 0x39, 0xE7, 0xA2, 0xF6, 0x3F, 0x30, 0x27, 0xD2, 0xB7, 0xFE, 0xA1, 0x8C, 0x86,
-    0x67, 0x92, 0x12, 0x53, 0xE6, 0x10, 0x41, 0x53, 0x1C, 0x6D, 0xF1, 0xD6, 0x59, 0xC3, 0x63, 0xAC,
-    0xDF, 0x7B, 0xE8, 0x92, 0xC6, 0xFC, 0x95, 0x61, 0xE4, 0xB6, 0x16, 0x0D, 0x5B, 0x4F, 0xC6, 0xEA,
-    0x86, 0xEA, 0x9A, 0xC8, 0x61, 0x09, 0x32, 0x0E, 0x0C, 0xC2, 0x71, 0x2C, 0x7B, 0x0C, 0xFA, 0xF5,
-    0x0B, 0x08, 0xB3, 0xE8, 0xBC, 0x6D, 0xB2, 0x6F, 0x6A, 0x37, 0x48, 0x7B, 0x79, 0xFD, 0x1F, 0x98,
-    0xDF, 0xB3, 0x6C, 0x2F, 0x11, 0x02, 0x45, 0x79, 0x98, 0x7E, 0xC9, 0xB8, 0x28, 0xB9, 0xE8, 0x50,
-    0x79, 0xE8, 0xEA, 0x5A, 0xBF, 0xA9, 0x4D, 0x51, 0x7D, 0xC3, 0x05, 0x3E, 0x3D, 0x37, 0x59, 0x6F,
-    0xF2, 0x91, 0xB9, 0x0C, 0xA2, 0xC8, 0x97, 0xBC, 0x61, 0x90, 0x7D, 0xD9, 0x7C, 0xF3, 0xF4, 0x79,
-    0x22, 0x6B, 0xB2, 0x8E, 0x14, 0x0C, 0x59, 0x72, 0x26, 0x1F, 0x2F, 0xFE, 0x7B, 0x9C, 0x63, 0xC1,
-    0x75, 0x61, 0xBF, 0xDF, 0x34, 0xB8, 0xE9, 0x6F, 0xC9, 0x6D, 0xEC, 0x43, 0x9F, 0x31, 0xCF, 0x98,
-    0x07, 0xFD, 0x71, 0x51, 0x5B, 0x17, 0x84, 0x20, 0x6E, 0x41, 0xDE, 0xC4, 0x56, 0xB6, 0xF4, 0xFB,
-    0xFA, 0xCB, 0x33, 0x7D, 0x83, 0x20, 0x7D, 0xF3, 0x9B, 0x46, 0xDF, 0x20, 0x34, 0xFF, 0xC8, 0x3C,
-    0x82, 0x9F, 0xCB, 0x43, 0x6A, 0xB7, 0x3E, 0x79, 0x06, 0xFE, 0xAC, 0x4F, 0x9E, 0x43, 0x6E, 0xD6,
-    0x27, 0x87, 0xE9, 0x9B, 0xE3, 0x1B, 0xFF, 0x93, 0x7B, 0xDC, 0xCE, 0x1F, 0x24, 0xBC, 0xFB, 0xA3,
-    0xFA, 0x3F, 0x1D, 0x0F, 0xBF, 0x3C, 0x1E, 0xBE, 0x37, 0x1E, 0x8E, 0xCC, 0xCF, 0x16, 0xDB, 0x83,
-    0xBF, 0x77, 0xE6, 0xA2, 0x27, 0x5D, 0xE1, 0x47, 0x0E, 0x71, 0x66, 0xF4, 0xA7, 0x83, 0x0B, 0x87,
-    0x6E, 0x10, 0x0A, 0x2C, 0xC1, 0x18, 0x4E, 0xAB, 0xCB, 0x6D, 0x32, 0xD6, 0xBB, 0xFB, 0x12, 0xC0,
-    0x67, 0x6D, 0x47, 0x3E, 0x44, 0x0F, 0xCA, 0xC5, 0xC5, 0xFE, 0x10, 0x4A, 0x93, 0xD9, 0xDE, 0x0C,
-    0xBB, 0x74, 0xDE, 0x8F, 0x64, 0xB9, 0xE6, 0x4A, 0x92, 0x6E, 0xCC, 0xA3, 0xFA, 0xF1, 0xB5, 0xBA,
-    0xDA, 0x58, 0xBA, 0x2F, 0x29, 0x9D, 0xBB, 0x74, 0xD6, 0x0F, 0xB1, 0x0D, 0x51, 0x3B, 0x04, 0x9B,
-    0x26, 0xBA, 0xFC, 0x81, 0xAE, 0x9F, 0x51, 0x02, 0x59, 0x6A, 0x63, 0x0E, 0xDB, 0x3E, 0x98, 0x6D,
-    0x47, 0x45, 0x68, 0x64, 0xCE, 0xFE, 0xD8, 0x6A, 0x7F, 0x5C, 0x6A, 0x5C, 0x10, 0xD1, 0xBF, 0xD2,
-    0xA0, 0x94, 0x3D, 0xFB, 0x14, 0x55, 0x08, 0xE2, 0xBF, 0xBD, 0xB6, 0xD1, 0x55, 0x9E, 0xAC, 0xB3,
-    0x3F, 0x3C, 0xD6, 0xFE, 0x3D, 0xE3, 0xFC, 0xA0, 0x9A, 0xCE, 0x48, 0x85, 0xDC, 0xFA, 0x8C, 0x32,
-    0x65, 0x3B, 0x50, 0x62, 0xEE, 0x10, 0x85, 0xBF, 0x26, 0x8A, 0x7E, 0x42, 0x94, 0x7C, 0x87, 0xA8,
-    0xA7, 0x56, 0xED, 0xB5, 0xBE, 0x96, 0x4B, 0xF0, 0x35, 0xE9, 0x8A, 0x28, 0x5A, 0x13, 0x25, 0x39,
-    0x51, 0x41, 0xFD, 0xDB, 0x83, 0x9B, 0xC6, 0xEC, 0xC9, 0xAA, 0x0A, 0x84, 0x15, 0x5F, 0x50, 0xC4,
-    0x52, 0xA2, 0x7B, 0x5A, 0x36, 0x72, 0xAF, 0x50, 0x4D, 0x5D, 0xCB, 0x88, 0x65, 0xB5, 0x22, 0x18,
-    0xD8, 0xFA, 0x0D, 0xAC, 0xC7, 0xB2, 0x5E, 0x67, 0xAC, 0x41, 0x69, 0x95, 0xE8, 0x72, 0x2A, 0xB1,
-    0x59, 0x39, 0xD5, 0x4A, 0xA9, 0x85, 0x19, 0x33, 0x55, 0x27, 0xD2, 0xB3, 0x0C, 0xE1, 0x4B, 0x64,
-    0xC8, 0x5A, 0x56, 0x14, 0x2F, 0xD8, 0xD2, 0xBE, 0xAB, 0x39, 0xD7, 0xB1, 0x66, 0x6D, 0x1E, 0xA9,
-    0xBE, 0xC8, 0x14, 0xBA, 0xCA, 0x7A, 0xA0, 0x5A, 0x12, 0xA8, 0x25, 0x7D, 0xE4, 0x85, 0x3E, 0x06,
-    0x0C, 0x7E, 0xC2, 0x4C, 0xCC, 0x1F, 0xD1, 0x31, 0x03, 0x03, 0xBC, 0x59, 0x01, 0x7A, 0x0D, 0x8D,
-    0xF1, 0x34, 0xC9, 0x07, 0x1B, 0xC0, 0xB0, 0x04, 0x14, 0xE1, 0xA6, 0x32, 0x0D, 0x6D, 0xC0, 0x6D,
-    0x03, 0x88, 0xE0, 0xA8, 0xCA, 0x30, 0x34, 0x0A, 0xA1, 0x29, 0x80, 0xB9, 0x7B, 0x4B, 0x7D, 0xBB,
-    0x38, 0x3D, 0x12, 0x13, 0xA8, 0x93, 0xCA, 0x6A, 0x86, 0x8D, 0x55, 0xE6, 0xA6, 0xF0, 0x85, 0x76,
-    0xA1, 0x9A, 0x5C, 0xE9, 0xE0, 0x17, 0x91, 0xA4, 0x71, 0xC2, 0x99, 0x16, 0xB6, 0x90, 0x6E, 0x3C,
-    0x9B, 0x92, 0x00, 0xE1, 0xD1, 0xEB, 0x96, 0x37, 0x3B, 0x96, 0x9A, 0xE8, 0x53, 0x9C, 0x93, 0xE4,
-    0x2A, 0x9B, 0xAB, 0x30, 0x37, 0x42, 0xFD, 0x26, 0x21, 0x2C, 0x70, 0xCE, 0x5C, 0x0B, 0x02, 0x36,
-    0x84, 0x50, 0x3B, 0x30, 0xFA, 0x34, 0x63, 0x42, 0x63, 0xCB, 0x76, 0x60, 0x6D, 0x5D, 0xFC, 0x03,
-    0x7C, 0xF5, 0x70, 0x71, 0xF2, 0x99, 0xE7, 0x81, 0x3D, 0xCA, 0xF8, 0x69, 0x91, 0x52, 0x9F, 0x6D,
-    0xD0, 0x4A, 0xD1, 0xEA, 0x30, 0xA2, 0x5C, 0x98, 0x12, 0x8E, 0xDF, 0x48, 0xF7, 0xFB, 0xDD, 0xB2,
-    0x70, 0xAA, 0x9B, 0x6F, 0x4B, 0xB8, 0x7E, 0x98, 0x0E, 0xF5, 0x6B, 0x60, 0x62, 0xBA, 0xC8, 0xCA,
-    0x84, 0xC9, 0x90, 0xB3, 0x3D, 0xA6, 0x6B, 0x0F, 0xD5, 0x05, 0xFF, 0x1D, 0x5D, 0x9B, 0xA8, 0x6E,
-    0x93, 0x14, 0x65, 0xB6, 0xB8, 0xD6, 0xDB, 0xA4, 0x6F, 0x75, 0xE9, 0xFF, 0x59, 0xA3, 0xA2, 0x60,
-    0x06, 0xCE, 0x97, 0x81, 0x6D, 0x9D, 0xAB, 0x7E, 0xCD, 0x90, 0x55, 0x94, 0x4D, 0xB2, 0x8A, 0xB2,
-    0xBC, 0xCF, 0x5D, 0x56, 0x51, 0x3F, 0xCD, 0x2A, 0x9A, 0xEF, 0x66, 0x15, 0xCD, 0x5D, 0x56, 0xD1,
-    0x67, 0x90, 0x55, 0xF4, 0xB2, 0x9C, 0x9C, 0xC7, 0x37, 0x4B, 0xC4, 0x59, 0xEE, 0x66, 0x15, 0xC1,
-    0x98, 0x71, 0x25, 0xD1, 0xDC, 0x51, 0x01, 0xCF, 0x9E, 0x99, 0x55, 0xA4, 0x29, 0x40, 0xC9, 0x89,
-    0xC0, 0xD5, 0x55, 0x74, 0xE0, 0xFE, 0x93, 0xE6, 0x1F, 0x09, 0xD0, 0x65, 0xE6, 0xF8, 0xC7, 0xC5,
-    0xC4, 0x76, 0x8B, 0x85, 0x79, 0x14, 0x31, 0xB1, 0x1C, 0xE9, 0x13, 0xD0, 0xB8, 0x19, 0x75, 0x0E,
-    0xF0, 0x8F, 0xBB, 0xE5, 0xF7, 0x30, 0x39, 0x6B, 0x05, 0xB3, 0xFB, 0xB9, 0xF6, 0x08, 0xB0, 0x83,
-    0xBF, 0xE5, 0xA7, 0x5B, 0x7E, 0x1F, 0xC3, 0xFB, 0xE8, 0xE7, 0x45, 0x99, 0x58, 0x85, 0xFA, 0x1C,
-    0x4A, 0x1C, 0x9F, 0x74, 0xCE, 0xF4, 0x93, 0x8D, 0x65, 0xC6, 0x1D, 0x7C, 0xB0, 0xCA, 0x41, 0xAF,
-    0x7F, 0xDF, 0xD8, 0x6A, 0x50, 0x2E, 0xBC, 0xE6, 0xF2, 0xD5, 0x5E, 0x4B, 0xC4, 0xE9, 0xEA, 0x32,
-    0x29, 0xD8, 0xE6, 0xB5, 0xB6, 0x6C, 0x5B, 0x66, 0x73, 0xF2, 0x1D, 0xCC, 0x26, 0xB0, 0x18, 0xAB,
-    0x2E, 0xAB, 0x3B, 0x50, 0x19, 0xBD, 0xD7, 0x8E, 0x85, 0x09, 0x20, 0x20, 0x3F, 0x07, 0xB6, 0x6D,
-    0x92, 0x1B, 0x96, 0x07, 0x92, 0xC1, 0x6F, 0x5D, 0xBC, 0xC9, 0x79, 0x02, 0xA4, 0xBB, 0xE5, 0x65,
-    0x24, 0x73, 0x33, 0x3A, 0xA3, 0xFB, 0x4A, 0x21, 0xB3, 0x2B, 0xA8, 0x11, 0xD1, 0x68, 0x53, 0x65,
-    0x90, 0xFE, 0x50, 0x4C, 0x3F, 0xB6, 0x51, 0x36, 0x9D, 0x01, 0xCD, 0xF1, 0x1B, 0x2F, 0x0D, 0xB6,
-    0xB3, 0xAE, 0x67, 0x7E, 0xAF, 0xB3, 0xC2, 0xC1, 0x0C, 0xC9, 0x68, 0xA9, 0xB8, 0xB4, 0xB5, 0xE8,
-    0x42, 0x2D, 0xD9, 0xCD, 0x94, 0xE5, 0x80, 0xA6, 0x42, 0xB9, 0x83, 0x1C, 0x50, 0x11, 0x49, 0x83,
-    0x0D, 0x5F, 0x4D, 0xFD, 0x5D, 0x54, 0x98, 0x82, 0x4D, 0xA8, 0x9E, 0x54, 0x78, 0xE1, 0x39, 0x33,
-    0x03, 0x6B, 0xA0, 0xC9, 0xFE, 0xF0, 0xE7, 0xFA, 0x90, 0xF8, 0xC7, 0xBF, 0x50, 0x19, 0x2E, 0xBC,
-    0xFB, 0xCB, 0xCA, 0xF9, 0xFE, 0x55, 0x49, 0x08, 0x3F, 0xFA, 0xC8, 0x5A, 0x9C, 0x7F, 0xFC, 0x0B,
-    0x6B, 0x9A, 0x0F, 0x36, 0x2A, 0x8D, 0xCA, 0x7D, 0xD4, 0x9E, 0xBF, 0x0D, 0x36, 0xB6, 0xD2, 0x7A,
-    0xB0, 0x51, 0xEB, 0x3F, 0x9E, 0xDE, 0xF0, 0x15, 0x83, 0x8D, 0x7D, 0xBF, 0x60, 0x63, 0x15, 0x65,
-    0xB4, 0x79, 0xED, 0xDE, 0xA2, 0x87, 0x61, 0x02, 0xEF, 0x25, 0x63, 0x0D, 0x75, 0x04, 0x6D, 0x35,
-    0x48, 0x33, 0xAD, 0xC3, 0xF6, 0x60, 0x07, 0xE3, 0x0F, 0x95, 0x63, 0xC4, 0x95, 0x6D, 0x50, 0xC8,
-    0x90, 0x74, 0x5B, 0xD1, 0xCF, 0xD1, 0xC2, 0x5F, 0x8F, 0xB8, 0x1A, 0x46, 0xB3, 0xE2, 0xC4, 0x95,
-    0xFA, 0x96, 0xAB, 0x15, 0x0D, 0xA4, 0x7E, 0xBD, 0x52, 0x8A, 0x75, 0x2B, 0x5B, 0xB2, 0xCB, 0x5A,
-    0xE2, 0x8A, 0x55, 0xA7, 0xC2, 0xC2, 0xCA, 0x3A, 0x34, 0x56, 0x14, 0xE6, 0xA2, 0xF5, 0x8A, 0xBE,
-    0xEE, 0x24, 0x5D, 0x71, 0xA6, 0x75, 0x72, 0xDF, 0xC2, 0xE8, 0xF3, 0x98, 0x9F, 0x06, 0x25, 0xFD,
-    0x4E, 0xCE, 0xF6, 0x88, 0x80, 0x52, 0xB0, 0xFB, 0x5D, 0xF5, 0x87, 0xF0, 0x7E, 0x71, 0xF9, 0x44,
-    0x95, 0xD3, 0x7C, 0x61, 0x8C, 0xCC, 0x7D, 0x79, 0x48, 0x32, 0x89, 0x1D, 0xB3, 0x0F, 0x41, 0xAF,
-    0x70, 0x90, 0xAD, 0x3E, 0x89, 0x1C, 0x77, 0x48, 0x3F, 0x30, 0x70, 0x52, 0x18, 0xAE, 0xF5, 0x03,
-    0x71, 0x19, 0x42, 0xA1, 0xD6, 0xB3, 0x32, 0x6A, 0x4E, 0xCC, 0x6C, 0x75, 0x0E, 0x68, 0xEB, 0x99,
-    0x2B, 0x08, 0xD0, 0x8F, 0xC5, 0x22, 0xB5, 0x7C, 0xA4, 0x86, 0x47, 0x31, 0xEA, 0x8A, 0xC6, 0xE2,
-    0x8C, 0x2F, 0x9F, 0xD1, 0xE4, 0x9C, 0xD1, 0xBC, 0x90, 0x69, 0xA8, 0x02, 0x65, 0xF9, 0x8C, 0x34,
-    0xCB, 0x18, 0x91, 0x96, 0x79, 0xD3, 0x92, 0x94, 0x31, 0xC3, 0x4E, 0x02, 0x15, 0x21, 0xDA, 0x49,
-    0x31, 0x4A, 0x5B, 0x86, 0x92, 0xA5, 0x39, 0x7D, 0x42, 0xAF, 0x7F, 0x20, 0xC7, 0xB3, 0x0B, 0xC4,
-    0x9E, 0x6B, 0x08, 0xDA, 0x34, 0x06, 0x1B, 0xA4, 0xD4, 0xF8, 0x10, 0x16, 0xBE, 0x00, 0x87, 0xE0,
-    0x08, 0xEE, 0xD0, 0x42, 0xAD, 0xF6, 0xC1, 0xEA, 0x21, 0x48, 0xF6, 0xA5, 0x70, 0xDB, 0x62, 0x3E,
-    0x20, 0xD9, 0x9B, 0x49, 0x53, 0x6B, 0x90, 0x7F, 0xDD, 0xDA, 0x31, 0x1A, 0x9E, 0x01, 0x4E, 0xA5,
-    0xEE, 0xC5, 0x14, 0x6F, 0x1C, 0x7C, 0x07, 0xD4, 0x0D, 0xFE, 0x03, 0xA8, 0x1B, 0x40, 0xEF, 0xCB,
-    0xB8, 0x51, 0x43, 0x46, 0x1B, 0x5A, 0x16, 0x4E, 0xA9, 0x4B, 0x8A, 0x52, 0x1B, 0xD9, 0xA1, 0x2E,
-    0x0B, 0xE3, 0x65, 0x54, 0x85, 0x33, 0xE4, 0x78, 0x08, 0xBC, 0x09, 0xEA, 0x06, 0x6F, 0x83, 0xBA,
-    0xC1, 0x57, 0x4F, 0xA0, 0x6E, 0x35, 0x59, 0x2D, 0xBA, 0x29, 0xB5, 0x9E, 0x05, 0xB5, 0x22, 0x50,
-    0x2B, 0x02, 0xB5, 0x10, 0xF5, 0xD1, 0xA2, 0x18, 0x4E, 0x1B, 0xED, 0x52, 0xAB, 0xDF, 0xA5, 0x16,
-    0xAB, 0xA4, 0xE8, 0x79, 0x60, 0xEC, 0x11, 0xA8, 0x15, 0x81, 0x5A, 0x11, 0x62, 0xAC, 0x2E, 0xD0,
-    0x73, 0x26, 0x2D, 0xA0, 0xF5, 0x7A, 0xA3, 0x86, 0x6A, 0x95, 0x87, 0xDF, 0xE8, 0xDE, 0x85, 0xD3,
-    0xA0, 0xAF, 0x3D, 0xA4, 0xC4, 0xD4, 0xD2, 0x31, 0x2F, 0xB4, 0x97, 0x03, 0xA4, 0xF5, 0xC3, 0xF2,
-    0xEB, 0xD1, 0x99, 0xE6, 0x35, 0xBA, 0x83, 0x08, 0x18, 0xB8, 0xD7, 0xBE, 0x4A, 0x83, 0x0E, 0x0C,
-    0x1B, 0x16, 0xB6, 0xAF, 0xD2, 0xE9, 0x8A, 0xF7, 0x90, 0x33, 0x7B, 0x42, 0x26, 0xB7, 0xDB, 0x3B,
-    0x84, 0xBC, 0x9B, 0x4F, 0x09, 0xDF, 0xD3, 0x02, 0x1D, 0xDA, 0x12, 0x95, 0xB7, 0x35, 0x26, 0x2A,
-    0xAC, 0x34, 0x6B, 0x8E, 0x32, 0xF6, 0x64, 0x7A, 0xDB, 0x02, 0x97, 0x6B, 0x05, 0x2F, 0x22, 0xE3,
-    0x69, 0x67, 0xF2, 0x33, 0xFE, 0x29, 0x5A, 0x33, 0x46, 0x8D, 0xB1, 0x8E, 0x3E, 0xC2, 0x86, 0x18,
-    0x11, 0xE9, 0x33, 0x15, 0x9F, 0x6E, 0xFF, 0xBF, 0x6B, 0x6C, 0xDE, 0x91, 0x7F, 0xB7, 0x61, 0x8C,
-    0x80, 0x8D, 0x82, 0xF7, 0xB7, 0x11, 0xCE, 0x43, 0x7D, 0xB8, 0xAD, 0xC7, 0x94, 0x81, 0x22, 0x65,
-    0x54, 0x24, 0x2D, 0x8B, 0xC8, 0x02, 0x69, 0x90, 0x4A, 0x05, 0xFF, 0x63, 0xCF, 0x0D, 0x02, 0x80,
-    0x40, 0x06, 0x16, 0x68, 0x21, 0xA2, 0x69, 0xAD, 0xA2, 0xA1, 0x4E, 0x10, 0x73, 0x82, 0x2B, 0x2E,
-    0x31, 0x41, 0xA5, 0x19, 0x5E, 0x55, 0xA2, 0x9A, 0x34, 0xEB, 0xFA, 0x04, 0xFF, 0x57, 0x5D, 0xE1,
-    0x77, 0xB7, 0x6A, 0xB7, 0xD6, 0x02, 0x57, 0x1F, 0xEB, 0x72, 0xFF, 0xAB, 0x5E, 0x9D, 0x13, 0x9C,
-    0xC5, 0x41, 0x45, 0xAF, 0x72, 0x50, 0x71, 0x7E, 0xCB, 0x3D, 0x5B, 0x33, 0x79, 0x02, 0xD9, 0x40,
-    0xA0, 0x75, 0x3E, 0x03, 0x1B, 0xC8, 0x51, 0x71, 0x28, 0xD1, 0x33, 0x9E, 0x13, 0xB9, 0x80, 0x80,
-    0x0C, 0xA5, 0x63, 0x2B, 0xC0, 0xA8, 0xFC, 0xE2, 0x0D, 0x15, 0x54, 0xB6, 0x5C, 0xD9, 0xB7, 0x2A,
-    0x27, 0x85, 0x1B, 0x4B, 0x0F, 0x8D, 0xA1, 0x50, 0x7A, 0xA9, 0xF1, 0x4A, 0xD4, 0x43, 0x9A, 0xE7,
-    0xF4, 0x7B, 0xBA, 0xBB, 0x84, 0x68, 0x6B, 0xA3, 0x54, 0xB3, 0xD1, 0x5E, 0xA0, 0x9B, 0xBA, 0x0D,
-    0x4B, 0x46, 0x93, 0x56, 0x9A, 0x48, 0x63, 0x8B, 0x96, 0x3E, 0x22, 0xC4, 0xDA, 0xAA, 0x1A, 0x0E,
-    0x37, 0x22, 0x96, 0x57, 0x7D, 0x24, 0x4F, 0xD0, 0x7D, 0x28, 0x46, 0x74, 0xFE, 0xAA, 0x7A, 0x53,
-    0x34, 0x51, 0xB7, 0x11, 0xE9, 0x73, 0x6E, 0xA8, 0xD1, 0x74, 0x63, 0x9C, 0x27, 0x85, 0x93, 0x73,
-    0x5D, 0xDB, 0xE7, 0x53, 0x38, 0xDA, 0xA6, 0xCE, 0x82, 0xFA, 0x9A, 0xF4, 0xCC, 0x8B, 0xF6, 0x34,
-    0x45, 0x6B, 0x35, 0xA8, 0x94, 0xF7, 0x83, 0xCE, 0xE8, 0x9C, 0xE8, 0x11, 0xA3, 0x09, 0x95, 0xFB,
-    0x7E, 0x8A, 0xEE, 0x2C, 0xA7, 0xB5, 0xDA, 0x4F, 0x43, 0x4A, 0x6D, 0x4B, 0x68, 0x87, 0xBA, 0xB3,
-    0xAF, 0xBB, 0x17, 0xCA, 0x5C, 0xE6, 0xBD, 0xAD, 0x8E, 0x39, 0x3D, 0x40, 0x50, 0xE7, 0x50, 0x3F,
-    0xEC, 0x51, 0x1D, 0x2C, 0xDF, 0x75, 0x05, 0xC9, 0xFA, 0xB5, 0x3B, 0xD0, 0x7A, 0xD1, 0xC5, 0xE2,
-    0x6A, 0xEF, 0x4E, 0x2E, 0xDC, 0x86, 0x2B, 0xB1, 0xDB, 0x8B, 0x45, 0x9D, 0xDC, 0x14, 0xFF, 0xDC,
-    0x41, 0x63, 0x0F, 0x66, 0xEE, 0xC0, 0x3B, 0xD7, 0xC1, 0x51, 0xC7, 0xAE, 0xDF, 0x1C, 0xF5, 0xEC,
-    0x0F, 0xDE, 0x19, 0x1B, 0xFC, 0x90, 0xDA, 0xF8, 0x72, 0xD3, 0xDD, 0xEC, 0x5D, 0x79, 0xA9, 0xD6,
-    0xD5, 0xB7, 0xB5, 0xDC, 0xCA, 0xBB, 0xB2, 0x93, 0xFD, 0xC9, 0xF3, 0x06, 0xBC, 0x64, 0xBC, 0xB9,
-    0x2B, 0xB6, 0x7F, 0x2E, 0xBC, 0xDC, 0x57, 0xDC, 0x77, 0x16, 0xF7, 0xF4, 0xBB, 0x25, 0xFF, 0xF1,
-    0x9A, 0xDA, 0xC3, 0xD2, 0x79, 0xA3, 0xD8, 0xB3, 0x49, 0xD3, 0x9A, 0xE8, 0x45, 0x4F, 0xD6, 0x2E,
-    0x4E, 0x1C, 0x4E, 0x1D, 0x36, 0x93, 0x3C, 0xD7, 0xB1, 0x5E, 0x6F, 0x66, 0xA6, 0x96, 0x3B, 0x67,
-    0x71, 0xB8, 0x6C, 0xC9, 0x93, 0x15, 0xDB, 0x49, 0xB6, 0xBE, 0x2B, 0x41, 0xB4, 0xFB, 0xE3, 0xE9,
-    0x50, 0x8A, 0x75, 0xFC, 0x28, 0x8D, 0xAC, 0x95, 0x3C, 0x68, 0x5C, 0xF4, 0x8D, 0xF7, 0xDF, 0x52,
-    0x2A, 0x2C, 0x3D, 0x57, 0x83, 0x04, 0x92, 0xB6, 0xD0, 0xF7, 0xDB, 0x9D, 0x86, 0x1E, 0x23, 0x12,
-    0x00, 0x0B, 0x71, 0x4A, 0xAF, 0x23, 0x22, 0xF8, 0x58, 0xD4, 0x5B, 0x51, 0x79, 0x12, 0xCA, 0x33,
-    0x3D, 0x33, 0x49, 0x79, 0x1D, 0x5D, 0x76, 0x8C, 0xD9, 0xEB, 0x35, 0x66, 0x2F, 0xFB, 0xFD, 0x06,
-    0x0B, 0x4D, 0xF2, 0x63, 0xC6, 0xEC, 0x45, 0x5C, 0x10, 0xA5, 0x1F, 0x35, 0x66, 0xAF, 0xFF, 0x60,
-    0x9F, 0x51, 0xE0, 0xE8, 0xC5, 0x0B, 0x97, 0x03, 0xDB, 0x99, 0x7F, 0x9C, 0xDA, 0xEE, 0xA4, 0x4D,
-    0x5B, 0x4B, 0xDD, 0x06, 0x87, 0x57, 0x8C, 0x8B, 0x1C, 0x42, 0x3E, 0x23, 0xC4, 0x5C, 0x78, 0x0D,
-    0x0A, 0x13, 0xC9, 0xE2, 0xBC, 0x62, 0x90, 0x42, 0xC7, 0xB2, 0x9A, 0x8C, 0x5E, 0xB6, 0x90, 0xD5,
-    0xAA, 0x18, 0xC6, 0x9C, 0xB1, 0x06, 0xF5, 0x8A, 0xFE, 0x46, 0x64, 0xEA, 0x45, 0x3F, 0x81, 0x06,
-    0x85, 0xA5, 0x74, 0xDE, 0x41, 0x25, 0x87, 0x0D, 0xE3, 0x56, 0xCE, 0xD2, 0xC4, 0xC2, 0xEA, 0xAE,
-    0x5C, 0x1C, 0x5D, 0x3A, 0x13, 0x2F, 0xA1, 0x46, 0x89, 0x24, 0x93, 0x42, 0xCA, 0x53, 0x2F, 0xE1,
-    0xE6, 0x71, 0x79, 0x09, 0x2F, 0x80, 0x84, 0x37, 0x18, 0x7C, 0x68, 0xB7, 0xAF, 0xA0, 0x6A, 0xFC,
-    0xB7, 0xA3, 0xC5, 0xDC, 0x3A, 0x2E, 0xEA, 0xB1, 0x4C, 0xA6, 0xCE, 0x3B, 0x8D, 0x16, 0x4A, 0x36,
-    0x13, 0xDF, 0x2E, 0x17, 0x7A, 0xB9, 0x05, 0xC2, 0x84, 0xAA, 0xFB, 0xF2, 0x12, 0xA6, 0xD6, 0x4B,
-    0x58, 0x99, 0xE7, 0x82, 0xEE, 0x3F, 0xF1, 0x1E, 0x8C, 0x9B, 0xA6, 0x90, 0x85, 0x47, 0xBF, 0x65,
-    0xB5, 0xA7, 0x44, 0xA9, 0x80, 0xCC, 0x96, 0xB0, 0xB6, 0xD3, 0xF6, 0x68, 0xC1, 0xE7, 0x4B, 0x0B,
-    0xE1, 0x77, 0xE6, 0x53, 0x2C, 0xF2, 0xDC, 0x1E, 0x85, 0xE6, 0xFC, 0x70, 0x0C, 0xBE, 0x72, 0x85,
-    0x81, 0xBE, 0xA8, 0x85, 0x81, 0x6A, 0xC7, 0xD6, 0x1E, 0x0A, 0x20, 0xA7, 0x8B, 0x45, 0x9E, 0xFD,
-    0x73, 0x68, 0x2E, 0x01, 0x23, 0xEA, 0xB1, 0x81, 0x0F, 0xF3, 0xCF, 0x75, 0x23, 0x3F, 0x0D, 0x40,
-    0x08, 0x58, 0xCA, 0x54, 0xB3, 0x94, 0x87, 0xB2, 0xC6, 0x98, 0x52, 0x1A, 0xB7, 0x9B, 0xE4, 0xBA,
-    0x4E, 0x52, 0xB9, 0xFD, 0x39, 0xC6, 0xCB, 0xFC, 0xD7, 0xF5, 0x20, 0xD1, 0x79, 0xCA, 0x78, 0xD4,
-    0x9E, 0x71, 0x9E, 0xED, 0x77, 0xEE, 0x0D, 0x75, 0x20, 0xB9, 0xCC, 0xD2, 0x74, 0xC8, 0x2C, 0xB5,
-    0x85, 0x22, 0x62, 0x66, 0x96, 0xA6, 0xCC, 0x52, 0x60, 0x78, 0x99, 0x37, 0xC9, 0x2C, 0x65, 0xB9,
-    0x6D, 0xEE, 0x96, 0xF5, 0xA7, 0x88, 0xCE, 0x43, 0xC0, 0x22, 0x62, 0xCB, 0x54, 0x92, 0x61, 0x48,
-    0x94, 0x86, 0x95, 0xB6, 0xC3, 0xE8, 0x3F, 0x1F, 0x78, 0x4C, 0x74, 0x5B, 0x64, 0xD7, 0x2F, 0x93,
-    0xEB, 0x55, 0x16, 0x7A, 0x4B, 0xCD, 0xED, 0x7B, 0x04, 0x74, 0x8B, 0x06, 0xBA, 0x25, 0x53, 0xBA,
-    0xB5, 0x63, 0x46, 0xAE, 0xD2, 0xAD, 0x3A, 0x83, 0x6E, 0x88, 0x87, 0x50, 0x30, 0x5B, 0x76, 0xCB,
-    0x33, 0xE8, 0x76, 0x5A, 0xA5, 0xEE, 0xD9, 0xBD, 0x2B, 0x75, 0xCF, 0x4F, 0xA8, 0xD4, 0x5D, 0x8E,
-    0x90, 0xDF, 0xE8, 0x5F, 0xFD, 0x5F, 0x31, 0x83, 0x8C, 0x86, 0xBA, 0x69, 0xA5, 0xEE, 0xD5, 0xC9,
-    0x95, 0xBA, 0xD9, 0x35, 0x0D, 0xBB, 0xA6, 0x29, 0x5C, 0xB8, 0x81, 0x2B, 0x17, 0x7C, 0x1E, 0x38,
-    0x5A, 0xDA, 0xE6, 0x5B, 0x5B, 0xB8, 0x80, 0x2B, 0x1E, 0x2D, 0x02, 0x64, 0x8D, 0x8C, 0x2E, 0xFB,
-    0x36, 0x63, 0x19, 0x7E, 0x4A, 0x7D, 0x8D, 0xBD, 0xEC, 0x5B, 0x9F, 0xA3, 0x32, 0xEA, 0xD4, 0xB8,
-    0x84, 0xEA, 0x90, 0x46, 0xC7, 0xF8, 0x47, 0x8C, 0xB8, 0xF5, 0x94, 0x99, 0x16, 0x1A, 0x83, 0x4A,
-    0x9D, 0x2B, 0xEA, 0x19, 0x63, 0xDA, 0x73, 0x13, 0xB9, 0xFE, 0x9E, 0x75, 0x31, 0x76, 0x61, 0x41,
-    0xF1, 0x51, 0x31, 0x84, 0x37, 0x87, 0x2F, 0x2D, 0x60, 0xE5, 0xB7, 0x5B, 0x0A, 0x3D, 0xD1, 0xD8,
-    0x55, 0x58, 0x3A, 0x8A, 0xF9, 0x73, 0xF0, 0x80, 0x78, 0xCA, 0x8F, 0xD3, 0xD6, 0xA1, 0x2F, 0xDE,
-    0x54, 0x39, 0x7F, 0x7E, 0xD2, 0x46, 0x4D, 0x8F, 0x16, 0xE1, 0x25, 0xDE, 0x55, 0xB4, 0x75, 0xE8,
-    0xFE, 0xAA, 0x8B, 0xCD, 0x58, 0xF5, 0xE8, 0xC0, 0xAE, 0xBA, 0x0F, 0x03, 0x75, 0xCD, 0x16, 0x01,
-    0xF8, 0xA2, 0x8C, 0x94, 0x0F, 0x5E, 0x91, 0xF1, 0x12, 0x71, 0xD4, 0xCC, 0x35, 0xCD, 0xE1, 0x73,
-    0xDF, 0xB7, 0x12, 0xE7, 0x79, 0xA0, 0xD6, 0xE7, 0x9E, 0x42, 0xEF, 0xDC, 0x70, 0x88, 0xA5, 0x33,
-    0x36, 0x34, 0xFD, 0xBC, 0x30, 0xB5, 0x96, 0x8B, 0x4C, 0x26, 0xCA, 0x21, 0xA2, 0x18, 0x45, 0x0C,
-    0xFB, 0x08, 0x39, 0x3D, 0xCC, 0x17, 0xB8, 0xA0, 0x11, 0xFA, 0xE6, 0x04, 0xC8, 0xD9, 0x18, 0x68,
-    0x48, 0x82, 0xF2, 0xDF, 0xF8, 0x1C, 0x90, 0x9E, 0x40, 0x73, 0x40, 0xE2, 0x9D, 0x05, 0xBE, 0x01,
-    0xF0, 0xE6, 0x14, 0xF4, 0x00, 0x45, 0xFA, 0xE6, 0xAC, 0x4B, 0x6E, 0xAF, 0x8A, 0x8E, 0xA4, 0xF6,
-    0xFB, 0xFE, 0xB0, 0x33, 0x9F, 0xA3, 0x11, 0xF3, 0xCD, 0xD3, 0xC0, 0xC9, 0x55, 0xEF, 0x41, 0x83,
-    0x70, 0x73, 0x22, 0xF0, 0xDE, 0x01, 0xA8, 0x1C, 0xF8, 0x0A, 0xC0, 0xB7, 0xAA, 0x62, 0x13, 0xFF,
-    0xDD, 0x5D, 0x16, 0x94, 0xF9, 0xD9, 0x66, 0xD6, 0x77, 0xC2, 0xB9, 0x5E, 0x40, 0x74, 0xB7, 0xB7,
-    0x0B, 0xCC, 0x3B, 0x53, 0x63, 0xFA, 0x83, 0xCA, 0x4D, 0x17, 0xB0, 0x75, 0xC7, 0x4B, 0xBD, 0xE6,
-    0x8E, 0xD3, 0x63, 0xFC, 0xE1, 0x4D, 0x61, 0x90, 0xEF, 0xC3, 0xA2, 0x74, 0xD4, 0x7D, 0x95, 0x3C,
-    0x14, 0xFC, 0x97, 0xF7, 0x74, 0xCB, 0x4E, 0xC1, 0x02, 0x76, 0x4C, 0x69, 0x4B, 0x8B, 0x2A, 0x3B,
-    0x1D, 0x62, 0xCC, 0x77, 0xDC, 0xC6, 0x11, 0x7D, 0xC7, 0x58, 0xAA, 0x2D, 0x68, 0x1F, 0x0C, 0x4C,
-    0x57, 0x09, 0x0D, 0xB0, 0x9D, 0x59, 0xB5, 0xDD, 0x85, 0x97, 0x26, 0xEF, 0x9B, 0x6B, 0x18, 0x86,
-    0x28, 0x00, 0x5F, 0xEB, 0xA2, 0xEA, 0xDC, 0x01, 0xDC, 0x9A, 0x89, 0xA5, 0xEA, 0xCD, 0x7B, 0x1C,
-    0xAA, 0x99, 0x61, 0x3E, 0x27, 0x62, 0x38, 0x29, 0xC3, 0x25, 0x69, 0x47, 0x4D, 0x27, 0xC9, 0x35,
-    0x4B, 0x0A, 0xB5, 0x6D, 0x14, 0x5F, 0xB4, 0x78, 0x30, 0x67, 0x0C, 0xFE, 0x13, 0x2B, 0xD3, 0xDB,
-    0x84, 0x8A, 0x41, 0x87, 0x76, 0x4A, 0xF5, 0x10, 0x22, 0xEE, 0xA2, 0xA6, 0xA4, 0x9B, 0xCC, 0x9F,
-    0xD0, 0x7E, 0x83, 0x10, 0x00, 0x63, 0x83, 0x06, 0xB4, 0x9A, 0xD7, 0xFE, 0x34, 0x41, 0xFE, 0x92,
-    0xAE, 0x63, 0xB6, 0x6E, 0x23, 0x12, 0x12, 0xAF, 0x17, 0xA5, 0xEE, 0xDE, 0xF3, 0x25, 0xCA, 0x44,
-    0x2F, 0xD3, 0x09, 0xF5, 0x32, 0x42, 0x5A, 0x1B, 0x84, 0xA7, 0x7A, 0x4D, 0xCC, 0xF4, 0xD6, 0x50,
-    0x93, 0x5C, 0xAF, 0xDD, 0x5A, 0x2E, 0xBF, 0xB7, 0x5B, 0x53, 0x61, 0x33, 0x86, 0xEF, 0x6B, 0xFB,
-    0x50, 0x08, 0xE6, 0x77, 0x84, 0x1E, 0x1F, 0xBE, 0x51, 0xB9, 0x6C, 0x12, 0xBB, 0xEF, 0xCF, 0x6E,
-    0x29, 0x75, 0x4B, 0x6B, 0xDF, 0xD2, 0x3A, 0x1A, 0x69, 0x1D, 0x4F, 0x68, 0x3D, 0x7B, 0xFA, 0x68,
-    0xDD, 0x1E, 0xC9, 0x0C, 0x39, 0x2F, 0x76, 0x51, 0x09, 0x67, 0xF6, 0xD1, 0xFC, 0x81, 0xFA, 0x28,
-    0x38, 0xDE, 0x47, 0xFD, 0xA4, 0x8F, 0xB4, 0x14, 0xBF, 0xD5, 0x58, 0xCF, 0x30, 0x1D, 0x22, 0xAA,
-    0xA4, 0x2A, 0xFA, 0xEA, 0xA5, 0x7E, 0x5F, 0x37, 0x71, 0x79, 0xE0, 0xFF, 0x17, 0xBB, 0x54, 0x6F,
-    0x05, 0xEF, 0x98, 0x2D, 0xE0, 0x3B, 0xAB, 0x5D, 0xFA, 0x4C, 0x77, 0xB5, 0x32, 0x3B, 0x96, 0x12,
-    0x1B, 0x8B, 0x77, 0xFC, 0xE7, 0xEF, 0xE5, 0x96, 0x85, 0x6F, 0x69, 0xF8, 0xA1, 0xDB, 0x98, 0xCB,
-    0xA6, 0x78, 0x80, 0x6D, 0xD5, 0x36, 0x94, 0x62, 0x63, 0x4E, 0x0F, 0x4D, 0x7C, 0xD2, 0xCB, 0x8D,
-    0x67, 0x9C, 0x7C, 0x47, 0x9C, 0x76, 0x59, 0x3E, 0xEC, 0xC6, 0x77, 0x82, 0x4B, 0xD4, 0xD8, 0xFA,
-    0x47, 0x83, 0x4B, 0x74, 0x3D, 0x71, 0x89, 0x82, 0xDD, 0xD8, 0x9D, 0x1A, 0xEE, 0xDC, 0xE8, 0x79,
-    0xB7, 0x6B, 0xBC, 0xF3, 0x5C, 0x83, 0x35, 0xD4, 0x60, 0x9A, 0xA5, 0xEE, 0x55, 0xCF, 0xDE, 0x8B,
-    0xEC, 0xA8, 0x8D, 0x48, 0xB5, 0xBA, 0xDE, 0x4D, 0xB0, 0x67, 0x68, 0xA9, 0x8B, 0x6E, 0x81, 0x28,
-    0x11, 0xC7, 0x49, 0xA0, 0xD2, 0xF0, 0x50, 0x6D, 0xB0, 0xD5, 0xDA, 0x08, 0xA7, 0xB9, 0x47, 0xE9,
-    0x00, 0x65, 0xED, 0x11, 0x75, 0xF8, 0x69, 0xD6, 0xFC, 0x1A, 0x35, 0xFA, 0x71, 0xC5, 0xDC, 0xBA,
-    0xF4, 0x76, 0x6B, 0xF9, 0x63, 0x0C, 0xC4, 0x13, 0xB0, 0x93, 0xEB, 0x6D, 0x77, 0x8D, 0x50, 0x56,
-    0x9A, 0x82, 0x82, 0x5D, 0xC1, 0x8A, 0x5F, 0xEB, 0x1D, 0x2B, 0x64, 0xA1, 0x56, 0x28, 0xCB, 0xD9,
-    0x2C, 0x6A, 0x5C, 0x9D, 0x3A, 0x6F, 0x44, 0xB3, 0x7A, 0x8A, 0x10, 0x87, 0xD6, 0x30, 0xDC, 0x71,
-    0x82, 0xE6, 0x3B, 0x28, 0xD8, 0x4C, 0x91, 0x16, 0xDB, 0xC1, 0x60, 0x9B, 0x20, 0x9B, 0x69, 0x11,
-    0x6B, 0x3A, 0x8D, 0x4D, 0xAF, 0x49, 0x54, 0xF2, 0xB4, 0x59, 0x37, 0xEA, 0x67, 0xFC, 0x73, 0xB4,
-    0xA3, 0xDF, 0xF6, 0x1A, 0x5E, 0x8E, 0xB1, 0x2E, 0x88, 0x31, 0x5D, 0x73, 0x1B, 0xF6, 0xBC, 0x9E,
-    0x86, 0x23, 0xD8, 0xA4, 0x20, 0x9B, 0x12, 0x64, 0x0B, 0xA3, 0x1F, 0x4D, 0x84, 0x0C, 0x28, 0xDD,
-    0x87, 0x0A, 0x6F, 0xA1, 0xC8, 0x5C, 0xC8, 0x2D, 0x83, 0xA7, 0x50, 0x37, 0x11, 0x8E, 0x72, 0xDD,
-    0x4A, 0x98, 0x30, 0x3D, 0x31, 0x28, 0x0F, 0xB1, 0x14, 0x5B, 0xBB, 0x17, 0x81, 0xEE, 0x74, 0x45,
-    0xC7, 0xA4, 0x79, 0x0D, 0x01, 0x7A, 0x9B, 0x62, 0x43, 0x98, 0xBA, 0x3D, 0xBF, 0x82, 0x72, 0x6C,
-    0xEC, 0xE9, 0xF1, 0x92, 0x4F, 0xEE, 0x16, 0x85, 0xD3, 0x59, 0x61, 0xE7, 0xC6, 0x64, 0x56, 0xD0,
-    0x2A, 0xEA, 0x0D, 0xB3, 0x22, 0xBC, 0x65, 0xE9, 0x8C, 0x08, 0x0A, 0x9B, 0xF5, 0x94, 0x4E, 0x3D,
-    0x67, 0xE7, 0x00, 0xF4, 0xE1, 0x0C, 0x95, 0x7B, 0x18, 0x3E, 0xB8, 0x39, 0xEF, 0xB5, 0x2E, 0x50,
-    0x61, 0x8C, 0x3E, 0x21, 0xE1, 0x65, 0x8C, 0x7C, 0x06, 0xEA, 0x55, 0xF8, 0x51, 0x4F, 0xDF, 0x98,
-    0xE6, 0x9F, 0x0D, 0x1D, 0xF0, 0xF4, 0xB8, 0x32, 0xF3, 0x1D, 0x57, 0xE6, 0x8E, 0x93, 0x62, 0x35,
-    0x95, 0x3A, 0x5C, 0xFE, 0x64, 0x3D, 0xD5, 0x57, 0xA7, 0x19, 0x35, 0x8F, 0xD9, 0x95, 0x59, 0x4E,
-    0x20, 0x47, 0x4F, 0x94, 0x1E, 0xB5, 0x94, 0xEC, 0xED, 0xC4, 0x0C, 0xEB, 0x3B, 0x9C, 0x5F, 0xCB,
-    0x3B, 0x0E, 0xA8, 0x53, 0x53, 0xA5, 0xA6, 0x46, 0x4D, 0x2D, 0x4F, 0xF5, 0x69, 0xA7, 0x4E, 0xDF,
-    0x13, 0x24, 0x47, 0x40, 0x7A, 0x26, 0x98, 0xEA, 0xCE, 0xE7, 0x01, 0xA9, 0x46, 0x10, 0x64, 0x15,
-    0x35, 0x66, 0x2A, 0xCC, 0xAA, 0x2F, 0x5B, 0x75, 0x79, 0x17, 0x78, 0xFD, 0x2E, 0x38, 0x2B, 0xEA,
-    0xD2, 0x6E, 0xD8, 0x6A, 0xEC, 0x8E, 0xAD, 0xC6, 0x6E, 0xD9, 0x6A, 0xEC, 0x9E, 0xAD, 0x66, 0xCF,
-    0x61, 0xDD, 0xB5, 0xD5, 0xD8, 0x6D, 0x5B, 0x8D, 0xDD, 0xB7, 0xD5, 0xEC, 0x21, 0x45, 0x6E, 0xCB,
-    0x12, 0x86, 0xAC, 0xC8, 0x94, 0x85, 0x1B, 0x4E, 0x32, 0xBB, 0x77, 0xAB, 0xB1, 0x9B, 0xB7, 0x1A,
-    0xBB, 0x7B, 0xAB, 0xB1, 0xDB, 0xB7, 0x1A, 0xBB, 0x7F, 0xAB, 0xB1, 0x1B, 0xB8, 0x1A, 0xBB, 0x83,
-    0xAB, 0xB1, 0x5B, 0xB8, 0x1A, 0xBB, 0x87, 0xAB, 0xB1, 0x9B, 0xB8, 0x1A, 0xBB, 0x8B, 0xAB, 0xB1,
-    0xDB, 0xB8, 0x1A, 0xBB, 0x8F, 0xAB, 0xD1, 0x8D, 0x5C, 0xE9, 0xC6, 0x06, 0xAE, 0x75, 0x2B, 0xD7,
-    0xA1, 0x80, 0x76, 0xB5, 0x9B, 0x5F, 0xEC, 0xA2, 0x93, 0x9C, 0xF8, 0x6F, 0x17, 0x05, 0xB7, 0x2A,
-    0x0C, 0xFB, 0x65, 0x8C, 0xFE, 0xC7, 0x92, 0x01, 0xF3, 0x40, 0x19, 0x92, 0xD6, 0x58, 0xB5, 0x95,
-    0xC9, 0xB1, 0x95, 0xE9, 0xB6, 0xAC, 0x90, 0x85, 0xF0, 0xF7, 0x8F, 0x2B, 0x94, 0x72, 0x9A, 0xFF,
-    0x9A, 0x21, 0xF1, 0x88, 0xA4, 0x6F, 0x12, 0x13, 0x4A, 0xFB, 0x9B, 0x38, 0x8D, 0xBE, 0x23, 0x28,
-    0xCC, 0x61, 0xAC, 0x6D, 0x84, 0x53, 0x02, 0xCD, 0x37, 0xA8, 0x08, 0xD0, 0xF8, 0x15, 0x62, 0xEB,
-    0x9B, 0xD9, 0x6D, 0x64, 0x1D, 0x34, 0xE6, 0x6E, 0x45, 0xD4, 0x6F, 0x88, 0xB2, 0xB5, 0xBC, 0x27,
-    0xC2, 0x68, 0x88, 0x64, 0x9D, 0xB1, 0x5E, 0xAC, 0x28, 0x9D, 0x4E, 0xE6, 0xC4, 0x4C, 0xE6, 0x84,
-    0xD3, 0x24, 0x1A, 0x37, 0xB5, 0x1F, 0xBD, 0x94, 0x1E, 0x96, 0x58, 0x5B, 0x51, 0x26, 0x49, 0x68,
-    0x7B, 0x88, 0xF4, 0x43, 0x4F, 0xFD, 0xB2, 0xF1, 0xB1, 0x9A, 0x82, 0x4A, 0x6A, 0xBB, 0xE5, 0xA5,
-    0xFA, 0xAA, 0xD8, 0xB0, 0x97, 0x09, 0x0F, 0xD8, 0xE4, 0x26, 0x61, 0x43, 0x93, 0xD4, 0x55, 0x6B,
-    0x42, 0xF5, 0x2A, 0x5C, 0xCA, 0x54, 0xC7, 0xF5, 0xBC, 0x72, 0xAB, 0x6D, 0x9C, 0x6B, 0x99, 0x61,
-    0x86, 0xE7, 0x2F, 0x16, 0xD6, 0xB8, 0xA8, 0xB5, 0x60, 0x8C, 0x56, 0x80, 0xD2, 0xA5, 0x19, 0x97,
-    0xD0, 0x7A, 0x2E, 0x93, 0x21, 0x62, 0x25, 0x02, 0x74, 0xB1, 0x5F, 0xE3, 0x11, 0xEA, 0xDC, 0x36,
-    0xAD, 0x9D, 0xBB, 0x2C, 0x9A, 0x79, 0x80, 0xD1, 0x42, 0x39, 0x95, 0x51, 0xB5, 0x47, 0x8B, 0x66,
-    0x2E, 0x6C, 0xF0, 0x0C, 0x02, 0xEA, 0xCD, 0xEC, 0xF0, 0x6B, 0x32, 0xC4, 0xF2, 0xA3, 0xBB, 0x4C,
-    0x85, 0xF6, 0xE8, 0x73, 0xA8, 0x8C, 0xCF, 0xAD, 0xA6, 0xBA, 0xEB, 0xD1, 0x74, 0xAB, 0xA9, 0x54,
-    0xD7, 0x46, 0xDA, 0xCB, 0x93, 0x32, 0x29, 0x75, 0xAB, 0xA9, 0x5F, 0x62, 0xAB, 0xA9, 0xB7, 0xCB,
-    0x59, 0xDF, 0xCA, 0xCA, 0xAF, 0xF9, 0xBE, 0xA9, 0x67, 0x1C, 0x09, 0xE6, 0xD5, 0x48, 0x0E, 0xFD,
-    0xFE, 0x84, 0x9F, 0x27, 0x9E, 0xC4, 0xCF, 0x23, 0x0B, 0x65, 0x05, 0xBD, 0x6E, 0x05, 0xE1, 0xF1,
-    0x2D, 0xD5, 0xF0, 0x76, 0x0A, 0x60, 0x3C, 0x66, 0x12, 0x5B, 0x83, 0xA9, 0xEA, 0x70, 0xFD, 0x24,
-    0x46, 0x43, 0x2D, 0x07, 0xD8, 0x7E, 0xAB, 0xD4, 0x15, 0x51, 0xF1, 0x5C, 0x7B, 0x40, 0xDD, 0x32,
-    0x6C, 0x44, 0x68, 0x65, 0x1B, 0x9B, 0x2F, 0x65, 0x25, 0xB6, 0x02, 0xD5, 0x25, 0xB9, 0xA9, 0x49,
-    0xC8, 0xCA, 0xB8, 0x8D, 0x62, 0xC4, 0x42, 0xE1, 0xFB, 0xE0, 0xF6, 0x82, 0x3B, 0x26, 0x38, 0x8B,
-    0x52, 0xEC, 0xAC, 0x1D, 0xB7, 0x96, 0xAE, 0xCA, 0x21, 0xEF, 0xD3, 0x29, 0xB6, 0xE2, 0xB0, 0x66,
-    0x23, 0x97, 0xCA, 0xBE, 0x98, 0x93, 0xB9, 0xD1, 0x5B, 0x70, 0xCB, 0x75, 0xC1, 0x20, 0x53, 0xC8,
-    0x5E, 0xBA, 0xA2, 0x84, 0x2C, 0x50, 0x37, 0x9A, 0x9B, 0x15, 0xD6, 0xC8, 0xB5, 0xF0, 0x0F, 0x5F,
-    0xEC, 0xBA, 0xAF, 0x75, 0xC8, 0x18, 0x2A, 0xB6, 0xB6, 0x92, 0x93, 0xC6, 0x65, 0x43, 0x65, 0x8A,
-    0x2C, 0x56, 0xDB, 0x09, 0xF1, 0x4B, 0xBD, 0xD6, 0x54, 0x53, 0x73, 0xC9, 0x3A, 0xEC, 0xAE, 0x48,
-    0x0B, 0x97, 0xFB, 0x42, 0xE9, 0xC4, 0x2A, 0x11, 0x74, 0x66, 0x93, 0xCA, 0x36, 0x2F, 0x58, 0x0D,
-    0x2F, 0xEA, 0xE2, 0x11, 0xD5, 0xF6, 0xAE, 0x70, 0x8C, 0x34, 0xBE, 0x7D, 0xED, 0xE7, 0xFD, 0x5F,
-    0x16, 0x79, 0xA8, 0x3B, 0x3C, 0xE7, 0x33, 0xD4, 0xEC, 0x01, 0xD9, 0xD1, 0x09, 0x22, 0xE8, 0xF9,
-    0x9B, 0x59, 0x85, 0x8D, 0x98, 0x66, 0x50, 0xA8, 0x41, 0x89, 0xA8, 0x9D, 0x1A, 0xFA, 0x5B, 0x04,
-    0xD8, 0xF3, 0x63, 0xC6, 0x2D, 0x7B, 0x4F, 0xFC, 0x2C, 0x16, 0x57, 0x32, 0xDD, 0x72, 0xB2, 0xE1,
-    0xF1, 0x59, 0xE7, 0xEB, 0xFD, 0x3B, 0xF7, 0x99, 0x55, 0x66, 0x2B, 0xAB, 0x17, 0x4C, 0x07, 0xED,
-    0xBC, 0xB2, 0x76, 0x86, 0x88, 0x0C, 0x6D, 0xB0, 0x55, 0x31, 0x7C, 0x01, 0x7F, 0xA0, 0x53, 0x3C,
-    0x68, 0x5F, 0x64, 0x25, 0xC8, 0x42, 0x73, 0xD6, 0x33, 0x5B, 0xF0, 0xC8, 0x6E, 0x96, 0x31, 0x6E,
-    0x27, 0x24, 0x32, 0xD0, 0x32, 0x1F, 0x25, 0x85, 0x62, 0x58, 0x5C, 0x48, 0xB7, 0x48, 0xB4, 0xA1,
-    0x74, 0xDE, 0x7F, 0xB7, 0x40, 0xE5, 0x21, 0x6C, 0xAE, 0xC3, 0xD4, 0xB6, 0xA1, 0xF0, 0x87, 0x57,
-    0xB8, 0x12, 0xA5, 0x1B, 0x42, 0x19, 0x4C, 0xFB, 0xC6, 0x66, 0x02, 0x16, 0xC7, 0x83, 0x09, 0x26,
-    0x29, 0x48, 0xB3, 0x9D, 0x64, 0xA8, 0x25, 0x7E, 0xDA, 0xC9, 0xFE, 0x17, 0xAD, 0x4C, 0x6C, 0x99,
-    0xDA, 0x5A, 0x60, 0x45, 0x21, 0xAB, 0xE3, 0x35, 0x43, 0xA5, 0x16, 0x3B, 0xA7, 0x23, 0x46, 0xE6,
-    0x67, 0xA5, 0x96, 0x77, 0xF6, 0x7A, 0x54, 0x91, 0xB6, 0xC9, 0x0F, 0x81, 0x32, 0x7C, 0x8A, 0xEB,
-    0x97, 0xAE, 0x50, 0xED, 0xDF, 0xD7, 0x7D, 0x24, 0xC2, 0x0F, 0xAE, 0x76, 0xCC, 0x64, 0x4C, 0x77,
-    0x12, 0x09, 0xC3, 0x8D, 0x93, 0x4F, 0xE6, 0xD5, 0x17, 0x45, 0x34, 0x9C, 0x96, 0xC6, 0x87, 0xD3,
-    0x13, 0x7E, 0xB3, 0x0D, 0x0B, 0xFB, 0x20, 0x6D, 0xBC, 0x44, 0x9C, 0x49, 0xEA, 0x77, 0xAF, 0xA2,
-    0x48, 0x02, 0x74, 0x3B, 0x4D, 0x67, 0xBB, 0xC2, 0xD2, 0x39, 0xCF, 0x90, 0x17, 0x24, 0x43, 0x49,
-    0x07, 0x3D, 0xF6, 0x4E, 0x36, 0x70, 0x3C, 0x35, 0x54, 0x7C, 0x0E, 0xF5, 0x18, 0x5A, 0x0E, 0x42,
-    0x3C, 0xFF, 0x3D, 0x1C, 0x3D, 0xB7, 0x5B, 0xA3, 0xE1, 0xF1, 0x12, 0x7A, 0xF2, 0xF8, 0xC6, 0x4A,
-    0x50, 0xB6, 0x42, 0xE9, 0xE4, 0x9B, 0xA3, 0x4D, 0xFC, 0xFF, 0x46, 0x39, 0x1A, 0xE5, 0x9E, 0xB1,
-    0xCB, 0x1B, 0xAD, 0x31, 0x53, 0x6C, 0x13, 0x65, 0x9F, 0x39, 0xB2, 0xFC, 0x3D, 0x5D, 0x46, 0x39,
-    0x61, 0x8B, 0x10, 0xFB, 0x51, 0x0C, 0x00, 0x65, 0x9B, 0x78, 0x74, 0xD2, 0x40, 0x78, 0x52, 0x72,
-    0x3F, 0x2E, 0x5D, 0x56, 0xF1, 0x09, 0xCB, 0x38, 0x44, 0x2A, 0x1F, 0xCB, 0xF8, 0x54, 0x9C, 0xFA,
-    0x84, 0xF6, 0x34, 0xC4, 0xFA, 0xBE, 0x49, 0x06, 0xE0, 0xDE, 0xA1, 0x77, 0x31, 0x92, 0x61, 0xE5,
-    0x66, 0xEE, 0x91, 0xAF, 0x86, 0xFD, 0x7B, 0x32, 0x6E, 0xFF, 0xC0, 0xAC, 0x2F, 0xD5, 0xCD, 0x82,
-    0x21, 0x1A, 0xDE, 0x1F, 0xEB, 0x4D, 0x8E, 0x45, 0x27, 0xAB, 0x77, 0xB1, 0xB6, 0x17, 0x1F, 0x5C,
-    0x65, 0x6A, 0x5C, 0x67, 0xEB, 0x06, 0x5E, 0x72, 0xCB, 0x18, 0x9A, 0x91, 0x12, 0x08, 0x67, 0x18,
-    0x22, 0x6A, 0x48, 0x3F, 0x75, 0xA1, 0xE4, 0xF6, 0x75, 0x66, 0x8D, 0x63, 0x22, 0xEC, 0x93, 0x6C,
-    0x9F, 0x52, 0x45, 0x0E, 0x80, 0x93, 0x5F, 0x6A, 0x07, 0xB3, 0x59, 0x32, 0x8A, 0x67, 0x27, 0xC4,
-    0x2E, 0x39, 0xE1, 0x02, 0xDD, 0xFA, 0xEF, 0x51, 0x17, 0x21, 0xEB, 0x84, 0xC9, 0x64, 0xA0, 0xE1,
-    0x45, 0xAE, 0x76, 0x17, 0x16, 0x70, 0x4A, 0xA9, 0x61, 0x54, 0xE1, 0x85, 0xC5, 0xE2, 0x58, 0xD9,
-    0x11, 0xEB, 0xD2, 0xD4, 0xD8, 0xD5, 0x8C, 0x90, 0x19, 0x29, 0x33, 0xC2, 0xF9, 0xC7, 0xDC, 0x66,
-    0xF8, 0xA7, 0xAC, 0x29, 0xF3, 0x36, 0x6B, 0x58, 0x33, 0x83, 0x8C, 0x79, 0x64, 0x5E, 0x03, 0xE8,
-    0x57, 0x80, 0xC8, 0xFF, 0x42, 0x59, 0x12, 0x40, 0x14, 0x62, 0x44, 0x5E, 0x95, 0x40, 0xE9, 0x48,
-    0x81, 0x08, 0xF5, 0xDF, 0x64, 0x01, 0xF4, 0x56, 0x54, 0x65, 0x16, 0x08, 0x9D, 0x7B, 0x93, 0xAD,
-    0x20, 0x26, 0x67, 0x34, 0x57, 0x42, 0x2B, 0x16, 0x58, 0x11, 0x52, 0x7C, 0x86, 0x55, 0x39, 0xD8,
-    0x78, 0x28, 0xA7, 0xE2, 0xDB, 0x94, 0xDB, 0xCA, 0x78, 0x5A, 0x5D, 0x65, 0x62, 0x38, 0xF9, 0xE4,
-    0x6B, 0xFF, 0x9F, 0xB4, 0x2A, 0xC6, 0xA7, 0xAF, 0x8A, 0x4F, 0x3E, 0x4D, 0xC9, 0x4F, 0xCE, 0xC1,
-    0x63, 0x1E, 0xCF, 0x36, 0x9D, 0xFA, 0x60, 0x6D, 0x84, 0x36, 0x68, 0xF8, 0xED, 0x5E, 0x2B, 0xE0,
-    0x27, 0x51, 0x73, 0xF3, 0x2C, 0x74, 0xBF, 0x35, 0x37, 0x33, 0xC6, 0xEF, 0x9E, 0x5E, 0x73, 0x93,
-    0xAF, 0x77, 0x80, 0x25, 0xBC, 0x03, 0x8F, 0x39, 0x38, 0x41, 0x2E, 0x39, 0xB5, 0x2C, 0x67, 0xE9,
-    0x32, 0xCC, 0xC7, 0xB2, 0x9C, 0xAC, 0x30, 0xD7, 0x0E, 0x60, 0x2C, 0xCB, 0xC9, 0x32, 0x73, 0x34,
-    0x73, 0xC5, 0x3B, 0x65, 0x39, 0xCD, 0x91, 0xB2, 0x9C, 0x9F, 0x24, 0x6D, 0x7F, 0xA3, 0xEB, 0x99,
-    0xDE, 0xFF, 0x28, 0xFE, 0x4D, 0x20, 0xF1, 0xC3, 0x0C, 0xDF, 0x4F, 0xA4, 0x17, 0x20, 0x3B, 0x59,
-    0xAA, 0x6B, 0x17, 0xD8, 0x1E, 0x38, 0x85, 0x8D, 0xA8, 0x47, 0x5E, 0x37, 0xA3, 0xD7, 0x6A, 0x56,
-    0x9F, 0x4F, 0x3D, 0xAD, 0x7B, 0x18, 0xD5, 0x63, 0xB6, 0x85, 0xCD, 0x1E, 0x3C, 0x35, 0xEC, 0x7C,
-    0x77, 0x73, 0x8C, 0xD7, 0x97, 0xCB, 0xE2, 0x58, 0x98, 0x54, 0x72, 0xD4, 0x51, 0xA3, 0x4A, 0xAB,
-    0xDE, 0x3F, 0xAC, 0xCD, 0x17, 0x68, 0xF5, 0x4C, 0x20, 0x5B, 0xD9, 0xF6, 0xBC, 0xA4, 0xD2, 0x25,
-    0x23, 0x3A, 0xB0, 0xD0, 0x60, 0xF9, 0x91, 0x4F, 0x0A, 0xBC, 0xB3, 0xF0, 0x7C, 0x52, 0xDB, 0xE8,
-    0xA9, 0xF4, 0x10, 0xEA, 0x7E, 0x1F, 0x4E, 0x7A, 0x48, 0x8F, 0xAD, 0x74, 0x33, 0x6A, 0x63, 0x7E,
-    0x1D, 0xD3, 0x88, 0x42, 0xF3, 0x09, 0xF3, 0xC0, 0x45, 0x12, 0xAC, 0x29, 0xF4, 0x37, 0x36, 0xDF,
-    0x83, 0x99, 0x32, 0x76, 0x2F, 0x1A, 0x6E, 0xA1, 0xC3, 0x13, 0x50, 0x54, 0xDD, 0xD6, 0xD4, 0xD4,
-    0xEA, 0xA5, 0xD2, 0x71, 0xF4, 0x6A, 0x75, 0x24, 0x56, 0xA1, 0xE3, 0x96, 0x22, 0x51, 0xAC, 0xC4,
-    0xDA, 0x4E, 0x2C, 0x72, 0x9B, 0xB1, 0x17, 0xA0, 0xEC, 0x69, 0xF2, 0x83, 0xAF, 0x51, 0xB0, 0xEA,
-    0x56, 0x52, 0xA6, 0xB6, 0x80, 0xE1, 0x88, 0x4E, 0x56, 0x02, 0xFE, 0x3A, 0x1A, 0xA0, 0x9F, 0xBC,
-    0x3D, 0x7B, 0x28, 0x3F, 0xCF, 0x37, 0x11, 0xF5, 0x5C, 0x52, 0x96, 0xC7, 0xA7, 0x98, 0x29, 0x9F,
-    0x9A, 0x6E, 0xA0, 0xB1, 0x72, 0x0F, 0x26, 0xCA, 0x02, 0x8F, 0xE6, 0xD1, 0x09, 0xDA, 0xDA, 0x13,
-    0xD8, 0x21, 0x17, 0xDF, 0xC5, 0x96, 0x8A, 0x21, 0x8B, 0xEE, 0xD2, 0x12, 0x65, 0x92, 0xAF, 0xE0,
-    0x5A, 0xAD, 0x3B, 0xBC, 0x0D, 0x4E, 0xB2, 0x21, 0x3F, 0x35, 0xDD, 0x62, 0x96, 0x17, 0xDF, 0x81,
-    0x59, 0xB6, 0x52, 0xFB, 0x75, 0xC0, 0x90, 0xC9, 0xFC, 0xC0, 0x98, 0x97, 0x91, 0x19, 0xF3, 0xFC,
-    0x0E, 0xEF, 0x74, 0x19, 0x6C, 0x34, 0xC2, 0xB0, 0x6F, 0xA4, 0x75, 0xE8, 0x9B, 0x60, 0xA7, 0x6F,
-    0x52, 0xD7, 0x37, 0xDC, 0x34, 0xE2, 0x94, 0xBE, 0x09, 0x76, 0xFB, 0xC6, 0x3B, 0xBB, 0x6F, 0x40,
-    0xC6, 0xBF, 0x3E, 0xD2, 0x37, 0x1C, 0x40, 0xF0, 0x6C, 0xD9, 0xF0, 0x0C, 0x58, 0x01, 0x4E, 0x18,
-    0x54, 0x10, 0xDE, 0x0F, 0x12, 0x92, 0xEE, 0xBC, 0x20, 0xB5, 0x1B, 0x46, 0x74, 0x58, 0x20, 0x3B,
-    0xE1, 0xD2, 0x2F, 0x81, 0x83, 0xF6, 0x9D, 0xD7, 0xAB, 0xFA, 0xB7, 0x7F, 0xB6, 0xEF, 0xF2, 0x38,
-    0xB8, 0xEC, 0x9D, 0x4B, 0xF4, 0x7E, 0x1C, 0x9B, 0x07, 0x7F, 0x6A, 0x25, 0x78, 0x9A, 0x1D, 0x70,
-    0x9E, 0x7C, 0x93, 0x49, 0xB2, 0x62, 0xCA, 0xCF, 0x43, 0x6C, 0x55, 0xD9, 0xBF, 0xAB, 0xDE, 0xCB,
-    0xFE, 0x8C, 0xBA, 0x36, 0x43, 0xBF, 0xA8, 0x3D, 0xCE, 0xD9, 0xE7, 0xAC, 0x75, 0xEE, 0x74, 0xCD,
-    0x24, 0x33, 0x43, 0xC4, 0xC6, 0xC3, 0x20, 0xE8, 0xB9, 0x21, 0xFA, 0x68, 0x5F, 0x11, 0x14, 0xA8,
-    0x6C, 0x79, 0xB3, 0xD7, 0x53, 0x8A, 0x92, 0x28, 0x5E, 0x13, 0xC1, 0x77, 0x32, 0x22, 0x99, 0x91,
-    0x13, 0x64, 0xBF, 0x8C, 0xF4, 0xCC, 0x84, 0xD7, 0x89, 0x70, 0xC7, 0x7B, 0x76, 0x7A, 0xEB, 0x2D,
-    0x51, 0x97, 0x4E, 0x94, 0x5D, 0x55, 0x73, 0xCF, 0x56, 0x76, 0x3F, 0xAD, 0x1D, 0x89, 0x3F, 0xB5,
-    0x7A, 0x4A, 0xBB, 0xCE, 0xFF, 0x93, 0x36, 0xBC, 0xF3, 0x60, 0x2D, 0x65, 0xB9, 0x46, 0xCD, 0x6A,
-    0xB9, 0xF2, 0x28, 0xEB, 0x2E, 0x75, 0x39, 0x79, 0x37, 0xF9, 0x77, 0x30, 0xF9, 0x60, 0xF7, 0xB4,
-    0x6B, 0x25, 0x8B, 0x6B, 0xD2, 0x00, 0x7F, 0xF9, 0xE9, 0x4D, 0x34, 0x52, 0xAF, 0xC0, 0x9F, 0x4F,
-    0x9E, 0xAF, 0x8B, 0xD5, 0xA5, 0x4F, 0x36, 0xD1, 0xA8, 0x39, 0x9E, 0x68, 0x74, 0xEB, 0xBC, 0x89,
-    0x46, 0x97, 0xF8, 0xD7, 0x58, 0x17, 0x62, 0x36, 0xFC, 0x42, 0x6A, 0x0B, 0x89, 0x9D, 0x4A, 0xFF,
-    0xEE, 0x6C, 0xFA, 0x5F, 0x5C, 0xF6, 0x77, 0xBE, 0xCF, 0x3C, 0xDA, 0xCE, 0x42, 0x6F, 0xD1, 0xDF,
-    0xBE, 0x72, 0x16, 0xFD, 0xBB, 0x7B, 0xD0, 0x5F, 0x73, 0xF0, 0xA8, 0x0E, 0xDA, 0x7C, 0x71, 0x92,
-    0x93, 0xD4, 0x24, 0x31, 0xB5, 0x8C, 0x0B, 0x49, 0x49, 0x4A, 0x92, 0x90, 0xA0, 0xE3, 0xB3, 0x37,
-    0xFA, 0x5B, 0xFB, 0xF0, 0xF2, 0x54, 0xEA, 0xF0, 0x21, 0x0D, 0x49, 0x42, 0x52, 0x90, 0x04, 0x04,
-    0xFD, 0x48, 0x3E, 0x50, 0x6F, 0x0D, 0xE2, 0xC1, 0x25, 0xE2, 0x37, 0xFF, 0x0F, 0xE5, 0x5B, 0x3D,
-    0x90, 0xDD, 0xD4, 0x15, 0x3E, 0x92, 0xEC, 0xD5, 0x78, 0x55, 0x88, 0xCC, 0xE0, 0x09, 0x6B, 0x87,
-    0x88, 0x22, 0x05, 0xF1, 0xC4, 0x79, 0x2D, 0x05, 0x20, 0x01, 0x03, 0xCC, 0xA4, 0x22, 0x33, 0x5E,
-    0x52, 0xA4, 0x80, 0xC2, 0x0D, 0x34, 0x6E, 0x52, 0xA4, 0x00, 0x4B, 0xA1, 0x49, 0x91, 0x22, 0xDB,
-    0x90, 0x26, 0xCD, 0x26, 0x71, 0x66, 0xC8, 0xA6, 0xA0, 0xA1, 0x8B, 0xD7, 0x12, 0x93, 0x32, 0x45,
-    0x5E, 0xEA, 0x14, 0x08, 0x98, 0x0C, 0x09, 0x14, 0x68, 0x92, 0xE7, 0x89, 0x16, 0x4B, 0xBA, 0x9C,
-    0xEF, 0x9C, 0x2B, 0x3D, 0xBD, 0x85, 0xF1, 0x6E, 0x42, 0xB2, 0xEF, 0xBD, 0x5D, 0xD9, 0x7B, 0xF4,
-    0x7F, 0x75, 0xEE, 0xF9, 0xEE, 0x3D, 0xBF, 0xF7, 0x11, 0x05, 0x25, 0xF1, 0x16, 0x56, 0xA0, 0xD1,
-    0x0C, 0x34, 0x6E, 0x40, 0x9F, 0x14, 0xBA, 0x7F, 0x13, 0xB4, 0x89, 0x99, 0x38, 0x4D, 0x9C, 0x10,
-    0x79, 0xB3, 0xA8, 0x60, 0x5A, 0x85, 0x4C, 0x83, 0x12, 0x2F, 0x87, 0x53, 0x9F, 0x5F, 0x8E, 0x0A,
-    0x8F, 0x5F, 0x9E, 0x64, 0x6E, 0xCD, 0x0D, 0xF0, 0xB3, 0x44, 0xF9, 0xF6, 0x76, 0x4B, 0x64, 0x78,
-    0x23, 0x47, 0xA8, 0xDB, 0xED, 0xED, 0xE5, 0x19, 0x1E, 0x8B, 0x0A, 0xBC, 0x12, 0x4E, 0x43, 0x7E,
-    0x3D, 0xA8, 0xD0, 0xA0, 0x5F, 0x4D, 0xD0, 0x6C, 0x8D, 0x4F, 0xB8, 0x4D, 0x8A, 0x8F, 0xB6, 0x1D,
-    0xA8, 0x90, 0xF9, 0xE6, 0x64, 0xA0, 0x41, 0x35, 0xE7, 0x59, 0x8F, 0xF5, 0xFA, 0x36, 0xFF, 0xA5,
-    0x66, 0x46, 0x9E, 0x31, 0x1D, 0xB9, 0x07, 0xCF, 0x19, 0xA2, 0x8C, 0x62, 0xDC, 0x42, 0xEB, 0x84,
-    0x0F, 0x51, 0x68, 0x8F, 0x2E, 0x19, 0x53, 0x80, 0xAF, 0x22, 0xE8, 0xDE, 0x8C, 0x8A, 0x49, 0xC9,
-    0xD7, 0xF8, 0x49, 0x26, 0x09, 0x93, 0x14, 0x6F, 0xF0, 0x51, 0x5C, 0xC4, 0xFC, 0x50, 0x31, 0xB9,
-    0xFB, 0xD2, 0xA7, 0x45, 0x68, 0xCC, 0xCF, 0x0A, 0xD7, 0xB4, 0x41, 0x41, 0xE7, 0x93, 0x81, 0xA1,
-    0xEB, 0xC2, 0x2A, 0x38, 0x68, 0x45, 0x52, 0xC3, 0xB5, 0xC9, 0xCE, 0x5C, 0x96, 0x5F, 0xBB, 0x23,
-    0xCF, 0x3E, 0x39, 0xA7, 0x1B, 0x72, 0x5D, 0x65, 0x1F, 0x68, 0x9F, 0x12, 0x3A, 0xB4, 0xAD, 0x3C,
-    0x32, 0x1B, 0xFF, 0xE0, 0x9D, 0x6F, 0x98, 0x7D, 0xE7, 0x25, 0x48, 0xD5, 0x9F, 0x82, 0x6B, 0x1C,
-    0xA5, 0x99, 0x95, 0x0A, 0x55, 0x03, 0xA1, 0x65, 0x20, 0xB4, 0x21, 0x28, 0x48, 0x8B, 0x34, 0xE1,
-    0x6B, 0x51, 0xF5, 0xBA, 0xC8, 0xF1, 0x65, 0xF0, 0x07, 0x54, 0xDC, 0x59, 0x94, 0x81, 0x69, 0x6F,
-    0xBA, 0x6E, 0xD2, 0xE7, 0xED, 0x1A, 0x3A, 0x00, 0x7E, 0xBC, 0x8A, 0xDC, 0x96, 0x3F, 0xED, 0x9B,
-    0xEF, 0x71, 0x2B, 0xEF, 0xF1, 0x2B, 0x31, 0x5F, 0xA2, 0x9A, 0x6E, 0x13, 0x25, 0xF4, 0xE0, 0x32,
-    0xA4, 0xBF, 0x29, 0x92, 0xF7, 0x75, 0x76, 0xD6, 0xF2, 0xF9, 0xD7, 0x22, 0x9C, 0x6D, 0xA9, 0x1C,
-    0xC7, 0xD2, 0xCF, 0xD6, 0x4E, 0xFA, 0x17, 0x85, 0xA5, 0xA4, 0x97, 0x97, 0x57, 0xE6, 0xDC, 0x8F,
-    0x5F, 0x19, 0xEE, 0x86, 0xF7, 0x6F, 0x34, 0x52, 0x34, 0x98, 0xE8, 0x13, 0xA2, 0x07, 0xC8, 0xE9,
-    0xFB, 0x74, 0x11, 0xE3, 0xCF, 0xE8, 0xD7, 0x33, 0xBA, 0xF3, 0xFD, 0xBC, 0xA0, 0x47, 0x08, 0x1F,
-    0x53, 0x1D, 0x26, 0xA2, 0xF2, 0xEC, 0xD1, 0x46, 0x6E, 0x2A, 0x86, 0xCA, 0x54, 0xAE, 0xF9, 0xED,
-    0xF3, 0x55, 0x50, 0xF3, 0x35, 0x7E, 0x92, 0xC9, 0x94, 0x09, 0xB3, 0x16, 0xE0, 0x28, 0xAC, 0x58,
-    0x40, 0x69, 0x15, 0xB4, 0x3F, 0xB8, 0x57, 0x31, 0xA4, 0x1F, 0x54, 0x94, 0x9B, 0xA7, 0x2B, 0x72,
-    0x5E, 0x50, 0x55, 0x79, 0x20, 0x34, 0x97, 0x99, 0xE0, 0x8F, 0x74, 0x0C, 0x84, 0x17, 0x55, 0x3F,
-    0xC2, 0x58, 0xA8, 0x1F, 0xE9, 0x91, 0xF0, 0x2A, 0x4C, 0x8F, 0x30, 0xF3, 0xD7, 0x70, 0x1E, 0x5C,
-    0x42, 0xB7, 0x26, 0xC2, 0xE1, 0x3B, 0x3D, 0xF1, 0x4B, 0x72, 0xBA, 0x00, 0xEA, 0xE9, 0x79, 0x6E,
-    0xE9, 0xBD, 0xE9, 0x78, 0x46, 0xBC, 0x40, 0xE7, 0x96, 0xA3, 0x8F, 0x1E, 0xE0, 0x7F, 0xDC, 0xD9,
-    0x84, 0x19, 0xF1, 0xCC, 0x3D, 0xE6, 0x29, 0x78, 0xC3, 0x70, 0xE3, 0x9B, 0x74, 0x65, 0x2E, 0x6F,
-    0x95, 0xB4, 0xCA, 0xB8, 0x5B, 0xD0, 0x50, 0xE5, 0x1A, 0x6A, 0x28, 0x6E, 0x78, 0x7A, 0x95, 0x5B,
-    0x6C, 0x5F, 0x23, 0xBA, 0x9B, 0xD7, 0xE4, 0x4C, 0x83, 0xBE, 0x1B, 0x62, 0x30, 0x7D, 0x83, 0x2E,
-    0x1C, 0x56, 0x58, 0x4B, 0x82, 0x67, 0x73, 0x57, 0x18, 0x16, 0x51, 0xA6, 0x62, 0xBD, 0x5A, 0xF4,
-    0x47, 0x05, 0x17, 0x16, 0x60, 0xF0, 0x3C, 0x46, 0xCF, 0x3A, 0xC2, 0x70, 0x3C, 0x07, 0xEA, 0x77,
-    0xE8, 0x2E, 0x20, 0x09, 0x30, 0x2E, 0x27, 0x7F, 0xE6, 0xE6, 0x53, 0x66, 0x88, 0xF5, 0xF7, 0x4D,
-    0xE0, 0x72, 0x7E, 0x59, 0x66, 0x9C, 0xB7, 0x97, 0x45, 0x82, 0xBD, 0xC1, 0x93, 0x23, 0xB9, 0x06,
-    0x69, 0x61, 0x53, 0x17, 0x4B, 0x0C, 0x8D, 0xCC, 0x14, 0xFF, 0xA9, 0xA7, 0x78, 0x82, 0xF9, 0x62,
-    0xD8, 0xBD, 0x83, 0x1B, 0x05, 0x26, 0x9E, 0x11, 0x7C, 0xEB, 0xB5, 0x73, 0xB4, 0x68, 0x63, 0xB7,
-    0x17, 0x28, 0xB4, 0x34, 0xC1, 0x87, 0xD9, 0x7D, 0xF9, 0x51, 0xA2, 0x19, 0xF1, 0xBC, 0xDA, 0x7F,
-    0x8E, 0xDB, 0x8B, 0xD9, 0x5E, 0x30, 0x6A, 0x99, 0x68, 0x99, 0xA5, 0xC0, 0x64, 0x8D, 0xFC, 0xFE,
-    0x08, 0x13, 0xF1, 0x6C, 0x4F, 0x13, 0x10, 0xA2, 0xA7, 0xA1, 0x8E, 0x29, 0x80, 0x9D, 0x74, 0xAB,
-    0x1E, 0x88, 0x6A, 0x85, 0x80, 0xB0, 0x5B, 0x24, 0xC2, 0x3C, 0x2F, 0x62, 0xA4, 0x1F, 0xCB, 0x1C,
-    0x97, 0x63, 0xB1, 0xF0, 0xFE, 0xD3, 0xCE, 0xA9, 0x01, 0x05, 0x2D, 0x92, 0xFB, 0xF6, 0xE0, 0xE0,
-    0x44, 0x7D, 0x48, 0xB6, 0xBB, 0xFB, 0x28, 0x9C, 0x81, 0xC7, 0x79, 0xC2, 0x3C, 0x5B, 0xAF, 0x0E,
-    0x32, 0x4E, 0x47, 0xE2, 0x00, 0x7C, 0x54, 0x7E, 0x99, 0x03, 0xE0, 0x27, 0x82, 0x4C, 0xE6, 0xA1,
-    0xBB, 0x77, 0x47, 0xC8, 0xA4, 0x6B, 0xA8, 0xB7, 0x34, 0x10, 0x7E, 0x18, 0xE6, 0xD4, 0x3A, 0x00,
-    0x54, 0x0E, 0x0E, 0xC0, 0x2E, 0xAD, 0xD8, 0xC4, 0xE1, 0xD1, 0x83, 0x5E, 0x65, 0x6E, 0x29, 0x93,
-    0x82, 0x61, 0x70, 0x8D, 0xF0, 0xA3, 0xCE, 0x80, 0x93, 0xD0, 0xE9, 0x35, 0xFD, 0x25, 0x3D, 0x0C,
-    0x73, 0xF2, 0x04, 0x1B, 0xD2, 0x17, 0x9B, 0xD5, 0x99, 0x2B, 0x08, 0x22, 0x3D, 0x0C, 0x7C, 0xAF,
-    0xE9, 0x8F, 0x70, 0x8D, 0x23, 0xA3, 0x96, 0xFF, 0x3A, 0xF9, 0x03, 0x57, 0xF7, 0xFB, 0xDB, 0xDE,
-    0xBE, 0xC6, 0xCF, 0x35, 0xF2, 0x87, 0xE3, 0xA3, 0x9E, 0x97, 0x5E, 0xDA, 0xB6, 0xD1, 0xD3, 0xB1,
-    0xFC, 0x20, 0xB1, 0xFE, 0x0F, 0xE7, 0xCE, 0x35, 0x79, 0x7A, 0x8A, 0x91, 0x32, 0xA3, 0xA0, 0xFD,
-    0x7A, 0x4B, 0xD1, 0x94, 0x72, 0x48, 0x25, 0xCE, 0xA4, 0x9B, 0x39, 0xC4, 0x71, 0x07, 0x04, 0x40,
-    0x5A, 0xB2, 0xB7, 0xB7, 0x97, 0xCD, 0x21, 0xCA, 0x65, 0x7A, 0xA3, 0xD3, 0xB1, 0x48, 0x8F, 0x43,
-    0xB8, 0xC4, 0x37, 0xBF, 0xC8, 0x13, 0x08, 0x30, 0xA1, 0x89, 0x39, 0xB0, 0xC2, 0xBF, 0xBF, 0x27,
-    0x74, 0x99, 0x9D, 0x84, 0x09, 0x0F, 0x9B, 0x73, 0xA9, 0x55, 0x82, 0x13, 0xD1, 0x35, 0x84, 0x51,
-    0x23, 0xDA, 0xA4, 0x18, 0x9A, 0x38, 0x51, 0xF9, 0x6D, 0xFC, 0x5D, 0x1C, 0x4A, 0xEE, 0x9F, 0x23,
-    0x43, 0xC4, 0x2F, 0x8E, 0x4A, 0x13, 0x9D, 0xAC, 0x54, 0xAF, 0xD3, 0x43, 0x9E, 0xC9, 0x1E, 0x0F,
-    0xCC, 0x41, 0x13, 0x3E, 0x6F, 0x66, 0xDF, 0xA4, 0x74, 0x7A, 0x6E, 0x34, 0x6D, 0x4E, 0x54, 0x56,
-    0xD7, 0xE9, 0x02, 0x77, 0x3A, 0xBB, 0xCA, 0x81, 0xD1, 0xC1, 0x6D, 0x0A, 0xDF, 0x30, 0x35, 0x85,
-    0xC4, 0xB3, 0x67, 0xC4, 0xD0, 0x49, 0x0F, 0x39, 0xF5, 0x3D, 0xE1, 0x34, 0x44, 0x09, 0x85, 0xB3,
-    0x27, 0xA0, 0xE4, 0xAE, 0xB3, 0x9A, 0x48, 0x11, 0x9A, 0x22, 0xE7, 0x54, 0xB8, 0xE5, 0x21, 0x71,
-    0x49, 0x9F, 0x2C, 0x21, 0xDB, 0xCD, 0xA3, 0x08, 0x4B, 0x0B, 0x6F, 0x34, 0x96, 0xC8, 0xE9, 0x71,
-    0xDF, 0xB5, 0xDF, 0xED, 0x46, 0xA4, 0x17, 0x14, 0x06, 0x3F, 0x9C, 0x35, 0xAF, 0x01, 0xF7, 0xDD,
-    0xB7, 0x99, 0x7B, 0xA4, 0x6A, 0xF6, 0xF9, 0x92, 0x5B, 0xC1, 0x21, 0x4A, 0x06, 0x05, 0x77, 0xA2,
-    0x82, 0x7D, 0xF5, 0x70, 0x02, 0x09, 0xF3, 0xE3, 0xD7, 0x48, 0x20, 0x05, 0x1F, 0xC1, 0x24, 0x64,
-    0x0D, 0xDC, 0xFC, 0xC9, 0x48, 0xB0, 0x3E, 0x37, 0x30, 0x05, 0x29, 0x95, 0x0C, 0x39, 0xA3, 0x23,
-    0xC8, 0xDD, 0xED, 0xED, 0x04, 0x6F, 0x14, 0x4A, 0xE4, 0xF4, 0xB8, 0xEF, 0x56, 0xF6, 0xBB, 0xE5,
-    0x9C, 0x5C, 0x1B, 0x24, 0x2E, 0x7E, 0xB0, 0x5F, 0xB0, 0x15, 0x70, 0x7E, 0x03, 0x2F, 0x26, 0xF8,
-    0x84, 0xC7, 0xC1, 0xE4, 0x8D, 0x1A, 0x8C, 0xBF, 0x0E, 0xBB, 0xB1, 0x10, 0xC6, 0x47, 0x2C, 0x53,
-    0xCA, 0x79, 0x6C, 0xB8, 0xE6, 0x59, 0x93, 0xF8, 0x33, 0x16, 0x27, 0x9B, 0xB0, 0xB0, 0x94, 0x64,
-    0x16, 0xDB, 0x0F, 0xB6, 0x62, 0x19, 0x93, 0x98, 0xBF, 0x61, 0xC9, 0xC7, 0x7B, 0x7B, 0xBB, 0x62,
-    0x5D, 0x46, 0x26, 0x66, 0xDA, 0xDB, 0x2E, 0x9F, 0xE5, 0xF3, 0x82, 0x63, 0xFE, 0xF6, 0xF6, 0x14,
-    0x78, 0x4F, 0x59, 0xBF, 0x74, 0x89, 0xA6, 0xD8, 0x88, 0x24, 0xF1, 0xF5, 0x36, 0x5E, 0xF2, 0x06,
-    0x7D, 0xC3, 0x56, 0x38, 0x9C, 0x3D, 0x86, 0xB1, 0xFB, 0xAD, 0x75, 0x18, 0xBB, 0xAF, 0xC8, 0x65,
-    0x30, 0xEE, 0x4E, 0x7B, 0xC2, 0x92, 0xF2, 0xEB, 0xAB, 0xDC, 0x8F, 0xEE, 0x1B, 0xDC, 0x0F, 0x8C,
-    0x31, 0x18, 0x4B, 0xB7, 0x72, 0x31, 0xC6, 0x96, 0x33, 0x8A, 0xE1, 0x1E, 0x20, 0x9F, 0xE5, 0x99,
-    0x7B, 0xA5, 0xCF, 0xAE, 0x6C, 0xD0, 0x3B, 0xB2, 0xE1, 0x4C, 0x7D, 0x21, 0x96, 0x34, 0xF2, 0x57,
-    0x63, 0x39, 0x9F, 0xBC, 0xED, 0x4E, 0x93, 0xC7, 0xD8, 0x8D, 0x3A, 0x60, 0xC7, 0xE5, 0x03, 0x76,
-    0x6B, 0xBC, 0x42, 0x06, 0x2E, 0xF5, 0xFE, 0x44, 0x88, 0xA7, 0x62, 0xA4, 0x49, 0xAD, 0x52, 0x58,
-    0xA2, 0x38, 0x37, 0x6E, 0x31, 0x3F, 0xE2, 0x7E, 0xF1, 0x4B, 0x31, 0x3B, 0x84, 0x61, 0xE9, 0x4F,
-    0xDD, 0x99, 0x33, 0xF2, 0xC2, 0x56, 0xC6, 0xF5, 0x71, 0x6F, 0x91, 0x32, 0xCB, 0xFC, 0xE3, 0x3D,
-    0x9E, 0xA0, 0x4E, 0xC3, 0x37, 0xFD, 0xD2, 0xA9, 0x91, 0xF4, 0x7E, 0x70, 0x49, 0x03, 0xF2, 0x3E,
-    0x2E, 0x92, 0xD7, 0xB1, 0xEF, 0x5A, 0x88, 0x39, 0x28, 0x11, 0x07, 0xE7, 0x05, 0xBC, 0x8F, 0x99,
-    0xAD, 0xD8, 0xA5, 0xA6, 0xCA, 0x4D, 0x75, 0xD9, 0xEC, 0xF0, 0xF3, 0x5F, 0xE5, 0xFF, 0x46, 0x97,
-    0x68, 0x53, 0x37, 0x33, 0x33, 0xBB, 0xD8, 0xD0, 0x6D, 0x6A, 0x82, 0x59, 0xB4, 0x13, 0xB1, 0x25,
-    0x57, 0xA5, 0x7F, 0xBC, 0x7F, 0xFF, 0x73, 0x76, 0x06, 0xD9, 0xF0, 0x45, 0x57, 0x6E, 0xF1, 0xF1,
-    0x26, 0x83, 0xC0, 0x6E, 0x78, 0x76, 0xC1, 0xDE, 0x3D, 0x2E, 0x77, 0x78, 0xF6, 0xC2, 0xA1, 0x77,
-    0x51, 0x6D, 0x30, 0x3B, 0xA2, 0xEB, 0x51, 0xE6, 0x60, 0x6D, 0x8F, 0xF0, 0x89, 0xDD, 0x19, 0x4A,
-    0x2B, 0x51, 0xD8, 0x41, 0x2D, 0xCA, 0x9B, 0x7D, 0x79, 0x51, 0xE4, 0x9D, 0x82, 0x99, 0xAB, 0x82,
-    0x4F, 0x13, 0xC5, 0x37, 0x13, 0xAC, 0xE3, 0x42, 0x76, 0x93, 0xA3, 0x77, 0x71, 0x21, 0x3A, 0x94,
-    0x59, 0x49, 0x94, 0x7F, 0x6D, 0x73, 0xA2, 0x5F, 0xC0, 0xF7, 0xDC, 0xB6, 0xFF, 0xBA, 0xCB, 0x63,
-    0x85, 0x79, 0xA1, 0xBC, 0xFB, 0x3D, 0x2C, 0x56, 0xA4, 0x63, 0x9C, 0xC7, 0x50, 0x39, 0x8C, 0x54,
-    0x5A, 0x88, 0x3D, 0xAC, 0x03, 0xC1, 0x46, 0xA4, 0x1E, 0x9F, 0xE9, 0x3D, 0x47, 0x03, 0xA2, 0x12,
-    0x23, 0xBB, 0xA5, 0xA0, 0x7B, 0xD1, 0x24, 0x51, 0x29, 0x41, 0x0D, 0xDB, 0xB5, 0x14, 0x33, 0x25,
-    0xC7, 0x1B, 0x5D, 0x4F, 0xEA, 0x76, 0x20, 0x72, 0x7A, 0x07, 0x37, 0x52, 0x44, 0x84, 0xCC, 0xBA,
-    0x18, 0xC1, 0xB0, 0x0C, 0xD1, 0x80, 0xCF, 0x4D, 0x81, 0xAB, 0x16, 0x73, 0xAB, 0xB4, 0x85, 0xBE,
-    0x23, 0xD2, 0xA0, 0xA1, 0x32, 0x18, 0x1A, 0x0D, 0x9E, 0xAC, 0x8E, 0x0B, 0xD4, 0xE7, 0x0F, 0xE5,
-    0xCC, 0x91, 0x3C, 0x02, 0x2B, 0x64, 0xC5, 0x4A, 0x07, 0x84, 0xB3, 0x33, 0x0E, 0x11, 0x4F, 0x01,
-    0x7E, 0xAE, 0x56, 0xA5, 0x91, 0x38, 0xB9, 0x3C, 0x1D, 0xB2, 0xC1, 0x38, 0x42, 0x32, 0x45, 0xD5,
-    0xC9, 0x6C, 0xA8, 0x15, 0x2D, 0x05, 0x47, 0x51, 0x9D, 0x7D, 0x71, 0x54, 0x1D, 0xC0, 0xA0, 0x11,
-    0x5F, 0x2F, 0xEA, 0x1E, 0x15, 0x61, 0x88, 0x28, 0x59, 0x6F, 0x68, 0x07, 0x9C, 0xEA, 0x70, 0xE6,
-    0xE1, 0xB4, 0xCC, 0x34, 0xA9, 0x60, 0xD7, 0x5A, 0xF8, 0xF4, 0x5A, 0x1E, 0xA6, 0x81, 0xB9, 0x64,
-    0x2B, 0xD8, 0x37, 0x7D, 0x29, 0x08, 0xD5, 0xE3, 0x0A, 0xF6, 0x89, 0x22, 0xE5, 0xEE, 0x2A, 0x58,
-    0x36, 0xEF, 0xB6, 0x6F, 0xD3, 0x59, 0xBE, 0xCC, 0xB9, 0x8D, 0x48, 0xAD, 0x63, 0x7C, 0x23, 0x5B,
-    0x40, 0x6A, 0x76, 0x1A, 0x91, 0xFA, 0x62, 0xB5, 0x3B, 0x41, 0xB5, 0x1B, 0xB9, 0xA7, 0x51, 0xB5,
-    0xFB, 0x49, 0x78, 0x29, 0xF3, 0x12, 0x91, 0x54, 0xBB, 0x6B, 0xE9, 0x71, 0xE2, 0x9A, 0x37, 0xF3,
-    0xA9, 0x5F, 0x6B, 0xC5, 0xDA, 0xAB, 0xD9, 0x93, 0x75, 0x1B, 0x38, 0xF4, 0x2D, 0x7A, 0x29, 0xA4,
-    0x43, 0xF3, 0x96, 0xE0, 0x74, 0x82, 0x1B, 0x48, 0x17, 0x34, 0x1C, 0x7A, 0xBA, 0xF0, 0x2B, 0xBC,
-    0xDA, 0x43, 0x03, 0x0E, 0x37, 0x55, 0xC0, 0x4B, 0x61, 0x00, 0xD1, 0xBC, 0x32, 0xA7, 0x55, 0xED,
-    0x7E, 0x8E, 0x5B, 0x87, 0x99, 0x39, 0xD5, 0xDD, 0x44, 0x32, 0xF6, 0xCD, 0x77, 0x74, 0x86, 0x3D,
-    0x24, 0xC6, 0xFE, 0x8C, 0xCC, 0xB0, 0x2B, 0xD2, 0x50, 0xB9, 0x90, 0x63, 0x81, 0xFF, 0xD3, 0x86,
-    0xC8, 0xC9, 0x6C, 0xAE, 0xCA, 0x5C, 0xA3, 0x3E, 0xD1, 0x98, 0x67, 0x58, 0x98, 0xE0, 0x9A, 0xCF,
-    0x64, 0x35, 0xC4, 0xBB, 0x72, 0xDF, 0x4B, 0x2E, 0x8D, 0x53, 0xAF, 0xD6, 0x14, 0xF7, 0x13, 0xF0,
-    0xAC, 0xA8, 0x4A, 0x0C, 0x63, 0x1E, 0xC1, 0xF9, 0xC1, 0x6D, 0x64, 0xD2, 0x67, 0x28, 0xA5, 0xF7,
-    0x6B, 0x35, 0xDC, 0xA1, 0x94, 0x1E, 0x7D, 0x8A, 0x52, 0xFA, 0xF2, 0xD1, 0xB4, 0x16, 0x4E, 0xC2,
-    0x03, 0x1B, 0x20, 0x68, 0x88, 0x00, 0x9F, 0x45, 0xD2, 0xE6, 0x12, 0x26, 0xD0, 0x38, 0x50, 0xA0,
-    0xB3, 0xEA, 0x46, 0xBE, 0xD5, 0x57, 0xDD, 0x43, 0x24, 0xDC, 0xE3, 0x9F, 0x73, 0x2B, 0x77, 0xF8,
-    0x09, 0xF6, 0xD3, 0xF6, 0x11, 0x8A, 0x9E, 0x5B, 0xD6, 0x84, 0xBC, 0x6F, 0xD5, 0x5D, 0x17, 0x4B,
-    0x90, 0x0A, 0xA8, 0x0F, 0xCE, 0xE6, 0x45, 0x87, 0xDE, 0x6A, 0xF6, 0xEB, 0x89, 0x9C, 0x91, 0x44,
-    0x5E, 0xB1, 0xFB, 0xDC, 0x22, 0x6D, 0x2C, 0xD4, 0xAD, 0x62, 0xFD, 0x93, 0x46, 0xC1, 0xFE, 0x64,
-    0xA6, 0xF2, 0x36, 0x53, 0x85, 0xBB, 0xA3, 0x1E, 0xEF, 0x1E, 0xF0, 0x1E, 0x71, 0x1B, 0x19, 0x66,
-    0x64, 0x91, 0x24, 0x0B, 0xEC, 0xF1, 0xF6, 0xFC, 0xBC, 0x85, 0x9E, 0x2C, 0xF6, 0x43, 0xFB, 0x16,
-    0x7D, 0x85, 0xBF, 0xA1, 0x1E, 0x7F, 0x19, 0x00, 0x31, 0x34, 0x4D, 0xFE, 0x99, 0x8C, 0x80, 0x7E,
-    0x08, 0x0C, 0x63, 0x60, 0x18, 0x04, 0x1B, 0xB7, 0xE6, 0xE5, 0x16, 0x19, 0xFE, 0x56, 0x50, 0xED,
-    0xDC, 0x13, 0x77, 0x12, 0x5B, 0x88, 0x61, 0xCA, 0x18, 0x33, 0x24, 0x0C, 0x72, 0x58, 0x00, 0xE5,
-    0x38, 0x03, 0xCC, 0x06, 0xB5, 0xDC, 0xB8, 0x06, 0x83, 0xB8, 0x29, 0x8E, 0xA3, 0x40, 0x4D, 0xDD,
-    0x40, 0x6B, 0x6A, 0x47, 0x54, 0xAF, 0x08, 0xE0, 0xF6, 0xC9, 0x58, 0x9A, 0x97, 0xA1, 0x42, 0x02,
-    0x3A, 0x01, 0xF5, 0xC4, 0xC2, 0x6E, 0x71, 0xB7, 0xC0, 0xEF, 0xF5, 0xF8, 0x58, 0x48, 0x63, 0x5B,
-    0x38, 0x08, 0x6D, 0x0E, 0xA7, 0x1F, 0xBD, 0xBA, 0xDA, 0x95, 0x16, 0x66, 0xF0, 0x19, 0xC2, 0xF6,
-    0xD5, 0x64, 0x2E, 0x1C, 0x15, 0x8D, 0x15, 0x4C, 0x33, 0x5A, 0xED, 0x7B, 0x7E, 0xC5, 0xB0, 0x0D,
-    0x6E, 0xD1, 0xD8, 0x7A, 0xD2, 0xB9, 0x7E, 0xDE, 0x86, 0x76, 0x1F, 0x25, 0x56, 0x05, 0x8F, 0x52,
-    0x64, 0x73, 0x4F, 0x8A, 0xDC, 0xE2, 0x4C, 0x62, 0x2D, 0x35, 0x2C, 0x2D, 0x62, 0xD9, 0xC5, 0xCE,
-    0x9A, 0x56, 0xB6, 0x01, 0x36, 0x4A, 0x0A, 0x76, 0x05, 0xB8, 0xAD, 0x62, 0x55, 0x2B, 0x86, 0x3B,
-    0x0A, 0x4B, 0xE2, 0x58, 0x65, 0x57, 0xB5, 0x98, 0x00, 0x37, 0x82, 0xB4, 0xC2, 0x84, 0x3D, 0x8A,
-    0x4C, 0x18, 0x0E, 0x74, 0x36, 0xF5, 0xF4, 0x16, 0x6D, 0x30, 0x65, 0x88, 0xF0, 0x4E, 0xC7, 0xB1,
-    0x84, 0xF7, 0x17, 0x83, 0x76, 0x32, 0x94, 0xF5, 0x9D, 0xA1, 0x54, 0xBE, 0x2A, 0x68, 0x9E, 0x35,
-    0x2B, 0x3A, 0x38, 0x86, 0x3B, 0x8B, 0x16, 0xC8, 0x9F, 0x2D, 0x9E, 0x2F, 0x24, 0xB3, 0x56, 0x12,
-    0x35, 0xEB, 0x3E, 0xA9, 0x27, 0x25, 0x4E, 0x95, 0x3D, 0x96, 0xEB, 0xB2, 0x34, 0x5B, 0xFC, 0xD1,
-    0x93, 0xA2, 0xA9, 0x40, 0x98, 0xAA, 0xE7, 0x9B, 0x61, 0x18, 0x00, 0x2D, 0x83, 0x74, 0xA2, 0xDF,
-    0xB2, 0x57, 0xFA, 0x31, 0x47, 0x1A, 0x58, 0x88, 0x32, 0x05, 0x3A, 0x5D, 0xBF, 0x8C, 0xBD, 0xDF,
-    0xB6, 0x68, 0xC8, 0x0C, 0x68, 0x31, 0x9F, 0xFA, 0xCC, 0xF0, 0x90, 0x4E, 0x46, 0x4D, 0xEF, 0xAB,
-    0x91, 0x00, 0x24, 0xAC, 0x58, 0xB4, 0x51, 0xC5, 0xCC, 0xA5, 0x55, 0xD8, 0xFE, 0xF0, 0x5E, 0xE5,
-    0x1B, 0xF3, 0x21, 0x16, 0xBC, 0x3F, 0x33, 0x2C, 0x78, 0xD7, 0x35, 0x45, 0xE3, 0xF5, 0x22, 0xEA,
-    0x84, 0x8A, 0xA3, 0x2A, 0x4B, 0x59, 0xC8, 0x8C, 0x7F, 0x8E, 0xD0, 0xCC, 0x8F, 0xA3, 0xAA, 0xFF,
-    0x81, 0x08, 0xD1, 0x77, 0x47, 0x3D, 0xA3, 0x75, 0xC2, 0xC4, 0x3D, 0x18, 0x7E, 0x8E, 0xA3, 0x89,
-    0xCF, 0xE9, 0x51, 0x89, 0xCF, 0x93, 0x46, 0x68, 0x6F, 0x1E, 0xAD, 0x0E, 0xA1, 0x90, 0x75, 0x2A,
-    0x27, 0xD9, 0x38, 0x8B, 0x33, 0x5F, 0x73, 0x24, 0x4B, 0x92, 0xC1, 0xBD, 0xC2, 0xD0, 0x8A, 0x84,
-    0xDE, 0x6D, 0x64, 0xF7, 0xC7, 0x5A, 0x76, 0x7F, 0xAD, 0x64, 0x67, 0x54, 0x7A, 0x2D, 0xA9, 0x10,
-    0xFF, 0x2F, 0x3B, 0x45, 0x86, 0x52, 0xAB, 0xE7, 0x32, 0x11, 0x9F, 0x82, 0x63, 0xD1, 0x11, 0x78,
-    0xD0, 0x33, 0xA3, 0x3A, 0xEC, 0xB2, 0xAD, 0xA2, 0xD9, 0x59, 0xE3, 0xBE, 0x35, 0x94, 0x47, 0xFB,
-    0x72, 0x76, 0x3F, 0x67, 0x6C, 0x82, 0xB1, 0xCF, 0x20, 0x26, 0xC3, 0x75, 0xEB, 0xA1, 0xA5, 0x0A,
-    0x55, 0x27, 0xBB, 0x7F, 0x36, 0xB2, 0x33, 0x33, 0xDD, 0x15, 0xB2, 0x9B, 0x59, 0x34, 0xFF, 0xBB,
-    0x5D, 0xA0, 0x3B, 0x28, 0x69, 0x01, 0x52, 0xF4, 0x36, 0xA2, 0x5C, 0x01, 0x53, 0xD6, 0x01, 0x7C,
-    0x28, 0xCA, 0x1A, 0x80, 0x52, 0x0F, 0xA9, 0x0D, 0x03, 0x03, 0xE5, 0xDA, 0x6D, 0x16, 0x82, 0x40,
-    0xDB, 0x01, 0x5B, 0x84, 0x18, 0xAD, 0x9F, 0x3B, 0x55, 0xA0, 0x5E, 0xC9, 0xC6, 0x81, 0xB0, 0x86,
-    0x7A, 0x83, 0xDF, 0x6C, 0x05, 0xA2, 0xEB, 0xA1, 0x91, 0x1D, 0x5D, 0x07, 0x50, 0x29, 0x57, 0x3B,
-    0x6A, 0x6C, 0xA5, 0xC8, 0x76, 0xE2, 0xF6, 0xB8, 0x4B, 0x97, 0x67, 0xE3, 0x3A, 0x53, 0xA4, 0xB7,
-    0x36, 0x4F, 0x1B, 0xB6, 0xA2, 0x53, 0x49, 0xAA, 0xC6, 0xD4, 0xEB, 0x55, 0x5B, 0x52, 0x1A, 0x62,
-    0x22, 0x9B, 0x72, 0xB6, 0x63, 0xDE, 0xE2, 0xFE, 0xCE, 0x7A, 0x20, 0xCD, 0x73, 0x72, 0x47, 0x56,
-    0x7D, 0x4B, 0xC2, 0x3C, 0x35, 0xBF, 0x44, 0x5F, 0xEA, 0x89, 0x58, 0xCB, 0xCA, 0xED, 0xAC, 0x22,
-    0x3A, 0x9D, 0xF3, 0x56, 0x7D, 0x7E, 0xCA, 0x4B, 0x84, 0xBE, 0xEC, 0xF5, 0xDF, 0x00, 0xA4, 0xEF,
-    0xE7, 0xAD, 0xAC, 0x1B, 0x8A, 0xEA, 0x3E, 0x69, 0xB5, 0x16, 0x13, 0xF6, 0xF4, 0x59, 0x4A, 0xBB,
-    0x59, 0x4F, 0x32, 0xCE, 0xC6, 0x99, 0x28, 0x7B, 0x76, 0xE1, 0x70, 0xDE, 0x78, 0x6D, 0xA0, 0x9A,
-    0xA7, 0x85, 0x6D, 0x3E, 0xB8, 0x59, 0x30, 0x1A, 0x3B, 0x23, 0xD3, 0xAA, 0x96, 0xD5, 0x3E, 0xD0,
-    0x8D, 0xBA, 0xA9, 0x3F, 0x6A, 0x3E, 0xBC, 0x28, 0xFD, 0x8E, 0xE8, 0x64, 0x48, 0x00, 0x6B, 0x33,
-    0x10, 0x7E, 0x61, 0xE9, 0x66, 0x0B, 0x66, 0xD9, 0x38, 0x73, 0xC0, 0x82, 0xC4, 0x72, 0x23, 0xBC,
-    0x77, 0xE2, 0x7F, 0x68, 0xDA, 0x5C, 0x56, 0xE2, 0x30, 0x6E, 0xF8, 0x40, 0xF8, 0x3E, 0x3E, 0xE6,
-    0xFF, 0x4B, 0xDC, 0x68, 0xF1, 0x98, 0x1D, 0x23, 0x9A, 0x4E, 0x95, 0xA0, 0x7E, 0xFD, 0x2B, 0x50,
-    0xB1, 0x97, 0x93, 0x61, 0x25, 0x9F, 0x76, 0xBA, 0x19, 0xAC, 0xE4, 0xF9, 0x71, 0x77, 0x72, 0xBB,
-    0xA4, 0xDD, 0xAB, 0xE3, 0x4C, 0x17, 0xBA, 0xEB, 0x2F, 0x5F, 0xF1, 0x33, 0x42, 0x59, 0x09, 0x1F,
-    0x63, 0x51, 0x7C, 0x9C, 0x70, 0x97, 0x72, 0x34, 0xD2, 0x41, 0x02, 0x8D, 0xFE, 0x6A, 0x8D, 0xE2,
-    0x67, 0xB0, 0xAC, 0xFE, 0xA7, 0x40, 0xE4, 0x4F, 0x58, 0x2D, 0x8F, 0x4A, 0x97, 0x8F, 0x02, 0x89,
-    0x27, 0x8B, 0x91, 0xCD, 0x20, 0xD1, 0xB6, 0x37, 0x72, 0xC2, 0x8B, 0x94, 0xE5, 0xC5, 0x2D, 0x45,
-    0xC2, 0xF6, 0x0F, 0x78, 0x56, 0x94, 0x42, 0x5A, 0xAE, 0x87, 0x7C, 0x17, 0xB6, 0x85, 0x08, 0x6D,
-    0xF4, 0xCC, 0xD6, 0xD2, 0x24, 0xBC, 0x05, 0x09, 0xA7, 0x90, 0x30, 0xF3, 0x83, 0x30, 0x87, 0x25,
-    0xBC, 0x35, 0x92, 0xF0, 0x97, 0xC6, 0x6A, 0xF5, 0xF1, 0x62, 0xB5, 0x35, 0x40, 0x47, 0x3C, 0x0A,
-    0xEF, 0x3F, 0x59, 0x9E, 0xB2, 0x92, 0xF3, 0x80, 0x36, 0x12, 0x2C, 0x02, 0x9C, 0xD4, 0x70, 0x82,
-    0xD4, 0x6F, 0x60, 0xB7, 0x21, 0xE9, 0xBD, 0x86, 0x2F, 0x8C, 0xC3, 0x35, 0x40, 0x46, 0xFC, 0x01,
-    0xF6, 0x06, 0xD4, 0x17, 0x10, 0x4F, 0x40, 0xFC, 0x00, 0x67, 0xB1, 0x27, 0x2B, 0x07, 0xC5, 0xE7,
-    0xC5, 0x59, 0x31, 0x8F, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0x75, 0x62, 0x2C, 0x16, 0x54, 0xA1, 0x0B,
-    0xEC, 0x18, 0x30, 0x9B, 0x34, 0x16, 0x22, 0xF1, 0x0F, 0xE8, 0x96, 0x63, 0xA7, 0x70, 0x91, 0xC2,
-    0x2A, 0x7C, 0x40, 0x00, 0x15, 0x6E, 0x52, 0x04, 0xE7, 0xC2, 0x2E, 0x62, 0x40, 0x09, 0x4E, 0x47,
-    0x0A, 0x2E, 0xD2, 0xBA, 0x71, 0x6A, 0x17, 0x2E, 0xE4, 0x0D, 0x10, 0xB9, 0x70, 0x71, 0x01, 0x76,
-    0xB5, 0x0C, 0x5C, 0xA4, 0x25, 0x02, 0xA4, 0x0E, 0xD3, 0xA4, 0x48, 0x1A, 0x06, 0xD9, 0x24, 0x8C,
-    0x44, 0x2E, 0xF3, 0x7D, 0x6F, 0x48, 0x2E, 0xF7, 0x64, 0xCB, 0xB2, 0x74, 0x4E, 0x88, 0x9D, 0xE1,
-    0xCC, 0xF0, 0xCD, 0x9B, 0x37, 0x6F, 0xDE, 0xFB, 0xDE, 0xCC, 0xAC, 0xDC, 0x14, 0xF9, 0x5C, 0xE4,
-    0x9A, 0x1C, 0xDD, 0x37, 0x5D, 0x97, 0x55, 0xAF, 0x48, 0x75, 0x5B, 0xAA, 0x8F, 0xA5, 0x92, 0xE7,
-    0xFD, 0x7D, 0x2C, 0xE2, 0x18, 0xF1, 0x33, 0x79, 0x45, 0xE4, 0x64, 0x6E, 0x56, 0x5D, 0x7E, 0xCD,
-    0xCB, 0x83, 0x1F, 0xE6, 0xEE, 0x07, 0xB9, 0x78, 0xCF, 0xFF, 0xCB, 0x8E, 0xE6, 0x1F, 0xAE, 0xBA,
-    0x12, 0xBF, 0xFD, 0x43, 0x33, 0x2D, 0xA7, 0x5D, 0xD7, 0xD5, 0x2B, 0x64, 0x0D, 0x4B, 0xCD, 0xD1,
-    0x7C, 0x3E, 0x17, 0x56, 0x8D, 0x66, 0xFB, 0x87, 0x87, 0x87, 0xC2, 0x36, 0x3E, 0xF7, 0xD8, 0xC4,
-    0xA7, 0x19, 0x0B, 0xFC, 0xCE, 0xE7, 0xAD, 0xA7, 0xA1, 0x79, 0x55, 0x5E, 0x9A, 0x49, 0xF2, 0xBF,
-    0xFC, 0x49, 0xFF, 0x24, 0x9C, 0x4B, 0x32, 0x4E, 0x68, 0xFB, 0x9C, 0xF9, 0xE0, 0x54, 0x5E, 0xE5,
-    0x97, 0x41, 0x11, 0xE6, 0x51, 0x9E, 0x64, 0x49, 0x96, 0x9A, 0x7D, 0x09, 0xAA, 0xB0, 0x0A, 0x4B,
-    0xB6, 0xC4, 0x59, 0x22, 0x33, 0xB9, 0x23, 0x57, 0x04, 0xF5, 0x32, 0x2A, 0x62, 0x6D, 0x49, 0xD0,
-    0xB2, 0x90, 0xB7, 0x24, 0x35, 0xA9, 0x49, 0xB2, 0x18, 0x74, 0x61, 0x11, 0x14, 0x5E, 0xE9, 0x56,
-    0x72, 0xD3, 0xA9, 0xFC, 0xCC, 0xAB, 0xC2, 0xCC, 0x2F, 0x23, 0x13, 0x14, 0x89, 0x09, 0xF3, 0x44,
-    0xA2, 0x7C, 0x25, 0x49, 0xB6, 0x91, 0xE4, 0x6E, 0x2B, 0xE9, 0xEB, 0xAD, 0xEC, 0xA3, 0x6F, 0x50,
-    0xC5, 0x59, 0x58, 0x25, 0x79, 0x58, 0x26, 0x26, 0xCA, 0x53, 0xA5, 0x89, 0x4D, 0x0B, 0xDE, 0x0D,
-    0x46, 0xAC, 0xE5, 0xD8, 0xA9, 0xE4, 0x8A, 0x73, 0x13, 0xE3, 0x26, 0x59, 0x58, 0xA6, 0x26, 0x2A,
-    0x52, 0x89, 0x07, 0x3E, 0xA0, 0x49, 0x9C, 0x5A, 0xEE, 0x38, 0x6B, 0x59, 0x60, 0xD0, 0xB7, 0x60,
-    0x46, 0xA9, 0xD3, 0x48, 0xFA, 0x5A, 0xAB, 0xDF, 0xE3, 0x7C, 0x23, 0xE4, 0xC9, 0xB1, 0x83, 0x22,
-    0x36, 0x5E, 0x19, 0x65, 0x6E, 0x15, 0xE6, 0x90, 0xCE, 0xC8, 0xA5, 0x4C, 0xF0, 0x51, 0xF0, 0x71,
-    0x92, 0xD0, 0x16, 0x64, 0x72, 0x39, 0x30, 0x57, 0x56, 0x76, 0x1D, 0x9B, 0xA3, 0x5B, 0xBF, 0xBA,
-    0x27, 0x81, 0xD1, 0xF6, 0x31, 0x85, 0x43, 0xCA, 0x9F, 0x9C, 0xA2, 0x21, 0x15, 0x36, 0x71, 0xCC,
-    0xB0, 0xD8, 0xA5, 0x09, 0x72, 0xE5, 0xD9, 0xDD, 0xFF, 0x5B, 0x43, 0x93, 0xE1, 0xDB, 0x8E, 0x31,
-    0xE5, 0x75, 0xB6, 0x4F, 0x26, 0x87, 0xC1, 0xDD, 0x1F, 0x2B, 0x3D, 0x12, 0xCB, 0x8F, 0xF7, 0xE9,
-    0xC7, 0xBD, 0x29, 0x01, 0xB4, 0xD0, 0x65, 0x49, 0x97, 0x4F, 0x7F, 0x51, 0x67, 0xDC, 0x96, 0x76,
-    0xF0, 0x33, 0x91, 0x14, 0xBF, 0x52, 0xD2, 0x8D, 0xA4, 0x5D, 0xC1, 0xDF, 0x46, 0xAB, 0x86, 0x9F,
-    0xF0, 0xBC, 0x24, 0x2B, 0xD3, 0x65, 0x5D, 0xB6, 0x32, 0x2F, 0xCA, 0x1E, 0xF8, 0x25, 0xB9, 0xD7,
-    0xA4, 0x85, 0xD7, 0x26, 0x4C, 0x28, 0xB3, 0x8D, 0x09, 0x84, 0xAC, 0x4A, 0x9A, 0xA5, 0x85, 0xDF,
-    0xC8, 0x2A, 0x4F, 0xFA, 0x97, 0x6D, 0xEC, 0x49, 0xF6, 0x40, 0x94, 0x16, 0x49, 0x91, 0xE4, 0x7B,
-    0xF0, 0xAE, 0xAC, 0xEB, 0xF2, 0xE7, 0x07, 0x90, 0xF1, 0xF7, 0x99, 0xC8, 0x7C, 0x0E, 0x74, 0x3A,
-    0x17, 0xDC, 0xD8, 0x02, 0x48, 0xAF, 0x96, 0xC7, 0x7E, 0xE7, 0x22, 0x34, 0xF8, 0xFC, 0x62, 0x9E,
-    0xBD, 0x27, 0x32, 0xFE, 0xDE, 0x27, 0x34, 0x9D, 0x1B, 0xF3, 0xAB, 0x73, 0x18, 0xC1, 0xF6, 0xB7,
-    0x7F, 0x78, 0x6E, 0x92, 0x4F, 0x1E, 0xA7, 0x83, 0xF5, 0x2D, 0xB4, 0xE8, 0x77, 0xF8, 0x52, 0x6B,
-    0x31, 0xFC, 0x43, 0x23, 0xAE, 0xA5, 0x8B, 0xCC, 0x42, 0xFC, 0xD2, 0x02, 0x0F, 0xFC, 0x9A, 0xC6,
-    0xD9, 0x17, 0xA3, 0x4C, 0x8B, 0x84, 0xAC, 0x1E, 0xB4, 0x66, 0x0A, 0x2C, 0x63, 0xB1, 0x19, 0x8B,
-    0xEE, 0x7A, 0x2C, 0x7A, 0xE5, 0xBE, 0xC8, 0x9E, 0x21, 0x87, 0xE0, 0x77, 0x1D, 0xAC, 0xB5, 0x96,
-    0x58, 0xEE, 0x84, 0xBF, 0xEC, 0x6A, 0xA7, 0xDB, 0xC0, 0x37, 0x9B, 0x24, 0x2C, 0x5A, 0x6F, 0x9D,
-    0x98, 0xE0, 0x51, 0x7D, 0x12, 0x66, 0x33, 0xAF, 0x0C, 0x33, 0xAF, 0x2B, 0x9B, 0xC8, 0x24, 0x3E,
-    0x30, 0x4E, 0x8E, 0x9C, 0x75, 0x2C, 0x71, 0x90, 0xD3, 0xFB, 0xBC, 0x2A, 0x96, 0xE8, 0x47, 0xB9,
-    0x4F, 0xC7, 0x2A, 0x80, 0x52, 0x6F, 0xE6, 0xBE, 0xFA, 0xDB, 0x58, 0x04, 0xE5, 0x40, 0x30, 0x93,
-    0xB1, 0x5B, 0x23, 0x03, 0x33, 0x40, 0x50, 0x3F, 0x04, 0x78, 0x81, 0x47, 0xEB, 0x62, 0x60, 0x41,
-    0x4F, 0xAF, 0xAB, 0x05, 0xE2, 0xE8, 0x74, 0x21, 0x64, 0x62, 0xD5, 0x42, 0x2F, 0x02, 0x00, 0xED,
-    0x3E, 0xAA, 0xC1, 0x3B, 0x43, 0x2D, 0xA0, 0x12, 0x9B, 0xA1, 0x16, 0xFE, 0xA5, 0x11, 0x67, 0x3D,
-    0xD4, 0x62, 0xB3, 0xE4, 0x30, 0x03, 0x8C, 0x43, 0xA4, 0xA0, 0xD8, 0xD6, 0x12, 0x05, 0xA6, 0xAD,
-    0xF6, 0xE2, 0x71, 0x84, 0x13, 0xA5, 0x9D, 0xD6, 0x9A, 0x69, 0x6D, 0x3B, 0x80, 0xEA, 0xB7, 0x82,
-    0x72, 0x01, 0xBB, 0x40, 0x68, 0xF0, 0xF4, 0x8B, 0xD5, 0x5A, 0xE2, 0x16, 0x62, 0x99, 0x58, 0x4E,
-    0xC2, 0x2F, 0xBA, 0x16, 0x81, 0xD2, 0xC4, 0x5D, 0x11, 0xE5, 0x4D, 0xFC, 0x46, 0xB5, 0x72, 0x5A,
-    0x04, 0x8D, 0x37, 0xAA, 0xB0, 0xAB, 0x67, 0x61, 0x1E, 0xBF, 0xBE, 0x0E, 0x8A, 0xA5, 0x53, 0x43,
-    0xDD, 0x0B, 0xC4, 0x8E, 0x0F, 0x2A, 0xAF, 0x6C, 0x30, 0xD4, 0x91, 0xA9, 0xA3, 0x2C, 0xFC, 0xA2,
-    0xF4, 0x2A, 0xD6, 0x30, 0x03, 0xD4, 0x7E, 0x3F, 0xD4, 0xFC, 0x22, 0x32, 0x5A, 0xAB, 0x69, 0x45,
-    0xE8, 0x35, 0xA9, 0x45, 0x66, 0xDA, 0x8F, 0xF3, 0xDB, 0xD6, 0x96, 0x32, 0x19, 0x01, 0x56, 0xB7,
-    0x1D, 0x9D, 0x86, 0xE7, 0x57, 0x2B, 0xB1, 0x92, 0x89, 0x57, 0x8A, 0x6B, 0xA5, 0x8E, 0xB0, 0x10,
-    0x5C, 0x0F, 0x3B, 0x23, 0xBF, 0x33, 0xE3, 0x92, 0xE8, 0x6C, 0xA1, 0x5E, 0xE2, 0x61, 0xCB, 0x45,
-    0x85, 0x96, 0xB1, 0x88, 0x20, 0x8E, 0xA8, 0x13, 0x39, 0x56, 0xE5, 0xD7, 0x92, 0x7A, 0x6B, 0x69,
-    0xFD, 0xCA, 0xA9, 0xC3, 0x9C, 0xB3, 0xF0, 0x8B, 0x18, 0x34, 0x07, 0x20, 0x3A, 0x05, 0x55, 0x25,
-    0xC7, 0x6E, 0xA1, 0x74, 0x58, 0x95, 0xD4, 0x5D, 0xA3, 0x77, 0x0B, 0x03, 0x33, 0x4E, 0x1D, 0xC0,
-    0xA0, 0x18, 0x11, 0xE1, 0x08, 0xE8, 0x41, 0x59, 0x0F, 0x20, 0x23, 0x7A, 0x79, 0x05, 0xFB, 0x01,
-    0xBF, 0xD1, 0x33, 0xE4, 0x9C, 0xE8, 0x08, 0x71, 0xC6, 0x81, 0xE1, 0x32, 0xAE, 0x75, 0xA7, 0x63,
-    0x15, 0x21, 0x94, 0x25, 0x9A, 0xB0, 0x3A, 0x12, 0xDF, 0x25, 0x87, 0x06, 0x14, 0x33, 0x90, 0x60,
-    0x95, 0x6B, 0xAC, 0xFB, 0x31, 0x4C, 0x74, 0xE6, 0x62, 0x7E, 0x52, 0x81, 0xEE, 0x44, 0x48, 0x49,
-    0x5E, 0x77, 0xA1, 0x7A, 0x52, 0x07, 0xE4, 0x38, 0xA3, 0x2E, 0xAA, 0x58, 0xF9, 0x86, 0x19, 0x59,
-    0xFB, 0x39, 0xB9, 0xBB, 0xE5, 0x75, 0x0E, 0x50, 0x85, 0xBD, 0x09, 0xF6, 0xF1, 0x24, 0x86, 0xD7,
-    0x1E, 0x80, 0xF6, 0xF4, 0x14, 0x3E, 0x7F, 0x43, 0xDC, 0xF2, 0x1A, 0x40, 0x31, 0xC4, 0xE7, 0xC0,
-    0x84, 0x28, 0x5D, 0x17, 0xAF, 0x38, 0xC0, 0xEE, 0x81, 0x1A, 0x84, 0x04, 0xB0, 0xFB, 0x8D, 0xB8,
-    0x88, 0x60, 0x15, 0x03, 0x1F, 0x6A, 0x08, 0x23, 0x71, 0xCE, 0xAA, 0x87, 0x91, 0xE0, 0x0A, 0x68,
-    0xC2, 0x87, 0x17, 0xE4, 0x82, 0xCE, 0x27, 0xC9, 0x18, 0xDB, 0xA0, 0x4F, 0x44, 0x6D, 0x59, 0xA1,
-    0x9E, 0x93, 0x3A, 0x15, 0xA7, 0x65, 0x63, 0x58, 0xDA, 0x9A, 0x7C, 0x67, 0xE2, 0x27, 0xAA, 0x9D,
-    0x0B, 0x12, 0x82, 0x75, 0x26, 0x07, 0xEC, 0x8E, 0xF7, 0x86, 0xE4, 0x89, 0x8E, 0xD1, 0xF2, 0x63,
-    0xA9, 0x03, 0x91, 0xBD, 0xC6, 0x4E, 0x8C, 0x4B, 0x02, 0x7E, 0x26, 0xEB, 0x50, 0x81, 0x88, 0x7B,
-    0x16, 0x85, 0xA6, 0x62, 0xA3, 0x06, 0xE0, 0xFF, 0xBB, 0x46, 0xD7, 0x24, 0x73, 0x08, 0x27, 0x94,
-    0x04, 0x7C, 0x57, 0x06, 0x6F, 0xC0, 0x25, 0xF6, 0x1D, 0xC6, 0x7B, 0xB4, 0x96, 0xEB, 0xF4, 0xC6,
-    0x3F, 0xB7, 0xD6, 0xD7, 0xB0, 0x47, 0xE2, 0x7B, 0xA3, 0x21, 0x9E, 0xCC, 0x7D, 0x7A, 0x25, 0x98,
-    0x73, 0x32, 0x3A, 0x76, 0x2A, 0x76, 0x6C, 0x10, 0xE0, 0xF3, 0x75, 0x12, 0x84, 0x8C, 0xAC, 0x20,
-    0xC0, 0x82, 0x80, 0xFF, 0x89, 0x5C, 0x54, 0x49, 0x5F, 0xB4, 0x81, 0x96, 0x06, 0x96, 0x47, 0x65,
-    0xA2, 0x29, 0x1C, 0x12, 0x76, 0x5B, 0x48, 0xD9, 0x4E, 0xCA, 0xA3, 0x4C, 0xBD, 0x04, 0x29, 0x18,
-    0x53, 0x38, 0x24, 0x61, 0xF2, 0x11, 0x61, 0xB7, 0x30, 0xB3, 0x27, 0x17, 0x0D, 0xF9, 0xA6, 0x45,
-    0x5C, 0x25, 0x4C, 0x28, 0xEF, 0x89, 0x6B, 0x2C, 0xF6, 0x60, 0xAF, 0xD4, 0x75, 0x45, 0xD2, 0xBD,
-    0xBD, 0xBE, 0x90, 0x60, 0xF5, 0x12, 0x69, 0x15, 0x83, 0x6D, 0x5A, 0x22, 0x2D, 0xEC, 0x66, 0x8B,
-    0x5A, 0xC6, 0x0C, 0x12, 0xAE, 0x2A, 0xB4, 0x10, 0x57, 0x14, 0x58, 0x8D, 0x95, 0x7E, 0xA3, 0x69,
-    0xEF, 0x0C, 0xB0, 0xB1, 0x0D, 0x4A, 0x94, 0x34, 0xB7, 0x3A, 0xD9, 0xB3, 0x5B, 0xCF, 0x4E, 0xB3,
-    0xAB, 0xD8, 0x37, 0x7F, 0xAA, 0x93, 0xFF, 0xF0, 0x06, 0x05, 0x29, 0x69, 0x7C, 0x9E, 0xC2, 0x6B,
-    0x68, 0x08, 0xF7, 0xB0, 0xE1, 0x95, 0xF1, 0xB1, 0x6E, 0x11, 0xE4, 0x03, 0xC1, 0xEA, 0x3F, 0x24,
-    0x3E, 0xFA, 0x44, 0x31, 0x92, 0x90, 0x99, 0x7E, 0x74, 0xAB, 0xA2, 0xAF, 0x42, 0x4A, 0x42, 0x75,
-    0x24, 0xE4, 0xE0, 0xE7, 0xD7, 0x90, 0xBB, 0xE5, 0x0F, 0x48, 0x5C, 0x4E, 0xA5, 0xF1, 0xFA, 0x1D,
-    0x17, 0xCC, 0x87, 0x5E, 0x0D, 0x03, 0xB2, 0x7E, 0x0D, 0xE3, 0x66, 0x44, 0x83, 0xEF, 0xC0, 0x9E,
-    0xC9, 0x60, 0x4B, 0xC2, 0xA8, 0x44, 0x63, 0x5A, 0xA1, 0xED, 0x1F, 0x85, 0xB8, 0x7F, 0x87, 0x2D,
-    0x17, 0x40, 0x86, 0xFC, 0x14, 0x24, 0x37, 0x40, 0x72, 0x8D, 0x51, 0x4C, 0x6E, 0x68, 0x07, 0x88,
-    0xF8, 0xC9, 0x76, 0xB0, 0x7A, 0x2C, 0xBA, 0x93, 0xE2, 0x16, 0x68, 0x27, 0x98, 0xEB, 0x8C, 0x88,
-    0x7E, 0xF2, 0x5A, 0xF5, 0x72, 0x0F, 0xE8, 0xAB, 0x87, 0xFF, 0xEA, 0x86, 0x22, 0xB4, 0xD5, 0xCF,
-    0x64, 0xEF, 0x9D, 0xCD, 0x47, 0x63, 0xA0, 0x68, 0x47, 0x0E, 0xD1, 0x6A, 0xBB, 0xB7, 0x8F, 0xF2,
-    0xA1, 0xB8, 0x09, 0x87, 0xF9, 0xBB, 0xAD, 0x3F, 0x0C, 0xE7, 0x35, 0xDE, 0x88, 0xFD, 0x9F, 0x3B,
-    0x96, 0xC0, 0xB9, 0xA7, 0x44, 0x1F, 0xB3, 0xA8, 0x1F, 0x35, 0xC6, 0x4C, 0x8A, 0x32, 0x29, 0xD6,
-    0x43, 0xF1, 0xF2, 0xB6, 0x38, 0x33, 0xEB, 0x97, 0x4B, 0xD9, 0xB8, 0x25, 0x10, 0x77, 0xF3, 0x10,
-    0x01, 0xAC, 0x7B, 0xF4, 0xA8, 0xCB, 0x79, 0xB4, 0x42, 0x11, 0x4F, 0xEE, 0xDC, 0xDA, 0x00, 0x5F,
-    0xF7, 0xDE, 0x65, 0xEE, 0x77, 0x1A, 0xD8, 0xC8, 0x32, 0xFC, 0x13, 0xDD, 0x30, 0xA1, 0xAF, 0xC4,
-    0x6F, 0x72, 0xB6, 0x0F, 0x68, 0x4E, 0x29, 0x9D, 0xC9, 0x69, 0xD4, 0x7B, 0x29, 0xAC, 0xD7, 0x00,
-    0x43, 0xDC, 0x06, 0xDE, 0x2B, 0xFE, 0x9A, 0x8A, 0xBD, 0xAD, 0x0B, 0xFB, 0x99, 0x57, 0x4C, 0x97,
-    0x77, 0x7A, 0xBC, 0xB3, 0x91, 0x4C, 0xFA, 0x7D, 0x49, 0x3D, 0xC8, 0x4E, 0x2B, 0xB1, 0xFB, 0x8F,
-    0xD8, 0x46, 0xBE, 0x7E, 0x66, 0xBA, 0x16, 0x1E, 0x79, 0xD2, 0x3E, 0xEC, 0xB6, 0x44, 0x37, 0x24,
-    0xCB, 0xA1, 0xBB, 0xFB, 0x25, 0xDD, 0x67, 0xBB, 0xDD, 0xAB, 0xA1, 0x7B, 0x38, 0x76, 0xDF, 0x6E,
-    0xBA, 0xB5, 0xE1, 0x6B, 0x7E, 0xF3, 0xEC, 0x59, 0x88, 0xE9, 0xBA, 0xFC, 0x11, 0xEC, 0xBE, 0xEE,
-    0xF7, 0x8C, 0xC4, 0x83, 0x11, 0x01, 0x2A, 0x2E, 0x22, 0x90, 0xC2, 0x7B, 0xB1, 0x8F, 0xC4, 0xD0,
-    0x9B, 0xAE, 0x4A, 0x91, 0x80, 0x6D, 0xF5, 0x81, 0x04, 0x6B, 0x6B, 0x31, 0x6E, 0xD3, 0x6B, 0x85,
-    0xA9, 0x9D, 0x94, 0x1B, 0xFB, 0x9D, 0x89, 0x6B, 0x08, 0x38, 0x91, 0xB0, 0xB2, 0x89, 0x18, 0xC1,
-    0xD4, 0x11, 0x8F, 0xB8, 0xDE, 0xD0, 0x75, 0xDD, 0x7F, 0x2E, 0xED, 0x31, 0x6A, 0x80, 0x99, 0xA4,
-    0xD7, 0x7E, 0xD2, 0x27, 0x2E, 0xC2, 0x7E, 0x9F, 0xCE, 0x3E, 0x2F, 0xF4, 0xC0, 0x9A, 0xD2, 0xA6,
-    0x7A, 0x2F, 0x26, 0x6E, 0x0C, 0xEF, 0xA1, 0x7D, 0xA0, 0x1B, 0x67, 0xE9, 0xAF, 0x39, 0xC7, 0x60,
-    0xCD, 0x19, 0xFA, 0x6B, 0xCE, 0xCF, 0xD7, 0xD9, 0x29, 0xC8, 0xDB, 0xBC, 0xB5, 0x65, 0x4F, 0x2D,
-    0x95, 0xB9, 0x57, 0x7B, 0x3A, 0x1B, 0x4F, 0xE7, 0xC3, 0xBC, 0xA3, 0x4D, 0x60, 0x2E, 0xC8, 0x43,
-    0xDD, 0x85, 0x30, 0x14, 0x94, 0x9C, 0x05, 0x73, 0x35, 0xB8, 0x44, 0x61, 0x67, 0xFF, 0xB1, 0x3D,
-    0x21, 0x24, 0x72, 0x3E, 0xA4, 0x7C, 0xD0, 0x2A, 0xA4, 0x0D, 0xEB, 0x3E, 0xB7, 0x2D, 0xF6, 0xAB,
-    0x45, 0xD8, 0xFC, 0x22, 0xF6, 0x99, 0x49, 0xBE, 0xE2, 0x81, 0x3E, 0xEF, 0x08, 0xE4, 0xF9, 0xCF,
-    0x85, 0x87, 0x6A, 0x6A, 0x98, 0xF8, 0xEC, 0xD6, 0x54, 0xDD, 0x34, 0x47, 0x3B, 0xCF, 0xB2, 0x15,
-    0xCD, 0x3C, 0xC6, 0xE6, 0x8B, 0x30, 0x8B, 0x1C, 0x47, 0x42, 0xE4, 0x60, 0x1F, 0x69, 0x98, 0x0E,
-    0xB9, 0xC1, 0x66, 0x7E, 0xC2, 0x9D, 0x01, 0xB7, 0xA7, 0xA1, 0xC2, 0x25, 0x30, 0xFC, 0xCA, 0xAE,
-    0x9A, 0x6D, 0x0B, 0x83, 0x25, 0xD4, 0x59, 0x38, 0xD8, 0x55, 0x25, 0x05, 0x97, 0xD1, 0xB6, 0x4C,
-    0xE8, 0x89, 0x63, 0x6B, 0xCD, 0xF6, 0x0F, 0x0F, 0x6F, 0x69, 0xC0, 0x2C, 0x6C, 0x84, 0xEC, 0xFD,
-    0xE5, 0xC1, 0x80, 0x3A, 0x34, 0x0E, 0x6E, 0x1C, 0x7A, 0x77, 0xD3, 0x60, 0x4D, 0x90, 0x50, 0x83,
-    0x52, 0x3C, 0x1D, 0xE2, 0xAD, 0x0D, 0x42, 0x0A, 0xD2, 0x1A, 0x6E, 0xAF, 0xCE, 0x3F, 0xC5, 0xEE,
-    0xA0, 0x83, 0x99, 0x9E, 0xDC, 0x47, 0x90, 0xB8, 0xED, 0x03, 0x3A, 0x99, 0x55, 0xCC, 0xD6, 0xCC,
-    0x6A, 0x66, 0xCD, 0x13, 0xB3, 0x7A, 0x24, 0xD6, 0x6E, 0x05, 0x33, 0x83, 0xAC, 0x96, 0xDB, 0x3E,
-    0x44, 0x39, 0x9F, 0xCC, 0x3E, 0x10, 0xB5, 0xF6, 0x79, 0x19, 0x15, 0x76, 0xDD, 0x1F, 0x6B, 0x98,
-    0x5D, 0x76, 0x9A, 0x32, 0x5B, 0x31, 0xEB, 0x9E, 0x98, 0xAD, 0x46, 0x62, 0xED, 0x16, 0x33, 0x0B,
-    0xC9, 0xCA, 0x65, 0x26, 0xDF, 0x9D, 0xCF, 0x3F, 0x19, 0xD4, 0xBE, 0xB6, 0x97, 0x5B, 0xBF, 0x7D,
-    0x1B, 0x6E, 0x7B, 0x8A, 0xE0, 0x59, 0x8D, 0x59, 0x3D, 0x66, 0xCD, 0x57, 0x65, 0xFA, 0x75, 0x3D,
-    0xF6, 0x28, 0xC9, 0x8A, 0x06, 0xB7, 0xE1, 0x15, 0xD9, 0xCD, 0x3E, 0x7A, 0xE8, 0xB2, 0x6D, 0x33,
-    0x1B, 0x1A, 0x6A, 0x8D, 0x0C, 0x7E, 0x99, 0xB4, 0x88, 0x09, 0x1A, 0x0D, 0x18, 0xBF, 0x8C, 0x8D,
-    0x00, 0x8A, 0xFD, 0x8A, 0xFA, 0x8A, 0xF7, 0x44, 0x7A, 0xAF, 0xE1, 0xBD, 0xC4, 0xED, 0xE1, 0x7C,
-    0x79, 0x49, 0xEF, 0x0B, 0xD2, 0x9C, 0xF7, 0x05, 0x5F, 0xF6, 0xEC, 0xC3, 0xE4, 0xB9, 0x3F, 0x0A,
-    0xCB, 0x00, 0x87, 0x02, 0xB7, 0x02, 0x0E, 0xD7, 0xCF, 0xB3, 0x41, 0xF8, 0xFF, 0x3E, 0xDF, 0x78,
-    0x2B, 0xF4, 0xAD, 0xE9, 0x5D, 0xB6, 0x9B, 0x82, 0x6F, 0x8B, 0x7D, 0x82, 0x05, 0x59, 0x65, 0x41,
-    0xBE, 0xC2, 0x56, 0x96, 0x1B, 0xEC, 0x2B, 0x0A, 0x00, 0x27, 0x7D, 0xC4, 0x6E, 0x6C, 0x4C, 0x55,
-    0x58, 0x2D, 0x45, 0xCF, 0xB8, 0x7A, 0xA5, 0x65, 0xB6, 0x98, 0xBF, 0x7C, 0x02, 0x59, 0xC6, 0xF3,
-    0x7B, 0x8C, 0xC3, 0x51, 0x5C, 0x2E, 0xF5, 0x1E, 0x0C, 0x07, 0x87, 0x78, 0x43, 0xC4, 0xF4, 0x0D,
-    0x7D, 0xC3, 0x50, 0xAD, 0xC1, 0xC3, 0xFB, 0xDD, 0x86, 0x18, 0x07, 0x18, 0x7C, 0xB9, 0xDB, 0xFC,
-    0xBA, 0xD1, 0x0D, 0xFE, 0xBB, 0xF4, 0x15, 0xAE, 0x81, 0xBC, 0xB3, 0x31, 0xD3, 0x90, 0x40, 0x0E,
-    0xDC, 0x84, 0xE9, 0x09, 0x87, 0xA3, 0x25, 0xFD, 0x8D, 0xE0, 0x2B, 0xBA, 0x54, 0xDA, 0xA5, 0xBA,
-    0xC0, 0xDC, 0xF4, 0xBB, 0x0E, 0x64, 0xAE, 0x2C, 0x5C, 0xEC, 0x09, 0x16, 0x3C, 0x2C, 0x2E, 0x00,
-    0x51, 0xCD, 0xA2, 0xE5, 0xA6, 0x80, 0x91, 0x0F, 0xCB, 0x38, 0xBF, 0xDF, 0xFD, 0xF5, 0xDE, 0x78,
-    0x69, 0xDC, 0x68, 0x9B, 0xFD, 0xDA, 0x2E, 0x78, 0x06, 0x5A, 0xF0, 0xE6, 0x92, 0x7D, 0xCD, 0xC2,
-    0x9B, 0x30, 0x1D, 0x1E, 0x1D, 0x4C, 0x41, 0x51, 0xCF, 0xB1, 0x9A, 0xA5, 0x4F, 0x63, 0x68, 0x7B,
-    0x32, 0xA2, 0x26, 0xE1, 0x37, 0x19, 0xB7, 0x3C, 0x4F, 0xF7, 0xCC, 0x76, 0x87, 0x5C, 0xF5, 0xC7,
-    0x97, 0xF8, 0x35, 0x9C, 0x89, 0x97, 0x3C, 0x20, 0xC7, 0x59, 0x83, 0xF0, 0x58, 0x26, 0xEE, 0x9A,
-    0xC7, 0xE4, 0xA5, 0x07, 0xDF, 0x8C, 0x70, 0x24, 0xCE, 0xFD, 0x22, 0x71, 0x71, 0x06, 0x0E, 0xF3,
-    0x63, 0xAF, 0x8C, 0xE1, 0x8C, 0x68, 0x3A, 0x90, 0x99, 0x53, 0x85, 0xE6, 0x54, 0x8E, 0xBD, 0xE2,
-    0xBA, 0xB5, 0x8F, 0x0B, 0x7D, 0xAC, 0xB0, 0xAF, 0xFE, 0x88, 0xDE, 0xBF, 0xD2, 0x67, 0xF1, 0x2B,
-    0x8B, 0x1D, 0xDF, 0xD7, 0x69, 0xCA, 0x46, 0x5F, 0x4E, 0x67, 0x5F, 0x9B, 0xC8, 0x9C, 0x51, 0xEA,
-    0xD3, 0x3F, 0x27, 0xBD, 0x80, 0x3B, 0x72, 0xAE, 0xB6, 0xAE, 0xEC, 0x68, 0xE9, 0xB2, 0x55, 0x34,
-    0xCC, 0x46, 0x75, 0x0D, 0x72, 0x2B, 0x47, 0xD7, 0x6B, 0xFC, 0xC1, 0xF3, 0x20, 0xC6, 0xF5, 0x21,
-    0xAE, 0x9A, 0x1D, 0x21, 0x06, 0x29, 0xE4, 0xD5, 0xE7, 0x61, 0x6E, 0x55, 0x73, 0x2A, 0xBD, 0xA6,
-    0xAC, 0xFC, 0xEE, 0x66, 0xAC, 0x5F, 0x52, 0xAA, 0x9F, 0xA8, 0xED, 0x24, 0x39, 0x8E, 0x95, 0x5F,
-    0x01, 0xD2, 0x67, 0x9F, 0x38, 0x3F, 0x4B, 0x6D, 0x35, 0x61, 0xF5, 0x32, 0xCD, 0x2F, 0x7E, 0x33,
-    0x79, 0xF5, 0xCE, 0x82, 0x3D, 0xE3, 0x82, 0xB2, 0x26, 0xA5, 0x9E, 0x4E, 0x0B, 0x72, 0xB9, 0x68,
-    0xBE, 0x09, 0xA7, 0xF8, 0x31, 0x49, 0x6C, 0x4B, 0x2F, 0xF1, 0x4F, 0xED, 0x6B, 0x39, 0x79, 0x5D,
-    0xC6, 0xEB, 0x02, 0x6F, 0x17, 0x60, 0xFF, 0xD4, 0xD1, 0x12, 0x4B, 0xD1, 0xBF, 0xC4, 0x36, 0xF6,
-    0x24, 0x67, 0xFA, 0xED, 0xBC, 0x52, 0xFD, 0xDF, 0xA8, 0x5D, 0xED, 0xBC, 0x9E, 0xD4, 0x61, 0x78,
-    0x35, 0x78, 0x3D, 0xE8, 0x87, 0x1D, 0x5E, 0x2A, 0x4B, 0xC7, 0xF5, 0x59, 0xDA, 0xED, 0xD7, 0x6E,
-    0x3F, 0x7B, 0xD9, 0x18, 0x67, 0x7A, 0x1F, 0x9F, 0x47, 0x3B, 0xEA, 0xE1, 0xF2, 0xB0, 0xF5, 0x7B,
-    0x66, 0xEA, 0x43, 0xDB, 0x9B, 0xFB, 0xB3, 0xFD, 0x2E, 0xED, 0x7C, 0x7B, 0xD2, 0x57, 0xDE, 0x48,
-    0x3F, 0xCC, 0xA6, 0xD7, 0xC8, 0xFB, 0xFF, 0x34, 0xE7, 0x7A, 0x97, 0x5E, 0xBC, 0x27, 0xDB, 0xDF,
-    0xFB, 0xE7, 0x77, 0xDD, 0x8D, 0x83, 0x56, 0xDC, 0x65, 0x61, 0xC7, 0xFF, 0x53, 0x10, 0xD0, 0xB8,
-    0x03, 0x3D, 0xC7, 0xBF, 0x2E, 0xF4, 0xFE, 0x01, 0x91, 0x0C, 0x9C, 0xFD, 0x16, 0x61, 0x40, 0x62,
-    0xFD, 0xCB, 0xE6, 0x7C, 0x98, 0xDF, 0xA4, 0xB4, 0xC1, 0x6F, 0xE4, 0x9A, 0x9F, 0xDD, 0xF0, 0xF2,
-    0xF0, 0x6D, 0x3D, 0x5D, 0x9D, 0x93, 0xE4, 0x69, 0x29, 0x57, 0x77, 0x5B, 0xCE, 0x71, 0x41, 0xFF,
-    0x0B, 0xED, 0x54, 0x3D, 0x73, 0xD3, 0x40, 0x10, 0x7D, 0x67, 0x25, 0x98, 0x44, 0x85, 0x28, 0x48,
-    0x03, 0x85, 0x9A, 0x14, 0x99, 0x14, 0x51, 0xCF, 0x58, 0xD6, 0xF1, 0x0F, 0x5C, 0x10, 0x6A, 0x0A,
-    0x2A, 0xA7, 0xA0, 0x4D, 0x91, 0x38, 0xE2, 0x1F, 0x84, 0x02, 0x6A, 0x17, 0x14, 0x44, 0x0D, 0x0D,
-    0x85, 0x99, 0x31, 0xB6, 0xF2, 0x0F, 0x04, 0x7F, 0x00, 0xF1, 0x31, 0x69, 0x68, 0x8E, 0x89, 0x98,
-    0x5C, 0x26, 0xB2, 0x8F, 0x77, 0x17, 0x91, 0x01, 0x26, 0x30, 0xCC, 0xD0, 0xE6, 0x6E, 0x57, 0xBA,
-    0x3B, 0x9D, 0x77, 0xF7, 0xBD, 0xDD, 0x35, 0xA6, 0x29, 0xDA, 0xA6, 0x42, 0x70, 0x54, 0x23, 0x92,
-    0x03, 0x24, 0x9C, 0x5D, 0x44, 0xD4, 0x50, 0xEE, 0x36, 0x1A, 0x53, 0xBB, 0x4E, 0x23, 0xF7, 0x3D,
-    0x4C, 0x27, 0x08, 0xCE, 0x6A, 0x78, 0x46, 0x01, 0x7D, 0x89, 0x85, 0x38, 0x06, 0x3A, 0x3F, 0x0D,
-    0x40, 0x54, 0x80, 0xA7, 0x81, 0x80, 0x1A, 0x51, 0x63, 0xEA, 0x37, 0x8D, 0xD6, 0x57, 0x8D, 0xF6,
-    0xA1, 0x46, 0x70, 0x57, 0x63, 0x43, 0x68, 0x0C, 0xEE, 0x9F, 0xCA, 0xA9, 0x31, 0x39, 0x35, 0x05,
-    0xF7, 0x17, 0x8A, 0x1E, 0xD6, 0xB3, 0x61, 0x62, 0x54, 0x77, 0xB3, 0x47, 0x73, 0x94, 0x1D, 0x60,
-    0x70, 0x80, 0x3D, 0x53, 0xDC, 0x79, 0xA4, 0xDC, 0x95, 0x1A, 0x18, 0xF3, 0x29, 0x85, 0x9E, 0x6F,
-    0x29, 0xDA, 0xB8, 0x75, 0x00, 0xDC, 0xAE, 0x21, 0x4C, 0x8D, 0xF6, 0xE9, 0x02, 0x82, 0x1C, 0x08,
-    0x69, 0xA8, 0x4B, 0x8D, 0xA3, 0x12, 0x5D, 0x9E, 0x27, 0xC5, 0x9E, 0x0D, 0x9F, 0x80, 0x02, 0xA7,
-    0x16, 0x54, 0x28, 0x13, 0x82, 0x9F, 0xA1, 0x65, 0xB4, 0x03, 0x93, 0x65, 0x2F, 0x8C, 0xA9, 0xB3,
-    0x8C, 0xE6, 0x19, 0xAF, 0x82, 0x57, 0xA2, 0x9D, 0x23, 0x48, 0x79, 0x95, 0xBF, 0xC5, 0xAE, 0x73,
-    0x5C, 0x35, 0x5F, 0xFC, 0x1C, 0x8B, 0x12, 0x98, 0xEE, 0x93, 0x43, 0xA2, 0x2A, 0xDE, 0x38, 0xE6,
-    0x1C, 0x7B, 0xE9, 0x2E, 0x82, 0x8F, 0x9A, 0x1C, 0x95, 0x8E, 0xA7, 0xE0, 0xDD, 0xCC, 0xB1, 0xD7,
-    0x7C, 0x3D, 0xE7, 0x91, 0x6E, 0xFD, 0xC6, 0xAD, 0x1D, 0x82, 0x24, 0xF8, 0xCC, 0x45, 0xF4, 0xB8,
-    0xE6, 0x9D, 0x2E, 0x7D, 0x85, 0x84, 0x1D, 0xDA, 0x37, 0x83, 0x4C, 0x64, 0x74, 0x64, 0xA4, 0x6F,
-    0xDE, 0x03, 0x07, 0x16, 0x58, 0x64, 0x81, 0xC1, 0x86, 0xB3, 0xB4, 0x45, 0xFB, 0x26, 0xC7, 0xF2,
-    0x0B, 0x47, 0x1C, 0x5E, 0x35, 0xB2, 0xF2, 0xBA, 0x37, 0x35, 0x55, 0x7F, 0x3E, 0xBC, 0x38, 0xB1,
-    0x87, 0x9B, 0xEE, 0x30, 0x1B, 0x5E, 0x2C, 0x9C, 0x6F, 0x70, 0x4D, 0x01, 0x81, 0xB5, 0xF3, 0x20,
-    0x0D, 0xE9, 0x3E, 0xA6, 0xF3, 0x31, 0x46, 0xCD, 0x1C, 0x73, 0x17, 0xBB, 0xD0, 0x03, 0xD9, 0xCE,
-    0x09, 0x1F, 0x36, 0x27, 0x11, 0x77, 0x7E, 0xEE, 0x15, 0x5E, 0xD9, 0x52, 0x82, 0x13, 0x9C, 0xF6,
-    0xDD, 0x52, 0x5E, 0xE9, 0x15, 0xB4, 0x24, 0x23, 0x9B, 0x39, 0x3B, 0x3E, 0x98, 0xE2, 0xEC, 0x4B,
-    0x35, 0xC3, 0x58, 0xA3, 0x53, 0xA1, 0xA3, 0x2E, 0x13, 0x17, 0xC8, 0xFF, 0x17, 0x24, 0xD6, 0x85,
-    0xF1, 0x4D, 0xF2, 0x32, 0x8E, 0x6E, 0x44, 0xB8, 0x6C, 0xAE, 0x08, 0xB3, 0x1F, 0x9A, 0x2A, 0x7A,
-    0x52, 0x5F, 0xB7, 0x19, 0xED, 0xBA, 0xBC, 0x8E, 0x6D, 0x59, 0x79, 0xCA, 0x56, 0x4E, 0x62, 0x69,
-    0xB5, 0xCB, 0x14, 0x89, 0x99, 0x51, 0x56, 0x36, 0xEF, 0xB5, 0xCC, 0x3E, 0x22, 0x06, 0x96, 0xDC,
-    0xAD, 0xB1, 0x60, 0xEF, 0xBB, 0xD2, 0xE2, 0x5B, 0xD4, 0x4D, 0x96, 0x4B, 0xAE, 0x67, 0x3C, 0x4B,
-    0x9A, 0xEC, 0x24, 0xB8, 0x81, 0x01, 0x06, 0xCF, 0x6A, 0x96, 0x6D, 0x85, 0x6B, 0x99, 0xBC, 0xEA,
-    0x8B, 0xAB, 0xBE, 0xF8, 0xB5, 0x2F, 0x44, 0x26, 0x03, 0x53, 0x2E, 0xD9, 0xB2, 0x18, 0x01, 0xDB,
-    0xA2, 0xAF, 0x43, 0xA3, 0x77, 0xB1, 0xAD, 0x31, 0xAA, 0xA0, 0xC7, 0x2D, 0x9D, 0x98, 0x6D, 0xFF,
-    0xF3, 0x2A, 0xFA, 0x24, 0xB2, 0x0C, 0xA5, 0xEE, 0xA0, 0x43, 0x77, 0x93, 0xEC, 0xCD, 0xD4, 0xCC,
-    0x46, 0x2E, 0xF9, 0x84, 0x1A, 0xC9, 0x05, 0x9F, 0x59, 0x7C, 0x39, 0xB4, 0x84, 0x59, 0xA2, 0x42,
-    0x39, 0xE6, 0xB9, 0xF5, 0x10, 0xD0, 0x6C, 0x20, 0x7F, 0xA8, 0xDD, 0x77, 0x18, 0x69, 0x44, 0xEA,
-    0xEC, 0x3D, 0x4C, 0x52, 0xDC, 0xC4, 0x22, 0xF7, 0xCC, 0x7A, 0x3A, 0x82, 0xF7, 0x96, 0x25, 0x74,
-    0xC2, 0x02, 0x99, 0xCA, 0xF3, 0x2A, 0x66, 0x2F, 0x8A, 0xE3, 0x02, 0xDE, 0x21, 0x89, 0xA4, 0xCD,
-    0x0D, 0xE2, 0x5C, 0xC3, 0x32, 0xAE, 0x1D, 0xB0, 0x2D, 0xF2, 0x55, 0x0B, 0x76, 0xEC, 0x8A, 0x30,
-    0x66, 0x38, 0xC6, 0x46, 0xC4, 0xE8, 0x76, 0xBA, 0xA2, 0x0A, 0x4C, 0x21, 0x26, 0x78, 0x00, 0xC2,
-    0xFE, 0x49, 0xFA, 0xF2, 0xC4, 0xA8, 0xB9, 0xD0, 0x35, 0x76, 0xAA, 0x3F, 0xFC, 0x07, 0x0C, 0xB1,
-    0xF6, 0xFB, 0xAF, 0xD0, 0x53, 0x5E, 0xA1, 0x02, 0xA9, 0x62, 0xA8, 0x0A, 0x27, 0x05, 0x58, 0x35,
-    0xB5, 0x86, 0xDD, 0x86, 0x92, 0x49, 0x21, 0xA7, 0x43, 0x3C, 0x7F, 0xA0, 0x7E, 0x1B, 0xC3, 0x5E,
-    0x1F, 0xD6, 0xE1, 0x27, 0xBA, 0x6C, 0x19, 0x51, 0xD5, 0x2C, 0x08, 0x72, 0x3A, 0xC2, 0x8E, 0x3A,
-    0x7F, 0xBC, 0xFA, 0xCB, 0x63, 0x88, 0x87, 0x58, 0xED, 0xF5, 0xE5, 0xF1, 0x3F, 0xC4, 0xEB, 0xAE,
-    0x95, 0x3F, 0xAE, 0xC5, 0x0A, 0x1B, 0xE7, 0xC2, 0x75, 0x8D, 0xCE, 0x1C, 0xFA, 0xCC, 0x28, 0x35,
-    0x91, 0xBF, 0x62, 0x6A, 0x28, 0x1C, 0x09, 0x59, 0x39, 0x0E, 0x13, 0x76, 0xCA, 0x9C, 0x99, 0xCC,
-    0xE1, 0x15, 0x68, 0x95, 0x3D, 0xAF, 0x98, 0x9A, 0xF4, 0xF6, 0xA9, 0x2D, 0x26, 0x4F, 0xA2, 0x2D,
-    0x11, 0x3E, 0x65, 0x25, 0x32, 0x09, 0x97, 0x88, 0x2F, 0x6D, 0xBF, 0x79, 0x46, 0x62, 0x82, 0xEF,
-    0xAD, 0x58, 0xBF, 0x8F, 0xDC, 0xC6, 0x15, 0x1E, 0x92, 0xD6, 0x2D, 0x10, 0x22, 0x61, 0x8A, 0x9C,
-    0x52, 0xA8, 0x60, 0xDA, 0x28, 0x50, 0xD8, 0xAA, 0xB0, 0x6E, 0x28, 0x0B, 0x88, 0xCA, 0x5C, 0xE1,
-    0x95, 0x8B, 0x2B, 0x94, 0x32, 0x90, 0x10, 0x5F, 0xEB, 0xE2, 0x24, 0xD2, 0x4E, 0x91, 0xC2, 0x45,
-    0x0E, 0x29, 0x82, 0x94, 0x29, 0x54, 0x28, 0xAB, 0xE2, 0x9A, 0x14, 0x29, 0x4E, 0x4B, 0xC6, 0xFA,
-    0x03, 0xB2, 0x89, 0x21, 0xA8, 0x25, 0x60, 0x19, 0x02, 0xE4, 0x42, 0x84, 0x4D, 0x59, 0xBC, 0x15,
-    0xC9, 0xC9, 0xFB, 0xBE, 0x19, 0xEE, 0xEE, 0x9D, 0x61, 0x44, 0x01, 0xB4, 0x90, 0xBE, 0xC7, 0xE3,
-    0xBC, 0x99, 0x79, 0xF3, 0x7E, 0x0F, 0x95, 0xC2, 0x6F, 0x7F, 0x48, 0x95, 0x6F, 0x4C, 0xA9, 0xC2,
-    0x7E, 0x2F, 0x57, 0x71, 0x25, 0xAF, 0x74, 0x0E, 0xC0, 0x60, 0x06, 0x98, 0x5B, 0xB8, 0x38, 0xBB,
-    0x3F, 0x57, 0xDA, 0x74, 0x84, 0x42, 0xE9, 0x54, 0x46, 0x05, 0x74, 0x2A, 0x90, 0x94, 0x02, 0x51,
-    0x23, 0x30, 0x31, 0xC6, 0xB4, 0xAA, 0x00, 0x9C, 0x2B, 0x66, 0xF7, 0x14, 0x58, 0xBE, 0x07, 0x66,
-    0xF7, 0x15, 0x96, 0x72, 0x70, 0x2E, 0xDD, 0x55, 0x2A, 0x7A, 0xAF, 0x16, 0x08, 0x44, 0x88, 0xF8,
-    0x83, 0x85, 0xF2, 0x8C, 0x69, 0x54, 0x6C, 0xCC, 0xA0, 0x8A, 0xE1, 0x66, 0xE7, 0x99, 0xE3, 0xE8,
-    0x2F, 0x41, 0x77, 0x10, 0xA5, 0x61, 0x7D, 0x1C, 0xA9, 0x68, 0xD1, 0xC6, 0xB2, 0x6F, 0x93, 0x88,
-    0xB8, 0xF5, 0x8E, 0xD2, 0x57, 0xEB, 0x2B, 0x4A, 0xBF, 0x57, 0xBD, 0xAB, 0x74, 0x50, 0x1D, 0x08,
-    0x2C, 0x8E, 0x95, 0xBE, 0x5E, 0xB6, 0x80, 0x46, 0x25, 0x9F, 0xE6, 0xB5, 0x8A, 0xFF, 0xF5, 0x71,
-    0xAD, 0xA2, 0x17, 0xB2, 0x45, 0x68, 0x64, 0x8B, 0xC0, 0x04, 0xD8, 0xE2, 0x49, 0xF9, 0x5B, 0x95,
-    0x41, 0x5C, 0x0D, 0x38, 0x80, 0x3A, 0x64, 0x0B, 0xA5, 0xFE, 0x11, 0x89, 0x8C, 0x4D, 0xAC, 0x36,
-    0x7F, 0xBE, 0x91, 0xD1, 0xC4, 0x98, 0x5A, 0x99, 0x65, 0x51, 0x05, 0x83, 0xF2, 0xCB, 0xB0, 0x95,
-    0xF7, 0x11, 0xB4, 0x96, 0x94, 0xE3, 0xC9, 0xA8, 0xB5, 0xC2, 0x6A, 0xED, 0x27, 0x3F, 0x38, 0x1C,
-    0xD4, 0x71, 0x51, 0xF5, 0x6A, 0x6E, 0x04, 0x8A, 0xA7, 0xA9, 0x40, 0xAE, 0x7A, 0x8C, 0xCF, 0xA1,
-    0xDA, 0x42, 0x3D, 0xC4, 0x8C, 0x87, 0x98, 0x0B, 0x28, 0x05, 0xE2, 0x85, 0x40, 0x54, 0x0B, 0x4C,
-    0xFA, 0x87, 0x2A, 0x95, 0x6D, 0x8F, 0x4A, 0x08, 0x29, 0x46, 0x32, 0x46, 0x8C, 0xB3, 0x2D, 0xBB,
-    0x18, 0x28, 0x67, 0x0D, 0x3D, 0xB6, 0xEB, 0xDE, 0x10, 0xFA, 0xE9, 0x74, 0x17, 0xD3, 0x2A, 0x0B,
-    0xC3, 0x6C, 0x76, 0x78, 0x86, 0x65, 0xBB, 0x9F, 0xA6, 0x76, 0x47, 0xC2, 0xF7, 0x2F, 0xCF, 0x9F,
-    0x57, 0x88, 0x5E, 0x42, 0xE8, 0x25, 0x19, 0x8A, 0x4A, 0x0C, 0xE2, 0x1D, 0xDA, 0xF3, 0x0F, 0xDC,
-    0xED, 0xBB, 0x30, 0x1D, 0xA6, 0xEF, 0xC3, 0x49, 0x3A, 0x0B, 0x67, 0x46, 0xD7, 0x03, 0xE4, 0x5B,
-    0xEF, 0xE6, 0x03, 0x82, 0x06, 0x1A, 0x5F, 0x58, 0x3E, 0xD3, 0x99, 0x15, 0x80, 0x6B, 0x52, 0x5A,
-    0x89, 0xA2, 0xDC, 0xD2, 0x38, 0xB5, 0x94, 0xDE, 0xAC, 0xA6, 0xEA, 0xCE, 0x54, 0x56, 0x8A, 0x4D,
-    0x05, 0x95, 0x75, 0x85, 0x69, 0xE1, 0x5C, 0xC3, 0xC9, 0x9E, 0x19, 0x6E, 0x18, 0x65, 0x16, 0x4A,
-    0x4E, 0x90, 0xE5, 0x46, 0x4E, 0x5E, 0x8A, 0x39, 0x0D, 0x23, 0x21, 0x26, 0x4D, 0x85, 0x0E, 0xA4,
-    0x11, 0xA8, 0x58, 0x38, 0x2A, 0x45, 0x54, 0x63, 0xA9, 0xE7, 0x68, 0xE0, 0xE8, 0xC4, 0xD1, 0xC8,
-    0xD1, 0xD8, 0xF1, 0x27, 0xDA, 0xD2, 0x2B, 0x8E, 0x1E, 0x3B, 0xDA, 0x58, 0xEA, 0xD7, 0xA4, 0x0A,
-    0xFE, 0x8F, 0x5F, 0x78, 0xF6, 0x30, 0xEA, 0xB4, 0x37, 0xF6, 0xCA, 0xAF, 0x95, 0x3F, 0xA8, 0x40,
-    0xD0, 0x58, 0x4C, 0x89, 0x25, 0xF0, 0x35, 0xF1, 0x55, 0x05, 0xFC, 0xA6, 0x06, 0x7E, 0xDD, 0x08,
-    0xDE, 0x5E, 0x0E, 0x0F, 0x96, 0x39, 0x54, 0x67, 0x4A, 0x8B, 0xB2, 0x2D, 0x46, 0x1D, 0xC6, 0xBF,
-    0xAF, 0xD5, 0xE6, 0xE8, 0x4F, 0x4F, 0xF6, 0x5E, 0xBD, 0x4C, 0xFD, 0x3A, 0xF8, 0x06, 0xA3, 0xFE,
-    0xB7, 0x40, 0x35, 0x10, 0x0D, 0x31, 0x23, 0x6A, 0x62, 0x42, 0x8C, 0x89, 0x91, 0xBC, 0x1C, 0x0E,
-    0xA9, 0x7C, 0x63, 0x1C, 0x59, 0xD0, 0x14, 0x32, 0x03, 0x64, 0xD2, 0x92, 0xD0, 0xA8, 0x5A, 0x79,
-    0x96, 0xA8, 0xDE, 0x4B, 0x49, 0x82, 0x12, 0xA4, 0x9B, 0x94, 0x1C, 0x0B, 0x41, 0x82, 0x36, 0xF9,
-    0x32, 0xD5, 0x2A, 0xFA, 0x56, 0x16, 0xD2, 0x37, 0x8A, 0x2F, 0x40, 0x24, 0x1E, 0x44, 0x63, 0xDA,
-    0x9C, 0x40, 0x71, 0xFA, 0x6F, 0x29, 0x89, 0x52, 0xFF, 0x0F, 0x59, 0x90, 0x84, 0x2F, 0x77, 0x41,
-    0x02, 0x03, 0x23, 0x88, 0x45, 0xAD, 0x0D, 0xB6, 0x55, 0xB1, 0xA4, 0x0B, 0x21, 0x39, 0x90, 0xF0,
-    0x28, 0xBD, 0x57, 0xE4, 0x74, 0x56, 0x06, 0x7D, 0x6F, 0xDD, 0xB1, 0x47, 0x1E, 0x98, 0x0A, 0x09,
-    0xAB, 0x08, 0xB1, 0x1E, 0x56, 0xDA, 0x34, 0x78, 0x69, 0x7E, 0x55, 0x83, 0x85, 0x7E, 0x9E, 0xFC,
-    0x93, 0xA4, 0xB8, 0xDA, 0x61, 0xB1, 0x01, 0x11, 0x82, 0xA5, 0x25, 0xAA, 0x11, 0x3E, 0x5A, 0x02,
-    0x59, 0xFC, 0x5B, 0xFC, 0xA6, 0x17, 0xB5, 0x88, 0x21, 0x7B, 0xF8, 0x7D, 0x22, 0xD3, 0x85, 0x2F,
-    0x94, 0xC5, 0xC4, 0x91, 0xFC, 0xB6, 0x87, 0x5F, 0x7A, 0x2D, 0x77, 0xC7, 0x5F, 0xD1, 0xBF, 0xD3,
-    0x40, 0xC6, 0xC2, 0xAF, 0x4F, 0x6E, 0x0A, 0x67, 0x00, 0xF5, 0x08, 0x69, 0x0B, 0x43, 0xC9, 0xBD,
-    0x5D, 0xB5, 0x83, 0xA0, 0x89, 0x53, 0xAA, 0x5C, 0xF2, 0xA5, 0x0A, 0x3B, 0x01, 0x47, 0x92, 0x34,
-    0xEA, 0x84, 0x21, 0xCE, 0xA3, 0x3B, 0xEA, 0xAE, 0xB8, 0x5A, 0xBC, 0xA3, 0xEE, 0x88, 0x6A, 0x84,
-    0x1C, 0x0B, 0x49, 0x12, 0x11, 0x20, 0x2C, 0x77, 0x62, 0x90, 0xC5, 0x4E, 0x9C, 0x76, 0x6A, 0xB2,
-    0xB8, 0x12, 0xA5, 0xAD, 0xF5, 0x11, 0x63, 0x1D, 0xC9, 0x94, 0xE2, 0x55, 0x47, 0x5F, 0x2D, 0xC5,
-    0x4D, 0xDA, 0xC9, 0x23, 0x58, 0xBF, 0x0D, 0x3E, 0xAF, 0x94, 0xD7, 0x34, 0x20, 0xEA, 0x65, 0x1D,
-    0x7C, 0x21, 0x0A, 0x3A, 0xA9, 0xFD, 0x67, 0x42, 0x96, 0xB5, 0xFF, 0x4A, 0xB4, 0x36, 0xAF, 0xBC,
-    0xD7, 0x42, 0x32, 0xC9, 0x41, 0x20, 0x0B, 0xA8, 0x40, 0xB2, 0x9F, 0x82, 0xD0, 0x42, 0x8A, 0x94,
-    0x19, 0x35, 0x43, 0x94, 0x9F, 0x28, 0xB5, 0xC3, 0x44, 0xA5, 0x19, 0xE6, 0xBA, 0x83, 0xD3, 0x0B,
-    0xA2, 0x00, 0xA1, 0x7C, 0xA4, 0xC0, 0x38, 0xD7, 0x5D, 0x50, 0x47, 0xE5, 0xDB, 0x44, 0xA5, 0xEE,
-    0x12, 0xE7, 0x40, 0xAF, 0x03, 0x4E, 0xDA, 0x2E, 0x58, 0xCE, 0x8A, 0xBA, 0x0B, 0x70, 0x6C, 0xE0,
-    0x09, 0x63, 0x91, 0x8E, 0x3E, 0xA9, 0xD7, 0x18, 0x0A, 0xA2, 0x18, 0xE6, 0x0E, 0xBD, 0xE9, 0xDE,
-    0xCB, 0x71, 0xD4, 0xDB, 0x05, 0x66, 0xE6, 0x7A, 0x2D, 0xFE, 0x66, 0x9E, 0x49, 0xAC, 0x0C, 0x7B,
-    0xAF, 0x25, 0x7A, 0x2A, 0x84, 0x86, 0x1C, 0x5E, 0xC2, 0x28, 0x4B, 0x11, 0x40, 0x05, 0xCA, 0x00,
-    0x6D, 0x4F, 0x9C, 0x7C, 0x0F, 0x86, 0xE4, 0x14, 0xCC, 0xC8, 0x8F, 0xAC, 0x35, 0xAE, 0x66, 0x57,
-    0x96, 0x5D, 0x3E, 0xE7, 0x8E, 0xD7, 0xB8, 0xFB, 0xE9, 0x3C, 0xA2, 0xB6, 0x66, 0x33, 0xA9, 0xC5,
-    0x21, 0x95, 0x1B, 0x8E, 0x99, 0x94, 0xBF, 0x89, 0x41, 0xB2, 0xCD, 0x20, 0xBF, 0xCF, 0x53, 0x84,
-    0x3D, 0xB2, 0x10, 0xBB, 0x04, 0x08, 0x8A, 0xC1, 0x74, 0x55, 0xED, 0x6C, 0xBA, 0xB7, 0x79, 0x1C,
-    0xA6, 0x4A, 0x1D, 0x9E, 0x97, 0x7A, 0xA3, 0x6C, 0x80, 0x3B, 0xFC, 0xC5, 0x60, 0x8B, 0xBF, 0xAD,
-    0xFE, 0xDC, 0x90, 0xB3, 0x6C, 0xAF, 0x61, 0x0B, 0xA8, 0x6D, 0x43, 0xDC, 0x5E, 0x51, 0xAB, 0x7C,
-    0x04, 0xE7, 0xF3, 0x62, 0x15, 0x84, 0xB1, 0xD5, 0xFC, 0xD4, 0xD6, 0x86, 0x24, 0x07, 0x16, 0x78,
-    0xC6, 0x16, 0xE2, 0xA6, 0x0D, 0x10, 0x95, 0xB9, 0xE3, 0x4A, 0x1D, 0x65, 0xEC, 0xB8, 0x7F, 0xC7,
-    0x1A, 0xD2, 0xB1, 0x6C, 0x77, 0xDC, 0xA6, 0x2B, 0xEC, 0x39, 0x45, 0x14, 0x8B, 0xE7, 0x8D, 0x79,
-    0x2C, 0xA5, 0xC7, 0xD8, 0xC8, 0x86, 0x31, 0x65, 0x56, 0xCB, 0xBD, 0x7A, 0x62, 0x46, 0x84, 0x0E,
-    0xC6, 0x5D, 0xEC, 0x8E, 0x3E, 0x77, 0x87, 0x2A, 0x3A, 0x2A, 0x07, 0xB2, 0x95, 0x9A, 0xB1, 0x92,
-    0x31, 0x54, 0x2C, 0x8E, 0xC7, 0x63, 0xC3, 0xB0, 0x42, 0xF6, 0x45, 0xD7, 0xD8, 0x83, 0xDD, 0x24,
-    0x32, 0x84, 0x35, 0x75, 0x96, 0x55, 0xEC, 0x40, 0x52, 0x1E, 0x3D, 0x95, 0x05, 0x8A, 0x42, 0xFC,
-    0xC7, 0xEB, 0xF5, 0x91, 0x88, 0x28, 0xA9, 0x86, 0x2B, 0x30, 0x49, 0x15, 0x25, 0x4D, 0x07, 0xCE,
-    0x84, 0x68, 0xB8, 0x7E, 0x4B, 0xDC, 0x3D, 0xBD, 0xE3, 0x1A, 0x47, 0x67, 0x30, 0xE6, 0x50, 0x39,
-    0x0B, 0x5A, 0x7B, 0x26, 0xC3, 0x91, 0xA1, 0xA9, 0x7F, 0xA8, 0x6C, 0xEA, 0xA6, 0x7B, 0x5B, 0x27,
-    0xD9, 0x3A, 0xF4, 0x2C, 0x93, 0xE8, 0xC9, 0xFA, 0x00, 0xB2, 0x2A, 0xD7, 0x8B, 0x4B, 0x77, 0x44,
-    0x31, 0x0D, 0xD3, 0xA4, 0xAD, 0xA2, 0xAE, 0x1A, 0xAF, 0x1E, 0xEC, 0x50, 0x36, 0x3E, 0xCC, 0xC1,
-    0xEF, 0xBD, 0x4F, 0x7F, 0xD0, 0x79, 0x6C, 0x72, 0xAB, 0xC6, 0xC2, 0xD4, 0xB0, 0x5C, 0xE1, 0x0D,
-    0xD7, 0x5B, 0x3C, 0x0C, 0x41, 0xE3, 0x77, 0xBE, 0x38, 0x45, 0x37, 0x91, 0x01, 0x31, 0xE7, 0xA4,
-    0x15, 0x09, 0x10, 0xA0, 0xB1, 0xC4, 0xAE, 0x27, 0x6F, 0x45, 0x0B, 0x51, 0x19, 0xB4, 0x61, 0x75,
-    0xC1, 0xC8, 0x66, 0x61, 0x1D, 0x21, 0xCD, 0x26, 0x2F, 0xF7, 0x25, 0x37, 0xCB, 0xA2, 0xAC, 0x1B,
-    0xE6, 0xA9, 0xEC, 0x91, 0x59, 0xC7, 0x53, 0xD9, 0x39, 0xA7, 0x85, 0xBB, 0xA3, 0x26, 0xE6, 0xE3,
-    0x43, 0x3F, 0x3E, 0x8C, 0x81, 0xE1, 0x8D, 0x0F, 0x7E, 0xEB, 0x1E, 0xE8, 0x50, 0x7C, 0xA8, 0xD7,
-    0xAA, 0xF4, 0x90, 0xD2, 0x42, 0x49, 0xEB, 0x2A, 0x7E, 0x26, 0x8C, 0x49, 0x0A, 0x6F, 0x57, 0x84,
-    0x7E, 0xF5, 0xC4, 0x04, 0x06, 0x27, 0xF9, 0x58, 0x58, 0xE2, 0xCF, 0x64, 0x9D, 0xE8, 0x11, 0x9A,
-    0xE0, 0x27, 0x0B, 0xD8, 0xB0, 0x84, 0xD3, 0xE7, 0xB0, 0xBB, 0x13, 0xE4, 0xC7, 0x80, 0xCB, 0x68,
-    0x34, 0x0E, 0x60, 0xE1, 0x21, 0x7A, 0x91, 0xFB, 0x66, 0xFF, 0xD7, 0xA5, 0x44, 0x78, 0xB8, 0x08,
-    0x9F, 0xC8, 0xC1, 0xA3, 0x47, 0x6D, 0x50, 0x27, 0x57, 0x6B, 0xBF, 0xCD, 0xD4, 0x5F, 0xBD, 0x33,
-    0xED, 0xDA, 0xC3, 0x15, 0x74, 0xEE, 0x1C, 0xC1, 0x83, 0x16, 0x7B, 0x54, 0x80, 0xD4, 0x33, 0xCB,
-    0x1C, 0x72, 0x9B, 0x9E, 0x28, 0x1B, 0x08, 0x4B, 0xB1, 0x00, 0x4A, 0x5E, 0xB9, 0xD1, 0x4F, 0xF7,
-    0x4E, 0x52, 0xDB, 0x16, 0xDC, 0x1A, 0x66, 0x0F, 0x86, 0x5C, 0xDE, 0x8B, 0x0A, 0x36, 0x71, 0xB3,
-    0x75, 0xB0, 0xB3, 0x3C, 0x46, 0x89, 0x37, 0x3C, 0xC0, 0x6A, 0xE3, 0xCA, 0x72, 0x38, 0xAF, 0x4F,
-    0xD5, 0xE9, 0xAC, 0xF0, 0x26, 0x08, 0x0F, 0x26, 0x52, 0xE1, 0xFB, 0xC8, 0x01, 0xC8, 0xAF, 0x35,
-    0xDA, 0x72, 0xF4, 0xB3, 0x4F, 0x9B, 0x89, 0xE8, 0x02, 0xA3, 0xD2, 0x99, 0x37, 0x4C, 0x87, 0x0D,
-    0x7D, 0xAB, 0x61, 0xC4, 0x35, 0x8C, 0xC9, 0x86, 0x0E, 0xD7, 0x30, 0x5F, 0x6C, 0xA2, 0xB8, 0xC8,
-    0x19, 0x6C, 0x82, 0x16, 0xFC, 0x41, 0x8B, 0xB9, 0x82, 0x25, 0x30, 0x5E, 0x00, 0xA3, 0x06, 0x38,
-    0xE9, 0x81, 0xBE, 0xC9, 0x05, 0xE5, 0x9A, 0xB2, 0x2C, 0x5A, 0xDC, 0x58, 0xC4, 0xD5, 0xBC, 0x82,
-    0x81, 0xE4, 0x9D, 0xAC, 0xA5, 0xB5, 0xE8, 0x3C, 0xDF, 0xA6, 0x50, 0x7A, 0x4B, 0xC1, 0xF7, 0x43,
-    0xCB, 0x43, 0xB2, 0xCF, 0x6D, 0x7B, 0xFA, 0xD4, 0x9C, 0xF5, 0x02, 0x99, 0x46, 0x7A, 0x09, 0xF6,
-    0xE3, 0xD2, 0xB7, 0x52, 0xB7, 0xCD, 0xAD, 0xE2, 0xF9, 0xD1, 0xF2, 0x9E, 0xB8, 0x0E, 0x52, 0x53,
-    0x01, 0xFF, 0xDB, 0x1E, 0xA6, 0x1F, 0x9C, 0xEC, 0x16, 0x1B, 0x3C, 0xC8, 0x57, 0x86, 0x05, 0x27,
-    0x63, 0x39, 0xD2, 0x29, 0xB2, 0x59, 0x52, 0x42, 0x82, 0xB8, 0x44, 0xBC, 0x45, 0x58, 0x56, 0xC6,
-    0x32, 0x6E, 0x84, 0x48, 0x0E, 0x46, 0x8F, 0xBE, 0x80, 0x86, 0xC7, 0x26, 0x7D, 0x9F, 0xAA, 0xF5,
-    0x1A, 0x54, 0x15, 0x30, 0x92, 0xC5, 0x32, 0xFA, 0x1B, 0xCF, 0x22, 0x03, 0xF7, 0xB5, 0x98, 0x4E,
-    0xA7, 0x7B, 0xE6, 0x31, 0x6C, 0xD4, 0x33, 0x1B, 0x21, 0x8F, 0x66, 0xE0, 0xBB, 0x6D, 0x9E, 0xCF,
-    0x66, 0x8E, 0x67, 0x7F, 0x29, 0xA5, 0xC7, 0x76, 0x4F, 0x48, 0x1C, 0x6B, 0xB4, 0x6F, 0xEA, 0x31,
-    0xD3, 0x7C, 0x84, 0xD4, 0x7F, 0xD4, 0x32, 0xF5, 0x23, 0x4C, 0x6C, 0x8E, 0xDA, 0x1E, 0xFB, 0x1B,
-    0x08, 0x52, 0x5B, 0x7F, 0x78, 0xAA, 0x58, 0xC2, 0x6C, 0xE9, 0x11, 0xFE, 0xFF, 0xD4, 0x1F, 0xAA,
-    0x60, 0xC0, 0x68, 0xD8, 0x02, 0xA3, 0x1A, 0x98, 0x94, 0x40, 0x9D, 0x03, 0xB3, 0x94, 0xC8, 0x15,
-    0x8A, 0x37, 0x40, 0xCB, 0x6F, 0xE7, 0x6A, 0xAE, 0x93, 0x2C, 0xD6, 0x2B, 0x4F, 0x3A, 0xA0, 0x6F,
-    0x3E, 0xA9, 0xCF, 0xA1, 0x75, 0x59, 0xF6, 0x94, 0xB6, 0xA7, 0x2A, 0x71, 0x7A, 0xBF, 0x59, 0x4B,
-    0x4B, 0xBC, 0xAC, 0x7E, 0x24, 0x78, 0xC0, 0xE6, 0xFE, 0x58, 0xBA, 0x33, 0x56, 0x95, 0xB1, 0xC2,
-    0x5C, 0x80, 0x96, 0x2A, 0x56, 0x8F, 0xEA, 0x7C, 0x7F, 0xAB, 0x98, 0xEE, 0x7A, 0x7C, 0xFF, 0x16,
-    0x51, 0x33, 0xC6, 0xF5, 0x97, 0xBF, 0x11, 0x8C, 0x99, 0x65, 0x27, 0xA6, 0xB6, 0xAD, 0xEF, 0xFA,
-    0x17, 0x43, 0xAF, 0xCC, 0x08, 0x39, 0x6C, 0xF9, 0x02, 0x44, 0xFC, 0xFF, 0xC2, 0x78, 0xED, 0x5D,
-    0xD5, 0x90, 0x33, 0xC4, 0x5E, 0x5C, 0x92, 0x85, 0x72, 0x35, 0x9C, 0xF6, 0x34, 0xB9, 0x4D, 0x8E,
-    0x36, 0x32, 0x12, 0x7A, 0x86, 0xA8, 0xA7, 0x75, 0x6E, 0x67, 0x77, 0x34, 0x6E, 0x6A, 0xB9, 0x95,
-    0xDE, 0xDF, 0x3A, 0x8C, 0x16, 0xFA, 0x99, 0x49, 0xDA, 0x70, 0x71, 0xB9, 0x8F, 0x9A, 0x03, 0x21,
-    0xED, 0x64, 0x71, 0x29, 0x5A, 0xBC, 0xDB, 0x04, 0xE5, 0x25, 0xE9, 0x55, 0x41, 0x74, 0x3E, 0x19,
-    0xAE, 0x95, 0x09, 0xFB, 0x69, 0xAA, 0x7A, 0x69, 0xA5, 0x6D, 0x26, 0x8F, 0x7F, 0x87, 0xD0, 0x13,
-    0x16, 0x21, 0x7F, 0x27, 0x41, 0x20, 0x0D, 0x8C, 0x26, 0xC2, 0x99, 0x76, 0x68, 0x3D, 0xE0, 0x46,
-    0xB3, 0x55, 0x4F, 0xF2, 0x76, 0x81, 0xDD, 0x11, 0xE1, 0xA2, 0x59, 0xCE, 0xF0, 0x01, 0x65, 0xBC,
-    0xE3, 0x22, 0xC9, 0x6F, 0xCB, 0xE5, 0x77, 0x83, 0x65, 0xE3, 0x32, 0x1D, 0x80, 0x65, 0x1F, 0x09,
-    0x0D, 0xBA, 0xD3, 0xFD, 0x68, 0x05, 0xF6, 0x33, 0xEC, 0x3E, 0x6D, 0x40, 0xF6, 0xAB, 0xCE, 0x8C,
-    0x86, 0xD8, 0xE0, 0x69, 0xC6, 0x55, 0xB8, 0xA8, 0xDE, 0xB8, 0x22, 0x8F, 0x78, 0x0E, 0xE8, 0x21,
-    0x01, 0xE9, 0x7D, 0xF2, 0x20, 0xE2, 0xB6, 0xD8, 0x0E, 0xDA, 0x56, 0x23, 0x2B, 0xD4, 0x87, 0x4A,
-    0xFD, 0x4C, 0x5F, 0xB0, 0xA3, 0x18, 0x28, 0x28, 0x09, 0x2D, 0x97, 0xF1, 0xD2, 0xFC, 0x91, 0xA6,
-    0x2B, 0x68, 0xE5, 0xFE, 0x65, 0xC4, 0xC2, 0xDE, 0xF3, 0xC6, 0x4B, 0x9F, 0xA6, 0xB4, 0x9A, 0xD1,
-    0xAE, 0xD9, 0xBB, 0xE8, 0x23, 0x5E, 0x02, 0xE8, 0x11, 0xDA, 0x39, 0xC2, 0xE6, 0xBD, 0x77, 0x18,
-    0x9D, 0xD2, 0xB9, 0x5E, 0x68, 0xEF, 0x6A, 0x07, 0x36, 0xAA, 0xD4, 0x81, 0xD7, 0x9C, 0xA2, 0x5A,
-    0xB5, 0xCE, 0xD3, 0xE4, 0xB7, 0x14, 0x15, 0xF0, 0xCA, 0x52, 0x31, 0x43, 0xDB, 0xDE, 0x53, 0xC6,
-    0x79, 0x54, 0xF0, 0x25, 0x8E, 0xE2, 0x1B, 0x50, 0xFB, 0x8E, 0xA3, 0xBF, 0xF4, 0xCB, 0x50, 0xE4,
-    0x68, 0xCD, 0x1F, 0xEB, 0xC8, 0x7E, 0x7B, 0xE9, 0xF0, 0x79, 0xC8, 0x7C, 0xD6, 0x53, 0x19, 0x52,
-    0x6F, 0x90, 0xA5, 0x68, 0x3A, 0xC9, 0x46, 0xA1, 0x6B, 0x18, 0xB4, 0xED, 0x88, 0xD4, 0xA5, 0xC4,
-    0x9D, 0x21, 0xAA, 0xC6, 0xB6, 0x7A, 0x76, 0x6C, 0x63, 0xC0, 0xF5, 0xDA, 0x89, 0xF3, 0x7E, 0x17,
-    0x74, 0x5E, 0xBB, 0xD9, 0x5D, 0xBC, 0x39, 0xB9, 0xCD, 0xFB, 0x76, 0x6C, 0xDD, 0xC5, 0xB0, 0x2C,
-    0x06, 0xE6, 0x4F, 0xED, 0xBE, 0xD4, 0xE1, 0xD6, 0x97, 0x22, 0xA5, 0xE2, 0x85, 0x70, 0x66, 0xA9,
-    0xA4, 0xAD, 0x56, 0x72, 0x97, 0x4E, 0x85, 0xC4, 0x65, 0x86, 0xE9, 0xD1, 0xA2, 0x00, 0x09, 0xAB,
-    0x39, 0x49, 0x4D, 0x82, 0x92, 0xE0, 0xB5, 0xAE, 0x32, 0xBC, 0x19, 0x91, 0x23, 0xDD, 0x1B, 0x33,
-    0x85, 0xC7, 0x2F, 0x53, 0xC8, 0x2B, 0x6C, 0xCA, 0xC5, 0x6E, 0xEC, 0xE1, 0x88, 0x99, 0xB5, 0x7D,
-    0xBA, 0xC6, 0x6C, 0x3D, 0xEA, 0x91, 0x53, 0x54, 0x7A, 0xDB, 0x7C, 0x65, 0x6C, 0x55, 0x29, 0xED,
-    0x37, 0x45, 0xE9, 0x1A, 0xCE, 0x76, 0x04, 0xD2, 0x89, 0xE4, 0xFC, 0x16, 0x54, 0x8E, 0xF8, 0xBF,
-    0x3A, 0x08, 0x7E, 0xDF, 0x03, 0xA1, 0x59, 0xEE, 0xDC, 0xCC, 0xAD, 0x29, 0x2A, 0x35, 0xE6, 0x6A,
-    0xF1, 0xE4, 0x9B, 0xA8, 0x7B, 0xC3, 0x41, 0x74, 0x54, 0x49, 0xBD, 0x3B, 0x88, 0xFE, 0x20, 0x97,
-    0xF2, 0xEA, 0x20, 0xFA, 0xA4, 0x93, 0x28, 0x92, 0x79, 0x72, 0xFD, 0xCC, 0x85, 0xE0, 0x2B, 0xA8,
-    0x90, 0x4C, 0x64, 0x17, 0xA2, 0x53, 0x4B, 0xE4, 0xF5, 0x8A, 0xA4, 0x20, 0x1B, 0x77, 0x1A, 0x17,
-    0x5F, 0x63, 0x82, 0x74, 0xC9, 0xD3, 0x96, 0x3B, 0xD6, 0xE8, 0x8D, 0x12, 0xEC, 0xF2, 0x92, 0xED,
-    0x14, 0xB6, 0x8E, 0xE8, 0xAB, 0x91, 0xD9, 0x24, 0xEA, 0xDE, 0xCF, 0x91, 0xDA, 0x76, 0x36, 0x21,
-    0x33, 0x73, 0xA6, 0xB0, 0x0A, 0x80, 0x24, 0x2F, 0x01, 0x9A, 0x61, 0xB1, 0x0C, 0x32, 0x20, 0x02,
-    0xD3, 0x11, 0xF8, 0x67, 0x01, 0xC5, 0xF7, 0x2A, 0x9B, 0x4A, 0x42, 0xE1, 0x45, 0xCF, 0xCE, 0x9D,
-    0xEE, 0xF7, 0xAB, 0x69, 0x3A, 0x67, 0x7B, 0xFE, 0x5D, 0xD0, 0x80, 0x42, 0x46, 0xC5, 0xB5, 0x32,
-    0x68, 0x2E, 0x83, 0xC1, 0x33, 0xBA, 0xDF, 0x69, 0xA9, 0xAC, 0xA4, 0x6A, 0x2A, 0x37, 0x00, 0x11,
-    0x4A, 0x04, 0x0B, 0xCC, 0x9F, 0x8F, 0xF1, 0xED, 0x14, 0x21, 0x91, 0xB8, 0xDB, 0x10, 0x94, 0xC2,
-    0xFF, 0x4E, 0x4F, 0xAB, 0xBF, 0x73, 0xCB, 0x03, 0x5E, 0x99, 0xF3, 0x0E, 0xE6, 0x62, 0x0D, 0x59,
-    0xAB, 0xB5, 0x17, 0x40, 0x35, 0xDE, 0x58, 0x7A, 0xFC, 0xBF, 0x28, 0xD7, 0xD9, 0xFF, 0x02, 0xD3,
-    0x5A, 0xB5, 0x6A, 0xD5, 0x12, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x13, 0x0C, 0x20, 0x00, 0x00,
-    0xD5, 0x53, 0x31, 0x4E, 0xC3, 0x40, 0x10, 0x9C, 0x24, 0x8A, 0x22, 0xE4, 0x22, 0x14, 0x04, 0x09,
-    0x52, 0x98, 0x22, 0x15, 0x4D, 0x9E, 0x70, 0x57, 0x51, 0xA7, 0x89, 0x28, 0x69, 0x11, 0x0D, 0x4F,
-    0x70, 0x9E, 0x90, 0x26, 0x3F, 0xA0, 0xE1, 0x13, 0x49, 0x9E, 0x90, 0x27, 0xB8, 0x49, 0xEF, 0x22,
-    0x45, 0x0A, 0x9F, 0x97, 0xD9, 0xBB, 0x4B, 0x0C, 0x06, 0xD1, 0x20, 0x22, 0xB0, 0xEC, 0x9D, 0xF3,
-    0x6A, 0xEF, 0x76, 0x67, 0x67, 0x0F, 0x78, 0x9A, 0xE3, 0xFA, 0x05, 0x89, 0xEC, 0xDA, 0xE2, 0x30,
-    0x96, 0x22, 0x91, 0x12, 0x66, 0x3D, 0xE9, 0xE7, 0x17, 0x58, 0x01, 0xE3, 0x35, 0xB0, 0x04, 0xCC,
-    0x0C, 0x70, 0x04, 0xDB, 0x80, 0xA1, 0xC8, 0x9D, 0xC8, 0x26, 0x13, 0x79, 0x26, 0x0C, 0xAA, 0x69,
-    0x37, 0x5B, 0xD8, 0x2F, 0x23, 0x4F, 0x00, 0x4A, 0x45, 0x89, 0x8C, 0x94, 0x86, 0x53, 0x12, 0x95,
-    0x52, 0x70, 0x4A, 0x60, 0xA4, 0x41, 0xA8, 0x0D, 0x0B, 0xB7, 0x2E, 0x53, 0xC3, 0xA2, 0xE9, 0x71,
-    0xF8, 0x05, 0xC3, 0x82, 0x1E, 0xB5, 0x20, 0x77, 0x2C, 0xC8, 0x1D, 0x0B, 0x6A, 0x06, 0x9F, 0xAA,
-    0x20, 0x15, 0x1B, 0x51, 0xEE, 0x2B, 0x44, 0xC1, 0xD9, 0xBD, 0x20, 0x79, 0x36, 0x8B, 0xA2, 0xD3,
-    0x13, 0x64, 0x3F, 0xAB, 0xDB, 0xFB, 0x79, 0x11, 0xE5, 0x37, 0x36, 0x0E, 0x80, 0xB1, 0x71, 0x04,
-    0xCC, 0x61, 0x08, 0xFE, 0xE0, 0x22, 0x34, 0xE1, 0xF6, 0xD0, 0x04, 0x7A, 0x1A, 0x4D, 0xE0, 0xA2,
-    0xD1, 0x84, 0x6F, 0x0F, 0xFC, 0x97, 0x4D, 0xF0, 0x53, 0xD0, 0x11, 0xE1, 0xBD, 0xEE, 0x8B, 0x14,
-    0x74, 0x6F, 0x86, 0x25, 0x90, 0xD9, 0x16, 0x43, 0xFC, 0x8C, 0xA2, 0x42, 0x1C, 0x1A, 0x57, 0xFF,
-    0x26, 0xE4, 0xA7, 0xD3, 0xAC, 0x96, 0x2C, 0xAD, 0xFB, 0x18, 0xF3, 0x93, 0x37, 0xA4, 0x0B, 0xA9,
-    0xCD, 0x76, 0xEE, 0x74, 0x36, 0x99, 0x05, 0x3D, 0xD9, 0xE8, 0xC8, 0x0D, 0xD4, 0xB4, 0x5F, 0xE1,
-    0x1F, 0x13, 0x7C, 0x10, 0xD9, 0x7B, 0xB7, 0xEB, 0xF9, 0x8B, 0xDD, 0x29, 0xF4, 0x14, 0x8F, 0x4B,
-    0xC5, 0x5E, 0x1E, 0x30, 0xFE, 0x77, 0xEF, 0x3D, 0xB6, 0xB8, 0x8B, 0x3C, 0x72, 0x7E, 0xFB, 0x94,
-    0x38, 0xDE, 0x5E, 0x16, 0x5D, 0x99, 0xAA, 0x5C, 0xE7, 0x5E, 0x6F, 0xDD, 0xF2, 0x1E, 0xD7, 0x01,
-    0xD3, 0x7D, 0x40, 0x5F, 0x90, 0x9E, 0xB7, 0xAA, 0x02, 0x26, 0x74, 0xF8, 0x3C, 0xD9, 0x2E, 0xE6,
-    0x2D, 0x03, 0xB6, 0x22, 0x86, 0x1B, 0xCF, 0xA7, 0x54, 0x7E, 0x37, 0x68, 0x97, 0x6C, 0x34, 0xCC,
-    0xE2, 0x61, 0x47, 0xA6, 0x13, 0xC3, 0x1A, 0x90, 0x4A, 0x3E, 0x94, 0x4A, 0x0F, 0xCF, 0x31, 0xB0,
-    0x9E, 0xEF, 0x1B, 0x4D, 0x8F, 0xBD, 0x0D, 0xC2, 0x30, 0x14, 0x84, 0x2F, 0x76, 0x91, 0x82, 0x82,
-    0x11, 0xCC, 0x06, 0x1E, 0x01, 0x31, 0x07, 0x8B, 0xD0, 0x25, 0xE3, 0x20, 0xB1, 0x02, 0x22, 0xD9,
-    0x84, 0xF4, 0x34, 0x94, 0x2E, 0x12, 0x1F, 0xF7, 0x6C, 0x47, 0xC2, 0xF2, 0xCF, 0xE7, 0xA7, 0xEF,
-    0x9D, 0x6C, 0xE0, 0x6F, 0xDC, 0xDA, 0xD9, 0xE5, 0x06, 0x3D, 0xC7, 0x0A, 0x81, 0x4B, 0x85, 0x81,
-    0xA9, 0x2A, 0x64, 0x6E, 0xCA, 0xA7, 0x4A, 0x61, 0x41, 0x2C, 0xD2, 0x00, 0xF8, 0x54, 0x94, 0x96,
-    0xD4, 0xF3, 0x72, 0x87, 0x49, 0x81, 0xEF, 0x0C, 0x4B, 0x1A, 0x48, 0x42, 0x49, 0x4A, 0x51, 0x8C,
-    0x66, 0x2F, 0x58, 0x75, 0x1B, 0x83, 0x60, 0xF1, 0x5A, 0x67, 0xC1, 0x78, 0x24, 0x53, 0x34, 0x57,
-    0x0D, 0xDF, 0x03, 0xB9, 0x59, 0xC3, 0xEC, 0xE4, 0x7A, 0xAB, 0x62, 0x2A, 0xB0, 0x02, 0x91, 0xF9,
-    0x21, 0x05, 0x90, 0x64, 0x0A, 0xE0, 0x0A, 0xD8, 0x7B, 0xA6, 0xCD, 0x9B, 0x22, 0x29, 0x75, 0xA6,
-    0x48, 0x12, 0xCC, 0x06, 0x6E, 0x75, 0xAC, 0xFF, 0x7A, 0x5D, 0xD7, 0x0A, 0xB1, 0x2A, 0x96, 0x34,
-    0x57, 0xD8, 0x15, 0xE0, 0xB9, 0xC3, 0xC9, 0xB6, 0x1F,
+static const uint8_t notosans_18_regularBitmaps[40590] = {
+    0xDD, 0x5A, 0x3B, 0xAC, 0xDC, 0xC6, 0x15, 0x9D, 0xDD, 0x85, 0x4C, 0xC8, 0x44, 0x42, 0x17, 0x56,
+    0x0C, 0x5B, 0x40, 0x98, 0xC2, 0x45, 0xE0, 0x22, 0x6C, 0x53, 0x89, 0x44, 0x8C, 0x58, 0x45, 0x1A,
+    0x15, 0x5A, 0xB9, 0x50, 0xE1, 0xD6, 0x70, 0x80, 0xA8, 0x49, 0x69, 0x3F, 0xD2, 0x6E, 0x52, 0xB8,
+    0xB0, 0x8A, 0x28, 0x45, 0x9A, 0xA4, 0x48, 0x00, 0xE5, 0xA9, 0x50, 0x1B, 0x24, 0xD6, 0x23, 0x01,
+    0x97, 0x29, 0xCC, 0xC0, 0x85, 0x4B, 0xD3, 0xB0, 0x82, 0xC0, 0x70, 0x21, 0x3A, 0xD9, 0xC0, 0x2B,
+    0x9B, 0xC3, 0xC9, 0x39, 0x67, 0x86, 0xFB, 0x76, 0xF5, 0x79, 0xFA, 0xDA, 0xF9, 0xEC, 0x5B, 0x5E,
+    0x72, 0xC9, 0xE1, 0xCC, 0x9D, 0x7B, 0xEF, 0x9C, 0xFB, 0x99, 0x97, 0x35, 0x79, 0xF8, 0xCB, 0x9A,
+    0xAC, 0xF2, 0x7F, 0x69, 0x95, 0x16, 0xFE, 0x2F, 0xE1, 0x9F, 0x49, 0xCC, 0x31, 0xC3, 0xCF, 0x31,
+    0x93, 0x37, 0x65, 0x9B, 0xB7, 0x79, 0x83, 0xDF, 0x49, 0x65, 0x72, 0x63, 0x0E, 0xCC, 0x6C, 0x30,
+    0x8B, 0xB5, 0x89, 0x7A, 0x13, 0x77, 0x26, 0x69, 0x4D, 0xDA, 0x98, 0xAC, 0x31, 0x39, 0x1E, 0x16,
+    0x7C, 0x5E, 0xDE, 0xE5, 0xCB, 0xA7, 0x85, 0xC9, 0x2A, 0xB6, 0xC7, 0x5B, 0x49, 0xC7, 0x1E, 0x16,
+    0x2B, 0xF6, 0x66, 0x46, 0xC3, 0x37, 0xD3, 0xEA, 0x0D, 0x7F, 0x6E, 0xA6, 0xA7, 0x6B, 0x3D, 0xB5,
+    0x6A, 0x50, 0x6F, 0xF5, 0x82, 0xC1, 0xB2, 0xDB, 0xBE, 0xDB, 0x1C, 0x1C, 0xF0, 0x2D, 0xCF, 0xE7,
+    0x42, 0x7C, 0xA2, 0x4F, 0x3C, 0xDC, 0x33, 0x66, 0x76, 0x26, 0xEE, 0x93, 0x3E, 0x69, 0xD3, 0x26,
+    0x6D, 0xB2, 0x22, 0x37, 0xA7, 0xCC, 0xEB, 0xE6, 0xB5, 0xFD, 0x8B, 0xB5, 0xEB, 0xF0, 0x3D, 0xB1,
+    0x2C, 0x76, 0x66, 0xAC, 0x4F, 0xE6, 0x0A, 0x33, 0x73, 0xAE, 0x37, 0x91, 0xBB, 0x3A, 0x98, 0xA4,
+    0x9F, 0x8D, 0xEC, 0xAD, 0xF4, 0x4C, 0x88, 0x5D, 0x0C, 0x98, 0x34, 0x18, 0x32, 0x69, 0x41, 0xE2,
+    0xCE, 0x4E, 0xA4, 0xBF, 0x1B, 0xE9, 0x0E, 0x02, 0x49, 0x5A, 0xBE, 0xDB, 0xAA, 0x17, 0x4A, 0xA7,
+    0x11, 0x9F, 0x49, 0x6F, 0x9C, 0x59, 0x8C, 0xE7, 0x2D, 0xC7, 0x5D, 0x91, 0x83, 0x8A, 0x8C, 0x83,
+    0x97, 0x19, 0xE4, 0x3E, 0x98, 0x6C, 0x30, 0x6E, 0x88, 0xEC, 0x90, 0x7D, 0x3C, 0x64, 0x6F, 0x0E,
+    0xC7, 0x31, 0xCF, 0x87, 0xFE, 0xEA, 0x73, 0x01, 0xFD, 0x47, 0x1C, 0x29, 0x73, 0x57, 0x47, 0x93,
+    0xB7, 0x18, 0xFD, 0x5B, 0x86, 0xF3, 0x33, 0xD4, 0xAC, 0x14, 0xB2, 0x4D, 0x32, 0x3E, 0x00, 0xB7,
+    0xD2, 0x89, 0x99, 0x61, 0x42, 0x94, 0x33, 0xE6, 0xD1, 0xF3, 0x3E, 0x5B, 0x38, 0xDE, 0x1A, 0xEE,
+    0x75, 0xAB, 0x76, 0x90, 0xEA, 0x21, 0x99, 0x78, 0x69, 0xC9, 0xCB, 0x60, 0x72, 0x77, 0xC5, 0x99,
+    0xEC, 0xA2, 0xA9, 0x9B, 0xE3, 0x81, 0x0D, 0x58, 0xCD, 0x0E, 0x69, 0x36, 0x1D, 0xE1, 0x80, 0xB0,
+    0xF0, 0x4A, 0x4B, 0x72, 0xDD, 0x98, 0x17, 0xAE, 0x72, 0x3C, 0xBC, 0xCB, 0x76, 0x1D, 0x48, 0xC4,
+    0xEE, 0x61, 0x6D, 0x81, 0xE8, 0x67, 0xDC, 0xEB, 0xE9, 0xCF, 0x61, 0x31, 0x4D, 0xF9, 0xE9, 0x79,
+    0x57, 0x94, 0xCE, 0x59, 0x73, 0xD2, 0x39, 0xBC, 0x70, 0xEC, 0x8C, 0xB8, 0x91, 0x0C, 0x7C, 0x37,
+    0x33, 0x47, 0xBA, 0x10, 0x8D, 0x3F, 0x92, 0x30, 0x7E, 0x23, 0x0E, 0x24, 0x93, 0x81, 0x74, 0xBE,
+    0x26, 0x5D, 0xF4, 0xA4, 0x09, 0x55, 0x69, 0xB2, 0x82, 0xB4, 0x94, 0xDC, 0x06, 0xD2, 0xF9, 0x8A,
+    0x34, 0x92, 0x41, 0x62, 0x02, 0xDE, 0x2C, 0x49, 0x21, 0x01, 0x57, 0x6D, 0xD3, 0x49, 0xDA, 0x47,
+    0xD1, 0x84, 0x0C, 0x1F, 0x12, 0xAF, 0xA2, 0x6A, 0x87, 0x64, 0xC5, 0x0E, 0xC9, 0x7F, 0x7C, 0x86,
+    0x22, 0x72, 0x17, 0x49, 0xD6, 0xE6, 0xDB, 0x97, 0x2E, 0x8C, 0xEC, 0xCB, 0x15, 0x93, 0x2C, 0xD3,
+    0x3B, 0x48, 0xDA, 0x6B, 0x9D, 0xA4, 0x2C, 0x7E, 0x0B, 0x41, 0x98, 0xFA, 0xF7, 0x58, 0x09, 0x35,
+    0x75, 0x96, 0x3A, 0xBE, 0x7A, 0xA2, 0x08, 0x6B, 0xC5, 0xCC, 0x6A, 0xF4, 0x97, 0x3A, 0xAE, 0xD7,
+    0x2F, 0xF7, 0xCD, 0x9C, 0x5A, 0x88, 0xD6, 0x93, 0x12, 0xD4, 0x8F, 0x0C, 0x27, 0x67, 0xDB, 0x92,
+    0xE4, 0x60, 0xF6, 0xA7, 0xC2, 0x1C, 0x64, 0x30, 0x3E, 0x5B, 0xE3, 0x35, 0x9C, 0x5D, 0xE1, 0x88,
+    0x28, 0x8E, 0x83, 0x8F, 0x7C, 0x53, 0x2B, 0xE6, 0xDA, 0x66, 0xD9, 0x70, 0xC5, 0x74, 0xE8, 0x25,
+    0x69, 0x33, 0xB6, 0x83, 0x3D, 0xD5, 0x45, 0x34, 0x9E, 0x1F, 0xB9, 0x58, 0xD6, 0x5C, 0x2C, 0x64,
+    0xF9, 0xEC, 0x96, 0x79, 0xAD, 0x44, 0x36, 0x0A, 0xDF, 0xCC, 0x48, 0xCA, 0x15, 0x27, 0x07, 0x24,
+    0xB4, 0xE3, 0xF9, 0x30, 0x59, 0xC8, 0x9D, 0xDA, 0x8A, 0x61, 0xCA, 0x4B, 0x0B, 0x47, 0xD6, 0x1C,
+    0xED, 0xB6, 0xCD, 0x36, 0x6D, 0xEB, 0xA9, 0xED, 0x04, 0x22, 0x17, 0x21, 0x0D, 0xF0, 0x17, 0x8F,
+    0x30, 0xEB, 0xB4, 0x03, 0xCF, 0x44, 0xAD, 0x46, 0xDA, 0xE7, 0x64, 0xFC, 0x95, 0x80, 0x14, 0xB2,
+    0xAA, 0x4D, 0x64, 0xE7, 0x5C, 0xFE, 0x37, 0x7A, 0xAA, 0x0B, 0x1D, 0x96, 0x98, 0xD6, 0xDC, 0x95,
+    0x6B, 0x93, 0xAC, 0x20, 0x55, 0xB4, 0x2B, 0x09, 0x3B, 0xE9, 0x06, 0x71, 0xA2, 0x5E, 0x84, 0x3F,
+    0xFB, 0x5A, 0x12, 0x42, 0x57, 0x4D, 0x7A, 0xF3, 0x9C, 0x2B, 0x22, 0xDA, 0x06, 0xC4, 0x01, 0x15,
+    0xCC, 0xCE, 0x4E, 0x0C, 0x9D, 0x64, 0xA7, 0x64, 0x68, 0xE1, 0xAE, 0x8C, 0x26, 0x5E, 0x81, 0xA1,
+    0xB4, 0x45, 0xBF, 0x19, 0xD1, 0x19, 0xBC, 0x44, 0x7D, 0x4E, 0x53, 0x26, 0x59, 0x79, 0x52, 0x90,
+    0x00, 0x28, 0x56, 0x6C, 0xB2, 0x4A, 0x56, 0xA6, 0x5C, 0x45, 0xEE, 0xCA, 0x17, 0x2B, 0x88, 0xFD,
+    0x03, 0x58, 0xF5, 0xB8, 0xE8, 0xA7, 0x85, 0x15, 0x75, 0xB7, 0xCB, 0x8E, 0xF2, 0x58, 0x58, 0x33,
+    0x5F, 0xD6, 0x2B, 0x0C, 0x89, 0xC9, 0x2C, 0xC8, 0x94, 0x59, 0xE2, 0x78, 0xF2, 0x36, 0xC8, 0xDD,
+    0xFD, 0x6C, 0x43, 0xF2, 0xBC, 0x4A, 0xFA, 0x74, 0x95, 0x02, 0xC2, 0x67, 0xC5, 0x1D, 0xDB, 0x16,
+    0x49, 0x47, 0x70, 0xA7, 0x64, 0x73, 0xE0, 0xFD, 0xBB, 0xE6, 0x8F, 0xBA, 0x3F, 0x87, 0x6D, 0xC1,
+    0xE2, 0xDB, 0x7C, 0x74, 0xFD, 0x0F, 0x64, 0x92, 0xD2, 0xE1, 0x10, 0xF4, 0x3E, 0xF8, 0xDF, 0x84,
+    0x31, 0xE2, 0x13, 0x57, 0x82, 0xF3, 0x1A, 0xE6, 0x4F, 0xBF, 0x92, 0x71, 0x04, 0x7B, 0x39, 0xB1,
+    0x35, 0xE0, 0x71, 0xDA, 0x45, 0xE5, 0x31, 0x82, 0x07, 0xAF, 0x79, 0x8F, 0x4E, 0x67, 0x42, 0x3B,
+    0x93, 0xAE, 0x04, 0x26, 0x82, 0xDB, 0x53, 0xA2, 0xD7, 0xF6, 0x48, 0x87, 0x5C, 0xC6, 0xC4, 0x25,
+    0xB1, 0x58, 0x79, 0xEC, 0x20, 0xAA, 0xC5, 0x1D, 0x5F, 0x4E, 0xDA, 0x48, 0x63, 0xD3, 0x1C, 0xB3,
+    0x6A, 0xBE, 0xE6, 0xD8, 0x64, 0xB2, 0x5E, 0x2E, 0x2D, 0x55, 0xE7, 0x1C, 0x2D, 0x1E, 0x74, 0x3E,
+    0xEE, 0xEF, 0xD7, 0x15, 0x9B, 0xA5, 0x0D, 0x5F, 0x49, 0x5A, 0xAE, 0xB6, 0x58, 0x30, 0x14, 0xF5,
+    0x34, 0xC9, 0xC5, 0x9A, 0x43, 0xCC, 0x07, 0x19, 0xB0, 0x95, 0x55, 0x8E, 0xA5, 0xFB, 0xB2, 0x30,
+    0x42, 0x3C, 0x10, 0x07, 0x63, 0x9A, 0xD5, 0x5A, 0x5A, 0x7D, 0x49, 0xAB, 0x2E, 0xC9, 0xD1, 0x0E,
+    0x89, 0x7B, 0xD9, 0x5B, 0xB9, 0x3C, 0x27, 0xA0, 0x5C, 0x85, 0x77, 0xF1, 0xB3, 0x9D, 0x5E, 0x5B,
+    0x70, 0x00, 0x8D, 0x32, 0xB3, 0x3B, 0x44, 0x0F, 0x22, 0x92, 0xAC, 0xE7, 0x68, 0x2D, 0x09, 0x7B,
+    0xB9, 0xBE, 0x91, 0xE3, 0x05, 0x5E, 0xC7, 0xBC, 0x2D, 0x2C, 0xC4, 0xD4, 0x5A, 0xF3, 0x33, 0x38,
+    0x41, 0x89, 0x72, 0x6D, 0x26, 0x08, 0xF1, 0x2B, 0x2C, 0xE0, 0x72, 0x59, 0x6C, 0x60, 0xC4, 0xAF,
+    0xB7, 0x7B, 0x50, 0xDF, 0xDE, 0xBF, 0x2B, 0xB0, 0x33, 0x59, 0x7B, 0xA8, 0xA4, 0xC8, 0x7A, 0x43,
+    0xA9, 0x18, 0xFB, 0xD4, 0xE3, 0x15, 0xCB, 0x55, 0x4B, 0x23, 0xD5, 0xBA, 0x85, 0x69, 0x9D, 0xE5,
+    0x2A, 0x84, 0xD0, 0xFC, 0xCC, 0x25, 0xB6, 0x16, 0xA3, 0x1F, 0x83, 0x45, 0x53, 0x3E, 0x96, 0x14,
+    0xE0, 0x58, 0xCA, 0x22, 0x4A, 0xF1, 0x4A, 0x9A, 0x52, 0x3E, 0xE0, 0xBE, 0x34, 0x41, 0x88, 0x81,
+    0x46, 0x5B, 0x34, 0xBE, 0x8D, 0xFA, 0xF6, 0xFE, 0xDD, 0xBC, 0xD9, 0xF4, 0xE9, 0xFB, 0xD7, 0x58,
+    0xB3, 0x7A, 0x35, 0xF1, 0xE0, 0x08, 0xB8, 0xA5, 0x1B, 0x2F, 0x7A, 0xDE, 0xF8, 0x5B, 0x47, 0x90,
+    0xCE, 0x5D, 0x8F, 0xE5, 0xF2, 0x2C, 0xDA, 0x0D, 0x3A, 0x78, 0x7D, 0xAF, 0xF6, 0x46, 0xFD, 0x8F,
+    0x5B, 0xC7, 0xFD, 0x8F, 0x75, 0xEB, 0x78, 0xFB, 0xFB, 0x97, 0xEF, 0xEB, 0x9D, 0x8D, 0x86, 0x27,
+    0x3B, 0xB9, 0x69, 0x18, 0x20, 0xC0, 0xF7, 0x40, 0x3B, 0xC0, 0x34, 0xD8, 0x4D, 0xD4, 0x2C, 0xDC,
+    0x96, 0x9D, 0xF4, 0x0F, 0x60, 0x27, 0x99, 0x5B, 0xDF, 0x42, 0xB1, 0x58, 0xD8, 0x1E, 0x4B, 0xA6,
+    0x12, 0xD5, 0xF2, 0x01, 0x34, 0x82, 0x02, 0xF3, 0x40, 0x69, 0x27, 0x8B, 0x35, 0xED, 0x04, 0x70,
+    0x51, 0x8F, 0xFB, 0xF5, 0x9A, 0x5E, 0x10, 0x26, 0x32, 0xAB, 0xE9, 0x57, 0xCD, 0x6C, 0xE9, 0xC7,
+    0x4A, 0xBC, 0xF6, 0x1F, 0x96, 0x2E, 0x97, 0xCB, 0x0B, 0x0D, 0xF5, 0xEB, 0x26, 0xBA, 0xBF, 0xBF,
+    0x7F, 0xF5, 0xD1, 0xFA, 0xDC, 0xA6, 0xF4, 0x8D, 0xFD, 0x49, 0x77, 0xF1, 0x51, 0xA2, 0x47, 0x7C,
+    0x9F, 0x18, 0x0B, 0xDF, 0x15, 0x51, 0x1F, 0x8E, 0xF0, 0x31, 0x7F, 0x95, 0x61, 0xE4, 0x0D, 0xE2,
+    0x21, 0x98, 0x78, 0x7D, 0x3D, 0xE8, 0x71, 0xA6, 0xB5, 0x06, 0x14, 0x57, 0x2C, 0xA0, 0xBC, 0x80,
+    0x11, 0x39, 0x31, 0xBB, 0x14, 0x6A, 0x97, 0xF2, 0xC9, 0xA5, 0xAC, 0xA0, 0x84, 0x6B, 0x03, 0x55,
+    0x9C, 0x5A, 0xCA, 0x5F, 0x97, 0x29, 0xA1, 0xA4, 0xCC, 0x45, 0x15, 0x19, 0x94, 0x5F, 0x11, 0x95,
+    0xCB, 0xBF, 0x3A, 0xF5, 0x5F, 0xD3, 0xDF, 0x32, 0x0E, 0x06, 0x4D, 0xD4, 0x0F, 0x1D, 0x46, 0x69,
+    0xE6, 0xD6, 0x6C, 0x46, 0x09, 0x23, 0xA6, 0x1A, 0x3D, 0x16, 0x02, 0x60, 0xE0, 0x52, 0x91, 0xEE,
+    0x83, 0xD8, 0xF5, 0x43, 0x1D, 0xDB, 0x6B, 0x90, 0x93, 0x88, 0x6D, 0xA9, 0x10, 0xC4, 0x96, 0x9C,
+    0x4C, 0x6A, 0x4B, 0xCE, 0x26, 0xB7, 0x7B, 0xE1, 0xC4, 0xF0, 0xE6, 0x9A, 0xDD, 0xE3, 0xAB, 0x83,
+    0xDD, 0x83, 0x2B, 0x98, 0xAD, 0xED, 0x1E, 0xC2, 0x8F, 0xC5, 0xCA, 0xEE, 0xC1, 0xDF, 0x2C, 0x7A,
+    0x9C, 0x5A, 0x86, 0x11, 0x25, 0xDC, 0x47, 0xD2, 0xD8, 0x72, 0xC1, 0x28, 0xD5, 0x96, 0xF0, 0x39,
+    0x59, 0x01, 0xFC, 0x46, 0x30, 0x6E, 0x70, 0xB2, 0xF0, 0xA7, 0x38, 0xF1, 0x37, 0x4E, 0xB9, 0x3F,
+    0x65, 0x6F, 0xAD, 0x78, 0x4A, 0xDF, 0xEB, 0x79, 0x4A, 0x3E, 0xEC, 0x78, 0x8A, 0x3F, 0x6B, 0x79,
+    0x62, 0xB0, 0xAC, 0x53, 0xC5, 0x13, 0xA0, 0x8B, 0x27, 0x13, 0x4E, 0xD7, 0x78, 0xE2, 0x12, 0xEB,
+    0xCA, 0x56, 0x30, 0xD8, 0x8B, 0xAE, 0x45, 0x15, 0xCB, 0xEC, 0x39, 0x51, 0x34, 0x02, 0x85, 0x26,
+    0x41, 0xA1, 0x0D, 0xD0, 0x88, 0xD9, 0xE7, 0x1E, 0x62, 0x35, 0x50, 0x74, 0x47, 0x08, 0x2D, 0x0B,
+    0xD2, 0xBC, 0x21, 0x4D, 0x3A, 0xD2, 0x68, 0x45, 0xBA, 0x18, 0x04, 0xB0, 0x08, 0x4E, 0x40, 0xEB,
+    0x17, 0x49, 0xF3, 0xF7, 0xE4, 0xC9, 0x3E, 0x21, 0x8D, 0xBF, 0x90, 0xDF, 0x72, 0xBD, 0xA0, 0x55,
+    0xC0, 0x5B, 0x8B, 0xE6, 0xA2, 0x69, 0x7F, 0x18, 0xD7, 0x72, 0x69, 0x73, 0xA1, 0xDB, 0x90, 0xB9,
+    0x54, 0x72, 0x15, 0xE0, 0x1A, 0x09, 0x19, 0x91, 0x87, 0x86, 0x02, 0x0B, 0x20, 0x52, 0x20, 0xEE,
+    0x0B, 0x79, 0x89, 0x0F, 0x1B, 0x0B, 0x01, 0x50, 0x5E, 0xD5, 0xDE, 0xF1, 0xD4, 0x1E, 0x9F, 0xEE,
+    0x79, 0xF2, 0xB0, 0x8F, 0xF7, 0x7C, 0xC8, 0x5C, 0x84, 0x3E, 0x33, 0x3F, 0x02, 0xC7, 0x83, 0x41,
+    0x86, 0xD1, 0xE7, 0xF0, 0x9B, 0x94, 0x20, 0xFC, 0x16, 0x33, 0x94, 0x54, 0x1E, 0x81, 0xF1, 0x81,
+    0x9C, 0xA6, 0xC2, 0xBE, 0xD2, 0x7D, 0x2A, 0xD3, 0x59, 0x79, 0x7F, 0x51, 0x9A, 0x67, 0xE0, 0x82,
+    0xCD, 0x14, 0x47, 0x96, 0xC1, 0xE5, 0xC8, 0x91, 0xCB, 0x05, 0xF9, 0x9F, 0x7C, 0x20, 0x3F, 0x56,
+    0x57, 0xE5, 0xF2, 0xA7, 0x8E, 0xEF, 0xAE, 0x49, 0xE0, 0x75, 0xF6, 0x7F, 0x19, 0x40, 0xF5, 0x81,
+    0xC8, 0xFF, 0x89, 0x44, 0x5F, 0xF1, 0xA6, 0x11, 0x0D, 0x21, 0xBC, 0xF4, 0x93, 0x52, 0xA6, 0x48,
+    0xEB, 0xD1, 0x29, 0x59, 0x9B, 0x20, 0x7D, 0xC8, 0xBE, 0xD8, 0xC8, 0x9E, 0x00, 0xF1, 0x84, 0xAB,
+    0xCA, 0xC0, 0x8F, 0x97, 0x73, 0x37, 0x89, 0x3D, 0xEE, 0x76, 0x64, 0xCF, 0x26, 0xB3, 0x90, 0x9A,
+    0x96, 0x1C, 0xBC, 0xA4, 0xA0, 0x4A, 0x4A, 0x45, 0x20, 0x57, 0xD2, 0x0B, 0x95, 0x4C, 0x5C, 0xCA,
+    0x00, 0x3D, 0x65, 0xB1, 0xD3, 0x73, 0xBC, 0x89, 0xCC, 0x84, 0x80, 0x0A, 0xFD, 0x6F, 0x2A, 0x7E,
+    0x6C, 0xE8, 0x46, 0x1B, 0x30, 0x79, 0xB2, 0x48, 0x37, 0xC9, 0x8B, 0x92, 0xFB, 0xEC, 0x30, 0xF5,
+    0x57, 0x28, 0xAF, 0x74, 0x47, 0xEA, 0x92, 0x10, 0x52, 0xA5, 0x12, 0xD2, 0x5B, 0xAC, 0xCC, 0x51,
+    0xD3, 0x56, 0x1F, 0x0A, 0xD2, 0xE2, 0xAD, 0xEC, 0x5A, 0x0F, 0x7E, 0x48, 0x33, 0xCB, 0xBF, 0x44,
+    0xE6, 0x93, 0x33, 0xB5, 0x3F, 0x49, 0xF3, 0x51, 0x8A, 0x2D, 0xCF, 0x56, 0xD4, 0x5B, 0x74, 0xD7,
+    0x5B, 0xFF, 0xE7, 0xE9, 0x81, 0x12, 0xC2, 0x5A, 0x13, 0xA2, 0xD5, 0x20, 0xB1, 0xAA, 0xA8, 0x1A,
+    0xE5, 0x04, 0x0D, 0x93, 0x1C, 0x25, 0x6C, 0x02, 0x20, 0xDA, 0x12, 0xC3, 0xF0, 0x91, 0xEA, 0xF0,
+    0xEE, 0x71, 0xAE, 0xFA, 0x15, 0x6F, 0xD6, 0xCA, 0x8D, 0xBC, 0x63, 0xC2, 0x2B, 0xAD, 0xF1, 0xD5,
+    0x1E, 0x66, 0x7E, 0x55, 0xC8, 0x68, 0x43, 0x30, 0xB8, 0x58, 0x8D, 0x0A, 0x43, 0xAC, 0xAA, 0x2B,
+    0x32, 0xB0, 0x51, 0x96, 0x54, 0xCB, 0xAC, 0x04, 0xF5, 0xF2, 0x4E, 0x26, 0xF8, 0x37, 0x9F, 0xBB,
+    0x90, 0xBD, 0x85, 0x80, 0x13, 0x1D, 0x32, 0x70, 0x8E, 0x19, 0xFB, 0x47, 0xCC, 0xA3, 0x3B, 0x0C,
+    0x44, 0x4D, 0x21, 0x33, 0x68, 0x4D, 0xF2, 0x11, 0x6B, 0x70, 0xE0, 0x39, 0x7D, 0x1F, 0xF9, 0x73,
+    0x05, 0x7E, 0xB2, 0x77, 0x58, 0x86, 0x00, 0x7B, 0xF9, 0x4F, 0x3A, 0xE0, 0x3A, 0xB8, 0xCD, 0xA3,
+    0x60, 0x59, 0x7B, 0xC8, 0xEA, 0x0E, 0x38, 0x8B, 0x6B, 0xB8, 0xAB, 0x92, 0xDA, 0x30, 0x1B, 0x54,
+    0x94, 0xE3, 0x25, 0x67, 0x37, 0xC2, 0x4B, 0x58, 0x26, 0x4E, 0x35, 0x5A, 0x1C, 0x70, 0xA6, 0x39,
+    0xDE, 0xA1, 0x27, 0x31, 0xF9, 0x69, 0x74, 0xC7, 0xF9, 0x66, 0x6F, 0x23, 0xB5, 0x7C, 0x07, 0x52,
+    0xE2, 0x90, 0xE9, 0xFB, 0x60, 0x3D, 0xC1, 0x05, 0x0F, 0x93, 0xDC, 0xA8, 0x74, 0x88, 0xBF, 0x88,
+    0xFA, 0x27, 0xC7, 0x8A, 0xE7, 0x38, 0x07, 0x7F, 0xC1, 0x20, 0x7C, 0x0C, 0xE9, 0x39, 0xAD, 0x98,
+    0xF6, 0x99, 0x56, 0x34, 0x38, 0x15, 0xCB, 0x20, 0x70, 0x5F, 0x2A, 0xC4, 0x73, 0x32, 0xE0, 0xBC,
+    0x90, 0x0B, 0xAF, 0x23, 0xAF, 0xB5, 0x5A, 0xC9, 0xFA, 0xA0, 0xB5, 0x2A, 0x61, 0xFA, 0x82, 0x53,
+    0xA9, 0x05, 0x5B, 0xB6, 0x9B, 0x3B, 0xFE, 0xE9, 0xE2, 0x73, 0x95, 0xAA, 0x3A, 0x67, 0x42, 0x65,
+    0x0E, 0xBD, 0x51, 0xD6, 0x07, 0xB4, 0x68, 0x0C, 0x84, 0x30, 0x02, 0x23, 0x62, 0xB8, 0x58, 0xA3,
+    0x93, 0x13, 0x0F, 0x4D, 0x1E, 0x8B, 0x52, 0x56, 0x2A, 0xC0, 0x21, 0x4D, 0x19, 0x60, 0xC3, 0xD4,
+    0x50, 0xF9, 0xB0, 0x65, 0x7B, 0xCF, 0x24, 0xBE, 0x77, 0x7A, 0xBD, 0xF2, 0xD1, 0x19, 0x27, 0x9B,
+    0x7C, 0xAC, 0x02, 0xC3, 0x3F, 0xC5, 0x8F, 0x78, 0x9B, 0x39, 0xCF, 0xA7, 0x0F, 0x6D, 0x8B, 0x47,
+    0xA3, 0xCC, 0xB2, 0x56, 0x24, 0x6B, 0x91, 0x29, 0x70, 0xD6, 0x2A, 0xDE, 0x54, 0xD5, 0x7C, 0x71,
+    0x6F, 0x98, 0x96, 0xF3, 0xD1, 0x0F, 0xBB, 0x9D, 0x87, 0xE3, 0xDD, 0x1E, 0x62, 0xB4, 0xE1, 0x90,
+    0xF8, 0x12, 0x00, 0xA3, 0xB0, 0x05, 0x11, 0x76, 0x7E, 0xF3, 0x25, 0xC8, 0xBC, 0xBA, 0xB5, 0xF8,
+    0x98, 0x84, 0xAB, 0xE7, 0x00, 0x58, 0x4C, 0x7A, 0x9B, 0x78, 0xBC, 0x84, 0x24, 0x9F, 0x65, 0xB4,
+    0xBC, 0xF2, 0x1A, 0x52, 0x60, 0x2B, 0x6D, 0xB3, 0xB4, 0x3D, 0x73, 0x4D, 0xF6, 0xAF, 0x57, 0x6E,
+    0x34, 0x89, 0x73, 0x6F, 0x37, 0x73, 0x67, 0xE3, 0xC6, 0x1C, 0xC3, 0xA4, 0x5F, 0x9D, 0x0A, 0x3D,
+    0xF7, 0x24, 0xE0, 0xCA, 0x12, 0xE7, 0x6C, 0x0D, 0x1E, 0x9D, 0x7D, 0xD9, 0x19, 0xBA, 0xBC, 0xCA,
+    0x15, 0x53, 0x69, 0x4A, 0xEB, 0x4A, 0xAB, 0x6C, 0xDC, 0x54, 0x5F, 0x44, 0xC6, 0x40, 0xE2, 0xDE,
+    0x05, 0x13, 0x42, 0x63, 0xD6, 0x7A, 0xD0, 0x41, 0x5D, 0x8D, 0xE3, 0x79, 0x67, 0x06, 0x76, 0xBA,
+    0x16, 0x8C, 0xB2, 0x52, 0xE5, 0x53, 0x06, 0xB7, 0x42, 0xA2, 0xB9, 0x8A, 0xC7, 0x73, 0x3D, 0x85,
+    0x45, 0x59, 0xD1, 0x7C, 0xEA, 0x50, 0x46, 0x1A, 0x03, 0x6B, 0x76, 0xEB, 0x77, 0x1D, 0x72, 0x1B,
+    0xB6, 0x45, 0xA8, 0xF2, 0x54, 0x3C, 0xFE, 0x5A, 0x7D, 0x20, 0x49, 0xEA, 0x7C, 0xC7, 0x66, 0x7E,
+    0x71, 0x53, 0x94, 0x39, 0x82, 0x1C, 0x3B, 0x03, 0x52, 0xBB, 0xD3, 0x3D, 0x74, 0xF0, 0xF7, 0x3E,
+    0xB1, 0xE7, 0x5C, 0x0F, 0xD9, 0x96, 0x04, 0x92, 0x4C, 0xA1, 0x80, 0x4A, 0x4A, 0xFD, 0xD1, 0xB3,
+    0xAD, 0xA7, 0xB8, 0x81, 0xAF, 0xA5, 0xBE, 0x83, 0x64, 0x3C, 0xFF, 0x15, 0x3B, 0xFD, 0x00, 0x88,
+    0xE0, 0x5E, 0xEC, 0x43, 0x11, 0xDB, 0x47, 0x23, 0xAC, 0x67, 0x81, 0xD7, 0xD8, 0x3E, 0x63, 0x69,
+    0x58, 0x5A, 0x00, 0xB2, 0x7F, 0x39, 0xEB, 0x94, 0x05, 0xF5, 0xB4, 0x51, 0xE6, 0xE3, 0x09, 0xD2,
+    0x9F, 0x6A, 0xDC, 0x54, 0xD5, 0xEA, 0x4D, 0x62, 0xE7, 0xCB, 0x96, 0xE8, 0xBB, 0x88, 0xDC, 0xAF,
+    0xEA, 0x62, 0x26, 0x2F, 0x92, 0xD1, 0xC7, 0xC9, 0xB4, 0xCC, 0x6B, 0x17, 0x81, 0x2D, 0xAC, 0x6D,
+    0x03, 0xDF, 0x9A, 0x33, 0x7A, 0xF1, 0x60, 0x4B, 0x98, 0x96, 0x0E, 0x51, 0x0E, 0xB6, 0x38, 0x31,
+    0x2E, 0x77, 0xEE, 0x3F, 0xF4, 0xA1, 0xEA, 0x71, 0x8D, 0x09, 0x63, 0xEA, 0x9F, 0x40, 0x9E, 0x2F,
+    0x7F, 0x45, 0x9D, 0xDE, 0x22, 0xCF, 0xF8, 0x48, 0x79, 0x46, 0xB7, 0xCA, 0x53, 0x1D, 0xA0, 0x2B,
+    0xE7, 0x95, 0x04, 0x01, 0x9E, 0xA6, 0x3C, 0x0F, 0xF5, 0x18, 0x77, 0x87, 0x55, 0xC8, 0xEF, 0x16,
+    0x30, 0xB5, 0xD4, 0xD5, 0x8E, 0x71, 0x8B, 0x32, 0xD3, 0xEA, 0x81, 0x6D, 0x5F, 0x15, 0x59, 0x6B,
+    0xC6, 0xF1, 0xDC, 0x64, 0xFB, 0x95, 0xB7, 0xFD, 0x54, 0x0B, 0x80, 0x18, 0x15, 0x88, 0x7D, 0x38,
+    0xF2, 0xA4, 0xB0, 0x31, 0xAF, 0x8E, 0x87, 0x88, 0x10, 0xF1, 0xD8, 0x7D, 0xFD, 0x99, 0x79, 0x45,
+    0x18, 0x06, 0x5C, 0x81, 0xCE, 0xB7, 0xCA, 0x80, 0x74, 0x6E, 0x8F, 0xE9, 0x0B, 0x20, 0x61, 0x21,
+    0xDE, 0x64, 0xEB, 0x07, 0x90, 0x9B, 0x08, 0x80, 0xCF, 0x32, 0x5F, 0xB4, 0xE4, 0xCE, 0xD2, 0xA8,
+    0x2D, 0x2D, 0xD6, 0x12, 0x0B, 0x2D, 0x21, 0xD6, 0xD2, 0x60, 0xAD, 0xD6, 0xB5, 0xAF, 0xC1, 0x42,
+    0x6F, 0xEE, 0x6D, 0x86, 0x0D, 0x6A, 0xA2, 0xFC, 0x88, 0x65, 0x44, 0xCB, 0xB8, 0xD4, 0x72, 0x9A,
+    0x96, 0x40, 0x1A, 0x7A, 0x46, 0x32, 0xFB, 0xAA, 0x3D, 0xE2, 0x23, 0xA3, 0x5F, 0x72, 0x43, 0xC2,
+    0x75, 0x34, 0x7B, 0x40, 0x0D, 0x00, 0x7E, 0x34, 0xE3, 0xCD, 0xF3, 0x36, 0x68, 0x12, 0x0B, 0x41,
+    0x40, 0x56, 0x86, 0x32, 0xBB, 0x10, 0xD4, 0x19, 0xBF, 0x13, 0x31, 0xEA, 0x2C, 0xC5, 0xE6, 0x41,
+    0x53, 0x5F, 0xCB, 0x79, 0x62, 0x52, 0x1C, 0x42, 0x42, 0xF6, 0xEB, 0xB2, 0x32, 0x81, 0x2B, 0x56,
+    0x4B, 0x47, 0xB8, 0x81, 0x03, 0x86, 0x10, 0x0A, 0xAC, 0x25, 0x3A, 0x89, 0x29, 0x40, 0xAE, 0x43,
+    0xCC, 0xE5, 0xC9, 0xDA, 0x6E, 0x88, 0x7E, 0x1E, 0x4C, 0x55, 0x50, 0x06, 0x58, 0x8A, 0xA9, 0x92,
+    0x2E, 0x61, 0x07, 0x11, 0xE5, 0x39, 0x53, 0xFE, 0x92, 0x6D, 0xA0, 0x7C, 0x92, 0xBD, 0xC7, 0xF8,
+    0xF1, 0xD0, 0x71, 0x54, 0x47, 0x39, 0x8E, 0x43, 0x14, 0xDD, 0x71, 0x1C, 0x29, 0x1D, 0x47, 0xDE,
+    0xA0, 0xB7, 0xBA, 0x72, 0x74, 0x1C, 0xF2, 0x46, 0xDE, 0x2F, 0x71, 0xB4, 0xFB, 0xB5, 0xCA, 0x3B,
+    0x01, 0xD2, 0xE3, 0x05, 0xF8, 0x0F, 0xEF, 0x00, 0x48, 0xF7, 0x26, 0xCB, 0x21, 0x76, 0x43, 0x3E,
+    0x0E, 0xEE, 0x0F, 0xDC, 0xF7, 0x69, 0xB8, 0x0D, 0xE5, 0x84, 0xEF, 0xA3, 0x18, 0x3F, 0xFA, 0xCB,
+    0x82, 0x2C, 0xA4, 0x7F, 0x3D, 0x06, 0xC2, 0x65, 0x7F, 0xFB, 0x0E, 0xB5, 0xF3, 0x54, 0x1E, 0x2A,
+    0xF4, 0xF2, 0x88, 0x2C, 0x25, 0x30, 0x62, 0xE2, 0x96, 0x54, 0xCC, 0x0B, 0x56, 0x47, 0xA2, 0x50,
+    0xEA, 0xF7, 0x65, 0xFF, 0xEF, 0x21, 0x08, 0xCB, 0x2F, 0xBD, 0xC2, 0x38, 0xA8, 0x3B, 0xC9, 0xDC,
+    0x86, 0x3B, 0x59, 0xDF, 0xC7, 0x93, 0x77, 0xC3, 0xE6, 0xC0, 0xE0, 0x83, 0xCE, 0x0C, 0x49, 0x17,
+    0x13, 0xAF, 0x67, 0xEC, 0xB2, 0x98, 0x87, 0x7B, 0xF7, 0x7B, 0xCC, 0x42, 0xD0, 0x6A, 0xDC, 0x25,
+    0xE6, 0x80, 0x10, 0x1D, 0x97, 0xFD, 0xD9, 0x09, 0xF3, 0x18, 0xAF, 0x3F, 0x1A, 0x51, 0x62, 0x02,
+    0xA5, 0x34, 0x54, 0x4A, 0x2B, 0x2F, 0x01, 0xA5, 0x44, 0xD4, 0xB4, 0x74, 0xEE, 0xBD, 0x6E, 0xF0,
+    0x9C, 0x2A, 0xCF, 0x6B, 0x37, 0x27, 0xF2, 0xA6, 0xAC, 0xED, 0x78, 0x66, 0x03, 0x0D, 0x02, 0xB5,
+    0x9C, 0xDB, 0x08, 0xB9, 0x0A, 0x9B, 0xE4, 0xDB, 0xFA, 0x38, 0xDF, 0x1C, 0x68, 0xF7, 0x41, 0xB1,
+    0xFD, 0x69, 0xEE, 0x49, 0xBC, 0xDD, 0xF9, 0x08, 0xDE, 0xC4, 0x8C, 0xDC, 0x15, 0xB5, 0x2B, 0x50,
+    0x9F, 0x1F, 0x6E, 0x78, 0x85, 0x12, 0x99, 0x42, 0xB3, 0x9A, 0x79, 0x06, 0x6C, 0x06, 0x3A, 0x50,
+    0x18, 0xCD, 0x2C, 0x16, 0x4F, 0x66, 0x5F, 0xF4, 0x8A, 0x8B, 0x17, 0xFF, 0x58, 0x09, 0x2D, 0x17,
+    0x9F, 0xAF, 0x0D, 0x43, 0xE2, 0xA8, 0x63, 0x86, 0xB1, 0xE8, 0xE3, 0x76, 0xC0, 0xB8, 0x8B, 0x55,
+    0xD2, 0x30, 0xAD, 0x98, 0xAF, 0x11, 0x4F, 0x23, 0xB3, 0x98, 0x0D, 0x59, 0xC1, 0xF4, 0x84, 0x9B,
+    0x27, 0x19, 0xF2, 0x15, 0x63, 0x4F, 0x99, 0xF4, 0x1D, 0x68, 0xF7, 0xE0, 0x0D, 0xCF, 0x53, 0xF9,
+    0xAE, 0x52, 0x1C, 0x6E, 0xB7, 0x88, 0xB3, 0x7C, 0xE5, 0x99, 0x43, 0x88, 0xA0, 0x33, 0x00, 0x75,
+    0xC3, 0x27, 0x13, 0xA4, 0x95, 0x1C, 0x09, 0xA6, 0x9C, 0x35, 0x18, 0x16, 0x21, 0x45, 0xAD, 0xFF,
+    0x47, 0x78, 0x0B, 0xF3, 0x4E, 0x61, 0xD6, 0xDE, 0x74, 0x16, 0xDA, 0x82, 0xD7, 0x1C, 0x7D, 0x8E,
+    0xC2, 0xD4, 0xE5, 0x33, 0xA6, 0x36, 0xEF, 0xAD, 0x43, 0x71, 0xD1, 0x32, 0xFB, 0x1B, 0x20, 0x42,
+    0xC8, 0x31, 0x6D, 0x11, 0xD1, 0xC4, 0x4A, 0xC4, 0x86, 0xA9, 0xD4, 0xEC, 0x25, 0xCF, 0xB2, 0xB2,
+    0x24, 0x1F, 0xF7, 0xF2, 0x34, 0xFA, 0xDF, 0x84, 0x68, 0x92, 0x3C, 0x8D, 0xAB, 0xA6, 0xD5, 0x8D,
+    0x0C, 0x52, 0x58, 0xC8, 0x94, 0xE4, 0x5F, 0xE4, 0x16, 0xD0, 0x2F, 0xB8, 0xB5, 0xF3, 0x97, 0x2E,
+    0xEC, 0x3E, 0x47, 0x37, 0x58, 0x98, 0x26, 0x2F, 0xE2, 0xCA, 0x07, 0x45, 0x76, 0xB3, 0x37, 0xB9,
+    0x9E, 0x96, 0x99, 0x32, 0x70, 0x06, 0xD2, 0x7F, 0x66, 0xDB, 0x5A, 0x45, 0xD0, 0x6E, 0x72, 0xB8,
+    0x88, 0xBF, 0x79, 0x9C, 0x58, 0xBE, 0x3C, 0xF8, 0xE6, 0x3E, 0x9F, 0x15, 0xBB, 0x33, 0xEB, 0xBB,
+    0x89, 0xC3, 0x06, 0x18, 0x73, 0x86, 0x31, 0xA4, 0x9A, 0x2B, 0xDF, 0xAF, 0xB2, 0xCF, 0xFD, 0xFD,
+    0xCB, 0xB5, 0x0F, 0xE6, 0x69, 0xEF, 0x97, 0x8D, 0xAA, 0xA1, 0x53, 0xAA, 0x50, 0x85, 0x60, 0x6B,
+    0xA6, 0x0D, 0xB0, 0xC3, 0x5D, 0xE2, 0x6F, 0x12, 0x92, 0x5F, 0x43, 0xE0, 0xA8, 0xAC, 0x43, 0x15,
+    0x86, 0xE2, 0xC4, 0x72, 0xB9, 0xD4, 0x3D, 0x7E, 0x2E, 0xAB, 0xE8, 0x30, 0x25, 0x23, 0xBA, 0xE0,
+    0x73, 0x7E, 0xCE, 0xEA, 0xFF, 0x44, 0x3A, 0xEE, 0xE3, 0xF3, 0xDF, 0x3C, 0x4E, 0x99, 0x37, 0xCC,
+    0xD3, 0x66, 0xD6, 0x47, 0xD5, 0xA2, 0x4F, 0xAA, 0xA8, 0x4B, 0x8B, 0xB8, 0x45, 0xF2, 0xD9, 0xE4,
+    0x10, 0x0E, 0x43, 0xD7, 0xD1, 0xE4, 0x6F, 0xC2, 0x6D, 0xFF, 0xC8, 0x9A, 0x13, 0x18, 0x14, 0x3C,
+    0x55, 0x5C, 0x91, 0x4C, 0xEB, 0x99, 0x98, 0xB0, 0x4D, 0x56, 0x58, 0x15, 0x4D, 0x4F, 0x99, 0xB5,
+    0x79, 0x7D, 0xD6, 0x9B, 0xA7, 0xB1, 0x2C, 0x8F, 0x19, 0x73, 0xC6, 0x3C, 0x0B, 0xC6, 0x59, 0x3B,
+    0xAE, 0xCA, 0x16, 0xE8, 0x54, 0x37, 0x79, 0x38, 0xF9, 0x9B, 0xA1, 0x89, 0xE2, 0xD8, 0xE7, 0x7E,
+    0xC7, 0x50, 0x16, 0xE9, 0x0C, 0xA3, 0xD9, 0x98, 0xFF, 0x24, 0xD1, 0x9C, 0x49, 0xBA, 0xA7, 0xB5,
+    0x91, 0xA1, 0xEC, 0x54, 0x12, 0xB7, 0x5E, 0x59, 0x3B, 0x27, 0x84, 0xB8, 0x2F, 0xF9, 0x7D, 0xB7,
+    0x0B, 0x38, 0x21, 0xD0, 0x3D, 0x56, 0x02, 0x8D, 0xEE, 0xD4, 0xF2, 0x1B, 0x38, 0x71, 0x2A, 0x9C,
+    0xC8, 0xF3, 0x9C, 0x86, 0xE5, 0x24, 0x46, 0x4E, 0xC1, 0x72, 0x02, 0xCF, 0xDF, 0xE2, 0xBB, 0x18,
+    0x9B, 0x73, 0x93, 0xA9, 0xB0, 0x8C, 0xCE, 0xAD, 0xC7, 0xFE, 0xC7, 0x4D, 0xC0, 0xD0, 0xAB, 0x64,
+    0xC8, 0x6E, 0x18, 0xB2, 0x1B, 0x86, 0x6E, 0x6D, 0xFC, 0x4D, 0x31, 0x44, 0x65, 0x9B, 0xA0, 0xEE,
+    0x67, 0x4D, 0x50, 0xB8, 0xB2, 0x5B, 0xAA, 0x1C, 0xF1, 0xA1, 0x57, 0x3A, 0xEE, 0x78, 0xB5, 0x1F,
+    0x3F, 0x14, 0xEF, 0xED, 0x17, 0x41, 0xFD, 0x79, 0x11, 0x0C, 0x20, 0x2F, 0x82, 0x09, 0xE4, 0x93,
+    0x11, 0xFC, 0x17, 0x5E, 0x78, 0x21, 0xBC, 0x30, 0x09, 0x81, 0xFF, 0x1F, 0xB5, 0x2B, 0x04, 0xBA,
+    0x96, 0x5D, 0x21, 0x1C, 0xD9, 0xE1, 0xFF, 0xA2, 0x10, 0xFE, 0x0D, 0xBD, 0x55, 0xBF, 0x8F, 0xDC,
+    0x44, 0x14, 0x7E, 0xB6, 0x49, 0x5C, 0xB8, 0x70, 0x0A, 0xB6, 0x81, 0xC2, 0xB4, 0x04, 0x89, 0x69,
+    0x69, 0xD6, 0x63, 0xD1, 0x52, 0x90, 0x22, 0x5B, 0x51, 0xA4, 0x4F, 0x8A, 0xB4, 0x14, 0xDC, 0xCD,
+    0x8A, 0x86, 0x36, 0x0D, 0xFF, 0x01, 0x42, 0x61, 0xD3, 0xD2, 0x20, 0x2D, 0x67, 0xF3, 0x17, 0x60,
+    0x45, 0x4A, 0x5A, 0x8C, 0x44, 0x43, 0x1A, 0x56, 0xC8, 0x42, 0xBE, 0x3B, 0xAF, 0x87, 0xEF, 0x7B,
+    0xE3, 0xDD, 0x04, 0x81, 0x72, 0x57, 0x44, 0xD8, 0xB3, 0xDF, 0xF3, 0xDA, 0x6F, 0xDE, 0xEF, 0xF7,
+    0xC6, 0xC5, 0x83, 0x8B, 0x47, 0x17, 0x0F, 0xA7, 0xD1, 0x50, 0x72, 0xF5, 0xA5, 0xF4, 0x4B, 0xAE,
+    0x1D, 0x96, 0xC8, 0x87, 0xB8, 0x45, 0xAC, 0x94, 0xC0, 0x52, 0xF1, 0x44, 0x96, 0xC0, 0xAD, 0x7C,
+    0xA1, 0xB8, 0x05, 0x8E, 0xB8, 0x45, 0x06, 0xDC, 0x99, 0xC7, 0x35, 0x2A, 0xEE, 0x6F, 0x3E, 0xB9,
+    0x78, 0x72, 0xF1, 0x58, 0x92, 0x5D, 0x02, 0x31, 0x49, 0x97, 0x74, 0xC0, 0x36, 0x69, 0x45, 0xD2,
+    0x26, 0x05, 0x66, 0x4D, 0xD6, 0xC8, 0xE2, 0xDE, 0xB3, 0x7B, 0xCF, 0xEE, 0x58, 0xF2, 0xEF, 0x02,
+    0x8A, 0xA9, 0x8A, 0x4A, 0xC4, 0xE0, 0xA6, 0x5A, 0x7B, 0x54, 0x5B, 0xAA, 0xDA, 0x13, 0xDC, 0x02,
+    0xD5, 0xDB, 0xA3, 0x72, 0xB9, 0x83, 0x5F, 0xBC, 0xFB, 0x07, 0xD4, 0x3E, 0x98, 0x52, 0x19, 0x7F,
+    0xE9, 0xC5, 0x7E, 0xB9, 0x7B, 0x47, 0x6A, 0x7E, 0x38, 0x3B, 0x82, 0x23, 0xD8, 0xA7, 0x00, 0x03,
+    0x9D, 0x60, 0x3E, 0xD7, 0x6D, 0xB0, 0x31, 0xF5, 0x7B, 0x48, 0xB9, 0xF4, 0x15, 0x44, 0xB9, 0x06,
+    0x90, 0x2B, 0xB4, 0x07, 0x28, 0x9A, 0xEF, 0xE3, 0x5D, 0xBD, 0xAE, 0x21, 0x1E, 0x1B, 0xA0, 0xE8,
+    0x5D, 0xEF, 0xD7, 0xFF, 0xB2, 0x40, 0xE1, 0xD5, 0x2B, 0x22, 0xD3, 0x96, 0xE2, 0x77, 0x0C, 0x95,
+    0xE4, 0x4F, 0x47, 0x65, 0x2A, 0xAA, 0xAD, 0xA4, 0x5D, 0x88, 0x30, 0x34, 0x29, 0x2D, 0xD6, 0x74,
+    0xF7, 0xE0, 0xBC, 0x55, 0x97, 0x49, 0xC7, 0x40, 0xE3, 0x3E, 0xD0, 0xA4, 0x5B, 0x28, 0x7F, 0xF6,
+    0x13, 0xEC, 0x36, 0x72, 0x92, 0x7F, 0x05, 0x6B, 0xF2, 0xF5, 0x68, 0xF3, 0x76, 0x2F, 0xD9, 0xE5,
+    0x70, 0x9A, 0xAF, 0x4B, 0x49, 0x7C, 0x37, 0x16, 0x15, 0x24, 0xDD, 0x8F, 0xFA, 0x10, 0xD4, 0x64,
+    0x67, 0x84, 0x21, 0xCE, 0x5A, 0xAB, 0x34, 0x6F, 0x02, 0xE5, 0x57, 0xD2, 0x72, 0x0E, 0xFE, 0x28,
+    0xBA, 0x2F, 0xA2, 0xCC, 0x92, 0xDB, 0xB0, 0x03, 0xA1, 0x41, 0xEE, 0x12, 0x4F, 0x07, 0x60, 0x2C,
+    0xE3, 0xC5, 0xEB, 0xC6, 0x4B, 0x3F, 0xD3, 0xF0, 0xCE, 0x30, 0x8A, 0x88, 0xE8, 0x0B, 0x4F, 0x32,
+    0x89, 0x85, 0x4B, 0xD1, 0x28, 0xA6, 0x51, 0x81, 0x45, 0xA3, 0xFF, 0x48, 0xA0, 0x86, 0xDF, 0xC0,
+    0x52, 0x93, 0xD3, 0x7D, 0xAC, 0xFB, 0xCC, 0x1F, 0xF4, 0x51, 0x72, 0xDF, 0x92, 0x64, 0x2A, 0x44,
+    0x1C, 0x72, 0xB2, 0xA8, 0x62, 0xEF, 0x3A, 0xB1, 0x55, 0x36, 0xE6, 0x03, 0x9C, 0xCF, 0xBB, 0x84,
+    0x3B, 0x21, 0xD7, 0xAF, 0xF7, 0x94, 0x64, 0x7F, 0x85, 0xC0, 0x4A, 0xF2, 0xCB, 0x9E, 0x24, 0x46,
+    0xB4, 0x29, 0xDE, 0x37, 0x64, 0x89, 0x60, 0x5B, 0xD1, 0x4B, 0xA1, 0xD5, 0xB1, 0xF1, 0x7F, 0x7A,
+    0x7C, 0x47, 0x91, 0xD4, 0x8D, 0x3C, 0xF4, 0xBD, 0x18, 0x64, 0xE3, 0xAE, 0xEA, 0x71, 0xEE, 0xB4,
+    0x2C, 0xCB, 0xE5, 0x72, 0x29, 0xD1, 0x63, 0x51, 0x4B, 0x5F, 0x05, 0x66, 0x4F, 0xA1, 0xAC, 0xFA,
+    0xB4, 0xB3, 0xFB, 0x0B, 0xBF, 0x73, 0xAC, 0xDC, 0x1B, 0x0F, 0xA6, 0xAF, 0x2B, 0xF8, 0x4F, 0xBB,
+    0x7F, 0x81, 0x4E, 0xF3, 0x29, 0x8C, 0x77, 0x29, 0xA4, 0x4E, 0xC9, 0x28, 0xC9, 0x18, 0xC3, 0xB3,
+    0xCF, 0xE5, 0x58, 0x17, 0x6F, 0x8B, 0x96, 0xF0, 0x15, 0x70, 0x7B, 0x33, 0x6D, 0xBE, 0x61, 0x67,
+    0x0C, 0x0A, 0xD7, 0xD8, 0x31, 0x43, 0xD6, 0x86, 0x14, 0x19, 0x58, 0x82, 0x40, 0x88, 0xC3, 0xBB,
+    0x33, 0x0D, 0xB7, 0x7A, 0xC1, 0x1A, 0x62, 0x5F, 0xD2, 0xBC, 0xFC, 0xF5, 0xAC, 0xC9, 0xCC, 0x9A,
+    0x75, 0x81, 0xB5, 0x38, 0xB0, 0x4A, 0x60, 0x3D, 0x38, 0x13, 0x31, 0x2E, 0xC5, 0x20, 0x1A, 0x66,
+    0x29, 0xA6, 0xC3, 0xC3, 0x9E, 0x0F, 0x6D, 0x78, 0x10, 0xCB, 0x84, 0xDA, 0xDF, 0x34, 0xA9, 0x15,
+    0x05, 0x0C, 0x5A, 0x33, 0x7C, 0x6B, 0x26, 0xF6, 0x8D, 0x96, 0x0F, 0xA5, 0x04, 0x79, 0xF2, 0xD6,
+    0x62, 0xB5, 0x5A, 0x55, 0x1C, 0x0D, 0xAD, 0xC2, 0x8A, 0x7F, 0xE5, 0x3F, 0x2E, 0x36, 0x64, 0x73,
+    0xE4, 0x6B, 0x6E, 0xF1, 0x1D, 0x27, 0x46, 0x50, 0xA9, 0xCA, 0xD5, 0x0C, 0xB5, 0x2C, 0x98, 0x26,
+    0xD9, 0xA4, 0x3B, 0xF5, 0x91, 0xDA, 0x0C, 0xE0, 0x26, 0x99, 0x68, 0x56, 0x86, 0x8E, 0x8D, 0x50,
+    0x17, 0x30, 0x0C, 0x0A, 0x6D, 0xA7, 0x4D, 0x87, 0xEB, 0xD6, 0xAC, 0xF0, 0xC1, 0xEF, 0x12, 0x2A,
+    0x9D, 0x3C, 0x30, 0x7C, 0xAA, 0x35, 0xF5, 0x18, 0x24, 0x8E, 0x12, 0x10, 0xA1, 0x14, 0x1F, 0xF6,
+    0xA1, 0x6C, 0x12, 0xAD, 0x67, 0xC7, 0x20, 0x2E, 0xEE, 0x62, 0xC6, 0xE5, 0x4D, 0x04, 0x23, 0xF3,
+    0xB5, 0xA9, 0x30, 0xA7, 0xDA, 0x0C, 0x2D, 0x68, 0xDA, 0xAC, 0x4D, 0x9B, 0x92, 0x3C, 0x4D, 0xD2,
+    0x9E, 0xC8, 0x8F, 0x4A, 0xB7, 0xC8, 0x02, 0x68, 0xB7, 0x45, 0xC1, 0xE5, 0xA0, 0x63, 0xA4, 0xB4,
+    0x0D, 0x34, 0x6D, 0x46, 0x7D, 0x9F, 0x35, 0xE4, 0x33, 0x90, 0xB7, 0x45, 0xE6, 0x5C, 0x8B, 0x61,
+    0x20, 0xF6, 0xF9, 0x5F, 0xE7, 0x13, 0x87, 0x09, 0x02, 0xC2, 0x4E, 0x89, 0x27, 0x31, 0x8F, 0x74,
+    0xB4, 0x68, 0x67, 0xB5, 0x81, 0x06, 0xBB, 0x18, 0x8F, 0xD9, 0x33, 0x7B, 0x2E, 0x9F, 0xF5, 0x9A,
+    0x9E, 0xE0, 0x17, 0xBA, 0x6E, 0x0A, 0xF1, 0x5E, 0x11, 0x4E, 0x19, 0xC0, 0xA6, 0xFE, 0x1F, 0x91,
+    0x25, 0x66, 0x14, 0xED, 0x9A, 0xAD, 0xEC, 0x2A, 0x03, 0xDB, 0xBD, 0xA0, 0xFD, 0xD3, 0x3D, 0x46,
+    0xD1, 0x8B, 0x1A, 0x66, 0x32, 0xED, 0x60, 0xF6, 0x9A, 0xCF, 0x45, 0xC5, 0x17, 0x55, 0x58, 0xA3,
+    0xD6, 0xF1, 0x1B, 0x5C, 0x47, 0xC9, 0xA7, 0x12, 0x7A, 0x80, 0x2D, 0xC3, 0x9E, 0x60, 0x0B, 0xB1,
+    0x47, 0xD8, 0x52, 0x0C, 0x6B, 0x3C, 0x84, 0x1E, 0xD2, 0x12, 0x70, 0x33, 0x33, 0x1B, 0x47, 0x99,
+    0xDB, 0xC0, 0x9C, 0xCC, 0xCC, 0x3A, 0x59, 0xC6, 0xB9, 0xF1, 0xDC, 0x2C, 0x95, 0xCC, 0xB9, 0x32,
+    0x5B, 0x3F, 0x2F, 0x6E, 0x7C, 0xA3, 0xEB, 0xA5, 0x64, 0xE9, 0x0F, 0x13, 0x2E, 0x99, 0xB4, 0x29,
+    0x59, 0x05, 0x3F, 0xD3, 0x84, 0x4F, 0xD8, 0xF1, 0x3C, 0xBF, 0x4B, 0x9E, 0x58, 0x2C, 0x45, 0xAC,
+    0x2D, 0x8F, 0xAF, 0x92, 0x0E, 0x18, 0x9E, 0x09, 0xF9, 0x1A, 0x96, 0x66, 0x0D, 0x0E, 0x90, 0xA4,
+    0xB3, 0x9C, 0x2F, 0x0C, 0xCF, 0x78, 0x7B, 0xB3, 0xD9, 0x3C, 0xE2, 0xE4, 0xEA, 0x14, 0xEE, 0x57,
+    0x62, 0x1B, 0xCC, 0x6C, 0x75, 0x79, 0xD4, 0x88, 0xF0, 0xE8, 0xF8, 0x00, 0x2A, 0x3D, 0xA7, 0x7D,
+    0x68, 0xB3, 0xC3, 0x0C, 0x7A, 0xDD, 0x0F, 0x16, 0xC6, 0x4C, 0x06, 0x73, 0xCF, 0x74, 0x73, 0x94,
+    0x8D, 0xE1, 0xFD, 0x95, 0x7B, 0x29, 0xDF, 0x6A, 0xB9, 0xCC, 0x5E, 0x3E, 0x94, 0xF7, 0xCB, 0xEB,
+    0x5C, 0xF2, 0x1D, 0x98, 0x19, 0x29, 0x96, 0x5C, 0x7A, 0x48, 0xED, 0xD9, 0x15, 0x3F, 0x37, 0xCF,
+    0x20, 0xBA, 0xC7, 0x36, 0xE3, 0x69, 0xC6, 0xFF, 0xEE, 0x1A, 0x7B, 0x21, 0x1F, 0x67, 0x87, 0xD4,
+    0x43, 0xD0, 0xFB, 0x03, 0x33, 0x44, 0x23, 0x0A, 0x38, 0xFE, 0x11, 0x42, 0xFA, 0xED, 0xB0, 0xC4,
+    0x1C, 0xE9, 0xDF, 0xD3, 0x61, 0xC5, 0xEB, 0x6F, 0xDD, 0x5A, 0x3B, 0x90, 0xDE, 0x56, 0x15, 0x3E,
+    0x92, 0x76, 0x57, 0x49, 0xC4, 0x8C, 0x5C, 0xD8, 0x93, 0x10, 0x0F, 0x88, 0x82, 0x02, 0x32, 0x13,
+    0xAB, 0xA1, 0xB4, 0x57, 0x22, 0x99, 0x09, 0xAD, 0x8B, 0x5D, 0x33, 0x83, 0x8B, 0x50, 0xA4, 0x00,
+    0x17, 0xB8, 0xA1, 0x48, 0x61, 0xAF, 0x34, 0x69, 0x28, 0x28, 0x58, 0x8A, 0x84, 0x19, 0x1A, 0x52,
+    0x98, 0x99, 0xF8, 0xCF, 0x30, 0x69, 0x3D, 0xC3, 0xEE, 0x4A, 0x4C, 0x0A, 0x0A, 0x8A, 0xFC, 0x30,
+    0xF4, 0x51, 0xC6, 0xCE, 0x64, 0x30, 0x85, 0x15, 0x50, 0x88, 0x4C, 0x24, 0x5D, 0xBE, 0xEF, 0x5C,
+    0xFD, 0x8F, 0x5D, 0x6F, 0xFC, 0x48, 0xC2, 0x3A, 0xCE, 0xBF, 0xAB, 0x73, 0xFE, 0xC7, 0xD5, 0xBD,
+    0xE7, 0x75, 0xCF, 0x4B, 0x77, 0x55, 0x92, 0x32, 0x99, 0x66, 0xD3, 0xA4, 0x7C, 0x42, 0xF8, 0x5A,
+    0x95, 0x50, 0xFF, 0xA2, 0x74, 0xF6, 0x17, 0xE7, 0xB3, 0x3F, 0x8C, 0x9C, 0xFF, 0xE9, 0x60, 0xA7,
+    0x1E, 0xAF, 0x46, 0xE4, 0xA4, 0xB9, 0x21, 0xC6, 0x74, 0xBE, 0xB9, 0xD5, 0x86, 0xAD, 0x1C, 0x8B,
+    0xA7, 0x22, 0x49, 0x8E, 0x2B, 0x15, 0xC9, 0x30, 0xB4, 0x38, 0x70, 0x65, 0xE3, 0xC5, 0xDF, 0x39,
+    0x5B, 0x54, 0x89, 0x84, 0xBD, 0x73, 0xC9, 0xC3, 0x1C, 0x52, 0x98, 0x56, 0xD6, 0x86, 0x74, 0x31,
+    0x3F, 0x2E, 0x39, 0x2B, 0xE3, 0xAB, 0xC0, 0x2F, 0x81, 0x31, 0xB5, 0xC4, 0xFF, 0x2D, 0x2A, 0xC9,
+    0x72, 0xA7, 0xD4, 0x19, 0xA5, 0x9F, 0x83, 0xEE, 0x53, 0xC0, 0xB9, 0x61, 0x73, 0x03, 0x93, 0xEB,
+    0x0A, 0x00, 0x9F, 0x3A, 0x4E, 0x81, 0x4B, 0xE0, 0x81, 0x33, 0x89, 0xA6, 0x5C, 0xD5, 0xE0, 0x16,
+    0x33, 0x07, 0x2B, 0xA0, 0x4A, 0xCE, 0xAC, 0x5E, 0x09, 0xF3, 0x2C, 0x33, 0x45, 0x1E, 0xE1, 0x3B,
+    0x09, 0x1A, 0xDC, 0x13, 0x96, 0xB2, 0x2B, 0x61, 0x2A, 0xEB, 0x12, 0x0B, 0xFE, 0x01, 0x22, 0x0B,
+    0x22, 0x7E, 0x0C, 0x73, 0xD9, 0x92, 0xA0, 0x72, 0x30, 0x6E, 0x38, 0xDF, 0x4B, 0x82, 0xDB, 0xD2,
+    0xAD, 0x93, 0x43, 0x54, 0x7E, 0x47, 0xC4, 0xB7, 0xEC, 0x25, 0xB8, 0xE2, 0x94, 0xB2, 0xCB, 0x24,
+    0x82, 0x64, 0x06, 0x8C, 0x17, 0xDC, 0xE0, 0xD5, 0xE2, 0xB5, 0xE2, 0xB6, 0xE2, 0xD7, 0x24, 0x30,
+    0x04, 0x51, 0x7B, 0x3A, 0x20, 0x51, 0x21, 0xC6, 0x39, 0xC5, 0x19, 0x4E, 0x29, 0x00, 0xFF, 0x43,
+    0xA5, 0xFD, 0x63, 0x12, 0xEF, 0x18, 0x48, 0xD6, 0x99, 0x98, 0xFF, 0xBE, 0x2E, 0xAE, 0xA1, 0xD4,
+    0x9C, 0x49, 0x71, 0xF3, 0xF5, 0x51, 0xF2, 0xCB, 0xD0, 0xFE, 0x6A, 0xE1, 0x9D, 0xBF, 0x2E, 0xC3,
+    0xEF, 0xAE, 0xEF, 0x7B, 0xCD, 0xF4, 0x72, 0xFC, 0xE0, 0xD7, 0x3F, 0xBA, 0x2A, 0xBE, 0x31, 0x15,
+    0x64, 0x53, 0x27, 0xB9, 0x53, 0x2D, 0xAB, 0x3C, 0xA6, 0xBA, 0x4D, 0x2A, 0x1E, 0x34, 0x1D, 0x7E,
+    0x62, 0xD2, 0x24, 0xCD, 0xAA, 0x75, 0x08, 0xF0, 0x32, 0x18, 0xBC, 0x0C, 0xF6, 0x30, 0xAE, 0x4D,
+    0x4A, 0xA7, 0x89, 0x5A, 0xAF, 0xF6, 0xCC, 0xAD, 0xA9, 0x64, 0x18, 0xEC, 0x1A, 0xF0, 0x1C, 0x83,
+    0x3A, 0xC8, 0x81, 0x82, 0xC0, 0xB5, 0x0D, 0x0D, 0x0D, 0xAF, 0x5E, 0xAC, 0x41, 0x75, 0x19, 0x99,
+    0xDB, 0x4A, 0xC7, 0x8A, 0x1C, 0x4B, 0x30, 0x83, 0xD3, 0x01, 0xE2, 0xBD, 0xCC, 0x5F, 0x27, 0xED,
+    0x00, 0x07, 0x83, 0xA9, 0xD1, 0x00, 0xA2, 0x6C, 0x65, 0x61, 0xA2, 0x94, 0x19, 0xB4, 0xE7, 0xD6,
+    0x72, 0x61, 0x1B, 0xC2, 0xF6, 0x4B, 0xCF, 0x0C, 0xD2, 0x40, 0x97, 0xE1, 0xD0, 0xCB, 0x25, 0xE8,
+    0x2F, 0xC9, 0x57, 0xE4, 0x8C, 0x9C, 0xD2, 0xC1, 0x11, 0xDE, 0xE9, 0x0D, 0x72, 0x7A, 0x3F, 0x4E,
+    0x4F, 0x4B, 0x7B, 0x00, 0xDB, 0xDF, 0x67, 0xE3, 0x4F, 0xC1, 0x3E, 0xAC, 0x3D, 0x70, 0xE1, 0x75,
+    0x8C, 0x88, 0xDF, 0xFF, 0x03, 0xE6, 0xF7, 0xCB, 0xC0, 0xF4, 0xB8, 0x07, 0x4B, 0x17, 0x37, 0xDC,
+    0xDA, 0xD2, 0x13, 0x80, 0xD0, 0x2C, 0xB5, 0x34, 0x86, 0x37, 0x64, 0x8D, 0xDA, 0x75, 0xCD, 0x4D,
+    0xEA, 0x14, 0xA2, 0x00, 0x7D, 0xFA, 0x3A, 0x91, 0x5A, 0x1C, 0x98, 0x3C, 0x31, 0xF5, 0x53, 0xDC,
+    0x8E, 0x58, 0xBB, 0x5D, 0x33, 0x6D, 0x72, 0xB3, 0xDD, 0x95, 0xB6, 0xC5, 0xBF, 0xD3, 0xEE, 0x9D,
+    0x6F, 0x93, 0xE1, 0xE5, 0xB5, 0xED, 0x63, 0xD8, 0xE4, 0x30, 0xDF, 0x30, 0x8F, 0x53, 0xCC, 0x8B,
+    0xAD, 0x33, 0xC0, 0xBA, 0xDC, 0x0E, 0xA6, 0x1E, 0xD4, 0x61, 0x05, 0x93, 0x82, 0xED, 0xE9, 0xF7,
+    0x59, 0x8A, 0xF9, 0x63, 0x7E, 0x0C, 0x6A, 0xEC, 0x01, 0xAF, 0xA5, 0xE5, 0x0D, 0xDC, 0x17, 0xFA,
+    0x33, 0x06, 0xA6, 0xF2, 0xB8, 0x3C, 0x26, 0xCF, 0x4C, 0x26, 0x93, 0x2B, 0x34, 0xE5, 0x56, 0x01,
+    0x45, 0x4C, 0x20, 0x77, 0x07, 0x72, 0x61, 0xB2, 0x5D, 0x98, 0x0A, 0xFF, 0x27, 0x36, 0xD3, 0x07,
+    0x57, 0xD2, 0xD3, 0x93, 0x54, 0x95, 0x14, 0x63, 0x41, 0x2A, 0x29, 0x36, 0x56, 0x49, 0x71, 0x9A,
+    0xA9, 0x92, 0xB0, 0x85, 0x54, 0x49, 0x71, 0x1A, 0xAB, 0x72, 0xF8, 0xD9, 0xE2, 0x41, 0x95, 0x12,
+    0xC3, 0x01, 0x58, 0x5C, 0x59, 0xFC, 0x9B, 0x5A, 0x95, 0x14, 0x3F, 0xD7, 0xA8, 0x92, 0xE2, 0xB4,
+    0x53, 0x25, 0xC5, 0xE9, 0x9E, 0x55, 0x12, 0xEE, 0xA7, 0x92, 0xE2, 0x34, 0x2A, 0xA9, 0xA4, 0x28,
+    0x0D, 0xFE, 0xF6, 0xE0, 0x4A, 0xA2, 0x80, 0x8C, 0x02, 0x0A, 0xED, 0xAA, 0x0E, 0x84, 0xF3, 0x68,
+    0x92, 0xEF, 0x77, 0x3B, 0xB2, 0xDE, 0x4A, 0xDC, 0x4A, 0x04, 0x88, 0xF7, 0xEB, 0xB2, 0x0B, 0xD6,
+    0x7C, 0x08, 0xE1, 0x38, 0x46, 0x6D, 0x70, 0x86, 0x9D, 0x7B, 0x81, 0x67, 0x26, 0xC3, 0x7E, 0x45,
+    0xEC, 0xDC, 0xFB, 0xB6, 0x9F, 0x8C, 0x72, 0x3F, 0xA0, 0x44, 0xC7, 0x6C, 0x83, 0xAC, 0xF8, 0xD7,
+    0xDD, 0x63, 0x72, 0x99, 0x56, 0x4A, 0xB8, 0x43, 0xBD, 0x42, 0xE8, 0x90, 0x7F, 0x42, 0xCE, 0xF9,
+    0x16, 0xA6, 0x62, 0x7A, 0xFC, 0x9F, 0xD8, 0xDC, 0x70, 0xCD, 0x36, 0xB8, 0x6D, 0x04, 0xBC, 0xC0,
+    0xBE, 0x30, 0x9E, 0xB7, 0x11, 0xD3, 0x79, 0x41, 0x18, 0x9E, 0x7A, 0xA2, 0x7E, 0xE6, 0xE2, 0x14,
+    0x1F, 0x83, 0x3B, 0xDC, 0x7A, 0xAD, 0xC3, 0xF6, 0x6E, 0x64, 0x6D, 0x02, 0x09, 0x4D, 0xC4, 0xED,
+    0xB9, 0xBF, 0x61, 0x88, 0x31, 0x7D, 0xE5, 0x7C, 0xFF, 0xF6, 0xD4, 0xFB, 0x67, 0x07, 0x51, 0x39,
+    0x8C, 0x20, 0x29, 0x0D, 0xD4, 0x55, 0x9A, 0x5C, 0x4C, 0x69, 0x6E, 0x9F, 0xBF, 0x55, 0x82, 0xDD,
+    0x77, 0xCA, 0x3E, 0xEB, 0x83, 0xB2, 0x5F, 0x4D, 0x97, 0xC3, 0xC8, 0xDD, 0x81, 0xAC, 0x5E, 0x98,
+    0x5C, 0xA1, 0x99, 0xB6, 0x08, 0x46, 0x37, 0x5B, 0x78, 0xB9, 0xFC, 0x5A, 0x42, 0x90, 0x11, 0x14,
+    0x04, 0xE6, 0xAE, 0xA0, 0x98, 0x0F, 0xD6, 0xDB, 0x74, 0x02, 0x9F, 0x00, 0xB1, 0x06, 0x40, 0x82,
+    0x2F, 0x04, 0xF8, 0xE9, 0xCF, 0x57, 0xC1, 0x33, 0x22, 0x3C, 0x62, 0xFC, 0xAA, 0x78, 0x53, 0xBF,
+    0x0C, 0x1B, 0x98, 0x28, 0xA2, 0x86, 0x6C, 0x65, 0x5D, 0x56, 0xC9, 0x33, 0x8E, 0x09, 0x4C, 0xF2,
+    0xD6, 0x99, 0xF8, 0x58, 0x2C, 0x87, 0xFD, 0x9D, 0xB0, 0x56, 0x1A, 0xC2, 0x4A, 0x65, 0xE7, 0x92,
+    0x9C, 0xB9, 0x46, 0x2B, 0xA5, 0xA1, 0x5E, 0x53, 0x43, 0x3D, 0x23, 0x97, 0xE3, 0xD7, 0x20, 0x83,
+    0x4A, 0x7E, 0x0A, 0xB5, 0xAF, 0x50, 0xEB, 0x3B, 0x8C, 0xFD, 0x19, 0xA3, 0x51, 0x5C, 0xC2, 0x41,
+    0x87, 0x8C, 0x5F, 0xF4, 0xD9, 0x05, 0x25, 0x07, 0x5A, 0x52, 0x7A, 0x95, 0x14, 0xFB, 0x79, 0x80,
+    0x3D, 0x78, 0xB0, 0x8E, 0x26, 0x80, 0x29, 0x55, 0x08, 0x66, 0x31, 0x7F, 0xCC, 0x38, 0xEC, 0x31,
+    0x79, 0x0A, 0xEB, 0x6E, 0xA9, 0xB7, 0x70, 0xA1, 0x31, 0x78, 0xC4, 0x10, 0xC8, 0x47, 0xC4, 0xBF,
+    0xA8, 0x2E, 0xE0, 0x34, 0xE3, 0x6B, 0xAA, 0xC6, 0xB4, 0x6E, 0x6D, 0xAA, 0x53, 0x44, 0xEF, 0x07,
+    0xE4, 0x69, 0x14, 0x93, 0xA0, 0x54, 0x04, 0x3B, 0xD5, 0x40, 0xC9, 0x3D, 0x9A, 0xC0, 0x26, 0x0B,
+    0xA2, 0xCE, 0x41, 0x50, 0x49, 0xDC, 0xDA, 0xBB, 0x05, 0xE4, 0x57, 0xC1, 0xEF, 0x52, 0x59, 0x0D,
+    0xCB, 0x28, 0xC2, 0xA4, 0x51, 0x7A, 0x26, 0x56, 0xEF, 0x7C, 0x8D, 0x68, 0xC7, 0xA9, 0x81, 0x9C,
+    0xD6, 0x9B, 0x02, 0x79, 0x75, 0xC0, 0xBD, 0x15, 0x4C, 0x43, 0xA2, 0x30, 0x5F, 0xDD, 0xBC, 0xB8,
+    0xAD, 0xD6, 0x8C, 0xDF, 0x2E, 0x5B, 0xD4, 0x59, 0xC4, 0x5B, 0x41, 0x0C, 0xC3, 0x5C, 0x0D, 0xDF,
+    0x9C, 0x8A, 0x3F, 0x95, 0xE4, 0x9D, 0x94, 0xC4, 0x9F, 0x42, 0x86, 0x10, 0x6B, 0x78, 0x50, 0x16,
+    0xC3, 0x74, 0x0C, 0x1E, 0x6E, 0xA3, 0xC8, 0xAB, 0x14, 0x29, 0xF1, 0x21, 0x72, 0xB0, 0x13, 0x44,
+    0x89, 0xAF, 0xAE, 0x6A, 0x37, 0xE1, 0xB2, 0x69, 0x7B, 0x8A, 0x49, 0xC0, 0xF3, 0x35, 0x77, 0x58,
+    0xF8, 0x83, 0x29, 0x11, 0x88, 0xD7, 0x4D, 0x1D, 0x5B, 0x17, 0x0B, 0xA9, 0x78, 0xD6, 0x43, 0xC1,
+    0x41, 0x51, 0x2A, 0x4A, 0xBC, 0x30, 0xFC, 0x60, 0x62, 0xAE, 0x14, 0xE5, 0xA4, 0x85, 0xA2, 0x4B,
+    0x5E, 0xDD, 0x20, 0xF1, 0x99, 0x46, 0x20, 0x45, 0xE3, 0x8B, 0x0E, 0x08, 0x5E, 0x4F, 0xB8, 0x28,
+    0xA5, 0x78, 0x0A, 0x9B, 0x5B, 0x17, 0xE0, 0xF0, 0xAD, 0x11, 0x77, 0xD6, 0x9B, 0x28, 0xF1, 0x88,
+    0xCB, 0xA4, 0xDE, 0xC3, 0x7D, 0x24, 0xDF, 0xC3, 0xC6, 0xA6, 0x40, 0xB9, 0xF1, 0x93, 0x31, 0xBF,
+    0xD9, 0x1D, 0x71, 0xEB, 0xAA, 0x67, 0x47, 0x84, 0x6F, 0x91, 0xDD, 0xED, 0xF9, 0x53, 0x24, 0x8E,
+    0xD9, 0x9B, 0x5D, 0x58, 0x9E, 0x02, 0x36, 0x75, 0x2C, 0x97, 0x5A, 0x71, 0xAE, 0x82, 0x8F, 0x46,
+    0x03, 0x46, 0xE7, 0x56, 0x1A, 0x5B, 0x1A, 0xBF, 0x24, 0xF6, 0x6A, 0x08, 0x81, 0xDE, 0xB7, 0x5C,
+    0xD7, 0x80, 0x12, 0xE5, 0xD8, 0x4B, 0xCA, 0x8D, 0xC5, 0x97, 0xE5, 0xC4, 0xB9, 0x3E, 0xB5, 0xC1,
+    0xA6, 0x55, 0xFB, 0x51, 0xEC, 0x4F, 0xC7, 0x00, 0x74, 0xDC, 0x3A, 0x23, 0xDA, 0x96, 0x87, 0xCB,
+    0xA1, 0x9B, 0x7E, 0x69, 0x11, 0x87, 0xD4, 0xE5, 0xEE, 0x8C, 0x11, 0xA7, 0xB3, 0xF9, 0x06, 0xAC,
+    0x54, 0x98, 0xD8, 0x52, 0xA3, 0x74, 0x2C, 0xB5, 0xD8, 0x04, 0xCC, 0x5A, 0xE1, 0xE2, 0xCA, 0x75,
+    0xD8, 0xA5, 0xD0, 0xBC, 0xD5, 0x23, 0x9F, 0xED, 0x41, 0xD0, 0xB6, 0x4E, 0xE9, 0xBE, 0xA1, 0xA1,
+    0xCD, 0x06, 0x84, 0x4C, 0x83, 0x5E, 0xAC, 0x99, 0x74, 0xA0, 0xA1, 0x42, 0xE5, 0x27, 0xCB, 0x19,
+    0xCB, 0x18, 0xD6, 0xF5, 0x57, 0xAE, 0x86, 0xF5, 0x74, 0x4C, 0xA2, 0x12, 0x5F, 0x57, 0xB8, 0xAB,
+    0x5A, 0xE8, 0xB8, 0x30, 0x52, 0x9E, 0x94, 0x39, 0x2B, 0x89, 0x82, 0x78, 0x4A, 0xDE, 0xCA, 0x9B,
+    0xC3, 0xA9, 0xAF, 0xA4, 0x32, 0x9B, 0x8D, 0x73, 0x72, 0x92, 0xD0, 0x29, 0x4B, 0xB1, 0xB9, 0x09,
+    0x36, 0x18, 0x8D, 0x34, 0xDE, 0x1A, 0x71, 0x87, 0xC9, 0xA4, 0xC8, 0x39, 0x2C, 0x2A, 0x79, 0x4B,
+    0x38, 0xC5, 0xDE, 0x65, 0xF4, 0xC7, 0x54, 0x7E, 0x4D, 0x5A, 0xBD, 0x56, 0x73, 0x45, 0x26, 0x68,
+    0xF0, 0x83, 0xCA, 0x09, 0xC1, 0xD3, 0xCA, 0xA0, 0x2D, 0x0B, 0x8C, 0x32, 0xA9, 0xB4, 0xE9, 0x26,
+    0x54, 0x1B, 0x63, 0x65, 0xF1, 0xE8, 0xF1, 0xF5, 0xC4, 0xEB, 0xAA, 0x23, 0xA5, 0x2D, 0xEB, 0xD4,
+    0x8A, 0x0B, 0x65, 0x8B, 0x37, 0x86, 0x3A, 0xD5, 0xEA, 0x52, 0x65, 0xF2, 0xC8, 0xF0, 0xF5, 0x92,
+    0x7C, 0x9B, 0x5B, 0x3B, 0x7D, 0x99, 0x59, 0xF8, 0x7F, 0xB8, 0x4A, 0xC0, 0xAC, 0xFF, 0xB4, 0x14,
+    0xA5, 0x6E, 0x8C, 0x47, 0x4F, 0x53, 0xA9, 0x23, 0xB3, 0x15, 0x7D, 0x85, 0xF6, 0xBD, 0xFD, 0x5E,
+    0x1E, 0x45, 0x8E, 0xD6, 0xB6, 0x17, 0x54, 0xDD, 0x56, 0x7A, 0xEA, 0x70, 0x09, 0x46, 0x5A, 0x0A,
+    0xAB, 0x9F, 0x8E, 0xDB, 0x2F, 0xB1, 0x67, 0x60, 0x65, 0x3C, 0xCC, 0x32, 0x5F, 0x6E, 0xA3, 0x11,
+    0x0F, 0x5A, 0x55, 0x63, 0x31, 0xEB, 0x1D, 0xBC, 0xD6, 0x62, 0xAB, 0x3C, 0xCC, 0x5F, 0x59, 0x1C,
+    0x95, 0x16, 0xC7, 0xB9, 0xC5, 0xC9, 0xE8, 0x4D, 0x0A, 0x09, 0xDF, 0x47, 0x31, 0x8F, 0x4C, 0x21,
+    0x64, 0x29, 0xCF, 0xC2, 0x9B, 0x18, 0x04, 0xEA, 0xF7, 0xC1, 0x47, 0x9B, 0x2F, 0x6A, 0xF0, 0x34,
+    0x1A, 0x0B, 0x90, 0x97, 0x5A, 0x9C, 0xDC, 0x9C, 0xD0, 0xC4, 0x59, 0x4A, 0xE8, 0x3C, 0x83, 0xC5,
+    0x64, 0x59, 0x8D, 0xA6, 0xB5, 0x58, 0x39, 0xE4, 0x16, 0xAF, 0xEC, 0x14, 0xBA, 0xDD, 0x99, 0xB9,
+    0xE7, 0x16, 0xCF, 0xAC, 0xE8, 0xA2, 0xB9, 0xC1, 0xAA, 0xCB, 0x30, 0x8F, 0xB0, 0xB2, 0x9A, 0xCA,
+    0xCF, 0xC4, 0x53, 0xE6, 0x83, 0xD6, 0xF2, 0xB1, 0xF0, 0xF2, 0xBC, 0x7B, 0xE6, 0xF7, 0x33, 0xDB,
+    0xCA, 0xB8, 0x0F, 0x68, 0xC7, 0xDB, 0x7B, 0xAD, 0x83, 0x8D, 0xA7, 0x0B, 0xDB, 0xF5, 0xD5, 0x02,
+    0x90, 0x9E, 0xD1, 0x11, 0x15, 0xC3, 0x9B, 0xBD, 0xF2, 0xAA, 0x71, 0x4D, 0x2B, 0x31, 0xFF, 0xEF,
+    0x3A, 0x2A, 0x5F, 0xD0, 0xB2, 0xA6, 0xB6, 0x21, 0xEB, 0x4B, 0x70, 0x4F, 0x57, 0xD3, 0xEF, 0x0B,
+    0xCC, 0xED, 0x5C, 0x1D, 0xBD, 0x38, 0x97, 0x63, 0x9F, 0x41, 0xDD, 0x78, 0x27, 0xCB, 0xAE, 0x01,
+    0x6A, 0xEC, 0x71, 0x0D, 0x7A, 0x2D, 0xF5, 0x73, 0x0E, 0xBD, 0x36, 0x37, 0x37, 0x30, 0xAE, 0xD3,
+    0x8B, 0xEF, 0xEF, 0x35, 0xDE, 0xCE, 0x3F, 0xCC, 0x2E, 0xEB, 0x87, 0xC9, 0x75, 0x96, 0xAB, 0xCA,
+    0x68, 0xA7, 0x3E, 0x8B, 0x09, 0x79, 0x38, 0xF4, 0xAC, 0x81, 0x9C, 0x90, 0x65, 0x30, 0x68, 0x19,
+    0x12, 0x6C, 0x9B, 0x70, 0x1A, 0x4C, 0xDD, 0x66, 0x75, 0x29, 0x76, 0x1F, 0x29, 0x3D, 0x67, 0x1D,
+    0x24, 0x8E, 0xC1, 0xD4, 0x6B, 0x83, 0xCA, 0x6D, 0x90, 0xE0, 0x1C, 0x70, 0x7A, 0x47, 0x49, 0xCB,
+    0x85, 0x94, 0x56, 0x03, 0x4B, 0xA3, 0xAB, 0xE8, 0x34, 0x1F, 0x5A, 0x9D, 0x93, 0x51, 0x17, 0xA6,
+    0x3E, 0x69, 0xB6, 0xB1, 0xDB, 0x3E, 0xCF, 0xFF, 0xDA, 0x90, 0xDA, 0xA9, 0x98, 0x4F, 0x05, 0x0D,
+    0xDB, 0x73, 0xD8, 0x1D, 0x7B, 0x9A, 0xE2, 0xA6, 0xFF, 0xB7, 0xB5, 0x2E, 0x70, 0x4F, 0x94, 0x5A,
+    0xC4, 0x86, 0xD7, 0x1B, 0xF8, 0xA3, 0x1E, 0x79, 0x6C, 0x9C, 0x9E, 0x5D, 0x32, 0xC2, 0x08, 0x0E,
+    0x88, 0x6D, 0x85, 0x35, 0x7A, 0x85, 0xFB, 0x12, 0xDC, 0x83, 0x5D, 0x4E, 0xB1, 0x3D, 0x5F, 0xE3,
+    0xB8, 0x9C, 0xDD, 0x75, 0x9B, 0xC1, 0x6B, 0x01, 0x8F, 0x49, 0xBA, 0xA4, 0xEB, 0x2F, 0x98, 0x71,
+    0x24, 0xB0, 0x57, 0xE8, 0x9F, 0x6D, 0x3F, 0x86, 0xA8, 0xD7, 0xB6, 0xE8, 0x79, 0x26, 0xC1, 0x8D,
+    0x3A, 0x0C, 0x8D, 0x0A, 0xB5, 0x22, 0xBF, 0x55, 0xE4, 0xAA, 0x27, 0x66, 0x7E, 0xAD, 0x0D, 0xD4,
+    0xC1, 0xA2, 0x62, 0x86, 0xDE, 0x1C, 0x26, 0x39, 0x18, 0x52, 0x9F, 0x3C, 0xA2, 0x42, 0xFC, 0x7D,
+    0x43, 0x96, 0xEE, 0x1B, 0x67, 0xF1, 0xBA, 0xE5, 0x15, 0xC6, 0xF5, 0xEC, 0xEA, 0x27, 0xB5, 0x93,
+    0x68, 0x29, 0x03, 0xD2, 0xF2, 0xC3, 0xFC, 0x43, 0xC3, 0xCB, 0xB6, 0xFC, 0x18, 0x7B, 0x75, 0x90,
+    0x9A, 0x11, 0xE8, 0x03, 0xFC, 0x72, 0x26, 0x62, 0x20, 0x78, 0x99, 0xA5, 0xDF, 0x9D, 0x99, 0x36,
+    0xFD, 0x8B, 0x57, 0x65, 0x2C, 0x79, 0xEA, 0xAC, 0x56, 0xD8, 0x2A, 0xEC, 0x09, 0xB7, 0x8C, 0x42,
+    0x0C, 0x02, 0x84, 0x4B, 0x07, 0x84, 0x13, 0x06, 0xF4, 0xD9, 0x94, 0xDD, 0x02, 0xD3, 0x80, 0x70,
+    0x9C, 0x18, 0x0F, 0xAF, 0x4D, 0x98, 0x94, 0x84, 0x61, 0x45, 0xE8, 0x37, 0x84, 0x5E, 0x47, 0x28,
+    0x83, 0x47, 0x58, 0x3C, 0x4F, 0x98, 0xBC, 0x4D, 0x18, 0x5D, 0x27, 0x0C, 0x3E, 0x26, 0xF4, 0x0C,
+    0xA1, 0xA3, 0x50, 0x0A, 0x85, 0x89, 0x42, 0x70, 0x2D, 0x93, 0xB1, 0x0B, 0x6E, 0x75, 0x6E, 0x23,
+    0xCB, 0xE8, 0xDA, 0xAD, 0xD4, 0x66, 0x9D, 0x9D, 0x43, 0x33, 0x39, 0xA7, 0xD0, 0x5A, 0x24, 0x52,
+    0x61, 0x69, 0x53, 0x3B, 0xD7, 0xE8, 0x01, 0x6E, 0xFD, 0x4E, 0x83, 0x16, 0xE3, 0x0A, 0x64, 0xAD,
+    0xE1, 0x79, 0xB0, 0x11, 0xA7, 0xB0, 0xE1, 0x27, 0x4B, 0x35, 0x16, 0x25, 0x79, 0x61, 0x63, 0x51,
+    0x61, 0x09, 0xB8, 0x27, 0x42, 0xC5, 0x6F, 0x43, 0x98, 0xB6, 0x90, 0x93, 0x74, 0x9C, 0x33, 0xB6,
+    0x2B, 0x70, 0x3D, 0xB7, 0x9F, 0xAD, 0xEE, 0x42, 0x2F, 0x94, 0x3C, 0x42, 0x19, 0xF5, 0x14, 0xD9,
+    0xE4, 0xC1, 0x31, 0xB6, 0x99, 0xE6, 0x6C, 0x58, 0x2E, 0x6C, 0x5E, 0xAE, 0x0F, 0x0D, 0xE6, 0xB1,
+    0x71, 0x0C, 0x97, 0xB6, 0xF0, 0xD0, 0x1A, 0x94, 0x9F, 0xD2, 0xAF, 0xA8, 0x08, 0xDC, 0x2B, 0x56,
+    0xEF, 0x96, 0xDB, 0xD8, 0x66, 0x24, 0x85, 0x5A, 0x83, 0xD3, 0x69, 0x72, 0xEB, 0x57, 0xDA, 0x85,
+    0x75, 0x0E, 0x33, 0x83, 0xAF, 0x84, 0x08, 0x36, 0xE4, 0x71, 0x9B, 0xFA, 0x3C, 0xAB, 0x7D, 0x8A,
+    0xDB, 0x34, 0xFA, 0xF0, 0x15, 0xCD, 0x7A, 0x42, 0x7D, 0xC0, 0xC0, 0x66, 0xD4, 0x57, 0x54, 0xFD,
+    0xD6, 0xE5, 0x3B, 0x2D, 0xB3, 0x20, 0x78, 0x5B, 0x36, 0x26, 0x66, 0x9F, 0x64, 0x39, 0x1C, 0x7C,
+    0xF5, 0x78, 0x57, 0x9D, 0x3E, 0x4B, 0x15, 0x83, 0x9C, 0x24, 0xC7, 0x34, 0x7C, 0xF0, 0x06, 0x92,
+    0xDD, 0x9E, 0x73, 0x15, 0x99, 0xDE, 0xC7, 0xFC, 0x5B, 0x3B, 0x6A, 0xDA, 0x6E, 0xA6, 0xAF, 0x37,
+    0x18, 0xE9, 0x75, 0x48, 0x17, 0xC2, 0x1A, 0xEB, 0x81, 0x88, 0x22, 0x4D, 0x58, 0x56, 0x7C, 0x0D,
+    0x19, 0xF1, 0x92, 0x84, 0xBE, 0x65, 0x85, 0xD4, 0xD9, 0xC2, 0xA5, 0xB5, 0x42, 0xAA, 0x55, 0x48,
+    0x45, 0xA5, 0x64, 0xC6, 0x8D, 0x12, 0x9D, 0x59, 0x21, 0xF5, 0x2A, 0x24, 0xAF, 0x51, 0x21, 0x05,
+    0xB5, 0x0A, 0x89, 0x4F, 0x50, 0x0A, 0xCB, 0x6A, 0xC1, 0xE4, 0x9A, 0x82, 0x80, 0x5B, 0x22, 0x82,
+    0x83, 0x26, 0x62, 0x77, 0x1B, 0x48, 0x1B, 0x9E, 0x85, 0xF6, 0xDF, 0x4A, 0x6D, 0x7A, 0x42, 0x48,
+    0xCF, 0xB5, 0x7A, 0xE7, 0x9F, 0xC9, 0x8B, 0x44, 0xEF, 0x4E, 0x55, 0x48, 0x54, 0x13, 0x84, 0x64,
+    0x96, 0x85, 0xE4, 0x19, 0x15, 0x52, 0x60, 0xEB, 0xAB, 0xF0, 0x4F, 0x36, 0xEE, 0xA5, 0x33, 0x17,
+    0xB9, 0xE4, 0x27, 0x03, 0x8D, 0x0A, 0xAE, 0x75, 0x15, 0xB6, 0xF9, 0x14, 0xAB, 0x89, 0x68, 0x7F,
+    0xF1, 0x0E, 0x1F, 0xB9, 0xA5, 0x65, 0x57, 0x71, 0x84, 0x30, 0x53, 0x6B, 0xC9, 0xAC, 0x95, 0xF0,
+    0xC1, 0x67, 0xAA, 0x5D, 0x36, 0x09, 0x5B, 0xD6, 0x37, 0x9E, 0xB9, 0x59, 0x34, 0x5A, 0x8C, 0x4E,
+    0xA9, 0x95, 0x61, 0xE9, 0x89, 0xD7, 0x64, 0xD1, 0x4F, 0xF3, 0x94, 0xBD, 0xC0, 0x16, 0xF4, 0xE5,
+    0xEC, 0x41, 0xEA, 0x9D, 0xCE, 0xEF, 0xD1, 0xE1, 0xEE, 0x19, 0x85, 0x5A, 0xB6, 0xBA, 0xFA, 0x4C,
+    0xD6, 0xFF, 0x57, 0xA7, 0x13, 0xEE, 0x29, 0x1B, 0x51, 0xCE, 0xAD, 0x7E, 0x40, 0x79, 0x8F, 0x0C,
+    0x77, 0x8E, 0x6E, 0x64, 0x7B, 0xFB, 0x08, 0xF3, 0xF5, 0xF9, 0xF7, 0x77, 0xBC, 0x1E, 0x51, 0x9B,
+    0x6C, 0x17, 0xAD, 0xA6, 0x28, 0x5F, 0xD4, 0xDB, 0x07, 0x6D, 0x72, 0xCF, 0xB6, 0xAF, 0x53, 0x5D,
+    0xAB, 0xD4, 0xE6, 0x06, 0x5D, 0x0B, 0xAD, 0xD9, 0x66, 0xD2, 0xF8, 0xC7, 0x1B, 0x1A, 0xF7, 0xA0,
+    0x5E, 0xC7, 0xBA, 0x64, 0x7D, 0xC6, 0x62, 0x1F, 0x6A, 0x49, 0xF8, 0x1E, 0x6D, 0xC3, 0xFF, 0xB7,
+    0x76, 0xC6, 0xD5, 0x5A, 0x1C, 0x7D, 0x7E, 0x6A, 0xED, 0xE7, 0xAE, 0x8F, 0xF3, 0xEF, 0x07, 0x66,
+    0xF3, 0x9E, 0xC5, 0x41, 0xC0, 0x10, 0x92, 0xD1, 0x53, 0xB2, 0xB1, 0x83, 0xEF, 0x1C, 0x43, 0xAA,
+    0xD4, 0xE9, 0x87, 0xD5, 0x0C, 0x04, 0xF5, 0xBE, 0x8F, 0xD1, 0x74, 0x1C, 0x82, 0x2C, 0x3C, 0x9B,
+    0x14, 0x03, 0xEF, 0x6D, 0x00, 0x86, 0xF4, 0x2E, 0x0B, 0xA9, 0xA4, 0x9E, 0xBE, 0xAA, 0x9D, 0x8D,
+    0x8A, 0x5D, 0x18, 0x78, 0xF1, 0x1B, 0x6B, 0x86, 0x61, 0x20, 0x4B, 0xF7, 0x28, 0x0D, 0x3E, 0xDC,
+    0xCB, 0xE9, 0x45, 0x53, 0xF6, 0xAE, 0x20, 0x3F, 0xF8, 0x84, 0x9E, 0x39, 0x73, 0x4F, 0x71, 0xF5,
+    0x14, 0x73, 0x4F, 0x2F, 0xDB, 0xD3, 0x09, 0xF6, 0x4C, 0xF6, 0xF1, 0x03, 0x7F, 0x0D, 0xF9, 0x35,
+    0x5C, 0x3C, 0xEF, 0xAD, 0x7A, 0x3A, 0x4C, 0x56, 0x12, 0x6D, 0xCF, 0x5C, 0x6A, 0x09, 0xAC, 0xF2,
+    0x3B, 0xFF, 0xFD, 0x17, 0xEB, 0xDE, 0x87, 0xDE, 0x7B, 0x97, 0x6D, 0x1F, 0x59, 0x3D, 0x8B, 0x9D,
+    0x9A, 0xCF, 0xBA, 0x32, 0xDA, 0x94, 0xB1, 0x6A, 0xEF, 0xE6, 0x3E, 0x68, 0xD1, 0xF9, 0xDE, 0x54,
+    0x89, 0x35, 0x2C, 0x4F, 0x06, 0x71, 0x6F, 0xBF, 0x00, 0x87, 0x9E, 0xDB, 0xE8, 0xAA, 0x99, 0x9B,
+    0xFA, 0xAD, 0x70, 0x7C, 0xF7, 0x34, 0xCA, 0x22, 0xF6, 0xDE, 0xCA, 0x60, 0x78, 0x35, 0x2A, 0xE3,
+    0xF1, 0xC1, 0xBC, 0x3E, 0x74, 0x57, 0xEB, 0xD4, 0x47, 0x68, 0x3C, 0x8A, 0xE3, 0x98, 0x32, 0xFE,
+    0xE8, 0xC5, 0x5B, 0x25, 0x44, 0xF2, 0xCB, 0xD2, 0x35, 0x3D, 0xBC, 0xFA, 0x6A, 0x3A, 0x7F, 0xDC,
+    0xA0, 0xCE, 0x5F, 0xCB, 0x03, 0x5D, 0x67, 0x6B, 0xFE, 0xFC, 0xFD, 0xEC, 0xC3, 0xA1, 0x4A, 0x9B,
+    0x4B, 0x7C, 0xE0, 0x02, 0x15, 0x62, 0xCE, 0xF8, 0x1D, 0x90, 0xB6, 0xE7, 0xB6, 0x7C, 0xB4, 0xBC,
+    0xC7, 0xFA, 0x7D, 0xE5, 0xA1, 0x50, 0xF5, 0x75, 0x26, 0x01, 0x45, 0x15, 0xC2, 0x0A, 0x86, 0x8B,
+    0xE2, 0xBD, 0x57, 0xC0, 0x78, 0xCA, 0xA8, 0x5D, 0xEE, 0x30, 0x1D, 0x2D, 0x41, 0xC7, 0xA9, 0x9F,
+    0x2D, 0x66, 0xF0, 0x05, 0x03, 0xB7, 0xBE, 0x5B, 0x39, 0x50, 0xB0, 0x1E, 0xAD, 0x35, 0xBD, 0x61,
+    0x0F, 0x98, 0x88, 0x7D, 0xDA, 0x78, 0xCA, 0x85, 0xDE, 0x9E, 0x75, 0x00, 0xBE, 0xE9, 0xE1, 0x63,
+    0x78, 0xAB, 0x1C, 0xB5, 0xBA, 0x44, 0xE3, 0xD1, 0xDA, 0xD5, 0x86, 0x5D, 0xB0, 0x30, 0xD3, 0x08,
+    0xFE, 0x01, 0x3B, 0xB4, 0xCD, 0xD8, 0x10, 0xBE, 0xFD, 0xE4, 0x30, 0xBC, 0x30, 0x30, 0x4E, 0xC2,
+    0x61, 0xDB, 0x0C, 0xB6, 0xB2, 0xEB, 0xC3, 0xD3, 0x46, 0x23, 0xA6, 0xBB, 0x1D, 0xF1, 0x49, 0xF6,
+    0xA7, 0xCD, 0xD4, 0x35, 0x16, 0x87, 0xC3, 0x46, 0x72, 0x73, 0x32, 0xD9, 0x06, 0x45, 0x4A, 0x39,
+    0xCF, 0xC6, 0x94, 0xD6, 0x29, 0x26, 0x63, 0x23, 0x39, 0x9B, 0xDA, 0xCF, 0xF6, 0xDC, 0x54, 0xEE,
+    0x7E, 0xD2, 0x61, 0xB5, 0xF8, 0xA3, 0x8B, 0xEF, 0x99, 0xDF, 0x17, 0x39, 0xC8, 0xE4, 0x73, 0xC9,
+    0x1C, 0x94, 0x42, 0x7A, 0xF0, 0x3B, 0x24, 0x96, 0x91, 0xC2, 0xD9, 0x54, 0xE1, 0x60, 0x9D, 0x26,
+    0x18, 0xCE, 0xD5, 0x2C, 0x65, 0x39, 0x21, 0x29, 0x2C, 0xC6, 0x34, 0x6D, 0x18, 0x8F, 0x1A, 0xF4,
+    0x4B, 0x9F, 0x8B, 0xB1, 0x23, 0xAC, 0x67, 0xE6, 0x6A, 0x39, 0x16, 0x0C, 0xBF, 0xD5, 0x39, 0xE4,
+    0x22, 0x98, 0xE6, 0x03, 0x44, 0x6A, 0x83, 0x27, 0x66, 0x1C, 0x33, 0x1E, 0xB2, 0x88, 0xAC, 0xFB,
+    0x4E, 0xE8, 0xDC, 0x6E, 0x8C, 0xE1, 0x49, 0x9B, 0x07, 0x2A, 0x04, 0xF5, 0x0C, 0xB6, 0x6D, 0xB0,
+    0xB3, 0x2F, 0x34, 0x69, 0x1E, 0x99, 0x21, 0x86, 0xE8, 0xEC, 0x41, 0xFF, 0x64, 0xCF, 0xC8, 0xA3,
+    0x81, 0x47, 0xE3, 0x8E, 0x66, 0xF7, 0x9A, 0x8B, 0x44, 0x3C, 0x41, 0x61, 0x46, 0x30, 0x99, 0x4C,
+    0xF2, 0x79, 0xEF, 0xDF, 0x96, 0xE4, 0x56, 0xE8, 0xA5, 0x6D, 0x5F, 0x38, 0xA9, 0x6F, 0x5E, 0x2B,
+    0x52, 0x47, 0x7B, 0xE6, 0xB1, 0x9E, 0xF5, 0xD9, 0x9C, 0x67, 0xAA, 0xD1, 0xDC, 0x4D, 0x15, 0xB3,
+    0x4A, 0x5E, 0xEB, 0xF8, 0x45, 0x92, 0x73, 0xB4, 0x54, 0x69, 0x91, 0xAD, 0x25, 0xB6, 0x16, 0xD8,
+    0x2C, 0xAF, 0xB5, 0xB8, 0xD6, 0xD2, 0x7A, 0xA9, 0xB0, 0x3E, 0x5A, 0xAA, 0x58, 0xDF, 0x69, 0xAD,
+    0xE7, 0x76, 0x7E, 0x3D, 0x56, 0x7D, 0x07, 0x6A, 0xBE, 0x23, 0x25, 0x08, 0xD1, 0x0F, 0x8A, 0xB3,
+    0xB9, 0x0A, 0x7D, 0x38, 0x8F, 0x4A, 0xC8, 0xE2, 0xD4, 0xCE, 0x67, 0xFE, 0x9F, 0x30, 0x8B, 0xF2,
+    0x34, 0xED, 0xB1, 0x27, 0x8E, 0xE6, 0xB6, 0xC9, 0xCD, 0xF7, 0x59, 0xFF, 0x35, 0x58, 0x17, 0x53,
+    0x4D, 0xA9, 0x99, 0x50, 0x33, 0xDF, 0x5B, 0x07, 0x3C, 0xBE, 0x9C, 0x4A, 0x27, 0xE9, 0x17, 0x7A,
+    0x7D, 0xEA, 0x89, 0xC4, 0xCF, 0x23, 0x9E, 0x15, 0x5B, 0xC7, 0x61, 0x8B, 0x27, 0x1F, 0x1A, 0x9E,
+    0x88, 0x6D, 0xC7, 0x9C, 0x8F, 0x47, 0x71, 0x24, 0xFB, 0x27, 0x43, 0x07, 0x0F, 0x38, 0x7C, 0xCF,
+    0x2A, 0x52, 0x73, 0x39, 0xF8, 0xBB, 0xB5, 0xAB, 0x70, 0x72, 0xC6, 0x7C, 0x50, 0xF9, 0x2C, 0x6C,
+    0xC3, 0x06, 0x6E, 0x91, 0x8E, 0xB0, 0xC9, 0xE8, 0x36, 0x0A, 0x26, 0x2F, 0xC3, 0x98, 0xFB, 0xB8,
+    0x73, 0xE0, 0x35, 0x7B, 0x04, 0x1C, 0x52, 0xC3, 0x84, 0xC2, 0x0A, 0xB9, 0x4E, 0x0C, 0x4F, 0x7D,
+    0xCE, 0xA4, 0xAE, 0xB6, 0x12, 0x2E, 0x6A, 0x81, 0xBE, 0xA1, 0x27, 0x28, 0x9E, 0x62, 0x26, 0x75,
+    0xC6, 0x36, 0x64, 0xC2, 0x57, 0x4C, 0x63, 0x9B, 0x31, 0x2B, 0xFB, 0xE3, 0x56, 0x17, 0xE1, 0x87,
+    0xAE, 0xC0, 0xBD, 0x43, 0x7F, 0xCE, 0x08, 0xC8, 0xCE, 0x72, 0xC4, 0x96, 0x98, 0x67, 0xB3, 0x22,
+    0x82, 0xB0, 0x1C, 0xE6, 0xE0, 0x33, 0x9E, 0xFA, 0x92, 0x0B, 0x73, 0xDB, 0x5D, 0xF2, 0x72, 0x87,
+    0xA4, 0x65, 0x8E, 0x0D, 0x54, 0x95, 0x28, 0x33, 0xCA, 0x16, 0x0C, 0x5A, 0x4F, 0x39, 0x8F, 0xD9,
+    0x2B, 0xE5, 0xD2, 0x0C, 0x33, 0xD0, 0xF6, 0x73, 0xA0, 0x1F, 0x67, 0xC2, 0xF1, 0x6A, 0x08, 0x39,
+    0xE0, 0xC3, 0xD0, 0xB0, 0x0A, 0x39, 0x81, 0x8F, 0xA9, 0xD8, 0xBD, 0xD0, 0x87, 0x72, 0x33, 0x09,
+    0x39, 0x6F, 0x2C, 0x12, 0x20, 0x26, 0xF1, 0xBF, 0xE2, 0x41, 0x5E, 0x26, 0xF8, 0x8D, 0xEC, 0xD2,
+    0x06, 0x57, 0x1E, 0x0A, 0x55, 0x9A, 0x00, 0x19, 0x9B, 0x00, 0x65, 0xE2, 0xFD, 0x15, 0xBF, 0xFA,
+    0x79, 0xD4, 0x2C, 0x27, 0x40, 0x47, 0x4B, 0x90, 0x26, 0x40, 0xBB, 0x8C, 0x68, 0x03, 0xF3, 0x69,
+    0x7D, 0x77, 0xD0, 0xCB, 0x1D, 0x29, 0x41, 0x72, 0x6D, 0x56, 0xD7, 0x39, 0x0B, 0x1F, 0xB9, 0x7C,
+    0x60, 0xE8, 0x90, 0x73, 0xB0, 0xFB, 0x5F, 0x3B, 0xFB, 0x27, 0xE8, 0x0F, 0xC4, 0x5B, 0xB7, 0x04,
+    0x33, 0x1F, 0x54, 0xAE, 0xCD, 0x82, 0x2C, 0x33, 0x85, 0x66, 0x3C, 0x60, 0xC6, 0xFB, 0x04, 0xCC,
+    0x04, 0xD7, 0x6B, 0xD4, 0x7F, 0x6F, 0x83, 0x99, 0x84, 0x7C, 0xF4, 0x00, 0x6E, 0x0B, 0x66, 0xFC,
+    0x1A, 0xCC, 0x84, 0xA5, 0xD7, 0x14, 0x71, 0xEE, 0x35, 0x09, 0x06, 0xD6, 0x49, 0x47, 0x66, 0x1A,
+    0x30, 0x63, 0xA7, 0xD2, 0x72, 0x89, 0xDB, 0xF4, 0x1B, 0x32, 0x6F, 0x10, 0x1D, 0x5A, 0xB6, 0xF4,
+    0x87, 0x94, 0x2D, 0xD6, 0x7D, 0xF8, 0xF5, 0xE7, 0x04, 0x01, 0x41, 0x58, 0xD3, 0xDD, 0xD4, 0x58,
+    0x36, 0xAB, 0xC3, 0xFE, 0xFC, 0x27, 0x35, 0xFC, 0xD0, 0xF5, 0x1A, 0x69, 0xDB, 0xF3, 0x88, 0x2F,
+    0x67, 0x17, 0x65, 0x4B, 0x7B, 0xCF, 0xB2, 0xE5, 0x48, 0xA9, 0x3A, 0xAC, 0x6C, 0xD9, 0x5A, 0x2A,
+    0x5B, 0x56, 0x1F, 0x0A, 0x55, 0xC7, 0x19, 0x4C, 0xEE, 0x51, 0x25, 0x3C, 0x0C, 0xE5, 0x35, 0xF7,
+    0xA3, 0xBC, 0x62, 0x3C, 0x2D, 0xE2, 0xB5, 0x49, 0x6E, 0xCF, 0x90, 0x04, 0x35, 0x62, 0x53, 0x38,
+    0x0D, 0x2A, 0x7B, 0xC8, 0x24, 0xE1, 0x79, 0x93, 0x24, 0x05, 0x67, 0x05, 0xFD, 0xF6, 0xC0, 0xEC,
+    0x02, 0x5C, 0x66, 0x7A, 0x4C, 0xE5, 0x79, 0x9E, 0x58, 0xF9, 0x05, 0xCF, 0x69, 0xFC, 0x85, 0x07,
+    0x51, 0xDE, 0xE5, 0xA9, 0x0D, 0x5B, 0x84, 0xA4, 0x63, 0xF2, 0x2B, 0xF3, 0x5D, 0x66, 0x33, 0x49,
+    0x3D, 0x0E, 0x51, 0xCF, 0x28, 0x63, 0xF6, 0xFB, 0x47, 0x8E, 0xD5, 0x33, 0x34, 0x59, 0x35, 0x3B,
+    0x0A, 0x7D, 0x5F, 0xC7, 0x7F, 0xE1, 0x78, 0x7A, 0x56, 0x19, 0x7D, 0x81, 0x12, 0xC3, 0xF4, 0x3F,
+    0x3C, 0x10, 0xC1, 0xC2, 0x29, 0x41, 0x35, 0xD0, 0x05, 0x0D, 0x5C, 0xB4, 0x9F, 0x83, 0x61, 0x04,
+    0x41, 0xAD, 0x43, 0xEC, 0x60, 0xBD, 0x0D, 0xF9, 0x59, 0x6E, 0x86, 0xF3, 0xC6, 0x4E, 0x6A, 0xA7,
+    0x97, 0x8D, 0x07, 0x38, 0x8F, 0x7C, 0x3F, 0x25, 0xE3, 0x97, 0x51, 0xEC, 0xFF, 0x03, 0xDD, 0x5C,
+    0x3F, 0x90, 0xDD, 0xC6, 0x79, 0x5F, 0x00, 0xBC, 0xC3, 0xF8, 0x50, 0x80, 0x05, 0x69, 0x4D, 0xC8,
+    0x19, 0x23, 0x45, 0x0A, 0x9B, 0x91, 0x89, 0x56, 0x85, 0x24, 0x20, 0xD1, 0x8C, 0x55, 0xA4, 0x61,
+    0x71, 0x8F, 0x2A, 0x58, 0x48, 0x45, 0x0A, 0x5B, 0x45, 0xD8, 0xB8, 0x48, 0x41, 0x1E, 0x10, 0xBB,
+    0x48, 0xA1, 0x42, 0xD7, 0x30, 0x45, 0xD2, 0xB0, 0x50, 0x71, 0x3C, 0x15, 0x49, 0x91, 0x42, 0x33,
+    0x16, 0x0F, 0xC8, 0xA4, 0x74, 0x21, 0x78, 0x9C, 0x99, 0x94, 0x86, 0xC7, 0x54, 0x32, 0x76, 0x23,
+    0x58, 0x7E, 0x8E, 0x40, 0x11, 0xC0, 0xE6, 0xFB, 0xFD, 0x76, 0x81, 0xF7, 0xDE, 0xF1, 0x28, 0x1E,
+    0xC9, 0xBB, 0xE3, 0x9D, 0xDF, 0x3D, 0x7C, 0x78, 0xF7, 0x1E, 0xB0, 0xFB, 0x7D, 0xDF, 0xEE, 0x7E,
+    0xFF, 0x17, 0x6A, 0x6D, 0x36, 0x4B, 0x95, 0x0A, 0xB4, 0xAE, 0x46, 0xE8, 0xF0, 0x9B, 0x95, 0x57,
+    0x50, 0x03, 0x86, 0x0D, 0x60, 0x34, 0x07, 0x4C, 0x3A, 0xC0, 0x37, 0x09, 0xEF, 0x6F, 0x01, 0x76,
+    0x89, 0x00, 0xA7, 0x4B, 0xE4, 0x5E, 0x6F, 0x1E, 0x95, 0x02, 0x9B, 0xB0, 0xC4, 0xAD, 0xB8, 0x39,
+    0xAC, 0x7C, 0xB9, 0x39, 0x2A, 0x3D, 0xB9, 0x39, 0xCE, 0xDD, 0x56, 0x1A, 0x90, 0x6B, 0x95, 0x2A,
+    0x66, 0xB3, 0x5E, 0x29, 0x2D, 0x2F, 0xE5, 0x10, 0xBA, 0xC3, 0xEE, 0x6E, 0x91, 0xE3, 0xB2, 0xA8,
+    0xC4, 0x2D, 0x61, 0x15, 0xCA, 0xED, 0x41, 0x83, 0x06, 0xFD, 0x26, 0x46, 0xB3, 0x2D, 0xBA, 0x70,
+    0xBB, 0x0C, 0x9D, 0xF6, 0x03, 0xE0, 0xA0, 0x66, 0xB3, 0x4D, 0x34, 0xD3, 0x59, 0xC0, 0x7F, 0xCD,
+    0x6B, 0x26, 0x47, 0xA6, 0xE7, 0xCA, 0xD3, 0x7A, 0x50, 0xEE, 0xC3, 0x1F, 0x68, 0xA5, 0x72, 0x95,
+    0xE4, 0xF2, 0x2D, 0x1A, 0x53, 0x68, 0x57, 0x85, 0xF6, 0xD3, 0x25, 0xAD, 0x4B, 0xA0, 0x51, 0x06,
+    0xC3, 0x9D, 0xA8, 0x8C, 0x6B, 0xF9, 0x4E, 0xAE, 0x14, 0x90, 0x0A, 0xC8, 0x70, 0x87, 0x7C, 0x4A,
+    0xCA, 0x44, 0x2E, 0x2A, 0xE3, 0x3F, 0xBE, 0xFB, 0x45, 0x19, 0x6A, 0xFD, 0x41, 0xE9, 0xEA, 0x3E,
+    0x28, 0xD5, 0x1A, 0x78, 0x16, 0x28, 0x07, 0xD8, 0xE6, 0x9E, 0x40, 0xFF, 0xF3, 0x9B, 0xD2, 0xAC,
+    0xAB, 0x35, 0x7E, 0x28, 0x7A, 0xE0, 0xE2, 0x28, 0x75, 0xD6, 0x18, 0x5B, 0xAB, 0x57, 0x95, 0x6A,
+    0xD4, 0xEB, 0x4A, 0xED, 0x5D, 0x47, 0xE3, 0xBA, 0xC1, 0x34, 0x01, 0xFB, 0xCE, 0xAB, 0x97, 0xC2,
+    0xE2, 0xD3, 0xCF, 0x32, 0xBC, 0x88, 0x97, 0x47, 0x4C, 0x83, 0x92, 0xF8, 0xE6, 0x84, 0xA4, 0x20,
+    0x34, 0xDF, 0x68, 0x5E, 0xA3, 0x4F, 0x9E, 0x8B, 0xC4, 0xE5, 0x4D, 0xF4, 0xF9, 0x29, 0x40, 0x3B,
+    0x21, 0x4C, 0x0E, 0x62, 0x84, 0x55, 0xD2, 0x8C, 0x68, 0x5D, 0xBA, 0x4B, 0x16, 0x13, 0xE5, 0x8C,
+    0xE8, 0x73, 0x2A, 0x7B, 0xBC, 0xC1, 0xAF, 0x0E, 0x9E, 0xD6, 0x37, 0xF5, 0x03, 0x4A, 0x13, 0x99,
+    0xFB, 0x89, 0xE1, 0x67, 0xA5, 0xFE, 0x4E, 0x79, 0xE4, 0x4D, 0xC0, 0xFE, 0x42, 0xF2, 0x86, 0x94,
+    0x19, 0x22, 0x6D, 0xE3, 0xE4, 0xA4, 0x2A, 0x0E, 0x01, 0xCD, 0xF5, 0xE6, 0x5E, 0x83, 0x5E, 0x5C,
+    0x2D, 0x66, 0x86, 0x4F, 0x2C, 0x5D, 0x99, 0xA9, 0x6B, 0x72, 0xC3, 0xF0, 0xB1, 0xFC, 0x1B, 0x6B,
+    0xDD, 0x73, 0x41, 0x02, 0x81, 0x35, 0x0A, 0x88, 0x0D, 0x21, 0x2E, 0xAA, 0x4D, 0x2B, 0x85, 0xE2,
+    0x2C, 0xC0, 0xA0, 0x39, 0x56, 0xFE, 0x39, 0x33, 0x0E, 0x89, 0xDC, 0x32, 0x0F, 0x86, 0xEB, 0x0D,
+    0xAF, 0x2C, 0x4D, 0xCF, 0x85, 0x1D, 0xEA, 0xC1, 0x32, 0xA4, 0x5F, 0xFA, 0xBF, 0xB0, 0xD8, 0xE1,
+    0xDA, 0xA8, 0x51, 0xE7, 0x83, 0xE1, 0x9F, 0xD9, 0x86, 0xB0, 0x45, 0x5A, 0xD8, 0xB4, 0xFD, 0xCA,
+    0x6F, 0xE4, 0x44, 0x62, 0xA6, 0x4D, 0xC6, 0xB9, 0x1A, 0x42, 0x0A, 0x57, 0x60, 0xAE, 0xA0, 0x7D,
+    0xED, 0x6C, 0x72, 0xD5, 0xFD, 0x48, 0x2E, 0xEF, 0xF0, 0x8B, 0x5C, 0x13, 0xE7, 0x4E, 0x17, 0xD4,
+    0x7E, 0xED, 0xB4, 0x32, 0x4B, 0x2E, 0x1C, 0x2F, 0x57, 0x1D, 0x62, 0xED, 0x13, 0xD3, 0xA0, 0x59,
+    0x7C, 0x36, 0xDF, 0xAB, 0xB3, 0x3A, 0x4B, 0x9D, 0x6D, 0xB3, 0xDC, 0xBC, 0xD6, 0x2E, 0xBB, 0xED,
+    0x05, 0x09, 0xC7, 0xC5, 0xCB, 0x8D, 0x54, 0xC9, 0x28, 0xFA, 0x35, 0x18, 0xE8, 0x74, 0x64, 0x40,
+    0x41, 0x82, 0x62, 0xCA, 0x88, 0x90, 0xAB, 0xDF, 0xB9, 0x76, 0x36, 0x39, 0xBA, 0x9E, 0xAB, 0x1D,
+    0x6F, 0x2E, 0xAC, 0xEC, 0x65, 0xB9, 0x25, 0x85, 0xC8, 0x4C, 0x41, 0x30, 0xE8, 0x16, 0x04, 0x1D,
+    0x17, 0x57, 0x77, 0xD4, 0x46, 0x0E, 0x6D, 0x03, 0xED, 0x14, 0xFE, 0x02, 0x9C, 0xF4, 0x1F, 0x81,
+    0x93, 0x60, 0x13, 0xEE, 0x27, 0x4D, 0x17, 0xF7, 0xF1, 0x34, 0xD3, 0x5F, 0xA7, 0x80, 0x20, 0x42,
+    0xA0, 0x5C, 0x9A, 0xA9, 0xB5, 0x62, 0x0E, 0x8E, 0x05, 0x3D, 0xA0, 0xA3, 0xC9, 0xBD, 0x2C, 0xCF,
+    0xC8, 0x59, 0xC0, 0xA8, 0xCA, 0xC8, 0xEB, 0x8C, 0x2B, 0x61, 0x01, 0xFD, 0x25, 0x18, 0x3C, 0x06,
+    0xCD, 0xF5, 0xE6, 0xDE, 0xA4, 0x9C, 0xDA, 0x34, 0xED, 0xB3, 0x2F, 0x07, 0xFD, 0x1A, 0x1C, 0xA0,
+    0xA5, 0x04, 0x0E, 0x66, 0x32, 0xBA, 0xDB, 0x3F, 0x62, 0xC3, 0x7B, 0x84, 0xDD, 0x02, 0xFE, 0x1E,
+    0xF4, 0xF9, 0x5F, 0xD6, 0xFC, 0x9C, 0xDB, 0x25, 0xB9, 0x76, 0x0D, 0xB0, 0xD0, 0x6F, 0x37, 0xD0,
+    0x76, 0xFF, 0xDB, 0xA8, 0xB0, 0xBF, 0x2E, 0x6A, 0x47, 0xF4, 0x58, 0xD6, 0x60, 0x64, 0xE3, 0x06,
+    0x3D, 0xCA, 0x80, 0x16, 0x84, 0x03, 0x97, 0xF3, 0xC0, 0x7B, 0xFB, 0x25, 0x38, 0x8C, 0x30, 0xE0,
+    0x95, 0xC1, 0x78, 0x17, 0x54, 0xE1, 0xD8, 0x5A, 0x38, 0xDC, 0x78, 0xC4, 0x5E, 0x7E, 0xD9, 0x00,
+    0xDD, 0xB7, 0x1A, 0x3B, 0xCA, 0xF2, 0xCD, 0x47, 0xE6, 0x04, 0xDE, 0xE3, 0xD4, 0x73, 0x75, 0xDD,
+    0x90, 0xA9, 0x8B, 0x45, 0x56, 0x54, 0x3C, 0x49, 0x3B, 0x38, 0xF9, 0x2D, 0x4F, 0x6E, 0xC7, 0x93,
+    0xD3, 0x9B, 0x75, 0x38, 0x98, 0x53, 0x31, 0x9E, 0x3E, 0x1E, 0x76, 0x73, 0x41, 0x01, 0x7A, 0x79,
+    0x3C, 0x15, 0xCA, 0x5F, 0xB9, 0x64, 0xE9, 0x3E, 0xDB, 0x8A, 0xD7, 0x2D, 0xF7, 0x60, 0xFB, 0x33,
+    0xBD, 0x5F, 0x06, 0x2E, 0x16, 0x33, 0x39, 0xD5, 0x3C, 0xFD, 0x56, 0x59, 0x86, 0x2F, 0xE4, 0xDB,
+    0x42, 0xE2, 0xF9, 0x72, 0x59, 0x6E, 0xA1, 0x33, 0xBB, 0xF1, 0xC7, 0xF1, 0x57, 0x87, 0x0C, 0xCF,
+    0x96, 0x18, 0x4E, 0xB6, 0x58, 0x86, 0x97, 0x64, 0x78, 0x7A, 0x30, 0xC3, 0x0F, 0x84, 0xCF, 0xC1,
+    0x70, 0xF1, 0x2A, 0xAE, 0xC9, 0xB7, 0x0D, 0x0E, 0x7C, 0x5E, 0x4C, 0x6F, 0xDD, 0x63, 0x32, 0xF1,
+    0xB0, 0x82, 0xE0, 0x89, 0x87, 0xD8, 0xF5, 0x72, 0x5D, 0xC7, 0x03, 0x9F, 0x9F, 0x76, 0xBD, 0x69,
+    0x7F, 0x18, 0x0F, 0xF6, 0x0B, 0x04, 0x0C, 0x58, 0x42, 0xC3, 0xD9, 0xE4, 0xA5, 0x95, 0xE2, 0x7A,
+    0x0D, 0xFA, 0x57, 0x7A, 0x59, 0x07, 0x42, 0x63, 0x02, 0x13, 0x8C, 0x06, 0x55, 0x01, 0xC3, 0x6B,
+    0x0F, 0x00, 0xB6, 0xA1, 0x05, 0xBB, 0xBB, 0xBB, 0xF9, 0xC2, 0xEA, 0x2B, 0x26, 0xF1, 0x44, 0xB9,
+    0x24, 0x2C, 0x71, 0x52, 0x5F, 0xFF, 0x53, 0x91, 0x3A, 0x94, 0x88, 0xB1, 0x7E, 0x68, 0xCC, 0x3C,
+    0x3F, 0x57, 0xFF, 0xE6, 0x95, 0x4E, 0xE3, 0x3D, 0xBC, 0x51, 0x2B, 0xCC, 0x12, 0x9A, 0x00, 0xA9,
+    0x7A, 0x19, 0x2C, 0xF1, 0x72, 0xF5, 0x63, 0xE5, 0x55, 0x62, 0xFF, 0xB9, 0x0F, 0x6F, 0x34, 0x8A,
+    0xE8, 0xA8, 0x98, 0xE4, 0x4C, 0x08, 0x9D, 0x28, 0x73, 0xA8, 0xEE, 0x30, 0x5B, 0xB1, 0x70, 0xBC,
+    0xC6, 0xFC, 0xBF, 0x22, 0x0E, 0x4F, 0x8E, 0x39, 0x46, 0xD5, 0x72, 0xCD, 0x42, 0xF9, 0x5A, 0xA3,
+    0x77, 0x15, 0x9F, 0x13, 0x65, 0xCE, 0xC9, 0x12, 0xEF, 0x62, 0x14, 0x4A, 0xE3, 0xB5, 0xC4, 0xC0,
+    0x0D, 0xFA, 0x45, 0x3E, 0x47, 0x3D, 0xD5, 0xC1, 0xC9, 0x51, 0x8F, 0xAB, 0x66, 0xED, 0xE8, 0x51,
+    0xF9, 0xE5, 0xE8, 0x4F, 0x19, 0x80, 0x7F, 0x03, 0xBD, 0xE4, 0x4B, 0x89, 0x92, 0xDD, 0xF1, 0x1B,
+    0xBF, 0x71, 0x3A, 0x71, 0x95, 0x32, 0x69, 0x3D, 0x16, 0x64, 0xC3, 0x76, 0xC5, 0x60, 0x39, 0x49,
+    0x4E, 0xC2, 0xDE, 0x50, 0x34, 0x38, 0x68, 0x71, 0xD0, 0xE4, 0xA0, 0xCD, 0x41, 0xA3, 0x63, 0x09,
+    0xAB, 0x93, 0x5D, 0x68, 0xCA, 0xDD, 0xA1, 0x7E, 0x18, 0x8C, 0x37, 0xCA, 0x3B, 0xDE, 0x85, 0x21,
+    0xD2, 0x63, 0xD9, 0x09, 0xB6, 0x1D, 0x3D, 0xA1, 0x0B, 0x8F, 0xD9, 0x78, 0x0F, 0x8D, 0xA2, 0x69,
+    0x60, 0x59, 0x89, 0x56, 0x12, 0x9B, 0xCF, 0x2F, 0x0D, 0xEF, 0xAD, 0x8D, 0xD7, 0x3C, 0x83, 0x8D,
+    0x17, 0xEB, 0x76, 0x1F, 0x94, 0xB5, 0x46, 0x67, 0xA8, 0xC5, 0xBD, 0x02, 0xE9, 0x67, 0x47, 0xD0,
+    0xD2, 0x6D, 0x48, 0x33, 0x18, 0x36, 0x9E, 0xD7, 0xC2, 0xC6, 0x93, 0x55, 0x59, 0x0C, 0xBB, 0x45,
+    0xAB, 0x22, 0x0D, 0xF3, 0xCE, 0x29, 0xB4, 0xDE, 0x36, 0xE6, 0x9B, 0x21, 0x8E, 0xB4, 0x91, 0x34,
+    0x52, 0xD6, 0x8B, 0x5C, 0x11, 0xDA, 0xBA, 0x65, 0xB2, 0xD6, 0xC0, 0xFD, 0x42, 0xF4, 0x94, 0xA8,
+    0x84, 0xDF, 0x34, 0x61, 0xFF, 0xCE, 0x23, 0xD8, 0x7B, 0x59, 0x43, 0x33, 0x84, 0xEA, 0x8D, 0x9A,
+    0x6E, 0xB0, 0xC0, 0x6F, 0xFA, 0x09, 0x0C, 0x13, 0x28, 0xAC, 0x09, 0x15, 0x36, 0x54, 0x85, 0x6C,
+    0x40, 0x9A, 0xA2, 0xB6, 0x13, 0x6D, 0x4B, 0xC5, 0x6B, 0x74, 0xB0, 0x51, 0xD6, 0x8C, 0x61, 0x60,
+    0x2A, 0x08, 0x97, 0xBE, 0x93, 0x8A, 0xE1, 0x17, 0xE9, 0x42, 0x83, 0x08, 0xD2, 0x20, 0x64, 0x3B,
+    0x95, 0x7A, 0x4D, 0x60, 0x43, 0x0F, 0x7D, 0xB8, 0x31, 0xE7, 0xBC, 0xC0, 0x4D, 0x11, 0xC7, 0x49,
+    0x1D, 0x60, 0x79, 0x9F, 0x85, 0x51, 0x71, 0x41, 0x96, 0x5B, 0xAB, 0x4F, 0x2C, 0x51, 0x05, 0x68,
+    0x32, 0x24, 0x4D, 0x14, 0x9D, 0xCE, 0x01, 0x51, 0xEA, 0x3D, 0x2E, 0x99, 0x6E, 0x01, 0x1D, 0x42,
+    0xF3, 0xFD, 0x41, 0xCE, 0xE5, 0x99, 0x58, 0x26, 0xEA, 0xEE, 0x48, 0x8F, 0xD7, 0x4D, 0x94, 0xAD,
+    0x92, 0x74, 0x5A, 0x07, 0xE4, 0x4C, 0xB1, 0xD9, 0xBE, 0xEE, 0xA9, 0x29, 0xCE, 0x66, 0xA0, 0xB3,
+    0x14, 0x29, 0xF4, 0xCA, 0x45, 0x34, 0xED, 0xCF, 0x00, 0xDE, 0x58, 0x89, 0xD1, 0xB9, 0xB4, 0x43,
+    0x9A, 0x15, 0x8D, 0x71, 0x4A, 0xC7, 0xE6, 0x0A, 0xF9, 0x5C, 0x54, 0xF4, 0x6D, 0x79, 0xDF, 0xFF,
+    0x75, 0x54, 0xD5, 0x74, 0x2D, 0x19, 0xCB, 0xBC, 0x30, 0x45, 0xD9, 0x46, 0x8D, 0x3C, 0x5D, 0x10,
+    0x3D, 0x2F, 0x9C, 0xCD, 0x66, 0x37, 0xCB, 0x8C, 0x4A, 0xD1, 0x42, 0x51, 0x8D, 0xFF, 0xFA, 0x62,
+    0x6D, 0x2E, 0xC1, 0x03, 0xC8, 0xFA, 0xF2, 0x1B, 0xC9, 0xBA, 0x44, 0x98, 0xA4, 0x87, 0x87, 0x17,
+    0xA1, 0xAA, 0xDE, 0x86, 0xC7, 0x97, 0xDC, 0x64, 0x14, 0xA5, 0xB8, 0x53, 0x88, 0x7F, 0x30, 0x47,
+    0x94, 0x32, 0xA9, 0xE1, 0x71, 0xC9, 0x04, 0xF4, 0x09, 0x3D, 0xFA, 0x5D, 0x0B, 0x98, 0xBE, 0x20,
+    0xA4, 0x38, 0x33, 0x91, 0x70, 0x78, 0xFA, 0x2B, 0xA7, 0xEB, 0xBD, 0xB0, 0x36, 0xDB, 0xD4, 0x2B,
+    0x2F, 0x7E, 0x59, 0xCC, 0x0E, 0xBC, 0xC1, 0xE1, 0x6F, 0x26, 0x8E, 0xAE, 0xA7, 0xD3, 0x20, 0xC3,
+    0x51, 0x1C, 0xDC, 0xC3, 0x8B, 0x9E, 0xEE, 0x2E, 0x82, 0xD2, 0x16, 0x72, 0xF1, 0x17, 0x30, 0xA4,
+    0x2C, 0x7C, 0xE5, 0x21, 0xDC, 0xBD, 0x95, 0x6B, 0xE6, 0xEB, 0xF7, 0x00, 0xA1, 0x86, 0xBC, 0xAF,
+    0x30, 0x7F, 0x3D, 0xFD, 0x40, 0xD6, 0x33, 0xC4, 0x87, 0x38, 0xE9, 0x3D, 0x3D, 0xF6, 0x0E, 0x5C,
+    0xF1, 0xDA, 0xC7, 0xE0, 0xFC, 0xF9, 0xA1, 0xB8, 0x34, 0xEF, 0x85, 0x83, 0x6A, 0x62, 0x59, 0x5E,
+    0x6F, 0x44, 0xBA, 0xFA, 0x7B, 0x47, 0xA7, 0xE7, 0x97, 0x96, 0x82, 0xC8, 0x33, 0x44, 0xD1, 0x64,
+    0x35, 0x3D, 0x34, 0x81, 0xFF, 0xA3, 0x3E, 0x6E, 0x3E, 0x98, 0xFA, 0x50, 0x9B, 0xEA, 0x2F, 0x7C,
+    0x9D, 0x7E, 0x12, 0xEA, 0xFF, 0x69, 0xAE, 0x06, 0xBA, 0x7E, 0x5D, 0xD6, 0xF3, 0x8A, 0xC9, 0x87,
+    0x85, 0x7E, 0x84, 0xC7, 0xC5, 0xD9, 0x2C, 0xD1, 0x5A, 0xDE, 0xF2, 0xC1, 0x74, 0x10, 0xE9, 0x2E,
+    0xD6, 0xDD, 0xBA, 0x08, 0xEE, 0x4C, 0xBD, 0xC8, 0xDB, 0x29, 0xB6, 0x4D, 0x53, 0x62, 0xA2, 0x8B,
+    0x75, 0x2F, 0xEF, 0x8B, 0x53, 0x1A, 0xB0, 0x7F, 0xFE, 0xF7, 0x8F, 0x55, 0xA0, 0x6E, 0xA9, 0x48,
+    0x25, 0x77, 0xF6, 0x80, 0xAA, 0x30, 0x4E, 0xC4, 0xDF, 0xB9, 0x05, 0x7F, 0xF0, 0x9D, 0x74, 0xAA,
+    0x40, 0x80, 0x3A, 0x94, 0x6B, 0xF0, 0x6C, 0x87, 0x90, 0x35, 0xF5, 0xF1, 0xAA, 0xF2, 0xD3, 0x37,
+    0xC4, 0x1F, 0x8B, 0xEE, 0x14, 0x62, 0xD6, 0xF6, 0xE2, 0x27, 0x34, 0x2B, 0xB8, 0x50, 0x8E, 0x1C,
+    0xE1, 0x91, 0xE9, 0xA6, 0xD0, 0xCD, 0x65, 0xBD, 0x2D, 0xCB, 0xEC, 0x45, 0xDE, 0xEB, 0x43, 0x6A,
+    0x9A, 0x82, 0xCB, 0x26, 0xAE, 0xE4, 0x2D, 0x6A, 0xBF, 0x96, 0xB0, 0x68, 0x10, 0x7E, 0x12, 0xF5,
+    0x96, 0x87, 0x75, 0xD8, 0x84, 0xB5, 0x9B, 0x8E, 0xF3, 0xEE, 0x70, 0x7F, 0x41, 0x1E, 0x4B, 0x7B,
+    0x9D, 0xB4, 0xD6, 0x49, 0x5B, 0x6C, 0xEA, 0x6F, 0xD1, 0xA7, 0xDB, 0x53, 0x38, 0xBC, 0xB7, 0x1C,
+    0x3A, 0x38, 0x6A, 0x6A, 0xFA, 0x03, 0x5E, 0xF2, 0x93, 0x2B, 0x12, 0xA5, 0xF1, 0x5A, 0xE9, 0xC9,
+    0x6B, 0xE5, 0xFA, 0x93, 0x01, 0x82, 0x95, 0x98, 0x2A, 0xE8, 0x97, 0x9D, 0xAF, 0xC4, 0x2C, 0xA8,
+    0xB6, 0xC5, 0x13, 0x54, 0x09, 0xA2, 0x9D, 0x09, 0x1D, 0xA2, 0xD6, 0x3A, 0xCB, 0x22, 0x8D, 0x92,
+    0xDC, 0x9B, 0x27, 0xA5, 0x3F, 0x97, 0x73, 0xF3, 0xAD, 0x7D, 0x01, 0x97, 0x24, 0xF5, 0x9A, 0xA3,
+    0x3C, 0x8C, 0x09, 0xB3, 0x7C, 0x30, 0xB5, 0xDA, 0xC8, 0x1C, 0xAF, 0xE4, 0xC8, 0x55, 0xD8, 0xDB,
+    0xBC, 0x1C, 0xC4, 0x2C, 0x56, 0x60, 0x96, 0x22, 0x87, 0x1B, 0x96, 0x5E, 0xB3, 0x92, 0x13, 0xF3,
+    0x6B, 0x13, 0xF3, 0x3C, 0xB1, 0xA3, 0x36, 0x32, 0x4C, 0x54, 0x2F, 0xC2, 0xAB, 0x08, 0x4A, 0x14,
+    0x0F, 0x2C, 0x2E, 0xC0, 0x37, 0x86, 0xA2, 0xC1, 0xFC, 0x28, 0x98, 0x1C, 0x0E, 0x73, 0x7F, 0x15,
+    0xDF, 0x23, 0x96, 0xA3, 0x07, 0x1E, 0x62, 0xE5, 0x26, 0x82, 0x5B, 0x22, 0x62, 0x3D, 0x6E, 0x8D,
+    0xF4, 0x60, 0x8A, 0xC0, 0x6F, 0x19, 0xA9, 0xAD, 0x01, 0x13, 0x04, 0xA7, 0x95, 0xC6, 0xAF, 0xD0,
+    0x6D, 0x19, 0x89, 0xCB, 0x68, 0x20, 0x67, 0x0A, 0x91, 0x89, 0xCC, 0x41, 0x6C, 0x27, 0x63, 0xE0,
+    0x3A, 0x43, 0xEE, 0x43, 0x65, 0x49, 0x6D, 0x93, 0xD3, 0x02, 0x1F, 0x51, 0xE3, 0xFE, 0x42, 0x53,
+    0x3A, 0x21, 0x65, 0x91, 0xA9, 0xA4, 0x02, 0x0C, 0xD9, 0x8E, 0xCF, 0x7E, 0xDD, 0x5E, 0x4D, 0xBD,
+    0xD8, 0x1E, 0x23, 0xF6, 0x1E, 0x30, 0x71, 0x21, 0x1D, 0x43, 0xBA, 0xE9, 0x7D, 0x3E, 0xD3, 0xFB,
+    0x84, 0x7B, 0x4B, 0x36, 0x32, 0x27, 0xA9, 0x4B, 0x0B, 0xDE, 0x33, 0xB9, 0x66, 0x48, 0x87, 0x1F,
+    0x4E, 0x69, 0xE8, 0x43, 0x01, 0x67, 0x10, 0x20, 0x78, 0xF5, 0xE0, 0x40, 0x0F, 0x7B, 0xA9, 0x47,
+    0xA8, 0xA4, 0x07, 0xF9, 0x3D, 0xB0, 0xEE, 0x61, 0xD5, 0xF7, 0x4C, 0xED, 0xC0, 0x7C, 0x65, 0xA8,
+    0x5D, 0x7F, 0x20, 0xD4, 0x0E, 0xBC, 0x04, 0x78, 0x0A, 0x1B, 0x71, 0x5B, 0x5C, 0xA1, 0x15, 0x24,
+    0x20, 0xE4, 0x17, 0xDB, 0x32, 0x99, 0x36, 0xBD, 0x36, 0xB6, 0xA7, 0x3C, 0x3D, 0x73, 0xF7, 0x6A,
+    0xCC, 0xB5, 0xBF, 0xAE, 0x96, 0x8B, 0x26, 0x06, 0xDC, 0x3B, 0x00, 0xAB, 0xC1, 0x44, 0xDC, 0x05,
+    0x85, 0x01, 0x1D, 0x0D, 0x60, 0xDD, 0x00, 0xE6, 0x0F, 0xE0, 0xFD, 0x00, 0xB7, 0x63, 0x40, 0x50,
+    0xD6, 0x60, 0xF5, 0xDF, 0xF2, 0x83, 0xFE, 0xEB, 0x4E, 0xD9, 0x8B, 0x81, 0xD5, 0x00, 0xAC, 0x6C,
+    0x2B, 0x82, 0x95, 0x6D, 0x59, 0xB0, 0x72, 0x76, 0x8D, 0x57, 0x87, 0xC6, 0x38, 0x73, 0x05, 0xCF,
+    0xDB, 0x2B, 0x95, 0x1B, 0xC7, 0xA2, 0xB0, 0x9E, 0x1C, 0x51, 0xDC, 0x05, 0x6A, 0x82, 0x91, 0xCC,
+    0x38, 0xE1, 0x50, 0x32, 0x26, 0x84, 0x2F, 0x11, 0xB5, 0x23, 0x7F, 0x9F, 0x28, 0x69, 0x53, 0x08,
+    0xEF, 0x23, 0x9B, 0xAC, 0x6D, 0x4C, 0x75, 0x44, 0x60, 0xE3, 0xA7, 0xE7, 0x40, 0x66, 0x92, 0x3E,
+    0xDF, 0x9F, 0x09, 0x6A, 0x86, 0x65, 0x24, 0xAA, 0xEE, 0x0D, 0x51, 0x76, 0xE7, 0xD1, 0xFF, 0x56,
+    0x06, 0xD9, 0x28, 0x0B, 0x45, 0x8E, 0x56, 0xAC, 0x1F, 0xF1, 0xE0, 0xDC, 0xEA, 0x38, 0x68, 0xFB,
+    0xE1, 0xFA, 0x76, 0x1F, 0x56, 0x7D, 0x58, 0xF6, 0x61, 0xDE, 0x47, 0xAA, 0xBF, 0xAA, 0xFA, 0x0B,
+    0x2F, 0x62, 0x50, 0xD9, 0xF7, 0xB3, 0xA1, 0xB4, 0x9E, 0x66, 0xF4, 0xC3, 0x90, 0xDF, 0xC4, 0x79,
+    0xFD, 0xD9, 0x48, 0x38, 0x0C, 0x4A, 0x1B, 0x22, 0x07, 0x72, 0xFB, 0xFE, 0xD6, 0xA1, 0x48, 0xA0,
+    0xF3, 0xF1, 0x8C, 0xC0, 0xCF, 0x51, 0x98, 0x54, 0xCA, 0x4A, 0x40, 0x8E, 0x0E, 0x39, 0x69, 0x66,
+    0x7F, 0x19, 0x4F, 0xCF, 0xBA, 0xB1, 0x9A, 0xE9, 0xE2, 0x37, 0xB7, 0x82, 0xF8, 0xC2, 0x02, 0xA8,
+    0x1D, 0x8A, 0xCB, 0x6F, 0x7A, 0x9F, 0x57, 0xFD, 0x5C, 0x89, 0x01, 0xA9, 0x6B, 0x57, 0xA7, 0x61,
+    0x87, 0x4E, 0xAE, 0x76, 0x4F, 0xBB, 0x4B, 0x04, 0x32, 0x1D, 0x5E, 0x8A, 0x69, 0x67, 0xA9, 0xEC,
+    0x87, 0xBE, 0xBF, 0x8A, 0x38, 0x2F, 0xCF, 0xED, 0x4F, 0x57, 0x23, 0x4C, 0x52, 0x67, 0x15, 0xD3,
+    0xCC, 0xD4, 0xEE, 0x59, 0x4B, 0xC8, 0xA0, 0xC3, 0x96, 0x26, 0x94, 0x8B, 0x04, 0xC6, 0x70, 0x65,
+    0xB7, 0x44, 0x6E, 0x09, 0x14, 0x41, 0x28, 0xD0, 0xED, 0x00, 0xA5, 0x43, 0xA4, 0xA8, 0xB3, 0x14,
+    0x50, 0xEC, 0x12, 0x81, 0x61, 0x0D, 0xE8, 0xCF, 0x01, 0xBD, 0x8E, 0x09, 0xEC, 0xC1, 0x03, 0x2C,
+    0xDE, 0x02, 0x4C, 0xFE, 0x13, 0x30, 0xFA, 0x0D, 0x60, 0xF0, 0x15, 0xA0, 0xA7, 0x1B, 0xA6, 0xAE,
+    0x99, 0xD8, 0x2E, 0x08, 0x13, 0x42, 0x58, 0x41, 0x2C, 0xBF, 0x89, 0xEB, 0x31, 0x20, 0x84, 0xD5,
+    0xEB, 0x4C, 0xE9, 0x85, 0x25, 0xFF, 0x5D, 0x1C, 0x94, 0x2E, 0x12, 0xAD, 0xD7, 0x15, 0x62, 0x6B,
+    0x0F, 0xFD, 0x75, 0xAD, 0x90, 0xF9, 0xCE, 0x65, 0xE0, 0xE2, 0x52, 0x33, 0x08, 0x0F, 0x51, 0x3F,
+    0x4C, 0xA0, 0x7F, 0x3E, 0x70, 0x16, 0x58, 0xB6, 0xFC, 0x5A, 0xDF, 0x5E, 0x4C, 0x02, 0x53, 0xCB,
+    0x66, 0xA6, 0x02, 0x75, 0x9D, 0x09, 0x5A, 0x59, 0x1D, 0x73, 0x42, 0x0C, 0x5C, 0x46, 0x6E, 0x67,
+    0x1C, 0xCC, 0x45, 0xB8, 0x8C, 0x09, 0xA3, 0x20, 0x1F, 0x63, 0x6B, 0xDF, 0x63, 0xF2, 0x3C, 0xCA,
+    0x4D, 0x19, 0x1F, 0xB4, 0xBE, 0x3B, 0x70, 0xB6, 0x17, 0xA4, 0x33, 0x21, 0x5D, 0x6B, 0xE9, 0x59,
+    0x9B, 0xD6, 0x1B, 0xCC, 0x32, 0x35, 0xA0, 0xB8, 0x47, 0x7C, 0x32, 0x2B, 0x6C, 0xAA, 0xCE, 0xC4,
+    0x41, 0x97, 0x72, 0x5F, 0x27, 0x34, 0x2A, 0x56, 0x4A, 0x18, 0x58, 0x2E, 0x05, 0x61, 0x4D, 0xAC,
+    0x8B, 0xA8, 0x6C, 0x31, 0x84, 0x79, 0x3B, 0xFC, 0x89, 0xA8, 0xD0, 0x4F, 0xC3, 0xCF, 0xB4, 0x2E,
+    0xAF, 0x85, 0xFA, 0x0E, 0xCA, 0x08, 0x3A, 0x98, 0x8A, 0xC2, 0x44, 0x71, 0x62, 0xC4, 0x6A, 0x73,
+    0x5B, 0xCC, 0x37, 0xE1, 0xA3, 0x0C, 0xF6, 0xD1, 0xC1, 0x43, 0x0D, 0x6A, 0x62, 0x06, 0xB5, 0x5A,
+    0x0C, 0xAA, 0x67, 0x06, 0xB5, 0x5F, 0x1A, 0xD4, 0x24, 0x07, 0x8C, 0x2A, 0x0E, 0x6A, 0xC3, 0xE1,
+    0x6C, 0x01, 0x9D, 0x9E, 0x83, 0x5A, 0x70, 0x50, 0x93, 0x9F, 0x72, 0x38, 0x7F, 0xC9, 0xE1, 0xFC,
+    0xC3, 0x53, 0x86, 0x33, 0xDB, 0x57, 0xC4, 0xE6, 0xD7, 0xFB, 0xCA, 0xA7, 0x34, 0x23, 0xAD, 0xC6,
+    0xF4, 0xD0, 0x0F, 0x1E, 0x1F, 0xDC, 0x4C, 0x7E, 0x1A, 0x86, 0xEB, 0x3A, 0x3D, 0xAE, 0x25, 0x77,
+    0x10, 0xE0, 0x38, 0xC3, 0x9A, 0x36, 0x3E, 0x26, 0x90, 0x83, 0x5F, 0x64, 0x2B, 0x2D, 0x58, 0x75,
+    0x31, 0x9D, 0x96, 0xAB, 0x40, 0x16, 0xF6, 0x53, 0x81, 0x98, 0x39, 0x82, 0xC9, 0xBD, 0x09, 0xDF,
+    0x09, 0xE2, 0x88, 0xAD, 0xCB, 0xF0, 0xF8, 0x1D, 0xA7, 0x32, 0x0C, 0x76, 0xB1, 0x21, 0x39, 0xAF,
+    0x06, 0x93, 0xE3, 0x2C, 0x8C, 0x1C, 0xCF, 0x52, 0x93, 0xF6, 0xCC, 0x0B, 0x53, 0x1B, 0x66, 0x0A,
+    0xD6, 0x9E, 0x7E, 0x32, 0xB5, 0x4E, 0x72, 0x1F, 0x67, 0xA6, 0x18, 0x5C, 0xA6, 0xCD, 0xD8, 0xF4,
+    0x80, 0xFE, 0x30, 0xD6, 0xA6, 0x77, 0x51, 0x9F, 0xC0, 0x05, 0xA5, 0x65, 0x30, 0xCA, 0x23, 0x63,
+    0xFB, 0x39, 0x34, 0xCE, 0x6D, 0x02, 0xF7, 0xC9, 0xC5, 0xE8, 0xCE, 0xCC, 0xE6, 0xF1, 0x5C, 0x90,
+    0x17, 0x60, 0x70, 0x10, 0xD7, 0x2D, 0xA5, 0x43, 0xD6, 0x5E, 0x05, 0x90, 0x46, 0xDE, 0x7C, 0x18,
+    0x41, 0xDB, 0x4F, 0x80, 0xFF, 0xEE, 0xE1, 0x07, 0x4C, 0x1B, 0xF1, 0xA4, 0xE5, 0xE2, 0x18, 0xB7,
+    0x85, 0x68, 0xC0, 0x97, 0xA6, 0x80, 0x04, 0xAB, 0xDD, 0x80, 0x09, 0x7A, 0xF4, 0x72, 0xF5, 0xEF,
+    0xC6, 0x6F, 0x62, 0x78, 0x85, 0xE5, 0x1D, 0xB6, 0xC0, 0x63, 0x2C, 0xF1, 0x58, 0xAE, 0x3A, 0xF9,
+    0x53, 0x1A, 0x02, 0xA7, 0x52, 0xAF, 0x22, 0x7B, 0x7A, 0x4B, 0xEE, 0x46, 0xD9, 0x7A, 0x86, 0x09,
+    0x17, 0xAD, 0x96, 0xAD, 0x9F, 0xEC, 0x60, 0xA8, 0x2B, 0xFF, 0xC0, 0x6C, 0x7B, 0xC6, 0x34, 0x1B,
+    0x33, 0xD1, 0x42, 0x53, 0xCB, 0x45, 0xE3, 0xD5, 0xA8, 0xAA, 0x50, 0x61, 0x7E, 0x9B, 0x9A, 0x67,
+    0xC5, 0x3F, 0xFB, 0x13, 0x5A, 0x16, 0x1B, 0xDB, 0xBB, 0x68, 0x14, 0xA6, 0x3F, 0x8A, 0xEE, 0xC1,
+    0x02, 0x77, 0x2E, 0x0C, 0xF0, 0xAA, 0x18, 0x9A, 0xF9, 0xDC, 0x4B, 0x1A, 0x98, 0x05, 0x87, 0x35,
+    0xD2, 0x04, 0x11, 0x73, 0x15, 0x2D, 0x79, 0x2C, 0x67, 0x57, 0xF8, 0x0E, 0x6E, 0x80, 0xCE, 0xC2,
+    0x66, 0x13, 0x0B, 0xAB, 0xD6, 0x0A, 0x2B, 0xEB, 0x0A, 0x35, 0x55, 0x90, 0x4F, 0x35, 0xA2, 0x2B,
+    0x87, 0x08, 0xBA, 0xC2, 0x0C, 0x5B, 0xB3, 0x72, 0x1E, 0xBF, 0x5F, 0x3A, 0x32, 0x7B, 0x4E, 0xD2,
+    0xD5, 0xF6, 0xC7, 0xFE, 0xC6, 0xFE, 0x47, 0x7C, 0xC0, 0x78, 0x8E, 0x16, 0x38, 0x0F, 0xBC, 0x47,
+    0xFC, 0x5D, 0x7B, 0xB6, 0xCC, 0xE7, 0x69, 0x8D, 0x85, 0xA4, 0x95, 0xC3, 0xC8, 0xB1, 0x6E, 0x43,
+    0x99, 0x45, 0x41, 0xFF, 0xCE, 0x10, 0x7F, 0x7E, 0xB3, 0x96, 0xF6, 0x33, 0x14, 0x2B, 0x22, 0x03,
+    0xD8, 0x99, 0x1D, 0x0D, 0xA1, 0x09, 0x66, 0x41, 0x0F, 0x73, 0x6F, 0x83, 0x3F, 0x9E, 0xA5, 0xDD,
+    0xA1, 0x5F, 0x3A, 0x7F, 0xBD, 0xBB, 0x7B, 0x6F, 0xB0, 0x7A, 0xCA, 0x5E, 0xC7, 0xF2, 0xC0, 0xD6,
+    0xA8, 0xF9, 0xB0, 0x33, 0xFC, 0x61, 0xC5, 0x0B, 0xA2, 0x40, 0x45, 0xAE, 0x2E, 0x04, 0x83, 0xF4,
+    0xFB, 0xF0, 0x06, 0x1C, 0x98, 0x36, 0x00, 0x9E, 0xB1, 0xA8, 0xA9, 0xC2, 0xD6, 0xC9, 0xD2, 0x56,
+    0xA1, 0x91, 0x1E, 0x4D, 0x46, 0x7A, 0x31, 0x3A, 0x3F, 0xFB, 0x8D, 0x74, 0x4E, 0x96, 0xDF, 0x22,
+    0x56, 0xAD, 0x4D, 0x71, 0x2A, 0xBC, 0x45, 0x9D, 0x67, 0x76, 0x02, 0x73, 0xCA, 0xD8, 0x79, 0x03,
+    0x30, 0xFD, 0x1B, 0x56, 0xF6, 0x12, 0x47, 0xA7, 0xAC, 0xAE, 0xCD, 0x30, 0x5B, 0x33, 0xAC, 0x2C,
+    0x68, 0x72, 0x13, 0x18, 0x83, 0x1E, 0x47, 0x38, 0xAB, 0x33, 0xD1, 0xAC, 0x8C, 0xAB, 0x69, 0xB9,
+    0x65, 0x36, 0xEA, 0x75, 0x26, 0xD2, 0xE6, 0xDC, 0xB3, 0xD1, 0x8D, 0x88, 0xD1, 0x8D, 0x4F, 0xA7,
+    0xF0, 0xDF, 0xAC, 0x0B, 0x74, 0x97, 0x0C, 0x9D, 0xBE, 0x27, 0x38, 0xCA, 0x02, 0x91, 0x41, 0x63,
+    0xF4, 0x86, 0x61, 0xA8, 0xA7, 0x3A, 0xCA, 0xA7, 0x84, 0xBA, 0xA5, 0xD7, 0x8F, 0xA6, 0xE8, 0x5A,
+    0x37, 0xE6, 0xB0, 0x19, 0xA4, 0x63, 0x8C, 0xCE, 0x24, 0xB0, 0x2F, 0xA6, 0x89, 0xAB, 0xCB, 0x24,
+    0xD4, 0x79, 0x92, 0xFC, 0x2E, 0x45, 0x20, 0x17, 0x7B, 0x4A, 0x92, 0xCA, 0x9A, 0x07, 0xB9, 0x3D,
+    0x9E, 0x21, 0x1F, 0x31, 0x45, 0xD8, 0x72, 0x63, 0x67, 0x40, 0x68, 0x26, 0xD6, 0xE1, 0xF8, 0xC4,
+    0x4A, 0xF6, 0x43, 0x97, 0x5A, 0x9D, 0xA2, 0x69, 0xF3, 0x3D, 0xC1, 0x3A, 0x96, 0xBF, 0xA0, 0xDE,
+    0x53, 0xDE, 0xA3, 0xD6, 0xEC, 0xC0, 0x01, 0x93, 0xD6, 0x46, 0x44, 0x8F, 0x83, 0x97, 0xA6, 0x3E,
+    0xAA, 0x1D, 0x6D, 0x4A, 0x9A, 0x94, 0xD9, 0x14, 0x72, 0x5D, 0x35, 0xCC, 0x2E, 0xA3, 0xC8, 0x02,
+    0xF9, 0x74, 0x2C, 0xF9, 0x32, 0x6C, 0xD5, 0xE5, 0x34, 0xAA, 0xC6, 0x9B, 0xE2, 0x7C, 0x02, 0xE5,
+    0xB8, 0x62, 0xB9, 0xE4, 0x3D, 0xAA, 0x2C, 0x2A, 0x82, 0x08, 0x0B, 0xDB, 0xA1, 0xEE, 0x0A, 0xCC,
+    0x7E, 0xB8, 0x72, 0x74, 0x0D, 0xD8, 0x3B, 0x0D, 0x5D, 0x02, 0xFE, 0x1B, 0x55, 0xAF, 0x09, 0x32,
+    0x65, 0xF2, 0xF5, 0xC7, 0x1A, 0xFB, 0x08, 0x3A, 0x41, 0x00, 0x31, 0x12, 0x16, 0x3B, 0xA8, 0x4B,
+    0xDB, 0x93, 0x54, 0xE4, 0x7E, 0x9D, 0xC6, 0x04, 0xD9, 0x46, 0x66, 0xAD, 0x6D, 0x42, 0xC4, 0x3F,
+    0x80, 0x4C, 0x89, 0x3F, 0xFF, 0x36, 0x54, 0xC0, 0xF9, 0xC4, 0xBA, 0x1B, 0xAC, 0xCB, 0x87, 0x81,
+    0x8F, 0xC6, 0x0A, 0xD4, 0x44, 0xE0, 0x43, 0x36, 0x37, 0xD2, 0x94, 0xC2, 0x05, 0x18, 0x76, 0x7F,
+    0x2E, 0x03, 0x97, 0xDC, 0x79, 0x77, 0x2E, 0x5D, 0xD7, 0x97, 0x81, 0x3F, 0xB2, 0xF2, 0x2C, 0xDD,
+    0x60, 0x5D, 0x49, 0xC0, 0x12, 0xD9, 0x9F, 0x37, 0x46, 0x8F, 0x89, 0xAF, 0xB9, 0x05, 0x33, 0x6A,
+    0xED, 0xB4, 0x32, 0x6C, 0xCC, 0x4D, 0x64, 0xCC, 0xA5, 0xA8, 0xC7, 0x72, 0x29, 0xC7, 0xC6, 0xB0,
+    0x53, 0xC4, 0x88, 0xF5, 0x49, 0x38, 0x71, 0xC6, 0x3B, 0x8C, 0x68, 0xD1, 0xE8, 0x62, 0xE4, 0x22,
+    0x1B, 0xB7, 0x61, 0x25, 0x0F, 0x8E, 0x89, 0x21, 0xAF, 0x54, 0x26, 0x02, 0x01, 0x24, 0xD7, 0x3B,
+    0x9B, 0x12, 0xC0, 0x71, 0x9F, 0x49, 0x23, 0xD4, 0x94, 0x38, 0x77, 0xD5, 0x15, 0xDC, 0x8E, 0xD5,
+    0xFD, 0x16, 0x22, 0xF6, 0x5F, 0xC0, 0x2F, 0x85, 0xCD, 0xEA, 0x12, 0xDD, 0xCD, 0xD3, 0xBA, 0x24,
+    0x37, 0x52, 0xE7, 0x2E, 0x76, 0x56, 0xBA, 0xAD, 0x74, 0x39, 0x0C, 0x26, 0x82, 0x09, 0x3B, 0x65,
+    0x54, 0xD2, 0xC7, 0x34, 0xC3, 0x58, 0xE2, 0x93, 0x16, 0x4B, 0x70, 0xB5, 0xB4, 0xEB, 0x34, 0xC0,
+    0xAB, 0x6A, 0x4A, 0xFD, 0xD8, 0x34, 0x11, 0x07, 0xC3, 0xA6, 0xB4, 0x9C, 0x85, 0x7F, 0xEF, 0x71,
+    0x0B, 0x90, 0xD9, 0x29, 0xF5, 0x5D, 0x5B, 0xF5, 0xD5, 0x99, 0xC3, 0xE5, 0x5E, 0x3A, 0x51, 0x4D,
+    0x72, 0xBC, 0xD2, 0xCF, 0x52, 0xD7, 0x7E, 0x77, 0xD8, 0x03, 0x5C, 0xA4, 0xFA, 0xD6, 0x77, 0xC0,
+    0xB4, 0x9C, 0x8E, 0x90, 0xF7, 0x5F, 0xB6, 0xB6, 0x1B, 0x13, 0xB2, 0xB7, 0x93, 0x31, 0x31, 0xD9,
+    0x37, 0x3B, 0x21, 0xED, 0x76, 0xA5, 0x8C, 0xA4, 0x44, 0xFF, 0x61, 0xB6, 0x2B, 0xD1, 0x6D, 0x31,
+    0xDB, 0x95, 0xF4, 0x13, 0xB6, 0x2B, 0x9D, 0xFE, 0x51, 0x31, 0x11, 0x4C, 0xC6, 0xA7, 0x42, 0x5B,
+    0x4C, 0xFE, 0x5D, 0x15, 0x81, 0xE9, 0x57, 0xC1, 0xF1, 0x0B, 0x86, 0xF5, 0xAC, 0x85, 0x8C, 0xA9,
+    0xD8, 0x01, 0xC0, 0x7A, 0xF3, 0xDD, 0x73, 0x02, 0x13, 0xBA, 0xA7, 0xD5, 0x84, 0x91, 0xE0, 0x50,
+    0x58, 0xA7, 0x74, 0xF3, 0xE8, 0xF8, 0x66, 0x76, 0x0A, 0x19, 0xE8, 0x9A, 0x5D, 0x43, 0x47, 0xC5,
+    0xB7, 0x67, 0x9C, 0x97, 0xB2, 0x56, 0x79, 0xFC, 0xE5, 0xB0, 0x7B, 0xF8, 0x79, 0x49, 0xF3, 0x3F,
+    0xC5, 0x1E, 0x8B, 0xB8, 0x73, 0x21, 0x0A, 0xF4, 0xBF, 0xC8, 0x08, 0xB5, 0x31, 0x7E, 0x6A, 0xDC,
+    0xE1, 0xA0, 0x88, 0xC5, 0x16, 0xE3, 0x4E, 0xC5, 0x09, 0xC2, 0xC5, 0x46, 0x3B, 0x71, 0x8E, 0xB1,
+    0x44, 0x52, 0x38, 0xC5, 0x1A, 0x7B, 0x0C, 0x58, 0x3D, 0xF6, 0xBB, 0x62, 0x4E, 0xE1, 0x5C, 0x61,
+    0x7C, 0x07, 0x63, 0xC1, 0xB1, 0xA6, 0x73, 0x5D, 0x16, 0x56, 0x1D, 0xA6, 0x8E, 0x1E, 0x6E, 0x8A,
+    0x1F, 0x53, 0xC8, 0xB5, 0xA5, 0x78, 0x49, 0xFB, 0xF6, 0x4F, 0x8B, 0x7C, 0xF4, 0x9B, 0x17, 0x04,
+    0x01, 0x40, 0xD8, 0x88, 0x78, 0x8D, 0x1A, 0xC1, 0x0D, 0xF5, 0x9C, 0x37, 0x1E, 0x35, 0x3E, 0x8A,
+    0x44, 0x59, 0x2E, 0x6A, 0x2C, 0x61, 0x53, 0x82, 0x95, 0x70, 0xAE, 0x19, 0xB8, 0x36, 0x9B, 0x9D,
+    0x51, 0xE6, 0x3E, 0xF9, 0x09, 0x10, 0x27, 0xCA, 0xD2, 0xD7, 0x94, 0x9F, 0xC2, 0x25, 0xE1, 0x9E,
+    0x99, 0x3B, 0xF4, 0xD8, 0x35, 0x25, 0x80, 0x89, 0x84, 0x9C, 0x3B, 0xAB, 0x73, 0xB7, 0x56, 0xDF,
+    0x9F, 0x9E, 0x03, 0xD1, 0x3D, 0xE1, 0x39, 0x10, 0x27, 0xCA, 0x68, 0x75, 0x25, 0xA5, 0x25, 0x07,
+    0xB6, 0x7A, 0xBF, 0x66, 0x91, 0x53, 0x7E, 0x8B, 0xF0, 0x75, 0xA6, 0x7C, 0xE0, 0x11, 0x7A, 0xDC,
+    0x5D, 0xAB, 0x8C, 0xBA, 0x3A, 0xB3, 0xAC, 0x67, 0x4A, 0x8B, 0x86, 0x60, 0xF8, 0xB6, 0xFC, 0xF4,
+    0x1D, 0x57, 0x48, 0xFE, 0x3E, 0x9E, 0x33, 0x12, 0xE1, 0x53, 0xF8, 0x05, 0x2A, 0xD2, 0x69, 0xC1,
+    0xBD, 0xA4, 0x91, 0x70, 0x77, 0x50, 0xF3, 0xE2, 0xCF, 0x61, 0xCB, 0xD1, 0x3B, 0x16, 0xD3, 0x93,
+    0x16, 0x05, 0x33, 0x70, 0x2D, 0xCD, 0xEE, 0x6B, 0xCE, 0x59, 0xE5, 0xFE, 0xC6, 0xF6, 0xFB, 0xB8,
+    0x0F, 0x66, 0xED, 0x5F, 0xC9, 0xC4, 0xDF, 0x13, 0x7F, 0xD3, 0x69, 0xC5, 0xE1, 0xF4, 0xEA, 0x68,
+    0x25, 0x6A, 0x79, 0xA2, 0x3C, 0x3F, 0xE5, 0xDC, 0xA3, 0x5C, 0xB8, 0x78, 0x93, 0x3C, 0xB9, 0xB5,
+    0xA8, 0xE3, 0x5A, 0x81, 0xA6, 0xBE, 0x4B, 0x9B, 0x94, 0x6B, 0xF3, 0x12, 0xB8, 0xC8, 0xE7, 0xB2,
+    0x30, 0x65, 0x7D, 0x7B, 0xDA, 0x66, 0xD1, 0x4D, 0x71, 0x2D, 0x90, 0x43, 0xB7, 0xD9, 0x46, 0x87,
+    0x77, 0xEC, 0x87, 0xE9, 0x79, 0x2D, 0xE1, 0xB8, 0x09, 0x25, 0xF9, 0xB0, 0x36, 0x1F, 0xF6, 0x4C,
+    0x71, 0x04, 0x12, 0xCF, 0xF7, 0x95, 0xAD, 0x55, 0x3B, 0x77, 0xE0, 0xDE, 0xA0, 0x6C, 0x0C, 0x5D,
+    0xA0, 0xF0, 0x9E, 0xB9, 0x46, 0xD4, 0xF0, 0x73, 0x93, 0x06, 0x92, 0xC7, 0xC8, 0xD0, 0xD5, 0x51,
+    0x49, 0xBF, 0x0C, 0x15, 0xAE, 0x2A, 0xFC, 0x15, 0x1E, 0xEE, 0x22, 0xA6, 0x7A, 0xF4, 0x59, 0x29,
+    0x8B, 0x4B, 0xBC, 0xB2, 0xF8, 0xC3, 0x52, 0xF8, 0x84, 0x8D, 0x00, 0x7F, 0x53, 0x9B, 0xB2, 0xF2,
+    0xC4, 0xB7, 0x61, 0xA7, 0x2D, 0x99, 0xA1, 0x7B, 0x30, 0xB0, 0xEE, 0xE3, 0x09, 0x07, 0xE8, 0xA8,
+    0x73, 0x3A, 0x74, 0xD7, 0xE3, 0x23, 0x0C, 0xAF, 0xC1, 0x6D, 0x55, 0x8F, 0xE2, 0xD0, 0x42, 0xAE,
+    0x20, 0xD6, 0x89, 0xDC, 0x93, 0xC1, 0x0F, 0x49, 0xDE, 0x96, 0xE6, 0xE0, 0xF5, 0xC5, 0x1F, 0x54,
+    0xD2, 0x09, 0x84, 0x8C, 0x74, 0x19, 0x7D, 0x86, 0xFA, 0x42, 0xF9, 0x80, 0x43, 0x24, 0x4E, 0xCE,
+    0x83, 0xF8, 0xF9, 0x90, 0x3C, 0xC0, 0x98, 0x8C, 0x01, 0x0D, 0xE6, 0x03, 0x9E, 0xB8, 0x30, 0x58,
+    0xCB, 0xD7, 0xC6, 0x0E, 0xAF, 0x58, 0xCB, 0xCD, 0x24, 0xA0, 0x4C, 0xED, 0xF2, 0xB4, 0x87, 0xC2,
+    0xEE, 0x6B, 0xA4, 0x64, 0x60, 0xE1, 0x9C, 0x48, 0x33, 0x27, 0x3D, 0x90, 0x75, 0x18, 0x54, 0x3C,
+    0xDF, 0xA6, 0x00, 0x2F, 0x84, 0x71, 0x32, 0xE7, 0x92, 0x54, 0xF8, 0x86, 0x30, 0x9C, 0xFC, 0xE2,
+    0x7C, 0x85, 0xCD, 0xE9, 0x61, 0xE5, 0x7D, 0x39, 0x67, 0xC5, 0x9F, 0xF7, 0x7B, 0x54, 0x06, 0x07,
+    0x8D, 0x5F, 0x83, 0x0B, 0x5E, 0x13, 0x54, 0x9D, 0x8B, 0xCD, 0xF6, 0x61, 0x09, 0xD2, 0xDD, 0x36,
+    0xCA, 0x33, 0xAC, 0xE9, 0x2E, 0x4E, 0xC1, 0x42, 0x3C, 0x3A, 0x28, 0x16, 0x9E, 0xAA, 0xFE, 0x4D,
+    0x15, 0x7D, 0x28, 0x64, 0xEF, 0xDD, 0x36, 0x54, 0x67, 0x9F, 0x72, 0x18, 0xE0, 0xDC, 0x92, 0xE6,
+    0x64, 0x6E, 0x28, 0xC5, 0x8E, 0x7D, 0x6D, 0x02, 0xF3, 0x24, 0xD8, 0x92, 0x49, 0x22, 0x0D, 0x89,
+    0xC1, 0x1F, 0xDA, 0x89, 0x3C, 0x43, 0xDC, 0x63, 0xA4, 0xED, 0xB1, 0x5C, 0x90, 0xCF, 0x8E, 0xC8,
+    0x4D, 0x6C, 0x0B, 0xCE, 0x49, 0x0F, 0xFF, 0xDB, 0x3C, 0x73, 0x00, 0x98, 0x32, 0xB2, 0xAC, 0x06,
+    0x9B, 0x0A, 0x30, 0x51, 0x3F, 0xB3, 0x31, 0x85, 0xBB, 0x1C, 0x7F, 0x4D, 0x07, 0x8D, 0x7D, 0x79,
+    0x26, 0xBF, 0x6A, 0xDD, 0xB4, 0xF2, 0x59, 0x37, 0xA1, 0x1C, 0x08, 0x9D, 0x29, 0xFE, 0x15, 0x32,
+    0xFE, 0xF5, 0x99, 0xF0, 0x68, 0xCF, 0xC4, 0xBF, 0xF6, 0xF6, 0xC7, 0xBF, 0x0A, 0xFB, 0x4C, 0x24,
+    0x6E, 0x9A, 0xE2, 0x93, 0x92, 0x82, 0x06, 0xD3, 0xB8, 0x0A, 0x6A, 0xF3, 0x28, 0x25, 0x14, 0x1C,
+    0x4B, 0xB3, 0x42, 0x52, 0x81, 0x45, 0x37, 0x80, 0x03, 0x9D, 0xCD, 0x0B, 0x31, 0xF8, 0x11, 0xFF,
+    0x23, 0x8A, 0x82, 0x7F, 0x8E, 0x12, 0xDF, 0x5F, 0xA1, 0x4C, 0x63, 0x52, 0x72, 0x26, 0x74, 0x33,
+    0x8C, 0xEB, 0xD4, 0x64, 0x04, 0xDA, 0xD1, 0x8B, 0x9E, 0x42, 0x99, 0x3F, 0xC3, 0xB5, 0x7C, 0xE8,
+    0x56, 0x66, 0x32, 0x50, 0x5C, 0x89, 0x51, 0xBE, 0x35, 0xA5, 0xB7, 0xCC, 0x67, 0xE7, 0xE0, 0x15,
+    0x7A, 0x06, 0xC6, 0x43, 0xB9, 0xF7, 0xC6, 0x4D, 0x7B, 0xDC, 0xE1, 0x66, 0x32, 0xEF, 0x93, 0x10,
+    0x5B, 0x09, 0xE0, 0xE2, 0x59, 0x2C, 0x08, 0x9D, 0xE8, 0x36, 0x31, 0x39, 0x21, 0x7B, 0x4B, 0x35,
+    0x6E, 0x12, 0x2E, 0x46, 0xCF, 0x94, 0xED, 0x05, 0x4F, 0xFF, 0xB1, 0x5E, 0xF9, 0x71, 0x78, 0xD2,
+    0x8F, 0xD2, 0x5B, 0xB7, 0x00, 0x66, 0x5F, 0x18, 0x8A, 0x2E, 0xB4, 0x11, 0x0C, 0x88, 0xDD, 0x86,
+    0xCB, 0x81, 0x6E, 0xA2, 0xDA, 0xE1, 0xB8, 0x38, 0x7B, 0xA7, 0xB3, 0xA5, 0xE1, 0xD5, 0xE2, 0xF9,
+    0x4C, 0xBD, 0x19, 0xEC, 0xA0, 0x31, 0xF4, 0x82, 0x11, 0x83, 0x95, 0xA5, 0x73, 0x33, 0xFA, 0x2C,
+    0x63, 0xDE, 0xDD, 0xDD, 0x29, 0x4C, 0xA7, 0x9D, 0xF1, 0x5A, 0xCD, 0x84, 0x59, 0x4C, 0x9D, 0x0B,
+    0x8F, 0x8D, 0xF8, 0x69, 0x61, 0x91, 0x6B, 0x83, 0x84, 0xE3, 0xE1, 0xA6, 0xFB, 0xD1, 0x3C, 0x52,
+    0xF6, 0x38, 0x77, 0x51, 0x7D, 0x7B, 0x1F, 0x0A, 0x2B, 0xF9, 0x69, 0x0B, 0xD9, 0xCE, 0xA7, 0x8C,
+    0xE4, 0xE3, 0x42, 0xDB, 0x3C, 0x85, 0x3C, 0xBA, 0xA4, 0x9C, 0xBB, 0x50, 0x8B, 0xDE, 0x5C, 0x08,
+    0x64, 0xBC, 0xB1, 0x35, 0x35, 0x6A, 0x4B, 0x35, 0x5B, 0x47, 0x3E, 0x8D, 0xDE, 0xDF, 0xF6, 0xF5,
+    0x3C, 0xD2, 0x4D, 0x52, 0x5D, 0xCB, 0x28, 0x1F, 0x06, 0x75, 0x04, 0x35, 0xB0, 0xFF, 0x0F, 0xED,
+    0x5C, 0x3D, 0x90, 0xDC, 0xD6, 0x91, 0x7E, 0x00, 0xC8, 0x9D, 0x2A, 0x22, 0x00, 0x03, 0xD2, 0xB2,
+    0xC9, 0xB2, 0xA0, 0xF0, 0xCC, 0xAA, 0x3B, 0xA4, 0x76, 0x95, 0x2C, 0xA0, 0xC4, 0x2A, 0x2B, 0xF4,
+    0x06, 0x3B, 0x52, 0xA0, 0x40, 0x89, 0x03, 0x9D, 0x12, 0xC6, 0x57, 0x25, 0x11, 0xD0, 0x5D, 0xE0,
+    0xC0, 0xC9, 0x06, 0x96, 0x63, 0x05, 0x74, 0x15, 0x39, 0x0C, 0x9C, 0x38, 0x70, 0x20, 0x12, 0x70,
+    0x29, 0x70, 0x78, 0xB8, 0x72, 0xE8, 0xE0, 0x46, 0x27, 0xAA, 0x54, 0xB6, 0x03, 0xA2, 0xEE, 0x46,
+    0x77, 0x90, 0x38, 0xC0, 0xBB, 0xFE, 0xBE, 0x7E, 0xC0, 0x60, 0x76, 0x97, 0x3F, 0x12, 0xA9, 0x25,
+    0xB9, 0xF6, 0x90, 0xF3, 0x5E, 0x2F, 0x16, 0xF3, 0xF0, 0x5E, 0xBF, 0x7E, 0xDD, 0xFD, 0x75, 0xF7,
+    0xAC, 0x31, 0x78, 0xFD, 0xB3, 0xD1, 0x57, 0x69, 0x8C, 0x57, 0xDA, 0x7D, 0x63, 0x8D, 0x89, 0xAD,
+    0xED, 0x4C, 0x27, 0x97, 0xAC, 0xB5, 0xEF, 0xAF, 0x8D, 0x6F, 0x0B, 0x93, 0xFF, 0x75, 0x65, 0x66,
+    0x6B, 0x63, 0x42, 0x5B, 0x9B, 0xA8, 0x31, 0x26, 0xE8, 0xE5, 0xB6, 0x5A, 0x3E, 0x26, 0x7D, 0x5A,
+    0xE9, 0xC7, 0xD3, 0x42, 0xFA, 0x3C, 0xC3, 0x7F, 0xFE, 0x50, 0x62, 0x58, 0xF9, 0x25, 0xFB, 0xE4,
+    0x11, 0x7B, 0xB9, 0x3F, 0x37, 0xFA, 0xF9, 0x94, 0xE3, 0x64, 0xE3, 0xF8, 0x89, 0x7B, 0x1E, 0x9E,
+    0xEF, 0xCB, 0x5C, 0x38, 0x9F, 0x56, 0x68, 0x2B, 0xF7, 0x34, 0xB8, 0xE7, 0xAB, 0x9B, 0x16, 0xF7,
+    0xCA, 0xFC, 0x7B, 0x8C, 0xE1, 0x59, 0xBB, 0xE4, 0xDA, 0xBC, 0x3D, 0xB3, 0xF5, 0x0A, 0x1B, 0xD7,
+    0x7A, 0x73, 0x13, 0x2D, 0x4D, 0x6E, 0x97, 0x51, 0xE5, 0xCB, 0xA2, 0xD3, 0x22, 0xEC, 0x5F, 0xB7,
+    0xD6, 0xC4, 0x4B, 0x93, 0xB6, 0x98, 0x02, 0x7E, 0x29, 0x0F, 0x6A, 0xF0, 0xF8, 0x60, 0x85, 0x87,
+    0xBB, 0xB6, 0x05, 0x7F, 0xC6, 0x56, 0xAF, 0xDC, 0xE6, 0x6F, 0xF5, 0xCE, 0x94, 0xC3, 0xCB, 0xCC,
+    0x65, 0x04, 0xF9, 0x2F, 0xC4, 0x4C, 0x46, 0xCE, 0x30, 0xA5, 0x0E, 0xAB, 0xD5, 0x89, 0x6D, 0xA6,
+    0x75, 0x43, 0xBB, 0xFE, 0x2A, 0xA6, 0x5F, 0x75, 0x60, 0x45, 0xFC, 0xFB, 0x35, 0xBB, 0x8F, 0x5B,
+    0x76, 0x7F, 0x6A, 0xD8, 0xD9, 0x8A, 0x5D, 0x47, 0x6E, 0xC5, 0xD5, 0xB7, 0xD2, 0xE5, 0xBA, 0x1F,
+    0xB9, 0xDB, 0x86, 0x82, 0xBB, 0x00, 0xEE, 0x8B, 0x6C, 0x44, 0xAD, 0x99, 0x61, 0xD1, 0xF6, 0x2F,
+    0xA5, 0xB0, 0xDE, 0x58, 0x65, 0xF1, 0x45, 0x65, 0xB8, 0x39, 0x9F, 0x6D, 0x33, 0x5A, 0xF7, 0xD0,
+    0xA8, 0x48, 0x48, 0x87, 0x9F, 0x67, 0x4D, 0xCF, 0xEE, 0xBF, 0xD7, 0xEC, 0xEC, 0x4A, 0xBB, 0x8A,
+    0xDD, 0xCA, 0xE8, 0x2D, 0xDF, 0xAC, 0x0B, 0xB5, 0x83, 0x80, 0x08, 0xC7, 0xE3, 0x86, 0x32, 0x93,
+    0x4B, 0x17, 0x75, 0x6F, 0xDE, 0x93, 0x6E, 0x66, 0xED, 0xA7, 0x14, 0x14, 0x7B, 0x19, 0x9D, 0xB7,
+    0x3B, 0x99, 0xE9, 0xDB, 0x66, 0xA7, 0x70, 0x64, 0x92, 0x25, 0xC3, 0x3A, 0xA2, 0x65, 0x3F, 0xDC,
+    0x10, 0xDC, 0x6B, 0xC7, 0x9B, 0x9D, 0x5C, 0x71, 0x4D, 0xD5, 0x48, 0x9E, 0x37, 0xF7, 0x79, 0xE5,
+    0xF6, 0x2B, 0x19, 0x30, 0x12, 0x66, 0x75, 0x39, 0x05, 0x00, 0x64, 0x2F, 0x24, 0x4E, 0x13, 0x49,
+    0x73, 0xBA, 0x5C, 0xF1, 0x21, 0x6B, 0xE1, 0x7A, 0x08, 0x11, 0x11, 0x5E, 0xE4, 0x10, 0x61, 0xCE,
+    0xA2, 0xC1, 0x5E, 0xE4, 0x05, 0xF7, 0xC5, 0xED, 0x0E, 0x98, 0x0A, 0x92, 0xA7, 0xD0, 0x72, 0xB3,
+    0x44, 0xD0, 0x70, 0x30, 0x72, 0x27, 0xE1, 0xC2, 0xCC, 0x81, 0x14, 0x8E, 0x80, 0x04, 0x9B, 0xDC,
+    0xC6, 0x82, 0xC4, 0x59, 0x75, 0x37, 0x58, 0x33, 0x90, 0x38, 0x59, 0x8E, 0x9C, 0xB5, 0x66, 0x18,
+    0x17, 0x2C, 0x75, 0x4F, 0xC3, 0xB3, 0x73, 0x77, 0x52, 0x0B, 0x25, 0xA5, 0xB7, 0xDC, 0x5E, 0xCC,
+    0x17, 0x03, 0x18, 0x5D, 0x05, 0x06, 0x10, 0xD2, 0x93, 0xB5, 0x61, 0x00, 0xA3, 0x2B, 0x4E, 0xA4,
+    0xB5, 0x39, 0xCF, 0xA8, 0x23, 0xFB, 0x7D, 0x47, 0x2A, 0xBB, 0xFC, 0xFD, 0x51, 0x2B, 0x79, 0xAD,
+    0xB7, 0x76, 0xEC, 0x33, 0xA5, 0x4C, 0x29, 0x77, 0xE7, 0xE7, 0x6E, 0xE5, 0x06, 0x13, 0xFE, 0xE1,
+    0x11, 0x64, 0x5F, 0xD0, 0x0D, 0x0F, 0xE6, 0xD1, 0x1A, 0xD9, 0x37, 0x4E, 0x72, 0x20, 0x93, 0x2A,
+    0x94, 0x0F, 0x3B, 0xF6, 0x8D, 0x64, 0xB4, 0xF4, 0xE6, 0x73, 0x3B, 0xB2, 0x44, 0xCE, 0xF6, 0x40,
+    0x06, 0xEB, 0x91, 0x67, 0xE1, 0x86, 0x93, 0x51, 0x3D, 0xDE, 0x20, 0x67, 0x64, 0x20, 0xCB, 0x91,
+    0x7D, 0x5E, 0x37, 0xB2, 0x2F, 0x68, 0x47, 0xF6, 0x85, 0xCD, 0xC8, 0xBE, 0xB8, 0x1A, 0x67, 0x86,
+    0x73, 0xE2, 0xE6, 0xDB, 0x8F, 0xEC, 0x73, 0x9C, 0x04, 0xFB, 0x82, 0xD5, 0xC8, 0xBE, 0xE8, 0xAB,
+    0xC5, 0x22, 0x53, 0xF6, 0x41, 0x76, 0x0A, 0x65, 0x1F, 0x49, 0xF2, 0xCE, 0xFB, 0xD0, 0x5C, 0x30,
+    0x3A, 0xC5, 0x5B, 0xF2, 0x4F, 0xA9, 0xF4, 0xDF, 0x5A, 0x47, 0x45, 0x77, 0x97, 0x8E, 0x0A, 0xF8,
+    0x01, 0x50, 0x8E, 0x4D, 0x58, 0xD4, 0xDE, 0x48, 0xE1, 0x75, 0x7A, 0x77, 0xA0, 0x4A, 0xFB, 0x5A,
+    0x13, 0xC8, 0x33, 0x2A, 0x69, 0x3E, 0x57, 0x2A, 0xEA, 0x5E, 0xB7, 0x8D, 0xB0, 0x2C, 0xAF, 0x92,
+    0x25, 0x4F, 0x19, 0xCE, 0x77, 0x61, 0x92, 0x91, 0x77, 0x34, 0x14, 0x2D, 0x38, 0x12, 0x29, 0xE7,
+    0x7A, 0x27, 0x8D, 0x35, 0xA8, 0x99, 0xF2, 0xAD, 0x53, 0xAA, 0x34, 0x8E, 0x92, 0xFD, 0x76, 0xBF,
+    0x05, 0xD3, 0xF4, 0x13, 0x8E, 0xAF, 0xD2, 0x39, 0x96, 0xC9, 0x78, 0xE0, 0x98, 0x7C, 0x3C, 0xE6,
+    0xA8, 0x86, 0x33, 0x20, 0xBF, 0xA2, 0x5E, 0x8E, 0x7A, 0xD0, 0x2F, 0x16, 0x85, 0x4C, 0xF2, 0x8F,
+    0xCD, 0x0C, 0x33, 0x15, 0xCE, 0x5D, 0x76, 0xD4, 0x78, 0xE6, 0x69, 0x65, 0x6E, 0xB1, 0xED, 0x9E,
+    0x89, 0x16, 0x3B, 0xBA, 0xD5, 0x72, 0x9A, 0x93, 0x16, 0x9C, 0x51, 0xAB, 0x27, 0x66, 0xA0, 0x61,
+    0x5B, 0x73, 0xC1, 0x53, 0x55, 0xF3, 0x33, 0x8E, 0x06, 0x2D, 0x22, 0xF2, 0xB7, 0xA1, 0xDD, 0x75,
+    0x73, 0xA8, 0x5D, 0x7F, 0xEB, 0x2D, 0xD6, 0xB2, 0xD5, 0xF2, 0xE1, 0xF7, 0x69, 0x75, 0x8D, 0x01,
+    0x5A, 0x58, 0x06, 0xB4, 0x10, 0xD7, 0xC0, 0x66, 0x6F, 0x93, 0x0D, 0x3B, 0x59, 0x27, 0xE2, 0xD3,
+    0xC9, 0x41, 0x92, 0xBE, 0xD2, 0x9F, 0x95, 0x3D, 0xFA, 0xC6, 0xB5, 0x27, 0xF7, 0x36, 0x87, 0xDE,
+    0x90, 0x3F, 0x28, 0x3E, 0x31, 0xE5, 0x39, 0x5C, 0x9F, 0x15, 0xD5, 0x4A, 0x20, 0x16, 0x3E, 0xCB,
+    0x6B, 0x3D, 0x69, 0x19, 0x8E, 0x82, 0x12, 0xED, 0x40, 0x74, 0x8E, 0xB8, 0x6A, 0x07, 0x42, 0x3E,
+    0xA6, 0x84, 0xA8, 0x53, 0x25, 0x44, 0xA6, 0x95, 0x10, 0xAD, 0xA9, 0x84, 0xC8, 0xB3, 0x12, 0xA2,
+    0x5D, 0x75, 0x1C, 0x51, 0xD9, 0x8E, 0x48, 0x2B, 0x47, 0x44, 0x4B, 0x47, 0xCC, 0x56, 0x8E, 0x08,
+    0xD6, 0x8E, 0x30, 0x7D, 0xE0, 0x88, 0xF2, 0xB2, 0x23, 0xD2, 0x8F, 0x1D, 0x11, 0x7F, 0xEA, 0x88,
+    0xF0, 0xFF, 0x1C, 0x11, 0x58, 0x47, 0x78, 0x03, 0x61, 0xCA, 0x81, 0x48, 0x07, 0x22, 0x6E, 0x06,
+    0x93, 0x6E, 0x26, 0x84, 0xD9, 0xF8, 0x90, 0xAA, 0xC0, 0x9D, 0x48, 0xCE, 0xEC, 0x7A, 0x20, 0x9A,
+    0x81, 0x28, 0x0E, 0x59, 0xC7, 0xEF, 0x0D, 0x3C, 0x94, 0xE5, 0x29, 0x0F, 0xCB, 0x81, 0x87, 0x72,
+    0x45, 0x79, 0xF8, 0x5D, 0xE3, 0x78, 0x68, 0x8C, 0xE3, 0xA1, 0x10, 0xCA, 0x43, 0x21, 0x94, 0x87,
+    0xB9, 0x71, 0x3C, 0x14, 0x42, 0x79, 0x28, 0x84, 0xF2, 0x50, 0x08, 0xE5, 0x61, 0x6E, 0x1C, 0x0F,
+    0x41, 0x90, 0x87, 0x20, 0xC8, 0x43, 0x10, 0xE4, 0x21, 0x08, 0xF2, 0x10, 0x04, 0x79, 0x48, 0x02,
+    0x3C, 0x24, 0x01, 0x1E, 0x92, 0x00, 0x0F, 0x49, 0x80, 0x87, 0x24, 0xC0, 0xC3, 0xDC, 0x38, 0x1E,
+    0x92, 0x00, 0x0F, 0x95, 0x48, 0x07, 0x22, 0x6E, 0xDC, 0x01, 0x1C, 0x4F, 0xE2, 0x23, 0x12, 0x8E,
+    0xAB, 0xFE, 0xC0, 0x55, 0xDF, 0x3A, 0x8F, 0xC4, 0x13, 0xBF, 0x5D, 0x5F, 0x1F, 0xEA, 0x2F, 0xF4,
+    0x86, 0x40, 0x3B, 0xDF, 0xDD, 0xB5, 0x7B, 0x90, 0xF1, 0x73, 0x1E, 0xBB, 0x58, 0xCE, 0x99, 0xDF,
+    0xAE, 0x4B, 0x31, 0xAC, 0x7E, 0xDB, 0x8B, 0x4E, 0x97, 0x4E, 0x14, 0x4B, 0x5E, 0x48, 0x27, 0xDA,
+    0xBC, 0x92, 0x0E, 0x72, 0xCF, 0x4E, 0xDC, 0xE4, 0xB6, 0xDF, 0xEA, 0xBA, 0x27, 0xD9, 0x4D, 0xA7,
+    0x7B, 0x64, 0x17, 0x68, 0x37, 0xA3, 0xAF, 0x14, 0x95, 0x14, 0xAA, 0x88, 0x3E, 0xBF, 0x09, 0x65,
+    0x42, 0x17, 0x32, 0x31, 0x7E, 0x26, 0xAC, 0xC3, 0x25, 0x6E, 0x25, 0x1E, 0xE9, 0xC9, 0xB4, 0x94,
+    0x9C, 0x88, 0x79, 0xBF, 0x77, 0xD0, 0x47, 0x35, 0xE1, 0x52, 0x9D, 0x2C, 0xDE, 0xB3, 0xDA, 0xDC,
+    0xFF, 0x0A, 0xDB, 0x5B, 0x57, 0xC9, 0xA6, 0x94, 0xDA, 0x09, 0x32, 0x1F, 0xAC, 0xA0, 0x05, 0x82,
+    0x06, 0xFA, 0x20, 0x5C, 0xE2, 0xC3, 0x51, 0x0D, 0x39, 0x8C, 0x2B, 0x58, 0xE9, 0xA4, 0xC0, 0x5C,
+    0x53, 0x6A, 0xB2, 0x72, 0x3E, 0xEF, 0xE8, 0x23, 0x5B, 0x38, 0xFE, 0xD2, 0xFA, 0x62, 0x97, 0xCA,
+    0x02, 0xB7, 0xC5, 0x95, 0xBA, 0x10, 0xF0, 0xD9, 0xC2, 0x06, 0x03, 0xCE, 0x1A, 0x78, 0x56, 0x32,
+    0xED, 0x0C, 0x1B, 0xA8, 0x46, 0x81, 0x93, 0xEF, 0xFD, 0x0F, 0xCD, 0x25, 0xE8, 0x47, 0x19, 0x31,
+    0x7D, 0x0D, 0x0F, 0xBA, 0x8B, 0x63, 0x62, 0xB3, 0xE1, 0xA0, 0xED, 0x6D, 0xED, 0x68, 0x2E, 0xFB,
+    0x19, 0x40, 0xD1, 0xFA, 0x5F, 0xFE, 0x44, 0xB6, 0x4C, 0x1D, 0x78, 0xF5, 0x18, 0xF1, 0x18, 0xAA,
+    0x31, 0x50, 0x17, 0xC4, 0x1C, 0x62, 0x56, 0x55, 0xD8, 0x7F, 0x10, 0xC3, 0x84, 0xC7, 0x15, 0xEC,
+    0x69, 0x25, 0xCF, 0x8F, 0xE1, 0x64, 0x26, 0x15, 0xB1, 0x57, 0x2A, 0x37, 0x55, 0xC9, 0x17, 0x6F,
+    0xDD, 0xAD, 0xC4, 0xC5, 0xF8, 0x85, 0xC0, 0xA4, 0x2E, 0xAC, 0xCC, 0x69, 0x79, 0xF6, 0x75, 0x73,
+    0x06, 0x0A, 0x09, 0x38, 0xC5, 0xCC, 0xC4, 0xBB, 0xF6, 0x61, 0x8D, 0x70, 0xBC, 0x27, 0x6E, 0x70,
+    0x2C, 0xA2, 0x9A, 0xC8, 0x7B, 0xC7, 0xDE, 0x71, 0xAE, 0xCE, 0x93, 0x7D, 0x7B, 0xE5, 0xFE, 0xF8,
+    0x0C, 0x38, 0xF0, 0xA9, 0x78, 0xEE, 0x70, 0xD9, 0xE9, 0xAB, 0xC3, 0x72, 0xC0, 0x3B, 0x3F, 0x7F,
+    0x00, 0x8F, 0x3C, 0xC9, 0xB7, 0x60, 0x86, 0xEB, 0x90, 0xCB, 0x15, 0x1D, 0x34, 0xD3, 0x45, 0x35,
+    0x9F, 0x52, 0x52, 0xC6, 0x62, 0x3D, 0xB0, 0xA1, 0x1E, 0x43, 0x6F, 0xF7, 0x30, 0x30, 0x20, 0xE2,
+    0x76, 0x80, 0x5B, 0xF1, 0x76, 0xA1, 0x70, 0xBB, 0x19, 0xD0, 0x6D, 0xA4, 0xEE, 0xA7, 0xC3, 0xDA,
+    0x0E, 0x0A, 0x3B, 0xA4, 0xED, 0x80, 0xB6, 0xC3, 0xCD, 0x0E, 0x46, 0x3F, 0xB4, 0x4B, 0x2B, 0x07,
+    0xB0, 0x1D, 0xBE, 0x76, 0x63, 0x3A, 0x74, 0x4D, 0x70, 0xDD, 0x0D, 0x4F, 0x07, 0xB4, 0x86, 0x2A,
+    0x2E, 0x7B, 0x22, 0x6B, 0x07, 0xAC, 0x07, 0x5C, 0x4D, 0x58, 0x2D, 0xC2, 0xF9, 0x03, 0x11, 0x76,
+    0x88, 0x7B, 0xCE, 0x53, 0x70, 0x17, 0xC7, 0x02, 0xC2, 0x19, 0x6C, 0x0B, 0xA7, 0xA7, 0xC2, 0xB9,
+    0x34, 0x40, 0xDA, 0x06, 0x40, 0x3B, 0x03, 0xCE, 0xAE, 0x08, 0x92, 0xA1, 0x44, 0x1B, 0x42, 0xE7,
+    0x7E, 0x68, 0xDA, 0x6E, 0x6C, 0xF8, 0x23, 0xE1, 0x35, 0x74, 0x6C, 0x43, 0xA4, 0x97, 0xE0, 0x63,
+    0x84, 0xD6, 0x40, 0xD6, 0x0E, 0x58, 0x2B, 0xAE, 0xDE, 0x23, 0x9C, 0x3B, 0x43, 0xDC, 0x8A, 0x45,
+    0xC2, 0x61, 0x00, 0x7E, 0x5B, 0x71, 0xEE, 0x9C, 0x7A, 0x59, 0x1D, 0x05, 0xD8, 0x14, 0x7D, 0x97,
+    0xC7, 0xD8, 0xE6, 0x23, 0xA4, 0x93, 0xFD, 0x00, 0x9A, 0xCA, 0x14, 0x67, 0x2B, 0xCC, 0x06, 0xCA,
+    0x5E, 0x51, 0x81, 0xD4, 0x60, 0x7E, 0x3F, 0x40, 0xEC, 0x2D, 0x85, 0xB0, 0x7A, 0x90, 0x42, 0x30,
+    0x0E, 0x1E, 0x3F, 0x66, 0x13, 0x36, 0x84, 0xD5, 0x04, 0xD5, 0x84, 0xD4, 0x04, 0xD4, 0x0A, 0xA7,
+    0x09, 0xA6, 0x27, 0xC2, 0x9D, 0x5A, 0x4C, 0x44, 0xDB, 0x4B, 0x8B, 0xC5, 0x01, 0x16, 0x47, 0xD9,
+    0x8F, 0xC7, 0x25, 0xEB, 0xF2, 0xCF, 0x64, 0x3F, 0x78, 0x3E, 0x77, 0xC1, 0xCC, 0xE7, 0x7B, 0xB8,
+    0xBC, 0x76, 0x0D, 0x7F, 0xDC, 0xBC, 0xDE, 0xF3, 0x44, 0x07, 0x95, 0x30, 0xC5, 0xB7, 0x61, 0x11,
+    0xCE, 0x6D, 0xD9, 0xDF, 0xE3, 0xDC, 0x94, 0xB9, 0x86, 0x2C, 0x36, 0x1E, 0x81, 0x86, 0xBF, 0x68,
+    0x0C, 0xCC, 0x2B, 0x27, 0x73, 0x6B, 0x8C, 0x0F, 0xB5, 0xCC, 0xF8, 0x03, 0x2C, 0xAC, 0xFA, 0xAA,
+    0x00, 0xC3, 0x5E, 0xF3, 0x8C, 0xED, 0xCF, 0x96, 0xA2, 0xFA, 0x84, 0x8A, 0x8A, 0xC0, 0xC7, 0x10,
+    0xDC, 0x0D, 0x51, 0x8B, 0x13, 0xB7, 0x3F, 0xD8, 0x22, 0xC6, 0xA7, 0x6E, 0x63, 0x07, 0x92, 0x7F,
+    0x47, 0x80, 0x00, 0x26, 0x26, 0xA0, 0x9C, 0x5E, 0x7F, 0xC6, 0x36, 0x49, 0xE7, 0x1C, 0xD3, 0x74,
+    0x84, 0xAB, 0x89, 0x8B, 0xAD, 0xBE, 0x79, 0x7C, 0x32, 0x37, 0x69, 0x31, 0x0A, 0x20, 0xDD, 0x0F,
+    0x0D, 0x05, 0x71, 0xDD, 0xFF, 0xF8, 0xAC, 0xED, 0xCF, 0x1E, 0x83, 0xBB, 0xFB, 0x08, 0x83, 0x89,
+    0xCF, 0xF4, 0xD9, 0x9B, 0xBD, 0x39, 0x25, 0xF3, 0xCA, 0x8C, 0xCB, 0x4E, 0xD0, 0x2D, 0xA3, 0x22,
+    0xA0, 0xEE, 0x9B, 0x35, 0x62, 0x98, 0x7E, 0xD3, 0x88, 0x8D, 0xB2, 0xAE, 0xE1, 0xD3, 0x0A, 0x71,
+    0xE7, 0xE1, 0x56, 0xD4, 0xA2, 0x1A, 0x93, 0x0A, 0x31, 0xD3, 0x2C, 0xE8, 0xDF, 0xE8, 0xE1, 0x5B,
+    0xB4, 0xF0, 0x2D, 0xEA, 0x2D, 0xD3, 0x1A, 0x92, 0x5F, 0xDA, 0xEE, 0x2C, 0x16, 0xFB, 0xDB, 0x9B,
+    0xEC, 0x2F, 0xC3, 0x02, 0x0F, 0x52, 0xCF, 0x1E, 0xAD, 0x5F, 0x87, 0xD9, 0x73, 0x06, 0x3C, 0x1E,
+    0x6A, 0xE1, 0x56, 0xEE, 0xFC, 0x1E, 0xDC, 0xFC, 0xE3, 0xC4, 0x21, 0x8E, 0xF9, 0xD3, 0xED, 0xD8,
+    0x7A, 0xCD, 0xEA, 0x0D, 0x93, 0xB5, 0x9D, 0xD5, 0xE6, 0xE4, 0x6C, 0xC4, 0xEF, 0x18, 0xE9, 0x1B,
+    0x1A, 0x3D, 0x9E, 0x67, 0x9F, 0x0A, 0x20, 0x44, 0xBC, 0x78, 0x3E, 0xCF, 0x14, 0x93, 0x2B, 0x28,
+    0x1F, 0xFA, 0xE1, 0xFA, 0xC1, 0x57, 0x6C, 0x15, 0x51, 0xA4, 0x2E, 0xF8, 0x9F, 0xBB, 0xBE, 0xA7,
+    0xC2, 0x11, 0x0E, 0x72, 0x6E, 0xC2, 0x12, 0xED, 0x67, 0x8D, 0xF6, 0xE2, 0xF8, 0x57, 0xEA, 0xC2,
+    0x68, 0x9F, 0x14, 0xDA, 0xA7, 0xBA, 0x16, 0x41, 0x33, 0xD1, 0x67, 0xE0, 0x50, 0x87, 0x09, 0xAC,
+    0xA1, 0xAB, 0xD9, 0x0B, 0xD7, 0x79, 0x3D, 0xFC, 0x62, 0xFE, 0x56, 0xA5, 0xB3, 0xE3, 0xF4, 0x12,
+    0xD7, 0xA7, 0x7F, 0x59, 0x10, 0x17, 0xE4, 0x8E, 0x27, 0xBD, 0xF6, 0xD8, 0xC7, 0xA8, 0xD2, 0xE0,
+    0x43, 0x54, 0xB9, 0xD8, 0x7F, 0xA5, 0xFA, 0x04, 0x43, 0x80, 0x89, 0xE8, 0xC1, 0xD6, 0x88, 0xF3,
+    0x7F, 0x44, 0x36, 0x00, 0x3F, 0xCD, 0x89, 0xFB, 0xEA, 0x58, 0x60, 0x89, 0x28, 0xB0, 0x36, 0xC7,
+    0x34, 0xBF, 0x7C, 0xA1, 0xEF, 0x7F, 0xD2, 0x23, 0x50, 0x21, 0x7A, 0x59, 0x41, 0xDE, 0x52, 0xF7,
+    0xCB, 0x25, 0x0D, 0x98, 0x58, 0xAC, 0xC7, 0xFE, 0x22, 0xB8, 0x66, 0x6B, 0xDF, 0x6A, 0x1F, 0xF5,
+    0x7B, 0xB2, 0x92, 0xC5, 0xBE, 0xEC, 0x20, 0x77, 0x1A, 0x39, 0xBC, 0x6A, 0x92, 0x4A, 0x95, 0xE5,
+    0xE5, 0xB5, 0xFE, 0xCC, 0xB0, 0x5C, 0x5A, 0xF8, 0xF7, 0xD6, 0xF2, 0xB4, 0xE4, 0x8B, 0x2B, 0x9F,
+    0xD8, 0x5F, 0x97, 0x45, 0xC4, 0xA4, 0x82, 0x2D, 0x7C, 0xC0, 0x34, 0x6C, 0x0F, 0x36, 0x77, 0x9A,
+    0xD9, 0x4B, 0xEC, 0x97, 0x0C, 0xE5, 0x59, 0x7C, 0x3C, 0xD1, 0x14, 0xA0, 0xBC, 0x45, 0x0C, 0x02,
+    0x87, 0x78, 0x5B, 0x97, 0x3C, 0x33, 0x66, 0x90, 0x34, 0x97, 0x1E, 0xDE, 0x64, 0x04, 0xB7, 0x22,
+    0x86, 0xD2, 0x5D, 0x58, 0x5C, 0x63, 0x92, 0xD7, 0xB6, 0x93, 0xEE, 0xFC, 0x1B, 0xEC, 0xC0, 0xFA,
+    0x5C, 0x3B, 0x19, 0xE5, 0xCC, 0xCD, 0xBE, 0x00, 0x23, 0x84, 0xA9, 0x62, 0x11, 0xD0, 0xB9, 0x44,
+    0xC3, 0x4C, 0xB3, 0xB1, 0x00, 0xD0, 0xD8, 0xAB, 0xB2, 0x5F, 0x20, 0x47, 0x09, 0x19, 0x6B, 0x09,
+    0xB5, 0xFB, 0x6C, 0x80, 0xA1, 0xE6, 0xF4, 0xAE, 0x4B, 0x03, 0x06, 0xB0, 0x24, 0x51, 0xF7, 0xC6,
+    0xBD, 0x86, 0x29, 0x04, 0x66, 0x14, 0x98, 0x60, 0x60, 0xBE, 0x81, 0x89, 0x08, 0x36, 0xDD, 0x48,
+    0xB1, 0xE1, 0x6F, 0x79, 0x1F, 0x3F, 0xC1, 0xCF, 0x6A, 0xE6, 0x01, 0xE9, 0x11, 0x91, 0xE3, 0xD7,
+    0x60, 0x99, 0x66, 0x8D, 0x33, 0x9B, 0x94, 0x72, 0x8A, 0x86, 0xCA, 0x77, 0x5C, 0xBF, 0x28, 0xC0,
+    0xBA, 0x8A, 0x6D, 0x69, 0x31, 0xBF, 0xB5, 0x0B, 0x04, 0x68, 0xE2, 0x8B, 0x39, 0x2F, 0x4D, 0x77,
+    0x69, 0xA6, 0x4B, 0x93, 0x5C, 0x9A, 0xDF, 0x3A, 0x88, 0xEE, 0xF0, 0xBA, 0x82, 0xFD, 0xD0, 0xED,
+    0xD0, 0xDD, 0xB0, 0x77, 0xCC, 0xAC, 0x52, 0x4F, 0x4A, 0xB7, 0x42, 0x35, 0x9B, 0x6E, 0x84, 0xEE,
+    0x83, 0x66, 0x64, 0xF3, 0xC9, 0x26, 0x8C, 0xAD, 0xF0, 0xFE, 0x40, 0x2B, 0xEC, 0xC4, 0xFD, 0x1A,
+    0x52, 0x93, 0x96, 0x87, 0x01, 0x47, 0x54, 0x0E, 0x26, 0xF2, 0x6E, 0xAD, 0x72, 0xDE, 0x31, 0x5E,
+    0xF9, 0xAE, 0x6C, 0x97, 0x75, 0x61, 0x61, 0x60, 0x3A, 0x17, 0xE7, 0xB7, 0xD0, 0x8D, 0x5C, 0x1A,
+    0x57, 0xC6, 0x85, 0xE9, 0xBA, 0x46, 0xE3, 0x71, 0xC4, 0xDE, 0xC4, 0x6E, 0x6F, 0x92, 0xED, 0xBD,
+    0x09, 0x27, 0x7B, 0xF3, 0xE0, 0x0D, 0xE2, 0x00, 0x32, 0x94, 0xBD, 0xCF, 0x06, 0xA9, 0x05, 0xE0,
+    0x99, 0x4A, 0x2A, 0xD9, 0x9B, 0xB2, 0x18, 0xF6, 0x86, 0x6B, 0x28, 0x8C, 0x47, 0xC8, 0x6D, 0x58,
+    0x17, 0x61, 0xD2, 0xCB, 0xB0, 0x11, 0x11, 0x50, 0xB7, 0xCB, 0xA2, 0xB9, 0x0C, 0xDA, 0xC1, 0xAD,
+    0xC9, 0xA9, 0x96, 0x73, 0x22, 0x91, 0xDC, 0xB8, 0x72, 0x02, 0x2D, 0x71, 0x60, 0xDA, 0x32, 0x60,
+    0xB2, 0x55, 0x53, 0x82, 0x9A, 0x57, 0x85, 0xCF, 0x92, 0x53, 0x95, 0xE7, 0x8C, 0x72, 0xE6, 0x74,
+    0x3A, 0xF3, 0x74, 0xE9, 0x14, 0xB9, 0xB4, 0xF7, 0x98, 0x16, 0xFC, 0x0F, 0xCD, 0xB8, 0x96, 0x4C,
+    0xC1, 0xA6, 0x35, 0x5A, 0x4D, 0xD2, 0x6A, 0xD6, 0xD6, 0xD7, 0xE4, 0xA3, 0xE6, 0x75, 0xF5, 0x89,
+    0x31, 0x9F, 0x1E, 0xD2, 0xEB, 0x76, 0x19, 0x4D, 0xEB, 0xD2, 0xDE, 0x29, 0x33, 0xDE, 0x9A, 0xEC,
+    0x76, 0x79, 0x6E, 0x8D, 0x93, 0xE4, 0x87, 0xE2, 0x24, 0x17, 0x26, 0xA7, 0xF8, 0x6B, 0xB5, 0xCC,
+    0x72, 0x7A, 0x48, 0x9A, 0x64, 0x38, 0x9D, 0x69, 0x06, 0xF5, 0x20, 0xB8, 0x87, 0x8F, 0xB7, 0xE4,
+    0x2A, 0x16, 0x96, 0xFE, 0x94, 0x3A, 0xE9, 0x0A, 0x35, 0x56, 0x49, 0xEC, 0xC6, 0x30, 0x77, 0xFA,
+    0x5F, 0xE4, 0x7C, 0x61, 0xC7, 0xA0, 0x55, 0x8A, 0xF8, 0x91, 0xB4, 0x21, 0x8B, 0x06, 0xC0, 0x4A,
+    0x68, 0xB4, 0xCD, 0xB3, 0x34, 0xA4, 0x75, 0x12, 0xE2, 0x6C, 0x2E, 0xF8, 0xAD, 0xEA, 0x34, 0x54,
+    0x75, 0x1A, 0x15, 0x5B, 0x9D, 0xBB, 0xA8, 0x62, 0x18, 0xD8, 0xA9, 0x95, 0x39, 0xB6, 0xB8, 0x1B,
+    0x93, 0xCD, 0x10, 0xD1, 0x00, 0x5B, 0x18, 0xD4, 0x83, 0xAB, 0x35, 0xD3, 0x14, 0x1E, 0x4C, 0xA9,
+    0xAD, 0xC6, 0x59, 0xCD, 0x77, 0x79, 0x95, 0x26, 0xC8, 0x75, 0xEE, 0xE2, 0x89, 0x8A, 0x91, 0xBA,
+    0xE0, 0xAF, 0x86, 0x1D, 0x82, 0x7A, 0xBA, 0x85, 0x43, 0x57, 0xBB, 0xD4, 0x98, 0x06, 0x2E, 0xEC,
+    0xC4, 0xD2, 0xDE, 0xD7, 0xED, 0x7B, 0x26, 0x37, 0xF5, 0x60, 0x28, 0x38, 0xD1, 0x50, 0xF0, 0xA8,
+    0xE1, 0xB7, 0xB4, 0x23, 0x2D, 0x55, 0x3A, 0x36, 0x83, 0xAE, 0xB1, 0x43, 0x94, 0x8A, 0x26, 0x2B,
+    0x3D, 0xE2, 0x52, 0xCD, 0x95, 0x43, 0xE1, 0x81, 0xD1, 0xE7, 0xB5, 0xE4, 0x8B, 0xE5, 0x07, 0x44,
+    0xE6, 0x4C, 0x11, 0xF1, 0x76, 0x42, 0x74, 0x52, 0xBC, 0x16, 0x36, 0xD7, 0xE0, 0x48, 0x95, 0x9F,
+    0xBD, 0x69, 0xAB, 0x12, 0x9B, 0x74, 0x91, 0x8F, 0x3D, 0xBF, 0xCB, 0x28, 0xFE, 0xDB, 0x2E, 0x86,
+    0xCF, 0x08, 0x7E, 0x0A, 0xAD, 0xCA, 0xBC, 0x3A, 0xB3, 0xED, 0xDB, 0x91, 0x7B, 0x4C, 0x37, 0x63,
+    0x23, 0x20, 0xD2, 0x0E, 0x8E, 0x37, 0xE3, 0xFF, 0x1A, 0x6A, 0x2A, 0x5C, 0xAA, 0x8E, 0xCF, 0x57,
+    0x23, 0xCE, 0x29, 0xEE, 0x53, 0x7C, 0x0B, 0x34, 0xB8, 0xF9, 0x62, 0x37, 0x86, 0xE5, 0xD2, 0x8D,
+    0x2F, 0x5E, 0x1F, 0x6E, 0x06, 0x8F, 0x0F, 0x80, 0xF6, 0x5F, 0xCC, 0xAC, 0x37, 0x79, 0x2F, 0x1A,
+    0x31, 0x07, 0xD2, 0xD9, 0x81, 0xE5, 0xBF, 0x20, 0xC6, 0x29, 0xAA, 0xC3, 0x9A, 0xE6, 0x19, 0xF9,
+    0xAE, 0xB4, 0xD5, 0x5C, 0xD7, 0xE9, 0x89, 0x24, 0x61, 0xA4, 0x6F, 0xFB, 0x2D, 0xCB, 0x4C, 0x65,
+    0x7D, 0xA9, 0xAC, 0x29, 0x69, 0xFF, 0x5E, 0xF5, 0xF4, 0xC8, 0x55, 0x4F, 0xAE, 0xBE, 0x49, 0x2B,
+    0xC5, 0x6C, 0xB7, 0x21, 0x07, 0x2C, 0x3B, 0x32, 0x6A, 0x53, 0xDF, 0x64, 0xFE, 0x66, 0xEB, 0x9B,
+    0x46, 0x5C, 0xDF, 0x3C, 0x3E, 0x75, 0x82, 0xEB, 0x9B, 0x10, 0x18, 0xB9, 0x36, 0xF1, 0xFD, 0xEB,
+    0x8D, 0x33, 0xD6, 0xB9, 0xE8, 0x2B, 0x5E, 0xD9, 0xF3, 0x09, 0x26, 0xDC, 0xE2, 0xA2, 0x51, 0xBB,
+    0x72, 0x65, 0xDD, 0xB8, 0xAE, 0xEC, 0x99, 0x06, 0x13, 0xB9, 0x9B, 0x66, 0xEE, 0xEC, 0xC6, 0xD7,
+    0xEB, 0xA9, 0x0C, 0x8F, 0xEE, 0xE7, 0xF3, 0x37, 0xD8, 0x0B, 0xBB, 0xB6, 0xFA, 0xC5, 0xE2, 0xE6,
+    0x03, 0x3F, 0xF7, 0x80, 0xBE, 0xD5, 0x5E, 0x64, 0x2F, 0x2D, 0x14, 0xCE, 0x94, 0xD4, 0x26, 0xF6,
+    0xAF, 0xAA, 0x4A, 0x52, 0xEB, 0x74, 0xEF, 0x50, 0x13, 0x7B, 0x6E, 0x8C, 0x0E, 0x96, 0x5F, 0x9A,
+    0xAB, 0xA2, 0x7D, 0xAA, 0xAB, 0x62, 0x2D, 0x9B, 0xFC, 0x96, 0x89, 0x5B, 0x39, 0x45, 0xA2, 0xEB,
+    0x6B, 0x94, 0xA6, 0xC9, 0xA6, 0xF5, 0x90, 0x03, 0x36, 0xB7, 0x31, 0x02, 0x9B, 0x7E, 0x6C, 0x50,
+    0xBD, 0xE6, 0xAD, 0x39, 0x85, 0xDC, 0xD9, 0x05, 0x5A, 0x84, 0xA4, 0x46, 0x00, 0x43, 0xE6, 0xE2,
+    0x61, 0x02, 0x21, 0x9E, 0x8E, 0xD2, 0x1A, 0xBA, 0x84, 0x71, 0xA7, 0x5E, 0x11, 0x0B, 0xB4, 0x4C,
+    0x7E, 0x67, 0x90, 0xCA, 0x47, 0x6D, 0xDC, 0x91, 0x71, 0x85, 0x33, 0xFD, 0x34, 0xC4, 0xAF, 0x01,
+    0xA8, 0xE5, 0x51, 0x95, 0x34, 0x5A, 0xBE, 0xA4, 0xB5, 0x4B, 0x5A, 0xB8, 0xA4, 0x55, 0x4B, 0x5A,
+    0xB2, 0xA4, 0xF5, 0x4A, 0x5A, 0xAC, 0xA4, 0x95, 0x4A, 0x5A, 0xA6, 0xA4, 0x35, 0x4A, 0x5A, 0xA0,
+    0xA4, 0xD5, 0x49, 0x5A, 0x9A, 0xA4, 0x75, 0x49, 0x5A, 0x94, 0xA4, 0x15, 0x49, 0x5A, 0x8E, 0xA4,
+    0xB5, 0x48, 0x5A, 0x88, 0xA4, 0x55, 0x48, 0x5A, 0x82, 0xA4, 0xF5, 0x47, 0x5A, 0x7C, 0xA4, 0x95,
+    0x47, 0x5A, 0x76, 0xA4, 0x35, 0x47, 0xAE, 0xE0, 0x88, 0xA1, 0xFC, 0x49, 0x3C, 0x7C, 0x39, 0xB8,
+    0x2C, 0x1A, 0x30, 0x3C, 0x37, 0x0D, 0x18, 0xB2, 0x22, 0x88, 0xF5, 0x40, 0xAC, 0x06, 0x62, 0x2D,
+    0x10, 0x2B, 0x81, 0x58, 0x07, 0xC4, 0x2A, 0xA0, 0x7E, 0x6C, 0xBA, 0x6F, 0xD6, 0x0C, 0x13, 0xD1,
+    0x39, 0x69, 0xE8, 0x52, 0xE7, 0x13, 0x56, 0x93, 0xF0, 0x20, 0xAF, 0x94, 0xFC, 0xED, 0x2A, 0x46,
+    0xDB, 0x44, 0x9B, 0xB6, 0x4D, 0x26, 0xA5, 0x3D, 0x93, 0xA0, 0xED, 0x55, 0xBA, 0xAC, 0x1F, 0x6D,
+    0x82, 0xB6, 0x7E, 0x9B, 0x14, 0x43, 0xB8, 0x76, 0xB6, 0x0C, 0xEB, 0x03, 0xE1, 0xDA, 0xCC, 0x63,
+    0xB8, 0x16, 0x9C, 0x28, 0xB9, 0xE9, 0x9B, 0x70, 0x6D, 0x06, 0x43, 0x20, 0x36, 0x81, 0x37, 0x33,
+    0xCE, 0xBB, 0x8C, 0xEA, 0x07, 0x04, 0x6A, 0x4B, 0x67, 0x9D, 0x39, 0x1D, 0x1A, 0xE4, 0x76, 0xAB,
+    0xC4, 0x9F, 0xE5, 0x6F, 0xD1, 0xCF, 0x91, 0x67, 0x01, 0x22, 0x78, 0xD1, 0x60, 0x60, 0x7F, 0xE9,
+    0x62, 0x09, 0x01, 0x5D, 0xFF, 0xA7, 0x16, 0xBC, 0x35, 0xE6, 0x92, 0xCB, 0x63, 0x95, 0xD9, 0x56,
+    0xC1, 0x99, 0xAB, 0xBA, 0x72, 0x51, 0xF2, 0x4D, 0xBA, 0xEB, 0xD4, 0xD1, 0xD5, 0xEE, 0x27, 0x34,
+    0xA8, 0x7B, 0x88, 0x3D, 0xDE, 0xD7, 0x62, 0xCF, 0xF3, 0x17, 0xEC, 0x3D, 0xA3, 0xC5, 0x84, 0x9A,
+    0xF5, 0x1C, 0xC2, 0xB7, 0x6A, 0xD8, 0x1D, 0xAA, 0x75, 0x11, 0x89, 0x43, 0x15, 0x75, 0x2F, 0x29,
+    0x6A, 0x5F, 0x8F, 0xC1, 0xD7, 0x92, 0xFE, 0x04, 0x54, 0x74, 0xB9, 0x24, 0xA6, 0x4A, 0xD4, 0x37,
+    0xCE, 0x15, 0xB5, 0x77, 0x44, 0xED, 0xC1, 0x8A, 0xA8, 0x5D, 0x2C, 0x2D, 0x50, 0x3B, 0xE4, 0xB7,
+    0x54, 0xEC, 0x2D, 0xDD, 0x6D, 0x22, 0x73, 0x79, 0x2C, 0x3A, 0xDA, 0xA6, 0x12, 0x5B, 0x85, 0x8E,
+    0xC9, 0xBA, 0x12, 0x07, 0x18, 0xA8, 0xBD, 0x23, 0x6A, 0x7F, 0x95, 0x01, 0xA6, 0xF4, 0x0F, 0xF4,
+    0xAB, 0xE2, 0xFF, 0xAC, 0x89, 0xDA, 0x11, 0x37, 0x10, 0xEF, 0xDC, 0x4E, 0x51, 0x7B, 0x60, 0x89,
+    0xDA, 0x43, 0x15, 0xD9, 0xE8, 0xF7, 0x84, 0x84, 0x41, 0xB6, 0xFD, 0x85, 0x21, 0xD6, 0x12, 0x10,
+    0x5C, 0x52, 0x82, 0xC9, 0x89, 0xDB, 0x58, 0xF7, 0xB6, 0xAB, 0xE1, 0xED, 0xF9, 0xF0, 0xC4, 0x3E,
+    0x5F, 0xFA, 0x7A, 0x0E, 0x15, 0x93, 0x97, 0x3C, 0x73, 0x82, 0xC9, 0x83, 0x7B, 0xE2, 0x47, 0x84,
+    0x9F, 0x8A, 0x47, 0x11, 0x7F, 0x2C, 0x98, 0x3C, 0x05, 0x1C, 0xEF, 0xA4, 0xF1, 0x5B, 0xC1, 0xE4,
+    0xB3, 0x46, 0x30, 0x79, 0x24, 0xFA, 0xA8, 0x4C, 0x8A, 0x60, 0x95, 0x96, 0xC8, 0x7B, 0xAE, 0x71,
+    0x24, 0x56, 0xB2, 0x2A, 0x1D, 0x0A, 0xC8, 0x20, 0xBD, 0x22, 0xF3, 0xFB, 0xFE, 0x08, 0xA4, 0xBD,
+    0x1B, 0xDC, 0x23, 0xCB, 0x48, 0x61, 0xFA, 0x2A, 0x2B, 0xC3, 0xAB, 0xDB, 0xB4, 0x53, 0x09, 0x83,
+    0x0E, 0xC8, 0x41, 0x9A, 0xB3, 0xDE, 0xF3, 0x96, 0x77, 0xBC, 0x54, 0xDC, 0x00, 0xAF, 0xE9, 0x76,
+    0x09, 0xB7, 0x7D, 0x6A, 0x8A, 0x8F, 0x20, 0x6D, 0x09, 0x42, 0x11, 0xA7, 0x37, 0x3A, 0xF2, 0x78,
+    0x55, 0xE4, 0x05, 0x7A, 0x07, 0x54, 0x06, 0x01, 0xB5, 0xCB, 0xAC, 0x46, 0x2C, 0x24, 0xCA, 0xBC,
+    0x25, 0x66, 0x65, 0x9E, 0xBB, 0xFC, 0xAE, 0xB7, 0xA0, 0xBE, 0x5E, 0xBA, 0xD8, 0x72, 0x6B, 0x3E,
+    0x12, 0xE3, 0x6A, 0x5E, 0xC6, 0x4A, 0x4E, 0x3D, 0x0D, 0x16, 0x2F, 0xFC, 0x6B, 0x26, 0xBF, 0x8C,
+    0x53, 0x2E, 0xDA, 0xA8, 0x4E, 0x85, 0x17, 0xA2, 0x4C, 0x5B, 0xE1, 0xF1, 0xB9, 0x0D, 0x6F, 0x73,
+    0x8D, 0x27, 0xF4, 0x7C, 0x3F, 0xAC, 0x44, 0x74, 0x3E, 0xDF, 0x93, 0xFB, 0xD6, 0x7C, 0x83, 0x7E,
+    0x94, 0xB2, 0xD2, 0x61, 0x6C, 0x79, 0xBF, 0x83, 0xA3, 0x9F, 0xFE, 0x2B, 0x14, 0x19, 0xDC, 0x9D,
+    0x70, 0x29, 0xD3, 0xF7, 0x57, 0xA3, 0x34, 0x9E, 0x1A, 0x67, 0x45, 0x85, 0x81, 0xA8, 0x94, 0x0F,
+    0x8F, 0x3B, 0xEC, 0x5E, 0xC0, 0x57, 0x14, 0x34, 0x0A, 0x49, 0xB7, 0x99, 0x71, 0x45, 0x9E, 0x4D,
+    0xF1, 0xA0, 0xC0, 0x20, 0x6D, 0x16, 0x02, 0xE3, 0xFA, 0xD1, 0xD2, 0x96, 0x23, 0x96, 0xD2, 0x80,
+    0x90, 0x80, 0x8A, 0x6C, 0x66, 0x7F, 0x55, 0x66, 0x60, 0x69, 0xE6, 0xD2, 0x6E, 0xD8, 0x8E, 0x9D,
+    0xEB, 0x78, 0x58, 0x21, 0x97, 0xEB, 0x60, 0xE9, 0x37, 0xB3, 0xCA, 0x34, 0xDE, 0xC4, 0x71, 0x38,
+    0x4E, 0x0E, 0x99, 0x9D, 0x1B, 0xBC, 0x52, 0x40, 0x1C, 0x97, 0xC6, 0x6F, 0xC4, 0xAF, 0x09, 0x2A,
+    0xF3, 0x5B, 0x18, 0x85, 0xB3, 0x4F, 0x83, 0x39, 0x97, 0xDE, 0xBF, 0x21, 0xA3, 0x5B, 0x16, 0x8E,
+    0xF0, 0x40, 0xAD, 0xC5, 0x69, 0x7F, 0x45, 0x66, 0x75, 0x6A, 0xE2, 0x59, 0xE5, 0x16, 0xD5, 0x23,
+    0x8D, 0x18, 0xD3, 0x7D, 0x9E, 0xA7, 0x27, 0xFD, 0xDE, 0xE9, 0xB3, 0xE1, 0x19, 0x10, 0xA1, 0xF4,
+    0x7D, 0x7C, 0x9B, 0xA4, 0xC4, 0x49, 0xCC, 0x3C, 0x88, 0xCF, 0xBB, 0x22, 0x3D, 0xA7, 0x26, 0x30,
+    0x02, 0x07, 0xF7, 0x49, 0xBE, 0x17, 0x62, 0x46, 0x85, 0xD5, 0xB1, 0x98, 0x8C, 0x57, 0x44, 0x67,
+    0xBE, 0x6B, 0x22, 0x59, 0xBC, 0xF7, 0x54, 0xCA, 0xB2, 0xBD, 0x45, 0x16, 0xA1, 0xCA, 0x66, 0x7D,
+    0xCB, 0xBC, 0xB7, 0x32, 0xFF, 0xB4, 0x3B, 0x2A, 0x96, 0xEE, 0x31, 0xFE, 0xBF, 0xE3, 0x53, 0x13,
+    0xF3, 0x64, 0xBA, 0xB3, 0xC9, 0xD3, 0x49, 0x6B, 0xED, 0xFC, 0xC9, 0x8F, 0x34, 0xD8, 0x7E, 0xEE,
+    0x70, 0x88, 0xE3, 0x24, 0x94, 0x5D, 0x43, 0xCC, 0x15, 0x8D, 0xB1, 0x42, 0x4A, 0x4D, 0x07, 0x44,
+    0x9D, 0xB2, 0x3E, 0x11, 0xF6, 0xE3, 0x2D, 0xBB, 0x56, 0x75, 0xE0, 0x14, 0x82, 0xAA, 0x04, 0x7C,
+    0x94, 0xE9, 0x0F, 0xAA, 0x05, 0x33, 0x55, 0x0C, 0x27, 0x6A, 0x47, 0x8C, 0xBF, 0x30, 0xAE, 0x4A,
+    0xAC, 0x1C, 0x8C, 0xA9, 0xE7, 0x8C, 0xE9, 0xB9, 0xA7, 0xB1, 0x19, 0x3C, 0x24, 0x5B, 0xC6, 0x6B,
+    0x38, 0x1C, 0x3C, 0x1A, 0xDB, 0x07, 0x23, 0xB7, 0x7F, 0x86, 0xCA, 0x92, 0x89, 0x03, 0xAE, 0xC9,
+    0x21, 0xDE, 0xB1, 0x45, 0xEE, 0x78, 0xC4, 0xA9, 0xB9, 0xF9, 0xA1, 0x19, 0x7F, 0x8C, 0x6A, 0x77,
+    0x8B, 0x67, 0x33, 0x46, 0xAE, 0x73, 0x30, 0x04, 0x70, 0x02, 0xDF, 0x0B, 0xA9, 0x35, 0xB5, 0x9D,
+    0x6B, 0xF5, 0x86, 0x86, 0xE8, 0x19, 0x33, 0x62, 0x08, 0x7F, 0x33, 0x32, 0x07, 0x65, 0x0A, 0xC0,
+    0xEB, 0x2E, 0xBD, 0x2A, 0xDA, 0x12, 0xDF, 0xBD, 0x93, 0x91, 0x83, 0x26, 0x29, 0xBC, 0x56, 0x3C,
+    0x83, 0x77, 0xFD, 0x66, 0xA3, 0x2D, 0xBD, 0x3D, 0xB9, 0xBE, 0x0E, 0x1A, 0xDB, 0x06, 0xFF, 0xD3,
+    0x5F, 0x0B, 0x84, 0xDD, 0x88, 0x4D, 0x22, 0xC1, 0x84, 0xA8, 0x0D, 0xB0, 0x18, 0xDF, 0x5F, 0x43,
+    0x59, 0x1E, 0x30, 0x61, 0xC1, 0x51, 0x26, 0xEC, 0x19, 0x62, 0xD1, 0xA8, 0x50, 0xDF, 0x33, 0xEF,
+    0xFD, 0xD6, 0xBC, 0x78, 0xD6, 0x29, 0xD4, 0xF9, 0x3A, 0xB4, 0xEB, 0xB4, 0x5F, 0xDB, 0x1B, 0x32,
+    0x41, 0x91, 0x51, 0xCB, 0x5C, 0x78, 0xCF, 0xFF, 0x0F, 0xD5, 0xA7, 0x3B, 0x1F, 0x5E, 0x62, 0x30,
+    0x36, 0x21, 0x32, 0xA6, 0xDB, 0x7A, 0x95, 0xAC, 0x49, 0x32, 0x26, 0xB1, 0x2A, 0x96, 0x89, 0x67,
+    0xA7, 0x9E, 0xCF, 0x42, 0xD6, 0x0D, 0x9C, 0x98, 0x3D, 0x04, 0x4E, 0x1C, 0x6F, 0x65, 0xFE, 0x3B,
+    0xFB, 0xE3, 0x77, 0x24, 0x23, 0xCE, 0x36, 0x31, 0x08, 0x72, 0xBD, 0x6C, 0x50, 0x28, 0x7A, 0x6E,
+    0x62, 0xAF, 0x9F, 0xAF, 0xB2, 0x61, 0x11, 0xD0, 0x11, 0x54, 0xB4, 0x08, 0xAB, 0x11, 0x54, 0xFC,
+    0x78, 0x0B, 0x54, 0x1C, 0xFF, 0xF7, 0x52, 0x2E, 0xC2, 0x41, 0x84, 0x5F, 0xC9, 0x3C, 0x89, 0x2C,
+    0xE1, 0x62, 0x16, 0xD7, 0x03, 0x88, 0x49, 0x8A, 0xB1, 0xA9, 0x86, 0x90, 0x47, 0xC4, 0xCC, 0x31,
+    0xCD, 0x12, 0x17, 0xC7, 0x15, 0x79, 0xB4, 0x4F, 0xFC, 0x7A, 0x93, 0x7E, 0x87, 0x28, 0xDE, 0xAE,
+    0x2C, 0x66, 0xC3, 0x1F, 0xE3, 0xFA, 0x87, 0x48, 0x69, 0xA7, 0x5F, 0xDD, 0xB4, 0x88, 0x84, 0xAD,
+    0x11, 0xB8, 0xA9, 0x5D, 0x3E, 0x42, 0x5F, 0xD7, 0x87, 0x40, 0x8A, 0xBF, 0x9D, 0x5E, 0x27, 0x68,
+    0xE7, 0xE6, 0x9F, 0xDE, 0x83, 0x4E, 0xBF, 0x13, 0x5A, 0xDB, 0x26, 0x9F, 0x7D, 0x07, 0x6B, 0x3D,
+    0x9B, 0xBA, 0xEF, 0xDB, 0xC2, 0x58, 0xC5, 0x88, 0x32, 0xD3, 0xDE, 0xF4, 0xFA, 0x97, 0x59, 0x4C,
+    0xBE, 0xD2, 0x94, 0x35, 0x87, 0xC5, 0x4C, 0xD7, 0x2F, 0x89, 0x56, 0x49, 0x3F, 0x78, 0x6B, 0x25,
+    0x53, 0x58, 0xF2, 0xAF, 0x74, 0x0C, 0x85, 0x7C, 0x30, 0x0E, 0x78, 0x26, 0x5C, 0x06, 0xC4, 0x5C,
+    0x51, 0x48, 0x12, 0x6B, 0xD4, 0x8A, 0x01, 0xBB, 0xAC, 0x9C, 0xB4, 0xDB, 0x29, 0x9E, 0x67, 0xA1,
+    0x9D, 0xBE, 0x2E, 0x14, 0x66, 0xD8, 0x3E, 0xF7, 0x5D, 0x64, 0xFD, 0x56, 0xCB, 0xBB, 0x66, 0xA8,
+    0x5D, 0x70, 0x21, 0xFB, 0x7F, 0x80, 0x5B, 0xE8, 0x62, 0xDE, 0x6B, 0x4D, 0xD0, 0x27, 0x2E, 0xFE,
+    0xF5, 0x42, 0x37, 0xCF, 0x7C, 0x77, 0xED, 0x51, 0xDF, 0xF4, 0xF6, 0xC1, 0x65, 0xFB, 0x41, 0x46,
+    0xFB, 0x11, 0xC3, 0x86, 0xEC, 0xDD, 0x9F, 0xBF, 0xD1, 0x34, 0x2A, 0x88, 0x50, 0x4E, 0x08, 0x3F,
+    0x22, 0xB7, 0x37, 0x2D, 0xCE, 0x57, 0x5E, 0x7F, 0xF7, 0x90, 0x28, 0x6D, 0xE4, 0x89, 0x6E, 0x09,
+    0xEA, 0x12, 0xF0, 0x45, 0x57, 0x1F, 0x0E, 0x06, 0x4F, 0x57, 0xFE, 0xBF, 0xA2, 0xE5, 0x7F, 0xA4,
+    0xB5, 0x13, 0xF1, 0xF8, 0x59, 0xEA, 0xEE, 0x60, 0x53, 0x0E, 0xB1, 0x1A, 0xBE, 0x34, 0xAB, 0x09,
+    0xB3, 0xA5, 0x93, 0x5E, 0xD6, 0x9A, 0x24, 0xD0, 0xFF, 0x32, 0x1E, 0x33, 0x53, 0x57, 0x18, 0xAD,
+    0x43, 0xA1, 0x64, 0xB9, 0x3F, 0x26, 0x3A, 0xCE, 0xEF, 0x62, 0xA2, 0xA8, 0x79, 0x58, 0x26, 0xBF,
+    0x8C, 0x57, 0xA7, 0x68, 0x69, 0xA7, 0x70, 0x87, 0x7F, 0x8D, 0x07, 0x21, 0x0A, 0x17, 0xE3, 0xB3,
+    0x19, 0x3D, 0xA3, 0x16, 0x99, 0x70, 0x26, 0x2D, 0x7B, 0x17, 0x31, 0x2B, 0x1D, 0xDD, 0xD3, 0xB7,
+    0xA2, 0xA8, 0x02, 0xC8, 0x59, 0x94, 0x71, 0xCA, 0x01, 0x69, 0x0D, 0xEC, 0x22, 0x40, 0xC9, 0x1D,
+    0xFD, 0xD3, 0x44, 0xA8, 0x4D, 0x4B, 0x32, 0xEC, 0xEC, 0x76, 0x6D, 0x5A, 0x73, 0x74, 0x6D, 0xDA,
+    0x20, 0x1E, 0xD1, 0xE4, 0xEB, 0x17, 0xDF, 0xA0, 0x9D, 0xCF, 0xE7, 0x57, 0x98, 0x3B, 0xB3, 0x43,
+    0x2B, 0x50, 0xF4, 0x37, 0x8F, 0x37, 0xE6, 0xA4, 0x7D, 0x7B, 0x58, 0xD6, 0xB7, 0x57, 0x72, 0x87,
+    0x43, 0x9E, 0xBE, 0x06, 0x5D, 0x95, 0x5E, 0xC1, 0xF1, 0x4D, 0xCB, 0x0F, 0x64, 0xBF, 0xD3, 0x15,
+    0xFF, 0xB2, 0xD1, 0xD2, 0xFD, 0x69, 0xA2, 0x19, 0x5B, 0xFC, 0x89, 0x80, 0x62, 0xD2, 0x66, 0x8F,
+    0xD9, 0xFE, 0x3F, 0xA5, 0x56, 0xBD, 0x6F, 0xDB, 0x46, 0x14, 0xFF, 0x9D, 0x28, 0x9B, 0x49, 0x88,
+    0x98, 0x1A, 0x1C, 0x20, 0x48, 0x52, 0x33, 0x83, 0x07, 0xD7, 0x88, 0xC3, 0xC5, 0x83, 0x81, 0x4A,
+    0xE6, 0xB5, 0x43, 0x33, 0x15, 0xD5, 0x10, 0xA5, 0x43, 0x86, 0x78, 0x4D, 0x80, 0xC2, 0x2A, 0x60,
+    0xA0, 0x2A, 0x2A, 0x8B, 0xFC, 0x13, 0x0C, 0xB4, 0xE8, 0xD2, 0xC5, 0x43, 0x0A, 0x38, 0xEA, 0x10,
+    0x0D, 0x19, 0x0C, 0xC4, 0x16, 0x99, 0xBF, 0xA0, 0x0C, 0xD0, 0x34, 0x53, 0x01, 0x02, 0x69, 0x8A,
+    0x8E, 0x2C, 0xCA, 0xA0, 0x6C, 0x4B, 0xE9, 0xFA, 0xDE, 0x89, 0x4A, 0x62, 0x27, 0x0D, 0x02, 0xF4,
+    0x3E, 0x74, 0xE7, 0x77, 0xEF, 0xDE, 0xBD, 0xAF, 0xDF, 0xA3, 0x6F, 0x49, 0x78, 0x11, 0xEC, 0x04,
+    0x46, 0x06, 0x14, 0x80, 0x07, 0xCC, 0x00, 0x7D, 0x88, 0x31, 0x8C, 0x02, 0x56, 0x0A, 0x3B, 0x62,
+    0xDA, 0x3C, 0x80, 0xE5, 0x00, 0xF0, 0x13, 0x08, 0x95, 0xC1, 0x78, 0x56, 0xC0, 0x8E, 0x7D, 0x3A,
+    0xB1, 0xA3, 0x79, 0x08, 0x29, 0x76, 0xB0, 0x61, 0x8F, 0x91, 0xBA, 0xEA, 0xD7, 0xB4, 0xE1, 0xA8,
+    0xB8, 0x2B, 0x94, 0xAC, 0xD1, 0x95, 0x33, 0xAD, 0xAB, 0xA1, 0x1A, 0xD3, 0xA0, 0xCD, 0xAD, 0x7E,
+    0xFF, 0x8E, 0x2A, 0x1B, 0x1D, 0x61, 0x80, 0xB9, 0x7D, 0x5C, 0xF6, 0xAE, 0x15, 0xAE, 0xCA, 0x4C,
+    0x15, 0xD3, 0x13, 0x4B, 0xA1, 0x1A, 0xCE, 0x57, 0x51, 0xF3, 0x50, 0xF8, 0x28, 0xE8, 0x97, 0xF6,
+    0x43, 0xA9, 0xD2, 0x6B, 0x39, 0x69, 0x96, 0x9F, 0x4F, 0xDD, 0xE0, 0x32, 0x16, 0x20, 0x6E, 0xC3,
+    0x56, 0x70, 0xAF, 0x47, 0x75, 0x83, 0x47, 0xC3, 0x88, 0x9C, 0xBB, 0x81, 0x35, 0x06, 0x6A, 0x10,
+    0x7B, 0xA7, 0x76, 0x8D, 0xDC, 0x89, 0xAC, 0xD4, 0x93, 0x76, 0x34, 0x24, 0xF5, 0x72, 0x74, 0x8D,
+    0x04, 0x35, 0x21, 0xF1, 0x2E, 0x66, 0x03, 0x97, 0xBA, 0x95, 0x0C, 0x61, 0xFC, 0x93, 0x03, 0x2A,
+    0x05, 0x9B, 0xCE, 0xE6, 0xDE, 0x1C, 0x72, 0xBB, 0x79, 0x73, 0x76, 0x67, 0x48, 0xC7, 0x2F, 0x0D,
+    0xA2, 0xDC, 0xFA, 0x60, 0x0F, 0xDE, 0x83, 0x91, 0x36, 0xD7, 0x24, 0x15, 0x44, 0x6E, 0x45, 0xE8,
+    0x56, 0x52, 0x54, 0xD1, 0xC4, 0x12, 0x10, 0x92, 0x24, 0x60, 0x88, 0xC1, 0x3C, 0x9B, 0xD3, 0xFB,
+    0xE6, 0x85, 0x39, 0xA2, 0x2F, 0x6D, 0x95, 0x7A, 0xAA, 0xD8, 0xC6, 0xF6, 0x3D, 0x2C, 0xD4, 0x50,
+    0xAD, 0xC4, 0x66, 0x6C, 0x45, 0x76, 0xE4, 0x06, 0x5E, 0xE0, 0xC9, 0x90, 0x2E, 0xB6, 0xC8, 0xF5,
+    0x76, 0xE2, 0xC4, 0x2E, 0xD3, 0x48, 0xDF, 0x6D, 0x1C, 0xE0, 0x2A, 0x49, 0x0B, 0x41, 0xCE, 0x95,
+    0x6E, 0xE0, 0x10, 0xB7, 0x15, 0x1B, 0x89, 0x68, 0x5A, 0x9A, 0xCF, 0x61, 0x3E, 0x39, 0xE5, 0xBB,
+    0x25, 0xBD, 0xC8, 0x89, 0xCD, 0x54, 0x14, 0xE8, 0xA1, 0x2A, 0xFA, 0x46, 0x61, 0x66, 0x76, 0xEC,
+    0xC9, 0x6D, 0xF2, 0x05, 0x1A, 0x68, 0x2C, 0x1F, 0xFA, 0xA3, 0xE5, 0x11, 0xEF, 0x80, 0x2E, 0xF5,
+    0xDE, 0x9E, 0x3F, 0xF2, 0xF7, 0x78, 0x47, 0xD1, 0xEC, 0xEF, 0xFA, 0x2A, 0xA5, 0x01, 0xF1, 0xCA,
+    0xC0, 0x2E, 0x6E, 0x6A, 0xB3, 0xC6, 0x10, 0x23, 0xCE, 0x03, 0x37, 0x85, 0x8A, 0xF0, 0x17, 0x87,
+    0x0D, 0x02, 0x2E, 0x29, 0x98, 0xEA, 0x3E, 0xA4, 0xBD, 0x20, 0x9A, 0x11, 0x71, 0xBF, 0xFE, 0x54,
+    0xA9, 0x90, 0x02, 0xC1, 0x11, 0x36, 0xE3, 0x09, 0x8D, 0xFB, 0x27, 0x8F, 0x98, 0xC2, 0xBB, 0x4A,
+    0x70, 0xA6, 0x25, 0x7D, 0x15, 0x7B, 0x24, 0x6D, 0x8F, 0x82, 0xFA, 0xBC, 0x8B, 0x22, 0xCC, 0xC3,
+    0xD4, 0x0F, 0x8E, 0x10, 0x31, 0x42, 0x98, 0x7B, 0xB9, 0x95, 0x9D, 0x84, 0xC7, 0x1E, 0x0B, 0x4E,
+    0xE2, 0x58, 0x76, 0xBC, 0x21, 0x17, 0x4E, 0xED, 0xD8, 0x91, 0x13, 0xB8, 0x58, 0x27, 0x6B, 0x6B,
+    0xA4, 0xA0, 0x19, 0xD8, 0xC9, 0x6C, 0x41, 0x7F, 0xAE, 0x63, 0x18, 0x16, 0x61, 0x0C, 0x69, 0x24,
+    0xC4, 0xA1, 0x09, 0x1E, 0xDC, 0xC2, 0x2E, 0x9E, 0xE7, 0x01, 0x5B, 0x19, 0x2A, 0x95, 0xF0, 0x3C,
+    0x80, 0x71, 0x64, 0xF2, 0xD9, 0x52, 0x25, 0x58, 0xE2, 0x07, 0xDD, 0x1B, 0xCF, 0x72, 0x5B, 0xA9,
+    0x54, 0xDC, 0x3E, 0x27, 0x8F, 0xA6, 0x57, 0x71, 0x24, 0xBD, 0x34, 0x72, 0xE8, 0xC5, 0xD7, 0x21,
+    0x67, 0x82, 0x82, 0xDE, 0xB5, 0x37, 0xA5, 0x0D, 0xA1, 0x6B, 0xC7, 0x19, 0x89, 0xC4, 0x53, 0x8F,
+    0xE3, 0x03, 0x47, 0x45, 0x59, 0x45, 0x51, 0xEE, 0xBD, 0x82, 0xAE, 0xFE, 0x8E, 0x4F, 0x6E, 0x8E,
+    0xF5, 0x0F, 0xAB, 0x39, 0x05, 0x5B, 0x8B, 0x1A, 0xCA, 0xF6, 0x32, 0x4D, 0x83, 0x76, 0x04, 0x7A,
+    0xEA, 0x71, 0xB2, 0x4D, 0x62, 0xEF, 0x95, 0xA0, 0x3D, 0x0E, 0xD4, 0x50, 0xEF, 0xC6, 0xE5, 0xC2,
+    0x0F, 0x11, 0x03, 0x97, 0x04, 0x4A, 0x3B, 0xAB, 0xA0, 0x92, 0x60, 0x52, 0x08, 0x32, 0x0A, 0x11,
+    0x2E, 0x4C, 0x9F, 0xE1, 0x72, 0x41, 0x3E, 0x20, 0xF8, 0xA1, 0x42, 0x75, 0xC5, 0x20, 0x5F, 0x98,
+    0xA4, 0x13, 0x21, 0x07, 0x36, 0xF9, 0xC2, 0x95, 0xBA, 0xD0, 0x50, 0xD2, 0x82, 0xF2, 0x58, 0xB3,
+    0x89, 0x29, 0x5B, 0x52, 0xB2, 0xD1, 0x74, 0x4A, 0xB6, 0xF5, 0x92, 0xAD, 0x78, 0xC1, 0xC6, 0x81,
+    0xB0, 0xE2, 0x57, 0xD9, 0xB8, 0x35, 0xC1, 0x70, 0xB0, 0x75, 0x1F, 0x92, 0x6C, 0xA9, 0xA9, 0xC7,
+    0x03, 0x39, 0x0D, 0x30, 0x9F, 0x79, 0x4A, 0x15, 0x3C, 0xEB, 0x40, 0x7D, 0x3A, 0x1B, 0xAD, 0x56,
+    0x97, 0x69, 0xCB, 0xFD, 0xFE, 0x1E, 0x05, 0x38, 0xE0, 0x40, 0xBB, 0x56, 0xBA, 0xCF, 0x81, 0xE7,
+    0x04, 0x00, 0x16, 0xCF, 0x1E, 0xF6, 0xBC, 0xC2, 0x4E, 0x9D, 0xCC, 0x1F, 0x75, 0x1B, 0xB5, 0x2A,
+    0xA4, 0x13, 0x7B, 0xC1, 0x36, 0x81, 0xCD, 0x25, 0xBD, 0xCC, 0xC8, 0x24, 0x54, 0xFB, 0x8C, 0xC4,
+    0xB7, 0x88, 0x45, 0x1F, 0x7E, 0xE0, 0x52, 0xDD, 0xAA, 0xE4, 0x38, 0xA4, 0x24, 0xEF, 0xA3, 0x42,
+    0xB8, 0xCB, 0xB9, 0x2E, 0xBB, 0x01, 0xBB, 0x89, 0xA4, 0xFC, 0x57, 0x16, 0x90, 0xA0, 0x40, 0xC5,
+    0x96, 0x2E, 0x2D, 0xCE, 0x54, 0xB6, 0x9D, 0x62, 0xDE, 0x79, 0x88, 0x9E, 0xFB, 0x43, 0x14, 0x7A,
+    0x1F, 0xC7, 0xBD, 0x75, 0x3B, 0xAA, 0x76, 0x85, 0x96, 0xD3, 0xD3, 0xDD, 0x6F, 0x7A, 0xA9, 0x9D,
+    0x90, 0x71, 0xFD, 0x80, 0xAC, 0x54, 0x91, 0xD7, 0xEF, 0xDF, 0x8D, 0xA8, 0x4C, 0x98, 0x2F, 0xFD,
+    0xD4, 0x19, 0xD8, 0x6F, 0xA3, 0xFD, 0x6B, 0x0B, 0x27, 0x95, 0x9A, 0xD1, 0xF2, 0xA1, 0x2E, 0x3E,
+    0xDC, 0x45, 0x00, 0xF1, 0x55, 0xBC, 0xE3, 0xA8, 0x07, 0x13, 0x0B, 0xA8, 0x04, 0x64, 0x3D, 0xB2,
+    0x80, 0x02, 0xAA, 0x7D, 0x74, 0x8A, 0xA6, 0x1B, 0x4C, 0x26, 0x45, 0xF4, 0x75, 0xD6, 0xD6, 0x66,
+    0x8E, 0xF2, 0x68, 0x6C, 0x01, 0xD2, 0xCA, 0x8D, 0xC8, 0x55, 0xDF, 0x46, 0xF4, 0xE5, 0x91, 0x75,
+    0xFA, 0x70, 0x71, 0x33, 0x33, 0xAA, 0x05, 0xEA, 0x4A, 0xB4, 0xBE, 0xA9, 0x82, 0x3A, 0xDF, 0x2D,
+    0x03, 0x21, 0xA2, 0x55, 0x58, 0x8F, 0x7A, 0x1C, 0x72, 0xBA, 0xA3, 0x02, 0x6D, 0x6A, 0x70, 0xB1,
+    0x34, 0xAA, 0x12, 0x98, 0x89, 0x93, 0x9F, 0xFF, 0xCD, 0x88, 0x27, 0xDD, 0xCF, 0x0C, 0x15, 0x39,
+    0xA3, 0x72, 0xF9, 0xA2, 0x49, 0xF5, 0x7A, 0xE6, 0xD3, 0x8E, 0x66, 0x5D, 0xE9, 0xE8, 0x34, 0xA7,
+    0x65, 0xAE, 0x3E, 0xC0, 0x0A, 0x30, 0x37, 0x3F, 0xD0, 0x95, 0x50, 0xFB, 0xAC, 0x12, 0xF0, 0xC0,
+    0x09, 0xA2, 0x2C, 0xA2, 0xF6, 0x0E, 0x2D, 0x9D, 0x6A, 0xA7, 0xCA, 0xA6, 0xAE, 0x74, 0x58, 0x91,
+    0xEA, 0x4A, 0xA7, 0xCE, 0x42, 0x56, 0x3A, 0x8B, 0xB4, 0x9C, 0x5D, 0x29, 0x65, 0x2E, 0x6A, 0xCE,
+    0xB3, 0xE0, 0x65, 0x95, 0x94, 0x95, 0x3C, 0xA6, 0x32, 0xC5, 0x47, 0xF8, 0x4C, 0xA2, 0x7C, 0x8F,
+    0x2E, 0x2C, 0x4D, 0x94, 0xC0, 0x8B, 0xE5, 0xA8, 0xBA, 0x35, 0x42, 0x84, 0xFB, 0x4B, 0x85, 0x6A,
+    0xAB, 0x93, 0x7B, 0x72, 0x91, 0x0A, 0xB5, 0x23, 0x7B, 0xD8, 0xC7, 0x3D, 0x9A, 0x3D, 0xDA, 0x53,
+    0x3A, 0xB4, 0x60, 0xA9, 0xC4, 0x55, 0x45, 0xEF, 0xFD, 0xC3, 0x7D, 0x2C, 0x6C, 0x6C, 0x9F, 0xE4,
+    0xA2, 0x4F, 0xE3, 0x50, 0x83, 0xB8, 0xD6, 0xE8, 0x4E, 0xF3, 0xFB, 0x12, 0x6B, 0x5B, 0x45, 0xF7,
+    0x7C, 0xEE, 0xD1, 0xF7, 0xC5, 0x4D, 0x2B, 0x05, 0x2E, 0xD4, 0x28, 0xAA, 0x5E, 0x62, 0x96, 0xF2,
+    0x57, 0x35, 0xCE, 0x72, 0x42, 0x62, 0x48, 0x5F, 0x28, 0x2B, 0x0B, 0x03, 0x33, 0xFB, 0x33, 0x72,
+    0x7F, 0xFF, 0x23, 0x1E, 0x1B, 0x0F, 0xD3, 0xC4, 0x88, 0xD2, 0x26, 0x61, 0xD0, 0x87, 0x2D, 0x2D,
+    0x69, 0x4B, 0x9F, 0xF6, 0x4D, 0x8A, 0xF9, 0xB4, 0xAE, 0x57, 0x02, 0x23, 0xFA, 0xFC, 0xE7, 0x70,
+    0x7C, 0xE3, 0x99, 0x93, 0xAD, 0x1F, 0x9C, 0xB8, 0x38, 0x9B, 0xBB, 0x94, 0x2A, 0x2A, 0x6B, 0x58,
+    0x49, 0x97, 0x11, 0xC7, 0x93, 0xF7, 0x4C, 0x33, 0x73, 0x37, 0xAE, 0x92, 0xC7, 0xEB, 0xF0, 0x46,
+    0x7E, 0x41, 0x4B, 0x07, 0x1B, 0xF3, 0x93, 0xE0, 0x4A, 0x6F, 0x92, 0xFD, 0x91, 0xA3, 0xF3, 0xD6,
+    0x93, 0x66, 0xCE, 0x51, 0x1D, 0x51, 0xE9, 0x7D, 0x8A, 0x99, 0x90, 0x72, 0xCD, 0xE5, 0x9C, 0xA5,
+    0xC8, 0x08, 0x5A, 0x32, 0x7D, 0xA7, 0xFF, 0x5D, 0x59, 0xB0, 0xFE, 0xCF, 0xFD, 0x33, 0x0C, 0x83,
+    0xAB, 0x5C, 0x7A, 0xD5, 0x88, 0x41, 0xD5, 0xDF, 0x7B, 0x95, 0x82, 0x73, 0x5F, 0x33, 0x7F, 0x60,
+    0x2A, 0xF5, 0x17, 0x07, 0x95, 0x6C, 0x51, 0x7F, 0xB7, 0x36, 0xC9, 0x5B, 0xE2, 0x2E, 0x97, 0x5A,
+    0xFE, 0x2A, 0x6F, 0x4E, 0x84, 0x96, 0x6D, 0xF6, 0xEE, 0x1D, 0x9D, 0x95, 0x74, 0x9A, 0x4F, 0xCA,
+    0x14, 0x65, 0x2D, 0x3D, 0xFD, 0x23, 0xC4, 0x66, 0x06, 0x4B, 0xEB, 0x36, 0xC6, 0x54, 0xD7, 0xA9,
+    0xEE, 0x53, 0x5B, 0x70, 0xA4, 0xB5, 0x27, 0x3A, 0xB6, 0x86, 0x65, 0x3D, 0x57, 0x51, 0xB9, 0x96,
+    0x7C, 0xDD, 0x92, 0x6F, 0xE3, 0xF9, 0x0D, 0xD1, 0x5C, 0x38, 0xC0, 0x1C, 0xE6, 0x1C, 0xB5, 0x65,
+    0x0D, 0xEC, 0xAD, 0x4D, 0xE7, 0x27, 0xD1, 0x84, 0x7D, 0x80, 0x35, 0x0B, 0x5B, 0x26, 0x7C, 0x25,
+    0xDB, 0x3A, 0x49, 0x2F, 0x7F, 0x88, 0xD9, 0x11, 0x6A, 0xED, 0x5A, 0xAD, 0x5D, 0x36, 0x62, 0x73,
+    0x0E, 0xB1, 0x65, 0x61, 0x60, 0xC8, 0xD4, 0x08, 0x06, 0x46, 0xD0, 0x36, 0x65, 0x63, 0x01, 0x56,
+    0x46, 0x5F, 0x6C, 0xB4, 0xCD, 0xA3, 0xC3, 0xC2, 0x9A, 0x8B, 0xF3, 0x4F, 0xE8, 0x39, 0x67, 0x7F,
+    0x8B, 0xFE, 0x2B, 0xE4, 0xDE, 0x46, 0x63, 0x9E, 0xB8, 0x2B, 0x84, 0x63, 0x1E, 0xE2, 0x0A, 0x2E,
+    0xDF, 0xC7, 0x96, 0x8D, 0x81, 0x89, 0x44, 0x8F, 0x81, 0x85, 0x86, 0x03, 0xEB, 0x09, 0xAB, 0xDB,
+    0x9E, 0x8C, 0x26, 0xBE, 0x1C, 0xA2, 0x63, 0xA1, 0x6D, 0x1C, 0x1F, 0xB5, 0xE6, 0x0C, 0xDE, 0x1B,
+    0xDE, 0x8F, 0xEB, 0x56, 0x90, 0xAE, 0xD1, 0xDD, 0xD5, 0xE3, 0xD3, 0x20, 0x31, 0xF2, 0xFB, 0x78,
+    0xBF, 0x7C, 0x9D, 0xFB, 0x2E, 0x39, 0xE0, 0x24, 0x16, 0x9A, 0xFE, 0xEE, 0x69, 0x4C, 0xBB, 0x0D,
+    0xFA, 0xB7, 0x4F, 0xB0, 0x55, 0xAB, 0x16, 0x2E, 0x9D, 0xC6, 0x85, 0x0B, 0x98, 0x5B, 0x83, 0xD9,
+    0xE6, 0x2F, 0x92, 0x88, 0xD9, 0xB6, 0xB5, 0x39, 0x9C, 0xBE, 0x04, 0x73, 0x80, 0x4A, 0xCC, 0x44,
+    0x3A, 0xAD, 0xCF, 0x61, 0x63, 0x16, 0xFF, 0x02, 0xED, 0x7D, 0x4D, 0xAC, 0x24, 0xD7, 0x75, 0xDE,
+    0xAD, 0x2E, 0xCE, 0xB4, 0xC4, 0x4A, 0x5C, 0x5C, 0x70, 0x48, 0x58, 0x44, 0x54, 0x5E, 0x68, 0xA5,
+    0x24, 0xAA, 0xAD, 0x11, 0xC8, 0xAC, 0x92, 0x05, 0xC8, 0x0B, 0x2F, 0x3C, 0x8B, 0x69, 0x12, 0xC6,
+    0x00, 0xA1, 0x16, 0x0A, 0x90, 0x90, 0x4E, 0x26, 0x0B, 0x2D, 0x12, 0x80, 0x7C, 0x55, 0x92, 0x16,
+    0x5E, 0x70, 0x91, 0x17, 0xC0, 0x23, 0x03, 0xC9, 0xC2, 0x5C, 0xD0, 0x80, 0xD4, 0x83, 0x60, 0xBC,
+    0xC8, 0x42, 0x88, 0xF9, 0xBA, 0x4A, 0xD1, 0x22, 0x0B, 0x2D, 0xDC, 0x89, 0x1C, 0x68, 0xA9, 0x16,
+    0x44, 0x22, 0xE0, 0x70, 0xA1, 0x52, 0xD4, 0x63, 0xD6, 0x9B, 0xA9, 0x9F, 0x9C, 0xEF, 0x3B, 0xF7,
+    0x56, 0x55, 0xBF, 0x9F, 0x79, 0x6F, 0x7E, 0x38, 0x9C, 0x91, 0xF3, 0x66, 0xFA, 0x9C, 0x7A, 0xFD,
+    0xEA, 0xE7, 0xD6, 0xB9, 0xF7, 0x9E, 0x7B, 0xFE, 0xAF, 0xB7, 0x34, 0xC6, 0x14, 0xA9, 0x31, 0x71,
+    0x69, 0x4C, 0xB0, 0x31, 0xC6, 0xAF, 0xE4, 0x8B, 0x46, 0x3E, 0xCF, 0x1B, 0xF7, 0x93, 0xF5, 0x7D,
+    0x2B, 0x9F, 0x8E, 0x1F, 0xFC, 0x7E, 0xAF, 0xCF, 0x62, 0x71, 0x45, 0xCE, 0x6B, 0xF8, 0xC1, 0xF1,
+    0x59, 0xE7, 0xEB, 0xFD, 0x3B, 0xF7, 0x31, 0x5F, 0xBF, 0x98, 0x7A, 0x4D, 0xB8, 0x9E, 0xC9, 0x47,
+    0x70, 0x69, 0xBE, 0x3E, 0x4B, 0x3F, 0x8D, 0x76, 0xC8, 0xA7, 0x6F, 0x85, 0x32, 0x3B, 0xC8, 0xCC,
+    0xB7, 0x6C, 0x08, 0x69, 0x74, 0x4E, 0x74, 0x01, 0xCD, 0xF7, 0xEF, 0xF4, 0xBD, 0x60, 0x5F, 0x6E,
+    0xB3, 0x05, 0xBA, 0x55, 0xC8, 0xDD, 0xFC, 0xAD, 0x99, 0xF5, 0x7A, 0xA6, 0x74, 0x00, 0x50, 0x92,
+    0x13, 0x49, 0x57, 0x9C, 0x8A, 0xEC, 0x29, 0x19, 0x2F, 0xF0, 0x78, 0xF9, 0xB3, 0x37, 0x71, 0xB3,
+    0x2A, 0xE2, 0xAD, 0x05, 0xE5, 0x78, 0xB0, 0x77, 0x05, 0xF0, 0x73, 0xFB, 0x72, 0x85, 0x74, 0x6C,
+    0x21, 0x5F, 0x34, 0xFA, 0xA8, 0x40, 0x7E, 0xF5, 0xCC, 0xB4, 0x6F, 0x9B, 0xE1, 0x73, 0x1E, 0x1A,
+    0x3D, 0xC4, 0xC7, 0xFD, 0x14, 0xFD, 0xFB, 0xD2, 0x0E, 0xA1, 0x05, 0x1F, 0xDF, 0xCB, 0x6B, 0xAC,
+    0xCD, 0xBF, 0x36, 0x3E, 0x08, 0x6C, 0x42, 0x52, 0x38, 0xDA, 0x00, 0x62, 0x48, 0xF2, 0x8D, 0x0D,
+    0x5F, 0xD8, 0xF0, 0x3D, 0x46, 0x28, 0x97, 0x96, 0x0E, 0x2E, 0x97, 0xCB, 0x7C, 0xE7, 0xAF, 0xFA,
+    0xBC, 0x84, 0x57, 0x25, 0xBC, 0x4F, 0xBC, 0xE6, 0xFD, 0xD9, 0x2F, 0x41, 0xC3, 0xCE, 0x11, 0x52,
+    0x5D, 0x34, 0xA6, 0xEF, 0x6E, 0x48, 0x4B, 0x62, 0xB6, 0x67, 0xD6, 0xF7, 0xF5, 0x40, 0x3D, 0xFC,
+    0xBC, 0xD4, 0x1F, 0xCA, 0x19, 0xF2, 0x8C, 0x39, 0x40, 0x58, 0x9B, 0x97, 0xD2, 0x68, 0xED, 0xDA,
+    0x16, 0xE7, 0x03, 0x28, 0x5D, 0xAB, 0xC3, 0x86, 0x77, 0x16, 0xC2, 0xCB, 0x8D, 0xF1, 0x65, 0x2F,
+    0xDF, 0x7A, 0x1C, 0x3D, 0x01, 0xC6, 0x80, 0x29, 0x78, 0x2A, 0xEE, 0x11, 0xE2, 0xFC, 0xA0, 0x72,
+    0x80, 0xBF, 0x46, 0xEB, 0xDF, 0x95, 0xC6, 0x97, 0xC9, 0x1D, 0x69, 0x53, 0x22, 0x7D, 0x22, 0x0D,
+    0x10, 0xEA, 0x98, 0x0B, 0x97, 0xF1, 0x4A, 0x0F, 0xF2, 0xEF, 0x77, 0x3F, 0x6F, 0xBA, 0x24, 0xED,
+    0x92, 0xFC, 0x20, 0x4E, 0x9F, 0x7F, 0xC6, 0xBE, 0xD5, 0xBC, 0x7A, 0xC4, 0xFF, 0xCD, 0x7C, 0x83,
+    0x97, 0x78, 0xC4, 0xFF, 0x37, 0x26, 0x5C, 0x4B, 0xEF, 0xF5, 0x7D, 0x2E, 0xA4, 0x2C, 0xDE, 0xD7,
+    0xA6, 0x4B, 0x3F, 0x68, 0x1F, 0x1E, 0x3F, 0xD8, 0xB0, 0x29, 0x72, 0xB0, 0xB6, 0xF3, 0x6F, 0x38,
+    0x08, 0xEF, 0x71, 0x50, 0x4E, 0x0E, 0x6E, 0x2F, 0xEC, 0x01, 0xE7, 0xBB, 0x1E, 0x08, 0xFD, 0x71,
+    0x70, 0x67, 0x29, 0x13, 0x4C, 0x4F, 0x96, 0xE1, 0x13, 0xF1, 0xC0, 0x6B, 0xED, 0x81, 0xE9, 0x4C,
+    0xA4, 0x33, 0xB3, 0xC0, 0x80, 0x38, 0x72, 0x90, 0xA4, 0xEE, 0xC0, 0xD8, 0x93, 0x33, 0x1E, 0xF8,
+    0x8D, 0x1C, 0xE2, 0x20, 0xAA, 0xF1, 0x38, 0x3C, 0x6B, 0x83, 0xF1, 0x87, 0x83, 0x14, 0xE3, 0x46,
+    0x0E, 0xDE, 0x37, 0x97, 0x86, 0xB9, 0x2A, 0x9F, 0x3D, 0x77, 0x50, 0x7C, 0x32, 0x07, 0x3D, 0x7E,
+    0xBA, 0xD4, 0x1E, 0xC8, 0x1B, 0xDB, 0x83, 0xCE, 0x9E, 0x33, 0xEB, 0x53, 0x7B, 0x72, 0x52, 0xDA,
+    0x83, 0x68, 0x6D, 0x0F, 0xC2, 0xE1, 0x60, 0x73, 0xEC, 0xC0, 0xFD, 0x29, 0x2A, 0x8F, 0x5C, 0xEE,
+    0x6E, 0x08, 0x82, 0xDB, 0x83, 0xAD, 0x3D, 0xB0, 0xCD, 0x78, 0x24, 0x6C, 0xD8, 0xBB, 0x6C, 0xD9,
+    0x70, 0x7E, 0x8C, 0x0D, 0xD7, 0xA7, 0xB1, 0xE1, 0x5D, 0x54, 0xDE, 0x3F, 0x32, 0xB3, 0xEF, 0x8D,
+    0x3C, 0xC7, 0x72, 0x33, 0xB6, 0x87, 0xAC, 0xCE, 0xD3, 0xB7, 0x48, 0xCD, 0xEE, 0x8F, 0xBC, 0xBB,
+    0x57, 0x73, 0x80, 0x90, 0x0E, 0xC2, 0x15, 0x32, 0x5E, 0x9C, 0x91, 0x09, 0x66, 0x18, 0x3D, 0x02,
+    0x67, 0x0D, 0x20, 0x08, 0x91, 0x91, 0x71, 0x64, 0xBC, 0x7F, 0x46, 0x3E, 0x99, 0x2D, 0x3A, 0x76,
+    0x65, 0x33, 0xC2, 0x45, 0xCF, 0x3B, 0x67, 0x39, 0x60, 0xC2, 0x33, 0xD1, 0x2A, 0x77, 0x07, 0x9F,
+    0x77, 0x33, 0xBD, 0x19, 0x9F, 0x92, 0xF0, 0x89, 0x72, 0x52, 0x46, 0x7A, 0xA3, 0x3D, 0x0D, 0xFB,
+    0x45, 0xEE, 0x7D, 0x91, 0xAF, 0x35, 0x6B, 0x27, 0xFC, 0x96, 0x5C, 0x10, 0xD3, 0x63, 0x24, 0xFA,
+    0xE5, 0x63, 0xEF, 0x65, 0xC7, 0x43, 0x4C, 0x98, 0x11, 0xF6, 0x80, 0x33, 0xC2, 0xF9, 0xC7, 0x80,
+    0xE1, 0x4F, 0x01, 0xE3, 0xB7, 0x01, 0x93, 0x00, 0xB0, 0x05, 0xF4, 0x1A, 0x40, 0xBF, 0x02, 0x0C,
+    0x37, 0x80, 0x51, 0x09, 0x98, 0x18, 0xC0, 0x15, 0xA0, 0xAC, 0x70, 0x02, 0x85, 0x6A, 0x02, 0x85,
+    0x15, 0x08, 0x94, 0xB9, 0x29, 0x50, 0x66, 0x9F, 0xC0, 0x15, 0xF8, 0x43, 0xD6, 0x10, 0x6E, 0x09,
+    0x2B, 0x42, 0x8A, 0x3D, 0xA0, 0x0B, 0x2E, 0x59, 0xA3, 0xE9, 0xF3, 0x6A, 0x8E, 0xA9, 0x77, 0x78,
+    0x0D, 0x3C, 0x9A, 0x03, 0xC6, 0xC4, 0x87, 0xC7, 0xDF, 0x65, 0x56, 0x63, 0x65, 0xF2, 0x6B, 0xD0,
+    0x7D, 0x5E, 0xA1, 0x0F, 0xA4, 0x5D, 0x15, 0x46, 0xB8, 0x8C, 0x28, 0x19, 0x43, 0xE8, 0x21, 0x79,
+    0x74, 0x47, 0x0A, 0x15, 0xEC, 0x73, 0xFD, 0x32, 0xE6, 0x09, 0xE1, 0x06, 0xBC, 0x2A, 0xE0, 0x85,
+    0x7E, 0x1D, 0x61, 0xB0, 0x34, 0x24, 0x62, 0xC7, 0x45, 0xAB, 0x20, 0x59, 0x13, 0x92, 0x38, 0x6E,
+    0xC6, 0x95, 0x51, 0xC7, 0x92, 0xAE, 0x8F, 0xBA, 0xAE, 0xA9, 0x60, 0xD1, 0x71, 0xD5, 0xA9, 0x09,
+    0xB9, 0xD0, 0x5D, 0x71, 0xED, 0x8C, 0x72, 0xD2, 0xFC, 0xC9, 0x80, 0x60, 0x25, 0x3B, 0x70, 0x58,
+    0xA3, 0xEF, 0x09, 0x83, 0xCD, 0xE4, 0xDD, 0x49, 0x87, 0x84, 0x34, 0x79, 0x99, 0xF0, 0x80, 0x4C,
+    0xB1, 0xC1, 0xD4, 0xF2, 0x1A, 0x5C, 0xE0, 0x6F, 0x41, 0x4F, 0xBF, 0x0A, 0xD9, 0xB9, 0xB8, 0x38,
+    0x5C, 0xCF, 0xB5, 0x6B, 0xB6, 0x68, 0xC6, 0x0C, 0x1D, 0x44, 0x89, 0xA8, 0x58, 0x2C, 0x5A, 0xAE,
+    0xEF, 0x90, 0x42, 0x00, 0x67, 0xDD, 0x72, 0x59, 0xE4, 0x38, 0x2D, 0x2A, 0x71, 0x49, 0xB8, 0x46,
+    0x07, 0x05, 0x55, 0xC4, 0x5E, 0x46, 0x5F, 0xFB, 0x35, 0x1E, 0x31, 0xA3, 0xB4, 0x64, 0x5A, 0xD0,
+    0xDD, 0x50, 0x5A, 0xCC, 0x27, 0x60, 0x90, 0x40, 0xCE, 0x00, 0xBD, 0xC8, 0x09, 0x19, 0x39, 0xDF,
+    0xB2, 0x20, 0x1F, 0x2C, 0xC0, 0x15, 0x23, 0xCE, 0x83, 0x0A, 0x53, 0x62, 0x17, 0x04, 0x95, 0xFB,
+    0x43, 0x2C, 0xFC, 0xD4, 0xEB, 0x4B, 0x8A, 0x4F, 0x19, 0x64, 0x96, 0x4C, 0xB9, 0xE5, 0x9D, 0xD4,
+    0xDE, 0x0F, 0xD2, 0x8A, 0x9C, 0x52, 0x8C, 0xB7, 0xDA, 0x92, 0xA5, 0xEC, 0x00, 0xDE, 0x4F, 0xD8,
+    0xF7, 0xE2, 0x15, 0x79, 0xB8, 0x65, 0xF6, 0x72, 0xAD, 0xFC, 0xBA, 0x76, 0x97, 0xF9, 0x78, 0x4F,
+    0x8F, 0xA0, 0x45, 0x9B, 0x5B, 0x77, 0x44, 0x02, 0xCC, 0x01, 0xE2, 0x0A, 0x4F, 0x5B, 0x03, 0xE0,
+    0x2E, 0xEF, 0x3F, 0x5E, 0x99, 0xD2, 0xD3, 0x35, 0x61, 0xB6, 0x8B, 0x6A, 0xCE, 0x37, 0x74, 0xE3,
+    0x71, 0x54, 0x9D, 0x17, 0xCD, 0x77, 0x10, 0x86, 0x51, 0x4B, 0x91, 0x02, 0x28, 0xB4, 0xA8, 0x24,
+    0x8A, 0x15, 0x61, 0x60, 0xB4, 0xDA, 0xAE, 0x96, 0x8C, 0x52, 0x10, 0x66, 0xBC, 0xA0, 0x82, 0xAB,
+    0x68, 0xB3, 0x8B, 0x56, 0x7C, 0x81, 0xB3, 0x91, 0x69, 0x1E, 0xA7, 0xEA, 0x13, 0xA7, 0x66, 0xC6,
+    0x69, 0x22, 0x63, 0x1E, 0x84, 0xCC, 0x20, 0x8B, 0xE1, 0xA0, 0xE3, 0x5A, 0x59, 0xE3, 0x95, 0x64,
+    0xEE, 0xC8, 0xC1, 0x9C, 0x42, 0x8D, 0x1C, 0x60, 0x8E, 0x24, 0x98, 0x56, 0x20, 0x44, 0x54, 0xCE,
+    0xB8, 0x7E, 0xC9, 0x65, 0x72, 0x40, 0xC6, 0x54, 0xCF, 0x6A, 0xD2, 0xC1, 0x6B, 0x66, 0xB5, 0x2E,
+    0xDE, 0xC5, 0xAB, 0xED, 0x6B, 0xCA, 0xC4, 0x28, 0xC0, 0x5B, 0xD1, 0x43, 0x19, 0x9A, 0xFC, 0x09,
+    0x33, 0x7D, 0xE6, 0x4E, 0x1E, 0x2E, 0x0F, 0xDD, 0x0D, 0xA3, 0x35, 0x1E, 0x91, 0xDA, 0x87, 0x82,
+    0x0F, 0xF6, 0xB6, 0x19, 0x22, 0x91, 0xC9, 0x41, 0xB0, 0xC5, 0x6A, 0x25, 0x07, 0x02, 0xB5, 0xF1,
+    0x5E, 0x07, 0x99, 0x1B, 0x6F, 0x51, 0xE0, 0x7C, 0x72, 0x80, 0xB2, 0xD0, 0x91, 0x42, 0x61, 0x5C,
+    0x56, 0x35, 0xCC, 0x46, 0xCA, 0xDC, 0x49, 0x57, 0xF4, 0xE6, 0xF3, 0x98, 0x60, 0x4E, 0x6F, 0xA0,
+    0x6C, 0x3E, 0x01, 0x83, 0x0A, 0x20, 0x22, 0xC3, 0xE2, 0x2A, 0x59, 0xC8, 0x3E, 0x80, 0xC8, 0xA8,
+    0x0B, 0x68, 0x13, 0x90, 0xE1, 0x1D, 0xC7, 0xA2, 0x4C, 0xEA, 0x6F, 0x77, 0x40, 0xB0, 0xE5, 0x5F,
+    0xBF, 0x21, 0xE7, 0xAD, 0x8B, 0x5B, 0x37, 0xFB, 0x9C, 0xF2, 0x4F, 0x44, 0x59, 0xFF, 0xD2, 0xE5,
+    0xA7, 0x62, 0xB1, 0x8C, 0xD2, 0x90, 0x9D, 0x0D, 0xCE, 0x18, 0xDE, 0x2E, 0x86, 0x55, 0xC8, 0x09,
+    0xEA, 0x4F, 0xD1, 0xC2, 0xFF, 0x14, 0x88, 0x5C, 0x73, 0xCA, 0xAC, 0x50, 0x75, 0x6A, 0x07, 0x37,
+    0x98, 0x8E, 0xD0, 0x70, 0x1C, 0x0C, 0x8F, 0xC3, 0xF2, 0x6C, 0x18, 0x4D, 0x61, 0x0E, 0x18, 0x4F,
+    0x20, 0x54, 0x97, 0x9A, 0x7A, 0x8B, 0x12, 0x88, 0xF3, 0xCF, 0x57, 0x75, 0xA5, 0xA6, 0xAE, 0x52,
+    0x53, 0x51, 0xA9, 0x55, 0x4B, 0xC9, 0xA8, 0xD2, 0xB6, 0x19, 0xF5, 0xD9, 0x16, 0xF4, 0x36, 0x51,
+    0x0B, 0xE2, 0x8B, 0x28, 0xB3, 0x67, 0x11, 0x58, 0xDA, 0x41, 0xBB, 0x87, 0x17, 0x6B, 0xDA, 0x3D,
+    0x79, 0x80, 0x57, 0xB7, 0x7B, 0x78, 0xDA, 0xB6, 0xDD, 0xA3, 0x7E, 0x25, 0x68, 0x2D, 0xAF, 0xD7,
+    0x66, 0x32, 0x73, 0xC2, 0xB2, 0x45, 0xCF, 0x46, 0x82, 0xC0, 0x5E, 0x52, 0x59, 0x7A, 0x64, 0x7E,
+    0x62, 0x19, 0x6A, 0x45, 0x17, 0x6A, 0xA1, 0xE1, 0x36, 0x40, 0x89, 0xA2, 0xF8, 0xDB, 0x5B, 0xA0,
+    0xE8, 0x47, 0x15, 0x90, 0x0C, 0x29, 0xA0, 0xE0, 0xA3, 0x35, 0x90, 0x2F, 0xD3, 0x99, 0x28, 0x07,
+    0x82, 0xED, 0xA4, 0xD5, 0x0E, 0x00, 0x3A, 0x50, 0x24, 0xCF, 0x7B, 0x28, 0xB8, 0x58, 0x2C, 0xAE,
+    0x71, 0x55, 0xEE, 0x1D, 0x5C, 0x2E, 0x97, 0x37, 0xCB, 0x47, 0x70, 0xE7, 0x41, 0xBA, 0xE6, 0xBA,
+    0x50, 0x50, 0x2C, 0x8D, 0xD4, 0x5A, 0x51, 0x58, 0xD3, 0x45, 0xEE, 0x15, 0xA5, 0x2C, 0xC9, 0xF2,
+    0x7D, 0xC5, 0xA1, 0x36, 0xAF, 0xC9, 0xDA, 0x64, 0x10, 0x61, 0xF8, 0x09, 0x67, 0xA4, 0x30, 0xA5,
+    0x9A, 0x9C, 0xB0, 0xC1, 0x62, 0x82, 0x32, 0x8B, 0xD2, 0x93, 0x90, 0x3B, 0xC5, 0x5E, 0x67, 0xEF,
+    0x42, 0xE9, 0xB3, 0xE5, 0x13, 0x64, 0x66, 0xD8, 0xE7, 0xCD, 0x6B, 0x3E, 0x5D, 0x94, 0x3A, 0x53,
+    0xC8, 0x1F, 0x8A, 0x3B, 0x37, 0x21, 0x9E, 0x46, 0x3D, 0xA7, 0xC4, 0x8C, 0x4C, 0x52, 0x8D, 0x19,
+    0x66, 0x22, 0x04, 0x3A, 0x52, 0x91, 0xA7, 0x52, 0x64, 0x7D, 0x32, 0x60, 0xFF, 0x21, 0x9B, 0x49,
+    0xB1, 0x08, 0x54, 0x7B, 0x91, 0x22, 0x5A, 0x56, 0x66, 0x56, 0xE7, 0x0D, 0x07, 0xE1, 0x4A, 0x05,
+    0x33, 0xFE, 0xBA, 0xCE, 0xEC, 0x5B, 0x14, 0x79, 0xB6, 0x78, 0x63, 0x90, 0xCE, 0x84, 0xB1, 0x67,
+    0xCB, 0x3F, 0x3B, 0x9F, 0x54, 0xB8, 0x0B, 0x8E, 0x59, 0xCD, 0xD2, 0xD1, 0x6A, 0xF6, 0x6F, 0xEE,
+    0xDF, 0x6A, 0x76, 0x4F, 0x68, 0xAD, 0x66, 0xF9, 0xFD, 0x5B, 0xCD, 0x0E, 0xAD, 0xD5, 0x8C, 0x5D,
+    0x99, 0x16, 0x13, 0xE8, 0x5A, 0x91, 0x99, 0x27, 0x03, 0x3E, 0x2D, 0xBA, 0xDB, 0xEE, 0x02, 0x7A,
+    0x14, 0xBD, 0x8E, 0xC1, 0xC9, 0xE1, 0xB0, 0xB5, 0x44, 0x97, 0x5E, 0xD8, 0xCF, 0x2E, 0xF4, 0xEB,
+    0x39, 0xD6, 0x8C, 0xA8, 0xE2, 0x32, 0xC2, 0xC6, 0x61, 0xE5, 0xD2, 0xC5, 0xAC, 0x95, 0xB7, 0xCE,
+    0xB4, 0x95, 0x23, 0x5A, 0xB9, 0xDF, 0xF4, 0x6F, 0xF6, 0x4C, 0x99, 0xD6, 0xB8, 0x8E, 0x77, 0x99,
+    0xD7, 0xF6, 0x9E, 0x33, 0x91, 0xF2, 0x2F, 0x0A, 0x17, 0xD5, 0xE7, 0xB9, 0xA7, 0x9B, 0x37, 0xD8,
+    0x96, 0x93, 0xDB, 0x49, 0xEB, 0x15, 0x68, 0x13, 0xE5, 0xE0, 0x14, 0x49, 0x1A, 0x56, 0x56, 0x90,
+    0xF4, 0x28, 0x45, 0x42, 0x1A, 0xEA, 0x69, 0xFF, 0x4C, 0x52, 0x10, 0x32, 0x2E, 0x41, 0xC2, 0x70,
+    0x53, 0x50, 0x52, 0x52, 0xAE, 0x51, 0x93, 0x54, 0x24, 0x5E, 0x46, 0xFA, 0x24, 0xEB, 0xE1, 0x1B,
+    0x4F, 0xE9, 0x76, 0xBB, 0xA1, 0x96, 0x58, 0x70, 0xE2, 0xE2, 0x0E, 0x49, 0x1A, 0xD3, 0xEE, 0x0D,
+    0x91, 0xB0, 0xC1, 0x6A, 0xEA, 0x53, 0x6E, 0x0D, 0xF8, 0x74, 0x88, 0x6F, 0x59, 0x8A, 0x21, 0xA0,
+    0x56, 0x28, 0x2A, 0x5C, 0x58, 0xFC, 0x54, 0x4B, 0x7D, 0x92, 0x11, 0x15, 0x87, 0x74, 0x17, 0x4D,
+    0x4C, 0xDD, 0x67, 0x20, 0xA8, 0xC8, 0x07, 0x09, 0x07, 0xEA, 0x79, 0x41, 0xAA, 0x43, 0x43, 0x06,
+    0x86, 0x10, 0xAD, 0x83, 0x01, 0xBC, 0x83, 0x2C, 0xD2, 0x79, 0x34, 0x0A, 0xBE, 0xD4, 0xEF, 0xAB,
+    0x06, 0x7C, 0x5F, 0x40, 0xAD, 0x9F, 0xB2, 0x66, 0x67, 0x2A, 0x1D, 0xFF, 0xC6, 0x1C, 0xA8, 0xAD,
+    0xB4, 0x3F, 0xE9, 0x40, 0x15, 0xC8, 0x03, 0x77, 0xD0, 0xFE, 0xA6, 0x1C, 0xD8, 0x17, 0x6C, 0x8E,
+    0x1F, 0x38, 0xF6, 0x75, 0x7F, 0x07, 0x19, 0xC4, 0x49, 0x59, 0xEC, 0xAA, 0x01, 0xAA, 0x77, 0xC4,
+    0x9A, 0xF6, 0xCF, 0x80, 0xB4, 0xDF, 0xCF, 0xB9, 0x1C, 0xD1, 0x61, 0x63, 0xE6, 0x77, 0x96, 0x3D,
+    0x3D, 0x14, 0xB2, 0x78, 0x09, 0x9C, 0x11, 0xCA, 0x30, 0x1C, 0x61, 0x71, 0xF4, 0x1B, 0x11, 0x94,
+    0xE6, 0xB4, 0xCD, 0x0B, 0x8C, 0xB7, 0xBC, 0xCF, 0x86, 0x30, 0x05, 0x7C, 0x5F, 0x19, 0x9B, 0x4A,
+    0x64, 0x0F, 0x83, 0x16, 0x97, 0x89, 0x20, 0x13, 0x11, 0x35, 0x40, 0xCB, 0x9B, 0xBD, 0x9E, 0x52,
+    0x94, 0x44, 0xF1, 0x9A, 0x28, 0xDC, 0x4C, 0x91, 0x2C, 0x3C, 0x13, 0x64, 0xBF, 0x8C, 0xF4, 0xCC,
+    0x84, 0xD7, 0x89, 0xFC, 0xC5, 0x7B, 0x76, 0x7A, 0xEB, 0x2D, 0x51, 0x97, 0xBA, 0xA7, 0xDF, 0x1F,
+    0x40, 0x43, 0x9D, 0xA5, 0x4A, 0xD6, 0x01, 0x34, 0xD1, 0x59, 0xAA, 0xE2, 0x13, 0xC4, 0xA0, 0x23,
+    0xB2, 0x10, 0x38, 0xAC, 0x47, 0x56, 0xD5, 0x39, 0x61, 0xAA, 0x73, 0x26, 0x6F, 0x6A, 0xDC, 0x50,
+    0xB9, 0x5B, 0xB5, 0x03, 0xE4, 0xE6, 0xF3, 0xA9, 0x57, 0x70, 0x7D, 0x8C, 0xC8, 0xF4, 0x7D, 0x8E,
+    0x0B, 0xAF, 0x9B, 0x8A, 0x28, 0xE9, 0x31, 0x11, 0xA5, 0xDC, 0xF1, 0x05, 0xBE, 0xBE, 0x5C, 0x16,
+    0xE5, 0x28, 0x08, 0x4D, 0xC5, 0xA1, 0x64, 0x22, 0x0E, 0x75, 0xE3, 0xFD, 0x85, 0xA9, 0x7D, 0x41,
+    0xBE, 0xAE, 0x4C, 0x02, 0x4D, 0xDC, 0xB6, 0x47, 0xFD, 0x6E, 0x2A, 0xAB, 0xEE, 0xAC, 0xC4, 0x05,
+    0xDA, 0x9C, 0x71, 0xF5, 0x53, 0x15, 0x2E, 0x53, 0x99, 0x4C, 0x16, 0x24, 0x0A, 0xE0, 0x19, 0x65,
+    0xB2, 0x08, 0x0B, 0x27, 0xB4, 0xFC, 0x79, 0x6D, 0xD5, 0x45, 0xEA, 0x72, 0x91, 0x0A, 0xE2, 0xAA,
+    0x3A, 0x52, 0x14, 0x67, 0xCB, 0x0A, 0x1C, 0xA4, 0x7A, 0xB0, 0x80, 0x2A, 0x0D, 0x69, 0x5B, 0x39,
+    0x3B, 0x0F, 0xAC, 0xFC, 0xBD, 0x1C, 0x04, 0xF1, 0x24, 0x9D, 0x1E, 0x14, 0xD3, 0xFB, 0x0C, 0x77,
+    0x1E, 0x9E, 0x85, 0xA7, 0xCF, 0x1A, 0xB5, 0xE3, 0x68, 0x7B, 0xFC, 0xC6, 0xB6, 0xD0, 0x53, 0x41,
+    0x1D, 0x6F, 0x41, 0x51, 0x3D, 0xA3, 0xB0, 0xAE, 0x36, 0x2C, 0x4F, 0x29, 0x80, 0x0E, 0x20, 0x11,
+    0xBC, 0x1B, 0xF2, 0xC2, 0x31, 0xFE, 0x0A, 0x23, 0x9B, 0xDF, 0x5F, 0x16, 0x05, 0x1D, 0x76, 0x36,
+    0xDC, 0x1E, 0xF2, 0x82, 0x80, 0xD2, 0x01, 0x9A, 0xC7, 0xF8, 0x07, 0xD0, 0xA0, 0xF5, 0xA5, 0xCB,
+    0xF5, 0x32, 0xBD, 0x01, 0xDD, 0x6B, 0xB2, 0x22, 0xB7, 0x90, 0x89, 0xA8, 0x43, 0xB4, 0x78, 0x81,
+    0x96, 0xB2, 0x96, 0xB4, 0x59, 0xAE, 0x68, 0x70, 0x2D, 0x2C, 0x6F, 0x90, 0x97, 0x5A, 0xF4, 0x74,
+    0x5B, 0xD0, 0xBC, 0xE6, 0x2D, 0xD8, 0xB4, 0x8D, 0x76, 0xC0, 0xFC, 0xF0, 0x15, 0x91, 0x7C, 0xEC,
+    0xB0, 0x48, 0x46, 0x57, 0x6C, 0xA9, 0x47, 0xD2, 0x8B, 0x25, 0x6C, 0x82, 0x65, 0xD0, 0x5F, 0xBF,
+    0x56, 0xC6, 0x1B, 0x48, 0x07, 0x39, 0x80, 0x15, 0xD2, 0x13, 0x08, 0x0B, 0x99, 0x7C, 0xE7, 0xF5,
+    0x65, 0x7C, 0xFB, 0xB5, 0x9F, 0x95, 0x61, 0xDF, 0xFF, 0x91, 0x5C, 0x51, 0x07, 0xA5, 0xB9, 0xA4,
+    0xC3, 0xF4, 0x85, 0xBF, 0x82, 0x98, 0x5B, 0x61, 0xEE, 0x0B, 0x3F, 0xE8, 0x3F, 0x14, 0x82, 0x6D,
+    0xEC, 0x98, 0x54, 0x53, 0xCE, 0xC6, 0xA9, 0x66, 0x61, 0xF9, 0xFA, 0xBE, 0x89, 0xDE, 0x96, 0x81,
+    0x1E, 0x4B, 0x9F, 0x95, 0x89, 0x74, 0x42, 0x95, 0x88, 0xD2, 0xBE, 0x15, 0x79, 0xC5, 0x6F, 0xE4,
+    0x15, 0xBC, 0x86, 0xEF, 0xC1, 0xE5, 0x74, 0x04, 0x71, 0xAE, 0x62, 0x17, 0x49, 0x87, 0xD8, 0x07,
+    0x39, 0x59, 0xDE, 0x7C, 0xBE, 0x15, 0x1A, 0x44, 0x95, 0xD7, 0x5F, 0x57, 0x89, 0x0B, 0x23, 0x6E,
+    0x6B, 0x05, 0x2A, 0x8A, 0x3F, 0x18, 0x1F, 0x94, 0xC0, 0xFA, 0xE5, 0xCD, 0x06, 0x84, 0xE9, 0x20,
+    0xA7, 0x16, 0x03, 0xE8, 0xD4, 0xFA, 0x48, 0xF6, 0xC5, 0xC9, 0x45, 0xB3, 0x81, 0x7C, 0xD7, 0xA9,
+    0x91, 0x92, 0x06, 0x4B, 0x07, 0x32, 0x01, 0xA2, 0x12, 0xF7, 0xCB, 0xA2, 0xB5, 0x37, 0x75, 0xD3,
+    0x14, 0x97, 0xF2, 0xB3, 0x5C, 0xE2, 0x44, 0xF3, 0xB0, 0x1F, 0xFB, 0x13, 0x72, 0x98, 0xE9, 0x60,
+    0x8B, 0x6E, 0x2D, 0x5B, 0xCA, 0x5F, 0x47, 0x60, 0x9C, 0x1E, 0x85, 0x89, 0x39, 0x0A, 0x33, 0xC2,
+    0x15, 0x21, 0xFF, 0xC3, 0xAC, 0xDF, 0x5A, 0x63, 0x2F, 0xD7, 0xA2, 0x6D, 0x31, 0x81, 0x2B, 0x76,
+    0xDB, 0x69, 0xF0, 0x79, 0xEB, 0xB7, 0x5A, 0x38, 0xC7, 0x3D, 0xC7, 0x69, 0xF7, 0xB5, 0x1E, 0x53,
+    0x59, 0x58, 0xEB, 0x5A, 0x86, 0xAA, 0xF4, 0x54, 0xB8, 0x91, 0x8E, 0x0B, 0x2A, 0xD8, 0x97, 0x2A,
+    0xF0, 0x2D, 0x0B, 0x44, 0xD5, 0x7F, 0x87, 0xF3, 0x31, 0xD9, 0x1D, 0x8C, 0x94, 0xFB, 0x31, 0x55,
+    0xF2, 0x59, 0xFF, 0x97, 0x37, 0xC9, 0xA7, 0x4A, 0xE9, 0x4C, 0xD0, 0xF7, 0xD2, 0xE8, 0xFD, 0x53,
+    0xF9, 0xBB, 0x85, 0x70, 0x0A, 0xC1, 0x1D, 0xAB, 0x0F, 0x67, 0x2C, 0x0D, 0x2F, 0x6A, 0x67, 0xD6,
+    0x59, 0x9E, 0x59, 0x55, 0x3C, 0xC9, 0x33, 0xAE, 0x9B, 0xC2, 0x66, 0xA1, 0x94, 0xC8, 0x52, 0xD7,
+    0xDF, 0xA0, 0xA9, 0xB1, 0xD7, 0x89, 0xEB, 0x3C, 0xE5, 0xC2, 0x8B, 0xA1, 0x96, 0x63, 0xC0, 0x7B,
+    0xB4, 0x4C, 0x89, 0x16, 0xDB, 0x8F, 0xDC, 0x87, 0x9C, 0x41, 0xDA, 0x49, 0x8B, 0x93, 0x34, 0x95,
+    0xD6, 0x2F, 0x21, 0x5F, 0xAC, 0x9A, 0x83, 0xB5, 0x4D, 0xC9, 0x05, 0xB2, 0x0E, 0xC4, 0x2A, 0x74,
+    0x6E, 0x92, 0xEB, 0xD7, 0xB6, 0xCF, 0xA1, 0x65, 0x34, 0x8A, 0xE1, 0x83, 0xE3, 0x40, 0x14, 0x84,
+    0x3E, 0xF7, 0x85, 0x64, 0x33, 0xB6, 0x00, 0xAF, 0xEC, 0x35, 0xB6, 0xDB, 0x69, 0x0D, 0x4F, 0x65,
+    0x68, 0xAF, 0xAE, 0x5F, 0xAB, 0x85, 0x02, 0x9B, 0x6B, 0x20, 0x80, 0x7B, 0x7F, 0x74, 0x64, 0x09,
+    0x33, 0x6A, 0x89, 0x8B, 0x4B, 0x70, 0x08, 0x01, 0xC1, 0xCF, 0x04, 0x44, 0x7F, 0x23, 0x20, 0x09,
+    0x05, 0xEC, 0x01, 0x34, 0x02, 0x66, 0x5B, 0x01, 0x70, 0xEF, 0x08, 0x9F, 0x11, 0x10, 0xE5, 0x02,
+    0x12, 0x98, 0x8A, 0x56, 0x00, 0x58, 0x48, 0xB9, 0xE4, 0x49, 0x07, 0x0A, 0x28, 0x01, 0x72, 0x01,
+    0xFE, 0xC6, 0x13, 0x35, 0xA0, 0x82, 0xDB, 0x1E, 0xF3, 0x4B, 0xBA, 0x01, 0xFA, 0x46, 0x77, 0xCC,
+    0x07, 0xFB, 0x38, 0xDA, 0xE2, 0x1E, 0xB4, 0xD2, 0x01, 0xCB, 0xF1, 0xDA, 0x82, 0xF4, 0x2D, 0xE8,
+    0x4E, 0x4B, 0x4D, 0x0B, 0x92, 0xB5, 0xA0, 0x2D, 0xBB, 0xB5, 0xD7, 0xE1, 0x08, 0x21, 0x85, 0xBC,
+    0x91, 0x7F, 0x55, 0xDD, 0x34, 0x29, 0xDD, 0xB5, 0x01, 0xB8, 0xA9, 0xDF, 0xB8, 0xD9, 0x6F, 0x17,
+    0x4B, 0x63, 0xAD, 0xDA, 0x04, 0xCB, 0x1B, 0x8D, 0xFA, 0xBE, 0x4E, 0x02, 0x7B, 0x27, 0x80, 0x83,
+    0x01, 0x34, 0x0E, 0xD0, 0x01, 0x20, 0xAF, 0x25, 0x00, 0xC4, 0x94, 0x37, 0xF2, 0x9A, 0x09, 0x01,
+    0x41, 0xD7, 0xB0, 0xC6, 0x08, 0x88, 0x6A, 0x34, 0x38, 0x21, 0xCC, 0xEA, 0x0E, 0x3E, 0x84, 0xBA,
+    0x45, 0xEB, 0xEB, 0xF6, 0xC0, 0xCC, 0x6E, 0xD7, 0x42, 0x29, 0xFF, 0x57, 0x02, 0xD3, 0xF9, 0xCF,
+    0x6B, 0x90, 0xEE, 0x87, 0x75, 0x1B, 0x96, 0xD1, 0xB7, 0xEA, 0x36, 0x58, 0xC7, 0x5F, 0xA9, 0x85,
+    0xAC, 0x89, 0x27, 0x70, 0x7B, 0x20, 0xD0, 0xAB, 0x1B, 0x81, 0x72, 0x3D, 0x60, 0x51, 0x01, 0x26,
+    0x1B, 0xC0, 0x78, 0x0D, 0x18, 0x95, 0x5E, 0xED, 0x88, 0x1A, 0x95, 0xE7, 0x00, 0x3D, 0xC4, 0x04,
+    0xDA, 0x9D, 0x08, 0xBA, 0x73, 0x5E, 0xD6, 0xEA, 0xDA, 0xA2, 0x0C, 0xA2, 0x26, 0x77, 0x94, 0xF1,
+    0xB1, 0x28, 0x4A, 0x61, 0x10, 0x11, 0x0C, 0x02, 0xF3, 0x2D, 0xFC, 0xFF, 0x4D, 0x92, 0x5B, 0x5F,
+    0x64, 0x7B, 0x22, 0xC8, 0x75, 0x4D, 0xF3, 0x1A, 0xD8, 0x5D, 0x1B, 0x5E, 0x06, 0x6B, 0x9D, 0x4C,
+    0xA0, 0xEB, 0x2A, 0xC8, 0x9C, 0xC0, 0xED, 0xC9, 0x86, 0xC9, 0x87, 0x8B, 0x9C, 0x06, 0x89, 0x47,
+    0x0D, 0xF8, 0x5A, 0x0D, 0xF8, 0x5E, 0x53, 0xC8, 0x50, 0xE9, 0xDA, 0x57, 0x65, 0x41, 0x58, 0x9B,
+    0x22, 0x97, 0x85, 0x26, 0x2E, 0x7B, 0x70, 0x9A, 0x0E, 0xEC, 0xA4, 0xC3, 0x54, 0x27, 0xA0, 0x77,
+    0xAC, 0xB3, 0xC0, 0x7E, 0x87, 0xF3, 0x36, 0x3D, 0x04, 0x52, 0xC8, 0x52, 0x18, 0xF8, 0x72, 0x83,
+    0xEE, 0x6A, 0x2F, 0xEB, 0xB7, 0xDC, 0xB4, 0xC5, 0xED, 0x5B, 0x58, 0x38, 0xDA, 0x21, 0x10, 0xE2,
+    0xDE, 0x40, 0x5A, 0x95, 0x0A, 0xAD, 0xE1, 0x42, 0xEB, 0x84, 0x3C, 0x6F, 0xCD, 0x6B, 0x75, 0xC2,
+    0xA0, 0x1B, 0x12, 0xEB, 0x3F, 0xE6, 0xC7, 0x46, 0x57, 0x0C, 0xBF, 0xE7, 0xCA, 0x7E, 0xE9, 0xBF,
+    0x65, 0x50, 0xCD, 0xF5, 0xFF, 0x22, 0xF7, 0x68, 0x79, 0x2F, 0x47, 0xD7, 0xCC, 0x99, 0x1F, 0xCB,
+    0xD7, 0x6F, 0x74, 0xCB, 0xFC, 0xA8, 0x9B, 0xE6, 0xD1, 0x00, 0xF6, 0x9F, 0xF5, 0x98, 0xFA, 0x5B,
+    0x69, 0x17, 0x1D, 0xC9, 0x22, 0xB7, 0xAF, 0xD5, 0xBD, 0x4C, 0x4F, 0x73, 0x02, 0xA7, 0x73, 0x02,
+    0x5E, 0x5A, 0x40, 0x1D, 0xC2, 0x0C, 0xC6, 0xA4, 0xCA, 0xE8, 0xA9, 0xFA, 0x2A, 0xFC, 0x71, 0x7F,
+    0x0A, 0x77, 0xF4, 0x8F, 0x61, 0xAB, 0xFA, 0x19, 0xCC, 0x56, 0xBF, 0x84, 0x2F, 0x1A, 0x22, 0xE2,
+    0xAC, 0x1F, 0xE4, 0xD9, 0xD6, 0x58, 0x8E, 0xAB, 0x0B, 0xC2, 0x10, 0x55, 0x06, 0x67, 0x47, 0x81,
+    0x73, 0x11, 0xF0, 0xA2, 0x46, 0x7A, 0x39, 0xF1, 0x1D, 0x8D, 0x8D, 0xD9, 0xDE, 0x27, 0x7A, 0xF1,
+    0xD0, 0xC6, 0x61, 0xD5, 0xC6, 0x89, 0xED, 0x5E, 0xFF, 0x7F, 0x0E, 0x45, 0x7E, 0xF6, 0x85, 0x1B,
+    0x06, 0xB0, 0x05, 0xCF, 0xB6, 0x33, 0x48, 0x75, 0x33, 0x11, 0x23, 0xA4, 0x0F, 0x04, 0xC1, 0xDA,
+    0x22, 0x28, 0xC9, 0x93, 0x74, 0x44, 0xB0, 0xF5, 0x8C, 0x48, 0x44, 0x31, 0x3D, 0x85, 0x17, 0x24,
+    0x29, 0x2F, 0x2F, 0x78, 0x33, 0x91, 0x6C, 0xE6, 0x7A, 0x6B, 0xAF, 0xFF, 0x29, 0x1E, 0xE4, 0x9C,
+    0x85, 0x73, 0x8D, 0x07, 0x92, 0x26, 0xA5, 0x0F, 0xF4, 0x2A, 0x43, 0xF7, 0x80, 0x87, 0xD2, 0x9E,
+    0x17, 0xAD, 0x03, 0xF6, 0x05, 0xBB, 0x41, 0x7B, 0xE0, 0xAB, 0xF2, 0x9E, 0xF1, 0x8F, 0x41, 0x7C,
+    0x7D, 0x24, 0x48, 0xAE, 0x26, 0x3B, 0x5A, 0xE0, 0xE0, 0x04, 0xFB, 0x19, 0xFC, 0x9F, 0xE8, 0x9F,
+    0x5E, 0x7D, 0xA3, 0x1D, 0x3D, 0x49, 0xB0, 0x75, 0xC5, 0x25, 0xBA, 0xBA, 0x12, 0x46, 0x6C, 0x83,
+    0x96, 0x3A, 0x8C, 0xCC, 0x47, 0x0D, 0xC0, 0x18, 0x3E, 0x64, 0x98, 0x96, 0xC6, 0x6A, 0x19, 0x4A,
+    0x44, 0x27, 0x83, 0xE7, 0x5D, 0x33, 0xA2, 0xF2, 0x54, 0xB0, 0x1A, 0x00, 0x43, 0xB6, 0x84, 0x38,
+    0xF2, 0x1E, 0xDD, 0x0D, 0x88, 0xD1, 0x42, 0x77, 0xAF, 0xE8, 0x5E, 0x1B, 0x84, 0xEC, 0x7B, 0x03,
+    0x3B, 0x28, 0xF1, 0xFF, 0x71, 0x23, 0xB5, 0x42, 0x1C, 0x41, 0x66, 0xA7, 0x4D, 0xCD, 0xA7, 0x8E,
+    0xAD, 0xAD, 0xE4, 0x1D, 0x8B, 0xB7, 0x0E, 0x9B, 0x9D, 0xE1, 0x79, 0x16, 0x76, 0xA1, 0x56, 0x19,
+    0xE5, 0x3E, 0x85, 0xAF, 0xDF, 0x5C, 0x1B, 0xE7, 0xA9, 0x3E, 0x09, 0xDE, 0x59, 0xA6, 0x14, 0xC2,
+    0x6B, 0x42, 0x19, 0xD4, 0xE1, 0x1A, 0xDA, 0x2B, 0x45, 0x5C, 0xC0, 0x90, 0xC1, 0x97, 0x1A, 0x82,
+    0xA9, 0xC7, 0xFA, 0x5F, 0x58, 0x49, 0x48, 0x55, 0x51, 0x05, 0xF8, 0xD0, 0xFA, 0x74, 0x2C, 0xF3,
+    0xF1, 0xB7, 0xE7, 0x81, 0x7D, 0xFF, 0x2E, 0x61, 0xBF, 0x26, 0xDC, 0xE2, 0xFB, 0x79, 0x03, 0xE8,
+    0xB5, 0x3C, 0xA7, 0x3B, 0x0A, 0xF5, 0x7B, 0x9C, 0xA3, 0xE7, 0xBB, 0x6B, 0x0F, 0x2D, 0x0D, 0xEE,
+    0xA5, 0x70, 0xF4, 0xCB, 0x77, 0x8D, 0x5D, 0xE7, 0xB7, 0x9D, 0x09, 0x1A, 0xDC, 0x0D, 0xF7, 0x85,
+    0xF8, 0x65, 0x71, 0x8B, 0x7B, 0xF7, 0x4B, 0xD2, 0x7F, 0x4D, 0xEB, 0x91, 0xAC, 0x39, 0xB1, 0xD0,
+    0x46, 0xD8, 0x5B, 0xFA, 0xF2, 0x02, 0xAE, 0x2C, 0x08, 0xF1, 0xFE, 0x8E, 0x40, 0x7B, 0x71, 0xB9,
+    0x84, 0x29, 0x94, 0x1F, 0x3B, 0xB9, 0x34, 0xE4, 0x43, 0x63, 0xAD, 0xE9, 0x09, 0xDB, 0x7B, 0x85,
+    0x81, 0x31, 0x29, 0xEE, 0x45, 0xA1, 0x41, 0x2D, 0x0A, 0xD0, 0xB5, 0x7A, 0x88, 0x78, 0x01, 0x24,
+    0x3A, 0x91, 0x61, 0x6E, 0x5F, 0x6D, 0x54, 0x05, 0xEE, 0x54, 0xA8, 0x83, 0x76, 0xA6, 0x0B, 0xB3,
+    0x47, 0xAF, 0x03, 0xE5, 0x40, 0x11, 0x5A, 0x6E, 0x28, 0xC2, 0xDD, 0x06, 0xD4, 0xE9, 0xDF, 0x78,
+    0xA6, 0x45, 0x72, 0x81, 0x53, 0xEF, 0xEC, 0xCD, 0x44, 0xC3, 0xC5, 0xAD, 0xA3, 0xC3, 0xD7, 0xF0,
+    0xA0, 0xB9, 0x3E, 0x56, 0xD7, 0x04, 0xA7, 0xDF, 0xE3, 0xE7, 0x9A, 0xBC, 0x3F, 0xF4, 0xE5, 0x75,
+    0x20, 0x4A, 0xE5, 0x9A, 0xFD, 0x0E, 0xFE, 0x75, 0x14, 0xF0, 0x0F, 0x41, 0x77, 0xFD, 0x35, 0x3D,
+    0x99, 0x97, 0xC1, 0x02, 0xB5, 0x96, 0xE7, 0x08, 0xE8, 0x0D, 0x02, 0xF8, 0x11, 0x74, 0xB5, 0xC5,
+    0xC9, 0x95, 0xBB, 0x2C, 0xC3, 0x28, 0x33, 0x5F, 0xCC, 0x9D, 0x17, 0x84, 0x2C, 0x51, 0x45, 0x47,
+    0x86, 0x70, 0xC5, 0xA4, 0xCF, 0x20, 0x47, 0x3E, 0x7E, 0x2D, 0x2C, 0x31, 0x88, 0x77, 0xA1, 0xA3,
+    0x1F, 0xCD, 0xFA, 0x6D, 0xF3, 0xCE, 0x8E, 0x23, 0xE6, 0x71, 0x36, 0xC8, 0x7B, 0x97, 0x31, 0x96,
+    0xF5, 0x08, 0x5F, 0x3D, 0x94, 0x41, 0xA9, 0xEA, 0xBC, 0x85, 0xFA, 0xCD, 0xF4, 0x9C, 0x59, 0x7D,
+    0xF1, 0xFB, 0x80, 0x85, 0xFC, 0x79, 0x76, 0x07, 0x03, 0x64, 0xD6, 0xBF, 0x3F, 0x6F, 0xE9, 0x90,
+    0xED, 0xB8, 0x6C, 0x69, 0x1C, 0x43, 0xE2, 0x60, 0xFD, 0x68, 0xE0, 0x18, 0xDA, 0x7A, 0x1C, 0x66,
+    0x83, 0x0D, 0xCF, 0xEF, 0x35, 0x38, 0x7E, 0x6B, 0xDD, 0x88, 0xC6, 0x2C, 0x35, 0x8C, 0x14, 0x93,
+    0x18, 0x7C, 0x09, 0xA6, 0x90, 0x97, 0x77, 0x72, 0x4F, 0x3E, 0x01, 0xF3, 0xC3, 0x1F, 0x0F, 0xE2,
+    0xA4, 0x88, 0x84, 0x7F, 0x12, 0x9C, 0x24, 0x4E, 0xDE, 0x92, 0x1E, 0xD3, 0xFE, 0xAB, 0x06, 0x91,
+    0xF2, 0x2C, 0x71, 0xF2, 0xC2, 0x15, 0xA8, 0xBD, 0x9B, 0x10, 0xD7, 0x7C, 0x70, 0xB5, 0x72, 0xC1,
+    0xDA, 0x99, 0xED, 0xF3, 0x18, 0xB1, 0x27, 0x14, 0x95, 0x68, 0x5C, 0x2C, 0x69, 0x70, 0xE4, 0x9D,
+    0xD0, 0x13, 0x1E, 0x3F, 0x5F, 0x17, 0xAE, 0x51, 0x5C, 0xBF, 0x56, 0xC9, 0x48, 0x58, 0x47, 0x60,
+    0x2A, 0x32, 0x0E, 0x9E, 0x85, 0xB4, 0x24, 0xA2, 0xD1, 0x67, 0xDD, 0x10, 0x4D, 0xCF, 0xF7, 0xEF,
+    0xB7, 0xE5, 0xC2, 0x28, 0x4F, 0xAE, 0x95, 0x02, 0x3F, 0x3B, 0xCE, 0x29, 0x90, 0xFA, 0x81, 0xFF,
+    0x9B, 0x59, 0xCE, 0xB5, 0x80, 0x46, 0x82, 0xD9, 0x44, 0x69, 0x1E, 0x56, 0x87, 0x87, 0xFF, 0x2F,
+    0xD2, 0x60, 0x9F, 0x27, 0x22, 0x36, 0xD6, 0xE3, 0xED, 0x13, 0xBB, 0x22, 0x0E, 0x78, 0x79, 0x43,
+    0xB1, 0xE5, 0xFE, 0xF7, 0xC0, 0xFD, 0x9D, 0x7D, 0xF4, 0x83, 0x4F, 0x87, 0xA5, 0xE2, 0x12, 0x58,
+    0xC4, 0xCE, 0x4A, 0xB1, 0x30, 0xA1, 0x03, 0xFB, 0x7E, 0x8A, 0x6B, 0xD3, 0xD8, 0xDF, 0x1B, 0xFD,
+    0xFB, 0x8C, 0x38, 0xAA, 0xE4, 0xE1, 0x3E, 0x84, 0x20, 0xE1, 0x9D, 0xBC, 0x9F, 0xF4, 0x26, 0x03,
+    0xF4, 0x8F, 0xFE, 0x74, 0x76, 0x96, 0x3F, 0x28, 0x56, 0x19, 0x60, 0xDF, 0x38, 0x3F, 0x0A, 0x34,
+    0xBE, 0x5B, 0x37, 0x7A, 0xFB, 0xF7, 0x22, 0x55, 0x6C, 0x45, 0x3F, 0x99, 0x33, 0xBB, 0xBF, 0x27,
+    0xFA, 0x77, 0x4F, 0xCF, 0x47, 0x88, 0x7B, 0x67, 0x29, 0x47, 0xDC, 0x9D, 0xC2, 0x5A, 0x2E, 0x1B,
+    0xB5, 0xFB, 0x59, 0xA8, 0xDF, 0x9C, 0xC4, 0x5A, 0x32, 0xCB, 0x5A, 0x9A, 0x09, 0x6B, 0xE9, 0x4F,
+    0x63, 0x2D, 0xE9, 0xC3, 0x43, 0x63, 0x9E, 0x7D, 0xC7, 0xD9, 0xFA, 0x0B, 0xE7, 0x2B, 0x62, 0x88,
+    0xF9, 0x1C, 0x92, 0x8C, 0x67, 0x8E, 0xD8, 0x6E, 0x3E, 0x79, 0x93, 0xCA, 0x72, 0xF0, 0x43, 0x90,
+    0x8F, 0xD3, 0x3D, 0x35, 0xE3, 0x80, 0x7B, 0xCF, 0xEC, 0x32, 0xAF, 0xC7, 0x64, 0x4C, 0xFA, 0x81,
+    0x79, 0xCB, 0xA8, 0xC0, 0xC0, 0xB5, 0x0B, 0xD6, 0x6A, 0x59, 0xE2, 0xD1, 0xB6, 0xE7, 0xA6, 0x6D,
+    0x79, 0x02, 0x75, 0x50, 0x63, 0x63, 0x2B, 0x1E, 0x35, 0x98, 0x98, 0x4B, 0xA8, 0xA0, 0x72, 0xBC,
+    0x9C, 0x04, 0x3C, 0xB5, 0x16, 0xE8, 0x02, 0x94, 0x30, 0xE4, 0xED, 0xC4, 0x03, 0x21, 0x16, 0x48,
+    0x3B, 0x1C, 0x30, 0xEE, 0x51, 0x25, 0x2E, 0x1B, 0x0A, 0x2C, 0x07, 0x1B, 0x2E, 0x73, 0x31, 0x0E,
+    0x40, 0x90, 0x38, 0x87, 0xF9, 0xB6, 0x47, 0x7B, 0x90, 0x25, 0x25, 0xEF, 0x9E, 0xA4, 0xF2, 0xA0,
+    0xB0, 0xCF, 0xD5, 0xC2, 0x1B, 0x0A, 0xF9, 0x0A, 0xDC, 0x2D, 0xFE, 0x8B, 0x52, 0xC7, 0x5E, 0xF2,
+    0x47, 0x6B, 0x1D, 0x68, 0x59, 0x50, 0x31, 0x3C, 0xDD, 0xAC, 0xE6, 0x95, 0x4E, 0x83, 0xC6, 0xAF,
+    0xD1, 0xC8, 0xE4, 0x5B, 0xCD, 0xAC, 0x61, 0x2C, 0xFB, 0x7F, 0xDF, 0x22, 0x40, 0x52, 0x9A, 0xF4,
+    0x8B, 0xCA, 0x14, 0xB0, 0x28, 0xCE, 0x3F, 0x96, 0x1E, 0xBC, 0x56, 0x6A, 0x14, 0x49, 0xAC, 0xBD,
+    0x22, 0x5D, 0xCC, 0x9E, 0x91, 0x47, 0x06, 0xAD, 0x1D, 0xB6, 0x7E, 0x6D, 0x8E, 0xFF, 0x64, 0xFC,
+    0x1F, 0xE7, 0xC9, 0x0E, 0xC6, 0x42, 0x82, 0x55, 0x5C, 0x31, 0x0E, 0x63, 0x30, 0x18, 0x75, 0x2E,
+    0x31, 0x2A, 0x21, 0x84, 0x6A, 0x28, 0x73, 0x8E, 0x89, 0x5A, 0x98, 0x2E, 0x1B, 0x93, 0xAD, 0x3D,
+    0xFA, 0x4E, 0xFB, 0x0D, 0x02, 0x70, 0xB7, 0xDE, 0xDD, 0x0A, 0x99, 0x8E, 0xB5, 0xFF, 0xEB, 0x2D,
+    0xDA, 0xDD, 0xCC, 0xFF, 0x67, 0x83, 0x18, 0xEA, 0x55, 0x58, 0x22, 0xBD, 0x53, 0x16, 0xA9, 0x74,
+    0x85, 0x65, 0x3F, 0xCE, 0x4C, 0xC2, 0x20, 0x37, 0x99, 0xAE, 0xAD, 0x06, 0x1B, 0x69, 0x2A, 0xDD,
+    0xD6, 0xA6, 0xC8, 0x9D, 0xAC, 0xC8, 0xEC, 0x64, 0x01, 0xAA, 0x51, 0xE0, 0x54, 0x95, 0xE7, 0x83,
+    0x85, 0xFA, 0x1D, 0x0E, 0x55, 0xE5, 0xC9, 0xA1, 0x04, 0xF5, 0x15, 0xD7, 0x1D, 0x0D, 0x98, 0x84,
+    0xC8, 0x8A, 0x4E, 0xD5, 0x1E, 0x1D, 0xA0, 0x47, 0x48, 0x81, 0x16, 0xEE, 0x33, 0x2C, 0x52, 0x15,
+    0xEF, 0xB0, 0x76, 0xAA, 0xD3, 0x64, 0x15, 0x38, 0x25, 0xF4, 0x88, 0x69, 0x4D, 0x16, 0xBE, 0x5E,
+    0x2C, 0xDF, 0x39, 0x3B, 0x54, 0xA9, 0xEF, 0xF6, 0x35, 0x2E, 0x5B, 0xAD, 0x1D, 0xF4, 0x0E, 0x64,
+    0xEB, 0x31, 0x3E, 0x35, 0xA8, 0xAC, 0x17, 0x7E, 0x27, 0x62, 0x75, 0x79, 0xA3, 0xCF, 0xC7, 0xAB,
+    0x36, 0x3B, 0x9E, 0xCB, 0xB9, 0x30, 0x7F, 0x9B, 0x62, 0xC5, 0x8C, 0x80, 0x5E, 0x71, 0xD4, 0x9A,
+    0x8B, 0x0C, 0xBA, 0x5D, 0xEB, 0x79, 0xD6, 0xED, 0xA8, 0x5E, 0xD7, 0xCC, 0xFA, 0x48, 0x33, 0x3B,
+    0x6C, 0x32, 0xEB, 0x69, 0xCF, 0xAC, 0x57, 0x3E, 0x5B, 0xBC, 0x76, 0x7B, 0x21, 0x4B, 0x45, 0xB6,
+    0x93, 0x2E, 0xB6, 0x85, 0x9B, 0x58, 0xBF, 0xB7, 0x51, 0x4F, 0xC3, 0xF9, 0x03, 0x56, 0x7B, 0xC8,
+    0x78, 0x7F, 0x4D, 0x27, 0x52, 0x57, 0x83, 0x51, 0x0F, 0xB3, 0xE2, 0x44, 0x1E, 0x7C, 0x19, 0x2F,
+    0xD9, 0xDF, 0x2A, 0xD6, 0x99, 0xC6, 0xF8, 0x33, 0x9D, 0x2C, 0xD6, 0xE4, 0x1C, 0x2A, 0x6B, 0x8A,
+    0xE0, 0x27, 0xEA, 0x1B, 0x86, 0x63, 0x37, 0x60, 0xB5, 0xD7, 0xDF, 0x6B, 0x19, 0x7B, 0xA5, 0x61,
+    0x8A, 0x54, 0xB0, 0x74, 0x25, 0x00, 0xA4, 0x6A, 0x28, 0x6B, 0xEB, 0x3E, 0x9B, 0xBC, 0x51, 0xD8,
+    0xD9, 0xE8, 0xFD, 0xC4, 0x4C, 0xCE, 0xCC, 0xC7, 0x3B, 0xC8, 0xDD, 0x9E, 0xC1, 0x9D, 0xBF, 0x7B,
+    0xC0, 0xA7, 0xB4, 0xAD, 0xB5, 0x03, 0xAB, 0x72, 0xA0, 0xAB, 0x00, 0x63, 0x30, 0x75, 0x28, 0xAB,
+    0xA7, 0x4B, 0x33, 0xA4, 0xD4, 0xEF, 0x9C, 0x68, 0xA6, 0x54, 0xA6, 0xE6, 0x11, 0x3A, 0x4A, 0x65,
+    0xC8, 0x91, 0xA8, 0xB3, 0xDA, 0xDA, 0x0C, 0xB9, 0xE0, 0x06, 0xB7, 0x5F, 0x69, 0x74, 0xBC, 0x6A,
+    0x1A, 0x29, 0xBD, 0xC0, 0xC9, 0x47, 0x1D, 0xBC, 0xA0, 0xC2, 0x8C, 0x19, 0xDE, 0xA4, 0x89, 0x2E,
+    0xA2, 0x1B, 0x33, 0xCC, 0xC9, 0xC7, 0x04, 0x03, 0x9B, 0x80, 0xD4, 0x22, 0x93, 0x8E, 0xF1, 0x4E,
+    0xBA, 0x0A, 0x8A, 0xB2, 0x2C, 0x5C, 0x25, 0x2E, 0x19, 0xE0, 0xAC, 0x6C, 0x3E, 0xB7, 0x5E, 0x1E,
+    0xDA, 0xAA, 0xC2, 0xF5, 0x10, 0x66, 0xA8, 0x81, 0x69, 0x6C, 0xD6, 0x5D, 0xB2, 0xC9, 0x5F, 0x73,
+    0xAD, 0xFD, 0x15, 0xDB, 0xB4, 0x66, 0x93, 0x60, 0x1A, 0x52, 0x1E, 0x21, 0xA2, 0x18, 0xDA, 0x93,
+    0x71, 0xE2, 0x71, 0xFA, 0x79, 0x4D, 0xF2, 0x87, 0x1B, 0x04, 0xD8, 0xA1, 0x2D, 0x55, 0x82, 0xE0,
+    0xE4, 0x2A, 0xE1, 0x9C, 0x4A, 0x40, 0xC4, 0x32, 0x41, 0x04, 0xA9, 0x5C, 0xAA, 0xFF, 0xE2, 0x7C,
+    0x25, 0x50, 0x23, 0x2E, 0xE3, 0xDC, 0x4A, 0xCB, 0xA5, 0x75, 0xB4, 0x6F, 0x14, 0xD3, 0x79, 0x20,
+    0xAD, 0xB9, 0xC3, 0xB8, 0x69, 0x8D, 0xF5, 0x62, 0x04, 0x91, 0x7A, 0xFF, 0x82, 0xCD, 0x8A, 0x98,
+    0xD1, 0x06, 0x99, 0x51, 0x0F, 0x2F, 0x86, 0x4D, 0x8E, 0xF9, 0xB0, 0x58, 0x88, 0x40, 0xBD, 0xB6,
+    0xC3, 0xB2, 0x1A, 0xF1, 0xF2, 0x46, 0x57, 0x7C, 0x54, 0x6B, 0x88, 0xDC, 0xB7, 0x1B, 0x0E, 0xEB,
+    0x28, 0x57, 0x67, 0x79, 0x94, 0xC3, 0x8D, 0x1E, 0xAE, 0xA3, 0x1C, 0x9E, 0xB2, 0xB8, 0x14, 0x29,
+    0x3A, 0x87, 0xA3, 0x3D, 0xCA, 0xD1, 0x4E, 0x61, 0x7D, 0x39, 0xA2, 0x1B, 0x90, 0xF0, 0x19, 0x54,
+    0x19, 0x32, 0x40, 0xF3, 0xF9, 0x16, 0xEB, 0x6E, 0x94, 0xFB, 0x0D, 0x63, 0x95, 0x73, 0xAF, 0x11,
+    0xFE, 0x0D, 0x1F, 0x66, 0x37, 0x59, 0xE3, 0xAA, 0x29, 0x5A, 0x69, 0x82, 0x4A, 0x43, 0xB1, 0xC3,
+    0xAB, 0x0F, 0xE8, 0xB2, 0xAC, 0xE8, 0xD1, 0x9C, 0x57, 0x94, 0x54, 0xF0, 0x7C, 0x78, 0x76, 0x6F,
+    0x89, 0x66, 0xA8, 0x43, 0xD3, 0xD8, 0xB6, 0x8B, 0x88, 0x12, 0xFE, 0x08, 0xBD, 0xDA, 0x86, 0x3F,
+    0x94, 0x45, 0x1A, 0x59, 0xF2, 0x72, 0xEC, 0xD7, 0xE8, 0x16, 0x0A, 0x0F, 0x09, 0x16, 0x06, 0x41,
+    0x39, 0xA5, 0x88, 0x48, 0xE4, 0x88, 0x32, 0x94, 0x55, 0xAA, 0x4D, 0xD2, 0xB0, 0x94, 0x01, 0xA1,
+    0x41, 0x63, 0xBB, 0xC8, 0x6B, 0x17, 0x0B, 0x04, 0xAC, 0x17, 0xAA, 0x8E, 0xD0, 0x1A, 0x4A, 0xB6,
+    0xC2, 0x44, 0xAA, 0x2D, 0x27, 0x82, 0xD7, 0xEA, 0xFB, 0xA8, 0xB7, 0x51, 0x4D, 0xA2, 0x18, 0x9F,
+    0x6B, 0x0D, 0xED, 0xB5, 0x81, 0xBE, 0xE0, 0x39, 0xD9, 0x07, 0xDD, 0x6B, 0xF0, 0x8D, 0x50, 0xD6,
+    0xF2, 0x5A, 0x4A, 0x56, 0xB3, 0x86, 0x0E, 0x4C, 0x3A, 0xFD, 0x93, 0x74, 0x5E, 0x71, 0x5E, 0x51,
+    0xB8, 0xE2, 0x7A, 0x29, 0x2F, 0x8C, 0x85, 0x14, 0x42, 0x17, 0xA5, 0x35, 0x19, 0x34, 0xE5, 0x48,
+    0x0C, 0x66, 0x2B, 0xB5, 0x56, 0x10, 0x55, 0xCE, 0xD5, 0xAF, 0x15, 0x6A, 0xC2, 0x16, 0x5A, 0xB6,
+    0xB2, 0xE9, 0x20, 0x30, 0x4D, 0x54, 0x2E, 0x09, 0x4C, 0xA3, 0xBA, 0x67, 0x6C, 0x5D, 0x4C, 0x83,
+    0x49, 0xF1, 0xCB, 0xBB, 0x9D, 0x34, 0x2A, 0xD8, 0x64, 0xA9, 0x5F, 0x07, 0xF2, 0xB4, 0x79, 0x05,
+    0x6A, 0x21, 0x4F, 0x4C, 0xF0, 0x3A, 0xD8, 0xC8, 0x48, 0x90, 0xDF, 0x44, 0x48, 0x4A, 0x03, 0x59,
+    0xC1, 0x90, 0x67, 0x60, 0x1A, 0xE4, 0x19, 0x20, 0x6E, 0x2D, 0x52, 0x89, 0xFC, 0xA4, 0x83, 0x40,
+    0xF8, 0xDD, 0xAB, 0x2E, 0xB8, 0x42, 0x19, 0x72, 0xE7, 0xB2, 0x08, 0xE4, 0x25, 0x0A, 0x1D, 0x9C,
+    0x6B, 0x4F, 0x47, 0x2F, 0x27, 0xA6, 0x61, 0x1E, 0x55, 0x68, 0xC7, 0x39, 0xA3, 0x01, 0x10, 0x41,
+    0x5E, 0xF4, 0x43, 0x26, 0x6E, 0xED, 0x0E, 0x10, 0x9B, 0xB1, 0x5C, 0xF6, 0xFF, 0xF9, 0x76, 0xA1,
+    0xEE, 0x61, 0x69, 0x34, 0x43, 0x33, 0x2B, 0x4C, 0x74, 0x0E, 0x5B, 0x11, 0x14, 0x1A, 0x8E, 0x5B,
+    0xA1, 0xAD, 0x86, 0x9A, 0x90, 0xC8, 0x99, 0x4A, 0x1F, 0x2B, 0xC6, 0x8A, 0xD0, 0xA7, 0x9C, 0x29,
+    0x13, 0x4F, 0xD2, 0x4C, 0x63, 0x9F, 0x90, 0x9C, 0xC7, 0x90, 0xA7, 0x88, 0x0E, 0x62, 0x04, 0xDD,
+    0xAF, 0x33, 0x0D, 0x94, 0x0A, 0x47, 0x29, 0xCD, 0xB3, 0x83, 0xCF, 0x61, 0x68, 0x25, 0x37, 0x37,
+    0xCA, 0x1D, 0x19, 0xBA, 0x21, 0xBD, 0xB7, 0x52, 0xCF, 0xFB, 0xAC, 0x51, 0x03, 0x6B, 0x60, 0x87,
+    0x3C, 0x64, 0x12, 0xE8, 0x30, 0x9A, 0x22, 0xA3, 0x06, 0x6A, 0x81, 0x77, 0x3B, 0x44, 0xE2, 0x9B,
+    0xEC, 0xF7, 0xD1, 0x51, 0x32, 0x48, 0x66, 0x5B, 0xA1, 0xB1, 0x0C, 0xE7, 0xD9, 0x56, 0x24, 0x33,
+    0x19, 0xCF, 0x82, 0x6B, 0x0C, 0xE8, 0xD9, 0x16, 0xE2, 0x7C, 0x20, 0x98, 0x63, 0x1E, 0x6E, 0x81,
+    0x15, 0x62, 0x25, 0xE0, 0x56, 0x30, 0x6D, 0x4C, 0xA7, 0x41, 0xEA, 0x6F, 0x20, 0xDA, 0x34, 0x33,
+    0xAC, 0x7E, 0x7F, 0x80, 0xEC, 0xBD, 0x5F, 0xD2, 0x56, 0x4F, 0x93, 0x16, 0x43, 0x45, 0x3A, 0xD1,
+    0x7D, 0x44, 0x77, 0x4B, 0xF6, 0x4D, 0xB2, 0xF9, 0x8C, 0xCB, 0xCC, 0xD9, 0xF5, 0xD3, 0xEC, 0xC8,
+    0xAA, 0x8B, 0xAB, 0x1D, 0xF5, 0x79, 0x80, 0xF7, 0x8D, 0xB7, 0xBC, 0xA9, 0xCB, 0xE2, 0xDA, 0x09,
+    0xFC, 0x9C, 0x04, 0xCC, 0x4A, 0x1A, 0x01, 0xBF, 0x63, 0x6A, 0x8F, 0x08, 0x08, 0x97, 0x6E, 0xB0,
+    0x68, 0x40, 0x87, 0x61, 0x27, 0x8D, 0xFB, 0x20, 0xB5, 0x2B, 0x5B, 0x67, 0x45, 0x71, 0xB9, 0xD9,
+    0xAD, 0x9B, 0xFD, 0x3E, 0x6D, 0x44, 0xEA, 0xAA, 0xBF, 0x90, 0x9A, 0xAF, 0xEB, 0xF8, 0xDE, 0x97,
+    0x37, 0x94, 0xD7, 0xEF, 0x11, 0x71, 0xF9, 0x81, 0x50, 0x10, 0x3C, 0x36, 0xD2, 0x2C, 0x90, 0xB5,
+    0x46, 0xFD, 0x87, 0x1F, 0x5C, 0x6D, 0x87, 0x60, 0xA6, 0x64, 0x00, 0x2B, 0xDB, 0x94, 0x04, 0xD3,
+    0x30, 0x61, 0x7A, 0xA5, 0x16, 0x34, 0xE8, 0x86, 0xF8, 0xA7, 0xB1, 0x68, 0x81, 0x0D, 0x19, 0x32,
+    0x17, 0xDE, 0xE8, 0xD4, 0x9D, 0x13, 0x61, 0x41, 0x4D, 0xFE, 0x77, 0x6A, 0xCD, 0x71, 0xAB, 0x41,
+    0xCF, 0x41, 0x23, 0x55, 0xD6, 0xF1, 0x96, 0xCB, 0xAB, 0xBA, 0xDA, 0xEE, 0x41, 0x80, 0x4E, 0xD2,
+    0x42, 0xC7, 0xD2, 0x43, 0xA2, 0x4C, 0xC3, 0x1D, 0x38, 0x42, 0x0B, 0x1D, 0xB1, 0x58, 0xAE, 0xE6,
+    0x15, 0x64, 0x2F, 0x8C, 0x71, 0x19, 0x8E, 0xAD, 0xA8, 0x2C, 0x95, 0xA6, 0x69, 0xAE, 0xD9, 0x24,
+    0xBC, 0xD3, 0xAC, 0x50, 0xFB, 0xB3, 0x4A, 0x25, 0xF7, 0x81, 0x2E, 0xEE, 0x8F, 0x89, 0xA5, 0xE7,
+    0x85, 0xE0, 0x05, 0xC2, 0x17, 0x8C, 0xE3, 0x0B, 0xB2, 0xD6, 0x91, 0x3B, 0x4C, 0x60, 0x7B, 0x0C,
+    0x1E, 0x4C, 0x60, 0x0B, 0x9E, 0x62, 0x61, 0x23, 0xEC, 0x4F, 0xEE, 0x10, 0x83, 0xD7, 0xD4, 0xC8,
+    0x6C, 0x0A, 0xAA, 0x00, 0xFC, 0x68, 0xE3, 0xF7, 0x37, 0xEF, 0x6A, 0xB4, 0x4E, 0xC7, 0x30, 0xB4,
+    0xCD, 0x10, 0x34, 0x1E, 0xDC, 0x27, 0x1C, 0x92, 0x45, 0xF6, 0x8D, 0x0B, 0xB5, 0xA1, 0x90, 0x9C,
+    0x1B, 0xCE, 0x93, 0x8A, 0x82, 0x4A, 0x50, 0xAB, 0x6D, 0xBB, 0xD1, 0x3C, 0xB8, 0xCE, 0x69, 0xDA,
+    0x1C, 0x1D, 0xB2, 0x02, 0xAA, 0xD1, 0x52, 0xC7, 0x59, 0x59, 0x68, 0x48, 0x9D, 0xE6, 0x2F, 0x1E,
+    0x45, 0xF6, 0x6F, 0x7A, 0x66, 0xA6, 0x31, 0x2D, 0xD6, 0xF0, 0x69, 0xEF, 0x19, 0xEB, 0x13, 0xF0,
+    0xBC, 0x59, 0xEB, 0x9E, 0x0E, 0x03, 0x02, 0x96, 0xC5, 0xE2, 0xCE, 0x0D, 0x3A, 0xD3, 0xB4, 0x63,
+    0x3D, 0x2B, 0xBD, 0x6A, 0x29, 0x0E, 0x04, 0x7D, 0x99, 0x4C, 0x67, 0xA3, 0x2C, 0x0E, 0xDD, 0x2B,
+    0x7D, 0x2A, 0x24, 0x81, 0x5D, 0x4C, 0x43, 0x0D, 0xE7, 0x55, 0x81, 0x49, 0xDC, 0xD1, 0xBB, 0xB0,
+    0x5C, 0xDE, 0xA8, 0xC9, 0x3C, 0x09, 0x98, 0xAF, 0xB4, 0xC2, 0x1F, 0x78, 0x4A, 0x62, 0x74, 0x6D,
+    0x11, 0xD5, 0x17, 0x37, 0x98, 0xE3, 0x56, 0x1E, 0x49, 0x13, 0xF3, 0x81, 0x57, 0xEC, 0xB8, 0x2F,
+    0xF8, 0xCA, 0xA2, 0xAD, 0x33, 0x1E, 0xBD, 0xC7, 0x93, 0x40, 0x20, 0x8D, 0x51, 0xA7, 0xBC, 0x44,
+    0x3B, 0xAF, 0x71, 0xD1, 0xBF, 0xAB, 0x21, 0xC1, 0x54, 0x5D, 0x80, 0x36, 0x45, 0xD2, 0xA8, 0x2F,
+    0xD0, 0x85, 0x99, 0xCA, 0x45, 0xE4, 0x1E, 0x34, 0x93, 0x53, 0x55, 0xA4, 0x25, 0x78, 0xAD, 0x06,
+    0xE1, 0x0D, 0x69, 0x3E, 0xA7, 0xCD, 0x51, 0xD7, 0x3C, 0x08, 0x85, 0x36, 0x13, 0x54, 0x65, 0xCA,
+    0x4E, 0x51, 0xA1, 0x2B, 0x61, 0xA6, 0xF2, 0x66, 0xA2, 0x43, 0x3A, 0x76, 0x9D, 0xFE, 0x0C, 0x98,
+    0x8C, 0xC7, 0x30, 0x4D, 0xE1, 0x21, 0x68, 0xE7, 0x6D, 0xCC, 0x78, 0x79, 0x56, 0xC4, 0xFF, 0xD0,
+    0x60, 0xD8, 0x78, 0xAD, 0x47, 0xA1, 0x79, 0x5D, 0x07, 0x46, 0xC3, 0x3B, 0x44, 0x2A, 0xA1, 0xFA,
+    0xBE, 0x62, 0xEB, 0x33, 0x6A, 0xC9, 0xC9, 0x1F, 0x00, 0xC6, 0x6F, 0x33, 0xD4, 0xED, 0x6F, 0x98,
+    0x10, 0x09, 0xFD, 0x5F, 0xB8, 0x46, 0x6E, 0xAC, 0x05, 0x40, 0x4D, 0x00, 0xDE, 0xF7, 0x68, 0xAC,
+    0x31, 0x9D, 0x95, 0xF2, 0xAD, 0xA8, 0x90, 0xB7, 0x5A, 0x8D, 0x83, 0x2F, 0x36, 0xAB, 0x42, 0x8A,
+    0xC0, 0xCF, 0x79, 0xC7, 0xB4, 0xD0, 0xA7, 0x9A, 0xF2, 0x9F, 0xCB, 0x97, 0xC6, 0xA5, 0x2E, 0x08,
+    0xAB, 0xCA, 0x91, 0x54, 0xC8, 0x67, 0x1D, 0x90, 0x86, 0xB1, 0x21, 0x23, 0xDE, 0x35, 0xC9, 0x7C,
+    0x7A, 0x3D, 0x35, 0xFD, 0x99, 0x8D, 0x21, 0xB9, 0xB1, 0xAD, 0xA5, 0xA2, 0x66, 0x48, 0xEB, 0x2F,
+    0x95, 0xCB, 0xDC, 0x35, 0x30, 0x58, 0x67, 0xEA, 0xD9, 0xC5, 0x2C, 0xB6, 0xA9, 0xB3, 0x34, 0x8C,
+    0x57, 0xCE, 0x91, 0xAE, 0x52, 0x9B, 0x86, 0xBA, 0xF8, 0x35, 0x23, 0x61, 0x32, 0x63, 0x33, 0x65,
+    0xFC, 0xBA, 0xE0, 0x12, 0xC5, 0xF2, 0x2B, 0x7A, 0xC8, 0x62, 0x2F, 0x7A, 0xE8, 0x43, 0xF6, 0x28,
+    0x48, 0x74, 0xE6, 0x27, 0xEA, 0xB7, 0xF2, 0x92, 0x71, 0xAE, 0x87, 0x14, 0x1E, 0xED, 0x61, 0x61,
+    0xE3, 0xE0, 0x90, 0xDF, 0x26, 0x83, 0x40, 0x9F, 0x26, 0xFD, 0xDB, 0x90, 0x75, 0xC9, 0xDA, 0x1E,
+    0x89, 0x78, 0xCC, 0xB2, 0x56, 0x72, 0xD7, 0xFF, 0xB5, 0x55, 0x2B, 0xFF, 0xDA, 0x04, 0xBF, 0xA8,
+    0xF8, 0x16, 0xD2, 0x50, 0xFF, 0xE3, 0x8D, 0xF1, 0x3B, 0x06, 0xC1, 0xFA, 0x77, 0xE5, 0x4D, 0xFA,
+    0x3B, 0x28, 0xA5, 0xC4, 0xB4, 0x5F, 0x6B, 0x6A, 0x06, 0xD5, 0x2E, 0x6A, 0x20, 0x6E, 0x31, 0xA4,
+    0xAE, 0xD9, 0x08, 0x62, 0x63, 0x76, 0x22, 0x1A, 0x27, 0x21, 0x50, 0xB3, 0xD1, 0xC2, 0x32, 0xAF,
+    0x86, 0xC3, 0x68, 0xE0, 0xC9, 0xFF, 0xAC, 0x2F, 0x47, 0xD3, 0xF6, 0x68, 0xE5, 0xDE, 0x0E, 0x9C,
+    0xCE, 0x5A, 0x00, 0x36, 0x18, 0x1D, 0xB3, 0x66, 0x66, 0x6B, 0xA3, 0xF8, 0x5B, 0x32, 0x3E, 0x79,
+    0x51, 0x11, 0x51, 0xC1, 0xBC, 0xD4, 0xE7, 0x34, 0x98, 0xF1, 0x32, 0x9B, 0x93, 0x44, 0x1E, 0x4C,
+    0x65, 0x90, 0x36, 0x61, 0xEA, 0x83, 0x89, 0xE6, 0x6D, 0x92, 0x6C, 0x5A, 0xF4, 0xA4, 0x51, 0x8B,
+    0x21, 0x32, 0x3A, 0x3D, 0xAD, 0x43, 0x53, 0xD3, 0xD2, 0xA7, 0xD3, 0x09, 0xE6, 0x3E, 0x4D, 0xD3,
+    0x80, 0xCD, 0x4F, 0x27, 0x1C, 0x0C, 0x7F, 0x7C, 0xA4, 0x8C, 0x2C, 0x22, 0x79, 0x34, 0x4C, 0x80,
+    0xE0, 0xA1, 0x3A, 0xB6, 0x3C, 0x9B, 0x84, 0x6F, 0x1C, 0x37, 0xED, 0x86, 0x74, 0xA6, 0xF6, 0x38,
+    0x9D, 0x46, 0x43, 0xD4, 0x48, 0xA5, 0x51, 0xE2, 0x4C, 0x1C, 0x8D, 0xFE, 0xBA, 0x77, 0x83, 0xB3,
+    0x18, 0x6E, 0x52, 0x6C, 0xA6, 0xF7, 0xF2, 0x7B, 0xEB, 0xBC, 0x7C, 0xDF, 0xB8, 0x14, 0x39, 0x8A,
+    0x2C, 0xA2, 0x14, 0xF7, 0x3F, 0xE9, 0xA3, 0x06, 0x9D, 0xFC, 0xEE, 0xAC, 0x57, 0xD1, 0xAC, 0x48,
+    0xD9, 0x11, 0xA4, 0x1E, 0x06, 0x04, 0x67, 0x3E, 0x23, 0x34, 0x6C, 0xEC, 0x3A, 0xC6, 0x4E, 0xA1,
+    0x7C, 0xE0, 0x5E, 0xC8, 0x9E, 0x69, 0xAF, 0xB3, 0x77, 0xB1, 0xDC, 0x84, 0x4F, 0x10, 0x16, 0x83,
+    0xE7, 0x65, 0xB9, 0xDF, 0x9A, 0xCB, 0x1E, 0x12, 0xF6, 0xBE, 0xD3, 0x45, 0x8D, 0x0A, 0xF4, 0x95,
+    0x33, 0x41, 0x61, 0x75, 0xAE, 0x27, 0xEF, 0x30, 0x6B, 0x4F, 0xB4, 0xCD, 0xD9, 0xA1, 0x28, 0x54,
+    0x6D, 0xB5, 0xE4, 0x01, 0xA8, 0x8E, 0xDB, 0x84, 0xD5, 0xDE, 0x5C, 0xF3, 0x3B, 0xD5, 0x5A, 0xA1,
+    0xF9, 0x9C, 0x09, 0x39, 0x29, 0x3D, 0x01, 0x6A, 0x11, 0x1D, 0xA0, 0x7E, 0xA3, 0x7F, 0xD5, 0x6C,
+    0x38, 0xBD, 0x4A, 0x1A, 0x4E, 0x51, 0x2B, 0x93, 0xBB, 0xF9, 0xDA, 0x40, 0x6D, 0x5F, 0xC4, 0xD4,
+    0x3E, 0x7D, 0xBA, 0xCB, 0xE9, 0x7A, 0x3D, 0xB7, 0x5D, 0x39, 0x32, 0x88, 0xFE, 0x8E, 0x76, 0xE4,
+    0xFA, 0x25, 0xED, 0xAD, 0xF9, 0x0F, 0xDF, 0x79, 0xE3, 0x48, 0x2F, 0xCF, 0x86, 0x8E, 0x7F, 0xD3,
+    0x1D, 0xFC, 0x57, 0xD7, 0xFF, 0xCE, 0xFC, 0x70, 0xF1, 0xC8, 0xAB, 0xCF, 0x61, 0xCA, 0x64, 0x9B,
+    0xFB, 0x66, 0xA6, 0x1D, 0xFA, 0x51, 0xE3, 0x75, 0xC2, 0x84, 0x85, 0xA8, 0x5F, 0x30, 0xA2, 0xFD,
+    0x59, 0x7B, 0x92, 0xBC, 0x82, 0xE5, 0x45, 0xD4, 0xFB, 0x8D, 0xB1, 0x86, 0x00, 0x35, 0xFF, 0xD9,
+    0x04, 0x28, 0xCD, 0x42, 0x67, 0x7F, 0x15, 0x6E, 0xE0, 0x1D, 0x3D, 0xF0, 0xAB, 0x95, 0x3B, 0x28,
+    0x74, 0xEC, 0xF2, 0x4F, 0x18, 0x69, 0x93, 0x83, 0x4C, 0x0F, 0xE8, 0xEC, 0xF5, 0x1A, 0xBB, 0x80,
+    0x78, 0xCE, 0x40, 0xAC, 0x2E, 0x78, 0x4D, 0x3D, 0x93, 0xFE, 0x0F, 0x98, 0x7A, 0x26, 0x32, 0xBF,
+    0x0C, 0xC3, 0xA0, 0x4F, 0xE7, 0xE0, 0x38, 0x77, 0x84, 0x62, 0x85, 0x6A, 0x77, 0x7F, 0x41, 0x49,
+    0x27, 0xE8, 0x0F, 0x67, 0x1A, 0xB9, 0x03, 0x5F, 0xE2, 0x4E, 0x40, 0x6A, 0xD0, 0x3A, 0x5E, 0xA1,
+    0x56, 0xC6, 0xBD, 0xAB, 0xCA, 0xA3, 0xDF, 0x33, 0xCC, 0xB3, 0x36, 0xDF, 0x48, 0xAC, 0x03, 0x3F,
+    0xB3, 0xFD, 0x12, 0x59, 0x1C, 0xB8, 0xDF, 0xED, 0x8D, 0x7E, 0x60, 0xF1, 0x6E, 0xC9, 0xA1, 0x0B,
+    0x22, 0x1D, 0xFE, 0x0B, 0x4A, 0x86, 0x74, 0x6E, 0x4B, 0x5F, 0x0A, 0x6E, 0x4C, 0x78, 0xF8, 0xCF,
+    0xCD, 0x6F, 0xBD, 0xD2, 0x59, 0xB2, 0x6A, 0xBA, 0x9C, 0x4B, 0xD0, 0xB5, 0x91, 0x41, 0xA4, 0xAD,
+    0xC5, 0x1B, 0xB5, 0x75, 0x04, 0xC0, 0x17, 0x2C, 0x96, 0x95, 0xCC, 0x61, 0x2E, 0x8B, 0xB1, 0x95,
+    0xD6, 0x80, 0xD1, 0x27, 0x82, 0x63, 0x04, 0x17, 0x51, 0x85, 0x8C, 0x2A, 0xCC, 0x6A, 0x99, 0xA4,
+    0xDD, 0xD5, 0xBE, 0x53, 0xE5, 0xAB, 0xB2, 0x0A, 0x70, 0x1E, 0x43, 0xE2, 0xC7, 0x4B, 0xEE, 0x66,
+    0x46, 0x86, 0xAE, 0x64, 0x44, 0xD0, 0x5B, 0x53, 0xA0, 0x9F, 0xFE, 0xDB, 0x40, 0x07, 0x9B, 0xF9,
+    0x1D, 0xCF, 0x9C, 0xF4, 0xF3, 0xF7, 0xDA, 0xD8, 0xEF, 0x2D, 0x60, 0x93, 0x35, 0x6E, 0x86, 0x1B,
+    0xEF, 0xF6, 0xDE, 0xAB, 0xEC, 0xDE, 0xF5, 0x3F, 0xF0, 0x4A, 0x73, 0xEA, 0xCF, 0x13, 0xEF, 0x1C,
+    0x18, 0xA2, 0x57, 0xDE, 0x57, 0xE3, 0x50, 0x6E, 0xE3, 0x12, 0x65, 0x38, 0x47, 0x98, 0x75, 0x56,
+    0x70, 0x39, 0x52, 0x8A, 0x6B, 0x92, 0x22, 0x9D, 0x9D, 0x3F, 0x45, 0x3A, 0xBD, 0x57, 0x8A, 0xF4,
+    0xBC, 0x55, 0x79, 0x2A, 0x57, 0x9B, 0xFF, 0x0D, 0x32, 0x50, 0xB2, 0x79, 0x1D, 0xA0, 0x9E, 0x4E,
+    0xD1, 0xE4, 0xBE, 0x20, 0x44, 0x82, 0x6B, 0x7D, 0x2D, 0x13, 0xA2, 0x11, 0x01, 0xA0, 0xC6, 0xE2,
+    0x42, 0x1B, 0x69, 0xAA, 0x6D, 0xEA, 0xC6, 0xC0, 0xA3, 0x21, 0xD2, 0xBE, 0xB3, 0xED, 0x75, 0xF6,
+    0x54, 0x5C, 0x13, 0x74, 0xDF, 0x45, 0x2E, 0x4C, 0x29, 0xF7, 0x92, 0x6F, 0x10, 0xC1, 0x17, 0x9E,
+    0xF1, 0xB1, 0x8C, 0x90, 0xA1, 0x3A, 0x32, 0xCA, 0xF1, 0x5D, 0xB0, 0x86, 0x3C, 0x2A, 0x9A, 0xAD,
+    0xBC, 0x11, 0x7A, 0x20, 0x6A, 0x9C, 0x58, 0x39, 0xE7, 0xA2, 0xF6, 0x3F, 0x30, 0x27, 0xD2, 0xB7,
+    0xFE, 0xA1, 0x8C, 0x86, 0x67, 0x92, 0x12, 0x53, 0xE6, 0x10, 0x41, 0x53, 0x1C, 0x6D, 0xF1, 0xD6,
+    0x59, 0xC3, 0x63, 0xAC, 0xDF, 0x7B, 0xE8, 0x92, 0xC6, 0xFC, 0x95, 0x61, 0xE4, 0xB6, 0x16, 0x0D,
+    0x5B, 0x4F, 0xC6, 0xEA, 0x86, 0xEA, 0x9A, 0xC8, 0x61, 0x09, 0x32, 0x0E, 0x0C, 0xC2, 0x71, 0x2C,
+    0x7B, 0x0C, 0xFA, 0xF5, 0x0B, 0x08, 0xB3, 0xE8, 0xBC, 0x6D, 0xB2, 0x6F, 0x6A, 0x37, 0x48, 0x7B,
+    0x79, 0xFD, 0x1F, 0x98, 0xDF, 0xB3, 0x6C, 0x2F, 0x11, 0x02, 0x45, 0x79, 0x98, 0x7E, 0xC9, 0xB8,
+    0x28, 0xB9, 0xE8, 0x50, 0x79, 0xE8, 0xEA, 0x5A, 0xBF, 0xA9, 0x4D, 0x51, 0x7D, 0xC3, 0x05, 0x3E,
+    0x3D, 0x37, 0x59, 0x6F, 0xF2, 0x91, 0xB9, 0x0C, 0xA2, 0xC8, 0x97, 0xBC, 0x61, 0x90, 0x7D, 0xD9,
+    0x7C, 0xF3, 0xF4, 0x79, 0x22, 0x6B, 0xB2, 0x8E, 0x14, 0x0C, 0x59, 0x72, 0x26, 0x1F, 0x2F, 0xFE,
+    0x7B, 0x9C, 0x63, 0xC1, 0x75, 0x61, 0xBF, 0xDF, 0x34, 0xB8, 0xE9, 0x6F, 0xC9, 0x6D, 0xEC, 0x43,
+    0x9F, 0x31, 0xCF, 0x98, 0x07, 0xFD, 0x71, 0x51, 0x5B, 0x17, 0x84, 0x20, 0x6E, 0x41, 0xDE, 0xC4,
+    0x56, 0xB6, 0xF4, 0xFB, 0xFA, 0xCB, 0x33, 0x7D, 0x83, 0x20, 0x7D, 0xF3, 0x9B, 0x46, 0xDF, 0x20,
+    0x34, 0xFF, 0xC8, 0x3C, 0x82, 0x9F, 0xCB, 0x43, 0x6A, 0xB7, 0x3E, 0x79, 0x06, 0xFE, 0xAC, 0x4F,
+    0x9E, 0x43, 0x6E, 0xD6, 0x27, 0x87, 0xE9, 0x9B, 0xE3, 0x1B, 0xFF, 0x93, 0x7B, 0xDC, 0xCE, 0x1F,
+    0x24, 0xBC, 0xFB, 0xA3, 0xFA, 0x3F, 0x1D, 0x0F, 0xBF, 0x3C, 0x1E, 0xBE, 0x37, 0x1E, 0x8E, 0xCC,
+    0xCF, 0x16, 0xDB, 0x83, 0xBF, 0x77, 0xE6, 0xA2, 0x27, 0x5D, 0xE1, 0x47, 0x0E, 0x71, 0x66, 0xF4,
+    0xA7, 0x83, 0x0B, 0x87, 0x6E, 0x10, 0x0A, 0x2C, 0xC1, 0x18, 0x4E, 0xAB, 0xCB, 0x6D, 0x32, 0xD6,
+    0xBB, 0xFB, 0x12, 0xC0, 0x67, 0x6D, 0x47, 0x3E, 0x44, 0x0F, 0xCA, 0xC5, 0xC5, 0xFE, 0x10, 0x4A,
+    0x93, 0xD9, 0xDE, 0x0C, 0xBB, 0x74, 0xDE, 0x8F, 0x64, 0xB9, 0xE6, 0x4A, 0x92, 0x6E, 0xCC, 0xA3,
+    0xFA, 0xF1, 0xB5, 0xBA, 0xDA, 0x58, 0xBA, 0x2F, 0x29, 0x9D, 0xBB, 0x74, 0xD6, 0x0F, 0xB1, 0x0D,
+    0x51, 0x3B, 0x04, 0x9B, 0x26, 0xBA, 0xFC, 0x81, 0xAE, 0x9F, 0x51, 0x02, 0x59, 0x6A, 0x63, 0x0E,
+    0xDB, 0x3E, 0x98, 0x6D, 0x47, 0x45, 0x68, 0x64, 0xCE, 0xFE, 0xD8, 0x6A, 0x7F, 0x5C, 0x6A, 0x5C,
+    0x10, 0xD1, 0xBF, 0xD2, 0xA0, 0x94, 0x3D, 0xFB, 0x14, 0x55, 0x08, 0xE2, 0xBF, 0xBD, 0xB6, 0xD1,
+    0x55, 0x9E, 0xAC, 0xB3, 0x3F, 0x3C, 0xD6, 0xFE, 0x3D, 0xE3, 0xFC, 0xA0, 0x9A, 0xCE, 0x48, 0x85,
+    0xDC, 0xFA, 0x8C, 0x32, 0x65, 0x3B, 0x50, 0x62, 0xEE, 0x10, 0x85, 0xBF, 0x26, 0x8A, 0x7E, 0x42,
+    0x94, 0x7C, 0x87, 0xA8, 0xA7, 0x56, 0xED, 0xB5, 0xBE, 0x96, 0x4B, 0xF0, 0x35, 0xE9, 0x8A, 0x28,
+    0x5A, 0x13, 0x25, 0x39, 0x51, 0x41, 0xFD, 0xDB, 0x83, 0x9B, 0xC6, 0xEC, 0xC9, 0xAA, 0x0A, 0x84,
+    0x15, 0x5F, 0x50, 0xC4, 0x52, 0xA2, 0x7B, 0x5A, 0x36, 0x72, 0xAF, 0x50, 0x4D, 0x5D, 0xCB, 0x88,
+    0x65, 0xB5, 0x22, 0x18, 0xD8, 0xFA, 0x0D, 0xAC, 0xC7, 0xB2, 0x5E, 0x67, 0xAC, 0x41, 0x69, 0x95,
+    0xE8, 0x72, 0x2A, 0xB1, 0x59, 0x39, 0xD5, 0x4A, 0xA9, 0x85, 0x19, 0x33, 0x55, 0x27, 0xD2, 0xB3,
+    0x0C, 0xE1, 0x4B, 0x64, 0xC8, 0x5A, 0x56, 0x14, 0x2F, 0xD8, 0xD2, 0xBE, 0xAB, 0x39, 0xD7, 0xB1,
+    0x66, 0x6D, 0x1E, 0xA9, 0xBE, 0xC8, 0x14, 0xBA, 0xCA, 0x7A, 0xA0, 0x5A, 0x12, 0xA8, 0x25, 0x7D,
+    0xE4, 0x85, 0x3E, 0x06, 0x0C, 0x7E, 0xC2, 0x4C, 0xCC, 0x1F, 0xD1, 0x31, 0x03, 0x03, 0xBC, 0x59,
+    0x01, 0x7A, 0x0D, 0x8D, 0xF1, 0x34, 0xC9, 0x07, 0x1B, 0xC0, 0xB0, 0x04, 0x14, 0xE1, 0xA6, 0x32,
+    0x0D, 0x6D, 0xC0, 0x6D, 0x03, 0x88, 0xE0, 0xA8, 0xCA, 0x30, 0x34, 0x0A, 0xA1, 0x29, 0x80, 0xB9,
+    0x7B, 0x4B, 0x7D, 0xBB, 0x38, 0x3D, 0x12, 0x13, 0xA8, 0x93, 0xCA, 0x6A, 0x86, 0x8D, 0x55, 0xE6,
+    0xA6, 0xF0, 0x85, 0x76, 0xA1, 0x9A, 0x5C, 0xE9, 0xE0, 0x17, 0x91, 0xA4, 0x71, 0xC2, 0x99, 0x16,
+    0xB6, 0x90, 0x6E, 0x3C, 0x9B, 0x92, 0x00, 0xE1, 0xD1, 0xEB, 0x96, 0x37, 0x3B, 0x96, 0x9A, 0xE8,
+    0x53, 0x9C, 0x93, 0xE4, 0x2A, 0x9B, 0xAB, 0x30, 0x37, 0x42, 0xFD, 0x26, 0x21, 0x2C, 0x70, 0xCE,
+    0x5C, 0x0B, 0x02, 0x36, 0x84, 0x50, 0x3B, 0x30, 0xFA, 0x34, 0x63, 0x42, 0x63, 0xCB, 0x76, 0x60,
+    0x6D, 0x5D, 0xFC, 0x03, 0x7C, 0xF5, 0x70, 0x71, 0xF2, 0x99, 0xE7, 0x81, 0x3D, 0xCA, 0xF8, 0x69,
+    0x91, 0x52, 0x9F, 0x6D, 0xD0, 0x4A, 0xD1, 0xEA, 0x30, 0xA2, 0x5C, 0x98, 0x12, 0x8E, 0xDF, 0x48,
+    0xF7, 0xFB, 0xDD, 0xB2, 0x70, 0xAA, 0x9B, 0x6F, 0x4B, 0xB8, 0x7E, 0x98, 0x0E, 0xF5, 0x6B, 0x60,
+    0x62, 0xBA, 0xC8, 0xCA, 0x84, 0xC9, 0x90, 0xB3, 0x3D, 0xA6, 0x6B, 0x0F, 0xD5, 0x05, 0xFF, 0x1D,
+    0x5D, 0x9B, 0xA8, 0x6E, 0x93, 0x14, 0x65, 0xB6, 0xB8, 0xD6, 0xDB, 0xA4, 0x6F, 0x75, 0xE9, 0xFF,
+    0x59, 0xA3, 0xA2, 0x60, 0x06, 0xCE, 0x97, 0x81, 0x6D, 0x9D, 0xAB, 0x7E, 0xCD, 0x90, 0x55, 0x94,
+    0x4D, 0xB2, 0x8A, 0xB2, 0xBC, 0xCF, 0x5D, 0x56, 0x51, 0x3F, 0xCD, 0x2A, 0x9A, 0xEF, 0x66, 0x15,
+    0xCD, 0x5D, 0x56, 0xD1, 0x67, 0x90, 0x55, 0xF4, 0xB2, 0x9C, 0x9C, 0xC7, 0x37, 0x4B, 0xC4, 0x59,
+    0xEE, 0x66, 0x15, 0xC1, 0x98, 0x71, 0x25, 0xD1, 0xDC, 0x51, 0x01, 0xCF, 0x9E, 0x99, 0x55, 0xA4,
+    0x29, 0x40, 0xC9, 0x89, 0xC0, 0xD5, 0x55, 0x74, 0xE0, 0xFE, 0x93, 0xE6, 0x1F, 0x09, 0xD0, 0x65,
+    0xE6, 0xF8, 0xC7, 0xC5, 0xC4, 0x76, 0x8B, 0x85, 0x79, 0x14, 0x31, 0xB1, 0x1C, 0xE9, 0x13, 0xD0,
+    0xB8, 0x19, 0x75, 0x0E, 0xF0, 0x8F, 0xBB, 0xE5, 0xF7, 0x30, 0x39, 0x6B, 0x05, 0xB3, 0xFB, 0xB9,
+    0xF6, 0x08, 0xB0, 0x83, 0xBF, 0xE5, 0xA7, 0x5B, 0x7E, 0x1F, 0xC3, 0xFB, 0xE8, 0xE7, 0x45, 0x99,
+    0x58, 0x85, 0xFA, 0x1C, 0x4A, 0x1C, 0x9F, 0x74, 0xCE, 0xF4, 0x93, 0x8D, 0x65, 0xC6, 0x1D, 0x7C,
+    0xB0, 0xCA, 0x41, 0xAF, 0x7F, 0xDF, 0xD8, 0x6A, 0x50, 0x2E, 0xBC, 0xE6, 0xF2, 0xD5, 0x5E, 0x4B,
+    0xC4, 0xE9, 0xEA, 0x32, 0x29, 0xD8, 0xE6, 0xB5, 0xB6, 0x6C, 0x5B, 0x66, 0x73, 0xF2, 0x1D, 0xCC,
+    0x26, 0xB0, 0x18, 0xAB, 0x2E, 0xAB, 0x3B, 0x50, 0x19, 0xBD, 0xD7, 0x8E, 0x85, 0x09, 0x20, 0x20,
+    0x3F, 0x07, 0xB6, 0x6D, 0x92, 0x1B, 0x96, 0x07, 0x92, 0xC1, 0x6F, 0x5D, 0xBC, 0xC9, 0x79, 0x02,
+    0xA4, 0xBB, 0xE5, 0x65, 0x24, 0x73, 0x33, 0x3A, 0xA3, 0xFB, 0x4A, 0x21, 0xB3, 0x2B, 0xA8, 0x11,
+    0xD1, 0x68, 0x53, 0x65, 0x90, 0xFE, 0x50, 0x4C, 0x3F, 0xB6, 0x51, 0x36, 0x9D, 0x01, 0xCD, 0xF1,
+    0x1B, 0x2F, 0x0D, 0xB6, 0xB3, 0xAE, 0x67, 0x7E, 0xAF, 0xB3, 0xC2, 0xC1, 0x0C, 0xC9, 0x68, 0xA9,
+    0xB8, 0xB4, 0xB5, 0xE8, 0x42, 0x2D, 0xD9, 0xCD, 0x94, 0xE5, 0x80, 0xA6, 0x42, 0xB9, 0x83, 0x1C,
+    0x50, 0x11, 0x49, 0x83, 0x0D, 0x5F, 0x4D, 0xFD, 0x5D, 0x54, 0x98, 0x82, 0x4D, 0xA8, 0x9E, 0x54,
+    0x78, 0xE1, 0x39, 0x33, 0x03, 0x6B, 0xA0, 0xC9, 0xFE, 0xF0, 0xE7, 0xFA, 0x90, 0xF8, 0xC7, 0xBF,
+    0x50, 0x19, 0x2E, 0xBC, 0xFB, 0xCB, 0xCA, 0xF9, 0xFE, 0x55, 0x49, 0x08, 0x3F, 0xFA, 0xC8, 0x5A,
+    0x9C, 0x7F, 0xFC, 0x0B, 0x6B, 0x9A, 0x0F, 0x36, 0x2A, 0x8D, 0xCA, 0x7D, 0xD4, 0x9E, 0xBF, 0x0D,
+    0x36, 0xB6, 0xD2, 0x7A, 0xB0, 0x51, 0xEB, 0x3F, 0x9E, 0xDE, 0xF0, 0x15, 0x83, 0x8D, 0x7D, 0xBF,
+    0x60, 0x63, 0x15, 0x65, 0xB4, 0x79, 0xED, 0xDE, 0xA2, 0x87, 0x61, 0x02, 0xEF, 0x25, 0x63, 0x0D,
+    0x75, 0x04, 0x6D, 0x35, 0x48, 0x33, 0xAD, 0xC3, 0xF6, 0x60, 0x07, 0xE3, 0x0F, 0x95, 0x63, 0xC4,
+    0x95, 0x6D, 0x50, 0xC8, 0x90, 0x74, 0x5B, 0xD1, 0xCF, 0xD1, 0xC2, 0x5F, 0x8F, 0xB8, 0x1A, 0x46,
+    0xB3, 0xE2, 0xC4, 0x95, 0xFA, 0x96, 0xAB, 0x15, 0x0D, 0xA4, 0x7E, 0xBD, 0x52, 0x8A, 0x75, 0x2B,
+    0x5B, 0xB2, 0xCB, 0x5A, 0xE2, 0x8A, 0x55, 0xA7, 0xC2, 0xC2, 0xCA, 0x3A, 0x34, 0x56, 0x14, 0xE6,
+    0xA2, 0xF5, 0x8A, 0xBE, 0xEE, 0x24, 0x5D, 0x71, 0xA6, 0x75, 0x72, 0xDF, 0xC2, 0xE8, 0xF3, 0x98,
+    0x9F, 0x06, 0x25, 0xFD, 0x4E, 0xCE, 0xF6, 0x88, 0x80, 0x52, 0xB0, 0xFB, 0x5D, 0xF5, 0x87, 0xF0,
+    0x7E, 0x71, 0xF9, 0x44, 0x95, 0xD3, 0x7C, 0x61, 0x8C, 0xCC, 0x7D, 0x79, 0x48, 0x32, 0x89, 0x1D,
+    0xB3, 0x0F, 0x41, 0xAF, 0x70, 0x90, 0xAD, 0x3E, 0x89, 0x1C, 0x77, 0x48, 0x3F, 0x30, 0x70, 0x52,
+    0x18, 0xAE, 0xF5, 0x03, 0x71, 0x19, 0x42, 0xA1, 0xD6, 0xB3, 0x32, 0x6A, 0x4E, 0xCC, 0x6C, 0x75,
+    0x0E, 0x68, 0xEB, 0x99, 0x2B, 0x08, 0xD0, 0x8F, 0xC5, 0x22, 0xB5, 0x7C, 0xA4, 0x86, 0x47, 0x31,
+    0xEA, 0x8A, 0xC6, 0xE2, 0x8C, 0x2F, 0x9F, 0xD1, 0xE4, 0x9C, 0xD1, 0xBC, 0x90, 0x69, 0xA8, 0x02,
+    0x65, 0xF9, 0x8C, 0x34, 0xCB, 0x18, 0x91, 0x96, 0x79, 0xD3, 0x92, 0x94, 0x31, 0xC3, 0x4E, 0x02,
+    0x15, 0x21, 0xDA, 0x49, 0x31, 0x4A, 0x5B, 0x86, 0x92, 0xA5, 0x39, 0x7D, 0x42, 0xAF, 0x7F, 0x20,
+    0xC7, 0xB3, 0x0B, 0xC4, 0x9E, 0x6B, 0x08, 0xDA, 0x34, 0x06, 0x1B, 0xA4, 0xD4, 0xF8, 0x10, 0x16,
+    0xBE, 0x00, 0x87, 0xE0, 0x08, 0xEE, 0xD0, 0x42, 0xAD, 0xF6, 0xC1, 0xEA, 0x21, 0x48, 0xF6, 0xA5,
+    0x70, 0xDB, 0x62, 0x3E, 0x20, 0xD9, 0x9B, 0x49, 0x53, 0x6B, 0x90, 0x7F, 0xDD, 0xDA, 0x31, 0x1A,
+    0x9E, 0x01, 0x4E, 0xA5, 0xEE, 0xC5, 0x14, 0x6F, 0x1C, 0x7C, 0x07, 0xD4, 0x0D, 0xFE, 0x03, 0xA8,
+    0x1B, 0x40, 0xEF, 0xCB, 0xB8, 0x51, 0x43, 0x46, 0x1B, 0x5A, 0x16, 0x4E, 0xA9, 0x4B, 0x8A, 0x52,
+    0x1B, 0xD9, 0xA1, 0x2E, 0x0B, 0xE3, 0x65, 0x54, 0x85, 0x33, 0xE4, 0x78, 0x08, 0xBC, 0x09, 0xEA,
+    0x06, 0x6F, 0x83, 0xBA, 0xC1, 0x57, 0x4F, 0xA0, 0x6E, 0x35, 0x59, 0x2D, 0xBA, 0x29, 0xB5, 0x9E,
+    0x05, 0xB5, 0x22, 0x50, 0x2B, 0x02, 0xB5, 0x10, 0xF5, 0xD1, 0xA2, 0x18, 0x4E, 0x1B, 0xED, 0x52,
+    0xAB, 0xDF, 0xA5, 0x16, 0xAB, 0xA4, 0xE8, 0x79, 0x60, 0xEC, 0x11, 0xA8, 0x15, 0x81, 0x5A, 0x11,
+    0x62, 0xAC, 0x2E, 0xD0, 0x73, 0x26, 0x2D, 0xA0, 0xF5, 0x7A, 0xA3, 0x86, 0x6A, 0x95, 0x87, 0xDF,
+    0xE8, 0xDE, 0x85, 0xD3, 0xA0, 0xAF, 0x3D, 0xA4, 0xC4, 0xD4, 0xD2, 0x31, 0x2F, 0xB4, 0x97, 0x03,
+    0xA4, 0xF5, 0xC3, 0xF2, 0xEB, 0xD1, 0x99, 0xE6, 0x35, 0xBA, 0x83, 0x08, 0x18, 0xB8, 0xD7, 0xBE,
+    0x4A, 0x83, 0x0E, 0x0C, 0x1B, 0x16, 0xB6, 0xAF, 0xD2, 0xE9, 0x8A, 0xF7, 0x90, 0x33, 0x7B, 0x42,
+    0x26, 0xB7, 0xDB, 0x3B, 0x84, 0xBC, 0x9B, 0x4F, 0x09, 0xDF, 0xD3, 0x02, 0x1D, 0xDA, 0x12, 0x95,
+    0xB7, 0x35, 0x26, 0x2A, 0xAC, 0x34, 0x6B, 0x8E, 0x32, 0xF6, 0x64, 0x7A, 0xDB, 0x02, 0x97, 0x6B,
+    0x05, 0x2F, 0x22, 0xE3, 0x69, 0x67, 0xF2, 0x33, 0xFE, 0x29, 0x5A, 0x33, 0x46, 0x8D, 0xB1, 0x8E,
+    0x3E, 0xC2, 0x86, 0x18, 0x11, 0xE9, 0x33, 0x15, 0x9F, 0x6E, 0xFF, 0xBF, 0x6B, 0x6C, 0xDE, 0x91,
+    0x7F, 0xB7, 0x61, 0x8C, 0x80, 0x8D, 0x82, 0xF7, 0xB7, 0x11, 0xCE, 0x43, 0x7D, 0xB8, 0xAD, 0xC7,
+    0x94, 0x81, 0x22, 0x65, 0x54, 0x24, 0x2D, 0x8B, 0xC8, 0x02, 0x69, 0x90, 0x4A, 0x05, 0xFF, 0x63,
+    0xCF, 0x0D, 0x02, 0x80, 0x40, 0x06, 0x16, 0x68, 0x21, 0xA2, 0x69, 0xAD, 0xA2, 0xA1, 0x4E, 0x10,
+    0x73, 0x82, 0x2B, 0x2E, 0x31, 0x41, 0xA5, 0x19, 0x5E, 0x55, 0xA2, 0x9A, 0x34, 0xEB, 0xFA, 0x04,
+    0xFF, 0x57, 0x5D, 0xE1, 0x77, 0xB7, 0x6A, 0xB7, 0xD6, 0x02, 0x57, 0x1F, 0xEB, 0x72, 0xFF, 0xAB,
+    0x5E, 0x9D, 0x13, 0x9C, 0xC5, 0x41, 0x45, 0xAF, 0x72, 0x50, 0x71, 0x7E, 0xCB, 0x3D, 0x5B, 0x33,
+    0x79, 0x02, 0xD9, 0x40, 0xA0, 0x75, 0x3E, 0x03, 0x1B, 0xC8, 0x51, 0x71, 0x28, 0xD1, 0x33, 0x9E,
+    0x13, 0xB9, 0x80, 0x80, 0x0C, 0xA5, 0x63, 0x2B, 0xC0, 0xA8, 0xFC, 0xE2, 0x0D, 0x15, 0x54, 0xB6,
+    0x5C, 0xD9, 0xB7, 0x2A, 0x27, 0x85, 0x1B, 0x4B, 0x0F, 0x8D, 0xA1, 0x50, 0x7A, 0xA9, 0xF1, 0x4A,
+    0xD4, 0x43, 0x9A, 0xE7, 0xF4, 0x7B, 0xBA, 0xBB, 0x84, 0x68, 0x6B, 0xA3, 0x54, 0xB3, 0xD1, 0x5E,
+    0xA0, 0x9B, 0xBA, 0x0D, 0x4B, 0x46, 0x93, 0x56, 0x9A, 0x48, 0x63, 0x8B, 0x96, 0x3E, 0x22, 0xC4,
+    0xDA, 0xAA, 0x1A, 0x0E, 0x37, 0x22, 0x96, 0x57, 0x7D, 0x24, 0x4F, 0xD0, 0x7D, 0x28, 0x46, 0x74,
+    0xFE, 0xAA, 0x7A, 0x53, 0x34, 0x51, 0xB7, 0x11, 0xE9, 0x73, 0x6E, 0xA8, 0xD1, 0x74, 0x63, 0x9C,
+    0x27, 0x85, 0x93, 0x73, 0x5D, 0xDB, 0xE7, 0x53, 0x38, 0xDA, 0xA6, 0xCE, 0x82, 0xFA, 0x9A, 0xF4,
+    0xCC, 0x8B, 0xF6, 0x34, 0x45, 0x6B, 0x35, 0xA8, 0x94, 0xF7, 0x83, 0xCE, 0xE8, 0x9C, 0xE8, 0x11,
+    0xA3, 0x09, 0x95, 0xFB, 0x7E, 0x8A, 0xEE, 0x2C, 0xA7, 0xB5, 0xDA, 0x4F, 0x43, 0x4A, 0x6D, 0x4B,
+    0x68, 0x87, 0xBA, 0xB3, 0xAF, 0xBB, 0x17, 0xCA, 0x5C, 0xE6, 0xBD, 0xAD, 0x8E, 0x39, 0x3D, 0x40,
+    0x50, 0xE7, 0x50, 0x3F, 0xEC, 0x51, 0x1D, 0x2C, 0xDF, 0x75, 0x05, 0xC9, 0xFA, 0xB5, 0x3B, 0xD0,
+    0x7A, 0xD1, 0xC5, 0xE2, 0x6A, 0xEF, 0x4E, 0x2E, 0xDC, 0x86, 0x2B, 0xB1, 0xDB, 0x8B, 0x45, 0x9D,
+    0xDC, 0x14, 0xFF, 0xDC, 0x41, 0x63, 0x0F, 0x66, 0xEE, 0xC0, 0x3B, 0xD7, 0xC1, 0x51, 0xC7, 0xAE,
+    0xDF, 0x1C, 0xF5, 0xEC, 0x0F, 0xDE, 0x19, 0x1B, 0xFC, 0x90, 0xDA, 0xF8, 0x72, 0xD3, 0xDD, 0xEC,
+    0x5D, 0x79, 0xA9, 0xD6, 0xD5, 0xB7, 0xB5, 0xDC, 0xCA, 0xBB, 0xB2, 0x93, 0xFD, 0xC9, 0xF3, 0x06,
+    0xBC, 0x64, 0xBC, 0xB9, 0x2B, 0xB6, 0x7F, 0x2E, 0xBC, 0xDC, 0x57, 0xDC, 0x77, 0x16, 0xF7, 0xF4,
+    0xBB, 0x25, 0xFF, 0xF1, 0x9A, 0xDA, 0xC3, 0xD2, 0x79, 0xA3, 0xD8, 0xB3, 0x49, 0xD3, 0x9A, 0xE8,
+    0x45, 0x4F, 0xD6, 0x2E, 0x4E, 0x1C, 0x4E, 0x1D, 0x36, 0x93, 0x3C, 0xD7, 0xB1, 0x5E, 0x6F, 0x66,
+    0xA6, 0x96, 0x3B, 0x67, 0x71, 0xB8, 0x6C, 0xC9, 0x93, 0x15, 0xDB, 0x49, 0xB6, 0xBE, 0x2B, 0x41,
+    0xB4, 0xFB, 0xE3, 0xE9, 0x50, 0x8A, 0x75, 0xFC, 0x28, 0x8D, 0xAC, 0x95, 0x3C, 0x68, 0x5C, 0xF4,
+    0x8D, 0xF7, 0xDF, 0x52, 0x2A, 0x2C, 0x3D, 0x57, 0x83, 0x04, 0x92, 0xB6, 0xD0, 0xF7, 0xDB, 0x9D,
+    0x86, 0x1E, 0x23, 0x12, 0x00, 0x0B, 0x71, 0x4A, 0xAF, 0x23, 0x22, 0xF8, 0x58, 0xD4, 0x5B, 0x51,
+    0x79, 0x12, 0xCA, 0x33, 0x3D, 0x33, 0x49, 0x79, 0x1D, 0x5D, 0x76, 0x8C, 0xD9, 0xEB, 0x35, 0x66,
+    0x2F, 0xFB, 0xFD, 0x06, 0x0B, 0x4D, 0xF2, 0x63, 0xC6, 0xEC, 0x45, 0x5C, 0x10, 0xA5, 0x1F, 0x35,
+    0x66, 0xAF, 0xFF, 0x60, 0x9F, 0x51, 0xE0, 0xE8, 0xC5, 0x0B, 0x97, 0x03, 0xDB, 0x99, 0x7F, 0x9C,
+    0xDA, 0xEE, 0xA4, 0x4D, 0x5B, 0x4B, 0xDD, 0x06, 0x87, 0x57, 0x8C, 0x8B, 0x1C, 0x42, 0x3E, 0x23,
+    0xC4, 0x5C, 0x78, 0x0D, 0x0A, 0x13, 0xC9, 0xE2, 0xBC, 0x62, 0x90, 0x42, 0xC7, 0xB2, 0x9A, 0x8C,
+    0x5E, 0xB6, 0x90, 0xD5, 0xAA, 0x18, 0xC6, 0x9C, 0xB1, 0x06, 0xF5, 0x8A, 0xFE, 0x46, 0x64, 0xEA,
+    0x45, 0x3F, 0x81, 0x06, 0x85, 0xA5, 0x74, 0xDE, 0x41, 0x25, 0x87, 0x0D, 0xE3, 0x56, 0xCE, 0xD2,
+    0xC4, 0xC2, 0xEA, 0xAE, 0x5C, 0x1C, 0x5D, 0x3A, 0x13, 0x2F, 0xA1, 0x46, 0x89, 0x24, 0x93, 0x42,
+    0xCA, 0x53, 0x2F, 0xE1, 0xE6, 0x71, 0x79, 0x09, 0x2F, 0x80, 0x84, 0x37, 0x18, 0x7C, 0x68, 0xB7,
+    0xAF, 0xA0, 0x6A, 0xFC, 0xB7, 0xA3, 0xC5, 0xDC, 0x3A, 0x2E, 0xEA, 0xB1, 0x4C, 0xA6, 0xCE, 0x3B,
+    0x8D, 0x16, 0x4A, 0x36, 0x13, 0xDF, 0x2E, 0x17, 0x7A, 0xB9, 0x05, 0xC2, 0x84, 0xAA, 0xFB, 0xF2,
+    0x12, 0xA6, 0xD6, 0x4B, 0x58, 0x99, 0xE7, 0x82, 0xEE, 0x3F, 0xF1, 0x1E, 0x8C, 0x9B, 0xA6, 0x90,
+    0x85, 0x47, 0xBF, 0x65, 0xB5, 0xA7, 0x44, 0xA9, 0x80, 0xCC, 0x96, 0xB0, 0xB6, 0xD3, 0xF6, 0x68,
+    0xC1, 0xE7, 0x4B, 0x0B, 0xE1, 0x77, 0xE6, 0x53, 0x2C, 0xF2, 0xDC, 0x1E, 0x85, 0xE6, 0xFC, 0x70,
+    0x0C, 0xBE, 0x72, 0x85, 0x81, 0xBE, 0xA8, 0x85, 0x81, 0x6A, 0xC7, 0xD6, 0x1E, 0x0A, 0x20, 0xA7,
+    0x8B, 0x45, 0x9E, 0xFD, 0x73, 0x68, 0x2E, 0x01, 0x23, 0xEA, 0xB1, 0x81, 0x0F, 0xF3, 0xCF, 0x75,
+    0x23, 0x3F, 0x0D, 0x40, 0x08, 0x58, 0xCA, 0x54, 0xB3, 0x94, 0x87, 0xB2, 0xC6, 0x98, 0x52, 0x1A,
+    0xB7, 0x9B, 0xE4, 0xBA, 0x4E, 0x52, 0xB9, 0xFD, 0x39, 0xC6, 0xCB, 0xFC, 0xD7, 0xF5, 0x20, 0xD1,
+    0x79, 0xCA, 0x78, 0xD4, 0x9E, 0x71, 0x9E, 0xED, 0x77, 0xEE, 0x0D, 0x75, 0x20, 0xB9, 0xCC, 0xD2,
+    0x74, 0xC8, 0x2C, 0xB5, 0x85, 0x22, 0x62, 0x66, 0x96, 0xA6, 0xCC, 0x52, 0x60, 0x78, 0x99, 0x37,
+    0xC9, 0x2C, 0x65, 0xB9, 0x6D, 0xEE, 0x96, 0xF5, 0xA7, 0x88, 0xCE, 0x43, 0xC0, 0x22, 0x62, 0xCB,
+    0x54, 0x92, 0x61, 0x48, 0x94, 0x86, 0x95, 0xB6, 0xC3, 0xE8, 0x3F, 0x1F, 0x78, 0x4C, 0x74, 0x5B,
+    0x64, 0xD7, 0x2F, 0x93, 0xEB, 0x55, 0x16, 0x7A, 0x4B, 0xCD, 0xED, 0x7B, 0x04, 0x74, 0x8B, 0x06,
+    0xBA, 0x25, 0x53, 0xBA, 0xB5, 0x63, 0x46, 0xAE, 0xD2, 0xAD, 0x3A, 0x83, 0x6E, 0x88, 0x87, 0x50,
+    0x30, 0x5B, 0x76, 0xCB, 0x33, 0xE8, 0x76, 0x5A, 0xA5, 0xEE, 0xD9, 0xBD, 0x2B, 0x75, 0xCF, 0x4F,
+    0xA8, 0xD4, 0x5D, 0x8E, 0x90, 0xDF, 0xE8, 0x5F, 0xFD, 0x5F, 0x31, 0x83, 0x8C, 0x86, 0xBA, 0x69,
+    0xA5, 0xEE, 0xD5, 0xC9, 0x95, 0xBA, 0xD9, 0x35, 0x0D, 0xBB, 0xA6, 0x29, 0x5C, 0xB8, 0x81, 0x2B,
+    0x17, 0x7C, 0x1E, 0x38, 0x5A, 0xDA, 0xE6, 0x5B, 0x5B, 0xB8, 0x80, 0x2B, 0x1E, 0x2D, 0x02, 0x64,
+    0x8D, 0x8C, 0x2E, 0xFB, 0x36, 0x63, 0x19, 0x7E, 0x4A, 0x7D, 0x8D, 0xBD, 0xEC, 0x5B, 0x9F, 0xA3,
+    0x32, 0xEA, 0xD4, 0xB8, 0x84, 0xEA, 0x90, 0x46, 0xC7, 0xF8, 0x47, 0x8C, 0xB8, 0xF5, 0x94, 0x99,
+    0x16, 0x1A, 0x83, 0x4A, 0x9D, 0x2B, 0xEA, 0x19, 0x63, 0xDA, 0x73, 0x13, 0xB9, 0xFE, 0x9E, 0x75,
+    0x31, 0x76, 0x61, 0x41, 0xF1, 0x51, 0x31, 0x84, 0x37, 0x87, 0x2F, 0x2D, 0x60, 0xE5, 0xB7, 0x5B,
+    0x0A, 0x3D, 0xD1, 0xD8, 0x55, 0x58, 0x3A, 0x8A, 0xF9, 0x73, 0xF0, 0x80, 0x78, 0xCA, 0x8F, 0xD3,
+    0xD6, 0xA1, 0x2F, 0xDE, 0x54, 0x39, 0x7F, 0x7E, 0xD2, 0x46, 0x4D, 0x8F, 0x16, 0xE1, 0x25, 0xDE,
+    0x55, 0xB4, 0x75, 0xE8, 0xFE, 0xAA, 0x8B, 0xCD, 0x58, 0xF5, 0xE8, 0xC0, 0xAE, 0xBA, 0x0F, 0x03,
+    0x75, 0xCD, 0x16, 0x01, 0xF8, 0xA2, 0x8C, 0x94, 0x0F, 0x5E, 0x91, 0xF1, 0x12, 0x71, 0xD4, 0xCC,
+    0x35, 0xCD, 0xE1, 0x73, 0xDF, 0xB7, 0x12, 0xE7, 0x79, 0xA0, 0xD6, 0xE7, 0x9E, 0x42, 0xEF, 0xDC,
+    0x70, 0x88, 0xA5, 0x33, 0x36, 0x34, 0xFD, 0xBC, 0x30, 0xB5, 0x96, 0x8B, 0x4C, 0x26, 0xCA, 0x21,
+    0xA2, 0x18, 0x45, 0x0C, 0xFB, 0x08, 0x39, 0x3D, 0xCC, 0x17, 0xB8, 0xA0, 0x11, 0xFA, 0xE6, 0x04,
+    0xC8, 0xD9, 0x18, 0x68, 0x48, 0x82, 0xF2, 0xDF, 0xF8, 0x1C, 0x90, 0x9E, 0x40, 0x73, 0x40, 0xE2,
+    0x9D, 0x05, 0xBE, 0x01, 0xF0, 0xE6, 0x14, 0xF4, 0x00, 0x45, 0xFA, 0xE6, 0xAC, 0x4B, 0x6E, 0xAF,
+    0x8A, 0x8E, 0xA4, 0xF6, 0xFB, 0xFE, 0xB0, 0x33, 0x9F, 0xA3, 0x11, 0xF3, 0xCD, 0xD3, 0xC0, 0xC9,
+    0x55, 0xEF, 0x41, 0x83, 0x70, 0x73, 0x22, 0xF0, 0xDE, 0x01, 0xA8, 0x1C, 0xF8, 0x0A, 0xC0, 0xB7,
+    0xAA, 0x62, 0x13, 0xFF, 0xDD, 0x5D, 0x16, 0x94, 0xF9, 0xD9, 0x66, 0xD6, 0x77, 0xC2, 0xB9, 0x5E,
+    0x40, 0x74, 0xB7, 0xB7, 0x0B, 0xCC, 0x3B, 0x53, 0x63, 0xFA, 0x83, 0xCA, 0x4D, 0x17, 0xB0, 0x75,
+    0xC7, 0x4B, 0xBD, 0xE6, 0x8E, 0xD3, 0x63, 0xFC, 0xE1, 0x4D, 0x61, 0x90, 0xEF, 0xC3, 0xA2, 0x74,
+    0xD4, 0x7D, 0x95, 0x3C, 0x14, 0xFC, 0x97, 0xF7, 0x74, 0xCB, 0x4E, 0xC1, 0x02, 0x76, 0x4C, 0x69,
+    0x4B, 0x8B, 0x2A, 0x3B, 0x1D, 0x62, 0xCC, 0x77, 0xDC, 0xC6, 0x11, 0x7D, 0xC7, 0x58, 0xAA, 0x2D,
+    0x68, 0x1F, 0x0C, 0x4C, 0x57, 0x09, 0x0D, 0xB0, 0x9D, 0x59, 0xB5, 0xDD, 0x85, 0x97, 0x26, 0xEF,
+    0x9B, 0x6B, 0x18, 0x86, 0x28, 0x00, 0x5F, 0xEB, 0xA2, 0xEA, 0xDC, 0x01, 0xDC, 0x9A, 0x89, 0xA5,
+    0xEA, 0xCD, 0x7B, 0x1C, 0xAA, 0x99, 0x61, 0x3E, 0x27, 0x62, 0x38, 0x29, 0xC3, 0x25, 0x69, 0x47,
+    0x4D, 0x27, 0xC9, 0x35, 0x4B, 0x0A, 0xB5, 0x6D, 0x14, 0x5F, 0xB4, 0x78, 0x30, 0x67, 0x0C, 0xFE,
+    0x13, 0x2B, 0xD3, 0xDB, 0x84, 0x8A, 0x41, 0x87, 0x76, 0x4A, 0xF5, 0x10, 0x22, 0xEE, 0xA2, 0xA6,
+    0xA4, 0x9B, 0xCC, 0x9F, 0xD0, 0x7E, 0x83, 0x10, 0x00, 0x63, 0x83, 0x06, 0xB4, 0x9A, 0xD7, 0xFE,
+    0x34, 0x41, 0xFE, 0x92, 0xAE, 0x63, 0xB6, 0x6E, 0x23, 0x12, 0x12, 0xAF, 0x17, 0xA5, 0xEE, 0xDE,
+    0xF3, 0x25, 0xCA, 0x44, 0x2F, 0xD3, 0x09, 0xF5, 0x32, 0x42, 0x5A, 0x1B, 0x84, 0xA7, 0x7A, 0x4D,
+    0xCC, 0xF4, 0xD6, 0x50, 0x93, 0x5C, 0xAF, 0xDD, 0x5A, 0x2E, 0xBF, 0xB7, 0x5B, 0x53, 0x61, 0x33,
+    0x86, 0xEF, 0x6B, 0xFB, 0x50, 0x08, 0xE6, 0x77, 0x84, 0x1E, 0x1F, 0xBE, 0x51, 0xB9, 0x6C, 0x12,
+    0xBB, 0xEF, 0xCF, 0x6E, 0x29, 0x75, 0x4B, 0x6B, 0xDF, 0xD2, 0x3A, 0x1A, 0x69, 0x1D, 0x4F, 0x68,
+    0x3D, 0x7B, 0xFA, 0x68, 0xDD, 0x1E, 0xC9, 0x0C, 0x39, 0x2F, 0x76, 0x51, 0x09, 0x67, 0xF6, 0xD1,
+    0xFC, 0x81, 0xFA, 0x28, 0x38, 0xDE, 0x47, 0xFD, 0xA4, 0x8F, 0xB4, 0x14, 0xBF, 0xD5, 0x58, 0xCF,
+    0x30, 0x1D, 0x22, 0xAA, 0xA4, 0x2A, 0xFA, 0xEA, 0xA5, 0x7E, 0x5F, 0x37, 0x71, 0x79, 0xE0, 0xFF,
+    0x17, 0xBB, 0x54, 0x6F, 0x05, 0xEF, 0x98, 0x2D, 0xE0, 0x3B, 0xAB, 0x5D, 0xFA, 0x4C, 0x77, 0xB5,
+    0x32, 0x3B, 0x96, 0x12, 0x1B, 0x8B, 0x77, 0xFC, 0xE7, 0xEF, 0xE5, 0x96, 0x85, 0x6F, 0x69, 0xF8,
+    0xA1, 0xDB, 0x98, 0xCB, 0xA6, 0x78, 0x80, 0x6D, 0xD5, 0x36, 0x94, 0x62, 0x63, 0x4E, 0x0F, 0x4D,
+    0x7C, 0xD2, 0xCB, 0x8D, 0x67, 0x9C, 0x7C, 0x47, 0x9C, 0x76, 0x59, 0x3E, 0xEC, 0xC6, 0x77, 0x82,
+    0x4B, 0xD4, 0xD8, 0xFA, 0x47, 0x83, 0x4B, 0x74, 0x3D, 0x71, 0x89, 0x82, 0xDD, 0xD8, 0x9D, 0x1A,
+    0xEE, 0xDC, 0xE8, 0x79, 0xB7, 0x6B, 0xBC, 0xF3, 0x5C, 0x83, 0x35, 0xD4, 0x60, 0x9A, 0xA5, 0xEE,
+    0x55, 0xCF, 0xDE, 0x8B, 0xEC, 0xA8, 0x8D, 0x48, 0xB5, 0xBA, 0xDE, 0x4D, 0xB0, 0x67, 0x68, 0xA9,
+    0x8B, 0x6E, 0x81, 0x28, 0x11, 0xC7, 0x49, 0xA0, 0xD2, 0xF0, 0x50, 0x6D, 0xB0, 0xD5, 0xDA, 0x08,
+    0xA7, 0xB9, 0x47, 0xE9, 0x00, 0x65, 0xED, 0x11, 0x75, 0xF8, 0x69, 0xD6, 0xFC, 0x1A, 0x35, 0xFA,
+    0x71, 0xC5, 0xDC, 0xBA, 0xF4, 0x76, 0x6B, 0xF9, 0x63, 0x0C, 0xC4, 0x13, 0xB0, 0x93, 0xEB, 0x6D,
+    0x77, 0x8D, 0x50, 0x56, 0x9A, 0x82, 0x82, 0x5D, 0xC1, 0x8A, 0x5F, 0xEB, 0x1D, 0x2B, 0x64, 0xA1,
+    0x56, 0x28, 0xCB, 0xD9, 0x2C, 0x6A, 0x5C, 0x9D, 0x3A, 0x6F, 0x44, 0xB3, 0x7A, 0x8A, 0x10, 0x87,
+    0xD6, 0x30, 0xDC, 0x71, 0x82, 0xE6, 0x3B, 0x28, 0xD8, 0x4C, 0x91, 0x16, 0xDB, 0xC1, 0x60, 0x9B,
+    0x20, 0x9B, 0x69, 0x11, 0x6B, 0x3A, 0x8D, 0x4D, 0xAF, 0x49, 0x54, 0xF2, 0xB4, 0x59, 0x37, 0xEA,
+    0x67, 0xFC, 0x73, 0xB4, 0xA3, 0xDF, 0xF6, 0x1A, 0x5E, 0x8E, 0xB1, 0x2E, 0x88, 0x31, 0x5D, 0x73,
+    0x1B, 0xF6, 0xBC, 0x9E, 0x86, 0x23, 0xD8, 0xA4, 0x20, 0x9B, 0x12, 0x64, 0x0B, 0xA3, 0x1F, 0x4D,
+    0x84, 0x0C, 0x28, 0xDD, 0x87, 0x0A, 0x6F, 0xA1, 0xC8, 0x5C, 0xC8, 0x2D, 0x83, 0xA7, 0x50, 0x37,
+    0x11, 0x8E, 0x72, 0xDD, 0x4A, 0x98, 0x30, 0x3D, 0x31, 0x28, 0x0F, 0xB1, 0x14, 0x5B, 0xBB, 0x17,
+    0x81, 0xEE, 0x74, 0x45, 0xC7, 0xA4, 0x79, 0x0D, 0x01, 0x7A, 0x9B, 0x62, 0x43, 0x98, 0xBA, 0x3D,
+    0xBF, 0x82, 0x72, 0x6C, 0xEC, 0xE9, 0xF1, 0x92, 0x4F, 0xEE, 0x16, 0x85, 0xD3, 0x59, 0x61, 0xE7,
+    0xC6, 0x64, 0x56, 0xD0, 0x2A, 0xEA, 0x0D, 0xB3, 0x22, 0xBC, 0x65, 0xE9, 0x8C, 0x08, 0x0A, 0x9B,
+    0xF5, 0x94, 0x4E, 0x3D, 0x67, 0xE7, 0x00, 0xF4, 0xE1, 0x0C, 0x95, 0x7B, 0x18, 0x3E, 0xB8, 0x39,
+    0xEF, 0xB5, 0x2E, 0x50, 0x61, 0x8C, 0x3E, 0x21, 0xE1, 0x65, 0x8C, 0x7C, 0x06, 0xEA, 0x55, 0xF8,
+    0x51, 0x4F, 0xDF, 0x98, 0xE6, 0x9F, 0x0D, 0x1D, 0xF0, 0xF4, 0xB8, 0x32, 0xF3, 0x1D, 0x57, 0xE6,
+    0x8E, 0x93, 0x62, 0x35, 0x95, 0x3A, 0x5C, 0xFE, 0x64, 0x3D, 0xD5, 0x57, 0xA7, 0x19, 0x35, 0x8F,
+    0xD9, 0x95, 0x59, 0x4E, 0x20, 0x47, 0x4F, 0x94, 0x1E, 0xB5, 0x94, 0xEC, 0xED, 0xC4, 0x0C, 0xEB,
+    0x3B, 0x9C, 0x5F, 0xCB, 0x3B, 0x0E, 0xA8, 0x53, 0x53, 0xA5, 0xA6, 0x46, 0x4D, 0x2D, 0x4F, 0xF5,
+    0x69, 0xA7, 0x4E, 0xDF, 0x13, 0x24, 0x47, 0x40, 0x7A, 0x26, 0x98, 0xEA, 0xCE, 0xE7, 0x01, 0xA9,
+    0x46, 0x10, 0x64, 0x15, 0x35, 0x66, 0x2A, 0xCC, 0xAA, 0x2F, 0x5B, 0x75, 0x79, 0x17, 0x78, 0xFD,
+    0x2E, 0x38, 0x2B, 0xEA, 0xD2, 0x6E, 0xD8, 0x6A, 0xEC, 0x8E, 0xAD, 0xC6, 0x6E, 0xD9, 0x6A, 0xEC,
+    0x9E, 0xAD, 0x66, 0xCF, 0x61, 0xDD, 0xB5, 0xD5, 0xD8, 0x6D, 0x5B, 0x8D, 0xDD, 0xB7, 0xD5, 0xEC,
+    0x21, 0x45, 0x6E, 0xCB, 0x12, 0x86, 0xAC, 0xC8, 0x94, 0x85, 0x1B, 0x4E, 0x32, 0xBB, 0x77, 0xAB,
+    0xB1, 0x9B, 0xB7, 0x1A, 0xBB, 0x7B, 0xAB, 0xB1, 0xDB, 0xB7, 0x1A, 0xBB, 0x7F, 0xAB, 0xB1, 0x1B,
+    0xB8, 0x1A, 0xBB, 0x83, 0xAB, 0xB1, 0x5B, 0xB8, 0x1A, 0xBB, 0x87, 0xAB, 0xB1, 0x9B, 0xB8, 0x1A,
+    0xBB, 0x8B, 0xAB, 0xB1, 0xDB, 0xB8, 0x1A, 0xBB, 0x8F, 0xAB, 0xD1, 0x8D, 0x5C, 0xE9, 0xC6, 0x06,
+    0xAE, 0x75, 0x2B, 0xD7, 0xA1, 0x80, 0x76, 0xB5, 0x9B, 0x5F, 0xEC, 0xA2, 0x93, 0x9C, 0xF8, 0x6F,
+    0x17, 0x05, 0xB7, 0x2A, 0x0C, 0xFB, 0x65, 0x8C, 0xFE, 0xC7, 0x92, 0x01, 0xF3, 0x40, 0x19, 0x92,
+    0xD6, 0x58, 0xB5, 0x95, 0xC9, 0xB1, 0x95, 0xE9, 0xB6, 0xAC, 0x90, 0x85, 0xF0, 0xF7, 0x8F, 0x2B,
+    0x94, 0x72, 0x9A, 0xFF, 0x9A, 0x21, 0xF1, 0x88, 0xA4, 0x6F, 0x12, 0x13, 0x4A, 0xFB, 0x9B, 0x38,
+    0x8D, 0xBE, 0x23, 0x28, 0xCC, 0x61, 0xAC, 0x6D, 0x84, 0x53, 0x02, 0xCD, 0x37, 0xA8, 0x08, 0xD0,
+    0xF8, 0x15, 0x62, 0xEB, 0x9B, 0xD9, 0x6D, 0x64, 0x1D, 0x34, 0xE6, 0x6E, 0x45, 0xD4, 0x6F, 0x88,
+    0xB2, 0xB5, 0xBC, 0x27, 0xC2, 0x68, 0x88, 0x64, 0x9D, 0xB1, 0x5E, 0xAC, 0x28, 0x9D, 0x4E, 0xE6,
+    0xC4, 0x4C, 0xE6, 0x84, 0xD3, 0x24, 0x1A, 0x37, 0xB5, 0x1F, 0xBD, 0x94, 0x1E, 0x96, 0x58, 0x5B,
+    0x51, 0x26, 0x49, 0x68, 0x7B, 0x88, 0xF4, 0x43, 0x4F, 0xFD, 0xB2, 0xF1, 0xB1, 0x9A, 0x82, 0x4A,
+    0x6A, 0xBB, 0xE5, 0xA5, 0xFA, 0xAA, 0xD8, 0xB0, 0x97, 0x09, 0x0F, 0xD8, 0xE4, 0x26, 0x61, 0x43,
+    0x93, 0xD4, 0x55, 0x6B, 0x42, 0xF5, 0x2A, 0x5C, 0xCA, 0x54, 0xC7, 0xF5, 0xBC, 0x72, 0xAB, 0x6D,
+    0x9C, 0x6B, 0x99, 0x61, 0x86, 0xE7, 0x2F, 0x16, 0xD6, 0xB8, 0xA8, 0xB5, 0x60, 0x8C, 0x56, 0x80,
+    0xD2, 0xA5, 0x19, 0x97, 0xD0, 0x7A, 0x2E, 0x93, 0x21, 0x62, 0x25, 0x02, 0x74, 0xB1, 0x5F, 0xE3,
+    0x11, 0xEA, 0xDC, 0x36, 0xAD, 0x9D, 0xBB, 0x2C, 0x9A, 0x79, 0x80, 0xD1, 0x42, 0x39, 0x95, 0x51,
+    0xB5, 0x47, 0x8B, 0x66, 0x2E, 0x6C, 0xF0, 0x0C, 0x02, 0xEA, 0xCD, 0xEC, 0xF0, 0x6B, 0x32, 0xC4,
+    0xF2, 0xA3, 0xBB, 0x4C, 0x85, 0xF6, 0xE8, 0x73, 0xA8, 0x8C, 0xCF, 0xAD, 0xA6, 0xBA, 0xEB, 0xD1,
+    0x74, 0xAB, 0xA9, 0x54, 0xD7, 0x46, 0xDA, 0xCB, 0x93, 0x32, 0x29, 0x75, 0xAB, 0xA9, 0x5F, 0x62,
+    0xAB, 0xA9, 0xB7, 0xCB, 0x59, 0xDF, 0xCA, 0xCA, 0xAF, 0xF9, 0xBE, 0xA9, 0x67, 0x1C, 0x09, 0xE6,
+    0xD5, 0x48, 0x0E, 0xFD, 0xFE, 0x84, 0x9F, 0x27, 0x9E, 0xC4, 0xCF, 0x23, 0x0B, 0x65, 0x05, 0xBD,
+    0x6E, 0x05, 0xE1, 0xF1, 0x2D, 0xD5, 0xF0, 0x76, 0x0A, 0x60, 0x3C, 0x66, 0x12, 0x5B, 0x83, 0xA9,
+    0xEA, 0x70, 0xFD, 0x24, 0x46, 0x43, 0x2D, 0x07, 0xD8, 0x7E, 0xAB, 0xD4, 0x15, 0x51, 0xF1, 0x5C,
+    0x7B, 0x40, 0xDD, 0x32, 0x6C, 0x44, 0x68, 0x65, 0x1B, 0x9B, 0x2F, 0x65, 0x25, 0xB6, 0x02, 0xD5,
+    0x25, 0xB9, 0xA9, 0x49, 0xC8, 0xCA, 0xB8, 0x8D, 0x62, 0xC4, 0x42, 0xE1, 0xFB, 0xE0, 0xF6, 0x82,
+    0x3B, 0x26, 0x38, 0x8B, 0x52, 0xEC, 0xAC, 0x1D, 0xB7, 0x96, 0xAE, 0xCA, 0x21, 0xEF, 0xD3, 0x29,
+    0xB6, 0xE2, 0xB0, 0x66, 0x23, 0x97, 0xCA, 0xBE, 0x98, 0x93, 0xB9, 0xD1, 0x5B, 0x70, 0xCB, 0x75,
+    0xC1, 0x20, 0x53, 0xC8, 0x5E, 0xBA, 0xA2, 0x84, 0x2C, 0x50, 0x37, 0x9A, 0x9B, 0x15, 0xD6, 0xC8,
+    0xB5, 0xF0, 0x0F, 0x5F, 0xEC, 0xBA, 0xAF, 0x75, 0xC8, 0x18, 0x2A, 0xB6, 0xB6, 0x92, 0x93, 0xC6,
+    0x65, 0x43, 0x65, 0x8A, 0x2C, 0x56, 0xDB, 0x09, 0xF1, 0x4B, 0xBD, 0xD6, 0x54, 0x53, 0x73, 0xC9,
+    0x3A, 0xEC, 0xAE, 0x48, 0x0B, 0x97, 0xFB, 0x42, 0xE9, 0xC4, 0x2A, 0x11, 0x74, 0x66, 0x93, 0xCA,
+    0x36, 0x2F, 0x58, 0x0D, 0x2F, 0xEA, 0xE2, 0x11, 0xD5, 0xF6, 0xAE, 0x70, 0x8C, 0x34, 0xBE, 0x7D,
+    0xED, 0xE7, 0xFD, 0x5F, 0x16, 0x79, 0xA8, 0x3B, 0x3C, 0xE7, 0x33, 0xD4, 0xEC, 0x01, 0xD9, 0xD1,
+    0x09, 0x22, 0xE8, 0xF9, 0x9B, 0x59, 0x85, 0x8D, 0x98, 0x66, 0x50, 0xA8, 0x41, 0x89, 0xA8, 0x9D,
+    0x1A, 0xFA, 0x5B, 0x04, 0xD8, 0xF3, 0x63, 0xC6, 0x2D, 0x7B, 0x4F, 0xFC, 0x2C, 0x16, 0x57, 0x32,
+    0xDD, 0x72, 0xB2, 0xE1, 0xF1, 0x59, 0xE7, 0xEB, 0xFD, 0x3B, 0xF7, 0x99, 0x55, 0x66, 0x2B, 0xAB,
+    0x17, 0x4C, 0x07, 0xED, 0xBC, 0xB2, 0x76, 0x86, 0x88, 0x0C, 0x6D, 0xB0, 0x55, 0x31, 0x7C, 0x01,
+    0x7F, 0xA0, 0x53, 0x3C, 0x68, 0x5F, 0x64, 0x25, 0xC8, 0x42, 0x73, 0xD6, 0x33, 0x5B, 0xF0, 0xC8,
+    0x6E, 0x96, 0x31, 0x6E, 0x27, 0x24, 0x32, 0xD0, 0x32, 0x1F, 0x25, 0x85, 0x62, 0x58, 0x5C, 0x48,
+    0xB7, 0x48, 0xB4, 0xA1, 0x74, 0xDE, 0x7F, 0xB7, 0x40, 0xE5, 0x21, 0x6C, 0xAE, 0xC3, 0xD4, 0xB6,
+    0xA1, 0xF0, 0x87, 0x57, 0xB8, 0x12, 0xA5, 0x1B, 0x42, 0x19, 0x4C, 0xFB, 0xC6, 0x66, 0x02, 0x16,
+    0xC7, 0x83, 0x09, 0x26, 0x29, 0x48, 0xB3, 0x9D, 0x64, 0xA8, 0x25, 0x7E, 0xDA, 0xC9, 0xFE, 0x17,
+    0xAD, 0x4C, 0x6C, 0x99, 0xDA, 0x5A, 0x60, 0x45, 0x21, 0xAB, 0xE3, 0x35, 0x43, 0xA5, 0x16, 0x3B,
+    0xA7, 0x23, 0x46, 0xE6, 0x67, 0xA5, 0x96, 0x77, 0xF6, 0x7A, 0x54, 0x91, 0xB6, 0xC9, 0x0F, 0x81,
+    0x32, 0x7C, 0x8A, 0xEB, 0x97, 0xAE, 0x50, 0xED, 0xDF, 0xD7, 0x7D, 0x24, 0xC2, 0x0F, 0xAE, 0x76,
+    0xCC, 0x64, 0x4C, 0x77, 0x12, 0x09, 0xC3, 0x8D, 0x93, 0x4F, 0xE6, 0xD5, 0x17, 0x45, 0x34, 0x9C,
+    0x96, 0xC6, 0x87, 0xD3, 0x13, 0x7E, 0xB3, 0x0D, 0x0B, 0xFB, 0x20, 0x6D, 0xBC, 0x44, 0x9C, 0x49,
+    0xEA, 0x77, 0xAF, 0xA2, 0x48, 0x02, 0x74, 0x3B, 0x4D, 0x67, 0xBB, 0xC2, 0xD2, 0x39, 0xCF, 0x90,
+    0x17, 0x24, 0x43, 0x49, 0x07, 0x3D, 0xF6, 0x4E, 0x36, 0x70, 0x3C, 0x35, 0x54, 0x7C, 0x0E, 0xF5,
+    0x18, 0x5A, 0x0E, 0x42, 0x3C, 0xFF, 0x3D, 0x1C, 0x3D, 0xB7, 0x5B, 0xA3, 0xE1, 0xF1, 0x12, 0x7A,
+    0xF2, 0xF8, 0xC6, 0x4A, 0x50, 0xB6, 0x42, 0xE9, 0xE4, 0x9B, 0xA3, 0x4D, 0xFC, 0xFF, 0x46, 0x39,
+    0x1A, 0xE5, 0x9E, 0xB1, 0xCB, 0x1B, 0xAD, 0x31, 0x53, 0x6C, 0x13, 0x65, 0x9F, 0x39, 0xB2, 0xFC,
+    0x3D, 0x5D, 0x46, 0x39, 0x61, 0x8B, 0x10, 0xFB, 0x51, 0x0C, 0x00, 0x65, 0x9B, 0x78, 0x74, 0xD2,
+    0x40, 0x78, 0x52, 0x72, 0x3F, 0x2E, 0x5D, 0x56, 0xF1, 0x09, 0xCB, 0x38, 0x44, 0x2A, 0x1F, 0xCB,
+    0xF8, 0x54, 0x9C, 0xFA, 0x84, 0xF6, 0x34, 0xC4, 0xFA, 0xBE, 0x49, 0x06, 0xE0, 0xDE, 0xA1, 0x77,
+    0x31, 0x92, 0x61, 0xE5, 0x66, 0xEE, 0x91, 0xAF, 0x86, 0xFD, 0x7B, 0x32, 0x6E, 0xFF, 0xC0, 0xAC,
+    0x2F, 0xD5, 0xCD, 0x82, 0x21, 0x1A, 0xDE, 0x1F, 0xEB, 0x4D, 0x8E, 0x45, 0x27, 0xAB, 0x77, 0xB1,
+    0xB6, 0x17, 0x1F, 0x5C, 0x65, 0x6A, 0x5C, 0x67, 0xEB, 0x06, 0x5E, 0x72, 0xCB, 0x18, 0x9A, 0x91,
+    0x12, 0x08, 0x67, 0x18, 0x22, 0x6A, 0x48, 0x3F, 0x75, 0xA1, 0xE4, 0xF6, 0x75, 0x66, 0x8D, 0x63,
+    0x22, 0xEC, 0x93, 0x6C, 0x9F, 0x52, 0x45, 0x0E, 0x80, 0x93, 0x5F, 0x6A, 0x07, 0xB3, 0x59, 0x32,
+    0x8A, 0x67, 0x27, 0xC4, 0x2E, 0x39, 0xE1, 0x02, 0xDD, 0xFA, 0xEF, 0x51, 0x17, 0x21, 0xEB, 0x84,
+    0xC9, 0x64, 0xA0, 0xE1, 0x45, 0xAE, 0x76, 0x17, 0x16, 0x70, 0x4A, 0xA9, 0x61, 0x54, 0xE1, 0x85,
+    0xC5, 0xE2, 0x58, 0xD9, 0x11, 0xEB, 0xD2, 0xD4, 0xD8, 0xD5, 0x8C, 0x90, 0x19, 0x29, 0x33, 0xC2,
+    0xF9, 0xC7, 0xDC, 0x66, 0xF8, 0xA7, 0xAC, 0x29, 0xF3, 0x36, 0x6B, 0x58, 0x33, 0x83, 0x8C, 0x79,
+    0x64, 0x5E, 0x03, 0xE8, 0x57, 0x80, 0xC8, 0xFF, 0x42, 0x59, 0x12, 0x40, 0x14, 0x62, 0x44, 0x5E,
+    0x95, 0x40, 0xE9, 0x48, 0x81, 0x08, 0xF5, 0xDF, 0x64, 0x01, 0xF4, 0x56, 0x54, 0x65, 0x16, 0x08,
+    0x9D, 0x7B, 0x93, 0xAD, 0x20, 0x26, 0x67, 0x34, 0x57, 0x42, 0x2B, 0x16, 0x58, 0x11, 0x52, 0x7C,
+    0x86, 0x55, 0x39, 0xD8, 0x78, 0x28, 0xA7, 0xE2, 0xDB, 0x94, 0xDB, 0xCA, 0x78, 0x5A, 0x5D, 0x65,
+    0x62, 0x38, 0xF9, 0xE4, 0x6B, 0xFF, 0x9F, 0xB4, 0x2A, 0xC6, 0xA7, 0xAF, 0x8A, 0x4F, 0x3E, 0x4D,
+    0xC9, 0x4F, 0xCE, 0xC1, 0x63, 0x1E, 0xCF, 0x36, 0x9D, 0xFA, 0x60, 0x6D, 0x84, 0x36, 0x68, 0xF8,
+    0xED, 0x5E, 0x2B, 0xE0, 0x27, 0x51, 0x73, 0xF3, 0x2C, 0x74, 0xBF, 0x35, 0x37, 0x33, 0xC6, 0xEF,
+    0x9E, 0x5E, 0x73, 0x93, 0xAF, 0x77, 0x80, 0x25, 0xBC, 0x03, 0x8F, 0x39, 0x38, 0x41, 0x2E, 0x39,
+    0xB5, 0x2C, 0x67, 0xE9, 0x32, 0xCC, 0xC7, 0xB2, 0x9C, 0xAC, 0x30, 0xD7, 0x0E, 0x60, 0x2C, 0xCB,
+    0xC9, 0x32, 0x73, 0x34, 0x73, 0xC5, 0x3B, 0x65, 0x39, 0xCD, 0x91, 0xB2, 0x9C, 0x9F, 0x24, 0x6D,
+    0x7F, 0xA3, 0xEB, 0x99, 0xDE, 0xFF, 0x28, 0xFE, 0x4D, 0x20, 0xF1, 0xC3, 0x0C, 0xDF, 0x4F, 0xA4,
+    0x17, 0x20, 0x3B, 0x59, 0xAA, 0x6B, 0x17, 0xD8, 0x1E, 0x38, 0x85, 0x8D, 0xA8, 0x47, 0x5E, 0x37,
+    0xA3, 0xD7, 0x6A, 0x56, 0x9F, 0x4F, 0x3D, 0xAD, 0x7B, 0x18, 0xD5, 0x63, 0xB6, 0x85, 0xCD, 0x1E,
+    0x3C, 0x35, 0xEC, 0x7C, 0x77, 0x73, 0x8C, 0xD7, 0x97, 0xCB, 0xE2, 0x58, 0x98, 0x54, 0x72, 0xD4,
+    0x51, 0xA3, 0x4A, 0xAB, 0xDE, 0x3F, 0xAC, 0xCD, 0x17, 0x68, 0xF5, 0x4C, 0x20, 0x5B, 0xD9, 0xF6,
+    0xBC, 0xA4, 0xD2, 0x25, 0x23, 0x3A, 0xB0, 0xD0, 0x60, 0xF9, 0x91, 0x4F, 0x0A, 0xBC, 0xB3, 0xF0,
+    0x7C, 0x52, 0xDB, 0xE8, 0xA9, 0xF4, 0x10, 0xEA, 0x7E, 0x1F, 0x4E, 0x7A, 0x48, 0x8F, 0xAD, 0x74,
+    0x33, 0x6A, 0x63, 0x7E, 0x1D, 0xD3, 0x88, 0x42, 0xF3, 0x09, 0xF3, 0xC0, 0x45, 0x12, 0xAC, 0x29,
+    0xF4, 0x37, 0x36, 0xDF, 0x83, 0x99, 0x32, 0x76, 0x2F, 0x1A, 0x6E, 0xA1, 0xC3, 0x13, 0x50, 0x54,
+    0xDD, 0xD6, 0xD4, 0xD4, 0xEA, 0xA5, 0xD2, 0x71, 0xF4, 0x6A, 0x75, 0x24, 0x56, 0xA1, 0xE3, 0x96,
+    0x22, 0x51, 0xAC, 0xC4, 0xDA, 0x4E, 0x2C, 0x72, 0x9B, 0xB1, 0x17, 0xA0, 0xEC, 0x69, 0xF2, 0x83,
+    0xAF, 0x51, 0xB0, 0xEA, 0x56, 0x52, 0xA6, 0xB6, 0x80, 0xE1, 0x88, 0x4E, 0x56, 0x02, 0xFE, 0x3A,
+    0x1A, 0xA0, 0x9F, 0xBC, 0x3D, 0x7B, 0x28, 0x3F, 0xCF, 0x37, 0x11, 0xF5, 0x5C, 0x52, 0x96, 0xC7,
+    0xA7, 0x98, 0x29, 0x9F, 0x9A, 0x6E, 0xA0, 0xB1, 0x72, 0x0F, 0x26, 0xCA, 0x02, 0x8F, 0xE6, 0xD1,
+    0x09, 0xDA, 0xDA, 0x13, 0xD8, 0x21, 0x17, 0xDF, 0xC5, 0x96, 0x8A, 0x21, 0x8B, 0xEE, 0xD2, 0x12,
+    0x65, 0x92, 0xAF, 0xE0, 0x5A, 0xAD, 0x3B, 0xBC, 0x0D, 0x4E, 0xB2, 0x21, 0x3F, 0x35, 0xDD, 0x62,
+    0x96, 0x17, 0xDF, 0x81, 0x59, 0xB6, 0x52, 0xFB, 0x75, 0xC0, 0x90, 0xC9, 0xFC, 0xC0, 0x98, 0x97,
+    0x91, 0x19, 0xF3, 0xFC, 0x0E, 0xEF, 0x74, 0x19, 0x6C, 0x34, 0xC2, 0xB0, 0x6F, 0xA4, 0x75, 0xE8,
+    0x9B, 0x60, 0xA7, 0x6F, 0x52, 0xD7, 0x37, 0xDC, 0x34, 0xE2, 0x94, 0xBE, 0x09, 0x76, 0xFB, 0xC6,
+    0x3B, 0xBB, 0x6F, 0x40, 0xC6, 0xBF, 0x3E, 0xD2, 0x37, 0x1C, 0x40, 0xF0, 0x6C, 0xD9, 0xF0, 0x0C,
+    0x58, 0x01, 0x4E, 0x18, 0x54, 0x10, 0xDE, 0x0F, 0x12, 0x92, 0xEE, 0xBC, 0x20, 0xB5, 0x1B, 0x46,
+    0x74, 0x58, 0x20, 0x3B, 0xE1, 0xD2, 0x2F, 0x81, 0x83, 0xF6, 0x9D, 0xD7, 0xAB, 0xFA, 0xB7, 0x7F,
+    0xB6, 0xEF, 0xF2, 0x38, 0xB8, 0xEC, 0x9D, 0x4B, 0xF4, 0x7E, 0x1C, 0x9B, 0x07, 0x7F, 0x6A, 0x25,
+    0x78, 0x9A, 0x1D, 0x70, 0x9E, 0x7C, 0x93, 0x49, 0xB2, 0x62, 0xCA, 0xCF, 0x43, 0x6C, 0x55, 0xD9,
+    0xBF, 0xAB, 0xDE, 0xCB, 0xFE, 0x8C, 0xBA, 0x36, 0x43, 0xBF, 0xA8, 0x3D, 0xCE, 0xD9, 0xE7, 0xAC,
+    0x75, 0xEE, 0x74, 0xCD, 0x24, 0x33, 0x43, 0xC4, 0xC6, 0xC3, 0x20, 0xE8, 0xB9, 0x21, 0xFA, 0x68,
+    0x5F, 0x11, 0x14, 0xA8, 0x6C, 0x79, 0xB3, 0xD7, 0x53, 0x8A, 0x92, 0x28, 0x5E, 0x13, 0xC1, 0x77,
+    0x32, 0x22, 0x99, 0x91, 0x13, 0x64, 0xBF, 0x8C, 0xF4, 0xCC, 0x84, 0xD7, 0x89, 0x70, 0xC7, 0x7B,
+    0x76, 0x7A, 0xEB, 0x2D, 0x51, 0x97, 0x4E, 0x94, 0x5D, 0x55, 0x73, 0xCF, 0x56, 0x76, 0x3F, 0xAD,
+    0x1D, 0x89, 0x3F, 0xB5, 0x7A, 0x4A, 0xBB, 0xCE, 0xFF, 0x93, 0x36, 0xBC, 0xF3, 0x60, 0x2D, 0x65,
+    0xB9, 0x46, 0xCD, 0x6A, 0xB9, 0xF2, 0x28, 0xEB, 0x2E, 0x75, 0x39, 0x79, 0x37, 0xF9, 0x77, 0x30,
+    0xF9, 0x60, 0xF7, 0xB4, 0x6B, 0x25, 0x8B, 0x6B, 0xD2, 0x00, 0x7F, 0xF9, 0xE9, 0x4D, 0x34, 0x52,
+    0xAF, 0xC0, 0x9F, 0x4F, 0x9E, 0xAF, 0x8B, 0xD5, 0xA5, 0x4F, 0x36, 0xD1, 0xA8, 0x39, 0x9E, 0x68,
+    0x74, 0xEB, 0xBC, 0x89, 0x46, 0x97, 0xF8, 0xD7, 0x58, 0x17, 0x62, 0x36, 0xFC, 0x42, 0x6A, 0x0B,
+    0x89, 0x9D, 0x4A, 0xFF, 0xEE, 0x6C, 0xFA, 0x5F, 0x5C, 0xF6, 0x77, 0xBE, 0xCF, 0x3C, 0xDA, 0xCE,
+    0x42, 0x6F, 0xD1, 0xDF, 0xBE, 0x72, 0x16, 0xFD, 0xBB, 0x7B, 0xD0, 0x5F, 0x73, 0xF0, 0xA8, 0x0E,
+    0xDA, 0x7C, 0x71, 0x92, 0x93, 0xD4, 0x24, 0x31, 0xB5, 0x8C, 0x0B, 0x49, 0x49, 0x4A, 0x92, 0x90,
+    0xA0, 0xE3, 0xB3, 0x37, 0xFA, 0x5B, 0xFB, 0xF0, 0xF2, 0x54, 0xEA, 0xF0, 0x21, 0x0D, 0x49, 0x42,
+    0x52, 0x90, 0x04, 0x04, 0xFD, 0x48, 0x3E, 0x50, 0x6F, 0x0D, 0xE2, 0xC1, 0x25, 0xE2, 0x37, 0xFF,
+    0x0F, 0xE5, 0x5B, 0x3D, 0x90, 0xDD, 0xD4, 0x15, 0x3E, 0x92, 0xEC, 0xD5, 0x78, 0x55, 0x88, 0xCC,
+    0xE0, 0x09, 0x6B, 0x87, 0x88, 0x22, 0x05, 0xF1, 0xC4, 0x79, 0x2D, 0x05, 0x20, 0x01, 0x03, 0xCC,
+    0xA4, 0x22, 0x33, 0x5E, 0x52, 0xA4, 0x80, 0xC2, 0x0D, 0x34, 0x6E, 0x52, 0xA4, 0x00, 0x4B, 0xA1,
+    0x49, 0x91, 0x22, 0xDB, 0x90, 0x26, 0xCD, 0x26, 0x71, 0x66, 0xC8, 0xA6, 0xA0, 0xA1, 0x8B, 0xD7,
+    0x12, 0x93, 0x32, 0x45, 0x5E, 0xEA, 0x14, 0x08, 0x98, 0x0C, 0x09, 0x14, 0x68, 0x92, 0xE7, 0x89,
+    0x16, 0x4B, 0xBA, 0x9C, 0xEF, 0x9C, 0x2B, 0x3D, 0xBD, 0x85, 0xF1, 0x6E, 0x42, 0xB2, 0xEF, 0xBD,
+    0x5D, 0xD9, 0x7B, 0xF4, 0x7F, 0x75, 0xEE, 0xF9, 0xEE, 0x3D, 0xBF, 0xF7, 0x11, 0x05, 0x25, 0xF1,
+    0x16, 0x56, 0xA0, 0xD1, 0x0C, 0x34, 0x6E, 0x40, 0x9F, 0x14, 0xBA, 0x7F, 0x13, 0xB4, 0x89, 0x99,
+    0x38, 0x4D, 0x9C, 0x10, 0x79, 0xB3, 0xA8, 0x60, 0x5A, 0x85, 0x4C, 0x83, 0x12, 0x2F, 0x87, 0x53,
+    0x9F, 0x5F, 0x8E, 0x0A, 0x8F, 0x5F, 0x9E, 0x64, 0x6E, 0xCD, 0x0D, 0xF0, 0xB3, 0x44, 0xF9, 0xF6,
+    0x76, 0x4B, 0x64, 0x78, 0x23, 0x47, 0xA8, 0xDB, 0xED, 0xED, 0xE5, 0x19, 0x1E, 0x8B, 0x0A, 0xBC,
+    0x12, 0x4E, 0x43, 0x7E, 0x3D, 0xA8, 0xD0, 0xA0, 0x5F, 0x4D, 0xD0, 0x6C, 0x8D, 0x4F, 0xB8, 0x4D,
+    0x8A, 0x8F, 0xB6, 0x1D, 0xA8, 0x90, 0xF9, 0xE6, 0x64, 0xA0, 0x41, 0x35, 0xE7, 0x59, 0x8F, 0xF5,
+    0xFA, 0x36, 0xFF, 0xA5, 0x66, 0x46, 0x9E, 0x31, 0x1D, 0xB9, 0x07, 0xCF, 0x19, 0xA2, 0x8C, 0x62,
+    0xDC, 0x42, 0xEB, 0x84, 0x0F, 0x51, 0x68, 0x8F, 0x2E, 0x19, 0x53, 0x80, 0xAF, 0x22, 0xE8, 0xDE,
+    0x8C, 0x8A, 0x49, 0xC9, 0xD7, 0xF8, 0x49, 0x26, 0x09, 0x93, 0x14, 0x6F, 0xF0, 0x51, 0x5C, 0xC4,
+    0xFC, 0x50, 0x31, 0xB9, 0xFB, 0xD2, 0xA7, 0x45, 0x68, 0xCC, 0xCF, 0x0A, 0xD7, 0xB4, 0x41, 0x41,
+    0xE7, 0x93, 0x81, 0xA1, 0xEB, 0xC2, 0x2A, 0x38, 0x68, 0x45, 0x52, 0xC3, 0xB5, 0xC9, 0xCE, 0x5C,
+    0x96, 0x5F, 0xBB, 0x23, 0xCF, 0x3E, 0x39, 0xA7, 0x1B, 0x72, 0x5D, 0x65, 0x1F, 0x68, 0x9F, 0x12,
+    0x3A, 0xB4, 0xAD, 0x3C, 0x32, 0x1B, 0xFF, 0xE0, 0x9D, 0x6F, 0x98, 0x7D, 0xE7, 0x25, 0x48, 0xD5,
+    0x9F, 0x82, 0x6B, 0x1C, 0xA5, 0x99, 0x95, 0x0A, 0x55, 0x03, 0xA1, 0x65, 0x20, 0xB4, 0x21, 0x28,
+    0x48, 0x8B, 0x34, 0xE1, 0x6B, 0x51, 0xF5, 0xBA, 0xC8, 0xF1, 0x65, 0xF0, 0x07, 0x54, 0xDC, 0x59,
+    0x94, 0x81, 0x69, 0x6F, 0xBA, 0x6E, 0xD2, 0xE7, 0xED, 0x1A, 0x3A, 0x00, 0x7E, 0xBC, 0x8A, 0xDC,
+    0x96, 0x3F, 0xED, 0x9B, 0xEF, 0x71, 0x2B, 0xEF, 0xF1, 0x2B, 0x31, 0x5F, 0xA2, 0x9A, 0x6E, 0x13,
+    0x25, 0xF4, 0xE0, 0x32, 0xA4, 0xBF, 0x29, 0x92, 0xF7, 0x75, 0x76, 0xD6, 0xF2, 0xF9, 0xD7, 0x22,
+    0x9C, 0x6D, 0xA9, 0x1C, 0xC7, 0xD2, 0xCF, 0xD6, 0x4E, 0xFA, 0x17, 0x85, 0xA5, 0xA4, 0x97, 0x97,
+    0x57, 0xE6, 0xDC, 0x8F, 0x5F, 0x19, 0xEE, 0x86, 0xF7, 0x6F, 0x34, 0x52, 0x34, 0x98, 0xE8, 0x13,
+    0xA2, 0x07, 0xC8, 0xE9, 0xFB, 0x74, 0x11, 0xE3, 0xCF, 0xE8, 0xD7, 0x33, 0xBA, 0xF3, 0xFD, 0xBC,
+    0xA0, 0x47, 0x08, 0x1F, 0x53, 0x1D, 0x26, 0xA2, 0xF2, 0xEC, 0xD1, 0x46, 0x6E, 0x2A, 0x86, 0xCA,
+    0x54, 0xAE, 0xF9, 0xED, 0xF3, 0x55, 0x50, 0xF3, 0x35, 0x7E, 0x92, 0xC9, 0x94, 0x09, 0xB3, 0x16,
+    0xE0, 0x28, 0xAC, 0x58, 0x40, 0x69, 0x15, 0xB4, 0x3F, 0xB8, 0x57, 0x31, 0xA4, 0x1F, 0x54, 0x94,
+    0x9B, 0xA7, 0x2B, 0x72, 0x5E, 0x50, 0x55, 0x79, 0x20, 0x34, 0x97, 0x99, 0xE0, 0x8F, 0x74, 0x0C,
+    0x84, 0x17, 0x55, 0x3F, 0xC2, 0x58, 0xA8, 0x1F, 0xE9, 0x91, 0xF0, 0x2A, 0x4C, 0x8F, 0x30, 0xF3,
+    0xD7, 0x70, 0x1E, 0x5C, 0x42, 0xB7, 0x26, 0xC2, 0xE1, 0x3B, 0x3D, 0xF1, 0x4B, 0x72, 0xBA, 0x00,
+    0xEA, 0xE9, 0x79, 0x6E, 0xE9, 0xBD, 0xE9, 0x78, 0x46, 0xBC, 0x40, 0xE7, 0x96, 0xA3, 0x8F, 0x1E,
+    0xE0, 0x7F, 0xDC, 0xD9, 0x84, 0x19, 0xF1, 0xCC, 0x3D, 0xE6, 0x29, 0x78, 0xC3, 0x70, 0xE3, 0x9B,
+    0x74, 0x65, 0x2E, 0x6F, 0x95, 0xB4, 0xCA, 0xB8, 0x5B, 0xD0, 0x50, 0xE5, 0x1A, 0x6A, 0x28, 0x6E,
+    0x78, 0x7A, 0x95, 0x5B, 0x6C, 0x5F, 0x23, 0xBA, 0x9B, 0xD7, 0xE4, 0x4C, 0x83, 0xBE, 0x1B, 0x62,
+    0x30, 0x7D, 0x83, 0x2E, 0x1C, 0x56, 0x58, 0x4B, 0x82, 0x67, 0x73, 0x57, 0x18, 0x16, 0x51, 0xA6,
+    0x62, 0xBD, 0x5A, 0xF4, 0x47, 0x05, 0x17, 0x16, 0x60, 0xF0, 0x3C, 0x46, 0xCF, 0x3A, 0xC2, 0x70,
+    0x3C, 0x07, 0xEA, 0x77, 0xE8, 0x2E, 0x20, 0x09, 0x30, 0x2E, 0x27, 0x7F, 0xE6, 0xE6, 0x53, 0x66,
+    0x88, 0xF5, 0xF7, 0x4D, 0xE0, 0x72, 0x7E, 0x59, 0x66, 0x9C, 0xB7, 0x97, 0x45, 0x82, 0xBD, 0xC1,
+    0x93, 0x23, 0xB9, 0x06, 0x69, 0x61, 0x53, 0x17, 0x4B, 0x0C, 0x8D, 0xCC, 0x14, 0xFF, 0xA9, 0xA7,
+    0x78, 0x82, 0xF9, 0x62, 0xD8, 0xBD, 0x83, 0x1B, 0x05, 0x26, 0x9E, 0x11, 0x7C, 0xEB, 0xB5, 0x73,
+    0xB4, 0x68, 0x63, 0xB7, 0x17, 0x28, 0xB4, 0x34, 0xC1, 0x87, 0xD9, 0x7D, 0xF9, 0x51, 0xA2, 0x19,
+    0xF1, 0xBC, 0xDA, 0x7F, 0x8E, 0xDB, 0x8B, 0xD9, 0x5E, 0x30, 0x6A, 0x99, 0x68, 0x99, 0xA5, 0xC0,
+    0x64, 0x8D, 0xFC, 0xFE, 0x08, 0x13, 0xF1, 0x6C, 0x4F, 0x13, 0x10, 0xA2, 0xA7, 0xA1, 0x8E, 0x29,
+    0x80, 0x9D, 0x74, 0xAB, 0x1E, 0x88, 0x6A, 0x85, 0x80, 0xB0, 0x5B, 0x24, 0xC2, 0x3C, 0x2F, 0x62,
+    0xA4, 0x1F, 0xCB, 0x1C, 0x97, 0x63, 0xB1, 0xF0, 0xFE, 0xD3, 0xCE, 0xA9, 0x01, 0x05, 0x2D, 0x92,
+    0xFB, 0xF6, 0xE0, 0xE0, 0x44, 0x7D, 0x48, 0xB6, 0xBB, 0xFB, 0x28, 0x9C, 0x81, 0xC7, 0x79, 0xC2,
+    0x3C, 0x5B, 0xAF, 0x0E, 0x32, 0x4E, 0x47, 0xE2, 0x00, 0x7C, 0x54, 0x7E, 0x99, 0x03, 0xE0, 0x27,
+    0x82, 0x4C, 0xE6, 0xA1, 0xBB, 0x77, 0x47, 0xC8, 0xA4, 0x6B, 0xA8, 0xB7, 0x34, 0x10, 0x7E, 0x18,
+    0xE6, 0xD4, 0x3A, 0x00, 0x54, 0x0E, 0x0E, 0xC0, 0x2E, 0xAD, 0xD8, 0xC4, 0xE1, 0xD1, 0x83, 0x5E,
+    0x65, 0x6E, 0x29, 0x93, 0x82, 0x61, 0x70, 0x8D, 0xF0, 0xA3, 0xCE, 0x80, 0x93, 0xD0, 0xE9, 0x35,
+    0xFD, 0x25, 0x3D, 0x0C, 0x73, 0xF2, 0x04, 0x1B, 0xD2, 0x17, 0x9B, 0xD5, 0x99, 0x2B, 0x08, 0x22,
+    0x3D, 0x0C, 0x7C, 0xAF, 0xE9, 0x8F, 0x70, 0x8D, 0x23, 0xA3, 0x96, 0xFF, 0x3A, 0xF9, 0x03, 0x57,
+    0xF7, 0xFB, 0xDB, 0xDE, 0xBE, 0xC6, 0xCF, 0x35, 0xF2, 0x87, 0xE3, 0xA3, 0x9E, 0x97, 0x5E, 0xDA,
+    0xB6, 0xD1, 0xD3, 0xB1, 0xFC, 0x20, 0xB1, 0xFE, 0x0F, 0xE7, 0xCE, 0x35, 0x79, 0x7A, 0x8A, 0x91,
+    0x32, 0xA3, 0xA0, 0xFD, 0x7A, 0x4B, 0xD1, 0x94, 0x72, 0x48, 0x25, 0xCE, 0xA4, 0x9B, 0x39, 0xC4,
+    0x71, 0x07, 0x04, 0x40, 0x5A, 0xB2, 0xB7, 0xB7, 0x97, 0xCD, 0x21, 0xCA, 0x65, 0x7A, 0xA3, 0xD3,
+    0xB1, 0x48, 0x8F, 0x43, 0xB8, 0xC4, 0x37, 0xBF, 0xC8, 0x13, 0x08, 0x30, 0xA1, 0x89, 0x39, 0xB0,
+    0xC2, 0xBF, 0xBF, 0x27, 0x74, 0x99, 0x9D, 0x84, 0x09, 0x0F, 0x9B, 0x73, 0xA9, 0x55, 0x82, 0x13,
+    0xD1, 0x35, 0x84, 0x51, 0x23, 0xDA, 0xA4, 0x18, 0x9A, 0x38, 0x51, 0xF9, 0x6D, 0xFC, 0x5D, 0x1C,
+    0x4A, 0xEE, 0x9F, 0x23, 0x43, 0xC4, 0x2F, 0x8E, 0x4A, 0x13, 0x9D, 0xAC, 0x54, 0xAF, 0xD3, 0x43,
+    0x9E, 0xC9, 0x1E, 0x0F, 0xCC, 0x41, 0x13, 0x3E, 0x6F, 0x66, 0xDF, 0xA4, 0x74, 0x7A, 0x6E, 0x34,
+    0x6D, 0x4E, 0x54, 0x56, 0xD7, 0xE9, 0x02, 0x77, 0x3A, 0xBB, 0xCA, 0x81, 0xD1, 0xC1, 0x6D, 0x0A,
+    0xDF, 0x30, 0x35, 0x85, 0xC4, 0xB3, 0x67, 0xC4, 0xD0, 0x49, 0x0F, 0x39, 0xF5, 0x3D, 0xE1, 0x34,
+    0x44, 0x09, 0x85, 0xB3, 0x27, 0xA0, 0xE4, 0xAE, 0xB3, 0x9A, 0x48, 0x11, 0x9A, 0x22, 0xE7, 0x54,
+    0xB8, 0xE5, 0x21, 0x71, 0x49, 0x9F, 0x2C, 0x21, 0xDB, 0xCD, 0xA3, 0x08, 0x4B, 0x0B, 0x6F, 0x34,
+    0x96, 0xC8, 0xE9, 0x71, 0xDF, 0xB5, 0xDF, 0xED, 0x46, 0xA4, 0x17, 0x14, 0x06, 0x3F, 0x9C, 0x35,
+    0xAF, 0x01, 0xF7, 0xDD, 0xB7, 0x99, 0x7B, 0xA4, 0x6A, 0xF6, 0xF9, 0x92, 0x5B, 0xC1, 0x21, 0x4A,
+    0x06, 0x05, 0x77, 0xA2, 0x82, 0x7D, 0xF5, 0x70, 0x02, 0x09, 0xF3, 0xE3, 0xD7, 0x48, 0x20, 0x05,
+    0x1F, 0xC1, 0x24, 0x64, 0x0D, 0xDC, 0xFC, 0xC9, 0x48, 0xB0, 0x3E, 0x37, 0x30, 0x05, 0x29, 0x95,
+    0x0C, 0x39, 0xA3, 0x23, 0xC8, 0xDD, 0xED, 0xED, 0x04, 0x6F, 0x14, 0x4A, 0xE4, 0xF4, 0xB8, 0xEF,
+    0x56, 0xF6, 0xBB, 0xE5, 0x9C, 0x5C, 0x1B, 0x24, 0x2E, 0x7E, 0xB0, 0x5F, 0xB0, 0x15, 0x70, 0x7E,
+    0x03, 0x2F, 0x26, 0xF8, 0x84, 0xC7, 0xC1, 0xE4, 0x8D, 0x1A, 0x8C, 0xBF, 0x0E, 0xBB, 0xB1, 0x10,
+    0xC6, 0x47, 0x2C, 0x53, 0xCA, 0x79, 0x6C, 0xB8, 0xE6, 0x59, 0x93, 0xF8, 0x33, 0x16, 0x27, 0x9B,
+    0xB0, 0xB0, 0x94, 0x64, 0x16, 0xDB, 0x0F, 0xB6, 0x62, 0x19, 0x93, 0x98, 0xBF, 0x61, 0xC9, 0xC7,
+    0x7B, 0x7B, 0xBB, 0x62, 0x5D, 0x46, 0x26, 0x66, 0xDA, 0xDB, 0x2E, 0x9F, 0xE5, 0xF3, 0x82, 0x63,
+    0xFE, 0xF6, 0xF6, 0x14, 0x78, 0x4F, 0x59, 0xBF, 0x74, 0x89, 0xA6, 0xD8, 0x88, 0x24, 0xF1, 0xF5,
+    0x36, 0x5E, 0xF2, 0x06, 0x7D, 0xC3, 0x56, 0x38, 0x9C, 0x3D, 0x86, 0xB1, 0xFB, 0xAD, 0x75, 0x18,
+    0xBB, 0xAF, 0xC8, 0x65, 0x30, 0xEE, 0x4E, 0x7B, 0xC2, 0x92, 0xF2, 0xEB, 0xAB, 0xDC, 0x8F, 0xEE,
+    0x1B, 0xDC, 0x0F, 0x8C, 0x31, 0x18, 0x4B, 0xB7, 0x72, 0x31, 0xC6, 0x96, 0x33, 0x8A, 0xE1, 0x1E,
+    0x20, 0x9F, 0xE5, 0x99, 0x7B, 0xA5, 0xCF, 0xAE, 0x6C, 0xD0, 0x3B, 0xB2, 0xE1, 0x4C, 0x7D, 0x21,
+    0x96, 0x34, 0xF2, 0x57, 0x63, 0x39, 0x9F, 0xBC, 0xED, 0x4E, 0x93, 0xC7, 0xD8, 0x8D, 0x3A, 0x60,
+    0xC7, 0xE5, 0x03, 0x76, 0x6B, 0xBC, 0x42, 0x06, 0x2E, 0xF5, 0xFE, 0x44, 0x88, 0xA7, 0x62, 0xA4,
+    0x49, 0xAD, 0x52, 0x58, 0xA2, 0x38, 0x37, 0x6E, 0x31, 0x3F, 0xE2, 0x7E, 0xF1, 0x4B, 0x31, 0x3B,
+    0x84, 0x61, 0xE9, 0x4F, 0xDD, 0x99, 0x33, 0xF2, 0xC2, 0x56, 0xC6, 0xF5, 0x71, 0x6F, 0x91, 0x32,
+    0xCB, 0xFC, 0xE3, 0x3D, 0x9E, 0xA0, 0x4E, 0xC3, 0x37, 0xFD, 0xD2, 0xA9, 0x91, 0xF4, 0x7E, 0x70,
+    0x49, 0x03, 0xF2, 0x3E, 0x2E, 0x92, 0xD7, 0xB1, 0xEF, 0x5A, 0x88, 0x39, 0x28, 0x11, 0x07, 0xE7,
+    0x05, 0xBC, 0x8F, 0x99, 0xAD, 0xD8, 0xA5, 0xA6, 0xCA, 0x4D, 0x75, 0xD9, 0xEC, 0xF0, 0xF3, 0x5F,
+    0xE5, 0xFF, 0x46, 0x97, 0x68, 0x53, 0x37, 0x33, 0x33, 0xBB, 0xD8, 0xD0, 0x6D, 0x6A, 0x82, 0x59,
+    0xB4, 0x13, 0xB1, 0x25, 0x57, 0xA5, 0x7F, 0xBC, 0x7F, 0xFF, 0x73, 0x76, 0x06, 0xD9, 0xF0, 0x45,
+    0x57, 0x6E, 0xF1, 0xF1, 0x26, 0x83, 0xC0, 0x6E, 0x78, 0x76, 0xC1, 0xDE, 0x3D, 0x2E, 0x77, 0x78,
+    0xF6, 0xC2, 0xA1, 0x77, 0x51, 0x6D, 0x30, 0x3B, 0xA2, 0xEB, 0x51, 0xE6, 0x60, 0x6D, 0x8F, 0xF0,
+    0x89, 0xDD, 0x19, 0x4A, 0x2B, 0x51, 0xD8, 0x41, 0x2D, 0xCA, 0x9B, 0x7D, 0x79, 0x51, 0xE4, 0x9D,
+    0x82, 0x99, 0xAB, 0x82, 0x4F, 0x13, 0xC5, 0x37, 0x13, 0xAC, 0xE3, 0x42, 0x76, 0x93, 0xA3, 0x77,
+    0x71, 0x21, 0x3A, 0x94, 0x59, 0x49, 0x94, 0x7F, 0x6D, 0x73, 0xA2, 0x5F, 0xC0, 0xF7, 0xDC, 0xB6,
+    0xFF, 0xBA, 0xCB, 0x63, 0x85, 0x79, 0xA1, 0xBC, 0xFB, 0x3D, 0x2C, 0x56, 0xA4, 0x63, 0x9C, 0xC7,
+    0x50, 0x39, 0x8C, 0x54, 0x5A, 0x88, 0x3D, 0xAC, 0x03, 0xC1, 0x46, 0xA4, 0x1E, 0x9F, 0xE9, 0x3D,
+    0x47, 0x03, 0xA2, 0x12, 0x23, 0xBB, 0xA5, 0xA0, 0x7B, 0xD1, 0x24, 0x51, 0x29, 0x41, 0x0D, 0xDB,
+    0xB5, 0x14, 0x33, 0x25, 0xC7, 0x1B, 0x5D, 0x4F, 0xEA, 0x76, 0x20, 0x72, 0x7A, 0x07, 0x37, 0x52,
+    0x44, 0x84, 0xCC, 0xBA, 0x18, 0xC1, 0xB0, 0x0C, 0xD1, 0x80, 0xCF, 0x4D, 0x81, 0xAB, 0x16, 0x73,
+    0xAB, 0xB4, 0x85, 0xBE, 0x23, 0xD2, 0xA0, 0xA1, 0x32, 0x18, 0x1A, 0x0D, 0x9E, 0xAC, 0x8E, 0x0B,
+    0xD4, 0xE7, 0x0F, 0xE5, 0xCC, 0x91, 0x3C, 0x02, 0x2B, 0x64, 0xC5, 0x4A, 0x07, 0x84, 0xB3, 0x33,
+    0x0E, 0x11, 0x4F, 0x01, 0x7E, 0xAE, 0x56, 0xA5, 0x91, 0x38, 0xB9, 0x3C, 0x1D, 0xB2, 0xC1, 0x38,
+    0x42, 0x32, 0x45, 0xD5, 0xC9, 0x6C, 0xA8, 0x15, 0x2D, 0x05, 0x47, 0x51, 0x9D, 0x7D, 0x71, 0x54,
+    0x1D, 0xC0, 0xA0, 0x11, 0x5F, 0x2F, 0xEA, 0x1E, 0x15, 0x61, 0x88, 0x28, 0x59, 0x6F, 0x68, 0x07,
+    0x9C, 0xEA, 0x70, 0xE6, 0xE1, 0xB4, 0xCC, 0x34, 0xA9, 0x60, 0xD7, 0x5A, 0xF8, 0xF4, 0x5A, 0x1E,
+    0xA6, 0x81, 0xB9, 0x64, 0x2B, 0xD8, 0x37, 0x7D, 0x29, 0x08, 0xD5, 0xE3, 0x0A, 0xF6, 0x89, 0x22,
+    0xE5, 0xEE, 0x2A, 0x58, 0x36, 0xEF, 0xB6, 0x6F, 0xD3, 0x59, 0xBE, 0xCC, 0xB9, 0x8D, 0x48, 0xAD,
+    0x63, 0x7C, 0x23, 0x5B, 0x40, 0x6A, 0x76, 0x1A, 0x91, 0xFA, 0x62, 0xB5, 0x3B, 0x41, 0xB5, 0x1B,
+    0xB9, 0xA7, 0x51, 0xB5, 0xFB, 0x49, 0x78, 0x29, 0xF3, 0x12, 0x91, 0x54, 0xBB, 0x6B, 0xE9, 0x71,
+    0xE2, 0x9A, 0x37, 0xF3, 0xA9, 0x5F, 0x6B, 0xC5, 0xDA, 0xAB, 0xD9, 0x93, 0x75, 0x1B, 0x38, 0xF4,
+    0x2D, 0x7A, 0x29, 0xA4, 0x43, 0xF3, 0x96, 0xE0, 0x74, 0x82, 0x1B, 0x48, 0x17, 0x34, 0x1C, 0x7A,
+    0xBA, 0xF0, 0x2B, 0xBC, 0xDA, 0x43, 0x03, 0x0E, 0x37, 0x55, 0xC0, 0x4B, 0x61, 0x00, 0xD1, 0xBC,
+    0x32, 0xA7, 0x55, 0xED, 0x7E, 0x8E, 0x5B, 0x87, 0x99, 0x39, 0xD5, 0xDD, 0x44, 0x32, 0xF6, 0xCD,
+    0x77, 0x74, 0x86, 0x3D, 0x24, 0xC6, 0xFE, 0x8C, 0xCC, 0xB0, 0x2B, 0xD2, 0x50, 0xB9, 0x90, 0x63,
+    0x81, 0xFF, 0xD3, 0x86, 0xC8, 0xC9, 0x6C, 0xAE, 0xCA, 0x5C, 0xA3, 0x3E, 0xD1, 0x98, 0x67, 0x58,
+    0x98, 0xE0, 0x9A, 0xCF, 0x64, 0x35, 0xC4, 0xBB, 0x72, 0xDF, 0x4B, 0x2E, 0x8D, 0x53, 0xAF, 0xD6,
+    0x14, 0xF7, 0x13, 0xF0, 0xAC, 0xA8, 0x4A, 0x0C, 0x63, 0x1E, 0xC1, 0xF9, 0xC1, 0x6D, 0x64, 0xD2,
+    0x67, 0x28, 0xA5, 0xF7, 0x6B, 0x35, 0xDC, 0xA1, 0x94, 0x1E, 0x7D, 0x8A, 0x52, 0xFA, 0xF2, 0xD1,
+    0xB4, 0x16, 0x4E, 0xC2, 0x03, 0x1B, 0x20, 0x68, 0x88, 0x00, 0x9F, 0x45, 0xD2, 0xE6, 0x12, 0x26,
+    0xD0, 0x38, 0x50, 0xA0, 0xB3, 0xEA, 0x46, 0xBE, 0xD5, 0x57, 0xDD, 0x43, 0x24, 0xDC, 0xE3, 0x9F,
+    0x73, 0x2B, 0x77, 0xF8, 0x09, 0xF6, 0xD3, 0xF6, 0x11, 0x8A, 0x9E, 0x5B, 0xD6, 0x84, 0xBC, 0x6F,
+    0xD5, 0x5D, 0x17, 0x4B, 0x90, 0x0A, 0xA8, 0x0F, 0xCE, 0xE6, 0x45, 0x87, 0xDE, 0x6A, 0xF6, 0xEB,
+    0x89, 0x9C, 0x91, 0x44, 0x5E, 0xB1, 0xFB, 0xDC, 0x22, 0x6D, 0x2C, 0xD4, 0xAD, 0x62, 0xFD, 0x93,
+    0x46, 0xC1, 0xFE, 0x64, 0xA6, 0xF2, 0x36, 0x53, 0x85, 0xBB, 0xA3, 0x1E, 0xEF, 0x1E, 0xF0, 0x1E,
+    0x71, 0x1B, 0x19, 0x66, 0x64, 0x91, 0x24, 0x0B, 0xEC, 0xF1, 0xF6, 0xFC, 0xBC, 0x85, 0x9E, 0x2C,
+    0xF6, 0x43, 0xFB, 0x16, 0x7D, 0x85, 0xBF, 0xA1, 0x1E, 0x7F, 0x19, 0x00, 0x31, 0x34, 0x4D, 0xFE,
+    0x99, 0x8C, 0x80, 0x7E, 0x08, 0x0C, 0x63, 0x60, 0x18, 0x04, 0x1B, 0xB7, 0xE6, 0xE5, 0x16, 0x19,
+    0xFE, 0x56, 0x50, 0xED, 0xDC, 0x13, 0x77, 0x12, 0x5B, 0x88, 0x61, 0xCA, 0x18, 0x33, 0x24, 0x0C,
+    0x72, 0x58, 0x00, 0xE5, 0x38, 0x03, 0xCC, 0x06, 0xB5, 0xDC, 0xB8, 0x06, 0x83, 0xB8, 0x29, 0x8E,
+    0xA3, 0x40, 0x4D, 0xDD, 0x40, 0x6B, 0x6A, 0x47, 0x54, 0xAF, 0x08, 0xE0, 0xF6, 0xC9, 0x58, 0x9A,
+    0x97, 0xA1, 0x42, 0x02, 0x3A, 0x01, 0xF5, 0xC4, 0xC2, 0x6E, 0x71, 0xB7, 0xC0, 0xEF, 0xF5, 0xF8,
+    0x58, 0x48, 0x63, 0x5B, 0x38, 0x08, 0x6D, 0x0E, 0xA7, 0x1F, 0xBD, 0xBA, 0xDA, 0x95, 0x16, 0x66,
+    0xF0, 0x19, 0xC2, 0xF6, 0xD5, 0x64, 0x2E, 0x1C, 0x15, 0x8D, 0x15, 0x4C, 0x33, 0x5A, 0xED, 0x7B,
+    0x7E, 0xC5, 0xB0, 0x0D, 0x6E, 0xD1, 0xD8, 0x7A, 0xD2, 0xB9, 0x7E, 0xDE, 0x86, 0x76, 0x1F, 0x25,
+    0x56, 0x05, 0x8F, 0x52, 0x64, 0x73, 0x4F, 0x8A, 0xDC, 0xE2, 0x4C, 0x62, 0x2D, 0x35, 0x2C, 0x2D,
+    0x62, 0xD9, 0xC5, 0xCE, 0x9A, 0x56, 0xB6, 0x01, 0x36, 0x4A, 0x0A, 0x76, 0x05, 0xB8, 0xAD, 0x62,
+    0x55, 0x2B, 0x86, 0x3B, 0x0A, 0x4B, 0xE2, 0x58, 0x65, 0x57, 0xB5, 0x98, 0x00, 0x37, 0x82, 0xB4,
+    0xC2, 0x84, 0x3D, 0x8A, 0x4C, 0x18, 0x0E, 0x74, 0x36, 0xF5, 0xF4, 0x16, 0x6D, 0x30, 0x65, 0x88,
+    0xF0, 0x4E, 0xC7, 0xB1, 0x84, 0xF7, 0x17, 0x83, 0x76, 0x32, 0x94, 0xF5, 0x9D, 0xA1, 0x54, 0xBE,
+    0x2A, 0x68, 0x9E, 0x35, 0x2B, 0x3A, 0x38, 0x86, 0x3B, 0x8B, 0x16, 0xC8, 0x9F, 0x2D, 0x9E, 0x2F,
+    0x24, 0xB3, 0x56, 0x12, 0x35, 0xEB, 0x3E, 0xA9, 0x27, 0x25, 0x4E, 0x95, 0x3D, 0x96, 0xEB, 0xB2,
+    0x34, 0x5B, 0xFC, 0xD1, 0x93, 0xA2, 0xA9, 0x40, 0x98, 0xAA, 0xE7, 0x9B, 0x61, 0x18, 0x00, 0x2D,
+    0x83, 0x74, 0xA2, 0xDF, 0xB2, 0x57, 0xFA, 0x31, 0x47, 0x1A, 0x58, 0x88, 0x32, 0x05, 0x3A, 0x5D,
+    0xBF, 0x8C, 0xBD, 0xDF, 0xB6, 0x68, 0xC8, 0x0C, 0x68, 0x31, 0x9F, 0xFA, 0xCC, 0xF0, 0x90, 0x4E,
+    0x46, 0x4D, 0xEF, 0xAB, 0x91, 0x00, 0x24, 0xAC, 0x58, 0xB4, 0x51, 0xC5, 0xCC, 0xA5, 0x55, 0xD8,
+    0xFE, 0xF0, 0x5E, 0xE5, 0x1B, 0xF3, 0x21, 0x16, 0xBC, 0x3F, 0x33, 0x2C, 0x78, 0xD7, 0x35, 0x45,
+    0xE3, 0xF5, 0x22, 0xEA, 0x84, 0x8A, 0xA3, 0x2A, 0x4B, 0x59, 0xC8, 0x8C, 0x7F, 0x8E, 0xD0, 0xCC,
+    0x8F, 0xA3, 0xAA, 0xFF, 0x81, 0x08, 0xD1, 0x77, 0x47, 0x3D, 0xA3, 0x75, 0xC2, 0xC4, 0x3D, 0x18,
+    0x7E, 0x8E, 0xA3, 0x89, 0xCF, 0xE9, 0x51, 0x89, 0xCF, 0x93, 0x46, 0x68, 0x6F, 0x1E, 0xAD, 0x0E,
+    0xA1, 0x90, 0x75, 0x2A, 0x27, 0xD9, 0x38, 0x8B, 0x33, 0x5F, 0x73, 0x24, 0x4B, 0x92, 0xC1, 0xBD,
+    0xC2, 0xD0, 0x8A, 0x84, 0xDE, 0x6D, 0x64, 0xF7, 0xC7, 0x5A, 0x76, 0x7F, 0xAD, 0x64, 0x67, 0x54,
+    0x7A, 0x2D, 0xA9, 0x10, 0xFF, 0x2F, 0x3B, 0x45, 0x86, 0x52, 0xAB, 0xE7, 0x32, 0x11, 0x9F, 0x82,
+    0x63, 0xD1, 0x11, 0x78, 0xD0, 0x33, 0xA3, 0x3A, 0xEC, 0xB2, 0xAD, 0xA2, 0xD9, 0x59, 0xE3, 0xBE,
+    0x35, 0x94, 0x47, 0xFB, 0x72, 0x76, 0x3F, 0x67, 0x6C, 0x82, 0xB1, 0xCF, 0x20, 0x26, 0xC3, 0x75,
+    0xEB, 0xA1, 0xA5, 0x0A, 0x55, 0x27, 0xBB, 0x7F, 0x36, 0xB2, 0x33, 0x33, 0xDD, 0x15, 0xB2, 0x9B,
+    0x59, 0x34, 0xFF, 0xBB, 0x5D, 0xA0, 0x3B, 0x28, 0x69, 0x01, 0x52, 0xF4, 0x36, 0xA2, 0x5C, 0x01,
+    0x53, 0xD6, 0x01, 0x7C, 0x28, 0xCA, 0x1A, 0x80, 0x52, 0x0F, 0xA9, 0x0D, 0x03, 0x03, 0xE5, 0xDA,
+    0x6D, 0x16, 0x82, 0x40, 0xDB, 0x01, 0x5B, 0x84, 0x18, 0xAD, 0x9F, 0x3B, 0x55, 0xA0, 0x5E, 0xC9,
+    0xC6, 0x81, 0xB0, 0x86, 0x7A, 0x83, 0xDF, 0x6C, 0x05, 0xA2, 0xEB, 0xA1, 0x91, 0x1D, 0x5D, 0x07,
+    0x50, 0x29, 0x57, 0x3B, 0x6A, 0x6C, 0xA5, 0xC8, 0x76, 0xE2, 0xF6, 0xB8, 0x4B, 0x97, 0x67, 0xE3,
+    0x3A, 0x53, 0xA4, 0xB7, 0x36, 0x4F, 0x1B, 0xB6, 0xA2, 0x53, 0x49, 0xAA, 0xC6, 0xD4, 0xEB, 0x55,
+    0x5B, 0x52, 0x1A, 0x62, 0x22, 0x9B, 0x72, 0xB6, 0x63, 0xDE, 0xE2, 0xFE, 0xCE, 0x7A, 0x20, 0xCD,
+    0x73, 0x72, 0x47, 0x56, 0x7D, 0x4B, 0xC2, 0x3C, 0x35, 0xBF, 0x44, 0x5F, 0xEA, 0x89, 0x58, 0xCB,
+    0xCA, 0xED, 0xAC, 0x22, 0x3A, 0x9D, 0xF3, 0x56, 0x7D, 0x7E, 0xCA, 0x4B, 0x84, 0xBE, 0xEC, 0xF5,
+    0xDF, 0x00, 0xA4, 0xEF, 0xE7, 0xAD, 0xAC, 0x1B, 0x8A, 0xEA, 0x3E, 0x69, 0xB5, 0x16, 0x13, 0xF6,
+    0xF4, 0x59, 0x4A, 0xBB, 0x59, 0x4F, 0x32, 0xCE, 0xC6, 0x99, 0x28, 0x7B, 0x76, 0xE1, 0x70, 0xDE,
+    0x78, 0x6D, 0xA0, 0x9A, 0xA7, 0x85, 0x6D, 0x3E, 0xB8, 0x59, 0x30, 0x1A, 0x3B, 0x23, 0xD3, 0xAA,
+    0x96, 0xD5, 0x3E, 0xD0, 0x8D, 0xBA, 0xA9, 0x3F, 0x6A, 0x3E, 0xBC, 0x28, 0xFD, 0x8E, 0xE8, 0x64,
+    0x48, 0x00, 0x6B, 0x33, 0x10, 0x7E, 0x61, 0xE9, 0x66, 0x0B, 0x66, 0xD9, 0x38, 0x73, 0xC0, 0x82,
+    0xC4, 0x72, 0x23, 0xBC, 0x77, 0xE2, 0x7F, 0x68, 0xDA, 0x5C, 0x56, 0xE2, 0x30, 0x6E, 0xF8, 0x40,
+    0xF8, 0x3E, 0x3E, 0xE6, 0xFF, 0x4B, 0xDC, 0x68, 0xF1, 0x98, 0x1D, 0x23, 0x9A, 0x4E, 0x95, 0xA0,
+    0x7E, 0xFD, 0x2B, 0x50, 0xB1, 0x97, 0x93, 0x61, 0x25, 0x9F, 0x76, 0xBA, 0x19, 0xAC, 0xE4, 0xF9,
+    0x71, 0x77, 0x72, 0xBB, 0xA4, 0xDD, 0xAB, 0xE3, 0x4C, 0x17, 0xBA, 0xEB, 0x2F, 0x5F, 0xF1, 0x33,
+    0x42, 0x59, 0x09, 0x1F, 0x63, 0x51, 0x7C, 0x9C, 0x70, 0x97, 0x72, 0x34, 0xD2, 0x41, 0x02, 0x8D,
+    0xFE, 0x6A, 0x8D, 0xE2, 0x67, 0xB0, 0xAC, 0xFE, 0xA7, 0x40, 0xE4, 0x4F, 0x58, 0x2D, 0x8F, 0x4A,
+    0x97, 0x8F, 0x02, 0x89, 0x27, 0x8B, 0x91, 0xCD, 0x20, 0xD1, 0xB6, 0x37, 0x72, 0xC2, 0x8B, 0x94,
+    0xE5, 0xC5, 0x2D, 0x45, 0xC2, 0xF6, 0x0F, 0x78, 0x56, 0x94, 0x42, 0x5A, 0xAE, 0x87, 0x7C, 0x17,
+    0xB6, 0x85, 0x08, 0x6D, 0xF4, 0xCC, 0xD6, 0xD2, 0x24, 0xBC, 0x05, 0x09, 0xA7, 0x90, 0x30, 0xF3,
+    0x83, 0x30, 0x87, 0x25, 0xBC, 0x35, 0x92, 0xF0, 0x97, 0xC6, 0x6A, 0xF5, 0xF1, 0x62, 0xB5, 0x35,
+    0x40, 0x47, 0x3C, 0x0A, 0xEF, 0x3F, 0x59, 0x9E, 0xB2, 0x92, 0xF3, 0x80, 0x36, 0x12, 0x2C, 0x02,
+    0x9C, 0xD4, 0x70, 0x82, 0xD4, 0x6F, 0x60, 0xB7, 0x21, 0xE9, 0xBD, 0x86, 0x2F, 0x8C, 0xC3, 0x35,
+    0x40, 0x46, 0xFC, 0x01, 0xF6, 0x06, 0xD4, 0x17, 0x10, 0x4F, 0x40, 0xFC, 0x00, 0x67, 0xB1, 0x27,
+    0x2B, 0x07, 0xC5, 0xE7, 0xC5, 0x59, 0x31, 0xAF, 0xDC, 0xC6, 0x11, 0x1E, 0x92, 0x7A, 0x62, 0x2C,
+    0x16, 0x54, 0xE1, 0x17, 0xD8, 0x11, 0x20, 0x36, 0x69, 0x2C, 0x44, 0xE2, 0x1F, 0xD0, 0x3B, 0xD2,
+    0x49, 0xE1, 0x22, 0x85, 0x55, 0x48, 0x40, 0x00, 0x15, 0x6A, 0x52, 0x04, 0xCF, 0x85, 0x5D, 0xC4,
+    0x80, 0x12, 0x48, 0x8F, 0x14, 0x5C, 0xB8, 0x55, 0xE3, 0xD4, 0x2A, 0x5C, 0xC8, 0x17, 0x20, 0x72,
+    0xE1, 0xE2, 0x05, 0xB8, 0x13, 0x19, 0xB8, 0x48, 0x4B, 0x04, 0x48, 0x1D, 0xA6, 0x49, 0x91, 0x34,
+    0x0C, 0x72, 0x49, 0x18, 0x89, 0x77, 0x9B, 0xEF, 0x9B, 0x25, 0x79, 0xBC, 0x27, 0x5B, 0xB6, 0xA5,
+    0xE7, 0x84, 0xB8, 0x5D, 0x2E, 0x97, 0xB3, 0xB3, 0xB3, 0xB3, 0x33, 0xDF, 0xCC, 0xF2, 0xE4, 0x9A,
+    0xC8, 0x67, 0x22, 0x97, 0xE5, 0xF0, 0x51, 0x6A, 0x4C, 0xDE, 0x5C, 0x94, 0xE6, 0xB6, 0x34, 0x0F,
+    0xA4, 0x91, 0x97, 0xFD, 0x3D, 0x10, 0x71, 0x52, 0xF1, 0x73, 0xB9, 0x28, 0x72, 0x34, 0x4F, 0x0B,
+    0x53, 0x5E, 0xF6, 0xCA, 0xE0, 0x47, 0xA5, 0xFB, 0x41, 0x29, 0xDE, 0xCB, 0xFF, 0xF2, 0xC3, 0xF9,
+    0xFD, 0xC2, 0xD4, 0xF8, 0xED, 0xDF, 0x48, 0xA7, 0xED, 0xCC, 0x18, 0xD3, 0x16, 0xA8, 0x3A, 0xB6,
+    0xBA, 0xC3, 0xB9, 0xBD, 0x1E, 0xB2, 0x8B, 0x57, 0x37, 0x36, 0xF6, 0x6F, 0xD8, 0xEB, 0xFA, 0x1B,
+    0xF2, 0xFA, 0x4C, 0x92, 0xFF, 0xE5, 0x4F, 0xFA, 0x2B, 0x81, 0x1C, 0xA9, 0x56, 0x14, 0x46, 0xB6,
+    0xD7, 0x89, 0x17, 0x4E, 0xE3, 0x35, 0x7E, 0x1D, 0x54, 0x61, 0x19, 0x95, 0x49, 0x9E, 0xE4, 0x59,
+    0xBA, 0x2F, 0x61, 0x1D, 0xD6, 0x51, 0x15, 0x97, 0x71, 0x9E, 0x80, 0xE1, 0x5D, 0x59, 0xC8, 0x75,
+    0xC9, 0xD2, 0x2C, 0x4D, 0xF2, 0x18, 0x54, 0x61, 0x15, 0x54, 0x5E, 0xED, 0x36, 0x72, 0x2D, 0xAC,
+    0x93, 0x3C, 0xAC, 0xB3, 0x34, 0xAA, 0x32, 0x89, 0xCB, 0x42, 0x92, 0x7C, 0x03, 0xFA, 0x4E, 0x12,
+    0xA7, 0x95, 0xBB, 0xCE, 0x4A, 0x16, 0x20, 0xBA, 0x8E, 0xAD, 0xCA, 0x9C, 0x4E, 0xB2, 0x37, 0xD7,
+    0xFA, 0x3E, 0x2E, 0x37, 0x12, 0x95, 0x99, 0x84, 0x65, 0x22, 0x41, 0x15, 0xA7, 0x5E, 0x1D, 0xE5,
+    0x6E, 0x13, 0x96, 0x72, 0x0D, 0x84, 0xE7, 0x72, 0xC1, 0x4B, 0xC1, 0xCB, 0x49, 0x41, 0x5F, 0x90,
+    0xCB, 0xF9, 0x20, 0x7D, 0xB5, 0xB0, 0x3A, 0xEE, 0x0E, 0x6F, 0xFE, 0xEA, 0xA1, 0x04, 0xA9, 0xF6,
+    0x8F, 0x25, 0x1C, 0x4A, 0xF9, 0xFC, 0x12, 0x0D, 0xA5, 0xB2, 0x85, 0x73, 0x86, 0xD5, 0x2E, 0x4D,
+    0x50, 0x2A, 0x4F, 0xF3, 0xE8, 0x6F, 0x1D, 0xB7, 0x93, 0x77, 0x3B, 0xC7, 0x94, 0xD7, 0xC9, 0x31,
+    0xB9, 0xDC, 0x08, 0xEE, 0xFD, 0x44, 0xE9, 0x51, 0xD8, 0x7E, 0x76, 0x4C, 0x3F, 0xEF, 0x35, 0x09,
+    0xA0, 0x05, 0x93, 0x27, 0xA6, 0x9C, 0xFE, 0x22, 0x93, 0xBA, 0x6B, 0xEE, 0xD1, 0xCF, 0x45, 0x32,
+    0xFC, 0x6A, 0xC9, 0x36, 0x92, 0x99, 0x8A, 0xBF, 0x8D, 0x3E, 0xA6, 0x7C, 0x85, 0xEB, 0x75, 0x29,
+    0x52, 0x93, 0x9B, 0xBC, 0x48, 0x5F, 0x93, 0x3D, 0xF0, 0x4B, 0x4A, 0xAF, 0xCB, 0x2A, 0x6F, 0x9D,
+    0xB0, 0xA0, 0xCD, 0xBE, 0x3D, 0x49, 0xCA, 0xAC, 0x4A, 0xAA, 0xA4, 0xDC, 0x93, 0xC3, 0x79, 0x6E,
+    0x4C, 0xF9, 0xF2, 0xAE, 0x37, 0xFE, 0x3E, 0x15, 0x99, 0xCF, 0xE1, 0xD7, 0xA7, 0xE2, 0x71, 0x5B,
+    0xD7, 0xEB, 0x17, 0xFB, 0xCC, 0xEF, 0x54, 0x84, 0x06, 0x9F, 0x5F, 0xCE, 0xF3, 0xF7, 0x44, 0xC6,
+    0xDF, 0xFB, 0x74, 0xEA, 0x53, 0x63, 0x7E, 0x69, 0x8E, 0xAD, 0xDD, 0xFE, 0xF6, 0x6F, 0x9C, 0x9A,
+    0xE4, 0x93, 0xCB, 0x31, 0xB0, 0xA9, 0x85, 0x36, 0x7D, 0x83, 0x37, 0xAD, 0x36, 0xC3, 0x3F, 0x74,
+    0xE2, 0x5A, 0xBA, 0x28, 0x5D, 0x88, 0x5F, 0x5B, 0x57, 0x97, 0x99, 0x9A, 0x5C, 0xDF, 0x8C, 0x72,
+    0x6D, 0x12, 0x24, 0x7A, 0x98, 0x98, 0xA9, 0x7B, 0x8F, 0xCD, 0x6E, 0x6C, 0xBA, 0xAB, 0xB1, 0xE9,
+    0xD5, 0xFB, 0x22, 0x7B, 0x29, 0x39, 0x04, 0xBF, 0x33, 0xB0, 0xC1, 0x56, 0x62, 0xB9, 0x1B, 0x7E,
+    0x68, 0x5A, 0xC7, 0x6C, 0xE0, 0x71, 0x5D, 0x12, 0x56, 0x6B, 0x6F, 0x95, 0xA4, 0xC1, 0xD3, 0xF6,
+    0x28, 0xCC, 0x67, 0x5E, 0x1D, 0xE6, 0x9E, 0xA9, 0xBB, 0x28, 0x4D, 0x7C, 0xA0, 0x8A, 0x1C, 0x3A,
+    0xAB, 0x58, 0xE2, 0xA0, 0xA4, 0x4F, 0x79, 0x4D, 0x2C, 0xD1, 0x8F, 0x4B, 0x9F, 0xEE, 0x52, 0x25,
+    0x12, 0xBD, 0x5D, 0xFA, 0xEA, 0x45, 0x63, 0x13, 0x94, 0x03, 0xC1, 0x4C, 0xC6, 0x61, 0x9D, 0x0C,
+    0xCC, 0x00, 0x2C, 0xFD, 0x14, 0xE0, 0x05, 0x1E, 0x6B, 0x17, 0x13, 0x0B, 0x46, 0x7A, 0xA6, 0x15,
+    0x88, 0xA3, 0xCB, 0x85, 0x90, 0x89, 0x55, 0x0B, 0x7D, 0x03, 0xB0, 0xB2, 0x7B, 0xA9, 0x06, 0xEF,
+    0x0E, 0x4F, 0x01, 0x95, 0xD8, 0x0D, 0x4F, 0xE1, 0x5F, 0x3A, 0x71, 0x56, 0xC3, 0x53, 0x9C, 0x2E,
+    0x39, 0xCD, 0x00, 0x9C, 0x10, 0x29, 0xA8, 0xB6, 0x4F, 0x89, 0xC2, 0xCD, 0x56, 0x7B, 0xF1, 0x38,
+    0xC3, 0x91, 0xD2, 0x4E, 0x9F, 0xBA, 0xE9, 0xD3, 0x76, 0x02, 0xD5, 0x6F, 0x03, 0xE5, 0x3A, 0x08,
+    0x96, 0xD7, 0xC9, 0xD3, 0xAF, 0x8A, 0x95, 0xC4, 0x6B, 0x88, 0x95, 0xC6, 0x72, 0x14, 0x7E, 0x6E,
+    0xD6, 0x52, 0xA0, 0x69, 0xAA, 0xA8, 0xEC, 0xE2, 0xB7, 0x9A, 0xC2, 0x59, 0x03, 0xA6, 0xDF, 0x6A,
+    0x42, 0xD3, 0xCE, 0xC2, 0x32, 0xFE, 0xE1, 0x2A, 0xA8, 0x96, 0x4E, 0x0B, 0x75, 0x2F, 0x80, 0xDF,
+    0x1F, 0x34, 0x5E, 0xDD, 0x61, 0xAA, 0xC3, 0xB4, 0x8D, 0xF2, 0xF0, 0xF3, 0xDA, 0x6B, 0xF8, 0x84,
+    0x15, 0xE0, 0xE9, 0xF7, 0xC3, 0x93, 0x5F, 0x45, 0xA9, 0x3E, 0xB5, 0xB4, 0x22, 0x8C, 0x9A, 0x3C,
+    0x45, 0xE9, 0x74, 0x1C, 0xD7, 0xB7, 0x7D, 0x5A, 0xCA, 0x64, 0x06, 0x58, 0xDD, 0x76, 0x76, 0x1A,
+    0x9E, 0xDF, 0x14, 0x62, 0x25, 0x13, 0xAF, 0x16, 0xD7, 0x4A, 0x1D, 0x61, 0x23, 0xB8, 0x1F, 0x76,
+    0x45, 0xBE, 0x49, 0xC7, 0x2D, 0xD1, 0xD5, 0x42, 0xBD, 0x44, 0xB9, 0x35, 0x37, 0x15, 0x5A, 0xC6,
+    0x26, 0x82, 0x38, 0xA2, 0x4E, 0xE4, 0x8E, 0x2A, 0xBF, 0x95, 0xCC, 0x5B, 0xC9, 0xDA, 0x6F, 0x9C,
+    0x36, 0x2C, 0xB9, 0x0A, 0xBF, 0x8A, 0x41, 0x73, 0x00, 0xA2, 0x63, 0x50, 0x35, 0x72, 0xC7, 0xAD,
+    0x94, 0x0E, 0xBB, 0x92, 0xB9, 0x2B, 0x8C, 0x5E, 0xC3, 0xC0, 0x52, 0xA7, 0x0D, 0x60, 0x50, 0x5E,
+    0x13, 0xE6, 0x70, 0x04, 0x8C, 0xA0, 0xAC, 0x07, 0x90, 0x11, 0xA3, 0xBC, 0x8A, 0xE3, 0x80, 0xCA,
+    0x18, 0x19, 0x72, 0x4D, 0x74, 0x84, 0x38, 0xE7, 0xC4, 0x70, 0x19, 0xD7, 0xBA, 0xD3, 0x1D, 0x15,
+    0x21, 0x94, 0x25, 0xBA, 0xB0, 0x3B, 0x12, 0xDF, 0x23, 0x87, 0x0E, 0x14, 0x33, 0x90, 0x60, 0x97,
+    0x5B, 0xEC, 0xFB, 0x1D, 0x98, 0xE8, 0xCC, 0xC5, 0xFA, 0xA4, 0x01, 0xDD, 0x91, 0x90, 0x92, 0xBC,
+    0xEE, 0x41, 0xF5, 0xA4, 0x0E, 0xC8, 0x71, 0x46, 0x5D, 0x34, 0xB1, 0xF2, 0x0D, 0x73, 0xB2, 0xF6,
+    0x4B, 0x72, 0x77, 0xEB, 0x2B, 0x9C, 0xA0, 0x09, 0x7B, 0x13, 0xEC, 0xA3, 0x44, 0x0C, 0xAF, 0x3D,
+    0x00, 0xED, 0xF1, 0x31, 0x7C, 0xFE, 0xAA, 0xB8, 0xF5, 0x65, 0x80, 0x62, 0x88, 0xD7, 0x41, 0x1A,
+    0xA2, 0x75, 0x45, 0xBC, 0xEA, 0x00, 0xF1, 0x9A, 0x1A, 0x84, 0x04, 0xB0, 0xFB, 0x8D, 0xB8, 0x88,
+    0x4B, 0x0D, 0xC3, 0x19, 0x9E, 0x10, 0x1C, 0xE2, 0x92, 0x8F, 0x1E, 0x66, 0x82, 0x2B, 0xA0, 0x0B,
+    0x2F, 0x5E, 0x91, 0x33, 0xBA, 0x9E, 0x24, 0x67, 0xC4, 0x82, 0x3E, 0x11, 0x8B, 0xA5, 0xC0, 0x73,
+    0x49, 0xEA, 0x4C, 0x9C, 0x35, 0x3B, 0xC3, 0xDA, 0x3E, 0xC9, 0x77, 0x26, 0x7E, 0xA2, 0xDA, 0x39,
+    0x23, 0x21, 0x58, 0xE7, 0x72, 0xC0, 0xE1, 0xB8, 0x6F, 0x48, 0x9E, 0xE8, 0x1C, 0x6B, 0xBE, 0xAC,
+    0x75, 0x22, 0xB2, 0xD7, 0x88, 0x88, 0x79, 0x49, 0xC0, 0xD7, 0x64, 0x1D, 0x2A, 0x10, 0x31, 0x73,
+    0x50, 0x68, 0xAA, 0x36, 0x6A, 0x00, 0xFE, 0xBF, 0x5B, 0x0C, 0x4D, 0x72, 0x87, 0x70, 0x42, 0x49,
+    0xC0, 0xB7, 0x48, 0x71, 0x07, 0x5C, 0x22, 0x9B, 0x48, 0xBD, 0xA7, 0x2B, 0xB9, 0x42, 0x6F, 0xFC,
+    0xF3, 0xDA, 0xFA, 0x1A, 0xB2, 0x12, 0xDE, 0x37, 0x1A, 0xB8, 0xC9, 0xDC, 0xA7, 0x57, 0x82, 0x39,
+    0x17, 0xA3, 0x73, 0x67, 0x62, 0xE7, 0x06, 0x01, 0x5E, 0x5F, 0x21, 0x41, 0xC8, 0x78, 0x09, 0x02,
+    0x6C, 0x08, 0xF8, 0x1F, 0xC9, 0x59, 0x95, 0xF4, 0x35, 0x1B, 0x3E, 0x69, 0x60, 0x65, 0x54, 0x27,
+    0x5A, 0xC2, 0xA1, 0x20, 0xE7, 0x41, 0xC9, 0x77, 0x4A, 0x19, 0xE5, 0xEA, 0x25, 0x28, 0xC1, 0x58,
+    0xC2, 0xA1, 0x08, 0x8B, 0x8F, 0x08, 0xBB, 0x85, 0x99, 0x3D, 0x39, 0x9B, 0x92, 0x6F, 0x56, 0xC5,
+    0x4D, 0xC2, 0x82, 0xF6, 0x9E, 0xB8, 0xA9, 0xC5, 0x1E, 0x64, 0x40, 0xC6, 0x54, 0x89, 0xB9, 0xB5,
+    0x3A, 0x93, 0x60, 0xF7, 0x12, 0x68, 0x91, 0x18, 0x6C, 0xCB, 0x12, 0x65, 0x61, 0x53, 0x28, 0x6A,
+    0x19, 0x2B, 0x48, 0xB8, 0xAB, 0xD0, 0x42, 0xDC, 0x50, 0x60, 0x35, 0x56, 0xFA, 0x8D, 0x96, 0xBD,
+    0x13, 0xC0, 0xC6, 0x3E, 0x28, 0x51, 0xB2, 0xD2, 0xEA, 0x64, 0xCF, 0x26, 0x7B, 0x46, 0xAB, 0x4B,
+    0xC8, 0x54, 0x3F, 0xD1, 0xC5, 0xDF, 0xBF, 0x4A, 0x41, 0x6A, 0x1A, 0x9F, 0xA7, 0xF0, 0x1A, 0xA6,
+    0x84, 0x7B, 0xD8, 0x70, 0x91, 0xFA, 0xD8, 0xB7, 0x08, 0xF2, 0x81, 0xA0, 0xF8, 0x0F, 0x89, 0x0F,
+    0x3F, 0x56, 0x8C, 0x24, 0x64, 0x66, 0x1F, 0xDD, 0x6C, 0xE8, 0xAB, 0x90, 0x92, 0x50, 0x1D, 0x09,
+    0x39, 0xF8, 0xE5, 0x65, 0xD4, 0x6E, 0xFD, 0x03, 0x12, 0xD7, 0x53, 0x69, 0xBC, 0x3E, 0x8F, 0x82,
+    0xF9, 0xD0, 0xAB, 0x61, 0x40, 0xD6, 0xAF, 0x61, 0xDC, 0x8C, 0x68, 0xF0, 0x1D, 0xD8, 0x33, 0x19,
+    0x6C, 0x49, 0x18, 0x95, 0x68, 0x4C, 0x05, 0xFA, 0xFE, 0x51, 0x89, 0xFB, 0x77, 0xD8, 0x72, 0x05,
+    0x64, 0x28, 0x8F, 0x41, 0x72, 0x15, 0x24, 0x97, 0x19, 0xC5, 0xE4, 0xAA, 0x0E, 0x80, 0x88, 0x1F,
+    0x6F, 0x27, 0x6B, 0xC7, 0xA6, 0x3B, 0x69, 0x6E, 0x81, 0x76, 0x82, 0xB9, 0xCE, 0x88, 0xE8, 0x47,
+    0x6F, 0x36, 0x17, 0x7A, 0x40, 0x2F, 0x9E, 0xFC, 0xCB, 0x0C, 0x4D, 0x68, 0xAB, 0x5F, 0xC9, 0xDE,
+    0x3B, 0x9B, 0x8F, 0xC6, 0x40, 0xB1, 0x1E, 0x39, 0x44, 0xC5, 0x36, 0x9B, 0x8E, 0xCA, 0xA1, 0xB9,
+    0x09, 0x87, 0xF5, 0xBB, 0x6B, 0x7F, 0x98, 0xCE, 0xEB, 0xBC, 0x11, 0xFB, 0x3F, 0x73, 0x2C, 0x81,
+    0xF3, 0x50, 0x89, 0x1E, 0xB0, 0xA9, 0x2F, 0x35, 0xC6, 0x4C, 0x9A, 0x32, 0x69, 0xB6, 0x43, 0xF3,
+    0xFC, 0xB6, 0x39, 0x4B, 0x57, 0x17, 0x6A, 0xD9, 0xB8, 0x35, 0x10, 0x77, 0xF3, 0x04, 0x01, 0xCC,
+    0x3C, 0x7D, 0x6A, 0x4A, 0x1E, 0x4A, 0xD0, 0xC4, 0x55, 0x3A, 0x37, 0x37, 0xC0, 0xD7, 0xBD, 0x77,
+    0x59, 0xFB, 0x46, 0x03, 0x1B, 0x59, 0x86, 0x7F, 0xA2, 0x1B, 0x26, 0xF4, 0x95, 0xF8, 0x6D, 0xAE,
+    0xF6, 0x31, 0xCD, 0x29, 0xA3, 0x33, 0x39, 0x9D, 0x7A, 0x2F, 0x85, 0xF5, 0x3A, 0x60, 0x88, 0xDB,
+    0xC1, 0x7B, 0xC5, 0x5F, 0x51, 0xB1, 0xB7, 0x75, 0x63, 0x3F, 0xF5, 0xAA, 0xE9, 0xF6, 0x4E, 0x0F,
+    0x46, 0x36, 0x92, 0x49, 0x9F, 0x97, 0xB4, 0x83, 0xEC, 0xB4, 0x12, 0x9B, 0x7F, 0xC4, 0x36, 0xF2,
+    0xF5, 0x2B, 0xD3, 0xBD, 0xF0, 0xC8, 0x93, 0xF6, 0x61, 0xD3, 0x12, 0x4D, 0x48, 0x96, 0xC3, 0x70,
+    0xF7, 0x0B, 0x86, 0xCF, 0x76, 0x87, 0x37, 0xC3, 0xF0, 0x70, 0x1C, 0xBE, 0x4D, 0xA5, 0xB5, 0xE3,
+    0x2B, 0x7E, 0xF3, 0xFC, 0x45, 0x88, 0xE9, 0xBA, 0xFC, 0x11, 0xEC, 0xBE, 0xEA, 0xF7, 0x82, 0xC4,
+    0x83, 0x11, 0x01, 0x2A, 0xCE, 0x22, 0x90, 0xC2, 0x7B, 0x91, 0x47, 0x62, 0xEA, 0x8D, 0x69, 0x32,
+    0x14, 0x60, 0x5B, 0x7B, 0x20, 0xC1, 0xCA, 0x5A, 0x8C, 0xDB, 0xF5, 0x5A, 0x61, 0x59, 0x4F, 0xDA,
+    0x9D, 0x7D, 0xCF, 0xC2, 0x3D, 0x04, 0x9C, 0x48, 0xD8, 0xD8, 0x42, 0x8C, 0x60, 0x31, 0xC4, 0x23,
+    0xEE, 0x37, 0x74, 0xDD, 0xF6, 0xAF, 0x6B, 0x7B, 0x38, 0x1A, 0x60, 0x26, 0xE9, 0xB5, 0x9F, 0xF4,
+    0x85, 0x9B, 0xB0, 0xDF, 0x97, 0x93, 0xD7, 0x2B, 0x3D, 0xB0, 0x66, 0xB4, 0xA9, 0xDE, 0x8B, 0x89,
+    0x1B, 0xC3, 0x7D, 0xE8, 0x1F, 0xE8, 0xC6, 0x55, 0xFA, 0x2B, 0xAE, 0x31, 0x58, 0x71, 0x85, 0xFE,
+    0x8A, 0xEB, 0xF3, 0x75, 0x75, 0x0A, 0xF2, 0xB6, 0x5E, 0xDB, 0xB6, 0xA7, 0x96, 0xCA, 0xDA, 0x6B,
+    0x3D, 0x5D, 0x8D, 0xA7, 0xEB, 0x61, 0x6D, 0x68, 0x13, 0x58, 0x0B, 0xEA, 0x50, 0xB3, 0x10, 0x86,
+    0x82, 0x9A, 0xAB, 0x60, 0xAD, 0x06, 0x97, 0x28, 0xEC, 0xEC, 0x3F, 0x93, 0x13, 0x42, 0x22, 0xE7,
+    0x3E, 0xE5, 0x83, 0x56, 0x21, 0x6D, 0xD8, 0xF6, 0xB5, 0xED, 0xB1, 0x6F, 0x2D, 0xC2, 0x96, 0x67,
+    0x91, 0x67, 0x26, 0x65, 0xC1, 0x23, 0x74, 0x69, 0x08, 0xE4, 0xE5, 0x2F, 0x30, 0x1D, 0xB5, 0xE9,
+    0xAD, 0x88, 0xCF, 0x6E, 0x4B, 0xD5, 0x4D, 0x6B, 0xF4, 0xF3, 0x84, 0xDA, 0xD0, 0xCC, 0x63, 0x24,
+    0x5F, 0x84, 0x59, 0xD4, 0x38, 0xE8, 0xA1, 0x06, 0xFB, 0x48, 0xC3, 0x74, 0xC8, 0x04, 0x9B, 0xF5,
+    0x11, 0x33, 0x03, 0xA6, 0xA7, 0xA1, 0xC2, 0x25, 0x30, 0xFC, 0xD5, 0x5D, 0x35, 0xDB, 0x1E, 0x06,
+    0x4B, 0xA8, 0xB3, 0x72, 0x90, 0x55, 0x25, 0x15, 0xB7, 0xD1, 0xF6, 0x4C, 0xE8, 0x89, 0x63, 0x2B,
+    0xAD, 0x70, 0xD0, 0xBF, 0xA9, 0x01, 0xB3, 0xB2, 0x11, 0xB2, 0xF7, 0x97, 0xC7, 0x03, 0xEA, 0xD0,
+    0x38, 0x98, 0x38, 0xF4, 0xEE, 0xA6, 0xC1, 0x9A, 0x20, 0xA1, 0x06, 0xA5, 0x78, 0x3A, 0xC4, 0x5B,
+    0x1B, 0x84, 0x14, 0xA4, 0x35, 0xDC, 0x5E, 0x9A, 0x7F, 0x82, 0xEC, 0xC0, 0xC0, 0x4C, 0x8F, 0x1E,
+    0x21, 0x48, 0xDC, 0xF6, 0x01, 0x9D, 0xAC, 0x1A, 0x56, 0x2B, 0x56, 0x2D, 0xAB, 0xEE, 0xB9, 0x55,
+    0x3B, 0x12, 0xEB, 0xB0, 0x8A, 0x55, 0x8A, 0xAA, 0x95, 0xDB, 0x3E, 0x44, 0x39, 0x9D, 0xCA, 0x5E,
+    0x10, 0xB5, 0xF5, 0xF9, 0x19, 0x27, 0x34, 0xE6, 0x8F, 0x2D, 0xCC, 0x2E, 0x3F, 0xCE, 0x58, 0x15,
+    0xAC, 0xCC, 0x73, 0xAB, 0x62, 0x24, 0xD6, 0x61, 0x31, 0xAB, 0x90, 0xAC, 0x5C, 0x56, 0xF2, 0xDD,
+    0xF9, 0xFC, 0xE3, 0x41, 0xED, 0x2B, 0xD5, 0x7D, 0xFA, 0xDB, 0x5B, 0x70, 0xDB, 0x63, 0x04, 0xCF,
+    0x66, 0xAC, 0xDA, 0xB1, 0xEA, 0xBE, 0xAC, 0xD2, 0xB7, 0xAB, 0x71, 0x44, 0x4D, 0x56, 0x34, 0xB8,
+    0x0D, 0x20, 0x77, 0x7E, 0xAD, 0x8F, 0x1E, 0xBA, 0x6D, 0xDB, 0xCA, 0x86, 0x86, 0x56, 0x23, 0x83,
+    0x5F, 0x27, 0x6B, 0xC4, 0x04, 0x8D, 0x06, 0x8C, 0x5F, 0xA9, 0x8D, 0x00, 0x8A, 0xFD, 0x8A, 0xFA,
+    0x8A, 0xF7, 0x44, 0x7A, 0xAF, 0xE3, 0xD7, 0x86, 0xDB, 0xC3, 0xF9, 0xF2, 0x9C, 0x7E, 0x2F, 0xC8,
+    0x4A, 0x7E, 0x2F, 0xF8, 0xA2, 0x6B, 0x1F, 0x26, 0xCF, 0xFC, 0x28, 0xAC, 0x03, 0x1C, 0x0A, 0xDC,
+    0x06, 0x38, 0xDC, 0xBE, 0x4C, 0x82, 0xF0, 0xFF, 0xBD, 0xBE, 0x71, 0x2A, 0xF4, 0xAD, 0xE9, 0x5D,
+    0xB6, 0x49, 0xC1, 0xB7, 0xC5, 0x3E, 0xC1, 0x86, 0x14, 0x79, 0x50, 0x16, 0x48, 0x65, 0x99, 0x60,
+    0xBF, 0xAA, 0x00, 0x70, 0xD4, 0x47, 0xEC, 0xCE, 0xC6, 0x54, 0x85, 0xD5, 0x5A, 0xF4, 0x8C, 0xAB,
+    0x1F, 0xAA, 0xD2, 0x2D, 0xE6, 0x2F, 0x9F, 0x43, 0x96, 0xF3, 0xFC, 0x1E, 0xE3, 0x70, 0x14, 0xD7,
+    0x4B, 0xFD, 0xBA, 0x85, 0x83, 0x43, 0xBC, 0x21, 0x62, 0xFA, 0x29, 0x7D, 0x23, 0xA5, 0x5A, 0x83,
+    0x27, 0x8F, 0xCC, 0x86, 0x18, 0x07, 0x18, 0xBC, 0x60, 0x36, 0xBF, 0xEE, 0x34, 0xC1, 0x7F, 0x97,
+    0xBE, 0xC2, 0x3D, 0x90, 0x77, 0x36, 0xE9, 0x34, 0x24, 0x90, 0x03, 0x93, 0x30, 0x3D, 0xE1, 0x70,
+    0xB6, 0xA4, 0xFF, 0xCE, 0x77, 0x51, 0xB7, 0x4A, 0x87, 0x34, 0x67, 0x58, 0xA7, 0x7D, 0xD6, 0x81,
+    0xCA, 0x95, 0x85, 0x8B, 0x9C, 0x60, 0xC1, 0xC3, 0xE2, 0x02, 0x10, 0xD5, 0x2D, 0xD6, 0x4C, 0x0A,
+    0x18, 0xF9, 0xB0, 0x8D, 0xF3, 0x47, 0xE6, 0xAF, 0x0F, 0xC7, 0xCF, 0xB4, 0x9D, 0xF6, 0xD9, 0xB7,
+    0xEB, 0x05, 0xCF, 0x40, 0x0B, 0x7E, 0x8F, 0xE4, 0xD8, 0x74, 0xE1, 0x4D, 0x98, 0x0E, 0x97, 0x4E,
+    0xA6, 0xA0, 0xA8, 0xE7, 0x58, 0xAD, 0xB2, 0xAF, 0x63, 0x68, 0x7B, 0x32, 0xA2, 0x26, 0xE1, 0x37,
+    0x19, 0x53, 0x9E, 0xAF, 0x77, 0xCD, 0x76, 0xA7, 0x2C, 0xFA, 0xE3, 0x4B, 0xFC, 0x26, 0xCE, 0xC4,
+    0x4B, 0x1E, 0x90, 0xE3, 0xBC, 0x43, 0x78, 0xAC, 0x13, 0x77, 0xC5, 0x63, 0xF2, 0xD2, 0x83, 0x6F,
+    0x46, 0x38, 0x12, 0x97, 0x7E, 0x95, 0xB8, 0x38, 0x03, 0x87, 0xE5, 0x1D, 0xAF, 0x8E, 0xE1, 0x8C,
+    0xE8, 0x3A, 0x90, 0x99, 0xD3, 0x84, 0xE9, 0xB1, 0xDC, 0xF1, 0xAA, 0x2B, 0xD6, 0x3E, 0xCE, 0xF4,
+    0xB1, 0xC2, 0xDE, 0xFA, 0x23, 0x7A, 0x7F, 0xCB, 0x5E, 0xC4, 0xAF, 0x2C, 0x76, 0x7C, 0x5F, 0x97,
+    0x29, 0x1B, 0xBD, 0x39, 0xC6, 0xDE, 0x36, 0x51, 0x7A, 0x42, 0xA9, 0x5F, 0xFF, 0x3A, 0xEA, 0x05,
+    0xDC, 0x91, 0xB3, 0xD8, 0xBA, 0xB2, 0xA3, 0xAD, 0xF3, 0x56, 0xD1, 0x30, 0x1B, 0xD5, 0x35, 0xC8,
+    0xAD, 0x1C, 0xA6, 0xD7, 0xF8, 0xE3, 0x97, 0x41, 0x8C, 0x2B, 0x43, 0x5C, 0x4D, 0x77, 0x84, 0x18,
+    0xA4, 0x90, 0x37, 0x5E, 0x86, 0xB9, 0x55, 0xCD, 0xB1, 0xF4, 0x9A, 0xB2, 0xF2, 0xBB, 0x9B, 0xF1,
+    0xF9, 0x9C, 0x52, 0xFD, 0x54, 0x6D, 0x27, 0x29, 0x71, 0xAC, 0xFC, 0x12, 0x90, 0x3E, 0x79, 0xC5,
+    0xE5, 0x49, 0x6A, 0xAB, 0x09, 0xAB, 0x97, 0x69, 0x7D, 0xF6, 0x9B, 0xC9, 0xAB, 0xDF, 0x2C, 0x38,
+    0x32, 0xAE, 0x28, 0x6B, 0x52, 0xEB, 0xE9, 0xB4, 0x22, 0x97, 0xB3, 0xE9, 0x37, 0xE1, 0x14, 0x3F,
+    0x23, 0x89, 0xED, 0xE9, 0x25, 0xFE, 0x99, 0xBD, 0x2D, 0x27, 0xB7, 0xF3, 0xB8, 0x9D, 0xE1, 0xD7,
+    0x05, 0xD8, 0x3F, 0x75, 0xB4, 0xC4, 0x56, 0xF4, 0x37, 0xB1, 0x9D, 0x3D, 0xC9, 0x89, 0x71, 0x3B,
+    0xB7, 0x4C, 0xFF, 0xA9, 0x59, 0x17, 0x3B, 0xB7, 0xE7, 0x0D, 0x18, 0x6E, 0x1D, 0x6E, 0x8F, 0xFB,
+    0x69, 0x87, 0x9B, 0xCA, 0x62, 0xB8, 0x3F, 0x4B, 0x9B, 0x7E, 0xED, 0x8E, 0xB3, 0x1F, 0x1B, 0xE3,
+    0x5C, 0xBF, 0xC7, 0x97, 0xD1, 0x8E, 0x7A, 0xB8, 0x3D, 0xEC, 0xFD, 0x5E, 0x3A, 0xF5, 0xA1, 0xED,
+    0x97, 0xFB, 0x93, 0xE3, 0xCE, 0xED, 0xBC, 0x7B, 0xDE, 0x5B, 0x7E, 0x91, 0x7E, 0x92, 0x4F, 0x3F,
+    0x23, 0xEF, 0xFF, 0x33, 0x3D, 0xD5, 0x6F, 0xE9, 0xD5, 0x7B, 0xB2, 0xFD, 0xBD, 0x7F, 0x7A, 0x9F,
+    0xBB, 0x71, 0xD0, 0x8A, 0x4D, 0x1E, 0x1A, 0xFE, 0x4B, 0x82, 0x80, 0xC6, 0x0C, 0xF4, 0x14, 0xFF,
+    0xBA, 0xD0, 0xEF, 0x0F, 0x88, 0x64, 0xE0, 0xEC, 0xAF, 0x11, 0x06, 0x24, 0xD6, 0x3F, 0x62, 0x4E,
+    0x87, 0xF9, 0x35, 0x4A, 0x1B, 0xFC, 0x46, 0x2E, 0xFB, 0xF9, 0x55, 0xAF, 0x0C, 0x6F, 0xE9, 0xE9,
+    0xEA, 0x94, 0x24, 0xCF, 0x6A, 0xB9, 0xB4, 0xDB, 0x73, 0x8A, 0x1B, 0xFA, 0x5F, 0xED, 0x54, 0x3D,
+    0x73, 0xD3, 0x40, 0x10, 0x7D, 0x67, 0x25, 0x98, 0x44, 0x85, 0x28, 0x48, 0x03, 0x85, 0x9A, 0x14,
+    0x99, 0x14, 0x51, 0xCF, 0x58, 0xD6, 0xF1, 0x0F, 0x5C, 0x10, 0x6A, 0x0A, 0x2A, 0xA7, 0xA0, 0x4D,
+    0x91, 0x38, 0xE2, 0x1F, 0x84, 0x02, 0x6A, 0x17, 0x14, 0x44, 0x0D, 0x0D, 0x85, 0x99, 0x31, 0xB6,
+    0xF2, 0x0F, 0x04, 0x7F, 0x00, 0xF1, 0x31, 0x69, 0x68, 0x8E, 0x89, 0x98, 0x5C, 0x26, 0xB2, 0x8F,
+    0x77, 0x17, 0x91, 0x01, 0x26, 0x30, 0xCC, 0xD0, 0xE6, 0x6E, 0x57, 0xBA, 0x3B, 0x9D, 0x77, 0xF7,
+    0xBD, 0xDD, 0x35, 0xA6, 0x29, 0xDA, 0xA6, 0x42, 0x70, 0x54, 0x23, 0x92, 0x03, 0x24, 0x9C, 0x5D,
+    0x44, 0xD4, 0x50, 0xEE, 0x36, 0x1A, 0x53, 0xBB, 0x4E, 0x23, 0xF7, 0x3D, 0x4C, 0x27, 0x08, 0xCE,
+    0x6A, 0x78, 0x46, 0x01, 0x7D, 0x89, 0x85, 0x38, 0x06, 0x3A, 0x3F, 0x0D, 0x40, 0x54, 0x80, 0xA7,
+    0x81, 0x80, 0x1A, 0x51, 0x63, 0xEA, 0x37, 0x8D, 0xD6, 0x57, 0x8D, 0xF6, 0xA1, 0x46, 0x70, 0x57,
+    0x63, 0x43, 0x68, 0x0C, 0xEE, 0x9F, 0xCA, 0xA9, 0x31, 0x39, 0x35, 0x05, 0xF7, 0x17, 0x8A, 0x1E,
+    0xD6, 0xB3, 0x61, 0x62, 0x54, 0x77, 0xB3, 0x47, 0x73, 0x94, 0x1D, 0x60, 0x70, 0x80, 0x3D, 0x53,
+    0xDC, 0x79, 0xA4, 0xDC, 0x95, 0x1A, 0x18, 0xF3, 0x29, 0x85, 0x9E, 0x6F, 0x29, 0xDA, 0xB8, 0x75,
+    0x00, 0xDC, 0xAE, 0x21, 0x4C, 0x8D, 0xF6, 0xE9, 0x02, 0x82, 0x1C, 0x08, 0x69, 0xA8, 0x4B, 0x8D,
+    0xA3, 0x12, 0x5D, 0x9E, 0x27, 0xC5, 0x9E, 0x0D, 0x9F, 0x80, 0x02, 0xA7, 0x16, 0x54, 0x28, 0x13,
+    0x82, 0x9F, 0xA1, 0x65, 0xB4, 0x03, 0x93, 0x65, 0x2F, 0x8C, 0xA9, 0xB3, 0x8C, 0xE6, 0x19, 0xAF,
+    0x82, 0x57, 0xA2, 0x9D, 0x23, 0x48, 0x79, 0x95, 0xBF, 0xC5, 0xAE, 0x73, 0x5C, 0x35, 0x5F, 0xFC,
+    0x1C, 0x8B, 0x12, 0x98, 0xEE, 0x93, 0x43, 0xA2, 0x2A, 0xDE, 0x38, 0xE6, 0x1C, 0x7B, 0xE9, 0x2E,
+    0x82, 0x8F, 0x9A, 0x1C, 0x95, 0x8E, 0xA7, 0xE0, 0xDD, 0xCC, 0xB1, 0xD7, 0x7C, 0x3D, 0xE7, 0x91,
+    0x6E, 0xFD, 0xC6, 0xAD, 0x1D, 0x82, 0x24, 0xF8, 0xCC, 0x45, 0xF4, 0xB8, 0xE6, 0x9D, 0x2E, 0x7D,
+    0x85, 0x84, 0x1D, 0xDA, 0x37, 0x83, 0x4C, 0x64, 0x74, 0x64, 0xA4, 0x6F, 0xDE, 0x03, 0x07, 0x16,
+    0x58, 0x64, 0x81, 0xC1, 0x86, 0xB3, 0xB4, 0x45, 0xFB, 0x26, 0xC7, 0xF2, 0x0B, 0x47, 0x1C, 0x5E,
+    0x35, 0xB2, 0xF2, 0xBA, 0x37, 0x35, 0x55, 0x7F, 0x3E, 0xBC, 0x38, 0xB1, 0x87, 0x9B, 0xEE, 0x30,
+    0x1B, 0x5E, 0x2C, 0x9C, 0x6F, 0x70, 0x4D, 0x01, 0x81, 0xB5, 0xF3, 0x20, 0x0D, 0xE9, 0x3E, 0xA6,
+    0xF3, 0x31, 0x46, 0xCD, 0x1C, 0x73, 0x17, 0xBB, 0xD0, 0x03, 0xD9, 0xCE, 0x09, 0x1F, 0x36, 0x27,
+    0x11, 0x77, 0x7E, 0xEE, 0x15, 0x5E, 0xD9, 0x52, 0x82, 0x13, 0x9C, 0xF6, 0xDD, 0x52, 0x5E, 0xE9,
+    0x15, 0xB4, 0x24, 0x23, 0x9B, 0x39, 0x3B, 0x3E, 0x98, 0xE2, 0xEC, 0x4B, 0x35, 0xC3, 0x58, 0xA3,
+    0x53, 0xA1, 0xA3, 0x2E, 0x13, 0x17, 0xC8, 0xFF, 0x17, 0x24, 0xD6, 0x85, 0xF1, 0x4D, 0xF2, 0x32,
+    0x8E, 0x6E, 0x44, 0xB8, 0x6C, 0xAE, 0x08, 0xB3, 0x1F, 0x9A, 0x2A, 0x7A, 0x52, 0x5F, 0xB7, 0x19,
+    0xED, 0xBA, 0xBC, 0x8E, 0x6D, 0x59, 0x79, 0xCA, 0x56, 0x4E, 0x62, 0x69, 0xB5, 0xCB, 0x14, 0x89,
+    0x99, 0x51, 0x56, 0x36, 0xEF, 0xB5, 0xCC, 0x3E, 0x22, 0x06, 0x96, 0xDC, 0xAD, 0xB1, 0x60, 0xEF,
+    0xBB, 0xD2, 0xE2, 0x5B, 0xD4, 0x4D, 0x96, 0x4B, 0xAE, 0x67, 0x3C, 0x4B, 0x9A, 0xEC, 0x24, 0xB8,
+    0x81, 0x01, 0x06, 0xCF, 0x6A, 0x96, 0x6D, 0x85, 0x6B, 0x99, 0xBC, 0xEA, 0x8B, 0xAB, 0xBE, 0xF8,
+    0xB5, 0x2F, 0x44, 0x26, 0x03, 0x53, 0x2E, 0xD9, 0xB2, 0x18, 0x01, 0xDB, 0xA2, 0xAF, 0x43, 0xA3,
+    0x77, 0xB1, 0xAD, 0x31, 0xAA, 0xA0, 0xC7, 0x2D, 0x9D, 0x98, 0x6D, 0xFF, 0xF3, 0x2A, 0xFA, 0x24,
+    0xB2, 0x0C, 0xA5, 0xEE, 0xA0, 0x43, 0x77, 0x93, 0xEC, 0xCD, 0xD4, 0xCC, 0x46, 0x2E, 0xF9, 0x84,
+    0x1A, 0xC9, 0x05, 0x9F, 0x59, 0x7C, 0x39, 0xB4, 0x84, 0x59, 0xA2, 0x42, 0x39, 0xE6, 0xB9, 0xF5,
+    0x10, 0xD0, 0x6C, 0x20, 0x7F, 0xA8, 0xDD, 0x77, 0x18, 0x69, 0x44, 0xEA, 0xEC, 0x3D, 0x4C, 0x52,
+    0xDC, 0xC4, 0x22, 0xF7, 0xCC, 0x7A, 0x3A, 0x82, 0xF7, 0x96, 0x25, 0x74, 0xC2, 0x02, 0x99, 0xCA,
+    0xF3, 0x2A, 0x66, 0x2F, 0x8A, 0xE3, 0x02, 0xDE, 0x21, 0x89, 0xA4, 0xCD, 0x0D, 0xE2, 0x5C, 0xC3,
+    0x32, 0xAE, 0x1D, 0xB0, 0x2D, 0xF2, 0x55, 0x0B, 0x76, 0xEC, 0x8A, 0x30, 0x66, 0x38, 0xC6, 0x46,
+    0xC4, 0xE8, 0x76, 0xBA, 0xA2, 0x0A, 0x4C, 0x21, 0x26, 0x78, 0x00, 0xC2, 0xFE, 0x49, 0xFA, 0xF2,
+    0xC4, 0xA8, 0xB9, 0xD0, 0x35, 0x76, 0xAA, 0x3F, 0xFC, 0x07, 0x0C, 0xB1, 0xF6, 0xFB, 0xAF, 0xD0,
+    0x53, 0x5E, 0xA1, 0x02, 0xA9, 0x62, 0xA8, 0x0A, 0x27, 0x05, 0x58, 0x35, 0xB5, 0x86, 0xDD, 0x86,
+    0x92, 0x49, 0x21, 0xA7, 0x43, 0x3C, 0x7F, 0xA0, 0x7E, 0x1B, 0xC3, 0x5E, 0x1F, 0xD6, 0xE1, 0x27,
+    0xBA, 0x6C, 0x19, 0x51, 0xD5, 0x2C, 0x08, 0x72, 0x3A, 0xC2, 0x8E, 0x3A, 0x7F, 0xBC, 0xFA, 0xCB,
+    0x63, 0x88, 0x87, 0x58, 0xED, 0xF5, 0xE5, 0xF1, 0x3F, 0xC4, 0xEB, 0xAE, 0x95, 0x3F, 0xAE, 0xC5,
+    0x0A, 0x1B, 0xE7, 0xC2, 0x75, 0x8D, 0xCE, 0x1C, 0xFA, 0xCC, 0x28, 0x35, 0x91, 0xBF, 0x62, 0x6A,
+    0x28, 0x1C, 0x09, 0x59, 0x39, 0x0E, 0x13, 0x76, 0xCA, 0x9C, 0x99, 0xCC, 0xE1, 0x15, 0x68, 0x95,
+    0x3D, 0xAF, 0x98, 0x9A, 0xF4, 0xF6, 0xA9, 0x2D, 0x26, 0x4F, 0xA2, 0x2D, 0x11, 0x3E, 0x65, 0x25,
+    0x32, 0x09, 0x97, 0x88, 0x2F, 0x6D, 0xBF, 0x79, 0x46, 0x62, 0x82, 0xEF, 0xAD, 0x58, 0xBF, 0x8F,
+    0xDC, 0xC6, 0x15, 0x1E, 0x92, 0xD6, 0x2D, 0x10, 0x22, 0x61, 0x8A, 0x9C, 0x52, 0xA8, 0x60, 0xDA,
+    0x28, 0x50, 0xD8, 0xAA, 0xB0, 0x6E, 0x28, 0x0B, 0x88, 0xCA, 0x5C, 0xE1, 0x95, 0x8B, 0x2B, 0x94,
+    0x32, 0x90, 0x10, 0x5F, 0xEB, 0xE2, 0x24, 0xD2, 0x4E, 0x91, 0xC2, 0x45, 0x0E, 0x29, 0x82, 0x94,
+    0x29, 0x54, 0x28, 0xAB, 0xE2, 0x9A, 0x14, 0x29, 0x4E, 0x4B, 0xC6, 0xFA, 0x03, 0xB2, 0x89, 0x21,
+    0xA8, 0x25, 0x60, 0x19, 0x02, 0xE4, 0x42, 0x84, 0x4D, 0x59, 0xBC, 0x15, 0xC9, 0xC9, 0xFB, 0xBE,
+    0x19, 0xEE, 0xEE, 0x9D, 0x61, 0x44, 0x01, 0xB4, 0x90, 0xBE, 0xC7, 0xE3, 0xBC, 0x99, 0x79, 0xF3,
+    0x7E, 0x0F, 0x95, 0xC2, 0x6F, 0x7F, 0x48, 0x95, 0x6F, 0x4C, 0xA9, 0xC2, 0x7E, 0x2F, 0x57, 0x71,
+    0x25, 0xAF, 0x74, 0x0E, 0xC0, 0x60, 0x06, 0x98, 0x5B, 0xB8, 0x38, 0xBB, 0x3F, 0x57, 0xDA, 0x74,
+    0x84, 0x42, 0xE9, 0x54, 0x46, 0x05, 0x74, 0x2A, 0x90, 0x94, 0x02, 0x51, 0x23, 0x30, 0x31, 0xC6,
+    0xB4, 0xAA, 0x00, 0x9C, 0x2B, 0x66, 0xF7, 0x14, 0x58, 0xBE, 0x07, 0x66, 0xF7, 0x15, 0x96, 0x72,
+    0x70, 0x2E, 0xDD, 0x55, 0x2A, 0x7A, 0xAF, 0x16, 0x08, 0x44, 0x88, 0xF8, 0x83, 0x85, 0xF2, 0x8C,
+    0x69, 0x54, 0x6C, 0xCC, 0xA0, 0x8A, 0xE1, 0x66, 0xE7, 0x99, 0xE3, 0xE8, 0x2F, 0x41, 0x77, 0x10,
+    0xA5, 0x61, 0x7D, 0x1C, 0xA9, 0x68, 0xD1, 0xC6, 0xB2, 0x6F, 0x93, 0x88, 0xB8, 0xF5, 0x8E, 0xD2,
+    0x57, 0xEB, 0x2B, 0x4A, 0xBF, 0x57, 0xBD, 0xAB, 0x74, 0x50, 0x1D, 0x08, 0x2C, 0x8E, 0x95, 0xBE,
+    0x5E, 0xB6, 0x80, 0x46, 0x25, 0x9F, 0xE6, 0xB5, 0x8A, 0xFF, 0xF5, 0x71, 0xAD, 0xA2, 0x17, 0xB2,
+    0x45, 0x68, 0x64, 0x8B, 0xC0, 0x04, 0xD8, 0xE2, 0x49, 0xF9, 0x5B, 0x95, 0x41, 0x5C, 0x0D, 0x38,
+    0x80, 0x3A, 0x64, 0x0B, 0xA5, 0xFE, 0x11, 0x89, 0x8C, 0x4D, 0xAC, 0x36, 0x7F, 0xBE, 0x91, 0xD1,
+    0xC4, 0x98, 0x5A, 0x99, 0x65, 0x51, 0x05, 0x83, 0xF2, 0xCB, 0xB0, 0x95, 0xF7, 0x11, 0xB4, 0x96,
+    0x94, 0xE3, 0xC9, 0xA8, 0xB5, 0xC2, 0x6A, 0xED, 0x27, 0x3F, 0x38, 0x1C, 0xD4, 0x71, 0x51, 0xF5,
+    0x6A, 0x6E, 0x04, 0x8A, 0xA7, 0xA9, 0x40, 0xAE, 0x7A, 0x8C, 0xCF, 0xA1, 0xDA, 0x42, 0x3D, 0xC4,
+    0x8C, 0x87, 0x98, 0x0B, 0x28, 0x05, 0xE2, 0x85, 0x40, 0x54, 0x0B, 0x4C, 0xFA, 0x87, 0x2A, 0x95,
+    0x6D, 0x8F, 0x4A, 0x08, 0x29, 0x46, 0x32, 0x46, 0x8C, 0xB3, 0x2D, 0xBB, 0x18, 0x28, 0x67, 0x0D,
+    0x3D, 0xB6, 0xEB, 0xDE, 0x10, 0xFA, 0xE9, 0x74, 0x17, 0xD3, 0x2A, 0x0B, 0xC3, 0x6C, 0x76, 0x78,
+    0x86, 0x65, 0xBB, 0x9F, 0xA6, 0x76, 0x47, 0xC2, 0xF7, 0x2F, 0xCF, 0x9F, 0x57, 0x88, 0x5E, 0x42,
+    0xE8, 0x25, 0x19, 0x8A, 0x4A, 0x0C, 0xE2, 0x1D, 0xDA, 0xF3, 0x0F, 0xDC, 0xED, 0xBB, 0x30, 0x1D,
+    0xA6, 0xEF, 0xC3, 0x49, 0x3A, 0x0B, 0x67, 0x46, 0xD7, 0x03, 0xE4, 0x5B, 0xEF, 0xE6, 0x03, 0x82,
+    0x06, 0x1A, 0x5F, 0x58, 0x3E, 0xD3, 0x99, 0x15, 0x80, 0x6B, 0x52, 0x5A, 0x89, 0xA2, 0xDC, 0xD2,
+    0x38, 0xB5, 0x94, 0xDE, 0xAC, 0xA6, 0xEA, 0xCE, 0x54, 0x56, 0x8A, 0x4D, 0x05, 0x95, 0x75, 0x85,
+    0x69, 0xE1, 0x5C, 0xC3, 0xC9, 0x9E, 0x19, 0x6E, 0x18, 0x65, 0x16, 0x4A, 0x4E, 0x90, 0xE5, 0x46,
+    0x4E, 0x5E, 0x8A, 0x39, 0x0D, 0x23, 0x21, 0x26, 0x4D, 0x85, 0x0E, 0xA4, 0x11, 0xA8, 0x58, 0x38,
+    0x2A, 0x45, 0x54, 0x63, 0xA9, 0xE7, 0x68, 0xE0, 0xE8, 0xC4, 0xD1, 0xC8, 0xD1, 0xD8, 0xF1, 0x27,
+    0xDA, 0xD2, 0x2B, 0x8E, 0x1E, 0x3B, 0xDA, 0x58, 0xEA, 0xD7, 0xA4, 0x0A, 0xFE, 0x8F, 0x5F, 0x78,
+    0xF6, 0x30, 0xEA, 0xB4, 0x37, 0xF6, 0xCA, 0xAF, 0x95, 0x3F, 0xA8, 0x40, 0xD0, 0x58, 0x4C, 0x89,
+    0x25, 0xF0, 0x35, 0xF1, 0x55, 0x05, 0xFC, 0xA6, 0x06, 0x7E, 0xDD, 0x08, 0xDE, 0x5E, 0x0E, 0x0F,
+    0x96, 0x39, 0x54, 0x67, 0x4A, 0x8B, 0xB2, 0x2D, 0x46, 0x1D, 0xC6, 0xBF, 0xAF, 0xD5, 0xE6, 0xE8,
+    0x4F, 0x4F, 0xF6, 0x5E, 0xBD, 0x4C, 0xFD, 0x3A, 0xF8, 0x06, 0xA3, 0xFE, 0xB7, 0x40, 0x35, 0x10,
+    0x0D, 0x31, 0x23, 0x6A, 0x62, 0x42, 0x8C, 0x89, 0x91, 0xBC, 0x1C, 0x0E, 0xA9, 0x7C, 0x63, 0x1C,
+    0x59, 0xD0, 0x14, 0x32, 0x03, 0x64, 0xD2, 0x92, 0xD0, 0xA8, 0x5A, 0x79, 0x96, 0xA8, 0xDE, 0x4B,
+    0x49, 0x82, 0x12, 0xA4, 0x9B, 0x94, 0x1C, 0x0B, 0x41, 0x82, 0x36, 0xF9, 0x32, 0xD5, 0x2A, 0xFA,
+    0x56, 0x16, 0xD2, 0x37, 0x8A, 0x2F, 0x40, 0x24, 0x1E, 0x44, 0x63, 0xDA, 0x9C, 0x40, 0x71, 0xFA,
+    0x6F, 0x29, 0x89, 0x52, 0xFF, 0x0F, 0x59, 0x90, 0x84, 0x2F, 0x77, 0x41, 0x02, 0x03, 0x23, 0x88,
+    0x45, 0xAD, 0x0D, 0xB6, 0x55, 0xB1, 0xA4, 0x0B, 0x21, 0x39, 0x90, 0xF0, 0x28, 0xBD, 0x57, 0xE4,
+    0x74, 0x56, 0x06, 0x7D, 0x6F, 0xDD, 0xB1, 0x47, 0x1E, 0x98, 0x0A, 0x09, 0xAB, 0x08, 0xB1, 0x1E,
+    0x56, 0xDA, 0x34, 0x78, 0x69, 0x7E, 0x55, 0x83, 0x85, 0x7E, 0x9E, 0xFC, 0x93, 0xA4, 0xB8, 0xDA,
+    0x61, 0xB1, 0x01, 0x11, 0x82, 0xA5, 0x25, 0xAA, 0x11, 0x3E, 0x5A, 0x02, 0x59, 0xFC, 0x5B, 0xFC,
+    0xA6, 0x17, 0xB5, 0x88, 0x21, 0x7B, 0xF8, 0x7D, 0x22, 0xD3, 0x85, 0x2F, 0x94, 0xC5, 0xC4, 0x91,
+    0xFC, 0xB6, 0x87, 0x5F, 0x7A, 0x2D, 0x77, 0xC7, 0x5F, 0xD1, 0xBF, 0xD3, 0x40, 0xC6, 0xC2, 0xAF,
+    0x4F, 0x6E, 0x0A, 0x67, 0x00, 0xF5, 0x08, 0x69, 0x0B, 0x43, 0xC9, 0xBD, 0x5D, 0xB5, 0x83, 0xA0,
+    0x89, 0x53, 0xAA, 0x5C, 0xF2, 0xA5, 0x0A, 0x3B, 0x01, 0x47, 0x92, 0x34, 0xEA, 0x84, 0x21, 0xCE,
+    0xA3, 0x3B, 0xEA, 0xAE, 0xB8, 0x5A, 0xBC, 0xA3, 0xEE, 0x88, 0x6A, 0x84, 0x1C, 0x0B, 0x49, 0x12,
+    0x11, 0x20, 0x2C, 0x77, 0x62, 0x90, 0xC5, 0x4E, 0x9C, 0x76, 0x6A, 0xB2, 0xB8, 0x12, 0xA5, 0xAD,
+    0xF5, 0x11, 0x63, 0x1D, 0xC9, 0x94, 0xE2, 0x55, 0x47, 0x5F, 0x2D, 0xC5, 0x4D, 0xDA, 0xC9, 0x23,
+    0x58, 0xBF, 0x0D, 0x3E, 0xAF, 0x94, 0xD7, 0x34, 0x20, 0xEA, 0x65, 0x1D, 0x7C, 0x21, 0x0A, 0x3A,
+    0xA9, 0xFD, 0x67, 0x42, 0x96, 0xB5, 0xFF, 0x4A, 0xB4, 0x36, 0xAF, 0xBC, 0xD7, 0x42, 0x32, 0xC9,
+    0x41, 0x20, 0x0B, 0xA8, 0x40, 0xB2, 0x9F, 0x82, 0xD0, 0x42, 0x8A, 0x94, 0x19, 0x35, 0x43, 0x94,
+    0x9F, 0x28, 0xB5, 0xC3, 0x44, 0xA5, 0x19, 0xE6, 0xBA, 0x83, 0xD3, 0x0B, 0xA2, 0x00, 0xA1, 0x7C,
+    0xA4, 0xC0, 0x38, 0xD7, 0x5D, 0x50, 0x47, 0xE5, 0xDB, 0x44, 0xA5, 0xEE, 0x12, 0xE7, 0x40, 0xAF,
+    0x03, 0x4E, 0xDA, 0x2E, 0x58, 0xCE, 0x8A, 0xBA, 0x0B, 0x70, 0x6C, 0xE0, 0x09, 0x63, 0x91, 0x8E,
+    0x3E, 0xA9, 0xD7, 0x18, 0x0A, 0xA2, 0x18, 0xE6, 0x0E, 0xBD, 0xE9, 0xDE, 0xCB, 0x71, 0xD4, 0xDB,
+    0x05, 0x66, 0xE6, 0x7A, 0x2D, 0xFE, 0x66, 0x9E, 0x49, 0xAC, 0x0C, 0x7B, 0xAF, 0x25, 0x7A, 0x2A,
+    0x84, 0x86, 0x1C, 0x5E, 0xC2, 0x28, 0x4B, 0x11, 0x40, 0x05, 0xCA, 0x00, 0x6D, 0x4F, 0x9C, 0x7C,
+    0x0F, 0x86, 0xE4, 0x14, 0xCC, 0xC8, 0x8F, 0xAC, 0x35, 0xAE, 0x66, 0x57, 0x96, 0x5D, 0x3E, 0xE7,
+    0x8E, 0xD7, 0xB8, 0xFB, 0xE9, 0x3C, 0xA2, 0xB6, 0x66, 0x33, 0xA9, 0xC5, 0x21, 0x95, 0x1B, 0x8E,
+    0x99, 0x94, 0xBF, 0x89, 0x41, 0xB2, 0xCD, 0x20, 0xBF, 0xCF, 0x53, 0x84, 0x3D, 0xB2, 0x10, 0xBB,
+    0x04, 0x08, 0x8A, 0xC1, 0x74, 0x55, 0xED, 0x6C, 0xBA, 0xB7, 0x79, 0x1C, 0xA6, 0x4A, 0x1D, 0x9E,
+    0x97, 0x7A, 0xA3, 0x6C, 0x80, 0x3B, 0xFC, 0xC5, 0x60, 0x8B, 0xBF, 0xAD, 0xFE, 0xDC, 0x90, 0xB3,
+    0x6C, 0xAF, 0x61, 0x0B, 0xA8, 0x6D, 0x43, 0xDC, 0x5E, 0x51, 0xAB, 0x7C, 0x04, 0xE7, 0xF3, 0x62,
+    0x15, 0x84, 0xB1, 0xD5, 0xFC, 0xD4, 0xD6, 0x86, 0x24, 0x07, 0x16, 0x78, 0xC6, 0x16, 0xE2, 0xA6,
+    0x0D, 0x10, 0x95, 0xB9, 0xE3, 0x4A, 0x1D, 0x65, 0xEC, 0xB8, 0x7F, 0xC7, 0x1A, 0xD2, 0xB1, 0x6C,
+    0x77, 0xDC, 0xA6, 0x2B, 0xEC, 0x39, 0x45, 0x14, 0x8B, 0xE7, 0x8D, 0x79, 0x2C, 0xA5, 0xC7, 0xD8,
+    0xC8, 0x86, 0x31, 0x65, 0x56, 0xCB, 0xBD, 0x7A, 0x62, 0x46, 0x84, 0x0E, 0xC6, 0x5D, 0xEC, 0x8E,
+    0x3E, 0x77, 0x87, 0x2A, 0x3A, 0x2A, 0x07, 0xB2, 0x95, 0x9A, 0xB1, 0x92, 0x31, 0x54, 0x2C, 0x8E,
+    0xC7, 0x63, 0xC3, 0xB0, 0x42, 0xF6, 0x45, 0xD7, 0xD8, 0x83, 0xDD, 0x24, 0x32, 0x84, 0x35, 0x75,
+    0x96, 0x55, 0xEC, 0x40, 0x52, 0x1E, 0x3D, 0x95, 0x05, 0x8A, 0x42, 0xFC, 0xC7, 0xEB, 0xF5, 0x91,
+    0x88, 0x28, 0xA9, 0x86, 0x2B, 0x30, 0x49, 0x15, 0x25, 0x4D, 0x07, 0xCE, 0x84, 0x68, 0xB8, 0x7E,
+    0x4B, 0xDC, 0x3D, 0xBD, 0xE3, 0x1A, 0x47, 0x67, 0x30, 0xE6, 0x50, 0x39, 0x0B, 0x5A, 0x7B, 0x26,
+    0xC3, 0x91, 0xA1, 0xA9, 0x7F, 0xA8, 0x6C, 0xEA, 0xA6, 0x7B, 0x5B, 0x27, 0xD9, 0x3A, 0xF4, 0x2C,
+    0x93, 0xE8, 0xC9, 0xFA, 0x00, 0xB2, 0x2A, 0xD7, 0x8B, 0x4B, 0x77, 0x44, 0x31, 0x0D, 0xD3, 0xA4,
+    0xAD, 0xA2, 0xAE, 0x1A, 0xAF, 0x1E, 0xEC, 0x50, 0x36, 0x3E, 0xCC, 0xC1, 0xEF, 0xBD, 0x4F, 0x7F,
+    0xD0, 0x79, 0x6C, 0x72, 0xAB, 0xC6, 0xC2, 0xD4, 0xB0, 0x5C, 0xE1, 0x0D, 0xD7, 0x5B, 0x3C, 0x0C,
+    0x41, 0xE3, 0x77, 0xBE, 0x38, 0x45, 0x37, 0x91, 0x01, 0x31, 0xE7, 0xA4, 0x15, 0x09, 0x10, 0xA0,
+    0xB1, 0xC4, 0xAE, 0x27, 0x6F, 0x45, 0x0B, 0x51, 0x19, 0xB4, 0x61, 0x75, 0xC1, 0xC8, 0x66, 0x61,
+    0x1D, 0x21, 0xCD, 0x26, 0x2F, 0xF7, 0x25, 0x37, 0xCB, 0xA2, 0xAC, 0x1B, 0xE6, 0xA9, 0xEC, 0x91,
+    0x59, 0xC7, 0x53, 0xD9, 0x39, 0xA7, 0x85, 0xBB, 0xA3, 0x26, 0xE6, 0xE3, 0x43, 0x3F, 0x3E, 0x8C,
+    0x81, 0xE1, 0x8D, 0x0F, 0x7E, 0xEB, 0x1E, 0xE8, 0x50, 0x7C, 0xA8, 0xD7, 0xAA, 0xF4, 0x90, 0xD2,
+    0x42, 0x49, 0xEB, 0x2A, 0x7E, 0x26, 0x8C, 0x49, 0x0A, 0x6F, 0x57, 0x84, 0x7E, 0xF5, 0xC4, 0x04,
+    0x06, 0x27, 0xF9, 0x58, 0x58, 0xE2, 0xCF, 0x64, 0x9D, 0xE8, 0x11, 0x9A, 0xE0, 0x27, 0x0B, 0xD8,
+    0xB0, 0x84, 0xD3, 0xE7, 0xB0, 0xBB, 0x13, 0xE4, 0xC7, 0x80, 0xCB, 0x68, 0x34, 0x0E, 0x60, 0xE1,
+    0x21, 0x7A, 0x91, 0xFB, 0x66, 0xFF, 0xD7, 0xA5, 0x44, 0x78, 0xB8, 0x08, 0x9F, 0xC8, 0xC1, 0xA3,
+    0x47, 0x6D, 0x50, 0x27, 0x57, 0x6B, 0xBF, 0xCD, 0xD4, 0x5F, 0xBD, 0x33, 0xED, 0xDA, 0xC3, 0x15,
+    0x74, 0xEE, 0x1C, 0xC1, 0x83, 0x16, 0x7B, 0x54, 0x80, 0xD4, 0x33, 0xCB, 0x1C, 0x72, 0x9B, 0x9E,
+    0x28, 0x1B, 0x08, 0x4B, 0xB1, 0x00, 0x4A, 0x5E, 0xB9, 0xD1, 0x4F, 0xF7, 0x4E, 0x52, 0xDB, 0x16,
+    0xDC, 0x1A, 0x66, 0x0F, 0x86, 0x5C, 0xDE, 0x8B, 0x0A, 0x36, 0x71, 0xB3, 0x75, 0xB0, 0xB3, 0x3C,
+    0x46, 0x89, 0x37, 0x3C, 0xC0, 0x6A, 0xE3, 0xCA, 0x72, 0x38, 0xAF, 0x4F, 0xD5, 0xE9, 0xAC, 0xF0,
+    0x26, 0x08, 0x0F, 0x26, 0x52, 0xE1, 0xFB, 0xC8, 0x01, 0xC8, 0xAF, 0x35, 0xDA, 0x72, 0xF4, 0xB3,
+    0x4F, 0x9B, 0x89, 0xE8, 0x02, 0xA3, 0xD2, 0x99, 0x37, 0x4C, 0x87, 0x0D, 0x7D, 0xAB, 0x61, 0xC4,
+    0x35, 0x8C, 0xC9, 0x86, 0x0E, 0xD7, 0x30, 0x5F, 0x6C, 0xA2, 0xB8, 0xC8, 0x19, 0x6C, 0x82, 0x16,
+    0xFC, 0x41, 0x8B, 0xB9, 0x82, 0x25, 0x30, 0x5E, 0x00, 0xA3, 0x06, 0x38, 0xE9, 0x81, 0xBE, 0xC9,
+    0x05, 0xE5, 0x9A, 0xB2, 0x2C, 0x5A, 0xDC, 0x58, 0xC4, 0xD5, 0xBC, 0x82, 0x81, 0xE4, 0x9D, 0xAC,
+    0xA5, 0xB5, 0xE8, 0x3C, 0xDF, 0xA6, 0x50, 0x7A, 0x4B, 0xC1, 0xF7, 0x43, 0xCB, 0x43, 0xB2, 0xCF,
+    0x6D, 0x7B, 0xFA, 0xD4, 0x9C, 0xF5, 0x02, 0x99, 0x46, 0x7A, 0x09, 0xF6, 0xE3, 0xD2, 0xB7, 0x52,
+    0xB7, 0xCD, 0xAD, 0xE2, 0xF9, 0xD1, 0xF2, 0x9E, 0xB8, 0x0E, 0x52, 0x53, 0x01, 0xFF, 0xDB, 0x1E,
+    0xA6, 0x1F, 0x9C, 0xEC, 0x16, 0x1B, 0x3C, 0xC8, 0x57, 0x86, 0x05, 0x27, 0x63, 0x39, 0xD2, 0x29,
+    0xB2, 0x59, 0x52, 0x42, 0x82, 0xB8, 0x44, 0xBC, 0x45, 0x58, 0x56, 0xC6, 0x32, 0x6E, 0x84, 0x48,
+    0x0E, 0x46, 0x8F, 0xBE, 0x80, 0x86, 0xC7, 0x26, 0x7D, 0x9F, 0xAA, 0xF5, 0x1A, 0x54, 0x15, 0x30,
+    0x92, 0xC5, 0x32, 0xFA, 0x1B, 0xCF, 0x22, 0x03, 0xF7, 0xB5, 0x98, 0x4E, 0xA7, 0x7B, 0xE6, 0x31,
+    0x6C, 0xD4, 0x33, 0x1B, 0x21, 0x8F, 0x66, 0xE0, 0xBB, 0x6D, 0x9E, 0xCF, 0x66, 0x8E, 0x67, 0x7F,
+    0x29, 0xA5, 0xC7, 0x76, 0x4F, 0x48, 0x1C, 0x6B, 0xB4, 0x6F, 0xEA, 0x31, 0xD3, 0x7C, 0x84, 0xD4,
+    0x7F, 0xD4, 0x32, 0xF5, 0x23, 0x4C, 0x6C, 0x8E, 0xDA, 0x1E, 0xFB, 0x1B, 0x08, 0x52, 0x5B, 0x7F,
+    0x78, 0xAA, 0x58, 0xC2, 0x6C, 0xE9, 0x11, 0xFE, 0xFF, 0xD4, 0x1F, 0xAA, 0x60, 0xC0, 0x68, 0xD8,
+    0x02, 0xA3, 0x1A, 0x98, 0x94, 0x40, 0x9D, 0x03, 0xB3, 0x94, 0xC8, 0x15, 0x8A, 0x37, 0x40, 0xCB,
+    0x6F, 0xE7, 0x6A, 0xAE, 0x93, 0x2C, 0xD6, 0x2B, 0x4F, 0x3A, 0xA0, 0x6F, 0x3E, 0xA9, 0xCF, 0xA1,
+    0x75, 0x59, 0xF6, 0x94, 0xB6, 0xA7, 0x2A, 0x71, 0x7A, 0xBF, 0x59, 0x4B, 0x4B, 0xBC, 0xAC, 0x7E,
+    0x24, 0x78, 0xC0, 0xE6, 0xFE, 0x58, 0xBA, 0x33, 0x56, 0x95, 0xB1, 0xC2, 0x5C, 0x80, 0x96, 0x2A,
+    0x56, 0x8F, 0xEA, 0x7C, 0x7F, 0xAB, 0x98, 0xEE, 0x7A, 0x7C, 0xFF, 0x16, 0x51, 0x33, 0xC6, 0xF5,
+    0x97, 0xBF, 0x11, 0x8C, 0x99, 0x65, 0x27, 0xA6, 0xB6, 0xAD, 0xEF, 0xFA, 0x17, 0x43, 0xAF, 0xCC,
+    0x08, 0x39, 0x6C, 0xF9, 0x02, 0x44, 0xFC, 0xFF, 0xC2, 0x78, 0xED, 0x5D, 0xD5, 0x90, 0x33, 0xC4,
+    0x5E, 0x5C, 0x92, 0x85, 0x72, 0x35, 0x9C, 0xF6, 0x34, 0xB9, 0x4D, 0x8E, 0x36, 0x32, 0x12, 0x7A,
+    0x86, 0xA8, 0xA7, 0x75, 0x6E, 0x67, 0x77, 0x34, 0x6E, 0x6A, 0xB9, 0x95, 0xDE, 0xDF, 0x3A, 0x8C,
+    0x16, 0xFA, 0x99, 0x49, 0xDA, 0x70, 0x71, 0xB9, 0x8F, 0x9A, 0x03, 0x21, 0xED, 0x64, 0x71, 0x29,
+    0x5A, 0xBC, 0xDB, 0x04, 0xE5, 0x25, 0xE9, 0x55, 0x41, 0x74, 0x3E, 0x19, 0xAE, 0x95, 0x09, 0xFB,
+    0x69, 0xAA, 0x7A, 0x69, 0xA5, 0x6D, 0x26, 0x8F, 0x7F, 0x87, 0xD0, 0x13, 0x16, 0x21, 0x7F, 0x27,
+    0x41, 0x20, 0x0D, 0x8C, 0x26, 0xC2, 0x99, 0x76, 0x68, 0x3D, 0xE0, 0x46, 0xB3, 0x55, 0x4F, 0xF2,
+    0x76, 0x81, 0xDD, 0x11, 0xE1, 0xA2, 0x59, 0xCE, 0xF0, 0x01, 0x65, 0xBC, 0xE3, 0x22, 0xC9, 0x6F,
+    0xCB, 0xE5, 0x77, 0x83, 0x65, 0xE3, 0x32, 0x1D, 0x80, 0x65, 0x1F, 0x09, 0x0D, 0xBA, 0xD3, 0xFD,
+    0x68, 0x05, 0xF6, 0x33, 0xEC, 0x3E, 0x6D, 0x40, 0xF6, 0xAB, 0xCE, 0x8C, 0x86, 0xD8, 0xE0, 0x69,
+    0xC6, 0x55, 0xB8, 0xA8, 0xDE, 0xB8, 0x22, 0x8F, 0x78, 0x0E, 0xE8, 0x21, 0x01, 0xE9, 0x7D, 0xF2,
+    0x20, 0xE2, 0xB6, 0xD8, 0x0E, 0xDA, 0x56, 0x23, 0x2B, 0xD4, 0x87, 0x4A, 0xFD, 0x4C, 0x5F, 0xB0,
+    0xA3, 0x18, 0x28, 0x28, 0x09, 0x2D, 0x97, 0xF1, 0xD2, 0xFC, 0x91, 0xA6, 0x2B, 0x68, 0xE5, 0xFE,
+    0x65, 0xC4, 0xC2, 0xDE, 0xF3, 0xC6, 0x4B, 0x9F, 0xA6, 0xB4, 0x9A, 0xD1, 0xAE, 0xD9, 0xBB, 0xE8,
+    0x23, 0x5E, 0x02, 0xE8, 0x11, 0xDA, 0x39, 0xC2, 0xE6, 0xBD, 0x77, 0x18, 0x9D, 0xD2, 0xB9, 0x5E,
+    0x68, 0xEF, 0x6A, 0x07, 0x36, 0xAA, 0xD4, 0x81, 0xD7, 0x9C, 0xA2, 0x5A, 0xB5, 0xCE, 0xD3, 0xE4,
+    0xB7, 0x14, 0x15, 0xF0, 0xCA, 0x52, 0x31, 0x43, 0xDB, 0xDE, 0x53, 0xC6, 0x79, 0x54, 0xF0, 0x25,
+    0x8E, 0xE2, 0x1B, 0x50, 0xFB, 0x8E, 0xA3, 0xBF, 0xF4, 0xCB, 0x50, 0xE4, 0x68, 0xCD, 0x1F, 0xEB,
+    0xC8, 0x7E, 0x7B, 0xE9, 0xF0, 0x79, 0xC8, 0x7C, 0xD6, 0x53, 0x19, 0x52, 0x6F, 0x90, 0xA5, 0x68,
+    0x3A, 0xC9, 0x46, 0xA1, 0x6B, 0x18, 0xB4, 0xED, 0x88, 0xD4, 0xA5, 0xC4, 0x9D, 0x21, 0xAA, 0xC6,
+    0xB6, 0x7A, 0x76, 0x6C, 0x63, 0xC0, 0xF5, 0xDA, 0x89, 0xF3, 0x7E, 0x17, 0x74, 0x5E, 0xBB, 0xD9,
+    0x5D, 0xBC, 0x39, 0xB9, 0xCD, 0xFB, 0x76, 0x6C, 0xDD, 0xC5, 0xB0, 0x2C, 0x06, 0xE6, 0x4F, 0xED,
+    0xBE, 0xD4, 0xE1, 0xD6, 0x97, 0x22, 0xA5, 0xE2, 0x85, 0x70, 0x66, 0xA9, 0xA4, 0xAD, 0x56, 0x72,
+    0x97, 0x4E, 0x85, 0xC4, 0x65, 0x86, 0xE9, 0xD1, 0xA2, 0x00, 0x09, 0xAB, 0x39, 0x49, 0x4D, 0x82,
+    0x92, 0xE0, 0xB5, 0xAE, 0x32, 0xBC, 0x19, 0x91, 0x23, 0xDD, 0x1B, 0x33, 0x85, 0xC7, 0x2F, 0x53,
+    0xC8, 0x2B, 0x6C, 0xCA, 0xC5, 0x6E, 0xEC, 0xE1, 0x88, 0x99, 0xB5, 0x7D, 0xBA, 0xC6, 0x6C, 0x3D,
+    0xEA, 0x91, 0x53, 0x54, 0x7A, 0xDB, 0x7C, 0x65, 0x6C, 0x55, 0x29, 0xED, 0x37, 0x45, 0xE9, 0x1A,
+    0xCE, 0x76, 0x04, 0xD2, 0x89, 0xE4, 0xFC, 0x16, 0x54, 0x8E, 0xF8, 0xBF, 0x3A, 0x08, 0x7E, 0xDF,
+    0x03, 0xA1, 0x59, 0xEE, 0xDC, 0xCC, 0xAD, 0x29, 0x2A, 0x35, 0xE6, 0x6A, 0xF1, 0xE4, 0x9B, 0xA8,
+    0x7B, 0xC3, 0x41, 0x74, 0x54, 0x49, 0xBD, 0x3B, 0x88, 0xFE, 0x20, 0x97, 0xF2, 0xEA, 0x20, 0xFA,
+    0xA4, 0x93, 0x28, 0x92, 0x79, 0x72, 0xFD, 0xCC, 0x85, 0xE0, 0x2B, 0xA8, 0x90, 0x4C, 0x64, 0x17,
+    0xA2, 0x53, 0x4B, 0xE4, 0xF5, 0x8A, 0xA4, 0x20, 0x1B, 0x77, 0x1A, 0x17, 0x5F, 0x63, 0x82, 0x74,
+    0xC9, 0xD3, 0x96, 0x3B, 0xD6, 0xE8, 0x8D, 0x12, 0xEC, 0xF2, 0x92, 0xED, 0x14, 0xB6, 0x8E, 0xE8,
+    0xAB, 0x91, 0xD9, 0x24, 0xEA, 0xDE, 0xCF, 0x91, 0xDA, 0x76, 0x36, 0x21, 0x33, 0x73, 0xA6, 0xB0,
+    0x0A, 0x80, 0x24, 0x2F, 0x01, 0x9A, 0x61, 0xB1, 0x0C, 0x32, 0x20, 0x02, 0xD3, 0x11, 0xF8, 0x67,
+    0x01, 0xC5, 0xF7, 0x2A, 0x9B, 0x4A, 0x42, 0xE1, 0x45, 0xCF, 0xCE, 0x9D, 0xEE, 0xF7, 0xAB, 0x69,
+    0x3A, 0x67, 0x7B, 0xFE, 0x5D, 0xD0, 0x80, 0x42, 0x46, 0xC5, 0xB5, 0x32, 0x68, 0x2E, 0x83, 0xC1,
+    0x33, 0xBA, 0xDF, 0x69, 0xA9, 0xAC, 0xA4, 0x6A, 0x2A, 0x37, 0x00, 0x11, 0x4A, 0x04, 0x0B, 0xCC,
+    0x9F, 0x8F, 0xF1, 0xED, 0x14, 0x21, 0x91, 0xB8, 0xDB, 0x10, 0x94, 0xC2, 0xFF, 0x4E, 0x4F, 0xAB,
+    0xBF, 0x73, 0xCB, 0x03, 0x5E, 0x99, 0xF3, 0x0E, 0xE6, 0x62, 0x0D, 0x59, 0xAB, 0xB5, 0x17, 0x40,
+    0x35, 0xDE, 0x58, 0x7A, 0xFC, 0xBF, 0x28, 0xD7, 0xD9, 0xFF, 0x02, 0xD3, 0x5A, 0xB5, 0x6A, 0xD5,
+    0x12, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x13, 0x0C, 0x20, 0x00, 0x00, 0xA5, 0x90, 0xBD, 0x11,
+    0x82, 0x40, 0x10, 0x85, 0x1F, 0x32, 0x0C, 0x81, 0x81, 0x26, 0x18, 0x48, 0x80, 0x1D, 0x50, 0xC2,
+    0x5D, 0x09, 0x26, 0x8C, 0xA1, 0xA5, 0x60, 0x09, 0x26, 0x76, 0x60, 0x62, 0x13, 0x62, 0x09, 0x94,
+    0x40, 0x62, 0x4E, 0x60, 0x40, 0xC0, 0xB1, 0xEE, 0x0F, 0xE3, 0x68, 0x2C, 0x73, 0xBC, 0x6F, 0x6E,
+    0x8F, 0xDB, 0xB7, 0x0F, 0x6C, 0xAF, 0x00, 0x62, 0xA2, 0x13, 0xB0, 0x22, 0xEA, 0x01, 0xD7, 0xE6,
+    0x23, 0x50, 0xFB, 0x28, 0x00, 0x0D, 0xC0, 0x3A, 0xA9, 0x7E, 0x96, 0x6E, 0x97, 0x44, 0x6D, 0x40,
+    0xA9, 0x9A, 0x4D, 0x95, 0x0F, 0xBF, 0xDF, 0xFC, 0xB3, 0xCC, 0xCE, 0xAC, 0xDD, 0xF3, 0xCC, 0x5A,
+    0x8A, 0x0B, 0x52, 0x6A, 0x79, 0x54, 0x64, 0x22, 0x8B, 0x1B, 0xF4, 0x71, 0x56, 0x03, 0xD1, 0xA0,
+    0xE5, 0x90, 0x06, 0x61, 0xDC, 0x4B, 0x17, 0xE5, 0x5D, 0x98, 0x76, 0xC6, 0x79, 0x9F, 0x1C, 0x94,
+    0x11, 0xDF, 0xE2, 0x1C, 0x1D, 0xBF, 0x43, 0xC1, 0x2C, 0x9F, 0x9B, 0x3E, 0xA1, 0xCA, 0x3B, 0x8F,
+    0xB5, 0x9C, 0x3B, 0xB9, 0xF2, 0xCD, 0x87, 0xB1, 0x18, 0x8C, 0x3A, 0x90, 0xF4, 0x6B, 0x26, 0xE3,
+    0x92, 0x0B, 0xEA, 0x53, 0xBF, 0x66, 0xDF, 0xD1, 0x18, 0xCD, 0xE4, 0x48, 0xC6, 0x51, 0xF2, 0xED,
+    0xB0, 0x18, 0xF9, 0x47, 0xC3, 0x5D, 0x8E, 0x2F, 0x4E, 0xBA, 0x77, 0x3C, 0x03, 0x0A, 0xEA, 0x72,
+    0x9A, 0xA4, 0x79, 0x87, 0xCC, 0x6B, 0xDE, 0x37, 0x4D, 0x8F, 0xBD, 0x0D, 0xC2, 0x30, 0x14, 0x84,
+    0x2F, 0x76, 0x91, 0x82, 0x82, 0x11, 0xCC, 0x06, 0x1E, 0x01, 0x31, 0x07, 0x8B, 0xD0, 0x25, 0xE3,
+    0x20, 0xB1, 0x02, 0x22, 0xD9, 0x84, 0xF4, 0x34, 0x94, 0x2E, 0x12, 0x1F, 0xF7, 0x6C, 0x47, 0xC2,
+    0xF2, 0xCF, 0xE7, 0xA7, 0xEF, 0x9D, 0x6C, 0xE0, 0x6F, 0xDC, 0xDA, 0xD9, 0xE5, 0x06, 0x3D, 0xC7,
+    0x0A, 0x81, 0x4B, 0x85, 0x81, 0xA9, 0x2A, 0x64, 0x6E, 0xCA, 0xA7, 0x4A, 0x61, 0x41, 0x2C, 0xD2,
+    0x00, 0xF8, 0x54, 0x94, 0x96, 0xD4, 0xF3, 0x72, 0x87, 0x49, 0x81, 0xEF, 0x0C, 0x4B, 0x1A, 0x48,
+    0x42, 0x49, 0x4A, 0x51, 0x8C, 0x66, 0x2F, 0x58, 0x75, 0x1B, 0x83, 0x60, 0xF1, 0x5A, 0x67, 0xC1,
+    0x78, 0x24, 0x53, 0x34, 0x57, 0x0D, 0xDF, 0x03, 0xB9, 0x59, 0xC3, 0xEC, 0xE4, 0x7A, 0xAB, 0x62,
+    0x2A, 0xB0, 0x02, 0x91, 0xF9, 0x21, 0x05, 0x90, 0x64, 0x0A, 0xE0, 0x0A, 0xD8, 0x7B, 0xA6, 0xCD,
+    0x9B, 0x22, 0x29, 0x75, 0xA6, 0x48, 0x12, 0xCC, 0x06, 0x6E, 0x75, 0xAC, 0xFF, 0x7A, 0x5D, 0xD7,
+    0x0A, 0xB1, 0x2A, 0x96, 0x34, 0x57, 0xD8, 0x15, 0xE0, 0xB9, 0xC3, 0xC9, 0xB6, 0x1F,
 };
 
 static const EpdGlyph notosans_18_regularGlyphs[] = {
@@ -2549,99 +2553,99 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 0, 0, 156, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 156, 0, 0, 0, 0 }, // U+0020
     { 6, 28, 161, 2, 27, 42, 0 }, // !
-    { 11, 10, 245, 2, 27, 28, 42 }, // "
-    { 24, 27, 388, 0, 27, 162, 70 }, // #
-    { 18, 32, 343, 2, 29, 144, 232 }, // $
-    { 29, 29, 499, 1, 28, 211, 376 }, // %
-    { 27, 29, 439, 1, 28, 196, 587 }, // &
-    { 4, 10, 135, 2, 27, 10, 783 }, // '
-    { 10, 33, 180, 1, 27, 83, 793 }, // (
-    { 9, 33, 180, 1, 27, 75, 876 }, // )
-    { 19, 18, 331, 1, 29, 86, 951 }, // *
-    { 19, 19, 343, 1, 23, 91, 1037 }, // +
-    { 7, 10, 161, 1, 5, 18, 1128 }, // ,
-    { 10, 4, 193, 1, 12, 10, 1146 }, // -
-    { 6, 6, 161, 2, 5, 9, 1156 }, // .
-    { 14, 27, 223, 0, 27, 95, 1165 }, // /
-    { 18, 29, 350, 2, 28, 131, 1260 }, // 0
-    { 11, 27, 265, 0, 27, 75, 1391 }, // 1
-    { 19, 28, 333, 1, 28, 133, 1466 }, // 2
-    { 19, 29, 343, 1, 28, 138, 1599 }, // 3
-    { 21, 27, 343, 0, 27, 142, 1737 }, // 4
-    { 18, 28, 343, 2, 27, 126, 1879 }, // 5
-    { 18, 29, 343, 2, 28, 131, 2005 }, // 6
-    { 19, 27, 307, 0, 27, 129, 2136 }, // 7
-    { 18, 29, 353, 2, 28, 131, 2265 }, // 8
-    { 19, 29, 343, 1, 28, 138, 2396 }, // 9
-    { 6, 22, 161, 2, 21, 33, 2534 }, // :
-    { 7, 26, 161, 1, 21, 46, 2567 }, // ;
-    { 19, 19, 343, 1, 23, 91, 2613 }, // <
-    { 18, 11, 343, 2, 19, 50, 2704 }, // =
-    { 19, 19, 343, 1, 23, 91, 2754 }, // >
-    { 16, 29, 260, 0, 28, 116, 2845 }, // ?
-    { 30, 31, 539, 2, 27, 233, 2961 }, // @
-    { 24, 27, 383, 0, 27, 162, 3194 }, // A
-    { 20, 27, 390, 3, 27, 135, 3356 }, // B
-    { 21, 29, 379, 2, 28, 153, 3491 }, // C
-    { 23, 27, 438, 3, 27, 156, 3644 }, // D
-    { 16, 27, 334, 3, 27, 108, 3800 }, // E
-    { 16, 27, 311, 3, 27, 108, 3908 }, // F
-    { 23, 29, 437, 2, 28, 167, 4016 }, // G
-    { 22, 27, 445, 3, 27, 149, 4183 }, // H
-    { 11, 27, 203, 1, 27, 75, 4332 }, // I
-    { 10, 35, 164, -3, 27, 88, 4407 }, // J
-    { 21, 27, 371, 3, 27, 142, 4495 }, // K
-    { 16, 27, 314, 3, 27, 108, 4637 }, // L
-    { 28, 27, 544, 3, 27, 189, 4745 }, // M
-    { 22, 27, 456, 3, 27, 149, 4934 }, // N
-    { 25, 29, 469, 2, 28, 182, 5083 }, // O
-    { 18, 27, 363, 3, 27, 122, 5265 }, // P
-    { 25, 35, 469, 2, 28, 219, 5387 }, // Q
-    { 20, 27, 373, 3, 27, 135, 5606 }, // R
-    { 18, 29, 329, 1, 28, 131, 5741 }, // S
-    { 21, 27, 334, 0, 27, 142, 5872 }, // T
-    { 21, 28, 439, 3, 27, 147, 6014 }, // U
-    { 23, 27, 360, 0, 27, 156, 6161 }, // V
-    { 35, 27, 558, 0, 27, 237, 6317 }, // W
-    { 22, 27, 352, 0, 27, 149, 6554 }, // X
-    { 22, 27, 340, 0, 27, 149, 6703 }, // Y
-    { 19, 27, 343, 1, 27, 129, 6852 }, // Z
-    { 9, 33, 197, 3, 27, 75, 6981 }, // [
-    { 14, 27, 223, 0, 27, 95, 7056 }, // <backslash>
-    { 10, 33, 197, 0, 27, 83, 7151 }, // ]
-    { 20, 17, 343, 1, 27, 85, 7234 }, // ^
-    { 18, 3, 266, -1, -3, 14, 7319 }, // _
-    { 9, 7, 169, 1, 29, 16, 7333 }, // `
-    { 17, 22, 337, 1, 21, 94, 7349 }, // a
-    { 18, 30, 369, 3, 29, 135, 7443 }, // b
-    { 15, 22, 288, 2, 21, 83, 7578 }, // c
-    { 18, 30, 369, 2, 29, 135, 7661 }, // d
-    { 18, 22, 338, 2, 21, 99, 7796 }, // e
-    { 15, 29, 206, 0, 29, 109, 7895 }, // f
-    { 18, 30, 369, 2, 21, 135, 8004 }, // g
-    { 18, 29, 371, 3, 29, 131, 8139 }, // h
-    { 5, 28, 155, 2, 28, 35, 8270 }, // i
-    { 10, 37, 155, -3, 28, 93, 8305 }, // j
-    { 17, 29, 320, 3, 29, 124, 8398 }, // k
-    { 4, 29, 155, 3, 29, 29, 8522 }, // l
-    { 30, 21, 561, 3, 21, 158, 8551 }, // m
-    { 18, 21, 371, 3, 21, 95, 8709 }, // n
-    { 19, 22, 363, 2, 21, 105, 8804 }, // o
-    { 18, 30, 369, 3, 21, 135, 8909 }, // p
-    { 18, 30, 369, 2, 21, 135, 9044 }, // q
-    { 12, 21, 248, 3, 21, 63, 9179 }, // r
-    { 16, 22, 287, 1, 21, 88, 9242 }, // s
-    { 13, 26, 217, 0, 25, 85, 9330 }, // t
-    { 18, 22, 371, 2, 21, 99, 9415 }, // u
-    { 20, 21, 305, 0, 21, 105, 9514 }, // v
-    { 30, 21, 472, 0, 21, 158, 9619 }, // w
-    { 20, 21, 317, 0, 21, 105, 9777 }, // x
-    { 20, 30, 306, 0, 21, 150, 9882 }, // y
-    { 16, 21, 282, 1, 21, 84, 10032 }, // z
-    { 13, 33, 228, 1, 27, 108, 10116 }, // {
-    { 4, 39, 331, 8, 29, 39, 10224 }, // |
-    { 13, 33, 228, 1, 27, 108, 10263 }, // }
-    { 19, 6, 343, 1, 16, 29, 10371 }, // ~
+    { 11, 10, 245, 2, 27, 28, 0 }, // "
+    { 24, 27, 388, 0, 27, 162, 28 }, // #
+    { 18, 32, 343, 2, 29, 144, 190 }, // $
+    { 29, 29, 499, 1, 28, 211, 334 }, // %
+    { 27, 29, 439, 1, 28, 196, 545 }, // &
+    { 4, 10, 135, 2, 27, 10, 741 }, // '
+    { 10, 33, 180, 1, 27, 83, 42 }, // (
+    { 9, 33, 180, 1, 27, 75, 125 }, // )
+    { 19, 18, 331, 1, 29, 86, 751 }, // *
+    { 19, 19, 343, 1, 23, 91, 837 }, // +
+    { 7, 10, 161, 1, 5, 18, 200 }, // ,
+    { 10, 4, 193, 1, 12, 10, 218 }, // -
+    { 6, 6, 161, 2, 5, 9, 228 }, // .
+    { 14, 27, 223, 0, 27, 95, 928 }, // /
+    { 18, 29, 350, 2, 28, 131, 237 }, // 0
+    { 11, 27, 265, 0, 27, 75, 368 }, // 1
+    { 19, 28, 333, 1, 28, 133, 443 }, // 2
+    { 19, 29, 343, 1, 28, 138, 576 }, // 3
+    { 21, 27, 343, 0, 27, 142, 714 }, // 4
+    { 18, 28, 343, 2, 27, 126, 856 }, // 5
+    { 18, 29, 343, 2, 28, 131, 982 }, // 6
+    { 19, 27, 307, 0, 27, 129, 1113 }, // 7
+    { 18, 29, 353, 2, 28, 131, 1242 }, // 8
+    { 19, 29, 343, 1, 28, 138, 1373 }, // 9
+    { 6, 22, 161, 2, 21, 33, 1511 }, // :
+    { 7, 26, 161, 1, 21, 46, 1544 }, // ;
+    { 19, 19, 343, 1, 23, 91, 1023 }, // <
+    { 18, 11, 343, 2, 19, 50, 1114 }, // =
+    { 19, 19, 343, 1, 23, 91, 1164 }, // >
+    { 16, 29, 260, 0, 28, 116, 1590 }, // ?
+    { 30, 31, 539, 2, 27, 233, 1255 }, // @
+    { 24, 27, 383, 0, 27, 162, 1706 }, // A
+    { 20, 27, 390, 3, 27, 135, 1868 }, // B
+    { 21, 29, 379, 2, 28, 153, 2003 }, // C
+    { 23, 27, 438, 3, 27, 156, 2156 }, // D
+    { 16, 27, 334, 3, 27, 108, 2312 }, // E
+    { 16, 27, 311, 3, 27, 108, 2420 }, // F
+    { 23, 29, 437, 2, 28, 167, 2528 }, // G
+    { 22, 27, 445, 3, 27, 149, 2695 }, // H
+    { 11, 27, 203, 1, 27, 75, 2844 }, // I
+    { 10, 35, 164, -3, 27, 88, 2919 }, // J
+    { 21, 27, 371, 3, 27, 142, 3007 }, // K
+    { 16, 27, 314, 3, 27, 108, 3149 }, // L
+    { 28, 27, 544, 3, 27, 189, 3257 }, // M
+    { 22, 27, 456, 3, 27, 149, 3446 }, // N
+    { 25, 29, 469, 2, 28, 182, 3595 }, // O
+    { 18, 27, 363, 3, 27, 122, 3777 }, // P
+    { 25, 35, 469, 2, 28, 219, 3899 }, // Q
+    { 20, 27, 373, 3, 27, 135, 4118 }, // R
+    { 18, 29, 329, 1, 28, 131, 4253 }, // S
+    { 21, 27, 334, 0, 27, 142, 4384 }, // T
+    { 21, 28, 439, 3, 27, 147, 1488 }, // U
+    { 23, 27, 360, 0, 27, 156, 4526 }, // V
+    { 35, 27, 558, 0, 27, 237, 4682 }, // W
+    { 22, 27, 352, 0, 27, 149, 4919 }, // X
+    { 22, 27, 340, 0, 27, 149, 5068 }, // Y
+    { 19, 27, 343, 1, 27, 129, 5217 }, // Z
+    { 9, 33, 197, 3, 27, 75, 1635 }, // [
+    { 14, 27, 223, 0, 27, 95, 1710 }, // <backslash>
+    { 10, 33, 197, 0, 27, 83, 1805 }, // ]
+    { 20, 17, 343, 1, 27, 85, 1888 }, // ^
+    { 18, 3, 266, -1, -3, 14, 1973 }, // _
+    { 9, 7, 169, 1, 29, 16, 1987 }, // `
+    { 17, 22, 337, 1, 21, 94, 5346 }, // a
+    { 18, 30, 369, 3, 29, 135, 5440 }, // b
+    { 15, 22, 288, 2, 21, 83, 5575 }, // c
+    { 18, 30, 369, 2, 29, 135, 5658 }, // d
+    { 18, 22, 338, 2, 21, 99, 5793 }, // e
+    { 15, 29, 206, 0, 29, 109, 5892 }, // f
+    { 18, 30, 369, 2, 21, 135, 6001 }, // g
+    { 18, 29, 371, 3, 29, 131, 6136 }, // h
+    { 5, 28, 155, 2, 28, 35, 6267 }, // i
+    { 10, 37, 155, -3, 28, 93, 6302 }, // j
+    { 17, 29, 320, 3, 29, 124, 6395 }, // k
+    { 4, 29, 155, 3, 29, 29, 6519 }, // l
+    { 30, 21, 561, 3, 21, 158, 6548 }, // m
+    { 18, 21, 371, 3, 21, 95, 6706 }, // n
+    { 19, 22, 363, 2, 21, 105, 6801 }, // o
+    { 18, 30, 369, 3, 21, 135, 6906 }, // p
+    { 18, 30, 369, 2, 21, 135, 7041 }, // q
+    { 12, 21, 248, 3, 21, 63, 7176 }, // r
+    { 16, 22, 287, 1, 21, 88, 7239 }, // s
+    { 13, 26, 217, 0, 25, 85, 7327 }, // t
+    { 18, 22, 371, 2, 21, 99, 7412 }, // u
+    { 20, 21, 305, 0, 21, 105, 7511 }, // v
+    { 30, 21, 472, 0, 21, 158, 7616 }, // w
+    { 20, 21, 317, 0, 21, 105, 7774 }, // x
+    { 20, 30, 306, 0, 21, 150, 7879 }, // y
+    { 16, 21, 282, 1, 21, 84, 8029 }, // z
+    { 13, 33, 228, 1, 27, 108, 2003 }, // {
+    { 4, 39, 331, 8, 29, 39, 2111 }, // |
+    { 13, 33, 228, 1, 27, 108, 2150 }, // }
+    { 19, 6, 343, 1, 16, 29, 2258 }, // ~
     { 0, 0, 156, 0, 0, 0, 0 }, // U+00A0
     { 6, 28, 161, 2, 21, 42, 0 }, // U+00A1
     { 16, 29, 343, 3, 28, 116, 42 }, // U+00A2
@@ -2725,19 +2729,19 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 19, 30, 363, 2, 29, 143, 10297 }, // U+00F0
     { 18, 28, 371, 3, 28, 126, 10440 }, // U+00F1
     { 19, 30, 363, 2, 29, 143, 10566 }, // U+00F2
-    { 19, 30, 363, 2, 29, 143, 10709 }, // U+00F3
-    { 19, 30, 363, 2, 29, 143, 10852 }, // U+00F4
-    { 19, 29, 363, 2, 28, 138, 10995 }, // U+00F5
-    { 19, 29, 363, 2, 28, 138, 11133 }, // U+00F6
-    { 19, 18, 343, 1, 22, 86, 11271 }, // U+00F7
-    { 19, 24, 363, 2, 22, 114, 11357 }, // U+00F8
-    { 18, 30, 371, 2, 29, 135, 11471 }, // U+00F9
-    { 18, 30, 371, 2, 29, 135, 11606 }, // U+00FA
-    { 18, 30, 371, 2, 29, 135, 11741 }, // U+00FB
-    { 18, 29, 371, 2, 28, 131, 11876 }, // U+00FC
-    { 20, 38, 306, 0, 29, 190, 12007 }, // U+00FD
-    { 18, 38, 369, 3, 29, 171, 12197 }, // U+00FE
-    { 20, 37, 306, 0, 28, 185, 12368 }, // U+00FF
+    { 19, 30, 363, 2, 29, 143, 8113 }, // U+00F3
+    { 19, 30, 363, 2, 29, 143, 10709 }, // U+00F4
+    { 19, 29, 363, 2, 28, 138, 10852 }, // U+00F5
+    { 19, 29, 363, 2, 28, 138, 10990 }, // U+00F6
+    { 19, 18, 343, 1, 22, 86, 11128 }, // U+00F7
+    { 19, 24, 363, 2, 22, 114, 11214 }, // U+00F8
+    { 18, 30, 371, 2, 29, 135, 11328 }, // U+00F9
+    { 18, 30, 371, 2, 29, 135, 11463 }, // U+00FA
+    { 18, 30, 371, 2, 29, 135, 11598 }, // U+00FB
+    { 18, 29, 371, 2, 28, 131, 11733 }, // U+00FC
+    { 20, 38, 306, 0, 29, 190, 11864 }, // U+00FD
+    { 18, 38, 369, 3, 29, 171, 12054 }, // U+00FE
+    { 20, 37, 306, 0, 28, 185, 12225 }, // U+00FF
     { 24, 33, 383, 0, 33, 198, 0 }, // U+0100
     { 17, 27, 337, 1, 26, 115, 198 }, // U+0101
     { 24, 35, 383, 0, 35, 210, 313 }, // U+0102
@@ -3439,98 +3443,98 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 10, 4, 193, 1, 12, 10, 140 }, // U+2010
     { 10, 4, 193, 1, 12, 10, 150 }, // U+2011
     { 19, 3, 343, 1, 15, 15, 160 }, // U+2012
-    { 17, 4, 300, 1, 12, 17, 175 }, // U+2013
-    { 35, 4, 600, 1, 12, 35, 192 }, // U+2014
-    { 35, 4, 600, 1, 12, 35, 227 }, // U+2015
-    { 12, 39, 331, 4, 29, 117, 262 }, // U+2016
-    { 17, 9, 247, -1, 0, 39, 379 }, // U+2017
-    { 7, 10, 105, 0, 27, 18, 418 }, // U+2018
-    { 7, 10, 105, 0, 27, 18, 436 }, // U+2019
-    { 6, 10, 150, 1, 5, 15, 454 }, // U+201A
-    { 7, 10, 105, 0, 27, 18, 469 }, // U+201B
-    { 14, 10, 215, 0, 27, 35, 487 }, // U+201C
-    { 14, 10, 215, 0, 27, 35, 522 }, // U+201D
-    { 13, 10, 250, 1, 5, 33, 557 }, // U+201E
-    { 14, 10, 215, 0, 27, 35, 590 }, // U+201F
-    { 15, 29, 307, 2, 29, 109, 625 }, // U+2020
-    { 15, 29, 307, 2, 29, 109, 734 }, // U+2021
-    { 10, 10, 226, 2, 19, 25, 843 }, // U+2022
-    { 11, 12, 221, 2, 20, 33, 868 }, // U+2023
-    { 5, 6, 300, 7, 5, 8, 901 }, // U+2024
-    { 16, 6, 322, 2, 5, 24, 909 }, // U+2025
-    { 25, 6, 475, 2, 5, 38, 933 }, // U+2026
-    { 6, 6, 161, 2, 12, 9, 971 }, // U+2027
-    { 0, 0, 360, 0, 0, 0, 980 }, // U+2028
-    { 0, 0, 360, 0, 0, 0, 980 }, // U+2029
-    { 9, 28, 0, -1, 23, 63, 980 }, // U+202A
-    { 9, 28, 0, -8, 23, 63, 1043 }, // U+202B
-    { 10, 31, 0, -5, 26, 78, 1106 }, // U+202C
-    { 10, 31, 0, -5, 26, 78, 1184 }, // U+202D
-    { 10, 31, 0, -5, 26, 78, 1262 }, // U+202E
-    { 0, 0, 100, 0, 0, 0, 1340 }, // U+202F
-    { 42, 29, 706, 1, 28, 305, 1340 }, // U+2030
-    { 56, 29, 926, 1, 28, 406, 1645 }, // U+2031
-    { 9, 10, 139, 1, 27, 23, 2051 }, // U+2032
-    { 16, 10, 245, 1, 27, 40, 2074 }, // U+2033
-    { 22, 10, 350, 1, 27, 55, 2114 }, // U+2034
-    { 9, 10, 139, -1, 27, 23, 2169 }, // U+2035
-    { 15, 10, 264, -1, 27, 38, 2192 }, // U+2036
-    { 21, 10, 361, -1, 27, 53, 2230 }, // U+2037
-    { 15, 13, 239, 0, 4, 49, 2283 }, // U+2038
-    { 10, 16, 186, 1, 18, 40, 2332 }, // U+2039
-    { 10, 16, 186, 1, 18, 40, 2372 }, // U+203A
-    { 29, 29, 502, 1, 28, 211, 2412 }, // U+203B
-    { 14, 28, 299, 2, 27, 98, 2623 }, // U+203C
-    { 16, 29, 266, 0, 28, 116, 2721 }, // U+203D
-    { 20, 3, 300, -1, 31, 15, 2837 }, // U+203E
-    { 22, 8, 365, 0, -1, 44, 2852 }, // U+203F
-    { 22, 9, 365, 0, 30, 50, 2896 }, // U+2040
-    { 14, 25, 224, 0, 16, 88, 2946 }, // U+2041
-    { 42, 35, 671, 0, 29, 368, 3034 }, // U+2042
-    { 10, 4, 193, 1, 12, 10, 3402 }, // U+2043
-    { 20, 27, 78, -8, 27, 135, 3412 }, // U+2044
-    { 10, 33, 194, 2, 27, 83, 3547 }, // U+2045
-    { 10, 33, 194, 0, 27, 83, 3630 }, // U+2046
-    { 32, 29, 513, 0, 28, 232, 3713 }, // U+2047
-    { 23, 29, 407, 0, 28, 167, 3945 }, // U+2048
-    { 23, 29, 409, 2, 28, 167, 4112 }, // U+2049
-    { 19, 21, 343, 1, 21, 100, 4279 }, // U+204A
-    { 20, 34, 393, 3, 29, 170, 4379 }, // U+204B
-    { 19, 20, 383, 2, 21, 95, 4549 }, // U+204C
-    { 19, 20, 383, 3, 21, 95, 4644 }, // U+204D
-    { 19, 18, 331, 1, 10, 86, 4739 }, // U+204E
-    { 7, 26, 142, 1, 21, 46, 4825 }, // U+204F
-    { 22, 39, 363, 0, 30, 215, 4871 }, // U+2050
-    { 19, 37, 331, 1, 29, 176, 5086 }, // U+2051
-    { 14, 29, 223, 0, 28, 102, 5262 }, // U+2052
-    { 33, 6, 600, 2, 14, 50, 5364 }, // U+2053
-    { 22, 9, 363, 0, 0, 50, 5414 }, // U+2054
-    { 20, 20, 343, 1, 19, 100, 5464 }, // U+2055
-    { 17, 29, 310, 1, 28, 124, 5564 }, // U+2056
-    { 28, 10, 445, 1, 27, 70, 5688 }, // U+2057
-    { 28, 29, 493, 1, 28, 203, 5758 }, // U+2058
-    { 29, 29, 497, 1, 28, 211, 5961 }, // U+2059
-    { 6, 29, 133, 1, 28, 44, 6172 }, // U+205A
-    { 22, 30, 392, 1, 29, 165, 6216 }, // U+205B
-    { 28, 29, 478, 1, 28, 203, 6381 }, // U+205C
-    { 6, 28, 161, 2, 27, 42, 6584 }, // U+205D
-    { 6, 29, 161, 2, 28, 44, 6626 }, // U+205E
-    { 0, 0, 133, 0, 0, 0, 6670 }, // U+205F
-    { 0, 0, 360, 0, 0, 0, 6670 }, // U+2060
-    { 0, 0, 360, 0, 0, 0, 6670 }, // U+2061
-    { 0, 0, 360, 0, 0, 0, 6670 }, // U+2062
-    { 0, 0, 360, 0, 0, 0, 6670 }, // U+2063
-    { 0, 0, 360, 0, 0, 0, 6670 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 6670 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 6670 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 6670 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 6670 }, // U+2069
-    { 10, 31, 0, -5, 26, 78, 6670 }, // U+206A
-    { 10, 31, 0, -5, 26, 78, 6748 }, // U+206B
-    { 10, 31, 0, -5, 26, 78, 6826 }, // U+206C
-    { 10, 31, 0, -5, 26, 78, 6904 }, // U+206D
-    { 10, 31, 0, -5, 26, 78, 6982 }, // U+206E
-    { 10, 31, 0, -5, 26, 78, 7060 }, // U+206F
+    { 17, 4, 300, 1, 12, 17, 8256 }, // U+2013
+    { 35, 4, 600, 1, 12, 35, 8273 }, // U+2014
+    { 35, 4, 600, 1, 12, 35, 175 }, // U+2015
+    { 12, 39, 331, 4, 29, 117, 210 }, // U+2016
+    { 17, 9, 247, -1, 0, 39, 327 }, // U+2017
+    { 7, 10, 105, 0, 27, 18, 366 }, // U+2018
+    { 7, 10, 105, 0, 27, 18, 8308 }, // U+2019
+    { 6, 10, 150, 1, 5, 15, 384 }, // U+201A
+    { 7, 10, 105, 0, 27, 18, 399 }, // U+201B
+    { 14, 10, 215, 0, 27, 35, 8326 }, // U+201C
+    { 14, 10, 215, 0, 27, 35, 8361 }, // U+201D
+    { 13, 10, 250, 1, 5, 33, 417 }, // U+201E
+    { 14, 10, 215, 0, 27, 35, 450 }, // U+201F
+    { 15, 29, 307, 2, 29, 109, 485 }, // U+2020
+    { 15, 29, 307, 2, 29, 109, 594 }, // U+2021
+    { 10, 10, 226, 2, 19, 25, 703 }, // U+2022
+    { 11, 12, 221, 2, 20, 33, 728 }, // U+2023
+    { 5, 6, 300, 7, 5, 8, 761 }, // U+2024
+    { 16, 6, 322, 2, 5, 24, 769 }, // U+2025
+    { 25, 6, 475, 2, 5, 38, 8396 }, // U+2026
+    { 6, 6, 161, 2, 12, 9, 793 }, // U+2027
+    { 0, 0, 360, 0, 0, 0, 802 }, // U+2028
+    { 0, 0, 360, 0, 0, 0, 802 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 802 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 865 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 928 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 1006 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 1084 }, // U+202E
+    { 0, 0, 100, 0, 0, 0, 1162 }, // U+202F
+    { 42, 29, 706, 1, 28, 305, 1162 }, // U+2030
+    { 56, 29, 926, 1, 28, 406, 1467 }, // U+2031
+    { 9, 10, 139, 1, 27, 23, 1873 }, // U+2032
+    { 16, 10, 245, 1, 27, 40, 1896 }, // U+2033
+    { 22, 10, 350, 1, 27, 55, 1936 }, // U+2034
+    { 9, 10, 139, -1, 27, 23, 1991 }, // U+2035
+    { 15, 10, 264, -1, 27, 38, 2014 }, // U+2036
+    { 21, 10, 361, -1, 27, 53, 2052 }, // U+2037
+    { 15, 13, 239, 0, 4, 49, 2105 }, // U+2038
+    { 10, 16, 186, 1, 18, 40, 2154 }, // U+2039
+    { 10, 16, 186, 1, 18, 40, 2194 }, // U+203A
+    { 29, 29, 502, 1, 28, 211, 2234 }, // U+203B
+    { 14, 28, 299, 2, 27, 98, 2445 }, // U+203C
+    { 16, 29, 266, 0, 28, 116, 2543 }, // U+203D
+    { 20, 3, 300, -1, 31, 15, 2659 }, // U+203E
+    { 22, 8, 365, 0, -1, 44, 2674 }, // U+203F
+    { 22, 9, 365, 0, 30, 50, 2718 }, // U+2040
+    { 14, 25, 224, 0, 16, 88, 2768 }, // U+2041
+    { 42, 35, 671, 0, 29, 368, 2856 }, // U+2042
+    { 10, 4, 193, 1, 12, 10, 3224 }, // U+2043
+    { 20, 27, 78, -8, 27, 135, 3234 }, // U+2044
+    { 10, 33, 194, 2, 27, 83, 3369 }, // U+2045
+    { 10, 33, 194, 0, 27, 83, 3452 }, // U+2046
+    { 32, 29, 513, 0, 28, 232, 3535 }, // U+2047
+    { 23, 29, 407, 0, 28, 167, 3767 }, // U+2048
+    { 23, 29, 409, 2, 28, 167, 3934 }, // U+2049
+    { 19, 21, 343, 1, 21, 100, 4101 }, // U+204A
+    { 20, 34, 393, 3, 29, 170, 4201 }, // U+204B
+    { 19, 20, 383, 2, 21, 95, 4371 }, // U+204C
+    { 19, 20, 383, 3, 21, 95, 4466 }, // U+204D
+    { 19, 18, 331, 1, 10, 86, 4561 }, // U+204E
+    { 7, 26, 142, 1, 21, 46, 4647 }, // U+204F
+    { 22, 39, 363, 0, 30, 215, 4693 }, // U+2050
+    { 19, 37, 331, 1, 29, 176, 4908 }, // U+2051
+    { 14, 29, 223, 0, 28, 102, 5084 }, // U+2052
+    { 33, 6, 600, 2, 14, 50, 5186 }, // U+2053
+    { 22, 9, 363, 0, 0, 50, 5236 }, // U+2054
+    { 20, 20, 343, 1, 19, 100, 5286 }, // U+2055
+    { 17, 29, 310, 1, 28, 124, 5386 }, // U+2056
+    { 28, 10, 445, 1, 27, 70, 5510 }, // U+2057
+    { 28, 29, 493, 1, 28, 203, 5580 }, // U+2058
+    { 29, 29, 497, 1, 28, 211, 5783 }, // U+2059
+    { 6, 29, 133, 1, 28, 44, 5994 }, // U+205A
+    { 22, 30, 392, 1, 29, 165, 6038 }, // U+205B
+    { 28, 29, 478, 1, 28, 203, 6203 }, // U+205C
+    { 6, 28, 161, 2, 27, 42, 6406 }, // U+205D
+    { 6, 29, 161, 2, 28, 44, 6448 }, // U+205E
+    { 0, 0, 133, 0, 0, 0, 6492 }, // U+205F
+    { 0, 0, 360, 0, 0, 0, 6492 }, // U+2060
+    { 0, 0, 360, 0, 0, 0, 6492 }, // U+2061
+    { 0, 0, 360, 0, 0, 0, 6492 }, // U+2062
+    { 0, 0, 360, 0, 0, 0, 6492 }, // U+2063
+    { 0, 0, 360, 0, 0, 0, 6492 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 6492 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 6492 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 6492 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 6492 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 6492 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 6570 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 6648 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 6726 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 6804 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 6882 }, // U+206F
     { 13, 17, 210, 0, 32, 56, 0 }, // U+2070
     { 4, 18, 101, 1, 28, 18, 56 }, // U+2071
     { 13, 17, 210, 0, 32, 56, 74 }, // U+2074
@@ -3607,13 +3611,13 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 18, 35, 343, 3, 31, 158, 5199 }, // U+20BF
     { 16, 27, 296, 1, 21, 108, 5357 }, // U+20C0
     { 19, 4, 343, 1, 15, 19, 0 }, // U+2212
-    { 28, 29, 413, 0, 29, 203, 0 }, // U+FB00
-    { 20, 29, 361, 0, 29, 145, 203 }, // U+FB01
-    { 20, 29, 361, 0, 29, 145, 348 }, // U+FB02
-    { 33, 29, 568, 0, 29, 240, 493 }, // U+FB03
-    { 33, 29, 568, 0, 29, 240, 733 }, // U+FB04
-    { 22, 30, 404, 3, 29, 165, 973 }, // U+FB05
-    { 30, 30, 504, 1, 29, 225, 1138 }, // U+FB06
+    { 28, 29, 413, 0, 29, 203, 8434 }, // U+FB00
+    { 20, 29, 361, 0, 29, 145, 8637 }, // U+FB01
+    { 20, 29, 361, 0, 29, 145, 8782 }, // U+FB02
+    { 33, 29, 568, 0, 29, 240, 8927 }, // U+FB03
+    { 33, 29, 568, 0, 29, 240, 9167 }, // U+FB04
+    { 22, 30, 404, 3, 29, 165, 0 }, // U+FB05
+    { 30, 30, 504, 1, 29, 225, 165 }, // U+FB06
     { 35, 35, 600, 1, 29, 307, 0 }, // U+FFFD
 };
 
@@ -3621,8 +3625,7 @@ static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3630,8 +3633,7 @@ static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3641,19 +3643,57 @@ static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
 };
 
 static const EpdFontGroup notosans_18_regularGroups[] = {
-    { 0, 4225, 11305, 97, 0 },
-    { 4225, 3849, 13593, 96, 97 },
-    { 8074, 4689, 20862, 128, 193 },
-    { 12763, 4564, 19030, 96, 321 },
-    { 17327, 1557, 2918, 112, 417 },
-    { 18884, 12105, 43779, 256, 529 },
-    { 30989, 2979, 17860, 90, 785 },
-    { 33968, 2689, 7797, 111, 875 },
-    { 36657, 799, 1999, 42, 986 },
-    { 37456, 2511, 5853, 33, 1028 },
-    { 39967, 17, 20, 1, 1061 },
-    { 39984, 371, 1435, 7, 1062 },
-    { 40355, 166, 315, 1, 1069 },
+    { 0, 3515, 10157, 83, 2 },
+    { 3515, 1053, 2511, 26, 0 },
+    { 4568, 3830, 13443, 95, 97 },
+    { 8398, 4689, 20862, 128, 193 },
+    { 13087, 4564, 19030, 96, 321 },
+    { 17651, 1557, 2918, 112, 417 },
+    { 19208, 12105, 43779, 256, 529 },
+    { 31313, 2979, 17860, 90, 785 },
+    { 34292, 2601, 7599, 105, 875 },
+    { 36893, 799, 1999, 42, 986 },
+    { 37692, 2511, 5853, 33, 1028 },
+    { 40203, 17, 20, 1, 1061 },
+    { 40220, 204, 420, 2, 1067 },
+    { 40424, 166, 315, 1, 1069 },
+};
+
+static const uint16_t notosans_18_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notosans_18_regularKernLeftClasses[] = {
@@ -4712,18 +4752,81 @@ static const EpdLigaturePair notosans_18_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notosans_18_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 4 }, { 0x000C, 0, 0 }, { 0x000D, 0, 0 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 4, 5 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 6, 7 }, { 0x001D, 0, 7 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 8 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 9 }, { 0x0024, 8, 0 }, { 0x0025, 9, 10 }, { 0x0026, 10, 0 }, { 0x0027, 11, 0 }, { 0x0028, 12, 0 }, { 0x0029, 0, 10 }, // U+0040
+    { 0x002A, 0, 0 }, { 0x002B, 0, 11 }, { 0x002C, 0, 12 }, { 0x002D, 9, 0 }, { 0x002E, 13, 0 }, { 0x002F, 0, 0 }, { 0x0030, 0, 0 }, { 0x0031, 10, 10 }, // U+0048
+    { 0x0032, 14, 0 }, { 0x0033, 10, 10 }, { 0x0034, 15, 0 }, { 0x0035, 0, 0 }, { 0x0036, 16, 13 }, { 0x0037, 17, 14 }, { 0x0038, 18, 15 }, { 0x0039, 18, 15 }, // U+0050
+    { 0x003A, 9, 16 }, { 0x003B, 19, 17 }, { 0x003C, 20, 18 }, { 0x003D, 3, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 21, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 22, 19 }, { 0x0044, 23, 20 }, { 0x0045, 24, 21 }, { 0x0046, 0, 21 }, { 0x0047, 23, 21 }, { 0x0048, 25, 22 }, { 0x0049, 0, 23 }, // U+0060
+    { 0x004A, 22, 20 }, { 0x004B, 0, 0 }, { 0x004C, 0, 24 }, { 0x004D, 0, 20 }, { 0x004E, 0, 20 }, { 0x004F, 22, 25 }, { 0x0050, 22, 25 }, { 0x0051, 23, 21 }, // U+0068
+    { 0x0052, 23, 25 }, { 0x0053, 0, 21 }, { 0x0054, 26, 25 }, { 0x0055, 0, 26 }, { 0x0056, 24, 22 }, { 0x0057, 0, 25 }, { 0x0058, 27, 27 }, { 0x0059, 27, 27 }, // U+0070
+    { 0x005A, 28, 27 }, { 0x005B, 27, 27 }, { 0x005C, 0, 28 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 29, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 30, 29 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 31, 30 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 32, 0 }, // U+00B8
+    { 0x0081, 7, 9 }, { 0x0082, 7, 9 }, { 0x0083, 7, 9 }, { 0x0084, 7, 9 }, { 0x0085, 7, 9 }, { 0x0086, 7, 9 }, { 0x0087, 11, 31 }, { 0x0088, 9, 10 }, // U+00C0
+    { 0x0089, 11, 0 }, { 0x008A, 11, 0 }, { 0x008B, 11, 0 }, { 0x008C, 11, 0 }, { 0x008D, 0, 0 }, { 0x008E, 0, 0 }, { 0x008F, 0, 0 }, { 0x0090, 0, 0 }, // U+00C8
+    { 0x0091, 10, 0 }, { 0x0092, 0, 0 }, { 0x0093, 10, 10 }, { 0x0094, 10, 10 }, { 0x0095, 10, 10 }, { 0x0096, 10, 10 }, { 0x0097, 10, 10 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 10 }, { 0x009A, 17, 14 }, { 0x009B, 17, 14 }, { 0x009C, 17, 14 }, { 0x009D, 17, 14 }, { 0x009E, 19, 17 }, { 0x009F, 14, 0 }, { 0x00A0, 0, 0 }, // U+00D8
+    { 0x00A1, 22, 21 }, { 0x00A2, 22, 19 }, { 0x00A3, 22, 19 }, { 0x00A4, 22, 19 }, { 0x00A5, 22, 19 }, { 0x00A6, 22, 19 }, { 0x00A7, 23, 19 }, { 0x00A8, 0, 21 }, // U+00E0
+    { 0x00A9, 23, 21 }, { 0x00AA, 23, 21 }, { 0x00AB, 23, 21 }, { 0x00AC, 23, 21 }, { 0x00AD, 0, 0 }, { 0x00AE, 0, 0 }, { 0x00AF, 33, 0 }, { 0x00B0, 33, 0 }, // U+00E8
+    { 0x00B1, 23, 0 }, { 0x00B2, 0, 0 }, { 0x00B3, 23, 21 }, { 0x00B4, 23, 21 }, { 0x00B5, 23, 21 }, { 0x00B6, 23, 21 }, { 0x00B7, 23, 21 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 23, 21 }, { 0x00BA, 0, 25 }, { 0x00BB, 0, 25 }, { 0x00BC, 0, 25 }, { 0x00BD, 0, 25 }, { 0x00BE, 27, 27 }, { 0x00BF, 23, 20 }, { 0x00C0, 27, 27 }, // U+00F8
+    { 0x00C1, 7, 9 }, { 0x00C2, 22, 19 }, { 0x00C3, 7, 9 }, { 0x00C4, 22, 19 }, { 0x00C5, 34, 9 }, { 0x00C6, 22, 19 }, { 0x00C7, 9, 10 }, { 0x00C8, 0, 21 }, // U+0100
+    { 0x00C9, 9, 10 }, { 0x00CA, 0, 21 }, { 0x00CB, 9, 10 }, { 0x00CC, 0, 21 }, { 0x00CD, 9, 10 }, { 0x00CE, 0, 21 }, { 0x00CF, 10, 0 }, { 0x00D0, 35, 21 }, // U+0108
+    { 0x00D1, 10, 0 }, { 0x00D2, 0, 21 }, { 0x00D3, 11, 0 }, { 0x00D4, 23, 21 }, { 0x00D5, 11, 0 }, { 0x00D6, 23, 21 }, { 0x00D7, 11, 0 }, { 0x00D8, 23, 21 }, // U+0110
+    { 0x00D9, 11, 0 }, { 0x00DA, 23, 21 }, { 0x00DB, 11, 0 }, { 0x00DC, 23, 21 }, { 0x00DD, 0, 10 }, { 0x00DE, 0, 23 }, { 0x00DF, 0, 10 }, { 0x00E0, 0, 23 }, // U+0118
+    { 0x00E1, 0, 10 }, { 0x00E2, 0, 23 }, { 0x00E3, 0, 10 }, { 0x00E4, 0, 23 }, { 0x00E5, 0, 0 }, { 0x00E6, 22, 20 }, { 0x00E7, 0, 0 }, { 0x00E8, 0, 32 }, // U+0120
+    { 0x00E9, 0, 0 }, { 0x00EA, 36, 33 }, { 0x00EB, 0, 0 }, { 0x00EC, 33, 0 }, { 0x00ED, 0, 0 }, { 0x00EE, 0, 0 }, { 0x00EF, 37, 0 }, { 0x00F0, 0, 0 }, // U+0128
+    { 0x00F1, 0, 0 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 0 }, { 0x00F4, 0, 0 }, { 0x00F5, 0, 0 }, { 0x00F6, 0, 0 }, { 0x00F7, 9, 0 }, { 0x00F8, 0, 20 }, // U+0130
+    { 0x00F9, 28, 25 }, { 0x00FA, 13, 0 }, { 0x00FB, 0, 20 }, { 0x00FC, 13, 0 }, { 0x00FD, 0, 20 }, { 0x00FE, 13, 0 }, { 0x00FF, 35, 20 }, { 0x0100, 13, 0 }, // U+0138
+    { 0x0101, 0, 20 }, { 0x0102, 13, 0 }, { 0x0103, 0, 0 }, { 0x0104, 0, 0 }, { 0x0105, 22, 25 }, { 0x0106, 0, 0 }, { 0x0107, 22, 25 }, { 0x0108, 0, 0 }, // U+0140
+    { 0x0109, 0, 0 }, { 0x010A, 22, 0 }, { 0x010B, 0, 0 }, { 0x010C, 22, 25 }, { 0x010D, 10, 10 }, { 0x010E, 23, 21 }, { 0x010F, 10, 10 }, { 0x0110, 23, 21 }, // U+0148
+    { 0x0111, 10, 10 }, { 0x0112, 23, 21 }, { 0x0113, 11, 10 }, { 0x0114, 23, 21 }, { 0x0115, 0, 0 }, { 0x0116, 26, 25 }, { 0x0117, 0, 0 }, { 0x0118, 26, 25 }, // U+0150
+    { 0x0119, 0, 0 }, { 0x011A, 26, 0 }, { 0x011B, 0, 0 }, { 0x011C, 0, 26 }, { 0x011D, 0, 0 }, { 0x011E, 0, 0 }, { 0x011F, 0, 0 }, { 0x0120, 0, 26 }, // U+0158
+    { 0x0121, 0, 0 }, { 0x0122, 0, 0 }, { 0x0123, 16, 13 }, { 0x0124, 24, 22 }, { 0x0125, 16, 13 }, { 0x0126, 38, 22 }, { 0x0127, 16, 13 }, { 0x0128, 24, 22 }, // U+0160
+    { 0x0129, 17, 14 }, { 0x012A, 0, 25 }, { 0x012B, 17, 14 }, { 0x012C, 0, 25 }, { 0x012D, 17, 14 }, { 0x012E, 0, 25 }, { 0x012F, 17, 14 }, { 0x0130, 0, 25 }, // U+0168
+    { 0x0131, 17, 14 }, { 0x0132, 0, 25 }, { 0x0133, 17, 14 }, { 0x0134, 0, 25 }, { 0x0135, 18, 15 }, { 0x0136, 27, 27 }, { 0x0137, 19, 17 }, { 0x0138, 27, 27 }, // U+0170
+    { 0x0139, 19, 17 }, { 0x013A, 20, 18 }, { 0x013B, 0, 28 }, { 0x013C, 20, 18 }, { 0x013D, 0, 28 }, { 0x013E, 20, 18 }, { 0x013F, 0, 28 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 43, 0 }, { 0x0212, 43, 0 }, { 0x0213, 44, 34 }, { 0x0214, 45, 0 }, { 0x0215, 46, 35 }, { 0x0216, 47, 36 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 37 }, { 0x021A, 48, 38 }, { 0x021B, 48, 0 }, { 0x021C, 44, 34 }, { 0x021D, 49, 0 }, { 0x021E, 0, 0 }, { 0x021F, 50, 39 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 51, 40 }, { 0x0222, 52, 0 }, { 0x0223, 53, 0 }, { 0x0224, 45, 0 }, { 0x0225, 54, 41 }, { 0x0226, 43, 0 }, { 0x0227, 49, 42 }, { 0x0228, 53, 43 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 49, 0 }, { 0x022C, 0, 38 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 55, 35 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 56, 0 }, { 0x0232, 46, 35 }, { 0x0233, 45, 34 }, { 0x0234, 50, 39 }, { 0x0235, 57, 44 }, { 0x0236, 49, 42 }, { 0x0237, 54, 0 }, { 0x0238, 0, 45 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 54, 0 }, { 0x023B, 48, 34 }, { 0x023C, 0, 0 }, { 0x023D, 48, 0 }, { 0x023E, 55, 43 }, { 0x023F, 55, 0 }, { 0x0240, 0, 46 }, // U+0428
+    { 0x0241, 58, 47 }, { 0x0242, 59, 48 }, { 0x0243, 60, 49 }, { 0x0244, 61, 49 }, { 0x0245, 62, 50 }, { 0x0246, 63, 51 }, { 0x0247, 64, 52 }, { 0x0248, 60, 53 }, // U+0430
+    { 0x0249, 65, 49 }, { 0x024A, 65, 49 }, { 0x024B, 64, 49 }, { 0x024C, 65, 54 }, { 0x024D, 65, 49 }, { 0x024E, 65, 49 }, { 0x024F, 63, 51 }, { 0x0250, 65, 49 }, // U+0438
+    { 0x0251, 63, 49 }, { 0x0252, 66, 51 }, { 0x0253, 61, 55 }, { 0x0254, 67, 56 }, { 0x0255, 63, 51 }, { 0x0256, 64, 52 }, { 0x0257, 62, 49 }, { 0x0258, 65, 57 }, // U+0440
+    { 0x0259, 65, 49 }, { 0x025A, 62, 49 }, { 0x025B, 68, 55 }, { 0x025C, 65, 49 }, { 0x025D, 68, 49 }, { 0x025E, 63, 53 }, { 0x025F, 63, 49 }, { 0x0260, 65, 58 }, // U+0448
+    { 0x0261, 63, 51 }, { 0x0262, 63, 51 }, { 0x0263, 69, 59 }, { 0x0264, 61, 49 }, { 0x0265, 66, 51 }, { 0x0266, 70, 60 }, { 0x0267, 0, 0 }, { 0x0268, 71, 61 }, // U+0450
+    { 0x0269, 72, 62 }, { 0x026A, 68, 54 }, { 0x026B, 68, 49 }, { 0x026C, 73, 59 }, { 0x026D, 64, 49 }, { 0x026E, 65, 49 }, { 0x026F, 67, 56 }, { 0x0270, 65, 49 }, // U+0458
+};
+
 static const EpdFontData notosans_18_regular = {
     notosans_18_regularBitmaps,
     notosans_18_regularGlyphs,
     notosans_18_regularIntervals,
-    20,
+    18,
     51,
     41,
     -11,
     true,
     notosans_18_regularGroups,
-    13,
-    nullptr,
+    14,
+    notosans_18_regularGlyphToGroup,
     notosans_18_regularKernLeftClasses,
     notosans_18_regularKernRightClasses,
     notosans_18_regularKernMatrix,
@@ -4733,4 +4836,8 @@ static const EpdFontData notosans_18_regular = {
     76,
     notosans_18_regularLigaturePairs,
     5,
+    notosans_18_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
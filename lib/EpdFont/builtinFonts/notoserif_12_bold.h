@@ -3,1802 +3,1806 @@
  * name: notoserif_12_bold
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_12_bold 12 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_12_bold 12 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_12_boldBitmaps[28640] = {
-    0xB5, 0x58, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x7C, 0xD7, 0x32, 0x91, 0x5C, 0x54, 0xF4, 0x10,
-    0x35, 0x69, 0x15, 0x89, 0x4B, 0x86, 0xC0, 0x7D, 0x12, 0x97, 0xA2, 0xF0, 0xF0, 0x2C, 0xD2, 0xC9,
-    0x90, 0x21, 0x43, 0x34, 0x48, 0xCD, 0xD0, 0xC1, 0x59, 0xA3, 0x02, 0xD5, 0xA2, 0x41, 0x05, 0x64,
-    0x93, 0xFD, 0x01, 0x32, 0xDA, 0x4B, 0xB3, 0xB6, 0x43, 0x07, 0x57, 0x46, 0x63, 0x0F, 0x19, 0x3C,
-    0xD8, 0xBE, 0xB4, 0x3D, 0x64, 0xC8, 0x10, 0xD6, 0x29, 0x90, 0xA9, 0x30, 0x81, 0x28, 0x09, 0x60,
-    0xA3, 0x09, 0x9B, 0xD2, 0x35, 0x65, 0x91, 0x3C, 0xFD, 0xCE, 0x25, 0x9F, 0x7E, 0x5C, 0xA9, 0x71,
-    0x52, 0xF4, 0xF1, 0x9E, 0xF3, 0xDE, 0x23, 0xEF, 0x3D, 0xF7, 0xDC, 0xF3, 0x7F, 0x18, 0xA7, 0x71,
-    0x1A, 0x26, 0xB8, 0xA2, 0x30, 0x0A, 0xA2, 0x80, 0x7C, 0x7B, 0x4D, 0xD2, 0x31, 0x22, 0x9A, 0x25,
-    0xDC, 0x4F, 0xC3, 0x88, 0x28, 0x7C, 0xBD, 0x90, 0xE1, 0xE6, 0x18, 0x81, 0xCA, 0x66, 0x55, 0x8A,
-    0x81, 0x19, 0xF4, 0xE2, 0x24, 0xD1, 0x10, 0x30, 0x9A, 0x21, 0x3A, 0x35, 0x24, 0x5A, 0x1F, 0x92,
-    0xCF, 0x9C, 0x09, 0x50, 0xB1, 0x46, 0x16, 0xF2, 0xAB, 0xE4, 0x64, 0x05, 0xFD, 0xE8, 0xF1, 0xE3,
-    0x28, 0x64, 0x4E, 0xD4, 0xAD, 0x8C, 0xD4, 0xAF, 0x53, 0x72, 0x5F, 0x4D, 0x49, 0x2B, 0x81, 0x04,
-    0x34, 0x64, 0x0C, 0x38, 0xF7, 0xDE, 0xAB, 0xC3, 0x21, 0xC6, 0xB5, 0x70, 0x48, 0x61, 0x4D, 0x7E,
-    0x43, 0x1A, 0x94, 0x4C, 0x45, 0x41, 0xF3, 0xDC, 0xB0, 0xDD, 0x18, 0xC6, 0xD7, 0x87, 0x0B, 0xE7,
-    0x87, 0xD7, 0x83, 0xF7, 0xCA, 0xE3, 0x9C, 0x74, 0xAB, 0x64, 0xD8, 0x8F, 0x6A, 0xC9, 0x8D, 0xC8,
-    0xBB, 0x90, 0x7A, 0x44, 0x81, 0x9B, 0xCD, 0x81, 0x6D, 0x95, 0x8F, 0x88, 0x16, 0x94, 0x70, 0x01,
-    0x5C, 0x08, 0xFE, 0x47, 0x26, 0xF7, 0x3F, 0xBD, 0xBD, 0x8D, 0x39, 0x9F, 0x5C, 0xB8, 0x97, 0x78,
-    0xBF, 0xBF, 0x10, 0xB8, 0xE9, 0xA0, 0x9D, 0xC5, 0x64, 0x9C, 0x63, 0x41, 0xF0, 0x3A, 0x26, 0x83,
-    0x77, 0xC1, 0x4E, 0x2E, 0x77, 0x54, 0x0A, 0x82, 0xE4, 0x26, 0xFE, 0xEB, 0x29, 0x79, 0xE4, 0xB6,
-    0xB4, 0xFF, 0x13, 0x57, 0x44, 0x83, 0xE6, 0x26, 0x18, 0x28, 0x02, 0x22, 0xB7, 0x08, 0x22, 0x41,
-    0xF8, 0x5B, 0x2D, 0xE0, 0x41, 0x8B, 0xA7, 0xC4, 0xD9, 0xC9, 0x3F, 0x0C, 0x38, 0x8D, 0x73, 0xFF,
-    0x5E, 0x71, 0x8E, 0xE2, 0xD7, 0xEA, 0x0D, 0x32, 0x0E, 0x5F, 0x23, 0xA6, 0xB8, 0x00, 0xF2, 0x05,
-    0xE9, 0x9A, 0xE2, 0xC4, 0x63, 0x0A, 0xB6, 0x6F, 0x98, 0xCC, 0xE5, 0x3C, 0xA8, 0x2C, 0x75, 0x51,
-    0x4C, 0x48, 0x21, 0x05, 0x50, 0xC7, 0x6C, 0xBF, 0xA3, 0xC6, 0xA6, 0xE4, 0xD4, 0xD8, 0x86, 0xBC,
-    0x9C, 0xFC, 0x94, 0x42, 0x8C, 0x04, 0xCB, 0x65, 0x98, 0xA8, 0x1F, 0xF8, 0x8D, 0x9B, 0x78, 0x14,
-    0x80, 0xE9, 0x4C, 0x26, 0x3B, 0x20, 0x79, 0xDE, 0x2E, 0xB7, 0x9F, 0x53, 0x42, 0x5D, 0x1E, 0xA9,
-    0x92, 0x06, 0x35, 0x11, 0x8E, 0xC5, 0x44, 0x86, 0xEC, 0xFA, 0x31, 0xB9, 0x9E, 0xA2, 0x7D, 0xD4,
-    0xCA, 0xA6, 0x98, 0xAC, 0x73, 0xC2, 0x21, 0x4F, 0xED, 0x4A, 0x60, 0x81, 0x8E, 0x9D, 0x3E, 0x36,
-    0x3F, 0x1C, 0x85, 0x7F, 0x6F, 0x8F, 0xF3, 0xC5, 0xE3, 0xBC, 0x15, 0xFE, 0xB9, 0x99, 0x19, 0x8E,
-    0xE8, 0xB4, 0x3C, 0xA2, 0xE7, 0x20, 0xD6, 0xBD, 0x11, 0x73, 0x13, 0x73, 0xBB, 0xFF, 0x0E, 0xBD,
-    0x40, 0x73, 0x14, 0x47, 0x71, 0x12, 0x24, 0x3A, 0xF2, 0xE8, 0x3A, 0x5D, 0x14, 0xA1, 0xD6, 0x71,
-    0x7D, 0xF2, 0xD2, 0x3C, 0xB6, 0x8F, 0x13, 0xB1, 0x40, 0x68, 0x79, 0x84, 0x1D, 0xD7, 0xE8, 0x2A,
-    0x15, 0x94, 0x3B, 0xD9, 0x20, 0x55, 0xA9, 0x4A, 0xDC, 0x48, 0x43, 0x1F, 0x93, 0x34, 0x73, 0xE0,
-    0x71, 0xF7, 0x71, 0x60, 0x38, 0x7A, 0xA7, 0x84, 0x78, 0x6A, 0xC8, 0xA1, 0xC5, 0x0E, 0x06, 0x52,
-    0x33, 0xB8, 0xEC, 0xAF, 0x88, 0x7B, 0x30, 0xBB, 0xD0, 0x61, 0x99, 0x1B, 0x60, 0x8D, 0xF7, 0x05,
-    0xA4, 0x02, 0x1A, 0xF6, 0x03, 0x11, 0x12, 0xC3, 0x66, 0x01, 0x71, 0x9C, 0xD2, 0x69, 0x48, 0x95,
-    0xBE, 0x05, 0x4C, 0xC4, 0x9F, 0x91, 0xC7, 0x6C, 0x49, 0xC1, 0xCA, 0xC9, 0xFF, 0xA2, 0xE3, 0x29,
-    0x84, 0x54, 0x43, 0xEC, 0x7B, 0x5C, 0xA4, 0x2B, 0xF2, 0x87, 0x7C, 0x45, 0xC0, 0xA4, 0xB1, 0x2F,
-    0x44, 0x4C, 0xE7, 0x70, 0x0B, 0x7F, 0xDD, 0x4C, 0x25, 0x3E, 0xE9, 0x44, 0xFC, 0x67, 0x0C, 0x7B,
-    0xB4, 0x1A, 0xD0, 0x62, 0x4B, 0x2B, 0x00, 0x2D, 0xC7, 0xD2, 0x6A, 0xB0, 0xA8, 0xB4, 0x32, 0xA0,
-    0xCB, 0x35, 0x59, 0xED, 0x89, 0x2A, 0xC1, 0xCC, 0x0B, 0x00, 0xA8, 0x21, 0x39, 0x2F, 0x7B, 0x3F,
-    0x10, 0x07, 0xCB, 0xBB, 0x33, 0x8A, 0x09, 0xB8, 0x00, 0x0F, 0x30, 0x0F, 0xF8, 0x09, 0xE0, 0xEB,
-    0x9A, 0x9C, 0xBB, 0xD0, 0xF9, 0xED, 0x9A, 0x34, 0x9E, 0x4F, 0x02, 0x46, 0x80, 0x5F, 0xBE, 0xD9,
-    0x44, 0x86, 0x39, 0x9F, 0xC2, 0xB7, 0x5D, 0xA7, 0x00, 0xD3, 0x2D, 0x6C, 0x8E, 0x33, 0xCD, 0x0D,
-    0xCE, 0xDA, 0x5A, 0x98, 0xB4, 0xD7, 0x33, 0xF4, 0x3D, 0x90, 0x9F, 0x91, 0x88, 0x72, 0x33, 0x41,
-    0x7C, 0x10, 0x7F, 0x69, 0xC7, 0x3C, 0x45, 0x02, 0xC7, 0x00, 0x23, 0xF0, 0x7E, 0x1A, 0x32, 0x08,
-    0xC1, 0xAF, 0x1E, 0xCB, 0x5D, 0x3E, 0xA6, 0x24, 0xF7, 0x5F, 0xA0, 0x99, 0xDE, 0xA4, 0x20, 0x39,
-    0x8D, 0x73, 0xBE, 0x04, 0x3D, 0x5A, 0x3B, 0x25, 0xB3, 0x9A, 0x11, 0xEF, 0xD4, 0xA0, 0xD4, 0xE2,
-    0x32, 0xE2, 0x4F, 0xA2, 0x45, 0x7B, 0x85, 0xD0, 0x65, 0x90, 0x62, 0xDD, 0x17, 0xD5, 0xAE, 0x1E,
-    0xC1, 0xB3, 0x1D, 0x4D, 0x41, 0xD7, 0x0B, 0xAA, 0x16, 0x21, 0x5B, 0xF8, 0xB8, 0x9B, 0x93, 0x86,
-    0x8B, 0x24, 0x22, 0xF1, 0xD0, 0x7A, 0x48, 0xDD, 0x1B, 0x3A, 0x1E, 0xEA, 0xBC, 0xD7, 0x5A, 0x46,
-    0xFE, 0xE7, 0x63, 0xAD, 0xF5, 0x3B, 0x24, 0x37, 0x29, 0xCC, 0x60, 0x29, 0x3B, 0x88, 0x10, 0xD6,
-    0x3A, 0x10, 0xA7, 0xDE, 0x81, 0xA5, 0x59, 0x7E, 0xE2, 0xA8, 0xE9, 0x66, 0x47, 0x76, 0xEE, 0xDD,
-    0x06, 0xCF, 0xF3, 0xDD, 0x43, 0x0D, 0x38, 0x22, 0xFF, 0x41, 0x41, 0xE1, 0x2B, 0x15, 0x38, 0xAE,
-    0x2D, 0xFF, 0x72, 0x82, 0xEE, 0x14, 0x9D, 0x7D, 0x86, 0x0F, 0x10, 0x15, 0x1A, 0xD3, 0x9F, 0x55,
-    0x24, 0x56, 0xD3, 0x8F, 0xC1, 0xD8, 0x08, 0x9C, 0x85, 0x67, 0xC1, 0x0F, 0x47, 0x96, 0xD6, 0x0F,
-    0xBB, 0x38, 0x9D, 0x4C, 0xEC, 0x0B, 0x4A, 0x7B, 0xB1, 0xFB, 0xE8, 0xA7, 0x41, 0xAA, 0x13, 0x0F,
-    0x26, 0xB6, 0x38, 0xBE, 0x09, 0xAB, 0xC1, 0x71, 0x0D, 0xE9, 0x52, 0xF4, 0x02, 0x21, 0xCB, 0xE1,
-    0x11, 0xD8, 0xFC, 0x9C, 0x9C, 0xC6, 0x4E, 0xA0, 0xA9, 0xE5, 0x25, 0xC3, 0x2D, 0xF0, 0x9E, 0x7A,
-    0xB8, 0x5D, 0xD9, 0xFC, 0x13, 0x7E, 0xAC, 0x59, 0x6D, 0xEA, 0xC2, 0x2E, 0xF1, 0xBA, 0x25, 0x37,
-    0x3A, 0x82, 0x30, 0x45, 0xB0, 0xB2, 0xB6, 0xBB, 0xC6, 0x85, 0x34, 0x03, 0x91, 0x66, 0x8A, 0x53,
-    0x26, 0x86, 0x26, 0x22, 0xC4, 0x18, 0x92, 0xE3, 0xB0, 0xC4, 0x52, 0x12, 0x0E, 0x24, 0x78, 0x49,
-    0x04, 0x91, 0x08, 0x61, 0xD3, 0x91, 0x7C, 0xE6, 0x7A, 0xB3, 0x11, 0xB8, 0x39, 0xA6, 0xF6, 0xF3,
-    0x6D, 0x21, 0xF9, 0xF8, 0x4A, 0x66, 0xE3, 0xD9, 0x35, 0x22, 0x18, 0xD8, 0x3C, 0x29, 0xFC, 0xF5,
-    0xA0, 0xD5, 0x78, 0x07, 0x71, 0x7B, 0x50, 0x86, 0x2A, 0x59, 0x40, 0xFE, 0x52, 0xE9, 0xC8, 0x4B,
-    0x17, 0x54, 0xBA, 0xE1, 0xA7, 0xE7, 0x80, 0x83, 0xE4, 0x9C, 0x4A, 0xAE, 0x05, 0xD1, 0x75, 0x37,
-    0x02, 0xAE, 0x35, 0x6D, 0xF8, 0xBF, 0xAA, 0x27, 0x69, 0xC3, 0xFB, 0x64, 0x61, 0x03, 0x96, 0xDE,
-    0xE0, 0x18, 0xF3, 0x76, 0x0F, 0xCF, 0x8A, 0x1A, 0x49, 0x80, 0xDE, 0x92, 0x83, 0xC9, 0x8F, 0x80,
-    0x6D, 0x1E, 0x58, 0x91, 0x27, 0x72, 0x56, 0xE8, 0x54, 0xB2, 0x90, 0x20, 0x57, 0x8E, 0xE3, 0x89,
-    0xF3, 0x4F, 0x4A, 0xE4, 0x98, 0xF3, 0x25, 0xB5, 0x78, 0x90, 0xCC, 0xBA, 0x88, 0xE7, 0x7D, 0x17,
-    0x0C, 0x3E, 0x7C, 0x13, 0x46, 0xC6, 0xF0, 0x95, 0x41, 0xE6, 0xB4, 0x48, 0x30, 0x38, 0x92, 0x2B,
-    0xA1, 0x16, 0x1B, 0xC5, 0xE9, 0x6A, 0xE6, 0xF0, 0x16, 0x57, 0x2E, 0xD7, 0x31, 0x6F, 0xC3, 0xB1,
-    0x4C, 0xAE, 0x6A, 0x5D, 0xA9, 0x7A, 0xFF, 0xE5, 0xE2, 0xBF, 0x5F, 0x28, 0xC9, 0xA8, 0xCD, 0xD9,
-    0xA2, 0xBB, 0xE7, 0xB4, 0x00, 0xEE, 0x01, 0xBF, 0x55, 0x33, 0xDD, 0x5E, 0x29, 0xE3, 0x3E, 0x5A,
-    0x80, 0xE3, 0xC4, 0x69, 0xAF, 0x14, 0x6E, 0xA9, 0x2A, 0x2F, 0x1F, 0x54, 0x41, 0xEA, 0xE4, 0xC2,
-    0xA3, 0xC4, 0x05, 0xF3, 0x04, 0xC4, 0xE3, 0xE0, 0x85, 0x83, 0x22, 0x3D, 0xBD, 0xA0, 0x2B, 0xBA,
-    0x36, 0x60, 0x2E, 0x68, 0xB5, 0xA3, 0x85, 0x18, 0x0E, 0x03, 0x6E, 0xE1, 0x9B, 0xAA, 0x86, 0x33,
-    0xC3, 0xFF, 0x4D, 0xA4, 0x44, 0xA1, 0x82, 0x32, 0xA0, 0x00, 0x2C, 0xC3, 0x70, 0x04, 0x15, 0x63,
-    0x64, 0xEF, 0x05, 0xD9, 0x78, 0x5E, 0x2C, 0x88, 0xB1, 0x0C, 0x1A, 0x17, 0x3E, 0x3B, 0xA2, 0xE0,
-    0xB6, 0x9A, 0x6E, 0x2F, 0xE3, 0x74, 0xB4, 0x0E, 0x38, 0xD5, 0x03, 0xED, 0x02, 0x73, 0xAA, 0x9A,
-    0xE5, 0xE8, 0xC0, 0xBD, 0x9A, 0x9E, 0x01, 0xCC, 0x02, 0xE6, 0xA6, 0xDB, 0xCD, 0x1B, 0xA0, 0x81,
-    0x2C, 0xC3, 0xA5, 0xDF, 0xD1, 0xB9, 0x76, 0x28, 0x9D, 0x76, 0x33, 0xB2, 0xB4, 0x0E, 0xD2, 0xD9,
-    0x85, 0xE9, 0x76, 0x11, 0xBC, 0x8C, 0xB3, 0xC9, 0xB4, 0xF8, 0x2E, 0x5F, 0x86, 0xE6, 0x2B, 0x68,
-    0x0A, 0xAA, 0x8C, 0x71, 0x10, 0x5A, 0xB7, 0x32, 0xB2, 0xC2, 0xB2, 0x52, 0x1B, 0xA3, 0x89, 0xE5,
-    0xC8, 0x24, 0x3E, 0x67, 0x71, 0x0A, 0x9B, 0x08, 0x45, 0xB7, 0x90, 0xE3, 0x38, 0xCF, 0x0B, 0x01,
-    0x87, 0xDF, 0x6D, 0x45, 0x1F, 0x5B, 0x7D, 0x09, 0xC1, 0xB7, 0xB8, 0xF5, 0xF9, 0x8C, 0xD9, 0x3E,
-    0x20, 0xA5, 0xFF, 0x44, 0x8C, 0xC2, 0x0A, 0x87, 0x5F, 0xCD, 0x8E, 0x9E, 0x22, 0x08, 0xA1, 0x38,
-    0x7E, 0x18, 0xF3, 0x6D, 0xE6, 0x58, 0x8A, 0x31, 0x91, 0xD5, 0x53, 0x0E, 0x59, 0xC9, 0x99, 0xC7,
-    0xA8, 0xAF, 0x84, 0xE3, 0xEF, 0x30, 0x1C, 0x6B, 0x0D, 0x41, 0x69, 0x4B, 0x08, 0xFE, 0x98, 0xF3,
-    0xE9, 0xF6, 0x15, 0xBE, 0x88, 0x5B, 0x8D, 0xDC, 0x2F, 0x80, 0xE0, 0x99, 0xAA, 0x86, 0x9D, 0xAB,
-    0xFA, 0xB4, 0x88, 0xFA, 0xBA, 0xE8, 0xA2, 0xB5, 0x8A, 0x05, 0x6A, 0x4C, 0x8A, 0x7B, 0xA1, 0x4C,
-    0xF1, 0x65, 0xB2, 0x57, 0x01, 0xB9, 0xB2, 0x16, 0xA2, 0x04, 0x77, 0x10, 0x2A, 0x67, 0x01, 0x6C,
-    0x1A, 0xF1, 0xAF, 0x8D, 0xE8, 0x28, 0xED, 0x1D, 0x02, 0x62, 0x21, 0x93, 0x80, 0x99, 0xDE, 0x4A,
-    0x9A, 0xCE, 0x4A, 0xC0, 0x73, 0x0D, 0x11, 0xC1, 0xE1, 0x14, 0x27, 0x28, 0xD2, 0x10, 0xC9, 0x95,
-    0x49, 0xD5, 0xBD, 0xCC, 0x85, 0x7D, 0x7E, 0x94, 0x6B, 0x98, 0xEA, 0x47, 0xC5, 0x24, 0xF0, 0x07,
-    0xE5, 0x0C, 0xF0, 0x9D, 0x7A, 0x08, 0x7C, 0xBB, 0x3E, 0x05, 0x7C, 0xAB, 0x59, 0x03, 0x4E, 0xF9,
-    0xAA, 0x60, 0x93, 0x0B, 0x8E, 0x33, 0xC1, 0x88, 0xB7, 0xC0, 0x01, 0x62, 0xEC, 0xF4, 0x96, 0x7F,
-    0xC6, 0x6C, 0xC5, 0xB5, 0xA7, 0xE0, 0xCB, 0x88, 0x82, 0xCD, 0x34, 0x64, 0x5C, 0x22, 0x48, 0xA0,
-    0x7C, 0x81, 0xE7, 0x02, 0x65, 0x4A, 0x36, 0x00, 0xFA, 0xA0, 0x06, 0xBA, 0xD3, 0x28, 0xA1, 0x28,
-    0x28, 0xBE, 0x23, 0x34, 0x3E, 0x05, 0xF2, 0x1E, 0x49, 0xB5, 0x03, 0xBE, 0x52, 0xE1, 0x0F, 0xE6,
-    0x24, 0x48, 0x68, 0xA3, 0xB8, 0x89, 0x6B, 0x49, 0x5E, 0xBD, 0x7B, 0x23, 0x19, 0xC3, 0xBF, 0x11,
-    0x3D, 0x07, 0xE2, 0x7B, 0x64, 0x6D, 0x2F, 0x8E, 0xA4, 0x3A, 0x4C, 0xA5, 0x1A, 0x4C, 0xCD, 0x18,
-    0x65, 0xBB, 0xA8, 0x7B, 0x60, 0xA7, 0xD8, 0xC9, 0x76, 0x99, 0x2E, 0x10, 0xD0, 0x06, 0xED, 0xCF,
-    0x10, 0x85, 0x7B, 0x7F, 0x17, 0x1B, 0x7D, 0xFC, 0x44, 0x24, 0x1A, 0x34, 0x7B, 0xD0, 0x47, 0xA4,
-    0x66, 0x35, 0x57, 0x70, 0xE2, 0x6F, 0xF6, 0xA7, 0xFF, 0x1F, 0xAF, 0xCA, 0x86, 0xE2, 0xC6, 0x56,
-    0x80, 0xB2, 0x93, 0x4D, 0x92, 0xB6, 0x98, 0x3E, 0x5E, 0x1F, 0x08, 0x5B, 0xD6, 0xE0, 0x6D, 0xEC,
-    0xC2, 0xC4, 0x1E, 0xD9, 0xBF, 0xF6, 0x81, 0x5F, 0x8A, 0x41, 0x26, 0x20, 0x17, 0x8B, 0x41, 0x06,
-    0xD6, 0x66, 0xC5, 0x20, 0xB5, 0x18, 0xA4, 0x3A, 0x68, 0x90, 0x69, 0xD0, 0x9D, 0x0B, 0x8D, 0x8A,
-    0xFB, 0x90, 0x23, 0x0F, 0xEC, 0x05, 0x89, 0x8F, 0x82, 0x76, 0x52, 0xA2, 0x04, 0xF9, 0xD8, 0xDD,
-    0x13, 0x5A, 0x52, 0xFA, 0x18, 0x70, 0xA5, 0x51, 0x2D, 0x90, 0xC9, 0x26, 0x70, 0xF0, 0x05, 0x14,
-    0xE0, 0xA1, 0x40, 0xE4, 0xA7, 0xC1, 0x67, 0x48, 0x95, 0x5C, 0x8E, 0x4B, 0x15, 0xD4, 0x01, 0x57,
-    0x1E, 0x1B, 0x7A, 0xDF, 0x2B, 0x3C, 0xBA, 0xDA, 0x23, 0xD4, 0xEE, 0x92, 0x47, 0xBE, 0x03, 0x5A,
-    0x6D, 0x44, 0x22, 0xE0, 0xC2, 0x70, 0xCA, 0xE5, 0x2A, 0xFC, 0x3C, 0x43, 0xB5, 0xE7, 0x49, 0x40,
-    0x7B, 0x7A, 0xA4, 0x2C, 0xAA, 0x3B, 0x34, 0x2B, 0x65, 0x1C, 0x5C, 0x98, 0xEF, 0xE3, 0x58, 0xFE,
-    0xB8, 0x64, 0x63, 0x46, 0xAD, 0x14, 0x6F, 0x3B, 0x26, 0xC1, 0xB6, 0x73, 0x92, 0xC9, 0x47, 0x32,
-    0x79, 0x5D, 0xD0, 0xFB, 0xA2, 0x18, 0x30, 0xD3, 0x3A, 0x12, 0x4D, 0x07, 0x22, 0x84, 0x57, 0x25,
-    0xC9, 0xBC, 0x23, 0x95, 0xE9, 0x87, 0x58, 0xEC, 0xDF, 0x13, 0x76, 0xBF, 0xA4, 0xAE, 0x0A, 0xB5,
-    0xE5, 0xA8, 0xAD, 0x87, 0x69, 0x50, 0x08, 0xE5, 0xE8, 0x65, 0x88, 0x38, 0x6E, 0xD1, 0x55, 0xAC,
-    0x6E, 0x79, 0xC8, 0x17, 0x28, 0x89, 0x41, 0xDF, 0x20, 0x3B, 0x4B, 0x58, 0x4E, 0x3C, 0xAB, 0xC6,
-    0x74, 0xD6, 0xEA, 0x06, 0x0D, 0x20, 0x52, 0xE0, 0x47, 0xD2, 0x01, 0xB2, 0xBA, 0x50, 0xC8, 0x97,
-    0x7E, 0xAD, 0x44, 0xD3, 0x62, 0xDE, 0x50, 0xB5, 0xD4, 0x2A, 0x17, 0x54, 0x7D, 0x15, 0xDB, 0xFE,
-    0xCD, 0x41, 0x35, 0x48, 0x01, 0x32, 0x11, 0x78, 0xF2, 0x91, 0xC7, 0xA4, 0x6E, 0xA8, 0x6C, 0x4C,
-    0xC7, 0x01, 0x24, 0xBE, 0xA3, 0x73, 0x0A, 0x60, 0x78, 0x88, 0xD1, 0x19, 0x32, 0xA8, 0x49, 0x94,
-    0x9C, 0x1A, 0xE6, 0xB2, 0x2E, 0xA1, 0x1E, 0x6B, 0xC3, 0x8F, 0x31, 0xC9, 0xDF, 0x81, 0x9D, 0x69,
-    0xA9, 0x08, 0xAC, 0x01, 0xDA, 0x32, 0x40, 0x8B, 0x3D, 0xCE, 0x0A, 0x89, 0x91, 0x2F, 0x0D, 0x25,
-    0xC8, 0x0E, 0x24, 0x40, 0xBB, 0x92, 0x16, 0x56, 0x73, 0x54, 0x41, 0x5C, 0x79, 0x5C, 0x30, 0xBF,
-    0x0A, 0x89, 0xB5, 0x22, 0xB1, 0x12, 0x47, 0x83, 0x81, 0x8D, 0x3A, 0x61, 0x21, 0x94, 0xCA, 0xB1,
-    0x07, 0xE0, 0x28, 0xFE, 0x8D, 0xC8, 0xE9, 0x43, 0xEC, 0xE1, 0x7F, 0x25, 0xD2, 0x69, 0xC6, 0xD2,
-    0x91, 0x5A, 0x62, 0x3F, 0x92, 0x7B, 0x67, 0x5B, 0xA9, 0xA4, 0xA0, 0x10, 0x44, 0xB8, 0x22, 0xDE,
-    0x34, 0xC5, 0x06, 0x1C, 0x68, 0x1D, 0xCC, 0xAE, 0x81, 0xEB, 0x13, 0xC2, 0x9F, 0xAE, 0x3B, 0xAB,
-    0x08, 0xF3, 0x2E, 0x7B, 0x59, 0x6F, 0xEC, 0xCB, 0xFF, 0x92, 0xD6, 0x61, 0xCE, 0xEB, 0x60, 0xBB,
-    0xE2, 0xFB, 0x97, 0x4B, 0xD8, 0x61, 0x69, 0x1A, 0xF3, 0x57, 0x13, 0x3D, 0xC5, 0x95, 0x1A, 0x10,
-    0x2F, 0xD0, 0x85, 0xAD, 0xA1, 0x1B, 0x1B, 0xA1, 0x2B, 0x9B, 0x41, 0xFD, 0xEF, 0xA1, 0xE3, 0x74,
-    0x23, 0x85, 0x68, 0x37, 0x48, 0x9D, 0x8C, 0xF2, 0x03, 0x13, 0x20, 0xD7, 0xEF, 0x33, 0x3D, 0xC5,
-    0x35, 0xE0, 0x50, 0x64, 0xFA, 0xB2, 0x2D, 0x08, 0x51, 0xFB, 0x7D, 0x45, 0x83, 0x0F, 0x12, 0x75,
-    0x27, 0xD5, 0x67, 0x32, 0x8F, 0x8A, 0x19, 0x5A, 0x1B, 0xD1, 0x68, 0x9D, 0xE6, 0x16, 0x69, 0x42,
-    0xBA, 0xA3, 0x93, 0x9B, 0x9B, 0x91, 0x34, 0xB2, 0x41, 0x8A, 0xEA, 0xFE, 0xAA, 0xB3, 0xD9, 0xF5,
-    0x1D, 0x21, 0xFA, 0x98, 0xE0, 0x4C, 0x43, 0x13, 0xB6, 0x9A, 0x6E, 0xE9, 0x38, 0x4A, 0xB8, 0xF0,
-    0x73, 0xD4, 0xDC, 0x51, 0x6B, 0x6B, 0x76, 0x86, 0xC4, 0x0D, 0xD4, 0x1B, 0x7F, 0xC9, 0x91, 0x5F,
-    0x99, 0xB4, 0x6F, 0x3F, 0xC8, 0x2F, 0xBB, 0x92, 0x74, 0x0F, 0x56, 0x48, 0x3F, 0x42, 0xAF, 0xD3,
-    0xFA, 0x85, 0x46, 0xDC, 0x93, 0x88, 0xA8, 0xCB, 0x43, 0xA0, 0x52, 0x95, 0xC6, 0x2F, 0xFF, 0x81,
-    0x29, 0xCC, 0xDD, 0x3E, 0x92, 0x6E, 0x26, 0x9A, 0xAB, 0xE0, 0x76, 0x1D, 0x46, 0xB5, 0xA1, 0xD2,
-    0xEC, 0x4B, 0x9E, 0xC6, 0xF6, 0x42, 0x61, 0xFA, 0xA2, 0xFF, 0xB8, 0x1E, 0x74, 0xCD, 0x82, 0x8B,
-    0x45, 0x8E, 0x2C, 0x0C, 0x77, 0xC1, 0xB9, 0x14, 0x26, 0x1E, 0xA3, 0x2D, 0xFE, 0x0B, 0xA3, 0x39,
-    0x36, 0x28, 0x9F, 0x81, 0xBB, 0x16, 0x70, 0x17, 0xE4, 0xBF, 0xB4, 0xD4, 0x28, 0xB0, 0xD3, 0x60,
-    0xE7, 0xAB, 0x2D, 0x30, 0x5A, 0x53, 0x5F, 0xAD, 0x6A, 0x44, 0x98, 0xE0, 0x56, 0xDF, 0x14, 0xDB,
-    0x86, 0x18, 0x2D, 0x07, 0x82, 0x0D, 0x6F, 0x6E, 0xDA, 0xBA, 0xDA, 0xD8, 0x56, 0xD1, 0x81, 0xC9,
-    0x40, 0x75, 0xED, 0x0D, 0x94, 0xB5, 0xE5, 0xDE, 0xBB, 0x8E, 0xC6, 0x69, 0x62, 0x55, 0x2F, 0xA8,
-    0xEA, 0x04, 0x42, 0xC1, 0x74, 0xB3, 0x88, 0x88, 0xFE, 0xFC, 0xF6, 0x22, 0x7E, 0x1F, 0x3A, 0x60,
-    0x92, 0x48, 0xD2, 0x46, 0x8E, 0xE2, 0x44, 0xB4, 0xF9, 0x46, 0xA1, 0xB9, 0x2D, 0xD0, 0x90, 0x47,
-    0x81, 0x34, 0x46, 0xD2, 0x3E, 0x01, 0x6C, 0x93, 0x86, 0x26, 0x53, 0x4E, 0xEC, 0xFE, 0x56, 0x8A,
-    0x76, 0x08, 0xFC, 0xFE, 0x1F, 0xA5, 0x61, 0x8E, 0x5C, 0x14, 0x68, 0xE1, 0xEF, 0x62, 0x69, 0xC7,
-    0x2D, 0x34, 0xE8, 0xD1, 0xC2, 0xFB, 0xA2, 0xB8, 0x8B, 0x56, 0x31, 0x56, 0x33, 0x56, 0x25, 0x07,
-    0xD0, 0x0A, 0x59, 0xF5, 0xC0, 0x1F, 0x57, 0x91, 0x61, 0x24, 0x6E, 0xEB, 0x0A, 0x8F, 0x74, 0xF9,
-    0x8D, 0xC8, 0x6F, 0x74, 0x83, 0x08, 0xA9, 0x6D, 0xEA, 0x90, 0xF7, 0x2B, 0xA5, 0xED, 0x68, 0x6C,
-    0xF5, 0x3F, 0xB5, 0x28, 0x7B, 0xCA, 0x9D, 0xA3, 0x87, 0x2F, 0xAB, 0x23, 0x69, 0xE4, 0x55, 0x83,
-    0xC4, 0x76, 0x82, 0x68, 0x62, 0x29, 0x68, 0xF0, 0xFB, 0xA8, 0xCB, 0xE6, 0xCD, 0xD5, 0xE2, 0x66,
-    0x74, 0xB8, 0x9D, 0x4D, 0x2D, 0xE9, 0x32, 0x86, 0x05, 0x79, 0x99, 0x2E, 0x03, 0xFC, 0xDF, 0x20,
-    0xFD, 0x10, 0x1B, 0x3D, 0xAA, 0x48, 0xFA, 0x6C, 0xDD, 0x20, 0xFF, 0x95, 0x06, 0x41, 0x30, 0xC4,
-    0x73, 0xBF, 0x10, 0xEE, 0x0D, 0x9F, 0x61, 0xD0, 0xF2, 0xFF, 0x2B, 0x9B, 0x47, 0x31, 0x3E, 0xB5,
-    0xB8, 0x42, 0x9B, 0x50, 0xF3, 0x3F, 0xF9, 0x13, 0xA4, 0x28, 0x88, 0xAF, 0x17, 0xA0, 0x15, 0x21,
-    0xE4, 0xA3, 0xFB, 0xAF, 0xF2, 0x5B, 0x7C, 0x09, 0x53, 0xBD, 0x50, 0x21, 0x56, 0xD9, 0x41, 0xE8,
-    0x67, 0xB0, 0xAD, 0xFF, 0x41, 0x39, 0x2B, 0x09, 0x04, 0x80, 0x76, 0xDB, 0x36, 0x90, 0x68, 0xB1,
-    0x51, 0x38, 0x18, 0xDB, 0x4E, 0x06, 0x3D, 0x74, 0xFF, 0x71, 0x3F, 0x81, 0x27, 0x90, 0xF7, 0x79,
-    0xB3, 0x6B, 0xC7, 0x53, 0xD1, 0xDB, 0x14, 0x7F, 0xCA, 0xA9, 0xD7, 0x9E, 0x15, 0xE7, 0x05, 0x61,
-    0x38, 0xA9, 0x38, 0x6B, 0xB1, 0x0F, 0xF6, 0x39, 0xAF, 0xE6, 0x2B, 0xB9, 0xFE, 0x9A, 0x13, 0x5D,
-    0x9C, 0xB0, 0xB6, 0x20, 0x00, 0x23, 0xA0, 0x18, 0x51, 0x76, 0x05, 0x51, 0xC6, 0xB9, 0x34, 0xB1,
-    0xE4, 0xF1, 0xD9, 0x3A, 0xBC, 0xCB, 0xE9, 0x53, 0xF8, 0x63, 0x12, 0xEC, 0x40, 0x61, 0x6D, 0x78,
-    0xC0, 0xA7, 0x6D, 0xB3, 0xF5, 0x2C, 0x0E, 0xF4, 0xEC, 0xE6, 0xA5, 0xA9, 0xC5, 0xB7, 0x45, 0x40,
-    0x91, 0x27, 0xF3, 0xEA, 0x20, 0xD2, 0xD5, 0x0F, 0x9E, 0x30, 0x8A, 0x83, 0xE0, 0x37, 0x91, 0xE4,
-    0x74, 0x04, 0x96, 0x48, 0x73, 0x11, 0x9C, 0xA9, 0x42, 0x2A, 0xE5, 0xC5, 0x1F, 0x7C, 0x8F, 0x53,
-    0x29, 0x27, 0xE2, 0xFA, 0xD8, 0xA0, 0x1E, 0x11, 0xAA, 0xED, 0x3A, 0x7C, 0xB7, 0xEC, 0xDF, 0xAD,
-    0xBC, 0x25, 0x71, 0x1A, 0x59, 0x55, 0x6F, 0x4B, 0xC1, 0x3F, 0xFD, 0x30, 0x12, 0xD5, 0x1E, 0x36,
-    0xE0, 0xC3, 0x8A, 0x73, 0xFB, 0x26, 0x09, 0xCA, 0x83, 0x0F, 0xC4, 0x45, 0x0C, 0xBF, 0x28, 0x44,
-    0x6F, 0x85, 0xFE, 0x46, 0x54, 0x62, 0x9E, 0x6B, 0x4B, 0x79, 0xDE, 0x41, 0x9F, 0x8E, 0x86, 0xA0,
-    0x8B, 0x24, 0xCB, 0xCB, 0x13, 0x4B, 0xE8, 0x79, 0xA4, 0x85, 0xCD, 0x3D, 0x94, 0xBF, 0x90, 0x78,
-    0xAA, 0x2A, 0xA4, 0x09, 0x34, 0xE1, 0x4E, 0x33, 0x89, 0xE8, 0x3C, 0x83, 0x50, 0x84, 0x50, 0x1F,
-    0x23, 0xCD, 0x86, 0x38, 0xA6, 0x94, 0x58, 0x68, 0xC7, 0xA7, 0x96, 0x09, 0x56, 0x1A, 0xF2, 0x2B,
-    0x79, 0x5C, 0x42, 0x43, 0x85, 0x96, 0x55, 0xA5, 0x96, 0x75, 0x95, 0xA6, 0x01, 0x4C, 0x75, 0x12,
-    0xEB, 0x67, 0x1A, 0xAC, 0x6E, 0x87, 0x2D, 0xF2, 0x8B, 0x39, 0x65, 0x90, 0xF4, 0xE3, 0xB5, 0x10,
-    0x39, 0x3F, 0x2C, 0x42, 0x9B, 0xF4, 0x84, 0x96, 0x9F, 0x7A, 0x92, 0xE9, 0x53, 0x2F, 0x05, 0xCD,
-    0x89, 0xA5, 0x90, 0xCF, 0x36, 0xBA, 0x56, 0xF9, 0xA0, 0x41, 0x1B, 0xCE, 0x6F, 0x90, 0xBC, 0x7E,
-    0x96, 0x86, 0x4D, 0x6A, 0x01, 0x9A, 0x47, 0x56, 0x5B, 0x43, 0x6B, 0x63, 0x4B, 0x7C, 0xBF, 0x08,
-    0xF2, 0xD5, 0xC6, 0x54, 0xCC, 0xCB, 0x4B, 0x53, 0x8B, 0x5C, 0x87, 0x65, 0x50, 0xB8, 0xA9, 0x97,
-    0xBB, 0xB0, 0x10, 0x24, 0xBA, 0x52, 0xAA, 0x90, 0x19, 0x70, 0x82, 0xBD, 0x5B, 0x29, 0x37, 0xA4,
-    0xD6, 0xE8, 0x53, 0xAD, 0x6F, 0x77, 0x24, 0x79, 0xD7, 0x44, 0xBE, 0x7D, 0x71, 0x6A, 0xDF, 0xF8,
-    0xC9, 0xF1, 0x4E, 0x22, 0x68, 0x4C, 0x2C, 0x2F, 0xA3, 0x30, 0x66, 0x9A, 0xFF, 0x69, 0x4B, 0x23,
-    0x54, 0x00, 0x2F, 0x89, 0xA9, 0xC9, 0xBB, 0x03, 0x29, 0x21, 0xB8, 0x7B, 0xCB, 0xA0, 0xAA, 0x01,
-    0x84, 0xAF, 0xA2, 0x20, 0xD3, 0x88, 0x84, 0x46, 0x5E, 0xC3, 0x45, 0xB6, 0xDB, 0xBA, 0x28, 0xAF,
-    0x67, 0x9F, 0x18, 0xB6, 0xE5, 0xC2, 0xC6, 0x18, 0xF8, 0x81, 0xBF, 0x4F, 0x4C, 0xB0, 0xAF, 0x7C,
-    0xED, 0x72, 0x58, 0xC3, 0x51, 0x9F, 0x38, 0xA7, 0xE7, 0x6B, 0x29, 0xDC, 0x9E, 0x18, 0xC2, 0x0D,
-    0x5B, 0xBD, 0x04, 0xD2, 0xD7, 0x3A, 0xCD, 0x21, 0x73, 0x50, 0x50, 0xC4, 0x36, 0x8F, 0x39, 0xB8,
-    0x82, 0xDC, 0xA3, 0xF3, 0x35, 0xCA, 0xD8, 0xF0, 0x17, 0x04, 0xCF, 0xA3, 0x45, 0x5C, 0xFF, 0x06,
-    0xBD, 0x59, 0x3F, 0x6C, 0xDD, 0xC6, 0x19, 0xFF, 0x48, 0x4A, 0xA2, 0xED, 0x43, 0x74, 0x19, 0xA4,
-    0xC6, 0x85, 0x2C, 0x33, 0x43, 0x06, 0x23, 0xD0, 0x33, 0x97, 0x0C, 0xAF, 0xC0, 0xB3, 0x48, 0xC5,
-    0x28, 0x3A, 0x04, 0x68, 0xDE, 0x20, 0x25, 0x43, 0x07, 0x07, 0xC8, 0x14, 0x03, 0x85, 0x3C, 0xB8,
-    0x80, 0x0A, 0x38, 0x26, 0xED, 0x0C, 0x19, 0x0A, 0x04, 0xDE, 0x3B, 0x38, 0x43, 0x86, 0x56, 0x1E,
-    0xAC, 0x41, 0x83, 0x81, 0x58, 0xE1, 0x45, 0x1E, 0x3A, 0x14, 0x48, 0xE8, 0x74, 0xE8, 0x58, 0x1A,
-    0x75, 0x5C, 0x34, 0x41, 0x13, 0x36, 0x65, 0x62, 0x3A, 0x22, 0x79, 0xFD, 0x7D, 0xC7, 0xF7, 0xA4,
-    0xA7, 0xB8, 0xAE, 0x93, 0x48, 0xD6, 0x7B, 0xBC, 0xEF, 0xF1, 0xCF, 0xF1, 0xFB, 0x73, 0xF7, 0xFD,
-    0xF9, 0xDD, 0xBD, 0xC3, 0x14, 0xC4, 0x91, 0x0A, 0xE2, 0x71, 0x22, 0x3A, 0x4C, 0x92, 0x3C, 0x7C,
-    0x7D, 0x7C, 0x83, 0x10, 0xDF, 0x98, 0xBF, 0x91, 0x7A, 0x3E, 0xA4, 0x23, 0x78, 0x3C, 0x49, 0x64,
-    0x25, 0x77, 0x49, 0xE8, 0x86, 0xFC, 0x8F, 0x22, 0x0A, 0xDE, 0x09, 0x28, 0xFA, 0xE5, 0x09, 0x34,
-    0xA2, 0x64, 0xD0, 0xF8, 0x3C, 0x7A, 0x87, 0x28, 0xF8, 0xC8, 0x26, 0xFF, 0x0B, 0x0F, 0x7D, 0x6B,
-    0xBC, 0x93, 0x99, 0x77, 0x4D, 0xE3, 0x4F, 0x54, 0x92, 0xF3, 0x40, 0x93, 0xC8, 0x83, 0x58, 0x66,
-    0x7E, 0x28, 0xD3, 0x9F, 0x92, 0x44, 0x17, 0x91, 0x13, 0xB9, 0x05, 0x1E, 0xEB, 0x92, 0x7E, 0x52,
-    0xF7, 0x89, 0x2A, 0xDA, 0x6E, 0x16, 0xEE, 0x3B, 0x77, 0x29, 0x94, 0xFA, 0x5E, 0x1A, 0x68, 0xAD,
-    0x7E, 0x36, 0xA1, 0xC3, 0x01, 0xB7, 0x13, 0x53, 0x73, 0xBE, 0xAE, 0xE4, 0xE5, 0x7C, 0x92, 0xD6,
-    0x8F, 0x51, 0x77, 0x8E, 0xBA, 0xC7, 0xE9, 0xBC, 0x5C, 0xC8, 0x7D, 0x5D, 0xF6, 0xDE, 0x98, 0x43,
-    0x87, 0xA4, 0x0A, 0xF2, 0xA8, 0xF4, 0x53, 0x2F, 0x13, 0xA1, 0xCC, 0x05, 0x64, 0x4C, 0x92, 0x53,
-    0xCE, 0x91, 0x55, 0x75, 0x89, 0x9A, 0x73, 0xE8, 0x90, 0xD1, 0x91, 0xE4, 0x33, 0xF0, 0xD6, 0x31,
-    0xF9, 0x6A, 0xD7, 0x39, 0x05, 0x0A, 0xFA, 0x17, 0xE4, 0xC0, 0x8E, 0x7C, 0xFB, 0x63, 0xE4, 0xEE,
-    0x5C, 0x5A, 0x3A, 0x96, 0x7F, 0xCD, 0x7D, 0xAB, 0x9C, 0xA7, 0x22, 0xA0, 0x2B, 0x7E, 0x4C, 0xB2,
-    0x20, 0x4F, 0x87, 0xBD, 0x24, 0xBF, 0x20, 0xAA, 0x8B, 0x54, 0x07, 0x6A, 0x5E, 0x96, 0xF3, 0xB6,
-    0xBE, 0x49, 0x51, 0x41, 0x6E, 0x09, 0x8B, 0x3A, 0x74, 0x61, 0x9E, 0x2E, 0x04, 0xB4, 0x2E, 0x3F,
-    0xCF, 0xEC, 0x0F, 0xC2, 0x95, 0xE3, 0x54, 0x05, 0x61, 0xE5, 0xD3, 0xD3, 0xE3, 0x03, 0xAB, 0x66,
-    0xF4, 0x15, 0x28, 0xF7, 0x4A, 0x45, 0x4E, 0x4A, 0x5E, 0x28, 0x69, 0xD5, 0x51, 0x1D, 0xF1, 0x79,
-    0x9A, 0xF5, 0x4E, 0x5A, 0xD9, 0xDA, 0xF9, 0x1E, 0x85, 0xE7, 0xD7, 0x2E, 0x10, 0x75, 0xD7, 0x6E,
-    0x6E, 0x13, 0xBE, 0xC4, 0x03, 0x7A, 0xA1, 0x7B, 0x92, 0x5E, 0x5B, 0x9B, 0x93, 0xF7, 0xD2, 0x5C,
-    0x5A, 0x1F, 0x38, 0xCA, 0x4D, 0x49, 0x86, 0xD4, 0x2C, 0xD5, 0x04, 0x9D, 0xD2, 0x96, 0xBB, 0xC0,
-    0x0C, 0x9E, 0x89, 0x8F, 0x48, 0x65, 0x5D, 0x57, 0xFE, 0x55, 0x68, 0xA7, 0x02, 0x4F, 0x05, 0xF7,
-    0xF3, 0xF1, 0x85, 0x3E, 0xBD, 0x7B, 0xC2, 0xCE, 0x6E, 0x88, 0xCD, 0xDC, 0x7B, 0x3B, 0x0B, 0xA4,
-    0x8A, 0x70, 0xFF, 0xE5, 0x54, 0xDE, 0xCA, 0x9D, 0xB4, 0xA0, 0xBC, 0x47, 0x4F, 0x8F, 0x45, 0xBA,
-    0xC6, 0x41, 0x34, 0x3B, 0x72, 0x1C, 0xC2, 0xAC, 0x55, 0x51, 0xF5, 0xFC, 0x1F, 0xFE, 0xA7, 0xF2,
-    0xD3, 0x8B, 0x8E, 0xC2, 0x1C, 0xC5, 0x59, 0x57, 0xBE, 0x98, 0xAE, 0x61, 0x6E, 0xB2, 0x17, 0xD6,
-    0xE4, 0x8B, 0x59, 0x77, 0x4D, 0xBE, 0xAA, 0x40, 0x1A, 0x28, 0x2F, 0x5F, 0x86, 0xF2, 0xF2, 0xA5,
-    0xF8, 0x85, 0xAE, 0x3C, 0x9D, 0x9E, 0x9B, 0xF3, 0x6F, 0x17, 0xB9, 0x9C, 0xEE, 0xBF, 0xA2, 0x5C,
-    0xC5, 0xCA, 0x3F, 0xF8, 0xF9, 0xC6, 0x88, 0xF2, 0xD3, 0x4B, 0x4B, 0x61, 0xC0, 0xF3, 0x03, 0x77,
-    0xA9, 0x79, 0x9C, 0x4F, 0xB9, 0xAA, 0xE7, 0xF0, 0x71, 0x52, 0xC4, 0x52, 0x93, 0xF5, 0x1E, 0xD1,
-    0x14, 0x51, 0x6F, 0xE7, 0x30, 0x2A, 0x37, 0xA3, 0x77, 0xE8, 0xA8, 0x71, 0x44, 0x73, 0xDF, 0x7E,
-    0x8F, 0xBC, 0x84, 0xE6, 0x65, 0x38, 0x0B, 0x51, 0x1E, 0xD1, 0x29, 0xA2, 0x75, 0xB2, 0x31, 0x6A,
-    0xA4, 0xE6, 0xAF, 0xA9, 0x40, 0xAB, 0xE9, 0xA5, 0xD0, 0x1A, 0xF6, 0x39, 0x8A, 0x3E, 0x3E, 0xDC,
-    0x87, 0xAC, 0x65, 0x22, 0xA9, 0x9E, 0x15, 0xAA, 0x2B, 0xE3, 0xA0, 0xA1, 0x71, 0xF8, 0x2B, 0xC9,
-    0xDC, 0x57, 0x17, 0xF1, 0xF2, 0x12, 0xBE, 0xC9, 0x63, 0xBF, 0x9A, 0x92, 0x50, 0x93, 0xDE, 0x44,
-    0xD3, 0x41, 0x7A, 0xBF, 0x92, 0xC6, 0xB1, 0xB8, 0xC1, 0x43, 0xA8, 0x61, 0xCF, 0x85, 0x8D, 0xF3,
-    0xC4, 0xA6, 0xEB, 0x2C, 0x6A, 0x92, 0x30, 0xA9, 0x3B, 0xA4, 0x47, 0x1A, 0x5F, 0x47, 0x68, 0x3E,
-    0x9A, 0xF5, 0xEB, 0x0E, 0xA6, 0xE2, 0x7B, 0xB4, 0x0E, 0xFA, 0x6E, 0xF8, 0x57, 0xEC, 0xDA, 0xCB,
-    0x4E, 0x52, 0x14, 0x47, 0x71, 0x60, 0x22, 0xE9, 0x29, 0xF2, 0x94, 0x93, 0xDB, 0xF9, 0xB5, 0x2C,
-    0x89, 0xAD, 0x50, 0xA4, 0xEF, 0xA7, 0xAF, 0xA7, 0xCE, 0xC8, 0x37, 0xAA, 0xA7, 0x17, 0x27, 0x1A,
-    0xF2, 0x7E, 0xAF, 0x02, 0x27, 0xDF, 0x3E, 0x7C, 0x37, 0x13, 0x98, 0x89, 0x45, 0xEA, 0x4E, 0x52,
-    0x07, 0xA3, 0x7F, 0x3A, 0x15, 0x9F, 0x14, 0x4E, 0x5E, 0xE1, 0x70, 0xEF, 0x94, 0x70, 0x1B, 0x0F,
-    0x73, 0x23, 0xE1, 0x35, 0x64, 0x19, 0x29, 0x22, 0xE5, 0x2C, 0xF0, 0x7E, 0x4A, 0x50, 0xE4, 0xF5,
-    0x94, 0x27, 0x02, 0x2E, 0xB2, 0x6E, 0x68, 0xCE, 0x14, 0xC3, 0x0E, 0xEA, 0x28, 0xA6, 0x22, 0x5C,
-    0x04, 0x95, 0x56, 0xC9, 0x36, 0x62, 0xC4, 0xA7, 0x17, 0x7B, 0x93, 0x3C, 0x32, 0xEB, 0x73, 0x4C,
-    0xF3, 0x73, 0xA0, 0x76, 0x9A, 0x82, 0x3A, 0x9B, 0x1A, 0xD9, 0x40, 0x2C, 0xB0, 0x8B, 0x4B, 0x33,
-    0x7A, 0x1D, 0x72, 0x35, 0x8B, 0xB3, 0x96, 0xC8, 0xEA, 0x1B, 0xB9, 0x19, 0xBB, 0x69, 0x94, 0xB1,
-    0xC4, 0xD7, 0x33, 0x3A, 0x8F, 0x97, 0x32, 0x23, 0x31, 0xB3, 0x58, 0x62, 0x66, 0x24, 0x66, 0x6E,
-    0xC8, 0x54, 0x4E, 0xBC, 0x0B, 0x3A, 0x3B, 0xBF, 0x41, 0x51, 0xD3, 0xBB, 0xE0, 0x43, 0xEE, 0xFA,
-    0x9C, 0x6F, 0x66, 0x66, 0x9E, 0x25, 0x12, 0x02, 0x0D, 0xDD, 0xF1, 0xB2, 0x08, 0x9D, 0x98, 0x25,
-    0xCE, 0xDA, 0x21, 0x24, 0x5E, 0xBC, 0x16, 0x82, 0x7B, 0x62, 0xF2, 0xD2, 0xF4, 0x92, 0xF1, 0x42,
-    0x62, 0xA7, 0x11, 0xC4, 0x7E, 0x03, 0xBD, 0xE0, 0x3A, 0xB0, 0x1A, 0xDE, 0xC3, 0x56, 0x97, 0x6C,
-    0x35, 0x7C, 0x88, 0xA7, 0x5B, 0x6E, 0x42, 0x87, 0x67, 0xC5, 0x2D, 0x85, 0x61, 0x94, 0xBF, 0x5B,
-    0x28, 0x29, 0x68, 0x24, 0x3A, 0x8C, 0xF7, 0x3B, 0xC6, 0xDE, 0x9E, 0xB1, 0x77, 0xFD, 0x9C, 0xB1,
-    0x9A, 0xED, 0xB5, 0x3F, 0x61, 0x7B, 0x9D, 0x0F, 0xD9, 0x5E, 0x11, 0xB2, 0xBD, 0x72, 0xC7, 0x5E,
-    0x42, 0x06, 0xC1, 0x8C, 0x46, 0x31, 0xF2, 0x3A, 0xB5, 0xD9, 0xE4, 0x30, 0xD1, 0x71, 0x96, 0x6B,
-    0x35, 0xF0, 0x50, 0xCE, 0x68, 0x78, 0x98, 0x84, 0x38, 0x6E, 0x44, 0x61, 0x13, 0x7C, 0xD8, 0xC8,
-    0xAD, 0xCA, 0xBA, 0x7E, 0xA5, 0x0D, 0x2E, 0x3C, 0x25, 0x93, 0x8D, 0xC9, 0x36, 0x69, 0x6E, 0x65,
-    0x90, 0x8F, 0xC8, 0xAA, 0xF9, 0x1E, 0x4B, 0x71, 0x98, 0xB8, 0x60, 0x40, 0x92, 0x7B, 0x4F, 0x72,
-    0x9A, 0xEC, 0x78, 0x78, 0xA5, 0x07, 0xEE, 0xB4, 0xC2, 0x69, 0x7C, 0x9D, 0x93, 0xDC, 0xD7, 0xAF,
-    0x56, 0x64, 0x69, 0xA4, 0x0A, 0x3B, 0x85, 0x64, 0x0C, 0x99, 0x26, 0x97, 0x05, 0x23, 0x82, 0x22,
-    0xB5, 0x9C, 0x5A, 0xFA, 0xAE, 0x2E, 0x5D, 0x5D, 0x0D, 0xF8, 0xF3, 0xBB, 0xE4, 0x73, 0x50, 0x5F,
-    0xA4, 0x41, 0x18, 0x1C, 0x84, 0x5C, 0x9B, 0xE3, 0xCC, 0xE5, 0x49, 0x93, 0xBF, 0x60, 0x7E, 0x56,
-    0x76, 0x30, 0x72, 0x65, 0x0A, 0x1F, 0x0C, 0x1A, 0xBC, 0xFB, 0x5B, 0x0D, 0x56, 0xAF, 0xCD, 0xC4,
-    0x4F, 0x5C, 0xEE, 0x71, 0xF6, 0xD6, 0xE0, 0x25, 0x30, 0xF0, 0x5F, 0x82, 0xC3, 0x8D, 0x5B, 0xE1,
-    0x13, 0x17, 0x69, 0x38, 0x3B, 0x7F, 0x63, 0xA6, 0x0E, 0x98, 0xBA, 0xA7, 0xC3, 0x81, 0x0C, 0x33,
-    0xEC, 0xDF, 0x91, 0x26, 0xF7, 0x3C, 0xB0, 0x5A, 0x9B, 0xE1, 0x4D, 0xF4, 0x2A, 0xFF, 0x9C, 0xAA,
-    0x39, 0xD2, 0xE8, 0x37, 0x35, 0x31, 0x0A, 0xF8, 0x77, 0x4D, 0xC7, 0x20, 0xF7, 0x36, 0x6B, 0x84,
-    0xD8, 0x31, 0x3F, 0x62, 0xA1, 0x31, 0x73, 0x01, 0xE6, 0x18, 0x90, 0x39, 0xAB, 0x59, 0x82, 0x2E,
-    0x3D, 0xDB, 0x3C, 0x63, 0x79, 0x18, 0x9A, 0x4F, 0x5F, 0x31, 0x26, 0x28, 0x58, 0x32, 0x01, 0xA9,
-    0xF8, 0x91, 0xA8, 0x48, 0x36, 0xFF, 0x44, 0xE9, 0x33, 0x7A, 0x15, 0x69, 0xBC, 0x40, 0x31, 0xD2,
-    0xED, 0x48, 0xA2, 0xC8, 0x59, 0xCD, 0xF5, 0xDC, 0x2D, 0x9C, 0x52, 0x66, 0x76, 0xE9, 0x2B, 0x2B,
-    0x63, 0xCB, 0x10, 0x6F, 0x26, 0x97, 0x8F, 0xB6, 0xA8, 0x05, 0x17, 0x14, 0x40, 0xB2, 0x97, 0xD3,
-    0x51, 0x51, 0xD2, 0x0D, 0x5B, 0xEB, 0x9C, 0x96, 0x91, 0x4F, 0x39, 0x29, 0xD9, 0xE5, 0x20, 0x16,
-    0x90, 0x75, 0x8E, 0x70, 0x66, 0x2B, 0x5A, 0x19, 0x2C, 0x0A, 0xA1, 0xCD, 0xA9, 0x94, 0xAC, 0x36,
-    0x4C, 0x22, 0xAD, 0xCB, 0x99, 0xE6, 0x5A, 0xE9, 0x54, 0xB4, 0x82, 0xD6, 0x1D, 0x34, 0xDA, 0x6E,
-    0x40, 0x4C, 0x4E, 0xBD, 0x14, 0xEE, 0xBA, 0x57, 0xD1, 0x61, 0x87, 0x9D, 0xA2, 0xA2, 0xCE, 0x4C,
-    0xB3, 0xBA, 0x11, 0xB5, 0x06, 0xF3, 0xF0, 0x61, 0x10, 0x70, 0xEA, 0x30, 0x1C, 0x8B, 0xF7, 0x9F,
-    0x3F, 0xCF, 0x6D, 0x80, 0x0E, 0x37, 0xE7, 0xC9, 0xCA, 0xC4, 0xFE, 0xF2, 0x5F, 0x41, 0x71, 0xD9,
-    0x40, 0x12, 0xD9, 0xF0, 0x43, 0x9A, 0x1A, 0xDF, 0x6F, 0xDD, 0x31, 0x5D, 0xC8, 0x8C, 0x9C, 0x17,
-    0x57, 0x5A, 0xCE, 0x29, 0xC0, 0x07, 0xFA, 0x7C, 0xCF, 0x63, 0xA6, 0x09, 0xA3, 0x16, 0xC3, 0x70,
-    0x0A, 0xE6, 0x3A, 0x65, 0xA7, 0x7B, 0xE2, 0x83, 0x73, 0xC0, 0x1D, 0x5F, 0xC6, 0x5D, 0xC3, 0xE8,
-    0xC7, 0xF1, 0xE9, 0xB8, 0x31, 0x60, 0x1E, 0x8E, 0x31, 0xEB, 0xC7, 0x2B, 0x03, 0x14, 0x05, 0xE8,
-    0xD4, 0x30, 0x50, 0xAE, 0x10, 0xDA, 0xB8, 0x9F, 0x30, 0x8F, 0x40, 0x31, 0x49, 0x41, 0xFC, 0x0C,
-    0xC4, 0xCB, 0x02, 0x9D, 0x7B, 0xF9, 0x33, 0x75, 0xDF, 0xCB, 0x87, 0xF7, 0xFC, 0x74, 0xD8, 0x2F,
-    0x62, 0xC2, 0xA2, 0x11, 0x5C, 0x33, 0xCD, 0xF5, 0x82, 0x0C, 0xD3, 0xF6, 0xE3, 0x16, 0x08, 0x61,
-    0xAF, 0x01, 0xCE, 0xED, 0x00, 0x41, 0xD3, 0x73, 0x62, 0x00, 0x05, 0x71, 0x11, 0xD4, 0x33, 0xD0,
-    0xA2, 0x40, 0x2E, 0x71, 0x94, 0xA3, 0x63, 0x26, 0xC0, 0x0F, 0xCE, 0xC7, 0x39, 0xC8, 0x9F, 0x2A,
-    0x90, 0x5B, 0x35, 0x88, 0xD2, 0x4C, 0xA2, 0x5B, 0x20, 0xFE, 0xDF, 0x41, 0xE4, 0x7D, 0xC5, 0x3D,
-    0x41, 0x6C, 0x26, 0x64, 0x48, 0xA0, 0x66, 0xEE, 0x02, 0x05, 0x45, 0x15, 0x09, 0x35, 0xE0, 0xCF,
-    0xFE, 0xEF, 0xF1, 0x85, 0x63, 0x22, 0x6D, 0x7D, 0x58, 0x95, 0x7C, 0x54, 0x0C, 0x1B, 0x91, 0x4E,
-    0xA2, 0xB0, 0xD9, 0x30, 0x44, 0x25, 0x4F, 0x6A, 0x18, 0x30, 0x17, 0xAE, 0xBD, 0x2A, 0x19, 0x92,
-    0x74, 0x9B, 0xB4, 0x0F, 0x4C, 0x17, 0xD3, 0xD9, 0xBC, 0x26, 0x72, 0xE4, 0x14, 0xBB, 0xF9, 0x15,
-    0xCC, 0x5A, 0xD6, 0xC3, 0x22, 0x30, 0x52, 0x8B, 0x23, 0x1A, 0x00, 0x42, 0x3B, 0x3D, 0x48, 0xE1,
-    0x1C, 0x06, 0x24, 0x39, 0x3D, 0x02, 0xBC, 0xC0, 0xE1, 0x6D, 0x75, 0x80, 0xC2, 0xFD, 0x18, 0x45,
-    0x20, 0xD9, 0x82, 0xC1, 0xDF, 0x68, 0xC8, 0xBD, 0x72, 0xF2, 0x80, 0x2C, 0x9F, 0x03, 0x9A, 0xA2,
-    0x8B, 0x3C, 0xDF, 0x17, 0x25, 0xEE, 0x4D, 0x8D, 0x1F, 0xD8, 0x88, 0x1F, 0xA5, 0xE7, 0x4E, 0xD2,
-    0x4D, 0x71, 0x39, 0xB7, 0x3F, 0x57, 0x58, 0x1A, 0xD0, 0x07, 0x64, 0x6F, 0xC5, 0x62, 0x33, 0xF3,
-    0xE9, 0xC6, 0x31, 0x3A, 0xD1, 0xF6, 0xE9, 0xB2, 0x1E, 0xEB, 0xBB, 0xF4, 0x70, 0x58, 0x0F, 0x91,
-    0x40, 0x8F, 0x49, 0x16, 0x37, 0xC7, 0x2A, 0x74, 0x99, 0xAC, 0x41, 0x85, 0x4B, 0x29, 0xC8, 0x5B,
-    0x90, 0x1D, 0xBD, 0x8D, 0x0E, 0xC1, 0xC7, 0xAC, 0xC7, 0xBF, 0x58, 0x8F, 0x8A, 0xF5, 0x28, 0x86,
-    0x7A, 0xD8, 0x5F, 0x42, 0x0F, 0x67, 0x47, 0x15, 0x2E, 0xC0, 0xE4, 0x1A, 0x77, 0x37, 0x58, 0xA5,
-    0x33, 0xB8, 0x9F, 0x68, 0xA5, 0x8B, 0x65, 0x84, 0x7B, 0xEA, 0x56, 0x0C, 0x38, 0xCB, 0x1F, 0x40,
-    0x1C, 0x43, 0xAA, 0x96, 0x1C, 0xE7, 0xEA, 0x8F, 0x45, 0x96, 0xFE, 0xAC, 0x1C, 0x59, 0xD5, 0xFD,
-    0x7F, 0x18, 0x78, 0x30, 0xC2, 0x5B, 0x08, 0x84, 0xE9, 0x17, 0xB7, 0x32, 0xC6, 0xCC, 0x6B, 0x07,
-    0x23, 0x5C, 0x5C, 0x82, 0x34, 0xAC, 0x95, 0x06, 0xC4, 0xA2, 0xF0, 0x20, 0x8D, 0xF6, 0xF9, 0xD2,
-    0xAC, 0x01, 0x79, 0xBA, 0xB7, 0xF1, 0xAF, 0xD6, 0xA7, 0x91, 0xD7, 0x1B, 0x2B, 0x89, 0x01, 0x3C,
-    0xE6, 0x09, 0xF0, 0xA4, 0xC7, 0xAC, 0xD6, 0x79, 0x15, 0x01, 0x25, 0x35, 0xA7, 0xA3, 0xE8, 0x2D,
-    0x06, 0x30, 0x7F, 0xC6, 0xBB, 0xDE, 0x97, 0x3C, 0x77, 0x5C, 0x24, 0x5D, 0xE6, 0xC2, 0xA8, 0x6D,
-    0x94, 0xF0, 0xBD, 0x33, 0x9C, 0xCD, 0x19, 0x68, 0x71, 0xF1, 0xF2, 0x78, 0x01, 0xC3, 0x95, 0xB6,
-    0x79, 0xAF, 0xAD, 0xC0, 0x58, 0xFD, 0x3A, 0x95, 0x5B, 0x39, 0x0F, 0x7D, 0x81, 0xA5, 0x2A, 0x76,
-    0x74, 0x54, 0x86, 0xBA, 0x6F, 0xDE, 0x41, 0xC9, 0xA1, 0x68, 0xDB, 0x08, 0x9F, 0xA3, 0xA8, 0x01,
-    0x56, 0x74, 0x4A, 0x20, 0x26, 0xB7, 0xB0, 0x2A, 0xDE, 0x44, 0xE2, 0x92, 0x30, 0x51, 0x53, 0x52,
-    0x04, 0xFF, 0xC4, 0x19, 0xAF, 0x93, 0x8A, 0x8A, 0x89, 0x39, 0xC3, 0x1B, 0xA2, 0x40, 0xE9, 0x10,
-    0x85, 0xD7, 0x70, 0x24, 0xE9, 0x50, 0xA0, 0x8E, 0xC4, 0xE2, 0xEB, 0xD4, 0x8F, 0xC5, 0x37, 0x99,
-    0x1F, 0x9E, 0xF9, 0xFA, 0x41, 0x04, 0x5C, 0x17, 0x95, 0xBB, 0xFD, 0xD2, 0x66, 0x33, 0xDE, 0x24,
-    0xB3, 0xC8, 0x34, 0xB8, 0x79, 0x35, 0x86, 0x21, 0x58, 0xAE, 0x6D, 0xA2, 0x8E, 0x2D, 0xD4, 0x58,
-    0x6D, 0x35, 0x66, 0xE1, 0x3E, 0xA1, 0x1B, 0x0A, 0xEE, 0x35, 0xA8, 0x81, 0x0D, 0x5C, 0x0A, 0x0D,
-    0x43, 0x96, 0x38, 0x0D, 0x45, 0x5F, 0xE8, 0xD0, 0x2B, 0x13, 0xB5, 0x93, 0x64, 0xCB, 0x76, 0xAD,
-    0x05, 0xB4, 0xC2, 0xD1, 0xBD, 0x2F, 0x3C, 0xB9, 0x64, 0x61, 0x70, 0x9C, 0xDB, 0x48, 0x12, 0xE1,
-    0xCA, 0xBE, 0xF0, 0x74, 0xCA, 0xA7, 0x00, 0x34, 0x6E, 0x92, 0x5C, 0x2E, 0xE9, 0xD0, 0x44, 0xB6,
-    0x67, 0x9E, 0x4E, 0xBC, 0x46, 0xE2, 0x93, 0x92, 0xC4, 0xED, 0x82, 0xAC, 0xB0, 0xBF, 0x77, 0x1D,
-    0xC7, 0xDA, 0xBD, 0x12, 0xEB, 0x76, 0x4A, 0x96, 0x82, 0x7E, 0xF7, 0xD2, 0x41, 0xE9, 0xDE, 0x1B,
-    0x5F, 0x6B, 0x35, 0x5C, 0x0D, 0x3D, 0xBD, 0xA5, 0xF3, 0xE0, 0xB2, 0x7E, 0xAB, 0xF2, 0x17, 0xB4,
-    0x55, 0x8F, 0x9B, 0xDE, 0xFC, 0xC2, 0x04, 0x50, 0xBF, 0x0E, 0xEE, 0xE9, 0xD5, 0x3F, 0x32, 0x0F,
-    0xDC, 0x46, 0xF6, 0xD0, 0x96, 0xA6, 0xB1, 0x04, 0x29, 0x64, 0x36, 0xFA, 0xF2, 0xEA, 0xB7, 0x95,
-    0x57, 0xBB, 0x7A, 0x10, 0x4F, 0xAB, 0xB1, 0xD0, 0xA5, 0xBF, 0xC9, 0xBB, 0x7C, 0x09, 0x15, 0x89,
-    0xC9, 0x35, 0xED, 0x81, 0xF3, 0x28, 0x1C, 0x0B, 0xD4, 0x31, 0xEF, 0xDB, 0xCA, 0xD6, 0x66, 0x87,
-    0x02, 0xD1, 0x08, 0x04, 0xE2, 0xF2, 0xEE, 0x9C, 0xD5, 0x0C, 0x00, 0x10, 0xD4, 0xA9, 0x06, 0x70,
-    0x40, 0x0C, 0xF2, 0xC3, 0x59, 0x74, 0xD3, 0x05, 0xF9, 0x1F, 0x02, 0x41, 0xC5, 0x50, 0x7D, 0xB8,
-    0xAF, 0x84, 0xD5, 0x88, 0x5E, 0x5D, 0x35, 0xD9, 0x2C, 0x31, 0x1E, 0x61, 0xA1, 0x22, 0x4D, 0xA2,
-    0x9A, 0x6F, 0x60, 0x95, 0x57, 0xEC, 0xAE, 0xF1, 0xEC, 0x7E, 0x5E, 0x68, 0xB6, 0xC4, 0xF6, 0x85,
-    0x27, 0x4F, 0xC3, 0x77, 0xDC, 0x6F, 0x2F, 0x3C, 0x77, 0x5C, 0xA5, 0xDC, 0x76, 0x95, 0x3D, 0xEA,
-    0x88, 0x5A, 0x8C, 0x6C, 0xC1, 0x1B, 0xCA, 0xC6, 0xE6, 0xF1, 0x45, 0xF2, 0x6B, 0x72, 0x50, 0x0C,
-    0x1F, 0x7D, 0xB8, 0x3A, 0xF4, 0xDB, 0x84, 0x13, 0x85, 0x58, 0x1A, 0x39, 0xC5, 0x60, 0x61, 0x34,
-    0xDD, 0x47, 0x86, 0xE1, 0x85, 0x99, 0x78, 0xF4, 0xE1, 0xD5, 0x83, 0x3D, 0x21, 0x8C, 0xB6, 0x18,
-    0x41, 0xEB, 0xDF, 0x5F, 0xEE, 0x77, 0x10, 0xFA, 0x0F, 0x53, 0xD8, 0xBD, 0x72, 0x94, 0xDC, 0xA6,
-    0x30, 0xEB, 0x4C, 0x0B, 0xAB, 0x4B, 0xFB, 0x12, 0x7B, 0x11, 0xE0, 0x85, 0x4E, 0x48, 0x6E, 0xE9,
-    0x18, 0x60, 0x41, 0x31, 0x8E, 0x49, 0x30, 0x2E, 0xD0, 0x6E, 0xBB, 0xF1, 0x75, 0x64, 0xFE, 0x00,
-    0x88, 0x48, 0x7E, 0x0A, 0xA6, 0x43, 0x47, 0x6E, 0x93, 0xCC, 0x8B, 0x08, 0x10, 0xBD, 0xA5, 0xC8,
-    0xFE, 0x07, 0x6C, 0xB3, 0xE2, 0x37, 0x07, 0xF7, 0xA7, 0xFB, 0x67, 0xF1, 0xF0, 0x3F, 0x10, 0x2D,
-    0x9B, 0x65, 0x78, 0x00, 0xB2, 0x3A, 0x2A, 0x87, 0x19, 0x88, 0xC7, 0x12, 0xAF, 0x16, 0x3C, 0x54,
-    0x42, 0x3F, 0x32, 0xDF, 0xD2, 0x59, 0x24, 0x6E, 0xC4, 0x32, 0x6B, 0x08, 0xCD, 0xC2, 0x87, 0xF5,
-    0x0E, 0x76, 0xEB, 0x7D, 0xAF, 0x7E, 0xD8, 0xE1, 0x19, 0xD9, 0x48, 0xB5, 0x03, 0x6B, 0xF6, 0xCA,
-    0x73, 0x98, 0x6F, 0xEF, 0xC0, 0x8C, 0xB0, 0xB7, 0x2F, 0x3C, 0x6D, 0xE4, 0x5B, 0xA1, 0x37, 0x90,
-    0x6F, 0x2B, 0x3A, 0x64, 0x67, 0x7B, 0xE6, 0x69, 0xAB, 0x75, 0x12, 0x77, 0x50, 0x17, 0xEF, 0x8C,
-    0x06, 0xD1, 0x1E, 0x74, 0x1C, 0x33, 0x9B, 0xE4, 0x98, 0x99, 0x13, 0xC3, 0x41, 0x68, 0x37, 0xD8,
-    0xDB, 0xCF, 0x94, 0x79, 0x74, 0xCA, 0x9C, 0x00, 0xCC, 0xD0, 0xD9, 0xAB, 0xE6, 0x6F, 0xA0, 0x56,
-    0x92, 0x0E, 0xA3, 0x05, 0xAD, 0x12, 0x27, 0x51, 0x5A, 0xE0, 0xCE, 0x2C, 0x5A, 0x0F, 0xDE, 0xB6,
-    0x06, 0x49, 0x19, 0x24, 0xA9, 0x56, 0x92, 0x84, 0xA4, 0xB9, 0xED, 0xE1, 0x30, 0xFB, 0x06, 0x89,
-    0xC1, 0xA6, 0xF1, 0xE8, 0x42, 0x68, 0xBA, 0x8F, 0x00, 0x8C, 0xF2, 0x28, 0x87, 0xB7, 0xB0, 0xA3,
-    0xE5, 0xE2, 0xB1, 0xA4, 0x40, 0x3F, 0xB7, 0xF2, 0x80, 0x16, 0xF4, 0xD6, 0x03, 0x4C, 0xDC, 0x5F,
-    0xF4, 0x2E, 0x2C, 0xC4, 0x5B, 0x1F, 0x54, 0x0F, 0x97, 0x7B, 0x6E, 0xFC, 0xA4, 0x04, 0xB5, 0x28,
-    0x97, 0xDD, 0xFB, 0x26, 0xEF, 0xEF, 0x67, 0xC3, 0x8C, 0xBE, 0x9F, 0x82, 0x56, 0x8E, 0x33, 0xA4,
-    0x0B, 0x86, 0xE4, 0xE9, 0xB1, 0x27, 0x64, 0x0C, 0x57, 0x28, 0x06, 0x32, 0xBC, 0x26, 0x1F, 0xFC,
-    0xC3, 0xB7, 0xB4, 0x38, 0xDD, 0xD7, 0x55, 0x50, 0xF8, 0xB9, 0xAB, 0x64, 0xE6, 0xC6, 0xC2, 0xFC,
-    0xEB, 0xC6, 0x50, 0x74, 0x16, 0x41, 0x8D, 0x89, 0x6D, 0x80, 0x76, 0x92, 0xF3, 0xF0, 0x1B, 0xDE,
-    0x0B, 0xE2, 0x0A, 0x94, 0xB6, 0x41, 0xC9, 0xAB, 0x2E, 0xAF, 0xDD, 0xF2, 0xE2, 0x6A, 0x17, 0xC0,
-    0xDF, 0x9E, 0x0F, 0xDB, 0x6E, 0x5E, 0xDE, 0xFE, 0x43, 0xB8, 0xD3, 0xDE, 0x20, 0x71, 0x5F, 0x2B,
-    0xD1, 0x9C, 0xC9, 0x05, 0x50, 0xA2, 0x28, 0x1C, 0x24, 0x1A, 0xA7, 0x12, 0xF9, 0x48, 0xE3, 0xEB,
-    0x12, 0xF7, 0x71, 0x26, 0xF4, 0xF5, 0x4C, 0x7C, 0xA5, 0xA1, 0xCB, 0xD4, 0x0E, 0x0F, 0xF0, 0x47,
-    0x7E, 0x6E, 0x13, 0xF4, 0x5A, 0x87, 0xAC, 0x32, 0x22, 0xFE, 0x17, 0x8F, 0xFA, 0x53, 0x4F, 0xC4,
-    0x8E, 0xFF, 0x02, 0xBD, 0x5A, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0xED, 0x10, 0x01, 0x01,
-    0x31, 0x43, 0x8D, 0xA6, 0x51, 0x6D, 0x2E, 0x19, 0x82, 0xC0, 0x36, 0xC7, 0x7A, 0x90, 0x4D, 0xDA,
-    0x1E, 0x32, 0x5A, 0x83, 0xDD, 0x0E, 0x19, 0x9C, 0xB5, 0xC9, 0xA0, 0x0E, 0x1E, 0x54, 0xC0, 0x0E,
-    0x59, 0xA4, 0x40, 0x87, 0x0E, 0xF1, 0x92, 0x74, 0xC8, 0xD0, 0x0C, 0x1D, 0x0A, 0x65, 0xB0, 0x07,
-    0x0D, 0x29, 0xE0, 0x98, 0x8C, 0x3D, 0x64, 0xE8, 0x10, 0x26, 0x01, 0xDA, 0xA9, 0x00, 0x81, 0xA8,
-    0x2E, 0xA0, 0xA1, 0x21, 0x52, 0x0A, 0x66, 0x1C, 0x92, 0xB7, 0xDF, 0x77, 0x2F, 0xF9, 0xF4, 0x13,
-    0x4B, 0xB1, 0xA4, 0xF7, 0xF4, 0xF4, 0xEE, 0x11, 0x1F, 0x7F, 0xEE, 0x3D, 0xE7, 0xDC, 0x7B, 0xCE,
-    0xF9, 0xCE, 0xB9, 0x14, 0xE1, 0x27, 0x50, 0xB9, 0x88, 0x4F, 0xA2, 0x3F, 0x56, 0x07, 0x62, 0x2B,
-    0x10, 0x87, 0xC4, 0xCD, 0x62, 0x5C, 0x8D, 0x70, 0x75, 0x2E, 0x04, 0x39, 0x13, 0x94, 0x22, 0x0B,
-    0x7E, 0x25, 0xB2, 0xEC, 0x81, 0xAC, 0xBA, 0x8D, 0xC8, 0xC6, 0xAF, 0x5A, 0xB1, 0x94, 0xEA, 0xC4,
-    0x2E, 0xAC, 0x5E, 0x9C, 0x5C, 0x94, 0xB8, 0xA9, 0x64, 0xB1, 0x1F, 0x4B, 0x92, 0x2F, 0x15, 0x96,
-    0x5A, 0x53, 0x8D, 0xAB, 0x5A, 0xD1, 0x5D, 0x56, 0xBA, 0xE9, 0x81, 0x56, 0x52, 0x8C, 0xDD, 0x48,
-    0xF4, 0xA0, 0x95, 0xF0, 0x62, 0x27, 0xC7, 0xA5, 0xC7, 0xD9, 0x5E, 0x9E, 0x53, 0xBD, 0x44, 0x8F,
-    0x7A, 0x74, 0xD0, 0xA3, 0x27, 0x34, 0x74, 0x9A, 0x39, 0xBD, 0x24, 0xFF, 0x55, 0x71, 0xD0, 0x64,
-    0x23, 0x9F, 0xF8, 0x9C, 0xB4, 0x0A, 0xF0, 0xF6, 0x01, 0xCE, 0x78, 0x2A, 0x45, 0x87, 0x7F, 0x93,
-    0xA3, 0x90, 0xC1, 0x97, 0x4A, 0xBC, 0x7F, 0x50, 0x0E, 0xF4, 0x75, 0x5F, 0x0E, 0x2F, 0xCB, 0x2C,
-    0xB9, 0x0D, 0x38, 0xC0, 0x4D, 0x92, 0x86, 0x44, 0x0B, 0x90, 0x51, 0xFF, 0x61, 0x79, 0x60, 0x9E,
-    0x6D, 0x30, 0xE4, 0xA5, 0xA6, 0xEF, 0x80, 0xBC, 0x82, 0x7F, 0xB7, 0x1B, 0x54, 0x4F, 0xBE, 0x13,
-    0x33, 0x92, 0x5D, 0x98, 0x53, 0xA1, 0x4A, 0xAD, 0xFE, 0x4E, 0xE5, 0xD6, 0x4E, 0xE3, 0x97, 0x76,
-    0x13, 0xE6, 0x56, 0xA9, 0xEF, 0x42, 0x17, 0xD9, 0x8E, 0x96, 0xE4, 0xA6, 0x87, 0x08, 0x8F, 0x06,
-    0x95, 0xBC, 0xE8, 0x35, 0xF2, 0xB1, 0xAD, 0xB0, 0x60, 0x96, 0x38, 0xC1, 0xE6, 0xE3, 0xD6, 0xE2,
-    0x17, 0x12, 0xC5, 0xB2, 0xAC, 0x7F, 0xAE, 0xA4, 0x9E, 0x6A, 0xC2, 0x07, 0x6D, 0x14, 0xB7, 0x99,
-    0xD4, 0x99, 0x80, 0xE7, 0xE1, 0x8B, 0xE3, 0x24, 0x3E, 0x16, 0xE5, 0x3F, 0x0F, 0x9E, 0xB4, 0xB6,
-    0x2A, 0xC7, 0xE7, 0xD1, 0xA7, 0x04, 0x60, 0xF7, 0x7C, 0x40, 0x6D, 0xA6, 0xB3, 0x60, 0x51, 0xC5,
-    0xB6, 0xCA, 0xDD, 0x07, 0x95, 0x2F, 0xAB, 0x07, 0x62, 0xD1, 0xA9, 0x21, 0x26, 0x34, 0xE8, 0x70,
-    0xD2, 0xE2, 0x99, 0x68, 0x91, 0x5C, 0xC4, 0xA4, 0xC7, 0x0E, 0xA6, 0xC5, 0x8F, 0xB1, 0x02, 0x2E,
-    0x44, 0x98, 0xFC, 0x56, 0xCF, 0xC8, 0x0C, 0x58, 0xF4, 0xE3, 0xDA, 0xF9, 0xBA, 0xB4, 0x60, 0x65,
-    0xD9, 0xC1, 0x58, 0x94, 0xF3, 0x0E, 0xFD, 0xC3, 0x15, 0x74, 0xE8, 0x72, 0x69, 0xDB, 0xED, 0x70,
-    0x3E, 0x51, 0x7D, 0x2C, 0x41, 0x9F, 0xD5, 0xE2, 0xB4, 0x36, 0xEC, 0xA7, 0xC5, 0x5A, 0x07, 0x89,
-    0x72, 0x92, 0x02, 0x24, 0x2C, 0x41, 0x02, 0x4D, 0xAA, 0x91, 0xE8, 0x73, 0x61, 0x31, 0xDE, 0x97,
-    0x90, 0x28, 0x3C, 0x66, 0x77, 0x32, 0xDF, 0xDF, 0xA9, 0x4D, 0xA7, 0xE2, 0xAA, 0x77, 0x2A, 0x98,
-    0xE6, 0x1F, 0x30, 0x70, 0xF4, 0x47, 0x0C, 0x1C, 0xBD, 0x4B, 0x9B, 0x48, 0xC5, 0xFA, 0x2B, 0x88,
-    0xAF, 0xA0, 0x8A, 0xE8, 0x0B, 0x48, 0x98, 0xA4, 0x50, 0x42, 0x46, 0xCD, 0x64, 0xBC, 0xAA, 0xB6,
-    0x13, 0x7D, 0x2E, 0x89, 0x79, 0x73, 0x0E, 0xF1, 0xC3, 0xEF, 0xBF, 0x59, 0x13, 0xAF, 0x0F, 0xDA,
-    0xFD, 0x71, 0x1F, 0xA9, 0x2A, 0xA8, 0x7E, 0xDA, 0x2D, 0xEE, 0x8B, 0x7B, 0x70, 0xCA, 0x09, 0xC0,
-    0xF8, 0x11, 0x5C, 0xC3, 0xAB, 0xD9, 0x1A, 0x8F, 0xED, 0x2E, 0x4A, 0x03, 0x95, 0xA5, 0xE0, 0x26,
-    0x4D, 0xE2, 0x2C, 0x25, 0xE3, 0x64, 0x74, 0x6C, 0xE4, 0x37, 0x03, 0xBB, 0xF8, 0x95, 0x93, 0xD9,
-    0x4D, 0x5E, 0x35, 0xBB, 0x68, 0xFD, 0x70, 0xA8, 0x9A, 0xF9, 0xFE, 0xA3, 0x06, 0x63, 0x2F, 0xA3,
-    0x9D, 0x1B, 0x9A, 0x4C, 0x9A, 0x52, 0xB9, 0xD3, 0x5D, 0x8B, 0xB7, 0x9D, 0x6B, 0xE5, 0x79, 0xB4,
-    0x53, 0x68, 0x67, 0xE6, 0xFB, 0x95, 0x4F, 0x12, 0xBA, 0xBD, 0x1D, 0x91, 0x44, 0xDE, 0x8C, 0x11,
-    0x01, 0x6A, 0x09, 0x3F, 0x85, 0x78, 0x29, 0x3C, 0x15, 0x34, 0xC8, 0x3F, 0xA5, 0x94, 0xA8, 0x95,
-    0x15, 0x2E, 0x11, 0xBD, 0x86, 0x92, 0xD4, 0x82, 0x86, 0xE6, 0xC4, 0xEF, 0x3F, 0x81, 0xBF, 0xAD,
-    0x37, 0x03, 0xC9, 0x5D, 0x2F, 0x96, 0x5B, 0x4B, 0x58, 0xC0, 0xF4, 0x64, 0x6B, 0x53, 0xE7, 0xD5,
-    0x8B, 0x57, 0xC5, 0x7D, 0x54, 0x61, 0x4C, 0x2C, 0x8B, 0xB7, 0xE3, 0xE9, 0xF0, 0xEC, 0x42, 0x76,
-    0x1F, 0xBF, 0x19, 0x14, 0x06, 0x1F, 0x31, 0x4D, 0x9E, 0xB5, 0x13, 0xD7, 0x96, 0x1A, 0x8F, 0x3E,
-    0xE2, 0x50, 0x3C, 0x4F, 0x8F, 0x37, 0x37, 0x37, 0xA1, 0xE7, 0xC2, 0xD0, 0xC2, 0x56, 0xFB, 0xF4,
-    0x67, 0xE6, 0x4D, 0x0C, 0x6F, 0x4F, 0x3A, 0xC3, 0x1B, 0x23, 0xD9, 0x59, 0x3A, 0x0B, 0xB4, 0x5B,
-    0x34, 0x56, 0xF8, 0x5C, 0x6F, 0xD0, 0x73, 0x8D, 0x80, 0x7A, 0x01, 0x63, 0x70, 0x39, 0x7B, 0xD5,
-    0xD4, 0x75, 0x0C, 0x0F, 0x27, 0x70, 0x71, 0x42, 0x1F, 0x37, 0x38, 0xB9, 0xC3, 0xAF, 0x0B, 0x71,
-    0xD8, 0xB7, 0xC7, 0xFB, 0x02, 0x0F, 0xFD, 0x2E, 0x58, 0x43, 0x18, 0x96, 0x79, 0xBA, 0x46, 0xF5,
-    0x51, 0x27, 0x80, 0x10, 0x4A, 0x80, 0x28, 0x12, 0x78, 0x04, 0x44, 0x51, 0xFA, 0x61, 0xED, 0x90,
-    0xF5, 0x7C, 0x8F, 0xE4, 0xF8, 0x35, 0x58, 0x7A, 0xA0, 0x8A, 0x24, 0x07, 0x34, 0x89, 0x08, 0x31,
-    0xE0, 0xAB, 0x15, 0x9D, 0xB5, 0xA2, 0xBA, 0x15, 0xB8, 0x7E, 0xBF, 0xA7, 0xCF, 0x5F, 0xDB, 0x32,
-    0x76, 0x46, 0xFF, 0x51, 0x88, 0xF3, 0x05, 0x20, 0x52, 0xCC, 0xF8, 0x6C, 0xC5, 0xB2, 0x72, 0xA5,
-    0xF2, 0x54, 0x5F, 0x05, 0x79, 0x1B, 0x87, 0x10, 0x28, 0x4A, 0xEF, 0xEB, 0x16, 0xE6, 0x9D, 0xF8,
-    0x5F, 0xB6, 0x42, 0x87, 0xED, 0xFE, 0x9E, 0xB0, 0x0A, 0x0C, 0xAF, 0xFF, 0x05, 0x4E, 0x52, 0xC5,
-    0x2E, 0x94, 0x18, 0xBD, 0x97, 0xE4, 0xAD, 0xF8, 0xBA, 0x75, 0x12, 0xC6, 0xD1, 0x3A, 0xA1, 0xC9,
-    0xED, 0x61, 0xA0, 0xD3, 0x36, 0x57, 0xC1, 0xEB, 0x1A, 0xB9, 0x62, 0x81, 0x5A, 0x8D, 0x1C, 0x99,
-    0x90, 0x5E, 0x7C, 0x43, 0x9C, 0x6D, 0xD6, 0x3C, 0x2B, 0x21, 0x75, 0xC0, 0xD2, 0xD3, 0x69, 0x42,
-    0xD7, 0x0B, 0x47, 0x27, 0xE4, 0x0F, 0xCD, 0x7F, 0x56, 0x42, 0xCE, 0x5A, 0x96, 0xAB, 0x54, 0x1F,
-    0x6D, 0xD7, 0x21, 0x30, 0x70, 0xD8, 0xA1, 0x3D, 0x31, 0x95, 0xDC, 0xD8, 0x3F, 0xCC, 0x5C, 0xC2,
-    0x59, 0x0A, 0x49, 0xAC, 0x85, 0x47, 0x31, 0x9C, 0xFB, 0x25, 0xFD, 0xB6, 0xDC, 0x18, 0x83, 0xE3,
-    0xA7, 0xAA, 0x0F, 0xD4, 0xC5, 0xEC, 0xBB, 0x6D, 0x31, 0xFA, 0x87, 0x04, 0xE6, 0x5F, 0xC0, 0xAD,
-    0x2C, 0x15, 0xBB, 0xDF, 0x42, 0x32, 0xDF, 0xC7, 0xC9, 0x46, 0xA2, 0x1E, 0x28, 0x65, 0x32, 0x0B,
-    0x93, 0x54, 0x50, 0x42, 0x22, 0x92, 0x93, 0x52, 0x8D, 0x76, 0x4A, 0x87, 0x11, 0x90, 0x78, 0x3B,
-    0xC9, 0x9B, 0x20, 0x8F, 0xB1, 0xB4, 0xBD, 0x7E, 0x09, 0x46, 0xDC, 0x62, 0x42, 0xBC, 0x06, 0x97,
-    0xBC, 0xFA, 0x47, 0x49, 0xD0, 0x79, 0x9D, 0x64, 0x0A, 0xAE, 0x47, 0x8B, 0x25, 0x5A, 0x2E, 0xD1,
-    0x82, 0x69, 0x5A, 0xD0, 0x79, 0x82, 0xB3, 0xB7, 0xFA, 0x95, 0x6C, 0x7D, 0x38, 0x33, 0x50, 0x8A,
-    0x27, 0x5A, 0xBE, 0xED, 0xE7, 0x77, 0xA1, 0x5A, 0x4C, 0x31, 0x72, 0xEE, 0x10, 0x25, 0x23, 0x26,
-    0x58, 0x7A, 0xF2, 0xE1, 0x44, 0x9E, 0xFB, 0xF1, 0x28, 0x4F, 0x38, 0xCA, 0xB3, 0x1F, 0x51, 0x18,
-    0x60, 0xF2, 0x0F, 0x93, 0x27, 0xE5, 0x86, 0xCA, 0x6F, 0x9F, 0x35, 0x73, 0x56, 0x04, 0x84, 0x4E,
-    0xF2, 0x8C, 0x5F, 0x32, 0x4B, 0x57, 0x21, 0x41, 0xF1, 0x9B, 0xA8, 0xAF, 0x7E, 0xAB, 0x8A, 0x37,
-    0x98, 0x35, 0xC9, 0xF1, 0xAB, 0xC4, 0x1B, 0x30, 0x6F, 0x7B, 0xF7, 0xAF, 0xAB, 0xE2, 0x50, 0x3F,
-    0x0B, 0x68, 0x1D, 0x6A, 0x64, 0x7C, 0xE0, 0xD1, 0xB3, 0x9E, 0x5F, 0x7C, 0x4E, 0x2C, 0x52, 0x67,
-    0x3E, 0x25, 0xDD, 0xF5, 0x1B, 0x50, 0x7A, 0x32, 0xB9, 0xE0, 0xE4, 0xE1, 0xF5, 0xD4, 0x57, 0x62,
-    0x37, 0x87, 0x92, 0xFD, 0xAE, 0x47, 0x80, 0x15, 0x41, 0xA2, 0x72, 0x7F, 0x3C, 0x1C, 0x70, 0xC4,
-    0x55, 0x9A, 0x3B, 0x90, 0x82, 0xCB, 0xC5, 0x15, 0x5B, 0x5A, 0x16, 0x20, 0x26, 0x8E, 0x58, 0x0D,
-    0x70, 0xE9, 0xD9, 0x79, 0xB0, 0x4A, 0x41, 0x24, 0x85, 0x93, 0xF0, 0x81, 0xE1, 0x7B, 0xCE, 0x8B,
-    0xE8, 0xDC, 0xCC, 0x8C, 0x28, 0x8B, 0x07, 0xD7, 0xCC, 0x7E, 0xF4, 0xF0, 0x95, 0xEA, 0x68, 0x51,
-    0xF5, 0x04, 0xEB, 0x1F, 0x8A, 0x60, 0xFC, 0x28, 0x07, 0x07, 0xDA, 0xCD, 0x6E, 0x21, 0x5C, 0x63,
-    0x5C, 0xF5, 0x1E, 0x85, 0x0C, 0xCA, 0x01, 0x6A, 0xDA, 0xAD, 0x8F, 0x71, 0x3D, 0xFC, 0x87, 0xEE,
-    0x16, 0x8D, 0xF6, 0x4E, 0x5C, 0xCD, 0xEA, 0xD0, 0x9C, 0xAF, 0xED, 0x1F, 0x6D, 0x41, 0x67, 0xB7,
-    0x99, 0xBA, 0xD4, 0x9A, 0x58, 0x36, 0x22, 0x23, 0x66, 0x8E, 0x4B, 0x18, 0xE4, 0xBE, 0x9E, 0x11,
-    0x45, 0x17, 0xE9, 0x3D, 0x2C, 0xE7, 0x74, 0xDA, 0xEC, 0xAB, 0xFA, 0x39, 0x55, 0x6C, 0x66, 0x79,
-    0xFB, 0xF9, 0x5A, 0x3A, 0x2F, 0x0A, 0x6B, 0x13, 0x36, 0x78, 0x8C, 0x79, 0x0B, 0xFD, 0x74, 0x99,
-    0xB0, 0xE1, 0x99, 0x2C, 0x6F, 0xF3, 0xAB, 0xA7, 0x0B, 0xC1, 0x09, 0xEE, 0x10, 0x6C, 0x72, 0x1E,
-    0xCA, 0xF9, 0xFE, 0x92, 0xBA, 0x8D, 0xB3, 0x1D, 0x2F, 0x21, 0x0F, 0x69, 0x1D, 0x7A, 0x26, 0x2C,
-    0x10, 0xA7, 0x3D, 0xCF, 0xD1, 0xEE, 0x81, 0xF4, 0xBD, 0x06, 0x83, 0x0C, 0xE0, 0x59, 0x8E, 0x73,
-    0x11, 0x6F, 0x09, 0x78, 0xB3, 0xCF, 0x95, 0xE3, 0xF2, 0x59, 0xC4, 0x30, 0xCC, 0x03, 0xA2, 0x99,
-    0x2A, 0xC2, 0x11, 0xC2, 0x9D, 0x90, 0x01, 0x88, 0xCA, 0xC7, 0x24, 0xDA, 0x63, 0xA7, 0xC6, 0x63,
-    0xD3, 0xCB, 0x79, 0xDB, 0xDA, 0x89, 0xAB, 0x5E, 0x9D, 0x40, 0xBF, 0x7E, 0xE1, 0xD5, 0x21, 0x7E,
-    0xDF, 0x14, 0x6F, 0x03, 0x8B, 0xE6, 0x71, 0x03, 0x00, 0xD8, 0x61, 0x0E, 0x11, 0x14, 0xEB, 0x2C,
-    0xF5, 0xEA, 0x08, 0xD7, 0x83, 0x8A, 0x5E, 0x2D, 0x53, 0x17, 0x87, 0xD8, 0x80, 0x69, 0x74, 0xD0,
-    0x3B, 0x73, 0x64, 0x56, 0x41, 0x9E, 0x1B, 0xE7, 0x34, 0xC1, 0x9C, 0x6E, 0xED, 0x0F, 0x0E, 0xF3,
-    0x31, 0xFA, 0x54, 0x2D, 0x5C, 0x68, 0x8F, 0x73, 0x2A, 0xC6, 0x98, 0x39, 0xAE, 0xA3, 0x3F, 0x1F,
-    0xFD, 0x5D, 0x32, 0xFD, 0xD1, 0xAE, 0x02, 0x66, 0xF4, 0x38, 0x5E, 0x1D, 0xA3, 0x5B, 0x81, 0x44,
-    0x35, 0x96, 0x1D, 0x58, 0x78, 0xAF, 0x46, 0x9C, 0x3C, 0x87, 0x76, 0x72, 0xC0, 0xCA, 0xDD, 0x88,
-    0x95, 0xB1, 0x30, 0x7B, 0xB1, 0x6A, 0x13, 0xC0, 0xA9, 0x8D, 0x60, 0x4F, 0xA3, 0xD9, 0xC3, 0x9D,
-    0x4C, 0x8D, 0x25, 0xA3, 0xC2, 0xD2, 0x64, 0x24, 0xC8, 0x20, 0xE5, 0xF8, 0x21, 0x18, 0x33, 0xDD,
-    0x19, 0xA7, 0x85, 0x85, 0xF4, 0xBC, 0xD6, 0xDE, 0x3D, 0xB0, 0x8A, 0x4C, 0xC3, 0x42, 0x06, 0x6F,
-    0x17, 0x07, 0x65, 0x35, 0xAB, 0x6F, 0x05, 0xF5, 0x3D, 0xAF, 0xAE, 0xBD, 0x8D, 0x72, 0x8A, 0xBA,
-    0xDA, 0xFA, 0x27, 0x8B, 0x7B, 0x33, 0xF0, 0xB4, 0xA5, 0xBB, 0xB3, 0x65, 0xC3, 0xD2, 0xE2, 0xFF,
-    0x9F, 0xFC, 0xE0, 0x3A, 0x0B, 0x76, 0xD4, 0xD2, 0xD3, 0x79, 0x7A, 0x11, 0x0D, 0x46, 0x45, 0x0C,
-    0xD1, 0x9B, 0xCA, 0x19, 0x93, 0xC2, 0x5F, 0xEC, 0xCD, 0xD3, 0xD3, 0xE7, 0x09, 0x2C, 0x70, 0x91,
-    0x4B, 0x54, 0x4B, 0xB2, 0xCB, 0x3C, 0x0D, 0xDE, 0x1F, 0x1E, 0x8A, 0xEE, 0x31, 0xE4, 0xA9, 0x73,
-    0x23, 0x6A, 0xC6, 0x83, 0xDD, 0x3C, 0xBC, 0x7B, 0xED, 0x28, 0x2C, 0x55, 0x40, 0x2F, 0x92, 0x02,
-    0xE4, 0xF3, 0x0A, 0xE4, 0xB3, 0x16, 0xE4, 0x61, 0x07, 0x92, 0x2B, 0x92, 0xE4, 0x21, 0x48, 0xF8,
-    0x35, 0x88, 0xFF, 0x38, 0xE7, 0x9D, 0x20, 0x36, 0x89, 0x68, 0x02, 0x2F, 0xBD, 0x06, 0x9B, 0x4A,
-    0x5A, 0x86, 0x9F, 0xA1, 0xBC, 0x9A, 0xEA, 0x1A, 0xAD, 0xD0, 0x14, 0x06, 0x34, 0x6B, 0xBC, 0x31,
-    0x60, 0x5B, 0xF2, 0x3F, 0x28, 0xC0, 0x3F, 0x0C, 0x6C, 0x9B, 0x35, 0xF7, 0x9B, 0xBE, 0xED, 0xDE,
-    0xC4, 0xB7, 0xDD, 0x9E, 0x16, 0xF7, 0x32, 0xB1, 0x49, 0x03, 0xF5, 0x69, 0x95, 0xDA, 0x2C, 0x69,
-    0x97, 0x63, 0x4D, 0x31, 0x85, 0x53, 0x65, 0xCA, 0x8D, 0x20, 0xA1, 0xF3, 0x8B, 0xF8, 0x68, 0xE6,
-    0x8D, 0xD5, 0x52, 0x5D, 0x2E, 0xD5, 0xF5, 0xD2, 0x49, 0xC1, 0x74, 0x4A, 0x92, 0x9F, 0xDD, 0x5C,
-    0x1A, 0x26, 0x8A, 0x6B, 0x47, 0x8C, 0x61, 0xDE, 0xBB, 0xFA, 0x2A, 0x40, 0x4B, 0xD8, 0x01, 0x13,
-    0xDF, 0x74, 0xD4, 0x9F, 0x1B, 0xD8, 0x69, 0x3F, 0x5A, 0xEF, 0x7E, 0xE8, 0x7C, 0x7F, 0x19, 0x36,
-    0x17, 0xA9, 0x87, 0x2A, 0x35, 0x9A, 0xEA, 0xF6, 0xD4, 0xD4, 0x83, 0x5E, 0x6B, 0xEA, 0x32, 0x48,
-    0x44, 0x4D, 0x05, 0xD4, 0x94, 0x37, 0xD1, 0x94, 0xA5, 0x95, 0x94, 0x4D, 0x34, 0xE5, 0x53, 0x53,
-    0x7A, 0xB6, 0x9C, 0xED, 0xC4, 0x4B, 0x87, 0x44, 0x54, 0x1A, 0xAD, 0x29, 0x2A, 0x8A, 0x7A, 0xA2,
-    0x9A, 0xA8, 0xA5, 0xBD, 0xFE, 0xA0, 0x9D, 0x1A, 0xCA, 0x19, 0x5D, 0x08, 0x93, 0xAE, 0xCA, 0x58,
-    0x2C, 0x77, 0x5D, 0x26, 0xBB, 0x15, 0x34, 0xE8, 0x70, 0x62, 0xD5, 0x3C, 0xB2, 0xFB, 0x3B, 0x4C,
-    0x11, 0x6C, 0x96, 0x50, 0x45, 0xE7, 0x98, 0x09, 0x90, 0x12, 0xFE, 0xEB, 0x72, 0x6C, 0x36, 0x92,
-    0x62, 0x42, 0xCC, 0x05, 0x7D, 0x8B, 0xBE, 0x59, 0x3F, 0xE6, 0x55, 0x16, 0xA0, 0x43, 0xFF, 0x3A,
-    0xF1, 0xCD, 0x66, 0xD1, 0x7D, 0x67, 0xD9, 0x32, 0x85, 0xBF, 0x69, 0x90, 0x5F, 0xB0, 0x88, 0x1A,
-    0xC5, 0x1C, 0x27, 0x63, 0xC9, 0x57, 0x9F, 0xD1, 0x67, 0xF5, 0x6F, 0x9C, 0x4F, 0xA3, 0x34, 0x11,
-    0xFF, 0x51, 0xB7, 0xA3, 0xD4, 0x73, 0xCE, 0xE1, 0xB2, 0xBA, 0x0E, 0xF6, 0x03, 0x5D, 0xE0, 0x9E,
-    0x5C, 0x9B, 0xBD, 0x20, 0x6E, 0xBC, 0xAC, 0xAB, 0x20, 0x16, 0xD3, 0xF7, 0xA5, 0x78, 0x4A, 0x02,
-    0xB9, 0xDF, 0xC2, 0xAF, 0xFA, 0x0F, 0xD1, 0x25, 0xC0, 0x1A, 0xB2, 0x8F, 0x53, 0x47, 0x27, 0x90,
-    0xDC, 0x8F, 0x62, 0x69, 0xDE, 0x06, 0x26, 0x6A, 0xC4, 0xFD, 0x5D, 0x31, 0x25, 0x81, 0xC0, 0xB8,
-    0x52, 0x0D, 0x38, 0xEF, 0x57, 0x00, 0xD3, 0x60, 0x4B, 0x37, 0xF5, 0xB6, 0xC2, 0x82, 0x46, 0xE1,
-    0xAF, 0x68, 0x2A, 0x49, 0x4A, 0x9A, 0x8D, 0x54, 0x29, 0x88, 0xC1, 0x12, 0xA2, 0x39, 0x63, 0xAE,
-    0x9A, 0x3B, 0x35, 0x7D, 0x5E, 0xF7, 0x30, 0xE7, 0xB1, 0xAC, 0x7F, 0x16, 0x82, 0xF4, 0x2B, 0xF7,
-    0x21, 0x89, 0x52, 0xFD, 0xA4, 0x80, 0xF8, 0xD2, 0x6D, 0x96, 0x10, 0x01, 0x52, 0xC0, 0x61, 0xAD,
-    0x79, 0x2B, 0xC1, 0x67, 0x1C, 0x15, 0x21, 0xB9, 0x2D, 0xC2, 0x42, 0x91, 0x2D, 0xD2, 0xF5, 0x95,
-    0x54, 0x2B, 0x92, 0x5B, 0x0E, 0x05, 0xDD, 0x61, 0x54, 0x0A, 0xEE, 0x4F, 0x6A, 0x78, 0xB6, 0x47,
-    0xBD, 0xBA, 0x13, 0xDB, 0xAA, 0x4C, 0x3A, 0xD9, 0xF6, 0x99, 0x84, 0x20, 0xBD, 0xDC, 0x9C, 0xF4,
-    0x29, 0x9B, 0x2A, 0x3A, 0xC5, 0xD1, 0x7B, 0x13, 0x96, 0x1A, 0x89, 0xFE, 0xA9, 0x2F, 0x20, 0xF0,
-    0x42, 0xC8, 0x14, 0xC0, 0x38, 0x21, 0x30, 0xD6, 0x59, 0xBD, 0x4F, 0x60, 0xEC, 0x11, 0x18, 0x3B,
-    0xDB, 0x81, 0x71, 0x1E, 0x56, 0xE3, 0xAE, 0x1F, 0xB7, 0xFD, 0x74, 0xB8, 0x5D, 0x1E, 0x9D, 0xE7,
-    0xAF, 0xE9, 0x12, 0x62, 0xFF, 0x7B, 0x40, 0xDC, 0x36, 0x8C, 0xBD, 0xE6, 0x67, 0x7B, 0x62, 0x8C,
-    0xA0, 0x8B, 0xE1, 0x2F, 0xF3, 0x59, 0x73, 0xBA, 0x6B, 0xC9, 0xE9, 0xA0, 0xFC, 0x6E, 0x43, 0xEB,
-    0x43, 0xC5, 0x6A, 0x33, 0xA4, 0xB1, 0x46, 0x2D, 0xE7, 0x59, 0x08, 0x0F, 0x1A, 0x99, 0x94, 0xA9,
-    0x67, 0x3D, 0x1F, 0x6E, 0x7A, 0x53, 0xEC, 0x6F, 0x2B, 0x13, 0x46, 0xA3, 0xF8, 0x50, 0xF3, 0x31,
-    0x54, 0xC8, 0x20, 0x64, 0x6B, 0x84, 0xF4, 0x06, 0x77, 0x92, 0xC1, 0x12, 0x37, 0xD0, 0x1F, 0xAC,
-    0x37, 0x4C, 0x83, 0x34, 0x4C, 0xE7, 0x58, 0xFC, 0xD1, 0x72, 0xFA, 0xE4, 0x17, 0x96, 0x89, 0x0E,
-    0x58, 0xEC, 0xE6, 0x0A, 0x2E, 0x8E, 0xC3, 0x2F, 0x5C, 0xC0, 0x22, 0x89, 0xD8, 0xE2, 0x20, 0x0F,
-    0xFF, 0x9D, 0x89, 0xBB, 0xC5, 0x1A, 0x81, 0xD9, 0xE0, 0xFF, 0xB1, 0x80, 0x0C, 0x5A, 0x5B, 0x89,
-    0x3D, 0x55, 0x85, 0x17, 0x9B, 0x48, 0x6A, 0x6E, 0x77, 0x35, 0x7C, 0x11, 0x82, 0xB7, 0x27, 0xED,
-    0x31, 0xBB, 0x5D, 0x10, 0x64, 0x72, 0x6D, 0xF4, 0x7E, 0xED, 0xA9, 0x62, 0x62, 0xCA, 0xA5, 0x06,
-    0x0A, 0x52, 0xDF, 0x13, 0xBB, 0x38, 0x35, 0x13, 0x16, 0x75, 0x06, 0xEC, 0x8E, 0x19, 0xF0, 0xFE,
-    0x59, 0x9C, 0x16, 0x3B, 0x73, 0x62, 0xAC, 0x8D, 0xAB, 0x98, 0xED, 0xAD, 0xD2, 0x54, 0x60, 0x9F,
-    0x9D, 0xA1, 0x65, 0x1D, 0xB9, 0xFD, 0x1C, 0x10, 0xC8, 0xBE, 0x93, 0xDA, 0xC6, 0x39, 0xD9, 0x25,
-    0xA0, 0x4A, 0x43, 0x47, 0xC6, 0x64, 0xB1, 0x98, 0x85, 0x0A, 0xFD, 0xB8, 0x76, 0xFF, 0x59, 0x70,
-    0x13, 0x33, 0xDB, 0xF7, 0x2C, 0x67, 0xAC, 0x4E, 0x66, 0x77, 0x9E, 0x64, 0xB2, 0xEA, 0x57, 0xBE,
-    0xDC, 0x1D, 0x88, 0x67, 0xB0, 0xC3, 0x01, 0xC8, 0x52, 0xC7, 0x1A, 0x2C, 0xA3, 0x8C, 0x76, 0x93,
-    0x4E, 0x3D, 0x81, 0xBE, 0x7C, 0x25, 0xE3, 0xA5, 0x76, 0x2C, 0xB1, 0xBC, 0x41, 0x2C, 0x0C, 0x3D,
-    0x7B, 0xDF, 0x31, 0xE9, 0x9A, 0xDF, 0x88, 0x61, 0xC5, 0x4F, 0xFD, 0xBA, 0xCC, 0x72, 0x4A, 0x6E,
-    0xB1, 0x9C, 0x7B, 0x9A, 0x7E, 0x77, 0xF7, 0x06, 0x33, 0x14, 0x8D, 0x80, 0xFE, 0x9E, 0xBC, 0x51,
-    0x4B, 0x5D, 0x22, 0x22, 0x6C, 0x8A, 0xB0, 0x4B, 0x6E, 0x39, 0x8A, 0x50, 0xEE, 0x83, 0x2B, 0xFB,
-    0xCE, 0x93, 0xDB, 0x98, 0x64, 0x3E, 0xB3, 0x37, 0x57, 0xD7, 0xBF, 0xA3, 0x11, 0x11, 0xCF, 0xED,
-    0xA2, 0x52, 0x1C, 0xC0, 0x87, 0x3D, 0x5D, 0xA5, 0x9B, 0x2F, 0x98, 0x9C, 0x26, 0xA0, 0x42, 0xA6,
-    0x70, 0x3E, 0x41, 0xA7, 0x2F, 0x7B, 0xB7, 0x47, 0x1D, 0x22, 0x9C, 0x2E, 0xF5, 0x71, 0x52, 0x20,
-    0xC3, 0xF4, 0xF9, 0xE0, 0xB3, 0x13, 0x47, 0x93, 0xD6, 0x90, 0x53, 0xC0, 0x1F, 0xDC, 0x6F, 0x54,
-    0xEB, 0x7C, 0x15, 0x65, 0xCB, 0xC8, 0x74, 0xDB, 0x17, 0xB1, 0xCA, 0xD5, 0xF7, 0xB9, 0xD8, 0xFF,
-    0x81, 0x18, 0x56, 0x7A, 0x6B, 0x92, 0x29, 0x9C, 0x58, 0x94, 0xA4, 0x02, 0x43, 0x50, 0x12, 0x19,
-    0xF7, 0x7E, 0x94, 0xD4, 0xB8, 0xCF, 0xD5, 0x25, 0x27, 0xF5, 0x3D, 0xF4, 0xA2, 0xBE, 0x52, 0x5B,
-    0x07, 0xF2, 0xA8, 0x4D, 0x77, 0x7C, 0x5B, 0xE2, 0x48, 0x64, 0xD3, 0xF5, 0xE7, 0xAC, 0x9F, 0x95,
-    0x44, 0x73, 0x4C, 0x28, 0xFD, 0x3F, 0x15, 0x62, 0x5E, 0xCD, 0x1A, 0xDF, 0xCD, 0x3A, 0x1A, 0xD9,
-    0xB8, 0x68, 0xF5, 0x3B, 0x04, 0x12, 0xD1, 0xAC, 0xBD, 0x72, 0x16, 0x52, 0x72, 0x03, 0x50, 0x9B,
-    0xBA, 0xFB, 0x1A, 0xDF, 0xD6, 0xA0, 0x53, 0x71, 0x3E, 0x88, 0x87, 0x37, 0xC8, 0x8E, 0x42, 0x54,
-    0x2B, 0x1E, 0x37, 0x5B, 0x16, 0x16, 0x98, 0x7F, 0x9C, 0xE6, 0xC6, 0xF9, 0xCD, 0xD1, 0xFA, 0x66,
-    0x32, 0xAB, 0xD2, 0x26, 0x84, 0x9A, 0xED, 0xB0, 0x75, 0xE6, 0x5D, 0xCE, 0x8F, 0x70, 0x56, 0xFD,
-    0xCF, 0x30, 0x64, 0x78, 0x25, 0x37, 0x6F, 0x8B, 0xC9, 0xEA, 0xC2, 0xF4, 0xA5, 0x84, 0x77, 0x52,
-    0x75, 0xA0, 0xE2, 0xA5, 0x35, 0x32, 0xC4, 0x1D, 0x04, 0x4F, 0xF6, 0x4B, 0x7C, 0x56, 0xA9, 0x7D,
-    0x6E, 0xF7, 0x21, 0xBE, 0x66, 0xEB, 0xED, 0x28, 0xC7, 0xAD, 0xB1, 0xCA, 0x62, 0xD0, 0xA8, 0x3E,
-    0xD2, 0xA6, 0x81, 0x1C, 0x78, 0x5A, 0x22, 0x70, 0x23, 0x54, 0x16, 0x26, 0xF5, 0xEA, 0xAD, 0x6F,
-    0x18, 0x6E, 0x51, 0xA4, 0x11, 0xD6, 0x0C, 0x2E, 0xEE, 0xC3, 0xD2, 0xD8, 0xEB, 0xEA, 0xE6, 0x75,
-    0x15, 0xBF, 0x02, 0x24, 0x90, 0xF4, 0x72, 0x41, 0x96, 0xD6, 0x7C, 0xC4, 0x67, 0xC0, 0x5C, 0x44,
-    0x8B, 0x0C, 0x2A, 0xE1, 0xC6, 0x70, 0xEA, 0x6B, 0xDC, 0x9A, 0x9F, 0xD2, 0x60, 0xB4, 0x38, 0x23,
-    0x56, 0xEF, 0x7C, 0x5E, 0x62, 0x58, 0xE5, 0xBC, 0x5B, 0xF1, 0x9F, 0xF7, 0x5A, 0x8D, 0x90, 0x98,
-    0x5D, 0x71, 0xDA, 0x1B, 0xD0, 0xE9, 0xBB, 0x4E, 0x7B, 0x17, 0x96, 0xF8, 0x2F, 0xAB, 0xAB, 0x74,
-    0x2D, 0x90, 0x6E, 0x2E, 0x68, 0x81, 0x1E, 0xC0, 0x6F, 0xA3, 0x77, 0x95, 0x21, 0x0A, 0xF3, 0x1E,
-    0xB7, 0x92, 0x70, 0x33, 0x09, 0xF4, 0xF4, 0x26, 0x57, 0xA0, 0xAD, 0x49, 0x4F, 0xF8, 0xE4, 0x05,
-    0x41, 0x4C, 0xF9, 0x35, 0x89, 0x4F, 0x2C, 0x46, 0xEA, 0x52, 0x99, 0xD4, 0x5E, 0xE3, 0x54, 0x5E,
-    0xEE, 0x34, 0x6E, 0xED, 0xC5, 0x84, 0xC9, 0x1E, 0xF4, 0xEF, 0xB7, 0x73, 0xB0, 0xC3, 0x93, 0xDD,
-    0x49, 0x24, 0x47, 0xA7, 0x7B, 0x18, 0x46, 0x76, 0x2E, 0x63, 0x90, 0xBE, 0x11, 0xDD, 0x20, 0xDE,
-    0x21, 0xE2, 0x89, 0xCA, 0x50, 0x17, 0xC9, 0x89, 0xAC, 0xFC, 0xDC, 0x1F, 0x91, 0x2F, 0xEB, 0x95,
-    0xDC, 0x9F, 0x40, 0x2A, 0xCF, 0x8D, 0xC1, 0xE5, 0xB1, 0xAA, 0xA7, 0xD4, 0x65, 0x20, 0xEE, 0xDE,
-    0xCA, 0x52, 0xE8, 0xE3, 0x02, 0x99, 0x5B, 0xE0, 0x64, 0xAF, 0x72, 0x77, 0x83, 0xC8, 0x9B, 0xEF,
-    0x57, 0x26, 0xEF, 0x10, 0x7F, 0xFF, 0x9D, 0x15, 0x80, 0x6F, 0xC4, 0xBC, 0x8A, 0x69, 0xFA, 0xE3,
-    0x6B, 0xA2, 0x5B, 0x09, 0xCF, 0x5D, 0xE7, 0x3B, 0x5E, 0x6A, 0x5C, 0xE1, 0x04, 0x59, 0x8C, 0x6F,
-    0x80, 0xB3, 0x4E, 0x6E, 0xE0, 0xEC, 0xB5, 0xAB, 0x27, 0x16, 0x55, 0x1B, 0xD5, 0x61, 0xE5, 0xE6,
-    0x7E, 0xE9, 0xA6, 0x98, 0x76, 0x44, 0x43, 0xAA, 0xFE, 0x24, 0x24, 0x84, 0x4C, 0x3D, 0x75, 0x7C,
-    0xC3, 0x3C, 0x17, 0x95, 0x06, 0xC3, 0x51, 0x0E, 0x3F, 0x9D, 0xBC, 0x93, 0x43, 0x10, 0x1F, 0xC1,
-    0x43, 0xBC, 0x4A, 0x57, 0x71, 0x86, 0xB9, 0x4A, 0xC4, 0x3B, 0x34, 0x39, 0x66, 0xC9, 0x91, 0x88,
-    0x66, 0xF5, 0xA6, 0x42, 0xEB, 0xE1, 0xF7, 0xA9, 0xD1, 0xCC, 0x54, 0x95, 0xAC, 0x64, 0xD5, 0x4D,
-    0x24, 0xBA, 0xCB, 0xC0, 0xB2, 0x37, 0x60, 0x2C, 0x2F, 0xF0, 0xDD, 0x0A, 0xAF, 0x35, 0xDE, 0x8B,
-    0xE2, 0x70, 0x61, 0xE8, 0x42, 0x83, 0xE9, 0x15, 0xBC, 0x2D, 0x63, 0xC6, 0x96, 0xB1, 0x50, 0x1A,
-    0xB5, 0xFE, 0x51, 0x0D, 0xB4, 0x62, 0x70, 0xA6, 0xDE, 0xBA, 0xAA, 0x8C, 0xD8, 0x67, 0x4C, 0xFF,
-    0xC7, 0xAF, 0x5D, 0x63, 0x52, 0x2D, 0x67, 0x7F, 0xD9, 0xCB, 0x02, 0xAE, 0xBF, 0xAC, 0xF7, 0x43,
-    0x4A, 0x53, 0x90, 0x53, 0xC6, 0x45, 0x3B, 0x8D, 0x8D, 0xA1, 0x9C, 0x38, 0x2C, 0xBC, 0x38, 0x5A,
-    0xCF, 0xE2, 0x4C, 0x0D, 0x95, 0x27, 0x96, 0xA5, 0x82, 0xA1, 0x3C, 0x65, 0xCD, 0x80, 0xDF, 0x70,
-    0x78, 0xDB, 0x92, 0xFF, 0x8F, 0x1F, 0x9E, 0x5F, 0x0D, 0xE3, 0xB9, 0xC9, 0xB5, 0x05, 0xC6, 0x4F,
-    0x93, 0x5F, 0x27, 0x5F, 0x10, 0x6B, 0x03, 0x87, 0x59, 0x39, 0x96, 0x35, 0x0F, 0xC5, 0x6F, 0xD2,
-    0xDA, 0xDD, 0x7D, 0xA7, 0x3E, 0xEF, 0xD6, 0x2C, 0x23, 0x3C, 0xCB, 0x06, 0xC8, 0xF5, 0x2E, 0xC6,
-    0x62, 0xFA, 0x3F, 0xD5, 0x5A, 0xB1, 0x93, 0xD5, 0xE6, 0x11, 0x5F, 0x3D, 0x71, 0x68, 0x6C, 0xCD,
-    0x9C, 0x9C, 0x19, 0xDF, 0x24, 0x9E, 0x33, 0xE8, 0x1F, 0x00, 0x2B, 0x25, 0x05, 0x20, 0x5D, 0x52,
-    0xB8, 0x70, 0xE1, 0x2B, 0x20, 0x2E, 0x52, 0x40, 0xE1, 0x26, 0x6E, 0xAE, 0x71, 0x66, 0xC8, 0xCC,
-    0x81, 0x64, 0x3B, 0x33, 0x2E, 0x52, 0xE4, 0x9A, 0xB8, 0x49, 0xE1, 0x14, 0x29, 0xE2, 0xE7, 0xC2,
-    0x57, 0x50, 0x5C, 0x01, 0x48, 0x40, 0xE1, 0x22, 0x85, 0x85, 0x5D, 0xB8, 0x48, 0xF3, 0x26, 0x60,
-    0x0A, 0x32, 0x89, 0x45, 0x22, 0xC6, 0x0F, 0x23, 0xE9, 0xCB, 0xEF, 0xB7, 0x9F, 0x74, 0xF7, 0x0E,
-    0x0E, 0x8C, 0x0D, 0x77, 0x24, 0x77, 0x4F, 0xBB, 0x7A, 0xEF, 0x49, 0xFA, 0x76, 0xF7, 0xDB, 0x6F,
-    0xF7, 0xB7, 0xFB, 0x3D, 0x91, 0xE1, 0xEF, 0x9C, 0x48, 0x64, 0x92, 0x54, 0x46, 0xDD, 0x27, 0x55,
-    0x2C, 0x7E, 0x3D, 0x6A, 0x02, 0x09, 0x27, 0x62, 0x0E, 0x4B, 0x5C, 0x48, 0x5A, 0x93, 0xF2, 0x24,
-    0x23, 0xCD, 0x37, 0x69, 0x39, 0x43, 0x87, 0x6F, 0x37, 0x5F, 0x69, 0xA2, 0x4F, 0x10, 0xF1, 0x2B,
-    0xA7, 0x15, 0x3C, 0xF9, 0x97, 0x35, 0x06, 0x5A, 0x31, 0x99, 0x6C, 0xFD, 0xBD, 0x89, 0xA3, 0x95,
-    0xB7, 0xB2, 0xCE, 0x37, 0xD3, 0xE3, 0x51, 0x61, 0x0E, 0xC5, 0x59, 0x5C, 0xA7, 0x49, 0x5C, 0xE4,
-    0x78, 0x82, 0x91, 0xA8, 0x3F, 0xEC, 0x7B, 0x7C, 0x9E, 0x81, 0x4A, 0x70, 0xB3, 0x95, 0x91, 0xA9,
-    0x65, 0xFB, 0x5F, 0x98, 0xE5, 0xA6, 0x30, 0x61, 0x71, 0xAA, 0x4B, 0x56, 0x82, 0xC2, 0x6B, 0x24,
-    0x70, 0x0B, 0x6F, 0x2A, 0x81, 0x9F, 0x90, 0x5E, 0x14, 0xD2, 0x35, 0xA5, 0xF2, 0x1D, 0xD4, 0xB5,
-    0xB4, 0xE9, 0xE9, 0x3C, 0x65, 0x97, 0x63, 0x18, 0xC2, 0xDC, 0x9A, 0x72, 0x20, 0x53, 0xCA, 0x7D,
-    0x2A, 0x48, 0xB3, 0xB0, 0xBC, 0xB0, 0xDC, 0xA6, 0x55, 0x5A, 0xAD, 0x06, 0x55, 0x50, 0x1D, 0xF5,
-    0x2B, 0xFF, 0xF6, 0x3A, 0x88, 0xC9, 0x40, 0x2A, 0xD9, 0x91, 0xD4, 0x41, 0x25, 0x5E, 0x13, 0x56,
-    0xE2, 0x9A, 0x7B, 0x77, 0xF1, 0xF0, 0x2F, 0x8C, 0xEC, 0xF0, 0xE7, 0x54, 0x61, 0x7F, 0x76, 0xF6,
-    0x6C, 0x7F, 0x12, 0x0D, 0xAA, 0x07, 0x93, 0xAD, 0xEB, 0x52, 0xD3, 0x25, 0x12, 0x1B, 0x53, 0x85,
-    0x5D, 0x8E, 0xE9, 0x1A, 0xE7, 0x95, 0xDB, 0x40, 0xEC, 0xA3, 0x12, 0x4F, 0xA0, 0x43, 0x9E, 0x9C,
-    0x91, 0xBC, 0xC0, 0x49, 0x5C, 0x9C, 0x11, 0x93, 0xF0, 0xA4, 0x7C, 0xC1, 0xED, 0xA8, 0x5E, 0x34,
-    0x81, 0x14, 0x3C, 0xC1, 0x64, 0x05, 0xB5, 0x9E, 0x54, 0xFC, 0xD0, 0x9E, 0xA4, 0x45, 0x7F, 0x0D,
-    0xA6, 0x8D, 0x27, 0xE5, 0xC8, 0xA8, 0x51, 0xE2, 0xC2, 0x6D, 0xF5, 0x24, 0x2D, 0x82, 0xA9, 0x1C,
-    0xC1, 0x89, 0x49, 0x70, 0xF9, 0x19, 0x0C, 0xDA, 0xD2, 0x23, 0x36, 0x16, 0xBB, 0x4F, 0x6A, 0xC9,
-    0x6F, 0x7D, 0x3C, 0x55, 0xC1, 0x8C, 0x31, 0xD3, 0x6D, 0x6A, 0x05, 0x49, 0xA5, 0x5F, 0x78, 0x5F,
-    0x96, 0x2A, 0xB0, 0x63, 0x32, 0x95, 0x57, 0x72, 0x51, 0x71, 0xA5, 0x1F, 0x65, 0xE1, 0xE4, 0x09,
-    0x15, 0x36, 0x35, 0xAD, 0xCA, 0x71, 0xF1, 0x8D, 0x46, 0x45, 0x5D, 0x0F, 0x2A, 0x15, 0xF0, 0x74,
-    0x54, 0x5A, 0x41, 0xE3, 0xAC, 0x97, 0xB3, 0x17, 0xB3, 0xB5, 0xF7, 0x63, 0x46, 0xAD, 0x90, 0xD5,
-    0x9C, 0xCA, 0x18, 0x15, 0xF3, 0x2A, 0x62, 0x9A, 0x1D, 0x54, 0x09, 0xCD, 0xB8, 0xA3, 0x1C, 0x8E,
-    0x31, 0xDD, 0x20, 0x9A, 0x67, 0xB2, 0x40, 0x2A, 0x4A, 0x04, 0xE1, 0x04, 0x0F, 0x1E, 0xD1, 0x65,
-    0xE3, 0x4C, 0x78, 0x45, 0x4C, 0xEF, 0x75, 0xFE, 0x12, 0x67, 0x10, 0x2C, 0x30, 0x69, 0x06, 0xB9,
-    0xE2, 0x6B, 0x26, 0x83, 0x58, 0x69, 0x96, 0x67, 0x90, 0x2A, 0xC7, 0xA3, 0x4F, 0x87, 0x65, 0xCE,
-    0x2B, 0xE3, 0xCC, 0x90, 0x19, 0x21, 0xC3, 0xA0, 0x64, 0x10, 0x88, 0xDF, 0x41, 0x9E, 0x34, 0x49,
-    0xB3, 0xA8, 0x9C, 0x87, 0x9F, 0x17, 0x90, 0x26, 0xBA, 0xF7, 0xF5, 0x0D, 0x08, 0xE3, 0x77, 0x61,
-    0xBB, 0x25, 0x4B, 0x0A, 0x57, 0x8B, 0xCD, 0x24, 0x84, 0xA1, 0x16, 0xCD, 0x1A, 0x14, 0x10, 0xAB,
-    0xD7, 0x13, 0xB2, 0xE7, 0x2C, 0x9B, 0xB7, 0xEC, 0x80, 0x65, 0x87, 0xC1, 0x16, 0xBB, 0x71, 0x4B,
-    0xE3, 0x18, 0x43, 0xC6, 0xBF, 0xED, 0x8C, 0x8F, 0xC0, 0x9F, 0x6F, 0x1D, 0x30, 0xB5, 0xEE, 0xD7,
-    0xCD, 0xCE, 0xAB, 0x5B, 0x53, 0x66, 0xB8, 0x35, 0x44, 0x76, 0x6B, 0xBD, 0x3E, 0xB1, 0x77, 0x91,
-    0x2E, 0x70, 0x32, 0x25, 0x9E, 0x92, 0xFA, 0x4A, 0xDD, 0x47, 0xD1, 0xE7, 0x94, 0xCE, 0x2B, 0x3D,
-    0xA0, 0xF4, 0xB0, 0x3B, 0xA5, 0x8C, 0xEE, 0x94, 0x22, 0xBA, 0xEA, 0x52, 0x96, 0x7A, 0x96, 0xAA,
-    0x60, 0x58, 0x57, 0xF8, 0xCB, 0x8B, 0x2D, 0xE1, 0x72, 0xC4, 0xB3, 0x10, 0xD2, 0x30, 0xAE, 0x41,
-    0xF8, 0x65, 0x2A, 0xE0, 0xD7, 0x0B, 0x27, 0xFC, 0x3A, 0xC2, 0xFB, 0xE1, 0xF3, 0x47, 0x1F, 0x61,
-    0x3B, 0x6A, 0x72, 0xF3, 0x33, 0x1A, 0xB1, 0xB1, 0xDA, 0xF0, 0xE0, 0x88, 0x2B, 0xB0, 0xC3, 0xA5,
-    0x84, 0x41, 0xB2, 0x4D, 0x4D, 0xB1, 0xD8, 0xC8, 0x62, 0x8D, 0x20, 0xE4, 0xC2, 0x13, 0x19, 0x86,
-    0x5C, 0x78, 0x36, 0x57, 0x9E, 0x6B, 0x4A, 0xCB, 0x3F, 0xAB, 0x2C, 0xFF, 0xB4, 0xB1, 0xFC, 0x6A,
-    0x6B, 0x79, 0x61, 0x7A, 0x9E, 0x5E, 0xB5, 0x3C, 0xBA, 0x6E, 0x79, 0xF0, 0x8D, 0xE5, 0xAE, 0xB1,
-    0x7C, 0xD4, 0x73, 0x19, 0x78, 0x4C, 0xBE, 0x78, 0x43, 0x42, 0xF2, 0xB4, 0x11, 0xBF, 0xE8, 0x27,
-    0xAA, 0x37, 0xCE, 0x60, 0x9E, 0xCD, 0x99, 0xEB, 0x4D, 0x24, 0x8E, 0x35, 0x92, 0xB8, 0x77, 0xB7,
-    0x07, 0x9D, 0xA0, 0x52, 0x6D, 0x82, 0x4A, 0x95, 0xC1, 0x52, 0xA3, 0x2E, 0x4E, 0xA2, 0xAA, 0x88,
-    0xD5, 0xE4, 0xE4, 0xB2, 0x2A, 0x62, 0x2A, 0xD5, 0x03, 0x97, 0x50, 0x8D, 0xA0, 0x52, 0x2D, 0xC8,
-    0xA0, 0x04, 0x19, 0x74, 0x20, 0x83, 0x0A, 0x64, 0xD0, 0x80, 0x6C, 0x64, 0x99, 0xF4, 0x2C, 0x06,
-    0x53, 0xE9, 0x31, 0x2C, 0x85, 0xEF, 0x85, 0xBB, 0x8F, 0x59, 0x67, 0x8B, 0x34, 0xF6, 0x3A, 0x26,
-    0x99, 0xD5, 0x6E, 0xC6, 0x37, 0x67, 0xA9, 0x2C, 0xDB, 0x6F, 0x16, 0x96, 0xDF, 0x82, 0xE7, 0xA5,
-    0xFF, 0x31, 0x65, 0xDC, 0x04, 0xDD, 0x0A, 0x02, 0x87, 0xDF, 0x30, 0x7C, 0xF8, 0x53, 0x3B, 0xF7,
-    0x8F, 0x4B, 0xC3, 0xD6, 0x47, 0x10, 0xCA, 0x8D, 0x6F, 0x1E, 0x1C, 0xCB, 0x8A, 0xE2, 0xAB, 0xAC,
-    0x69, 0x39, 0xBB, 0x2C, 0x5E, 0x19, 0x41, 0xF2, 0xE0, 0xF7, 0x6A, 0x37, 0x8A, 0xDE, 0x6E, 0x46,
-    0x76, 0x9E, 0x31, 0x9C, 0xDA, 0x2F, 0x3C, 0x06, 0xBD, 0x00, 0x79, 0x53, 0xE6, 0x23, 0x90, 0xC3,
-    0x08, 0xC7, 0x72, 0x94, 0xCA, 0x9F, 0xE1, 0x53, 0xCF, 0x73, 0x06, 0xEF, 0xBC, 0xD1, 0x40, 0x75,
-    0x83, 0xEC, 0x57, 0x3A, 0x9D, 0x3A, 0x80, 0x78, 0x19, 0x82, 0x65, 0x90, 0x20, 0xC2, 0xAD, 0x94,
-    0x8E, 0xB9, 0x61, 0xA6, 0x9E, 0x51, 0x79, 0xFC, 0x6C, 0x43, 0xDC, 0xEB, 0xB8, 0xD1, 0xE0, 0x59,
-    0x69, 0x62, 0x07, 0x1C, 0x67, 0x48, 0x5E, 0x53, 0x89, 0xAF, 0x20, 0x42, 0x2E, 0xB5, 0x32, 0xA7,
-    0x32, 0x76, 0xB2, 0x1F, 0xF1, 0x26, 0xBE, 0xD9, 0xE1, 0x41, 0x1D, 0x9E, 0x88, 0x03, 0x0F, 0xCF,
-    0x91, 0x1C, 0xD2, 0x7F, 0x21, 0xA6, 0x4F, 0x7B, 0x17, 0x81, 0x30, 0x6E, 0x11, 0x9E, 0x4A, 0xFC,
-    0x4E, 0xFD, 0x5F, 0x63, 0x53, 0xA8, 0x99, 0xE4, 0x31, 0x5F, 0x8B, 0x5D, 0x92, 0x6A, 0xE6, 0x5C,
-    0xF5, 0x8A, 0x30, 0x14, 0xBF, 0xED, 0x6D, 0x36, 0x77, 0x42, 0x22, 0x9C, 0xB7, 0x8C, 0x31, 0x0F,
-    0x7B, 0x79, 0x08, 0xDC, 0x43, 0xD6, 0xC5, 0xED, 0xC8, 0xC1, 0x4C, 0x8A, 0x7E, 0xBB, 0xCD, 0x07,
-    0x80, 0x5F, 0x14, 0xBE, 0x28, 0x7A, 0xB1, 0xD0, 0x43, 0x51, 0x88, 0xA2, 0x11, 0xC5, 0x26, 0xF9,
-    0x40, 0xCA, 0x4D, 0x62, 0xBF, 0xD0, 0x4B, 0xF4, 0x62, 0xBD, 0x4D, 0x01, 0x8B, 0xC5, 0x2B, 0xDB,
-    0xE0, 0x8A, 0x9F, 0xAD, 0xCA, 0xE8, 0xDF, 0xBD, 0x51, 0x63, 0x6B, 0x54, 0x80, 0x17, 0x01, 0x78,
-    0xB1, 0x30, 0x25, 0x8B, 0x93, 0x47, 0x82, 0x97, 0x6C, 0x27, 0xF0, 0x82, 0x54, 0x28, 0xA2, 0xA9,
-    0xC6, 0xD1, 0xC1, 0xF2, 0xFE, 0x73, 0xC2, 0x99, 0x7A, 0x05, 0x56, 0x2B, 0x09, 0x66, 0x2C, 0x36,
-    0x79, 0x5C, 0xA2, 0x10, 0x46, 0x11, 0x0C, 0xC8, 0xC1, 0x1E, 0xBF, 0x28, 0x7C, 0xD9, 0x8E, 0x5E,
-    0x2C, 0xBA, 0xB8, 0xB0, 0x3A, 0xA0, 0x8A, 0x4D, 0x44, 0x41, 0x3C, 0x23, 0xC4, 0x33, 0x42, 0x3C,
-    0x23, 0x0F, 0x47, 0x31, 0x8F, 0x81, 0x67, 0xE6, 0x4E, 0x62, 0x21, 0xFA, 0x66, 0xD2, 0x9F, 0xED,
-    0x77, 0xD6, 0x30, 0xD0, 0xD5, 0xAA, 0x27, 0x8E, 0x24, 0x7B, 0xA3, 0xEF, 0xC2, 0x09, 0x0E, 0x42,
-    0x97, 0x7F, 0xEB, 0x23, 0x90, 0x17, 0xF6, 0x11, 0xB7, 0xC5, 0x03, 0x39, 0xFD, 0xDC, 0x2E, 0x68,
-    0x2E, 0x0E, 0x43, 0x90, 0xC7, 0xA8, 0x10, 0x70, 0x6A, 0x0F, 0xCB, 0xB3, 0x53, 0x5F, 0x16, 0x74,
-    0xD5, 0x2A, 0x5A, 0x65, 0xE0, 0xE1, 0x4C, 0xFF, 0x68, 0x0F, 0x6C, 0x30, 0xC7, 0x30, 0xEC, 0x5D,
-    0x2D, 0x19, 0xEB, 0xA8, 0xAA, 0x06, 0x41, 0x2A, 0xBD, 0x65, 0x83, 0xFD, 0xB2, 0xB6, 0x37, 0x36,
-    0x58, 0x9E, 0x03, 0xD9, 0x20, 0x94, 0x8F, 0xA6, 0x43, 0x6A, 0x51, 0x3F, 0x98, 0x6E, 0xDA, 0xE0,
-    0xCD, 0x97, 0x76, 0xC1, 0x06, 0x0B, 0x54, 0x3C, 0xA0, 0x14, 0xAE, 0x66, 0x88, 0x8D, 0x67, 0xE8,
-    0x07, 0x5C, 0x05, 0xA2, 0x49, 0x28, 0xD6, 0x98, 0x96, 0xEC, 0xCD, 0x5A, 0x18, 0x8D, 0x19, 0xA1,
-    0x27, 0x72, 0xCC, 0x6F, 0xE4, 0xA7, 0x0A, 0x27, 0xBB, 0xDE, 0x19, 0x0C, 0xAB, 0x03, 0x00, 0x71,
-    0xA3, 0x40, 0x39, 0xC7, 0xE7, 0xE9, 0x12, 0x12, 0xD4, 0xDF, 0x6A, 0x84, 0xFD, 0x72, 0x88, 0x20,
-    0xF4, 0x17, 0xBE, 0xD3, 0xB3, 0xE7, 0x1D, 0x2C, 0xA6, 0xF0, 0x3D, 0x78, 0x70, 0xF8, 0x73, 0x46,
-    0x15, 0x27, 0xD9, 0xED, 0x94, 0xEA, 0x20, 0x70, 0xB9, 0xA6, 0x82, 0x16, 0x7F, 0x12, 0x27, 0x59,
-    0x16, 0xFF, 0x72, 0x2D, 0xFE, 0xB5, 0x5A, 0x46, 0xC9, 0xDA, 0x93, 0xA7, 0xD6, 0x5E, 0xBB, 0xA2,
-    0x3F, 0x93, 0x17, 0x86, 0x35, 0x6A, 0xB1, 0xC2, 0x86, 0xEC, 0x85, 0x76, 0x5E, 0xAF, 0x9D, 0xEC,
-    0xEB, 0xA3, 0x04, 0x9F, 0x7E, 0x5C, 0x9E, 0x06, 0x70, 0x18, 0xF2, 0x59, 0x8F, 0xC5, 0xDB, 0x99,
-    0xCF, 0x30, 0xF3, 0x8D, 0xFA, 0xFC, 0x98, 0xEC, 0x58, 0x8B, 0x7A, 0x55, 0xE4, 0xD7, 0xAD, 0x1C,
-    0x02, 0xBB, 0xDD, 0xCA, 0xCB, 0xD0, 0xF7, 0x9A, 0x5E, 0xEF, 0x5E, 0x56, 0xE6, 0x2F, 0xE9, 0x43,
-    0x02, 0x28, 0x05, 0x67, 0x38, 0xE4, 0x74, 0x34, 0xD8, 0x51, 0x5B, 0x9D, 0x50, 0x4F, 0xC8, 0xFA,
-    0xD5, 0x2F, 0x14, 0x16, 0x14, 0xB0, 0xD6, 0x7E, 0x68, 0x0B, 0x16, 0x20, 0xC5, 0x8E, 0xC8, 0xD2,
-    0xF2, 0xC7, 0x66, 0x9C, 0x8B, 0xA9, 0x63, 0x7A, 0x5C, 0x0F, 0x1B, 0x99, 0x8B, 0xDD, 0x21, 0x21,
-    0x3B, 0xE3, 0x64, 0x9C, 0x84, 0xE6, 0x9E, 0xA9, 0xE2, 0x77, 0xCD, 0x7B, 0x4D, 0xB4, 0x64, 0x9C,
-    0x76, 0x4E, 0x75, 0xA3, 0x7A, 0xFB, 0x71, 0x9B, 0x89, 0x6F, 0x9A, 0xF1, 0x47, 0xD4, 0x58, 0xDD,
-    0x15, 0x3A, 0x1B, 0xD9, 0x97, 0x03, 0xD8, 0x1E, 0x48, 0xBF, 0xFE, 0xF0, 0x5B, 0x60, 0x44, 0xCF,
-    0xCC, 0x54, 0xE5, 0x28, 0xDB, 0xF0, 0xCE, 0x7C, 0xDC, 0x72, 0x7D, 0x1A, 0x06, 0x9C, 0x94, 0x10,
-    0xF6, 0x0C, 0x91, 0x89, 0xB0, 0xB8, 0x16, 0xF6, 0x4E, 0x36, 0xC9, 0xF3, 0xE3, 0xB5, 0x3C, 0xF3,
-    0x51, 0x0F, 0x16, 0x0E, 0x71, 0xC3, 0x82, 0x49, 0x80, 0x52, 0x50, 0xFF, 0x55, 0x78, 0xEB, 0xF3,
-    0x01, 0x8E, 0xF9, 0xA0, 0xE3, 0x3A, 0xBA, 0xB1, 0xE9, 0x13, 0x89, 0x8C, 0x5F, 0xAF, 0x7C, 0xD3,
-    0x55, 0x61, 0xD1, 0x24, 0x51, 0x86, 0x09, 0xC9, 0x2E, 0xE9, 0x11, 0x15, 0x50, 0xF9, 0xF3, 0x06,
-    0x0E, 0x83, 0x02, 0xFF, 0xB7, 0xC2, 0x66, 0x86, 0x84, 0xB7, 0xFE, 0x0C, 0x47, 0x83, 0x13, 0x18,
-    0x53, 0xC4, 0x7F, 0x48, 0x8B, 0x66, 0xEE, 0x54, 0xD9, 0x04, 0xA6, 0x6E, 0x25, 0x4A, 0xE2, 0x71,
-    0x67, 0x93, 0xF4, 0x0C, 0x6A, 0xFD, 0xDD, 0x83, 0xA8, 0xF5, 0xFB, 0x29, 0x04, 0x87, 0xCE, 0x33,
-    0xC4, 0x9E, 0x14, 0x98, 0x9F, 0x97, 0x18, 0xF6, 0x06, 0x0C, 0xEB, 0xF5, 0x87, 0x29, 0xB4, 0x13,
-    0x74, 0xFD, 0x41, 0x4A, 0x26, 0x9B, 0x4A, 0x4A, 0xA0, 0x87, 0x2A, 0x79, 0x8B, 0x5E, 0xBB, 0x36,
-    0xB4, 0x8C, 0x1C, 0x8C, 0xE2, 0xFF, 0x55, 0x95, 0x4C, 0x66, 0x20, 0x7B, 0x8A, 0xA8, 0x35, 0x59,
-    0xEC, 0x7E, 0xA6, 0x25, 0xB7, 0x16, 0xC7, 0x08, 0x67, 0x8D, 0x5B, 0x82, 0x60, 0xE5, 0xB8, 0xCD,
-    0x31, 0xA2, 0xFE, 0x0B, 0x20, 0x5D, 0xC7, 0x5B, 0xD9, 0x11, 0x69, 0x73, 0x36, 0x4A, 0x62, 0x5E,
-    0xC2, 0xD8, 0xD7, 0x04, 0xEC, 0x3B, 0x78, 0xBC, 0x17, 0x8A, 0x03, 0xFA, 0xC2, 0x04, 0xA6, 0xEC,
-    0x1B, 0x37, 0xB5, 0x9F, 0xC9, 0x71, 0x2C, 0xAD, 0xA0, 0xE9, 0xB1, 0x01, 0x0B, 0x54, 0x48, 0x53,
-    0xDB, 0xFA, 0x6C, 0xEB, 0x60, 0x81, 0x9A, 0xA2, 0xF8, 0x08, 0x4A, 0x14, 0xAA, 0x78, 0xBF, 0x2A,
-    0xFE, 0x1D, 0xC4, 0x9D, 0x6F, 0xA6, 0x98, 0xA8, 0x16, 0xF0, 0x17, 0x36, 0xAC, 0xE1, 0x2F, 0x75,
-    0x8C, 0xEF, 0xC3, 0x8A, 0xE5, 0x49, 0x6E, 0x96, 0xCC, 0x6E, 0xA3, 0x61, 0x45, 0x0E, 0x7E, 0xA6,
-    0xC8, 0x75, 0x00, 0x36, 0x41, 0x37, 0x34, 0x09, 0x7E, 0x28, 0x1C, 0x66, 0x52, 0xAE, 0x09, 0x48,
-    0xF1, 0x1C, 0xA6, 0x43, 0x9D, 0xFC, 0x21, 0x82, 0xC4, 0x9C, 0x9E, 0xD8, 0x24, 0xF2, 0x6C, 0x75,
-    0xEB, 0xC3, 0x05, 0x13, 0xC1, 0x13, 0x41, 0xFF, 0x47, 0xE8, 0xAA, 0x80, 0xFC, 0x02, 0x7C, 0x2B,
-    0xAE, 0x37, 0xD1, 0xB8, 0x8F, 0x60, 0x17, 0xD8, 0xA3, 0x08, 0x24, 0x94, 0x79, 0x59, 0xB5, 0x37,
-    0xB3, 0x18, 0xA7, 0x9C, 0x11, 0x24, 0x9C, 0xCB, 0x4B, 0x0B, 0x68, 0xFC, 0x7A, 0x0E, 0x6B, 0xF3,
-    0xB8, 0x78, 0x35, 0xFB, 0xB8, 0xEC, 0x34, 0x85, 0x5F, 0xE5, 0x85, 0xC7, 0xE0, 0x38, 0xD7, 0x37,
-    0x03, 0x8A, 0x55, 0x71, 0x6E, 0xE3, 0xD2, 0xBC, 0xEC, 0x1B, 0x5A, 0xCC, 0x3C, 0x27, 0x11, 0xE2,
-    0x11, 0xB6, 0x71, 0x1C, 0x3C, 0x79, 0x0E, 0x01, 0x78, 0x43, 0x5E, 0xA4, 0x35, 0xB4, 0xDA, 0x62,
-    0x83, 0x18, 0xE3, 0xE4, 0xD3, 0x3E, 0xFF, 0x30, 0x37, 0x70, 0xC1, 0xDB, 0xE3, 0x27, 0x38, 0xCE,
-    0xA2, 0x1E, 0x3A, 0xC7, 0xCE, 0xD6, 0x97, 0x0D, 0xA2, 0xCB, 0x5A, 0x5F, 0xA8, 0xB1, 0x5E, 0xFC,
-    0x3E, 0x75, 0xDE, 0xD6, 0x4B, 0x4B, 0x46, 0x84, 0x98, 0x95, 0x4A, 0x2E, 0x25, 0xFF, 0x07, 0xCD,
-    0x4D, 0x3D, 0x61, 0x48, 0xA1, 0x80, 0xDA, 0x15, 0x18, 0x75, 0x7D, 0x77, 0xE0, 0xD9, 0x34, 0x33,
-    0x3D, 0x5B, 0xB8, 0x3A, 0x7D, 0xFD, 0x1A, 0x3F, 0xC8, 0xF6, 0xAC, 0x8B, 0x39, 0x2C, 0xE2, 0xA2,
-    0x2F, 0x6E, 0x1D, 0xFA, 0x83, 0x5B, 0xEE, 0x5D, 0x46, 0xD1, 0x70, 0x4A, 0xF8, 0x4D, 0x70, 0x7B,
-    0x46, 0x76, 0x25, 0xA3, 0xA4, 0xE6, 0x73, 0x55, 0x78, 0xB1, 0x5B, 0xCA, 0xEF, 0xDA, 0x09, 0x8F,
-    0x26, 0x3D, 0x2F, 0x1F, 0x87, 0xC3, 0x8B, 0xAE, 0x61, 0x0C, 0xB7, 0x3D, 0xB9, 0x52, 0x9E, 0xBA,
-    0x6B, 0x3F, 0x0F, 0xAA, 0x9D, 0x78, 0x38, 0xF0, 0x89, 0xE5, 0x58, 0xE1, 0x13, 0xE6, 0x18, 0xEF,
-    0x2E, 0xAC, 0xC5, 0x1E, 0xCB, 0x36, 0x88, 0x65, 0x3B, 0x52, 0xF9, 0x44, 0xA2, 0xEB, 0x4C, 0x1A,
-    0x9C, 0x46, 0xAC, 0xC9, 0x34, 0x01, 0x0E, 0x8F, 0x33, 0x58, 0x2C, 0x2E, 0xFC, 0x7A, 0x96, 0x20,
-    0x9F, 0x60, 0xF2, 0x41, 0x72, 0x9A, 0x8D, 0x29, 0x06, 0x21, 0xD2, 0xAF, 0xB1, 0x88, 0x15, 0xDB,
-    0x23, 0x23, 0x21, 0xEA, 0xDD, 0x6B, 0x19, 0x96, 0xD6, 0xFA, 0x86, 0xE2, 0x7D, 0x24, 0x6C, 0x15,
-    0xD2, 0x65, 0x5B, 0xDD, 0xC4, 0xCD, 0x3E, 0xCD, 0x45, 0x5D, 0x23, 0x83, 0x54, 0xEC, 0x31, 0x6A,
-    0x87, 0x51, 0xFB, 0x8B, 0xB6, 0x51, 0xAA, 0x5D, 0x52, 0x6D, 0x91, 0x6A, 0x7F, 0x54, 0x9B, 0xA3,
-    0xDA, 0x19, 0xD5, 0xB6, 0xA8, 0xF6, 0x44, 0xB5, 0x21, 0xAA, 0xDD, 0x50, 0x6D, 0x85, 0x6A, 0x1F,
-    0x94, 0x61, 0x5D, 0x7B, 0x88, 0xDA, 0x41, 0xEC, 0x9F, 0xCF, 0x85, 0x17, 0x16, 0x43, 0x05, 0x2E,
-    0xE7, 0x65, 0xAB, 0x1F, 0x28, 0x6C, 0x07, 0x0A, 0xBB, 0x81, 0xC2, 0x66, 0xA0, 0xB0, 0x17, 0x28,
-    0x6C, 0xF3, 0x7D, 0x07, 0x61, 0x92, 0x15, 0xB6, 0x00, 0x87, 0x66, 0x89, 0x2E, 0xA5, 0x8D, 0xA1,
-    0xDB, 0xA8, 0x38, 0xC9, 0xFB, 0x23, 0x06, 0xF6, 0x5C, 0x92, 0x57, 0x93, 0x1E, 0x40, 0xF5, 0x04,
-    0x6F, 0x7D, 0xDE, 0x11, 0x10, 0xB1, 0x1F, 0x08, 0xCB, 0x4D, 0xC4, 0x5E, 0xF7, 0x88, 0x9D, 0x78,
-    0x78, 0xF4, 0x2D, 0x16, 0x83, 0x05, 0xEB, 0x45, 0x0F, 0xD6, 0xB3, 0x99, 0xEE, 0x1E, 0x2D, 0xC9,
-    0xA1, 0x5F, 0xE9, 0x4B, 0x05, 0xAA, 0x79, 0xB3, 0x14, 0xA7, 0x98, 0x88, 0x73, 0xAD, 0xB4, 0x8D,
-    0xEF, 0xB9, 0xFB, 0x40, 0xFB, 0x3B, 0x00, 0xED, 0xC9, 0x0F, 0x01, 0xED, 0x4E, 0x37, 0xDB, 0x47,
-    0xF6, 0xED, 0xA2, 0x9D, 0x97, 0xFF, 0x29, 0x08, 0x6F, 0x5B, 0xB0, 0xDA, 0x7B, 0x0D, 0x39, 0x1B,
-    0xC7, 0x64, 0x97, 0xC0, 0x7C, 0x1F, 0x92, 0x78, 0x46, 0x7B, 0x8C, 0xAC, 0x35, 0x8E, 0x30, 0xDA,
-    0x9C, 0xDF, 0x06, 0x48, 0x5C, 0x86, 0x26, 0x3F, 0x07, 0x1E, 0x98, 0x27, 0xEE, 0x38, 0x44, 0x2C,
-    0x72, 0x84, 0x64, 0x1D, 0x58, 0xE4, 0x9D, 0x12, 0xE4, 0x3D, 0x80, 0x90, 0xF4, 0x7D, 0x5C, 0x10,
-    0x7F, 0x46, 0x40, 0xF2, 0x4F, 0x02, 0x92, 0x66, 0x58, 0x6D, 0x0A, 0x48, 0x46, 0x5F, 0x33, 0x2B,
-    0x65, 0xB3, 0x3A, 0xD2, 0x8D, 0x83, 0xC2, 0xB6, 0x91, 0xC4, 0x01, 0xFE, 0xF8, 0x50, 0x81, 0xA0,
-    0xC5, 0x1F, 0x26, 0x49, 0x97, 0x4C, 0x91, 0xBB, 0x79, 0x61, 0x7C, 0x7C, 0x72, 0x00, 0xC7, 0xD1,
-    0xA8, 0xC8, 0xD7, 0x31, 0xCE, 0x64, 0x6B, 0xDF, 0x14, 0x60, 0x5F, 0x67, 0xA6, 0xDF, 0xAC, 0xA1,
-    0xE1, 0x9A, 0x73, 0x20, 0xC7, 0x43, 0x16, 0x93, 0x5E, 0xB6, 0x17, 0xBD, 0xE9, 0x4B, 0x51, 0x22,
-    0xD1, 0xEB, 0x85, 0xF8, 0x57, 0x27, 0xB8, 0x7A, 0xFD, 0x29, 0x95, 0x98, 0x9A, 0x6F, 0x7D, 0x46,
-    0x9D, 0xF0, 0x55, 0x7C, 0xFC, 0xB2, 0x53, 0xEE, 0x85, 0x2E, 0x4C, 0x4B, 0x9A, 0x2A, 0xAE, 0x55,
-    0xE2, 0xC9, 0xDB, 0x4F, 0x45, 0x97, 0xE0, 0x0B, 0x84, 0xF5, 0xDB, 0x90, 0x63, 0x7A, 0x16, 0xA2,
-    0x1D, 0xEC, 0x4B, 0x12, 0x33, 0x5D, 0xEC, 0x3E, 0xE6, 0x1E, 0x18, 0x60, 0x88, 0x62, 0x92, 0x23,
-    0xEE, 0xCC, 0x3E, 0x14, 0xD2, 0x07, 0x40, 0xCB, 0xC9, 0x64, 0xDB, 0x67, 0xDC, 0x41, 0x6B, 0xE4,
-    0x20, 0xF7, 0xCD, 0x16, 0xBB, 0xF1, 0xC5, 0xD4, 0x2E, 0x2F, 0xB9, 0x14, 0xC3, 0xFE, 0xF0, 0xA3,
-    0x40, 0xED, 0x3F, 0x60, 0xD9, 0x04, 0xC6, 0xAB, 0x25, 0xBA, 0xCC, 0xB4, 0x00, 0x99, 0x10, 0xFE,
-    0xF9, 0x6F, 0x5B, 0x33, 0x63, 0x6D, 0xD4, 0x30, 0x77, 0xA7, 0x99, 0x83, 0x84, 0x3B, 0x8F, 0xC8,
-    0x79, 0x71, 0x7B, 0x1B, 0x1B, 0xE8, 0x0A, 0xD1, 0x1C, 0xA1, 0x30, 0x12, 0x59, 0xF7, 0x9F, 0xBA,
-    0xCC, 0xB4, 0xB3, 0x7B, 0x9F, 0x9D, 0x9F, 0x50, 0xE6, 0x34, 0xCA, 0xC2, 0xD7, 0x0A, 0xFF, 0x4A,
-    0xE5, 0x4C, 0xCE, 0xEB, 0xB6, 0x6F, 0xEB, 0x98, 0x7A, 0xDB, 0x2F, 0x18, 0x1E, 0xF9, 0x72, 0xF2,
-    0x1B, 0x0A, 0xAA, 0x25, 0x0E, 0x8B, 0xF0, 0xFD, 0xD2, 0xFB, 0x1C, 0xCF, 0x51, 0xB9, 0x4E, 0x26,
-    0x23, 0x6E, 0xDB, 0x96, 0xCC, 0xEB, 0x0F, 0x7B, 0xA5, 0xF5, 0x48, 0xEF, 0xF5, 0xB8, 0x22, 0xE5,
-    0x15, 0x3F, 0x3B, 0x32, 0x2A, 0x9E, 0x64, 0x4F, 0x25, 0x60, 0x2A, 0x95, 0x8D, 0xB0, 0x37, 0xFD,
-    0xC2, 0x32, 0x2B, 0xCA, 0x80, 0x39, 0xEB, 0xA1, 0xAF, 0x90, 0x79, 0xCC, 0x56, 0x54, 0xEE, 0xED,
-    0x86, 0xA8, 0x8C, 0xC9, 0x79, 0x15, 0xD3, 0x27, 0x07, 0xFD, 0x64, 0xCF, 0xF6, 0x54, 0x30, 0x0B,
-    0x12, 0xBD, 0x86, 0x60, 0x70, 0xA5, 0x12, 0xA7, 0x3C, 0xFF, 0x94, 0xF6, 0x54, 0xBC, 0x46, 0x7F,
-    0xA8, 0xC1, 0x64, 0xC0, 0x6A, 0xEE, 0xC8, 0x66, 0x1C, 0xDD, 0x7D, 0x85, 0xF8, 0x33, 0x98, 0x11,
-    0x2A, 0x44, 0xF7, 0x5A, 0x2D, 0x5E, 0x72, 0xE4, 0xE9, 0x28, 0xE4, 0x5F, 0x67, 0x97, 0xAA, 0xA2,
-    0x56, 0x53, 0xA6, 0xB7, 0x43, 0xC1, 0xEC, 0xCF, 0x3E, 0xB4, 0xE8, 0x70, 0x1B, 0xF5, 0x89, 0x11,
-    0xEB, 0x1E, 0xC7, 0x0C, 0x44, 0xDF, 0xEA, 0x17, 0x21, 0x0B, 0x57, 0xA6, 0x94, 0x56, 0xCB, 0x9E,
-    0x48, 0xBB, 0x19, 0xC4, 0x8F, 0x3E, 0xAB, 0x0A, 0x77, 0x7B, 0xAB, 0xA2, 0x88, 0x34, 0x2C, 0xC4,
-    0x88, 0xD2, 0xC1, 0xA7, 0x28, 0x97, 0xB0, 0xEA, 0xA4, 0x3A, 0xD3, 0xA3, 0xA7, 0x5F, 0x11, 0x3C,
-    0x25, 0xC1, 0xBD, 0x3C, 0xF3, 0x9B, 0x28, 0xF1, 0xA7, 0x2F, 0xDD, 0xD7, 0xB6, 0xD8, 0x7E, 0x84,
-    0x6D, 0xC2, 0x9E, 0xB6, 0xCC, 0x6C, 0x44, 0x47, 0x3A, 0x31, 0xCC, 0x38, 0x6F, 0x0F, 0x13, 0xB3,
-    0xBB, 0x7A, 0xEC, 0x34, 0x27, 0x4F, 0xA6, 0x47, 0x43, 0x14, 0x70, 0x0E, 0x89, 0x4C, 0x42, 0xC2,
-    0x4D, 0xEF, 0xDD, 0x72, 0xEF, 0x36, 0xED, 0x82, 0x4F, 0xB9, 0x61, 0xF8, 0x77, 0xED, 0x20, 0x5C,
-    0x60, 0x45, 0x73, 0x78, 0x37, 0xB6, 0xAE, 0x2C, 0xB8, 0x53, 0xFC, 0x8A, 0xC1, 0xFD, 0x77, 0x31,
-    0xE6, 0xF3, 0xB2, 0xBE, 0x77, 0x5A, 0xDA, 0x5A, 0x22, 0x66, 0xEA, 0x3C, 0xCB, 0x8A, 0x61, 0xDD,
-    0x4B, 0x76, 0x47, 0xCB, 0x7C, 0x2A, 0xDE, 0x1D, 0xF8, 0x01, 0xD6, 0x36, 0x32, 0x42, 0x16, 0x65,
-    0xF3, 0x5A, 0x91, 0x85, 0x84, 0xD9, 0xF4, 0x33, 0xFE, 0x72, 0x29, 0xE7, 0xCF, 0xD8, 0x38, 0xF9,
-    0x79, 0x39, 0x87, 0xA8, 0x71, 0x1C, 0xD5, 0x64, 0xCC, 0x23, 0x09, 0x8B, 0xE8, 0xAB, 0x1C, 0xB9,
-    0xA3, 0xDE, 0xDA, 0x63, 0x8B, 0x7B, 0x08, 0xCA, 0xE5, 0x72, 0x1A, 0xC7, 0x38, 0xF1, 0x4D, 0x15,
-    0x2D, 0x4D, 0x63, 0xA9, 0x59, 0x4D, 0x4F, 0xA1, 0x67, 0xC1, 0x1B, 0xD2, 0x66, 0xDF, 0xA8, 0x39,
-    0x2A, 0xCD, 0x31, 0x69, 0xE2, 0x0F, 0x6A, 0xDF, 0x2A, 0xFF, 0xA2, 0xC8, 0x05, 0x6D, 0x0E, 0xC1,
-    0xDC, 0x80, 0x1C, 0x4C, 0x65, 0xF9, 0x27, 0xDF, 0xE6, 0x72, 0x1E, 0xBA, 0xCA, 0x7A, 0x4F, 0xFC,
-    0xBE, 0xA6, 0xFA, 0xFE, 0x64, 0xA5, 0x65, 0x4B, 0x60, 0x33, 0x5C, 0xD9, 0xED, 0x49, 0x0E, 0xAC,
-    0x35, 0x93, 0x06, 0x15, 0xDD, 0xFB, 0x39, 0x4D, 0x01, 0x46, 0xB0, 0xDC, 0x5D, 0x26, 0x98, 0xC5,
-    0x3B, 0x89, 0x9A, 0x72, 0x87, 0x17, 0x5B, 0x12, 0x66, 0xE2, 0x58, 0xE1, 0x4F, 0x10, 0x17, 0x3B,
-    0x15, 0x81, 0x71, 0xBF, 0x25, 0xB3, 0x1F, 0x65, 0x78, 0x04, 0xC8, 0x93, 0xA2, 0x68, 0xCF, 0x01,
-    0x9E, 0x8E, 0x6B, 0x41, 0x8F, 0xD5, 0xC8, 0xE4, 0x8C, 0xE4, 0x27, 0xA8, 0x4B, 0x9D, 0x7F, 0xB4,
-    0xB3, 0x2D, 0xA5, 0xD2, 0xFE, 0xC8, 0x83, 0x07, 0xDF, 0x23, 0xFE, 0x3A, 0x34, 0x3E, 0x1E, 0x9C,
-    0x23, 0x6F, 0x62, 0x2E, 0x7E, 0xC3, 0xE7, 0x7E, 0xC4, 0xDF, 0x45, 0x5D, 0xF4, 0x6A, 0xC4, 0x84,
-    0x55, 0x9B, 0x0B, 0x3D, 0xA4, 0xB4, 0x72, 0x84, 0xEC, 0xF9, 0xA1, 0xB6, 0x77, 0x50, 0x2D, 0x38,
-    0x6D, 0xFF, 0x7B, 0x27, 0x08, 0x19, 0x4D, 0xF0, 0x15, 0xA2, 0xCB, 0xDD, 0xAD, 0x5D, 0x77, 0x46,
-    0xD4, 0xEB, 0x93, 0xBE, 0xFD, 0xB6, 0xB9, 0xEB, 0x9E, 0x9A, 0xCB, 0xA6, 0x0B, 0x0D, 0x8A, 0x78,
-    0xAD, 0xE0, 0xB5, 0xEC, 0xDE, 0x91, 0x60, 0x6A, 0x4A, 0x2D, 0xD6, 0x1F, 0x7E, 0x09, 0x09, 0x53,
-    0xF4, 0x9D, 0xD4, 0x5C, 0x19, 0xAA, 0x15, 0x36, 0x7F, 0xB5, 0xFB, 0xAB, 0xED, 0xDF, 0xA1, 0xFF,
-    0x6B, 0x3B, 0xC0, 0xDA, 0x02, 0x7E, 0xB0, 0xA4, 0x46, 0xB5, 0xEA, 0x7F, 0x03, 0x0B, 0xFB, 0x4F,
-    0x50, 0xAD, 0xFE, 0x17, 0x7D, 0x55, 0x41, 0x6F, 0x1B, 0x45, 0x14, 0xFE, 0x76, 0xD7, 0xCE, 0xB6,
-    0x59, 0x9A, 0xB5, 0x50, 0x52, 0x25, 0x05, 0x7B, 0x7D, 0xC8, 0xA1, 0x0D, 0xB1, 0x97, 0x43, 0x90,
-    0x7C, 0xB0, 0xBD, 0x23, 0x7E, 0x81, 0x0F, 0x31, 0x12, 0x27, 0x72, 0xC8, 0x05, 0x57, 0xA8, 0x3E,
-    0xE4, 0x90, 0x4A, 0x21, 0x3B, 0x12, 0xDC, 0x6B, 0xF1, 0x0B, 0x7C, 0x48, 0x51, 0x31, 0x87, 0xF8,
-    0x90, 0xA0, 0x20, 0xD2, 0xEE, 0x88, 0xFC, 0x81, 0x81, 0x5F, 0xB0, 0x17, 0x0E, 0x05, 0x09, 0x0D,
-    0xC8, 0x41, 0xA1, 0xB2, 0x77, 0x78, 0x63, 0x37, 0x69, 0x9A, 0x03, 0xF3, 0x56, 0xE3, 0x37, 0x6F,
-    0x66, 0xDE, 0xBC, 0xF7, 0xBD, 0x6F, 0xC6, 0x40, 0x24, 0x7C, 0x69, 0x2B, 0xEC, 0x02, 0xCE, 0xD8,
-    0x4B, 0x03, 0x5E, 0x07, 0x35, 0x77, 0x0C, 0x3F, 0x43, 0x33, 0x60, 0x3B, 0x8E, 0xA0, 0x61, 0x20,
-    0x87, 0xF1, 0xAB, 0xF4, 0x58, 0x8B, 0x5E, 0xC8, 0x80, 0x24, 0x4B, 0xB2, 0x76, 0xBB, 0xAD, 0xB5,
-    0x06, 0x94, 0xFF, 0x7C, 0x3F, 0xA2, 0x7D, 0x20, 0x3F, 0x46, 0xF2, 0xA8, 0xB8, 0x3C, 0xF2, 0x05,
-    0x7D, 0x39, 0x0B, 0xF7, 0x78, 0xAC, 0xCA, 0x23, 0x8C, 0x5C, 0xE9, 0xC2, 0x42, 0x1E, 0xB1, 0x54,
-    0x2A, 0x1D, 0x9E, 0xAB, 0xC8, 0x38, 0xA5, 0x03, 0xFF, 0xBA, 0xF0, 0xCF, 0x54, 0xE0, 0x89, 0xFA,
-    0x82, 0x19, 0x36, 0x1C, 0xE9, 0x3F, 0xE1, 0xAE, 0x86, 0x3D, 0x86, 0xA2, 0xD6, 0x52, 0xAF, 0x5B,
-    0xAB, 0x45, 0xB3, 0x2F, 0x22, 0x16, 0xFA, 0xC2, 0x3F, 0x4B, 0x6D, 0xA9, 0x68, 0x68, 0x8D, 0x28,
-    0x5E, 0xD8, 0x17, 0xA8, 0xD9, 0xA2, 0xE9, 0x09, 0x5F, 0x1B, 0x9D, 0x22, 0x1D, 0x45, 0xE3, 0x93,
-    0x6A, 0xEA, 0x81, 0x7B, 0xA2, 0x88, 0x3A, 0x22, 0x66, 0xA2, 0x9A, 0x67, 0x3E, 0xFD, 0x86, 0xC2,
-    0x17, 0x8E, 0x70, 0x59, 0x13, 0x65, 0xF8, 0x53, 0x7B, 0x44, 0x2B, 0x8A, 0xF0, 0x04, 0xB8, 0x3F,
-    0x8D, 0xFF, 0xCD, 0xBC, 0xC9, 0xC7, 0x53, 0xF6, 0x88, 0x16, 0xBC, 0xC1, 0xC5, 0x7D, 0x98, 0xB8,
-    0x16, 0xE4, 0xCB, 0x4C, 0x32, 0x3D, 0x4E, 0xC6, 0x34, 0x37, 0x93, 0x55, 0x20, 0x24, 0xEF, 0x9E,
-    0x70, 0xC9, 0x63, 0x01, 0xB9, 0xC6, 0x4E, 0xB7, 0x56, 0xCC, 0x63, 0x9E, 0x24, 0x96, 0x40, 0xA7,
-    0xF7, 0xA8, 0x67, 0x74, 0xD3, 0xE6, 0x11, 0xB0, 0x58, 0xCE, 0xE3, 0x36, 0x59, 0x3B, 0x3D, 0x32,
-    0xA4, 0x46, 0xEE, 0xCA, 0x58, 0x18, 0x64, 0x87, 0x24, 0x5D, 0x3C, 0x66, 0x91, 0x0C, 0xF8, 0x0A,
-    0x62, 0x9E, 0xF0, 0x88, 0x96, 0x5C, 0x47, 0xF4, 0x12, 0xC3, 0xE3, 0x34, 0xE4, 0x4B, 0xCD, 0xBD,
-    0x23, 0x42, 0xE6, 0x0E, 0x02, 0xE1, 0x28, 0x5B, 0x7D, 0x2F, 0x13, 0x16, 0x60, 0x0F, 0x17, 0x18,
-    0x23, 0x51, 0x61, 0x3A, 0x45, 0x8E, 0xB6, 0x27, 0x3A, 0xFD, 0xF1, 0x93, 0x74, 0x88, 0xB4, 0x85,
-    0x16, 0xB3, 0xCE, 0xBE, 0xFA, 0xE9, 0xCF, 0xFB, 0xDB, 0xDB, 0x56, 0xAF, 0x3A, 0x05, 0x8D, 0x30,
-    0xB4, 0x36, 0x61, 0x1D, 0xC0, 0x9D, 0xC0, 0x3F, 0x44, 0xC3, 0x15, 0x8B, 0x16, 0x5B, 0xB5, 0x38,
-    0x29, 0x81, 0x66, 0xDE, 0x04, 0x68, 0x99, 0x59, 0x22, 0x43, 0x78, 0xC8, 0xEA, 0x8E, 0x28, 0x80,
-    0xCD, 0xB1, 0x42, 0x94, 0xAA, 0x44, 0x4B, 0x95, 0x70, 0xE4, 0xD0, 0xF9, 0x2E, 0xC9, 0x96, 0x36,
-    0xD7, 0x06, 0xCF, 0x62, 0x3D, 0x59, 0x6A, 0x6F, 0x46, 0x7A, 0x4C, 0xBA, 0xC1, 0xEF, 0x52, 0x99,
-    0x91, 0xE7, 0x9C, 0xC8, 0x53, 0xA5, 0x14, 0xA1, 0xB5, 0x1A, 0x0C, 0xFA, 0x53, 0x30, 0x22, 0xA2,
-    0x90, 0x58, 0x1B, 0x0C, 0x06, 0xDC, 0x8C, 0x6C, 0x49, 0x89, 0x58, 0x14, 0x46, 0x8A, 0x7D, 0x60,
-    0x03, 0x57, 0x6D, 0xC3, 0x00, 0x03, 0x05, 0x4B, 0x82, 0xD8, 0xE8, 0x70, 0x78, 0x80, 0x0F, 0x2A,
-    0x9C, 0x29, 0x4E, 0xED, 0xFF, 0x26, 0xEF, 0x4F, 0xF7, 0x17, 0xF6, 0x8A, 0x77, 0xD6, 0x77, 0x48,
-    0xE9, 0xA3, 0x4F, 0x30, 0x10, 0x1E, 0x9D, 0x41, 0x2F, 0xD6, 0xF2, 0x69, 0xBB, 0x4F, 0x96, 0xE3,
-    0x76, 0x4A, 0x7A, 0x6E, 0x31, 0xCE, 0x7E, 0x3E, 0xE3, 0x1F, 0x97, 0x39, 0xB1, 0x80, 0x6A, 0x5F,
-    0x16, 0x2B, 0xBB, 0xC3, 0xDD, 0xCA, 0x42, 0xA5, 0x4C, 0x39, 0x51, 0x66, 0xB4, 0xFB, 0x52, 0x49,
-    0x58, 0x28, 0xDC, 0x14, 0x47, 0xC4, 0x87, 0x0B, 0x3F, 0x0D, 0xD9, 0x2E, 0x6E, 0x26, 0xF9, 0x65,
-    0x12, 0x14, 0xB7, 0x8D, 0xF5, 0x14, 0xDB, 0x93, 0xFE, 0xF8, 0x1F, 0x75, 0xFA, 0xB7, 0x2A, 0x08,
-    0xB6, 0x86, 0x98, 0x24, 0x12, 0x01, 0xBF, 0x51, 0x95, 0x1B, 0x98, 0x5D, 0xA7, 0x7D, 0x2C, 0x3F,
-    0x90, 0x36, 0x09, 0xA5, 0x12, 0x9C, 0x74, 0xE3, 0x4C, 0xFD, 0xA0, 0xE5, 0x37, 0xBF, 0x33, 0x8B,
-    0x99, 0xC2, 0x10, 0xE3, 0x0D, 0xE9, 0xFB, 0x85, 0x40, 0xAA, 0x58, 0xA7, 0xE7, 0x09, 0xEF, 0xCD,
-    0x8C, 0x63, 0x93, 0xEB, 0x8D, 0xA8, 0xDE, 0x2E, 0x43, 0xAE, 0xD0, 0x3C, 0x8D, 0x27, 0xCB, 0xAB,
-    0x66, 0x95, 0x8F, 0x90, 0xF8, 0x6F, 0x44, 0x3B, 0x63, 0x5F, 0xBD, 0xB4, 0x0E, 0xE6, 0x86, 0x44,
-    0x5B, 0x74, 0x65, 0xFE, 0x29, 0xD1, 0x71, 0x29, 0x4F, 0xEB, 0xB7, 0xD0, 0x03, 0x1D, 0xBA, 0x88,
-    0x5F, 0xA8, 0xEB, 0xFE, 0x0A, 0xDC, 0x9A, 0x75, 0xB4, 0x2E, 0xD7, 0xB5, 0x39, 0x96, 0x4D, 0x3C,
-    0x14, 0xEF, 0xA6, 0xD5, 0x82, 0xBC, 0xFD, 0x2D, 0xBA, 0x53, 0x07, 0xBF, 0x59, 0x9B, 0xF9, 0xE1,
-    0xD4, 0xA9, 0x29, 0x54, 0x40, 0x77, 0xB2, 0x71, 0x79, 0x3F, 0x4A, 0x53, 0x5A, 0x69, 0x84, 0x9F,
-    0x71, 0xA2, 0xD5, 0xD5, 0x6D, 0x26, 0x1F, 0x57, 0x25, 0x20, 0x98, 0x6C, 0xBA, 0x16, 0x4D, 0xB8,
-    0x02, 0xEC, 0xBA, 0x03, 0x7A, 0x4D, 0x5E, 0x78, 0xCC, 0x7F, 0x22, 0x9E, 0x17, 0xA5, 0xDC, 0x18,
-    0x4E, 0xEB, 0x7B, 0x64, 0x30, 0x85, 0x66, 0x09, 0xC5, 0x08, 0xBC, 0xFB, 0x75, 0xF3, 0xD4, 0x4B,
-    0x9B, 0xA7, 0x36, 0x0F, 0x0E, 0xD9, 0x47, 0xE7, 0xA2, 0xDB, 0x97, 0xD4, 0x93, 0xBE, 0x48, 0x6C,
-    0x8A, 0xC4, 0x5D, 0x41, 0x21, 0x93, 0x23, 0x0A, 0xDE, 0x3C, 0x77, 0x75, 0x9F, 0xC1, 0x52, 0x4E,
-    0xD6, 0x4E, 0x04, 0x1E, 0xE9, 0x7F, 0xC9, 0xB2, 0xF8, 0xD6, 0x2C, 0x87, 0xAD, 0xEC, 0x6C, 0x40,
-    0x74, 0x0F, 0xF5, 0xC5, 0x1B, 0x5E, 0xC6, 0xDA, 0x30, 0xDE, 0xB0, 0x42, 0x4F, 0x88, 0xC5, 0xCF,
-    0xD0, 0x26, 0x23, 0xF3, 0xC8, 0x81, 0x23, 0x82, 0x3F, 0x74, 0x96, 0xB0, 0x3A, 0xDE, 0xD3, 0x99,
-    0xF1, 0x94, 0x27, 0x68, 0xAC, 0xC1, 0xC1, 0x6C, 0x13, 0x31, 0x35, 0x6B, 0x3F, 0xA4, 0x17, 0x96,
-    0x92, 0x0A, 0xA7, 0x1C, 0x75, 0xF8, 0x6B, 0x97, 0xE5, 0xCE, 0x60, 0x70, 0x42, 0x4B, 0xA8, 0x80,
-    0xF8, 0xD0, 0x18, 0x42, 0x51, 0x96, 0xF7, 0xD2, 0xA3, 0xF4, 0x38, 0x5D, 0xDE, 0x2A, 0x89, 0x0D,
-    0xB5, 0xAF, 0x76, 0x50, 0xDF, 0x9A, 0xA3, 0x9D, 0xEB, 0x34, 0xBB, 0x47, 0xFD, 0x4C, 0x3A, 0xA8,
-    0x8A, 0xAE, 0x1A, 0x52, 0xDB, 0x48, 0xE7, 0x59, 0x65, 0xB7, 0x58, 0x37, 0x52, 0xDA, 0x9B, 0xFB,
-    0xB4, 0x24, 0x6B, 0xFD, 0x1A, 0x81, 0x47, 0xBB, 0xE8, 0x14, 0x4B, 0x41, 0x35, 0xD5, 0x70, 0xCA,
-    0xAF, 0x63, 0xB5, 0x42, 0x2C, 0xAD, 0xD0, 0x5D, 0x29, 0x8D, 0x4A, 0xF5, 0xD9, 0x8E, 0xB5, 0x95,
-    0xEA, 0x2B, 0xB5, 0x50, 0xA9, 0x2D, 0xAC, 0x9B, 0xAF, 0xB4, 0x4E, 0x86, 0x07, 0x0D, 0x55, 0xD9,
-    0x9A, 0x9D, 0xB2, 0x46, 0x67, 0xBE, 0x4F, 0xB7, 0x73, 0xF6, 0xEC, 0x35, 0xE8, 0x35, 0xAB, 0x16,
-    0x17, 0x6E, 0x79, 0xAB, 0x6E, 0xD7, 0x91, 0x16, 0x0F, 0xBF, 0xF0, 0xCA, 0x0E, 0xFD, 0x97, 0xBC,
-    0x53, 0x7F, 0xF0, 0xF9, 0x7F, 0xCD, 0x7C, 0x4D, 0x8C, 0xDD, 0x56, 0x96, 0xDE, 0xE5, 0xA3, 0x4A,
-    0x6C, 0x37, 0x27, 0x62, 0x05, 0x90, 0xE2, 0x19, 0x57, 0x4B, 0xEC, 0x45, 0x36, 0xE9, 0x91, 0xCD,
-    0x59, 0x38, 0x48, 0x0D, 0x50, 0x12, 0x29, 0x19, 0x19, 0x2D, 0x04, 0xC4, 0x5A, 0xA8, 0xBA, 0x17,
-    0x06, 0x22, 0x2F, 0x7A, 0x33, 0x46, 0x92, 0xF2, 0x42, 0x03, 0x08, 0x88, 0x2D, 0xD2, 0xD6, 0xA2,
-    0x17, 0xBD, 0x68, 0x6D, 0x32, 0xB3, 0x08, 0x02, 0x7B, 0xE1, 0x45, 0xBA, 0x34, 0x89, 0x04, 0x4C,
-    0x01, 0xA3, 0x24, 0xB2, 0x2E, 0x25, 0x2D, 0xBC, 0xE8, 0x85, 0x29, 0xDB, 0xDD, 0x0D, 0xA4, 0x91,
-    0x31, 0xED, 0x96, 0x3D, 0x63, 0x37, 0x10, 0xB1, 0xDD, 0x54, 0x9B, 0x55, 0x22, 0x79, 0xF3, 0x7D,
-    0xE7, 0xF2, 0xBD, 0x7A, 0xA5, 0x2A, 0xFD, 0x97, 0x9C, 0xA9, 0xAA, 0x7B, 0x58, 0x8F, 0x7C, 0xBC,
-    0xBC, 0xF7, 0xDC, 0xF3, 0x7F, 0xCE, 0xA5, 0x3A, 0xAE, 0x94, 0x32, 0x68, 0x51, 0xA6, 0x94, 0x57,
-    0xE0, 0x9F, 0xB7, 0x15, 0x7F, 0x52, 0x63, 0xEA, 0x39, 0x63, 0x1A, 0xB7, 0x55, 0x17, 0xD1, 0xE6,
-    0xD1, 0x9E, 0x47, 0x53, 0x93, 0x66, 0x4C, 0xEE, 0xF6, 0xCB, 0xC9, 0x86, 0x73, 0xAD, 0x7A, 0x0A,
-    0x6D, 0x2F, 0xDA, 0x81, 0xB9, 0x7E, 0xB9, 0x43, 0x1F, 0x5D, 0xE8, 0x16, 0x2A, 0xFE, 0x51, 0xA5,
-    0xA2, 0x23, 0xA5, 0xDA, 0xA1, 0x92, 0x6D, 0xED, 0x1B, 0xCD, 0x28, 0x4D, 0x70, 0x31, 0xA8, 0x02,
-    0x75, 0x21, 0xA8, 0x7C, 0x0B, 0x54, 0x50, 0xA9, 0x31, 0xF8, 0xED, 0x72, 0xA2, 0x02, 0x3C, 0x50,
-    0x05, 0xAB, 0x73, 0x2D, 0xCE, 0x8D, 0x7A, 0x00, 0xC7, 0x6C, 0x04, 0x3C, 0x87, 0x9E, 0x97, 0x56,
-    0xC3, 0xDA, 0x31, 0x86, 0xA8, 0xE0, 0x8F, 0xC6, 0x70, 0x3B, 0x3C, 0x1A, 0xFD, 0x78, 0xF6, 0x54,
-    0x6C, 0x4C, 0x15, 0xF6, 0xE7, 0xF8, 0xDD, 0x1A, 0x6D, 0x05, 0xED, 0xE4, 0x1D, 0xA3, 0xBC, 0x67,
-    0x9B, 0xEB, 0x13, 0xF4, 0x51, 0xDA, 0xEE, 0x23, 0x93, 0x8D, 0xFA, 0xF3, 0x95, 0x5F, 0x79, 0x75,
-    0x58, 0xB8, 0x75, 0x9C, 0x8F, 0x8A, 0x34, 0xB3, 0x4F, 0x35, 0x6C, 0xA6, 0xB2, 0x2D, 0xB1, 0xE7,
-    0x78, 0x2D, 0xCE, 0x71, 0x5B, 0xA9, 0xBE, 0x1B, 0x34, 0x78, 0xBE, 0x41, 0x47, 0xA9, 0xB1, 0x28,
-    0x95, 0xE1, 0x36, 0xCA, 0x5B, 0xD5, 0x49, 0x90, 0x47, 0x79, 0x94, 0x01, 0x66, 0xBB, 0x54, 0x84,
-    0x05, 0x0D, 0x1B, 0x60, 0xC1, 0x9C, 0x05, 0x56, 0x31, 0x00, 0x8D, 0xEF, 0xFB, 0x06, 0xBD, 0xA4,
-    0xC5, 0x0E, 0x15, 0x96, 0xCF, 0xA9, 0xA0, 0x8C, 0x55, 0x50, 0xC4, 0xB8, 0x2B, 0xFC, 0x2C, 0x55,
-    0x9E, 0x69, 0x86, 0x79, 0xE6, 0xA1, 0x21, 0xFE, 0x1F, 0xF0, 0x0F, 0xF3, 0xC2, 0x2D, 0xCF, 0xF9,
-    0x59, 0x1C, 0xE4, 0xF8, 0xDB, 0xE1, 0x3C, 0x7A, 0x27, 0xA1, 0xA9, 0x77, 0x62, 0xB4, 0x46, 0x3D,
-    0xC2, 0x1F, 0xD6, 0x11, 0xFD, 0xA4, 0xB5, 0x4A, 0x13, 0x12, 0x11, 0xF0, 0xE3, 0x80, 0x3C, 0x8E,
-    0x29, 0xB5, 0x30, 0xC2, 0x3A, 0xDE, 0x03, 0x1A, 0xA0, 0xE5, 0xD4, 0xA8, 0xD7, 0x15, 0x60, 0xE7,
-    0xB5, 0x84, 0x6E, 0xA7, 0x56, 0x46, 0x1D, 0xA8, 0xA5, 0x26, 0x74, 0x2A, 0xC0, 0xCE, 0x03, 0x74,
-    0x5B, 0x53, 0xE2, 0xBF, 0xC6, 0xE4, 0x4F, 0x1B, 0x5D, 0x6A, 0x0C, 0xB9, 0x1F, 0x96, 0x20, 0x35,
-    0xEF, 0x19, 0x59, 0xE3, 0x43, 0xE6, 0x86, 0x2C, 0x37, 0x57, 0xEB, 0x9E, 0x87, 0x7E, 0x59, 0x7F,
-    0x69, 0x47, 0x0A, 0xBC, 0xF3, 0xE4, 0x15, 0x63, 0xAF, 0xA5, 0x99, 0x1C, 0xE2, 0x7C, 0x8B, 0xC3,
-    0x70, 0xCD, 0xF0, 0x41, 0xFA, 0x66, 0x87, 0xC7, 0xFE, 0xD2, 0x52, 0x02, 0xF8, 0xC0, 0x72, 0x83,
-    0x65, 0x87, 0x81, 0x15, 0x2C, 0xB4, 0xCC, 0x30, 0x86, 0xE4, 0x09, 0x32, 0x05, 0x3E, 0x05, 0xAB,
-    0x61, 0xAB, 0x2C, 0xF5, 0x93, 0x39, 0xBA, 0xBB, 0xC3, 0xA5, 0xD5, 0x91, 0x49, 0xC0, 0x1D, 0x87,
-    0xC7, 0xF4, 0x6B, 0x7B, 0x0B, 0x31, 0x11, 0x75, 0x90, 0x1F, 0x57, 0xD4, 0x18, 0x0F, 0xD7, 0x4C,
-    0x39, 0xD7, 0x1F, 0x36, 0x67, 0xD1, 0xA9, 0xAC, 0x6C, 0x05, 0x00, 0x39, 0xE0, 0xB6, 0x01, 0x66,
-    0xDB, 0x3E, 0x4B, 0x04, 0xBC, 0x2B, 0x6C, 0x4E, 0x1C, 0x98, 0x0C, 0x1F, 0xD3, 0x1C, 0x00, 0x94,
-    0x8D, 0xAF, 0xD4, 0x00, 0x3E, 0x6F, 0xC3, 0x0A, 0xB8, 0xAD, 0xC3, 0x79, 0x26, 0xA6, 0x48, 0x4D,
-    0x11, 0xD6, 0x6A, 0x26, 0x19, 0x3F, 0xD6, 0x15, 0x42, 0x7D, 0x97, 0xE0, 0x99, 0xE1, 0xB9, 0xB1,
-    0x79, 0xC3, 0xF4, 0x61, 0x9F, 0xE8, 0x55, 0x3C, 0x32, 0x2C, 0xC7, 0x20, 0x22, 0xD0, 0x25, 0xBB,
-    0x02, 0xF0, 0xDE, 0x02, 0x08, 0x79, 0x61, 0x81, 0xA0, 0x02, 0x00, 0xCD, 0x01, 0xF0, 0xCB, 0xDD,
-    0xD4, 0x6D, 0x21, 0xA6, 0x90, 0xA4, 0xB7, 0x62, 0x73, 0x85, 0xC3, 0xE4, 0xCF, 0x81, 0x11, 0x1E,
-    0x7C, 0xDA, 0xAD, 0x95, 0x65, 0xE1, 0x9D, 0x3F, 0x1D, 0x9E, 0x6B, 0xCC, 0x0B, 0x18, 0x5F, 0xEF,
-    0xE8, 0x0C, 0x6C, 0x79, 0x50, 0x61, 0xEC, 0x0B, 0x0A, 0x5D, 0x9D, 0x52, 0x18, 0x3B, 0xEE, 0x30,
-    0x87, 0xF0, 0xE5, 0xF4, 0x2A, 0x38, 0x31, 0xFE, 0x10, 0xB8, 0x0A, 0x6F, 0x0B, 0xEE, 0x71, 0x9F,
-    0x47, 0xDA, 0x23, 0xDE, 0x95, 0x23, 0x93, 0xC1, 0x77, 0x1D, 0xC1, 0x2D, 0xF9, 0x53, 0x69, 0x35,
-    0x99, 0xD6, 0x9B, 0x10, 0xA3, 0x58, 0xEB, 0x46, 0xD6, 0xFD, 0xB1, 0x01, 0xA4, 0xA7, 0xAE, 0x21,
-    0xC8, 0x4C, 0x67, 0xE5, 0x8C, 0x7A, 0x9D, 0x4F, 0x59, 0x98, 0x80, 0xDD, 0x1C, 0x10, 0x47, 0xE5,
-    0xF6, 0x04, 0x1C, 0xA9, 0x4F, 0xF9, 0x13, 0x50, 0x00, 0xED, 0x23, 0xDD, 0xEE, 0xA7, 0x58, 0x59,
-    0x08, 0x31, 0xDE, 0x53, 0x5C, 0x8B, 0xCA, 0xC7, 0xF0, 0x6F, 0xBD, 0xD4, 0x2A, 0xB0, 0x11, 0xD6,
-    0xED, 0xE7, 0xDF, 0x07, 0x17, 0xE6, 0xE0, 0x46, 0x3F, 0x41, 0xFF, 0x58, 0x71, 0x9D, 0x2F, 0x9D,
-    0xC5, 0xC4, 0x4C, 0x0D, 0xE9, 0x02, 0x2A, 0xAD, 0x20, 0xFA, 0x49, 0x6E, 0xE3, 0x76, 0x61, 0x22,
-    0x20, 0xFB, 0x77, 0xAC, 0xE8, 0x6F, 0x43, 0x9C, 0xF7, 0x5A, 0x77, 0xD3, 0xAF, 0x5F, 0xCF, 0xF5,
-    0x24, 0x85, 0x1E, 0x48, 0x59, 0x4B, 0x54, 0x48, 0x86, 0xE5, 0x37, 0x49, 0x2C, 0x13, 0x8A, 0x71,
-    0x27, 0x1F, 0xC3, 0x92, 0xFD, 0x81, 0xBC, 0xBA, 0x25, 0x12, 0xD5, 0x88, 0x57, 0x95, 0xD9, 0x0C,
-    0x70, 0x61, 0xAE, 0x3F, 0xDF, 0x50, 0xBA, 0x67, 0xDB, 0x26, 0xE2, 0xC9, 0xD5, 0x95, 0x73, 0xF9,
-    0x1C, 0x64, 0xD9, 0x02, 0xA5, 0xD3, 0x56, 0x60, 0x7E, 0x02, 0x4E, 0x12, 0x5C, 0x20, 0xA8, 0x08,
-    0x4A, 0x0A, 0xB3, 0x82, 0x83, 0x23, 0x22, 0xA1, 0x7C, 0x8C, 0x5A, 0x5A, 0x5E, 0x36, 0x6F, 0x53,
-    0x52, 0x54, 0xA2, 0x92, 0x6A, 0x12, 0x4C, 0x35, 0x06, 0x17, 0x20, 0xE3, 0xD4, 0x77, 0xB7, 0x4D,
-    0xAF, 0xB6, 0x14, 0x65, 0x79, 0xD4, 0x84, 0x60, 0xE2, 0xCC, 0x25, 0x2A, 0xB0, 0xC2, 0xC0, 0xC6,
-    0x08, 0xD4, 0xB9, 0x00, 0x84, 0x93, 0x8C, 0xC1, 0xA9, 0xA4, 0x8C, 0x33, 0xED, 0x01, 0x92, 0xF2,
-    0x87, 0x64, 0x68, 0x8A, 0x14, 0x31, 0x25, 0x6E, 0xF7, 0x24, 0xAC, 0xF8, 0x1A, 0xD9, 0x5A, 0xE9,
-    0x33, 0x6D, 0x8C, 0xFB, 0x0C, 0x97, 0x55, 0x8D, 0x7A, 0xDC, 0xD7, 0xC8, 0x02, 0x61, 0xD9, 0x02,
-    0x0C, 0x15, 0x54, 0x96, 0x56, 0x64, 0xF1, 0xB3, 0x26, 0x4B, 0xF1, 0x50, 0x91, 0x50, 0x23, 0xB3,
-    0xAA, 0xC2, 0x35, 0x03, 0x91, 0x17, 0x95, 0x71, 0x12, 0x56, 0xA1, 0x30, 0x3D, 0xD6, 0x53, 0x45,
-    0xD4, 0x5D, 0xE8, 0x1B, 0x03, 0xFA, 0x1E, 0x56, 0x4B, 0x91, 0x0A, 0x21, 0x32, 0x94, 0xDF, 0xEC,
-    0x55, 0x7E, 0x7D, 0x10, 0xFF, 0xC7, 0x38, 0x17, 0x7D, 0xA6, 0x73, 0x8F, 0x04, 0xFE, 0x0D, 0x88,
-    0x85, 0x50, 0x5D, 0xA2, 0xF5, 0x44, 0xF9, 0x49, 0xED, 0xE9, 0x2C, 0x27, 0x4F, 0x5A, 0x1C, 0x3D,
-    0x39, 0x01, 0x6B, 0x89, 0x16, 0x4A, 0x64, 0x42, 0xB4, 0xFD, 0xD6, 0xE0, 0xD4, 0x46, 0xB0, 0x42,
-    0x50, 0x03, 0x38, 0x15, 0x80, 0x47, 0x60, 0x4A, 0x68, 0x63, 0x93, 0xEF, 0x34, 0xC7, 0x74, 0x12,
-    0x99, 0x6A, 0xD0, 0x0C, 0x90, 0x06, 0xDD, 0x1C, 0x06, 0x64, 0x6E, 0x61, 0x9E, 0x8E, 0x29, 0xDC,
-    0x9B, 0x05, 0xFE, 0x71, 0x3F, 0x2E, 0x5D, 0x9D, 0xBB, 0xEF, 0x57, 0x5E, 0x9A, 0xBB, 0x3F, 0xAB,
-    0x03, 0x48, 0xAA, 0xF7, 0xDA, 0x5D, 0x80, 0xD7, 0xDA, 0xFD, 0x80, 0x57, 0xBB, 0x05, 0xC0, 0x2B,
-    0x66, 0x1E, 0x30, 0x37, 0x17, 0x08, 0x75, 0x45, 0x98, 0x96, 0x84, 0xA2, 0x19, 0x61, 0xF4, 0x40,
-    0xB4, 0xDD, 0x08, 0x0F, 0xA5, 0x37, 0xD2, 0x36, 0x70, 0x4D, 0x4F, 0xF4, 0x8B, 0xD8, 0x24, 0xFA,
-    0xA3, 0xE2, 0xEE, 0x00, 0x53, 0x2E, 0xDC, 0x6E, 0x31, 0x2D, 0xEE, 0xFD, 0x3D, 0xA2, 0x1F, 0x62,
-    0xF3, 0xAA, 0xE9, 0xED, 0xF2, 0x2E, 0x61, 0x2E, 0xA3, 0x7E, 0xA9, 0xA2, 0x76, 0xE4, 0x75, 0xA0,
-    0x0B, 0xB2, 0x51, 0x27, 0x90, 0x92, 0x69, 0xA6, 0x33, 0x6A, 0xE8, 0x64, 0x33, 0x90, 0x0B, 0xF2,
-    0x15, 0xF9, 0xB2, 0xDC, 0x26, 0x1D, 0xB8, 0xDD, 0x4B, 0x35, 0x11, 0x94, 0x8D, 0x89, 0x87, 0xB6,
-    0x33, 0x24, 0xF5, 0xB6, 0x09, 0xFD, 0x43, 0x14, 0xFA, 0xD7, 0x68, 0x34, 0xAF, 0xAA, 0x39, 0x4E,
-    0x19, 0x84, 0x70, 0x37, 0x29, 0xEB, 0x76, 0x20, 0x50, 0xD8, 0x44, 0x6E, 0xB7, 0x95, 0x7C, 0x3B,
-    0x86, 0x61, 0x56, 0x0F, 0x66, 0xC2, 0x4E, 0xB5, 0xBB, 0x98, 0xB0, 0xD5, 0x78, 0xCE, 0x62, 0xBF,
-    0xA4, 0xE7, 0x7B, 0xAD, 0x5E, 0xF3, 0xEB, 0x40, 0x9D, 0xF4, 0x6B, 0xDF, 0x02, 0xB0, 0xB5, 0x7A,
-    0x14, 0x70, 0xA2, 0x13, 0x23, 0x3A, 0x7F, 0xD2, 0xFA, 0x79, 0xF8, 0xF1, 0x68, 0xFB, 0xA1, 0x23,
-    0x5E, 0x7B, 0x46, 0x7F, 0x61, 0xCD, 0xBA, 0x46, 0x85, 0x75, 0xFC, 0x26, 0x29, 0x23, 0x06, 0x4D,
-    0xE8, 0x2C, 0xCE, 0x48, 0x07, 0x71, 0x16, 0x15, 0x38, 0x97, 0x45, 0xE5, 0x00, 0xE5, 0x8C, 0xBD,
-    0x6A, 0xBF, 0x69, 0xEF, 0xF2, 0xA4, 0x07, 0xDB, 0xDB, 0xD0, 0xB3, 0x7D, 0x8A, 0xB3, 0x78, 0x9C,
-    0x24, 0x72, 0xC5, 0x14, 0x58, 0x00, 0x9D, 0x41, 0x84, 0x1E, 0xE0, 0x64, 0x4E, 0x61, 0x54, 0x59,
-    0x35, 0x3D, 0x0F, 0x5F, 0x54, 0x78, 0x37, 0xD1, 0xE3, 0x46, 0x54, 0xF8, 0x58, 0x7B, 0x57, 0xC0,
-    0xC7, 0x88, 0xD4, 0xED, 0xE5, 0x23, 0x28, 0x98, 0xD2, 0x33, 0x85, 0x69, 0x02, 0x53, 0x3D, 0x09,
-    0x8B, 0xE3, 0x0B, 0x52, 0xB4, 0xB0, 0xCE, 0x65, 0x82, 0xE7, 0x08, 0xF6, 0x11, 0xEC, 0x22, 0x78,
-    0x4A, 0x9B, 0x1F, 0x9B, 0x76, 0xA9, 0xFF, 0xD7, 0xE6, 0x06, 0x8C, 0x89, 0x34, 0xF3, 0xEA, 0x2D,
-    0x00, 0x2F, 0xD0, 0xBC, 0xCF, 0x5C, 0xF3, 0x7D, 0x8A, 0x10, 0x6A, 0xEB, 0x7F, 0xF6, 0x0E, 0x69,
-    0x4A, 0x6D, 0x01, 0x1C, 0xF3, 0x11, 0x27, 0x0C, 0x55, 0xF6, 0xBE, 0xF9, 0xBD, 0xE9, 0xE7, 0xFA,
-    0x3F, 0x33, 0xD7, 0x45, 0x16, 0x98, 0xC4, 0x8A, 0x60, 0x15, 0x16, 0x4F, 0xE0, 0x00, 0xB9, 0xBC,
-    0x6C, 0xBE, 0xD4, 0xB7, 0x48, 0xCE, 0x86, 0xA2, 0xFA, 0x1B, 0x7D, 0x7A, 0x61, 0x9F, 0xBE, 0x36,
-    0x3C, 0x7D, 0xB0, 0xC7, 0xC7, 0x7A, 0xCA, 0x1A, 0xED, 0x1B, 0x0E, 0x3B, 0x69, 0x4C, 0xC1, 0x6B,
-    0x58, 0x85, 0xD3, 0x40, 0xF5, 0x7A, 0x61, 0x02, 0xD4, 0x14, 0x80, 0xF7, 0x4C, 0x75, 0xCC, 0x8F,
-    0x60, 0xDF, 0xB0, 0x84, 0xD8, 0x0A, 0x4B, 0x5C, 0x9A, 0x06, 0x72, 0x2E, 0xCD, 0x9D, 0xF4, 0xB6,
-    0x21, 0xE9, 0xDF, 0x00, 0x43, 0x17, 0x0E, 0x67, 0x0E, 0x91, 0xCF, 0x89, 0xAB, 0x50, 0x7C, 0x0C,
-    0x51, 0x66, 0x77, 0x42, 0x8C, 0x01, 0xB0, 0xD7, 0x25, 0xCF, 0xF8, 0x35, 0x21, 0xAD, 0xB7, 0xBB,
-    0xC3, 0xA0, 0x26, 0xA2, 0xC1, 0xD5, 0xC0, 0x73, 0xEF, 0x10, 0xCD, 0x85, 0x18, 0x5E, 0x5B, 0x1A,
-    0x65, 0xE8, 0x9D, 0x7D, 0x8B, 0x60, 0x6B, 0xB7, 0xFA, 0x0D, 0x26, 0x66, 0xA5, 0xB5, 0x3D, 0x1A,
-    0x78, 0x45, 0x90, 0xCD, 0x79, 0x48, 0xBF, 0x18, 0x9E, 0x14, 0x28, 0x6F, 0xBA, 0xC7, 0x18, 0x86,
-    0xC5, 0x33, 0xE7, 0x36, 0x88, 0xC6, 0x7D, 0xCA, 0x83, 0xDD, 0x11, 0x54, 0xB0, 0x55, 0x0A, 0xD8,
-    0x1E, 0xC9, 0xD8, 0x8F, 0x9E, 0x78, 0x44, 0xB9, 0x0F, 0x95, 0x8A, 0x11, 0xEA, 0x73, 0x8D, 0x35,
-    0x38, 0x69, 0x77, 0x0E, 0x14, 0x0D, 0xD3, 0x86, 0x8C, 0x82, 0x03, 0x55, 0x0D, 0x18, 0x93, 0x33,
-    0x84, 0x88, 0x04, 0xC2, 0xE8, 0xD8, 0xE1, 0x80, 0xD1, 0x0B, 0xFA, 0xC2, 0xE1, 0x60, 0xBF, 0x32,
-    0xDC, 0x30, 0xDC, 0x8E, 0xCE, 0x62, 0x74, 0x36, 0xA2, 0x49, 0xCB, 0x07, 0xFD, 0x55, 0xCB, 0x15,
-    0x08, 0x4D, 0x31, 0x19, 0xC5, 0x4E, 0x71, 0x13, 0x6F, 0x1B, 0x18, 0xE3, 0x50, 0xCD, 0xA3, 0x4E,
-    0xBC, 0xE5, 0x0D, 0x00, 0x7E, 0x2E, 0x70, 0x60, 0xDE, 0xE8, 0x29, 0xD9, 0x7B, 0xAE, 0x39, 0x40,
-    0x7C, 0x1D, 0x20, 0xBD, 0xC2, 0x0B, 0x87, 0xA0, 0xE0, 0x79, 0xAF, 0xCB, 0x7B, 0xC3, 0xC6, 0x83,
-    0xE0, 0x82, 0x04, 0x2A, 0xD5, 0x2B, 0x67, 0x15, 0xAD, 0xAD, 0x00, 0x52, 0x2D, 0xC8, 0xD3, 0xC4,
-    0xC9, 0x52, 0x0A, 0xFB, 0x04, 0x86, 0x44, 0x12, 0xAC, 0x51, 0xCB, 0xA5, 0x09, 0xB4, 0x1E, 0x1A,
-    0xDC, 0x65, 0xC8, 0xBF, 0xE8, 0xB6, 0x2E, 0xFC, 0x3E, 0xAA, 0xD6, 0x11, 0x34, 0x97, 0x51, 0x0D,
-    0x40, 0xDE, 0x89, 0x0D, 0x15, 0xDF, 0xB0, 0x4E, 0xC9, 0x0A, 0xFA, 0xFD, 0x1B, 0xF4, 0x7B, 0x3B,
-    0xD7, 0x8A, 0x32, 0xD2, 0x88, 0xDB, 0x1B, 0x4D, 0x9A, 0xA6, 0x2E, 0x15, 0xD9, 0x9A, 0x26, 0xC1,
-    0x67, 0x18, 0x3E, 0xE9, 0x14, 0x3F, 0x7B, 0x16, 0x8F, 0xD1, 0x11, 0xCE, 0xFC, 0x3A, 0x2A, 0xBD,
-    0x3A, 0xA8, 0x6C, 0x0B, 0x0B, 0xAF, 0xBF, 0x8C, 0x95, 0x31, 0x89, 0xFD, 0xEC, 0xD7, 0x5E, 0x4D,
-    0xE8, 0x57, 0xE1, 0x1A, 0x1C, 0x79, 0xB8, 0xF1, 0x7B, 0x16, 0x17, 0x79, 0x1F, 0xD4, 0x47, 0x88,
-    0xF5, 0xF4, 0x86, 0xE6, 0xA0, 0xA9, 0x4D, 0x8D, 0x2A, 0x26, 0x84, 0x86, 0xD1, 0x50, 0x06, 0x33,
-    0x8B, 0x8B, 0xC7, 0x61, 0xFA, 0xB6, 0x0E, 0x8C, 0x12, 0xC5, 0x56, 0xDA, 0xE6, 0x14, 0xB6, 0x8D,
-    0x72, 0x6B, 0xA6, 0x78, 0x90, 0xEF, 0x3E, 0x30, 0x70, 0x7E, 0x59, 0xFF, 0x03, 0xB8, 0xB3, 0x05,
-    0xE9, 0x5C, 0x02, 0x12, 0x16, 0xD0, 0xF6, 0x83, 0xCF, 0xBE, 0x03, 0xA4, 0x7D, 0x4B, 0x3D, 0x73,
-    0x16, 0xF3, 0xE8, 0x94, 0x5F, 0xA6, 0x70, 0xAD, 0x63, 0x31, 0x6B, 0x00, 0x0B, 0x88, 0xCF, 0x22,
-    0xFE, 0x72, 0x99, 0x66, 0x83, 0x55, 0xA1, 0x85, 0x78, 0xED, 0x99, 0xD7, 0x43, 0xB1, 0xEA, 0xD6,
-    0xCE, 0xFB, 0xD8, 0xE2, 0xB1, 0x45, 0x18, 0x89, 0xE6, 0x96, 0x29, 0x7C, 0x3C, 0xF7, 0x75, 0xE5,
-    0x60, 0x14, 0x18, 0xE8, 0xC5, 0x98, 0xEA, 0xED, 0x40, 0xFC, 0x1E, 0x6F, 0xD6, 0x37, 0x73, 0x89,
-    0x13, 0xD0, 0x26, 0x8F, 0xDF, 0xA7, 0x31, 0x18, 0xBF, 0x07, 0x15, 0xD0, 0xC4, 0x57, 0x3B, 0x52,
-    0x30, 0x30, 0x9B, 0x96, 0xC0, 0x47, 0x61, 0x0E, 0x99, 0x3A, 0xAC, 0x60, 0xCE, 0x82, 0xFD, 0x63,
-    0xB7, 0x3D, 0xE8, 0x74, 0x33, 0x4E, 0xA7, 0x40, 0x5F, 0xE7, 0x61, 0xB4, 0x94, 0x8A, 0x21, 0x01,
-    0xB3, 0x5F, 0x99, 0x03, 0xAA, 0x8F, 0x8F, 0xB4, 0xBE, 0x28, 0xC6, 0x3D, 0x8B, 0x7B, 0x88, 0xC1,
-    0xD8, 0x24, 0x7E, 0x03, 0x39, 0x4E, 0xFC, 0x2A, 0xA2, 0x18, 0x20, 0x22, 0xF8, 0x5F, 0x00, 0x5F,
-    0xFF, 0x12, 0xC0, 0x1C, 0x01, 0x68, 0xE5, 0x2A, 0x00, 0x57, 0x02, 0xC8, 0x0C, 0x3B, 0xB9, 0x77,
-    0xB0, 0x80, 0x56, 0x60, 0xCA, 0xAA, 0x26, 0xC0, 0x58, 0x7B, 0x8A, 0xF3, 0xB9, 0xD5, 0x81, 0x54,
-    0xB6, 0xE7, 0x19, 0xE8, 0xE5, 0x38, 0xFE, 0x69, 0x7D, 0x3C, 0x01, 0xE4, 0x80, 0xEF, 0x2C, 0xA0,
-    0x55, 0x12, 0x00, 0xA3, 0x8E, 0xF5, 0x6E, 0x41, 0xFD, 0xD6, 0x24, 0x15, 0x2C, 0x19, 0xC8, 0x28,
-    0xEC, 0x82, 0x46, 0x9B, 0x51, 0x3F, 0x5E, 0x6A, 0x55, 0x61, 0x01, 0x2A, 0x38, 0x23, 0xD3, 0xAD,
-    0x8C, 0x72, 0x07, 0x6D, 0x54, 0x44, 0xB9, 0x87, 0x06, 0x67, 0x26, 0x87, 0x4F, 0x73, 0xE3, 0xB2,
-    0x63, 0x4D, 0x83, 0x3D, 0xC7, 0x41, 0x29, 0x89, 0xEE, 0x41, 0xE3, 0x10, 0x07, 0x2A, 0xC4, 0x53,
-    0x40, 0xD5, 0x80, 0x69, 0xFE, 0xAF, 0x00, 0x97, 0x8A, 0xBF, 0x01, 0x3C, 0x51, 0xFE, 0x1A, 0xF0,
-    0xC5, 0xAF, 0xAE, 0x01, 0x1E, 0xB9, 0x7D, 0x06, 0xF0, 0x05, 0xF3, 0x02, 0xE0, 0x61, 0xF8, 0x4F,
-    0xF0, 0xA8, 0x3B, 0xBA, 0x02, 0xC5, 0xA5, 0xB9, 0x2E, 0xD1, 0xD5, 0xA9, 0xD8, 0xE4, 0x5B, 0x63,
-    0x63, 0x02, 0xFA, 0xF3, 0x44, 0x84, 0xA9, 0xEF, 0xBC, 0xB0, 0x11, 0x1B, 0x89, 0x25, 0xBA, 0x5E,
-    0xF9, 0x15, 0x85, 0x5E, 0x80, 0xB1, 0x93, 0x10, 0xD8, 0xFC, 0xA1, 0xD9, 0xCF, 0x38, 0x5F, 0x06,
-    0x65, 0x08, 0x8C, 0xA5, 0x34, 0xE4, 0x87, 0xF5, 0xB0, 0x5C, 0x43, 0xB6, 0x91, 0x55, 0xF0, 0xAB,
-    0x07, 0x01, 0xE4, 0x3B, 0x8E, 0x60, 0x55, 0x46, 0xA0, 0x16, 0x93, 0x3F, 0x57, 0xFA, 0xEF, 0x4D,
-    0x11, 0xF4, 0x27, 0x6A, 0x1F, 0xB2, 0x8C, 0xA2, 0xDA, 0xAF, 0x47, 0xAD, 0x5F, 0x8D, 0xBA, 0xA1,
-    0x89, 0xF8, 0xF6, 0x1B, 0xFA, 0x2E, 0xB8, 0x6E, 0x60, 0x75, 0x7E, 0x05, 0x16, 0x07, 0xEF, 0x4C,
-    0x37, 0xF4, 0x87, 0x0E, 0x41, 0x2F, 0xC3, 0x8C, 0x82, 0x2A, 0x4D, 0x28, 0xC6, 0xA3, 0xFC, 0x80,
-    0x1A, 0xB3, 0xCE, 0x74, 0x8B, 0x0A, 0x07, 0xDF, 0xF1, 0x12, 0xB0, 0x11, 0x44, 0x5B, 0x33, 0x9E,
-    0x51, 0x82, 0x09, 0x15, 0xE4, 0x1A, 0x38, 0x1B, 0x6C, 0xE5, 0x96, 0x37, 0x0F, 0xCD, 0xD1, 0x1F,
-    0x49, 0x70, 0x75, 0x71, 0x71, 0xE6, 0xB8, 0xE9, 0x03, 0x46, 0x2F, 0x4A, 0xB0, 0x66, 0xEE, 0x35,
-    0x2E, 0x04, 0xB2, 0x9F, 0x8C, 0x3A, 0x28, 0xDB, 0x1E, 0x76, 0x8E, 0xDE, 0x8F, 0xEF, 0xC3, 0x59,
-    0x8C, 0xEB, 0xC1, 0x6F, 0x05, 0xCF, 0xD0, 0x97, 0x86, 0x93, 0xAF, 0xBC, 0x44, 0x74, 0xF2, 0x2E,
-    0x88, 0xD9, 0xA0, 0xB5, 0x73, 0xB1, 0x7A, 0xDA, 0x88, 0xE4, 0x56, 0x43, 0x94, 0x7E, 0x1D, 0x30,
-    0x48, 0x4A, 0x1B, 0x28, 0xF1, 0x1A, 0x8D, 0x35, 0x2B, 0x35, 0xE8, 0x3F, 0xD7, 0x60, 0xE6, 0x5C,
-    0x8F, 0x04, 0x74, 0x1B, 0x00, 0xB4, 0x46, 0xA1, 0xDD, 0x26, 0xA8, 0x34, 0xD1, 0x69, 0x60, 0x4C,
-    0x2E, 0x89, 0x7F, 0xBC, 0x45, 0xCF, 0x33, 0xEC, 0x19, 0x66, 0x20, 0x10, 0x31, 0x73, 0x3C, 0x36,
-    0x6F, 0x75, 0x7E, 0xE7, 0x96, 0xA3, 0x9E, 0x51, 0x88, 0x17, 0x31, 0xF8, 0xD6, 0x3A, 0xDC, 0xB0,
-    0x1D, 0x55, 0x8C, 0x1E, 0x56, 0x8C, 0x1A, 0x41, 0xCA, 0x78, 0xF0, 0xD4, 0x97, 0xCA, 0xB4, 0x33,
-    0x8D, 0x31, 0x13, 0xA2, 0x84, 0x57, 0x1E, 0x3C, 0x2C, 0x49, 0xAC, 0x9D, 0x5F, 0x13, 0x72, 0xA2,
-    0xC9, 0x1B, 0x49, 0xB8, 0x8F, 0x80, 0xE8, 0x51, 0x2E, 0xC1, 0x48, 0x2D, 0x1E, 0xDF, 0xB3, 0xA8,
-    0xBB, 0xB4, 0x87, 0x6A, 0xDE, 0xF4, 0xEB, 0x75, 0x4B, 0xD5, 0x88, 0x5E, 0xC5, 0x1E, 0x06, 0x0C,
-    0xC6, 0x6D, 0x69, 0x95, 0xA8, 0x22, 0xCF, 0x2F, 0x82, 0xEB, 0x75, 0x67, 0x40, 0x47, 0x61, 0x15,
-    0x17, 0xE0, 0x7C, 0xF0, 0xEB, 0x83, 0x43, 0x5F, 0x20, 0x87, 0xA8, 0x6F, 0x70, 0x8C, 0xA6, 0xDB,
-    0xD6, 0x3E, 0xFF, 0xC1, 0xF6, 0xA9, 0x26, 0x91, 0x4D, 0xF5, 0xAC, 0xC0, 0xBD, 0x02, 0xFF, 0x89,
-    0xC0, 0x1D, 0x7B, 0x68, 0xFB, 0x6B, 0x92, 0xEA, 0x45, 0x7A, 0x04, 0x17, 0xE2, 0x6C, 0x00, 0x2A,
-    0x3E, 0x2B, 0x8E, 0x23, 0xE3, 0x93, 0x7F, 0x85, 0x4E, 0xA8, 0x2F, 0xEF, 0x00, 0x8E, 0xFE, 0x0D,
-    0x85, 0x0E, 0x64, 0x35, 0x16, 0x88, 0xB2, 0x08, 0xFA, 0x19, 0xAA, 0x02, 0x5E, 0x40, 0x4F, 0xA5,
-    0x06, 0xF1, 0x3E, 0xC0, 0x5B, 0x02, 0x61, 0x5A, 0x01, 0xAE, 0xA6, 0x57, 0x78, 0x3E, 0xFC, 0x84,
-    0x30, 0xF8, 0xAD, 0x40, 0xFC, 0x0F, 0x25, 0x79, 0xBD, 0xC3, 0x72, 0xE9, 0xF7, 0x0C, 0xFA, 0xE9,
-    0xD0, 0x0F, 0xFA, 0xB4, 0xF9, 0x85, 0x66, 0x4A, 0x55, 0xDE, 0xA2, 0xCF, 0xD2, 0xB3, 0x17, 0xCC,
-    0x37, 0x1C, 0xAB, 0xE3, 0x12, 0x77, 0x17, 0xB8, 0x37, 0xC7, 0x9D, 0xCA, 0x59, 0xA6, 0x89, 0x09,
-    0x2B, 0x06, 0xBA, 0xE5, 0xA0, 0xEA, 0xD5, 0x53, 0x42, 0x85, 0x68, 0x8B, 0x0C, 0xEA, 0x0F, 0xFF,
-    0xA3, 0xED, 0xC7, 0xB5, 0x03, 0x0E, 0xEC, 0x2F, 0x08, 0xF6, 0x60, 0x50, 0x13, 0x78, 0xE6, 0x2B,
-    0x54, 0xC2, 0x3E, 0xA6, 0xED, 0x37, 0x91, 0x8C, 0x34, 0x4E, 0x34, 0xA0, 0x86, 0x01, 0x02, 0x09,
-    0x4E, 0xC7, 0xA1, 0xA7, 0x9B, 0x45, 0xE3, 0x02, 0xD0, 0x9E, 0x19, 0xAE, 0xA6, 0xB0, 0x99, 0xFD,
-    0x3A, 0xCE, 0x7A, 0x4A, 0xA2, 0x5F, 0xC0, 0x82, 0x36, 0xA3, 0x49, 0x70, 0x1B, 0x5D, 0x1F, 0x87,
-    0xFD, 0x05, 0x02, 0x16, 0xF5, 0x9B, 0x41, 0x11, 0x67, 0x3C, 0x42, 0x12, 0xB2, 0xAF, 0xCC, 0xE9,
-    0xE1, 0x78, 0xB5, 0x71, 0xC6, 0xFB, 0x29, 0x1D, 0xD3, 0x2B, 0xFA, 0xA3, 0xDE, 0xB5, 0x92, 0x7E,
-    0xD4, 0x0E, 0x0E, 0x62, 0x88, 0x51, 0x8E, 0x72, 0xDB, 0xDF, 0x63, 0x28, 0x76, 0xA7, 0x3C, 0xA5,
-    0xDC, 0xAA, 0x43, 0xC3, 0xE7, 0x64, 0xF6, 0xB1, 0xFB, 0x4B, 0x29, 0x80, 0x86, 0x15, 0x4A, 0x81,
-    0xB9, 0xB9, 0xD5, 0x63, 0xC3, 0x8A, 0xC1, 0x74, 0xBD, 0x6D, 0x4A, 0xAF, 0x0F, 0x2B, 0xAF, 0xF5,
-    0x27, 0x46, 0xD2, 0x56, 0xBF, 0x61, 0x07, 0xFC, 0x51, 0xC7, 0x5A, 0x73, 0x68, 0xE0, 0x34, 0xFA,
-    0x0B, 0x5C, 0x9A, 0x77, 0xEC, 0x18, 0x19, 0xA5, 0xA7, 0x94, 0x23, 0x23, 0xCF, 0x8F, 0xD1, 0xFA,
-    0x68, 0x46, 0xD6, 0xBA, 0x44, 0x8F, 0x07, 0x89, 0xFE, 0x2F, 0xAC, 0x00, 0xFE, 0x39, 0xE3, 0xAD,
-    0xF9, 0x3D, 0x25, 0x3A, 0x68, 0xC4, 0x37, 0x55, 0x74, 0xA8, 0x89, 0x15, 0x56, 0x8B, 0xC1, 0xC3,
-    0xD0, 0xE4, 0x1E, 0x26, 0x9E, 0xB6, 0x3B, 0x46, 0xED, 0x82, 0x6A, 0x0F, 0xA8, 0x36, 0x3E, 0x5C,
-    0xFB, 0x63, 0x63, 0xD9, 0xAB, 0x28, 0xE2, 0x38, 0xA7, 0xC4, 0xDA, 0x55, 0x4A, 0x53, 0x67, 0x2A,
-    0xEF, 0x2E, 0x7F, 0x3E, 0x95, 0xA9, 0xD0, 0xBE, 0x52, 0xA7, 0x63, 0xA5, 0xE3, 0x04, 0x70, 0xC7,
-    0x8E, 0x87, 0xBD, 0xD7, 0x69, 0xDD, 0x0E, 0xA4, 0x83, 0xF5, 0x9D, 0x39, 0x1E, 0x75, 0x30, 0xD0,
-    0xEF, 0xF2, 0x3B, 0x62, 0xF4, 0xB4, 0x59, 0x2A, 0x2F, 0x27, 0x34, 0x47, 0x24, 0xEC, 0xCA, 0x75,
-    0xA5, 0xE5, 0x79, 0x27, 0xFC, 0x48, 0x20, 0x65, 0x42, 0x19, 0xFF, 0xA2, 0x17, 0x7B, 0x50, 0xC3,
-    0xE7, 0xA7, 0x35, 0xEE, 0x15, 0xB4, 0xC7, 0x19, 0x63, 0x35, 0x58, 0x32, 0xFD, 0x9B, 0x4E, 0x5D,
-    0x1E, 0x99, 0x09, 0xF9, 0x8B, 0x0C, 0xB7, 0x42, 0xDC, 0x4A, 0x71, 0x2B, 0xA3, 0x37, 0x42, 0x48,
-    0xAB, 0x55, 0xE5, 0x41, 0x74, 0xC1, 0x76, 0xC7, 0x99, 0xA8, 0x20, 0x24, 0x93, 0x13, 0xFA, 0x72,
-    0x06, 0x8C, 0x85, 0xAB, 0xEC, 0x67, 0x95, 0x88, 0xB0, 0x74, 0x67, 0x03, 0x34, 0x9A, 0x51, 0xA4,
-    0xA5, 0xB5, 0xB7, 0xED, 0x5A, 0x0B, 0xF1, 0xC1, 0x74, 0xC3, 0x1A, 0x78, 0x1D, 0xB4, 0xA3, 0x07,
-    0x5D, 0x75, 0x7F, 0x85, 0x41, 0xE4, 0xF9, 0xB4, 0x21, 0x8E, 0x9A, 0xB1, 0xAF, 0x65, 0x93, 0xB6,
-    0xA3, 0x7A, 0x92, 0xB4, 0x7D, 0x54, 0x5B, 0x6F, 0xC8, 0xEE, 0x48, 0x38, 0x8E, 0x3D, 0xF9, 0xA4,
-    0x0E, 0xA7, 0xDA, 0x56, 0x3B, 0x74, 0x30, 0x75, 0x95, 0x53, 0x07, 0x99, 0x22, 0x87, 0xCE, 0x59,
-    0x8A, 0x7D, 0x12, 0xB6, 0xC4, 0x63, 0xAA, 0xE5, 0xD5, 0x21, 0xB9, 0x28, 0x6B, 0xE7, 0x92, 0x4E,
-    0x46, 0x44, 0x88, 0x15, 0x6F, 0xEB, 0x59, 0x68, 0x71, 0xEA, 0x31, 0xBB, 0x5A, 0x9C, 0xDC, 0xB7,
-    0x18, 0x5F, 0x8E, 0x19, 0x48, 0x84, 0x6B, 0x97, 0x01, 0xA7, 0x3A, 0x09, 0x98, 0xCD, 0x48, 0xB3,
-    0x80, 0xD9, 0x21, 0x18, 0x95, 0x8C, 0x59, 0xC5, 0x45, 0x40, 0xE6, 0x8D, 0xCB, 0x7D, 0x3C, 0xE8,
-    0xEA, 0x00, 0xD9, 0xD8, 0x54, 0x0B, 0xE8, 0xED, 0xD3, 0x5F, 0x55, 0x2B, 0x98, 0xC6, 0xAF, 0xDF,
-    0xAB, 0x39, 0xC9, 0xAF, 0xCF, 0xAC, 0x15, 0x8C, 0xEA, 0xB8, 0xC4, 0x9C, 0xD7, 0x8F, 0x8C, 0x44,
-    0xE8, 0x9C, 0xDE, 0x8A, 0x1A, 0xCC, 0xF5, 0xDB, 0xC9, 0x9E, 0x64, 0x67, 0xA2, 0x61, 0xA3, 0x06,
-    0xF9, 0x89, 0x3A, 0x80, 0x1B, 0xE4, 0x36, 0x7E, 0xE9, 0x16, 0xA3, 0xD6, 0x03, 0x16, 0x55, 0xE7,
-    0xD6, 0x80, 0xFD, 0xA8, 0x01, 0x69, 0xC0, 0x4C, 0xF2, 0x13, 0x95, 0xBA, 0xC4, 0x68, 0xFC, 0xE2,
-    0x65, 0x28, 0xD9, 0xE8, 0xAF, 0xD3, 0x79, 0x12, 0x68, 0x2C, 0xC2, 0x8C, 0x61, 0xB2, 0x20, 0x87,
-    0xE4, 0x92, 0x98, 0x9B, 0xC3, 0x9C, 0xAE, 0x08, 0x98, 0x57, 0xF4, 0x97, 0x19, 0x51, 0x51, 0xA8,
-    0x95, 0xF8, 0x6A, 0xA9, 0xC4, 0x3A, 0x94, 0x0B, 0x10, 0x43, 0xF8, 0x4E, 0xFC, 0x1B, 0xA3, 0xC6,
-    0x81, 0xDE, 0x98, 0x62, 0x09, 0xFD, 0x8C, 0x41, 0x2E, 0x17, 0x1C, 0xFD, 0x0B, 0x89, 0xED, 0xDD,
-    0x10, 0x86, 0x08, 0x07, 0x39, 0x37, 0xDD, 0xC8, 0x19, 0x2F, 0x41, 0x26, 0x6F, 0x38, 0xDF, 0xFF,
-    0x14, 0x13, 0x87, 0xB6, 0x86, 0x06, 0x25, 0xE1, 0xDB, 0xDF, 0xA0, 0x0A, 0x57, 0x75, 0xA1, 0x27,
-    0x39, 0x68, 0x86, 0x1A, 0x28, 0xF5, 0xE6, 0xFA, 0x04, 0x7C, 0xC7, 0x4C, 0x0F, 0xDC, 0xEE, 0x0C,
-    0xB8, 0xE9, 0x55, 0x84, 0x03, 0xA4, 0xCB, 0x3E, 0x60, 0x4A, 0x82, 0x9A, 0x6E, 0xE3, 0x4D, 0x1F,
-    0x8C, 0xB1, 0xA9, 0xB2, 0x97, 0xBA, 0x45, 0x39, 0xD9, 0x4C, 0x7F, 0x65, 0xB8, 0x41, 0xB2, 0xE5,
-    0xE8, 0x0C, 0x96, 0x04, 0x23, 0x71, 0x3A, 0xF3, 0x32, 0x78, 0x22, 0x11, 0x03, 0xB7, 0x26, 0x1F,
-    0xAD, 0xC7, 0x3C, 0x40, 0x67, 0xCF, 0xBC, 0x83, 0x59, 0x38, 0x74, 0xE8, 0x1B, 0x7A, 0x0B, 0x7E,
-    0x15, 0x94, 0x31, 0x60, 0x58, 0x3C, 0xA7, 0x08, 0x31, 0x9F, 0x35, 0xFD, 0xE5, 0x59, 0xCE, 0x08,
-    0x22, 0x87, 0x82, 0x42, 0x8D, 0xCF, 0x57, 0x24, 0x65, 0x1F, 0x73, 0x74, 0x93, 0xB0, 0x73, 0x21,
-    0xC5, 0xB5, 0x19, 0xEB, 0x2D, 0x35, 0xA8, 0x55, 0x87, 0xD2, 0x72, 0x44, 0x1A, 0x70, 0xE9, 0xCC,
-    0x7A, 0x27, 0xB8, 0x54, 0x54, 0x3F, 0xBB, 0x48, 0xEB, 0xCF, 0x72, 0xEC, 0x31, 0x17, 0xED, 0x3F,
-    0xAE, 0x61, 0xC0, 0x5F, 0xD5, 0x3D, 0x01, 0xCC, 0xD4, 0x0F, 0xEA, 0x34, 0x73, 0xAF, 0x82, 0xCB,
-    0xBD, 0x37, 0xEB, 0xA8, 0x08, 0x0E, 0xC3, 0x1E, 0x59, 0xBA, 0x5A, 0xA7, 0xAB, 0xE6, 0xD3, 0x1A,
-    0xCF, 0x98, 0x61, 0x0E, 0x2D, 0x10, 0x11, 0xC5, 0x89, 0x1C, 0xE4, 0x23, 0x4F, 0x91, 0xB2, 0x2E,
-    0xF0, 0x91, 0x10, 0x62, 0xCC, 0x6F, 0xE6, 0xCA, 0xFD, 0xF8, 0x2D, 0x48, 0xA8, 0x13, 0x3F, 0x81,
-    0x8A, 0x08, 0x7F, 0x54, 0xAB, 0x7D, 0x21, 0x7C, 0xB4, 0x34, 0xFC, 0x71, 0xAF, 0xCC, 0x5B, 0x3F,
-    0x91, 0x0C, 0x96, 0xE2, 0x2C, 0x24, 0x0B, 0x58, 0xDA, 0xF0, 0x50, 0x5A, 0x59, 0x45, 0xF8, 0xB7,
-    0xB5, 0x3D, 0xFE, 0xAE, 0x95, 0xA3, 0xF3, 0xA9, 0x3D, 0xBA, 0x0C, 0xAD, 0xE0, 0xE8, 0xE5, 0x66,
-    0x58, 0x06, 0xCC, 0xCE, 0xED, 0x16, 0x97, 0x34, 0x73, 0x36, 0x8D, 0xDA, 0x97, 0xC6, 0x72, 0x5C,
-    0x48, 0x99, 0xCF, 0xE4, 0x11, 0x33, 0xC5, 0x71, 0x25, 0x05, 0x59, 0xE0, 0x58, 0xA5, 0x1E, 0x63,
-    0x4A, 0x4E, 0x95, 0xB2, 0x86, 0xA2, 0x3B, 0x52, 0xA7, 0xBE, 0x49, 0x52, 0x73, 0xB3, 0x4D, 0x43,
-    0xFA, 0x87, 0xCC, 0x99, 0x63, 0x76, 0x51, 0x49, 0x8B, 0x1D, 0x94, 0x0D, 0x0C, 0xFD, 0xAD, 0xE8,
-    0x36, 0x0C, 0xC3, 0xAF, 0x1C, 0xD8, 0x70, 0xFE, 0xDA, 0xB9, 0x2F, 0x8D, 0xAC, 0x04, 0x64, 0x59,
-    0xE5, 0xC7, 0xF4, 0xF8, 0x76, 0xC5, 0xB0, 0x4C, 0xAB, 0xFD, 0x31, 0x2C, 0xB5, 0x6A, 0x21, 0x06,
-    0x95, 0x55, 0xEF, 0xC6, 0x61, 0xA7, 0xBF, 0x32, 0x31, 0xC4, 0x87, 0x11, 0x7D, 0x63, 0x21, 0x7C,
-    0xF3, 0x15, 0x51, 0xBA, 0xA5, 0x98, 0x19, 0x52, 0xDC, 0xC0, 0xD8, 0xA2, 0xD3, 0x8B, 0xED, 0xAA,
-    0x2F, 0x4A, 0xD8, 0x99, 0x4B, 0x95, 0xDE, 0xBC, 0x09, 0x04, 0x98, 0x00, 0x9E, 0xAD, 0xD3, 0x05,
-    0x57, 0x98, 0x7B, 0x0A, 0x72, 0x4A, 0x5E, 0x86, 0x8C, 0xB0, 0xEA, 0xB0, 0xAF, 0xE0, 0x5D, 0xC2,
-    0x8E, 0x49, 0xF3, 0xA5, 0x1B, 0x01, 0xE4, 0xB1, 0x61, 0x8A, 0x10, 0xDE, 0x25, 0x8B, 0x0E, 0x18,
-    0xC6, 0x5F, 0x3C, 0x41, 0x41, 0x7C, 0x80, 0xB2, 0x0E, 0x8F, 0xF4, 0x7E, 0x4F, 0x34, 0x83, 0x89,
-    0x78, 0x15, 0x78, 0xE8, 0xB1, 0xAC, 0x75, 0x0F, 0x4F, 0xA8, 0xEA, 0xD1, 0x4D, 0x61, 0xFC, 0x2A,
-    0xBD, 0x6A, 0xCE, 0x74, 0xBD, 0x67, 0x72, 0x9D, 0xB2, 0xAC, 0x84, 0x83, 0x20, 0x5B, 0x58, 0x3A,
-    0x67, 0x29, 0x10, 0x85, 0xA4, 0x2B, 0x85, 0x17, 0x0B, 0x76, 0x45, 0x7A, 0xCE, 0x85, 0x4B, 0xA4,
-    0x99, 0x13, 0xE0, 0x3F, 0xF1, 0xB5, 0x7C, 0xB0, 0x62, 0xCC, 0x98, 0x49, 0xA4, 0xB8, 0xA3, 0x5B,
-    0x3C, 0x71, 0xBB, 0xB7, 0xEB, 0x16, 0x7E, 0xD0, 0xB0, 0xDC, 0x04, 0xC8, 0xBD, 0xDA, 0xD8, 0x95,
-    0x4A, 0x0F, 0x37, 0xA0, 0x01, 0xF2, 0xC9, 0xA8, 0xB1, 0x6B, 0x05, 0x89, 0xE3, 0x33, 0x47, 0x37,
-    0x6A, 0x47, 0x0D, 0x3E, 0xCE, 0x75, 0x47, 0x1B, 0x8F, 0xB5, 0x25, 0x58, 0xA6, 0x52, 0x42, 0xF8,
-    0x7B, 0x16, 0x1D, 0xEB, 0x47, 0xF3, 0x11, 0x58, 0x29, 0xA7, 0x5F, 0xFC, 0x0F, 0x5C, 0x24, 0xAD,
-    0x4E, 0xF1, 0x10, 0x5D, 0x91, 0x85, 0x0B, 0x7E, 0x97, 0x63, 0xB5, 0x96, 0x99, 0x53, 0x96, 0xE5,
-    0xA2, 0xC7, 0xEE, 0xFD, 0xB6, 0x15, 0xF4, 0x7D, 0xD2, 0x72, 0xDD, 0xC2, 0xEB, 0x2D, 0x17, 0x2E,
-    0xBE, 0xD2, 0xC1, 0x4F, 0xAF, 0xF4, 0x11, 0x73, 0xB4, 0xD1, 0x5F, 0xC1, 0x38, 0x7F, 0x53, 0xBC,
-    0x0A, 0x2F, 0xEF, 0xD4, 0xE8, 0x77, 0x5F, 0x48, 0x32, 0x66, 0x27, 0xE6, 0x11, 0x7D, 0x0E, 0xCE,
-    0x65, 0xBA, 0x0A, 0x72, 0xE9, 0xA0, 0xB5, 0xA0, 0x32, 0x89, 0x17, 0x33, 0x55, 0xCE, 0x18, 0xCF,
-    0xB9, 0x7E, 0x48, 0x3C, 0x48, 0x21, 0x11, 0x70, 0x42, 0xDA, 0xE6, 0xFF, 0x38, 0xF7, 0x12, 0xAC,
-    0x66, 0x7C, 0x27, 0x4E, 0x18, 0xAC, 0x9B, 0x41, 0xD3, 0x79, 0x7C, 0xD3, 0x14, 0x3B, 0xD7, 0x8E,
-    0xE0, 0xFB, 0x8E, 0xDA, 0xA9, 0x76, 0x2B, 0x17, 0xD4, 0xA5, 0xBE, 0xFE, 0x08, 0x4B, 0xC4, 0x01,
-    0xB7, 0x2A, 0x7C, 0x03, 0xF7, 0x24, 0x60, 0x35, 0xA6, 0x0B, 0x69, 0x24, 0xD3, 0xDC, 0x38, 0x4F,
-    0x6E, 0xEB, 0x07, 0xCE, 0xD6, 0x56, 0xE3, 0xBE, 0x04, 0xAA, 0xC4, 0x3D, 0xEC, 0x9B, 0xE9, 0xE5,
-    0x03, 0x50, 0x22, 0xD1, 0x79, 0x68, 0xE8, 0x55, 0x1B, 0xB6, 0xD6, 0x95, 0x31, 0x41, 0xBF, 0x54,
-    0x2D, 0xF5, 0xC1, 0xAA, 0x4F, 0xBF, 0xAF, 0xBC, 0x1B, 0xF4, 0x08, 0x0B, 0x97, 0x72, 0xB2, 0xA0,
-    0xF7, 0x1B, 0x41, 0xFA, 0x07, 0x55, 0xCA, 0xF8, 0xA6, 0x24, 0x6B, 0x97, 0x56, 0x93, 0x3B, 0x8B,
-    0x63, 0x04, 0x2E, 0xAD, 0xDA, 0xCA, 0x0E, 0xC2, 0xF9, 0xAD, 0xC1, 0x9E, 0x63, 0xF3, 0xBB, 0x55,
-    0x5A, 0xCE, 0x1F, 0x84, 0x09, 0x3E, 0x1F, 0x29, 0xAF, 0x9C, 0x0F, 0x08, 0xFC, 0x04, 0xC0, 0x23,
-    0x70, 0x27, 0xFF, 0xC1, 0xC2, 0xAD, 0xE6, 0x7D, 0x98, 0xEF, 0xF3, 0xBB, 0xD4, 0xA8, 0x99, 0x07,
-    0xB5, 0x99, 0xCB, 0xB5, 0x64, 0xCF, 0xEE, 0xDE, 0xFD, 0xC4, 0x60, 0xE6, 0xF7, 0x98, 0x6A, 0x3C,
-    0x4F, 0x55, 0x3C, 0x62, 0x26, 0xD8, 0xA6, 0x1A, 0x19, 0x4F, 0xB5, 0xC9, 0x44, 0x28, 0x95, 0xB7,
-    0x60, 0xEF, 0x6B, 0xB3, 0x9A, 0x16, 0xFA, 0x3A, 0x74, 0x84, 0xCE, 0x9E, 0x49, 0xED, 0x05, 0xAB,
-    0x81, 0xF8, 0x65, 0xB9, 0x0D, 0x0C, 0x0F, 0x0A, 0xE8, 0x99, 0x6A, 0x5C, 0x1A, 0x07, 0xDA, 0x18,
-    0xBD, 0xE5, 0xE2, 0x44, 0x05, 0xC8, 0x20, 0x63, 0x2C, 0x95, 0x36, 0x62, 0x94, 0x9B, 0x3E, 0x2D,
-    0x0C, 0x16, 0xD4, 0x38, 0x4B, 0x05, 0x3F, 0xF3, 0x3C, 0xED, 0xC6, 0xE9, 0x48, 0x2B, 0x10, 0xE4,
-    0x55, 0xE9, 0x2A, 0x24, 0x26, 0xD0, 0x76, 0xF0, 0x22, 0x04, 0xD2, 0xA9, 0x59, 0x8A, 0x24, 0x9B,
-    0x93, 0x86, 0x05, 0x8B, 0xF5, 0xED, 0x69, 0x21, 0x18, 0x4A, 0x06, 0xFD, 0x02, 0xF3, 0x7F, 0x3F,
-    0x66, 0x69, 0xC0, 0xFB, 0x14, 0xB3, 0x7F, 0x47, 0x74, 0x93, 0x30, 0x69, 0xA5, 0x28, 0xAB, 0x71,
-    0xD8, 0x2F, 0xEB, 0x6C, 0xC0, 0x0C, 0x7F, 0xA4, 0x40, 0xE0, 0x06, 0xD6, 0xCD, 0xE8, 0xB6, 0x15,
-    0x2D, 0x30, 0xA0, 0xC8, 0x68, 0x01, 0x69, 0x07, 0xC0, 0xE9, 0xE8, 0x18, 0x9B, 0xFD, 0x24, 0x08,
-    0x56, 0xAE, 0xC4, 0xA7, 0x08, 0xA4, 0x26, 0x49, 0x2A, 0xFF, 0xC6, 0xA6, 0xEC, 0xA8, 0xE1, 0x33,
-    0x2E, 0xC5, 0xC4, 0x24, 0x8C, 0x0F, 0xE5, 0x1F, 0xCE, 0xD5, 0x13, 0x1E, 0xBD, 0x0D, 0xDD, 0xBC,
-    0x47, 0x1B, 0xF9, 0x13, 0x9C, 0x73, 0xEA, 0x4B, 0x5C, 0xCF, 0x7D, 0xC3, 0x85, 0x6D, 0x9C, 0x9B,
-    0xD0, 0xEA, 0x90, 0xB7, 0xE8, 0xCF, 0x8B, 0xFB, 0x42, 0xB7, 0x4D, 0x0C, 0xB1, 0x42, 0xDC, 0x50,
-    0x92, 0x4A, 0x2F, 0x91, 0x1C, 0x88, 0xD0, 0xD8, 0xBC, 0xC8, 0x68, 0xAA, 0xF1, 0x5B, 0xA7, 0x86,
-    0x85, 0x62, 0x5E, 0x68, 0x9D, 0x12, 0x47, 0x7D, 0xB8, 0x1D, 0x15, 0x3C, 0x26, 0xBD, 0x4B, 0xCB,
-    0x05, 0xB2, 0xD7, 0xCD, 0x52, 0xB1, 0xD3, 0x8E, 0xF2, 0x7E, 0xD0, 0xDB, 0x4F, 0xA4, 0x1F, 0x15,
-    0xFD, 0x1F, 0xDB, 0x6F, 0x40, 0xE5, 0x01, 0x5C, 0xF9, 0x2D, 0x93, 0xE0, 0xA5, 0xF5, 0x24, 0x99,
-    0x80, 0x19, 0x26, 0xEF, 0x0E, 0x03, 0x74, 0x07, 0x54, 0x07, 0xC3, 0x31, 0xB2, 0x76, 0xCA, 0xCE,
-    0x6E, 0x38, 0x4D, 0xA3, 0xEA, 0x95, 0x8C, 0xC3, 0xF3, 0x59, 0x1C, 0x14, 0x40, 0x7A, 0x99, 0xA0,
-    0x76, 0xE1, 0x63, 0xC3, 0xCB, 0x77, 0x49, 0x73, 0xD7, 0x1A, 0x97, 0x81, 0xFE, 0xAB, 0xAD, 0x07,
-    0xC1, 0x01, 0x07, 0xDF, 0x57, 0x12, 0xFE, 0x0F, 0x84, 0x09, 0xD2, 0xBD, 0x8A, 0xB2, 0x2B, 0xFE,
-    0x6B, 0x31, 0x73, 0x22, 0xA6, 0x40, 0x52, 0xEA, 0xF0, 0xE0, 0x73, 0xC6, 0xB2, 0x85, 0x4C, 0x3D,
-    0x3B, 0x12, 0xCF, 0x0E, 0xC0, 0xB7, 0x87, 0xD0, 0x0E, 0xE3, 0xB4, 0xFD, 0xD0, 0x8E, 0xFD, 0x69,
-    0xFC, 0xCC, 0x8E, 0xAB, 0x9F, 0x22, 0xC8, 0x1F, 0x87, 0x2A, 0xCE, 0xAF, 0x57, 0x98, 0xD7, 0xB3,
-    0x7C, 0x04, 0xCF, 0x33, 0x67, 0x50, 0x91, 0x00, 0x88, 0xB2, 0xA0, 0x9E, 0x80, 0x2A, 0xCD, 0x24,
-    0x86, 0x6E, 0x41, 0x58, 0xC8, 0x6D, 0x7E, 0xFD, 0x8E, 0x4E, 0x46, 0x12, 0xD8, 0x89, 0xE8, 0x61,
-    0x4A, 0xF7, 0xEA, 0x65, 0xB4, 0x6F, 0x53, 0xBA, 0x16, 0x92, 0x3B, 0x89, 0xFE, 0x77, 0x0A, 0xDE,
-    0x0B, 0x73, 0x0C, 0xBF, 0xD4, 0xB8, 0xDD, 0x4C, 0x35, 0x7C, 0x2E, 0x25, 0x8C, 0x09, 0xE5, 0x18,
-    0x18, 0x2D, 0x19, 0x2A, 0x99, 0x82, 0x94, 0x59, 0xCE, 0xD8, 0xB9, 0x44, 0xAB, 0x83, 0xFD, 0x27,
-    0x2B, 0x70, 0x21, 0xB4, 0x0B, 0x31, 0x2C, 0x87, 0xE5, 0x56, 0xF5, 0x27, 0x36, 0x9A, 0x50, 0x4C,
-    0x11, 0x8F, 0x6E, 0x98, 0xD3, 0xF6, 0xD6, 0x7A, 0x1F, 0xB6, 0x12, 0x1E, 0x13, 0x08, 0xAF, 0xB3,
-    0x8C, 0x13, 0x12, 0x65, 0x81, 0x99, 0x0B, 0xC9, 0x3B, 0x47, 0x92, 0xD7, 0x87, 0x15, 0xA1, 0xA7,
-    0x0E, 0xE1, 0x86, 0x43, 0x54, 0x0E, 0x5F, 0x91, 0x1B, 0x62, 0x22, 0xEA, 0x6D, 0xC5, 0x02, 0x1E,
-    0x0C, 0x42, 0x67, 0x2C, 0x36, 0x70, 0x98, 0x19, 0xD4, 0x27, 0x6E, 0xB2, 0x0E, 0xB5, 0x9B, 0x8A,
-    0xB4, 0x28, 0x25, 0xA5, 0x74, 0xAE, 0xF9, 0x8C, 0x0B, 0x75, 0x53, 0x32, 0xD5, 0x33, 0x7A, 0x3D,
-    0x67, 0xE9, 0xCB, 0x0C, 0x3D, 0x35, 0xAE, 0x4E, 0x1B, 0xCB, 0xAD, 0xE4, 0xDB, 0xCC, 0x3B, 0x95,
-    0x1A, 0x4A, 0xE5, 0x5A, 0xD5, 0x46, 0x59, 0x7C, 0xB8, 0x82, 0x8B, 0x97, 0x3A, 0xD9, 0x3F, 0x27,
-    0x0E, 0x95, 0x60, 0xEF, 0x4E, 0x28, 0xE7, 0x81, 0xCD, 0x6F, 0xCB, 0x52, 0x86, 0x98, 0x64, 0xB0,
-    0x66, 0xD6, 0x60, 0x1C, 0xA2, 0x9F, 0xF5, 0x9C, 0x9D, 0xB6, 0xF2, 0xED, 0x5F, 0xFE, 0xC5, 0x05,
-    0xA1, 0x89, 0xD9, 0xD9, 0x7F, 0x24, 0xEE, 0x8D, 0xFA, 0xF6, 0xF2, 0x32, 0x27, 0x70, 0xFE, 0xBF,
-    0x73, 0xE1, 0x77, 0x7C, 0x6B, 0x3C, 0xAA, 0x27, 0xE1, 0xF6, 0x8C, 0x0B, 0x3C, 0x1C, 0x68, 0x1E,
-    0xAF, 0x86, 0x68, 0x2A, 0x47, 0x0D, 0x13, 0x1C, 0x34, 0x13, 0xA4, 0xC8, 0xE3, 0x8E, 0x96, 0x8E,
-    0x23, 0xE2, 0x85, 0x15, 0x52, 0x0C, 0x03, 0x8E, 0xA8, 0x41, 0xA3, 0xF5, 0x10, 0xDE, 0xA4, 0x31,
-    0x7A, 0xCD, 0xB4, 0xF2, 0x72, 0x06, 0xBE, 0x8F, 0xAE, 0xB6, 0x71, 0xD2, 0x6A, 0x55, 0xEB, 0xA9,
-    0x6A, 0x5E, 0x2D, 0xAE, 0x3C, 0xB9, 0x68, 0xAD, 0xF4, 0x98, 0x06, 0x2D, 0x29, 0xF5, 0xA6, 0xFF,
-    0xD4, 0xB7, 0x6C, 0x84, 0xF4, 0x2C, 0x10, 0xD9, 0xD0, 0x08, 0xAD, 0x86, 0xC8, 0x11, 0xD4, 0x65,
-    0xE0, 0x67, 0x27, 0x71, 0x29, 0x7D, 0xCD, 0x3A, 0x4F, 0x74, 0xE6, 0xDD, 0x8F, 0x0B, 0xE5, 0xBF,
-    0x99, 0x4B, 0xE6, 0xFB, 0xA9, 0x29, 0x0E, 0x18, 0x95, 0xA9, 0x29, 0x2F, 0x2F, 0x67, 0x27, 0xC1,
-    0x19, 0x3A, 0x39, 0x6F, 0x72, 0xF3, 0x79, 0xF9, 0x5F, 0xD5, 0xDB, 0xBB, 0x5F, 0x3B, 0x39, 0xFF,
-    0xD4, 0xEE, 0x03, 0x7B, 0xF7, 0xBF, 0x0C, 0xE7, 0x36, 0xE8, 0xD5, 0x41, 0xDD, 0x2E, 0x38, 0x14,
-    0xE3, 0x3B, 0xC7, 0x25, 0x3A, 0x03, 0x53, 0x9D, 0xDC, 0x6F, 0x8F, 0xB3, 0xDF, 0xDA, 0x90, 0xF2,
-    0xCD, 0xAC, 0xF1, 0xBF, 0x46, 0xBB, 0xF8, 0xBC, 0x1A, 0x65, 0xAF, 0x2A, 0xF5, 0x07, 0x6E, 0xA2,
-    0xEE, 0xF3, 0xE3, 0x24, 0x16, 0x86, 0x56, 0x84, 0xD7, 0x7F, 0xFA, 0x1A, 0x8F, 0x7F, 0xFA, 0xEF,
-    0x5E, 0xFE, 0x03, 0x1E, 0xBF, 0xFB, 0xD4, 0xFD, 0xEE, 0x87, 0x69, 0x85, 0x1F, 0x78, 0x32, 0x3A,
-    0x97, 0x02, 0x16, 0xE7, 0xE7, 0xF4, 0x8A, 0x5E, 0x42, 0x8F, 0xDF, 0x05, 0xBE, 0x46, 0xD3, 0xDF,
-    0x0C, 0x07, 0xFE, 0x3B, 0x38, 0x90, 0xFD, 0xAB, 0xDF, 0xD9, 0xD8, 0xD3, 0x68, 0x18, 0xAC, 0x37,
-    0x1C, 0xFD, 0x64, 0xBA, 0x72, 0xE0, 0x4F, 0x06, 0xDE, 0x9C, 0x67, 0x29, 0xC7, 0xCB, 0xD6, 0x4C,
-    0x23, 0xF2, 0xC3, 0x21, 0x5A, 0x42, 0x45, 0x7B, 0x60, 0xC2, 0xB5, 0x77, 0xFD, 0x49, 0x06, 0x68,
-    0xCE, 0xDA, 0xD2, 0x90, 0x48, 0x06, 0xA5, 0x4B, 0x47, 0x76, 0x21, 0xCC, 0x5C, 0x50, 0x0F, 0xF2,
-    0x43, 0xC4, 0xBB, 0x99, 0x2D, 0x2A, 0x11, 0x43, 0x95, 0xEE, 0x07, 0xE4, 0xA2, 0x8F, 0x73, 0x05,
-    0x46, 0x62, 0x95, 0x50, 0xA0, 0x9C, 0x7C, 0xAA, 0xF2, 0x61, 0x88, 0xAA, 0x2B, 0xB5, 0x7F, 0x8B,
-    0x1E, 0xFD, 0x84, 0xF8, 0x0F, 0x58, 0xD4, 0xA7, 0xFC, 0xDB, 0xFC, 0x7F, 0x52, 0xD6, 0x37, 0x14,
-    0xF6, 0x29, 0xA9, 0xEC, 0x53, 0x52, 0x99, 0xB7, 0x0E, 0xA5, 0xC0, 0x0E, 0xC3, 0x97, 0xBA, 0x3A,
-    0x42, 0xEF, 0x2D, 0xC2, 0x50, 0xAE, 0x2E, 0x08, 0xAC, 0xA4, 0x2A, 0x35, 0x17, 0x28, 0x77, 0x75,
-    0x1B, 0x7A, 0x00, 0x64, 0xA5, 0xD9, 0xAA, 0x94, 0xF7, 0xD8, 0xE2, 0xFE, 0x60, 0x0A, 0xED, 0xCF,
-    0xD9, 0x4A, 0x64, 0x81, 0xAF, 0xA9, 0xB1, 0xC2, 0xE2, 0xCF, 0x45, 0xFF, 0xC9, 0xE4, 0x4B, 0x93,
-    0x71, 0x9C, 0x4A, 0xE8, 0x20, 0x98, 0x48, 0xE5, 0xE7, 0x26, 0x03, 0xD9, 0xBD, 0xA1, 0xDC, 0x22,
-    0x86, 0x72, 0xFA, 0x63, 0x56, 0xF2, 0x6E, 0x2A, 0xC3, 0x30, 0x99, 0xDB, 0x2D, 0x4D, 0x57, 0xF6,
-    0x76, 0x43, 0x93, 0x70, 0xE6, 0x1C, 0xAE, 0xA5, 0x43, 0x1C, 0xE3, 0x31, 0x63, 0x21, 0x4A, 0x6A,
-    0xDC, 0x7A, 0x7D, 0x97, 0x1A, 0xB7, 0x33, 0x68, 0xB7, 0x59, 0xE3, 0x56, 0x48, 0x69, 0x48, 0xEB,
-    0xB3, 0x14, 0x32, 0xD9, 0xAA, 0xC6, 0x6D, 0x4F, 0xF2, 0xE7, 0x2A, 0xFD, 0xB5, 0xC9, 0x83, 0xFE,
-    0x44, 0xE5, 0xB7, 0xC4, 0x9A, 0x6B, 0x33, 0x93, 0xD5, 0x54, 0xAB, 0x5F, 0x68, 0xFD, 0xE6, 0xEB,
-    0xC6, 0x6F, 0xD3, 0xDA, 0x37, 0xBA, 0xB4, 0x59, 0xC9, 0xA7, 0xD1, 0x46, 0xB9, 0x3F, 0x14, 0xA7,
-    0xD2, 0x32, 0x7A, 0xC5, 0x12, 0x50, 0x66, 0xF5, 0x2F, 0x43, 0x67, 0x6E, 0x91, 0x62, 0x0E, 0x61,
-    0xBF, 0x9C, 0x3D, 0x4C, 0x7D, 0xF1, 0xD6, 0xB5, 0x78, 0xDF, 0x11, 0x49, 0x78, 0x60, 0xCF, 0xE2,
-    0xBB, 0xCC, 0xC5, 0x48, 0x54, 0xF9, 0x6E, 0x7F, 0x12, 0x7A, 0xCC, 0x58, 0x2B, 0x1C, 0xF6, 0xE7,
-    0xEA, 0xA1, 0xCC, 0xF9, 0xE4, 0x50, 0x2F, 0x3C, 0xB5, 0x8C, 0xF5, 0xD6, 0xCB, 0x78, 0x27, 0x8A,
-    0x86, 0x70, 0x7E, 0x50, 0x47, 0x8A, 0x75, 0x7B, 0xB6, 0x39, 0xA0, 0x3F, 0x86, 0x1D, 0x8A, 0x4D,
-    0xA1, 0x2D, 0x3C, 0x5D, 0x12, 0xB4, 0x7C, 0x3E, 0x3A, 0x39, 0xC7, 0xFA, 0x03, 0x25, 0xE0, 0x24,
-    0xC1, 0xBC, 0x2D, 0xB8, 0x9B, 0x02, 0xFD, 0x17, 0x42, 0x3B, 0xE5, 0xB8, 0xD0, 0xDB, 0x96, 0x6D,
-    0x6B, 0x09, 0x6D, 0x6D, 0xA8, 0x31, 0x3B, 0x06, 0x53, 0xC5, 0xD8, 0xB8, 0x37, 0xC0, 0xCB, 0x94,
-    0xC0, 0x35, 0xB4, 0x88, 0xD3, 0x3A, 0xAC, 0x54, 0x78, 0x69, 0xE2, 0x6F, 0x4D, 0xE5, 0x20, 0x02,
-    0x19, 0xAC, 0x2F, 0x03, 0x96, 0x01, 0xAE, 0xBD, 0x43, 0xBA, 0x4A, 0xFC, 0x3A, 0x1A, 0x68, 0x4B,
-    0x32, 0x20, 0x4D, 0xD8, 0xB9, 0x8D, 0x36, 0x67, 0x1A, 0x31, 0xF3, 0x67, 0xBD, 0xDA, 0xA9, 0xB0,
-    0xBA, 0x50, 0xB3, 0xAA, 0x87, 0xE2, 0x83, 0xE1, 0x15, 0xCB, 0xC6, 0x95, 0x3C, 0x65, 0x8D, 0xAE,
-    0x2E, 0x9E, 0x67, 0x45, 0xFB, 0x27, 0xB9, 0x5A, 0x80, 0xAF, 0x8F, 0xD1, 0xEC, 0x85, 0xDA, 0x65,
-    0x40, 0x76, 0x44, 0xE3, 0x5E, 0x79, 0x87, 0x1B, 0x0A, 0x9E, 0xD1, 0xD5, 0x86, 0xEE, 0x9D, 0x73,
-    0xBB, 0xAF, 0xD7, 0xEB, 0xA6, 0x6D, 0x00, 0x01, 0xD6, 0x78, 0x23, 0x69, 0x14, 0x09, 0x1E, 0x30,
-    0x62, 0x80, 0x87, 0x7A, 0xCD, 0x88, 0xD1, 0x37, 0xD9, 0xA7, 0xC1, 0x02, 0x8D, 0xA7, 0xC1, 0x97,
-    0x85, 0xE1, 0x63, 0x23, 0xAB, 0x86, 0x46, 0xF5, 0x06, 0x4B, 0xEF, 0xE4, 0x86, 0xC3, 0xF3, 0x83,
-    0x86, 0xFA, 0x23, 0xB5, 0x78, 0xDC, 0x39, 0x9B, 0xE6, 0xA6, 0x0D, 0x9A, 0xFF, 0x51, 0x45, 0xE5,
-    0xB3, 0xA7, 0x66, 0x4F, 0x86, 0xC5, 0xC9, 0x59, 0xB5, 0x3F, 0x2C, 0xA8, 0xA7, 0xC2, 0x0F, 0xF2,
-    0x71, 0xB4, 0x26, 0xE6, 0xFA, 0x28, 0x13, 0x7E, 0x08, 0x03, 0xBF, 0x0B, 0xAF, 0x93, 0x4F, 0x42,
-    0x96, 0xF7, 0xD4, 0x61, 0x91, 0xE6, 0x4B, 0x65, 0x0A, 0xE1, 0x21, 0x11, 0x1A, 0xEB, 0x7B, 0xC8,
-    0xFE, 0x0F, 0x5B, 0xCF, 0x67, 0x0B, 0xFA, 0x36, 0x40, 0xAB, 0xD9, 0x20, 0x2D, 0xFD, 0x55, 0x0D,
-    0x34, 0x85, 0x25, 0xEB, 0x0B, 0x82, 0x2C, 0x18, 0xC2, 0xD6, 0x8C, 0x29, 0x68, 0xA8, 0x00, 0xA0,
-    0x77, 0x79, 0x5C, 0xD2, 0xED, 0xD7, 0x33, 0x98, 0xF3, 0x41, 0x29, 0xAB, 0xB2, 0x19, 0xB6, 0x70,
-    0x5C, 0xD2, 0x4D, 0xA9, 0xEE, 0x16, 0x36, 0x12, 0x4F, 0x5F, 0x8B, 0x2A, 0x63, 0x86, 0x02, 0xFA,
-    0xFE, 0x31, 0x86, 0x1D, 0xA0, 0x87, 0x03, 0xF4, 0x18, 0xE8, 0x3C, 0xFC, 0x25, 0x63, 0x0C, 0xA5,
-    0x15, 0x64, 0xCC, 0x31, 0xD3, 0x43, 0xA0, 0x7B, 0xC0, 0x42, 0xD5, 0xDD, 0x12, 0x48, 0x0D, 0x73,
-    0x59, 0x4F, 0x59, 0x4D, 0x97, 0x6B, 0xE9, 0x36, 0x63, 0x27, 0xCD, 0xE5, 0x2A, 0xBA, 0x5C, 0x43,
-    0x97, 0x2B, 0x68, 0x2B, 0xAD, 0x1B, 0x09, 0xD8, 0x51, 0x07, 0xD8, 0xB0, 0x0F, 0xE3, 0x72, 0xCD,
-    0xA4, 0xC8, 0xBA, 0x93, 0x22, 0x6B, 0xBB, 0x5E, 0xE2, 0x28, 0xDA, 0xB5, 0x5A, 0x99, 0xAC, 0x93,
-    0x80, 0x59, 0x48, 0xEB, 0x1F, 0x32, 0x0E, 0xD4, 0xAB, 0xA0, 0x09, 0xFE, 0x2D, 0x26, 0xBF, 0x77,
-    0x07, 0xC0, 0x3C, 0x51, 0x42, 0xBC, 0x70, 0xC4, 0xBE, 0xA0, 0xA1, 0x96, 0x58, 0x3C, 0x08, 0x10,
-    0xF8, 0xC9, 0x01, 0x22, 0xD6, 0x53, 0x04, 0x9D, 0xC4, 0x90, 0x26, 0x65, 0x7F, 0xC1, 0x04, 0xF8,
-    0x13, 0xE0, 0x48, 0x3D, 0x1A, 0x69, 0x35, 0x22, 0xEB, 0x9F, 0x7A, 0xD5, 0xFA, 0xBC, 0xAB, 0x6F,
-    0x14, 0x00, 0xD7, 0x32, 0x80, 0x9F, 0x61, 0x84, 0xAB, 0x7F, 0xC7, 0x69, 0x75, 0x76, 0xD7, 0x00,
-    0x3E, 0x7E, 0xCC, 0xAF, 0xFC, 0xAC, 0xE6, 0x57, 0xC0, 0x86, 0xAB, 0x6F, 0xF6, 0x36, 0x10, 0x4C,
-    0x5E, 0xCC, 0x31, 0xB7, 0xB8, 0x66, 0xA7, 0xED, 0x1E, 0xBA, 0xB6, 0x0C, 0xFC, 0x26, 0x41, 0xE3,
-    0xFE, 0x2A, 0xF1, 0x7F, 0x7F, 0x14, 0x9C, 0xF5, 0xF5, 0x7F, 0xC1, 0x93, 0xBF, 0xBE, 0xC8, 0x81,
-    0xD7, 0x42, 0x5F, 0xFC, 0x88, 0x4E, 0xFD, 0xAF, 0x35, 0x04, 0xC4, 0xEF, 0x5F, 0x94, 0x1C, 0x43,
-    0xA3, 0x18, 0xED, 0x4D, 0x18, 0xEC, 0xCD, 0xEF, 0xC0, 0xFD, 0x1F, 0xF7, 0x67, 0x72, 0x08, 0xA3,
-    0x1F, 0x3D, 0x0E, 0xEE, 0x35, 0x71, 0x1F, 0x56, 0x9B, 0x52, 0x50, 0x40, 0xE7, 0x09, 0x68, 0x17,
-    0x7E, 0xFC, 0x21, 0x00, 0xD0, 0x0E, 0xC6, 0xBF, 0x3F, 0xDA, 0x53, 0x41, 0x3B, 0xC5, 0x1B, 0x8B,
-    0xF1, 0x3A, 0xBF, 0x93, 0xDC, 0xB1, 0xA2, 0xF2, 0xB9, 0xAC, 0xF4, 0xF9, 0x55, 0x97, 0x7B, 0x12,
-    0x4B, 0xEF, 0xC7, 0xEA, 0x42, 0x50, 0xEC, 0xE2, 0x26, 0xAC, 0x82, 0x66, 0x46, 0x50, 0xCC, 0x0B,
-    0xA4, 0x59, 0x13, 0x5C, 0x2F, 0x84, 0xF3, 0x2D, 0xA4, 0xA8, 0x0B, 0x3E, 0xE8, 0xE5, 0x2A, 0xB5,
-    0x7E, 0x50, 0xD0, 0x9C, 0x0E, 0x0A, 0xC9, 0xDE, 0x16, 0x36, 0xB3, 0x4A, 0x83, 0x7A, 0xE9, 0x16,
-    0x70, 0x44, 0xAB, 0x5A, 0xE7, 0x8B, 0xE4, 0x65, 0x4D, 0x56, 0xBE, 0x18, 0x56, 0xCF, 0x9D, 0xBA,
-    0x10, 0x16, 0xA7, 0x66, 0x01, 0xF8, 0x55, 0xB2, 0x71, 0x28, 0xAC, 0x24, 0x95, 0x9B, 0x1F, 0xB2,
-    0xCA, 0xF2, 0x3A, 0xCB, 0x37, 0xD9, 0x37, 0xAB, 0x34, 0x15, 0xF9, 0xD7, 0x61, 0x80, 0x35, 0x85,
-    0x99, 0xD1, 0x87, 0x66, 0x28, 0x93, 0x2F, 0xEF, 0x5B, 0x26, 0xBF, 0x74, 0xEF, 0x32, 0x79, 0xBB,
-    0x4B, 0x21, 0x35, 0x57, 0x6D, 0xE8, 0x2C, 0xBE, 0x1B, 0x0D, 0x8A, 0x59, 0x82, 0xC5, 0x8E, 0xA0,
-    0x5C, 0x99, 0x64, 0xA0, 0x56, 0x9D, 0x06, 0x6B, 0xE7, 0x5A, 0x12, 0xCA, 0xE6, 0x0B, 0x04, 0x61,
-    0x47, 0xDA, 0xE0, 0xBD, 0xE3, 0xC8, 0x82, 0x78, 0xF7, 0xEE, 0x46, 0x40, 0x16, 0x86, 0x09, 0xD5,
-    0x70, 0x72, 0x6B, 0xAD, 0x8C, 0x70, 0x61, 0x0A, 0xEE, 0x17, 0xA8, 0x36, 0x40, 0xCE, 0x51, 0x42,
-    0xEF, 0x77, 0x9C, 0xBF, 0x0B, 0x94, 0xB9, 0x2A, 0x3B, 0x59, 0xCE, 0x87, 0x4A, 0x25, 0xB2, 0x29,
-    0x8F, 0x36, 0x90, 0xA1, 0x5A, 0xE8, 0xDB, 0x61, 0xDB, 0x59, 0xD9, 0x69, 0x8D, 0xCF, 0x6C, 0x82,
-    0x32, 0x37, 0x65, 0x27, 0x97, 0xDA, 0x6A, 0x10, 0x96, 0x4F, 0xDF, 0xB2, 0x95, 0xA7, 0xC5, 0x83,
-    0xED, 0x2B, 0xC4, 0xA1, 0x3F, 0x6B, 0x4B, 0x55, 0xFB, 0x61, 0x43, 0x61, 0x21, 0x07, 0xD1, 0x1F,
-    0x31, 0xB3, 0x89, 0x56, 0x71, 0xDA, 0x43, 0x37, 0x1C, 0xE6, 0xFA, 0x43, 0xE9, 0x0D, 0xB7, 0x4B,
-    0xCD, 0x87, 0xA6, 0x77, 0x6D, 0x84, 0x46, 0x74, 0xF0, 0x28, 0x91, 0xDD, 0x76, 0x41, 0x26, 0x3C,
-    0x13, 0xE4, 0x12, 0x7D, 0x0A, 0x56, 0xC5, 0xEB, 0xE7, 0x4E, 0x9D, 0x89, 0xA5, 0xB9, 0xB8, 0xA8,
-    0x86, 0xDA, 0x9D, 0x80, 0x0C, 0x6D, 0x13, 0xB4, 0x77, 0x42, 0xEA, 0xD8, 0xDA, 0x6A, 0x59, 0xAB,
-    0x67, 0xC7, 0x56, 0x9C, 0x14, 0x63, 0x8A, 0xB6, 0x0D, 0x3B, 0xAF, 0xA1, 0xD9, 0x79, 0x44, 0x5C,
-    0x13, 0x09, 0x67, 0xCD, 0x12, 0x52, 0xEF, 0x52, 0xD5, 0x05, 0x64, 0x9A, 0xDE, 0x46, 0x1D, 0xC6,
-    0x8F, 0x0F, 0x81, 0x30, 0xC7, 0xFC, 0x65, 0x61, 0x23, 0x71, 0x41, 0xE5, 0xBC, 0x83, 0x25, 0x0A,
-    0x0C, 0x4B, 0xEA, 0x7F, 0x52, 0xA6, 0x99, 0xF6, 0x2B, 0x9D, 0x19, 0x74, 0x0B, 0xD0, 0xEA, 0x37,
-    0xC6, 0x20, 0xE5, 0xC7, 0x38, 0xC7, 0x05, 0x38, 0xE6, 0x47, 0x61, 0x9B, 0xC7, 0xEF, 0xB3, 0x36,
-    0x85, 0xDB, 0x1A, 0x4E, 0x48, 0x15, 0xAC, 0xF9, 0x6F, 0xE3, 0x84, 0xD0, 0x10, 0x22, 0x1A, 0x99,
-    0x41, 0x6D, 0xC1, 0xCD, 0xF9, 0x1E, 0x1C, 0x69, 0x7E, 0xD6, 0xFE, 0xA7, 0x90, 0x85, 0xC1, 0xF5,
-    0xD6, 0x02, 0x6D, 0xC1, 0xA7, 0xC0, 0xEA, 0xD1, 0xAF, 0x1A, 0x15, 0x5D, 0xFB, 0x1A, 0x12, 0x6E,
-    0x55, 0xC6, 0x27, 0x6C, 0xC1, 0x82, 0x97, 0xC7, 0x73, 0xAE, 0xFF, 0x10, 0xD8, 0xBD, 0x28, 0x75,
-    0x4E, 0x0C, 0xE3, 0x72, 0x5B, 0x96, 0x28, 0x93, 0x4B, 0xB6, 0x11, 0xD1, 0x74, 0x24, 0xEF, 0xE3,
-    0x5C, 0xEF, 0x88, 0xF3, 0xEF, 0x84, 0x6B, 0x2D, 0x03, 0x31, 0x07, 0x84, 0x41, 0xE1, 0xB3, 0x49,
-    0xF4, 0x02, 0xEA, 0x4F, 0x52, 0xBD, 0xFA, 0xFC, 0x9A, 0x56, 0x2B, 0xC3, 0xD6, 0xEA, 0x60, 0xF3,
-    0xD6, 0xEA, 0x87, 0x01, 0x4B, 0x1D, 0xD3, 0x76, 0x62, 0x80, 0x85, 0xE2, 0x4D, 0x64, 0x83, 0xD3,
-    0x36, 0x05, 0x86, 0xDA, 0x3B, 0x90, 0x7D, 0xF9, 0x5A, 0x7C, 0xB5, 0x3C, 0x19, 0xE7, 0xE5, 0xAB,
-    0xF7, 0xAD, 0xBD, 0xBB, 0x61, 0x37, 0x36, 0x4B, 0x74, 0x64, 0x61, 0xAA, 0x51, 0xDE, 0xEE, 0x98,
-    0xDE, 0xFB, 0x51, 0x73, 0xEF, 0x47, 0xC3, 0xBD, 0x1F, 0x2D, 0x94, 0x2E, 0x1C, 0x44, 0xEE, 0xFD,
-    0xA0, 0x1D, 0x9E, 0x9E, 0x61, 0x5F, 0x3F, 0x03, 0xC2, 0xC2, 0x9B, 0xE3, 0x98, 0xAE, 0x37, 0x89,
-    0xE9, 0x4E, 0x01, 0x9E, 0x3B, 0xD1, 0xCB, 0xAE, 0x92, 0x62, 0xC8, 0xD0, 0x87, 0x6D, 0x58, 0x8D,
-    0x24, 0x43, 0x0F, 0xF6, 0xCD, 0x69, 0x1F, 0x90, 0xDD, 0x1D, 0xC9, 0xD2, 0xEF, 0xB5, 0x59, 0xFA,
-    0x14, 0xA3, 0x89, 0x87, 0xF0, 0xC4, 0x38, 0x53, 0x3F, 0xDD, 0x52, 0x16, 0xA7, 0xF5, 0x8F, 0x35,
-    0x52, 0x57, 0x8C, 0xB5, 0xA9, 0x31, 0x6F, 0xCB, 0x48, 0x3D, 0x2A, 0xFE, 0x70, 0xF3, 0x48, 0x1F,
-    0x7D, 0xE3, 0x49, 0x7E, 0xEF, 0x8D, 0x27, 0xE2, 0x67, 0xDF, 0x61, 0x14, 0x3D, 0x3F, 0x01, 0xB3,
-    0x8C, 0x12, 0x2B, 0xD6, 0x23, 0x2A, 0xBF, 0x75, 0x59, 0x80, 0x4C, 0x1A, 0x32, 0xFF, 0x46, 0xD9,
-    0x9A, 0xC4, 0x21, 0x30, 0xCE, 0xE9, 0x3F, 0xC7, 0xE7, 0x9E, 0x34, 0x4A, 0xCA, 0x5D, 0xA0, 0x0C,
-    0x70, 0x25, 0x2A, 0x41, 0x80, 0xBA, 0xD9, 0x52, 0x2B, 0x05, 0x53, 0x96, 0x11, 0xE8, 0xBE, 0x22,
-    0xE5, 0xEB, 0xDB, 0x4C, 0x0C, 0xAC, 0x44, 0x45, 0x0D, 0x04, 0x5C, 0x88, 0x8A, 0x15, 0x7B, 0x38,
-    0x29, 0x5B, 0x10, 0x0B, 0xB5, 0x6D, 0x07, 0x27, 0xFD, 0x72, 0xF9, 0xFC, 0xAD, 0x21, 0xB1, 0xB8,
-    0x61, 0xBB, 0xC6, 0xC6, 0x7D, 0x1A, 0xFE, 0x86, 0x83, 0x43, 0x3E, 0x99, 0x11, 0x4E, 0x81, 0xD8,
-    0x7B, 0x4D, 0xBF, 0x48, 0xF7, 0x49, 0x1F, 0x05, 0x7C, 0x55, 0xA0, 0x75, 0x8F, 0x1E, 0x04, 0x3A,
-    0xE6, 0x3F, 0xFD, 0xA0, 0x4F, 0x24, 0x99, 0x98, 0xAF, 0xC7, 0xC7, 0xAD, 0xFE, 0x1C, 0x6D, 0x82,
-    0x0A, 0x4F, 0x3C, 0x62, 0x9A, 0xA5, 0xFE, 0xCF, 0x64, 0x9F, 0x8E, 0xE6, 0x9E, 0x9C, 0xAD, 0x81,
-    0x54, 0x07, 0xB8, 0xF8, 0xDE, 0xB0, 0x4F, 0x67, 0xEE, 0x0B, 0x91, 0xD6, 0x5B, 0x80, 0xF1, 0x3E,
-    0x1D, 0x35, 0xF0, 0xF0, 0xD4, 0x4E, 0xE4, 0xFD, 0xEB, 0xE1, 0x19, 0x1B, 0xC5, 0xE8, 0x63, 0x03,
-    0xEE, 0xF0, 0x99, 0xBB, 0xC5, 0x53, 0xD6, 0x81, 0xCF, 0x2D, 0xC8, 0x5E, 0xAF, 0x61, 0xF3, 0x99,
-    0xBF, 0x07, 0x05, 0x2C, 0xDE, 0xC1, 0xB9, 0xAC, 0x21, 0xB3, 0x45, 0x64, 0xF7, 0x32, 0x17, 0xEE,
-    0xB1, 0x07, 0x69, 0x96, 0xE0, 0x79, 0xEE, 0x41, 0x7A, 0x9E, 0x3B, 0x36, 0x08, 0xCC, 0xFF, 0x9C,
-    0xEC, 0x41, 0xBA, 0x48, 0x89, 0xFD, 0xFC, 0x46, 0x30, 0x3B, 0xBD, 0x07, 0x69, 0xCB, 0x8A, 0xD5,
-    0xAF, 0xDE, 0x97, 0xE6, 0x99, 0x9B, 0xB6, 0x62, 0xF5, 0xE9, 0xF7, 0xE1, 0xED, 0xA1, 0x39, 0x2F,
-    0x4E, 0x2A, 0x56, 0xB9, 0xAD, 0x45, 0x4A, 0x09, 0x36, 0x79, 0xC5, 0x16, 0xEC, 0x91, 0x5D, 0x66,
-    0xCC, 0xD5, 0x9E, 0xB3, 0x96, 0x78, 0x76, 0xFF, 0x5D, 0x80, 0x37, 0xF8, 0xBE, 0x80, 0xF6, 0x0E,
-    0x3B, 0x78, 0x1A, 0xBC, 0x22, 0xD6, 0x39, 0x4C, 0x5B, 0x6E, 0x6E, 0xF4, 0xB9, 0xBD, 0xC4, 0x6F,
-    0x24, 0x72, 0x70, 0x5F, 0x30, 0xD8, 0xC1, 0xBE, 0x99, 0x38, 0x7D, 0x11, 0xC7, 0x0E, 0x1D, 0xC7,
-    0xE2, 0xA4, 0xDA, 0x93, 0x62, 0x40, 0x0E, 0x3D, 0x2A, 0xE0, 0x93, 0xBF, 0x16, 0xE7, 0x10, 0x6D,
-    0x97, 0x24, 0xBD, 0x74, 0x29, 0x95, 0x24, 0x93, 0x30, 0xC1, 0x4E, 0xF3, 0x25, 0x83, 0xDC, 0x92,
-    0x45, 0xB0, 0x75, 0x35, 0x03, 0x8C, 0x8A, 0x21, 0x3F, 0xBB, 0x43, 0x42, 0x9B, 0xCF, 0x2A, 0x9B,
-    0x9F, 0x19, 0xB2, 0x2A, 0xE3, 0xA4, 0x00, 0x23, 0xE7, 0x74, 0x25, 0x83, 0xA2, 0xE7, 0x23, 0x34,
-    0x9E, 0x90, 0xA5, 0xC9, 0xA5, 0x34, 0x49, 0x33, 0xF6, 0x9F, 0xED, 0x34, 0xCB, 0xCB, 0x89, 0x54,
-    0x89, 0xD9, 0xBD, 0x62, 0x18, 0x05, 0x7D, 0x48, 0x6A, 0xB6, 0xFE, 0xB2, 0x5A, 0x2F, 0x19, 0x5C,
-    0x9F, 0x82, 0x9A, 0x9A, 0x42, 0xBD, 0x3E, 0x85, 0xD1, 0xE3, 0x4C, 0x41, 0x4D, 0x4D, 0xA1, 0x51,
-    0xE3, 0xD0, 0x84, 0xEC, 0x38, 0x1C, 0x76, 0x1B, 0xAA, 0xE9, 0x04, 0xCE, 0x54, 0x1C, 0xF4, 0x31,
-    0x26, 0xE8, 0x73, 0x82, 0xB6, 0x4C, 0x47, 0x86, 0x13, 0x26, 0x9B, 0xE5, 0xA0, 0x98, 0xCD, 0xC5,
-    0xC3, 0xBE, 0xB7, 0x23, 0x9D, 0x5A, 0x81, 0x05, 0x5B, 0x76, 0x77, 0x49, 0xCA, 0xE5, 0x54, 0x7A,
-    0xDE, 0xCA, 0x95, 0xD5, 0xA9, 0xD0, 0xF8, 0xFF, 0xF7, 0xED, 0xE5, 0xC2, 0xF3, 0xF3, 0x52, 0xD2,
-    0xC7, 0x7D, 0x46, 0xDE, 0x9A, 0x08, 0x1E, 0xFD, 0xF6, 0xC4, 0x92, 0x7D, 0x02, 0x1B, 0x69, 0x1E,
-    0x3C, 0x9E, 0xB0, 0x3A, 0x0E, 0x78, 0xD1, 0x31, 0x72, 0x1B, 0x66, 0xCD, 0x1A, 0x4A, 0xEB, 0x86,
-    0x01, 0xAF, 0x66, 0xC2, 0xCB, 0x1D, 0xF7, 0x54, 0xB1, 0x7C, 0x73, 0x43, 0xC0, 0xCB, 0xDC, 0x25,
-    0xE0, 0xA5, 0x7E, 0xA8, 0x8D, 0xDB, 0x05, 0x4D, 0xF0, 0xEF, 0xE9, 0xDA, 0xD2, 0xB3, 0xA5, 0x63,
-    0xEB, 0xC3, 0x7A, 0xF7, 0x7B, 0x5D, 0xD8, 0x00, 0xAA, 0x6C, 0xB9, 0xE8, 0xFC, 0xDA, 0xE9, 0xC3,
-    0x0E, 0xE6, 0xB5, 0x61, 0x04, 0x05, 0x7D, 0xCD, 0x82, 0xD2, 0x99, 0xBD, 0x63, 0x09, 0x8B, 0x81,
-    0xC7, 0x0E, 0x93, 0xFB, 0x89, 0xED, 0x13, 0xAF, 0x27, 0xD4, 0x5E, 0x49, 0x6A, 0x46, 0xD9, 0x58,
-    0x8F, 0x95, 0xD8, 0x8E, 0x7A, 0xC4, 0xED, 0x37, 0xDD, 0x94, 0x5D, 0x78, 0xD1, 0xDA, 0xCA, 0x52,
-    0xC7, 0x99, 0x6C, 0xB3, 0xF7, 0xCB, 0x4D, 0xE2, 0x91, 0x04, 0x79, 0x38, 0x66, 0x0C, 0x69, 0x96,
-    0x2B, 0x73, 0x91, 0x09, 0x91, 0x56, 0xCC, 0xEE, 0x1F, 0xD0, 0xC3, 0x1B, 0x27, 0x3E, 0xF7, 0x2C,
-    0x4A, 0x09, 0x7E, 0x48, 0x17, 0xD8, 0xED, 0x1E, 0xD6, 0x05, 0xA6, 0xB8, 0x37, 0x1B, 0x35, 0xC2,
-    0x3C, 0xDD, 0xB4, 0x4B, 0xC0, 0xAA, 0x4A, 0x4F, 0x30, 0xAE, 0x66, 0x26, 0x2F, 0xA6, 0xB9, 0xC2,
-    0x84, 0x05, 0xA7, 0xB9, 0x9E, 0xA4, 0xB8, 0x97, 0x77, 0xFB, 0x50, 0x7E, 0x70, 0xB9, 0xC1, 0x0F,
-    0x5E, 0x17, 0x24, 0xFB, 0x36, 0xA5, 0x2A, 0xAC, 0x5C, 0x3B, 0xA6, 0xB6, 0x65, 0xD3, 0x52, 0x36,
-    0x4E, 0x49, 0xAD, 0xA7, 0x24, 0x24, 0x0A, 0xF9, 0xBA, 0x4D, 0x49, 0x3C, 0xB2, 0xA1, 0x72, 0xE3,
-    0x6E, 0x86, 0xCA, 0x0C, 0x95, 0xB9, 0x44, 0x6A, 0xC4, 0xFD, 0x0C, 0xB6, 0x16, 0x9E, 0x8F, 0x6B,
-    0xA8, 0xA8, 0x61, 0xFF, 0x92, 0xEC, 0xFF, 0xB8, 0x38, 0xB1, 0x85, 0x2F, 0x4C, 0xC0, 0x2C, 0xD7,
-    0x13, 0xFC, 0xDD, 0x86, 0x7C, 0x1B, 0xCF, 0x0D, 0x17, 0xAE, 0xAA, 0xC9, 0xF9, 0x0E, 0x05, 0x9D,
-    0xBB, 0x1F, 0x17, 0x7C, 0x81, 0x02, 0x3C, 0xD8, 0x98, 0x2F, 0x53, 0xE0, 0x0B, 0x14, 0xDE, 0xAB,
-    0xF7, 0xAE, 0xBF, 0x46, 0xA1, 0xE5, 0x0B, 0x14, 0xAE, 0x74, 0x27, 0xA7, 0x5E, 0xA3, 0x20, 0x2F,
-    0x50, 0x48, 0x8B, 0xA9, 0xD7, 0x28, 0x64, 0xF6, 0x35, 0x0A, 0x7A, 0x78, 0x8D, 0xC2, 0xD4, 0x36,
-    0x94, 0x85, 0x4D, 0x4B, 0x69, 0x83, 0xCD, 0xC7, 0xB6, 0x73, 0x63, 0x5B, 0x3F, 0x6C, 0x6C, 0x53,
-    0x13, 0xA7, 0xD0, 0x9F, 0x4A, 0x82, 0x85, 0x53, 0xD1, 0xE6, 0xDD, 0x8F, 0xA5, 0xA8, 0xF6, 0xD1,
-    0x9F, 0x8A, 0x59, 0xAE, 0x12, 0xFD, 0x67, 0xBE, 0xCC, 0x67, 0x52, 0x40, 0x4B, 0xE1, 0xA9, 0x6C,
-    0xE6, 0x5D, 0x5E, 0x02, 0x20, 0xAF, 0xBE, 0xA1, 0x90, 0xDD, 0xC5, 0x57, 0x8F, 0x3C, 0x4B, 0xD3,
-    0x7D, 0x81, 0x0A, 0xFC, 0x14, 0x43, 0x11, 0x2B, 0x5C, 0xB5, 0x5B, 0x3F, 0xA0, 0x1D, 0x0D, 0x21,
-    0x33, 0x2A, 0x9C, 0x7E, 0xF2, 0xC6, 0x16, 0xCD, 0x57, 0xDF, 0xA4, 0xF9, 0x52, 0x81, 0x45, 0x32,
-    0xCD, 0xF0, 0x76, 0x00, 0x3F, 0x5B, 0x91, 0xAC, 0x62, 0x80, 0xC5, 0x77, 0xF4, 0x59, 0xFB, 0xC0,
-    0xE5, 0x0C, 0xBC, 0xC9, 0xF2, 0x41, 0x30, 0xD3, 0xA1, 0xCE, 0x06, 0xAE, 0xD1, 0x76, 0xD2, 0xD5,
-    0xFA, 0x9C, 0x25, 0x05, 0xAC, 0x14, 0x42, 0x43, 0xE7, 0x9A, 0xEA, 0xEC, 0xFF, 0x9A, 0x24, 0x6C,
-    0xB4, 0xB5, 0x59, 0xF7, 0x11, 0x47, 0xF1, 0x51, 0xFA, 0x13, 0x47, 0x31, 0xA1, 0x19, 0xE7, 0x89,
-    0x4F, 0xC3, 0xCD, 0x2E, 0x28, 0xFF, 0x03, 0x90, 0xF2, 0xF5, 0x5A, 0x39, 0xC9, 0xB1, 0xC7, 0x9F,
-    0xC2, 0x50, 0x48, 0x0A, 0xB2, 0x5F, 0xE6, 0xE1, 0x40, 0x27, 0x84, 0xF6, 0x17, 0x9D, 0x58, 0xFE,
-    0xBF, 0xED, 0x98, 0xDA, 0x1A, 0x5D, 0x17, 0xC3, 0x08, 0xB4, 0x2B, 0x48, 0x3C, 0x24, 0x54, 0x19,
-    0x38, 0x94, 0x52, 0x6A, 0xBF, 0xD3, 0x2F, 0x26, 0xE3, 0x37, 0x79, 0x29, 0xBB, 0x7D, 0xCA, 0xF9,
-    0xEC, 0xFB, 0xE2, 0x7A, 0xE6, 0xC0, 0xC2, 0x4E, 0xCC, 0x02, 0x87, 0x00, 0x0C, 0xCB, 0x04, 0x8A,
-    0x4A, 0x8B, 0xA7, 0xCD, 0xB2, 0x56, 0x46, 0x5E, 0x81, 0xC4, 0xB4, 0x2E, 0x37, 0xB8, 0xDE, 0x36,
-    0x55, 0xFC, 0xA6, 0x39, 0xD3, 0x46, 0x87, 0x8C, 0xD3, 0xCD, 0xC8, 0x58, 0x39, 0xDC, 0x9D, 0xB4,
-    0xE6, 0xE2, 0xCF, 0xCD, 0xF2, 0x4F, 0x39, 0x03, 0x9C, 0x26, 0xE3, 0x41, 0x1F, 0xEF, 0xD0, 0x60,
-    0xB8, 0xBD, 0xE9, 0xCD, 0xB7, 0xD6, 0xDA, 0xB0, 0xF3, 0xA6, 0x0B, 0x59, 0xB6, 0x28, 0xE5, 0x87,
-    0x93, 0xD6, 0xCC, 0xF5, 0xE7, 0x18, 0x72, 0x3B, 0x35, 0x64, 0xD9, 0xE6, 0x37, 0xBD, 0x95, 0xA7,
-    0x5B, 0xDC, 0xEA, 0xAD, 0x3C, 0xFB, 0xD0, 0x9E, 0x9D, 0xEB, 0x97, 0xDF, 0x4D, 0x87, 0x6D, 0x61,
-    0x5B, 0xD1, 0x0F, 0x37, 0x40, 0x31, 0xB0, 0x1E, 0x5D, 0x81, 0x59, 0x90, 0x01, 0xB9, 0x4A, 0xCB,
-    0x2F, 0xA7, 0x07, 0x53, 0x50, 0x2A, 0x2E, 0xB4, 0x18, 0x83, 0x8E, 0x8A, 0x8B, 0x5D, 0x30, 0x73,
-    0xDF, 0x9D, 0xD4, 0xEF, 0x8D, 0xF7, 0xBB, 0x87, 0x10, 0x7D, 0x07, 0x21, 0xCA, 0x67, 0xC5, 0x09,
-    0x90, 0x11, 0x74, 0xB6, 0x6A, 0xC2, 0xE9, 0x5F, 0x59, 0x3E, 0x67, 0x18, 0x0E, 0xD2, 0x99, 0xD3,
-    0xA7, 0xD9, 0x88, 0xAD, 0xA3, 0x0D, 0x12, 0xE5, 0x0C, 0x5B, 0x41, 0xAC, 0xAD, 0xC2, 0x0C, 0x1B,
-    0x36, 0x83, 0x8E, 0x96, 0x69, 0x74, 0x94, 0xEA, 0x75, 0x88, 0xBE, 0x57, 0x65, 0x45, 0xFA, 0x49,
-    0xCD, 0x87, 0x1D, 0x8F, 0x11, 0x2C, 0x6A, 0x9C, 0x4F, 0x0F, 0x81, 0x58, 0x7E, 0x45, 0x51, 0x5F,
-    0x0C, 0x9B, 0x9C, 0xE6, 0x95, 0x5B, 0x63, 0x6C, 0x15, 0x64, 0xDF, 0xB1, 0xDD, 0xDB, 0x3E, 0x36,
-    0xFF, 0x70, 0xC1, 0x3A, 0x21, 0x15, 0x9C, 0xA9, 0x40, 0xA0, 0xC9, 0x63, 0x8F, 0x17, 0x5C, 0xE4,
-    0x8B, 0x80, 0x8A, 0x6D, 0x71, 0xDB, 0x70, 0xB0, 0xEF, 0xBE, 0xFB, 0x47, 0x61, 0xE9, 0x8E, 0x0A,
-    0x56, 0x0D, 0xCA, 0xA6, 0xB1, 0x01, 0x4E, 0x36, 0x8F, 0x3D, 0x19, 0x1B, 0x57, 0x5D, 0x78, 0x16,
-    0xDE, 0x4B, 0x8A, 0x76, 0x70, 0x6A, 0x09, 0xB7, 0xEF, 0x55, 0x4E, 0x5E, 0x56, 0x06, 0x1F, 0xD4,
-    0xFE, 0xD5, 0xDA, 0x0A, 0x9E, 0x87, 0xDA, 0x9B, 0xCE, 0x7A, 0x81, 0xC0, 0xB6, 0x3C, 0x80, 0x22,
-    0xD9, 0x45, 0x4D, 0x46, 0x2B, 0x90, 0xDE, 0x3F, 0x95, 0x39, 0x1D, 0xBD, 0x19, 0x5D, 0x58, 0xF7,
-    0xEC, 0x1E, 0xF9, 0xC7, 0x19, 0x45, 0x33, 0x94, 0x64, 0xC9, 0x5A, 0xF2, 0x64, 0xDF, 0xE2, 0x69,
-    0x48, 0xAA, 0x8B, 0x6A, 0xF7, 0x68, 0xD8, 0x81, 0x43, 0x1D, 0x75, 0x3A, 0x91, 0xD7, 0x31, 0x5A,
-    0x01, 0x4C, 0xD1, 0xBB, 0x1E, 0xB2, 0xFC, 0x43, 0x45, 0x5C, 0xC7, 0xC9, 0x69, 0xE6, 0x21, 0x7F,
-    0x49, 0x55, 0x79, 0x76, 0xF2, 0x06, 0x99, 0x6A, 0x00, 0xDF, 0xC4, 0x6B, 0xAB, 0x62, 0x33, 0x06,
-    0xDB, 0xB8, 0x9B, 0xC9, 0x7B, 0x83, 0xA1, 0xC2, 0x0F, 0xB8, 0x88, 0x57, 0x69, 0x64, 0xAB, 0x63,
-    0x4F, 0x7C, 0x32, 0xF3, 0x8C, 0x89, 0x5D, 0xE6, 0x2B, 0x3B, 0xDF, 0x65, 0x60, 0x79, 0xF7, 0xCC,
-    0xF6, 0xCE, 0x68, 0x3F, 0xCD, 0x8F, 0xD3, 0x7C, 0xC9, 0xE1, 0xE9, 0x60, 0xBA, 0xFB, 0x07, 0x29,
-    0xCA, 0x1E, 0x83, 0x62, 0x02, 0x1E, 0xB8, 0x28, 0x7B, 0x94, 0xAF, 0x28, 0xFF, 0x13, 0x50, 0xC7,
-    0x27, 0xCD, 0x44, 0xCB, 0xD2, 0xF5, 0xF7, 0x21, 0x10, 0xF9, 0xF2, 0x8B, 0x38, 0x8B, 0x13, 0x5B,
-    0xA8, 0x3D, 0xFD, 0x4A, 0x0C, 0xFB, 0x99, 0xA5, 0xB0, 0x52, 0x07, 0xFB, 0x79, 0xB7, 0x41, 0xD0,
-    0x3F, 0xF8, 0x98, 0x69, 0xFF, 0xEB, 0x9F, 0x2F, 0xA6, 0x0F, 0x37, 0xE6, 0xBB, 0x8E, 0x6F, 0x59,
-    0xE7, 0x8C, 0x2F, 0xDE, 0x73, 0x7C, 0x8F, 0x8D, 0xE7, 0x47, 0x1B, 0xF3, 0x43, 0xE1, 0xF9, 0x41,
-    0xE6, 0x01, 0x09, 0x38, 0x6A, 0x4E, 0x43, 0x02, 0x9E, 0xDE, 0xA0, 0xC4, 0xB6, 0xEB, 0x85, 0x32,
-    0xFE, 0xA1, 0x52, 0x05, 0x54, 0x62, 0x68, 0xCE, 0xA0, 0xC4, 0x1E, 0x67, 0xFF, 0xF4, 0x24, 0x11,
-    0x65, 0x11, 0xFD, 0x4D, 0xBC, 0xCF, 0xD2, 0x3E, 0xA3, 0xB5, 0x8D, 0xD5, 0xF0, 0xC7, 0xF7, 0x1C,
-    0x33, 0x6D, 0x5C, 0x47, 0x95, 0x97, 0x07, 0xA5, 0x97, 0xC1, 0x47, 0xE2, 0xA6, 0x20, 0xF4, 0xB4,
-    0x17, 0x12, 0x1D, 0x46, 0x60, 0x3F, 0x8F, 0xBB, 0x4F, 0xDA, 0x7D, 0x54, 0xF1, 0x50, 0x2F, 0x42,
-    0x5D, 0x4B, 0x3A, 0x09, 0xAD, 0x3B, 0xC0, 0x92, 0x6A, 0xD6, 0x63, 0x7E, 0x8F, 0x53, 0x78, 0x96,
-    0x01, 0x28, 0xD1, 0xC6, 0x02, 0x26, 0x0A, 0xF9, 0x09, 0xCF, 0x4B, 0x36, 0x69, 0x8F, 0xED, 0x97,
-    0x64, 0xF7, 0x93, 0x99, 0x9B, 0x55, 0x14, 0x9F, 0x32, 0xFC, 0xF7, 0x5E, 0x39, 0xEC, 0x67, 0x98,
-    0xEC, 0x2B, 0xF8, 0x26, 0x16, 0x2E, 0x7E, 0x31, 0x57, 0xAF, 0x47, 0x89, 0x6A, 0x60, 0x2F, 0x14,
-    0x2B, 0x4F, 0x66, 0x92, 0xBB, 0x98, 0x6D, 0x88, 0x7E, 0xC4, 0xF9, 0x1D, 0x29, 0xA7, 0x9C, 0x9A,
-    0x27, 0xF7, 0x92, 0x30, 0xB5, 0x02, 0x1C, 0xB6, 0xB1, 0x6D, 0xB3, 0x3B, 0xC6, 0xD3, 0x7A, 0xA4,
-    0xD7, 0x4C, 0xC8, 0x5B, 0x38, 0xEF, 0x51, 0x59, 0xF7, 0x20, 0x2F, 0x10, 0x15, 0x37, 0xD5, 0x2F,
-    0x6C, 0xF0, 0x8B, 0x9E, 0xAA, 0x33, 0x34, 0xB0, 0xFC, 0xE6, 0xE2, 0x35, 0x6F, 0x53, 0x95, 0xDD,
-    0x56, 0x15, 0x77, 0xF2, 0x86, 0x6F, 0xA2, 0xDC, 0x9B, 0x6A, 0xCE, 0x44, 0xF6, 0x5A, 0xE1, 0x0B,
-    0x48, 0xDC, 0xAC, 0x8B, 0xDF, 0x6F, 0xF2, 0x2D, 0x5E, 0x4A, 0x95, 0xFB, 0x65, 0xBF, 0xCE, 0x65,
-    0x29, 0x68, 0x93, 0xDD, 0x19, 0xC7, 0x76, 0x4F, 0x6D, 0x2A, 0xDD, 0xF6, 0x57, 0x56, 0x6C, 0x57,
-    0x15, 0xA4, 0x0D, 0x57, 0xA2, 0xFD, 0xD3, 0xD2, 0xE6, 0xE8, 0xA3, 0xEC, 0x8E, 0x42, 0xC3, 0x07,
-    0xAD, 0x8E, 0x1C, 0x5E, 0x76, 0xC0, 0x52, 0xE5, 0xD1, 0xB0, 0x9D, 0x5B, 0x67, 0x93, 0xA4, 0xE0,
-    0x13, 0x4D, 0xBD, 0xDA, 0x84, 0xEB, 0xAB, 0xE3, 0xE0, 0xAB, 0x84, 0xCA, 0x87, 0x7D, 0x3B, 0x43,
-    0xEA, 0xF5, 0xC4, 0xC6, 0xD4, 0xEB, 0x8B, 0x0F, 0x9F, 0x7A, 0x9D, 0x54, 0x00, 0x39, 0xA1, 0xB2,
-    0x4E, 0xDC, 0xB0, 0x1D, 0xE6, 0xC1, 0xE7, 0x26, 0x19, 0x2F, 0xE7, 0x07, 0xE6, 0xF8, 0xFD, 0xE6,
-    0x56, 0x8C, 0xDF, 0x67, 0x68, 0xDF, 0x63, 0x73, 0xA2, 0xE3, 0xD8, 0x65, 0xE8, 0xC3, 0x7B, 0x6C,
-    0xF8, 0x06, 0xEC, 0x99, 0x13, 0xDD, 0x31, 0x19, 0x35, 0x06, 0xED, 0x48, 0x34, 0x0C, 0x2E, 0x07,
-    0x46, 0xCC, 0x01, 0xFF, 0x3F, 0xC5, 0x59, 0xBF, 0x8F, 0xD4, 0x56, 0x10, 0x1E, 0xDB, 0xB0, 0x06,
-    0x2C, 0xCE, 0x14, 0xA0, 0x84, 0x20, 0xCE, 0x44, 0x4A, 0x81, 0xD0, 0x1D, 0x6E, 0x91, 0x72, 0x9C,
-    0x8D, 0x28, 0x52, 0x50, 0xE4, 0x0A, 0x50, 0x8A, 0x14, 0xA4, 0xA0, 0xC9, 0x35, 0xD7, 0xA4, 0x40,
-    0xCA, 0xC1, 0x3A, 0xE1, 0x1F, 0xD8, 0x3E, 0x45, 0xAE, 0x48, 0x41, 0x2E, 0x05, 0x44, 0x42, 0xD1,
-    0x45, 0x3A, 0x62, 0x27, 0x55, 0xA4, 0x34, 0x8E, 0x88, 0xD2, 0xA4, 0x59, 0x50, 0x04, 0x12, 0x52,
-    0xC2, 0x46, 0x5A, 0xA2, 0x25, 0x78, 0xFD, 0xF2, 0xCD, 0xBC, 0xB7, 0xCB, 0x2E, 0x1C, 0x70, 0xB0,
-    0xDE, 0x5D, 0xEF, 0xBE, 0xA7, 0x5D, 0xFF, 0x78, 0x6F, 0xBE, 0x99, 0x79, 0xDF, 0xCC, 0x1B, 0x93,
-    0xD5, 0x25, 0x22, 0x5B, 0xA1, 0x73, 0xB8, 0x73, 0xD3, 0x98, 0xC8, 0x8F, 0x32, 0xA2, 0x99, 0x10,
-    0xDD, 0x7C, 0xD0, 0x24, 0x5A, 0xF0, 0x5B, 0x44, 0x17, 0x3D, 0x74, 0x37, 0xDC, 0x0E, 0xD1, 0xC3,
-    0x0F, 0x0A, 0xB2, 0x94, 0xEA, 0x92, 0x9D, 0x5B, 0x25, 0x39, 0x19, 0x29, 0x72, 0x13, 0x4A, 0x63,
-    0x3F, 0xA6, 0x7A, 0xB6, 0x92, 0x5B, 0xEA, 0x4F, 0xD5, 0x71, 0x55, 0x41, 0xFA, 0x58, 0xE2, 0x91,
-    0x8B, 0x5E, 0x67, 0x75, 0xCC, 0x69, 0x6B, 0x3D, 0xA1, 0x40, 0x75, 0x28, 0xFA, 0xA9, 0xA0, 0xF0,
-    0x54, 0x97, 0x76, 0x52, 0x89, 0xB3, 0x25, 0xD5, 0x54, 0x49, 0xD1, 0xDD, 0x12, 0xC3, 0x95, 0x18,
-    0x17, 0x0D, 0x53, 0xA4, 0x4E, 0x49, 0xF5, 0xBF, 0x55, 0x1C, 0x74, 0xD2, 0x4C, 0x1E, 0xDE, 0x8F,
-    0xA6, 0x4C, 0xBB, 0xDC, 0x1B, 0xF0, 0x6B, 0x9E, 0xE3, 0x01, 0xA4, 0xB7, 0xBC, 0x04, 0x3F, 0x21,
-    0x0D, 0xD1, 0x25, 0xBE, 0xF2, 0x09, 0xF5, 0x6E, 0x19, 0x1B, 0xD4, 0x8F, 0x31, 0xB8, 0xCA, 0xC8,
-    0x3A, 0x8D, 0x71, 0x5C, 0xB4, 0xE3, 0x18, 0x7E, 0xAE, 0x02, 0xA0, 0x84, 0xDB, 0x71, 0x04, 0x2C,
-    0xFB, 0x09, 0x16, 0x1B, 0xDA, 0xF4, 0xDF, 0xC3, 0xB5, 0xA3, 0xB4, 0x36, 0x76, 0x50, 0x64, 0xC5,
-    0x82, 0xE6, 0xD8, 0xFB, 0xD0, 0xF4, 0x6F, 0xE4, 0xDC, 0x6E, 0x91, 0x17, 0x5F, 0x1C, 0x19, 0x14,
-    0x8F, 0x4A, 0x4E, 0xCE, 0x3F, 0xBF, 0x65, 0xD9, 0xDF, 0x60, 0xB1, 0x27, 0x05, 0x8A, 0x3D, 0xE7,
-    0x24, 0xCF, 0xB7, 0xA7, 0x41, 0x56, 0x1D, 0x0F, 0x77, 0x56, 0xF1, 0xC4, 0xAC, 0x9E, 0x75, 0x79,
-    0x8D, 0x5C, 0x00, 0xF0, 0x5B, 0x29, 0x79, 0x79, 0x3D, 0xB6, 0xE2, 0x08, 0x8E, 0x14, 0x25, 0x56,
-    0xAA, 0x12, 0xFF, 0x51, 0x9A, 0x84, 0x79, 0x94, 0x44, 0x19, 0xB7, 0x7A, 0x12, 0x66, 0x2A, 0x09,
-    0x1E, 0xA7, 0xB9, 0x5B, 0x86, 0x2D, 0x23, 0xF3, 0x05, 0x96, 0xFB, 0x2F, 0xFE, 0x35, 0x33, 0x1D,
-    0x73, 0xB1, 0xAB, 0x7C, 0x8A, 0xE1, 0x9C, 0x44, 0x9B, 0xEC, 0xE7, 0xCA, 0x4C, 0x06, 0x9B, 0xED,
-    0x83, 0x17, 0x3E, 0x82, 0x48, 0x27, 0x53, 0x58, 0x6E, 0x5F, 0x2D, 0x36, 0x48, 0x9C, 0x49, 0x1A,
-    0x8F, 0xB9, 0xC4, 0xE9, 0xCE, 0x91, 0x7F, 0xAD, 0x43, 0x3B, 0xED, 0x06, 0xD1, 0x31, 0x8C, 0x8C,
-    0x65, 0x57, 0x19, 0x4C, 0x39, 0x6C, 0x7E, 0xC0, 0x55, 0xB1, 0xC1, 0x35, 0x6F, 0x35, 0xC7, 0x6F,
-    0x3A, 0x19, 0xBE, 0xC1, 0x83, 0x32, 0x3F, 0xBA, 0x42, 0x97, 0x6D, 0x1A, 0x38, 0xEA, 0xF0, 0x44,
-    0x95, 0x93, 0xF3, 0x6B, 0x45, 0x48, 0xB7, 0x62, 0x50, 0x7D, 0xF8, 0xDC, 0x2D, 0xA0, 0xED, 0x7E,
-    0x3B, 0x31, 0x2A, 0x10, 0x65, 0x08, 0xBF, 0x4E, 0x40, 0x0F, 0x4C, 0x9F, 0x90, 0xA1, 0xF6, 0xE6,
-    0x47, 0xE4, 0x7E, 0xD6, 0xC4, 0x14, 0xF8, 0xFF, 0x03, 0x55, 0x64, 0x5B, 0x1E, 0x9C, 0xC4, 0xA0,
-    0xD3, 0x41, 0x67, 0xF3, 0xD4, 0xD7, 0xC7, 0x85, 0xCE, 0x92, 0x39, 0xF6, 0x4E, 0xD9, 0x80, 0x0C,
-    0xE7, 0x8C, 0x76, 0xA4, 0xDA, 0xD1, 0x8A, 0x61, 0x5A, 0x31, 0x44, 0xF5, 0x1E, 0x82, 0x82, 0x66,
-    0xEA, 0x38, 0xB3, 0x83, 0x29, 0x6F, 0xB7, 0x35, 0x04, 0x93, 0xAE, 0x8E, 0x1F, 0x26, 0x93, 0x6C,
-    0xE7, 0x3A, 0x79, 0xD7, 0x9A, 0xB4, 0x13, 0x54, 0x68, 0x81, 0x98, 0xAA, 0xB7, 0xE6, 0x61, 0x0B,
-    0x30, 0xFD, 0x2F, 0x70, 0xC6, 0x53, 0x40, 0x68, 0x7D, 0x3F, 0x19, 0xF3, 0x3D, 0x37, 0x63, 0xD3,
-    0xE4, 0x00, 0xFE, 0xF9, 0xBD, 0x55, 0x1D, 0xD2, 0x2D, 0x78, 0xA8, 0xAE, 0x54, 0xE7, 0x50, 0xF9,
-    0x4D, 0x07, 0xB3, 0x5F, 0x44, 0x3B, 0x61, 0x1A, 0xF5, 0x9B, 0x52, 0x99, 0xD3, 0x3D, 0x17, 0x0F,
-    0x9D, 0x2B, 0x68, 0x37, 0xDA, 0x2C, 0xDA, 0xFC, 0xA1, 0x72, 0xFD, 0x66, 0x9D, 0xC1, 0x8A, 0x70,
-    0xD0, 0x1C, 0xAB, 0xC1, 0x07, 0x9B, 0xBA, 0x26, 0x52, 0x2F, 0xC7, 0xD0, 0x68, 0x9B, 0xC2, 0x1F,
-    0x0B, 0x04, 0x77, 0xC8, 0x43, 0xA9, 0x7C, 0x94, 0x52, 0xA4, 0xD6, 0xD7, 0x45, 0x94, 0x54, 0x28,
-    0xD7, 0xA2, 0x28, 0x9F, 0x21, 0xBF, 0xBC, 0x09, 0x6D, 0x1B, 0x36, 0x3E, 0xC8, 0x17, 0xA0, 0xEF,
-    0x94, 0x33, 0x03, 0xA3, 0x94, 0x1A, 0x02, 0xDF, 0xEC, 0x26, 0xBC, 0xF1, 0xA4, 0x5E, 0x78, 0xBC,
-    0xC8, 0xAD, 0xAC, 0x5A, 0x2C, 0x26, 0xC1, 0xA4, 0x2B, 0xF0, 0x09, 0x67, 0x38, 0xC1, 0x1C, 0x09,
-    0x8F, 0x08, 0x79, 0x0A, 0x0E, 0xF1, 0x38, 0xB3, 0xEF, 0xA9, 0xD8, 0x4A, 0x2E, 0x55, 0x6E, 0x03,
-    0xA7, 0xB3, 0x97, 0x7C, 0xB5, 0x49, 0xFE, 0x4A, 0x87, 0x76, 0xD5, 0x9A, 0x55, 0xC8, 0x7C, 0x16,
-    0xAD, 0x4D, 0xDE, 0x9D, 0x9C, 0xC2, 0x47, 0x44, 0x9B, 0x8B, 0x64, 0xAD, 0xED, 0xA9, 0x58, 0x6E,
-    0x93, 0xFB, 0x2E, 0x9B, 0xDC, 0xF7, 0xCE, 0x93, 0xB8, 0x3B, 0x8A, 0xEC, 0xFB, 0x75, 0x32, 0x4F,
-    0xEE, 0x19, 0xE8, 0x01, 0xFA, 0x18, 0x87, 0xEC, 0x2F, 0x4C, 0x71, 0xDF, 0x6A, 0x40, 0x96, 0x2E,
-    0x96, 0x44, 0x9D, 0xFC, 0x66, 0x94, 0x04, 0x59, 0x28, 0x9F, 0x08, 0x63, 0x47, 0xF7, 0xD7, 0x13,
-    0x66, 0x11, 0x26, 0x11, 0x70, 0x48, 0xEC, 0xB7, 0x9D, 0xC4, 0x51, 0xD7, 0x62, 0x4A, 0xBB, 0xBD,
-    0xCC, 0x08, 0x3A, 0x99, 0x69, 0x49, 0x04, 0x1B, 0xAB, 0xEE, 0xF7, 0x3F, 0x49, 0x64, 0x97, 0x4D,
-    0x22, 0x5B, 0x91, 0xFE, 0xE9, 0x80, 0x85, 0xF1, 0xFE, 0x88, 0xAD, 0x7B, 0xB8, 0x2B, 0x46, 0xC6,
-    0xEE, 0xC1, 0x0E, 0x21, 0xEC, 0xB0, 0xB1, 0x25, 0x8E, 0x8D, 0x91, 0x70, 0x6C, 0x23, 0x5B, 0x7D,
-    0x75, 0x2C, 0xDD, 0xE1, 0xB5, 0xCB, 0x3C, 0x1F, 0x15, 0xDA, 0x0E, 0x4D, 0x6F, 0x32, 0xFC, 0xC9,
-    0x07, 0xF8, 0xCF, 0x7A, 0x2A, 0x1F, 0x1D, 0x9D, 0x57, 0x93, 0x21, 0x5E, 0xB5, 0xAF, 0x92, 0x97,
-    0xD2, 0x4E, 0xA4, 0x11, 0x21, 0x7C, 0x98, 0xA8, 0xA5, 0xC1, 0xE5, 0x81, 0x62, 0xD1, 0xB7, 0xF9,
-    0x3D, 0x54, 0xC6, 0x78, 0xA4, 0xD6, 0xA0, 0xB0, 0xA0, 0xFD, 0xE0, 0xE6, 0x55, 0x72, 0x9A, 0x42,
-    0xA0, 0x70, 0x85, 0x25, 0x4A, 0xDB, 0x0C, 0xCC, 0x7B, 0xFE, 0x37, 0xE8, 0x52, 0xAA, 0xE2, 0xD7,
-    0x9B, 0x54, 0x87, 0x52, 0x7D, 0xC6, 0xEE, 0x05, 0x51, 0xE8, 0x90, 0x67, 0x04, 0x96, 0xF8, 0xD5,
-    0x64, 0xD0, 0x1B, 0x04, 0x4F, 0x6E, 0x1E, 0x34, 0x44, 0x88, 0x4B, 0x76, 0x79, 0x0D, 0x66, 0x68,
-    0xDB, 0x05, 0xAF, 0x5B, 0x45, 0x58, 0xC4, 0xF5, 0x18, 0x1D, 0xEF, 0x53, 0xD1, 0xA5, 0xBD, 0x2E,
-    0xEF, 0x77, 0xFA, 0x82, 0xDC, 0x22, 0x37, 0xCB, 0x63, 0x5E, 0x0B, 0x89, 0x85, 0x5D, 0x7E, 0x08,
-    0x8B, 0xAC, 0x70, 0xC2, 0xA1, 0x8F, 0x46, 0x2F, 0x0F, 0x90, 0x4D, 0x89, 0xDD, 0x77, 0xBD, 0xE5,
-    0x04, 0xC6, 0xEE, 0x80, 0x2C, 0x30, 0x5F, 0x12, 0xC5, 0x3C, 0x61, 0x8A, 0xE1, 0x94, 0x9C, 0x91,
-    0xB3, 0xF2, 0x1F, 0xE7, 0x93, 0x28, 0x01, 0xD9, 0xDC, 0xED, 0x3E, 0x6B, 0x6C, 0x4E, 0xE1, 0xA2,
-    0xD8, 0x58, 0xFB, 0x2B, 0xF6, 0x66, 0x4E, 0x29, 0x76, 0x30, 0x41, 0x4A, 0x80, 0x23, 0xB9, 0xBF,
-    0x39, 0x21, 0xA8, 0xB2, 0x3C, 0x61, 0xB5, 0xCF, 0x31, 0x21, 0x9C, 0x44, 0x0A, 0x48, 0x9C, 0x4B,
-    0xEF, 0x18, 0x11, 0x2D, 0xAC, 0x6C, 0x32, 0x72, 0xCE, 0x19, 0xE1, 0xF6, 0x18, 0xF7, 0x38, 0x0F,
-    0x7E, 0xC1, 0x4E, 0x26, 0x64, 0x44, 0x0E, 0x66, 0xCE, 0x53, 0x85, 0x9C, 0x13, 0x23, 0xDB, 0x51,
-    0x4A, 0x53, 0x52, 0x6B, 0xB3, 0x6E, 0xB1, 0x7F, 0x07, 0x9C, 0xF7, 0x4D, 0x14, 0x59, 0x2F, 0xD4,
-    0x79, 0x43, 0xA1, 0xCE, 0x37, 0xA1, 0x6E, 0x0D, 0x92, 0x96, 0x78, 0x2E, 0xCA, 0xFC, 0xA6, 0x9F,
-    0x07, 0xB9, 0xDF, 0x0A, 0x33, 0x1F, 0xFF, 0x3C, 0xD3, 0xF4, 0x7F, 0x9C, 0x6F, 0xFA, 0xCD, 0x20,
-    0x73, 0x1E, 0xA5, 0x03, 0xA1, 0x4E, 0x36, 0xE3, 0xCE, 0xE6, 0x90, 0xE1, 0xBA, 0x93, 0x37, 0x1C,
-    0xAB, 0xF8, 0xDD, 0xE4, 0xD9, 0x92, 0xCE, 0xE8, 0xC6, 0xC3, 0xD0, 0x40, 0x12, 0xDD, 0xC5, 0x12,
-    0xFC, 0x8E, 0xE7, 0x5B, 0x3A, 0x28, 0xA9, 0x1A, 0x2F, 0xC2, 0xEE, 0xA4, 0xCD, 0x28, 0x91, 0xB2,
-    0x9C, 0xC3, 0x7E, 0x6A, 0x38, 0x52, 0xDA, 0xAF, 0x8B, 0x35, 0x7B, 0x66, 0x09, 0xF6, 0x58, 0xCC,
-    0x67, 0x1F, 0x5D, 0x64, 0x70, 0x17, 0xED, 0x6C, 0xCA, 0x14, 0x3A, 0x58, 0xD7, 0xB9, 0x0D, 0xAA,
-    0x8F, 0x17, 0xC6, 0x43, 0xAD, 0xE6, 0x88, 0x04, 0x6F, 0x5D, 0x7E, 0x4B, 0x38, 0xB2, 0x73, 0x73,
-    0xE5, 0xB2, 0xE8, 0xA0, 0x2E, 0x4A, 0x88, 0x44, 0x0B, 0xBE, 0xA8, 0x61, 0x5E, 0xF4, 0xD0, 0x26,
-    0x41, 0x49, 0x02, 0x98, 0xD2, 0x7E, 0x9F, 0x0F, 0xF4, 0xBD, 0xAB, 0xFD, 0x2F, 0xF6, 0x48, 0xA2,
-    0x11, 0xAD, 0x12, 0xA3, 0x93, 0x41, 0xA5, 0xF4, 0x4D, 0xC2, 0xC1, 0xCC, 0xE7, 0x7D, 0xAB, 0x14,
-    0x50, 0xBB, 0x40, 0x5F, 0x02, 0xFD, 0x22, 0x70, 0xCE, 0x01, 0x5F, 0xFB, 0xD5, 0xED, 0x2C, 0xF8,
-    0xC1, 0x46, 0x02, 0xD7, 0xD1, 0xA1, 0xF2, 0xC6, 0x94, 0x91, 0x72, 0x9A, 0x66, 0x17, 0xE6, 0x85,
-    0x84, 0x5F, 0x01, 0x52, 0x09, 0x97, 0x3A, 0x5E, 0x9A, 0x80, 0xA9, 0x23, 0xA6, 0x0E, 0x99, 0xFD,
-    0x98, 0x39, 0x15, 0xBC, 0x5B, 0x07, 0xD2, 0x0B, 0x08, 0xA4, 0x55, 0x58, 0x37, 0x4C, 0x18, 0x5C,
-    0xFA, 0x98, 0x9D, 0xF7, 0x5F, 0xDE, 0x12, 0x53, 0xE3, 0xF8, 0x94, 0xAD, 0x6B, 0x63, 0x87, 0xEB,
-    0xA9, 0x9B, 0xD8, 0xE1, 0x16, 0xB4, 0xCB, 0x6E, 0x56, 0xE5, 0xC7, 0x53, 0x43, 0xD4, 0xE8, 0xD3,
-    0xA5, 0xA6, 0xAC, 0xA7, 0x38, 0x6B, 0x74, 0x7C, 0x5B, 0xB0, 0x54, 0xAA, 0x32, 0xD5, 0x5E, 0x41,
-    0xE2, 0x9C, 0x63, 0x4A, 0x9F, 0xEB, 0xE0, 0xDB, 0xEF, 0x1C, 0xE9, 0x0A, 0xDD, 0xCD, 0x72, 0x01,
-    0x1F, 0x49, 0x81, 0xBA, 0x0F, 0x92, 0x0B, 0x54, 0x3E, 0x28, 0xB5, 0x55, 0xF6, 0xEA, 0xFB, 0xD4,
-    0x0B, 0xF4, 0x07, 0x96, 0x90, 0x83, 0xD7, 0x5B, 0x48, 0x1E, 0xFC, 0x16, 0x56, 0xA9, 0xD7, 0xF2,
-    0x5E, 0xDA, 0xB5, 0x71, 0x9F, 0x5B, 0x04, 0x5C, 0x05, 0x7B, 0x8C, 0x2D, 0xB0, 0xBA, 0xA5, 0x06,
-    0x93, 0x06, 0x97, 0x31, 0x7A, 0x9D, 0x27, 0xDC, 0xB3, 0xAD, 0x77, 0x93, 0xE3, 0x86, 0x5F, 0x63,
-    0xD1, 0x22, 0x96, 0xEA, 0xC8, 0x2A, 0xFF, 0xDF, 0x20, 0xBD, 0x36, 0x39, 0xB3, 0xA8, 0x5E, 0x11,
-    0x03, 0xAC, 0xC7, 0x0B, 0x96, 0xFA, 0xC5, 0xBD, 0x9E, 0x46, 0x82, 0x84, 0x01, 0x07, 0xD9, 0xF9,
-    0x32, 0x5E, 0xF1, 0x33, 0x86, 0xEC, 0x64, 0x8C, 0xC5, 0x8B, 0xB9, 0xBF, 0x29, 0xB8, 0x1A, 0x1A,
-    0xDD, 0x4B, 0x7A, 0x47, 0xF7, 0x85, 0xE9, 0x67, 0xC8, 0xE0, 0xD7, 0x0A, 0x18, 0x74, 0x80, 0x9E,
-    0xA6, 0x63, 0x63, 0x7D, 0x31, 0x8F, 0x9B, 0x88, 0x63, 0x50, 0xC1, 0xF0, 0xBB, 0x0C, 0x7F, 0x95,
-    0xE1, 0x2F, 0x00, 0xE0, 0x3F, 0xD7, 0xD1, 0xA9, 0xE4, 0xB5, 0xE1, 0x07, 0x4D, 0xB3, 0xE1, 0x93,
-    0xF1, 0xA5, 0x9F, 0x9F, 0x36, 0x7C, 0x5B, 0xDC, 0x3E, 0xD5, 0x32, 0xE8, 0x14, 0xA0, 0x7A, 0xF8,
-    0xFA, 0x45, 0x83, 0xB8, 0x3B, 0xD9, 0xE2, 0xEF, 0xDA, 0xE1, 0xB5, 0xC7, 0xF7, 0x5D, 0x7E, 0x2A,
-    0x4A, 0x78, 0xD1, 0x3A, 0x18, 0x97, 0x23, 0xB8, 0xED, 0x39, 0xD9, 0x1D, 0xF1, 0x5C, 0x27, 0x79,
-    0x97, 0x42, 0xEF, 0x78, 0x8D, 0x69, 0xAF, 0x03, 0x2E, 0xFA, 0x72, 0xD5, 0x97, 0xB8, 0xEC, 0x4B,
-    0x5C, 0xF7, 0x1D, 0x17, 0xFC, 0xA9, 0xC1, 0x14, 0x40, 0x42, 0xF9, 0x86, 0xF3, 0xFB, 0xA4, 0x3F,
-    0x70, 0xBD, 0x5A, 0xCF, 0x7F, 0x5E, 0x00, 0x78, 0x92, 0x80, 0xFB, 0xCD, 0x7E, 0x3C, 0x5D, 0x35,
-    0xE7, 0x95, 0x3A, 0xAD, 0xF2, 0x7A, 0x69, 0xA5, 0x89, 0xDF, 0xA6, 0x45, 0x7E, 0x74, 0x81, 0xB1,
-    0xDD, 0x60, 0xD9, 0x31, 0x82, 0xE2, 0x3C, 0xBD, 0x7E, 0x85, 0x43, 0xE5, 0x2F, 0x58, 0x46, 0xC1,
-    0x83, 0xDE, 0x1E, 0x4D, 0x62, 0xB3, 0x7E, 0x61, 0xDC, 0x19, 0x7A, 0x75, 0x7C, 0x9E, 0x4B, 0x0C,
-    0xCA, 0xA8, 0x42, 0xD2, 0xCE, 0xD4, 0x2C, 0x78, 0x5D, 0xF9, 0xA2, 0x73, 0x67, 0x0F, 0x2C, 0xA9,
-    0x22, 0x6A, 0x87, 0x2D, 0x17, 0x7B, 0x63, 0x97, 0xA1, 0x42, 0x6C, 0x8E, 0x1F, 0x87, 0x71, 0x3F,
-    0xBC, 0xB5, 0xC4, 0xA6, 0x2B, 0xC5, 0x42, 0x65, 0x6F, 0x8D, 0x20, 0x71, 0x90, 0xEB, 0x24, 0xDD,
-    0x4F, 0x74, 0xFD, 0x7A, 0x51, 0xBF, 0x6C, 0x8C, 0xDA, 0x26, 0xDB, 0x1B, 0x2B, 0x82, 0xE7, 0xBF,
-    0x1A, 0x1F, 0x0D, 0x47, 0x2D, 0xA6, 0xC5, 0x30, 0xB7, 0x8A, 0x28, 0x8F, 0xDA, 0x41, 0x76, 0x2C,
-    0xD6, 0x35, 0x47, 0xE2, 0xAA, 0x23, 0x49, 0xDD, 0x51, 0x2A, 0x8F, 0x66, 0xB3, 0xD4, 0x1A, 0xBF,
-    0xB1, 0xF6, 0x70, 0xED, 0x13, 0x63, 0x1C, 0xD9, 0xD0, 0x79, 0xBC, 0x8B, 0x73, 0x2E, 0xE7, 0x0C,
-    0xD5, 0x1B, 0xCC, 0xA4, 0xD2, 0xD9, 0x1A, 0x9E, 0xF8, 0x0F, 0xB7, 0x3F, 0xE4, 0x44, 0xBA, 0x9F,
-    0x47, 0x8F, 0xD7, 0x9C, 0x56, 0xD7, 0xC5, 0xC2, 0x79, 0x40, 0xEE, 0x97, 0x5D, 0xAA, 0x59, 0xED,
-    0xB1, 0x38, 0xE4, 0xFF, 0x95, 0x57, 0x3F, 0x6C, 0x64, 0x47, 0x19, 0xFF, 0xDE, 0xBE, 0xB5, 0x1F,
-    0xDC, 0x13, 0x9E, 0x2B, 0x2E, 0x28, 0x0A, 0xB9, 0x7D, 0x14, 0x20, 0x1D, 0xD6, 0xDA, 0x2F, 0x45,
-    0x90, 0x5C, 0xEC, 0xEE, 0x4C, 0x4C, 0x71, 0xC5, 0x15, 0x5C, 0x11, 0x4B, 0x48, 0x14, 0x5C, 0x41,
-    0x03, 0x48, 0xB8, 0x49, 0x61, 0x21, 0x5F, 0xDE, 0x90, 0x2B, 0xAE, 0x48, 0xE1, 0xAD, 0x91, 0xA2,
-    0xAC, 0x44, 0x0A, 0x70, 0x04, 0x77, 0x45, 0x0A, 0x04, 0xB6, 0xDF, 0x70, 0x57, 0x52, 0xE4, 0x5D,
-    0x84, 0x44, 0x05, 0x79, 0xC0, 0x89, 0x06, 0x9D, 0x32, 0x88, 0x8D, 0xB4, 0x46, 0x6F, 0x77, 0xF8,
-    0x7D, 0xF3, 0x76, 0xED, 0xB5, 0x9D, 0x9C, 0x37, 0xF3, 0x7F, 0xBE, 0xF9, 0x66, 0xE6, 0xFB, 0x3F,
-    0xEF, 0xDD, 0x1E, 0x5C, 0x48, 0x44, 0x74, 0xA7, 0xBF, 0xAA, 0x05, 0xA5, 0xFA, 0xC7, 0xFD, 0x2B,
-    0xF4, 0xBC, 0xCC, 0x29, 0x54, 0x54, 0xE4, 0x76, 0x50, 0xFC, 0x92, 0x06, 0xCF, 0xCD, 0x9C, 0x22,
-    0x7A, 0x99, 0xE4, 0xE8, 0xE5, 0x1B, 0xD1, 0x0D, 0x7A, 0x7E, 0x46, 0xCA, 0xAA, 0xAC, 0x5A, 0xFD,
-    0xD5, 0xAC, 0x77, 0xCE, 0xE5, 0x6E, 0xB2, 0xBA, 0xBF, 0xDF, 0x97, 0xCE, 0x95, 0xBC, 0x8E, 0x31,
-    0xD2, 0x00, 0x53, 0x24, 0x4B, 0x75, 0x7A, 0x61, 0x8B, 0xD3, 0xED, 0xB3, 0xC0, 0x8D, 0xF6, 0x17,
-    0xCD, 0x2F, 0x6C, 0xBD, 0x2E, 0xDD, 0xD8, 0x9F, 0x37, 0x1D, 0x04, 0x5A, 0xE8, 0x0E, 0xED, 0xD0,
-    0x11, 0xE5, 0x2A, 0x53, 0x2D, 0x5A, 0xA3, 0x4C, 0x65, 0x3A, 0xD5, 0xB1, 0x12, 0x74, 0x40, 0xFD,
-    0x0B, 0xF3, 0x16, 0xE6, 0xB9, 0x3A, 0xC2, 0x8E, 0x0E, 0x09, 0x1D, 0x20, 0xDF, 0x11, 0x6F, 0x95,
-    0x9D, 0x58, 0xED, 0x08, 0x3A, 0x4A, 0x4C, 0xFE, 0x83, 0x32, 0xFB, 0x6E, 0xD9, 0x5A, 0xD6, 0x6B,
-    0xB1, 0xC6, 0x20, 0xDB, 0xB3, 0xE9, 0x7D, 0x1B, 0x6F, 0x96, 0x22, 0x34, 0x07, 0x09, 0xF5, 0xAF,
-    0xD1, 0x29, 0xFC, 0xED, 0x13, 0xB8, 0x02, 0xBC, 0x15, 0x31, 0x1C, 0xDB, 0x71, 0x08, 0x8E, 0xC2,
-    0x81, 0xE2, 0x2D, 0x1B, 0xE8, 0xAF, 0xD3, 0x5D, 0xE2, 0xD2, 0x99, 0x16, 0x79, 0x54, 0x49, 0x57,
-    0x7D, 0xB3, 0xF3, 0x3D, 0x06, 0x1E, 0xF9, 0x72, 0x78, 0x06, 0x61, 0x5A, 0x36, 0x88, 0x85, 0x8D,
-    0xF2, 0x8D, 0xD3, 0x55, 0xEC, 0xC2, 0x5E, 0x9C, 0xC0, 0xD3, 0x7A, 0x7B, 0x67, 0x86, 0xD6, 0xF1,
-    0xD3, 0xBB, 0x74, 0xB5, 0xD3, 0x64, 0x1C, 0x57, 0x61, 0x30, 0x45, 0xBB, 0x4B, 0x71, 0x29, 0xAB,
-    0x6C, 0x9C, 0x4F, 0xF2, 0x49, 0x36, 0x96, 0x95, 0x80, 0xF8, 0x6F, 0xFB, 0x95, 0xAC, 0xA0, 0x6C,
-    0x4C, 0xD9, 0x84, 0xB2, 0x92, 0xDE, 0x84, 0x71, 0x79, 0xA5, 0xAC, 0x53, 0xA6, 0x33, 0x2D, 0x15,
-    0x8F, 0x7E, 0x97, 0xFD, 0x7C, 0x82, 0x22, 0x15, 0x4B, 0xBA, 0x05, 0xC0, 0x8F, 0x48, 0xEA, 0x5C,
-    0x39, 0x92, 0xC6, 0xB7, 0x2A, 0xE3, 0x5B, 0xCF, 0x6D, 0x23, 0xCA, 0x87, 0x03, 0x1A, 0x2C, 0x60,
-    0x75, 0xD9, 0x88, 0x6E, 0xD0, 0x02, 0x16, 0xE7, 0xEC, 0x2C, 0x5F, 0x6E, 0xF5, 0xAE, 0x34, 0xC4,
-    0x79, 0x11, 0xDC, 0xDC, 0xD2, 0x2B, 0x9C, 0x17, 0xC1, 0xAD, 0x53, 0x38, 0xA1, 0x88, 0x59, 0x14,
-    0x7B, 0x46, 0xF0, 0x3C, 0x8D, 0x8A, 0x35, 0xEE, 0x65, 0x58, 0x76, 0xB8, 0xEF, 0x85, 0xF6, 0x8D,
-    0x69, 0x6F, 0xEB, 0xFE, 0x3F, 0x45, 0xBD, 0xFE, 0xCF, 0x47, 0xC7, 0x94, 0xF6, 0xD3, 0xE8, 0x2F,
-    0x7B, 0x1F, 0xEB, 0xF1, 0x48, 0xBC, 0xBB, 0x97, 0x46, 0x7F, 0xB4, 0x77, 0x1B, 0x93, 0x16, 0x96,
-    0x6C, 0x0F, 0x0A, 0xEC, 0xA1, 0x97, 0x44, 0x3B, 0xBD, 0xF0, 0xBF, 0x25, 0x7A, 0x5B, 0xF7, 0x41,
-    0xD9, 0xF3, 0xEB, 0xA1, 0x49, 0xA3, 0x8F, 0x6C, 0x97, 0x22, 0x9D, 0xDC, 0x32, 0xC3, 0x03, 0x12,
-    0x14, 0x41, 0x6D, 0x96, 0x2E, 0xA6, 0x19, 0x89, 0x73, 0x54, 0xCE, 0x11, 0x3A, 0x47, 0xEB, 0x1C,
-    0xB9, 0x73, 0x14, 0xCF, 0x11, 0x7D, 0x42, 0xF7, 0xD7, 0x8A, 0xE0, 0x88, 0x6A, 0xD2, 0x0F, 0xAB,
-    0xE8, 0xDF, 0xA6, 0xA6, 0x7E, 0xD8, 0x15, 0xF7, 0xAC, 0x67, 0xE0, 0x1F, 0x56, 0x26, 0x9B, 0x76,
-    0xC6, 0x43, 0xFA, 0xDA, 0xB0, 0x66, 0x03, 0xC3, 0x60, 0x58, 0x73, 0x52, 0x0F, 0x99, 0x99, 0x29,
-    0x2E, 0xF3, 0xF3, 0xC4, 0xF6, 0xE0, 0x23, 0x35, 0x4B, 0xA3, 0xDD, 0xF8, 0x71, 0x51, 0x73, 0x25,
-    0x87, 0x0D, 0xA7, 0xE6, 0x18, 0x4A, 0x8A, 0xD4, 0x48, 0x2D, 0xA9, 0x4B, 0xBB, 0x3C, 0x7B, 0x32,
-    0x4E, 0x1F, 0x55, 0xF2, 0xDE, 0x48, 0x86, 0xB6, 0x1B, 0x16, 0xBB, 0x91, 0xA9, 0x81, 0xC0, 0x7A,
-    0x54, 0x01, 0x11, 0x0B, 0x1A, 0x4B, 0x40, 0x0F, 0x0B, 0xEC, 0x88, 0xCC, 0xEE, 0x94, 0x13, 0x2D,
-    0x8D, 0x30, 0x71, 0x11, 0x96, 0x0D, 0x44, 0x29, 0x46, 0x7B, 0x5C, 0x09, 0x53, 0xC5, 0xC5, 0x61,
-    0x58, 0xF6, 0x1A, 0xE5, 0x3A, 0xD5, 0x40, 0x0D, 0x30, 0x23, 0x56, 0x8C, 0x7B, 0xC8, 0xE8, 0x3D,
-    0xDE, 0xB1, 0xDE, 0x28, 0x4F, 0xE8, 0xA9, 0x28, 0x18, 0x53, 0xF8, 0x09, 0x45, 0x1F, 0x2A, 0x71,
-    0xD3, 0x24, 0x61, 0xD9, 0x0D, 0x2C, 0x0D, 0x1A, 0x65, 0x6C, 0x12, 0x50, 0x99, 0xC1, 0x2B, 0x84,
-    0x09, 0x0B, 0xB2, 0x74, 0x75, 0x03, 0xD1, 0x47, 0x28, 0x1C, 0x62, 0x43, 0x1B, 0x95, 0xC2, 0x24,
-    0xF0, 0xC8, 0xAB, 0x38, 0xE1, 0x03, 0x88, 0xAA, 0x51, 0x35, 0x8A, 0xB4, 0x51, 0xC5, 0x26, 0x36,
-    0xA3, 0x94, 0x1A, 0x16, 0xC1, 0x89, 0x0E, 0xD0, 0x51, 0x1A, 0x1B, 0x5A, 0x8F, 0x3F, 0x89, 0x8A,
-    0x6C, 0x13, 0xAE, 0xEA, 0x1B, 0xC9, 0x53, 0xBF, 0xE0, 0x51, 0x3C, 0x72, 0x6C, 0x3E, 0x48, 0xC9,
-    0x1F, 0xE0, 0x8F, 0x22, 0x1A, 0x91, 0xCA, 0x1E, 0x57, 0x28, 0xF2, 0x9E, 0x2F, 0xDF, 0x19, 0xC9,
-    0xCD, 0x51, 0xBA, 0x39, 0x84, 0xE0, 0x93, 0xC0, 0x26, 0xC4, 0x65, 0x85, 0x6C, 0x93, 0x7D, 0x9F,
-    0x5A, 0xC1, 0x7B, 0x8C, 0x03, 0xE4, 0xCD, 0xD1, 0x94, 0xAD, 0x65, 0x37, 0xA2, 0xF4, 0xD3, 0x5C,
-    0x49, 0x93, 0x14, 0xF2, 0x17, 0x7B, 0x76, 0x29, 0xFD, 0xD0, 0x52, 0xC2, 0xF5, 0xDD, 0x92, 0x92,
-    0xCC, 0x90, 0x98, 0xC0, 0xA2, 0x20, 0x06, 0x01, 0xE5, 0xB0, 0x59, 0x05, 0xD3, 0x8D, 0x2D, 0x16,
-    0x9D, 0x99, 0x56, 0x3D, 0x8B, 0xF6, 0x0A, 0xA1, 0x5E, 0x33, 0xB3, 0x4D, 0x36, 0xB6, 0x0E, 0x36,
-    0x05, 0x36, 0x9C, 0x6C, 0xE5, 0x86, 0xB6, 0xDD, 0x31, 0x20, 0xD7, 0xF8, 0x84, 0xFD, 0xF7, 0x38,
-    0x0A, 0x38, 0x57, 0xC0, 0x6A, 0xB7, 0x7E, 0x52, 0xF9, 0xA3, 0x53, 0xEF, 0xF3, 0x21, 0x0E, 0x7A,
-    0x95, 0xE8, 0x21, 0x51, 0x41, 0x0D, 0xC3, 0x6F, 0x59, 0x4C, 0xB4, 0x42, 0xD4, 0xF6, 0xA1, 0x11,
-    0xB2, 0x7A, 0x46, 0x8D, 0x3F, 0x51, 0x78, 0x53, 0xC5, 0xA1, 0xF9, 0x4A, 0x50, 0xB4, 0xC9, 0x6E,
-    0xD0, 0x1B, 0x0F, 0x39, 0xE2, 0x85, 0xB5, 0x19, 0x6F, 0x96, 0x6C, 0x43, 0xC1, 0xDF, 0x3F, 0x62,
-    0xFB, 0x68, 0x8C, 0x3F, 0xF6, 0xFA, 0xDB, 0x9E, 0xA8, 0xD3, 0xAE, 0x71, 0x5C, 0x03, 0x9F, 0x78,
-    0x14, 0xAA, 0x35, 0x0C, 0x53, 0x48, 0xD0, 0x75, 0x61, 0x53, 0x44, 0xD7, 0xDB, 0xED, 0x95, 0x95,
-    0xEB, 0x24, 0xDF, 0x19, 0x27, 0x7F, 0xCD, 0x29, 0x76, 0x4F, 0x97, 0x41, 0xFA, 0xB2, 0xEB, 0x07,
-    0xF9, 0x53, 0x92, 0xCF, 0xC6, 0xC9, 0xDF, 0x1C, 0xB5, 0xDA, 0x1D, 0xB1, 0x02, 0xCF, 0xEA, 0x36,
-    0x9B, 0xBC, 0xAF, 0xC7, 0xF4, 0x53, 0x5E, 0x39, 0x9F, 0xF9, 0x40, 0x50, 0xB4, 0x03, 0x1F, 0x80,
-    0xED, 0xC3, 0xE6, 0x61, 0xEB, 0x2C, 0xBA, 0xD6, 0x25, 0xE0, 0x7C, 0x9C, 0xFF, 0x39, 0x57, 0xE7,
-    0xF2, 0xAF, 0x01, 0x3D, 0x0F, 0x33, 0x39, 0x02, 0xB3, 0x74, 0x5F, 0x75, 0x74, 0x2E, 0xAF, 0x3A,
-    0x79, 0x01, 0xD6, 0x60, 0xD8, 0x2C, 0x45, 0xAE, 0x08, 0xDC, 0x90, 0xD2, 0x7F, 0x55, 0xF1, 0x31,
-    0x87, 0x73, 0x27, 0x4A, 0x09, 0x2F, 0xCB, 0x05, 0x9C, 0x6D, 0x49, 0xE5, 0xAF, 0xA9, 0x14, 0x26,
-    0x05, 0x37, 0x64, 0xA5, 0x3A, 0xAF, 0xDB, 0xC6, 0xD8, 0x03, 0xE2, 0xA1, 0x1F, 0x41, 0xD1, 0xA2,
-    0xF0, 0x72, 0x12, 0x35, 0x93, 0xDC, 0x35, 0x89, 0x96, 0x4E, 0xFD, 0x16, 0x52, 0x79, 0x49, 0xCD,
-    0x76, 0xCF, 0x3A, 0x3C, 0x17, 0xA9, 0x3E, 0x13, 0xAF, 0x40, 0x49, 0x3C, 0x64, 0x3A, 0x86, 0xA0,
-    0x02, 0x8D, 0xCE, 0x23, 0x0B, 0x0A, 0x6E, 0x42, 0x8D, 0xCE, 0x37, 0x50, 0x68, 0x63, 0x1C, 0x96,
-    0xB8, 0x19, 0x8D, 0xD4, 0x68, 0xBA, 0x04, 0x83, 0xEF, 0x70, 0x83, 0x1B, 0xD5, 0xEC, 0x36, 0x28,
-    0xD0, 0x31, 0x79, 0xBE, 0x39, 0xA2, 0x68, 0x2E, 0x38, 0x66, 0x26, 0x1F, 0x51, 0xF6, 0x78, 0x9C,
-    0x6B, 0xF9, 0xF6, 0x10, 0xE6, 0x7D, 0xDF, 0x82, 0x5D, 0x75, 0x07, 0x9E, 0xA5, 0x28, 0x29, 0x53,
-    0x45, 0x69, 0x91, 0x32, 0x7D, 0x09, 0x05, 0x13, 0x28, 0x1E, 0xFB, 0xD1, 0x18, 0xD8, 0x1B, 0x14,
-    0xD3, 0x9C, 0x33, 0xF4, 0x58, 0x83, 0x80, 0xA4, 0x64, 0xCC, 0xD2, 0xFB, 0xF9, 0xE9, 0x15, 0xBF,
-    0xDF, 0x7A, 0x9F, 0xF0, 0x69, 0xE3, 0x2B, 0x2C, 0x9A, 0x12, 0xF7, 0xDB, 0x5A, 0x06, 0xD4, 0x99,
-    0xD6, 0x9D, 0xDA, 0xF3, 0xC9, 0xD6, 0x15, 0x9A, 0x67, 0x0E, 0x58, 0xFD, 0xBE, 0xE2, 0x2A, 0x6F,
-    0xFF, 0x90, 0xA0, 0x73, 0x13, 0xDA, 0x7E, 0xE0, 0x4C, 0x1C, 0x43, 0x36, 0xB1, 0x2B, 0xE7, 0x2A,
-    0xCF, 0x19, 0xAE, 0xE2, 0xF8, 0x75, 0x8A, 0xE1, 0x13, 0x97, 0x55, 0x81, 0xFA, 0x20, 0x86, 0x68,
-    0xC0, 0xD4, 0xF2, 0xFE, 0xBE, 0x4E, 0xE1, 0x96, 0x79, 0xD5, 0x21, 0x77, 0xAE, 0x66, 0x55, 0x17,
-    0x34, 0xC3, 0x13, 0xE1, 0xBA, 0xFB, 0xF0, 0xCB, 0x07, 0x0E, 0x77, 0x44, 0xB8, 0x8B, 0xF5, 0x73,
-    0x5A, 0x8D, 0xB8, 0xE5, 0x0C, 0xD3, 0x87, 0x8F, 0xB9, 0xFA, 0xB1, 0xA0, 0x66, 0xB7, 0xB9, 0xDE,
-    0xEE, 0xC8, 0x67, 0x13, 0x78, 0xC6, 0xB2, 0x7B, 0x2A, 0x7F, 0x33, 0xBE, 0xDE, 0xEE, 0xB0, 0x65,
-    0xF4, 0xE8, 0x25, 0x1F, 0x76, 0xA5, 0x9E, 0xB3, 0x0A, 0x3C, 0xA7, 0x80, 0x18, 0x09, 0x91, 0x5C,
-    0x67, 0x19, 0x4F, 0x8D, 0x61, 0x1B, 0xA6, 0x15, 0x4D, 0xDE, 0x87, 0xE0, 0x35, 0x3E, 0x45, 0xD8,
-    0xAC, 0xD4, 0x0F, 0x21, 0x1F, 0x4D, 0x0B, 0x26, 0x8F, 0x8C, 0x50, 0x2F, 0x74, 0xA2, 0x70, 0x40,
-    0x74, 0xFC, 0x7D, 0xC4, 0xB5, 0xDC, 0xCD, 0xED, 0x7F, 0x2E, 0xA1, 0x97, 0x22, 0xA4, 0xA1, 0xCE,
-    0xEE, 0xAB, 0x6C, 0x8F, 0x64, 0xED, 0xA8, 0xED, 0x99, 0xAF, 0x3E, 0x9C, 0x7A, 0x31, 0x07, 0x29,
-    0xEF, 0xC8, 0xF1, 0x2D, 0x2D, 0x92, 0xA2, 0x95, 0x96, 0x6B, 0xDE, 0x3C, 0x02, 0xE4, 0xB4, 0x14,
-    0xF4, 0x66, 0x25, 0xE8, 0xA1, 0xFC, 0x29, 0xD9, 0xB8, 0x42, 0x04, 0x86, 0xEC, 0x82, 0x2D, 0xC5,
-    0xB1, 0x6F, 0x0C, 0x5A, 0xB7, 0xB6, 0x0B, 0x0E, 0x1E, 0x43, 0x44, 0x36, 0x3E, 0x98, 0xD3, 0x0D,
-    0x6A, 0xEE, 0xD2, 0xFA, 0x86, 0x4D, 0x7E, 0x66, 0x43, 0xA7, 0xFF, 0xE7, 0x0E, 0x9D, 0x1B, 0xE3,
-    0x59, 0x14, 0x7F, 0x28, 0x7B, 0x1B, 0xC3, 0x2F, 0xED, 0xDE, 0xF6, 0xD6, 0x74, 0xE5, 0x5C, 0xE4,
-    0x5D, 0x82, 0xC0, 0xEB, 0xD1, 0x29, 0x84, 0x13, 0xBB, 0xE1, 0x0C, 0xAF, 0xF6, 0x3E, 0x7E, 0x30,
-    0xFD, 0x43, 0x3A, 0x7D, 0x4B, 0xFD, 0x73, 0x5A, 0xBF, 0xA8, 0xF5, 0xA3, 0x5A, 0xBF, 0xAB, 0x9C,
-    0x82, 0x3E, 0x3B, 0xE9, 0x90, 0x9B, 0xD1, 0x6C, 0xC4, 0xF4, 0xE3, 0xAA, 0x6F, 0xF1, 0x1D, 0x39,
-    0x1F, 0x8B, 0x67, 0x43, 0xE3, 0xE9, 0x6B, 0xFA, 0x18, 0xE0, 0x23, 0xE9, 0xE9, 0x8E, 0x70, 0xE6,
-    0x88, 0x20, 0xE6, 0xC5, 0xB3, 0x3B, 0x72, 0x86, 0x5D, 0xBB, 0x70, 0x47, 0xE8, 0xEF, 0x50, 0x5E,
-    0xD0, 0x6B, 0x27, 0x3B, 0x9C, 0x82, 0xB7, 0x66, 0x33, 0x75, 0xA6, 0x8A, 0xCD, 0x28, 0xFD, 0x4C,
-    0x63, 0x68, 0xD5, 0x66, 0x77, 0xF2, 0x11, 0xE1, 0x29, 0xA8, 0xA9, 0x1F, 0x9D, 0x44, 0xFA, 0x33,
-    0x09, 0x21, 0xA0, 0x37, 0xA5, 0x8A, 0x1B, 0x3F, 0x3D, 0x9F, 0x3E, 0x8F, 0xAD, 0xAB, 0x4B, 0x01,
-    0x55, 0x2B, 0x71, 0x31, 0x5E, 0x11, 0xC5, 0xC1, 0x4A, 0xC4, 0x61, 0xC3, 0x3F, 0x55, 0xFB, 0x0F,
-    0xF6, 0xFB, 0x8E, 0x3D, 0xAA, 0x55, 0xCF, 0xAF, 0xAD, 0x04, 0xEA, 0x0C, 0xDE, 0x39, 0x1E, 0xA6,
-    0x33, 0x75, 0x91, 0x07, 0xAC, 0x68, 0xA9, 0xBD, 0xB6, 0xFD, 0x68, 0x09, 0x62, 0xE3, 0x5E, 0xAA,
-    0x26, 0x7D, 0x79, 0x3A, 0xF2, 0xDF, 0xB3, 0x65, 0xFD, 0xBD, 0xBA, 0xD0, 0x77, 0xB2, 0x35, 0xAF,
-    0x70, 0x5E, 0xE8, 0x3B, 0x19, 0x6F, 0x43, 0x82, 0xFF, 0xA7, 0x2B, 0x74, 0x39, 0xEE, 0x12, 0xF1,
-    0xFF, 0x29, 0xFE, 0x0F, 0xCA, 0xCB, 0x71, 0x05, 0x7D, 0xDB, 0x0C, 0x06, 0xAB, 0x7A, 0x91, 0x73,
-    0x8F, 0x68, 0x51, 0xDE, 0xFE, 0x0F, 0xED, 0x54, 0x31, 0x6C, 0xD3, 0x40, 0x14, 0x7D, 0x67, 0x2B,
-    0xB1, 0xA8, 0x81, 0xEB, 0x50, 0x4B, 0x20, 0x51, 0x7D, 0xC6, 0x0E, 0x90, 0x63, 0x60, 0x00, 0x29,
-    0x3E, 0x1F, 0x42, 0xA8, 0x03, 0x4B, 0x86, 0x7A, 0xEE, 0xC0, 0x44, 0x97, 0x32, 0x56, 0xA8, 0x89,
-    0x4F, 0x62, 0x60, 0xCD, 0xC4, 0x9C, 0xA1, 0x13, 0x0C, 0x61, 0x60, 0x88, 0x44, 0x45, 0x4E, 0x62,
-    0x60, 0x3D, 0x89, 0x91, 0xA1, 0x1E, 0xD8, 0x9B, 0x21, 0xA0, 0x0C, 0x4D, 0xCD, 0x37, 0x4D, 0x5B,
-    0x2A, 0x84, 0x84, 0x98, 0xF1, 0x7F, 0xB6, 0xEE, 0xFE, 0xFF, 0xFE, 0xF7, 0xFE, 0x7F, 0x96, 0xC5,
-    0x1E, 0x64, 0x85, 0x4C, 0x5A, 0x1D, 0xBB, 0x5E, 0xEC, 0xCF, 0xC0, 0x5B, 0x25, 0x2D, 0x87, 0xC4,
-    0x06, 0x96, 0xA0, 0xD0, 0x00, 0x50, 0x80, 0xCE, 0x4C, 0x99, 0xB1, 0x47, 0x02, 0xF4, 0x80, 0x63,
-    0x84, 0x1F, 0x10, 0x69, 0x5C, 0xD6, 0xB8, 0xAB, 0x31, 0xAE, 0xCA, 0xA4, 0x30, 0xD0, 0x10, 0x95,
-    0x43, 0x6E, 0x1A, 0x39, 0xA8, 0x62, 0x98, 0x1B, 0x01, 0xD6, 0x00, 0x75, 0x8C, 0x15, 0x65, 0x21,
-    0xDD, 0x9A, 0x74, 0x6D, 0xB2, 0xD9, 0x31, 0x1A, 0x1D, 0x88, 0x3D, 0xEA, 0xB6, 0x57, 0x47, 0x98,
-    0x9A, 0xEA, 0x68, 0xDA, 0x9A, 0xD2, 0x88, 0x76, 0x5B, 0x6A, 0x5F, 0x74, 0x92, 0xDC, 0x64, 0x95,
-    0x63, 0xDC, 0x09, 0xCD, 0xB2, 0x04, 0x56, 0x81, 0x36, 0xB0, 0x03, 0x4C, 0x10, 0x94, 0x08, 0x3D,
-    0x84, 0xE1, 0x77, 0x41, 0x43, 0x93, 0xC5, 0x8E, 0xA1, 0x0E, 0x4C, 0x3C, 0x47, 0x5C, 0x59, 0x2D,
-    0x7D, 0x37, 0xF2, 0x3A, 0x72, 0x7C, 0x2E, 0xF3, 0x6F, 0xF6, 0xF5, 0x68, 0x94, 0x4E, 0xD5, 0x8C,
-    0xF6, 0x55, 0x76, 0xC8, 0xE4, 0x6F, 0x0F, 0xDA, 0xCF, 0x27, 0x0D, 0x83, 0x41, 0x5D, 0x8A, 0x91,
-    0x7C, 0x33, 0x45, 0xE5, 0xF9, 0x79, 0xB2, 0x65, 0x3F, 0x1F, 0x5D, 0x7B, 0x72, 0x53, 0xB7, 0x7D,
-    0xBA, 0x38, 0x71, 0xE2, 0xE7, 0xF5, 0x36, 0x72, 0xD2, 0x68, 0xA4, 0xE8, 0x2E, 0x2C, 0xE5, 0x96,
-    0x15, 0xA4, 0x0D, 0x26, 0x58, 0x06, 0xDE, 0xF1, 0x4E, 0xDA, 0xC8, 0x85, 0x3E, 0x2C, 0x17, 0xE6,
-    0x23, 0x17, 0x5B, 0x62, 0xFA, 0x5C, 0x2A, 0x41, 0x31, 0xB6, 0xF4, 0xD2, 0x51, 0xE8, 0xCF, 0xA0,
-    0x42, 0x3F, 0xFE, 0x3C, 0x15, 0x7F, 0xA1, 0x87, 0x30, 0xB1, 0x7F, 0xEF, 0x9F, 0xF8, 0xF0, 0x17,
-    0x2B, 0xE6, 0xC9, 0x46, 0xC0, 0xB3, 0x18, 0x43, 0x4B, 0xB3, 0x2A, 0x0D, 0x77, 0xC9, 0x94, 0x98,
-    0x47, 0xE0, 0x21, 0xE1, 0xF4, 0x9B, 0x7A, 0x8E, 0xDC, 0x80, 0x38, 0xCD, 0xB9, 0xC6, 0x39, 0x0A,
-    0xE1, 0x0C, 0x62, 0x1B, 0xAC, 0xC7, 0xCD, 0xD8, 0xDD, 0x93, 0x0B, 0x3D, 0xFE, 0xEB, 0xFA, 0x8F,
-    0xBA, 0x2E, 0xCD, 0xA0, 0x14, 0x2E, 0x51, 0x3D, 0x53, 0x35, 0x44, 0x4A, 0x35, 0xB2, 0xA1, 0x6D,
-    0x3E, 0x32, 0xCD, 0x19, 0x68, 0x13, 0x29, 0xD7, 0xDE, 0xB4, 0xFA, 0xB5, 0x61, 0x69, 0xB4, 0x80,
-    0x3C, 0xAC, 0xFB, 0xAC, 0x43, 0xD2, 0xA4, 0xB1, 0x4B, 0xA3, 0x05, 0x58, 0x6C, 0x39, 0xAC, 0x43,
-    0x5B, 0xAF, 0x06, 0xF4, 0xD1, 0x45, 0x9F, 0x10, 0x1C, 0x01, 0x47, 0x08, 0x7B, 0xB8, 0x2A, 0x6D,
-    0x8F, 0xCA, 0x3C, 0xE9, 0xC4, 0x5F, 0x71, 0xBF, 0x87, 0x65, 0x32, 0xCC, 0x27, 0xAB, 0x2C, 0x57,
-    0x4E, 0x25, 0xA8, 0x0B, 0xD1, 0xC7, 0x18, 0xB5, 0xFA, 0x35, 0x5A, 0xA0, 0x03, 0x47, 0xEB, 0x17,
-    0xBE, 0xB3, 0xE2, 0x45, 0x99, 0x3F, 0xE8, 0x9C, 0xE7, 0x2C, 0xF5, 0x89, 0xF9, 0x5F, 0x01, 0xED,
-    0x80, 0xE6, 0x20, 0xC5, 0x64, 0x5C, 0xF1, 0xB2, 0xCC, 0x0D, 0xE7, 0xD0, 0x6F, 0x56, 0xD8, 0xDC,
-    0x6C, 0xB5, 0x1E, 0x7B, 0x75, 0xF0, 0x7D, 0x42, 0xEB, 0x7E, 0xCA, 0x05, 0x2F, 0xDC, 0x5C, 0x7D,
-    0xCE, 0xE5, 0x37, 0xB6, 0x5A, 0x50, 0x7F, 0x38, 0xFA, 0x29, 0x87, 0xBE, 0x38, 0x7A, 0xC8, 0x9E,
-    0x72, 0x01, 0x5E, 0x1F, 0x3A, 0xBA, 0x5E, 0xF3, 0x51, 0x00, 0xFF, 0x59, 0xE2, 0xB2, 0xDD, 0xDE,
-    0x5D, 0xC9, 0xFA, 0x34, 0xC3, 0xFE, 0xB3, 0x5B, 0xDD, 0x9D, 0x66, 0x27, 0x40, 0x8C, 0xED, 0xC1,
-    0x76, 0xE7, 0x9C, 0x8A, 0x2C, 0x45, 0xFF, 0x07, 0x85, 0x56, 0x41, 0x8C, 0xDE, 0x46, 0x15, 0x7E,
-    0xB6, 0x9B, 0x5A, 0xD4, 0x0A, 0x13, 0x24, 0x16, 0x55, 0xFD, 0x1B, 0x2C, 0x24, 0x0E, 0x28, 0xAC,
-    0x30, 0x12, 0x1C, 0x82, 0x94, 0x64, 0x9C, 0xF6, 0x80, 0x84, 0x28, 0xAC, 0x04, 0xAB, 0x1C, 0xF7,
-    0xDE, 0x04, 0xFD, 0x2B, 0x1A, 0xA9, 0x1C, 0x16, 0x6C, 0xD4, 0x03, 0xDC, 0xB2, 0x52, 0xC5, 0xAD,
-    0x87, 0x1E, 0x38, 0xC0, 0x5F, 0xD0, 0xAE, 0xAA, 0x22, 0xE5, 0xD0, 0x74, 0x26, 0x70, 0xC8, 0x31,
-    0x93, 0xFE, 0x14, 0x0E, 0x08, 0x61, 0x25, 0x4B, 0x0F, 0x3D, 0x90, 0xA1, 0xF5, 0xB2, 0xFE, 0xB3,
-    0xB6, 0x1F, 0xDF, 0xB3, 0xF7, 0xDF, 0xB0, 0x88, 0x52, 0x5B, 0xEF, 0xCD, 0x78, 0x66, 0x3C, 0xF3,
-    0xE6, 0xBD, 0xEF, 0x7D, 0x33, 0x44, 0xF2, 0x98, 0x86, 0x28, 0xDE, 0x37, 0x44, 0xCA, 0x6A, 0xA2,
-    0xAC, 0xFC, 0x22, 0x91, 0xCE, 0xD1, 0xAE, 0x2F, 0xAF, 0xAF, 0xAF, 0xE9, 0xE7, 0x98, 0x2B, 0x9D,
-    0xEB, 0xCB, 0x55, 0x56, 0xEA, 0xBC, 0x52, 0x0E, 0x5D, 0xF1, 0xA2, 0x40, 0xBF, 0x61, 0x86, 0x2E,
-    0x86, 0x91, 0xA3, 0x3A, 0x23, 0xEA, 0x2D, 0xB4, 0xFD, 0xC2, 0x53, 0xC4, 0xEC, 0x89, 0xE6, 0xE8,
-    0xB8, 0x43, 0x34, 0xE1, 0x3C, 0xC4, 0x77, 0x72, 0x70, 0xA3, 0xC9, 0xE6, 0xDF, 0x69, 0xF4, 0x9D,
-    0xB3, 0xBE, 0xF8, 0xD9, 0x2A, 0x99, 0x6F, 0x9D, 0x27, 0x7E, 0xE1, 0xEB, 0xC4, 0xDF, 0xFE, 0x2A,
-    0x99, 0xD7, 0x36, 0xA9, 0xF8, 0xCD, 0xEB, 0xA4, 0x9B, 0x8A, 0xB2, 0xDA, 0x7D, 0x49, 0xF5, 0xB7,
-    0x6B, 0xFC, 0x53, 0x91, 0xE9, 0x73, 0x7A, 0x80, 0x69, 0xE6, 0x58, 0xE2, 0x32, 0x8D, 0x4F, 0xC6,
-    0x65, 0xD0, 0xEF, 0xF8, 0xC4, 0x47, 0x4D, 0xEA, 0xC2, 0x46, 0xDB, 0xA0, 0xD2, 0x25, 0xD6, 0x85,
-    0x98, 0x1B, 0x73, 0x6F, 0xBE, 0xC9, 0x8D, 0x79, 0xBE, 0x6E, 0xCC, 0x2B, 0x7E, 0xAD, 0x78, 0xC5,
-    0x53, 0xF1, 0x07, 0x4F, 0x1A, 0x92, 0x3E, 0xF0, 0x4F, 0x27, 0x87, 0xFE, 0xA6, 0xD8, 0x42, 0x05,
-    0x97, 0x32, 0x95, 0x66, 0x76, 0x93, 0x7E, 0xC7, 0x45, 0x6D, 0x08, 0x09, 0x20, 0x24, 0x42, 0xC7,
-    0xC2, 0x3D, 0x45, 0xFD, 0xAF, 0x8F, 0xBF, 0x35, 0x7E, 0xFD, 0x72, 0xFF, 0xFA, 0xF1, 0xF7, 0x04,
-    0xE6, 0x69, 0x98, 0x39, 0x3C, 0x45, 0x47, 0x61, 0x67, 0xF2, 0xD8, 0xEB, 0x32, 0x81, 0xBF, 0x54,
-    0x75, 0x96, 0x12, 0x74, 0xC5, 0xF0, 0x44, 0x5C, 0xA3, 0x9B, 0x5B, 0xFA, 0x5C, 0xF7, 0x7D, 0xA2,
-    0x76, 0xAC, 0xAF, 0x48, 0x1D, 0xED, 0xD1, 0x1E, 0xAD, 0x29, 0x7E, 0xDF, 0x89, 0x2D, 0xDF, 0x78,
-    0x72, 0xB4, 0x0B, 0x4F, 0x38, 0x56, 0xE2, 0x7C, 0x28, 0x12, 0xC8, 0xCA, 0xDA, 0x8B, 0x6A, 0x86,
-    0x7F, 0x3F, 0x62, 0x66, 0x4B, 0x49, 0x3F, 0xED, 0xA7, 0x9E, 0x92, 0x56, 0xB5, 0x0A, 0x45, 0x8D,
-    0xF7, 0xA8, 0xA8, 0x3F, 0xA1, 0x50, 0x63, 0x91, 0x4A, 0x91, 0x76, 0xBA, 0x4B, 0x3A, 0x44, 0xB3,
-    0xE0, 0x84, 0xB1, 0xC6, 0xEE, 0xB8, 0xB8, 0x1F, 0x74, 0xE0, 0xE8, 0xF1, 0x53, 0xD4, 0xA4, 0xDB,
-    0x49, 0x4B, 0x93, 0xBD, 0x88, 0x29, 0xB2, 0x11, 0x97, 0xA2, 0x1C, 0xD4, 0x5D, 0x1F, 0xD9, 0x2B,
-    0x7F, 0x5B, 0x5C, 0xF9, 0x23, 0xEC, 0xE2, 0x3E, 0xB2, 0xFC, 0xBC, 0xBD, 0xF2, 0x9E, 0xF9, 0xF3,
-    0xF2, 0x53, 0x1D, 0x58, 0x19, 0x09, 0x15, 0x8A, 0xA2, 0x41, 0x69, 0x3B, 0xD9, 0xA3, 0xD4, 0x16,
-    0x2D, 0x25, 0xB6, 0xE0, 0x85, 0x44, 0xB5, 0x37, 0x16, 0xCE, 0x68, 0xB0, 0x19, 0x68, 0x71, 0x58,
-    0xD4, 0x44, 0xCD, 0xA8, 0xCF, 0x88, 0xAE, 0xCF, 0x4B, 0xBB, 0xBF, 0x29, 0x63, 0xEE, 0x37, 0x14,
-    0x2D, 0x8A, 0xBB, 0x58, 0x9E, 0xBB, 0x27, 0x17, 0x39, 0xC6, 0x85, 0x68, 0xF9, 0x18, 0x8D, 0x20,
-    0x05, 0x7D, 0x5E, 0xB0, 0x23, 0xB3, 0x8C, 0xD4, 0xB0, 0x22, 0xA5, 0xFD, 0xD0, 0x10, 0x35, 0x70,
-    0xC4, 0xB0, 0x50, 0xBB, 0x2C, 0x5E, 0xDC, 0x96, 0x22, 0x3A, 0x6C, 0x65, 0x75, 0x65, 0x6F, 0xC9,
-    0xC2, 0x69, 0xB9, 0x15, 0xB5, 0xA9, 0x4B, 0xDD, 0x19, 0xA0, 0x9B, 0x54, 0x07, 0x00, 0x98, 0x3C,
-    0xE1, 0x2A, 0x02, 0x02, 0x43, 0xC6, 0xC8, 0xCC, 0x61, 0x46, 0xD9, 0xC0, 0xA9, 0x80, 0xF1, 0x43,
-    0x93, 0x52, 0x21, 0xB3, 0x64, 0x74, 0x69, 0xD2, 0x5D, 0xE6, 0x8D, 0x7B, 0x6D, 0xC1, 0x76, 0x7A,
-    0x67, 0x89, 0x16, 0xE0, 0xC6, 0x3D, 0x95, 0x67, 0x7D, 0xCA, 0x65, 0x6A, 0x27, 0x8B, 0xA8, 0xA3,
-    0xCC, 0x86, 0x55, 0xD8, 0x91, 0xAE, 0x22, 0x17, 0xF4, 0xA4, 0xBD, 0xF8, 0x8A, 0x5E, 0x1E, 0x8B,
-    0x37, 0xEB, 0xB8, 0x24, 0x53, 0x7E, 0xD8, 0xA8, 0x5C, 0xF3, 0xF0, 0xAC, 0x14, 0x7F, 0x7A, 0xAF,
-    0xDF, 0x58, 0xA7, 0x6C, 0x6E, 0xDF, 0x39, 0x8B, 0xBD, 0x3C, 0x28, 0xF5, 0x2A, 0x92, 0xF8, 0x20,
-    0xD7, 0x17, 0x00, 0x97, 0x43, 0xCA, 0x6E, 0x02, 0x3C, 0x3D, 0xA5, 0xE2, 0xC8, 0x8E, 0x06, 0xAF,
-    0xB6, 0x43, 0x11, 0xB4, 0x02, 0x4B, 0x0D, 0x64, 0x77, 0x02, 0xB9, 0x4E, 0x53, 0xE2, 0xA1, 0xA2,
-    0x41, 0xD5, 0x9D, 0x7E, 0xEA, 0x55, 0x28, 0x35, 0x3F, 0xA9, 0xDE, 0x15, 0xE5, 0xE8, 0x58, 0x85,
-    0xAD, 0x56, 0xCC, 0xB5, 0xA8, 0x92, 0x62, 0x48, 0x20, 0xC0, 0x45, 0x1A, 0x6A, 0x6E, 0xE8, 0x9C,
-    0xD9, 0x93, 0x7A, 0xD8, 0xE9, 0x32, 0x65, 0x53, 0x6A, 0xCB, 0x65, 0x91, 0x9B, 0xD2, 0x20, 0x45,
-    0x19, 0xED, 0x4B, 0x31, 0x22, 0x79, 0x51, 0xE2, 0xCB, 0x66, 0x87, 0x0F, 0xF7, 0x92, 0x3E, 0x6D,
-    0x97, 0x68, 0x4B, 0x01, 0xF1, 0x67, 0x66, 0xB3, 0x31, 0x07, 0x26, 0x3D, 0x32, 0xDB, 0xD8, 0xA0,
-    0x55, 0x2E, 0xAA, 0x13, 0x17, 0xFB, 0x24, 0x07, 0xD6, 0x29, 0xDD, 0x5F, 0x43, 0x24, 0xEB, 0xA1,
-    0x54, 0x95, 0x44, 0x15, 0x01, 0xD8, 0xCF, 0x49, 0xFA, 0xE2, 0x01, 0x45, 0xD8, 0x6C, 0x47, 0x08,
-    0xFB, 0x43, 0x8B, 0x09, 0xF3, 0x31, 0xF2, 0x73, 0xAE, 0x26, 0xFD, 0x73, 0xBC, 0x0D, 0x6F, 0x48,
-    0x08, 0x01, 0x75, 0x04, 0xDA, 0x41, 0xA9, 0x1C, 0xEA, 0xA2, 0xB8, 0xE9, 0x6D, 0x22, 0xF1, 0xB0,
-    0xBB, 0xCA, 0x3C, 0x2B, 0xA3, 0x0E, 0xB8, 0x8C, 0x5A, 0x2D, 0x43, 0x52, 0x19, 0xAC, 0x80, 0xAB,
-    0x36, 0x96, 0x7F, 0x43, 0x16, 0x6C, 0xB1, 0xC3, 0xC2, 0x59, 0x0D, 0x42, 0x64, 0x32, 0x3B, 0x8F,
-    0x0C, 0xBD, 0xA5, 0xBC, 0xA2, 0xDD, 0x23, 0x85, 0xC4, 0x55, 0x1E, 0xDB, 0x50, 0x30, 0x8E, 0x54,
-    0x2F, 0x5B, 0x83, 0x69, 0x21, 0xFF, 0x13, 0xF3, 0xDD, 0x10, 0x9F, 0x61, 0x3A, 0x98, 0x25, 0xE6,
-    0x0A, 0x65, 0x86, 0xDF, 0x95, 0xD4, 0x93, 0x30, 0xD1, 0xB4, 0x83, 0xF9, 0x7C, 0xCC, 0x07, 0x8F,
-    0xD3, 0x32, 0x1E, 0xD2, 0x32, 0x98, 0x0E, 0x85, 0xE1, 0x4E, 0xC8, 0xC2, 0x75, 0x99, 0x0C, 0x14,
-    0x17, 0x8D, 0x88, 0x96, 0xA1, 0x51, 0x2D, 0x6E, 0x80, 0x2F, 0x22, 0xC1, 0xB7, 0xF0, 0xA5, 0xCC,
-    0x5D, 0x8D, 0x85, 0x1B, 0x8A, 0xD4, 0xC6, 0xF5, 0x29, 0x24, 0x9F, 0x8D, 0xBD, 0x01, 0x4D, 0xDA,
-    0xE4, 0xC3, 0xFD, 0x16, 0x61, 0x51, 0x73, 0xA0, 0x81, 0x29, 0xBB, 0xE3, 0xBB, 0xEB, 0x05, 0xE9,
-    0xC4, 0xB7, 0xD7, 0xF9, 0xFD, 0x4E, 0xED, 0x37, 0x59, 0x65, 0xAA, 0x61, 0x2B, 0xF2, 0xEB, 0xC8,
-    0xC6, 0xA3, 0x81, 0x7A, 0x2C, 0x8A, 0xD1, 0x50, 0xB3, 0xB4, 0x18, 0xE6, 0x47, 0x07, 0xE0, 0xA5,
-    0x7B, 0x1E, 0xE7, 0x4B, 0x8D, 0x55, 0x21, 0x52, 0xBF, 0x8F, 0xB6, 0x8F, 0x1C, 0x90, 0x03, 0xDF,
-    0x22, 0x32, 0xF0, 0x24, 0xDD, 0x06, 0xD5, 0x56, 0x4C, 0xF1, 0x01, 0x97, 0x40, 0x95, 0xFD, 0x0A,
-    0x6F, 0xB8, 0x0B, 0x97, 0x94, 0xBF, 0xB9, 0x2A, 0x7B, 0xC1, 0x0E, 0x3E, 0x05, 0xB9, 0x04, 0xD1,
-    0x91, 0xA7, 0xEC, 0x21, 0xFE, 0x95, 0x9C, 0x5E, 0x20, 0x02, 0xC6, 0x22, 0x28, 0xFE, 0x6A, 0xBF,
-    0xD3, 0x4B, 0x0C, 0x10, 0x9B, 0xF6, 0x6A, 0xFF, 0xC6, 0x51, 0x5D, 0xF9, 0xA8, 0x2B, 0xEC, 0x40,
-    0xE3, 0xFF, 0x49, 0xEB, 0xC7, 0xF4, 0x2D, 0x08, 0x12, 0x1F, 0xAD, 0xD1, 0x11, 0xF9, 0x4D, 0x24,
-    0x3F, 0xF9, 0xB0, 0xA3, 0xB8, 0xD9, 0x45, 0x96, 0xFB, 0xDD, 0x82, 0x32, 0xB7, 0xFB, 0x23, 0xB8,
-    0x06, 0xBD, 0x85, 0x28, 0x53, 0x3E, 0x56, 0xBF, 0x5B, 0x17, 0x5C, 0x03, 0x01, 0xF6, 0x4D, 0x96,
-    0x21, 0x50, 0x0E, 0x2A, 0xF5, 0x50, 0x89, 0x4C, 0x10, 0xF0, 0xBF, 0x7A, 0x39, 0xB1, 0xF6, 0x96,
-    0xDC, 0x2A, 0x2A, 0x14, 0xCF, 0x0F, 0x64, 0x13, 0x0B, 0x20, 0x94, 0x78, 0xEB, 0xD3, 0xE2, 0xB9,
-    0xB3, 0x72, 0x94, 0x5E, 0xD0, 0x70, 0xEC, 0x16, 0xC8, 0x44, 0x76, 0x50, 0xAF, 0xEC, 0x6F, 0x00,
-    0xDE, 0x38, 0xEC, 0xE8, 0xEA, 0xA3, 0x9D, 0xFE, 0x97, 0x85, 0xB4, 0x81, 0x4E, 0x5B, 0x8A, 0x91,
-    0x5F, 0xA4, 0xC0, 0x6C, 0x34, 0x75, 0x31, 0x6F, 0x73, 0x93, 0xF2, 0x08, 0x8F, 0x62, 0x81, 0x23,
-    0x6B, 0x5A, 0x22, 0x4B, 0x5C, 0x5C, 0x45, 0x3E, 0x70, 0x02, 0x02, 0xE5, 0xCF, 0xCD, 0x4C, 0x83,
-    0x7C, 0xEF, 0xE4, 0xE8, 0x3B, 0xC7, 0xFC, 0x2B, 0xA9, 0xAB, 0x56, 0xF0, 0x40, 0xA5, 0x72, 0x81,
-    0x57, 0x36, 0x6C, 0x30, 0xBE, 0x0E, 0x17, 0x1B, 0x9E, 0xA6, 0x4B, 0xD8, 0x49, 0xD2, 0xB8, 0xA3,
-    0x23, 0x97, 0x7D, 0x5C, 0xCF, 0x1B, 0x55, 0xBD, 0xDB, 0x64, 0xF6, 0x5E, 0xA5, 0xAD, 0x43, 0x3E,
-    0xC3, 0xCA, 0xFF, 0x92, 0x02, 0xED, 0xD2, 0xA7, 0x1D, 0xB2, 0xD1, 0xBB, 0xA7, 0x93, 0xC6, 0x8D,
-    0x47, 0xEE, 0x30, 0x67, 0x35, 0xCC, 0x97, 0xDA, 0x0E, 0xD2, 0x1F, 0xCB, 0xF4, 0xEF, 0xFD, 0x9A,
-    0x6C, 0x2C, 0xBB, 0xD7, 0x9F, 0x68, 0xFF, 0x78, 0xE1, 0x3A, 0xB5, 0xBA, 0x3E, 0x4E, 0x0C, 0x5C,
-    0x62, 0xE2, 0x7D, 0xCE, 0x71, 0x85, 0x29, 0x33, 0x79, 0xED, 0xE7, 0x11, 0x35, 0x40, 0xB4, 0x19,
-    0x13, 0x2F, 0xE2, 0xE1, 0xCC, 0xA5, 0x81, 0xA9, 0x60, 0xE1, 0x13, 0x9F, 0xC1, 0x48, 0xBE, 0x6B,
-    0x5F, 0xBA, 0xF6, 0x17, 0xFB, 0xB5, 0x6B, 0x0F, 0x73, 0xFD, 0xDB, 0x9E, 0x12, 0x30, 0x49, 0xF4,
-    0x03, 0x8C, 0xBD, 0xE6, 0x8E, 0xCE, 0x08, 0x1E, 0x8E, 0x64, 0xA9, 0x9F, 0x9B, 0xCD, 0xB6, 0xF1,
-    0x5D, 0x6D, 0xE9, 0xDF, 0x57, 0xD7, 0xF5, 0x6D, 0x88, 0x05, 0x83, 0x22, 0x4C, 0xFF, 0x47, 0x82,
-    0x62, 0x6F, 0x58, 0xD7, 0x70, 0xFF, 0x06, 0xCF, 0xE0, 0x1A, 0xAC, 0x8B, 0xFA, 0x8C, 0x3F, 0x40,
-    0x85, 0x38, 0x07, 0xA9, 0x01, 0x15, 0xE0, 0x16, 0x5D, 0x09, 0x25, 0x20, 0x14, 0xA0, 0x69, 0xC9,
-    0x03, 0x2C, 0x99, 0xD5, 0x1A, 0x89, 0x21, 0x97, 0x8B, 0x11, 0xA9, 0x9F, 0x45, 0x44, 0x61, 0x1D,
-    0x8C, 0x4F, 0xDA, 0x27, 0xC8, 0x74, 0x35, 0x7D, 0x8F, 0xB7, 0x51, 0x3F, 0x45, 0xA6, 0x4D, 0xED,
-    0xAB, 0x6D, 0x5A, 0x81, 0xC3, 0x20, 0x41, 0x35, 0x5E, 0x64, 0x22, 0x3B, 0xE9, 0xA6, 0x03, 0x15,
-    0x0F, 0x89, 0x8A, 0x3D, 0x5C, 0x02, 0x06, 0x36, 0xCF, 0x13, 0x5D, 0xBF, 0x38, 0x93, 0x03, 0xC4,
-    0x67, 0xFC, 0x41, 0x1B, 0x5C, 0xA3, 0x0B, 0xB4, 0x4A, 0xCF, 0xD2, 0xEA, 0xCF, 0x9F, 0xA5, 0xEC,
-    0x1F, 0xAB, 0x88, 0x72, 0x4D, 0x5B, 0x2F, 0xB9, 0x40, 0xD6, 0x7C, 0x4D, 0x30, 0x49, 0xE7, 0x49,
-    0xFD, 0xF4, 0x6D, 0x78, 0xAD, 0x06, 0x90, 0x8F, 0xCE, 0xAD, 0xEA, 0x84, 0x12, 0x1B, 0x41, 0x52,
-    0x35, 0x6E, 0x38, 0xF7, 0x71, 0xBC, 0xB8, 0xCA, 0x20, 0x38, 0x15, 0x72, 0xA6, 0x94, 0x6B, 0x23,
-    0x94, 0x5C, 0x1B, 0x3F, 0x49, 0x15, 0x70, 0x44, 0xDA, 0x73, 0x19, 0xD7, 0x99, 0x8B, 0x6B, 0xE5,
-    0x4F, 0x4A, 0xEA, 0xE2, 0xA6, 0xC0, 0x98, 0x8E, 0x26, 0x8B, 0xE5, 0x4D, 0xAA, 0xC2, 0x2D, 0x6C,
-    0x7B, 0xA8, 0xC7, 0xD8, 0x63, 0xDA, 0xE5, 0x43, 0x1B, 0x9D, 0xDE, 0x1C, 0x05, 0x71, 0x07, 0xE4,
-    0xAC, 0xFA, 0xEB, 0xCB, 0x75, 0xF6, 0xC2, 0x66, 0xAB, 0x4F, 0x6F, 0xDE, 0x7A, 0xE7, 0xF4, 0xE6,
-    0x8F, 0x6F, 0x9D, 0xDE, 0xDC, 0x12, 0xB6, 0x14, 0xB9, 0x05, 0xF9, 0x89, 0xF0, 0x96, 0x38, 0x08,
-    0x28, 0x4F, 0xEC, 0x70, 0xA7, 0xAD, 0x01, 0xC3, 0x46, 0x84, 0xBE, 0x00, 0xA4, 0xFC, 0xD0, 0x0E,
-    0xB7, 0xBB, 0x0C, 0x74, 0x90, 0x78, 0x03, 0xD1, 0xF9, 0x63, 0x29, 0xE4, 0xDC, 0x04, 0x6C, 0xC0,
-    0x64, 0xFB, 0xFD, 0x51, 0x5F, 0x66, 0x4F, 0x0A, 0x0E, 0xC0, 0x47, 0xE0, 0x04, 0xF8, 0x47, 0xE6,
-    0x1A, 0xE4, 0x99, 0x6D, 0xD8, 0xD6, 0x23, 0x21, 0x8B, 0x3C, 0xC5, 0x75, 0x3A, 0xB3, 0x17, 0xFF,
-    0x27, 0x82, 0x32, 0x17, 0x60, 0x4C, 0x9C, 0xC7, 0xBD, 0x81, 0x83, 0x9B, 0x63, 0xA4, 0xE3, 0x50,
-    0x94, 0x5B, 0x2B, 0xAD, 0xAC, 0xAF, 0xD3, 0xBF, 0x01, 0xAB, 0xFF, 0xFF, 0xAF, 0xFE, 0xFF, 0x7F,
-    0x06, 0x06, 0x06, 0x00, 0xA5, 0x92, 0x31, 0x4E, 0xC3, 0x40, 0x10, 0x45, 0xC7, 0x76, 0xB1, 0x48,
-    0x5B, 0x84, 0x02, 0x89, 0x22, 0x45, 0x8E, 0xE0, 0x0B, 0x10, 0xBC, 0xA1, 0xA1, 0x75, 0x24, 0x4C,
-    0x43, 0xE1, 0x23, 0xE4, 0x06, 0xD8, 0x1D, 0x37, 0x48, 0xCB, 0x11, 0xB8, 0x81, 0xED, 0x1B, 0xE0,
-    0x1B, 0x00, 0x15, 0x6D, 0x8A, 0x8D, 0xB4, 0x88, 0x5D, 0x0F, 0x33, 0x63, 0x07, 0x51, 0x06, 0x70,
-    0xF1, 0x3D, 0x9A, 0xF5, 0xEC, 0xFB, 0xFB, 0xD7, 0x00, 0xF2, 0xA4, 0x4E, 0xA3, 0x81, 0xA1, 0xC9,
-    0x36, 0x5D, 0xEC, 0x97, 0xCD, 0xAC, 0x4E, 0xDC, 0xD9, 0x00, 0x90, 0xB8, 0x28, 0x00, 0xCC, 0xC3,
-    0xED, 0x70, 0x03, 0x15, 0x22, 0x7A, 0x38, 0xFF, 0xE0, 0x7A, 0xEC, 0x1F, 0xAF, 0xCA, 0x45, 0xB4,
-    0xDB, 0x62, 0xB8, 0xC6, 0x1C, 0x5A, 0x7C, 0x41, 0x3B, 0x52, 0x61, 0xC1, 0xD5, 0x70, 0xE7, 0x21,
-    0xF6, 0x89, 0xA7, 0x6F, 0x63, 0x4B, 0x02, 0x4C, 0x2C, 0x04, 0x18, 0x98, 0x17, 0xC6, 0x4D, 0x8E,
-    0x10, 0xC1, 0x30, 0xC5, 0x30, 0xE4, 0xF5, 0xC0, 0x20, 0x03, 0x4D, 0x19, 0x98, 0xF1, 0xF3, 0xE3,
-    0x79, 0x58, 0x07, 0x62, 0xBC, 0x31, 0x63, 0xF5, 0x37, 0xC6, 0xF3, 0x81, 0x31, 0x06, 0x48, 0xCE,
-    0x29, 0xC1, 0x07, 0x24, 0xD2, 0xB2, 0x05, 0x04, 0xC9, 0xD0, 0x4F, 0x11, 0x48, 0x8A, 0x45, 0x21,
-    0x31, 0x22, 0x1A, 0xCE, 0xB1, 0x68, 0x8D, 0xAC, 0x55, 0xBF, 0x7F, 0x89, 0x8B, 0xD6, 0xB0, 0x8F,
-    0x35, 0xF6, 0x7C, 0xDA, 0xCF, 0xEF, 0x50, 0xC5, 0x0B, 0xDD, 0x66, 0xB8, 0xCF, 0xB6, 0x68, 0x46,
-    0x2F, 0x34, 0x77, 0xCA, 0x03, 0xD3, 0x38, 0x7B, 0xC9, 0x2B, 0xC3, 0x5E, 0x5C, 0x25, 0x5E, 0xF2,
-    0xEA, 0xDF, 0x5E, 0x82, 0xC2, 0x15, 0x7B, 0x79, 0xC4, 0x77, 0xF6, 0x92, 0xB3, 0x13, 0xAC, 0x21,
-    0x0A, 0xDA, 0x51, 0x06, 0x74, 0xBF, 0xCA, 0xC6, 0x2C, 0x54, 0x69, 0xAB, 0x42, 0xAE, 0x6D, 0x86,
-    0xBB, 0xA9, 0x92, 0xDE, 0x71, 0x52, 0x86, 0x2B, 0xB4, 0x48, 0xA0, 0xDD, 0x74, 0xDC, 0xC8, 0xB0,
-    0x22, 0xFD, 0x60, 0x90, 0xD8, 0xAA, 0x07, 0xD0, 0xFD, 0x8C, 0xD6, 0x74, 0xC7, 0xAA, 0xA4, 0x7E,
-    0xDA, 0xA5, 0x7B, 0xA3, 0x79, 0xAC, 0x4B, 0x57, 0xAE, 0xDC, 0x9B, 0x0C, 0x2C, 0xF5, 0xB3, 0xDA,
-    0xB0, 0x3A, 0x20, 0x5D, 0x60, 0x4D, 0xAA, 0x90, 0xFB, 0xB0, 0xF1, 0xA4, 0x27, 0x31, 0xEB, 0x05,
-    0xB0, 0x5E, 0x8A, 0x66, 0x5B, 0xAB, 0xB1, 0xD3, 0xD8, 0xC7, 0xD8, 0x8D, 0xEC, 0x2F, 0x45, 0x8D,
-    0xB1, 0x0D, 0x80, 0x40, 0x0C, 0x03, 0x5F, 0x7C, 0x41, 0x41, 0x91, 0x51, 0x98, 0x00, 0x05, 0x46,
-    0x63, 0x12, 0x46, 0x21, 0xA3, 0x30, 0xC2, 0x17, 0x20, 0x01, 0x7A, 0x71, 0x24, 0xA2, 0x20, 0x52,
-    0x5C, 0xD8, 0xF2, 0x39, 0xA5, 0x9C, 0xE2, 0xC4, 0x42, 0xB5, 0x84, 0x52, 0x5D, 0x32, 0x84, 0x3D,
-    0x76, 0x1E, 0x0C, 0xED, 0xEC, 0x41, 0x15, 0xAB, 0x6E, 0x2F, 0x46, 0x12, 0x30, 0x4C, 0x61, 0xA2,
-    0xAC, 0x3C, 0x2D, 0xA7, 0xB2, 0xF7, 0x14, 0x61, 0xF7, 0x24, 0x73, 0x45, 0x19, 0x02, 0xA4, 0x07,
-    0xDE, 0x95, 0x4D, 0x9D, 0x93, 0x37, 0x0D, 0xFE, 0x5D, 0xFF, 0xAD, 0x6F, 0xB7, 0xF1, 0x7F, 0x01,
+static const uint8_t notoserif_12_boldBitmaps[28698] = {
+    0xB5, 0x58, 0x3D, 0x8C, 0x15, 0xD7, 0x15, 0x3E, 0xEF, 0x0D, 0xCB, 0xC8, 0xBE, 0xCA, 0x0E, 0x85,
+    0x57, 0x76, 0xF2, 0xB2, 0x4C, 0xE3, 0x22, 0x42, 0x2C, 0xD3, 0x44, 0x11, 0xC5, 0xC2, 0xDC, 0xC5,
+    0x85, 0x4B, 0xD6, 0xD2, 0xAE, 0x5D, 0xB8, 0x58, 0xB7, 0xD0, 0x6C, 0x43, 0xB1, 0x91, 0x1C, 0xEE,
+    0x28, 0x89, 0x44, 0x09, 0x4D, 0x68, 0x93, 0x22, 0x05, 0x7A, 0x14, 0x50, 0x50, 0xB8, 0xC0, 0x7B,
+    0x07, 0x28, 0x5C, 0xB8, 0x60, 0x02, 0x45, 0xAA, 0x88, 0x89, 0x8C, 0x41, 0x02, 0xC9, 0x1E, 0x39,
+    0x43, 0x98, 0x65, 0x67, 0xE6, 0xE4, 0x3B, 0x77, 0xE6, 0x3D, 0x76, 0x09, 0x84, 0x3F, 0xE5, 0xBD,
+    0x39, 0xE7, 0xCD, 0xBB, 0x73, 0xEF, 0xB9, 0xE7, 0xFF, 0x9C, 0x3B, 0x26, 0x35, 0x69, 0x9C, 0xE0,
+    0xAB, 0x63, 0x1D, 0xE9, 0x88, 0x42, 0xF7, 0x9D, 0xA5, 0x3D, 0x44, 0xB4, 0x9F, 0x30, 0x9E, 0xC6,
+    0x9A, 0xDC, 0x47, 0x11, 0x19, 0x1A, 0xD4, 0xE4, 0x17, 0x14, 0xE4, 0x14, 0xA6, 0x14, 0xE3, 0x4A,
+    0xC8, 0xB8, 0xCB, 0xEA, 0xFE, 0xC2, 0x3D, 0x06, 0xF1, 0x28, 0x4A, 0x29, 0xC8, 0x64, 0xF2, 0xA0,
+    0x22, 0x3A, 0xED, 0x96, 0xBB, 0xCF, 0x61, 0x22, 0x50, 0xC4, 0x23, 0xAF, 0xA4, 0x61, 0x4D, 0xD4,
+    0x12, 0x31, 0x91, 0x25, 0xB7, 0x7E, 0x42, 0xAE, 0xA7, 0xE8, 0x1E, 0xB5, 0xB2, 0x29, 0x26, 0xAB,
+    0x9C, 0x22, 0x2D, 0xCB, 0xF1, 0x59, 0x20, 0xA3, 0x4D, 0x12, 0x25, 0x4A, 0x07, 0x74, 0x95, 0xCE,
+    0x61, 0xC4, 0xD4, 0xA6, 0x3E, 0x70, 0xE1, 0x10, 0x56, 0x9A, 0x64, 0xC2, 0xF1, 0x80, 0x33, 0x52,
+    0xDB, 0x25, 0x78, 0xAD, 0xC1, 0x54, 0x8B, 0x35, 0x16, 0x22, 0x58, 0x7C, 0xDD, 0x9D, 0xE6, 0x1E,
+    0xEC, 0x14, 0x3A, 0x2C, 0x73, 0x23, 0xAC, 0x09, 0xEE, 0x83, 0x45, 0xD0, 0x70, 0x1F, 0xC8, 0x43,
+    0x9C, 0x92, 0x0F, 0x30, 0x26, 0xA5, 0x23, 0x10, 0x91, 0x5E, 0x03, 0x66, 0xCC, 0xF7, 0x14, 0x30,
+    0x3B, 0x52, 0x43, 0x86, 0xFE, 0xEE, 0x77, 0x3C, 0xC5, 0x10, 0x31, 0xC6, 0xBE, 0x7B, 0x45, 0x54,
+    0x51, 0x06, 0x84, 0x15, 0x69, 0x49, 0x61, 0x5F, 0xC8, 0x4B, 0xBF, 0xC3, 0x10, 0xFE, 0xFA, 0x99,
+    0x97, 0x84, 0xA4, 0x92, 0x98, 0x79, 0x0A, 0x4F, 0x69, 0x35, 0xA0, 0xC5, 0x8E, 0x56, 0x04, 0x5A,
+    0x03, 0x47, 0xAB, 0xC1, 0xA2, 0xD2, 0xE9, 0x80, 0x2E, 0x82, 0xA6, 0x1B, 0x83, 0x5E, 0xC1, 0xCC,
+    0x07, 0x80, 0x45, 0xDC, 0x9F, 0x96, 0xBD, 0x1F, 0x36, 0xA4, 0x40, 0xA3, 0x63, 0x0C, 0xF3, 0x7C,
+    0x40, 0x00, 0x38, 0x04, 0xF8, 0x0D, 0xE0, 0xA7, 0x9A, 0x06, 0xB7, 0x60, 0x80, 0xEB, 0x35, 0x29,
+    0x3C, 0x9F, 0x05, 0x2C, 0x02, 0x7E, 0xFB, 0x59, 0xA3, 0x2D, 0x73, 0x3E, 0x87, 0x5F, 0xB7, 0xCE,
+    0x03, 0x8C, 0x5A, 0x38, 0x00, 0x67, 0x8A, 0x1B, 0xC8, 0xDA, 0x3A, 0x98, 0x75, 0xDF, 0x77, 0xE8,
+    0x67, 0x20, 0x3F, 0x2F, 0x3E, 0xB5, 0x99, 0x50, 0xC8, 0x70, 0x89, 0x61, 0x3B, 0xE1, 0x49, 0x0B,
+    0xEC, 0x01, 0x2C, 0x82, 0xF7, 0x23, 0xD0, 0x41, 0x0C, 0x7E, 0xD5, 0x44, 0xEF, 0xF2, 0xB1, 0x25,
+    0xF9, 0xFF, 0x06, 0xCD, 0x74, 0x93, 0xA2, 0xE4, 0x08, 0xE4, 0xFC, 0x10, 0x76, 0x74, 0x4E, 0x43,
+    0x76, 0x3D, 0x23, 0xDE, 0xAE, 0x41, 0xA9, 0xC5, 0xD7, 0xE2, 0x57, 0x2C, 0x6C, 0xDC, 0x37, 0x86,
+    0x2D, 0xA3, 0x14, 0xEB, 0xEE, 0x57, 0x53, 0x3B, 0x82, 0x67, 0x77, 0x35, 0x05, 0x5D, 0x2D, 0xA8,
+    0x5A, 0x86, 0x6E, 0xBD, 0x82, 0xFC, 0x9C, 0x14, 0xFC, 0x35, 0x11, 0x8D, 0xC7, 0xCE, 0x5D, 0xEB,
+    0xDE, 0xEB, 0xF0, 0x50, 0xE5, 0xBD, 0xD5, 0x32, 0x0A, 0xEF, 0x4D, 0xAC, 0xD6, 0xEF, 0x90, 0x6C,
+    0x52, 0x9C, 0xC1, 0x53, 0xB6, 0x73, 0xF2, 0x9C, 0x77, 0x54, 0x14, 0x9D, 0x81, 0xA7, 0x39, 0x7E,
+    0x8C, 0x6E, 0xBA, 0xD9, 0xDA, 0xCD, 0xBD, 0xD5, 0xE0, 0x79, 0x3E, 0x15, 0x6A, 0xC8, 0x9A, 0xC2,
+    0x87, 0x05, 0xC5, 0xC7, 0x2A, 0x70, 0x5C, 0x3B, 0xFE, 0x45, 0x82, 0x4E, 0x8A, 0xCE, 0x3F, 0xE3,
+    0x87, 0x4C, 0xAA, 0xB1, 0xBD, 0xAC, 0xA2, 0xB1, 0x9A, 0x7E, 0x0D, 0xC6, 0x16, 0xC1, 0x59, 0xBC,
+    0x06, 0x7E, 0xB8, 0x73, 0xF5, 0x5F, 0x74, 0x91, 0x9A, 0xCC, 0x3C, 0xD5, 0xD9, 0x8E, 0xE8, 0x7D,
+    0xF1, 0xD3, 0x28, 0x55, 0x49, 0x00, 0x17, 0x5B, 0x76, 0x63, 0x3E, 0x24, 0x8C, 0x44, 0xC2, 0x14,
+    0x3B, 0x27, 0x96, 0x66, 0x34, 0x82, 0x90, 0x64, 0x0B, 0xD8, 0x69, 0x08, 0x7F, 0x52, 0x70, 0x44,
+    0x44, 0x37, 0x8C, 0x44, 0xB4, 0x08, 0xD8, 0xD3, 0x13, 0x5B, 0xE8, 0x4D, 0x29, 0xB0, 0xD9, 0x8F,
+    0x0D, 0x1A, 0x27, 0x23, 0x90, 0x27, 0xC8, 0x17, 0x52, 0x81, 0x04, 0xC3, 0xAC, 0x44, 0xD2, 0x42,
+    0x08, 0x45, 0x2C, 0x06, 0x05, 0xD1, 0x86, 0x02, 0xBA, 0xE2, 0xC3, 0x23, 0x1E, 0x7D, 0x06, 0xA5,
+    0x33, 0x7C, 0x67, 0x98, 0x0D, 0x5A, 0xF2, 0x52, 0x90, 0xF3, 0x25, 0x0F, 0x04, 0x70, 0xAA, 0x74,
+    0x3D, 0x1B, 0xF0, 0x5D, 0xAE, 0x7C, 0xAE, 0x0D, 0x6F, 0xC1, 0xD1, 0x6C, 0xEE, 0xD5, 0xAA, 0xF2,
+    0xEA, 0x9D, 0x5F, 0x1F, 0xFF, 0xC3, 0xC2, 0x43, 0x64, 0x78, 0xCD, 0x5A, 0xD1, 0x8D, 0x0D, 0x5A,
+    0x00, 0xF7, 0x80, 0x7B, 0xAF, 0x19, 0xB5, 0x97, 0x4A, 0xD3, 0x47, 0x0F, 0x45, 0x9C, 0x0C, 0xDA,
+    0x4B, 0x85, 0x5F, 0x7A, 0x55, 0x90, 0x0F, 0xAB, 0x28, 0x1D, 0xE4, 0xC2, 0xA3, 0xC4, 0x89, 0x7D,
+    0x06, 0xCC, 0x24, 0x98, 0xE1, 0x48, 0x61, 0x41, 0x1F, 0xA8, 0x8A, 0xBE, 0x1A, 0x32, 0x17, 0xB4,
+    0xDE, 0xD1, 0x32, 0x0C, 0xEF, 0x0F, 0x5B, 0xF8, 0xAA, 0x57, 0xC3, 0xB9, 0x11, 0x0F, 0x56, 0x7B,
+    0xA2, 0x4C, 0x41, 0x19, 0x50, 0x04, 0x96, 0x29, 0x74, 0xA8, 0x98, 0x20, 0x37, 0x16, 0x65, 0x93,
+    0x79, 0x46, 0x10, 0x63, 0x19, 0xB4, 0x2D, 0x7C, 0x76, 0x44, 0xC1, 0x6D, 0x35, 0x6A, 0x2F, 0x42,
+    0x3A, 0xDA, 0x00, 0x1C, 0xEE, 0x81, 0xA6, 0xC0, 0x9C, 0x7A, 0xCD, 0xAA, 0xDE, 0x35, 0x56, 0xD3,
+    0x3B, 0x80, 0xFD, 0x80, 0x85, 0x51, 0x3B, 0xFE, 0x1A, 0x34, 0x1A, 0x40, 0x19, 0x76, 0x74, 0xBE,
+    0x7A, 0x2E, 0x9D, 0x76, 0xAC, 0x1D, 0xAD, 0xDD, 0x74, 0xA6, 0x30, 0x6A, 0x97, 0xC1, 0x4B, 0xD1,
+    0x1B, 0x78, 0x24, 0xBE, 0xCC, 0x17, 0xE1, 0xD4, 0x15, 0x2C, 0x05, 0x53, 0x1A, 0x08, 0x42, 0x1B,
+    0x4E, 0x47, 0x4E, 0x59, 0x4E, 0x6B, 0x13, 0x34, 0xB3, 0xAA, 0x6D, 0x12, 0x72, 0x66, 0x52, 0xF8,
+    0x44, 0x2C, 0xB6, 0x85, 0x1E, 0x59, 0x14, 0x09, 0x0F, 0x17, 0x02, 0x03, 0x3E, 0xDF, 0x8A, 0x3D,
+    0xEE, 0x76, 0xD4, 0x0D, 0x5F, 0xE3, 0x36, 0xE4, 0x25, 0xBB, 0xB5, 0x4B, 0x4B, 0xFF, 0x8D, 0x98,
+    0x39, 0x83, 0xF0, 0xEB, 0xD9, 0x8B, 0xA7, 0x08, 0x42, 0x6A, 0x32, 0x8F, 0x0C, 0x5F, 0x67, 0x46,
+    0x82, 0x0A, 0x45, 0xC5, 0xF4, 0x8A, 0x97, 0xAC, 0xE4, 0x2C, 0xE0, 0x72, 0x2F, 0x0B, 0xC7, 0x6F,
+    0x70, 0x0D, 0x9C, 0x37, 0x44, 0xA5, 0xAB, 0x6F, 0x7C, 0x9B, 0xF3, 0x51, 0x7B, 0x8C, 0xCF, 0x61,
+    0xA8, 0x91, 0xF1, 0x02, 0xC8, 0x43, 0x39, 0xAC, 0xE1, 0xE7, 0x5E, 0x7D, 0x44, 0x54, 0x7D, 0x55,
+    0x6C, 0xD1, 0x3A, 0xC3, 0x02, 0x35, 0x36, 0xC5, 0x58, 0x2C, 0x53, 0x42, 0x99, 0x1C, 0x54, 0x40,
+    0xBE, 0xAC, 0x85, 0x2A, 0xC1, 0x1D, 0x94, 0xCA, 0x59, 0x04, 0x9F, 0x46, 0x3E, 0x68, 0x35, 0xBD,
+    0xC8, 0x7A, 0xCF, 0x01, 0xF1, 0x90, 0x59, 0xC0, 0x7C, 0xEF, 0x25, 0x4D, 0xE7, 0x25, 0xE0, 0xB9,
+    0x86, 0x8A, 0x10, 0x70, 0x1E, 0x27, 0x43, 0xF8, 0x03, 0x2E, 0x9B, 0x7A, 0x77, 0x32, 0x1F, 0xFE,
+    0x79, 0x33, 0x57, 0x70, 0xD5, 0x9B, 0xC5, 0x2C, 0xF0, 0x37, 0xE5, 0x3C, 0xF0, 0x8D, 0xFA, 0x20,
+    0xF0, 0xF5, 0xFA, 0x30, 0xF0, 0xB5, 0xE6, 0x14, 0x70, 0xCA, 0x97, 0x05, 0xDB, 0x5C, 0xB0, 0xC9,
+    0x04, 0x23, 0xFF, 0x00, 0x47, 0xC8, 0x39, 0xA3, 0xBB, 0xE1, 0x92, 0xBD, 0x6B, 0xEA, 0xC0, 0x43,
+    0x2C, 0x23, 0x8D, 0x35, 0x23, 0xE8, 0xB8, 0x44, 0x92, 0xF0, 0xB0, 0x51, 0x22, 0x28, 0xF3, 0x64,
+    0x03, 0xA0, 0x6F, 0x6A, 0xA0, 0x1B, 0x8D, 0x27, 0x14, 0x05, 0x99, 0x1B, 0x42, 0xE3, 0x3B, 0xA0,
+    0xE0, 0x71, 0xEA, 0x39, 0xBE, 0x52, 0xE1, 0x0F, 0xEE, 0x24, 0x48, 0x68, 0xA3, 0xD8, 0x9B, 0x5A,
+    0x92, 0x79, 0x1F, 0xDE, 0x28, 0x4E, 0x88, 0x6F, 0x64, 0xAE, 0xA1, 0xC4, 0x1E, 0x39, 0xDF, 0x33,
+    0x5A, 0x5A, 0x97, 0x54, 0x5A, 0x95, 0xD4, 0x4E, 0x50, 0x36, 0x45, 0xDD, 0x03, 0x37, 0xC5, 0x4D,
+    0x76, 0xCB, 0x54, 0x81, 0x84, 0x36, 0x6C, 0x3F, 0x47, 0x06, 0xEC, 0xE3, 0x5D, 0x7C, 0xF4, 0xC9,
+    0x33, 0x99, 0x68, 0xD8, 0x3C, 0x85, 0x3E, 0x23, 0x35, 0xEB, 0xB9, 0x87, 0x20, 0x7E, 0x79, 0x3C,
+    0xFD, 0xFF, 0x78, 0xF5, 0x5C, 0x2A, 0x6E, 0x5C, 0x47, 0x24, 0x3B, 0xB9, 0xA2, 0x11, 0x21, 0xE3,
+    0xD2, 0xDE, 0x7A, 0x57, 0xDA, 0x72, 0x0E, 0xEF, 0x72, 0x17, 0x26, 0xF6, 0xC8, 0xFD, 0x75, 0x0F,
+    0xC2, 0x52, 0x1C, 0x32, 0x01, 0x39, 0x23, 0x0E, 0x19, 0x39, 0x9F, 0x15, 0x87, 0x54, 0xE2, 0x90,
+    0xDE, 0x6E, 0x87, 0x4C, 0xA3, 0x4E, 0x2E, 0x5B, 0x91, 0xFF, 0x88, 0x75, 0x00, 0xF6, 0xA2, 0x24,
+    0x44, 0xCB, 0x36, 0x2B, 0x59, 0x82, 0x42, 0xEC, 0x1E, 0x08, 0x2D, 0x69, 0x05, 0x2C, 0xB8, 0x52,
+    0xA8, 0x9E, 0x64, 0xB3, 0x19, 0x08, 0x7E, 0x14, 0xDD, 0x61, 0x2C, 0xA0, 0xC3, 0x34, 0xFA, 0xDE,
+    0xA2, 0x2C, 0x95, 0x93, 0xD2, 0x8D, 0xBA, 0x78, 0xE9, 0x89, 0xA5, 0x2B, 0x41, 0x11, 0xD0, 0xE5,
+    0x1E, 0xA1, 0xB1, 0x94, 0x3A, 0xF2, 0x06, 0x68, 0xBD, 0x11, 0x8D, 0x80, 0x0B, 0x66, 0x14, 0x77,
+    0xB3, 0x35, 0xB0, 0x09, 0xC6, 0x17, 0xA4, 0xCC, 0x2D, 0x8A, 0x81, 0x36, 0x04, 0x5D, 0x11, 0xCD,
+    0x61, 0x76, 0x3B, 0x90, 0x74, 0x37, 0x14, 0x2E, 0x3F, 0x92, 0x2A, 0x70, 0x46, 0x5A, 0xA9, 0x6F,
+    0x41, 0x25, 0xBC, 0x23, 0xF4, 0x7E, 0xA0, 0xAE, 0x6D, 0x72, 0xFD, 0x93, 0x6B, 0xE0, 0x68, 0x88,
+    0x55, 0xCC, 0xFA, 0x57, 0xD0, 0x81, 0x69, 0xE9, 0x28, 0xAD, 0xDF, 0x0D, 0x90, 0xD0, 0xD1, 0xC3,
+    0x81, 0xBE, 0xA5, 0x40, 0x4B, 0xDE, 0x44, 0xF5, 0x15, 0x3D, 0xA7, 0xFB, 0x9D, 0xF2, 0xB2, 0x05,
+    0xE4, 0x0A, 0x44, 0x18, 0x6A, 0x2B, 0x7B, 0x67, 0x0B, 0xF9, 0x51, 0x1F, 0x97, 0x68, 0x79, 0xED,
+    0x71, 0xAF, 0x3E, 0x05, 0x87, 0x3B, 0xEB, 0xD5, 0x97, 0xB1, 0xED, 0x3F, 0x06, 0x68, 0x5F, 0x28,
+    0x42, 0xA9, 0x00, 0x4F, 0x21, 0x0A, 0x0D, 0x34, 0x8A, 0xAC, 0x20, 0x49, 0x17, 0x02, 0x48, 0x02,
+    0x46, 0xDF, 0x1D, 0xC1, 0x33, 0x90, 0x44, 0x33, 0x94, 0x38, 0x9B, 0x78, 0x2D, 0x8A, 0x36, 0xEC,
+    0xB9, 0x21, 0xB9, 0x18, 0x6B, 0xE3, 0xDB, 0x98, 0x14, 0x6E, 0xC3, 0x11, 0x94, 0x74, 0x15, 0xCE,
+    0x43, 0x5C, 0x9D, 0x56, 0xE2, 0x30, 0xFB, 0x85, 0xC4, 0x22, 0x92, 0x0D, 0x15, 0x20, 0x3B, 0x94,
+    0x0C, 0xEA, 0x4B, 0xDE, 0x5E, 0xCF, 0xD1, 0x22, 0x70, 0x15, 0x70, 0xC1, 0xFC, 0x11, 0x34, 0xD6,
+    0x8A, 0xC6, 0x4A, 0x88, 0x06, 0x0F, 0x58, 0xEC, 0x94, 0x85, 0x5C, 0x27, 0x62, 0x0F, 0xC1, 0x91,
+    0xF9, 0x83, 0xE8, 0xE9, 0x5B, 0xEC, 0x11, 0xFE, 0x28, 0xDA, 0x69, 0x26, 0xDA, 0x91, 0x62, 0xBF,
+    0x13, 0xC9, 0xD8, 0x5A, 0x2B, 0x6D, 0x06, 0x52, 0x18, 0x52, 0x50, 0x61, 0xC6, 0xB6, 0xF8, 0x12,
+    0x1E, 0xBE, 0x01, 0x66, 0x4F, 0x81, 0xEB, 0x7D, 0xC2, 0x9F, 0xAA, 0x3B, 0xB3, 0xC5, 0x79, 0x57,
+    0x5E, 0x5C, 0xB8, 0xF4, 0xFD, 0x6A, 0x49, 0x1B, 0xF0, 0xB7, 0x0D, 0xB0, 0x5D, 0xF1, 0x83, 0x8B,
+    0x25, 0x1C, 0xA5, 0x1C, 0x8C, 0xBB, 0x46, 0x33, 0x46, 0xE3, 0x1A, 0x2D, 0x35, 0x34, 0xE3, 0xDA,
+    0xA7, 0x96, 0xF6, 0xA2, 0x29, 0x8D, 0xEF, 0xA1, 0xC9, 0xD2, 0xAD, 0x6B, 0xD2, 0x18, 0x1C, 0x5B,
+    0xA8, 0xC7, 0xFC, 0xC0, 0x3A, 0xAC, 0x6C, 0xDA, 0xF7, 0x9B, 0x14, 0x96, 0x5D, 0xBF, 0xF3, 0x14,
+    0x4E, 0x92, 0x7A, 0x8C, 0xE6, 0xB6, 0x0D, 0x0B, 0x85, 0xC0, 0x96, 0x90, 0x57, 0xE5, 0x73, 0xA0,
+    0xF2, 0x2A, 0x85, 0xBB, 0xF0, 0xA1, 0x2D, 0xEC, 0xAD, 0x3E, 0x55, 0x8C, 0x13, 0xC5, 0x55, 0x74,
+    0xBD, 0x8E, 0x75, 0x6D, 0xA9, 0xB4, 0x3B, 0xAA, 0x83, 0x75, 0xCD, 0x6F, 0x9C, 0xFE, 0x32, 0x7C,
+    0x52, 0x0F, 0xBB, 0xEE, 0xD0, 0xC7, 0xA2, 0x81, 0x2C, 0x8C, 0xA7, 0x30, 0xB8, 0x10, 0x27, 0x01,
+    0xE3, 0x64, 0xF3, 0x37, 0xC6, 0xF9, 0xC6, 0xA2, 0x37, 0x03, 0xEE, 0x7A, 0xFE, 0x29, 0xC8, 0x7F,
+    0x39, 0x15, 0xA1, 0x7B, 0x4B, 0xA3, 0xED, 0x1F, 0xEF, 0x82, 0xD1, 0xDA, 0x6D, 0x7E, 0x52, 0xC3,
+    0xAA, 0x25, 0x45, 0xD7, 0xFA, 0x53, 0x90, 0x3B, 0x01, 0xA1, 0xC7, 0x44, 0x34, 0xF1, 0x78, 0xEC,
+    0x9A, 0x36, 0xEB, 0xCE, 0x06, 0x03, 0xA8, 0x7C, 0x96, 0x82, 0xF6, 0x6B, 0xF4, 0x6D, 0xE5, 0xB4,
+    0x53, 0x34, 0xCD, 0xA0, 0x31, 0x5E, 0x7D, 0xD4, 0xAB, 0xF6, 0x79, 0x15, 0x8D, 0x9A, 0x65, 0xA4,
+    0xAC, 0xF7, 0xB7, 0x96, 0x71, 0xFF, 0xDC, 0x0B, 0x26, 0x45, 0x15, 0xB2, 0x22, 0xCA, 0x40, 0xD3,
+    0xF8, 0x78, 0xA1, 0xB8, 0x2D, 0x70, 0x02, 0xD3, 0x91, 0x74, 0xC2, 0xD2, 0x2F, 0x03, 0x5C, 0x57,
+    0x8E, 0x53, 0x85, 0x48, 0xEC, 0xFF, 0x11, 0x06, 0x94, 0x38, 0x7A, 0xF0, 0x57, 0x39, 0x21, 0x69,
+    0x1F, 0x1D, 0x48, 0xFC, 0x27, 0x23, 0xE7, 0x2F, 0x07, 0x0D, 0x9A, 0xF2, 0xF8, 0x81, 0x18, 0xEE,
+    0x9C, 0x33, 0x8C, 0xB3, 0x8C, 0x33, 0xC9, 0x2E, 0x74, 0x92, 0x9C, 0x79, 0xE0, 0xCF, 0xEB, 0x48,
+    0xA1, 0x92, 0x98, 0x54, 0x85, 0x47, 0xAA, 0x7C, 0x29, 0x0A, 0x1B, 0xD5, 0x20, 0xB9, 0x28, 0x97,
+    0x1B, 0xE5, 0x74, 0x8B, 0x71, 0xF8, 0x99, 0xEB, 0xAC, 0xE7, 0x96, 0x65, 0x4F, 0x19, 0x79, 0xF1,
+    0x15, 0xCA, 0x6A, 0x2D, 0x27, 0x37, 0xAF, 0x41, 0xE6, 0xDE, 0x47, 0x34, 0xB3, 0x12, 0x35, 0xB8,
+    0x7F, 0xD1, 0xD7, 0x15, 0x86, 0xF5, 0x62, 0x53, 0x3F, 0xDF, 0xCF, 0xE6, 0x56, 0x54, 0x69, 0xE0,
+    0x41, 0x41, 0xA6, 0xCA, 0x08, 0xFF, 0xBF, 0x24, 0xF5, 0x08, 0x1B, 0x3D, 0xAE, 0x48, 0x0E, 0x56,
+    0xAA, 0x41, 0x82, 0x2F, 0x2D, 0x92, 0x48, 0x8C, 0xE7, 0x61, 0x21, 0xDC, 0x5B, 0x5E, 0x62, 0xD0,
+    0x0A, 0xFF, 0x27, 0x9B, 0x2F, 0x62, 0x7C, 0x6E, 0xF9, 0x24, 0x8D, 0x61, 0xE6, 0x7F, 0xF1, 0xDF,
+    0x91, 0x83, 0xA1, 0xBE, 0x5E, 0x81, 0x4E, 0x85, 0xD0, 0x8F, 0xEA, 0x7F, 0xCA, 0xD7, 0xF8, 0x11,
+    0xA6, 0x7A, 0xA5, 0x42, 0xAD, 0xB2, 0x83, 0xD0, 0xCF, 0xE0, 0x5B, 0x6F, 0x61, 0x9C, 0x93, 0x09,
+    0x14, 0x80, 0xF3, 0x95, 0x3B, 0x9D, 0xE0, 0x4C, 0x85, 0xCA, 0x68, 0xDD, 0x59, 0x25, 0xEA, 0xA1,
+    0xFB, 0x8F, 0xF1, 0x04, 0x91, 0x40, 0xC1, 0xBD, 0x66, 0xEA, 0xC7, 0x73, 0xFA, 0x04, 0x99, 0xEF,
+    0x38, 0x0D, 0xDA, 0x35, 0x09, 0x5E, 0x10, 0x46, 0x90, 0x4A, 0xB0, 0x16, 0x3B, 0x60, 0x47, 0xF0,
+    0x2A, 0xBE, 0x94, 0xAB, 0x9F, 0x38, 0x51, 0xC5, 0x3E, 0xE7, 0x0B, 0x02, 0x70, 0x02, 0x32, 0xC8,
+    0x52, 0x27, 0xC7, 0x9A, 0x06, 0x17, 0x66, 0x56, 0x02, 0x5E, 0xAB, 0xE3, 0x5B, 0x9C, 0xBE, 0x42,
+    0x3C, 0x26, 0xD1, 0x36, 0x0C, 0xD6, 0xC6, 0xBB, 0x62, 0xDA, 0x9D, 0x26, 0xDE, 0x85, 0x40, 0xEF,
+    0x8E, 0x2F, 0xCC, 0x2D, 0x9F, 0x10, 0x05, 0xE9, 0x40, 0xE6, 0xD5, 0x91, 0x56, 0xD5, 0xCF, 0x9F,
+    0x71, 0x8A, 0xDD, 0x10, 0xE2, 0xD0, 0x6D, 0xA5, 0x62, 0x8E, 0xB5, 0xE2, 0x22, 0x5A, 0xAA, 0x62,
+    0x2A, 0xE5, 0xB5, 0x0B, 0x62, 0x8F, 0x53, 0xA9, 0x97, 0xA6, 0xDE, 0x33, 0xAC, 0x17, 0x09, 0xED,
+    0x64, 0x1D, 0x9F, 0x2F, 0xFB, 0xC3, 0xF4, 0x17, 0xC8, 0xE7, 0x52, 0x95, 0xD4, 0x96, 0x74, 0xB4,
+    0xA3, 0x47, 0x5A, 0x4C, 0xFB, 0xBC, 0x0B, 0x31, 0xEC, 0x71, 0xEE, 0x5E, 0x1D, 0xC0, 0x78, 0x88,
+    0x01, 0x53, 0x18, 0xC4, 0x45, 0x21, 0x76, 0x2B, 0xD4, 0x4B, 0x51, 0x89, 0x79, 0xBE, 0xEB, 0x55,
+    0x79, 0x7B, 0x0B, 0x59, 0xEE, 0x76, 0xF7, 0xDA, 0x83, 0x56, 0x57, 0x67, 0x56, 0xD0, 0xD4, 0xCB,
+    0x19, 0x2D, 0x0F, 0xD0, 0xDF, 0x41, 0xE3, 0xA9, 0x57, 0xF9, 0xE8, 0x8D, 0x14, 0x8E, 0x8B, 0xB3,
+    0xC8, 0xCE, 0xF3, 0x48, 0x45, 0xA8, 0x7A, 0x06, 0x65, 0x2A, 0x86, 0x98, 0xD2, 0x43, 0x04, 0x39,
+    0xCD, 0xAD, 0x12, 0xBC, 0x34, 0xE6, 0x63, 0xB9, 0x29, 0x61, 0xA1, 0x42, 0xC9, 0xAA, 0x52, 0xC9,
+    0xBA, 0x4A, 0xD1, 0x10, 0xAE, 0x3A, 0x8B, 0xF5, 0xF3, 0x0D, 0x56, 0xB7, 0x07, 0xDB, 0x83, 0xA0,
+    0x71, 0xD8, 0xA2, 0x68, 0x9A, 0x53, 0x31, 0x6A, 0x66, 0x5C, 0xC4, 0xAE, 0x68, 0x08, 0xAD, 0x30,
+    0x0D, 0xA4, 0x52, 0xA6, 0x41, 0x0A, 0x9A, 0x33, 0x2B, 0x31, 0xAF, 0x35, 0xAA, 0xF6, 0xF2, 0x61,
+    0x83, 0x73, 0x26, 0x1F, 0xC7, 0xAC, 0xDA, 0x1D, 0xED, 0xA4, 0x96, 0xD2, 0x21, 0x94, 0x9C, 0x53,
+    0xE8, 0xDD, 0x5D, 0x0F, 0x1B, 0x16, 0x51, 0xBE, 0xDE, 0xD8, 0x8A, 0x79, 0x75, 0x65, 0x6E, 0x99,
+    0xEB, 0xB8, 0x8C, 0x0A, 0x3F, 0x0D, 0x72, 0x1F, 0x1E, 0xA2, 0xC8, 0x2F, 0xA5, 0x8A, 0xCF, 0x83,
+    0x13, 0xEC, 0xDD, 0x4A, 0xB9, 0x96, 0x5A, 0xDD, 0x97, 0xAA, 0xD0, 0xED, 0x48, 0xF2, 0x72, 0x81,
+    0x42, 0x28, 0xE1, 0x68, 0xF7, 0x8A, 0x47, 0xC4, 0x3B, 0x80, 0xA4, 0x31, 0xB3, 0xBA, 0x8A, 0xCE,
+    0x8F, 0xE9, 0xD0, 0xA7, 0x2D, 0x4E, 0xF5, 0x35, 0x7D, 0x28, 0xAE, 0x26, 0x87, 0x63, 0x29, 0xC1,
+    0xDC, 0x1D, 0xA3, 0xBD, 0x6A, 0x08, 0xE5, 0x7B, 0x3A, 0xCA, 0x14, 0x32, 0xA1, 0x95, 0xF7, 0x2E,
+    0xDD, 0xB1, 0x5F, 0x9A, 0x48, 0xBF, 0xE8, 0xE8, 0x2F, 0xF4, 0xE9, 0xFA, 0x2D, 0xA2, 0xE4, 0xC0,
+    0x78, 0x7C, 0x2E, 0xE6, 0xAE, 0x08, 0xE1, 0x1E, 0x9F, 0xBF, 0xE0, 0x2F, 0xF3, 0xB4, 0x45, 0x7D,
+    0xF6, 0xB5, 0xDB, 0x20, 0xF9, 0x22, 0xF8, 0x7D, 0xBE, 0xA8, 0xF4, 0x46, 0x40, 0x9B, 0x61, 0x6A,
+    0xD7, 0x72, 0x73, 0x3C, 0xDF, 0xBF, 0x37, 0x59, 0x50, 0x09, 0x6E, 0xCC, 0xD9, 0x22, 0x3A, 0x53,
+    0xA8, 0x63, 0x79, 0xE0, 0xA5, 0x57, 0x43, 0x3A, 0xF7, 0x1E, 0xED, 0xA7, 0x43, 0x74, 0x42, 0x42,
+    0x43, 0x3B, 0x36, 0x04, 0x6B, 0x33, 0x7D, 0x63, 0x30, 0xE9, 0x83, 0x2B, 0x05, 0xF1, 0xDA, 0xCD,
+    0x78, 0x3D, 0x1D, 0xD6, 0x47, 0x36, 0x83, 0xC4, 0xAB, 0xDE, 0x93, 0xB3, 0x50, 0x25, 0xAA, 0x18,
+    0x35, 0x9F, 0xB6, 0x2B, 0xD2, 0x23, 0x70, 0x4D, 0xEF, 0x6F, 0xC9, 0x7D, 0x37, 0xFE, 0xEA, 0xD8,
+    0xAF, 0x50, 0xF0, 0x51, 0xA2, 0x3E, 0x66, 0xA4, 0x76, 0xBE, 0x33, 0x2D, 0x74, 0xA1, 0xDC, 0xB5,
+    0x9F, 0xA3, 0x26, 0xB9, 0x6E, 0xB7, 0x1A, 0x96, 0x52, 0xCD, 0x64, 0xC7, 0x55, 0xB7, 0x61, 0x23,
+    0xFB, 0x35, 0x1D, 0x91, 0x57, 0x40, 0x6E, 0x1B, 0xD9, 0x45, 0xCB, 0x26, 0xF9, 0x64, 0x0F, 0x30,
+    0xB0, 0xB9, 0xD6, 0xC8, 0x1E, 0x3B, 0x27, 0x8F, 0x9A, 0x4F, 0x1A, 0xEC, 0xF1, 0x4F, 0xD9, 0x63,
+    0xE9, 0xCD, 0xF6, 0xB8, 0xF9, 0xF4, 0xCD, 0x92, 0x28, 0x10, 0x9C, 0x43, 0x83, 0x67, 0x18, 0x3B,
+    0x1D, 0x91, 0xD7, 0x49, 0x4E, 0x87, 0x75, 0xAF, 0x02, 0xA7, 0x45, 0xF8, 0x9D, 0x71, 0xC6, 0xD5,
+    0xA2, 0xC7, 0x55, 0xAB, 0xDD, 0x33, 0xF3, 0xFA, 0x3F, 0x8E, 0x0B, 0xAB, 0x85, 0x8F, 0x4F, 0x38,
+    0x13, 0x69, 0xB7, 0x9F, 0x76, 0x0F, 0xC2, 0x0B, 0xAC, 0xD9, 0x9C, 0x8E, 0xCF, 0xB3, 0xEE, 0x78,
+    0xC1, 0xBA, 0x7D, 0xB2, 0xA0, 0x5F, 0x2E, 0xBC, 0x2C, 0xC3, 0xAD, 0xC0, 0x49, 0x65, 0x1C, 0x2F,
+    0xCB, 0xE6, 0xAD, 0x79, 0x69, 0x7C, 0x54, 0x44, 0xF0, 0xF2, 0x67, 0xBE, 0xCF, 0xE5, 0x7F, 0x00,
+    0x95, 0x53, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x7D, 0xF6, 0x86, 0xB8, 0xB0, 0x14, 0x37, 0xE1, 0xA3,
+    0xE0, 0xCE, 0x2D, 0x0A, 0x4E, 0xB6, 0x4D, 0xE1, 0xD8, 0x46, 0x14, 0x14, 0x69, 0x52, 0x40, 0x4F,
+    0x1D, 0x24, 0x68, 0xAE, 0x48, 0x71, 0x89, 0x0D, 0x7F, 0x20, 0xF9, 0x07, 0xD0, 0x12, 0x89, 0x90,
+    0xF2, 0x8A, 0x04, 0x2F, 0x50, 0xD0, 0xBA, 0x40, 0x4A, 0x19, 0x4B, 0x50, 0x21, 0x21, 0x8C, 0x74,
+    0xC5, 0x25, 0xD8, 0x5E, 0xDE, 0xFA, 0x10, 0x24, 0x41, 0x48, 0x61, 0x76, 0xF6, 0x69, 0x3F, 0x66,
+    0x76, 0x67, 0xE6, 0xED, 0xC6, 0xAB, 0x55, 0x4C, 0x75, 0x4A, 0xAA, 0x14, 0x45, 0x5F, 0x28, 0x2A,
+    0x28, 0x37, 0xE7, 0x80, 0x80, 0x3D, 0xEC, 0x01, 0xCB, 0x01, 0xB0, 0x11, 0xC0, 0xD7, 0xBA, 0x30,
+    0x1D, 0xD5, 0x00, 0x5D, 0x2F, 0xF7, 0x61, 0x15, 0x15, 0x6E, 0x9F, 0x9E, 0x26, 0xB1, 0xD6, 0x99,
+    0x78, 0x5B, 0x40, 0x3C, 0x53, 0x70, 0xEE, 0x2A, 0xB8, 0xC2, 0xF4, 0x8C, 0x67, 0x18, 0xB5, 0x75,
+    0xE9, 0xED, 0xD5, 0x71, 0x40, 0x1D, 0xC5, 0x01, 0xE2, 0x1A, 0x7E, 0x03, 0x97, 0x27, 0xE5, 0x13,
+    0xC8, 0x66, 0x3E, 0x68, 0x87, 0x41, 0x7A, 0x10, 0x44, 0x5B, 0xC1, 0x81, 0xDC, 0x1B, 0xCF, 0xEA,
+    0x6C, 0xEA, 0x65, 0xB4, 0x13, 0xD1, 0xC2, 0x49, 0xE0, 0x6D, 0x2B, 0x0F, 0x90, 0x4E, 0xB1, 0x08,
+    0xC4, 0xA2, 0x0C, 0x81, 0x48, 0x98, 0x28, 0x88, 0x95, 0xC1, 0xEF, 0x85, 0x59, 0xFF, 0xF4, 0xEE,
+    0x84, 0x36, 0x47, 0xDB, 0xC7, 0x99, 0xF7, 0x7C, 0x5B, 0x3A, 0xCA, 0x6E, 0xFB, 0x34, 0x66, 0x1E,
+    0x91, 0xC1, 0x0D, 0x1A, 0x33, 0x76, 0x83, 0x56, 0x69, 0x56, 0x84, 0xE2, 0x81, 0x70, 0x32, 0x7F,
+    0x55, 0xC1, 0x83, 0xD3, 0xE2, 0xAC, 0xA4, 0x13, 0xC0, 0x6E, 0xDE, 0x30, 0x80, 0x4A, 0x02, 0x4E,
+    0x25, 0x13, 0x03, 0x9C, 0x4E, 0x22, 0x6E, 0xB4, 0xDC, 0x85, 0x2E, 0x16, 0x5E, 0xD8, 0x5A, 0xA5,
+    0xA5, 0x7F, 0x5C, 0x6D, 0x22, 0xBD, 0x57, 0x0F, 0x91, 0x5B, 0x7A, 0x04, 0x8D, 0xB4, 0x22, 0xF8,
+    0x06, 0xDC, 0x1A, 0x69, 0xE6, 0x69, 0xC8, 0x93, 0xC3, 0xBC, 0x70, 0x74, 0x29, 0x27, 0xDD, 0xE9,
+    0x71, 0xC2, 0x86, 0x18, 0x12, 0x7D, 0xB6, 0xA9, 0x44, 0x98, 0x59, 0x99, 0x59, 0x0A, 0xC2, 0xF8,
+    0x6B, 0x3B, 0xAB, 0x77, 0x66, 0xF5, 0xE7, 0xF8, 0x55, 0xD3, 0x0B, 0x42, 0xAC, 0x98, 0x2D, 0xCC,
+    0x33, 0x8D, 0x3F, 0x9A, 0xEA, 0x26, 0xD5, 0xED, 0xD9, 0x15, 0xDC, 0x30, 0x35, 0x0B, 0xB1, 0x8C,
+    0x01, 0xF6, 0x51, 0xA1, 0xB4, 0x0A, 0x5B, 0x09, 0x25, 0x32, 0x27, 0x71, 0x99, 0xDD, 0x1C, 0x7A,
+    0xE7, 0xB6, 0x7F, 0x09, 0xEF, 0x26, 0x19, 0x25, 0x72, 0xB8, 0x63, 0xA4, 0x09, 0x52, 0x98, 0x19,
+    0x98, 0xB6, 0x5F, 0xC2, 0x6A, 0x3A, 0x03, 0x5C, 0x7D, 0x70, 0x3F, 0xD7, 0x2D, 0xF1, 0x77, 0x71,
+    0x38, 0x5D, 0xDF, 0x7D, 0xC9, 0x01, 0x29, 0xA0, 0x97, 0x5B, 0x75, 0x2E, 0xDE, 0xD4, 0xE5, 0x70,
+    0x7A, 0xA0, 0x33, 0x66, 0x96, 0xC6, 0xA0, 0x93, 0x47, 0x27, 0x04, 0xE7, 0xF4, 0xB5, 0xE1, 0x29,
+    0xC1, 0x08, 0x60, 0x1D, 0x96, 0x20, 0x38, 0xF5, 0xE0, 0x65, 0xE9, 0x0F, 0xB2, 0x60, 0x8F, 0x63,
+    0x91, 0x45, 0x7C, 0x8D, 0x42, 0x85, 0x9E, 0x8A, 0x84, 0x1A, 0xFA, 0x6A, 0x93, 0x28, 0xB3, 0x4D,
+    0x91, 0x8D, 0x64, 0x72, 0xE0, 0x24, 0xC4, 0xDA, 0xC5, 0xD0, 0x7F, 0x5A, 0xCF, 0x61, 0xE8, 0x1D,
+    0x45, 0x43, 0x84, 0x76, 0xC3, 0x6B, 0x97, 0xBA, 0x3B, 0xBC, 0xC4, 0x20, 0x29, 0xC5, 0x43, 0x13,
+    0x88, 0x19, 0x48, 0xDD, 0xB1, 0xBA, 0x9E, 0x98, 0x98, 0x95, 0x1E, 0x3F, 0x69, 0x93, 0xB4, 0x70,
+    0x6A, 0x43, 0xF7, 0xE4, 0x3F, 0x40, 0x74, 0x50, 0x4F, 0xA1, 0x4F, 0xFA, 0x0D, 0x29, 0xFA, 0x0B,
+    0x73, 0xF0, 0xF9, 0x90, 0xA7, 0x25, 0x69, 0xF2, 0x8F, 0x79, 0x72, 0x89, 0xA6, 0x72, 0xD6, 0xA8,
+    0x22, 0x09, 0x03, 0x92, 0x11, 0x92, 0x94, 0x1E, 0xC9, 0xF1, 0xE0, 0xF2, 0x99, 0x8B, 0x4C, 0x28,
+    0x5B, 0x59, 0x05, 0xCA, 0x73, 0x06, 0x88, 0xF5, 0x35, 0x8D, 0x4B, 0x34, 0x5B, 0xC7, 0x9A, 0xA1,
+    0xDC, 0xEA, 0xDE, 0x03, 0x09, 0xF9, 0x06, 0xFB, 0x43, 0x26, 0xDE, 0x2B, 0xF7, 0x4E, 0xE1, 0xA1,
+    0xEA, 0x61, 0x10, 0x22, 0xDC, 0xC0, 0xE2, 0x1A, 0xAE, 0x98, 0x2F, 0xBB, 0xB0, 0xBB, 0x6B, 0xCA,
+    0x92, 0x48, 0xE5, 0x94, 0xBC, 0x4D, 0x8E, 0x91, 0xEF, 0xA0, 0x85, 0x75, 0x41, 0x1B, 0x93, 0x73,
+    0x5C, 0x1A, 0xE5, 0x80, 0xD3, 0x0B, 0x06, 0x74, 0x81, 0x4E, 0x8C, 0x3B, 0xD3, 0xFA, 0x97, 0xA4,
+    0x25, 0xAE, 0xD7, 0xFC, 0x4F, 0x17, 0xD5, 0xBC, 0x17, 0x86, 0x2C, 0x2B, 0xA3, 0xDA, 0x4C, 0xFF,
+    0xB6, 0x21, 0x5D, 0x74, 0xA7, 0x58, 0x6C, 0xB2, 0xF4, 0xB0, 0x55, 0x7B, 0xD8, 0x8F, 0x1F, 0xA3,
+    0xE2, 0xE7, 0x5A, 0x63, 0xFB, 0x09, 0xBD, 0x59, 0x3F, 0x6C, 0xDD, 0xC6, 0x19, 0xFF, 0x48, 0x4A,
+    0xA2, 0xED, 0x43, 0x74, 0x19, 0xA4, 0xC6, 0x85, 0x2C, 0x33, 0x43, 0x06, 0x23, 0xD0, 0x33, 0x97,
+    0x0C, 0xAF, 0xC0, 0xB3, 0x48, 0xC5, 0x28, 0x3A, 0x04, 0x68, 0xDE, 0x20, 0x25, 0x43, 0x07, 0x07,
+    0xC8, 0x14, 0x03, 0x85, 0x3C, 0xB8, 0x80, 0x0A, 0x38, 0x26, 0x6D, 0x0F, 0x19, 0x0A, 0x04, 0xDE,
+    0x3B, 0x24, 0x83, 0x87, 0x56, 0x1E, 0xAC, 0x41, 0x83, 0x81, 0x58, 0xE1, 0x45, 0x1E, 0x3A, 0x14,
+    0x48, 0xE8, 0x74, 0xE8, 0x58, 0x1A, 0x75, 0x5C, 0x34, 0x41, 0x13, 0x36, 0x65, 0x62, 0x3A, 0x22,
+    0x79, 0xFD, 0x7D, 0xC7, 0xF7, 0xA4, 0xA7, 0xA4, 0xAE, 0x93, 0x48, 0xD6, 0x23, 0xEF, 0x7B, 0xE4,
+    0xF1, 0xF8, 0xFD, 0xBB, 0xEF, 0xDF, 0x1D, 0x0F, 0x53, 0x10, 0x47, 0x2A, 0x88, 0xC7, 0x89, 0xE8,
+    0x30, 0x49, 0xF2, 0x70, 0xF8, 0x38, 0x82, 0x10, 0x47, 0xCC, 0x47, 0xA4, 0x9E, 0x0F, 0xE9, 0x08,
+    0x1E, 0x4F, 0x12, 0x59, 0xC9, 0x3D, 0x12, 0xBA, 0x21, 0xFF, 0xC3, 0x88, 0x82, 0xB7, 0x03, 0x8A,
+    0x7E, 0x79, 0x02, 0x8D, 0x28, 0x19, 0x34, 0xBE, 0x8E, 0xDE, 0x26, 0x0A, 0x3E, 0xB4, 0xC9, 0xFF,
+    0xDC, 0xC3, 0xD8, 0x1A, 0xEF, 0x64, 0xE6, 0x5D, 0xD3, 0xF8, 0x17, 0x95, 0xE4, 0x3C, 0xD4, 0x24,
+    0xF2, 0x20, 0x96, 0x99, 0x1F, 0xCA, 0xF4, 0xA7, 0x24, 0x31, 0x44, 0xE4, 0x44, 0x6E, 0x81, 0xC7,
+    0xBA, 0xA4, 0x9F, 0xD4, 0x7D, 0xA2, 0x8A, 0xB6, 0x9B, 0x85, 0x7E, 0xE7, 0x1E, 0x85, 0x52, 0xDF,
+    0x4F, 0x03, 0xAD, 0xD5, 0xCF, 0x26, 0x74, 0x38, 0xC0, 0x76, 0x62, 0x6A, 0xCE, 0xD7, 0x95, 0xBC,
+    0x9C, 0x4F, 0xD2, 0xFA, 0x31, 0xEA, 0xCE, 0x51, 0xF7, 0x38, 0x9D, 0x97, 0x0B, 0xB9, 0xAF, 0xCB,
+    0xDE, 0x1B, 0x73, 0x18, 0x90, 0x54, 0x41, 0x1E, 0x95, 0x7E, 0xEA, 0x65, 0x22, 0x94, 0xB9, 0x00,
+    0x8D, 0x49, 0x72, 0xCA, 0x39, 0xB2, 0xAA, 0x2E, 0x51, 0x73, 0x0E, 0x03, 0x32, 0x3A, 0x92, 0x7C,
+    0x0A, 0xDC, 0x3A, 0x26, 0x5F, 0xED, 0xBA, 0xA6, 0x40, 0x81, 0xFF, 0x82, 0x1C, 0xC8, 0x91, 0x6F,
+    0xFF, 0x0C, 0xDD, 0x9D, 0x5B, 0x4B, 0xC7, 0xF2, 0xAF, 0xB9, 0x6F, 0x95, 0xF3, 0x54, 0x04, 0x74,
+    0xD5, 0x8F, 0x49, 0x16, 0xE4, 0xE9, 0xB0, 0x97, 0xE4, 0x17, 0x44, 0x75, 0x91, 0xEA, 0x40, 0xCD,
+    0xCB, 0x72, 0xDE, 0xD6, 0xB7, 0x28, 0x2A, 0xC8, 0x2D, 0x21, 0x51, 0x87, 0x2E, 0xCC, 0xD3, 0x85,
+    0x80, 0xD6, 0xE5, 0x67, 0x99, 0xFD, 0x7E, 0xB8, 0x72, 0x9C, 0xAA, 0x20, 0xAC, 0x7C, 0x7A, 0x7A,
+    0x7C, 0x20, 0xD5, 0x8C, 0xBE, 0x0A, 0xE6, 0x5E, 0xA9, 0xC8, 0x49, 0xC9, 0x0B, 0x25, 0xAD, 0x3A,
+    0xAA, 0x23, 0x3E, 0x4B, 0xB3, 0xDE, 0x49, 0x2B, 0x5B, 0x3B, 0xDF, 0xA3, 0xF0, 0xFC, 0xDA, 0x05,
+    0xA2, 0xEE, 0xDA, 0xAD, 0x6D, 0xC0, 0xB7, 0x78, 0x40, 0x2F, 0x74, 0x4F, 0xD2, 0x6B, 0x6B, 0x73,
+    0xF2, 0x7E, 0x9A, 0x4B, 0xEB, 0x7D, 0x47, 0xB9, 0x29, 0xC9, 0x90, 0x9A, 0xA5, 0x9A, 0xC0, 0x53,
+    0xDA, 0x62, 0x17, 0x98, 0xC1, 0x33, 0xF1, 0x11, 0xA9, 0xAC, 0x1B, 0xCA, 0x7F, 0x07, 0xDC, 0xA9,
+    0xC0, 0x53, 0xC1, 0x83, 0x7C, 0x7C, 0xA1, 0x4F, 0xEF, 0x9E, 0xB0, 0xB3, 0x9B, 0x62, 0x33, 0xF7,
+    0xDE, 0xCA, 0x02, 0xA9, 0x22, 0xF4, 0xBF, 0x9C, 0xCA, 0xDB, 0xB9, 0x93, 0x16, 0x94, 0xF7, 0xE8,
+    0xE9, 0xB1, 0x48, 0xD7, 0x38, 0x89, 0x66, 0x47, 0xCE, 0x43, 0x98, 0xB5, 0x2A, 0xAA, 0x9E, 0xFF,
+    0xC3, 0xFF, 0x64, 0x7E, 0x7A, 0xD1, 0x51, 0x98, 0xA3, 0x38, 0xEB, 0xCA, 0x17, 0xD3, 0x35, 0xCC,
+    0x4D, 0xF6, 0xC2, 0x9A, 0x7C, 0x31, 0xEB, 0xAE, 0xC9, 0x57, 0x15, 0x40, 0x03, 0xE6, 0xE5, 0xCB,
+    0x60, 0x5E, 0xBE, 0x14, 0xBF, 0xD0, 0x95, 0xA7, 0xD3, 0x73, 0x73, 0xFE, 0x9D, 0x22, 0x97, 0xD3,
+    0xFD, 0x57, 0x94, 0xAB, 0x98, 0xF9, 0x87, 0x3F, 0xDF, 0x18, 0x61, 0x7E, 0x7A, 0x69, 0x29, 0x0C,
+    0x78, 0x7E, 0x60, 0x2E, 0x35, 0xEB, 0xF9, 0x94, 0xAB, 0x7A, 0x0E, 0x9F, 0x27, 0x45, 0x2C, 0x35,
+    0x59, 0xD7, 0x88, 0xA6, 0x88, 0x7A, 0x3B, 0xA7, 0x61, 0xB9, 0x19, 0xED, 0xA1, 0xA3, 0xC6, 0x10,
+    0x4D, 0xBF, 0x7D, 0x8D, 0xBC, 0x84, 0xE6, 0x65, 0x38, 0x0B, 0x52, 0x1E, 0xD1, 0x29, 0xA2, 0x75,
+    0xB2, 0xA1, 0x35, 0x52, 0xF3, 0xD7, 0x55, 0xA0, 0xD5, 0xF4, 0x52, 0x68, 0x0D, 0xC7, 0x1C, 0xC5,
+    0x18, 0x1F, 0xE6, 0x43, 0xD6, 0x32, 0x91, 0x54, 0xCF, 0x0A, 0xD5, 0x95, 0x71, 0xD0, 0xD0, 0x38,
+    0xEC, 0x95, 0x64, 0xEE, 0xAB, 0x8B, 0x78, 0x79, 0x09, 0x47, 0xF2, 0xD8, 0x43, 0x53, 0x12, 0x6A,
+    0xD2, 0x9B, 0x68, 0x3A, 0x48, 0x1F, 0x54, 0xD2, 0x18, 0x16, 0x37, 0x58, 0x08, 0x35, 0x6C, 0xB9,
+    0x90, 0x71, 0x9E, 0x58, 0x74, 0x9D, 0x45, 0x4D, 0x12, 0x26, 0x75, 0x87, 0xF4, 0x48, 0xE3, 0xFB,
+    0x08, 0xCD, 0x47, 0xB3, 0x7E, 0xDD, 0xC1, 0x54, 0x7C, 0x8F, 0xD6, 0xC1, 0xD8, 0x0D, 0xFF, 0xAA,
+    0x5D, 0x7B, 0xD9, 0x49, 0x8A, 0xE2, 0x28, 0x0E, 0x8C, 0x27, 0x3D, 0x45, 0x9E, 0x72, 0x72, 0x3B,
+    0xBF, 0x9E, 0x25, 0xB1, 0x15, 0x8A, 0xF4, 0xBD, 0xF4, 0xF5, 0xD4, 0x19, 0x39, 0xA2, 0x7A, 0x7A,
+    0x71, 0xA2, 0x21, 0xEF, 0xF7, 0x2A, 0x70, 0xF2, 0xED, 0xD3, 0x77, 0x33, 0x81, 0x99, 0x58, 0xA4,
+    0xEE, 0x24, 0x75, 0xA0, 0xFD, 0xD3, 0xA9, 0xF8, 0xB8, 0x70, 0xF2, 0x0A, 0xA7, 0x7B, 0xB7, 0x84,
+    0xD9, 0x78, 0x98, 0x1B, 0x09, 0xAB, 0x21, 0xCB, 0x50, 0x11, 0x29, 0x47, 0x81, 0xF7, 0x52, 0x02,
+    0x23, 0xAF, 0xA7, 0x3C, 0x11, 0x30, 0x91, 0x75, 0x03, 0x73, 0x86, 0x50, 0x3B, 0xA0, 0xA3, 0x18,
+    0x8A, 0x70, 0x11, 0x50, 0x5A, 0x25, 0xCB, 0x08, 0x8D, 0x4F, 0x2F, 0xF6, 0x26, 0x59, 0x33, 0xEB,
+    0x73, 0x0C, 0xF3, 0x73, 0x80, 0x76, 0x9A, 0x02, 0x3A, 0x9B, 0x1A, 0xD1, 0x40, 0x2C, 0xB0, 0x89,
+    0x4B, 0xA3, 0xBD, 0x0E, 0xB9, 0x9A, 0xC9, 0x59, 0x4B, 0x64, 0xF5, 0x0D, 0xDD, 0x8C, 0xCD, 0x34,
+    0xCA, 0x98, 0xE2, 0xEB, 0x19, 0x9D, 0xC7, 0x4B, 0x99, 0xA1, 0x98, 0x59, 0x4C, 0x31, 0x33, 0x14,
+    0x33, 0x37, 0x64, 0x28, 0x27, 0xDE, 0x05, 0x9C, 0x9D, 0xDF, 0xA0, 0xA8, 0xE9, 0x5D, 0xF0, 0x41,
+    0x77, 0x7D, 0xCE, 0x37, 0x33, 0x33, 0xCF, 0x14, 0x09, 0x8E, 0x86, 0xE1, 0x78, 0x59, 0x84, 0x4E,
+    0xCC, 0x14, 0x67, 0xED, 0x10, 0x14, 0x2F, 0x5E, 0x0F, 0x81, 0x3D, 0x31, 0x71, 0x69, 0x7A, 0xC9,
+    0x58, 0x21, 0xB1, 0xD1, 0x08, 0x62, 0xBB, 0x01, 0x5F, 0x30, 0x1D, 0x48, 0x0D, 0xEB, 0x61, 0xA9,
+    0x4B, 0x96, 0x1A, 0x36, 0xC4, 0xD3, 0x2D, 0x37, 0xC1, 0xC3, 0xB3, 0xE2, 0xB6, 0x82, 0x1A, 0xE5,
+    0xEF, 0x16, 0x4A, 0x0A, 0x1A, 0x89, 0x01, 0xE3, 0xFD, 0x8E, 0x91, 0xB7, 0x67, 0xE4, 0x5D, 0x3F,
+    0x67, 0xA4, 0x66, 0x79, 0xED, 0x8F, 0x59, 0x5E, 0xE7, 0x03, 0x96, 0x57, 0x84, 0x2C, 0xAF, 0xDC,
+    0x91, 0x97, 0x10, 0x41, 0x30, 0xA3, 0x51, 0x8C, 0xB8, 0x4E, 0x6D, 0x34, 0x39, 0x4C, 0x74, 0x9C,
+    0xE9, 0x5A, 0x0D, 0x2C, 0x94, 0x23, 0x1A, 0x1E, 0x26, 0x21, 0xCE, 0x9B, 0x51, 0xD8, 0x04, 0x1F,
+    0x34, 0x72, 0xAB, 0xB2, 0x6E, 0x5C, 0x6D, 0x9D, 0x0B, 0x4F, 0xC9, 0x44, 0x63, 0xB2, 0x4D, 0x98,
+    0x5B, 0x19, 0xC4, 0x23, 0xB2, 0x6A, 0xEE, 0x63, 0x2A, 0x0E, 0x03, 0x17, 0x08, 0x48, 0xF2, 0xE8,
+    0x49, 0x0E, 0x93, 0x1D, 0x0F, 0xAF, 0xF4, 0x80, 0x9D, 0x56, 0x38, 0x8C, 0xAF, 0x73, 0x90, 0xFB,
+    0xEA, 0xD5, 0x8A, 0x2C, 0x8D, 0x50, 0x61, 0xA7, 0xA0, 0x0C, 0x95, 0x69, 0x72, 0x99, 0x30, 0x3C,
+    0x28, 0x52, 0xCB, 0xA9, 0xA5, 0xEF, 0xE9, 0xD2, 0xD5, 0xD5, 0x00, 0x3F, 0xBF, 0x4B, 0x3E, 0x3B,
+    0xF5, 0x45, 0x1A, 0xB8, 0xC1, 0x41, 0xD0, 0xB5, 0xD9, 0xCF, 0x5C, 0x9E, 0x34, 0xF9, 0x0B, 0xC6,
+    0x67, 0x65, 0x07, 0x43, 0x57, 0xA6, 0xB0, 0xC1, 0xA0, 0xC1, 0xBB, 0xBF, 0xD5, 0x40, 0xF5, 0xDA,
+    0x4C, 0xFC, 0xC4, 0xE9, 0x1E, 0x67, 0x6B, 0x0D, 0x5E, 0x02, 0x02, 0xFF, 0x25, 0x18, 0xDC, 0xB8,
+    0x15, 0x3E, 0x71, 0x92, 0x06, 0xB3, 0xF3, 0x37, 0x46, 0xEA, 0x00, 0xA9, 0x7B, 0x3A, 0x1C, 0xD0,
+    0x30, 0x6A, 0xFF, 0x16, 0x35, 0xB9, 0x67, 0xC5, 0x6A, 0x6D, 0xD4, 0x9B, 0xE8, 0x55, 0xFE, 0x3B,
+    0x55, 0xB3, 0xA7, 0xD1, 0x6F, 0x6A, 0xE2, 0x2A, 0xE0, 0xDF, 0x35, 0x1D, 0x03, 0xDD, 0x3B, 0xCC,
+    0x11, 0x7C, 0xC7, 0xFC, 0x89, 0x85, 0xC6, 0xCC, 0x05, 0x90, 0x43, 0x21, 0x73, 0x56, 0xB3, 0x04,
+    0x5E, 0x7A, 0xB6, 0x79, 0xC6, 0xF4, 0xA0, 0x9A, 0x4F, 0x5E, 0x31, 0x22, 0x28, 0x48, 0x32, 0x01,
+    0xAA, 0xF8, 0x93, 0xC8, 0x48, 0x36, 0xFF, 0x45, 0xE9, 0x33, 0x7A, 0x15, 0x61, 0xBC, 0x40, 0x32,
+    0xD2, 0xAD, 0x26, 0x91, 0xE4, 0xAC, 0xE6, 0x46, 0xEE, 0x16, 0x4E, 0x29, 0x33, 0xBB, 0xF4, 0x95,
+    0x95, 0xB1, 0x64, 0xF0, 0x37, 0x13, 0xCB, 0x47, 0x5B, 0xD4, 0x16, 0x17, 0x14, 0x80, 0xB2, 0x97,
+    0xD3, 0x51, 0x51, 0xD2, 0x4D, 0x5B, 0xEB, 0x9C, 0x96, 0x11, 0x4F, 0x39, 0x28, 0xD9, 0xE5, 0xC0,
+    0x17, 0x10, 0x75, 0x8E, 0x70, 0x64, 0x2B, 0x5A, 0x1A, 0x4C, 0x0A, 0xAE, 0xCD, 0xA1, 0x94, 0xAC,
+    0xD6, 0x4D, 0x22, 0xAD, 0xCB, 0x99, 0xE6, 0x7A, 0xE9, 0x54, 0xB4, 0x82, 0xD6, 0x1D, 0x34, 0xDA,
+    0x6E, 0xA8, 0x98, 0x9C, 0x7A, 0x29, 0xDC, 0xD5, 0x57, 0xD1, 0x61, 0x87, 0x8D, 0xA2, 0xA2, 0xCE,
+    0x4C, 0xB3, 0xBA, 0x11, 0xB5, 0x02, 0xB3, 0xFA, 0xA0, 0x04, 0x5C, 0x3A, 0x5C, 0x8E, 0xC5, 0xFB,
+    0x8F, 0x9F, 0xE7, 0x36, 0xC0, 0x80, 0x5B, 0xF3, 0x64, 0x65, 0x62, 0x7F, 0xF1, 0xAF, 0x20, 0xB9,
+    0x6C, 0x20, 0x88, 0x6C, 0xF8, 0x21, 0x4D, 0x8D, 0xEF, 0x37, 0xEF, 0x98, 0x2E, 0x44, 0x46, 0x8E,
+    0x8B, 0x2B, 0x2D, 0xE6, 0x14, 0xC5, 0x07, 0xC6, 0x7C, 0xCF, 0x73, 0xA6, 0x09, 0xA3, 0xB6, 0x86,
+    0xE1, 0x10, 0xCC, 0x79, 0xCA, 0x4E, 0xF7, 0x84, 0x07, 0xD7, 0x28, 0x77, 0x7C, 0x19, 0x77, 0x0D,
+    0xA2, 0x1F, 0x87, 0xA7, 0xE3, 0xC6, 0x28, 0xF3, 0x70, 0x8E, 0x59, 0x3F, 0x9E, 0x19, 0x54, 0x51,
+    0x28, 0x9D, 0x1A, 0x2E, 0x94, 0x2B, 0xB8, 0x36, 0xFA, 0x13, 0xC6, 0x11, 0x28, 0x06, 0x29, 0x80,
+    0x9F, 0x01, 0x78, 0x59, 0xA0, 0x73, 0x2F, 0x7F, 0xA6, 0xEE, 0x7B, 0xF9, 0xB0, 0xCF, 0x4F, 0x87,
+    0xE3, 0x22, 0x06, 0x4C, 0x1A, 0xCE, 0x35, 0xD3, 0xDC, 0x28, 0xC8, 0x20, 0x6D, 0x7F, 0x6E, 0x01,
+    0x17, 0xF6, 0x1A, 0xD4, 0xB9, 0x1D, 0x54, 0xD0, 0xF4, 0x9C, 0x18, 0x94, 0x82, 0xB8, 0x09, 0xEA,
+    0x19, 0x70, 0x51, 0x20, 0x96, 0x38, 0xCA, 0xD1, 0x31, 0x03, 0xD4, 0x0F, 0xCE, 0x47, 0x39, 0xC0,
+    0x9F, 0x2A, 0x80, 0xDB, 0x35, 0x80, 0xD2, 0x0C, 0xA2, 0xDB, 0x00, 0xFE, 0xDF, 0x01, 0xE4, 0x03,
+    0xC5, 0x23, 0x01, 0x6C, 0x06, 0x64, 0x40, 0xA0, 0x66, 0xEE, 0xA1, 0x0A, 0x8A, 0x2A, 0x12, 0x6A,
+    0x80, 0x9F, 0xED, 0xDF, 0xE3, 0x1B, 0xC7, 0x78, 0xDA, 0xFA, 0x30, 0x2B, 0xF9, 0xC8, 0x18, 0x36,
+    0x3C, 0x9D, 0x44, 0x61, 0xB3, 0x60, 0xF0, 0x4A, 0x9E, 0xD4, 0x30, 0x60, 0x2C, 0x9C, 0x7B, 0x55,
+    0x32, 0x04, 0xE9, 0x36, 0x68, 0x1F, 0x98, 0x21, 0x66, 0xB0, 0x79, 0x4D, 0xE4, 0x88, 0x29, 0x76,
+    0xF3, 0x2B, 0x88, 0xB5, 0xAC, 0x87, 0x49, 0x60, 0x24, 0x17, 0x47, 0x34, 0x28, 0x08, 0xED, 0xF4,
+    0x20, 0x89, 0xB3, 0x1B, 0x90, 0xE4, 0xF0, 0x88, 0xE2, 0x05, 0x06, 0x6F, 0xAB, 0x03, 0x24, 0xEE,
+    0xC7, 0x48, 0x02, 0xC9, 0x16, 0x04, 0xFE, 0x5A, 0x83, 0xEE, 0xD5, 0x93, 0x07, 0x24, 0xF9, 0x1C,
+    0xAA, 0x29, 0xBA, 0xC8, 0xF3, 0x7D, 0x51, 0xA2, 0x6F, 0x6A, 0xFC, 0xC0, 0x34, 0x7E, 0x94, 0x9E,
+    0x3B, 0x49, 0xB7, 0xC4, 0xE5, 0xDC, 0xFE, 0x4C, 0x61, 0x69, 0x40, 0xEF, 0x93, 0xBD, 0x15, 0x8B,
+    0xCD, 0xCC, 0xA7, 0x9B, 0xC7, 0xE8, 0x44, 0x3B, 0xA6, 0xCB, 0x7C, 0xAC, 0xEF, 0xE2, 0xC3, 0x61,
+    0x3E, 0x44, 0x02, 0x3E, 0x26, 0x99, 0xDC, 0x1C, 0xB3, 0xD0, 0x65, 0xB0, 0x06, 0x16, 0x2E, 0xA5,
+    0x00, 0x57, 0x40, 0x3B, 0x7A, 0x0B, 0x03, 0x82, 0x8F, 0x98, 0x8F, 0x7F, 0x31, 0x1F, 0x15, 0xF3,
+    0x51, 0x0C, 0xF9, 0xB0, 0xBF, 0x00, 0x1F, 0xCE, 0x0E, 0x2B, 0x9C, 0x80, 0xC9, 0x35, 0xE6, 0x6E,
+    0x6A, 0x95, 0xCE, 0xA0, 0x3F, 0xD1, 0x4A, 0x17, 0xCB, 0x70, 0xF7, 0xD4, 0xAD, 0xB8, 0xE0, 0x2C,
+    0x7F, 0x00, 0x70, 0x0C, 0xA8, 0x5A, 0x70, 0x9C, 0xB3, 0x3F, 0x16, 0x59, 0xFA, 0xD3, 0x72, 0x64,
+    0x55, 0xF7, 0xFF, 0xCB, 0xC0, 0x83, 0x21, 0xDE, 0x96, 0x40, 0x98, 0x7E, 0x71, 0x3B, 0xE3, 0x9A,
+    0x79, 0xED, 0x60, 0x88, 0x8B, 0x4B, 0xA0, 0x86, 0xB5, 0xD2, 0x00, 0x58, 0x14, 0x1E, 0xA4, 0xD0,
+    0x3E, 0xDF, 0x9A, 0x35, 0x20, 0x4F, 0xF7, 0x76, 0xFD, 0xAB, 0xF5, 0x69, 0xC4, 0xF5, 0xC6, 0x4A,
+    0x62, 0x14, 0x1E, 0xF3, 0x84, 0xF2, 0xA4, 0xC7, 0xA8, 0xD6, 0x79, 0x15, 0x01, 0x26, 0x35, 0x87,
+    0xA3, 0xE8, 0x0A, 0x17, 0x30, 0x7F, 0xC6, 0xBB, 0xDE, 0x17, 0x3C, 0x77, 0x9C, 0x24, 0x5D, 0xC6,
+    0xC2, 0x55, 0xDB, 0x28, 0xE0, 0xBE, 0x33, 0x1C, 0xCD, 0xB9, 0xD0, 0xE2, 0xE4, 0xE5, 0xF1, 0x02,
+    0x86, 0x33, 0x6D, 0x73, 0xAD, 0xCD, 0xC0, 0x58, 0xFD, 0x3A, 0x95, 0x5B, 0x39, 0xDF, 0x39, 0x50,
+    0x4B, 0x55, 0x6C, 0xE8, 0xC8, 0x0C, 0x75, 0xDF, 0xBC, 0x83, 0x94, 0x43, 0xD1, 0xB6, 0x10, 0x3E,
+    0x7B, 0x51, 0x83, 0x5A, 0xD1, 0x29, 0x51, 0x31, 0xB9, 0x85, 0x55, 0xF1, 0x26, 0x12, 0xA7, 0x84,
+    0x89, 0x9A, 0x92, 0x22, 0xF8, 0x27, 0xAE, 0x78, 0x9D, 0x54, 0x54, 0x0C, 0xCC, 0x15, 0xDE, 0x10,
+    0x05, 0x52, 0x87, 0x28, 0xBC, 0x86, 0x3D, 0x49, 0x87, 0x02, 0x79, 0x24, 0x16, 0x5F, 0xA5, 0x7E,
+    0x2C, 0xBE, 0xCE, 0xFC, 0xF0, 0xCC, 0x57, 0x0F, 0x23, 0xD4, 0x75, 0x51, 0xB9, 0xDB, 0x2E, 0x6D,
+    0x16, 0xE3, 0x4D, 0x32, 0x8B, 0x4C, 0x53, 0x37, 0xAF, 0xC6, 0x10, 0x04, 0xCB, 0xB5, 0x4D, 0xE4,
+    0xB1, 0x85, 0x1A, 0xAB, 0xAD, 0xC6, 0x2C, 0xDC, 0x27, 0x74, 0x43, 0xC1, 0xFD, 0x06, 0x39, 0xB0,
+    0x81, 0x49, 0xA1, 0x41, 0x65, 0x89, 0xD3, 0x50, 0xF4, 0xB9, 0x0E, 0xBD, 0x32, 0x51, 0x3B, 0x41,
+    0xB6, 0x6C, 0xD7, 0x5A, 0xA8, 0x56, 0xD8, 0xBB, 0xF7, 0x05, 0x27, 0xA7, 0x2C, 0x28, 0xC7, 0xB9,
+    0x83, 0x20, 0x11, 0xAE, 0xEC, 0x0B, 0x4E, 0xA7, 0x7C, 0x0A, 0x85, 0xC6, 0x2D, 0x92, 0xCB, 0x25,
+    0x1D, 0x9A, 0xC8, 0xF6, 0x8C, 0xD3, 0x89, 0xD7, 0x48, 0x7C, 0x5C, 0x92, 0xB8, 0x53, 0x90, 0x15,
+    0xF6, 0xF7, 0xCE, 0xE3, 0x58, 0xBB, 0x57, 0x62, 0xDD, 0x49, 0xC9, 0x52, 0xE0, 0xEF, 0x7E, 0x3A,
+    0x48, 0xDD, 0x7B, 0xC3, 0x6B, 0xAD, 0x86, 0xAB, 0xA1, 0xA7, 0xB7, 0x74, 0x1E, 0x5C, 0xD6, 0x57,
+    0x2A, 0x7F, 0x41, 0x5B, 0xF5, 0xB8, 0x19, 0xCD, 0x2F, 0x4C, 0xA0, 0xEA, 0xD7, 0xC1, 0x7D, 0xBD,
+    0xFA, 0x47, 0xC6, 0x81, 0x6E, 0x44, 0x0F, 0x6D, 0x69, 0x1A, 0x4B, 0x10, 0x42, 0x66, 0xA3, 0x2F,
+    0xDE, 0xF9, 0xA6, 0xF2, 0x6A, 0x57, 0x0F, 0xFC, 0x69, 0x35, 0x16, 0xBA, 0xF4, 0x37, 0x79, 0x97,
+    0x2F, 0xA1, 0x22, 0x31, 0xB1, 0xA6, 0x3D, 0x71, 0x1D, 0x85, 0x63, 0x81, 0x3A, 0xE6, 0x7D, 0x53,
+    0xD9, 0xDA, 0xEC, 0x50, 0xC0, 0x1B, 0x51, 0x81, 0xB8, 0xBC, 0x3B, 0x67, 0x35, 0x83, 0x02, 0x08,
+    0xEC, 0x54, 0x83, 0x72, 0x40, 0x0C, 0xE2, 0xC3, 0x59, 0x0C, 0xD3, 0x05, 0xF9, 0x1F, 0xA0, 0x82,
+    0x8A, 0xC1, 0xFA, 0x70, 0x5F, 0x09, 0xAB, 0x11, 0xBD, 0xBA, 0x6A, 0xA2, 0x59, 0x62, 0x2C, 0xC2,
+    0x42, 0x46, 0x9A, 0x44, 0x36, 0xDF, 0xC0, 0x2A, 0xAF, 0xD8, 0x9D, 0xE3, 0xD9, 0xFC, 0xBC, 0xD0,
+    0x6C, 0x89, 0xED, 0x0B, 0x4E, 0x9E, 0x86, 0x6F, 0x99, 0xDF, 0x5E, 0x70, 0xEE, 0x98, 0x4A, 0xB9,
+    0x6D, 0x2A, 0x7B, 0xE4, 0x11, 0xB9, 0x18, 0xD1, 0x82, 0x37, 0x94, 0x8D, 0xCC, 0xE3, 0x8B, 0xE4,
+    0xD7, 0xE4, 0x20, 0x19, 0x3E, 0xFA, 0x74, 0x75, 0xE8, 0xB7, 0x01, 0x27, 0x0A, 0xB1, 0x34, 0x72,
+    0x8A, 0xC1, 0xC2, 0x68, 0xBA, 0x8F, 0x08, 0xC3, 0x0B, 0x33, 0xF1, 0xE8, 0xD3, 0xAB, 0x07, 0x7B,
+    0x42, 0xD0, 0xB6, 0x18, 0xA9, 0xD6, 0xBF, 0x3F, 0xDD, 0x6F, 0x55, 0xE8, 0x3F, 0x8C, 0x61, 0xF7,
+    0xEA, 0x51, 0x72, 0x9B, 0xC2, 0xAC, 0x33, 0x2D, 0xAC, 0x2E, 0xED, 0x4B, 0x6C, 0x45, 0x28, 0x2F,
+    0x74, 0x42, 0x72, 0x4B, 0xC7, 0x28, 0x16, 0x14, 0xD7, 0x31, 0x09, 0xF4, 0x02, 0xEE, 0xB6, 0x1B,
+    0xDF, 0x47, 0xE6, 0x03, 0x40, 0x44, 0xF2, 0x13, 0x20, 0x1D, 0x1A, 0x72, 0x1B, 0x64, 0x5E, 0x84,
+    0x83, 0xE8, 0x2D, 0x45, 0xF6, 0x3F, 0x20, 0x9B, 0x15, 0xBF, 0x39, 0xE8, 0x9F, 0xEE, 0x9F, 0xC5,
+    0xC3, 0xFF, 0x80, 0xB4, 0x6C, 0x96, 0x61, 0x01, 0x88, 0xEA, 0xC8, 0x1C, 0x46, 0x11, 0x8F, 0x05,
+    0x5E, 0x2D, 0x58, 0x55, 0x42, 0x3F, 0x32, 0xDE, 0xD2, 0x59, 0x04, 0x6E, 0xF8, 0x32, 0x73, 0x08,
+    0xCE, 0xC2, 0xEF, 0xF2, 0x1D, 0xEC, 0xE6, 0xFB, 0x7E, 0xBD, 0xDB, 0x38, 0x87, 0xB1, 0xF1, 0x2E,
+    0x48, 0x86, 0xBD, 0x7D, 0xC1, 0x69, 0x23, 0x36, 0x0A, 0xBD, 0x81, 0xD8, 0x58, 0xD1, 0x21, 0x3B,
+    0xDB, 0x33, 0x4E, 0x5B, 0xAD, 0x93, 0xB8, 0x8B, 0x1C, 0x76, 0x77, 0xD4, 0xE0, 0xF7, 0xC0, 0xE3,
+    0x98, 0xD9, 0xD0, 0x86, 0x16, 0x4F, 0x0C, 0x95, 0xD0, 0x6E, 0x86, 0xB7, 0xBF, 0x29, 0xF3, 0xE8,
+    0x94, 0xB9, 0x40, 0xE1, 0x41, 0x67, 0xDF, 0x31, 0x9F, 0x6C, 0x5A, 0x4A, 0x3A, 0x8C, 0x16, 0xB4,
+    0x4A, 0x9C, 0x44, 0x69, 0x81, 0x9E, 0x59, 0xB4, 0x1E, 0x2C, 0x63, 0x0D, 0x94, 0x32, 0x50, 0x52,
+    0x2D, 0x25, 0x09, 0x4A, 0x73, 0xDB, 0xEA, 0x30, 0x6B, 0xFC, 0xC4, 0xD4, 0x91, 0xF1, 0xE8, 0xA2,
+    0x65, 0xBA, 0x0F, 0x67, 0x89, 0xF2, 0x28, 0xC7, 0xCC, 0xB2, 0x51, 0xE4, 0xE2, 0xB1, 0xA0, 0xC0,
+    0x38, 0xB7, 0xF2, 0x90, 0xD9, 0xF5, 0xD6, 0x43, 0x4C, 0xDC, 0x5F, 0xF4, 0xAE, 0xBA, 0x85, 0xB7,
+    0x29, 0xA8, 0x1E, 0x2E, 0xCD, 0xDC, 0xF8, 0x49, 0x11, 0x6A, 0x2B, 0x52, 0x36, 0xC5, 0x5B, 0xBC,
+    0x17, 0x9F, 0x0D, 0xA3, 0xEF, 0x7E, 0x12, 0x5A, 0x39, 0xCE, 0xE5, 0x57, 0x30, 0x04, 0x4F, 0x8F,
+    0x3D, 0x21, 0x61, 0x38, 0x9B, 0x70, 0xD1, 0xC1, 0xEB, 0xE7, 0xC1, 0xD7, 0xB8, 0xA5, 0xC5, 0xE9,
+    0xBE, 0xAE, 0x82, 0xC2, 0xCF, 0x5D, 0x25, 0x33, 0x37, 0x16, 0xE6, 0x0B, 0x19, 0x97, 0x8D, 0xB3,
+    0x70, 0x40, 0x4C, 0x6C, 0x83, 0xCA, 0x24, 0x39, 0x0F, 0xBB, 0xE1, 0x7D, 0x1B, 0xCE, 0x16, 0x29,
+    0x7F, 0xF8, 0x40, 0x83, 0xC6, 0xBD, 0x76, 0x7B, 0x8A, 0x33, 0x53, 0x00, 0x7B, 0x7B, 0x3E, 0x6C,
+    0x87, 0x79, 0x79, 0xFB, 0x35, 0x6F, 0xA7, 0xBD, 0x41, 0xE2, 0x81, 0x56, 0xA2, 0x39, 0x93, 0x0B,
+    0x54, 0x74, 0xA2, 0x70, 0x10, 0x14, 0x9C, 0x4A, 0xE4, 0x23, 0x8D, 0xEF, 0x4B, 0xF4, 0xE3, 0x4A,
+    0xE8, 0x1B, 0x99, 0xF8, 0x52, 0x83, 0x97, 0xA9, 0x1D, 0x1C, 0xC0, 0x8F, 0x58, 0xDA, 0x06, 0xD3,
+    0xB5, 0x0E, 0x59, 0x65, 0x44, 0xFC, 0xC5, 0x8D, 0xFA, 0x53, 0x4F, 0x44, 0x8E, 0xFF, 0x02, 0xBD,
+    0x5A, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0xED, 0x10, 0x01, 0x01, 0x31, 0x43, 0x8D, 0xA6,
+    0x51, 0x6D, 0x2E, 0x19, 0x82, 0xC0, 0x36, 0xC7, 0x7A, 0x90, 0x4D, 0xDA, 0x1E, 0x32, 0x5A, 0x83,
+    0xDD, 0x0E, 0x19, 0x9C, 0xB5, 0xC9, 0xA0, 0x0E, 0x1E, 0x54, 0xC0, 0x0E, 0x59, 0xA4, 0x40, 0x87,
+    0x0E, 0xF1, 0x92, 0x74, 0xC8, 0xD0, 0x0C, 0x1D, 0x0A, 0x65, 0xB0, 0x07, 0x0D, 0x29, 0xE0, 0x98,
+    0x8C, 0x3D, 0x64, 0xE8, 0x10, 0x26, 0x01, 0xDA, 0xA9, 0x00, 0x81, 0xA8, 0x2E, 0xA0, 0xA1, 0x21,
+    0x52, 0x0A, 0x66, 0x1C, 0x92, 0xB7, 0xDF, 0x77, 0x2F, 0xF9, 0xF4, 0x13, 0x4B, 0xB1, 0xA4, 0xF7,
+    0xF4, 0xF4, 0xEE, 0x11, 0x1F, 0x7F, 0xEE, 0x3D, 0xE7, 0xDC, 0x7B, 0xCE, 0xF9, 0xCE, 0xB9, 0x14,
+    0xE1, 0x27, 0x50, 0xB9, 0x88, 0x4F, 0xA2, 0x3F, 0x56, 0x07, 0x62, 0x2B, 0x10, 0x87, 0xC4, 0xCD,
+    0x62, 0x5C, 0x8D, 0x70, 0x75, 0x2E, 0x04, 0x39, 0x13, 0x94, 0x22, 0x0B, 0x7E, 0x25, 0xB2, 0xEC,
+    0x81, 0xAC, 0xBA, 0x8D, 0xC8, 0xC6, 0xAF, 0x5A, 0xB1, 0x94, 0xEA, 0xC4, 0x2E, 0xAC, 0x5E, 0x9C,
+    0x5C, 0x94, 0xB8, 0xA9, 0x64, 0xB1, 0x1F, 0x4B, 0x92, 0x2F, 0x15, 0x96, 0x5A, 0x53, 0x8D, 0xAB,
+    0x5A, 0xD1, 0x5D, 0x56, 0xBA, 0xE9, 0x81, 0x56, 0x52, 0x8C, 0xDD, 0x48, 0xF4, 0xA0, 0x95, 0xF0,
+    0x62, 0x27, 0xC7, 0xA5, 0xC7, 0xD9, 0x5E, 0x9E, 0x53, 0xBD, 0x44, 0x8F, 0x7A, 0x74, 0xD0, 0xA3,
+    0x27, 0x34, 0x74, 0x9A, 0x39, 0xBD, 0x24, 0xFF, 0x55, 0x71, 0xD0, 0x64, 0x23, 0x9F, 0xF8, 0x9C,
+    0xB4, 0x0A, 0xF0, 0xF6, 0x01, 0xCE, 0x78, 0x2A, 0x45, 0x87, 0x7F, 0x93, 0xA3, 0x90, 0xC1, 0x97,
+    0x4A, 0xBC, 0x7F, 0x50, 0x0E, 0xF4, 0x75, 0x5F, 0x0E, 0x2F, 0xCB, 0x2C, 0xB9, 0x0D, 0x38, 0xC0,
+    0x4D, 0x92, 0x86, 0x44, 0x0B, 0x90, 0x51, 0xFF, 0x61, 0x79, 0x60, 0x9E, 0x6D, 0x30, 0xE4, 0xA5,
+    0xA6, 0xEF, 0x80, 0xBC, 0x82, 0x7F, 0xB7, 0x1B, 0x54, 0x4F, 0xBE, 0x13, 0x33, 0x92, 0x5D, 0x98,
+    0x53, 0xA1, 0x4A, 0xAD, 0xFE, 0x4E, 0xE5, 0xD6, 0x4E, 0xE3, 0x97, 0x76, 0x13, 0xE6, 0x56, 0xA9,
+    0xEF, 0x42, 0x17, 0xD9, 0x8E, 0x96, 0xE4, 0xA6, 0x87, 0x08, 0x8F, 0x06, 0x95, 0xBC, 0xE8, 0x35,
+    0xF2, 0xB1, 0xAD, 0xB0, 0x60, 0x96, 0x38, 0xC1, 0xE6, 0xE3, 0xD6, 0xE2, 0x17, 0x12, 0xC5, 0xB2,
+    0xAC, 0x7F, 0xAE, 0xA4, 0x9E, 0x6A, 0xC2, 0x07, 0x6D, 0x14, 0xB7, 0x99, 0xD4, 0x99, 0x80, 0xE7,
+    0xE1, 0x8B, 0xE3, 0x24, 0x3E, 0x16, 0xE5, 0x3F, 0x0F, 0x9E, 0xB4, 0xB6, 0x2A, 0xC7, 0xE7, 0xD1,
+    0xA7, 0x04, 0x60, 0xF7, 0x7C, 0x40, 0x6D, 0xA6, 0xB3, 0x60, 0x51, 0xC5, 0xB6, 0xCA, 0xDD, 0x07,
+    0x95, 0x2F, 0xAB, 0x07, 0x62, 0xD1, 0xA9, 0x21, 0x26, 0x34, 0xE8, 0x70, 0xD2, 0xE2, 0x99, 0x68,
+    0x91, 0x5C, 0xC4, 0xA4, 0xC7, 0x0E, 0xA6, 0xC5, 0x8F, 0xB1, 0x02, 0x2E, 0x44, 0x98, 0xFC, 0x56,
+    0xCF, 0xC8, 0x0C, 0x58, 0xF4, 0xE3, 0xDA, 0xF9, 0xBA, 0xB4, 0x60, 0x65, 0xD9, 0xC1, 0x58, 0x94,
+    0xF3, 0x0E, 0xFD, 0xC3, 0x15, 0x74, 0xE8, 0x72, 0x69, 0xDB, 0xED, 0x70, 0x3E, 0x51, 0x7D, 0x2C,
+    0x41, 0x9F, 0xD5, 0xE2, 0xB4, 0x36, 0xEC, 0xA7, 0xC5, 0x5A, 0x07, 0x89, 0x72, 0x92, 0x02, 0x24,
+    0x2C, 0x41, 0x02, 0x4D, 0xAA, 0x91, 0xE8, 0x73, 0x61, 0x31, 0xDE, 0x97, 0x90, 0x28, 0x3C, 0x66,
+    0x77, 0x32, 0xDF, 0xDF, 0xA9, 0x4D, 0xA7, 0xE2, 0xAA, 0x77, 0x2A, 0x98, 0xE6, 0x1F, 0x30, 0x70,
+    0xF4, 0x47, 0x0C, 0x1C, 0xBD, 0x4B, 0x9B, 0x48, 0xC5, 0xFA, 0x2B, 0x88, 0xAF, 0xA0, 0x8A, 0xE8,
+    0x0B, 0x48, 0x98, 0xA4, 0x50, 0x42, 0x46, 0xCD, 0x64, 0xBC, 0xAA, 0xB6, 0x13, 0x7D, 0x2E, 0x89,
+    0x79, 0x73, 0x0E, 0xF1, 0xC3, 0xEF, 0xBF, 0x59, 0x13, 0xAF, 0x0F, 0xDA, 0xFD, 0x71, 0x1F, 0xA9,
+    0x2A, 0xA8, 0x7E, 0xDA, 0x2D, 0xEE, 0x8B, 0x7B, 0x70, 0xCA, 0x09, 0xC0, 0xF8, 0x11, 0x5C, 0xC3,
+    0xAB, 0xD9, 0x1A, 0x8F, 0xED, 0x2E, 0x4A, 0x03, 0x95, 0xA5, 0xE0, 0x26, 0x4D, 0xE2, 0x2C, 0x25,
+    0xE3, 0x64, 0x74, 0x6C, 0xE4, 0x37, 0x03, 0xBB, 0xF8, 0x95, 0x93, 0xD9, 0x4D, 0x5E, 0x35, 0xBB,
+    0x68, 0xFD, 0x70, 0xA8, 0x9A, 0xF9, 0xFE, 0xA3, 0x06, 0x63, 0x2F, 0xA3, 0x9D, 0x1B, 0x9A, 0x4C,
+    0x9A, 0x52, 0xB9, 0xD3, 0x5D, 0x8B, 0xB7, 0x9D, 0x6B, 0xE5, 0x79, 0xB4, 0x53, 0x68, 0x67, 0xE6,
+    0xFB, 0x95, 0x4F, 0x12, 0xBA, 0xBD, 0x1D, 0x91, 0x44, 0xDE, 0x8C, 0x11, 0x01, 0x6A, 0x09, 0x3F,
+    0x85, 0x78, 0x29, 0x3C, 0x15, 0x34, 0xC8, 0x3F, 0xA5, 0x94, 0xA8, 0x95, 0x15, 0x2E, 0x11, 0xBD,
+    0x86, 0x92, 0xD4, 0x82, 0x86, 0xE6, 0xC4, 0xEF, 0x3F, 0x81, 0xBF, 0xAD, 0x37, 0x03, 0xC9, 0x5D,
+    0x2F, 0x96, 0x5B, 0x4B, 0x58, 0xC0, 0xF4, 0x64, 0x6B, 0x53, 0xE7, 0xD5, 0x8B, 0x57, 0xC5, 0x7D,
+    0x54, 0x61, 0x4C, 0x2C, 0x8B, 0xB7, 0xE3, 0xE9, 0xF0, 0xEC, 0x42, 0x76, 0x1F, 0xBF, 0x19, 0x14,
+    0x06, 0x1F, 0x31, 0x4D, 0x9E, 0xB5, 0x13, 0xD7, 0x96, 0x1A, 0x8F, 0x3E, 0xE2, 0x50, 0x3C, 0x4F,
+    0x8F, 0x37, 0x37, 0x37, 0xA1, 0xE7, 0xC2, 0xD0, 0xC2, 0x56, 0xFB, 0xF4, 0x67, 0xE6, 0x4D, 0x0C,
+    0x6F, 0x4F, 0x3A, 0xC3, 0x1B, 0x23, 0xD9, 0x59, 0x3A, 0x0B, 0xB4, 0x5B, 0x34, 0x56, 0xF8, 0x5C,
+    0x6F, 0xD0, 0x73, 0x8D, 0x80, 0x7A, 0x01, 0x63, 0x70, 0x39, 0x7B, 0xD5, 0xD4, 0x75, 0x0C, 0x0F,
+    0x27, 0x70, 0x71, 0x42, 0x1F, 0x37, 0x38, 0xB9, 0xC3, 0xAF, 0x0B, 0x71, 0xD8, 0xB7, 0xC7, 0xFB,
+    0x02, 0x0F, 0xFD, 0x2E, 0x58, 0x43, 0x18, 0x96, 0x79, 0xBA, 0x46, 0xF5, 0x51, 0x27, 0x80, 0x10,
+    0x4A, 0x80, 0x28, 0x12, 0x78, 0x04, 0x44, 0x51, 0xFA, 0x61, 0xED, 0x90, 0xF5, 0x7C, 0x8F, 0xE4,
+    0xF8, 0x35, 0x58, 0x7A, 0xA0, 0x8A, 0x24, 0x07, 0x34, 0x89, 0x08, 0x31, 0xE0, 0xAB, 0x15, 0x9D,
+    0xB5, 0xA2, 0xBA, 0x15, 0xB8, 0x7E, 0xBF, 0xA7, 0xCF, 0x5F, 0xDB, 0x32, 0x76, 0x46, 0xFF, 0x51,
+    0x88, 0xF3, 0x05, 0x20, 0x52, 0xCC, 0xF8, 0x6C, 0xC5, 0xB2, 0x72, 0xA5, 0xF2, 0x54, 0x5F, 0x05,
+    0x79, 0x1B, 0x87, 0x10, 0x28, 0x4A, 0xEF, 0xEB, 0x16, 0xE6, 0x9D, 0xF8, 0x5F, 0xB6, 0x42, 0x87,
+    0xED, 0xFE, 0x9E, 0xB0, 0x0A, 0x0C, 0xAF, 0xFF, 0x05, 0x4E, 0x52, 0xC5, 0x2E, 0x94, 0x18, 0xBD,
+    0x97, 0xE4, 0xAD, 0xF8, 0xBA, 0x75, 0x12, 0xC6, 0xD1, 0x3A, 0xA1, 0xC9, 0xED, 0x61, 0xA0, 0xD3,
+    0x36, 0x57, 0xC1, 0xEB, 0x1A, 0xB9, 0x62, 0x81, 0x5A, 0x8D, 0x1C, 0x99, 0x90, 0x5E, 0x7C, 0x43,
+    0x9C, 0x6D, 0xD6, 0x3C, 0x2B, 0x21, 0x75, 0xC0, 0xD2, 0xD3, 0x69, 0x42, 0xD7, 0x0B, 0x47, 0x27,
+    0xE4, 0x0F, 0xCD, 0x7F, 0x56, 0x42, 0xCE, 0x5A, 0x96, 0xAB, 0x54, 0x1F, 0x6D, 0xD7, 0x21, 0x30,
+    0x70, 0xD8, 0xA1, 0x3D, 0x31, 0x95, 0xDC, 0xD8, 0x3F, 0xCC, 0x5C, 0xC2, 0x59, 0x0A, 0x49, 0xAC,
+    0x85, 0x47, 0x31, 0x9C, 0xFB, 0x25, 0xFD, 0xB6, 0xDC, 0x18, 0x83, 0xE3, 0xA7, 0xAA, 0x0F, 0xD4,
+    0xC5, 0xEC, 0xBB, 0x6D, 0x31, 0xFA, 0x87, 0x04, 0xE6, 0x5F, 0xC0, 0xAD, 0x2C, 0x15, 0xBB, 0xDF,
+    0x42, 0x32, 0xDF, 0xC7, 0xC9, 0x46, 0xA2, 0x1E, 0x28, 0x65, 0x32, 0x0B, 0x93, 0x54, 0x50, 0x42,
+    0x22, 0x92, 0x93, 0x52, 0x8D, 0x76, 0x4A, 0x87, 0x11, 0x90, 0x78, 0x3B, 0xC9, 0x9B, 0x20, 0x8F,
+    0xB1, 0xB4, 0xBD, 0x7E, 0x09, 0x46, 0xDC, 0x62, 0x42, 0xBC, 0x06, 0x97, 0xBC, 0xFA, 0x47, 0x49,
+    0xD0, 0x79, 0x9D, 0x64, 0x0A, 0xAE, 0x47, 0x8B, 0x25, 0x5A, 0x2E, 0xD1, 0x82, 0x69, 0x5A, 0xD0,
+    0x79, 0x82, 0xB3, 0xB7, 0xFA, 0x95, 0x6C, 0x7D, 0x38, 0x33, 0x50, 0x8A, 0x27, 0x5A, 0xBE, 0xED,
+    0xE7, 0x77, 0xA1, 0x5A, 0x4C, 0x31, 0x72, 0xEE, 0x10, 0x25, 0x23, 0x26, 0x58, 0x7A, 0xF2, 0xE1,
+    0x44, 0x9E, 0xFB, 0xF1, 0x28, 0x4F, 0x38, 0xCA, 0xB3, 0x1F, 0x51, 0x18, 0x60, 0xF2, 0x0F, 0x93,
+    0x27, 0xE5, 0x86, 0xCA, 0x6F, 0x9F, 0x35, 0x73, 0x56, 0x04, 0x84, 0x4E, 0xF2, 0x8C, 0x5F, 0x32,
+    0x4B, 0x57, 0x21, 0x41, 0xF1, 0x9B, 0xA8, 0xAF, 0x7E, 0xAB, 0x8A, 0x37, 0x98, 0x35, 0xC9, 0xF1,
+    0xAB, 0xC4, 0x1B, 0x30, 0x6F, 0x7B, 0xF7, 0xAF, 0xAB, 0xE2, 0x50, 0x3F, 0x0B, 0x68, 0x1D, 0x6A,
+    0x64, 0x7C, 0xE0, 0xD1, 0xB3, 0x9E, 0x5F, 0x7C, 0x4E, 0x2C, 0x52, 0x67, 0x3E, 0x25, 0xDD, 0xF5,
+    0x1B, 0x50, 0x7A, 0x32, 0xB9, 0xE0, 0xE4, 0xE1, 0xF5, 0xD4, 0x57, 0x62, 0x37, 0x87, 0x92, 0xFD,
+    0xAE, 0x47, 0x80, 0x15, 0x41, 0xA2, 0x72, 0x7F, 0x3C, 0x1C, 0x70, 0xC4, 0x55, 0x9A, 0x3B, 0x90,
+    0x82, 0xCB, 0xC5, 0x15, 0x5B, 0x5A, 0x16, 0x20, 0x26, 0x8E, 0x58, 0x0D, 0x70, 0xE9, 0xD9, 0x79,
+    0xB0, 0x4A, 0x41, 0x24, 0x85, 0x93, 0xF0, 0x81, 0xE1, 0x7B, 0xCE, 0x8B, 0xE8, 0xDC, 0xCC, 0x8C,
+    0x28, 0x8B, 0x07, 0xD7, 0xCC, 0x7E, 0xF4, 0xF0, 0x95, 0xEA, 0x68, 0x51, 0xF5, 0x04, 0xEB, 0x1F,
+    0x8A, 0x60, 0xFC, 0x28, 0x07, 0x07, 0xDA, 0xCD, 0x6E, 0x21, 0x5C, 0x63, 0x5C, 0xF5, 0x1E, 0x85,
+    0x0C, 0xCA, 0x01, 0x6A, 0xDA, 0xAD, 0x8F, 0x71, 0x3D, 0xFC, 0x87, 0xEE, 0x16, 0x8D, 0xF6, 0x4E,
+    0x5C, 0xCD, 0xEA, 0xD0, 0x9C, 0xAF, 0xED, 0x1F, 0x6D, 0x41, 0x67, 0xB7, 0x99, 0xBA, 0xD4, 0x9A,
+    0x58, 0x36, 0x22, 0x23, 0x66, 0x8E, 0x4B, 0x18, 0xE4, 0xBE, 0x9E, 0x11, 0x45, 0x17, 0xE9, 0x3D,
+    0x2C, 0xE7, 0x74, 0xDA, 0xEC, 0xAB, 0xFA, 0x39, 0x55, 0x6C, 0x66, 0x79, 0xFB, 0xF9, 0x5A, 0x3A,
+    0x2F, 0x0A, 0x6B, 0x13, 0x36, 0x78, 0x8C, 0x79, 0x0B, 0xFD, 0x74, 0x99, 0xB0, 0xE1, 0x99, 0x2C,
+    0x6F, 0xF3, 0xAB, 0xA7, 0x0B, 0xC1, 0x09, 0xEE, 0x10, 0x6C, 0x72, 0x1E, 0xCA, 0xF9, 0xFE, 0x92,
+    0xBA, 0x8D, 0xB3, 0x1D, 0x2F, 0x21, 0x0F, 0x69, 0x1D, 0x7A, 0x26, 0x2C, 0x10, 0xA7, 0x3D, 0xCF,
+    0xD1, 0xEE, 0x81, 0xF4, 0xBD, 0x06, 0x83, 0x0C, 0xE0, 0x59, 0x8E, 0x73, 0x11, 0x6F, 0x09, 0x78,
+    0xB3, 0xCF, 0x95, 0xE3, 0xF2, 0x59, 0xC4, 0x30, 0xCC, 0x03, 0xA2, 0x99, 0x2A, 0xC2, 0x11, 0xC2,
+    0x9D, 0x90, 0x01, 0x88, 0xCA, 0xC7, 0x24, 0xDA, 0x63, 0xA7, 0xC6, 0x63, 0xD3, 0xCB, 0x79, 0xDB,
+    0xDA, 0x89, 0xAB, 0x5E, 0x9D, 0x40, 0xBF, 0x7E, 0xE1, 0xD5, 0x21, 0x7E, 0xDF, 0x14, 0x6F, 0x03,
+    0x8B, 0xE6, 0x71, 0x03, 0x00, 0xD8, 0x61, 0x0E, 0x11, 0x14, 0xEB, 0x2C, 0xF5, 0xEA, 0x08, 0xD7,
+    0x83, 0x8A, 0x5E, 0x2D, 0x53, 0x17, 0x87, 0xD8, 0x80, 0x69, 0x74, 0xD0, 0x3B, 0x73, 0x64, 0x56,
+    0x41, 0x9E, 0x1B, 0xE7, 0x34, 0xC1, 0x9C, 0x6E, 0xED, 0x0F, 0x0E, 0xF3, 0x31, 0xFA, 0x54, 0x2D,
+    0x5C, 0x68, 0x8F, 0x73, 0x2A, 0xC6, 0x98, 0x39, 0xAE, 0xA3, 0x3F, 0x1F, 0xFD, 0x5D, 0x32, 0xFD,
+    0xD1, 0xAE, 0x02, 0x66, 0xF4, 0x38, 0x5E, 0x1D, 0xA3, 0x5B, 0x81, 0x44, 0x35, 0x96, 0x1D, 0x58,
+    0x78, 0xAF, 0x46, 0x9C, 0x3C, 0x87, 0x76, 0x72, 0xC0, 0xCA, 0xDD, 0x88, 0x95, 0xB1, 0x30, 0x7B,
+    0xB1, 0x6A, 0x13, 0xC0, 0xA9, 0x8D, 0x60, 0x4F, 0xA3, 0xD9, 0xC3, 0x9D, 0x4C, 0x8D, 0x25, 0xA3,
+    0xC2, 0xD2, 0x64, 0x24, 0xC8, 0x20, 0xE5, 0xF8, 0x21, 0x18, 0x33, 0xDD, 0x19, 0xA7, 0x85, 0x85,
+    0xF4, 0xBC, 0xD6, 0xDE, 0x3D, 0xB0, 0x8A, 0x4C, 0xC3, 0x42, 0x06, 0x6F, 0x17, 0x07, 0x65, 0x35,
+    0xAB, 0x6F, 0x05, 0xF5, 0x3D, 0xAF, 0xAE, 0xBD, 0x8D, 0x72, 0x8A, 0xBA, 0xDA, 0xFA, 0x27, 0x8B,
+    0x7B, 0x33, 0xF0, 0xB4, 0xA5, 0xBB, 0xB3, 0x65, 0xC3, 0xD2, 0xE2, 0xFF, 0x9F, 0xFC, 0xE0, 0x3A,
+    0x0B, 0x76, 0xD4, 0xD2, 0xD3, 0x79, 0x7A, 0x11, 0x0D, 0x46, 0x45, 0x0C, 0xD1, 0x9B, 0xCA, 0x19,
+    0x93, 0xC2, 0x5F, 0xEC, 0xCD, 0xD3, 0xD3, 0xE7, 0x09, 0x2C, 0x70, 0x91, 0x4B, 0x54, 0x4B, 0xB2,
+    0xCB, 0x3C, 0x0D, 0xDE, 0x1F, 0x1E, 0x8A, 0xEE, 0x31, 0xE4, 0xA9, 0x73, 0x23, 0x6A, 0xC6, 0x83,
+    0xDD, 0x3C, 0xBC, 0x7B, 0xED, 0x28, 0x2C, 0x55, 0x40, 0x2F, 0x92, 0x02, 0xE4, 0xF3, 0x0A, 0xE4,
+    0xB3, 0x16, 0xE4, 0x61, 0x07, 0x92, 0x2B, 0x92, 0xE4, 0x21, 0x48, 0xF8, 0x35, 0x88, 0xFF, 0x38,
+    0xE7, 0x9D, 0x20, 0x36, 0x89, 0x68, 0x02, 0x2F, 0xBD, 0x06, 0x9B, 0x4A, 0x5A, 0x86, 0x9F, 0xA1,
+    0xBC, 0x9A, 0xEA, 0x1A, 0xAD, 0xD0, 0x14, 0x06, 0x34, 0x6B, 0xBC, 0x31, 0x60, 0x5B, 0xF2, 0x3F,
+    0x28, 0xC0, 0x3F, 0x0C, 0x6C, 0x9B, 0x35, 0xF7, 0x9B, 0xBE, 0xED, 0xDE, 0xC4, 0xB7, 0xDD, 0x9E,
+    0x16, 0xF7, 0x32, 0xB1, 0x49, 0x03, 0xF5, 0x69, 0x95, 0xDA, 0x2C, 0x69, 0x97, 0x63, 0x4D, 0x31,
+    0x85, 0x53, 0x65, 0xCA, 0x8D, 0x20, 0xA1, 0xF3, 0x8B, 0xF8, 0x68, 0xE6, 0x8D, 0xD5, 0x52, 0x5D,
+    0x2E, 0xD5, 0xF5, 0xD2, 0x49, 0xC1, 0x74, 0x4A, 0x92, 0x9F, 0xDD, 0x5C, 0x1A, 0x26, 0x8A, 0x6B,
+    0x47, 0x8C, 0x61, 0xDE, 0xBB, 0xFA, 0x2A, 0x40, 0x4B, 0xD8, 0x01, 0x13, 0xDF, 0x74, 0xD4, 0x9F,
+    0x1B, 0xD8, 0x69, 0x3F, 0x5A, 0xEF, 0x7E, 0xE8, 0x7C, 0x7F, 0x19, 0x36, 0x17, 0xA9, 0x87, 0x2A,
+    0x35, 0x9A, 0xEA, 0xF6, 0xD4, 0xD4, 0x83, 0x5E, 0x6B, 0xEA, 0x32, 0x48, 0x44, 0x4D, 0x05, 0xD4,
+    0x94, 0x37, 0xD1, 0x94, 0xA5, 0x95, 0x94, 0x4D, 0x34, 0xE5, 0x53, 0x53, 0x7A, 0xB6, 0x9C, 0xED,
+    0xC4, 0x4B, 0x87, 0x44, 0x54, 0x1A, 0xAD, 0x29, 0x2A, 0x8A, 0x7A, 0xA2, 0x9A, 0xA8, 0xA5, 0xBD,
+    0xFE, 0xA0, 0x9D, 0x1A, 0xCA, 0x19, 0x5D, 0x08, 0x93, 0xAE, 0xCA, 0x58, 0x2C, 0x77, 0x5D, 0x26,
+    0xBB, 0x15, 0x34, 0xE8, 0x70, 0x62, 0xD5, 0x3C, 0xB2, 0xFB, 0x3B, 0x4C, 0x11, 0x6C, 0x96, 0x50,
+    0x45, 0xE7, 0x98, 0x09, 0x90, 0x12, 0xFE, 0xEB, 0x72, 0x6C, 0x36, 0x92, 0x62, 0x42, 0xCC, 0x05,
+    0x7D, 0x8B, 0xBE, 0x59, 0x3F, 0xE6, 0x55, 0x16, 0xA0, 0x43, 0xFF, 0x3A, 0xF1, 0xCD, 0x66, 0xD1,
+    0x7D, 0x67, 0xD9, 0x32, 0x85, 0xBF, 0x69, 0x90, 0x5F, 0xB0, 0x88, 0x1A, 0xC5, 0x1C, 0x27, 0x63,
+    0xC9, 0x57, 0x9F, 0xD1, 0x67, 0xF5, 0x6F, 0x9C, 0x4F, 0xA3, 0x34, 0x11, 0xFF, 0x51, 0xB7, 0xA3,
+    0xD4, 0x73, 0xCE, 0xE1, 0xB2, 0xBA, 0x0E, 0xF6, 0x03, 0x5D, 0xE0, 0x9E, 0x5C, 0x9B, 0xBD, 0x20,
+    0x6E, 0xBC, 0xAC, 0xAB, 0x20, 0x16, 0xD3, 0xF7, 0xA5, 0x78, 0x4A, 0x02, 0xB9, 0xDF, 0xC2, 0xAF,
+    0xFA, 0x0F, 0xD1, 0x25, 0xC0, 0x1A, 0xB2, 0x8F, 0x53, 0x47, 0x27, 0x90, 0xDC, 0x8F, 0x62, 0x69,
+    0xDE, 0x06, 0x26, 0x6A, 0xC4, 0xFD, 0x5D, 0x31, 0x25, 0x81, 0xC0, 0xB8, 0x52, 0x0D, 0x38, 0xEF,
+    0x57, 0x00, 0xD3, 0x60, 0x4B, 0x37, 0xF5, 0xB6, 0xC2, 0x82, 0x46, 0xE1, 0xAF, 0x68, 0x2A, 0x49,
+    0x4A, 0x9A, 0x8D, 0x54, 0x29, 0x88, 0xC1, 0x12, 0xA2, 0x39, 0x63, 0xAE, 0x9A, 0x3B, 0x35, 0x7D,
+    0x5E, 0xF7, 0x30, 0xE7, 0xB1, 0xAC, 0x7F, 0x16, 0x82, 0xF4, 0x2B, 0xF7, 0x21, 0x89, 0x52, 0xFD,
+    0xA4, 0x80, 0xF8, 0xD2, 0x6D, 0x96, 0x10, 0x01, 0x52, 0xC0, 0x61, 0xAD, 0x79, 0x2B, 0xC1, 0x67,
+    0x1C, 0x15, 0x21, 0xB9, 0x2D, 0xC2, 0x42, 0x91, 0x2D, 0xD2, 0xF5, 0x95, 0x54, 0x2B, 0x92, 0x5B,
+    0x0E, 0x05, 0xDD, 0x61, 0x54, 0x0A, 0xEE, 0x4F, 0x6A, 0x78, 0xB6, 0x47, 0xBD, 0xBA, 0x13, 0xDB,
+    0xAA, 0x4C, 0x3A, 0xD9, 0xF6, 0x99, 0x84, 0x20, 0xBD, 0xDC, 0x9C, 0xF4, 0x29, 0x9B, 0x2A, 0x3A,
+    0xC5, 0xD1, 0x7B, 0x13, 0x96, 0x1A, 0x89, 0xFE, 0xA9, 0x2F, 0x20, 0xF0, 0x42, 0xC8, 0x14, 0xC0,
+    0x38, 0x21, 0x30, 0xD6, 0x59, 0xBD, 0x4F, 0x60, 0xEC, 0x11, 0x18, 0x3B, 0xDB, 0x81, 0x71, 0x1E,
+    0x56, 0xE3, 0xAE, 0x1F, 0xB7, 0xFD, 0x74, 0xB8, 0x5D, 0x1E, 0x9D, 0xE7, 0xAF, 0xE9, 0x12, 0x62,
+    0xFF, 0x7B, 0x40, 0xDC, 0x36, 0x8C, 0xBD, 0xE6, 0x67, 0x7B, 0x62, 0x8C, 0xA0, 0x8B, 0xE1, 0x2F,
+    0xF3, 0x59, 0x73, 0xBA, 0x6B, 0xC9, 0xE9, 0xA0, 0xFC, 0x6E, 0x43, 0xEB, 0x43, 0xC5, 0x6A, 0x33,
+    0xA4, 0xB1, 0x46, 0x2D, 0xE7, 0x59, 0x08, 0x0F, 0x1A, 0x99, 0x94, 0xA9, 0x67, 0x3D, 0x1F, 0x6E,
+    0x7A, 0x53, 0xEC, 0x6F, 0x2B, 0x13, 0x46, 0xA3, 0xF8, 0x50, 0xF3, 0x31, 0x54, 0xC8, 0x20, 0x64,
+    0x6B, 0x84, 0xF4, 0x06, 0x77, 0x92, 0xC1, 0x12, 0x37, 0xD0, 0x1F, 0xAC, 0x37, 0x4C, 0x83, 0x34,
+    0x4C, 0xE7, 0x58, 0xFC, 0xD1, 0x72, 0xFA, 0xE4, 0x17, 0x96, 0x89, 0x0E, 0x58, 0xEC, 0xE6, 0x0A,
+    0x2E, 0x8E, 0xC3, 0x2F, 0x5C, 0xC0, 0x22, 0x89, 0xD8, 0xE2, 0x20, 0x0F, 0xFF, 0x9D, 0x89, 0xBB,
+    0xC5, 0x1A, 0x81, 0xD9, 0xE0, 0xFF, 0xB1, 0x80, 0x0C, 0x5A, 0x5B, 0x89, 0x3D, 0x55, 0x85, 0x17,
+    0x9B, 0x48, 0x6A, 0x6E, 0x77, 0x35, 0x7C, 0x11, 0x82, 0xB7, 0x27, 0xED, 0x31, 0xBB, 0x5D, 0x10,
+    0x64, 0x72, 0x6D, 0xF4, 0x7E, 0xED, 0xA9, 0x62, 0x62, 0xCA, 0xA5, 0x06, 0x0A, 0x52, 0xDF, 0x13,
+    0xBB, 0x38, 0x35, 0x13, 0x16, 0x75, 0x06, 0xEC, 0x8E, 0x19, 0xF0, 0xFE, 0x59, 0x9C, 0x16, 0x3B,
+    0x73, 0x62, 0xAC, 0x8D, 0xAB, 0x98, 0xED, 0xAD, 0xD2, 0x54, 0x60, 0x9F, 0x9D, 0xA1, 0x65, 0x1D,
+    0xB9, 0xFD, 0x1C, 0x10, 0xC8, 0xBE, 0x93, 0xDA, 0xC6, 0x39, 0xD9, 0x25, 0xA0, 0x4A, 0x43, 0x47,
+    0xC6, 0x64, 0xB1, 0x98, 0x85, 0x0A, 0xFD, 0xB8, 0x76, 0xFF, 0x59, 0x70, 0x13, 0x33, 0xDB, 0xF7,
+    0x2C, 0x67, 0xAC, 0x4E, 0x66, 0x77, 0x9E, 0x64, 0xB2, 0xEA, 0x57, 0xBE, 0xDC, 0x1D, 0x88, 0x67,
+    0xB0, 0xC3, 0x01, 0xC8, 0x52, 0xC7, 0x1A, 0x2C, 0xA3, 0x8C, 0x76, 0x93, 0x4E, 0x3D, 0x81, 0xBE,
+    0x7C, 0x25, 0xE3, 0xA5, 0x76, 0x2C, 0xB1, 0xBC, 0x41, 0x2C, 0x0C, 0x3D, 0x7B, 0xDF, 0x31, 0xE9,
+    0x9A, 0xDF, 0x88, 0x61, 0xC5, 0x4F, 0xFD, 0xBA, 0xCC, 0x72, 0x4A, 0x6E, 0xB1, 0x9C, 0x7B, 0x9A,
+    0x7E, 0x77, 0xF7, 0x06, 0x33, 0x14, 0x8D, 0x80, 0xFE, 0x9E, 0xBC, 0x51, 0x4B, 0x5D, 0x22, 0x22,
+    0x6C, 0x8A, 0xB0, 0x4B, 0x6E, 0x39, 0x8A, 0x50, 0xEE, 0x83, 0x2B, 0xFB, 0xCE, 0x93, 0xDB, 0x98,
+    0x64, 0x3E, 0xB3, 0x37, 0x57, 0xD7, 0xBF, 0xA3, 0x11, 0x11, 0xCF, 0xED, 0xA2, 0x52, 0x1C, 0xC0,
+    0x87, 0x3D, 0x5D, 0xA5, 0x9B, 0x2F, 0x98, 0x9C, 0x26, 0xA0, 0x42, 0xA6, 0x70, 0x3E, 0x41, 0xA7,
+    0x2F, 0x7B, 0xB7, 0x47, 0x1D, 0x22, 0x9C, 0x2E, 0xF5, 0x71, 0x52, 0x20, 0xC3, 0xF4, 0xF9, 0xE0,
+    0xB3, 0x13, 0x47, 0x93, 0xD6, 0x90, 0x53, 0xC0, 0x1F, 0xDC, 0x6F, 0x54, 0xEB, 0x7C, 0x15, 0x65,
+    0xCB, 0xC8, 0x74, 0xDB, 0x17, 0xB1, 0xCA, 0xD5, 0xF7, 0xB9, 0xD8, 0xFF, 0x81, 0x18, 0x56, 0x7A,
+    0x6B, 0x92, 0x29, 0x9C, 0x58, 0x94, 0xA4, 0x02, 0x43, 0x50, 0x12, 0x19, 0xF7, 0x7E, 0x94, 0xD4,
+    0xB8, 0xCF, 0xD5, 0x25, 0x27, 0xF5, 0x3D, 0xF4, 0xA2, 0xBE, 0x52, 0x5B, 0x07, 0xF2, 0xA8, 0x4D,
+    0x77, 0x7C, 0x5B, 0xE2, 0x48, 0x64, 0xD3, 0xF5, 0xE7, 0xAC, 0x9F, 0x95, 0x44, 0x73, 0x4C, 0x28,
+    0xFD, 0x3F, 0x15, 0x62, 0x5E, 0xCD, 0x1A, 0xDF, 0xCD, 0x3A, 0x1A, 0xD9, 0xB8, 0x68, 0xF5, 0x3B,
+    0x04, 0x12, 0xD1, 0xAC, 0xBD, 0x72, 0x16, 0x52, 0x72, 0x03, 0x50, 0x9B, 0xBA, 0xFB, 0x1A, 0xDF,
+    0xD6, 0xA0, 0x53, 0x71, 0x3E, 0x88, 0x87, 0x37, 0xC8, 0x8E, 0x42, 0x54, 0x2B, 0x1E, 0x37, 0x5B,
+    0x16, 0x16, 0x98, 0x7F, 0x9C, 0xE6, 0xC6, 0xF9, 0xCD, 0xD1, 0xFA, 0x66, 0x32, 0xAB, 0xD2, 0x26,
+    0x84, 0x9A, 0xED, 0xB0, 0x75, 0xE6, 0x5D, 0xCE, 0x8F, 0x70, 0x56, 0xFD, 0xCF, 0x30, 0x64, 0x78,
+    0x25, 0x37, 0x6F, 0x8B, 0xC9, 0xEA, 0xC2, 0xF4, 0xA5, 0x84, 0x77, 0x52, 0x75, 0xA0, 0xE2, 0xA5,
+    0x35, 0x32, 0xC4, 0x1D, 0x04, 0x4F, 0xF6, 0x4B, 0x7C, 0x56, 0xA9, 0x7D, 0x6E, 0xF7, 0x21, 0xBE,
+    0x66, 0xEB, 0xED, 0x28, 0xC7, 0xAD, 0xB1, 0xCA, 0x62, 0xD0, 0xA8, 0x3E, 0xD2, 0xA6, 0x81, 0x1C,
+    0x78, 0x5A, 0x22, 0x70, 0x23, 0x54, 0x16, 0x26, 0xF5, 0xEA, 0xAD, 0x6F, 0x18, 0x6E, 0x51, 0xA4,
+    0x11, 0xD6, 0x0C, 0x2E, 0xEE, 0xC3, 0xD2, 0xD8, 0xEB, 0xEA, 0xE6, 0x75, 0x15, 0xBF, 0x02, 0x24,
+    0x90, 0xF4, 0x72, 0x41, 0x96, 0xD6, 0x7C, 0xC4, 0x67, 0xC0, 0x5C, 0x44, 0x8B, 0x0C, 0x2A, 0xE1,
+    0xC6, 0x70, 0xEA, 0x6B, 0xDC, 0x9A, 0x9F, 0xD2, 0x60, 0xB4, 0x38, 0x23, 0x56, 0xEF, 0x7C, 0x5E,
+    0x62, 0x58, 0xE5, 0xBC, 0x5B, 0xF1, 0x9F, 0xF7, 0x5A, 0x8D, 0x90, 0x98, 0x5D, 0x71, 0xDA, 0x1B,
+    0xD0, 0xE9, 0xBB, 0x4E, 0x7B, 0x17, 0x96, 0xF8, 0x2F, 0xAB, 0xAB, 0x74, 0x2D, 0x90, 0x6E, 0x2E,
+    0x68, 0x81, 0x1E, 0xC0, 0x6F, 0xA3, 0x77, 0x95, 0x21, 0x0A, 0xF3, 0x1E, 0xB7, 0x92, 0x70, 0x33,
+    0x09, 0xF4, 0xF4, 0x26, 0x57, 0xA0, 0xAD, 0x49, 0x4F, 0xF8, 0xE4, 0x05, 0x41, 0x4C, 0xF9, 0x35,
+    0x89, 0x4F, 0x2C, 0x46, 0xEA, 0x52, 0x99, 0xD4, 0x5E, 0xE3, 0x54, 0x5E, 0xEE, 0x34, 0x6E, 0xED,
+    0xC5, 0x84, 0xC9, 0x1E, 0xF4, 0xEF, 0xB7, 0x73, 0xB0, 0xC3, 0x93, 0xDD, 0x49, 0x24, 0x47, 0xA7,
+    0x7B, 0x18, 0x46, 0x76, 0x2E, 0x63, 0x90, 0xBE, 0x11, 0xDD, 0x20, 0xDE, 0x21, 0xE2, 0x89, 0xCA,
+    0x50, 0x17, 0xC9, 0x89, 0xAC, 0xFC, 0xDC, 0x1F, 0x91, 0x2F, 0xEB, 0x95, 0xDC, 0x9F, 0x40, 0x2A,
+    0xCF, 0x8D, 0xC1, 0xE5, 0xB1, 0xAA, 0xA7, 0xD4, 0x65, 0x20, 0xEE, 0xDE, 0xCA, 0x52, 0xE8, 0xE3,
+    0x02, 0x99, 0x5B, 0xE0, 0x64, 0xAF, 0x72, 0x77, 0x83, 0xC8, 0x9B, 0xEF, 0x57, 0x26, 0xEF, 0x10,
+    0x7F, 0xFF, 0x9D, 0x15, 0x80, 0x6F, 0xC4, 0xBC, 0x8A, 0x69, 0xFA, 0xE3, 0x6B, 0xA2, 0x5B, 0x09,
+    0xCF, 0x5D, 0xE7, 0x3B, 0x5E, 0x6A, 0x5C, 0xE1, 0x04, 0x59, 0x8C, 0x6F, 0x80, 0xB3, 0x4E, 0x6E,
+    0xE0, 0xEC, 0xB5, 0xAB, 0x27, 0x16, 0x55, 0x1B, 0xD5, 0x61, 0xE5, 0xE6, 0x7E, 0xE9, 0xA6, 0x98,
+    0x76, 0x44, 0x43, 0xAA, 0xFE, 0x24, 0x24, 0x84, 0x4C, 0x3D, 0x75, 0x7C, 0xC3, 0x3C, 0x17, 0x95,
+    0x06, 0xC3, 0x51, 0x0E, 0x3F, 0x9D, 0xBC, 0x93, 0x43, 0x10, 0x1F, 0xC1, 0x43, 0xBC, 0x4A, 0x57,
+    0x71, 0x86, 0xB9, 0x4A, 0xC4, 0x3B, 0x34, 0x39, 0x66, 0xC9, 0x91, 0x88, 0x66, 0xF5, 0xA6, 0x42,
+    0xEB, 0xE1, 0xF7, 0xA9, 0xD1, 0xCC, 0x54, 0x95, 0xAC, 0x64, 0xD5, 0x4D, 0x24, 0xBA, 0xCB, 0xC0,
+    0xB2, 0x37, 0x60, 0x2C, 0x2F, 0xF0, 0xDD, 0x0A, 0xAF, 0x35, 0xDE, 0x8B, 0xE2, 0x70, 0x61, 0xE8,
+    0x42, 0x83, 0xE9, 0x15, 0xBC, 0x2D, 0x63, 0xC6, 0x96, 0xB1, 0x50, 0x1A, 0xB5, 0xFE, 0x51, 0x0D,
+    0xB4, 0x62, 0x70, 0xA6, 0xDE, 0xBA, 0xAA, 0x8C, 0xD8, 0x67, 0x4C, 0xFF, 0xC7, 0xAF, 0x5D, 0x63,
+    0x52, 0x2D, 0x67, 0x7F, 0xD9, 0xCB, 0x02, 0xAE, 0xBF, 0xAC, 0xF7, 0x43, 0x4A, 0x53, 0x90, 0x53,
+    0xC6, 0x45, 0x3B, 0x8D, 0x8D, 0xA1, 0x9C, 0x38, 0x2C, 0xBC, 0x38, 0x5A, 0xCF, 0xE2, 0x4C, 0x0D,
+    0x95, 0x27, 0x96, 0xA5, 0x82, 0xA1, 0x3C, 0x65, 0xCD, 0x80, 0xDF, 0x70, 0x78, 0xDB, 0x92, 0xFF,
+    0x8F, 0x1F, 0x9E, 0x5F, 0x0D, 0xE3, 0xB9, 0xC9, 0xB5, 0x05, 0xC6, 0x4F, 0x93, 0x5F, 0x27, 0x5F,
+    0x10, 0x6B, 0x03, 0x87, 0x59, 0x39, 0x96, 0x35, 0x0F, 0xC5, 0x6F, 0xD2, 0xDA, 0xDD, 0x7D, 0xA7,
+    0x3E, 0xEF, 0xD6, 0x2C, 0x23, 0x3C, 0xCB, 0x06, 0xC8, 0xF5, 0x2E, 0xC6, 0x62, 0xFA, 0x3F, 0xD5,
+    0x5A, 0xB1, 0x93, 0xD5, 0xE6, 0x11, 0x5F, 0x3D, 0x71, 0x68, 0x6C, 0xCD, 0x9C, 0x9C, 0x19, 0xDF,
+    0x24, 0x9E, 0x33, 0xE8, 0x1F, 0x00, 0x2B, 0x25, 0x05, 0x20, 0x5D, 0x52, 0xB8, 0x70, 0xE1, 0x2B,
+    0x20, 0x2E, 0x52, 0x40, 0xE1, 0x26, 0x6E, 0xAE, 0x71, 0x66, 0xC8, 0xCC, 0x81, 0x64, 0x3B, 0x33,
+    0x2E, 0x52, 0xE4, 0x9A, 0xB8, 0x49, 0xE1, 0x14, 0x29, 0xE2, 0xE7, 0xC2, 0x57, 0x50, 0x5C, 0x01,
+    0x48, 0x40, 0xE1, 0x22, 0x85, 0x85, 0x5D, 0xB8, 0x48, 0xF3, 0x26, 0x60, 0x0A, 0x32, 0x89, 0x45,
+    0x22, 0xC6, 0x0F, 0x23, 0xE9, 0xCB, 0xEF, 0xB7, 0x9F, 0x74, 0xF7, 0x0E, 0x0E, 0x8C, 0x0D, 0x77,
+    0x24, 0x77, 0x4F, 0xBB, 0x7A, 0xEF, 0x49, 0xFA, 0x76, 0xF7, 0xDB, 0x6F, 0xF7, 0xB7, 0xFB, 0x3D,
+    0x91, 0xE1, 0xEF, 0x9C, 0x48, 0x64, 0x92, 0x54, 0x46, 0xDD, 0x27, 0x55, 0x2C, 0x7E, 0x3D, 0x6A,
+    0x02, 0x09, 0x27, 0x62, 0x0E, 0x4B, 0x5C, 0x48, 0x5A, 0x93, 0xF2, 0x24, 0x23, 0xCD, 0x37, 0x69,
+    0x39, 0x43, 0x87, 0x6F, 0x37, 0x5F, 0x69, 0xA2, 0x4F, 0x10, 0xF1, 0x2B, 0xA7, 0x15, 0x3C, 0xF9,
+    0x97, 0x35, 0x06, 0x5A, 0x31, 0x99, 0x6C, 0xFD, 0xBD, 0x89, 0xA3, 0x95, 0xB7, 0xB2, 0xCE, 0x37,
+    0xD3, 0xE3, 0x51, 0x61, 0x0E, 0xC5, 0x59, 0x5C, 0xA7, 0x49, 0x5C, 0xE4, 0x78, 0x82, 0x91, 0xA8,
+    0x3F, 0xEC, 0x7B, 0x7C, 0x9E, 0x81, 0x4A, 0x70, 0xB3, 0x95, 0x91, 0xA9, 0x65, 0xFB, 0x5F, 0x98,
+    0xE5, 0xA6, 0x30, 0x61, 0x71, 0xAA, 0x4B, 0x56, 0x82, 0xC2, 0x6B, 0x24, 0x70, 0x0B, 0x6F, 0x2A,
+    0x81, 0x9F, 0x90, 0x5E, 0x14, 0xD2, 0x35, 0xA5, 0xF2, 0x1D, 0xD4, 0xB5, 0xB4, 0xE9, 0xE9, 0x3C,
+    0x65, 0x97, 0x63, 0x18, 0xC2, 0xDC, 0x9A, 0x72, 0x20, 0x53, 0xCA, 0x7D, 0x2A, 0x48, 0xB3, 0xB0,
+    0xBC, 0xB0, 0xDC, 0xA6, 0x55, 0x5A, 0xAD, 0x06, 0x55, 0x50, 0x1D, 0xF5, 0x2B, 0xFF, 0xF6, 0x3A,
+    0x88, 0xC9, 0x40, 0x2A, 0xD9, 0x91, 0xD4, 0x41, 0x25, 0x5E, 0x13, 0x56, 0xE2, 0x9A, 0x7B, 0x77,
+    0xF1, 0xF0, 0x2F, 0x8C, 0xEC, 0xF0, 0xE7, 0x54, 0x61, 0x7F, 0x76, 0xF6, 0x6C, 0x7F, 0x12, 0x0D,
+    0xAA, 0x07, 0x93, 0xAD, 0xEB, 0x52, 0xD3, 0x25, 0x12, 0x1B, 0x53, 0x85, 0x5D, 0x8E, 0xE9, 0x1A,
+    0xE7, 0x95, 0xDB, 0x40, 0xEC, 0xA3, 0x12, 0x4F, 0xA0, 0x43, 0x9E, 0x9C, 0x91, 0xBC, 0xC0, 0x49,
+    0x5C, 0x9C, 0x11, 0x93, 0xF0, 0xA4, 0x7C, 0xC1, 0xED, 0xA8, 0x5E, 0x34, 0x81, 0x14, 0x3C, 0xC1,
+    0x64, 0x05, 0xB5, 0x9E, 0x54, 0xFC, 0xD0, 0x9E, 0xA4, 0x45, 0x7F, 0x0D, 0xA6, 0x8D, 0x27, 0xE5,
+    0xC8, 0xA8, 0x51, 0xE2, 0xC2, 0x6D, 0xF5, 0x24, 0x2D, 0x82, 0xA9, 0x1C, 0xC1, 0x89, 0x49, 0x70,
+    0xF9, 0x19, 0x0C, 0xDA, 0xD2, 0x23, 0x36, 0x16, 0xBB, 0x4F, 0x6A, 0xC9, 0x6F, 0x7D, 0x3C, 0x55,
+    0xC1, 0x8C, 0x31, 0xD3, 0x6D, 0x6A, 0x05, 0x49, 0xA5, 0x5F, 0x78, 0x5F, 0x96, 0x2A, 0xB0, 0x63,
+    0x32, 0x95, 0x57, 0x72, 0x51, 0x71, 0xA5, 0x1F, 0x65, 0xE1, 0xE4, 0x09, 0x15, 0x36, 0x35, 0xAD,
+    0xCA, 0x71, 0xF1, 0x8D, 0x46, 0x45, 0x5D, 0x0F, 0x2A, 0x15, 0xF0, 0x74, 0x54, 0x5A, 0x41, 0xE3,
+    0xAC, 0x97, 0xB3, 0x17, 0xB3, 0xB5, 0xF7, 0x63, 0x46, 0xAD, 0x90, 0xD5, 0x9C, 0xCA, 0x18, 0x15,
+    0xF3, 0x2A, 0x62, 0x9A, 0x1D, 0x54, 0x09, 0xCD, 0xB8, 0xA3, 0x1C, 0x8E, 0x31, 0xDD, 0x20, 0x9A,
+    0x67, 0xB2, 0x40, 0x2A, 0x4A, 0x04, 0xE1, 0x04, 0x0F, 0x1E, 0xD1, 0x65, 0xE3, 0x4C, 0x78, 0x45,
+    0x4C, 0xEF, 0x75, 0xFE, 0x12, 0x67, 0x10, 0x2C, 0x30, 0x69, 0x06, 0xB9, 0xE2, 0x6B, 0x26, 0x83,
+    0x58, 0x69, 0x96, 0x67, 0x90, 0x2A, 0xC7, 0xA3, 0x4F, 0x87, 0x65, 0xCE, 0x2B, 0xE3, 0xCC, 0x90,
+    0x19, 0x21, 0xC3, 0xA0, 0x64, 0x10, 0x88, 0xDF, 0x41, 0x9E, 0x34, 0x49, 0xB3, 0xA8, 0x9C, 0x87,
+    0x9F, 0x17, 0x90, 0x26, 0xBA, 0xF7, 0xF5, 0x0D, 0x08, 0xE3, 0x77, 0x61, 0xBB, 0x25, 0x4B, 0x0A,
+    0x57, 0x8B, 0xCD, 0x24, 0x84, 0xA1, 0x16, 0xCD, 0x1A, 0x14, 0x10, 0xAB, 0xD7, 0x13, 0xB2, 0xE7,
+    0x2C, 0x9B, 0xB7, 0xEC, 0x80, 0x65, 0x87, 0xC1, 0x16, 0xBB, 0x71, 0x4B, 0xE3, 0x18, 0x43, 0xC6,
+    0xBF, 0xED, 0x8C, 0x8F, 0xC0, 0x9F, 0x6F, 0x1D, 0x30, 0xB5, 0xEE, 0xD7, 0xCD, 0xCE, 0xAB, 0x5B,
+    0x53, 0x66, 0xB8, 0x35, 0x44, 0x76, 0x6B, 0xBD, 0x3E, 0xB1, 0x77, 0x91, 0x2E, 0x70, 0x32, 0x25,
+    0x9E, 0x92, 0xFA, 0x4A, 0xDD, 0x47, 0xD1, 0xE7, 0x94, 0xCE, 0x2B, 0x3D, 0xA0, 0xF4, 0xB0, 0x3B,
+    0xA5, 0x8C, 0xEE, 0x94, 0x22, 0xBA, 0xEA, 0x52, 0x96, 0x7A, 0x96, 0xAA, 0x60, 0x58, 0x57, 0xF8,
+    0xCB, 0x8B, 0x2D, 0xE1, 0x72, 0xC4, 0xB3, 0x10, 0xD2, 0x30, 0xAE, 0x41, 0xF8, 0x65, 0x2A, 0xE0,
+    0xD7, 0x0B, 0x27, 0xFC, 0x3A, 0xC2, 0xFB, 0xE1, 0xF3, 0x47, 0x1F, 0x61, 0x3B, 0x6A, 0x72, 0xF3,
+    0x33, 0x1A, 0xB1, 0xB1, 0xDA, 0xF0, 0xE0, 0x88, 0x2B, 0xB0, 0xC3, 0xA5, 0x84, 0x41, 0xB2, 0x4D,
+    0x4D, 0xB1, 0xD8, 0xC8, 0x62, 0x8D, 0x20, 0xE4, 0xC2, 0x13, 0x19, 0x86, 0x5C, 0x78, 0x36, 0x57,
+    0x9E, 0x6B, 0x4A, 0xCB, 0x3F, 0xAB, 0x2C, 0xFF, 0xB4, 0xB1, 0xFC, 0x6A, 0x6B, 0x79, 0x61, 0x7A,
+    0x9E, 0x5E, 0xB5, 0x3C, 0xBA, 0x6E, 0x79, 0xF0, 0x8D, 0xE5, 0xAE, 0xB1, 0x7C, 0xD4, 0x73, 0x19,
+    0x78, 0x4C, 0xBE, 0x78, 0x43, 0x42, 0xF2, 0xB4, 0x11, 0xBF, 0xE8, 0x27, 0xAA, 0x37, 0xCE, 0x60,
+    0x9E, 0xCD, 0x99, 0xEB, 0x4D, 0x24, 0x8E, 0x35, 0x92, 0xB8, 0x77, 0xB7, 0x07, 0x9D, 0xA0, 0x52,
+    0x6D, 0x82, 0x4A, 0x95, 0xC1, 0x52, 0xA3, 0x2E, 0x4E, 0xA2, 0xAA, 0x88, 0xD5, 0xE4, 0xE4, 0xB2,
+    0x2A, 0x62, 0x2A, 0xD5, 0x03, 0x97, 0x50, 0x8D, 0xA0, 0x52, 0x2D, 0xC8, 0xA0, 0x04, 0x19, 0x74,
+    0x20, 0x83, 0x0A, 0x64, 0xD0, 0x80, 0x6C, 0x64, 0x99, 0xF4, 0x2C, 0x06, 0x53, 0xE9, 0x31, 0x2C,
+    0x85, 0xEF, 0x85, 0xBB, 0x8F, 0x59, 0x67, 0x8B, 0x34, 0xF6, 0x3A, 0x26, 0x99, 0xD5, 0x6E, 0xC6,
+    0x37, 0x67, 0xA9, 0x2C, 0xDB, 0x6F, 0x16, 0x96, 0xDF, 0x82, 0xE7, 0xA5, 0xFF, 0x31, 0x65, 0xDC,
+    0x04, 0xDD, 0x0A, 0x02, 0x87, 0xDF, 0x30, 0x7C, 0xF8, 0x53, 0x3B, 0xF7, 0x8F, 0x4B, 0xC3, 0xD6,
+    0x47, 0x10, 0xCA, 0x8D, 0x6F, 0x1E, 0x1C, 0xCB, 0x8A, 0xE2, 0xAB, 0xAC, 0x69, 0x39, 0xBB, 0x2C,
+    0x5E, 0x19, 0x41, 0xF2, 0xE0, 0xF7, 0x6A, 0x37, 0x8A, 0xDE, 0x6E, 0x46, 0x76, 0x9E, 0x31, 0x9C,
+    0xDA, 0x2F, 0x3C, 0x06, 0xBD, 0x00, 0x79, 0x53, 0xE6, 0x23, 0x90, 0xC3, 0x08, 0xC7, 0x72, 0x94,
+    0xCA, 0x9F, 0xE1, 0x53, 0xCF, 0x73, 0x06, 0xEF, 0xBC, 0xD1, 0x40, 0x75, 0x83, 0xEC, 0x57, 0x3A,
+    0x9D, 0x3A, 0x80, 0x78, 0x19, 0x82, 0x65, 0x90, 0x20, 0xC2, 0xAD, 0x94, 0x8E, 0xB9, 0x61, 0xA6,
+    0x9E, 0x51, 0x79, 0xFC, 0x6C, 0x43, 0xDC, 0xEB, 0xB8, 0xD1, 0xE0, 0x59, 0x69, 0x62, 0x07, 0x1C,
+    0x67, 0x48, 0x5E, 0x53, 0x89, 0xAF, 0x20, 0x42, 0x2E, 0xB5, 0x32, 0xA7, 0x32, 0x76, 0xB2, 0x1F,
+    0xF1, 0x26, 0xBE, 0xD9, 0xE1, 0x41, 0x1D, 0x9E, 0x88, 0x03, 0x0F, 0xCF, 0x91, 0x1C, 0xD2, 0x7F,
+    0x21, 0xA6, 0x4F, 0x7B, 0x17, 0x81, 0x30, 0x6E, 0x11, 0x9E, 0x4A, 0xFC, 0x4E, 0xFD, 0x5F, 0x63,
+    0x53, 0xA8, 0x99, 0xE4, 0x31, 0x5F, 0x8B, 0x5D, 0x92, 0x6A, 0xE6, 0x5C, 0xF5, 0x8A, 0x30, 0x14,
+    0xBF, 0xED, 0x6D, 0x36, 0x77, 0x42, 0x22, 0x9C, 0xB7, 0x8C, 0x31, 0x0F, 0x7B, 0x79, 0x08, 0xDC,
+    0x43, 0xD6, 0xC5, 0xED, 0xC8, 0xC1, 0x4C, 0x8A, 0x7E, 0xBB, 0xCD, 0x07, 0x80, 0x5F, 0x14, 0xBE,
+    0x28, 0x7A, 0xB1, 0xD0, 0x43, 0x51, 0x88, 0xA2, 0x11, 0xC5, 0x26, 0xF9, 0x40, 0xCA, 0x4D, 0x62,
+    0xBF, 0xD0, 0x4B, 0xF4, 0x62, 0xBD, 0x4D, 0x01, 0x8B, 0xC5, 0x2B, 0xDB, 0xE0, 0x8A, 0x9F, 0xAD,
+    0xCA, 0xE8, 0xDF, 0xBD, 0x51, 0x63, 0x6B, 0x54, 0x80, 0x17, 0x01, 0x78, 0xB1, 0x30, 0x25, 0x8B,
+    0x93, 0x47, 0x82, 0x97, 0x6C, 0x27, 0xF0, 0x82, 0x54, 0x28, 0xA2, 0xA9, 0xC6, 0xD1, 0xC1, 0xF2,
+    0xFE, 0x73, 0xC2, 0x99, 0x7A, 0x05, 0x56, 0x2B, 0x09, 0x66, 0x2C, 0x36, 0x79, 0x5C, 0xA2, 0x10,
+    0x46, 0x11, 0x0C, 0xC8, 0xC1, 0x1E, 0xBF, 0x28, 0x7C, 0xD9, 0x8E, 0x5E, 0x2C, 0xBA, 0xB8, 0xB0,
+    0x3A, 0xA0, 0x8A, 0x4D, 0x44, 0x41, 0x3C, 0x23, 0xC4, 0x33, 0x42, 0x3C, 0x23, 0x0F, 0x47, 0x31,
+    0x8F, 0x81, 0x67, 0xE6, 0x4E, 0x62, 0x21, 0xFA, 0x66, 0xD2, 0x9F, 0xED, 0x77, 0xD6, 0x30, 0xD0,
+    0xD5, 0xAA, 0x27, 0x8E, 0x24, 0x7B, 0xA3, 0xEF, 0xC2, 0x09, 0x0E, 0x42, 0x97, 0x7F, 0xEB, 0x23,
+    0x90, 0x17, 0xF6, 0x11, 0xB7, 0xC5, 0x03, 0x39, 0xFD, 0xDC, 0x2E, 0x68, 0x2E, 0x0E, 0x43, 0x90,
+    0xC7, 0xA8, 0x10, 0x70, 0x6A, 0x0F, 0xCB, 0xB3, 0x53, 0x5F, 0x16, 0x74, 0xD5, 0x2A, 0x5A, 0x65,
+    0xE0, 0xE1, 0x4C, 0xFF, 0x68, 0x0F, 0x6C, 0x30, 0xC7, 0x30, 0xEC, 0x5D, 0x2D, 0x19, 0xEB, 0xA8,
+    0xAA, 0x06, 0x41, 0x2A, 0xBD, 0x65, 0x83, 0xFD, 0xB2, 0xB6, 0x37, 0x36, 0x58, 0x9E, 0x03, 0xD9,
+    0x20, 0x94, 0x8F, 0xA6, 0x43, 0x6A, 0x51, 0x3F, 0x98, 0x6E, 0xDA, 0xE0, 0xCD, 0x97, 0x76, 0xC1,
+    0x06, 0x0B, 0x54, 0x3C, 0xA0, 0x14, 0xAE, 0x66, 0x88, 0x8D, 0x67, 0xE8, 0x07, 0x5C, 0x05, 0xA2,
+    0x49, 0x28, 0xD6, 0x98, 0x96, 0xEC, 0xCD, 0x5A, 0x18, 0x8D, 0x19, 0xA1, 0x27, 0x72, 0xCC, 0x6F,
+    0xE4, 0xA7, 0x0A, 0x27, 0xBB, 0xDE, 0x19, 0x0C, 0xAB, 0x03, 0x00, 0x71, 0xA3, 0x40, 0x39, 0xC7,
+    0xE7, 0xE9, 0x12, 0x12, 0xD4, 0xDF, 0x6A, 0x84, 0xFD, 0x72, 0x88, 0x20, 0xF4, 0x17, 0xBE, 0xD3,
+    0xB3, 0xE7, 0x1D, 0x2C, 0xA6, 0xF0, 0x3D, 0x78, 0x70, 0xF8, 0x73, 0x46, 0x15, 0x27, 0xD9, 0xED,
+    0x94, 0xEA, 0x20, 0x70, 0xB9, 0xA6, 0x82, 0x16, 0x7F, 0x12, 0x27, 0x59, 0x16, 0xFF, 0x72, 0x2D,
+    0xFE, 0xB5, 0x5A, 0x46, 0xC9, 0xDA, 0x93, 0xA7, 0xD6, 0x5E, 0xBB, 0xA2, 0x3F, 0x93, 0x17, 0x86,
+    0x35, 0x6A, 0xB1, 0xC2, 0x86, 0xEC, 0x85, 0x76, 0x5E, 0xAF, 0x9D, 0xEC, 0xEB, 0xA3, 0x04, 0x9F,
+    0x7E, 0x5C, 0x9E, 0x06, 0x70, 0x18, 0xF2, 0x59, 0x8F, 0xC5, 0xDB, 0x99, 0xCF, 0x30, 0xF3, 0x8D,
+    0xFA, 0xFC, 0x98, 0xEC, 0x58, 0x8B, 0x7A, 0x55, 0xE4, 0xD7, 0xAD, 0x1C, 0x02, 0xBB, 0xDD, 0xCA,
+    0xCB, 0xD0, 0xF7, 0x9A, 0x5E, 0xEF, 0x5E, 0x56, 0xE6, 0x2F, 0xE9, 0x43, 0x02, 0x28, 0x05, 0x67,
+    0x38, 0xE4, 0x74, 0x34, 0xD8, 0x51, 0x5B, 0x9D, 0x50, 0x4F, 0xC8, 0xFA, 0xD5, 0x2F, 0x14, 0x16,
+    0x14, 0xB0, 0xD6, 0x7E, 0x68, 0x0B, 0x16, 0x20, 0xC5, 0x8E, 0xC8, 0xD2, 0xF2, 0xC7, 0x66, 0x9C,
+    0x8B, 0xA9, 0x63, 0x7A, 0x5C, 0x0F, 0x1B, 0x99, 0x8B, 0xDD, 0x21, 0x21, 0x3B, 0xE3, 0x64, 0x9C,
+    0x84, 0xE6, 0x9E, 0xA9, 0xE2, 0x77, 0xCD, 0x7B, 0x4D, 0xB4, 0x64, 0x9C, 0x76, 0x4E, 0x75, 0xA3,
+    0x7A, 0xFB, 0x71, 0x9B, 0x89, 0x6F, 0x9A, 0xF1, 0x47, 0xD4, 0x58, 0xDD, 0x15, 0x3A, 0x1B, 0xD9,
+    0x97, 0x03, 0xD8, 0x1E, 0x48, 0xBF, 0xFE, 0xF0, 0x5B, 0x60, 0x44, 0xCF, 0xCC, 0x54, 0xE5, 0x28,
+    0xDB, 0xF0, 0xCE, 0x7C, 0xDC, 0x72, 0x7D, 0x1A, 0x06, 0x9C, 0x94, 0x10, 0xF6, 0x0C, 0x91, 0x89,
+    0xB0, 0xB8, 0x16, 0xF6, 0x4E, 0x36, 0xC9, 0xF3, 0xE3, 0xB5, 0x3C, 0xF3, 0x51, 0x0F, 0x16, 0x0E,
+    0x71, 0xC3, 0x82, 0x49, 0x80, 0x52, 0x50, 0xFF, 0x55, 0x78, 0xEB, 0xF3, 0x01, 0x8E, 0xF9, 0xA0,
+    0xE3, 0x3A, 0xBA, 0xB1, 0xE9, 0x13, 0x89, 0x8C, 0x5F, 0xAF, 0x7C, 0xD3, 0x55, 0x61, 0xD1, 0x24,
+    0x51, 0x86, 0x09, 0xC9, 0x2E, 0xE9, 0x11, 0x15, 0x50, 0xF9, 0xF3, 0x06, 0x0E, 0x83, 0x02, 0xFF,
+    0xB7, 0xC2, 0x66, 0x86, 0x84, 0xB7, 0xFE, 0x0C, 0x47, 0x83, 0x13, 0x18, 0x53, 0xC4, 0x7F, 0x48,
+    0x8B, 0x66, 0xEE, 0x54, 0xD9, 0x04, 0xA6, 0x6E, 0x25, 0x4A, 0xE2, 0x71, 0x67, 0x93, 0xF4, 0x0C,
+    0x6A, 0xFD, 0xDD, 0x83, 0xA8, 0xF5, 0xFB, 0x29, 0x04, 0x87, 0xCE, 0x33, 0xC4, 0x9E, 0x14, 0x98,
+    0x9F, 0x97, 0x18, 0xF6, 0x06, 0x0C, 0xEB, 0xF5, 0x87, 0x29, 0xB4, 0x13, 0x74, 0xFD, 0x41, 0x4A,
+    0x26, 0x9B, 0x4A, 0x4A, 0xA0, 0x87, 0x2A, 0x79, 0x8B, 0x5E, 0xBB, 0x36, 0xB4, 0x8C, 0x1C, 0x8C,
+    0xE2, 0xFF, 0x55, 0x95, 0x4C, 0x66, 0x20, 0x7B, 0x8A, 0xA8, 0x35, 0x59, 0xEC, 0x7E, 0xA6, 0x25,
+    0xB7, 0x16, 0xC7, 0x08, 0x67, 0x8D, 0x5B, 0x82, 0x60, 0xE5, 0xB8, 0xCD, 0x31, 0xA2, 0xFE, 0x0B,
+    0x20, 0x5D, 0xC7, 0x5B, 0xD9, 0x11, 0x69, 0x73, 0x36, 0x4A, 0x62, 0x5E, 0xC2, 0xD8, 0xD7, 0x04,
+    0xEC, 0x3B, 0x78, 0xBC, 0x17, 0x8A, 0x03, 0xFA, 0xC2, 0x04, 0xA6, 0xEC, 0x1B, 0x37, 0xB5, 0x9F,
+    0xC9, 0x71, 0x2C, 0xAD, 0xA0, 0xE9, 0xB1, 0x01, 0x0B, 0x54, 0x48, 0x53, 0xDB, 0xFA, 0x6C, 0xEB,
+    0x60, 0x81, 0x9A, 0xA2, 0xF8, 0x08, 0x4A, 0x14, 0xAA, 0x78, 0xBF, 0x2A, 0xFE, 0x1D, 0xC4, 0x9D,
+    0x6F, 0xA6, 0x98, 0xA8, 0x16, 0xF0, 0x17, 0x36, 0xAC, 0xE1, 0x2F, 0x75, 0x8C, 0xEF, 0xC3, 0x8A,
+    0xE5, 0x49, 0x6E, 0x96, 0xCC, 0x6E, 0xA3, 0x61, 0x45, 0x0E, 0x7E, 0xA6, 0xC8, 0x75, 0x00, 0x36,
+    0x41, 0x37, 0x34, 0x09, 0x7E, 0x28, 0x1C, 0x66, 0x52, 0xAE, 0x09, 0x48, 0xF1, 0x1C, 0xA6, 0x43,
+    0x9D, 0xFC, 0x21, 0x82, 0xC4, 0x9C, 0x9E, 0xD8, 0x24, 0xF2, 0x6C, 0x75, 0xEB, 0xC3, 0x05, 0x13,
+    0xC1, 0x13, 0x41, 0xFF, 0x47, 0xE8, 0xAA, 0x80, 0xFC, 0x02, 0x7C, 0x2B, 0xAE, 0x37, 0xD1, 0xB8,
+    0x8F, 0x60, 0x17, 0xD8, 0xA3, 0x08, 0x24, 0x94, 0x79, 0x59, 0xB5, 0x37, 0xB3, 0x18, 0xA7, 0x9C,
+    0x11, 0x24, 0x9C, 0xCB, 0x4B, 0x0B, 0x68, 0xFC, 0x7A, 0x0E, 0x6B, 0xF3, 0xB8, 0x78, 0x35, 0xFB,
+    0xB8, 0xEC, 0x34, 0x85, 0x5F, 0xE5, 0x85, 0xC7, 0xE0, 0x38, 0xD7, 0x37, 0x03, 0x8A, 0x55, 0x71,
+    0x6E, 0xE3, 0xD2, 0xBC, 0xEC, 0x1B, 0x5A, 0xCC, 0x3C, 0x27, 0x11, 0xE2, 0x11, 0xB6, 0x71, 0x1C,
+    0x3C, 0x79, 0x0E, 0x01, 0x78, 0x43, 0x5E, 0xA4, 0x35, 0xB4, 0xDA, 0x62, 0x83, 0x18, 0xE3, 0xE4,
+    0xD3, 0x3E, 0xFF, 0x30, 0x37, 0x70, 0xC1, 0xDB, 0xE3, 0x27, 0x38, 0xCE, 0xA2, 0x1E, 0x3A, 0xC7,
+    0xCE, 0xD6, 0x97, 0x0D, 0xA2, 0xCB, 0x5A, 0x5F, 0xA8, 0xB1, 0x5E, 0xFC, 0x3E, 0x75, 0xDE, 0xD6,
+    0x4B, 0x4B, 0x46, 0x84, 0x98, 0x95, 0x4A, 0x2E, 0x25, 0xFF, 0x07, 0xCD, 0x4D, 0x3D, 0x61, 0x48,
+    0xA1, 0x80, 0xDA, 0x15, 0x18, 0x75, 0x7D, 0x77, 0xE0, 0xD9, 0x34, 0x33, 0x3D, 0x5B, 0xB8, 0x3A,
+    0x7D, 0xFD, 0x1A, 0x3F, 0xC8, 0xF6, 0xAC, 0x8B, 0x39, 0x2C, 0xE2, 0xA2, 0x2F, 0x6E, 0x1D, 0xFA,
+    0x83, 0x5B, 0xEE, 0x5D, 0x46, 0xD1, 0x70, 0x4A, 0xF8, 0x4D, 0x70, 0x7B, 0x46, 0x76, 0x25, 0xA3,
+    0xA4, 0xE6, 0x73, 0x55, 0x78, 0xB1, 0x5B, 0xCA, 0xEF, 0xDA, 0x09, 0x8F, 0x26, 0x3D, 0x2F, 0x1F,
+    0x87, 0xC3, 0x8B, 0xAE, 0x61, 0x0C, 0xB7, 0x3D, 0xB9, 0x52, 0x9E, 0xBA, 0x6B, 0x3F, 0x0F, 0xAA,
+    0x9D, 0x78, 0x38, 0xF0, 0x89, 0xE5, 0x58, 0xE1, 0x13, 0xE6, 0x18, 0xEF, 0x2E, 0xAC, 0xC5, 0x1E,
+    0xCB, 0x36, 0x88, 0x65, 0x3B, 0x52, 0xF9, 0x44, 0xA2, 0xEB, 0x4C, 0x1A, 0x9C, 0x46, 0xAC, 0xC9,
+    0x34, 0x01, 0x0E, 0x8F, 0x33, 0x58, 0x2C, 0x2E, 0xFC, 0x7A, 0x96, 0x20, 0x9F, 0x60, 0xF2, 0x41,
+    0x72, 0x9A, 0x8D, 0x29, 0x06, 0x21, 0xD2, 0xAF, 0xB1, 0x88, 0x15, 0xDB, 0x23, 0x23, 0x21, 0xEA,
+    0xDD, 0x6B, 0x19, 0x96, 0xD6, 0xFA, 0x86, 0xE2, 0x7D, 0x24, 0x6C, 0x15, 0xD2, 0x65, 0x5B, 0xDD,
+    0xC4, 0xCD, 0x3E, 0xCD, 0x45, 0x5D, 0x23, 0x83, 0x54, 0xEC, 0x31, 0x6A, 0x87, 0x51, 0xFB, 0x8B,
+    0xB6, 0x51, 0xAA, 0x5D, 0x52, 0x6D, 0x91, 0x6A, 0x7F, 0x54, 0x9B, 0xA3, 0xDA, 0x19, 0xD5, 0xB6,
+    0xA8, 0xF6, 0x44, 0xB5, 0x21, 0xAA, 0xDD, 0x50, 0x6D, 0x85, 0x6A, 0x1F, 0x94, 0x61, 0x5D, 0x7B,
+    0x88, 0xDA, 0x41, 0xEC, 0x9F, 0xCF, 0x85, 0x17, 0x16, 0x43, 0x05, 0x2E, 0xE7, 0x65, 0xAB, 0x1F,
+    0x28, 0x6C, 0x07, 0x0A, 0xBB, 0x81, 0xC2, 0x66, 0xA0, 0xB0, 0x17, 0x28, 0x6C, 0xF3, 0x7D, 0x07,
+    0x61, 0x92, 0x15, 0xB6, 0x00, 0x87, 0x66, 0x89, 0x2E, 0xA5, 0x8D, 0xA1, 0xDB, 0xA8, 0x38, 0xC9,
+    0xFB, 0x23, 0x06, 0xF6, 0x5C, 0x92, 0x57, 0x93, 0x1E, 0x40, 0xF5, 0x04, 0x6F, 0x7D, 0xDE, 0x11,
+    0x10, 0xB1, 0x1F, 0x08, 0xCB, 0x4D, 0xC4, 0x5E, 0xF7, 0x88, 0x9D, 0x78, 0x78, 0xF4, 0x2D, 0x16,
+    0x83, 0x05, 0xEB, 0x45, 0x0F, 0xD6, 0xB3, 0x99, 0xEE, 0x1E, 0x2D, 0xC9, 0xA1, 0x5F, 0xE9, 0x4B,
+    0x05, 0xAA, 0x79, 0xB3, 0x14, 0xA7, 0x98, 0x88, 0x73, 0xAD, 0xB4, 0x8D, 0xEF, 0xB9, 0xFB, 0x40,
+    0xFB, 0x3B, 0x00, 0xED, 0xC9, 0x0F, 0x01, 0xED, 0x4E, 0x37, 0xDB, 0x47, 0xF6, 0xED, 0xA2, 0x9D,
+    0x97, 0xFF, 0x29, 0x08, 0x6F, 0x5B, 0xB0, 0xDA, 0x7B, 0x0D, 0x39, 0x1B, 0xC7, 0x64, 0x97, 0xC0,
+    0x7C, 0x1F, 0x92, 0x78, 0x46, 0x7B, 0x8C, 0xAC, 0x35, 0x8E, 0x30, 0xDA, 0x9C, 0xDF, 0x06, 0x48,
+    0x5C, 0x86, 0x26, 0x3F, 0x07, 0x1E, 0x98, 0x27, 0xEE, 0x38, 0x44, 0x2C, 0x72, 0x84, 0x64, 0x1D,
+    0x58, 0xE4, 0x9D, 0x12, 0xE4, 0x3D, 0x80, 0x90, 0xF4, 0x7D, 0x5C, 0x10, 0x7F, 0x46, 0x40, 0xF2,
+    0x4F, 0x02, 0x92, 0x66, 0x58, 0x6D, 0x0A, 0x48, 0x46, 0x5F, 0x33, 0x2B, 0x65, 0xB3, 0x3A, 0xD2,
+    0x8D, 0x83, 0xC2, 0xB6, 0x91, 0xC4, 0x01, 0xFE, 0xF8, 0x50, 0x81, 0xA0, 0xC5, 0x1F, 0x26, 0x49,
+    0x97, 0x4C, 0x91, 0xBB, 0x79, 0x61, 0x7C, 0x7C, 0x72, 0x00, 0xC7, 0xD1, 0xA8, 0xC8, 0xD7, 0x31,
+    0xCE, 0x64, 0x6B, 0xDF, 0x14, 0x60, 0x5F, 0x67, 0xA6, 0xDF, 0xAC, 0xA1, 0xE1, 0x9A, 0x73, 0x20,
+    0xC7, 0x43, 0x16, 0x93, 0x5E, 0xB6, 0x17, 0xBD, 0xE9, 0x4B, 0x51, 0x22, 0xD1, 0xEB, 0x85, 0xF8,
+    0x57, 0x27, 0xB8, 0x7A, 0xFD, 0x29, 0x95, 0x98, 0x9A, 0x6F, 0x7D, 0x46, 0x9D, 0xF0, 0x55, 0x7C,
+    0xFC, 0xB2, 0x53, 0xEE, 0x85, 0x2E, 0x4C, 0x4B, 0x9A, 0x2A, 0xAE, 0x55, 0xE2, 0xC9, 0xDB, 0x4F,
+    0x45, 0x97, 0xE0, 0x0B, 0x84, 0xF5, 0xDB, 0x90, 0x63, 0x7A, 0x16, 0xA2, 0x1D, 0xEC, 0x4B, 0x12,
+    0x33, 0x5D, 0xEC, 0x3E, 0xE6, 0x1E, 0x18, 0x60, 0x88, 0x62, 0x92, 0x23, 0xEE, 0xCC, 0x3E, 0x14,
+    0xD2, 0x07, 0x40, 0xCB, 0xC9, 0x64, 0xDB, 0x67, 0xDC, 0x41, 0x6B, 0xE4, 0x20, 0xF7, 0xCD, 0x16,
+    0xBB, 0xF1, 0xC5, 0xD4, 0x2E, 0x2F, 0xB9, 0x14, 0xC3, 0xFE, 0xF0, 0xA3, 0x40, 0xED, 0x3F, 0x60,
+    0xD9, 0x04, 0xC6, 0xAB, 0x25, 0xBA, 0xCC, 0xB4, 0x00, 0x99, 0x10, 0xFE, 0xF9, 0x6F, 0x5B, 0x33,
+    0x63, 0x6D, 0xD4, 0x30, 0x77, 0xA7, 0x99, 0x83, 0x84, 0x3B, 0x8F, 0xC8, 0x79, 0x71, 0x7B, 0x1B,
+    0x1B, 0xE8, 0x0A, 0xD1, 0x1C, 0xA1, 0x30, 0x12, 0x59, 0xF7, 0x9F, 0xBA, 0xCC, 0xB4, 0xB3, 0x7B,
+    0x9F, 0x9D, 0x9F, 0x50, 0xE6, 0x34, 0xCA, 0xC2, 0xD7, 0x0A, 0xFF, 0x4A, 0xE5, 0x4C, 0xCE, 0xEB,
+    0xB6, 0x6F, 0xEB, 0x98, 0x7A, 0xDB, 0x2F, 0x18, 0x1E, 0xF9, 0x72, 0xF2, 0x1B, 0x0A, 0xAA, 0x25,
+    0x0E, 0x8B, 0xF0, 0xFD, 0xD2, 0xFB, 0x1C, 0xCF, 0x51, 0xB9, 0x4E, 0x26, 0x23, 0x6E, 0xDB, 0x96,
+    0xCC, 0xEB, 0x0F, 0x7B, 0xA5, 0xF5, 0x48, 0xEF, 0xF5, 0xB8, 0x22, 0xE5, 0x15, 0x3F, 0x3B, 0x32,
+    0x2A, 0x9E, 0x64, 0x4F, 0x25, 0x60, 0x2A, 0x95, 0x8D, 0xB0, 0x37, 0xFD, 0xC2, 0x32, 0x2B, 0xCA,
+    0x80, 0x39, 0xEB, 0xA1, 0xAF, 0x90, 0x79, 0xCC, 0x56, 0x54, 0xEE, 0xED, 0x86, 0xA8, 0x8C, 0xC9,
+    0x79, 0x15, 0xD3, 0x27, 0x07, 0xFD, 0x64, 0xCF, 0xF6, 0x54, 0x30, 0x0B, 0x12, 0xBD, 0x86, 0x60,
+    0x70, 0xA5, 0x12, 0xA7, 0x3C, 0xFF, 0x94, 0xF6, 0x54, 0xBC, 0x46, 0x7F, 0xA8, 0xC1, 0x64, 0xC0,
+    0x6A, 0xEE, 0xC8, 0x66, 0x1C, 0xDD, 0x7D, 0x85, 0xF8, 0x33, 0x98, 0x11, 0x2A, 0x44, 0xF7, 0x5A,
+    0x2D, 0x5E, 0x72, 0xE4, 0xE9, 0x28, 0xE4, 0x5F, 0x67, 0x97, 0xAA, 0xA2, 0x56, 0x53, 0xA6, 0xB7,
+    0x43, 0xC1, 0xEC, 0xCF, 0x3E, 0xB4, 0xE8, 0x70, 0x1B, 0xF5, 0x89, 0x11, 0xEB, 0x1E, 0xC7, 0x0C,
+    0x44, 0xDF, 0xEA, 0x17, 0x21, 0x0B, 0x57, 0xA6, 0x94, 0x56, 0xCB, 0x9E, 0x48, 0xBB, 0x19, 0xC4,
+    0x8F, 0x3E, 0xAB, 0x0A, 0x77, 0x7B, 0xAB, 0xA2, 0x88, 0x34, 0x2C, 0xC4, 0x88, 0xD2, 0xC1, 0xA7,
+    0x28, 0x97, 0xB0, 0xEA, 0xA4, 0x3A, 0xD3, 0xA3, 0xA7, 0x5F, 0x11, 0x3C, 0x25, 0xC1, 0xBD, 0x3C,
+    0xF3, 0x9B, 0x28, 0xF1, 0xA7, 0x2F, 0xDD, 0xD7, 0xB6, 0xD8, 0x7E, 0x84, 0x6D, 0xC2, 0x9E, 0xB6,
+    0xCC, 0x6C, 0x44, 0x47, 0x3A, 0x31, 0xCC, 0x38, 0x6F, 0x0F, 0x13, 0xB3, 0xBB, 0x7A, 0xEC, 0x34,
+    0x27, 0x4F, 0xA6, 0x47, 0x43, 0x14, 0x70, 0x0E, 0x89, 0x4C, 0x42, 0xC2, 0x4D, 0xEF, 0xDD, 0x72,
+    0xEF, 0x36, 0xED, 0x82, 0x4F, 0xB9, 0x61, 0xF8, 0x77, 0xED, 0x20, 0x5C, 0x60, 0x45, 0x73, 0x78,
+    0x37, 0xB6, 0xAE, 0x2C, 0xB8, 0x53, 0xFC, 0x8A, 0xC1, 0xFD, 0x77, 0x31, 0xE6, 0xF3, 0xB2, 0xBE,
+    0x77, 0x5A, 0xDA, 0x5A, 0x22, 0x66, 0xEA, 0x3C, 0xCB, 0x8A, 0x61, 0xDD, 0x4B, 0x76, 0x47, 0xCB,
+    0x7C, 0x2A, 0xDE, 0x1D, 0xF8, 0x01, 0xD6, 0x36, 0x32, 0x42, 0x16, 0x65, 0xF3, 0x5A, 0x91, 0x85,
+    0x84, 0xD9, 0xF4, 0x33, 0xFE, 0x72, 0x29, 0xE7, 0xCF, 0xD8, 0x38, 0xF9, 0x79, 0x39, 0x87, 0xA8,
+    0x71, 0x1C, 0xD5, 0x64, 0xCC, 0x23, 0x09, 0x8B, 0xE8, 0xAB, 0x1C, 0xB9, 0xA3, 0xDE, 0xDA, 0x63,
+    0x8B, 0x7B, 0x08, 0xCA, 0xE5, 0x72, 0x1A, 0xC7, 0x38, 0xF1, 0x4D, 0x15, 0x2D, 0x4D, 0x63, 0xA9,
+    0x59, 0x4D, 0x4F, 0xA1, 0x67, 0xC1, 0x1B, 0xD2, 0x66, 0xDF, 0xA8, 0x39, 0x2A, 0xCD, 0x31, 0x69,
+    0xE2, 0x0F, 0x6A, 0xDF, 0x2A, 0xFF, 0xA2, 0xC8, 0x05, 0x6D, 0x0E, 0xC1, 0xDC, 0x80, 0x1C, 0x4C,
+    0x65, 0xF9, 0x27, 0xDF, 0xE6, 0x72, 0x1E, 0xBA, 0xCA, 0x7A, 0x4F, 0xFC, 0xBE, 0xA6, 0xFA, 0xFE,
+    0x64, 0xA5, 0x65, 0x4B, 0x60, 0x33, 0x5C, 0xD9, 0xED, 0x49, 0x0E, 0xAC, 0x35, 0x93, 0x06, 0x15,
+    0xDD, 0xFB, 0x39, 0x4D, 0x01, 0x46, 0xB0, 0xDC, 0x5D, 0x26, 0x98, 0xC5, 0x3B, 0x89, 0x9A, 0x72,
+    0x87, 0x17, 0x5B, 0x12, 0x66, 0xE2, 0x58, 0xE1, 0x4F, 0x10, 0x17, 0x3B, 0x15, 0x81, 0x71, 0xBF,
+    0x25, 0xB3, 0x1F, 0x65, 0x78, 0x04, 0xC8, 0x93, 0xA2, 0x68, 0xCF, 0x01, 0x9E, 0x8E, 0x6B, 0x41,
+    0x8F, 0xD5, 0xC8, 0xE4, 0x8C, 0xE4, 0x27, 0xA8, 0x4B, 0x9D, 0x7F, 0xB4, 0xB3, 0x2D, 0xA5, 0xD2,
+    0xFE, 0xC8, 0x83, 0x07, 0xDF, 0x23, 0xFE, 0x3A, 0x34, 0x3E, 0x1E, 0x9C, 0x23, 0x6F, 0x62, 0x2E,
+    0x7E, 0xC3, 0xE7, 0x7E, 0xC4, 0xDF, 0x45, 0x5D, 0xF4, 0x6A, 0xC4, 0x84, 0x55, 0x9B, 0x0B, 0x3D,
+    0xA4, 0xB4, 0x72, 0x84, 0xEC, 0xF9, 0xA1, 0xB6, 0x77, 0x50, 0x2D, 0x38, 0x6D, 0xFF, 0x7B, 0x27,
+    0x08, 0x19, 0x4D, 0xF0, 0x15, 0xA2, 0xCB, 0xDD, 0xAD, 0x5D, 0x77, 0x46, 0xD4, 0xEB, 0x93, 0xBE,
+    0xFD, 0xB6, 0xB9, 0xEB, 0x9E, 0x9A, 0xCB, 0xA6, 0x0B, 0x0D, 0x8A, 0x78, 0xAD, 0xE0, 0xB5, 0xEC,
+    0xDE, 0x91, 0x60, 0x6A, 0x4A, 0x2D, 0xD6, 0x1F, 0x7E, 0x09, 0x09, 0x53, 0xF4, 0x9D, 0xD4, 0x5C,
+    0x19, 0xAA, 0x15, 0x36, 0x7F, 0xB5, 0xFB, 0xAB, 0xED, 0xDF, 0xA1, 0xFF, 0x6B, 0x3B, 0xC0, 0xDA,
+    0x02, 0x7E, 0xB0, 0xA4, 0x46, 0xB5, 0xEA, 0x7F, 0x03, 0x0B, 0xFB, 0x4F, 0x50, 0xAD, 0xFE, 0x17,
+    0x7D, 0x55, 0x41, 0x6F, 0x1B, 0x45, 0x14, 0xFE, 0x76, 0xD7, 0xCE, 0xB6, 0x59, 0x9A, 0xB5, 0x50,
+    0x52, 0x25, 0x05, 0x7B, 0x7D, 0xC8, 0xA1, 0x0D, 0xB1, 0x97, 0x43, 0x90, 0x7C, 0xB0, 0xBD, 0x23,
+    0x7E, 0x81, 0x0F, 0x31, 0x12, 0x27, 0x72, 0xC8, 0x05, 0x57, 0xA8, 0x3E, 0xE4, 0x90, 0x4A, 0x21,
+    0x3B, 0x12, 0xDC, 0x6B, 0xF1, 0x0B, 0x7C, 0x48, 0x51, 0x31, 0x87, 0xF8, 0x90, 0xA0, 0x20, 0xD2,
+    0xEE, 0x88, 0xFC, 0x81, 0x81, 0x5F, 0xB0, 0x17, 0x0E, 0x05, 0x09, 0x0D, 0xC8, 0x41, 0xA1, 0xB2,
+    0x77, 0x78, 0x63, 0x37, 0x69, 0x9A, 0x03, 0xF3, 0x56, 0xE3, 0x37, 0x6F, 0x66, 0xDE, 0xBC, 0xF7,
+    0xBD, 0x6F, 0xC6, 0x40, 0x24, 0x7C, 0x69, 0x2B, 0xEC, 0x02, 0xCE, 0xD8, 0x4B, 0x03, 0x5E, 0x07,
+    0x35, 0x77, 0x0C, 0x3F, 0x43, 0x33, 0x60, 0x3B, 0x8E, 0xA0, 0x61, 0x20, 0x87, 0xF1, 0xAB, 0xF4,
+    0x58, 0x8B, 0x5E, 0xC8, 0x80, 0x24, 0x4B, 0xB2, 0x76, 0xBB, 0xAD, 0xB5, 0x06, 0x94, 0xFF, 0x7C,
+    0x3F, 0xA2, 0x7D, 0x20, 0x3F, 0x46, 0xF2, 0xA8, 0xB8, 0x3C, 0xF2, 0x05, 0x7D, 0x39, 0x0B, 0xF7,
+    0x78, 0xAC, 0xCA, 0x23, 0x8C, 0x5C, 0xE9, 0xC2, 0x42, 0x1E, 0xB1, 0x54, 0x2A, 0x1D, 0x9E, 0xAB,
+    0xC8, 0x38, 0xA5, 0x03, 0xFF, 0xBA, 0xF0, 0xCF, 0x54, 0xE0, 0x89, 0xFA, 0x82, 0x19, 0x36, 0x1C,
+    0xE9, 0x3F, 0xE1, 0xAE, 0x86, 0x3D, 0x86, 0xA2, 0xD6, 0x52, 0xAF, 0x5B, 0xAB, 0x45, 0xB3, 0x2F,
+    0x22, 0x16, 0xFA, 0xC2, 0x3F, 0x4B, 0x6D, 0xA9, 0x68, 0x68, 0x8D, 0x28, 0x5E, 0xD8, 0x17, 0xA8,
+    0xD9, 0xA2, 0xE9, 0x09, 0x5F, 0x1B, 0x9D, 0x22, 0x1D, 0x45, 0xE3, 0x93, 0x6A, 0xEA, 0x81, 0x7B,
+    0xA2, 0x88, 0x3A, 0x22, 0x66, 0xA2, 0x9A, 0x67, 0x3E, 0xFD, 0x86, 0xC2, 0x17, 0x8E, 0x70, 0x59,
+    0x13, 0x65, 0xF8, 0x53, 0x7B, 0x44, 0x2B, 0x8A, 0xF0, 0x04, 0xB8, 0x3F, 0x8D, 0xFF, 0xCD, 0xBC,
+    0xC9, 0xC7, 0x53, 0xF6, 0x88, 0x16, 0xBC, 0xC1, 0xC5, 0x7D, 0x98, 0xB8, 0x16, 0xE4, 0xCB, 0x4C,
+    0x32, 0x3D, 0x4E, 0xC6, 0x34, 0x37, 0x93, 0x55, 0x20, 0x24, 0xEF, 0x9E, 0x70, 0xC9, 0x63, 0x01,
+    0xB9, 0xC6, 0x4E, 0xB7, 0x56, 0xCC, 0x63, 0x9E, 0x24, 0x96, 0x40, 0xA7, 0xF7, 0xA8, 0x67, 0x74,
+    0xD3, 0xE6, 0x11, 0xB0, 0x58, 0xCE, 0xE3, 0x36, 0x59, 0x3B, 0x3D, 0x32, 0xA4, 0x46, 0xEE, 0xCA,
+    0x58, 0x18, 0x64, 0x87, 0x24, 0x5D, 0x3C, 0x66, 0x91, 0x0C, 0xF8, 0x0A, 0x62, 0x9E, 0xF0, 0x88,
+    0x96, 0x5C, 0x47, 0xF4, 0x12, 0xC3, 0xE3, 0x34, 0xE4, 0x4B, 0xCD, 0xBD, 0x23, 0x42, 0xE6, 0x0E,
+    0x02, 0xE1, 0x28, 0x5B, 0x7D, 0x2F, 0x13, 0x16, 0x60, 0x0F, 0x17, 0x18, 0x23, 0x51, 0x61, 0x3A,
+    0x45, 0x8E, 0xB6, 0x27, 0x3A, 0xFD, 0xF1, 0x93, 0x74, 0x88, 0xB4, 0x85, 0x16, 0xB3, 0xCE, 0xBE,
+    0xFA, 0xE9, 0xCF, 0xFB, 0xDB, 0xDB, 0x56, 0xAF, 0x3A, 0x05, 0x8D, 0x30, 0xB4, 0x36, 0x61, 0x1D,
+    0xC0, 0x9D, 0xC0, 0x3F, 0x44, 0xC3, 0x15, 0x8B, 0x16, 0x5B, 0xB5, 0x38, 0x29, 0x81, 0x66, 0xDE,
+    0x04, 0x68, 0x99, 0x59, 0x22, 0x43, 0x78, 0xC8, 0xEA, 0x8E, 0x28, 0x80, 0xCD, 0xB1, 0x42, 0x94,
+    0xAA, 0x44, 0x4B, 0x95, 0x70, 0xE4, 0xD0, 0xF9, 0x2E, 0xC9, 0x96, 0x36, 0xD7, 0x06, 0xCF, 0x62,
+    0x3D, 0x59, 0x6A, 0x6F, 0x46, 0x7A, 0x4C, 0xBA, 0xC1, 0xEF, 0x52, 0x99, 0x91, 0xE7, 0x9C, 0xC8,
+    0x53, 0xA5, 0x14, 0xA1, 0xB5, 0x1A, 0x0C, 0xFA, 0x53, 0x30, 0x22, 0xA2, 0x90, 0x58, 0x1B, 0x0C,
+    0x06, 0xDC, 0x8C, 0x6C, 0x49, 0x89, 0x58, 0x14, 0x46, 0x8A, 0x7D, 0x60, 0x03, 0x57, 0x6D, 0xC3,
+    0x00, 0x03, 0x05, 0x4B, 0x82, 0xD8, 0xE8, 0x70, 0x78, 0x80, 0x0F, 0x2A, 0x9C, 0x29, 0x4E, 0xED,
+    0xFF, 0x26, 0xEF, 0x4F, 0xF7, 0x17, 0xF6, 0x8A, 0x77, 0xD6, 0x77, 0x48, 0xE9, 0xA3, 0x4F, 0x30,
+    0x10, 0x1E, 0x9D, 0x41, 0x2F, 0xD6, 0xF2, 0x69, 0xBB, 0x4F, 0x96, 0xE3, 0x76, 0x4A, 0x7A, 0x6E,
+    0x31, 0xCE, 0x7E, 0x3E, 0xE3, 0x1F, 0x97, 0x39, 0xB1, 0x80, 0x6A, 0x5F, 0x16, 0x2B, 0xBB, 0xC3,
+    0xDD, 0xCA, 0x42, 0xA5, 0x4C, 0x39, 0x51, 0x66, 0xB4, 0xFB, 0x52, 0x49, 0x58, 0x28, 0xDC, 0x14,
+    0x47, 0xC4, 0x87, 0x0B, 0x3F, 0x0D, 0xD9, 0x2E, 0x6E, 0x26, 0xF9, 0x65, 0x12, 0x14, 0xB7, 0x8D,
+    0xF5, 0x14, 0xDB, 0x93, 0xFE, 0xF8, 0x1F, 0x75, 0xFA, 0xB7, 0x2A, 0x08, 0xB6, 0x86, 0x98, 0x24,
+    0x12, 0x01, 0xBF, 0x51, 0x95, 0x1B, 0x98, 0x5D, 0xA7, 0x7D, 0x2C, 0x3F, 0x90, 0x36, 0x09, 0xA5,
+    0x12, 0x9C, 0x74, 0xE3, 0x4C, 0xFD, 0xA0, 0xE5, 0x37, 0xBF, 0x33, 0x8B, 0x99, 0xC2, 0x10, 0xE3,
+    0x0D, 0xE9, 0xFB, 0x85, 0x40, 0xAA, 0x58, 0xA7, 0xE7, 0x09, 0xEF, 0xCD, 0x8C, 0x63, 0x93, 0xEB,
+    0x8D, 0xA8, 0xDE, 0x2E, 0x43, 0xAE, 0xD0, 0x3C, 0x8D, 0x27, 0xCB, 0xAB, 0x66, 0x95, 0x8F, 0x90,
+    0xF8, 0x6F, 0x44, 0x3B, 0x63, 0x5F, 0xBD, 0xB4, 0x0E, 0xE6, 0x86, 0x44, 0x5B, 0x74, 0x65, 0xFE,
+    0x29, 0xD1, 0x71, 0x29, 0x4F, 0xEB, 0xB7, 0xD0, 0x03, 0x1D, 0xBA, 0x88, 0x5F, 0xA8, 0xEB, 0xFE,
+    0x0A, 0xDC, 0x9A, 0x75, 0xB4, 0x2E, 0xD7, 0xB5, 0x39, 0x96, 0x4D, 0x3C, 0x14, 0xEF, 0xA6, 0xD5,
+    0x82, 0xBC, 0xFD, 0x2D, 0xBA, 0x53, 0x07, 0xBF, 0x59, 0x9B, 0xF9, 0xE1, 0xD4, 0xA9, 0x29, 0x54,
+    0x40, 0x77, 0xB2, 0x71, 0x79, 0x3F, 0x4A, 0x53, 0x5A, 0x69, 0x84, 0x9F, 0x71, 0xA2, 0xD5, 0xD5,
+    0x6D, 0x26, 0x1F, 0x57, 0x25, 0x20, 0x98, 0x6C, 0xBA, 0x16, 0x4D, 0xB8, 0x02, 0xEC, 0xBA, 0x03,
+    0x7A, 0x4D, 0x5E, 0x78, 0xCC, 0x7F, 0x22, 0x9E, 0x17, 0xA5, 0xDC, 0x18, 0x4E, 0xEB, 0x7B, 0x64,
+    0x30, 0x85, 0x66, 0x09, 0xC5, 0x08, 0xBC, 0xFB, 0x75, 0xF3, 0xD4, 0x4B, 0x9B, 0xA7, 0x36, 0x0F,
+    0x0E, 0xD9, 0x47, 0xE7, 0xA2, 0xDB, 0x97, 0xD4, 0x93, 0xBE, 0x48, 0x6C, 0x8A, 0xC4, 0x5D, 0x41,
+    0x21, 0x93, 0x23, 0x0A, 0xDE, 0x3C, 0x77, 0x75, 0x9F, 0xC1, 0x52, 0x4E, 0xD6, 0x4E, 0x04, 0x1E,
+    0xE9, 0x7F, 0xC9, 0xB2, 0xF8, 0xD6, 0x2C, 0x87, 0xAD, 0xEC, 0x6C, 0x40, 0x74, 0x0F, 0xF5, 0xC5,
+    0x1B, 0x5E, 0xC6, 0xDA, 0x30, 0xDE, 0xB0, 0x42, 0x4F, 0x88, 0xC5, 0xCF, 0xD0, 0x26, 0x23, 0xF3,
+    0xC8, 0x81, 0x23, 0x82, 0x3F, 0x74, 0x96, 0xB0, 0x3A, 0xDE, 0xD3, 0x99, 0xF1, 0x94, 0x27, 0x68,
+    0xAC, 0xC1, 0xC1, 0x6C, 0x13, 0x31, 0x35, 0x6B, 0x3F, 0xA4, 0x17, 0x96, 0x92, 0x0A, 0xA7, 0x1C,
+    0x75, 0xF8, 0x6B, 0x97, 0xE5, 0xCE, 0x60, 0x70, 0x42, 0x4B, 0xA8, 0x80, 0xF8, 0xD0, 0x18, 0x42,
+    0x51, 0x96, 0xF7, 0xD2, 0xA3, 0xF4, 0x38, 0x5D, 0xDE, 0x2A, 0x89, 0x0D, 0xB5, 0xAF, 0x76, 0x50,
+    0xDF, 0x9A, 0xA3, 0x9D, 0xEB, 0x34, 0xBB, 0x47, 0xFD, 0x4C, 0x3A, 0xA8, 0x8A, 0xAE, 0x1A, 0x52,
+    0xDB, 0x48, 0xE7, 0x59, 0x65, 0xB7, 0x58, 0x37, 0x52, 0xDA, 0x9B, 0xFB, 0xB4, 0x24, 0x6B, 0xFD,
+    0x1A, 0x81, 0x47, 0xBB, 0xE8, 0x14, 0x4B, 0x41, 0x35, 0xD5, 0x70, 0xCA, 0xAF, 0x63, 0xB5, 0x42,
+    0x2C, 0xAD, 0xD0, 0x5D, 0x29, 0x8D, 0x4A, 0xF5, 0xD9, 0x8E, 0xB5, 0x95, 0xEA, 0x2B, 0xB5, 0x50,
+    0xA9, 0x2D, 0xAC, 0x9B, 0xAF, 0xB4, 0x4E, 0x86, 0x07, 0x0D, 0x55, 0xD9, 0x9A, 0x9D, 0xB2, 0x46,
+    0x67, 0xBE, 0x4F, 0xB7, 0x73, 0xF6, 0xEC, 0x35, 0xE8, 0x35, 0xAB, 0x16, 0x17, 0x6E, 0x79, 0xAB,
+    0x6E, 0xD7, 0x91, 0x16, 0x0F, 0xBF, 0xF0, 0xCA, 0x0E, 0xFD, 0x97, 0xBC, 0x53, 0x7F, 0xF0, 0xF9,
+    0x7F, 0xCD, 0x7C, 0x4D, 0x8C, 0xDD, 0x56, 0x96, 0xDE, 0xE5, 0xA3, 0x4A, 0x6C, 0x37, 0x27, 0x62,
+    0x05, 0x90, 0xE2, 0x19, 0x57, 0x4B, 0xEC, 0x45, 0x36, 0xE9, 0x91, 0xCD, 0x59, 0x38, 0x48, 0x0D,
+    0x50, 0x12, 0x29, 0x19, 0x19, 0x2D, 0x04, 0xC4, 0x5A, 0xA8, 0xBA, 0x17, 0x06, 0x22, 0x2F, 0x7A,
+    0x33, 0x46, 0x92, 0xF2, 0x42, 0x03, 0x08, 0x88, 0x2D, 0xD2, 0xD6, 0xA2, 0x17, 0xBD, 0x68, 0x6D,
+    0x32, 0xB3, 0x08, 0x02, 0x7B, 0xE1, 0x45, 0xBA, 0x34, 0x89, 0x04, 0x4C, 0x01, 0xA3, 0x24, 0xB2,
+    0x2E, 0x25, 0x2D, 0xBC, 0xE8, 0x85, 0x29, 0xDB, 0xDD, 0x0D, 0xA4, 0x91, 0x31, 0xED, 0x96, 0x3D,
+    0x63, 0x37, 0x10, 0xB1, 0xDD, 0x54, 0x9B, 0x55, 0x22, 0x79, 0xF3, 0x7D, 0xE7, 0xF2, 0xBD, 0x7A,
+    0xA5, 0x2A, 0xFD, 0x97, 0x9C, 0xA9, 0xAA, 0x7B, 0x58, 0x8F, 0x7C, 0xBC, 0xBC, 0xF7, 0xDC, 0xF3,
+    0x7F, 0xCE, 0xA5, 0x3A, 0xAE, 0x94, 0x32, 0x68, 0x51, 0xA6, 0x94, 0x57, 0xE0, 0x9F, 0xB7, 0x15,
+    0x7F, 0x52, 0x63, 0xEA, 0x39, 0x63, 0x1A, 0xB7, 0x55, 0x17, 0xD1, 0xE6, 0xD1, 0x9E, 0x47, 0x53,
+    0x93, 0x66, 0x4C, 0xEE, 0xF6, 0xCB, 0xC9, 0x86, 0x73, 0xAD, 0x7A, 0x0A, 0x6D, 0x2F, 0xDA, 0x81,
+    0xB9, 0x7E, 0xB9, 0x43, 0x1F, 0x5D, 0xE8, 0x16, 0x2A, 0xFE, 0x51, 0xA5, 0xA2, 0x23, 0xA5, 0xDA,
+    0xA1, 0x92, 0x6D, 0xED, 0x1B, 0xCD, 0x28, 0x4D, 0x70, 0x31, 0xA8, 0x02, 0x75, 0x21, 0xA8, 0x7C,
+    0x0B, 0x54, 0x50, 0xA9, 0x31, 0xF8, 0xED, 0x72, 0xA2, 0x02, 0x3C, 0x50, 0x05, 0xAB, 0x73, 0x2D,
+    0xCE, 0x8D, 0x7A, 0x00, 0xC7, 0x6C, 0x04, 0x3C, 0x87, 0x9E, 0x97, 0x56, 0xC3, 0xDA, 0x31, 0x86,
+    0xA8, 0xE0, 0x8F, 0xC6, 0x70, 0x3B, 0x3C, 0x1A, 0xFD, 0x78, 0xF6, 0x54, 0x6C, 0x4C, 0x15, 0xF6,
+    0xE7, 0xF8, 0xDD, 0x1A, 0x6D, 0x05, 0xED, 0xE4, 0x1D, 0xA3, 0xBC, 0x67, 0x9B, 0xEB, 0x13, 0xF4,
+    0x51, 0xDA, 0xEE, 0x23, 0x93, 0x8D, 0xFA, 0xF3, 0x95, 0x5F, 0x79, 0x75, 0x58, 0xB8, 0x75, 0x9C,
+    0x8F, 0x8A, 0x34, 0xB3, 0x4F, 0x35, 0x6C, 0xA6, 0xB2, 0x2D, 0xB1, 0xE7, 0x78, 0x2D, 0xCE, 0x71,
+    0x5B, 0xA9, 0xBE, 0x1B, 0x34, 0x78, 0xBE, 0x41, 0x47, 0xA9, 0xB1, 0x28, 0x95, 0xE1, 0x36, 0xCA,
+    0x5B, 0xD5, 0x49, 0x90, 0x47, 0x79, 0x94, 0x01, 0x66, 0xBB, 0x54, 0x84, 0x05, 0x0D, 0x1B, 0x60,
+    0xC1, 0x9C, 0x05, 0x56, 0x31, 0x00, 0x8D, 0xEF, 0xFB, 0x06, 0xBD, 0xA4, 0xC5, 0x0E, 0x15, 0x96,
+    0xCF, 0xA9, 0xA0, 0x8C, 0x55, 0x50, 0xC4, 0xB8, 0x2B, 0xFC, 0x2C, 0x55, 0x9E, 0x69, 0x86, 0x79,
+    0xE6, 0xA1, 0x21, 0xFE, 0x1F, 0xF0, 0x0F, 0xF3, 0xC2, 0x2D, 0xCF, 0xF9, 0x59, 0x1C, 0xE4, 0xF8,
+    0xDB, 0xE1, 0x3C, 0x7A, 0x27, 0xA1, 0xA9, 0x77, 0x62, 0xB4, 0x46, 0x3D, 0xC2, 0x1F, 0xD6, 0x11,
+    0xFD, 0xA4, 0xB5, 0x4A, 0x13, 0x12, 0x11, 0xF0, 0xE3, 0x80, 0x3C, 0x8E, 0x29, 0xB5, 0x30, 0xC2,
+    0x3A, 0xDE, 0x03, 0x1A, 0xA0, 0xE5, 0xD4, 0xA8, 0xD7, 0x15, 0x60, 0xE7, 0xB5, 0x84, 0x6E, 0xA7,
+    0x56, 0x46, 0x1D, 0xA8, 0xA5, 0x26, 0x74, 0x2A, 0xC0, 0xCE, 0x03, 0x74, 0x5B, 0x53, 0xE2, 0xBF,
+    0xC6, 0xE4, 0x4F, 0x1B, 0x5D, 0x6A, 0x0C, 0xB9, 0x1F, 0x96, 0x20, 0x35, 0xEF, 0x19, 0x59, 0xE3,
+    0x43, 0xE6, 0x86, 0x2C, 0x37, 0x57, 0xEB, 0x9E, 0x87, 0x7E, 0x59, 0x7F, 0x69, 0x47, 0x0A, 0xBC,
+    0xF3, 0xE4, 0x15, 0x63, 0xAF, 0xA5, 0x99, 0x1C, 0xE2, 0x7C, 0x8B, 0xC3, 0x70, 0xCD, 0xF0, 0x41,
+    0xFA, 0x66, 0x87, 0xC7, 0xFE, 0xD2, 0x52, 0x02, 0xF8, 0xC0, 0x72, 0x83, 0x65, 0x87, 0x81, 0x15,
+    0x2C, 0xB4, 0xCC, 0x30, 0x86, 0xE4, 0x09, 0x32, 0x05, 0x3E, 0x05, 0xAB, 0x61, 0xAB, 0x2C, 0xF5,
+    0x93, 0x39, 0xBA, 0xBB, 0xC3, 0xA5, 0xD5, 0x91, 0x49, 0xC0, 0x1D, 0x87, 0xC7, 0xF4, 0x6B, 0x7B,
+    0x0B, 0x31, 0x11, 0x75, 0x90, 0x1F, 0x57, 0xD4, 0x18, 0x0F, 0xD7, 0x4C, 0x39, 0xD7, 0x1F, 0x36,
+    0x67, 0xD1, 0xA9, 0xAC, 0x6C, 0x05, 0x00, 0x39, 0xE0, 0xB6, 0x01, 0x66, 0xDB, 0x3E, 0x4B, 0x04,
+    0xBC, 0x2B, 0x6C, 0x4E, 0x1C, 0x98, 0x0C, 0x1F, 0xD3, 0x1C, 0x00, 0x94, 0x8D, 0xAF, 0xD4, 0x00,
+    0x3E, 0x6F, 0xC3, 0x0A, 0xB8, 0xAD, 0xC3, 0x79, 0x26, 0xA6, 0x48, 0x4D, 0x11, 0xD6, 0x6A, 0x26,
+    0x19, 0x3F, 0xD6, 0x15, 0x42, 0x7D, 0x97, 0xE0, 0x99, 0xE1, 0xB9, 0xB1, 0x79, 0xC3, 0xF4, 0x61,
+    0x9F, 0xE8, 0x55, 0x3C, 0x32, 0x2C, 0xC7, 0x20, 0x22, 0xD0, 0x25, 0xBB, 0x02, 0xF0, 0xDE, 0x02,
+    0x08, 0x79, 0x61, 0x81, 0xA0, 0x02, 0x00, 0xCD, 0x01, 0xF0, 0xCB, 0xDD, 0xD4, 0x6D, 0x21, 0xA6,
+    0x90, 0xA4, 0xB7, 0x62, 0x73, 0x85, 0xC3, 0xE4, 0xCF, 0x81, 0x11, 0x1E, 0x7C, 0xDA, 0xAD, 0x95,
+    0x65, 0xE1, 0x9D, 0x3F, 0x1D, 0x9E, 0x6B, 0xCC, 0x0B, 0x18, 0x5F, 0xEF, 0xE8, 0x0C, 0x6C, 0x79,
+    0x50, 0x61, 0xEC, 0x0B, 0x0A, 0x5D, 0x9D, 0x52, 0x18, 0x3B, 0xEE, 0x30, 0x87, 0xF0, 0xE5, 0xF4,
+    0x2A, 0x38, 0x31, 0xFE, 0x10, 0xB8, 0x0A, 0x6F, 0x0B, 0xEE, 0x71, 0x9F, 0x47, 0xDA, 0x23, 0xDE,
+    0x95, 0x23, 0x93, 0xC1, 0x77, 0x1D, 0xC1, 0x2D, 0xF9, 0x53, 0x69, 0x35, 0x99, 0xD6, 0x9B, 0x10,
+    0xA3, 0x58, 0xEB, 0x46, 0xD6, 0xFD, 0xB1, 0x01, 0xA4, 0xA7, 0xAE, 0x21, 0xC8, 0x4C, 0x67, 0xE5,
+    0x8C, 0x7A, 0x9D, 0x4F, 0x59, 0x98, 0x80, 0xDD, 0x1C, 0x10, 0x47, 0xE5, 0xF6, 0x04, 0x1C, 0xA9,
+    0x4F, 0xF9, 0x13, 0x50, 0x00, 0xED, 0x23, 0xDD, 0xEE, 0xA7, 0x58, 0x59, 0x08, 0x31, 0xDE, 0x53,
+    0x5C, 0x8B, 0xCA, 0xC7, 0xF0, 0x6F, 0xBD, 0xD4, 0x2A, 0xB0, 0x11, 0xD6, 0xED, 0xE7, 0xDF, 0x07,
+    0x17, 0xE6, 0xE0, 0x46, 0x3F, 0x41, 0xFF, 0x58, 0x71, 0x9D, 0x2F, 0x9D, 0xC5, 0xC4, 0x4C, 0x0D,
+    0xE9, 0x02, 0x2A, 0xAD, 0x20, 0xFA, 0x49, 0x6E, 0xE3, 0x76, 0x61, 0x22, 0x20, 0xFB, 0x77, 0xAC,
+    0xE8, 0x6F, 0x43, 0x9C, 0xF7, 0x5A, 0x77, 0xD3, 0xAF, 0x5F, 0xCF, 0xF5, 0x24, 0x85, 0x1E, 0x48,
+    0x59, 0x4B, 0x54, 0x48, 0x86, 0xE5, 0x37, 0x49, 0x2C, 0x13, 0x8A, 0x71, 0x27, 0x1F, 0xC3, 0x92,
+    0xFD, 0x81, 0xBC, 0xBA, 0x25, 0x12, 0xD5, 0x88, 0x57, 0x95, 0xD9, 0x0C, 0x70, 0x61, 0xAE, 0x3F,
+    0xDF, 0x50, 0xBA, 0x67, 0xDB, 0x26, 0xE2, 0xC9, 0xD5, 0x95, 0x73, 0xF9, 0x1C, 0x64, 0xD9, 0x02,
+    0xA5, 0xD3, 0x56, 0x60, 0x7E, 0x02, 0x4E, 0x12, 0x5C, 0x20, 0xA8, 0x08, 0x4A, 0x0A, 0xB3, 0x82,
+    0x83, 0x23, 0x22, 0xA1, 0x7C, 0x8C, 0x5A, 0x5A, 0x5E, 0x36, 0x6F, 0x53, 0x52, 0x54, 0xA2, 0x92,
+    0x6A, 0x12, 0x4C, 0x35, 0x06, 0x17, 0x20, 0xE3, 0xD4, 0x77, 0xB7, 0x4D, 0xAF, 0xB6, 0x14, 0x65,
+    0x79, 0xD4, 0x84, 0x60, 0xE2, 0xCC, 0x25, 0x2A, 0xB0, 0xC2, 0xC0, 0xC6, 0x08, 0xD4, 0xB9, 0x00,
+    0x84, 0x93, 0x8C, 0xC1, 0xA9, 0xA4, 0x8C, 0x33, 0xED, 0x01, 0x92, 0xF2, 0x87, 0x64, 0x68, 0x8A,
+    0x14, 0x31, 0x25, 0x6E, 0xF7, 0x24, 0xAC, 0xF8, 0x1A, 0xD9, 0x5A, 0xE9, 0x33, 0x6D, 0x8C, 0xFB,
+    0x0C, 0x97, 0x55, 0x8D, 0x7A, 0xDC, 0xD7, 0xC8, 0x02, 0x61, 0xD9, 0x02, 0x0C, 0x15, 0x54, 0x96,
+    0x56, 0x64, 0xF1, 0xB3, 0x26, 0x4B, 0xF1, 0x50, 0x91, 0x50, 0x23, 0xB3, 0xAA, 0xC2, 0x35, 0x03,
+    0x91, 0x17, 0x95, 0x71, 0x12, 0x56, 0xA1, 0x30, 0x3D, 0xD6, 0x53, 0x45, 0xD4, 0x5D, 0xE8, 0x1B,
+    0x03, 0xFA, 0x1E, 0x56, 0x4B, 0x91, 0x0A, 0x21, 0x32, 0x94, 0xDF, 0xEC, 0x55, 0x7E, 0x7D, 0x10,
+    0xFF, 0xC7, 0x38, 0x17, 0x7D, 0xA6, 0x73, 0x8F, 0x04, 0xFE, 0x0D, 0x88, 0x85, 0x50, 0x5D, 0xA2,
+    0xF5, 0x44, 0xF9, 0x49, 0xED, 0xE9, 0x2C, 0x27, 0x4F, 0x5A, 0x1C, 0x3D, 0x39, 0x01, 0x6B, 0x89,
+    0x16, 0x4A, 0x64, 0x42, 0xB4, 0xFD, 0xD6, 0xE0, 0xD4, 0x46, 0xB0, 0x42, 0x50, 0x03, 0x38, 0x15,
+    0x80, 0x47, 0x60, 0x4A, 0x68, 0x63, 0x93, 0xEF, 0x34, 0xC7, 0x74, 0x12, 0x99, 0x6A, 0xD0, 0x0C,
+    0x90, 0x06, 0xDD, 0x1C, 0x06, 0x64, 0x6E, 0x61, 0x9E, 0x8E, 0x29, 0xDC, 0x9B, 0x05, 0xFE, 0x71,
+    0x3F, 0x2E, 0x5D, 0x9D, 0xBB, 0xEF, 0x57, 0x5E, 0x9A, 0xBB, 0x3F, 0xAB, 0x03, 0x48, 0xAA, 0xF7,
+    0xDA, 0x5D, 0x80, 0xD7, 0xDA, 0xFD, 0x80, 0x57, 0xBB, 0x05, 0xC0, 0x2B, 0x66, 0x1E, 0x30, 0x37,
+    0x17, 0x08, 0x75, 0x45, 0x98, 0x96, 0x84, 0xA2, 0x19, 0x61, 0xF4, 0x40, 0xB4, 0xDD, 0x08, 0x0F,
+    0xA5, 0x37, 0xD2, 0x36, 0x70, 0x4D, 0x4F, 0xF4, 0x8B, 0xD8, 0x24, 0xFA, 0xA3, 0xE2, 0xEE, 0x00,
+    0x53, 0x2E, 0xDC, 0x6E, 0x31, 0x2D, 0xEE, 0xFD, 0x3D, 0xA2, 0x1F, 0x62, 0xF3, 0xAA, 0xE9, 0xED,
+    0xF2, 0x2E, 0x61, 0x2E, 0xA3, 0x7E, 0xA9, 0xA2, 0x76, 0xE4, 0x75, 0xA0, 0x0B, 0xB2, 0x51, 0x27,
+    0x90, 0x92, 0x69, 0xA6, 0x33, 0x6A, 0xE8, 0x64, 0x33, 0x90, 0x0B, 0xF2, 0x15, 0xF9, 0xB2, 0xDC,
+    0x26, 0x1D, 0xB8, 0xDD, 0x4B, 0x35, 0x11, 0x94, 0x8D, 0x89, 0x87, 0xB6, 0x33, 0x24, 0xF5, 0xB6,
+    0x09, 0xFD, 0x43, 0x14, 0xFA, 0xD7, 0x68, 0x34, 0xAF, 0xAA, 0x39, 0x4E, 0x19, 0x84, 0x70, 0x37,
+    0x29, 0xEB, 0x76, 0x20, 0x50, 0xD8, 0x44, 0x6E, 0xB7, 0x95, 0x7C, 0x3B, 0x86, 0x61, 0x56, 0x0F,
+    0x66, 0xC2, 0x4E, 0xB5, 0xBB, 0x98, 0xB0, 0xD5, 0x78, 0xCE, 0x62, 0xBF, 0xA4, 0xE7, 0x7B, 0xAD,
+    0x5E, 0xF3, 0xEB, 0x40, 0x9D, 0xF4, 0x6B, 0xDF, 0x02, 0xB0, 0xB5, 0x7A, 0x14, 0x70, 0xA2, 0x13,
+    0x23, 0x3A, 0x7F, 0xD2, 0xFA, 0x79, 0xF8, 0xF1, 0x68, 0xFB, 0xA1, 0x23, 0x5E, 0x7B, 0x46, 0x7F,
+    0x61, 0xCD, 0xBA, 0x46, 0x85, 0x75, 0xFC, 0x26, 0x29, 0x23, 0x06, 0x4D, 0xE8, 0x2C, 0xCE, 0x48,
+    0x07, 0x71, 0x16, 0x15, 0x38, 0x97, 0x45, 0xE5, 0x00, 0xE5, 0x8C, 0xBD, 0x6A, 0xBF, 0x69, 0xEF,
+    0xF2, 0xA4, 0x07, 0xDB, 0xDB, 0xD0, 0xB3, 0x7D, 0x8A, 0xB3, 0x78, 0x9C, 0x24, 0x72, 0xC5, 0x14,
+    0x58, 0x00, 0x9D, 0x41, 0x84, 0x1E, 0xE0, 0x64, 0x4E, 0x61, 0x54, 0x59, 0x35, 0x3D, 0x0F, 0x5F,
+    0x54, 0x78, 0x37, 0xD1, 0xE3, 0x46, 0x54, 0xF8, 0x58, 0x7B, 0x57, 0xC0, 0xC7, 0x88, 0xD4, 0xED,
+    0xE5, 0x23, 0x28, 0x98, 0xD2, 0x33, 0x85, 0x69, 0x02, 0x53, 0x3D, 0x09, 0x8B, 0xE3, 0x0B, 0x52,
+    0xB4, 0xB0, 0xCE, 0x65, 0x82, 0xE7, 0x08, 0xF6, 0x11, 0xEC, 0x22, 0x78, 0x4A, 0x9B, 0x1F, 0x9B,
+    0x76, 0xA9, 0xFF, 0xD7, 0xE6, 0x06, 0x8C, 0x89, 0x34, 0xF3, 0xEA, 0x2D, 0x00, 0x2F, 0xD0, 0xBC,
+    0xCF, 0x5C, 0xF3, 0x7D, 0x8A, 0x10, 0x6A, 0xEB, 0x7F, 0xF6, 0x0E, 0x69, 0x4A, 0x6D, 0x01, 0x1C,
+    0xF3, 0x11, 0x27, 0x0C, 0x55, 0xF6, 0xBE, 0xF9, 0xBD, 0xE9, 0xE7, 0xFA, 0x3F, 0x33, 0xD7, 0x45,
+    0x16, 0x98, 0xC4, 0x8A, 0x60, 0x15, 0x16, 0x4F, 0xE0, 0x00, 0xB9, 0xBC, 0x6C, 0xBE, 0xD4, 0xB7,
+    0x48, 0xCE, 0x86, 0xA2, 0xFA, 0x1B, 0x7D, 0x7A, 0x61, 0x9F, 0xBE, 0x36, 0x3C, 0x7D, 0xB0, 0xC7,
+    0xC7, 0x7A, 0xCA, 0x1A, 0xED, 0x1B, 0x0E, 0x3B, 0x69, 0x4C, 0xC1, 0x6B, 0x58, 0x85, 0xD3, 0x40,
+    0xF5, 0x7A, 0x61, 0x02, 0xD4, 0x14, 0x80, 0xF7, 0x4C, 0x75, 0xCC, 0x8F, 0x60, 0xDF, 0xB0, 0x84,
+    0xD8, 0x0A, 0x4B, 0x5C, 0x9A, 0x06, 0x72, 0x2E, 0xCD, 0x9D, 0xF4, 0xB6, 0x21, 0xE9, 0xDF, 0x00,
+    0x43, 0x17, 0x0E, 0x67, 0x0E, 0x91, 0xCF, 0x89, 0xAB, 0x50, 0x7C, 0x0C, 0x51, 0x66, 0x77, 0x42,
+    0x8C, 0x01, 0xB0, 0xD7, 0x25, 0xCF, 0xF8, 0x35, 0x21, 0xAD, 0xB7, 0xBB, 0xC3, 0xA0, 0x26, 0xA2,
+    0xC1, 0xD5, 0xC0, 0x73, 0xEF, 0x10, 0xCD, 0x85, 0x18, 0x5E, 0x5B, 0x1A, 0x65, 0xE8, 0x9D, 0x7D,
+    0x8B, 0x60, 0x6B, 0xB7, 0xFA, 0x0D, 0x26, 0x66, 0xA5, 0xB5, 0x3D, 0x1A, 0x78, 0x45, 0x90, 0xCD,
+    0x79, 0x48, 0xBF, 0x18, 0x9E, 0x14, 0x28, 0x6F, 0xBA, 0xC7, 0x18, 0x86, 0xC5, 0x33, 0xE7, 0x36,
+    0x88, 0xC6, 0x7D, 0xCA, 0x83, 0xDD, 0x11, 0x54, 0xB0, 0x55, 0x0A, 0xD8, 0x1E, 0xC9, 0xD8, 0x8F,
+    0x9E, 0x78, 0x44, 0xB9, 0x0F, 0x95, 0x8A, 0x11, 0xEA, 0x73, 0x8D, 0x35, 0x38, 0x69, 0x77, 0x0E,
+    0x14, 0x0D, 0xD3, 0x86, 0x8C, 0x82, 0x03, 0x55, 0x0D, 0x18, 0x93, 0x33, 0x84, 0x88, 0x04, 0xC2,
+    0xE8, 0xD8, 0xE1, 0x80, 0xD1, 0x0B, 0xFA, 0xC2, 0xE1, 0x60, 0xBF, 0x32, 0xDC, 0x30, 0xDC, 0x8E,
+    0xCE, 0x62, 0x74, 0x36, 0xA2, 0x49, 0xCB, 0x07, 0xFD, 0x55, 0xCB, 0x15, 0x08, 0x4D, 0x31, 0x19,
+    0xC5, 0x4E, 0x71, 0x13, 0x6F, 0x1B, 0x18, 0xE3, 0x50, 0xCD, 0xA3, 0x4E, 0xBC, 0xE5, 0x0D, 0x00,
+    0x7E, 0x2E, 0x70, 0x60, 0xDE, 0xE8, 0x29, 0xD9, 0x7B, 0xAE, 0x39, 0x40, 0x7C, 0x1D, 0x20, 0xBD,
+    0xC2, 0x0B, 0x87, 0xA0, 0xE0, 0x79, 0xAF, 0xCB, 0x7B, 0xC3, 0xC6, 0x83, 0xE0, 0x82, 0x04, 0x2A,
+    0xD5, 0x2B, 0x67, 0x15, 0xAD, 0xAD, 0x00, 0x52, 0x2D, 0xC8, 0xD3, 0xC4, 0xC9, 0x52, 0x0A, 0xFB,
+    0x04, 0x86, 0x44, 0x12, 0xAC, 0x51, 0xCB, 0xA5, 0x09, 0xB4, 0x1E, 0x1A, 0xDC, 0x65, 0xC8, 0xBF,
+    0xE8, 0xB6, 0x2E, 0xFC, 0x3E, 0xAA, 0xD6, 0x11, 0x34, 0x97, 0x51, 0x0D, 0x40, 0xDE, 0x89, 0x0D,
+    0x15, 0xDF, 0xB0, 0x4E, 0xC9, 0x0A, 0xFA, 0xFD, 0x1B, 0xF4, 0x7B, 0x3B, 0xD7, 0x8A, 0x32, 0xD2,
+    0x88, 0xDB, 0x1B, 0x4D, 0x9A, 0xA6, 0x2E, 0x15, 0xD9, 0x9A, 0x26, 0xC1, 0x67, 0x18, 0x3E, 0xE9,
+    0x14, 0x3F, 0x7B, 0x16, 0x8F, 0xD1, 0x11, 0xCE, 0xFC, 0x3A, 0x2A, 0xBD, 0x3A, 0xA8, 0x6C, 0x0B,
+    0x0B, 0xAF, 0xBF, 0x8C, 0x95, 0x31, 0x89, 0xFD, 0xEC, 0xD7, 0x5E, 0x4D, 0xE8, 0x57, 0xE1, 0x1A,
+    0x1C, 0x79, 0xB8, 0xF1, 0x7B, 0x16, 0x17, 0x79, 0x1F, 0xD4, 0x47, 0x88, 0xF5, 0xF4, 0x86, 0xE6,
+    0xA0, 0xA9, 0x4D, 0x8D, 0x2A, 0x26, 0x84, 0x86, 0xD1, 0x50, 0x06, 0x33, 0x8B, 0x8B, 0xC7, 0x61,
+    0xFA, 0xB6, 0x0E, 0x8C, 0x12, 0xC5, 0x56, 0xDA, 0xE6, 0x14, 0xB6, 0x8D, 0x72, 0x6B, 0xA6, 0x78,
+    0x90, 0xEF, 0x3E, 0x30, 0x70, 0x7E, 0x59, 0xFF, 0x03, 0xB8, 0xB3, 0x05, 0xE9, 0x5C, 0x02, 0x12,
+    0x16, 0xD0, 0xF6, 0x83, 0xCF, 0xBE, 0x03, 0xA4, 0x7D, 0x4B, 0x3D, 0x73, 0x16, 0xF3, 0xE8, 0x94,
+    0x5F, 0xA6, 0x70, 0xAD, 0x63, 0x31, 0x6B, 0x00, 0x0B, 0x88, 0xCF, 0x22, 0xFE, 0x72, 0x99, 0x66,
+    0x83, 0x55, 0xA1, 0x85, 0x78, 0xED, 0x99, 0xD7, 0x43, 0xB1, 0xEA, 0xD6, 0xCE, 0xFB, 0xD8, 0xE2,
+    0xB1, 0x45, 0x18, 0x89, 0xE6, 0x96, 0x29, 0x7C, 0x3C, 0xF7, 0x75, 0xE5, 0x60, 0x14, 0x18, 0xE8,
+    0xC5, 0x98, 0xEA, 0xED, 0x40, 0xFC, 0x1E, 0x6F, 0xD6, 0x37, 0x73, 0x89, 0x13, 0xD0, 0x26, 0x8F,
+    0xDF, 0xA7, 0x31, 0x18, 0xBF, 0x07, 0x15, 0xD0, 0xC4, 0x57, 0x3B, 0x52, 0x30, 0x30, 0x9B, 0x96,
+    0xC0, 0x47, 0x61, 0x0E, 0x99, 0x3A, 0xAC, 0x60, 0xCE, 0x82, 0xFD, 0x63, 0xB7, 0x3D, 0xE8, 0x74,
+    0x33, 0x4E, 0xA7, 0x40, 0x5F, 0xE7, 0x61, 0xB4, 0x94, 0x8A, 0x21, 0x01, 0xB3, 0x5F, 0x99, 0x03,
+    0xAA, 0x8F, 0x8F, 0xB4, 0xBE, 0x28, 0xC6, 0x3D, 0x8B, 0x7B, 0x88, 0xC1, 0xD8, 0x24, 0x7E, 0x03,
+    0x39, 0x4E, 0xFC, 0x2A, 0xA2, 0x18, 0x20, 0x22, 0xF8, 0x5F, 0x00, 0x5F, 0xFF, 0x12, 0xC0, 0x1C,
+    0x01, 0x68, 0xE5, 0x2A, 0x00, 0x57, 0x02, 0xC8, 0x0C, 0x3B, 0xB9, 0x77, 0xB0, 0x80, 0x56, 0x60,
+    0xCA, 0xAA, 0x26, 0xC0, 0x58, 0x7B, 0x8A, 0xF3, 0xB9, 0xD5, 0x81, 0x54, 0xB6, 0xE7, 0x19, 0xE8,
+    0xE5, 0x38, 0xFE, 0x69, 0x7D, 0x3C, 0x01, 0xE4, 0x80, 0xEF, 0x2C, 0xA0, 0x55, 0x12, 0x00, 0xA3,
+    0x8E, 0xF5, 0x6E, 0x41, 0xFD, 0xD6, 0x24, 0x15, 0x2C, 0x19, 0xC8, 0x28, 0xEC, 0x82, 0x46, 0x9B,
+    0x51, 0x3F, 0x5E, 0x6A, 0x55, 0x61, 0x01, 0x2A, 0x38, 0x23, 0xD3, 0xAD, 0x8C, 0x72, 0x07, 0x6D,
+    0x54, 0x44, 0xB9, 0x87, 0x06, 0x67, 0x26, 0x87, 0x4F, 0x73, 0xE3, 0xB2, 0x63, 0x4D, 0x83, 0x3D,
+    0xC7, 0x41, 0x29, 0x89, 0xEE, 0x41, 0xE3, 0x10, 0x07, 0x2A, 0xC4, 0x53, 0x40, 0xD5, 0x80, 0x69,
+    0xFE, 0xAF, 0x00, 0x97, 0x8A, 0xBF, 0x01, 0x3C, 0x51, 0xFE, 0x1A, 0xF0, 0xC5, 0xAF, 0xAE, 0x01,
+    0x1E, 0xB9, 0x7D, 0x06, 0xF0, 0x05, 0xF3, 0x02, 0xE0, 0x61, 0xF8, 0x4F, 0xF0, 0xA8, 0x3B, 0xBA,
+    0x02, 0xC5, 0xA5, 0xB9, 0x2E, 0xD1, 0xD5, 0xA9, 0xD8, 0xE4, 0x5B, 0x63, 0x63, 0x02, 0xFA, 0xF3,
+    0x44, 0x84, 0xA9, 0xEF, 0xBC, 0xB0, 0x11, 0x1B, 0x89, 0x25, 0xBA, 0x5E, 0xF9, 0x15, 0x85, 0x5E,
+    0x80, 0xB1, 0x93, 0x10, 0xD8, 0xFC, 0xA1, 0xD9, 0xCF, 0x38, 0x5F, 0x06, 0x65, 0x08, 0x8C, 0xA5,
+    0x34, 0xE4, 0x87, 0xF5, 0xB0, 0x5C, 0x43, 0xB6, 0x91, 0x55, 0xF0, 0xAB, 0x07, 0x01, 0xE4, 0x3B,
+    0x8E, 0x60, 0x55, 0x46, 0xA0, 0x16, 0x93, 0x3F, 0x57, 0xFA, 0xEF, 0x4D, 0x11, 0xF4, 0x27, 0x6A,
+    0x1F, 0xB2, 0x8C, 0xA2, 0xDA, 0xAF, 0x47, 0xAD, 0x5F, 0x8D, 0xBA, 0xA1, 0x89, 0xF8, 0xF6, 0x1B,
+    0xFA, 0x2E, 0xB8, 0x6E, 0x60, 0x75, 0x7E, 0x05, 0x16, 0x07, 0xEF, 0x4C, 0x37, 0xF4, 0x87, 0x0E,
+    0x41, 0x2F, 0xC3, 0x8C, 0x82, 0x2A, 0x4D, 0x28, 0xC6, 0xA3, 0xFC, 0x80, 0x1A, 0xB3, 0xCE, 0x74,
+    0x8B, 0x0A, 0x07, 0xDF, 0xF1, 0x12, 0xB0, 0x11, 0x44, 0x5B, 0x33, 0x9E, 0x51, 0x82, 0x09, 0x15,
+    0xE4, 0x1A, 0x38, 0x1B, 0x6C, 0xE5, 0x96, 0x37, 0x0F, 0xCD, 0xD1, 0x1F, 0x49, 0x70, 0x75, 0x71,
+    0x71, 0xE6, 0xB8, 0xE9, 0x03, 0x46, 0x2F, 0x4A, 0xB0, 0x66, 0xEE, 0x35, 0x2E, 0x04, 0xB2, 0x9F,
+    0x8C, 0x3A, 0x28, 0xDB, 0x1E, 0x76, 0x8E, 0xDE, 0x8F, 0xEF, 0xC3, 0x59, 0x8C, 0xEB, 0xC1, 0x6F,
+    0x05, 0xCF, 0xD0, 0x97, 0x86, 0x93, 0xAF, 0xBC, 0x44, 0x74, 0xF2, 0x2E, 0x88, 0xD9, 0xA0, 0xB5,
+    0x73, 0xB1, 0x7A, 0xDA, 0x88, 0xE4, 0x56, 0x43, 0x94, 0x7E, 0x1D, 0x30, 0x48, 0x4A, 0x1B, 0x28,
+    0xF1, 0x1A, 0x8D, 0x35, 0x2B, 0x35, 0xE8, 0x3F, 0xD7, 0x60, 0xE6, 0x5C, 0x8F, 0x04, 0x74, 0x1B,
+    0x00, 0xB4, 0x46, 0xA1, 0xDD, 0x26, 0xA8, 0x34, 0xD1, 0x69, 0x60, 0x4C, 0x2E, 0x89, 0x7F, 0xBC,
+    0x45, 0xCF, 0x33, 0xEC, 0x19, 0x66, 0x20, 0x10, 0x31, 0x73, 0x3C, 0x36, 0x6F, 0x75, 0x7E, 0xE7,
+    0x96, 0xA3, 0x9E, 0x51, 0x88, 0x17, 0x31, 0xF8, 0xD6, 0x3A, 0xDC, 0xB0, 0x1D, 0x55, 0x8C, 0x1E,
+    0x56, 0x8C, 0x1A, 0x41, 0xCA, 0x78, 0xF0, 0xD4, 0x97, 0xCA, 0xB4, 0x33, 0x8D, 0x31, 0x13, 0xA2,
+    0x84, 0x57, 0x1E, 0x3C, 0x2C, 0x49, 0xAC, 0x9D, 0x5F, 0x13, 0x72, 0xA2, 0xC9, 0x1B, 0x49, 0xB8,
+    0x8F, 0x80, 0xE8, 0x51, 0x2E, 0xC1, 0x48, 0x2D, 0x1E, 0xDF, 0xB3, 0xA8, 0xBB, 0xB4, 0x87, 0x6A,
+    0xDE, 0xF4, 0xEB, 0x75, 0x4B, 0xD5, 0x88, 0x5E, 0xC5, 0x1E, 0x06, 0x0C, 0xC6, 0x6D, 0x69, 0x95,
+    0xA8, 0x22, 0xCF, 0x2F, 0x82, 0xEB, 0x75, 0x67, 0x40, 0x47, 0x61, 0x15, 0x17, 0xE0, 0x7C, 0xF0,
+    0xEB, 0x83, 0x43, 0x5F, 0x20, 0x87, 0xA8, 0x6F, 0x70, 0x8C, 0xA6, 0xDB, 0xD6, 0x3E, 0xFF, 0xC1,
+    0xF6, 0xA9, 0x26, 0x91, 0x4D, 0xF5, 0xAC, 0xC0, 0xBD, 0x02, 0xFF, 0x89, 0xC0, 0x1D, 0x7B, 0x68,
+    0xFB, 0x6B, 0x92, 0xEA, 0x45, 0x7A, 0x04, 0x17, 0xE2, 0x6C, 0x00, 0x2A, 0x3E, 0x2B, 0x8E, 0x23,
+    0xE3, 0x93, 0x7F, 0x85, 0x4E, 0xA8, 0x2F, 0xEF, 0x00, 0x8E, 0xFE, 0x0D, 0x85, 0x0E, 0x64, 0x35,
+    0x16, 0x88, 0xB2, 0x08, 0xFA, 0x19, 0xAA, 0x02, 0x5E, 0x40, 0x4F, 0xA5, 0x06, 0xF1, 0x3E, 0xC0,
+    0x5B, 0x02, 0x61, 0x5A, 0x01, 0xAE, 0xA6, 0x57, 0x78, 0x3E, 0xFC, 0x84, 0x30, 0xF8, 0xAD, 0x40,
+    0xFC, 0x0F, 0x25, 0x79, 0xBD, 0xC3, 0x72, 0xE9, 0xF7, 0x0C, 0xFA, 0xE9, 0xD0, 0x0F, 0xFA, 0xB4,
+    0xF9, 0x85, 0x66, 0x4A, 0x55, 0xDE, 0xA2, 0xCF, 0xD2, 0xB3, 0x17, 0xCC, 0x37, 0x1C, 0xAB, 0xE3,
+    0x12, 0x77, 0x17, 0xB8, 0x37, 0xC7, 0x9D, 0xCA, 0x59, 0xA6, 0x89, 0x09, 0x2B, 0x06, 0xBA, 0xE5,
+    0xA0, 0xEA, 0xD5, 0x53, 0x42, 0x85, 0x68, 0x8B, 0x0C, 0xEA, 0x0F, 0xFF, 0xA3, 0xED, 0xC7, 0xB5,
+    0x03, 0x0E, 0xEC, 0x2F, 0x08, 0xF6, 0x60, 0x50, 0x13, 0x78, 0xE6, 0x2B, 0x54, 0xC2, 0x3E, 0xA6,
+    0xED, 0x37, 0x91, 0x8C, 0x34, 0x4E, 0x34, 0xA0, 0x86, 0x01, 0x02, 0x09, 0x4E, 0xC7, 0xA1, 0xA7,
+    0x9B, 0x45, 0xE3, 0x02, 0xD0, 0x9E, 0x19, 0xAE, 0xA6, 0xB0, 0x99, 0xFD, 0x3A, 0xCE, 0x7A, 0x4A,
+    0xA2, 0x5F, 0xC0, 0x82, 0x36, 0xA3, 0x49, 0x70, 0x1B, 0x5D, 0x1F, 0x87, 0xFD, 0x05, 0x02, 0x16,
+    0xF5, 0x9B, 0x41, 0x11, 0x67, 0x3C, 0x42, 0x12, 0xB2, 0xAF, 0xCC, 0xE9, 0xE1, 0x78, 0xB5, 0x71,
+    0xC6, 0xFB, 0x29, 0x1D, 0xD3, 0x2B, 0xFA, 0xA3, 0xDE, 0xB5, 0x92, 0x7E, 0xD4, 0x0E, 0x0E, 0x62,
+    0x88, 0x51, 0x8E, 0x72, 0xDB, 0xDF, 0x63, 0x28, 0x76, 0xA7, 0x3C, 0xA5, 0xDC, 0xAA, 0x43, 0xC3,
+    0xE7, 0x64, 0xF6, 0xB1, 0xFB, 0x4B, 0x29, 0x80, 0x86, 0x15, 0x4A, 0x81, 0xB9, 0xB9, 0xD5, 0x63,
+    0xC3, 0x8A, 0xC1, 0x74, 0xBD, 0x6D, 0x4A, 0xAF, 0x0F, 0x2B, 0xAF, 0xF5, 0x27, 0x46, 0xD2, 0x56,
+    0xBF, 0x61, 0x07, 0xFC, 0x51, 0xC7, 0x5A, 0x73, 0x68, 0xE0, 0x34, 0xFA, 0x0B, 0x5C, 0x9A, 0x77,
+    0xEC, 0x18, 0x19, 0xA5, 0xA7, 0x94, 0x23, 0x23, 0xCF, 0x8F, 0xD1, 0xFA, 0x68, 0x46, 0xD6, 0xBA,
+    0x44, 0x8F, 0x07, 0x89, 0xFE, 0x2F, 0xAC, 0x00, 0xFE, 0x39, 0xE3, 0xAD, 0xF9, 0x3D, 0x25, 0x3A,
+    0x68, 0xC4, 0x37, 0x55, 0x74, 0xA8, 0x89, 0x15, 0x56, 0x8B, 0xC1, 0xC3, 0xD0, 0xE4, 0x1E, 0x26,
+    0x9E, 0xB6, 0x3B, 0x46, 0xED, 0x82, 0x6A, 0x0F, 0xA8, 0x36, 0x3E, 0x5C, 0xFB, 0x63, 0x63, 0xD9,
+    0xAB, 0x28, 0xE2, 0x38, 0xA7, 0xC4, 0xDA, 0x55, 0x4A, 0x53, 0x67, 0x2A, 0xEF, 0x2E, 0x7F, 0x3E,
+    0x95, 0xA9, 0xD0, 0xBE, 0x52, 0xA7, 0x63, 0xA5, 0xE3, 0x04, 0x70, 0xC7, 0x8E, 0x87, 0xBD, 0xD7,
+    0x69, 0xDD, 0x0E, 0xA4, 0x83, 0xF5, 0x9D, 0x39, 0x1E, 0x75, 0x30, 0xD0, 0xEF, 0xF2, 0x3B, 0x62,
+    0xF4, 0xB4, 0x59, 0x2A, 0x2F, 0x27, 0x34, 0x47, 0x24, 0xEC, 0xCA, 0x75, 0xA5, 0xE5, 0x79, 0x27,
+    0xFC, 0x48, 0x20, 0x65, 0x42, 0x19, 0xFF, 0xA2, 0x17, 0x7B, 0x50, 0xC3, 0xE7, 0xA7, 0x35, 0xEE,
+    0x15, 0xB4, 0xC7, 0x19, 0x63, 0x35, 0x58, 0x32, 0xFD, 0x9B, 0x4E, 0x5D, 0x1E, 0x99, 0x09, 0xF9,
+    0x8B, 0x0C, 0xB7, 0x42, 0xDC, 0x4A, 0x71, 0x2B, 0xA3, 0x37, 0x42, 0x48, 0xAB, 0x55, 0xE5, 0x41,
+    0x74, 0xC1, 0x76, 0xC7, 0x99, 0xA8, 0x20, 0x24, 0x93, 0x13, 0xFA, 0x72, 0x06, 0x8C, 0x85, 0xAB,
+    0xEC, 0x67, 0x95, 0x88, 0xB0, 0x74, 0x67, 0x03, 0x34, 0x9A, 0x51, 0xA4, 0xA5, 0xB5, 0xB7, 0xED,
+    0x5A, 0x0B, 0xF1, 0xC1, 0x74, 0xC3, 0x1A, 0x78, 0x1D, 0xB4, 0xA3, 0x07, 0x5D, 0x75, 0x7F, 0x85,
+    0x41, 0xE4, 0xF9, 0xB4, 0x21, 0x8E, 0x9A, 0xB1, 0xAF, 0x65, 0x93, 0xB6, 0xA3, 0x7A, 0x92, 0xB4,
+    0x7D, 0x54, 0x5B, 0x6F, 0xC8, 0xEE, 0x48, 0x38, 0x8E, 0x3D, 0xF9, 0xA4, 0x0E, 0xA7, 0xDA, 0x56,
+    0x3B, 0x74, 0x30, 0x75, 0x95, 0x53, 0x07, 0x99, 0x22, 0x87, 0xCE, 0x59, 0x8A, 0x7D, 0x12, 0xB6,
+    0xC4, 0x63, 0xAA, 0xE5, 0xD5, 0x21, 0xB9, 0x28, 0x6B, 0xE7, 0x92, 0x4E, 0x46, 0x44, 0x88, 0x15,
+    0x6F, 0xEB, 0x59, 0x68, 0x71, 0xEA, 0x31, 0xBB, 0x5A, 0x9C, 0xDC, 0xB7, 0x18, 0x5F, 0x8E, 0x19,
+    0x48, 0x84, 0x6B, 0x97, 0x01, 0xA7, 0x3A, 0x09, 0x98, 0xCD, 0x48, 0xB3, 0x80, 0xD9, 0x21, 0x18,
+    0x95, 0x8C, 0x59, 0xC5, 0x45, 0x40, 0xE6, 0x8D, 0xCB, 0x7D, 0x3C, 0xE8, 0xEA, 0x00, 0xD9, 0xD8,
+    0x54, 0x0B, 0xE8, 0xED, 0xD3, 0x5F, 0x55, 0x2B, 0x98, 0xC6, 0xAF, 0xDF, 0xAB, 0x39, 0xC9, 0xAF,
+    0xCF, 0xAC, 0x15, 0x8C, 0xEA, 0xB8, 0xC4, 0x9C, 0xD7, 0x8F, 0x8C, 0x44, 0xE8, 0x9C, 0xDE, 0x8A,
+    0x1A, 0xCC, 0xF5, 0xDB, 0xC9, 0x9E, 0x64, 0x67, 0xA2, 0x61, 0xA3, 0x06, 0xF9, 0x89, 0x3A, 0x80,
+    0x1B, 0xE4, 0x36, 0x7E, 0xE9, 0x16, 0xA3, 0xD6, 0x03, 0x16, 0x55, 0xE7, 0xD6, 0x80, 0xFD, 0xA8,
+    0x01, 0x69, 0xC0, 0x4C, 0xF2, 0x13, 0x95, 0xBA, 0xC4, 0x68, 0xFC, 0xE2, 0x65, 0x28, 0xD9, 0xE8,
+    0xAF, 0xD3, 0x79, 0x12, 0x68, 0x2C, 0xC2, 0x8C, 0x61, 0xB2, 0x20, 0x87, 0xE4, 0x92, 0x98, 0x9B,
+    0xC3, 0x9C, 0xAE, 0x08, 0x98, 0x57, 0xF4, 0x97, 0x19, 0x51, 0x51, 0xA8, 0x95, 0xF8, 0x6A, 0xA9,
+    0xC4, 0x3A, 0x94, 0x0B, 0x10, 0x43, 0xF8, 0x4E, 0xFC, 0x1B, 0xA3, 0xC6, 0x81, 0xDE, 0x98, 0x62,
+    0x09, 0xFD, 0x8C, 0x41, 0x2E, 0x17, 0x1C, 0xFD, 0x0B, 0x89, 0xED, 0xDD, 0x10, 0x86, 0x08, 0x07,
+    0x39, 0x37, 0xDD, 0xC8, 0x19, 0x2F, 0x41, 0x26, 0x6F, 0x38, 0xDF, 0xFF, 0x14, 0x13, 0x87, 0xB6,
+    0x86, 0x06, 0x25, 0xE1, 0xDB, 0xDF, 0xA0, 0x0A, 0x57, 0x75, 0xA1, 0x27, 0x39, 0x68, 0x86, 0x1A,
+    0x28, 0xF5, 0xE6, 0xFA, 0x04, 0x7C, 0xC7, 0x4C, 0x0F, 0xDC, 0xEE, 0x0C, 0xB8, 0xE9, 0x55, 0x84,
+    0x03, 0xA4, 0xCB, 0x3E, 0x60, 0x4A, 0x82, 0x9A, 0x6E, 0xE3, 0x4D, 0x1F, 0x8C, 0xB1, 0xA9, 0xB2,
+    0x97, 0xBA, 0x45, 0x39, 0xD9, 0x4C, 0x7F, 0x65, 0xB8, 0x41, 0xB2, 0xE5, 0xE8, 0x0C, 0x96, 0x04,
+    0x23, 0x71, 0x3A, 0xF3, 0x32, 0x78, 0x22, 0x11, 0x03, 0xB7, 0x26, 0x1F, 0xAD, 0xC7, 0x3C, 0x40,
+    0x67, 0xCF, 0xBC, 0x83, 0x59, 0x38, 0x74, 0xE8, 0x1B, 0x7A, 0x0B, 0x7E, 0x15, 0x94, 0x31, 0x60,
+    0x58, 0x3C, 0xA7, 0x08, 0x31, 0x9F, 0x35, 0xFD, 0xE5, 0x59, 0xCE, 0x08, 0x22, 0x87, 0x82, 0x42,
+    0x8D, 0xCF, 0x57, 0x24, 0x65, 0x1F, 0x73, 0x74, 0x93, 0xB0, 0x73, 0x21, 0xC5, 0xB5, 0x19, 0xEB,
+    0x2D, 0x35, 0xA8, 0x55, 0x87, 0xD2, 0x72, 0x44, 0x1A, 0x70, 0xE9, 0xCC, 0x7A, 0x27, 0xB8, 0x54,
+    0x54, 0x3F, 0xBB, 0x48, 0xEB, 0xCF, 0x72, 0xEC, 0x31, 0x17, 0xED, 0x3F, 0xAE, 0x61, 0xC0, 0x5F,
+    0xD5, 0x3D, 0x01, 0xCC, 0xD4, 0x0F, 0xEA, 0x34, 0x73, 0xAF, 0x82, 0xCB, 0xBD, 0x37, 0xEB, 0xA8,
+    0x08, 0x0E, 0xC3, 0x1E, 0x59, 0xBA, 0x5A, 0xA7, 0xAB, 0xE6, 0xD3, 0x1A, 0xCF, 0x98, 0x61, 0x0E,
+    0x2D, 0x10, 0x11, 0xC5, 0x89, 0x1C, 0xE4, 0x23, 0x4F, 0x91, 0xB2, 0x2E, 0xF0, 0x91, 0x10, 0x62,
+    0xCC, 0x6F, 0xE6, 0xCA, 0xFD, 0xF8, 0x2D, 0x48, 0xA8, 0x13, 0x3F, 0x81, 0x8A, 0x08, 0x7F, 0x54,
+    0xAB, 0x7D, 0x21, 0x7C, 0xB4, 0x34, 0xFC, 0x71, 0xAF, 0xCC, 0x5B, 0x3F, 0x91, 0x0C, 0x96, 0xE2,
+    0x2C, 0x24, 0x0B, 0x58, 0xDA, 0xF0, 0x50, 0x5A, 0x59, 0x45, 0xF8, 0xB7, 0xB5, 0x3D, 0xFE, 0xAE,
+    0x95, 0xA3, 0xF3, 0xA9, 0x3D, 0xBA, 0x0C, 0xAD, 0xE0, 0xE8, 0xE5, 0x66, 0x58, 0x06, 0xCC, 0xCE,
+    0xED, 0x16, 0x97, 0x34, 0x73, 0x36, 0x8D, 0xDA, 0x97, 0xC6, 0x72, 0x5C, 0x48, 0x99, 0xCF, 0xE4,
+    0x11, 0x33, 0xC5, 0x71, 0x25, 0x05, 0x59, 0xE0, 0x58, 0xA5, 0x1E, 0x63, 0x4A, 0x4E, 0x95, 0xB2,
+    0x86, 0xA2, 0x3B, 0x52, 0xA7, 0xBE, 0x49, 0x52, 0x73, 0xB3, 0x4D, 0x43, 0xFA, 0x87, 0xCC, 0x99,
+    0x63, 0x76, 0x51, 0x49, 0x8B, 0x1D, 0x94, 0x0D, 0x0C, 0xFD, 0xAD, 0xE8, 0x36, 0x0C, 0xC3, 0xAF,
+    0x1C, 0xD8, 0x70, 0xFE, 0xDA, 0xB9, 0x2F, 0x8D, 0xAC, 0x04, 0x64, 0x59, 0xE5, 0xC7, 0xF4, 0xF8,
+    0x76, 0xC5, 0xB0, 0x4C, 0xAB, 0xFD, 0x31, 0x2C, 0xB5, 0x6A, 0x21, 0x06, 0x95, 0x55, 0xEF, 0xC6,
+    0x61, 0xA7, 0xBF, 0x32, 0x31, 0xC4, 0x87, 0x11, 0x7D, 0x63, 0x21, 0x7C, 0xF3, 0x15, 0x51, 0xBA,
+    0xA5, 0x98, 0x19, 0x52, 0xDC, 0xC0, 0xD8, 0xA2, 0xD3, 0x8B, 0xED, 0xAA, 0x2F, 0x4A, 0xD8, 0x99,
+    0x4B, 0x95, 0xDE, 0xBC, 0x09, 0x04, 0x98, 0x00, 0x9E, 0xAD, 0xD3, 0x05, 0x57, 0x98, 0x7B, 0x0A,
+    0x72, 0x4A, 0x5E, 0x86, 0x8C, 0xB0, 0xEA, 0xB0, 0xAF, 0xE0, 0x5D, 0xC2, 0x8E, 0x49, 0xF3, 0xA5,
+    0x1B, 0x01, 0xE4, 0xB1, 0x61, 0x8A, 0x10, 0xDE, 0x25, 0x8B, 0x0E, 0x18, 0xC6, 0x5F, 0x3C, 0x41,
+    0x41, 0x7C, 0x80, 0xB2, 0x0E, 0x8F, 0xF4, 0x7E, 0x4F, 0x34, 0x83, 0x89, 0x78, 0x15, 0x78, 0xE8,
+    0xB1, 0xAC, 0x75, 0x0F, 0x4F, 0xA8, 0xEA, 0xD1, 0x4D, 0x61, 0xFC, 0x2A, 0xBD, 0x6A, 0xCE, 0x74,
+    0xBD, 0x67, 0x72, 0x9D, 0xB2, 0xAC, 0x84, 0x83, 0x20, 0x5B, 0x58, 0x3A, 0x67, 0x29, 0x10, 0x85,
+    0xA4, 0x2B, 0x85, 0x17, 0x0B, 0x76, 0x45, 0x7A, 0xCE, 0x85, 0x4B, 0xA4, 0x99, 0x13, 0xE0, 0x3F,
+    0xF1, 0xB5, 0x7C, 0xB0, 0x62, 0xCC, 0x98, 0x49, 0xA4, 0xB8, 0xA3, 0x5B, 0x3C, 0x71, 0xBB, 0xB7,
+    0xEB, 0x16, 0x7E, 0xD0, 0xB0, 0xDC, 0x04, 0xC8, 0xBD, 0xDA, 0xD8, 0x95, 0x4A, 0x0F, 0x37, 0xA0,
+    0x01, 0xF2, 0xC9, 0xA8, 0xB1, 0x6B, 0x05, 0x89, 0xE3, 0x33, 0x47, 0x37, 0x6A, 0x47, 0x0D, 0x3E,
+    0xCE, 0x75, 0x47, 0x1B, 0x8F, 0xB5, 0x25, 0x58, 0xA6, 0x52, 0x42, 0xF8, 0x7B, 0x16, 0x1D, 0xEB,
+    0x47, 0xF3, 0x11, 0x58, 0x29, 0xA7, 0x5F, 0xFC, 0x0F, 0x5C, 0x24, 0xAD, 0x4E, 0xF1, 0x10, 0x5D,
+    0x91, 0x85, 0x0B, 0x7E, 0x97, 0x63, 0xB5, 0x96, 0x99, 0x53, 0x96, 0xE5, 0xA2, 0xC7, 0xEE, 0xFD,
+    0xB6, 0x15, 0xF4, 0x7D, 0xD2, 0x72, 0xDD, 0xC2, 0xEB, 0x2D, 0x17, 0x2E, 0xBE, 0xD2, 0xC1, 0x4F,
+    0xAF, 0xF4, 0x11, 0x73, 0xB4, 0xD1, 0x5F, 0xC1, 0x38, 0x7F, 0x53, 0xBC, 0x0A, 0x2F, 0xEF, 0xD4,
+    0xE8, 0x77, 0x5F, 0x48, 0x32, 0x66, 0x27, 0xE6, 0x11, 0x7D, 0x0E, 0xCE, 0x65, 0xBA, 0x0A, 0x72,
+    0xE9, 0xA0, 0xB5, 0xA0, 0x32, 0x89, 0x17, 0x33, 0x55, 0xCE, 0x18, 0xCF, 0xB9, 0x7E, 0x48, 0x3C,
+    0x48, 0x21, 0x11, 0x70, 0x42, 0xDA, 0xE6, 0xFF, 0x38, 0xF7, 0x12, 0xAC, 0x66, 0x7C, 0x27, 0x4E,
+    0x18, 0xAC, 0x9B, 0x41, 0xD3, 0x79, 0x7C, 0xD3, 0x14, 0x3B, 0xD7, 0x8E, 0xE0, 0xFB, 0x8E, 0xDA,
+    0xA9, 0x76, 0x2B, 0x17, 0xD4, 0xA5, 0xBE, 0xFE, 0x08, 0x4B, 0xC4, 0x01, 0xB7, 0x2A, 0x7C, 0x03,
+    0xF7, 0x24, 0x60, 0x35, 0xA6, 0x0B, 0x69, 0x24, 0xD3, 0xDC, 0x38, 0x4F, 0x6E, 0xEB, 0x07, 0xCE,
+    0xD6, 0x56, 0xE3, 0xBE, 0x04, 0xAA, 0xC4, 0x3D, 0xEC, 0x9B, 0xE9, 0xE5, 0x03, 0x50, 0x22, 0xD1,
+    0x79, 0x68, 0xE8, 0x55, 0x1B, 0xB6, 0xD6, 0x95, 0x31, 0x41, 0xBF, 0x54, 0x2D, 0xF5, 0xC1, 0xAA,
+    0x4F, 0xBF, 0xAF, 0xBC, 0x1B, 0xF4, 0x08, 0x0B, 0x97, 0x72, 0xB2, 0xA0, 0xF7, 0x1B, 0x41, 0xFA,
+    0x07, 0x55, 0xCA, 0xF8, 0xA6, 0x24, 0x6B, 0x97, 0x56, 0x93, 0x3B, 0x8B, 0x63, 0x04, 0x2E, 0xAD,
+    0xDA, 0xCA, 0x0E, 0xC2, 0xF9, 0xAD, 0xC1, 0x9E, 0x63, 0xF3, 0xBB, 0x55, 0x5A, 0xCE, 0x1F, 0x84,
+    0x09, 0x3E, 0x1F, 0x29, 0xAF, 0x9C, 0x0F, 0x08, 0xFC, 0x04, 0xC0, 0x23, 0x70, 0x27, 0xFF, 0xC1,
+    0xC2, 0xAD, 0xE6, 0x7D, 0x98, 0xEF, 0xF3, 0xBB, 0xD4, 0xA8, 0x99, 0x07, 0xB5, 0x99, 0xCB, 0xB5,
+    0x64, 0xCF, 0xEE, 0xDE, 0xFD, 0xC4, 0x60, 0xE6, 0xF7, 0x98, 0x6A, 0x3C, 0x4F, 0x55, 0x3C, 0x62,
+    0x26, 0xD8, 0xA6, 0x1A, 0x19, 0x4F, 0xB5, 0xC9, 0x44, 0x28, 0x95, 0xB7, 0x60, 0xEF, 0x6B, 0xB3,
+    0x9A, 0x16, 0xFA, 0x3A, 0x74, 0x84, 0xCE, 0x9E, 0x49, 0xED, 0x05, 0xAB, 0x81, 0xF8, 0x65, 0xB9,
+    0x0D, 0x0C, 0x0F, 0x0A, 0xE8, 0x99, 0x6A, 0x5C, 0x1A, 0x07, 0xDA, 0x18, 0xBD, 0xE5, 0xE2, 0x44,
+    0x05, 0xC8, 0x20, 0x63, 0x2C, 0x95, 0x36, 0x62, 0x94, 0x9B, 0x3E, 0x2D, 0x0C, 0x16, 0xD4, 0x38,
+    0x4B, 0x05, 0x3F, 0xF3, 0x3C, 0xED, 0xC6, 0xE9, 0x48, 0x2B, 0x10, 0xE4, 0x55, 0xE9, 0x2A, 0x24,
+    0x26, 0xD0, 0x76, 0xF0, 0x22, 0x04, 0xD2, 0xA9, 0x59, 0x8A, 0x24, 0x9B, 0x93, 0x86, 0x05, 0x8B,
+    0xF5, 0xED, 0x69, 0x21, 0x18, 0x4A, 0x06, 0xFD, 0x02, 0xF3, 0x7F, 0x3F, 0x66, 0x69, 0xC0, 0xFB,
+    0x14, 0xB3, 0x7F, 0x47, 0x74, 0x93, 0x30, 0x69, 0xA5, 0x28, 0xAB, 0x71, 0xD8, 0x2F, 0xEB, 0x6C,
+    0xC0, 0x0C, 0x7F, 0xA4, 0x40, 0xE0, 0x06, 0xD6, 0xCD, 0xE8, 0xB6, 0x15, 0x2D, 0x30, 0xA0, 0xC8,
+    0x68, 0x01, 0x69, 0x07, 0xC0, 0xE9, 0xE8, 0x18, 0x9B, 0xFD, 0x24, 0x08, 0x56, 0xAE, 0xC4, 0xA7,
+    0x08, 0xA4, 0x26, 0x49, 0x2A, 0xFF, 0xC6, 0xA6, 0xEC, 0xA8, 0xE1, 0x33, 0x2E, 0xC5, 0xC4, 0x24,
+    0x8C, 0x0F, 0xE5, 0x1F, 0xCE, 0xD5, 0x13, 0x1E, 0xBD, 0x0D, 0xDD, 0xBC, 0x47, 0x1B, 0xF9, 0x13,
+    0x9C, 0x73, 0xEA, 0x4B, 0x5C, 0xCF, 0x7D, 0xC3, 0x85, 0x6D, 0x9C, 0x9B, 0xD0, 0xEA, 0x90, 0xB7,
+    0xE8, 0xCF, 0x8B, 0xFB, 0x42, 0xB7, 0x4D, 0x0C, 0xB1, 0x42, 0xDC, 0x50, 0x92, 0x4A, 0x2F, 0x91,
+    0x1C, 0x88, 0xD0, 0xD8, 0xBC, 0xC8, 0x68, 0xAA, 0xF1, 0x5B, 0xA7, 0x86, 0x85, 0x62, 0x5E, 0x68,
+    0x9D, 0x12, 0x47, 0x7D, 0xB8, 0x1D, 0x15, 0x3C, 0x26, 0xBD, 0x4B, 0xCB, 0x05, 0xB2, 0xD7, 0xCD,
+    0x52, 0xB1, 0xD3, 0x8E, 0xF2, 0x7E, 0xD0, 0xDB, 0x4F, 0xA4, 0x1F, 0x15, 0xFD, 0x1F, 0xDB, 0x6F,
+    0x40, 0xE5, 0x01, 0x5C, 0xF9, 0x2D, 0x93, 0xE0, 0xA5, 0xF5, 0x24, 0x99, 0x80, 0x19, 0x26, 0xEF,
+    0x0E, 0x03, 0x74, 0x07, 0x54, 0x07, 0xC3, 0x31, 0xB2, 0x76, 0xCA, 0xCE, 0x6E, 0x38, 0x4D, 0xA3,
+    0xEA, 0x95, 0x8C, 0xC3, 0xF3, 0x59, 0x1C, 0x14, 0x40, 0x7A, 0x99, 0xA0, 0x76, 0xE1, 0x63, 0xC3,
+    0xCB, 0x77, 0x49, 0x73, 0xD7, 0x1A, 0x97, 0x81, 0xFE, 0xAB, 0xAD, 0x07, 0xC1, 0x01, 0x07, 0xDF,
+    0x57, 0x12, 0xFE, 0x0F, 0x84, 0x09, 0xD2, 0xBD, 0x8A, 0xB2, 0x2B, 0xFE, 0x6B, 0x31, 0x73, 0x22,
+    0xA6, 0x40, 0x52, 0xEA, 0xF0, 0xE0, 0x73, 0xC6, 0xB2, 0x85, 0x4C, 0x3D, 0x3B, 0x12, 0xCF, 0x0E,
+    0xC0, 0xB7, 0x87, 0xD0, 0x0E, 0xE3, 0xB4, 0xFD, 0xD0, 0x8E, 0xFD, 0x69, 0xFC, 0xCC, 0x8E, 0xAB,
+    0x9F, 0x22, 0xC8, 0x1F, 0x87, 0x2A, 0xCE, 0xAF, 0x57, 0x98, 0xD7, 0xB3, 0x7C, 0x04, 0xCF, 0x33,
+    0x67, 0x50, 0x91, 0x00, 0x88, 0xB2, 0xA0, 0x9E, 0x80, 0x2A, 0xCD, 0x24, 0x86, 0x6E, 0x41, 0x58,
+    0xC8, 0x6D, 0x7E, 0xFD, 0x8E, 0x4E, 0x46, 0x12, 0xD8, 0x89, 0xE8, 0x61, 0x4A, 0xF7, 0xEA, 0x65,
+    0xB4, 0x6F, 0x53, 0xBA, 0x16, 0x92, 0x3B, 0x89, 0xFE, 0x77, 0x0A, 0xDE, 0x0B, 0x73, 0x0C, 0xBF,
+    0xD4, 0xB8, 0xDD, 0x4C, 0x35, 0x7C, 0x2E, 0x25, 0x8C, 0x09, 0xE5, 0x18, 0x18, 0x2D, 0x19, 0x2A,
+    0x99, 0x82, 0x94, 0x59, 0xCE, 0xD8, 0xB9, 0x44, 0xAB, 0x83, 0xFD, 0x27, 0x2B, 0x70, 0x21, 0xB4,
+    0x0B, 0x31, 0x2C, 0x87, 0xE5, 0x56, 0xF5, 0x27, 0x36, 0x9A, 0x50, 0x4C, 0x11, 0x8F, 0x6E, 0x98,
+    0xD3, 0xF6, 0xD6, 0x7A, 0x1F, 0xB6, 0x12, 0x1E, 0x13, 0x08, 0xAF, 0xB3, 0x8C, 0x13, 0x12, 0x65,
+    0x81, 0x99, 0x0B, 0xC9, 0x3B, 0x47, 0x92, 0xD7, 0x87, 0x15, 0xA1, 0xA7, 0x0E, 0xE1, 0x86, 0x43,
+    0x54, 0x0E, 0x5F, 0x91, 0x1B, 0x62, 0x22, 0xEA, 0x6D, 0xC5, 0x02, 0x1E, 0x0C, 0x42, 0x67, 0x2C,
+    0x36, 0x70, 0x98, 0x19, 0xD4, 0x27, 0x6E, 0xB2, 0x0E, 0xB5, 0x9B, 0x8A, 0xB4, 0x28, 0x25, 0xA5,
+    0x74, 0xAE, 0xF9, 0x8C, 0x0B, 0x75, 0x53, 0x32, 0xD5, 0x33, 0x7A, 0x3D, 0x67, 0xE9, 0xCB, 0x0C,
+    0x3D, 0x35, 0xAE, 0x4E, 0x1B, 0xCB, 0xAD, 0xE4, 0xDB, 0xCC, 0x3B, 0x95, 0x1A, 0x4A, 0xE5, 0x5A,
+    0xD5, 0x46, 0x59, 0x7C, 0xB8, 0x82, 0x8B, 0x97, 0x3A, 0xD9, 0x3F, 0x27, 0x0E, 0x95, 0x60, 0xEF,
+    0x4E, 0x28, 0xE7, 0x81, 0xCD, 0x6F, 0xCB, 0x52, 0x86, 0x98, 0x64, 0xB0, 0x66, 0xD6, 0x60, 0x1C,
+    0xA2, 0x9F, 0xF5, 0x9C, 0x9D, 0xB6, 0xF2, 0xED, 0x5F, 0xFE, 0xC5, 0x05, 0xA1, 0x89, 0xD9, 0xD9,
+    0x7F, 0x24, 0xEE, 0x8D, 0xFA, 0xF6, 0xF2, 0x32, 0x27, 0x70, 0xFE, 0xBF, 0x73, 0xE1, 0x77, 0x7C,
+    0x6B, 0x3C, 0xAA, 0x27, 0xE1, 0xF6, 0x8C, 0x0B, 0x3C, 0x1C, 0x68, 0x1E, 0xAF, 0x86, 0x68, 0x2A,
+    0x47, 0x0D, 0x13, 0x1C, 0x34, 0x13, 0xA4, 0xC8, 0xE3, 0x8E, 0x96, 0x8E, 0x23, 0xE2, 0x85, 0x15,
+    0x52, 0x0C, 0x03, 0x8E, 0xA8, 0x41, 0xA3, 0xF5, 0x10, 0xDE, 0xA4, 0x31, 0x7A, 0xCD, 0xB4, 0xF2,
+    0x72, 0x06, 0xBE, 0x8F, 0xAE, 0xB6, 0x71, 0xD2, 0x6A, 0x55, 0xEB, 0xA9, 0x6A, 0x5E, 0x2D, 0xAE,
+    0x3C, 0xB9, 0x68, 0xAD, 0xF4, 0x98, 0x06, 0x2D, 0x29, 0xF5, 0xA6, 0xFF, 0xD4, 0xB7, 0x6C, 0x84,
+    0xF4, 0x2C, 0x10, 0xD9, 0xD0, 0x08, 0xAD, 0x86, 0xC8, 0x11, 0xD4, 0x65, 0xE0, 0x67, 0x27, 0x71,
+    0x29, 0x7D, 0xCD, 0x3A, 0x4F, 0x74, 0xE6, 0xDD, 0x8F, 0x0B, 0xE5, 0xBF, 0x99, 0x4B, 0xE6, 0xFB,
+    0xA9, 0x29, 0x0E, 0x18, 0x95, 0xA9, 0x29, 0x2F, 0x2F, 0x67, 0x27, 0xC1, 0x19, 0x3A, 0x39, 0x6F,
+    0x72, 0xF3, 0x79, 0xF9, 0x5F, 0xD5, 0xDB, 0xBB, 0x5F, 0x3B, 0x39, 0xFF, 0xD4, 0xEE, 0x03, 0x7B,
+    0xF7, 0xBF, 0x0C, 0xE7, 0x36, 0xE8, 0xD5, 0x41, 0xDD, 0x2E, 0x38, 0x14, 0xE3, 0x3B, 0xC7, 0x25,
+    0x3A, 0x03, 0x53, 0x9D, 0xDC, 0x6F, 0x8F, 0xB3, 0xDF, 0xDA, 0x90, 0xF2, 0xCD, 0xAC, 0xF1, 0xBF,
+    0x46, 0xBB, 0xF8, 0xBC, 0x1A, 0x65, 0xAF, 0x2A, 0xF5, 0x07, 0x6E, 0xA2, 0xEE, 0xF3, 0xE3, 0x24,
+    0x16, 0x86, 0x56, 0x84, 0xD7, 0x7F, 0xFA, 0x1A, 0x8F, 0x7F, 0xFA, 0xEF, 0x5E, 0xFE, 0x03, 0x1E,
+    0xBF, 0xFB, 0xD4, 0xFD, 0xEE, 0x87, 0x69, 0x85, 0x1F, 0x78, 0x32, 0x3A, 0x97, 0x02, 0x16, 0xE7,
+    0xE7, 0xF4, 0x8A, 0x5E, 0x42, 0x8F, 0xDF, 0x05, 0xBE, 0x46, 0xD3, 0xDF, 0x0C, 0x07, 0xFE, 0x3B,
+    0x38, 0x90, 0xFD, 0xAB, 0xDF, 0xD9, 0xD8, 0xD3, 0x68, 0x18, 0xAC, 0x37, 0x1C, 0xFD, 0x64, 0xBA,
+    0x72, 0xE0, 0x4F, 0x06, 0xDE, 0x9C, 0x67, 0x29, 0xC7, 0xCB, 0xD6, 0x4C, 0x23, 0xF2, 0xC3, 0x21,
+    0x5A, 0x42, 0x45, 0x7B, 0x60, 0xC2, 0xB5, 0x77, 0xFD, 0x49, 0x06, 0x68, 0xCE, 0xDA, 0xD2, 0x90,
+    0x48, 0x06, 0xA5, 0x4B, 0x47, 0x76, 0x21, 0xCC, 0x5C, 0x50, 0x0F, 0xF2, 0x43, 0xC4, 0xBB, 0x99,
+    0x2D, 0x2A, 0x11, 0x43, 0x95, 0xEE, 0x07, 0xE4, 0xA2, 0x8F, 0x73, 0x05, 0x46, 0x62, 0x95, 0x50,
+    0xA0, 0x9C, 0x7C, 0xAA, 0xF2, 0x61, 0x88, 0xAA, 0x2B, 0xB5, 0x7F, 0x8B, 0x1E, 0xFD, 0x84, 0xF8,
+    0x0F, 0x58, 0xD4, 0xA7, 0xFC, 0xDB, 0xFC, 0x7F, 0x52, 0xD6, 0x37, 0x14, 0xF6, 0x29, 0xA9, 0xEC,
+    0x53, 0x52, 0x99, 0xB7, 0x0E, 0xA5, 0xC0, 0x0E, 0xC3, 0x97, 0xBA, 0x3A, 0x42, 0xEF, 0x2D, 0xC2,
+    0x50, 0xAE, 0x2E, 0x08, 0xAC, 0xA4, 0x2A, 0x35, 0x17, 0x28, 0x77, 0x75, 0x1B, 0x7A, 0x00, 0x64,
+    0xA5, 0xD9, 0xAA, 0x94, 0xF7, 0xD8, 0xE2, 0xFE, 0x60, 0x0A, 0xED, 0xCF, 0xD9, 0x4A, 0x64, 0x81,
+    0xAF, 0xA9, 0xB1, 0xC2, 0xE2, 0xCF, 0x45, 0xFF, 0xC9, 0xE4, 0x4B, 0x93, 0x71, 0x9C, 0x4A, 0xE8,
+    0x20, 0x98, 0x48, 0xE5, 0xE7, 0x26, 0x03, 0xD9, 0xBD, 0xA1, 0xDC, 0x22, 0x86, 0x72, 0xFA, 0x63,
+    0x56, 0xF2, 0x6E, 0x2A, 0xC3, 0x30, 0x99, 0xDB, 0x2D, 0x4D, 0x57, 0xF6, 0x76, 0x43, 0x93, 0x70,
+    0xE6, 0x1C, 0xAE, 0xA5, 0x43, 0x1C, 0xE3, 0x31, 0x63, 0x21, 0x4A, 0x6A, 0xDC, 0x7A, 0x7D, 0x97,
+    0x1A, 0xB7, 0x33, 0x68, 0xB7, 0x59, 0xE3, 0x56, 0x48, 0x69, 0x48, 0xEB, 0xB3, 0x14, 0x32, 0xD9,
+    0xAA, 0xC6, 0x6D, 0x4F, 0xF2, 0xE7, 0x2A, 0xFD, 0xB5, 0xC9, 0x83, 0xFE, 0x44, 0xE5, 0xB7, 0xC4,
+    0x9A, 0x6B, 0x33, 0x93, 0xD5, 0x54, 0xAB, 0x5F, 0x68, 0xFD, 0xE6, 0xEB, 0xC6, 0x6F, 0xD3, 0xDA,
+    0x37, 0xBA, 0xB4, 0x59, 0xC9, 0xA7, 0xD1, 0x46, 0xB9, 0x3F, 0x14, 0xA7, 0xD2, 0x32, 0x7A, 0xC5,
+    0x12, 0x50, 0x66, 0xF5, 0x2F, 0x43, 0x67, 0x6E, 0x91, 0x62, 0x0E, 0x61, 0xBF, 0x9C, 0x3D, 0x4C,
+    0x7D, 0xF1, 0xD6, 0xB5, 0x78, 0xDF, 0x11, 0x49, 0x78, 0x60, 0xCF, 0xE2, 0xBB, 0xCC, 0xC5, 0x48,
+    0x54, 0xF9, 0x6E, 0x7F, 0x12, 0x7A, 0xCC, 0x58, 0x2B, 0x1C, 0xF6, 0xE7, 0xEA, 0xA1, 0xCC, 0xF9,
+    0xE4, 0x50, 0x2F, 0x3C, 0xB5, 0x8C, 0xF5, 0xD6, 0xCB, 0x78, 0x27, 0x8A, 0x86, 0x70, 0x7E, 0x50,
+    0x47, 0x8A, 0x75, 0x7B, 0xB6, 0x39, 0xA0, 0x3F, 0x86, 0x1D, 0x8A, 0x4D, 0xA1, 0x2D, 0x3C, 0x5D,
+    0x12, 0xB4, 0x7C, 0x3E, 0x3A, 0x39, 0xC7, 0xFA, 0x03, 0x25, 0xE0, 0x24, 0xC1, 0xBC, 0x2D, 0xB8,
+    0x9B, 0x02, 0xFD, 0x17, 0x42, 0x3B, 0xE5, 0xB8, 0xD0, 0xDB, 0x96, 0x6D, 0x6B, 0x09, 0x6D, 0x6D,
+    0xA8, 0x31, 0x3B, 0x06, 0x53, 0xC5, 0xD8, 0xB8, 0x37, 0xC0, 0xCB, 0x94, 0xC0, 0x35, 0xB4, 0x88,
+    0xD3, 0x3A, 0xAC, 0x54, 0x78, 0x69, 0xE2, 0x6F, 0x4D, 0xE5, 0x20, 0x02, 0x19, 0xAC, 0x2F, 0x03,
+    0x96, 0x01, 0xAE, 0xBD, 0x43, 0xBA, 0x4A, 0xFC, 0x3A, 0x1A, 0x68, 0x4B, 0x32, 0x20, 0x4D, 0xD8,
+    0xB9, 0x8D, 0x36, 0x67, 0x1A, 0x31, 0xF3, 0x67, 0xBD, 0xDA, 0xA9, 0xB0, 0xBA, 0x50, 0xB3, 0xAA,
+    0x87, 0xE2, 0x83, 0xE1, 0x15, 0xCB, 0xC6, 0x95, 0x3C, 0x65, 0x8D, 0xAE, 0x2E, 0x9E, 0x67, 0x45,
+    0xFB, 0x27, 0xB9, 0x5A, 0x80, 0xAF, 0x8F, 0xD1, 0xEC, 0x85, 0xDA, 0x65, 0x40, 0x76, 0x44, 0xE3,
+    0x5E, 0x79, 0x87, 0x1B, 0x0A, 0x9E, 0xD1, 0xD5, 0x86, 0xEE, 0x9D, 0x73, 0xBB, 0xAF, 0xD7, 0xEB,
+    0xA6, 0x6D, 0x00, 0x01, 0xD6, 0x78, 0x23, 0x69, 0x14, 0x09, 0x1E, 0x30, 0x62, 0x80, 0x87, 0x7A,
+    0xCD, 0x88, 0xD1, 0x37, 0xD9, 0xA7, 0xC1, 0x02, 0x8D, 0xA7, 0xC1, 0x97, 0x85, 0xE1, 0x63, 0x23,
+    0xAB, 0x86, 0x46, 0xF5, 0x06, 0x4B, 0xEF, 0xE4, 0x86, 0xC3, 0xF3, 0x83, 0x86, 0xFA, 0x23, 0xB5,
+    0x78, 0xDC, 0x39, 0x9B, 0xE6, 0xA6, 0x0D, 0x9A, 0xFF, 0x51, 0x45, 0xE5, 0xB3, 0xA7, 0x66, 0x4F,
+    0x86, 0xC5, 0xC9, 0x59, 0xB5, 0x3F, 0x2C, 0xA8, 0xA7, 0xC2, 0x0F, 0xF2, 0x71, 0xB4, 0x26, 0xE6,
+    0xFA, 0x28, 0x13, 0x7E, 0x08, 0x03, 0xBF, 0x0B, 0xAF, 0x93, 0x4F, 0x42, 0x96, 0xF7, 0xD4, 0x61,
+    0x91, 0xE6, 0x4B, 0x65, 0x0A, 0xE1, 0x21, 0x11, 0x1A, 0xEB, 0x7B, 0xC8, 0xFE, 0x0F, 0x5B, 0xCF,
+    0x67, 0x0B, 0xFA, 0x36, 0x40, 0xAB, 0xD9, 0x20, 0x2D, 0xFD, 0x55, 0x0D, 0x34, 0x85, 0x25, 0xEB,
+    0x0B, 0x82, 0x2C, 0x18, 0xC2, 0xD6, 0x8C, 0x29, 0x68, 0xA8, 0x00, 0xA0, 0x77, 0x79, 0x5C, 0xD2,
+    0xED, 0xD7, 0x33, 0x98, 0xF3, 0x41, 0x29, 0xAB, 0xB2, 0x19, 0xB6, 0x70, 0x5C, 0xD2, 0x4D, 0xA9,
+    0xEE, 0x16, 0x36, 0x12, 0x4F, 0x5F, 0x8B, 0x2A, 0x63, 0x86, 0x02, 0xFA, 0xFE, 0x31, 0x86, 0x1D,
+    0xA0, 0x87, 0x03, 0xF4, 0x18, 0xE8, 0x3C, 0xFC, 0x25, 0x63, 0x0C, 0xA5, 0x15, 0x64, 0xCC, 0x31,
+    0xD3, 0x43, 0xA0, 0x7B, 0xC0, 0x42, 0xD5, 0xDD, 0x12, 0x48, 0x0D, 0x73, 0x59, 0x4F, 0x59, 0x4D,
+    0x97, 0x6B, 0xE9, 0x36, 0x63, 0x27, 0xCD, 0xE5, 0x2A, 0xBA, 0x5C, 0x43, 0x97, 0x2B, 0x68, 0x2B,
+    0xAD, 0x1B, 0x09, 0xD8, 0x51, 0x07, 0xD8, 0xB0, 0x0F, 0xE3, 0x72, 0xCD, 0xA4, 0xC8, 0xBA, 0x93,
+    0x22, 0x6B, 0xBB, 0x5E, 0xE2, 0x28, 0xDA, 0xB5, 0x5A, 0x99, 0xAC, 0x93, 0x80, 0x59, 0x48, 0xEB,
+    0x1F, 0x32, 0x0E, 0xD4, 0xAB, 0xA0, 0x09, 0xFE, 0x2D, 0x26, 0xBF, 0x77, 0x07, 0xC0, 0x3C, 0x51,
+    0x42, 0xBC, 0x70, 0xC4, 0xBE, 0xA0, 0xA1, 0x96, 0x58, 0x3C, 0x08, 0x10, 0xF8, 0xC9, 0x01, 0x22,
+    0xD6, 0x53, 0x04, 0x9D, 0xC4, 0x90, 0x26, 0x65, 0x7F, 0xC1, 0x04, 0xF8, 0x13, 0xE0, 0x48, 0x3D,
+    0x1A, 0x69, 0x35, 0x22, 0xEB, 0x9F, 0x7A, 0xD5, 0xFA, 0xBC, 0xAB, 0x6F, 0x14, 0x00, 0xD7, 0x32,
+    0x80, 0x9F, 0x61, 0x84, 0xAB, 0x7F, 0xC7, 0x69, 0x75, 0x76, 0xD7, 0x00, 0x3E, 0x7E, 0xCC, 0xAF,
+    0xFC, 0xAC, 0xE6, 0x57, 0xC0, 0x86, 0xAB, 0x6F, 0xF6, 0x36, 0x10, 0x4C, 0x5E, 0xCC, 0x31, 0xB7,
+    0xB8, 0x66, 0xA7, 0xED, 0x1E, 0xBA, 0xB6, 0x0C, 0xFC, 0x26, 0x41, 0xE3, 0xFE, 0x2A, 0xF1, 0x7F,
+    0x7F, 0x14, 0x9C, 0xF5, 0xF5, 0x7F, 0xC1, 0x93, 0xBF, 0xBE, 0xC8, 0x81, 0xD7, 0x42, 0x5F, 0xFC,
+    0x88, 0x4E, 0xFD, 0xAF, 0x35, 0x04, 0xC4, 0xEF, 0x5F, 0x94, 0x1C, 0x43, 0xA3, 0x18, 0xED, 0x4D,
+    0x18, 0xEC, 0xCD, 0xEF, 0xC0, 0xFD, 0x1F, 0xF7, 0x67, 0x72, 0x08, 0xA3, 0x1F, 0x3D, 0x0E, 0xEE,
+    0x35, 0x71, 0x1F, 0x56, 0x9B, 0x52, 0x50, 0x40, 0xE7, 0x09, 0x68, 0x17, 0x7E, 0xFC, 0x21, 0x00,
+    0xD0, 0x0E, 0xC6, 0xBF, 0x3F, 0xDA, 0x53, 0x41, 0x3B, 0xC5, 0x1B, 0x8B, 0xF1, 0x3A, 0xBF, 0x93,
+    0xDC, 0xB1, 0xA2, 0xF2, 0xB9, 0xAC, 0xF4, 0xF9, 0x55, 0x97, 0x7B, 0x12, 0x4B, 0xEF, 0xC7, 0xEA,
+    0x42, 0x50, 0xEC, 0xE2, 0x26, 0xAC, 0x82, 0x66, 0x46, 0x50, 0xCC, 0x0B, 0xA4, 0x59, 0x13, 0x5C,
+    0x2F, 0x84, 0xF3, 0x2D, 0xA4, 0xA8, 0x0B, 0x3E, 0xE8, 0xE5, 0x2A, 0xB5, 0x7E, 0x50, 0xD0, 0x9C,
+    0x0E, 0x0A, 0xC9, 0xDE, 0x16, 0x36, 0xB3, 0x4A, 0x83, 0x7A, 0xE9, 0x16, 0x70, 0x44, 0xAB, 0x5A,
+    0xE7, 0x8B, 0xE4, 0x65, 0x4D, 0x56, 0xBE, 0x18, 0x56, 0xCF, 0x9D, 0xBA, 0x10, 0x16, 0xA7, 0x66,
+    0x01, 0xF8, 0x55, 0xB2, 0x71, 0x28, 0xAC, 0x24, 0x95, 0x9B, 0x1F, 0xB2, 0xCA, 0xF2, 0x3A, 0xCB,
+    0x37, 0xD9, 0x37, 0xAB, 0x34, 0x15, 0xF9, 0xD7, 0x61, 0x80, 0x35, 0x85, 0x99, 0xD1, 0x87, 0x66,
+    0x28, 0x93, 0x2F, 0xEF, 0x5B, 0x26, 0xBF, 0x74, 0xEF, 0x32, 0x79, 0xBB, 0x4B, 0x21, 0x35, 0x57,
+    0x6D, 0xE8, 0x2C, 0xBE, 0x1B, 0x0D, 0x8A, 0x59, 0x82, 0xC5, 0x8E, 0xA0, 0x5C, 0x99, 0x64, 0xA0,
+    0x56, 0x9D, 0x06, 0x6B, 0xE7, 0x5A, 0x12, 0xCA, 0xE6, 0x0B, 0x04, 0x61, 0x47, 0xDA, 0xE0, 0xBD,
+    0xE3, 0xC8, 0x82, 0x78, 0xF7, 0xEE, 0x46, 0x40, 0x16, 0x86, 0x09, 0xD5, 0x70, 0x72, 0x6B, 0xAD,
+    0x8C, 0x70, 0x61, 0x0A, 0xEE, 0x17, 0xA8, 0x36, 0x40, 0xCE, 0x51, 0x42, 0xEF, 0x77, 0x9C, 0xBF,
+    0x0B, 0x94, 0xB9, 0x2A, 0x3B, 0x59, 0xCE, 0x87, 0x4A, 0x25, 0xB2, 0x29, 0x8F, 0x36, 0x90, 0xA1,
+    0x5A, 0xE8, 0xDB, 0x61, 0xDB, 0x59, 0xD9, 0x69, 0x8D, 0xCF, 0x6C, 0x82, 0x32, 0x37, 0x65, 0x27,
+    0x97, 0xDA, 0x6A, 0x10, 0x96, 0x4F, 0xDF, 0xB2, 0x95, 0xA7, 0xC5, 0x83, 0xED, 0x2B, 0xC4, 0xA1,
+    0x3F, 0x6B, 0x4B, 0x55, 0xFB, 0x61, 0x43, 0x61, 0x21, 0x07, 0xD1, 0x1F, 0x31, 0xB3, 0x89, 0x56,
+    0x71, 0xDA, 0x43, 0x37, 0x1C, 0xE6, 0xFA, 0x43, 0xE9, 0x0D, 0xB7, 0x4B, 0xCD, 0x87, 0xA6, 0x77,
+    0x6D, 0x84, 0x46, 0x74, 0xF0, 0x28, 0x91, 0xDD, 0x76, 0x41, 0x26, 0x3C, 0x13, 0xE4, 0x12, 0x7D,
+    0x0A, 0x56, 0xC5, 0xEB, 0xE7, 0x4E, 0x9D, 0x89, 0xA5, 0xB9, 0xB8, 0xA8, 0x86, 0xDA, 0x9D, 0x80,
+    0x0C, 0x6D, 0x13, 0xB4, 0x77, 0x42, 0xEA, 0xD8, 0xDA, 0x6A, 0x59, 0xAB, 0x67, 0xC7, 0x56, 0x9C,
+    0x14, 0x63, 0x8A, 0xB6, 0x0D, 0x3B, 0xAF, 0xA1, 0xD9, 0x79, 0x44, 0x5C, 0x13, 0x09, 0x67, 0xCD,
+    0x12, 0x52, 0xEF, 0x52, 0xD5, 0x05, 0x64, 0x9A, 0xDE, 0x46, 0x1D, 0xC6, 0x8F, 0x0F, 0x81, 0x30,
+    0xC7, 0xFC, 0x65, 0x61, 0x23, 0x71, 0x41, 0xE5, 0xBC, 0x83, 0x25, 0x0A, 0x0C, 0x4B, 0xEA, 0x7F,
+    0x52, 0xA6, 0x99, 0xF6, 0x2B, 0x9D, 0x19, 0x74, 0x0B, 0xD0, 0xEA, 0x37, 0xC6, 0x20, 0xE5, 0xC7,
+    0x38, 0xC7, 0x05, 0x38, 0xE6, 0x47, 0x61, 0x9B, 0xC7, 0xEF, 0xB3, 0x36, 0x85, 0xDB, 0x1A, 0x4E,
+    0x48, 0x15, 0xAC, 0xF9, 0x6F, 0xE3, 0x84, 0xD0, 0x10, 0x22, 0x1A, 0x99, 0x41, 0x6D, 0xC1, 0xCD,
+    0xF9, 0x1E, 0x1C, 0x69, 0x7E, 0xD6, 0xFE, 0xA7, 0x90, 0x85, 0xC1, 0xF5, 0xD6, 0x02, 0x6D, 0xC1,
+    0xA7, 0xC0, 0xEA, 0xD1, 0xAF, 0x1A, 0x15, 0x5D, 0xFB, 0x1A, 0x12, 0x6E, 0x55, 0xC6, 0x27, 0x6C,
+    0xC1, 0x82, 0x97, 0xC7, 0x73, 0xAE, 0xFF, 0x10, 0xD8, 0xBD, 0x28, 0x75, 0x4E, 0x0C, 0xE3, 0x72,
+    0x5B, 0x96, 0x28, 0x93, 0x4B, 0xB6, 0x11, 0xD1, 0x74, 0x24, 0xEF, 0xE3, 0x5C, 0xEF, 0x88, 0xF3,
+    0xEF, 0x84, 0x6B, 0x2D, 0x03, 0x31, 0x07, 0x84, 0x41, 0xE1, 0xB3, 0x49, 0xF4, 0x02, 0xEA, 0x4F,
+    0x52, 0xBD, 0xFA, 0xFC, 0x9A, 0x56, 0x2B, 0xC3, 0xD6, 0xEA, 0x60, 0xF3, 0xD6, 0xEA, 0x87, 0x01,
+    0x4B, 0x1D, 0xD3, 0x76, 0x62, 0x80, 0x85, 0xE2, 0x4D, 0x64, 0x83, 0xD3, 0x36, 0x05, 0x86, 0xDA,
+    0x3B, 0x90, 0x7D, 0xF9, 0x5A, 0x7C, 0xB5, 0x3C, 0x19, 0xE7, 0xE5, 0xAB, 0xF7, 0xAD, 0xBD, 0xBB,
+    0x61, 0x37, 0x36, 0x4B, 0x74, 0x64, 0x61, 0xAA, 0x51, 0xDE, 0xEE, 0x98, 0xDE, 0xFB, 0x51, 0x73,
+    0xEF, 0x47, 0xC3, 0xBD, 0x1F, 0x2D, 0x94, 0x2E, 0x1C, 0x44, 0xEE, 0xFD, 0xA0, 0x1D, 0x9E, 0x9E,
+    0x61, 0x5F, 0x3F, 0x03, 0xC2, 0xC2, 0x9B, 0xE3, 0x98, 0xAE, 0x37, 0x89, 0xE9, 0x4E, 0x01, 0x9E,
+    0x3B, 0xD1, 0xCB, 0xAE, 0x92, 0x62, 0xC8, 0xD0, 0x87, 0x6D, 0x58, 0x8D, 0x24, 0x43, 0x0F, 0xF6,
+    0xCD, 0x69, 0x1F, 0x90, 0xDD, 0x1D, 0xC9, 0xD2, 0xEF, 0xB5, 0x59, 0xFA, 0x14, 0xA3, 0x89, 0x87,
+    0xF0, 0xC4, 0x38, 0x53, 0x3F, 0xDD, 0x52, 0x16, 0xA7, 0xF5, 0x8F, 0x35, 0x52, 0x57, 0x8C, 0xB5,
+    0xA9, 0x31, 0x6F, 0xCB, 0x48, 0x3D, 0x2A, 0xFE, 0x70, 0xF3, 0x48, 0x1F, 0x7D, 0xE3, 0x49, 0x7E,
+    0xEF, 0x8D, 0x27, 0xE2, 0x67, 0xDF, 0x61, 0x14, 0x3D, 0x3F, 0x01, 0xB3, 0x8C, 0x12, 0x2B, 0xD6,
+    0x23, 0x2A, 0xBF, 0x75, 0x59, 0x80, 0x4C, 0x1A, 0x32, 0xFF, 0x46, 0xD9, 0x9A, 0xC4, 0x21, 0x30,
+    0xCE, 0xE9, 0x3F, 0xC7, 0xE7, 0x9E, 0x34, 0x4A, 0xCA, 0x5D, 0xA0, 0x0C, 0x70, 0x25, 0x2A, 0x41,
+    0x80, 0xBA, 0xD9, 0x52, 0x2B, 0x05, 0x53, 0x96, 0x11, 0xE8, 0xBE, 0x22, 0xE5, 0xEB, 0xDB, 0x4C,
+    0x0C, 0xAC, 0x44, 0x45, 0x0D, 0x04, 0x5C, 0x88, 0x8A, 0x15, 0x7B, 0x38, 0x29, 0x5B, 0x10, 0x0B,
+    0xB5, 0x6D, 0x07, 0x27, 0xFD, 0x72, 0xF9, 0xFC, 0xAD, 0x21, 0xB1, 0xB8, 0x61, 0xBB, 0xC6, 0xC6,
+    0x7D, 0x1A, 0xFE, 0x86, 0x83, 0x43, 0x3E, 0x99, 0x11, 0x4E, 0x81, 0xD8, 0x7B, 0x4D, 0xBF, 0x48,
+    0xF7, 0x49, 0x1F, 0x05, 0x7C, 0x55, 0xA0, 0x75, 0x8F, 0x1E, 0x04, 0x3A, 0xE6, 0x3F, 0xFD, 0xA0,
+    0x4F, 0x24, 0x99, 0x98, 0xAF, 0xC7, 0xC7, 0xAD, 0xFE, 0x1C, 0x6D, 0x82, 0x0A, 0x4F, 0x3C, 0x62,
+    0x9A, 0xA5, 0xFE, 0xCF, 0x64, 0x9F, 0x8E, 0xE6, 0x9E, 0x9C, 0xAD, 0x81, 0x54, 0x07, 0xB8, 0xF8,
+    0xDE, 0xB0, 0x4F, 0x67, 0xEE, 0x0B, 0x91, 0xD6, 0x5B, 0x80, 0xF1, 0x3E, 0x1D, 0x35, 0xF0, 0xF0,
+    0xD4, 0x4E, 0xE4, 0xFD, 0xEB, 0xE1, 0x19, 0x1B, 0xC5, 0xE8, 0x63, 0x03, 0xEE, 0xF0, 0x99, 0xBB,
+    0xC5, 0x53, 0xD6, 0x81, 0xCF, 0x2D, 0xC8, 0x5E, 0xAF, 0x61, 0xF3, 0x99, 0xBF, 0x07, 0x05, 0x2C,
+    0xDE, 0xC1, 0xB9, 0xAC, 0x21, 0xB3, 0x45, 0x64, 0xF7, 0x32, 0x17, 0xEE, 0xB1, 0x07, 0x69, 0x96,
+    0xE0, 0x79, 0xEE, 0x41, 0x7A, 0x9E, 0x3B, 0x36, 0x08, 0xCC, 0xFF, 0x9C, 0xEC, 0x41, 0xBA, 0x48,
+    0x89, 0xFD, 0xFC, 0x46, 0x30, 0x3B, 0xBD, 0x07, 0x69, 0xCB, 0x8A, 0xD5, 0xAF, 0xDE, 0x97, 0xE6,
+    0x99, 0x9B, 0xB6, 0x62, 0xF5, 0xE9, 0xF7, 0xE1, 0xED, 0xA1, 0x39, 0x2F, 0x4E, 0x2A, 0x56, 0xB9,
+    0xAD, 0x45, 0x4A, 0x09, 0x36, 0x79, 0xC5, 0x16, 0xEC, 0x91, 0x5D, 0x66, 0xCC, 0xD5, 0x9E, 0xB3,
+    0x96, 0x78, 0x76, 0xFF, 0x5D, 0x80, 0x37, 0xF8, 0xBE, 0x80, 0xF6, 0x0E, 0x3B, 0x78, 0x1A, 0xBC,
+    0x22, 0xD6, 0x39, 0x4C, 0x5B, 0x6E, 0x6E, 0xF4, 0xB9, 0xBD, 0xC4, 0x6F, 0x24, 0x72, 0x70, 0x5F,
+    0x30, 0xD8, 0xC1, 0xBE, 0x99, 0x38, 0x7D, 0x11, 0xC7, 0x0E, 0x1D, 0xC7, 0xE2, 0xA4, 0xDA, 0x93,
+    0x62, 0x40, 0x0E, 0x3D, 0x2A, 0xE0, 0x93, 0xBF, 0x16, 0xE7, 0x10, 0x6D, 0x97, 0x24, 0xBD, 0x74,
+    0x29, 0x95, 0x24, 0x93, 0x30, 0xC1, 0x4E, 0xF3, 0x25, 0x83, 0xDC, 0x92, 0x45, 0xB0, 0x75, 0x35,
+    0x03, 0x8C, 0x8A, 0x21, 0x3F, 0xBB, 0x43, 0x42, 0x9B, 0xCF, 0x2A, 0x9B, 0x9F, 0x19, 0xB2, 0x2A,
+    0xE3, 0xA4, 0x00, 0x23, 0xE7, 0x74, 0x25, 0x83, 0xA2, 0xE7, 0x23, 0x34, 0x9E, 0x90, 0xA5, 0xC9,
+    0xA5, 0x34, 0x49, 0x33, 0xF6, 0x9F, 0xED, 0x34, 0xCB, 0xCB, 0x89, 0x54, 0x89, 0xD9, 0xBD, 0x62,
+    0x18, 0x05, 0x7D, 0x48, 0x6A, 0xB6, 0xFE, 0xB2, 0x5A, 0x2F, 0x19, 0x5C, 0x9F, 0x82, 0x9A, 0x9A,
+    0x42, 0xBD, 0x3E, 0x85, 0xD1, 0xE3, 0x4C, 0x41, 0x4D, 0x4D, 0xA1, 0x51, 0xE3, 0xD0, 0x84, 0xEC,
+    0x38, 0x1C, 0x76, 0x1B, 0xAA, 0xE9, 0x04, 0xCE, 0x54, 0x1C, 0xF4, 0x31, 0x26, 0xE8, 0x73, 0x82,
+    0xB6, 0x4C, 0x47, 0x86, 0x13, 0x26, 0x9B, 0xE5, 0xA0, 0x98, 0xCD, 0xC5, 0xC3, 0xBE, 0xB7, 0x23,
+    0x9D, 0x5A, 0x81, 0x05, 0x5B, 0x76, 0x77, 0x49, 0xCA, 0xE5, 0x54, 0x7A, 0xDE, 0xCA, 0x95, 0xD5,
+    0xA9, 0xD0, 0xF8, 0xFF, 0xF7, 0xED, 0xE5, 0xC2, 0xF3, 0xF3, 0x52, 0xD2, 0xC7, 0x7D, 0x46, 0xDE,
+    0x9A, 0x08, 0x1E, 0xFD, 0xF6, 0xC4, 0x92, 0x7D, 0x02, 0x1B, 0x69, 0x1E, 0x3C, 0x9E, 0xB0, 0x3A,
+    0x0E, 0x78, 0xD1, 0x31, 0x72, 0x1B, 0x66, 0xCD, 0x1A, 0x4A, 0xEB, 0x86, 0x01, 0xAF, 0x66, 0xC2,
+    0xCB, 0x1D, 0xF7, 0x54, 0xB1, 0x7C, 0x73, 0x43, 0xC0, 0xCB, 0xDC, 0x25, 0xE0, 0xA5, 0x7E, 0xA8,
+    0x8D, 0xDB, 0x05, 0x4D, 0xF0, 0xEF, 0xE9, 0xDA, 0xD2, 0xB3, 0xA5, 0x63, 0xEB, 0xC3, 0x7A, 0xF7,
+    0x7B, 0x5D, 0xD8, 0x00, 0xAA, 0x6C, 0xB9, 0xE8, 0xFC, 0xDA, 0xE9, 0xC3, 0x0E, 0xE6, 0xB5, 0x61,
+    0x04, 0x05, 0x7D, 0xCD, 0x82, 0xD2, 0x99, 0xBD, 0x63, 0x09, 0x8B, 0x81, 0xC7, 0x0E, 0x93, 0xFB,
+    0x89, 0xED, 0x13, 0xAF, 0x27, 0xD4, 0x5E, 0x49, 0x6A, 0x46, 0xD9, 0x58, 0x8F, 0x95, 0xD8, 0x8E,
+    0x7A, 0xC4, 0xED, 0x37, 0xDD, 0x94, 0x5D, 0x78, 0xD1, 0xDA, 0xCA, 0x52, 0xC7, 0x99, 0x6C, 0xB3,
+    0xF7, 0xCB, 0x4D, 0xE2, 0x91, 0x04, 0x79, 0x38, 0x66, 0x0C, 0x69, 0x96, 0x2B, 0x73, 0x91, 0x09,
+    0x91, 0x56, 0xCC, 0xEE, 0x1F, 0xD0, 0xC3, 0x1B, 0x27, 0x3E, 0xF7, 0x2C, 0x4A, 0x09, 0x7E, 0x48,
+    0x17, 0xD8, 0xED, 0x1E, 0xD6, 0x05, 0xA6, 0xB8, 0x37, 0x1B, 0x35, 0xC2, 0x3C, 0xDD, 0xB4, 0x4B,
+    0xC0, 0xAA, 0x4A, 0x4F, 0x30, 0xAE, 0x66, 0x26, 0x2F, 0xA6, 0xB9, 0xC2, 0x84, 0x05, 0xA7, 0xB9,
+    0x9E, 0xA4, 0xB8, 0x97, 0x77, 0xFB, 0x50, 0x7E, 0x70, 0xB9, 0xC1, 0x0F, 0x5E, 0x17, 0x24, 0xFB,
+    0x36, 0xA5, 0x2A, 0xAC, 0x5C, 0x3B, 0xA6, 0xB6, 0x65, 0xD3, 0x52, 0x36, 0x4E, 0x49, 0xAD, 0xA7,
+    0x24, 0x24, 0x0A, 0xF9, 0xBA, 0x4D, 0x49, 0x3C, 0xB2, 0xA1, 0x72, 0xE3, 0x6E, 0x86, 0xCA, 0x0C,
+    0x95, 0xB9, 0x44, 0x6A, 0xC4, 0xFD, 0x0C, 0xB6, 0x16, 0x9E, 0x8F, 0x6B, 0xA8, 0xA8, 0x61, 0xFF,
+    0x92, 0xEC, 0xFF, 0xB8, 0x38, 0xB1, 0x85, 0x2F, 0x4C, 0xC0, 0x2C, 0xD7, 0x13, 0xFC, 0xDD, 0x86,
+    0x7C, 0x1B, 0xCF, 0x0D, 0x17, 0xAE, 0xAA, 0xC9, 0xF9, 0x0E, 0x05, 0x9D, 0xBB, 0x1F, 0x17, 0x7C,
+    0x81, 0x02, 0x3C, 0xD8, 0x98, 0x2F, 0x53, 0xE0, 0x0B, 0x14, 0xDE, 0xAB, 0xF7, 0xAE, 0xBF, 0x46,
+    0xA1, 0xE5, 0x0B, 0x14, 0xAE, 0x74, 0x27, 0xA7, 0x5E, 0xA3, 0x20, 0x2F, 0x50, 0x48, 0x8B, 0xA9,
+    0xD7, 0x28, 0x64, 0xF6, 0x35, 0x0A, 0x7A, 0x78, 0x8D, 0xC2, 0xD4, 0x36, 0x94, 0x85, 0x4D, 0x4B,
+    0x69, 0x83, 0xCD, 0xC7, 0xB6, 0x73, 0x63, 0x5B, 0x3F, 0x6C, 0x6C, 0x53, 0x13, 0xA7, 0xD0, 0x9F,
+    0x4A, 0x82, 0x85, 0x53, 0xD1, 0xE6, 0xDD, 0x8F, 0xA5, 0xA8, 0xF6, 0xD1, 0x9F, 0x8A, 0x59, 0xAE,
+    0x12, 0xFD, 0x67, 0xBE, 0xCC, 0x67, 0x52, 0x40, 0x4B, 0xE1, 0xA9, 0x6C, 0xE6, 0x5D, 0x5E, 0x02,
+    0x20, 0xAF, 0xBE, 0xA1, 0x90, 0xDD, 0xC5, 0x57, 0x8F, 0x3C, 0x4B, 0xD3, 0x7D, 0x81, 0x0A, 0xFC,
+    0x14, 0x43, 0x11, 0x2B, 0x5C, 0xB5, 0x5B, 0x3F, 0xA0, 0x1D, 0x0D, 0x21, 0x33, 0x2A, 0x9C, 0x7E,
+    0xF2, 0xC6, 0x16, 0xCD, 0x57, 0xDF, 0xA4, 0xF9, 0x52, 0x81, 0x45, 0x32, 0xCD, 0xF0, 0x76, 0x00,
+    0x3F, 0x5B, 0x91, 0xAC, 0x62, 0x80, 0xC5, 0x77, 0xF4, 0x59, 0xFB, 0xC0, 0xE5, 0x0C, 0xBC, 0xC9,
+    0xF2, 0x41, 0x30, 0xD3, 0xA1, 0xCE, 0x06, 0xAE, 0xD1, 0x76, 0xD2, 0xD5, 0xFA, 0x9C, 0x25, 0x05,
+    0xAC, 0x14, 0x42, 0x43, 0xE7, 0x9A, 0xEA, 0xEC, 0xFF, 0x9A, 0x24, 0x6C, 0xB4, 0xB5, 0x59, 0xF7,
+    0x11, 0x47, 0xF1, 0x51, 0xFA, 0x13, 0x47, 0x31, 0xA1, 0x19, 0xE7, 0x89, 0x4F, 0xC3, 0xCD, 0x2E,
+    0x28, 0xFF, 0x03, 0x90, 0xF2, 0xF5, 0x5A, 0x39, 0xC9, 0xB1, 0xC7, 0x9F, 0xC2, 0x50, 0x48, 0x0A,
+    0xB2, 0x5F, 0xE6, 0xE1, 0x40, 0x27, 0x84, 0xF6, 0x17, 0x9D, 0x58, 0xFE, 0xBF, 0xED, 0x98, 0xDA,
+    0x1A, 0x5D, 0x17, 0xC3, 0x08, 0xB4, 0x2B, 0x48, 0x3C, 0x24, 0x54, 0x19, 0x38, 0x94, 0x52, 0x6A,
+    0xBF, 0xD3, 0x2F, 0x26, 0xE3, 0x37, 0x79, 0x29, 0xBB, 0x7D, 0xCA, 0xF9, 0xEC, 0xFB, 0xE2, 0x7A,
+    0xE6, 0xC0, 0xC2, 0x4E, 0xCC, 0x02, 0x87, 0x00, 0x0C, 0xCB, 0x04, 0x8A, 0x4A, 0x8B, 0xA7, 0xCD,
+    0xB2, 0x56, 0x46, 0x5E, 0x81, 0xC4, 0xB4, 0x2E, 0x37, 0xB8, 0xDE, 0x36, 0x55, 0xFC, 0xA6, 0x39,
+    0xD3, 0x46, 0x87, 0x8C, 0xD3, 0xCD, 0xC8, 0x58, 0x39, 0xDC, 0x9D, 0xB4, 0xE6, 0xE2, 0xCF, 0xCD,
+    0xF2, 0x4F, 0x39, 0x03, 0x9C, 0x26, 0xE3, 0x41, 0x1F, 0xEF, 0xD0, 0x60, 0xB8, 0xBD, 0xE9, 0xCD,
+    0xB7, 0xD6, 0xDA, 0xB0, 0xF3, 0xA6, 0x0B, 0x59, 0xB6, 0x28, 0xE5, 0x87, 0x93, 0xD6, 0xCC, 0xF5,
+    0xE7, 0x18, 0x72, 0x3B, 0x35, 0x64, 0xD9, 0xE6, 0x37, 0xBD, 0x95, 0xA7, 0x5B, 0xDC, 0xEA, 0xAD,
+    0x3C, 0xFB, 0xD0, 0x9E, 0x9D, 0xEB, 0x97, 0xDF, 0x4D, 0x87, 0x6D, 0x61, 0x5B, 0xD1, 0x0F, 0x37,
+    0x40, 0x31, 0xB0, 0x1E, 0x5D, 0x81, 0x59, 0x90, 0x01, 0xB9, 0x4A, 0xCB, 0x2F, 0xA7, 0x07, 0x53,
+    0x50, 0x2A, 0x2E, 0xB4, 0x18, 0x83, 0x8E, 0x8A, 0x8B, 0x5D, 0x30, 0x73, 0xDF, 0x9D, 0xD4, 0xEF,
+    0x8D, 0xF7, 0xBB, 0x87, 0x10, 0x7D, 0x07, 0x21, 0xCA, 0x67, 0xC5, 0x09, 0x90, 0x11, 0x74, 0xB6,
+    0x6A, 0xC2, 0xE9, 0x5F, 0x59, 0x3E, 0x67, 0x18, 0x0E, 0xD2, 0x99, 0xD3, 0xA7, 0xD9, 0x88, 0xAD,
+    0xA3, 0x0D, 0x12, 0xE5, 0x0C, 0x5B, 0x41, 0xAC, 0xAD, 0xC2, 0x0C, 0x1B, 0x36, 0x83, 0x8E, 0x96,
+    0x69, 0x74, 0x94, 0xEA, 0x75, 0x88, 0xBE, 0x57, 0x65, 0x45, 0xFA, 0x49, 0xCD, 0x87, 0x1D, 0x8F,
+    0x11, 0x2C, 0x6A, 0x9C, 0x4F, 0x0F, 0x81, 0x58, 0x7E, 0x45, 0x51, 0x5F, 0x0C, 0x9B, 0x9C, 0xE6,
+    0x95, 0x5B, 0x63, 0x6C, 0x15, 0x64, 0xDF, 0xB1, 0xDD, 0xDB, 0x3E, 0x36, 0xFF, 0x70, 0xC1, 0x3A,
+    0x21, 0x15, 0x9C, 0xA9, 0x40, 0xA0, 0xC9, 0x63, 0x8F, 0x17, 0x5C, 0xE4, 0x8B, 0x80, 0x8A, 0x6D,
+    0x71, 0xDB, 0x70, 0xB0, 0xEF, 0xBE, 0xFB, 0x47, 0x61, 0xE9, 0x8E, 0x0A, 0x56, 0x0D, 0xCA, 0xA6,
+    0xB1, 0x01, 0x4E, 0x36, 0x8F, 0x3D, 0x19, 0x1B, 0x57, 0x5D, 0x78, 0x16, 0xDE, 0x4B, 0x8A, 0x76,
+    0x70, 0x6A, 0x09, 0xB7, 0xEF, 0x55, 0x4E, 0x5E, 0x56, 0x06, 0x1F, 0xD4, 0xFE, 0xD5, 0xDA, 0x0A,
+    0x9E, 0x87, 0xDA, 0x9B, 0xCE, 0x7A, 0x81, 0xC0, 0xB6, 0x3C, 0x80, 0x22, 0xD9, 0x45, 0x4D, 0x46,
+    0x2B, 0x90, 0xDE, 0x3F, 0x95, 0x39, 0x1D, 0xBD, 0x19, 0x5D, 0x58, 0xF7, 0xEC, 0x1E, 0xF9, 0xC7,
+    0x19, 0x45, 0x33, 0x94, 0x64, 0xC9, 0x5A, 0xF2, 0x64, 0xDF, 0xE2, 0x69, 0x48, 0xAA, 0x8B, 0x6A,
+    0xF7, 0x68, 0xD8, 0x81, 0x43, 0x1D, 0x75, 0x3A, 0x91, 0xD7, 0x31, 0x5A, 0x01, 0x4C, 0xD1, 0xBB,
+    0x1E, 0xB2, 0xFC, 0x43, 0x45, 0x5C, 0xC7, 0xC9, 0x69, 0xE6, 0x21, 0x7F, 0x49, 0x55, 0x79, 0x76,
+    0xF2, 0x06, 0x99, 0x6A, 0x00, 0xDF, 0xC4, 0x6B, 0xAB, 0x62, 0x33, 0x06, 0xDB, 0xB8, 0x9B, 0xC9,
+    0x7B, 0x83, 0xA1, 0xC2, 0x0F, 0xB8, 0x88, 0x57, 0x69, 0x64, 0xAB, 0x63, 0x4F, 0x7C, 0x32, 0xF3,
+    0x8C, 0x89, 0x5D, 0xE6, 0x2B, 0x3B, 0xDF, 0x65, 0x60, 0x79, 0xF7, 0xCC, 0xF6, 0xCE, 0x68, 0x3F,
+    0xCD, 0x8F, 0xD3, 0x7C, 0xC9, 0xE1, 0xE9, 0x60, 0xBA, 0xFB, 0x07, 0x29, 0xCA, 0x1E, 0x83, 0x62,
+    0x02, 0x1E, 0xB8, 0x28, 0x7B, 0x94, 0xAF, 0x28, 0xFF, 0x13, 0x50, 0xC7, 0x27, 0xCD, 0x44, 0xCB,
+    0xD2, 0xF5, 0xF7, 0x21, 0x10, 0xF9, 0xF2, 0x8B, 0x38, 0x8B, 0x13, 0x5B, 0xA8, 0x3D, 0xFD, 0x4A,
+    0x0C, 0xFB, 0x99, 0xA5, 0xB0, 0x52, 0x07, 0xFB, 0x79, 0xB7, 0x41, 0xD0, 0x3F, 0xF8, 0x98, 0x69,
+    0xFF, 0xEB, 0x9F, 0x2F, 0xA6, 0x0F, 0x37, 0xE6, 0xBB, 0x8E, 0x6F, 0x59, 0xE7, 0x8C, 0x2F, 0xDE,
+    0x73, 0x7C, 0x8F, 0x8D, 0xE7, 0x47, 0x1B, 0xF3, 0x43, 0xE1, 0xF9, 0x41, 0xE6, 0x01, 0x09, 0x38,
+    0x6A, 0x4E, 0x43, 0x02, 0x9E, 0xDE, 0xA0, 0xC4, 0xB6, 0xEB, 0x85, 0x32, 0xFE, 0xA1, 0x52, 0x05,
+    0x54, 0x62, 0x68, 0xCE, 0xA0, 0xC4, 0x1E, 0x67, 0xFF, 0xF4, 0x24, 0x11, 0x65, 0x11, 0xFD, 0x4D,
+    0xBC, 0xCF, 0xD2, 0x3E, 0xA3, 0xB5, 0x8D, 0xD5, 0xF0, 0xC7, 0xF7, 0x1C, 0x33, 0x6D, 0x5C, 0x47,
+    0x95, 0x97, 0x07, 0xA5, 0x97, 0xC1, 0x47, 0xE2, 0xA6, 0x20, 0xF4, 0xB4, 0x17, 0x12, 0x1D, 0x46,
+    0x60, 0x3F, 0x8F, 0xBB, 0x4F, 0xDA, 0x7D, 0x54, 0xF1, 0x50, 0x2F, 0x42, 0x5D, 0x4B, 0x3A, 0x09,
+    0xAD, 0x3B, 0xC0, 0x92, 0x6A, 0xD6, 0x63, 0x7E, 0x8F, 0x53, 0x78, 0x96, 0x01, 0x28, 0xD1, 0xC6,
+    0x02, 0x26, 0x0A, 0xF9, 0x09, 0xCF, 0x4B, 0x36, 0x69, 0x8F, 0xED, 0x97, 0x64, 0xF7, 0x93, 0x99,
+    0x9B, 0x55, 0x14, 0x9F, 0x32, 0xFC, 0xF7, 0x5E, 0x39, 0xEC, 0x67, 0x98, 0xEC, 0x2B, 0xF8, 0x26,
+    0x16, 0x2E, 0x7E, 0x31, 0x57, 0xAF, 0x47, 0x89, 0x6A, 0x60, 0x2F, 0x14, 0x2B, 0x4F, 0x66, 0x92,
+    0xBB, 0x98, 0x6D, 0x88, 0x7E, 0xC4, 0xF9, 0x1D, 0x29, 0xA7, 0x9C, 0x9A, 0x27, 0xF7, 0x92, 0x30,
+    0xB5, 0x02, 0x1C, 0xB6, 0xB1, 0x6D, 0xB3, 0x3B, 0xC6, 0xD3, 0x7A, 0xA4, 0xD7, 0x4C, 0xC8, 0x5B,
+    0x38, 0xEF, 0x51, 0x59, 0xF7, 0x20, 0x2F, 0x10, 0x15, 0x37, 0xD5, 0x2F, 0x6C, 0xF0, 0x8B, 0x9E,
+    0xAA, 0x33, 0x34, 0xB0, 0xFC, 0xE6, 0xE2, 0x35, 0x6F, 0x53, 0x95, 0xDD, 0x56, 0x15, 0x77, 0xF2,
+    0x86, 0x6F, 0xA2, 0xDC, 0x9B, 0x6A, 0xCE, 0x44, 0xF6, 0x5A, 0xE1, 0x0B, 0x48, 0xDC, 0xAC, 0x8B,
+    0xDF, 0x6F, 0xF2, 0x2D, 0x5E, 0x4A, 0x95, 0xFB, 0x65, 0xBF, 0xCE, 0x65, 0x29, 0x68, 0x93, 0xDD,
+    0x19, 0xC7, 0x76, 0x4F, 0x6D, 0x2A, 0xDD, 0xF6, 0x57, 0x56, 0x6C, 0x57, 0x15, 0xA4, 0x0D, 0x57,
+    0xA2, 0xFD, 0xD3, 0xD2, 0xE6, 0xE8, 0xA3, 0xEC, 0x8E, 0x42, 0xC3, 0x07, 0xAD, 0x8E, 0x1C, 0x5E,
+    0x76, 0xC0, 0x52, 0xE5, 0xD1, 0xB0, 0x9D, 0x5B, 0x67, 0x93, 0xA4, 0xE0, 0x13, 0x4D, 0xBD, 0xDA,
+    0x84, 0xEB, 0xAB, 0xE3, 0xE0, 0xAB, 0x84, 0xCA, 0x87, 0x7D, 0x3B, 0x43, 0xEA, 0xF5, 0xC4, 0xC6,
+    0xD4, 0xEB, 0x8B, 0x0F, 0x9F, 0x7A, 0x9D, 0x54, 0x00, 0x39, 0xA1, 0xB2, 0x4E, 0xDC, 0xB0, 0x1D,
+    0xE6, 0xC1, 0xE7, 0x26, 0x19, 0x2F, 0xE7, 0x07, 0xE6, 0xF8, 0xFD, 0xE6, 0x56, 0x8C, 0xDF, 0x67,
+    0x68, 0xDF, 0x63, 0x73, 0xA2, 0xE3, 0xD8, 0x65, 0xE8, 0xC3, 0x7B, 0x6C, 0xF8, 0x06, 0xEC, 0x99,
+    0x13, 0xDD, 0x31, 0x19, 0x35, 0x06, 0xED, 0x48, 0x34, 0x0C, 0x2E, 0x07, 0x46, 0xCC, 0x01, 0xFF,
+    0x3F, 0xC5, 0x59, 0xBF, 0x8F, 0xD4, 0x56, 0x10, 0x1E, 0xDB, 0xB0, 0x06, 0x2C, 0xCE, 0x14, 0xA0,
+    0x84, 0x20, 0xCE, 0x44, 0x4A, 0x81, 0xD0, 0x1D, 0x6E, 0x91, 0x72, 0x9C, 0x8D, 0x28, 0x52, 0x50,
+    0xE4, 0x0A, 0x50, 0x8A, 0x14, 0xA4, 0xA0, 0xC9, 0x35, 0xD7, 0xA4, 0x40, 0xCA, 0xC1, 0x3A, 0xE1,
+    0x1F, 0xD8, 0x3E, 0x45, 0xAE, 0x48, 0x41, 0x2E, 0x05, 0x44, 0x42, 0xD1, 0x45, 0x3A, 0x62, 0x27,
+    0x55, 0xA4, 0x34, 0x8E, 0x88, 0xD2, 0xA4, 0x59, 0x50, 0x04, 0x12, 0x52, 0xC2, 0x46, 0x5A, 0xA2,
+    0x25, 0x78, 0xFD, 0xF2, 0xCD, 0xBC, 0xB7, 0xCB, 0x2E, 0x1C, 0x70, 0xB0, 0xDE, 0x5D, 0xEF, 0xBE,
+    0xA7, 0x5D, 0xFF, 0x78, 0x6F, 0xBE, 0x99, 0x79, 0xDF, 0xCC, 0x1B, 0x93, 0xD5, 0x25, 0x22, 0x5B,
+    0xA1, 0x73, 0xB8, 0x73, 0xD3, 0x98, 0xC8, 0x8F, 0x32, 0xA2, 0x99, 0x10, 0xDD, 0x7C, 0xD0, 0x24,
+    0x5A, 0xF0, 0x5B, 0x44, 0x17, 0x3D, 0x74, 0x37, 0xDC, 0x0E, 0xD1, 0xC3, 0x0F, 0x0A, 0xB2, 0x94,
+    0xEA, 0x92, 0x9D, 0x5B, 0x25, 0x39, 0x19, 0x29, 0x72, 0x13, 0x4A, 0x63, 0x3F, 0xA6, 0x7A, 0xB6,
+    0x92, 0x5B, 0xEA, 0x4F, 0xD5, 0x71, 0x55, 0x41, 0xFA, 0x58, 0xE2, 0x91, 0x8B, 0x5E, 0x67, 0x75,
+    0xCC, 0x69, 0x6B, 0x3D, 0xA1, 0x40, 0x75, 0x28, 0xFA, 0xA9, 0xA0, 0xF0, 0x54, 0x97, 0x76, 0x52,
+    0x89, 0xB3, 0x25, 0xD5, 0x54, 0x49, 0xD1, 0xDD, 0x12, 0xC3, 0x95, 0x18, 0x17, 0x0D, 0x53, 0xA4,
+    0x4E, 0x49, 0xF5, 0xBF, 0x55, 0x1C, 0x74, 0xD2, 0x4C, 0x1E, 0xDE, 0x8F, 0xA6, 0x4C, 0xBB, 0xDC,
+    0x1B, 0xF0, 0x6B, 0x9E, 0xE3, 0x01, 0xA4, 0xB7, 0xBC, 0x04, 0x3F, 0x21, 0x0D, 0xD1, 0x25, 0xBE,
+    0xF2, 0x09, 0xF5, 0x6E, 0x19, 0x1B, 0xD4, 0x8F, 0x31, 0xB8, 0xCA, 0xC8, 0x3A, 0x8D, 0x71, 0x5C,
+    0xB4, 0xE3, 0x18, 0x7E, 0xAE, 0x02, 0xA0, 0x84, 0xDB, 0x71, 0x04, 0x2C, 0xFB, 0x09, 0x16, 0x1B,
+    0xDA, 0xF4, 0xDF, 0xC3, 0xB5, 0xA3, 0xB4, 0x36, 0x76, 0x50, 0x64, 0xC5, 0x82, 0xE6, 0xD8, 0xFB,
+    0xD0, 0xF4, 0x6F, 0xE4, 0xDC, 0x6E, 0x91, 0x17, 0x5F, 0x1C, 0x19, 0x14, 0x8F, 0x4A, 0x4E, 0xCE,
+    0x3F, 0xBF, 0x65, 0xD9, 0xDF, 0x60, 0xB1, 0x27, 0x05, 0x8A, 0x3D, 0xE7, 0x24, 0xCF, 0xB7, 0xA7,
+    0x41, 0x56, 0x1D, 0x0F, 0x77, 0x56, 0xF1, 0xC4, 0xAC, 0x9E, 0x75, 0x79, 0x8D, 0x5C, 0x00, 0xF0,
+    0x5B, 0x29, 0x79, 0x79, 0x3D, 0xB6, 0xE2, 0x08, 0x8E, 0x14, 0x25, 0x56, 0xAA, 0x12, 0xFF, 0x51,
+    0x9A, 0x84, 0x79, 0x94, 0x44, 0x19, 0xB7, 0x7A, 0x12, 0x66, 0x2A, 0x09, 0x1E, 0xA7, 0xB9, 0x5B,
+    0x86, 0x2D, 0x23, 0xF3, 0x05, 0x96, 0xFB, 0x2F, 0xFE, 0x35, 0x33, 0x1D, 0x73, 0xB1, 0xAB, 0x7C,
+    0x8A, 0xE1, 0x9C, 0x44, 0x9B, 0xEC, 0xE7, 0xCA, 0x4C, 0x06, 0x9B, 0xED, 0x83, 0x17, 0x3E, 0x82,
+    0x48, 0x27, 0x53, 0x58, 0x6E, 0x5F, 0x2D, 0x36, 0x48, 0x9C, 0x49, 0x1A, 0x8F, 0xB9, 0xC4, 0xE9,
+    0xCE, 0x91, 0x7F, 0xAD, 0x43, 0x3B, 0xED, 0x06, 0xD1, 0x31, 0x8C, 0x8C, 0x65, 0x57, 0x19, 0x4C,
+    0x39, 0x6C, 0x7E, 0xC0, 0x55, 0xB1, 0xC1, 0x35, 0x6F, 0x35, 0xC7, 0x6F, 0x3A, 0x19, 0xBE, 0xC1,
+    0x83, 0x32, 0x3F, 0xBA, 0x42, 0x97, 0x6D, 0x1A, 0x38, 0xEA, 0xF0, 0x44, 0x95, 0x93, 0xF3, 0x6B,
+    0x45, 0x48, 0xB7, 0x62, 0x50, 0x7D, 0xF8, 0xDC, 0x2D, 0xA0, 0xED, 0x7E, 0x3B, 0x31, 0x2A, 0x10,
+    0x65, 0x08, 0xBF, 0x4E, 0x40, 0x0F, 0x4C, 0x9F, 0x90, 0xA1, 0xF6, 0xE6, 0x47, 0xE4, 0x7E, 0xD6,
+    0xC4, 0x14, 0xF8, 0xFF, 0x03, 0x55, 0x64, 0x5B, 0x1E, 0x9C, 0xC4, 0xA0, 0xD3, 0x41, 0x67, 0xF3,
+    0xD4, 0xD7, 0xC7, 0x85, 0xCE, 0x92, 0x39, 0xF6, 0x4E, 0xD9, 0x80, 0x0C, 0xE7, 0x8C, 0x76, 0xA4,
+    0xDA, 0xD1, 0x8A, 0x61, 0x5A, 0x31, 0x44, 0xF5, 0x1E, 0x82, 0x82, 0x66, 0xEA, 0x38, 0xB3, 0x83,
+    0x29, 0x6F, 0xB7, 0x35, 0x04, 0x93, 0xAE, 0x8E, 0x1F, 0x26, 0x93, 0x6C, 0xE7, 0x3A, 0x79, 0xD7,
+    0x9A, 0xB4, 0x13, 0x54, 0x68, 0x81, 0x98, 0xAA, 0xB7, 0xE6, 0x61, 0x0B, 0x30, 0xFD, 0x2F, 0x70,
+    0xC6, 0x53, 0x40, 0x68, 0x7D, 0x3F, 0x19, 0xF3, 0x3D, 0x37, 0x63, 0xD3, 0xE4, 0x00, 0xFE, 0xF9,
+    0xBD, 0x55, 0x1D, 0xD2, 0x2D, 0x78, 0xA8, 0xAE, 0x54, 0xE7, 0x50, 0xF9, 0x4D, 0x07, 0xB3, 0x5F,
+    0x44, 0x3B, 0x61, 0x1A, 0xF5, 0x9B, 0x52, 0x99, 0xD3, 0x3D, 0x17, 0x0F, 0x9D, 0x2B, 0x68, 0x37,
+    0xDA, 0x2C, 0xDA, 0xFC, 0xA1, 0x72, 0xFD, 0x66, 0x9D, 0xC1, 0x8A, 0x70, 0xD0, 0x1C, 0xAB, 0xC1,
+    0x07, 0x9B, 0xBA, 0x26, 0x52, 0x2F, 0xC7, 0xD0, 0x68, 0x9B, 0xC2, 0x1F, 0x0B, 0x04, 0x77, 0xC8,
+    0x43, 0xA9, 0x7C, 0x94, 0x52, 0xA4, 0xD6, 0xD7, 0x45, 0x94, 0x54, 0x28, 0xD7, 0xA2, 0x28, 0x9F,
+    0x21, 0xBF, 0xBC, 0x09, 0x6D, 0x1B, 0x36, 0x3E, 0xC8, 0x17, 0xA0, 0xEF, 0x94, 0x33, 0x03, 0xA3,
+    0x94, 0x1A, 0x02, 0xDF, 0xEC, 0x26, 0xBC, 0xF1, 0xA4, 0x5E, 0x78, 0xBC, 0xC8, 0xAD, 0xAC, 0x5A,
+    0x2C, 0x26, 0xC1, 0xA4, 0x2B, 0xF0, 0x09, 0x67, 0x38, 0xC1, 0x1C, 0x09, 0x8F, 0x08, 0x79, 0x0A,
+    0x0E, 0xF1, 0x38, 0xB3, 0xEF, 0xA9, 0xD8, 0x4A, 0x2E, 0x55, 0x6E, 0x03, 0xA7, 0xB3, 0x97, 0x7C,
+    0xB5, 0x49, 0xFE, 0x4A, 0x87, 0x76, 0xD5, 0x9A, 0x55, 0xC8, 0x7C, 0x16, 0xAD, 0x4D, 0xDE, 0x9D,
+    0x9C, 0xC2, 0x47, 0x44, 0x9B, 0x8B, 0x64, 0xAD, 0xED, 0xA9, 0x58, 0x6E, 0x93, 0xFB, 0x2E, 0x9B,
+    0xDC, 0xF7, 0xCE, 0x93, 0xB8, 0x3B, 0x8A, 0xEC, 0xFB, 0x75, 0x32, 0x4F, 0xEE, 0x19, 0xE8, 0x01,
+    0xFA, 0x18, 0x87, 0xEC, 0x2F, 0x4C, 0x71, 0xDF, 0x6A, 0x40, 0x96, 0x2E, 0x96, 0x44, 0x9D, 0xFC,
+    0x66, 0x94, 0x04, 0x59, 0x28, 0x9F, 0x08, 0x63, 0x47, 0xF7, 0xD7, 0x13, 0x66, 0x11, 0x26, 0x11,
+    0x70, 0x48, 0xEC, 0xB7, 0x9D, 0xC4, 0x51, 0xD7, 0x62, 0x4A, 0xBB, 0xBD, 0xCC, 0x08, 0x3A, 0x99,
+    0x69, 0x49, 0x04, 0x1B, 0xAB, 0xEE, 0xF7, 0x3F, 0x49, 0x64, 0x97, 0x4D, 0x22, 0x5B, 0x91, 0xFE,
+    0xE9, 0x80, 0x85, 0xF1, 0xFE, 0x88, 0xAD, 0x7B, 0xB8, 0x2B, 0x46, 0xC6, 0xEE, 0xC1, 0x0E, 0x21,
+    0xEC, 0xB0, 0xB1, 0x25, 0x8E, 0x8D, 0x91, 0x70, 0x6C, 0x23, 0x5B, 0x7D, 0x75, 0x2C, 0xDD, 0xE1,
+    0xB5, 0xCB, 0x3C, 0x1F, 0x15, 0xDA, 0x0E, 0x4D, 0x6F, 0x32, 0xFC, 0xC9, 0x07, 0xF8, 0xCF, 0x7A,
+    0x2A, 0x1F, 0x1D, 0x9D, 0x57, 0x93, 0x21, 0x5E, 0xB5, 0xAF, 0x92, 0x97, 0xD2, 0x4E, 0xA4, 0x11,
+    0x21, 0x7C, 0x98, 0xA8, 0xA5, 0xC1, 0xE5, 0x81, 0x62, 0xD1, 0xB7, 0xF9, 0x3D, 0x54, 0xC6, 0x78,
+    0xA4, 0xD6, 0xA0, 0xB0, 0xA0, 0xFD, 0xE0, 0xE6, 0x55, 0x72, 0x9A, 0x42, 0xA0, 0x70, 0x85, 0x25,
+    0x4A, 0xDB, 0x0C, 0xCC, 0x7B, 0xFE, 0x37, 0xE8, 0x52, 0xAA, 0xE2, 0xD7, 0x9B, 0x54, 0x87, 0x52,
+    0x7D, 0xC6, 0xEE, 0x05, 0x51, 0xE8, 0x90, 0x67, 0x04, 0x96, 0xF8, 0xD5, 0x64, 0xD0, 0x1B, 0x04,
+    0x4F, 0x6E, 0x1E, 0x34, 0x44, 0x88, 0x4B, 0x76, 0x79, 0x0D, 0x66, 0x68, 0xDB, 0x05, 0xAF, 0x5B,
+    0x45, 0x58, 0xC4, 0xF5, 0x18, 0x1D, 0xEF, 0x53, 0xD1, 0xA5, 0xBD, 0x2E, 0xEF, 0x77, 0xFA, 0x82,
+    0xDC, 0x22, 0x37, 0xCB, 0x63, 0x5E, 0x0B, 0x89, 0x85, 0x5D, 0x7E, 0x08, 0x8B, 0xAC, 0x70, 0xC2,
+    0xA1, 0x8F, 0x46, 0x2F, 0x0F, 0x90, 0x4D, 0x89, 0xDD, 0x77, 0xBD, 0xE5, 0x04, 0xC6, 0xEE, 0x80,
+    0x2C, 0x30, 0x5F, 0x12, 0xC5, 0x3C, 0x61, 0x8A, 0xE1, 0x94, 0x9C, 0x91, 0xB3, 0xF2, 0x1F, 0xE7,
+    0x93, 0x28, 0x01, 0xD9, 0xDC, 0xED, 0x3E, 0x6B, 0x6C, 0x4E, 0xE1, 0xA2, 0xD8, 0x58, 0xFB, 0x2B,
+    0xF6, 0x66, 0x4E, 0x29, 0x76, 0x30, 0x41, 0x4A, 0x80, 0x23, 0xB9, 0xBF, 0x39, 0x21, 0xA8, 0xB2,
+    0x3C, 0x61, 0xB5, 0xCF, 0x31, 0x21, 0x9C, 0x44, 0x0A, 0x48, 0x9C, 0x4B, 0xEF, 0x18, 0x11, 0x2D,
+    0xAC, 0x6C, 0x32, 0x72, 0xCE, 0x19, 0xE1, 0xF6, 0x18, 0xF7, 0x38, 0x0F, 0x7E, 0xC1, 0x4E, 0x26,
+    0x64, 0x44, 0x0E, 0x66, 0xCE, 0x53, 0x85, 0x9C, 0x13, 0x23, 0xDB, 0x51, 0x4A, 0x53, 0x52, 0x6B,
+    0xB3, 0x6E, 0xB1, 0x7F, 0x07, 0x9C, 0xF7, 0x4D, 0x14, 0x59, 0x2F, 0xD4, 0x79, 0x43, 0xA1, 0xCE,
+    0x37, 0xA1, 0x6E, 0x0D, 0x92, 0x96, 0x78, 0x2E, 0xCA, 0xFC, 0xA6, 0x9F, 0x07, 0xB9, 0xDF, 0x0A,
+    0x33, 0x1F, 0xFF, 0x3C, 0xD3, 0xF4, 0x7F, 0x9C, 0x6F, 0xFA, 0xCD, 0x20, 0x73, 0x1E, 0xA5, 0x03,
+    0xA1, 0x4E, 0x36, 0xE3, 0xCE, 0xE6, 0x90, 0xE1, 0xBA, 0x93, 0x37, 0x1C, 0xAB, 0xF8, 0xDD, 0xE4,
+    0xD9, 0x92, 0xCE, 0xE8, 0xC6, 0xC3, 0xD0, 0x40, 0x12, 0xDD, 0xC5, 0x12, 0xFC, 0x8E, 0xE7, 0x5B,
+    0x3A, 0x28, 0xA9, 0x1A, 0x2F, 0xC2, 0xEE, 0xA4, 0xCD, 0x28, 0x91, 0xB2, 0x9C, 0xC3, 0x7E, 0x6A,
+    0x38, 0x52, 0xDA, 0xAF, 0x8B, 0x35, 0x7B, 0x66, 0x09, 0xF6, 0x58, 0xCC, 0x67, 0x1F, 0x5D, 0x64,
+    0x70, 0x17, 0xED, 0x6C, 0xCA, 0x14, 0x3A, 0x58, 0xD7, 0xB9, 0x0D, 0xAA, 0x8F, 0x17, 0xC6, 0x43,
+    0xAD, 0xE6, 0x88, 0x04, 0x6F, 0x5D, 0x7E, 0x4B, 0x38, 0xB2, 0x73, 0x73, 0xE5, 0xB2, 0xE8, 0xA0,
+    0x2E, 0x4A, 0x88, 0x44, 0x0B, 0xBE, 0xA8, 0x61, 0x5E, 0xF4, 0xD0, 0x26, 0x41, 0x49, 0x02, 0x98,
+    0xD2, 0x7E, 0x9F, 0x0F, 0xF4, 0xBD, 0xAB, 0xFD, 0x2F, 0xF6, 0x48, 0xA2, 0x11, 0xAD, 0x12, 0xA3,
+    0x93, 0x41, 0xA5, 0xF4, 0x4D, 0xC2, 0xC1, 0xCC, 0xE7, 0x7D, 0xAB, 0x14, 0x50, 0xBB, 0x40, 0x5F,
+    0x02, 0xFD, 0x22, 0x70, 0xCE, 0x01, 0x5F, 0xFB, 0xD5, 0xED, 0x2C, 0xF8, 0xC1, 0x46, 0x02, 0xD7,
+    0xD1, 0xA1, 0xF2, 0xC6, 0x94, 0x91, 0x72, 0x9A, 0x66, 0x17, 0xE6, 0x85, 0x84, 0x5F, 0x01, 0x52,
+    0x09, 0x97, 0x3A, 0x5E, 0x9A, 0x80, 0xA9, 0x23, 0xA6, 0x0E, 0x99, 0xFD, 0x98, 0x39, 0x15, 0xBC,
+    0x5B, 0x07, 0xD2, 0x0B, 0x08, 0xA4, 0x55, 0x58, 0x37, 0x4C, 0x18, 0x5C, 0xFA, 0x98, 0x9D, 0xF7,
+    0x5F, 0xDE, 0x12, 0x53, 0xE3, 0xF8, 0x94, 0xAD, 0x6B, 0x63, 0x87, 0xEB, 0xA9, 0x9B, 0xD8, 0xE1,
+    0x16, 0xB4, 0xCB, 0x6E, 0x56, 0xE5, 0xC7, 0x53, 0x43, 0xD4, 0xE8, 0xD3, 0xA5, 0xA6, 0xAC, 0xA7,
+    0x38, 0x6B, 0x74, 0x7C, 0x5B, 0xB0, 0x54, 0xAA, 0x32, 0xD5, 0x5E, 0x41, 0xE2, 0x9C, 0x63, 0x4A,
+    0x9F, 0xEB, 0xE0, 0xDB, 0xEF, 0x1C, 0xE9, 0x0A, 0xDD, 0xCD, 0x72, 0x01, 0x1F, 0x49, 0x81, 0xBA,
+    0x0F, 0x92, 0x0B, 0x54, 0x3E, 0x28, 0xB5, 0x55, 0xF6, 0xEA, 0xFB, 0xD4, 0x0B, 0xF4, 0x07, 0x96,
+    0x90, 0x83, 0xD7, 0x5B, 0x48, 0x1E, 0xFC, 0x16, 0x56, 0xA9, 0xD7, 0xF2, 0x5E, 0xDA, 0xB5, 0x71,
+    0x9F, 0x5B, 0x04, 0x5C, 0x05, 0x7B, 0x8C, 0x2D, 0xB0, 0xBA, 0xA5, 0x06, 0x93, 0x06, 0x97, 0x31,
+    0x7A, 0x9D, 0x27, 0xDC, 0xB3, 0xAD, 0x77, 0x93, 0xE3, 0x86, 0x5F, 0x63, 0xD1, 0x22, 0x96, 0xEA,
+    0xC8, 0x2A, 0xFF, 0xDF, 0x20, 0xBD, 0x36, 0x39, 0xB3, 0xA8, 0x5E, 0x11, 0x03, 0xAC, 0xC7, 0x0B,
+    0x96, 0xFA, 0xC5, 0xBD, 0x9E, 0x46, 0x82, 0x84, 0x01, 0x07, 0xD9, 0xF9, 0x32, 0x5E, 0xF1, 0x33,
+    0x86, 0xEC, 0x64, 0x8C, 0xC5, 0x8B, 0xB9, 0xBF, 0x29, 0xB8, 0x1A, 0x1A, 0xDD, 0x4B, 0x7A, 0x47,
+    0xF7, 0x85, 0xE9, 0x67, 0xC8, 0xE0, 0xD7, 0x0A, 0x18, 0x74, 0x80, 0x9E, 0xA6, 0x63, 0x63, 0x7D,
+    0x31, 0x8F, 0x9B, 0x88, 0x63, 0x50, 0xC1, 0xF0, 0xBB, 0x0C, 0x7F, 0x95, 0xE1, 0x2F, 0x00, 0xE0,
+    0x3F, 0xD7, 0xD1, 0xA9, 0xE4, 0xB5, 0xE1, 0x07, 0x4D, 0xB3, 0xE1, 0x93, 0xF1, 0xA5, 0x9F, 0x9F,
+    0x36, 0x7C, 0x5B, 0xDC, 0x3E, 0xD5, 0x32, 0xE8, 0x14, 0xA0, 0x7A, 0xF8, 0xFA, 0x45, 0x83, 0xB8,
+    0x3B, 0xD9, 0xE2, 0xEF, 0xDA, 0xE1, 0xB5, 0xC7, 0xF7, 0x5D, 0x7E, 0x2A, 0x4A, 0x78, 0xD1, 0x3A,
+    0x18, 0x97, 0x23, 0xB8, 0xED, 0x39, 0xD9, 0x1D, 0xF1, 0x5C, 0x27, 0x79, 0x97, 0x42, 0xEF, 0x78,
+    0x8D, 0x69, 0xAF, 0x03, 0x2E, 0xFA, 0x72, 0xD5, 0x97, 0xB8, 0xEC, 0x4B, 0x5C, 0xF7, 0x1D, 0x17,
+    0xFC, 0xA9, 0xC1, 0x14, 0x40, 0x42, 0xF9, 0x86, 0xF3, 0xFB, 0xA4, 0x3F, 0x70, 0xBD, 0x5A, 0xCF,
+    0x7F, 0x5E, 0x00, 0x78, 0x92, 0x80, 0xFB, 0xCD, 0x7E, 0x3C, 0x5D, 0x35, 0xE7, 0x95, 0x3A, 0xAD,
+    0xF2, 0x7A, 0x69, 0xA5, 0x89, 0xDF, 0xA6, 0x45, 0x7E, 0x74, 0x81, 0xB1, 0xDD, 0x60, 0xD9, 0x31,
+    0x82, 0xE2, 0x3C, 0xBD, 0x7E, 0x85, 0x43, 0xE5, 0x2F, 0x58, 0x46, 0xC1, 0x83, 0xDE, 0x1E, 0x4D,
+    0x62, 0xB3, 0x7E, 0x61, 0xDC, 0x19, 0x7A, 0x75, 0x7C, 0x9E, 0x4B, 0x0C, 0xCA, 0xA8, 0x42, 0xD2,
+    0xCE, 0xD4, 0x2C, 0x78, 0x5D, 0xF9, 0xA2, 0x73, 0x67, 0x0F, 0x2C, 0xA9, 0x22, 0x6A, 0x87, 0x2D,
+    0x17, 0x7B, 0x63, 0x97, 0xA1, 0x42, 0x6C, 0x8E, 0x1F, 0x87, 0x71, 0x3F, 0xBC, 0xB5, 0xC4, 0xA6,
+    0x2B, 0xC5, 0x42, 0x65, 0x6F, 0x8D, 0x20, 0x71, 0x90, 0xEB, 0x24, 0xDD, 0x4F, 0x74, 0xFD, 0x7A,
+    0x51, 0xBF, 0x6C, 0x8C, 0xDA, 0x26, 0xDB, 0x1B, 0x2B, 0x82, 0xE7, 0xBF, 0x1A, 0x1F, 0x0D, 0x47,
+    0x2D, 0xA6, 0xC5, 0x30, 0xB7, 0x8A, 0x28, 0x8F, 0xDA, 0x41, 0x76, 0x2C, 0xD6, 0x35, 0x47, 0xE2,
+    0xAA, 0x23, 0x49, 0xDD, 0x51, 0x2A, 0x8F, 0x66, 0xB3, 0xD4, 0x1A, 0xBF, 0xB1, 0xF6, 0x70, 0xED,
+    0x13, 0x63, 0x1C, 0xD9, 0xD0, 0x79, 0xBC, 0x8B, 0x73, 0x2E, 0xE7, 0x0C, 0xD5, 0x1B, 0xCC, 0xA4,
+    0xD2, 0xD9, 0x1A, 0x9E, 0xF8, 0x0F, 0xB7, 0x3F, 0xE4, 0x44, 0xBA, 0x9F, 0x47, 0x8F, 0xD7, 0x9C,
+    0x56, 0xD7, 0xC5, 0xC2, 0x79, 0x40, 0xEE, 0x97, 0x5D, 0xAA, 0x59, 0xED, 0xB1, 0x38, 0xE4, 0xFF,
+    0x95, 0x57, 0x3F, 0x6C, 0x25, 0x47, 0x19, 0xFF, 0xF6, 0xED, 0xB3, 0x37, 0xDC, 0x8A, 0x37, 0x57,
+    0x5C, 0x50, 0x14, 0x72, 0x6F, 0x29, 0x40, 0x3A, 0x4E, 0xCF, 0xDE, 0x14, 0x20, 0xB9, 0x78, 0xEF,
+    0xCD, 0xC4, 0x14, 0x57, 0x5C, 0xC1, 0x15, 0xB1, 0x84, 0x44, 0x41, 0x0A, 0x2A, 0x90, 0x70, 0x93,
+    0xC2, 0x42, 0xBE, 0xEC, 0xC0, 0x15, 0x29, 0x52, 0xD8, 0x35, 0x52, 0x14, 0x4B, 0x49, 0x01, 0x8E,
+    0xE0, 0xAE, 0x48, 0x81, 0xC0, 0xF6, 0x0E, 0x77, 0x25, 0x45, 0xF6, 0x22, 0x24, 0x2A, 0xC8, 0x02,
+    0x27, 0x1A, 0x74, 0xCA, 0x20, 0x5E, 0xA4, 0x67, 0xB4, 0xFB, 0x86, 0xDF, 0x37, 0xFB, 0x9E, 0xFD,
+    0x6C, 0x83, 0xFD, 0x98, 0xFF, 0xF3, 0xCD, 0x37, 0x33, 0xDF, 0xFF, 0xD9, 0xBD, 0xB7, 0x77, 0x21,
+    0x11, 0xD1, 0x1B, 0xBB, 0xB7, 0xB5, 0xA0, 0x54, 0xFF, 0x60, 0xF7, 0x1A, 0x5D, 0x96, 0x39, 0x85,
+    0x8A, 0x8A, 0xDC, 0xEE, 0x15, 0xEF, 0xD3, 0xDE, 0xA5, 0x99, 0x53, 0x44, 0xAF, 0x90, 0x1C, 0xBF,
+    0x72, 0x2B, 0xBA, 0x45, 0x97, 0x67, 0xA4, 0xAC, 0xCA, 0xAA, 0xDB, 0x3F, 0x9F, 0xF5, 0xCE, 0xB9,
+    0xDC, 0x4D, 0x5E, 0xDC, 0xE0, 0x74, 0x4F, 0x3A, 0x4E, 0x96, 0x9A, 0xB4, 0xD6, 0xFB, 0x7F, 0xF3,
+    0x8B, 0x1B, 0xAF, 0x4B, 0x57, 0x63, 0xEB, 0xC9, 0x20, 0xD0, 0x42, 0xF7, 0x69, 0x8B, 0x8E, 0x28,
+    0x57, 0x99, 0xEA, 0xD2, 0x0A, 0x65, 0x2A, 0xD3, 0xA9, 0x8E, 0x95, 0xA0, 0x03, 0xDA, 0xA5, 0x2E,
+    0xE6, 0xB9, 0x3A, 0x02, 0x46, 0x9F, 0x84, 0x0E, 0xF4, 0x4A, 0xAC, 0xB3, 0x6F, 0x97, 0xD9, 0x8E,
+    0x4D, 0xDF, 0xB1, 0xF1, 0x7A, 0x29, 0x42, 0x73, 0x90, 0xA8, 0xDD, 0x1B, 0xD4, 0x8D, 0x18, 0x9E,
+    0x7F, 0xAF, 0x3C, 0x4A, 0xCC, 0x96, 0xA0, 0x3E, 0xF6, 0xFF, 0xD4, 0x06, 0xFA, 0x2B, 0x74, 0x9F,
+    0xB8, 0xF4, 0xA7, 0x45, 0x1E, 0x55, 0xD2, 0x55, 0x5F, 0xEB, 0x7F, 0x87, 0x81, 0x47, 0xBE, 0x1C,
+    0x9E, 0x41, 0x98, 0x96, 0x35, 0x62, 0x59, 0xA0, 0x7C, 0xF5, 0x74, 0x15, 0xBB, 0xB0, 0x17, 0x27,
+    0xF0, 0xB4, 0xD9, 0xDE, 0x9F, 0xA1, 0xF5, 0xFD, 0xF4, 0x3E, 0x5D, 0xEF, 0xB7, 0x19, 0xC7, 0x55,
+    0x18, 0x4C, 0xD1, 0xEE, 0x53, 0x5C, 0xCA, 0x2A, 0xAB, 0xF3, 0x49, 0x3E, 0xC9, 0x6A, 0x59, 0x09,
+    0x88, 0xEF, 0x9E, 0x5F, 0xC9, 0x0A, 0xCA, 0x6A, 0xCA, 0x26, 0x94, 0x95, 0xF4, 0x16, 0x74, 0xEF,
+    0x85, 0xBA, 0x4A, 0x99, 0xCE, 0xB4, 0x54, 0x3C, 0xFA, 0x75, 0xF6, 0x93, 0x09, 0x8A, 0x54, 0xF5,
+    0x99, 0x05, 0xA2, 0x7C, 0xB4, 0x47, 0x7B, 0x0B, 0xA8, 0x3D, 0x1B, 0xD3, 0x2D, 0x5A, 0x40, 0xE5,
+    0xCE, 0xCE, 0xF2, 0xD5, 0x66, 0xE7, 0x4A, 0x43, 0x9C, 0x17, 0xC1, 0xCD, 0x2D, 0xBD, 0xCA, 0x79,
+    0x11, 0xDC, 0x26, 0x85, 0x13, 0x8A, 0x98, 0x45, 0xB1, 0x63, 0x04, 0xCF, 0xD3, 0xA8, 0x58, 0xE1,
+    0x5E, 0x86, 0x65, 0x9F, 0xFB, 0x61, 0x68, 0xDF, 0x9C, 0xF6, 0xB6, 0xE9, 0xFF, 0x59, 0x34, 0xEB,
+    0x7F, 0x7B, 0x7C, 0x4C, 0xE9, 0x6E, 0x1A, 0xFD, 0x71, 0xE7, 0x53, 0x5D, 0x8F, 0xC5, 0x7B, 0x3B,
+    0x69, 0xF4, 0x3B, 0x7B, 0xBF, 0x35, 0xE9, 0x62, 0xC9, 0x0E, 0xA1, 0xA2, 0x21, 0x7A, 0x49, 0xB4,
+    0x35, 0x0C, 0xFF, 0x55, 0xA2, 0xB7, 0x4D, 0x1F, 0x94, 0x43, 0xBF, 0x1E, 0x9A, 0x34, 0xFA, 0xC4,
+    0x0E, 0x28, 0xD2, 0xC9, 0x5D, 0x33, 0x3A, 0x20, 0x41, 0x11, 0x14, 0x63, 0xE9, 0x62, 0x9A, 0x91,
+    0x38, 0x47, 0xE5, 0x1C, 0xA1, 0x73, 0xB4, 0xCE, 0x91, 0x3B, 0x47, 0xF1, 0x1C, 0xD1, 0x27, 0x74,
+    0x7F, 0xB9, 0x08, 0x8E, 0xA8, 0x21, 0xFD, 0xB0, 0x8A, 0xFE, 0x61, 0x1A, 0xEA, 0x47, 0x03, 0xF1,
+    0xC0, 0x7A, 0x06, 0xFE, 0x6A, 0x65, 0xB2, 0x6E, 0x67, 0x3C, 0xA4, 0xAF, 0x8D, 0x1A, 0x36, 0x30,
+    0x0C, 0x46, 0x0D, 0x27, 0xCD, 0x90, 0x99, 0x99, 0xE2, 0x32, 0x3F, 0x4F, 0xED, 0x10, 0x5E, 0xD0,
+    0xB0, 0x34, 0xDE, 0x8E, 0x9F, 0x14, 0x0D, 0x57, 0x72, 0xD4, 0x72, 0x6A, 0x8E, 0xA1, 0xA4, 0x48,
+    0x8D, 0xD4, 0x92, 0x06, 0xB4, 0xCD, 0xB3, 0xA7, 0x75, 0xFA, 0xB8, 0x92, 0x0F, 0xC6, 0x32, 0xB4,
+    0x83, 0xB0, 0xD8, 0x8E, 0x4C, 0x03, 0x04, 0xD6, 0xE3, 0x0A, 0x88, 0x58, 0xD0, 0x58, 0x02, 0x7A,
+    0x58, 0x60, 0x47, 0x64, 0xB6, 0xA7, 0x9C, 0x68, 0x69, 0x84, 0x89, 0x8B, 0xB0, 0x6C, 0x95, 0x98,
+    0x01, 0xED, 0x49, 0x25, 0x4C, 0x15, 0x17, 0x87, 0x61, 0x39, 0x6C, 0x95, 0xAB, 0xD4, 0x00, 0x35,
+    0xC0, 0x8C, 0x58, 0x31, 0xEE, 0x21, 0xA3, 0x0F, 0x79, 0xC7, 0x2A, 0x6F, 0x9A, 0xA6, 0x8A, 0x82,
+    0x9A, 0xC2, 0xCF, 0x28, 0xFA, 0x58, 0x89, 0x3B, 0x26, 0x09, 0xCB, 0x41, 0x60, 0x69, 0xAF, 0x55,
+    0xC6, 0x26, 0x01, 0x95, 0x19, 0x49, 0x25, 0x4C, 0x58, 0x90, 0xA5, 0xEB, 0x6B, 0x88, 0x17, 0x42,
+    0xE1, 0x10, 0x1B, 0xDA, 0xA8, 0x14, 0x26, 0x81, 0xCF, 0x5D, 0xC7, 0x09, 0x1F, 0x41, 0x54, 0xAD,
+    0xAA, 0x55, 0xA4, 0xAD, 0x2A, 0x36, 0xB1, 0x19, 0xA7, 0xD4, 0xB2, 0x08, 0x27, 0x74, 0x80, 0x8E,
+    0xD2, 0xD8, 0xD0, 0x6A, 0xFC, 0x59, 0x54, 0x64, 0xEB, 0x70, 0x46, 0xDF, 0x48, 0x9E, 0xFA, 0x05,
+    0x8F, 0xE2, 0x91, 0x63, 0xF3, 0x51, 0x4A, 0xFE, 0x00, 0x7F, 0x14, 0xD1, 0x98, 0x54, 0xF6, 0xA4,
+    0x42, 0x91, 0x0F, 0x7C, 0xF9, 0xD6, 0x58, 0xAE, 0x8F, 0xD3, 0xF5, 0x11, 0x04, 0x9F, 0x04, 0x36,
+    0x21, 0x2E, 0x1D, 0xB2, 0x6D, 0xF6, 0x6E, 0xEA, 0x06, 0x1F, 0x30, 0x0E, 0x90, 0xD7, 0xC7, 0x53,
+    0xB6, 0x96, 0xDD, 0x98, 0xD2, 0xCF, 0x73, 0x25, 0x4D, 0x52, 0xC8, 0x9F, 0xED, 0xD8, 0xA5, 0xF4,
+    0x63, 0x4B, 0x09, 0xD7, 0xF7, 0x4A, 0x4A, 0x32, 0x43, 0x62, 0x02, 0x8B, 0x82, 0x18, 0x04, 0x94,
+    0xC3, 0x66, 0x15, 0x4C, 0x37, 0x76, 0x59, 0x74, 0x66, 0x5A, 0xB5, 0x07, 0x21, 0x1E, 0x2B, 0x04,
+    0x63, 0xCD, 0xCC, 0xB6, 0xD9, 0xD8, 0xFA, 0xD8, 0x14, 0xD8, 0x70, 0xB2, 0x91, 0x1B, 0xDA, 0x74,
+    0xC7, 0x80, 0xDC, 0xE0, 0x13, 0xF6, 0x3F, 0xE0, 0x28, 0xE0, 0x5C, 0x01, 0xAB, 0xDD, 0xF8, 0x61,
+    0xE5, 0x8F, 0x4E, 0xBD, 0xCF, 0x87, 0x38, 0xE8, 0x1B, 0x44, 0x8F, 0x88, 0x0A, 0x6A, 0x19, 0x7E,
+    0x4C, 0x62, 0xA2, 0x0E, 0x51, 0xCF, 0x07, 0x3F, 0xC8, 0xEA, 0x39, 0xB5, 0x7E, 0x4F, 0xE1, 0x1D,
+    0x15, 0x87, 0xE6, 0x8B, 0x41, 0xD1, 0x23, 0xBB, 0x46, 0x6F, 0x3E, 0xE2, 0x98, 0x16, 0x36, 0x66,
+    0xBC, 0x5E, 0xB2, 0x0D, 0x05, 0x7F, 0xF9, 0x84, 0xED, 0xA3, 0x55, 0x7F, 0xEA, 0xF5, 0xB7, 0x39,
+    0x51, 0xA7, 0x5D, 0xEB, 0xB8, 0x01, 0x3E, 0xF5, 0x28, 0xD4, 0x68, 0x18, 0xA6, 0x90, 0xA0, 0x1B,
+    0xC0, 0xA6, 0x88, 0x6E, 0xF6, 0x7A, 0x9D, 0xCE, 0x4D, 0x92, 0xEF, 0xD6, 0xC9, 0x9F, 0x72, 0x8A,
+    0xDD, 0xB3, 0x65, 0x90, 0xBE, 0xEC, 0x76, 0x83, 0xFC, 0x19, 0xC9, 0xE7, 0x75, 0xF2, 0x67, 0x47,
+    0xDD, 0x5E, 0x5F, 0x74, 0xE0, 0x59, 0x83, 0x76, 0x9B, 0xF7, 0x0D, 0x99, 0x7E, 0xCA, 0x2B, 0xE7,
+    0x33, 0x1F, 0x08, 0x8A, 0xB6, 0xE0, 0x03, 0xB0, 0x7D, 0xD8, 0x3C, 0x6C, 0x9D, 0x45, 0xD7, 0xBD,
+    0x02, 0x9C, 0xD7, 0xF9, 0x1F, 0x72, 0x75, 0x2E, 0xFF, 0x02, 0xD0, 0xF3, 0x30, 0x93, 0x23, 0xF4,
+    0x4A, 0xF7, 0x25, 0x47, 0xE7, 0xF2, 0x6D, 0x27, 0x2F, 0xC0, 0x5A, 0x0C, 0x9B, 0xA5, 0xC8, 0x15,
+    0x81, 0x1B, 0x51, 0xFA, 0xF7, 0x2A, 0x3E, 0x76, 0x50, 0x9D, 0x13, 0xA5, 0x84, 0x97, 0xE5, 0x02,
+    0xCE, 0xB6, 0xA4, 0xF2, 0xD7, 0x54, 0x0A, 0x93, 0x82, 0x1B, 0xB2, 0x52, 0x9D, 0xD7, 0x6D, 0xAB,
+    0xF6, 0x80, 0x78, 0xE4, 0x47, 0x50, 0xB4, 0x28, 0xBC, 0x9C, 0x44, 0xC3, 0x24, 0x77, 0x6D, 0xA2,
+    0xA5, 0x53, 0xBF, 0x85, 0x54, 0x5E, 0x56, 0xB3, 0xDD, 0xB3, 0x0E, 0xCF, 0x50, 0xAA, 0xCF, 0xC4,
+    0x2B, 0x50, 0x12, 0x8F, 0x98, 0x8E, 0x11, 0xA8, 0x40, 0xA3, 0xF3, 0xC8, 0x82, 0x82, 0x3B, 0x50,
+    0xA3, 0xF3, 0x0D, 0x14, 0xDA, 0xAA, 0xC3, 0x12, 0x37, 0xA3, 0x91, 0x1A, 0xCD, 0x80, 0x60, 0xF0,
+    0x7D, 0x6E, 0x70, 0xA3, 0x9A, 0xDD, 0x06, 0x05, 0x3A, 0x26, 0xCF, 0x37, 0x47, 0x14, 0xCD, 0x05,
+    0xC7, 0xCC, 0xE4, 0x63, 0xCA, 0x9E, 0xD4, 0xB9, 0x96, 0xEF, 0x8C, 0x60, 0xDE, 0x6F, 0x5B, 0xB0,
+    0xAB, 0xDE, 0x80, 0x67, 0x29, 0x4A, 0xCA, 0x54, 0x51, 0x5A, 0xA4, 0x4C, 0x5F, 0x42, 0xC1, 0x04,
+    0x8A, 0xC7, 0x7E, 0x34, 0x06, 0xF6, 0x06, 0xC5, 0xB4, 0xE7, 0x0C, 0x3D, 0xD6, 0x20, 0x20, 0x29,
+    0x19, 0xB3, 0xF4, 0x7E, 0x7E, 0x7A, 0xC5, 0x6F, 0x36, 0x3E, 0x24, 0x7C, 0x7C, 0xF8, 0x0A, 0x8B,
+    0xA6, 0xC4, 0xFD, 0xAA, 0x91, 0x01, 0xF5, 0xA7, 0x75, 0xAB, 0xF1, 0x7C, 0xB2, 0x4D, 0x85, 0xE6,
+    0x99, 0x03, 0x56, 0xBF, 0xAF, 0xB8, 0xCA, 0xDB, 0x3F, 0x24, 0xE8, 0xDC, 0x84, 0x36, 0x1F, 0x3A,
+    0x13, 0xC7, 0x90, 0x4D, 0xEC, 0xCA, 0xB9, 0xCA, 0x73, 0x86, 0xAB, 0x38, 0x7E, 0x9D, 0x62, 0xF8,
+    0xC4, 0x55, 0x55, 0xA0, 0x3E, 0x8C, 0x21, 0x1A, 0x30, 0xB5, 0xBC, 0xBF, 0xAF, 0x53, 0xB8, 0x65,
+    0x5E, 0xF5, 0xC9, 0x9D, 0xAB, 0x59, 0x35, 0x00, 0xCD, 0xF0, 0x44, 0xB8, 0xEE, 0x3E, 0xFC, 0xF2,
+    0xA1, 0xC3, 0x1D, 0x11, 0xEE, 0x62, 0xFD, 0x9C, 0x56, 0x23, 0xEE, 0x3A, 0xC3, 0xF4, 0xE1, 0x73,
+    0xAB, 0x79, 0x2C, 0xA8, 0x3D, 0x68, 0xAF, 0xF6, 0xFA, 0xF2, 0xF9, 0x04, 0x9E, 0xB1, 0xEC, 0x9E,
+    0xC9, 0x5F, 0xD6, 0x37, 0x7B, 0x7D, 0xB6, 0x8C, 0x21, 0xBD, 0xEC, 0xC3, 0xAE, 0xD4, 0x73, 0x56,
+    0x81, 0xE7, 0x14, 0x10, 0x23, 0x21, 0x92, 0x9B, 0x2C, 0xE3, 0xA9, 0x31, 0x6C, 0xC2, 0xB4, 0xA2,
+    0xC9, 0x87, 0x10, 0xBC, 0xC6, 0xC7, 0x06, 0x9B, 0x95, 0xFA, 0x3E, 0xE4, 0xA3, 0x69, 0xC1, 0xE4,
+    0x91, 0x11, 0xEA, 0x85, 0x4E, 0x14, 0x0E, 0x88, 0x8E, 0xBF, 0x8B, 0xB8, 0x96, 0xBB, 0xB9, 0xFD,
+    0x97, 0x12, 0x7A, 0x25, 0x42, 0x1A, 0xEA, 0xEC, 0x6D, 0x95, 0xED, 0x90, 0x6C, 0x1C, 0xB5, 0x37,
+    0xF3, 0xD5, 0x47, 0x53, 0x2F, 0xE6, 0x20, 0xE5, 0x1D, 0x39, 0xBE, 0xAB, 0x45, 0x52, 0x74, 0xD3,
+    0x72, 0xC5, 0x9B, 0x47, 0x80, 0x9C, 0x96, 0x82, 0xDE, 0xAA, 0x04, 0x3D, 0x92, 0x3F, 0x22, 0x1B,
+    0x57, 0x88, 0xC0, 0x90, 0x5D, 0xB0, 0xA1, 0x38, 0xF6, 0xD5, 0xA0, 0x75, 0x63, 0xB3, 0xE0, 0xE0,
+    0x31, 0x42, 0x64, 0xE3, 0x83, 0x39, 0xDD, 0xA2, 0xF6, 0x36, 0xAD, 0xAE, 0xD9, 0xE4, 0xC7, 0x36,
+    0x74, 0xFA, 0xDF, 0xEE, 0xD0, 0xB9, 0x1A, 0xCF, 0xA2, 0xF8, 0x6D, 0x39, 0x5C, 0x1B, 0xBD, 0xB0,
+    0x7D, 0xCF, 0x5B, 0xD3, 0xB5, 0x73, 0x91, 0x77, 0x09, 0x02, 0x6F, 0x46, 0xA7, 0x10, 0x4E, 0xEC,
+    0x86, 0x33, 0xBC, 0xC6, 0xFB, 0xF8, 0xC1, 0xF4, 0x0F, 0xE9, 0xF4, 0x2D, 0xF5, 0xCF, 0x69, 0xF3,
+    0xA2, 0x36, 0x8F, 0x6A, 0xF3, 0xAE, 0x72, 0x0A, 0x76, 0xD9, 0x49, 0x47, 0xDC, 0x8C, 0x67, 0x23,
+    0xA6, 0x1F, 0x57, 0x7D, 0x9D, 0xEF, 0xC8, 0xF9, 0x58, 0x3C, 0x1B, 0x1A, 0x4F, 0x5F, 0xDB, 0xC7,
+    0x00, 0x1F, 0x49, 0x4F, 0x77, 0x84, 0x33, 0x47, 0x04, 0x31, 0x2F, 0x9D, 0xDD, 0x91, 0x33, 0xEC,
+    0xC6, 0x85, 0x3B, 0x42, 0x7F, 0x87, 0xF2, 0x82, 0x5E, 0x39, 0xD9, 0xE1, 0x14, 0xBC, 0x35, 0x9B,
+    0xA9, 0x33, 0x55, 0x6C, 0x46, 0xE9, 0x7F, 0x35, 0x86, 0x6E, 0x63, 0x76, 0x27, 0x1F, 0x11, 0x9E,
+    0x82, 0x86, 0xFA, 0xF1, 0x49, 0xA4, 0x3F, 0x93, 0x10, 0x02, 0x86, 0x53, 0xAA, 0xB8, 0xF1, 0xD3,
+    0xF3, 0xE9, 0x7F, 0xB1, 0x75, 0x7D, 0x29, 0xA0, 0xAA, 0x13, 0x17, 0x75, 0x47, 0x14, 0x07, 0x9D,
+    0x88, 0xC3, 0x86, 0x7F, 0xAA, 0xF6, 0x1F, 0xEE, 0xEF, 0x3A, 0xF6, 0xA8, 0x6E, 0x33, 0xBF, 0xD1,
+    0x09, 0xD4, 0x19, 0xBC, 0x73, 0x3C, 0x4C, 0x67, 0xEA, 0x22, 0x0F, 0x58, 0xD1, 0x52, 0x7B, 0x6D,
+    0xFB, 0xD1, 0x12, 0xC4, 0xC6, 0xBD, 0x54, 0x6D, 0xFA, 0xC2, 0x74, 0xE4, 0xBF, 0x67, 0xCB, 0xE6,
+    0x7B, 0x75, 0xA1, 0xEF, 0x64, 0x6B, 0x5E, 0xE5, 0xBC, 0xD0, 0x77, 0x32, 0xDE, 0x86, 0x04, 0x7F,
+    0x3C, 0xD7, 0xE8, 0x6A, 0xDC, 0x25, 0xE2, 0x1F, 0x44, 0x69, 0x66, 0xB4, 0x5C, 0x86, 0x2B, 0xE8,
+    0x9B, 0x66, 0x6F, 0xEF, 0xB6, 0x5E, 0xE4, 0xDC, 0x23, 0x5A, 0x94, 0xB7, 0xFF, 0x00, 0xED, 0x54,
+    0x31, 0x6C, 0xD3, 0x40, 0x14, 0x7D, 0x67, 0x2B, 0xB1, 0xA8, 0x81, 0xEB, 0x50, 0x4B, 0x20, 0x51,
+    0x7D, 0xC6, 0x0E, 0x90, 0x63, 0x60, 0x00, 0x29, 0x3E, 0x1F, 0x42, 0xA8, 0x03, 0x4B, 0x86, 0x7A,
+    0xEE, 0xC0, 0x44, 0x97, 0x32, 0x56, 0xA8, 0x89, 0x4F, 0x62, 0x60, 0xCD, 0xC4, 0x9C, 0xA1, 0x13,
+    0x0C, 0x61, 0x60, 0x88, 0x44, 0x45, 0x4E, 0x62, 0x60, 0x3D, 0x89, 0x91, 0xA1, 0x1E, 0xD8, 0x9B,
+    0x21, 0xA0, 0x0C, 0x4D, 0xCD, 0x37, 0x4D, 0x5B, 0x2A, 0x84, 0x84, 0x98, 0xF1, 0x7F, 0xB6, 0xEE,
+    0xFE, 0xFF, 0xFE, 0xF7, 0xFE, 0x7F, 0x96, 0xC5, 0x1E, 0x64, 0x85, 0x4C, 0x5A, 0x1D, 0xBB, 0x5E,
+    0xEC, 0xCF, 0xC0, 0x5B, 0x25, 0x2D, 0x87, 0xC4, 0x06, 0x96, 0xA0, 0xD0, 0x00, 0x50, 0x80, 0xCE,
+    0x4C, 0x99, 0xB1, 0x47, 0x02, 0xF4, 0x80, 0x63, 0x84, 0x1F, 0x10, 0x69, 0x5C, 0xD6, 0xB8, 0xAB,
+    0x31, 0xAE, 0xCA, 0xA4, 0x30, 0xD0, 0x10, 0x95, 0x43, 0x6E, 0x1A, 0x39, 0xA8, 0x62, 0x98, 0x1B,
+    0x01, 0xD6, 0x00, 0x75, 0x8C, 0x15, 0x65, 0x21, 0xDD, 0x9A, 0x74, 0x6D, 0xB2, 0xD9, 0x31, 0x1A,
+    0x1D, 0x88, 0x3D, 0xEA, 0xB6, 0x57, 0x47, 0x98, 0x9A, 0xEA, 0x68, 0xDA, 0x9A, 0xD2, 0x88, 0x76,
+    0x5B, 0x6A, 0x5F, 0x74, 0x92, 0xDC, 0x64, 0x95, 0x63, 0xDC, 0x09, 0xCD, 0xB2, 0x04, 0x56, 0x81,
+    0x36, 0xB0, 0x03, 0x4C, 0x10, 0x94, 0x08, 0x3D, 0x84, 0xE1, 0x77, 0x41, 0x43, 0x93, 0xC5, 0x8E,
+    0xA1, 0x0E, 0x4C, 0x3C, 0x47, 0x5C, 0x59, 0x2D, 0x7D, 0x37, 0xF2, 0x3A, 0x72, 0x7C, 0x2E, 0xF3,
+    0x6F, 0xF6, 0xF5, 0x68, 0x94, 0x4E, 0xD5, 0x8C, 0xF6, 0x55, 0x76, 0xC8, 0xE4, 0x6F, 0x0F, 0xDA,
+    0xCF, 0x27, 0x0D, 0x83, 0x41, 0x5D, 0x8A, 0x91, 0x7C, 0x33, 0x45, 0xE5, 0xF9, 0x79, 0xB2, 0x65,
+    0x3F, 0x1F, 0x5D, 0x7B, 0x72, 0x53, 0xB7, 0x7D, 0xBA, 0x38, 0x71, 0xE2, 0xE7, 0xF5, 0x36, 0x72,
+    0xD2, 0x68, 0xA4, 0xE8, 0x2E, 0x2C, 0xE5, 0x96, 0x15, 0xA4, 0x0D, 0x26, 0x58, 0x06, 0xDE, 0xF1,
+    0x4E, 0xDA, 0xC8, 0x85, 0x3E, 0x2C, 0x17, 0xE6, 0x23, 0x17, 0x5B, 0x62, 0xFA, 0x5C, 0x2A, 0x41,
+    0x31, 0xB6, 0xF4, 0xD2, 0x51, 0xE8, 0xCF, 0xA0, 0x42, 0x3F, 0xFE, 0x3C, 0x15, 0x7F, 0xA1, 0x87,
+    0x30, 0xB1, 0x7F, 0xEF, 0x9F, 0xF8, 0xF0, 0x17, 0x2B, 0xE6, 0xC9, 0x46, 0xC0, 0xB3, 0x18, 0x43,
+    0x4B, 0xB3, 0x2A, 0x0D, 0x77, 0xC9, 0x94, 0x98, 0x47, 0xE0, 0x21, 0xE1, 0xF4, 0x9B, 0x7A, 0x8E,
+    0xDC, 0x80, 0x38, 0xCD, 0xB9, 0xC6, 0x39, 0x0A, 0xE1, 0x0C, 0x62, 0x1B, 0xAC, 0xC7, 0xCD, 0xD8,
+    0xDD, 0x93, 0x0B, 0x3D, 0xFE, 0xEB, 0xFA, 0x8F, 0xBA, 0x2E, 0xCD, 0xA0, 0x14, 0x2E, 0x51, 0x3D,
+    0x53, 0x35, 0x44, 0x4A, 0x35, 0xB2, 0xA1, 0x6D, 0x3E, 0x32, 0xCD, 0x19, 0x68, 0x13, 0x29, 0xD7,
+    0xDE, 0xB4, 0xFA, 0xB5, 0x61, 0x69, 0xB4, 0x80, 0x3C, 0xAC, 0xFB, 0xAC, 0x43, 0xD2, 0xA4, 0xB1,
+    0x4B, 0xA3, 0x05, 0x58, 0x6C, 0x39, 0xAC, 0x43, 0x5B, 0xAF, 0x06, 0xF4, 0xD1, 0x45, 0x9F, 0x10,
+    0x1C, 0x01, 0x47, 0x08, 0x7B, 0xB8, 0x2A, 0x6D, 0x8F, 0xCA, 0x3C, 0xE9, 0xC4, 0x5F, 0x71, 0xBF,
+    0x87, 0x65, 0x32, 0xCC, 0x27, 0xAB, 0x2C, 0x57, 0x4E, 0x25, 0xA8, 0x0B, 0xD1, 0xC7, 0x18, 0xB5,
+    0xFA, 0x35, 0x5A, 0xA0, 0x03, 0x47, 0xEB, 0x17, 0xBE, 0xB3, 0xE2, 0x45, 0x99, 0x3F, 0xE8, 0x9C,
+    0xE7, 0x2C, 0xF5, 0x89, 0xF9, 0x5F, 0x01, 0xED, 0x80, 0xE6, 0x20, 0xC5, 0x64, 0x5C, 0xF1, 0xB2,
+    0xCC, 0x0D, 0xE7, 0xD0, 0x6F, 0x56, 0xD8, 0xDC, 0x6C, 0xB5, 0x1E, 0x7B, 0x75, 0xF0, 0x7D, 0x42,
+    0xEB, 0x7E, 0xCA, 0x05, 0x2F, 0xDC, 0x5C, 0x7D, 0xCE, 0xE5, 0x37, 0xB6, 0x5A, 0x50, 0x7F, 0x38,
+    0xFA, 0x29, 0x87, 0xBE, 0x38, 0x7A, 0xC8, 0x9E, 0x72, 0x01, 0x5E, 0x1F, 0x3A, 0xBA, 0x5E, 0xF3,
+    0x51, 0x00, 0xFF, 0x59, 0xE2, 0xB2, 0xDD, 0xDE, 0x5D, 0xC9, 0xFA, 0x34, 0xC3, 0xFE, 0xB3, 0x5B,
+    0xDD, 0x9D, 0x66, 0x27, 0x40, 0x8C, 0xED, 0xC1, 0x76, 0xE7, 0x9C, 0x8A, 0x2C, 0x45, 0xFF, 0x07,
+    0x85, 0x56, 0x41, 0x8C, 0xDE, 0x46, 0x15, 0x7E, 0xB6, 0x9B, 0x5A, 0xD4, 0x0A, 0x13, 0x24, 0x16,
+    0x55, 0xFD, 0x1B, 0x2C, 0x24, 0x0E, 0x28, 0xAC, 0x30, 0x12, 0x1C, 0x82, 0x94, 0x64, 0x9C, 0xF6,
+    0x80, 0x84, 0x28, 0xAC, 0x04, 0xAB, 0x1C, 0xF7, 0xDE, 0x04, 0xFD, 0x2B, 0x1A, 0xA9, 0x1C, 0x16,
+    0x6C, 0xD4, 0x03, 0xDC, 0xB2, 0x52, 0xC5, 0xAD, 0x87, 0x1E, 0x38, 0xC0, 0x5F, 0xD0, 0xAE, 0xAA,
+    0x22, 0xE5, 0xD0, 0x74, 0x26, 0x70, 0xC8, 0x31, 0x93, 0xFE, 0x14, 0x0E, 0x08, 0x61, 0x25, 0x4B,
+    0x0F, 0x3D, 0x90, 0xA1, 0xF5, 0xB2, 0xFE, 0xB3, 0xB6, 0x1F, 0xDF, 0xB3, 0xF7, 0xDF, 0xB0, 0x88,
+    0x52, 0x5B, 0xEF, 0xCD, 0x78, 0x66, 0x3C, 0xF3, 0xE6, 0xBD, 0xEF, 0x7D, 0x33, 0x44, 0xF2, 0x98,
+    0x86, 0x28, 0xDE, 0x37, 0x44, 0xCA, 0x6A, 0xA2, 0xAC, 0xFC, 0x22, 0x91, 0xCE, 0xD1, 0xAE, 0x2F,
+    0xAF, 0xAF, 0xAF, 0xE9, 0xE7, 0x98, 0x2B, 0x9D, 0xEB, 0xCB, 0x55, 0x56, 0xEA, 0xBC, 0x52, 0x0E,
+    0x5D, 0xF1, 0xA2, 0x40, 0xBF, 0x61, 0x86, 0x2E, 0x86, 0x91, 0xA3, 0x3A, 0x23, 0xEA, 0x2D, 0xB4,
+    0xFD, 0xC2, 0x53, 0xC4, 0xEC, 0x89, 0xE6, 0xE8, 0xB8, 0x43, 0x34, 0xE1, 0x3C, 0xC4, 0x77, 0x72,
+    0x70, 0xA3, 0xC9, 0xE6, 0xDF, 0x69, 0xF4, 0x9D, 0xB3, 0xBE, 0xF8, 0xD9, 0x2A, 0x99, 0x6F, 0x9D,
+    0x27, 0x7E, 0xE1, 0xEB, 0xC4, 0xDF, 0xFE, 0x2A, 0x99, 0xD7, 0x36, 0xA9, 0xF8, 0xCD, 0xEB, 0xA4,
+    0x9B, 0x8A, 0xB2, 0xDA, 0x7D, 0x49, 0xF5, 0xB7, 0x6B, 0xFC, 0x53, 0x91, 0xE9, 0x73, 0x7A, 0x80,
+    0x69, 0xE6, 0x58, 0xE2, 0x32, 0x8D, 0x4F, 0xC6, 0x65, 0xD0, 0xEF, 0xF8, 0xC4, 0x47, 0x4D, 0xEA,
+    0xC2, 0x46, 0xDB, 0xA0, 0xD2, 0x25, 0xD6, 0x85, 0x98, 0x1B, 0x73, 0x6F, 0xBE, 0xC9, 0x8D, 0x79,
+    0xBE, 0x6E, 0xCC, 0x2B, 0x7E, 0xAD, 0x78, 0xC5, 0x53, 0xF1, 0x07, 0x4F, 0x1A, 0x92, 0x3E, 0xF0,
+    0x4F, 0x27, 0x87, 0xFE, 0xA6, 0xD8, 0x42, 0x05, 0x97, 0x32, 0x95, 0x66, 0x76, 0x93, 0x7E, 0xC7,
+    0x45, 0x6D, 0x08, 0x09, 0x20, 0x24, 0x42, 0xC7, 0xC2, 0x3D, 0x45, 0xFD, 0xAF, 0x8F, 0xBF, 0x35,
+    0x7E, 0xFD, 0x72, 0xFF, 0xFA, 0xF1, 0xF7, 0x04, 0xE6, 0x69, 0x98, 0x39, 0x3C, 0x45, 0x47, 0x61,
+    0x67, 0xF2, 0xD8, 0xEB, 0x32, 0x81, 0xBF, 0x54, 0x75, 0x96, 0x12, 0x74, 0xC5, 0xF0, 0x44, 0x5C,
+    0xA3, 0x9B, 0x5B, 0xFA, 0x5C, 0xF7, 0x7D, 0xA2, 0x76, 0xAC, 0xAF, 0x48, 0x1D, 0xED, 0xD1, 0x1E,
+    0xAD, 0x29, 0x7E, 0xDF, 0x89, 0x2D, 0xDF, 0x78, 0x72, 0xB4, 0x0B, 0x4F, 0x38, 0x56, 0xE2, 0x7C,
+    0x28, 0x12, 0xC8, 0xCA, 0xDA, 0x8B, 0x6A, 0x86, 0x7F, 0x3F, 0x62, 0x66, 0x4B, 0x49, 0x3F, 0xED,
+    0xA7, 0x9E, 0x92, 0x56, 0xB5, 0x0A, 0x45, 0x8D, 0xF7, 0xA8, 0xA8, 0x3F, 0xA1, 0x50, 0x63, 0x91,
+    0x4A, 0x91, 0x76, 0xBA, 0x4B, 0x3A, 0x44, 0xB3, 0xE0, 0x84, 0xB1, 0xC6, 0xEE, 0xB8, 0xB8, 0x1F,
+    0x74, 0xE0, 0xE8, 0xF1, 0x53, 0xD4, 0xA4, 0xDB, 0x49, 0x4B, 0x93, 0xBD, 0x88, 0x29, 0xB2, 0x11,
+    0x97, 0xA2, 0x1C, 0xD4, 0x5D, 0x1F, 0xD9, 0x2B, 0x7F, 0x5B, 0x5C, 0xF9, 0x23, 0xEC, 0xE2, 0x3E,
+    0xB2, 0xFC, 0xBC, 0xBD, 0xF2, 0x9E, 0xF9, 0xF3, 0xF2, 0x53, 0x1D, 0x58, 0x19, 0x09, 0x15, 0x8A,
+    0xA2, 0x41, 0x69, 0x3B, 0xD9, 0xA3, 0xD4, 0x16, 0x2D, 0x25, 0xB6, 0xE0, 0x85, 0x44, 0xB5, 0x37,
+    0x16, 0xCE, 0x68, 0xB0, 0x19, 0x68, 0x71, 0x58, 0xD4, 0x44, 0xCD, 0xA8, 0xCF, 0x88, 0xAE, 0xCF,
+    0x4B, 0xBB, 0xBF, 0x29, 0x63, 0xEE, 0x37, 0x14, 0x2D, 0x8A, 0xBB, 0x58, 0x9E, 0xBB, 0x27, 0x17,
+    0x39, 0xC6, 0x85, 0x68, 0xF9, 0x18, 0x8D, 0x20, 0x05, 0x7D, 0x5E, 0xB0, 0x23, 0xB3, 0x8C, 0xD4,
+    0xB0, 0x22, 0xA5, 0xFD, 0xD0, 0x10, 0x35, 0x70, 0xC4, 0xB0, 0x50, 0xBB, 0x2C, 0x5E, 0xDC, 0x96,
+    0x22, 0x3A, 0x6C, 0x65, 0x75, 0x65, 0x6F, 0xC9, 0xC2, 0x69, 0xB9, 0x15, 0xB5, 0xA9, 0x4B, 0xDD,
+    0x19, 0xA0, 0x9B, 0x54, 0x07, 0x00, 0x98, 0x3C, 0xE1, 0x2A, 0x02, 0x02, 0x43, 0xC6, 0xC8, 0xCC,
+    0x61, 0x46, 0xD9, 0xC0, 0xA9, 0x80, 0xF1, 0x43, 0x93, 0x52, 0x21, 0xB3, 0x64, 0x74, 0x69, 0xD2,
+    0x5D, 0xE6, 0x8D, 0x7B, 0x6D, 0xC1, 0x76, 0x7A, 0x67, 0x89, 0x16, 0xE0, 0xC6, 0x3D, 0x95, 0x67,
+    0x7D, 0xCA, 0x65, 0x6A, 0x27, 0x8B, 0xA8, 0xA3, 0xCC, 0x86, 0x55, 0xD8, 0x91, 0xAE, 0x22, 0x17,
+    0xF4, 0xA4, 0xBD, 0xF8, 0x8A, 0x5E, 0x1E, 0x8B, 0x37, 0xEB, 0xB8, 0x24, 0x53, 0x7E, 0xD8, 0xA8,
+    0x5C, 0xF3, 0xF0, 0xAC, 0x14, 0x7F, 0x7A, 0xAF, 0xDF, 0x58, 0xA7, 0x6C, 0x6E, 0xDF, 0x39, 0x8B,
+    0xBD, 0x3C, 0x28, 0xF5, 0x2A, 0x92, 0xF8, 0x20, 0xD7, 0x17, 0x00, 0x97, 0x43, 0xCA, 0x6E, 0x02,
+    0x3C, 0x3D, 0xA5, 0xE2, 0xC8, 0x8E, 0x06, 0xAF, 0xB6, 0x43, 0x11, 0xB4, 0x02, 0x4B, 0x0D, 0x64,
+    0x77, 0x02, 0xB9, 0x4E, 0x53, 0xE2, 0xA1, 0xA2, 0x41, 0xD5, 0x9D, 0x7E, 0xEA, 0x55, 0x28, 0x35,
+    0x3F, 0xA9, 0xDE, 0x15, 0xE5, 0xE8, 0x58, 0x85, 0xAD, 0x56, 0xCC, 0xB5, 0xA8, 0x92, 0x62, 0x48,
+    0x20, 0xC0, 0x45, 0x1A, 0x6A, 0x6E, 0xE8, 0x9C, 0xD9, 0x93, 0x7A, 0xD8, 0xE9, 0x32, 0x65, 0x53,
+    0x6A, 0xCB, 0x65, 0x91, 0x9B, 0xD2, 0x20, 0x45, 0x19, 0xED, 0x4B, 0x31, 0x22, 0x79, 0x51, 0xE2,
+    0xCB, 0x66, 0x87, 0x0F, 0xF7, 0x92, 0x3E, 0x6D, 0x97, 0x68, 0x4B, 0x01, 0xF1, 0x67, 0x66, 0xB3,
+    0x31, 0x07, 0x26, 0x3D, 0x32, 0xDB, 0xD8, 0xA0, 0x55, 0x2E, 0xAA, 0x13, 0x17, 0xFB, 0x24, 0x07,
+    0xD6, 0x29, 0xDD, 0x5F, 0x43, 0x24, 0xEB, 0xA1, 0x54, 0x95, 0x44, 0x15, 0x01, 0xD8, 0xCF, 0x49,
+    0xFA, 0xE2, 0x01, 0x45, 0xD8, 0x6C, 0x47, 0x08, 0xFB, 0x43, 0x8B, 0x09, 0xF3, 0x31, 0xF2, 0x73,
+    0xAE, 0x26, 0xFD, 0x73, 0xBC, 0x0D, 0x6F, 0x48, 0x08, 0x01, 0x75, 0x04, 0xDA, 0x41, 0xA9, 0x1C,
+    0xEA, 0xA2, 0xB8, 0xE9, 0x6D, 0x22, 0xF1, 0xB0, 0xBB, 0xCA, 0x3C, 0x2B, 0xA3, 0x0E, 0xB8, 0x8C,
+    0x5A, 0x2D, 0x43, 0x52, 0x19, 0xAC, 0x80, 0xAB, 0x36, 0x96, 0x7F, 0x43, 0x16, 0x6C, 0xB1, 0xC3,
+    0xC2, 0x59, 0x0D, 0x42, 0x64, 0x32, 0x3B, 0x8F, 0x0C, 0xBD, 0xA5, 0xBC, 0xA2, 0xDD, 0x23, 0x85,
+    0xC4, 0x55, 0x1E, 0xDB, 0x50, 0x30, 0x8E, 0x54, 0x2F, 0x5B, 0x83, 0x69, 0x21, 0xFF, 0x13, 0xF3,
+    0xDD, 0x10, 0x9F, 0x61, 0x3A, 0x98, 0x25, 0xE6, 0x0A, 0x65, 0x86, 0xDF, 0x95, 0xD4, 0x93, 0x30,
+    0xD1, 0xB4, 0x83, 0xF9, 0x7C, 0xCC, 0x07, 0x8F, 0xD3, 0x32, 0x1E, 0xD2, 0x32, 0x98, 0x0E, 0x85,
+    0xE1, 0x4E, 0xC8, 0xC2, 0x75, 0x99, 0x0C, 0x14, 0x17, 0x8D, 0x88, 0x96, 0xA1, 0x51, 0x2D, 0x6E,
+    0x80, 0x2F, 0x22, 0xC1, 0xB7, 0xF0, 0xA5, 0xCC, 0x5D, 0x8D, 0x85, 0x1B, 0x8A, 0xD4, 0xC6, 0xF5,
+    0x29, 0x24, 0x9F, 0x8D, 0xBD, 0x01, 0x4D, 0xDA, 0xE4, 0xC3, 0xFD, 0x16, 0x61, 0x51, 0x73, 0xA0,
+    0x81, 0x29, 0xBB, 0xE3, 0xBB, 0xEB, 0x05, 0xE9, 0xC4, 0xB7, 0xD7, 0xF9, 0xFD, 0x4E, 0xED, 0x37,
+    0x59, 0x65, 0xAA, 0x61, 0x2B, 0xF2, 0xEB, 0xC8, 0xC6, 0xA3, 0x81, 0x7A, 0x2C, 0x8A, 0xD1, 0x50,
+    0xB3, 0xB4, 0x18, 0xE6, 0x47, 0x07, 0xE0, 0xA5, 0x7B, 0x1E, 0xE7, 0x4B, 0x8D, 0x55, 0x21, 0x52,
+    0xBF, 0x8F, 0xB6, 0x8F, 0x1C, 0x90, 0x03, 0xDF, 0x22, 0x32, 0xF0, 0x24, 0xDD, 0x06, 0xD5, 0x56,
+    0x4C, 0xF1, 0x01, 0x97, 0x40, 0x95, 0xFD, 0x0A, 0x6F, 0xB8, 0x0B, 0x97, 0x94, 0xBF, 0xB9, 0x2A,
+    0x7B, 0xC1, 0x0E, 0x3E, 0x05, 0xB9, 0x04, 0xD1, 0x91, 0xA7, 0xEC, 0x21, 0xFE, 0x95, 0x9C, 0x5E,
+    0x20, 0x02, 0xC6, 0x22, 0x28, 0xFE, 0x6A, 0xBF, 0xD3, 0x4B, 0x0C, 0x10, 0x9B, 0xF6, 0x6A, 0xFF,
+    0xC6, 0x51, 0x5D, 0xF9, 0xA8, 0x2B, 0xEC, 0x40, 0xE3, 0xFF, 0x49, 0xEB, 0xC7, 0xF4, 0x2D, 0x08,
+    0x12, 0x1F, 0xAD, 0xD1, 0x11, 0xF9, 0x4D, 0x24, 0x3F, 0xF9, 0xB0, 0xA3, 0xB8, 0xD9, 0x45, 0x96,
+    0xFB, 0xDD, 0x82, 0x32, 0xB7, 0xFB, 0x23, 0xB8, 0x06, 0xBD, 0x85, 0x28, 0x53, 0x3E, 0x56, 0xBF,
+    0x5B, 0x17, 0x5C, 0x03, 0x01, 0xF6, 0x4D, 0x96, 0x21, 0x50, 0x0E, 0x2A, 0xF5, 0x50, 0x89, 0x4C,
+    0x10, 0xF0, 0xBF, 0x7A, 0x39, 0xB1, 0xF6, 0x96, 0xDC, 0x2A, 0x2A, 0x14, 0xCF, 0x0F, 0x64, 0x13,
+    0x0B, 0x20, 0x94, 0x78, 0xEB, 0xD3, 0xE2, 0xB9, 0xB3, 0x72, 0x94, 0x5E, 0xD0, 0x70, 0xEC, 0x16,
+    0xC8, 0x44, 0x76, 0x50, 0xAF, 0xEC, 0x6F, 0x00, 0xDE, 0x38, 0xEC, 0xE8, 0xEA, 0xA3, 0x9D, 0xFE,
+    0x97, 0x85, 0xB4, 0x81, 0x4E, 0x5B, 0x8A, 0x91, 0x5F, 0xA4, 0xC0, 0x6C, 0x34, 0x75, 0x31, 0x6F,
+    0x73, 0x93, 0xF2, 0x08, 0x8F, 0x62, 0x81, 0x23, 0x6B, 0x5A, 0x22, 0x4B, 0x5C, 0x5C, 0x45, 0x3E,
+    0x70, 0x02, 0x02, 0xE5, 0xCF, 0xCD, 0x4C, 0x83, 0x7C, 0xEF, 0xE4, 0xE8, 0x3B, 0xC7, 0xFC, 0x2B,
+    0xA9, 0xAB, 0x56, 0xF0, 0x40, 0xA5, 0x72, 0x81, 0x57, 0x36, 0x6C, 0x30, 0xBE, 0x0E, 0x17, 0x1B,
+    0x9E, 0xA6, 0x4B, 0xD8, 0x49, 0xD2, 0xB8, 0xA3, 0x23, 0x97, 0x7D, 0x5C, 0xCF, 0x1B, 0x55, 0xBD,
+    0xDB, 0x64, 0xF6, 0x5E, 0xA5, 0xAD, 0x43, 0x3E, 0xC3, 0xCA, 0xFF, 0x92, 0x02, 0xED, 0xD2, 0xA7,
+    0x1D, 0xB2, 0xD1, 0xBB, 0xA7, 0x93, 0xC6, 0x8D, 0x47, 0xEE, 0x30, 0x67, 0x35, 0xCC, 0x97, 0xDA,
+    0x0E, 0xD2, 0x1F, 0xCB, 0xF4, 0xEF, 0xFD, 0x9A, 0x6C, 0x2C, 0xBB, 0xD7, 0x9F, 0x68, 0xFF, 0x78,
+    0xE1, 0x3A, 0xB5, 0xBA, 0x3E, 0x4E, 0x0C, 0x5C, 0x62, 0xE2, 0x7D, 0xCE, 0x71, 0x85, 0x29, 0x33,
+    0x79, 0xED, 0xE7, 0x11, 0x35, 0x40, 0xB4, 0x19, 0x13, 0x2F, 0xE2, 0xE1, 0xCC, 0xA5, 0x81, 0xA9,
+    0x60, 0xE1, 0x13, 0x9F, 0xC1, 0x48, 0xBE, 0x6B, 0x5F, 0xBA, 0xF6, 0x17, 0xFB, 0xB5, 0x6B, 0x0F,
+    0x73, 0xFD, 0xDB, 0x9E, 0x12, 0x30, 0x49, 0xF4, 0x03, 0x8C, 0xBD, 0xE6, 0x8E, 0xCE, 0x08, 0x1E,
+    0x8E, 0x64, 0xA9, 0x9F, 0x9B, 0xCD, 0xB6, 0xF1, 0x5D, 0x6D, 0xE9, 0xDF, 0x57, 0xD7, 0xF5, 0x6D,
+    0x88, 0x05, 0x83, 0x22, 0x4C, 0xFF, 0x47, 0x82, 0x62, 0x6F, 0x58, 0xD7, 0x70, 0xFF, 0x06, 0xCF,
+    0xE0, 0x1A, 0xAC, 0x8B, 0xFA, 0x8C, 0x3F, 0x40, 0x85, 0x38, 0x07, 0xA9, 0x01, 0x15, 0xE0, 0x16,
+    0x5D, 0x09, 0x25, 0x20, 0x14, 0xA0, 0x69, 0xC9, 0x03, 0x2C, 0x99, 0xD5, 0x1A, 0x89, 0x21, 0x97,
+    0x8B, 0x11, 0xA9, 0x9F, 0x45, 0x44, 0x61, 0x1D, 0x8C, 0x4F, 0xDA, 0x27, 0xC8, 0x74, 0x35, 0x7D,
+    0x8F, 0xB7, 0x51, 0x3F, 0x45, 0xA6, 0x4D, 0xED, 0xAB, 0x6D, 0x5A, 0x81, 0xC3, 0x20, 0x41, 0x35,
+    0x5E, 0x64, 0x22, 0x3B, 0xE9, 0xA6, 0x03, 0x15, 0x0F, 0x89, 0x8A, 0x3D, 0x5C, 0x02, 0x06, 0x36,
+    0xCF, 0x13, 0x5D, 0xBF, 0x38, 0x93, 0x03, 0xC4, 0x67, 0xFC, 0x41, 0x1B, 0x5C, 0xA3, 0x0B, 0xB4,
+    0x4A, 0xCF, 0xD2, 0xEA, 0xCF, 0x9F, 0xA5, 0xEC, 0x1F, 0xAB, 0x88, 0x72, 0x4D, 0x5B, 0x2F, 0xB9,
+    0x40, 0xD6, 0x7C, 0x4D, 0x30, 0x49, 0xE7, 0x49, 0xFD, 0xF4, 0x6D, 0x78, 0xAD, 0x06, 0x90, 0x8F,
+    0xCE, 0xAD, 0xEA, 0x84, 0x12, 0x1B, 0x41, 0x52, 0x35, 0x6E, 0x38, 0xF7, 0x71, 0xBC, 0xB8, 0xCA,
+    0x20, 0x38, 0x15, 0x72, 0xA6, 0x94, 0x6B, 0x23, 0x94, 0x5C, 0x1B, 0x3F, 0x49, 0x15, 0x70, 0x44,
+    0xDA, 0x73, 0x19, 0xD7, 0x99, 0x8B, 0x6B, 0xE5, 0x4F, 0x4A, 0xEA, 0xE2, 0xA6, 0xC0, 0x98, 0x8E,
+    0x26, 0x8B, 0xE5, 0x4D, 0xAA, 0xC2, 0x2D, 0x6C, 0x7B, 0xA8, 0xC7, 0xD8, 0x63, 0xDA, 0xE5, 0x43,
+    0x1B, 0x9D, 0xDE, 0x1C, 0x05, 0x71, 0x07, 0xE4, 0xAC, 0xFA, 0xEB, 0xCB, 0x75, 0xF6, 0xC2, 0x66,
+    0xAB, 0x4F, 0x6F, 0xDE, 0x7A, 0xE7, 0xF4, 0xE6, 0x8F, 0x6F, 0x9D, 0xDE, 0xDC, 0x12, 0xB6, 0x14,
+    0xB9, 0x05, 0xF9, 0x89, 0xF0, 0x96, 0x38, 0x08, 0x28, 0x4F, 0xEC, 0x70, 0xA7, 0xAD, 0x01, 0xC3,
+    0x46, 0x84, 0xBE, 0x00, 0xA4, 0xFC, 0xD0, 0x0E, 0xB7, 0xBB, 0x0C, 0x74, 0x90, 0x78, 0x03, 0xD1,
+    0xF9, 0x63, 0x29, 0xE4, 0xDC, 0x04, 0x6C, 0xC0, 0x64, 0xFB, 0xFD, 0x51, 0x5F, 0x66, 0x4F, 0x0A,
+    0x0E, 0xC0, 0x47, 0xE0, 0x04, 0xF8, 0x47, 0xE6, 0x1A, 0xE4, 0x99, 0x6D, 0xD8, 0xD6, 0x23, 0x21,
+    0x8B, 0x3C, 0xC5, 0x75, 0x3A, 0xB3, 0x17, 0xFF, 0x27, 0x82, 0x32, 0x17, 0x60, 0x4C, 0x9C, 0xC7,
+    0xBD, 0x81, 0x83, 0x9B, 0x63, 0xA4, 0xE3, 0x50, 0x94, 0x5B, 0x2B, 0xAD, 0xAC, 0xAF, 0xD3, 0xBF,
+    0x01, 0xAB, 0xFF, 0xFF, 0xAF, 0xFE, 0xFF, 0x7F, 0x06, 0x06, 0x06, 0x00, 0x8D, 0xCD, 0xC1, 0x0D,
+    0xC2, 0x30, 0x0C, 0x05, 0xD0, 0xDF, 0xF6, 0x10, 0x24, 0x1F, 0x18, 0x81, 0x11, 0xBA, 0x00, 0x22,
+    0x81, 0x09, 0xBA, 0x41, 0x47, 0x60, 0x04, 0x32, 0x05, 0x6B, 0x30, 0x02, 0x19, 0x21, 0xA3, 0xF4,
+    0xE0, 0x4A, 0x39, 0x34, 0x18, 0x3B, 0x65, 0x00, 0x7C, 0x78, 0xFA, 0xFA, 0x96, 0x65, 0x60, 0x02,
+    0x30, 0x4A, 0x44, 0x57, 0xA9, 0x60, 0x28, 0xC3, 0x06, 0xC7, 0xBD, 0xA1, 0x89, 0xD8, 0xD5, 0x89,
+    0xD8, 0xCB, 0xF2, 0x4B, 0xAD, 0xFB, 0x8F, 0xB9, 0xDE, 0x84, 0x45, 0xF2, 0x7B, 0xC1, 0x3E, 0x5D,
+    0x30, 0xE5, 0xA3, 0x0C, 0xFC, 0xC8, 0x00, 0xE5, 0xA3, 0xEE, 0x28, 0x99, 0xAE, 0xE5, 0xD7, 0x32,
+    0xAE, 0x81, 0xEC, 0x2C, 0x8D, 0xD7, 0x32, 0xAF, 0xC1, 0x83, 0xB5, 0xF7, 0x31, 0x98, 0x05, 0xEA,
+    0x49, 0xA2, 0xEA, 0xC4, 0x7A, 0xDC, 0x37, 0xF5, 0xD0, 0x9B, 0x67, 0x98, 0x97, 0xA6, 0x7F, 0x32,
+    0x49, 0x22, 0xC9, 0xBD, 0xA4, 0xFD, 0xF7, 0x17, 0x45, 0x8D, 0xB1, 0x0D, 0x80, 0x40, 0x0C, 0x03,
+    0x5F, 0x7C, 0x41, 0x41, 0x91, 0x51, 0x98, 0x00, 0x05, 0x46, 0x63, 0x12, 0x46, 0x21, 0xA3, 0x30,
+    0xC2, 0x17, 0x20, 0x01, 0x7A, 0x71, 0x24, 0xA2, 0x20, 0x52, 0x5C, 0xD8, 0xF2, 0x39, 0xA5, 0x9C,
+    0xE2, 0xC4, 0x42, 0xB5, 0x84, 0x52, 0x5D, 0x32, 0x84, 0x3D, 0x76, 0x1E, 0x0C, 0xED, 0xEC, 0x41,
+    0x15, 0xAB, 0x6E, 0x2F, 0x46, 0x12, 0x30, 0x4C, 0x61, 0xA2, 0xAC, 0x3C, 0x2D, 0xA7, 0xB2, 0xF7,
+    0x14, 0x61, 0xF7, 0x24, 0x73, 0x45, 0x19, 0x02, 0xA4, 0x07, 0xDE, 0x95, 0x4D, 0x9D, 0x93, 0x37,
+    0x0D, 0xFE, 0x5D, 0xFF, 0xAD, 0x6F, 0xB7, 0xF1, 0x7F, 0x01,
 };
 
 static const EpdGlyph notoserif_12_boldGlyphs[] = {
@@ -1806,99 +1810,99 @@ static const EpdGlyph notoserif_12_boldGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 5, 19, 153, 2, 18, 24, 0 }, // !
-    { 11, 8, 204, 1, 18, 22, 24 }, // "
-    { 14, 18, 226, 0, 18, 63, 46 }, // #
-    { 12, 21, 226, 1, 19, 63, 109 }, // $
-    { 22, 20, 362, 0, 19, 110, 172 }, // %
-    { 19, 20, 320, 1, 19, 95, 282 }, // &
-    { 5, 8, 116, 1, 18, 10, 377 }, // '
-    { 9, 24, 160, 1, 20, 54, 387 }, // (
-    { 9, 24, 160, 0, 20, 54, 441 }, // )
-    { 12, 11, 201, 0, 20, 33, 495 }, // *
-    { 12, 12, 226, 1, 15, 36, 528 }, // +
-    { 5, 8, 118, 1, 4, 10, 564 }, // ,
-    { 8, 4, 124, 0, 9, 8, 574 }, // -
-    { 5, 5, 118, 1, 4, 7, 582 }, // .
-    { 8, 23, 115, 0, 19, 46, 589 }, // /
-    { 13, 20, 233, 1, 19, 65, 635 }, // 0
-    { 13, 18, 202, 0, 18, 59, 700 }, // 1
-    { 13, 19, 212, 0, 19, 62, 759 }, // 2
-    { 13, 20, 216, 0, 19, 65, 821 }, // 3
-    { 14, 18, 222, 0, 18, 63, 886 }, // 4
-    { 13, 19, 212, 0, 18, 62, 949 }, // 5
-    { 13, 20, 224, 1, 19, 65, 1011 }, // 6
-    { 12, 18, 217, 1, 18, 54, 1076 }, // 7
-    { 13, 20, 232, 1, 19, 65, 1130 }, // 8
-    { 13, 20, 224, 1, 19, 65, 1195 }, // 9
-    { 5, 15, 122, 1, 14, 19, 1260 }, // :
-    { 5, 18, 122, 1, 14, 23, 1279 }, // ;
-    { 12, 14, 226, 1, 16, 42, 1302 }, // <
-    { 12, 8, 226, 1, 13, 24, 1344 }, // =
-    { 12, 14, 226, 1, 16, 42, 1368 }, // >
-    { 13, 20, 220, 0, 19, 65, 1410 }, // ?
-    { 21, 22, 368, 1, 18, 116, 1475 }, // @
-    { 19, 18, 301, 0, 18, 86, 1591 }, // A
-    { 16, 18, 269, 0, 18, 72, 1677 }, // B
-    { 15, 20, 268, 1, 19, 75, 1749 }, // C
-    { 18, 18, 307, 0, 18, 81, 1824 }, // D
-    { 16, 18, 261, 0, 18, 72, 1905 }, // E
-    { 15, 18, 248, 0, 18, 68, 1977 }, // F
-    { 18, 20, 308, 1, 19, 90, 2045 }, // G
-    { 20, 18, 328, 0, 18, 90, 2135 }, // H
-    { 10, 18, 160, 0, 18, 45, 2225 }, // I
-    { 11, 24, 158, -1, 18, 66, 2270 }, // J
-    { 19, 18, 294, 0, 18, 86, 2336 }, // K
-    { 16, 18, 262, 0, 18, 72, 2422 }, // L
-    { 24, 18, 381, 0, 18, 108, 2494 }, // M
-    { 20, 18, 315, 0, 18, 90, 2602 }, // N
-    { 18, 20, 315, 1, 19, 90, 2692 }, // O
-    { 16, 18, 255, 0, 18, 72, 2782 }, // P
-    { 18, 25, 315, 1, 19, 113, 2854 }, // Q
-    { 18, 18, 285, 0, 18, 81, 2967 }, // R
-    { 14, 20, 232, 0, 19, 70, 3048 }, // S
-    { 17, 18, 261, 0, 18, 77, 3118 }, // T
-    { 19, 19, 299, 0, 18, 91, 3195 }, // U
-    { 18, 18, 279, 0, 18, 81, 3286 }, // V
-    { 27, 18, 427, 0, 18, 122, 3367 }, // W
-    { 19, 18, 293, 0, 18, 86, 3489 }, // X
-    { 18, 18, 277, 0, 18, 81, 3575 }, // Y
-    { 15, 18, 267, 1, 18, 68, 3656 }, // Z
-    { 8, 23, 166, 2, 19, 46, 3724 }, // [
-    { 8, 23, 115, 0, 19, 46, 3770 }, // <backslash>
-    { 8, 23, 166, 0, 19, 46, 3816 }, // ]
-    { 12, 12, 224, 1, 18, 36, 3862 }, // ^
-    { 13, 2, 184, -1, -2, 7, 3898 }, // _
-    { 7, 5, 134, 1, 20, 9, 3905 }, // `
-    { 14, 15, 240, 1, 14, 53, 3914 }, // a
-    { 16, 20, 260, 0, 19, 80, 3967 }, // b
-    { 12, 15, 211, 1, 14, 45, 4047 }, // c
-    { 15, 20, 260, 1, 19, 75, 4092 }, // d
-    { 13, 15, 229, 1, 14, 49, 4167 }, // e
-    { 12, 20, 163, 0, 20, 60, 4216 }, // f
-    { 14, 21, 224, 0, 15, 74, 4276 }, // g
-    { 17, 19, 267, 0, 19, 81, 4350 }, // h
-    { 9, 20, 141, 0, 20, 45, 4431 }, // i
-    { 8, 26, 138, -1, 20, 52, 4476 }, // j
-    { 16, 19, 255, 0, 19, 76, 4528 }, // k
-    { 9, 19, 141, 0, 19, 43, 4604 }, // l
-    { 25, 14, 394, 0, 14, 88, 4647 }, // m
-    { 17, 14, 267, 0, 14, 60, 4735 }, // n
-    { 14, 15, 246, 1, 14, 53, 4795 }, // o
-    { 15, 20, 258, 0, 14, 75, 4848 }, // p
-    { 15, 20, 259, 1, 14, 75, 4923 }, // q
-    { 13, 14, 209, 0, 14, 46, 4998 }, // r
-    { 12, 15, 192, 0, 14, 45, 5044 }, // s
-    { 10, 18, 162, 0, 17, 45, 5089 }, // t
-    { 17, 15, 267, 0, 14, 64, 5134 }, // u
-    { 16, 14, 242, 0, 14, 56, 5198 }, // v
-    { 23, 14, 342, -1, 14, 81, 5254 }, // w
-    { 16, 14, 258, 0, 14, 56, 5335 }, // x
-    { 15, 20, 232, 0, 14, 75, 5391 }, // y
-    { 13, 14, 212, 0, 14, 46, 5466 }, // z
-    { 11, 23, 177, 0, 19, 64, 5512 }, // {
-    { 2, 25, 226, 6, 19, 13, 5576 }, // |
-    { 11, 23, 177, 0, 19, 64, 5589 }, // }
-    { 13, 6, 226, 1, 12, 20, 5653 }, // ~
+    { 11, 8, 204, 1, 18, 22, 0 }, // "
+    { 14, 18, 226, 0, 18, 63, 22 }, // #
+    { 12, 21, 226, 1, 19, 63, 85 }, // $
+    { 22, 20, 362, 0, 19, 110, 148 }, // %
+    { 19, 20, 320, 1, 19, 95, 258 }, // &
+    { 5, 8, 116, 1, 18, 10, 353 }, // '
+    { 9, 24, 160, 1, 20, 54, 24 }, // (
+    { 9, 24, 160, 0, 20, 54, 78 }, // )
+    { 12, 11, 201, 0, 20, 33, 363 }, // *
+    { 12, 12, 226, 1, 15, 36, 396 }, // +
+    { 5, 8, 118, 1, 4, 10, 132 }, // ,
+    { 8, 4, 124, 0, 9, 8, 142 }, // -
+    { 5, 5, 118, 1, 4, 7, 150 }, // .
+    { 8, 23, 115, 0, 19, 46, 432 }, // /
+    { 13, 20, 233, 1, 19, 65, 157 }, // 0
+    { 13, 18, 202, 0, 18, 59, 222 }, // 1
+    { 13, 19, 212, 0, 19, 62, 281 }, // 2
+    { 13, 20, 216, 0, 19, 65, 343 }, // 3
+    { 14, 18, 222, 0, 18, 63, 408 }, // 4
+    { 13, 19, 212, 0, 18, 62, 471 }, // 5
+    { 13, 20, 224, 1, 19, 65, 533 }, // 6
+    { 12, 18, 217, 1, 18, 54, 598 }, // 7
+    { 13, 20, 232, 1, 19, 65, 652 }, // 8
+    { 13, 20, 224, 1, 19, 65, 717 }, // 9
+    { 5, 15, 122, 1, 14, 19, 782 }, // :
+    { 5, 18, 122, 1, 14, 23, 801 }, // ;
+    { 12, 14, 226, 1, 16, 42, 478 }, // <
+    { 12, 8, 226, 1, 13, 24, 520 }, // =
+    { 12, 14, 226, 1, 16, 42, 544 }, // >
+    { 13, 20, 220, 0, 19, 65, 824 }, // ?
+    { 21, 22, 368, 1, 18, 116, 586 }, // @
+    { 19, 18, 301, 0, 18, 86, 889 }, // A
+    { 16, 18, 269, 0, 18, 72, 975 }, // B
+    { 15, 20, 268, 1, 19, 75, 1047 }, // C
+    { 18, 18, 307, 0, 18, 81, 1122 }, // D
+    { 16, 18, 261, 0, 18, 72, 1203 }, // E
+    { 15, 18, 248, 0, 18, 68, 1275 }, // F
+    { 18, 20, 308, 1, 19, 90, 1343 }, // G
+    { 20, 18, 328, 0, 18, 90, 1433 }, // H
+    { 10, 18, 160, 0, 18, 45, 1523 }, // I
+    { 11, 24, 158, -1, 18, 66, 1568 }, // J
+    { 19, 18, 294, 0, 18, 86, 1634 }, // K
+    { 16, 18, 262, 0, 18, 72, 1720 }, // L
+    { 24, 18, 381, 0, 18, 108, 1792 }, // M
+    { 20, 18, 315, 0, 18, 90, 1900 }, // N
+    { 18, 20, 315, 1, 19, 90, 1990 }, // O
+    { 16, 18, 255, 0, 18, 72, 2080 }, // P
+    { 18, 25, 315, 1, 19, 113, 2152 }, // Q
+    { 18, 18, 285, 0, 18, 81, 2265 }, // R
+    { 14, 20, 232, 0, 19, 70, 2346 }, // S
+    { 17, 18, 261, 0, 18, 77, 2416 }, // T
+    { 19, 19, 299, 0, 18, 91, 702 }, // U
+    { 18, 18, 279, 0, 18, 81, 2493 }, // V
+    { 27, 18, 427, 0, 18, 122, 2574 }, // W
+    { 19, 18, 293, 0, 18, 86, 2696 }, // X
+    { 18, 18, 277, 0, 18, 81, 2782 }, // Y
+    { 15, 18, 267, 1, 18, 68, 2863 }, // Z
+    { 8, 23, 166, 2, 19, 46, 793 }, // [
+    { 8, 23, 115, 0, 19, 46, 839 }, // <backslash>
+    { 8, 23, 166, 0, 19, 46, 885 }, // ]
+    { 12, 12, 224, 1, 18, 36, 931 }, // ^
+    { 13, 2, 184, -1, -2, 7, 967 }, // _
+    { 7, 5, 134, 1, 20, 9, 974 }, // `
+    { 14, 15, 240, 1, 14, 53, 2931 }, // a
+    { 16, 20, 260, 0, 19, 80, 2984 }, // b
+    { 12, 15, 211, 1, 14, 45, 3064 }, // c
+    { 15, 20, 260, 1, 19, 75, 3109 }, // d
+    { 13, 15, 229, 1, 14, 49, 3184 }, // e
+    { 12, 20, 163, 0, 20, 60, 3233 }, // f
+    { 14, 21, 224, 0, 15, 74, 3293 }, // g
+    { 17, 19, 267, 0, 19, 81, 3367 }, // h
+    { 9, 20, 141, 0, 20, 45, 3448 }, // i
+    { 8, 26, 138, -1, 20, 52, 3493 }, // j
+    { 16, 19, 255, 0, 19, 76, 3545 }, // k
+    { 9, 19, 141, 0, 19, 43, 3621 }, // l
+    { 25, 14, 394, 0, 14, 88, 3664 }, // m
+    { 17, 14, 267, 0, 14, 60, 3752 }, // n
+    { 14, 15, 246, 1, 14, 53, 3812 }, // o
+    { 15, 20, 258, 0, 14, 75, 3865 }, // p
+    { 15, 20, 259, 1, 14, 75, 3940 }, // q
+    { 13, 14, 209, 0, 14, 46, 4015 }, // r
+    { 12, 15, 192, 0, 14, 45, 4061 }, // s
+    { 10, 18, 162, 0, 17, 45, 4106 }, // t
+    { 17, 15, 267, 0, 14, 64, 4151 }, // u
+    { 16, 14, 242, 0, 14, 56, 4215 }, // v
+    { 23, 14, 342, -1, 14, 81, 4271 }, // w
+    { 16, 14, 258, 0, 14, 56, 4352 }, // x
+    { 15, 20, 232, 0, 14, 75, 4408 }, // y
+    { 13, 14, 212, 0, 14, 46, 4483 }, // z
+    { 11, 23, 177, 0, 19, 64, 983 }, // {
+    { 2, 25, 226, 6, 19, 13, 1047 }, // |
+    { 11, 23, 177, 0, 19, 64, 1060 }, // }
+    { 13, 6, 226, 1, 12, 20, 1124 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 5, 19, 153, 2, 14, 24, 0 }, // U+00A1
     { 13, 18, 226, 1, 18, 59, 24 }, // U+00A2
@@ -1982,19 +1986,19 @@ static const EpdGlyph notoserif_12_boldGlyphs[] = {
     { 14, 21, 246, 1, 20, 74, 5537 }, // U+00F0
     { 17, 20, 267, 0, 20, 85, 5611 }, // U+00F1
     { 14, 21, 246, 1, 20, 74, 5696 }, // U+00F2
-    { 14, 21, 246, 1, 20, 74, 5770 }, // U+00F3
-    { 14, 21, 246, 1, 20, 74, 5844 }, // U+00F4
-    { 14, 21, 246, 1, 20, 74, 5918 }, // U+00F5
-    { 14, 20, 246, 1, 19, 70, 5992 }, // U+00F6
-    { 12, 14, 226, 1, 16, 42, 6062 }, // U+00F7
-    { 14, 16, 246, 1, 15, 56, 6104 }, // U+00F8
-    { 17, 21, 267, 0, 20, 90, 6160 }, // U+00F9
-    { 17, 21, 267, 0, 20, 90, 6250 }, // U+00FA
-    { 17, 21, 267, 0, 20, 90, 6340 }, // U+00FB
-    { 17, 20, 267, 0, 19, 85, 6430 }, // U+00FC
-    { 15, 26, 232, 0, 20, 98, 6515 }, // U+00FD
-    { 15, 25, 258, 0, 19, 94, 6613 }, // U+00FE
-    { 15, 25, 232, 0, 19, 94, 6707 }, // U+00FF
+    { 14, 21, 246, 1, 20, 74, 4529 }, // U+00F3
+    { 14, 21, 246, 1, 20, 74, 5770 }, // U+00F4
+    { 14, 21, 246, 1, 20, 74, 5844 }, // U+00F5
+    { 14, 20, 246, 1, 19, 70, 5918 }, // U+00F6
+    { 12, 14, 226, 1, 16, 42, 5988 }, // U+00F7
+    { 14, 16, 246, 1, 15, 56, 6030 }, // U+00F8
+    { 17, 21, 267, 0, 20, 90, 6086 }, // U+00F9
+    { 17, 21, 267, 0, 20, 90, 6176 }, // U+00FA
+    { 17, 21, 267, 0, 20, 90, 6266 }, // U+00FB
+    { 17, 20, 267, 0, 19, 85, 6356 }, // U+00FC
+    { 15, 26, 232, 0, 20, 98, 6441 }, // U+00FD
+    { 15, 25, 258, 0, 19, 94, 6539 }, // U+00FE
+    { 15, 25, 232, 0, 19, 94, 6633 }, // U+00FF
     { 19, 22, 301, 0, 22, 105, 0 }, // U+0100
     { 14, 19, 240, 1, 18, 67, 105 }, // U+0101
     { 19, 24, 301, 0, 24, 114, 172 }, // U+0102
@@ -2696,98 +2700,98 @@ static const EpdGlyph notoserif_12_boldGlyphs[] = {
     { 8, 4, 124, 0, 9, 8, 121 }, // U+2010
     { 8, 4, 124, 0, 9, 8, 129 }, // U+2011
     { 12, 2, 226, 1, 10, 6, 137 }, // U+2012
-    { 14, 3, 200, -1, 8, 11, 143 }, // U+2013
-    { 27, 3, 400, -1, 8, 21, 154 }, // U+2014
-    { 27, 3, 400, -1, 8, 21, 175 }, // U+2015
-    { 8, 25, 224, 3, 19, 50, 196 }, // U+2016
-    { 12, 6, 164, -1, 0, 18, 246 }, // U+2017
-    { 5, 8, 112, 1, 18, 10, 264 }, // U+2018
-    { 5, 8, 112, 1, 18, 10, 274 }, // U+2019
-    { 5, 8, 118, 1, 4, 10, 284 }, // U+201A
-    { 5, 8, 112, 1, 18, 10, 294 }, // U+201B
-    { 11, 8, 196, 1, 18, 22, 304 }, // U+201C
-    { 10, 8, 196, 1, 18, 20, 326 }, // U+201D
-    { 10, 8, 196, 1, 4, 20, 346 }, // U+201E
-    { 11, 8, 196, 1, 18, 22, 366 }, // U+201F
-    { 12, 22, 191, 0, 19, 66, 388 }, // U+2020
-    { 12, 22, 191, 0, 19, 66, 454 }, // U+2021
-    { 8, 9, 160, 1, 13, 18, 520 }, // U+2022
-    { 9, 9, 200, 2, 13, 21, 538 }, // U+2023
-    { 5, 5, 118, 1, 11, 7, 559 }, // U+2024
-    { 12, 5, 230, 1, 11, 15, 566 }, // U+2025
-    { 21, 5, 365, 1, 4, 27, 581 }, // U+2026
-    { 5, 5, 118, 1, 10, 7, 608 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 615 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 615 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 615 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 650 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 685 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 718 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 751 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 784 }, // U+202F
-    { 32, 20, 524, 0, 19, 160, 784 }, // U+2030
-    { 43, 20, 692, 0, 19, 215, 944 }, // U+2031
-    { 6, 7, 100, 0, 18, 11, 1159 }, // U+2032
-    { 12, 7, 196, 0, 18, 21, 1170 }, // U+2033
-    { 18, 7, 292, 0, 18, 32, 1191 }, // U+2034
-    { 6, 7, 100, 0, 18, 11, 1223 }, // U+2035
-    { 12, 7, 196, 0, 18, 21, 1234 }, // U+2036
-    { 18, 7, 292, 0, 18, 32, 1255 }, // U+2037
-    { 11, 8, 176, 0, 2, 22, 1287 }, // U+2038
-    { 7, 11, 141, 1, 12, 20, 1309 }, // U+2039
-    { 7, 11, 141, 1, 12, 20, 1329 }, // U+203A
-    { 18, 18, 328, 1, 18, 81, 1349 }, // U+203B
-    { 12, 19, 252, 2, 18, 57, 1430 }, // U+203C
-    { 15, 20, 246, 0, 19, 75, 1487 }, // U+203D
-    { 13, 2, 184, -1, 21, 7, 1562 }, // U+203E
-    { 20, 6, 0, -10, 0, 30, 1569 }, // U+203F
-    { 22, 5, 0, -11, 21, 28, 1599 }, // U+2040
-    { 12, 18, 180, 0, 18, 54, 1627 }, // U+2041
-    { 25, 19, 400, 0, 19, 119, 1681 }, // U+2042
-    { 7, 5, 145, 1, 11, 9, 1800 }, // U+2043
-    { 12, 18, 25, -5, 18, 54, 1809 }, // U+2044
-    { 8, 23, 166, 2, 19, 46, 1863 }, // U+2045
-    { 8, 23, 166, 0, 19, 46, 1909 }, // U+2046
-    { 26, 20, 426, 0, 19, 130, 1955 }, // U+2047
-    { 19, 20, 338, 0, 19, 95, 2085 }, // U+2048
-    { 18, 20, 340, 2, 19, 90, 2180 }, // U+2049
-    { 13, 20, 244, 1, 15, 65, 2270 }, // U+204A
-    { 14, 22, 251, 1, 19, 77, 2335 }, // U+204B
-    { 14, 10, 247, 1, 14, 35, 2412 }, // U+204C
-    { 14, 10, 247, 1, 14, 35, 2447 }, // U+204D
-    { 12, 11, 201, 0, 15, 33, 2482 }, // U+204E
-    { 6, 18, 122, 1, 14, 27, 2515 }, // U+204F
-    { 18, 20, 308, 1, 19, 90, 2542 }, // U+2050
-    { 12, 22, 201, 0, 20, 66, 2632 }, // U+2051
-    { 10, 19, 161, 0, 18, 48, 2698 }, // U+2052
-    { 13, 6, 224, 1, 12, 20, 2746 }, // U+2053
-    { 20, 6, 0, -10, 0, 30, 2766 }, // U+2054
-    { 12, 12, 216, 1, 15, 36, 2796 }, // U+2055
-    { 13, 15, 252, 1, 14, 49, 2832 }, // U+2056
-    { 24, 7, 388, 0, 18, 42, 2881 }, // U+2057
-    { 17, 15, 306, 1, 14, 64, 2923 }, // U+2058
-    { 17, 15, 306, 1, 14, 64, 2987 }, // U+2059
-    { 5, 20, 122, 1, 19, 25, 3051 }, // U+205A
-    { 17, 20, 306, 1, 19, 85, 3076 }, // U+205B
-    { 14, 14, 279, 2, 14, 49, 3161 }, // U+205C
-    { 5, 20, 122, 1, 19, 25, 3210 }, // U+205D
-    { 5, 20, 122, 1, 19, 25, 3235 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 3260 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 3260 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 3260 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 3260 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 3260 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 3260 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 3260 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 3260 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 3260 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 3260 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 3260 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3293 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3326 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3359 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3392 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3425 }, // U+206F
+    { 14, 3, 200, -1, 8, 11, 4603 }, // U+2013
+    { 27, 3, 400, -1, 8, 21, 4614 }, // U+2014
+    { 27, 3, 400, -1, 8, 21, 143 }, // U+2015
+    { 8, 25, 224, 3, 19, 50, 164 }, // U+2016
+    { 12, 6, 164, -1, 0, 18, 214 }, // U+2017
+    { 5, 8, 112, 1, 18, 10, 232 }, // U+2018
+    { 5, 8, 112, 1, 18, 10, 4635 }, // U+2019
+    { 5, 8, 118, 1, 4, 10, 242 }, // U+201A
+    { 5, 8, 112, 1, 18, 10, 252 }, // U+201B
+    { 11, 8, 196, 1, 18, 22, 4645 }, // U+201C
+    { 10, 8, 196, 1, 18, 20, 4667 }, // U+201D
+    { 10, 8, 196, 1, 4, 20, 262 }, // U+201E
+    { 11, 8, 196, 1, 18, 22, 282 }, // U+201F
+    { 12, 22, 191, 0, 19, 66, 304 }, // U+2020
+    { 12, 22, 191, 0, 19, 66, 370 }, // U+2021
+    { 8, 9, 160, 1, 13, 18, 436 }, // U+2022
+    { 9, 9, 200, 2, 13, 21, 454 }, // U+2023
+    { 5, 5, 118, 1, 11, 7, 475 }, // U+2024
+    { 12, 5, 230, 1, 11, 15, 482 }, // U+2025
+    { 21, 5, 365, 1, 4, 27, 4687 }, // U+2026
+    { 5, 5, 118, 1, 10, 7, 497 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 504 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 504 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 504 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 539 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 574 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 607 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 640 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 673 }, // U+202F
+    { 32, 20, 524, 0, 19, 160, 673 }, // U+2030
+    { 43, 20, 692, 0, 19, 215, 833 }, // U+2031
+    { 6, 7, 100, 0, 18, 11, 1048 }, // U+2032
+    { 12, 7, 196, 0, 18, 21, 1059 }, // U+2033
+    { 18, 7, 292, 0, 18, 32, 1080 }, // U+2034
+    { 6, 7, 100, 0, 18, 11, 1112 }, // U+2035
+    { 12, 7, 196, 0, 18, 21, 1123 }, // U+2036
+    { 18, 7, 292, 0, 18, 32, 1144 }, // U+2037
+    { 11, 8, 176, 0, 2, 22, 1176 }, // U+2038
+    { 7, 11, 141, 1, 12, 20, 1198 }, // U+2039
+    { 7, 11, 141, 1, 12, 20, 1218 }, // U+203A
+    { 18, 18, 328, 1, 18, 81, 1238 }, // U+203B
+    { 12, 19, 252, 2, 18, 57, 1319 }, // U+203C
+    { 15, 20, 246, 0, 19, 75, 1376 }, // U+203D
+    { 13, 2, 184, -1, 21, 7, 1451 }, // U+203E
+    { 20, 6, 0, -10, 0, 30, 1458 }, // U+203F
+    { 22, 5, 0, -11, 21, 28, 1488 }, // U+2040
+    { 12, 18, 180, 0, 18, 54, 1516 }, // U+2041
+    { 25, 19, 400, 0, 19, 119, 1570 }, // U+2042
+    { 7, 5, 145, 1, 11, 9, 1689 }, // U+2043
+    { 12, 18, 25, -5, 18, 54, 1698 }, // U+2044
+    { 8, 23, 166, 2, 19, 46, 1752 }, // U+2045
+    { 8, 23, 166, 0, 19, 46, 1798 }, // U+2046
+    { 26, 20, 426, 0, 19, 130, 1844 }, // U+2047
+    { 19, 20, 338, 0, 19, 95, 1974 }, // U+2048
+    { 18, 20, 340, 2, 19, 90, 2069 }, // U+2049
+    { 13, 20, 244, 1, 15, 65, 2159 }, // U+204A
+    { 14, 22, 251, 1, 19, 77, 2224 }, // U+204B
+    { 14, 10, 247, 1, 14, 35, 2301 }, // U+204C
+    { 14, 10, 247, 1, 14, 35, 2336 }, // U+204D
+    { 12, 11, 201, 0, 15, 33, 2371 }, // U+204E
+    { 6, 18, 122, 1, 14, 27, 2404 }, // U+204F
+    { 18, 20, 308, 1, 19, 90, 2431 }, // U+2050
+    { 12, 22, 201, 0, 20, 66, 2521 }, // U+2051
+    { 10, 19, 161, 0, 18, 48, 2587 }, // U+2052
+    { 13, 6, 224, 1, 12, 20, 2635 }, // U+2053
+    { 20, 6, 0, -10, 0, 30, 2655 }, // U+2054
+    { 12, 12, 216, 1, 15, 36, 2685 }, // U+2055
+    { 13, 15, 252, 1, 14, 49, 2721 }, // U+2056
+    { 24, 7, 388, 0, 18, 42, 2770 }, // U+2057
+    { 17, 15, 306, 1, 14, 64, 2812 }, // U+2058
+    { 17, 15, 306, 1, 14, 64, 2876 }, // U+2059
+    { 5, 20, 122, 1, 19, 25, 2940 }, // U+205A
+    { 17, 20, 306, 1, 19, 85, 2965 }, // U+205B
+    { 14, 14, 279, 2, 14, 49, 3050 }, // U+205C
+    { 5, 20, 122, 1, 19, 25, 3099 }, // U+205D
+    { 5, 20, 122, 1, 19, 25, 3124 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 3149 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 3149 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 3149 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 3149 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 3149 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 3149 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 3149 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 3149 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 3149 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 3149 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 3149 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 3182 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 3215 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 3248 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 3281 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3314 }, // U+206F
     { 10, 12, 160, 0, 21, 30, 0 }, // U+2070
     { 6, 12, 92, 0, 19, 18, 30 }, // U+2071
     { 10, 12, 160, 0, 21, 30, 48 }, // U+2074
@@ -2864,13 +2868,13 @@ static const EpdGlyph notoserif_12_boldGlyphs[] = {
     { 14, 22, 226, 0, 20, 77, 2681 }, // U+20BF
     { 13, 19, 211, 0, 14, 62, 2758 }, // U+20C0
     { 12, 3, 229, 1, 10, 9, 0 }, // U+2212
-    { 21, 20, 305, 0, 20, 105, 0 }, // U+FB00
-    { 18, 20, 288, 0, 20, 90, 105 }, // U+FB01
-    { 18, 20, 288, 0, 20, 90, 195 }, // U+FB02
-    { 27, 20, 430, 0, 20, 135, 285 }, // U+FB03
-    { 27, 20, 430, 0, 20, 135, 420 }, // U+FB04
-    { 19, 21, 301, 0, 20, 100, 555 }, // U+FB05
-    { 22, 21, 348, 0, 20, 116, 655 }, // U+FB06
+    { 21, 20, 305, 0, 20, 105, 4714 }, // U+FB00
+    { 18, 20, 288, 0, 20, 90, 4819 }, // U+FB01
+    { 18, 20, 288, 0, 20, 90, 4909 }, // U+FB02
+    { 27, 20, 430, 0, 20, 135, 4999 }, // U+FB03
+    { 27, 20, 430, 0, 20, 135, 5134 }, // U+FB04
+    { 19, 21, 301, 0, 20, 100, 0 }, // U+FB05
+    { 22, 21, 348, 0, 20, 116, 100 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -2878,8 +2882,7 @@ static const EpdUnicodeInterval notoserif_12_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -2887,8 +2890,7 @@ static const EpdUnicodeInterval notoserif_12_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -2898,19 +2900,57 @@ static const EpdUnicodeInterval notoserif_12_boldIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_12_boldGroups[] = {
-    { 0, 3088, 6272, 97, 0 },
-    { 3088, 2691, 7532, 96, 97 },
-    { 5779, 3264, 12064, 128, 193 },
-    { 9043, 3297, 10730, 96, 321 },
-    { 12340, 1057, 1624, 112, 417 },
-    { 13397, 8800, 24348, 256, 529 },
-    { 22197, 1903, 9942, 90, 785 },
-    { 24100, 1762, 3898, 111, 875 },
-    { 25862, 578, 1215, 42, 986 },
-    { 26440, 1745, 3009, 33, 1028 },
-    { 28185, 11, 9, 1, 1061 },
-    { 28196, 346, 831, 7, 1062 },
-    { 28542, 98, 138, 1, 1069 },
+    { 0, 2736, 5859, 83, 2 },
+    { 2736, 678, 1224, 26, 0 },
+    { 3414, 2681, 7448, 95, 97 },
+    { 6095, 3264, 12064, 128, 193 },
+    { 9359, 3297, 10730, 96, 321 },
+    { 12656, 1057, 1624, 112, 417 },
+    { 13713, 8800, 24348, 256, 529 },
+    { 22513, 1903, 9942, 90, 785 },
+    { 24416, 1710, 3771, 105, 875 },
+    { 26126, 578, 1215, 42, 986 },
+    { 26704, 1745, 3009, 33, 1028 },
+    { 28449, 11, 9, 1, 1061 },
+    { 28460, 140, 231, 2, 1067 },
+    { 28600, 98, 138, 1, 1069 },
+};
+
+static const uint16_t notoserif_12_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_12_boldKernLeftClasses[] = {
@@ -3829,18 +3869,81 @@ static const EpdLigaturePair notoserif_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_12_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 0 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_12_bold = {
     notoserif_12_boldBitmaps,
     notoserif_12_boldGlyphs,
     notoserif_12_boldIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notoserif_12_boldGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_12_boldGlyphToGroup,
     notoserif_12_boldKernLeftClasses,
     notoserif_12_boldKernRightClasses,
     notoserif_12_boldKernMatrix,
@@ -3850,4 +3953,8 @@ static const EpdFontData notoserif_12_bold = {
     65,
     notoserif_12_boldLigaturePairs,
     5,
+    notoserif_12_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
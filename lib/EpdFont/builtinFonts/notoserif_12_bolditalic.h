@@ -3,2058 +3,2066 @@
  * name: notoserif_12_bolditalic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_12_bolditalic 12 ../builtinFonts/source/NotoSerif/NotoSerif-BoldItalic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_12_bolditalic 12 ../builtinFonts/source/NotoSerif/NotoSerif-BoldItalic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_12_bolditalicBitmaps[32731] = {
-    0x8D, 0x59, 0x3D, 0x6C, 0xDE, 0xD6, 0x15, 0xBD, 0x24, 0x6D, 0xB1, 0x30, 0x11, 0xBD, 0x0E, 0x76,
-    0x7E, 0xEC, 0xCA, 0xCC, 0xD0, 0x21, 0x48, 0x22, 0x33, 0x43, 0x0A, 0x18, 0xE8, 0x67, 0x91, 0x76,
-    0x80, 0x66, 0x28, 0xD0, 0x68, 0xB0, 0x91, 0xA5, 0x80, 0x3B, 0x67, 0x51, 0x07, 0x0D, 0x0A, 0x60,
-    0x9B, 0x74, 0x3C, 0x64, 0x08, 0xD0, 0x68, 0xA8, 0x9B, 0xA1, 0x28, 0xEC, 0xC1, 0x43, 0xEB, 0x16,
-    0xB0, 0x0B, 0x18, 0x45, 0x06, 0x45, 0xA4, 0xED, 0xC1, 0x43, 0x16, 0x06, 0x29, 0x90, 0xC1, 0x43,
-    0xD9, 0xD6, 0x49, 0x00, 0x07, 0xAD, 0x19, 0x94, 0x69, 0x28, 0x99, 0xE4, 0xEB, 0x39, 0x8F, 0xA4,
-    0xF4, 0x49, 0xB6, 0x8B, 0x50, 0x1F, 0xDF, 0xF7, 0x43, 0xF2, 0xBE, 0x7B, 0xCF, 0xBB, 0xF7, 0xDC,
-    0x7B, 0x9F, 0x24, 0x8D, 0x44, 0x0B, 0x5F, 0xAD, 0x58, 0x8D, 0x58, 0xB5, 0xD8, 0x95, 0xD8, 0xA5,
-    0x38, 0x85, 0x38, 0xB9, 0x38, 0x99, 0x38, 0x89, 0x58, 0xC2, 0x43, 0x45, 0x12, 0x66, 0x7C, 0x05,
-    0x09, 0xBF, 0x06, 0xB7, 0xAB, 0xE0, 0xDD, 0x32, 0x7C, 0xBD, 0x0C, 0xDD, 0x7C, 0xC1, 0xCB, 0x26,
-    0x5E, 0x72, 0xD4, 0x33, 0xF7, 0x39, 0xEF, 0x64, 0xE2, 0xBE, 0x96, 0x89, 0xE7, 0x46, 0xA2, 0xF0,
-    0xD3, 0x9C, 0x12, 0x4F, 0xEB, 0x12, 0x67, 0x21, 0x47, 0x27, 0x22, 0xCB, 0x47, 0x45, 0xCA, 0x65,
-    0x91, 0xE2, 0xBA, 0xBC, 0xB4, 0xB9, 0x19, 0x85, 0x5A, 0x27, 0xCE, 0x2D, 0xCC, 0x73, 0x01, 0x8F,
-    0x60, 0x32, 0x85, 0xC7, 0x66, 0x8D, 0xA4, 0x57, 0x71, 0xFE, 0x12, 0x13, 0xE9, 0x44, 0x5A, 0x5D,
-    0xD8, 0xD5, 0x67, 0xA5, 0x53, 0xDE, 0x2E, 0x9C, 0x6F, 0x6E, 0x45, 0x8E, 0xCE, 0xC4, 0xC6, 0x29,
-    0x69, 0x2D, 0xE2, 0x77, 0x82, 0x09, 0x64, 0xCF, 0xBE, 0x38, 0x39, 0xF6, 0x54, 0x98, 0x9C, 0x7B,
-    0x2A, 0x88, 0xC2, 0x9F, 0x87, 0x12, 0xB4, 0x8D, 0xB8, 0x98, 0xD2, 0x88, 0x79, 0xA5, 0x17, 0x35,
-    0x1C, 0x69, 0x62, 0xC1, 0xB4, 0x2F, 0x0B, 0x58, 0xA7, 0x6E, 0x96, 0x98, 0xCB, 0x3F, 0x5E, 0xCE,
-    0x89, 0x84, 0x76, 0x09, 0xD5, 0x16, 0xEC, 0xB2, 0xC4, 0xE8, 0xFC, 0x23, 0xC7, 0xE8, 0x7E, 0xFA,
-    0x4E, 0x2D, 0x0B, 0xEA, 0x7D, 0x3F, 0x95, 0x60, 0x69, 0xFE, 0xAC, 0x8A, 0xBC, 0x6A, 0xA5, 0x51,
-    0xB0, 0xFF, 0xEB, 0x0A, 0xA3, 0x7D, 0xAB, 0xF4, 0x23, 0x71, 0x2F, 0x94, 0x3E, 0xD0, 0x71, 0xCA,
-    0x05, 0x91, 0x89, 0x5D, 0x9E, 0x81, 0x85, 0x56, 0x55, 0xC1, 0x46, 0x49, 0x73, 0x99, 0x3E, 0x6C,
-    0x6A, 0xA3, 0xBE, 0x80, 0xCA, 0x41, 0xD6, 0x60, 0xBA, 0x64, 0x8D, 0x03, 0x3E, 0x05, 0x37, 0x71,
-    0xBB, 0xFF, 0x00, 0x77, 0xAB, 0xD6, 0xFE, 0x83, 0xC4, 0xB5, 0xBB, 0xE1, 0x74, 0xAD, 0x97, 0xA9,
-    0x42, 0xAB, 0x28, 0xCC, 0xC2, 0x7F, 0xE3, 0x36, 0xBF, 0xC1, 0xE0, 0xD5, 0x18, 0x9C, 0x16, 0xCF,
-    0xBB, 0x5A, 0xD4, 0x46, 0x9A, 0xE6, 0xB6, 0xAE, 0xC2, 0xCA, 0x48, 0x0F, 0xB2, 0x30, 0x09, 0x25,
-    0x94, 0x63, 0x32, 0x91, 0xA3, 0xE3, 0x94, 0x37, 0xC4, 0x2B, 0xF1, 0x88, 0x74, 0xE2, 0x00, 0x8D,
-    0x4A, 0x54, 0x29, 0x41, 0xCE, 0x35, 0x8C, 0x33, 0xA0, 0x20, 0x5B, 0x6B, 0xDF, 0xBF, 0x52, 0x91,
-    0x18, 0x2A, 0x45, 0xE2, 0x63, 0x29, 0x0A, 0xB1, 0x80, 0xC3, 0xF7, 0x8D, 0x18, 0x80, 0xD3, 0xFF,
-    0xE4, 0xC0, 0x37, 0x1A, 0xBE, 0xAC, 0x56, 0xEC, 0xF1, 0x05, 0xD1, 0x94, 0x5E, 0x8B, 0x67, 0x26,
-    0xF0, 0x0B, 0x33, 0x41, 0xC4, 0x49, 0x6B, 0xF1, 0x73, 0x59, 0x18, 0xC5, 0xC0, 0x85, 0x66, 0x95,
-    0x04, 0x3F, 0xDB, 0xE3, 0xFD, 0xEB, 0xEC, 0x5E, 0xDD, 0x85, 0x3A, 0x59, 0xF8, 0x71, 0x25, 0x2B,
-    0x8D, 0xD4, 0xAF, 0xC8, 0x87, 0xE6, 0x86, 0xFD, 0x80, 0x70, 0xFB, 0x15, 0xEB, 0x16, 0xAF, 0xE9,
-    0x5F, 0x70, 0x83, 0x9B, 0xA8, 0x52, 0xC1, 0x13, 0x6C, 0x2C, 0xDF, 0x11, 0x79, 0x1E, 0x0F, 0xC5,
-    0x4D, 0xDA, 0xBC, 0x75, 0xC5, 0x27, 0x52, 0xC0, 0xC0, 0xB8, 0x20, 0x5C, 0xC3, 0x8B, 0x30, 0x1F,
-    0x3E, 0xCF, 0x8B, 0x79, 0x10, 0x50, 0x70, 0x49, 0xC4, 0xCE, 0x77, 0x5E, 0x9E, 0x1B, 0x2E, 0xAF,
-    0xF4, 0x97, 0xAD, 0xA2, 0xBF, 0xEC, 0x26, 0xFD, 0xE5, 0xC3, 0x53, 0x97, 0xB7, 0x0E, 0x0F, 0x1E,
-    0x17, 0x5E, 0xCB, 0xA4, 0xF1, 0x72, 0xA7, 0x76, 0x4B, 0x17, 0xDA, 0xA8, 0x02, 0x67, 0xEE, 0x96,
-    0x7E, 0xE6, 0x96, 0x41, 0xE6, 0x95, 0x58, 0xAB, 0x22, 0x4C, 0x54, 0x1E, 0x46, 0x2A, 0x0B, 0x23,
-    0x1F, 0x27, 0xFF, 0x62, 0xC0, 0xD8, 0x88, 0xFA, 0xB2, 0xEA, 0xBD, 0x77, 0x0F, 0x64, 0x01, 0x48,
-    0xAF, 0x91, 0xB4, 0xF1, 0xBE, 0xAD, 0xDD, 0x3B, 0x95, 0xB8, 0x25, 0x57, 0x0C, 0x28, 0xAA, 0x82,
-    0xD0, 0x05, 0x26, 0xE0, 0x60, 0x14, 0x5E, 0x40, 0x34, 0x95, 0xA7, 0xF5, 0xAF, 0x63, 0xDD, 0xF4,
-    0x5A, 0xE8, 0x55, 0x89, 0x2F, 0x55, 0xD2, 0x01, 0xFC, 0x66, 0x38, 0x9F, 0xC5, 0x02, 0x51, 0x86,
-    0x28, 0x88, 0x0F, 0x71, 0x13, 0x9C, 0x0D, 0x91, 0x2C, 0x70, 0x53, 0x81, 0x63, 0xDA, 0x85, 0x14,
-    0x5E, 0x62, 0xE7, 0x88, 0xB9, 0x6C, 0x38, 0x0D, 0x5E, 0x08, 0x14, 0x4C, 0x31, 0x25, 0xEB, 0x43,
-    0x9C, 0x5C, 0x51, 0x6A, 0x42, 0x5F, 0x09, 0x5A, 0x91, 0x83, 0x1A, 0x42, 0xA0, 0x0D, 0x17, 0x18,
-    0xEA, 0xED, 0xC3, 0x3B, 0xA2, 0x0C, 0x16, 0xC6, 0x59, 0x70, 0x5F, 0x43, 0x44, 0x35, 0xC0, 0x03,
-    0xBD, 0xCD, 0x7D, 0x30, 0xD1, 0x81, 0x5C, 0x2F, 0x4E, 0x64, 0x0E, 0xCA, 0xAF, 0xC0, 0xBD, 0x0A,
-    0x0D, 0x74, 0x3B, 0x20, 0xDB, 0xCA, 0x3C, 0xD8, 0xE6, 0xED, 0x37, 0xDB, 0x48, 0x6B, 0x9D, 0x9F,
-    0x7A, 0x73, 0x23, 0xA2, 0x7B, 0xD2, 0x76, 0x59, 0xDA, 0x00, 0x3A, 0xF0, 0xC6, 0x58, 0x23, 0x82,
-    0x70, 0x82, 0x3B, 0x04, 0x7A, 0x23, 0x64, 0x57, 0xB9, 0x32, 0xA0, 0x08, 0x71, 0xAF, 0xAD, 0xC2,
-    0x7C, 0xE8, 0x44, 0xAF, 0x25, 0x30, 0xC4, 0x07, 0xE7, 0x7E, 0x38, 0xEF, 0x1A, 0x50, 0x5A, 0x03,
-    0xAA, 0xF1, 0x1F, 0x2B, 0xF1, 0x07, 0xF3, 0x06, 0x1B, 0x41, 0x60, 0xA7, 0x73, 0xAB, 0xF1, 0xB0,
-    0x56, 0x6E, 0xEE, 0x15, 0x36, 0x9D, 0x9A, 0x10, 0xC3, 0xF4, 0x42, 0xE2, 0x87, 0x78, 0x26, 0xD2,
-    0x78, 0x3A, 0x36, 0xE7, 0xBA, 0x39, 0xF9, 0xA9, 0x93, 0x10, 0xBA, 0xFA, 0x77, 0x2B, 0x03, 0x53,
-    0x0F, 0xBD, 0xAE, 0x14, 0xF4, 0xC2, 0x59, 0xCC, 0x02, 0xEB, 0x1F, 0x48, 0x10, 0xED, 0x91, 0x73,
-    0xB8, 0x02, 0xD8, 0xEC, 0xA9, 0x25, 0x08, 0x22, 0x13, 0x52, 0xE6, 0xE7, 0x7A, 0xF8, 0x19, 0xE8,
-    0x90, 0x41, 0xC3, 0x51, 0x2F, 0x1F, 0x7A, 0xE9, 0xD3, 0xB9, 0xDD, 0x38, 0xA5, 0x53, 0x0D, 0x67,
-    0xED, 0x16, 0x76, 0x03, 0x01, 0x7A, 0x1D, 0xCF, 0x57, 0x62, 0xC1, 0x56, 0xF5, 0x77, 0x1D, 0x21,
-    0xC2, 0xB3, 0x18, 0x1A, 0xAF, 0x43, 0xF3, 0x75, 0xBC, 0xC7, 0xB0, 0x37, 0xF8, 0xA4, 0x9B, 0xC2,
-    0x7E, 0xF0, 0xCE, 0x34, 0xCD, 0xAC, 0x46, 0xE5, 0x4E, 0xE5, 0x96, 0x1E, 0xFC, 0x53, 0x15, 0x3C,
-    0x3D, 0x9C, 0xF8, 0x2B, 0x83, 0xDC, 0xED, 0x74, 0x6E, 0xE9, 0x4B, 0xD9, 0xB6, 0x26, 0xEB, 0xF2,
-    0x02, 0x94, 0x3C, 0x03, 0xF7, 0x01, 0x44, 0x86, 0x52, 0x79, 0x58, 0xAB, 0x6E, 0xE5, 0x55, 0x5E,
-    0x69, 0x4D, 0xC1, 0x78, 0x04, 0x98, 0x68, 0xDC, 0x8F, 0xE3, 0x39, 0x83, 0x7D, 0x4A, 0xBF, 0x94,
-    0x67, 0x65, 0xD7, 0x81, 0x40, 0x53, 0xC6, 0x99, 0x9D, 0x92, 0x51, 0x85, 0xA5, 0x0B, 0x44, 0x7E,
-    0x38, 0x5C, 0x44, 0xD4, 0x7D, 0x44, 0x3E, 0x49, 0xB9, 0xEA, 0x20, 0x1C, 0x88, 0xC1, 0x37, 0x4A,
-    0x85, 0xDF, 0x03, 0x6C, 0x13, 0x96, 0x5C, 0x5A, 0xDD, 0xBE, 0x78, 0xF5, 0xF7, 0xFD, 0xE7, 0x03,
-    0xA7, 0x4E, 0xE2, 0x2B, 0x46, 0x7C, 0x46, 0xFA, 0x00, 0xDA, 0x7C, 0xA4, 0x33, 0xFE, 0xC6, 0xCC,
-    0xD5, 0xF0, 0xD9, 0x75, 0xCE, 0x08, 0x69, 0xCB, 0xA3, 0x1A, 0x33, 0xBA, 0x08, 0xBE, 0x6A, 0xE2,
-    0x13, 0x2D, 0xD6, 0xF1, 0x08, 0xEE, 0xB6, 0x0C, 0x5F, 0x41, 0xB3, 0x38, 0x01, 0x3B, 0xF5, 0x29,
-    0xAE, 0xCF, 0x6F, 0x5E, 0x62, 0xB8, 0x31, 0x37, 0x5E, 0xC1, 0x03, 0x8E, 0x88, 0x5F, 0x37, 0x96,
-    0x72, 0x33, 0x99, 0x49, 0x8C, 0x60, 0x57, 0x97, 0x34, 0x0D, 0x26, 0x8B, 0x1F, 0x7A, 0x51, 0x60,
-    0x57, 0x0B, 0x6E, 0x72, 0xCC, 0xCB, 0x17, 0x9C, 0xEC, 0x8C, 0xCA, 0xCE, 0x3A, 0xD9, 0x9A, 0x9F,
-    0xAC, 0x39, 0x59, 0x0D, 0x37, 0x74, 0x93, 0x3A, 0x04, 0x43, 0x44, 0x1C, 0x95, 0xD4, 0xC1, 0x89,
-    0xE6, 0xB0, 0xAC, 0xA9, 0xBB, 0x0B, 0x6B, 0x40, 0xB9, 0x41, 0x08, 0x2D, 0xF4, 0x8B, 0xDF, 0x4F,
-    0x0D, 0x99, 0xCF, 0x33, 0xF7, 0xCE, 0xC0, 0xA2, 0xE0, 0xA1, 0x41, 0xFF, 0xAD, 0xC8, 0x5C, 0xEA,
-    0x4C, 0xE2, 0x20, 0xA7, 0x71, 0xF0, 0x52, 0x72, 0x12, 0x1D, 0x7E, 0xC2, 0x61, 0x99, 0x6E, 0x0F,
-    0xAE, 0x01, 0xD8, 0x08, 0x38, 0x07, 0xFC, 0x27, 0xDE, 0x45, 0x84, 0xAB, 0x8F, 0x98, 0x82, 0xAA,
-    0x30, 0x67, 0x85, 0xD1, 0x4A, 0x36, 0x41, 0xE8, 0xAB, 0xF2, 0x50, 0x05, 0xA3, 0xC2, 0xD6, 0xD6,
-    0x1D, 0xA2, 0x0A, 0xD6, 0x2D, 0x6D, 0xC2, 0xA1, 0x55, 0x09, 0x9B, 0x55, 0x11, 0x80, 0x70, 0x0A,
-    0xDC, 0x1C, 0xE4, 0x01, 0x09, 0x9C, 0xB4, 0x73, 0xD3, 0x44, 0x21, 0xAC, 0x8E, 0x3F, 0xA0, 0x4F,
-    0x09, 0x1D, 0x15, 0xB8, 0x99, 0xC1, 0xEA, 0x90, 0x40, 0x40, 0xFE, 0x3A, 0x72, 0x1A, 0x4B, 0xCB,
-    0xA1, 0xEE, 0x5A, 0x83, 0x7B, 0x41, 0x49, 0x83, 0xE7, 0x30, 0x3A, 0xFD, 0x2F, 0x28, 0x20, 0xC2,
-    0xCD, 0x48, 0x5E, 0x11, 0xE0, 0x3E, 0x66, 0xF8, 0xC4, 0x10, 0x08, 0x95, 0xEB, 0x69, 0xA2, 0x1F,
-    0x62, 0x33, 0x24, 0xE3, 0xA7, 0xFE, 0x42, 0x8E, 0xC4, 0xED, 0xD7, 0xC8, 0x43, 0xAE, 0x36, 0xD9,
-    0xBE, 0x1B, 0x57, 0x75, 0xD4, 0x9E, 0x3E, 0xE6, 0x23, 0xEB, 0x14, 0x58, 0x53, 0xBF, 0x60, 0x66,
-    0xCC, 0x6D, 0x84, 0x6B, 0x66, 0x0D, 0x43, 0x9C, 0xE0, 0x6B, 0x1C, 0x61, 0x48, 0x23, 0x5C, 0xD5,
-    0x5C, 0x7B, 0x8D, 0x3C, 0x85, 0x4B, 0x7E, 0x09, 0xED, 0xC3, 0x8C, 0xDA, 0x47, 0xD0, 0xBE, 0xA6,
-    0xF6, 0x09, 0x25, 0x23, 0x4B, 0x2F, 0x6D, 0x5E, 0xA3, 0x64, 0x87, 0xB8, 0xC0, 0x3F, 0xFC, 0xC2,
-    0xCE, 0x1E, 0xD1, 0xD7, 0xE0, 0x72, 0x71, 0xD1, 0x64, 0xCD, 0x9E, 0x87, 0xCC, 0x00, 0xC9, 0xFB,
-    0x98, 0x14, 0x0F, 0x73, 0xAA, 0x63, 0xC0, 0xE5, 0xAA, 0xC1, 0xA5, 0xD9, 0x96, 0x5C, 0x8C, 0x92,
-    0x11, 0x21, 0x8F, 0x95, 0x7C, 0xFF, 0xCA, 0x20, 0x3E, 0x8D, 0x76, 0x49, 0x16, 0x4A, 0x16, 0x4A,
-    0x16, 0x48, 0x26, 0xB7, 0xE8, 0x6C, 0xBB, 0xAA, 0x61, 0x1D, 0xB4, 0x89, 0x9A, 0x23, 0x4E, 0x82,
-    0x12, 0x6E, 0x0E, 0xD5, 0x6B, 0x51, 0xC9, 0x36, 0xE2, 0x61, 0xBE, 0x0D, 0xF6, 0xBE, 0xAB, 0x97,
-    0xE3, 0xC4, 0xD7, 0x25, 0xD6, 0x86, 0xAB, 0x69, 0xA0, 0x40, 0x5A, 0x27, 0x1E, 0x40, 0x86, 0xE9,
-    0xBC, 0x5B, 0x02, 0x61, 0xA5, 0x5B, 0x0B, 0xAA, 0xF5, 0xBB, 0x30, 0x62, 0xA9, 0xFB, 0x89, 0xBE,
-    0xC7, 0x45, 0x84, 0x6A, 0x8A, 0xE1, 0x4B, 0xC9, 0xDA, 0x2C, 0xA6, 0x96, 0x1E, 0x72, 0x0A, 0x6A,
-    0x65, 0xB0, 0x39, 0xBE, 0xF8, 0x66, 0x43, 0x3B, 0xA0, 0x09, 0x6E, 0x70, 0xCD, 0x88, 0x2A, 0x01,
-    0xB7, 0x41, 0x06, 0x6E, 0xC3, 0x68, 0x56, 0x0E, 0xD6, 0x1C, 0x07, 0xCF, 0xC5, 0xFA, 0x36, 0x5C,
-    0x53, 0xB8, 0x10, 0x4B, 0x30, 0x8F, 0xAA, 0xAB, 0xA2, 0xD7, 0x3E, 0x18, 0x92, 0x8A, 0x39, 0x93,
-    0x9E, 0xF4, 0x89, 0x8F, 0xEE, 0xD1, 0xE1, 0xC4, 0x9C, 0x96, 0xD0, 0x10, 0x19, 0x03, 0x8C, 0x03,
-    0x61, 0x56, 0xBA, 0x31, 0xF5, 0x50, 0xF2, 0xC8, 0x43, 0x00, 0x6A, 0xEB, 0xC1, 0x31, 0xE9, 0x41,
-    0xC3, 0x7E, 0xEE, 0xE1, 0x34, 0xF3, 0x0F, 0x22, 0x60, 0xB2, 0x31, 0x69, 0xD5, 0x60, 0xF2, 0x1E,
-    0xA6, 0x59, 0xEA, 0x5E, 0x37, 0x51, 0xC4, 0xD4, 0x0B, 0xA2, 0x35, 0x09, 0xD2, 0x37, 0x0E, 0xCE,
-    0x9A, 0x26, 0xBC, 0x65, 0xA0, 0xFF, 0xB8, 0xF7, 0x99, 0x5C, 0xFA, 0xBC, 0x06, 0x01, 0xEF, 0x93,
-    0xB2, 0x35, 0x2A, 0x3A, 0x8C, 0x6E, 0x43, 0x65, 0x1C, 0x63, 0x03, 0x83, 0x9D, 0x5E, 0x9A, 0xD0,
-    0x8E, 0xB4, 0xA0, 0x25, 0x7E, 0xD9, 0x63, 0x62, 0x40, 0xE9, 0x43, 0x88, 0xB0, 0x3C, 0x3E, 0x8E,
-    0x92, 0x21, 0x23, 0xEE, 0xF0, 0x1E, 0x9B, 0xB6, 0x7A, 0x06, 0x71, 0x0A, 0x3F, 0x42, 0xBF, 0x6C,
-    0x47, 0xBF, 0x44, 0x41, 0x07, 0x6F, 0x5B, 0x6A, 0x4D, 0xB9, 0xAC, 0x70, 0x0B, 0x1E, 0x9A, 0xED,
-    0xE4, 0x30, 0xD4, 0x99, 0xD3, 0xB2, 0x00, 0x70, 0xE6, 0xB5, 0xFC, 0x05, 0x77, 0x4E, 0x52, 0xF9,
-    0x0F, 0xDF, 0x62, 0xFB, 0x53, 0xA8, 0xBD, 0x12, 0xBF, 0xF6, 0x6E, 0x4D, 0x0E, 0xFA, 0x29, 0xF1,
-    0xBA, 0x1E, 0xFE, 0x8A, 0x8A, 0x95, 0xE1, 0x9F, 0xFA, 0xB7, 0x9A, 0x44, 0x5E, 0x04, 0x25, 0xC8,
-    0xD9, 0x06, 0xA3, 0x04, 0xA4, 0x27, 0x9F, 0xAC, 0x72, 0xE8, 0x9E, 0x7F, 0x3C, 0xBD, 0x87, 0xA2,
-    0x4D, 0x79, 0x66, 0xF6, 0x92, 0x45, 0xFC, 0x12, 0xE6, 0xC7, 0xDC, 0x0D, 0x6B, 0x2E, 0x68, 0x30,
-    0x0B, 0x92, 0xD3, 0xAC, 0xBD, 0x5E, 0x4E, 0x23, 0xD4, 0x6F, 0x93, 0x30, 0x61, 0xF5, 0x17, 0x64,
-    0x18, 0x57, 0x54, 0x81, 0xEA, 0x76, 0xD9, 0x63, 0x07, 0x71, 0xDD, 0xA9, 0xAF, 0x63, 0x2E, 0xA7,
-    0xE1, 0x8C, 0x56, 0x67, 0xF2, 0x0C, 0x4C, 0x40, 0x5C, 0xC5, 0x86, 0xD7, 0xCD, 0x6C, 0xA4, 0xF3,
-    0xB8, 0x31, 0xD9, 0x78, 0x60, 0x26, 0x16, 0xDB, 0xF7, 0x4D, 0xB9, 0x0B, 0x87, 0x85, 0xF7, 0xE5,
-    0x8C, 0x93, 0x92, 0x35, 0x57, 0xE9, 0x33, 0x38, 0x03, 0xC6, 0x3E, 0x9E, 0x55, 0x25, 0xA9, 0x94,
-    0x43, 0x90, 0x03, 0x56, 0xA4, 0x5E, 0xD6, 0x61, 0xB8, 0x60, 0x1E, 0x6C, 0x01, 0x3F, 0x92, 0x97,
-    0xDB, 0x32, 0x3F, 0xA4, 0x0C, 0x4B, 0xAB, 0x8F, 0x93, 0x7B, 0x86, 0x99, 0x64, 0x94, 0x11, 0xE4,
-    0x23, 0xAF, 0x9A, 0xC2, 0x78, 0x24, 0xD7, 0x38, 0x81, 0xB4, 0xF8, 0x37, 0xE4, 0x55, 0x3E, 0xF1,
-    0xE4, 0x28, 0x5F, 0xA4, 0xC7, 0x14, 0xF2, 0x64, 0xED, 0xDD, 0x9D, 0xDA, 0x87, 0x3B, 0xB4, 0x2F,
-    0xE2, 0x64, 0x4A, 0xFB, 0x98, 0xDA, 0xEB, 0xC7, 0x6B, 0xEF, 0x1B, 0xB7, 0xDA, 0x1A, 0x8C, 0x63,
-    0x3A, 0xF4, 0x37, 0x43, 0xC8, 0x23, 0xE1, 0x1A, 0x8B, 0xCA, 0x7E, 0x42, 0xBF, 0x30, 0xED, 0x04,
-    0x86, 0x30, 0xF3, 0x47, 0xB3, 0xCE, 0x0F, 0x95, 0x9B, 0xA4, 0xA7, 0xE9, 0xB5, 0x74, 0x0D, 0xBA,
-    0xB7, 0xC5, 0xCA, 0x12, 0xCE, 0xCD, 0x46, 0xC4, 0xA4, 0x8B, 0xC5, 0x34, 0x87, 0x59, 0x7E, 0xB1,
-    0x55, 0xCA, 0xA6, 0x97, 0x2A, 0x0B, 0xA5, 0xA7, 0x53, 0xD9, 0xB5, 0x53, 0x59, 0x85, 0x89, 0x47,
-    0x3D, 0x34, 0x4D, 0x74, 0x94, 0x40, 0xB3, 0x84, 0x63, 0x16, 0xC8, 0x9F, 0xC3, 0xAC, 0xE7, 0x50,
-    0x48, 0xA5, 0x58, 0xD5, 0x38, 0x0A, 0x92, 0xF0, 0xF3, 0x14, 0x22, 0xFA, 0x12, 0x48, 0xB1, 0x9E,
-    0xF4, 0xBF, 0xD2, 0xD7, 0xB2, 0x79, 0x08, 0xCB, 0x26, 0x1C, 0x8E, 0xBA, 0x35, 0xAA, 0x46, 0xD6,
-    0x97, 0x26, 0xB4, 0xA7, 0xAC, 0xDC, 0x8E, 0xA0, 0x20, 0x7B, 0x34, 0x8C, 0x18, 0x41, 0x33, 0x64,
-    0x40, 0x9F, 0xC2, 0x43, 0x9D, 0xEB, 0x3A, 0xE8, 0xA2, 0xA5, 0x82, 0x88, 0x53, 0xDC, 0x2C, 0x8B,
-    0x8D, 0x39, 0x4A, 0x9A, 0xE7, 0x30, 0xA1, 0xB8, 0x09, 0xC5, 0x1D, 0xA5, 0x90, 0x65, 0x0E, 0xD7,
-    0x49, 0x1A, 0x2C, 0x36, 0xD8, 0x0E, 0x46, 0xF0, 0xCF, 0x38, 0x32, 0x8E, 0xC9, 0x62, 0x63, 0x73,
-    0x5D, 0xA6, 0x2A, 0xB7, 0x54, 0x9F, 0xD0, 0xC5, 0xD2, 0x86, 0x95, 0xAE, 0x42, 0x94, 0x49, 0x94,
-    0x67, 0x28, 0xBE, 0x64, 0xB6, 0x2A, 0x30, 0x1B, 0x1E, 0x73, 0x6B, 0x3C, 0xE6, 0xD4, 0x8A, 0xBE,
-    0x31, 0xCF, 0x61, 0xC2, 0xE1, 0x06, 0xFD, 0xA5, 0xA0, 0xE7, 0x64, 0xF4, 0x8F, 0x64, 0x8C, 0x7A,
-    0x2E, 0x2A, 0x0B, 0x4F, 0x48, 0x8E, 0x9E, 0x43, 0x08, 0xA0, 0x9C, 0x59, 0x90, 0xA5, 0x7B, 0x24,
-    0x6F, 0xD4, 0x3A, 0x78, 0xD3, 0xAC, 0x63, 0x4A, 0xF0, 0xCD, 0x11, 0x4C, 0x04, 0xAC, 0x27, 0x98,
-    0xCA, 0x4B, 0xA3, 0x15, 0xBC, 0xA9, 0x30, 0x41, 0xD2, 0xAD, 0xE6, 0xC3, 0xF3, 0x98, 0xBA, 0x9E,
-    0x84, 0xB7, 0x39, 0xF9, 0x8D, 0xF0, 0x0E, 0xA7, 0x2F, 0x83, 0x8F, 0x23, 0x71, 0x36, 0x73, 0xFF,
-    0x6F, 0x5C, 0xA1, 0xCC, 0x27, 0x79, 0xEA, 0x48, 0xF5, 0xEB, 0xA5, 0x2A, 0x19, 0x78, 0x9D, 0x5D,
-    0xA2, 0x32, 0xC8, 0x02, 0xB7, 0x82, 0x55, 0x2E, 0x38, 0x13, 0x14, 0x77, 0xCC, 0xD4, 0x33, 0xEC,
-    0xC6, 0xF4, 0x09, 0x5E, 0x4E, 0xDF, 0xA3, 0x8F, 0xA1, 0xC7, 0xE5, 0x58, 0xCB, 0xE8, 0x89, 0xE2,
-    0x1B, 0x60, 0x62, 0x1A, 0x60, 0xFD, 0x93, 0xB6, 0xB8, 0xEF, 0x74, 0xA6, 0x60, 0xA2, 0x71, 0x67,
-    0xD8, 0xBD, 0xA2, 0x2E, 0x80, 0x6B, 0x1E, 0xAA, 0x19, 0x13, 0x61, 0xEB, 0xC2, 0x49, 0x0C, 0x86,
-    0xF1, 0x36, 0x86, 0x68, 0x2E, 0x49, 0xE8, 0x4C, 0x32, 0xDC, 0xC9, 0x40, 0x35, 0x06, 0xE5, 0x66,
-    0x59, 0x55, 0xB1, 0xA7, 0xD3, 0x54, 0x22, 0x2D, 0x76, 0x14, 0x1F, 0x3B, 0x53, 0xEE, 0x33, 0x7A,
-    0x91, 0xEB, 0x5E, 0x1A, 0x2B, 0x38, 0xCB, 0xFD, 0xB4, 0x02, 0x4C, 0x08, 0xB1, 0x65, 0x12, 0xF4,
-    0x75, 0x3A, 0xE8, 0xA2, 0xD7, 0x8C, 0x3A, 0xC7, 0xB4, 0x87, 0x0B, 0x40, 0x26, 0x17, 0xF3, 0x7B,
-    0xB0, 0xFD, 0x7B, 0xE4, 0x46, 0x0E, 0x5B, 0x1F, 0x20, 0xE5, 0x63, 0xF1, 0xAF, 0xA2, 0x44, 0xD1,
-    0xAC, 0x92, 0x42, 0x66, 0xCE, 0xCF, 0xFB, 0xF9, 0x4D, 0x56, 0x1B, 0x26, 0x1F, 0x93, 0x53, 0xB3,
-    0x9D, 0x9C, 0x98, 0x46, 0xC7, 0x36, 0x69, 0x3A, 0x39, 0xB1, 0xE3, 0x0A, 0xC6, 0xE4, 0x88, 0xCF,
-    0xF1, 0x50, 0x28, 0x2D, 0x1F, 0xC5, 0x31, 0xC1, 0xF1, 0x32, 0x8E, 0x39, 0x1C, 0xB3, 0x38, 0x54,
-    0x1F, 0x4B, 0x4F, 0xEF, 0x4E, 0x82, 0xBB, 0xE7, 0x98, 0x9E, 0x67, 0xF7, 0x1C, 0xD3, 0x49, 0x98,
-    0x4E, 0x87, 0xAF, 0x63, 0x6D, 0xF6, 0x82, 0x69, 0x98, 0xE1, 0xDA, 0x0F, 0xC4, 0xBE, 0x93, 0x38,
-    0xB7, 0x33, 0xEF, 0x78, 0xAE, 0xA4, 0x9C, 0x93, 0xE5, 0x89, 0x4C, 0x56, 0x64, 0x7E, 0x51, 0xF6,
-    0xB2, 0xED, 0x7C, 0xF1, 0xEA, 0x55, 0xD3, 0xB6, 0xA9, 0x0C, 0xFD, 0xE9, 0x75, 0xD9, 0xB7, 0xBA,
-    0xC8, 0x66, 0xCF, 0xA9, 0x41, 0x2A, 0x85, 0x9F, 0x07, 0x99, 0xD9, 0xCE, 0x40, 0x74, 0x87, 0x19,
-    0x5A, 0xB0, 0x04, 0x6D, 0x19, 0x5A, 0x33, 0xFC, 0xC1, 0x75, 0xB4, 0x9B, 0xB2, 0xE5, 0xAF, 0x83,
-    0x2A, 0x2C, 0x7A, 0xF2, 0x88, 0x64, 0xAF, 0xDE, 0x0D, 0xDA, 0x41, 0xD4, 0xA5, 0xBA, 0x70, 0x1E,
-    0x5E, 0x2A, 0x9D, 0xCE, 0xAD, 0xDC, 0xC6, 0xA9, 0xBD, 0x0A, 0xA1, 0x53, 0xBA, 0x15, 0x1B, 0x21,
-    0xDF, 0xB4, 0x41, 0xAA, 0x9F, 0x87, 0x6D, 0xD4, 0x17, 0x8D, 0x9C, 0x1B, 0x59, 0x76, 0xE6, 0x8A,
-    0x29, 0xA6, 0x9C, 0x12, 0xFC, 0x92, 0xA3, 0xC5, 0xCD, 0x8E, 0xB1, 0x45, 0xD9, 0x5A, 0x97, 0xE9,
-    0x33, 0x4E, 0x5E, 0x95, 0xF0, 0x21, 0x62, 0x74, 0xAB, 0xD1, 0x0C, 0x59, 0x80, 0xEC, 0x84, 0xF1,
-    0xE0, 0x6F, 0x4D, 0x13, 0xFB, 0x9D, 0x6D, 0x6B, 0xB7, 0x6D, 0xDB, 0xA9, 0x0B, 0x5B, 0x3F, 0xD0,
-    0x7E, 0xD4, 0x4A, 0x0A, 0x7A, 0x66, 0x45, 0x40, 0xFF, 0x7C, 0xB2, 0x2E, 0xFD, 0x76, 0x1C, 0x8B,
-    0x0E, 0xFF, 0x33, 0xAC, 0x62, 0x78, 0x81, 0xCD, 0xFC, 0x89, 0xBE, 0x88, 0xC1, 0xA2, 0x9D, 0x24,
-    0xB1, 0x41, 0xD5, 0x19, 0xE6, 0x18, 0x2E, 0x7F, 0x9F, 0x72, 0xFA, 0x81, 0x91, 0xD8, 0x33, 0xE6,
-    0x76, 0x5E, 0x28, 0x86, 0xE6, 0xFE, 0x11, 0xC6, 0x34, 0xE5, 0xC6, 0xC8, 0x39, 0x2F, 0x55, 0x63,
-    0x30, 0x71, 0x16, 0xBC, 0xBF, 0xF5, 0x06, 0x48, 0x44, 0x6F, 0x82, 0x03, 0x2E, 0x54, 0x68, 0xC1,
-    0xD9, 0x08, 0xAF, 0x53, 0x7E, 0xCB, 0x8A, 0xE9, 0x23, 0xF6, 0xC4, 0xF1, 0x69, 0xB6, 0xA2, 0xF4,
-    0xA0, 0xB7, 0x21, 0x8A, 0xFB, 0x4E, 0x62, 0x77, 0x57, 0xA8, 0xA3, 0x36, 0xB9, 0xA7, 0x10, 0xEF,
-    0xF3, 0x6B, 0x48, 0x33, 0x6C, 0xA0, 0xCF, 0x89, 0x0B, 0x16, 0x65, 0x3E, 0x47, 0x34, 0x92, 0x9F,
-    0xEF, 0xF5, 0x2E, 0x30, 0xF3, 0xA8, 0x0B, 0x24, 0x4E, 0x93, 0x62, 0xF9, 0x1F, 0x54, 0x0E, 0xF2,
-    0x90, 0xDB, 0x80, 0xDD, 0x6A, 0xF4, 0xC0, 0xFD, 0x1F, 0x52, 0x0F, 0x96, 0xC2, 0x2C, 0x06, 0x5D,
-    0x80, 0x3B, 0x47, 0x81, 0x8E, 0x23, 0x55, 0x0F, 0xDD, 0x2B, 0x53, 0x51, 0x23, 0x00, 0xE6, 0xC0,
-    0x62, 0x5C, 0x4D, 0x3D, 0x61, 0xEE, 0x64, 0xF2, 0x0E, 0x9B, 0x60, 0xAB, 0xE9, 0x9E, 0x76, 0x8D,
-    0xFD, 0xFD, 0x4F, 0x7B, 0x89, 0x6E, 0xBB, 0x2B, 0x74, 0x77, 0x87, 0xEF, 0x18, 0x56, 0x8F, 0xA9,
-    0x6D, 0x75, 0x8F, 0xE6, 0xA1, 0xBA, 0xA7, 0x8F, 0xC7, 0x3B, 0xF9, 0xDE, 0x53, 0x4E, 0x13, 0x20,
-    0xB3, 0x7A, 0x28, 0xF5, 0xFD, 0xC8, 0xAD, 0x90, 0x31, 0xBE, 0x46, 0x72, 0x86, 0x13, 0x28, 0xB0,
-    0x95, 0xFF, 0x6D, 0x23, 0xC1, 0x2D, 0xF4, 0x44, 0x37, 0x99, 0xF2, 0xB9, 0x7B, 0x10, 0x17, 0x71,
-    0x74, 0xA8, 0x0C, 0xDA, 0x67, 0x68, 0x5D, 0x8D, 0xDE, 0x7E, 0xC4, 0x62, 0xDB, 0xAE, 0x28, 0x85,
-    0x35, 0x69, 0x43, 0xF7, 0xDB, 0x7B, 0x72, 0x26, 0x39, 0x98, 0xF8, 0x6D, 0x5C, 0x02, 0xC5, 0xF6,
-    0xC1, 0x26, 0x42, 0x49, 0xBB, 0x1D, 0x0A, 0xDD, 0xD6, 0x6D, 0x10, 0x48, 0xC0, 0xD3, 0x84, 0x53,
-    0xBF, 0xB3, 0x80, 0x42, 0x8F, 0x9F, 0x10, 0x54, 0x46, 0x5A, 0x2F, 0x71, 0x0B, 0xDB, 0x2C, 0xEC,
-    0x38, 0xAA, 0x6A, 0x04, 0x67, 0x66, 0x55, 0xFC, 0x06, 0x15, 0x3F, 0xE4, 0xA2, 0x0B, 0xD7, 0xDC,
-    0x42, 0x6C, 0x01, 0x91, 0xDB, 0xB0, 0x28, 0xA9, 0x10, 0x34, 0x5E, 0x5F, 0xD2, 0x98, 0x9D, 0x30,
-    0xB3, 0x17, 0x66, 0x76, 0xC3, 0x4C, 0x99, 0xE1, 0xD3, 0x1C, 0xAF, 0x1D, 0x1B, 0xFC, 0xCB, 0x00,
-    0xA5, 0xC3, 0x43, 0xE0, 0x92, 0x82, 0xD3, 0xF9, 0x28, 0x77, 0xFC, 0x3C, 0x8D, 0x82, 0x5C, 0xE3,
-    0x09, 0x63, 0x7A, 0x1F, 0x65, 0x92, 0x02, 0xB5, 0xF0, 0xAB, 0x6A, 0x2B, 0x42, 0xF6, 0x9E, 0x9A,
-    0x59, 0x55, 0x6D, 0x58, 0x5B, 0xED, 0x97, 0x8D, 0x74, 0xE7, 0x5B, 0xF0, 0x58, 0x87, 0xE4, 0x05,
-    0x40, 0x2D, 0x28, 0x63, 0x37, 0x28, 0x1B, 0x60, 0xA4, 0x03, 0x98, 0x8C, 0x81, 0x99, 0xDA, 0x48,
-    0x23, 0x5F, 0xD7, 0xDB, 0x34, 0x98, 0x0C, 0xEB, 0xF5, 0xD7, 0x7E, 0x27, 0x1A, 0x2C, 0xF6, 0x8B,
-    0xEF, 0x1E, 0xE9, 0xEB, 0x60, 0xB1, 0x4E, 0x82, 0x0A, 0x86, 0x70, 0xC7, 0xC3, 0x1E, 0xF6, 0x88,
-    0xE8, 0x28, 0x68, 0x55, 0xB9, 0xD7, 0xB4, 0xF7, 0xE4, 0xC1, 0xC8, 0x6F, 0x52, 0xF4, 0xB5, 0x77,
-    0x01, 0xBD, 0x53, 0x38, 0x9D, 0x93, 0xB8, 0xBB, 0x7B, 0x94, 0xC7, 0xF8, 0x90, 0x1C, 0xBC, 0x2C,
-    0xEC, 0xF1, 0xBD, 0x22, 0x36, 0x0C, 0xA6, 0x8A, 0xFD, 0xAC, 0xAA, 0x21, 0x32, 0x1F, 0x0A, 0xC8,
-    0x46, 0xBE, 0x87, 0xF9, 0xCE, 0xA0, 0x3C, 0x58, 0xC7, 0x19, 0x7F, 0x30, 0xB5, 0x55, 0xB6, 0xC7,
-    0xF0, 0xF7, 0x1A, 0x4A, 0xC3, 0x45, 0xF4, 0x2B, 0xFE, 0x37, 0x91, 0x59, 0x07, 0xA6, 0x99, 0xE9,
-    0xFD, 0x48, 0x53, 0x4C, 0x32, 0x75, 0xF9, 0x26, 0x60, 0x0E, 0x9C, 0xB4, 0x10, 0x26, 0x74, 0x86,
-    0x1D, 0x01, 0x36, 0x84, 0xD8, 0xE0, 0x02, 0x49, 0x9A, 0xA0, 0x3C, 0x4C, 0xE2, 0x3B, 0x0C, 0x1E,
-    0x84, 0x4F, 0xD9, 0x07, 0xD0, 0x81, 0x45, 0x1B, 0x8E, 0xC9, 0x8D, 0x29, 0xE2, 0x6C, 0x97, 0x6E,
-    0x69, 0xA1, 0x34, 0xB5, 0x51, 0x95, 0x3B, 0x19, 0x58, 0x1B, 0x3C, 0xAE, 0x00, 0xCE, 0x04, 0x20,
-    0xDD, 0x40, 0xB2, 0x2A, 0xCC, 0xBE, 0x62, 0x9F, 0xA2, 0xF9, 0x2C, 0x1C, 0x20, 0x0A, 0x81, 0xB8,
-    0xCA, 0xC8, 0xEF, 0x5E, 0x8E, 0xD5, 0xE2, 0x73, 0x95, 0x6A, 0x38, 0xCE, 0x37, 0x6E, 0xE2, 0x54,
-    0x3F, 0x6A, 0x3C, 0x71, 0xAA, 0x3F, 0x37, 0xB3, 0x18, 0x3F, 0x69, 0x5E, 0x16, 0xE7, 0xBF, 0x37,
-    0x9B, 0x65, 0x71, 0x1E, 0x1E, 0x6F, 0x0A, 0xF8, 0x9E, 0xC5, 0x7D, 0x4A, 0x16, 0xA5, 0x80, 0xDE,
-    0x6A, 0xB6, 0x0A, 0xED, 0x53, 0x72, 0x80, 0x05, 0x0D, 0xF7, 0xC4, 0xCF, 0x93, 0x3C, 0x6F, 0xB3,
-    0xB1, 0xBB, 0x2B, 0xA6, 0x3F, 0x19, 0xCA, 0x63, 0xAE, 0x03, 0xD3, 0xB9, 0xC8, 0x31, 0x72, 0xD7,
-    0x0D, 0x96, 0xAB, 0x70, 0x3C, 0xF1, 0x13, 0x24, 0x61, 0x24, 0x95, 0xCA, 0x28, 0x78, 0x19, 0x1F,
-    0xE8, 0xDA, 0x70, 0x28, 0x32, 0x81, 0xD9, 0x3E, 0xFF, 0x90, 0x01, 0x5C, 0x32, 0x92, 0x69, 0x8F,
-    0xCD, 0xAA, 0x96, 0xFB, 0x9A, 0xF1, 0x1B, 0x64, 0xD3, 0xDF, 0x8D, 0x95, 0x90, 0x29, 0x1E, 0x4C,
-    0x0D, 0xC5, 0x7F, 0x39, 0xA0, 0x4C, 0x13, 0x2E, 0x4C, 0xBF, 0x8D, 0xF8, 0x62, 0x9A, 0x0C, 0x77,
-    0x59, 0xA7, 0x4E, 0x45, 0x1E, 0x88, 0x52, 0x5D, 0xD4, 0xC9, 0x2C, 0xB2, 0xF9, 0xB3, 0xA4, 0x1B,
-    0xBA, 0x06, 0x5D, 0x82, 0x65, 0x52, 0x47, 0x06, 0xB2, 0xB1, 0x8E, 0x2E, 0x62, 0x42, 0x49, 0x0A,
-    0xDA, 0xD4, 0x6C, 0xB3, 0x69, 0xB8, 0xBB, 0x11, 0x6D, 0xB7, 0xB8, 0x8F, 0xD2, 0x10, 0x51, 0xE1,
-    0x2A, 0xD1, 0x14, 0x8A, 0xB5, 0x77, 0x15, 0x24, 0xA3, 0x27, 0xF2, 0xE4, 0x67, 0x5B, 0xF7, 0xBB,
-    0x56, 0xE5, 0x93, 0x8E, 0x3E, 0x47, 0xE2, 0xED, 0x99, 0xFF, 0x27, 0xAD, 0xEC, 0x01, 0xA6, 0x34,
-    0x9E, 0xC6, 0x98, 0x27, 0xF7, 0xFE, 0x0C, 0x89, 0xE1, 0x9F, 0x20, 0xE8, 0xC1, 0xF6, 0x04, 0xC5,
-    0xEC, 0xB9, 0xFA, 0xF0, 0x8D, 0xF0, 0x6C, 0xE9, 0xD5, 0x8B, 0xB2, 0xF8, 0x3F, 0xBD, 0x59, 0x3D,
-    0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xB3, 0x2B, 0x72, 0x03, 0xAD, 0xC3, 0x51, 0x21, 0x22, 0x01, 0x68,
-    0x73, 0x52, 0xB8, 0x10, 0x6C, 0x91, 0xEB, 0x42, 0x05, 0x03, 0x1C, 0xB9, 0x6B, 0xB3, 0x50, 0xE1,
-    0xC2, 0x57, 0x90, 0x71, 0x19, 0xB7, 0x76, 0x43, 0x17, 0x2C, 0x54, 0x48, 0xDA, 0xB5, 0x0D, 0x44,
-    0x45, 0x80, 0x84, 0x01, 0xA2, 0x32, 0x88, 0x0B, 0x15, 0x8E, 0x03, 0x84, 0x4C, 0xC0, 0x82, 0x85,
-    0xC4, 0x1D, 0x59, 0x80, 0x55, 0x18, 0x88, 0xD7, 0x4E, 0x90, 0x74, 0xC9, 0x06, 0xF9, 0x31, 0x12,
-    0x21, 0xF1, 0x04, 0x59, 0xC7, 0x4B, 0x7A, 0x6F, 0x27, 0xDF, 0x9B, 0xDB, 0x3B, 0x52, 0x82, 0x0C,
-    0x24, 0x20, 0x73, 0xC7, 0x9B, 0xE1, 0xDD, 0xCE, 0xEE, 0xFB, 0x9B, 0xF7, 0xF3, 0xBD, 0x39, 0xBA,
-    0x40, 0x16, 0x7F, 0x2D, 0x9D, 0x27, 0xA2, 0x57, 0xC8, 0x90, 0xF1, 0x4A, 0xBF, 0xF4, 0x8B, 0xB0,
-    0x90, 0x5A, 0xE9, 0x48, 0xC7, 0x3A, 0xD5, 0xEB, 0x09, 0xD1, 0xEB, 0x58, 0xDE, 0x21, 0x0A, 0x5B,
-    0xA2, 0xDC, 0x6A, 0xEF, 0xE0, 0xF7, 0x45, 0xF8, 0xCF, 0x0F, 0xB5, 0xFC, 0xF8, 0x7D, 0x8A, 0xEE,
-    0x65, 0x14, 0xDF, 0x4B, 0x28, 0xBE, 0x41, 0x94, 0x7E, 0x17, 0xE3, 0xFB, 0x44, 0xF1, 0x2F, 0x05,
-    0x45, 0x7F, 0x9F, 0xA7, 0xD0, 0x36, 0x24, 0xF2, 0x82, 0x68, 0x89, 0x86, 0x83, 0x5F, 0x22, 0x2F,
-    0x29, 0xFC, 0xA4, 0xA1, 0x28, 0x6B, 0x29, 0xA6, 0x3B, 0x94, 0xD2, 0x2D, 0x0C, 0x1A, 0x8E, 0x04,
-    0xCF, 0xD8, 0x64, 0x2A, 0xBD, 0x09, 0x22, 0x49, 0x37, 0x70, 0xFD, 0x2A, 0x1E, 0xFB, 0x33, 0x51,
-    0x60, 0x0F, 0x76, 0x23, 0x6B, 0xCD, 0x37, 0xA7, 0x6D, 0xD6, 0x51, 0x7B, 0x7D, 0xED, 0xF5, 0xD4,
-    0x9A, 0xE8, 0x72, 0xD1, 0x13, 0xE5, 0x12, 0x19, 0xBC, 0x7B, 0x54, 0x2E, 0x06, 0x05, 0x2E, 0xFE,
-    0xFC, 0x9D, 0x4D, 0xDC, 0x10, 0x59, 0xD5, 0xA8, 0x83, 0xB0, 0x0A, 0x2A, 0x5F, 0xFB, 0x55, 0x98,
-    0xF8, 0xB5, 0x24, 0xAF, 0xB9, 0x48, 0xA2, 0xC1, 0x6A, 0x63, 0x88, 0x5A, 0x4D, 0xCF, 0xD8, 0xBF,
-    0x52, 0x6C, 0xA1, 0x9B, 0x25, 0x7A, 0xCD, 0xBE, 0x03, 0x15, 0x1B, 0xDC, 0x43, 0xE4, 0x63, 0xCC,
-    0x0D, 0x12, 0xB2, 0x56, 0x93, 0x19, 0xBF, 0x1C, 0xDF, 0x63, 0x5F, 0x03, 0x3C, 0x18, 0x6F, 0x68,
-    0x6A, 0x82, 0x92, 0x2A, 0xBF, 0xA0, 0xCA, 0x4B, 0x08, 0x0F, 0x92, 0x4D, 0xC8, 0xB3, 0x15, 0x05,
-    0x2F, 0xB5, 0x24, 0x85, 0x4D, 0x64, 0xA6, 0x32, 0x59, 0xCA, 0x2C, 0x68, 0x65, 0x22, 0xEC, 0x3F,
-    0x20, 0x59, 0x0D, 0x0E, 0x18, 0xB8, 0xB9, 0x47, 0xB7, 0xA1, 0xE3, 0x1E, 0x5D, 0xC7, 0x0E, 0x44,
-    0x0F, 0x0A, 0x9A, 0x6E, 0x1D, 0x93, 0x5E, 0xA8, 0xF7, 0xA5, 0xBE, 0x23, 0xF5, 0x79, 0xD1, 0xA9,
-    0x3B, 0x67, 0xB7, 0x20, 0xF1, 0xB7, 0x1A, 0x02, 0x1F, 0x95, 0x48, 0xF1, 0xEE, 0xAA, 0x5E, 0x08,
-    0x1F, 0x14, 0x65, 0x6F, 0x51, 0x94, 0x3B, 0x9B, 0x3D, 0x4A, 0x36, 0x77, 0x60, 0xAB, 0xA5, 0x9D,
-    0xBD, 0xF1, 0xC4, 0x5F, 0xB1, 0x40, 0x97, 0x96, 0x56, 0xE8, 0x95, 0x9D, 0x8B, 0xF2, 0x37, 0x85,
-    0x91, 0x5E, 0xBB, 0xAA, 0x83, 0x82, 0x64, 0x42, 0x83, 0xF5, 0x3B, 0x44, 0xCA, 0x16, 0x1D, 0xF9,
-    0x7C, 0x27, 0xF8, 0xD8, 0xC8, 0xB7, 0x4C, 0xE4, 0x97, 0x71, 0x50, 0xC4, 0x52, 0xC7, 0xCF, 0xEA,
-    0xE8, 0xB7, 0xF5, 0x94, 0xE8, 0xD3, 0x85, 0xB3, 0x44, 0xD5, 0x32, 0xF9, 0x65, 0x4D, 0xEA, 0x9E,
-    0xA1, 0x58, 0x16, 0x94, 0x2A, 0x8D, 0xFF, 0x9A, 0xD4, 0xE5, 0x82, 0xC2, 0x37, 0x4B, 0xF2, 0x35,
-    0x6C, 0x93, 0x9C, 0xA3, 0xD4, 0x0E, 0xF0, 0x26, 0x7A, 0xEA, 0xD8, 0xFB, 0x0C, 0x36, 0xB7, 0xC9,
-    0x9B, 0xD7, 0x6E, 0x3D, 0x56, 0x8F, 0xF5, 0x35, 0x5F, 0x2F, 0x44, 0x9F, 0xEA, 0xB2, 0x17, 0xBE,
-    0x00, 0x3D, 0xC2, 0xE7, 0xCD, 0xE6, 0x4E, 0xF8, 0x7C, 0xB9, 0xB4, 0x13, 0x5E, 0xD6, 0x98, 0x5A,
-    0xE8, 0x11, 0xBE, 0x04, 0x3D, 0xC2, 0x17, 0xB3, 0x4B, 0x4B, 0xE1, 0x6A, 0xB1, 0x73, 0x51, 0xFD,
-    0xA0, 0x32, 0x72, 0xB6, 0xFF, 0xF2, 0x63, 0xF5, 0x98, 0x5D, 0x5F, 0x87, 0x10, 0xB0, 0x3F, 0xA9,
-    0xEA, 0xFA, 0x9D, 0x6A, 0xDE, 0x48, 0x23, 0xAF, 0x5D, 0x8B, 0x6A, 0x91, 0xB0, 0x9F, 0xF7, 0x8E,
-    0xDE, 0x9D, 0xA4, 0xC7, 0xAE, 0xB8, 0x40, 0x18, 0x5D, 0x7F, 0x95, 0xFC, 0x2F, 0x8A, 0xE0, 0x9E,
-    0xF1, 0xDF, 0x2A, 0x29, 0xD0, 0xCC, 0xA7, 0x47, 0x02, 0xDE, 0x9B, 0xE8, 0x95, 0x9F, 0xEA, 0xD4,
-    0x66, 0xB3, 0xEB, 0xF0, 0x97, 0xC4, 0xFF, 0xA2, 0x0C, 0xDE, 0x33, 0xDE, 0x2A, 0x3C, 0xA1, 0x40,
-    0x24, 0xD1, 0x46, 0x86, 0x0F, 0x17, 0x82, 0xE2, 0x6A, 0xA8, 0x63, 0x4B, 0x53, 0x7D, 0xD0, 0xF3,
-    0x06, 0x81, 0x91, 0xD9, 0x32, 0x24, 0x4B, 0x66, 0x13, 0x78, 0x39, 0xFC, 0x3C, 0x4F, 0x72, 0x4C,
-    0xEC, 0x71, 0x1C, 0x80, 0x78, 0xAE, 0x25, 0x31, 0x10, 0x03, 0xF8, 0x1D, 0x3C, 0xCF, 0x6F, 0xFC,
-    0x6E, 0x0A, 0xEA, 0xB0, 0xA6, 0xB0, 0x51, 0x35, 0x49, 0xFB, 0x2F, 0x5B, 0xCC, 0xA4, 0x77, 0x6D,
-    0x32, 0xCF, 0x22, 0x2E, 0xF2, 0xB4, 0xC2, 0x13, 0x07, 0x09, 0xC5, 0xAC, 0x7A, 0xC4, 0x9F, 0x10,
-    0x40, 0x55, 0x64, 0xB7, 0xB7, 0x62, 0x2B, 0xA1, 0xC7, 0xD1, 0x88, 0xBB, 0x21, 0x31, 0xE8, 0xDB,
-    0x18, 0xF2, 0xBF, 0x1C, 0xB9, 0x2C, 0xC9, 0x86, 0x66, 0x05, 0x22, 0xDB, 0xE4, 0xBA, 0x33, 0xB0,
-    0x87, 0x50, 0x82, 0xDB, 0xDE, 0x7E, 0xB6, 0x8A, 0xB7, 0xE8, 0xBC, 0x68, 0x54, 0xF3, 0x95, 0x9A,
-    0x2A, 0x61, 0x84, 0xF1, 0x0C, 0xA7, 0x8F, 0xBC, 0x59, 0x5F, 0xA3, 0x3C, 0x0B, 0x3E, 0x31, 0xEA,
-    0x4D, 0x13, 0x7B, 0x66, 0xC5, 0xC7, 0xBB, 0x8C, 0x43, 0xAD, 0xA0, 0x65, 0x9F, 0xFC, 0x84, 0x9D,
-    0xA5, 0x22, 0xCF, 0xDC, 0x26, 0x51, 0x83, 0x64, 0x13, 0xBB, 0xE1, 0xD5, 0xFB, 0x14, 0x7C, 0x54,
-    0x91, 0x5C, 0x2D, 0xA8, 0x07, 0xCE, 0xE7, 0xE0, 0x35, 0x34, 0xE5, 0x38, 0x22, 0x3B, 0xC0, 0xBE,
-    0xFB, 0xE4, 0x21, 0x38, 0x96, 0x29, 0xC8, 0x38, 0x27, 0xE0, 0x0E, 0xC4, 0x0D, 0xAC, 0x8A, 0xC8,
-    0x81, 0xAF, 0x53, 0x4D, 0x1C, 0x9B, 0x88, 0xF3, 0x59, 0x12, 0x26, 0x4C, 0xEE, 0x40, 0x5D, 0x05,
-    0x63, 0xCE, 0xAE, 0xF7, 0x82, 0xDB, 0x58, 0xD8, 0x7D, 0x12, 0x37, 0x89, 0x72, 0x93, 0xC3, 0xEE,
-    0x6E, 0x51, 0x41, 0x39, 0xDF, 0xC2, 0xF2, 0x8B, 0xE2, 0xE5, 0xCF, 0x98, 0x9A, 0x5F, 0x32, 0x8B,
-    0xA8, 0x71, 0x0E, 0xB4, 0x76, 0xC4, 0x17, 0x1B, 0x0E, 0xBE, 0xBE, 0x66, 0xBE, 0xF0, 0x00, 0xDC,
-    0xB9, 0xE8, 0xF8, 0x5E, 0x75, 0x7C, 0x99, 0x63, 0xED, 0xB1, 0xF1, 0xAB, 0xE0, 0x3B, 0xB7, 0xC0,
-    0x57, 0x46, 0xFB, 0xE0, 0xBB, 0xDC, 0x8B, 0xC0, 0x77, 0x6F, 0x29, 0x02, 0x47, 0xC3, 0x22, 0xE2,
-    0x79, 0x70, 0x44, 0xFA, 0xC1, 0xAD, 0xF3, 0xC4, 0x3B, 0xD8, 0xA3, 0xDD, 0x27, 0x58, 0xDA, 0xC3,
-    0xDB, 0x84, 0x9C, 0x6B, 0x99, 0xAF, 0x58, 0x87, 0xB3, 0xBC, 0xCA, 0x6C, 0x83, 0x07, 0x9A, 0x76,
-    0x29, 0x7C, 0xAB, 0x04, 0x77, 0x6F, 0xB5, 0xC4, 0xD3, 0x14, 0x6A, 0x70, 0x87, 0x83, 0x80, 0xBB,
-    0xD8, 0x48, 0x98, 0xBB, 0xE4, 0x78, 0x7B, 0x2E, 0x7C, 0xAF, 0x98, 0xA5, 0x3D, 0x79, 0x23, 0x43,
-    0x2A, 0x6D, 0x25, 0xF4, 0x9D, 0xEA, 0x2F, 0x3B, 0x7D, 0xF7, 0x58, 0x5F, 0x32, 0x47, 0xFA, 0x86,
-    0xAB, 0xAC, 0xAF, 0x72, 0xFA, 0xF6, 0x9C, 0xBE, 0xD5, 0x31, 0x7D, 0xC5, 0x16, 0x05, 0x15, 0xC1,
-    0xDB, 0x30, 0x8B, 0xC4, 0xED, 0x72, 0xE6, 0xBC, 0x5E, 0x63, 0x27, 0x71, 0x39, 0x2A, 0x38, 0x3D,
-    0x5B, 0xEA, 0x5B, 0x6A, 0xAC, 0x68, 0xF2, 0xD5, 0x26, 0xB2, 0x66, 0xFA, 0xDD, 0xA4, 0x4B, 0x1D,
-    0x21, 0x5B, 0x02, 0x5E, 0xE1, 0x6C, 0x43, 0x2E, 0xE6, 0xBB, 0x17, 0xE7, 0x32, 0xCF, 0xF2, 0x2A,
-    0x4F, 0x61, 0x8E, 0x69, 0x1E, 0x94, 0xA8, 0xC7, 0xD3, 0x66, 0x8C, 0xAD, 0x34, 0x98, 0xBC, 0x22,
-    0xD6, 0xB0, 0x12, 0xA6, 0xF0, 0x66, 0x8A, 0x9C, 0x62, 0x11, 0xCC, 0xCB, 0xCC, 0xF4, 0x0A, 0xA9,
-    0x12, 0x66, 0x96, 0xA5, 0x57, 0x92, 0x34, 0x73, 0x15, 0x6D, 0x1C, 0xC4, 0x03, 0xCF, 0xB6, 0x23,
-    0xF2, 0x9C, 0xA4, 0x29, 0x2C, 0x47, 0xEE, 0x7F, 0x65, 0x52, 0x7C, 0x71, 0x33, 0x09, 0xCE, 0x38,
-    0x48, 0x99, 0xBC, 0xA7, 0xBB, 0x93, 0xE1, 0xEB, 0xD5, 0x4F, 0x70, 0x8C, 0xC3, 0xC6, 0x33, 0x29,
-    0xAC, 0xFD, 0xF5, 0xA0, 0x98, 0x0C, 0xDF, 0x50, 0x73, 0xC4, 0xDC, 0xAD, 0xBB, 0x49, 0x50, 0x7F,
-    0x32, 0x7C, 0x85, 0xA3, 0x7C, 0x1F, 0x54, 0xFC, 0x17, 0x74, 0xF7, 0xC9, 0x5D, 0xFB, 0xFF, 0xB0,
-    0x44, 0xD9, 0x40, 0xE5, 0xA2, 0x0D, 0xFB, 0x2E, 0xBB, 0xD5, 0x72, 0xEB, 0xC2, 0xFC, 0x17, 0xAE,
-    0x44, 0x88, 0x3F, 0x36, 0x74, 0x09, 0x2C, 0xEF, 0xB9, 0x90, 0x91, 0xCE, 0xEF, 0x68, 0x21, 0xE0,
-    0x0A, 0x4E, 0x57, 0x42, 0x0E, 0x2D, 0x32, 0xF2, 0x33, 0x94, 0x04, 0xBF, 0x90, 0x66, 0x98, 0x88,
-    0xD9, 0x2B, 0xE7, 0xD7, 0x37, 0x4A, 0x17, 0xEE, 0x60, 0xBC, 0x85, 0x88, 0x8B, 0xB5, 0x57, 0x78,
-    0x28, 0xA0, 0x3A, 0xD0, 0x73, 0x95, 0xB0, 0x7F, 0xDB, 0xD6, 0xF1, 0x40, 0x5A, 0x3B, 0x42, 0x34,
-    0x82, 0xF9, 0xAB, 0xBF, 0x58, 0x06, 0x43, 0x69, 0x26, 0x1A, 0xA4, 0x77, 0x80, 0x04, 0xA4, 0x1E,
-    0x26, 0xA9, 0x9C, 0x9B, 0xF3, 0x8E, 0x43, 0xA9, 0x6E, 0x4A, 0xDD, 0x94, 0x8D, 0x3E, 0x0D, 0x17,
-    0x0A, 0x7A, 0x8E, 0x54, 0x8D, 0xD4, 0x13, 0x30, 0x76, 0xA1, 0x9C, 0x55, 0x9B, 0x61, 0xF2, 0x8A,
-    0x97, 0x03, 0x26, 0xC3, 0xF1, 0x2F, 0xB6, 0xF1, 0xD5, 0x1B, 0xBB, 0xF4, 0x70, 0x2F, 0x1D, 0x12,
-    0x23, 0x99, 0xB9, 0x3C, 0xDF, 0x5D, 0xB7, 0xAC, 0xCB, 0xC6, 0xE1, 0x36, 0x8A, 0xAD, 0x41, 0x0A,
-    0x93, 0x9C, 0x91, 0x54, 0x89, 0xE5, 0x47, 0x85, 0x01, 0xE0, 0xA1, 0xF4, 0x26, 0x7C, 0x23, 0x77,
-    0x8F, 0x8D, 0x26, 0xD1, 0xD2, 0x59, 0x54, 0x41, 0x84, 0x09, 0xCC, 0xB6, 0x4C, 0x73, 0x2D, 0xCC,
-    0x0B, 0x53, 0x37, 0x63, 0xC6, 0x4E, 0x01, 0xB6, 0xBC, 0xEF, 0x4C, 0x97, 0x4C, 0x88, 0x6F, 0xC0,
-    0x9F, 0x24, 0x6B, 0xBD, 0xA2, 0x5C, 0x0E, 0x4F, 0x26, 0xC3, 0xB7, 0x06, 0x37, 0xD1, 0x70, 0xC2,
-    0xAA, 0x79, 0xEA, 0x4F, 0x4D, 0x44, 0x5F, 0x0E, 0x0C, 0xA9, 0x87, 0x5B, 0xCF, 0x70, 0x7E, 0xC8,
-    0x31, 0xA3, 0x8D, 0x36, 0x71, 0xFE, 0x85, 0x42, 0xEF, 0x5C, 0x8C, 0x99, 0x31, 0x1B, 0x37, 0x32,
-    0x07, 0xCB, 0x51, 0xFC, 0x87, 0x1C, 0xAC, 0x63, 0xC2, 0x3C, 0x86, 0xF0, 0x18, 0x8F, 0xA6, 0x76,
-    0xE4, 0x26, 0xAA, 0x18, 0xC2, 0x11, 0x2C, 0x78, 0xC5, 0xE9, 0xD3, 0x67, 0x4F, 0x0D, 0x71, 0x43,
-    0x04, 0xE7, 0xBC, 0xD2, 0xF9, 0xE6, 0x69, 0xD2, 0x5F, 0x46, 0xB9, 0x4B, 0x01, 0x6C, 0xAF, 0xC3,
-    0x48, 0x23, 0xC8, 0x7D, 0x5A, 0xF4, 0xAD, 0x3D, 0x40, 0x5A, 0x39, 0xB4, 0xBC, 0xB3, 0xAA, 0xE2,
-    0x9D, 0x6D, 0x40, 0xCB, 0x1F, 0x80, 0x18, 0xD4, 0x8A, 0xB5, 0x18, 0x4E, 0x88, 0x57, 0xAF, 0x15,
-    0xF9, 0x4D, 0x5C, 0xCB, 0x13, 0xAC, 0x5A, 0xA6, 0x62, 0x29, 0xAC, 0xB0, 0xAE, 0x0C, 0xA8, 0xC6,
-    0xDA, 0x6F, 0xD0, 0x4D, 0xCC, 0xB5, 0xDB, 0x35, 0xEF, 0x6C, 0x36, 0x8E, 0x20, 0xBF, 0x7A, 0x92,
-    0x7D, 0xD9, 0x72, 0xD1, 0x5F, 0x48, 0x39, 0x8A, 0xCE, 0x87, 0xE3, 0x55, 0x6B, 0x28, 0xAF, 0x69,
-    0x03, 0x99, 0x0E, 0x19, 0xAF, 0x61, 0xE4, 0x24, 0x07, 0x9C, 0x10, 0xE6, 0x2D, 0x63, 0x91, 0x8B,
-    0x79, 0xB2, 0x80, 0x0C, 0x15, 0x67, 0x0C, 0x81, 0x23, 0x8D, 0xF9, 0x8A, 0x44, 0x37, 0x45, 0x9B,
-    0xA1, 0x41, 0x93, 0xB4, 0xE3, 0xD7, 0xF0, 0x15, 0xE3, 0x73, 0xB3, 0x64, 0x44, 0x6B, 0x18, 0x11,
-    0xC1, 0x4B, 0xB1, 0xC1, 0x69, 0xC1, 0xB8, 0x06, 0x56, 0x98, 0xFB, 0x13, 0x27, 0x96, 0xB4, 0x71,
-    0xDE, 0x35, 0xDC, 0x2A, 0xE7, 0x72, 0x1C, 0xD0, 0x14, 0xD1, 0xF1, 0x88, 0x16, 0xEC, 0xB9, 0xEA,
-    0x6F, 0x96, 0x3D, 0x17, 0x0A, 0xC3, 0x08, 0x05, 0xF2, 0x1B, 0x00, 0xBA, 0x61, 0xC3, 0x70, 0x3E,
-    0x8E, 0xD8, 0x44, 0x20, 0x2A, 0x0D, 0x27, 0x6D, 0x9E, 0xA2, 0x02, 0xE9, 0x01, 0xAD, 0x28, 0xA6,
-    0x0C, 0x0B, 0xEE, 0xC1, 0x01, 0xAC, 0x07, 0xA4, 0x12, 0x0C, 0x36, 0xB0, 0x19, 0x39, 0x33, 0x12,
-    0x47, 0x69, 0xCC, 0x45, 0x85, 0x13, 0xC1, 0xA5, 0xBA, 0x19, 0x9A, 0x24, 0x73, 0x97, 0xA9, 0x63,
-    0x2E, 0x0B, 0x75, 0x8F, 0xE3, 0x60, 0x66, 0x92, 0xCC, 0xF7, 0x03, 0xAE, 0x8C, 0x9F, 0x42, 0xF1,
-    0x1F, 0x63, 0x65, 0x5A, 0x54, 0x13, 0x64, 0x2E, 0x0C, 0xB0, 0xA9, 0x57, 0xC5, 0xDD, 0x44, 0xFD,
-    0x33, 0x13, 0x61, 0xFE, 0x0D, 0xCA, 0xF6, 0xBC, 0x72, 0x25, 0xCC, 0xE4, 0xCF, 0xB8, 0x9F, 0xF6,
-    0xD0, 0x2F, 0xED, 0xD3, 0xA2, 0xCC, 0xF6, 0xFC, 0x12, 0x4B, 0x7C, 0x53, 0x01, 0x09, 0x3E, 0xCF,
-    0x1E, 0x92, 0x20, 0x65, 0x09, 0x2C, 0x24, 0xF0, 0x3F, 0x84, 0x04, 0x21, 0x4B, 0xF0, 0x14, 0x4B,
-    0xB0, 0xC4, 0x12, 0x18, 0x48, 0xF0, 0x9E, 0x86, 0x04, 0x37, 0x12, 0x48, 0xF0, 0x3D, 0x96, 0xA0,
-    0xE1, 0x07, 0x0D, 0x4B, 0x60, 0x46, 0x12, 0x48, 0x96, 0xE0, 0xE2, 0x91, 0xFA, 0x01, 0xDB, 0x5A,
-    0x38, 0xBF, 0xBF, 0xC6, 0xD3, 0x7C, 0x77, 0x3D, 0xB6, 0x85, 0xAD, 0xA3, 0x36, 0xD9, 0x28, 0x81,
-    0x15, 0x24, 0xDF, 0x36, 0xC3, 0x68, 0xF9, 0x29, 0x76, 0x94, 0x05, 0x9E, 0x7A, 0x9C, 0x54, 0x1C,
-    0x3E, 0x58, 0xE2, 0x60, 0xDA, 0xE4, 0x69, 0x87, 0x13, 0x8B, 0xE1, 0xB2, 0x88, 0xC8, 0x4D, 0x10,
-    0x71, 0x69, 0xE2, 0x42, 0x0D, 0x21, 0x1D, 0x1D, 0xEE, 0xF3, 0x51, 0x48, 0x45, 0x0F, 0xBD, 0x38,
-    0xE9, 0x0C, 0xF1, 0xB7, 0x8B, 0xC1, 0x85, 0x89, 0x32, 0x8F, 0x38, 0xCA, 0x38, 0xE7, 0x88, 0x0A,
-    0xC0, 0x34, 0xC8, 0x2E, 0x4E, 0x90, 0xB9, 0x5F, 0x5C, 0x65, 0xFC, 0x0F, 0xBB, 0x07, 0x05, 0x26,
-    0x91, 0x9C, 0x9B, 0xA4, 0xE6, 0x0E, 0xFE, 0x49, 0x57, 0x9C, 0xF9, 0xEB, 0xA8, 0x09, 0xC8, 0xED,
-    0x0B, 0xB6, 0x4C, 0x0F, 0x44, 0xBE, 0x25, 0xB9, 0xFD, 0x93, 0x15, 0x30, 0x67, 0xC0, 0xFD, 0x29,
-    0x9A, 0x7A, 0x60, 0xD2, 0x06, 0xE9, 0xD0, 0x1B, 0x70, 0x62, 0x68, 0x7B, 0x9C, 0x9D, 0xF9, 0xB1,
-    0xBC, 0x7C, 0x08, 0xCC, 0x71, 0x3D, 0x39, 0xAA, 0xEB, 0x5F, 0xB3, 0x7D, 0xD6, 0xC8, 0x74, 0x05,
-    0xC9, 0x55, 0xA4, 0x61, 0xA2, 0x91, 0x87, 0x7C, 0xCC, 0xC1, 0x15, 0x3E, 0xFA, 0xC8, 0x52, 0x17,
-    0x31, 0x8C, 0x79, 0x53, 0x0E, 0x9B, 0x34, 0x71, 0xB1, 0x83, 0x6B, 0xEE, 0x94, 0xC1, 0x06, 0x03,
-    0x84, 0x02, 0x27, 0xEF, 0x76, 0xAD, 0xEB, 0x9C, 0xB8, 0x40, 0x8D, 0x2B, 0xA0, 0x83, 0x21, 0x9E,
-    0x65, 0x9D, 0xD4, 0x1F, 0xAC, 0x43, 0x0C, 0x5C, 0xCE, 0x73, 0x57, 0xD4, 0x2D, 0xCF, 0x53, 0x28,
-    0x4E, 0x09, 0xA9, 0x41, 0x74, 0xC8, 0xE0, 0x89, 0x0B, 0x9F, 0xDF, 0x70, 0xB2, 0xF5, 0xEB, 0xDC,
-    0x59, 0x83, 0x15, 0x08, 0xAA, 0x98, 0xBB, 0x4D, 0x83, 0x12, 0x03, 0x19, 0x19, 0xAC, 0xCB, 0x32,
-    0xC1, 0xB2, 0xFA, 0x95, 0x06, 0xB4, 0x8C, 0xEE, 0x17, 0x98, 0xE3, 0xFB, 0x9F, 0x61, 0x35, 0xBE,
-    0xCB, 0x10, 0x39, 0x76, 0x65, 0x2A, 0x4D, 0xC6, 0x48, 0x66, 0x18, 0x44, 0x73, 0xD5, 0x18, 0x18,
-    0xD2, 0xE8, 0x0C, 0x80, 0xA2, 0x8C, 0x5B, 0x11, 0xEE, 0xE3, 0x87, 0xD7, 0xCE, 0x6E, 0xF5, 0x61,
-    0x6C, 0xE3, 0xD7, 0xAA, 0x94, 0xA5, 0x2A, 0x22, 0x3E, 0xB3, 0x84, 0xE2, 0xAC, 0x37, 0xAB, 0x6D,
-    0xF9, 0xD0, 0x82, 0x75, 0x47, 0xB7, 0x60, 0x83, 0x9C, 0xCF, 0xA0, 0xEA, 0xA8, 0x8A, 0xCB, 0x63,
-    0xAE, 0x5B, 0x38, 0xC2, 0x82, 0xBB, 0xE4, 0xEC, 0x74, 0x68, 0x32, 0xA8, 0x54, 0x83, 0x21, 0xA4,
-    0x1C, 0x21, 0xCA, 0x93, 0xD2, 0x54, 0xFA, 0x6D, 0x8A, 0x0F, 0x0B, 0xFA, 0x37, 0x76, 0x6A, 0x6B,
-    0xF1, 0x74, 0xE4, 0xDC, 0x93, 0x09, 0x35, 0x30, 0x68, 0xA3, 0x12, 0x3A, 0x37, 0x75, 0x7A, 0xBA,
-    0x4B, 0x64, 0xBE, 0xAF, 0x02, 0x62, 0xCC, 0xCC, 0x77, 0x00, 0xFB, 0x84, 0x74, 0xCF, 0x6E, 0x4D,
-    0xBF, 0xC3, 0x3D, 0x4C, 0x6A, 0xD1, 0x0A, 0xA9, 0x3A, 0xD6, 0xB2, 0x0C, 0x0D, 0x53, 0x50, 0x05,
-    0x68, 0x64, 0x11, 0x53, 0x48, 0xE2, 0xF7, 0x39, 0x45, 0xA7, 0xF0, 0x27, 0xD0, 0xFA, 0xA1, 0x3B,
-    0x55, 0x63, 0x9F, 0xF5, 0x6C, 0x76, 0x06, 0x14, 0x63, 0xFD, 0x24, 0xA5, 0x03, 0x75, 0x58, 0x53,
-    0x54, 0x05, 0x76, 0x2C, 0xEE, 0xF4, 0x2D, 0xD7, 0x1B, 0xF9, 0x26, 0x47, 0x0C, 0xC7, 0x14, 0xE9,
-    0x65, 0x1A, 0xFA, 0xFB, 0x18, 0xCB, 0x8D, 0x47, 0x9A, 0x5D, 0xA2, 0xF8, 0x0B, 0x03, 0xFC, 0x09,
-    0x2F, 0x29, 0xB9, 0x0F, 0xEF, 0xF2, 0xFC, 0x32, 0xD1, 0x33, 0x4D, 0x97, 0x02, 0xBF, 0xCC, 0x4B,
-    0x1F, 0xE2, 0x93, 0x12, 0x4B, 0x1C, 0x27, 0x03, 0xCA, 0xC3, 0xDA, 0x85, 0x33, 0x07, 0xF7, 0x63,
-    0xF9, 0x8C, 0x5F, 0x8C, 0x34, 0xF3, 0x87, 0xBD, 0xF4, 0xA4, 0x34, 0x47, 0x5E, 0x7A, 0x2D, 0x82,
-    0x98, 0xE1, 0xE9, 0xD0, 0xAC, 0x14, 0x44, 0x8C, 0x13, 0x8C, 0xA3, 0xEA, 0x7F, 0x22, 0x9A, 0x71,
-    0xA6, 0xF8, 0x84, 0x17, 0xF8, 0x73, 0xB6, 0x9F, 0x56, 0x8C, 0x18, 0xE0, 0x3D, 0xCE, 0x7F, 0x90,
-    0xE3, 0xB2, 0x14, 0x7F, 0x71, 0x13, 0x75, 0x29, 0x19, 0xD9, 0x3C, 0xE6, 0x93, 0xF7, 0x61, 0xE7,
-    0x31, 0xDB, 0xA7, 0xB4, 0x22, 0x87, 0x30, 0x18, 0xB7, 0x63, 0x11, 0xCD, 0x49, 0xE4, 0xD0, 0x2A,
-    0xF2, 0x4D, 0xEA, 0xDE, 0xA8, 0xEA, 0xD1, 0x38, 0x9F, 0x03, 0x69, 0xDB, 0x4C, 0xDE, 0xD0, 0xCB,
-    0x82, 0x9F, 0x9F, 0x5A, 0x63, 0xE3, 0xB8, 0x53, 0x58, 0x06, 0x15, 0x81, 0x3B, 0x16, 0x0B, 0x8F,
-    0x53, 0x03, 0x6C, 0x01, 0x2E, 0x1F, 0x74, 0x4F, 0x5F, 0x95, 0xD9, 0x40, 0xE9, 0x46, 0x66, 0xC3,
-    0x40, 0xFA, 0x9F, 0xB9, 0xD3, 0x9E, 0x87, 0x46, 0x61, 0x9B, 0xF8, 0x00, 0x8E, 0x57, 0x68, 0xF7,
-    0xFA, 0xF0, 0x68, 0x37, 0xDA, 0xCE, 0x3C, 0xF4, 0xF0, 0x8C, 0x4D, 0xE0, 0xF2, 0x70, 0x78, 0x55,
-    0xE4, 0x20, 0x66, 0x41, 0x0D, 0x09, 0x99, 0x07, 0x07, 0x0F, 0xFE, 0xD0, 0x1A, 0x3C, 0xA8, 0x1E,
-    0x71, 0x9B, 0xC0, 0x5C, 0xE0, 0xF6, 0x16, 0xE5, 0x65, 0x39, 0x47, 0xB1, 0x78, 0x7A, 0xD4, 0x10,
-    0x4C, 0xAD, 0x4D, 0x6F, 0x91, 0x6A, 0x20, 0xA2, 0x3F, 0xF8, 0xB4, 0x86, 0xE2, 0xAC, 0xE5, 0x80,
-    0xF5, 0x6C, 0x18, 0xDD, 0x54, 0x21, 0xEB, 0xEA, 0xA4, 0x77, 0xF2, 0xB3, 0x06, 0x85, 0x53, 0x80,
-    0x6D, 0xAC, 0x15, 0x33, 0x1E, 0x6B, 0xFE, 0xA5, 0x3E, 0xFF, 0x36, 0x6C, 0xDA, 0x72, 0x31, 0xC8,
-    0x64, 0xC9, 0xFB, 0xA5, 0x80, 0xE8, 0x20, 0x7C, 0x12, 0x1D, 0x13, 0x3E, 0x1D, 0x0A, 0x2F, 0x1E,
-    0x27, 0x3C, 0x77, 0x5A, 0x8F, 0x34, 0x93, 0x27, 0xA5, 0xC9, 0x15, 0x8F, 0xBB, 0xFD, 0x15, 0x64,
-    0xA7, 0xDD, 0x2E, 0x90, 0x4E, 0x4A, 0xF3, 0x71, 0x99, 0xF9, 0xA4, 0x34, 0xAF, 0x62, 0xA3, 0x06,
-    0xC0, 0x71, 0xB7, 0x31, 0xCE, 0x89, 0x53, 0xA1, 0xD9, 0x73, 0xD9, 0xEA, 0xC2, 0x68, 0xC3, 0xBA,
-    0x9F, 0x68, 0xDC, 0xEB, 0x82, 0x5B, 0xBA, 0xD6, 0x7D, 0x7B, 0x9A, 0xC4, 0x4F, 0x0C, 0xB0, 0x06,
-    0xE0, 0x36, 0x9A, 0xD4, 0x5A, 0xC1, 0x05, 0xE2, 0x4A, 0x95, 0x9F, 0x57, 0xD1, 0xC7, 0x1F, 0x54,
-    0xF1, 0x07, 0x2F, 0x9A, 0xF8, 0x77, 0xB8, 0xD2, 0xA8, 0x32, 0xE6, 0x1C, 0x5C, 0xA4, 0x89, 0x3C,
-    0x04, 0x2A, 0xB6, 0x0C, 0xA5, 0x88, 0xCE, 0x8D, 0x13, 0x56, 0x32, 0x3C, 0x6B, 0x72, 0xC7, 0x93,
-    0xC3, 0x9F, 0xCC, 0x66, 0xD7, 0x04, 0x62, 0x38, 0x40, 0x14, 0xB3, 0x6F, 0x8D, 0x63, 0x99, 0xA3,
-    0x79, 0x18, 0xCF, 0x2E, 0xA6, 0xF3, 0x2C, 0x7D, 0xC3, 0x66, 0xE9, 0x7D, 0x8E, 0x6C, 0xC4, 0xB6,
-    0x39, 0x16, 0x22, 0x0E, 0xF0, 0x30, 0x58, 0xB8, 0x33, 0xF6, 0xB2, 0x13, 0xD3, 0xE4, 0x23, 0x85,
-    0x80, 0x4F, 0xC5, 0x5F, 0xD4, 0xA3, 0x23, 0x85, 0x13, 0xD3, 0x54, 0x3E, 0xA2, 0xE4, 0x32, 0x6C,
-    0x88, 0xFF, 0x67, 0x86, 0x47, 0xE9, 0x27, 0xD7, 0xBD, 0x3B, 0xFC, 0x73, 0x3F, 0xF6, 0x70, 0x4D,
-    0x1D, 0x85, 0x04, 0xA7, 0x1A, 0x38, 0x60, 0xE5, 0x92, 0x94, 0xFB, 0xE9, 0x88, 0xDC, 0x8F, 0x97,
-    0x7B, 0xFC, 0x5B, 0x01, 0xFF, 0xBC, 0xC9, 0xC5, 0xCA, 0xB2, 0x66, 0x39, 0x3B, 0x7C, 0xFA, 0x12,
-    0x13, 0xF9, 0xD1, 0xA8, 0x43, 0x8D, 0xCC, 0x08, 0xBE, 0xBA, 0xF3, 0xBE, 0xC5, 0xD1, 0xF1, 0x7D,
-    0x80, 0xEB, 0xCF, 0xE4, 0x59, 0x77, 0x97, 0x67, 0xD1, 0x41, 0xA5, 0x8F, 0x1E, 0x78, 0x20, 0x85,
-    0x58, 0x2C, 0xB7, 0x9F, 0x34, 0x64, 0xDF, 0x18, 0x00, 0xE6, 0xB5, 0xDE, 0x80, 0x5A, 0xBF, 0x11,
-    0x48, 0x24, 0x5E, 0x13, 0xD4, 0x40, 0xB9, 0x95, 0x5F, 0x85, 0x4E, 0x63, 0xA5, 0xE5, 0x41, 0x9E,
-    0x28, 0x20, 0xCB, 0xE8, 0x18, 0x19, 0x47, 0xEA, 0xD7, 0xC4, 0x47, 0x13, 0xA3, 0x17, 0x1F, 0xC1,
-    0xB8, 0x33, 0x18, 0x77, 0x08, 0x33, 0x3E, 0x85, 0x99, 0x84, 0x96, 0xFF, 0x01, 0xC5, 0x5A, 0x3D,
-    0x8C, 0xDC, 0xC6, 0x15, 0x1E, 0x92, 0xBE, 0x63, 0x22, 0xC2, 0xA2, 0x0B, 0x0B, 0x8E, 0x75, 0xB0,
-    0xE8, 0x22, 0x08, 0x82, 0x58, 0x12, 0x5D, 0x38, 0x80, 0x82, 0xDC, 0x89, 0xB4, 0x8B, 0xB8, 0xD4,
-    0x16, 0x77, 0x48, 0x91, 0x42, 0xAE, 0x53, 0xF8, 0x52, 0x1C, 0x82, 0x4B, 0x70, 0x12, 0x29, 0xA8,
-    0x70, 0x91, 0x22, 0xD7, 0x08, 0x29, 0x82, 0x20, 0x2A, 0x5C, 0x24, 0x72, 0x21, 0x05, 0x70, 0x00,
-    0x05, 0x90, 0x45, 0xCA, 0x2A, 0x5C, 0xB8, 0xA1, 0x1C, 0x04, 0x2E, 0x52, 0x98, 0x46, 0x64, 0x17,
-    0x32, 0x10, 0xD3, 0x01, 0x9D, 0xAC, 0x4E, 0x24, 0x27, 0xDF, 0xF7, 0x48, 0xEE, 0x8F, 0xA4, 0x83,
-    0x25, 0xDF, 0xDE, 0x7A, 0x7F, 0xE6, 0x6E, 0x77, 0xC9, 0x99, 0xF7, 0xDE, 0xBC, 0xF9, 0xDE, 0xF7,
-    0xDE, 0x8C, 0x52, 0xF2, 0xB0, 0x75, 0xC1, 0x26, 0x57, 0xDD, 0xA3, 0xC1, 0xDB, 0xD4, 0x68, 0x2C,
-    0x36, 0x4E, 0x82, 0xE6, 0x48, 0x14, 0x2A, 0xB5, 0xCC, 0x66, 0x23, 0x88, 0x95, 0x2A, 0xD0, 0x98,
-    0x59, 0x90, 0x2A, 0x2B, 0x45, 0xE3, 0x5C, 0x88, 0x52, 0xE5, 0x69, 0x9D, 0xA9, 0x15, 0xE5, 0x67,
-    0x6A, 0x53, 0x79, 0xB9, 0x2A, 0x94, 0x9B, 0x9B, 0xB9, 0x72, 0x8B, 0xA5, 0x52, 0xAD, 0xDF, 0x0D,
-    0x6A, 0x53, 0x37, 0xD2, 0x77, 0xA0, 0xDB, 0x37, 0x1F, 0x07, 0xB6, 0x07, 0x2A, 0xD1, 0x85, 0x35,
-    0xF4, 0x72, 0x37, 0xF7, 0x32, 0x3F, 0xF5, 0xD3, 0x20, 0x0E, 0xD2, 0x28, 0x0C, 0xD2, 0x44, 0x45,
-    0xB1, 0x56, 0x49, 0xA8, 0x15, 0x9E, 0x90, 0x45, 0xDB, 0xF8, 0xA6, 0x4A, 0x86, 0x7E, 0x19, 0x8C,
-    0xC4, 0xA4, 0xE4, 0xE1, 0x06, 0xA4, 0xFC, 0xB4, 0xA0, 0xBC, 0x29, 0x3E, 0x9F, 0x55, 0xF3, 0xD0,
-    0xE1, 0x84, 0x15, 0xAB, 0x93, 0xEB, 0x4A, 0x79, 0x35, 0x24, 0xC8, 0x67, 0xA1, 0xCB, 0xFE, 0x49,
-    0xBB, 0x84, 0x0E, 0xD4, 0x35, 0x8E, 0x51, 0xE2, 0x6D, 0x0C, 0xF9, 0x1F, 0x6E, 0x53, 0x0A, 0x1D,
-    0x7C, 0x6D, 0x99, 0x8F, 0xA1, 0x27, 0xD8, 0xDC, 0xCA, 0xBB, 0xB7, 0xC6, 0x20, 0xC9, 0xC8, 0xF4,
-    0x14, 0xB7, 0xD5, 0x88, 0x43, 0xDA, 0x71, 0xF7, 0xB5, 0xA1, 0x61, 0x2E, 0xEF, 0x53, 0x28, 0x18,
-    0x85, 0x51, 0x6C, 0x54, 0x2A, 0x08, 0xAD, 0x21, 0xE4, 0x77, 0xD1, 0x13, 0xE5, 0x57, 0xD4, 0x04,
-    0x77, 0xA7, 0x7D, 0x13, 0x49, 0x13, 0xF7, 0xFF, 0xB5, 0x3F, 0x64, 0xEA, 0x45, 0xE5, 0x0D, 0x31,
-    0xBA, 0xAD, 0x39, 0xE3, 0x49, 0xA3, 0x26, 0x1F, 0x1E, 0x7A, 0x08, 0x20, 0x4C, 0x85, 0xC1, 0xB3,
-    0xF6, 0xAB, 0xC5, 0x37, 0xE5, 0x2A, 0xAB, 0x48, 0x94, 0x9B, 0x05, 0xCA, 0x4F, 0x57, 0xE4, 0x0A,
-    0x8A, 0xAB, 0xEF, 0x7B, 0x47, 0xF1, 0x4B, 0x2A, 0xB8, 0x57, 0x28, 0x47, 0xC7, 0x93, 0x9D, 0x8A,
-    0x80, 0x01, 0x2D, 0x37, 0xDC, 0x62, 0xBF, 0x47, 0xE6, 0xA7, 0x90, 0x05, 0x45, 0x5C, 0x7C, 0x73,
-    0xD2, 0x55, 0xEA, 0x6D, 0x2B, 0x9E, 0x91, 0x42, 0x4E, 0xD1, 0x6B, 0xE5, 0x52, 0x4A, 0x43, 0xCD,
-    0x51, 0x21, 0x98, 0xD1, 0x86, 0x52, 0x16, 0x5D, 0x23, 0x9C, 0xD5, 0x0C, 0x95, 0x2E, 0xAE, 0x3F,
-    0x73, 0x86, 0xA3, 0x97, 0xBD, 0xA8, 0x73, 0x52, 0x68, 0xD3, 0x49, 0xD5, 0xC9, 0x00, 0xBD, 0x55,
-    0x9D, 0x49, 0x67, 0xA2, 0x10, 0x7B, 0x95, 0x6E, 0xA5, 0xDF, 0x76, 0xC2, 0x64, 0xE5, 0xEA, 0xBB,
-    0x4A, 0xAD, 0xEF, 0x60, 0x01, 0xBB, 0x85, 0x57, 0x62, 0xFA, 0xE0, 0x20, 0x5E, 0x6E, 0xD5, 0xD0,
-    0xC3, 0x6C, 0x20, 0xAE, 0xD1, 0x35, 0x51, 0x8C, 0x8F, 0x51, 0x88, 0x26, 0x09, 0xF1, 0xAB, 0xA6,
-    0x23, 0x69, 0xE5, 0x94, 0xF8, 0xC9, 0x2B, 0xCC, 0x1A, 0x17, 0x59, 0x95, 0xA1, 0xC3, 0xA5, 0xE6,
-    0xF2, 0x50, 0x45, 0x5A, 0xC6, 0x0E, 0x2A, 0x0E, 0xB7, 0x54, 0x9D, 0x94, 0x59, 0xBA, 0xCA, 0x95,
-    0x5B, 0xD2, 0x42, 0x0E, 0x2D, 0x7A, 0xF8, 0xF7, 0x85, 0x8C, 0xCE, 0x45, 0x3F, 0xA4, 0xE1, 0x88,
-    0x17, 0xB0, 0x1E, 0x10, 0x83, 0xEB, 0x9D, 0x76, 0x22, 0x6A, 0x50, 0x47, 0x5A, 0x8F, 0xC8, 0xC1,
-    0x56, 0xB4, 0x14, 0x5C, 0x23, 0x7E, 0xE0, 0x9A, 0x3A, 0xC1, 0xFC, 0x4F, 0x61, 0xF8, 0x23, 0x6A,
-    0x04, 0xD3, 0x9B, 0x8D, 0x91, 0x5C, 0x78, 0x1C, 0x8D, 0x5C, 0x0E, 0xBC, 0xA8, 0x7B, 0x7C, 0x25,
-    0x5A, 0xAA, 0xB7, 0x9A, 0xED, 0x76, 0x55, 0x39, 0xF7, 0xD0, 0x24, 0x7A, 0xA8, 0xCC, 0x0A, 0x1A,
-    0xDA, 0xA5, 0x43, 0xF8, 0xC4, 0x04, 0x7A, 0x19, 0xD6, 0x84, 0x9F, 0x42, 0xC7, 0x20, 0x85, 0x73,
-    0x04, 0x44, 0x5B, 0xC0, 0x21, 0x9A, 0x1B, 0x9F, 0x13, 0x72, 0xFD, 0x46, 0x39, 0xB5, 0x3B, 0x9C,
-    0x42, 0x1D, 0xF1, 0x88, 0xA4, 0x1E, 0x69, 0x84, 0x48, 0xBA, 0xBE, 0x73, 0x99, 0x1A, 0x59, 0x19,
-    0x35, 0xC2, 0x7D, 0xB9, 0x99, 0x3E, 0xE0, 0x6B, 0x1A, 0x96, 0x8D, 0x2E, 0x0C, 0x3A, 0xE8, 0xD4,
-    0x7D, 0x03, 0x8D, 0x0E, 0x28, 0x68, 0x74, 0x84, 0x72, 0xAE, 0xA8, 0xA5, 0xE6, 0x52, 0x45, 0x8D,
-    0x2A, 0xF5, 0x40, 0xFC, 0x9C, 0xF2, 0xB3, 0x08, 0x52, 0x27, 0xF0, 0xB3, 0x5A, 0x25, 0xCE, 0x50,
-    0xD1, 0x02, 0x7A, 0xF0, 0x95, 0x7E, 0x56, 0x00, 0x57, 0xD4, 0xDF, 0xCE, 0xF4, 0xF8, 0xE6, 0x6C,
-    0xCF, 0x45, 0x87, 0x0D, 0x3B, 0x94, 0xF8, 0xE9, 0x73, 0x1E, 0xF2, 0x59, 0xE9, 0x22, 0x58, 0xE6,
-    0x09, 0xAA, 0x65, 0x93, 0xA8, 0xB6, 0xBF, 0xBA, 0xD8, 0x18, 0xD0, 0x2D, 0xDB, 0x25, 0x6A, 0x84,
-    0x7B, 0xD7, 0x65, 0x1F, 0xA5, 0x95, 0x48, 0x7C, 0x9C, 0x17, 0x6E, 0xB1, 0x79, 0x87, 0x4D, 0xD4,
-    0x23, 0xE1, 0xD7, 0x95, 0xF9, 0x6C, 0xCB, 0x2C, 0x4C, 0x22, 0x83, 0xD0, 0x30, 0x7C, 0x97, 0x84,
-    0x63, 0xFF, 0xC2, 0xBF, 0x5B, 0x63, 0x60, 0xCE, 0xE6, 0x32, 0x27, 0x5B, 0x36, 0x3A, 0xF2, 0x31,
-    0x2F, 0xD5, 0x18, 0x3A, 0x67, 0xE0, 0x5F, 0xA5, 0xA0, 0x24, 0x9A, 0x6A, 0x85, 0x34, 0xE0, 0xE0,
-    0xE4, 0xF2, 0x77, 0x76, 0x92, 0x0C, 0x37, 0xFA, 0x85, 0x51, 0x53, 0x9B, 0xA1, 0x72, 0xE3, 0x71,
-    0x90, 0x09, 0xB2, 0x71, 0x7C, 0x39, 0x70, 0xE9, 0x62, 0x14, 0x7B, 0xBA, 0x40, 0x38, 0xD2, 0x84,
-    0x69, 0x22, 0x97, 0x59, 0x09, 0x7C, 0xC1, 0x79, 0xD1, 0xD8, 0xCD, 0xFA, 0x90, 0xC8, 0xB4, 0x3D,
-    0x05, 0x31, 0xD2, 0x85, 0xC0, 0x6F, 0x41, 0x67, 0x0B, 0x4F, 0x48, 0x78, 0x83, 0x7C, 0x3F, 0x3F,
-    0x95, 0x23, 0x2E, 0xED, 0xE4, 0xCA, 0x3B, 0x5F, 0x86, 0x2A, 0x30, 0x71, 0xEF, 0x75, 0x06, 0xD9,
-    0x9A, 0x11, 0xF6, 0x1D, 0x7A, 0x67, 0x74, 0x1A, 0x23, 0xFB, 0x84, 0xA8, 0x5F, 0x85, 0x2D, 0x6F,
-    0x53, 0x66, 0xF3, 0x26, 0x83, 0x23, 0xA3, 0x19, 0x27, 0xC2, 0xF9, 0xE4, 0x72, 0xA1, 0x02, 0xBA,
-    0xF2, 0x59, 0xF2, 0xD9, 0x48, 0xB9, 0x80, 0xBB, 0x3B, 0x09, 0xC1, 0xF3, 0xF6, 0x48, 0x82, 0x2B,
-    0x0E, 0x9A, 0x33, 0xAF, 0xF7, 0x36, 0x70, 0xF2, 0x39, 0xAA, 0x6F, 0xA5, 0xCB, 0x10, 0xFA, 0x4B,
-    0x4E, 0x80, 0x64, 0x29, 0xC7, 0xC3, 0xB9, 0xAB, 0xBF, 0x1B, 0x67, 0x9A, 0xCB, 0xEC, 0x7B, 0x69,
-    0xDF, 0x0F, 0xE3, 0xAD, 0x5A, 0x50, 0x73, 0x57, 0x7F, 0x7F, 0xB5, 0x5C, 0xE0, 0x7C, 0x7A, 0xC2,
-    0x42, 0xF8, 0x71, 0x99, 0xCD, 0x6B, 0x93, 0x61, 0x8A, 0x3E, 0xC0, 0x01, 0x5C, 0x0E, 0xE0, 0xCD,
-    0x7F, 0xF6, 0x21, 0x6C, 0xAC, 0xFA, 0x24, 0xD3, 0xB9, 0x49, 0x85, 0x8F, 0xA8, 0x2B, 0xE3, 0x08,
-    0xF3, 0x06, 0xA0, 0x67, 0xBD, 0xF9, 0x09, 0xEE, 0x80, 0x45, 0x00, 0x7F, 0xF0, 0x91, 0x44, 0x0C,
-    0xA3, 0x85, 0x62, 0x32, 0x66, 0x93, 0xC9, 0xD0, 0x0E, 0xB5, 0xEA, 0x90, 0x2A, 0xBA, 0xF0, 0x53,
-    0x52, 0x10, 0x32, 0x52, 0x5C, 0x60, 0x4B, 0x0B, 0x2A, 0x82, 0xCB, 0xD0, 0x07, 0x2E, 0x43, 0x2B,
-    0x5C, 0x08, 0xE8, 0xF6, 0x72, 0x54, 0xE2, 0xA6, 0x9B, 0xBA, 0x67, 0x9E, 0x20, 0xA7, 0x06, 0xD8,
-    0x8C, 0x7D, 0x0B, 0xA4, 0x45, 0x6D, 0x88, 0x7B, 0x22, 0x05, 0x5B, 0xEC, 0x01, 0x0C, 0x97, 0x61,
-    0x8A, 0xC0, 0x6C, 0x0E, 0xC7, 0x56, 0x95, 0x14, 0x56, 0xF3, 0x79, 0x69, 0x69, 0xA7, 0xB4, 0xC1,
-    0x74, 0x9C, 0xA1, 0x53, 0xB8, 0xED, 0x33, 0xF7, 0x98, 0xF3, 0x49, 0xD6, 0x87, 0xBC, 0x8F, 0xCF,
-    0xD8, 0xD7, 0x51, 0xD8, 0x71, 0x9B, 0x5D, 0x74, 0xB2, 0x80, 0xDC, 0xBA, 0x34, 0x93, 0x3B, 0x97,
-    0xF4, 0xC5, 0x59, 0xE9, 0x34, 0x29, 0xBB, 0x07, 0xC6, 0xBE, 0xD4, 0xFC, 0x09, 0xB2, 0x93, 0xA6,
-    0x45, 0x99, 0x55, 0xEB, 0xC2, 0xD6, 0xA7, 0x4A, 0xBB, 0x76, 0x0A, 0x67, 0xE8, 0x3E, 0x9A, 0xEC,
-    0x82, 0xD6, 0xD9, 0x15, 0x15, 0xC0, 0x33, 0xFE, 0x8A, 0x29, 0xDB, 0x3E, 0xDE, 0xCF, 0x53, 0x0C,
-    0x8D, 0x42, 0x59, 0xC6, 0x5C, 0xC5, 0x74, 0x5C, 0x06, 0x1C, 0xBA, 0xAD, 0xBC, 0x63, 0xD2, 0x58,
-    0xD5, 0x91, 0x57, 0x79, 0x53, 0x41, 0xAA, 0x47, 0xCA, 0xB8, 0x84, 0x5B, 0x23, 0xF1, 0x00, 0xA0,
-    0xDF, 0x4B, 0x5E, 0x53, 0xAC, 0x24, 0xF9, 0xF3, 0x4B, 0xF4, 0x8B, 0x85, 0x55, 0xD6, 0x02, 0x70,
-    0x0D, 0x5F, 0x43, 0xEA, 0x6D, 0x97, 0x44, 0x0C, 0x97, 0xA4, 0x92, 0xC3, 0xE0, 0x05, 0x36, 0xEA,
-    0xD4, 0x63, 0x3C, 0x87, 0xCE, 0x3D, 0x8D, 0x9B, 0x9D, 0x58, 0xE8, 0xB1, 0xED, 0xF4, 0xD0, 0x40,
-    0xC1, 0xBC, 0xEE, 0xA4, 0x04, 0x19, 0xB1, 0x83, 0x64, 0x36, 0x26, 0x45, 0xC7, 0x0B, 0x30, 0xEE,
-    0x97, 0x23, 0x81, 0x8E, 0x22, 0xF8, 0x7A, 0xA7, 0x43, 0xC9, 0x36, 0xCD, 0x72, 0xD6, 0x82, 0x2D,
-    0x5B, 0xA9, 0x7F, 0x3A, 0x44, 0xDF, 0xE6, 0xED, 0xC7, 0x17, 0x6F, 0x46, 0x62, 0x18, 0x4C, 0x5B,
-    0x70, 0xA9, 0x47, 0x18, 0xED, 0x32, 0x2B, 0xBB, 0x73, 0x98, 0x44, 0xEE, 0xC2, 0xEB, 0x69, 0xF5,
-    0x58, 0xD3, 0x69, 0x67, 0xEC, 0x0A, 0x74, 0x00, 0x14, 0x27, 0x28, 0x46, 0x89, 0x67, 0xEB, 0xBD,
-    0x6D, 0xB6, 0xDB, 0x67, 0xB9, 0x33, 0xD2, 0xE2, 0xD0, 0x20, 0x2A, 0x27, 0x96, 0x80, 0xB8, 0x7E,
-    0x84, 0x67, 0x50, 0x89, 0xB5, 0xB4, 0xFE, 0x0D, 0x72, 0x9A, 0xD1, 0xB2, 0xD5, 0x32, 0x16, 0xD7,
-    0x55, 0xCE, 0xCE, 0x90, 0x53, 0xD5, 0xAA, 0xC5, 0xE1, 0xBE, 0x8D, 0x29, 0x63, 0x14, 0x42, 0x41,
-    0x8C, 0xCC, 0x5C, 0x4F, 0x8B, 0x84, 0xD2, 0x32, 0xB7, 0xCA, 0x29, 0x01, 0xE4, 0xC4, 0xC5, 0x98,
-    0x20, 0x48, 0x01, 0x59, 0x21, 0x87, 0x20, 0x7D, 0x9B, 0x29, 0x77, 0x95, 0x9F, 0xA6, 0x57, 0x5C,
-    0x19, 0xA7, 0x5B, 0x98, 0xED, 0x59, 0xA0, 0x59, 0xF5, 0xE9, 0x1A, 0x1A, 0x5C, 0x36, 0x50, 0x4F,
-    0xB5, 0x3F, 0x1C, 0x1A, 0xC0, 0xD2, 0x51, 0x89, 0x34, 0xC0, 0x65, 0x54, 0x68, 0x1B, 0x06, 0x16,
-    0x2F, 0x87, 0x3C, 0x5E, 0x06, 0x93, 0xFB, 0x29, 0xE4, 0x08, 0x52, 0x28, 0x11, 0xC4, 0x90, 0x05,
-    0x61, 0x45, 0x42, 0x50, 0xCA, 0x74, 0x35, 0x65, 0x26, 0x29, 0xB9, 0x7A, 0xA8, 0x26, 0x08, 0x22,
-    0xA1, 0x4F, 0x2D, 0xD1, 0xF2, 0xD1, 0xF6, 0x34, 0x79, 0x63, 0xBE, 0xA1, 0xAE, 0x91, 0xBC, 0xE5,
-    0x6E, 0xCF, 0x2C, 0x88, 0xA9, 0x46, 0x72, 0x77, 0xC4, 0x3A, 0xE3, 0x5E, 0x2D, 0x21, 0xB1, 0x93,
-    0x84, 0xB3, 0xEB, 0x99, 0x16, 0x94, 0x19, 0x69, 0x1B, 0xF1, 0x20, 0xC9, 0x91, 0xDD, 0x62, 0xAA,
-    0x69, 0xCB, 0x0B, 0xA3, 0x3E, 0x29, 0x1E, 0xB1, 0x51, 0x25, 0xDB, 0xE3, 0x72, 0x0B, 0xAB, 0xAE,
-    0xA1, 0xF2, 0x5E, 0x4D, 0xD5, 0xB2, 0xD1, 0x52, 0x63, 0x18, 0x44, 0xCA, 0x8A, 0xD6, 0x84, 0x07,
-    0x71, 0x08, 0xBB, 0x4B, 0x31, 0x46, 0xDE, 0x93, 0x3D, 0xDC, 0x7B, 0x28, 0x6B, 0xDD, 0xAA, 0x1F,
-    0x65, 0x9D, 0x3F, 0xA4, 0xF0, 0x87, 0x57, 0xE1, 0x7D, 0xB0, 0x6F, 0xC9, 0xBB, 0xC1, 0x8E, 0x21,
-    0x9D, 0x2C, 0x83, 0x8C, 0x79, 0x7E, 0xF0, 0xAE, 0x04, 0xF0, 0xF7, 0x5B, 0xC2, 0x2D, 0xB5, 0x41,
-    0x32, 0x4D, 0x95, 0xFC, 0x56, 0x3C, 0xCA, 0x19, 0x4A, 0xFE, 0x5E, 0xD1, 0x08, 0x96, 0x78, 0x24,
-    0x33, 0x7A, 0xCE, 0x67, 0x4C, 0x7F, 0x48, 0x72, 0xFA, 0x83, 0x57, 0x8C, 0xB4, 0x1A, 0x88, 0x5D,
-    0xE5, 0xB3, 0x2D, 0x5E, 0xD2, 0xDA, 0xFA, 0xDB, 0x7D, 0x98, 0x5A, 0x78, 0x20, 0x4C, 0x2D, 0xAC,
-    0x59, 0x95, 0xDF, 0x58, 0x95, 0x83, 0xB9, 0xF7, 0xE0, 0x8A, 0x5B, 0xCA, 0xF9, 0x02, 0x4B, 0x0D,
-    0x14, 0xDC, 0x05, 0xFF, 0xF7, 0xFE, 0x07, 0xD7, 0x7B, 0x17, 0x4E, 0x78, 0x03, 0xE8, 0x96, 0xEA,
-    0x10, 0xFE, 0x9E, 0x47, 0xE1, 0x52, 0x3B, 0xE0, 0x9A, 0x92, 0x62, 0x9F, 0xA4, 0x20, 0x90, 0xDC,
-    0x84, 0x09, 0x0E, 0xAD, 0x2E, 0xAC, 0x61, 0x35, 0x34, 0x08, 0x77, 0xB9, 0xFD, 0xB8, 0xFD, 0x75,
-    0x73, 0x29, 0x89, 0x0A, 0x2B, 0x21, 0xEA, 0xED, 0x71, 0x90, 0x87, 0x89, 0xB9, 0x80, 0x27, 0x58,
-    0xE0, 0x43, 0x4B, 0x48, 0x63, 0x8F, 0x9C, 0xF0, 0x20, 0x93, 0x1E, 0xE4, 0x48, 0x08, 0xA4, 0xE9,
-    0x8E, 0x33, 0x65, 0xA9, 0xC7, 0x29, 0x8B, 0x38, 0xBE, 0xF2, 0x43, 0xB5, 0xC9, 0x4F, 0x7E, 0xAD,
-    0x9E, 0x19, 0x81, 0xCF, 0x08, 0x79, 0x5A, 0xF0, 0xB9, 0x0F, 0x27, 0x43, 0x3A, 0x16, 0x5F, 0xA0,
-    0x57, 0xF9, 0xFE, 0xCB, 0xD9, 0x51, 0x35, 0xA1, 0x61, 0xFE, 0x88, 0xAA, 0x3D, 0x2F, 0xD4, 0x28,
-    0x33, 0xA2, 0x91, 0x64, 0xE1, 0x18, 0x51, 0x1B, 0x4E, 0xB2, 0xF9, 0x00, 0x96, 0xF2, 0xA5, 0x53,
-    0x4B, 0x50, 0x63, 0x61, 0xC0, 0x1E, 0x41, 0xEB, 0x8E, 0x29, 0xF5, 0xDD, 0x96, 0x7B, 0x20, 0x3B,
-    0x6C, 0x4E, 0xA5, 0xAC, 0x09, 0x51, 0x85, 0xA3, 0x33, 0x52, 0xC1, 0xAF, 0xFD, 0xF0, 0x99, 0xEA,
-    0x24, 0xBE, 0xDE, 0x82, 0x30, 0xC5, 0xF4, 0xAA, 0x9A, 0x5C, 0x59, 0x93, 0xAB, 0xAA, 0xC7, 0xE5,
-    0x6E, 0x11, 0x27, 0x44, 0xCD, 0xFC, 0x71, 0x9C, 0x42, 0xA6, 0x0A, 0xB6, 0x89, 0xE0, 0x6A, 0x90,
-    0xF4, 0x89, 0x47, 0x93, 0x74, 0x77, 0x17, 0xF8, 0xA0, 0xF2, 0x6F, 0x56, 0x01, 0x5E, 0xF1, 0xE0,
-    0x71, 0x5D, 0xE0, 0x16, 0x95, 0xFA, 0x08, 0xBF, 0x06, 0x44, 0x31, 0x41, 0x08, 0x9A, 0x8E, 0xCB,
-    0x52, 0x3D, 0xF9, 0xD5, 0x52, 0xED, 0x32, 0xC9, 0x4F, 0x21, 0x2B, 0x33, 0x74, 0x4C, 0x66, 0x57,
-    0xA9, 0x1F, 0xEF, 0x32, 0xC9, 0xE3, 0x3D, 0x9B, 0x52, 0x8D, 0x4A, 0x01, 0x42, 0xF7, 0xC7, 0x6B,
-    0x8C, 0x19, 0x6E, 0x82, 0xF0, 0x55, 0xAA, 0xF5, 0x9C, 0xD9, 0x3B, 0x90, 0xC3, 0xAD, 0x15, 0x12,
-    0xED, 0x23, 0x1A, 0x7C, 0x5B, 0x1D, 0x4D, 0x42, 0x78, 0xC8, 0x72, 0x10, 0xC3, 0xEB, 0x96, 0x7D,
-    0xE6, 0x84, 0x9B, 0x6E, 0x8E, 0x4C, 0x78, 0xC3, 0x29, 0x40, 0x82, 0xAF, 0x58, 0x43, 0x30, 0x72,
-    0xC4, 0x10, 0xE8, 0x5C, 0x18, 0x4D, 0xC1, 0x80, 0x0F, 0x7E, 0x0F, 0x58, 0x80, 0x9E, 0x96, 0x48,
-    0xBD, 0x74, 0x9B, 0xA9, 0x54, 0x54, 0xB5, 0x0E, 0x3C, 0x2A, 0x48, 0xB7, 0x16, 0xF2, 0xE9, 0x43,
-    0x9B, 0xBD, 0x9B, 0xAF, 0x2E, 0x6E, 0x43, 0x1B, 0xB0, 0x14, 0xAB, 0xFE, 0x7C, 0x88, 0x30, 0xC1,
-    0xA9, 0xA8, 0x39, 0x19, 0x95, 0x2D, 0xE5, 0x42, 0xEA, 0x27, 0x53, 0x22, 0x93, 0x22, 0x2B, 0x53,
-    0xD6, 0xA6, 0x14, 0x0E, 0x3D, 0x22, 0xCB, 0x88, 0xED, 0xCD, 0x5F, 0x29, 0xB5, 0x2A, 0x48, 0x2C,
-    0x86, 0xB6, 0xF2, 0x31, 0x12, 0x2F, 0xCE, 0x5A, 0x35, 0x41, 0x03, 0x31, 0xDC, 0x0A, 0x3F, 0x32,
-    0x9A, 0xA8, 0xC1, 0x64, 0xCD, 0x44, 0x32, 0x2E, 0x47, 0x42, 0x8B, 0x6C, 0x6D, 0xB5, 0xE1, 0xF3,
-    0x1B, 0xB2, 0x8B, 0x13, 0x5F, 0x83, 0x18, 0xFF, 0xCA, 0x19, 0x7A, 0xFB, 0x3D, 0xAA, 0x19, 0x5B,
-    0xC4, 0xCE, 0x46, 0x3B, 0x46, 0x5D, 0xDB, 0x46, 0x42, 0xF3, 0xE3, 0x35, 0xE3, 0x4D, 0x65, 0xBD,
-    0xA7, 0x4F, 0x37, 0x88, 0x2B, 0xC9, 0xAF, 0x35, 0x40, 0x33, 0xC9, 0x24, 0x12, 0xC6, 0x6D, 0x3C,
-    0x64, 0x34, 0x6C, 0x24, 0x1E, 0xD6, 0x64, 0x51, 0x66, 0xD5, 0x52, 0x80, 0x96, 0x04, 0x08, 0x0D,
-    0x28, 0xD9, 0x3A, 0x85, 0x25, 0xB5, 0x72, 0x43, 0x87, 0xDF, 0x88, 0x19, 0x5D, 0xA1, 0x7C, 0xAE,
-    0x0C, 0x2E, 0x11, 0x80, 0xD4, 0x57, 0xA9, 0xEF, 0x89, 0xAF, 0x91, 0x70, 0xD1, 0x98, 0xB4, 0x25,
-    0x4D, 0x49, 0x4B, 0xD2, 0x90, 0xB4, 0xA3, 0x3D, 0x44, 0xF6, 0x59, 0x74, 0xD9, 0xA7, 0xEC, 0x37,
-    0x76, 0x3B, 0x8E, 0xDD, 0x73, 0x8A, 0xC3, 0x18, 0x93, 0x1C, 0xA6, 0xD5, 0x92, 0xFC, 0x43, 0x0F,
-    0x47, 0xD4, 0x09, 0xE3, 0x79, 0x77, 0x34, 0x81, 0x0F, 0x59, 0x28, 0x80, 0x27, 0x63, 0x3D, 0xA2,
-    0x9D, 0x24, 0xB2, 0xF3, 0xC2, 0xA7, 0x91, 0x02, 0x46, 0x10, 0xEE, 0x94, 0xB2, 0xF1, 0x33, 0x66,
-    0x15, 0x29, 0x1B, 0x6E, 0x58, 0xC8, 0x8D, 0x75, 0x4B, 0x35, 0xED, 0x7A, 0x3D, 0xEB, 0x2A, 0xF8,
-    0xC6, 0x38, 0x43, 0xC3, 0xF0, 0x9D, 0x87, 0x2C, 0x5E, 0x84, 0x00, 0x0D, 0x66, 0x20, 0x88, 0xDD,
-    0x9C, 0x22, 0x7B, 0x19, 0x99, 0x68, 0x12, 0xFA, 0x98, 0x42, 0x3F, 0x15, 0x1E, 0xD1, 0x6E, 0x98,
-    0xAA, 0x04, 0x7D, 0x06, 0x9F, 0x95, 0xF7, 0x17, 0x0F, 0x73, 0x56, 0x0B, 0xEF, 0xB2, 0xEE, 0x1A,
-    0xD1, 0x52, 0x4B, 0xDB, 0xF3, 0x53, 0x64, 0x72, 0xB7, 0x7A, 0x31, 0x9F, 0x95, 0x42, 0xEE, 0xDF,
-    0xE1, 0x32, 0x3E, 0x42, 0xB4, 0xDA, 0xA2, 0x1B, 0xE4, 0x9B, 0xF3, 0x53, 0xC8, 0xFE, 0x0F, 0x3A,
-    0xBC, 0x99, 0xAB, 0xE3, 0xF0, 0xC5, 0x8D, 0x63, 0xB3, 0x52, 0x88, 0x25, 0x21, 0x06, 0x4E, 0xC8,
-    0x7E, 0x27, 0x09, 0x45, 0x08, 0x37, 0x84, 0xFC, 0x51, 0xEC, 0x32, 0x48, 0x44, 0xE1, 0x81, 0xAE,
-    0x0E, 0xD2, 0x95, 0x75, 0xBA, 0xBA, 0x0E, 0x65, 0xE5, 0xCE, 0x52, 0x94, 0x9A, 0xCD, 0x1A, 0x52,
-    0x34, 0xC9, 0xAA, 0x70, 0xD3, 0xE4, 0x9F, 0x20, 0x45, 0x44, 0xFC, 0x3E, 0x51, 0xA2, 0x94, 0xAD,
-    0x7A, 0xF4, 0x23, 0x9A, 0xED, 0xBC, 0x55, 0xB0, 0x0A, 0x26, 0xDB, 0x6A, 0x46, 0x5F, 0xA6, 0x36,
-    0xFE, 0x4C, 0x4D, 0x7C, 0x1D, 0x43, 0x97, 0x9A, 0xBB, 0x51, 0x5E, 0xE9, 0x66, 0xD0, 0xA7, 0xF0,
-    0x60, 0x20, 0x2F, 0x0F, 0x62, 0xE8, 0x74, 0xAB, 0xC1, 0xD0, 0x3E, 0x2C, 0x0D, 0xBD, 0xFE, 0xC1,
-    0x05, 0xC3, 0xDD, 0x4A, 0xE8, 0x96, 0x1A, 0xD0, 0x4E, 0xC3, 0xD7, 0x82, 0xCF, 0xEE, 0x35, 0x35,
-    0x34, 0x3C, 0xA7, 0x4B, 0x35, 0xFD, 0x90, 0x64, 0x44, 0x52, 0x98, 0xA9, 0xCD, 0xF9, 0x7E, 0x1B,
-    0x8E, 0xD3, 0xE2, 0x77, 0x48, 0x27, 0x82, 0xFA, 0x99, 0x24, 0x60, 0x82, 0x74, 0x4C, 0xFD, 0xCE,
-    0xE9, 0x2E, 0x3D, 0x48, 0x98, 0xE5, 0x69, 0xC9, 0x18, 0x91, 0x1B, 0x20, 0x35, 0xA8, 0x88, 0x5C,
-    0x8D, 0xE2, 0x36, 0x1C, 0x28, 0xC3, 0x20, 0xC9, 0x22, 0x9D, 0xF7, 0x09, 0x31, 0x97, 0xF7, 0xF5,
-    0xB6, 0xB0, 0xD0, 0x0D, 0xB9, 0xB0, 0x7A, 0x38, 0xF4, 0xAA, 0x24, 0xB7, 0xEA, 0x7F, 0x02, 0xD1,
-    0xAC, 0xDC, 0x6A, 0xAC, 0xD8, 0xEE, 0x32, 0x72, 0x76, 0xBA, 0x5B, 0xA2, 0xB3, 0xDF, 0x92, 0x1A,
-    0xAB, 0x3D, 0x66, 0x4B, 0xC1, 0xD1, 0x09, 0xBB, 0xD4, 0xC5, 0x58, 0x5B, 0xDC, 0xB6, 0xB5, 0x3F,
-    0x54, 0xFA, 0x97, 0xC8, 0x7C, 0x52, 0xFC, 0x8D, 0x73, 0xE3, 0xBE, 0x1C, 0xDD, 0xEA, 0x13, 0xB5,
-    0x72, 0x4C, 0x29, 0xFB, 0x28, 0x49, 0xF4, 0xF4, 0x3B, 0xC2, 0xFC, 0xFC, 0x44, 0x65, 0x93, 0xC5,
-    0xCC, 0xAD, 0x77, 0x1E, 0xB2, 0x41, 0xB2, 0x9F, 0x5A, 0x5E, 0xE5, 0xA6, 0x35, 0xD2, 0x1B, 0x6F,
-    0xD8, 0x71, 0x9F, 0x3D, 0xCC, 0xC7, 0xE8, 0x9C, 0x02, 0x89, 0x34, 0xB5, 0x39, 0xD1, 0x05, 0x5B,
-    0xBD, 0xAD, 0x92, 0x3F, 0x96, 0x06, 0x22, 0x98, 0x55, 0x9A, 0x43, 0xAB, 0x34, 0x72, 0xB1, 0x91,
-    0x66, 0xAE, 0x90, 0xB7, 0x80, 0xEE, 0x4B, 0x06, 0xCC, 0x6D, 0xE3, 0xEC, 0x59, 0xF4, 0x7A, 0x56,
-    0xB9, 0x59, 0x02, 0x4B, 0x45, 0xA1, 0x1F, 0x07, 0x9F, 0x24, 0xE8, 0x62, 0xD2, 0x7B, 0x39, 0x6A,
-    0xD4, 0x1E, 0x61, 0xB1, 0x3A, 0x33, 0x1D, 0xBE, 0xA8, 0x78, 0xCA, 0xC5, 0xC9, 0x23, 0xD9, 0x68,
-    0x77, 0xF3, 0xA7, 0x19, 0xFB, 0xD0, 0x65, 0xD6, 0xE1, 0x50, 0xA5, 0xBE, 0x85, 0x60, 0xBA, 0x85,
-    0x14, 0xF1, 0x3A, 0xDE, 0xD1, 0xEF, 0x90, 0xFD, 0x4D, 0xAD, 0xFA, 0x24, 0x96, 0x9A, 0x2E, 0x2B,
-    0xBA, 0x7D, 0x3D, 0x77, 0xD6, 0x72, 0xD3, 0x88, 0x84, 0xDE, 0x33, 0x3E, 0x82, 0xAB, 0x33, 0x1B,
-    0xB9, 0x67, 0x25, 0x23, 0xC1, 0x93, 0x27, 0x13, 0x78, 0xDA, 0x00, 0x0C, 0xD1, 0xBC, 0x1C, 0x83,
-    0xF7, 0xEC, 0x41, 0xBE, 0x2B, 0x1D, 0xB6, 0x04, 0x2D, 0x39, 0x38, 0xC0, 0xD3, 0x17, 0x7D, 0x11,
-    0xDD, 0x0D, 0x81, 0x79, 0x1F, 0x66, 0x72, 0x58, 0xC8, 0x68, 0xF6, 0xC7, 0x47, 0x96, 0x1F, 0xB2,
-    0xF1, 0xB7, 0x07, 0x5B, 0xBB, 0x80, 0xE6, 0xCC, 0xFB, 0x4C, 0x5F, 0x4E, 0x8F, 0x41, 0xC0, 0x74,
-    0x99, 0xCD, 0x09, 0x7B, 0x88, 0x78, 0x2A, 0x39, 0xCC, 0x7D, 0x55, 0x9F, 0x71, 0xDE, 0xE7, 0xA7,
-    0x0F, 0xA6, 0xA9, 0x0C, 0x1C, 0x8B, 0xDC, 0xF0, 0xF0, 0x44, 0xE0, 0x5F, 0xB0, 0xFF, 0xEB, 0x23,
-    0x12, 0xC5, 0x62, 0xCC, 0x81, 0xEB, 0x7D, 0x9D, 0x8A, 0xC1, 0xC0, 0xE5, 0x2F, 0x86, 0x5E, 0xC5,
-    0xE5, 0x76, 0x3D, 0x68, 0x6B, 0x91, 0xBB, 0x14, 0x22, 0x53, 0xBB, 0x51, 0x66, 0x2A, 0xA0, 0x55,
-    0xF1, 0xF5, 0x42, 0xD9, 0x15, 0xE6, 0x3A, 0xAB, 0x8B, 0xD9, 0xDB, 0x43, 0x5A, 0xBD, 0xE1, 0xF7,
-    0x53, 0x35, 0xC9, 0x07, 0x00, 0x2E, 0x4F, 0x80, 0xED, 0x2C, 0x17, 0x72, 0xF8, 0x0C, 0x1A, 0x48,
-    0x65, 0xC9, 0xFB, 0x32, 0x1C, 0x01, 0xA3, 0xB7, 0x5B, 0xAE, 0x1D, 0xB7, 0xDC, 0xCB, 0x1B, 0x3E,
-    0x9E, 0xA4, 0x8B, 0x97, 0x77, 0x62, 0x78, 0x03, 0x3D, 0xE5, 0x51, 0x25, 0xDD, 0xC5, 0xCC, 0x4B,
-    0x77, 0xC3, 0x40, 0xA7, 0x0F, 0x35, 0xF3, 0xF8, 0x51, 0xDB, 0x34, 0xE9, 0xBF, 0xA1, 0xDB, 0x69,
-    0x18, 0x7D, 0xC1, 0xEC, 0x03, 0x9D, 0xCE, 0xF4, 0xD0, 0x6F, 0xC2, 0xF5, 0x1C, 0x93, 0xE5, 0x52,
-    0xC4, 0x83, 0x9C, 0xB0, 0xE7, 0xD8, 0xD7, 0x31, 0x36, 0xCB, 0xEC, 0x6C, 0x99, 0x22, 0x9E, 0xA0,
-    0x60, 0x1B, 0x6C, 0xAE, 0x50, 0xF9, 0x82, 0x22, 0x92, 0x60, 0x80, 0x82, 0x47, 0xA1, 0x70, 0x6F,
-    0x27, 0x56, 0xFE, 0xCE, 0x75, 0xFA, 0xEA, 0x54, 0x14, 0x77, 0xF2, 0x17, 0x95, 0x0F, 0xAE, 0xFE,
-    0x23, 0x58, 0xF4, 0xB5, 0x76, 0x33, 0xEC, 0xD0, 0xAA, 0x31, 0x88, 0x4A, 0xBB, 0x74, 0x8B, 0xA9,
-    0xED, 0x9D, 0x6E, 0x93, 0xA4, 0xA3, 0xD8, 0x71, 0x12, 0x23, 0x5C, 0xC4, 0xD1, 0x7B, 0xAC, 0x16,
-    0x07, 0x95, 0x5F, 0xF8, 0x93, 0x30, 0x35, 0x75, 0x06, 0x74, 0x1E, 0x6A, 0x78, 0x98, 0x2A, 0xBF,
-    0x5D, 0x69, 0x7B, 0x17, 0xDF, 0x8A, 0x4F, 0x74, 0x07, 0x41, 0x0D, 0xA9, 0x60, 0xBE, 0xAE, 0xE6,
-    0xA7, 0x88, 0x6C, 0x9D, 0xFC, 0x2C, 0x96, 0xF3, 0x46, 0xDD, 0xD6, 0xC9, 0xDE, 0x15, 0x12, 0x5F,
-    0x35, 0x3F, 0x80, 0xEB, 0x9A, 0x37, 0xD2, 0xEE, 0x3F, 0xD5, 0xE7, 0x7C, 0xF3, 0xD0, 0x8A, 0x71,
-    0xEB, 0x20, 0x12, 0xC8, 0x27, 0xDD, 0xF6, 0xAF, 0x5D, 0xCD, 0x4A, 0xB3, 0x80, 0x3B, 0xBD, 0x3C,
-    0x67, 0x66, 0x16, 0x24, 0x4C, 0xE7, 0xB2, 0xF9, 0x29, 0x65, 0x54, 0xD7, 0x95, 0xF5, 0x05, 0xBA,
-    0x3F, 0x9F, 0xA9, 0xE7, 0x9C, 0x3D, 0x2F, 0x9D, 0x7D, 0x14, 0xF9, 0x64, 0x7F, 0x64, 0xD7, 0x2C,
-    0x7A, 0x42, 0x2A, 0x67, 0x6B, 0xC4, 0x2F, 0xBE, 0xBE, 0xCC, 0x84, 0x8B, 0xAB, 0x6D, 0x69, 0x48,
-    0xCA, 0x43, 0x84, 0xCB, 0x68, 0x82, 0x59, 0x74, 0x94, 0xAE, 0xC5, 0x01, 0xEB, 0x63, 0x89, 0xA1,
-    0x4E, 0xB8, 0x39, 0xF6, 0x4A, 0x1D, 0x3E, 0xAB, 0xA2, 0x6A, 0xFD, 0x2E, 0x04, 0x5C, 0xBF, 0xCD,
-    0x84, 0x48, 0x39, 0xB1, 0x6C, 0x34, 0xB9, 0xD0, 0xD7, 0xD4, 0xEA, 0xB8, 0x54, 0x28, 0xA0, 0x33,
-    0xB2, 0xFD, 0x04, 0x37, 0x3A, 0xA5, 0x1B, 0xC4, 0xAC, 0xB4, 0x1E, 0x0B, 0xCE, 0xE5, 0x88, 0x60,
-    0xCB, 0xC1, 0xCD, 0x14, 0x7F, 0xDE, 0x0E, 0xDE, 0x8B, 0x59, 0x82, 0xF5, 0xDF, 0x0F, 0x95, 0xB5,
-    0x93, 0x79, 0x1F, 0x11, 0x4D, 0x53, 0xD9, 0xF9, 0xD0, 0xA1, 0xDB, 0x72, 0x00, 0xC6, 0xC2, 0x76,
-    0xCF, 0x98, 0xF5, 0x63, 0x37, 0x1B, 0x4B, 0x69, 0x36, 0x2D, 0x7B, 0x90, 0x68, 0x23, 0x15, 0x89,
-    0x4D, 0xB3, 0xE7, 0xA2, 0x87, 0x06, 0xC0, 0xF8, 0x30, 0x28, 0xAC, 0xA1, 0x8B, 0x7C, 0xCB, 0x1A,
-    0x3A, 0x99, 0x55, 0x3A, 0x43, 0x2B, 0xB5, 0x4A, 0xB7, 0x62, 0x7B, 0xAC, 0xB2, 0x63, 0xAB, 0xFC,
-    0x61, 0xE5, 0x20, 0x03, 0xFA, 0x4B, 0x75, 0x10, 0xED, 0xAD, 0xEA, 0xA8, 0xB2, 0xFE, 0x7B, 0xA3,
-    0xDA, 0x50, 0xD6, 0xBD, 0x97, 0xAB, 0x1C, 0x43, 0x1B, 0x30, 0x8B, 0xF0, 0x66, 0x88, 0x68, 0x54,
-    0xF7, 0x65, 0x50, 0xED, 0x31, 0x6D, 0x0C, 0xEA, 0xBE, 0x81, 0x31, 0x57, 0x8C, 0xBC, 0xB7, 0xCC,
-    0x2B, 0x3A, 0x8F, 0xEE, 0x1A, 0xC9, 0x36, 0x04, 0x5E, 0xA1, 0xF0, 0x9B, 0x0C, 0xD8, 0xDC, 0xF0,
-    0xB6, 0xD8, 0x1B, 0xBC, 0xCD, 0xAC, 0x59, 0x05, 0x68, 0x98, 0x02, 0x68, 0xD6, 0x3C, 0x93, 0x7C,
-    0xEA, 0xC8, 0xE9, 0xF4, 0x8E, 0xD3, 0x33, 0x3C, 0x92, 0x14, 0xE8, 0x62, 0xF7, 0x81, 0xB3, 0x91,
-    0xC2, 0x17, 0x91, 0x3D, 0x48, 0x71, 0xBD, 0xAD, 0xB3, 0x57, 0xB4, 0xD7, 0x55, 0x16, 0x51, 0x0A,
-    0x16, 0xB9, 0x48, 0xA4, 0x68, 0x9E, 0x84, 0x07, 0x88, 0xA3, 0x53, 0x9C, 0xE5, 0x3F, 0xF4, 0x27,
-    0xFE, 0xFC, 0xD1, 0x79, 0x39, 0x77, 0x74, 0x3A, 0xEC, 0x5A, 0x77, 0xAC, 0xED, 0x07, 0x3C, 0xF3,
-    0x10, 0x8C, 0xB7, 0xD4, 0x9D, 0x94, 0x79, 0xC0, 0x0D, 0x1E, 0x74, 0xBD, 0x31, 0x64, 0xF4, 0x1C,
-    0xCC, 0x4B, 0x73, 0xF1, 0xCA, 0x07, 0x4F, 0x94, 0xFB, 0x1A, 0x4B, 0x25, 0xB8, 0x93, 0x94, 0x70,
-    0xB7, 0x20, 0xC3, 0xEA, 0x82, 0x71, 0xAE, 0x90, 0x3C, 0x0E, 0x9C, 0xAA, 0x3F, 0x0B, 0xD8, 0xEE,
-    0x82, 0xE1, 0x0E, 0xA9, 0x42, 0xCB, 0xF7, 0xFE, 0xF8, 0xFB, 0xD0, 0x0E, 0xF1, 0xBD, 0x4B, 0xC2,
-    0xE8, 0x61, 0xF5, 0x5D, 0x6A, 0x30, 0xAE, 0xAE, 0x27, 0x46, 0x4D, 0xBA, 0x84, 0xA3, 0x1D, 0xD2,
-    0x58, 0x5B, 0x0B, 0x49, 0x31, 0xDC, 0x0B, 0x3A, 0x3E, 0x08, 0x2E, 0xF5, 0x1D, 0xAB, 0x3B, 0xF5,
-    0x4B, 0xC6, 0x01, 0x6B, 0x91, 0x5E, 0x59, 0x95, 0x19, 0xBA, 0x85, 0x1D, 0x22, 0x51, 0x53, 0xC9,
-    0x9D, 0x04, 0x99, 0x5C, 0x33, 0x55, 0xF9, 0x96, 0x33, 0x0A, 0x42, 0x4E, 0xFB, 0xE3, 0x82, 0xFB,
-    0xAC, 0x07, 0x13, 0x7D, 0xA7, 0xCB, 0x4C, 0xBB, 0xCD, 0xE8, 0x3D, 0xEA, 0xB1, 0xDB, 0xE9, 0xE4,
-    0xFD, 0xD5, 0xE3, 0x21, 0xA7, 0xFA, 0xF6, 0x3A, 0x1F, 0xA4, 0x0A, 0xDE, 0x87, 0xB8, 0x3E, 0x38,
-    0xCF, 0xB3, 0x42, 0xAF, 0xC4, 0x93, 0xE7, 0x0C, 0xC7, 0x3B, 0xBE, 0xD5, 0xD4, 0x8E, 0xAF, 0xEC,
-    0x18, 0xB4, 0xDC, 0x73, 0xFA, 0x4C, 0xD8, 0x43, 0x59, 0xF2, 0x68, 0x6B, 0x9A, 0x3D, 0xBD, 0x50,
-    0xF6, 0x1E, 0xFF, 0x7F, 0xD5, 0x5A, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0x23, 0xB1, 0x31,
-    0x11, 0x33, 0x43, 0xD2, 0xA0, 0x56, 0x2D, 0x76, 0x28, 0x0A, 0xA3, 0xB0, 0xCC, 0x25, 0x83, 0x07,
-    0xC9, 0x64, 0x5B, 0x34, 0x19, 0x32, 0xC4, 0x83, 0x84, 0x0C, 0x1D, 0xB2, 0x77, 0x51, 0x07, 0x0F,
-    0x2E, 0xA0, 0x98, 0x4C, 0x3B, 0x64, 0x08, 0xD0, 0x78, 0xA8, 0xD1, 0x21, 0x43, 0x3D, 0x64, 0x68,
-    0xB4, 0xD8, 0x28, 0x32, 0x78, 0x70, 0x4C, 0xDA, 0x01, 0x9A, 0xC1, 0x43, 0xD9, 0x04, 0x41, 0x87,
-    0x00, 0x05, 0x03, 0x27, 0x1D, 0x9C, 0x21, 0x74, 0x40, 0x23, 0x2F, 0x0E, 0x1F, 0x6F, 0xBF, 0xEF,
-    0x5C, 0x52, 0xEF, 0xC9, 0x76, 0x96, 0x58, 0x96, 0xD3, 0x67, 0xBF, 0x4B, 0xEA, 0xBD, 0x47, 0xDE,
-    0xF3, 0x77, 0xCF, 0xF9, 0xCE, 0x77, 0x29, 0x32, 0xBE, 0xBC, 0x46, 0x1C, 0xD3, 0x7A, 0xAD, 0x44,
-    0x37, 0x0D, 0xCE, 0x0B, 0x49, 0xAE, 0xD6, 0x4E, 0x27, 0xD1, 0x87, 0xA5, 0x37, 0x91, 0xB0, 0x97,
-    0xB0, 0xE1, 0xFF, 0xA8, 0xE6, 0x18, 0x57, 0x1C, 0x93, 0x92, 0x63, 0x56, 0x4A, 0xA4, 0x23, 0x3E,
-    0xCC, 0x72, 0x7E, 0xC8, 0x51, 0x4F, 0x0A, 0xC1, 0xE8, 0x4C, 0x05, 0x57, 0xF9, 0xAD, 0x88, 0x3F,
-    0xDD, 0xAC, 0x30, 0x51, 0x31, 0xE5, 0x74, 0xCE, 0x30, 0xED, 0x62, 0x8A, 0x21, 0x2A, 0x65, 0xF1,
-    0x3C, 0x06, 0xD3, 0x87, 0xA5, 0xDF, 0x26, 0xAF, 0x4B, 0x58, 0xC7, 0x53, 0x5C, 0x8B, 0xD9, 0xB2,
-    0x3C, 0xAA, 0xA4, 0x48, 0x71, 0x73, 0x23, 0x31, 0x7E, 0xC1, 0xFB, 0x1A, 0x4E, 0x61, 0x78, 0xFB,
-    0x82, 0x77, 0x4F, 0x3E, 0xC7, 0xCD, 0x03, 0x93, 0xCB, 0xDD, 0xAF, 0xB0, 0x4C, 0x4C, 0x65, 0x5E,
-    0xAC, 0xE2, 0x3E, 0xDD, 0x0C, 0x4A, 0x1F, 0x6A, 0xF8, 0xB8, 0xBD, 0x1C, 0x0C, 0x25, 0x80, 0x26,
-    0x97, 0x28, 0xFD, 0xB1, 0x94, 0xE3, 0x2A, 0x45, 0xE4, 0x88, 0x69, 0x8E, 0x53, 0x68, 0x39, 0xA5,
-    0xE3, 0x45, 0xA1, 0x26, 0x8D, 0x70, 0x3E, 0x8C, 0x45, 0xEA, 0xD4, 0x38, 0x4F, 0xBD, 0x92, 0xDF,
-    0x06, 0x98, 0x30, 0xBE, 0x73, 0x05, 0xF3, 0xF8, 0xA6, 0xDD, 0x35, 0xEF, 0x11, 0x0E, 0x57, 0x9E,
-    0x5E, 0x77, 0x4E, 0x5E, 0xC9, 0x5A, 0xBF, 0x5D, 0x0B, 0x9B, 0xA0, 0x59, 0x0D, 0x9B, 0xF0, 0x56,
-    0x83, 0xA1, 0x4F, 0xA3, 0x1A, 0x93, 0x45, 0x15, 0xE6, 0x8A, 0x4B, 0x4C, 0x92, 0xE8, 0x90, 0x17,
-    0xB9, 0x64, 0xAF, 0x42, 0x89, 0xEC, 0x7D, 0xDA, 0xAF, 0x4B, 0x3A, 0x89, 0x9B, 0xB8, 0x95, 0xFB,
-    0xBF, 0x9A, 0x68, 0x3C, 0xBB, 0x7C, 0x79, 0x3C, 0x4B, 0x9A, 0xF1, 0x2C, 0xAA, 0xE6, 0x7F, 0x6B,
-    0xCC, 0xD7, 0x10, 0xDA, 0x98, 0x5A, 0x36, 0xEF, 0x18, 0x98, 0x71, 0xDB, 0xD0, 0x7B, 0x51, 0x2B,
-    0xAD, 0x60, 0xBA, 0xB0, 0xF6, 0x3A, 0xA7, 0xF6, 0x0C, 0x2D, 0xE0, 0x4D, 0xDD, 0x2A, 0xE8, 0x68,
-    0x05, 0xB7, 0x97, 0x14, 0xBF, 0xA0, 0xFB, 0x7A, 0x5C, 0x5C, 0x8D, 0x67, 0x34, 0x72, 0x96, 0xE3,
-    0x5B, 0x5E, 0x00, 0x4B, 0xE0, 0x8C, 0x17, 0xC0, 0x32, 0xDE, 0x14, 0xF2, 0x72, 0x36, 0xF1, 0x3A,
-    0xBD, 0x00, 0x67, 0x01, 0x66, 0x80, 0x7B, 0x71, 0x61, 0xD4, 0x78, 0xBD, 0x2C, 0x8B, 0x4B, 0xA7,
-    0x86, 0x9D, 0xAC, 0xE0, 0x47, 0x8E, 0x49, 0x71, 0xC1, 0x96, 0x2C, 0xF5, 0x17, 0x26, 0x92, 0xDD,
-    0xDC, 0xEE, 0x28, 0x23, 0xDC, 0x6A, 0xCC, 0xE4, 0x6E, 0x6D, 0xB7, 0xFC, 0xD2, 0x6A, 0x11, 0xC7,
-    0x62, 0x95, 0xC0, 0x3D, 0xAC, 0x0E, 0x70, 0xA4, 0xAA, 0x60, 0xF5, 0x86, 0x06, 0xCE, 0xC6, 0x46,
-    0xAA, 0x0A, 0xF8, 0x06, 0xBF, 0xA3, 0xD4, 0xC1, 0xB9, 0xA2, 0xD4, 0x93, 0x10, 0x22, 0xA9, 0xF4,
-    0x8F, 0xF3, 0xF7, 0x56, 0xF8, 0x76, 0x94, 0xBD, 0x1E, 0x45, 0xCF, 0x47, 0xC9, 0x47, 0xC1, 0x3B,
-    0x27, 0x55, 0xB9, 0x83, 0xD6, 0xCB, 0xAD, 0xD8, 0x75, 0x90, 0x0E, 0x52, 0x17, 0x56, 0xE8, 0xC2,
-    0x98, 0x39, 0x71, 0xE1, 0xBA, 0x36, 0xC4, 0x6D, 0x96, 0x3A, 0x59, 0x3B, 0xC3, 0x95, 0x35, 0x91,
-    0x98, 0x3A, 0x21, 0xF4, 0x42, 0x4C, 0xA3, 0x93, 0xE2, 0x75, 0xE8, 0xCD, 0x66, 0x81, 0xC2, 0x1A,
-    0xD3, 0x84, 0xC6, 0x60, 0x95, 0x21, 0x2E, 0x36, 0x0C, 0x7E, 0x12, 0x55, 0x2B, 0x98, 0x30, 0x2E,
-    0xE3, 0xF2, 0x48, 0x30, 0x41, 0x64, 0x24, 0x76, 0x85, 0xA5, 0x1A, 0x2B, 0x88, 0x7A, 0x0D, 0x7E,
-    0xC6, 0x3F, 0xE5, 0xC2, 0x11, 0xE2, 0x4E, 0x5C, 0x31, 0xAE, 0x81, 0x01, 0x02, 0x31, 0x3E, 0x96,
-    0x6E, 0xB9, 0x2C, 0xD9, 0xB4, 0x98, 0x98, 0x9B, 0xEF, 0x4A, 0xDC, 0x26, 0x9F, 0x18, 0xD3, 0xCD,
-    0xC7, 0x03, 0x82, 0xCC, 0x94, 0xB2, 0xD9, 0xA7, 0xFA, 0x46, 0xFC, 0xAB, 0x48, 0x94, 0x8D, 0xE7,
-    0xD1, 0x70, 0x44, 0x7C, 0xEA, 0x39, 0xE6, 0xD4, 0x73, 0x3D, 0x96, 0xBA, 0x16, 0xF4, 0x3C, 0x4B,
-    0xED, 0xB1, 0x48, 0x65, 0xB0, 0x9A, 0x3D, 0x37, 0xE2, 0x0E, 0xC6, 0x0B, 0x78, 0x84, 0x8C, 0x6A,
-    0x78, 0xD8, 0xF6, 0x18, 0x43, 0x68, 0xA9, 0xDF, 0x9E, 0x52, 0x6E, 0x18, 0xAE, 0x1B, 0xFC, 0x26,
-    0xE3, 0xD1, 0x1F, 0x5C, 0x1F, 0x34, 0xBB, 0x02, 0xF9, 0x71, 0xDE, 0x96, 0x7F, 0x7E, 0x7A, 0x57,
-    0x60, 0xE0, 0x7B, 0x6A, 0x03, 0xE7, 0x51, 0x91, 0x58, 0xF3, 0x11, 0x33, 0x8B, 0x9A, 0x59, 0xA5,
-    0x77, 0x34, 0x1A, 0x10, 0xAE, 0xB9, 0x95, 0x35, 0x1F, 0x45, 0xA6, 0xC4, 0x85, 0x55, 0xC2, 0x58,
-    0xB9, 0x7B, 0x3D, 0x73, 0xD4, 0xA4, 0xAE, 0xDB, 0xA9, 0x02, 0x10, 0x8C, 0xF2, 0xE3, 0x40, 0xF1,
-    0xE1, 0x48, 0x4A, 0x0F, 0x3F, 0x52, 0xF8, 0x41, 0xC8, 0x70, 0x38, 0xD4, 0xF3, 0x12, 0x73, 0x12,
-    0x91, 0x05, 0x1B, 0x15, 0xE1, 0x18, 0xD0, 0xC8, 0x69, 0x46, 0x9E, 0xE9, 0x6C, 0xA0, 0xF5, 0x8C,
-    0x8B, 0x27, 0x19, 0x14, 0xD4, 0x77, 0x61, 0x1D, 0x37, 0x8A, 0x3B, 0x0C, 0xF8, 0x4A, 0x03, 0x3A,
-    0xAA, 0x18, 0x37, 0xCC, 0x57, 0x08, 0x3D, 0x24, 0xDB, 0x9C, 0xB9, 0x36, 0xC7, 0x34, 0x19, 0x12,
-    0x08, 0x44, 0x67, 0x5A, 0xA4, 0xCA, 0x45, 0xC7, 0xB8, 0xA8, 0x93, 0x5C, 0xAC, 0x36, 0xD4, 0xCA,
-    0x3A, 0x83, 0xAA, 0xC8, 0x12, 0x27, 0xCF, 0xCE, 0xF2, 0x23, 0x24, 0xF5, 0x89, 0xC1, 0x82, 0xDC,
-    0x6C, 0x65, 0xB3, 0x2E, 0xB0, 0x9C, 0xB0, 0x8A, 0x42, 0xEB, 0xEE, 0xA9, 0x1C, 0x54, 0x1F, 0x2F,
-    0x1B, 0xAC, 0x52, 0x3A, 0xF9, 0x68, 0x91, 0xAE, 0xA8, 0x16, 0xAB, 0x49, 0xBE, 0x6A, 0x4F, 0xE2,
-    0x72, 0x55, 0xAD, 0x76, 0x3A, 0xAC, 0x8F, 0xAB, 0xC1, 0x4E, 0x05, 0xCD, 0x29, 0x9D, 0xE8, 0xA2,
-    0x37, 0xB9, 0xA8, 0x27, 0x10, 0xBE, 0xA1, 0x1D, 0xA5, 0x71, 0xFA, 0x86, 0xCE, 0x46, 0xBE, 0x34,
-    0x35, 0xBD, 0xED, 0xA2, 0x38, 0x54, 0x74, 0xB3, 0xC7, 0x20, 0xE6, 0xC9, 0xD2, 0xA7, 0x48, 0xFB,
-    0x74, 0x78, 0x06, 0x29, 0x4A, 0x7F, 0xCC, 0x74, 0xA3, 0xEB, 0x47, 0xBB, 0xCE, 0x65, 0xB3, 0x64,
-    0xC8, 0xF0, 0x3F, 0xEB, 0xC7, 0x0F, 0xEA, 0x7B, 0x12, 0x23, 0x7E, 0xA3, 0x7A, 0xA2, 0x1E, 0xA9,
-    0x9A, 0x49, 0x6A, 0xB5, 0x7C, 0x6C, 0x50, 0x52, 0xAC, 0x8E, 0x0B, 0x1B, 0x56, 0xC5, 0xC0, 0x0C,
-    0x1A, 0x9A, 0x41, 0xC1, 0xDE, 0xEA, 0x47, 0xD3, 0x51, 0x3D, 0x84, 0x81, 0x6A, 0x47, 0x81, 0xA9,
-    0x9C, 0x1E, 0xA1, 0x1B, 0x5C, 0xA3, 0xAA, 0x41, 0x6C, 0xD5, 0x0C, 0x52, 0xAB, 0x62, 0x10, 0x5A,
-    0xF5, 0xA2, 0x9B, 0xA8, 0x56, 0x54, 0xEF, 0xD6, 0x21, 0x2E, 0x77, 0xAB, 0x52, 0xD8, 0xC3, 0x0F,
-    0xA7, 0xC3, 0xD7, 0xF5, 0x3D, 0xDA, 0xF0, 0x95, 0x95, 0xF3, 0x7F, 0x3D, 0x36, 0x7E, 0xBB, 0xB0,
-    0xBE, 0x78, 0xD6, 0xD9, 0x90, 0xA8, 0xCB, 0x5A, 0xE8, 0xE1, 0x4D, 0xBF, 0x98, 0x30, 0xB2, 0x8C,
-    0xA7, 0x01, 0x36, 0xF5, 0x26, 0x70, 0x80, 0xDF, 0xF9, 0x2D, 0x74, 0xF1, 0xDB, 0xA0, 0x85, 0x2A,
-    0x41, 0x63, 0xC3, 0x8B, 0x07, 0x14, 0xC3, 0x3A, 0xA4, 0xFC, 0x51, 0x15, 0x55, 0x58, 0xFE, 0x31,
-    0x64, 0xD5, 0x9A, 0x1E, 0x19, 0x3D, 0x04, 0xD3, 0xDD, 0x11, 0x3D, 0x48, 0x6E, 0x03, 0xDB, 0x06,
-    0xDA, 0x28, 0xF6, 0xDC, 0xB2, 0xF4, 0x73, 0x94, 0x23, 0xEF, 0x06, 0x57, 0xA1, 0x29, 0x67, 0xFA,
-    0x89, 0xAE, 0x2E, 0x71, 0x19, 0x23, 0x5A, 0x39, 0x02, 0x7E, 0xB1, 0xCC, 0xBB, 0xAC, 0x72, 0x38,
-    0x45, 0xD5, 0x1A, 0x0C, 0x6E, 0x85, 0x09, 0x3C, 0x16, 0xC4, 0xE0, 0x1C, 0x81, 0x05, 0x73, 0xF8,
-    0x1A, 0x23, 0xF3, 0x34, 0xE3, 0x14, 0x08, 0xA4, 0x76, 0x09, 0x40, 0x96, 0xE0, 0xDA, 0xAF, 0x93,
-    0xA9, 0x6B, 0x6C, 0x24, 0xAC, 0x7A, 0x95, 0x44, 0x51, 0x4A, 0x0F, 0xCB, 0x18, 0x48, 0x07, 0xCE,
-    0x9E, 0x44, 0x5A, 0x6E, 0x98, 0x55, 0x99, 0x51, 0x99, 0x4D, 0x99, 0x49, 0x99, 0x45, 0x99, 0x41,
-    0x99, 0x3D, 0x99, 0x39, 0x99, 0x35, 0x99, 0x31, 0xB3, 0xAE, 0x98, 0x20, 0x53, 0xCE, 0xEC, 0xBF,
-    0xE6, 0xA1, 0x46, 0xBF, 0x9C, 0x4B, 0xD0, 0x6B, 0x02, 0xDF, 0xC9, 0x9C, 0x63, 0xC6, 0xA4, 0x75,
-    0xE8, 0xDD, 0x31, 0x33, 0xEA, 0x3B, 0xB7, 0x96, 0xB1, 0x59, 0x50, 0x86, 0x2C, 0xC8, 0x0C, 0xA2,
-    0x19, 0x6E, 0x09, 0x97, 0x66, 0x6A, 0x16, 0x59, 0xF5, 0x4B, 0xD4, 0x32, 0x44, 0xA6, 0xAD, 0x05,
-    0x4F, 0x9F, 0x94, 0xAC, 0x1D, 0x10, 0x16, 0x6E, 0xAC, 0xF0, 0x80, 0x16, 0x57, 0x60, 0xC0, 0x45,
-    0xA7, 0x90, 0x40, 0x76, 0xC1, 0x81, 0x26, 0xC4, 0x2C, 0x5B, 0xAF, 0xD0, 0x27, 0xED, 0xFC, 0x2A,
-    0x71, 0x08, 0x46, 0x80, 0xE1, 0x68, 0x7C, 0x54, 0xBD, 0x21, 0x91, 0xD0, 0xE7, 0xAC, 0x98, 0xB4,
-    0x9E, 0xA2, 0x37, 0x05, 0x6F, 0x8A, 0xDD, 0x14, 0xBA, 0x29, 0x72, 0x53, 0xE0, 0xA6, 0x25, 0x46,
-    0x61, 0x9B, 0xA2, 0x36, 0x0B, 0xDA, 0x14, 0xB3, 0x8D, 0x90, 0x0D, 0xD2, 0xC3, 0xDE, 0xF1, 0x6E,
-    0x7B, 0x2F, 0x9E, 0x87, 0xBE, 0x08, 0xB8, 0x16, 0x89, 0xAA, 0x26, 0xAE, 0x89, 0x2A, 0x42, 0x37,
-    0x22, 0x37, 0x02, 0x37, 0xE2, 0x36, 0x63, 0xED, 0xAE, 0xA0, 0x8D, 0x98, 0x6D, 0x37, 0x64, 0xF3,
-    0xAA, 0x35, 0x4C, 0x71, 0x9B, 0xB7, 0x33, 0xD4, 0x25, 0x1B, 0xBE, 0x24, 0x84, 0x9B, 0x10, 0xC1,
-    0xD5, 0x04, 0x70, 0x9C, 0xEF, 0x20, 0x93, 0xC4, 0x61, 0xDA, 0x6A, 0xC5, 0x82, 0x37, 0xC5, 0x6E,
-    0x0A, 0xDD, 0x14, 0xB9, 0x29, 0x70, 0x53, 0xDC, 0xA6, 0xB0, 0x4D, 0x51, 0x9B, 0x82, 0x36, 0xC5,
-    0x6C, 0x0A, 0xD9, 0xEE, 0x42, 0x6C, 0xCB, 0x2E, 0x8C, 0xF3, 0x46, 0x89, 0x8F, 0x77, 0x6A, 0x11,
-    0xD1, 0x1B, 0xC1, 0x1B, 0xB1, 0x5B, 0x68, 0xFF, 0xD5, 0x04, 0x6E, 0xC4, 0x6D, 0x54, 0x4F, 0xFF,
-    0x01, 0xB4, 0x11, 0xB3, 0x11, 0xB2, 0x11, 0xB1, 0xCD, 0x00, 0xDB, 0xD3, 0xEB, 0x54, 0x83, 0x46,
-    0xDB, 0xE0, 0x19, 0x57, 0x8B, 0xDB, 0x70, 0x69, 0x70, 0x70, 0xAA, 0xD3, 0xFB, 0xA7, 0x5A, 0x08,
-    0xDC, 0x77, 0x60, 0xDB, 0xDA, 0x32, 0x06, 0x8E, 0x4A, 0x82, 0x52, 0x96, 0xFD, 0xFC, 0xC1, 0x55,
-    0x14, 0x0D, 0x89, 0x56, 0x3D, 0x87, 0xE1, 0xB9, 0x47, 0xA4, 0x62, 0x80, 0xC9, 0x09, 0xB6, 0x4E,
-    0xE0, 0xFC, 0xD4, 0x5E, 0xAB, 0xC8, 0xD7, 0xC5, 0x63, 0xCC, 0x06, 0x3B, 0x4B, 0xEC, 0xD7, 0xE9,
-    0x23, 0xD1, 0x33, 0xC0, 0xB7, 0xDE, 0xC7, 0xB9, 0xE6, 0x13, 0x59, 0x9F, 0xE9, 0x79, 0x6C, 0x0F,
-    0xF4, 0x74, 0x34, 0xBD, 0x69, 0x1F, 0x41, 0x5D, 0xE5, 0x85, 0x47, 0xE3, 0xCA, 0x08, 0x9A, 0x40,
-    0x23, 0x71, 0x99, 0x84, 0x2F, 0xEE, 0xAD, 0x2B, 0x0F, 0x9D, 0x45, 0xF1, 0x41, 0x1D, 0xFC, 0xC8,
-    0xC8, 0xA2, 0xA6, 0xE9, 0x21, 0x65, 0x2F, 0x99, 0xD2, 0x35, 0x05, 0x32, 0x56, 0xA2, 0x75, 0x21,
-    0x49, 0x91, 0x99, 0x7E, 0x09, 0xCC, 0xFD, 0x71, 0xCD, 0x96, 0x77, 0x7C, 0x6D, 0x9C, 0x64, 0xD9,
-    0x82, 0x95, 0x1C, 0x9E, 0x59, 0x7F, 0x5C, 0x65, 0x0D, 0xB8, 0x86, 0xC1, 0x4F, 0xEB, 0xFD, 0xA8,
-    0x71, 0x11, 0x0A, 0xC7, 0xA1, 0x61, 0x1D, 0xAF, 0xC1, 0x7A, 0x67, 0xC2, 0x52, 0x56, 0x83, 0x74,
-    0x4F, 0x6A, 0xDD, 0xA0, 0x9D, 0xBB, 0xFD, 0xD6, 0x08, 0x2F, 0xB2, 0x9D, 0x61, 0x65, 0x5F, 0x2A,
-    0x78, 0x0C, 0xED, 0x7E, 0xBE, 0x9D, 0x6A, 0xA6, 0xF4, 0x1A, 0x5B, 0x55, 0xBC, 0x5A, 0xF6, 0x48,
-    0x3B, 0x3B, 0x43, 0x6E, 0x0F, 0xE9, 0xEC, 0x33, 0xA0, 0x78, 0x26, 0xB1, 0x4D, 0xB3, 0xCD, 0x9C,
-    0xBF, 0xD6, 0xA3, 0x1B, 0x15, 0xF9, 0xFB, 0x94, 0x44, 0x80, 0x73, 0xA3, 0x93, 0x67, 0x21, 0xC3,
-    0x7B, 0x5A, 0x0D, 0x42, 0x5B, 0x14, 0x56, 0x6C, 0x7F, 0x72, 0x3A, 0xD0, 0x76, 0xAF, 0x09, 0x6F,
-    0x6F, 0x30, 0xF9, 0x29, 0x50, 0x0D, 0xD8, 0x5F, 0xC3, 0x20, 0x1B, 0x9B, 0x3C, 0xE8, 0x22, 0x38,
-    0x2B, 0x84, 0xEE, 0x6E, 0xE5, 0x12, 0x4E, 0xF9, 0xE5, 0x52, 0xEB, 0x98, 0x9B, 0x17, 0xCA, 0x64,
-    0x8A, 0x66, 0x6F, 0x56, 0xF8, 0x12, 0x6D, 0x11, 0xB2, 0x59, 0xAC, 0x1D, 0x38, 0xBB, 0xF8, 0x37,
-    0xD4, 0xDB, 0x3E, 0x33, 0x29, 0x34, 0x9E, 0x00, 0x52, 0xD6, 0x41, 0x43, 0x9D, 0xA3, 0x0A, 0x5A,
-    0xE7, 0x31, 0x75, 0x4E, 0x93, 0x7F, 0x74, 0xEC, 0x03, 0x31, 0x25, 0xB4, 0xFF, 0xB3, 0xF6, 0x80,
-    0x84, 0x1C, 0xAE, 0xC9, 0x1F, 0x83, 0x0D, 0x92, 0xF2, 0xC7, 0xE8, 0xFE, 0xA2, 0x3B, 0x68, 0x1F,
-    0x5A, 0xDF, 0xDC, 0x65, 0x88, 0x02, 0x53, 0x05, 0x77, 0x0A, 0x72, 0x35, 0x71, 0x83, 0x42, 0x8C,
-    0x5E, 0x03, 0xAB, 0x39, 0x57, 0x25, 0x14, 0xAD, 0x26, 0xD5, 0x08, 0xF3, 0xB2, 0xF2, 0xC0, 0xF6,
-    0x79, 0x14, 0x71, 0xD3, 0x64, 0xB9, 0x63, 0x6C, 0xDF, 0x0F, 0x9B, 0x1B, 0x78, 0xF8, 0x99, 0x69,
-    0xCA, 0xCE, 0x58, 0xFC, 0x7E, 0x13, 0x26, 0x29, 0xCC, 0xD9, 0x9D, 0xFB, 0x3B, 0x50, 0xED, 0xB7,
-    0x2F, 0xD6, 0x58, 0xD8, 0x77, 0x80, 0x62, 0xFE, 0xD8, 0xA6, 0x92, 0xB8, 0xF8, 0xC9, 0x15, 0x62,
-    0xA8, 0xA9, 0x07, 0xB7, 0xBE, 0xEB, 0x93, 0x4F, 0x79, 0x99, 0xCD, 0x24, 0xB5, 0xFE, 0x3D, 0x09,
-    0x02, 0x4E, 0xEE, 0xF6, 0x6F, 0x11, 0xBC, 0x10, 0x1F, 0xD1, 0x96, 0xC1, 0x67, 0x17, 0x60, 0x37,
-    0xE7, 0x37, 0xB7, 0xE5, 0x0C, 0x3A, 0x79, 0xC4, 0x62, 0x88, 0x6E, 0x1E, 0xFD, 0xB6, 0x2C, 0x9A,
-    0x19, 0xDC, 0x7C, 0x87, 0x1C, 0x8C, 0xF6, 0xD8, 0xDA, 0x60, 0x87, 0xF5, 0x9E, 0x68, 0xC9, 0x66,
-    0x1F, 0x68, 0x59, 0xDB, 0x94, 0x6F, 0xD1, 0x92, 0xF2, 0x56, 0x4C, 0x96, 0xB7, 0x39, 0x6F, 0x51,
-    0xEF, 0xA0, 0xF3, 0xBD, 0x55, 0x5F, 0xF0, 0xE3, 0x33, 0xE2, 0xD7, 0x54, 0xBF, 0xBC, 0x57, 0x7D,
-    0x89, 0xF4, 0xD2, 0xE0, 0x7A, 0x39, 0xAE, 0x4A, 0x71, 0xBB, 0xB9, 0x3E, 0xFF, 0x75, 0xED, 0xF2,
-    0x9F, 0x27, 0xCB, 0xD3, 0x78, 0xDA, 0xE1, 0x23, 0xA5, 0x42, 0x7F, 0x92, 0x47, 0x71, 0x75, 0x89,
-    0x42, 0x5F, 0x53, 0xD1, 0xF5, 0x06, 0x99, 0x85, 0x5D, 0x86, 0xB7, 0x2C, 0xDE, 0x50, 0x1C, 0x16,
-    0x50, 0x3B, 0xE3, 0x77, 0xC4, 0xB1, 0x9E, 0x22, 0x59, 0xD7, 0x22, 0x24, 0xDC, 0x12, 0x68, 0x16,
-    0x7A, 0x03, 0xCF, 0x46, 0x43, 0xA3, 0x16, 0x00, 0xFB, 0x7B, 0x37, 0xD0, 0x72, 0x33, 0xBA, 0x6D,
-    0x40, 0x07, 0x08, 0xCB, 0x85, 0x01, 0x09, 0xF3, 0x23, 0xB6, 0x55, 0x6E, 0xB7, 0xB0, 0xE1, 0x75,
-    0x71, 0xEF, 0x75, 0x01, 0x9C, 0x12, 0xA5, 0x7E, 0xBB, 0x25, 0xC1, 0x2D, 0x24, 0x86, 0x6F, 0xF0,
-    0x46, 0x35, 0x88, 0xBE, 0x02, 0xD0, 0xBD, 0x36, 0x95, 0xF8, 0xAA, 0x62, 0xC6, 0x34, 0xC9, 0xB3,
-    0x3A, 0x4B, 0x97, 0x9A, 0x87, 0x8D, 0x6E, 0x19, 0x4A, 0xC8, 0x54, 0x63, 0x25, 0x54, 0x3B, 0xAA,
-    0x63, 0x89, 0xF0, 0xBF, 0x2B, 0xBC, 0x25, 0x3E, 0xA2, 0xCD, 0x89, 0xD5, 0x89, 0x52, 0xC2, 0xE9,
-    0x8C, 0xEC, 0x18, 0x11, 0xE2, 0x0E, 0x37, 0xF3, 0xA8, 0x74, 0xB3, 0x79, 0x28, 0x1D, 0x72, 0xD1,
-    0xC3, 0xD1, 0xD5, 0xCF, 0xB7, 0x6C, 0x5F, 0xC8, 0x00, 0x1F, 0xBA, 0xC2, 0x02, 0x93, 0x30, 0x03,
-    0x1B, 0x33, 0x71, 0x6A, 0xAF, 0x72, 0xCB, 0x90, 0x5C, 0x9F, 0x92, 0x06, 0x2A, 0x71, 0x84, 0x88,
-    0x59, 0x28, 0xCA, 0x19, 0x23, 0x15, 0x36, 0x5B, 0x78, 0x93, 0x1F, 0x21, 0xF3, 0x91, 0x7C, 0x64,
-    0xD2, 0x80, 0x26, 0x7B, 0x6A, 0x84, 0xBA, 0x48, 0xB8, 0xFE, 0xFB, 0x24, 0x7B, 0x52, 0xCB, 0x7D,
-    0xB0, 0x74, 0x03, 0x7F, 0xF3, 0xFE, 0xC6, 0xB4, 0xEE, 0x67, 0x2F, 0x55, 0x1E, 0xE6, 0x70, 0xD3,
-    0xB9, 0x39, 0x62, 0xE8, 0x9A, 0xF4, 0x03, 0x73, 0x35, 0x32, 0x5C, 0xF6, 0x7D, 0x04, 0x7F, 0x5F,
-    0x46, 0xB2, 0x9D, 0x22, 0x72, 0xB3, 0x37, 0x27, 0xB3, 0x76, 0xE5, 0x7E, 0xF3, 0x2C, 0x00, 0x93,
-    0x45, 0x83, 0xC2, 0xFA, 0x9E, 0x58, 0x36, 0x8B, 0x85, 0x4C, 0x39, 0xCA, 0xB1, 0x65, 0xAC, 0xEE,
-    0xDF, 0x32, 0x1A, 0x0B, 0xA8, 0xC9, 0xD6, 0x58, 0xF2, 0xF4, 0xFF, 0x90, 0xB4, 0x55, 0x99, 0xF9,
-    0x52, 0x91, 0x2D, 0x87, 0x13, 0xB5, 0x03, 0x3B, 0xF6, 0xFD, 0xA0, 0x68, 0x93, 0x21, 0x1E, 0x97,
-    0x46, 0xE2, 0x71, 0xE8, 0xEC, 0xC7, 0x2E, 0xF6, 0x11, 0x53, 0xB3, 0x63, 0x5A, 0x18, 0x25, 0x63,
-    0x73, 0x03, 0x0F, 0xEC, 0x63, 0x55, 0xB3, 0x99, 0xFB, 0xEE, 0xC9, 0xF7, 0xA9, 0xAA, 0x19, 0xF3,
-    0x9A, 0x5A, 0x63, 0xB3, 0x7F, 0x4E, 0xFF, 0x0E, 0x1B, 0x5D, 0x96, 0x5C, 0x38, 0xC5, 0xC0, 0xE7,
-    0x6A, 0x8A, 0xD2, 0xCD, 0x20, 0x19, 0xC3, 0x9B, 0x47, 0x77, 0x3A, 0xE0, 0xB9, 0x2E, 0xC6, 0x34,
-    0xD9, 0xB9, 0x97, 0x3A, 0x1F, 0x41, 0x8C, 0xB0, 0x99, 0x30, 0x8E, 0x0C, 0x96, 0xA2, 0x3D, 0x22,
-    0x40, 0x94, 0xD8, 0x0D, 0x1B, 0x2C, 0x4E, 0x32, 0xBB, 0x0D, 0x3C, 0xEE, 0x59, 0x66, 0x8C, 0x15,
-    0xCD, 0x9B, 0x62, 0x15, 0x90, 0xA3, 0x29, 0xFA, 0x7B, 0xA9, 0xC5, 0x96, 0x20, 0x63, 0xE9, 0x36,
-    0x03, 0xC9, 0xFB, 0x26, 0x87, 0x64, 0x58, 0x1E, 0x58, 0xBF, 0x3E, 0x8D, 0x2A, 0x0C, 0x07, 0xE5,
-    0x9F, 0x93, 0x5C, 0x77, 0xC5, 0x72, 0x51, 0x96, 0x56, 0x29, 0x6A, 0x66, 0x13, 0xDD, 0xA8, 0xE2,
-    0x56, 0x9A, 0x65, 0x72, 0xE9, 0x42, 0x25, 0xA2, 0xA9, 0x58, 0xA1, 0xB8, 0xD2, 0x28, 0xE3, 0xA1,
-    0xBB, 0x1F, 0x56, 0x2D, 0xAB, 0x94, 0x5D, 0x38, 0x76, 0x8C, 0x7A, 0x25, 0x78, 0x4D, 0xB9, 0x9B,
-    0x03, 0x67, 0x00, 0x2B, 0xF4, 0x71, 0x6C, 0xF8, 0x9E, 0x9E, 0x45, 0x12, 0xB9, 0x50, 0xCB, 0x84,
-    0x5A, 0x1E, 0x74, 0x60, 0x41, 0x95, 0xE7, 0xB5, 0x24, 0xAF, 0xE5, 0x3F, 0x2D, 0xFB, 0x69, 0xB9,
-    0x5D, 0x4B, 0xEC, 0x5A, 0x56, 0xD7, 0x52, 0xBA, 0xCA, 0x79, 0x5A, 0xC6, 0xD3, 0xF2, 0x9D, 0x96,
-    0xED, 0xB4, 0x5C, 0xA7, 0x65, 0x3A, 0xE7, 0xE9, 0x5B, 0x77, 0xD6, 0x50, 0x1E, 0x9E, 0xE3, 0x2A,
-    0x95, 0xA9, 0xB4, 0x3C, 0xA5, 0xB2, 0x94, 0xE4, 0x28, 0x95, 0xA1, 0x54, 0x7E, 0xD2, 0xFA, 0xC0,
-    0x56, 0xBB, 0x9A, 0x24, 0x58, 0xA5, 0x1C, 0x18, 0xAC, 0x48, 0x4E, 0x52, 0x19, 0xC9, 0x19, 0xF6,
-    0x9A, 0x8C, 0x6B, 0x36, 0x2A, 0xC7, 0xCA, 0xF6, 0xE4, 0xC8, 0x78, 0xFB, 0x6F, 0xC2, 0x48, 0xBE,
-    0xC7, 0xE1, 0xF9, 0x74, 0xC0, 0x45, 0x04, 0x2F, 0x43, 0xCB, 0xC2, 0x61, 0x95, 0xAD, 0xCD, 0x3B,
-    0xCC, 0xBB, 0xE4, 0xCD, 0x6D, 0xB7, 0xC2, 0xB5, 0xCC, 0xC5, 0x2E, 0x27, 0xB6, 0x8B, 0x9D, 0x6E,
-    0x25, 0xBA, 0x6F, 0xB7, 0xA2, 0x99, 0x3D, 0x64, 0x7E, 0xE5, 0x6D, 0x86, 0x8F, 0xB8, 0x23, 0x05,
-    0x9B, 0x3E, 0x01, 0x1B, 0x1F, 0x5C, 0xB6, 0x7F, 0xEF, 0x5D, 0xF7, 0x32, 0xF2, 0xAE, 0x76, 0x7E,
-    0xB7, 0x1D, 0x6A, 0xAA, 0x7C, 0xAF, 0x7A, 0x99, 0x41, 0xC8, 0x7E, 0x26, 0xE2, 0x9C, 0x84, 0x0F,
-    0xBB, 0xAF, 0xD1, 0x0C, 0xA1, 0xE8, 0x57, 0x97, 0xC2, 0x41, 0x9B, 0xB7, 0x2A, 0x24, 0x9F, 0xAF,
-    0xF2, 0x5D, 0xA0, 0x2A, 0x23, 0xA8, 0x32, 0xA4, 0xC0, 0xFF, 0x09, 0x50, 0x15, 0x10, 0x54, 0x1D,
-    0x26, 0xA8, 0x3A, 0x4E, 0x50, 0xD5, 0x00, 0x54, 0x5D, 0x2B, 0x01, 0xAA, 0x5E, 0x83, 0x7F, 0xB2,
-    0x3F, 0x31, 0xC3, 0x53, 0xA2, 0x84, 0xD9, 0x36, 0x6A, 0x46, 0x50, 0x15, 0x12, 0x54, 0x1D, 0x75,
-    0x66, 0xAC, 0xF7, 0xDD, 0xE1, 0xF0, 0x53, 0x71, 0xDE, 0x86, 0xA5, 0x0C, 0x56, 0x3D, 0x73, 0x74,
-    0x84, 0xD9, 0x92, 0x36, 0xAA, 0xBF, 0x6A, 0xE3, 0x0F, 0xAE, 0xB7, 0xC9, 0xF5, 0x17, 0x9A, 0xE4,
-    0x3F, 0xF8, 0xA4, 0x8B, 0xEA, 0x84, 0x26, 0xA8, 0xB2, 0x34, 0xBC, 0x83, 0xFB, 0x1B, 0xDD, 0x82,
-    0xD6, 0x40, 0x1E, 0x5E, 0x1D, 0xE3, 0xF4, 0x4C, 0x0C, 0x1B, 0x44, 0x64, 0x46, 0xFC, 0x3F, 0x54,
-    0xFB, 0xD0, 0x8C, 0x7B, 0x2D, 0xAC, 0xD8, 0xA1, 0xA9, 0x5A, 0x43, 0x9F, 0x10, 0x0E, 0x2E, 0xDC,
-    0x83, 0x30, 0x66, 0x7A, 0x73, 0x09, 0x0C, 0xFC, 0x7F, 0x71, 0xC7, 0x91, 0x14, 0xCF, 0xC3, 0x27,
-    0x16, 0x18, 0xEC, 0xC8, 0x1E, 0xAA, 0xCB, 0x29, 0x7F, 0x8F, 0xE8, 0x92, 0xF8, 0x0D, 0x92, 0x8E,
-    0xEF, 0x35, 0xE4, 0x28, 0x18, 0xE7, 0x17, 0x57, 0x77, 0x5A, 0x2E, 0x05, 0x6C, 0x17, 0x88, 0xD5,
-    0xBC, 0x8A, 0xF5, 0xB9, 0x64, 0x0A, 0x29, 0x2D, 0xCE, 0xD6, 0xE5, 0x61, 0xAB, 0x33, 0x61, 0x6B,
-    0x76, 0xEE, 0xE4, 0xDC, 0x66, 0x9D, 0xDD, 0xB1, 0xEB, 0xE5, 0x00, 0xD3, 0xFE, 0x32, 0xE5, 0x5E,
-    0xE3, 0x66, 0xA3, 0x02, 0x2C, 0x9B, 0x4A, 0xC2, 0xF7, 0x1B, 0xF1, 0x3F, 0x69, 0x91, 0xE4, 0x91,
-    0x59, 0x4F, 0x0F, 0xA8, 0x60, 0xF1, 0x2D, 0x85, 0x05, 0x5E, 0x53, 0x20, 0x02, 0x33, 0x89, 0x07,
-    0x12, 0xAB, 0x40, 0x39, 0x52, 0x60, 0x76, 0x72, 0x67, 0x27, 0x02, 0x9A, 0x3D, 0x2B, 0x09, 0x9A,
-    0xAC, 0xBB, 0x9E, 0x94, 0x50, 0xE0, 0x50, 0x50, 0x0D, 0x34, 0x62, 0xE2, 0x96, 0x47, 0xF7, 0x43,
-    0x17, 0x5D, 0x32, 0xC4, 0xF7, 0xF4, 0xCB, 0xEF, 0x06, 0xBF, 0x3C, 0xA0, 0x2E, 0xDE, 0x2D, 0xDC,
-    0x7B, 0xF2, 0x8A, 0xC8, 0x2B, 0xB8, 0xE7, 0xC1, 0x21, 0x6E, 0xF7, 0x6E, 0xCB, 0x26, 0x89, 0xCA,
-    0xE8, 0xF5, 0xCA, 0xFF, 0xA0, 0x71, 0xEA, 0x53, 0xDA, 0x59, 0xA4, 0x8E, 0xA2, 0xD7, 0xB9, 0x4D,
-    0x9A, 0x94, 0x26, 0x30, 0x0C, 0x68, 0x47, 0xFF, 0x6B, 0xF9, 0xDD, 0x59, 0xB2, 0xFC, 0x80, 0x0D,
-    0x71, 0xF8, 0x7C, 0x29, 0x47, 0xDD, 0x72, 0x8F, 0xC5, 0xC3, 0xD4, 0x9E, 0x29, 0xC3, 0x5F, 0x55,
-    0x4F, 0x48, 0xF5, 0xDD, 0x76, 0x94, 0xA2, 0xEB, 0xEC, 0x89, 0x3E, 0x6C, 0x48, 0xFE, 0xB2, 0x36,
-    0xBC, 0x73, 0x74, 0xDF, 0x76, 0x94, 0xFC, 0x2F, 0x27, 0x36, 0xAC, 0xB7, 0x62, 0xAC, 0xFD, 0x81,
-    0xD5, 0x7C, 0xE0, 0x1D, 0x25, 0xBB, 0x85, 0x9C, 0x75, 0x43, 0x68, 0x3B, 0xD5, 0xE1, 0xFD, 0xDB,
-    0x22, 0xBB, 0x6F, 0x7C, 0x3F, 0xA8, 0x42, 0x21, 0x9D, 0xE3, 0xDD, 0x9A, 0x0C, 0x0A, 0xC9, 0xEA,
-    0xF2, 0xFC, 0x23, 0x3E, 0xE8, 0xBA, 0x28, 0x70, 0x3C, 0x80, 0x28, 0xDD, 0xCE, 0x8D, 0x2B, 0xBB,
-    0xA7, 0x5B, 0xDB, 0xA7, 0x8C, 0xB2, 0x57, 0xCD, 0xC0, 0xF0, 0x14, 0x2F, 0xB3, 0x17, 0x67, 0xBB,
-    0x43, 0x7A, 0xC7, 0xE9, 0xF5, 0x41, 0x07, 0xB6, 0x88, 0xE8, 0x9E, 0x10, 0x56, 0x27, 0x8B, 0x0A,
-    0x55, 0xD8, 0xEE, 0x5E, 0xD3, 0x39, 0x2E, 0x9D, 0x73, 0xF9, 0x04, 0xF0, 0x9C, 0x75, 0xCE, 0xC2,
-    0xFA, 0xA1, 0x34, 0xEA, 0x0A, 0x34, 0x73, 0x1F, 0x37, 0xC0, 0x72, 0xB5, 0xD7, 0x7B, 0x39, 0x11,
-    0x0F, 0xD5, 0xD6, 0x67, 0x49, 0xBE, 0xA5, 0xDD, 0x95, 0xB9, 0x36, 0x4B, 0x7B, 0xB1, 0x4B, 0xE4,
-    0x97, 0xEB, 0x83, 0xFB, 0xA1, 0x87, 0x0A, 0x17, 0xEF, 0xF8, 0x44, 0x1E, 0x5C, 0x8F, 0x69, 0xA2,
-    0x79, 0x81, 0x5C, 0x07, 0xD6, 0xB4, 0x78, 0x57, 0xEB, 0x7D, 0xDB, 0xD7, 0x0B, 0x6E, 0xB4, 0x58,
-    0xA6, 0x9D, 0x75, 0xCA, 0x4A, 0xB0, 0x07, 0x5B, 0x96, 0x22, 0x23, 0x1F, 0x44, 0xBB, 0xBA, 0xF5,
-    0x25, 0x28, 0x94, 0x1F, 0xDF, 0xBF, 0x8D, 0x4A, 0x77, 0x48, 0x8F, 0xCB, 0x30, 0xE5, 0x11, 0x9B,
-    0x1E, 0x1F, 0x58, 0xA1, 0x00, 0xCD, 0x6D, 0xF1, 0xD7, 0xD6, 0xE9, 0xBC, 0xCE, 0x6B, 0xDD, 0x89,
-    0xD7, 0x3A, 0xCA, 0x43, 0x10, 0x67, 0xB8, 0x04, 0x90, 0xAC, 0x46, 0xB1, 0xA1, 0x28, 0xEC, 0xC5,
-    0xAA, 0x1F, 0x41, 0x81, 0x33, 0xA8, 0x3D, 0xA8, 0x3F, 0x40, 0x03, 0x71, 0x9E, 0x7C, 0x56, 0x48,
-    0x30, 0x4A, 0xB9, 0x6E, 0x89, 0x33, 0xB6, 0xB5, 0xDC, 0xF0, 0x74, 0xB9, 0x0E, 0x0E, 0x9D, 0x17,
-    0x02, 0x8D, 0xA0, 0x26, 0x3D, 0x9D, 0x20, 0x52, 0x9E, 0xB2, 0x7B, 0xE2, 0xA6, 0x1A, 0x72, 0x4C,
-    0x27, 0x3F, 0x00, 0x26, 0xDD, 0xC2, 0x85, 0x57, 0xF0, 0xCE, 0xFE, 0xD2, 0x02, 0x8C, 0xD8, 0x15,
-    0xED, 0xAC, 0x0F, 0x3B, 0x1D, 0xB8, 0x17, 0xD7, 0xD4, 0xE3, 0xBA, 0x57, 0x0B, 0x50, 0x13, 0x7D,
-    0x6E, 0x2E, 0x94, 0x2B, 0x10, 0xB8, 0x5C, 0xE5, 0x70, 0x1C, 0xAD, 0x6B, 0x3E, 0x3C, 0x25, 0xD4,
-    0x8E, 0x39, 0x6D, 0xD6, 0xF1, 0xAB, 0xC3, 0xE2, 0x72, 0x77, 0x45, 0xCE, 0x07, 0x3E, 0x6B, 0x91,
-    0xBD, 0x7D, 0x34, 0x33, 0xF3, 0xFA, 0x48, 0xFE, 0xB9, 0xBC, 0x9E, 0x4F, 0x31, 0x8A, 0x2B, 0xC3,
-    0xC3, 0x98, 0x68, 0x5B, 0x62, 0x08, 0xBD, 0x8E, 0x9F, 0xFB, 0xD3, 0x93, 0xF6, 0x81, 0x27, 0x38,
-    0xDB, 0xD7, 0x47, 0xEC, 0x66, 0x45, 0x04, 0xC9, 0xD1, 0x94, 0xBE, 0x62, 0xAB, 0x85, 0x94, 0x6D,
-    0x5F, 0xC4, 0x0E, 0x41, 0x7E, 0x32, 0x4E, 0xB1, 0xC8, 0xD9, 0xE2, 0xFF, 0xF6, 0x4C, 0xAD, 0x86,
-    0x94, 0x16, 0xE4, 0xB8, 0x6C, 0xBB, 0x78, 0x33, 0x02, 0x74, 0x0A, 0xBE, 0x48, 0x60, 0x1F, 0x69,
-    0x71, 0x54, 0xB5, 0xB4, 0x29, 0x99, 0x0D, 0xDA, 0x3D, 0x85, 0xDA, 0xE0, 0x29, 0x1D, 0x0D, 0x51,
-    0xF9, 0x20, 0x86, 0x43, 0xA7, 0x65, 0xCC, 0x7F, 0x6F, 0x5B, 0xB9, 0xB7, 0x53, 0x89, 0xBE, 0xA8,
-    0xE5, 0x04, 0x24, 0xBD, 0x8C, 0x0B, 0xB7, 0x78, 0xB1, 0x3F, 0x3C, 0xCB, 0x86, 0xBA, 0xC9, 0x96,
-    0xF1, 0x18, 0xCD, 0x11, 0x0F, 0x2C, 0x62, 0x34, 0xAC, 0xE5, 0xE1, 0x59, 0x30, 0xB6, 0x85, 0x68,
-    0x8E, 0xD9, 0x56, 0x9F, 0x98, 0xDB, 0x17, 0x0A, 0x52, 0x72, 0xE3, 0xDE, 0xBF, 0x6B, 0x05, 0xA6,
-    0xF9, 0xAC, 0xF1, 0x92, 0x1D, 0x92, 0xC2, 0x52, 0x14, 0x96, 0xA0, 0xB0, 0xF4, 0x84, 0x25, 0x27,
-    0x2C, 0x35, 0x61, 0x89, 0x09, 0x4B, 0x4B, 0x58, 0xCC, 0x43, 0x4A, 0x42, 0x79, 0xAC, 0x89, 0xA5,
-    0x23, 0x06, 0x06, 0x4B, 0xA9, 0x08, 0x4B, 0x44, 0x50, 0x71, 0xDC, 0x63, 0xA9, 0xFF, 0x45, 0xC6,
-    0xE7, 0xCB, 0xDE, 0x1B, 0x7B, 0x4D, 0xAF, 0xDC, 0x12, 0xF7, 0xCB, 0x81, 0x39, 0xB5, 0xCF, 0xDD,
-    0x70, 0x99, 0x2C, 0xDE, 0x43, 0xAB, 0x1F, 0xCA, 0xBD, 0xAE, 0x68, 0xBC, 0xFE, 0x8B, 0xD6, 0x43,
-    0x42, 0xF4, 0xBB, 0xA0, 0x0D, 0x26, 0xBB, 0xD6, 0x8D, 0xAE, 0x1A, 0x45, 0xBB, 0xBA, 0x6E, 0x62,
-    0x83, 0xBE, 0x43, 0x9B, 0xC0, 0xFF, 0x01, 0x65, 0x54, 0xBF, 0x8F, 0x1B, 0x45, 0x14, 0xFE, 0xD6,
-    0x6B, 0x7B, 0x93, 0x5B, 0x29, 0x7B, 0x85, 0x0F, 0x8E, 0xE4, 0xEE, 0xF6, 0x0A, 0x0B, 0x45, 0x39,
-    0xDB, 0x7B, 0xC5, 0x21, 0x39, 0xB0, 0xE7, 0x9D, 0x06, 0x21, 0x84, 0x10, 0x16, 0xCA, 0x51, 0xBB,
-    0x48, 0x75, 0x29, 0x70, 0xB1, 0x91, 0x8C, 0x70, 0xD8, 0x81, 0x86, 0xD6, 0x7F, 0x82, 0x8B, 0x03,
-    0x81, 0x85, 0x60, 0x8B, 0x4B, 0x74, 0x42, 0x49, 0x76, 0x44, 0x43, 0x41, 0x33, 0xC9, 0x5F, 0xB0,
-    0x12, 0xA1, 0x08, 0xD5, 0x20, 0x1D, 0xC8, 0x02, 0xDB, 0xC3, 0x9B, 0xB5, 0xC9, 0x0F, 0x31, 0xD6,
-    0x8C, 0xE7, 0xED, 0xCC, 0x7C, 0xEF, 0xCD, 0xF7, 0xBE, 0x37, 0x40, 0xC2, 0x7C, 0xE1, 0x48, 0x2B,
-    0x07, 0xEC, 0xA9, 0x97, 0x07, 0x6C, 0x00, 0x6A, 0xA5, 0x05, 0x5C, 0x8D, 0xC0, 0xE3, 0x83, 0x92,
-    0x20, 0xD3, 0x93, 0x69, 0xF4, 0x77, 0x7E, 0x57, 0x8B, 0x51, 0x8B, 0xAC, 0x6C, 0x91, 0xCD, 0xE9,
-    0x2F, 0xD2, 0x2C, 0xD2, 0x66, 0x73, 0xEA, 0xE2, 0xCE, 0x1D, 0x44, 0x53, 0xB8, 0x92, 0xAC, 0x84,
-    0x65, 0x3C, 0x41, 0xD9, 0x2C, 0xB4, 0x6C, 0x19, 0xB9, 0x79, 0xE4, 0xC8, 0xB2, 0xC5, 0x2E, 0xB3,
-    0x4C, 0x7E, 0x98, 0xDB, 0xD2, 0x67, 0x0D, 0xB3, 0x84, 0x40, 0x9E, 0xA6, 0x69, 0xFF, 0x34, 0x8D,
-    0x64, 0x61, 0xBA, 0xBF, 0x9E, 0x7B, 0x5F, 0xCA, 0x8E, 0xC7, 0x4E, 0x43, 0x63, 0x0E, 0x1C, 0xD1,
-    0x89, 0xE0, 0xCD, 0xE0, 0x2A, 0x34, 0x1B, 0x61, 0x7B, 0xFD, 0xD2, 0xF6, 0x76, 0xA3, 0x19, 0x86,
-    0x61, 0x6D, 0xDD, 0x78, 0xFE, 0x40, 0x78, 0x3F, 0xE7, 0xF6, 0x23, 0x05, 0x65, 0xA2, 0xA5, 0xD8,
-    0x6D, 0x85, 0x52, 0x8E, 0xD8, 0x61, 0x9D, 0x8F, 0x11, 0xCC, 0x50, 0x1D, 0x19, 0xC8, 0xF3, 0x60,
-    0x3E, 0x68, 0x8D, 0x5D, 0x8C, 0x5D, 0xD9, 0xC4, 0x10, 0x0F, 0x91, 0x21, 0xC1, 0x6B, 0x70, 0xA4,
-    0xA7, 0x3C, 0x65, 0xAB, 0x52, 0x6E, 0x8B, 0x0E, 0x76, 0xE1, 0xB2, 0x48, 0x24, 0xE2, 0x33, 0x0C,
-    0x10, 0xC2, 0x47, 0xE9, 0x7F, 0xEB, 0x74, 0x61, 0x04, 0xDC, 0x15, 0x16, 0x45, 0x6A, 0xCF, 0xFE,
-    0xA3, 0xC8, 0x12, 0x7B, 0x22, 0xE2, 0x36, 0xB3, 0x68, 0xDE, 0xC6, 0x9B, 0x2C, 0x62, 0x7D, 0x73,
-    0xF9, 0x45, 0x32, 0x27, 0x18, 0xF3, 0x1B, 0xE0, 0xA6, 0x21, 0xCE, 0xCB, 0x9D, 0x02, 0xA7, 0x0B,
-    0x0B, 0x01, 0x7D, 0xEC, 0x53, 0xDF, 0x22, 0x2F, 0x36, 0x5C, 0x24, 0x84, 0x78, 0xCC, 0xBF, 0xE7,
-    0x5B, 0xB8, 0x5A, 0x90, 0x60, 0xB3, 0x57, 0x59, 0x94, 0xAF, 0xE1, 0x22, 0x8E, 0x47, 0x93, 0x11,
-    0x6A, 0x04, 0x7C, 0x80, 0x78, 0x43, 0x45, 0x79, 0xC0, 0xB1, 0x34, 0x30, 0x60, 0x89, 0x08, 0x58,
-    0x05, 0x11, 0x4F, 0x78, 0x84, 0x25, 0x95, 0x44, 0xB3, 0x43, 0x34, 0xE7, 0x44, 0xF3, 0xCB, 0xC4,
-    0x56, 0x98, 0xCF, 0x3B, 0x14, 0x4B, 0xCF, 0x80, 0x73, 0x47, 0x61, 0x8A, 0xE9, 0x2D, 0x95, 0x70,
-    0x97, 0x1F, 0xE2, 0x3E, 0x66, 0xC8, 0xF2, 0x40, 0x6E, 0x37, 0xC2, 0xB0, 0x20, 0x55, 0xAB, 0xC3,
-    0x23, 0xB5, 0x8F, 0xB4, 0x87, 0xEE, 0x3A, 0x63, 0xBD, 0x9F, 0xF8, 0xA7, 0xFF, 0x60, 0xB3, 0x08,
-    0xEC, 0xCC, 0x35, 0xD9, 0xF0, 0x67, 0xF0, 0xD4, 0x0B, 0xE2, 0x78, 0x6F, 0x25, 0x8E, 0x67, 0xAC,
-    0x3B, 0x79, 0xC1, 0x7A, 0x64, 0x58, 0x5F, 0xA3, 0xA9, 0x73, 0x7E, 0xD5, 0x5B, 0x9C, 0x36, 0x13,
-    0x55, 0x77, 0xB9, 0xE1, 0x46, 0x13, 0x3D, 0xB8, 0x36, 0xF9, 0x26, 0xD1, 0xB3, 0x8D, 0xA3, 0x1B,
-    0x91, 0x5E, 0xD0, 0xBC, 0xF8, 0x3E, 0x3B, 0x9E, 0x9C, 0x14, 0x2A, 0xEB, 0x47, 0x8B, 0xFC, 0xB6,
-    0x16, 0x5D, 0x1F, 0x45, 0x40, 0xB3, 0xE5, 0x06, 0x33, 0xD5, 0x5A, 0x5C, 0x9B, 0x4C, 0x26, 0xBC,
-    0x30, 0x87, 0x04, 0x4D, 0x3A, 0x73, 0xA6, 0x94, 0x97, 0x15, 0x75, 0xAB, 0x66, 0x72, 0x40, 0x51,
-    0x98, 0xB8, 0x1C, 0xE2, 0xC2, 0x23, 0xB3, 0x59, 0x24, 0x08, 0xA0, 0xD0, 0x8B, 0x0C, 0xD2, 0x92,
-    0x4B, 0xE6, 0x25, 0xEA, 0x46, 0x6A, 0xF1, 0x72, 0xA9, 0x38, 0xC1, 0x9F, 0x9F, 0x08, 0x57, 0x60,
-    0xA6, 0x95, 0xE9, 0xAB, 0xCD, 0x6D, 0xEE, 0x17, 0x38, 0x94, 0x85, 0xFD, 0x36, 0x52, 0xA2, 0xEB,
-    0x78, 0x32, 0xA2, 0xF1, 0x8D, 0xA3, 0xB4, 0x8F, 0xF1, 0xDD, 0x23, 0x99, 0x69, 0x51, 0xA9, 0x98,
-    0xAA, 0xE8, 0x3F, 0x66, 0xDD, 0xCF, 0x51, 0xE6, 0x81, 0xF0, 0xF0, 0x16, 0x5F, 0x47, 0x95, 0xB5,
-    0x0A, 0x45, 0xEC, 0x90, 0xD3, 0x21, 0x09, 0x61, 0xE3, 0xE8, 0x28, 0xD0, 0x0B, 0x42, 0x22, 0x16,
-    0xE8, 0xF2, 0xCF, 0xF4, 0x65, 0x4A, 0x70, 0xE6, 0x2A, 0x9F, 0x17, 0x6E, 0x1C, 0x55, 0xB0, 0x97,
-    0x2D, 0xD9, 0xEB, 0x90, 0x74, 0x7D, 0x6C, 0xE3, 0xA4, 0x88, 0xC8, 0x67, 0x41, 0x30, 0x8C, 0x0E,
-    0x1F, 0x44, 0xED, 0x07, 0xE5, 0x7E, 0xED, 0x98, 0x00, 0x16, 0xD0, 0x3C, 0x61, 0xCF, 0xD2, 0x48,
-    0x11, 0x75, 0xD1, 0xF5, 0xB5, 0xC6, 0xE5, 0xC9, 0xB7, 0x2B, 0x0A, 0xE7, 0x86, 0x7B, 0xEC, 0x34,
-    0x4D, 0x19, 0x85, 0x83, 0x75, 0xCA, 0x79, 0x94, 0xEF, 0xC9, 0x92, 0x20, 0x46, 0x2E, 0xC2, 0x9D,
-    0xD7, 0xA3, 0x85, 0xBA, 0xA7, 0xE5, 0x17, 0xBF, 0x33, 0xA3, 0xA2, 0x35, 0xE3, 0x84, 0x3C, 0xA2,
-    0x7C, 0xC1, 0x9E, 0x37, 0x3C, 0x3D, 0x6D, 0x06, 0xB9, 0xA9, 0xBD, 0x21, 0x48, 0x38, 0x4B, 0xCE,
-    0xED, 0xE9, 0x96, 0xA7, 0xCF, 0xB6, 0x13, 0x55, 0xAB, 0x72, 0x6B, 0xB4, 0xEE, 0x4D, 0xE3, 0x40,
-    0xAB, 0x76, 0x20, 0x61, 0x4A, 0xE2, 0x42, 0xB9, 0x75, 0x3F, 0x99, 0xD7, 0x76, 0x8B, 0x9B, 0x70,
-    0x9F, 0x98, 0xF0, 0xE8, 0xF6, 0x9A, 0xEA, 0x47, 0x3D, 0xB5, 0x4E, 0xAA, 0xA9, 0xA9, 0xFA, 0xBE,
-    0xAC, 0x7C, 0x45, 0x24, 0x6F, 0x54, 0xC8, 0x5F, 0x0F, 0x23, 0x90, 0xDF, 0x1A, 0x1E, 0xD1, 0xD0,
-    0x7F, 0x4C, 0x00, 0xCB, 0x81, 0xF6, 0x95, 0xFB, 0x25, 0x8E, 0x4D, 0x10, 0x71, 0x5D, 0xE0, 0x86,
-    0xD5, 0x85, 0xBC, 0xF8, 0x35, 0xFA, 0x05, 0xC0, 0x6F, 0xD6, 0x8D, 0x4A, 0x5A, 0x80, 0x02, 0xA7,
-    0x05, 0x89, 0x9F, 0x80, 0xC1, 0x0A, 0xE2, 0x94, 0x9E, 0x91, 0xD2, 0xD8, 0x48, 0xB6, 0xF3, 0x10,
-    0xA9, 0x67, 0xB2, 0xEE, 0xC8, 0x22, 0xF7, 0x40, 0x8D, 0xB5, 0xA4, 0xC7, 0x7D, 0x59, 0x1F, 0xA1,
-    0x77, 0x45, 0x46, 0xB8, 0x22, 0xD1, 0x3B, 0x40, 0x30, 0x72, 0x54, 0xC0, 0x0F, 0x30, 0xB6, 0x59,
-    0xE7, 0x1D, 0xE1, 0xFE, 0x22, 0x3A, 0xEF, 0xE7, 0xE3, 0x46, 0xDF, 0xE4, 0xDE, 0x61, 0x36, 0xF3,
-    0x71, 0xB8, 0xAC, 0x35, 0x11, 0xD1, 0xAF, 0x42, 0xB3, 0x4D, 0xB1, 0xF3, 0xDD, 0xDE, 0x93, 0xD7,
-    0x63, 0x9B, 0x58, 0xF1, 0x7F, 0x60, 0xD7, 0xFF, 0x14, 0xFD, 0xB1, 0xA4, 0x91, 0xE6, 0x35, 0xD2,
-    0x48, 0x24, 0x5E, 0x11, 0x25, 0xBE, 0x52, 0x50, 0x6A, 0x3A, 0x01, 0x38, 0xC2, 0x7B, 0xFA, 0xD1,
-    0x02, 0x96, 0xD6, 0x94, 0x6B, 0xBA, 0x89, 0xB9, 0x11, 0xCA, 0xE6, 0x39, 0x89, 0x5B, 0x8C, 0x22,
-    0x74, 0x17, 0x13, 0xD2, 0x45, 0xA6, 0x47, 0xCF, 0x15, 0x9D, 0x68, 0x3D, 0xA7, 0x3E, 0x7B, 0x71,
-    0x6E, 0x65, 0xB4, 0x41, 0xBA, 0x5A, 0x8F, 0x1C, 0xD1, 0x7A, 0x3B, 0xD3, 0x9A, 0xB5, 0x61, 0x65,
-    0x53, 0xBC, 0xD4, 0xCC, 0xB2, 0xC1, 0xA2, 0xA3, 0xCE, 0x13, 0x3A, 0x4B, 0xF2, 0x33, 0xA9, 0x30,
-    0xA5, 0x0E, 0xB6, 0xDA, 0xB3, 0x7B, 0x3C, 0x99, 0x9C, 0x65, 0x4B, 0x74, 0xF3, 0x46, 0x60, 0xED,
-    0xA4, 0x9D, 0xA6, 0x4A, 0xE5, 0xF7, 0xF2, 0x7A, 0xAF, 0x9A, 0x6E, 0xC5, 0x87, 0x79, 0x1B, 0x61,
-    0xB7, 0xCA, 0xD0, 0xC0, 0x59, 0x3B, 0x4E, 0xCF, 0xEB, 0x6B, 0x79, 0x18, 0xC7, 0x71, 0x9A, 0xDE,
-    0x96, 0x97, 0x31, 0x3C, 0x08, 0xE3, 0x76, 0x1A, 0xAB, 0x1F, 0xCF, 0xEB, 0x37, 0x69, 0xF3, 0x7E,
-    0x88, 0xD5, 0x66, 0x23, 0x93, 0xF6, 0xDA, 0xF9, 0x73, 0x28, 0x8A, 0x86, 0xB9, 0xF0, 0x86, 0x5E,
-    0x63, 0xA7, 0x41, 0xCF, 0xCD, 0xF5, 0xDA, 0x66, 0xF3, 0x2F, 0xD5, 0x1A, 0xAA, 0x30, 0x56, 0xED,
-    0x34, 0x8F, 0xFF, 0xC8, 0x7B, 0xDD, 0x5E, 0xF3, 0xD4, 0xAF, 0x37, 0x61, 0x30, 0xEA, 0x04, 0x50,
-    0xA5, 0x6C, 0x36, 0x0A, 0xEB, 0x3A, 0x3D, 0xD9, 0x83, 0xFD, 0x46, 0xBD, 0xB1, 0xBF, 0x35, 0xF2,
-    0x18, 0x29, 0xF5, 0x5D, 0xFB, 0xA4, 0x24, 0x4B, 0xF9, 0x85, 0x74, 0xB7, 0xFE, 0x2F, 0xD5, 0x7C,
-    0x5D, 0x8C, 0xDE, 0xD6, 0x99, 0xDE, 0xE1, 0x47, 0xCD, 0x30, 0x16, 0x13, 0x51, 0x05, 0xAC, 0x78,
-    0xAB, 0xB1, 0xC4, 0x5C, 0x14, 0x68, 0x9A, 0x4A, 0x66, 0x2E, 0x5C, 0x40, 0xDB, 0xCE, 0x88, 0x94,
-    0x04, 0xAC, 0x2F, 0x0C, 0xD4, 0x73, 0xA1, 0x89, 0x81, 0x06, 0x85, 0x72, 0xB1, 0x37, 0xF5, 0xB6,
-    0x1D, 0x5F, 0x08, 0x0B, 0x01, 0x2B, 0x8B, 0xB4, 0x74, 0xE1, 0x0B, 0x03, 0x9B, 0x69, 0x11, 0x67,
-    0x2F, 0x8C, 0x85, 0x7D, 0x61, 0x14, 0x6B, 0xB9, 0xC5, 0x08, 0x0B, 0x61, 0x2B, 0x14, 0xB2, 0x48,
-    0x4B, 0x40, 0x5C, 0xC0, 0xDD, 0x9A, 0x4E, 0xE2, 0xF8, 0xC2, 0x68, 0xCD, 0xD8, 0x72, 0xBC, 0x6B,
-    0xB5, 0x3B, 0x74, 0x4C, 0x27, 0x9C, 0x11, 0xC9, 0xD3, 0xE7, 0x79, 0x0F, 0xF9, 0x7D, 0xDF, 0xC8,
-    0x92, 0x63, 0xFD, 0x7A, 0x3B, 0xCE, 0x77, 0x98, 0x19, 0x7D, 0x3C, 0x3C, 0xEF, 0x7B, 0xDE, 0x9F,
-    0xE7, 0xFD, 0x39, 0x54, 0x4A, 0x7E, 0x34, 0x87, 0x30, 0xC2, 0xE0, 0x65, 0x18, 0x46, 0xB9, 0xEA,
-    0xFF, 0xAE, 0x75, 0xA1, 0x62, 0x0E, 0x5E, 0x69, 0xE7, 0xCA, 0x2F, 0x46, 0x99, 0x0A, 0xF2, 0x51,
-    0xA2, 0x42, 0x7E, 0x4D, 0x86, 0x58, 0x06, 0x5D, 0x29, 0x95, 0x9E, 0x7E, 0xB1, 0x9F, 0x89, 0x83,
-    0xD5, 0x71, 0xA2, 0x56, 0x6D, 0x55, 0xA3, 0x46, 0x6D, 0x53, 0x76, 0xA3, 0x16, 0x94, 0xDF, 0x9D,
-    0x6E, 0x54, 0xAA, 0x75, 0x83, 0x7F, 0xAE, 0x1E, 0xC2, 0x3F, 0xD7, 0x31, 0x86, 0x0A, 0x83, 0x8A,
-    0xB6, 0xDC, 0xED, 0x47, 0xFA, 0x98, 0x39, 0x0B, 0x38, 0x2C, 0xD8, 0x8D, 0x93, 0xCD, 0x3B, 0xB5,
-    0x9D, 0x3C, 0xEC, 0x56, 0x76, 0x82, 0x07, 0x91, 0x70, 0x19, 0x7E, 0xF3, 0xB2, 0xE2, 0x17, 0xF1,
-    0xC8, 0xCB, 0x71, 0x89, 0xA7, 0x79, 0x15, 0x06, 0xB7, 0x52, 0x71, 0xC2, 0x21, 0xC2, 0x90, 0xF2,
-    0x9B, 0x1A, 0x4B, 0x72, 0xF4, 0x7F, 0xD4, 0x51, 0xA0, 0x3F, 0xAD, 0xD5, 0xF0, 0x93, 0xF2, 0xF1,
-    0xA0, 0x4D, 0x39, 0x05, 0x86, 0x6D, 0x6A, 0x42, 0x51, 0x4E, 0x8A, 0x72, 0x52, 0x94, 0x81, 0x22,
-    0x9B, 0x14, 0x61, 0x98, 0x50, 0x14, 0x26, 0xA4, 0x88, 0x43, 0x1A, 0xA9, 0x6B, 0x29, 0xB2, 0xDA,
-    0x61, 0x5E, 0x9B, 0xC3, 0x5C, 0x87, 0xAF, 0xA4, 0x7A, 0xD8, 0x22, 0x35, 0x22, 0x23, 0x82, 0x2B,
-    0x1D, 0xEF, 0x48, 0xF9, 0x95, 0x58, 0x61, 0x99, 0xFB, 0x0C, 0x41, 0x41, 0x3E, 0x66, 0x9A, 0xAE,
-    0x79, 0x1B, 0x99, 0x26, 0xCF, 0x19, 0x0F, 0x71, 0xBF, 0x8A, 0x45, 0x15, 0x94, 0xD8, 0x78, 0x97,
-    0xD4, 0x5B, 0xBA, 0x55, 0x53, 0x3F, 0xB3, 0xD8, 0x8D, 0xE0, 0x4A, 0xA3, 0x2E, 0x60, 0x29, 0x8D,
-    0x6A, 0xAC, 0x46, 0xBD, 0xC4, 0x45, 0x59, 0x1A, 0x2B, 0xE1, 0x8C, 0x71, 0x47, 0xAE, 0x25, 0x58,
-    0x0A, 0x1E, 0x17, 0x16, 0x16, 0x9E, 0x1D, 0x28, 0xB7, 0x0C, 0x23, 0xB7, 0x00, 0x0B, 0x33, 0x7F,
-    0x3D, 0x8E, 0x46, 0xBA, 0x1E, 0xB8, 0x11, 0xA9, 0xB8, 0x35, 0xFC, 0xF6, 0x0B, 0xB3, 0x42, 0x2E,
-    0x90, 0x1F, 0x72, 0x80, 0x1F, 0x32, 0x41, 0x1B, 0x16, 0x90, 0x03, 0xD8, 0x52, 0xA1, 0x9F, 0xE4,
-    0xFB, 0xA0, 0x3E, 0xC5, 0x0A, 0xD5, 0x43, 0x2E, 0x44, 0x02, 0xD2, 0xCA, 0xCF, 0x16, 0xEB, 0xCE,
-    0xCE, 0xED, 0x81, 0x28, 0x87, 0xB4, 0x4C, 0x7D, 0xC9, 0x6E, 0x26, 0x1F, 0x07, 0xB4, 0x80, 0xC7,
-    0xF2, 0x9C, 0xE1, 0x59, 0x7E, 0xFE, 0xF9, 0xE7, 0x0D, 0xCF, 0xEA, 0xCC, 0x6D, 0xAB, 0xB8, 0x45,
-    0x93, 0xE5, 0x36, 0x44, 0xA2, 0x24, 0xFF, 0xB4, 0x5E, 0xC1, 0xAF, 0xF3, 0xB2, 0xAF, 0xEA, 0x98,
-    0xB9, 0x9C, 0x75, 0x84, 0x53, 0xA5, 0xB9, 0x14, 0x7C, 0x8E, 0xB2, 0x72, 0x2E, 0x49, 0x8D, 0x32,
-    0xEF, 0x2A, 0xE6, 0xB3, 0x33, 0xBF, 0xC0, 0xAE, 0x39, 0x49, 0x90, 0xE3, 0x49, 0x6E, 0x14, 0x66,
-    0x21, 0x64, 0x0B, 0x4F, 0xC5, 0x6F, 0xFB, 0xCD, 0xE5, 0x3C, 0x9E, 0x9F, 0x26, 0x61, 0xAD, 0xD2,
-    0x03, 0x5A, 0x85, 0xE5, 0xAC, 0x5E, 0xAB, 0x55, 0x90, 0x41, 0xB2, 0x13, 0x35, 0x11, 0xCB, 0xC7,
-    0x64, 0xEF, 0x5A, 0x87, 0x8B, 0xF0, 0x4A, 0x91, 0x35, 0xA8, 0x5B, 0x2B, 0x62, 0x23, 0xF2, 0x16,
-    0x66, 0xF6, 0xD4, 0x25, 0xFE, 0xF8, 0x95, 0x6E, 0x85, 0x82, 0x84, 0x1F, 0xD2, 0xE6, 0x95, 0x58,
-    0x84, 0xE6, 0x5E, 0xE7, 0x72, 0xF1, 0x0B, 0x4C, 0xE1, 0x17, 0x32, 0x45, 0x90, 0xCB, 0x14, 0x5C,
-    0x8B, 0xCD, 0x8B, 0x8E, 0xFC, 0xEE, 0x80, 0x5E, 0x6B, 0xC1, 0xDF, 0x37, 0x49, 0xF4, 0xAD, 0x29,
-    0x63, 0x3F, 0xC4, 0x09, 0x07, 0x3C, 0x1F, 0xF2, 0x0E, 0xD6, 0x1B, 0x65, 0x5C, 0x09, 0xAB, 0x40,
-    0x97, 0xE1, 0x44, 0x6E, 0x45, 0xF4, 0xF1, 0x35, 0x8E, 0xC2, 0xCA, 0xB1, 0x55, 0x33, 0xB4, 0x53,
-    0x54, 0xDC, 0x8E, 0xCF, 0xB2, 0x65, 0x0B, 0x21, 0x4F, 0xB8, 0xE7, 0x21, 0xA1, 0xF7, 0x1C, 0xC7,
-    0x4B, 0xD4, 0xE2, 0xF8, 0x4D, 0xA3, 0x3C, 0xBC, 0x37, 0x4D, 0xF9, 0x17, 0x2D, 0x8B, 0xD3, 0x6E,
-    0x4D, 0xD9, 0x70, 0x1A, 0x4A, 0x87, 0x2D, 0x42, 0x64, 0x69, 0xD9, 0x66, 0x4C, 0x0C, 0x41, 0x8A,
-    0x73, 0x8A, 0x92, 0x5F, 0x8E, 0x1F, 0xE9, 0xF1, 0x5E, 0x65, 0x9B, 0x3F, 0x18, 0x5D, 0xD8, 0x33,
-    0xB5, 0x9E, 0x47, 0x60, 0xA1, 0xE2, 0x76, 0x56, 0x5F, 0x26, 0xED, 0x90, 0x1B, 0xA1, 0x0B, 0xEB,
-    0xE1, 0xA4, 0xB0, 0x40, 0x32, 0x06, 0x1D, 0xC5, 0xEA, 0xBF, 0xE1, 0x61, 0xF1, 0xA9, 0x0F, 0xF0,
-    0xE0, 0xF4, 0xB1, 0x43, 0x18, 0xF5, 0x53, 0x94, 0x14, 0x5D, 0x39, 0x15, 0x04, 0x8A, 0xB6, 0x6A,
-    0xC4, 0xCD, 0xA0, 0x50, 0x63, 0xC4, 0x7A, 0x30, 0x13, 0x78, 0x1F, 0xC3, 0x72, 0xE9, 0x4B, 0x9A,
-    0x7B, 0xAC, 0x60, 0x6A, 0xBD, 0x08, 0x0F, 0xF7, 0xB3, 0x33, 0x94, 0x75, 0x10, 0x68, 0xBD, 0x3C,
-    0x98, 0x30, 0x3D, 0xD2, 0x45, 0xDC, 0x5A, 0xE9, 0x0A, 0x96, 0xBE, 0xC0, 0x19, 0xCE, 0x29, 0x50,
-    0x5A, 0x2A, 0xA7, 0x81, 0x31, 0xC6, 0x56, 0x41, 0xC9, 0x5B, 0x8F, 0xA2, 0xBB, 0x97, 0xCB, 0x3E,
-    0xC6, 0x5B, 0x48, 0x52, 0x9C, 0x0F, 0x56, 0x2C, 0xE0, 0x34, 0x0B, 0xF8, 0xFC, 0x09, 0x89, 0x8C,
-    0xCB, 0xC1, 0xFE, 0x4C, 0x18, 0x5F, 0x0B, 0xA1, 0x85, 0xB1, 0xA3, 0x4A, 0xA4, 0x86, 0x84, 0xB6,
-    0xFC, 0xE2, 0xA8, 0x1D, 0xC4, 0x2D, 0x4C, 0x38, 0xC6, 0x09, 0x89, 0x4B, 0x69, 0x78, 0xF1, 0x65,
-    0xB7, 0x54, 0x22, 0x69, 0x54, 0x4A, 0x92, 0xD8, 0x92, 0x38, 0x10, 0x1A, 0x70, 0x69, 0x7C, 0x0C,
-    0xAC, 0x7D, 0x7A, 0x99, 0xE6, 0x9E, 0x2E, 0x66, 0xD4, 0x4D, 0xF1, 0xBA, 0x9C, 0x1A, 0x57, 0xCC,
-    0x5A, 0x28, 0x2A, 0x36, 0xBF, 0xE3, 0x50, 0x47, 0x3D, 0x5A, 0xEF, 0xBD, 0x1C, 0xE6, 0x39, 0x9C,
-    0x81, 0xE0, 0x58, 0x05, 0x06, 0x3B, 0x03, 0x59, 0x4E, 0x82, 0xC9, 0xBD, 0x25, 0xC8, 0x7B, 0x40,
-    0x79, 0x5C, 0xE0, 0xFF, 0x3B, 0xCB, 0x45, 0x97, 0xB4, 0xE4, 0xF4, 0x52, 0x3E, 0xDC, 0x43, 0x15,
-    0x37, 0x23, 0x18, 0x4E, 0x4A, 0xB5, 0x8A, 0x37, 0x52, 0xDC, 0x51, 0x3A, 0x62, 0xEF, 0x13, 0x4A,
-    0x68, 0x34, 0xED, 0xC1, 0x3E, 0x14, 0xA1, 0xC2, 0x72, 0xD2, 0x47, 0xB8, 0x85, 0x96, 0x58, 0x6F,
-    0x4D, 0xBA, 0x34, 0xC8, 0xC2, 0x65, 0xD4, 0x40, 0xA8, 0xEC, 0x06, 0xBC, 0xF7, 0x3B, 0x88, 0x5D,
-    0x2A, 0x06, 0x59, 0x43, 0x3C, 0xA8, 0x7F, 0x91, 0x12, 0xDD, 0xF3, 0x61, 0x5D, 0x95, 0xD8, 0x00,
-    0xD1, 0xF9, 0x30, 0x83, 0xDC, 0xC4, 0x3F, 0xA1, 0x78, 0x80, 0xBB, 0x2A, 0x7D, 0xA5, 0x31, 0x93,
-    0x72, 0x88, 0x30, 0x65, 0x1A, 0x81, 0x61, 0x3A, 0x12, 0x41, 0xB5, 0x1B, 0x50, 0x8E, 0x99, 0x6B,
-    0x32, 0x2B, 0xB9, 0xAB, 0x3E, 0x0A, 0x53, 0xE3, 0x1B, 0xCB, 0x9A, 0x0E, 0xC0, 0x93, 0xA9, 0x76,
-    0xCB, 0x34, 0x7B, 0x45, 0x37, 0xE7, 0x65, 0xB6, 0x79, 0x99, 0xE9, 0xA8, 0x8C, 0xC6, 0x10, 0x95,
-    0x62, 0x98, 0xC5, 0x0C, 0xD9, 0x22, 0x0F, 0x8E, 0xC8, 0x83, 0x27, 0xB6, 0xF7, 0x21, 0xB1, 0xBE,
-    0xC7, 0x29, 0x03, 0x5B, 0xBB, 0xD3, 0xAB, 0x1B, 0x10, 0x62, 0xDA, 0x24, 0x1F, 0xB3, 0x86, 0x8A,
-    0x1A, 0xBC, 0x1B, 0x33, 0x72, 0xDC, 0x87, 0x71, 0x97, 0x7A, 0x18, 0xE3, 0x83, 0x77, 0x13, 0xCC,
-    0xC4, 0x4D, 0xA8, 0x7F, 0x06, 0x6A, 0x97, 0x6B, 0xBF, 0x3B, 0x08, 0x76, 0x3A, 0x39, 0xEC, 0x02,
-    0x25, 0xB0, 0x70, 0xAA, 0x11, 0x65, 0xAE, 0x74, 0x2B, 0x9A, 0x17, 0x75, 0xCC, 0x2B, 0xB9, 0x3C,
-    0xB5, 0xD7, 0x2B, 0xCF, 0x09, 0xE4, 0xF2, 0xDF, 0x2F, 0x7B, 0x1E, 0x55, 0xE2, 0xCA, 0xD3, 0x2B,
-    0x82, 0x1F, 0x9A, 0xF0, 0x52, 0x23, 0x66, 0x30, 0xBC, 0x48, 0xC6, 0x86, 0x79, 0xFC, 0xB4, 0x16,
-    0x7F, 0x9D, 0x46, 0x74, 0x49, 0xDC, 0x55, 0xF8, 0x6E, 0x3C, 0x44, 0x73, 0xDD, 0x41, 0xE5, 0xE8,
-    0xC5, 0x80, 0x20, 0x05, 0x16, 0xD0, 0xED, 0xFD, 0xAC, 0x8B, 0xF5, 0x40, 0x04, 0xAC, 0x76, 0xD4,
-    0x8D, 0xF8, 0xBD, 0xB3, 0x83, 0x33, 0x13, 0x4F, 0x57, 0x88, 0xD0, 0xCF, 0xA6, 0xB9, 0x71, 0x64,
-    0xC6, 0xB1, 0x6D, 0xC5, 0x27, 0x04, 0x83, 0x43, 0xD8, 0xD7, 0xE0, 0xC3, 0x14, 0x46, 0xB5, 0xFB,
-    0x2A, 0xCC, 0x93, 0x31, 0x97, 0xD1, 0x83, 0xAA, 0xB7, 0x50, 0xC6, 0x44, 0x4D, 0x6C, 0xD4, 0xBD,
-    0x5D, 0xCF, 0xBD, 0x74, 0x15, 0x06, 0x17, 0xF4, 0xB0, 0x60, 0x5E, 0x84, 0xEE, 0x98, 0xF8, 0xE3,
-    0xB3, 0xA2, 0x55, 0xA5, 0x8C, 0x05, 0xD7, 0x6F, 0xE5, 0xAE, 0xE0, 0x01, 0x5A, 0x44, 0x9B, 0x3E,
-    0x11, 0xFA, 0xC1, 0xD1, 0x8D, 0x88, 0x45, 0x3C, 0x71, 0x7E, 0xFB, 0x45, 0xA6, 0xCF, 0x73, 0x04,
-    0x10, 0x80, 0x68, 0x87, 0xE5, 0x8C, 0xFE, 0x39, 0x60, 0x80, 0xA7, 0xC7, 0x98, 0x15, 0x66, 0x85,
-    0xC8, 0x0C, 0x00, 0xCE, 0x26, 0x2F, 0x61, 0x56, 0xB1, 0xB2, 0xDD, 0x9A, 0xFF, 0x53, 0x7B, 0xB5,
-    0x5A, 0xC0, 0x12, 0xE6, 0xB5, 0xFA, 0xE3, 0x96, 0x56, 0x31, 0xFA, 0x14, 0x8F, 0xDF, 0x97, 0x1E,
-    0xA4, 0x68, 0x1E, 0x8D, 0x4F, 0x9D, 0xAA, 0x69, 0x25, 0x9F, 0x05, 0x1F, 0x55, 0x19, 0xFE, 0x4F,
-    0x57, 0x2E, 0xFF, 0x87, 0xB6, 0xB9, 0x08, 0x2B, 0x32, 0x34, 0x0F, 0x4B, 0x5A, 0xE7, 0x8C, 0x50,
-    0x00, 0x6B, 0x0C, 0x08, 0x52, 0xE6, 0x72, 0xFF, 0x00, 0x0D, 0x74, 0xBD, 0xDB, 0xA6, 0xDE, 0x68,
-    0xFD, 0x68, 0xEF, 0x0D, 0x2E, 0x8F, 0xBD, 0x81, 0xD9, 0x47, 0x42, 0xA6, 0x30, 0xB3, 0xBA, 0xC1,
-    0x27, 0xC4, 0x62, 0x03, 0x62, 0xD1, 0xB6, 0xF4, 0xF4, 0x2B, 0xB5, 0x78, 0x83, 0xC1, 0x27, 0x8C,
-    0xBD, 0x81, 0xD9, 0x47, 0xCC, 0x61, 0x8B, 0x4F, 0xC0, 0x3E, 0xA6, 0xDC, 0xC7, 0xD7, 0xC7, 0x68,
-    0x76, 0x44, 0xC3, 0x18, 0x5C, 0x69, 0x05, 0x2B, 0x47, 0xE2, 0x33, 0x30, 0x4B, 0x90, 0xE3, 0xC6,
-    0xA0, 0xC0, 0x1D, 0x81, 0x58, 0x54, 0x82, 0xAB, 0xA0, 0x80, 0x82, 0x85, 0x39, 0x87, 0x0C, 0x03,
-    0xD1, 0x14, 0xEE, 0x89, 0x13, 0x3C, 0x4B, 0xFC, 0x53, 0x90, 0xE3, 0xC1, 0xEE, 0x7A, 0x4C, 0xAC,
-    0xBC, 0x3E, 0x85, 0xF4, 0x49, 0x8F, 0xD6, 0xB7, 0xE4, 0xDD, 0xBC, 0xDF, 0xED, 0xDD, 0x84, 0x79,
-    0xFA, 0x0D, 0xC3, 0x3B, 0xF1, 0x05, 0x22, 0x95, 0x58, 0x5B, 0xEF, 0x0B, 0xF0, 0x5D, 0x41, 0x83,
-    0xC6, 0x21, 0x24, 0x58, 0x5E, 0x9C, 0x10, 0xAC, 0x3D, 0x4F, 0x92, 0x49, 0x3C, 0x21, 0xFB, 0x60,
-    0xCD, 0xA6, 0x2D, 0xB6, 0x7F, 0x8B, 0x51, 0x45, 0xA6, 0x3E, 0x17, 0x50, 0x7C, 0x89, 0xA8, 0xE2,
-    0x5A, 0xF8, 0x07, 0x77, 0x94, 0x3C, 0x4C, 0x0C, 0x28, 0x9B, 0x3A, 0x8D, 0x01, 0x4B, 0x65, 0xE0,
-    0xF5, 0xD4, 0x33, 0xA7, 0xBC, 0x51, 0xD4, 0x7B, 0xA3, 0x59, 0x2A, 0x8C, 0x2F, 0xFE, 0xF4, 0x2E,
-    0x03, 0x98, 0xFE, 0x27, 0x14, 0x93, 0xE4, 0x90, 0x9E, 0x19, 0x41, 0xC5, 0x70, 0x04, 0xAD, 0x72,
-    0x3A, 0x17, 0x7B, 0xE1, 0x55, 0x84, 0xC4, 0x61, 0xEE, 0x15, 0xDC, 0x14, 0x1F, 0xC2, 0x05, 0xC3,
-    0x9C, 0x71, 0x97, 0xF0, 0x9B, 0x8C, 0x90, 0xB0, 0x24, 0x4C, 0x42, 0x78, 0xEE, 0x38, 0xD2, 0x89,
-    0x5F, 0xA5, 0x4E, 0x27, 0xBA, 0x0F, 0xDA, 0x77, 0xEA, 0x97, 0x85, 0xFB, 0x82, 0x60, 0x65, 0x3B,
-    0x76, 0x2C, 0x45, 0xE6, 0x81, 0x0C, 0xC2, 0x74, 0x04, 0xEE, 0xC2, 0x86, 0x2C, 0x08, 0xBC, 0xA9,
-    0x48, 0x87, 0xCD, 0x2F, 0xE9, 0x67, 0xF9, 0xA5, 0xF8, 0xFF, 0xCA, 0xDA, 0x44, 0xBB, 0x03, 0x71,
-    0x2C, 0x41, 0x25, 0xA8, 0x8E, 0x7F, 0x19, 0xD1, 0x06, 0x2A, 0xF7, 0x14, 0x37, 0xFF, 0x21, 0x1A,
-    0x20, 0x70, 0x06, 0xD2, 0x00, 0xFF, 0x04, 0xA4, 0x32, 0x57, 0x59, 0x90, 0xA7, 0xB0, 0x71, 0x69,
-    0x1A, 0xBE, 0x3C, 0x48, 0x8B, 0x6F, 0x15, 0xA4, 0xFD, 0xCD, 0x00, 0xD2, 0x40, 0x81, 0x8C, 0x4A,
-    0xFC, 0xA1, 0x3A, 0x26, 0xE3, 0x51, 0x19, 0x9F, 0x84, 0x78, 0xBF, 0xAE, 0x9B, 0xE5, 0xEE, 0x0F,
-    0xF4, 0x65, 0x06, 0xDE, 0x91, 0xAC, 0x45, 0x06, 0x31, 0x13, 0xB2, 0x28, 0x38, 0x70, 0x3E, 0x00,
-    0x33, 0x7B, 0xEB, 0xDF, 0x6F, 0xE0, 0xD5, 0x48, 0xC0, 0x13, 0x8F, 0x90, 0xEC, 0x6B, 0x44, 0x89,
-    0x52, 0x64, 0xC5, 0x74, 0x76, 0xC6, 0xAC, 0x2F, 0xEB, 0x8F, 0xC4, 0x89, 0xCC, 0xE9, 0x1F, 0x8B,
-    0xF9, 0xC1, 0x14, 0xE2, 0x48, 0x68, 0x97, 0x49, 0x2B, 0x68, 0x32, 0xCE, 0xA4, 0x32, 0x66, 0xC8,
-    0x13, 0x48, 0xC2, 0xD8, 0xC3, 0xD0, 0x6C, 0xAE, 0x69, 0x24, 0x77, 0x98, 0x20, 0x44, 0xCC, 0x92,
-    0x98, 0x14, 0x31, 0x13, 0x86, 0x7A, 0x89, 0x56, 0x40, 0x3F, 0x02, 0x16, 0x31, 0x4C, 0xBC, 0x83,
-    0x3C, 0xD0, 0xA7, 0xC5, 0x38, 0xF1, 0xA7, 0xFD, 0x7B, 0xB2, 0x9E, 0x8D, 0x7E, 0x3D, 0x83, 0x1B,
-    0x7E, 0xB5, 0xBF, 0xCE, 0x5F, 0x73, 0xDD, 0xD7, 0x5F, 0x1F, 0xEE, 0xC3, 0x33, 0x0D, 0xE3, 0xB1,
-    0x40, 0x76, 0xCF, 0x93, 0xD3, 0x0F, 0x4F, 0x29, 0xAD, 0x0C, 0xB4, 0x3B, 0x21, 0x81, 0x4D, 0xF8,
-    0x9A, 0xE6, 0x4A, 0x21, 0x75, 0x69, 0x04, 0xDA, 0x68, 0x83, 0x7B, 0x84, 0x6A, 0x69, 0xE3, 0x21,
-    0x1F, 0xD0, 0xD0, 0xC6, 0x90, 0xF3, 0x31, 0x98, 0x77, 0x85, 0x21, 0xAA, 0x77, 0x0F, 0xE2, 0x2E,
-    0x0B, 0xD5, 0x3B, 0x08, 0xC3, 0x0C, 0x65, 0x78, 0x21, 0xD6, 0x2C, 0xD6, 0x2B, 0xC2, 0x89, 0xB5,
-    0x5A, 0x18, 0x71, 0xB0, 0x15, 0xFA, 0x2D, 0x6D, 0xD8, 0xA0, 0x0D, 0x17, 0xB4, 0x30, 0xC1, 0xEA,
-    0x84, 0x07, 0x76, 0x23, 0xBE, 0xC2, 0xAD, 0xC5, 0x59, 0xE8, 0xB7, 0x64, 0x43, 0xD6, 0x1D, 0xB3,
-    0x1F, 0x5F, 0x90, 0x4A, 0x80, 0xB5, 0xC1, 0x53, 0xF8, 0x08, 0x59, 0xB9, 0x16, 0x00, 0xAF, 0x39,
-    0x2D, 0xE7, 0xE4, 0x84, 0x98, 0x2D, 0x4F, 0xC7, 0x8E, 0xC1, 0xA5, 0x79, 0x4A, 0x9F, 0xAF, 0x09,
-    0x93, 0x09, 0xED, 0x99, 0x29, 0x3A, 0x6B, 0xB0, 0x74, 0x9C, 0x4D, 0x0D, 0x36, 0xB9, 0x39, 0x3A,
-    0xAD, 0x37, 0x81, 0x6C, 0x4C, 0xBD, 0x55, 0x34, 0x47, 0xC1, 0xD5, 0x86, 0xDC, 0x2C, 0x60, 0xB3,
-    0x48, 0xB9, 0x13, 0x27, 0x3E, 0xF6, 0x3E, 0x91, 0x40, 0x1E, 0x20, 0xBE, 0x94, 0x38, 0xDE, 0xC5,
-    0x7F, 0x58, 0x7B, 0x60, 0xDC, 0x55, 0x6C, 0xDC, 0x9D, 0xA6, 0xF5, 0x08, 0x5F, 0xEB, 0x44, 0x12,
-    0x2E, 0xB5, 0xFC, 0x2D, 0x06, 0x97, 0x71, 0x61, 0xBC, 0x40, 0x59, 0xC3, 0x2E, 0x10, 0x58, 0x82,
-    0x6B, 0x6E, 0x8D, 0x3D, 0xA9, 0x15, 0x05, 0x4D, 0x80, 0x11, 0x89, 0x13, 0xC5, 0x67, 0x30, 0x21,
-    0xC8, 0xE5, 0xCF, 0x18, 0x3F, 0x64, 0x73, 0x7A, 0x65, 0xB2, 0x8A, 0x39, 0xA1, 0x41, 0x73, 0x0B,
-    0xDD, 0x9A, 0x32, 0xE1, 0x17, 0xE4, 0x61, 0x98, 0xCB, 0x98, 0x99, 0xD1, 0x70, 0x94, 0x3C, 0xF5,
-    0x2A, 0x72, 0x54, 0x08, 0x57, 0x6E, 0x47, 0xD7, 0x01, 0x73, 0x19, 0x31, 0x8B, 0x44, 0x06, 0xA4,
-    0x99, 0x49, 0xD5, 0x10, 0x2E, 0x75, 0xDC, 0x6A, 0xBF, 0x7E, 0x80, 0x1B, 0x93, 0x87, 0x94, 0xA9,
-    0xD9, 0x97, 0xEE, 0x27, 0x58, 0x1F, 0x35, 0x2E, 0xD0, 0x9C, 0x5B, 0x7A, 0x05, 0xED, 0xAE, 0x27,
-    0x36, 0x37, 0x84, 0xC5, 0x85, 0x8D, 0x45, 0x44, 0x14, 0x8B, 0x8D, 0x8D, 0x4F, 0xE1, 0x37, 0x1D,
-    0x36, 0x5E, 0xED, 0x57, 0x93, 0xB5, 0xCE, 0xC0, 0x37, 0x68, 0xEE, 0x79, 0x31, 0xA2, 0xB4, 0xAD,
-    0x13, 0x76, 0x02, 0xF7, 0xCC, 0x5D, 0x56, 0xF3, 0x9D, 0x56, 0xFF, 0xA2, 0xA0, 0x03, 0xA5, 0xFB,
-    0x0F, 0x72, 0xB0, 0x36, 0xD7, 0xC2, 0x3E, 0xF9, 0x24, 0x29, 0x18, 0x10, 0x23, 0x82, 0x0C, 0xDE,
-    0x61, 0xA6, 0xA8, 0x4F, 0xAA, 0xCC, 0xBE, 0x4C, 0xD9, 0xC8, 0x46, 0x10, 0x27, 0x07, 0xD8, 0xC7,
-    0xCB, 0x83, 0x4C, 0x56, 0x71, 0x65, 0x1D, 0x22, 0x5D, 0x8B, 0x27, 0x8E, 0x23, 0xB1, 0xFC, 0x09,
-    0x2D, 0xBF, 0xF7, 0x61, 0x67, 0xDC, 0x2C, 0x7F, 0x9E, 0x58, 0x01, 0x22, 0xF2, 0x0E, 0x76, 0x5B,
-    0x88, 0x7C, 0xB0, 0x2D, 0xB5, 0x5A, 0x5E, 0x01, 0xF7, 0xE0, 0x91, 0x52, 0x65, 0x62, 0xB8, 0x27,
-    0xD3, 0x2B, 0xA5, 0x3F, 0xC9, 0xDF, 0x70, 0xFB, 0xFF, 0x93, 0xEE, 0x9D, 0x13, 0x93, 0x4F, 0x7D,
-    0x32, 0x6A, 0xEE, 0x05, 0x98, 0x72, 0xC2, 0x5B, 0xBF, 0x02, 0x43, 0x2A, 0x3A, 0x1E, 0x72, 0x1D,
-    0x98, 0x1E, 0x4E, 0xC7, 0xCF, 0xE9, 0x8A, 0xF0, 0xF8, 0x28, 0xCC, 0x4E, 0x28, 0xFF, 0x57, 0xB5,
-    0x49, 0x73, 0xC9, 0xE2, 0xFF, 0x82, 0x8B, 0x4F, 0x46, 0x75, 0x98, 0x39, 0x25, 0xEE, 0x82, 0x73,
-    0x92, 0xC5, 0xFF, 0x04, 0x96, 0x03, 0x8B, 0x8C, 0xDF, 0x36, 0xC1, 0x9F, 0xE8, 0x40, 0xBE, 0x0D,
-    0xBB, 0xDF, 0x18, 0x34, 0xC5, 0x9F, 0x7F, 0xA3, 0x76, 0x44, 0xB3, 0x20, 0x80, 0xCC, 0xAA, 0xDD,
-    0x23, 0x65, 0x78, 0xB2, 0x6A, 0x66, 0x9C, 0x32, 0x3E, 0x54, 0x9C, 0x83, 0xD0, 0xC6, 0x6E, 0xBE,
-    0x5D, 0xD9, 0x55, 0xCA, 0xD4, 0xB2, 0xDD, 0x69, 0x78, 0x1B, 0x9A, 0x69, 0x52, 0xE2, 0x7C, 0xD2,
-    0xD2, 0xE5, 0xBA, 0x3F, 0x6D, 0x70, 0xD9, 0xE3, 0x5D, 0x6A, 0x30, 0xFB, 0x71, 0xFF, 0x50, 0x1D,
-    0x64, 0xD9, 0x89, 0x13, 0x76, 0xE5, 0x5D, 0xCD, 0x10, 0xDA, 0x94, 0xCE, 0x24, 0x2A, 0x78, 0x62,
-    0xC5, 0x01, 0x97, 0xB2, 0xCE, 0x8B, 0xF4, 0x2C, 0x18, 0x05, 0xD7, 0xF1, 0x47, 0xF0, 0x04, 0x62,
-    0xC6, 0x46, 0xED, 0xD1, 0x51, 0x0B, 0xCD, 0xEF, 0x8E, 0x94, 0x81, 0x70, 0x69, 0xC7, 0xA2, 0xB5,
-    0x98, 0x42, 0x05, 0x3C, 0xFE, 0x57, 0xC0, 0x19, 0xE7, 0xBE, 0x6C, 0x08, 0xA1, 0x91, 0x6C, 0x41,
-    0x82, 0xCD, 0x88, 0xE0, 0x50, 0xE1, 0x6C, 0xD3, 0x47, 0xB1, 0xA1, 0x4D, 0x5A, 0x87, 0x45, 0x58,
-    0x8C, 0x1F, 0xB6, 0x57, 0x65, 0x6A, 0x3F, 0x20, 0x49, 0x88, 0xE7, 0xBB, 0x97, 0xE5, 0x4F, 0xB7,
-    0x33, 0xE7, 0xCC, 0xE1, 0x99, 0xA5, 0xA0, 0xF1, 0xA0, 0x4A, 0x4E, 0x61, 0xD7, 0x5E, 0xE4, 0x54,
-    0x7B, 0xC1, 0x9C, 0xB3, 0xCA, 0xBD, 0x0A, 0x15, 0x83, 0x0A, 0x7A, 0xEF, 0xC3, 0x91, 0xBD, 0x05,
-    0x8F, 0x06, 0x01, 0x0B, 0x32, 0xC2, 0x04, 0xDC, 0x99, 0x40, 0x85, 0x77, 0x2C, 0x1D, 0x56, 0xA2,
-    0xA4, 0xCA, 0xB3, 0x87, 0x61, 0x1B, 0x04, 0x44, 0xED, 0x22, 0xF6, 0xDE, 0x43, 0x7F, 0xBB, 0x8F,
-    0x9B, 0x7F, 0x94, 0x29, 0xA6, 0x12, 0xA2, 0x30, 0xC2, 0xBA, 0xD4, 0x2A, 0x96, 0xA6, 0x00, 0x2E,
-    0x08, 0xDF, 0xDC, 0xA6, 0x27, 0x69, 0xC7, 0x61, 0x90, 0x80, 0x70, 0x95, 0x70, 0xC7, 0x83, 0x92,
-    0x73, 0x1C, 0x41, 0xF5, 0xB0, 0x2A, 0x6C, 0xCB, 0xAE, 0xCE, 0xE3, 0x3E, 0x74, 0xBB, 0xA0, 0x80,
-    0xFB, 0xD2, 0x7D, 0x10, 0xBC, 0xA3, 0x69, 0x09, 0x11, 0x2B, 0x63, 0xC8, 0xFE, 0x08, 0x62, 0xD4,
-    0x61, 0xD6, 0x10, 0x7C, 0xD7, 0xC9, 0x7E, 0xA5, 0xCB, 0x54, 0xED, 0x31, 0xB0, 0x49, 0x88, 0x53,
-    0x87, 0x83, 0xC6, 0x58, 0x3F, 0xBB, 0xB6, 0x6B, 0xA7, 0x76, 0x44, 0x27, 0xDD, 0x8D, 0xD5, 0x12,
-    0xC1, 0x79, 0x31, 0x66, 0x96, 0xB0, 0x8B, 0x0C, 0x0B, 0x3A, 0x88, 0xA4, 0x31, 0x61, 0xB3, 0x2F,
-    0x19, 0xD1, 0x6B, 0xFC, 0xDC, 0x35, 0x8C, 0x2D, 0xC7, 0x62, 0x9B, 0x11, 0x3D, 0x19, 0xD1, 0xA5,
-    0xD6, 0x40, 0x6F, 0x20, 0xB6, 0x30, 0x54, 0xBD, 0xE8, 0xCD, 0x1C, 0xDE, 0x9A, 0xA8, 0xA0, 0x81,
-    0xD3, 0xB0, 0x3B, 0x58, 0x64, 0x9B, 0x66, 0xCB, 0xA1, 0xE1, 0x77, 0x1A, 0x30, 0x07, 0x51, 0x77,
-    0xA9, 0xB8, 0x57, 0x8A, 0xCF, 0x57, 0x5C, 0x00, 0xCC, 0x0E, 0x07, 0x98, 0x08, 0x9A, 0x21, 0xAA,
-    0xF2, 0xC0, 0x1C, 0x6B, 0x69, 0x76, 0xC5, 0xED, 0xC2, 0x46, 0xB5, 0xFF, 0x15, 0x56, 0x3A, 0x13,
-    0xC3, 0x2E, 0x66, 0x1D, 0x7C, 0xA2, 0xC9, 0xB3, 0xEB, 0x11, 0xE6, 0x84, 0x71, 0x2F, 0x7B, 0x63,
-    0xB3, 0x8E, 0x85, 0xC1, 0x55, 0x48, 0xE2, 0x37, 0x9B, 0x78, 0x87, 0xF0, 0xE7, 0x4C, 0x08, 0x4C,
-    0x69, 0x54, 0xE3, 0x43, 0xA3, 0xBC, 0x0C, 0x77, 0x44, 0xE3, 0xEF, 0x25, 0x93, 0x84, 0xB4, 0xD1,
-    0xA8, 0x6F, 0x6C, 0xD2, 0x28, 0x92, 0xB5, 0x33, 0x22, 0x5D, 0xBA, 0x00, 0x61, 0xBF, 0x5D, 0x2B,
-    0x41, 0x19, 0x7C, 0x96, 0xD3, 0xBA, 0x0D, 0x46, 0xD8, 0x55, 0xAF, 0x1C, 0x58, 0x45, 0xC6, 0xF2,
-    0x43, 0x9A, 0x7C, 0x32, 0xD6, 0xB0, 0xD7, 0xC8, 0x24, 0xA5, 0xB2, 0xA5, 0x5C, 0x0E, 0x66, 0x0F,
-    0x1B, 0xF5, 0xA2, 0xC7, 0x8D, 0x6A, 0x2D, 0x9A, 0xF1, 0xE3, 0x30, 0x2C, 0xC7, 0x21, 0x21, 0xE7,
-    0x60, 0x99, 0x98, 0x5D, 0x2D, 0x54, 0x78, 0x11, 0x0E, 0xFD, 0x67, 0x89, 0xF2, 0xAE, 0x40, 0xD4,
-    0xE0, 0x00, 0xC9, 0x1E, 0x87, 0x51, 0x66, 0xCE, 0x48, 0x93, 0xB1, 0xA5, 0xFA, 0xE7, 0xC4, 0x7F,
-    0xD5, 0x90, 0x61, 0x9D, 0xFA, 0x11, 0xB2, 0xAD, 0xF6, 0x04, 0x83, 0x8A, 0x8A, 0x10, 0xDA, 0x11,
-    0x10, 0x2A, 0x78, 0x60, 0xEB, 0x0B, 0xBF, 0x32, 0x30, 0x19, 0x9B, 0x57, 0x07, 0xBF, 0xE9, 0x80,
-    0x13, 0x29, 0xE9, 0xD8, 0x56, 0x91, 0xF7, 0x30, 0xA1, 0x69, 0x85, 0xEE, 0x88, 0x71, 0xA5, 0xA1,
-    0xD4, 0x10, 0xB4, 0x38, 0x62, 0xF2, 0x22, 0x3E, 0x00, 0xE6, 0x63, 0x61, 0x2D, 0x76, 0x13, 0x58,
-    0x63, 0x19, 0xF2, 0x7A, 0x55, 0x30, 0x8A, 0x2D, 0xF2, 0x43, 0x2D, 0x50, 0x5B, 0xA8, 0x06, 0x6A,
-    0xAF, 0x27, 0x30, 0x5E, 0x3C, 0xAB, 0xBB, 0x6E, 0x76, 0x55, 0xED, 0xB0, 0x39, 0x55, 0x7A, 0x12,
-    0xB4, 0xBD, 0x8E, 0xA0, 0xE8, 0x3D, 0x98, 0x4B, 0xAA, 0x11, 0xEE, 0x62, 0x60, 0x0E, 0x35, 0x50,
-    0xFB, 0x41, 0x50, 0x05, 0x11, 0x2F, 0x74, 0xE4, 0x67, 0x71, 0x9E, 0x22, 0x52, 0xBE, 0x49, 0x4D,
-    0xDF, 0x02, 0x4D, 0x6F, 0xA0, 0xAF, 0xB5, 0x41, 0x47, 0xB3, 0xA5, 0x89, 0x1C, 0xE8, 0x0A, 0xD7,
-    0x19, 0xA7, 0x43, 0xF3, 0xAC, 0xC5, 0xB0, 0x86, 0x42, 0x0C, 0x3B, 0xD7, 0xCF, 0xEA, 0xC1, 0x3F,
-    0x7B, 0x1B, 0x3A, 0x73, 0x34, 0x7C, 0xDF, 0x61, 0x7A, 0x3E, 0x7E, 0xE8, 0xFB, 0xC8, 0x4C, 0xC1,
-    0x4F, 0x50, 0xD9, 0x19, 0xFC, 0x97, 0x5E, 0x67, 0xBF, 0x37, 0xED, 0xB4, 0xAC, 0x2B, 0xC6, 0xBA,
-    0x42, 0x49, 0x13, 0x61, 0x75, 0x10, 0xE1, 0xF4, 0xA0, 0x06, 0xF9, 0xE9, 0xB3, 0xE9, 0xBF, 0xD4,
-    0x62, 0x8D, 0x74, 0x45, 0x7B, 0x34, 0xA8, 0xED, 0x1D, 0x9A, 0x79, 0xBB, 0xCC, 0x2C, 0x96, 0x2E,
-    0x3E, 0xDB, 0x63, 0xF7, 0xF1, 0xEE, 0x33, 0xC7, 0x04, 0xC1, 0x4E, 0xC6, 0xFB, 0x65, 0x47, 0x6A,
-    0x66, 0x69, 0x89, 0x99, 0x54, 0xB5, 0x7F, 0xA9, 0x55, 0xF3, 0x4E, 0xA1, 0x1E, 0x0E, 0x12, 0x53,
-    0x25, 0xC1, 0xDF, 0xDC, 0xCF, 0xE2, 0x8C, 0xC5, 0x04, 0x86, 0x4F, 0xE0, 0x3A, 0xAE, 0x88, 0xB5,
-    0xD7, 0xD3, 0x64, 0x88, 0xB3, 0x97, 0x16, 0x29, 0xC4, 0x88, 0xF5, 0xFC, 0xB6, 0x0F, 0xF5, 0xFD,
-    0xBC, 0x0F, 0xF8, 0x31, 0x3F, 0x46, 0xC2, 0x24, 0x5D, 0x73, 0xFC, 0xB1, 0x76, 0x59, 0x28, 0xD0,
-    0x52, 0x2E, 0x48, 0x1F, 0x2B, 0x20, 0xE8, 0x1A, 0x5F, 0xC6, 0x5F, 0xA8, 0xFE, 0xEF, 0x34, 0x1E,
-    0x9E, 0xA6, 0x8B, 0x89, 0x75, 0x5C, 0x34, 0xC1, 0xA0, 0x78, 0xD2, 0xE9, 0x92, 0x0E, 0x7C, 0x6D,
-    0xF8, 0x0B, 0x4A, 0xA6, 0xC6, 0x9E, 0xA7, 0xF2, 0xA1, 0xBC, 0x06, 0xBF, 0x68, 0x79, 0x7F, 0xEF,
-    0x9A, 0x22, 0x78, 0x35, 0x58, 0xF2, 0xD7, 0x5A, 0x80, 0x08, 0xAD, 0x66, 0xA5, 0x1A, 0x88, 0x7D,
-    0x7C, 0x02, 0x78, 0x45, 0x4F, 0x0A, 0x4E, 0x47, 0x21, 0xCF, 0x5C, 0x5B, 0x77, 0x04, 0x56, 0xA8,
-    0x1B, 0xEB, 0xE4, 0xCE, 0x15, 0x58, 0xB1, 0x11, 0x75, 0xA3, 0xF1, 0x8A, 0x94, 0x1A, 0x92, 0x31,
-    0xAA, 0x22, 0xC7, 0x9D, 0x4A, 0x30, 0xFC, 0x06, 0x47, 0x0F, 0x62, 0x0F, 0xAB, 0xF3, 0x4B, 0x26,
-    0x73, 0xE9, 0x2B, 0xB0, 0x06, 0x8C, 0x2D, 0x7D, 0x06, 0x35, 0x24, 0x8B, 0x9F, 0x87, 0x90, 0xC3,
-    0xE6, 0x47, 0xE3, 0xCA, 0xDD, 0x69, 0xD2, 0xC4, 0x2C, 0x0F, 0x15, 0x89, 0xD6, 0x99, 0x43, 0x6D,
-    0x06, 0x40, 0xE3, 0x8A, 0xD4, 0x51, 0x58, 0xD7, 0x28, 0xAD, 0x20, 0x7A, 0xD4, 0x49, 0x54, 0x40,
-    0x94, 0x59, 0x81, 0x3D, 0xE1, 0x84, 0x3B, 0x12, 0x4E, 0x12, 0xA5, 0x81, 0x23, 0x92, 0xD4, 0x3C,
-    0x7A, 0xFB, 0xC0, 0x41, 0x42, 0x6D, 0x27, 0x53, 0x27, 0xA0, 0xB7, 0x27, 0x80, 0x0F, 0xEE, 0xB7,
-    0x6E, 0x7B, 0x4E, 0x07, 0xC4, 0x5B, 0x3D, 0xBF, 0xC9, 0xAE, 0xAD, 0x08, 0xA8, 0x2D, 0x49, 0xBA,
-    0x05, 0xB9, 0xDD, 0x68, 0x18, 0xD2, 0x67, 0x2B, 0xBB, 0x83, 0x77, 0x82, 0x31, 0xA7, 0x7F, 0xD8,
-    0xAC, 0xE0, 0x9B, 0x95, 0xBC, 0x57, 0xC6, 0x1E, 0x88, 0xF7, 0x45, 0xC0, 0x29, 0x84, 0x60, 0x56,
-    0xD1, 0x9A, 0xB2, 0x8E, 0x1B, 0x0D, 0x18, 0x45, 0x31, 0xB9, 0x05, 0x2C, 0xA7, 0x04, 0xCC, 0xC9,
-    0xBF, 0x43, 0xF0, 0x97, 0x57, 0x24, 0x22, 0xE5, 0xAC, 0xC3, 0x8C, 0x00, 0x75, 0x0A, 0xA8, 0x4E,
-    0x8D, 0x61, 0xDD, 0xB5, 0x2E, 0x23, 0xEF, 0x5D, 0xC6, 0xDB, 0x91, 0x64, 0x1C, 0xBE, 0xC8, 0x65,
-    0xA8, 0x9D, 0xF0, 0xA2, 0xA0, 0xD7, 0x2E, 0x03, 0xE5, 0x14, 0x1E, 0xCC, 0xEB, 0x16, 0xE5, 0x88,
-    0x4A, 0xE5, 0x26, 0x01, 0x00, 0x75, 0xD9, 0x02, 0x46, 0xCC, 0x63, 0x3D, 0xFB, 0x15, 0x70, 0xFC,
-    0x8F, 0x6B, 0xC9, 0x11, 0x9B, 0x1F, 0xE3, 0xB7, 0x55, 0x44, 0x25, 0x30, 0xE6, 0xC0, 0x98, 0x00,
-    0x63, 0xE8, 0x88, 0x76, 0x09, 0x64, 0x8C, 0x0C, 0x1C, 0x49, 0xC2, 0xE5, 0x2C, 0x0C, 0xA2, 0x2D,
-    0x5B, 0x7A, 0xA5, 0x49, 0xE9, 0x64, 0x95, 0x38, 0x58, 0x4A, 0x88, 0x64, 0x9E, 0xF8, 0x3F, 0x30,
-    0x2F, 0x15, 0x62, 0xF1, 0xF8, 0x69, 0xAE, 0x0D, 0xE4, 0x93, 0x39, 0xDB, 0xC7, 0x2A, 0x00, 0x05,
-    0xE8, 0x13, 0xD1, 0xB5, 0xF9, 0x50, 0x38, 0xDD, 0x6B, 0xD5, 0x31, 0x9B, 0x72, 0xB6, 0xD7, 0xD9,
-    0x9F, 0x7A, 0x6A, 0x7F, 0x04, 0x37, 0x19, 0xE0, 0x04, 0xD0, 0x44, 0xD3, 0xE3, 0x49, 0x4D, 0x75,
-    0x9B, 0x38, 0x8C, 0x5D, 0x92, 0x1E, 0xD8, 0x43, 0x11, 0x01, 0x7C, 0xFA, 0x0C, 0xF0, 0xE7, 0x28,
-    0x7D, 0x11, 0x01, 0x54, 0x90, 0x03, 0x41, 0x81, 0x78, 0x42, 0x28, 0x78, 0xA7, 0xC4, 0xFB, 0x8C,
-    0x20, 0x6A, 0x5C, 0xC1, 0xC6, 0x62, 0x2D, 0x59, 0xAE, 0xC9, 0x9A, 0x9B, 0xE5, 0x72, 0x4E, 0xF8,
-    0x65, 0x26, 0x62, 0x2B, 0x49, 0xC4, 0x02, 0xE1, 0xAE, 0x2B, 0x6F, 0x63, 0x75, 0x03, 0xF7, 0x17,
-    0x9C, 0xA7, 0xB7, 0xA9, 0xBD, 0x65, 0x35, 0x70, 0x86, 0x33, 0x87, 0xC9, 0x64, 0x66, 0x47, 0xD2,
-    0x73, 0xE3, 0xB2, 0x83, 0x2C, 0x8E, 0x02, 0x3C, 0xD4, 0x57, 0x24, 0x87, 0x02, 0x7D, 0xA5, 0x10,
-    0x2B, 0x4A, 0xF1, 0x17, 0xE0, 0x9C, 0xEC, 0x06, 0x38, 0xA7, 0xCF, 0xC0, 0xE5, 0x86, 0x79, 0xCD,
-    0xB8, 0x2E, 0x7A, 0xCB, 0xF8, 0x54, 0xF4, 0x80, 0x82, 0x41, 0x28, 0xCF, 0x62, 0x62, 0x71, 0xDB,
-    0x58, 0xD9, 0x44, 0xCD, 0xD1, 0x77, 0x95, 0x97, 0x14, 0x78, 0x78, 0x22, 0x5E, 0xF4, 0x2E, 0xA1,
-    0x97, 0x5B, 0x5A, 0xE7, 0x2F, 0xB1, 0x4E, 0xA7, 0x4F, 0x16, 0x6A, 0xB3, 0x3D, 0x16, 0xB3, 0x71,
-    0x93, 0x44, 0xA1, 0xC3, 0x34, 0x4D, 0x47, 0xA1, 0xEE, 0xB0, 0xA1, 0xFF, 0x58, 0x4A, 0x35, 0x52,
-    0x80, 0x53, 0x41, 0x24, 0x65, 0xBE, 0x80, 0x0A, 0x90, 0xF2, 0x42, 0xE9, 0x5A, 0x30, 0x29, 0xE9,
-    0x79, 0x53, 0xAD, 0x83, 0x13, 0xD5, 0x23, 0x1D, 0x31, 0x9F, 0x69, 0xEB, 0x83, 0x54, 0x60, 0x2F,
-    0x7E, 0x86, 0x86, 0x63, 0x6F, 0xF8, 0x43, 0x2A, 0xD0, 0xF1, 0xF0, 0xBF, 0x48, 0xE2, 0x52, 0xF0,
-    0x06, 0xA2, 0x61, 0x29, 0x3F, 0x64, 0x26, 0x23, 0xAB, 0x42, 0xA2, 0xAD, 0x68, 0x87, 0xFA, 0x87,
-    0x08, 0x9F, 0xB1, 0x7C, 0x75, 0xA4, 0x08, 0x92, 0x20, 0x72, 0x4B, 0x3F, 0xF3, 0xC0, 0x0B, 0x3F,
-    0xF3, 0x61, 0x23, 0xBC, 0x6C, 0xAF, 0x8C, 0xF3, 0x00, 0x6A, 0x5E, 0x76, 0x16, 0x63, 0x98, 0x97,
-    0x6A, 0x54, 0xE9, 0x9F, 0x02, 0xB1, 0xFC, 0xF6, 0x8D, 0x77, 0x22, 0x88, 0x3B, 0x2B, 0x1E, 0x23,
-    0x56, 0x20, 0x61, 0xEE, 0xDD, 0x42, 0x8A, 0xC3, 0x78, 0xC0, 0x32, 0x73, 0x33, 0x94, 0xF0, 0xAD,
-    0xAB, 0x1B, 0x2F, 0x32, 0xFF, 0x53, 0xAA, 0xBD, 0x3E, 0xEE, 0xFD, 0x76, 0x90, 0xBF, 0x38, 0xE4,
-    0x66, 0x69, 0x92, 0xE2, 0x77, 0x99, 0x92, 0x61, 0xB9, 0x2A, 0x1D, 0x6A, 0x90, 0xD3, 0x25, 0x4E,
-    0xBB, 0x55, 0x73, 0xDD, 0x6A, 0xC5, 0x64, 0x79, 0x82, 0x6D, 0x9D, 0x65, 0xFE, 0xB6, 0x91, 0xEC,
-    0x5C, 0xBB, 0x46, 0x85, 0xD2, 0xA2, 0x5C, 0xAD, 0xD8, 0x81, 0xC6, 0xA6, 0x72, 0x55, 0x0E, 0x14,
-    0x8A, 0x11, 0x05, 0x14, 0xAA, 0x94, 0xC8, 0x40, 0xA0, 0x81, 0x40, 0xA8, 0xDC, 0xC4, 0x0B, 0x70,
-    0x93, 0xEB, 0x1A, 0xA1, 0xAD, 0x75, 0x9D, 0xDC, 0x48, 0x32, 0x0B, 0xC7, 0x81, 0xC5, 0x87, 0x1F,
-    0x49, 0x9D, 0x80, 0x7B, 0xE3, 0x41, 0xCE, 0xD5, 0x05, 0x93, 0xA0, 0x38, 0x67, 0x02, 0x03, 0x65,
-    0x32, 0xE7, 0xBC, 0x98, 0xF4, 0x8C, 0xC9, 0xCA, 0xC6, 0xCF, 0xE9, 0xE7, 0xE8, 0x48, 0xA3, 0x5E,
-    0x35, 0xA7, 0x2E, 0xA4, 0x27, 0x92, 0x74, 0x7A, 0x9C, 0x29, 0x69, 0x76, 0x28, 0x9C, 0x6C, 0xAE,
-    0x8B, 0x10, 0xF5, 0x44, 0xB1, 0x9E, 0x5E, 0x0A, 0x84, 0x17, 0xF6, 0xDD, 0x67, 0xC2, 0x25, 0x42,
-    0x40, 0x51, 0x33, 0x93, 0xC2, 0xFD, 0x80, 0xB2, 0xE5, 0xAC, 0x6B, 0xFA, 0x0C, 0x8C, 0x37, 0xD2,
-    0x8F, 0x57, 0xC4, 0x78, 0x30, 0x83, 0x43, 0x0B, 0xE7, 0x15, 0x1C, 0x69, 0x2E, 0xB6, 0x40, 0xED,
-    0x82, 0xFC, 0x41, 0x16, 0x70, 0x3A, 0xE6, 0x61, 0x36, 0x79, 0xD1, 0xD8, 0x90, 0x19, 0x4D, 0xB0,
-    0xD6, 0x2A, 0x47, 0x8F, 0xC6, 0x52, 0xED, 0x96, 0x71, 0x5E, 0xE8, 0x3B, 0x2B, 0xA3, 0xD4, 0x02,
-    0xEC, 0xF7, 0xDE, 0xA3, 0xBD, 0xFA, 0xE1, 0x9B, 0x34, 0xB0, 0xFE, 0xB3, 0x18, 0xF7, 0x06, 0xCC,
-    0x9C, 0x1E, 0x0F, 0x69, 0x27, 0xCB, 0x10, 0xDC, 0x19, 0x15, 0x27, 0x40, 0xD2, 0x5C, 0x79, 0xC1,
-    0x05, 0xE7, 0xAA, 0x57, 0x43, 0x4E, 0x3D, 0x13, 0x0D, 0x29, 0x71, 0x81, 0x76, 0xEF, 0x71, 0xA6,
-    0x37, 0x68, 0xF2, 0x1E, 0xE1, 0x3C, 0xAF, 0x54, 0x06, 0x30, 0xA9, 0x3F, 0x66, 0xB9, 0xE8, 0x83,
-    0x5F, 0xC3, 0x43, 0x5D, 0xFA, 0xA4, 0x55, 0xCE, 0x33, 0x45, 0xA7, 0xFC, 0x67, 0x7F, 0xAA, 0x93,
-    0xF8, 0x8D, 0x37, 0x20, 0x47, 0xCC, 0xAF, 0x91, 0xB0, 0xE5, 0x8E, 0x59, 0x1E, 0x23, 0x51, 0xD2,
-    0x7A, 0x03, 0xF4, 0xF1, 0x9E, 0xC9, 0x68, 0x38, 0x2F, 0x18, 0x83, 0xEF, 0xD1, 0xF8, 0xE3, 0x79,
-    0x7B, 0xFB, 0xEB, 0x71, 0x7E, 0x57, 0xBA, 0x50, 0x78, 0x7D, 0xEE, 0xF1, 0xB5, 0x2B, 0xD4, 0x13,
-    0x65, 0xBF, 0xF9, 0xBA, 0xC9, 0x3F, 0x3F, 0xF6, 0x7A, 0x4D, 0xD5, 0xF2, 0xBD, 0x4B, 0x0D, 0x15,
-    0x73, 0xDE, 0x3F, 0xC5, 0xEC, 0x80, 0x3A, 0x16, 0x1C, 0x92, 0x04, 0x57, 0x19, 0x8E, 0x28, 0x7B,
-    0x8F, 0x54, 0xA1, 0xC3, 0x1D, 0x7A, 0xA1, 0x39, 0xE1, 0xEB, 0x0C, 0x7B, 0x03, 0x9B, 0x8E, 0xBD,
-    0x71, 0xE4, 0x3B, 0x9E, 0x8C, 0x7B, 0x25, 0x0F, 0xB3, 0xAF, 0x63, 0xCD, 0x19, 0x71, 0xB0, 0xB3,
-    0x71, 0x7A, 0x43, 0xCB, 0xDE, 0xE8, 0x08, 0x12, 0x18, 0x32, 0xA5, 0xB2, 0x6B, 0x3F, 0x0D, 0xFB,
-    0xFC, 0x53, 0x34, 0x18, 0x67, 0x5E, 0x85, 0x1C, 0x5E, 0xAC, 0x20, 0xC5, 0xE1, 0x9B, 0x4D, 0x63,
-    0x6A, 0x34, 0x93, 0x31, 0x95, 0xEE, 0x83, 0x30, 0xA2, 0x15, 0xA2, 0x26, 0x92, 0xD4, 0x79, 0xE9,
-    0x08, 0x31, 0x95, 0xDF, 0x7C, 0xE8, 0xD1, 0xB2, 0xBB, 0x2E, 0x25, 0x3F, 0xDA, 0x30, 0x52, 0xFE,
-    0x6B, 0x0D, 0xAC, 0x6A, 0x78, 0x12, 0x78, 0x40, 0xA5, 0x23, 0x4A, 0x48, 0x47, 0x7D, 0x85, 0x01,
-    0xAC, 0xBC, 0x7C, 0xAE, 0xF2, 0xD7, 0x5D, 0xE8, 0x6D, 0xCA, 0x10, 0xD5, 0x5A, 0x02, 0xA4, 0x96,
-    0xBC, 0x0A, 0x66, 0x58, 0x5F, 0x3A, 0xCF, 0xBC, 0xBA, 0x45, 0xDB, 0xDC, 0x49, 0xE1, 0x39, 0xFC,
-    0xF7, 0x14, 0xD5, 0x54, 0x7A, 0x7B, 0x28, 0x5B, 0x2A, 0xF6, 0x5F, 0xC7, 0xBF, 0xB6, 0xC1, 0x25,
-    0xE6, 0x41, 0x83, 0x4B, 0x70, 0x24, 0x55, 0x78, 0xAA, 0x86, 0x2E, 0xA4, 0x3F, 0x85, 0x80, 0x1E,
-    0x64, 0x74, 0xAF, 0x44, 0x82, 0xE1, 0x82, 0xB0, 0x47, 0x72, 0x65, 0xFF, 0x4D, 0x04, 0x4D, 0xA1,
-    0x8B, 0xC9, 0x46, 0xE2, 0xEE, 0xDD, 0xC2, 0x49, 0xB8, 0x47, 0x76, 0xE9, 0x9B, 0x3C, 0x6C, 0x73,
-    0xDC, 0xC8, 0x46, 0x37, 0xEC, 0x11, 0x33, 0x92, 0xCF, 0x7D, 0xAF, 0x4B, 0x53, 0x66, 0xB2, 0x4C,
-    0x16, 0x88, 0x49, 0xFC, 0x0B, 0x1E, 0x6B, 0x7C, 0x7E, 0xD6, 0x79, 0x2C, 0x2A, 0x84, 0x49, 0xEB,
-    0xB2, 0x6D, 0x28, 0xB6, 0x10, 0x5E, 0x83, 0xF3, 0x00, 0xAB, 0x4E, 0x89, 0x3D, 0x6A, 0x1E, 0x68,
-    0xED, 0xF5, 0x58, 0xAF, 0x16, 0xA1, 0x3E, 0xA0, 0xB1, 0x47, 0x20, 0x32, 0xF2, 0xA5, 0xC3, 0x22,
-    0x67, 0xE6, 0x7A, 0xE9, 0x88, 0x24, 0x35, 0x93, 0x05, 0xEE, 0x93, 0x9F, 0x55, 0xDC, 0x28, 0xF7,
-    0xD3, 0x8C, 0x3B, 0xF5, 0x8A, 0x36, 0x6A, 0x44, 0xC7, 0x55, 0x7A, 0x1F, 0x34, 0x50, 0xFA, 0x22,
-    0xB8, 0x54, 0x5F, 0xA0, 0x26, 0x1D, 0xAA, 0x62, 0x7A, 0x30, 0xA7, 0x0C, 0x55, 0xF0, 0x93, 0xD6,
-    0xAF, 0xC3, 0x95, 0xF0, 0xCD, 0x22, 0x6C, 0x4D, 0x87, 0x0E, 0xDC, 0xC4, 0xAB, 0xCA, 0xFA, 0xF4,
-    0x6F, 0x45, 0x99, 0x08, 0x90, 0xE2, 0x3F, 0x6B, 0x68, 0x2D, 0x2C, 0x5A, 0xF0, 0x73, 0x03, 0x6E,
-    0x61, 0xE1, 0xCC, 0x67, 0x34, 0x1A, 0xA9, 0x9D, 0x83, 0xF8, 0x3A, 0xF5, 0x66, 0xEC, 0x82, 0x7F,
-    0xFF, 0xA6, 0x4E, 0x5C, 0xFD, 0x37, 0xD2, 0x59, 0xB9, 0x00, 0x34, 0xB8, 0x60, 0xC1, 0x6D, 0xAE,
-    0x6A, 0x58, 0xA9, 0x47, 0xB1, 0x29, 0xC0, 0xBA, 0xDF, 0xB2, 0x22, 0x51, 0x4B, 0xFF, 0x29, 0xEC,
-    0x35, 0x4B, 0xD1, 0x90, 0x32, 0xD8, 0x31, 0x07, 0x41, 0xA1, 0x95, 0x48, 0xAA, 0xD9, 0x24, 0xFA,
-    0xC4, 0x88, 0x74, 0x3D, 0x74, 0x4A, 0xCD, 0xFF, 0x9F, 0x63, 0x4B, 0xE3, 0x8A, 0x3A, 0x11, 0x99,
-    0x16, 0x97, 0x7A, 0xB6, 0x51, 0x17, 0x52, 0x84, 0x41, 0x1F, 0x9E, 0x17, 0x58, 0x15, 0xD6, 0xAC,
-    0x9E, 0x44, 0x41, 0xBD, 0xDC, 0x3D, 0x0A, 0x09, 0x16, 0xA4, 0xAB, 0x4C, 0xCE, 0x40, 0x49, 0xFA,
-    0x22, 0x27, 0x58, 0xC8, 0x21, 0x52, 0x06, 0xEB, 0x29, 0xA6, 0x2B, 0xA1, 0x91, 0x9E, 0x54, 0xA5,
-    0x78, 0x49, 0x98, 0xF7, 0xAA, 0xC2, 0x43, 0x74, 0x00, 0x62, 0x90, 0x14, 0xE8, 0xF9, 0xD1, 0xA4,
-    0x5F, 0xD4, 0xAC, 0xA8, 0xC7, 0x26, 0x4A, 0x3D, 0x60, 0xA2, 0x8E, 0xB0, 0xC7, 0x94, 0x94, 0x73,
-    0x33, 0x38, 0x1C, 0x44, 0x0A, 0xBD, 0x48, 0xCD, 0x26, 0xDE, 0x7D, 0x70, 0xBF, 0x7E, 0x98, 0xFC,
-    0xD3, 0x3A, 0x08, 0x32, 0xA7, 0xDA, 0xEF, 0xE4, 0x6E, 0xB5, 0x7F, 0x94, 0xBB, 0xE5, 0x53, 0x56,
-    0xEE, 0x95, 0xE7, 0x31, 0x14, 0x8D, 0x05, 0xA5, 0x6A, 0x46, 0x99, 0xFF, 0x56, 0x6D, 0x47, 0xFE,
-    0xFB, 0xB5, 0xA7, 0xBC, 0xDF, 0x56, 0xC7, 0xB9, 0x9F, 0x52, 0x1D, 0x8F, 0x0C, 0x2E, 0x34, 0x2D,
-    0x55, 0x12, 0xF1, 0x8B, 0x4D, 0x0B, 0xB2, 0x4D, 0xA5, 0x3A, 0x8B, 0x86, 0xDB, 0xFF, 0x58, 0x1C,
-    0x10, 0x5C, 0x02, 0xC3, 0x44, 0xBB, 0xEE, 0x51, 0x12, 0x2B, 0xD3, 0x5E, 0x19, 0x5C, 0x59, 0x81,
-    0x8D, 0xD5, 0xED, 0x91, 0x32, 0x7E, 0x2B, 0xD5, 0x65, 0x9C, 0x6C, 0x5D, 0xCD, 0xE3, 0xC4, 0x98,
-    0x7E, 0xA2, 0x33, 0x73, 0x23, 0xA3, 0x4C, 0x02, 0xAD, 0x76, 0x99, 0x7E, 0x98, 0xB4, 0x4A, 0x90,
-    0x32, 0xFB, 0xA2, 0xC0, 0x6D, 0xA8, 0x4D, 0xC2, 0x18, 0x9E, 0x66, 0x80, 0x49, 0xAA, 0xB4, 0x8B,
-    0x73, 0x8D, 0x2D, 0xD6, 0x56, 0x9C, 0x69, 0x49, 0xF9, 0x02, 0x31, 0x50, 0xC2, 0xAF, 0x00, 0xA6,
-    0xF5, 0x30, 0x3F, 0xD5, 0xD1, 0xA8, 0x8A, 0xD7, 0xE1, 0xF0, 0xB0, 0x96, 0xFD, 0xC7, 0x4C, 0x8D,
-    0xB2, 0x84, 0x79, 0x70, 0xAB, 0x11, 0x84, 0x97, 0x5D, 0x70, 0x80, 0x92, 0x14, 0xA4, 0xDD, 0x04,
-    0x98, 0xF3, 0x1C, 0x8E, 0x71, 0x28, 0xE9, 0x67, 0x58, 0xC6, 0xEA, 0x08, 0xB3, 0x64, 0x36, 0x3D,
-    0x74, 0x32, 0x11, 0xC9, 0x11, 0x8C, 0xCF, 0xA8, 0xB8, 0x30, 0x35, 0x9E, 0xAB, 0xF0, 0xF9, 0xD8,
-    0x00, 0xA7, 0x74, 0x22, 0x82, 0x52, 0xCE, 0xB7, 0x8B, 0x83, 0xCC, 0x77, 0x94, 0x32, 0xCC, 0x1E,
-    0xC4, 0x36, 0xDF, 0x34, 0x55, 0xB7, 0xD9, 0x6F, 0x5E, 0xA0, 0xE8, 0x06, 0xCC, 0xDC, 0xBA, 0xEC,
-    0x71, 0x18, 0xE5, 0x67, 0xD4, 0x5D, 0x26, 0xC1, 0xEC, 0x5D, 0x73, 0x81, 0xE5, 0x27, 0x22, 0x99,
-    0xC0, 0x23, 0xAC, 0x3C, 0x98, 0x8D, 0x43, 0xF4, 0x3B, 0x4B, 0xE0, 0xD0, 0x14, 0xC0, 0x27, 0x5D,
-    0x69, 0xD4, 0x94, 0x7B, 0x67, 0xCD, 0x3B, 0x32, 0x65, 0xC4, 0xF0, 0xB5, 0xC3, 0xEA, 0x25, 0x5A,
-    0xBF, 0x37, 0x80, 0x3D, 0x03, 0xA0, 0xCC, 0xD7, 0x80, 0x3F, 0xA5, 0xCA, 0x0E, 0x0C, 0x2A, 0x9D,
-    0x57, 0xC0, 0xA1, 0xAC, 0xB5, 0x67, 0xA9, 0x3A, 0x16, 0xB3, 0x5B, 0x20, 0x56, 0x10, 0x27, 0x58,
-    0x90, 0xF8, 0x40, 0xC1, 0xAB, 0x0A, 0x4F, 0x65, 0x52, 0x37, 0x0D, 0x9F, 0x01, 0x3C, 0x61, 0x9A,
-    0xE2, 0x4D, 0xC5, 0xC2, 0x30, 0x33, 0x51, 0xCC, 0x6D, 0x30, 0x1B, 0x25, 0x48, 0x81, 0x22, 0x6D,
-    0x0D, 0x6D, 0xD8, 0x14, 0xEC, 0x7E, 0x8D, 0x4F, 0xF5, 0x4B, 0x35, 0x59, 0xBC, 0x9D, 0xAB, 0xE6,
-    0x9F, 0x03, 0x41, 0xC5, 0x3B, 0x57, 0x66, 0x16, 0xAD, 0x15, 0x4B, 0xB7, 0x5E, 0x6D, 0x23, 0xA4,
-    0x4D, 0x19, 0x92, 0xC0, 0xCA, 0xC1, 0xEB, 0x55, 0x00, 0x33, 0x17, 0x71, 0x89, 0x23, 0xAC, 0x58,
-    0x95, 0x14, 0xE7, 0xCE, 0x62, 0x1D, 0x23, 0xE9, 0x6C, 0x91, 0xCE, 0xD4, 0x89, 0x28, 0xA0, 0xB1,
-    0xA7, 0x24, 0xDB, 0xB6, 0x47, 0xC5, 0x6C, 0xDA, 0x04, 0xC1, 0x6B, 0x25, 0xE3, 0x28, 0x0A, 0x6C,
-    0x60, 0x1E, 0xE5, 0x9B, 0xE8, 0x76, 0x41, 0x4D, 0xF5, 0xD4, 0x49, 0x9B, 0xB3, 0xFA, 0x8E, 0x54,
-    0xAA, 0x54, 0x6C, 0x96, 0x26, 0xBA, 0xE1, 0xC9, 0xDE, 0xB6, 0x7D, 0xF7, 0x66, 0xEA, 0x3E, 0x56,
-    0x42, 0xFD, 0x20, 0x14, 0xCC, 0x3B, 0x48, 0x97, 0x8D, 0xE4, 0x6D, 0x24, 0x98, 0x01, 0xF7, 0x64,
-    0x70, 0x9A, 0x98, 0xC5, 0xFF, 0x98, 0x0D, 0xA0, 0x1C, 0xA4, 0x9D, 0x81, 0x50, 0x2C, 0x86, 0x01,
-    0xF8, 0x0F, 0xF0, 0xCB, 0xFA, 0x6A, 0x25, 0x62, 0xD7, 0xEB, 0xBE, 0x15, 0x49, 0x5B, 0xAC, 0xB1,
-    0xB4, 0x30, 0x09, 0xCE, 0x6F, 0x5E, 0xC8, 0x99, 0xC3, 0x02, 0x04, 0xC4, 0xFD, 0x6E, 0xC9, 0x6A,
-    0x31, 0xFD, 0x0C, 0x3E, 0x05, 0x6B, 0xA1, 0x43, 0xD1, 0x26, 0x84, 0x43, 0x90, 0xB0, 0xF7, 0xFC,
-    0x38, 0xF8, 0x9C, 0x31, 0xA4, 0x85, 0xEB, 0x3D, 0x52, 0x34, 0x1D, 0xF0, 0x52, 0x93, 0x33, 0xB6,
-    0x6B, 0x7C, 0x19, 0x19, 0xFD, 0xBD, 0x6F, 0x93, 0xF0, 0x24, 0x73, 0x2C, 0x8D, 0xAF, 0x15, 0xE9,
-    0x2A, 0xBD, 0x73, 0xD9, 0x3A, 0x70, 0x60, 0x76, 0x01, 0x0F, 0x0D, 0xE1, 0x4C, 0x8E, 0x02, 0xDC,
-    0x95, 0x22, 0x4C, 0x62, 0xA2, 0x84, 0xD4, 0xF1, 0xC5, 0xA9, 0xE5, 0x21, 0x6E, 0x2D, 0x50, 0xD3,
-    0xAB, 0xE4, 0xE2, 0x97, 0x72, 0x61, 0x8B, 0x80, 0x32, 0x7D, 0x1C, 0xF0, 0xB4, 0x3A, 0x02, 0x48,
-    0xAD, 0xED, 0x4E, 0xB9, 0x5D, 0x17, 0xA7, 0x94, 0x95, 0xCA, 0x9B, 0x6A, 0xE5, 0x55, 0xA3, 0x17,
-    0x4D, 0x57, 0x05, 0xEB, 0x70, 0xFB, 0x09, 0x8B, 0xD4, 0x99, 0xC7, 0x85, 0x4B, 0xD3, 0x6D, 0x8F,
-    0x62, 0x97, 0x67, 0x27, 0x37, 0xED, 0x5C, 0x19, 0xFD, 0x05, 0xA3, 0xDA, 0x00, 0x4E, 0xAA, 0x68,
-    0x42, 0x17, 0xBE, 0xE0, 0xDC, 0x02, 0xDC, 0x4F, 0xB2, 0xF8, 0x7B, 0x4E, 0x49, 0x3C, 0xE9, 0x12,
-    0x04, 0x60, 0x94, 0x50, 0xB4, 0xEC, 0xC4, 0xE2, 0x4A, 0x93, 0x30, 0xB8, 0xF9, 0xA0, 0xB4, 0x1B,
-    0x9E, 0xA0, 0x68, 0x5F, 0xD1, 0x57, 0x98, 0x07, 0x3B, 0x39, 0x0D, 0x47, 0x87, 0x2E, 0x09, 0xD1,
-    0xA8, 0xDF, 0xFB, 0xF6, 0xBE, 0x6B, 0xFF, 0xE5, 0xAB, 0x8D, 0x8E, 0xD4, 0xEC, 0xE9, 0xD3, 0xD8,
-    0x74, 0x67, 0x75, 0x95, 0x3C, 0x9A, 0x99, 0x19, 0x56, 0x75, 0x57, 0xA2, 0xA6, 0xDE, 0x19, 0x51,
-    0x1B, 0x7E, 0xC5, 0xF2, 0x77, 0x14, 0x27, 0xD0, 0x06, 0x00, 0xC1, 0xDA, 0xF4, 0xA7, 0x5C, 0xBF,
-    0xBF, 0xC5, 0x94, 0x84, 0xA7, 0x3B, 0x69, 0x98, 0xF2, 0xE1, 0x97, 0x6B, 0xC9, 0x13, 0x34, 0x43,
-    0x5B, 0x87, 0xF4, 0xFB, 0x5D, 0xD3, 0xEA, 0xB0, 0xFC, 0x99, 0xB8, 0xEC, 0xBE, 0xB4, 0x92, 0x32,
-    0x29, 0x94, 0xD2, 0xA3, 0x43, 0xA3, 0x16, 0x04, 0x8C, 0x4C, 0x12, 0x50, 0x93, 0x8F, 0x24, 0x96,
-    0xAE, 0x42, 0x09, 0x75, 0xB4, 0x29, 0x45, 0x23, 0xB1, 0x6D, 0xDF, 0x25, 0xAF, 0xD4, 0xD7, 0xA4,
-    0x30, 0xA6, 0x56, 0xB0, 0x15, 0xF5, 0x59, 0xD3, 0x65, 0x22, 0xA9, 0x0F, 0xF6, 0xA4, 0xBA, 0xC9,
-    0x51, 0xFC, 0x53, 0x7C, 0xDC, 0xAC, 0x87, 0xED, 0xB7, 0xF6, 0x7B, 0x80, 0x88, 0x27, 0x33, 0x86,
-    0xDD, 0x9B, 0xB4, 0x06, 0x20, 0x5C, 0x97, 0x27, 0x4E, 0xAF, 0x3C, 0x2C, 0xD2, 0x34, 0xA7, 0xAB,
-    0x70, 0xFD, 0xDC, 0x3F, 0x51, 0xFF, 0x68, 0x4B, 0xB0, 0x6F, 0xDF, 0x7D, 0x5B, 0xF6, 0xEF, 0xDA,
-    0xB3, 0xA2, 0x30, 0x5D, 0x17, 0xED, 0x4F, 0x9B, 0x63, 0xF2, 0xD8, 0xD9, 0x5E, 0xD6, 0xC3, 0xBE,
-    0x8A, 0x71, 0xB4, 0x6F, 0x9D, 0xDE, 0xFE, 0x35, 0x75, 0x4D, 0x32, 0x8E, 0x61, 0xE3, 0x06, 0x5B,
-    0xE0, 0x56, 0xA1, 0xAD, 0x4F, 0x2A, 0xF5, 0x75, 0x3B, 0x52, 0xBF, 0xE3, 0x47, 0x4C, 0x09, 0x46,
-    0x53, 0x22, 0xF1, 0xAB, 0xDF, 0x3F, 0xCE, 0xEB, 0xEF, 0xFF, 0xDB, 0x1F, 0x7C, 0x9D, 0xD7, 0x6F,
-    0xDD, 0xF7, 0xBB, 0xEE, 0x57, 0x22, 0x3F, 0x8B, 0x26, 0x8E, 0x71, 0x5A, 0x65, 0xBD, 0x0D, 0xA6,
-    0x6C, 0xFB, 0x3E, 0x66, 0xFC, 0x16, 0xF8, 0x35, 0xDA, 0x94, 0x75, 0xE9, 0x05, 0x62, 0x7F, 0x1F,
-    0x14, 0x3E, 0xF9, 0xE0, 0x35, 0xAE, 0xA8, 0x5F, 0xAC, 0x13, 0x0D, 0x29, 0x90, 0xBE, 0x1B, 0x52,
-    0xC6, 0xEF, 0xF6, 0xEE, 0x60, 0x1F, 0x7B, 0x5C, 0x7F, 0x60, 0x8C, 0xB1, 0x00, 0xCD, 0xBE, 0x75,
-    0x89, 0x9E, 0x52, 0xFE, 0xF6, 0xC5, 0xCB, 0x8D, 0xFA, 0xD1, 0x54, 0xED, 0x2F, 0xF4, 0x45, 0x86,
-    0xB4, 0xB0, 0xC4, 0x88, 0xCC, 0x9C, 0x51, 0x5F, 0xE6, 0x87, 0x8C, 0x87, 0x93, 0x97, 0x6E, 0x5B,
-    0x8A, 0xAE, 0x2F, 0x91, 0xF0, 0x4C, 0x44, 0x9C, 0x07, 0x64, 0x99, 0x08, 0xF2, 0xC3, 0xBA, 0xAD,
-    0x6C, 0xB2, 0x7E, 0xF6, 0xE2, 0xAA, 0x6B, 0x3A, 0xDF, 0x7B, 0xA7, 0x61, 0x89, 0x8B, 0xE1, 0x91,
-    0x19, 0x3F, 0x39, 0x2E, 0x99, 0xAF, 0xE2, 0xDA, 0x96, 0xCF, 0x67, 0x20, 0xF3, 0xD2, 0x0B, 0xD4,
-    0xB7, 0x7C, 0x7A, 0x85, 0xE9, 0x4C, 0x1A, 0x49, 0x3F, 0xC8, 0xA4, 0xE5, 0x33, 0xCC, 0xFE, 0x8A,
-    0x99, 0x87, 0x93, 0x3F, 0x63, 0x2F, 0xC8, 0xA3, 0x6C, 0xF9, 0x4C, 0xFF, 0x1D, 0x21, 0xB9, 0x96,
-    0x83, 0x15, 0x9A, 0x8D, 0x93, 0x16, 0x03, 0xB8, 0xBE, 0x61, 0xD0, 0xB4, 0x7C, 0xCE, 0x75, 0x07,
-    0xE2, 0xCF, 0x10, 0xED, 0x5C, 0xEA, 0x4F, 0x48, 0x18, 0xC6, 0xFB, 0x53, 0x3E, 0x4F, 0x84, 0x42,
-    0x19, 0xF9, 0x5B, 0x34, 0x5D, 0xF4, 0x4F, 0x81, 0x8E, 0x13, 0x30, 0xAE, 0xE1, 0x5A, 0xD2, 0x57,
-    0x9B, 0xA4, 0xCC, 0x13, 0x57, 0xCE, 0xA4, 0xC8, 0x53, 0x4A, 0x19, 0xA3, 0x30, 0x95, 0xCF, 0xA1,
-    0x98, 0x92, 0x26, 0xF1, 0xD3, 0x08, 0x84, 0x5F, 0x8F, 0x93, 0xB0, 0x09, 0xDB, 0xA0, 0x64, 0xE6,
-    0x53, 0x1A, 0xA0, 0x88, 0x8E, 0x8A, 0x3E, 0x53, 0x95, 0x88, 0x60, 0x39, 0x9B, 0xD5, 0x5B, 0x60,
-    0xF8, 0xEA, 0xC6, 0xCA, 0x0D, 0x8C, 0x86, 0x24, 0x5E, 0x9E, 0x27, 0xC9, 0x96, 0x9E, 0x34, 0x7F,
-    0x4F, 0xB5, 0x95, 0x4B, 0x05, 0xA0, 0x4F, 0xBC, 0x74, 0x51, 0x9F, 0xFA, 0x9D, 0x84, 0x2C, 0x40,
-    0xC1, 0xEA, 0xC8, 0x67, 0x8B, 0x9B, 0x53, 0xAE, 0x6C, 0x0C, 0xBB, 0xAA, 0xA5, 0x0F, 0x52, 0x4A,
-    0xB0, 0x92, 0x13, 0x4B, 0xA3, 0xE0, 0x57, 0x40, 0xBF, 0x43, 0xFB, 0x82, 0x74, 0x23, 0x2E, 0x6F,
-    0x68, 0xE9, 0x59, 0xCE, 0xCC, 0x99, 0x10, 0xD2, 0xCD, 0xAC, 0x4A, 0xC1, 0x8D, 0xC1, 0xF0, 0x3F,
-    0xE8, 0xCD, 0xFF, 0x94, 0xF0, 0xE8, 0x79, 0x06, 0xFD, 0xBC, 0x43, 0x53, 0x3C, 0xB4, 0x2A, 0xB8,
-    0xC2, 0xC8, 0xB4, 0x24, 0xF6, 0xFD, 0xE3, 0x8B, 0x3D, 0x35, 0x33, 0x4B, 0xB3, 0x2B, 0x5E, 0x1B,
-    0xD6, 0x56, 0xFB, 0x11, 0x7C, 0xC5, 0xD3, 0x2D, 0xE8, 0xEA, 0xF0, 0xBD, 0xCE, 0x6E, 0xAC, 0x56,
-    0x2A, 0xB2, 0xB5, 0xDD, 0xB8, 0x15, 0x9C, 0xED, 0x27, 0xCF, 0x82, 0xD9, 0x6B, 0x99, 0xB7, 0x0E,
-    0x5F, 0x09, 0x49, 0x09, 0xB2, 0x6D, 0x78, 0xEC, 0x8C, 0xE8, 0x85, 0x24, 0x8A, 0x7F, 0xDE, 0xDB,
-    0xCB, 0x41, 0xD3, 0xC6, 0xE1, 0x09, 0x24, 0x96, 0x11, 0x3D, 0x56, 0x7F, 0x7A, 0xB0, 0xA1, 0xC5,
-    0x8D, 0x8C, 0xF2, 0xA6, 0xA6, 0xC3, 0xCF, 0xB7, 0x87, 0x4F, 0x77, 0xBF, 0xC7, 0x82, 0x23, 0x04,
-    0x32, 0x50, 0x4F, 0x9C, 0x64, 0x66, 0x69, 0x19, 0x2B, 0x63, 0xFF, 0xCD, 0xD2, 0x84, 0xE7, 0x5F,
-    0x90, 0xE6, 0x1E, 0xEA, 0xC9, 0xA6, 0x6F, 0x7D, 0x79, 0x63, 0xB5, 0xEF, 0x5B, 0xF7, 0xD8, 0x9B,
-    0xEF, 0xE7, 0xD2, 0xBC, 0x3E, 0xBD, 0x3A, 0x97, 0x06, 0x7F, 0x26, 0x7D, 0xAE, 0x8F, 0x10, 0xBF,
-    0x60, 0x75, 0x13, 0xDE, 0x2E, 0x71, 0x45, 0x4C, 0x43, 0x65, 0xEC, 0xC0, 0xC4, 0x27, 0xE2, 0x8A,
-    0xE6, 0xD6, 0x23, 0x81, 0x41, 0xB7, 0xBB, 0x22, 0x15, 0xFF, 0x5D, 0xD2, 0x27, 0xE0, 0xFB, 0x1C,
-    0x60, 0x28, 0x58, 0x38, 0x1B, 0xFA, 0xF6, 0x58, 0x91, 0x81, 0x57, 0xC3, 0x8A, 0x10, 0x73, 0xE9,
-    0x62, 0x68, 0x26, 0x5D, 0xC1, 0x97, 0x6C, 0xA6, 0x03, 0x1C, 0x1E, 0x82, 0xB2, 0xD7, 0x97, 0x0B,
-    0x09, 0xB5, 0x7A, 0x63, 0xFB, 0xB9, 0x45, 0x5B, 0x86, 0x8D, 0x1B, 0x2F, 0x09, 0x0B, 0x4C, 0x66,
-    0x50, 0x8A, 0xE1, 0x52, 0xCF, 0x61, 0xCA, 0x9D, 0x09, 0x77, 0xE9, 0x27, 0xC6, 0x0E, 0xFA, 0x04,
-    0x81, 0xF0, 0x67, 0xC1, 0x95, 0xCA, 0xA4, 0xDB, 0xE1, 0xE6, 0x35, 0xC3, 0xE0, 0xB8, 0xC0, 0xBE,
-    0xA5, 0x85, 0x3A, 0x5A, 0x42, 0xAE, 0xDE, 0xCF, 0xD5, 0xF6, 0xA3, 0x76, 0xE5, 0x70, 0xC3, 0xF7,
-    0x39, 0xA5, 0xD8, 0xAF, 0x3D, 0x6E, 0x29, 0x76, 0x6B, 0x97, 0x5B, 0x48, 0xE9, 0xCB, 0xF3, 0x0A,
-    0xB1, 0x9C, 0x73, 0x6B, 0xE3, 0x83, 0x0E, 0x95, 0x30, 0x39, 0x30, 0xCD, 0xFB, 0x55, 0x78, 0x52,
-    0xF2, 0x2D, 0x45, 0x18, 0x99, 0x3E, 0x9D, 0xD0, 0xF8, 0xDA, 0x28, 0x26, 0x91, 0xA3, 0x4E, 0xC2,
-    0x4B, 0x44, 0x00, 0xB3, 0xA6, 0x79, 0xBF, 0xF0, 0x75, 0x39, 0xEE, 0x45, 0x18, 0x22, 0xA1, 0xF3,
-    0xFD, 0xF5, 0x58, 0x7F, 0xED, 0x6B, 0x6E, 0x6A, 0x30, 0xD2, 0xDB, 0x59, 0x78, 0x04, 0xFC, 0x7F,
-    0x59, 0xD9, 0xB8, 0x3B, 0xF7, 0x74, 0xE6, 0x7E, 0xBF, 0xF1, 0xB2, 0xD8, 0xCB, 0xBF, 0x36, 0x6A,
-    0xBD, 0xAC, 0x61, 0xB1, 0xAE, 0xF5, 0x2F, 0xD5, 0x24, 0xA4, 0x0D, 0x9E, 0x11, 0x20, 0xD8, 0xC5,
-    0x2F, 0x08, 0x36, 0x94, 0x5D, 0xA4, 0x5F, 0x0F, 0xB9, 0xC9, 0xF7, 0xDB, 0xD5, 0x09, 0x5E, 0xCF,
-    0x3B, 0xE5, 0x05, 0x5E, 0x31, 0x4B, 0xEB, 0x96, 0xDF, 0xC0, 0xB7, 0x55, 0x63, 0x33, 0xDF, 0x58,
-    0xAB, 0xC6, 0xD2, 0xCD, 0x35, 0x1D, 0x80, 0xC3, 0xBA, 0xFA, 0x73, 0x4E, 0x8F, 0x97, 0x3D, 0xDA,
-    0xC9, 0xC7, 0x45, 0xD1, 0xBE, 0x29, 0x0C, 0x1B, 0x7F, 0x04, 0x01, 0x00, 0x76, 0xAC, 0x1C, 0x35,
-    0xA3, 0x72, 0x38, 0x72, 0x47, 0xE1, 0x47, 0x5C, 0xCD, 0x4E, 0x3B, 0x16, 0x4A, 0x05, 0xE2, 0x98,
-    0x46, 0x26, 0x9E, 0xEE, 0x68, 0x04, 0xBC, 0x83, 0x71, 0x6F, 0xB3, 0x17, 0xB0, 0x36, 0xE9, 0x76,
-    0xB6, 0x68, 0x79, 0xC6, 0xDB, 0x49, 0x9B, 0x2C, 0x8B, 0x3C, 0xDF, 0x79, 0x49, 0xBA, 0x3A, 0xDD,
-    0x22, 0x8E, 0x3C, 0x18, 0xA8, 0x51, 0x42, 0x90, 0xD3, 0x49, 0x0A, 0x40, 0xD2, 0x00, 0x90, 0xA5,
-    0xFB, 0xF1, 0x7B, 0x8D, 0x0F, 0xEC, 0x86, 0x4A, 0x1F, 0xA9, 0x01, 0x96, 0x73, 0x63, 0xD4, 0x17,
-    0xFA, 0x34, 0xFE, 0x7E, 0x53, 0x2D, 0xB0, 0x16, 0x4D, 0xBA, 0x38, 0x48, 0xE0, 0x6D, 0x0E, 0x88,
-    0x16, 0xD8, 0xEF, 0x30, 0x20, 0xF1, 0x2C, 0x1A, 0x85, 0x3D, 0x62, 0x15, 0xF6, 0xC9, 0x7E, 0x4A,
-    0x6B, 0xF0, 0x45, 0x11, 0xF4, 0xB5, 0x64, 0x30, 0xBF, 0x2A, 0x7D, 0x8C, 0x52, 0xC0, 0x36, 0x3A,
-    0xA5, 0x24, 0x8B, 0x6D, 0x75, 0x23, 0x39, 0x43, 0x38, 0x69, 0xFA, 0x87, 0xA0, 0xC5, 0x97, 0x69,
-    0x21, 0x7C, 0x53, 0x10, 0x17, 0x23, 0xBA, 0x09, 0xAB, 0x17, 0x53, 0x63, 0xC4, 0xB6, 0x9D, 0x3F,
-    0x0C, 0x1B, 0xBB, 0x75, 0x1A, 0xEF, 0x55, 0xA7, 0x9E, 0x7F, 0xD0, 0xA9, 0x10, 0x68, 0xFF, 0x1A,
-    0x4B, 0x23, 0xEA, 0x62, 0x25, 0x1C, 0xBE, 0x2E, 0xB8, 0x28, 0x65, 0x60, 0x39, 0x6B, 0x17, 0x26,
-    0x71, 0x8E, 0xB8, 0xA9, 0xEC, 0xA7, 0x63, 0xFD, 0x03, 0x26, 0xF6, 0x08, 0x1B, 0x0C, 0x13, 0x76,
-    0x6B, 0xC1, 0xF8, 0x26, 0x50, 0xEA, 0x65, 0x2C, 0x83, 0xC9, 0x10, 0xEB, 0x93, 0x42, 0x74, 0x18,
-    0x93, 0x7D, 0xE8, 0xD2, 0xF4, 0xFD, 0x6F, 0xFA, 0xE9, 0xE0, 0xAF, 0x85, 0xCA, 0xFF, 0x55, 0x8E,
-    0x93, 0x3A, 0x92, 0xD6, 0x55, 0xF1, 0x9F, 0x08, 0xF6, 0xFC, 0x67, 0x54, 0x48, 0xFD, 0xA4, 0x80,
-    0xC4, 0x1F, 0xC0, 0x1C, 0x5A, 0xEC, 0x2C, 0x55, 0x72, 0xE6, 0x8F, 0xF4, 0x05, 0x2C, 0xC2, 0x67,
-    0x60, 0x28, 0xD6, 0xBE, 0x53, 0x85, 0x20, 0x3B, 0x71, 0x9A, 0xD1, 0x5A, 0xE2, 0xAC, 0x3F, 0x7A,
-    0x48, 0x39, 0xBF, 0xFD, 0x73, 0x30, 0xFB, 0x53, 0x78, 0x3C, 0xEF, 0x2A, 0xB1, 0x1A, 0xC5, 0xCA,
-    0x7F, 0x97, 0x61, 0xD4, 0x5F, 0xC3, 0x74, 0x05, 0xFF, 0x3D, 0x8E, 0x86, 0x06, 0x76, 0xF8, 0x8D,
-    0x38, 0x1A, 0x57, 0xAE, 0xD8, 0xE1, 0xC8, 0x6D, 0xB1, 0x86, 0x6D, 0x81, 0x0C, 0x63, 0x5B, 0xAC,
-    0xE5, 0x0F, 0x65, 0x5B, 0xB2, 0xA9, 0x6D, 0x39, 0xF9, 0xB9, 0x6D, 0x71, 0x27, 0xDB, 0xD2, 0xC9,
-    0xB6, 0xB4, 0xB2, 0x2D, 0x53, 0x67, 0x31, 0xE6, 0xDA, 0xC9, 0xB6, 0xB8, 0x53, 0x65, 0x64, 0x1F,
-    0x22, 0x34, 0xD7, 0xBD, 0x48, 0xE2, 0xFE, 0x10, 0x02, 0x0C, 0xBF, 0xE3, 0xBD, 0x6A, 0xDF, 0xDC,
-    0x36, 0xF0, 0x84, 0x12, 0x0C, 0x92, 0x7F, 0x45, 0x27, 0x69, 0xF1, 0x10, 0x6C, 0xD6, 0x2F, 0xF3,
-    0x79, 0x66, 0x49, 0xA2, 0x7D, 0x6E, 0x25, 0xB9, 0xE0, 0x72, 0x97, 0x8C, 0xFB, 0xC4, 0xF3, 0x94,
-    0xE3, 0xE6, 0xEF, 0x40, 0x4C, 0x8A, 0x39, 0x0D, 0x14, 0x5E, 0xEC, 0xC4, 0x07, 0xC9, 0x49, 0xA0,
-    0x48, 0xCE, 0xDE, 0x4A, 0xAF, 0xBD, 0x9C, 0x01, 0x32, 0x27, 0x80, 0x02, 0x5D, 0x02, 0x80, 0xCE,
-    0x2C, 0x2D, 0x5A, 0x2F, 0xE2, 0x4E, 0xAF, 0x5E, 0x70, 0xCB, 0xFD, 0xF5, 0x3E, 0xAF, 0x3C, 0xFB,
-    0xDD, 0xA3, 0xDE, 0x2F, 0x89, 0xD2, 0xDE, 0xE1, 0xC9, 0x95, 0x6E, 0xD8, 0xD1, 0xF0, 0x87, 0x4C,
-    0x49, 0x3F, 0x83, 0x5D, 0x8D, 0x05, 0x27, 0xF5, 0xC7, 0xD0, 0x22, 0xA8, 0xC9, 0x50, 0x87, 0xBB,
-    0x2E, 0xEE, 0x4A, 0xA7, 0x0E, 0x6A, 0xE8, 0x6B, 0x0E, 0x6A, 0x98, 0x03, 0x51, 0xCF, 0x3D, 0x2E,
-    0xBD, 0xC8, 0x82, 0xBB, 0x94, 0x33, 0x1C, 0xD7, 0x98, 0x3E, 0xA8, 0x31, 0xC1, 0x5D, 0xC4, 0x22,
-    0xC3, 0xD1, 0x9F, 0x76, 0x0A, 0x6B, 0xCD, 0x4F, 0x59, 0x9A, 0x7D, 0xBD, 0xB5, 0x63, 0x0E, 0x98,
-    0x69, 0x7A, 0x22, 0x19, 0x8B, 0x07, 0xE4, 0xD8, 0xD5, 0xC0, 0x7E, 0x5F, 0x47, 0x86, 0x8D, 0x57,
-    0xB8, 0x73, 0xE0, 0x19, 0xF1, 0x17, 0x75, 0xB6, 0x34, 0x69, 0x16, 0x96, 0x87, 0xE4, 0xE0, 0x0B,
-    0xF0, 0x8B, 0x18, 0x7D, 0x03, 0xF0, 0xC4, 0xAC, 0x53, 0xF7, 0x77, 0xB0, 0xD3, 0x39, 0x6C, 0x86,
-    0xB4, 0x1E, 0x68, 0x96, 0x62, 0xD1, 0x1F, 0xE8, 0x2B, 0x52, 0xDA, 0x4E, 0x0F, 0x94, 0x86, 0xEC,
-    0xD2, 0xD0, 0x5D, 0xF4, 0x84, 0xF7, 0x94, 0xF7, 0xA4, 0xF7, 0xB4, 0xF7, 0xC4, 0xF7, 0xD4, 0xF7,
-    0xE4, 0xF7, 0xC7, 0x55, 0x0C, 0x03, 0x7A, 0x0E, 0xF4, 0x2C, 0xE8, 0x79, 0x30, 0x30, 0x41, 0xB2,
-    0xDC, 0x26, 0xC9, 0xCD, 0x4E, 0xDB, 0xD6, 0x4D, 0x48, 0xA4, 0x13, 0x91, 0x4A, 0x87, 0x64, 0x8A,
-    0xAF, 0xE3, 0x09, 0x18, 0x21, 0xD4, 0x50, 0x6A, 0x48, 0x35, 0xB4, 0x1A, 0x62, 0x85, 0x5A, 0xAA,
-    0x91, 0xD3, 0xAA, 0xE9, 0xE3, 0x29, 0x0D, 0x61, 0xDA, 0x69, 0x62, 0x2F, 0xD3, 0xD9, 0x3F, 0x5C,
-    0xB0, 0x90, 0x4E, 0x4C, 0xDB, 0x34, 0x41, 0xC3, 0xC1, 0xDF, 0xC4, 0xEE, 0xFE, 0x96, 0xC0, 0xC7,
-    0x21, 0xFC, 0x4C, 0x23, 0xC0, 0xDB, 0x4A, 0x08, 0x92, 0xD6, 0x74, 0xB6, 0x07, 0x0B, 0x5D, 0xA3,
-    0x4E, 0x5A, 0xF1, 0x47, 0x9D, 0x34, 0xE3, 0x8C, 0xBA, 0x39, 0x1E, 0xBF, 0xB1, 0x5B, 0xA6, 0xA1,
-    0x5B, 0x73, 0xB4, 0x59, 0x89, 0xF6, 0xDD, 0x27, 0xBD, 0x57, 0x08, 0xC4, 0x05, 0x62, 0x85, 0x3D,
-    0x5E, 0xF8, 0x45, 0x67, 0x3A, 0xA5, 0x2F, 0xAB, 0x89, 0xA3, 0x5F, 0x8A, 0xE4, 0xA4, 0x08, 0xF3,
-    0x44, 0xE6, 0x08, 0xB6, 0xC1, 0x4D, 0x06, 0xAD, 0x4A, 0xD8, 0x59, 0xB9, 0x1B, 0x3F, 0x62, 0x51,
-    0x50, 0x1C, 0xBF, 0x69, 0x15, 0x1C, 0x9C, 0xBF, 0xA9, 0xE2, 0x12, 0x00, 0x4C, 0x3A, 0x99, 0x54,
-    0x8F, 0x4C, 0x66, 0x04, 0xC5, 0x3D, 0x64, 0xF6, 0xD0, 0x9C, 0x78, 0x5E, 0xAB, 0x86, 0xFA, 0xBB,
-    0x71, 0x61, 0x29, 0x03, 0xAB, 0xF5, 0xF3, 0x06, 0xEA, 0x41, 0xD4, 0xFE, 0x15, 0xA0, 0x91, 0xAD,
-    0xD9, 0x25, 0xF5, 0x41, 0xED, 0x17, 0xE1, 0xC5, 0x26, 0xCC, 0xE3, 0x93, 0x0D, 0xD4, 0xDC, 0x6E,
-    0x62, 0x19, 0x12, 0x0E, 0x4F, 0x77, 0x4E, 0x85, 0x81, 0x20, 0xA4, 0x93, 0xE6, 0x01, 0xE9, 0xBB,
-    0x05, 0x50, 0x6E, 0x63, 0x81, 0xD7, 0x1B, 0x67, 0x38, 0xF5, 0xD0, 0x72, 0xCB, 0xE0, 0xBC, 0x31,
-    0x21, 0x5C, 0xB6, 0x33, 0x0A, 0x9F, 0xD6, 0x65, 0xEC, 0x7C, 0xD2, 0xA4, 0xDE, 0x5B, 0x4D, 0xE7,
-    0xBD, 0xD6, 0x74, 0xFE, 0x45, 0x7C, 0x2E, 0xD5, 0xDA, 0x7B, 0xBD, 0x8C, 0xDD, 0xB5, 0x3C, 0xF8,
-    0x48, 0xB3, 0xC0, 0xD3, 0x18, 0x21, 0xBD, 0x93, 0x59, 0x05, 0x04, 0x96, 0x35, 0xDC, 0x8F, 0x23,
-    0xB9, 0xAF, 0xB4, 0xEB, 0x9D, 0xAC, 0xC9, 0x7A, 0xC9, 0xF1, 0x12, 0x57, 0x50, 0x1F, 0xEF, 0xBB,
-    0x5F, 0xDD, 0x6C, 0x56, 0xE1, 0x61, 0x44, 0x0F, 0xA5, 0xC9, 0x7D, 0x57, 0xBD, 0x6E, 0x1F, 0x37,
-    0xC8, 0x86, 0x62, 0xC0, 0xE0, 0x9B, 0xA7, 0x37, 0x69, 0x1A, 0x57, 0xB3, 0xBD, 0xD8, 0x62, 0x39,
-    0x0D, 0x94, 0xED, 0x93, 0xD3, 0x40, 0xCE, 0x0D, 0xCE, 0x71, 0x18, 0xBA, 0x26, 0x09, 0xFF, 0x09,
-    0x3A, 0x9F, 0x3A, 0x0D, 0x54, 0x0D, 0x2D, 0x68, 0xD2, 0xAD, 0x24, 0x5D, 0x09, 0x4C, 0x18, 0x9A,
-    0x81, 0x51, 0xF0, 0xCC, 0xE1, 0xD9, 0x64, 0x67, 0xE2, 0xB7, 0x71, 0x99, 0x96, 0x76, 0xBB, 0xB6,
-    0xF1, 0x42, 0xDF, 0x65, 0x29, 0x8E, 0xB6, 0x74, 0x1A, 0xF6, 0xEA, 0x31, 0x94, 0xF3, 0x0A, 0x06,
-    0x73, 0x54, 0x2E, 0x96, 0x9A, 0x37, 0x77, 0xC8, 0x8D, 0x83, 0x3A, 0xCD, 0xD1, 0xEB, 0xA6, 0xC2,
-    0xDC, 0xF9, 0x89, 0x2D, 0xFB, 0x9E, 0xF8, 0x79, 0x39, 0x68, 0xA4, 0x76, 0x26, 0xA9, 0x3E, 0x08,
-    0xB0, 0xBB, 0x6E, 0xA5, 0x2B, 0x9E, 0x9C, 0x51, 0xAA, 0x00, 0xA3, 0x58, 0x62, 0xA4, 0x80, 0x33,
-    0x1D, 0xEA, 0x32, 0x14, 0x62, 0x2C, 0xDC, 0x71, 0x0A, 0x7D, 0x56, 0xA2, 0xF3, 0x4D, 0xBB, 0xB7,
-    0x39, 0xFC, 0x78, 0x40, 0x2F, 0xF6, 0x6D, 0x5C, 0x3B, 0x16, 0x47, 0x49, 0xCC, 0x66, 0x5B, 0x69,
-    0xFE, 0x1F, 0x95, 0x4E, 0x69, 0xF1, 0x08, 0x6A, 0x0E, 0x9D, 0xC9, 0xEC, 0xDA, 0x8D, 0xEC, 0xC6,
-    0x83, 0x17, 0x9B, 0x07, 0xBE, 0x3C, 0x0B, 0x5B, 0x54, 0x98, 0x92, 0xEB, 0x54, 0x9E, 0x67, 0x80,
-    0x65, 0x76, 0xC7, 0x6E, 0xB6, 0x4C, 0xDD, 0xCE, 0x4A, 0x43, 0xAD, 0xEF, 0xC2, 0x4A, 0x19, 0x4D,
-    0x7C, 0x13, 0x11, 0xCC, 0xB5, 0x2B, 0xA5, 0xBF, 0x84, 0x9F, 0xF7, 0x75, 0x94, 0xAE, 0xF0, 0x54,
-    0xF7, 0x82, 0x1C, 0xA2, 0xE2, 0x82, 0x24, 0x43, 0xA8, 0x52, 0x39, 0x20, 0x15, 0xFE, 0xDD, 0xE4,
-    0x80, 0x94, 0xF1, 0xCB, 0x26, 0xE9, 0x63, 0x1A, 0x57, 0x3F, 0xA0, 0x21, 0x70, 0x4E, 0x8A, 0x39,
-    0x94, 0xE5, 0x1E, 0xA7, 0x7F, 0x85, 0x62, 0x80, 0x9C, 0xB9, 0x9A, 0x40, 0x32, 0x6C, 0x4D, 0xE6,
-    0x4D, 0x8D, 0xEA, 0xA9, 0x74, 0x40, 0xF9, 0xB9, 0xD1, 0xF4, 0x9D, 0x2A, 0xF6, 0x47, 0x62, 0xF2,
-    0xA7, 0xE9, 0x65, 0x2F, 0xB1, 0xEE, 0xFB, 0xAE, 0x32, 0x6D, 0x29, 0x26, 0x6B, 0x27, 0x8E, 0x81,
-    0xFD, 0xA7, 0x72, 0xCE, 0x52, 0x9D, 0xD5, 0xCC, 0x3B, 0xF3, 0xCC, 0x4F, 0x02, 0x9D, 0x8C, 0xFB,
-    0x64, 0xD7, 0x99, 0x61, 0x56, 0x26, 0x06, 0xAC, 0xEF, 0xCB, 0x61, 0x09, 0x8A, 0xC0, 0x13, 0xA2,
-    0x37, 0x2D, 0xD1, 0xCA, 0x5A, 0xD7, 0x06, 0x5D, 0xB4, 0xD7, 0x2B, 0xE7, 0x31, 0xE3, 0x3C, 0x2E,
-    0x3C, 0xA9, 0x87, 0x4B, 0x7F, 0x76, 0x45, 0xBC, 0x41, 0x2E, 0x7A, 0xC3, 0x78, 0xC3, 0x1C, 0x64,
-    0x09, 0x4C, 0x03, 0x55, 0xFF, 0xA6, 0x0A, 0x5E, 0x78, 0x78, 0x5C, 0xD0, 0xC4, 0xF0, 0xDA, 0x8A,
-    0xD4, 0x84, 0x8E, 0xDA, 0x04, 0x8F, 0x9A, 0x8E, 0xEA, 0xF4, 0x69, 0x6C, 0x60, 0xA8, 0xFB, 0xC8,
-    0xA1, 0x2F, 0xBE, 0xF5, 0x36, 0xA2, 0x0F, 0xA7, 0x27, 0x97, 0x64, 0x28, 0x08, 0xEC, 0x58, 0x5A,
-    0x3A, 0x70, 0x18, 0x77, 0x3D, 0x53, 0x2D, 0x84, 0x3F, 0x7C, 0xB4, 0x3A, 0x16, 0x3F, 0xEA, 0x96,
-    0x4F, 0xA6, 0xAE, 0x39, 0xCE, 0x25, 0x27, 0xB9, 0x58, 0x0B, 0x0E, 0x58, 0x6A, 0x83, 0xE3, 0x81,
-    0x4F, 0x81, 0xDB, 0x19, 0xA5, 0x89, 0xDD, 0xEE, 0x96, 0xDE, 0xA8, 0x10, 0xBE, 0x30, 0x0F, 0xDA,
-    0x71, 0xDE, 0x68, 0x7E, 0x38, 0x2E, 0xF6, 0x3D, 0x41, 0x74, 0x65, 0xAF, 0x53, 0x9E, 0xAE, 0x96,
-    0xBB, 0x59, 0x5A, 0xE8, 0x4D, 0x67, 0xC3, 0xFA, 0xF7, 0x50, 0xD8, 0xE3, 0x01, 0x3C, 0x0A, 0x3F,
-    0x83, 0x75, 0xF7, 0xA4, 0x9A, 0xF8, 0xF2, 0x54, 0xC4, 0x9F, 0x4F, 0x1B, 0x4C, 0x2B, 0xBD, 0x4C,
-    0x77, 0xD4, 0x0C, 0xA7, 0x24, 0x4D, 0xCD, 0xE3, 0xEC, 0x78, 0x4B, 0xCE, 0x0C, 0x1D, 0xF5, 0xD6,
-    0xE1, 0xD0, 0xE4, 0x20, 0x6A, 0xB7, 0x1C, 0x12, 0x3F, 0x62, 0x2F, 0x4A, 0x6F, 0x43, 0x17, 0x8E,
-    0x7E, 0x21, 0x57, 0x8B, 0x9B, 0xFA, 0xC3, 0x99, 0x24, 0xE9, 0xE4, 0x78, 0xBA, 0xA4, 0x52, 0x69,
-    0x21, 0xBE, 0x59, 0x1B, 0xEB, 0xB0, 0x33, 0xF9, 0x82, 0x23, 0x6F, 0x11, 0x87, 0xD7, 0x40, 0xD6,
-    0x5B, 0xC0, 0x98, 0xFE, 0xFB, 0xC0, 0x84, 0xDE, 0xD5, 0x77, 0x87, 0x23, 0x6F, 0xCB, 0x6C, 0xDC,
-    0x70, 0x69, 0x2A, 0xB7, 0x92, 0xA2, 0x6D, 0x1C, 0xB6, 0x6C, 0x3A, 0xF2, 0x76, 0xDD, 0x0E, 0xE4,
-    0x0F, 0x8E, 0xE4, 0xDE, 0x47, 0x84, 0x0A, 0x7D, 0x07, 0xF2, 0xBF, 0x86, 0x5F, 0xFC, 0x3A, 0x3E,
-    0x5B, 0x36, 0x77, 0x20, 0x2B, 0x49, 0x8B, 0x8D, 0x5B, 0x7F, 0x3E, 0x9F, 0x21, 0x41, 0x10, 0x16,
-    0xAE, 0x99, 0xD7, 0x1E, 0xF4, 0xEF, 0xE7, 0x98, 0x5E, 0xBB, 0xBC, 0x5C, 0xA4, 0x7F, 0x2F, 0x88,
-    0xEC, 0x01, 0xA1, 0xC1, 0x65, 0x02, 0x9E, 0x86, 0x38, 0x7B, 0x56, 0xAB, 0x6B, 0xAC, 0xD0, 0x4E,
-    0x80, 0x1E, 0xD8, 0xE4, 0x6E, 0xAD, 0xB2, 0xB5, 0x5B, 0xD1, 0x12, 0xBB, 0xF5, 0xA6, 0x84, 0xDA,
-    0xD4, 0x41, 0x02, 0x66, 0xA4, 0x02, 0x8D, 0xC0, 0x6F, 0xBA, 0xE7, 0x47, 0x8E, 0xB5, 0xC4, 0xAF,
-    0xF0, 0xC4, 0x15, 0xF3, 0x08, 0xAC, 0x36, 0x78, 0x85, 0xD5, 0x1E, 0xA7, 0x7C, 0xD5, 0xEC, 0xAC,
-    0xAD, 0xD3, 0x68, 0xB9, 0x48, 0xD9, 0x9E, 0xB0, 0x53, 0x9F, 0xEE, 0xA1, 0xFE, 0x64, 0xE8, 0x2D,
-    0x56, 0xA2, 0x32, 0x69, 0xE7, 0x21, 0x0A, 0x89, 0xA6, 0x1A, 0x00, 0xC5, 0x01, 0xC2, 0x14, 0xC9,
-    0xCB, 0x8B, 0xA2, 0x19, 0xB7, 0x08, 0x93, 0xFD, 0x7E, 0x16, 0x47, 0x0B, 0xD2, 0xC5, 0xCE, 0x57,
-    0x3A, 0xB8, 0x92, 0xA8, 0x4B, 0x0F, 0x0F, 0xC9, 0x98, 0x94, 0xEF, 0x37, 0x0A, 0x13, 0xC8, 0x6F,
-    0xB0, 0x51, 0xA9, 0xC9, 0xA9, 0x9B, 0xBB, 0xBE, 0xDC, 0x54, 0xDC, 0xE3, 0x38, 0x8D, 0x39, 0x3F,
-    0x06, 0xD3, 0xDB, 0xEF, 0x1C, 0x1D, 0xDD, 0x38, 0x53, 0x71, 0x76, 0x93, 0xC5, 0x1A, 0x4B, 0x0E,
-    0x05, 0x67, 0x9C, 0x4C, 0xBA, 0xE6, 0x30, 0xDD, 0xB8, 0x8B, 0xF3, 0xF3, 0xEF, 0xE5, 0xA1, 0x7D,
-    0x67, 0x2E, 0xAD, 0x4F, 0xA5, 0x4D, 0xF7, 0x05, 0x8A, 0xF1, 0x49, 0x7A, 0x23, 0xD4, 0x57, 0xC2,
-    0x46, 0xEB, 0x9B, 0xCF, 0x22, 0xFC, 0xFD, 0x7B, 0x27, 0x83, 0xF1, 0x10, 0x8E, 0xA9, 0xE4, 0xEE,
-    0x1A, 0x37, 0x29, 0x0C, 0x5E, 0x5D, 0xDD, 0xE3, 0xD3, 0x54, 0x37, 0x9F, 0xE5, 0x58, 0x19, 0x37,
-    0xD4, 0x9A, 0x56, 0x38, 0x21, 0xD5, 0x8C, 0x62, 0x6F, 0x95, 0xA8, 0xB8, 0x9C, 0x56, 0xCC, 0xB9,
-    0x75, 0xF4, 0x63, 0xBA, 0xC7, 0xDD, 0x0C, 0x55, 0x57, 0xE4, 0x24, 0x5F, 0x21, 0xA5, 0x21, 0x79,
-    0xC1, 0x91, 0xDD, 0x2E, 0x4B, 0x70, 0x3E, 0x59, 0xD4, 0x8D, 0x73, 0x1D, 0xB9, 0xF2, 0x36, 0x3A,
-    0x65, 0xCE, 0xF6, 0x0D, 0xD0, 0x5E, 0x7E, 0x43, 0x90, 0x3D, 0xE4, 0xF7, 0xF0, 0xDB, 0xB5, 0xF9,
-    0x3D, 0x93, 0xAD, 0x54, 0xCB, 0x8F, 0x13, 0x15, 0x6E, 0x93, 0x40, 0xE4, 0x1B, 0x12, 0x99, 0xED,
-    0x11, 0xFF, 0x3B, 0x2F, 0xF0, 0xD2, 0x9C, 0x59, 0x3D, 0x23, 0x63, 0x29, 0x66, 0x53, 0xBA, 0x01,
-    0xF9, 0xF6, 0x02, 0x7A, 0x32, 0xC9, 0xAF, 0x0A, 0xAD, 0xDB, 0x64, 0xAB, 0xF6, 0x50, 0x5C, 0xE7,
-    0xA5, 0x1B, 0x88, 0x2F, 0x57, 0xFA, 0x91, 0xF4, 0xD8, 0xB6, 0x53, 0xA8, 0xEF, 0xEC, 0x24, 0xA3,
-    0x63, 0x9C, 0xA3, 0x20, 0x68, 0x53, 0x1D, 0x67, 0xA3, 0xB6, 0xE4, 0x33, 0x47, 0x6F, 0x51, 0xC8,
-    0x4F, 0x62, 0x45, 0xAE, 0x39, 0xD3, 0x85, 0x61, 0x17, 0x97, 0xB6, 0x87, 0xB8, 0x77, 0x9F, 0x2B,
-    0x67, 0xBA, 0x30, 0xB0, 0x65, 0xE5, 0xD7, 0x0C, 0xED, 0x34, 0x23, 0xD8, 0xB4, 0x27, 0xCB, 0x57,
-    0xBD, 0xFF, 0x30, 0x10, 0xB3, 0x1A, 0x80, 0xAE, 0x8A, 0xEE, 0x41, 0xD4, 0x1E, 0xF9, 0xB2, 0xB3,
-    0xC1, 0x38, 0xA2, 0xFA, 0x96, 0xF0, 0xA5, 0x12, 0xF5, 0xAD, 0x25, 0xA2, 0xEA, 0x8E, 0x54, 0x92,
-    0xC0, 0x48, 0xA6, 0xFA, 0x1F, 0x97, 0xFC, 0x21, 0x75, 0xCF, 0x26, 0x5E, 0x46, 0xB4, 0xFC, 0x20,
-    0x9A, 0x65, 0x2C, 0x2B, 0x6E, 0xA9, 0x10, 0xA0, 0x5D, 0xF4, 0x9D, 0xF8, 0xE3, 0xCC, 0x2D, 0x6D,
-    0x84, 0xCB, 0x77, 0xAF, 0x1D, 0xC0, 0x32, 0xAE, 0xD4, 0xA6, 0xC7, 0xF1, 0x1E, 0xE4, 0x26, 0x6E,
-    0xA6, 0x26, 0x74, 0x47, 0x72, 0x13, 0xEA, 0x8B, 0x77, 0xF6, 0x2E, 0xC2, 0x1C, 0xC1, 0x72, 0x12,
-    0xF7, 0xED, 0xDE, 0x0C, 0xB5, 0x6E, 0x09, 0xE6, 0x30, 0x05, 0xCC, 0x77, 0x96, 0x71, 0x56, 0xAF,
-    0x9F, 0x73, 0xCF, 0xD4, 0x8C, 0xBA, 0x91, 0xB3, 0xAF, 0xCB, 0xEC, 0xEC, 0x28, 0x88, 0x89, 0xF9,
-    0xE2, 0x91, 0x6D, 0x9D, 0xDA, 0x8D, 0xDD, 0xDA, 0xA5, 0xE5, 0x44, 0xD6, 0x5E, 0xAD, 0xFE, 0xAA,
-    0x91, 0xD7, 0x31, 0xB1, 0x93, 0x74, 0x3E, 0x1E, 0xFD, 0x0C, 0x7B, 0x75, 0x2C, 0x3E, 0xC4, 0x7C,
-    0xD5, 0xD1, 0xF0, 0x51, 0xEA, 0xED, 0x99, 0xF0, 0x4F, 0x45, 0x41, 0xC2, 0xFF, 0x6C, 0x2E, 0x35,
-    0x28, 0xB4, 0x8A, 0x40, 0x0E, 0x41, 0xE6, 0x41, 0xC1, 0xC6, 0xC4, 0x8C, 0x9D, 0xFC, 0x6A, 0xEE,
-    0xB2, 0x7F, 0x20, 0xFD, 0x10, 0x4E, 0xC1, 0x93, 0x32, 0x89, 0x1A, 0xA8, 0x1C, 0x2F, 0xC8, 0xBC,
-    0x7E, 0xA0, 0xDF, 0xCB, 0x51, 0x39, 0x2E, 0x0C, 0xC3, 0x1C, 0xCD, 0x00, 0xF2, 0xB6, 0xAC, 0x74,
-    0xF3, 0xE4, 0x74, 0xC9, 0x43, 0x15, 0xE0, 0xA8, 0xDB, 0x8D, 0xDE, 0x2B, 0xD4, 0xB6, 0xD4, 0x06,
-    0xDD, 0x0F, 0xA6, 0x6C, 0xB3, 0x9D, 0x8F, 0xF7, 0xE2, 0x41, 0x0F, 0x87, 0xC7, 0x60, 0x7D, 0xCF,
-    0x84, 0xEC, 0xE2, 0x28, 0xD8, 0x49, 0xF7, 0x97, 0x59, 0x18, 0xC1, 0x58, 0xC2, 0x2E, 0xC5, 0xCD,
-    0x05, 0xF5, 0xA0, 0x9C, 0x72, 0x18, 0x0C, 0x84, 0x9A, 0x32, 0x10, 0xA6, 0xC5, 0xC4, 0x4B, 0xFA,
-    0x82, 0xF2, 0x9D, 0x75, 0x9B, 0xF4, 0x39, 0x16, 0x3D, 0x8E, 0x69, 0x47, 0x5E, 0x9E, 0x78, 0x9B,
-    0x6E, 0x78, 0xDB, 0x84, 0xCD, 0xC1, 0xA5, 0x93, 0xDF, 0x2D, 0xEF, 0x65, 0xE2, 0x70, 0x94, 0x4F,
-    0x61, 0x17, 0xF2, 0x88, 0x27, 0x23, 0x6C, 0x32, 0xD2, 0x7D, 0x2E, 0x16, 0x7C, 0x91, 0x43, 0x05,
-    0xB0, 0x9E, 0x63, 0x5C, 0x18, 0xA5, 0x79, 0xC4, 0x38, 0x63, 0x0E, 0x1B, 0xBA, 0x1E, 0xB6, 0x23,
-    0x93, 0xCC, 0x73, 0x11, 0xFA, 0x7B, 0x70, 0x1F, 0x7C, 0x7D, 0xCF, 0x68, 0xC8, 0x42, 0x6D, 0x5D,
-    0x59, 0x64, 0x95, 0xD1, 0xAE, 0xE5, 0x80, 0x97, 0x69, 0xB4, 0x97, 0xD3, 0xD0, 0x70, 0x76, 0xA6,
-    0x5D, 0x2E, 0x92, 0x03, 0xF5, 0x58, 0x93, 0x76, 0xF0, 0x97, 0x26, 0xAD, 0x83, 0x6A, 0xD3, 0x91,
-    0x1B, 0x37, 0x63, 0xD6, 0xEB, 0xB5, 0xBA, 0x1F, 0x2C, 0x53, 0x8D, 0xBD, 0xCB, 0xB4, 0xA8, 0x73,
-    0xD0, 0x0C, 0xF6, 0xE2, 0x36, 0x7E, 0xA4, 0xB6, 0xCF, 0xDC, 0x09, 0x5A, 0x62, 0x79, 0xEF, 0x83,
-    0x5A, 0xD6, 0xA7, 0xFB, 0x08, 0x90, 0xCA, 0xFE, 0x97, 0x3C, 0xA0, 0x83, 0x48, 0xB4, 0xE1, 0x4B,
-    0xAB, 0x6C, 0x01, 0x1C, 0xE6, 0xC0, 0x2F, 0xD4, 0xC1, 0xBC, 0x10, 0xF0, 0x98, 0x11, 0xE0, 0xD2,
-    0xFB, 0x6C, 0x89, 0xA2, 0x23, 0x7A, 0xED, 0x9A, 0x78, 0x6C, 0xF7, 0x92, 0x38, 0xD3, 0x79, 0x12,
-    0xB3, 0xA2, 0xF8, 0xE6, 0xCA, 0x51, 0x3E, 0xE2, 0xB9, 0x08, 0x27, 0xE3, 0xFB, 0x3D, 0x3E, 0x5E,
-    0xCD, 0xC2, 0xD6, 0x13, 0xAC, 0xB0, 0x75, 0x85, 0x27, 0x8D, 0xD2, 0x8E, 0x9D, 0xE8, 0xB5, 0x5F,
-    0xB3, 0x62, 0xC6, 0xE3, 0x98, 0xFD, 0xB1, 0x14, 0xF8, 0x57, 0xAC, 0x36, 0x0A, 0x7F, 0xC2, 0x17,
-    0x15, 0x30, 0x7B, 0x0E, 0x4A, 0x7E, 0xD4, 0x67, 0x86, 0x49, 0x4D, 0xB2, 0x05, 0xF4, 0x84, 0xD9,
-    0x83, 0x2A, 0x6E, 0xFD, 0x8D, 0x5A, 0xA0, 0xCE, 0xE6, 0xD6, 0x9F, 0xDD, 0xEC, 0x35, 0x0A, 0x47,
-    0x7D, 0xB0, 0x63, 0x12, 0x38, 0x93, 0x97, 0x7B, 0x2E, 0x6F, 0xAC, 0xE6, 0xD3, 0x85, 0xC3, 0xE2,
-    0x3A, 0x85, 0x43, 0xD3, 0x74, 0xBF, 0x78, 0x9D, 0x52, 0xE6, 0x56, 0xCA, 0xD2, 0x6E, 0xF3, 0x0A,
-    0xAE, 0x39, 0xBE, 0x82, 0xAB, 0xCF, 0xBA, 0xD2, 0xCC, 0x3C, 0xA9, 0xFC, 0x03, 0xB9, 0x9C, 0xA6,
-    0x9A, 0xAD, 0xA7, 0x90, 0xFA, 0x38, 0x55, 0x25, 0x6D, 0xBF, 0x2A, 0x8C, 0x5A, 0x95, 0x02, 0x92,
-    0x91, 0x11, 0xCC, 0x47, 0x5C, 0x37, 0x55, 0x35, 0xFC, 0x2C, 0xF3, 0x8C, 0x3E, 0xEC, 0x5B, 0xEE,
-    0xD7, 0xF2, 0x16, 0x06, 0x69, 0x6B, 0xB1, 0x26, 0x19, 0x2E, 0xEB, 0x09, 0x30, 0x47, 0x77, 0xEE,
-    0xBA, 0xDD, 0xD2, 0xF0, 0x32, 0x39, 0x6A, 0xDA, 0xCE, 0x58, 0x04, 0x88, 0xA3, 0xF8, 0x9D, 0x46,
-    0x90, 0x4B, 0xDF, 0x70, 0xA5, 0xF8, 0x7E, 0x38, 0xE7, 0x6D, 0x1E, 0x0F, 0x0C, 0x93, 0xB1, 0x32,
-    0xCF, 0xE9, 0x0C, 0x28, 0x33, 0xF1, 0x8A, 0x50, 0x24, 0x87, 0xEB, 0x0B, 0x0F, 0xC2, 0x7C, 0xBF,
-    0x5B, 0x28, 0x6F, 0xBA, 0x5D, 0xD1, 0x3B, 0x00, 0x97, 0x71, 0xA9, 0x52, 0xFE, 0xA9, 0x12, 0x26,
-    0x22, 0xBA, 0xE3, 0xEB, 0xBB, 0x91, 0x9C, 0xDF, 0xEE, 0xBA, 0xFB, 0xD5, 0x1F, 0x34, 0x56, 0x35,
-    0x38, 0xD5, 0x5F, 0x0F, 0x95, 0x7D, 0xF7, 0x4C, 0xF4, 0xFF, 0x03, 0x6C, 0xAF, 0x7C, 0x53, 0x98,
-    0x95, 0xB7, 0xE4, 0x5A, 0x75, 0x68, 0x9C, 0xFE, 0x96, 0xAF, 0x00, 0xB6, 0x1B, 0x6F, 0x71, 0x0E,
-    0xF2, 0x8C, 0xF8, 0x2C, 0x6B, 0x60, 0x01, 0xB7, 0xDF, 0xF1, 0x37, 0xBE, 0x09, 0xC5, 0x81, 0x1A,
-    0x81, 0x4E, 0xAB, 0x0A, 0x27, 0x84, 0x3E, 0xB1, 0x22, 0xBD, 0x67, 0x5E, 0xD6, 0xF5, 0xA7, 0x5C,
-    0x3B, 0x53, 0xAC, 0xFE, 0x23, 0x66, 0xE8, 0x0A, 0x33, 0x2D, 0xF4, 0xF3, 0x28, 0x3E, 0x04, 0x3D,
-    0xDD, 0x91, 0x72, 0x82, 0x00, 0x21, 0x86, 0x4A, 0xCB, 0xFB, 0x11, 0x6B, 0xAB, 0xB0, 0xF3, 0x91,
-    0x1C, 0x82, 0x38, 0x6E, 0x32, 0xB3, 0xDC, 0x52, 0x9F, 0xD5, 0x0F, 0x32, 0x46, 0x5E, 0x61, 0xB6,
-    0xA9, 0x08, 0x9C, 0xB2, 0x17, 0x54, 0x8A, 0xC0, 0x95, 0x49, 0x41, 0x2F, 0x2D, 0x1D, 0x96, 0x79,
-    0xB0, 0xD9, 0xA3, 0x0F, 0x1F, 0xCF, 0x6D, 0xCC, 0x35, 0x8A, 0xA6, 0xE6, 0x0A, 0x78, 0x16, 0xA9,
-    0xEB, 0xF3, 0x8F, 0x61, 0x36, 0x39, 0x38, 0x18, 0x64, 0xDF, 0xC6, 0xEF, 0xE7, 0x21, 0xFA, 0x04,
-    0x6A, 0xF1, 0xF3, 0xF5, 0x26, 0x75, 0x77, 0x74, 0xD9, 0x33, 0xF2, 0x2B, 0x79, 0x31, 0x27, 0xB3,
-    0xD6, 0xD9, 0xC0, 0xB0, 0x5B, 0x68, 0x25, 0x6A, 0x82, 0x32, 0xA8, 0x36, 0xE9, 0xDC, 0xD3, 0x92,
-    0x31, 0xBF, 0x28, 0x19, 0xF4, 0x93, 0x95, 0x68, 0xDB, 0xE2, 0x57, 0x46, 0x9B, 0x5D, 0xA8, 0xF0,
-    0x11, 0xF8, 0x23, 0x5C, 0xB7, 0x98, 0xA6, 0xBB, 0xDB, 0xA7, 0xD1, 0xA2, 0x15, 0x18, 0x51, 0x44,
-    0x65, 0x98, 0x68, 0xE4, 0x97, 0x68, 0xFF, 0xCF, 0x87, 0x66, 0x25, 0xC2, 0x00, 0x0E, 0xC1, 0x97,
-    0x6F, 0xFF, 0x17, 0x74, 0x0E, 0x49, 0x6B, 0xA1, 0xD0, 0xE7, 0xF1, 0xD9, 0x3E, 0x9C, 0x5C, 0xBE,
-    0xC1, 0xB1, 0x00, 0x79, 0x7F, 0x4C, 0x5F, 0x18, 0xBE, 0xC1, 0xB1, 0x80, 0x9B, 0x5B, 0x37, 0x8F,
-    0x3F, 0xC5, 0x6F, 0x2F, 0x2D, 0xDF, 0xE4, 0xBA, 0x6F, 0xB4, 0xBE, 0x8F, 0xD3, 0x5C, 0x9F, 0x4E,
-    0xBF, 0xCC, 0xFA, 0x6E, 0x97, 0xE1, 0xB7, 0xB8, 0xF0, 0x9B, 0x65, 0xF8, 0x97, 0x26, 0xC8, 0xC9,
-    0x08, 0x25, 0xDF, 0x6A, 0x3E, 0x87, 0x27, 0xEF, 0xFE, 0x5B, 0x9B, 0xC8, 0x4B, 0x1B, 0x5C, 0x1C,
-    0x95, 0xE1, 0xE4, 0x0D, 0xE8, 0xB7, 0xF1, 0x22, 0x81, 0x29, 0x23, 0x36, 0xB6, 0x61, 0xF7, 0xE6,
-    0x85, 0x78, 0x82, 0x21, 0x3C, 0x3D, 0x39, 0xA5, 0xF1, 0xA2, 0x0A, 0xD9, 0xEF, 0xEF, 0xD4, 0xF2,
-    0xDA, 0x01, 0x78, 0x70, 0x5C, 0xCF, 0x91, 0x93, 0x25, 0x71, 0x3A, 0xBD, 0x05, 0xE1, 0x61, 0xCA,
-    0x22, 0x41, 0xFC, 0x18, 0x67, 0xFC, 0xF3, 0xA1, 0x30, 0x23, 0x2F, 0xAE, 0x33, 0xC1, 0x28, 0x9F,
-    0xFE, 0xD0, 0x90, 0x5C, 0x64, 0x29, 0xEF, 0x3B, 0x4C, 0x22, 0x85, 0x13, 0x16, 0xBA, 0x09, 0x63,
-    0x81, 0x8B, 0xDC, 0x40, 0xDA, 0xB8, 0xF1, 0xDE, 0xDD, 0x1B, 0xA2, 0xF9, 0xE6, 0x02, 0x15, 0x73,
-    0xA9, 0x7C, 0x77, 0xC1, 0xF8, 0xE5, 0x05, 0xF7, 0x8E, 0x7C, 0x73, 0x3C, 0xA7, 0x7E, 0x8A, 0x39,
-    0x35, 0xA6, 0xFF, 0x0F, 0x65, 0xF7, 0x92, 0x7C, 0xA5, 0x1A, 0x79, 0xD3, 0x4B, 0x29, 0x2D, 0xAA,
-    0xF2, 0x0A, 0xD4, 0xDD, 0xCE, 0x18, 0xCB, 0x09, 0x13, 0x0C, 0x17, 0x0C, 0x1B, 0x0C, 0x1F, 0x0C,
-    0x23, 0x7A, 0x4E, 0x18, 0x56, 0x18, 0x5E, 0x18, 0x66, 0x18, 0x6E, 0x18, 0x76, 0x6C, 0x7A, 0x91,
-    0xA1, 0xA9, 0x34, 0x99, 0xF0, 0xF8, 0xA1, 0x49, 0x6B, 0x9C, 0xD4, 0x77, 0x85, 0x2D, 0x9B, 0xF8,
-    0x72, 0x23, 0xB9, 0xB8, 0x8B, 0x2F, 0x14, 0x94, 0xA5, 0x82, 0xBB, 0xA1, 0x53, 0xC8, 0x67, 0xCA,
-    0xC3, 0xDD, 0xEA, 0x7B, 0x5F, 0xAE, 0xDF, 0x67, 0x79, 0xBD, 0x70, 0x69, 0xD2, 0x97, 0xFA, 0xE5,
-    0x3A, 0x3F, 0x0D, 0x3B, 0x27, 0x47, 0xF4, 0xCC, 0x90, 0xF4, 0xB6, 0xD6, 0x5A, 0x5A, 0x5A, 0x74,
-    0x98, 0x36, 0xD2, 0x56, 0x29, 0xDD, 0x2E, 0x9D, 0x92, 0xB6, 0x90, 0x4D, 0x15, 0xE2, 0xA1, 0x73,
-    0x95, 0x8C, 0xE6, 0x8B, 0xD3, 0xB4, 0x9A, 0x24, 0x7A, 0x20, 0x38, 0x3B, 0x1A, 0xB3, 0x23, 0x5B,
-    0x57, 0xA6, 0x05, 0xA6, 0xEE, 0x41, 0x74, 0x60, 0xDE, 0xCA, 0x6E, 0x2E, 0x8B, 0x33, 0x9B, 0xDE,
-    0x61, 0xF7, 0x15, 0xBE, 0xF4, 0x6F, 0x02, 0x7C, 0x95, 0x40, 0xDF, 0xC1, 0xC7, 0x4D, 0xE1, 0xFC,
-    0xBB, 0xF7, 0xF6, 0x99, 0xBB, 0xD7, 0xE7, 0x6B, 0x8E, 0xFE, 0x48, 0xDB, 0xC3, 0xE3, 0xE3, 0x46,
-    0x8E, 0x0B, 0xEA, 0x26, 0x1B, 0x80, 0x19, 0xD2, 0x5F, 0xEE, 0xBB, 0xA4, 0xFA, 0x4C, 0xDE, 0x96,
-    0x73, 0x46, 0x3D, 0x45, 0x2D, 0xEF, 0x6D, 0x01, 0xBE, 0x3F, 0x42, 0x20, 0xD9, 0xBB, 0x2D, 0x67,
-    0xA7, 0xEC, 0x44, 0x72, 0x47, 0x4A, 0xEF, 0xF5, 0xB8, 0xD9, 0x96, 0xD5, 0xAC, 0x7F, 0x50, 0x0E,
-    0xA7, 0x6F, 0x28, 0xB1, 0x37, 0x4B, 0xA8, 0x2F, 0x11, 0xE9, 0xCC, 0xF2, 0xFA, 0xE2, 0xB5, 0x84,
-    0x76, 0xBF, 0x8B, 0xD0, 0x2F, 0x26, 0xC5, 0xE6, 0xC4, 0xD6, 0xE3, 0xED, 0xE2, 0xEF, 0xE8, 0x22,
-    0xF8, 0x7F, 0xC5, 0x9A, 0x3F, 0x8C, 0x1C, 0x57, 0x1D, 0xC7, 0x7F, 0x33, 0x9B, 0xF3, 0x28, 0x37,
-    0x52, 0xC6, 0x42, 0x67, 0x11, 0x63, 0x92, 0xA5, 0xA0, 0x88, 0xAC, 0xF8, 0xA6, 0xA1, 0x30, 0xCA,
-    0xDD, 0xCD, 0x60, 0x0A, 0x90, 0x40, 0x64, 0x8B, 0xF4, 0x34, 0x69, 0x82, 0x10, 0x47, 0x61, 0x24,
-    0x0B, 0xD9, 0xCC, 0x50, 0xD3, 0x98, 0x22, 0x25, 0x8A, 0x0B, 0x17, 0x51, 0x9A, 0xB8, 0x30, 0xD2,
-    0x15, 0xC6, 0x33, 0x41, 0x48, 0x29, 0x68, 0x06, 0x53, 0xA4, 0xA0, 0x19, 0x28, 0x40, 0x22, 0x12,
-    0x99, 0xA0, 0x4D, 0xB4, 0x8E, 0x77, 0xF7, 0xF1, 0xFD, 0xFE, 0x7E, 0x33, 0xBB, 0x7B, 0xE6, 0xAF,
-    0xB8, 0xDD, 0xD9, 0xDD, 0x9B, 0x77, 0xB3, 0x7B, 0x33, 0xEF, 0xBD, 0xCF, 0xEF, 0xF7, 0xDE, 0xEF,
-    0xDF, 0x9C, 0x88, 0xCC, 0x45, 0xC4, 0x77, 0x68, 0x06, 0x6C, 0xC2, 0x02, 0xCD, 0x8B, 0x59, 0x2A,
-    0x72, 0xC0, 0xE6, 0x7A, 0x92, 0x8B, 0x34, 0x68, 0xFC, 0x2A, 0x29, 0x65, 0x50, 0xA2, 0x09, 0xDF,
-    0xCC, 0x4A, 0x19, 0x3A, 0x57, 0xC9, 0xA1, 0xC4, 0x95, 0xDC, 0x90, 0x61, 0x2D, 0x8D, 0x44, 0xB5,
-    0x5F, 0x4B, 0xD4, 0x5C, 0x1A, 0xCB, 0xF1, 0xE3, 0x64, 0xE6, 0x3B, 0xF6, 0xDA, 0xBD, 0x06, 0x13,
-    0x34, 0xC1, 0xB4, 0x3B, 0x13, 0xF4, 0x2B, 0xBB, 0xB7, 0x47, 0x52, 0xB8, 0x66, 0x30, 0x19, 0xD6,
-    0x51, 0x3D, 0xAC, 0xE2, 0x32, 0x2E, 0x93, 0x3C, 0x29, 0xB3, 0x34, 0x29, 0x0B, 0xC9, 0x72, 0x27,
-    0x45, 0xEA, 0x04, 0x6F, 0xCC, 0xCC, 0x05, 0xF8, 0x66, 0x5A, 0x4C, 0xE2, 0x71, 0x52, 0x2F, 0xFA,
-    0x44, 0xFF, 0x9E, 0xB3, 0xDF, 0x72, 0x5E, 0xBF, 0xB9, 0xCC, 0xE6, 0x49, 0x89, 0xE6, 0xEB, 0x15,
-    0x41, 0x78, 0x76, 0xC4, 0xEF, 0xAE, 0xAE, 0xDE, 0xB4, 0x11, 0x54, 0xEF, 0x2E, 0xF8, 0xD0, 0xF9,
-    0xCE, 0x10, 0x3D, 0x1E, 0x62, 0x66, 0x63, 0x1C, 0xA5, 0x8D, 0x79, 0x46, 0x50, 0x8F, 0xC2, 0x92,
-    0x80, 0x9D, 0x65, 0xDF, 0xE1, 0x67, 0x47, 0xB8, 0xE0, 0x11, 0x2F, 0xD8, 0x95, 0x3B, 0x72, 0x8A,
-    0xCD, 0xE0, 0x8C, 0xCE, 0xF0, 0x8C, 0xCF, 0x00, 0x8D, 0x50, 0x11, 0x8D, 0xD1, 0x20, 0x8D, 0xD2,
-    0x30, 0x8D, 0xD3, 0x40, 0x95, 0x54, 0x14, 0x55, 0x94, 0x55, 0x16, 0x7A, 0x7D, 0x46, 0x31, 0xFD,
-    0xBB, 0xB8, 0x62, 0x96, 0xCA, 0x51, 0x8C, 0x6B, 0xC3, 0xF4, 0xEC, 0xB4, 0x23, 0x36, 0x37, 0xD9,
-    0xBC, 0xC0, 0xF9, 0x7A, 0xAE, 0x6C, 0x49, 0x57, 0x40, 0x37, 0xA4, 0x42, 0x8F, 0x3D, 0x62, 0x38,
-    0xEF, 0x11, 0x54, 0x39, 0xC4, 0x52, 0x5D, 0x1B, 0x94, 0xC8, 0xB3, 0xDA, 0xBE, 0x92, 0xAB, 0x6A,
-    0xF2, 0xA5, 0x22, 0x7F, 0xB3, 0x7D, 0x45, 0x42, 0xE2, 0x83, 0x07, 0xEC, 0xD6, 0x94, 0x39, 0xCD,
-    0xD7, 0xC8, 0x3D, 0xC2, 0x2A, 0xF1, 0xE7, 0xDF, 0x07, 0xE3, 0x5B, 0xDC, 0x0E, 0x1E, 0xB5, 0xDB,
-    0xB7, 0x5A, 0x85, 0x7A, 0x1D, 0xFE, 0xB1, 0x92, 0xAF, 0x62, 0xD0, 0xF3, 0x17, 0x31, 0x06, 0xD4,
-    0x1B, 0xAD, 0x57, 0xBD, 0x7C, 0x51, 0xEE, 0xBA, 0x33, 0x83, 0x47, 0x0D, 0x66, 0x2E, 0xF7, 0x37,
-    0xCD, 0xB5, 0x7C, 0x79, 0x33, 0x0E, 0xA1, 0xE3, 0x4C, 0x17, 0x9B, 0xA8, 0xB5, 0xB7, 0x43, 0xFC,
-    0xED, 0x08, 0x36, 0x69, 0x1C, 0xAC, 0x87, 0xF4, 0x9F, 0x8D, 0xAE, 0xBE, 0x7C, 0x5E, 0x41, 0x61,
-    0xFA, 0xDF, 0xFC, 0x12, 0x48, 0xDF, 0xAB, 0x5B, 0x25, 0xCB, 0x1B, 0xD2, 0x8B, 0x1C, 0x68, 0x75,
-    0x6F, 0x88, 0xEC, 0xFD, 0x1C, 0xFD, 0x45, 0x46, 0x1D, 0xD4, 0xB2, 0x2E, 0xDD, 0xAA, 0x2E, 0x0F,
-    0x64, 0x5B, 0x74, 0x61, 0x6E, 0x96, 0x69, 0x43, 0x74, 0x31, 0x2D, 0xC9, 0xE7, 0xCA, 0x4E, 0x81,
-    0xDF, 0xDE, 0x06, 0xA2, 0x87, 0xA8, 0xC0, 0x7B, 0xB9, 0x55, 0xE2, 0xEF, 0xD6, 0x8D, 0xB9, 0x47,
-    0x6F, 0xE5, 0x60, 0x87, 0x06, 0x7F, 0xE0, 0x38, 0xDC, 0x20, 0x7E, 0xDA, 0x37, 0x26, 0xED, 0x50,
-    0xF4, 0x49, 0x25, 0xFB, 0x45, 0x29, 0x7B, 0x5F, 0xC0, 0xA4, 0xBC, 0x4D, 0x68, 0x33, 0x48, 0xAF,
-    0x63, 0xE6, 0x7F, 0x6E, 0xC8, 0x40, 0xAE, 0x9F, 0xF4, 0xB3, 0xFF, 0xD4, 0xE6, 0x0C, 0xA6, 0x8B,
-    0x20, 0x6F, 0xBC, 0xBA, 0xC0, 0xAE, 0xC2, 0xE5, 0x1D, 0x1D, 0xAF, 0x8F, 0xF4, 0x75, 0x33, 0x74,
-    0x83, 0x99, 0xAD, 0x1B, 0x7D, 0x39, 0xE7, 0x6A, 0x39, 0xFE, 0xEC, 0xDD, 0x0A, 0x93, 0x1B, 0xA0,
-    0xA9, 0xB1, 0x61, 0x86, 0xB5, 0x5F, 0xAA, 0x0F, 0x14, 0xBA, 0x46, 0x6B, 0x32, 0x87, 0xA9, 0x65,
-    0x6F, 0x62, 0xBA, 0xEA, 0x52, 0x5D, 0xD7, 0x78, 0x73, 0xF8, 0x22, 0x7F, 0x06, 0xC3, 0x0D, 0x8A,
-    0x43, 0xB9, 0x34, 0x7F, 0x67, 0x8A, 0x6B, 0xDD, 0xB4, 0xED, 0x7E, 0x47, 0x16, 0x1D, 0x68, 0x57,
-    0x69, 0xC7, 0x76, 0x0E, 0xDE, 0xA4, 0x98, 0xCB, 0xA0, 0x29, 0x24, 0xAA, 0x32, 0x89, 0x31, 0xFB,
-    0x24, 0x9D, 0x49, 0x11, 0x4E, 0x30, 0xA5, 0x5C, 0xDC, 0xC8, 0xBA, 0xE7, 0x91, 0xE5, 0x5F, 0x91,
-    0xE4, 0x49, 0x23, 0xA1, 0xCB, 0xCD, 0x66, 0xA2, 0x13, 0xFA, 0xE6, 0x18, 0x47, 0x54, 0x2E, 0x3A,
-    0xBC, 0x8D, 0x66, 0x5F, 0xE5, 0x77, 0xC2, 0x86, 0x67, 0x01, 0xBF, 0x0B, 0x65, 0xE3, 0xA8, 0x3E,
-    0xC6, 0x19, 0x42, 0xA2, 0xCF, 0xDC, 0xB4, 0xD1, 0x07, 0x35, 0x17, 0x94, 0xE8, 0xD2, 0x3D, 0x03,
-    0x68, 0xFB, 0x4A, 0xAE, 0xE1, 0xA3, 0xFB, 0x10, 0x6B, 0xEC, 0x03, 0x47, 0xFA, 0x93, 0x5E, 0x54,
-    0x97, 0x7C, 0xAD, 0x14, 0xF7, 0x24, 0xE7, 0x98, 0x5E, 0x37, 0xE4, 0x19, 0x59, 0xF6, 0x5A, 0xE5,
-    0x04, 0x1F, 0x63, 0x82, 0xF1, 0x63, 0x7C, 0x78, 0xC0, 0x88, 0xFF, 0xF6, 0x6E, 0x0F, 0x40, 0x7B,
-    0x1A, 0x1F, 0xFB, 0x77, 0x6A, 0x8D, 0xBB, 0x6F, 0x1D, 0x89, 0x57, 0x87, 0x67, 0x87, 0xDA, 0xE9,
-    0xDC, 0x8C, 0xF8, 0xEF, 0xC3, 0x74, 0xC8, 0xF1, 0xA4, 0x3F, 0x28, 0x2E, 0xAE, 0x80, 0x61, 0xEC,
-    0xAF, 0x11, 0x0A, 0x7E, 0x17, 0x90, 0xEB, 0x82, 0xE2, 0xEC, 0xD9, 0xB7, 0x7A, 0xEF, 0xEB, 0x9D,
-    0xBA, 0x26, 0xBD, 0xAA, 0x8B, 0xD1, 0xF5, 0x89, 0x26, 0xA0, 0xAA, 0xB2, 0xE9, 0xFA, 0x54, 0x06,
-    0x9D, 0x61, 0x67, 0x26, 0x7F, 0xC1, 0xCC, 0x7E, 0xC9, 0x0B, 0x52, 0xAE, 0x8C, 0x80, 0xCA, 0xEB,
-    0x15, 0x91, 0xDA, 0x8B, 0x1F, 0x95, 0xF2, 0x63, 0xCC, 0x6B, 0xC4, 0xE8, 0xFA, 0x8E, 0x45, 0xD7,
-    0xEB, 0x53, 0x62, 0x17, 0xC9, 0x4A, 0x44, 0x5F, 0xC3, 0x58, 0x76, 0x11, 0xCC, 0x6E, 0xCD, 0xEA,
-    0xAF, 0x46, 0xD7, 0xB7, 0xE2, 0xB5, 0x90, 0xFE, 0x4B, 0x6F, 0xE0, 0xBD, 0x8D, 0x71, 0x30, 0x65,
-    0x8F, 0xD4, 0xFB, 0xE6, 0x0D, 0xBC, 0xAA, 0x63, 0xCF, 0xE5, 0x78, 0x9E, 0x32, 0xA5, 0x63, 0x72,
-    0x67, 0x37, 0x57, 0x36, 0x5F, 0x3D, 0x72, 0x4B, 0xB6, 0x8A, 0x74, 0x31, 0x28, 0x70, 0x49, 0xAB,
-    0x8E, 0xFA, 0x12, 0x6E, 0xCD, 0x18, 0x22, 0xDC, 0x65, 0x40, 0xE0, 0x47, 0x1A, 0x43, 0x63, 0xE5,
-    0xD4, 0x2C, 0xCE, 0x5C, 0x18, 0x49, 0x36, 0x66, 0xCF, 0x91, 0x26, 0x8E, 0xE8, 0x7A, 0x58, 0x81,
-    0x86, 0xFD, 0xA2, 0xDB, 0x4C, 0x7F, 0x92, 0xA9, 0xC4, 0xE3, 0xB5, 0xCE, 0xA4, 0xAD, 0x75, 0x68,
-    0x37, 0x38, 0xC2, 0x6A, 0x29, 0xEC, 0x42, 0xEF, 0x72, 0xAD, 0xED, 0xDD, 0x79, 0x8D, 0x92, 0xC7,
-    0xBD, 0xFC, 0x99, 0x48, 0x80, 0x9F, 0xB1, 0x84, 0xAB, 0xB3, 0xC5, 0x5E, 0x73, 0x12, 0x32, 0x2F,
-    0x92, 0x8B, 0x3A, 0xB0, 0x4B, 0x57, 0x42, 0x21, 0x06, 0x7D, 0x98, 0xFA, 0xF0, 0xAF, 0x8E, 0x3D,
-    0x27, 0xA5, 0x37, 0x05, 0x1F, 0x3A, 0x8A, 0x1A, 0x45, 0xE6, 0xDD, 0x4D, 0xCC, 0x35, 0x85, 0xD9,
-    0x47, 0x0D, 0xC3, 0x20, 0x36, 0x71, 0x45, 0xEA, 0x92, 0x0D, 0x22, 0x15, 0xBB, 0x71, 0x86, 0xA1,
-    0x30, 0x76, 0x30, 0x3B, 0xC6, 0x64, 0x0B, 0x8E, 0xE7, 0xFD, 0xE7, 0x70, 0x01, 0xDB, 0x03, 0x31,
-    0x53, 0x30, 0x4E, 0xF2, 0xA8, 0x46, 0xC8, 0x53, 0x0E, 0xD1, 0xE9, 0xB0, 0x2A, 0xD2, 0xB8, 0x72,
-    0x10, 0xB0, 0xC3, 0x4D, 0xCE, 0xC2, 0x1F, 0x29, 0xD0, 0x79, 0xF2, 0xE1, 0x78, 0xB9, 0x15, 0x60,
-    0xCC, 0x40, 0xAA, 0xC7, 0xA0, 0xF9, 0xDF, 0xC3, 0x85, 0x0D, 0xA3, 0xB2, 0xF0, 0x45, 0x41, 0xEF,
-    0xEC, 0x2F, 0x0B, 0x5F, 0x7E, 0x79, 0x76, 0xDA, 0xCE, 0xCF, 0xA2, 0xBB, 0xF0, 0x4F, 0x65, 0xEB,
-    0x67, 0x27, 0x37, 0x19, 0xA4, 0xEC, 0xF6, 0x43, 0xD6, 0xAA, 0x11, 0x5C, 0xFE, 0xDB, 0xF7, 0x09,
-    0x09, 0x2D, 0xEE, 0x73, 0x23, 0xDE, 0x0F, 0xF2, 0x15, 0x75, 0x92, 0x50, 0x11, 0x85, 0x8C, 0x42,
-    0x48, 0x21, 0xA5, 0x10, 0x53, 0xC8, 0x29, 0x04, 0x15, 0x92, 0x0A, 0x51, 0x95, 0x55, 0x61, 0x57,
-    0x69, 0x75, 0xAC, 0x88, 0x0B, 0x65, 0xF0, 0x5B, 0x86, 0xB9, 0xD9, 0xB8, 0x67, 0x5E, 0x6E, 0xBD,
-    0x01, 0xB7, 0xDC, 0xDF, 0x61, 0x74, 0x2E, 0xCD, 0x8C, 0xB5, 0x43, 0x3D, 0x9B, 0x26, 0xD5, 0x0F,
-    0xEF, 0xDE, 0xE3, 0xE9, 0x3D, 0xAA, 0x93, 0x7E, 0xF8, 0x93, 0xFE, 0xD5, 0x09, 0xEB, 0xEB, 0xD1,
-    0xB4, 0x7F, 0x51, 0x15, 0x4A, 0x7D, 0xAE, 0x0D, 0x51, 0xB5, 0x97, 0x7D, 0x80, 0x8F, 0x9F, 0x2E,
-    0x9C, 0x71, 0x48, 0x35, 0xC6, 0x7D, 0xAB, 0xD1, 0xF2, 0xCC, 0x71, 0x2D, 0x87, 0xC8, 0x33, 0xCF,
-    0xEF, 0x72, 0xF1, 0xDA, 0x06, 0x5D, 0x9F, 0x3A, 0x75, 0xA5, 0xD2, 0x02, 0x25, 0x8C, 0x34, 0x26,
-    0x07, 0x2C, 0x41, 0x3E, 0xB7, 0x65, 0xC3, 0x2A, 0x6D, 0xFE, 0xC9, 0x20, 0xE1, 0x08, 0xCE, 0xEC,
-    0xFE, 0x20, 0xDF, 0x8C, 0xC1, 0x5D, 0x3A, 0xA4, 0xAE, 0xDC, 0x66, 0x29, 0x6D, 0x27, 0x00, 0x5C,
-    0x09, 0x19, 0x20, 0x01, 0x86, 0x10, 0x70, 0x0E, 0x98, 0xF7, 0x6A, 0x8A, 0xE1, 0xF7, 0x25, 0xE5,
-    0x30, 0x6F, 0x9D, 0xAA, 0x4A, 0x42, 0x54, 0x14, 0xA2, 0xB2, 0x10, 0x15, 0x86, 0xA8, 0x34, 0xD4,
-    0xBB, 0x96, 0xDA, 0xEA, 0x49, 0x21, 0x26, 0x11, 0x13, 0x49, 0x2B, 0x13, 0x13, 0x4A, 0xB7, 0xB4,
-    0xAD, 0x08, 0x56, 0x77, 0x22, 0xE1, 0xBC, 0xFC, 0xEA, 0x1C, 0x4F, 0x87, 0x25, 0x64, 0x80, 0xC6,
-    0xCD, 0xA3, 0x12, 0x52, 0xF8, 0x19, 0xAD, 0xD4, 0x8C, 0x56, 0xAA, 0xFE, 0x7F, 0xAC, 0x54, 0x5B,
-    0xED, 0xB3, 0x00, 0x69, 0x66, 0xE5, 0x23, 0xAB, 0x51, 0xA5, 0xDB, 0xC6, 0xCF, 0x16, 0xB5, 0x2C,
-    0x7D, 0xEE, 0xE3, 0xD5, 0x9B, 0xC0, 0x57, 0x77, 0xDB, 0xFA, 0x5B, 0x73, 0xB8, 0xEA, 0x71, 0xCD,
-    0xE5, 0x2E, 0x7C, 0xEE, 0x56, 0x84, 0x40, 0x47, 0x6C, 0x21, 0x8F, 0xBA, 0x62, 0xFA, 0x62, 0x75,
-    0xC6, 0xF0, 0xC6, 0x1B, 0x5B, 0x08, 0xF2, 0x30, 0xD0, 0xAA, 0xD2, 0x47, 0x14, 0xC1, 0x5B, 0x1C,
-    0xFB, 0x9C, 0x37, 0xDE, 0xF6, 0x42, 0x88, 0x73, 0x7C, 0x9D, 0xF1, 0x31, 0xE0, 0xA7, 0x9C, 0x6F,
-    0xFE, 0x83, 0xCD, 0xE1, 0x6F, 0x09, 0x53, 0x81, 0x18, 0x92, 0x8B, 0xE5, 0x0B, 0x38, 0x3F, 0x35,
-    0xB3, 0x0D, 0x00, 0xBF, 0x2E, 0x16, 0xB0, 0x6B, 0xD5, 0x6D, 0x59, 0x76, 0x93, 0xC4, 0x55, 0x6E,
-    0x12, 0xCF, 0xD3, 0xE3, 0x1A, 0x66, 0x32, 0x62, 0x1C, 0xFE, 0x1C, 0x23, 0xF1, 0x17, 0xC8, 0x78,
-    0x85, 0xCD, 0x01, 0xE1, 0x0F, 0x88, 0x79, 0x95, 0xC3, 0x5C, 0x67, 0x73, 0x8F, 0xA4, 0x0D, 0x07,
-    0x84, 0xC4, 0x52, 0x0F, 0x13, 0x4A, 0x07, 0x8C, 0x9C, 0xC2, 0x5C, 0xE2, 0xCF, 0x1E, 0x02, 0xD9,
-    0x8D, 0xFF, 0xDB, 0xB8, 0x17, 0x5E, 0xF3, 0x46, 0xD9, 0x38, 0x18, 0x47, 0x4D, 0xD8, 0x44, 0xF6,
-    0xAE, 0x87, 0x7C, 0x57, 0x71, 0x45, 0x33, 0xAF, 0xEF, 0xBC, 0xC8, 0xB3, 0x9F, 0xBA, 0x3C, 0x7B,
-    0x3F, 0xCB, 0x93, 0x69, 0x32, 0x8D, 0x9B, 0x36, 0x61, 0xB9, 0x28, 0x6D, 0x32, 0x92, 0xAE, 0x14,
-    0x48, 0x2F, 0x53, 0x68, 0x4F, 0x28, 0xD3, 0x6B, 0x75, 0xF7, 0xBC, 0x55, 0x37, 0xD2, 0xCB, 0x3D,
-    0xA1, 0x22, 0x13, 0xD3, 0xDA, 0x2C, 0x73, 0x31, 0xB5, 0xAA, 0x84, 0xAD, 0xF5, 0x61, 0xF9, 0x99,
-    0x68, 0x3B, 0xCF, 0xAC, 0xA5, 0x5A, 0xAB, 0xCC, 0x5A, 0x82, 0x79, 0xA5, 0xF3, 0xE5, 0x25, 0xD1,
-    0x5E, 0xAD, 0xC8, 0x16, 0x96, 0x84, 0x0B, 0x4A, 0xD2, 0x45, 0xC4, 0x1B, 0x9E, 0x10, 0x6D, 0x3F,
-    0x35, 0x40, 0x23, 0x34, 0x44, 0x63, 0x34, 0x48, 0xA3, 0x34, 0x4C, 0xE3, 0x34, 0x50, 0x23, 0x35,
-    0xD4, 0x53, 0xAC, 0xA7, 0xC2, 0x08, 0xAE, 0xB2, 0x5F, 0xA9, 0xCD, 0x96, 0x97, 0xD4, 0xAA, 0x90,
-    0xF7, 0x21, 0x81, 0x0F, 0x49, 0x7C, 0x00, 0xDC, 0x8F, 0xC9, 0x3C, 0x4F, 0x09, 0x2D, 0xA4, 0x16,
-    0x62, 0x4B, 0xA2, 0x0D, 0xC0, 0x85, 0xE4, 0x42, 0x74, 0x21, 0xBB, 0x3C, 0x0D, 0x4F, 0x6D, 0x49,
-    0x1B, 0xFE, 0x21, 0x65, 0xD7, 0xF6, 0xC5, 0xAD, 0xE3, 0x17, 0x4F, 0xBB, 0xAC, 0x4D, 0xE0, 0xEB,
-    0xBA, 0xB6, 0x85, 0x6D, 0x2B, 0xDB, 0x96, 0xB6, 0xAD, 0xED, 0xC5, 0xE2, 0xDE, 0x8E, 0x10, 0xEE,
-    0x76, 0x8F, 0x23, 0x74, 0xCD, 0x5B, 0x28, 0xA1, 0x5B, 0x5C, 0x25, 0x91, 0x6E, 0x62, 0x21, 0xC8,
-    0x2C, 0xD0, 0x41, 0xFF, 0xC6, 0xC9, 0xB0, 0xDC, 0x28, 0x3B, 0x7E, 0xBD, 0xED, 0x85, 0x10, 0x55,
-    0x3F, 0xC4, 0x25, 0x73, 0x5C, 0xFD, 0x23, 0x16, 0x42, 0x46, 0xFB, 0x1B, 0xDB, 0x07, 0xDB, 0xC2,
-    0xB4, 0xFF, 0x80, 0xC8, 0xD4, 0x9F, 0x14, 0xDA, 0x26, 0xA7, 0x67, 0xB5, 0x7E, 0xE0, 0x67, 0x17,
-    0x23, 0x6A, 0xF3, 0xD4, 0x78, 0x71, 0xD9, 0xA5, 0x68, 0x7E, 0xD3, 0x16, 0x88, 0x6D, 0x4F, 0xBA,
-    0x6B, 0xAE, 0xCE, 0x1E, 0x7B, 0xC5, 0x6D, 0x48, 0xE0, 0x10, 0x99, 0x94, 0xDC, 0x60, 0x06, 0xD0,
-    0x20, 0xBB, 0x00, 0xE0, 0x60, 0x8A, 0x40, 0xD7, 0x9F, 0x31, 0xD8, 0x9F, 0xF3, 0x81, 0xB0, 0x63,
-    0x71, 0xB9, 0xA8, 0xBB, 0x7C, 0x44, 0x07, 0xA2, 0x67, 0x59, 0x96, 0x18, 0x3F, 0xCF, 0xA2, 0x5F,
-    0xE2, 0x96, 0xF9, 0x83, 0x66, 0x2F, 0x51, 0x25, 0x5D, 0x52, 0xD1, 0xFD, 0xA3, 0xC0, 0x85, 0x91,
-    0xDC, 0x91, 0x64, 0xAC, 0xF5, 0x2C, 0x5F, 0x4B, 0x5B, 0x53, 0x06, 0xDA, 0x27, 0x7C, 0xBC, 0xDF,
-    0xF0, 0xF1, 0x1D, 0x46, 0x71, 0xAC, 0xAC, 0x14, 0x4C, 0x6D, 0xB2, 0x57, 0xD9, 0xD5, 0x2F, 0xBA,
-    0x24, 0x2C, 0x6E, 0xBA, 0x4E, 0xA3, 0xBC, 0xDB, 0xDB, 0x0F, 0xDA, 0x82, 0xF0, 0x65, 0xCA, 0x5B,
-    0xAF, 0xDA, 0x34, 0x9B, 0x96, 0xDB, 0x39, 0x50, 0x38, 0x91, 0x53, 0x39, 0xD3, 0x5A, 0xD9, 0x9E,
-    0x27, 0x5B, 0x41, 0x36, 0x47, 0xB6, 0x87, 0x76, 0x95, 0xC8, 0xF7, 0x68, 0x42, 0x3F, 0xE2, 0x25,
-    0xDF, 0x28, 0xBB, 0x8B, 0x0F, 0x7B, 0x53, 0xED, 0x1B, 0x9A, 0xFC, 0xF2, 0x61, 0xD9, 0xB7, 0xF2,
-    0xAE, 0x92, 0x73, 0xAB, 0xAD, 0x78, 0xF4, 0xA5, 0xDF, 0xCE, 0xD5, 0xBD, 0xC4, 0x3C, 0x18, 0xD3,
-    0xBF, 0x92, 0xE1, 0xCF, 0x5F, 0x0E, 0xF3, 0x9E, 0x56, 0xF6, 0xBF, 0x1B, 0xB8, 0x07, 0xF2, 0x7F,
-    0x00, 0xAD, 0x57, 0xCF, 0x6F, 0x1D, 0x57, 0x15, 0xFE, 0x66, 0xC6, 0xC9, 0x50, 0x0F, 0xF8, 0x7A,
-    0x11, 0x10, 0x6D, 0x53, 0x0F, 0x0B, 0x90, 0x42, 0x94, 0x78, 0xBA, 0x28, 0x92, 0x25, 0x5E, 0x3C,
-    0x43, 0xBA, 0xC8, 0x22, 0x8B, 0x7A, 0x81, 0x11, 0x12, 0x0B, 0xB2, 0x60, 0x41, 0xBB, 0x20, 0x59,
-    0x44, 0xC2, 0x42, 0xB6, 0x67, 0x68, 0x16, 0x2C, 0x58, 0xC4, 0x8B, 0xFE, 0x01, 0x96, 0x88, 0x58,
-    0xB8, 0x12, 0x0E, 0x52, 0x90, 0x8C, 0x70, 0x3C, 0xB7, 0xF1, 0x82, 0x45, 0x16, 0x1D, 0xA8, 0x10,
-    0x3B, 0x98, 0xB6, 0x94, 0x2E, 0xD2, 0xD2, 0xDB, 0x68, 0x40, 0x13, 0x6B, 0xDE, 0x1B, 0xBE, 0x73,
-    0x67, 0x9E, 0xF3, 0x92, 0x86, 0xD4, 0x0B, 0xEE, 0xBC, 0x33, 0xBF, 0xEE, 0x9D, 0x7B, 0x7E, 0xDC,
-    0xEF, 0x7C, 0xE7, 0xBE, 0xA5, 0xCD, 0xCF, 0x34, 0x00, 0x97, 0x36, 0x4E, 0x67, 0x0A, 0x51, 0xF6,
-    0xDA, 0xC6, 0x34, 0x9E, 0x76, 0x48, 0xF3, 0x12, 0x14, 0xB9, 0xD9, 0x2C, 0x7E, 0x85, 0xCD, 0xA7,
-    0x1E, 0xD2, 0x7C, 0x9C, 0x44, 0x5C, 0x9F, 0x3C, 0xE5, 0x9F, 0xC2, 0xD3, 0x0F, 0xB6, 0xB4, 0xC9,
-    0x9B, 0xD7, 0x6E, 0x8C, 0xAF, 0x71, 0xDB, 0x96, 0x22, 0xA7, 0xB7, 0xB6, 0x36, 0xE4, 0x2A, 0x23,
-    0x78, 0xCF, 0xB6, 0xC9, 0x47, 0x36, 0x83, 0xAE, 0x3D, 0xF1, 0xE5, 0x42, 0xF0, 0x7F, 0xFB, 0x7D,
-    0x79, 0x79, 0x39, 0xE1, 0xE4, 0x5A, 0xA6, 0xE5, 0x3D, 0xD2, 0xB6, 0xED, 0x74, 0x5C, 0xF2, 0x4A,
-    0x85, 0x79, 0xC4, 0x88, 0x75, 0xAC, 0xA7, 0x11, 0x64, 0x61, 0xA9, 0x4A, 0xBF, 0xF4, 0x74, 0x90,
-    0xAD, 0x61, 0x09, 0x7E, 0xA6, 0x8C, 0x32, 0x9E, 0x71, 0xF9, 0x66, 0x1E, 0x97, 0x10, 0x22, 0xCD,
-    0xF2, 0x64, 0x88, 0x5B, 0xB8, 0xCA, 0xAF, 0x8E, 0xF3, 0xFB, 0x67, 0xBD, 0x72, 0x47, 0xB1, 0x33,
-    0xC8, 0x62, 0x55, 0xC4, 0x6F, 0x9B, 0xF8, 0xAE, 0x99, 0x76, 0x37, 0x82, 0x9F, 0x97, 0xE1, 0xFB,
-    0xB5, 0x7A, 0xBF, 0xF1, 0xDF, 0xAD, 0x3D, 0x5D, 0xF1, 0x71, 0x2D, 0xCC, 0x96, 0x4E, 0xC0, 0x2D,
-    0x6E, 0xA9, 0xFB, 0x4D, 0xF0, 0xE9, 0xD0, 0x33, 0xB7, 0x9D, 0x72, 0xD5, 0xD3, 0xB7, 0xA2, 0xA0,
-    0xF8, 0xFA, 0x33, 0xD4, 0xB3, 0x13, 0xBD, 0xD3, 0xC4, 0xFB, 0x4D, 0x7C, 0xA1, 0x1C, 0x78, 0xFA,
-    0x8C, 0xA7, 0x55, 0x52, 0x39, 0xC9, 0xD7, 0xA0, 0xB4, 0xFD, 0x25, 0x50, 0xC0, 0x0C, 0xA2, 0x7F,
-    0xED, 0xC5, 0xED, 0xF0, 0x1B, 0x83, 0xEF, 0x63, 0x15, 0x18, 0x02, 0x8D, 0xFC, 0x9C, 0x0A, 0x8E,
-    0x81, 0x53, 0x72, 0x72, 0xB8, 0x1A, 0x1E, 0x7F, 0x99, 0xAC, 0xAF, 0x0F, 0x31, 0xD0, 0x0E, 0x42,
-    0x4D, 0x61, 0x58, 0xDF, 0x78, 0xF7, 0x92, 0xC3, 0xF8, 0xBA, 0x07, 0xF7, 0x4A, 0x78, 0x05, 0x57,
-    0x96, 0x2B, 0x12, 0x14, 0x16, 0x0D, 0xF0, 0xEC, 0x4A, 0x43, 0x14, 0x21, 0xE6, 0x73, 0x0C, 0xCC,
-    0x9E, 0x9D, 0x02, 0xF5, 0x51, 0x1A, 0xCC, 0x2E, 0x9C, 0x00, 0x76, 0xBA, 0xA9, 0x1C, 0x8A, 0x5B,
-    0x41, 0x8D, 0x10, 0xB5, 0xEC, 0x64, 0x64, 0x79, 0x46, 0x34, 0x42, 0x50, 0x89, 0xC2, 0x25, 0x60,
-    0x8D, 0x08, 0x28, 0x90, 0x0E, 0x91, 0x8E, 0x90, 0x96, 0x58, 0x67, 0xA0, 0x6C, 0xB8, 0x17, 0x91,
-    0x27, 0x6D, 0xB2, 0x6E, 0xEF, 0x76, 0xF2, 0xF3, 0xC3, 0xF6, 0xFC, 0x70, 0xDD, 0x11, 0x03, 0xBF,
-    0x49, 0xF8, 0xDC, 0xC8, 0x31, 0x72, 0x9A, 0x16, 0x23, 0xB7, 0x59, 0x47, 0x63, 0x5F, 0x03, 0x61,
-    0x22, 0x2B, 0x13, 0x67, 0x72, 0x9F, 0x57, 0x9B, 0xD8, 0x3C, 0x02, 0x60, 0xD3, 0x1A, 0xA7, 0x70,
-    0x04, 0xB0, 0xB6, 0x66, 0x7C, 0x7C, 0x7E, 0xC2, 0xB4, 0xA5, 0x86, 0x1C, 0x47, 0x19, 0x9B, 0x1B,
-    0xBC, 0x28, 0xC7, 0x51, 0xC6, 0xF6, 0x2D, 0xCF, 0x9C, 0x42, 0xD2, 0xF2, 0x43, 0x02, 0x4D, 0x16,
-    0xE1, 0x2D, 0x13, 0x58, 0xEF, 0xBF, 0x63, 0x5E, 0x90, 0x6B, 0xEC, 0x9A, 0x05, 0x1B, 0x3F, 0xD7,
-    0xD8, 0xEC, 0x58, 0xF4, 0xDE, 0x2B, 0xEC, 0xD5, 0x7F, 0xE7, 0xF5, 0x9A, 0x29, 0xBF, 0xA8, 0xAE,
-    0x87, 0xB9, 0x73, 0x60, 0xA2, 0xCB, 0x67, 0xD7, 0xD4, 0xCB, 0x45, 0x15, 0x54, 0x2B, 0x8D, 0xFA,
-    0xA5, 0xE6, 0x3A, 0x7D, 0x5A, 0xA9, 0xEB, 0x59, 0x0D, 0xF7, 0x8E, 0x09, 0x7F, 0x98, 0xD4, 0xF0,
-    0xAF, 0x99, 0x30, 0x22, 0x62, 0x94, 0x67, 0x16, 0x23, 0xD7, 0x60, 0xE0, 0x9A, 0xD5, 0x88, 0x50,
-    0xB8, 0xEA, 0x54, 0x55, 0xF8, 0x4A, 0x46, 0x90, 0xE4, 0x85, 0x3F, 0xC4, 0x93, 0x5A, 0x6F, 0xE2,
-    0x84, 0x95, 0x13, 0x86, 0x4E, 0xD8, 0x3A, 0x61, 0xEE, 0x84, 0xC5, 0x13, 0x46, 0x4F, 0xD8, 0xED,
-    0xD6, 0x10, 0xD3, 0xB7, 0x69, 0xBA, 0xDA, 0xC6, 0xD8, 0xFA, 0x45, 0x95, 0x8D, 0x1D, 0xD8, 0x25,
-    0xFA, 0x7B, 0x1F, 0x6A, 0xDE, 0x76, 0x6E, 0x3C, 0xA8, 0x54, 0xD6, 0x7B, 0xF2, 0xEF, 0x4A, 0x72,
-    0xC3, 0x3A, 0x73, 0xDF, 0x44, 0xE8, 0xFD, 0xF9, 0x93, 0x59, 0xC4, 0xD8, 0xA5, 0x7A, 0x17, 0x63,
-    0xAF, 0xD2, 0x72, 0xD2, 0x9F, 0xB0, 0x88, 0x74, 0x9C, 0xC4, 0x18, 0x60, 0x05, 0x37, 0xE5, 0xF9,
-    0xCF, 0x4D, 0xB4, 0x5F, 0xC7, 0x2F, 0x9B, 0xD8, 0x2F, 0x06, 0x81, 0x5E, 0x51, 0xC9, 0x4D, 0x85,
-    0xEE, 0x7D, 0x9C, 0x49, 0x4F, 0xC2, 0xBE, 0x14, 0xEC, 0xDD, 0x05, 0xFB, 0x6B, 0x70, 0x84, 0xC1,
-    0x4D, 0xE5, 0xF4, 0xB3, 0x72, 0x90, 0x0E, 0xB5, 0xD2, 0x81, 0xF6, 0xB4, 0x84, 0x27, 0xFE, 0x45,
-    0x15, 0xED, 0x57, 0xE1, 0x1D, 0xDA, 0x5D, 0x73, 0xB8, 0xA7, 0x57, 0x3C, 0x2D, 0x51, 0xE1, 0xFB,
-    0x1C, 0xEC, 0x49, 0xC1, 0xBE, 0x98, 0xE9, 0x5D, 0x47, 0x09, 0xFB, 0x55, 0xE2, 0x89, 0x4E, 0x8E,
-    0xF1, 0x93, 0x43, 0x1B, 0x99, 0xDD, 0x43, 0x78, 0x9F, 0xC0, 0x7F, 0x3B, 0x51, 0x17, 0x74, 0xE8,
-    0x95, 0xE7, 0x98, 0xEA, 0xA7, 0x50, 0x91, 0xB5, 0x74, 0x0C, 0x1A, 0xC3, 0xFC, 0x08, 0x32, 0x6A,
-    0x4B, 0x3C, 0x7E, 0xE9, 0x1A, 0xAE, 0x6C, 0x83, 0xC6, 0xAD, 0xFD, 0x42, 0x25, 0x03, 0xCC, 0x72,
-    0x86, 0x5B, 0x12, 0x93, 0xC6, 0x2D, 0x22, 0xB7, 0x09, 0x68, 0x5A, 0x1D, 0x81, 0xAB, 0xCE, 0x90,
-    0xEC, 0xF2, 0x82, 0x28, 0xD0, 0x98, 0x0F, 0x3E, 0xF1, 0x8B, 0xF4, 0x7C, 0xA3, 0x8C, 0x3D, 0xC5,
-    0xF2, 0x68, 0x3B, 0xEC, 0x10, 0x3B, 0x38, 0x20, 0x4D, 0xC1, 0x4E, 0x60, 0xA7, 0x12, 0x0E, 0x48,
-    0x90, 0x5F, 0xAC, 0xD1, 0xAA, 0x8A, 0x62, 0x30, 0x54, 0xA5, 0xD3, 0xA8, 0xC2, 0xA9, 0x43, 0xED,
-    0x56, 0x61, 0xE6, 0x72, 0x25, 0xBC, 0x92, 0x52, 0x2C, 0x92, 0x8E, 0x06, 0xE4, 0xA3, 0x01, 0x1C,
-    0x6B, 0x0D, 0x01, 0x93, 0xEC, 0x20, 0xBE, 0xD3, 0x80, 0x5C, 0x87, 0xE8, 0xF5, 0xFA, 0xD0, 0xD3,
-    0xA0, 0xFD, 0x07, 0xE2, 0x7F, 0x92, 0x2D, 0x90, 0x26, 0x8B, 0xAF, 0xC6, 0xD9, 0xD4, 0x5E, 0xAC,
-    0x71, 0x9B, 0x79, 0xDF, 0xE4, 0xC0, 0x83, 0x46, 0x12, 0x10, 0x18, 0x75, 0x34, 0x66, 0xA5, 0x0F,
-    0x92, 0x2B, 0x14, 0x56, 0x75, 0xE2, 0xF7, 0x48, 0xEB, 0x19, 0x3E, 0x11, 0x8D, 0x53, 0x12, 0xF2,
-    0x41, 0x98, 0xD0, 0x13, 0xFF, 0xE0, 0x7B, 0x39, 0xED, 0xA6, 0x22, 0xCB, 0x51, 0x7D, 0x7B, 0x9E,
-    0x03, 0x41, 0x56, 0x6C, 0x99, 0x14, 0x05, 0x9C, 0xDB, 0x38, 0x67, 0x49, 0x50, 0xBE, 0x75, 0x28,
-    0x2F, 0x41, 0xC0, 0xD1, 0x31, 0x6B, 0x82, 0x40, 0x58, 0x18, 0x67, 0x58, 0x9B, 0x20, 0x41, 0xFC,
-    0x18, 0xEE, 0x5D, 0x78, 0x17, 0x92, 0xC0, 0xD3, 0x5F, 0x72, 0x8A, 0x33, 0x20, 0xEA, 0xAF, 0xDE,
-    0x24, 0xA0, 0xFA, 0x66, 0x91, 0xE1, 0xBC, 0x25, 0x56, 0x79, 0xF7, 0x0B, 0x31, 0x78, 0xEF, 0xAE,
-    0xE4, 0xCD, 0x65, 0x29, 0x44, 0x41, 0x2B, 0x64, 0xE9, 0xFF, 0x75, 0xDD, 0x7A, 0x1F, 0x0A, 0xC1,
-    0x29, 0xE1, 0xDF, 0xB9, 0x00, 0x33, 0xC9, 0x17, 0x43, 0x4C, 0xAB, 0x24, 0x7E, 0x61, 0x2A, 0xBC,
-    0x8E, 0xF0, 0xA3, 0xD5, 0xE0, 0x6F, 0xF3, 0x0E, 0x79, 0x38, 0x6F, 0xD3, 0xF6, 0xBB, 0x71, 0xFB,
-    0xC6, 0xE2, 0xB7, 0xCB, 0xF9, 0x9F, 0x54, 0xB3, 0xBF, 0xAB, 0x67, 0x07, 0x43, 0x54, 0x57, 0xB0,
-    0xBA, 0x80, 0xCA, 0xDA, 0xD3, 0xE1, 0xBA, 0x4D, 0xC2, 0xD6, 0x32, 0xF3, 0x68, 0x5C, 0x48, 0xBB,
-    0x90, 0xC9, 0xCA, 0xF9, 0xBA, 0x63, 0xF8, 0xB3, 0x94, 0x95, 0xEE, 0xB5, 0x14, 0x82, 0x80, 0xEA,
-    0x43, 0x09, 0x54, 0x87, 0x18, 0x31, 0x5C, 0x20, 0xCC, 0xDC, 0x62, 0x99, 0x83, 0x54, 0x1B, 0x08,
-    0xC5, 0x23, 0xFE, 0x80, 0xEC, 0xCA, 0xB1, 0x29, 0x3B, 0x72, 0x61, 0x45, 0xD8, 0x45, 0x21, 0x48,
-    0xE1, 0x52, 0x3C, 0xAE, 0x93, 0x37, 0xDA, 0x84, 0xC7, 0xC5, 0xF2, 0x65, 0x51, 0x38, 0xBD, 0x1A,
-    0x4B, 0x29, 0x29, 0x47, 0xCC, 0x49, 0x6A, 0x88, 0xF0, 0x3E, 0x1D, 0x5B, 0x28, 0x73, 0x7F, 0xA5,
-    0xED, 0x26, 0x74, 0xC6, 0x13, 0x36, 0xFD, 0x84, 0x04, 0x89, 0xDF, 0xAD, 0xB0, 0xBB, 0x6D, 0x38,
-    0xF7, 0x93, 0x26, 0x13, 0x79, 0x68, 0x97, 0x23, 0xA6, 0x8E, 0x1E, 0x61, 0xAF, 0xE3, 0x34, 0x29,
-    0x27, 0xE5, 0xDC, 0x6B, 0xFC, 0x07, 0x2D, 0xD2, 0xF3, 0x84, 0x6C, 0x9A, 0xA5, 0x18, 0x31, 0x8F,
-    0x58, 0xD9, 0x47, 0x01, 0x2F, 0x56, 0x2B, 0x67, 0x11, 0xA5, 0xB9, 0x35, 0x5A, 0x7C, 0xA2, 0xBB,
-    0xA1, 0xB1, 0x46, 0x10, 0x27, 0x9E, 0x05, 0xBF, 0x8D, 0x8D, 0xE9, 0xF0, 0x31, 0xFB, 0x10, 0xC1,
-    0x99, 0x05, 0x63, 0x54, 0xC0, 0xAF, 0xAD, 0x7B, 0x01, 0x2F, 0xA1, 0x3E, 0x44, 0xE5, 0x84, 0x25,
-    0x7E, 0x4D, 0x3B, 0x82, 0x4A, 0xAC, 0x30, 0x62, 0x43, 0x49, 0x0B, 0x04, 0x7C, 0x43, 0x52, 0x9C,
-    0xD7, 0x10, 0x0B, 0xCA, 0x10, 0xB1, 0x69, 0x16, 0x89, 0xDE, 0x79, 0xD1, 0x3A, 0x10, 0x9D, 0x92,
-    0x45, 0x63, 0x85, 0xD4, 0xB6, 0x43, 0x5D, 0xB4, 0x30, 0x2E, 0xBC, 0x21, 0xF5, 0xF4, 0xF5, 0xF2,
-    0x90, 0xAD, 0xCF, 0x0B, 0xBE, 0x5A, 0xF5, 0x1F, 0x86, 0xA1, 0x8D, 0x34, 0x03, 0x32, 0x8C, 0xB9,
-    0x75, 0x61, 0x9A, 0x26, 0x3C, 0x8B, 0x37, 0x52, 0xC2, 0x19, 0x6B, 0x66, 0x38, 0xED, 0xF5, 0x4A,
-    0x31, 0xDC, 0x2B, 0x24, 0xF8, 0x9E, 0x76, 0x04, 0x16, 0x99, 0xA0, 0xC0, 0x39, 0x4C, 0x34, 0x41,
-    0x03, 0x99, 0x81, 0xA1, 0x96, 0xD5, 0xEC, 0xCE, 0x51, 0xA6, 0x8A, 0x49, 0xA5, 0xBF, 0x5F, 0x7E,
-    0x13, 0xCC, 0x24, 0x2B, 0xB2, 0xC5, 0x0A, 0xDA, 0xDF, 0xF4, 0x58, 0x1B, 0xF4, 0xB2, 0xD2, 0x01,
-    0x6C, 0x9C, 0xC5, 0xA2, 0x42, 0x60, 0x29, 0x01, 0x15, 0xF1, 0xB3, 0x0E, 0x74, 0xC7, 0x20, 0xDF,
-    0x67, 0xCF, 0xDF, 0x6B, 0x4B, 0x6F, 0xBF, 0x35, 0x94, 0x6A, 0x42, 0x4C, 0x2F, 0xDA, 0xDB, 0xFF,
-    0x0B, 0xBC, 0x7D, 0x7D, 0x24, 0x21, 0x83, 0x23, 0xBE, 0xD6, 0xE0, 0xF8, 0xD6, 0x56, 0x16, 0x71,
-    0xEE, 0xBC, 0x19, 0xA0, 0x7D, 0x4C, 0xD2, 0xE6, 0x1C, 0xD3, 0xA7, 0x2D, 0xC0, 0xED, 0xE2, 0xD6,
-    0xD6, 0x0D, 0x6C, 0x93, 0x1B, 0x02, 0xBF, 0xD5, 0x94, 0x62, 0x42, 0xB4, 0xBA, 0xD8, 0xEA, 0xB6,
-    0x1D, 0x71, 0x58, 0xC7, 0x23, 0xF3, 0x38, 0x19, 0x21, 0x3E, 0x3B, 0x15, 0x7C, 0xB4, 0x7B, 0xBC,
-    0x6D, 0xF2, 0x36, 0x59, 0xFB, 0x69, 0x89, 0xDF, 0xD6, 0x30, 0x57, 0x6C, 0x65, 0x81, 0xB3, 0xE1,
-    0xB3, 0x24, 0x07, 0xC6, 0xC9, 0x26, 0x60, 0xC0, 0x18, 0xA6, 0x3A, 0x67, 0x44, 0x16, 0xF8, 0xBD,
-    0x7F, 0xF8, 0xFE, 0x72, 0x4B, 0x04, 0x8E, 0xDE, 0xAC, 0xC1, 0x1A, 0x97, 0x0A, 0x19, 0x05, 0xD9,
-    0x8F, 0x19, 0xA4, 0x0C, 0x47, 0x6C, 0x3F, 0x92, 0xC1, 0xF2, 0x99, 0x26, 0x8E, 0x08, 0xA0, 0x83,
-    0x1F, 0xD4, 0x12, 0xCC, 0x8D, 0xC9, 0x31, 0xDC, 0xC7, 0x5D, 0xA1, 0x34, 0x37, 0x67, 0x91, 0xFE,
-    0xDA, 0x90, 0x02, 0x8D, 0x4B, 0x7A, 0x71, 0x3E, 0xF8, 0x3B, 0x55, 0xFF, 0x91, 0xF8, 0xBD, 0x93,
-    0xE1, 0xF8, 0xB8, 0xC0, 0x93, 0xF4, 0x28, 0xE4, 0x21, 0xF8, 0x1F, 0xAF, 0xE3, 0x58, 0x2B, 0x7B,
-    0xBD, 0x0C, 0xF3, 0xF3, 0x44, 0xD7, 0x40, 0xEA, 0xC8, 0x4B, 0x3D, 0x3D, 0x48, 0x7D, 0xCF, 0xF2,
-    0x8B, 0x49, 0xFE, 0x0A, 0xE2, 0x19, 0xBB, 0xE8, 0x03, 0xFB, 0xBB, 0x6A, 0x17, 0x9A, 0x1B, 0xD4,
-    0xC2, 0x6E, 0x4D, 0x99, 0x0F, 0x2C, 0xD8, 0x41, 0xA6, 0xA2, 0x62, 0x2E, 0x2A, 0x06, 0x52, 0xDE,
-    0x09, 0xB2, 0xA9, 0xA8, 0x9C, 0x59, 0xAF, 0xE7, 0x6E, 0xC5, 0x6B, 0x26, 0xA8, 0x97, 0x84, 0x9D,
-    0x97, 0x13, 0x09, 0xC5, 0x08, 0xDE, 0x83, 0xE5, 0xCB, 0x05, 0x93, 0x01, 0xD5, 0xD5, 0x1E, 0x42,
-    0x6C, 0xA7, 0x30, 0x35, 0x98, 0x9D, 0x1F, 0x54, 0xE1, 0xCF, 0x8C, 0xD7, 0x66, 0x07, 0xED, 0x1E,
-    0x17, 0xC3, 0x6D, 0x13, 0xF5, 0x87, 0x32, 0x5A, 0xA8, 0xBE, 0x30, 0xB8, 0x64, 0xC7, 0x3D, 0x8B,
-    0x9E, 0x0F, 0x28, 0xA9, 0x54, 0x02, 0xFB, 0x46, 0x58, 0xEB, 0xE1, 0x9B, 0x6E, 0xF1, 0xBA, 0x37,
-    0x79, 0xB7, 0xE9, 0x15, 0x9F, 0xDF, 0x6B, 0xA4, 0x72, 0xB3, 0xE4, 0x5F, 0x30, 0xD1, 0x35, 0x96,
-    0xC4, 0x82, 0x45, 0xFF, 0xB6, 0xD2, 0xE7, 0x6C, 0x99, 0x5E, 0x65, 0xD9, 0x0F, 0x6D, 0xDD, 0x3F,
-    0x73, 0x48, 0xF4, 0x12, 0x5D, 0xDF, 0xF2, 0x79, 0x3D, 0xBE, 0x13, 0x27, 0x9E, 0x93, 0x8D, 0x2D,
-    0x19, 0x25, 0x17, 0x82, 0xCA, 0x93, 0x58, 0x56, 0x74, 0xCA, 0xEA, 0x15, 0xA6, 0x98, 0xF8, 0xC2,
-    0x1B, 0x73, 0x04, 0x81, 0xFF, 0xD5, 0x47, 0xBF, 0xC8, 0xE5, 0xDD, 0x89, 0xCF, 0xE8, 0xF0, 0xAC,
-    0x0E, 0x9A, 0x3C, 0x27, 0xB1, 0x1E, 0x7F, 0xC1, 0xBD, 0x78, 0x62, 0x5D, 0xB3, 0x2D, 0xB2, 0x7B,
-    0xE7, 0xE8, 0x89, 0x30, 0x99, 0xE3, 0x37, 0xEC, 0x3D, 0x4C, 0x6E, 0x6B, 0x41, 0x67, 0x7D, 0xDD,
-    0x97, 0xD5, 0xC7, 0x5A, 0x94, 0x70, 0xD3, 0xDE, 0x59, 0x25, 0x27, 0xFB, 0xF8, 0x78, 0xFB, 0x5F,
-    0x6E, 0xCD, 0x1E, 0x73, 0xD0, 0xCC, 0x04, 0xC5, 0x70, 0x46, 0x15, 0xBB, 0x33, 0x2C, 0x42, 0x44,
-    0x88, 0xC8, 0xD6, 0xF6, 0xD6, 0x46, 0x2B, 0x09, 0x37, 0xD7, 0x3D, 0x9F, 0x98, 0x71, 0x92, 0x47,
-    0xC6, 0x61, 0x8F, 0x44, 0xD5, 0xCA, 0xFF, 0x09, 0xDB, 0xD6, 0xEC, 0xD3, 0x7A, 0xFF, 0xF4, 0xAA,
-    0x7D, 0xDA, 0x1B, 0xFB, 0x9A, 0xC5, 0xD9, 0x73, 0xF6, 0xCF, 0x8B, 0xDC, 0x1D, 0x63, 0xD8, 0xE4,
-    0x1A, 0x27, 0x53, 0x78, 0xA6, 0xBF, 0xB3, 0xBC, 0x58, 0x76, 0x7B, 0xEF, 0x23, 0xED, 0xF9, 0x8D,
-    0x7E, 0x51, 0x8E, 0x23, 0xED, 0xF9, 0xCB, 0x58, 0x87, 0x89, 0xC2, 0x34, 0x3E, 0x7F, 0xEC, 0x31,
-    0xC8, 0xDF, 0xF4, 0x58, 0x8F, 0x6D, 0x79, 0xDA, 0x58, 0x85, 0x6F, 0xE9, 0xCD, 0xCD, 0xD3, 0xD9,
-    0x51, 0xE6, 0xDD, 0xC3, 0x51, 0x7D, 0xFB, 0x2F, 0x5D, 0x54, 0x31, 0x6F, 0xDB, 0x46, 0x14, 0xFE,
-    0xC8, 0xB3, 0x44, 0x24, 0x57, 0xE4, 0x32, 0x58, 0x45, 0x92, 0x06, 0xBD, 0xB9, 0x86, 0xA1, 0x5B,
-    0x32, 0x74, 0x10, 0xC9, 0x87, 0x08, 0x68, 0x81, 0x66, 0xD1, 0x60, 0x4E, 0x19, 0xBA, 0x78, 0x68,
-    0x0B, 0x14, 0xED, 0xD0, 0xA1, 0x28, 0x68, 0xF9, 0x90, 0x0C, 0x19, 0xB2, 0xF8, 0x1F, 0xC4, 0x43,
-    0xA7, 0x7A, 0x50, 0x46, 0x25, 0x60, 0xA2, 0x8B, 0xFB, 0x03, 0xCA, 0x02, 0x01, 0x32, 0x74, 0x30,
-    0x93, 0x38, 0xE8, 0x90, 0xC1, 0x04, 0x2A, 0xA0, 0x06, 0x6A, 0x9B, 0x7D, 0x47, 0x59, 0x69, 0x50,
-    0xE9, 0x51, 0xA0, 0xEE, 0xDE, 0xF1, 0x7D, 0xEF, 0xFB, 0xBE, 0x47, 0x7C, 0x0D, 0x71, 0x64, 0xD5,
-    0xE7, 0xCE, 0x08, 0x97, 0x44, 0x6E, 0x4B, 0xBA, 0x5C, 0xBA, 0x42, 0xD9, 0x5C, 0x23, 0x8F, 0xD1,
-    0x3F, 0x46, 0x87, 0xD0, 0x25, 0x65, 0x3B, 0x00, 0xB6, 0x61, 0x90, 0x20, 0x46, 0x8E, 0x02, 0x4F,
-    0x28, 0x05, 0x02, 0x82, 0x72, 0x30, 0x0E, 0x33, 0x1B, 0xFE, 0x46, 0x52, 0xD1, 0x75, 0x8D, 0xED,
-    0xA6, 0xEA, 0x6D, 0x8F, 0x38, 0x4B, 0x34, 0x36, 0xC8, 0x10, 0x64, 0x24, 0x1B, 0xA7, 0xF6, 0xEC,
-    0x07, 0x01, 0x5D, 0x01, 0xD2, 0x53, 0xAC, 0x1A, 0x40, 0xD3, 0x43, 0x4D, 0x73, 0x83, 0xED, 0x13,
-    0xFF, 0x7C, 0x5C, 0xA3, 0xF0, 0xEF, 0x52, 0xDE, 0x29, 0x15, 0x60, 0x56, 0x91, 0x36, 0x88, 0x19,
-    0x80, 0xB2, 0x03, 0x0E, 0x0D, 0x5D, 0x20, 0x18, 0xA1, 0x97, 0x51, 0xDA, 0xB8, 0x9F, 0x26, 0xB4,
-    0x7B, 0x09, 0x58, 0x07, 0x7E, 0x00, 0x2A, 0x08, 0x07, 0x49, 0xF8, 0x18, 0x18, 0x00, 0x97, 0x19,
-    0xE0, 0x37, 0x24, 0xFE, 0xA9, 0xE4, 0xB3, 0xDA, 0xC7, 0x6B, 0x17, 0x36, 0x90, 0x33, 0xD7, 0x97,
-    0xE5, 0x40, 0x94, 0x83, 0xC8, 0xE9, 0x09, 0x05, 0x1B, 0xC0, 0x26, 0xE4, 0x01, 0x69, 0x6E, 0xB6,
-    0xED, 0xD7, 0x48, 0xA7, 0x1A, 0x07, 0x65, 0xA1, 0xF1, 0x7D, 0x8C, 0xF1, 0xBC, 0xC5, 0x53, 0x9E,
-    0x47, 0xEF, 0x0D, 0xCD, 0x1A, 0xD7, 0x7B, 0xF3, 0xDE, 0x4A, 0xD6, 0xAE, 0x64, 0x5C, 0x0C, 0xED,
-    0x0D, 0x67, 0x23, 0x6B, 0x17, 0xB1, 0xF8, 0x68, 0x60, 0x0A, 0x51, 0x41, 0x3A, 0xEE, 0x92, 0x09,
-    0x63, 0xC6, 0x98, 0x8C, 0xF3, 0xE0, 0x7B, 0x5E, 0x51, 0xE4, 0x91, 0xC3, 0x1F, 0x0D, 0x1C, 0xE6,
-    0xCC, 0x67, 0xCC, 0x3B, 0x8B, 0xEF, 0x16, 0x73, 0x3B, 0x17, 0xB5, 0x74, 0xB1, 0xEF, 0x28, 0x20,
-    0x7D, 0x50, 0xC9, 0x57, 0xB5, 0xDA, 0xAF, 0xD5, 0xB0, 0xD2, 0xA2, 0x34, 0x11, 0xA3, 0x7E, 0x1E,
-    0x8B, 0x39, 0xBE, 0x42, 0x74, 0x40, 0x4A, 0x5A, 0x6E, 0x22, 0xF6, 0x8A, 0x79, 0xD1, 0x8E, 0x35,
-    0x4D, 0x0D, 0xA6, 0x03, 0x24, 0x8B, 0x3E, 0x3A, 0x5E, 0xB3, 0xE8, 0x29, 0xBA, 0x5C, 0x3A, 0x07,
-    0x3F, 0x99, 0xA1, 0xE1, 0x18, 0x5C, 0x32, 0xA8, 0x3D, 0xCD, 0xBE, 0x0F, 0xAF, 0xBF, 0x93, 0x77,
-    0xAB, 0x68, 0x58, 0x7A, 0xCC, 0x2C, 0xC1, 0x8F, 0x08, 0x4B, 0xA8, 0xC0, 0x8D, 0xF7, 0xEC, 0xAC,
-    0xA1, 0x6C, 0x91, 0xF3, 0xB6, 0x94, 0xBF, 0x56, 0xE1, 0xD0, 0xF7, 0x15, 0x9C, 0x02, 0xDF, 0x11,
-    0xDF, 0xDC, 0x68, 0x9D, 0x92, 0x9E, 0xA1, 0x33, 0x5A, 0x7A, 0x21, 0xB5, 0x38, 0x22, 0xF1, 0x00,
-    0x97, 0x34, 0xD6, 0x0D, 0x33, 0x54, 0x65, 0x63, 0xE2, 0xD2, 0xA2, 0x21, 0xF6, 0x02, 0x32, 0x12,
-    0x4D, 0x25, 0x7E, 0x29, 0x23, 0xD8, 0x8B, 0x4C, 0x43, 0x43, 0x2B, 0x7C, 0x44, 0xBA, 0x4F, 0xA5,
-    0x63, 0xA9, 0xCD, 0x99, 0xD7, 0x19, 0x6B, 0x08, 0xFF, 0x74, 0x6A, 0xE8, 0x98, 0xC7, 0x64, 0x03,
-    0xE9, 0x0C, 0xB9, 0xA2, 0x42, 0x11, 0xFF, 0xE6, 0x06, 0xFD, 0xC2, 0xD7, 0xEA, 0x64, 0xA4, 0x9B,
-    0xAA, 0xBF, 0xE7, 0x6E, 0x08, 0xF2, 0x80, 0x17, 0x76, 0xA8, 0xCF, 0xED, 0xC0, 0x07, 0x57, 0x71,
-    0x8E, 0x59, 0xED, 0x57, 0x3E, 0x5E, 0x38, 0x71, 0xC6, 0x5E, 0xB0, 0xB1, 0x72, 0x79, 0xE4, 0x0D,
-    0x6E, 0x66, 0xBE, 0x56, 0xF0, 0x33, 0x7B, 0x01, 0x26, 0xB2, 0x71, 0xCB, 0x61, 0xA2, 0x9C, 0x3E,
-    0xB2, 0x5E, 0x1D, 0x83, 0xDD, 0x01, 0x1E, 0xD7, 0xE8, 0xB5, 0x5E, 0x08, 0xDA, 0xF8, 0x70, 0xE9,
-    0x85, 0xC5, 0xDF, 0xFF, 0x79, 0xA1, 0x69, 0x5C, 0xB6, 0xF4, 0x42, 0xF3, 0xCE, 0x0B, 0xD2, 0x73,
-    0x1E, 0xD6, 0x88, 0x5A, 0x87, 0xB1, 0xF2, 0xE9, 0xD2, 0x0E, 0xC9, 0x7B, 0x5E, 0xE0, 0x5D, 0x58,
-    0xCE, 0x0E, 0x2D, 0xAB, 0x52, 0xB0, 0x97, 0x17, 0x6E, 0xF0, 0x73, 0x76, 0xC2, 0x5E, 0xA8, 0x18,
-    0x19, 0x18, 0xEC, 0xA3, 0x1D, 0x79, 0xDF, 0x99, 0x16, 0x29, 0xCF, 0x46, 0xA1, 0xA9, 0x48, 0x91,
-    0x1E, 0x54, 0x17, 0xBA, 0x14, 0x3C, 0x82, 0xFC, 0x12, 0x7D, 0x85, 0x41, 0x1F, 0xB3, 0x43, 0x2F,
-    0x73, 0xBE, 0x82, 0xB4, 0x40, 0x77, 0x87, 0x4F, 0x41, 0x3D, 0xB0, 0xFD, 0xC8, 0xF7, 0x5D, 0x2C,
-    0x07, 0x3B, 0xE1, 0xAD, 0x11, 0x2E, 0xDA, 0x4D, 0xF1, 0xB2, 0x0C, 0xFE, 0x02, 0x4E, 0x3D, 0x4C,
-    0x56, 0x35, 0x32, 0x58, 0xD7, 0xF6, 0x72, 0x87, 0xBA, 0x87, 0xF8, 0x64, 0xDC, 0x5A, 0xD9, 0x40,
-    0xB3, 0x02, 0x7D, 0x1C, 0x0F, 0xF0, 0xA4, 0xC6, 0x55, 0xF8, 0x61, 0x97, 0x6D, 0x37, 0xEA, 0x36,
-    0xE9, 0x89, 0x33, 0xB7, 0x5C, 0xCA, 0x5E, 0xF5, 0xE3, 0x4A, 0x85, 0xC6, 0x54, 0x55, 0xA3, 0x2E,
-    0xFD, 0x97, 0xF3, 0xC5, 0xAE, 0x96, 0xD6, 0x5C, 0x47, 0xF2, 0x10, 0xE9, 0x1C, 0x5B, 0x05, 0x8A,
-    0x04, 0x53, 0x63, 0x47, 0x01, 0xE7, 0xF0, 0xE4, 0x59, 0x45, 0xFA, 0xDD, 0x3B, 0x25, 0xC7, 0xD8,
-    0x5E, 0xC5, 0xDA, 0xED, 0xCF, 0x4A, 0x3D, 0xF9, 0xA3, 0xD6, 0xF7, 0x5E, 0xD6, 0x46, 0xEE, 0xD7,
-    0x89, 0xBA, 0x5B, 0xC5, 0x6A, 0x58, 0xE6, 0xFE, 0xD2, 0xE2, 0x64, 0xA3, 0x83, 0xD1, 0xDA, 0x47,
-    0x56, 0xEF, 0x95, 0xFA, 0x5E, 0x3B, 0x0D, 0xCB, 0xEA, 0xB9, 0xAA, 0x37, 0x42, 0xBA, 0x76, 0xDF,
-    0xCA, 0xB7, 0xB5, 0xFC, 0xBD, 0x56, 0xCF, 0x6A, 0x75, 0xB3, 0xD6, 0xA2, 0xE2, 0x1C, 0x33, 0x41,
-    0xB2, 0xE9, 0xDF, 0x11, 0x3C, 0x03, 0x33, 0x42, 0xF0, 0x14, 0xF2, 0x96, 0x55, 0x37, 0xA1, 0x2A,
-    0x84, 0xA7, 0x58, 0x49, 0x31, 0x50, 0x48, 0xBE, 0xF5, 0x74, 0x81, 0x42, 0xA7, 0x0F, 0xF5, 0xCE,
-    0x12, 0x55, 0x8C, 0x74, 0xE7, 0x02, 0xFE, 0x05, 0x65, 0x57, 0x4D, 0x68, 0x1D, 0xD7, 0x15, 0x3E,
-    0x33, 0x53, 0xBD, 0xA1, 0x9E, 0xD8, 0x97, 0x82, 0x21, 0xC5, 0x52, 0x3C, 0x59, 0x96, 0x20, 0x33,
-    0x81, 0xBA, 0x20, 0x83, 0xAA, 0x3B, 0xA5, 0x8B, 0xAE, 0x42, 0x5C, 0xB0, 0xBA, 0xE9, 0xC2, 0x9B,
-    0xEE, 0x0A, 0x7D, 0x2E, 0x08, 0x1A, 0x42, 0xC9, 0x1D, 0x25, 0x50, 0x2F, 0x4C, 0xC1, 0x8B, 0xA6,
-    0x14, 0xBA, 0x88, 0x16, 0x29, 0x6D, 0xE5, 0x85, 0x44, 0x30, 0x24, 0x8B, 0xF8, 0xCD, 0x95, 0xB5,
-    0xD0, 0xA2, 0xA1, 0xBE, 0x8D, 0x28, 0x85, 0x6E, 0x32, 0x4E, 0x2C, 0x1B, 0x92, 0x85, 0x6E, 0xDC,
-    0x79, 0xF8, 0x3D, 0x69, 0x66, 0x6E, 0xBF, 0x73, 0xE7, 0xC9, 0xB5, 0xE9, 0xC0, 0x9C, 0x79, 0x9A,
-    0x9F, 0x7B, 0xCF, 0xF9, 0xCE, 0x77, 0xBE, 0x73, 0x44, 0xC4, 0xC7, 0xB0, 0x23, 0x0A, 0xA7, 0x2A,
-    0x27, 0x51, 0x65, 0x44, 0x99, 0xFE, 0x36, 0x91, 0xCC, 0x71, 0x5F, 0x05, 0xAB, 0xAB, 0x79, 0x19,
-    0x3B, 0xA7, 0x47, 0xD4, 0x45, 0xBA, 0xA4, 0x36, 0xD2, 0x2A, 0x68, 0xF0, 0xCA, 0xA7, 0x30, 0xB8,
-    0x0F, 0x1B, 0x4D, 0xF0, 0x62, 0x54, 0xC3, 0xC4, 0x76, 0x8E, 0x28, 0xB1, 0x82, 0x48, 0x8C, 0x7F,
-    0x41, 0x54, 0xBA, 0x16, 0x37, 0x5F, 0xB8, 0x46, 0xB4, 0x58, 0x51, 0x30, 0xAA, 0x48, 0xB9, 0x26,
-    0x6C, 0xF7, 0x3B, 0x31, 0xDE, 0xEB, 0xD2, 0x2F, 0x7E, 0xFB, 0xB1, 0xDC, 0x5D, 0xB8, 0xAC, 0x6E,
-    0x2C, 0x51, 0xF9, 0xDA, 0xAB, 0x54, 0x2E, 0x6E, 0x93, 0xBB, 0x68, 0xA8, 0xFC, 0x40, 0x53, 0xF9,
-    0x45, 0x4E, 0xF2, 0x5F, 0xB4, 0x91, 0x75, 0xB1, 0x49, 0x9C, 0xCB, 0x13, 0xF5, 0x80, 0x4E, 0x5F,
-    0x24, 0x5A, 0xD8, 0x26, 0x3A, 0x7B, 0x99, 0x66, 0x47, 0xC0, 0xAB, 0xA7, 0x0F, 0x1D, 0x9C, 0xCC,
-    0x55, 0x01, 0x9F, 0x64, 0x0E, 0x4F, 0xBE, 0x4F, 0xC2, 0xE2, 0x61, 0x5A, 0xC1, 0x64, 0xFB, 0x93,
-    0x3B, 0x24, 0xEF, 0x3A, 0x47, 0x52, 0xB7, 0x2B, 0xA4, 0x76, 0x26, 0x67, 0x49, 0xBD, 0x0D, 0x47,
-    0xD5, 0x5D, 0xBC, 0x23, 0x77, 0xD9, 0xEC, 0x57, 0xAF, 0x52, 0x7A, 0x7C, 0xDF, 0x72, 0x2C, 0x1A,
-    0x2E, 0x77, 0x27, 0xCB, 0x97, 0xCE, 0x15, 0x34, 0x3C, 0x2A, 0x01, 0x89, 0x15, 0x8C, 0x0B, 0xA2,
-    0x4A, 0x4D, 0x02, 0xA3, 0x79, 0x69, 0x36, 0xD2, 0x9B, 0x2F, 0x0B, 0x2C, 0xE8, 0xBF, 0xE5, 0xCF,
-    0xE0, 0x0E, 0x9D, 0x72, 0x7F, 0x21, 0x9A, 0x67, 0x13, 0x30, 0x00, 0x21, 0x30, 0xA2, 0xF9, 0x2E,
-    0xE7, 0xD7, 0xAA, 0x13, 0xE7, 0xCB, 0x8A, 0x92, 0x47, 0x0D, 0x65, 0x45, 0x47, 0x92, 0xEE, 0x90,
-    0xA2, 0xF7, 0x71, 0x52, 0x7F, 0xE6, 0xC4, 0x51, 0xCF, 0xA9, 0x77, 0x7D, 0x12, 0x04, 0xFC, 0x9F,
-    0x53, 0xAB, 0x44, 0x1F, 0xE3, 0xB3, 0x03, 0x06, 0x7D, 0x7A, 0x3B, 0x73, 0xCE, 0x5E, 0x1A, 0xC0,
-    0xC1, 0xD9, 0xF1, 0x1D, 0x6F, 0xD7, 0xBC, 0xAD, 0x68, 0xEE, 0xCA, 0xE0, 0x9D, 0x7F, 0x17, 0x69,
-    0xAB, 0x8E, 0x9D, 0x8D, 0xDA, 0x43, 0xF7, 0x9E, 0x8D, 0x5C, 0xDC, 0x09, 0xFC, 0x8E, 0x1B, 0x61,
-    0xE3, 0x26, 0xA9, 0x61, 0x71, 0x8A, 0x0A, 0xB9, 0xB2, 0xA9, 0xC1, 0x59, 0x65, 0x46, 0x54, 0xD2,
-    0x64, 0x3A, 0x35, 0x4A, 0x4B, 0x9D, 0x69, 0x07, 0x2B, 0x77, 0x61, 0x3B, 0xB9, 0xA7, 0xB4, 0xA8,
-    0xE9, 0x8C, 0x5F, 0x7C, 0xF9, 0x99, 0x8D, 0xFA, 0xC3, 0x59, 0x2A, 0x27, 0x34, 0xAC, 0x69, 0x58,
-    0x91, 0x68, 0x88, 0x73, 0xDF, 0xF2, 0xCB, 0xE7, 0x1D, 0x9D, 0x47, 0xE2, 0xCB, 0xFC, 0x02, 0x85,
-    0xA3, 0xF2, 0xCB, 0xD1, 0x4D, 0x00, 0xEC, 0x10, 0xFF, 0x1B, 0xA2, 0x5A, 0xA2, 0x53, 0xDD, 0xD6,
-    0x51, 0x57, 0x08, 0xBE, 0xA3, 0xC9, 0x46, 0x0D, 0x32, 0x61, 0x83, 0xCE, 0x52, 0x50, 0x11, 0x5E,
-    0x09, 0x0D, 0x29, 0x43, 0x91, 0x66, 0x80, 0xE7, 0x1F, 0x30, 0xE0, 0x0A, 0x0B, 0x6B, 0x64, 0xDC,
-    0xDD, 0xE4, 0xCC, 0x1C, 0xB7, 0x3E, 0xC3, 0x0E, 0x88, 0x66, 0x70, 0x97, 0x13, 0x21, 0x67, 0x16,
-    0xC4, 0x29, 0xE4, 0x0E, 0x3E, 0x28, 0xD4, 0x3B, 0x20, 0x52, 0xEE, 0xF0, 0x99, 0xFB, 0x69, 0x0B,
-    0xAA, 0x60, 0x6F, 0xF5, 0xBB, 0x00, 0xE9, 0x95, 0x14, 0xB6, 0xDE, 0x22, 0x2D, 0x6F, 0x51, 0x04,
-    0x3B, 0xF2, 0xF6, 0x0E, 0xA5, 0x6D, 0x4E, 0xEA, 0x0A, 0xBB, 0x94, 0xD5, 0x27, 0xD1, 0xB9, 0x07,
-    0x7D, 0x7D, 0x1C, 0xF1, 0x6E, 0x88, 0xCD, 0xF2, 0x7E, 0x7C, 0x95, 0x86, 0xBC, 0x17, 0xD2, 0x0C,
-    0xFE, 0xCA, 0x7E, 0x48, 0xC3, 0x24, 0x80, 0x0F, 0x3B, 0x8D, 0x30, 0xB8, 0x96, 0x3F, 0xAC, 0x13,
-    0xF8, 0xF1, 0x9B, 0x36, 0x6A, 0x06, 0x9C, 0x79, 0x13, 0xF2, 0x0A, 0xE5, 0xD0, 0x90, 0xC3, 0xE2,
-    0x2E, 0xB5, 0x24, 0xE1, 0x8C, 0x13, 0xCC, 0x3C, 0x0A, 0xBA, 0x64, 0x12, 0xC2, 0xDD, 0x90, 0x33,
-    0x94, 0x83, 0xC8, 0x4D, 0xD4, 0xA6, 0x85, 0x04, 0x6B, 0x7E, 0xEC, 0x5E, 0x3F, 0x68, 0x99, 0x38,
-    0xC3, 0x3D, 0x57, 0x3F, 0x05, 0x3D, 0x73, 0x66, 0x90, 0xA7, 0x8E, 0x59, 0x25, 0x8A, 0xF9, 0x29,
-    0xFB, 0x9F, 0xE9, 0xB0, 0xE2, 0xAB, 0xD4, 0x00, 0x0E, 0xD7, 0x52, 0x27, 0x05, 0xC7, 0xE8, 0x34,
-    0x52, 0x12, 0xB6, 0xE1, 0xA1, 0x41, 0x3A, 0x7E, 0xEE, 0x6E, 0x1D, 0x1E, 0x8D, 0x36, 0x98, 0xDC,
-    0x3E, 0x19, 0x41, 0x27, 0x84, 0x05, 0xF8, 0x41, 0x77, 0x41, 0x7C, 0xCD, 0xDC, 0xEC, 0x96, 0x93,
-    0xC7, 0x1C, 0x58, 0x77, 0x3B, 0x7E, 0xA2, 0x7D, 0x76, 0x63, 0x1F, 0xB8, 0x33, 0x91, 0xF3, 0x78,
-    0xE8, 0xA8, 0xF5, 0xD5, 0x91, 0x33, 0x64, 0xCC, 0x79, 0x5F, 0xF8, 0xA5, 0x9B, 0x06, 0x0D, 0x16,
-    0x5D, 0x6F, 0x46, 0x94, 0xFE, 0x03, 0x26, 0xB9, 0xCF, 0xE6, 0xEB, 0x66, 0x74, 0xEE, 0x06, 0x4C,
-    0xF6, 0xB7, 0xE7, 0xCD, 0x1E, 0x9E, 0xC2, 0x5F, 0x6F, 0x26, 0x30, 0x71, 0x3D, 0x02, 0xA3, 0x2B,
-    0x36, 0xD8, 0x4C, 0xF0, 0x4E, 0x03, 0xBF, 0x5D, 0xE7, 0x53, 0x00, 0x87, 0x6E, 0x75, 0xC8, 0x3C,
-    0x6F, 0x99, 0x1C, 0x37, 0xBC, 0xDD, 0x04, 0xA1, 0x25, 0x35, 0xC5, 0x75, 0x62, 0xB9, 0x34, 0x2D,
-    0x4A, 0x53, 0x54, 0xC0, 0x00, 0x75, 0x0F, 0xF6, 0x9A, 0x9E, 0x11, 0x48, 0x02, 0xCC, 0xCE, 0xA1,
-    0xA6, 0xD4, 0x65, 0x1D, 0x25, 0xAD, 0x98, 0x3C, 0x43, 0xDC, 0x94, 0x17, 0x3E, 0xB7, 0xB9, 0x79,
-    0x52, 0x44, 0x5C, 0x91, 0x5F, 0x01, 0xC7, 0xF5, 0x16, 0x51, 0x35, 0xD4, 0x52, 0xCD, 0x0C, 0x89,
-    0xA7, 0x57, 0x80, 0x76, 0x43, 0xC9, 0xF8, 0x8A, 0x57, 0x16, 0x24, 0x92, 0xD2, 0x31, 0xEB, 0x01,
-    0xF5, 0x27, 0xEE, 0xC5, 0x93, 0x28, 0x0F, 0xDD, 0x16, 0x1E, 0x4E, 0x4E, 0x58, 0x73, 0x03, 0x5C,
-    0x18, 0x76, 0x3F, 0x42, 0x85, 0xA2, 0xEC, 0x6A, 0x7E, 0x35, 0xD6, 0xCC, 0x96, 0xF3, 0x9C, 0x3C,
-    0xF3, 0x11, 0xEB, 0xC6, 0x2E, 0xE3, 0x2C, 0xEF, 0x69, 0x0E, 0xD8, 0x21, 0xA0, 0xB9, 0x72, 0x6B,
-    0x0C, 0x71, 0x2B, 0x05, 0x03, 0xEA, 0x12, 0x5E, 0xCA, 0xC5, 0x0D, 0xE7, 0x26, 0xEA, 0x7C, 0x06,
-    0x9D, 0x47, 0x00, 0x4B, 0x22, 0xEB, 0x25, 0x8B, 0xA9, 0x06, 0x89, 0xF8, 0x5B, 0x93, 0x7E, 0xE5,
-    0xB6, 0xF4, 0x05, 0x90, 0x46, 0x2F, 0xB3, 0x59, 0x82, 0x43, 0x05, 0xB0, 0xD9, 0x00, 0x5C, 0x0C,
-    0x9E, 0x98, 0xB2, 0xAA, 0xB0, 0xA3, 0xEE, 0x91, 0xA6, 0x53, 0x19, 0x4B, 0x91, 0x84, 0xEF, 0x21,
-    0xAB, 0x56, 0x0A, 0x8C, 0xE8, 0xAC, 0x2A, 0x7C, 0x52, 0x19, 0xF7, 0x9B, 0x0C, 0x4D, 0xFD, 0x0C,
-    0x50, 0x64, 0xBD, 0x8D, 0x3D, 0xE1, 0x83, 0xA1, 0xE9, 0xD5, 0xD1, 0x2B, 0x9B, 0x69, 0x33, 0xFE,
-    0x30, 0x60, 0xCA, 0x73, 0x23, 0x48, 0xAC, 0x6F, 0x05, 0xB1, 0xF5, 0xCD, 0xC0, 0x53, 0x23, 0xB1,
-    0xBE, 0x3F, 0x88, 0xAA, 0xBF, 0x18, 0x7F, 0x49, 0x91, 0xF2, 0x39, 0x56, 0xD1, 0xD8, 0x96, 0x28,
-    0x04, 0x9D, 0x3C, 0x1E, 0x83, 0xB9, 0x85, 0xD8, 0xB7, 0xAD, 0x74, 0x94, 0xED, 0xD9, 0x76, 0x4D,
-    0x91, 0x4C, 0x6C, 0xB3, 0xE6, 0x1E, 0xB6, 0x62, 0x3C, 0xC9, 0xAA, 0xB2, 0x12, 0xAE, 0xAF, 0x38,
-    0xDD, 0x57, 0x40, 0x9F, 0x36, 0xD9, 0x5F, 0xD4, 0x2C, 0x85, 0x4F, 0xC5, 0xBB, 0xA0, 0xE8, 0x89,
-    0xA5, 0xC4, 0xD4, 0xD8, 0x71, 0x76, 0xDE, 0xC7, 0xF9, 0x39, 0xEE, 0xFD, 0xA7, 0x02, 0x0E, 0x28,
-    0x11, 0x50, 0x8D, 0x21, 0xD5, 0x8E, 0xC2, 0xCA, 0x51, 0xFC, 0xC4, 0xB1, 0x1E, 0xE9, 0xB4, 0xBC,
-    0x5A, 0x2D, 0xAF, 0x08, 0xFB, 0xD1, 0x02, 0xE8, 0xC5, 0xE4, 0xFE, 0x26, 0x1C, 0x96, 0x61, 0x4D,
-    0x32, 0xB2, 0x94, 0x1D, 0xE2, 0x5B, 0xA0, 0xE7, 0x55, 0x01, 0x92, 0xE0, 0x75, 0x40, 0x07, 0x5B,
-    0x47, 0xE5, 0x34, 0x74, 0xDC, 0x0B, 0x33, 0x93, 0x56, 0x61, 0x79, 0x54, 0x4E, 0x58, 0xEC, 0x6A,
-    0x56, 0xA1, 0x82, 0xD4, 0xEF, 0x3B, 0xC6, 0xEB, 0x41, 0xDF, 0x1B, 0xBC, 0x61, 0x19, 0xF2, 0x2A,
-    0xE4, 0x29, 0x8D, 0x7C, 0x5E, 0x7E, 0xB6, 0x37, 0xE0, 0xAE, 0xCF, 0x46, 0xC7, 0xE9, 0x83, 0xA7,
-    0xEA, 0x7A, 0x66, 0x83, 0xF6, 0x14, 0x23, 0x78, 0x46, 0x14, 0xC2, 0x9E, 0x66, 0x22, 0x2D, 0x20,
-    0x76, 0xB3, 0xC8, 0xA2, 0x07, 0xED, 0x57, 0x7A, 0x65, 0x73, 0x43, 0x15, 0xD2, 0x59, 0x55, 0xFC,
-    0xD2, 0x61, 0xDB, 0x0F, 0x5A, 0x3C, 0xF8, 0x9C, 0xC5, 0x60, 0xBF, 0xC1, 0xCB, 0xBB, 0x0D, 0xDC,
-    0x3E, 0x9C, 0xB0, 0x1B, 0x37, 0x67, 0xAB, 0x87, 0xFD, 0x4E, 0xBE, 0xDD, 0x85, 0xDE, 0xB1, 0xBE,
-    0xC0, 0x13, 0x8F, 0xE1, 0x79, 0xC5, 0x45, 0xBF, 0xEC, 0xED, 0x1A, 0x63, 0xBC, 0x3A, 0x56, 0xFF,
-    0xCC, 0x39, 0x46, 0xD0, 0x2F, 0xE6, 0xDA, 0x0A, 0xAE, 0xBE, 0xAB, 0x0E, 0xC8, 0x6B, 0x3A, 0x77,
-    0x85, 0x0C, 0xCE, 0xBF, 0xE1, 0xBB, 0x2E, 0xD7, 0x23, 0x10, 0xE5, 0xC2, 0x98, 0x47, 0x53, 0x98,
-    0x92, 0x04, 0x73, 0x4F, 0xBA, 0xEA, 0x80, 0x83, 0xCC, 0x1E, 0x36, 0xDC, 0xD8, 0xDE, 0x62, 0x11,
-    0x96, 0x44, 0x2F, 0xF9, 0xB4, 0x01, 0x92, 0x94, 0xA9, 0x3C, 0xF7, 0x13, 0x37, 0xCD, 0xF1, 0x13,
-    0x75, 0xCC, 0xCD, 0xE1, 0x45, 0x77, 0xB0, 0x8A, 0xC2, 0xA5, 0xBE, 0xD0, 0xB8, 0x09, 0x78, 0x73,
-    0x0D, 0x26, 0x84, 0x72, 0x8E, 0x87, 0xCF, 0xF5, 0xEC, 0xFE, 0x88, 0x9F, 0x0E, 0x07, 0x87, 0x3C,
-    0x1C, 0xBC, 0xC6, 0xC3, 0xC1, 0x0B, 0x3C, 0x1C, 0x2C, 0xF0, 0x70, 0xB0, 0xC8, 0xE8, 0x2D, 0x71,
-    0x15, 0x5E, 0x64, 0xF4, 0xAE, 0xCD, 0x8C, 0xD2, 0xA8, 0x16, 0x55, 0x54, 0xFC, 0x0B, 0x3C, 0xE3,
-    0x1E, 0x42, 0xF2, 0x53, 0xCD, 0xC3, 0xC1, 0xFA, 0x73, 0xC3, 0x41, 0xCC, 0x98, 0x0C, 0x78, 0x9F,
-    0x11, 0xD3, 0xBC, 0x63, 0xCA, 0xB7, 0x08, 0x19, 0x35, 0x50, 0xD1, 0xA0, 0x1D, 0x1E, 0xF8, 0x38,
-    0x50, 0x0B, 0x18, 0x11, 0xA2, 0x1A, 0xD8, 0xC5, 0x16, 0x4D, 0x3C, 0xB1, 0x7E, 0xB6, 0x52, 0x5C,
-    0x01, 0x25, 0x93, 0xB8, 0x63, 0xF6, 0xC3, 0xC7, 0x6C, 0x87, 0xC1, 0x58, 0x67, 0xF3, 0x03, 0x04,
-    0xAD, 0xA8, 0x67, 0xF9, 0xEC, 0x48, 0x90, 0xAF, 0xF2, 0xBD, 0x3A, 0x68, 0x50, 0xD6, 0x75, 0x38,
-    0x89, 0xEA, 0xA0, 0x62, 0xC6, 0x70, 0xAA, 0x42, 0x86, 0x92, 0xC7, 0xAF, 0xCC, 0x91, 0x27, 0x34,
-    0x7A, 0xE6, 0x37, 0xBE, 0x95, 0x1A, 0xE9, 0xEE, 0x99, 0x3F, 0x5F, 0xBA, 0xA7, 0x3F, 0xFC, 0xDE,
-    0x67, 0xB9, 0xFA, 0x55, 0xEB, 0xA1, 0x3C, 0xFD, 0x61, 0x4E, 0x0B, 0x8F, 0xFA, 0x25, 0x41, 0xF2,
-    0x49, 0xEA, 0xFA, 0x02, 0x7F, 0x65, 0x73, 0x73, 0x03, 0x30, 0xDB, 0x5F, 0x67, 0x77, 0xAB, 0xDB,
-    0x72, 0xC7, 0x58, 0xF9, 0xB6, 0xE6, 0xF1, 0xC3, 0x67, 0xC4, 0xCD, 0xCE, 0xAE, 0x1F, 0x63, 0x58,
-    0x0C, 0x79, 0xEF, 0xF9, 0x96, 0xB9, 0x5A, 0x30, 0x24, 0x76, 0x50, 0x1E, 0x6D, 0xCC, 0x14, 0xD0,
-    0xCB, 0xE9, 0xB9, 0xAD, 0xAE, 0xF0, 0x7F, 0x43, 0x5D, 0x78, 0x3A, 0x61, 0x3D, 0xF4, 0xFD, 0x99,
-    0xB3, 0x8E, 0xDB, 0x2C, 0x6D, 0x09, 0x8B, 0x6A, 0xCB, 0x31, 0x80, 0x56, 0xAC, 0x3D, 0x25, 0x36,
-    0x01, 0x4D, 0x88, 0x25, 0x44, 0x20, 0x0B, 0xE9, 0x67, 0x86, 0xB2, 0x29, 0xD7, 0x70, 0x11, 0xBB,
-    0xAB, 0x7A, 0x4E, 0xE2, 0xE5, 0x72, 0x3D, 0x4F, 0xBA, 0xD8, 0x9E, 0x69, 0x81, 0x76, 0x13, 0xD4,
-    0x90, 0x67, 0x1B, 0x34, 0x81, 0x05, 0x22, 0x66, 0xBE, 0x1D, 0xE6, 0xCA, 0xF5, 0xC2, 0xCB, 0xFC,
-    0x5B, 0xC1, 0x1E, 0xDB, 0xC8, 0xEF, 0xF6, 0xA5, 0xCD, 0x1C, 0x1D, 0xA9, 0x92, 0xEE, 0x96, 0x9D,
-    0xDB, 0xA6, 0xDB, 0xB4, 0x8D, 0xB1, 0xE5, 0x4F, 0x2F, 0x63, 0xCA, 0xAC, 0x31, 0x64, 0x38, 0x1D,
-    0xEF, 0xAE, 0x78, 0x2D, 0x79, 0x13, 0x67, 0xA8, 0x63, 0x0A, 0x6B, 0x0C, 0xBE, 0xCC, 0x1A, 0x75,
-    0xA2, 0x7D, 0x21, 0x93, 0x2D, 0xD2, 0xB3, 0x7A, 0x0C, 0xCA, 0xA9, 0xEF, 0x19, 0x05, 0x95, 0xAF,
-    0x67, 0x26, 0x68, 0xCE, 0x40, 0xD8, 0xEA, 0x97, 0x62, 0x1B, 0xDB, 0x0B, 0xB1, 0x4D, 0xEC, 0x22,
-    0x46, 0xA9, 0x6A, 0x39, 0xA9, 0x84, 0x59, 0x12, 0x55, 0xAA, 0xD7, 0x04, 0x66, 0xA9, 0xED, 0x54,
-    0xCB, 0xC2, 0x66, 0x5A, 0xE6, 0x36, 0x2B, 0x64, 0x5E, 0x81, 0x0C, 0xCA, 0x2B, 0xC7, 0x71, 0xE7,
-    0x27, 0x09, 0x60, 0x55, 0xA1, 0x94, 0x90, 0x33, 0x4C, 0x1C, 0x7D, 0xC3, 0xC2, 0x3D, 0x59, 0x30,
-    0x6B, 0xAF, 0x37, 0x8C, 0xB0, 0x01, 0x91, 0x2F, 0xCF, 0xF2, 0x20, 0x38, 0xC8, 0xC4, 0xBD, 0xFF,
-    0x7F, 0xCA, 0x81, 0xB2, 0x67, 0x77, 0xBF, 0xDB, 0x9F, 0x01, 0xF2, 0x9D, 0x82, 0x17, 0xEA, 0xEF,
-    0x6D, 0xD0, 0x7E, 0xD2, 0x44, 0x93, 0x4F, 0xEA, 0x78, 0xFC, 0x07, 0x4A, 0x1E, 0xFF, 0x8C, 0xC4,
-    0xE3, 0x97, 0xFF, 0xD7, 0xB7, 0x2A, 0x96, 0xE6, 0x7E, 0x78, 0xF7, 0x53, 0x2A, 0x04, 0xF5, 0x95,
-    0x2D, 0x97, 0x83, 0x0E, 0x70, 0x92, 0xF7, 0x5B, 0x40, 0x55, 0x10, 0xA6, 0x72, 0xFC, 0x69, 0xD9,
-    0xE7, 0x86, 0x3F, 0x72, 0x33, 0x02, 0x0B, 0xA3, 0x98, 0xC5, 0xE5, 0x8C, 0xC5, 0xF2, 0x7A, 0xCD,
-    0x7E, 0x70, 0xAA, 0xFF, 0xC8, 0x4D, 0x92, 0x57, 0x2D, 0xF9, 0xDF, 0x84, 0x8E, 0x4D, 0x0B, 0xEE,
-    0x80, 0xC2, 0xDC, 0xB3, 0x51, 0x32, 0x2F, 0x76, 0x25, 0xFA, 0xB3, 0x97, 0x84, 0x45, 0xD4, 0x1C,
-    0x2D, 0x9D, 0xE8, 0xDE, 0x7F, 0x01, 0x63, 0x60, 0xA8, 0xFF, 0xB3, 0xFF, 0x4F, 0xD6, 0x12, 0x00,
-    0xA5, 0x93, 0x31, 0x4E, 0xC3, 0x40, 0x10, 0x45, 0xC7, 0xB6, 0xC0, 0x48, 0x2E, 0xB6, 0xA1, 0xA2,
-    0xF1, 0x01, 0x28, 0x72, 0x03, 0x1C, 0x6E, 0x90, 0x82, 0x70, 0x1A, 0x88, 0x0D, 0xB9, 0x02, 0x12,
-    0xB7, 0xC1, 0x7B, 0x04, 0x77, 0xB4, 0x6E, 0xA8, 0x68, 0x5C, 0x04, 0xC9, 0x52, 0xD6, 0x1E, 0xFE,
-    0xCC, 0xEE, 0x06, 0x42, 0x05, 0xC2, 0x91, 0xF6, 0x47, 0xD9, 0xAC, 0xE7, 0xFD, 0x99, 0xBF, 0x44,
-    0xE1, 0x49, 0xF9, 0x91, 0x3B, 0x22, 0xF3, 0xCE, 0xAF, 0x03, 0x51, 0xB5, 0xE5, 0x2D, 0xA4, 0xBE,
-    0x6E, 0xAF, 0x1B, 0xA2, 0x16, 0x1F, 0xA2, 0x84, 0xD7, 0x7C, 0x43, 0x54, 0x32, 0xB3, 0x23, 0x3A,
-    0x9D, 0x6F, 0xE7, 0x15, 0x8E, 0xB9, 0x64, 0xC2, 0x5E, 0xE6, 0x52, 0xA7, 0x92, 0xA9, 0x8C, 0xD9,
-    0x08, 0xC9, 0x77, 0xF9, 0x0E, 0x52, 0x0C, 0x85, 0x88, 0x19, 0xCC, 0x20, 0xD2, 0xAB, 0x94, 0x9D,
-    0xE9, 0x21, 0x8B, 0xAE, 0xEC, 0x44, 0xEC, 0xC2, 0x42, 0x2A, 0x5B, 0xA9, 0x2C, 0x2B, 0x14, 0x45,
-    0xCD, 0x5A, 0xC0, 0x26, 0x92, 0x02, 0x97, 0xBB, 0x4B, 0x79, 0x65, 0xDD, 0xE8, 0x56, 0x7C, 0x12,
-    0x96, 0x3D, 0xF3, 0xC6, 0x4B, 0x39, 0xDC, 0x62, 0xAD, 0x97, 0xF7, 0x7A, 0xD4, 0xF3, 0xAE, 0x15,
-    0x77, 0x56, 0xDA, 0x49, 0x60, 0x85, 0xD2, 0x43, 0x86, 0x55, 0x49, 0x3D, 0x28, 0x38, 0x87, 0x88,
-    0xE9, 0x29, 0x01, 0x39, 0x08, 0xA3, 0xC1, 0xFB, 0x17, 0x36, 0x9F, 0xA4, 0x08, 0x29, 0x20, 0xC5,
-    0x22, 0x0A, 0x07, 0x3A, 0x52, 0x38, 0x3A, 0x62, 0xDB, 0x5B, 0x65, 0xB3, 0xCA, 0x66, 0x85, 0xAD,
-    0xD6, 0x66, 0xD6, 0x4B, 0x6C, 0xDE, 0xB4, 0xC2, 0x36, 0xB2, 0xB0, 0xAD, 0xE6, 0xD8, 0x48, 0xF4,
-    0x71, 0xFA, 0xC6, 0xE6, 0x84, 0x4D, 0x08, 0x8B, 0x41, 0x08, 0x8D, 0x27, 0x3C, 0x62, 0x2B, 0xB8,
-    0x01, 0x5B, 0x36, 0xFF, 0x89, 0x4D, 0xC6, 0xFD, 0x20, 0x7D, 0x91, 0x79, 0x7F, 0xE0, 0x0D, 0x32,
-    0x70, 0x2B, 0xFF, 0xC1, 0xC4, 0x9B, 0x0D, 0xC5, 0x91, 0xEB, 0xCC, 0x43, 0x17, 0xF1, 0x08, 0xEB,
-    0x1A, 0x1F, 0x4F, 0x1B, 0x78, 0x0F, 0x3D, 0x8D, 0xFD, 0x8C, 0x1D, 0xCD, 0x47, 0x3F, 0xFB, 0x48,
-    0x1E, 0xD9, 0x03, 0x7D, 0xEF, 0xF9, 0xF1, 0x4D, 0x1D, 0x44, 0x0F, 0xD1, 0x85, 0x9F, 0x73, 0xC8,
-    0x00, 0x9C, 0xCC, 0xF4, 0x95, 0x82, 0x9F, 0x31, 0x08, 0x7E, 0xF6, 0x5D, 0xF0, 0x63, 0x83, 0x1F,
-    0xEB, 0xFD, 0x54, 0x21, 0xC2, 0xDA, 0x77, 0x64, 0x18, 0x39, 0x11, 0x3F, 0x63, 0xF0, 0xB3, 0xE2,
-    0xD0, 0xFD, 0xD9, 0xFB, 0x49, 0xC2, 0x04, 0xD2, 0xE8, 0xC7, 0x79, 0x3F, 0xA2, 0xEA, 0x67, 0xF4,
-    0x7E, 0xD4, 0x57, 0xEF, 0x67, 0x22, 0x7E, 0x8A, 0xE0, 0xA7, 0x40, 0xFD, 0x7F, 0xFA, 0x49, 0x59,
-    0x7E, 0x2E, 0xDF, 0x58, 0x8E, 0x36, 0x95, 0xE6, 0x5A, 0x56, 0xF5, 0x40, 0x4C, 0xFC, 0x44, 0x34,
-    0x1B, 0x5C, 0xC3, 0x64, 0x3A, 0xC1, 0x2D, 0x3C, 0x64, 0xC7, 0xFD, 0x32, 0x3B, 0x7D, 0xCC, 0x4E,
-    0x2F, 0xD9, 0x41, 0xBA, 0xFF, 0x90, 0x9D, 0x34, 0xDC, 0x39, 0xB9, 0x6D, 0x15, 0xC9, 0xBD, 0xBD,
-    0xD2, 0x75, 0x03, 0x52, 0xBA, 0x78, 0xA1, 0xF6, 0x29, 0x65, 0xCE, 0x79, 0x2A, 0xFA, 0x1A, 0x29,
-    0x37, 0x5D, 0x05, 0x5E, 0xD3, 0x9F, 0xC3, 0xB0, 0x99, 0xC0, 0x4B, 0x39, 0x77, 0xE0, 0x4C, 0x58,
-    0xFB, 0x59, 0x3A, 0x10, 0x9E, 0xA5, 0x0E, 0x3D, 0xBD, 0x23, 0x07, 0xCE, 0x17, 0x5D, 0xEB, 0xE7,
-    0x5D, 0xC6, 0x43, 0xC9, 0x4D, 0xC2, 0xA1, 0xF6, 0x27, 0x45, 0x8D, 0xB1, 0x0D, 0x80, 0x40, 0x0C,
-    0x03, 0x5F, 0x7C, 0x41, 0x41, 0x91, 0x51, 0x98, 0x00, 0x05, 0x46, 0x63, 0x12, 0x46, 0x21, 0xA3,
-    0x30, 0xC2, 0x17, 0x20, 0x01, 0x7A, 0x71, 0x24, 0xA2, 0x20, 0x52, 0x5C, 0xD8, 0xF2, 0x39, 0xA5,
-    0x9C, 0xE2, 0xC4, 0x42, 0xB5, 0x84, 0x52, 0x5D, 0x32, 0x84, 0x3D, 0x76, 0x1E, 0x0C, 0xED, 0xEC,
-    0x41, 0x15, 0xAB, 0x6E, 0x2F, 0x46, 0x12, 0x30, 0x4C, 0x61, 0xA2, 0xAC, 0x3C, 0x2D, 0xA7, 0xB2,
-    0xF7, 0x14, 0x61, 0xF7, 0x24, 0x73, 0x45, 0x19, 0x02, 0xA4, 0x07, 0xDE, 0x95, 0x4D, 0x9D, 0x93,
-    0x37, 0x0D, 0xFE, 0x5D, 0xFF, 0xAD, 0x6F, 0xB7, 0xF1, 0x7F, 0x01,
+static const uint8_t notoserif_12_bolditalicBitmaps[32850] = {
+    0xA5, 0x58, 0x31, 0x8C, 0xDC, 0xD6, 0x11, 0x1D, 0x92, 0xD6, 0x31, 0x10, 0x01, 0x31, 0x85, 0x14,
+    0x5B, 0x52, 0x6C, 0xA6, 0x48, 0xE1, 0xC4, 0x3E, 0x31, 0x45, 0x02, 0xB8, 0x38, 0x99, 0x94, 0x02,
+    0x24, 0x45, 0x0A, 0x5F, 0xA1, 0x8B, 0x4B, 0xB9, 0x76, 0x73, 0x8D, 0x0A, 0x19, 0x90, 0x45, 0xCA,
+    0x2E, 0x5C, 0x18, 0x48, 0xAE, 0x88, 0xE2, 0x22, 0x08, 0xA4, 0x42, 0x95, 0x12, 0x40, 0x0E, 0x20,
+    0x04, 0x2A, 0x9C, 0x23, 0x6D, 0x17, 0x2E, 0x5C, 0x84, 0x46, 0x02, 0xA4, 0x70, 0x11, 0x1A, 0x96,
+    0x6D, 0x40, 0x02, 0x62, 0x06, 0xA1, 0x63, 0x4A, 0xFA, 0xCB, 0x9F, 0xF7, 0xE6, 0x93, 0x77, 0x7B,
+    0x92, 0x0C, 0x38, 0xC9, 0xDE, 0x91, 0x7B, 0xB7, 0x4B, 0xCE, 0x9F, 0x79, 0xF3, 0xE6, 0xCD, 0x7C,
+    0x4A, 0x95, 0x8B, 0x15, 0xFE, 0x2E, 0xC4, 0x33, 0xE2, 0x0D, 0xE2, 0xF7, 0xE2, 0x77, 0x12, 0xB4,
+    0x12, 0x34, 0x12, 0xD4, 0x12, 0x94, 0xE2, 0x09, 0x5F, 0x71, 0x2E, 0x59, 0xCD, 0xDF, 0xB4, 0x94,
+    0xF9, 0x75, 0x5D, 0xA2, 0x4E, 0xB2, 0x52, 0x46, 0x09, 0x8C, 0x84, 0xBD, 0xC4, 0x9D, 0xA4, 0x0D,
+    0xAF, 0x29, 0x6A, 0xA9, 0x4A, 0xD9, 0xB1, 0xED, 0x7E, 0x2B, 0x91, 0x42, 0x24, 0xCB, 0x25, 0xA9,
+    0x25, 0x6A, 0xC5, 0xEB, 0x44, 0xBE, 0xA9, 0x66, 0x1E, 0x97, 0xE9, 0xA3, 0x00, 0x6B, 0x1B, 0xFE,
+    0x7A, 0x0B, 0xF1, 0xE7, 0x5F, 0x98, 0xA6, 0xF5, 0x41, 0x22, 0x5D, 0x20, 0x69, 0x75, 0x81, 0x9C,
+    0x8B, 0x0E, 0x92, 0x34, 0xF2, 0xAC, 0x9A, 0x09, 0xCB, 0xB8, 0x8B, 0xBB, 0xA0, 0xF3, 0xDB, 0xA0,
+    0x3E, 0x26, 0xDF, 0x81, 0xD5, 0xC2, 0x54, 0xE6, 0xC5, 0x2B, 0x49, 0x9E, 0xD5, 0xF8, 0x99, 0x7D,
+    0x8E, 0x46, 0x78, 0x70, 0xAD, 0x16, 0x13, 0x35, 0xC1, 0x10, 0x76, 0x21, 0xEE, 0x88, 0x5B, 0x1C,
+    0x4D, 0xD8, 0x25, 0x75, 0xD8, 0xA5, 0x75, 0xD4, 0x65, 0x65, 0xD4, 0x66, 0x65, 0xDC, 0x64, 0x79,
+    0x5C, 0x67, 0x79, 0x82, 0x83, 0x3F, 0x05, 0x5C, 0x34, 0x12, 0x7F, 0x06, 0x0F, 0x6D, 0x2D, 0xF2,
+    0x08, 0x6C, 0xC1, 0xC9, 0xC8, 0x48, 0x65, 0xA2, 0x2F, 0x87, 0xF0, 0xBD, 0x5E, 0xC2, 0x8E, 0x68,
+    0xC0, 0xC3, 0xB8, 0xA5, 0x5B, 0xA9, 0x82, 0x85, 0x85, 0xF1, 0x0B, 0x6F, 0x2B, 0xF9, 0x96, 0xFD,
+    0x55, 0x61, 0x8D, 0xF3, 0xC2, 0x6E, 0x49, 0x71, 0xA9, 0x97, 0x11, 0x81, 0x99, 0xE9, 0x78, 0x0C,
+    0xC1, 0xD3, 0x86, 0xC4, 0x30, 0x9F, 0xE1, 0xA2, 0x41, 0x98, 0x05, 0x49, 0x72, 0x91, 0x73, 0x22,
+    0x7E, 0x2B, 0x6D, 0x54, 0xFA, 0x4D, 0x66, 0x6D, 0x3D, 0x1D, 0x2E, 0xA6, 0x10, 0xEF, 0xD9, 0x92,
+    0xAD, 0x1B, 0x38, 0x88, 0x16, 0x3D, 0x61, 0x1E, 0xD2, 0x85, 0xC8, 0x11, 0x0B, 0x23, 0xF0, 0x86,
+    0xE0, 0xC1, 0xBD, 0xFD, 0x78, 0xCF, 0x90, 0x29, 0x44, 0x55, 0xA7, 0xB7, 0x2C, 0x4C, 0xF4, 0x13,
+    0x3C, 0xF0, 0x5B, 0xAF, 0x43, 0x88, 0x01, 0xEC, 0x46, 0x45, 0x29, 0x8F, 0xC3, 0xF9, 0xB3, 0x48,
+    0x5D, 0x6B, 0x41, 0x87, 0x51, 0x62, 0x10, 0x65, 0x15, 0x4C, 0x79, 0xE9, 0xF9, 0x45, 0x6E, 0xAD,
+    0x6D, 0x36, 0x9E, 0xBF, 0x93, 0x33, 0xF5, 0x8C, 0x5D, 0x36, 0xEF, 0x00, 0x1D, 0x64, 0xBA, 0xB0,
+    0x9D, 0x54, 0x38, 0x2C, 0x0E, 0xF8, 0xED, 0x35, 0xB2, 0x05, 0x2A, 0x91, 0x4B, 0x12, 0x5E, 0xDB,
+    0x42, 0xF8, 0xF0, 0x89, 0x8C, 0x20, 0x30, 0xC4, 0x07, 0xC7, 0x41, 0x10, 0xE3, 0x2D, 0xA0, 0xF4,
+    0x16, 0x50, 0x2D, 0x7E, 0xD7, 0x4B, 0x62, 0x77, 0x69, 0x06, 0x07, 0x41, 0xBE, 0xD3, 0x8D, 0x67,
+    0x22, 0xE4, 0x2A, 0x6C, 0xA2, 0xD6, 0x27, 0x61, 0x08, 0x31, 0x42, 0x6F, 0xA5, 0xB8, 0x87, 0x7B,
+    0x72, 0x8B, 0xBB, 0x0B, 0x3D, 0xB6, 0xF5, 0xE0, 0x5F, 0xA3, 0x64, 0xF0, 0x35, 0xF9, 0xB0, 0x57,
+    0x98, 0x1C, 0xF4, 0xB6, 0x8F, 0xE1, 0x17, 0x8E, 0xF6, 0x00, 0xB0, 0xFE, 0xB6, 0xA4, 0xF9, 0x23,
+    0x72, 0x1E, 0xDF, 0x00, 0x36, 0x7F, 0x29, 0x05, 0x69, 0xAE, 0x74, 0xD5, 0x8F, 0x87, 0xE9, 0x63,
+    0xA0, 0x43, 0xF6, 0x67, 0xB3, 0x5F, 0x09, 0xFC, 0xB2, 0xA7, 0x1B, 0xDF, 0x04, 0x5D, 0xD0, 0x4F,
+    0xC7, 0x10, 0xB6, 0xBE, 0x81, 0x01, 0xBB, 0x8D, 0xFB, 0x7B, 0xF1, 0x10, 0x6B, 0xFC, 0x91, 0xCD,
+    0xB3, 0x32, 0xAB, 0x0B, 0x78, 0xBC, 0x0D, 0xCF, 0xB7, 0xF1, 0x5E, 0x20, 0xDE, 0xF4, 0x83, 0x71,
+    0x09, 0xFB, 0x89, 0x9D, 0x55, 0x55, 0x7B, 0x26, 0x6E, 0x82, 0x3E, 0xEC, 0x22, 0xF0, 0x33, 0x6E,
+    0x79, 0x44, 0x38, 0xF0, 0xD3, 0xA5, 0x4D, 0x38, 0xDA, 0xC6, 0xB3, 0x97, 0xEA, 0x5D, 0x4F, 0xB6,
+    0xE5, 0x49, 0x38, 0x79, 0x0E, 0xF4, 0x01, 0x44, 0x92, 0x8C, 0xCE, 0x94, 0xB7, 0x15, 0xF6, 0x51,
+    0x1F, 0x75, 0xDE, 0x12, 0x8C, 0xC7, 0x80, 0x89, 0xC5, 0xF5, 0x78, 0x1D, 0x56, 0xEC, 0x2B, 0xF2,
+    0x52, 0x1E, 0x93, 0xFB, 0x5E, 0x7E, 0x43, 0xF2, 0x20, 0xA1, 0x41, 0x27, 0x5E, 0x4B, 0x15, 0x48,
+    0x45, 0xBE, 0xAB, 0x5F, 0xAD, 0xD8, 0x36, 0xBD, 0x6D, 0x8A, 0x93, 0x0B, 0x60, 0x7B, 0x0C, 0xF0,
+    0x7A, 0x5A, 0x9F, 0xB8, 0xBA, 0x28, 0x51, 0x8D, 0x4E, 0x32, 0x9C, 0x5E, 0x44, 0xA5, 0x6A, 0x41,
+    0xA3, 0x99, 0xD2, 0x17, 0x3D, 0xF3, 0x99, 0xF5, 0x80, 0xA7, 0x08, 0x2B, 0xCB, 0x13, 0x24, 0xC0,
+    0x1A, 0x4F, 0x67, 0x48, 0x03, 0xD4, 0x1E, 0x16, 0x07, 0x01, 0x03, 0xD4, 0xAC, 0x44, 0x17, 0x41,
+    0xDF, 0x04, 0x1C, 0x93, 0xE3, 0x34, 0x75, 0x96, 0xEC, 0x65, 0x75, 0xA1, 0x14, 0xE2, 0xEE, 0x68,
+    0x0F, 0xB6, 0x65, 0x0B, 0xDF, 0x8E, 0x60, 0xD9, 0x1D, 0x50, 0xEF, 0x2E, 0x12, 0x1C, 0x77, 0x58,
+    0x2F, 0x6E, 0x53, 0x14, 0x60, 0x8B, 0x8B, 0xD3, 0x26, 0xA5, 0x58, 0xB0, 0x0C, 0xDF, 0x56, 0x56,
+    0x02, 0xEA, 0xE2, 0x0D, 0x62, 0x2C, 0x4C, 0x1C, 0x7C, 0xD6, 0x93, 0x37, 0x42, 0xAC, 0x20, 0x34,
+    0x36, 0x0F, 0x8C, 0x67, 0xE5, 0xE8, 0x78, 0xCD, 0xE0, 0x5A, 0x94, 0xE8, 0x84, 0x24, 0xD9, 0x9A,
+    0x7C, 0x4A, 0x03, 0x39, 0x2E, 0x36, 0x48, 0x1C, 0x42, 0x3D, 0xAE, 0xF5, 0xA5, 0x05, 0x45, 0xE7,
+    0x5C, 0xD9, 0xB8, 0x53, 0xA1, 0xA7, 0x72, 0xFE, 0xCB, 0x7D, 0xD1, 0xC8, 0x0F, 0x24, 0x19, 0xA0,
+    0x79, 0xA1, 0xA5, 0x7E, 0x54, 0xE3, 0x0C, 0xF6, 0xEC, 0x3D, 0x31, 0x4F, 0xA0, 0x70, 0x2D, 0xF0,
+    0x4C, 0xDA, 0x60, 0x01, 0xAB, 0x3E, 0xE8, 0x5B, 0x7B, 0xD3, 0xA9, 0x28, 0xF1, 0x6F, 0x91, 0xE3,
+    0x54, 0xE5, 0xF8, 0xD6, 0x12, 0x77, 0x0B, 0x4D, 0xC4, 0x57, 0x49, 0x07, 0xEF, 0xB3, 0x9A, 0xDE,
+    0xE7, 0xF0, 0x7E, 0xA0, 0xF7, 0x25, 0x2D, 0xDB, 0x16, 0x96, 0xAF, 0xD1, 0x72, 0x40, 0x5C, 0x90,
+    0x9B, 0xA4, 0xF5, 0xEB, 0x07, 0xFC, 0x55, 0x5C, 0x2E, 0xAE, 0xAB, 0x42, 0xBB, 0xBA, 0xD4, 0x13,
+    0x2C, 0xEF, 0xA7, 0x00, 0x3F, 0xC1, 0xA5, 0x8E, 0x03, 0x97, 0xAB, 0x8A, 0x8B, 0xD9, 0xB5, 0xDC,
+    0xCE, 0x96, 0xC1, 0x98, 0x87, 0x5A, 0xBE, 0x75, 0x65, 0x32, 0x0F, 0xA6, 0xED, 0xB5, 0x2C, 0xB4,
+    0x2C, 0xB4, 0x2C, 0xB0, 0xCC, 0x5A, 0xB3, 0xF5, 0x0E, 0x01, 0x89, 0x4E, 0x74, 0xB7, 0x6A, 0x10,
+    0x74, 0xDA, 0x81, 0x62, 0x70, 0x7D, 0x90, 0xB8, 0xDC, 0x45, 0x3C, 0x6B, 0x76, 0xC1, 0xDE, 0x7F,
+    0xF5, 0x72, 0x51, 0x26, 0xB6, 0x43, 0x6E, 0x98, 0x4D, 0x85, 0x02, 0x2D, 0x84, 0x78, 0x00, 0x19,
+    0xB6, 0x8E, 0x71, 0x13, 0x05, 0x5C, 0xED, 0x24, 0xD4, 0xDA, 0xD7, 0x10, 0xC4, 0xE6, 0xF8, 0x13,
+    0x7B, 0x93, 0x49, 0x84, 0x6B, 0x50, 0xEC, 0x4A, 0x2D, 0x5B, 0x4D, 0xA6, 0x15, 0x07, 0x39, 0x0D,
+    0x2D, 0x64, 0x8A, 0xB9, 0xB8, 0xF8, 0xBC, 0x61, 0x1C, 0xF0, 0x04, 0x17, 0x84, 0x7A, 0x46, 0x47,
+    0xC2, 0x65, 0xB0, 0x81, 0xCB, 0x70, 0xD6, 0xCC, 0x21, 0x9A, 0x13, 0xA8, 0xFB, 0xC2, 0xBE, 0x0B,
+    0x6A, 0x0A, 0x13, 0xB1, 0x89, 0xF0, 0xE8, 0x7A, 0xDC, 0x3A, 0xEF, 0xD3, 0x49, 0x64, 0xF5, 0x28,
+    0x9D, 0x08, 0x12, 0x1F, 0xEB, 0xD0, 0xE1, 0xC2, 0x5C, 0x96, 0xD0, 0x10, 0x19, 0x05, 0x26, 0x80,
+    0x31, 0xAF, 0xBA, 0xB3, 0x74, 0x53, 0xF9, 0xC0, 0x4D, 0x00, 0x6A, 0xE7, 0xC6, 0xB9, 0x09, 0xC0,
+    0x43, 0xB7, 0xF6, 0x74, 0xE8, 0xFA, 0x93, 0x09, 0x84, 0xAC, 0x21, 0x6D, 0x29, 0x26, 0xAF, 0x63,
+    0x99, 0xCD, 0xF1, 0xA7, 0x5A, 0x45, 0x6C, 0x45, 0x10, 0x1E, 0x6D, 0x18, 0x89, 0x12, 0xFC, 0x06,
+    0xF1, 0x7E, 0x47, 0xA1, 0x7F, 0xDF, 0x71, 0xA6, 0x11, 0xA7, 0xF3, 0x30, 0xF0, 0x4B, 0x4A, 0x98,
+    0x8D, 0x06, 0x9E, 0x43, 0x43, 0x67, 0x02, 0x8D, 0x81, 0xC5, 0x4E, 0x96, 0x96, 0x8C, 0xA3, 0x6A,
+    0x19, 0x49, 0xD2, 0x39, 0x4C, 0x14, 0x14, 0x57, 0x42, 0x84, 0xE5, 0xE1, 0x75, 0x54, 0x4E, 0x1D,
+    0x62, 0x0F, 0x7B, 0x7C, 0xC6, 0x1A, 0x29, 0xE2, 0x34, 0x7E, 0x8C, 0xBC, 0x5C, 0xCC, 0xBC, 0xC4,
+    0xF0, 0x00, 0xB6, 0x6D, 0x2E, 0x50, 0x65, 0xE0, 0x26, 0x2E, 0xC1, 0x4D, 0x07, 0x46, 0x79, 0x02,
+    0xEE, 0x3C, 0x6E, 0xE5, 0x59, 0x80, 0xB3, 0x6A, 0xE5, 0x8F, 0xB8, 0x72, 0xAD, 0x92, 0x7F, 0xF1,
+    0xAD, 0xF0, 0xFF, 0x02, 0xB7, 0xCF, 0x16, 0x3F, 0x7E, 0x6D, 0xA0, 0x06, 0xFD, 0x8C, 0x78, 0xBD,
+    0x99, 0xFD, 0x82, 0x8E, 0x75, 0xD9, 0xEF, 0xDD, 0xDB, 0x00, 0x0F, 0xBD, 0x36, 0xED, 0xD0, 0x1C,
+    0x7D, 0x28, 0x4A, 0x4A, 0x79, 0x4A, 0xA8, 0x2A, 0x47, 0x6F, 0x26, 0x27, 0xAA, 0x9B, 0x18, 0x34,
+    0xE2, 0x48, 0x57, 0x07, 0x97, 0x06, 0xD9, 0xC4, 0xFA, 0x58, 0x1B, 0xA2, 0x28, 0xF4, 0xE0, 0x00,
+    0x44, 0xCE, 0xA2, 0x84, 0xE4, 0xE9, 0x2A, 0x5F, 0xC5, 0x82, 0x59, 0xB9, 0x86, 0x73, 0x5A, 0xE3,
+    0x7C, 0x36, 0x6E, 0x9F, 0xC1, 0xA2, 0x51, 0x77, 0x06, 0x6B, 0x06, 0xC3, 0x9B, 0x58, 0x2B, 0x30,
+    0x5C, 0xD1, 0x1B, 0x55, 0x77, 0x11, 0x02, 0xEA, 0xAA, 0x50, 0x4D, 0xD5, 0xD5, 0x28, 0xA5, 0x85,
+    0xD1, 0xEE, 0x34, 0x29, 0x13, 0xBC, 0x4D, 0x6E, 0xE9, 0x68, 0x05, 0xC2, 0x82, 0x7D, 0x0D, 0xEB,
+    0xA4, 0xE3, 0x0C, 0xD2, 0x25, 0x2C, 0xCE, 0x94, 0xB5, 0x8F, 0x7B, 0xE3, 0x8E, 0x52, 0xCA, 0x53,
+    0xDA, 0x00, 0x56, 0xB4, 0x22, 0xCE, 0x25, 0xF8, 0x42, 0x6F, 0x5C, 0x00, 0x7E, 0xB4, 0xF0, 0x70,
+    0xB1, 0x89, 0x04, 0x54, 0x2C, 0x4B, 0xCF, 0xD5, 0xC9, 0x4D, 0x55, 0x26, 0x99, 0x6D, 0xA4, 0xCD,
+    0xAC, 0xAB, 0x3A, 0x84, 0xCD, 0xE2, 0x5A, 0x94, 0xB0, 0x56, 0xFC, 0x9A, 0xBA, 0xCA, 0x3B, 0xBE,
+    0xBA, 0xCA, 0xD7, 0xC9, 0x98, 0x56, 0xBE, 0xDA, 0xFB, 0x70, 0xAF, 0xF7, 0xD9, 0x1E, 0xEF, 0xDB,
+    0xA2, 0x5C, 0xF2, 0xBE, 0xA0, 0xF7, 0xF6, 0xE1, 0xDE, 0x27, 0x4A, 0xAB, 0x9D, 0x93, 0x12, 0x33,
+    0x20, 0xDF, 0x54, 0x90, 0x67, 0xC1, 0xD5, 0x88, 0x3A, 0xB7, 0x60, 0xD2, 0xEA, 0xE8, 0x8A, 0x53,
+    0x56, 0x27, 0x73, 0x58, 0x17, 0xA6, 0x49, 0x46, 0xAA, 0xD3, 0x64, 0x2D, 0xA9, 0x41, 0x7A, 0x7B,
+    0x9C, 0xB4, 0x40, 0x6E, 0x0E, 0xBD, 0xDA, 0x2E, 0xD6, 0xAB, 0x06, 0x61, 0x25, 0xED, 0xCE, 0x68,
+    0x57, 0x5D, 0xEA, 0x3D, 0x8C, 0x62, 0x41, 0xEF, 0x0F, 0x41, 0xEF, 0xB5, 0x5A, 0x8F, 0x96, 0xBD,
+    0xAF, 0x55, 0x8A, 0x4A, 0x6A, 0x39, 0xD2, 0xB0, 0x0B, 0x34, 0x87, 0xB1, 0xEA, 0x79, 0x0C, 0x16,
+    0x15, 0xB2, 0x5A, 0xE4, 0x69, 0x99, 0x7D, 0x52, 0xC1, 0x84, 0x1B, 0x09, 0x62, 0xCE, 0x57, 0xC9,
+    0x6D, 0x7B, 0xAD, 0x5E, 0x85, 0xB1, 0x7A, 0x8D, 0xA7, 0x67, 0xC2, 0x01, 0x53, 0x14, 0xE7, 0x2D,
+    0x2D, 0xED, 0xA5, 0x28, 0x77, 0x2B, 0x28, 0xAD, 0x1F, 0x2C, 0x23, 0x56, 0xD0, 0x0A, 0x15, 0x30,
+    0x51, 0x35, 0xB6, 0x27, 0x6D, 0xBB, 0x79, 0xC7, 0xAB, 0xB6, 0x70, 0xAB, 0x76, 0xB2, 0x73, 0x6C,
+    0xF7, 0x1D, 0xDB, 0x49, 0x0B, 0xEB, 0x20, 0x5C, 0x38, 0xA0, 0x81, 0x07, 0x43, 0xCC, 0xE4, 0xAD,
+    0xF2, 0xB4, 0xC6, 0xD3, 0x75, 0x26, 0xB4, 0x65, 0x6A, 0x6B, 0x26, 0xB0, 0x9C, 0xCB, 0x92, 0xA8,
+    0x73, 0x52, 0x82, 0xE5, 0xFC, 0x30, 0x38, 0x8A, 0x41, 0xF0, 0x59, 0xD9, 0xBC, 0x49, 0x75, 0xC5,
+    0x20, 0x80, 0x37, 0x8B, 0x72, 0x88, 0x3B, 0x08, 0xC2, 0x31, 0x2C, 0x04, 0x30, 0xD6, 0xB0, 0x54,
+    0x54, 0xE5, 0x67, 0xF1, 0x16, 0x67, 0x25, 0xBA, 0x62, 0xBF, 0x9A, 0x5D, 0xC0, 0xD2, 0xC3, 0x5A,
+    0xF6, 0x2E, 0x17, 0xBF, 0x9E, 0xBD, 0xC7, 0xE5, 0xBB, 0xF4, 0xFD, 0x5C, 0x82, 0xBB, 0x4D, 0xF2,
+    0x77, 0x42, 0x58, 0x27, 0x54, 0x37, 0x9B, 0xC7, 0x0E, 0xD0, 0xB8, 0x97, 0x49, 0x78, 0xB9, 0x65,
+    0x88, 0x35, 0x74, 0xDB, 0x00, 0x64, 0x8C, 0x65, 0x10, 0x35, 0x68, 0xD0, 0x71, 0x1D, 0x38, 0xAE,
+    0xD3, 0xCB, 0x93, 0xFC, 0xBA, 0x7A, 0x9D, 0x24, 0xC8, 0xFE, 0x41, 0x6F, 0xB3, 0x41, 0x66, 0xAA,
+    0x48, 0xA2, 0x80, 0x17, 0x0C, 0xC0, 0xFB, 0x98, 0xB1, 0x84, 0xAF, 0x90, 0xBB, 0x89, 0x06, 0x77,
+    0x8E, 0x5B, 0x19, 0x34, 0x6E, 0x70, 0xE7, 0xE8, 0x40, 0xD2, 0x66, 0x8B, 0x10, 0x59, 0x54, 0x0C,
+    0x8B, 0x5D, 0x0C, 0x7B, 0x0C, 0x28, 0xE0, 0x2F, 0xBB, 0x00, 0xB7, 0x4D, 0x26, 0xCA, 0xE1, 0xDC,
+    0x01, 0x8E, 0x3D, 0x6B, 0x5C, 0x9F, 0x4E, 0x54, 0xED, 0x9E, 0xE9, 0x60, 0x6F, 0x4F, 0x7C, 0xD4,
+    0xA2, 0x3C, 0x32, 0x15, 0xD4, 0xD4, 0x72, 0x95, 0x5B, 0x55, 0x0F, 0x98, 0x50, 0x03, 0x67, 0xA8,
+    0xA0, 0x6F, 0x92, 0x41, 0xEB, 0x91, 0x99, 0x7D, 0x2E, 0x18, 0x0F, 0x13, 0x40, 0xA9, 0x15, 0xFD,
+    0x3C, 0xDD, 0xFD, 0x3C, 0x0F, 0xF3, 0x80, 0xB3, 0x3A, 0x90, 0x4A, 0x24, 0xBD, 0x7B, 0x15, 0x33,
+    0x84, 0xE5, 0x18, 0xB3, 0x7F, 0x6B, 0x9D, 0x83, 0x79, 0x30, 0x80, 0xF0, 0x6D, 0xD2, 0xA4, 0x75,
+    0x5A, 0xEB, 0x60, 0x8A, 0x4D, 0x12, 0xC6, 0xE5, 0x12, 0x23, 0x34, 0xC6, 0x68, 0xFC, 0x00, 0x35,
+    0x1B, 0x56, 0xDC, 0x42, 0x0D, 0x69, 0x9F, 0xB5, 0x8E, 0xD8, 0xB9, 0xEC, 0x9B, 0xBA, 0x8D, 0xCC,
+    0xDD, 0xC6, 0x1C, 0xC1, 0xCC, 0x64, 0xDB, 0xE0, 0xDE, 0xA5, 0x2E, 0x18, 0xC3, 0x3E, 0x34, 0xC1,
+    0x10, 0xF5, 0x60, 0x4D, 0x17, 0xF6, 0x1C, 0x5A, 0x13, 0x1D, 0x59, 0x63, 0xB7, 0x0E, 0x47, 0xDE,
+    0x4F, 0x8D, 0x9C, 0x9F, 0x15, 0x60, 0xE5, 0x8A, 0x36, 0xFA, 0xA0, 0x03, 0xF7, 0x1B, 0x6C, 0x47,
+    0xEA, 0xE3, 0xDC, 0x1B, 0xEA, 0x0C, 0x62, 0xEF, 0x3B, 0x8A, 0xF2, 0x87, 0x92, 0xDD, 0x03, 0x3D,
+    0x77, 0x36, 0x05, 0x19, 0x9B, 0x23, 0x69, 0xC0, 0xD1, 0xBC, 0xD7, 0x62, 0x38, 0xF2, 0x1B, 0xDD,
+    0x70, 0x7C, 0xED, 0xD8, 0x16, 0xBB, 0xB1, 0xED, 0xF5, 0x85, 0x63, 0x3A, 0x24, 0x29, 0x5F, 0x48,
+    0x05, 0xE9, 0x60, 0xB7, 0x62, 0x6A, 0xBE, 0xDA, 0x17, 0x7D, 0x05, 0x6C, 0x88, 0xC9, 0xDF, 0x90,
+    0x82, 0xEC, 0x55, 0x6E, 0xBC, 0x4E, 0xBA, 0x06, 0x8B, 0x22, 0x39, 0xC5, 0xA2, 0x83, 0xAB, 0x2B,
+    0xD4, 0x3F, 0xDF, 0xCC, 0x72, 0xE8, 0x4E, 0x24, 0xA1, 0xAB, 0xE6, 0x5D, 0xCD, 0x6A, 0xA7, 0x8D,
+    0xD8, 0x03, 0xD5, 0xAC, 0xAD, 0x70, 0x2E, 0xB7, 0xA7, 0xFA, 0x99, 0x47, 0x5C, 0x05, 0xEF, 0x2F,
+    0x3E, 0x87, 0xFA, 0xB1, 0x77, 0x41, 0xFF, 0x57, 0x7B, 0x6C, 0x97, 0xB8, 0x69, 0xD9, 0xA6, 0xFD,
+    0x05, 0xBB, 0xF9, 0x9F, 0xB8, 0x7F, 0x29, 0x4E, 0x73, 0xDB, 0x40, 0xBE, 0xBC, 0x04, 0x53, 0xDC,
+    0x7F, 0x8B, 0x3F, 0x5E, 0xA1, 0x8F, 0x56, 0x75, 0xB1, 0x95, 0xE8, 0x93, 0x6B, 0x90, 0x40, 0x6E,
+    0x76, 0xCE, 0x4B, 0x88, 0x86, 0xCD, 0x5E, 0x03, 0x22, 0x52, 0x3B, 0x6E, 0x3A, 0x0A, 0xAC, 0x3C,
+    0x48, 0x81, 0x32, 0x30, 0x15, 0xD2, 0xFF, 0x79, 0x1F, 0x40, 0x23, 0x43, 0x83, 0xC2, 0x1E, 0xB0,
+    0x5F, 0x71, 0x3F, 0x90, 0x45, 0xA4, 0x42, 0x93, 0x41, 0x0A, 0x70, 0x27, 0x9E, 0xDA, 0x22, 0x8F,
+    0x87, 0x69, 0xA7, 0x41, 0x99, 0x34, 0x02, 0x60, 0x0E, 0xAD, 0x17, 0xFD, 0xD2, 0x1D, 0x7A, 0x25,
+    0x1B, 0x4B, 0x66, 0xD2, 0x9D, 0x0D, 0xD2, 0x32, 0x35, 0x0E, 0xBA, 0x8F, 0xF6, 0x11, 0xDD, 0xA5,
+    0x99, 0x47, 0xF9, 0x30, 0x73, 0x62, 0x9E, 0x7B, 0x5A, 0x87, 0xE7, 0xC3, 0xE6, 0x2E, 0xEB, 0xD0,
+    0x3C, 0x3A, 0xB8, 0xCA, 0x79, 0x38, 0xC9, 0xF7, 0x6D, 0x04, 0x26, 0x85, 0xEA, 0x63, 0xF7, 0x39,
+    0x24, 0x79, 0xD8, 0x43, 0x2C, 0xFF, 0x89, 0xC6, 0x01, 0x12, 0xC4, 0x28, 0xD4, 0xE4, 0x4B, 0x23,
+    0xE9, 0x3B, 0x98, 0xD7, 0xDF, 0x66, 0x3B, 0xE2, 0x4E, 0xAF, 0x68, 0x8B, 0xFC, 0x68, 0x97, 0x2E,
+    0x1E, 0x65, 0x74, 0x03, 0xF6, 0x61, 0x33, 0x16, 0xBB, 0x71, 0xE5, 0x15, 0xA2, 0xA9, 0x0C, 0xE9,
+    0xB7, 0xEF, 0xD4, 0x4A, 0x79, 0xA4, 0x4C, 0x16, 0x45, 0x07, 0x14, 0x17, 0x9F, 0xDF, 0x45, 0x29,
+    0xD9, 0x70, 0xC4, 0x10, 0xB6, 0x08, 0x0D, 0x0A, 0x09, 0x78, 0x6A, 0x39, 0xB9, 0x5D, 0x20, 0x86,
+    0x10, 0xFE, 0x85, 0xA2, 0x52, 0x6B, 0xCE, 0xE2, 0x0E, 0xB6, 0x75, 0x36, 0xF2, 0x1C, 0xF7, 0x33,
+    0x38, 0x2B, 0x5B, 0x92, 0x18, 0x4C, 0xA3, 0xB0, 0x8B, 0xDD, 0x99, 0xE5, 0xA3, 0x94, 0x05, 0x20,
+    0x0A, 0x0D, 0x1B, 0x26, 0xF6, 0x87, 0x12, 0xB9, 0x76, 0xAB, 0x4F, 0x2D, 0xF4, 0xB9, 0x85, 0x3E,
+    0xB9, 0xD0, 0x16, 0x98, 0x30, 0x9C, 0x68, 0x31, 0x61, 0xBF, 0x72, 0x19, 0xA0, 0x60, 0xBB, 0xDA,
+    0x67, 0x25, 0x96, 0xC7, 0x22, 0x09, 0x5A, 0x71, 0xD2, 0x54, 0x79, 0xDA, 0x58, 0xDC, 0xA1, 0xA1,
+    0xBB, 0x2A, 0x93, 0x0A, 0xA8, 0x65, 0xB7, 0xFB, 0x9D, 0x0A, 0xD9, 0xB7, 0xB1, 0xB2, 0x15, 0x2F,
+    0xB2, 0xC1, 0x5B, 0x7C, 0x66, 0x64, 0xBC, 0xB0, 0x40, 0xD3, 0x1C, 0xA1, 0xDB, 0x00, 0xD4, 0x83,
+    0x33, 0xBE, 0x41, 0x4B, 0x43, 0x90, 0x01, 0x60, 0xD2, 0x00, 0xEB, 0xF8, 0x4E, 0x95, 0x27, 0x76,
+    0x70, 0x73, 0x6A, 0x3D, 0x3F, 0x20, 0x40, 0x82, 0xFE, 0x2A, 0x1C, 0xB0, 0xA8, 0x62, 0x2F, 0x7C,
+    0xFD, 0x4A, 0xDF, 0x86, 0x8A, 0x8D, 0x92, 0xF6, 0x08, 0xC4, 0x33, 0xAE, 0x00, 0x59, 0x1A, 0x24,
+    0x0A, 0xB6, 0x51, 0x7C, 0x2E, 0xB0, 0xEF, 0xD4, 0x91, 0x3C, 0x31, 0x15, 0xF6, 0x5C, 0x1F, 0x02,
+    0xFA, 0xA0, 0x0D, 0xC6, 0xA0, 0x0C, 0xEF, 0x9F, 0x9F, 0x1F, 0xC2, 0x21, 0x39, 0x72, 0x59, 0xB8,
+    0xFF, 0x8C, 0xDA, 0x42, 0x15, 0x2C, 0x6E, 0x0F, 0x72, 0xE2, 0x83, 0xC9, 0x66, 0x1A, 0x6E, 0x8C,
+    0x7C, 0x03, 0xEB, 0x9D, 0x43, 0x67, 0xDC, 0xC6, 0x51, 0xBC, 0xB1, 0xF4, 0x58, 0xE3, 0x11, 0x4C,
+    0x81, 0x22, 0x6F, 0x61, 0x6C, 0x59, 0xC7, 0x2C, 0x9D, 0x7C, 0x91, 0x6B, 0x1E, 0xD8, 0xC5, 0x97,
+    0x9F, 0x1D, 0xE9, 0xA0, 0x03, 0xED, 0xC6, 0xD6, 0x91, 0x37, 0x1D, 0x3A, 0xE5, 0xA1, 0x4C, 0x48,
+    0x86, 0x3D, 0x05, 0x36, 0x95, 0xD8, 0x44, 0x81, 0xB2, 0x2A, 0x31, 0xBA, 0x94, 0xC5, 0x7B, 0x2C,
+    0x1E, 0x94, 0x4F, 0xE7, 0x0A, 0xE8, 0xD0, 0xBA, 0x0F, 0x62, 0xF2, 0x21, 0x02, 0x71, 0xF6, 0xBB,
+    0xB0, 0xF3, 0x30, 0x36, 0xF9, 0x98, 0x18, 0x83, 0x1A, 0xAA, 0x0D, 0x1D, 0x8F, 0x01, 0xCE, 0x1A,
+    0x40, 0xBA, 0x8E, 0xF6, 0xDE, 0xEA, 0x33, 0x20, 0xD7, 0x9D, 0x78, 0x2F, 0x08, 0x90, 0x67, 0x40,
+    0x3C, 0xAE, 0xA9, 0xEF, 0x51, 0x83, 0x6C, 0xF1, 0xBE, 0x3E, 0x36, 0x3C, 0xAF, 0x9A, 0xB0, 0x0C,
+    0xFA, 0x1F, 0x99, 0x48, 0x82, 0xFE, 0x0F, 0xE6, 0x00, 0xCE, 0x1F, 0x98, 0xA7, 0x25, 0xF8, 0xF7,
+    0xDB, 0xE6, 0x8C, 0x04, 0xF7, 0x4E, 0x98, 0x16, 0xDC, 0xF3, 0xF8, 0x4C, 0x89, 0x03, 0x13, 0xA0,
+    0xF7, 0xCC, 0xCE, 0x10, 0xB8, 0x21, 0x87, 0xD8, 0xCB, 0xF9, 0x6C, 0xF0, 0x02, 0xC5, 0xF3, 0x5D,
+    0x6E, 0x3A, 0x3E, 0x14, 0x9D, 0x9D, 0xA7, 0xD1, 0x8D, 0x79, 0x60, 0x27, 0x13, 0x39, 0x4E, 0xED,
+    0xBA, 0xCE, 0x51, 0x0A, 0xC4, 0x93, 0xA4, 0x44, 0x73, 0x44, 0x53, 0xE9, 0xD5, 0xC1, 0xCB, 0xF8,
+    0x83, 0xD4, 0x06, 0xA1, 0xA8, 0x04, 0xFA, 0x18, 0xF1, 0x06, 0x0B, 0xB8, 0x63, 0x25, 0x33, 0x1E,
+    0x9F, 0x13, 0x17, 0x9F, 0x41, 0x15, 0xCF, 0x51, 0x4D, 0x7F, 0x3B, 0x0F, 0x01, 0xDA, 0x37, 0x75,
+    0x7C, 0x88, 0x4B, 0x7D, 0x4A, 0x22, 0x4C, 0x8C, 0x7B, 0xE4, 0xF3, 0xFD, 0xAA, 0x9C, 0xAE, 0xF2,
+    0x36, 0x36, 0xF2, 0x08, 0x42, 0x19, 0x5F, 0xB4, 0xE5, 0x01, 0x8C, 0xB6, 0x8F, 0x51, 0x6E, 0x48,
+    0x0D, 0x52, 0x82, 0x13, 0xC2, 0x48, 0x05, 0xF2, 0x91, 0xC7, 0x10, 0x35, 0x11, 0x4B, 0x05, 0xD9,
+    0xB4, 0x76, 0xDE, 0xE6, 0x73, 0x3A, 0xA3, 0x7E, 0x1B, 0x7D, 0xBA, 0xF2, 0xFF, 0x56, 0xD4, 0xF7,
+    0xAF, 0x5E, 0xDD, 0xCA, 0xAC, 0x6B, 0xA4, 0xF8, 0x1B, 0xAF, 0xCB, 0xF8, 0xD7, 0x5A, 0x9D, 0x1E,
+    0xDC, 0xC3, 0x17, 0x96, 0x46, 0x88, 0x1D, 0x7F, 0x54, 0xBE, 0x4C, 0x79, 0x7D, 0xE1, 0x70, 0xD0,
+    0xDE, 0x88, 0x83, 0xFA, 0x58, 0x54, 0x66, 0xE0, 0xEA, 0x9F, 0xBB, 0xEC, 0xFD, 0x6E, 0xBF, 0xBF,
+    0x15, 0x5D, 0x68, 0x93, 0x8F, 0x87, 0xF8, 0x63, 0x13, 0x7E, 0x84, 0x74, 0xF6, 0xF8, 0xF7, 0xE5,
+    0xA4, 0x5C, 0x3F, 0x28, 0xDF, 0x93, 0x27, 0xE5, 0x4A, 0x25, 0xA3, 0x67, 0x58, 0xAB, 0xE6, 0xBC,
+    0x98, 0xDD, 0x94, 0x4D, 0xCA, 0x6D, 0x5F, 0x61, 0xC7, 0x8B, 0x6F, 0x5B, 0xD7, 0xF3, 0xAC, 0x76,
+    0xBD, 0x13, 0xD5, 0x09, 0xED, 0x7B, 0xAE, 0xF3, 0x6D, 0xB8, 0xDE, 0x67, 0x5D, 0xF7, 0xFB, 0xB9,
+    0xEB, 0x7F, 0x9E, 0xDB, 0x10, 0x4C, 0x8D, 0x70, 0xEA, 0x82, 0x53, 0x1F, 0x9C, 0x3A, 0xE1, 0x34,
+    0xD9, 0x4E, 0xDD, 0xD0, 0x4D, 0xB7, 0x4D, 0xEC, 0xE6, 0x5B, 0xD7, 0x18, 0xEB, 0xA9, 0x2B, 0x4E,
+    0x7D, 0x51, 0x1F, 0xEF, 0x56, 0xFA, 0xB8, 0x0E, 0x6A, 0xEE, 0xBA, 0xE3, 0x53, 0x83, 0xF6, 0xC7,
+    0x6C, 0xB9, 0x4B, 0xEB, 0xA3, 0x1C, 0x89, 0x3F, 0x71, 0x8F, 0x43, 0x39, 0x7F, 0x15, 0xF9, 0xCB,
+    0x73, 0x53, 0x85, 0xBF, 0x1B, 0xEA, 0xEE, 0xA8, 0xDE, 0xAA, 0xF2, 0xFB, 0x66, 0x76, 0x72, 0x3A,
+    0x0F, 0x6E, 0xE0, 0x70, 0xED, 0xC5, 0x35, 0x18, 0x27, 0x0F, 0xBA, 0xB9, 0x6E, 0x1C, 0x1F, 0x62,
+    0xD8, 0x4F, 0xEB, 0x70, 0x31, 0xC9, 0x84, 0x6B, 0xDC, 0x6E, 0x11, 0x37, 0x29, 0x3F, 0xE5, 0xE6,
+    0xCD, 0x3D, 0x03, 0x84, 0x67, 0xEF, 0xD5, 0xEA, 0x9B, 0xAA, 0x4B, 0x55, 0xBB, 0xC7, 0x4D, 0x1A,
+    0x56, 0xCE, 0x29, 0x82, 0x0F, 0x28, 0xEC, 0x60, 0x75, 0x8E, 0x18, 0x67, 0x20, 0x81, 0xE3, 0x62,
+    0xC9, 0x37, 0x8A, 0x16, 0x8B, 0x00, 0xBE, 0x85, 0x2A, 0x5C, 0xD1, 0x03, 0xBE, 0x91, 0x42, 0x69,
+    0x1D, 0x8C, 0xFF, 0x95, 0x6F, 0x4C, 0xF7, 0x05, 0xE5, 0x32, 0xF2, 0xFD, 0x05, 0x49, 0x88, 0x84,
+    0x73, 0x17, 0xC6, 0x8C, 0x97, 0xE7, 0x65, 0x4E, 0xB9, 0xE6, 0x7C, 0x42, 0xD1, 0x5A, 0xF5, 0x75,
+    0x03, 0x3F, 0xCE, 0xDB, 0xC9, 0xDF, 0x1D, 0x4C, 0x67, 0x3C, 0x67, 0x44, 0x55, 0x6E, 0x91, 0xFB,
+    0xD9, 0xF3, 0xD9, 0xF7, 0xC9, 0xFB, 0xD6, 0xF9, 0x8F, 0xBF, 0x34, 0x82, 0x39, 0x86, 0x39, 0x0A,
+    0x97, 0xE7, 0x89, 0x03, 0x88, 0x64, 0x94, 0x5D, 0x16, 0xDC, 0x4F, 0x83, 0x29, 0x9E, 0x7B, 0xCD,
+    0x14, 0x4F, 0x3D, 0xC5, 0x53, 0xBB, 0x78, 0xB2, 0x89, 0xC2, 0x8A, 0x3B, 0x38, 0x4C, 0xA9, 0x41,
+    0x34, 0xC3, 0x14, 0xCF, 0xBA, 0x9D, 0xD0, 0x77, 0x05, 0x3F, 0xE5, 0xC1, 0x31, 0x5A, 0xE3, 0x31,
+    0x2E, 0x1E, 0xBE, 0x6B, 0x3C, 0x83, 0x8B, 0x47, 0xE3, 0x6A, 0x5D, 0x4E, 0x18, 0x4F, 0x34, 0xC5,
+    0x13, 0x61, 0xFD, 0xFF, 0x31, 0x9E, 0xFF, 0x00, 0x7D, 0x54, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE,
+    0xEC, 0xB9, 0x60, 0x29, 0xA3, 0xEC, 0x34, 0xFC, 0xA8, 0xF6, 0x4C, 0x89, 0x02, 0xA7, 0x49, 0x41,
+    0xB1, 0x12, 0x3E, 0xCF, 0x84, 0x14, 0x74, 0xE8, 0x0A, 0xE8, 0xF8, 0x0B, 0x68, 0x8E, 0x62, 0x8B,
+    0x2B, 0xEE, 0x6E, 0xAD, 0xA4, 0xA0, 0xE4, 0xDF, 0x80, 0xAB, 0x52, 0xA4, 0x48, 0xB1, 0x64, 0x9D,
+    0xBB, 0x82, 0xD6, 0x52, 0x8A, 0x14, 0x34, 0x56, 0xA4, 0x40, 0x05, 0x19, 0x24, 0x23, 0x79, 0x2F,
+    0xDE, 0x1D, 0xBE, 0xB1, 0xF7, 0x92, 0x63, 0x25, 0x78, 0xF2, 0x7B, 0x3B, 0x3B, 0x33, 0xEF, 0x7D,
+    0xDF, 0xFB, 0x66, 0x6C, 0x7D, 0xD1, 0xE8, 0xEF, 0x9D, 0xF9, 0xC2, 0x99, 0xA4, 0xCA, 0x65, 0x99,
+    0xC9, 0x62, 0x22, 0x11, 0x4C, 0xDC, 0x2F, 0x91, 0xDC, 0x2B, 0x21, 0x13, 0x0B, 0xC5, 0xA9, 0xB1,
+    0x82, 0xF4, 0xDE, 0xD1, 0x6B, 0x4C, 0x32, 0x60, 0x3A, 0x01, 0xDC, 0x14, 0xA8, 0x1F, 0xE2, 0xE3,
+    0xCB, 0x4B, 0x6B, 0xBC, 0x2F, 0xC4, 0x79, 0x09, 0xF1, 0x80, 0x29, 0xA2, 0x80, 0x62, 0xDA, 0xA8,
+    0xAF, 0xF4, 0x29, 0xFD, 0x3B, 0x40, 0xFB, 0x02, 0x2B, 0x5F, 0xC7, 0xCD, 0x73, 0x27, 0xDC, 0x45,
+    0x2D, 0xFE, 0x3E, 0xB7, 0xC2, 0x97, 0x88, 0xE9, 0x58, 0xB4, 0x40, 0xBA, 0x06, 0x01, 0xB0, 0x73,
+    0x73, 0x56, 0xEC, 0xDF, 0x32, 0xC5, 0xE9, 0x2D, 0x6D, 0xCD, 0x37, 0x06, 0x7A, 0xD5, 0x21, 0x21,
+    0x64, 0x5F, 0xE6, 0xCE, 0x50, 0x6A, 0x63, 0x8B, 0x22, 0xAA, 0x20, 0x7E, 0xAF, 0x45, 0x09, 0xF5,
+    0xD4, 0x11, 0x2B, 0xBD, 0xEB, 0xC6, 0x80, 0x89, 0x1D, 0xA9, 0xE5, 0xB1, 0x73, 0x8C, 0xE2, 0x45,
+    0xC5, 0x98, 0x3C, 0xBB, 0xDF, 0x22, 0x57, 0x3F, 0xA4, 0x0B, 0xE8, 0xC3, 0xBD, 0x13, 0x65, 0x65,
+    0x73, 0xD4, 0xA9, 0x02, 0xF8, 0xAB, 0x61, 0x8C, 0xCF, 0x5D, 0x6A, 0x91, 0x3C, 0x70, 0x29, 0xA0,
+    0x84, 0xCB, 0x81, 0x2C, 0x76, 0xC7, 0xEC, 0x30, 0x6A, 0x1A, 0xF6, 0x88, 0x45, 0x85, 0xEB, 0x16,
+    0x07, 0x36, 0xEA, 0x37, 0x52, 0xD6, 0x65, 0x47, 0xB8, 0x62, 0x1E, 0x02, 0x47, 0xFA, 0x29, 0xB7,
+    0xA7, 0xAF, 0xB8, 0x5B, 0xAD, 0xE2, 0x9F, 0x30, 0x6B, 0x93, 0xA5, 0x58, 0xAF, 0x64, 0xA9, 0x6A,
+    0xAF, 0xAC, 0x29, 0xCD, 0x9F, 0xDC, 0x96, 0x76, 0x0C, 0xB2, 0x65, 0x10, 0x2B, 0xE6, 0x27, 0x1E,
+    0x6A, 0xB9, 0x58, 0x54, 0xB1, 0x6F, 0x4C, 0xD3, 0x57, 0xD7, 0xA5, 0x29, 0x0C, 0x0C, 0xF6, 0x91,
+    0x61, 0xB2, 0x41, 0x54, 0x76, 0xA4, 0xA0, 0xBF, 0xDC, 0x91, 0x7F, 0x9C, 0xDC, 0xF0, 0x6B, 0xE3,
+    0x8B, 0xFC, 0xB3, 0x06, 0x47, 0x1D, 0xDA, 0x3B, 0x78, 0xDC, 0x6F, 0x78, 0x97, 0x94, 0xDF, 0x3E,
+    0x33, 0xBF, 0xE2, 0x73, 0x7D, 0x26, 0x6C, 0x00, 0x65, 0x82, 0xB4, 0xAC, 0xC6, 0xF1, 0x1E, 0xFA,
+    0x69, 0x3C, 0x42, 0x68, 0x10, 0x71, 0xF5, 0xEF, 0xE5, 0xF1, 0x66, 0xF9, 0x68, 0x58, 0x8E, 0xEA,
+    0x61, 0x39, 0x29, 0x86, 0xE5, 0xDD, 0x6B, 0xCB, 0x6F, 0x8C, 0x39, 0x3F, 0x43, 0xD6, 0x58, 0x20,
+    0x69, 0x60, 0x2C, 0x66, 0x36, 0xFC, 0xC3, 0x13, 0xA6, 0xD4, 0x88, 0xBA, 0xA1, 0x28, 0x8D, 0xD4,
+    0x6E, 0x9F, 0xFD, 0x38, 0x8C, 0xDF, 0xFB, 0xFA, 0x2B, 0xFE, 0x65, 0xE4, 0x98, 0x57, 0xE9, 0x14,
+    0x7D, 0x0A, 0x2F, 0x42, 0x5A, 0x85, 0x14, 0x3E, 0xCC, 0x7D, 0x02, 0xE9, 0x42, 0xB5, 0xE9, 0x06,
+    0xE8, 0x70, 0xC9, 0x20, 0x97, 0x87, 0x55, 0x9F, 0xD0, 0x22, 0xA6, 0x70, 0xFB, 0x48, 0x82, 0xEC,
+    0x54, 0x6A, 0xF6, 0x5A, 0x5A, 0x1D, 0x37, 0x79, 0x52, 0xEC, 0xCB, 0x2A, 0x17, 0xE5, 0xB1, 0x2A,
+    0x4F, 0x44, 0x39, 0x4F, 0x8B, 0xB9, 0x28, 0x5B, 0x63, 0xE7, 0x49, 0xD1, 0x1A, 0x74, 0xD2, 0x86,
+    0xA8, 0xD0, 0xEA, 0xCF, 0xBB, 0x5D, 0xCC, 0xD5, 0xAF, 0xF9, 0x1C, 0xC7, 0xA2, 0x4B, 0x6B, 0xE4,
+    0x3D, 0x46, 0xDA, 0x47, 0xC9, 0x9A, 0x1F, 0x22, 0x6A, 0xF1, 0x0E, 0x59, 0xE9, 0xD7, 0xEB, 0x30,
+    0xF7, 0x2D, 0x25, 0x32, 0xBE, 0xF2, 0xAD, 0x5E, 0xDB, 0xC3, 0x3A, 0x69, 0x09, 0xCA, 0x7E, 0x47,
+    0x81, 0xE3, 0x18, 0xCA, 0x51, 0x59, 0x86, 0x0C, 0xAC, 0x94, 0x41, 0x57, 0x3C, 0x42, 0x53, 0x92,
+    0x39, 0xC3, 0x43, 0x9E, 0x39, 0xC5, 0x9C, 0x85, 0xB0, 0xB0, 0x94, 0x74, 0x66, 0xA9, 0xA9, 0x29,
+    0x65, 0x01, 0x7D, 0x49, 0x95, 0x12, 0xDF, 0x5C, 0x49, 0x69, 0x3C, 0xFD, 0x25, 0xC2, 0xDE, 0xD0,
+    0x38, 0x25, 0x05, 0x38, 0x15, 0x84, 0x89, 0x56, 0x3C, 0x2D, 0x8A, 0x29, 0xAE, 0x9C, 0xD7, 0x90,
+    0xF8, 0x01, 0x3E, 0x00, 0xF7, 0x4E, 0xEC, 0x20, 0x20, 0xAF, 0x12, 0x02, 0x30, 0x0C, 0xC7, 0xB3,
+    0xF5, 0x50, 0x7A, 0x3A, 0xA1, 0x65, 0xB4, 0x4F, 0x68, 0x63, 0xDA, 0x88, 0xA6, 0xC2, 0xDB, 0x09,
+    0xBC, 0xEF, 0x07, 0x9C, 0x68, 0x1B, 0xE7, 0x0A, 0xE3, 0x3A, 0xCE, 0x36, 0x46, 0xF0, 0xB7, 0x74,
+    0xA3, 0xD0, 0xC1, 0x06, 0x12, 0x1F, 0xF5, 0xB7, 0x85, 0x2D, 0xBE, 0x42, 0xFC, 0x4B, 0x21, 0x2E,
+    0x4A, 0x79, 0xB7, 0x52, 0xE0, 0xAB, 0x3A, 0xCD, 0x90, 0x1D, 0x61, 0xEF, 0x00, 0x37, 0xC2, 0xD7,
+    0xE3, 0xF6, 0xD9, 0x59, 0xD0, 0xB6, 0x50, 0xA5, 0xA8, 0xA9, 0x56, 0xC4, 0x0F, 0x43, 0xB2, 0xB4,
+    0x6F, 0x3A, 0xA2, 0x98, 0xDB, 0x48, 0x01, 0x45, 0x93, 0x54, 0x78, 0x75, 0x02, 0xD1, 0x78, 0x4B,
+    0x1C, 0x9E, 0xCE, 0x40, 0xBA, 0x19, 0xC6, 0xB1, 0xB7, 0x3D, 0x21, 0xF7, 0x5F, 0x36, 0xA8, 0xCF,
+    0x9F, 0x0F, 0xFE, 0xAF, 0x1A, 0xD7, 0xE5, 0xA6, 0x5A, 0xF0, 0x40, 0x50, 0x6F, 0x4B, 0x60, 0x87,
+    0x13, 0xA3, 0x27, 0xDD, 0x40, 0x30, 0x58, 0x84, 0x1D, 0x5D, 0x8F, 0x4E, 0xDB, 0xDD, 0x47, 0xE6,
+    0xC4, 0xC9, 0xF6, 0x00, 0x07, 0xFF, 0x00, 0xBD, 0x59, 0x3D, 0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xB3,
+    0x2B, 0x72, 0x03, 0xAD, 0xC3, 0x51, 0x21, 0x22, 0x01, 0x68, 0x73, 0x52, 0xB8, 0x10, 0x6C, 0x91,
+    0xEB, 0x42, 0x05, 0x03, 0x1C, 0xB9, 0x6B, 0xB3, 0x50, 0xE1, 0xC2, 0x57, 0x90, 0x71, 0x19, 0xB7,
+    0x76, 0x43, 0x17, 0x2C, 0x54, 0x48, 0xDA, 0xB5, 0x0D, 0x44, 0x45, 0x80, 0x84, 0x01, 0xA2, 0x32,
+    0x88, 0x0B, 0x15, 0x8E, 0x03, 0x84, 0x4C, 0xC0, 0x82, 0x85, 0xC4, 0x1D, 0x59, 0x80, 0x55, 0x18,
+    0x88, 0xD7, 0x4E, 0x90, 0x74, 0xC9, 0x06, 0xF9, 0x31, 0x62, 0x21, 0xF6, 0x04, 0x59, 0xC7, 0x4B,
+    0x7A, 0x6F, 0x27, 0xDF, 0x9B, 0xDB, 0x3B, 0x52, 0x86, 0x0C, 0x24, 0x20, 0x73, 0xC7, 0x9B, 0xE1,
+    0xDD, 0xCE, 0xEE, 0xFB, 0x9B, 0xF7, 0xF3, 0xBD, 0x39, 0xBA, 0x40, 0x16, 0x7F, 0x2D, 0x9D, 0x27,
+    0xA2, 0x97, 0xC8, 0x90, 0xF1, 0x4A, 0xBF, 0xF4, 0x8B, 0xB0, 0x90, 0x5A, 0xE9, 0x48, 0xC7, 0x3A,
+    0xD5, 0xEB, 0x09, 0xD1, 0xAB, 0x58, 0xDE, 0x21, 0x0A, 0x5B, 0xA2, 0xDC, 0x6A, 0xEF, 0xE0, 0x8F,
+    0x45, 0xF8, 0xCF, 0xF7, 0xB5, 0xFC, 0xF0, 0x5D, 0x8A, 0xEE, 0x65, 0x14, 0xDF, 0x4B, 0x28, 0xBE,
+    0x41, 0x94, 0x7E, 0x1F, 0xE3, 0x87, 0x44, 0xF1, 0xAF, 0x05, 0x45, 0xFF, 0x98, 0xA7, 0xD0, 0x36,
+    0x24, 0xF2, 0x82, 0x68, 0x89, 0x86, 0x83, 0x5F, 0x22, 0x2F, 0x29, 0xFC, 0xA8, 0xA1, 0x28, 0x6B,
+    0x29, 0xA6, 0x3B, 0x94, 0xD2, 0x2D, 0x0C, 0x1A, 0x8E, 0x04, 0xCF, 0xD8, 0x64, 0x2A, 0xBD, 0x09,
+    0x22, 0x49, 0x37, 0x70, 0xFD, 0x2A, 0x1E, 0xFB, 0x2B, 0x51, 0x60, 0x0F, 0x76, 0x23, 0x6B, 0xCD,
+    0xB7, 0xA7, 0x6D, 0xD6, 0x51, 0x7B, 0x75, 0xED, 0xD5, 0xD4, 0x9A, 0xE8, 0x72, 0xD1, 0x13, 0xE5,
+    0x12, 0x19, 0xBC, 0x7B, 0x54, 0x2E, 0x06, 0x05, 0x2E, 0xFE, 0xF2, 0xAD, 0x4D, 0xDC, 0x10, 0x59,
+    0xD5, 0xA8, 0x83, 0xB0, 0x0A, 0x2A, 0x5F, 0xFB, 0x55, 0x98, 0xF8, 0xB5, 0x24, 0xAF, 0xB9, 0x48,
+    0xA2, 0xC1, 0x6A, 0x63, 0x88, 0x5A, 0x4D, 0x4F, 0xD9, 0xBF, 0x53, 0x6C, 0xA1, 0x9B, 0x25, 0x7A,
+    0xC5, 0xBE, 0x05, 0x15, 0x1B, 0xDC, 0x43, 0xE4, 0x63, 0xCC, 0x0D, 0x12, 0xB2, 0x56, 0x93, 0x19,
+    0xBF, 0x1C, 0xDF, 0x63, 0x5F, 0x03, 0x3C, 0x18, 0x6F, 0x68, 0x6A, 0x82, 0x92, 0x2A, 0xBF, 0xA0,
+    0xCA, 0x4B, 0x08, 0x0F, 0x92, 0x4D, 0xC8, 0xB3, 0x15, 0x05, 0x2F, 0xB4, 0x24, 0x85, 0x4D, 0x64,
+    0xA6, 0x32, 0x59, 0xCA, 0x2C, 0x68, 0x65, 0x22, 0xEC, 0x27, 0x90, 0xAC, 0x06, 0x07, 0x0C, 0xDC,
+    0xDC, 0xA3, 0xDB, 0xD0, 0x71, 0x8F, 0xAE, 0x63, 0x07, 0xA2, 0x07, 0x05, 0x4D, 0xB7, 0x8E, 0x49,
+    0x2F, 0xD4, 0xFB, 0x52, 0xDF, 0x91, 0xFA, 0xBC, 0xE8, 0xD4, 0x9D, 0xB3, 0x5B, 0x90, 0xF8, 0x3B,
+    0x0D, 0x81, 0x8F, 0x4A, 0xA4, 0x78, 0x7B, 0x55, 0x2F, 0x84, 0x0F, 0x8A, 0xB2, 0xB7, 0x28, 0xCA,
+    0x9D, 0xCD, 0x1E, 0x25, 0x9B, 0x3B, 0xB0, 0xD5, 0xD2, 0xCE, 0xDE, 0x78, 0xE2, 0xAF, 0x58, 0xA0,
+    0x4B, 0x4B, 0x2B, 0xF4, 0xD2, 0xCE, 0x45, 0xF9, 0xBB, 0xC2, 0x48, 0xAF, 0x5D, 0xD5, 0x41, 0x41,
+    0x32, 0xA1, 0xC1, 0xFA, 0x1D, 0x22, 0x65, 0x8B, 0x8E, 0x7C, 0xBE, 0x13, 0x7C, 0x68, 0xE4, 0x1B,
+    0x26, 0xF2, 0xCB, 0x38, 0x28, 0x62, 0xA9, 0xE3, 0xA7, 0x75, 0xF4, 0xFB, 0x7A, 0x4A, 0xF4, 0xE9,
+    0xC2, 0x59, 0xA2, 0x6A, 0x99, 0xFC, 0xB2, 0x26, 0x75, 0xCF, 0x50, 0x2C, 0x0B, 0x4A, 0x95, 0xC6,
+    0x7F, 0x4D, 0xEA, 0x72, 0x41, 0xE1, 0xEB, 0x25, 0xF9, 0x1A, 0xB6, 0x49, 0xCE, 0x51, 0x6A, 0x07,
+    0x78, 0x13, 0x3D, 0x71, 0xEC, 0x7D, 0x06, 0x9B, 0xDB, 0xE4, 0xCD, 0x2B, 0xB7, 0x1E, 0xA9, 0xC7,
+    0xFA, 0x9A, 0xAF, 0x17, 0xA2, 0x4F, 0x75, 0xD9, 0x0B, 0x9F, 0x83, 0x1E, 0xE1, 0xB3, 0x66, 0x73,
+    0x27, 0x7C, 0xB6, 0x5C, 0xDA, 0x09, 0x2F, 0x6B, 0x4C, 0x2D, 0xF4, 0x08, 0x5F, 0x80, 0x1E, 0xE1,
+    0xF3, 0xD9, 0xA5, 0xA5, 0x70, 0xB5, 0xD8, 0xB9, 0xA8, 0x7E, 0x54, 0x19, 0x39, 0xDB, 0x7F, 0xF1,
+    0x91, 0x7A, 0xCC, 0xAE, 0xAF, 0x43, 0x08, 0xD8, 0x9F, 0x54, 0x75, 0xFD, 0x4E, 0x35, 0x6F, 0xA4,
+    0x91, 0xD7, 0xAE, 0x45, 0xB5, 0x48, 0xD8, 0xCF, 0x7B, 0x47, 0xEF, 0x4E, 0xD2, 0x63, 0x57, 0x5C,
+    0x20, 0x8C, 0xAE, 0xBF, 0x4C, 0xFE, 0x17, 0x45, 0x70, 0xCF, 0xF8, 0x6F, 0x94, 0x14, 0x68, 0xE6,
+    0xD3, 0x23, 0x01, 0xEF, 0x4D, 0xF4, 0xCA, 0xCF, 0x75, 0x6A, 0xB3, 0xD9, 0x75, 0xF8, 0x4B, 0xE2,
+    0x7F, 0x51, 0x06, 0xEF, 0x18, 0x6F, 0x15, 0x9E, 0x50, 0x20, 0x92, 0x68, 0x23, 0xC3, 0x87, 0x0B,
+    0x41, 0x71, 0x35, 0xD4, 0xB1, 0xA5, 0xA9, 0x3E, 0xE8, 0x79, 0x83, 0xC0, 0xC8, 0x6C, 0x19, 0x92,
+    0x25, 0xB3, 0x09, 0xBC, 0x1C, 0x7E, 0x9E, 0x27, 0x39, 0x26, 0xF6, 0x38, 0x0E, 0x40, 0x3C, 0xD7,
+    0x92, 0x18, 0x88, 0x01, 0xFC, 0x0E, 0x9E, 0xE7, 0x37, 0x7E, 0x37, 0x05, 0x75, 0x58, 0x53, 0xD8,
+    0xA8, 0x9A, 0xA4, 0xFD, 0x97, 0x2D, 0x66, 0xD2, 0xBB, 0x36, 0x99, 0x67, 0x11, 0x17, 0x79, 0x5A,
+    0xE1, 0x89, 0x83, 0x84, 0x62, 0x56, 0x3D, 0xE2, 0x4F, 0x08, 0xA0, 0x2A, 0xB2, 0xDB, 0x5B, 0xB1,
+    0x95, 0xD0, 0xE3, 0x68, 0xC4, 0xDD, 0x90, 0x18, 0xF4, 0x5D, 0x0C, 0xF9, 0x5F, 0x8E, 0x5C, 0x96,
+    0x64, 0x43, 0xB3, 0x02, 0x91, 0x6D, 0x72, 0xDD, 0x19, 0xD8, 0x43, 0x28, 0xC1, 0x6D, 0x6F, 0x3F,
+    0x5D, 0xC5, 0x5B, 0x74, 0x5E, 0x34, 0xAA, 0xF9, 0x5A, 0x4D, 0x95, 0x30, 0xC2, 0x78, 0x86, 0xD3,
+    0x47, 0xDE, 0xAC, 0xAF, 0x51, 0x9E, 0x05, 0x1F, 0x19, 0xF5, 0xBA, 0x89, 0x3D, 0xB3, 0xE2, 0xE3,
+    0x5D, 0xC6, 0xA1, 0x56, 0xD0, 0xB2, 0x4F, 0x7E, 0xC2, 0xCE, 0x52, 0x91, 0x67, 0x6E, 0x93, 0xA8,
+    0x41, 0xB2, 0x89, 0xDD, 0xF0, 0xEA, 0x7D, 0x0A, 0x3E, 0xA8, 0x48, 0xAE, 0x16, 0xD4, 0x03, 0xE7,
+    0x73, 0xF0, 0x1A, 0x9A, 0x72, 0x1C, 0x91, 0x1D, 0x60, 0xDF, 0x7D, 0xF2, 0x10, 0x1C, 0xCB, 0x14,
+    0x64, 0x9C, 0x13, 0x70, 0x07, 0xE2, 0x06, 0x56, 0x45, 0xE4, 0xC0, 0xD7, 0xA9, 0x26, 0x8E, 0x4D,
+    0xC4, 0xF9, 0x2C, 0x09, 0x13, 0x26, 0x77, 0xA0, 0xAE, 0x82, 0x31, 0x67, 0xD7, 0x7B, 0xC1, 0x6D,
+    0x2C, 0xEC, 0x3E, 0x8E, 0x9B, 0x44, 0xB9, 0xC9, 0x61, 0x77, 0xB7, 0xA8, 0xA0, 0x9C, 0x6F, 0x61,
+    0xF9, 0x45, 0xF1, 0xE2, 0x67, 0x4C, 0xCD, 0x2F, 0x99, 0x45, 0xD4, 0x38, 0x07, 0x5A, 0x3B, 0xE2,
+    0x8B, 0x0D, 0x07, 0x5F, 0x5F, 0x33, 0x5F, 0x78, 0x00, 0xEE, 0x5C, 0x74, 0x7C, 0xAF, 0x3A, 0xBE,
+    0xCC, 0xB1, 0xF6, 0xD8, 0xF8, 0x55, 0xF0, 0xBD, 0x5B, 0xE0, 0x2B, 0xA3, 0x7D, 0xF0, 0x5D, 0xEE,
+    0x45, 0xE0, 0xBB, 0xB7, 0x14, 0x81, 0xA3, 0x61, 0x11, 0xF1, 0x3C, 0x38, 0x22, 0xFD, 0xE0, 0xD6,
+    0x79, 0xE2, 0x1D, 0xEC, 0xD1, 0xEE, 0x63, 0x2C, 0xED, 0xE1, 0x6D, 0x42, 0xCE, 0xB5, 0xCC, 0x57,
+    0xAC, 0xC3, 0x59, 0x5E, 0x66, 0xB6, 0xC1, 0x03, 0x4D, 0xBB, 0x14, 0xBE, 0x51, 0x82, 0xBB, 0xB7,
+    0x5A, 0xE2, 0x69, 0x0A, 0x35, 0xB8, 0xC3, 0x41, 0xC0, 0x5D, 0x6C, 0x24, 0xCC, 0x5D, 0x72, 0xBC,
+    0x3D, 0x13, 0xBE, 0x53, 0xCC, 0xD2, 0x9E, 0xBC, 0x91, 0x21, 0x95, 0xB6, 0x12, 0xFA, 0x4E, 0xF5,
+    0x97, 0x9D, 0xBE, 0x7B, 0xAC, 0x2F, 0x99, 0x23, 0x7D, 0xC3, 0x55, 0xD6, 0x57, 0x39, 0x7D, 0x7B,
+    0x4E, 0xDF, 0xEA, 0x98, 0xBE, 0x62, 0x8B, 0x82, 0x8A, 0xE0, 0x6D, 0x98, 0x45, 0xE2, 0x76, 0x39,
+    0x73, 0x5E, 0xAF, 0xB1, 0x93, 0xB8, 0x1C, 0x15, 0x9C, 0x9E, 0x2D, 0xF5, 0x2D, 0x35, 0x56, 0x34,
+    0xF9, 0x6A, 0x13, 0x59, 0x33, 0xFD, 0x76, 0xD2, 0xA5, 0x8E, 0x90, 0x2D, 0x01, 0xAF, 0x70, 0xB6,
+    0x21, 0x17, 0xF3, 0xDD, 0x8B, 0x73, 0x99, 0x67, 0x79, 0x95, 0xA7, 0x30, 0xC7, 0x34, 0x0F, 0x4A,
+    0xD4, 0xE3, 0x69, 0x33, 0xC6, 0x56, 0x1A, 0x4C, 0x5E, 0x11, 0x6B, 0x58, 0x09, 0x53, 0x78, 0x33,
+    0x45, 0x4E, 0xB1, 0x08, 0xE6, 0x65, 0x66, 0x7A, 0x85, 0x54, 0x09, 0x33, 0xCB, 0xD2, 0x2B, 0x49,
+    0x9A, 0xB9, 0x8A, 0x36, 0x0E, 0xE2, 0x81, 0x67, 0xDB, 0x11, 0x79, 0x4E, 0xD2, 0x14, 0x96, 0x23,
+    0xF7, 0xBF, 0x32, 0x29, 0xBE, 0xB8, 0x99, 0x04, 0x67, 0x1C, 0xA4, 0x4C, 0xDE, 0xD3, 0xDD, 0xC9,
+    0xF0, 0xF5, 0xEA, 0xC7, 0x38, 0xC6, 0x61, 0xE3, 0x99, 0x14, 0xD6, 0xFE, 0x66, 0x50, 0x4C, 0x86,
+    0x6F, 0xA8, 0x39, 0x62, 0xEE, 0xD6, 0xDD, 0x24, 0xA8, 0x3F, 0x19, 0xBE, 0xC2, 0x51, 0xBE, 0x0F,
+    0x2A, 0xFE, 0x73, 0xBA, 0xFB, 0xE4, 0xAE, 0xFD, 0x7F, 0x58, 0xA2, 0x6C, 0xA0, 0x72, 0xD1, 0x86,
+    0x7D, 0x9B, 0xDD, 0x6A, 0xB9, 0x75, 0x61, 0xFE, 0x2B, 0x57, 0x22, 0xC4, 0x9F, 0x1B, 0xBA, 0x04,
+    0x96, 0xF7, 0x5C, 0xC8, 0x48, 0xE7, 0x77, 0xB4, 0x10, 0x70, 0x05, 0xA7, 0x2B, 0x21, 0x87, 0x16,
+    0x19, 0xF9, 0x19, 0x4A, 0x82, 0x5F, 0x48, 0x33, 0x4C, 0xC4, 0xEC, 0x95, 0xF3, 0xEB, 0x1B, 0xA5,
+    0x0B, 0x77, 0x30, 0xDE, 0x42, 0xC4, 0xC5, 0xDA, 0x2B, 0x3C, 0x14, 0x50, 0x1D, 0xE8, 0xB9, 0x4A,
+    0xD8, 0x8F, 0xB7, 0x75, 0x3C, 0x90, 0xD6, 0x8E, 0x10, 0x8D, 0x60, 0xFE, 0xEA, 0x6F, 0x96, 0xC1,
+    0x50, 0x9A, 0x89, 0x06, 0xE9, 0x1D, 0x20, 0x01, 0xA9, 0x87, 0x49, 0x2A, 0xE7, 0xE6, 0xBC, 0xE3,
+    0x50, 0xAA, 0x9B, 0x52, 0x37, 0x65, 0xA3, 0x4F, 0xC3, 0x85, 0x82, 0x9E, 0x21, 0x55, 0x23, 0xF5,
+    0x04, 0x8C, 0x5D, 0x28, 0x67, 0xD5, 0x66, 0x98, 0xBC, 0xE2, 0xE5, 0x80, 0xC9, 0x70, 0xFC, 0x8B,
+    0x6D, 0x7C, 0xF5, 0xC6, 0x2E, 0x3D, 0xDC, 0x4B, 0x87, 0xC4, 0x48, 0x66, 0x2E, 0xCF, 0x77, 0xD7,
+    0x2D, 0xEB, 0xB2, 0x71, 0xB8, 0x8D, 0x62, 0x6B, 0x90, 0xC2, 0x24, 0x67, 0x24, 0x55, 0x62, 0xF9,
+    0xCB, 0xC2, 0x00, 0xF0, 0x50, 0x7A, 0x13, 0xBE, 0x91, 0xBB, 0xC7, 0x46, 0x93, 0x68, 0xE9, 0x2C,
+    0xAA, 0x20, 0xC2, 0x04, 0x66, 0x5B, 0xA6, 0xB9, 0x16, 0xE6, 0x85, 0xA9, 0x9B, 0x31, 0x63, 0xA7,
+    0x00, 0x5B, 0xDE, 0x77, 0xA6, 0x4B, 0x26, 0xC4, 0x37, 0xE0, 0x4F, 0x92, 0xB5, 0x5E, 0x51, 0x2E,
+    0x87, 0x27, 0x93, 0xE1, 0x5B, 0x83, 0x9B, 0x68, 0x38, 0x61, 0xD5, 0x3C, 0xF5, 0xA7, 0x26, 0xA2,
+    0x2F, 0x07, 0x86, 0xD4, 0xC3, 0xAD, 0x67, 0x38, 0x3F, 0xE4, 0x98, 0xD1, 0x46, 0x9B, 0x38, 0xFF,
+    0x42, 0xA1, 0x77, 0x2E, 0xC6, 0xCC, 0x98, 0x8D, 0x1B, 0x99, 0x83, 0xE5, 0x28, 0xFE, 0x43, 0x0E,
+    0xD6, 0x31, 0x61, 0x1E, 0x43, 0x78, 0x8C, 0x47, 0x53, 0x3B, 0x72, 0x13, 0x55, 0x0C, 0xE1, 0x08,
+    0x16, 0xBC, 0xE2, 0xF4, 0xE9, 0xB3, 0xA7, 0x86, 0xB8, 0x21, 0x82, 0x73, 0x5E, 0xE9, 0x7C, 0xF3,
+    0x34, 0xE9, 0x2F, 0xA3, 0xDC, 0xA5, 0x00, 0xB6, 0xD7, 0x61, 0xA4, 0x11, 0xE4, 0x3E, 0x2D, 0xFA,
+    0xD6, 0x1E, 0x20, 0xAD, 0x1C, 0x5A, 0xDE, 0x59, 0x55, 0xF1, 0xCE, 0x36, 0xA0, 0xE5, 0x0F, 0x40,
+    0x0C, 0x6A, 0xC5, 0x5A, 0x0C, 0x27, 0xC4, 0xAB, 0xD7, 0x8A, 0xFC, 0x26, 0xAE, 0xE5, 0x09, 0x56,
+    0x2D, 0x53, 0xB1, 0x14, 0x56, 0x58, 0x57, 0x06, 0x54, 0x63, 0xED, 0x37, 0xE8, 0x26, 0xE6, 0xDA,
+    0xED, 0x9A, 0x77, 0x36, 0x1B, 0x47, 0x90, 0x5F, 0x3D, 0xCE, 0xBE, 0x6C, 0xB9, 0xE8, 0x2F, 0xA4,
+    0x1C, 0x45, 0xE7, 0xC3, 0xF1, 0xAA, 0x35, 0x94, 0xD7, 0xB4, 0x81, 0x4C, 0x87, 0x8C, 0xD7, 0x30,
+    0x72, 0x92, 0x03, 0x4E, 0x08, 0xF3, 0x96, 0xB1, 0xC8, 0xC5, 0x3C, 0x59, 0x40, 0x86, 0x8A, 0x33,
+    0x86, 0xC0, 0x91, 0xC6, 0x7C, 0x45, 0xA2, 0x9B, 0xA2, 0xCD, 0xD0, 0xA0, 0x49, 0xDA, 0xF1, 0x6B,
+    0xF8, 0x8A, 0xF1, 0xB9, 0x59, 0x32, 0xA2, 0x35, 0x8C, 0x88, 0xE0, 0xA5, 0xD8, 0xE0, 0xB4, 0x60,
+    0x5C, 0x03, 0x2B, 0xCC, 0xFD, 0x85, 0x13, 0x4B, 0xDA, 0x38, 0xEF, 0x1A, 0x6E, 0x95, 0x73, 0x39,
+    0x0E, 0x68, 0x8A, 0xE8, 0x78, 0x44, 0x0B, 0xF6, 0x5C, 0xF5, 0xB1, 0x65, 0xCF, 0x85, 0xC2, 0x30,
+    0x42, 0x81, 0xFC, 0x06, 0x80, 0x6E, 0xD8, 0x30, 0x9C, 0x8F, 0x23, 0x36, 0x11, 0x88, 0x4A, 0xC3,
+    0x49, 0x9B, 0xA7, 0xA8, 0x40, 0x7A, 0x40, 0x2B, 0x8A, 0x29, 0xC3, 0x82, 0x7B, 0x70, 0x00, 0xEB,
+    0x01, 0xA9, 0x04, 0x83, 0x0D, 0x6C, 0x46, 0xCE, 0x8C, 0xC4, 0x51, 0x1A, 0x73, 0x51, 0xE1, 0x44,
+    0x70, 0xA9, 0x6E, 0x86, 0x26, 0xC9, 0xDC, 0x65, 0xEA, 0x98, 0xCB, 0x42, 0xDD, 0xE3, 0x38, 0x98,
+    0x99, 0x24, 0xF3, 0xFD, 0x80, 0x2B, 0xE3, 0xA7, 0x50, 0xFC, 0xA7, 0x58, 0x99, 0x16, 0xD5, 0x04,
+    0x99, 0x0B, 0x03, 0x6C, 0xEA, 0x55, 0x71, 0x37, 0x51, 0xFF, 0xCC, 0x44, 0x98, 0x7F, 0x8B, 0xB2,
+    0x3D, 0xAF, 0x5C, 0x09, 0x33, 0xF9, 0x0B, 0xEE, 0xA7, 0x3D, 0xF4, 0x4B, 0xFB, 0xB4, 0x28, 0xB3,
+    0x3D, 0xBF, 0xC4, 0x12, 0xDF, 0x54, 0x40, 0x82, 0xCF, 0xB3, 0x87, 0x24, 0x48, 0x59, 0x02, 0x0B,
+    0x09, 0xFC, 0xF7, 0x21, 0x41, 0xC8, 0x12, 0x3C, 0xC1, 0x12, 0x2C, 0xB1, 0x04, 0x06, 0x12, 0xBC,
+    0xA3, 0x21, 0xC1, 0x8D, 0x04, 0x12, 0xFC, 0x80, 0x25, 0x68, 0xF8, 0x41, 0xC3, 0x12, 0x98, 0x91,
+    0x04, 0x92, 0x25, 0xB8, 0x78, 0xA4, 0x7E, 0xC0, 0xB6, 0x16, 0xCE, 0xEF, 0xAF, 0xF1, 0x34, 0xDF,
+    0x5D, 0x8F, 0x6D, 0x61, 0xEB, 0xA8, 0x4D, 0x36, 0x4A, 0x60, 0x05, 0xC9, 0xB7, 0xCD, 0x30, 0x5A,
+    0x7E, 0x82, 0x1D, 0x65, 0x81, 0xA7, 0x1E, 0x27, 0x15, 0x87, 0x0F, 0x96, 0x38, 0x98, 0x36, 0x79,
+    0xDA, 0xE1, 0xC4, 0x62, 0xB8, 0x2C, 0x22, 0x72, 0x13, 0x44, 0x5C, 0x9A, 0xB8, 0x50, 0x43, 0x48,
+    0x47, 0x87, 0xFB, 0x7C, 0x14, 0x52, 0xD1, 0x43, 0x2F, 0x4E, 0x3A, 0x43, 0xFC, 0xED, 0x62, 0x70,
+    0x61, 0xA2, 0xCC, 0x23, 0x8E, 0x32, 0xCE, 0x39, 0xA2, 0x02, 0x30, 0x0D, 0xB2, 0x8B, 0x13, 0x64,
+    0xEE, 0x17, 0x57, 0x19, 0xFF, 0xC3, 0xEE, 0x41, 0x81, 0x49, 0x24, 0xE7, 0x26, 0xA9, 0xB9, 0x83,
+    0x7F, 0xD2, 0x15, 0x67, 0xFE, 0x3A, 0x6A, 0x02, 0x72, 0xFB, 0x9C, 0x2D, 0xD3, 0x03, 0x91, 0x6F,
+    0x49, 0x6E, 0xFF, 0x64, 0x05, 0xCC, 0x19, 0x70, 0x7F, 0x8A, 0xA6, 0x1E, 0x98, 0xB4, 0x41, 0x3A,
+    0xF4, 0x06, 0x9C, 0x18, 0xDA, 0x1E, 0x67, 0x67, 0x7E, 0x2C, 0x2F, 0x1F, 0x02, 0x73, 0x5C, 0x4F,
+    0x8E, 0xEA, 0xFA, 0x37, 0x6C, 0x9F, 0x35, 0x32, 0x5D, 0x41, 0x72, 0x15, 0x69, 0x98, 0x68, 0xE4,
+    0x21, 0x1F, 0x73, 0x70, 0x85, 0x8F, 0x3E, 0xB0, 0xD4, 0x45, 0x0C, 0x63, 0xDE, 0x94, 0xC3, 0x26,
+    0x4D, 0x5C, 0xEC, 0xE0, 0x9A, 0x3B, 0x65, 0xB0, 0xC1, 0x00, 0xA1, 0xC0, 0xC9, 0xBB, 0x5D, 0xEB,
+    0x3A, 0x27, 0x2E, 0x50, 0xE3, 0x0A, 0xE8, 0x60, 0x88, 0x67, 0x59, 0x27, 0xF5, 0x27, 0xEB, 0x10,
+    0x03, 0x97, 0xF3, 0xDC, 0x15, 0x75, 0xCB, 0xF3, 0x14, 0x8A, 0x53, 0x42, 0x6A, 0x10, 0x1D, 0x32,
+    0x78, 0xE2, 0xC2, 0xE7, 0x37, 0x9C, 0x6C, 0xFD, 0x3A, 0x77, 0xD6, 0x60, 0x05, 0x82, 0x2A, 0xE6,
+    0x6E, 0xD3, 0xA0, 0xC4, 0x40, 0x46, 0x06, 0xEB, 0xB2, 0x4C, 0xB0, 0xAC, 0x7E, 0xA3, 0x01, 0x2D,
+    0xA3, 0xFB, 0x05, 0xE6, 0xF8, 0xFE, 0x67, 0x58, 0x8D, 0xEF, 0x32, 0x44, 0x8E, 0x5D, 0x99, 0x4A,
+    0x93, 0x31, 0x92, 0x19, 0x06, 0xD1, 0x5C, 0x35, 0x06, 0x86, 0x34, 0x3A, 0x03, 0xA0, 0x28, 0xE3,
+    0x56, 0x84, 0xFB, 0xF8, 0xE1, 0xB5, 0xB3, 0x5B, 0x7D, 0x18, 0xDB, 0xF8, 0xB5, 0x2A, 0x65, 0xA9,
+    0x8A, 0x88, 0xCF, 0x2C, 0xA1, 0x38, 0xEB, 0xCD, 0x6A, 0x5B, 0x3E, 0xB4, 0x60, 0xDD, 0xD1, 0x2D,
+    0xD8, 0x20, 0xE7, 0x33, 0xA8, 0x3A, 0xAA, 0xE2, 0xF2, 0x98, 0xEB, 0x16, 0x8E, 0xB0, 0xE0, 0x2E,
+    0x39, 0x3B, 0x1D, 0x9A, 0x0C, 0x2A, 0xD5, 0x60, 0x08, 0x29, 0x47, 0x88, 0xF2, 0xA4, 0x34, 0x95,
+    0x7E, 0x93, 0xE2, 0xC3, 0x82, 0xFE, 0x8D, 0x9D, 0xDA, 0x5A, 0x3C, 0x1D, 0x39, 0xF7, 0x64, 0x42,
+    0x0D, 0x0C, 0xDA, 0xA8, 0x84, 0xCE, 0x4D, 0x9D, 0x9E, 0xEE, 0x12, 0x99, 0xEF, 0xEB, 0x80, 0x18,
+    0x33, 0xF3, 0x1D, 0xC0, 0x3E, 0x21, 0xDD, 0xB3, 0x5B, 0xD3, 0x6F, 0x71, 0x0F, 0x93, 0x5A, 0xB4,
+    0x42, 0xAA, 0x8E, 0xB5, 0x2C, 0x43, 0xC3, 0x14, 0x54, 0x01, 0x1A, 0x59, 0xC4, 0x14, 0x92, 0xF8,
+    0x5D, 0x4E, 0xD1, 0x29, 0xFC, 0x09, 0xB4, 0x7E, 0xEC, 0x4E, 0xD5, 0xD8, 0x67, 0x3D, 0x9B, 0x9D,
+    0x01, 0xC5, 0x58, 0x3F, 0x4E, 0xE9, 0x40, 0x1D, 0xD6, 0x14, 0x55, 0x81, 0x1D, 0x8B, 0x3B, 0x7D,
+    0xCB, 0xF5, 0x46, 0xBE, 0xC9, 0x11, 0xC3, 0x31, 0x45, 0x7A, 0x99, 0x86, 0xFE, 0x3E, 0xC6, 0x72,
+    0xE3, 0x91, 0x66, 0x97, 0x28, 0xFE, 0xC2, 0x00, 0x7F, 0xC2, 0x4B, 0x4A, 0xEE, 0xC3, 0xBB, 0x3C,
+    0xBF, 0x4C, 0xF4, 0x54, 0xD3, 0xA5, 0xC0, 0xAF, 0xF2, 0xD2, 0x87, 0xF8, 0xA4, 0xC4, 0x12, 0xC7,
+    0xC9, 0x80, 0xF2, 0xB0, 0x76, 0xE1, 0xCC, 0xC1, 0xFD, 0x48, 0x3E, 0xE3, 0x17, 0x23, 0xCD, 0xFC,
+    0x61, 0x2F, 0x3D, 0x29, 0xCD, 0x91, 0x97, 0x5E, 0x8B, 0x20, 0x66, 0x78, 0x3A, 0x34, 0x2B, 0x05,
+    0x11, 0xE3, 0x04, 0xE3, 0xA8, 0xFA, 0x9F, 0x88, 0x66, 0x9C, 0x29, 0x3E, 0xE1, 0x05, 0xFE, 0x9C,
+    0xED, 0xA7, 0x15, 0x23, 0x06, 0x78, 0x8F, 0xF3, 0x1F, 0xE4, 0xB8, 0x2C, 0xC5, 0x5F, 0xDC, 0x44,
+    0x5D, 0x4A, 0x46, 0x36, 0x8F, 0xF9, 0xE4, 0x7D, 0xD8, 0x79, 0xCC, 0xF6, 0x29, 0xAD, 0xC8, 0x21,
+    0x0C, 0xC6, 0xED, 0x58, 0x44, 0x73, 0x12, 0x39, 0xB4, 0x8A, 0x7C, 0x93, 0xBA, 0x37, 0xAA, 0x7A,
+    0x34, 0xCE, 0xE7, 0x40, 0xDA, 0x36, 0x93, 0x37, 0xF4, 0xB2, 0xE0, 0xE7, 0xA7, 0xD6, 0xD8, 0x38,
+    0xEE, 0x14, 0x96, 0x41, 0x45, 0xE0, 0x8E, 0xC5, 0xC2, 0xE3, 0xD4, 0x00, 0x5B, 0x80, 0xCB, 0x07,
+    0xDD, 0xD3, 0x57, 0x65, 0x36, 0x50, 0xBA, 0x91, 0xD9, 0x30, 0x90, 0xFE, 0x67, 0xEE, 0xB4, 0xE7,
+    0xA1, 0x51, 0xD8, 0x26, 0x3E, 0x80, 0xE3, 0x15, 0xDA, 0xBD, 0x3E, 0x3C, 0xDA, 0x8D, 0xB6, 0x33,
+    0x0F, 0x3D, 0x3C, 0x63, 0x13, 0xB8, 0x3C, 0x1C, 0x5E, 0x15, 0x39, 0x88, 0x59, 0x50, 0x43, 0x42,
+    0xE6, 0xC1, 0xC1, 0x83, 0x3F, 0xB4, 0x06, 0x0F, 0xAA, 0x2F, 0xB9, 0x4D, 0x60, 0x2E, 0x70, 0x7B,
+    0x8B, 0xF2, 0xB2, 0x9C, 0xA3, 0x58, 0x3C, 0x39, 0x6A, 0x08, 0xA6, 0xD6, 0xA6, 0xB7, 0x48, 0x35,
+    0x10, 0xD1, 0x1F, 0x7C, 0x5A, 0x43, 0x71, 0xD6, 0x72, 0xC0, 0x7A, 0x36, 0x8C, 0x6E, 0xAA, 0x90,
+    0x75, 0x75, 0xD2, 0x3B, 0xF9, 0x59, 0x83, 0xC2, 0x29, 0xC0, 0x36, 0xD6, 0x8A, 0x19, 0x8F, 0x35,
+    0xFF, 0x4A, 0x9F, 0x7F, 0x13, 0x36, 0x6D, 0xB9, 0x18, 0x64, 0xB2, 0xE4, 0xFD, 0x52, 0x40, 0x74,
+    0x10, 0x3E, 0x89, 0x8E, 0x09, 0x9F, 0x0E, 0x85, 0x17, 0x8F, 0x10, 0x9E, 0xAB, 0x13, 0x77, 0xE6,
+    0x2B, 0xC8, 0x24, 0xBB, 0x9D, 0xD3, 0x9F, 0x94, 0xE6, 0xA3, 0xB2, 0xE8, 0x49, 0x69, 0x5E, 0x85,
+    0x51, 0x07, 0xC0, 0x5C, 0xB7, 0x31, 0xCE, 0x89, 0x53, 0xA1, 0xD9, 0x73, 0x99, 0xE5, 0xC2, 0xC8,
+    0xB8, 0xDD, 0xCF, 0x29, 0xEE, 0x75, 0xC1, 0x2D, 0x5D, 0xEB, 0xBE, 0x3D, 0x49, 0xE2, 0x67, 0x06,
+    0xB8, 0x00, 0xD0, 0x18, 0x0D, 0x65, 0xAD, 0xB0, 0x5D, 0x71, 0xA5, 0xCA, 0xCF, 0xAB, 0xE8, 0xC3,
+    0xF7, 0xAA, 0xF8, 0xBD, 0xE7, 0x4D, 0xFC, 0x07, 0x5C, 0x69, 0x54, 0x19, 0x73, 0xBE, 0x2C, 0xD2,
+    0x44, 0x1E, 0x02, 0xC1, 0x5A, 0x86, 0x3D, 0x44, 0xE7, 0xC6, 0xC9, 0x25, 0x19, 0x9E, 0x0B, 0xB9,
+    0xA3, 0xC4, 0xE1, 0xCF, 0x5B, 0xB3, 0x6B, 0x02, 0xF1, 0x16, 0x20, 0xE2, 0xD8, 0x0F, 0xC6, 0x71,
+    0xC7, 0x91, 0x37, 0x8C, 0x3D, 0x17, 0x7F, 0x79, 0x96, 0xBE, 0x66, 0xB3, 0xF4, 0x3E, 0x47, 0x21,
+    0xE2, 0xD0, 0x1C, 0x73, 0x67, 0x07, 0x4E, 0xB8, 0xB0, 0xDF, 0x19, 0x7B, 0xC4, 0x89, 0x69, 0x72,
+    0xFB, 0x1F, 0xF0, 0x09, 0xF6, 0xF3, 0x7A, 0xD4, 0xFE, 0x9F, 0x98, 0xA6, 0xF2, 0xE1, 0xD1, 0x97,
+    0x61, 0x43, 0xFC, 0x3F, 0x33, 0x3C, 0xF6, 0x3E, 0xB9, 0xEE, 0xDD, 0x41, 0x9D, 0xFB, 0x61, 0x86,
+    0xEB, 0xDF, 0xE8, 0x2C, 0x84, 0xD3, 0x02, 0x1C, 0xB0, 0x72, 0x09, 0xC5, 0xFD, 0xCC, 0x43, 0xEE,
+    0x87, 0xC6, 0x3D, 0x3E, 0xD7, 0xE7, 0x9F, 0x22, 0xB9, 0xB0, 0x58, 0xD6, 0x2C, 0x67, 0x87, 0x4F,
+    0x5F, 0x60, 0x22, 0x3F, 0x19, 0x75, 0x93, 0x91, 0x19, 0x41, 0x4D, 0x77, 0x36, 0xB7, 0x38, 0x3A,
+    0x6A, 0x0F, 0x70, 0xFD, 0xA9, 0x3C, 0xEB, 0xEE, 0xF2, 0x2C, 0xBA, 0x9D, 0xF4, 0xCB, 0x87, 0x13,
+    0x08, 0x77, 0x8B, 0xE5, 0xF6, 0xA3, 0x86, 0xEC, 0x6B, 0x03, 0x40, 0xB2, 0xD6, 0x1B, 0x50, 0xEB,
+    0x37, 0x02, 0x41, 0xEF, 0x35, 0x41, 0x0D, 0x44, 0x5A, 0xF9, 0x55, 0xE8, 0x34, 0x56, 0x5A, 0x1E,
+    0xE4, 0x89, 0x02, 0x0A, 0x8C, 0x8E, 0x91, 0x71, 0xA4, 0x7E, 0x4B, 0x7C, 0x8C, 0x30, 0x7A, 0xF1,
+    0x71, 0x89, 0x3B, 0x2F, 0x71, 0x07, 0x26, 0xE3, 0x13, 0x93, 0x49, 0x68, 0xF9, 0x1F, 0xC5, 0x5A,
+    0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x1E, 0x92, 0xBE, 0x63, 0x22, 0xC2, 0xA2, 0x0B, 0x0B, 0x8E, 0x75,
+    0xB0, 0xE8, 0x22, 0x08, 0x82, 0x58, 0x12, 0x5D, 0x38, 0x80, 0x82, 0xDC, 0x89, 0xB4, 0x8B, 0xB8,
+    0xD4, 0x16, 0x77, 0x48, 0x91, 0x42, 0xAE, 0x53, 0xF8, 0x52, 0x1C, 0x82, 0x4B, 0x70, 0x12, 0x29,
+    0xA8, 0x70, 0x91, 0x22, 0xD7, 0x08, 0x29, 0x82, 0x20, 0x2A, 0x5C, 0x24, 0x72, 0x21, 0x05, 0x70,
+    0x00, 0x05, 0x90, 0x45, 0xCA, 0x2A, 0x5C, 0xB8, 0xA1, 0x1C, 0x04, 0x2E, 0x52, 0x98, 0x46, 0x64,
+    0x17, 0x32, 0x10, 0xD3, 0x01, 0x9D, 0xAC, 0x4E, 0x24, 0x27, 0xDF, 0xF7, 0x48, 0xEE, 0x8F, 0xA4,
+    0x83, 0x25, 0xDF, 0xDE, 0x7A, 0x7F, 0xE6, 0x6E, 0x77, 0xC9, 0x99, 0xF7, 0xDE, 0xBC, 0xF9, 0xDE,
+    0xF7, 0xDE, 0x8C, 0x52, 0xF2, 0xB0, 0x75, 0xC1, 0x26, 0x57, 0xDD, 0xA3, 0xC1, 0xDB, 0xD4, 0x68,
+    0x2C, 0x36, 0x4E, 0x82, 0xE6, 0x48, 0x14, 0x2A, 0xB5, 0xCC, 0x66, 0x23, 0x88, 0x95, 0x2A, 0xD0,
+    0x98, 0x59, 0x90, 0x2A, 0x2B, 0x45, 0xE3, 0x5C, 0x88, 0x52, 0xE5, 0x69, 0x9D, 0xA9, 0x15, 0xE5,
+    0x67, 0x6A, 0x53, 0x79, 0xB9, 0x2A, 0x94, 0x9B, 0x9B, 0xB9, 0x72, 0x8B, 0xA5, 0x52, 0xAD, 0xDF,
+    0x0D, 0x6A, 0x53, 0x37, 0xD2, 0x77, 0xA0, 0xDB, 0x37, 0x1F, 0x07, 0xB6, 0x07, 0x2A, 0xD1, 0x85,
+    0x35, 0xF4, 0x72, 0x37, 0xF7, 0x32, 0x3F, 0xF5, 0xD3, 0x20, 0x0E, 0xD2, 0x28, 0x0C, 0xD2, 0x44,
+    0x45, 0xB1, 0x56, 0x49, 0xA8, 0x15, 0x9E, 0x90, 0x45, 0xDB, 0xF8, 0xA6, 0x4A, 0x86, 0x7E, 0x19,
+    0x8C, 0xC4, 0xA4, 0xE4, 0xE1, 0x06, 0xA4, 0xFC, 0xB4, 0xA0, 0xBC, 0x29, 0x3E, 0x9F, 0x55, 0xF3,
+    0xD0, 0xE1, 0x84, 0x15, 0xAB, 0x93, 0xEB, 0x4A, 0x79, 0x35, 0x24, 0xC8, 0x67, 0xA1, 0xCB, 0xFE,
+    0x49, 0xBB, 0x84, 0x0E, 0xD4, 0x35, 0x8E, 0x51, 0xE2, 0x6D, 0x0C, 0xF9, 0x1F, 0x6E, 0x53, 0x0A,
+    0x1D, 0x7C, 0x6D, 0x99, 0x8F, 0xA1, 0x27, 0xD8, 0xDC, 0xCA, 0xBB, 0xB7, 0xC6, 0x20, 0xC9, 0xC8,
+    0xF4, 0x14, 0xB7, 0xD5, 0x88, 0x43, 0xDA, 0x71, 0xF7, 0xB5, 0xA1, 0x61, 0x2E, 0xEF, 0x53, 0x28,
+    0x18, 0x85, 0x51, 0x6C, 0x54, 0x2A, 0x08, 0xAD, 0x21, 0xE4, 0x77, 0xD1, 0x13, 0xE5, 0x57, 0xD4,
+    0x04, 0x77, 0xA7, 0x7D, 0x13, 0x49, 0x13, 0xF7, 0xFF, 0xB5, 0x3F, 0x64, 0xEA, 0x45, 0xE5, 0x0D,
+    0x31, 0xBA, 0xAD, 0x39, 0xE3, 0x49, 0xA3, 0x26, 0x1F, 0x1E, 0x7A, 0x08, 0x20, 0x4C, 0x85, 0xC1,
+    0xB3, 0xF6, 0xAB, 0xC5, 0x37, 0xE5, 0x2A, 0xAB, 0x48, 0x94, 0x9B, 0x05, 0xCA, 0x4F, 0x57, 0xE4,
+    0x0A, 0x8A, 0xAB, 0xEF, 0x7B, 0x47, 0xF1, 0x4B, 0x2A, 0xB8, 0x57, 0x28, 0x47, 0xC7, 0x93, 0x9D,
+    0x8A, 0x80, 0x01, 0x2D, 0x37, 0xDC, 0x62, 0xBF, 0x47, 0xE6, 0xA7, 0x90, 0x05, 0x45, 0x5C, 0x7C,
+    0x73, 0xD2, 0x55, 0xEA, 0x6D, 0x2B, 0x9E, 0x91, 0x42, 0x4E, 0xD1, 0x6B, 0xE5, 0x52, 0x4A, 0x43,
+    0xCD, 0x51, 0x21, 0x98, 0xD1, 0x86, 0x52, 0x16, 0x5D, 0x23, 0x9C, 0xD5, 0x0C, 0x95, 0x2E, 0xAE,
+    0x3F, 0x73, 0x86, 0xA3, 0x97, 0xBD, 0xA8, 0x73, 0x52, 0x68, 0xD3, 0x49, 0xD5, 0xC9, 0x00, 0xBD,
+    0x55, 0x9D, 0x49, 0x67, 0xA2, 0x10, 0x7B, 0x95, 0x6E, 0xA5, 0xDF, 0x76, 0xC2, 0x64, 0xE5, 0xEA,
+    0xBB, 0x4A, 0xAD, 0xEF, 0x60, 0x01, 0xBB, 0x85, 0x57, 0x62, 0xFA, 0xE0, 0x20, 0x5E, 0x6E, 0xD5,
+    0xD0, 0xC3, 0x6C, 0x20, 0xAE, 0xD1, 0x35, 0x51, 0x8C, 0x8F, 0x51, 0x88, 0x26, 0x09, 0xF1, 0xAB,
+    0xA6, 0x23, 0x69, 0xE5, 0x94, 0xF8, 0xC9, 0x2B, 0xCC, 0x1A, 0x17, 0x59, 0x95, 0xA1, 0xC3, 0xA5,
+    0xE6, 0xF2, 0x50, 0x45, 0x5A, 0xC6, 0x0E, 0x2A, 0x0E, 0xB7, 0x54, 0x9D, 0x94, 0x59, 0xBA, 0xCA,
+    0x95, 0x5B, 0xD2, 0x42, 0x0E, 0x2D, 0x7A, 0xF8, 0xF7, 0x85, 0x8C, 0xCE, 0x45, 0x3F, 0xA4, 0xE1,
+    0x88, 0x17, 0xB0, 0x1E, 0x10, 0x83, 0xEB, 0x9D, 0x76, 0x22, 0x6A, 0x50, 0x47, 0x5A, 0x8F, 0xC8,
+    0xC1, 0x56, 0xB4, 0x14, 0x5C, 0x23, 0x7E, 0xE0, 0x9A, 0x3A, 0xC1, 0xFC, 0x4F, 0x61, 0xF8, 0x23,
+    0x6A, 0x04, 0xD3, 0x9B, 0x8D, 0x91, 0x5C, 0x78, 0x1C, 0x8D, 0x5C, 0x0E, 0xBC, 0xA8, 0x7B, 0x7C,
+    0x25, 0x5A, 0xAA, 0xB7, 0x9A, 0xED, 0x76, 0x55, 0x39, 0xF7, 0xD0, 0x24, 0x7A, 0xA8, 0xCC, 0x0A,
+    0x1A, 0xDA, 0xA5, 0x43, 0xF8, 0xC4, 0x04, 0x7A, 0x19, 0xD6, 0x84, 0x9F, 0x42, 0xC7, 0x20, 0x85,
+    0x73, 0x04, 0x44, 0x5B, 0xC0, 0x21, 0x9A, 0x1B, 0x9F, 0x13, 0x72, 0xFD, 0x46, 0x39, 0xB5, 0x3B,
+    0x9C, 0x42, 0x1D, 0xF1, 0x88, 0xA4, 0x1E, 0x69, 0x84, 0x48, 0xBA, 0xBE, 0x73, 0x99, 0x1A, 0x59,
+    0x19, 0x35, 0xC2, 0x7D, 0xB9, 0x99, 0x3E, 0xE0, 0x6B, 0x1A, 0x96, 0x8D, 0x2E, 0x0C, 0x3A, 0xE8,
+    0xD4, 0x7D, 0x03, 0x8D, 0x0E, 0x28, 0x68, 0x74, 0x84, 0x72, 0xAE, 0xA8, 0xA5, 0xE6, 0x52, 0x45,
+    0x8D, 0x2A, 0xF5, 0x40, 0xFC, 0x9C, 0xF2, 0xB3, 0x08, 0x52, 0x27, 0xF0, 0xB3, 0x5A, 0x25, 0xCE,
+    0x50, 0xD1, 0x02, 0x7A, 0xF0, 0x95, 0x7E, 0x56, 0x00, 0x57, 0xD4, 0xDF, 0xCE, 0xF4, 0xF8, 0xE6,
+    0x6C, 0xCF, 0x45, 0x87, 0x0D, 0x3B, 0x94, 0xF8, 0xE9, 0x73, 0x1E, 0xF2, 0x59, 0xE9, 0x22, 0x58,
+    0xE6, 0x09, 0xAA, 0x65, 0x93, 0xA8, 0xB6, 0xBF, 0xBA, 0xD8, 0x18, 0xD0, 0x2D, 0xDB, 0x25, 0x6A,
+    0x84, 0x7B, 0xD7, 0x65, 0x1F, 0xA5, 0x95, 0x48, 0x7C, 0x9C, 0x17, 0x6E, 0xB1, 0x79, 0x87, 0x4D,
+    0xD4, 0x23, 0xE1, 0xD7, 0x95, 0xF9, 0x6C, 0xCB, 0x2C, 0x4C, 0x22, 0x83, 0xD0, 0x30, 0x7C, 0x97,
+    0x84, 0x63, 0xFF, 0xC2, 0xBF, 0x5B, 0x63, 0x60, 0xCE, 0xE6, 0x32, 0x27, 0x5B, 0x36, 0x3A, 0xF2,
+    0x31, 0x2F, 0xD5, 0x18, 0x3A, 0x67, 0xE0, 0x5F, 0xA5, 0xA0, 0x24, 0x9A, 0x6A, 0x85, 0x34, 0xE0,
+    0xE0, 0xE4, 0xF2, 0x77, 0x76, 0x92, 0x0C, 0x37, 0xFA, 0x85, 0x51, 0x53, 0x9B, 0xA1, 0x72, 0xE3,
+    0x71, 0x90, 0x09, 0xB2, 0x71, 0x7C, 0x39, 0x70, 0xE9, 0x62, 0x14, 0x7B, 0xBA, 0x40, 0x38, 0xD2,
+    0x84, 0x69, 0x22, 0x97, 0x59, 0x09, 0x7C, 0xC1, 0x79, 0xD1, 0xD8, 0xCD, 0xFA, 0x90, 0xC8, 0xB4,
+    0x3D, 0x05, 0x31, 0xD2, 0x85, 0xC0, 0x6F, 0x41, 0x67, 0x0B, 0x4F, 0x48, 0x78, 0x83, 0x7C, 0x3F,
+    0x3F, 0x95, 0x23, 0x2E, 0xED, 0xE4, 0xCA, 0x3B, 0x5F, 0x86, 0x2A, 0x30, 0x71, 0xEF, 0x75, 0x06,
+    0xD9, 0x9A, 0x11, 0xF6, 0x1D, 0x7A, 0x67, 0x74, 0x1A, 0x23, 0xFB, 0x84, 0xA8, 0x5F, 0x85, 0x2D,
+    0x6F, 0x53, 0x66, 0xF3, 0x26, 0x83, 0x23, 0xA3, 0x19, 0x27, 0xC2, 0xF9, 0xE4, 0x72, 0xA1, 0x02,
+    0xBA, 0xF2, 0x59, 0xF2, 0xD9, 0x48, 0xB9, 0x80, 0xBB, 0x3B, 0x09, 0xC1, 0xF3, 0xF6, 0x48, 0x82,
+    0x2B, 0x0E, 0x9A, 0x33, 0xAF, 0xF7, 0x36, 0x70, 0xF2, 0x39, 0xAA, 0x6F, 0xA5, 0xCB, 0x10, 0xFA,
+    0x4B, 0x4E, 0x80, 0x64, 0x29, 0xC7, 0xC3, 0xB9, 0xAB, 0xBF, 0x1B, 0x67, 0x9A, 0xCB, 0xEC, 0x7B,
+    0x69, 0xDF, 0x0F, 0xE3, 0xAD, 0x5A, 0x50, 0x73, 0x57, 0x7F, 0x7F, 0xB5, 0x5C, 0xE0, 0x7C, 0x7A,
+    0xC2, 0x42, 0xF8, 0x71, 0x99, 0xCD, 0x6B, 0x93, 0x61, 0x8A, 0x3E, 0xC0, 0x01, 0x5C, 0x0E, 0xE0,
+    0xCD, 0x7F, 0xF6, 0x21, 0x6C, 0xAC, 0xFA, 0x24, 0xD3, 0xB9, 0x49, 0x85, 0x8F, 0xA8, 0x2B, 0xE3,
+    0x08, 0xF3, 0x06, 0xA0, 0x67, 0xBD, 0xF9, 0x09, 0xEE, 0x80, 0x45, 0x00, 0x7F, 0xF0, 0x91, 0x44,
+    0x0C, 0xA3, 0x85, 0x62, 0x32, 0x66, 0x93, 0xC9, 0xD0, 0x0E, 0xB5, 0xEA, 0x90, 0x2A, 0xBA, 0xF0,
+    0x53, 0x52, 0x10, 0x32, 0x52, 0x5C, 0x60, 0x4B, 0x0B, 0x2A, 0x82, 0xCB, 0xD0, 0x07, 0x2E, 0x43,
+    0x2B, 0x5C, 0x08, 0xE8, 0xF6, 0x72, 0x54, 0xE2, 0xA6, 0x9B, 0xBA, 0x67, 0x9E, 0x20, 0xA7, 0x06,
+    0xD8, 0x8C, 0x7D, 0x0B, 0xA4, 0x45, 0x6D, 0x88, 0x7B, 0x22, 0x05, 0x5B, 0xEC, 0x01, 0x0C, 0x97,
+    0x61, 0x8A, 0xC0, 0x6C, 0x0E, 0xC7, 0x56, 0x95, 0x14, 0x56, 0xF3, 0x79, 0x69, 0x69, 0xA7, 0xB4,
+    0xC1, 0x74, 0x9C, 0xA1, 0x53, 0xB8, 0xED, 0x33, 0xF7, 0x98, 0xF3, 0x49, 0xD6, 0x87, 0xBC, 0x8F,
+    0xCF, 0xD8, 0xD7, 0x51, 0xD8, 0x71, 0x9B, 0x5D, 0x74, 0xB2, 0x80, 0xDC, 0xBA, 0x34, 0x93, 0x3B,
+    0x97, 0xF4, 0xC5, 0x59, 0xE9, 0x34, 0x29, 0xBB, 0x07, 0xC6, 0xBE, 0xD4, 0xFC, 0x09, 0xB2, 0x93,
+    0xA6, 0x45, 0x99, 0x55, 0xEB, 0xC2, 0xD6, 0xA7, 0x4A, 0xBB, 0x76, 0x0A, 0x67, 0xE8, 0x3E, 0x9A,
+    0xEC, 0x82, 0xD6, 0xD9, 0x15, 0x15, 0xC0, 0x33, 0xFE, 0x8A, 0x29, 0xDB, 0x3E, 0xDE, 0xCF, 0x53,
+    0x0C, 0x8D, 0x42, 0x59, 0xC6, 0x5C, 0xC5, 0x74, 0x5C, 0x06, 0x1C, 0xBA, 0xAD, 0xBC, 0x63, 0xD2,
+    0x58, 0xD5, 0x91, 0x57, 0x79, 0x53, 0x41, 0xAA, 0x47, 0xCA, 0xB8, 0x84, 0x5B, 0x23, 0xF1, 0x00,
+    0xA0, 0xDF, 0x4B, 0x5E, 0x53, 0xAC, 0x24, 0xF9, 0xF3, 0x4B, 0xF4, 0x8B, 0x85, 0x55, 0xD6, 0x02,
+    0x70, 0x0D, 0x5F, 0x43, 0xEA, 0x6D, 0x97, 0x44, 0x0C, 0x97, 0xA4, 0x92, 0xC3, 0xE0, 0x05, 0x36,
+    0xEA, 0xD4, 0x63, 0x3C, 0x87, 0xCE, 0x3D, 0x8D, 0x9B, 0x9D, 0x58, 0xE8, 0xB1, 0xED, 0xF4, 0xD0,
+    0x40, 0xC1, 0xBC, 0xEE, 0xA4, 0x04, 0x19, 0xB1, 0x83, 0x64, 0x36, 0x26, 0x45, 0xC7, 0x0B, 0x30,
+    0xEE, 0x97, 0x23, 0x81, 0x8E, 0x22, 0xF8, 0x7A, 0xA7, 0x43, 0xC9, 0x36, 0xCD, 0x72, 0xD6, 0x82,
+    0x2D, 0x5B, 0xA9, 0x7F, 0x3A, 0x44, 0xDF, 0xE6, 0xED, 0xC7, 0x17, 0x6F, 0x46, 0x62, 0x18, 0x4C,
+    0x5B, 0x70, 0xA9, 0x47, 0x18, 0xED, 0x32, 0x2B, 0xBB, 0x73, 0x98, 0x44, 0xEE, 0xC2, 0xEB, 0x69,
+    0xF5, 0x58, 0xD3, 0x69, 0x67, 0xEC, 0x0A, 0x74, 0x00, 0x14, 0x27, 0x28, 0x46, 0x89, 0x67, 0xEB,
+    0xBD, 0x6D, 0xB6, 0xDB, 0x67, 0xB9, 0x33, 0xD2, 0xE2, 0xD0, 0x20, 0x2A, 0x27, 0x96, 0x80, 0xB8,
+    0x7E, 0x84, 0x67, 0x50, 0x89, 0xB5, 0xB4, 0xFE, 0x0D, 0x72, 0x9A, 0xD1, 0xB2, 0xD5, 0x32, 0x16,
+    0xD7, 0x55, 0xCE, 0xCE, 0x90, 0x53, 0xD5, 0xAA, 0xC5, 0xE1, 0xBE, 0x8D, 0x29, 0x63, 0x14, 0x42,
+    0x41, 0x8C, 0xCC, 0x5C, 0x4F, 0x8B, 0x84, 0xD2, 0x32, 0xB7, 0xCA, 0x29, 0x01, 0xE4, 0xC4, 0xC5,
+    0x98, 0x20, 0x48, 0x01, 0x59, 0x21, 0x87, 0x20, 0x7D, 0x9B, 0x29, 0x77, 0x95, 0x9F, 0xA6, 0x57,
+    0x5C, 0x19, 0xA7, 0x5B, 0x98, 0xED, 0x59, 0xA0, 0x59, 0xF5, 0xE9, 0x1A, 0x1A, 0x5C, 0x36, 0x50,
+    0x4F, 0xB5, 0x3F, 0x1C, 0x1A, 0xC0, 0xD2, 0x51, 0x89, 0x34, 0xC0, 0x65, 0x54, 0x68, 0x1B, 0x06,
+    0x16, 0x2F, 0x87, 0x3C, 0x5E, 0x06, 0x93, 0xFB, 0x29, 0xE4, 0x08, 0x52, 0x28, 0x11, 0xC4, 0x90,
+    0x05, 0x61, 0x45, 0x42, 0x50, 0xCA, 0x74, 0x35, 0x65, 0x26, 0x29, 0xB9, 0x7A, 0xA8, 0x26, 0x08,
+    0x22, 0xA1, 0x4F, 0x2D, 0xD1, 0xF2, 0xD1, 0xF6, 0x34, 0x79, 0x63, 0xBE, 0xA1, 0xAE, 0x91, 0xBC,
+    0xE5, 0x6E, 0xCF, 0x2C, 0x88, 0xA9, 0x46, 0x72, 0x77, 0xC4, 0x3A, 0xE3, 0x5E, 0x2D, 0x21, 0xB1,
+    0x93, 0x84, 0xB3, 0xEB, 0x99, 0x16, 0x94, 0x19, 0x69, 0x1B, 0xF1, 0x20, 0xC9, 0x91, 0xDD, 0x62,
+    0xAA, 0x69, 0xCB, 0x0B, 0xA3, 0x3E, 0x29, 0x1E, 0xB1, 0x51, 0x25, 0xDB, 0xE3, 0x72, 0x0B, 0xAB,
+    0xAE, 0xA1, 0xF2, 0x5E, 0x4D, 0xD5, 0xB2, 0xD1, 0x52, 0x63, 0x18, 0x44, 0xCA, 0x8A, 0xD6, 0x84,
+    0x07, 0x71, 0x08, 0xBB, 0x4B, 0x31, 0x46, 0xDE, 0x93, 0x3D, 0xDC, 0x7B, 0x28, 0x6B, 0xDD, 0xAA,
+    0x1F, 0x65, 0x9D, 0x3F, 0xA4, 0xF0, 0x87, 0x57, 0xE1, 0x7D, 0xB0, 0x6F, 0xC9, 0xBB, 0xC1, 0x8E,
+    0x21, 0x9D, 0x2C, 0x83, 0x8C, 0x79, 0x7E, 0xF0, 0xAE, 0x04, 0xF0, 0xF7, 0x5B, 0xC2, 0x2D, 0xB5,
+    0x41, 0x32, 0x4D, 0x95, 0xFC, 0x56, 0x3C, 0xCA, 0x19, 0x4A, 0xFE, 0x5E, 0xD1, 0x08, 0x96, 0x78,
+    0x24, 0x33, 0x7A, 0xCE, 0x67, 0x4C, 0x7F, 0x48, 0x72, 0xFA, 0x83, 0x57, 0x8C, 0xB4, 0x1A, 0x88,
+    0x5D, 0xE5, 0xB3, 0x2D, 0x5E, 0xD2, 0xDA, 0xFA, 0xDB, 0x7D, 0x98, 0x5A, 0x78, 0x20, 0x4C, 0x2D,
+    0xAC, 0x59, 0x95, 0xDF, 0x58, 0x95, 0x83, 0xB9, 0xF7, 0xE0, 0x8A, 0x5B, 0xCA, 0xF9, 0x02, 0x4B,
+    0x0D, 0x14, 0xDC, 0x05, 0xFF, 0xF7, 0xFE, 0x07, 0xD7, 0x7B, 0x17, 0x4E, 0x78, 0x03, 0xE8, 0x96,
+    0xEA, 0x10, 0xFE, 0x9E, 0x47, 0xE1, 0x52, 0x3B, 0xE0, 0x9A, 0x92, 0x62, 0x9F, 0xA4, 0x20, 0x90,
+    0xDC, 0x84, 0x09, 0x0E, 0xAD, 0x2E, 0xAC, 0x61, 0x35, 0x34, 0x08, 0x77, 0xB9, 0xFD, 0xB8, 0xFD,
+    0x75, 0x73, 0x29, 0x89, 0x0A, 0x2B, 0x21, 0xEA, 0xED, 0x71, 0x90, 0x87, 0x89, 0xB9, 0x80, 0x27,
+    0x58, 0xE0, 0x43, 0x4B, 0x48, 0x63, 0x8F, 0x9C, 0xF0, 0x20, 0x93, 0x1E, 0xE4, 0x48, 0x08, 0xA4,
+    0xE9, 0x8E, 0x33, 0x65, 0xA9, 0xC7, 0x29, 0x8B, 0x38, 0xBE, 0xF2, 0x43, 0xB5, 0xC9, 0x4F, 0x7E,
+    0xAD, 0x9E, 0x19, 0x81, 0xCF, 0x08, 0x79, 0x5A, 0xF0, 0xB9, 0x0F, 0x27, 0x43, 0x3A, 0x16, 0x5F,
+    0xA0, 0x57, 0xF9, 0xFE, 0xCB, 0xD9, 0x51, 0x35, 0xA1, 0x61, 0xFE, 0x88, 0xAA, 0x3D, 0x2F, 0xD4,
+    0x28, 0x33, 0xA2, 0x91, 0x64, 0xE1, 0x18, 0x51, 0x1B, 0x4E, 0xB2, 0xF9, 0x00, 0x96, 0xF2, 0xA5,
+    0x53, 0x4B, 0x50, 0x63, 0x61, 0xC0, 0x1E, 0x41, 0xEB, 0x8E, 0x29, 0xF5, 0xDD, 0x96, 0x7B, 0x20,
+    0x3B, 0x6C, 0x4E, 0xA5, 0xAC, 0x09, 0x51, 0x85, 0xA3, 0x33, 0x52, 0xC1, 0xAF, 0xFD, 0xF0, 0x99,
+    0xEA, 0x24, 0xBE, 0xDE, 0x82, 0x30, 0xC5, 0xF4, 0xAA, 0x9A, 0x5C, 0x59, 0x93, 0xAB, 0xAA, 0xC7,
+    0xE5, 0x6E, 0x11, 0x27, 0x44, 0xCD, 0xFC, 0x71, 0x9C, 0x42, 0xA6, 0x0A, 0xB6, 0x89, 0xE0, 0x6A,
+    0x90, 0xF4, 0x89, 0x47, 0x93, 0x74, 0x77, 0x17, 0xF8, 0xA0, 0xF2, 0x6F, 0x56, 0x01, 0x5E, 0xF1,
+    0xE0, 0x71, 0x5D, 0xE0, 0x16, 0x95, 0xFA, 0x08, 0xBF, 0x06, 0x44, 0x31, 0x41, 0x08, 0x9A, 0x8E,
+    0xCB, 0x52, 0x3D, 0xF9, 0xD5, 0x52, 0xED, 0x32, 0xC9, 0x4F, 0x21, 0x2B, 0x33, 0x74, 0x4C, 0x66,
+    0x57, 0xA9, 0x1F, 0xEF, 0x32, 0xC9, 0xE3, 0x3D, 0x9B, 0x52, 0x8D, 0x4A, 0x01, 0x42, 0xF7, 0xC7,
+    0x6B, 0x8C, 0x19, 0x6E, 0x82, 0xF0, 0x55, 0xAA, 0xF5, 0x9C, 0xD9, 0x3B, 0x90, 0xC3, 0xAD, 0x15,
+    0x12, 0xED, 0x23, 0x1A, 0x7C, 0x5B, 0x1D, 0x4D, 0x42, 0x78, 0xC8, 0x72, 0x10, 0xC3, 0xEB, 0x96,
+    0x7D, 0xE6, 0x84, 0x9B, 0x6E, 0x8E, 0x4C, 0x78, 0xC3, 0x29, 0x40, 0x82, 0xAF, 0x58, 0x43, 0x30,
+    0x72, 0xC4, 0x10, 0xE8, 0x5C, 0x18, 0x4D, 0xC1, 0x80, 0x0F, 0x7E, 0x0F, 0x58, 0x80, 0x9E, 0x96,
+    0x48, 0xBD, 0x74, 0x9B, 0xA9, 0x54, 0x54, 0xB5, 0x0E, 0x3C, 0x2A, 0x48, 0xB7, 0x16, 0xF2, 0xE9,
+    0x43, 0x9B, 0xBD, 0x9B, 0xAF, 0x2E, 0x6E, 0x43, 0x1B, 0xB0, 0x14, 0xAB, 0xFE, 0x7C, 0x88, 0x30,
+    0xC1, 0xA9, 0xA8, 0x39, 0x19, 0x95, 0x2D, 0xE5, 0x42, 0xEA, 0x27, 0x53, 0x22, 0x93, 0x22, 0x2B,
+    0x53, 0xD6, 0xA6, 0x14, 0x0E, 0x3D, 0x22, 0xCB, 0x88, 0xED, 0xCD, 0x5F, 0x29, 0xB5, 0x2A, 0x48,
+    0x2C, 0x86, 0xB6, 0xF2, 0x31, 0x12, 0x2F, 0xCE, 0x5A, 0x35, 0x41, 0x03, 0x31, 0xDC, 0x0A, 0x3F,
+    0x32, 0x9A, 0xA8, 0xC1, 0x64, 0xCD, 0x44, 0x32, 0x2E, 0x47, 0x42, 0x8B, 0x6C, 0x6D, 0xB5, 0xE1,
+    0xF3, 0x1B, 0xB2, 0x8B, 0x13, 0x5F, 0x83, 0x18, 0xFF, 0xCA, 0x19, 0x7A, 0xFB, 0x3D, 0xAA, 0x19,
+    0x5B, 0xC4, 0xCE, 0x46, 0x3B, 0x46, 0x5D, 0xDB, 0x46, 0x42, 0xF3, 0xE3, 0x35, 0xE3, 0x4D, 0x65,
+    0xBD, 0xA7, 0x4F, 0x37, 0x88, 0x2B, 0xC9, 0xAF, 0x35, 0x40, 0x33, 0xC9, 0x24, 0x12, 0xC6, 0x6D,
+    0x3C, 0x64, 0x34, 0x6C, 0x24, 0x1E, 0xD6, 0x64, 0x51, 0x66, 0xD5, 0x52, 0x80, 0x96, 0x04, 0x08,
+    0x0D, 0x28, 0xD9, 0x3A, 0x85, 0x25, 0xB5, 0x72, 0x43, 0x87, 0xDF, 0x88, 0x19, 0x5D, 0xA1, 0x7C,
+    0xAE, 0x0C, 0x2E, 0x11, 0x80, 0xD4, 0x57, 0xA9, 0xEF, 0x89, 0xAF, 0x91, 0x70, 0xD1, 0x98, 0xB4,
+    0x25, 0x4D, 0x49, 0x4B, 0xD2, 0x90, 0xB4, 0xA3, 0x3D, 0x44, 0xF6, 0x59, 0x74, 0xD9, 0xA7, 0xEC,
+    0x37, 0x76, 0x3B, 0x8E, 0xDD, 0x73, 0x8A, 0xC3, 0x18, 0x93, 0x1C, 0xA6, 0xD5, 0x92, 0xFC, 0x43,
+    0x0F, 0x47, 0xD4, 0x09, 0xE3, 0x79, 0x77, 0x34, 0x81, 0x0F, 0x59, 0x28, 0x80, 0x27, 0x63, 0x3D,
+    0xA2, 0x9D, 0x24, 0xB2, 0xF3, 0xC2, 0xA7, 0x91, 0x02, 0x46, 0x10, 0xEE, 0x94, 0xB2, 0xF1, 0x33,
+    0x66, 0x15, 0x29, 0x1B, 0x6E, 0x58, 0xC8, 0x8D, 0x75, 0x4B, 0x35, 0xED, 0x7A, 0x3D, 0xEB, 0x2A,
+    0xF8, 0xC6, 0x38, 0x43, 0xC3, 0xF0, 0x9D, 0x87, 0x2C, 0x5E, 0x84, 0x00, 0x0D, 0x66, 0x20, 0x88,
+    0xDD, 0x9C, 0x22, 0x7B, 0x19, 0x99, 0x68, 0x12, 0xFA, 0x98, 0x42, 0x3F, 0x15, 0x1E, 0xD1, 0x6E,
+    0x98, 0xAA, 0x04, 0x7D, 0x06, 0x9F, 0x95, 0xF7, 0x17, 0x0F, 0x73, 0x56, 0x0B, 0xEF, 0xB2, 0xEE,
+    0x1A, 0xD1, 0x52, 0x4B, 0xDB, 0xF3, 0x53, 0x64, 0x72, 0xB7, 0x7A, 0x31, 0x9F, 0x95, 0x42, 0xEE,
+    0xDF, 0xE1, 0x32, 0x3E, 0x42, 0xB4, 0xDA, 0xA2, 0x1B, 0xE4, 0x9B, 0xF3, 0x53, 0xC8, 0xFE, 0x0F,
+    0x3A, 0xBC, 0x99, 0xAB, 0xE3, 0xF0, 0xC5, 0x8D, 0x63, 0xB3, 0x52, 0x88, 0x25, 0x21, 0x06, 0x4E,
+    0xC8, 0x7E, 0x27, 0x09, 0x45, 0x08, 0x37, 0x84, 0xFC, 0x51, 0xEC, 0x32, 0x48, 0x44, 0xE1, 0x81,
+    0xAE, 0x0E, 0xD2, 0x95, 0x75, 0xBA, 0xBA, 0x0E, 0x65, 0xE5, 0xCE, 0x52, 0x94, 0x9A, 0xCD, 0x1A,
+    0x52, 0x34, 0xC9, 0xAA, 0x70, 0xD3, 0xE4, 0x9F, 0x20, 0x45, 0x44, 0xFC, 0x3E, 0x51, 0xA2, 0x94,
+    0xAD, 0x7A, 0xF4, 0x23, 0x9A, 0xED, 0xBC, 0x55, 0xB0, 0x0A, 0x26, 0xDB, 0x6A, 0x46, 0x5F, 0xA6,
+    0x36, 0xFE, 0x4C, 0x4D, 0x7C, 0x1D, 0x43, 0x97, 0x9A, 0xBB, 0x51, 0x5E, 0xE9, 0x66, 0xD0, 0xA7,
+    0xF0, 0x60, 0x20, 0x2F, 0x0F, 0x62, 0xE8, 0x74, 0xAB, 0xC1, 0xD0, 0x3E, 0x2C, 0x0D, 0xBD, 0xFE,
+    0xC1, 0x05, 0xC3, 0xDD, 0x4A, 0xE8, 0x96, 0x1A, 0xD0, 0x4E, 0xC3, 0xD7, 0x82, 0xCF, 0xEE, 0x35,
+    0x35, 0x34, 0x3C, 0xA7, 0x4B, 0x35, 0xFD, 0x90, 0x64, 0x44, 0x52, 0x98, 0xA9, 0xCD, 0xF9, 0x7E,
+    0x1B, 0x8E, 0xD3, 0xE2, 0x77, 0x48, 0x27, 0x82, 0xFA, 0x99, 0x24, 0x60, 0x82, 0x74, 0x4C, 0xFD,
+    0xCE, 0xE9, 0x2E, 0x3D, 0x48, 0x98, 0xE5, 0x69, 0xC9, 0x18, 0x91, 0x1B, 0x20, 0x35, 0xA8, 0x88,
+    0x5C, 0x8D, 0xE2, 0x36, 0x1C, 0x28, 0xC3, 0x20, 0xC9, 0x22, 0x9D, 0xF7, 0x09, 0x31, 0x97, 0xF7,
+    0xF5, 0xB6, 0xB0, 0xD0, 0x0D, 0xB9, 0xB0, 0x7A, 0x38, 0xF4, 0xAA, 0x24, 0xB7, 0xEA, 0x7F, 0x02,
+    0xD1, 0xAC, 0xDC, 0x6A, 0xAC, 0xD8, 0xEE, 0x32, 0x72, 0x76, 0xBA, 0x5B, 0xA2, 0xB3, 0xDF, 0x92,
+    0x1A, 0xAB, 0x3D, 0x66, 0x4B, 0xC1, 0xD1, 0x09, 0xBB, 0xD4, 0xC5, 0x58, 0x5B, 0xDC, 0xB6, 0xB5,
+    0x3F, 0x54, 0xFA, 0x97, 0xC8, 0x7C, 0x52, 0xFC, 0x8D, 0x73, 0xE3, 0xBE, 0x1C, 0xDD, 0xEA, 0x13,
+    0xB5, 0x72, 0x4C, 0x29, 0xFB, 0x28, 0x49, 0xF4, 0xF4, 0x3B, 0xC2, 0xFC, 0xFC, 0x44, 0x65, 0x93,
+    0xC5, 0xCC, 0xAD, 0x77, 0x1E, 0xB2, 0x41, 0xB2, 0x9F, 0x5A, 0x5E, 0xE5, 0xA6, 0x35, 0xD2, 0x1B,
+    0x6F, 0xD8, 0x71, 0x9F, 0x3D, 0xCC, 0xC7, 0xE8, 0x9C, 0x02, 0x89, 0x34, 0xB5, 0x39, 0xD1, 0x05,
+    0x5B, 0xBD, 0xAD, 0x92, 0x3F, 0x96, 0x06, 0x22, 0x98, 0x55, 0x9A, 0x43, 0xAB, 0x34, 0x72, 0xB1,
+    0x91, 0x66, 0xAE, 0x90, 0xB7, 0x80, 0xEE, 0x4B, 0x06, 0xCC, 0x6D, 0xE3, 0xEC, 0x59, 0xF4, 0x7A,
+    0x56, 0xB9, 0x59, 0x02, 0x4B, 0x45, 0xA1, 0x1F, 0x07, 0x9F, 0x24, 0xE8, 0x62, 0xD2, 0x7B, 0x39,
+    0x6A, 0xD4, 0x1E, 0x61, 0xB1, 0x3A, 0x33, 0x1D, 0xBE, 0xA8, 0x78, 0xCA, 0xC5, 0xC9, 0x23, 0xD9,
+    0x68, 0x77, 0xF3, 0xA7, 0x19, 0xFB, 0xD0, 0x65, 0xD6, 0xE1, 0x50, 0xA5, 0xBE, 0x85, 0x60, 0xBA,
+    0x85, 0x14, 0xF1, 0x3A, 0xDE, 0xD1, 0xEF, 0x90, 0xFD, 0x4D, 0xAD, 0xFA, 0x24, 0x96, 0x9A, 0x2E,
+    0x2B, 0xBA, 0x7D, 0x3D, 0x77, 0xD6, 0x72, 0xD3, 0x88, 0x84, 0xDE, 0x33, 0x3E, 0x82, 0xAB, 0x33,
+    0x1B, 0xB9, 0x67, 0x25, 0x23, 0xC1, 0x93, 0x27, 0x13, 0x78, 0xDA, 0x00, 0x0C, 0xD1, 0xBC, 0x1C,
+    0x83, 0xF7, 0xEC, 0x41, 0xBE, 0x2B, 0x1D, 0xB6, 0x04, 0x2D, 0x39, 0x38, 0xC0, 0xD3, 0x17, 0x7D,
+    0x11, 0xDD, 0x0D, 0x81, 0x79, 0x1F, 0x66, 0x72, 0x58, 0xC8, 0x68, 0xF6, 0xC7, 0x47, 0x96, 0x1F,
+    0xB2, 0xF1, 0xB7, 0x07, 0x5B, 0xBB, 0x80, 0xE6, 0xCC, 0xFB, 0x4C, 0x5F, 0x4E, 0x8F, 0x41, 0xC0,
+    0x74, 0x99, 0xCD, 0x09, 0x7B, 0x88, 0x78, 0x2A, 0x39, 0xCC, 0x7D, 0x55, 0x9F, 0x71, 0xDE, 0xE7,
+    0xA7, 0x0F, 0xA6, 0xA9, 0x0C, 0x1C, 0x8B, 0xDC, 0xF0, 0xF0, 0x44, 0xE0, 0x5F, 0xB0, 0xFF, 0xEB,
+    0x23, 0x12, 0xC5, 0x62, 0xCC, 0x81, 0xEB, 0x7D, 0x9D, 0x8A, 0xC1, 0xC0, 0xE5, 0x2F, 0x86, 0x5E,
+    0xC5, 0xE5, 0x76, 0x3D, 0x68, 0x6B, 0x91, 0xBB, 0x14, 0x22, 0x53, 0xBB, 0x51, 0x66, 0x2A, 0xA0,
+    0x55, 0xF1, 0xF5, 0x42, 0xD9, 0x15, 0xE6, 0x3A, 0xAB, 0x8B, 0xD9, 0xDB, 0x43, 0x5A, 0xBD, 0xE1,
+    0xF7, 0x53, 0x35, 0xC9, 0x07, 0x00, 0x2E, 0x4F, 0x80, 0xED, 0x2C, 0x17, 0x72, 0xF8, 0x0C, 0x1A,
+    0x48, 0x65, 0xC9, 0xFB, 0x32, 0x1C, 0x01, 0xA3, 0xB7, 0x5B, 0xAE, 0x1D, 0xB7, 0xDC, 0xCB, 0x1B,
+    0x3E, 0x9E, 0xA4, 0x8B, 0x97, 0x77, 0x62, 0x78, 0x03, 0x3D, 0xE5, 0x51, 0x25, 0xDD, 0xC5, 0xCC,
+    0x4B, 0x77, 0xC3, 0x40, 0xA7, 0x0F, 0x35, 0xF3, 0xF8, 0x51, 0xDB, 0x34, 0xE9, 0xBF, 0xA1, 0xDB,
+    0x69, 0x18, 0x7D, 0xC1, 0xEC, 0x03, 0x9D, 0xCE, 0xF4, 0xD0, 0x6F, 0xC2, 0xF5, 0x1C, 0x93, 0xE5,
+    0x52, 0xC4, 0x83, 0x9C, 0xB0, 0xE7, 0xD8, 0xD7, 0x31, 0x36, 0xCB, 0xEC, 0x6C, 0x99, 0x22, 0x9E,
+    0xA0, 0x60, 0x1B, 0x6C, 0xAE, 0x50, 0xF9, 0x82, 0x22, 0x92, 0x60, 0x80, 0x82, 0x47, 0xA1, 0x70,
+    0x6F, 0x27, 0x56, 0xFE, 0xCE, 0x75, 0xFA, 0xEA, 0x54, 0x14, 0x77, 0xF2, 0x17, 0x95, 0x0F, 0xAE,
+    0xFE, 0x23, 0x58, 0xF4, 0xB5, 0x76, 0x33, 0xEC, 0xD0, 0xAA, 0x31, 0x88, 0x4A, 0xBB, 0x74, 0x8B,
+    0xA9, 0xED, 0x9D, 0x6E, 0x93, 0xA4, 0xA3, 0xD8, 0x71, 0x12, 0x23, 0x5C, 0xC4, 0xD1, 0x7B, 0xAC,
+    0x16, 0x07, 0x95, 0x5F, 0xF8, 0x93, 0x30, 0x35, 0x75, 0x06, 0x74, 0x1E, 0x6A, 0x78, 0x98, 0x2A,
+    0xBF, 0x5D, 0x69, 0x7B, 0x17, 0xDF, 0x8A, 0x4F, 0x74, 0x07, 0x41, 0x0D, 0xA9, 0x60, 0xBE, 0xAE,
+    0xE6, 0xA7, 0x88, 0x6C, 0x9D, 0xFC, 0x2C, 0x96, 0xF3, 0x46, 0xDD, 0xD6, 0xC9, 0xDE, 0x15, 0x12,
+    0x5F, 0x35, 0x3F, 0x80, 0xEB, 0x9A, 0x37, 0xD2, 0xEE, 0x3F, 0xD5, 0xE7, 0x7C, 0xF3, 0xD0, 0x8A,
+    0x71, 0xEB, 0x20, 0x12, 0xC8, 0x27, 0xDD, 0xF6, 0xAF, 0x5D, 0xCD, 0x4A, 0xB3, 0x80, 0x3B, 0xBD,
+    0x3C, 0x67, 0x66, 0x16, 0x24, 0x4C, 0xE7, 0xB2, 0xF9, 0x29, 0x65, 0x54, 0xD7, 0x95, 0xF5, 0x05,
+    0xBA, 0x3F, 0x9F, 0xA9, 0xE7, 0x9C, 0x3D, 0x2F, 0x9D, 0x7D, 0x14, 0xF9, 0x64, 0x7F, 0x64, 0xD7,
+    0x2C, 0x7A, 0x42, 0x2A, 0x67, 0x6B, 0xC4, 0x2F, 0xBE, 0xBE, 0xCC, 0x84, 0x8B, 0xAB, 0x6D, 0x69,
+    0x48, 0xCA, 0x43, 0x84, 0xCB, 0x68, 0x82, 0x59, 0x74, 0x94, 0xAE, 0xC5, 0x01, 0xEB, 0x63, 0x89,
+    0xA1, 0x4E, 0xB8, 0x39, 0xF6, 0x4A, 0x1D, 0x3E, 0xAB, 0xA2, 0x6A, 0xFD, 0x2E, 0x04, 0x5C, 0xBF,
+    0xCD, 0x84, 0x48, 0x39, 0xB1, 0x6C, 0x34, 0xB9, 0xD0, 0xD7, 0xD4, 0xEA, 0xB8, 0x54, 0x28, 0xA0,
+    0x33, 0xB2, 0xFD, 0x04, 0x37, 0x3A, 0xA5, 0x1B, 0xC4, 0xAC, 0xB4, 0x1E, 0x0B, 0xCE, 0xE5, 0x88,
+    0x60, 0xCB, 0xC1, 0xCD, 0x14, 0x7F, 0xDE, 0x0E, 0xDE, 0x8B, 0x59, 0x82, 0xF5, 0xDF, 0x0F, 0x95,
+    0xB5, 0x93, 0x79, 0x1F, 0x11, 0x4D, 0x53, 0xD9, 0xF9, 0xD0, 0xA1, 0xDB, 0x72, 0x00, 0xC6, 0xC2,
+    0x76, 0xCF, 0x98, 0xF5, 0x63, 0x37, 0x1B, 0x4B, 0x69, 0x36, 0x2D, 0x7B, 0x90, 0x68, 0x23, 0x15,
+    0x89, 0x4D, 0xB3, 0xE7, 0xA2, 0x87, 0x06, 0xC0, 0xF8, 0x30, 0x28, 0xAC, 0xA1, 0x8B, 0x7C, 0xCB,
+    0x1A, 0x3A, 0x99, 0x55, 0x3A, 0x43, 0x2B, 0xB5, 0x4A, 0xB7, 0x62, 0x7B, 0xAC, 0xB2, 0x63, 0xAB,
+    0xFC, 0x61, 0xE5, 0x20, 0x03, 0xFA, 0x4B, 0x75, 0x10, 0xED, 0xAD, 0xEA, 0xA8, 0xB2, 0xFE, 0x7B,
+    0xA3, 0xDA, 0x50, 0xD6, 0xBD, 0x97, 0xAB, 0x1C, 0x43, 0x1B, 0x30, 0x8B, 0xF0, 0x66, 0x88, 0x68,
+    0x54, 0xF7, 0x65, 0x50, 0xED, 0x31, 0x6D, 0x0C, 0xEA, 0xBE, 0x81, 0x31, 0x57, 0x8C, 0xBC, 0xB7,
+    0xCC, 0x2B, 0x3A, 0x8F, 0xEE, 0x1A, 0xC9, 0x36, 0x04, 0x5E, 0xA1, 0xF0, 0x9B, 0x0C, 0xD8, 0xDC,
+    0xF0, 0xB6, 0xD8, 0x1B, 0xBC, 0xCD, 0xAC, 0x59, 0x05, 0x68, 0x98, 0x02, 0x68, 0xD6, 0x3C, 0x93,
+    0x7C, 0xEA, 0xC8, 0xE9, 0xF4, 0x8E, 0xD3, 0x33, 0x3C, 0x92, 0x14, 0xE8, 0x62, 0xF7, 0x81, 0xB3,
+    0x91, 0xC2, 0x17, 0x91, 0x3D, 0x48, 0x71, 0xBD, 0xAD, 0xB3, 0x57, 0xB4, 0xD7, 0x55, 0x16, 0x51,
+    0x0A, 0x16, 0xB9, 0x48, 0xA4, 0x68, 0x9E, 0x84, 0x07, 0x88, 0xA3, 0x53, 0x9C, 0xE5, 0x3F, 0xF4,
+    0x27, 0xFE, 0xFC, 0xD1, 0x79, 0x39, 0x77, 0x74, 0x3A, 0xEC, 0x5A, 0x77, 0xAC, 0xED, 0x07, 0x3C,
+    0xF3, 0x10, 0x8C, 0xB7, 0xD4, 0x9D, 0x94, 0x79, 0xC0, 0x0D, 0x1E, 0x74, 0xBD, 0x31, 0x64, 0xF4,
+    0x1C, 0xCC, 0x4B, 0x73, 0xF1, 0xCA, 0x07, 0x4F, 0x94, 0xFB, 0x1A, 0x4B, 0x25, 0xB8, 0x93, 0x94,
+    0x70, 0xB7, 0x20, 0xC3, 0xEA, 0x82, 0x71, 0xAE, 0x90, 0x3C, 0x0E, 0x9C, 0xAA, 0x3F, 0x0B, 0xD8,
+    0xEE, 0x82, 0xE1, 0x0E, 0xA9, 0x42, 0xCB, 0xF7, 0xFE, 0xF8, 0xFB, 0xD0, 0x0E, 0xF1, 0xBD, 0x4B,
+    0xC2, 0xE8, 0x61, 0xF5, 0x5D, 0x6A, 0x30, 0xAE, 0xAE, 0x27, 0x46, 0x4D, 0xBA, 0x84, 0xA3, 0x1D,
+    0xD2, 0x58, 0x5B, 0x0B, 0x49, 0x31, 0xDC, 0x0B, 0x3A, 0x3E, 0x08, 0x2E, 0xF5, 0x1D, 0xAB, 0x3B,
+    0xF5, 0x4B, 0xC6, 0x01, 0x6B, 0x91, 0x5E, 0x59, 0x95, 0x19, 0xBA, 0x85, 0x1D, 0x22, 0x51, 0x53,
+    0xC9, 0x9D, 0x04, 0x99, 0x5C, 0x33, 0x55, 0xF9, 0x96, 0x33, 0x0A, 0x42, 0x4E, 0xFB, 0xE3, 0x82,
+    0xFB, 0xAC, 0x07, 0x13, 0x7D, 0xA7, 0xCB, 0x4C, 0xBB, 0xCD, 0xE8, 0x3D, 0xEA, 0xB1, 0xDB, 0xE9,
+    0xE4, 0xFD, 0xD5, 0xE3, 0x21, 0xA7, 0xFA, 0xF6, 0x3A, 0x1F, 0xA4, 0x0A, 0xDE, 0x87, 0xB8, 0x3E,
+    0x38, 0xCF, 0xB3, 0x42, 0xAF, 0xC4, 0x93, 0xE7, 0x0C, 0xC7, 0x3B, 0xBE, 0xD5, 0xD4, 0x8E, 0xAF,
+    0xEC, 0x18, 0xB4, 0xDC, 0x73, 0xFA, 0x4C, 0xD8, 0x43, 0x59, 0xF2, 0x68, 0x6B, 0x9A, 0x3D, 0xBD,
+    0x50, 0xF6, 0x1E, 0xFF, 0x7F, 0xD5, 0x5A, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0x23, 0xB1,
+    0x31, 0x11, 0x33, 0x43, 0xD2, 0xA0, 0x56, 0x2D, 0x76, 0x28, 0x0A, 0xA3, 0xB0, 0xCC, 0x25, 0x83,
+    0x07, 0xC9, 0x64, 0x5B, 0x34, 0x19, 0x32, 0xC4, 0x83, 0x84, 0x0C, 0x1D, 0xB2, 0x77, 0x51, 0x07,
+    0x0F, 0x2E, 0xA0, 0x98, 0x4C, 0x3B, 0x64, 0x08, 0xD0, 0x78, 0xA8, 0xD1, 0x21, 0x43, 0x3D, 0x64,
+    0x68, 0xB4, 0xD8, 0x28, 0x32, 0x78, 0x70, 0x4C, 0xDA, 0x01, 0x9A, 0xC1, 0x43, 0xD9, 0x04, 0x41,
+    0x87, 0x00, 0x05, 0x03, 0x27, 0x1D, 0x9C, 0x21, 0x74, 0x40, 0x23, 0x2F, 0x0E, 0x1F, 0x6F, 0xBF,
+    0xEF, 0x5C, 0x52, 0xEF, 0xC9, 0x76, 0x96, 0x58, 0x96, 0xD3, 0x67, 0xBF, 0x4B, 0xEA, 0xBD, 0x47,
+    0xDE, 0xF3, 0x77, 0xCF, 0xF9, 0xCE, 0x77, 0x29, 0x32, 0xBE, 0xBC, 0x46, 0x1C, 0xD3, 0x7A, 0xAD,
+    0x44, 0x37, 0x0D, 0xCE, 0x0B, 0x49, 0xAE, 0xD6, 0x4E, 0x27, 0xD1, 0x87, 0xA5, 0x37, 0x91, 0xB0,
+    0x97, 0xB0, 0xE1, 0xFF, 0xA8, 0xE6, 0x18, 0x57, 0x1C, 0x93, 0x92, 0x63, 0x56, 0x4A, 0xA4, 0x23,
+    0x3E, 0xCC, 0x72, 0x7E, 0xC8, 0x51, 0x4F, 0x0A, 0xC1, 0xE8, 0x4C, 0x05, 0x57, 0xF9, 0xAD, 0x88,
+    0x3F, 0xDD, 0xAC, 0x30, 0x51, 0x31, 0xE5, 0x74, 0xCE, 0x30, 0xED, 0x62, 0x8A, 0x21, 0x2A, 0x65,
+    0xF1, 0x3C, 0x06, 0xD3, 0x87, 0xA5, 0xDF, 0x26, 0xAF, 0x4B, 0x58, 0xC7, 0x53, 0x5C, 0x8B, 0xD9,
+    0xB2, 0x3C, 0xAA, 0xA4, 0x48, 0x71, 0x73, 0x23, 0x31, 0x7E, 0xC1, 0xFB, 0x1A, 0x4E, 0x61, 0x78,
+    0xFB, 0x82, 0x77, 0x4F, 0x3E, 0xC7, 0xCD, 0x03, 0x93, 0xCB, 0xDD, 0xAF, 0xB0, 0x4C, 0x4C, 0x65,
+    0x5E, 0xAC, 0xE2, 0x3E, 0xDD, 0x0C, 0x4A, 0x1F, 0x6A, 0xF8, 0xB8, 0xBD, 0x1C, 0x0C, 0x25, 0x80,
+    0x26, 0x97, 0x28, 0xFD, 0xB1, 0x94, 0xE3, 0x2A, 0x45, 0xE4, 0x88, 0x69, 0x8E, 0x53, 0x68, 0x39,
+    0xA5, 0xE3, 0x45, 0xA1, 0x26, 0x8D, 0x70, 0x3E, 0x8C, 0x45, 0xEA, 0xD4, 0x38, 0x4F, 0xBD, 0x92,
+    0xDF, 0x06, 0x98, 0x30, 0xBE, 0x73, 0x05, 0xF3, 0xF8, 0xA6, 0xDD, 0x35, 0xEF, 0x11, 0x0E, 0x57,
+    0x9E, 0x5E, 0x77, 0x4E, 0x5E, 0xC9, 0x5A, 0xBF, 0x5D, 0x0B, 0x9B, 0xA0, 0x59, 0x0D, 0x9B, 0xF0,
+    0x56, 0x83, 0xA1, 0x4F, 0xA3, 0x1A, 0x93, 0x45, 0x15, 0xE6, 0x8A, 0x4B, 0x4C, 0x92, 0xE8, 0x90,
+    0x17, 0xB9, 0x64, 0xAF, 0x42, 0x89, 0xEC, 0x7D, 0xDA, 0xAF, 0x4B, 0x3A, 0x89, 0x9B, 0xB8, 0x95,
+    0xFB, 0xBF, 0x9A, 0x68, 0x3C, 0xBB, 0x7C, 0x79, 0x3C, 0x4B, 0x9A, 0xF1, 0x2C, 0xAA, 0xE6, 0x7F,
+    0x6B, 0xCC, 0xD7, 0x10, 0xDA, 0x98, 0x5A, 0x36, 0xEF, 0x18, 0x98, 0x71, 0xDB, 0xD0, 0x7B, 0x51,
+    0x2B, 0xAD, 0x60, 0xBA, 0xB0, 0xF6, 0x3A, 0xA7, 0xF6, 0x0C, 0x2D, 0xE0, 0x4D, 0xDD, 0x2A, 0xE8,
+    0x68, 0x05, 0xB7, 0x97, 0x14, 0xBF, 0xA0, 0xFB, 0x7A, 0x5C, 0x5C, 0x8D, 0x67, 0x34, 0x72, 0x96,
+    0xE3, 0x5B, 0x5E, 0x00, 0x4B, 0xE0, 0x8C, 0x17, 0xC0, 0x32, 0xDE, 0x14, 0xF2, 0x72, 0x36, 0xF1,
+    0x3A, 0xBD, 0x00, 0x67, 0x01, 0x66, 0x80, 0x7B, 0x71, 0x61, 0xD4, 0x78, 0xBD, 0x2C, 0x8B, 0x4B,
+    0xA7, 0x86, 0x9D, 0xAC, 0xE0, 0x47, 0x8E, 0x49, 0x71, 0xC1, 0x96, 0x2C, 0xF5, 0x17, 0x26, 0x92,
+    0xDD, 0xDC, 0xEE, 0x28, 0x23, 0xDC, 0x6A, 0xCC, 0xE4, 0x6E, 0x6D, 0xB7, 0xFC, 0xD2, 0x6A, 0x11,
+    0xC7, 0x62, 0x95, 0xC0, 0x3D, 0xAC, 0x0E, 0x70, 0xA4, 0xAA, 0x60, 0xF5, 0x86, 0x06, 0xCE, 0xC6,
+    0x46, 0xAA, 0x0A, 0xF8, 0x06, 0xBF, 0xA3, 0xD4, 0xC1, 0xB9, 0xA2, 0xD4, 0x93, 0x10, 0x22, 0xA9,
+    0xF4, 0x8F, 0xF3, 0xF7, 0x56, 0xF8, 0x76, 0x94, 0xBD, 0x1E, 0x45, 0xCF, 0x47, 0xC9, 0x47, 0xC1,
+    0x3B, 0x27, 0x55, 0xB9, 0x83, 0xD6, 0xCB, 0xAD, 0xD8, 0x75, 0x90, 0x0E, 0x52, 0x17, 0x56, 0xE8,
+    0xC2, 0x98, 0x39, 0x71, 0xE1, 0xBA, 0x36, 0xC4, 0x6D, 0x96, 0x3A, 0x59, 0x3B, 0xC3, 0x95, 0x35,
+    0x91, 0x98, 0x3A, 0x21, 0xF4, 0x42, 0x4C, 0xA3, 0x93, 0xE2, 0x75, 0xE8, 0xCD, 0x66, 0x81, 0xC2,
+    0x1A, 0xD3, 0x84, 0xC6, 0x60, 0x95, 0x21, 0x2E, 0x36, 0x0C, 0x7E, 0x12, 0x55, 0x2B, 0x98, 0x30,
+    0x2E, 0xE3, 0xF2, 0x48, 0x30, 0x41, 0x64, 0x24, 0x76, 0x85, 0xA5, 0x1A, 0x2B, 0x88, 0x7A, 0x0D,
+    0x7E, 0xC6, 0x3F, 0xE5, 0xC2, 0x11, 0xE2, 0x4E, 0x5C, 0x31, 0xAE, 0x81, 0x01, 0x02, 0x31, 0x3E,
+    0x96, 0x6E, 0xB9, 0x2C, 0xD9, 0xB4, 0x98, 0x98, 0x9B, 0xEF, 0x4A, 0xDC, 0x26, 0x9F, 0x18, 0xD3,
+    0xCD, 0xC7, 0x03, 0x82, 0xCC, 0x94, 0xB2, 0xD9, 0xA7, 0xFA, 0x46, 0xFC, 0xAB, 0x48, 0x94, 0x8D,
+    0xE7, 0xD1, 0x70, 0x44, 0x7C, 0xEA, 0x39, 0xE6, 0xD4, 0x73, 0x3D, 0x96, 0xBA, 0x16, 0xF4, 0x3C,
+    0x4B, 0xED, 0xB1, 0x48, 0x65, 0xB0, 0x9A, 0x3D, 0x37, 0xE2, 0x0E, 0xC6, 0x0B, 0x78, 0x84, 0x8C,
+    0x6A, 0x78, 0xD8, 0xF6, 0x18, 0x43, 0x68, 0xA9, 0xDF, 0x9E, 0x52, 0x6E, 0x18, 0xAE, 0x1B, 0xFC,
+    0x26, 0xE3, 0xD1, 0x1F, 0x5C, 0x1F, 0x34, 0xBB, 0x02, 0xF9, 0x71, 0xDE, 0x96, 0x7F, 0x7E, 0x7A,
+    0x57, 0x60, 0xE0, 0x7B, 0x6A, 0x03, 0xE7, 0x51, 0x91, 0x58, 0xF3, 0x11, 0x33, 0x8B, 0x9A, 0x59,
+    0xA5, 0x77, 0x34, 0x1A, 0x10, 0xAE, 0xB9, 0x95, 0x35, 0x1F, 0x45, 0xA6, 0xC4, 0x85, 0x55, 0xC2,
+    0x58, 0xB9, 0x7B, 0x3D, 0x73, 0xD4, 0xA4, 0xAE, 0xDB, 0xA9, 0x02, 0x10, 0x8C, 0xF2, 0xE3, 0x40,
+    0xF1, 0xE1, 0x48, 0x4A, 0x0F, 0x3F, 0x52, 0xF8, 0x41, 0xC8, 0x70, 0x38, 0xD4, 0xF3, 0x12, 0x73,
+    0x12, 0x91, 0x05, 0x1B, 0x15, 0xE1, 0x18, 0xD0, 0xC8, 0x69, 0x46, 0x9E, 0xE9, 0x6C, 0xA0, 0xF5,
+    0x8C, 0x8B, 0x27, 0x19, 0x14, 0xD4, 0x77, 0x61, 0x1D, 0x37, 0x8A, 0x3B, 0x0C, 0xF8, 0x4A, 0x03,
+    0x3A, 0xAA, 0x18, 0x37, 0xCC, 0x57, 0x08, 0x3D, 0x24, 0xDB, 0x9C, 0xB9, 0x36, 0xC7, 0x34, 0x19,
+    0x12, 0x08, 0x44, 0x67, 0x5A, 0xA4, 0xCA, 0x45, 0xC7, 0xB8, 0xA8, 0x93, 0x5C, 0xAC, 0x36, 0xD4,
+    0xCA, 0x3A, 0x83, 0xAA, 0xC8, 0x12, 0x27, 0xCF, 0xCE, 0xF2, 0x23, 0x24, 0xF5, 0x89, 0xC1, 0x82,
+    0xDC, 0x6C, 0x65, 0xB3, 0x2E, 0xB0, 0x9C, 0xB0, 0x8A, 0x42, 0xEB, 0xEE, 0xA9, 0x1C, 0x54, 0x1F,
+    0x2F, 0x1B, 0xAC, 0x52, 0x3A, 0xF9, 0x68, 0x91, 0xAE, 0xA8, 0x16, 0xAB, 0x49, 0xBE, 0x6A, 0x4F,
+    0xE2, 0x72, 0x55, 0xAD, 0x76, 0x3A, 0xAC, 0x8F, 0xAB, 0xC1, 0x4E, 0x05, 0xCD, 0x29, 0x9D, 0xE8,
+    0xA2, 0x37, 0xB9, 0xA8, 0x27, 0x10, 0xBE, 0xA1, 0x1D, 0xA5, 0x71, 0xFA, 0x86, 0xCE, 0x46, 0xBE,
+    0x34, 0x35, 0xBD, 0xED, 0xA2, 0x38, 0x54, 0x74, 0xB3, 0xC7, 0x20, 0xE6, 0xC9, 0xD2, 0xA7, 0x48,
+    0xFB, 0x74, 0x78, 0x06, 0x29, 0x4A, 0x7F, 0xCC, 0x74, 0xA3, 0xEB, 0x47, 0xBB, 0xCE, 0x65, 0xB3,
+    0x64, 0xC8, 0xF0, 0x3F, 0xEB, 0xC7, 0x0F, 0xEA, 0x7B, 0x12, 0x23, 0x7E, 0xA3, 0x7A, 0xA2, 0x1E,
+    0xA9, 0x9A, 0x49, 0x6A, 0xB5, 0x7C, 0x6C, 0x50, 0x52, 0xAC, 0x8E, 0x0B, 0x1B, 0x56, 0xC5, 0xC0,
+    0x0C, 0x1A, 0x9A, 0x41, 0xC1, 0xDE, 0xEA, 0x47, 0xD3, 0x51, 0x3D, 0x84, 0x81, 0x6A, 0x47, 0x81,
+    0xA9, 0x9C, 0x1E, 0xA1, 0x1B, 0x5C, 0xA3, 0xAA, 0x41, 0x6C, 0xD5, 0x0C, 0x52, 0xAB, 0x62, 0x10,
+    0x5A, 0xF5, 0xA2, 0x9B, 0xA8, 0x56, 0x54, 0xEF, 0xD6, 0x21, 0x2E, 0x77, 0xAB, 0x52, 0xD8, 0xC3,
+    0x0F, 0xA7, 0xC3, 0xD7, 0xF5, 0x3D, 0xDA, 0xF0, 0x95, 0x95, 0xF3, 0x7F, 0x3D, 0x36, 0x7E, 0xBB,
+    0xB0, 0xBE, 0x78, 0xD6, 0xD9, 0x90, 0xA8, 0xCB, 0x5A, 0xE8, 0xE1, 0x4D, 0xBF, 0x98, 0x30, 0xB2,
+    0x8C, 0xA7, 0x01, 0x36, 0xF5, 0x26, 0x70, 0x80, 0xDF, 0xF9, 0x2D, 0x74, 0xF1, 0xDB, 0xA0, 0x85,
+    0x2A, 0x41, 0x63, 0xC3, 0x8B, 0x07, 0x14, 0xC3, 0x3A, 0xA4, 0xFC, 0x51, 0x15, 0x55, 0x58, 0xFE,
+    0x31, 0x64, 0xD5, 0x9A, 0x1E, 0x19, 0x3D, 0x04, 0xD3, 0xDD, 0x11, 0x3D, 0x48, 0x6E, 0x03, 0xDB,
+    0x06, 0xDA, 0x28, 0xF6, 0xDC, 0xB2, 0xF4, 0x73, 0x94, 0x23, 0xEF, 0x06, 0x57, 0xA1, 0x29, 0x67,
+    0xFA, 0x89, 0xAE, 0x2E, 0x71, 0x19, 0x23, 0x5A, 0x39, 0x02, 0x7E, 0xB1, 0xCC, 0xBB, 0xAC, 0x72,
+    0x38, 0x45, 0xD5, 0x1A, 0x0C, 0x6E, 0x85, 0x09, 0x3C, 0x16, 0xC4, 0xE0, 0x1C, 0x81, 0x05, 0x73,
+    0xF8, 0x1A, 0x23, 0xF3, 0x34, 0xE3, 0x14, 0x08, 0xA4, 0x76, 0x09, 0x40, 0x96, 0xE0, 0xDA, 0xAF,
+    0x93, 0xA9, 0x6B, 0x6C, 0x24, 0xAC, 0x7A, 0x95, 0x44, 0x51, 0x4A, 0x0F, 0xCB, 0x18, 0x48, 0x07,
+    0xCE, 0x9E, 0x44, 0x5A, 0x6E, 0x98, 0x55, 0x99, 0x51, 0x99, 0x4D, 0x99, 0x49, 0x99, 0x45, 0x99,
+    0x41, 0x99, 0x3D, 0x99, 0x39, 0x99, 0x35, 0x99, 0x31, 0xB3, 0xAE, 0x98, 0x20, 0x53, 0xCE, 0xEC,
+    0xBF, 0xE6, 0xA1, 0x46, 0xBF, 0x9C, 0x4B, 0xD0, 0x6B, 0x02, 0xDF, 0xC9, 0x9C, 0x63, 0xC6, 0xA4,
+    0x75, 0xE8, 0xDD, 0x31, 0x33, 0xEA, 0x3B, 0xB7, 0x96, 0xB1, 0x59, 0x50, 0x86, 0x2C, 0xC8, 0x0C,
+    0xA2, 0x19, 0x6E, 0x09, 0x97, 0x66, 0x6A, 0x16, 0x59, 0xF5, 0x4B, 0xD4, 0x32, 0x44, 0xA6, 0xAD,
+    0x05, 0x4F, 0x9F, 0x94, 0xAC, 0x1D, 0x10, 0x16, 0x6E, 0xAC, 0xF0, 0x80, 0x16, 0x57, 0x60, 0xC0,
+    0x45, 0xA7, 0x90, 0x40, 0x76, 0xC1, 0x81, 0x26, 0xC4, 0x2C, 0x5B, 0xAF, 0xD0, 0x27, 0xED, 0xFC,
+    0x2A, 0x71, 0x08, 0x46, 0x80, 0xE1, 0x68, 0x7C, 0x54, 0xBD, 0x21, 0x91, 0xD0, 0xE7, 0xAC, 0x98,
+    0xB4, 0x9E, 0xA2, 0x37, 0x05, 0x6F, 0x8A, 0xDD, 0x14, 0xBA, 0x29, 0x72, 0x53, 0xE0, 0xA6, 0x25,
+    0x46, 0x61, 0x9B, 0xA2, 0x36, 0x0B, 0xDA, 0x14, 0xB3, 0x8D, 0x90, 0x0D, 0xD2, 0xC3, 0xDE, 0xF1,
+    0x6E, 0x7B, 0x2F, 0x9E, 0x87, 0xBE, 0x08, 0xB8, 0x16, 0x89, 0xAA, 0x26, 0xAE, 0x89, 0x2A, 0x42,
+    0x37, 0x22, 0x37, 0x02, 0x37, 0xE2, 0x36, 0x63, 0xED, 0xAE, 0xA0, 0x8D, 0x98, 0x6D, 0x37, 0x64,
+    0xF3, 0xAA, 0x35, 0x4C, 0x71, 0x9B, 0xB7, 0x33, 0xD4, 0x25, 0x1B, 0xBE, 0x24, 0x84, 0x9B, 0x10,
+    0xC1, 0xD5, 0x04, 0x70, 0x9C, 0xEF, 0x20, 0x93, 0xC4, 0x61, 0xDA, 0x6A, 0xC5, 0x82, 0x37, 0xC5,
+    0x6E, 0x0A, 0xDD, 0x14, 0xB9, 0x29, 0x70, 0x53, 0xDC, 0xA6, 0xB0, 0x4D, 0x51, 0x9B, 0x82, 0x36,
+    0xC5, 0x6C, 0x0A, 0xD9, 0xEE, 0x42, 0x6C, 0xCB, 0x2E, 0x8C, 0xF3, 0x46, 0x89, 0x8F, 0x77, 0x6A,
+    0x11, 0xD1, 0x1B, 0xC1, 0x1B, 0xB1, 0x5B, 0x68, 0xFF, 0xD5, 0x04, 0x6E, 0xC4, 0x6D, 0x54, 0x4F,
+    0xFF, 0x01, 0xB4, 0x11, 0xB3, 0x11, 0xB2, 0x11, 0xB1, 0xCD, 0x00, 0xDB, 0xD3, 0xEB, 0x54, 0x83,
+    0x46, 0xDB, 0xE0, 0x19, 0x57, 0x8B, 0xDB, 0x70, 0x69, 0x70, 0x70, 0xAA, 0xD3, 0xFB, 0xA7, 0x5A,
+    0x08, 0xDC, 0x77, 0x60, 0xDB, 0xDA, 0x32, 0x06, 0x8E, 0x4A, 0x82, 0x52, 0x96, 0xFD, 0xFC, 0xC1,
+    0x55, 0x14, 0x0D, 0x89, 0x56, 0x3D, 0x87, 0xE1, 0xB9, 0x47, 0xA4, 0x62, 0x80, 0xC9, 0x09, 0xB6,
+    0x4E, 0xE0, 0xFC, 0xD4, 0x5E, 0xAB, 0xC8, 0xD7, 0xC5, 0x63, 0xCC, 0x06, 0x3B, 0x4B, 0xEC, 0xD7,
+    0xE9, 0x23, 0xD1, 0x33, 0xC0, 0xB7, 0xDE, 0xC7, 0xB9, 0xE6, 0x13, 0x59, 0x9F, 0xE9, 0x79, 0x6C,
+    0x0F, 0xF4, 0x74, 0x34, 0xBD, 0x69, 0x1F, 0x41, 0x5D, 0xE5, 0x85, 0x47, 0xE3, 0xCA, 0x08, 0x9A,
+    0x40, 0x23, 0x71, 0x99, 0x84, 0x2F, 0xEE, 0xAD, 0x2B, 0x0F, 0x9D, 0x45, 0xF1, 0x41, 0x1D, 0xFC,
+    0xC8, 0xC8, 0xA2, 0xA6, 0xE9, 0x21, 0x65, 0x2F, 0x99, 0xD2, 0x35, 0x05, 0x32, 0x56, 0xA2, 0x75,
+    0x21, 0x49, 0x91, 0x99, 0x7E, 0x09, 0xCC, 0xFD, 0x71, 0xCD, 0x96, 0x77, 0x7C, 0x6D, 0x9C, 0x64,
+    0xD9, 0x82, 0x95, 0x1C, 0x9E, 0x59, 0x7F, 0x5C, 0x65, 0x0D, 0xB8, 0x86, 0xC1, 0x4F, 0xEB, 0xFD,
+    0xA8, 0x71, 0x11, 0x0A, 0xC7, 0xA1, 0x61, 0x1D, 0xAF, 0xC1, 0x7A, 0x67, 0xC2, 0x52, 0x56, 0x83,
+    0x74, 0x4F, 0x6A, 0xDD, 0xA0, 0x9D, 0xBB, 0xFD, 0xD6, 0x08, 0x2F, 0xB2, 0x9D, 0x61, 0x65, 0x5F,
+    0x2A, 0x78, 0x0C, 0xED, 0x7E, 0xBE, 0x9D, 0x6A, 0xA6, 0xF4, 0x1A, 0x5B, 0x55, 0xBC, 0x5A, 0xF6,
+    0x48, 0x3B, 0x3B, 0x43, 0x6E, 0x0F, 0xE9, 0xEC, 0x33, 0xA0, 0x78, 0x26, 0xB1, 0x4D, 0xB3, 0xCD,
+    0x9C, 0xBF, 0xD6, 0xA3, 0x1B, 0x15, 0xF9, 0xFB, 0x94, 0x44, 0x80, 0x73, 0xA3, 0x93, 0x67, 0x21,
+    0xC3, 0x7B, 0x5A, 0x0D, 0x42, 0x5B, 0x14, 0x56, 0x6C, 0x7F, 0x72, 0x3A, 0xD0, 0x76, 0xAF, 0x09,
+    0x6F, 0x6F, 0x30, 0xF9, 0x29, 0x50, 0x0D, 0xD8, 0x5F, 0xC3, 0x20, 0x1B, 0x9B, 0x3C, 0xE8, 0x22,
+    0x38, 0x2B, 0x84, 0xEE, 0x6E, 0xE5, 0x12, 0x4E, 0xF9, 0xE5, 0x52, 0xEB, 0x98, 0x9B, 0x17, 0xCA,
+    0x64, 0x8A, 0x66, 0x6F, 0x56, 0xF8, 0x12, 0x6D, 0x11, 0xB2, 0x59, 0xAC, 0x1D, 0x38, 0xBB, 0xF8,
+    0x37, 0xD4, 0xDB, 0x3E, 0x33, 0x29, 0x34, 0x9E, 0x00, 0x52, 0xD6, 0x41, 0x43, 0x9D, 0xA3, 0x0A,
+    0x5A, 0xE7, 0x31, 0x75, 0x4E, 0x93, 0x7F, 0x74, 0xEC, 0x03, 0x31, 0x25, 0xB4, 0xFF, 0xB3, 0xF6,
+    0x80, 0x84, 0x1C, 0xAE, 0xC9, 0x1F, 0x83, 0x0D, 0x92, 0xF2, 0xC7, 0xE8, 0xFE, 0xA2, 0x3B, 0x68,
+    0x1F, 0x5A, 0xDF, 0xDC, 0x65, 0x88, 0x02, 0x53, 0x05, 0x77, 0x0A, 0x72, 0x35, 0x71, 0x83, 0x42,
+    0x8C, 0x5E, 0x03, 0xAB, 0x39, 0x57, 0x25, 0x14, 0xAD, 0x26, 0xD5, 0x08, 0xF3, 0xB2, 0xF2, 0xC0,
+    0xF6, 0x79, 0x14, 0x71, 0xD3, 0x64, 0xB9, 0x63, 0x6C, 0xDF, 0x0F, 0x9B, 0x1B, 0x78, 0xF8, 0x99,
+    0x69, 0xCA, 0xCE, 0x58, 0xFC, 0x7E, 0x13, 0x26, 0x29, 0xCC, 0xD9, 0x9D, 0xFB, 0x3B, 0x50, 0xED,
+    0xB7, 0x2F, 0xD6, 0x58, 0xD8, 0x77, 0x80, 0x62, 0xFE, 0xD8, 0xA6, 0x92, 0xB8, 0xF8, 0xC9, 0x15,
+    0x62, 0xA8, 0xA9, 0x07, 0xB7, 0xBE, 0xEB, 0x93, 0x4F, 0x79, 0x99, 0xCD, 0x24, 0xB5, 0xFE, 0x3D,
+    0x09, 0x02, 0x4E, 0xEE, 0xF6, 0x6F, 0x11, 0xBC, 0x10, 0x1F, 0xD1, 0x96, 0xC1, 0x67, 0x17, 0x60,
+    0x37, 0xE7, 0x37, 0xB7, 0xE5, 0x0C, 0x3A, 0x79, 0xC4, 0x62, 0x88, 0x6E, 0x1E, 0xFD, 0xB6, 0x2C,
+    0x9A, 0x19, 0xDC, 0x7C, 0x87, 0x1C, 0x8C, 0xF6, 0xD8, 0xDA, 0x60, 0x87, 0xF5, 0x9E, 0x68, 0xC9,
+    0x66, 0x1F, 0x68, 0x59, 0xDB, 0x94, 0x6F, 0xD1, 0x92, 0xF2, 0x56, 0x4C, 0x96, 0xB7, 0x39, 0x6F,
+    0x51, 0xEF, 0xA0, 0xF3, 0xBD, 0x55, 0x5F, 0xF0, 0xE3, 0x33, 0xE2, 0xD7, 0x54, 0xBF, 0xBC, 0x57,
+    0x7D, 0x89, 0xF4, 0xD2, 0xE0, 0x7A, 0x39, 0xAE, 0x4A, 0x71, 0xBB, 0xB9, 0x3E, 0xFF, 0x75, 0xED,
+    0xF2, 0x9F, 0x27, 0xCB, 0xD3, 0x78, 0xDA, 0xE1, 0x23, 0xA5, 0x42, 0x7F, 0x92, 0x47, 0x71, 0x75,
+    0x89, 0x42, 0x5F, 0x53, 0xD1, 0xF5, 0x06, 0x99, 0x85, 0x5D, 0x86, 0xB7, 0x2C, 0xDE, 0x50, 0x1C,
+    0x16, 0x50, 0x3B, 0xE3, 0x77, 0xC4, 0xB1, 0x9E, 0x22, 0x59, 0xD7, 0x22, 0x24, 0xDC, 0x12, 0x68,
+    0x16, 0x7A, 0x03, 0xCF, 0x46, 0x43, 0xA3, 0x16, 0x00, 0xFB, 0x7B, 0x37, 0xD0, 0x72, 0x33, 0xBA,
+    0x6D, 0x40, 0x07, 0x08, 0xCB, 0x85, 0x01, 0x09, 0xF3, 0x23, 0xB6, 0x55, 0x6E, 0xB7, 0xB0, 0xE1,
+    0x75, 0x71, 0xEF, 0x75, 0x01, 0x9C, 0x12, 0xA5, 0x7E, 0xBB, 0x25, 0xC1, 0x2D, 0x24, 0x86, 0x6F,
+    0xF0, 0x46, 0x35, 0x88, 0xBE, 0x02, 0xD0, 0xBD, 0x36, 0x95, 0xF8, 0xAA, 0x62, 0xC6, 0x34, 0xC9,
+    0xB3, 0x3A, 0x4B, 0x97, 0x9A, 0x87, 0x8D, 0x6E, 0x19, 0x4A, 0xC8, 0x54, 0x63, 0x25, 0x54, 0x3B,
+    0xAA, 0x63, 0x89, 0xF0, 0xBF, 0x2B, 0xBC, 0x25, 0x3E, 0xA2, 0xCD, 0x89, 0xD5, 0x89, 0x52, 0xC2,
+    0xE9, 0x8C, 0xEC, 0x18, 0x11, 0xE2, 0x0E, 0x37, 0xF3, 0xA8, 0x74, 0xB3, 0x79, 0x28, 0x1D, 0x72,
+    0xD1, 0xC3, 0xD1, 0xD5, 0xCF, 0xB7, 0x6C, 0x5F, 0xC8, 0x00, 0x1F, 0xBA, 0xC2, 0x02, 0x93, 0x30,
+    0x03, 0x1B, 0x33, 0x71, 0x6A, 0xAF, 0x72, 0xCB, 0x90, 0x5C, 0x9F, 0x92, 0x06, 0x2A, 0x71, 0x84,
+    0x88, 0x59, 0x28, 0xCA, 0x19, 0x23, 0x15, 0x36, 0x5B, 0x78, 0x93, 0x1F, 0x21, 0xF3, 0x91, 0x7C,
+    0x64, 0xD2, 0x80, 0x26, 0x7B, 0x6A, 0x84, 0xBA, 0x48, 0xB8, 0xFE, 0xFB, 0x24, 0x7B, 0x52, 0xCB,
+    0x7D, 0xB0, 0x74, 0x03, 0x7F, 0xF3, 0xFE, 0xC6, 0xB4, 0xEE, 0x67, 0x2F, 0x55, 0x1E, 0xE6, 0x70,
+    0xD3, 0xB9, 0x39, 0x62, 0xE8, 0x9A, 0xF4, 0x03, 0x73, 0x35, 0x32, 0x5C, 0xF6, 0x7D, 0x04, 0x7F,
+    0x5F, 0x46, 0xB2, 0x9D, 0x22, 0x72, 0xB3, 0x37, 0x27, 0xB3, 0x76, 0xE5, 0x7E, 0xF3, 0x2C, 0x00,
+    0x93, 0x45, 0x83, 0xC2, 0xFA, 0x9E, 0x58, 0x36, 0x8B, 0x85, 0x4C, 0x39, 0xCA, 0xB1, 0x65, 0xAC,
+    0xEE, 0xDF, 0x32, 0x1A, 0x0B, 0xA8, 0xC9, 0xD6, 0x58, 0xF2, 0xF4, 0xFF, 0x90, 0xB4, 0x55, 0x99,
+    0xF9, 0x52, 0x91, 0x2D, 0x87, 0x13, 0xB5, 0x03, 0x3B, 0xF6, 0xFD, 0xA0, 0x68, 0x93, 0x21, 0x1E,
+    0x97, 0x46, 0xE2, 0x71, 0xE8, 0xEC, 0xC7, 0x2E, 0xF6, 0x11, 0x53, 0xB3, 0x63, 0x5A, 0x18, 0x25,
+    0x63, 0x73, 0x03, 0x0F, 0xEC, 0x63, 0x55, 0xB3, 0x99, 0xFB, 0xEE, 0xC9, 0xF7, 0xA9, 0xAA, 0x19,
+    0xF3, 0x9A, 0x5A, 0x63, 0xB3, 0x7F, 0x4E, 0xFF, 0x0E, 0x1B, 0x5D, 0x96, 0x5C, 0x38, 0xC5, 0xC0,
+    0xE7, 0x6A, 0x8A, 0xD2, 0xCD, 0x20, 0x19, 0xC3, 0x9B, 0x47, 0x77, 0x3A, 0xE0, 0xB9, 0x2E, 0xC6,
+    0x34, 0xD9, 0xB9, 0x97, 0x3A, 0x1F, 0x41, 0x8C, 0xB0, 0x99, 0x30, 0x8E, 0x0C, 0x96, 0xA2, 0x3D,
+    0x22, 0x40, 0x94, 0xD8, 0x0D, 0x1B, 0x2C, 0x4E, 0x32, 0xBB, 0x0D, 0x3C, 0xEE, 0x59, 0x66, 0x8C,
+    0x15, 0xCD, 0x9B, 0x62, 0x15, 0x90, 0xA3, 0x29, 0xFA, 0x7B, 0xA9, 0xC5, 0x96, 0x20, 0x63, 0xE9,
+    0x36, 0x03, 0xC9, 0xFB, 0x26, 0x87, 0x64, 0x58, 0x1E, 0x58, 0xBF, 0x3E, 0x8D, 0x2A, 0x0C, 0x07,
+    0xE5, 0x9F, 0x93, 0x5C, 0x77, 0xC5, 0x72, 0x51, 0x96, 0x56, 0x29, 0x6A, 0x66, 0x13, 0xDD, 0xA8,
+    0xE2, 0x56, 0x9A, 0x65, 0x72, 0xE9, 0x42, 0x25, 0xA2, 0xA9, 0x58, 0xA1, 0xB8, 0xD2, 0x28, 0xE3,
+    0xA1, 0xBB, 0x1F, 0x56, 0x2D, 0xAB, 0x94, 0x5D, 0x38, 0x76, 0x8C, 0x7A, 0x25, 0x78, 0x4D, 0xB9,
+    0x9B, 0x03, 0x67, 0x00, 0x2B, 0xF4, 0x71, 0x6C, 0xF8, 0x9E, 0x9E, 0x45, 0x12, 0xB9, 0x50, 0xCB,
+    0x84, 0x5A, 0x1E, 0x74, 0x60, 0x41, 0x95, 0xE7, 0xB5, 0x24, 0xAF, 0xE5, 0x3F, 0x2D, 0xFB, 0x69,
+    0xB9, 0x5D, 0x4B, 0xEC, 0x5A, 0x56, 0xD7, 0x52, 0xBA, 0xCA, 0x79, 0x5A, 0xC6, 0xD3, 0xF2, 0x9D,
+    0x96, 0xED, 0xB4, 0x5C, 0xA7, 0x65, 0x3A, 0xE7, 0xE9, 0x5B, 0x77, 0xD6, 0x50, 0x1E, 0x9E, 0xE3,
+    0x2A, 0x95, 0xA9, 0xB4, 0x3C, 0xA5, 0xB2, 0x94, 0xE4, 0x28, 0x95, 0xA1, 0x54, 0x7E, 0xD2, 0xFA,
+    0xC0, 0x56, 0xBB, 0x9A, 0x24, 0x58, 0xA5, 0x1C, 0x18, 0xAC, 0x48, 0x4E, 0x52, 0x19, 0xC9, 0x19,
+    0xF6, 0x9A, 0x8C, 0x6B, 0x36, 0x2A, 0xC7, 0xCA, 0xF6, 0xE4, 0xC8, 0x78, 0xFB, 0x6F, 0xC2, 0x48,
+    0xBE, 0xC7, 0xE1, 0xF9, 0x74, 0xC0, 0x45, 0x04, 0x2F, 0x43, 0xCB, 0xC2, 0x61, 0x95, 0xAD, 0xCD,
+    0x3B, 0xCC, 0xBB, 0xE4, 0xCD, 0x6D, 0xB7, 0xC2, 0xB5, 0xCC, 0xC5, 0x2E, 0x27, 0xB6, 0x8B, 0x9D,
+    0x6E, 0x25, 0xBA, 0x6F, 0xB7, 0xA2, 0x99, 0x3D, 0x64, 0x7E, 0xE5, 0x6D, 0x86, 0x8F, 0xB8, 0x23,
+    0x05, 0x9B, 0x3E, 0x01, 0x1B, 0x1F, 0x5C, 0xB6, 0x7F, 0xEF, 0x5D, 0xF7, 0x32, 0xF2, 0xAE, 0x76,
+    0x7E, 0xB7, 0x1D, 0x6A, 0xAA, 0x7C, 0xAF, 0x7A, 0x99, 0x41, 0xC8, 0x7E, 0x26, 0xE2, 0x9C, 0x84,
+    0x0F, 0xBB, 0xAF, 0xD1, 0x0C, 0xA1, 0xE8, 0x57, 0x97, 0xC2, 0x41, 0x9B, 0xB7, 0x2A, 0x24, 0x9F,
+    0xAF, 0xF2, 0x5D, 0xA0, 0x2A, 0x23, 0xA8, 0x32, 0xA4, 0xC0, 0xFF, 0x09, 0x50, 0x15, 0x10, 0x54,
+    0x1D, 0x26, 0xA8, 0x3A, 0x4E, 0x50, 0xD5, 0x00, 0x54, 0x5D, 0x2B, 0x01, 0xAA, 0x5E, 0x83, 0x7F,
+    0xB2, 0x3F, 0x31, 0xC3, 0x53, 0xA2, 0x84, 0xD9, 0x36, 0x6A, 0x46, 0x50, 0x15, 0x12, 0x54, 0x1D,
+    0x75, 0x66, 0xAC, 0xF7, 0xDD, 0xE1, 0xF0, 0x53, 0x71, 0xDE, 0x86, 0xA5, 0x0C, 0x56, 0x3D, 0x73,
+    0x74, 0x84, 0xD9, 0x92, 0x36, 0xAA, 0xBF, 0x6A, 0xE3, 0x0F, 0xAE, 0xB7, 0xC9, 0xF5, 0x17, 0x9A,
+    0xE4, 0x3F, 0xF8, 0xA4, 0x8B, 0xEA, 0x84, 0x26, 0xA8, 0xB2, 0x34, 0xBC, 0x83, 0xFB, 0x1B, 0xDD,
+    0x82, 0xD6, 0x40, 0x1E, 0x5E, 0x1D, 0xE3, 0xF4, 0x4C, 0x0C, 0x1B, 0x44, 0x64, 0x46, 0xFC, 0x3F,
+    0x54, 0xFB, 0xD0, 0x8C, 0x7B, 0x2D, 0xAC, 0xD8, 0xA1, 0xA9, 0x5A, 0x43, 0x9F, 0x10, 0x0E, 0x2E,
+    0xDC, 0x83, 0x30, 0x66, 0x7A, 0x73, 0x09, 0x0C, 0xFC, 0x7F, 0x71, 0xC7, 0x91, 0x14, 0xCF, 0xC3,
+    0x27, 0x16, 0x18, 0xEC, 0xC8, 0x1E, 0xAA, 0xCB, 0x29, 0x7F, 0x8F, 0xE8, 0x92, 0xF8, 0x0D, 0x92,
+    0x8E, 0xEF, 0x35, 0xE4, 0x28, 0x18, 0xE7, 0x17, 0x57, 0x77, 0x5A, 0x2E, 0x05, 0x6C, 0x17, 0x88,
+    0xD5, 0xBC, 0x8A, 0xF5, 0xB9, 0x64, 0x0A, 0x29, 0x2D, 0xCE, 0xD6, 0xE5, 0x61, 0xAB, 0x33, 0x61,
+    0x6B, 0x76, 0xEE, 0xE4, 0xDC, 0x66, 0x9D, 0xDD, 0xB1, 0xEB, 0xE5, 0x00, 0xD3, 0xFE, 0x32, 0xE5,
+    0x5E, 0xE3, 0x66, 0xA3, 0x02, 0x2C, 0x9B, 0x4A, 0xC2, 0xF7, 0x1B, 0xF1, 0x3F, 0x69, 0x91, 0xE4,
+    0x91, 0x59, 0x4F, 0x0F, 0xA8, 0x60, 0xF1, 0x2D, 0x85, 0x05, 0x5E, 0x53, 0x20, 0x02, 0x33, 0x89,
+    0x07, 0x12, 0xAB, 0x40, 0x39, 0x52, 0x60, 0x76, 0x72, 0x67, 0x27, 0x02, 0x9A, 0x3D, 0x2B, 0x09,
+    0x9A, 0xAC, 0xBB, 0x9E, 0x94, 0x50, 0xE0, 0x50, 0x50, 0x0D, 0x34, 0x62, 0xE2, 0x96, 0x47, 0xF7,
+    0x43, 0x17, 0x5D, 0x32, 0xC4, 0xF7, 0xF4, 0xCB, 0xEF, 0x06, 0xBF, 0x3C, 0xA0, 0x2E, 0xDE, 0x2D,
+    0xDC, 0x7B, 0xF2, 0x8A, 0xC8, 0x2B, 0xB8, 0xE7, 0xC1, 0x21, 0x6E, 0xF7, 0x6E, 0xCB, 0x26, 0x89,
+    0xCA, 0xE8, 0xF5, 0xCA, 0xFF, 0xA0, 0x71, 0xEA, 0x53, 0xDA, 0x59, 0xA4, 0x8E, 0xA2, 0xD7, 0xB9,
+    0x4D, 0x9A, 0x94, 0x26, 0x30, 0x0C, 0x68, 0x47, 0xFF, 0x6B, 0xF9, 0xDD, 0x59, 0xB2, 0xFC, 0x80,
+    0x0D, 0x71, 0xF8, 0x7C, 0x29, 0x47, 0xDD, 0x72, 0x8F, 0xC5, 0xC3, 0xD4, 0x9E, 0x29, 0xC3, 0x5F,
+    0x55, 0x4F, 0x48, 0xF5, 0xDD, 0x76, 0x94, 0xA2, 0xEB, 0xEC, 0x89, 0x3E, 0x6C, 0x48, 0xFE, 0xB2,
+    0x36, 0xBC, 0x73, 0x74, 0xDF, 0x76, 0x94, 0xFC, 0x2F, 0x27, 0x36, 0xAC, 0xB7, 0x62, 0xAC, 0xFD,
+    0x81, 0xD5, 0x7C, 0xE0, 0x1D, 0x25, 0xBB, 0x85, 0x9C, 0x75, 0x43, 0x68, 0x3B, 0xD5, 0xE1, 0xFD,
+    0xDB, 0x22, 0xBB, 0x6F, 0x7C, 0x3F, 0xA8, 0x42, 0x21, 0x9D, 0xE3, 0xDD, 0x9A, 0x0C, 0x0A, 0xC9,
+    0xEA, 0xF2, 0xFC, 0x23, 0x3E, 0xE8, 0xBA, 0x28, 0x70, 0x3C, 0x80, 0x28, 0xDD, 0xCE, 0x8D, 0x2B,
+    0xBB, 0xA7, 0x5B, 0xDB, 0xA7, 0x8C, 0xB2, 0x57, 0xCD, 0xC0, 0xF0, 0x14, 0x2F, 0xB3, 0x17, 0x67,
+    0xBB, 0x43, 0x7A, 0xC7, 0xE9, 0xF5, 0x41, 0x07, 0xB6, 0x88, 0xE8, 0x9E, 0x10, 0x56, 0x27, 0x8B,
+    0x0A, 0x55, 0xD8, 0xEE, 0x5E, 0xD3, 0x39, 0x2E, 0x9D, 0x73, 0xF9, 0x04, 0xF0, 0x9C, 0x75, 0xCE,
+    0xC2, 0xFA, 0xA1, 0x34, 0xEA, 0x0A, 0x34, 0x73, 0x1F, 0x37, 0xC0, 0x72, 0xB5, 0xD7, 0x7B, 0x39,
+    0x11, 0x0F, 0xD5, 0xD6, 0x67, 0x49, 0xBE, 0xA5, 0xDD, 0x95, 0xB9, 0x36, 0x4B, 0x7B, 0xB1, 0x4B,
+    0xE4, 0x97, 0xEB, 0x83, 0xFB, 0xA1, 0x87, 0x0A, 0x17, 0xEF, 0xF8, 0x44, 0x1E, 0x5C, 0x8F, 0x69,
+    0xA2, 0x79, 0x81, 0x5C, 0x07, 0xD6, 0xB4, 0x78, 0x57, 0xEB, 0x7D, 0xDB, 0xD7, 0x0B, 0x6E, 0xB4,
+    0x58, 0xA6, 0x9D, 0x75, 0xCA, 0x4A, 0xB0, 0x07, 0x5B, 0x96, 0x22, 0x23, 0x1F, 0x44, 0xBB, 0xBA,
+    0xF5, 0x25, 0x28, 0x94, 0x1F, 0xDF, 0xBF, 0x8D, 0x4A, 0x77, 0x48, 0x8F, 0xCB, 0x30, 0xE5, 0x11,
+    0x9B, 0x1E, 0x1F, 0x58, 0xA1, 0x00, 0xCD, 0x6D, 0xF1, 0xD7, 0xD6, 0xE9, 0xBC, 0xCE, 0x6B, 0xDD,
+    0x89, 0xD7, 0x3A, 0xCA, 0x43, 0x10, 0x67, 0xB8, 0x04, 0x90, 0xAC, 0x46, 0xB1, 0xA1, 0x28, 0xEC,
+    0xC5, 0xAA, 0x1F, 0x41, 0x81, 0x33, 0xA8, 0x3D, 0xA8, 0x3F, 0x40, 0x03, 0x71, 0x9E, 0x7C, 0x56,
+    0x48, 0x30, 0x4A, 0xB9, 0x6E, 0x89, 0x33, 0xB6, 0xB5, 0xDC, 0xF0, 0x74, 0xB9, 0x0E, 0x0E, 0x9D,
+    0x17, 0x02, 0x8D, 0xA0, 0x26, 0x3D, 0x9D, 0x20, 0x52, 0x9E, 0xB2, 0x7B, 0xE2, 0xA6, 0x1A, 0x72,
+    0x4C, 0x27, 0x3F, 0x00, 0x26, 0xDD, 0xC2, 0x85, 0x57, 0xF0, 0xCE, 0xFE, 0xD2, 0x02, 0x8C, 0xD8,
+    0x15, 0xED, 0xAC, 0x0F, 0x3B, 0x1D, 0xB8, 0x17, 0xD7, 0xD4, 0xE3, 0xBA, 0x57, 0x0B, 0x50, 0x13,
+    0x7D, 0x6E, 0x2E, 0x94, 0x2B, 0x10, 0xB8, 0x5C, 0xE5, 0x70, 0x1C, 0xAD, 0x6B, 0x3E, 0x3C, 0x25,
+    0xD4, 0x8E, 0x39, 0x6D, 0xD6, 0xF1, 0xAB, 0xC3, 0xE2, 0x72, 0x77, 0x45, 0xCE, 0x07, 0x3E, 0x6B,
+    0x91, 0xBD, 0x7D, 0x34, 0x33, 0xF3, 0xFA, 0x48, 0xFE, 0xB9, 0xBC, 0x9E, 0x4F, 0x31, 0x8A, 0x2B,
+    0xC3, 0xC3, 0x98, 0x68, 0x5B, 0x62, 0x08, 0xBD, 0x8E, 0x9F, 0xFB, 0xD3, 0x93, 0xF6, 0x81, 0x27,
+    0x38, 0xDB, 0xD7, 0x47, 0xEC, 0x66, 0x45, 0x04, 0xC9, 0xD1, 0x94, 0xBE, 0x62, 0xAB, 0x85, 0x94,
+    0x6D, 0x5F, 0xC4, 0x0E, 0x41, 0x7E, 0x32, 0x4E, 0xB1, 0xC8, 0xD9, 0xE2, 0xFF, 0xF6, 0x4C, 0xAD,
+    0x86, 0x94, 0x16, 0xE4, 0xB8, 0x6C, 0xBB, 0x78, 0x33, 0x02, 0x74, 0x0A, 0xBE, 0x48, 0x60, 0x1F,
+    0x69, 0x71, 0x54, 0xB5, 0xB4, 0x29, 0x99, 0x0D, 0xDA, 0x3D, 0x85, 0xDA, 0xE0, 0x29, 0x1D, 0x0D,
+    0x51, 0xF9, 0x20, 0x86, 0x43, 0xA7, 0x65, 0xCC, 0x7F, 0x6F, 0x5B, 0xB9, 0xB7, 0x53, 0x89, 0xBE,
+    0xA8, 0xE5, 0x04, 0x24, 0xBD, 0x8C, 0x0B, 0xB7, 0x78, 0xB1, 0x3F, 0x3C, 0xCB, 0x86, 0xBA, 0xC9,
+    0x96, 0xF1, 0x18, 0xCD, 0x11, 0x0F, 0x2C, 0x62, 0x34, 0xAC, 0xE5, 0xE1, 0x59, 0x30, 0xB6, 0x85,
+    0x68, 0x8E, 0xD9, 0x56, 0x9F, 0x98, 0xDB, 0x17, 0x0A, 0x52, 0x72, 0xE3, 0xDE, 0xBF, 0x6B, 0x05,
+    0xA6, 0xF9, 0xAC, 0xF1, 0x92, 0x1D, 0x92, 0xC2, 0x52, 0x14, 0x96, 0xA0, 0xB0, 0xF4, 0x84, 0x25,
+    0x27, 0x2C, 0x35, 0x61, 0x89, 0x09, 0x4B, 0x4B, 0x58, 0xCC, 0x43, 0x4A, 0x42, 0x79, 0xAC, 0x89,
+    0xA5, 0x23, 0x06, 0x06, 0x4B, 0xA9, 0x08, 0x4B, 0x44, 0x50, 0x71, 0xDC, 0x63, 0xA9, 0xFF, 0x45,
+    0xC6, 0xE7, 0xCB, 0xDE, 0x1B, 0x7B, 0x4D, 0xAF, 0xDC, 0x12, 0xF7, 0xCB, 0x81, 0x39, 0xB5, 0xCF,
+    0xDD, 0x70, 0x99, 0x2C, 0xDE, 0x43, 0xAB, 0x1F, 0xCA, 0xBD, 0xAE, 0x68, 0xBC, 0xFE, 0x8B, 0xD6,
+    0x43, 0x42, 0xF4, 0xBB, 0xA0, 0x0D, 0x26, 0xBB, 0xD6, 0x8D, 0xAE, 0x1A, 0x45, 0xBB, 0xBA, 0x6E,
+    0x62, 0x83, 0xBE, 0x43, 0x9B, 0xC0, 0xFF, 0x01, 0x65, 0x54, 0xBF, 0x8F, 0x1B, 0x45, 0x14, 0xFE,
+    0xD6, 0x6B, 0x7B, 0x93, 0x5B, 0x29, 0x7B, 0x85, 0x0F, 0x8E, 0xE4, 0xEE, 0xF6, 0x0A, 0x0B, 0x45,
+    0x39, 0xDB, 0x7B, 0xC5, 0x21, 0x39, 0xB0, 0xE7, 0x9D, 0x06, 0x21, 0x84, 0x10, 0x16, 0xCA, 0x51,
+    0xBB, 0x48, 0x75, 0x29, 0x70, 0xB1, 0x91, 0x8C, 0x70, 0xD8, 0x81, 0x86, 0xD6, 0x7F, 0x82, 0x8B,
+    0x03, 0x81, 0x85, 0x60, 0x8B, 0x4B, 0x74, 0x42, 0x49, 0x76, 0x44, 0x43, 0x41, 0x33, 0xC9, 0x5F,
+    0xB0, 0x12, 0xA1, 0x08, 0xD5, 0x20, 0x1D, 0xC8, 0x02, 0xDB, 0xC3, 0x9B, 0xB5, 0xC9, 0x0F, 0x31,
+    0xD6, 0x8C, 0xE7, 0xED, 0xCC, 0x7C, 0xEF, 0xCD, 0xF7, 0xBE, 0x37, 0x40, 0xC2, 0x7C, 0xE1, 0x48,
+    0x2B, 0x07, 0xEC, 0xA9, 0x97, 0x07, 0x6C, 0x00, 0x6A, 0xA5, 0x05, 0x5C, 0x8D, 0xC0, 0xE3, 0x83,
+    0x92, 0x20, 0xD3, 0x93, 0x69, 0xF4, 0x77, 0x7E, 0x57, 0x8B, 0x51, 0x8B, 0xAC, 0x6C, 0x91, 0xCD,
+    0xE9, 0x2F, 0xD2, 0x2C, 0xD2, 0x66, 0x73, 0xEA, 0xE2, 0xCE, 0x1D, 0x44, 0x53, 0xB8, 0x92, 0xAC,
+    0x84, 0x65, 0x3C, 0x41, 0xD9, 0x2C, 0xB4, 0x6C, 0x19, 0xB9, 0x79, 0xE4, 0xC8, 0xB2, 0xC5, 0x2E,
+    0xB3, 0x4C, 0x7E, 0x98, 0xDB, 0xD2, 0x67, 0x0D, 0xB3, 0x84, 0x40, 0x9E, 0xA6, 0x69, 0xFF, 0x34,
+    0x8D, 0x64, 0x61, 0xBA, 0xBF, 0x9E, 0x7B, 0x5F, 0xCA, 0x8E, 0xC7, 0x4E, 0x43, 0x63, 0x0E, 0x1C,
+    0xD1, 0x89, 0xE0, 0xCD, 0xE0, 0x2A, 0x34, 0x1B, 0x61, 0x7B, 0xFD, 0xD2, 0xF6, 0x76, 0xA3, 0x19,
+    0x86, 0x61, 0x6D, 0xDD, 0x78, 0xFE, 0x40, 0x78, 0x3F, 0xE7, 0xF6, 0x23, 0x05, 0x65, 0xA2, 0xA5,
+    0xD8, 0x6D, 0x85, 0x52, 0x8E, 0xD8, 0x61, 0x9D, 0x8F, 0x11, 0xCC, 0x50, 0x1D, 0x19, 0xC8, 0xF3,
+    0x60, 0x3E, 0x68, 0x8D, 0x5D, 0x8C, 0x5D, 0xD9, 0xC4, 0x10, 0x0F, 0x91, 0x21, 0xC1, 0x6B, 0x70,
+    0xA4, 0xA7, 0x3C, 0x65, 0xAB, 0x52, 0x6E, 0x8B, 0x0E, 0x76, 0xE1, 0xB2, 0x48, 0x24, 0xE2, 0x33,
+    0x0C, 0x10, 0xC2, 0x47, 0xE9, 0x7F, 0xEB, 0x74, 0x61, 0x04, 0xDC, 0x15, 0x16, 0x45, 0x6A, 0xCF,
+    0xFE, 0xA3, 0xC8, 0x12, 0x7B, 0x22, 0xE2, 0x36, 0xB3, 0x68, 0xDE, 0xC6, 0x9B, 0x2C, 0x62, 0x7D,
+    0x73, 0xF9, 0x45, 0x32, 0x27, 0x18, 0xF3, 0x1B, 0xE0, 0xA6, 0x21, 0xCE, 0xCB, 0x9D, 0x02, 0xA7,
+    0x0B, 0x0B, 0x01, 0x7D, 0xEC, 0x53, 0xDF, 0x22, 0x2F, 0x36, 0x5C, 0x24, 0x84, 0x78, 0xCC, 0xBF,
+    0xE7, 0x5B, 0xB8, 0x5A, 0x90, 0x60, 0xB3, 0x57, 0x59, 0x94, 0xAF, 0xE1, 0x22, 0x8E, 0x47, 0x93,
+    0x11, 0x6A, 0x04, 0x7C, 0x80, 0x78, 0x43, 0x45, 0x79, 0xC0, 0xB1, 0x34, 0x30, 0x60, 0x89, 0x08,
+    0x58, 0x05, 0x11, 0x4F, 0x78, 0x84, 0x25, 0x95, 0x44, 0xB3, 0x43, 0x34, 0xE7, 0x44, 0xF3, 0xCB,
+    0xC4, 0x56, 0x98, 0xCF, 0x3B, 0x14, 0x4B, 0xCF, 0x80, 0x73, 0x47, 0x61, 0x8A, 0xE9, 0x2D, 0x95,
+    0x70, 0x97, 0x1F, 0xE2, 0x3E, 0x66, 0xC8, 0xF2, 0x40, 0x6E, 0x37, 0xC2, 0xB0, 0x20, 0x55, 0xAB,
+    0xC3, 0x23, 0xB5, 0x8F, 0xB4, 0x87, 0xEE, 0x3A, 0x63, 0xBD, 0x9F, 0xF8, 0xA7, 0xFF, 0x60, 0xB3,
+    0x08, 0xEC, 0xCC, 0x35, 0xD9, 0xF0, 0x67, 0xF0, 0xD4, 0x0B, 0xE2, 0x78, 0x6F, 0x25, 0x8E, 0x67,
+    0xAC, 0x3B, 0x79, 0xC1, 0x7A, 0x64, 0x58, 0x5F, 0xA3, 0xA9, 0x73, 0x7E, 0xD5, 0x5B, 0x9C, 0x36,
+    0x13, 0x55, 0x77, 0xB9, 0xE1, 0x46, 0x13, 0x3D, 0xB8, 0x36, 0xF9, 0x26, 0xD1, 0xB3, 0x8D, 0xA3,
+    0x1B, 0x91, 0x5E, 0xD0, 0xBC, 0xF8, 0x3E, 0x3B, 0x9E, 0x9C, 0x14, 0x2A, 0xEB, 0x47, 0x8B, 0xFC,
+    0xB6, 0x16, 0x5D, 0x1F, 0x45, 0x40, 0xB3, 0xE5, 0x06, 0x33, 0xD5, 0x5A, 0x5C, 0x9B, 0x4C, 0x26,
+    0xBC, 0x30, 0x87, 0x04, 0x4D, 0x3A, 0x73, 0xA6, 0x94, 0x97, 0x15, 0x75, 0xAB, 0x66, 0x72, 0x40,
+    0x51, 0x98, 0xB8, 0x1C, 0xE2, 0xC2, 0x23, 0xB3, 0x59, 0x24, 0x08, 0xA0, 0xD0, 0x8B, 0x0C, 0xD2,
+    0x92, 0x4B, 0xE6, 0x25, 0xEA, 0x46, 0x6A, 0xF1, 0x72, 0xA9, 0x38, 0xC1, 0x9F, 0x9F, 0x08, 0x57,
+    0x60, 0xA6, 0x95, 0xE9, 0xAB, 0xCD, 0x6D, 0xEE, 0x17, 0x38, 0x94, 0x85, 0xFD, 0x36, 0x52, 0xA2,
+    0xEB, 0x78, 0x32, 0xA2, 0xF1, 0x8D, 0xA3, 0xB4, 0x8F, 0xF1, 0xDD, 0x23, 0x99, 0x69, 0x51, 0xA9,
+    0x98, 0xAA, 0xE8, 0x3F, 0x66, 0xDD, 0xCF, 0x51, 0xE6, 0x81, 0xF0, 0xF0, 0x16, 0x5F, 0x47, 0x95,
+    0xB5, 0x0A, 0x45, 0xEC, 0x90, 0xD3, 0x21, 0x09, 0x61, 0xE3, 0xE8, 0x28, 0xD0, 0x0B, 0x42, 0x22,
+    0x16, 0xE8, 0xF2, 0xCF, 0xF4, 0x65, 0x4A, 0x70, 0xE6, 0x2A, 0x9F, 0x17, 0x6E, 0x1C, 0x55, 0xB0,
+    0x97, 0x2D, 0xD9, 0xEB, 0x90, 0x74, 0x7D, 0x6C, 0xE3, 0xA4, 0x88, 0xC8, 0x67, 0x41, 0x30, 0x8C,
+    0x0E, 0x1F, 0x44, 0xED, 0x07, 0xE5, 0x7E, 0xED, 0x98, 0x00, 0x16, 0xD0, 0x3C, 0x61, 0xCF, 0xD2,
+    0x48, 0x11, 0x75, 0xD1, 0xF5, 0xB5, 0xC6, 0xE5, 0xC9, 0xB7, 0x2B, 0x0A, 0xE7, 0x86, 0x7B, 0xEC,
+    0x34, 0x4D, 0x19, 0x85, 0x83, 0x75, 0xCA, 0x79, 0x94, 0xEF, 0xC9, 0x92, 0x20, 0x46, 0x2E, 0xC2,
+    0x9D, 0xD7, 0xA3, 0x85, 0xBA, 0xA7, 0xE5, 0x17, 0xBF, 0x33, 0xA3, 0xA2, 0x35, 0xE3, 0x84, 0x3C,
+    0xA2, 0x7C, 0xC1, 0x9E, 0x37, 0x3C, 0x3D, 0x6D, 0x06, 0xB9, 0xA9, 0xBD, 0x21, 0x48, 0x38, 0x4B,
+    0xCE, 0xED, 0xE9, 0x96, 0xA7, 0xCF, 0xB6, 0x13, 0x55, 0xAB, 0x72, 0x6B, 0xB4, 0xEE, 0x4D, 0xE3,
+    0x40, 0xAB, 0x76, 0x20, 0x61, 0x4A, 0xE2, 0x42, 0xB9, 0x75, 0x3F, 0x99, 0xD7, 0x76, 0x8B, 0x9B,
+    0x70, 0x9F, 0x98, 0xF0, 0xE8, 0xF6, 0x9A, 0xEA, 0x47, 0x3D, 0xB5, 0x4E, 0xAA, 0xA9, 0xA9, 0xFA,
+    0xBE, 0xAC, 0x7C, 0x45, 0x24, 0x6F, 0x54, 0xC8, 0x5F, 0x0F, 0x23, 0x90, 0xDF, 0x1A, 0x1E, 0xD1,
+    0xD0, 0x7F, 0x4C, 0x00, 0xCB, 0x81, 0xF6, 0x95, 0xFB, 0x25, 0x8E, 0x4D, 0x10, 0x71, 0x5D, 0xE0,
+    0x86, 0xD5, 0x85, 0xBC, 0xF8, 0x35, 0xFA, 0x05, 0xC0, 0x6F, 0xD6, 0x8D, 0x4A, 0x5A, 0x80, 0x02,
+    0xA7, 0x05, 0x89, 0x9F, 0x80, 0xC1, 0x0A, 0xE2, 0x94, 0x9E, 0x91, 0xD2, 0xD8, 0x48, 0xB6, 0xF3,
+    0x10, 0xA9, 0x67, 0xB2, 0xEE, 0xC8, 0x22, 0xF7, 0x40, 0x8D, 0xB5, 0xA4, 0xC7, 0x7D, 0x59, 0x1F,
+    0xA1, 0x77, 0x45, 0x46, 0xB8, 0x22, 0xD1, 0x3B, 0x40, 0x30, 0x72, 0x54, 0xC0, 0x0F, 0x30, 0xB6,
+    0x59, 0xE7, 0x1D, 0xE1, 0xFE, 0x22, 0x3A, 0xEF, 0xE7, 0xE3, 0x46, 0xDF, 0xE4, 0xDE, 0x61, 0x36,
+    0xF3, 0x71, 0xB8, 0xAC, 0x35, 0x11, 0xD1, 0xAF, 0x42, 0xB3, 0x4D, 0xB1, 0xF3, 0xDD, 0xDE, 0x93,
+    0xD7, 0x63, 0x9B, 0x58, 0xF1, 0x7F, 0x60, 0xD7, 0xFF, 0x14, 0xFD, 0xB1, 0xA4, 0x91, 0xE6, 0x35,
+    0xD2, 0x48, 0x24, 0x5E, 0x11, 0x25, 0xBE, 0x52, 0x50, 0x6A, 0x3A, 0x01, 0x38, 0xC2, 0x7B, 0xFA,
+    0xD1, 0x02, 0x96, 0xD6, 0x94, 0x6B, 0xBA, 0x89, 0xB9, 0x11, 0xCA, 0xE6, 0x39, 0x89, 0x5B, 0x8C,
+    0x22, 0x74, 0x17, 0x13, 0xD2, 0x45, 0xA6, 0x47, 0xCF, 0x15, 0x9D, 0x68, 0x3D, 0xA7, 0x3E, 0x7B,
+    0x71, 0x6E, 0x65, 0xB4, 0x41, 0xBA, 0x5A, 0x8F, 0x1C, 0xD1, 0x7A, 0x3B, 0xD3, 0x9A, 0xB5, 0x61,
+    0x65, 0x53, 0xBC, 0xD4, 0xCC, 0xB2, 0xC1, 0xA2, 0xA3, 0xCE, 0x13, 0x3A, 0x4B, 0xF2, 0x33, 0xA9,
+    0x30, 0xA5, 0x0E, 0xB6, 0xDA, 0xB3, 0x7B, 0x3C, 0x99, 0x9C, 0x65, 0x4B, 0x74, 0xF3, 0x46, 0x60,
+    0xED, 0xA4, 0x9D, 0xA6, 0x4A, 0xE5, 0xF7, 0xF2, 0x7A, 0xAF, 0x9A, 0x6E, 0xC5, 0x87, 0x79, 0x1B,
+    0x61, 0xB7, 0xCA, 0xD0, 0xC0, 0x59, 0x3B, 0x4E, 0xCF, 0xEB, 0x6B, 0x79, 0x18, 0xC7, 0x71, 0x9A,
+    0xDE, 0x96, 0x97, 0x31, 0x3C, 0x08, 0xE3, 0x76, 0x1A, 0xAB, 0x1F, 0xCF, 0xEB, 0x37, 0x69, 0xF3,
+    0x7E, 0x88, 0xD5, 0x66, 0x23, 0x93, 0xF6, 0xDA, 0xF9, 0x73, 0x28, 0x8A, 0x86, 0xB9, 0xF0, 0x86,
+    0x5E, 0x63, 0xA7, 0x41, 0xCF, 0xCD, 0xF5, 0xDA, 0x66, 0xF3, 0x2F, 0xD5, 0x1A, 0xAA, 0x30, 0x56,
+    0xED, 0x34, 0x8F, 0xFF, 0xC8, 0x7B, 0xDD, 0x5E, 0xF3, 0xD4, 0xAF, 0x37, 0x61, 0x30, 0xEA, 0x04,
+    0x50, 0xA5, 0x6C, 0x36, 0x0A, 0xEB, 0x3A, 0x3D, 0xD9, 0x83, 0xFD, 0x46, 0xBD, 0xB1, 0xBF, 0x35,
+    0xF2, 0x18, 0x29, 0xF5, 0x5D, 0xFB, 0xA4, 0x24, 0x4B, 0xF9, 0x85, 0x74, 0xB7, 0xFE, 0x2F, 0xD5,
+    0x7C, 0x5D, 0x8C, 0xDE, 0xD6, 0x99, 0xDE, 0xE1, 0x47, 0xCD, 0x30, 0x16, 0x13, 0x51, 0x05, 0xAC,
+    0x78, 0xAB, 0xB1, 0xC4, 0x5C, 0x14, 0x68, 0x9A, 0x4A, 0x66, 0x2E, 0x5C, 0x40, 0xDB, 0xCE, 0x88,
+    0x94, 0x04, 0xAC, 0x2F, 0x0C, 0xD4, 0x73, 0xA1, 0x89, 0x81, 0x06, 0x85, 0x72, 0xB1, 0x37, 0xF5,
+    0xB6, 0x1D, 0x5F, 0x08, 0x0B, 0x01, 0x2B, 0x8B, 0xB4, 0x74, 0xE1, 0x0B, 0x03, 0x9B, 0x69, 0x11,
+    0x67, 0x2F, 0x8C, 0x85, 0x7D, 0x61, 0x14, 0x6B, 0xB9, 0xC5, 0x08, 0x0B, 0x61, 0x2B, 0x14, 0xB2,
+    0x48, 0x4B, 0x40, 0x5C, 0xC0, 0xDD, 0x9A, 0x4E, 0xE2, 0xF8, 0xC2, 0x68, 0xCD, 0xD8, 0x72, 0xBC,
+    0x6B, 0xB5, 0x3B, 0x74, 0x4C, 0x27, 0x9C, 0x11, 0xC9, 0xD3, 0xE7, 0x79, 0x0F, 0xF9, 0x7D, 0xDF,
+    0xC8, 0x92, 0x63, 0xFD, 0x7A, 0x3B, 0xCE, 0x77, 0x98, 0x19, 0x7D, 0x3C, 0x3C, 0xEF, 0x7B, 0xDE,
+    0x9F, 0xE7, 0xFD, 0x39, 0x54, 0x4A, 0x7E, 0x34, 0x87, 0x30, 0xC2, 0xE0, 0x65, 0x18, 0x46, 0xB9,
+    0xEA, 0xFF, 0xAE, 0x75, 0xA1, 0x62, 0x0E, 0x5E, 0x69, 0xE7, 0xCA, 0x2F, 0x46, 0x99, 0x0A, 0xF2,
+    0x51, 0xA2, 0x42, 0x7E, 0x4D, 0x86, 0x58, 0x06, 0x5D, 0x29, 0x95, 0x9E, 0x7E, 0xB1, 0x9F, 0x89,
+    0x83, 0xD5, 0x71, 0xA2, 0x56, 0x6D, 0x55, 0xA3, 0x46, 0x6D, 0x53, 0x76, 0xA3, 0x16, 0x94, 0xDF,
+    0x9D, 0x6E, 0x54, 0xAA, 0x75, 0x83, 0x7F, 0xAE, 0x1E, 0xC2, 0x3F, 0xD7, 0x31, 0x86, 0x0A, 0x83,
+    0x8A, 0xB6, 0xDC, 0xED, 0x47, 0xFA, 0x98, 0x39, 0x0B, 0x38, 0x2C, 0xD8, 0x8D, 0x93, 0xCD, 0x3B,
+    0xB5, 0x9D, 0x3C, 0xEC, 0x56, 0x76, 0x82, 0x07, 0x91, 0x70, 0x19, 0x7E, 0xF3, 0xB2, 0xE2, 0x17,
+    0xF1, 0xC8, 0xCB, 0x71, 0x89, 0xA7, 0x79, 0x15, 0x06, 0xB7, 0x52, 0x71, 0xC2, 0x21, 0xC2, 0x90,
+    0xF2, 0x9B, 0x1A, 0x4B, 0x72, 0xF4, 0x7F, 0xD4, 0x51, 0xA0, 0x3F, 0xAD, 0xD5, 0xF0, 0x93, 0xF2,
+    0xF1, 0xA0, 0x4D, 0x39, 0x05, 0x86, 0x6D, 0x6A, 0x42, 0x51, 0x4E, 0x8A, 0x72, 0x52, 0x94, 0x81,
+    0x22, 0x9B, 0x14, 0x61, 0x98, 0x50, 0x14, 0x26, 0xA4, 0x88, 0x43, 0x1A, 0xA9, 0x6B, 0x29, 0xB2,
+    0xDA, 0x61, 0x5E, 0x9B, 0xC3, 0x5C, 0x87, 0xAF, 0xA4, 0x7A, 0xD8, 0x22, 0x35, 0x22, 0x23, 0x82,
+    0x2B, 0x1D, 0xEF, 0x48, 0xF9, 0x95, 0x58, 0x61, 0x99, 0xFB, 0x0C, 0x41, 0x41, 0x3E, 0x66, 0x9A,
+    0xAE, 0x79, 0x1B, 0x99, 0x26, 0xCF, 0x19, 0x0F, 0x71, 0xBF, 0x8A, 0x45, 0x15, 0x94, 0xD8, 0x78,
+    0x97, 0xD4, 0x5B, 0xBA, 0x55, 0x53, 0x3F, 0xB3, 0xD8, 0x8D, 0xE0, 0x4A, 0xA3, 0x2E, 0x60, 0x29,
+    0x8D, 0x6A, 0xAC, 0x46, 0xBD, 0xC4, 0x45, 0x59, 0x1A, 0x2B, 0xE1, 0x8C, 0x71, 0x47, 0xAE, 0x25,
+    0x58, 0x0A, 0x1E, 0x17, 0x16, 0x16, 0x9E, 0x1D, 0x28, 0xB7, 0x0C, 0x23, 0xB7, 0x00, 0x0B, 0x33,
+    0x7F, 0x3D, 0x8E, 0x46, 0xBA, 0x1E, 0xB8, 0x11, 0xA9, 0xB8, 0x35, 0xFC, 0xF6, 0x0B, 0xB3, 0x42,
+    0x2E, 0x90, 0x1F, 0x72, 0x80, 0x1F, 0x32, 0x41, 0x1B, 0x16, 0x90, 0x03, 0xD8, 0x52, 0xA1, 0x9F,
+    0xE4, 0xFB, 0xA0, 0x3E, 0xC5, 0x0A, 0xD5, 0x43, 0x2E, 0x44, 0x02, 0xD2, 0xCA, 0xCF, 0x16, 0xEB,
+    0xCE, 0xCE, 0xED, 0x81, 0x28, 0x87, 0xB4, 0x4C, 0x7D, 0xC9, 0x6E, 0x26, 0x1F, 0x07, 0xB4, 0x80,
+    0xC7, 0xF2, 0x9C, 0xE1, 0x59, 0x7E, 0xFE, 0xF9, 0xE7, 0x0D, 0xCF, 0xEA, 0xCC, 0x6D, 0xAB, 0xB8,
+    0x45, 0x93, 0xE5, 0x36, 0x44, 0xA2, 0x24, 0xFF, 0xB4, 0x5E, 0xC1, 0xAF, 0xF3, 0xB2, 0xAF, 0xEA,
+    0x98, 0xB9, 0x9C, 0x75, 0x84, 0x53, 0xA5, 0xB9, 0x14, 0x7C, 0x8E, 0xB2, 0x72, 0x2E, 0x49, 0x8D,
+    0x32, 0xEF, 0x2A, 0xE6, 0xB3, 0x33, 0xBF, 0xC0, 0xAE, 0x39, 0x49, 0x90, 0xE3, 0x49, 0x6E, 0x14,
+    0x66, 0x21, 0x64, 0x0B, 0x4F, 0xC5, 0x6F, 0xFB, 0xCD, 0xE5, 0x3C, 0x9E, 0x9F, 0x26, 0x61, 0xAD,
+    0xD2, 0x03, 0x5A, 0x85, 0xE5, 0xAC, 0x5E, 0xAB, 0x55, 0x90, 0x41, 0xB2, 0x13, 0x35, 0x11, 0xCB,
+    0xC7, 0x64, 0xEF, 0x5A, 0x87, 0x8B, 0xF0, 0x4A, 0x91, 0x35, 0xA8, 0x5B, 0x2B, 0x62, 0x23, 0xF2,
+    0x16, 0x66, 0xF6, 0xD4, 0x25, 0xFE, 0xF8, 0x95, 0x6E, 0x85, 0x82, 0x84, 0x1F, 0xD2, 0xE6, 0x95,
+    0x58, 0x84, 0xE6, 0x5E, 0xE7, 0x72, 0xF1, 0x0B, 0x4C, 0xE1, 0x17, 0x32, 0x45, 0x90, 0xCB, 0x14,
+    0x5C, 0x8B, 0xCD, 0x8B, 0x8E, 0xFC, 0xEE, 0x80, 0x5E, 0x6B, 0xC1, 0xDF, 0x37, 0x49, 0xF4, 0xAD,
+    0x29, 0x63, 0x3F, 0xC4, 0x09, 0x07, 0x3C, 0x1F, 0xF2, 0x0E, 0xD6, 0x1B, 0x65, 0x5C, 0x09, 0xAB,
+    0x40, 0x97, 0xE1, 0x44, 0x6E, 0x45, 0xF4, 0xF1, 0x35, 0x8E, 0xC2, 0xCA, 0xB1, 0x55, 0x33, 0xB4,
+    0x53, 0x54, 0xDC, 0x8E, 0xCF, 0xB2, 0x65, 0x0B, 0x21, 0x4F, 0xB8, 0xE7, 0x21, 0xA1, 0xF7, 0x1C,
+    0xC7, 0x4B, 0xD4, 0xE2, 0xF8, 0x4D, 0xA3, 0x3C, 0xBC, 0x37, 0x4D, 0xF9, 0x17, 0x2D, 0x8B, 0xD3,
+    0x6E, 0x4D, 0xD9, 0x70, 0x1A, 0x4A, 0x87, 0x2D, 0x42, 0x64, 0x69, 0xD9, 0x66, 0x4C, 0x0C, 0x41,
+    0x8A, 0x73, 0x8A, 0x92, 0x5F, 0x8E, 0x1F, 0xE9, 0xF1, 0x5E, 0x65, 0x9B, 0x3F, 0x18, 0x5D, 0xD8,
+    0x33, 0xB5, 0x9E, 0x47, 0x60, 0xA1, 0xE2, 0x76, 0x56, 0x5F, 0x26, 0xED, 0x90, 0x1B, 0xA1, 0x0B,
+    0xEB, 0xE1, 0xA4, 0xB0, 0x40, 0x32, 0x06, 0x1D, 0xC5, 0xEA, 0xBF, 0xE1, 0x61, 0xF1, 0xA9, 0x0F,
+    0xF0, 0xE0, 0xF4, 0xB1, 0x43, 0x18, 0xF5, 0x53, 0x94, 0x14, 0x5D, 0x39, 0x15, 0x04, 0x8A, 0xB6,
+    0x6A, 0xC4, 0xCD, 0xA0, 0x50, 0x63, 0xC4, 0x7A, 0x30, 0x13, 0x78, 0x1F, 0xC3, 0x72, 0xE9, 0x4B,
+    0x9A, 0x7B, 0xAC, 0x60, 0x6A, 0xBD, 0x08, 0x0F, 0xF7, 0xB3, 0x33, 0x94, 0x75, 0x10, 0x68, 0xBD,
+    0x3C, 0x98, 0x30, 0x3D, 0xD2, 0x45, 0xDC, 0x5A, 0xE9, 0x0A, 0x96, 0xBE, 0xC0, 0x19, 0xCE, 0x29,
+    0x50, 0x5A, 0x2A, 0xA7, 0x81, 0x31, 0xC6, 0x56, 0x41, 0xC9, 0x5B, 0x8F, 0xA2, 0xBB, 0x97, 0xCB,
+    0x3E, 0xC6, 0x5B, 0x48, 0x52, 0x9C, 0x0F, 0x56, 0x2C, 0xE0, 0x34, 0x0B, 0xF8, 0xFC, 0x09, 0x89,
+    0x8C, 0xCB, 0xC1, 0xFE, 0x4C, 0x18, 0x5F, 0x0B, 0xA1, 0x85, 0xB1, 0xA3, 0x4A, 0xA4, 0x86, 0x84,
+    0xB6, 0xFC, 0xE2, 0xA8, 0x1D, 0xC4, 0x2D, 0x4C, 0x38, 0xC6, 0x09, 0x89, 0x4B, 0x69, 0x78, 0xF1,
+    0x65, 0xB7, 0x54, 0x22, 0x69, 0x54, 0x4A, 0x92, 0xD8, 0x92, 0x38, 0x10, 0x1A, 0x70, 0x69, 0x7C,
+    0x0C, 0xAC, 0x7D, 0x7A, 0x99, 0xE6, 0x9E, 0x2E, 0x66, 0xD4, 0x4D, 0xF1, 0xBA, 0x9C, 0x1A, 0x57,
+    0xCC, 0x5A, 0x28, 0x2A, 0x36, 0xBF, 0xE3, 0x50, 0x47, 0x3D, 0x5A, 0xEF, 0xBD, 0x1C, 0xE6, 0x39,
+    0x9C, 0x81, 0xE0, 0x58, 0x05, 0x06, 0x3B, 0x03, 0x59, 0x4E, 0x82, 0xC9, 0xBD, 0x25, 0xC8, 0x7B,
+    0x40, 0x79, 0x5C, 0xE0, 0xFF, 0x3B, 0xCB, 0x45, 0x97, 0xB4, 0xE4, 0xF4, 0x52, 0x3E, 0xDC, 0x43,
+    0x15, 0x37, 0x23, 0x18, 0x4E, 0x4A, 0xB5, 0x8A, 0x37, 0x52, 0xDC, 0x51, 0x3A, 0x62, 0xEF, 0x13,
+    0x4A, 0x68, 0x34, 0xED, 0xC1, 0x3E, 0x14, 0xA1, 0xC2, 0x72, 0xD2, 0x47, 0xB8, 0x85, 0x96, 0x58,
+    0x6F, 0x4D, 0xBA, 0x34, 0xC8, 0xC2, 0x65, 0xD4, 0x40, 0xA8, 0xEC, 0x06, 0xBC, 0xF7, 0x3B, 0x88,
+    0x5D, 0x2A, 0x06, 0x59, 0x43, 0x3C, 0xA8, 0x7F, 0x91, 0x12, 0xDD, 0xF3, 0x61, 0x5D, 0x95, 0xD8,
+    0x00, 0xD1, 0xF9, 0x30, 0x83, 0xDC, 0xC4, 0x3F, 0xA1, 0x78, 0x80, 0xBB, 0x2A, 0x7D, 0xA5, 0x31,
+    0x93, 0x72, 0x88, 0x30, 0x65, 0x1A, 0x81, 0x61, 0x3A, 0x12, 0x41, 0xB5, 0x1B, 0x50, 0x8E, 0x99,
+    0x6B, 0x32, 0x2B, 0xB9, 0xAB, 0x3E, 0x0A, 0x53, 0xE3, 0x1B, 0xCB, 0x9A, 0x0E, 0xC0, 0x93, 0xA9,
+    0x76, 0xCB, 0x34, 0x7B, 0x45, 0x37, 0xE7, 0x65, 0xB6, 0x79, 0x99, 0xE9, 0xA8, 0x8C, 0xC6, 0x10,
+    0x95, 0x62, 0x98, 0xC5, 0x0C, 0xD9, 0x22, 0x0F, 0x8E, 0xC8, 0x83, 0x27, 0xB6, 0xF7, 0x21, 0xB1,
+    0xBE, 0xC7, 0x29, 0x03, 0x5B, 0xBB, 0xD3, 0xAB, 0x1B, 0x10, 0x62, 0xDA, 0x24, 0x1F, 0xB3, 0x86,
+    0x8A, 0x1A, 0xBC, 0x1B, 0x33, 0x72, 0xDC, 0x87, 0x71, 0x97, 0x7A, 0x18, 0xE3, 0x83, 0x77, 0x13,
+    0xCC, 0xC4, 0x4D, 0xA8, 0x7F, 0x06, 0x6A, 0x97, 0x6B, 0xBF, 0x3B, 0x08, 0x76, 0x3A, 0x39, 0xEC,
+    0x02, 0x25, 0xB0, 0x70, 0xAA, 0x11, 0x65, 0xAE, 0x74, 0x2B, 0x9A, 0x17, 0x75, 0xCC, 0x2B, 0xB9,
+    0x3C, 0xB5, 0xD7, 0x2B, 0xCF, 0x09, 0xE4, 0xF2, 0xDF, 0x2F, 0x7B, 0x1E, 0x55, 0xE2, 0xCA, 0xD3,
+    0x2B, 0x82, 0x1F, 0x9A, 0xF0, 0x52, 0x23, 0x66, 0x30, 0xBC, 0x48, 0xC6, 0x86, 0x79, 0xFC, 0xB4,
+    0x16, 0x7F, 0x9D, 0x46, 0x74, 0x49, 0xDC, 0x55, 0xF8, 0x6E, 0x3C, 0x44, 0x73, 0xDD, 0x41, 0xE5,
+    0xE8, 0xC5, 0x80, 0x20, 0x05, 0x16, 0xD0, 0xED, 0xFD, 0xAC, 0x8B, 0xF5, 0x40, 0x04, 0xAC, 0x76,
+    0xD4, 0x8D, 0xF8, 0xBD, 0xB3, 0x83, 0x33, 0x13, 0x4F, 0x57, 0x88, 0xD0, 0xCF, 0xA6, 0xB9, 0x71,
+    0x64, 0xC6, 0xB1, 0x6D, 0xC5, 0x27, 0x04, 0x83, 0x43, 0xD8, 0xD7, 0xE0, 0xC3, 0x14, 0x46, 0xB5,
+    0xFB, 0x2A, 0xCC, 0x93, 0x31, 0x97, 0xD1, 0x83, 0xAA, 0xB7, 0x50, 0xC6, 0x44, 0x4D, 0x6C, 0xD4,
+    0xBD, 0x5D, 0xCF, 0xBD, 0x74, 0x15, 0x06, 0x17, 0xF4, 0xB0, 0x60, 0x5E, 0x84, 0xEE, 0x98, 0xF8,
+    0xE3, 0xB3, 0xA2, 0x55, 0xA5, 0x8C, 0x05, 0xD7, 0x6F, 0xE5, 0xAE, 0xE0, 0x01, 0x5A, 0x44, 0x9B,
+    0x3E, 0x11, 0xFA, 0xC1, 0xD1, 0x8D, 0x88, 0x45, 0x3C, 0x71, 0x7E, 0xFB, 0x45, 0xA6, 0xCF, 0x73,
+    0x04, 0x10, 0x80, 0x68, 0x87, 0xE5, 0x8C, 0xFE, 0x39, 0x60, 0x80, 0xA7, 0xC7, 0x98, 0x15, 0x66,
+    0x85, 0xC8, 0x0C, 0x00, 0xCE, 0x26, 0x2F, 0x61, 0x56, 0xB1, 0xB2, 0xDD, 0x9A, 0xFF, 0x53, 0x7B,
+    0xB5, 0x5A, 0xC0, 0x12, 0xE6, 0xB5, 0xFA, 0xE3, 0x96, 0x56, 0x31, 0xFA, 0x14, 0x8F, 0xDF, 0x97,
+    0x1E, 0xA4, 0x68, 0x1E, 0x8D, 0x4F, 0x9D, 0xAA, 0x69, 0x25, 0x9F, 0x05, 0x1F, 0x55, 0x19, 0xFE,
+    0x4F, 0x57, 0x2E, 0xFF, 0x87, 0xB6, 0xB9, 0x08, 0x2B, 0x32, 0x34, 0x0F, 0x4B, 0x5A, 0xE7, 0x8C,
+    0x50, 0x00, 0x6B, 0x0C, 0x08, 0x52, 0xE6, 0x72, 0xFF, 0x00, 0x0D, 0x74, 0xBD, 0xDB, 0xA6, 0xDE,
+    0x68, 0xFD, 0x68, 0xEF, 0x0D, 0x2E, 0x8F, 0xBD, 0x81, 0xD9, 0x47, 0x42, 0xA6, 0x30, 0xB3, 0xBA,
+    0xC1, 0x27, 0xC4, 0x62, 0x03, 0x62, 0xD1, 0xB6, 0xF4, 0xF4, 0x2B, 0xB5, 0x78, 0x83, 0xC1, 0x27,
+    0x8C, 0xBD, 0x81, 0xD9, 0x47, 0xCC, 0x61, 0x8B, 0x4F, 0xC0, 0x3E, 0xA6, 0xDC, 0xC7, 0xD7, 0xC7,
+    0x68, 0x76, 0x44, 0xC3, 0x18, 0x5C, 0x69, 0x05, 0x2B, 0x47, 0xE2, 0x33, 0x30, 0x4B, 0x90, 0xE3,
+    0xC6, 0xA0, 0xC0, 0x1D, 0x81, 0x58, 0x54, 0x82, 0xAB, 0xA0, 0x80, 0x82, 0x85, 0x39, 0x87, 0x0C,
+    0x03, 0xD1, 0x14, 0xEE, 0x89, 0x13, 0x3C, 0x4B, 0xFC, 0x53, 0x90, 0xE3, 0xC1, 0xEE, 0x7A, 0x4C,
+    0xAC, 0xBC, 0x3E, 0x85, 0xF4, 0x49, 0x8F, 0xD6, 0xB7, 0xE4, 0xDD, 0xBC, 0xDF, 0xED, 0xDD, 0x84,
+    0x79, 0xFA, 0x0D, 0xC3, 0x3B, 0xF1, 0x05, 0x22, 0x95, 0x58, 0x5B, 0xEF, 0x0B, 0xF0, 0x5D, 0x41,
+    0x83, 0xC6, 0x21, 0x24, 0x58, 0x5E, 0x9C, 0x10, 0xAC, 0x3D, 0x4F, 0x92, 0x49, 0x3C, 0x21, 0xFB,
+    0x60, 0xCD, 0xA6, 0x2D, 0xB6, 0x7F, 0x8B, 0x51, 0x45, 0xA6, 0x3E, 0x17, 0x50, 0x7C, 0x89, 0xA8,
+    0xE2, 0x5A, 0xF8, 0x07, 0x77, 0x94, 0x3C, 0x4C, 0x0C, 0x28, 0x9B, 0x3A, 0x8D, 0x01, 0x4B, 0x65,
+    0xE0, 0xF5, 0xD4, 0x33, 0xA7, 0xBC, 0x51, 0xD4, 0x7B, 0xA3, 0x59, 0x2A, 0x8C, 0x2F, 0xFE, 0xF4,
+    0x2E, 0x03, 0x98, 0xFE, 0x27, 0x14, 0x93, 0xE4, 0x90, 0x9E, 0x19, 0x41, 0xC5, 0x70, 0x04, 0xAD,
+    0x72, 0x3A, 0x17, 0x7B, 0xE1, 0x55, 0x84, 0xC4, 0x61, 0xEE, 0x15, 0xDC, 0x14, 0x1F, 0xC2, 0x05,
+    0xC3, 0x9C, 0x71, 0x97, 0xF0, 0x9B, 0x8C, 0x90, 0xB0, 0x24, 0x4C, 0x42, 0x78, 0xEE, 0x38, 0xD2,
+    0x89, 0x5F, 0xA5, 0x4E, 0x27, 0xBA, 0x0F, 0xDA, 0x77, 0xEA, 0x97, 0x85, 0xFB, 0x82, 0x60, 0x65,
+    0x3B, 0x76, 0x2C, 0x45, 0xE6, 0x81, 0x0C, 0xC2, 0x74, 0x04, 0xEE, 0xC2, 0x86, 0x2C, 0x08, 0xBC,
+    0xA9, 0x48, 0x87, 0xCD, 0x2F, 0xE9, 0x67, 0xF9, 0xA5, 0xF8, 0xFF, 0xCA, 0xDA, 0x44, 0xBB, 0x03,
+    0x71, 0x2C, 0x41, 0x25, 0xA8, 0x8E, 0x7F, 0x19, 0xD1, 0x06, 0x2A, 0xF7, 0x14, 0x37, 0xFF, 0x21,
+    0x1A, 0x20, 0x70, 0x06, 0xD2, 0x00, 0xFF, 0x04, 0xA4, 0x32, 0x57, 0x59, 0x90, 0xA7, 0xB0, 0x71,
+    0x69, 0x1A, 0xBE, 0x3C, 0x48, 0x8B, 0x6F, 0x15, 0xA4, 0xFD, 0xCD, 0x00, 0xD2, 0x40, 0x81, 0x8C,
+    0x4A, 0xFC, 0xA1, 0x3A, 0x26, 0xE3, 0x51, 0x19, 0x9F, 0x84, 0x78, 0xBF, 0xAE, 0x9B, 0xE5, 0xEE,
+    0x0F, 0xF4, 0x65, 0x06, 0xDE, 0x91, 0xAC, 0x45, 0x06, 0x31, 0x13, 0xB2, 0x28, 0x38, 0x70, 0x3E,
+    0x00, 0x33, 0x7B, 0xEB, 0xDF, 0x6F, 0xE0, 0xD5, 0x48, 0xC0, 0x13, 0x8F, 0x90, 0xEC, 0x6B, 0x44,
+    0x89, 0x52, 0x64, 0xC5, 0x74, 0x76, 0xC6, 0xAC, 0x2F, 0xEB, 0x8F, 0xC4, 0x89, 0xCC, 0xE9, 0x1F,
+    0x8B, 0xF9, 0xC1, 0x14, 0xE2, 0x48, 0x68, 0x97, 0x49, 0x2B, 0x68, 0x32, 0xCE, 0xA4, 0x32, 0x66,
+    0xC8, 0x13, 0x48, 0xC2, 0xD8, 0xC3, 0xD0, 0x6C, 0xAE, 0x69, 0x24, 0x77, 0x98, 0x20, 0x44, 0xCC,
+    0x92, 0x98, 0x14, 0x31, 0x13, 0x86, 0x7A, 0x89, 0x56, 0x40, 0x3F, 0x02, 0x16, 0x31, 0x4C, 0xBC,
+    0x83, 0x3C, 0xD0, 0xA7, 0xC5, 0x38, 0xF1, 0xA7, 0xFD, 0x7B, 0xB2, 0x9E, 0x8D, 0x7E, 0x3D, 0x83,
+    0x1B, 0x7E, 0xB5, 0xBF, 0xCE, 0x5F, 0x73, 0xDD, 0xD7, 0x5F, 0x1F, 0xEE, 0xC3, 0x33, 0x0D, 0xE3,
+    0xB1, 0x40, 0x76, 0xCF, 0x93, 0xD3, 0x0F, 0x4F, 0x29, 0xAD, 0x0C, 0xB4, 0x3B, 0x21, 0x81, 0x4D,
+    0xF8, 0x9A, 0xE6, 0x4A, 0x21, 0x75, 0x69, 0x04, 0xDA, 0x68, 0x83, 0x7B, 0x84, 0x6A, 0x69, 0xE3,
+    0x21, 0x1F, 0xD0, 0xD0, 0xC6, 0x90, 0xF3, 0x31, 0x98, 0x77, 0x85, 0x21, 0xAA, 0x77, 0x0F, 0xE2,
+    0x2E, 0x0B, 0xD5, 0x3B, 0x08, 0xC3, 0x0C, 0x65, 0x78, 0x21, 0xD6, 0x2C, 0xD6, 0x2B, 0xC2, 0x89,
+    0xB5, 0x5A, 0x18, 0x71, 0xB0, 0x15, 0xFA, 0x2D, 0x6D, 0xD8, 0xA0, 0x0D, 0x17, 0xB4, 0x30, 0xC1,
+    0xEA, 0x84, 0x07, 0x76, 0x23, 0xBE, 0xC2, 0xAD, 0xC5, 0x59, 0xE8, 0xB7, 0x64, 0x43, 0xD6, 0x1D,
+    0xB3, 0x1F, 0x5F, 0x90, 0x4A, 0x80, 0xB5, 0xC1, 0x53, 0xF8, 0x08, 0x59, 0xB9, 0x16, 0x00, 0xAF,
+    0x39, 0x2D, 0xE7, 0xE4, 0x84, 0x98, 0x2D, 0x4F, 0xC7, 0x8E, 0xC1, 0xA5, 0x79, 0x4A, 0x9F, 0xAF,
+    0x09, 0x93, 0x09, 0xED, 0x99, 0x29, 0x3A, 0x6B, 0xB0, 0x74, 0x9C, 0x4D, 0x0D, 0x36, 0xB9, 0x39,
+    0x3A, 0xAD, 0x37, 0x81, 0x6C, 0x4C, 0xBD, 0x55, 0x34, 0x47, 0xC1, 0xD5, 0x86, 0xDC, 0x2C, 0x60,
+    0xB3, 0x48, 0xB9, 0x13, 0x27, 0x3E, 0xF6, 0x3E, 0x91, 0x40, 0x1E, 0x20, 0xBE, 0x94, 0x38, 0xDE,
+    0xC5, 0x7F, 0x58, 0x7B, 0x60, 0xDC, 0x55, 0x6C, 0xDC, 0x9D, 0xA6, 0xF5, 0x08, 0x5F, 0xEB, 0x44,
+    0x12, 0x2E, 0xB5, 0xFC, 0x2D, 0x06, 0x97, 0x71, 0x61, 0xBC, 0x40, 0x59, 0xC3, 0x2E, 0x10, 0x58,
+    0x82, 0x6B, 0x6E, 0x8D, 0x3D, 0xA9, 0x15, 0x05, 0x4D, 0x80, 0x11, 0x89, 0x13, 0xC5, 0x67, 0x30,
+    0x21, 0xC8, 0xE5, 0xCF, 0x18, 0x3F, 0x64, 0x73, 0x7A, 0x65, 0xB2, 0x8A, 0x39, 0xA1, 0x41, 0x73,
+    0x0B, 0xDD, 0x9A, 0x32, 0xE1, 0x17, 0xE4, 0x61, 0x98, 0xCB, 0x98, 0x99, 0xD1, 0x70, 0x94, 0x3C,
+    0xF5, 0x2A, 0x72, 0x54, 0x08, 0x57, 0x6E, 0x47, 0xD7, 0x01, 0x73, 0x19, 0x31, 0x8B, 0x44, 0x06,
+    0xA4, 0x99, 0x49, 0xD5, 0x10, 0x2E, 0x75, 0xDC, 0x6A, 0xBF, 0x7E, 0x80, 0x1B, 0x93, 0x87, 0x94,
+    0xA9, 0xD9, 0x97, 0xEE, 0x27, 0x58, 0x1F, 0x35, 0x2E, 0xD0, 0x9C, 0x5B, 0x7A, 0x05, 0xED, 0xAE,
+    0x27, 0x36, 0x37, 0x84, 0xC5, 0x85, 0x8D, 0x45, 0x44, 0x14, 0x8B, 0x8D, 0x8D, 0x4F, 0xE1, 0x37,
+    0x1D, 0x36, 0x5E, 0xED, 0x57, 0x93, 0xB5, 0xCE, 0xC0, 0x37, 0x68, 0xEE, 0x79, 0x31, 0xA2, 0xB4,
+    0xAD, 0x13, 0x76, 0x02, 0xF7, 0xCC, 0x5D, 0x56, 0xF3, 0x9D, 0x56, 0xFF, 0xA2, 0xA0, 0x03, 0xA5,
+    0xFB, 0x0F, 0x72, 0xB0, 0x36, 0xD7, 0xC2, 0x3E, 0xF9, 0x24, 0x29, 0x18, 0x10, 0x23, 0x82, 0x0C,
+    0xDE, 0x61, 0xA6, 0xA8, 0x4F, 0xAA, 0xCC, 0xBE, 0x4C, 0xD9, 0xC8, 0x46, 0x10, 0x27, 0x07, 0xD8,
+    0xC7, 0xCB, 0x83, 0x4C, 0x56, 0x71, 0x65, 0x1D, 0x22, 0x5D, 0x8B, 0x27, 0x8E, 0x23, 0xB1, 0xFC,
+    0x09, 0x2D, 0xBF, 0xF7, 0x61, 0x67, 0xDC, 0x2C, 0x7F, 0x9E, 0x58, 0x01, 0x22, 0xF2, 0x0E, 0x76,
+    0x5B, 0x88, 0x7C, 0xB0, 0x2D, 0xB5, 0x5A, 0x5E, 0x01, 0xF7, 0xE0, 0x91, 0x52, 0x65, 0x62, 0xB8,
+    0x27, 0xD3, 0x2B, 0xA5, 0x3F, 0xC9, 0xDF, 0x70, 0xFB, 0xFF, 0x93, 0xEE, 0x9D, 0x13, 0x93, 0x4F,
+    0x7D, 0x32, 0x6A, 0xEE, 0x05, 0x98, 0x72, 0xC2, 0x5B, 0xBF, 0x02, 0x43, 0x2A, 0x3A, 0x1E, 0x72,
+    0x1D, 0x98, 0x1E, 0x4E, 0xC7, 0xCF, 0xE9, 0x8A, 0xF0, 0xF8, 0x28, 0xCC, 0x4E, 0x28, 0xFF, 0x57,
+    0xB5, 0x49, 0x73, 0xC9, 0xE2, 0xFF, 0x82, 0x8B, 0x4F, 0x46, 0x75, 0x98, 0x39, 0x25, 0xEE, 0x82,
+    0x73, 0x92, 0xC5, 0xFF, 0x04, 0x96, 0x03, 0x8B, 0x8C, 0xDF, 0x36, 0xC1, 0x9F, 0xE8, 0x40, 0xBE,
+    0x0D, 0xBB, 0xDF, 0x18, 0x34, 0xC5, 0x9F, 0x7F, 0xA3, 0x76, 0x44, 0xB3, 0x20, 0x80, 0xCC, 0xAA,
+    0xDD, 0x23, 0x65, 0x78, 0xB2, 0x6A, 0x66, 0x9C, 0x32, 0x3E, 0x54, 0x9C, 0x83, 0xD0, 0xC6, 0x6E,
+    0xBE, 0x5D, 0xD9, 0x55, 0xCA, 0xD4, 0xB2, 0xDD, 0x69, 0x78, 0x1B, 0x9A, 0x69, 0x52, 0xE2, 0x7C,
+    0xD2, 0xD2, 0xE5, 0xBA, 0x3F, 0x6D, 0x70, 0xD9, 0xE3, 0x5D, 0x6A, 0x30, 0xFB, 0x71, 0xFF, 0x50,
+    0x1D, 0x64, 0xD9, 0x89, 0x13, 0x76, 0xE5, 0x5D, 0xCD, 0x10, 0xDA, 0x94, 0xCE, 0x24, 0x2A, 0x78,
+    0x62, 0xC5, 0x01, 0x97, 0xB2, 0xCE, 0x8B, 0xF4, 0x2C, 0x18, 0x05, 0xD7, 0xF1, 0x47, 0xF0, 0x04,
+    0x62, 0xC6, 0x46, 0xED, 0xD1, 0x51, 0x0B, 0xCD, 0xEF, 0x8E, 0x94, 0x81, 0x70, 0x69, 0xC7, 0xA2,
+    0xB5, 0x98, 0x42, 0x05, 0x3C, 0xFE, 0x57, 0xC0, 0x19, 0xE7, 0xBE, 0x6C, 0x08, 0xA1, 0x91, 0x6C,
+    0x41, 0x82, 0xCD, 0x88, 0xE0, 0x50, 0xE1, 0x6C, 0xD3, 0x47, 0xB1, 0xA1, 0x4D, 0x5A, 0x87, 0x45,
+    0x58, 0x8C, 0x1F, 0xB6, 0x57, 0x65, 0x6A, 0x3F, 0x20, 0x49, 0x88, 0xE7, 0xBB, 0x97, 0xE5, 0x4F,
+    0xB7, 0x33, 0xE7, 0xCC, 0xE1, 0x99, 0xA5, 0xA0, 0xF1, 0xA0, 0x4A, 0x4E, 0x61, 0xD7, 0x5E, 0xE4,
+    0x54, 0x7B, 0xC1, 0x9C, 0xB3, 0xCA, 0xBD, 0x0A, 0x15, 0x83, 0x0A, 0x7A, 0xEF, 0xC3, 0x91, 0xBD,
+    0x05, 0x8F, 0x06, 0x01, 0x0B, 0x32, 0xC2, 0x04, 0xDC, 0x99, 0x40, 0x85, 0x77, 0x2C, 0x1D, 0x56,
+    0xA2, 0xA4, 0xCA, 0xB3, 0x87, 0x61, 0x1B, 0x04, 0x44, 0xED, 0x22, 0xF6, 0xDE, 0x43, 0x7F, 0xBB,
+    0x8F, 0x9B, 0x7F, 0x94, 0x29, 0xA6, 0x12, 0xA2, 0x30, 0xC2, 0xBA, 0xD4, 0x2A, 0x96, 0xA6, 0x00,
+    0x2E, 0x08, 0xDF, 0xDC, 0xA6, 0x27, 0x69, 0xC7, 0x61, 0x90, 0x80, 0x70, 0x95, 0x70, 0xC7, 0x83,
+    0x92, 0x73, 0x1C, 0x41, 0xF5, 0xB0, 0x2A, 0x6C, 0xCB, 0xAE, 0xCE, 0xE3, 0x3E, 0x74, 0xBB, 0xA0,
+    0x80, 0xFB, 0xD2, 0x7D, 0x10, 0xBC, 0xA3, 0x69, 0x09, 0x11, 0x2B, 0x63, 0xC8, 0xFE, 0x08, 0x62,
+    0xD4, 0x61, 0xD6, 0x10, 0x7C, 0xD7, 0xC9, 0x7E, 0xA5, 0xCB, 0x54, 0xED, 0x31, 0xB0, 0x49, 0x88,
+    0x53, 0x87, 0x83, 0xC6, 0x58, 0x3F, 0xBB, 0xB6, 0x6B, 0xA7, 0x76, 0x44, 0x27, 0xDD, 0x8D, 0xD5,
+    0x12, 0xC1, 0x79, 0x31, 0x66, 0x96, 0xB0, 0x8B, 0x0C, 0x0B, 0x3A, 0x88, 0xA4, 0x31, 0x61, 0xB3,
+    0x2F, 0x19, 0xD1, 0x6B, 0xFC, 0xDC, 0x35, 0x8C, 0x2D, 0xC7, 0x62, 0x9B, 0x11, 0x3D, 0x19, 0xD1,
+    0xA5, 0xD6, 0x40, 0x6F, 0x20, 0xB6, 0x30, 0x54, 0xBD, 0xE8, 0xCD, 0x1C, 0xDE, 0x9A, 0xA8, 0xA0,
+    0x81, 0xD3, 0xB0, 0x3B, 0x58, 0x64, 0x9B, 0x66, 0xCB, 0xA1, 0xE1, 0x77, 0x1A, 0x30, 0x07, 0x51,
+    0x77, 0xA9, 0xB8, 0x57, 0x8A, 0xCF, 0x57, 0x5C, 0x00, 0xCC, 0x0E, 0x07, 0x98, 0x08, 0x9A, 0x21,
+    0xAA, 0xF2, 0xC0, 0x1C, 0x6B, 0x69, 0x76, 0xC5, 0xED, 0xC2, 0x46, 0xB5, 0xFF, 0x15, 0x56, 0x3A,
+    0x13, 0xC3, 0x2E, 0x66, 0x1D, 0x7C, 0xA2, 0xC9, 0xB3, 0xEB, 0x11, 0xE6, 0x84, 0x71, 0x2F, 0x7B,
+    0x63, 0xB3, 0x8E, 0x85, 0xC1, 0x55, 0x48, 0xE2, 0x37, 0x9B, 0x78, 0x87, 0xF0, 0xE7, 0x4C, 0x08,
+    0x4C, 0x69, 0x54, 0xE3, 0x43, 0xA3, 0xBC, 0x0C, 0x77, 0x44, 0xE3, 0xEF, 0x25, 0x93, 0x84, 0xB4,
+    0xD1, 0xA8, 0x6F, 0x6C, 0xD2, 0x28, 0x92, 0xB5, 0x33, 0x22, 0x5D, 0xBA, 0x00, 0x61, 0xBF, 0x5D,
+    0x2B, 0x41, 0x19, 0x7C, 0x96, 0xD3, 0xBA, 0x0D, 0x46, 0xD8, 0x55, 0xAF, 0x1C, 0x58, 0x45, 0xC6,
+    0xF2, 0x43, 0x9A, 0x7C, 0x32, 0xD6, 0xB0, 0xD7, 0xC8, 0x24, 0xA5, 0xB2, 0xA5, 0x5C, 0x0E, 0x66,
+    0x0F, 0x1B, 0xF5, 0xA2, 0xC7, 0x8D, 0x6A, 0x2D, 0x9A, 0xF1, 0xE3, 0x30, 0x2C, 0xC7, 0x21, 0x21,
+    0xE7, 0x60, 0x99, 0x98, 0x5D, 0x2D, 0x54, 0x78, 0x11, 0x0E, 0xFD, 0x67, 0x89, 0xF2, 0xAE, 0x40,
+    0xD4, 0xE0, 0x00, 0xC9, 0x1E, 0x87, 0x51, 0x66, 0xCE, 0x48, 0x93, 0xB1, 0xA5, 0xFA, 0xE7, 0xC4,
+    0x7F, 0xD5, 0x90, 0x61, 0x9D, 0xFA, 0x11, 0xB2, 0xAD, 0xF6, 0x04, 0x83, 0x8A, 0x8A, 0x10, 0xDA,
+    0x11, 0x10, 0x2A, 0x78, 0x60, 0xEB, 0x0B, 0xBF, 0x32, 0x30, 0x19, 0x9B, 0x57, 0x07, 0xBF, 0xE9,
+    0x80, 0x13, 0x29, 0xE9, 0xD8, 0x56, 0x91, 0xF7, 0x30, 0xA1, 0x69, 0x85, 0xEE, 0x88, 0x71, 0xA5,
+    0xA1, 0xD4, 0x10, 0xB4, 0x38, 0x62, 0xF2, 0x22, 0x3E, 0x00, 0xE6, 0x63, 0x61, 0x2D, 0x76, 0x13,
+    0x58, 0x63, 0x19, 0xF2, 0x7A, 0x55, 0x30, 0x8A, 0x2D, 0xF2, 0x43, 0x2D, 0x50, 0x5B, 0xA8, 0x06,
+    0x6A, 0xAF, 0x27, 0x30, 0x5E, 0x3C, 0xAB, 0xBB, 0x6E, 0x76, 0x55, 0xED, 0xB0, 0x39, 0x55, 0x7A,
+    0x12, 0xB4, 0xBD, 0x8E, 0xA0, 0xE8, 0x3D, 0x98, 0x4B, 0xAA, 0x11, 0xEE, 0x62, 0x60, 0x0E, 0x35,
+    0x50, 0xFB, 0x41, 0x50, 0x05, 0x11, 0x2F, 0x74, 0xE4, 0x67, 0x71, 0x9E, 0x22, 0x52, 0xBE, 0x49,
+    0x4D, 0xDF, 0x02, 0x4D, 0x6F, 0xA0, 0xAF, 0xB5, 0x41, 0x47, 0xB3, 0xA5, 0x89, 0x1C, 0xE8, 0x0A,
+    0xD7, 0x19, 0xA7, 0x43, 0xF3, 0xAC, 0xC5, 0xB0, 0x86, 0x42, 0x0C, 0x3B, 0xD7, 0xCF, 0xEA, 0xC1,
+    0x3F, 0x7B, 0x1B, 0x3A, 0x73, 0x34, 0x7C, 0xDF, 0x61, 0x7A, 0x3E, 0x7E, 0xE8, 0xFB, 0xC8, 0x4C,
+    0xC1, 0x4F, 0x50, 0xD9, 0x19, 0xFC, 0x97, 0x5E, 0x67, 0xBF, 0x37, 0xED, 0xB4, 0xAC, 0x2B, 0xC6,
+    0xBA, 0x42, 0x49, 0x13, 0x61, 0x75, 0x10, 0xE1, 0xF4, 0xA0, 0x06, 0xF9, 0xE9, 0xB3, 0xE9, 0xBF,
+    0xD4, 0x62, 0x8D, 0x74, 0x45, 0x7B, 0x34, 0xA8, 0xED, 0x1D, 0x9A, 0x79, 0xBB, 0xCC, 0x2C, 0x96,
+    0x2E, 0x3E, 0xDB, 0x63, 0xF7, 0xF1, 0xEE, 0x33, 0xC7, 0x04, 0xC1, 0x4E, 0xC6, 0xFB, 0x65, 0x47,
+    0x6A, 0x66, 0x69, 0x89, 0x99, 0x54, 0xB5, 0x7F, 0xA9, 0x55, 0xF3, 0x4E, 0xA1, 0x1E, 0x0E, 0x12,
+    0x53, 0x25, 0xC1, 0xDF, 0xDC, 0xCF, 0xE2, 0x8C, 0xC5, 0x04, 0x86, 0x4F, 0xE0, 0x3A, 0xAE, 0x88,
+    0xB5, 0xD7, 0xD3, 0x64, 0x88, 0xB3, 0x97, 0x16, 0x29, 0xC4, 0x88, 0xF5, 0xFC, 0xB6, 0x0F, 0xF5,
+    0xFD, 0xBC, 0x0F, 0xF8, 0x31, 0x3F, 0x46, 0xC2, 0x24, 0x5D, 0x73, 0xFC, 0xB1, 0x76, 0x59, 0x28,
+    0xD0, 0x52, 0x2E, 0x48, 0x1F, 0x2B, 0x20, 0xE8, 0x1A, 0x5F, 0xC6, 0x5F, 0xA8, 0xFE, 0xEF, 0x34,
+    0x1E, 0x9E, 0xA6, 0x8B, 0x89, 0x75, 0x5C, 0x34, 0xC1, 0xA0, 0x78, 0xD2, 0xE9, 0x92, 0x0E, 0x7C,
+    0x6D, 0xF8, 0x0B, 0x4A, 0xA6, 0xC6, 0x9E, 0xA7, 0xF2, 0xA1, 0xBC, 0x06, 0xBF, 0x68, 0x79, 0x7F,
+    0xEF, 0x9A, 0x22, 0x78, 0x35, 0x58, 0xF2, 0xD7, 0x5A, 0x80, 0x08, 0xAD, 0x66, 0xA5, 0x1A, 0x88,
+    0x7D, 0x7C, 0x02, 0x78, 0x45, 0x4F, 0x0A, 0x4E, 0x47, 0x21, 0xCF, 0x5C, 0x5B, 0x77, 0x04, 0x56,
+    0xA8, 0x1B, 0xEB, 0xE4, 0xCE, 0x15, 0x58, 0xB1, 0x11, 0x75, 0xA3, 0xF1, 0x8A, 0x94, 0x1A, 0x92,
+    0x31, 0xAA, 0x22, 0xC7, 0x9D, 0x4A, 0x30, 0xFC, 0x06, 0x47, 0x0F, 0x62, 0x0F, 0xAB, 0xF3, 0x4B,
+    0x26, 0x73, 0xE9, 0x2B, 0xB0, 0x06, 0x8C, 0x2D, 0x7D, 0x06, 0x35, 0x24, 0x8B, 0x9F, 0x87, 0x90,
+    0xC3, 0xE6, 0x47, 0xE3, 0xCA, 0xDD, 0x69, 0xD2, 0xC4, 0x2C, 0x0F, 0x15, 0x89, 0xD6, 0x99, 0x43,
+    0x6D, 0x06, 0x40, 0xE3, 0x8A, 0xD4, 0x51, 0x58, 0xD7, 0x28, 0xAD, 0x20, 0x7A, 0xD4, 0x49, 0x54,
+    0x40, 0x94, 0x59, 0x81, 0x3D, 0xE1, 0x84, 0x3B, 0x12, 0x4E, 0x12, 0xA5, 0x81, 0x23, 0x92, 0xD4,
+    0x3C, 0x7A, 0xFB, 0xC0, 0x41, 0x42, 0x6D, 0x27, 0x53, 0x27, 0xA0, 0xB7, 0x27, 0x80, 0x0F, 0xEE,
+    0xB7, 0x6E, 0x7B, 0x4E, 0x07, 0xC4, 0x5B, 0x3D, 0xBF, 0xC9, 0xAE, 0xAD, 0x08, 0xA8, 0x2D, 0x49,
+    0xBA, 0x05, 0xB9, 0xDD, 0x68, 0x18, 0xD2, 0x67, 0x2B, 0xBB, 0x83, 0x77, 0x82, 0x31, 0xA7, 0x7F,
+    0xD8, 0xAC, 0xE0, 0x9B, 0x95, 0xBC, 0x57, 0xC6, 0x1E, 0x88, 0xF7, 0x45, 0xC0, 0x29, 0x84, 0x60,
+    0x56, 0xD1, 0x9A, 0xB2, 0x8E, 0x1B, 0x0D, 0x18, 0x45, 0x31, 0xB9, 0x05, 0x2C, 0xA7, 0x04, 0xCC,
+    0xC9, 0xBF, 0x43, 0xF0, 0x97, 0x57, 0x24, 0x22, 0xE5, 0xAC, 0xC3, 0x8C, 0x00, 0x75, 0x0A, 0xA8,
+    0x4E, 0x8D, 0x61, 0xDD, 0xB5, 0x2E, 0x23, 0xEF, 0x5D, 0xC6, 0xDB, 0x91, 0x64, 0x1C, 0xBE, 0xC8,
+    0x65, 0xA8, 0x9D, 0xF0, 0xA2, 0xA0, 0xD7, 0x2E, 0x03, 0xE5, 0x14, 0x1E, 0xCC, 0xEB, 0x16, 0xE5,
+    0x88, 0x4A, 0xE5, 0x26, 0x01, 0x00, 0x75, 0xD9, 0x02, 0x46, 0xCC, 0x63, 0x3D, 0xFB, 0x15, 0x70,
+    0xFC, 0x8F, 0x6B, 0xC9, 0x11, 0x9B, 0x1F, 0xE3, 0xB7, 0x55, 0x44, 0x25, 0x30, 0xE6, 0xC0, 0x98,
+    0x00, 0x63, 0xE8, 0x88, 0x76, 0x09, 0x64, 0x8C, 0x0C, 0x1C, 0x49, 0xC2, 0xE5, 0x2C, 0x0C, 0xA2,
+    0x2D, 0x5B, 0x7A, 0xA5, 0x49, 0xE9, 0x64, 0x95, 0x38, 0x58, 0x4A, 0x88, 0x64, 0x9E, 0xF8, 0x3F,
+    0x30, 0x2F, 0x15, 0x62, 0xF1, 0xF8, 0x69, 0xAE, 0x0D, 0xE4, 0x93, 0x39, 0xDB, 0xC7, 0x2A, 0x00,
+    0x05, 0xE8, 0x13, 0xD1, 0xB5, 0xF9, 0x50, 0x38, 0xDD, 0x6B, 0xD5, 0x31, 0x9B, 0x72, 0xB6, 0xD7,
+    0xD9, 0x9F, 0x7A, 0x6A, 0x7F, 0x04, 0x37, 0x19, 0xE0, 0x04, 0xD0, 0x44, 0xD3, 0xE3, 0x49, 0x4D,
+    0x75, 0x9B, 0x38, 0x8C, 0x5D, 0x92, 0x1E, 0xD8, 0x43, 0x11, 0x01, 0x7C, 0xFA, 0x0C, 0xF0, 0xE7,
+    0x28, 0x7D, 0x11, 0x01, 0x54, 0x90, 0x03, 0x41, 0x81, 0x78, 0x42, 0x28, 0x78, 0xA7, 0xC4, 0xFB,
+    0x8C, 0x20, 0x6A, 0x5C, 0xC1, 0xC6, 0x62, 0x2D, 0x59, 0xAE, 0xC9, 0x9A, 0x9B, 0xE5, 0x72, 0x4E,
+    0xF8, 0x65, 0x26, 0x62, 0x2B, 0x49, 0xC4, 0x02, 0xE1, 0xAE, 0x2B, 0x6F, 0x63, 0x75, 0x03, 0xF7,
+    0x17, 0x9C, 0xA7, 0xB7, 0xA9, 0xBD, 0x65, 0x35, 0x70, 0x86, 0x33, 0x87, 0xC9, 0x64, 0x66, 0x47,
+    0xD2, 0x73, 0xE3, 0xB2, 0x83, 0x2C, 0x8E, 0x02, 0x3C, 0xD4, 0x57, 0x24, 0x87, 0x02, 0x7D, 0xA5,
+    0x10, 0x2B, 0x4A, 0xF1, 0x17, 0xE0, 0x9C, 0xEC, 0x06, 0x38, 0xA7, 0xCF, 0xC0, 0xE5, 0x86, 0x79,
+    0xCD, 0xB8, 0x2E, 0x7A, 0xCB, 0xF8, 0x54, 0xF4, 0x80, 0x82, 0x41, 0x28, 0xCF, 0x62, 0x62, 0x71,
+    0xDB, 0x58, 0xD9, 0x44, 0xCD, 0xD1, 0x77, 0x95, 0x97, 0x14, 0x78, 0x78, 0x22, 0x5E, 0xF4, 0x2E,
+    0xA1, 0x97, 0x5B, 0x5A, 0xE7, 0x2F, 0xB1, 0x4E, 0xA7, 0x4F, 0x16, 0x6A, 0xB3, 0x3D, 0x16, 0xB3,
+    0x71, 0x93, 0x44, 0xA1, 0xC3, 0x34, 0x4D, 0x47, 0xA1, 0xEE, 0xB0, 0xA1, 0xFF, 0x58, 0x4A, 0x35,
+    0x52, 0x80, 0x53, 0x41, 0x24, 0x65, 0xBE, 0x80, 0x0A, 0x90, 0xF2, 0x42, 0xE9, 0x5A, 0x30, 0x29,
+    0xE9, 0x79, 0x53, 0xAD, 0x83, 0x13, 0xD5, 0x23, 0x1D, 0x31, 0x9F, 0x69, 0xEB, 0x83, 0x54, 0x60,
+    0x2F, 0x7E, 0x86, 0x86, 0x63, 0x6F, 0xF8, 0x43, 0x2A, 0xD0, 0xF1, 0xF0, 0xBF, 0x48, 0xE2, 0x52,
+    0xF0, 0x06, 0xA2, 0x61, 0x29, 0x3F, 0x64, 0x26, 0x23, 0xAB, 0x42, 0xA2, 0xAD, 0x68, 0x87, 0xFA,
+    0x87, 0x08, 0x9F, 0xB1, 0x7C, 0x75, 0xA4, 0x08, 0x92, 0x20, 0x72, 0x4B, 0x3F, 0xF3, 0xC0, 0x0B,
+    0x3F, 0xF3, 0x61, 0x23, 0xBC, 0x6C, 0xAF, 0x8C, 0xF3, 0x00, 0x6A, 0x5E, 0x76, 0x16, 0x63, 0x98,
+    0x97, 0x6A, 0x54, 0xE9, 0x9F, 0x02, 0xB1, 0xFC, 0xF6, 0x8D, 0x77, 0x22, 0x88, 0x3B, 0x2B, 0x1E,
+    0x23, 0x56, 0x20, 0x61, 0xEE, 0xDD, 0x42, 0x8A, 0xC3, 0x78, 0xC0, 0x32, 0x73, 0x33, 0x94, 0xF0,
+    0xAD, 0xAB, 0x1B, 0x2F, 0x32, 0xFF, 0x53, 0xAA, 0xBD, 0x3E, 0xEE, 0xFD, 0x76, 0x90, 0xBF, 0x38,
+    0xE4, 0x66, 0x69, 0x92, 0xE2, 0x77, 0x99, 0x92, 0x61, 0xB9, 0x2A, 0x1D, 0x6A, 0x90, 0xD3, 0x25,
+    0x4E, 0xBB, 0x55, 0x73, 0xDD, 0x6A, 0xC5, 0x64, 0x79, 0x82, 0x6D, 0x9D, 0x65, 0xFE, 0xB6, 0x91,
+    0xEC, 0x5C, 0xBB, 0x46, 0x85, 0xD2, 0xA2, 0x5C, 0xAD, 0xD8, 0x81, 0xC6, 0xA6, 0x72, 0x55, 0x0E,
+    0x14, 0x8A, 0x11, 0x05, 0x14, 0xAA, 0x94, 0xC8, 0x40, 0xA0, 0x81, 0x40, 0xA8, 0xDC, 0xC4, 0x0B,
+    0x70, 0x93, 0xEB, 0x1A, 0xA1, 0xAD, 0x75, 0x9D, 0xDC, 0x48, 0x32, 0x0B, 0xC7, 0x81, 0xC5, 0x87,
+    0x1F, 0x49, 0x9D, 0x80, 0x7B, 0xE3, 0x41, 0xCE, 0xD5, 0x05, 0x93, 0xA0, 0x38, 0x67, 0x02, 0x03,
+    0x65, 0x32, 0xE7, 0xBC, 0x98, 0xF4, 0x8C, 0xC9, 0xCA, 0xC6, 0xCF, 0xE9, 0xE7, 0xE8, 0x48, 0xA3,
+    0x5E, 0x35, 0xA7, 0x2E, 0xA4, 0x27, 0x92, 0x74, 0x7A, 0x9C, 0x29, 0x69, 0x76, 0x28, 0x9C, 0x6C,
+    0xAE, 0x8B, 0x10, 0xF5, 0x44, 0xB1, 0x9E, 0x5E, 0x0A, 0x84, 0x17, 0xF6, 0xDD, 0x67, 0xC2, 0x25,
+    0x42, 0x40, 0x51, 0x33, 0x93, 0xC2, 0xFD, 0x80, 0xB2, 0xE5, 0xAC, 0x6B, 0xFA, 0x0C, 0x8C, 0x37,
+    0xD2, 0x8F, 0x57, 0xC4, 0x78, 0x30, 0x83, 0x43, 0x0B, 0xE7, 0x15, 0x1C, 0x69, 0x2E, 0xB6, 0x40,
+    0xED, 0x82, 0xFC, 0x41, 0x16, 0x70, 0x3A, 0xE6, 0x61, 0x36, 0x79, 0xD1, 0xD8, 0x90, 0x19, 0x4D,
+    0xB0, 0xD6, 0x2A, 0x47, 0x8F, 0xC6, 0x52, 0xED, 0x96, 0x71, 0x5E, 0xE8, 0x3B, 0x2B, 0xA3, 0xD4,
+    0x02, 0xEC, 0xF7, 0xDE, 0xA3, 0xBD, 0xFA, 0xE1, 0x9B, 0x34, 0xB0, 0xFE, 0xB3, 0x18, 0xF7, 0x06,
+    0xCC, 0x9C, 0x1E, 0x0F, 0x69, 0x27, 0xCB, 0x10, 0xDC, 0x19, 0x15, 0x27, 0x40, 0xD2, 0x5C, 0x79,
+    0xC1, 0x05, 0xE7, 0xAA, 0x57, 0x43, 0x4E, 0x3D, 0x13, 0x0D, 0x29, 0x71, 0x81, 0x76, 0xEF, 0x71,
+    0xA6, 0x37, 0x68, 0xF2, 0x1E, 0xE1, 0x3C, 0xAF, 0x54, 0x06, 0x30, 0xA9, 0x3F, 0x66, 0xB9, 0xE8,
+    0x83, 0x5F, 0xC3, 0x43, 0x5D, 0xFA, 0xA4, 0x55, 0xCE, 0x33, 0x45, 0xA7, 0xFC, 0x67, 0x7F, 0xAA,
+    0x93, 0xF8, 0x8D, 0x37, 0x20, 0x47, 0xCC, 0xAF, 0x91, 0xB0, 0xE5, 0x8E, 0x59, 0x1E, 0x23, 0x51,
+    0xD2, 0x7A, 0x03, 0xF4, 0xF1, 0x9E, 0xC9, 0x68, 0x38, 0x2F, 0x18, 0x83, 0xEF, 0xD1, 0xF8, 0xE3,
+    0x79, 0x7B, 0xFB, 0xEB, 0x71, 0x7E, 0x57, 0xBA, 0x50, 0x78, 0x7D, 0xEE, 0xF1, 0xB5, 0x2B, 0xD4,
+    0x13, 0x65, 0xBF, 0xF9, 0xBA, 0xC9, 0x3F, 0x3F, 0xF6, 0x7A, 0x4D, 0xD5, 0xF2, 0xBD, 0x4B, 0x0D,
+    0x15, 0x73, 0xDE, 0x3F, 0xC5, 0xEC, 0x80, 0x3A, 0x16, 0x1C, 0x92, 0x04, 0x57, 0x19, 0x8E, 0x28,
+    0x7B, 0x8F, 0x54, 0xA1, 0xC3, 0x1D, 0x7A, 0xA1, 0x39, 0xE1, 0xEB, 0x0C, 0x7B, 0x03, 0x9B, 0x8E,
+    0xBD, 0x71, 0xE4, 0x3B, 0x9E, 0x8C, 0x7B, 0x25, 0x0F, 0xB3, 0xAF, 0x63, 0xCD, 0x19, 0x71, 0xB0,
+    0xB3, 0x71, 0x7A, 0x43, 0xCB, 0xDE, 0xE8, 0x08, 0x12, 0x18, 0x32, 0xA5, 0xB2, 0x6B, 0x3F, 0x0D,
+    0xFB, 0xFC, 0x53, 0x34, 0x18, 0x67, 0x5E, 0x85, 0x1C, 0x5E, 0xAC, 0x20, 0xC5, 0xE1, 0x9B, 0x4D,
+    0x63, 0x6A, 0x34, 0x93, 0x31, 0x95, 0xEE, 0x83, 0x30, 0xA2, 0x15, 0xA2, 0x26, 0x92, 0xD4, 0x79,
+    0xE9, 0x08, 0x31, 0x95, 0xDF, 0x7C, 0xE8, 0xD1, 0xB2, 0xBB, 0x2E, 0x25, 0x3F, 0xDA, 0x30, 0x52,
+    0xFE, 0x6B, 0x0D, 0xAC, 0x6A, 0x78, 0x12, 0x78, 0x40, 0xA5, 0x23, 0x4A, 0x48, 0x47, 0x7D, 0x85,
+    0x01, 0xAC, 0xBC, 0x7C, 0xAE, 0xF2, 0xD7, 0x5D, 0xE8, 0x6D, 0xCA, 0x10, 0xD5, 0x5A, 0x02, 0xA4,
+    0x96, 0xBC, 0x0A, 0x66, 0x58, 0x5F, 0x3A, 0xCF, 0xBC, 0xBA, 0x45, 0xDB, 0xDC, 0x49, 0xE1, 0x39,
+    0xFC, 0xF7, 0x14, 0xD5, 0x54, 0x7A, 0x7B, 0x28, 0x5B, 0x2A, 0xF6, 0x5F, 0xC7, 0xBF, 0xB6, 0xC1,
+    0x25, 0xE6, 0x41, 0x83, 0x4B, 0x70, 0x24, 0x55, 0x78, 0xAA, 0x86, 0x2E, 0xA4, 0x3F, 0x85, 0x80,
+    0x1E, 0x64, 0x74, 0xAF, 0x44, 0x82, 0xE1, 0x82, 0xB0, 0x47, 0x72, 0x65, 0xFF, 0x4D, 0x04, 0x4D,
+    0xA1, 0x8B, 0xC9, 0x46, 0xE2, 0xEE, 0xDD, 0xC2, 0x49, 0xB8, 0x47, 0x76, 0xE9, 0x9B, 0x3C, 0x6C,
+    0x73, 0xDC, 0xC8, 0x46, 0x37, 0xEC, 0x11, 0x33, 0x92, 0xCF, 0x7D, 0xAF, 0x4B, 0x53, 0x66, 0xB2,
+    0x4C, 0x16, 0x88, 0x49, 0xFC, 0x0B, 0x1E, 0x6B, 0x7C, 0x7E, 0xD6, 0x79, 0x2C, 0x2A, 0x84, 0x49,
+    0xEB, 0xB2, 0x6D, 0x28, 0xB6, 0x10, 0x5E, 0x83, 0xF3, 0x00, 0xAB, 0x4E, 0x89, 0x3D, 0x6A, 0x1E,
+    0x68, 0xED, 0xF5, 0x58, 0xAF, 0x16, 0xA1, 0x3E, 0xA0, 0xB1, 0x47, 0x20, 0x32, 0xF2, 0xA5, 0xC3,
+    0x22, 0x67, 0xE6, 0x7A, 0xE9, 0x88, 0x24, 0x35, 0x93, 0x05, 0xEE, 0x93, 0x9F, 0x55, 0xDC, 0x28,
+    0xF7, 0xD3, 0x8C, 0x3B, 0xF5, 0x8A, 0x36, 0x6A, 0x44, 0xC7, 0x55, 0x7A, 0x1F, 0x34, 0x50, 0xFA,
+    0x22, 0xB8, 0x54, 0x5F, 0xA0, 0x26, 0x1D, 0xAA, 0x62, 0x7A, 0x30, 0xA7, 0x0C, 0x55, 0xF0, 0x93,
+    0xD6, 0xAF, 0xC3, 0x95, 0xF0, 0xCD, 0x22, 0x6C, 0x4D, 0x87, 0x0E, 0xDC, 0xC4, 0xAB, 0xCA, 0xFA,
+    0xF4, 0x6F, 0x45, 0x99, 0x08, 0x90, 0xE2, 0x3F, 0x6B, 0x68, 0x2D, 0x2C, 0x5A, 0xF0, 0x73, 0x03,
+    0x6E, 0x61, 0xE1, 0xCC, 0x67, 0x34, 0x1A, 0xA9, 0x9D, 0x83, 0xF8, 0x3A, 0xF5, 0x66, 0xEC, 0x82,
+    0x7F, 0xFF, 0xA6, 0x4E, 0x5C, 0xFD, 0x37, 0xD2, 0x59, 0xB9, 0x00, 0x34, 0xB8, 0x60, 0xC1, 0x6D,
+    0xAE, 0x6A, 0x58, 0xA9, 0x47, 0xB1, 0x29, 0xC0, 0xBA, 0xDF, 0xB2, 0x22, 0x51, 0x4B, 0xFF, 0x29,
+    0xEC, 0x35, 0x4B, 0xD1, 0x90, 0x32, 0xD8, 0x31, 0x07, 0x41, 0xA1, 0x95, 0x48, 0xAA, 0xD9, 0x24,
+    0xFA, 0xC4, 0x88, 0x74, 0x3D, 0x74, 0x4A, 0xCD, 0xFF, 0x9F, 0x63, 0x4B, 0xE3, 0x8A, 0x3A, 0x11,
+    0x99, 0x16, 0x97, 0x7A, 0xB6, 0x51, 0x17, 0x52, 0x84, 0x41, 0x1F, 0x9E, 0x17, 0x58, 0x15, 0xD6,
+    0xAC, 0x9E, 0x44, 0x41, 0xBD, 0xDC, 0x3D, 0x0A, 0x09, 0x16, 0xA4, 0xAB, 0x4C, 0xCE, 0x40, 0x49,
+    0xFA, 0x22, 0x27, 0x58, 0xC8, 0x21, 0x52, 0x06, 0xEB, 0x29, 0xA6, 0x2B, 0xA1, 0x91, 0x9E, 0x54,
+    0xA5, 0x78, 0x49, 0x98, 0xF7, 0xAA, 0xC2, 0x43, 0x74, 0x00, 0x62, 0x90, 0x14, 0xE8, 0xF9, 0xD1,
+    0xA4, 0x5F, 0xD4, 0xAC, 0xA8, 0xC7, 0x26, 0x4A, 0x3D, 0x60, 0xA2, 0x8E, 0xB0, 0xC7, 0x94, 0x94,
+    0x73, 0x33, 0x38, 0x1C, 0x44, 0x0A, 0xBD, 0x48, 0xCD, 0x26, 0xDE, 0x7D, 0x70, 0xBF, 0x7E, 0x98,
+    0xFC, 0xD3, 0x3A, 0x08, 0x32, 0xA7, 0xDA, 0xEF, 0xE4, 0x6E, 0xB5, 0x7F, 0x94, 0xBB, 0xE5, 0x53,
+    0x56, 0xEE, 0x95, 0xE7, 0x31, 0x14, 0x8D, 0x05, 0xA5, 0x6A, 0x46, 0x99, 0xFF, 0x56, 0x6D, 0x47,
+    0xFE, 0xFB, 0xB5, 0xA7, 0xBC, 0xDF, 0x56, 0xC7, 0xB9, 0x9F, 0x52, 0x1D, 0x8F, 0x0C, 0x2E, 0x34,
+    0x2D, 0x55, 0x12, 0xF1, 0x8B, 0x4D, 0x0B, 0xB2, 0x4D, 0xA5, 0x3A, 0x8B, 0x86, 0xDB, 0xFF, 0x58,
+    0x1C, 0x10, 0x5C, 0x02, 0xC3, 0x44, 0xBB, 0xEE, 0x51, 0x12, 0x2B, 0xD3, 0x5E, 0x19, 0x5C, 0x59,
+    0x81, 0x8D, 0xD5, 0xED, 0x91, 0x32, 0x7E, 0x2B, 0xD5, 0x65, 0x9C, 0x6C, 0x5D, 0xCD, 0xE3, 0xC4,
+    0x98, 0x7E, 0xA2, 0x33, 0x73, 0x23, 0xA3, 0x4C, 0x02, 0xAD, 0x76, 0x99, 0x7E, 0x98, 0xB4, 0x4A,
+    0x90, 0x32, 0xFB, 0xA2, 0xC0, 0x6D, 0xA8, 0x4D, 0xC2, 0x18, 0x9E, 0x66, 0x80, 0x49, 0xAA, 0xB4,
+    0x8B, 0x73, 0x8D, 0x2D, 0xD6, 0x56, 0x9C, 0x69, 0x49, 0xF9, 0x02, 0x31, 0x50, 0xC2, 0xAF, 0x00,
+    0xA6, 0xF5, 0x30, 0x3F, 0xD5, 0xD1, 0xA8, 0x8A, 0xD7, 0xE1, 0xF0, 0xB0, 0x96, 0xFD, 0xC7, 0x4C,
+    0x8D, 0xB2, 0x84, 0x79, 0x70, 0xAB, 0x11, 0x84, 0x97, 0x5D, 0x70, 0x80, 0x92, 0x14, 0xA4, 0xDD,
+    0x04, 0x98, 0xF3, 0x1C, 0x8E, 0x71, 0x28, 0xE9, 0x67, 0x58, 0xC6, 0xEA, 0x08, 0xB3, 0x64, 0x36,
+    0x3D, 0x74, 0x32, 0x11, 0xC9, 0x11, 0x8C, 0xCF, 0xA8, 0xB8, 0x30, 0x35, 0x9E, 0xAB, 0xF0, 0xF9,
+    0xD8, 0x00, 0xA7, 0x74, 0x22, 0x82, 0x52, 0xCE, 0xB7, 0x8B, 0x83, 0xCC, 0x77, 0x94, 0x32, 0xCC,
+    0x1E, 0xC4, 0x36, 0xDF, 0x34, 0x55, 0xB7, 0xD9, 0x6F, 0x5E, 0xA0, 0xE8, 0x06, 0xCC, 0xDC, 0xBA,
+    0xEC, 0x71, 0x18, 0xE5, 0x67, 0xD4, 0x5D, 0x26, 0xC1, 0xEC, 0x5D, 0x73, 0x81, 0xE5, 0x27, 0x22,
+    0x99, 0xC0, 0x23, 0xAC, 0x3C, 0x98, 0x8D, 0x43, 0xF4, 0x3B, 0x4B, 0xE0, 0xD0, 0x14, 0xC0, 0x27,
+    0x5D, 0x69, 0xD4, 0x94, 0x7B, 0x67, 0xCD, 0x3B, 0x32, 0x65, 0xC4, 0xF0, 0xB5, 0xC3, 0xEA, 0x25,
+    0x5A, 0xBF, 0x37, 0x80, 0x3D, 0x03, 0xA0, 0xCC, 0xD7, 0x80, 0x3F, 0xA5, 0xCA, 0x0E, 0x0C, 0x2A,
+    0x9D, 0x57, 0xC0, 0xA1, 0xAC, 0xB5, 0x67, 0xA9, 0x3A, 0x16, 0xB3, 0x5B, 0x20, 0x56, 0x10, 0x27,
+    0x58, 0x90, 0xF8, 0x40, 0xC1, 0xAB, 0x0A, 0x4F, 0x65, 0x52, 0x37, 0x0D, 0x9F, 0x01, 0x3C, 0x61,
+    0x9A, 0xE2, 0x4D, 0xC5, 0xC2, 0x30, 0x33, 0x51, 0xCC, 0x6D, 0x30, 0x1B, 0x25, 0x48, 0x81, 0x22,
+    0x6D, 0x0D, 0x6D, 0xD8, 0x14, 0xEC, 0x7E, 0x8D, 0x4F, 0xF5, 0x4B, 0x35, 0x59, 0xBC, 0x9D, 0xAB,
+    0xE6, 0x9F, 0x03, 0x41, 0xC5, 0x3B, 0x57, 0x66, 0x16, 0xAD, 0x15, 0x4B, 0xB7, 0x5E, 0x6D, 0x23,
+    0xA4, 0x4D, 0x19, 0x92, 0xC0, 0xCA, 0xC1, 0xEB, 0x55, 0x00, 0x33, 0x17, 0x71, 0x89, 0x23, 0xAC,
+    0x58, 0x95, 0x14, 0xE7, 0xCE, 0x62, 0x1D, 0x23, 0xE9, 0x6C, 0x91, 0xCE, 0xD4, 0x89, 0x28, 0xA0,
+    0xB1, 0xA7, 0x24, 0xDB, 0xB6, 0x47, 0xC5, 0x6C, 0xDA, 0x04, 0xC1, 0x6B, 0x25, 0xE3, 0x28, 0x0A,
+    0x6C, 0x60, 0x1E, 0xE5, 0x9B, 0xE8, 0x76, 0x41, 0x4D, 0xF5, 0xD4, 0x49, 0x9B, 0xB3, 0xFA, 0x8E,
+    0x54, 0xAA, 0x54, 0x6C, 0x96, 0x26, 0xBA, 0xE1, 0xC9, 0xDE, 0xB6, 0x7D, 0xF7, 0x66, 0xEA, 0x3E,
+    0x56, 0x42, 0xFD, 0x20, 0x14, 0xCC, 0x3B, 0x48, 0x97, 0x8D, 0xE4, 0x6D, 0x24, 0x98, 0x01, 0xF7,
+    0x64, 0x70, 0x9A, 0x98, 0xC5, 0xFF, 0x98, 0x0D, 0xA0, 0x1C, 0xA4, 0x9D, 0x81, 0x50, 0x2C, 0x86,
+    0x01, 0xF8, 0x0F, 0xF0, 0xCB, 0xFA, 0x6A, 0x25, 0x62, 0xD7, 0xEB, 0xBE, 0x15, 0x49, 0x5B, 0xAC,
+    0xB1, 0xB4, 0x30, 0x09, 0xCE, 0x6F, 0x5E, 0xC8, 0x99, 0xC3, 0x02, 0x04, 0xC4, 0xFD, 0x6E, 0xC9,
+    0x6A, 0x31, 0xFD, 0x0C, 0x3E, 0x05, 0x6B, 0xA1, 0x43, 0xD1, 0x26, 0x84, 0x43, 0x90, 0xB0, 0xF7,
+    0xFC, 0x38, 0xF8, 0x9C, 0x31, 0xA4, 0x85, 0xEB, 0x3D, 0x52, 0x34, 0x1D, 0xF0, 0x52, 0x93, 0x33,
+    0xB6, 0x6B, 0x7C, 0x19, 0x19, 0xFD, 0xBD, 0x6F, 0x93, 0xF0, 0x24, 0x73, 0x2C, 0x8D, 0xAF, 0x15,
+    0xE9, 0x2A, 0xBD, 0x73, 0xD9, 0x3A, 0x70, 0x60, 0x76, 0x01, 0x0F, 0x0D, 0xE1, 0x4C, 0x8E, 0x02,
+    0xDC, 0x95, 0x22, 0x4C, 0x62, 0xA2, 0x84, 0xD4, 0xF1, 0xC5, 0xA9, 0xE5, 0x21, 0x6E, 0x2D, 0x50,
+    0xD3, 0xAB, 0xE4, 0xE2, 0x97, 0x72, 0x61, 0x8B, 0x80, 0x32, 0x7D, 0x1C, 0xF0, 0xB4, 0x3A, 0x02,
+    0x48, 0xAD, 0xED, 0x4E, 0xB9, 0x5D, 0x17, 0xA7, 0x94, 0x95, 0xCA, 0x9B, 0x6A, 0xE5, 0x55, 0xA3,
+    0x17, 0x4D, 0x57, 0x05, 0xEB, 0x70, 0xFB, 0x09, 0x8B, 0xD4, 0x99, 0xC7, 0x85, 0x4B, 0xD3, 0x6D,
+    0x8F, 0x62, 0x97, 0x67, 0x27, 0x37, 0xED, 0x5C, 0x19, 0xFD, 0x05, 0xA3, 0xDA, 0x00, 0x4E, 0xAA,
+    0x68, 0x42, 0x17, 0xBE, 0xE0, 0xDC, 0x02, 0xDC, 0x4F, 0xB2, 0xF8, 0x7B, 0x4E, 0x49, 0x3C, 0xE9,
+    0x12, 0x04, 0x60, 0x94, 0x50, 0xB4, 0xEC, 0xC4, 0xE2, 0x4A, 0x93, 0x30, 0xB8, 0xF9, 0xA0, 0xB4,
+    0x1B, 0x9E, 0xA0, 0x68, 0x5F, 0xD1, 0x57, 0x98, 0x07, 0x3B, 0x39, 0x0D, 0x47, 0x87, 0x2E, 0x09,
+    0xD1, 0xA8, 0xDF, 0xFB, 0xF6, 0xBE, 0x6B, 0xFF, 0xE5, 0xAB, 0x8D, 0x8E, 0xD4, 0xEC, 0xE9, 0xD3,
+    0xD8, 0x74, 0x67, 0x75, 0x95, 0x3C, 0x9A, 0x99, 0x19, 0x56, 0x75, 0x57, 0xA2, 0xA6, 0xDE, 0x19,
+    0x51, 0x1B, 0x7E, 0xC5, 0xF2, 0x77, 0x14, 0x27, 0xD0, 0x06, 0x00, 0xC1, 0xDA, 0xF4, 0xA7, 0x5C,
+    0xBF, 0xBF, 0xC5, 0x94, 0x84, 0xA7, 0x3B, 0x69, 0x98, 0xF2, 0xE1, 0x97, 0x6B, 0xC9, 0x13, 0x34,
+    0x43, 0x5B, 0x87, 0xF4, 0xFB, 0x5D, 0xD3, 0xEA, 0xB0, 0xFC, 0x99, 0xB8, 0xEC, 0xBE, 0xB4, 0x92,
+    0x32, 0x29, 0x94, 0xD2, 0xA3, 0x43, 0xA3, 0x16, 0x04, 0x8C, 0x4C, 0x12, 0x50, 0x93, 0x8F, 0x24,
+    0x96, 0xAE, 0x42, 0x09, 0x75, 0xB4, 0x29, 0x45, 0x23, 0xB1, 0x6D, 0xDF, 0x25, 0xAF, 0xD4, 0xD7,
+    0xA4, 0x30, 0xA6, 0x56, 0xB0, 0x15, 0xF5, 0x59, 0xD3, 0x65, 0x22, 0xA9, 0x0F, 0xF6, 0xA4, 0xBA,
+    0xC9, 0x51, 0xFC, 0x53, 0x7C, 0xDC, 0xAC, 0x87, 0xED, 0xB7, 0xF6, 0x7B, 0x80, 0x88, 0x27, 0x33,
+    0x86, 0xDD, 0x9B, 0xB4, 0x06, 0x20, 0x5C, 0x97, 0x27, 0x4E, 0xAF, 0x3C, 0x2C, 0xD2, 0x34, 0xA7,
+    0xAB, 0x70, 0xFD, 0xDC, 0x3F, 0x51, 0xFF, 0x68, 0x4B, 0xB0, 0x6F, 0xDF, 0x7D, 0x5B, 0xF6, 0xEF,
+    0xDA, 0xB3, 0xA2, 0x30, 0x5D, 0x17, 0xED, 0x4F, 0x9B, 0x63, 0xF2, 0xD8, 0xD9, 0x5E, 0xD6, 0xC3,
+    0xBE, 0x8A, 0x71, 0xB4, 0x6F, 0x9D, 0xDE, 0xFE, 0x35, 0x75, 0x4D, 0x32, 0x8E, 0x61, 0xE3, 0x06,
+    0x5B, 0xE0, 0x56, 0xA1, 0xAD, 0x4F, 0x2A, 0xF5, 0x75, 0x3B, 0x52, 0xBF, 0xE3, 0x47, 0x4C, 0x09,
+    0x46, 0x53, 0x22, 0xF1, 0xAB, 0xDF, 0x3F, 0xCE, 0xEB, 0xEF, 0xFF, 0xDB, 0x1F, 0x7C, 0x9D, 0xD7,
+    0x6F, 0xDD, 0xF7, 0xBB, 0xEE, 0x57, 0x22, 0x3F, 0x8B, 0x26, 0x8E, 0x71, 0x5A, 0x65, 0xBD, 0x0D,
+    0xA6, 0x6C, 0xFB, 0x3E, 0x66, 0xFC, 0x16, 0xF8, 0x35, 0xDA, 0x94, 0x75, 0xE9, 0x05, 0x62, 0x7F,
+    0x1F, 0x14, 0x3E, 0xF9, 0xE0, 0x35, 0xAE, 0xA8, 0x5F, 0xAC, 0x13, 0x0D, 0x29, 0x90, 0xBE, 0x1B,
+    0x52, 0xC6, 0xEF, 0xF6, 0xEE, 0x60, 0x1F, 0x7B, 0x5C, 0x7F, 0x60, 0x8C, 0xB1, 0x00, 0xCD, 0xBE,
+    0x75, 0x89, 0x9E, 0x52, 0xFE, 0xF6, 0xC5, 0xCB, 0x8D, 0xFA, 0xD1, 0x54, 0xED, 0x2F, 0xF4, 0x45,
+    0x86, 0xB4, 0xB0, 0xC4, 0x88, 0xCC, 0x9C, 0x51, 0x5F, 0xE6, 0x87, 0x8C, 0x87, 0x93, 0x97, 0x6E,
+    0x5B, 0x8A, 0xAE, 0x2F, 0x91, 0xF0, 0x4C, 0x44, 0x9C, 0x07, 0x64, 0x99, 0x08, 0xF2, 0xC3, 0xBA,
+    0xAD, 0x6C, 0xB2, 0x7E, 0xF6, 0xE2, 0xAA, 0x6B, 0x3A, 0xDF, 0x7B, 0xA7, 0x61, 0x89, 0x8B, 0xE1,
+    0x91, 0x19, 0x3F, 0x39, 0x2E, 0x99, 0xAF, 0xE2, 0xDA, 0x96, 0xCF, 0x67, 0x20, 0xF3, 0xD2, 0x0B,
+    0xD4, 0xB7, 0x7C, 0x7A, 0x85, 0xE9, 0x4C, 0x1A, 0x49, 0x3F, 0xC8, 0xA4, 0xE5, 0x33, 0xCC, 0xFE,
+    0x8A, 0x99, 0x87, 0x93, 0x3F, 0x63, 0x2F, 0xC8, 0xA3, 0x6C, 0xF9, 0x4C, 0xFF, 0x1D, 0x21, 0xB9,
+    0x96, 0x83, 0x15, 0x9A, 0x8D, 0x93, 0x16, 0x03, 0xB8, 0xBE, 0x61, 0xD0, 0xB4, 0x7C, 0xCE, 0x75,
+    0x07, 0xE2, 0xCF, 0x10, 0xED, 0x5C, 0xEA, 0x4F, 0x48, 0x18, 0xC6, 0xFB, 0x53, 0x3E, 0x4F, 0x84,
+    0x42, 0x19, 0xF9, 0x5B, 0x34, 0x5D, 0xF4, 0x4F, 0x81, 0x8E, 0x13, 0x30, 0xAE, 0xE1, 0x5A, 0xD2,
+    0x57, 0x9B, 0xA4, 0xCC, 0x13, 0x57, 0xCE, 0xA4, 0xC8, 0x53, 0x4A, 0x19, 0xA3, 0x30, 0x95, 0xCF,
+    0xA1, 0x98, 0x92, 0x26, 0xF1, 0xD3, 0x08, 0x84, 0x5F, 0x8F, 0x93, 0xB0, 0x09, 0xDB, 0xA0, 0x64,
+    0xE6, 0x53, 0x1A, 0xA0, 0x88, 0x8E, 0x8A, 0x3E, 0x53, 0x95, 0x88, 0x60, 0x39, 0x9B, 0xD5, 0x5B,
+    0x60, 0xF8, 0xEA, 0xC6, 0xCA, 0x0D, 0x8C, 0x86, 0x24, 0x5E, 0x9E, 0x27, 0xC9, 0x96, 0x9E, 0x34,
+    0x7F, 0x4F, 0xB5, 0x95, 0x4B, 0x05, 0xA0, 0x4F, 0xBC, 0x74, 0x51, 0x9F, 0xFA, 0x9D, 0x84, 0x2C,
+    0x40, 0xC1, 0xEA, 0xC8, 0x67, 0x8B, 0x9B, 0x53, 0xAE, 0x6C, 0x0C, 0xBB, 0xAA, 0xA5, 0x0F, 0x52,
+    0x4A, 0xB0, 0x92, 0x13, 0x4B, 0xA3, 0xE0, 0x57, 0x40, 0xBF, 0x43, 0xFB, 0x82, 0x74, 0x23, 0x2E,
+    0x6F, 0x68, 0xE9, 0x59, 0xCE, 0xCC, 0x99, 0x10, 0xD2, 0xCD, 0xAC, 0x4A, 0xC1, 0x8D, 0xC1, 0xF0,
+    0x3F, 0xE8, 0xCD, 0xFF, 0x94, 0xF0, 0xE8, 0x79, 0x06, 0xFD, 0xBC, 0x43, 0x53, 0x3C, 0xB4, 0x2A,
+    0xB8, 0xC2, 0xC8, 0xB4, 0x24, 0xF6, 0xFD, 0xE3, 0x8B, 0x3D, 0x35, 0x33, 0x4B, 0xB3, 0x2B, 0x5E,
+    0x1B, 0xD6, 0x56, 0xFB, 0x11, 0x7C, 0xC5, 0xD3, 0x2D, 0xE8, 0xEA, 0xF0, 0xBD, 0xCE, 0x6E, 0xAC,
+    0x56, 0x2A, 0xB2, 0xB5, 0xDD, 0xB8, 0x15, 0x9C, 0xED, 0x27, 0xCF, 0x82, 0xD9, 0x6B, 0x99, 0xB7,
+    0x0E, 0x5F, 0x09, 0x49, 0x09, 0xB2, 0x6D, 0x78, 0xEC, 0x8C, 0xE8, 0x85, 0x24, 0x8A, 0x7F, 0xDE,
+    0xDB, 0xCB, 0x41, 0xD3, 0xC6, 0xE1, 0x09, 0x24, 0x96, 0x11, 0x3D, 0x56, 0x7F, 0x7A, 0xB0, 0xA1,
+    0xC5, 0x8D, 0x8C, 0xF2, 0xA6, 0xA6, 0xC3, 0xCF, 0xB7, 0x87, 0x4F, 0x77, 0xBF, 0xC7, 0x82, 0x23,
+    0x04, 0x32, 0x50, 0x4F, 0x9C, 0x64, 0x66, 0x69, 0x19, 0x2B, 0x63, 0xFF, 0xCD, 0xD2, 0x84, 0xE7,
+    0x5F, 0x90, 0xE6, 0x1E, 0xEA, 0xC9, 0xA6, 0x6F, 0x7D, 0x79, 0x63, 0xB5, 0xEF, 0x5B, 0xF7, 0xD8,
+    0x9B, 0xEF, 0xE7, 0xD2, 0xBC, 0x3E, 0xBD, 0x3A, 0x97, 0x06, 0x7F, 0x26, 0x7D, 0xAE, 0x8F, 0x10,
+    0xBF, 0x60, 0x75, 0x13, 0xDE, 0x2E, 0x71, 0x45, 0x4C, 0x43, 0x65, 0xEC, 0xC0, 0xC4, 0x27, 0xE2,
+    0x8A, 0xE6, 0xD6, 0x23, 0x81, 0x41, 0xB7, 0xBB, 0x22, 0x15, 0xFF, 0x5D, 0xD2, 0x27, 0xE0, 0xFB,
+    0x1C, 0x60, 0x28, 0x58, 0x38, 0x1B, 0xFA, 0xF6, 0x58, 0x91, 0x81, 0x57, 0xC3, 0x8A, 0x10, 0x73,
+    0xE9, 0x62, 0x68, 0x26, 0x5D, 0xC1, 0x97, 0x6C, 0xA6, 0x03, 0x1C, 0x1E, 0x82, 0xB2, 0xD7, 0x97,
+    0x0B, 0x09, 0xB5, 0x7A, 0x63, 0xFB, 0xB9, 0x45, 0x5B, 0x86, 0x8D, 0x1B, 0x2F, 0x09, 0x0B, 0x4C,
+    0x66, 0x50, 0x8A, 0xE1, 0x52, 0xCF, 0x61, 0xCA, 0x9D, 0x09, 0x77, 0xE9, 0x27, 0xC6, 0x0E, 0xFA,
+    0x04, 0x81, 0xF0, 0x67, 0xC1, 0x95, 0xCA, 0xA4, 0xDB, 0xE1, 0xE6, 0x35, 0xC3, 0xE0, 0xB8, 0xC0,
+    0xBE, 0xA5, 0x85, 0x3A, 0x5A, 0x42, 0xAE, 0xDE, 0xCF, 0xD5, 0xF6, 0xA3, 0x76, 0xE5, 0x70, 0xC3,
+    0xF7, 0x39, 0xA5, 0xD8, 0xAF, 0x3D, 0x6E, 0x29, 0x76, 0x6B, 0x97, 0x5B, 0x48, 0xE9, 0xCB, 0xF3,
+    0x0A, 0xB1, 0x9C, 0x73, 0x6B, 0xE3, 0x83, 0x0E, 0x95, 0x30, 0x39, 0x30, 0xCD, 0xFB, 0x55, 0x78,
+    0x52, 0xF2, 0x2D, 0x45, 0x18, 0x99, 0x3E, 0x9D, 0xD0, 0xF8, 0xDA, 0x28, 0x26, 0x91, 0xA3, 0x4E,
+    0xC2, 0x4B, 0x44, 0x00, 0xB3, 0xA6, 0x79, 0xBF, 0xF0, 0x75, 0x39, 0xEE, 0x45, 0x18, 0x22, 0xA1,
+    0xF3, 0xFD, 0xF5, 0x58, 0x7F, 0xED, 0x6B, 0x6E, 0x6A, 0x30, 0xD2, 0xDB, 0x59, 0x78, 0x04, 0xFC,
+    0x7F, 0x59, 0xD9, 0xB8, 0x3B, 0xF7, 0x74, 0xE6, 0x7E, 0xBF, 0xF1, 0xB2, 0xD8, 0xCB, 0xBF, 0x36,
+    0x6A, 0xBD, 0xAC, 0x61, 0xB1, 0xAE, 0xF5, 0x2F, 0xD5, 0x24, 0xA4, 0x0D, 0x9E, 0x11, 0x20, 0xD8,
+    0xC5, 0x2F, 0x08, 0x36, 0x94, 0x5D, 0xA4, 0x5F, 0x0F, 0xB9, 0xC9, 0xF7, 0xDB, 0xD5, 0x09, 0x5E,
+    0xCF, 0x3B, 0xE5, 0x05, 0x5E, 0x31, 0x4B, 0xEB, 0x96, 0xDF, 0xC0, 0xB7, 0x55, 0x63, 0x33, 0xDF,
+    0x58, 0xAB, 0xC6, 0xD2, 0xCD, 0x35, 0x1D, 0x80, 0xC3, 0xBA, 0xFA, 0x73, 0x4E, 0x8F, 0x97, 0x3D,
+    0xDA, 0xC9, 0xC7, 0x45, 0xD1, 0xBE, 0x29, 0x0C, 0x1B, 0x7F, 0x04, 0x01, 0x00, 0x76, 0xAC, 0x1C,
+    0x35, 0xA3, 0x72, 0x38, 0x72, 0x47, 0xE1, 0x47, 0x5C, 0xCD, 0x4E, 0x3B, 0x16, 0x4A, 0x05, 0xE2,
+    0x98, 0x46, 0x26, 0x9E, 0xEE, 0x68, 0x04, 0xBC, 0x83, 0x71, 0x6F, 0xB3, 0x17, 0xB0, 0x36, 0xE9,
+    0x76, 0xB6, 0x68, 0x79, 0xC6, 0xDB, 0x49, 0x9B, 0x2C, 0x8B, 0x3C, 0xDF, 0x79, 0x49, 0xBA, 0x3A,
+    0xDD, 0x22, 0x8E, 0x3C, 0x18, 0xA8, 0x51, 0x42, 0x90, 0xD3, 0x49, 0x0A, 0x40, 0xD2, 0x00, 0x90,
+    0xA5, 0xFB, 0xF1, 0x7B, 0x8D, 0x0F, 0xEC, 0x86, 0x4A, 0x1F, 0xA9, 0x01, 0x96, 0x73, 0x63, 0xD4,
+    0x17, 0xFA, 0x34, 0xFE, 0x7E, 0x53, 0x2D, 0xB0, 0x16, 0x4D, 0xBA, 0x38, 0x48, 0xE0, 0x6D, 0x0E,
+    0x88, 0x16, 0xD8, 0xEF, 0x30, 0x20, 0xF1, 0x2C, 0x1A, 0x85, 0x3D, 0x62, 0x15, 0xF6, 0xC9, 0x7E,
+    0x4A, 0x6B, 0xF0, 0x45, 0x11, 0xF4, 0xB5, 0x64, 0x30, 0xBF, 0x2A, 0x7D, 0x8C, 0x52, 0xC0, 0x36,
+    0x3A, 0xA5, 0x24, 0x8B, 0x6D, 0x75, 0x23, 0x39, 0x43, 0x38, 0x69, 0xFA, 0x87, 0xA0, 0xC5, 0x97,
+    0x69, 0x21, 0x7C, 0x53, 0x10, 0x17, 0x23, 0xBA, 0x09, 0xAB, 0x17, 0x53, 0x63, 0xC4, 0xB6, 0x9D,
+    0x3F, 0x0C, 0x1B, 0xBB, 0x75, 0x1A, 0xEF, 0x55, 0xA7, 0x9E, 0x7F, 0xD0, 0xA9, 0x10, 0x68, 0xFF,
+    0x1A, 0x4B, 0x23, 0xEA, 0x62, 0x25, 0x1C, 0xBE, 0x2E, 0xB8, 0x28, 0x65, 0x60, 0x39, 0x6B, 0x17,
+    0x26, 0x71, 0x8E, 0xB8, 0xA9, 0xEC, 0xA7, 0x63, 0xFD, 0x03, 0x26, 0xF6, 0x08, 0x1B, 0x0C, 0x13,
+    0x76, 0x6B, 0xC1, 0xF8, 0x26, 0x50, 0xEA, 0x65, 0x2C, 0x83, 0xC9, 0x10, 0xEB, 0x93, 0x42, 0x74,
+    0x18, 0x93, 0x7D, 0xE8, 0xD2, 0xF4, 0xFD, 0x6F, 0xFA, 0xE9, 0xE0, 0xAF, 0x85, 0xCA, 0xFF, 0x55,
+    0x8E, 0x93, 0x3A, 0x92, 0xD6, 0x55, 0xF1, 0x9F, 0x08, 0xF6, 0xFC, 0x67, 0x54, 0x48, 0xFD, 0xA4,
+    0x80, 0xC4, 0x1F, 0xC0, 0x1C, 0x5A, 0xEC, 0x2C, 0x55, 0x72, 0xE6, 0x8F, 0xF4, 0x05, 0x2C, 0xC2,
+    0x67, 0x60, 0x28, 0xD6, 0xBE, 0x53, 0x85, 0x20, 0x3B, 0x71, 0x9A, 0xD1, 0x5A, 0xE2, 0xAC, 0x3F,
+    0x7A, 0x48, 0x39, 0xBF, 0xFD, 0x73, 0x30, 0xFB, 0x53, 0x78, 0x3C, 0xEF, 0x2A, 0xB1, 0x1A, 0xC5,
+    0xCA, 0x7F, 0x97, 0x61, 0xD4, 0x5F, 0xC3, 0x74, 0x05, 0xFF, 0x3D, 0x8E, 0x86, 0x06, 0x76, 0xF8,
+    0x8D, 0x38, 0x1A, 0x57, 0xAE, 0xD8, 0xE1, 0xC8, 0x6D, 0xB1, 0x86, 0x6D, 0x81, 0x0C, 0x63, 0x5B,
+    0xAC, 0xE5, 0x0F, 0x65, 0x5B, 0xB2, 0xA9, 0x6D, 0x39, 0xF9, 0xB9, 0x6D, 0x71, 0x27, 0xDB, 0xD2,
+    0xC9, 0xB6, 0xB4, 0xB2, 0x2D, 0x53, 0x67, 0x31, 0xE6, 0xDA, 0xC9, 0xB6, 0xB8, 0x53, 0x65, 0x64,
+    0x1F, 0x22, 0x34, 0xD7, 0xBD, 0x48, 0xE2, 0xFE, 0x10, 0x02, 0x0C, 0xBF, 0xE3, 0xBD, 0x6A, 0xDF,
+    0xDC, 0x36, 0xF0, 0x84, 0x12, 0x0C, 0x92, 0x7F, 0x45, 0x27, 0x69, 0xF1, 0x10, 0x6C, 0xD6, 0x2F,
+    0xF3, 0x79, 0x66, 0x49, 0xA2, 0x7D, 0x6E, 0x25, 0xB9, 0xE0, 0x72, 0x97, 0x8C, 0xFB, 0xC4, 0xF3,
+    0x94, 0xE3, 0xE6, 0xEF, 0x40, 0x4C, 0x8A, 0x39, 0x0D, 0x14, 0x5E, 0xEC, 0xC4, 0x07, 0xC9, 0x49,
+    0xA0, 0x48, 0xCE, 0xDE, 0x4A, 0xAF, 0xBD, 0x9C, 0x01, 0x32, 0x27, 0x80, 0x02, 0x5D, 0x02, 0x80,
+    0xCE, 0x2C, 0x2D, 0x5A, 0x2F, 0xE2, 0x4E, 0xAF, 0x5E, 0x70, 0xCB, 0xFD, 0xF5, 0x3E, 0xAF, 0x3C,
+    0xFB, 0xDD, 0xA3, 0xDE, 0x2F, 0x89, 0xD2, 0xDE, 0xE1, 0xC9, 0x95, 0x6E, 0xD8, 0xD1, 0xF0, 0x87,
+    0x4C, 0x49, 0x3F, 0x83, 0x5D, 0x8D, 0x05, 0x27, 0xF5, 0xC7, 0xD0, 0x22, 0xA8, 0xC9, 0x50, 0x87,
+    0xBB, 0x2E, 0xEE, 0x4A, 0xA7, 0x0E, 0x6A, 0xE8, 0x6B, 0x0E, 0x6A, 0x98, 0x03, 0x51, 0xCF, 0x3D,
+    0x2E, 0xBD, 0xC8, 0x82, 0xBB, 0x94, 0x33, 0x1C, 0xD7, 0x98, 0x3E, 0xA8, 0x31, 0xC1, 0x5D, 0xC4,
+    0x22, 0xC3, 0xD1, 0x9F, 0x76, 0x0A, 0x6B, 0xCD, 0x4F, 0x59, 0x9A, 0x7D, 0xBD, 0xB5, 0x63, 0x0E,
+    0x98, 0x69, 0x7A, 0x22, 0x19, 0x8B, 0x07, 0xE4, 0xD8, 0xD5, 0xC0, 0x7E, 0x5F, 0x47, 0x86, 0x8D,
+    0x57, 0xB8, 0x73, 0xE0, 0x19, 0xF1, 0x17, 0x75, 0xB6, 0x34, 0x69, 0x16, 0x96, 0x87, 0xE4, 0xE0,
+    0x0B, 0xF0, 0x8B, 0x18, 0x7D, 0x03, 0xF0, 0xC4, 0xAC, 0x53, 0xF7, 0x77, 0xB0, 0xD3, 0x39, 0x6C,
+    0x86, 0xB4, 0x1E, 0x68, 0x96, 0x62, 0xD1, 0x1F, 0xE8, 0x2B, 0x52, 0xDA, 0x4E, 0x0F, 0x94, 0x86,
+    0xEC, 0xD2, 0xD0, 0x5D, 0xF4, 0x84, 0xF7, 0x94, 0xF7, 0xA4, 0xF7, 0xB4, 0xF7, 0xC4, 0xF7, 0xD4,
+    0xF7, 0xE4, 0xF7, 0xC7, 0x55, 0x0C, 0x03, 0x7A, 0x0E, 0xF4, 0x2C, 0xE8, 0x79, 0x30, 0x30, 0x41,
+    0xB2, 0xDC, 0x26, 0xC9, 0xCD, 0x4E, 0xDB, 0xD6, 0x4D, 0x48, 0xA4, 0x13, 0x91, 0x4A, 0x87, 0x64,
+    0x8A, 0xAF, 0xE3, 0x09, 0x18, 0x21, 0xD4, 0x50, 0x6A, 0x48, 0x35, 0xB4, 0x1A, 0x62, 0x85, 0x5A,
+    0xAA, 0x91, 0xD3, 0xAA, 0xE9, 0xE3, 0x29, 0x0D, 0x61, 0xDA, 0x69, 0x62, 0x2F, 0xD3, 0xD9, 0x3F,
+    0x5C, 0xB0, 0x90, 0x4E, 0x4C, 0xDB, 0x34, 0x41, 0xC3, 0xC1, 0xDF, 0xC4, 0xEE, 0xFE, 0x96, 0xC0,
+    0xC7, 0x21, 0xFC, 0x4C, 0x23, 0xC0, 0xDB, 0x4A, 0x08, 0x92, 0xD6, 0x74, 0xB6, 0x07, 0x0B, 0x5D,
+    0xA3, 0x4E, 0x5A, 0xF1, 0x47, 0x9D, 0x34, 0xE3, 0x8C, 0xBA, 0x39, 0x1E, 0xBF, 0xB1, 0x5B, 0xA6,
+    0xA1, 0x5B, 0x73, 0xB4, 0x59, 0x89, 0xF6, 0xDD, 0x27, 0xBD, 0x57, 0x08, 0xC4, 0x05, 0x62, 0x85,
+    0x3D, 0x5E, 0xF8, 0x45, 0x67, 0x3A, 0xA5, 0x2F, 0xAB, 0x89, 0xA3, 0x5F, 0x8A, 0xE4, 0xA4, 0x08,
+    0xF3, 0x44, 0xE6, 0x08, 0xB6, 0xC1, 0x4D, 0x06, 0xAD, 0x4A, 0xD8, 0x59, 0xB9, 0x1B, 0x3F, 0x62,
+    0x51, 0x50, 0x1C, 0xBF, 0x69, 0x15, 0x1C, 0x9C, 0xBF, 0xA9, 0xE2, 0x12, 0x00, 0x4C, 0x3A, 0x99,
+    0x54, 0x8F, 0x4C, 0x66, 0x04, 0xC5, 0x3D, 0x64, 0xF6, 0xD0, 0x9C, 0x78, 0x5E, 0xAB, 0x86, 0xFA,
+    0xBB, 0x71, 0x61, 0x29, 0x03, 0xAB, 0xF5, 0xF3, 0x06, 0xEA, 0x41, 0xD4, 0xFE, 0x15, 0xA0, 0x91,
+    0xAD, 0xD9, 0x25, 0xF5, 0x41, 0xED, 0x17, 0xE1, 0xC5, 0x26, 0xCC, 0xE3, 0x93, 0x0D, 0xD4, 0xDC,
+    0x6E, 0x62, 0x19, 0x12, 0x0E, 0x4F, 0x77, 0x4E, 0x85, 0x81, 0x20, 0xA4, 0x93, 0xE6, 0x01, 0xE9,
+    0xBB, 0x05, 0x50, 0x6E, 0x63, 0x81, 0xD7, 0x1B, 0x67, 0x38, 0xF5, 0xD0, 0x72, 0xCB, 0xE0, 0xBC,
+    0x31, 0x21, 0x5C, 0xB6, 0x33, 0x0A, 0x9F, 0xD6, 0x65, 0xEC, 0x7C, 0xD2, 0xA4, 0xDE, 0x5B, 0x4D,
+    0xE7, 0xBD, 0xD6, 0x74, 0xFE, 0x45, 0x7C, 0x2E, 0xD5, 0xDA, 0x7B, 0xBD, 0x8C, 0xDD, 0xB5, 0x3C,
+    0xF8, 0x48, 0xB3, 0xC0, 0xD3, 0x18, 0x21, 0xBD, 0x93, 0x59, 0x05, 0x04, 0x96, 0x35, 0xDC, 0x8F,
+    0x23, 0xB9, 0xAF, 0xB4, 0xEB, 0x9D, 0xAC, 0xC9, 0x7A, 0xC9, 0xF1, 0x12, 0x57, 0x50, 0x1F, 0xEF,
+    0xBB, 0x5F, 0xDD, 0x6C, 0x56, 0xE1, 0x61, 0x44, 0x0F, 0xA5, 0xC9, 0x7D, 0x57, 0xBD, 0x6E, 0x1F,
+    0x37, 0xC8, 0x86, 0x62, 0xC0, 0xE0, 0x9B, 0xA7, 0x37, 0x69, 0x1A, 0x57, 0xB3, 0xBD, 0xD8, 0x62,
+    0x39, 0x0D, 0x94, 0xED, 0x93, 0xD3, 0x40, 0xCE, 0x0D, 0xCE, 0x71, 0x18, 0xBA, 0x26, 0x09, 0xFF,
+    0x09, 0x3A, 0x9F, 0x3A, 0x0D, 0x54, 0x0D, 0x2D, 0x68, 0xD2, 0xAD, 0x24, 0x5D, 0x09, 0x4C, 0x18,
+    0x9A, 0x81, 0x51, 0xF0, 0xCC, 0xE1, 0xD9, 0x64, 0x67, 0xE2, 0xB7, 0x71, 0x99, 0x96, 0x76, 0xBB,
+    0xB6, 0xF1, 0x42, 0xDF, 0x65, 0x29, 0x8E, 0xB6, 0x74, 0x1A, 0xF6, 0xEA, 0x31, 0x94, 0xF3, 0x0A,
+    0x06, 0x73, 0x54, 0x2E, 0x96, 0x9A, 0x37, 0x77, 0xC8, 0x8D, 0x83, 0x3A, 0xCD, 0xD1, 0xEB, 0xA6,
+    0xC2, 0xDC, 0xF9, 0x89, 0x2D, 0xFB, 0x9E, 0xF8, 0x79, 0x39, 0x68, 0xA4, 0x76, 0x26, 0xA9, 0x3E,
+    0x08, 0xB0, 0xBB, 0x6E, 0xA5, 0x2B, 0x9E, 0x9C, 0x51, 0xAA, 0x00, 0xA3, 0x58, 0x62, 0xA4, 0x80,
+    0x33, 0x1D, 0xEA, 0x32, 0x14, 0x62, 0x2C, 0xDC, 0x71, 0x0A, 0x7D, 0x56, 0xA2, 0xF3, 0x4D, 0xBB,
+    0xB7, 0x39, 0xFC, 0x78, 0x40, 0x2F, 0xF6, 0x6D, 0x5C, 0x3B, 0x16, 0x47, 0x49, 0xCC, 0x66, 0x5B,
+    0x69, 0xFE, 0x1F, 0x95, 0x4E, 0x69, 0xF1, 0x08, 0x6A, 0x0E, 0x9D, 0xC9, 0xEC, 0xDA, 0x8D, 0xEC,
+    0xC6, 0x83, 0x17, 0x9B, 0x07, 0xBE, 0x3C, 0x0B, 0x5B, 0x54, 0x98, 0x92, 0xEB, 0x54, 0x9E, 0x67,
+    0x80, 0x65, 0x76, 0xC7, 0x6E, 0xB6, 0x4C, 0xDD, 0xCE, 0x4A, 0x43, 0xAD, 0xEF, 0xC2, 0x4A, 0x19,
+    0x4D, 0x7C, 0x13, 0x11, 0xCC, 0xB5, 0x2B, 0xA5, 0xBF, 0x84, 0x9F, 0xF7, 0x75, 0x94, 0xAE, 0xF0,
+    0x54, 0xF7, 0x82, 0x1C, 0xA2, 0xE2, 0x82, 0x24, 0x43, 0xA8, 0x52, 0x39, 0x20, 0x15, 0xFE, 0xDD,
+    0xE4, 0x80, 0x94, 0xF1, 0xCB, 0x26, 0xE9, 0x63, 0x1A, 0x57, 0x3F, 0xA0, 0x21, 0x70, 0x4E, 0x8A,
+    0x39, 0x94, 0xE5, 0x1E, 0xA7, 0x7F, 0x85, 0x62, 0x80, 0x9C, 0xB9, 0x9A, 0x40, 0x32, 0x6C, 0x4D,
+    0xE6, 0x4D, 0x8D, 0xEA, 0xA9, 0x74, 0x40, 0xF9, 0xB9, 0xD1, 0xF4, 0x9D, 0x2A, 0xF6, 0x47, 0x62,
+    0xF2, 0xA7, 0xE9, 0x65, 0x2F, 0xB1, 0xEE, 0xFB, 0xAE, 0x32, 0x6D, 0x29, 0x26, 0x6B, 0x27, 0x8E,
+    0x81, 0xFD, 0xA7, 0x72, 0xCE, 0x52, 0x9D, 0xD5, 0xCC, 0x3B, 0xF3, 0xCC, 0x4F, 0x02, 0x9D, 0x8C,
+    0xFB, 0x64, 0xD7, 0x99, 0x61, 0x56, 0x26, 0x06, 0xAC, 0xEF, 0xCB, 0x61, 0x09, 0x8A, 0xC0, 0x13,
+    0xA2, 0x37, 0x2D, 0xD1, 0xCA, 0x5A, 0xD7, 0x06, 0x5D, 0xB4, 0xD7, 0x2B, 0xE7, 0x31, 0xE3, 0x3C,
+    0x2E, 0x3C, 0xA9, 0x87, 0x4B, 0x7F, 0x76, 0x45, 0xBC, 0x41, 0x2E, 0x7A, 0xC3, 0x78, 0xC3, 0x1C,
+    0x64, 0x09, 0x4C, 0x03, 0x55, 0xFF, 0xA6, 0x0A, 0x5E, 0x78, 0x78, 0x5C, 0xD0, 0xC4, 0xF0, 0xDA,
+    0x8A, 0xD4, 0x84, 0x8E, 0xDA, 0x04, 0x8F, 0x9A, 0x8E, 0xEA, 0xF4, 0x69, 0x6C, 0x60, 0xA8, 0xFB,
+    0xC8, 0xA1, 0x2F, 0xBE, 0xF5, 0x36, 0xA2, 0x0F, 0xA7, 0x27, 0x97, 0x64, 0x28, 0x08, 0xEC, 0x58,
+    0x5A, 0x3A, 0x70, 0x18, 0x77, 0x3D, 0x53, 0x2D, 0x84, 0x3F, 0x7C, 0xB4, 0x3A, 0x16, 0x3F, 0xEA,
+    0x96, 0x4F, 0xA6, 0xAE, 0x39, 0xCE, 0x25, 0x27, 0xB9, 0x58, 0x0B, 0x0E, 0x58, 0x6A, 0x83, 0xE3,
+    0x81, 0x4F, 0x81, 0xDB, 0x19, 0xA5, 0x89, 0xDD, 0xEE, 0x96, 0xDE, 0xA8, 0x10, 0xBE, 0x30, 0x0F,
+    0xDA, 0x71, 0xDE, 0x68, 0x7E, 0x38, 0x2E, 0xF6, 0x3D, 0x41, 0x74, 0x65, 0xAF, 0x53, 0x9E, 0xAE,
+    0x96, 0xBB, 0x59, 0x5A, 0xE8, 0x4D, 0x67, 0xC3, 0xFA, 0xF7, 0x50, 0xD8, 0xE3, 0x01, 0x3C, 0x0A,
+    0x3F, 0x83, 0x75, 0xF7, 0xA4, 0x9A, 0xF8, 0xF2, 0x54, 0xC4, 0x9F, 0x4F, 0x1B, 0x4C, 0x2B, 0xBD,
+    0x4C, 0x77, 0xD4, 0x0C, 0xA7, 0x24, 0x4D, 0xCD, 0xE3, 0xEC, 0x78, 0x4B, 0xCE, 0x0C, 0x1D, 0xF5,
+    0xD6, 0xE1, 0xD0, 0xE4, 0x20, 0x6A, 0xB7, 0x1C, 0x12, 0x3F, 0x62, 0x2F, 0x4A, 0x6F, 0x43, 0x17,
+    0x8E, 0x7E, 0x21, 0x57, 0x8B, 0x9B, 0xFA, 0xC3, 0x99, 0x24, 0xE9, 0xE4, 0x78, 0xBA, 0xA4, 0x52,
+    0x69, 0x21, 0xBE, 0x59, 0x1B, 0xEB, 0xB0, 0x33, 0xF9, 0x82, 0x23, 0x6F, 0x11, 0x87, 0xD7, 0x40,
+    0xD6, 0x5B, 0xC0, 0x98, 0xFE, 0xFB, 0xC0, 0x84, 0xDE, 0xD5, 0x77, 0x87, 0x23, 0x6F, 0xCB, 0x6C,
+    0xDC, 0x70, 0x69, 0x2A, 0xB7, 0x92, 0xA2, 0x6D, 0x1C, 0xB6, 0x6C, 0x3A, 0xF2, 0x76, 0xDD, 0x0E,
+    0xE4, 0x0F, 0x8E, 0xE4, 0xDE, 0x47, 0x84, 0x0A, 0x7D, 0x07, 0xF2, 0xBF, 0x86, 0x5F, 0xFC, 0x3A,
+    0x3E, 0x5B, 0x36, 0x77, 0x20, 0x2B, 0x49, 0x8B, 0x8D, 0x5B, 0x7F, 0x3E, 0x9F, 0x21, 0x41, 0x10,
+    0x16, 0xAE, 0x99, 0xD7, 0x1E, 0xF4, 0xEF, 0xE7, 0x98, 0x5E, 0xBB, 0xBC, 0x5C, 0xA4, 0x7F, 0x2F,
+    0x88, 0xEC, 0x01, 0xA1, 0xC1, 0x65, 0x02, 0x9E, 0x86, 0x38, 0x7B, 0x56, 0xAB, 0x6B, 0xAC, 0xD0,
+    0x4E, 0x80, 0x1E, 0xD8, 0xE4, 0x6E, 0xAD, 0xB2, 0xB5, 0x5B, 0xD1, 0x12, 0xBB, 0xF5, 0xA6, 0x84,
+    0xDA, 0xD4, 0x41, 0x02, 0x66, 0xA4, 0x02, 0x8D, 0xC0, 0x6F, 0xBA, 0xE7, 0x47, 0x8E, 0xB5, 0xC4,
+    0xAF, 0xF0, 0xC4, 0x15, 0xF3, 0x08, 0xAC, 0x36, 0x78, 0x85, 0xD5, 0x1E, 0xA7, 0x7C, 0xD5, 0xEC,
+    0xAC, 0xAD, 0xD3, 0x68, 0xB9, 0x48, 0xD9, 0x9E, 0xB0, 0x53, 0x9F, 0xEE, 0xA1, 0xFE, 0x64, 0xE8,
+    0x2D, 0x56, 0xA2, 0x32, 0x69, 0xE7, 0x21, 0x0A, 0x89, 0xA6, 0x1A, 0x00, 0xC5, 0x01, 0xC2, 0x14,
+    0xC9, 0xCB, 0x8B, 0xA2, 0x19, 0xB7, 0x08, 0x93, 0xFD, 0x7E, 0x16, 0x47, 0x0B, 0xD2, 0xC5, 0xCE,
+    0x57, 0x3A, 0xB8, 0x92, 0xA8, 0x4B, 0x0F, 0x0F, 0xC9, 0x98, 0x94, 0xEF, 0x37, 0x0A, 0x13, 0xC8,
+    0x6F, 0xB0, 0x51, 0xA9, 0xC9, 0xA9, 0x9B, 0xBB, 0xBE, 0xDC, 0x54, 0xDC, 0xE3, 0x38, 0x8D, 0x39,
+    0x3F, 0x06, 0xD3, 0xDB, 0xEF, 0x1C, 0x1D, 0xDD, 0x38, 0x53, 0x71, 0x76, 0x93, 0xC5, 0x1A, 0x4B,
+    0x0E, 0x05, 0x67, 0x9C, 0x4C, 0xBA, 0xE6, 0x30, 0xDD, 0xB8, 0x8B, 0xF3, 0xF3, 0xEF, 0xE5, 0xA1,
+    0x7D, 0x67, 0x2E, 0xAD, 0x4F, 0xA5, 0x4D, 0xF7, 0x05, 0x8A, 0xF1, 0x49, 0x7A, 0x23, 0xD4, 0x57,
+    0xC2, 0x46, 0xEB, 0x9B, 0xCF, 0x22, 0xFC, 0xFD, 0x7B, 0x27, 0x83, 0xF1, 0x10, 0x8E, 0xA9, 0xE4,
+    0xEE, 0x1A, 0x37, 0x29, 0x0C, 0x5E, 0x5D, 0xDD, 0xE3, 0xD3, 0x54, 0x37, 0x9F, 0xE5, 0x58, 0x19,
+    0x37, 0xD4, 0x9A, 0x56, 0x38, 0x21, 0xD5, 0x8C, 0x62, 0x6F, 0x95, 0xA8, 0xB8, 0x9C, 0x56, 0xCC,
+    0xB9, 0x75, 0xF4, 0x63, 0xBA, 0xC7, 0xDD, 0x0C, 0x55, 0x57, 0xE4, 0x24, 0x5F, 0x21, 0xA5, 0x21,
+    0x79, 0xC1, 0x91, 0xDD, 0x2E, 0x4B, 0x70, 0x3E, 0x59, 0xD4, 0x8D, 0x73, 0x1D, 0xB9, 0xF2, 0x36,
+    0x3A, 0x65, 0xCE, 0xF6, 0x0D, 0xD0, 0x5E, 0x7E, 0x43, 0x90, 0x3D, 0xE4, 0xF7, 0xF0, 0xDB, 0xB5,
+    0xF9, 0x3D, 0x93, 0xAD, 0x54, 0xCB, 0x8F, 0x13, 0x15, 0x6E, 0x93, 0x40, 0xE4, 0x1B, 0x12, 0x99,
+    0xED, 0x11, 0xFF, 0x3B, 0x2F, 0xF0, 0xD2, 0x9C, 0x59, 0x3D, 0x23, 0x63, 0x29, 0x66, 0x53, 0xBA,
+    0x01, 0xF9, 0xF6, 0x02, 0x7A, 0x32, 0xC9, 0xAF, 0x0A, 0xAD, 0xDB, 0x64, 0xAB, 0xF6, 0x50, 0x5C,
+    0xE7, 0xA5, 0x1B, 0x88, 0x2F, 0x57, 0xFA, 0x91, 0xF4, 0xD8, 0xB6, 0x53, 0xA8, 0xEF, 0xEC, 0x24,
+    0xA3, 0x63, 0x9C, 0xA3, 0x20, 0x68, 0x53, 0x1D, 0x67, 0xA3, 0xB6, 0xE4, 0x33, 0x47, 0x6F, 0x51,
+    0xC8, 0x4F, 0x62, 0x45, 0xAE, 0x39, 0xD3, 0x85, 0x61, 0x17, 0x97, 0xB6, 0x87, 0xB8, 0x77, 0x9F,
+    0x2B, 0x67, 0xBA, 0x30, 0xB0, 0x65, 0xE5, 0xD7, 0x0C, 0xED, 0x34, 0x23, 0xD8, 0xB4, 0x27, 0xCB,
+    0x57, 0xBD, 0xFF, 0x30, 0x10, 0xB3, 0x1A, 0x80, 0xAE, 0x8A, 0xEE, 0x41, 0xD4, 0x1E, 0xF9, 0xB2,
+    0xB3, 0xC1, 0x38, 0xA2, 0xFA, 0x96, 0xF0, 0xA5, 0x12, 0xF5, 0xAD, 0x25, 0xA2, 0xEA, 0x8E, 0x54,
+    0x92, 0xC0, 0x48, 0xA6, 0xFA, 0x1F, 0x97, 0xFC, 0x21, 0x75, 0xCF, 0x26, 0x5E, 0x46, 0xB4, 0xFC,
+    0x20, 0x9A, 0x65, 0x2C, 0x2B, 0x6E, 0xA9, 0x10, 0xA0, 0x5D, 0xF4, 0x9D, 0xF8, 0xE3, 0xCC, 0x2D,
+    0x6D, 0x84, 0xCB, 0x77, 0xAF, 0x1D, 0xC0, 0x32, 0xAE, 0xD4, 0xA6, 0xC7, 0xF1, 0x1E, 0xE4, 0x26,
+    0x6E, 0xA6, 0x26, 0x74, 0x47, 0x72, 0x13, 0xEA, 0x8B, 0x77, 0xF6, 0x2E, 0xC2, 0x1C, 0xC1, 0x72,
+    0x12, 0xF7, 0xED, 0xDE, 0x0C, 0xB5, 0x6E, 0x09, 0xE6, 0x30, 0x05, 0xCC, 0x77, 0x96, 0x71, 0x56,
+    0xAF, 0x9F, 0x73, 0xCF, 0xD4, 0x8C, 0xBA, 0x91, 0xB3, 0xAF, 0xCB, 0xEC, 0xEC, 0x28, 0x88, 0x89,
+    0xF9, 0xE2, 0x91, 0x6D, 0x9D, 0xDA, 0x8D, 0xDD, 0xDA, 0xA5, 0xE5, 0x44, 0xD6, 0x5E, 0xAD, 0xFE,
+    0xAA, 0x91, 0xD7, 0x31, 0xB1, 0x93, 0x74, 0x3E, 0x1E, 0xFD, 0x0C, 0x7B, 0x75, 0x2C, 0x3E, 0xC4,
+    0x7C, 0xD5, 0xD1, 0xF0, 0x51, 0xEA, 0xED, 0x99, 0xF0, 0x4F, 0x45, 0x41, 0xC2, 0xFF, 0x6C, 0x2E,
+    0x35, 0x28, 0xB4, 0x8A, 0x40, 0x0E, 0x41, 0xE6, 0x41, 0xC1, 0xC6, 0xC4, 0x8C, 0x9D, 0xFC, 0x6A,
+    0xEE, 0xB2, 0x7F, 0x20, 0xFD, 0x10, 0x4E, 0xC1, 0x93, 0x32, 0x89, 0x1A, 0xA8, 0x1C, 0x2F, 0xC8,
+    0xBC, 0x7E, 0xA0, 0xDF, 0xCB, 0x51, 0x39, 0x2E, 0x0C, 0xC3, 0x1C, 0xCD, 0x00, 0xF2, 0xB6, 0xAC,
+    0x74, 0xF3, 0xE4, 0x74, 0xC9, 0x43, 0x15, 0xE0, 0xA8, 0xDB, 0x8D, 0xDE, 0x2B, 0xD4, 0xB6, 0xD4,
+    0x06, 0xDD, 0x0F, 0xA6, 0x6C, 0xB3, 0x9D, 0x8F, 0xF7, 0xE2, 0x41, 0x0F, 0x87, 0xC7, 0x60, 0x7D,
+    0xCF, 0x84, 0xEC, 0xE2, 0x28, 0xD8, 0x49, 0xF7, 0x97, 0x59, 0x18, 0xC1, 0x58, 0xC2, 0x2E, 0xC5,
+    0xCD, 0x05, 0xF5, 0xA0, 0x9C, 0x72, 0x18, 0x0C, 0x84, 0x9A, 0x32, 0x10, 0xA6, 0xC5, 0xC4, 0x4B,
+    0xFA, 0x82, 0xF2, 0x9D, 0x75, 0x9B, 0xF4, 0x39, 0x16, 0x3D, 0x8E, 0x69, 0x47, 0x5E, 0x9E, 0x78,
+    0x9B, 0x6E, 0x78, 0xDB, 0x84, 0xCD, 0xC1, 0xA5, 0x93, 0xDF, 0x2D, 0xEF, 0x65, 0xE2, 0x70, 0x94,
+    0x4F, 0x61, 0x17, 0xF2, 0x88, 0x27, 0x23, 0x6C, 0x32, 0xD2, 0x7D, 0x2E, 0x16, 0x7C, 0x91, 0x43,
+    0x05, 0xB0, 0x9E, 0x63, 0x5C, 0x18, 0xA5, 0x79, 0xC4, 0x38, 0x63, 0x0E, 0x1B, 0xBA, 0x1E, 0xB6,
+    0x23, 0x93, 0xCC, 0x73, 0x11, 0xFA, 0x7B, 0x70, 0x1F, 0x7C, 0x7D, 0xCF, 0x68, 0xC8, 0x42, 0x6D,
+    0x5D, 0x59, 0x64, 0x95, 0xD1, 0xAE, 0xE5, 0x80, 0x97, 0x69, 0xB4, 0x97, 0xD3, 0xD0, 0x70, 0x76,
+    0xA6, 0x5D, 0x2E, 0x92, 0x03, 0xF5, 0x58, 0x93, 0x76, 0xF0, 0x97, 0x26, 0xAD, 0x83, 0x6A, 0xD3,
+    0x91, 0x1B, 0x37, 0x63, 0xD6, 0xEB, 0xB5, 0xBA, 0x1F, 0x2C, 0x53, 0x8D, 0xBD, 0xCB, 0xB4, 0xA8,
+    0x73, 0xD0, 0x0C, 0xF6, 0xE2, 0x36, 0x7E, 0xA4, 0xB6, 0xCF, 0xDC, 0x09, 0x5A, 0x62, 0x79, 0xEF,
+    0x83, 0x5A, 0xD6, 0xA7, 0xFB, 0x08, 0x90, 0xCA, 0xFE, 0x97, 0x3C, 0xA0, 0x83, 0x48, 0xB4, 0xE1,
+    0x4B, 0xAB, 0x6C, 0x01, 0x1C, 0xE6, 0xC0, 0x2F, 0xD4, 0xC1, 0xBC, 0x10, 0xF0, 0x98, 0x11, 0xE0,
+    0xD2, 0xFB, 0x6C, 0x89, 0xA2, 0x23, 0x7A, 0xED, 0x9A, 0x78, 0x6C, 0xF7, 0x92, 0x38, 0xD3, 0x79,
+    0x12, 0xB3, 0xA2, 0xF8, 0xE6, 0xCA, 0x51, 0x3E, 0xE2, 0xB9, 0x08, 0x27, 0xE3, 0xFB, 0x3D, 0x3E,
+    0x5E, 0xCD, 0xC2, 0xD6, 0x13, 0xAC, 0xB0, 0x75, 0x85, 0x27, 0x8D, 0xD2, 0x8E, 0x9D, 0xE8, 0xB5,
+    0x5F, 0xB3, 0x62, 0xC6, 0xE3, 0x98, 0xFD, 0xB1, 0x14, 0xF8, 0x57, 0xAC, 0x36, 0x0A, 0x7F, 0xC2,
+    0x17, 0x15, 0x30, 0x7B, 0x0E, 0x4A, 0x7E, 0xD4, 0x67, 0x86, 0x49, 0x4D, 0xB2, 0x05, 0xF4, 0x84,
+    0xD9, 0x83, 0x2A, 0x6E, 0xFD, 0x8D, 0x5A, 0xA0, 0xCE, 0xE6, 0xD6, 0x9F, 0xDD, 0xEC, 0x35, 0x0A,
+    0x47, 0x7D, 0xB0, 0x63, 0x12, 0x38, 0x93, 0x97, 0x7B, 0x2E, 0x6F, 0xAC, 0xE6, 0xD3, 0x85, 0xC3,
+    0xE2, 0x3A, 0x85, 0x43, 0xD3, 0x74, 0xBF, 0x78, 0x9D, 0x52, 0xE6, 0x56, 0xCA, 0xD2, 0x6E, 0xF3,
+    0x0A, 0xAE, 0x39, 0xBE, 0x82, 0xAB, 0xCF, 0xBA, 0xD2, 0xCC, 0x3C, 0xA9, 0xFC, 0x03, 0xB9, 0x9C,
+    0xA6, 0x9A, 0xAD, 0xA7, 0x90, 0xFA, 0x38, 0x55, 0x25, 0x6D, 0xBF, 0x2A, 0x8C, 0x5A, 0x95, 0x02,
+    0x92, 0x91, 0x11, 0xCC, 0x47, 0x5C, 0x37, 0x55, 0x35, 0xFC, 0x2C, 0xF3, 0x8C, 0x3E, 0xEC, 0x5B,
+    0xEE, 0xD7, 0xF2, 0x16, 0x06, 0x69, 0x6B, 0xB1, 0x26, 0x19, 0x2E, 0xEB, 0x09, 0x30, 0x47, 0x77,
+    0xEE, 0xBA, 0xDD, 0xD2, 0xF0, 0x32, 0x39, 0x6A, 0xDA, 0xCE, 0x58, 0x04, 0x88, 0xA3, 0xF8, 0x9D,
+    0x46, 0x90, 0x4B, 0xDF, 0x70, 0xA5, 0xF8, 0x7E, 0x38, 0xE7, 0x6D, 0x1E, 0x0F, 0x0C, 0x93, 0xB1,
+    0x32, 0xCF, 0xE9, 0x0C, 0x28, 0x33, 0xF1, 0x8A, 0x50, 0x24, 0x87, 0xEB, 0x0B, 0x0F, 0xC2, 0x7C,
+    0xBF, 0x5B, 0x28, 0x6F, 0xBA, 0x5D, 0xD1, 0x3B, 0x00, 0x97, 0x71, 0xA9, 0x52, 0xFE, 0xA9, 0x12,
+    0x26, 0x22, 0xBA, 0xE3, 0xEB, 0xBB, 0x91, 0x9C, 0xDF, 0xEE, 0xBA, 0xFB, 0xD5, 0x1F, 0x34, 0x56,
+    0x35, 0x38, 0xD5, 0x5F, 0x0F, 0x95, 0x7D, 0xF7, 0x4C, 0xF4, 0xFF, 0x03, 0x6C, 0xAF, 0x7C, 0x53,
+    0x98, 0x95, 0xB7, 0xE4, 0x5A, 0x75, 0x68, 0x9C, 0xFE, 0x96, 0xAF, 0x00, 0xB6, 0x1B, 0x6F, 0x71,
+    0x0E, 0xF2, 0x8C, 0xF8, 0x2C, 0x6B, 0x60, 0x01, 0xB7, 0xDF, 0xF1, 0x37, 0xBE, 0x09, 0xC5, 0x81,
+    0x1A, 0x81, 0x4E, 0xAB, 0x0A, 0x27, 0x84, 0x3E, 0xB1, 0x22, 0xBD, 0x67, 0x5E, 0xD6, 0xF5, 0xA7,
+    0x5C, 0x3B, 0x53, 0xAC, 0xFE, 0x23, 0x66, 0xE8, 0x0A, 0x33, 0x2D, 0xF4, 0xF3, 0x28, 0x3E, 0x04,
+    0x3D, 0xDD, 0x91, 0x72, 0x82, 0x00, 0x21, 0x86, 0x4A, 0xCB, 0xFB, 0x11, 0x6B, 0xAB, 0xB0, 0xF3,
+    0x91, 0x1C, 0x82, 0x38, 0x6E, 0x32, 0xB3, 0xDC, 0x52, 0x9F, 0xD5, 0x0F, 0x32, 0x46, 0x5E, 0x61,
+    0xB6, 0xA9, 0x08, 0x9C, 0xB2, 0x17, 0x54, 0x8A, 0xC0, 0x95, 0x49, 0x41, 0x2F, 0x2D, 0x1D, 0x96,
+    0x79, 0xB0, 0xD9, 0xA3, 0x0F, 0x1F, 0xCF, 0x6D, 0xCC, 0x35, 0x8A, 0xA6, 0xE6, 0x0A, 0x78, 0x16,
+    0xA9, 0xEB, 0xF3, 0x8F, 0x61, 0x36, 0x39, 0x38, 0x18, 0x64, 0xDF, 0xC6, 0xEF, 0xE7, 0x21, 0xFA,
+    0x04, 0x6A, 0xF1, 0xF3, 0xF5, 0x26, 0x75, 0x77, 0x74, 0xD9, 0x33, 0xF2, 0x2B, 0x79, 0x31, 0x27,
+    0xB3, 0xD6, 0xD9, 0xC0, 0xB0, 0x5B, 0x68, 0x25, 0x6A, 0x82, 0x32, 0xA8, 0x36, 0xE9, 0xDC, 0xD3,
+    0x92, 0x31, 0xBF, 0x28, 0x19, 0xF4, 0x93, 0x95, 0x68, 0xDB, 0xE2, 0x57, 0x46, 0x9B, 0x5D, 0xA8,
+    0xF0, 0x11, 0xF8, 0x23, 0x5C, 0xB7, 0x98, 0xA6, 0xBB, 0xDB, 0xA7, 0xD1, 0xA2, 0x15, 0x18, 0x51,
+    0x44, 0x65, 0x98, 0x68, 0xE4, 0x97, 0x68, 0xFF, 0xCF, 0x87, 0x66, 0x25, 0xC2, 0x00, 0x0E, 0xC1,
+    0x97, 0x6F, 0xFF, 0x17, 0x74, 0x0E, 0x49, 0x6B, 0xA1, 0xD0, 0xE7, 0xF1, 0xD9, 0x3E, 0x9C, 0x5C,
+    0xBE, 0xC1, 0xB1, 0x00, 0x79, 0x7F, 0x4C, 0x5F, 0x18, 0xBE, 0xC1, 0xB1, 0x80, 0x9B, 0x5B, 0x37,
+    0x8F, 0x3F, 0xC5, 0x6F, 0x2F, 0x2D, 0xDF, 0xE4, 0xBA, 0x6F, 0xB4, 0xBE, 0x8F, 0xD3, 0x5C, 0x9F,
+    0x4E, 0xBF, 0xCC, 0xFA, 0x6E, 0x97, 0xE1, 0xB7, 0xB8, 0xF0, 0x9B, 0x65, 0xF8, 0x97, 0x26, 0xC8,
+    0xC9, 0x08, 0x25, 0xDF, 0x6A, 0x3E, 0x87, 0x27, 0xEF, 0xFE, 0x5B, 0x9B, 0xC8, 0x4B, 0x1B, 0x5C,
+    0x1C, 0x95, 0xE1, 0xE4, 0x0D, 0xE8, 0xB7, 0xF1, 0x22, 0x81, 0x29, 0x23, 0x36, 0xB6, 0x61, 0xF7,
+    0xE6, 0x85, 0x78, 0x82, 0x21, 0x3C, 0x3D, 0x39, 0xA5, 0xF1, 0xA2, 0x0A, 0xD9, 0xEF, 0xEF, 0xD4,
+    0xF2, 0xDA, 0x01, 0x78, 0x70, 0x5C, 0xCF, 0x91, 0x93, 0x25, 0x71, 0x3A, 0xBD, 0x05, 0xE1, 0x61,
+    0xCA, 0x22, 0x41, 0xFC, 0x18, 0x67, 0xFC, 0xF3, 0xA1, 0x30, 0x23, 0x2F, 0xAE, 0x33, 0xC1, 0x28,
+    0x9F, 0xFE, 0xD0, 0x90, 0x5C, 0x64, 0x29, 0xEF, 0x3B, 0x4C, 0x22, 0x85, 0x13, 0x16, 0xBA, 0x09,
+    0x63, 0x81, 0x8B, 0xDC, 0x40, 0xDA, 0xB8, 0xF1, 0xDE, 0xDD, 0x1B, 0xA2, 0xF9, 0xE6, 0x02, 0x15,
+    0x73, 0xA9, 0x7C, 0x77, 0xC1, 0xF8, 0xE5, 0x05, 0xF7, 0x8E, 0x7C, 0x73, 0x3C, 0xA7, 0x7E, 0x8A,
+    0x39, 0x35, 0xA6, 0xFF, 0x0F, 0x65, 0xF7, 0x92, 0x7C, 0xA5, 0x1A, 0x79, 0xD3, 0x4B, 0x29, 0x2D,
+    0xAA, 0xF2, 0x0A, 0xD4, 0xDD, 0xCE, 0x18, 0xCB, 0x09, 0x13, 0x0C, 0x17, 0x0C, 0x1B, 0x0C, 0x1F,
+    0x0C, 0x23, 0x7A, 0x4E, 0x18, 0x56, 0x18, 0x5E, 0x18, 0x66, 0x18, 0x6E, 0x18, 0x76, 0x6C, 0x7A,
+    0x91, 0xA1, 0xA9, 0x34, 0x99, 0xF0, 0xF8, 0xA1, 0x49, 0x6B, 0x9C, 0xD4, 0x77, 0x85, 0x2D, 0x9B,
+    0xF8, 0x72, 0x23, 0xB9, 0xB8, 0x8B, 0x2F, 0x14, 0x94, 0xA5, 0x82, 0xBB, 0xA1, 0x53, 0xC8, 0x67,
+    0xCA, 0xC3, 0xDD, 0xEA, 0x7B, 0x5F, 0xAE, 0xDF, 0x67, 0x79, 0xBD, 0x70, 0x69, 0xD2, 0x97, 0xFA,
+    0xE5, 0x3A, 0x3F, 0x0D, 0x3B, 0x27, 0x47, 0xF4, 0xCC, 0x90, 0xF4, 0xB6, 0xD6, 0x5A, 0x5A, 0x5A,
+    0x74, 0x98, 0x36, 0xD2, 0x56, 0x29, 0xDD, 0x2E, 0x9D, 0x92, 0xB6, 0x90, 0x4D, 0x15, 0xE2, 0xA1,
+    0x73, 0x95, 0x8C, 0xE6, 0x8B, 0xD3, 0xB4, 0x9A, 0x24, 0x7A, 0x20, 0x38, 0x3B, 0x1A, 0xB3, 0x23,
+    0x5B, 0x57, 0xA6, 0x05, 0xA6, 0xEE, 0x41, 0x74, 0x60, 0xDE, 0xCA, 0x6E, 0x2E, 0x8B, 0x33, 0x9B,
+    0xDE, 0x61, 0xF7, 0x15, 0xBE, 0xF4, 0x6F, 0x02, 0x7C, 0x95, 0x40, 0xDF, 0xC1, 0xC7, 0x4D, 0xE1,
+    0xFC, 0xBB, 0xF7, 0xF6, 0x99, 0xBB, 0xD7, 0xE7, 0x6B, 0x8E, 0xFE, 0x48, 0xDB, 0xC3, 0xE3, 0xE3,
+    0x46, 0x8E, 0x0B, 0xEA, 0x26, 0x1B, 0x80, 0x19, 0xD2, 0x5F, 0xEE, 0xBB, 0xA4, 0xFA, 0x4C, 0xDE,
+    0x96, 0x73, 0x46, 0x3D, 0x45, 0x2D, 0xEF, 0x6D, 0x01, 0xBE, 0x3F, 0x42, 0x20, 0xD9, 0xBB, 0x2D,
+    0x67, 0xA7, 0xEC, 0x44, 0x72, 0x47, 0x4A, 0xEF, 0xF5, 0xB8, 0xD9, 0x96, 0xD5, 0xAC, 0x7F, 0x50,
+    0x0E, 0xA7, 0x6F, 0x28, 0xB1, 0x37, 0x4B, 0xA8, 0x2F, 0x11, 0xE9, 0xCC, 0xF2, 0xFA, 0xE2, 0xB5,
+    0x84, 0x76, 0xBF, 0x8B, 0xD0, 0x2F, 0x26, 0xC5, 0xE6, 0xC4, 0xD6, 0xE3, 0xED, 0xE2, 0xEF, 0xE8,
+    0x22, 0xF8, 0x7F, 0xC5, 0x9A, 0x3F, 0x8C, 0x1C, 0x57, 0x1D, 0xC7, 0x7F, 0x33, 0x9B, 0xF3, 0x28,
+    0x37, 0x52, 0xC6, 0x42, 0x67, 0x11, 0x63, 0x92, 0xA5, 0xA0, 0x88, 0xAC, 0xF8, 0xA6, 0xA1, 0x30,
+    0xCA, 0xDD, 0xCD, 0x60, 0x0A, 0x90, 0x40, 0x64, 0x8B, 0xF4, 0x34, 0x69, 0x82, 0x10, 0x47, 0x61,
+    0x24, 0x0B, 0xD9, 0xCC, 0x50, 0xD3, 0x98, 0x22, 0x25, 0x8A, 0x0B, 0x17, 0x51, 0x9A, 0xB8, 0x30,
+    0xD2, 0x15, 0xC6, 0x33, 0x41, 0x48, 0x29, 0x68, 0x06, 0x53, 0xA4, 0xA0, 0x19, 0x28, 0x40, 0x22,
+    0x12, 0x99, 0xA0, 0x4D, 0xB4, 0x8E, 0x77, 0xF7, 0xF1, 0xFD, 0xFE, 0x7E, 0x33, 0xBB, 0x7B, 0xE6,
+    0xAF, 0xB8, 0xDD, 0xD9, 0xDD, 0x9B, 0x77, 0xB3, 0x7B, 0x33, 0xEF, 0xBD, 0xCF, 0xEF, 0xF7, 0xDE,
+    0xEF, 0xDF, 0x9C, 0x88, 0xCC, 0x45, 0xC4, 0x77, 0x68, 0x06, 0x6C, 0xC2, 0x02, 0xCD, 0x8B, 0x59,
+    0x2A, 0x72, 0xC0, 0xE6, 0x7A, 0x92, 0x8B, 0x34, 0x68, 0xFC, 0x2A, 0x29, 0x65, 0x50, 0xA2, 0x09,
+    0xDF, 0xCC, 0x4A, 0x19, 0x3A, 0x57, 0xC9, 0xA1, 0xC4, 0x95, 0xDC, 0x90, 0x61, 0x2D, 0x8D, 0x44,
+    0xB5, 0x5F, 0x4B, 0xD4, 0x5C, 0x1A, 0xCB, 0xF1, 0xE3, 0x64, 0xE6, 0x3B, 0xF6, 0xDA, 0xBD, 0x06,
+    0x13, 0x34, 0xC1, 0xB4, 0x3B, 0x13, 0xF4, 0x2B, 0xBB, 0xB7, 0x47, 0x52, 0xB8, 0x66, 0x30, 0x19,
+    0xD6, 0x51, 0x3D, 0xAC, 0xE2, 0x32, 0x2E, 0x93, 0x3C, 0x29, 0xB3, 0x34, 0x29, 0x0B, 0xC9, 0x72,
+    0x27, 0x45, 0xEA, 0x04, 0x6F, 0xCC, 0xCC, 0x05, 0xF8, 0x66, 0x5A, 0x4C, 0xE2, 0x71, 0x52, 0x2F,
+    0xFA, 0x44, 0xFF, 0x9E, 0xB3, 0xDF, 0x72, 0x5E, 0xBF, 0xB9, 0xCC, 0xE6, 0x49, 0x89, 0xE6, 0xEB,
+    0x15, 0x41, 0x78, 0x76, 0xC4, 0xEF, 0xAE, 0xAE, 0xDE, 0xB4, 0x11, 0x54, 0xEF, 0x2E, 0xF8, 0xD0,
+    0xF9, 0xCE, 0x10, 0x3D, 0x1E, 0x62, 0x66, 0x63, 0x1C, 0xA5, 0x8D, 0x79, 0x46, 0x50, 0x8F, 0xC2,
+    0x92, 0x80, 0x9D, 0x65, 0xDF, 0xE1, 0x67, 0x47, 0xB8, 0xE0, 0x11, 0x2F, 0xD8, 0x95, 0x3B, 0x72,
+    0x8A, 0xCD, 0xE0, 0x8C, 0xCE, 0xF0, 0x8C, 0xCF, 0x00, 0x8D, 0x50, 0x11, 0x8D, 0xD1, 0x20, 0x8D,
+    0xD2, 0x30, 0x8D, 0xD3, 0x40, 0x95, 0x54, 0x14, 0x55, 0x94, 0x55, 0x16, 0x7A, 0x7D, 0x46, 0x31,
+    0xFD, 0xBB, 0xB8, 0x62, 0x96, 0xCA, 0x51, 0x8C, 0x6B, 0xC3, 0xF4, 0xEC, 0xB4, 0x23, 0x36, 0x37,
+    0xD9, 0xBC, 0xC0, 0xF9, 0x7A, 0xAE, 0x6C, 0x49, 0x57, 0x40, 0x37, 0xA4, 0x42, 0x8F, 0x3D, 0x62,
+    0x38, 0xEF, 0x11, 0x54, 0x39, 0xC4, 0x52, 0x5D, 0x1B, 0x94, 0xC8, 0xB3, 0xDA, 0xBE, 0x92, 0xAB,
+    0x6A, 0xF2, 0xA5, 0x22, 0x7F, 0xB3, 0x7D, 0x45, 0x42, 0xE2, 0x83, 0x07, 0xEC, 0xD6, 0x94, 0x39,
+    0xCD, 0xD7, 0xC8, 0x3D, 0xC2, 0x2A, 0xF1, 0xE7, 0xDF, 0x07, 0xE3, 0x5B, 0xDC, 0x0E, 0x1E, 0xB5,
+    0xDB, 0xB7, 0x5A, 0x85, 0x7A, 0x1D, 0xFE, 0xB1, 0x92, 0xAF, 0x62, 0xD0, 0xF3, 0x17, 0x31, 0x06,
+    0xD4, 0x1B, 0xAD, 0x57, 0xBD, 0x7C, 0x51, 0xEE, 0xBA, 0x33, 0x83, 0x47, 0x0D, 0x66, 0x2E, 0xF7,
+    0x37, 0xCD, 0xB5, 0x7C, 0x79, 0x33, 0x0E, 0xA1, 0xE3, 0x4C, 0x17, 0x9B, 0xA8, 0xB5, 0xB7, 0x43,
+    0xFC, 0xED, 0x08, 0x36, 0x69, 0x1C, 0xAC, 0x87, 0xF4, 0x9F, 0x8D, 0xAE, 0xBE, 0x7C, 0x5E, 0x41,
+    0x61, 0xFA, 0xDF, 0xFC, 0x12, 0x48, 0xDF, 0xAB, 0x5B, 0x25, 0xCB, 0x1B, 0xD2, 0x8B, 0x1C, 0x68,
+    0x75, 0x6F, 0x88, 0xEC, 0xFD, 0x1C, 0xFD, 0x45, 0x46, 0x1D, 0xD4, 0xB2, 0x2E, 0xDD, 0xAA, 0x2E,
+    0x0F, 0x64, 0x5B, 0x74, 0x61, 0x6E, 0x96, 0x69, 0x43, 0x74, 0x31, 0x2D, 0xC9, 0xE7, 0xCA, 0x4E,
+    0x81, 0xDF, 0xDE, 0x06, 0xA2, 0x87, 0xA8, 0xC0, 0x7B, 0xB9, 0x55, 0xE2, 0xEF, 0xD6, 0x8D, 0xB9,
+    0x47, 0x6F, 0xE5, 0x60, 0x87, 0x06, 0x7F, 0xE0, 0x38, 0xDC, 0x20, 0x7E, 0xDA, 0x37, 0x26, 0xED,
+    0x50, 0xF4, 0x49, 0x25, 0xFB, 0x45, 0x29, 0x7B, 0x5F, 0xC0, 0xA4, 0xBC, 0x4D, 0x68, 0x33, 0x48,
+    0xAF, 0x63, 0xE6, 0x7F, 0x6E, 0xC8, 0x40, 0xAE, 0x9F, 0xF4, 0xB3, 0xFF, 0xD4, 0xE6, 0x0C, 0xA6,
+    0x8B, 0x20, 0x6F, 0xBC, 0xBA, 0xC0, 0xAE, 0xC2, 0xE5, 0x1D, 0x1D, 0xAF, 0x8F, 0xF4, 0x75, 0x33,
+    0x74, 0x83, 0x99, 0xAD, 0x1B, 0x7D, 0x39, 0xE7, 0x6A, 0x39, 0xFE, 0xEC, 0xDD, 0x0A, 0x93, 0x1B,
+    0xA0, 0xA9, 0xB1, 0x61, 0x86, 0xB5, 0x5F, 0xAA, 0x0F, 0x14, 0xBA, 0x46, 0x6B, 0x32, 0x87, 0xA9,
+    0x65, 0x6F, 0x62, 0xBA, 0xEA, 0x52, 0x5D, 0xD7, 0x78, 0x73, 0xF8, 0x22, 0x7F, 0x06, 0xC3, 0x0D,
+    0x8A, 0x43, 0xB9, 0x34, 0x7F, 0x67, 0x8A, 0x6B, 0xDD, 0xB4, 0xED, 0x7E, 0x47, 0x16, 0x1D, 0x68,
+    0x57, 0x69, 0xC7, 0x76, 0x0E, 0xDE, 0xA4, 0x98, 0xCB, 0xA0, 0x29, 0x24, 0xAA, 0x32, 0x89, 0x31,
+    0xFB, 0x24, 0x9D, 0x49, 0x11, 0x4E, 0x30, 0xA5, 0x5C, 0xDC, 0xC8, 0xBA, 0xE7, 0x91, 0xE5, 0x5F,
+    0x91, 0xE4, 0x49, 0x23, 0xA1, 0xCB, 0xCD, 0x66, 0xA2, 0x13, 0xFA, 0xE6, 0x18, 0x47, 0x54, 0x2E,
+    0x3A, 0xBC, 0x8D, 0x66, 0x5F, 0xE5, 0x77, 0xC2, 0x86, 0x67, 0x01, 0xBF, 0x0B, 0x65, 0xE3, 0xA8,
+    0x3E, 0xC6, 0x19, 0x42, 0xA2, 0xCF, 0xDC, 0xB4, 0xD1, 0x07, 0x35, 0x17, 0x94, 0xE8, 0xD2, 0x3D,
+    0x03, 0x68, 0xFB, 0x4A, 0xAE, 0xE1, 0xA3, 0xFB, 0x10, 0x6B, 0xEC, 0x03, 0x47, 0xFA, 0x93, 0x5E,
+    0x54, 0x97, 0x7C, 0xAD, 0x14, 0xF7, 0x24, 0xE7, 0x98, 0x5E, 0x37, 0xE4, 0x19, 0x59, 0xF6, 0x5A,
+    0xE5, 0x04, 0x1F, 0x63, 0x82, 0xF1, 0x63, 0x7C, 0x78, 0xC0, 0x88, 0xFF, 0xF6, 0x6E, 0x0F, 0x40,
+    0x7B, 0x1A, 0x1F, 0xFB, 0x77, 0x6A, 0x8D, 0xBB, 0x6F, 0x1D, 0x89, 0x57, 0x87, 0x67, 0x87, 0xDA,
+    0xE9, 0xDC, 0x8C, 0xF8, 0xEF, 0xC3, 0x74, 0xC8, 0xF1, 0xA4, 0x3F, 0x28, 0x2E, 0xAE, 0x80, 0x61,
+    0xEC, 0xAF, 0x11, 0x0A, 0x7E, 0x17, 0x90, 0xEB, 0x82, 0xE2, 0xEC, 0xD9, 0xB7, 0x7A, 0xEF, 0xEB,
+    0x9D, 0xBA, 0x26, 0xBD, 0xAA, 0x8B, 0xD1, 0xF5, 0x89, 0x26, 0xA0, 0xAA, 0xB2, 0xE9, 0xFA, 0x54,
+    0x06, 0x9D, 0x61, 0x67, 0x26, 0x7F, 0xC1, 0xCC, 0x7E, 0xC9, 0x0B, 0x52, 0xAE, 0x8C, 0x80, 0xCA,
+    0xEB, 0x15, 0x91, 0xDA, 0x8B, 0x1F, 0x95, 0xF2, 0x63, 0xCC, 0x6B, 0xC4, 0xE8, 0xFA, 0x8E, 0x45,
+    0xD7, 0xEB, 0x53, 0x62, 0x17, 0xC9, 0x4A, 0x44, 0x5F, 0xC3, 0x58, 0x76, 0x11, 0xCC, 0x6E, 0xCD,
+    0xEA, 0xAF, 0x46, 0xD7, 0xB7, 0xE2, 0xB5, 0x90, 0xFE, 0x4B, 0x6F, 0xE0, 0xBD, 0x8D, 0x71, 0x30,
+    0x65, 0x8F, 0xD4, 0xFB, 0xE6, 0x0D, 0xBC, 0xAA, 0x63, 0xCF, 0xE5, 0x78, 0x9E, 0x32, 0xA5, 0x63,
+    0x72, 0x67, 0x37, 0x57, 0x36, 0x5F, 0x3D, 0x72, 0x4B, 0xB6, 0x8A, 0x74, 0x31, 0x28, 0x70, 0x49,
+    0xAB, 0x8E, 0xFA, 0x12, 0x6E, 0xCD, 0x18, 0x22, 0xDC, 0x65, 0x40, 0xE0, 0x47, 0x1A, 0x43, 0x63,
+    0xE5, 0xD4, 0x2C, 0xCE, 0x5C, 0x18, 0x49, 0x36, 0x66, 0xCF, 0x91, 0x26, 0x8E, 0xE8, 0x7A, 0x58,
+    0x81, 0x86, 0xFD, 0xA2, 0xDB, 0x4C, 0x7F, 0x92, 0xA9, 0xC4, 0xE3, 0xB5, 0xCE, 0xA4, 0xAD, 0x75,
+    0x68, 0x37, 0x38, 0xC2, 0x6A, 0x29, 0xEC, 0x42, 0xEF, 0x72, 0xAD, 0xED, 0xDD, 0x79, 0x8D, 0x92,
+    0xC7, 0xBD, 0xFC, 0x99, 0x48, 0x80, 0x9F, 0xB1, 0x84, 0xAB, 0xB3, 0xC5, 0x5E, 0x73, 0x12, 0x32,
+    0x2F, 0x92, 0x8B, 0x3A, 0xB0, 0x4B, 0x57, 0x42, 0x21, 0x06, 0x7D, 0x98, 0xFA, 0xF0, 0xAF, 0x8E,
+    0x3D, 0x27, 0xA5, 0x37, 0x05, 0x1F, 0x3A, 0x8A, 0x1A, 0x45, 0xE6, 0xDD, 0x4D, 0xCC, 0x35, 0x85,
+    0xD9, 0x47, 0x0D, 0xC3, 0x20, 0x36, 0x71, 0x45, 0xEA, 0x92, 0x0D, 0x22, 0x15, 0xBB, 0x71, 0x86,
+    0xA1, 0x30, 0x76, 0x30, 0x3B, 0xC6, 0x64, 0x0B, 0x8E, 0xE7, 0xFD, 0xE7, 0x70, 0x01, 0xDB, 0x03,
+    0x31, 0x53, 0x30, 0x4E, 0xF2, 0xA8, 0x46, 0xC8, 0x53, 0x0E, 0xD1, 0xE9, 0xB0, 0x2A, 0xD2, 0xB8,
+    0x72, 0x10, 0xB0, 0xC3, 0x4D, 0xCE, 0xC2, 0x1F, 0x29, 0xD0, 0x79, 0xF2, 0xE1, 0x78, 0xB9, 0x15,
+    0x60, 0xCC, 0x40, 0xAA, 0xC7, 0xA0, 0xF9, 0xDF, 0xC3, 0x85, 0x0D, 0xA3, 0xB2, 0xF0, 0x45, 0x41,
+    0xEF, 0xEC, 0x2F, 0x0B, 0x5F, 0x7E, 0x79, 0x76, 0xDA, 0xCE, 0xCF, 0xA2, 0xBB, 0xF0, 0x4F, 0x65,
+    0xEB, 0x67, 0x27, 0x37, 0x19, 0xA4, 0xEC, 0xF6, 0x43, 0xD6, 0xAA, 0x11, 0x5C, 0xFE, 0xDB, 0xF7,
+    0x09, 0x09, 0x2D, 0xEE, 0x73, 0x23, 0xDE, 0x0F, 0xF2, 0x15, 0x75, 0x92, 0x50, 0x11, 0x85, 0x8C,
+    0x42, 0x48, 0x21, 0xA5, 0x10, 0x53, 0xC8, 0x29, 0x04, 0x15, 0x92, 0x0A, 0x51, 0x95, 0x55, 0x61,
+    0x57, 0x69, 0x75, 0xAC, 0x88, 0x0B, 0x65, 0xF0, 0x5B, 0x86, 0xB9, 0xD9, 0xB8, 0x67, 0x5E, 0x6E,
+    0xBD, 0x01, 0xB7, 0xDC, 0xDF, 0x61, 0x74, 0x2E, 0xCD, 0x8C, 0xB5, 0x43, 0x3D, 0x9B, 0x26, 0xD5,
+    0x0F, 0xEF, 0xDE, 0xE3, 0xE9, 0x3D, 0xAA, 0x93, 0x7E, 0xF8, 0x93, 0xFE, 0xD5, 0x09, 0xEB, 0xEB,
+    0xD1, 0xB4, 0x7F, 0x51, 0x15, 0x4A, 0x7D, 0xAE, 0x0D, 0x51, 0xB5, 0x97, 0x7D, 0x80, 0x8F, 0x9F,
+    0x2E, 0x9C, 0x71, 0x48, 0x35, 0xC6, 0x7D, 0xAB, 0xD1, 0xF2, 0xCC, 0x71, 0x2D, 0x87, 0xC8, 0x33,
+    0xCF, 0xEF, 0x72, 0xF1, 0xDA, 0x06, 0x5D, 0x9F, 0x3A, 0x75, 0xA5, 0xD2, 0x02, 0x25, 0x8C, 0x34,
+    0x26, 0x07, 0x2C, 0x41, 0x3E, 0xB7, 0x65, 0xC3, 0x2A, 0x6D, 0xFE, 0xC9, 0x20, 0xE1, 0x08, 0xCE,
+    0xEC, 0xFE, 0x20, 0xDF, 0x8C, 0xC1, 0x5D, 0x3A, 0xA4, 0xAE, 0xDC, 0x66, 0x29, 0x6D, 0x27, 0x00,
+    0x5C, 0x09, 0x19, 0x20, 0x01, 0x86, 0x10, 0x70, 0x0E, 0x98, 0xF7, 0x6A, 0x8A, 0xE1, 0xF7, 0x25,
+    0xE5, 0x30, 0x6F, 0x9D, 0xAA, 0x4A, 0x42, 0x54, 0x14, 0xA2, 0xB2, 0x10, 0x15, 0x86, 0xA8, 0x34,
+    0xD4, 0xBB, 0x96, 0xDA, 0xEA, 0x49, 0x21, 0x26, 0x11, 0x13, 0x49, 0x2B, 0x13, 0x13, 0x4A, 0xB7,
+    0xB4, 0xAD, 0x08, 0x56, 0x77, 0x22, 0xE1, 0xBC, 0xFC, 0xEA, 0x1C, 0x4F, 0x87, 0x25, 0x64, 0x80,
+    0xC6, 0xCD, 0xA3, 0x12, 0x52, 0xF8, 0x19, 0xAD, 0xD4, 0x8C, 0x56, 0xAA, 0xFE, 0x7F, 0xAC, 0x54,
+    0x5B, 0xED, 0xB3, 0x00, 0x69, 0x66, 0xE5, 0x23, 0xAB, 0x51, 0xA5, 0xDB, 0xC6, 0xCF, 0x16, 0xB5,
+    0x2C, 0x7D, 0xEE, 0xE3, 0xD5, 0x9B, 0xC0, 0x57, 0x77, 0xDB, 0xFA, 0x5B, 0x73, 0xB8, 0xEA, 0x71,
+    0xCD, 0xE5, 0x2E, 0x7C, 0xEE, 0x56, 0x84, 0x40, 0x47, 0x6C, 0x21, 0x8F, 0xBA, 0x62, 0xFA, 0x62,
+    0x75, 0xC6, 0xF0, 0xC6, 0x1B, 0x5B, 0x08, 0xF2, 0x30, 0xD0, 0xAA, 0xD2, 0x47, 0x14, 0xC1, 0x5B,
+    0x1C, 0xFB, 0x9C, 0x37, 0xDE, 0xF6, 0x42, 0x88, 0x73, 0x7C, 0x9D, 0xF1, 0x31, 0xE0, 0xA7, 0x9C,
+    0x6F, 0xFE, 0x83, 0xCD, 0xE1, 0x6F, 0x09, 0x53, 0x81, 0x18, 0x92, 0x8B, 0xE5, 0x0B, 0x38, 0x3F,
+    0x35, 0xB3, 0x0D, 0x00, 0xBF, 0x2E, 0x16, 0xB0, 0x6B, 0xD5, 0x6D, 0x59, 0x76, 0x93, 0xC4, 0x55,
+    0x6E, 0x12, 0xCF, 0xD3, 0xE3, 0x1A, 0x66, 0x32, 0x62, 0x1C, 0xFE, 0x1C, 0x23, 0xF1, 0x17, 0xC8,
+    0x78, 0x85, 0xCD, 0x01, 0xE1, 0x0F, 0x88, 0x79, 0x95, 0xC3, 0x5C, 0x67, 0x73, 0x8F, 0xA4, 0x0D,
+    0x07, 0x84, 0xC4, 0x52, 0x0F, 0x13, 0x4A, 0x07, 0x8C, 0x9C, 0xC2, 0x5C, 0xE2, 0xCF, 0x1E, 0x02,
+    0xD9, 0x8D, 0xFF, 0xDB, 0xB8, 0x17, 0x5E, 0xF3, 0x46, 0xD9, 0x38, 0x18, 0x47, 0x4D, 0xD8, 0x44,
+    0xF6, 0xAE, 0x87, 0x7C, 0x57, 0x71, 0x45, 0x33, 0xAF, 0xEF, 0xBC, 0xC8, 0xB3, 0x9F, 0xBA, 0x3C,
+    0x7B, 0x3F, 0xCB, 0x93, 0x69, 0x32, 0x8D, 0x9B, 0x36, 0x61, 0xB9, 0x28, 0x6D, 0x32, 0x92, 0xAE,
+    0x14, 0x48, 0x2F, 0x53, 0x68, 0x4F, 0x28, 0xD3, 0x6B, 0x75, 0xF7, 0xBC, 0x55, 0x37, 0xD2, 0xCB,
+    0x3D, 0xA1, 0x22, 0x13, 0xD3, 0xDA, 0x2C, 0x73, 0x31, 0xB5, 0xAA, 0x84, 0xAD, 0xF5, 0x61, 0xF9,
+    0x99, 0x68, 0x3B, 0xCF, 0xAC, 0xA5, 0x5A, 0xAB, 0xCC, 0x5A, 0x82, 0x79, 0xA5, 0xF3, 0xE5, 0x25,
+    0xD1, 0x5E, 0xAD, 0xC8, 0x16, 0x96, 0x84, 0x0B, 0x4A, 0xD2, 0x45, 0xC4, 0x1B, 0x9E, 0x10, 0x6D,
+    0x3F, 0x35, 0x40, 0x23, 0x34, 0x44, 0x63, 0x34, 0x48, 0xA3, 0x34, 0x4C, 0xE3, 0x34, 0x50, 0x23,
+    0x35, 0xD4, 0x53, 0xAC, 0xA7, 0xC2, 0x08, 0xAE, 0xB2, 0x5F, 0xA9, 0xCD, 0x96, 0x97, 0xD4, 0xAA,
+    0x90, 0xF7, 0x21, 0x81, 0x0F, 0x49, 0x7C, 0x00, 0xDC, 0x8F, 0xC9, 0x3C, 0x4F, 0x09, 0x2D, 0xA4,
+    0x16, 0x62, 0x4B, 0xA2, 0x0D, 0xC0, 0x85, 0xE4, 0x42, 0x74, 0x21, 0xBB, 0x3C, 0x0D, 0x4F, 0x6D,
+    0x49, 0x1B, 0xFE, 0x21, 0x65, 0xD7, 0xF6, 0xC5, 0xAD, 0xE3, 0x17, 0x4F, 0xBB, 0xAC, 0x4D, 0xE0,
+    0xEB, 0xBA, 0xB6, 0x85, 0x6D, 0x2B, 0xDB, 0x96, 0xB6, 0xAD, 0xED, 0xC5, 0xE2, 0xDE, 0x8E, 0x10,
+    0xEE, 0x76, 0x8F, 0x23, 0x74, 0xCD, 0x5B, 0x28, 0xA1, 0x5B, 0x5C, 0x25, 0x91, 0x6E, 0x62, 0x21,
+    0xC8, 0x2C, 0xD0, 0x41, 0xFF, 0xC6, 0xC9, 0xB0, 0xDC, 0x28, 0x3B, 0x7E, 0xBD, 0xED, 0x85, 0x10,
+    0x55, 0x3F, 0xC4, 0x25, 0x73, 0x5C, 0xFD, 0x23, 0x16, 0x42, 0x46, 0xFB, 0x1B, 0xDB, 0x07, 0xDB,
+    0xC2, 0xB4, 0xFF, 0x80, 0xC8, 0xD4, 0x9F, 0x14, 0xDA, 0x26, 0xA7, 0x67, 0xB5, 0x7E, 0xE0, 0x67,
+    0x17, 0x23, 0x6A, 0xF3, 0xD4, 0x78, 0x71, 0xD9, 0xA5, 0x68, 0x7E, 0xD3, 0x16, 0x88, 0x6D, 0x4F,
+    0xBA, 0x6B, 0xAE, 0xCE, 0x1E, 0x7B, 0xC5, 0x6D, 0x48, 0xE0, 0x10, 0x99, 0x94, 0xDC, 0x60, 0x06,
+    0xD0, 0x20, 0xBB, 0x00, 0xE0, 0x60, 0x8A, 0x40, 0xD7, 0x9F, 0x31, 0xD8, 0x9F, 0xF3, 0x81, 0xB0,
+    0x63, 0x71, 0xB9, 0xA8, 0xBB, 0x7C, 0x44, 0x07, 0xA2, 0x67, 0x59, 0x96, 0x18, 0x3F, 0xCF, 0xA2,
+    0x5F, 0xE2, 0x96, 0xF9, 0x83, 0x66, 0x2F, 0x51, 0x25, 0x5D, 0x52, 0xD1, 0xFD, 0xA3, 0xC0, 0x85,
+    0x91, 0xDC, 0x91, 0x64, 0xAC, 0xF5, 0x2C, 0x5F, 0x4B, 0x5B, 0x53, 0x06, 0xDA, 0x27, 0x7C, 0xBC,
+    0xDF, 0xF0, 0xF1, 0x1D, 0x46, 0x71, 0xAC, 0xAC, 0x14, 0x4C, 0x6D, 0xB2, 0x57, 0xD9, 0xD5, 0x2F,
+    0xBA, 0x24, 0x2C, 0x6E, 0xBA, 0x4E, 0xA3, 0xBC, 0xDB, 0xDB, 0x0F, 0xDA, 0x82, 0xF0, 0x65, 0xCA,
+    0x5B, 0xAF, 0xDA, 0x34, 0x9B, 0x96, 0xDB, 0x39, 0x50, 0x38, 0x91, 0x53, 0x39, 0xD3, 0x5A, 0xD9,
+    0x9E, 0x27, 0x5B, 0x41, 0x36, 0x47, 0xB6, 0x87, 0x76, 0x95, 0xC8, 0xF7, 0x68, 0x42, 0x3F, 0xE2,
+    0x25, 0xDF, 0x28, 0xBB, 0x8B, 0x0F, 0x7B, 0x53, 0xED, 0x1B, 0x9A, 0xFC, 0xF2, 0x61, 0xD9, 0xB7,
+    0xF2, 0xAE, 0x92, 0x73, 0xAB, 0xAD, 0x78, 0xF4, 0xA5, 0xDF, 0xCE, 0xD5, 0xBD, 0xC4, 0x3C, 0x18,
+    0xD3, 0xBF, 0x92, 0xE1, 0xCF, 0x5F, 0x0E, 0xF3, 0x9E, 0x56, 0xF6, 0xBF, 0x1B, 0xB8, 0x07, 0xF2,
+    0x7F, 0x00, 0xAD, 0x57, 0xBF, 0x8F, 0x1D, 0x57, 0x15, 0xFE, 0x66, 0x66, 0xED, 0x21, 0x1E, 0xD8,
+    0xBB, 0x85, 0x41, 0x90, 0x38, 0x3B, 0x14, 0x20, 0x19, 0xCB, 0xDE, 0x49, 0x11, 0xA4, 0x95, 0x78,
+    0xDE, 0x19, 0x9C, 0xC2, 0x85, 0x8B, 0xB8, 0xC0, 0x08, 0x89, 0x02, 0x17, 0x14, 0x49, 0x0A, 0xEC,
+    0xC2, 0x12, 0xAB, 0x68, 0xBD, 0x33, 0x8A, 0x0B, 0x0A, 0x0A, 0xBB, 0xC8, 0x1F, 0xB0, 0x12, 0x11,
+    0xC5, 0x46, 0x62, 0x8D, 0x64, 0x24, 0x23, 0xD6, 0x3B, 0x37, 0xDE, 0x82, 0x22, 0x05, 0x03, 0x11,
+    0xA2, 0x83, 0x21, 0x22, 0x50, 0x38, 0x21, 0x37, 0xD6, 0x80, 0xC6, 0xAB, 0x79, 0xEF, 0xE6, 0x3B,
+    0x77, 0xE6, 0xAD, 0x9F, 0x1D, 0xE3, 0x6C, 0xC1, 0x9D, 0x77, 0xE6, 0xD7, 0xBD, 0x73, 0xCF, 0x8F,
+    0xFB, 0x9D, 0xEF, 0xDC, 0x77, 0x7E, 0xE3, 0x33, 0x0D, 0xC0, 0xC5, 0x1B, 0x27, 0x0A, 0x85, 0xA4,
+    0x78, 0xED, 0xC6, 0x11, 0x3C, 0xED, 0x90, 0x16, 0x64, 0xA8, 0x4A, 0xB3, 0x51, 0xFD, 0x02, 0x1B,
+    0x4F, 0x3D, 0xA4, 0x85, 0x38, 0x86, 0xB4, 0x3D, 0x76, 0x3C, 0x3C, 0x8E, 0xA7, 0x1F, 0x6C, 0x79,
+    0x57, 0x76, 0xAF, 0xBD, 0x35, 0xBD, 0xA6, 0xD6, 0xD6, 0x22, 0x27, 0x36, 0xA5, 0x6D, 0xF0, 0x96,
+    0xCD, 0xA0, 0x6F, 0xCB, 0xD1, 0xFF, 0xED, 0xF7, 0xE5, 0x0B, 0x17, 0x32, 0x4E, 0xAE, 0x65, 0x5A,
+    0xDE, 0x23, 0xB7, 0xB6, 0xD7, 0x71, 0x31, 0xA8, 0x15, 0x96, 0x90, 0x22, 0xD5, 0xA9, 0x3E, 0x82,
+    0xB0, 0x50, 0x46, 0x99, 0xC0, 0xF8, 0x75, 0xA0, 0x97, 0x70, 0x11, 0x31, 0xF2, 0xA2, 0xCC, 0xC6,
+    0xB8, 0x85, 0x2B, 0x1C, 0x75, 0x18, 0x7E, 0x75, 0x4B, 0xDD, 0xEF, 0xA2, 0x4F, 0xC6, 0x81, 0xB9,
+    0xE3, 0xD5, 0x6B, 0x81, 0xBE, 0x95, 0x44, 0xD5, 0x37, 0x9E, 0xE1, 0x77, 0xB7, 0x93, 0xF7, 0xBA,
+    0x74, 0xB7, 0x4B, 0xCF, 0xD6, 0xA3, 0x40, 0x9F, 0x0C, 0xB4, 0xCA, 0x1A, 0x2F, 0xFB, 0x3A, 0x94,
+    0x76, 0xBF, 0x0C, 0x0A, 0x98, 0x47, 0xF2, 0xEF, 0x9D, 0xD4, 0x8E, 0xBF, 0x39, 0xFA, 0x01, 0xD6,
+    0x80, 0x31, 0xD0, 0xC9, 0xCF, 0x6B, 0xE0, 0x19, 0x78, 0x35, 0x27, 0x87, 0xAF, 0x11, 0xF0, 0x57,
+    0x48, 0xF8, 0x43, 0x50, 0x21, 0xDC, 0x20, 0xB4, 0x14, 0x86, 0xE5, 0xCD, 0xBF, 0x5F, 0xF4, 0x18,
+    0x1F, 0x7F, 0xEF, 0x5E, 0x8D, 0xA0, 0x62, 0xE0, 0x6B, 0x20, 0xAA, 0xDC, 0x62, 0x21, 0x70, 0x0B,
+    0x01, 0x51, 0x84, 0x94, 0xCF, 0x29, 0xB0, 0x70, 0x6A, 0x0E, 0xD4, 0x47, 0xE9, 0xB0, 0xB0, 0x7C,
+    0x14, 0xB8, 0xDD, 0x4F, 0xE5, 0x51, 0xFC, 0x06, 0x6A, 0x82, 0xC4, 0xB2, 0x93, 0x91, 0xE1, 0x19,
+    0xC9, 0x04, 0x51, 0x23, 0x0A, 0xCF, 0x03, 0x57, 0xB9, 0x40, 0x15, 0xF2, 0x31, 0xF2, 0x09, 0xF2,
+    0x1A, 0xEB, 0x0C, 0x94, 0x0B, 0xD7, 0x0A, 0xCA, 0xCC, 0x66, 0xEB, 0xEE, 0xEE, 0x76, 0x79, 0x66,
+    0x6C, 0xCF, 0x8C, 0xD7, 0x3D, 0x31, 0x30, 0xCE, 0x24, 0x80, 0x69, 0x21, 0x83, 0xCA, 0x66, 0x03,
+    0x1B, 0x07, 0x80, 0x4D, 0xDE, 0xE2, 0x38, 0x0E, 0x00, 0x19, 0x6B, 0xA6, 0xC7, 0xE7, 0xC3, 0xD6,
+    0xD6, 0x1A, 0x72, 0x1C, 0x64, 0x6C, 0x69, 0xF0, 0x82, 0x1C, 0x07, 0x19, 0x3B, 0xB4, 0xB2, 0xF0,
+    0x2A, 0x49, 0x8E, 0x7F, 0x11, 0x1F, 0x12, 0xEB, 0x77, 0x4C, 0x24, 0xAF, 0xE3, 0xEF, 0x9A, 0xE7,
+    0xE5, 0x9A, 0xFA, 0x66, 0xD9, 0x85, 0xC9, 0x37, 0x0E, 0xC4, 0x2B, 0xC1, 0xFB, 0x95, 0xBB, 0x86,
+    0xEF, 0xBD, 0xD1, 0x32, 0xF1, 0x56, 0xD4, 0xF5, 0xB8, 0xF4, 0xF6, 0x4C, 0x72, 0xE9, 0xD4, 0x55,
+    0xF5, 0x52, 0xD5, 0x44, 0xCD, 0x6A, 0xA7, 0x7E, 0xAE, 0xB9, 0x1C, 0x9F, 0x34, 0xEA, 0x7A, 0xD1,
+    0xC2, 0xBF, 0x6B, 0xE2, 0x1F, 0x65, 0x2D, 0xC2, 0x6B, 0x26, 0x4E, 0x08, 0x0C, 0x15, 0x98, 0x95,
+    0xC4, 0x37, 0x18, 0xF9, 0x66, 0x2D, 0xE1, 0x8A, 0x5F, 0xF1, 0x9A, 0x26, 0x7E, 0xB9, 0x20, 0x16,
+    0xCA, 0x2A, 0x1C, 0xE3, 0x49, 0x6D, 0x30, 0x71, 0xC6, 0xCA, 0x19, 0x43, 0x67, 0x6C, 0x9D, 0x31,
+    0x77, 0xC6, 0xE2, 0x19, 0xA3, 0x67, 0xEC, 0xF6, 0x5B, 0x88, 0xE9, 0x5B, 0x34, 0x5D, 0x6D, 0x61,
+    0x6A, 0xFD, 0x8A, 0x2A, 0xA6, 0x0E, 0x6C, 0x13, 0xE4, 0x83, 0x0F, 0x2D, 0x6F, 0x7B, 0x37, 0x1E,
+    0x34, 0xAA, 0x18, 0x3C, 0xF9, 0x4F, 0x23, 0x29, 0xE0, 0x9C, 0xB9, 0x6F, 0x12, 0x0C, 0xFE, 0xFC,
+    0xD1, 0xAC, 0x60, 0xEA, 0x52, 0xBB, 0x8D, 0xA9, 0x57, 0x04, 0xDC, 0x4C, 0x8B, 0xAB, 0x44, 0xA7,
+    0x59, 0x8A, 0x11, 0x56, 0x71, 0x53, 0x9E, 0xFF, 0xD4, 0x25, 0xBB, 0x6D, 0xFA, 0x92, 0x49, 0xC3,
+    0x6A, 0x14, 0xE9, 0x55, 0x95, 0xDD, 0x54, 0xE8, 0xDF, 0xA7, 0x85, 0xF4, 0x64, 0xEC, 0xCB, 0xC1,
+    0xDE, 0x6D, 0xB0, 0xBF, 0x05, 0x47, 0x18, 0xDC, 0x54, 0xDE, 0x30, 0x2B, 0x07, 0xE9, 0x58, 0x2B,
+    0x1D, 0xE9, 0x40, 0x4B, 0x78, 0xD2, 0x9F, 0x35, 0xC9, 0x6E, 0x13, 0xDF, 0xA5, 0xDD, 0x2D, 0x87,
+    0x07, 0x7A, 0x35, 0xD0, 0x12, 0x15, 0xBE, 0x2F, 0xC1, 0x9E, 0x1C, 0xEC, 0x4B, 0x99, 0xC5, 0x6D,
+    0x92, 0xB1, 0x5F, 0x65, 0x81, 0xE8, 0xE4, 0x98, 0x30, 0xDB, 0xB7, 0x91, 0x49, 0x3C, 0x46, 0xF0,
+    0x31, 0xC2, 0x3F, 0x64, 0xEA, 0xAC, 0x8E, 0x83, 0xFA, 0x34, 0x33, 0xFA, 0x38, 0x1A, 0x92, 0x8B,
+    0x4E, 0x41, 0x63, 0x98, 0x1F, 0x51, 0x41, 0x6D, 0x59, 0xC0, 0x2F, 0x7D, 0xC3, 0x95, 0xED, 0xD0,
+    0xF9, 0x6D, 0x58, 0xA9, 0x6C, 0x84, 0x05, 0xCE, 0x70, 0x4B, 0x62, 0xD2, 0xF9, 0x55, 0xE2, 0x77,
+    0x11, 0x4D, 0x6B, 0x13, 0x70, 0xD5, 0x19, 0x92, 0x6D, 0x5E, 0x90, 0x44, 0x1A, 0x4B, 0xD1, 0xC7,
+    0x61, 0x95, 0x9F, 0xE9, 0x94, 0x71, 0xA7, 0x54, 0x1E, 0x5D, 0x87, 0x1B, 0xE2, 0x06, 0x47, 0x64,
+    0x23, 0xB8, 0x09, 0xDC, 0x54, 0x92, 0xEA, 0x19, 0xCA, 0x73, 0x2D, 0xAC, 0x6A, 0x28, 0x06, 0x63,
+    0x55, 0x7B, 0x9D, 0xAA, 0xBC, 0x36, 0xD6, 0x7E, 0x13, 0x17, 0x3E, 0x57, 0x22, 0xA8, 0x29, 0xD5,
+    0x0A, 0x59, 0x67, 0x44, 0xDA, 0x19, 0xC1, 0x73, 0xD6, 0x10, 0x30, 0xD9, 0x6D, 0xA4, 0x77, 0x3B,
+    0x90, 0xD2, 0x90, 0xBC, 0xD1, 0xEE, 0x7B, 0x1A, 0xD9, 0x7F, 0x20, 0xFD, 0x27, 0x49, 0x01, 0x79,
+    0xB6, 0xF2, 0x6A, 0x5A, 0xCC, 0xED, 0xA4, 0x1A, 0x77, 0x98, 0xF7, 0x5D, 0x09, 0x3C, 0xE8, 0x24,
+    0x01, 0x81, 0x49, 0xCF, 0x56, 0x4E, 0x86, 0x20, 0xF9, 0xC2, 0x54, 0x4D, 0x2F, 0xE1, 0x80, 0xB4,
+    0x81, 0x88, 0x33, 0xD1, 0x38, 0x27, 0x21, 0x1F, 0xC5, 0x19, 0x3D, 0x09, 0xF7, 0xBE, 0x5F, 0xD2,
+    0x6E, 0x2A, 0x72, 0x54, 0x34, 0xB4, 0xE7, 0x38, 0x10, 0x24, 0x3F, 0xCB, 0xA4, 0xA8, 0xE0, 0xDD,
+    0xC1, 0x69, 0xC7, 0x75, 0xF2, 0xAD, 0x47, 0x79, 0x11, 0x02, 0x8E, 0x9E, 0x40, 0x33, 0x44, 0x42,
+    0xB6, 0x38, 0xC9, 0x12, 0x02, 0x09, 0xE2, 0x47, 0xF0, 0xDF, 0x45, 0x70, 0x36, 0x8B, 0x02, 0xFD,
+    0x25, 0xAF, 0x3A, 0x09, 0xA2, 0xFE, 0xCA, 0x4D, 0x02, 0x6A, 0x68, 0x0E, 0x19, 0xDE, 0x3B, 0x62,
+    0x55, 0x70, 0xBF, 0x12, 0x83, 0x77, 0xDE, 0x95, 0xBC, 0xB9, 0x24, 0xF5, 0x22, 0xB2, 0xC2, 0x89,
+    0xE1, 0x5F, 0xD6, 0x9D, 0xF7, 0xB1, 0x10, 0x9C, 0x12, 0x9A, 0x5D, 0x8C, 0x30, 0x9F, 0x7D, 0x31,
+    0xC6, 0x11, 0x95, 0xA5, 0xCF, 0xCF, 0xC5, 0xD7, 0x11, 0x7F, 0xB8, 0x16, 0xFD, 0x75, 0xC9, 0x23,
+    0xDD, 0x96, 0x36, 0xB7, 0xDF, 0x4B, 0xED, 0x9B, 0x2B, 0xDF, 0xA9, 0x97, 0x7E, 0xD2, 0x2C, 0xFC,
+    0xA6, 0x5D, 0x18, 0x8D, 0xD1, 0x5C, 0xC6, 0xDA, 0x32, 0x1A, 0x67, 0x4F, 0x8F, 0x6B, 0x9B, 0xC5,
+    0xD6, 0x11, 0xF0, 0x64, 0x5A, 0xEF, 0xFA, 0x90, 0xC9, 0xCA, 0x85, 0xBA, 0x27, 0xF2, 0x53, 0x94,
+    0xD5, 0xFE, 0xB5, 0xF0, 0x7D, 0x44, 0xF5, 0xB1, 0x04, 0xAA, 0x47, 0x8C, 0x18, 0x2E, 0x10, 0x66,
+    0x6E, 0xB1, 0x3A, 0x41, 0x8A, 0x0A, 0x84, 0xC9, 0x91, 0x7E, 0x40, 0x76, 0xE5, 0xD8, 0x9C, 0x1D,
+    0xA5, 0xB0, 0x22, 0xDC, 0xA2, 0x10, 0xA4, 0xF0, 0x29, 0x01, 0xD7, 0x29, 0x98, 0x6C, 0x20, 0xE0,
+    0x62, 0x85, 0xB2, 0x28, 0x9C, 0x5E, 0x4D, 0xA5, 0x96, 0x94, 0x23, 0xE6, 0x24, 0x35, 0x44, 0x78,
+    0x9F, 0x4F, 0x2D, 0x94, 0xB9, 0xBF, 0x62, 0xFB, 0x09, 0xBD, 0xE9, 0x84, 0xDD, 0x30, 0x21, 0x41,
+    0x12, 0xF6, 0x2B, 0xEC, 0x6F, 0x19, 0xCE, 0xFD, 0xA4, 0xC9, 0x44, 0x1E, 0xDA, 0xE5, 0x89, 0xA9,
+    0x93, 0x47, 0xD8, 0xEB, 0x30, 0x4D, 0x2A, 0x49, 0x39, 0xF7, 0xBA, 0xF0, 0x81, 0x45, 0x7E, 0x86,
+    0x90, 0xCD, 0x8B, 0x1C, 0x13, 0xE6, 0x11, 0x0B, 0xF2, 0x24, 0xE2, 0xC5, 0x69, 0xE5, 0x2C, 0xA2,
+    0xB4, 0x74, 0x46, 0x8B, 0x4F, 0x74, 0x37, 0x36, 0xCE, 0x08, 0xE2, 0x24, 0x70, 0xE0, 0x77, 0xB1,
+    0x31, 0x3D, 0x3E, 0x16, 0x1E, 0x22, 0xB8, 0x70, 0x60, 0x4C, 0x2A, 0x84, 0xAD, 0x73, 0x2F, 0xE2,
+    0x25, 0xD6, 0xFB, 0xA8, 0x9C, 0xB1, 0x24, 0x6C, 0x69, 0x47, 0xD4, 0x88, 0x15, 0x46, 0x6C, 0xA8,
+    0x69, 0x81, 0x80, 0x6F, 0x4C, 0x8A, 0x0B, 0x3A, 0x62, 0x41, 0x19, 0x22, 0x36, 0x2F, 0x12, 0xD1,
+    0xBB, 0x24, 0x5A, 0x47, 0xA2, 0x53, 0xB2, 0x68, 0xAA, 0x90, 0xDA, 0x6E, 0x53, 0x17, 0x2D, 0x4C,
+    0xAB, 0x60, 0x4C, 0x3D, 0xAE, 0x5A, 0xCE, 0xB0, 0xF5, 0x19, 0xC1, 0x97, 0x55, 0xFF, 0x65, 0x18,
+    0x6C, 0xA2, 0x19, 0x90, 0x71, 0xCA, 0x1D, 0x07, 0xD3, 0x34, 0xE3, 0x59, 0xBC, 0x91, 0x4A, 0xCD,
+    0x58, 0x33, 0xC3, 0x69, 0x6F, 0x50, 0x8B, 0xE1, 0x41, 0x25, 0xC1, 0x0F, 0xB4, 0x27, 0xB0, 0x28,
+    0x04, 0x05, 0xDE, 0x7E, 0xA2, 0x09, 0x1A, 0xC8, 0x0C, 0x0C, 0xB5, 0xAC, 0x66, 0x7F, 0x4E, 0x0A,
+    0x55, 0xCD, 0x2A, 0xFD, 0xED, 0x85, 0xB7, 0xC1, 0x4C, 0x72, 0x22, 0x3B, 0xA1, 0xC8, 0xFE, 0x6A,
+    0xC0, 0xDA, 0x68, 0x90, 0xD5, 0x1E, 0x60, 0xD3, 0x2C, 0x16, 0x15, 0x02, 0x4B, 0x09, 0xA8, 0x48,
+    0x58, 0xF4, 0xA0, 0x3B, 0x04, 0xF9, 0xBE, 0x78, 0xEE, 0x9E, 0xAD, 0x83, 0x5D, 0x6B, 0x28, 0xCD,
+    0x8C, 0x98, 0x41, 0x74, 0xB0, 0xFB, 0x67, 0x04, 0xBB, 0xFA, 0x40, 0x42, 0x06, 0x47, 0x7A, 0xAD,
+    0xC3, 0xE1, 0xCD, 0xCD, 0x22, 0xE1, 0xDC, 0x65, 0x37, 0x82, 0x7D, 0x4C, 0xF2, 0xEE, 0x34, 0xD3,
+    0xC7, 0x56, 0xE0, 0xAE, 0x6E, 0x73, 0xF3, 0x2D, 0x6C, 0x91, 0x1B, 0xA2, 0xD0, 0x6A, 0x4A, 0x35,
+    0x23, 0x5A, 0x9D, 0xB3, 0xDA, 0xDA, 0x09, 0x87, 0xF5, 0x3C, 0xB2, 0x84, 0x63, 0x09, 0xD2, 0x53,
+    0x73, 0xD1, 0x87, 0xDB, 0x87, 0x6D, 0x57, 0xDA, 0xEC, 0xEA, 0x4F, 0x6B, 0xFC, 0xBA, 0x85, 0xB9,
+    0xEC, 0x2A, 0x0B, 0xBC, 0x1B, 0x21, 0x4B, 0x72, 0x64, 0xBC, 0x62, 0x06, 0x06, 0x8C, 0x61, 0xAE,
+    0x4B, 0x46, 0x64, 0x99, 0xDF, 0x87, 0xFB, 0xEF, 0x2F, 0x59, 0x22, 0x70, 0xF2, 0x76, 0x0B, 0xD6,
+    0xB8, 0x5C, 0xC8, 0x28, 0x2A, 0x5E, 0x61, 0x90, 0x0A, 0x1C, 0xB0, 0xFD, 0x58, 0x06, 0xCB, 0x67,
+    0x9A, 0x38, 0x22, 0x80, 0xF6, 0x7E, 0xD8, 0x4A, 0x30, 0x6F, 0xCC, 0x8E, 0xE1, 0x76, 0xED, 0x32,
+    0xA5, 0xBB, 0xB9, 0x80, 0xFC, 0x97, 0x86, 0x14, 0x68, 0x7C, 0xD2, 0x8B, 0xF7, 0xC1, 0xDF, 0xA8,
+    0xFA, 0xF7, 0xC4, 0xEF, 0xDD, 0x02, 0x87, 0xA7, 0x05, 0x9E, 0xA4, 0x47, 0x21, 0x0F, 0x21, 0xFC,
+    0x68, 0x1D, 0x87, 0xAC, 0x6C, 0xE9, 0x0A, 0x2C, 0x2D, 0x11, 0x5D, 0x23, 0xA9, 0x23, 0x2F, 0x0E,
+    0xF4, 0x20, 0xF5, 0xBD, 0x28, 0xCF, 0x65, 0xE5, 0xCB, 0x48, 0xE7, 0xDD, 0xA2, 0x8F, 0xDC, 0xEF,
+    0x8A, 0x5B, 0x68, 0xEE, 0x43, 0x2B, 0xB7, 0x03, 0x65, 0x3E, 0xB0, 0x60, 0x47, 0x85, 0x4A, 0xAA,
+    0xC5, 0xA4, 0x1A, 0x49, 0x79, 0x27, 0xC8, 0xE6, 0x92, 0x7A, 0x7E, 0xBD, 0x5D, 0xBC, 0x95, 0x5E,
+    0x35, 0x51, 0x7B, 0x5E, 0xD8, 0xF9, 0x42, 0x26, 0xA1, 0x98, 0x20, 0x78, 0x70, 0xE1, 0x52, 0xC5,
+    0x64, 0x40, 0x73, 0x65, 0x80, 0x10, 0xDB, 0x71, 0xCC, 0x8D, 0x16, 0x96, 0x46, 0x4D, 0xFC, 0xBA,
+    0x09, 0x6C, 0xB1, 0x67, 0x77, 0xB8, 0x18, 0xBE, 0xCD, 0xD4, 0xEF, 0xEA, 0x64, 0xB9, 0xF9, 0xC2,
+    0xE8, 0xA2, 0x1B, 0xF7, 0x35, 0x0C, 0x7C, 0x40, 0xC9, 0xA5, 0x12, 0xB8, 0x37, 0xC2, 0x5A, 0x0F,
+    0xDF, 0xF4, 0x8B, 0xD7, 0xBF, 0x29, 0xFB, 0xBD, 0xAD, 0xF8, 0xFC, 0x7E, 0x27, 0x95, 0x9B, 0x25,
+    0xFF, 0xAC, 0x49, 0xAE, 0xB1, 0x24, 0x56, 0x2C, 0xFA, 0x77, 0x94, 0x3E, 0xED, 0xCA, 0xF4, 0x1A,
+    0xCB, 0x7E, 0xEC, 0xEA, 0xFE, 0xC9, 0x7D, 0xA2, 0x97, 0xE8, 0x86, 0x8E, 0xCF, 0xDB, 0xE9, 0x9D,
+    0x38, 0xF1, 0x2C, 0xF0, 0x2D, 0x61, 0x94, 0x52, 0x08, 0xAA, 0xCC, 0x52, 0x59, 0xD1, 0x39, 0xA7,
+    0x57, 0x98, 0x62, 0xE6, 0x8B, 0x60, 0xCA, 0x11, 0x04, 0xFE, 0x57, 0x1F, 0xFD, 0xA2, 0x94, 0x77,
+    0x47, 0x3F, 0xA3, 0x23, 0x70, 0x3A, 0x68, 0xF2, 0xA2, 0xC4, 0x7A, 0xFA, 0x05, 0xB7, 0xDC, 0x99,
+    0x73, 0xCD, 0xB5, 0xC4, 0xED, 0x9D, 0x93, 0x27, 0xC2, 0x64, 0x91, 0xDF, 0xB0, 0x77, 0x3F, 0xB9,
+    0x9D, 0x05, 0xBD, 0xF5, 0xED, 0x50, 0x56, 0x1F, 0x6B, 0x49, 0xC6, 0xBD, 0x79, 0x6F, 0x95, 0x9C,
+    0xDC, 0xE3, 0xE3, 0xED, 0x7F, 0xB9, 0xB5, 0x70, 0xC8, 0x43, 0x37, 0x1F, 0x55, 0xE3, 0x79, 0x55,
+    0x6D, 0xCF, 0xB3, 0x08, 0x11, 0x21, 0x22, 0x9B, 0x5B, 0x9B, 0x37, 0xAC, 0x24, 0xDC, 0x62, 0xFF,
+    0x7C, 0x74, 0xDE, 0xCB, 0x1E, 0x19, 0x87, 0x1D, 0x12, 0x95, 0x95, 0xBF, 0x0D, 0xAE, 0x5D, 0x75,
+    0x4F, 0xEB, 0xC3, 0xD3, 0xAB, 0xEE, 0x69, 0x67, 0xEA, 0x6B, 0x91, 0x16, 0xCF, 0xBA, 0xFF, 0x28,
+    0x72, 0x77, 0x88, 0x61, 0x93, 0x6B, 0x9A, 0xCD, 0xE1, 0x99, 0xE1, 0xCE, 0xF1, 0x62, 0xDD, 0xEF,
+    0xBD, 0x0F, 0xB4, 0xE7, 0x37, 0xFA, 0x05, 0x39, 0x0E, 0xB4, 0xE7, 0xAF, 0x53, 0x1D, 0x67, 0x0A,
+    0x47, 0xF0, 0xF9, 0x63, 0x0F, 0x41, 0xFE, 0x2C, 0xA7, 0x7A, 0x6A, 0xCB, 0xD3, 0xC6, 0x2A, 0x7C,
+    0x5B, 0x6F, 0x6C, 0x9C, 0x28, 0x0E, 0x32, 0xEF, 0x0E, 0x0E, 0xEA, 0xDB, 0xA7, 0x5D, 0x54, 0x31,
+    0x6F, 0xDB, 0x46, 0x14, 0xFE, 0xC8, 0xB3, 0x44, 0x24, 0x57, 0xE4, 0x32, 0x58, 0x45, 0x92, 0x06,
+    0xBD, 0xB9, 0x86, 0xA1, 0x5B, 0x32, 0x74, 0x10, 0xC9, 0x87, 0x08, 0x68, 0x81, 0x66, 0xD1, 0x60,
+    0x4E, 0x19, 0xBA, 0x78, 0x68, 0x0B, 0x14, 0xED, 0xD0, 0xA1, 0x28, 0x68, 0xF9, 0x90, 0x0C, 0x19,
+    0xB2, 0xF8, 0x1F, 0xC4, 0x43, 0xA7, 0x7A, 0x50, 0x46, 0x25, 0x60, 0xA2, 0x8B, 0xFB, 0x03, 0xCA,
+    0x02, 0x01, 0x32, 0x74, 0x30, 0x93, 0x38, 0xE8, 0x90, 0xC1, 0x04, 0x2A, 0xA0, 0x06, 0x6A, 0x9B,
+    0x7D, 0x47, 0x59, 0x69, 0x50, 0xE9, 0x51, 0xA0, 0xEE, 0xDE, 0xF1, 0x7D, 0xEF, 0xFB, 0xBE, 0x47,
+    0x7C, 0x0D, 0x71, 0x64, 0xD5, 0xE7, 0xCE, 0x08, 0x97, 0x44, 0x6E, 0x4B, 0xBA, 0x5C, 0xBA, 0x42,
+    0xD9, 0x5C, 0x23, 0x8F, 0xD1, 0x3F, 0x46, 0x87, 0xD0, 0x25, 0x65, 0x3B, 0x00, 0xB6, 0x61, 0x90,
+    0x20, 0x46, 0x8E, 0x02, 0x4F, 0x28, 0x05, 0x02, 0x82, 0x72, 0x30, 0x0E, 0x33, 0x1B, 0xFE, 0x46,
+    0x52, 0xD1, 0x75, 0x8D, 0xED, 0xA6, 0xEA, 0x6D, 0x8F, 0x38, 0x4B, 0x34, 0x36, 0xC8, 0x10, 0x64,
+    0x24, 0x1B, 0xA7, 0xF6, 0xEC, 0x07, 0x01, 0x5D, 0x01, 0xD2, 0x53, 0xAC, 0x1A, 0x40, 0xD3, 0x43,
+    0x4D, 0x73, 0x83, 0xED, 0x13, 0xFF, 0x7C, 0x5C, 0xA3, 0xF0, 0xEF, 0x52, 0xDE, 0x29, 0x15, 0x60,
+    0x56, 0x91, 0x36, 0x88, 0x19, 0x80, 0xB2, 0x03, 0x0E, 0x0D, 0x5D, 0x20, 0x18, 0xA1, 0x97, 0x51,
+    0xDA, 0xB8, 0x9F, 0x26, 0xB4, 0x7B, 0x09, 0x58, 0x07, 0x7E, 0x00, 0x2A, 0x08, 0x07, 0x49, 0xF8,
+    0x18, 0x18, 0x00, 0x97, 0x19, 0xE0, 0x37, 0x24, 0xFE, 0xA9, 0xE4, 0xB3, 0xDA, 0xC7, 0x6B, 0x17,
+    0x36, 0x90, 0x33, 0xD7, 0x97, 0xE5, 0x40, 0x94, 0x83, 0xC8, 0xE9, 0x09, 0x05, 0x1B, 0xC0, 0x26,
+    0xE4, 0x01, 0x69, 0x6E, 0xB6, 0xED, 0xD7, 0x48, 0xA7, 0x1A, 0x07, 0x65, 0xA1, 0xF1, 0x7D, 0x8C,
+    0xF1, 0xBC, 0xC5, 0x53, 0x9E, 0x47, 0xEF, 0x0D, 0xCD, 0x1A, 0xD7, 0x7B, 0xF3, 0xDE, 0x4A, 0xD6,
+    0xAE, 0x64, 0x5C, 0x0C, 0xED, 0x0D, 0x67, 0x23, 0x6B, 0x17, 0xB1, 0xF8, 0x68, 0x60, 0x0A, 0x51,
+    0x41, 0x3A, 0xEE, 0x92, 0x09, 0x63, 0xC6, 0x98, 0x8C, 0xF3, 0xE0, 0x7B, 0x5E, 0x51, 0xE4, 0x91,
+    0xC3, 0x1F, 0x0D, 0x1C, 0xE6, 0xCC, 0x67, 0xCC, 0x3B, 0x8B, 0xEF, 0x16, 0x73, 0x3B, 0x17, 0xB5,
+    0x74, 0xB1, 0xEF, 0x28, 0x20, 0x7D, 0x50, 0xC9, 0x57, 0xB5, 0xDA, 0xAF, 0xD5, 0xB0, 0xD2, 0xA2,
+    0x34, 0x11, 0xA3, 0x7E, 0x1E, 0x8B, 0x39, 0xBE, 0x42, 0x74, 0x40, 0x4A, 0x5A, 0x6E, 0x22, 0xF6,
+    0x8A, 0x79, 0xD1, 0x8E, 0x35, 0x4D, 0x0D, 0xA6, 0x03, 0x24, 0x8B, 0x3E, 0x3A, 0x5E, 0xB3, 0xE8,
+    0x29, 0xBA, 0x5C, 0x3A, 0x07, 0x3F, 0x99, 0xA1, 0xE1, 0x18, 0x5C, 0x32, 0xA8, 0x3D, 0xCD, 0xBE,
+    0x0F, 0xAF, 0xBF, 0x93, 0x77, 0xAB, 0x68, 0x58, 0x7A, 0xCC, 0x2C, 0xC1, 0x8F, 0x08, 0x4B, 0xA8,
+    0xC0, 0x8D, 0xF7, 0xEC, 0xAC, 0xA1, 0x6C, 0x91, 0xF3, 0xB6, 0x94, 0xBF, 0x56, 0xE1, 0xD0, 0xF7,
+    0x15, 0x9C, 0x02, 0xDF, 0x11, 0xDF, 0xDC, 0x68, 0x9D, 0x92, 0x9E, 0xA1, 0x33, 0x5A, 0x7A, 0x21,
+    0xB5, 0x38, 0x22, 0xF1, 0x00, 0x97, 0x34, 0xD6, 0x0D, 0x33, 0x54, 0x65, 0x63, 0xE2, 0xD2, 0xA2,
+    0x21, 0xF6, 0x02, 0x32, 0x12, 0x4D, 0x25, 0x7E, 0x29, 0x23, 0xD8, 0x8B, 0x4C, 0x43, 0x43, 0x2B,
+    0x7C, 0x44, 0xBA, 0x4F, 0xA5, 0x63, 0xA9, 0xCD, 0x99, 0xD7, 0x19, 0x6B, 0x08, 0xFF, 0x74, 0x6A,
+    0xE8, 0x98, 0xC7, 0x64, 0x03, 0xE9, 0x0C, 0xB9, 0xA2, 0x42, 0x11, 0xFF, 0xE6, 0x06, 0xFD, 0xC2,
+    0xD7, 0xEA, 0x64, 0xA4, 0x9B, 0xAA, 0xBF, 0xE7, 0x6E, 0x08, 0xF2, 0x80, 0x17, 0x76, 0xA8, 0xCF,
+    0xED, 0xC0, 0x07, 0x57, 0x71, 0x8E, 0x59, 0xED, 0x57, 0x3E, 0x5E, 0x38, 0x71, 0xC6, 0x5E, 0xB0,
+    0xB1, 0x72, 0x79, 0xE4, 0x0D, 0x6E, 0x66, 0xBE, 0x56, 0xF0, 0x33, 0x7B, 0x01, 0x26, 0xB2, 0x71,
+    0xCB, 0x61, 0xA2, 0x9C, 0x3E, 0xB2, 0x5E, 0x1D, 0x83, 0xDD, 0x01, 0x1E, 0xD7, 0xE8, 0xB5, 0x5E,
+    0x08, 0xDA, 0xF8, 0x70, 0xE9, 0x85, 0xC5, 0xDF, 0xFF, 0x79, 0xA1, 0x69, 0x5C, 0xB6, 0xF4, 0x42,
+    0xF3, 0xCE, 0x0B, 0xD2, 0x73, 0x1E, 0xD6, 0x88, 0x5A, 0x87, 0xB1, 0xF2, 0xE9, 0xD2, 0x0E, 0xC9,
+    0x7B, 0x5E, 0xE0, 0x5D, 0x58, 0xCE, 0x0E, 0x2D, 0xAB, 0x52, 0xB0, 0x97, 0x17, 0x6E, 0xF0, 0x73,
+    0x76, 0xC2, 0x5E, 0xA8, 0x18, 0x19, 0x18, 0xEC, 0xA3, 0x1D, 0x79, 0xDF, 0x99, 0x16, 0x29, 0xCF,
+    0x46, 0xA1, 0xA9, 0x48, 0x91, 0x1E, 0x54, 0x17, 0xBA, 0x14, 0x3C, 0x82, 0xFC, 0x12, 0x7D, 0x85,
+    0x41, 0x1F, 0xB3, 0x43, 0x2F, 0x73, 0xBE, 0x82, 0xB4, 0x40, 0x77, 0x87, 0x4F, 0x41, 0x3D, 0xB0,
+    0xFD, 0xC8, 0xF7, 0x5D, 0x2C, 0x07, 0x3B, 0xE1, 0xAD, 0x11, 0x2E, 0xDA, 0x4D, 0xF1, 0xB2, 0x0C,
+    0xFE, 0x02, 0x4E, 0x3D, 0x4C, 0x56, 0x35, 0x32, 0x58, 0xD7, 0xF6, 0x72, 0x87, 0xBA, 0x87, 0xF8,
+    0x64, 0xDC, 0x5A, 0xD9, 0x40, 0xB3, 0x02, 0x7D, 0x1C, 0x0F, 0xF0, 0xA4, 0xC6, 0x55, 0xF8, 0x61,
+    0x97, 0x6D, 0x37, 0xEA, 0x36, 0xE9, 0x89, 0x33, 0xB7, 0x5C, 0xCA, 0x5E, 0xF5, 0xE3, 0x4A, 0x85,
+    0xC6, 0x54, 0x55, 0xA3, 0x2E, 0xFD, 0x97, 0xF3, 0xC5, 0xAE, 0x96, 0xD6, 0x5C, 0x47, 0xF2, 0x10,
+    0xE9, 0x1C, 0x5B, 0x05, 0x8A, 0x04, 0x53, 0x63, 0x47, 0x01, 0xE7, 0xF0, 0xE4, 0x59, 0x45, 0xFA,
+    0xDD, 0x3B, 0x25, 0xC7, 0xD8, 0x5E, 0xC5, 0xDA, 0xED, 0xCF, 0x4A, 0x3D, 0xF9, 0xA3, 0xD6, 0xF7,
+    0x5E, 0xD6, 0x46, 0xEE, 0xD7, 0x89, 0xBA, 0x5B, 0xC5, 0x6A, 0x58, 0xE6, 0xFE, 0xD2, 0xE2, 0x64,
+    0xA3, 0x83, 0xD1, 0xDA, 0x47, 0x56, 0xEF, 0x95, 0xFA, 0x5E, 0x3B, 0x0D, 0xCB, 0xEA, 0xB9, 0xAA,
+    0x37, 0x42, 0xBA, 0x76, 0xDF, 0xCA, 0xB7, 0xB5, 0xFC, 0xBD, 0x56, 0xCF, 0x6A, 0x75, 0xB3, 0xD6,
+    0xA2, 0xE2, 0x1C, 0x33, 0x41, 0xB2, 0xE9, 0xDF, 0x11, 0x3C, 0x03, 0x33, 0x42, 0xF0, 0x14, 0xF2,
+    0x96, 0x55, 0x37, 0xA1, 0x2A, 0x84, 0xA7, 0x58, 0x49, 0x31, 0x50, 0x48, 0xBE, 0xF5, 0x74, 0x81,
+    0x42, 0xA7, 0x0F, 0xF5, 0xCE, 0x12, 0x55, 0x8C, 0x74, 0xE7, 0x02, 0xFE, 0x05, 0x65, 0x57, 0x4D,
+    0x68, 0x1D, 0xD7, 0x15, 0x3E, 0x33, 0x53, 0xBD, 0xA1, 0x9E, 0xD8, 0x97, 0x82, 0x21, 0xC5, 0x52,
+    0x3C, 0x59, 0x96, 0x20, 0x33, 0x81, 0xBA, 0x20, 0x83, 0xAA, 0x3B, 0xA5, 0x8B, 0xAE, 0x42, 0x5C,
+    0xB0, 0xBA, 0xE9, 0xC2, 0x9B, 0xEE, 0x0A, 0x7D, 0x2E, 0x08, 0x1A, 0x42, 0xC9, 0x1D, 0x25, 0x50,
+    0x2F, 0x4C, 0xC1, 0x8B, 0xA6, 0x14, 0xBA, 0x88, 0x16, 0x29, 0x6D, 0xE5, 0x85, 0x44, 0x30, 0x24,
+    0x8B, 0xF8, 0xCD, 0x95, 0xB5, 0xD0, 0xA2, 0xA1, 0xBE, 0x8D, 0x28, 0x85, 0x6E, 0x32, 0x4E, 0x2C,
+    0x1B, 0x92, 0x85, 0x6E, 0xDC, 0x79, 0xF8, 0x3D, 0x69, 0x66, 0x6E, 0xBF, 0x73, 0xE7, 0xC9, 0xB5,
+    0xE9, 0xC0, 0x9C, 0x79, 0x9A, 0x9F, 0x7B, 0xCF, 0xF9, 0xCE, 0x77, 0xBE, 0x73, 0x44, 0xC4, 0xC7,
+    0xB0, 0x23, 0x0A, 0xA7, 0x2A, 0x27, 0x51, 0x65, 0x44, 0x99, 0xFE, 0x36, 0x91, 0xCC, 0x71, 0x5F,
+    0x05, 0xAB, 0xAB, 0x79, 0x19, 0x3B, 0xA7, 0x47, 0xD4, 0x45, 0xBA, 0xA4, 0x36, 0xD2, 0x2A, 0x68,
+    0xF0, 0xCA, 0xA7, 0x30, 0xB8, 0x0F, 0x1B, 0x4D, 0xF0, 0x62, 0x54, 0xC3, 0xC4, 0x76, 0x8E, 0x28,
+    0xB1, 0x82, 0x48, 0x8C, 0x7F, 0x41, 0x54, 0xBA, 0x16, 0x37, 0x5F, 0xB8, 0x46, 0xB4, 0x58, 0x51,
+    0x30, 0xAA, 0x48, 0xB9, 0x26, 0x6C, 0xF7, 0x3B, 0x31, 0xDE, 0xEB, 0xD2, 0x2F, 0x7E, 0xFB, 0xB1,
+    0xDC, 0x5D, 0xB8, 0xAC, 0x6E, 0x2C, 0x51, 0xF9, 0xDA, 0xAB, 0x54, 0x2E, 0x6E, 0x93, 0xBB, 0x68,
+    0xA8, 0xFC, 0x40, 0x53, 0xF9, 0x45, 0x4E, 0xF2, 0x5F, 0xB4, 0x91, 0x75, 0xB1, 0x49, 0x9C, 0xCB,
+    0x13, 0xF5, 0x80, 0x4E, 0x5F, 0x24, 0x5A, 0xD8, 0x26, 0x3A, 0x7B, 0x99, 0x66, 0x47, 0xC0, 0xAB,
+    0xA7, 0x0F, 0x1D, 0x9C, 0xCC, 0x55, 0x01, 0x9F, 0x64, 0x0E, 0x4F, 0xBE, 0x4F, 0xC2, 0xE2, 0x61,
+    0x5A, 0xC1, 0x64, 0xFB, 0x93, 0x3B, 0x24, 0xEF, 0x3A, 0x47, 0x52, 0xB7, 0x2B, 0xA4, 0x76, 0x26,
+    0x67, 0x49, 0xBD, 0x0D, 0x47, 0xD5, 0x5D, 0xBC, 0x23, 0x77, 0xD9, 0xEC, 0x57, 0xAF, 0x52, 0x7A,
+    0x7C, 0xDF, 0x72, 0x2C, 0x1A, 0x2E, 0x77, 0x27, 0xCB, 0x97, 0xCE, 0x15, 0x34, 0x3C, 0x2A, 0x01,
+    0x89, 0x15, 0x8C, 0x0B, 0xA2, 0x4A, 0x4D, 0x02, 0xA3, 0x79, 0x69, 0x36, 0xD2, 0x9B, 0x2F, 0x0B,
+    0x2C, 0xE8, 0xBF, 0xE5, 0xCF, 0xE0, 0x0E, 0x9D, 0x72, 0x7F, 0x21, 0x9A, 0x67, 0x13, 0x30, 0x00,
+    0x21, 0x30, 0xA2, 0xF9, 0x2E, 0xE7, 0xD7, 0xAA, 0x13, 0xE7, 0xCB, 0x8A, 0x92, 0x47, 0x0D, 0x65,
+    0x45, 0x47, 0x92, 0xEE, 0x90, 0xA2, 0xF7, 0x71, 0x52, 0x7F, 0xE6, 0xC4, 0x51, 0xCF, 0xA9, 0x77,
+    0x7D, 0x12, 0x04, 0xFC, 0x9F, 0x53, 0xAB, 0x44, 0x1F, 0xE3, 0xB3, 0x03, 0x06, 0x7D, 0x7A, 0x3B,
+    0x73, 0xCE, 0x5E, 0x1A, 0xC0, 0xC1, 0xD9, 0xF1, 0x1D, 0x6F, 0xD7, 0xBC, 0xAD, 0x68, 0xEE, 0xCA,
+    0xE0, 0x9D, 0x7F, 0x17, 0x69, 0xAB, 0x8E, 0x9D, 0x8D, 0xDA, 0x43, 0xF7, 0x9E, 0x8D, 0x5C, 0xDC,
+    0x09, 0xFC, 0x8E, 0x1B, 0x61, 0xE3, 0x26, 0xA9, 0x61, 0x71, 0x8A, 0x0A, 0xB9, 0xB2, 0xA9, 0xC1,
+    0x59, 0x65, 0x46, 0x54, 0xD2, 0x64, 0x3A, 0x35, 0x4A, 0x4B, 0x9D, 0x69, 0x07, 0x2B, 0x77, 0x61,
+    0x3B, 0xB9, 0xA7, 0xB4, 0xA8, 0xE9, 0x8C, 0x5F, 0x7C, 0xF9, 0x99, 0x8D, 0xFA, 0xC3, 0x59, 0x2A,
+    0x27, 0x34, 0xAC, 0x69, 0x58, 0x91, 0x68, 0x88, 0x73, 0xDF, 0xF2, 0xCB, 0xE7, 0x1D, 0x9D, 0x47,
+    0xE2, 0xCB, 0xFC, 0x02, 0x85, 0xA3, 0xF2, 0xCB, 0xD1, 0x4D, 0x00, 0xEC, 0x10, 0xFF, 0x1B, 0xA2,
+    0x5A, 0xA2, 0x53, 0xDD, 0xD6, 0x51, 0x57, 0x08, 0xBE, 0xA3, 0xC9, 0x46, 0x0D, 0x32, 0x61, 0x83,
+    0xCE, 0x52, 0x50, 0x11, 0x5E, 0x09, 0x0D, 0x29, 0x43, 0x91, 0x66, 0x80, 0xE7, 0x1F, 0x30, 0xE0,
+    0x0A, 0x0B, 0x6B, 0x64, 0xDC, 0xDD, 0xE4, 0xCC, 0x1C, 0xB7, 0x3E, 0xC3, 0x0E, 0x88, 0x66, 0x70,
+    0x97, 0x13, 0x21, 0x67, 0x16, 0xC4, 0x29, 0xE4, 0x0E, 0x3E, 0x28, 0xD4, 0x3B, 0x20, 0x52, 0xEE,
+    0xF0, 0x99, 0xFB, 0x69, 0x0B, 0xAA, 0x60, 0x6F, 0xF5, 0xBB, 0x00, 0xE9, 0x95, 0x14, 0xB6, 0xDE,
+    0x22, 0x2D, 0x6F, 0x51, 0x04, 0x3B, 0xF2, 0xF6, 0x0E, 0xA5, 0x6D, 0x4E, 0xEA, 0x0A, 0xBB, 0x94,
+    0xD5, 0x27, 0xD1, 0xB9, 0x07, 0x7D, 0x7D, 0x1C, 0xF1, 0x6E, 0x88, 0xCD, 0xF2, 0x7E, 0x7C, 0x95,
+    0x86, 0xBC, 0x17, 0xD2, 0x0C, 0xFE, 0xCA, 0x7E, 0x48, 0xC3, 0x24, 0x80, 0x0F, 0x3B, 0x8D, 0x30,
+    0xB8, 0x96, 0x3F, 0xAC, 0x13, 0xF8, 0xF1, 0x9B, 0x36, 0x6A, 0x06, 0x9C, 0x79, 0x13, 0xF2, 0x0A,
+    0xE5, 0xD0, 0x90, 0xC3, 0xE2, 0x2E, 0xB5, 0x24, 0xE1, 0x8C, 0x13, 0xCC, 0x3C, 0x0A, 0xBA, 0x64,
+    0x12, 0xC2, 0xDD, 0x90, 0x33, 0x94, 0x83, 0xC8, 0x4D, 0xD4, 0xA6, 0x85, 0x04, 0x6B, 0x7E, 0xEC,
+    0x5E, 0x3F, 0x68, 0x99, 0x38, 0xC3, 0x3D, 0x57, 0x3F, 0x05, 0x3D, 0x73, 0x66, 0x90, 0xA7, 0x8E,
+    0x59, 0x25, 0x8A, 0xF9, 0x29, 0xFB, 0x9F, 0xE9, 0xB0, 0xE2, 0xAB, 0xD4, 0x00, 0x0E, 0xD7, 0x52,
+    0x27, 0x05, 0xC7, 0xE8, 0x34, 0x52, 0x12, 0xB6, 0xE1, 0xA1, 0x41, 0x3A, 0x7E, 0xEE, 0x6E, 0x1D,
+    0x1E, 0x8D, 0x36, 0x98, 0xDC, 0x3E, 0x19, 0x41, 0x27, 0x84, 0x05, 0xF8, 0x41, 0x77, 0x41, 0x7C,
+    0xCD, 0xDC, 0xEC, 0x96, 0x93, 0xC7, 0x1C, 0x58, 0x77, 0x3B, 0x7E, 0xA2, 0x7D, 0x76, 0x63, 0x1F,
+    0xB8, 0x33, 0x91, 0xF3, 0x78, 0xE8, 0xA8, 0xF5, 0xD5, 0x91, 0x33, 0x64, 0xCC, 0x79, 0x5F, 0xF8,
+    0xA5, 0x9B, 0x06, 0x0D, 0x16, 0x5D, 0x6F, 0x46, 0x94, 0xFE, 0x03, 0x26, 0xB9, 0xCF, 0xE6, 0xEB,
+    0x66, 0x74, 0xEE, 0x06, 0x4C, 0xF6, 0xB7, 0xE7, 0xCD, 0x1E, 0x9E, 0xC2, 0x5F, 0x6F, 0x26, 0x30,
+    0x71, 0x3D, 0x02, 0xA3, 0x2B, 0x36, 0xD8, 0x4C, 0xF0, 0x4E, 0x03, 0xBF, 0x5D, 0xE7, 0x53, 0x00,
+    0x87, 0x6E, 0x75, 0xC8, 0x3C, 0x6F, 0x99, 0x1C, 0x37, 0xBC, 0xDD, 0x04, 0xA1, 0x25, 0x35, 0xC5,
+    0x75, 0x62, 0xB9, 0x34, 0x2D, 0x4A, 0x53, 0x54, 0xC0, 0x00, 0x75, 0x0F, 0xF6, 0x9A, 0x9E, 0x11,
+    0x48, 0x02, 0xCC, 0xCE, 0xA1, 0xA6, 0xD4, 0x65, 0x1D, 0x25, 0xAD, 0x98, 0x3C, 0x43, 0xDC, 0x94,
+    0x17, 0x3E, 0xB7, 0xB9, 0x79, 0x52, 0x44, 0x5C, 0x91, 0x5F, 0x01, 0xC7, 0xF5, 0x16, 0x51, 0x35,
+    0xD4, 0x52, 0xCD, 0x0C, 0x89, 0xA7, 0x57, 0x80, 0x76, 0x43, 0xC9, 0xF8, 0x8A, 0x57, 0x16, 0x24,
+    0x92, 0xD2, 0x31, 0xEB, 0x01, 0xF5, 0x27, 0xEE, 0xC5, 0x93, 0x28, 0x0F, 0xDD, 0x16, 0x1E, 0x4E,
+    0x4E, 0x58, 0x73, 0x03, 0x5C, 0x18, 0x76, 0x3F, 0x42, 0x85, 0xA2, 0xEC, 0x6A, 0x7E, 0x35, 0xD6,
+    0xCC, 0x96, 0xF3, 0x9C, 0x3C, 0xF3, 0x11, 0xEB, 0xC6, 0x2E, 0xE3, 0x2C, 0xEF, 0x69, 0x0E, 0xD8,
+    0x21, 0xA0, 0xB9, 0x72, 0x6B, 0x0C, 0x71, 0x2B, 0x05, 0x03, 0xEA, 0x12, 0x5E, 0xCA, 0xC5, 0x0D,
+    0xE7, 0x26, 0xEA, 0x7C, 0x06, 0x9D, 0x47, 0x00, 0x4B, 0x22, 0xEB, 0x25, 0x8B, 0xA9, 0x06, 0x89,
+    0xF8, 0x5B, 0x93, 0x7E, 0xE5, 0xB6, 0xF4, 0x05, 0x90, 0x46, 0x2F, 0xB3, 0x59, 0x82, 0x43, 0x05,
+    0xB0, 0xD9, 0x00, 0x5C, 0x0C, 0x9E, 0x98, 0xB2, 0xAA, 0xB0, 0xA3, 0xEE, 0x91, 0xA6, 0x53, 0x19,
+    0x4B, 0x91, 0x84, 0xEF, 0x21, 0xAB, 0x56, 0x0A, 0x8C, 0xE8, 0xAC, 0x2A, 0x7C, 0x52, 0x19, 0xF7,
+    0x9B, 0x0C, 0x4D, 0xFD, 0x0C, 0x50, 0x64, 0xBD, 0x8D, 0x3D, 0xE1, 0x83, 0xA1, 0xE9, 0xD5, 0xD1,
+    0x2B, 0x9B, 0x69, 0x33, 0xFE, 0x30, 0x60, 0xCA, 0x73, 0x23, 0x48, 0xAC, 0x6F, 0x05, 0xB1, 0xF5,
+    0xCD, 0xC0, 0x53, 0x23, 0xB1, 0xBE, 0x3F, 0x88, 0xAA, 0xBF, 0x18, 0x7F, 0x49, 0x91, 0xF2, 0x39,
+    0x56, 0xD1, 0xD8, 0x96, 0x28, 0x04, 0x9D, 0x3C, 0x1E, 0x83, 0xB9, 0x85, 0xD8, 0xB7, 0xAD, 0x74,
+    0x94, 0xED, 0xD9, 0x76, 0x4D, 0x91, 0x4C, 0x6C, 0xB3, 0xE6, 0x1E, 0xB6, 0x62, 0x3C, 0xC9, 0xAA,
+    0xB2, 0x12, 0xAE, 0xAF, 0x38, 0xDD, 0x57, 0x40, 0x9F, 0x36, 0xD9, 0x5F, 0xD4, 0x2C, 0x85, 0x4F,
+    0xC5, 0xBB, 0xA0, 0xE8, 0x89, 0xA5, 0xC4, 0xD4, 0xD8, 0x71, 0x76, 0xDE, 0xC7, 0xF9, 0x39, 0xEE,
+    0xFD, 0xA7, 0x02, 0x0E, 0x28, 0x11, 0x50, 0x8D, 0x21, 0xD5, 0x8E, 0xC2, 0xCA, 0x51, 0xFC, 0xC4,
+    0xB1, 0x1E, 0xE9, 0xB4, 0xBC, 0x5A, 0x2D, 0xAF, 0x08, 0xFB, 0xD1, 0x02, 0xE8, 0xC5, 0xE4, 0xFE,
+    0x26, 0x1C, 0x96, 0x61, 0x4D, 0x32, 0xB2, 0x94, 0x1D, 0xE2, 0x5B, 0xA0, 0xE7, 0x55, 0x01, 0x92,
+    0xE0, 0x75, 0x40, 0x07, 0x5B, 0x47, 0xE5, 0x34, 0x74, 0xDC, 0x0B, 0x33, 0x93, 0x56, 0x61, 0x79,
+    0x54, 0x4E, 0x58, 0xEC, 0x6A, 0x56, 0xA1, 0x82, 0xD4, 0xEF, 0x3B, 0xC6, 0xEB, 0x41, 0xDF, 0x1B,
+    0xBC, 0x61, 0x19, 0xF2, 0x2A, 0xE4, 0x29, 0x8D, 0x7C, 0x5E, 0x7E, 0xB6, 0x37, 0xE0, 0xAE, 0xCF,
+    0x46, 0xC7, 0xE9, 0x83, 0xA7, 0xEA, 0x7A, 0x66, 0x83, 0xF6, 0x14, 0x23, 0x78, 0x46, 0x14, 0xC2,
+    0x9E, 0x66, 0x22, 0x2D, 0x20, 0x76, 0xB3, 0xC8, 0xA2, 0x07, 0xED, 0x57, 0x7A, 0x65, 0x73, 0x43,
+    0x15, 0xD2, 0x59, 0x55, 0xFC, 0xD2, 0x61, 0xDB, 0x0F, 0x5A, 0x3C, 0xF8, 0x9C, 0xC5, 0x60, 0xBF,
+    0xC1, 0xCB, 0xBB, 0x0D, 0xDC, 0x3E, 0x9C, 0xB0, 0x1B, 0x37, 0x67, 0xAB, 0x87, 0xFD, 0x4E, 0xBE,
+    0xDD, 0x85, 0xDE, 0xB1, 0xBE, 0xC0, 0x13, 0x8F, 0xE1, 0x79, 0xC5, 0x45, 0xBF, 0xEC, 0xED, 0x1A,
+    0x63, 0xBC, 0x3A, 0x56, 0xFF, 0xCC, 0x39, 0x46, 0xD0, 0x2F, 0xE6, 0xDA, 0x0A, 0xAE, 0xBE, 0xAB,
+    0x0E, 0xC8, 0x6B, 0x3A, 0x77, 0x85, 0x0C, 0xCE, 0xBF, 0xE1, 0xBB, 0x2E, 0xD7, 0x23, 0x10, 0xE5,
+    0xC2, 0x98, 0x47, 0x53, 0x98, 0x92, 0x04, 0x73, 0x4F, 0xBA, 0xEA, 0x80, 0x83, 0xCC, 0x1E, 0x36,
+    0xDC, 0xD8, 0xDE, 0x62, 0x11, 0x96, 0x44, 0x2F, 0xF9, 0xB4, 0x01, 0x92, 0x94, 0xA9, 0x3C, 0xF7,
+    0x13, 0x37, 0xCD, 0xF1, 0x13, 0x75, 0xCC, 0xCD, 0xE1, 0x45, 0x77, 0xB0, 0x8A, 0xC2, 0xA5, 0xBE,
+    0xD0, 0xB8, 0x09, 0x78, 0x73, 0x0D, 0x26, 0x84, 0x72, 0x8E, 0x87, 0xCF, 0xF5, 0xEC, 0xFE, 0x88,
+    0x9F, 0x0E, 0x07, 0x87, 0x3C, 0x1C, 0xBC, 0xC6, 0xC3, 0xC1, 0x0B, 0x3C, 0x1C, 0x2C, 0xF0, 0x70,
+    0xB0, 0xC8, 0xE8, 0x2D, 0x71, 0x15, 0x5E, 0x64, 0xF4, 0xAE, 0xCD, 0x8C, 0xD2, 0xA8, 0x16, 0x55,
+    0x54, 0xFC, 0x0B, 0x3C, 0xE3, 0x1E, 0x42, 0xF2, 0x53, 0xCD, 0xC3, 0xC1, 0xFA, 0x73, 0xC3, 0x41,
+    0xCC, 0x98, 0x0C, 0x78, 0x9F, 0x11, 0xD3, 0xBC, 0x63, 0xCA, 0xB7, 0x08, 0x19, 0x35, 0x50, 0xD1,
+    0xA0, 0x1D, 0x1E, 0xF8, 0x38, 0x50, 0x0B, 0x18, 0x11, 0xA2, 0x1A, 0xD8, 0xC5, 0x16, 0x4D, 0x3C,
+    0xB1, 0x7E, 0xB6, 0x52, 0x5C, 0x01, 0x25, 0x93, 0xB8, 0x63, 0xF6, 0xC3, 0xC7, 0x6C, 0x87, 0xC1,
+    0x58, 0x67, 0xF3, 0x03, 0x04, 0xAD, 0xA8, 0x67, 0xF9, 0xEC, 0x48, 0x90, 0xAF, 0xF2, 0xBD, 0x3A,
+    0x68, 0x50, 0xD6, 0x75, 0x38, 0x89, 0xEA, 0xA0, 0x62, 0xC6, 0x70, 0xAA, 0x42, 0x86, 0x92, 0xC7,
+    0xAF, 0xCC, 0x91, 0x27, 0x34, 0x7A, 0xE6, 0x37, 0xBE, 0x95, 0x1A, 0xE9, 0xEE, 0x99, 0x3F, 0x5F,
+    0xBA, 0xA7, 0x3F, 0xFC, 0xDE, 0x67, 0xB9, 0xFA, 0x55, 0xEB, 0xA1, 0x3C, 0xFD, 0x61, 0x4E, 0x0B,
+    0x8F, 0xFA, 0x25, 0x41, 0xF2, 0x49, 0xEA, 0xFA, 0x02, 0x7F, 0x65, 0x73, 0x73, 0x03, 0x30, 0xDB,
+    0x5F, 0x67, 0x77, 0xAB, 0xDB, 0x72, 0xC7, 0x58, 0xF9, 0xB6, 0xE6, 0xF1, 0xC3, 0x67, 0xC4, 0xCD,
+    0xCE, 0xAE, 0x1F, 0x63, 0x58, 0x0C, 0x79, 0xEF, 0xF9, 0x96, 0xB9, 0x5A, 0x30, 0x24, 0x76, 0x50,
+    0x1E, 0x6D, 0xCC, 0x14, 0xD0, 0xCB, 0xE9, 0xB9, 0xAD, 0xAE, 0xF0, 0x7F, 0x43, 0x5D, 0x78, 0x3A,
+    0x61, 0x3D, 0xF4, 0xFD, 0x99, 0xB3, 0x8E, 0xDB, 0x2C, 0x6D, 0x09, 0x8B, 0x6A, 0xCB, 0x31, 0x80,
+    0x56, 0xAC, 0x3D, 0x25, 0x36, 0x01, 0x4D, 0x88, 0x25, 0x44, 0x20, 0x0B, 0xE9, 0x67, 0x86, 0xB2,
+    0x29, 0xD7, 0x70, 0x11, 0xBB, 0xAB, 0x7A, 0x4E, 0xE2, 0xE5, 0x72, 0x3D, 0x4F, 0xBA, 0xD8, 0x9E,
+    0x69, 0x81, 0x76, 0x13, 0xD4, 0x90, 0x67, 0x1B, 0x34, 0x81, 0x05, 0x22, 0x66, 0xBE, 0x1D, 0xE6,
+    0xCA, 0xF5, 0xC2, 0xCB, 0xFC, 0x5B, 0xC1, 0x1E, 0xDB, 0xC8, 0xEF, 0xF6, 0xA5, 0xCD, 0x1C, 0x1D,
+    0xA9, 0x92, 0xEE, 0x96, 0x9D, 0xDB, 0xA6, 0xDB, 0xB4, 0x8D, 0xB1, 0xE5, 0x4F, 0x2F, 0x63, 0xCA,
+    0xAC, 0x31, 0x64, 0x38, 0x1D, 0xEF, 0xAE, 0x78, 0x2D, 0x79, 0x13, 0x67, 0xA8, 0x63, 0x0A, 0x6B,
+    0x0C, 0xBE, 0xCC, 0x1A, 0x75, 0xA2, 0x7D, 0x21, 0x93, 0x2D, 0xD2, 0xB3, 0x7A, 0x0C, 0xCA, 0xA9,
+    0xEF, 0x19, 0x05, 0x95, 0xAF, 0x67, 0x26, 0x68, 0xCE, 0x40, 0xD8, 0xEA, 0x97, 0x62, 0x1B, 0xDB,
+    0x0B, 0xB1, 0x4D, 0xEC, 0x22, 0x46, 0xA9, 0x6A, 0x39, 0xA9, 0x84, 0x59, 0x12, 0x55, 0xAA, 0xD7,
+    0x04, 0x66, 0xA9, 0xED, 0x54, 0xCB, 0xC2, 0x66, 0x5A, 0xE6, 0x36, 0x2B, 0x64, 0x5E, 0x81, 0x0C,
+    0xCA, 0x2B, 0xC7, 0x71, 0xE7, 0x27, 0x09, 0x60, 0x55, 0xA1, 0x94, 0x90, 0x33, 0x4C, 0x1C, 0x7D,
+    0xC3, 0xC2, 0x3D, 0x59, 0x30, 0x6B, 0xAF, 0x37, 0x8C, 0xB0, 0x01, 0x91, 0x2F, 0xCF, 0xF2, 0x20,
+    0x38, 0xC8, 0xC4, 0xBD, 0xFF, 0x7F, 0xCA, 0x81, 0xB2, 0x67, 0x77, 0xBF, 0xDB, 0x9F, 0x01, 0xF2,
+    0x9D, 0x82, 0x17, 0xEA, 0xEF, 0x6D, 0xD0, 0x7E, 0xD2, 0x44, 0x93, 0x4F, 0xEA, 0x78, 0xFC, 0x07,
+    0x4A, 0x1E, 0xFF, 0x8C, 0xC4, 0xE3, 0x97, 0xFF, 0xD7, 0xB7, 0x2A, 0x96, 0xE6, 0x7E, 0x78, 0xF7,
+    0x53, 0x2A, 0x04, 0xF5, 0x95, 0x2D, 0x97, 0x83, 0x0E, 0x70, 0x92, 0xF7, 0x5B, 0x40, 0x55, 0x10,
+    0xA6, 0x72, 0xFC, 0x69, 0xD9, 0xE7, 0x86, 0x3F, 0x72, 0x33, 0x02, 0x0B, 0xA3, 0x98, 0xC5, 0xE5,
+    0x8C, 0xC5, 0xF2, 0x7A, 0xCD, 0x7E, 0x70, 0xAA, 0xFF, 0xC8, 0x4D, 0x92, 0x57, 0x2D, 0xF9, 0xDF,
+    0x84, 0x8E, 0x4D, 0x0B, 0xEE, 0x80, 0xC2, 0xDC, 0xB3, 0x51, 0x32, 0x2F, 0x76, 0x25, 0xFA, 0xB3,
+    0x97, 0x84, 0x45, 0xD4, 0x1C, 0x2D, 0x9D, 0xE8, 0xDE, 0x7F, 0x01, 0x63, 0x60, 0xA8, 0xFF, 0xB3,
+    0xFF, 0x4F, 0xD6, 0x12, 0x00, 0x4D, 0xCE, 0xB1, 0x0D, 0xC2, 0x30, 0x10, 0x05, 0xD0, 0x6F, 0x5B,
+    0xC8, 0x48, 0x29, 0xDC, 0x50, 0xD1, 0x64, 0x00, 0x0A, 0x36, 0xC0, 0x19, 0x81, 0x82, 0x71, 0x10,
+    0xC9, 0x10, 0x48, 0x6C, 0x43, 0x18, 0x21, 0x23, 0xA4, 0xA1, 0x4F, 0xE1, 0x22, 0x85, 0x9D, 0xCF,
+    0x5D, 0xA0, 0xE0, 0x8A, 0xE7, 0xE2, 0x6C, 0xFF, 0x0F, 0x7C, 0xC7, 0x72, 0x16, 0xEB, 0x37, 0xC5,
+    0xD8, 0xC5, 0x06, 0x68, 0x1B, 0xB5, 0x97, 0x13, 0x20, 0x78, 0x07, 0x96, 0xC0, 0x0C, 0x53, 0x36,
+    0xCB, 0x19, 0x36, 0x9B, 0x02, 0xB8, 0x6C, 0xB3, 0xEA, 0xD4, 0x59, 0xF5, 0xC9, 0xC9, 0x3F, 0xD5,
+    0xE4, 0x13, 0x10, 0xA6, 0x6A, 0x12, 0xC7, 0x20, 0xD6, 0xAB, 0xC7, 0xA1, 0xE2, 0x88, 0xE3, 0xCB,
+    0xB1, 0x41, 0x7C, 0x69, 0xAC, 0x46, 0x68, 0x88, 0x4E, 0x51, 0x0E, 0x49, 0x6D, 0x3B, 0xFC, 0x8D,
+    0xA5, 0xAE, 0xC2, 0xBB, 0x97, 0xCB, 0x51, 0x9E, 0x03, 0xA7, 0xD5, 0x9B, 0x34, 0xC5, 0xFE, 0x89,
+    0xFE, 0x6E, 0x49, 0xCF, 0x52, 0x8D, 0xAD, 0xE1, 0x25, 0x0C, 0x51, 0xFA, 0x86, 0x71, 0x87, 0x05,
+    0xA1, 0x48, 0x5F, 0x78, 0x0E, 0xD2, 0xD3, 0x30, 0x69, 0xC3, 0x3A, 0x4B, 0xC3, 0xAD, 0xCD, 0x7E,
+    0xC6, 0x15, 0x59, 0x7A, 0x3E, 0x57, 0xDB, 0x47, 0x72, 0x9C, 0x6A, 0x76, 0x86, 0xBF, 0xEC, 0x0F,
+    0x45, 0x8D, 0xB1, 0x0D, 0x80, 0x40, 0x0C, 0x03, 0x5F, 0x7C, 0x41, 0x41, 0x91, 0x51, 0x98, 0x00,
+    0x05, 0x46, 0x63, 0x12, 0x46, 0x21, 0xA3, 0x30, 0xC2, 0x17, 0x20, 0x01, 0x7A, 0x71, 0x24, 0xA2,
+    0x20, 0x52, 0x5C, 0xD8, 0xF2, 0x39, 0xA5, 0x9C, 0xE2, 0xC4, 0x42, 0xB5, 0x84, 0x52, 0x5D, 0x32,
+    0x84, 0x3D, 0x76, 0x1E, 0x0C, 0xED, 0xEC, 0x41, 0x15, 0xAB, 0x6E, 0x2F, 0x46, 0x12, 0x30, 0x4C,
+    0x61, 0xA2, 0xAC, 0x3C, 0x2D, 0xA7, 0xB2, 0xF7, 0x14, 0x61, 0xF7, 0x24, 0x73, 0x45, 0x19, 0x02,
+    0xA4, 0x07, 0xDE, 0x95, 0x4D, 0x9D, 0x93, 0x37, 0x0D, 0xFE, 0x5D, 0xFF, 0xAD, 0x6F, 0xB7, 0xF1,
+    0x7F, 0x01,
 };
 
 static const EpdGlyph notoserif_12_bolditalicGlyphs[] = {
@@ -2062,99 +2070,99 @@ static const EpdGlyph notoserif_12_bolditalicGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 9, 19, 158, 1, 18, 43, 0 }, // !
-    { 11, 8, 203, 3, 18, 22, 43 }, // "
-    { 15, 18, 224, 0, 18, 68, 65 }, // #
-    { 14, 21, 224, 0, 19, 74, 133 }, // $
-    { 21, 20, 358, 1, 19, 105, 207 }, // %
-    { 20, 20, 320, 0, 19, 100, 312 }, // &
-    { 6, 8, 116, 3, 18, 12, 412 }, // '
-    { 11, 24, 160, 1, 20, 66, 424 }, // (
-    { 12, 24, 160, -2, 20, 72, 490 }, // )
-    { 12, 12, 247, 3, 20, 36, 562 }, // *
-    { 12, 12, 224, 1, 15, 36, 598 }, // +
-    { 7, 8, 122, -1, 4, 14, 634 }, // ,
-    { 8, 4, 124, 0, 9, 8, 648 }, // -
-    { 6, 5, 122, 0, 4, 8, 656 }, // .
-    { 14, 23, 115, -3, 19, 81, 664 }, // /
-    { 15, 20, 224, 0, 19, 75, 745 }, // 0
-    { 12, 18, 206, 0, 18, 54, 820 }, // 1
-    { 16, 19, 224, -1, 19, 76, 874 }, // 2
-    { 15, 20, 224, -1, 19, 75, 950 }, // 3
-    { 14, 18, 224, 0, 18, 63, 1025 }, // 4
-    { 15, 19, 224, 0, 18, 72, 1088 }, // 5
-    { 14, 20, 224, 1, 19, 70, 1160 }, // 6
-    { 15, 18, 224, 1, 18, 68, 1230 }, // 7
-    { 15, 20, 224, 0, 19, 75, 1298 }, // 8
-    { 14, 20, 224, 0, 19, 70, 1373 }, // 9
-    { 7, 15, 143, 1, 14, 27, 1443 }, // :
-    { 9, 18, 143, -1, 14, 41, 1470 }, // ;
-    { 12, 14, 224, 1, 16, 42, 1511 }, // <
-    { 12, 8, 224, 1, 13, 24, 1553 }, // =
-    { 12, 14, 224, 1, 16, 42, 1577 }, // >
-    { 12, 20, 214, 2, 19, 60, 1619 }, // ?
-    { 21, 22, 368, 1, 18, 116, 1679 }, // @
-    { 20, 18, 301, -2, 18, 90, 1795 }, // A
-    { 18, 18, 269, -1, 18, 81, 1885 }, // B
-    { 17, 20, 267, 1, 19, 85, 1966 }, // C
-    { 20, 18, 307, -1, 18, 90, 2051 }, // D
-    { 18, 18, 253, -1, 18, 81, 2141 }, // E
-    { 18, 18, 248, -1, 18, 81, 2222 }, // F
-    { 19, 20, 318, 1, 19, 95, 2303 }, // G
-    { 24, 18, 328, -1, 18, 108, 2398 }, // H
-    { 13, 18, 160, -1, 18, 59, 2506 }, // I
-    { 16, 24, 160, -4, 18, 96, 2565 }, // J
-    { 22, 18, 296, -1, 18, 99, 2661 }, // K
-    { 17, 18, 262, -1, 18, 77, 2760 }, // L
-    { 27, 18, 381, -1, 18, 122, 2837 }, // M
-    { 23, 18, 315, -1, 18, 104, 2959 }, // N
-    { 19, 20, 317, 1, 19, 95, 3063 }, // O
-    { 18, 18, 265, -1, 18, 81, 3158 }, // P
-    { 19, 25, 315, 1, 19, 119, 3239 }, // Q
-    { 19, 18, 283, -1, 18, 86, 3358 }, // R
-    { 15, 20, 234, 0, 19, 75, 3444 }, // S
-    { 18, 18, 261, 1, 18, 81, 3519 }, // T
-    { 19, 19, 299, 2, 18, 91, 3600 }, // U
-    { 18, 18, 279, 2, 18, 81, 3691 }, // V
-    { 28, 18, 427, 2, 18, 126, 3772 }, // W
-    { 22, 18, 293, -2, 18, 99, 3898 }, // X
-    { 18, 18, 277, 2, 18, 81, 3997 }, // Y
-    { 19, 18, 266, -1, 18, 86, 4078 }, // Z
-    { 13, 23, 166, 0, 19, 75, 4164 }, // [
-    { 4, 23, 115, 2, 19, 23, 4239 }, // <backslash>
-    { 13, 23, 166, -2, 19, 75, 4262 }, // ]
-    { 12, 12, 224, 1, 18, 36, 4337 }, // ^
-    { 13, 2, 184, -3, -2, 7, 4373 }, // _
-    { 7, 5, 134, 3, 20, 9, 4380 }, // `
-    { 15, 15, 266, 1, 14, 57, 4389 }, // a
-    { 15, 20, 249, 0, 19, 75, 4446 }, // b
-    { 13, 15, 211, 1, 14, 49, 4521 }, // c
-    { 16, 20, 266, 1, 19, 80, 4570 }, // d
-    { 13, 15, 214, 1, 14, 49, 4650 }, // e
-    { 19, 26, 162, -4, 20, 124, 4699 }, // f
-    { 18, 21, 232, -2, 15, 95, 4823 }, // g
-    { 16, 20, 262, 0, 19, 80, 4918 }, // h
-    { 8, 21, 142, 1, 20, 42, 4998 }, // i
-    { 13, 26, 135, -4, 20, 85, 5040 }, // j
-    { 16, 19, 239, 0, 19, 76, 5125 }, // k
-    { 8, 20, 142, 1, 19, 40, 5201 }, // l
-    { 24, 15, 388, 0, 14, 90, 5241 }, // m
-    { 17, 15, 269, 0, 14, 64, 5331 }, // n
-    { 14, 15, 247, 1, 14, 53, 5395 }, // o
-    { 16, 20, 249, -1, 14, 80, 5448 }, // p
-    { 15, 20, 252, 1, 14, 75, 5528 }, // q
-    { 14, 14, 220, 0, 14, 49, 5603 }, // r
-    { 13, 15, 206, 0, 14, 49, 5652 }, // s
-    { 10, 18, 167, 1, 17, 45, 5701 }, // t
-    { 16, 15, 269, 1, 14, 60, 5746 }, // u
-    { 14, 15, 234, 0, 14, 53, 5806 }, // v
-    { 22, 15, 350, 0, 14, 83, 5859 }, // w
-    { 17, 14, 242, -1, 14, 60, 5942 }, // x
-    { 19, 20, 234, -5, 14, 95, 6002 }, // y
-    { 14, 14, 223, 0, 14, 49, 6097 }, // z
-    { 14, 23, 177, 0, 19, 81, 6146 }, // {
-    { 2, 25, 224, 6, 19, 13, 6227 }, // |
-    { 13, 24, 177, -2, 20, 78, 6240 }, // }
-    { 12, 6, 224, 1, 12, 18, 6318 }, // ~
+    { 11, 8, 203, 3, 18, 22, 0 }, // "
+    { 15, 18, 224, 0, 18, 68, 22 }, // #
+    { 14, 21, 224, 0, 19, 74, 90 }, // $
+    { 21, 20, 358, 1, 19, 105, 164 }, // %
+    { 20, 20, 320, 0, 19, 100, 269 }, // &
+    { 6, 8, 116, 3, 18, 12, 369 }, // '
+    { 11, 24, 160, 1, 20, 66, 43 }, // (
+    { 12, 24, 160, -2, 20, 72, 109 }, // )
+    { 12, 12, 247, 3, 20, 36, 381 }, // *
+    { 12, 12, 224, 1, 15, 36, 417 }, // +
+    { 7, 8, 122, -1, 4, 14, 181 }, // ,
+    { 8, 4, 124, 0, 9, 8, 195 }, // -
+    { 6, 5, 122, 0, 4, 8, 203 }, // .
+    { 14, 23, 115, -3, 19, 81, 453 }, // /
+    { 15, 20, 224, 0, 19, 75, 211 }, // 0
+    { 12, 18, 206, 0, 18, 54, 286 }, // 1
+    { 16, 19, 224, -1, 19, 76, 340 }, // 2
+    { 15, 20, 224, -1, 19, 75, 416 }, // 3
+    { 14, 18, 224, 0, 18, 63, 491 }, // 4
+    { 15, 19, 224, 0, 18, 72, 554 }, // 5
+    { 14, 20, 224, 1, 19, 70, 626 }, // 6
+    { 15, 18, 224, 1, 18, 68, 696 }, // 7
+    { 15, 20, 224, 0, 19, 75, 764 }, // 8
+    { 14, 20, 224, 0, 19, 70, 839 }, // 9
+    { 7, 15, 143, 1, 14, 27, 909 }, // :
+    { 9, 18, 143, -1, 14, 41, 936 }, // ;
+    { 12, 14, 224, 1, 16, 42, 534 }, // <
+    { 12, 8, 224, 1, 13, 24, 576 }, // =
+    { 12, 14, 224, 1, 16, 42, 600 }, // >
+    { 12, 20, 214, 2, 19, 60, 977 }, // ?
+    { 21, 22, 368, 1, 18, 116, 642 }, // @
+    { 20, 18, 301, -2, 18, 90, 1037 }, // A
+    { 18, 18, 269, -1, 18, 81, 1127 }, // B
+    { 17, 20, 267, 1, 19, 85, 1208 }, // C
+    { 20, 18, 307, -1, 18, 90, 1293 }, // D
+    { 18, 18, 253, -1, 18, 81, 1383 }, // E
+    { 18, 18, 248, -1, 18, 81, 1464 }, // F
+    { 19, 20, 318, 1, 19, 95, 1545 }, // G
+    { 24, 18, 328, -1, 18, 108, 1640 }, // H
+    { 13, 18, 160, -1, 18, 59, 1748 }, // I
+    { 16, 24, 160, -4, 18, 96, 1807 }, // J
+    { 22, 18, 296, -1, 18, 99, 1903 }, // K
+    { 17, 18, 262, -1, 18, 77, 2002 }, // L
+    { 27, 18, 381, -1, 18, 122, 2079 }, // M
+    { 23, 18, 315, -1, 18, 104, 2201 }, // N
+    { 19, 20, 317, 1, 19, 95, 2305 }, // O
+    { 18, 18, 265, -1, 18, 81, 2400 }, // P
+    { 19, 25, 315, 1, 19, 119, 2481 }, // Q
+    { 19, 18, 283, -1, 18, 86, 2600 }, // R
+    { 15, 20, 234, 0, 19, 75, 2686 }, // S
+    { 18, 18, 261, 1, 18, 81, 2761 }, // T
+    { 19, 19, 299, 2, 18, 91, 758 }, // U
+    { 18, 18, 279, 2, 18, 81, 2842 }, // V
+    { 28, 18, 427, 2, 18, 126, 2923 }, // W
+    { 22, 18, 293, -2, 18, 99, 3049 }, // X
+    { 18, 18, 277, 2, 18, 81, 3148 }, // Y
+    { 19, 18, 266, -1, 18, 86, 3229 }, // Z
+    { 13, 23, 166, 0, 19, 75, 849 }, // [
+    { 4, 23, 115, 2, 19, 23, 924 }, // <backslash>
+    { 13, 23, 166, -2, 19, 75, 947 }, // ]
+    { 12, 12, 224, 1, 18, 36, 1022 }, // ^
+    { 13, 2, 184, -3, -2, 7, 1058 }, // _
+    { 7, 5, 134, 3, 20, 9, 1065 }, // `
+    { 15, 15, 266, 1, 14, 57, 3315 }, // a
+    { 15, 20, 249, 0, 19, 75, 3372 }, // b
+    { 13, 15, 211, 1, 14, 49, 3447 }, // c
+    { 16, 20, 266, 1, 19, 80, 3496 }, // d
+    { 13, 15, 214, 1, 14, 49, 3576 }, // e
+    { 19, 26, 162, -4, 20, 124, 3625 }, // f
+    { 18, 21, 232, -2, 15, 95, 3749 }, // g
+    { 16, 20, 262, 0, 19, 80, 3844 }, // h
+    { 8, 21, 142, 1, 20, 42, 3924 }, // i
+    { 13, 26, 135, -4, 20, 85, 3966 }, // j
+    { 16, 19, 239, 0, 19, 76, 4051 }, // k
+    { 8, 20, 142, 1, 19, 40, 4127 }, // l
+    { 24, 15, 388, 0, 14, 90, 4167 }, // m
+    { 17, 15, 269, 0, 14, 64, 4257 }, // n
+    { 14, 15, 247, 1, 14, 53, 4321 }, // o
+    { 16, 20, 249, -1, 14, 80, 4374 }, // p
+    { 15, 20, 252, 1, 14, 75, 4454 }, // q
+    { 14, 14, 220, 0, 14, 49, 4529 }, // r
+    { 13, 15, 206, 0, 14, 49, 4578 }, // s
+    { 10, 18, 167, 1, 17, 45, 4627 }, // t
+    { 16, 15, 269, 1, 14, 60, 4672 }, // u
+    { 14, 15, 234, 0, 14, 53, 4732 }, // v
+    { 22, 15, 350, 0, 14, 83, 4785 }, // w
+    { 17, 14, 242, -1, 14, 60, 4868 }, // x
+    { 19, 20, 234, -5, 14, 95, 4928 }, // y
+    { 14, 14, 223, 0, 14, 49, 5023 }, // z
+    { 14, 23, 177, 0, 19, 81, 1074 }, // {
+    { 2, 25, 224, 6, 19, 13, 1155 }, // |
+    { 13, 24, 177, -2, 20, 78, 1168 }, // }
+    { 12, 6, 224, 1, 12, 18, 1246 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 8, 19, 158, 0, 14, 38, 0 }, // U+00A1
     { 14, 18, 224, 1, 18, 63, 38 }, // U+00A2
@@ -2238,19 +2246,19 @@ static const EpdGlyph notoserif_12_bolditalicGlyphs[] = {
     { 14, 21, 246, 1, 20, 74, 6014 }, // U+00F0
     { 17, 21, 269, 0, 20, 90, 6088 }, // U+00F1
     { 14, 21, 247, 1, 20, 74, 6178 }, // U+00F2
-    { 15, 21, 247, 1, 20, 79, 6252 }, // U+00F3
-    { 14, 21, 247, 1, 20, 74, 6331 }, // U+00F4
-    { 14, 21, 247, 1, 20, 74, 6405 }, // U+00F5
-    { 14, 21, 247, 1, 20, 74, 6479 }, // U+00F6
-    { 12, 14, 224, 1, 16, 42, 6553 }, // U+00F7
-    { 15, 17, 247, 0, 15, 64, 6595 }, // U+00F8
-    { 16, 21, 269, 1, 20, 84, 6659 }, // U+00F9
-    { 16, 21, 269, 1, 20, 84, 6743 }, // U+00FA
-    { 16, 21, 269, 1, 20, 84, 6827 }, // U+00FB
-    { 16, 21, 269, 1, 20, 84, 6911 }, // U+00FC
-    { 19, 26, 234, -5, 20, 124, 6995 }, // U+00FD
-    { 16, 25, 249, -1, 19, 100, 7119 }, // U+00FE
-    { 19, 26, 234, -5, 20, 124, 7219 }, // U+00FF
+    { 15, 21, 247, 1, 20, 79, 5072 }, // U+00F3
+    { 14, 21, 247, 1, 20, 74, 6252 }, // U+00F4
+    { 14, 21, 247, 1, 20, 74, 6326 }, // U+00F5
+    { 14, 21, 247, 1, 20, 74, 6400 }, // U+00F6
+    { 12, 14, 224, 1, 16, 42, 6474 }, // U+00F7
+    { 15, 17, 247, 0, 15, 64, 6516 }, // U+00F8
+    { 16, 21, 269, 1, 20, 84, 6580 }, // U+00F9
+    { 16, 21, 269, 1, 20, 84, 6664 }, // U+00FA
+    { 16, 21, 269, 1, 20, 84, 6748 }, // U+00FB
+    { 16, 21, 269, 1, 20, 84, 6832 }, // U+00FC
+    { 19, 26, 234, -5, 20, 124, 6916 }, // U+00FD
+    { 16, 25, 249, -1, 19, 100, 7040 }, // U+00FE
+    { 19, 26, 234, -5, 20, 124, 7140 }, // U+00FF
     { 20, 22, 301, -2, 22, 110, 0 }, // U+0100
     { 15, 19, 266, 1, 18, 72, 110 }, // U+0101
     { 20, 24, 301, -2, 24, 120, 182 }, // U+0102
@@ -2952,98 +2960,98 @@ static const EpdGlyph notoserif_12_bolditalicGlyphs[] = {
     { 8, 4, 124, 0, 9, 8, 121 }, // U+2010
     { 8, 4, 124, 0, 9, 8, 129 }, // U+2011
     { 14, 2, 224, 0, 10, 7, 137 }, // U+2012
-    { 14, 3, 200, -1, 8, 11, 144 }, // U+2013
-    { 27, 3, 400, -1, 8, 21, 155 }, // U+2014
-    { 27, 3, 400, -1, 8, 21, 176 }, // U+2015
-    { 9, 25, 224, 3, 19, 57, 197 }, // U+2016
-    { 14, 6, 164, -3, 0, 21, 254 }, // U+2017
-    { 7, 8, 112, 2, 18, 14, 275 }, // U+2018
-    { 6, 8, 112, 2, 18, 12, 289 }, // U+2019
-    { 7, 8, 112, -1, 4, 14, 301 }, // U+201A
-    { 5, 8, 112, 3, 18, 10, 315 }, // U+201B
-    { 12, 8, 196, 2, 18, 24, 325 }, // U+201C
-    { 11, 8, 196, 2, 18, 22, 349 }, // U+201D
-    { 12, 8, 196, -1, 4, 24, 371 }, // U+201E
-    { 12, 8, 196, 2, 18, 24, 395 }, // U+201F
-    { 12, 22, 191, 1, 19, 66, 419 }, // U+2020
-    { 15, 22, 191, -1, 19, 83, 485 }, // U+2021
-    { 9, 9, 160, 1, 13, 21, 568 }, // U+2022
-    { 9, 9, 200, 3, 13, 21, 589 }, // U+2023
-    { 5, 5, 122, 2, 11, 7, 610 }, // U+2024
-    { 12, 5, 236, 2, 11, 15, 617 }, // U+2025
-    { 20, 5, 366, 1, 4, 25, 632 }, // U+2026
-    { 6, 5, 122, 1, 9, 8, 657 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 665 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 665 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 665 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 700 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 735 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 768 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 801 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 834 }, // U+202F
-    { 31, 20, 521, 1, 19, 155, 834 }, // U+2030
-    { 41, 20, 682, 1, 19, 205, 989 }, // U+2031
-    { 6, 8, 116, 3, 18, 12, 1194 }, // U+2032
-    { 12, 8, 207, 3, 18, 24, 1206 }, // U+2033
-    { 18, 8, 298, 3, 18, 36, 1230 }, // U+2034
-    { 6, 8, 116, 3, 18, 12, 1266 }, // U+2035
-    { 11, 8, 207, 3, 18, 22, 1278 }, // U+2036
-    { 17, 8, 298, 3, 18, 34, 1300 }, // U+2037
-    { 11, 8, 176, -1, 2, 22, 1334 }, // U+2038
-    { 8, 11, 141, 1, 12, 22, 1356 }, // U+2039
-    { 8, 11, 141, 0, 12, 22, 1378 }, // U+203A
-    { 18, 18, 328, 1, 18, 81, 1400 }, // U+203B
-    { 15, 19, 252, 1, 18, 72, 1481 }, // U+203C
-    { 13, 20, 232, 2, 19, 65, 1553 }, // U+203D
-    { 13, 2, 184, 2, 21, 7, 1618 }, // U+203E
-    { 20, 6, 0, -18, 0, 30, 1625 }, // U+203F
-    { 21, 6, 0, -16, 22, 32, 1655 }, // U+2040
-    { 12, 18, 180, -1, 18, 54, 1687 }, // U+2041
-    { 24, 21, 400, 0, 20, 126, 1741 }, // U+2042
-    { 9, 5, 145, 0, 11, 12, 1867 }, // U+2043
-    { 16, 18, 25, -7, 18, 72, 1879 }, // U+2044
-    { 13, 23, 166, 0, 19, 75, 1951 }, // U+2045
-    { 13, 23, 166, -2, 19, 75, 2026 }, // U+2046
-    { 25, 20, 426, 2, 19, 125, 2101 }, // U+2047
-    { 19, 20, 338, 2, 19, 95, 2226 }, // U+2048
-    { 21, 20, 336, 1, 19, 105, 2321 }, // U+2049
-    { 13, 20, 244, 1, 15, 65, 2426 }, // U+204A
-    { 15, 22, 251, 2, 19, 83, 2491 }, // U+204B
-    { 14, 10, 247, 1, 14, 35, 2574 }, // U+204C
-    { 14, 10, 247, 1, 14, 35, 2609 }, // U+204D
-    { 12, 12, 201, 1, 15, 36, 2644 }, // U+204E
-    { 7, 19, 143, 1, 14, 34, 2680 }, // U+204F
-    { 18, 20, 308, 1, 19, 90, 2714 }, // U+2050
-    { 15, 23, 201, -1, 20, 87, 2804 }, // U+2051
-    { 10, 19, 176, 1, 18, 48, 2891 }, // U+2052
-    { 12, 6, 224, 1, 12, 18, 2939 }, // U+2053
-    { 20, 6, 0, -7, 0, 30, 2957 }, // U+2054
-    { 12, 12, 216, 1, 15, 36, 2987 }, // U+2055
-    { 13, 15, 252, 1, 14, 49, 3023 }, // U+2056
-    { 23, 8, 389, 3, 18, 46, 3072 }, // U+2057
-    { 17, 15, 306, 1, 14, 64, 3118 }, // U+2058
-    { 17, 15, 306, 1, 14, 64, 3182 }, // U+2059
-    { 5, 20, 122, 1, 19, 25, 3246 }, // U+205A
-    { 17, 20, 306, 1, 19, 85, 3271 }, // U+205B
-    { 14, 14, 279, 2, 14, 49, 3356 }, // U+205C
-    { 5, 20, 122, 2, 19, 25, 3405 }, // U+205D
-    { 5, 20, 122, 1, 19, 25, 3430 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 3455 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2064
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2066
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2067
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2068
-    { 0, 0, 240, 0, 0, 0, 3455 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 3455 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3488 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3521 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3554 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3587 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3620 }, // U+206F
+    { 14, 3, 200, -1, 8, 11, 5151 }, // U+2013
+    { 27, 3, 400, -1, 8, 21, 5162 }, // U+2014
+    { 27, 3, 400, -1, 8, 21, 144 }, // U+2015
+    { 9, 25, 224, 3, 19, 57, 165 }, // U+2016
+    { 14, 6, 164, -3, 0, 21, 222 }, // U+2017
+    { 7, 8, 112, 2, 18, 14, 243 }, // U+2018
+    { 6, 8, 112, 2, 18, 12, 5183 }, // U+2019
+    { 7, 8, 112, -1, 4, 14, 257 }, // U+201A
+    { 5, 8, 112, 3, 18, 10, 271 }, // U+201B
+    { 12, 8, 196, 2, 18, 24, 5195 }, // U+201C
+    { 11, 8, 196, 2, 18, 22, 5219 }, // U+201D
+    { 12, 8, 196, -1, 4, 24, 281 }, // U+201E
+    { 12, 8, 196, 2, 18, 24, 305 }, // U+201F
+    { 12, 22, 191, 1, 19, 66, 329 }, // U+2020
+    { 15, 22, 191, -1, 19, 83, 395 }, // U+2021
+    { 9, 9, 160, 1, 13, 21, 478 }, // U+2022
+    { 9, 9, 200, 3, 13, 21, 499 }, // U+2023
+    { 5, 5, 122, 2, 11, 7, 520 }, // U+2024
+    { 12, 5, 236, 2, 11, 15, 527 }, // U+2025
+    { 20, 5, 366, 1, 4, 25, 5241 }, // U+2026
+    { 6, 5, 122, 1, 9, 8, 542 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 550 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 550 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 550 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 585 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 620 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 653 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 686 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 719 }, // U+202F
+    { 31, 20, 521, 1, 19, 155, 719 }, // U+2030
+    { 41, 20, 682, 1, 19, 205, 874 }, // U+2031
+    { 6, 8, 116, 3, 18, 12, 1079 }, // U+2032
+    { 12, 8, 207, 3, 18, 24, 1091 }, // U+2033
+    { 18, 8, 298, 3, 18, 36, 1115 }, // U+2034
+    { 6, 8, 116, 3, 18, 12, 1151 }, // U+2035
+    { 11, 8, 207, 3, 18, 22, 1163 }, // U+2036
+    { 17, 8, 298, 3, 18, 34, 1185 }, // U+2037
+    { 11, 8, 176, -1, 2, 22, 1219 }, // U+2038
+    { 8, 11, 141, 1, 12, 22, 1241 }, // U+2039
+    { 8, 11, 141, 0, 12, 22, 1263 }, // U+203A
+    { 18, 18, 328, 1, 18, 81, 1285 }, // U+203B
+    { 15, 19, 252, 1, 18, 72, 1366 }, // U+203C
+    { 13, 20, 232, 2, 19, 65, 1438 }, // U+203D
+    { 13, 2, 184, 2, 21, 7, 1503 }, // U+203E
+    { 20, 6, 0, -18, 0, 30, 1510 }, // U+203F
+    { 21, 6, 0, -16, 22, 32, 1540 }, // U+2040
+    { 12, 18, 180, -1, 18, 54, 1572 }, // U+2041
+    { 24, 21, 400, 0, 20, 126, 1626 }, // U+2042
+    { 9, 5, 145, 0, 11, 12, 1752 }, // U+2043
+    { 16, 18, 25, -7, 18, 72, 1764 }, // U+2044
+    { 13, 23, 166, 0, 19, 75, 1836 }, // U+2045
+    { 13, 23, 166, -2, 19, 75, 1911 }, // U+2046
+    { 25, 20, 426, 2, 19, 125, 1986 }, // U+2047
+    { 19, 20, 338, 2, 19, 95, 2111 }, // U+2048
+    { 21, 20, 336, 1, 19, 105, 2206 }, // U+2049
+    { 13, 20, 244, 1, 15, 65, 2311 }, // U+204A
+    { 15, 22, 251, 2, 19, 83, 2376 }, // U+204B
+    { 14, 10, 247, 1, 14, 35, 2459 }, // U+204C
+    { 14, 10, 247, 1, 14, 35, 2494 }, // U+204D
+    { 12, 12, 201, 1, 15, 36, 2529 }, // U+204E
+    { 7, 19, 143, 1, 14, 34, 2565 }, // U+204F
+    { 18, 20, 308, 1, 19, 90, 2599 }, // U+2050
+    { 15, 23, 201, -1, 20, 87, 2689 }, // U+2051
+    { 10, 19, 176, 1, 18, 48, 2776 }, // U+2052
+    { 12, 6, 224, 1, 12, 18, 2824 }, // U+2053
+    { 20, 6, 0, -7, 0, 30, 2842 }, // U+2054
+    { 12, 12, 216, 1, 15, 36, 2872 }, // U+2055
+    { 13, 15, 252, 1, 14, 49, 2908 }, // U+2056
+    { 23, 8, 389, 3, 18, 46, 2957 }, // U+2057
+    { 17, 15, 306, 1, 14, 64, 3003 }, // U+2058
+    { 17, 15, 306, 1, 14, 64, 3067 }, // U+2059
+    { 5, 20, 122, 1, 19, 25, 3131 }, // U+205A
+    { 17, 20, 306, 1, 19, 85, 3156 }, // U+205B
+    { 14, 14, 279, 2, 14, 49, 3241 }, // U+205C
+    { 5, 20, 122, 2, 19, 25, 3290 }, // U+205D
+    { 5, 20, 122, 1, 19, 25, 3315 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 3340 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2064
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2066
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2067
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2068
+    { 0, 0, 240, 0, 0, 0, 3340 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 3340 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 3373 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 3406 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 3439 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 3472 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3505 }, // U+206F
     { 10, 12, 160, 2, 21, 30, 0 }, // U+2070
     { 5, 12, 92, 2, 19, 15, 30 }, // U+2071
     { 10, 12, 160, 1, 21, 30, 45 }, // U+2074
@@ -3119,13 +3127,13 @@ static const EpdGlyph notoserif_12_bolditalicGlyphs[] = {
     { 16, 20, 224, 0, 20, 80, 2817 }, // U+20BE
     { 17, 23, 224, -2, 20, 98, 2897 }, // U+20BF
     { 8, 4, 124, 0, 9, 8, 0 }, // U+2212
-    { 27, 26, 292, -4, 20, 176, 0 }, // U+FB00
-    { 21, 26, 274, -4, 20, 137, 176 }, // U+FB01
-    { 22, 26, 284, -4, 20, 143, 313 }, // U+FB02
-    { 29, 26, 405, -4, 20, 189, 456 }, // U+FB03
-    { 30, 26, 414, -4, 20, 195, 645 }, // U+FB04
-    { 24, 26, 302, -4, 20, 156, 840 }, // U+FB05
-    { 24, 21, 372, 0, 20, 126, 996 }, // U+FB06
+    { 27, 26, 292, -4, 20, 176, 5266 }, // U+FB00
+    { 21, 26, 274, -4, 20, 137, 5442 }, // U+FB01
+    { 22, 26, 284, -4, 20, 143, 5579 }, // U+FB02
+    { 29, 26, 405, -4, 20, 189, 5722 }, // U+FB03
+    { 30, 26, 414, -4, 20, 195, 5911 }, // U+FB04
+    { 24, 26, 302, -4, 20, 156, 0 }, // U+FB05
+    { 24, 21, 372, 0, 20, 126, 156 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -3133,8 +3141,7 @@ static const EpdUnicodeInterval notoserif_12_bolditalicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3142,8 +3149,7 @@ static const EpdUnicodeInterval notoserif_12_bolditalicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3153,19 +3159,57 @@ static const EpdUnicodeInterval notoserif_12_bolditalicIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_12_bolditalicGroups[] = {
-    { 0, 3549, 6881, 97, 0 },
-    { 3549, 2928, 7948, 96, 97 },
-    { 6477, 3719, 13178, 128, 193 },
-    { 10196, 3715, 11269, 96, 321 },
-    { 13911, 1159, 1726, 112, 417 },
-    { 15070, 10148, 26085, 256, 529 },
-    { 25218, 2047, 10437, 90, 785 },
-    { 27265, 2023, 4161, 111, 875 },
-    { 29288, 880, 1316, 42, 986 },
-    { 30168, 1966, 3210, 32, 1028 },
-    { 32134, 10, 8, 1, 1060 },
-    { 32144, 489, 1192, 7, 1061 },
-    { 32633, 98, 138, 1, 1068 },
+    { 0, 3256, 6590, 83, 2 },
+    { 3256, 799, 1407, 26, 0 },
+    { 4055, 2919, 7864, 95, 97 },
+    { 6974, 3719, 13178, 128, 193 },
+    { 10693, 3715, 11269, 96, 321 },
+    { 14408, 1159, 1726, 112, 417 },
+    { 15567, 10148, 26085, 256, 529 },
+    { 25715, 2047, 10437, 90, 785 },
+    { 27762, 1947, 4039, 105, 875 },
+    { 29709, 880, 1316, 42, 986 },
+    { 30589, 1966, 3210, 32, 1028 },
+    { 32555, 10, 8, 1, 1060 },
+    { 32565, 187, 282, 2, 1066 },
+    { 32752, 98, 138, 1, 1068 },
+};
+
+static const uint16_t notoserif_12_bolditalicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_12_bolditalicKernLeftClasses[] = {
@@ -4396,18 +4440,81 @@ static const EpdLigaturePair notoserif_12_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_12_bolditalicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 0 }, { 0x0004, 1, 1 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 2 }, { 0x0009, 1, 1 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 3 }, { 0x000C, 4, 4 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 10 }, { 0x0024, 8, 11 }, { 0x0025, 9, 12 }, { 0x0026, 10, 11 }, { 0x0027, 11, 11 }, { 0x0028, 12, 11 }, { 0x0029, 13, 12 }, // U+0040
+    { 0x002A, 0, 11 }, { 0x002B, 0, 11 }, { 0x002C, 14, 11 }, { 0x002D, 15, 11 }, { 0x002E, 16, 11 }, { 0x002F, 0, 11 }, { 0x0030, 17, 11 }, { 0x0031, 10, 12 }, // U+0048
+    { 0x0032, 18, 11 }, { 0x0033, 10, 12 }, { 0x0034, 19, 11 }, { 0x0035, 20, 13 }, { 0x0036, 21, 14 }, { 0x0037, 22, 15 }, { 0x0038, 23, 16 }, { 0x0039, 24, 17 }, // U+0050
+    { 0x003A, 25, 18 }, { 0x003B, 26, 19 }, { 0x003C, 0, 20 }, { 0x003D, 3, 0 }, { 0x003E, 0, 21 }, { 0x003F, 0, 3 }, { 0x0040, 0, 0 }, { 0x0041, 27, 22 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 28, 23 }, { 0x0044, 29, 24 }, { 0x0045, 30, 25 }, { 0x0046, 0, 25 }, { 0x0047, 30, 25 }, { 0x0048, 31, 0 }, { 0x0049, 0, 26 }, // U+0060
+    { 0x004A, 28, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 32, 24 }, { 0x004E, 0, 28 }, { 0x004F, 28, 29 }, { 0x0050, 28, 29 }, { 0x0051, 29, 25 }, // U+0068
+    { 0x0052, 29, 29 }, { 0x0053, 33, 25 }, { 0x0054, 34, 29 }, { 0x0055, 35, 30 }, { 0x0056, 0, 31 }, { 0x0057, 0, 32 }, { 0x0058, 36, 33 }, { 0x0059, 37, 34 }, // U+0070
+    { 0x005A, 0, 35 }, { 0x005B, 38, 36 }, { 0x005C, 39, 37 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 3 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 40, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 38 }, { 0x006B, 0, 0 }, { 0x006C, 41, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 38 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 39 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 42, 0 }, // U+00B8
+    { 0x0081, 43, 10 }, { 0x0082, 43, 10 }, { 0x0083, 43, 10 }, { 0x0084, 43, 10 }, { 0x0085, 43, 10 }, { 0x0086, 43, 10 }, { 0x0087, 11, 40 }, { 0x0088, 9, 12 }, // U+00C0
+    { 0x0089, 11, 11 }, { 0x008A, 11, 11 }, { 0x008B, 11, 11 }, { 0x008C, 11, 11 }, { 0x008D, 0, 11 }, { 0x008E, 0, 11 }, { 0x008F, 0, 11 }, { 0x0090, 0, 11 }, // U+00C8
+    { 0x0091, 10, 11 }, { 0x0092, 17, 11 }, { 0x0093, 10, 12 }, { 0x0094, 10, 12 }, { 0x0095, 10, 12 }, { 0x0096, 10, 12 }, { 0x0097, 10, 12 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 12 }, { 0x009A, 22, 15 }, { 0x009B, 22, 15 }, { 0x009C, 22, 15 }, { 0x009D, 22, 15 }, { 0x009E, 26, 19 }, { 0x009F, 10, 11 }, { 0x00A0, 35, 0 }, // U+00D8
+    { 0x00A1, 28, 23 }, { 0x00A2, 28, 23 }, { 0x00A3, 28, 23 }, { 0x00A4, 28, 23 }, { 0x00A5, 28, 23 }, { 0x00A6, 28, 23 }, { 0x00A7, 30, 23 }, { 0x00A8, 30, 25 }, // U+00E0
+    { 0x00A9, 30, 25 }, { 0x00AA, 30, 25 }, { 0x00AB, 30, 25 }, { 0x00AC, 30, 25 }, { 0x00AD, 0, 27 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 27 }, { 0x00B0, 0, 27 }, // U+00E8
+    { 0x00B1, 29, 25 }, { 0x00B2, 28, 29 }, { 0x00B3, 29, 25 }, { 0x00B4, 29, 25 }, { 0x00B5, 29, 25 }, { 0x00B6, 29, 25 }, { 0x00B7, 29, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 29, 25 }, { 0x00BA, 28, 32 }, { 0x00BB, 28, 32 }, { 0x00BC, 28, 32 }, { 0x00BD, 28, 32 }, { 0x00BE, 38, 36 }, { 0x00BF, 29, 24 }, { 0x00C0, 38, 36 }, // U+00F8
+    { 0x00C1, 7, 10 }, { 0x00C2, 28, 23 }, { 0x00C3, 43, 10 }, { 0x00C4, 28, 23 }, { 0x00C5, 43, 10 }, { 0x00C6, 28, 23 }, { 0x00C7, 9, 12 }, { 0x00C8, 30, 25 }, // U+0100
+    { 0x00C9, 9, 12 }, { 0x00CA, 30, 25 }, { 0x00CB, 9, 12 }, { 0x00CC, 30, 25 }, { 0x00CD, 9, 12 }, { 0x00CE, 30, 25 }, { 0x00CF, 10, 11 }, { 0x00D0, 44, 25 }, // U+0108
+    { 0x00D1, 10, 11 }, { 0x00D2, 0, 25 }, { 0x00D3, 11, 11 }, { 0x00D4, 30, 25 }, { 0x00D5, 11, 11 }, { 0x00D6, 30, 25 }, { 0x00D7, 11, 11 }, { 0x00D8, 30, 25 }, // U+0110
+    { 0x00D9, 11, 11 }, { 0x00DA, 30, 25 }, { 0x00DB, 11, 11 }, { 0x00DC, 30, 25 }, { 0x00DD, 13, 12 }, { 0x00DE, 0, 25 }, { 0x00DF, 13, 12 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 13, 12 }, { 0x00E2, 0, 25 }, { 0x00E3, 13, 12 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 11 }, { 0x00E6, 28, 24 }, { 0x00E7, 0, 11 }, { 0x00E8, 28, 24 }, // U+0120
+    { 0x00E9, 0, 11 }, { 0x00EA, 0, 27 }, { 0x00EB, 0, 11 }, { 0x00EC, 0, 27 }, { 0x00ED, 0, 11 }, { 0x00EE, 0, 27 }, { 0x00EF, 0, 11 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 11 }, { 0x00F2, 0, 0 }, { 0x00F3, 14, 11 }, { 0x00F4, 0, 27 }, { 0x00F5, 14, 11 }, { 0x00F6, 0, 0 }, { 0x00F7, 15, 11 }, { 0x00F8, 32, 24 }, // U+0130
+    { 0x00F9, 32, 29 }, { 0x00FA, 16, 11 }, { 0x00FB, 0, 28 }, { 0x00FC, 16, 11 }, { 0x00FD, 0, 28 }, { 0x00FE, 45, 11 }, { 0x00FF, 44, 28 }, { 0x0100, 0, 11 }, // U+0138
+    { 0x0101, 0, 28 }, { 0x0102, 16, 11 }, { 0x0103, 0, 28 }, { 0x0104, 17, 11 }, { 0x0105, 28, 29 }, { 0x0106, 17, 11 }, { 0x0107, 28, 29 }, { 0x0108, 17, 11 }, // U+0140
+    { 0x0109, 28, 29 }, { 0x010A, 28, 41 }, { 0x010B, 14, 11 }, { 0x010C, 28, 29 }, { 0x010D, 10, 12 }, { 0x010E, 29, 25 }, { 0x010F, 10, 12 }, { 0x0110, 29, 25 }, // U+0148
+    { 0x0111, 10, 12 }, { 0x0112, 29, 25 }, { 0x0113, 11, 12 }, { 0x0114, 30, 25 }, { 0x0115, 19, 11 }, { 0x0116, 34, 29 }, { 0x0117, 19, 11 }, { 0x0118, 34, 29 }, // U+0150
+    { 0x0119, 19, 11 }, { 0x011A, 34, 29 }, { 0x011B, 20, 13 }, { 0x011C, 35, 30 }, { 0x011D, 20, 13 }, { 0x011E, 35, 30 }, { 0x011F, 20, 13 }, { 0x0120, 35, 30 }, // U+0158
+    { 0x0121, 20, 13 }, { 0x0122, 35, 30 }, { 0x0123, 21, 0 }, { 0x0124, 0, 31 }, { 0x0125, 21, 0 }, { 0x0126, 0, 31 }, { 0x0127, 21, 0 }, { 0x0128, 0, 31 }, // U+0160
+    { 0x0129, 22, 15 }, { 0x012A, 28, 32 }, { 0x012B, 22, 15 }, { 0x012C, 28, 32 }, { 0x012D, 22, 15 }, { 0x012E, 28, 32 }, { 0x012F, 22, 15 }, { 0x0130, 28, 32 }, // U+0168
+    { 0x0131, 22, 15 }, { 0x0132, 28, 32 }, { 0x0133, 22, 15 }, { 0x0134, 28, 32 }, { 0x0135, 24, 17 }, { 0x0136, 37, 34 }, { 0x0137, 26, 19 }, { 0x0138, 38, 36 }, // U+0170
+    { 0x0139, 26, 19 }, { 0x013A, 0, 20 }, { 0x013B, 39, 37 }, { 0x013C, 0, 20 }, { 0x013D, 39, 37 }, { 0x013E, 0, 20 }, { 0x013F, 39, 37 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 50, 42 }, { 0x0212, 50, 42 }, { 0x0213, 51, 43 }, { 0x0214, 52, 42 }, { 0x0215, 53, 44 }, { 0x0216, 54, 45 }, { 0x0217, 55, 42 }, { 0x0218, 55, 42 }, // U+0400
+    { 0x0219, 56, 46 }, { 0x021A, 57, 47 }, { 0x021B, 57, 42 }, { 0x021C, 58, 43 }, { 0x021D, 59, 42 }, { 0x021E, 55, 42 }, { 0x021F, 60, 48 }, { 0x0220, 55, 42 }, // U+0408
+    { 0x0221, 61, 49 }, { 0x0222, 62, 42 }, { 0x0223, 63, 42 }, { 0x0224, 52, 42 }, { 0x0225, 64, 50 }, { 0x0226, 50, 42 }, { 0x0227, 59, 51 }, { 0x0228, 63, 52 }, // U+0410
+    { 0x0229, 55, 42 }, { 0x022A, 55, 42 }, { 0x022B, 59, 42 }, { 0x022C, 55, 47 }, { 0x022D, 55, 42 }, { 0x022E, 55, 42 }, { 0x022F, 65, 44 }, { 0x0230, 55, 42 }, // U+0418
+    { 0x0231, 66, 42 }, { 0x0232, 53, 44 }, { 0x0233, 52, 43 }, { 0x0234, 60, 48 }, { 0x0235, 67, 53 }, { 0x0236, 68, 54 }, { 0x0237, 64, 42 }, { 0x0238, 55, 55 }, // U+0420
+    { 0x0239, 55, 42 }, { 0x023A, 64, 42 }, { 0x023B, 57, 43 }, { 0x023C, 55, 42 }, { 0x023D, 57, 42 }, { 0x023E, 65, 52 }, { 0x023F, 65, 42 }, { 0x0240, 55, 56 }, // U+0428
+    { 0x0241, 69, 57 }, { 0x0242, 70, 58 }, { 0x0243, 71, 57 }, { 0x0244, 72, 59 }, { 0x0245, 73, 60 }, { 0x0246, 74, 57 }, { 0x0247, 75, 61 }, { 0x0248, 71, 62 }, // U+0430
+    { 0x0249, 69, 63 }, { 0x024A, 69, 63 }, { 0x024B, 76, 64 }, { 0x024C, 69, 65 }, { 0x024D, 69, 65 }, { 0x024E, 69, 64 }, { 0x024F, 77, 57 }, { 0x0250, 78, 64 }, // U+0438
+    { 0x0251, 77, 66 }, { 0x0252, 79, 57 }, { 0x0253, 78, 64 }, { 0x0254, 80, 67 }, { 0x0255, 77, 57 }, { 0x0256, 76, 68 }, { 0x0257, 81, 63 }, { 0x0258, 69, 69 }, // U+0440
+    { 0x0259, 69, 63 }, { 0x025A, 81, 63 }, { 0x025B, 82, 70 }, { 0x025C, 69, 63 }, { 0x025D, 82, 63 }, { 0x025E, 77, 61 }, { 0x025F, 77, 64 }, { 0x0260, 69, 71 }, // U+0448
+    { 0x0261, 74, 57 }, { 0x0262, 74, 57 }, { 0x0263, 83, 72 }, { 0x0264, 72, 59 }, { 0x0265, 79, 57 }, { 0x0266, 84, 73 }, { 0x0267, 69, 74 }, { 0x0268, 85, 75 }, // U+0450
+    { 0x0269, 86, 76 }, { 0x026A, 82, 65 }, { 0x026B, 82, 64 }, { 0x026C, 78, 72 }, { 0x026D, 76, 64 }, { 0x026E, 69, 63 }, { 0x026F, 80, 67 }, { 0x0270, 69, 63 }, // U+0458
+};
+
 static const EpdFontData notoserif_12_bolditalic = {
     notoserif_12_bolditalicBitmaps,
     notoserif_12_bolditalicGlyphs,
     notoserif_12_bolditalicIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notoserif_12_bolditalicGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_12_bolditalicGlyphToGroup,
     notoserif_12_bolditalicKernLeftClasses,
     notoserif_12_bolditalicKernRightClasses,
     notoserif_12_bolditalicKernMatrix,
@@ -4417,4 +4524,8 @@ static const EpdFontData notoserif_12_bolditalic = {
     90,
     notoserif_12_bolditalicLigaturePairs,
     5,
+    notoserif_12_bolditalicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,396 +3,420 @@
  * name: notoserif_12_italic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_12_italic 12 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_12_italic 12 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_12_italicBitmaps[30784] = {
-    0xAD, 0x59, 0x4D, 0x6C, 0x1C, 0x67, 0x19, 0x7E, 0x67, 0xBE, 0x24, 0x43, 0x3B, 0xB1, 0x27, 0x07,
-    0x72, 0xC0, 0xB1, 0x33, 0x39, 0x06, 0xEA, 0x78, 0x7A, 0xB0, 0x60, 0x25, 0x76, 0x76, 0xBF, 0xB6,
-    0x42, 0x3D, 0x36, 0x87, 0x9A, 0x22, 0x71, 0x68, 0x0F, 0x1C, 0xDA, 0x72, 0x88, 0x11, 0x39, 0x18,
-    0x69, 0xED, 0x1D, 0xF5, 0xC2, 0x09, 0xE1, 0x56, 0xEA, 0x99, 0x1C, 0x7A, 0xA8, 0x7A, 0x00, 0x1F,
-    0x8C, 0x64, 0xB5, 0xEB, 0xEE, 0xD0, 0x1C, 0x22, 0x21, 0x21, 0xA6, 0x54, 0x85, 0x43, 0x8B, 0x34,
-    0x84, 0xA6, 0x48, 0x88, 0xAA, 0xA3, 0x76, 0x2A, 0x8D, 0x93, 0xB5, 0x87, 0xE7, 0x79, 0x67, 0xD6,
-    0x76, 0xD2, 0x44, 0x14, 0xC4, 0x7A, 0xBF, 0x6F, 0xFF, 0xE6, 0x7B, 0x7F, 0x9F, 0xF7, 0x6F, 0x2C,
-    0x95, 0x54, 0x4E, 0xE9, 0x16, 0x6E, 0x6E, 0x32, 0x93, 0x9A, 0xD4, 0x4B, 0x3C, 0xEB, 0x8B, 0x2F,
-    0xB3, 0xC2, 0x47, 0x4F, 0x36, 0x64, 0x1D, 0xAF, 0xDD, 0x50, 0x06, 0x4B, 0xB2, 0x76, 0x49, 0xB6,
-    0xBB, 0xB2, 0xD5, 0x91, 0x6B, 0xCB, 0xFA, 0xAB, 0xE7, 0xA4, 0x12, 0x98, 0x44, 0x66, 0x8C, 0x95,
-    0x79, 0x4F, 0x64, 0xD1, 0x97, 0xA0, 0xAE, 0x8B, 0x87, 0xDF, 0xFC, 0xF5, 0xA6, 0x6C, 0x2D, 0x8A,
-    0xE4, 0x1D, 0x91, 0x6C, 0x59, 0x9C, 0x74, 0x55, 0x1E, 0xF9, 0xE7, 0x6D, 0x3B, 0xAC, 0x6B, 0xCB,
-    0x23, 0xBE, 0x9B, 0xCA, 0xEC, 0xB1, 0x63, 0x22, 0x8F, 0x62, 0xAD, 0x8A, 0x84, 0x07, 0x22, 0xA3,
-    0x0F, 0x52, 0xA7, 0xB8, 0x9E, 0xB9, 0x7F, 0xBB, 0x9E, 0xBA, 0x37, 0x13, 0x71, 0x3F, 0x4B, 0x44,
-    0x6A, 0x2B, 0x32, 0x4C, 0x45, 0xFC, 0x0A, 0x6B, 0x5F, 0x64, 0xA6, 0x2F, 0x9D, 0xD3, 0x90, 0xE8,
-    0x74, 0x24, 0xEB, 0xF3, 0xB1, 0x44, 0x2F, 0x54, 0xE2, 0xD5, 0x9B, 0x87, 0x64, 0xE4, 0x39, 0x69,
-    0x1F, 0xCE, 0x01, 0x98, 0x8B, 0xF7, 0xF3, 0x04, 0xDC, 0x02, 0x93, 0x06, 0x22, 0x97, 0x4C, 0x0A,
-    0xC1, 0xBA, 0x26, 0xBD, 0xAA, 0x7B, 0x2E, 0xB2, 0xE6, 0xBD, 0x03, 0xD2, 0x6B, 0xFE, 0x93, 0x8F,
-    0x57, 0xD2, 0x09, 0x66, 0x83, 0xF3, 0xD2, 0xC5, 0x23, 0x10, 0x3F, 0xDF, 0x5E, 0xC3, 0x01, 0x27,
-    0x2F, 0x02, 0x2B, 0x26, 0x2D, 0xF0, 0xDE, 0x77, 0xB8, 0x2F, 0x38, 0xF9, 0x12, 0x0E, 0x4B, 0xDE,
-    0x15, 0x29, 0xA4, 0xD8, 0x16, 0x27, 0x93, 0x7E, 0x26, 0xC7, 0x1F, 0x6E, 0x0D, 0xA9, 0x83, 0x97,
-    0x0A, 0x1A, 0xB0, 0x14, 0x89, 0x0F, 0xB7, 0x9E, 0x0B, 0x8E, 0x51, 0xC8, 0x5F, 0xAB, 0x53, 0xAF,
-    0xC9, 0x30, 0x0B, 0x3E, 0x32, 0x7F, 0x07, 0xD1, 0xC0, 0x4E, 0xE6, 0x25, 0x92, 0x8D, 0x2E, 0x2E,
-    0x8B, 0xB6, 0xB1, 0x05, 0x39, 0x36, 0x93, 0xE3, 0x3B, 0xBF, 0x94, 0x20, 0x5B, 0xDF, 0x05, 0xCD,
-    0xBC, 0xE5, 0x32, 0x18, 0xEC, 0x6C, 0x6D, 0x81, 0x0E, 0xAD, 0x6F, 0x65, 0x20, 0x4E, 0x21, 0x26,
-    0x13, 0x5F, 0x3F, 0x45, 0x64, 0x49, 0x97, 0x8D, 0xF4, 0x59, 0xE9, 0xB3, 0x9C, 0x3E, 0x77, 0x28,
-    0xB7, 0x5C, 0x02, 0x77, 0xC8, 0x98, 0x28, 0xB1, 0xAF, 0x43, 0x21, 0x68, 0x46, 0x15, 0xC5, 0xCD,
-    0x04, 0xF2, 0x81, 0x1C, 0x9E, 0xAE, 0x3E, 0x4D, 0x41, 0x21, 0x40, 0xDD, 0x03, 0xF5, 0x29, 0x83,
-    0x98, 0x44, 0x71, 0xA1, 0x9F, 0xF0, 0x6D, 0xFB, 0x08, 0x64, 0x26, 0x90, 0xF0, 0x17, 0x27, 0xDC,
-    0x4F, 0x76, 0x9D, 0xF1, 0x5E, 0xBF, 0xB6, 0xDF, 0xFC, 0x76, 0x2E, 0xCB, 0x3B, 0xB2, 0x7D, 0xA6,
-    0x75, 0x47, 0xE7, 0xE8, 0xF9, 0xE2, 0xDB, 0xAF, 0x0F, 0xEB, 0xFD, 0xE3, 0xDF, 0x50, 0x0C, 0x09,
-    0x6D, 0x94, 0x06, 0xA9, 0x49, 0x3C, 0xE8, 0x74, 0x59, 0x86, 0x93, 0xF1, 0x84, 0x08, 0x1C, 0x92,
-    0x87, 0x67, 0x55, 0x66, 0x99, 0xC1, 0x82, 0xFF, 0x84, 0xF8, 0xDB, 0xC2, 0x82, 0x15, 0x00, 0x26,
-    0x81, 0x7B, 0x85, 0x40, 0x22, 0x68, 0xE7, 0x1B, 0x5E, 0x0A, 0x04, 0x38, 0x00, 0xCE, 0xA1, 0x6A,
-    0x02, 0xAC, 0x01, 0xD5, 0x47, 0x14, 0x3A, 0xC7, 0xFD, 0x15, 0x41, 0xEB, 0x2F, 0x46, 0xB8, 0x6E,
-    0x09, 0x2A, 0x86, 0x12, 0x82, 0x57, 0x0F, 0xAB, 0x8B, 0x35, 0xC0, 0xA7, 0x11, 0x56, 0x05, 0xCD,
-    0x2B, 0x59, 0x82, 0x15, 0xE9, 0xC8, 0x2E, 0xD6, 0x0E, 0xFE, 0x0A, 0x19, 0xC0, 0x10, 0x3D, 0x58,
-    0xC2, 0x07, 0x76, 0xC5, 0x92, 0xD8, 0xB6, 0x78, 0x85, 0x6C, 0x14, 0xE6, 0xF3, 0xDC, 0x7D, 0x62,
-    0x6A, 0x3B, 0x3A, 0x27, 0xA1, 0xF9, 0x42, 0xA1, 0x05, 0x1B, 0x2F, 0x41, 0x31, 0x38, 0x6F, 0x5F,
-    0xFA, 0x75, 0xA1, 0x52, 0x9C, 0x03, 0x89, 0xDD, 0x20, 0x75, 0x4A, 0x93, 0x3B, 0x39, 0xCC, 0x9E,
-    0x61, 0xF1, 0x3C, 0x0D, 0xAD, 0xDA, 0x77, 0x1B, 0xAD, 0xA9, 0x4E, 0xD0, 0xAA, 0x80, 0x2B, 0xBC,
-    0xC4, 0xC0, 0x85, 0x3E, 0xC8, 0xD4, 0x32, 0xAC, 0x0F, 0x1A, 0x8D, 0xFC, 0x03, 0x2B, 0x1B, 0x7E,
-    0x26, 0x15, 0x3C, 0x58, 0xC0, 0x91, 0xD7, 0xF0, 0xDA, 0xD0, 0xC2, 0xE1, 0x0D, 0xD8, 0x1A, 0x1F,
-    0x4F, 0xED, 0x8B, 0x8A, 0x42, 0xD1, 0xDA, 0xB5, 0x08, 0x27, 0xC4, 0xD2, 0x97, 0xFE, 0x63, 0x13,
-    0xF1, 0xEB, 0x29, 0xA8, 0x79, 0x0E, 0xDE, 0x97, 0x3E, 0xD6, 0x5B, 0x80, 0xC9, 0x1F, 0x13, 0xF1,
-    0x9E, 0xB2, 0xB2, 0x00, 0x65, 0x3A, 0x58, 0x79, 0x04, 0x91, 0x7A, 0x90, 0x20, 0x96, 0x4B, 0x2B,
-    0xEB, 0x97, 0x21, 0x47, 0xA1, 0xB0, 0x23, 0xE2, 0xB8, 0x0C, 0xDE, 0x8F, 0x11, 0xC3, 0xFD, 0x3A,
-    0x85, 0x80, 0xA9, 0x5C, 0x83, 0xCB, 0x32, 0x27, 0x01, 0x7C, 0x15, 0x84, 0xF4, 0x8C, 0x79, 0xC3,
-    0x8A, 0xFF, 0x29, 0xAF, 0xA7, 0xCF, 0x63, 0xCD, 0x3C, 0xCD, 0x8A, 0xE5, 0x02, 0xAC, 0x54, 0x82,
-    0xDE, 0xAE, 0x87, 0x70, 0xA8, 0xED, 0x91, 0xD7, 0x68, 0xF2, 0xF5, 0x20, 0x71, 0x0A, 0x2F, 0x35,
-    0x19, 0xB2, 0x16, 0xCD, 0x62, 0x1B, 0x8D, 0x7A, 0x51, 0x22, 0xFD, 0x8F, 0x4B, 0x68, 0x3A, 0xC2,
-    0x69, 0xFE, 0xC5, 0x58, 0x5D, 0x7D, 0xD7, 0x85, 0xDF, 0xE8, 0xBF, 0xF0, 0xC9, 0x1C, 0x69, 0xA3,
-    0xA1, 0x17, 0x21, 0x35, 0xD1, 0x7E, 0xCB, 0xB8, 0xEE, 0x39, 0x85, 0x5F, 0xC9, 0xD0, 0x6F, 0x6C,
-    0x3D, 0x35, 0x3F, 0xC5, 0x1A, 0x34, 0x2A, 0xB9, 0xC7, 0x7E, 0x0A, 0x8F, 0xFD, 0xD4, 0x10, 0x83,
-    0x5D, 0xF7, 0xC2, 0x04, 0x19, 0x15, 0x72, 0x35, 0x59, 0x15, 0xF2, 0xA5, 0x06, 0x71, 0xEE, 0xEC,
-    0xAF, 0x21, 0x95, 0x65, 0xE2, 0xDC, 0x41, 0x54, 0xDB, 0x7D, 0xA1, 0xAD, 0x89, 0xAE, 0x1D, 0x30,
-    0xD8, 0xC1, 0xEB, 0x00, 0x3A, 0xF7, 0xE5, 0xB8, 0xED, 0x19, 0x17, 0xB0, 0xDF, 0xEE, 0x15, 0x84,
-    0xA3, 0x9F, 0x78, 0xA9, 0x87, 0x10, 0xC1, 0xB2, 0x5C, 0x7E, 0xB3, 0x92, 0x28, 0xF1, 0x6E, 0xD5,
-    0xD6, 0xA9, 0x9F, 0xC5, 0xC5, 0xFD, 0x56, 0x9A, 0x91, 0x0A, 0xDA, 0x81, 0xA0, 0x31, 0x84, 0x0C,
-    0xF7, 0x5B, 0x5A, 0x97, 0xDD, 0xC2, 0x14, 0x94, 0xFE, 0xF8, 0x03, 0xFE, 0x56, 0x5B, 0x23, 0x0A,
-    0x47, 0x60, 0xBE, 0x73, 0xF7, 0xAF, 0x41, 0x1A, 0x64, 0x5E, 0xE6, 0xA6, 0xC6, 0x5E, 0x92, 0x33,
-    0xCD, 0x57, 0x0F, 0x91, 0xBE, 0x9F, 0xC3, 0xBC, 0xF0, 0x49, 0x5F, 0x1D, 0x85, 0x4F, 0xB2, 0x8B,
-    0x97, 0x4C, 0x59, 0x2F, 0x34, 0xD7, 0x21, 0xCA, 0xCF, 0xAE, 0x3C, 0x7D, 0x48, 0xE9, 0xF0, 0xE3,
-    0x73, 0xF7, 0x1C, 0x71, 0x26, 0x4A, 0x30, 0x6B, 0x08, 0xF6, 0x9A, 0xE0, 0x9D, 0xE2, 0xB8, 0xE7,
-    0x67, 0x23, 0xB7, 0xD8, 0x76, 0x8A, 0x0B, 0x4D, 0x5A, 0xF2, 0x32, 0x80, 0x14, 0x07, 0xF1, 0xEA,
-    0x6B, 0xC8, 0xCF, 0x4C, 0x2F, 0x86, 0xDE, 0x6F, 0x1F, 0xF9, 0xE1, 0x91, 0x3D, 0x26, 0x8E, 0xBD,
-    0x1F, 0x67, 0x0A, 0x89, 0x1D, 0xF5, 0xDB, 0x42, 0x13, 0x03, 0x88, 0x99, 0xFE, 0x1D, 0xCF, 0x06,
-    0x4E, 0xB1, 0x64, 0x92, 0xF3, 0x26, 0x8D, 0x4D, 0xD2, 0xF5, 0x93, 0x2E, 0xF6, 0xC0, 0x62, 0x07,
-    0xA8, 0x07, 0x26, 0x59, 0x83, 0x5B, 0x3C, 0x8B, 0xBD, 0xF4, 0x05, 0x95, 0xA0, 0x9C, 0x91, 0xAE,
-    0xFF, 0x97, 0x75, 0xE0, 0xC7, 0xDD, 0x47, 0x76, 0xBE, 0xD4, 0x66, 0x3D, 0x15, 0x32, 0x15, 0xC7,
-    0x8A, 0x5B, 0xCA, 0x39, 0x16, 0xAA, 0x9A, 0xD0, 0x77, 0x5E, 0x68, 0x84, 0x20, 0xA4, 0x1D, 0x6E,
-    0x0C, 0x02, 0xF1, 0xE9, 0x95, 0x05, 0x0A, 0xD8, 0xE5, 0xB6, 0xCA, 0x80, 0xCE, 0x63, 0xE6, 0xB0,
-    0x1E, 0xE3, 0xA0, 0x47, 0x82, 0x30, 0x67, 0x08, 0x24, 0x22, 0xBA, 0x43, 0x46, 0x3B, 0x10, 0x9D,
-    0x63, 0x73, 0x99, 0x40, 0x60, 0xA0, 0x30, 0x1D, 0x4E, 0x9C, 0xBA, 0x44, 0x3C, 0x5D, 0xC3, 0x75,
-    0x7F, 0x3E, 0x60, 0xD0, 0x46, 0x96, 0x59, 0x2B, 0x61, 0xDA, 0x4A, 0xA0, 0x6A, 0xC8, 0x24, 0xCD,
-    0x0C, 0xE3, 0x80, 0x5B, 0x9F, 0x40, 0x5A, 0xFF, 0x7E, 0x49, 0xFB, 0x6A, 0x3D, 0xD0, 0xE4, 0xDD,
-    0xA3, 0x60, 0xEB, 0x4C, 0xF3, 0x23, 0x58, 0xD4, 0x41, 0xF9, 0xFC, 0xE2, 0x87, 0xF9, 0x51, 0xF2,
-    0x60, 0xAD, 0x91, 0xE8, 0x95, 0x09, 0xB0, 0x30, 0x42, 0xDE, 0x18, 0x40, 0xBF, 0x0B, 0xCC, 0x0F,
-    0x51, 0x8B, 0x2F, 0x76, 0x04, 0xBB, 0x2D, 0xC6, 0xA6, 0x6B, 0xD0, 0xC6, 0x6B, 0x64, 0x8D, 0x0D,
-    0x6E, 0x5D, 0x11, 0x47, 0xCD, 0x20, 0x8C, 0xFC, 0x8F, 0x20, 0xE9, 0xFB, 0x63, 0x4A, 0xAA, 0x25,
-    0x04, 0x59, 0x2D, 0xA4, 0x1F, 0x23, 0xF2, 0x8F, 0x68, 0x9D, 0x1E, 0xB7, 0x98, 0xDB, 0x80, 0x3F,
-    0x8C, 0x58, 0x76, 0x2A, 0x16, 0x9E, 0x8A, 0xA6, 0x45, 0xA4, 0x20, 0xC6, 0xC1, 0x18, 0x92, 0x4E,
-    0x20, 0xE9, 0xB3, 0x53, 0x49, 0xC7, 0x35, 0xCA, 0x6C, 0xF8, 0xFE, 0xB3, 0x48, 0xAC, 0x89, 0xA1,
-    0x0D, 0x0C, 0x83, 0xD1, 0x6D, 0xE4, 0x6C, 0x36, 0x45, 0x75, 0x63, 0x83, 0x15, 0xDB, 0x08, 0xAA,
-    0x99, 0xA9, 0xD9, 0x4A, 0x39, 0x41, 0x19, 0x16, 0xC9, 0xB4, 0x03, 0xCA, 0x2B, 0x25, 0x28, 0x33,
-    0x79, 0x7D, 0x55, 0xCA, 0xBD, 0x15, 0x75, 0x78, 0x7A, 0x1F, 0xCA, 0x42, 0xCA, 0x42, 0xCA, 0x00,
-    0x61, 0xA9, 0xE0, 0xB7, 0x47, 0xED, 0x01, 0x2E, 0x8A, 0x5E, 0xAE, 0x99, 0xED, 0xFA, 0x16, 0xCA,
-    0x86, 0xD4, 0xF3, 0x84, 0xE6, 0xE0, 0x63, 0xD4, 0x69, 0x66, 0x10, 0x3E, 0xB9, 0xC2, 0x14, 0x51,
-    0xDB, 0x11, 0x11, 0x46, 0x7F, 0x35, 0x56, 0xEA, 0x69, 0x7B, 0x60, 0x81, 0xE7, 0xE0, 0xA3, 0x73,
-    0x00, 0x60, 0x7D, 0x30, 0xA5, 0x3F, 0xDE, 0x37, 0x50, 0x22, 0xCC, 0x65, 0x6C, 0x49, 0x32, 0x96,
-    0xA6, 0x4D, 0x20, 0x9E, 0x46, 0x4A, 0xBF, 0xD2, 0x9D, 0xED, 0x88, 0x0A, 0xD9, 0x24, 0xEC, 0xF5,
-    0x95, 0x67, 0x0A, 0x5E, 0xC0, 0xA2, 0x53, 0x69, 0x98, 0x54, 0xAC, 0x5C, 0xB8, 0x8C, 0xF0, 0x2E,
-    0x58, 0x00, 0xC0, 0x15, 0xF4, 0x50, 0xDD, 0x90, 0x5D, 0x87, 0xB5, 0xA1, 0x16, 0xE3, 0x7D, 0x32,
-    0x7A, 0x40, 0x6D, 0x23, 0xBB, 0x49, 0xDB, 0x81, 0xB4, 0xB1, 0x5B, 0xE0, 0x20, 0xA0, 0x0E, 0x04,
-    0xCB, 0xD0, 0x4E, 0x33, 0x7C, 0x83, 0x9E, 0x91, 0x1C, 0x56, 0x0D, 0x4A, 0xC5, 0x45, 0xEB, 0x4D,
-    0x8B, 0x20, 0x65, 0xD1, 0x14, 0x9F, 0xB6, 0xC5, 0xCA, 0x36, 0xA9, 0x37, 0x3A, 0x4A, 0x78, 0xBC,
-    0x7C, 0x9C, 0xA8, 0x05, 0x50, 0x1B, 0xC2, 0x1C, 0x31, 0x07, 0xFF, 0x11, 0x73, 0x01, 0xAF, 0xED,
-    0xF2, 0x62, 0xF6, 0x5F, 0x1E, 0xAE, 0xE9, 0x9D, 0xE7, 0x39, 0x54, 0x42, 0xD9, 0xA8, 0x79, 0x82,
-    0x3D, 0xD9, 0x84, 0xB4, 0x2B, 0xE4, 0x15, 0x29, 0x0D, 0x9B, 0x20, 0xED, 0x81, 0x18, 0x1D, 0x85,
-    0xEC, 0x53, 0x6E, 0xA8, 0x0D, 0x7D, 0xA9, 0xF0, 0x97, 0x24, 0x88, 0xE4, 0xFE, 0xCA, 0x54, 0x70,
-    0x6B, 0x29, 0xF3, 0x50, 0xA6, 0x03, 0x6A, 0x57, 0x81, 0xB1, 0x42, 0x21, 0x36, 0x86, 0xA8, 0x08,
-    0x32, 0x94, 0x61, 0x17, 0x7E, 0x0B, 0x4A, 0x31, 0x30, 0xD4, 0x0C, 0x6C, 0x8D, 0x3C, 0x35, 0x5F,
-    0xF1, 0x29, 0x8B, 0x3B, 0xD2, 0x81, 0x2D, 0x16, 0x47, 0xF2, 0x13, 0x5C, 0xDC, 0x19, 0xC8, 0x4D,
-    0xBC, 0x2C, 0x0F, 0xDC, 0x77, 0xC0, 0x7E, 0x35, 0x36, 0x4F, 0x40, 0xCC, 0xAD, 0xD8, 0x67, 0x15,
-    0xCA, 0x7B, 0xF3, 0xB4, 0x4E, 0x1E, 0x75, 0x68, 0xA0, 0x2C, 0x5A, 0x85, 0x74, 0x4E, 0x1A, 0xE6,
-    0x10, 0xD0, 0x45, 0xB9, 0x08, 0x69, 0xBC, 0xC0, 0xF6, 0x2D, 0x7A, 0xAA, 0xC0, 0x55, 0x7C, 0xA7,
-    0x2E, 0x62, 0x22, 0x44, 0xBE, 0x05, 0x6F, 0x06, 0x00, 0x25, 0x40, 0x3B, 0xB1, 0x50, 0xB1, 0xB3,
-    0x02, 0x47, 0xE4, 0xDF, 0xC5, 0x1E, 0x7B, 0x8D, 0x4E, 0xC4, 0x26, 0x6A, 0x39, 0xB4, 0x64, 0x1A,
-    0xA4, 0xE4, 0xE9, 0xBD, 0x4B, 0x5E, 0xE6, 0x33, 0xEE, 0xEE, 0xE7, 0xB0, 0x43, 0x26, 0x77, 0x2C,
-    0x9B, 0xD1, 0x31, 0xD9, 0x31, 0x41, 0x78, 0xBA, 0x0F, 0x27, 0x72, 0x7E, 0x8A, 0xF8, 0x53, 0x0C,
-    0xC1, 0x68, 0xA5, 0x6A, 0x92, 0xCF, 0x14, 0xF1, 0x48, 0x08, 0x8C, 0xB0, 0x88, 0x4E, 0xED, 0xD3,
-    0xA6, 0x1B, 0xDC, 0x76, 0xD9, 0x09, 0x2A, 0x50, 0x99, 0xBF, 0xB8, 0xAD, 0xD3, 0xA4, 0x13, 0xD8,
-    0x56, 0xB3, 0x06, 0xB2, 0x60, 0x90, 0x0D, 0x01, 0x10, 0x82, 0x08, 0xE6, 0xD5, 0x4C, 0xB0, 0xC9,
-    0x6C, 0x38, 0xE1, 0x71, 0x26, 0x51, 0xF4, 0x70, 0xE0, 0xA0, 0x89, 0xB0, 0xD9, 0x44, 0xEB, 0x2A,
-    0x28, 0x80, 0xF8, 0x3A, 0xC3, 0x91, 0xFD, 0x88, 0xF6, 0x1A, 0xF7, 0x8D, 0xD7, 0xE2, 0xEE, 0x78,
-    0xFD, 0x3F, 0x4B, 0xEF, 0x1F, 0x49, 0x1F, 0x59, 0xED, 0x7B, 0xDB, 0x1E, 0x4C, 0xB1, 0x2D, 0xE6,
-    0x36, 0x3F, 0xBF, 0x68, 0xA5, 0x4D, 0xF2, 0xEF, 0xEF, 0x4A, 0xCB, 0xC6, 0x6A, 0x90, 0x69, 0x92,
-    0x0F, 0x0E, 0xD5, 0x62, 0xB0, 0xB1, 0xC2, 0xA8, 0xBC, 0x23, 0xE2, 0x71, 0x42, 0x5A, 0x15, 0x69,
-    0x95, 0x1E, 0x43, 0x17, 0x11, 0xC4, 0xAA, 0x0F, 0xB5, 0x80, 0x65, 0x5C, 0x36, 0x6C, 0xB4, 0x3A,
-    0x87, 0x03, 0xBB, 0x7E, 0x86, 0xDF, 0x0B, 0x6D, 0x38, 0xB3, 0x26, 0xD6, 0x5C, 0xCA, 0xC5, 0xF4,
-    0x3A, 0x64, 0xD7, 0x07, 0x9D, 0x9D, 0xFD, 0x36, 0xED, 0x47, 0x80, 0x45, 0x68, 0x4B, 0x6D, 0x88,
-    0x7B, 0xAA, 0x9B, 0x5F, 0x37, 0x9D, 0x04, 0xA6, 0xBE, 0x5A, 0xC2, 0x67, 0xBE, 0xB8, 0x22, 0x8B,
-    0x26, 0x9F, 0x95, 0x8E, 0xC9, 0x67, 0xE4, 0x82, 0xC9, 0xBE, 0xD6, 0x44, 0xAD, 0x86, 0x6D, 0xAB,
-    0xE0, 0xA1, 0xBE, 0xE1, 0xDD, 0x99, 0x54, 0x07, 0x89, 0x81, 0xB4, 0x91, 0xA3, 0x2C, 0x23, 0xE6,
-    0xD5, 0x61, 0xED, 0xD4, 0xF9, 0x39, 0xE4, 0x65, 0x34, 0x3C, 0xC0, 0xA9, 0xCF, 0x0D, 0x94, 0x3A,
-    0xDC, 0x96, 0x49, 0x6E, 0xB5, 0x29, 0x93, 0x11, 0x9B, 0xFD, 0x1E, 0xFB, 0xE1, 0x98, 0x80, 0x1C,
-    0x10, 0x8F, 0x03, 0xC2, 0x71, 0xC4, 0xE1, 0x60, 0xC4, 0x01, 0x62, 0x9D, 0xD5, 0x3A, 0x7A, 0x15,
-    0xF4, 0xBD, 0x7A, 0xDA, 0x00, 0x8D, 0x27, 0xA6, 0x4E, 0xA3, 0x0C, 0xB0, 0x00, 0xBD, 0x35, 0x6E,
-    0x5B, 0xAC, 0x36, 0x9C, 0xA6, 0x0C, 0xBB, 0x76, 0x1C, 0xF3, 0xD2, 0x59, 0xAA, 0xB1, 0xC8, 0x2C,
-    0xD4, 0xE1, 0xC6, 0x0E, 0x3C, 0xA7, 0xB1, 0x6E, 0xB2, 0x81, 0xFD, 0x07, 0x94, 0x71, 0xEE, 0x50,
-    0xE6, 0x23, 0x34, 0x15, 0x4A, 0x59, 0x7E, 0x24, 0x75, 0x81, 0x18, 0xC3, 0xE4, 0x60, 0x41, 0xB3,
-    0x42, 0xAB, 0x82, 0x6C, 0x34, 0xA1, 0x02, 0xA9, 0x37, 0x81, 0xF4, 0x7E, 0x3A, 0x3B, 0x02, 0x3F,
-    0x3F, 0x3D, 0x3D, 0x80, 0xDC, 0x7E, 0x7A, 0x71, 0x00, 0x79, 0xBD, 0xF4, 0x51, 0xF4, 0x1E, 0x78,
-    0x41, 0x6C, 0x93, 0x6F, 0x16, 0x83, 0xBD, 0xF9, 0x53, 0x1A, 0x53, 0x80, 0xF7, 0x6C, 0x4C, 0x11,
-    0x3E, 0x90, 0x1E, 0x85, 0xF8, 0x44, 0x7A, 0xCC, 0x8D, 0x13, 0x89, 0x38, 0xDF, 0x94, 0x4C, 0x4F,
-    0x0D, 0xC6, 0xE8, 0xAF, 0x7D, 0xAF, 0x66, 0x97, 0xEF, 0x42, 0x20, 0x34, 0x7C, 0x19, 0x7F, 0xE1,
-    0x10, 0xE5, 0x54, 0xDA, 0x9A, 0x4D, 0x74, 0xFC, 0x59, 0x57, 0x33, 0xF4, 0x93, 0x43, 0x57, 0xB4,
-    0xEF, 0xC7, 0xF4, 0x97, 0x7B, 0x83, 0x2D, 0xA8, 0xCF, 0xB9, 0x41, 0x16, 0x34, 0x2C, 0xAE, 0x52,
-    0x3B, 0x34, 0xC5, 0x50, 0x14, 0x5D, 0x1A, 0x20, 0xD2, 0x9F, 0x04, 0xF0, 0x51, 0xFF, 0xC0, 0xD4,
-    0x09, 0x3A, 0x22, 0xED, 0xC8, 0xAE, 0x32, 0x3C, 0x88, 0x37, 0x57, 0xE1, 0x47, 0x56, 0x6C, 0xCF,
-    0x06, 0xE4, 0x17, 0x73, 0x62, 0xE3, 0x0C, 0xD1, 0x20, 0x20, 0x7A, 0x00, 0x02, 0xD4, 0xF9, 0xA1,
-    0x36, 0xC0, 0x5A, 0x87, 0xF7, 0x56, 0x86, 0xEC, 0x81, 0xDE, 0x86, 0x4B, 0x61, 0x44, 0xC7, 0xAA,
-    0x44, 0x1A, 0x29, 0x1A, 0x3D, 0x6C, 0x44, 0x1C, 0x9A, 0xFD, 0xE8, 0x7B, 0x82, 0x75, 0xFA, 0xFD,
-    0x09, 0x7E, 0xDF, 0xE1, 0xF7, 0xCB, 0xD2, 0x5F, 0x59, 0x29, 0xDA, 0x0A, 0x3F, 0x2C, 0xDB, 0x21,
-    0xF9, 0x58, 0x71, 0x6A, 0x26, 0xDD, 0x7B, 0x06, 0x36, 0xAD, 0x1C, 0xF7, 0x16, 0xB5, 0xB1, 0x1A,
-    0x6E, 0x99, 0x8F, 0x0E, 0x1E, 0x17, 0x17, 0xF1, 0x98, 0xE7, 0xE3, 0xF4, 0x0C, 0xB4, 0x8D, 0x26,
-    0xF7, 0x96, 0x3D, 0x34, 0xDC, 0x26, 0xFF, 0x4A, 0x94, 0x2B, 0xE9, 0x37, 0x7D, 0xD3, 0x45, 0x1D,
-    0xF7, 0xD0, 0xCE, 0x7E, 0x20, 0xEE, 0x75, 0x6B, 0x5E, 0x4A, 0x3D, 0xC9, 0x66, 0xA5, 0x98, 0x97,
-    0xAB, 0x5D, 0xE9, 0x5E, 0x95, 0x85, 0x33, 0x72, 0x02, 0x75, 0x3B, 0xF9, 0xD6, 0x1B, 0x98, 0x9C,
-    0x70, 0x3C, 0x04, 0xC2, 0x31, 0x4C, 0xCD, 0xBD, 0x8C, 0xD1, 0x63, 0x0C, 0x4E, 0xCC, 0x10, 0x4B,
-    0x20, 0xDE, 0xC3, 0x6F, 0xB1, 0x8E, 0x3D, 0xEC, 0xFF, 0x2A, 0xD1, 0xBB, 0x3D, 0x52, 0xB1, 0x93,
-    0x78, 0x08, 0xE3, 0xD1, 0xDA, 0x5E, 0x1A, 0xE5, 0x63, 0x4D, 0x74, 0xFE, 0xA4, 0x9D, 0xBE, 0xA6,
-    0x93, 0x9B, 0xD6, 0xE0, 0xE7, 0xC5, 0xFD, 0xBC, 0x06, 0xD4, 0x80, 0xDC, 0x12, 0xE1, 0x50, 0xF8,
-    0xE9, 0xF4, 0x8F, 0xE9, 0x8F, 0x19, 0x29, 0xD4, 0x6E, 0x33, 0x06, 0xA7, 0x1D, 0xE9, 0x43, 0xD1,
-    0xEF, 0x4E, 0xF3, 0xE6, 0xDC, 0xA6, 0x73, 0xBB, 0xF2, 0xD2, 0x11, 0x5A, 0xEA, 0x48, 0xCE, 0xC4,
-    0xC7, 0xBA, 0x81, 0x4A, 0xDF, 0x0C, 0x24, 0xE9, 0x3F, 0x93, 0xFA, 0x6D, 0xCF, 0xD9, 0x6F, 0x67,
-    0xD3, 0x69, 0x99, 0xC7, 0xD0, 0x32, 0xF7, 0x2B, 0xFB, 0xBF, 0x2A, 0x23, 0x73, 0x89, 0x73, 0x1B,
-    0xD9, 0x6F, 0x12, 0xD8, 0x11, 0xE6, 0xF6, 0xD8, 0x2D, 0x46, 0x61, 0x5A, 0xEF, 0xB7, 0xFC, 0xBF,
-    0xC4, 0xFC, 0x70, 0x9C, 0x94, 0x25, 0x76, 0xF4, 0x03, 0x6E, 0x3B, 0x87, 0x75, 0x61, 0xCF, 0xB6,
-    0xC9, 0xA8, 0xA9, 0x10, 0x79, 0x3B, 0x11, 0xEB, 0x00, 0x78, 0x2C, 0xC1, 0xF9, 0x87, 0x09, 0x4E,
-    0xA7, 0x02, 0x4D, 0x70, 0x4B, 0xF7, 0x49, 0x70, 0x3B, 0xD3, 0x14, 0xE1, 0x91, 0xD2, 0xB0, 0xB5,
-    0xD6, 0x37, 0xC4, 0x79, 0x7D, 0x28, 0xC1, 0x6F, 0x7E, 0x2F, 0x5D, 0x90, 0x2C, 0x41, 0x1B, 0x63,
-    0xAD, 0x83, 0x91, 0xCF, 0xE1, 0xFD, 0xA7, 0x72, 0x49, 0x21, 0x2B, 0xBF, 0x6D, 0xEF, 0x77, 0xDC,
-    0x6A, 0x9A, 0xC8, 0x53, 0x9F, 0xD6, 0x18, 0x44, 0x42, 0xBB, 0x0D, 0xBE, 0xE8, 0xCD, 0x20, 0xEE,
-    0x79, 0xD9, 0xF8, 0xDE, 0x0E, 0xF2, 0xF2, 0xA6, 0x84, 0x65, 0x53, 0xCD, 0xB4, 0x8F, 0x6A, 0x7B,
-    0x28, 0x93, 0xBD, 0x26, 0xDE, 0x8D, 0x03, 0xF1, 0x3E, 0x44, 0x21, 0xDA, 0x42, 0x29, 0x49, 0x59,
-    0x4E, 0x96, 0x20, 0x6B, 0x0C, 0xF3, 0x76, 0x21, 0x29, 0x07, 0xE5, 0x91, 0x8E, 0xC8, 0x03, 0x58,
-    0x6A, 0x47, 0x76, 0x37, 0xAB, 0x36, 0x29, 0x90, 0xD2, 0x74, 0x74, 0x3C, 0x6B, 0xAF, 0x10, 0x03,
-    0xF4, 0xBF, 0x84, 0xAD, 0x63, 0xBA, 0x3C, 0xBF, 0x1A, 0x4D, 0xE7, 0xD6, 0xC1, 0xF4, 0x16, 0x94,
-    0x3E, 0x4E, 0x5E, 0x16, 0xFF, 0x30, 0x12, 0x32, 0x5A, 0xAE, 0x89, 0x04, 0xFF, 0x01, 0x91, 0xA0,
-    0xD3, 0x1A, 0xEC, 0x03, 0xEB, 0xDC, 0x5F, 0x8F, 0xB3, 0x97, 0xBD, 0x74, 0x98, 0x7B, 0xBC, 0xED,
-    0x90, 0x40, 0xFB, 0xC7, 0x11, 0x54, 0x48, 0x97, 0x61, 0x8F, 0x9E, 0x02, 0x98, 0x9E, 0x42, 0xDB,
-    0x0B, 0xF2, 0x5D, 0x5C, 0x3C, 0xC0, 0xE1, 0x1D, 0x05, 0x4B, 0x53, 0xF7, 0xC2, 0x12, 0x3D, 0x1D,
-    0x6F, 0x77, 0xE6, 0x1C, 0xCA, 0xBD, 0x63, 0x5A, 0x2C, 0x29, 0xBC, 0xA6, 0x5A, 0x9C, 0xB5, 0xAF,
-    0x39, 0xD7, 0x64, 0x78, 0xE3, 0x20, 0xC0, 0x38, 0xFE, 0x61, 0xB4, 0x1C, 0x43, 0x83, 0x70, 0x33,
-    0xA6, 0xCD, 0x92, 0x58, 0x0B, 0x72, 0x17, 0xA7, 0x68, 0xB1, 0x48, 0xED, 0xD5, 0xD3, 0xDB, 0x14,
-    0xB4, 0x5E, 0xC1, 0xCF, 0x0E, 0xDB, 0xF4, 0xCA, 0x21, 0xEF, 0x52, 0xF6, 0x92, 0x0A, 0xFB, 0xB8,
-    0x35, 0x06, 0x28, 0x93, 0x2E, 0xA9, 0x92, 0xE6, 0x7F, 0xE7, 0x85, 0xB9, 0x4D, 0x41, 0x58, 0x09,
-    0x35, 0x0F, 0x2C, 0x2D, 0xCF, 0x53, 0xEC, 0x38, 0x42, 0xC0, 0x9A, 0xB7, 0xA8, 0xFA, 0x3A, 0xE4,
-    0x55, 0x1A, 0x22, 0x18, 0xAD, 0x38, 0x25, 0xB7, 0x28, 0x77, 0x9E, 0x9E, 0xB3, 0xDE, 0x64, 0x9C,
-    0xC9, 0x9B, 0x2F, 0x15, 0xF2, 0x16, 0x44, 0x9B, 0xE8, 0x7D, 0x95, 0xD2, 0xA1, 0x3D, 0xF0, 0x67,
-    0xD4, 0x26, 0xBC, 0x61, 0xC1, 0x1B, 0x0D, 0xE8, 0x71, 0xB2, 0x01, 0x2A, 0x7B, 0xAE, 0x98, 0x0E,
-    0x5A, 0x44, 0x2F, 0xB5, 0xE9, 0xB5, 0x4F, 0x1C, 0xCC, 0xBD, 0x72, 0x94, 0x6D, 0x92, 0xE8, 0x3F,
-    0x04, 0x68, 0x21, 0x1B, 0x3F, 0x43, 0x71, 0xBA, 0x39, 0x75, 0xE1, 0xF1, 0x58, 0x4F, 0xB5, 0xD3,
-    0x58, 0x79, 0xEC, 0xDA, 0xF8, 0x97, 0x55, 0xF0, 0xFA, 0xC8, 0xDF, 0xBA, 0x1A, 0x68, 0x96, 0x0C,
-    0xED, 0x11, 0x2A, 0xBA, 0x53, 0x60, 0x30, 0x3F, 0xCD, 0x59, 0x17, 0xE1, 0x9D, 0x0C, 0x7C, 0xDB,
-    0xC1, 0x65, 0x3E, 0x40, 0xB5, 0xAF, 0x65, 0xCB, 0x67, 0xE9, 0x59, 0x76, 0x8A, 0x35, 0x27, 0x8F,
-    0x4D, 0x1A, 0x36, 0x8A, 0x9F, 0x11, 0xB9, 0xC6, 0xBA, 0xE5, 0xDD, 0xC2, 0xA8, 0xA3, 0xC0, 0xBB,
-    0x1F, 0xEA, 0xBA, 0xFA, 0xEC, 0xFD, 0x40, 0x01, 0x47, 0x27, 0x9D, 0xB4, 0x43, 0x24, 0x39, 0xBD,
-    0xC7, 0x92, 0x04, 0xDA, 0x53, 0x06, 0xDA, 0x73, 0xF5, 0xDA, 0x74, 0x47, 0x27, 0x4D, 0xA4, 0xEB,
-    0x4E, 0x64, 0xF0, 0x30, 0xDC, 0xFF, 0xFC, 0xEE, 0x66, 0x94, 0x37, 0x4E, 0x3A, 0x2B, 0x27, 0x65,
-    0x98, 0xB0, 0xEA, 0x87, 0x38, 0xEF, 0xC1, 0x98, 0xC6, 0x1A, 0x24, 0x70, 0x93, 0x3D, 0x8C, 0x75,
-    0x1A, 0x30, 0xBE, 0x88, 0xB5, 0x0A, 0x48, 0x67, 0xE2, 0xB0, 0x83, 0x3E, 0x68, 0x53, 0xAF, 0xF2,
-    0x15, 0x79, 0x28, 0x42, 0x74, 0x45, 0xBC, 0xD3, 0x13, 0x40, 0x09, 0x6E, 0xDF, 0x49, 0x67, 0x4D,
-    0xFA, 0xD3, 0x74, 0xDE, 0xA4, 0xEF, 0xA5, 0x17, 0xCD, 0xEF, 0xAE, 0xA7, 0x8F, 0x9A, 0xEB, 0x4F,
-    0x64, 0xB9, 0xB9, 0x61, 0xDE, 0x4D, 0xCD, 0x1F, 0xCC, 0x7B, 0x62, 0xFE, 0x65, 0xFE, 0x8A, 0x1E,
-    0x00, 0xCD, 0x80, 0x29, 0x4C, 0x31, 0xF5, 0xB7, 0x3C, 0xED, 0x4E, 0xD0, 0x01, 0xC4, 0x18, 0x78,
-    0x22, 0xB4, 0x11, 0x21, 0x1B, 0x7D, 0xFC, 0xC8, 0x09, 0x87, 0x8B, 0xEF, 0x3B, 0x58, 0x5B, 0x95,
-    0xB8, 0xF0, 0xB5, 0x8F, 0xDE, 0x79, 0xC8, 0x66, 0xE2, 0xAC, 0x75, 0x61, 0xF8, 0x34, 0x60, 0x31,
-    0xC4, 0x75, 0x26, 0xE7, 0x8D, 0xE1, 0x82, 0x1E, 0x63, 0x5E, 0xC2, 0x84, 0xC4, 0x4E, 0x93, 0x37,
-    0x53, 0x07, 0xAC, 0xED, 0xEC, 0x4C, 0xA4, 0xC7, 0x3B, 0xB2, 0x1C, 0x8C, 0x9A, 0x0A, 0xAC, 0x69,
-    0x50, 0xFF, 0x85, 0xD0, 0x9D, 0xA6, 0x51, 0x32, 0x3C, 0xCB, 0xEC, 0x1C, 0xA9, 0x7D, 0x57, 0x30,
-    0x3A, 0xA3, 0x7E, 0x39, 0xC0, 0x8E, 0xB1, 0x83, 0xE6, 0x26, 0x09, 0xDB, 0x4F, 0x1E, 0x8F, 0xDA,
-    0xE1, 0x57, 0xBF, 0xF2, 0xD8, 0x27, 0x49, 0xF8, 0xEA, 0x3A, 0x9C, 0x07, 0x1B, 0xC1, 0xDC, 0xDA,
-    0x00, 0x1F, 0xE5, 0x8A, 0x69, 0xE1, 0x74, 0x75, 0x2E, 0xBD, 0xC2, 0x8E, 0xED, 0x7E, 0x75, 0x5C,
-    0x67, 0x61, 0x4F, 0x8B, 0x6B, 0xFE, 0xA0, 0x07, 0x95, 0xD7, 0xC9, 0xEF, 0xAE, 0x8E, 0xC0, 0x4B,
-    0xDB, 0x27, 0x4C, 0xE9, 0x56, 0x77, 0xB1, 0xEF, 0xDE, 0xC5, 0xFE, 0xF0, 0xBF, 0x00, 0x61, 0x36,
-    0x1B, 0x97, 0x33, 0xAB, 0x4B, 0x8B, 0x5B, 0x3E, 0x74, 0xB0, 0xFF, 0x06, 0xBD, 0x59, 0x3D, 0x6C,
-    0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x2B, 0x72, 0x61, 0x8D, 0x79, 0xA3, 0x42, 0x04, 0x14, 0x8A, 0xE4,
-    0xAA, 0x70, 0x41, 0x04, 0x67, 0xAE, 0x8B, 0x43, 0x72, 0xC5, 0xFD, 0x8C, 0xEC, 0x42, 0x08, 0x52,
-    0x84, 0x85, 0x68, 0x17, 0x81, 0x63, 0x96, 0xB1, 0x0A, 0xF1, 0x0A, 0x15, 0x04, 0xB2, 0xD4, 0xAD,
-    0xA5, 0xC2, 0x85, 0x0B, 0x53, 0x01, 0x9C, 0xC6, 0x09, 0xA0, 0x20, 0x2E, 0xEC, 0x04, 0x48, 0xAE,
-    0x70, 0xC1, 0x18, 0x2B, 0xDD, 0x24, 0x2E, 0x02, 0xA4, 0xDA, 0x04, 0x30, 0x1C, 0xC0, 0x41, 0xB0,
-    0x06, 0x14, 0x04, 0x88, 0x8B, 0xAC, 0xE3, 0x35, 0xB2, 0x94, 0x8F, 0xB7, 0xF9, 0xDE, 0xEC, 0xDE,
-    0xE9, 0xE4, 0x28, 0x48, 0x6C, 0x9A, 0x3C, 0xDE, 0x0E, 0x79, 0x7B, 0xB3, 0xEF, 0xBD, 0x79, 0xF3,
-    0xBD, 0xEF, 0xBD, 0x37, 0xA4, 0x2D, 0x2B, 0xB7, 0x73, 0x4A, 0x89, 0x48, 0x59, 0xDA, 0xD6, 0x4E,
-    0xE8, 0x28, 0x57, 0x49, 0x92, 0xE4, 0xD1, 0x3A, 0x75, 0xA8, 0x4D, 0xBB, 0x74, 0x99, 0xC8, 0x56,
-    0xE4, 0x28, 0xDA, 0x4E, 0xEC, 0xCF, 0x46, 0xE2, 0xF7, 0x81, 0xB7, 0xD0, 0xEC, 0x2C, 0xD0, 0xEE,
-    0xE3, 0x14, 0x2D, 0xD3, 0x68, 0x8D, 0xF2, 0x06, 0xE5, 0x4F, 0x51, 0xD4, 0xA3, 0x4E, 0x4F, 0x7B,
-    0x45, 0x68, 0x1F, 0x10, 0x69, 0xB2, 0x34, 0x99, 0x97, 0x35, 0x4C, 0x48, 0xDC, 0x1A, 0x41, 0x5C,
-    0x00, 0x61, 0x4D, 0x6A, 0xD1, 0x19, 0x5C, 0x34, 0xB9, 0xEC, 0xE1, 0x5B, 0x34, 0x3F, 0x7C, 0x93,
-    0xA0, 0xAC, 0xBC, 0x9E, 0xAC, 0xBE, 0x1B, 0xE0, 0xBB, 0xBF, 0xD3, 0x86, 0x57, 0x14, 0x7A, 0xCD,
-    0x1D, 0x53, 0xF5, 0x6A, 0x7E, 0x6D, 0xC5, 0x2B, 0x72, 0xA1, 0xD2, 0x05, 0x6A, 0x2C, 0xD3, 0x1A,
-    0xDE, 0x0B, 0xD4, 0x94, 0x6A, 0x80, 0x9B, 0xCD, 0x17, 0x57, 0x30, 0xC1, 0x1F, 0xC9, 0x91, 0x4C,
-    0xDC, 0xC4, 0x8D, 0x1D, 0xED, 0x24, 0x2E, 0xD9, 0x98, 0x69, 0xA5, 0x6B, 0x44, 0x69, 0x8F, 0x28,
-    0x8B, 0x89, 0xDE, 0x09, 0xE9, 0x34, 0xF4, 0x2D, 0xB1, 0xCE, 0x80, 0xE8, 0xEB, 0xE3, 0xDB, 0xE6,
-    0xA2, 0x1C, 0x0F, 0x67, 0xD0, 0x89, 0xDF, 0xDD, 0x22, 0xA4, 0x64, 0xFA, 0x32, 0x7A, 0x67, 0x3E,
-    0xB2, 0x31, 0x6D, 0x2F, 0xA4, 0x81, 0xAB, 0x29, 0x71, 0xB4, 0x71, 0x1D, 0x1E, 0x24, 0xDC, 0xB6,
-    0x8B, 0x98, 0x5C, 0x31, 0x22, 0x81, 0x0F, 0x52, 0xF9, 0x24, 0x62, 0x49, 0xCE, 0x48, 0x12, 0x15,
-    0x3F, 0x21, 0xF2, 0x30, 0xC9, 0x29, 0x27, 0x9F, 0xA1, 0x6B, 0xF8, 0x19, 0xD0, 0x0E, 0x25, 0xD4,
-    0xFD, 0x6E, 0x48, 0x02, 0x1E, 0xDB, 0x3A, 0x97, 0xB7, 0xB3, 0xD6, 0x64, 0x9D, 0xE7, 0x8B, 0x3D,
-    0xA2, 0xC3, 0xCD, 0x88, 0x9C, 0x18, 0x92, 0x24, 0x5D, 0xB1, 0x75, 0x5D, 0xBC, 0x1E, 0x27, 0xCD,
-    0x55, 0x2B, 0xEE, 0xF5, 0x5A, 0xA4, 0x1A, 0x03, 0x18, 0xDF, 0x1C, 0xEC, 0x10, 0xAD, 0x95, 0x03,
-    0x7F, 0xC4, 0x17, 0xD4, 0x68, 0xAC, 0xD3, 0x46, 0xAF, 0x2E, 0x7F, 0xA4, 0xD3, 0x9A, 0xF5, 0x8E,
-    0xAD, 0x61, 0xA5, 0x50, 0x74, 0x60, 0xDD, 0x81, 0x05, 0x30, 0xAF, 0xDC, 0x93, 0x71, 0x28, 0xBE,
-    0x1D, 0xAE, 0x0A, 0xD5, 0x92, 0x14, 0x48, 0xDA, 0x59, 0xA7, 0xE0, 0x2A, 0x75, 0x5F, 0xD5, 0x73,
-    0x73, 0x44, 0x67, 0x4F, 0xD1, 0xA0, 0x61, 0xFF, 0x26, 0x91, 0x97, 0x74, 0xC7, 0x53, 0x01, 0x10,
-    0xE0, 0x91, 0x14, 0x4A, 0x00, 0x18, 0x2F, 0xE9, 0x2B, 0x3F, 0x7F, 0xB3, 0x5F, 0x1C, 0x12, 0x2D,
-    0xCC, 0xBE, 0xFB, 0xA3, 0xE1, 0xE8, 0xBF, 0xD8, 0xBD, 0x78, 0x19, 0x76, 0xFB, 0xFF, 0x08, 0x93,
-    0xA6, 0x78, 0x1A, 0x76, 0x8B, 0x8B, 0x49, 0x63, 0x20, 0x2E, 0xC6, 0xCD, 0x81, 0xB8, 0xA4, 0xD7,
-    0x06, 0x62, 0x0C, 0xBB, 0xC5, 0x77, 0x60, 0x37, 0xAC, 0x69, 0x34, 0xC4, 0x33, 0x71, 0xAF, 0xEE,
-    0xDD, 0xCA, 0xD2, 0xDA, 0xE2, 0xC6, 0xB3, 0x8F, 0xB4, 0x7B, 0x71, 0x73, 0x93, 0xFA, 0x45, 0xA1,
-    0x70, 0x2B, 0xDD, 0x0D, 0xD2, 0x85, 0xA4, 0x96, 0xD6, 0x76, 0xEA, 0x7E, 0x66, 0x29, 0x83, 0x8D,
-    0x07, 0xEF, 0x2B, 0x77, 0x8D, 0x9D, 0x33, 0x77, 0xE8, 0x6C, 0x29, 0xE0, 0x32, 0xDF, 0x7F, 0x91,
-    0xDC, 0x0F, 0x34, 0xD4, 0xCD, 0x63, 0xFB, 0xF0, 0x16, 0x44, 0x75, 0x06, 0x9C, 0x13, 0xAA, 0x9A,
-    0xAD, 0xFA, 0x05, 0xA6, 0x11, 0x5D, 0x21, 0xE7, 0x6F, 0xB1, 0x7B, 0x23, 0xB5, 0x6C, 0x6C, 0xB9,
-    0x26, 0x2C, 0xFA, 0x05, 0x85, 0x3F, 0xCE, 0x3A, 0xBA, 0x25, 0x42, 0xFF, 0x2E, 0xCD, 0x6D, 0x10,
-    0xEF, 0xA7, 0x08, 0x57, 0xA9, 0xC1, 0xD2, 0xCF, 0x02, 0x4D, 0xFB, 0x14, 0x61, 0x77, 0xF7, 0x01,
-    0x89, 0xCC, 0x4A, 0x29, 0xB5, 0x53, 0x2B, 0x75, 0x12, 0x3B, 0x75, 0x62, 0x07, 0x40, 0x71, 0x62,
-    0x57, 0xBB, 0xB1, 0x0C, 0x45, 0xEC, 0x87, 0xF2, 0xD3, 0x5F, 0xFC, 0xA9, 0x36, 0xBC, 0x99, 0xAD,
-    0x54, 0x80, 0x6F, 0xE3, 0xEA, 0xF2, 0x15, 0x02, 0xC1, 0xF8, 0x2D, 0x8B, 0x22, 0xE9, 0x8E, 0xBF,
-    0x47, 0xC3, 0xC3, 0x15, 0x5C, 0xCB, 0x54, 0xE0, 0x1A, 0x56, 0x57, 0x17, 0x97, 0x87, 0xCB, 0x7A,
-    0x7E, 0x19, 0xCE, 0xFF, 0x3F, 0xAE, 0x15, 0x68, 0xD9, 0xF5, 0x94, 0x75, 0x28, 0xE3, 0x27, 0x46,
-    0x23, 0x80, 0x05, 0x71, 0x9E, 0xC2, 0xCA, 0x9D, 0xC5, 0xAC, 0xBB, 0x07, 0xBB, 0x73, 0x2F, 0x3B,
-    0x05, 0x6B, 0xAD, 0xD4, 0x4E, 0x60, 0x29, 0x1C, 0xBF, 0x7D, 0x6F, 0xF3, 0xB2, 0x35, 0x26, 0xF1,
-    0x8A, 0x5E, 0x75, 0x74, 0x1B, 0x0B, 0x76, 0x75, 0x20, 0x42, 0x60, 0xC5, 0x8F, 0xC8, 0xDA, 0x20,
-    0xCB, 0x52, 0x80, 0x82, 0xAD, 0x13, 0x2B, 0xCD, 0x28, 0x0F, 0x28, 0x8F, 0x9C, 0x0F, 0x33, 0x71,
-    0x53, 0xAF, 0x08, 0x6A, 0xD4, 0x2B, 0x47, 0xE7, 0xA0, 0x0B, 0x00, 0x5E, 0x12, 0x24, 0xE3, 0x5E,
-    0x0A, 0xB8, 0xC3, 0x23, 0x09, 0xD9, 0x89, 0x0D, 0x97, 0xC7, 0x2E, 0xE8, 0x44, 0xD7, 0x68, 0xC3,
-    0xD5, 0x2D, 0x27, 0xD9, 0xBE, 0x37, 0x90, 0xF1, 0xE6, 0xE5, 0xE4, 0x9B, 0xBC, 0x19, 0x3F, 0xC3,
-    0x76, 0xD8, 0x2F, 0x6B, 0x5A, 0x39, 0x2D, 0x42, 0x6A, 0x22, 0xAC, 0xB1, 0x2F, 0x52, 0x59, 0x31,
-    0xF8, 0xC3, 0x09, 0x69, 0x08, 0xFF, 0xD0, 0xA6, 0x9A, 0xE8, 0x70, 0x39, 0xA8, 0x16, 0x58, 0x47,
-    0x8B, 0x75, 0x0C, 0xA0, 0x03, 0x33, 0xB1, 0x8C, 0x10, 0x3A, 0xB0, 0xAB, 0x8E, 0x5E, 0x59, 0x52,
-    0xAE, 0x6E, 0x1E, 0xA4, 0xDB, 0xF7, 0x3E, 0x4E, 0xF6, 0x37, 0x9F, 0xD5, 0xE1, 0xDB, 0x04, 0xDD,
-    0x29, 0xD5, 0x08, 0x13, 0xEB, 0xFC, 0xF7, 0x35, 0x82, 0x7B, 0x12, 0x1A, 0x5C, 0xC0, 0x0E, 0x85,
-    0xB7, 0x05, 0x5C, 0x0F, 0xB0, 0xCD, 0x41, 0xC7, 0x8B, 0x50, 0xE1, 0x7E, 0xA4, 0xE9, 0x36, 0x80,
-    0x62, 0x6B, 0x1B, 0xAE, 0x51, 0x24, 0x42, 0x49, 0xD6, 0x21, 0xAF, 0x68, 0x1B, 0x0F, 0xE2, 0x63,
-    0x42, 0x17, 0xC4, 0x6F, 0xF5, 0xD9, 0x6B, 0xF2, 0x92, 0xCA, 0x3B, 0x77, 0x6B, 0x4E, 0x36, 0xB7,
-    0xD1, 0x5A, 0x40, 0x90, 0x0F, 0xD6, 0x52, 0x68, 0xF8, 0x69, 0x4A, 0xCE, 0x8D, 0x1B, 0xE0, 0x3F,
-    0xB7, 0x18, 0x43, 0x0D, 0x62, 0xA2, 0xC9, 0x58, 0x4A, 0xC9, 0x67, 0x56, 0x59, 0x84, 0x2B, 0x43,
-    0x72, 0xF1, 0x75, 0xC2, 0x6B, 0xE3, 0xB8, 0x84, 0x46, 0x62, 0x38, 0xD6, 0x88, 0xEE, 0x80, 0x3D,
-    0x18, 0x0B, 0x81, 0xA1, 0xA6, 0x8C, 0xE2, 0xDC, 0x4A, 0x23, 0x27, 0xE9, 0xFE, 0x2A, 0x9C, 0x7F,
-    0x6B, 0x12, 0x6D, 0x82, 0x39, 0xD6, 0x31, 0xC1, 0xC1, 0xC4, 0x42, 0x4F, 0x4D, 0xBE, 0x30, 0x84,
-    0x64, 0xF1, 0xE0, 0x30, 0xAF, 0x89, 0x08, 0xC3, 0x4A, 0xC0, 0xCC, 0xCA, 0x03, 0xD3, 0x04, 0x25,
-    0xC0, 0x9C, 0xAD, 0x3B, 0x98, 0xA1, 0x30, 0x48, 0x86, 0x1F, 0xB8, 0x96, 0x43, 0xC5, 0x23, 0xE3,
-    0x73, 0x38, 0x45, 0x2A, 0xEC, 0x16, 0x23, 0x96, 0x3C, 0xDD, 0x1F, 0x59, 0x45, 0xF6, 0x90, 0x62,
-    0x49, 0x15, 0x55, 0xD3, 0xED, 0x93, 0xD2, 0x0B, 0x32, 0x00, 0xC9, 0xF2, 0xC6, 0xBC, 0x82, 0x90,
-    0x5F, 0xB1, 0xC2, 0xE3, 0xD7, 0xCB, 0xD4, 0x22, 0x32, 0x84, 0xF8, 0x0A, 0x12, 0x19, 0x5D, 0x38,
-    0x7F, 0xFC, 0x2A, 0xE7, 0x79, 0x59, 0xF2, 0x26, 0xB6, 0x55, 0x3E, 0xA3, 0x69, 0xF6, 0x75, 0x7C,
-    0xAB, 0x34, 0x64, 0x76, 0xC8, 0x42, 0x81, 0x3E, 0xAA, 0x39, 0x93, 0xBF, 0xEC, 0xD1, 0xB1, 0xA9,
-    0x2C, 0x8A, 0x82, 0x41, 0x7B, 0xF5, 0xD3, 0xE7, 0xF8, 0xD7, 0x37, 0x98, 0x1D, 0x88, 0x3E, 0x49,
-    0x08, 0xEB, 0xB6, 0xDF, 0x8D, 0x09, 0x3E, 0x70, 0x2E, 0x99, 0xE5, 0xD7, 0x0C, 0xDA, 0xA8, 0x5E,
-    0xFE, 0xEA, 0xC9, 0x82, 0x2D, 0x49, 0xE4, 0x6B, 0x1B, 0x1C, 0xE0, 0x9E, 0x81, 0x23, 0xEB, 0x83,
-    0x61, 0xA8, 0x57, 0x4C, 0x1E, 0xE8, 0x70, 0x24, 0xA5, 0x60, 0x55, 0xE4, 0xFF, 0x18, 0x11, 0x54,
-    0x23, 0x37, 0xB6, 0x0E, 0x37, 0x77, 0xA9, 0x3F, 0x02, 0xB3, 0x56, 0xC9, 0xCA, 0x2E, 0x12, 0xF2,
-    0x7F, 0x38, 0xA2, 0x11, 0x45, 0x48, 0xCB, 0x01, 0xA4, 0x5F, 0x90, 0x15, 0xFD, 0x32, 0x15, 0xEF,
-    0x56, 0x70, 0x8B, 0x66, 0x2E, 0x5E, 0x33, 0xAB, 0xF0, 0x95, 0xA3, 0xE4, 0x5F, 0xB7, 0xC9, 0x62,
-    0x53, 0x90, 0x02, 0xC9, 0x03, 0x4A, 0x10, 0xD8, 0x9C, 0x4C, 0x2C, 0xA4, 0x09, 0xFB, 0x70, 0xBA,
-    0x65, 0xFC, 0x98, 0xA1, 0xF7, 0x32, 0x5C, 0x1C, 0x55, 0xDD, 0x1F, 0x16, 0x28, 0x32, 0xBC, 0xF7,
-    0x5E, 0x08, 0xE1, 0x16, 0xDC, 0x94, 0x0A, 0x2E, 0xF7, 0xC8, 0x2E, 0xF5, 0x97, 0x83, 0x59, 0x4C,
-    0x97, 0xE9, 0x68, 0x17, 0x74, 0x54, 0x4A, 0xCA, 0xA7, 0x43, 0x46, 0xA7, 0x98, 0x52, 0xEB, 0xA8,
-    0x70, 0x98, 0x55, 0x3E, 0xDD, 0xCC, 0x38, 0x35, 0xA6, 0x53, 0xC5, 0x3C, 0xC9, 0x66, 0x97, 0xBA,
-    0x8C, 0xD8, 0x05, 0x3A, 0x21, 0xBD, 0x2E, 0xAB, 0xF4, 0xF8, 0xE3, 0x0E, 0x32, 0x0D, 0xC5, 0xCB,
-    0xC7, 0xAF, 0x77, 0xEF, 0x09, 0x40, 0x34, 0x8D, 0x78, 0xD8, 0x9F, 0x8D, 0x96, 0x63, 0x5D, 0x2A,
-    0x1E, 0x17, 0x9C, 0xC4, 0x88, 0x0C, 0xFD, 0x0E, 0x0F, 0xC9, 0x03, 0xCC, 0x43, 0x86, 0xBB, 0x67,
-    0xBE, 0xF5, 0x8D, 0xF4, 0xB6, 0x01, 0x0D, 0xE4, 0x8E, 0x2A, 0x1A, 0x87, 0x3C, 0x48, 0x73, 0x53,
-    0x48, 0xAA, 0xCC, 0x64, 0x1B, 0x60, 0xB7, 0x95, 0x3C, 0x40, 0x07, 0xA4, 0xB1, 0x38, 0x96, 0xC7,
-    0x02, 0x59, 0xA2, 0xB1, 0xD7, 0xAF, 0xA6, 0xB7, 0x2B, 0x2C, 0xB2, 0xBD, 0x23, 0x9A, 0xD6, 0xAE,
-    0x90, 0xCD, 0xC2, 0x59, 0xFA, 0x54, 0xBC, 0x93, 0x91, 0xC8, 0xE9, 0xC9, 0x3A, 0x6D, 0x9D, 0xFE,
-    0xF2, 0x76, 0x9E, 0x7B, 0x8C, 0x4B, 0x5E, 0x04, 0xBD, 0x37, 0xE3, 0xDD, 0xAF, 0xC8, 0xC6, 0x61,
-    0x71, 0x0F, 0x0F, 0xBF, 0x37, 0x64, 0x49, 0x52, 0xF3, 0x2E, 0x25, 0xBC, 0x4B, 0xC8, 0x91, 0x3C,
-    0xD7, 0x67, 0xF2, 0x41, 0x38, 0x67, 0xA2, 0x18, 0x5B, 0x99, 0x75, 0xE7, 0x32, 0xBE, 0x88, 0xB8,
-    0x8C, 0x46, 0x81, 0x91, 0x60, 0x40, 0xD4, 0xA2, 0xCA, 0x08, 0x31, 0xB3, 0x8B, 0x67, 0xAC, 0x11,
-    0x76, 0xE9, 0x85, 0x04, 0x82, 0xCB, 0x86, 0xC1, 0xB8, 0x53, 0xA0, 0x3D, 0x61, 0xF6, 0xE6, 0x7D,
-    0x3B, 0x23, 0xA6, 0xF4, 0x3D, 0xD4, 0x5C, 0xAD, 0x7B, 0x31, 0x5D, 0x07, 0x34, 0x4C, 0x91, 0x22,
-    0x33, 0xAE, 0x13, 0x57, 0x72, 0xAE, 0xE7, 0xEA, 0x11, 0xA1, 0x5F, 0xA8, 0x77, 0xB8, 0x0D, 0x69,
-    0xFA, 0x9C, 0x5D, 0x1B, 0x9E, 0x4A, 0x98, 0x7D, 0x34, 0xF6, 0x7B, 0xE0, 0xFE, 0x01, 0x1B, 0x9F,
-    0x38, 0xFF, 0xE4, 0xD1, 0xFE, 0x24, 0x64, 0x10, 0x7C, 0xA6, 0xB8, 0xE5, 0x19, 0x22, 0xF8, 0x35,
-    0xF3, 0x87, 0x6B, 0xC6, 0xFE, 0x88, 0x56, 0xA7, 0x1E, 0x63, 0x6F, 0x98, 0x16, 0xA7, 0xA4, 0x02,
-    0x7B, 0x42, 0x05, 0xF3, 0x8C, 0x3F, 0x7F, 0x33, 0x67, 0x1F, 0x75, 0x78, 0x6D, 0x1E, 0x2F, 0x0B,
-    0xDE, 0x60, 0xE0, 0xC2, 0x9D, 0x52, 0x77, 0xD9, 0x39, 0xD7, 0x79, 0xE0, 0x6A, 0x58, 0x45, 0xEC,
-    0xE5, 0x88, 0x69, 0x2A, 0x62, 0x9E, 0x0A, 0xD8, 0xC1, 0xED, 0xD2, 0x65, 0x60, 0x58, 0x19, 0xF7,
-    0xE1, 0x66, 0x43, 0xB1, 0xA7, 0x1E, 0x6C, 0x17, 0xFB, 0xDC, 0x50, 0x54, 0xA9, 0x7C, 0x8D, 0x4E,
-    0x52, 0xB9, 0xC7, 0x5E, 0xEF, 0xB3, 0xF2, 0x8F, 0x0D, 0xCA, 0x7B, 0x27, 0xA4, 0xFC, 0x0C, 0x2F,
-    0x7C, 0x0C, 0xEE, 0x73, 0xB7, 0x01, 0xC1, 0x39, 0x3B, 0x39, 0x21, 0xBD, 0x7B, 0x5B, 0xEC, 0xF0,
-    0x9C, 0x09, 0x38, 0x9B, 0x65, 0xA4, 0x63, 0x77, 0x76, 0x83, 0xD6, 0x9E, 0xA4, 0x7D, 0xF1, 0x74,
-    0x62, 0x7F, 0x10, 0xD2, 0x5D, 0x4E, 0x60, 0xF6, 0x47, 0x4A, 0xDC, 0x88, 0xD7, 0xE9, 0xED, 0x26,
-    0x43, 0xDC, 0x30, 0x02, 0xDB, 0xF1, 0x17, 0xB6, 0xC3, 0xC4, 0xFA, 0x75, 0xB6, 0xA3, 0x80, 0x1D,
-    0xCE, 0xAB, 0xB0, 0xC3, 0x65, 0x3B, 0x16, 0xD8, 0x8E, 0x26, 0xDB, 0x31, 0x80, 0x1D, 0x96, 0x86,
-    0x1D, 0x0E, 0xBA, 0xD9, 0xA8, 0xC6, 0x76, 0xD4, 0xD9, 0x8E, 0x1E, 0xEC, 0xE8, 0xC4, 0x6C, 0x47,
-    0x38, 0xB1, 0xA3, 0xC6, 0x76, 0x34, 0x1F, 0x6C, 0xBA, 0x93, 0x4C, 0xCB, 0x52, 0x4E, 0x04, 0x34,
-    0x49, 0x04, 0xFD, 0xC2, 0x2A, 0x92, 0xF3, 0x60, 0x52, 0x14, 0xE6, 0x30, 0x49, 0xF0, 0x80, 0xF5,
-    0x37, 0x79, 0x68, 0x30, 0x93, 0xF4, 0xCA, 0xBA, 0xC1, 0xE7, 0x87, 0x3B, 0x5C, 0x9A, 0xB7, 0x39,
-    0xBC, 0x02, 0x8E, 0xAE, 0x80, 0x83, 0x2B, 0xE2, 0x62, 0x39, 0xE2, 0xD2, 0x7D, 0x97, 0xB1, 0xEC,
-    0xBF, 0x06, 0xD7, 0xB8, 0x45, 0xF2, 0x50, 0xA1, 0x54, 0x16, 0xC5, 0x4C, 0x4B, 0xA6, 0xBD, 0xA2,
-    0xDE, 0x89, 0x2A, 0xEF, 0x1A, 0x7E, 0x01, 0xE6, 0xED, 0x3F, 0x02, 0xF3, 0xF3, 0xB4, 0x77, 0x32,
-    0xCA, 0xED, 0x8B, 0x50, 0x29, 0xDE, 0xC5, 0x67, 0x71, 0x33, 0x9E, 0x31, 0xE7, 0x64, 0x16, 0xED,
-    0x4E, 0x3D, 0x6E, 0x70, 0xB6, 0x35, 0xF1, 0xC5, 0xD8, 0x29, 0x42, 0x99, 0x00, 0x89, 0x98, 0x70,
-    0x8D, 0xB1, 0x86, 0x26, 0x30, 0x85, 0x50, 0xCA, 0x5C, 0xCE, 0x0C, 0x5C, 0x98, 0x04, 0x4D, 0xCE,
-    0x17, 0x03, 0x9E, 0xAD, 0xAB, 0x62, 0xEA, 0xF3, 0x39, 0xBA, 0x3D, 0x21, 0x50, 0x8B, 0x4B, 0xAB,
-    0xF2, 0x40, 0x60, 0x38, 0x9E, 0xC9, 0x40, 0xF7, 0x91, 0xCF, 0x5E, 0x4F, 0x4D, 0xB4, 0xF8, 0x98,
-    0xDD, 0x31, 0x47, 0x57, 0x1D, 0x3C, 0xD2, 0xC1, 0x1D, 0xF4, 0xA8, 0xFC, 0x83, 0x3E, 0xAB, 0x18,
-    0xAB, 0x47, 0x65, 0x49, 0x2A, 0xCF, 0x6E, 0x60, 0x7F, 0xC6, 0xBA, 0x02, 0xD6, 0xD5, 0xE2, 0xB4,
-    0x1C, 0xD0, 0x5C, 0x66, 0x45, 0x48, 0x10, 0xFD, 0x37, 0x89, 0xDB, 0x5D, 0xB2, 0x3F, 0xC6, 0x63,
-    0xCE, 0x87, 0x3C, 0xC4, 0x39, 0x17, 0x7C, 0x43, 0xA6, 0x55, 0xA4, 0x11, 0x11, 0x62, 0x6D, 0x92,
-    0xA5, 0xCB, 0x6F, 0xC1, 0x8F, 0xDE, 0x2A, 0xB7, 0x79, 0x1E, 0x70, 0xB8, 0xEE, 0x16, 0xAA, 0xB4,
-    0xBF, 0x35, 0x2D, 0x08, 0xB3, 0x49, 0xA5, 0xD4, 0x57, 0xB3, 0xD9, 0x81, 0x93, 0x83, 0x98, 0x49,
-    0x0D, 0x4B, 0xB7, 0x88, 0x0E, 0x86, 0xD0, 0xE4, 0x43, 0xF2, 0x3A, 0x16, 0xC6, 0x8B, 0x62, 0xF3,
-    0x02, 0x88, 0x89, 0xCA, 0x45, 0x21, 0x3F, 0xE6, 0x76, 0x46, 0xD1, 0x63, 0x19, 0x5D, 0xDF, 0x39,
-    0xD0, 0x7E, 0x32, 0x54, 0x0F, 0x36, 0xE5, 0x11, 0xB5, 0xC5, 0x51, 0x65, 0xF2, 0x11, 0x16, 0x32,
-    0x25, 0xB5, 0xB0, 0x9A, 0xDB, 0x8F, 0x1F, 0x5D, 0x26, 0x33, 0xC6, 0xF0, 0xA6, 0xB2, 0x3E, 0x28,
-    0x50, 0xB4, 0xEF, 0x1F, 0x5D, 0xDE, 0xD6, 0x39, 0xB8, 0x17, 0xCE, 0x7C, 0x70, 0x96, 0x76, 0x34,
-    0x79, 0x7C, 0xB6, 0xC4, 0x47, 0x77, 0x4D, 0xC0, 0xBA, 0xB1, 0x5C, 0xAE, 0x5B, 0xA6, 0x47, 0x97,
-    0xBB, 0x14, 0x2E, 0x85, 0xD6, 0xC1, 0xAF, 0xEF, 0x67, 0x40, 0x8F, 0x1E, 0x49, 0x25, 0x55, 0xD4,
-    0x85, 0x84, 0x1C, 0x02, 0x6C, 0x14, 0xB3, 0x01, 0x6E, 0x72, 0x8D, 0x95, 0x97, 0x15, 0x19, 0xA7,
-    0x0C, 0xEE, 0xC5, 0x22, 0x27, 0xA0, 0xB0, 0xFB, 0x7C, 0xF7, 0x39, 0xED, 0x65, 0x62, 0x72, 0x2A,
-    0xBA, 0xB4, 0x67, 0xDD, 0xCF, 0x5D, 0x1D, 0x49, 0xD5, 0xF2, 0xE9, 0x4C, 0x7B, 0xA6, 0x8E, 0xCB,
-    0xCD, 0x1F, 0xFC, 0xC8, 0x73, 0x9A, 0xA7, 0xC7, 0xA6, 0x97, 0x0B, 0x18, 0x8A, 0x8B, 0x19, 0xF9,
-    0x25, 0x4B, 0xB4, 0x4D, 0xF1, 0x86, 0x6A, 0xD6, 0x0E, 0x4B, 0xC3, 0x2C, 0x36, 0x0A, 0x26, 0x45,
-    0x6C, 0x0E, 0x8C, 0xF1, 0x74, 0x71, 0x58, 0x09, 0x7C, 0x48, 0x5A, 0xF5, 0x6A, 0x33, 0x9E, 0xD1,
-    0x67, 0xCD, 0xD3, 0x97, 0x79, 0x1C, 0x61, 0x80, 0x76, 0x01, 0xCD, 0x42, 0xD9, 0x2A, 0x7C, 0xA1,
-    0xC7, 0xB1, 0xD7, 0xF0, 0xD7, 0x74, 0xA7, 0xBF, 0x98, 0x6A, 0xE4, 0xDE, 0x10, 0x3C, 0x04, 0x72,
-    0x5E, 0x54, 0xDB, 0x5A, 0x68, 0x11, 0xF2, 0x41, 0xAB, 0x57, 0xED, 0x62, 0x0B, 0x3F, 0x9D, 0x5E,
-    0xE5, 0xA1, 0xEA, 0x1C, 0x26, 0xA9, 0x02, 0x73, 0x51, 0xD1, 0xB6, 0x66, 0x1E, 0x15, 0xA6, 0x8E,
-    0x96, 0x54, 0x95, 0xD2, 0x65, 0x1D, 0xDD, 0x32, 0xEF, 0x4E, 0x6F, 0xE2, 0x5E, 0x40, 0x68, 0xC4,
-    0xBD, 0xB5, 0x94, 0xB4, 0xC6, 0x7D, 0x35, 0x9F, 0x1C, 0x9E, 0x37, 0xD5, 0x35, 0xEA, 0x11, 0xF0,
-    0x03, 0x7A, 0x08, 0x57, 0x97, 0x75, 0x40, 0x25, 0x8D, 0xDF, 0x3F, 0x26, 0x61, 0x4A, 0x87, 0x27,
-    0xCE, 0x45, 0x9D, 0xFD, 0x76, 0xA9, 0xF5, 0x7F, 0x59, 0x49, 0xD7, 0xD0, 0xDC, 0x6C, 0x5F, 0x2D,
-    0xA9, 0x6D, 0x1D, 0xD7, 0xED, 0xA0, 0xDC, 0x9E, 0xA5, 0x5F, 0x92, 0x7D, 0x9F, 0x73, 0x7C, 0xB7,
-    0x7A, 0x92, 0x0F, 0xE3, 0x3D, 0x43, 0x95, 0x23, 0xC6, 0x1C, 0xE6, 0xE4, 0x06, 0xB3, 0xA8, 0xB5,
-    0xF9, 0x3C, 0xAA, 0xA8, 0xC2, 0x9D, 0x63, 0xB3, 0x7F, 0x23, 0xA4, 0xF7, 0x11, 0x9B, 0xAA, 0x8C,
-    0xCD, 0x45, 0xF5, 0x06, 0xF5, 0x7F, 0x37, 0x26, 0xF1, 0x67, 0x94, 0x20, 0xA9, 0x87, 0x92, 0x05,
-    0x57, 0xB8, 0x0E, 0x69, 0x6D, 0x48, 0x6A, 0x19, 0xCA, 0x6D, 0x43, 0x52, 0xCB, 0x90, 0x67, 0x8E,
-    0xF1, 0xCE, 0x5E, 0x6E, 0xCE, 0x35, 0x67, 0x28, 0x89, 0x4B, 0x50, 0x64, 0x13, 0x9A, 0x9C, 0xDF,
-    0x2C, 0xED, 0x11, 0x10, 0x0C, 0x37, 0x74, 0xCC, 0xB1, 0x79, 0xC7, 0x48, 0xE3, 0xEA, 0xC7, 0xAB,
-    0xEC, 0xEB, 0x56, 0x36, 0x46, 0x95, 0x8D, 0xA0, 0xDB, 0xF1, 0x6C, 0xF2, 0x99, 0xF0, 0x5C, 0x6C,
-    0xCA, 0x9B, 0xAF, 0x44, 0x26, 0xFB, 0x90, 0xE3, 0xBC, 0x85, 0xE4, 0x14, 0x3F, 0x7E, 0x74, 0x99,
-    0x95, 0x2F, 0xAD, 0x19, 0x5F, 0x1E, 0x49, 0x1E, 0xF3, 0x5C, 0xDE, 0xFE, 0x1C, 0xCF, 0x1D, 0x6D,
-    0xCD, 0x2D, 0x73, 0xEA, 0x31, 0x69, 0x0D, 0x26, 0x67, 0xFD, 0xE6, 0x75, 0x76, 0x82, 0x6B, 0xF3,
-    0xBA, 0x40, 0xF3, 0x6F, 0xA0, 0x71, 0x1A, 0xA2, 0xEF, 0x42, 0x6B, 0x1D, 0x7B, 0x5A, 0x86, 0x3F,
-    0xD0, 0x52, 0xBD, 0x1F, 0xFB, 0xCE, 0xCB, 0xBA, 0x2B, 0x84, 0xEE, 0x2C, 0x4B, 0xDD, 0xE9, 0x49,
-    0xD5, 0x05, 0x33, 0xFA, 0x61, 0x9B, 0xE4, 0x4B, 0x19, 0xAD, 0xA2, 0x1B, 0xEF, 0xCD, 0x6E, 0xDA,
-    0xEE, 0x7F, 0x66, 0xBC, 0x45, 0x35, 0xA7, 0xFA, 0x90, 0x26, 0x20, 0x8D, 0xCF, 0x5A, 0xA5, 0x02,
-    0xBA, 0x60, 0xB9, 0x87, 0xB5, 0xF8, 0x55, 0x42, 0x6F, 0x63, 0x2D, 0x2D, 0x70, 0x61, 0x70, 0x7A,
-    0x9F, 0x3A, 0xDF, 0xBF, 0xB3, 0xE7, 0x27, 0x33, 0xE8, 0x32, 0xB5, 0x57, 0xF4, 0x50, 0xC6, 0x3B,
-    0xB2, 0x4C, 0xCE, 0x78, 0xE8, 0xA1, 0xB9, 0x89, 0xA6, 0xAD, 0xC7, 0x8E, 0x2E, 0xF3, 0x11, 0xDD,
-    0xF4, 0xD1, 0xD7, 0x5D, 0xD5, 0x5E, 0x86, 0x29, 0xDE, 0x66, 0xCE, 0xD1, 0x53, 0xD1, 0xF0, 0xAD,
-    0xAF, 0x65, 0xCC, 0xC7, 0xEE, 0x18, 0x12, 0x30, 0xB5, 0x9D, 0xF2, 0xC1, 0x45, 0xC6, 0x43, 0xCE,
-    0x71, 0x18, 0xF1, 0x16, 0x04, 0x5C, 0x8A, 0xB5, 0xB9, 0x78, 0xEB, 0x70, 0xC3, 0xCC, 0x95, 0x15,
-    0xA2, 0x7B, 0x22, 0xB8, 0x36, 0x2D, 0x60, 0xB2, 0xAA, 0xD8, 0x5B, 0xE4, 0x44, 0xE6, 0x67, 0x93,
-    0x13, 0xD9, 0xCE, 0xE7, 0xFA, 0xFE, 0x60, 0x09, 0x21, 0x59, 0x68, 0xFA, 0xD7, 0x33, 0x09, 0x1D,
-    0xA0, 0x35, 0xCF, 0x51, 0xF5, 0xF1, 0xCF, 0x43, 0xFF, 0x0F, 0x01, 0x9F, 0x61, 0xC5, 0xCC, 0x1F,
-    0x32, 0x8C, 0xCC, 0xD1, 0xBB, 0x57, 0x81, 0x62, 0x22, 0xEA, 0x3A, 0x87, 0x4D, 0x3C, 0x71, 0x9B,
-    0xF1, 0xDB, 0x43, 0xC7, 0x10, 0x27, 0xB2, 0xC0, 0x7F, 0x03, 0xC5, 0x5A, 0x4B, 0x8C, 0x1C, 0x57,
+static const uint8_t notoserif_12_italicBitmaps[30843] = {
+    0xC5, 0x58, 0x3D, 0x8C, 0xDC, 0xD6, 0x11, 0x1E, 0xF2, 0x59, 0x66, 0x6C, 0x5A, 0xA2, 0x8B, 0x5C,
+    0x91, 0xB3, 0x24, 0xAA, 0x74, 0x71, 0x3A, 0xBA, 0x10, 0x90, 0x05, 0xB2, 0xDC, 0x7D, 0xB2, 0x10,
+    0xA4, 0x48, 0x61, 0x15, 0xDE, 0x28, 0x40, 0x0A, 0xBB, 0x70, 0x61, 0xA4, 0x91, 0x82, 0xA8, 0x50,
+    0x80, 0xBD, 0x5B, 0x22, 0x6D, 0x8A, 0x9C, 0x0D, 0xA4, 0xCE, 0x15, 0x2E, 0x8C, 0x34, 0xB9, 0x42,
+    0x01, 0x16, 0xF1, 0x9E, 0x97, 0x89, 0x0B, 0x01, 0x01, 0x82, 0xD0, 0x31, 0x9C, 0x26, 0x0E, 0x40,
+    0x18, 0x56, 0xD2, 0x24, 0x30, 0x11, 0x53, 0x00, 0x25, 0xEF, 0x1D, 0xF3, 0x7D, 0xF3, 0xC8, 0xBB,
+    0x13, 0x2C, 0xC3, 0xF9, 0x45, 0xF6, 0xF6, 0xF1, 0x76, 0x97, 0xE4, 0xCC, 0x37, 0x7F, 0xDF, 0xCC,
+    0xA3, 0x34, 0xD2, 0x78, 0xB5, 0x5F, 0xF9, 0xA5, 0x29, 0x4C, 0x6E, 0xF2, 0x20, 0x0B, 0x6C, 0x28,
+    0xA1, 0x9C, 0x11, 0xBE, 0x46, 0xB2, 0x2D, 0x5B, 0xFC, 0xE0, 0xE5, 0x12, 0x59, 0x99, 0x8A, 0x57,
+    0x89, 0x29, 0x24, 0xD4, 0x6F, 0x09, 0xCF, 0xF3, 0xF4, 0x42, 0xDF, 0x8D, 0xBE, 0xEB, 0xFE, 0x3D,
+    0x17, 0x19, 0x8A, 0x5C, 0x14, 0x89, 0x44, 0xFC, 0x4C, 0xA5, 0x7D, 0x59, 0xE4, 0x9C, 0x48, 0x68,
+    0xC5, 0xE4, 0xE2, 0x17, 0xE2, 0x97, 0x14, 0x87, 0xB7, 0xAF, 0x6F, 0x83, 0x77, 0x49, 0xE9, 0x01,
+    0xA4, 0xF7, 0x0A, 0x52, 0x0A, 0xC5, 0x85, 0x61, 0xC6, 0x8F, 0xFA, 0x8A, 0x6D, 0x92, 0x47, 0xB9,
+    0xC9, 0x02, 0xC0, 0xB9, 0x2A, 0xB3, 0xD5, 0x72, 0x45, 0xA0, 0xB3, 0xEE, 0x74, 0x02, 0xA1, 0xF7,
+    0x16, 0xD0, 0xB0, 0x09, 0x09, 0xB1, 0xC4, 0x50, 0x3F, 0xC2, 0x1A, 0x62, 0x4D, 0xF1, 0x6D, 0x81,
+    0xD5, 0x40, 0x70, 0x23, 0x9B, 0x00, 0x99, 0x62, 0x0D, 0xB1, 0xE6, 0xF8, 0xAB, 0x64, 0x0A, 0x3D,
+    0x23, 0x28, 0x0A, 0x0F, 0x21, 0xC7, 0x52, 0xD8, 0x6D, 0x09, 0x2A, 0xD9, 0xAE, 0xCC, 0x27, 0xA5,
+    0x7F, 0xA5, 0x87, 0x46, 0xDB, 0x33, 0xA2, 0x8B, 0x85, 0x00, 0x9D, 0x13, 0xA0, 0x1C, 0xBE, 0x39,
+    0x90, 0x71, 0x5B, 0x29, 0x8A, 0x67, 0x20, 0x62, 0x3F, 0xCA, 0xBD, 0xDA, 0x94, 0x5E, 0x09, 0xAB,
+    0x0A, 0x2C, 0xDE, 0x4F, 0x3B, 0xE8, 0x10, 0xBA, 0x46, 0xF6, 0x84, 0x8E, 0xD0, 0xAF, 0x03, 0x2C,
+    0x5C, 0x11, 0x64, 0x06, 0x1E, 0x0A, 0x21, 0xA6, 0x95, 0x59, 0x7B, 0xE8, 0x2C, 0x0A, 0x0F, 0xAD,
+    0x6C, 0x87, 0x85, 0x34, 0x70, 0x50, 0x05, 0x3F, 0xED, 0xE2, 0xBF, 0x93, 0x85, 0x9B, 0xB7, 0xE1,
+    0x0F, 0x7C, 0x7D, 0xFC, 0x40, 0x14, 0x0A, 0xA1, 0x75, 0x6B, 0x03, 0x8E, 0x4A, 0x65, 0x2C, 0xE3,
+    0xCB, 0x2B, 0x09, 0xDB, 0xA2, 0x73, 0x1E, 0xEF, 0x83, 0x73, 0x65, 0x8C, 0xF5, 0x16, 0xA2, 0xF0,
+    0xBB, 0x4C, 0x82, 0x17, 0xAC, 0x9C, 0x83, 0x31, 0x03, 0xAC, 0x32, 0x01, 0xA4, 0x11, 0x10, 0xA4,
+    0x72, 0x71, 0xB2, 0x75, 0x15, 0x38, 0x2A, 0x8D, 0x2A, 0x03, 0xCA, 0x65, 0xF0, 0x79, 0xD9, 0x5A,
+    0x00, 0xCC, 0x01, 0x30, 0x97, 0x5D, 0x3F, 0x97, 0xC2, 0xCB, 0x90, 0x1D, 0x1A, 0x63, 0x03, 0xAF,
+    0x99, 0x9F, 0x59, 0x09, 0x3F, 0xE6, 0xF5, 0x8C, 0x4B, 0xAA, 0x49, 0xE4, 0x56, 0x2A, 0x17, 0xE0,
+    0xA5, 0x1A, 0xF2, 0xF6, 0x83, 0x52, 0x92, 0xD6, 0xCA, 0xD1, 0x8B, 0x2E, 0xDF, 0x8A, 0x32, 0xAF,
+    0x0A, 0x72, 0x53, 0x20, 0x01, 0xE9, 0x16, 0xEB, 0x2C, 0x1A, 0x25, 0x99, 0x8C, 0xFF, 0x5C, 0xC3,
+    0xD2, 0x05, 0xEE, 0xE6, 0x5F, 0x8A, 0x35, 0xD4, 0x4F, 0x43, 0xC4, 0x8D, 0xF1, 0x8B, 0xBF, 0x51,
+    0x4A, 0xD0, 0xC9, 0x4B, 0xDA, 0xD6, 0xD2, 0x7F, 0x97, 0x70, 0xDD, 0xCB, 0x9A, 0x22, 0xC0, 0xE2,
+    0x95, 0xCE, 0xD7, 0xBD, 0xFB, 0x09, 0x6B, 0xEA, 0x4C, 0xF2, 0x4F, 0x9C, 0x8A, 0x4F, 0x9C, 0x72,
+    0xC2, 0xE0, 0xD7, 0xFB, 0x71, 0x86, 0xE2, 0x00, 0x2E, 0x57, 0x20, 0xC0, 0x97, 0x9B, 0x2A, 0x42,
+    0xB4, 0x6F, 0x89, 0xCC, 0x0A, 0xF1, 0x3E, 0xAD, 0x81, 0xF5, 0x40, 0xE8, 0x6B, 0x66, 0xD7, 0x1C,
+    0x0A, 0xE6, 0xF8, 0x3F, 0x85, 0xCD, 0x63, 0x39, 0xE9, 0x7B, 0xE6, 0x2E, 0xFC, 0xB7, 0x7F, 0x1D,
+    0xD9, 0x1E, 0x66, 0x41, 0x1E, 0x20, 0x8D, 0xB1, 0x2C, 0x57, 0xE8, 0x56, 0x96, 0x64, 0xC1, 0xDD,
+    0xD6, 0x7A, 0xED, 0x4B, 0xB8, 0x78, 0xDC, 0xA1, 0x59, 0x28, 0xD0, 0x01, 0x80, 0xA6, 0x00, 0x19,
+    0x1F, 0x74, 0xB2, 0xAE, 0xFA, 0x95, 0xA9, 0x88, 0xFE, 0xE4, 0x0B, 0xF1, 0x56, 0x5F, 0xA3, 0xD6,
+    0x16, 0x50, 0x3E, 0x7F, 0xF8, 0x6C, 0x94, 0x47, 0x45, 0x50, 0xF8, 0xB9, 0xB1, 0x17, 0xE5, 0xE9,
+    0x2E, 0xB7, 0x46, 0x61, 0xB1, 0xF0, 0xAB, 0xDB, 0x5E, 0x75, 0xC1, 0x55, 0x62, 0x50, 0x20, 0x71,
+    0x64, 0x9F, 0xFF, 0x43, 0x21, 0x0D, 0x9C, 0xEE, 0xEF, 0x06, 0x96, 0xB7, 0x4F, 0xF8, 0x86, 0x21,
+    0xF6, 0x78, 0x60, 0x52, 0x48, 0x48, 0x94, 0xE7, 0x78, 0x72, 0xC8, 0xC3, 0x0D, 0x26, 0x78, 0x89,
+    0x3B, 0x7C, 0xA4, 0x13, 0xF2, 0x62, 0x44, 0xBF, 0xC3, 0xA0, 0x18, 0x91, 0x41, 0xB6, 0xC7, 0xCC,
+    0x7E, 0x44, 0xB8, 0xC4, 0xC1, 0x67, 0x41, 0x21, 0xBF, 0xE3, 0x7C, 0xB6, 0xF2, 0xDA, 0x1A, 0xF9,
+    0xB5, 0x8B, 0xEB, 0xFE, 0x70, 0xC8, 0x24, 0x4E, 0x2C, 0xAB, 0x38, 0x63, 0x19, 0x67, 0xC8, 0x86,
+    0x98, 0x9C, 0xC0, 0x8A, 0xF3, 0xA0, 0x6D, 0x4C, 0xC7, 0x6E, 0x7D, 0xAB, 0xA6, 0x83, 0x94, 0x7E,
+    0x94, 0x2B, 0x46, 0x04, 0xB6, 0x45, 0x56, 0x59, 0xC0, 0x1A, 0xAF, 0x91, 0xE0, 0xDE, 0x77, 0xCA,
+    0xE3, 0x62, 0x12, 0xBF, 0x45, 0xEA, 0xBD, 0xBE, 0x82, 0x6F, 0x16, 0xA8, 0xA3, 0x29, 0x32, 0xED,
+    0x02, 0xEB, 0x25, 0xE9, 0xFC, 0x4D, 0xB2, 0xDB, 0xEF, 0x7C, 0xDE, 0xAF, 0x69, 0x97, 0xBF, 0x89,
+    0x35, 0x36, 0xBA, 0x7B, 0x5D, 0xBC, 0xB6, 0x71, 0xB2, 0x96, 0xED, 0x47, 0x40, 0xFA, 0xFE, 0x92,
+    0x48, 0x95, 0xB1, 0x50, 0xE5, 0x31, 0x7D, 0x98, 0x50, 0x7F, 0x42, 0xEF, 0x8C, 0x78, 0x48, 0x79,
+    0x98, 0xF2, 0xC4, 0x82, 0x2C, 0xD7, 0x90, 0xE7, 0x1A, 0x96, 0x2F, 0x32, 0x07, 0x39, 0x0F, 0xC5,
+    0x40, 0xBA, 0x02, 0xD2, 0x97, 0x7A, 0xA4, 0xCB, 0xB6, 0x85, 0xD1, 0xEF, 0xBF, 0x04, 0xA2, 0xC9,
+    0x0C, 0x7D, 0x60, 0x98, 0x9C, 0xBE, 0xC3, 0xE9, 0x0E, 0x1A, 0x65, 0xE7, 0x83, 0x89, 0x75, 0x40,
+    0xB5, 0x52, 0xDD, 0xA1, 0x96, 0xC7, 0x88, 0x61, 0x83, 0x4A, 0x07, 0x90, 0x3C, 0xA9, 0x21, 0x99,
+    0xC5, 0xFC, 0xCF, 0x4A, 0x1E, 0x51, 0x28, 0x4B, 0xFC, 0xB3, 0x92, 0x85, 0x92, 0x85, 0x92, 0xC1,
+    0x58, 0xFC, 0x3A, 0x3B, 0x2E, 0x65, 0x9F, 0xBE, 0x49, 0x5E, 0x6B, 0x59, 0xFD, 0x63, 0x0B, 0x63,
+    0x63, 0xDA, 0xF9, 0x98, 0x72, 0xD2, 0x09, 0xE9, 0xDA, 0x53, 0x16, 0x72, 0x6A, 0xC2, 0x92, 0x69,
+    0x2D, 0x42, 0x55, 0x6B, 0xBC, 0x9C, 0x97, 0x46, 0x74, 0x10, 0xBC, 0x5D, 0x48, 0xF4, 0xD1, 0x33,
+    0x39, 0xFC, 0x7D, 0xD8, 0xCB, 0x5F, 0x1E, 0x18, 0x18, 0x11, 0x97, 0xB2, 0xB4, 0x14, 0x99, 0x8A,
+    0xEB, 0x4A, 0xCC, 0xA7, 0x85, 0xCA, 0x6F, 0xF4, 0x58, 0x53, 0x0D, 0x41, 0x3A, 0x02, 0xDB, 0x9A,
+    0x5C, 0xAB, 0x78, 0x01, 0x49, 0xB8, 0x51, 0x0A, 0x6C, 0xC8, 0xE4, 0xB8, 0x0C, 0xD8, 0x70, 0x19,
+    0x62, 0x07, 0xAD, 0x90, 0x07, 0xB6, 0x07, 0xDB, 0xCC, 0x5A, 0x43, 0x2B, 0x96, 0x07, 0x54, 0xF4,
+    0x39, 0x5C, 0x4F, 0x75, 0xAB, 0xAE, 0xE1, 0x75, 0x75, 0x53, 0xE1, 0x46, 0xA4, 0x3A, 0x32, 0x58,
+    0x66, 0xB6, 0x67, 0x3C, 0x97, 0x3D, 0x0B, 0x39, 0x62, 0x51, 0xA2, 0xE2, 0xA2, 0xF7, 0xFA, 0xA6,
+    0x40, 0x2C, 0x4A, 0x79, 0x79, 0x47, 0xDE, 0xD6, 0x51, 0x51, 0x72, 0x4C, 0x00, 0xBC, 0x7C, 0x99,
+    0xA9, 0x07, 0xC0, 0x95, 0x71, 0x89, 0x9A, 0x43, 0xFC, 0x98, 0x73, 0x11, 0xAF, 0x1D, 0xF2, 0x62,
+    0x48, 0x4B, 0x02, 0x5C, 0x33, 0x3A, 0xCF, 0xFB, 0xD0, 0x19, 0x64, 0xBB, 0xE5, 0x1D, 0xA8, 0x1F,
+    0x59, 0x51, 0x76, 0x83, 0x9A, 0x96, 0xDA, 0xB0, 0xE7, 0x6A, 0xCB, 0x65, 0x75, 0x54, 0x72, 0x40,
+    0xDC, 0x30, 0x1B, 0xF6, 0xD2, 0xE0, 0xCF, 0x20, 0x48, 0xE4, 0xD1, 0xC6, 0x34, 0x08, 0x6B, 0x2D,
+    0x67, 0x61, 0xCC, 0x00, 0xD2, 0x6E, 0x22, 0xC7, 0x2A, 0x4D, 0xB1, 0x25, 0xA0, 0xA2, 0xC8, 0xD0,
+    0x96, 0x7C, 0xC4, 0x2D, 0xAA, 0xC5, 0xC0, 0x51, 0xA7, 0xE1, 0x6B, 0x90, 0xD1, 0xD9, 0x86, 0x6F,
+    0xD9, 0x98, 0xCB, 0x00, 0xBE, 0xD8, 0x58, 0xC8, 0xF7, 0x70, 0xF1, 0x60, 0x2A, 0x1F, 0xE2, 0xDF,
+    0xA5, 0xA9, 0xFF, 0x6B, 0xA8, 0xBF, 0x91, 0x9A, 0x2B, 0x80, 0xB9, 0x97, 0x86, 0x64, 0xE5, 0x72,
+    0x74, 0x96, 0xDE, 0x29, 0x93, 0x01, 0x1D, 0x54, 0x24, 0x37, 0x80, 0xCE, 0xCB, 0xE3, 0x12, 0x00,
+    0x7D, 0xD0, 0x67, 0x4C, 0xE7, 0x45, 0x76, 0x6C, 0x31, 0x07, 0x44, 0xBE, 0xE6, 0x77, 0xEE, 0xA3,
+    0x26, 0xE2, 0x42, 0xB6, 0xA1, 0x9B, 0x05, 0x40, 0x04, 0x68, 0xAF, 0xE7, 0x1A, 0x74, 0x04, 0x6A,
+    0xBC, 0x81, 0xE3, 0x88, 0xBD, 0x77, 0x90, 0x08, 0xB5, 0xC6, 0x96, 0x4A, 0xA3, 0x9C, 0x3A, 0x83,
+    0x77, 0xA9, 0xCB, 0xFC, 0x9D, 0x47, 0xFF, 0x13, 0xF8, 0xA1, 0x90, 0x4F, 0x2D, 0x67, 0x9F, 0x25,
+    0xD5, 0x91, 0x20, 0x02, 0x3D, 0xCE, 0x56, 0x72, 0xBE, 0xCF, 0xF8, 0xC7, 0x59, 0x82, 0xC9, 0xA4,
+    0x71, 0xE4, 0xD3, 0x67, 0x3C, 0x08, 0x81, 0x15, 0x96, 0x30, 0xA8, 0x63, 0xFA, 0x74, 0x9B, 0x87,
+    0x7D, 0x4E, 0x2F, 0x9A, 0xA8, 0xE4, 0x2F, 0x1E, 0xB6, 0xE8, 0xD2, 0x15, 0x7C, 0xAB, 0xAC, 0x01,
+    0x16, 0x8C, 0x8A, 0x19, 0x12, 0x84, 0x49, 0x04, 0xF7, 0x2A, 0x13, 0xEC, 0x90, 0x0D, 0x57, 0xBC,
+    0x9D, 0x24, 0x8A, 0x99, 0x06, 0x1A, 0x94, 0x08, 0xDD, 0x41, 0xB4, 0xCF, 0x40, 0x02, 0x84, 0x6F,
+    0xB1, 0x1C, 0xD9, 0x9F, 0xB5, 0xF7, 0x3E, 0xB2, 0x5E, 0xAB, 0x87, 0xEB, 0xF5, 0xBF, 0x8C, 0x3E,
+    0x3C, 0x46, 0x9F, 0x58, 0x9D, 0xD5, 0xBA, 0x99, 0x44, 0x73, 0x5B, 0xCC, 0x03, 0x7E, 0xFF, 0xAE,
+    0x95, 0x8E, 0xE4, 0xDF, 0xDF, 0x97, 0x4E, 0x8D, 0xD5, 0x22, 0x53, 0x92, 0x8F, 0x8E, 0xCC, 0x62,
+    0xB1, 0xB1, 0xC3, 0x28, 0xDE, 0x05, 0xF3, 0x71, 0x45, 0x59, 0x0D, 0x65, 0xD5, 0x01, 0x4B, 0x17,
+    0x15, 0xC4, 0x2E, 0x08, 0xB3, 0x90, 0xCB, 0xB8, 0x6C, 0xE6, 0xAC, 0x7A, 0x06, 0x37, 0xEC, 0x87,
+    0x05, 0xCE, 0x57, 0x3A, 0x80, 0x15, 0xAE, 0xD6, 0x7C, 0xE2, 0x22, 0xBD, 0xCE, 0x38, 0x05, 0xC1,
+    0x66, 0xEF, 0xA0, 0xA3, 0xFD, 0x04, 0x69, 0x11, 0xDB, 0x5A, 0x07, 0xC4, 0x91, 0xDA, 0x16, 0xB6,
+    0xAE, 0xB3, 0x46, 0x2D, 0x3A, 0x56, 0x7C, 0xED, 0xDE, 0x75, 0xD9, 0x30, 0xE5, 0x19, 0x19, 0x98,
+    0xF2, 0xB4, 0x5C, 0x30, 0xC5, 0x97, 0x5C, 0xD5, 0x6A, 0xD9, 0x76, 0x06, 0x1E, 0xD9, 0x1B, 0x3F,
+    0xCC, 0xA4, 0x3A, 0x98, 0x4E, 0xA5, 0xAB, 0x1C, 0x55, 0x99, 0x90, 0x57, 0x97, 0x2B, 0xD3, 0xE6,
+    0x49, 0x81, 0xB8, 0xE1, 0xFE, 0x5B, 0x3C, 0xEC, 0xB1, 0x1D, 0x70, 0xBA, 0x36, 0x1C, 0x33, 0x03,
+    0x0B, 0x15, 0x67, 0xA8, 0x67, 0x83, 0x34, 0x31, 0xE0, 0x81, 0x23, 0x63, 0x49, 0x6B, 0x3E, 0xE4,
+    0xC4, 0xF5, 0x17, 0x68, 0xF3, 0x3E, 0xA5, 0xD0, 0xE3, 0x70, 0x33, 0xBE, 0x98, 0x88, 0x5F, 0x91,
+    0xB6, 0x42, 0x11, 0x60, 0xD4, 0xB5, 0x90, 0xD9, 0xA0, 0x8F, 0x83, 0x2E, 0x56, 0x28, 0x07, 0x8C,
+    0x1C, 0x2B, 0x54, 0x42, 0x98, 0x9F, 0x59, 0x40, 0x5F, 0x98, 0x3F, 0x35, 0x05, 0x6F, 0x84, 0xF9,
+    0xB3, 0x53, 0xE4, 0x77, 0x90, 0x3F, 0x37, 0x35, 0x60, 0xC1, 0x1C, 0xC5, 0x47, 0xBD, 0x45, 0x0A,
+    0xF5, 0xE6, 0xF7, 0x79, 0x4A, 0x00, 0xEF, 0xD9, 0x94, 0x10, 0xFE, 0x28, 0x23, 0x82, 0xF8, 0x9B,
+    0x8C, 0x48, 0x5E, 0x2B, 0x49, 0x00, 0xC4, 0xD4, 0xE4, 0x0F, 0x97, 0x04, 0x74, 0xE8, 0x41, 0xD0,
+    0x72, 0x2C, 0xF5, 0x01, 0x08, 0x13, 0x4A, 0xC1, 0x33, 0x01, 0xA1, 0x36, 0xE7, 0x78, 0x7A, 0x35,
+    0xD0, 0x0E, 0xA0, 0xEE, 0x1D, 0x67, 0x47, 0xBE, 0xEA, 0x3E, 0x2F, 0xE9, 0x50, 0xFF, 0x0E, 0x67,
+    0xA6, 0x90, 0x83, 0xAE, 0x9C, 0xD3, 0xBC, 0xBD, 0x49, 0xEB, 0x30, 0xC5, 0xC1, 0x50, 0xCC, 0x8E,
+    0x88, 0xE1, 0x78, 0x15, 0xC1, 0x89, 0xE3, 0x43, 0xD3, 0x66, 0x51, 0xE9, 0xC6, 0x95, 0x9B, 0xCC,
+    0x5F, 0x26, 0x84, 0xAF, 0xF9, 0x41, 0x55, 0x9C, 0x5D, 0xA6, 0xD4, 0x97, 0xEE, 0x89, 0x1B, 0x7A,
+    0x5D, 0x88, 0x92, 0xCF, 0x09, 0x91, 0x46, 0x27, 0xD6, 0x89, 0x4D, 0x1B, 0xE5, 0xFD, 0xC9, 0x8C,
+    0x43, 0xCA, 0xDB, 0xE0, 0x00, 0x38, 0xD1, 0xB3, 0x8A, 0x48, 0x53, 0x59, 0xD3, 0x9B, 0x93, 0x82,
+    0x47, 0xB7, 0x1F, 0xFF, 0xCE, 0x6C, 0xEA, 0x7F, 0x7F, 0x8C, 0xBF, 0x0F, 0xF8, 0xFB, 0x25, 0x19,
+    0x4F, 0x26, 0x55, 0xD7, 0x82, 0xD7, 0x5F, 0xC3, 0x50, 0xB9, 0x44, 0x34, 0x99, 0xEB, 0x9B, 0x80,
+    0x31, 0x02, 0x80, 0x54, 0x07, 0x5A, 0x4E, 0x32, 0x8D, 0xE8, 0x96, 0x4C, 0x1A, 0xF6, 0xC4, 0x27,
+    0x30, 0xF8, 0xDE, 0xBA, 0x9F, 0x27, 0xE5, 0x52, 0x4B, 0x36, 0x5C, 0x75, 0x73, 0x75, 0x3F, 0x93,
+    0x6B, 0x37, 0x79, 0x55, 0xFC, 0x4F, 0x5A, 0xC4, 0x04, 0x21, 0xAE, 0x91, 0x37, 0x55, 0x98, 0xF7,
+    0x7F, 0x2C, 0x64, 0xD6, 0x56, 0xAC, 0x73, 0x53, 0x0A, 0x4D, 0x73, 0x19, 0x63, 0x66, 0xFC, 0x5A,
+    0xCF, 0x00, 0xEB, 0x3B, 0xDE, 0x83, 0x26, 0xC8, 0x17, 0x91, 0x1D, 0x26, 0xF2, 0x74, 0x7A, 0xA2,
+    0xAF, 0x35, 0xFA, 0x61, 0x2A, 0xD9, 0xF8, 0x5A, 0x1E, 0x76, 0xD3, 0xD3, 0xB8, 0xDB, 0x75, 0xF4,
+    0x0D, 0x0B, 0xE3, 0xE8, 0xFA, 0x4F, 0xED, 0xBF, 0x6B, 0x8C, 0xAC, 0x67, 0xDE, 0x03, 0xD4, 0xF1,
+    0x2A, 0xB2, 0x0B, 0xEC, 0xC8, 0x52, 0xBF, 0x5A, 0xC4, 0x79, 0x7B, 0xD0, 0xE9, 0xFF, 0x8C, 0xF2,
+    0xA3, 0x8D, 0x82, 0x6C, 0x72, 0x84, 0x9F, 0xF2, 0x30, 0x3F, 0x62, 0xB8, 0xFB, 0xB6, 0x2B, 0x2B,
+    0xC7, 0x75, 0x65, 0xB7, 0xD7, 0xD1, 0xD1, 0xFE, 0x44, 0xA9, 0x86, 0x47, 0xA5, 0x1A, 0x49, 0x5F,
+    0xAA, 0x9B, 0x8F, 0x28, 0xD5, 0x79, 0x5F, 0x4B, 0x01, 0x25, 0xCD, 0x3A, 0x6F, 0x7D, 0x45, 0xBC,
+    0x37, 0x67, 0x12, 0xFD, 0xFC, 0x37, 0x32, 0x84, 0xC8, 0x1A, 0xB2, 0xB1, 0x61, 0xF1, 0x30, 0xCC,
+    0x7B, 0x15, 0x64, 0xD6, 0x10, 0x34, 0x03, 0x98, 0x5F, 0x70, 0xEA, 0x85, 0xE6, 0xBB, 0x6E, 0x1C,
+    0x7A, 0xFC, 0xE3, 0x16, 0xDB, 0xE0, 0xD8, 0xDE, 0x86, 0x5E, 0x4C, 0x19, 0x80, 0x7B, 0x5E, 0xB6,
+    0xBF, 0x3E, 0x07, 0xC3, 0xEC, 0x48, 0x5C, 0x3B, 0x5E, 0xD6, 0x89, 0xA0, 0x9B, 0x06, 0x4C, 0xF1,
+    0x86, 0x04, 0x77, 0x0E, 0x25, 0xF8, 0x00, 0x94, 0xBA, 0x07, 0x52, 0xCC, 0x49, 0x8C, 0x9B, 0xC0,
+    0x9A, 0xC2, 0xBD, 0x43, 0x20, 0xE5, 0x16, 0x68, 0xA1, 0x9B, 0x9F, 0x29, 0x3C, 0x35, 0x97, 0xFD,
+    0x9D, 0xA6, 0xAB, 0x1E, 0x4A, 0xEA, 0x37, 0x05, 0x6B, 0xF6, 0x3A, 0x73, 0x80, 0xF1, 0x97, 0xB8,
+    0x0B, 0xCC, 0x90, 0xF7, 0xDF, 0x48, 0xFA, 0x1D, 0xC9, 0xB4, 0xDF, 0xBB, 0xEB, 0xEB, 0xD4, 0x55,
+    0x09, 0xDD, 0x66, 0x5C, 0xF7, 0xBA, 0x26, 0xEF, 0xB6, 0xBB, 0xA1, 0x8E, 0x40, 0x3A, 0x67, 0x3C,
+    0x34, 0x02, 0xCD, 0xE9, 0x7A, 0xF8, 0x07, 0xDE, 0x79, 0xB4, 0x1D, 0x6B, 0x57, 0x83, 0x7C, 0x56,
+    0x06, 0xDC, 0x50, 0x66, 0xB0, 0xFE, 0x79, 0x34, 0x16, 0xF0, 0x4A, 0x3C, 0x62, 0xA4, 0x90, 0x4C,
+    0x2F, 0x60, 0x80, 0x83, 0xF8, 0x21, 0x2E, 0x9E, 0xE2, 0xE6, 0xB9, 0x26, 0x8B, 0x63, 0xF0, 0xB8,
+    0xC6, 0x74, 0xC2, 0x67, 0x12, 0x25, 0xB7, 0x5B, 0xC1, 0x09, 0x2B, 0x36, 0x35, 0xBD, 0x7A, 0x2B,
+    0xD6, 0xEC, 0x1B, 0xDE, 0xAE, 0xCC, 0xEE, 0x1C, 0x46, 0xD8, 0x68, 0x7D, 0x90, 0x5C, 0x4A, 0x61,
+    0x41, 0xBC, 0x93, 0xD2, 0x67, 0x59, 0xAA, 0xAD, 0x65, 0x88, 0xBB, 0xE8, 0xB1, 0x44, 0xFD, 0x35,
+    0xD2, 0x0D, 0x28, 0xBD, 0x57, 0xF1, 0xBB, 0xC7, 0x81, 0xB3, 0xF1, 0xA8, 0xBB, 0x96, 0xFB, 0x59,
+    0x83, 0xE3, 0xB2, 0x73, 0x06, 0x24, 0x53, 0x2E, 0xA5, 0x52, 0xE6, 0xBF, 0x16, 0x85, 0xF5, 0x1D,
+    0x41, 0x59, 0x09, 0x2D, 0x8F, 0x2C, 0x3D, 0xCF, 0xBB, 0xD8, 0x3B, 0x63, 0xA4, 0x35, 0x1F, 0x3E,
+    0x8C, 0x75, 0xBB, 0xD2, 0x68, 0x89, 0x60, 0x93, 0xC0, 0xBD, 0x56, 0x97, 0xE5, 0xDE, 0x8B, 0xEB,
+    0x36, 0x58, 0x2D, 0x0B, 0xF9, 0xE5, 0x0F, 0x2B, 0x79, 0x0B, 0xD0, 0x56, 0xBA, 0x63, 0xAE, 0x3D,
+    0xFA, 0x03, 0x7F, 0x46, 0x7D, 0xC2, 0xAD, 0x28, 0xB7, 0x90, 0xE8, 0xD6, 0xC5, 0x14, 0x3D, 0xAA,
+    0xD4, 0x9C, 0x8E, 0xBA, 0x8C, 0xDE, 0xEC, 0x78, 0x68, 0xCC, 0x3C, 0x58, 0x7F, 0xFD, 0x98, 0x6D,
+    0xB2, 0xE4, 0x0B, 0x0A, 0xB4, 0x92, 0xED, 0x1F, 0x80, 0xC5, 0x3F, 0xEC, 0x43, 0x78, 0xB2, 0xD6,
+    0x73, 0xED, 0x99, 0x93, 0xCB, 0xBB, 0xCB, 0x1F, 0x37, 0xD1, 0x9B, 0x8B, 0x70, 0xEF, 0x66, 0xA4,
+    0x8F, 0x42, 0x62, 0x7B, 0x9C, 0x15, 0xC3, 0x3E, 0x31, 0xC8, 0x4F, 0xEB, 0xD6, 0x47, 0x79, 0x67,
+    0xD3, 0xD0, 0x0E, 0x70, 0x59, 0x88, 0xA4, 0x3A, 0x50, 0x7E, 0x0F, 0xC9, 0xD1, 0x97, 0xBC, 0xEA,
+    0x96, 0x57, 0xA6, 0x26, 0x8F, 0x9D, 0xE1, 0xD8, 0x8E, 0xEE, 0x92, 0xE0, 0x83, 0xBB, 0x18, 0xDA,
+    0x35, 0xF1, 0x1E, 0x95, 0x75, 0x43, 0x7D, 0x8F, 0xBE, 0xAD, 0x09, 0xC7, 0x20, 0x9D, 0xB2, 0x33,
+    0x90, 0x9C, 0xEE, 0x9E, 0xB3, 0x48, 0xA7, 0xA3, 0x48, 0xA7, 0x87, 0x51, 0x47, 0x77, 0x0C, 0xD2,
+    0x4A, 0x86, 0xFE, 0x4A, 0xA6, 0x4F, 0x22, 0xFC, 0xAF, 0xEE, 0xEF, 0x24, 0xA5, 0x0B, 0xD2, 0x9A,
+    0x9C, 0x92, 0x59, 0xC6, 0xF6, 0x18, 0xE3, 0xFE, 0x00, 0xCE, 0x34, 0xD6, 0xE4, 0x01, 0xEC, 0x7E,
+    0x12, 0xEB, 0x29, 0xA4, 0xF1, 0xB3, 0x58, 0x37, 0x90, 0xD2, 0xD8, 0xE3, 0x73, 0x16, 0x3C, 0xEC,
+    0xA8, 0x57, 0xF5, 0x8A, 0x3C, 0x91, 0xA0, 0xBA, 0x12, 0xEE, 0xE1, 0x23, 0x18, 0xC1, 0xC3, 0x57,
+    0xF3, 0x33, 0x26, 0xFF, 0x7E, 0x7E, 0xD6, 0xE4, 0xEF, 0xE5, 0xCF, 0x9A, 0x5F, 0xBD, 0x93, 0x3F,
+    0x67, 0xDE, 0xB9, 0x52, 0x94, 0xE6, 0x8E, 0x79, 0x37, 0x37, 0xBF, 0x35, 0xEF, 0x89, 0xF9, 0xAB,
+    0xF9, 0x13, 0x9A, 0x25, 0xBA, 0xA6, 0xA9, 0x4C, 0xD5, 0xC7, 0x5B, 0x5E, 0xF4, 0x57, 0x68, 0x95,
+    0x29, 0x46, 0xF7, 0x04, 0xFD, 0x36, 0xE6, 0xC8, 0x8A, 0x93, 0x9C, 0xD5, 0xB9, 0xF8, 0x79, 0x80,
+    0xB5, 0xD7, 0x88, 0x8F, 0x58, 0x87, 0x98, 0x02, 0x67, 0xEC, 0xBA, 0x6B, 0xD6, 0x87, 0xE3, 0xB1,
+    0xA1, 0x07, 0x5A, 0x5C, 0x67, 0x4A, 0x3E, 0x51, 0xAB, 0x18, 0x31, 0xF2, 0x12, 0x66, 0x7D, 0xCE,
+    0x4C, 0x21, 0x8B, 0x9C, 0x4D, 0x90, 0x2D, 0x5C, 0x46, 0x97, 0xC4, 0x8D, 0xF8, 0xAE, 0x55, 0x29,
+    0x0D, 0xEA, 0x73, 0xBE, 0x61, 0x4F, 0xA3, 0x54, 0xB8, 0x46, 0x76, 0x4E, 0xD4, 0xBF, 0x13, 0x6C,
+    0x02, 0xD1, 0x06, 0x3D, 0xE4, 0x8E, 0xB1, 0x53, 0xB7, 0xDD, 0xE7, 0x20, 0xC5, 0xDB, 0x93, 0x6E,
+    0x1B, 0xA7, 0x3F, 0x05, 0x1C, 0x28, 0x24, 0xFE, 0xC9, 0x16, 0x82, 0xD7, 0xF9, 0x48, 0x19, 0x15,
+    0x99, 0xE0, 0x31, 0x8F, 0x44, 0xFE, 0xD3, 0xBA, 0x58, 0x9B, 0x4C, 0xF8, 0x38, 0xAA, 0xEC, 0x3E,
+    0x4F, 0xDC, 0xD7, 0xB6, 0xED, 0x1E, 0xB8, 0x09, 0x48, 0x75, 0x6C, 0x93, 0x2C, 0xB0, 0x01, 0x86,
+    0x9C, 0x52, 0xBC, 0xEC, 0xE5, 0xF0, 0xF9, 0x62, 0x23, 0x94, 0xC1, 0x19, 0xD9, 0x8E, 0xB3, 0x59,
+    0x9C, 0x6F, 0x86, 0xD9, 0xF9, 0x20, 0x1B, 0xBF, 0x50, 0x24, 0x3F, 0x2A, 0x83, 0xCB, 0x45, 0xE0,
+    0xE5, 0x38, 0x5B, 0x0E, 0xDC, 0xCD, 0x0B, 0xAF, 0x0A, 0x8A, 0x03, 0x74, 0xCF, 0x72, 0x81, 0x59,
+    0xA5, 0x78, 0xE8, 0xA1, 0x49, 0x70, 0x00, 0x72, 0x91, 0x38, 0x1E, 0xC2, 0xA0, 0xE1, 0xE9, 0xF9,
+    0x45, 0x51, 0xF6, 0x10, 0xE5, 0x0D, 0xF4, 0x9D, 0x6B, 0xF7, 0xF4, 0x99, 0x13, 0x1A, 0x2A, 0xA8,
+    0x97, 0xB3, 0x4E, 0x49, 0xF7, 0x93, 0xB6, 0x58, 0x3F, 0xEC, 0x37, 0xDC, 0xA1, 0xB0, 0x7E, 0xF4,
+    0x98, 0xC5, 0xEA, 0x79, 0x7D, 0x56, 0xA7, 0x85, 0x1A, 0x6B, 0xD7, 0xD9, 0xD4, 0x18, 0x8C, 0xB4,
+    0xF9, 0xA4, 0xDD, 0x53, 0x87, 0x46, 0x1D, 0x48, 0x55, 0xCA, 0xE8, 0x41, 0xC9, 0x12, 0x9C, 0xD9,
+    0x13, 0xED, 0x30, 0xE0, 0xA4, 0x12, 0x73, 0xA6, 0x27, 0x89, 0x9E, 0xEC, 0x86, 0x08, 0x1C, 0x40,
+    0x21, 0x73, 0xD1, 0xA0, 0x00, 0x09, 0x07, 0x53, 0x00, 0x8B, 0x21, 0x08, 0xC5, 0x13, 0x72, 0xEF,
+    0x14, 0xBA, 0xD9, 0x7B, 0x93, 0x58, 0xD2, 0x0E, 0xCA, 0xA6, 0x8C, 0x5F, 0x61, 0x64, 0x8A, 0x2F,
+    0xEC, 0x86, 0x0E, 0x01, 0xCE, 0xC5, 0x18, 0x00, 0x65, 0x48, 0x77, 0x90, 0x51, 0xA5, 0xE6, 0x83,
+    0xDD, 0xFB, 0x57, 0xF8, 0x88, 0xEF, 0x9D, 0xFF, 0x3D, 0x02, 0x06, 0x28, 0x6C, 0xF9, 0xF0, 0x2E,
+    0x4E, 0x99, 0x97, 0x08, 0x51, 0x98, 0xF7, 0x31, 0x72, 0x41, 0xD2, 0x28, 0x39, 0x8F, 0x70, 0xA8,
+    0x63, 0x9C, 0x40, 0x48, 0x0C, 0x14, 0x60, 0x30, 0x52, 0x91, 0x0B, 0x55, 0xB7, 0x9B, 0xDC, 0xD4,
+    0x60, 0x51, 0x39, 0x7F, 0x1A, 0xBA, 0x70, 0x4D, 0x5D, 0xBC, 0xA6, 0x0E, 0xE3, 0xC2, 0x45, 0x6C,
+    0x6B, 0x57, 0x43, 0x36, 0xE6, 0x93, 0x88, 0xB9, 0xC3, 0x5A, 0xCB, 0x51, 0xD4, 0x5C, 0xD8, 0xBA,
+    0xB8, 0x3D, 0x1C, 0xB8, 0x0E, 0x75, 0xA5, 0xA8, 0xC3, 0x4A, 0x51, 0xB3, 0xB0, 0x80, 0x5A, 0x1F,
+    0x4F, 0x78, 0x2C, 0x64, 0xA2, 0x86, 0xDB, 0x88, 0xFA, 0x9B, 0xFF, 0x67, 0xD4, 0xFF, 0x00, 0x85,
+    0x53, 0x3D, 0x6F, 0xD3, 0x50, 0x14, 0x3D, 0xB6, 0x2B, 0x2C, 0x70, 0x93, 0xD7, 0x01, 0xA6, 0x26,
+    0xF5, 0x5A, 0x68, 0x1A, 0x33, 0x44, 0x28, 0x83, 0x93, 0x3C, 0xB1, 0xF0, 0x07, 0x60, 0xEF, 0x5A,
+    0x18, 0xE8, 0xD0, 0x21, 0x43, 0xD2, 0x58, 0x5D, 0x98, 0x90, 0xBA, 0xB0, 0x33, 0x30, 0xA0, 0x0E,
+    0x28, 0x43, 0x86, 0x08, 0xF5, 0xC3, 0xA2, 0x7F, 0xC0, 0x1B, 0x43, 0x17, 0xF3, 0x31, 0x21, 0x21,
+    0x59, 0x28, 0x83, 0x0B, 0x69, 0xCD, 0xB9, 0x4E, 0x09, 0x2E, 0x02, 0x71, 0xF5, 0xDE, 0xF5, 0xE7,
+    0x3D, 0xE7, 0xDE, 0x73, 0xEF, 0xF3, 0x5D, 0xF4, 0xEA, 0xE8, 0xAE, 0x63, 0xE4, 0x63, 0xD8, 0xC4,
+    0xCB, 0x06, 0xC4, 0x6C, 0x23, 0x84, 0xB2, 0x02, 0x94, 0x2C, 0x8D, 0x8A, 0x0D, 0xD4, 0x1C, 0xA8,
+    0x2C, 0x4B, 0x6E, 0xBC, 0x7D, 0xB3, 0x87, 0x61, 0x0D, 0x88, 0x9B, 0x40, 0xD4, 0x80, 0x11, 0x6E,
+    0x61, 0xED, 0xCB, 0x77, 0x3D, 0xC8, 0x32, 0x2D, 0x21, 0x8E, 0x19, 0xA2, 0x5C, 0x08, 0x03, 0xEE,
+    0x72, 0x6F, 0x01, 0xEE, 0x05, 0x70, 0x70, 0x1A, 0x1A, 0xC9, 0x49, 0x64, 0x7E, 0x38, 0x09, 0xCD,
+    0x8F, 0x01, 0xCC, 0x6F, 0x01, 0x90, 0x69, 0x60, 0x10, 0x02, 0x4E, 0xCA, 0x7D, 0x0E, 0x94, 0x3A,
+    0x68, 0x2E, 0x32, 0xA3, 0x45, 0x0F, 0xFD, 0x4A, 0x0B, 0xDE, 0x66, 0x0A, 0x3B, 0xDB, 0x9B, 0xC3,
+    0x60, 0x03, 0x97, 0x66, 0x5C, 0x90, 0x1C, 0xF6, 0xB3, 0x80, 0x6C, 0xCA, 0x0A, 0x15, 0xB0, 0x6E,
+    0x85, 0x4C, 0xCC, 0xB7, 0xC2, 0xED, 0xDC, 0xC7, 0x40, 0xD7, 0x7E, 0x47, 0xE8, 0xAE, 0xF3, 0xE0,
+    0x7E, 0x8A, 0xA6, 0x2A, 0xAB, 0x15, 0xF8, 0x34, 0x05, 0x27, 0x1E, 0x75, 0x19, 0x60, 0xC4, 0x89,
+    0xD2, 0xB0, 0xC2, 0x84, 0xF7, 0x8E, 0x21, 0xBE, 0x6A, 0xC4, 0x75, 0x06, 0x23, 0xF6, 0x81, 0x04,
+    0xC9, 0x08, 0x46, 0x84, 0x4E, 0x84, 0xA2, 0x99, 0x19, 0xB3, 0x56, 0xBB, 0x09, 0xD0, 0xC6, 0x04,
+    0x68, 0xCD, 0x5D, 0xDB, 0x24, 0xA3, 0xE7, 0xCA, 0xD7, 0xF4, 0xDA, 0x2B, 0x0C, 0x22, 0xF5, 0xD9,
+    0xFA, 0x44, 0x50, 0xA5, 0xA7, 0x15, 0x78, 0xD8, 0xF1, 0xF9, 0x9B, 0x37, 0xA2, 0x53, 0x31, 0x9D,
+    0x15, 0xF3, 0x9D, 0x33, 0x81, 0x8A, 0xFA, 0x87, 0xC4, 0x8C, 0x2F, 0x59, 0x7A, 0xBD, 0xF1, 0x70,
+    0x18, 0xE7, 0xB7, 0x0A, 0x25, 0x05, 0xF7, 0xF9, 0x82, 0xF9, 0xF5, 0xD0, 0x38, 0x3E, 0xEB, 0x64,
+    0xFA, 0xF6, 0xBD, 0x18, 0x8D, 0x31, 0x46, 0x4B, 0x97, 0x22, 0x34, 0x7F, 0xAF, 0xC7, 0x47, 0xAF,
+    0x07, 0xD9, 0x79, 0xF1, 0x0D, 0x6E, 0x4A, 0x13, 0xB5, 0xC0, 0x50, 0x54, 0x6E, 0x4A, 0x03, 0x69,
+    0xED, 0x90, 0x9B, 0x04, 0xEC, 0x13, 0xA8, 0x1C, 0xA4, 0x47, 0x65, 0xEE, 0xCA, 0x0C, 0x30, 0xD7,
+    0x98, 0xB5, 0xB1, 0x6E, 0x0A, 0xC3, 0x4D, 0x04, 0xA7, 0x80, 0xD0, 0x2C, 0x4A, 0x71, 0x9D, 0x2D,
+    0xA5, 0x96, 0xD8, 0x81, 0x1D, 0xA3, 0x23, 0x82, 0xC8, 0x13, 0x0E, 0x79, 0x89, 0xE4, 0x13, 0xAA,
+    0xB3, 0xFF, 0x98, 0xDA, 0xAD, 0x47, 0x0F, 0xE7, 0x61, 0xF3, 0xC7, 0x8D, 0x3F, 0x42, 0x8C, 0x69,
+    0x0E, 0x18, 0xCD, 0x00, 0xDB, 0xB3, 0x64, 0xC4, 0xD6, 0xCE, 0xA4, 0x98, 0xB3, 0x27, 0x44, 0xF5,
+    0x80, 0x31, 0x44, 0xEE, 0x2A, 0xAC, 0x48, 0x72, 0xB3, 0x83, 0xCE, 0x0F, 0x5B, 0x2B, 0x23, 0xA9,
+    0x5B, 0xC1, 0x8A, 0x15, 0xB6, 0xAC, 0xC0, 0x77, 0x02, 0x9F, 0x5E, 0x69, 0xFA, 0x26, 0x47, 0xC9,
+    0x0A, 0xBA, 0x2E, 0xC6, 0xB6, 0xA6, 0x9F, 0x38, 0x60, 0xE3, 0x27, 0x25, 0xF8, 0xCE, 0xFB, 0x7E,
+    0x0F, 0xBE, 0x79, 0xCE, 0x66, 0xAC, 0x5F, 0xCA, 0x2D, 0xE6, 0x84, 0x30, 0x34, 0xCC, 0x09, 0x96,
+    0x65, 0x2E, 0xB3, 0x54, 0x06, 0x6D, 0x33, 0xCF, 0xD9, 0xC8, 0xE2, 0xE5, 0x09, 0x06, 0xDA, 0x0E,
+    0x29, 0x84, 0x23, 0x4E, 0x05, 0x94, 0x83, 0xAE, 0xC1, 0x16, 0x33, 0x55, 0x57, 0xB4, 0xF5, 0x44,
+    0xBD, 0xB6, 0x28, 0xDC, 0xE2, 0xF9, 0x40, 0x4F, 0x66, 0xB4, 0x27, 0x62, 0x1F, 0x88, 0xDA, 0x07,
+    0xD2, 0x91, 0xBE, 0x50, 0x79, 0x2F, 0x28, 0x8F, 0x9D, 0xC5, 0x73, 0x4D, 0x26, 0x7C, 0x2F, 0x92,
+    0xA5, 0x52, 0x9C, 0x91, 0xC0, 0x4C, 0x64, 0x44, 0x58, 0x22, 0x17, 0x29, 0x49, 0x48, 0x26, 0xF2,
+    0x30, 0xD6, 0xCD, 0x55, 0x68, 0xCB, 0xD8, 0x11, 0x5B, 0x82, 0x8E, 0x73, 0x9C, 0x86, 0x58, 0x93,
+    0xB6, 0x5A, 0xA3, 0x55, 0xC4, 0x16, 0x4B, 0x6C, 0x9C, 0x47, 0x59, 0xA7, 0x57, 0x90, 0x39, 0xA9,
+    0x33, 0xF0, 0xFF, 0x22, 0xA7, 0xE8, 0xA4, 0x79, 0x82, 0xAB, 0x72, 0x2C, 0x70, 0x04, 0x9C, 0xC2,
+    0x3C, 0xD1, 0xD6, 0x6E, 0x68, 0x23, 0x2A, 0x23, 0xA9, 0x60, 0xDB, 0x87, 0xBF, 0x8D, 0xEA, 0x12,
+    0x16, 0x3A, 0x59, 0x16, 0xDC, 0xD9, 0xDF, 0xD7, 0x12, 0xEE, 0xB2, 0x52, 0x93, 0x47, 0x7C, 0x2A,
+    0xE0, 0x45, 0xCC, 0x5F, 0xB0, 0xCC, 0xC2, 0x0B, 0xF0, 0x54, 0x4B, 0x0A, 0x7F, 0xA9, 0x52, 0xCB,
+    0x8D, 0x9D, 0x53, 0xC7, 0xFF, 0x32, 0x78, 0x0C, 0x4D, 0xA4, 0xA4, 0xA2, 0x5E, 0x84, 0x99, 0x2D,
+    0x33, 0x95, 0x55, 0xA4, 0xF7, 0xAF, 0xD0, 0xCF, 0xCF, 0xB5, 0x1B, 0x95, 0x5B, 0x93, 0xD2, 0x56,
+    0xBD, 0x36, 0xE4, 0x79, 0x84, 0xFE, 0x09, 0xBD, 0x59, 0x3D, 0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xBB,
+    0x2B, 0x72, 0x61, 0x8D, 0x79, 0xA3, 0x42, 0x04, 0x14, 0x8A, 0xE4, 0xAA, 0x70, 0x41, 0x04, 0x67,
+    0xAE, 0x8B, 0x43, 0x72, 0xC5, 0xFD, 0x8C, 0xEC, 0x42, 0x08, 0x52, 0x84, 0x85, 0x68, 0x17, 0x81,
+    0x63, 0x96, 0xB1, 0x0A, 0xF1, 0x0A, 0x15, 0x04, 0xB2, 0xD4, 0xAD, 0xA5, 0xC2, 0x85, 0x0B, 0x53,
+    0x01, 0x9C, 0xC6, 0x09, 0xA0, 0x20, 0x2E, 0xEC, 0x04, 0x48, 0xAE, 0x70, 0xC1, 0x18, 0x2B, 0xDD,
+    0x24, 0x2E, 0x02, 0xA4, 0xDA, 0x04, 0x30, 0x1C, 0xC0, 0x41, 0xB0, 0x06, 0x14, 0x18, 0x88, 0x8B,
+    0xAC, 0xE3, 0x35, 0xB2, 0x94, 0x8F, 0xB7, 0xF9, 0xDE, 0xEC, 0xDE, 0xE9, 0xE4, 0x28, 0x48, 0x6C,
+    0x86, 0xBC, 0xBB, 0x99, 0xE3, 0xED, 0xCE, 0xBE, 0xBF, 0x79, 0xEF, 0x7B, 0xEF, 0x0D, 0x69, 0xCB,
+    0xCA, 0xED, 0x9C, 0x52, 0x22, 0x52, 0x96, 0xB6, 0xB5, 0x13, 0x3A, 0xCA, 0x55, 0x92, 0x24, 0x79,
+    0xB4, 0x4E, 0x1D, 0x6A, 0xD3, 0x2E, 0x5D, 0x26, 0xB2, 0x15, 0x39, 0x8A, 0xB6, 0x13, 0xFB, 0xF3,
+    0x91, 0xF8, 0x7D, 0xE0, 0x2D, 0x34, 0x3B, 0x0B, 0xB4, 0xFB, 0x38, 0x45, 0xCB, 0x34, 0x5A, 0xA3,
+    0xBC, 0x41, 0xF9, 0x53, 0x14, 0xF5, 0xA8, 0xD3, 0xD3, 0x5E, 0x11, 0xDA, 0x07, 0x44, 0x9A, 0x2C,
+    0x4D, 0xE6, 0x65, 0x0D, 0x13, 0x12, 0xB7, 0x46, 0x20, 0x17, 0x80, 0x58, 0x93, 0x5A, 0x74, 0x06,
+    0x83, 0x26, 0xC3, 0x1E, 0xBE, 0x45, 0xF3, 0xC3, 0x37, 0x09, 0xCC, 0xCA, 0xF1, 0x64, 0x75, 0x6F,
+    0x80, 0x7B, 0x7F, 0xA3, 0x0D, 0xAF, 0x28, 0xF4, 0x9A, 0x3B, 0xA6, 0xEA, 0xD5, 0xFC, 0xDA, 0x8A,
+    0x57, 0xE4, 0x42, 0xA5, 0x0B, 0xD4, 0x58, 0xA6, 0x35, 0x7C, 0x16, 0xA8, 0x29, 0xD5, 0x00, 0x17,
+    0x9B, 0x2F, 0xAE, 0x60, 0x81, 0x3F, 0x92, 0x23, 0x99, 0xB8, 0x89, 0x1B, 0x3B, 0xDA, 0x49, 0x5C,
+    0xB2, 0xB1, 0xD2, 0x4A, 0xD7, 0x88, 0xD2, 0x1E, 0x51, 0x16, 0x13, 0xBD, 0x13, 0xD2, 0x69, 0xF0,
+    0x5B, 0x62, 0x9E, 0x01, 0xD1, 0xD7, 0xC7, 0xB7, 0xCD, 0xA0, 0x1C, 0x0F, 0x67, 0xE0, 0x89, 0xEF,
+    0x6E, 0x11, 0x52, 0x32, 0x7D, 0x19, 0xBE, 0x33, 0x3F, 0x59, 0x98, 0xB6, 0x17, 0xD2, 0xC0, 0xD5,
+    0x94, 0x38, 0xDA, 0x98, 0x0E, 0x0F, 0x12, 0x2E, 0xDB, 0x45, 0x4C, 0xAE, 0x18, 0x91, 0xC0, 0x0F,
+    0xA9, 0x7C, 0x12, 0xB1, 0x24, 0x67, 0x24, 0x89, 0x8A, 0x9F, 0x10, 0x79, 0x58, 0xE4, 0x94, 0x8B,
+    0xCF, 0xD0, 0x35, 0xBC, 0x07, 0xB4, 0x43, 0x09, 0x75, 0xBF, 0x1B, 0x92, 0x80, 0xC5, 0xB6, 0xCE,
+    0xE5, 0xED, 0xAC, 0x35, 0xD1, 0xF3, 0x7C, 0xB1, 0x47, 0x74, 0xB8, 0x19, 0x91, 0x13, 0x83, 0x92,
+    0xA4, 0x2B, 0xB6, 0xAE, 0x8B, 0xD7, 0xE3, 0xA4, 0xB9, 0x6A, 0xC5, 0xBD, 0x5E, 0x8B, 0x54, 0x63,
+    0x00, 0xE1, 0x9B, 0x83, 0x1D, 0xA2, 0xB5, 0x72, 0xE2, 0x9F, 0xB8, 0x41, 0x8D, 0xC6, 0x3A, 0x6D,
+    0xF4, 0xEA, 0xF2, 0x47, 0x3A, 0xAD, 0x59, 0xEF, 0xD8, 0x1A, 0x52, 0x0A, 0x45, 0x07, 0xD6, 0x1D,
+    0x48, 0x00, 0xF1, 0xCA, 0x3D, 0x19, 0x87, 0xE2, 0xDB, 0xE1, 0xAA, 0x50, 0x2D, 0x49, 0x81, 0xA4,
+    0x9D, 0x75, 0x0A, 0xAE, 0x52, 0xF7, 0x55, 0x3D, 0x37, 0x47, 0x74, 0xF6, 0x14, 0x0D, 0x1A, 0xF6,
+    0x6F, 0x12, 0x79, 0x49, 0x77, 0x3C, 0x15, 0xC0, 0x03, 0x3C, 0x92, 0x42, 0x09, 0x38, 0xC6, 0x4B,
+    0xFA, 0xCA, 0xCF, 0xDF, 0xEC, 0x17, 0x87, 0x44, 0x0B, 0xB3, 0x9F, 0xFE, 0x68, 0x38, 0xFA, 0x0F,
+    0x72, 0x2F, 0x5E, 0x86, 0xDC, 0xFE, 0xDF, 0xC3, 0xA4, 0x29, 0x9E, 0x86, 0xDC, 0xE2, 0x62, 0xD2,
+    0x18, 0x88, 0x8B, 0x71, 0x73, 0x20, 0x2E, 0xE9, 0xB5, 0x81, 0x18, 0x43, 0x6E, 0xF1, 0x1D, 0xC8,
+    0x0D, 0x69, 0x1A, 0x0D, 0xF1, 0x4C, 0xDC, 0xAB, 0x7B, 0xB7, 0xB2, 0xB4, 0xB6, 0xB8, 0xF1, 0xEC,
+    0x23, 0xE5, 0x5E, 0xDC, 0xDC, 0xA4, 0x7E, 0x51, 0x28, 0x5C, 0x4A, 0x77, 0x83, 0x74, 0x21, 0xA9,
+    0xA5, 0xB5, 0x9D, 0xBA, 0x9F, 0x59, 0xCA, 0xF8, 0xC6, 0x83, 0xCF, 0x95, 0xBB, 0x46, 0xCE, 0x99,
+    0x2B, 0x74, 0xB6, 0x24, 0x70, 0x99, 0xAF, 0xBF, 0x48, 0xEE, 0x07, 0x1A, 0xEC, 0xE6, 0xB1, 0x7D,
+    0xF8, 0x08, 0xA2, 0x3A, 0x3B, 0x9C, 0x13, 0xAA, 0x9A, 0xAD, 0xFA, 0x05, 0x96, 0x11, 0x5D, 0x21,
+    0xE7, 0xA3, 0xD8, 0xBD, 0x91, 0x5A, 0x36, 0xB6, 0x5C, 0x13, 0x94, 0x7E, 0x41, 0xE1, 0x8F, 0xB3,
+    0x8E, 0x6E, 0x89, 0xD0, 0xBF, 0x4B, 0x73, 0x1B, 0xC4, 0xFB, 0x29, 0xC2, 0x55, 0x6A, 0x30, 0xF5,
+    0xB3, 0xF0, 0xA6, 0x7D, 0x8A, 0xB0, 0xBB, 0xFB, 0x70, 0x89, 0xCC, 0x4A, 0x29, 0xB5, 0x53, 0x2B,
+    0x75, 0x12, 0x3B, 0x75, 0x62, 0x07, 0x8E, 0xE2, 0xC4, 0xAE, 0x76, 0x63, 0x19, 0x8A, 0xD8, 0x0F,
+    0xE5, 0x67, 0xBF, 0xF8, 0x53, 0x6D, 0x78, 0x33, 0x5B, 0xA9, 0x1C, 0xBE, 0x8D, 0xD1, 0xE5, 0x11,
+    0xC2, 0x83, 0xF1, 0x2D, 0x8B, 0x22, 0xE9, 0x8E, 0xBF, 0x47, 0xC3, 0xC3, 0x15, 0x8C, 0x65, 0x2A,
+    0x30, 0x86, 0xD5, 0xE8, 0x62, 0x78, 0x18, 0xD6, 0xF3, 0xCB, 0x30, 0xFE, 0xFF, 0x30, 0x56, 0xC0,
+    0x65, 0xD7, 0x53, 0xD6, 0xA1, 0x8C, 0x9F, 0x18, 0x8D, 0xE0, 0x2C, 0x88, 0xF3, 0x14, 0x52, 0xEE,
+    0x2C, 0x66, 0xDD, 0x3D, 0xC8, 0x9D, 0x7B, 0xD9, 0x29, 0x48, 0x6B, 0xA5, 0x76, 0x02, 0x49, 0x61,
+    0xF8, 0xED, 0x7B, 0x9B, 0x97, 0xAD, 0x31, 0x89, 0x57, 0xF4, 0xAA, 0xA3, 0xDB, 0x50, 0xD8, 0xD5,
+    0x81, 0x08, 0xE1, 0x2B, 0x7E, 0x44, 0xD6, 0x06, 0x59, 0x96, 0x82, 0x2B, 0xD8, 0x3A, 0xB1, 0xD2,
+    0x8C, 0xF2, 0x80, 0xF2, 0xC8, 0xF9, 0x30, 0x13, 0x37, 0xF5, 0x8A, 0xA0, 0x46, 0xBD, 0x32, 0x74,
+    0x0E, 0xB8, 0x80, 0xC3, 0x4B, 0x02, 0x65, 0x5C, 0x4B, 0xE1, 0xEE, 0xB0, 0x48, 0x42, 0x76, 0x62,
+    0xC3, 0xE4, 0xB1, 0x0B, 0x38, 0xD1, 0x35, 0xDA, 0x70, 0x75, 0xCB, 0x49, 0xB6, 0xEF, 0x0D, 0x64,
+    0xBC, 0x79, 0x39, 0xF9, 0x26, 0x6F, 0xC6, 0xCF, 0xB0, 0x1D, 0xF6, 0xCB, 0x9A, 0x56, 0x4E, 0x8B,
+    0x90, 0x9A, 0x08, 0x6B, 0xEC, 0x8B, 0x54, 0x56, 0x0C, 0xFC, 0x70, 0x42, 0x1A, 0xC2, 0x3E, 0xB4,
+    0xA9, 0x26, 0x3C, 0x5C, 0x0E, 0xAA, 0x05, 0xE6, 0xD1, 0x62, 0x1E, 0x03, 0xF0, 0xC0, 0x4A, 0xA8,
+    0x11, 0x82, 0x07, 0x76, 0xD5, 0xD1, 0x2B, 0x4B, 0xCA, 0xD5, 0xCD, 0x83, 0x74, 0xFB, 0xDE, 0x27,
+    0xC9, 0xFE, 0xE6, 0xB3, 0x3A, 0x7C, 0x9B, 0xC0, 0x3B, 0xA5, 0x1A, 0x61, 0x61, 0x9D, 0xFF, 0xBE,
+    0x46, 0x30, 0x4F, 0x42, 0x83, 0x0B, 0xD8, 0xA1, 0xF0, 0xB6, 0x80, 0xE9, 0xE1, 0x6C, 0x73, 0xE0,
+    0xF1, 0x22, 0x58, 0xB8, 0x1F, 0x6B, 0xBA, 0x0D, 0x47, 0xB1, 0xB5, 0x0D, 0xD3, 0x28, 0x12, 0xA1,
+    0x24, 0xEB, 0x90, 0x35, 0xDA, 0xC6, 0x83, 0xF8, 0x99, 0xD0, 0x05, 0xF1, 0x5B, 0x7D, 0xF6, 0x9A,
+    0xBC, 0xA4, 0xF2, 0xCE, 0xDD, 0x9A, 0x93, 0xCD, 0x6D, 0xB4, 0x16, 0x10, 0xE4, 0x83, 0xB5, 0x14,
+    0x1C, 0x7E, 0x9A, 0x92, 0x73, 0xE3, 0x06, 0xF0, 0xCF, 0x2D, 0xC6, 0x60, 0x83, 0x98, 0x68, 0xB2,
+    0x2F, 0xA5, 0xE4, 0x33, 0xAA, 0x2C, 0xC2, 0x94, 0x21, 0xB9, 0xB8, 0x9D, 0xB0, 0x6E, 0x1C, 0x97,
+    0xE0, 0x48, 0xEC, 0x8E, 0x35, 0xA2, 0x3B, 0x40, 0x0F, 0xF6, 0x85, 0xC0, 0x40, 0x53, 0x46, 0x71,
+    0x6E, 0xA5, 0x91, 0x93, 0x74, 0x7F, 0x15, 0xCE, 0xBF, 0x35, 0x89, 0x36, 0xC1, 0x18, 0xEB, 0x98,
+    0xE0, 0x60, 0x60, 0xA1, 0xA7, 0x26, 0x37, 0x0C, 0x20, 0x59, 0x3C, 0x39, 0x8C, 0x6B, 0x22, 0xC2,
+    0xB4, 0x12, 0x30, 0xB2, 0xF2, 0xC4, 0x30, 0x41, 0x09, 0x7C, 0xCE, 0xD6, 0x1D, 0xAC, 0x50, 0x98,
+    0x24, 0xBB, 0x1F, 0xB0, 0x96, 0x43, 0xC5, 0x23, 0x63, 0x73, 0x18, 0x45, 0x2A, 0xEC, 0x16, 0x7B,
+    0x2C, 0x79, 0xBA, 0x3F, 0xB2, 0x8A, 0xEC, 0x21, 0xC6, 0x92, 0x2A, 0xA8, 0xA6, 0xDB, 0x27, 0xC5,
+    0x17, 0x60, 0x00, 0x90, 0xE5, 0x8D, 0x79, 0x05, 0x21, 0xBF, 0x62, 0x85, 0xC7, 0xCF, 0x97, 0xA1,
+    0x45, 0x64, 0x08, 0xF1, 0x15, 0x24, 0x32, 0xBA, 0x70, 0xFE, 0xF8, 0x59, 0xCE, 0xB3, 0x5A, 0xF2,
+    0x26, 0xB6, 0x55, 0x3E, 0xA3, 0x69, 0xF6, 0x75, 0x7C, 0x5A, 0x1A, 0x30, 0x3B, 0x64, 0xA2, 0xF0,
+    0x3E, 0xAA, 0x39, 0x93, 0xBF, 0xEC, 0xD1, 0xB1, 0xB1, 0x2C, 0x8A, 0x82, 0x9D, 0xF6, 0xEA, 0x67,
+    0xCF, 0xF1, 0xD7, 0x37, 0x18, 0x1D, 0x88, 0x3E, 0x4D, 0x08, 0x7A, 0xDB, 0xEF, 0xC6, 0x04, 0x1B,
+    0x38, 0x97, 0x8C, 0xFA, 0x35, 0xE3, 0x6D, 0x54, 0x2F, 0xBF, 0x7A, 0xB2, 0x60, 0x49, 0x12, 0xF9,
+    0xDA, 0x06, 0x07, 0xB8, 0x67, 0xDC, 0x91, 0xF9, 0x41, 0x30, 0xD4, 0x2B, 0x26, 0x0F, 0x74, 0x38,
+    0x92, 0x52, 0xA0, 0x2A, 0xF2, 0x7F, 0x8C, 0x08, 0xAA, 0x91, 0x1B, 0x5B, 0x87, 0x9B, 0xBB, 0xD4,
+    0x1F, 0x01, 0x59, 0xAB, 0x64, 0x65, 0x17, 0x09, 0xF9, 0x3F, 0x1C, 0xD1, 0x88, 0x22, 0xA4, 0xE5,
+    0x00, 0xD4, 0x2F, 0xC8, 0x0A, 0x7E, 0x19, 0x8A, 0x77, 0x2B, 0x77, 0x8B, 0x66, 0x06, 0xEB, 0xCC,
+    0x2C, 0x7C, 0xE5, 0x28, 0xF9, 0xD7, 0x6D, 0xB2, 0x58, 0x14, 0xA4, 0x40, 0xF2, 0xE0, 0x25, 0x08,
+    0x6C, 0x4E, 0x26, 0x16, 0xD2, 0x84, 0x7D, 0x38, 0xDD, 0x32, 0x7E, 0xCC, 0xC0, 0x7B, 0x19, 0x2E,
+    0x8E, 0xAA, 0xAE, 0x0F, 0x0B, 0x14, 0x19, 0xDE, 0x7B, 0x2F, 0x84, 0x30, 0x0B, 0x2E, 0x4A, 0x05,
+    0x93, 0x7B, 0x64, 0x97, 0xFC, 0xCB, 0xC9, 0x28, 0xD3, 0x65, 0x38, 0xDA, 0x05, 0x1C, 0x95, 0x94,
+    0xF2, 0xE9, 0x94, 0xD1, 0x29, 0x86, 0xD4, 0x3A, 0x2A, 0x1C, 0x46, 0x95, 0xCF, 0x36, 0x33, 0x4E,
+    0x8D, 0xE9, 0x94, 0x31, 0x2F, 0xB2, 0xD9, 0xA4, 0x2E, 0x7B, 0xEC, 0x02, 0x9D, 0x10, 0x5F, 0x97,
+    0x59, 0x7A, 0xFC, 0x73, 0x07, 0x99, 0x86, 0xE2, 0xE5, 0xE3, 0xE7, 0xBB, 0xF7, 0x04, 0x5C, 0x34,
+    0x8D, 0x78, 0xDA, 0x9F, 0x8D, 0x96, 0x63, 0x55, 0x15, 0x8F, 0x0B, 0x4E, 0x62, 0x44, 0x06, 0x7E,
+    0x87, 0x87, 0xE4, 0xC1, 0xCD, 0x43, 0x76, 0x77, 0xCF, 0xDC, 0xF5, 0x0D, 0xF5, 0xB6, 0x71, 0x1A,
+    0xD0, 0x1D, 0x55, 0x30, 0x0E, 0x7A, 0xA0, 0xE6, 0xA6, 0xA0, 0x54, 0x89, 0xC9, 0x32, 0x40, 0x6E,
+    0x2B, 0x79, 0xE0, 0x1D, 0xA0, 0xC6, 0xE4, 0x98, 0x1E, 0x13, 0x64, 0x8A, 0x46, 0x5E, 0xBF, 0x5A,
+    0xDE, 0xAE, 0x7C, 0x91, 0xE5, 0x1D, 0xD1, 0xB4, 0x76, 0x05, 0x6D, 0x26, 0xCE, 0xD4, 0xA7, 0xE4,
+    0x9D, 0x8C, 0x44, 0x4E, 0x4F, 0xD6, 0x69, 0xEB, 0xF4, 0x57, 0x97, 0xF3, 0xDC, 0x63, 0x5C, 0xF2,
+    0x22, 0xE8, 0xBD, 0x19, 0xEB, 0xFE, 0x9F, 0x64, 0x1C, 0x16, 0xF7, 0xF0, 0xF0, 0x7B, 0x43, 0xA6,
+    0x24, 0x35, 0xEF, 0x52, 0xC2, 0xBB, 0x84, 0x1C, 0xC9, 0x6B, 0x7D, 0x06, 0x1F, 0x84, 0x73, 0x26,
+    0x8A, 0xB1, 0x95, 0x59, 0x77, 0x2E, 0xE3, 0x46, 0xC4, 0x65, 0x34, 0x0A, 0x8C, 0x04, 0x13, 0xA2,
+    0x16, 0x55, 0x46, 0x88, 0x95, 0x5D, 0x3C, 0x63, 0x8D, 0xB0, 0x4B, 0x2F, 0x24, 0x20, 0x5C, 0x36,
+    0x0C, 0xC6, 0x9C, 0x02, 0xED, 0x09, 0xA3, 0x37, 0xEF, 0xDB, 0x19, 0x31, 0x85, 0xEF, 0xA1, 0xE6,
+    0x6A, 0xDD, 0x8B, 0xE9, 0x3A, 0x5C, 0xC3, 0x14, 0x29, 0x32, 0xE3, 0x3A, 0x71, 0x25, 0xE7, 0x7A,
+    0xAE, 0x1E, 0x11, 0xFA, 0x85, 0x7A, 0x87, 0xDB, 0x90, 0xA6, 0xCF, 0xD9, 0xB5, 0xE1, 0xA9, 0x84,
+    0xD1, 0x47, 0x63, 0xBF, 0x07, 0xEE, 0x1F, 0xB0, 0xF1, 0x89, 0xF3, 0x0F, 0x9E, 0xED, 0x4F, 0x43,
+    0x76, 0x82, 0xCF, 0x15, 0xB7, 0x3C, 0x43, 0x04, 0xBF, 0x66, 0xFC, 0x70, 0xCD, 0xDC, 0x1F, 0xD1,
+    0xEA, 0xD4, 0x62, 0x6C, 0x0D, 0xD3, 0xE2, 0x94, 0x50, 0x60, 0x4F, 0xA0, 0x60, 0x9E, 0xFD, 0xCF,
+    0xDF, 0xCC, 0xD9, 0x46, 0x1D, 0xD6, 0xCD, 0x63, 0xB5, 0x60, 0x0D, 0x76, 0x5C, 0x98, 0x53, 0xEA,
+    0x2E, 0x1B, 0xE7, 0x3A, 0x4F, 0x5C, 0x0D, 0xAB, 0x88, 0xAD, 0x1C, 0x31, 0x4C, 0x45, 0x8C, 0x53,
+    0x01, 0x1B, 0xB8, 0x5D, 0x9A, 0x0C, 0x08, 0x2B, 0xE3, 0x3E, 0xCC, 0x6C, 0x20, 0xF6, 0xD4, 0x83,
+    0xED, 0x62, 0x9B, 0x1B, 0x88, 0x2A, 0x99, 0xAF, 0xD1, 0x49, 0x32, 0xF7, 0xD8, 0xEA, 0x7D, 0x66,
+    0xFE, 0x89, 0xF1, 0xF2, 0xDE, 0x09, 0x31, 0x3F, 0xC3, 0x8A, 0x8F, 0x81, 0x7D, 0xEE, 0x36, 0x5C,
+    0x70, 0xCE, 0x4E, 0x4E, 0x88, 0xEF, 0xDE, 0x16, 0x1B, 0x3C, 0x67, 0x00, 0xCE, 0x66, 0x11, 0xE9,
+    0xD8, 0x8D, 0xDD, 0xA0, 0xB5, 0x27, 0x69, 0x5F, 0x3C, 0x9D, 0xD8, 0x1F, 0x84, 0x74, 0x97, 0x13,
+    0x98, 0xFD, 0xB1, 0x12, 0x37, 0xE2, 0x75, 0x7A, 0xBB, 0xC9, 0x2E, 0x6E, 0x10, 0x81, 0xE5, 0xF8,
+    0x0B, 0xCB, 0x61, 0x62, 0xFD, 0x3A, 0xCB, 0x51, 0x40, 0x0E, 0xE7, 0x55, 0xC8, 0xE1, 0xB2, 0x1C,
+    0x0B, 0x2C, 0x47, 0x93, 0xE5, 0x18, 0x40, 0x0E, 0x4B, 0x43, 0x0E, 0x07, 0xDD, 0x6C, 0x54, 0x63,
+    0x39, 0xEA, 0x2C, 0x47, 0x0F, 0x72, 0x74, 0x62, 0x96, 0x23, 0x9C, 0xC8, 0x51, 0x63, 0x39, 0x9A,
+    0x0F, 0x36, 0xDD, 0x49, 0xA6, 0x65, 0x29, 0x27, 0x02, 0x9A, 0x24, 0x82, 0x7E, 0x61, 0x15, 0xC9,
+    0x79, 0x20, 0x29, 0x0A, 0x73, 0x88, 0x24, 0x78, 0x82, 0xFE, 0x4D, 0x9E, 0x1A, 0x8C, 0x24, 0xBD,
+    0xB2, 0x6E, 0xF0, 0xF9, 0xE1, 0x0E, 0x97, 0xE6, 0x6D, 0x0E, 0xAF, 0x80, 0xA3, 0x2B, 0xE0, 0xE0,
+    0x8A, 0xB8, 0x58, 0x8E, 0xB8, 0x74, 0xDF, 0x65, 0x5F, 0xF6, 0x5F, 0x83, 0x69, 0xDC, 0x22, 0x79,
+    0xA8, 0x50, 0x2A, 0x8B, 0x62, 0x86, 0x25, 0xD3, 0x5E, 0x51, 0xEF, 0x44, 0x99, 0x77, 0x0D, 0xBE,
+    0xC0, 0xE7, 0xED, 0x3F, 0xC2, 0xE7, 0xE7, 0x69, 0xEF, 0x64, 0x98, 0xDB, 0x17, 0xC1, 0x52, 0xBC,
+    0x8B, 0xDF, 0xE2, 0x66, 0x3C, 0x23, 0xCE, 0xC9, 0x28, 0xED, 0x4E, 0x2D, 0x6E, 0xFC, 0x6C, 0x6B,
+    0x62, 0x8B, 0xB1, 0x53, 0x84, 0x32, 0x81, 0x27, 0x62, 0xC1, 0x35, 0xF6, 0x35, 0x34, 0x81, 0x29,
+    0x88, 0x52, 0xE6, 0x72, 0x66, 0xE0, 0xC2, 0x24, 0x68, 0x72, 0xBE, 0x18, 0xF0, 0x6A, 0x5D, 0x15,
+    0x53, 0x5F, 0xCC, 0xD1, 0xED, 0x09, 0x80, 0x5A, 0x5C, 0x5A, 0x95, 0x07, 0x02, 0xC3, 0xF1, 0x4C,
+    0x06, 0xBA, 0x8F, 0x7C, 0xF6, 0x7A, 0x6A, 0xA2, 0xC5, 0xC7, 0xEA, 0x8E, 0x39, 0xBA, 0xEA, 0xE0,
+    0x91, 0x0E, 0xAE, 0xA0, 0x47, 0xE5, 0x37, 0xFA, 0xAC, 0x62, 0xAC, 0x1E, 0x95, 0x25, 0xA9, 0x3C,
+    0xBB, 0x81, 0xFC, 0x19, 0xF3, 0x0A, 0x98, 0x57, 0x8B, 0xD3, 0x72, 0x40, 0x73, 0x99, 0x15, 0x21,
+    0x41, 0xF4, 0xDF, 0x24, 0x6E, 0x77, 0xC9, 0xFE, 0x04, 0x8F, 0x39, 0x1F, 0xF2, 0x14, 0xE7, 0x5C,
+    0xF0, 0x0D, 0x19, 0x56, 0x91, 0x46, 0x44, 0x08, 0xDD, 0x24, 0x53, 0x97, 0xDF, 0x82, 0x1D, 0xBD,
+    0x55, 0x6E, 0xF3, 0x3C, 0xF8, 0xE1, 0xBA, 0x5B, 0xA8, 0x52, 0xFE, 0xD6, 0xB4, 0x20, 0xCC, 0x26,
+    0x95, 0x52, 0x5F, 0xCD, 0x66, 0x07, 0x4E, 0x0E, 0x62, 0x26, 0x35, 0x2C, 0xDD, 0x22, 0x3A, 0x18,
+    0x82, 0x93, 0x0F, 0xCA, 0xEB, 0x50, 0x8C, 0x95, 0x62, 0xF1, 0x02, 0x90, 0x89, 0x4A, 0xA5, 0x90,
+    0x1F, 0x73, 0x3B, 0xA3, 0xE8, 0xB1, 0x8C, 0xAE, 0xEF, 0x1C, 0x68, 0x3F, 0x19, 0xAA, 0x07, 0x9B,
+    0xF2, 0x88, 0xDA, 0xE2, 0xA8, 0x34, 0xF9, 0x08, 0x0B, 0x99, 0x92, 0x5A, 0xD0, 0xE6, 0xF6, 0xE3,
+    0x47, 0xA7, 0xC9, 0x88, 0x31, 0xBC, 0xA9, 0xAC, 0x0F, 0x0A, 0x14, 0xED, 0xFB, 0x47, 0xA7, 0xB7,
+    0x75, 0x0E, 0xE6, 0x85, 0x31, 0x1F, 0x9C, 0xA5, 0x1D, 0x8D, 0x1E, 0x9F, 0x2D, 0xF1, 0xD1, 0x5D,
+    0x13, 0x6E, 0xDD, 0x58, 0x2E, 0xF5, 0x96, 0xE9, 0xD1, 0xE9, 0x2E, 0x85, 0x4B, 0xA1, 0x75, 0xF0,
+    0xEB, 0xFB, 0x19, 0xBC, 0x47, 0x8F, 0xA4, 0x92, 0x2A, 0xEA, 0x82, 0x42, 0x0E, 0x02, 0x36, 0x8A,
+    0xD9, 0x00, 0x17, 0xB9, 0xC6, 0xCA, 0xCB, 0x8A, 0x8C, 0x53, 0x06, 0xF7, 0x62, 0x91, 0x13, 0x50,
+    0xD8, 0x7D, 0xBE, 0xFB, 0x9C, 0xF6, 0x32, 0x31, 0x39, 0x15, 0x5D, 0xDA, 0xB3, 0xEE, 0xE7, 0xAE,
+    0x8E, 0xA4, 0x6A, 0xF9, 0x74, 0xA6, 0x3D, 0x53, 0xC7, 0xE5, 0xE6, 0x0F, 0x7E, 0xE4, 0x39, 0xCD,
+    0xCB, 0x63, 0xD3, 0xCB, 0x05, 0xEC, 0x8A, 0x8B, 0x19, 0xF9, 0x25, 0x4A, 0xB4, 0x4D, 0xF1, 0x86,
+    0x6A, 0xD6, 0x0E, 0x4B, 0xC1, 0x2C, 0x16, 0x0A, 0x22, 0x45, 0x2C, 0x0E, 0x84, 0xF1, 0x74, 0x71,
+    0x58, 0x11, 0x7C, 0x88, 0x5A, 0xF5, 0x6A, 0xB3, 0x3F, 0xA3, 0xCF, 0x9A, 0xA7, 0xAF, 0xF2, 0x38,
+    0xC2, 0x00, 0xED, 0x02, 0x9A, 0x85, 0xB2, 0x55, 0xF8, 0x52, 0x8F, 0x63, 0xAF, 0x61, 0xAF, 0xE9,
+    0x4E, 0x7F, 0x39, 0xD6, 0xC8, 0xBD, 0x21, 0x70, 0x08, 0xE0, 0xBC, 0xA8, 0xB6, 0xB5, 0xD0, 0x22,
+    0xE4, 0x83, 0x56, 0xAF, 0xDA, 0xC5, 0x16, 0xDE, 0x9D, 0x5E, 0x65, 0xA1, 0xEA, 0x1C, 0x26, 0xA9,
+    0x02, 0x73, 0x51, 0xD1, 0xB6, 0x66, 0x1C, 0x15, 0xA6, 0x8E, 0x96, 0x54, 0x95, 0xD2, 0x65, 0x1D,
+    0xDD, 0x32, 0x9F, 0x4E, 0x6F, 0x62, 0x5E, 0xB8, 0xD0, 0x88, 0x7B, 0x6B, 0x29, 0x69, 0x8D, 0xFB,
+    0x6A, 0x3E, 0x39, 0x3C, 0x6F, 0xAA, 0x6B, 0xD4, 0x23, 0xC0, 0x07, 0xF4, 0x10, 0xAE, 0x2E, 0xEB,
+    0x80, 0x8A, 0x1A, 0x7F, 0x7E, 0x4C, 0xC2, 0x94, 0x0E, 0x4F, 0x9C, 0x8B, 0x3A, 0xFB, 0xED, 0x92,
+    0xEB, 0x7F, 0x93, 0x92, 0xAE, 0xA1, 0xB9, 0xD9, 0xBE, 0x5A, 0x42, 0xDB, 0x3A, 0xC6, 0xED, 0xA0,
+    0xDC, 0x9E, 0xA5, 0x5F, 0x92, 0x7D, 0x9F, 0x73, 0x7C, 0xB7, 0x7A, 0x92, 0x0F, 0xE3, 0x3D, 0x03,
+    0x95, 0x23, 0xF6, 0x39, 0xAC, 0xC9, 0x8D, 0xCF, 0xA2, 0xD6, 0xE6, 0xF3, 0xA8, 0xA2, 0x0A, 0x77,
+    0x8E, 0xCD, 0xFE, 0x8D, 0x90, 0xDE, 0x47, 0x6C, 0xAA, 0x32, 0x36, 0x17, 0xD5, 0x1B, 0xD4, 0xFF,
+    0xDD, 0x98, 0xC4, 0x9F, 0x51, 0x82, 0xA4, 0x1E, 0x4A, 0x16, 0x8C, 0x70, 0x1D, 0xD4, 0xDA, 0xA0,
+    0xD4, 0x32, 0x90, 0xDB, 0x06, 0xA5, 0x96, 0x01, 0xCF, 0x1C, 0xF3, 0x9D, 0xBD, 0xDC, 0x9C, 0x6B,
+    0xCE, 0x40, 0x12, 0x97, 0xA0, 0xC8, 0x26, 0x34, 0x39, 0xBF, 0x59, 0xDA, 0x23, 0x78, 0x30, 0xCC,
+    0xD0, 0x31, 0xC7, 0xE6, 0x1D, 0x43, 0x8D, 0xAB, 0x1F, 0xAF, 0x92, 0xAF, 0x5B, 0xC9, 0x18, 0x55,
+    0x32, 0x02, 0x6E, 0xC7, 0xB3, 0xB9, 0x27, 0x2D, 0x63, 0xB2, 0x85, 0x44, 0x12, 0x3F, 0x7E, 0x74,
+    0x9A, 0x95, 0xDE, 0xD6, 0x8C, 0xDE, 0x47, 0xA2, 0xC7, 0x98, 0x94, 0xB7, 0xBF, 0x80, 0x49, 0x47,
+    0xD3, 0xB9, 0x65, 0x4E, 0x28, 0x26, 0x65, 0xFC, 0xE4, 0x5C, 0xDE, 0xBC, 0xCE, 0x4E, 0x7C, 0xD0,
+    0xBC, 0x2E, 0xD0, 0xFC, 0x1B, 0x68, 0x72, 0x86, 0xE8, 0x91, 0xD0, 0x06, 0xC7, 0x9E, 0x96, 0xE1,
+    0x0F, 0xB4, 0x54, 0xEF, 0xC7, 0xBE, 0xF3, 0xB2, 0xEE, 0x0A, 0xA1, 0x3B, 0xCB, 0x52, 0x77, 0x7A,
+    0x52, 0x75, 0x81, 0x62, 0x7E, 0xD8, 0x26, 0xF9, 0x52, 0x46, 0xAB, 0xE8, 0x9C, 0x7B, 0xB3, 0xD9,
+    0x7D, 0xF7, 0xDF, 0xB3, 0xD3, 0xA2, 0x9A, 0x53, 0x7D, 0x50, 0x13, 0xA0, 0xC6, 0xE7, 0xA2, 0x52,
+    0xC1, 0x13, 0x20, 0xB9, 0x07, 0x5D, 0xFC, 0x2A, 0xF9, 0xB6, 0xA1, 0x4B, 0x0B, 0xB8, 0x15, 0x9C,
+    0xDE, 0xA7, 0xCE, 0xF7, 0xEF, 0xEC, 0xF9, 0xC9, 0x8C, 0x27, 0x98, 0x3A, 0x29, 0x7A, 0x28, 0x3B,
+    0x1D, 0x99, 0x26, 0x67, 0x27, 0xF4, 0xBB, 0xDC, 0xF0, 0xD2, 0xD6, 0x63, 0x47, 0xA7, 0xF9, 0x88,
+    0xCE, 0xF7, 0xE8, 0x7A, 0x57, 0x75, 0x92, 0x89, 0xEA, 0xB7, 0x19, 0x1F, 0xF4, 0x94, 0x34, 0x6C,
+    0xEB, 0x6B, 0x19, 0xF3, 0x11, 0x39, 0xA6, 0x04, 0xA8, 0x6A, 0xA7, 0x7C, 0xC8, 0x90, 0xF1, 0x94,
+    0x73, 0xCC, 0x44, 0xBC, 0x05, 0x01, 0x97, 0x4D, 0x6D, 0x2E, 0xB4, 0x3A, 0xDC, 0xDC, 0x72, 0x15,
+    0x84, 0x48, 0x9C, 0x10, 0xAE, 0x4D, 0x8B, 0x8D, 0xAC, 0x2A, 0xCC, 0x16, 0x39, 0xE9, 0xF8, 0xD9,
+    0xE4, 0xF4, 0xB4, 0xF3, 0x85, 0x1E, 0x3D, 0x58, 0x42, 0x99, 0x50, 0x68, 0xFA, 0xE7, 0x33, 0x09,
+    0x1D, 0xA0, 0x8D, 0xCE, 0x51, 0xA1, 0xF1, 0xFB, 0xA1, 0xFF, 0x5D, 0x00, 0x7B, 0xA0, 0x31, 0xC7,
+    0xBA, 0x0C, 0x23, 0x73, 0x4C, 0xEE, 0x55, 0x4E, 0x31, 0x21, 0x75, 0x9D, 0xC3, 0x26, 0x9E, 0x98,
+    0xCD, 0xD8, 0xED, 0xA1, 0x23, 0x83, 0x13, 0x51, 0xF0, 0x5F, 0xC5, 0x5A, 0x4B, 0x8C, 0x1C, 0x57,
     0x15, 0xBD, 0x55, 0xE5, 0x71, 0xC5, 0xAE, 0xD8, 0xE5, 0x85, 0x2D, 0x42, 0xFC, 0x29, 0x2F, 0x58,
     0x58, 0xD1, 0x78, 0xCA, 0x8B, 0x41, 0xCC, 0xA2, 0x3F, 0x95, 0x44, 0x88, 0x05, 0x0B, 0x06, 0x29,
     0x23, 0x47, 0x42, 0x22, 0x2C, 0x58, 0x20, 0x36, 0xB1, 0x84, 0x17, 0x5E, 0xB4, 0xDD, 0x25, 0xB1,
@@ -1619,320 +1643,300 @@ static const uint8_t notoserif_12_italicBitmaps[30784] = {
     0xBA, 0x57, 0x3C, 0x7A, 0xAB, 0x5E, 0xA5, 0x2D, 0x59, 0x83, 0x58, 0x4E, 0xF6, 0x4E, 0xD4, 0x7A,
     0x4A, 0x51, 0xA0, 0x69, 0xCD, 0xAF, 0x5C, 0xAA, 0x3D, 0x3C, 0x36, 0xB7, 0x85, 0xD1, 0x9F, 0xAE,
     0x06, 0xA3, 0x27, 0xD7, 0xB7, 0x0A, 0xCD, 0x08, 0xCF, 0x7C, 0x97, 0xA0, 0xBB, 0x60, 0xA5, 0x38,
-    0xDE, 0x7F, 0x01, 0x95, 0x57, 0x4F, 0x68, 0x24, 0x59, 0x19, 0xFF, 0x55, 0xD5, 0x64, 0xDE, 0x98,
-    0xB2, 0xFB, 0xE5, 0x30, 0x0B, 0xCA, 0x26, 0x5D, 0x83, 0x8C, 0xD0, 0x2C, 0x9D, 0x74, 0x84, 0x88,
-    0x8D, 0x74, 0xD2, 0xB5, 0xBB, 0x87, 0x3D, 0x28, 0x6E, 0x0E, 0xDB, 0x5E, 0xE6, 0xE0, 0x1C, 0xF6,
-    0x34, 0x88, 0x3B, 0x0B, 0x39, 0x34, 0x6C, 0x27, 0x5D, 0xEC, 0x1C, 0xF6, 0xE0, 0x25, 0xE0, 0x55,
-    0x30, 0xA0, 0xA0, 0x04, 0xC1, 0x1C, 0x22, 0x44, 0xE8, 0x49, 0x3D, 0x77, 0x0E, 0x1E, 0xBC, 0xD4,
-    0x0A, 0x5E, 0xFC, 0x5B, 0xBA, 0x83, 0x20, 0x22, 0x5B, 0x2B, 0x7D, 0xE8, 0xC5, 0x4A, 0xCA, 0xDF,
-    0xF7, 0xAA, 0x7A, 0x3A, 0xD9, 0xD1, 0x99, 0xF8, 0xDE, 0xFB, 0xBA, 0xFE, 0x7D, 0xEF, 0x7D, 0xDF,
-    0xFB, 0xFE, 0xFC, 0xBE, 0xD7, 0xDB, 0x07, 0x4F, 0x35, 0x00, 0x77, 0xF7, 0x5F, 0x8A, 0x34, 0xDA,
-    0xD1, 0xBD, 0xFD, 0x45, 0x3C, 0xAB, 0x4B, 0xF3, 0x42, 0x24, 0x71, 0x76, 0x90, 0xFC, 0x10, 0x07,
-    0xCF, 0xEC, 0xD2, 0x14, 0x96, 0xD1, 0x9B, 0x2E, 0x37, 0x55, 0x13, 0xCF, 0xEE, 0x18, 0xE5, 0x71,
-    0x3E, 0xFB, 0x8D, 0x8B, 0x02, 0x87, 0x87, 0x87, 0x78, 0xA1, 0xDF, 0xDF, 0xEE, 0x15, 0x45, 0x2A,
-    0x2B, 0xF1, 0xBE, 0x5F, 0x3E, 0xB2, 0x65, 0x28, 0xDB, 0x7F, 0x7D, 0x79, 0xB4, 0xF1, 0xFF, 0xF6,
-    0x85, 0x7E, 0x1F, 0x6D, 0xCA, 0x2C, 0x97, 0x7C, 0x03, 0xA3, 0x22, 0xB7, 0xF7, 0x4E, 0xE4, 0x87,
-    0x2D, 0x74, 0xB0, 0x87, 0x11, 0xD6, 0xD0, 0x40, 0x2F, 0x6C, 0x47, 0x2A, 0x54, 0x68, 0x41, 0x54,
-    0x0A, 0xC2, 0xB6, 0xD1, 0xC6, 0x8B, 0x14, 0x86, 0xD8, 0x46, 0x63, 0x74, 0x9A, 0x1D, 0x6C, 0xD4,
-    0x39, 0xE7, 0xAE, 0xFF, 0x4A, 0xD2, 0xF2, 0xD1, 0xA9, 0x63, 0x2F, 0x88, 0x46, 0x81, 0x59, 0xF3,
-    0xA3, 0x86, 0x8A, 0x7A, 0xAF, 0x27, 0xED, 0xEF, 0xA6, 0xEA, 0xE5, 0x44, 0x39, 0x86, 0x5F, 0xD3,
-    0x8E, 0x08, 0x08, 0x5E, 0x4B, 0xDA, 0xBF, 0xCE, 0xF4, 0xA3, 0xCC, 0x8B, 0x52, 0xBE, 0x1F, 0x06,
-    0xD8, 0xBE, 0x09, 0x32, 0x73, 0xD6, 0x69, 0x3B, 0xCA, 0xBA, 0x38, 0x68, 0x62, 0xA3, 0x86, 0xBA,
-    0x17, 0x09, 0xB7, 0x0E, 0xA1, 0x81, 0x3A, 0xB0, 0x02, 0x9A, 0xF5, 0xF3, 0xCD, 0x37, 0x7B, 0xC5,
-    0x74, 0x69, 0x63, 0x09, 0x27, 0xC0, 0x14, 0xCE, 0x04, 0x4E, 0x06, 0x27, 0x85, 0x9B, 0xC0, 0x35,
-    0xE0, 0x0C, 0xFA, 0xC9, 0x13, 0x0F, 0xE0, 0x3A, 0xF0, 0x19, 0xE0, 0x86, 0x2C, 0x31, 0x21, 0x89,
-    0x9D, 0x44, 0x7F, 0x03, 0xE7, 0x6F, 0xBF, 0x33, 0xEE, 0xBF, 0x3F, 0xB2, 0xDC, 0xF0, 0x0D, 0x25,
-    0x44, 0x76, 0x02, 0x16, 0x60, 0xA7, 0xA0, 0x46, 0xDA, 0x22, 0x6D, 0x02, 0x4B, 0x54, 0xB8, 0x57,
-    0x4C, 0xF0, 0xC5, 0xB7, 0xEF, 0x02, 0xF7, 0xAB, 0x65, 0x48, 0x94, 0x88, 0xEB, 0x61, 0x6F, 0x22,
-    0x9E, 0x8B, 0xF3, 0x51, 0xDE, 0x9B, 0x2C, 0xEE, 0xDF, 0xB2, 0xB3, 0x7A, 0x29, 0x7A, 0xE7, 0x76,
-    0xA4, 0xF2, 0x78, 0xCB, 0x9A, 0xF4, 0x76, 0x9E, 0x0F, 0x6E, 0x63, 0x3F, 0x77, 0x27, 0xB9, 0x37,
-    0x19, 0x38, 0xD6, 0xB5, 0x18, 0x3B, 0x99, 0x4A, 0xCE, 0xBC, 0x89, 0x9F, 0x8E, 0x5D, 0xDE, 0x95,
-    0x6E, 0xDC, 0x1A, 0x51, 0x2A, 0xE2, 0xC9, 0x01, 0x0E, 0xAE, 0x10, 0x68, 0xA3, 0x29, 0x9A, 0xCF,
-    0xED, 0x6C, 0x45, 0x36, 0xEB, 0xCF, 0x0F, 0xF4, 0x22, 0x35, 0x90, 0x7E, 0x15, 0xDE, 0x38, 0xC3,
-    0xBA, 0xF4, 0xAB, 0xF0, 0x96, 0xCD, 0x39, 0x87, 0x63, 0x24, 0x45, 0xDE, 0x8B, 0xAC, 0x7B, 0xB5,
-    0x67, 0xB4, 0xBC, 0x5F, 0xF5, 0x4C, 0x4B, 0xAE, 0x5D, 0xCF, 0xEC, 0x54, 0x57, 0x6B, 0xA5, 0x81,
-    0x7A, 0xDF, 0xD8, 0xAB, 0xFF, 0xDA, 0x2B, 0x53, 0xBC, 0x15, 0x76, 0x74, 0x5D, 0x37, 0x9C, 0xBF,
-    0x26, 0x5D, 0x36, 0xCD, 0xF8, 0xF1, 0xD3, 0xE3, 0x81, 0xD6, 0x90, 0x18, 0xC8, 0xF4, 0xEB, 0xBC,
-    0x7A, 0x26, 0x23, 0x43, 0x06, 0xDF, 0xC9, 0xF4, 0x2A, 0x2D, 0xBD, 0xE2, 0xA4, 0x6B, 0x5C, 0x1C,
-    0x5D, 0xA4, 0xDD, 0x15, 0x8A, 0xCC, 0x90, 0x1D, 0xD7, 0x35, 0x9C, 0x04, 0xBD, 0x44, 0xE5, 0x78,
-    0xBA, 0xCD, 0x34, 0x9C, 0xEB, 0x38, 0xD7, 0x72, 0xAE, 0xE7, 0x5C, 0xD3, 0xB9, 0xAE, 0x73, 0x6D,
-    0xE7, 0xFA, 0xAA, 0x74, 0xA6, 0xF1, 0x6A, 0x77, 0xA6, 0xF3, 0xF1, 0xEA, 0x4C, 0xEB, 0xAC, 0x51,
-    0xE9, 0xFD, 0x71, 0xDA, 0xA8, 0x34, 0xFF, 0x57, 0xB2, 0x56, 0xE9, 0xFE, 0xA1, 0xD9, 0xAC, 0xB4,
-    0x7F, 0x64, 0xBA, 0x95, 0xFE, 0x0F, 0xCC, 0x71, 0xB5, 0x03, 0xE7, 0x83, 0x74, 0xB6, 0x87, 0x38,
-    0x9A, 0x6B, 0xAF, 0x09, 0x68, 0x0D, 0x48, 0xFA, 0xAE, 0xCB, 0xD3, 0x83, 0x44, 0x2B, 0xD3, 0x60,
-    0x3E, 0x6B, 0x74, 0x56, 0xB0, 0x6E, 0x55, 0xD7, 0x0F, 0x3E, 0xC8, 0xB4, 0x7A, 0x94, 0x36, 0xFC,
-    0x57, 0x4D, 0x4B, 0xAB, 0xA8, 0xB3, 0xE2, 0xF3, 0x4B, 0xCD, 0x4E, 0x1F, 0x0E, 0xBB, 0xAD, 0x5A,
-    0x0D, 0xC3, 0x35, 0x19, 0x5D, 0x0D, 0xCE, 0xAB, 0xF9, 0xA8, 0x79, 0xF6, 0xDB, 0x9A, 0x0E, 0x85,
-    0xBA, 0xDA, 0x8F, 0x5A, 0xDC, 0x47, 0xCD, 0x27, 0x79, 0xAE, 0x99, 0x89, 0x36, 0x70, 0x53, 0x78,
-    0x47, 0xF0, 0x3B, 0xA8, 0x2D, 0xA3, 0x55, 0x47, 0xC7, 0x07, 0x6E, 0xE2, 0xC8, 0x35, 0x3A, 0xDC,
-    0x22, 0x5A, 0x6C, 0x32, 0x8F, 0x7D, 0x26, 0x9D, 0x43, 0x72, 0x0D, 0x5D, 0x34, 0xC5, 0xD4, 0x4D,
-    0x55, 0xD4, 0xC0, 0x86, 0xE0, 0x17, 0xA8, 0xF3, 0xD4, 0x49, 0x1A, 0x98, 0x28, 0xA3, 0x22, 0x04,
-    0x92, 0x63, 0x43, 0x1A, 0x92, 0x8C, 0x04, 0x07, 0x83, 0x9B, 0xEA, 0x07, 0x08, 0x77, 0x9D, 0xDC,
-    0xCB, 0x76, 0x9D, 0xA9, 0x97, 0x35, 0xD5, 0x9F, 0x9C, 0x7D, 0x04, 0xE4, 0xC4, 0x90, 0x9C, 0xE4,
-    0x1A, 0x80, 0x5C, 0x0D, 0x4E, 0x9C, 0xA8, 0xA8, 0x2B, 0x4B, 0x95, 0x89, 0x3F, 0x0D, 0x42, 0x4C,
-    0xDB, 0x44, 0x8A, 0x36, 0xDC, 0x6C, 0x8B, 0x3A, 0x6E, 0xC2, 0x4B, 0xBA, 0xB4, 0xF6, 0x90, 0xC4,
-    0x39, 0xD1, 0x31, 0x54, 0xC8, 0x78, 0x81, 0x50, 0x42, 0xA0, 0x79, 0xB2, 0x21, 0x6C, 0x71, 0xC1,
-    0x3D, 0x9D, 0x60, 0xD7, 0x7F, 0xF2, 0xCE, 0x2F, 0xC2, 0x2D, 0x3F, 0x61, 0xC2, 0x1E, 0x3B, 0xD9,
-    0x17, 0x3E, 0xCE, 0xBC, 0xDF, 0x64, 0xDE, 0xAF, 0x12, 0xEF, 0xCF, 0xA1, 0x3A, 0x03, 0x53, 0xD8,
-    0xB7, 0x40, 0x55, 0x9B, 0x31, 0x33, 0x95, 0x4F, 0x21, 0x9B, 0x28, 0x41, 0x9B, 0x08, 0x5B, 0x84,
-    0x4B, 0xBC, 0xBF, 0x26, 0x1B, 0x6E, 0xD6, 0x05, 0x46, 0xBC, 0x4F, 0xFA, 0x71, 0x88, 0xB7, 0x8A,
-    0xC7, 0xD5, 0x94, 0x45, 0xDE, 0x39, 0xC5, 0x61, 0x1C, 0xF9, 0x11, 0xF7, 0x24, 0xC9, 0xDB, 0x92,
-    0x19, 0x37, 0x04, 0xFB, 0x68, 0x20, 0xC1, 0xA0, 0x54, 0xE2, 0x93, 0x81, 0xA9, 0x66, 0xA8, 0x48,
-    0x98, 0x79, 0x07, 0xF8, 0x30, 0x72, 0xDE, 0x37, 0x82, 0xA8, 0x38, 0xA2, 0xE9, 0xE9, 0x80, 0x8E,
-    0x7C, 0xAE, 0x9A, 0x8D, 0xCF, 0x44, 0x7E, 0x9D, 0x89, 0x09, 0x79, 0x59, 0xFB, 0xBD, 0x6C, 0xE9,
-    0xC5, 0x82, 0xE6, 0xF3, 0x6C, 0xA9, 0xF1, 0x1E, 0xEC, 0xD9, 0x98, 0xD7, 0xF2, 0x55, 0x3B, 0x02,
-    0x85, 0xD7, 0x89, 0x86, 0x37, 0xB4, 0x8C, 0xA0, 0x26, 0xC3, 0xFF, 0x43, 0x8B, 0x03, 0xAC, 0x55,
-    0x71, 0xDE, 0x3E, 0x0F, 0x39, 0xB6, 0xDE, 0x31, 0x1C, 0x4B, 0x5F, 0x9A, 0x72, 0xE0, 0x68, 0xDD,
-    0x0E, 0xEB, 0x4A, 0xDB, 0x7A, 0x67, 0x02, 0x8F, 0x55, 0x55, 0xE9, 0x94, 0x3E, 0x16, 0xAF, 0x48,
-    0x52, 0x49, 0x3A, 0x49, 0x34, 0xEE, 0x94, 0xCA, 0x49, 0x14, 0xA9, 0xD0, 0x6E, 0x88, 0x91, 0xFE,
-    0xE4, 0x35, 0xF3, 0x56, 0x6C, 0x2A, 0x9B, 0xB4, 0x0B, 0x60, 0x34, 0xC1, 0x2E, 0x91, 0x53, 0xA0,
-    0x1F, 0x16, 0xFA, 0x5D, 0x66, 0x3C, 0xA3, 0x2E, 0x91, 0xA1, 0x7E, 0x0B, 0xFF, 0xEF, 0x82, 0xE6,
-    0x65, 0xC9, 0x08, 0x80, 0xB6, 0x35, 0xCE, 0xA6, 0xF5, 0x01, 0x27, 0xC5, 0x65, 0x9A, 0xB6, 0x73,
-    0x38, 0xF9, 0xA5, 0x25, 0x24, 0x70, 0xED, 0x2A, 0x74, 0xF8, 0x1D, 0xE3, 0xFC, 0xEC, 0x7F, 0x2C,
-    0xC1, 0x91, 0xB3, 0xB0, 0xCF, 0xB3, 0xCD, 0x3F, 0x0F, 0xFD, 0x73, 0x30, 0x20, 0xCA, 0x98, 0x38,
-    0xF1, 0x52, 0x86, 0xC5, 0xB1, 0x9B, 0xDD, 0x72, 0xB2, 0x5B, 0xEE, 0x4C, 0x39, 0x65, 0x97, 0x65,
-    0x14, 0x72, 0x3C, 0x14, 0x3D, 0x24, 0x50, 0x66, 0xB1, 0x52, 0x86, 0x0B, 0xC7, 0x67, 0x2F, 0xA3,
-    0x10, 0x05, 0xEE, 0xDA, 0xE8, 0x79, 0x38, 0x93, 0x8C, 0x4B, 0x62, 0xDB, 0x22, 0xB5, 0x87, 0xB1,
-    0x84, 0x34, 0x65, 0x6E, 0x82, 0x22, 0xC9, 0xE4, 0xCA, 0x8F, 0x4A, 0x4E, 0xA4, 0x4E, 0x67, 0x32,
-    0x39, 0x13, 0x69, 0xA9, 0x08, 0x93, 0xD0, 0x66, 0xE0, 0xD4, 0x30, 0xCF, 0x58, 0x2B, 0x87, 0xB1,
-    0x7D, 0x0A, 0x6D, 0x28, 0x42, 0x47, 0x17, 0x85, 0x4C, 0xDD, 0x62, 0x1F, 0x53, 0xFD, 0xEE, 0x44,
-    0x32, 0x87, 0x72, 0x56, 0x31, 0x74, 0xD3, 0x1B, 0x18, 0xD2, 0x4A, 0x18, 0xD3, 0x31, 0xCE, 0x84,
-    0x3F, 0x2A, 0x61, 0x02, 0xB6, 0x43, 0x15, 0xB2, 0x10, 0xFB, 0xB2, 0xB2, 0x24, 0x38, 0x05, 0x79,
-    0xE1, 0x85, 0x95, 0xB6, 0xC4, 0x9A, 0x7B, 0x3C, 0x67, 0x71, 0x4B, 0xC1, 0xFC, 0xF5, 0x2F, 0xBE,
-    0xF9, 0xD3, 0xB8, 0x60, 0x20, 0x8D, 0xAD, 0x6F, 0x77, 0x6C, 0x6C, 0x1F, 0xD9, 0xEA, 0x9A, 0x4A,
-    0x98, 0x48, 0x39, 0x2F, 0x47, 0x24, 0xA1, 0xE1, 0xA3, 0x3A, 0x06, 0x5C, 0x43, 0x51, 0x9C, 0x43,
-    0xDF, 0x29, 0x8C, 0xF2, 0x8B, 0x84, 0x94, 0x5E, 0x20, 0x79, 0x96, 0xF7, 0xA1, 0xF2, 0xDF, 0x80,
-    0xE2, 0x9C, 0xAB, 0x50, 0xE0, 0xEF, 0x23, 0x56, 0x13, 0xB8, 0x87, 0x87, 0x51, 0x70, 0x1E, 0x47,
-    0xBD, 0xBC, 0xC5, 0x23, 0xD9, 0x65, 0xEA, 0xE5, 0xAB, 0x08, 0x8A, 0x22, 0x41, 0xBF, 0x1F, 0xDE,
-    0x3B, 0xFC, 0x09, 0xDA, 0xFF, 0x28, 0x42, 0xEF, 0xD5, 0xC2, 0x90, 0x92, 0x0B, 0x64, 0x14, 0x89,
-    0x69, 0xCE, 0x74, 0xDF, 0x2E, 0xEB, 0x05, 0x9A, 0x2D, 0x6C, 0x35, 0xA1, 0x7E, 0x3E, 0x5D, 0x28,
-    0x1E, 0xC7, 0x67, 0xF8, 0xD1, 0x8F, 0x13, 0xFC, 0x25, 0x73, 0xD2, 0x90, 0xA7, 0xA7, 0x05, 0xDA,
-    0x3D, 0x30, 0x3A, 0xBC, 0xEC, 0xFA, 0x1E, 0x62, 0x3A, 0xEE, 0x88, 0xE6, 0x68, 0xD9, 0x23, 0x89,
-    0xD4, 0x59, 0xA2, 0xCB, 0xE3, 0x17, 0x89, 0x8D, 0x38, 0x1E, 0x30, 0x6F, 0x58, 0xFC, 0x17, 0xF1,
-    0x9C, 0x46, 0xF1, 0x0B, 0xB4, 0xE9, 0xCA, 0x2A, 0x70, 0xE2, 0x27, 0x0C, 0x82, 0xF8, 0xFC, 0xC2,
-    0x57, 0x1A, 0x39, 0x61, 0xCD, 0x9C, 0x26, 0x21, 0x91, 0x20, 0x21, 0x0E, 0xEC, 0x7B, 0x3C, 0xE5,
-    0xB8, 0xDF, 0xFB, 0x0E, 0x73, 0xEE, 0x6B, 0x11, 0xFC, 0x97, 0xED, 0xF9, 0xA9, 0xAC, 0x28, 0x0C,
-    0x4F, 0x9A, 0x3D, 0xF8, 0xFA, 0x35, 0xB8, 0xFF, 0x1C, 0xC3, 0x89, 0xA7, 0x72, 0xBA, 0x41, 0xE7,
-    0x2B, 0x4C, 0xA6, 0xFB, 0x04, 0xD8, 0x8C, 0xF8, 0x74, 0x57, 0x4A, 0x64, 0x18, 0xBC, 0x07, 0xFD,
-    0x0D, 0x1B, 0xCC, 0x2D, 0xEB, 0xD2, 0x75, 0xEB, 0x4F, 0x0B, 0x57, 0xE2, 0xCC, 0x50, 0x10, 0xCB,
-    0xB7, 0xDF, 0x97, 0xBB, 0xE8, 0xEC, 0x62, 0x63, 0x73, 0x26, 0x22, 0xF1, 0x57, 0x4F, 0xEA, 0x1B,
-    0xC1, 0xB7, 0xEF, 0xAB, 0xE9, 0x12, 0x68, 0x8E, 0x17, 0x24, 0x4B, 0x8B, 0x33, 0xB8, 0x9F, 0x84,
-    0x77, 0x12, 0xC1, 0x84, 0x1D, 0x41, 0xCC, 0xE5, 0x92, 0xFB, 0xA6, 0xAC, 0xAF, 0x97, 0x77, 0xFC,
-    0xEF, 0x67, 0xCE, 0x47, 0xE6, 0xAB, 0xF1, 0xBD, 0x51, 0x1C, 0x83, 0x1E, 0xFF, 0x63, 0xAA, 0x97,
-    0x07, 0x0E, 0xE1, 0xF2, 0x73, 0x25, 0x13, 0xE3, 0xEA, 0x8C, 0xF5, 0x83, 0x0F, 0x4B, 0x92, 0xB7,
-    0x32, 0x4E, 0xE6, 0x16, 0x28, 0xBF, 0x8E, 0xAB, 0x7A, 0x78, 0x22, 0x05, 0x71, 0xC2, 0x8A, 0xF8,
-    0xCB, 0x94, 0x25, 0xF1, 0x5D, 0xC3, 0x9A, 0xE8, 0x45, 0x2C, 0x8A, 0x5E, 0xC5, 0x2D, 0xC6, 0xD0,
-    0xA6, 0x24, 0xBF, 0xF4, 0xD7, 0x35, 0x20, 0xDC, 0x83, 0x97, 0x09, 0x6D, 0x4A, 0xAA, 0xCF, 0x4B,
-    0x70, 0xC5, 0x5B, 0xA6, 0xD3, 0x6D, 0x38, 0x61, 0x0E, 0x95, 0x0A, 0x0D, 0xE4, 0x9C, 0x5A, 0x4D,
-    0x66, 0xDA, 0x94, 0x14, 0x5C, 0x54, 0xCA, 0x4B, 0x84, 0x4F, 0xAE, 0x65, 0x3D, 0x7E, 0x38, 0xBE,
-    0xE8, 0xD4, 0xE1, 0xC3, 0x0A, 0x08, 0x82, 0x0B, 0xF3, 0x3F, 0xD5, 0xDE, 0x84, 0x1B, 0xCD, 0xE4,
-    0xC9, 0xFD, 0x53, 0x0C, 0xB3, 0xB9, 0x95, 0xDC, 0xA5, 0x05, 0x84, 0xE3, 0xBA, 0x97, 0x0A, 0xDD,
-    0xAE, 0x3B, 0x91, 0xC5, 0x60, 0x52, 0xFF, 0x5B, 0xFD, 0xED, 0x58, 0xFE, 0x86, 0x54, 0xCF, 0x42,
-    0xC3, 0xBA, 0x97, 0x08, 0xDF, 0x80, 0x57, 0xEC, 0x9E, 0xEE, 0xCA, 0xFC, 0xE6, 0xE9, 0xA9, 0x3D,
-    0x63, 0xDA, 0xC7, 0x71, 0x9E, 0x2F, 0x5D, 0xFA, 0x11, 0xF5, 0xE3, 0xB4, 0x3C, 0x05, 0x5E, 0xE9,
-    0xF4, 0x99, 0x99, 0x75, 0xE9, 0x57, 0x3A, 0x7D, 0xA6, 0x3D, 0x13, 0x84, 0x1A, 0x8B, 0x78, 0x3E,
-    0x2F, 0x53, 0x8D, 0x00, 0xD4, 0x33, 0x33, 0x5D, 0x9E, 0xC5, 0xAB, 0xF1, 0x65, 0x73, 0x70, 0xF0,
-    0x52, 0x74, 0x95, 0x75, 0x4F, 0x71, 0xD5, 0xBD, 0xFD, 0x07, 0x8D, 0x94, 0xBF, 0x6F, 0xDB, 0x46,
-    0x14, 0xC7, 0x3F, 0xA7, 0xB3, 0x74, 0xB0, 0x2E, 0x22, 0x35, 0x24, 0x40, 0x5D, 0xE8, 0x87, 0x87,
-    0x0C, 0x0D, 0x4A, 0x4A, 0x1D, 0x34, 0xA8, 0x01, 0x95, 0x5C, 0x92, 0xB1, 0x8B, 0x07, 0x7B, 0xE8,
-    0x54, 0xA0, 0xE8, 0x92, 0x0E, 0x2E, 0x07, 0x0F, 0x1E, 0xE4, 0x98, 0xCE, 0x5F, 0xA0, 0xDD, 0x40,
-    0x61, 0x74, 0xEB, 0xD2, 0x6A, 0xF0, 0xA0, 0xC1, 0xA9, 0x0F, 0xE8, 0xD0, 0x95, 0x5B, 0xD1, 0x29,
-    0xDC, 0x32, 0x14, 0x68, 0x84, 0xC2, 0x43, 0x5A, 0xD4, 0x55, 0x1F, 0xA9, 0xC6, 0xC8, 0xD0, 0xA1,
-    0xF7, 0x0E, 0xC4, 0xC3, 0xE3, 0xC3, 0xBB, 0x77, 0xDF, 0xCF, 0x23, 0xD9, 0xA2, 0xF6, 0xAB, 0xB7,
-    0xCF, 0x8B, 0x50, 0x2D, 0x07, 0x6A, 0x39, 0xA9, 0xC9, 0x2E, 0x12, 0x9D, 0x27, 0xC6, 0x4F, 0x42,
-    0xC2, 0x17, 0xA8, 0x19, 0x75, 0x42, 0xCA, 0x35, 0x25, 0x22, 0x61, 0xCC, 0x88, 0x54, 0x6C, 0x82,
-    0xBC, 0xA0, 0xEF, 0x38, 0x86, 0x97, 0xE8, 0x7D, 0x5A, 0x31, 0xA3, 0x09, 0x97, 0xAB, 0x5C, 0x12,
-    0x59, 0xD0, 0xB8, 0x46, 0xED, 0xC1, 0x9E, 0xD3, 0xAB, 0x42, 0x93, 0x37, 0x60, 0x13, 0xC2, 0x15,
-    0x1B, 0x36, 0xC3, 0xF8, 0xBB, 0xC6, 0x27, 0x36, 0x1B, 0xFE, 0x40, 0x7D, 0x07, 0xBE, 0x40, 0xBF,
-    0x26, 0x34, 0x2E, 0x56, 0x24, 0x3B, 0x1C, 0xFF, 0xC5, 0x62, 0xC0, 0x55, 0x9F, 0xF3, 0x1E, 0x8B,
-    0x09, 0x0F, 0xDE, 0xD0, 0x70, 0xDC, 0xD9, 0xE3, 0x78, 0xC5, 0x59, 0x40, 0xD6, 0x41, 0x1A, 0xA0,
-    0x40, 0x79, 0xB4, 0xC3, 0x82, 0x04, 0xC6, 0xD0, 0x96, 0x06, 0xBF, 0x44, 0xBF, 0xCA, 0xCD, 0xC9,
-    0xD2, 0x9E, 0x14, 0xE6, 0xE7, 0xAC, 0x76, 0x8D, 0xBD, 0x74, 0x03, 0xEB, 0x13, 0xED, 0x13, 0x93,
-    0xF5, 0xBF, 0x47, 0xED, 0xC2, 0x2E, 0xF6, 0x3B, 0x06, 0xD6, 0x4D, 0x6C, 0x26, 0x0D, 0x4C, 0x42,
-    0xD7, 0xBF, 0x44, 0x7D, 0x46, 0x3B, 0x26, 0x4D, 0x78, 0xB6, 0xE4, 0x7D, 0x87, 0x72, 0x65, 0xF1,
-    0xF5, 0x5E, 0xAD, 0xDC, 0x8D, 0x8F, 0x2B, 0x55, 0x90, 0xC8, 0xCD, 0x73, 0xBD, 0xD6, 0x7E, 0xAC,
-    0xAE, 0x8C, 0x97, 0x72, 0x22, 0x4C, 0x72, 0x63, 0xB1, 0x48, 0x67, 0xB2, 0x32, 0xA9, 0x96, 0xA9,
-    0x82, 0x73, 0x91, 0x66, 0xFD, 0x62, 0xCA, 0x21, 0x57, 0x6A, 0xA9, 0xF3, 0xD0, 0x1D, 0x21, 0x12,
-    0xDC, 0xE6, 0x48, 0xDA, 0x0A, 0x49, 0x02, 0xC6, 0x2D, 0x46, 0x1D, 0xD2, 0x88, 0x79, 0xC4, 0x99,
-    0xE8, 0xFB, 0x29, 0xB5, 0xD7, 0x99, 0x7D, 0x92, 0xF7, 0x6A, 0x45, 0xC5, 0xA6, 0x98, 0xEA, 0x7C,
-    0xAA, 0xFD, 0x54, 0x2E, 0x10, 0xD2, 0xBF, 0x28, 0x09, 0x09, 0x89, 0x23, 0x7B, 0x51, 0x9F, 0x4A,
-    0xD9, 0x05, 0x57, 0x2C, 0xD5, 0xB2, 0x56, 0x7C, 0xF8, 0xC7, 0x9D, 0x5D, 0x9E, 0x62, 0x5F, 0x66,
-    0xA1, 0xF6, 0x0D, 0xED, 0xCB, 0x3E, 0x84, 0x63, 0x52, 0x6A, 0xA7, 0x1F, 0xD1, 0xD5, 0x82, 0x8A,
-    0x3D, 0x21, 0xF4, 0x14, 0x2D, 0x13, 0xF0, 0xA4, 0xA8, 0xE9, 0x1C, 0x9B, 0xA9, 0x6B, 0xF8, 0x0A,
-    0xAC, 0xDF, 0x36, 0xFE, 0x30, 0x74, 0x0F, 0xD6, 0x84, 0x84, 0xF4, 0x10, 0x44, 0xA9, 0xDF, 0x30,
-    0x13, 0x3A, 0x09, 0xA3, 0x44, 0xAE, 0xED, 0xE5, 0x34, 0x39, 0x4E, 0x48, 0xD7, 0x77, 0x05, 0xB6,
-    0x90, 0xCE, 0x8D, 0xF2, 0x9B, 0xB8, 0x5B, 0x42, 0xFA, 0x6F, 0x36, 0x42, 0xE1, 0x93, 0x7D, 0x64,
-    0x33, 0xA9, 0xF3, 0xF0, 0xC5, 0xFF, 0x25, 0x5D, 0xDF, 0x73, 0xC3, 0x95, 0x1F, 0x19, 0xB7, 0xDD,
-    0xAC, 0xD8, 0x0A, 0xEC, 0x79, 0x05, 0x3B, 0x2B, 0x61, 0x77, 0x4B, 0xA9, 0xAA, 0x9E, 0x5F, 0x79,
-    0xFB, 0xB8, 0x08, 0x1F, 0xE7, 0xF6, 0xA7, 0x4C, 0x97, 0xA4, 0x99, 0x84, 0xD9, 0xD4, 0x88, 0x2C,
-    0x6E, 0xB8, 0x8F, 0xDA, 0x29, 0x65, 0x91, 0xF1, 0x95, 0x21, 0x9E, 0xAE, 0x77, 0x9F, 0xE1, 0x25,
-    0xF5, 0xFD, 0x52, 0x81, 0xE2, 0x9C, 0x3F, 0x0B, 0xB6, 0xA4, 0x8E, 0xB4, 0x74, 0xF6, 0xEF, 0x7E,
-    0x28, 0xD7, 0x79, 0xEB, 0x97, 0x71, 0xAA, 0xC8, 0xDB, 0xE7, 0x7A, 0xAD, 0xFD, 0xEE, 0x9A, 0x74,
-    0xAF, 0x22, 0x3D, 0xAD, 0x2C, 0x11, 0xBF, 0x87, 0x75, 0xAA, 0x9C, 0x04, 0xCF, 0xB2, 0x0A, 0x0C,
-    0x2A, 0x8B, 0xAB, 0xB4, 0x85, 0x5A, 0x1A, 0x3F, 0x64, 0x1B, 0xF5, 0x2D, 0xD6, 0x12, 0x59, 0xC6,
-    0x01, 0x69, 0xAB, 0x64, 0x3C, 0x9F, 0x72, 0xFF, 0xEB, 0x6C, 0x6B, 0x13, 0xB5, 0x08, 0xBA, 0x51,
-    0x77, 0x34, 0x7E, 0x36, 0x9B, 0x73, 0xC0, 0x24, 0x6D, 0x38, 0xB5, 0x20, 0x08, 0x89, 0x8C, 0x13,
-    0x39, 0x52, 0xCB, 0x3C, 0x24, 0xED, 0xF2, 0xF1, 0x41, 0x29, 0x53, 0xF3, 0xD1, 0x4C, 0xFF, 0xE8,
-    0xD4, 0x2F, 0xF0, 0xA6, 0x12, 0x68, 0x81, 0x89, 0xE8, 0x04, 0xB4, 0xEB, 0xD8, 0xD9, 0xDD, 0x43,
-    0x39, 0x32, 0xEA, 0x5F, 0x1C, 0x8C, 0x8B, 0xF9, 0xEF, 0x7E, 0xAB, 0xFC, 0x4A, 0x0D, 0xA5, 0x7C,
-    0x41, 0x4C, 0x70, 0x2A, 0x00, 0xE8, 0x48, 0x0F, 0xEB, 0x51, 0xEB, 0x92, 0x06, 0x59, 0xBB, 0xF1,
-    0x4E, 0x4E, 0x33, 0x0B, 0x9A, 0xDC, 0xFA, 0x80, 0x4E, 0xCE, 0xB0, 0x60, 0x3C, 0x67, 0x34, 0x26,
-    0x8D, 0xCB, 0xCA, 0x7D, 0x67, 0x24, 0x23, 0x10, 0x6B, 0x09, 0x9A, 0xA8, 0xFA, 0x17, 0xDC, 0xE7,
-    0x3D, 0xEE, 0xC5, 0x4D, 0xD7, 0x3B, 0xFD, 0xDC, 0xF7, 0xCD, 0x73, 0xDF, 0xB1, 0x3A, 0x8B, 0x02,
-    0xED, 0xC6, 0x2D, 0x69, 0xBB, 0x63, 0x48, 0x3B, 0x66, 0xD6, 0xDE, 0x50, 0xEE, 0x5E, 0x4C, 0xEF,
-    0x94, 0xFE, 0x7F, 0x1D, 0xDD, 0xFC, 0xC4, 0xE9, 0x6F, 0xBC, 0x39, 0x91, 0xE9, 0xC9, 0x6D, 0xCD,
-    0x07, 0xDA, 0xB7, 0x0C, 0xBD, 0x2E, 0xF1, 0xAC, 0xFC, 0xB2, 0x65, 0x00, 0x8E, 0xA0, 0x71, 0x16,
-    0x8D, 0xC7, 0xB7, 0x07, 0x98, 0x9C, 0xB9, 0x4F, 0xE7, 0xC5, 0x96, 0x53, 0x68, 0xFA, 0xB3, 0xDE,
-    0x3B, 0xAD, 0x4C, 0xDC, 0x26, 0xFF, 0x00, 0x55, 0x56, 0x5D, 0x88, 0x24, 0x57, 0x15, 0xFE, 0xAA,
-    0xEE, 0xCE, 0x96, 0xCE, 0xDD, 0xDD, 0x9B, 0x87, 0xE8, 0xAE, 0xFB, 0x77, 0xF3, 0x90, 0x87, 0x21,
-    0x4C, 0xA6, 0xC6, 0xB5, 0xC5, 0x15, 0xFA, 0xA7, 0xE2, 0x22, 0x4B, 0x88, 0xE8, 0x3C, 0x64, 0x20,
-    0x20, 0x61, 0x03, 0x79, 0x52, 0xD1, 0x19, 0x74, 0x91, 0x45, 0xBA, 0xD3, 0xA5, 0x3E, 0x26, 0xE0,
-    0x04, 0xD1, 0x80, 0xA0, 0xAE, 0x3F, 0x08, 0x4E, 0xC4, 0xDD, 0x87, 0x08, 0x0D, 0xF6, 0xEC, 0xDC,
-    0xFC, 0x40, 0x88, 0x28, 0x96, 0xC2, 0xE2, 0x43, 0x14, 0x0A, 0xD9, 0x71, 0xC5, 0x3C, 0x6C, 0x09,
-    0x95, 0xA4, 0x66, 0xD3, 0xDD, 0xE5, 0x77, 0x6E, 0xF5, 0xEC, 0x62, 0x35, 0xF7, 0xDC, 0xDB, 0xB7,
-    0xAB, 0xCF, 0x3D, 0x3F, 0xDF, 0x77, 0xCE, 0x05, 0xF8, 0x0C, 0x73, 0xA8, 0xAC, 0x82, 0x49, 0xAE,
-    0x60, 0x85, 0x5F, 0xDB, 0x1C, 0xE3, 0x85, 0xF5, 0xB5, 0x91, 0xAD, 0xAB, 0x52, 0xB9, 0xCB, 0x65,
-    0xE4, 0x56, 0x47, 0x3A, 0x7D, 0xA0, 0x63, 0x12, 0xE8, 0xBA, 0x4E, 0x60, 0xF9, 0x82, 0x8C, 0x15,
-    0xAC, 0xA1, 0x03, 0x87, 0x7E, 0xE8, 0x54, 0x5D, 0xA7, 0x50, 0xA7, 0x01, 0xB5, 0x04, 0xE8, 0x29,
-    0x75, 0x0E, 0x5D, 0x38, 0xFD, 0x94, 0xD3, 0x2F, 0x3C, 0xEB, 0xEC, 0x91, 0x9F, 0xA1, 0x73, 0x22,
-    0x43, 0xFF, 0x61, 0x87, 0xF1, 0xAA, 0x43, 0xF5, 0xF1, 0x14, 0xE5, 0xD7, 0x13, 0x94, 0xCF, 0x02,
-    0xE5, 0xF7, 0x81, 0xD1, 0x9B, 0x87, 0xD0, 0xF9, 0xC3, 0x32, 0xEC, 0x9D, 0x12, 0xAA, 0xDE, 0x82,
-    0xFA, 0x1C, 0xEE, 0xA9, 0xF2, 0xCF, 0x61, 0x6E, 0x76, 0x2F, 0x96, 0x41, 0x19, 0x54, 0x2A, 0x43,
-    0x69, 0x52, 0x6C, 0xC5, 0xDC, 0xEE, 0x72, 0xF4, 0x7B, 0xDF, 0xCB, 0xC6, 0xFA, 0x57, 0x79, 0xA5,
-    0xB7, 0xD2, 0xCA, 0x38, 0xFE, 0x48, 0xBD, 0x06, 0xA8, 0x68, 0xDF, 0x78, 0x25, 0x40, 0xB7, 0xA3,
-    0x61, 0x67, 0x3B, 0x08, 0xEB, 0xB2, 0xD1, 0x55, 0xD7, 0x33, 0xC4, 0x3F, 0x78, 0x0E, 0x06, 0x67,
-    0xE8, 0xC3, 0x69, 0xFA, 0xF0, 0x21, 0xFA, 0xD0, 0x38, 0xDD, 0xE7, 0x18, 0xAC, 0x03, 0xBB, 0xF4,
-    0x51, 0x5E, 0x2F, 0x80, 0x53, 0x77, 0xB7, 0x70, 0xFC, 0xDD, 0x04, 0x2A, 0xA7, 0x3D, 0x19, 0x5D,
-    0xE3, 0x4C, 0x0D, 0xCD, 0x13, 0xEC, 0xE6, 0xD0, 0x2F, 0x4E, 0xA8, 0xA7, 0x4F, 0x1D, 0xE7, 0xA9,
-    0xE3, 0x01, 0xAF, 0x67, 0x3E, 0xA2, 0x7A, 0xDA, 0x18, 0xC9, 0xA0, 0x9A, 0x7A, 0x82, 0x7B, 0xE7,
-    0x5C, 0x07, 0xC2, 0xFF, 0x60, 0xCD, 0xD6, 0xB5, 0x5B, 0x8A, 0x0E, 0x94, 0x21, 0x4C, 0x44, 0x46,
-    0x7E, 0x7D, 0x14, 0xF8, 0x48, 0xF2, 0xCB, 0x47, 0xAF, 0x62, 0xF8, 0xE6, 0xAC, 0x37, 0x81, 0xFE,
-    0x7B, 0xFC, 0x4A, 0x07, 0xBA, 0xB0, 0x59, 0x07, 0xC6, 0xD9, 0x94, 0x32, 0x8D, 0xA9, 0xCA, 0x52,
-    0x7D, 0x1F, 0xB2, 0x1A, 0xF9, 0x55, 0xC9, 0x23, 0xC6, 0x34, 0xBB, 0x8D, 0x2A, 0x28, 0xD0, 0x57,
-    0x22, 0x47, 0x51, 0x89, 0xFD, 0xB4, 0x3A, 0x56, 0x62, 0x17, 0xF4, 0x57, 0x9E, 0x96, 0x97, 0xCF,
-    0x78, 0xB9, 0x9B, 0x50, 0x7F, 0x9C, 0x46, 0x19, 0x15, 0x2B, 0xA6, 0x36, 0x53, 0xB4, 0x37, 0xA7,
-    0x15, 0x9F, 0x2E, 0x34, 0x45, 0x79, 0x4C, 0x52, 0x5E, 0x17, 0xD8, 0xEC, 0x9F, 0xC6, 0xC2, 0xEF,
-    0x06, 0x5F, 0x4D, 0x68, 0x75, 0xED, 0x90, 0xC5, 0x54, 0xE2, 0x4C, 0x0B, 0x81, 0x33, 0x05, 0xC2,
-    0x54, 0x17, 0x50, 0x69, 0xC4, 0x70, 0xA4, 0x8C, 0xD2, 0xB0, 0x0C, 0x1D, 0x11, 0x40, 0x44, 0x30,
-    0x80, 0xFF, 0xAA, 0xC4, 0x2B, 0x37, 0xA0, 0xD4, 0xAE, 0x47, 0x29, 0xA6, 0x53, 0x26, 0x22, 0x6D,
-    0xD2, 0xFB, 0xB0, 0x60, 0xA9, 0x4B, 0xC3, 0x62, 0x4C, 0x98, 0x80, 0x6E, 0xF4, 0x7E, 0x9D, 0xA3,
-    0x37, 0x4B, 0x46, 0x3E, 0x1F, 0x4C, 0xC3, 0xD8, 0x27, 0xA2, 0x91, 0x15, 0xE8, 0x11, 0x37, 0x03,
-    0x22, 0x56, 0xD6, 0x49, 0x8F, 0xB6, 0xF8, 0x73, 0x7C, 0x6E, 0x67, 0x7E, 0x15, 0xBF, 0xE4, 0x73,
-    0x6D, 0xE5, 0x3F, 0xA2, 0x76, 0xD0, 0x4C, 0x1D, 0x7C, 0x49, 0xD2, 0x31, 0xD0, 0xEF, 0x64, 0x12,
-    0xA6, 0xB3, 0x12, 0x21, 0x54, 0x1D, 0xE4, 0x18, 0xEB, 0x4C, 0xD2, 0xC4, 0x74, 0xC5, 0xCC, 0x41,
-    0xD5, 0x87, 0xA1, 0x82, 0xB2, 0x83, 0x70, 0xC6, 0x23, 0x68, 0x72, 0x9C, 0x84, 0x45, 0x2C, 0xE6,
-    0xAB, 0xDC, 0xA6, 0x2E, 0x72, 0x2A, 0x33, 0xAF, 0x66, 0x51, 0xAA, 0xF3, 0x28, 0x2F, 0x2D, 0x11,
-    0x15, 0x4C, 0x86, 0xD5, 0x41, 0x16, 0xE3, 0x1A, 0x1F, 0x43, 0x6F, 0xC2, 0xA0, 0x77, 0xA1, 0x33,
-    0xC2, 0xE6, 0x39, 0x06, 0x86, 0x53, 0x0D, 0x0D, 0x55, 0x04, 0x35, 0x53, 0x1B, 0x16, 0xEA, 0x1A,
-    0x96, 0x65, 0xB2, 0x04, 0x4D, 0x58, 0x2C, 0x5A, 0x22, 0x62, 0x58, 0xCB, 0x93, 0x7E, 0x74, 0x7F,
-    0xB0, 0xF1, 0xD2, 0x4D, 0x1E, 0xDB, 0x32, 0x17, 0xE8, 0x4C, 0x79, 0xDD, 0x3C, 0x41, 0xA5, 0x65,
-    0x66, 0x3E, 0xCF, 0xE9, 0x3D, 0x67, 0x7E, 0xC3, 0xE9, 0x83, 0xC4, 0x8C, 0xC4, 0x5C, 0x02, 0x82,
-    0xD3, 0xD4, 0x63, 0x92, 0xBE, 0x6A, 0x1F, 0xF3, 0x5B, 0x61, 0x3E, 0x58, 0xBF, 0xA1, 0xF2, 0x3E,
-    0xAC, 0x08, 0xF3, 0x5D, 0x0A, 0x4D, 0x71, 0x52, 0x84, 0xD5, 0xAF, 0xFF, 0x9F, 0x88, 0x64, 0x8F,
-    0xD8, 0x16, 0x91, 0x51, 0x44, 0xAE, 0x6F, 0xD7, 0x37, 0x92, 0xBE, 0xAD, 0xF7, 0x25, 0x45, 0x12,
-    0xC6, 0x50, 0xCE, 0x90, 0xA0, 0x93, 0xE1, 0x5C, 0x09, 0x0F, 0x3C, 0x11, 0xEC, 0x07, 0x3C, 0x6E,
-    0x44, 0xC6, 0x85, 0xB9, 0x4E, 0xF9, 0x47, 0x92, 0xD2, 0xA4, 0x46, 0x6A, 0x83, 0x95, 0x60, 0xC7,
-    0x12, 0xEA, 0xAE, 0x8F, 0xB7, 0x88, 0x1D, 0xEE, 0x85, 0x5C, 0xD9, 0x9F, 0x74, 0x37, 0xA1, 0xAB,
-    0x38, 0xC3, 0xFD, 0x67, 0x28, 0x8A, 0xBF, 0xBC, 0xBD, 0x7D, 0xF0, 0x9D, 0xA4, 0x8A, 0xFE, 0x52,
-    0xF9, 0xF4, 0xB5, 0x71, 0x19, 0xA3, 0x86, 0x88, 0x62, 0x07, 0xEB, 0x11, 0x4E, 0xED, 0x3D, 0xC9,
-    0xD3, 0x00, 0x49, 0xFC, 0xA9, 0x9B, 0x89, 0xF7, 0x5A, 0x86, 0xEC, 0xA9, 0x3C, 0x40, 0xB0, 0xFF,
-    0x34, 0x55, 0xCE, 0xC9, 0xBE, 0x3B, 0x8D, 0xA9, 0x28, 0x37, 0xB9, 0xD8, 0x26, 0x98, 0x6B, 0x0B,
-    0x2C, 0xA8, 0x29, 0x8E, 0x18, 0xDC, 0xF8, 0xAC, 0x14, 0x91, 0x2B, 0x42, 0x4E, 0x9A, 0xB0, 0xB0,
-    0xB3, 0xF3, 0x24, 0xC3, 0x28, 0x40, 0xA8, 0x04, 0xA6, 0x95, 0x25, 0x16, 0x4A, 0x3A, 0x18, 0x14,
-    0xD4, 0x1F, 0x16, 0x04, 0x77, 0x54, 0xA8, 0x92, 0xE6, 0xE2, 0x86, 0xFC, 0xA3, 0xB2, 0x5F, 0xDC,
-    0x2B, 0x97, 0x23, 0x77, 0xB9, 0xA5, 0xDD, 0xE6, 0x43, 0x26, 0x7D, 0x08, 0xE6, 0xB3, 0xD4, 0x4E,
-    0xCA, 0xC7, 0x8C, 0x07, 0x5D, 0x3A, 0xDA, 0x65, 0xFD, 0xEA, 0xDD, 0x42, 0x20, 0xCE, 0x93, 0xFD,
-    0x0F, 0x0B, 0x46, 0x64, 0xD0, 0x38, 0x82, 0x77, 0xCE, 0x8F, 0xF9, 0xA3, 0x70, 0xC0, 0x7B, 0x3E,
-    0x0B, 0x1E, 0xB1, 0xE1, 0xDE, 0x7B, 0xB9, 0x9F, 0xF3, 0xB6, 0x7F, 0xC3, 0x9D, 0xF5, 0xF5, 0xC1,
-    0x19, 0x99, 0x74, 0xA2, 0xA5, 0x5C, 0x18, 0x88, 0x23, 0x32, 0x39, 0x8F, 0x78, 0x3F, 0xAD, 0x34,
-    0x13, 0x0B, 0x46, 0xEA, 0x0B, 0x8E, 0xB9, 0x38, 0x11, 0x2E, 0x99, 0x63, 0xFC, 0x27, 0x2B, 0xFC,
-    0x72, 0x94, 0xC4, 0x25, 0xDA, 0xED, 0x28, 0xDD, 0x2A, 0x50, 0xF6, 0xA3, 0xE4, 0xC5, 0x7F, 0x44,
-    0xD9, 0x8E, 0x41, 0xEF, 0x33, 0x33, 0xBC, 0xDF, 0xE0, 0xB8, 0x68, 0xCA, 0x5B, 0x33, 0x85, 0x79,
-    0x63, 0x61, 0x93, 0x33, 0xE5, 0x0E, 0xCA, 0x15, 0x0B, 0x97, 0x7E, 0x3E, 0x81, 0x51, 0xCC, 0x3C,
-    0xF9, 0x6E, 0xC2, 0xB4, 0x59, 0x5F, 0xA0, 0x3D, 0xCF, 0xF3, 0xB7, 0x3F, 0xF1, 0x65, 0x1E, 0xCC,
-    0x90, 0x89, 0x26, 0xF5, 0x58, 0x85, 0xE8, 0xF5, 0x09, 0xCC, 0xDB, 0x1D, 0x2C, 0x4D, 0x7A, 0x58,
-    0xBD, 0x62, 0x71, 0x75, 0x95, 0x80, 0xF1, 0x56, 0xD2, 0x8B, 0x16, 0xC7, 0x95, 0x28, 0x41, 0xF7,
-    0x12, 0xB7, 0x2A, 0x29, 0xD4, 0x5B, 0x8C, 0xDB, 0x0F, 0x2B, 0x49, 0xDB, 0x00, 0xE1, 0xB5, 0xED,
-    0xDD, 0xAD, 0x70, 0x97, 0x02, 0x3D, 0x82, 0xEB, 0x30, 0x57, 0xE9, 0xE2, 0x0D, 0x0A, 0x3A, 0x46,
-    0x9A, 0x8F, 0xA3, 0x42, 0xE8, 0x9F, 0x34, 0x01, 0xF6, 0xC5, 0xDB, 0x5B, 0xEF, 0xD1, 0xEB, 0x31,
-    0xEB, 0xB9, 0xB2, 0x5B, 0x7B, 0xD3, 0x17, 0xE5, 0x17, 0x62, 0x09, 0xF1, 0x8F, 0xB9, 0x31, 0x39,
-    0xDD, 0x4B, 0x54, 0xB1, 0x6C, 0x09, 0xA3, 0xA5, 0x43, 0x04, 0x4A, 0x4B, 0xF0, 0xBB, 0x2A, 0xA8,
-    0xDD, 0x64, 0x3B, 0xC0, 0x55, 0xE1, 0xD6, 0xDE, 0x3A, 0x05, 0x5B, 0xDF, 0x18, 0xAF, 0x95, 0x18,
-    0x07, 0xAF, 0xB1, 0x74, 0x84, 0xDF, 0x29, 0xD0, 0x55, 0x17, 0x72, 0xC4, 0x8A, 0xA1, 0x31, 0xB7,
-    0x4F, 0x11, 0x29, 0xDE, 0x82, 0x63, 0xF7, 0x13, 0xE9, 0x0D, 0x41, 0xE0, 0xA5, 0xF2, 0x96, 0x69,
-    0x5F, 0x93, 0xCE, 0x48, 0xA7, 0x41, 0xDB, 0xCB, 0xCD, 0xB6, 0xE7, 0x96, 0x90, 0x20, 0xF4, 0x65,
-    0x48, 0x25, 0x5D, 0x9F, 0x52, 0xA9, 0x38, 0xDC, 0x66, 0x08, 0xCF, 0xFB, 0x6E, 0x7B, 0x1D, 0x12,
-    0xAD, 0x5C, 0xA4, 0x84, 0x3B, 0x65, 0x79, 0x81, 0x75, 0x18, 0x4E, 0x82, 0x83, 0xDE, 0x76, 0x98,
-    0x88, 0xB2, 0x17, 0x0B, 0x66, 0xBE, 0x94, 0x16, 0x80, 0x07, 0x25, 0x1A, 0x41, 0xB9, 0xB8, 0xFD,
-    0xF2, 0xFE, 0xE2, 0x76, 0xFD, 0x6F, 0xE8, 0x99, 0x67, 0x57, 0x4F, 0xC0, 0xBB, 0xB7, 0xBE, 0x46,
-    0x15, 0x10, 0x90, 0xCB, 0x30, 0x29, 0xEB, 0xD9, 0xDE, 0x90, 0x2E, 0x1C, 0x54, 0xB2, 0xA3, 0x12,
-    0x23, 0x7A, 0xF7, 0xDB, 0x09, 0x26, 0x4B, 0x63, 0x55, 0xB4, 0xFA, 0xDA, 0xAD, 0x12, 0xE7, 0xAB,
-    0x34, 0x6C, 0x93, 0x49, 0xB8, 0xCA, 0xD8, 0x64, 0x24, 0x36, 0x7B, 0x7A, 0xC0, 0xC1, 0xEC, 0xCB,
-    0xE8, 0xB3, 0x87, 0x74, 0x09, 0xE6, 0xF8, 0xA2, 0x4A, 0xCC, 0x9D, 0x8D, 0x46, 0x9F, 0x04, 0xE3,
-    0x88, 0xC0, 0xEA, 0x51, 0x66, 0xA5, 0xE3, 0x01, 0xCD, 0x72, 0x83, 0xE3, 0x7B, 0xD3, 0x35, 0x92,
-    0x3F, 0x8F, 0x5C, 0x01, 0xFD, 0xED, 0x02, 0xE6, 0x31, 0x0E, 0xA2, 0xCD, 0x32, 0x9E, 0x31, 0x71,
-    0xB6, 0x42, 0x18, 0x77, 0xC8, 0xBD, 0x36, 0x11, 0xD2, 0xA7, 0xD7, 0x52, 0x6D, 0xAA, 0x68, 0x7A,
-    0x9F, 0x34, 0x9A, 0x7D, 0x7A, 0xA0, 0xF3, 0xA0, 0x08, 0x8B, 0x30, 0x0F, 0x72, 0xE6, 0x99, 0x89,
-    0xA4, 0xD9, 0x12, 0x0E, 0x69, 0xAB, 0xBD, 0xAC, 0x81, 0x52, 0xE0, 0xBF, 0xF8, 0x76, 0x73, 0xE2,
-    0xE7, 0x5F, 0x48, 0xBE, 0xF2, 0xAD, 0x3F, 0xE3, 0x47, 0xE7, 0x7E, 0x8A, 0xC1, 0x37, 0xD8, 0xF9,
-    0xE8, 0xE2, 0x91, 0xDB, 0x6C, 0x8C, 0x7F, 0x6B, 0x54, 0x92, 0xD8, 0xC5, 0xC2, 0xFA, 0xFA, 0x9A,
-    0xAC, 0x4F, 0x6E, 0x6F, 0x6F, 0x75, 0xAF, 0xBD, 0x93, 0xB5, 0x4C, 0x92, 0x6D, 0x1A, 0xB8, 0x67,
-    0x2C, 0x1D, 0x5D, 0x41, 0xD3, 0xC7, 0x3B, 0xF3, 0xFB, 0x82, 0xE4, 0x73, 0x34, 0xCF, 0x74, 0xD1,
-    0xA0, 0xBD, 0x47, 0xB3, 0xA2, 0xBA, 0xCE, 0x82, 0x4B, 0x37, 0x9B, 0x8B, 0x03, 0x51, 0xB8, 0xF8,
-    0xF2, 0xDD, 0xE4, 0x24, 0x87, 0xFF, 0x2E, 0xF5, 0x6A, 0xA3, 0xA9, 0x52, 0x83, 0x7B, 0x96, 0xF1,
-    0x6C, 0x29, 0x63, 0x34, 0x59, 0x7C, 0x08, 0x98, 0x76, 0x6C, 0x70, 0x53, 0xF2, 0x6F, 0x33, 0xF8,
-    0xDC, 0x0B, 0xF3, 0x2D, 0xAB, 0x00, 0xE9, 0xCB, 0x1A, 0x84, 0x68, 0x7C, 0x02, 0x87, 0x06, 0xB2,
-    0x4E, 0x12, 0x5D, 0xA9, 0xFC, 0x44, 0xC9, 0x83, 0xF8, 0x21, 0xF2, 0x19, 0x0F, 0x64, 0x2A, 0x53,
-    0x4E, 0xE7, 0x96, 0xA8, 0xBF, 0xD5, 0xB4, 0x26, 0xAA, 0x79, 0x85, 0x77, 0x8F, 0x8C, 0xB8, 0xCE,
-    0xBF, 0xF9, 0x6B, 0xEE, 0xD7, 0xEE, 0x11, 0xFF, 0x26, 0x9A, 0xF1, 0x06, 0xB2, 0x60, 0xFA, 0x4F,
-    0x17, 0xDE, 0xF9, 0x3D, 0xA2, 0xC7, 0xCF, 0xFB, 0x66, 0xF8, 0x0B, 0x0F, 0xC8, 0x43, 0xA4, 0xFD,
-    0x19, 0x84, 0x77, 0x27, 0x1E, 0x3F, 0xB8, 0x47, 0xA2, 0x06, 0xE6, 0x47, 0xE6, 0x57, 0x34, 0xF4,
-    0xBE, 0xC6, 0x17, 0xCA, 0xA5, 0x1E, 0x9D, 0x6C, 0x49, 0x2D, 0x22, 0xBD, 0x4D, 0xB2, 0x69, 0x12,
-    0x32, 0x5D, 0xDA, 0x7D, 0x6E, 0x88, 0xEC, 0xCC, 0xC8, 0x95, 0x91, 0x37, 0xA6, 0xC0, 0xAD, 0x90,
-    0x44, 0xBC, 0xCA, 0x8C, 0x54, 0x42, 0xC0, 0x2A, 0x89, 0xE6, 0x2E, 0xB3, 0x01, 0x7B, 0x73, 0x47,
-    0x8A, 0x42, 0x2C, 0x3E, 0x5B, 0x71, 0xDA, 0xA2, 0xE9, 0x2A, 0x2B, 0x4D, 0x43, 0x61, 0xC4, 0x3B,
-    0xC7, 0x0B, 0x46, 0x58, 0xC8, 0xE6, 0x29, 0x24, 0xF1, 0x5F, 0x9C, 0x91, 0xA8, 0x87, 0xF7, 0xD7,
-    0xE6, 0xD5, 0xCB, 0xB3, 0x5F, 0x8A, 0x02, 0xCB, 0xAC, 0xBF, 0x57, 0x9D, 0xA3, 0xFC, 0xC4, 0xFC,
-    0xCA, 0x76, 0xBB, 0x42, 0xF7, 0xAD, 0x31, 0xC6, 0x6F, 0x5D, 0x46, 0xF9, 0x47, 0x84, 0xFF, 0x7D,
-    0x01, 0xEA, 0xAF, 0x4F, 0x21, 0x7A, 0xF5, 0x41, 0x5F, 0x38, 0x0F, 0x86, 0x14, 0x3C, 0xC9, 0x96,
-    0x57, 0x25, 0x69, 0xB6, 0x29, 0x53, 0x3B, 0xA5, 0x42, 0xC9, 0xCD, 0x12, 0xDF, 0xF8, 0x24, 0xD9,
-    0xC7, 0x36, 0x64, 0xDF, 0x26, 0x6E, 0x53, 0x96, 0x36, 0x96, 0x07, 0xE9, 0x5A, 0xBC, 0xC8, 0x70,
-    0xF0, 0x02, 0x10, 0x09, 0xD7, 0x98, 0xE3, 0x4B, 0xE4, 0x07, 0x35, 0x55, 0x4C, 0x8F, 0x8C, 0x92,
-    0xF7, 0x80, 0x42, 0xE5, 0x21, 0xFB, 0x4A, 0xF4, 0xEE, 0x90, 0x57, 0x98, 0xCA, 0xAB, 0xC2, 0xB9,
-    0xA6, 0x1F, 0xFC, 0x0F, 0xAB, 0xFF, 0xB3, 0xFF, 0x0F, 0x03, 0x03, 0x00, 0xCD, 0x93, 0x31, 0x4E,
-    0xC3, 0x40, 0x10, 0x45, 0xBF, 0xBD, 0x85, 0x0B, 0x0B, 0xB9, 0xA7, 0xD9, 0x13, 0x60, 0x37, 0x14,
-    0x14, 0x76, 0x62, 0x89, 0x92, 0x1A, 0x01, 0x3D, 0x87, 0xA0, 0x08, 0xC2, 0x47, 0xE1, 0x18, 0x2E,
-    0x22, 0x61, 0x89, 0x0B, 0xF8, 0x08, 0x7B, 0x04, 0x17, 0x8E, 0xE4, 0x20, 0x12, 0xF3, 0x67, 0xC6,
-    0x8A, 0x80, 0x1E, 0x09, 0x17, 0x5F, 0xD6, 0x66, 0xBD, 0xF3, 0x32, 0x6F, 0x07, 0xB0, 0x27, 0x39,
-    0x64, 0x9F, 0x80, 0xF7, 0xE5, 0x0A, 0x28, 0xCF, 0xDA, 0x0B, 0x60, 0x8B, 0x81, 0xEB, 0x53, 0xC4,
-    0x8C, 0xF6, 0x77, 0x3B, 0xA0, 0x98, 0xE7, 0xB9, 0x46, 0x34, 0xB8, 0x1E, 0x88, 0x83, 0xEB, 0x00,
-    0xD7, 0x27, 0x92, 0x5D, 0xDA, 0xF0, 0x80, 0x2E, 0xAB, 0x81, 0xD4, 0xB2, 0xF1, 0xFC, 0x34, 0xAB,
-    0x0B, 0x49, 0xE4, 0x4C, 0x8F, 0x8A, 0x99, 0xA3, 0x64, 0xAE, 0xB0, 0x61, 0x56, 0x2C, 0x00, 0xBE,
-    0x4D, 0xCC, 0x56, 0x4B, 0x0D, 0x71, 0xE0, 0x31, 0x21, 0xE5, 0x91, 0x2F, 0xF5, 0x11, 0xA7, 0x27,
-    0x99, 0x59, 0xD0, 0x27, 0xDC, 0x52, 0x4A, 0xE9, 0x56, 0xD6, 0x46, 0x08, 0xD5, 0x6D, 0x2D, 0x50,
-    0x3D, 0x99, 0xC8, 0x11, 0x07, 0x86, 0xEB, 0xC9, 0xE2, 0x04, 0x42, 0x79, 0xD2, 0xCE, 0x0B, 0x4D,
-    0x21, 0x30, 0xB9, 0xB0, 0x54, 0x0B, 0x4A, 0x8E, 0xF5, 0x23, 0x41, 0x7C, 0xAF, 0x5C, 0x0A, 0x64,
-    0x07, 0x0B, 0x48, 0x42, 0x0E, 0x22, 0x7C, 0x27, 0xE0, 0x6F, 0xDE, 0xB1, 0x68, 0x29, 0xED, 0x68,
-    0x25, 0x46, 0xD2, 0x46, 0xFB, 0xEB, 0x40, 0x82, 0xF7, 0xBF, 0x27, 0x10, 0x41, 0xE9, 0xDC, 0x88,
-    0xA1, 0x2A, 0xEB, 0x54, 0x91, 0xF4, 0xC9, 0x1C, 0x99, 0x24, 0xB5, 0x64, 0x1D, 0x99, 0xB9, 0x53,
-    0x3C, 0x65, 0x8D, 0x8A, 0x22, 0x86, 0x98, 0xCA, 0x4C, 0x95, 0x37, 0x57, 0xB9, 0xCA, 0x92, 0xE2,
-    0xB2, 0x54, 0x9A, 0xAE, 0x8D, 0xF9, 0xDA, 0x18, 0xE3, 0xD6, 0x8C, 0x3D, 0xBF, 0xAA, 0xB2, 0x75,
-    0xC3, 0xA5, 0xD6, 0x58, 0x47, 0x9C, 0xAC, 0x99, 0xB6, 0xC5, 0xDB, 0x4F, 0x71, 0x0B, 0xF5, 0xA0,
-    0xD4, 0xE9, 0xA0, 0xD4, 0x2E, 0x28, 0xB5, 0x88, 0x24, 0x35, 0x2F, 0x91, 0x50, 0xB3, 0x6D, 0x42,
-    0x7D, 0xF3, 0x4F, 0xA8, 0x13, 0x69, 0x34, 0x0A, 0xDD, 0x51, 0xEA, 0x76, 0xFB, 0x68, 0xD4, 0x36,
-    0x8F, 0x09, 0x67, 0x21, 0x1A, 0xD6, 0x3A, 0x0B, 0x72, 0xFF, 0x55, 0xBB, 0x79, 0x37, 0xF1, 0xA7,
-    0x59, 0xD0, 0x29, 0x68, 0x74, 0x0A, 0x84, 0xDC, 0xEC, 0x9F, 0x66, 0xA1, 0xB8, 0x97, 0x59, 0xC8,
-    0x46, 0xD8, 0x0D, 0xB0, 0x2B, 0x60, 0xAC, 0xC6, 0xA8, 0xB7, 0xE0, 0xD7, 0x35, 0xD0, 0x4B, 0x80,
-    0xE7, 0x28, 0xE8, 0x10, 0xE8, 0xD8, 0xE8, 0xFF, 0x1A, 0xE4, 0xFD, 0x7C, 0x74, 0xBB, 0x3A, 0xFE,
-    0x98, 0x8A, 0xB9, 0x49, 0x9A, 0x0D, 0x7B, 0x9C, 0xD6, 0x57, 0x4C, 0x36, 0x94, 0x84, 0x69, 0x20,
-    0x11, 0xDC, 0x01, 0xC2, 0xF9, 0x66, 0x84, 0x81, 0xDD, 0x45, 0x3C, 0x90, 0xF3, 0x32, 0x92, 0x7C,
-    0x8A, 0x02, 0x69, 0x2B, 0xD7, 0xF9, 0x07, 0xF8, 0x23, 0xB2, 0x69, 0xA9, 0xFA, 0x05, 0x45, 0x8D,
-    0xB1, 0x0D, 0x80, 0x40, 0x0C, 0x03, 0x5F, 0x7C, 0x41, 0x41, 0x91, 0x51, 0x98, 0x00, 0x05, 0x46,
-    0x63, 0x12, 0x46, 0x21, 0xA3, 0x30, 0xC2, 0x17, 0x20, 0x01, 0x7A, 0x71, 0x24, 0xA2, 0x20, 0x52,
-    0x5C, 0xD8, 0xF2, 0x39, 0xA5, 0x9C, 0xE2, 0xC4, 0x42, 0xB5, 0x84, 0x52, 0x5D, 0x32, 0x84, 0x3D,
-    0x76, 0x1E, 0x0C, 0xED, 0xEC, 0x41, 0x15, 0xAB, 0x6E, 0x2F, 0x46, 0x12, 0x30, 0x4C, 0x61, 0xA2,
-    0xAC, 0x3C, 0x2D, 0xA7, 0xB2, 0xF7, 0x14, 0x61, 0xF7, 0x24, 0x73, 0x45, 0x19, 0x02, 0xA4, 0x07,
-    0xDE, 0x95, 0x4D, 0x9D, 0x93, 0x37, 0x0D, 0xFE, 0x5D, 0xFF, 0xAD, 0x6F, 0xB7, 0xF1, 0x7F, 0x01,
+    0xDE, 0x7F, 0x01, 0x95, 0x57, 0x4F, 0x68, 0x24, 0x59, 0x19, 0xFF, 0x55, 0xD5, 0x64, 0x6A, 0x4C,
+    0xD9, 0xFD, 0xFA, 0x30, 0x03, 0x2E, 0x9B, 0x74, 0x0D, 0x32, 0x42, 0xB3, 0x74, 0xD2, 0x11, 0x22,
+    0x36, 0x4B, 0x27, 0x5D, 0xBA, 0x87, 0x3D, 0x28, 0x9A, 0xC3, 0xB6, 0x97, 0x39, 0x38, 0x87, 0x3D,
+    0x0D, 0xE2, 0x8E, 0x90, 0x43, 0xC3, 0x76, 0xD2, 0xC5, 0xCE, 0x61, 0xAF, 0x01, 0xAF, 0xC2, 0x36,
+    0xAC, 0xA0, 0x04, 0xC1, 0x1C, 0x22, 0x44, 0xE8, 0x49, 0x3D, 0x77, 0x0E, 0x1E, 0xBC, 0xD4, 0x0A,
+    0x5E, 0xFC, 0x5B, 0xBA, 0x83, 0x20, 0x22, 0x5B, 0xBB, 0xF4, 0xA1, 0x16, 0x2B, 0x29, 0x7F, 0xDF,
+    0xAB, 0xAE, 0xE9, 0xC4, 0xC1, 0x99, 0xF8, 0xDE, 0xFB, 0xAA, 0xBA, 0xAA, 0xBE, 0x7F, 0xEF, 0xFB,
+    0xFB, 0x7A, 0x67, 0xF2, 0xCC, 0x00, 0x70, 0xEF, 0xE0, 0x95, 0x50, 0xA1, 0x13, 0xDE, 0x3F, 0x58,
+    0xC6, 0xF3, 0xA6, 0x0C, 0x27, 0x40, 0x1C, 0xA5, 0x93, 0xF8, 0x7D, 0x4C, 0x9E, 0x3B, 0x65, 0xB8,
+    0x58, 0x41, 0x3F, 0x5B, 0x69, 0xB9, 0x2D, 0x3C, 0x7F, 0x62, 0x9C, 0x47, 0x79, 0x75, 0x8D, 0x8A,
+    0x02, 0x87, 0x87, 0x87, 0xB8, 0x35, 0x90, 0xB1, 0xD3, 0x2F, 0x64, 0xA4, 0x28, 0xC7, 0xD1, 0xE6,
+    0xFF, 0x3B, 0x97, 0x06, 0x03, 0x74, 0xC8, 0x52, 0xC6, 0xAD, 0xC1, 0x1B, 0x18, 0x17, 0xB9, 0xF9,
+    0x6D, 0x85, 0x5E, 0xD0, 0x46, 0x17, 0xFB, 0x18, 0x63, 0x9D, 0xCF, 0x7E, 0xD0, 0xD1, 0x4A, 0x3B,
+    0xA1, 0x8B, 0x11, 0x76, 0xD0, 0x1C, 0x9F, 0xA6, 0x93, 0xCD, 0xBA, 0x20, 0xFA, 0xAF, 0xC7, 0x9D,
+    0xDF, 0xA4, 0xEA, 0x71, 0xEA, 0x84, 0x89, 0x6B, 0xE9, 0x91, 0x8F, 0x9D, 0x9B, 0x68, 0xBA, 0xE1,
+    0xD8, 0xD7, 0xA7, 0x9D, 0x30, 0xED, 0x61, 0xD2, 0xC2, 0x66, 0x0D, 0x75, 0x27, 0x14, 0x6C, 0x15,
+    0x40, 0x01, 0x24, 0x5C, 0x05, 0x77, 0xFF, 0x52, 0xEB, 0xCD, 0x7E, 0x91, 0x35, 0x36, 0x1B, 0x38,
+    0x01, 0x32, 0x58, 0x33, 0x58, 0x29, 0xAC, 0x04, 0x76, 0x0C, 0x5B, 0x83, 0x14, 0x34, 0xA7, 0x23,
+    0x86, 0xC2, 0x75, 0xE0, 0x73, 0xC0, 0x0D, 0x61, 0x31, 0x23, 0xC8, 0x7E, 0x13, 0x82, 0x86, 0xF5,
+    0xF7, 0xDF, 0x6B, 0xFB, 0xDF, 0x1F, 0x1B, 0x6C, 0x78, 0x9A, 0x12, 0x42, 0x43, 0x80, 0x25, 0x18,
+    0x12, 0xD4, 0x08, 0xDB, 0x84, 0x2D, 0xA0, 0xD1, 0x05, 0xFA, 0xC5, 0x0C, 0x5F, 0xFA, 0xC1, 0x3D,
+    0xE0, 0xC1, 0x9C, 0x0D, 0x81, 0x12, 0x71, 0x3D, 0xE8, 0xCF, 0xC4, 0xC0, 0x51, 0x3E, 0xCE, 0xFB,
+    0xB3, 0xE5, 0x83, 0xDB, 0x86, 0xAA, 0x9F, 0xA0, 0x7F, 0x6E, 0x56, 0x22, 0x8F, 0xB7, 0x8D, 0x69,
+    0xEE, 0xE4, 0xF9, 0xF0, 0x0E, 0x0E, 0x72, 0x7B, 0x96, 0x3B, 0xB3, 0x21, 0x89, 0xB7, 0xC7, 0x64,
+    0x8E, 0x68, 0x36, 0xC1, 0xE4, 0x0A, 0x6E, 0x1F, 0x67, 0x68, 0xBD, 0x70, 0x72, 0x14, 0x69, 0x35,
+    0x5F, 0x1C, 0x76, 0x45, 0xA2, 0x21, 0xF3, 0x2A, 0xB8, 0x51, 0x8A, 0x0D, 0x99, 0x57, 0xC1, 0x2D,
+    0x87, 0x75, 0x0E, 0x4B, 0x4B, 0xC0, 0xBE, 0x1B, 0x1A, 0x2F, 0x2A, 0x47, 0x2B, 0x79, 0xBF, 0xE6,
+    0xE8, 0xB6, 0xDC, 0x7B, 0x8E, 0xDE, 0x9D, 0xDF, 0xC5, 0x29, 0x18, 0xBA, 0x1F, 0x68, 0x73, 0xF7,
+    0x5E, 0xFF, 0x7A, 0x86, 0xB7, 0x82, 0xAE, 0xAA, 0xAB, 0xA6, 0xF5, 0xB7, 0xB8, 0xC7, 0xA1, 0x18,
+    0x26, 0x5E, 0x72, 0x3C, 0x54, 0x0A, 0xE2, 0xEA, 0x54, 0x7D, 0x9B, 0x77, 0x47, 0xA7, 0x44, 0x48,
+    0xE1, 0x59, 0xA9, 0x5A, 0xA3, 0x41, 0x57, 0xAD, 0x64, 0x9D, 0xCC, 0xD1, 0x43, 0xD2, 0x5B, 0xA5,
+    0xC8, 0x14, 0xE9, 0x71, 0x5D, 0xC1, 0x8A, 0xD1, 0x8F, 0xDD, 0x1C, 0xCF, 0x8E, 0x4A, 0xC3, 0x85,
+    0x8E, 0x0B, 0x2D, 0x17, 0x7A, 0x2E, 0x34, 0x5D, 0xE8, 0xBA, 0xD0, 0x76, 0xA1, 0xAF, 0x9B, 0x54,
+    0x1A, 0xAF, 0xF5, 0x2A, 0x9D, 0x8F, 0xD7, 0x2A, 0xAD, 0xD3, 0xE6, 0x5C, 0xEF, 0x4F, 0x92, 0xE6,
+    0x5C, 0xF3, 0x4F, 0xE3, 0xF5, 0xB9, 0xEE, 0x1F, 0xE9, 0xAD, 0xB9, 0xF6, 0x8F, 0x75, 0x6F, 0xAE,
+    0xFF, 0x43, 0x7D, 0x3C, 0xDF, 0x81, 0xF5, 0x61, 0x52, 0xED, 0x21, 0x0A, 0x17, 0xDA, 0x2B, 0x96,
+    0x97, 0x26, 0x24, 0xDB, 0x36, 0xE4, 0xE9, 0x61, 0xAC, 0x5C, 0xDD, 0x64, 0xFA, 0x29, 0x74, 0x57,
+    0xB1, 0x61, 0x54, 0x57, 0x0F, 0x3F, 0x4C, 0x95, 0xFB, 0x38, 0x69, 0x7A, 0xAF, 0xE9, 0xB6, 0x72,
+    0xC3, 0xEE, 0xAA, 0xC7, 0x2F, 0x35, 0x43, 0x3E, 0x1A, 0xF5, 0xDA, 0xB5, 0x1A, 0x46, 0xEB, 0xB2,
+    0x7A, 0x0A, 0xA4, 0xAB, 0x79, 0xA8, 0x39, 0xE6, 0xDB, 0xBA, 0x0A, 0x04, 0x7A, 0xCA, 0x0B, 0xDB,
+    0xDC, 0x47, 0xCD, 0x23, 0x38, 0xB6, 0xAE, 0x44, 0x6B, 0xD8, 0x09, 0x9C, 0x23, 0x78, 0x5D, 0xD4,
+    0x56, 0xD0, 0xAE, 0xA3, 0xEB, 0x01, 0x37, 0x71, 0x64, 0x6B, 0x15, 0x6C, 0x33, 0xD5, 0xB7, 0x98,
+    0xAE, 0x1E, 0x73, 0xCB, 0x22, 0xD8, 0x9A, 0x2E, 0xCA, 0x90, 0xD9, 0x89, 0x1B, 0x36, 0xB1, 0x29,
+    0xE5, 0x06, 0xD4, 0x39, 0xB3, 0xE2, 0x26, 0x66, 0xAE, 0x76, 0x43, 0xF8, 0x92, 0x4A, 0x23, 0x1A,
+    0x92, 0x88, 0xAC, 0x01, 0x1A, 0x37, 0xDD, 0xF7, 0x10, 0xEC, 0x59, 0xB9, 0x93, 0xEE, 0x59, 0x99,
+    0x93, 0xB6, 0xDC, 0x3F, 0x5B, 0x07, 0xF0, 0x89, 0x89, 0x11, 0x31, 0x89, 0x35, 0x04, 0xB1, 0x9A,
+    0x24, 0x9C, 0xB9, 0x61, 0x4F, 0x58, 0x95, 0xF9, 0x9D, 0xF9, 0x01, 0xB2, 0x0E, 0x0B, 0x42, 0x07,
+    0x76, 0xBA, 0x4D, 0x1D, 0xB7, 0xE0, 0xC4, 0x3D, 0x5A, 0x7B, 0x44, 0x20, 0x4D, 0x78, 0x0C, 0x37,
+    0x60, 0xBC, 0x40, 0x20, 0x66, 0x3D, 0x79, 0xBA, 0x21, 0x6C, 0x93, 0xE1, 0xBE, 0x8A, 0xB1, 0xE7,
+    0x3D, 0x7D, 0xE7, 0x15, 0xC1, 0xB6, 0x17, 0x4F, 0xED, 0xF4, 0xD8, 0x4A, 0xBF, 0xF8, 0x49, 0xEA,
+    0xFC, 0x36, 0x75, 0x7E, 0x1D, 0x3B, 0x7F, 0x09, 0xDC, 0x33, 0xB8, 0x31, 0x19, 0x48, 0x3D, 0xAA,
+    0x55, 0xC8, 0x4C, 0xE5, 0x53, 0xC8, 0x26, 0x4C, 0x41, 0x1C, 0xB0, 0x20, 0x16, 0x41, 0x83, 0xBF,
+    0xAF, 0xC9, 0x86, 0x5B, 0x75, 0xA9, 0x16, 0xCE, 0x67, 0x83, 0x28, 0xC0, 0x5B, 0xC5, 0x93, 0x39,
+    0xC9, 0x32, 0x7F, 0x59, 0xC5, 0x61, 0x14, 0x7A, 0x21, 0xF7, 0x24, 0xC9, 0xDB, 0x16, 0x8A, 0x1B,
+    0x52, 0xE2, 0x68, 0x20, 0x29, 0x35, 0x89, 0xC4, 0x27, 0x03, 0xD3, 0xAD, 0x8A, 0x1F, 0xAB, 0xC9,
+    0xDB, 0xC0, 0x47, 0xA1, 0xF5, 0x81, 0x96, 0xC2, 0x89, 0x23, 0x9A, 0x9E, 0x0E, 0xE8, 0xA2, 0xFE,
+    0x74, 0x27, 0x26, 0x3E, 0x63, 0xB9, 0x5A, 0x33, 0x1D, 0xF0, 0xB6, 0xFE, 0x07, 0xD9, 0xD2, 0xCB,
+    0x05, 0xCD, 0xE7, 0x14, 0xF2, 0xDE, 0x79, 0xB8, 0x6F, 0x62, 0x5E, 0xC9, 0x57, 0x65, 0x49, 0xC5,
+    0xBB, 0xCE, 0xA2, 0x77, 0x43, 0xC9, 0xF2, 0x6B, 0xB2, 0xBC, 0x3F, 0xB6, 0xB9, 0xC0, 0xCE, 0x11,
+    0xE5, 0x9D, 0xF3, 0x80, 0x6B, 0xFB, 0x6D, 0xCD, 0xD5, 0xF8, 0x72, 0xC6, 0x85, 0xA3, 0x0D, 0xB3,
+    0x8C, 0x2B, 0xCD, 0xE8, 0x9F, 0x49, 0x15, 0x9C, 0x37, 0x81, 0x6E, 0xE9, 0x63, 0xF1, 0x8A, 0x24,
+    0x95, 0xA4, 0x93, 0x44, 0xE3, 0x6E, 0xA9, 0x9C, 0x44, 0x91, 0x1B, 0x98, 0x0D, 0x31, 0xD2, 0x9F,
+    0xBE, 0x66, 0xDE, 0x8A, 0x4D, 0x65, 0x93, 0x86, 0x01, 0xC6, 0x33, 0xEC, 0x01, 0x53, 0xA9, 0xF0,
+    0x30, 0x15, 0xDE, 0x66, 0xC6, 0x33, 0xEA, 0x62, 0x59, 0xEE, 0xEF, 0xE0, 0xFD, 0x43, 0x8A, 0x76,
+    0xD9, 0x19, 0x7C, 0xA0, 0x63, 0x8C, 0xB3, 0x65, 0x7C, 0x40, 0xA2, 0xA8, 0x4C, 0xD3, 0x4E, 0x0E,
+    0x2B, 0xBF, 0xC4, 0x42, 0x02, 0xD7, 0x70, 0xA1, 0xC3, 0xEF, 0x6A, 0xEB, 0xE7, 0xFF, 0x83, 0x05,
+    0x57, 0xCE, 0x36, 0xBB, 0xC8, 0x36, 0xEF, 0x3C, 0xF0, 0xCE, 0xC1, 0x80, 0x28, 0x63, 0xE2, 0xC4,
+    0x49, 0x18, 0x16, 0xC7, 0x76, 0x7A, 0xDB, 0x4A, 0x6F, 0xDB, 0x95, 0x72, 0xAE, 0x61, 0xCB, 0x28,
+    0xE4, 0x7A, 0x24, 0x7A, 0x48, 0xA0, 0x54, 0xB1, 0x52, 0x86, 0x0B, 0xD7, 0xE7, 0x2F, 0x57, 0x21,
+    0x0A, 0xDC, 0x33, 0xD1, 0xF3, 0xA8, 0x92, 0x8C, 0x4B, 0x62, 0x3B, 0x22, 0xB5, 0x8F, 0xA9, 0x84,
+    0x34, 0x65, 0x6E, 0x81, 0x22, 0x89, 0x64, 0xCB, 0xC5, 0x8D, 0x4F, 0xA4, 0xC9, 0xA6, 0x42, 0x9C,
+    0x8A, 0xB4, 0x44, 0x84, 0x49, 0x68, 0x33, 0x70, 0x6A, 0x58, 0x64, 0xAC, 0x91, 0xC3, 0xD8, 0x3E,
+    0x85, 0xD2, 0x14, 0xA1, 0xC2, 0x8B, 0x42, 0x32, 0xBB, 0x38, 0x40, 0xA6, 0xDE, 0x99, 0x49, 0xE6,
+    0x50, 0xCE, 0x1A, 0x46, 0x76, 0x72, 0x03, 0x23, 0x5A, 0x09, 0x53, 0x3A, 0xC6, 0x9A, 0xF1, 0xE2,
+    0xC6, 0x4C, 0xC0, 0x4E, 0xE0, 0x06, 0xEC, 0xB7, 0x9E, 0x70, 0x96, 0x04, 0xA7, 0x20, 0x27, 0xB8,
+    0xC0, 0x69, 0x5B, 0xAC, 0xB9, 0xCF, 0x53, 0x0F, 0xB7, 0xE4, 0x2F, 0x5E, 0xFF, 0xF2, 0x3B, 0x3F,
+    0x8B, 0x0A, 0x06, 0xD2, 0xD4, 0xF8, 0x76, 0xD7, 0xC4, 0xF6, 0x91, 0x69, 0xA2, 0x89, 0x84, 0x89,
+    0x74, 0xED, 0x72, 0x85, 0x12, 0x1A, 0x1E, 0xE6, 0xDD, 0xFE, 0x1A, 0x8A, 0xE2, 0x1C, 0xEA, 0x6E,
+    0xA1, 0x5D, 0xAF, 0x88, 0x09, 0xC9, 0x05, 0x90, 0x67, 0x79, 0x1F, 0xB8, 0xDE, 0x1B, 0x70, 0x49,
+    0x73, 0x15, 0xF0, 0xBD, 0x03, 0x44, 0xEE, 0x0C, 0xF6, 0xE1, 0x61, 0xE8, 0x9F, 0x47, 0x61, 0x3F,
+    0x6F, 0xF3, 0x80, 0x74, 0x19, 0xFA, 0xF9, 0x1A, 0xFC, 0xA2, 0x88, 0x31, 0x18, 0x04, 0xF7, 0x0F,
+    0x7F, 0x8A, 0xCE, 0x3F, 0x8B, 0xC0, 0x79, 0xAD, 0xD0, 0x84, 0xF8, 0x02, 0x68, 0x97, 0xC0, 0x34,
+    0x67, 0xBA, 0xEF, 0x94, 0xFD, 0x02, 0xAD, 0x36, 0xB6, 0x5B, 0x70, 0x7F, 0x91, 0x2D, 0x15, 0x4F,
+    0xA2, 0x33, 0xFC, 0xF8, 0x27, 0x31, 0xFE, 0x9A, 0x5A, 0x49, 0xC0, 0xA3, 0xCF, 0x12, 0xED, 0xEE,
+    0x6B, 0x15, 0x5C, 0x76, 0x7D, 0x1F, 0x11, 0x1D, 0x77, 0x44, 0x73, 0xB4, 0xCD, 0xC9, 0x43, 0xFA,
+    0x2C, 0xAB, 0xCB, 0x93, 0x97, 0x59, 0x1B, 0x71, 0x3C, 0x64, 0xDE, 0xB0, 0xF9, 0x2F, 0xE3, 0x05,
+    0x83, 0xE2, 0x97, 0x68, 0xD3, 0xD5, 0x35, 0xE0, 0xC4, 0x8B, 0x19, 0x04, 0xD1, 0xF9, 0x85, 0xAF,
+    0x34, 0x72, 0xCC, 0x9E, 0x99, 0xC5, 0x01, 0x2B, 0x41, 0xCC, 0x3A, 0x70, 0xE0, 0xF0, 0x30, 0x63,
+    0xFF, 0xF0, 0xFB, 0xCC, 0xB9, 0x6F, 0x84, 0xF0, 0xBE, 0x66, 0x8E, 0x49, 0x65, 0x47, 0x61, 0x78,
+    0xD2, 0xEC, 0xFE, 0x37, 0xAF, 0xC1, 0xFE, 0xD7, 0x14, 0x56, 0x94, 0xC9, 0x21, 0x06, 0xDD, 0xAF,
+    0x32, 0x99, 0x1E, 0xB0, 0xC0, 0xA6, 0xAC, 0x4F, 0xF7, 0xA4, 0x45, 0x06, 0xFE, 0xBB, 0x50, 0xDF,
+    0x32, 0xC1, 0xDC, 0x36, 0x2E, 0xDD, 0x30, 0xFE, 0x34, 0xE5, 0x4A, 0x9C, 0x19, 0x48, 0xC5, 0xF2,
+    0xCC, 0xF7, 0x95, 0x1E, 0xBA, 0x7B, 0xD8, 0xDC, 0xAA, 0x44, 0xC4, 0xDE, 0xDA, 0x49, 0x7D, 0xD3,
+    0xFF, 0xDE, 0x03, 0x37, 0x6B, 0x80, 0xE6, 0xB8, 0x25, 0x59, 0x5A, 0x9C, 0xC1, 0xFE, 0x2C, 0xB8,
+    0x1B, 0x4B, 0x4D, 0xD8, 0x95, 0x8A, 0xB9, 0x52, 0x62, 0xDF, 0x14, 0xFE, 0x6A, 0x65, 0xD7, 0xFB,
+    0x51, 0x6A, 0x7D, 0xAC, 0x5F, 0x8D, 0xEE, 0x8F, 0xA3, 0x08, 0xF4, 0xF8, 0x9F, 0x12, 0xB5, 0x32,
+    0xB4, 0x58, 0x2E, 0xBF, 0x50, 0x22, 0x31, 0xAE, 0xCE, 0xD8, 0x3F, 0xF8, 0xD0, 0x90, 0xBC, 0x95,
+    0x75, 0xB2, 0xB0, 0x40, 0xF9, 0x75, 0x3A, 0xEF, 0x87, 0x27, 0xD2, 0x10, 0x67, 0xEC, 0x88, 0xBF,
+    0x4A, 0xD8, 0x12, 0xDF, 0xD1, 0xEC, 0x89, 0x4E, 0xC8, 0xA6, 0xE8, 0xCC, 0xB1, 0xC5, 0x18, 0x4A,
+    0x97, 0xE0, 0x95, 0xFE, 0xBA, 0x06, 0x04, 0xFB, 0x70, 0x52, 0x81, 0x2D, 0x49, 0xF5, 0x45, 0x0B,
+    0x9E, 0xE3, 0x96, 0xE9, 0x74, 0x07, 0x56, 0x90, 0xC3, 0x4D, 0x04, 0x86, 0x72, 0x1C, 0x9D, 0x13,
+    0x33, 0x6D, 0x4A, 0xF0, 0x2F, 0x2A, 0xE5, 0xC4, 0x82, 0x27, 0xF7, 0xB2, 0x1F, 0x3F, 0x9A, 0x5E,
+    0x74, 0xEA, 0xE8, 0xD1, 0xBC, 0x10, 0xF8, 0x17, 0xE8, 0xFF, 0x6B, 0xBC, 0x09, 0x3B, 0xAC, 0xE4,
+    0xC9, 0xEF, 0x67, 0x10, 0x2A, 0xDA, 0xB9, 0xDC, 0xC6, 0x12, 0x82, 0x69, 0xDD, 0x49, 0x04, 0xEE,
+    0xD4, 0xAD, 0xD0, 0xD4, 0x60, 0xC2, 0xE0, 0xBB, 0x83, 0x1D, 0xFE, 0x41, 0x48, 0xAA, 0x67, 0x81,
+    0x51, 0xDD, 0x89, 0x05, 0x6F, 0xC8, 0x3B, 0xF6, 0x4E, 0xF7, 0x84, 0xBE, 0x75, 0x7A, 0x6A, 0xCE,
+    0x98, 0xE6, 0x71, 0x9A, 0xE7, 0x8D, 0x4B, 0x17, 0x51, 0x3F, 0x4A, 0xCA, 0x53, 0xE0, 0x95, 0x4E,
+    0x9F, 0xA9, 0xDE, 0x90, 0x79, 0xA5, 0xD3, 0x67, 0xD2, 0xD7, 0x7E, 0xA0, 0xB0, 0x8C, 0x17, 0xE3,
+    0x32, 0xD5, 0x58, 0x80, 0xFA, 0xBA, 0xD2, 0xE5, 0x79, 0xB8, 0x0A, 0x5F, 0xD1, 0x93, 0xC9, 0x2B,
+    0xE1, 0x55, 0xF8, 0x9E, 0xE2, 0xAA, 0x7B, 0xFB, 0x0F, 0x8D, 0x94, 0xBF, 0x6F, 0xDB, 0x46, 0x14,
+    0xC7, 0x3F, 0xA7, 0xB3, 0x74, 0xB0, 0x2E, 0x22, 0x35, 0x24, 0x40, 0x5D, 0xE8, 0x87, 0x87, 0x0C,
+    0x0D, 0x4A, 0x4A, 0x1D, 0x34, 0xA8, 0x01, 0x95, 0x5C, 0x92, 0xB1, 0x8B, 0x07, 0x7B, 0xE8, 0x54,
+    0xA0, 0xE8, 0x92, 0x0E, 0x2E, 0x07, 0x0F, 0x1E, 0xE4, 0x98, 0xCE, 0x5F, 0xA0, 0xDD, 0x40, 0x61,
+    0x74, 0xEB, 0xD2, 0x6A, 0xF0, 0xA0, 0xC1, 0xA9, 0x0F, 0xE8, 0xD0, 0x95, 0x5B, 0xD1, 0x29, 0xDC,
+    0x32, 0x14, 0x68, 0x84, 0xC2, 0x43, 0x5A, 0xD4, 0x55, 0x1F, 0xA9, 0xC6, 0xC8, 0xD0, 0xA1, 0xF7,
+    0x0E, 0xC4, 0xC3, 0xE3, 0xC3, 0xBB, 0x77, 0xDF, 0xCF, 0x23, 0xD9, 0xA2, 0xF6, 0xAB, 0xB7, 0xCF,
+    0x8B, 0x50, 0x2D, 0x07, 0x6A, 0x39, 0xA9, 0xC9, 0x2E, 0x12, 0x9D, 0x27, 0xC6, 0x4F, 0x42, 0xC2,
+    0x17, 0xA8, 0x19, 0x75, 0x42, 0xCA, 0x35, 0x25, 0x22, 0x61, 0xCC, 0x88, 0x54, 0x6C, 0x82, 0xBC,
+    0xA0, 0xEF, 0x38, 0x86, 0x97, 0xE8, 0x7D, 0x5A, 0x31, 0xA3, 0x09, 0x97, 0xAB, 0x5C, 0x12, 0x59,
+    0xD0, 0xB8, 0x46, 0xED, 0xC1, 0x9E, 0xD3, 0xAB, 0x42, 0x93, 0x37, 0x60, 0x13, 0xC2, 0x15, 0x1B,
+    0x36, 0xC3, 0xF8, 0xBB, 0xC6, 0x27, 0x36, 0x1B, 0xFE, 0x40, 0x7D, 0x07, 0xBE, 0x40, 0xBF, 0x26,
+    0x34, 0x2E, 0x56, 0x24, 0x3B, 0x1C, 0xFF, 0xC5, 0x62, 0xC0, 0x55, 0x9F, 0xF3, 0x1E, 0x8B, 0x09,
+    0x0F, 0xDE, 0xD0, 0x70, 0xDC, 0xD9, 0xE3, 0x78, 0xC5, 0x59, 0x40, 0xD6, 0x41, 0x1A, 0xA0, 0x40,
+    0x79, 0xB4, 0xC3, 0x82, 0x04, 0xC6, 0xD0, 0x96, 0x06, 0xBF, 0x44, 0xBF, 0xCA, 0xCD, 0xC9, 0xD2,
+    0x9E, 0x14, 0xE6, 0xE7, 0xAC, 0x76, 0x8D, 0xBD, 0x74, 0x03, 0xEB, 0x13, 0xED, 0x13, 0x93, 0xF5,
+    0xBF, 0x47, 0xED, 0xC2, 0x2E, 0xF6, 0x3B, 0x06, 0xD6, 0x4D, 0x6C, 0x26, 0x0D, 0x4C, 0x42, 0xD7,
+    0xBF, 0x44, 0x7D, 0x46, 0x3B, 0x26, 0x4D, 0x78, 0xB6, 0xE4, 0x7D, 0x87, 0x72, 0x65, 0xF1, 0xF5,
+    0x5E, 0xAD, 0xDC, 0x8D, 0x8F, 0x2B, 0x55, 0x90, 0xC8, 0xCD, 0x73, 0xBD, 0xD6, 0x7E, 0xAC, 0xAE,
+    0x8C, 0x97, 0x72, 0x22, 0x4C, 0x72, 0x63, 0xB1, 0x48, 0x67, 0xB2, 0x32, 0xA9, 0x96, 0xA9, 0x82,
+    0x73, 0x91, 0x66, 0xFD, 0x62, 0xCA, 0x21, 0x57, 0x6A, 0xA9, 0xF3, 0xD0, 0x1D, 0x21, 0x12, 0xDC,
+    0xE6, 0x48, 0xDA, 0x0A, 0x49, 0x02, 0xC6, 0x2D, 0x46, 0x1D, 0xD2, 0x88, 0x79, 0xC4, 0x99, 0xE8,
+    0xFB, 0x29, 0xB5, 0xD7, 0x99, 0x7D, 0x92, 0xF7, 0x6A, 0x45, 0xC5, 0xA6, 0x98, 0xEA, 0x7C, 0xAA,
+    0xFD, 0x54, 0x2E, 0x10, 0xD2, 0xBF, 0x28, 0x09, 0x09, 0x89, 0x23, 0x7B, 0x51, 0x9F, 0x4A, 0xD9,
+    0x05, 0x57, 0x2C, 0xD5, 0xB2, 0x56, 0x7C, 0xF8, 0xC7, 0x9D, 0x5D, 0x9E, 0x62, 0x5F, 0x66, 0xA1,
+    0xF6, 0x0D, 0xED, 0xCB, 0x3E, 0x84, 0x63, 0x52, 0x6A, 0xA7, 0x1F, 0xD1, 0xD5, 0x82, 0x8A, 0x3D,
+    0x21, 0xF4, 0x14, 0x2D, 0x13, 0xF0, 0xA4, 0xA8, 0xE9, 0x1C, 0x9B, 0xA9, 0x6B, 0xF8, 0x0A, 0xAC,
+    0xDF, 0x36, 0xFE, 0x30, 0x74, 0x0F, 0xD6, 0x84, 0x84, 0xF4, 0x10, 0x44, 0xA9, 0xDF, 0x30, 0x13,
+    0x3A, 0x09, 0xA3, 0x44, 0xAE, 0xED, 0xE5, 0x34, 0x39, 0x4E, 0x48, 0xD7, 0x77, 0x05, 0xB6, 0x90,
+    0xCE, 0x8D, 0xF2, 0x9B, 0xB8, 0x5B, 0x42, 0xFA, 0x6F, 0x36, 0x42, 0xE1, 0x93, 0x7D, 0x64, 0x33,
+    0xA9, 0xF3, 0xF0, 0xC5, 0xFF, 0x25, 0x5D, 0xDF, 0x73, 0xC3, 0x95, 0x1F, 0x19, 0xB7, 0xDD, 0xAC,
+    0xD8, 0x0A, 0xEC, 0x79, 0x05, 0x3B, 0x2B, 0x61, 0x77, 0x4B, 0xA9, 0xAA, 0x9E, 0x5F, 0x79, 0xFB,
+    0xB8, 0x08, 0x1F, 0xE7, 0xF6, 0xA7, 0x4C, 0x97, 0xA4, 0x99, 0x84, 0xD9, 0xD4, 0x88, 0x2C, 0x6E,
+    0xB8, 0x8F, 0xDA, 0x29, 0x65, 0x91, 0xF1, 0x95, 0x21, 0x9E, 0xAE, 0x77, 0x9F, 0xE1, 0x25, 0xF5,
+    0xFD, 0x52, 0x81, 0xE2, 0x9C, 0x3F, 0x0B, 0xB6, 0xA4, 0x8E, 0xB4, 0x74, 0xF6, 0xEF, 0x7E, 0x28,
+    0xD7, 0x79, 0xEB, 0x97, 0x71, 0xAA, 0xC8, 0xDB, 0xE7, 0x7A, 0xAD, 0xFD, 0xEE, 0x9A, 0x74, 0xAF,
+    0x22, 0x3D, 0xAD, 0x2C, 0x11, 0xBF, 0x87, 0x75, 0xAA, 0x9C, 0x04, 0xCF, 0xB2, 0x0A, 0x0C, 0x2A,
+    0x8B, 0xAB, 0xB4, 0x85, 0x5A, 0x1A, 0x3F, 0x64, 0x1B, 0xF5, 0x2D, 0xD6, 0x12, 0x59, 0xC6, 0x01,
+    0x69, 0xAB, 0x64, 0x3C, 0x9F, 0x72, 0xFF, 0xEB, 0x6C, 0x6B, 0x13, 0xB5, 0x08, 0xBA, 0x51, 0x77,
+    0x34, 0x7E, 0x36, 0x9B, 0x73, 0xC0, 0x24, 0x6D, 0x38, 0xB5, 0x20, 0x08, 0x89, 0x8C, 0x13, 0x39,
+    0x52, 0xCB, 0x3C, 0x24, 0xED, 0xF2, 0xF1, 0x41, 0x29, 0x53, 0xF3, 0xD1, 0x4C, 0xFF, 0xE8, 0xD4,
+    0x2F, 0xF0, 0xA6, 0x12, 0x68, 0x81, 0x89, 0xE8, 0x04, 0xB4, 0xEB, 0xD8, 0xD9, 0xDD, 0x43, 0x39,
+    0x32, 0xEA, 0x5F, 0x1C, 0x8C, 0x8B, 0xF9, 0xEF, 0x7E, 0xAB, 0xFC, 0x4A, 0x0D, 0xA5, 0x7C, 0x41,
+    0x4C, 0x70, 0x2A, 0x00, 0xE8, 0x48, 0x0F, 0xEB, 0x51, 0xEB, 0x92, 0x06, 0x59, 0xBB, 0xF1, 0x4E,
+    0x4E, 0x33, 0x0B, 0x9A, 0xDC, 0xFA, 0x80, 0x4E, 0xCE, 0xB0, 0x60, 0x3C, 0x67, 0x34, 0x26, 0x8D,
+    0xCB, 0xCA, 0x7D, 0x67, 0x24, 0x23, 0x10, 0x6B, 0x09, 0x9A, 0xA8, 0xFA, 0x17, 0xDC, 0xE7, 0x3D,
+    0xEE, 0xC5, 0x4D, 0xD7, 0x3B, 0xFD, 0xDC, 0xF7, 0xCD, 0x73, 0xDF, 0xB1, 0x3A, 0x8B, 0x02, 0xED,
+    0xC6, 0x2D, 0x69, 0xBB, 0x63, 0x48, 0x3B, 0x66, 0xD6, 0xDE, 0x50, 0xEE, 0x5E, 0x4C, 0xEF, 0x94,
+    0xFE, 0x7F, 0x1D, 0xDD, 0xFC, 0xC4, 0xE9, 0x6F, 0xBC, 0x39, 0x91, 0xE9, 0xC9, 0x6D, 0xCD, 0x07,
+    0xDA, 0xB7, 0x0C, 0xBD, 0x2E, 0xF1, 0xAC, 0xFC, 0xB2, 0x65, 0x00, 0x8E, 0xA0, 0x71, 0x16, 0x8D,
+    0xC7, 0xB7, 0x07, 0x98, 0x9C, 0xB9, 0x4F, 0xE7, 0xC5, 0x96, 0x53, 0x68, 0xFA, 0xB3, 0xDE, 0x3B,
+    0xAD, 0x4C, 0xDC, 0x26, 0xFF, 0x00, 0x55, 0x56, 0x5D, 0x88, 0x24, 0x57, 0x15, 0xFE, 0xAA, 0xEE,
+    0xCE, 0x96, 0xCE, 0xDD, 0xDD, 0x9B, 0x87, 0xE8, 0xAE, 0xFB, 0x77, 0xF3, 0x90, 0x87, 0x21, 0x4C,
+    0xA6, 0xC6, 0xB5, 0xC5, 0x15, 0xFA, 0xA7, 0xE2, 0x22, 0x4B, 0x88, 0xE8, 0x3C, 0x64, 0x20, 0x20,
+    0x61, 0x03, 0x79, 0x52, 0xD1, 0x19, 0x74, 0x91, 0x45, 0xBA, 0xD3, 0xA5, 0x3E, 0x26, 0xE0, 0x04,
+    0xD1, 0x80, 0xA0, 0xAE, 0x3F, 0x08, 0x4E, 0xC4, 0xDD, 0x87, 0x08, 0x0D, 0xF6, 0xEC, 0xDC, 0xFC,
+    0x40, 0x88, 0x28, 0x96, 0xC2, 0xE2, 0x43, 0x14, 0x0A, 0xD9, 0x71, 0xC5, 0x3C, 0x6C, 0x09, 0x95,
+    0xA4, 0x66, 0xD3, 0xDD, 0xE5, 0x77, 0x6E, 0xF5, 0xEC, 0x62, 0x35, 0xF7, 0xDC, 0xDB, 0xB7, 0xAB,
+    0xCF, 0x3D, 0x3F, 0xDF, 0x77, 0xCE, 0x05, 0xF8, 0x0C, 0x73, 0xA8, 0xAC, 0x82, 0x49, 0xAE, 0x60,
+    0x85, 0x5F, 0xDB, 0x1C, 0xE3, 0x85, 0xF5, 0xB5, 0x91, 0xAD, 0xAB, 0x52, 0xB9, 0xCB, 0x65, 0xE4,
+    0x56, 0x47, 0x3A, 0x7D, 0xA0, 0x63, 0x12, 0xE8, 0xBA, 0x4E, 0x60, 0xF9, 0x82, 0x8C, 0x15, 0xAC,
+    0xA1, 0x03, 0x87, 0x7E, 0xE8, 0x54, 0x5D, 0xA7, 0x50, 0xA7, 0x01, 0xB5, 0x04, 0xE8, 0x29, 0x75,
+    0x0E, 0x5D, 0x38, 0xFD, 0x94, 0xD3, 0x2F, 0x3C, 0xEB, 0xEC, 0x91, 0x9F, 0xA1, 0x73, 0x22, 0x43,
+    0xFF, 0x61, 0x87, 0xF1, 0xAA, 0x43, 0xF5, 0xF1, 0x14, 0xE5, 0xD7, 0x13, 0x94, 0xCF, 0x02, 0xE5,
+    0xF7, 0x81, 0xD1, 0x9B, 0x87, 0xD0, 0xF9, 0xC3, 0x32, 0xEC, 0x9D, 0x12, 0xAA, 0xDE, 0x82, 0xFA,
+    0x1C, 0xEE, 0xA9, 0xF2, 0xCF, 0x61, 0x6E, 0x76, 0x2F, 0x96, 0x41, 0x19, 0x54, 0x2A, 0x43, 0x69,
+    0x52, 0x6C, 0xC5, 0xDC, 0xEE, 0x72, 0xF4, 0x7B, 0xDF, 0xCB, 0xC6, 0xFA, 0x57, 0x79, 0xA5, 0xB7,
+    0xD2, 0xCA, 0x38, 0xFE, 0x48, 0xBD, 0x06, 0xA8, 0x68, 0xDF, 0x78, 0x25, 0x40, 0xB7, 0xA3, 0x61,
+    0x67, 0x3B, 0x08, 0xEB, 0xB2, 0xD1, 0x55, 0xD7, 0x33, 0xC4, 0x3F, 0x78, 0x0E, 0x06, 0x67, 0xE8,
+    0xC3, 0x69, 0xFA, 0xF0, 0x21, 0xFA, 0xD0, 0x38, 0xDD, 0xE7, 0x18, 0xAC, 0x03, 0xBB, 0xF4, 0x51,
+    0x5E, 0x2F, 0x80, 0x53, 0x77, 0xB7, 0x70, 0xFC, 0xDD, 0x04, 0x2A, 0xA7, 0x3D, 0x19, 0x5D, 0xE3,
+    0x4C, 0x0D, 0xCD, 0x13, 0xEC, 0xE6, 0xD0, 0x2F, 0x4E, 0xA8, 0xA7, 0x4F, 0x1D, 0xE7, 0xA9, 0xE3,
+    0x01, 0xAF, 0x67, 0x3E, 0xA2, 0x7A, 0xDA, 0x18, 0xC9, 0xA0, 0x9A, 0x7A, 0x82, 0x7B, 0xE7, 0x5C,
+    0x07, 0xC2, 0xFF, 0x60, 0xCD, 0xD6, 0xB5, 0x5B, 0x8A, 0x0E, 0x94, 0x21, 0x4C, 0x44, 0x46, 0x7E,
+    0x7D, 0x14, 0xF8, 0x48, 0xF2, 0xCB, 0x47, 0xAF, 0x62, 0xF8, 0xE6, 0xAC, 0x37, 0x81, 0xFE, 0x7B,
+    0xFC, 0x4A, 0x07, 0xBA, 0xB0, 0x59, 0x07, 0xC6, 0xD9, 0x94, 0x32, 0x8D, 0xA9, 0xCA, 0x52, 0x7D,
+    0x1F, 0xB2, 0x1A, 0xF9, 0x55, 0xC9, 0x23, 0xC6, 0x34, 0xBB, 0x8D, 0x2A, 0x28, 0xD0, 0x57, 0x22,
+    0x47, 0x51, 0x89, 0xFD, 0xB4, 0x3A, 0x56, 0x62, 0x17, 0xF4, 0x57, 0x9E, 0x96, 0x97, 0xCF, 0x78,
+    0xB9, 0x9B, 0x50, 0x7F, 0x9C, 0x46, 0x19, 0x15, 0x2B, 0xA6, 0x36, 0x53, 0xB4, 0x37, 0xA7, 0x15,
+    0x9F, 0x2E, 0x34, 0x45, 0x79, 0x4C, 0x52, 0x5E, 0x17, 0xD8, 0xEC, 0x9F, 0xC6, 0xC2, 0xEF, 0x06,
+    0x5F, 0x4D, 0x68, 0x75, 0xED, 0x90, 0xC5, 0x54, 0xE2, 0x4C, 0x0B, 0x81, 0x33, 0x05, 0xC2, 0x54,
+    0x17, 0x50, 0x69, 0xC4, 0x70, 0xA4, 0x8C, 0xD2, 0xB0, 0x0C, 0x1D, 0x11, 0x40, 0x44, 0x30, 0x80,
+    0xFF, 0xAA, 0xC4, 0x2B, 0x37, 0xA0, 0xD4, 0xAE, 0x47, 0x29, 0xA6, 0x53, 0x26, 0x22, 0x6D, 0xD2,
+    0xFB, 0xB0, 0x60, 0xA9, 0x4B, 0xC3, 0x62, 0x4C, 0x98, 0x80, 0x6E, 0xF4, 0x7E, 0x9D, 0xA3, 0x37,
+    0x4B, 0x46, 0x3E, 0x1F, 0x4C, 0xC3, 0xD8, 0x27, 0xA2, 0x91, 0x15, 0xE8, 0x11, 0x37, 0x03, 0x22,
+    0x56, 0xD6, 0x49, 0x8F, 0xB6, 0xF8, 0x73, 0x7C, 0x6E, 0x67, 0x7E, 0x15, 0xBF, 0xE4, 0x73, 0x6D,
+    0xE5, 0x3F, 0xA2, 0x76, 0xD0, 0x4C, 0x1D, 0x7C, 0x49, 0xD2, 0x31, 0xD0, 0xEF, 0x64, 0x12, 0xA6,
+    0xB3, 0x12, 0x21, 0x54, 0x1D, 0xE4, 0x18, 0xEB, 0x4C, 0xD2, 0xC4, 0x74, 0xC5, 0xCC, 0x41, 0xD5,
+    0x87, 0xA1, 0x82, 0xB2, 0x83, 0x70, 0xC6, 0x23, 0x68, 0x72, 0x9C, 0x84, 0x45, 0x2C, 0xE6, 0xAB,
+    0xDC, 0xA6, 0x2E, 0x72, 0x2A, 0x33, 0xAF, 0x66, 0x51, 0xAA, 0xF3, 0x28, 0x2F, 0x2D, 0x11, 0x15,
+    0x4C, 0x86, 0xD5, 0x41, 0x16, 0xE3, 0x1A, 0x1F, 0x43, 0x6F, 0xC2, 0xA0, 0x77, 0xA1, 0x33, 0xC2,
+    0xE6, 0x39, 0x06, 0x86, 0x53, 0x0D, 0x0D, 0x55, 0x04, 0x35, 0x53, 0x1B, 0x16, 0xEA, 0x1A, 0x96,
+    0x65, 0xB2, 0x04, 0x4D, 0x58, 0x2C, 0x5A, 0x22, 0x62, 0x58, 0xCB, 0x93, 0x7E, 0x74, 0x7F, 0xB0,
+    0xF1, 0xD2, 0x4D, 0x1E, 0xDB, 0x32, 0x17, 0xE8, 0x4C, 0x79, 0xDD, 0x3C, 0x41, 0xA5, 0x65, 0x66,
+    0x3E, 0xCF, 0xE9, 0x3D, 0x67, 0x7E, 0xC3, 0xE9, 0x83, 0xC4, 0x8C, 0xC4, 0x5C, 0x02, 0x82, 0xD3,
+    0xD4, 0x63, 0x92, 0xBE, 0x6A, 0x1F, 0xF3, 0x5B, 0x61, 0x3E, 0x58, 0xBF, 0xA1, 0xF2, 0x3E, 0xAC,
+    0x08, 0xF3, 0x5D, 0x0A, 0x4D, 0x71, 0x52, 0x84, 0xD5, 0xAF, 0xFF, 0x9F, 0x88, 0x64, 0x8F, 0xD8,
+    0x16, 0x91, 0x51, 0x44, 0xAE, 0x6F, 0xD7, 0x37, 0x92, 0xBE, 0xAD, 0xF7, 0x25, 0x45, 0x12, 0xC6,
+    0x50, 0xCE, 0x90, 0xA0, 0x93, 0xE1, 0x5C, 0x09, 0x0F, 0x3C, 0x11, 0xEC, 0x07, 0x3C, 0x6E, 0x44,
+    0xC6, 0x85, 0xB9, 0x4E, 0xF9, 0x47, 0x92, 0xD2, 0xA4, 0x46, 0x6A, 0x83, 0x95, 0x60, 0xC7, 0x12,
+    0xEA, 0xAE, 0x8F, 0xB7, 0x88, 0x1D, 0xEE, 0x85, 0x5C, 0xD9, 0x9F, 0x74, 0x37, 0xA1, 0xAB, 0x38,
+    0xC3, 0xFD, 0x67, 0x28, 0x8A, 0xBF, 0xBC, 0xBD, 0x7D, 0xF0, 0x9D, 0xA4, 0x8A, 0xFE, 0x52, 0xF9,
+    0xF4, 0xB5, 0x71, 0x19, 0xA3, 0x86, 0x88, 0x62, 0x07, 0xEB, 0x11, 0x4E, 0xED, 0x3D, 0xC9, 0xD3,
+    0x00, 0x49, 0xFC, 0xA9, 0x9B, 0x89, 0xF7, 0x5A, 0x86, 0xEC, 0xA9, 0x3C, 0x40, 0xB0, 0xFF, 0x34,
+    0x55, 0xCE, 0xC9, 0xBE, 0x3B, 0x8D, 0xA9, 0x28, 0x37, 0xB9, 0xD8, 0x26, 0x98, 0x6B, 0x0B, 0x2C,
+    0xA8, 0x29, 0x8E, 0x18, 0xDC, 0xF8, 0xAC, 0x14, 0x91, 0x2B, 0x42, 0x4E, 0x9A, 0xB0, 0xB0, 0xB3,
+    0xF3, 0x24, 0xC3, 0x28, 0x40, 0xA8, 0x04, 0xA6, 0x95, 0x25, 0x16, 0x4A, 0x3A, 0x18, 0x14, 0xD4,
+    0x1F, 0x16, 0x04, 0x77, 0x54, 0xA8, 0x92, 0xE6, 0xE2, 0x86, 0xFC, 0xA3, 0xB2, 0x5F, 0xDC, 0x2B,
+    0x97, 0x23, 0x77, 0xB9, 0xA5, 0xDD, 0xE6, 0x43, 0x26, 0x7D, 0x08, 0xE6, 0xB3, 0xD4, 0x4E, 0xCA,
+    0xC7, 0x8C, 0x07, 0x5D, 0x3A, 0xDA, 0x65, 0xFD, 0xEA, 0xDD, 0x42, 0x20, 0xCE, 0x93, 0xFD, 0x0F,
+    0x0B, 0x46, 0x64, 0xD0, 0x38, 0x82, 0x77, 0xCE, 0x8F, 0xF9, 0xA3, 0x70, 0xC0, 0x7B, 0x3E, 0x0B,
+    0x1E, 0xB1, 0xE1, 0xDE, 0x7B, 0xB9, 0x9F, 0xF3, 0xB6, 0x7F, 0xC3, 0x9D, 0xF5, 0xF5, 0xC1, 0x19,
+    0x99, 0x74, 0xA2, 0xA5, 0x5C, 0x18, 0x88, 0x23, 0x32, 0x39, 0x8F, 0x78, 0x3F, 0xAD, 0x34, 0x13,
+    0x0B, 0x46, 0xEA, 0x0B, 0x8E, 0xB9, 0x38, 0x11, 0x2E, 0x99, 0x63, 0xFC, 0x27, 0x2B, 0xFC, 0x72,
+    0x94, 0xC4, 0x25, 0xDA, 0xED, 0x28, 0xDD, 0x2A, 0x50, 0xF6, 0xA3, 0xE4, 0xC5, 0x7F, 0x44, 0xD9,
+    0x8E, 0x41, 0xEF, 0x33, 0x33, 0xBC, 0xDF, 0xE0, 0xB8, 0x68, 0xCA, 0x5B, 0x33, 0x85, 0x79, 0x63,
+    0x61, 0x93, 0x33, 0xE5, 0x0E, 0xCA, 0x15, 0x0B, 0x97, 0x7E, 0x3E, 0x81, 0x51, 0xCC, 0x3C, 0xF9,
+    0x6E, 0xC2, 0xB4, 0x59, 0x5F, 0xA0, 0x3D, 0xCF, 0xF3, 0xB7, 0x3F, 0xF1, 0x65, 0x1E, 0xCC, 0x90,
+    0x89, 0x26, 0xF5, 0x58, 0x85, 0xE8, 0xF5, 0x09, 0xCC, 0xDB, 0x1D, 0x2C, 0x4D, 0x7A, 0x58, 0xBD,
+    0x62, 0x71, 0x75, 0x95, 0x80, 0xF1, 0x56, 0xD2, 0x8B, 0x16, 0xC7, 0x95, 0x28, 0x41, 0xF7, 0x12,
+    0xB7, 0x2A, 0x29, 0xD4, 0x5B, 0x8C, 0xDB, 0x0F, 0x2B, 0x49, 0xDB, 0x00, 0xE1, 0xB5, 0xED, 0xDD,
+    0xAD, 0x70, 0x97, 0x02, 0x3D, 0x82, 0xEB, 0x30, 0x57, 0xE9, 0xE2, 0x0D, 0x0A, 0x3A, 0x46, 0x9A,
+    0x8F, 0xA3, 0x42, 0xE8, 0x9F, 0x34, 0x01, 0xF6, 0xC5, 0xDB, 0x5B, 0xEF, 0xD1, 0xEB, 0x31, 0xEB,
+    0xB9, 0xB2, 0x5B, 0x7B, 0xD3, 0x17, 0xE5, 0x17, 0x62, 0x09, 0xF1, 0x8F, 0xB9, 0x31, 0x39, 0xDD,
+    0x4B, 0x54, 0xB1, 0x6C, 0x09, 0xA3, 0xA5, 0x43, 0x04, 0x4A, 0x4B, 0xF0, 0xBB, 0x2A, 0xA8, 0xDD,
+    0x64, 0x3B, 0xC0, 0x55, 0xE1, 0xD6, 0xDE, 0x3A, 0x05, 0x5B, 0xDF, 0x18, 0xAF, 0x95, 0x18, 0x07,
+    0xAF, 0xB1, 0x74, 0x84, 0xDF, 0x29, 0xD0, 0x55, 0x17, 0x72, 0xC4, 0x8A, 0xA1, 0x31, 0xB7, 0x4F,
+    0x11, 0x29, 0xDE, 0x82, 0x63, 0xF7, 0x13, 0xE9, 0x0D, 0x41, 0xE0, 0xA5, 0xF2, 0x96, 0x69, 0x5F,
+    0x93, 0xCE, 0x48, 0xA7, 0x41, 0xDB, 0xCB, 0xCD, 0xB6, 0xE7, 0x96, 0x90, 0x20, 0xF4, 0x65, 0x48,
+    0x25, 0x5D, 0x9F, 0x52, 0xA9, 0x38, 0xDC, 0x66, 0x08, 0xCF, 0xFB, 0x6E, 0x7B, 0x1D, 0x12, 0xAD,
+    0x5C, 0xA4, 0x84, 0x3B, 0x65, 0x79, 0x81, 0x75, 0x18, 0x4E, 0x82, 0x83, 0xDE, 0x76, 0x98, 0x88,
+    0xB2, 0x17, 0x0B, 0x66, 0xBE, 0x94, 0x16, 0x80, 0x07, 0x25, 0x1A, 0x41, 0xB9, 0xB8, 0xFD, 0xF2,
+    0xFE, 0xE2, 0x76, 0xFD, 0x6F, 0xE8, 0x99, 0x67, 0x57, 0x4F, 0xC0, 0xBB, 0xB7, 0xBE, 0x46, 0x15,
+    0x10, 0x90, 0xCB, 0x30, 0x29, 0xEB, 0xD9, 0xDE, 0x90, 0x2E, 0x1C, 0x54, 0xB2, 0xA3, 0x12, 0x23,
+    0x7A, 0xF7, 0xDB, 0x09, 0x26, 0x4B, 0x63, 0x55, 0xB4, 0xFA, 0xDA, 0xAD, 0x12, 0xE7, 0xAB, 0x34,
+    0x6C, 0x93, 0x49, 0xB8, 0xCA, 0xD8, 0x64, 0x24, 0x36, 0x7B, 0x7A, 0xC0, 0xC1, 0xEC, 0xCB, 0xE8,
+    0xB3, 0x87, 0x74, 0x09, 0xE6, 0xF8, 0xA2, 0x4A, 0xCC, 0x9D, 0x8D, 0x46, 0x9F, 0x04, 0xE3, 0x88,
+    0xC0, 0xEA, 0x51, 0x66, 0xA5, 0xE3, 0x01, 0xCD, 0x72, 0x83, 0xE3, 0x7B, 0xD3, 0x35, 0x92, 0x3F,
+    0x8F, 0x5C, 0x01, 0xFD, 0xED, 0x02, 0xE6, 0x31, 0x0E, 0xA2, 0xCD, 0x32, 0x9E, 0x31, 0x71, 0xB6,
+    0x42, 0x18, 0x77, 0xC8, 0xBD, 0x36, 0x11, 0xD2, 0xA7, 0xD7, 0x52, 0x6D, 0xAA, 0x68, 0x7A, 0x9F,
+    0x34, 0x9A, 0x7D, 0x7A, 0xA0, 0xF3, 0xA0, 0x08, 0x8B, 0x30, 0x0F, 0x72, 0xE6, 0x99, 0x89, 0xA4,
+    0xD9, 0x12, 0x0E, 0x69, 0xAB, 0xBD, 0xAC, 0x81, 0x52, 0xE0, 0xBF, 0xF8, 0x76, 0x73, 0xE2, 0xE7,
+    0x5F, 0x48, 0xBE, 0xF2, 0xAD, 0x3F, 0xE3, 0x47, 0xE7, 0x7E, 0x8A, 0xC1, 0x37, 0xD8, 0xF9, 0xE8,
+    0xE2, 0x91, 0xDB, 0x6C, 0x8C, 0x7F, 0x6B, 0x54, 0x92, 0xD8, 0xC5, 0xC2, 0xFA, 0xFA, 0x9A, 0xAC,
+    0x4F, 0x6E, 0x6F, 0x6F, 0x75, 0xAF, 0xBD, 0x93, 0xB5, 0x4C, 0x92, 0x6D, 0x1A, 0xB8, 0x67, 0x2C,
+    0x1D, 0x5D, 0x41, 0xD3, 0xC7, 0x3B, 0xF3, 0xFB, 0x82, 0xE4, 0x73, 0x34, 0xCF, 0x74, 0xD1, 0xA0,
+    0xBD, 0x47, 0xB3, 0xA2, 0xBA, 0xCE, 0x82, 0x4B, 0x37, 0x9B, 0x8B, 0x03, 0x51, 0xB8, 0xF8, 0xF2,
+    0xDD, 0xE4, 0x24, 0x87, 0xFF, 0x2E, 0xF5, 0x6A, 0xA3, 0xA9, 0x52, 0x83, 0x7B, 0x96, 0xF1, 0x6C,
+    0x29, 0x63, 0x34, 0x59, 0x7C, 0x08, 0x98, 0x76, 0x6C, 0x70, 0x53, 0xF2, 0x6F, 0x33, 0xF8, 0xDC,
+    0x0B, 0xF3, 0x2D, 0xAB, 0x00, 0xE9, 0xCB, 0x1A, 0x84, 0x68, 0x7C, 0x02, 0x87, 0x06, 0xB2, 0x4E,
+    0x12, 0x5D, 0xA9, 0xFC, 0x44, 0xC9, 0x83, 0xF8, 0x21, 0xF2, 0x19, 0x0F, 0x64, 0x2A, 0x53, 0x4E,
+    0xE7, 0x96, 0xA8, 0xBF, 0xD5, 0xB4, 0x26, 0xAA, 0x79, 0x85, 0x77, 0x8F, 0x8C, 0xB8, 0xCE, 0xBF,
+    0xF9, 0x6B, 0xEE, 0xD7, 0xEE, 0x11, 0xFF, 0x26, 0x9A, 0xF1, 0x06, 0xB2, 0x60, 0xFA, 0x4F, 0x17,
+    0xDE, 0xF9, 0x3D, 0xA2, 0xC7, 0xCF, 0xFB, 0x66, 0xF8, 0x0B, 0x0F, 0xC8, 0x43, 0xA4, 0xFD, 0x19,
+    0x84, 0x77, 0x27, 0x1E, 0x3F, 0xB8, 0x47, 0xA2, 0x06, 0xE6, 0x47, 0xE6, 0x57, 0x34, 0xF4, 0xBE,
+    0xC6, 0x17, 0xCA, 0xA5, 0x1E, 0x9D, 0x6C, 0x49, 0x2D, 0x22, 0xBD, 0x4D, 0xB2, 0x69, 0x12, 0x32,
+    0x5D, 0xDA, 0x7D, 0x6E, 0x88, 0xEC, 0xCC, 0xC8, 0x95, 0x91, 0x37, 0xA6, 0xC0, 0xAD, 0x90, 0x44,
+    0xBC, 0xCA, 0x8C, 0x54, 0x42, 0xC0, 0x2A, 0x89, 0xE6, 0x2E, 0xB3, 0x01, 0x7B, 0x73, 0x47, 0x8A,
+    0x42, 0x2C, 0x3E, 0x5B, 0x71, 0xDA, 0xA2, 0xE9, 0x2A, 0x2B, 0x4D, 0x43, 0x61, 0xC4, 0x3B, 0xC7,
+    0x0B, 0x46, 0x58, 0xC8, 0xE6, 0x29, 0x24, 0xF1, 0x5F, 0x9C, 0x91, 0xA8, 0x87, 0xF7, 0xD7, 0xE6,
+    0xD5, 0xCB, 0xB3, 0x5F, 0x8A, 0x02, 0xCB, 0xAC, 0xBF, 0x57, 0x9D, 0xA3, 0xFC, 0xC4, 0xFC, 0xCA,
+    0x76, 0xBB, 0x42, 0xF7, 0xAD, 0x31, 0xC6, 0x6F, 0x5D, 0x46, 0xF9, 0x47, 0x84, 0xFF, 0x7D, 0x01,
+    0xEA, 0xAF, 0x4F, 0x21, 0x7A, 0xF5, 0x41, 0x5F, 0x38, 0x0F, 0x86, 0x14, 0x3C, 0xC9, 0x96, 0x57,
+    0x25, 0x69, 0xB6, 0x29, 0x53, 0x3B, 0xA5, 0x42, 0xC9, 0xCD, 0x12, 0xDF, 0xF8, 0x24, 0xD9, 0xC7,
+    0x36, 0x64, 0xDF, 0x26, 0x6E, 0x53, 0x96, 0x36, 0x96, 0x07, 0xE9, 0x5A, 0xBC, 0xC8, 0x70, 0xF0,
+    0x02, 0x10, 0x09, 0xD7, 0x98, 0xE3, 0x4B, 0xE4, 0x07, 0x35, 0x55, 0x4C, 0x8F, 0x8C, 0x92, 0xF7,
+    0x80, 0x42, 0xE5, 0x21, 0xFB, 0x4A, 0xF4, 0xEE, 0x90, 0x57, 0x98, 0xCA, 0xAB, 0xC2, 0xB9, 0xA6,
+    0x1F, 0xFC, 0x0F, 0xAB, 0xFF, 0xB3, 0xFF, 0x0F, 0x03, 0x03, 0x00, 0x4D, 0xCE, 0xB1, 0x11, 0xC2,
+    0x20, 0x14, 0xC6, 0xF1, 0x0F, 0x28, 0x28, 0x28, 0xE8, 0x6D, 0xD8, 0x20, 0x34, 0x16, 0x16, 0x46,
+    0x19, 0x43, 0x37, 0xB1, 0x88, 0x27, 0x63, 0xA5, 0x93, 0x11, 0x32, 0x02, 0x23, 0x50, 0x90, 0xBB,
+    0x9C, 0x77, 0x1A, 0x1F, 0x2F, 0x16, 0x52, 0xFC, 0x42, 0x2E, 0x3C, 0xF2, 0x07, 0xB6, 0xA5, 0xD7,
+    0x48, 0x7A, 0x99, 0xC9, 0x23, 0x0A, 0x39, 0xB2, 0x55, 0xB0, 0x7A, 0x06, 0x44, 0x39, 0xAF, 0x81,
+    0xD4, 0x09, 0x90, 0xB9, 0xA9, 0x26, 0x43, 0x53, 0x2A, 0xD9, 0x40, 0x17, 0xB0, 0x26, 0x39, 0x3A,
+    0x6E, 0xA3, 0x6F, 0x86, 0xAE, 0x89, 0x9E, 0x74, 0x6C, 0x07, 0x7F, 0x01, 0x4E, 0xB0, 0x15, 0xFC,
+    0x0E, 0x0C, 0xEC, 0xC8, 0x16, 0xEE, 0x68, 0x01, 0x78, 0x04, 0xFC, 0x2D, 0xC3, 0x6D, 0x77, 0xD1,
+    0x3E, 0x55, 0x3E, 0x56, 0xE8, 0xD9, 0xA4, 0xFD, 0xAE, 0xAA, 0x39, 0xC8, 0xD7, 0xE2, 0xD7, 0xA8,
+    0xE3, 0xA0, 0x26, 0x98, 0x70, 0x20, 0x6D, 0xA4, 0x22, 0x98, 0x4C, 0x45, 0x50, 0x6F, 0xB4, 0xCE,
+    0xE7, 0x56, 0x98, 0x2D, 0x8D, 0xCA, 0x42, 0x9D, 0x7B, 0xD1, 0xBC, 0x89, 0x4C, 0xB5, 0xBD, 0x4A,
+    0xEE, 0x0A, 0xF7, 0x81, 0x5D, 0x7E, 0x7F, 0xFD, 0x02, 0x45, 0x8D, 0xB1, 0x0D, 0x80, 0x40, 0x0C,
+    0x03, 0x5F, 0x7C, 0x41, 0x41, 0x91, 0x51, 0x98, 0x00, 0x05, 0x46, 0x63, 0x12, 0x46, 0x21, 0xA3,
+    0x30, 0xC2, 0x17, 0x20, 0x01, 0x7A, 0x71, 0x24, 0xA2, 0x20, 0x52, 0x5C, 0xD8, 0xF2, 0x39, 0xA5,
+    0x9C, 0xE2, 0xC4, 0x42, 0xB5, 0x84, 0x52, 0x5D, 0x32, 0x84, 0x3D, 0x76, 0x1E, 0x0C, 0xED, 0xEC,
+    0x41, 0x15, 0xAB, 0x6E, 0x2F, 0x46, 0x12, 0x30, 0x4C, 0x61, 0xA2, 0xAC, 0x3C, 0x2D, 0xA7, 0xB2,
+    0xF7, 0x14, 0x61, 0xF7, 0x24, 0x73, 0x45, 0x19, 0x02, 0xA4, 0x07, 0xDE, 0x95, 0x4D, 0x9D, 0x93,
+    0x37, 0x0D, 0xFE, 0x5D, 0xFF, 0xAD, 0x6F, 0xB7, 0xF1, 0x7F, 0x01,
 };
 
 static const EpdGlyph notoserif_12_italicGlyphs[] = {
@@ -1940,99 +1944,99 @@ static const EpdGlyph notoserif_12_italicGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 7, 19, 133, 1, 18, 34, 0 }, // !
-    { 9, 7, 163, 3, 18, 16, 34 }, // "
-    { 14, 18, 224, 0, 18, 63, 50 }, // #
-    { 14, 21, 224, 0, 19, 74, 113 }, // $
-    { 21, 20, 358, 1, 19, 105, 187 }, // %
-    { 19, 20, 297, 0, 19, 95, 292 }, // &
-    { 4, 7, 88, 3, 18, 7, 387 }, // '
-    { 10, 23, 138, 1, 19, 58, 394 }, // (
-    { 10, 23, 138, -2, 19, 58, 452 }, // )
-    { 12, 11, 200, 2, 20, 33, 510 }, // *
-    { 12, 12, 224, 1, 15, 36, 543 }, // +
-    { 5, 8, 100, -1, 4, 10, 579 }, // ,
-    { 8, 3, 124, 0, 8, 6, 589 }, // -
-    { 4, 5, 100, 0, 4, 5, 595 }, // .
-    { 13, 23, 115, -3, 19, 75, 600 }, // /
-    { 13, 20, 224, 1, 19, 65, 675 }, // 0
-    { 11, 18, 184, -1, 18, 50, 740 }, // 1
-    { 14, 19, 224, -1, 19, 67, 790 }, // 2
-    { 14, 20, 224, -1, 19, 70, 857 }, // 3
-    { 15, 18, 224, -1, 18, 68, 927 }, // 4
-    { 14, 19, 224, 0, 18, 67, 995 }, // 5
-    { 13, 20, 224, 1, 19, 65, 1062 }, // 6
-    { 13, 18, 224, 2, 18, 59, 1127 }, // 7
-    { 14, 20, 224, 0, 19, 70, 1186 }, // 8
-    { 13, 20, 224, 0, 19, 65, 1256 }, // 9
-    { 7, 15, 114, 0, 14, 27, 1321 }, // :
-    { 8, 18, 114, -1, 14, 36, 1348 }, // ;
-    { 12, 14, 224, 1, 16, 42, 1384 }, // <
-    { 12, 8, 224, 1, 13, 24, 1426 }, // =
-    { 12, 14, 224, 1, 16, 42, 1450 }, // >
-    { 11, 20, 200, 3, 19, 55, 1492 }, // ?
-    { 21, 22, 368, 1, 18, 116, 1547 }, // @
-    { 19, 18, 282, -2, 18, 86, 1663 }, // A
-    { 17, 18, 262, -1, 18, 77, 1749 }, // B
-    { 16, 20, 251, 1, 19, 80, 1826 }, // C
-    { 19, 18, 290, -1, 18, 86, 1906 }, // D
-    { 17, 18, 249, -1, 18, 77, 1992 }, // E
-    { 17, 18, 236, -1, 18, 77, 2069 }, // F
-    { 17, 20, 286, 1, 19, 85, 2146 }, // G
-    { 23, 18, 317, -1, 18, 104, 2231 }, // H
-    { 12, 18, 147, -1, 18, 54, 2335 }, // I
-    { 15, 24, 143, -4, 18, 90, 2389 }, // J
-    { 20, 18, 280, -1, 18, 90, 2479 }, // K
-    { 16, 18, 249, -1, 18, 72, 2569 }, // L
-    { 26, 18, 375, -1, 18, 117, 2641 }, // M
-    { 22, 18, 305, -1, 18, 99, 2758 }, // N
-    { 17, 20, 297, 1, 19, 85, 2857 }, // O
-    { 17, 18, 248, -1, 18, 77, 2942 }, // P
-    { 17, 25, 297, 1, 19, 107, 3019 }, // Q
-    { 17, 18, 266, -1, 18, 77, 3126 }, // R
-    { 14, 20, 218, 0, 19, 70, 3203 }, // S
-    { 17, 18, 245, 1, 18, 77, 3273 }, // T
-    { 18, 19, 292, 2, 18, 86, 3350 }, // U
-    { 18, 18, 270, 2, 18, 81, 3436 }, // V
-    { 27, 18, 418, 2, 18, 122, 3517 }, // W
-    { 21, 18, 264, -2, 18, 95, 3639 }, // X
-    { 17, 18, 250, 1, 18, 77, 3734 }, // Y
-    { 17, 18, 242, -1, 18, 77, 3811 }, // Z
-    { 11, 23, 144, 0, 19, 64, 3888 }, // [
-    { 4, 23, 115, 2, 19, 23, 3952 }, // <backslash>
-    { 12, 23, 144, -2, 19, 69, 3975 }, // ]
-    { 12, 12, 224, 1, 18, 36, 4044 }, // ^
-    { 13, 2, 184, -3, -2, 7, 4080 }, // _
-    { 5, 5, 112, 3, 20, 7, 4087 }, // `
-    { 14, 15, 232, 1, 14, 53, 4094 }, // a
-    { 13, 20, 225, 0, 19, 65, 4147 }, // b
-    { 12, 15, 195, 1, 14, 45, 4212 }, // c
-    { 14, 20, 232, 1, 19, 70, 4257 }, // d
-    { 11, 15, 197, 1, 14, 42, 4327 }, // e
-    { 17, 26, 127, -4, 20, 111, 4369 }, // f
-    { 16, 21, 222, -1, 15, 84, 4480 }, // g
-    { 14, 20, 240, 1, 19, 70, 4564 }, // h
-    { 7, 21, 122, 1, 20, 37, 4634 }, // i
-    { 12, 26, 116, -4, 20, 78, 4671 }, // j
-    { 14, 20, 228, 1, 19, 70, 4749 }, // k
-    { 7, 20, 122, 1, 19, 35, 4819 }, // l
-    { 21, 15, 358, 1, 14, 79, 4854 }, // m
-    { 14, 15, 240, 1, 14, 53, 4933 }, // n
-    { 13, 15, 230, 1, 14, 49, 4986 }, // o
-    { 15, 20, 231, -1, 14, 75, 5035 }, // p
-    { 13, 20, 224, 1, 14, 65, 5110 }, // q
-    { 11, 14, 187, 1, 14, 39, 5175 }, // r
-    { 11, 15, 186, 0, 14, 42, 5214 }, // s
-    { 9, 18, 147, 1, 17, 41, 5256 }, // t
-    { 14, 15, 240, 1, 14, 53, 5297 }, // u
-    { 13, 15, 215, 0, 14, 49, 5350 }, // v
-    { 20, 15, 328, 0, 14, 75, 5399 }, // w
-    { 15, 14, 218, -1, 14, 53, 5474 }, // x
-    { 18, 20, 211, -5, 14, 90, 5527 }, // y
-    { 13, 14, 204, -1, 14, 46, 5617 }, // z
-    { 12, 23, 171, 1, 19, 69, 5663 }, // {
-    { 2, 25, 224, 6, 19, 13, 5732 }, // |
-    { 12, 23, 171, -2, 19, 69, 5745 }, // }
-    { 12, 6, 224, 1, 12, 18, 5814 }, // ~
+    { 9, 7, 163, 3, 18, 16, 0 }, // "
+    { 14, 18, 224, 0, 18, 63, 16 }, // #
+    { 14, 21, 224, 0, 19, 74, 79 }, // $
+    { 21, 20, 358, 1, 19, 105, 153 }, // %
+    { 19, 20, 297, 0, 19, 95, 258 }, // &
+    { 4, 7, 88, 3, 18, 7, 353 }, // '
+    { 10, 23, 138, 1, 19, 58, 34 }, // (
+    { 10, 23, 138, -2, 19, 58, 92 }, // )
+    { 12, 11, 200, 2, 20, 33, 360 }, // *
+    { 12, 12, 224, 1, 15, 36, 393 }, // +
+    { 5, 8, 100, -1, 4, 10, 150 }, // ,
+    { 8, 3, 124, 0, 8, 6, 160 }, // -
+    { 4, 5, 100, 0, 4, 5, 166 }, // .
+    { 13, 23, 115, -3, 19, 75, 429 }, // /
+    { 13, 20, 224, 1, 19, 65, 171 }, // 0
+    { 11, 18, 184, -1, 18, 50, 236 }, // 1
+    { 14, 19, 224, -1, 19, 67, 286 }, // 2
+    { 14, 20, 224, -1, 19, 70, 353 }, // 3
+    { 15, 18, 224, -1, 18, 68, 423 }, // 4
+    { 14, 19, 224, 0, 18, 67, 491 }, // 5
+    { 13, 20, 224, 1, 19, 65, 558 }, // 6
+    { 13, 18, 224, 2, 18, 59, 623 }, // 7
+    { 14, 20, 224, 0, 19, 70, 682 }, // 8
+    { 13, 20, 224, 0, 19, 65, 752 }, // 9
+    { 7, 15, 114, 0, 14, 27, 817 }, // :
+    { 8, 18, 114, -1, 14, 36, 844 }, // ;
+    { 12, 14, 224, 1, 16, 42, 504 }, // <
+    { 12, 8, 224, 1, 13, 24, 546 }, // =
+    { 12, 14, 224, 1, 16, 42, 570 }, // >
+    { 11, 20, 200, 3, 19, 55, 880 }, // ?
+    { 21, 22, 368, 1, 18, 116, 612 }, // @
+    { 19, 18, 282, -2, 18, 86, 935 }, // A
+    { 17, 18, 262, -1, 18, 77, 1021 }, // B
+    { 16, 20, 251, 1, 19, 80, 1098 }, // C
+    { 19, 18, 290, -1, 18, 86, 1178 }, // D
+    { 17, 18, 249, -1, 18, 77, 1264 }, // E
+    { 17, 18, 236, -1, 18, 77, 1341 }, // F
+    { 17, 20, 286, 1, 19, 85, 1418 }, // G
+    { 23, 18, 317, -1, 18, 104, 1503 }, // H
+    { 12, 18, 147, -1, 18, 54, 1607 }, // I
+    { 15, 24, 143, -4, 18, 90, 1661 }, // J
+    { 20, 18, 280, -1, 18, 90, 1751 }, // K
+    { 16, 18, 249, -1, 18, 72, 1841 }, // L
+    { 26, 18, 375, -1, 18, 117, 1913 }, // M
+    { 22, 18, 305, -1, 18, 99, 2030 }, // N
+    { 17, 20, 297, 1, 19, 85, 2129 }, // O
+    { 17, 18, 248, -1, 18, 77, 2214 }, // P
+    { 17, 25, 297, 1, 19, 107, 2291 }, // Q
+    { 17, 18, 266, -1, 18, 77, 2398 }, // R
+    { 14, 20, 218, 0, 19, 70, 2475 }, // S
+    { 17, 18, 245, 1, 18, 77, 2545 }, // T
+    { 18, 19, 292, 2, 18, 86, 728 }, // U
+    { 18, 18, 270, 2, 18, 81, 2622 }, // V
+    { 27, 18, 418, 2, 18, 122, 2703 }, // W
+    { 21, 18, 264, -2, 18, 95, 2825 }, // X
+    { 17, 18, 250, 1, 18, 77, 2920 }, // Y
+    { 17, 18, 242, -1, 18, 77, 2997 }, // Z
+    { 11, 23, 144, 0, 19, 64, 814 }, // [
+    { 4, 23, 115, 2, 19, 23, 878 }, // <backslash>
+    { 12, 23, 144, -2, 19, 69, 901 }, // ]
+    { 12, 12, 224, 1, 18, 36, 970 }, // ^
+    { 13, 2, 184, -3, -2, 7, 1006 }, // _
+    { 5, 5, 112, 3, 20, 7, 1013 }, // `
+    { 14, 15, 232, 1, 14, 53, 3074 }, // a
+    { 13, 20, 225, 0, 19, 65, 3127 }, // b
+    { 12, 15, 195, 1, 14, 45, 3192 }, // c
+    { 14, 20, 232, 1, 19, 70, 3237 }, // d
+    { 11, 15, 197, 1, 14, 42, 3307 }, // e
+    { 17, 26, 127, -4, 20, 111, 3349 }, // f
+    { 16, 21, 222, -1, 15, 84, 3460 }, // g
+    { 14, 20, 240, 1, 19, 70, 3544 }, // h
+    { 7, 21, 122, 1, 20, 37, 3614 }, // i
+    { 12, 26, 116, -4, 20, 78, 3651 }, // j
+    { 14, 20, 228, 1, 19, 70, 3729 }, // k
+    { 7, 20, 122, 1, 19, 35, 3799 }, // l
+    { 21, 15, 358, 1, 14, 79, 3834 }, // m
+    { 14, 15, 240, 1, 14, 53, 3913 }, // n
+    { 13, 15, 230, 1, 14, 49, 3966 }, // o
+    { 15, 20, 231, -1, 14, 75, 4015 }, // p
+    { 13, 20, 224, 1, 14, 65, 4090 }, // q
+    { 11, 14, 187, 1, 14, 39, 4155 }, // r
+    { 11, 15, 186, 0, 14, 42, 4194 }, // s
+    { 9, 18, 147, 1, 17, 41, 4236 }, // t
+    { 14, 15, 240, 1, 14, 53, 4277 }, // u
+    { 13, 15, 215, 0, 14, 49, 4330 }, // v
+    { 20, 15, 328, 0, 14, 75, 4379 }, // w
+    { 15, 14, 218, -1, 14, 53, 4454 }, // x
+    { 18, 20, 211, -5, 14, 90, 4507 }, // y
+    { 13, 14, 204, -1, 14, 46, 4597 }, // z
+    { 12, 23, 171, 1, 19, 69, 1020 }, // {
+    { 2, 25, 224, 6, 19, 13, 1089 }, // |
+    { 12, 23, 171, -2, 19, 69, 1102 }, // }
+    { 12, 6, 224, 1, 12, 18, 1171 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 7, 19, 133, 0, 14, 34, 0 }, // U+00A1
     { 12, 18, 224, 2, 18, 54, 34 }, // U+00A2
@@ -2116,19 +2120,19 @@ static const EpdGlyph notoserif_12_italicGlyphs[] = {
     { 13, 21, 230, 1, 20, 69, 5551 }, // U+00F0
     { 14, 20, 240, 1, 19, 70, 5620 }, // U+00F1
     { 13, 21, 230, 1, 20, 69, 5690 }, // U+00F2
-    { 13, 21, 230, 1, 20, 69, 5759 }, // U+00F3
-    { 13, 21, 230, 1, 20, 69, 5828 }, // U+00F4
-    { 13, 20, 230, 1, 19, 65, 5897 }, // U+00F5
-    { 13, 20, 230, 1, 19, 65, 5962 }, // U+00F6
-    { 12, 14, 224, 1, 16, 42, 6027 }, // U+00F7
-    { 15, 17, 230, 0, 15, 64, 6069 }, // U+00F8
-    { 14, 21, 240, 1, 20, 74, 6133 }, // U+00F9
-    { 14, 21, 240, 1, 20, 74, 6207 }, // U+00FA
-    { 14, 21, 240, 1, 20, 74, 6281 }, // U+00FB
-    { 14, 20, 240, 1, 19, 70, 6355 }, // U+00FC
-    { 18, 26, 211, -5, 20, 117, 6425 }, // U+00FD
-    { 14, 25, 225, -1, 19, 88, 6542 }, // U+00FE
-    { 18, 25, 211, -5, 19, 113, 6630 }, // U+00FF
+    { 13, 21, 230, 1, 20, 69, 4643 }, // U+00F3
+    { 13, 21, 230, 1, 20, 69, 5759 }, // U+00F4
+    { 13, 20, 230, 1, 19, 65, 5828 }, // U+00F5
+    { 13, 20, 230, 1, 19, 65, 5893 }, // U+00F6
+    { 12, 14, 224, 1, 16, 42, 5958 }, // U+00F7
+    { 15, 17, 230, 0, 15, 64, 6000 }, // U+00F8
+    { 14, 21, 240, 1, 20, 74, 6064 }, // U+00F9
+    { 14, 21, 240, 1, 20, 74, 6138 }, // U+00FA
+    { 14, 21, 240, 1, 20, 74, 6212 }, // U+00FB
+    { 14, 20, 240, 1, 19, 70, 6286 }, // U+00FC
+    { 18, 26, 211, -5, 20, 117, 6356 }, // U+00FD
+    { 14, 25, 225, -1, 19, 88, 6473 }, // U+00FE
+    { 18, 25, 211, -5, 19, 113, 6561 }, // U+00FF
     { 19, 21, 282, -2, 21, 100, 0 }, // U+0100
     { 14, 18, 232, 1, 17, 63, 100 }, // U+0101
     { 19, 23, 282, -2, 23, 110, 163 }, // U+0102
@@ -2830,98 +2834,98 @@ static const EpdGlyph notoserif_12_italicGlyphs[] = {
     { 8, 3, 124, 0, 8, 6, 121 }, // U+2010
     { 8, 3, 124, 0, 8, 6, 127 }, // U+2011
     { 13, 2, 224, 1, 10, 7, 133 }, // U+2012
-    { 14, 3, 200, -1, 8, 11, 140 }, // U+2013
-    { 27, 3, 400, -1, 8, 21, 151 }, // U+2014
-    { 27, 3, 400, -1, 8, 21, 172 }, // U+2015
-    { 7, 25, 224, 4, 19, 44, 193 }, // U+2016
-    { 13, 6, 164, -3, 0, 20, 237 }, // U+2017
-    { 6, 7, 100, 2, 18, 11, 257 }, // U+2018
-    { 5, 7, 100, 2, 18, 9, 268 }, // U+2019
-    { 5, 8, 100, -1, 4, 10, 277 }, // U+201A
-    { 4, 8, 100, 3, 18, 8, 287 }, // U+201B
-    { 11, 7, 180, 2, 18, 20, 295 }, // U+201C
-    { 10, 7, 180, 2, 18, 18, 315 }, // U+201D
-    { 10, 8, 180, -1, 4, 20, 333 }, // U+201E
-    { 9, 8, 180, 3, 18, 18, 353 }, // U+201F
-    { 11, 22, 179, 1, 19, 61, 371 }, // U+2020
-    { 14, 22, 179, -1, 19, 77, 432 }, // U+2021
-    { 8, 8, 145, 1, 13, 16, 509 }, // U+2022
-    { 9, 9, 200, 3, 13, 21, 525 }, // U+2023
-    { 4, 4, 114, 2, 11, 4, 546 }, // U+2024
-    { 11, 4, 214, 2, 11, 11, 550 }, // U+2025
-    { 18, 5, 343, 1, 4, 23, 561 }, // U+2026
-    { 4, 5, 100, 1, 9, 5, 584 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 589 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 589 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 589 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 624 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 659 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 692 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 725 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 758 }, // U+202F
-    { 30, 20, 514, 1, 19, 150, 758 }, // U+2030
-    { 40, 20, 669, 1, 19, 200, 908 }, // U+2031
-    { 5, 7, 88, 2, 18, 9, 1108 }, // U+2032
-    { 10, 7, 163, 2, 18, 18, 1117 }, // U+2033
-    { 15, 7, 238, 2, 18, 27, 1135 }, // U+2034
-    { 4, 7, 88, 3, 18, 7, 1162 }, // U+2035
-    { 9, 7, 163, 3, 18, 16, 1169 }, // U+2036
-    { 13, 7, 238, 3, 18, 23, 1185 }, // U+2037
-    { 9, 8, 160, -1, 2, 18, 1208 }, // U+2038
-    { 7, 10, 133, 1, 12, 18, 1226 }, // U+2039
-    { 7, 10, 133, 0, 12, 18, 1244 }, // U+203A
-    { 18, 18, 328, 1, 18, 81, 1262 }, // U+203B
-    { 13, 19, 224, 1, 18, 62, 1343 }, // U+203C
-    { 11, 20, 200, 3, 19, 55, 1405 }, // U+203D
-    { 13, 2, 184, 2, 21, 7, 1460 }, // U+203E
-    { 20, 6, 0, -19, 0, 30, 1467 }, // U+203F
-    { 20, 5, 0, -15, 21, 25, 1497 }, // U+2040
-    { 12, 18, 180, -2, 18, 54, 1522 }, // U+2041
-    { 24, 21, 400, 0, 20, 126, 1576 }, // U+2042
-    { 8, 5, 145, 1, 11, 10, 1702 }, // U+2043
-    { 15, 18, 25, -7, 18, 68, 1712 }, // U+2044
-    { 11, 23, 144, 0, 19, 64, 1780 }, // U+2045
-    { 12, 23, 144, -2, 19, 69, 1844 }, // U+2046
-    { 22, 20, 391, 3, 19, 110, 1913 }, // U+2047
-    { 17, 20, 315, 3, 19, 85, 2023 }, // U+2048
-    { 20, 20, 312, 1, 19, 100, 2108 }, // U+2049
-    { 12, 20, 224, 1, 15, 60, 2208 }, // U+204A
-    { 14, 22, 247, 2, 19, 77, 2268 }, // U+204B
-    { 14, 10, 239, 1, 14, 35, 2345 }, // U+204C
-    { 14, 10, 239, 1, 14, 35, 2380 }, // U+204D
-    { 11, 11, 200, 1, 15, 31, 2415 }, // U+204E
-    { 5, 18, 114, 1, 14, 23, 2446 }, // U+204F
-    { 16, 20, 292, 2, 19, 80, 2469 }, // U+2050
-    { 14, 22, 200, 0, 20, 77, 2549 }, // U+2051
-    { 9, 19, 132, 0, 18, 43, 2626 }, // U+2052
-    { 12, 6, 224, 1, 12, 18, 2669 }, // U+2053
-    { 20, 6, 0, -5, 0, 30, 2687 }, // U+2054
-    { 12, 12, 216, 1, 15, 36, 2717 }, // U+2055
-    { 12, 15, 246, 1, 14, 45, 2753 }, // U+2056
-    { 19, 7, 314, 2, 18, 34, 2798 }, // U+2057
-    { 15, 15, 284, 1, 14, 57, 2832 }, // U+2058
-    { 14, 15, 284, 1, 14, 53, 2889 }, // U+2059
-    { 4, 20, 115, 2, 19, 20, 2942 }, // U+205A
-    { 14, 20, 284, 2, 19, 70, 2962 }, // U+205B
-    { 14, 14, 279, 1, 14, 49, 3032 }, // U+205C
-    { 4, 20, 115, 2, 19, 20, 3081 }, // U+205D
-    { 4, 20, 115, 2, 19, 20, 3101 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 3121 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2064
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2066
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2067
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2068
-    { 0, 0, 240, 0, 0, 0, 3121 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 3121 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3154 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3187 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3220 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3253 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3286 }, // U+206F
+    { 14, 3, 200, -1, 8, 11, 4712 }, // U+2013
+    { 27, 3, 400, -1, 8, 21, 4723 }, // U+2014
+    { 27, 3, 400, -1, 8, 21, 140 }, // U+2015
+    { 7, 25, 224, 4, 19, 44, 161 }, // U+2016
+    { 13, 6, 164, -3, 0, 20, 205 }, // U+2017
+    { 6, 7, 100, 2, 18, 11, 225 }, // U+2018
+    { 5, 7, 100, 2, 18, 9, 4744 }, // U+2019
+    { 5, 8, 100, -1, 4, 10, 236 }, // U+201A
+    { 4, 8, 100, 3, 18, 8, 246 }, // U+201B
+    { 11, 7, 180, 2, 18, 20, 4753 }, // U+201C
+    { 10, 7, 180, 2, 18, 18, 4773 }, // U+201D
+    { 10, 8, 180, -1, 4, 20, 254 }, // U+201E
+    { 9, 8, 180, 3, 18, 18, 274 }, // U+201F
+    { 11, 22, 179, 1, 19, 61, 292 }, // U+2020
+    { 14, 22, 179, -1, 19, 77, 353 }, // U+2021
+    { 8, 8, 145, 1, 13, 16, 430 }, // U+2022
+    { 9, 9, 200, 3, 13, 21, 446 }, // U+2023
+    { 4, 4, 114, 2, 11, 4, 467 }, // U+2024
+    { 11, 4, 214, 2, 11, 11, 471 }, // U+2025
+    { 18, 5, 343, 1, 4, 23, 4791 }, // U+2026
+    { 4, 5, 100, 1, 9, 5, 482 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 487 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 487 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 487 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 522 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 557 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 590 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 623 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 656 }, // U+202F
+    { 30, 20, 514, 1, 19, 150, 656 }, // U+2030
+    { 40, 20, 669, 1, 19, 200, 806 }, // U+2031
+    { 5, 7, 88, 2, 18, 9, 1006 }, // U+2032
+    { 10, 7, 163, 2, 18, 18, 1015 }, // U+2033
+    { 15, 7, 238, 2, 18, 27, 1033 }, // U+2034
+    { 4, 7, 88, 3, 18, 7, 1060 }, // U+2035
+    { 9, 7, 163, 3, 18, 16, 1067 }, // U+2036
+    { 13, 7, 238, 3, 18, 23, 1083 }, // U+2037
+    { 9, 8, 160, -1, 2, 18, 1106 }, // U+2038
+    { 7, 10, 133, 1, 12, 18, 1124 }, // U+2039
+    { 7, 10, 133, 0, 12, 18, 1142 }, // U+203A
+    { 18, 18, 328, 1, 18, 81, 1160 }, // U+203B
+    { 13, 19, 224, 1, 18, 62, 1241 }, // U+203C
+    { 11, 20, 200, 3, 19, 55, 1303 }, // U+203D
+    { 13, 2, 184, 2, 21, 7, 1358 }, // U+203E
+    { 20, 6, 0, -19, 0, 30, 1365 }, // U+203F
+    { 20, 5, 0, -15, 21, 25, 1395 }, // U+2040
+    { 12, 18, 180, -2, 18, 54, 1420 }, // U+2041
+    { 24, 21, 400, 0, 20, 126, 1474 }, // U+2042
+    { 8, 5, 145, 1, 11, 10, 1600 }, // U+2043
+    { 15, 18, 25, -7, 18, 68, 1610 }, // U+2044
+    { 11, 23, 144, 0, 19, 64, 1678 }, // U+2045
+    { 12, 23, 144, -2, 19, 69, 1742 }, // U+2046
+    { 22, 20, 391, 3, 19, 110, 1811 }, // U+2047
+    { 17, 20, 315, 3, 19, 85, 1921 }, // U+2048
+    { 20, 20, 312, 1, 19, 100, 2006 }, // U+2049
+    { 12, 20, 224, 1, 15, 60, 2106 }, // U+204A
+    { 14, 22, 247, 2, 19, 77, 2166 }, // U+204B
+    { 14, 10, 239, 1, 14, 35, 2243 }, // U+204C
+    { 14, 10, 239, 1, 14, 35, 2278 }, // U+204D
+    { 11, 11, 200, 1, 15, 31, 2313 }, // U+204E
+    { 5, 18, 114, 1, 14, 23, 2344 }, // U+204F
+    { 16, 20, 292, 2, 19, 80, 2367 }, // U+2050
+    { 14, 22, 200, 0, 20, 77, 2447 }, // U+2051
+    { 9, 19, 132, 0, 18, 43, 2524 }, // U+2052
+    { 12, 6, 224, 1, 12, 18, 2567 }, // U+2053
+    { 20, 6, 0, -5, 0, 30, 2585 }, // U+2054
+    { 12, 12, 216, 1, 15, 36, 2615 }, // U+2055
+    { 12, 15, 246, 1, 14, 45, 2651 }, // U+2056
+    { 19, 7, 314, 2, 18, 34, 2696 }, // U+2057
+    { 15, 15, 284, 1, 14, 57, 2730 }, // U+2058
+    { 14, 15, 284, 1, 14, 53, 2787 }, // U+2059
+    { 4, 20, 115, 2, 19, 20, 2840 }, // U+205A
+    { 14, 20, 284, 2, 19, 70, 2860 }, // U+205B
+    { 14, 14, 279, 1, 14, 49, 2930 }, // U+205C
+    { 4, 20, 115, 2, 19, 20, 2979 }, // U+205D
+    { 4, 20, 115, 2, 19, 20, 2999 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 3019 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2064
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2066
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2067
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2068
+    { 0, 0, 240, 0, 0, 0, 3019 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 3019 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 3052 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 3085 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 3118 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 3151 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3184 }, // U+206F
     { 10, 12, 160, 1, 21, 30, 0 }, // U+2070
     { 5, 12, 79, 2, 19, 15, 30 }, // U+2071
     { 10, 12, 160, 1, 21, 30, 45 }, // U+2074
@@ -2997,13 +3001,13 @@ static const EpdGlyph notoserif_12_italicGlyphs[] = {
     { 15, 20, 224, 0, 20, 75, 2546 }, // U+20BE
     { 16, 23, 224, -2, 20, 92, 2621 }, // U+20BF
     { 8, 3, 124, 0, 8, 6, 0 }, // U+2212
-    { 24, 26, 246, -4, 20, 156, 0 }, // U+FB00
-    { 19, 26, 238, -4, 20, 124, 156 }, // U+FB01
-    { 19, 26, 237, -4, 20, 124, 280 }, // U+FB02
-    { 26, 26, 356, -4, 20, 169, 404 }, // U+FB03
-    { 27, 26, 356, -4, 20, 176, 573 }, // U+FB04
-    { 21, 26, 263, -4, 20, 137, 749 }, // U+FB05
-    { 21, 21, 333, 0, 20, 111, 886 }, // U+FB06
+    { 24, 26, 246, -4, 20, 156, 4814 }, // U+FB00
+    { 19, 26, 238, -4, 20, 124, 4970 }, // U+FB01
+    { 19, 26, 237, -4, 20, 124, 5094 }, // U+FB02
+    { 26, 26, 356, -4, 20, 169, 5218 }, // U+FB03
+    { 27, 26, 356, -4, 20, 176, 5387 }, // U+FB04
+    { 21, 26, 263, -4, 20, 137, 0 }, // U+FB05
+    { 21, 21, 333, 0, 20, 111, 137 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -3011,8 +3015,7 @@ static const EpdUnicodeInterval notoserif_12_italicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3020,8 +3023,7 @@ static const EpdUnicodeInterval notoserif_12_italicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3031,19 +3033,57 @@ static const EpdUnicodeInterval notoserif_12_italicIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_12_italicGroups[] = {
-    { 0, 3324, 6500, 97, 0 },
-    { 3324, 2814, 7461, 96, 97 },
-    { 6138, 3617, 12209, 128, 193 },
-    { 9755, 3541, 10530, 96, 321 },
-    { 13296, 1069, 1526, 112, 417 },
-    { 14365, 9499, 24201, 256, 529 },
-    { 23864, 1899, 9816, 90, 785 },
-    { 25763, 1815, 3715, 111, 875 },
-    { 27578, 813, 1233, 42, 986 },
-    { 28391, 1853, 2963, 32, 1028 },
-    { 30244, 8, 6, 1, 1060 },
-    { 30252, 434, 1062, 7, 1061 },
-    { 30686, 98, 138, 1, 1068 },
+    { 0, 2991, 6182, 83, 2 },
+    { 2991, 728, 1296, 26, 0 },
+    { 3719, 2803, 7377, 95, 97 },
+    { 6522, 3617, 12209, 128, 193 },
+    { 10139, 3541, 10530, 96, 321 },
+    { 13680, 1069, 1526, 112, 417 },
+    { 14749, 9499, 24201, 256, 529 },
+    { 24248, 1899, 9816, 90, 785 },
+    { 26147, 1750, 3601, 105, 875 },
+    { 27897, 813, 1233, 42, 986 },
+    { 28710, 1853, 2963, 32, 1028 },
+    { 30563, 8, 6, 1, 1060 },
+    { 30571, 174, 282, 2, 1066 },
+    { 30745, 98, 138, 1, 1068 },
+};
+
+static const uint16_t notoserif_12_italicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_12_italicKernLeftClasses[] = {
@@ -4274,18 +4314,81 @@ static const EpdLigaturePair notoserif_12_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_12_italicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 0 }, { 0x0004, 1, 1 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 2 }, { 0x0009, 1, 1 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 3 }, { 0x000C, 4, 4 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 10 }, { 0x0024, 8, 11 }, { 0x0025, 9, 12 }, { 0x0026, 10, 11 }, { 0x0027, 11, 11 }, { 0x0028, 12, 11 }, { 0x0029, 13, 12 }, // U+0040
+    { 0x002A, 0, 11 }, { 0x002B, 0, 11 }, { 0x002C, 14, 11 }, { 0x002D, 15, 11 }, { 0x002E, 16, 11 }, { 0x002F, 0, 11 }, { 0x0030, 17, 11 }, { 0x0031, 10, 12 }, // U+0048
+    { 0x0032, 18, 11 }, { 0x0033, 10, 12 }, { 0x0034, 19, 11 }, { 0x0035, 20, 13 }, { 0x0036, 21, 14 }, { 0x0037, 22, 15 }, { 0x0038, 23, 16 }, { 0x0039, 24, 17 }, // U+0050
+    { 0x003A, 25, 18 }, { 0x003B, 26, 19 }, { 0x003C, 0, 20 }, { 0x003D, 3, 0 }, { 0x003E, 0, 21 }, { 0x003F, 0, 3 }, { 0x0040, 0, 0 }, { 0x0041, 27, 22 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 28, 23 }, { 0x0044, 29, 24 }, { 0x0045, 30, 25 }, { 0x0046, 0, 25 }, { 0x0047, 30, 25 }, { 0x0048, 31, 0 }, { 0x0049, 0, 26 }, // U+0060
+    { 0x004A, 28, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 32, 24 }, { 0x004E, 0, 28 }, { 0x004F, 28, 29 }, { 0x0050, 28, 29 }, { 0x0051, 29, 25 }, // U+0068
+    { 0x0052, 29, 29 }, { 0x0053, 33, 25 }, { 0x0054, 34, 29 }, { 0x0055, 35, 30 }, { 0x0056, 0, 31 }, { 0x0057, 0, 32 }, { 0x0058, 36, 33 }, { 0x0059, 37, 34 }, // U+0070
+    { 0x005A, 0, 35 }, { 0x005B, 38, 36 }, { 0x005C, 39, 37 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 3 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 40, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 38 }, { 0x006B, 0, 0 }, { 0x006C, 41, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 38 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 39 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 42, 0 }, // U+00B8
+    { 0x0081, 43, 10 }, { 0x0082, 43, 10 }, { 0x0083, 43, 10 }, { 0x0084, 43, 10 }, { 0x0085, 43, 10 }, { 0x0086, 43, 10 }, { 0x0087, 11, 40 }, { 0x0088, 9, 12 }, // U+00C0
+    { 0x0089, 11, 11 }, { 0x008A, 11, 11 }, { 0x008B, 11, 11 }, { 0x008C, 11, 11 }, { 0x008D, 0, 11 }, { 0x008E, 0, 11 }, { 0x008F, 0, 11 }, { 0x0090, 0, 11 }, // U+00C8
+    { 0x0091, 10, 11 }, { 0x0092, 17, 11 }, { 0x0093, 10, 12 }, { 0x0094, 10, 12 }, { 0x0095, 10, 12 }, { 0x0096, 10, 12 }, { 0x0097, 10, 12 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 12 }, { 0x009A, 22, 15 }, { 0x009B, 22, 15 }, { 0x009C, 22, 15 }, { 0x009D, 22, 15 }, { 0x009E, 26, 19 }, { 0x009F, 10, 11 }, { 0x00A0, 35, 0 }, // U+00D8
+    { 0x00A1, 28, 23 }, { 0x00A2, 28, 23 }, { 0x00A3, 28, 23 }, { 0x00A4, 28, 23 }, { 0x00A5, 28, 23 }, { 0x00A6, 28, 23 }, { 0x00A7, 30, 23 }, { 0x00A8, 30, 25 }, // U+00E0
+    { 0x00A9, 30, 25 }, { 0x00AA, 30, 25 }, { 0x00AB, 30, 25 }, { 0x00AC, 30, 25 }, { 0x00AD, 0, 27 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 27 }, { 0x00B0, 0, 27 }, // U+00E8
+    { 0x00B1, 29, 25 }, { 0x00B2, 28, 29 }, { 0x00B3, 29, 25 }, { 0x00B4, 29, 25 }, { 0x00B5, 29, 25 }, { 0x00B6, 29, 25 }, { 0x00B7, 29, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 29, 25 }, { 0x00BA, 28, 32 }, { 0x00BB, 28, 32 }, { 0x00BC, 28, 32 }, { 0x00BD, 28, 32 }, { 0x00BE, 38, 36 }, { 0x00BF, 29, 24 }, { 0x00C0, 38, 36 }, // U+00F8
+    { 0x00C1, 7, 10 }, { 0x00C2, 28, 23 }, { 0x00C3, 43, 10 }, { 0x00C4, 28, 23 }, { 0x00C5, 43, 10 }, { 0x00C6, 28, 23 }, { 0x00C7, 9, 12 }, { 0x00C8, 30, 25 }, // U+0100
+    { 0x00C9, 9, 12 }, { 0x00CA, 30, 25 }, { 0x00CB, 9, 12 }, { 0x00CC, 30, 25 }, { 0x00CD, 9, 12 }, { 0x00CE, 30, 25 }, { 0x00CF, 10, 11 }, { 0x00D0, 44, 25 }, // U+0108
+    { 0x00D1, 10, 11 }, { 0x00D2, 0, 25 }, { 0x00D3, 11, 11 }, { 0x00D4, 30, 25 }, { 0x00D5, 11, 11 }, { 0x00D6, 30, 25 }, { 0x00D7, 11, 11 }, { 0x00D8, 30, 25 }, // U+0110
+    { 0x00D9, 11, 11 }, { 0x00DA, 30, 25 }, { 0x00DB, 11, 11 }, { 0x00DC, 30, 25 }, { 0x00DD, 13, 12 }, { 0x00DE, 0, 25 }, { 0x00DF, 13, 12 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 13, 12 }, { 0x00E2, 0, 25 }, { 0x00E3, 13, 12 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 11 }, { 0x00E6, 28, 24 }, { 0x00E7, 0, 11 }, { 0x00E8, 28, 24 }, // U+0120
+    { 0x00E9, 0, 11 }, { 0x00EA, 0, 27 }, { 0x00EB, 0, 11 }, { 0x00EC, 0, 27 }, { 0x00ED, 0, 11 }, { 0x00EE, 0, 27 }, { 0x00EF, 0, 11 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 11 }, { 0x00F2, 0, 0 }, { 0x00F3, 14, 11 }, { 0x00F4, 0, 27 }, { 0x00F5, 14, 11 }, { 0x00F6, 0, 0 }, { 0x00F7, 15, 11 }, { 0x00F8, 32, 24 }, // U+0130
+    { 0x00F9, 32, 29 }, { 0x00FA, 16, 11 }, { 0x00FB, 0, 28 }, { 0x00FC, 16, 11 }, { 0x00FD, 0, 28 }, { 0x00FE, 45, 11 }, { 0x00FF, 44, 28 }, { 0x0100, 0, 11 }, // U+0138
+    { 0x0101, 0, 28 }, { 0x0102, 16, 11 }, { 0x0103, 0, 28 }, { 0x0104, 17, 11 }, { 0x0105, 28, 29 }, { 0x0106, 17, 11 }, { 0x0107, 28, 29 }, { 0x0108, 17, 11 }, // U+0140
+    { 0x0109, 28, 29 }, { 0x010A, 28, 41 }, { 0x010B, 14, 11 }, { 0x010C, 28, 29 }, { 0x010D, 10, 12 }, { 0x010E, 29, 25 }, { 0x010F, 10, 12 }, { 0x0110, 29, 25 }, // U+0148
+    { 0x0111, 10, 12 }, { 0x0112, 29, 25 }, { 0x0113, 11, 12 }, { 0x0114, 30, 25 }, { 0x0115, 19, 11 }, { 0x0116, 34, 29 }, { 0x0117, 19, 11 }, { 0x0118, 34, 29 }, // U+0150
+    { 0x0119, 19, 11 }, { 0x011A, 34, 29 }, { 0x011B, 20, 13 }, { 0x011C, 35, 30 }, { 0x011D, 20, 13 }, { 0x011E, 35, 30 }, { 0x011F, 20, 13 }, { 0x0120, 35, 30 }, // U+0158
+    { 0x0121, 20, 13 }, { 0x0122, 35, 30 }, { 0x0123, 21, 0 }, { 0x0124, 0, 31 }, { 0x0125, 21, 0 }, { 0x0126, 0, 31 }, { 0x0127, 21, 0 }, { 0x0128, 0, 31 }, // U+0160
+    { 0x0129, 22, 15 }, { 0x012A, 28, 32 }, { 0x012B, 22, 15 }, { 0x012C, 28, 32 }, { 0x012D, 22, 15 }, { 0x012E, 28, 32 }, { 0x012F, 22, 15 }, { 0x0130, 28, 32 }, // U+0168
+    { 0x0131, 22, 15 }, { 0x0132, 28, 32 }, { 0x0133, 22, 15 }, { 0x0134, 28, 32 }, { 0x0135, 24, 17 }, { 0x0136, 37, 34 }, { 0x0137, 26, 19 }, { 0x0138, 38, 36 }, // U+0170
+    { 0x0139, 26, 19 }, { 0x013A, 0, 20 }, { 0x013B, 39, 37 }, { 0x013C, 0, 20 }, { 0x013D, 39, 37 }, { 0x013E, 0, 20 }, { 0x013F, 39, 37 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 50, 42 }, { 0x0212, 50, 42 }, { 0x0213, 51, 43 }, { 0x0214, 52, 42 }, { 0x0215, 53, 44 }, { 0x0216, 54, 45 }, { 0x0217, 55, 42 }, { 0x0218, 55, 42 }, // U+0400
+    { 0x0219, 56, 46 }, { 0x021A, 57, 47 }, { 0x021B, 57, 42 }, { 0x021C, 58, 43 }, { 0x021D, 59, 42 }, { 0x021E, 55, 42 }, { 0x021F, 60, 48 }, { 0x0220, 55, 42 }, // U+0408
+    { 0x0221, 61, 49 }, { 0x0222, 62, 42 }, { 0x0223, 63, 42 }, { 0x0224, 52, 42 }, { 0x0225, 64, 50 }, { 0x0226, 50, 42 }, { 0x0227, 59, 51 }, { 0x0228, 63, 52 }, // U+0410
+    { 0x0229, 55, 42 }, { 0x022A, 55, 42 }, { 0x022B, 59, 42 }, { 0x022C, 55, 47 }, { 0x022D, 55, 42 }, { 0x022E, 55, 42 }, { 0x022F, 65, 44 }, { 0x0230, 55, 42 }, // U+0418
+    { 0x0231, 66, 42 }, { 0x0232, 53, 44 }, { 0x0233, 52, 43 }, { 0x0234, 60, 48 }, { 0x0235, 67, 53 }, { 0x0236, 68, 54 }, { 0x0237, 64, 42 }, { 0x0238, 55, 55 }, // U+0420
+    { 0x0239, 55, 42 }, { 0x023A, 64, 42 }, { 0x023B, 57, 43 }, { 0x023C, 55, 42 }, { 0x023D, 57, 42 }, { 0x023E, 65, 52 }, { 0x023F, 65, 42 }, { 0x0240, 55, 56 }, // U+0428
+    { 0x0241, 69, 57 }, { 0x0242, 70, 58 }, { 0x0243, 71, 57 }, { 0x0244, 72, 59 }, { 0x0245, 73, 60 }, { 0x0246, 74, 57 }, { 0x0247, 75, 61 }, { 0x0248, 71, 62 }, // U+0430
+    { 0x0249, 69, 63 }, { 0x024A, 69, 63 }, { 0x024B, 76, 64 }, { 0x024C, 69, 65 }, { 0x024D, 69, 65 }, { 0x024E, 69, 64 }, { 0x024F, 77, 57 }, { 0x0250, 78, 64 }, // U+0438
+    { 0x0251, 77, 66 }, { 0x0252, 79, 57 }, { 0x0253, 78, 64 }, { 0x0254, 80, 67 }, { 0x0255, 77, 57 }, { 0x0256, 76, 68 }, { 0x0257, 81, 63 }, { 0x0258, 69, 69 }, // U+0440
+    { 0x0259, 69, 63 }, { 0x025A, 81, 63 }, { 0x025B, 82, 70 }, { 0x025C, 69, 63 }, { 0x025D, 82, 63 }, { 0x025E, 77, 61 }, { 0x025F, 77, 64 }, { 0x0260, 69, 71 }, // U+0448
+    { 0x0261, 74, 57 }, { 0x0262, 74, 57 }, { 0x0263, 83, 72 }, { 0x0264, 72, 59 }, { 0x0265, 79, 57 }, { 0x0266, 84, 73 }, { 0x0267, 69, 74 }, { 0x0268, 85, 75 }, // U+0450
+    { 0x0269, 86, 76 }, { 0x026A, 82, 65 }, { 0x026B, 82, 64 }, { 0x026C, 78, 72 }, { 0x026D, 76, 64 }, { 0x026E, 69, 63 }, { 0x026F, 80, 67 }, { 0x0270, 69, 63 }, // U+0458
+};
+
 static const EpdFontData notoserif_12_italic = {
     notoserif_12_italicBitmaps,
     notoserif_12_italicGlyphs,
     notoserif_12_italicIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notoserif_12_italicGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_12_italicGlyphToGroup,
     notoserif_12_italicKernLeftClasses,
     notoserif_12_italicKernRightClasses,
     notoserif_12_italicKernMatrix,
@@ -4295,4 +4398,8 @@ static const EpdFontData notoserif_12_italic = {
     90,
     notoserif_12_italicLigaturePairs,
     5,
+    notoserif_12_italicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,1669 +3,1672 @@
  * name: notoserif_12_regular
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_12_regular 12 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_12_regular 12 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_12_regularBitmaps[26504] = {
-    0xB5, 0x58, 0x3F, 0x8C, 0x1C, 0x57, 0x19, 0xFF, 0xCD, 0xBC, 0x24, 0x23, 0x32, 0xDC, 0x4D, 0x0A,
-    0x9F, 0x40, 0xF8, 0xEC, 0x49, 0x91, 0xE2, 0x88, 0xCF, 0x37, 0x29, 0x56, 0x62, 0x85, 0x76, 0x77,
-    0xE6, 0x42, 0x41, 0x41, 0x91, 0x2B, 0xBC, 0x49, 0x61, 0x09, 0x5B, 0x88, 0x26, 0x01, 0xC5, 0x2B,
-    0xE4, 0xE2, 0x10, 0x7B, 0xB7, 0x43, 0x5A, 0x1A, 0x17, 0x40, 0xDA, 0x20, 0xB9, 0x70, 0x42, 0x91,
-    0x2B, 0x5C, 0x6C, 0xB1, 0xE7, 0x7D, 0x21, 0x05, 0x85, 0x85, 0x3C, 0x14, 0x21, 0x48, 0x14, 0x0C,
-    0xA0, 0x88, 0x80, 0x05, 0x1E, 0x92, 0xB1, 0x98, 0x8B, 0x77, 0xF7, 0xF1, 0xFB, 0xDE, 0xEC, 0x5E,
-    0x6C, 0xC7, 0x76, 0x2E, 0x05, 0x33, 0xEF, 0xFB, 0x76, 0xE6, 0xCD, 0xFB, 0xF3, 0x7D, 0xDF, 0xFB,
-    0xFE, 0x6E, 0xBB, 0xD3, 0xE6, 0xD5, 0x6A, 0xB5, 0xD6, 0x79, 0x01, 0xED, 0xDD, 0x36, 0xFA, 0x1B,
-    0xBC, 0x4F, 0x37, 0x4F, 0x34, 0x57, 0x1B, 0x5F, 0x06, 0xB0, 0xF6, 0x24, 0xD0, 0x5C, 0x06, 0x1A,
-    0x4B, 0x40, 0x6F, 0xD5, 0x42, 0x64, 0x4C, 0xF6, 0xB5, 0x4F, 0xAE, 0xA5, 0xC8, 0x1A, 0x10, 0x70,
-    0x74, 0x0F, 0xAE, 0xDE, 0xC3, 0xA9, 0x7F, 0x7E, 0x92, 0x0C, 0x8C, 0x49, 0x55, 0x92, 0xC1, 0x73,
-    0x34, 0x7C, 0x57, 0x23, 0x50, 0x29, 0x96, 0x09, 0x58, 0x93, 0xE6, 0x9A, 0x2C, 0x78, 0xB9, 0xDC,
-    0x58, 0x1B, 0xB6, 0xD7, 0x2E, 0xB6, 0xD7, 0x10, 0xAD, 0x21, 0xA8, 0xA0, 0x66, 0xC0, 0x20, 0xC7,
-    0xA9, 0x0A, 0x6B, 0xA3, 0xC6, 0x5A, 0x6B, 0xB8, 0xD6, 0xEA, 0xAF, 0xF5, 0xE3, 0xAF, 0x17, 0xBE,
-    0x49, 0xEB, 0x59, 0xD2, 0xEC, 0x15, 0x94, 0x20, 0x05, 0xAD, 0xD3, 0x68, 0x01, 0xDB, 0x01, 0x2E,
-    0x02, 0x57, 0x03, 0x14, 0x40, 0x19, 0x6C, 0x66, 0x82, 0xBF, 0xA5, 0x05, 0x7F, 0x3B, 0x01, 0x86,
-    0x41, 0xE0, 0xE7, 0xD8, 0x0E, 0x4F, 0xB4, 0xFB, 0x20, 0x7F, 0xDB, 0x27, 0xE1, 0x97, 0x17, 0x39,
-    0x18, 0x28, 0x4A, 0x62, 0x27, 0x2B, 0x83, 0x04, 0x4A, 0xCB, 0xB3, 0x97, 0x08, 0x0E, 0x38, 0x18,
-    0x38, 0x21, 0x8B, 0x73, 0xF5, 0xB0, 0xC4, 0xDD, 0xD7, 0x80, 0xAF, 0x4E, 0xB9, 0x0B, 0xA8, 0x2C,
-    0x14, 0x14, 0xCC, 0x91, 0x5B, 0x6C, 0xF0, 0x6B, 0x55, 0xC9, 0x90, 0xF4, 0xD9, 0x4B, 0x8E, 0x49,
-    0xE2, 0x4B, 0xFE, 0xF5, 0xAC, 0x85, 0xC8, 0x2D, 0x9B, 0xE8, 0x60, 0xBF, 0x81, 0x36, 0xE2, 0x3D,
-    0xA2, 0x20, 0xE7, 0xAB, 0x2A, 0x10, 0xC1, 0x9B, 0x20, 0xC8, 0x5E, 0x8D, 0x29, 0x8A, 0x32, 0xA8,
-    0x77, 0xE9, 0xF7, 0xFB, 0xCD, 0x26, 0x25, 0xF9, 0x55, 0x94, 0x4A, 0x07, 0x49, 0xC8, 0x91, 0x3C,
-    0x05, 0xDE, 0xA3, 0xF9, 0x2D, 0xCF, 0x6D, 0xF6, 0x86, 0x08, 0x12, 0xA5, 0xC9, 0x30, 0x4F, 0xEA,
-    0x69, 0x6C, 0xC0, 0x4F, 0x55, 0xE6, 0x14, 0x28, 0x31, 0x9C, 0x0F, 0x5A, 0xDC, 0x32, 0xA9, 0x74,
-    0x0A, 0x37, 0xF7, 0xF4, 0x49, 0x34, 0x64, 0x0F, 0x0A, 0x69, 0x0F, 0x57, 0x7B, 0xC5, 0xF8, 0xD7,
-    0xC5, 0x13, 0x53, 0x1C, 0x37, 0xE9, 0xF4, 0x7B, 0xC5, 0xF9, 0xBD, 0xF3, 0xEC, 0xC4, 0x79, 0x4B,
-    0x44, 0xF3, 0xD3, 0xF6, 0xCA, 0xB5, 0x2B, 0x03, 0x33, 0xBD, 0xBB, 0x07, 0xC7, 0x38, 0x22, 0x4C,
-    0x22, 0x1D, 0x68, 0x95, 0x2A, 0x4A, 0xE9, 0x69, 0x0C, 0x26, 0x83, 0x09, 0x6A, 0x85, 0xE1, 0x99,
-    0xAC, 0x73, 0x50, 0x03, 0x3D, 0x2E, 0x97, 0x23, 0x73, 0xB4, 0x4B, 0x15, 0xF0, 0xE0, 0x63, 0x19,
-    0x4B, 0xF7, 0x7D, 0xAC, 0x2F, 0x87, 0x27, 0xEB, 0xFF, 0xA1, 0x20, 0x43, 0x43, 0xB2, 0xD5, 0xB2,
-    0xCC, 0xF5, 0x29, 0x1B, 0x81, 0xD1, 0x7D, 0xB0, 0xE8, 0x97, 0x31, 0x32, 0x56, 0xE6, 0xF8, 0xEF,
-    0x14, 0x94, 0x9F, 0xAE, 0x17, 0xE3, 0x81, 0xCD, 0xE0, 0x5F, 0xC3, 0x6E, 0x07, 0xCF, 0x74, 0x80,
-    0xCF, 0x6D, 0x63, 0xC4, 0x46, 0x48, 0x7F, 0xC2, 0xA4, 0xE1, 0x6B, 0x45, 0x07, 0x55, 0x1B, 0xA3,
-    0x55, 0x6E, 0x25, 0xAD, 0x04, 0xE5, 0x49, 0x11, 0xFB, 0x09, 0x4E, 0x5A, 0xC6, 0x73, 0x79, 0x0B,
-    0xF0, 0xE4, 0x3A, 0x4E, 0xC6, 0x66, 0x36, 0x30, 0x54, 0x55, 0xEE, 0x7C, 0x29, 0x7C, 0xAD, 0xEC,
-    0x60, 0xD4, 0xC6, 0xCE, 0x09, 0xD2, 0x26, 0xAD, 0xA4, 0x42, 0xC0, 0x24, 0x38, 0x5B, 0xDA, 0x75,
-    0xB8, 0x4D, 0xC4, 0xD6, 0x40, 0xA7, 0x85, 0x9D, 0x8E, 0x5B, 0xFA, 0xE6, 0x92, 0xA5, 0x95, 0x5F,
-    0x15, 0xC1, 0x23, 0x2C, 0x11, 0x9A, 0x84, 0x1E, 0x21, 0x2B, 0x69, 0x3F, 0x25, 0x3C, 0x7E, 0x5F,
-    0x26, 0xAC, 0x13, 0x7E, 0xDC, 0x3D, 0x48, 0xC6, 0xC6, 0xE4, 0x76, 0xCE, 0x02, 0x5C, 0xD2, 0x1D,
-    0x1B, 0x1D, 0x9A, 0x3C, 0x32, 0xC5, 0x1A, 0xF6, 0x9A, 0x78, 0x8E, 0xA7, 0x5B, 0xB7, 0x6F, 0xBE,
-    0x89, 0xDD, 0xB1, 0x16, 0x1D, 0x93, 0x91, 0x54, 0x49, 0x8E, 0xAD, 0xB6, 0x50, 0x16, 0x6E, 0x31,
-    0x3D, 0x9E, 0x45, 0xB3, 0x85, 0x2E, 0x8F, 0x73, 0x95, 0x55, 0x41, 0xD2, 0x0A, 0xD1, 0xE4, 0xD1,
-    0xB5, 0x2D, 0xF5, 0xA3, 0x0B, 0xE9, 0xF8, 0xFD, 0x62, 0x1F, 0xA3, 0x11, 0x76, 0xA8, 0x6A, 0x7D,
-    0x74, 0xDA, 0x68, 0x53, 0xD8, 0x21, 0x46, 0xFE, 0xEF, 0x0B, 0xC7, 0x4A, 0x7A, 0x6C, 0xA6, 0xC6,
-    0x4C, 0x68, 0x53, 0x1A, 0x57, 0x53, 0xEA, 0x93, 0x93, 0x0B, 0xCB, 0x22, 0xAB, 0x94, 0x02, 0xE2,
-    0xB1, 0xC0, 0x5A, 0x4E, 0x2D, 0x0C, 0x7E, 0x77, 0xED, 0x77, 0x2B, 0xAE, 0x34, 0xDC, 0x2C, 0xDA,
-    0x18, 0xB6, 0xA8, 0xE9, 0x68, 0x51, 0xB5, 0x23, 0x5A, 0xDC, 0xDF, 0x33, 0xD7, 0xC0, 0xBB, 0x95,
-    0x47, 0xAA, 0xEA, 0x63, 0xBF, 0x42, 0xA7, 0x42, 0x54, 0x61, 0x83, 0xBB, 0xC7, 0xA8, 0x7C, 0x93,
-    0xD5, 0xC4, 0xBA, 0x33, 0x84, 0xAF, 0x67, 0x6D, 0xA7, 0xE8, 0xA3, 0xA2, 0x52, 0x4F, 0xD0, 0x9F,
-    0xA0, 0x3D, 0x42, 0x7B, 0x07, 0xFB, 0xD1, 0xEB, 0x53, 0x7F, 0x56, 0x0B, 0x9F, 0x02, 0x1F, 0x72,
-    0xCB, 0xE7, 0xDC, 0xBC, 0xED, 0xEB, 0x90, 0x9C, 0x26, 0x78, 0x66, 0x32, 0xD9, 0x9E, 0x33, 0x3C,
-    0x9A, 0x8C, 0xF0, 0x25, 0xC4, 0xBC, 0x4F, 0xE2, 0xDE, 0x4B, 0xFA, 0x42, 0x2A, 0xEA, 0x93, 0xD8,
-    0x46, 0x7D, 0x3E, 0x1C, 0xC8, 0xD5, 0xE8, 0x39, 0x76, 0xE1, 0xE5, 0xFC, 0x2A, 0x07, 0xC9, 0x37,
-    0xEC, 0xF3, 0x27, 0xB3, 0x1B, 0x9D, 0x98, 0x7B, 0x04, 0x33, 0x5D, 0xE9, 0x9E, 0xF9, 0xD4, 0x41,
-    0x2C, 0x5E, 0xCF, 0xDF, 0x37, 0xC5, 0x99, 0xD8, 0x05, 0xB3, 0x7A, 0x41, 0x7E, 0xEA, 0x2D, 0xA6,
-    0xF8, 0x74, 0x16, 0xCF, 0x53, 0x2C, 0x65, 0x0B, 0xA3, 0xC7, 0x0E, 0xD5, 0x8F, 0xC7, 0x17, 0x6A,
-    0xEC, 0xD8, 0x71, 0xBD, 0xBB, 0x46, 0xCF, 0xCF, 0xB3, 0x7E, 0x39, 0x75, 0x40, 0xE4, 0x1D, 0xFC,
-    0x20, 0xB3, 0x5A, 0x36, 0xB4, 0x02, 0x3F, 0x61, 0xA5, 0xED, 0xC3, 0x4B, 0xE3, 0x3B, 0x5E, 0x12,
-    0x38, 0xC5, 0x86, 0x4A, 0x4F, 0x2A, 0xDD, 0x56, 0x69, 0xCB, 0x4F, 0x5B, 0xC4, 0x3C, 0x72, 0x95,
-    0x36, 0x43, 0xF4, 0x55, 0x42, 0x4F, 0x37, 0xF4, 0xC4, 0xDF, 0x95, 0xBE, 0xB8, 0xD1, 0x72, 0x09,
-    0x2D, 0xFF, 0xFD, 0x9D, 0x6D, 0xB4, 0xDC, 0x29, 0xFD, 0xD4, 0xE9, 0xDA, 0xD5, 0xD6, 0x44, 0x6A,
-    0x38, 0x09, 0xDC, 0x12, 0xC7, 0x13, 0x61, 0x52, 0xF6, 0x77, 0x5E, 0xC6, 0xDC, 0xA1, 0x48, 0x3F,
-    0xF5, 0x59, 0x3A, 0xBD, 0xBE, 0x0C, 0xA6, 0x32, 0x61, 0x89, 0x14, 0x61, 0x35, 0x14, 0x8F, 0x12,
-    0xD0, 0xEB, 0x37, 0xB8, 0x02, 0xF6, 0x3C, 0x92, 0x56, 0xA8, 0x9C, 0x76, 0x6F, 0xA8, 0x18, 0x5A,
-    0xF8, 0x4C, 0xC9, 0x8F, 0x27, 0xA7, 0x17, 0x88, 0x12, 0x86, 0x09, 0x06, 0x30, 0x85, 0x67, 0xF2,
-    0xD8, 0xFC, 0x03, 0xDE, 0xED, 0x0B, 0xA9, 0xCB, 0xF1, 0x6E, 0x71, 0xF7, 0x2D, 0xEF, 0xBE, 0x76,
-    0x69, 0x82, 0xEE, 0xED, 0xB3, 0xDA, 0x2D, 0xE8, 0xDF, 0x0A, 0x54, 0x84, 0xC9, 0x1C, 0xF8, 0xEC,
-    0x94, 0xDE, 0xED, 0xB3, 0x5C, 0x63, 0xAE, 0xED, 0xD4, 0x7A, 0xF7, 0x20, 0xD4, 0xBE, 0xA6, 0xB7,
-    0x4E, 0x54, 0x16, 0xC1, 0x91, 0x23, 0x10, 0xF1, 0x5A, 0x18, 0xCD, 0x61, 0x7F, 0xFE, 0xDE, 0xB1,
-    0x3A, 0x21, 0x9E, 0x8E, 0xFC, 0x67, 0xC8, 0xD4, 0xF4, 0xAC, 0xC6, 0xA0, 0x5E, 0x2B, 0x36, 0x14,
-    0x3A, 0x09, 0xCB, 0xE8, 0xF4, 0x9D, 0x8A, 0x88, 0x33, 0x88, 0x62, 0x41, 0x61, 0x22, 0x88, 0x24,
-    0x23, 0x78, 0x18, 0xB2, 0x43, 0xE2, 0xC5, 0x34, 0x2E, 0x20, 0x74, 0xC2, 0x12, 0x1A, 0x33, 0x9A,
-    0x7A, 0xB7, 0x5F, 0x22, 0x77, 0x58, 0xC0, 0x16, 0x01, 0x87, 0x60, 0x0C, 0x39, 0x3E, 0x83, 0x7B,
-    0xFA, 0x0A, 0x3C, 0x45, 0x68, 0x08, 0x78, 0xB7, 0xBB, 0x25, 0xD7, 0x28, 0x3F, 0x77, 0x9D, 0xDB,
-    0x5D, 0x58, 0xE9, 0xDD, 0xBB, 0xCE, 0x21, 0x88, 0x53, 0x8A, 0xE9, 0x98, 0xEB, 0x2B, 0xE4, 0x93,
-    0x73, 0xF0, 0x12, 0x9D, 0x52, 0x46, 0xB5, 0x63, 0xB0, 0x2C, 0x45, 0xD7, 0x12, 0x2B, 0x23, 0x2B,
-    0xAC, 0x1A, 0x8D, 0x6A, 0xF4, 0x78, 0x97, 0xAF, 0x81, 0x49, 0x76, 0x44, 0xE1, 0x3B, 0xA2, 0xA8,
-    0xB1, 0x20, 0x0A, 0xB2, 0x12, 0xE5, 0xA7, 0xBC, 0x0E, 0xC8, 0x33, 0x2E, 0x98, 0x79, 0x04, 0x88,
-    0x8D, 0x63, 0x2A, 0xAF, 0xC2, 0x85, 0xEC, 0x51, 0x42, 0x23, 0x32, 0x4C, 0x27, 0x48, 0xF8, 0xB9,
-    0xF4, 0xD1, 0xE3, 0x48, 0x7B, 0xA4, 0x65, 0xD1, 0x49, 0x4C, 0xAF, 0x62, 0x8F, 0xE7, 0x88, 0x8D,
-    0x33, 0x39, 0x25, 0x30, 0xDA, 0x99, 0x61, 0x6E, 0x85, 0x5F, 0xB4, 0x55, 0x12, 0x34, 0x3C, 0x31,
-    0x71, 0x2E, 0x45, 0x6F, 0xC7, 0xFD, 0xAD, 0x94, 0x4B, 0x39, 0x69, 0xD1, 0x17, 0x8F, 0x26, 0x54,
-    0x2C, 0x8B, 0x94, 0x9B, 0x82, 0x44, 0xDE, 0x1F, 0x8B, 0x37, 0xBF, 0x33, 0x11, 0x97, 0x3E, 0x90,
-    0xBE, 0x28, 0x25, 0x0A, 0xEC, 0x60, 0x21, 0xCB, 0xB5, 0x2C, 0x4C, 0x2D, 0x75, 0x29, 0xE9, 0xF3,
-    0x0B, 0x22, 0x61, 0xEC, 0xA1, 0xA7, 0xF7, 0x00, 0x10, 0x0D, 0x69, 0xCE, 0xB5, 0xE4, 0xE2, 0xA1,
-    0x96, 0x70, 0x8D, 0xB8, 0x64, 0x12, 0x82, 0xF1, 0x25, 0x7A, 0x57, 0x50, 0xB7, 0x6E, 0x01, 0x7F,
-    0x86, 0x5B, 0xB7, 0x1B, 0xA9, 0x3A, 0x07, 0xF7, 0xBA, 0xF6, 0x42, 0xB8, 0xEF, 0x66, 0xBE, 0xE0,
-    0x7C, 0x89, 0xF8, 0x9D, 0x82, 0x36, 0xCD, 0x18, 0xD5, 0x14, 0x3C, 0x6A, 0x08, 0xEE, 0xF7, 0x04,
-    0xB7, 0x73, 0xC1, 0x51, 0x26, 0x38, 0xD4, 0x21, 0xE5, 0x10, 0xA4, 0x51, 0x1A, 0x57, 0x3E, 0x4C,
-    0x15, 0xE7, 0x30, 0x25, 0x59, 0x08, 0x2F, 0x31, 0x70, 0xF9, 0xE2, 0xCC, 0x89, 0x6E, 0x25, 0x44,
-    0x37, 0x34, 0xD1, 0x6F, 0x73, 0xA2, 0xDF, 0xD0, 0x07, 0xB9, 0x7A, 0x22, 0x68, 0x57, 0x50, 0x24,
-    0x28, 0xB8, 0x4E, 0xE4, 0xDD, 0x24, 0x72, 0xEF, 0x88, 0xBF, 0x30, 0x82, 0x06, 0x22, 0x63, 0xBA,
-    0xEC, 0xC9, 0xDC, 0x37, 0x51, 0x9D, 0x48, 0xBF, 0x7B, 0x70, 0x3C, 0xA3, 0x9B, 0x72, 0x24, 0x99,
-    0xE0, 0x61, 0xC4, 0xA2, 0x97, 0x36, 0xCE, 0xEF, 0x88, 0x2D, 0x8F, 0x60, 0xB3, 0x88, 0x7B, 0x90,
-    0xFD, 0xD0, 0x96, 0x21, 0xB1, 0x75, 0x3D, 0x32, 0x2D, 0xD0, 0x0E, 0x7D, 0x52, 0x29, 0x3E, 0x7E,
-    0xB0, 0x88, 0x94, 0xB1, 0xF9, 0x70, 0xEE, 0x89, 0x3C, 0x6A, 0xA9, 0x2A, 0xEE, 0xF3, 0x46, 0x45,
-    0xDD, 0x1F, 0x25, 0xAE, 0xA9, 0x8E, 0x60, 0x4F, 0xFF, 0x3F, 0x5A, 0x95, 0x75, 0xC5, 0x82, 0x9C,
-    0xF2, 0xD0, 0x24, 0x63, 0x89, 0x67, 0x4F, 0xEC, 0x59, 0x26, 0x2C, 0x17, 0x10, 0x07, 0x2A, 0xC8,
-    0xAA, 0xD7, 0xBD, 0x48, 0x89, 0xDE, 0xD1, 0x56, 0x85, 0x13, 0x3E, 0x89, 0x56, 0x16, 0xBB, 0x56,
-    0x2B, 0x45, 0x71, 0x03, 0x2D, 0x5A, 0x69, 0xE7, 0x96, 0xC2, 0xD4, 0x54, 0x0C, 0x66, 0x90, 0xCE,
-    0x23, 0xFB, 0xF3, 0x45, 0x0B, 0x8C, 0xE0, 0x17, 0x47, 0x36, 0x12, 0x93, 0xCA, 0x88, 0x2C, 0x92,
-    0xAC, 0x31, 0x7F, 0x4A, 0x1B, 0xB4, 0x76, 0x7A, 0x68, 0x17, 0x68, 0x0D, 0xD1, 0xDF, 0x75, 0x8A,
-    0xD0, 0x0A, 0x84, 0x45, 0x42, 0xB5, 0x73, 0xEE, 0xBD, 0x61, 0xCF, 0xD7, 0x2D, 0xC2, 0xFA, 0x96,
-    0xAF, 0x8F, 0x49, 0xAC, 0x39, 0x32, 0x84, 0x8C, 0xAC, 0x74, 0x65, 0xE3, 0x19, 0x0B, 0x0A, 0xE6,
-    0xEA, 0x83, 0x84, 0xAA, 0xB1, 0x8A, 0x2F, 0x84, 0xD4, 0xA7, 0x28, 0x67, 0xC6, 0x45, 0x41, 0x30,
-    0x61, 0x98, 0xBD, 0x48, 0x39, 0x46, 0x8B, 0x43, 0x33, 0x95, 0x32, 0x29, 0xF9, 0xD9, 0xA7, 0xCC,
-    0x99, 0xDA, 0x70, 0xE3, 0x86, 0xCC, 0xD8, 0x93, 0x19, 0x79, 0x6D, 0xDC, 0x28, 0xA9, 0x99, 0x98,
-    0x48, 0x81, 0xD3, 0xA7, 0x99, 0xA3, 0xED, 0x8B, 0xF0, 0x97, 0xC5, 0x81, 0xAE, 0x4A, 0x14, 0xFD,
-    0xA1, 0xC4, 0xC5, 0xA1, 0x44, 0xC8, 0xE2, 0xF0, 0xA8, 0xE8, 0x03, 0xC7, 0x13, 0x7C, 0x9F, 0xF1,
-    0x2E, 0xCC, 0x19, 0xBD, 0xC3, 0x94, 0x0B, 0x8B, 0x52, 0x7B, 0x99, 0x33, 0x65, 0xC2, 0xCC, 0x38,
-    0x37, 0x13, 0xAA, 0x0A, 0xF5, 0xB6, 0xA5, 0x4B, 0xBD, 0x20, 0x89, 0x68, 0xE9, 0x05, 0x09, 0xEB,
-    0x9D, 0xCA, 0xF7, 0x59, 0x68, 0x61, 0xB4, 0xEC, 0x69, 0xAE, 0xB5, 0xB3, 0xA4, 0x32, 0xD2, 0xD0,
-    0x59, 0x55, 0x7F, 0x21, 0x15, 0xD1, 0x9A, 0xFB, 0x91, 0xC8, 0xA6, 0x81, 0x8F, 0x49, 0x4E, 0xB0,
-    0x87, 0x3B, 0x12, 0xC7, 0x0A, 0x26, 0xBC, 0x36, 0x23, 0x19, 0x08, 0x01, 0x99, 0x68, 0xD3, 0x80,
-    0x99, 0x13, 0x4B, 0x1C, 0x57, 0xD2, 0x0D, 0xF2, 0xE0, 0x94, 0x42, 0xFE, 0x44, 0x28, 0xEF, 0x48,
-    0x7A, 0x13, 0x49, 0xE6, 0x14, 0x08, 0xA9, 0x5E, 0xBE, 0x20, 0x3A, 0x90, 0x8C, 0x79, 0x55, 0x5C,
-    0x7E, 0x43, 0x22, 0x64, 0xC1, 0xD8, 0xEE, 0x6A, 0xAA, 0xA0, 0x97, 0x4A, 0xC6, 0x92, 0xAA, 0x89,
-    0x70, 0xC3, 0x8C, 0x66, 0xE6, 0x99, 0x94, 0x53, 0xAF, 0xC9, 0xAC, 0xA6, 0x28, 0x64, 0x4F, 0x74,
-    0x80, 0xCB, 0xEC, 0x88, 0x9C, 0x22, 0x25, 0x14, 0x7D, 0x47, 0xE8, 0xF9, 0xDD, 0x22, 0x75, 0x70,
-    0x8A, 0x47, 0x21, 0x3B, 0x84, 0x29, 0x2F, 0xE3, 0x91, 0xC9, 0xA2, 0xEE, 0x39, 0xBD, 0xCE, 0xDD,
-    0xD6, 0xA9, 0x67, 0xC7, 0x6C, 0xD4, 0xAE, 0x6A, 0xF2, 0x84, 0xCE, 0x40, 0xD6, 0x4F, 0xEA, 0x20,
-    0x4E, 0x62, 0x9D, 0xFA, 0xD3, 0x53, 0xA4, 0xF1, 0x0D, 0x12, 0x9B, 0xC7, 0xDD, 0x17, 0x99, 0x17,
-    0x98, 0x7C, 0x2C, 0x69, 0xEE, 0x11, 0xEE, 0x7D, 0x8C, 0x0B, 0x49, 0xFF, 0xF7, 0xC8, 0x41, 0x83,
-    0xAC, 0xAC, 0xF3, 0x48, 0x96, 0x98, 0x9D, 0x33, 0xC3, 0x82, 0x4A, 0x54, 0x4A, 0x76, 0xF4, 0x7D,
-    0x9F, 0x11, 0x57, 0xDC, 0xF5, 0x08, 0xB7, 0x53, 0x89, 0x17, 0x96, 0xAA, 0x96, 0xF9, 0xF2, 0x35,
-    0xE0, 0x4F, 0xF4, 0xB2, 0x89, 0x7A, 0x4D, 0x7B, 0xC8, 0x96, 0x51, 0xAC, 0xE2, 0x62, 0x0B, 0xAD,
-    0x8B, 0x38, 0xF1, 0x14, 0x1E, 0x23, 0xC5, 0xE9, 0xB3, 0x6F, 0xBD, 0x95, 0x88, 0x55, 0x6F, 0x88,
-    0xF7, 0x4C, 0x9D, 0x37, 0x11, 0xDC, 0xCC, 0x22, 0xA7, 0x38, 0x2D, 0x59, 0x9F, 0x34, 0xE7, 0xED,
-    0x32, 0xFA, 0x79, 0xD9, 0x47, 0xC9, 0x9A, 0x6F, 0x48, 0xEC, 0x96, 0x9D, 0xEF, 0x0E, 0xC3, 0x4A,
-    0x8E, 0x7B, 0x3C, 0x37, 0x17, 0xEF, 0x6E, 0x78, 0xE7, 0x32, 0xBC, 0x1B, 0x8C, 0x92, 0x1F, 0x06,
-    0xDA, 0x63, 0x2D, 0x40, 0x27, 0xC6, 0x32, 0x91, 0x16, 0x4E, 0xBF, 0x54, 0x83, 0x5B, 0x43, 0xA6,
-    0x72, 0x8F, 0xD8, 0xFF, 0x17, 0x8B, 0x83, 0x9F, 0xCD, 0x9D, 0xE2, 0xCB, 0xF0, 0x6F, 0xE6, 0xA1,
-    0xC3, 0xB4, 0x95, 0x19, 0x79, 0x72, 0x77, 0x10, 0xEC, 0xDB, 0x5A, 0x22, 0xC6, 0x33, 0xC1, 0x07,
-    0x85, 0x5B, 0xA7, 0xEF, 0x52, 0xD7, 0x4B, 0x50, 0xC4, 0xC6, 0x21, 0x38, 0x57, 0xC8, 0x85, 0x79,
-    0x15, 0xD1, 0xE6, 0x8C, 0xC3, 0x77, 0x39, 0x8B, 0x65, 0x94, 0x85, 0x8D, 0x43, 0xE8, 0xDB, 0x62,
-    0x50, 0x8A, 0xBD, 0x6B, 0x08, 0x7F, 0x79, 0x2B, 0xF1, 0x4C, 0x58, 0x2C, 0x36, 0xBF, 0x95, 0xD9,
-    0xCD, 0xE9, 0x70, 0x46, 0xAC, 0x73, 0xC7, 0x66, 0xB2, 0xDF, 0x3D, 0x73, 0xB8, 0x79, 0x84, 0x63,
-    0xC1, 0x7B, 0xA5, 0xBB, 0xA8, 0x1D, 0xA4, 0x6A, 0x2F, 0x46, 0x6E, 0xDE, 0x90, 0x32, 0x25, 0xC3,
-    0x57, 0x3E, 0x48, 0xE8, 0x8D, 0xEB, 0xE7, 0x87, 0x35, 0x1A, 0xE9, 0x80, 0x45, 0x9C, 0x5C, 0xAF,
-    0xBC, 0xA0, 0xD5, 0xCD, 0x3B, 0x3A, 0x48, 0x4B, 0x5A, 0x26, 0x8D, 0x94, 0x7B, 0x08, 0x04, 0xC9,
-    0xA2, 0xFA, 0xCC, 0x24, 0x87, 0x85, 0x18, 0x8D, 0xFF, 0x8B, 0x2D, 0x28, 0x16, 0xCC, 0x1E, 0x13,
-    0x35, 0x56, 0xFA, 0xC9, 0x36, 0xCB, 0xC7, 0x6D, 0xFE, 0xB6, 0x38, 0x33, 0xDA, 0x1C, 0xB1, 0xFF,
-    0xD2, 0xA3, 0x4F, 0xA2, 0x0C, 0x53, 0x8F, 0x67, 0xE0, 0x69, 0xF5, 0x48, 0xF0, 0x73, 0x95, 0x8F,
-    0x27, 0x6A, 0xC2, 0xB7, 0x4C, 0xD9, 0xE2, 0x77, 0x25, 0x89, 0x32, 0xF5, 0x80, 0xDB, 0xCF, 0x07,
-    0x33, 0x49, 0x8F, 0xAD, 0x09, 0xE1, 0xF1, 0xAD, 0x90, 0x4F, 0x0F, 0xBF, 0x25, 0x00, 0xF8, 0x7A,
-    0xF7, 0xC1, 0x34, 0xEA, 0xEE, 0x96, 0xA7, 0xC7, 0xA4, 0x6E, 0x83, 0xCF, 0x4D, 0x42, 0x0E, 0xEF,
-    0x5D, 0x4D, 0xBA, 0xB5, 0x54, 0x6F, 0xF0, 0xFE, 0xCA, 0xD4, 0x47, 0x33, 0x95, 0xE7, 0x7C, 0x4F,
-    0x47, 0xF4, 0x33, 0x41, 0x36, 0x9E, 0xB8, 0xD5, 0x98, 0x49, 0xB7, 0xF7, 0xC8, 0xDB, 0xCF, 0xC7,
-    0xD3, 0x95, 0xCD, 0xCB, 0xCE, 0x65, 0x44, 0x37, 0x4C, 0x68, 0x68, 0xE9, 0xE1, 0xD5, 0x30, 0x51,
-    0x8C, 0x34, 0x92, 0xAE, 0x53, 0x2F, 0x05, 0xEB, 0xA3, 0x61, 0x91, 0x8C, 0x97, 0x0D, 0xA6, 0x6A,
-    0xE2, 0x4D, 0x56, 0x36, 0xAF, 0xC8, 0x8A, 0x89, 0xAA, 0x02, 0x4D, 0x1F, 0x9A, 0x7D, 0xDE, 0xCD,
-    0xB9, 0x05, 0x67, 0x4E, 0xF1, 0x4A, 0x02, 0xFF, 0x8E, 0x84, 0x66, 0xD6, 0x97, 0xF6, 0x0F, 0x18,
-    0x51, 0xC7, 0xF0, 0x1E, 0x90, 0xFF, 0x21, 0x5A, 0xEC, 0x97, 0xFF, 0x21, 0x82, 0x9F, 0x56, 0x58,
-    0xE8, 0x5A, 0x77, 0xF3, 0x32, 0x06, 0x72, 0x92, 0xD5, 0xD1, 0x6C, 0xCA, 0xA3, 0x4D, 0x79, 0xD7,
-    0x67, 0xF7, 0x49, 0xBA, 0xAE, 0x1B, 0xC7, 0xE2, 0xBC, 0xAE, 0x3C, 0xBE, 0xE5, 0x9B, 0x73, 0x79,
-    0xB4, 0x69, 0x8E, 0x68, 0x26, 0xFF, 0xA6, 0x96, 0x6D, 0xDC, 0x63, 0x6A, 0x35, 0x0C, 0xC8, 0x94,
-    0x29, 0x28, 0xE7, 0xE8, 0xC6, 0x44, 0xFD, 0x71, 0x47, 0x15, 0x4D, 0x95, 0x3F, 0x58, 0xF7, 0x7D,
-    0x29, 0x47, 0xC0, 0xE3, 0xD8, 0x78, 0x1B, 0xDB, 0x7E, 0x7A, 0x55, 0x51, 0xD3, 0xC5, 0x7A, 0x23,
-    0x06, 0x7D, 0xE6, 0x9E, 0x4C, 0x50, 0x3D, 0xDD, 0x53, 0xBA, 0x50, 0x7A, 0xE8, 0xA7, 0xD1, 0xD4,
-    0xF2, 0xCD, 0xF4, 0x20, 0x15, 0x33, 0x08, 0xDE, 0xC3, 0xD8, 0xC8, 0x1F, 0x01, 0x0F, 0x6D, 0x5A,
-    0x7C, 0x34, 0x2B, 0x7E, 0xAB, 0xB4, 0x2B, 0xC9, 0x40, 0x47, 0x73, 0x35, 0x78, 0xB8, 0xBA, 0xD7,
-    0xC7, 0x1B, 0x68, 0xF7, 0xE0, 0x27, 0x39, 0xC6, 0x7F, 0xB3, 0x3B, 0x76, 0xB7, 0x56, 0xB6, 0xC6,
-    0x79, 0x44, 0x83, 0x51, 0x69, 0x90, 0x2A, 0x92, 0xE4, 0x93, 0x76, 0x89, 0x99, 0xAB, 0x8C, 0x17,
-    0x74, 0xA8, 0x65, 0x83, 0xDE, 0x88, 0x31, 0xA7, 0x4F, 0x49, 0x76, 0x24, 0x22, 0x10, 0x58, 0xBC,
-    0x74, 0xB7, 0x1C, 0x74, 0x93, 0x71, 0x1E, 0x30, 0x2F, 0x09, 0x93, 0x30, 0x0D, 0x58, 0x33, 0x44,
-    0x7A, 0x89, 0x74, 0x7D, 0x43, 0x33, 0x1F, 0xD0, 0x3F, 0xCA, 0xD7, 0xB8, 0xCE, 0xAF, 0x0A, 0xC6,
-    0xF7, 0x3C, 0x2B, 0x7A, 0x70, 0xFE, 0xA3, 0x87, 0x0C, 0xB3, 0x1F, 0xA5, 0x7D, 0x1E, 0xF0, 0x7F,
-    0x93, 0xB6, 0x96, 0xBF, 0x8D, 0x64, 0xAD, 0x5D, 0x86, 0x1F, 0x71, 0x36, 0x4C, 0x41, 0x57, 0xCE,
-    0x74, 0xB7, 0x06, 0xD5, 0x38, 0xF3, 0xF2, 0x93, 0x75, 0x66, 0x5F, 0xF5, 0xEA, 0x3D, 0x65, 0x84,
-    0x44, 0xA3, 0x53, 0xB9, 0xFD, 0x77, 0xC7, 0xD1, 0x7D, 0xCA, 0x28, 0x62, 0x77, 0xA4, 0x4D, 0x61,
-    0xCA, 0x39, 0x0F, 0x05, 0x8D, 0x9E, 0x3C, 0x78, 0xDC, 0x3D, 0xB0, 0x3C, 0xB8, 0xF4, 0xFC, 0x28,
-    0xB9, 0xCE, 0x90, 0x3C, 0xF4, 0xB9, 0x56, 0x3B, 0xB7, 0x89, 0x8E, 0x5D, 0xCB, 0x9F, 0xFB, 0x9A,
-    0xA0, 0xFE, 0xC3, 0x4B, 0x3C, 0xDE, 0x13, 0x34, 0xEE, 0x98, 0xDD, 0x2B, 0x24, 0xC3, 0x14, 0x3D,
-    0x95, 0xBF, 0x41, 0x29, 0x87, 0xB6, 0x42, 0x1B, 0x49, 0xE4, 0xE5, 0x41, 0xDB, 0x8E, 0x46, 0x07,
-    0x8D, 0x6B, 0xDD, 0x92, 0xB9, 0x3F, 0xB5, 0xC1, 0x91, 0xA2, 0x44, 0x3E, 0xDD, 0xD7, 0x98, 0x12,
-    0x5D, 0x48, 0x44, 0x5B, 0xA8, 0x86, 0x9F, 0xFD, 0xCA, 0x29, 0xE2, 0x4A, 0xC6, 0xE2, 0x1A, 0xF3,
-    0x87, 0x5D, 0x33, 0xEB, 0x3D, 0xE6, 0xFA, 0xF4, 0x99, 0xF9, 0x12, 0xE7, 0x76, 0x93, 0x07, 0xEC,
-    0x5D, 0x2B, 0x9F, 0xAE, 0x17, 0xB7, 0x95, 0x67, 0xB6, 0xDC, 0x2E, 0x97, 0x7A, 0x1B, 0xEB, 0x7B,
-    0x92, 0x40, 0x26, 0xFF, 0x03, 0xC5, 0x59, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0x24, 0x2D, 0xD1,
-    0x32, 0xAD, 0xFB, 0x0C, 0x44, 0x42, 0x0C, 0x58, 0x36, 0x3D, 0x68, 0x50, 0x91, 0xD3, 0xD1, 0xC3,
-    0x01, 0xBD, 0x00, 0xC7, 0x23, 0x95, 0x0C, 0x19, 0x8C, 0x22, 0x1A, 0x4E, 0x31, 0x50, 0x17, 0x4D,
-    0x86, 0x2E, 0x76, 0x83, 0x5A, 0x05, 0x8A, 0x42, 0x40, 0x4F, 0x3A, 0xC6, 0x1E, 0xBA, 0xAA, 0x40,
-    0x90, 0x0E, 0x5D, 0x0C, 0xB4, 0x83, 0xDD, 0x02, 0xD1, 0x0D, 0x01, 0x2A, 0x34, 0x27, 0x1D, 0x1D,
-    0x0F, 0x19, 0x82, 0xC0, 0xB4, 0x8D, 0xA6, 0x43, 0x87, 0x32, 0x68, 0x3B, 0x34, 0x46, 0x6B, 0x0E,
-    0x14, 0x40, 0x21, 0x77, 0xC7, 0xFE, 0xDE, 0x47, 0xDE, 0x9D, 0x9C, 0xD4, 0x71, 0x64, 0xD9, 0x2A,
-    0x8F, 0xEF, 0x41, 0x1F, 0xF9, 0x7D, 0xEF, 0xBD, 0xEF, 0x7D, 0xEF, 0x2F, 0x35, 0xB5, 0xB6, 0x36,
-    0x4F, 0x47, 0x8A, 0xC5, 0x62, 0x15, 0x97, 0x8D, 0xAB, 0xF6, 0x1D, 0x9A, 0x20, 0x9A, 0x24, 0xEA,
-    0x84, 0xFA, 0x7F, 0xBA, 0xE2, 0x7B, 0xB6, 0x35, 0x59, 0xAD, 0x4D, 0x92, 0x3D, 0xB8, 0x6B, 0xF2,
-    0x36, 0x27, 0x49, 0x7C, 0x7A, 0x5C, 0x4B, 0xBB, 0x74, 0x65, 0x9D, 0x27, 0xE3, 0xC6, 0xA5, 0xA4,
-    0x21, 0xE9, 0x77, 0xBB, 0x24, 0xA8, 0x4A, 0xA6, 0x84, 0x13, 0x00, 0xC2, 0x18, 0xE0, 0x12, 0x5D,
-    0xF9, 0xC2, 0xA3, 0x1F, 0x03, 0xD4, 0x00, 0x73, 0xC3, 0x0C, 0xF8, 0x6F, 0xCD, 0x23, 0x32, 0x6E,
-    0x28, 0xAE, 0x93, 0xA6, 0xF4, 0xA3, 0x53, 0x5D, 0xCA, 0xAF, 0xF2, 0xA5, 0xA2, 0x95, 0x26, 0x82,
-    0xA2, 0x19, 0x2A, 0x17, 0xA9, 0x82, 0x1B, 0x7F, 0x60, 0x68, 0xA5, 0x71, 0xE5, 0x52, 0x11, 0x13,
-    0x3A, 0x91, 0x13, 0x5A, 0x81, 0xE9, 0x09, 0xCF, 0x20, 0xC3, 0x2F, 0x90, 0x16, 0xCC, 0x90, 0x1A,
-    0x55, 0x88, 0xE2, 0x65, 0xA2, 0x4D, 0x10, 0xB7, 0x7D, 0x1A, 0xEF, 0xFC, 0x8B, 0xC6, 0x37, 0xBE,
-    0x90, 0x02, 0x8C, 0x6F, 0xDC, 0x94, 0x20, 0x85, 0x61, 0xB0, 0x3C, 0xE2, 0x3D, 0x84, 0xC3, 0x4B,
-    0xF2, 0x1D, 0x0D, 0x95, 0xD4, 0x33, 0x7E, 0x1D, 0x15, 0x28, 0x3A, 0x4D, 0xAD, 0x33, 0x44, 0xA6,
-    0x4B, 0x22, 0x26, 0x33, 0xA5, 0x4A, 0x33, 0xAC, 0xE8, 0x89, 0x4D, 0x6D, 0xCB, 0xB3, 0x45, 0x52,
-    0x54, 0xD3, 0xB7, 0xC9, 0x8A, 0x48, 0x8B, 0xC0, 0xF5, 0x28, 0x55, 0x4E, 0x53, 0xD9, 0xA4, 0x65,
-    0xF1, 0x59, 0xA8, 0x6C, 0xBB, 0xB3, 0x47, 0x1B, 0x56, 0xA3, 0x34, 0xD8, 0xD1, 0xA9, 0x74, 0x9D,
-    0xA8, 0xB7, 0xD4, 0x86, 0xA4, 0xE0, 0x2F, 0xE8, 0xB2, 0xEA, 0x17, 0x8D, 0xDF, 0x04, 0x61, 0xE5,
-    0x8C, 0x12, 0x2C, 0x2F, 0x57, 0xC9, 0x2D, 0xB7, 0x1A, 0x44, 0x95, 0xD6, 0x0A, 0xD1, 0x5C, 0x86,
-    0x78, 0x88, 0x17, 0x54, 0x2E, 0x97, 0x68, 0x71, 0xB9, 0x28, 0xDE, 0xF3, 0xA3, 0x82, 0xF2, 0x27,
-    0xD5, 0xD7, 0x7D, 0x32, 0x5C, 0xDA, 0x55, 0xB6, 0x20, 0x55, 0x1A, 0x64, 0xD4, 0x8D, 0x84, 0x4C,
-    0x93, 0x26, 0x04, 0x29, 0x1B, 0x54, 0x7A, 0x9D, 0xAA, 0x38, 0x06, 0x93, 0xAC, 0x3F, 0x78, 0x63,
-    0x0B, 0x2E, 0x2D, 0x9E, 0x50, 0xFC, 0x50, 0xBF, 0xE6, 0x0B, 0xC3, 0xAB, 0x59, 0xB4, 0xEA, 0x90,
-    0x25, 0x5C, 0xE3, 0x35, 0x5F, 0xBB, 0x15, 0x50, 0xB0, 0x7C, 0xF9, 0xF7, 0x37, 0x9A, 0x69, 0x8F,
-    0xF2, 0x83, 0xCC, 0xEF, 0x66, 0xB7, 0xD9, 0x7D, 0x8C, 0xDC, 0xD3, 0x75, 0xC8, 0x6D, 0x3D, 0xF4,
-    0xC2, 0x8A, 0xF1, 0x0A, 0xE4, 0x36, 0x16, 0xC2, 0x72, 0xCB, 0x58, 0x08, 0x2A, 0x2D, 0x50, 0x9C,
-    0x6B, 0x19, 0x7D, 0xC8, 0x6D, 0xBC, 0x0E, 0xB9, 0x8D, 0xF3, 0x5E, 0xB9, 0x6C, 0xBC, 0x1A, 0x2C,
-    0x17, 0xCD, 0x5F, 0xC5, 0x51, 0x61, 0x7A, 0xF1, 0x8D, 0xFF, 0x29, 0xF7, 0xF4, 0xD2, 0x12, 0x1F,
-    0x3D, 0x8C, 0xC0, 0x8C, 0xED, 0x46, 0xAB, 0x10, 0x89, 0x56, 0x61, 0x65, 0xDE, 0x4A, 0x14, 0x97,
-    0xDF, 0x56, 0x46, 0xF7, 0xE5, 0x6D, 0x29, 0xE7, 0x9E, 0x27, 0x34, 0x95, 0x11, 0xA8, 0xE3, 0xF9,
-    0xB1, 0xF5, 0xD5, 0x76, 0xCB, 0x3E, 0x6B, 0xC3, 0xF0, 0x56, 0x28, 0xD4, 0xBC, 0x82, 0xFA, 0xF2,
-    0xF7, 0xD3, 0xFE, 0x52, 0x7D, 0x1C, 0xCF, 0x23, 0xFB, 0x2C, 0x9E, 0x1A, 0xC1, 0x58, 0x9B, 0x4A,
-    0x9E, 0x15, 0xDA, 0xDB, 0xC9, 0x18, 0x9B, 0x80, 0x57, 0xC2, 0xD4, 0x75, 0x10, 0xA9, 0x53, 0x9B,
-    0x36, 0x9F, 0x00, 0x89, 0x84, 0x2D, 0xB5, 0x4B, 0x9D, 0x8B, 0xAB, 0xF4, 0xC7, 0x9E, 0xE5, 0xE2,
-    0xBC, 0x89, 0x21, 0x06, 0xF4, 0xD8, 0x1E, 0x01, 0x36, 0xF1, 0xCE, 0xD2, 0xA0, 0xD9, 0xFB, 0x09,
-    0x75, 0xBA, 0x45, 0x4A, 0xF7, 0x00, 0x8F, 0x9B, 0x00, 0x0B, 0xA0, 0xBC, 0x0D, 0x0B, 0x9E, 0xF9,
-    0x96, 0xD0, 0x28, 0xB9, 0x6A, 0xD7, 0x0C, 0x4E, 0xAE, 0xAD, 0xCD, 0xF1, 0xE1, 0x08, 0x5F, 0x0D,
-    0x95, 0xF0, 0x42, 0xD0, 0x74, 0xC9, 0x35, 0xFC, 0x0F, 0xFD, 0x17, 0x7C, 0x6D, 0xCF, 0xEF, 0xA5,
-    0x64, 0xBA, 0xAE, 0xF7, 0xC8, 0x14, 0xAE, 0xAD, 0xFB, 0x55, 0x2D, 0xBF, 0xE7, 0x75, 0x4F, 0x6C,
-    0x90, 0x52, 0xA7, 0x13, 0x53, 0x6C, 0xA1, 0x67, 0x04, 0x89, 0x5F, 0xFA, 0xDA, 0xBD, 0x48, 0xFB,
-    0x3C, 0x32, 0x6E, 0x07, 0x30, 0x8B, 0x62, 0x81, 0xBD, 0x8C, 0xA4, 0xCE, 0xF5, 0x80, 0x4D, 0xA0,
-    0x19, 0x10, 0x1E, 0xBC, 0x10, 0xB0, 0x9E, 0x71, 0xF0, 0x2D, 0x89, 0x43, 0xC6, 0xAA, 0xCF, 0x98,
-    0xDD, 0x56, 0x0B, 0x0C, 0x5A, 0x04, 0x2E, 0xA8, 0x11, 0xBD, 0xB4, 0x5B, 0xD4, 0x23, 0x9A, 0xAE,
-    0x57, 0x26, 0x59, 0x29, 0xAD, 0x39, 0xC6, 0xE1, 0x32, 0xB0, 0xEA, 0xFB, 0xC0, 0xDA, 0xD5, 0x34,
-    0x75, 0xC9, 0x20, 0x05, 0x7F, 0x17, 0xA4, 0xE2, 0x8A, 0xA4, 0xEF, 0x32, 0xBB, 0xB1, 0xFA, 0x88,
-    0xEF, 0x8C, 0xE4, 0x5B, 0x91, 0x7C, 0x1F, 0xCB, 0x91, 0x71, 0x61, 0x7C, 0x1D, 0xB8, 0x68, 0x37,
-    0xC0, 0xB7, 0xB2, 0x52, 0x02, 0xDF, 0xD6, 0x09, 0x76, 0xB4, 0x90, 0x4A, 0xCC, 0x11, 0x56, 0xC0,
-    0x71, 0x05, 0x24, 0x0C, 0x1E, 0x81, 0xA3, 0xA1, 0x32, 0x47, 0xFB, 0x02, 0xDB, 0x4D, 0x27, 0xCD,
-    0xEC, 0x86, 0x40, 0x84, 0x68, 0xB5, 0x0D, 0xB6, 0x91, 0x8D, 0xE7, 0xB0, 0x12, 0xAC, 0x80, 0xF9,
-    0x90, 0xC1, 0x2C, 0xC7, 0xDA, 0xCC, 0xB1, 0x04, 0x86, 0x9E, 0x55, 0x50, 0xDC, 0xD0, 0x2E, 0x1A,
-    0xFE, 0x76, 0x52, 0x31, 0xFD, 0x31, 0xB7, 0xF5, 0x5D, 0x10, 0x0D, 0x7F, 0xEB, 0x93, 0x7A, 0xEB,
-    0xB6, 0x4F, 0xDA, 0x35, 0x0D, 0x86, 0x6D, 0xC0, 0x38, 0x0B, 0x04, 0x13, 0x2F, 0x12, 0x86, 0x15,
-    0x32, 0xFF, 0xC1, 0x4C, 0x16, 0xE9, 0x08, 0x91, 0x23, 0xEF, 0x2C, 0x10, 0x60, 0x78, 0x9C, 0x78,
-    0xA3, 0x33, 0xA4, 0x74, 0x79, 0xCF, 0x88, 0x2B, 0x78, 0x59, 0x63, 0xE3, 0x61, 0xF3, 0x35, 0xA9,
-    0x6D, 0x7C, 0x16, 0xD3, 0xFB, 0x5E, 0xE6, 0x1E, 0x16, 0x23, 0xC1, 0x03, 0xDE, 0x07, 0xD1, 0xF5,
-    0x81, 0x57, 0x4A, 0xDB, 0x53, 0xD9, 0xF8, 0xB4, 0x84, 0x95, 0xD7, 0xE0, 0x18, 0xC0, 0xF6, 0x37,
-    0xC9, 0x4B, 0x66, 0x38, 0xF2, 0x56, 0x78, 0x5D, 0xD9, 0xC0, 0xBA, 0x16, 0xF8, 0x50, 0xA4, 0x85,
-    0x08, 0xD2, 0x69, 0xC4, 0x94, 0x62, 0x56, 0x0F, 0xD8, 0xC3, 0xBA, 0x38, 0x40, 0xDB, 0x2C, 0x45,
-    0x93, 0xD2, 0x48, 0x4F, 0xC3, 0x9C, 0xBC, 0xE9, 0xE6, 0xF6, 0x4C, 0x1F, 0x30, 0x0A, 0x0E, 0x89,
-    0xAF, 0xA4, 0xAC, 0x73, 0xEC, 0x11, 0x88, 0xB9, 0x34, 0xA7, 0xB9, 0xCF, 0x9D, 0xEF, 0x18, 0x53,
-    0x77, 0x02, 0x2C, 0xFB, 0x79, 0x0A, 0xB4, 0x58, 0x7A, 0xFE, 0x5B, 0x3D, 0x3A, 0x8E, 0xB5, 0x35,
-    0x4E, 0x42, 0x25, 0x31, 0xDC, 0xE0, 0x21, 0x68, 0x57, 0x12, 0x2D, 0xB0, 0x62, 0x8F, 0xB3, 0x1F,
-    0x4D, 0x16, 0x06, 0xCA, 0x7E, 0x3E, 0x2C, 0xD3, 0x94, 0x71, 0x69, 0xE7, 0x02, 0x76, 0xF5, 0x72,
-    0xC4, 0x7B, 0xFB, 0x69, 0xC4, 0x2E, 0xF6, 0x79, 0x84, 0xDA, 0x40, 0xB9, 0xC5, 0x7B, 0xD5, 0xDE,
-    0x61, 0xAC, 0x73, 0x58, 0xA0, 0x02, 0x88, 0x82, 0xA3, 0xB2, 0xB3, 0x04, 0x96, 0x2A, 0x3F, 0xE9,
-    0xA4, 0x32, 0x8C, 0x28, 0x32, 0x8C, 0x00, 0x1F, 0xD1, 0x5C, 0xE0, 0x39, 0x38, 0x75, 0x44, 0x15,
-    0xCB, 0xD5, 0x76, 0x96, 0x92, 0x34, 0x42, 0xF6, 0x48, 0x32, 0x5F, 0xE9, 0x93, 0xBA, 0x6B, 0xFA,
-    0x86, 0xAF, 0x05, 0xC2, 0xD5, 0x02, 0x8B, 0x14, 0x76, 0x2B, 0x5A, 0xCD, 0xA1, 0x9D, 0xC3, 0x56,
-    0x3E, 0xE6, 0x77, 0x4E, 0x6E, 0xE9, 0x02, 0x99, 0x50, 0xEB, 0x5D, 0xF4, 0xA9, 0xD9, 0x87, 0x4C,
-    0x78, 0xA0, 0x85, 0xB9, 0xE5, 0x03, 0xA6, 0xC1, 0xDE, 0xCA, 0x1D, 0xA0, 0x91, 0xFB, 0x24, 0xF2,
-    0x18, 0x29, 0xD2, 0x23, 0x09, 0xFC, 0x03, 0x7D, 0xE7, 0x42, 0x08, 0x99, 0x06, 0xB0, 0xC8, 0xD2,
-    0x0F, 0x01, 0xBB, 0x52, 0x77, 0xEA, 0xF4, 0xC8, 0x33, 0x68, 0x00, 0x50, 0x66, 0xD0, 0x77, 0x96,
-    0x62, 0xD0, 0x88, 0x47, 0x0C, 0xE2, 0xBC, 0x32, 0xA2, 0x67, 0x4F, 0xDF, 0xC0, 0xBE, 0x04, 0x26,
-    0x54, 0x11, 0x21, 0xDF, 0x9A, 0x78, 0xB6, 0xF4, 0xCF, 0x9E, 0x24, 0x42, 0x5D, 0x44, 0x9B, 0xF6,
-    0xD0, 0x9C, 0x9F, 0xA1, 0xEC, 0x8E, 0xAC, 0xDA, 0x10, 0x5A, 0xB3, 0x18, 0xE8, 0xA4, 0xA4, 0x27,
-    0x3C, 0xF7, 0x5B, 0xDE, 0x7A, 0xCC, 0x4B, 0x28, 0x23, 0xD4, 0x60, 0x47, 0x53, 0xBC, 0x03, 0xD1,
-    0x41, 0xC1, 0x67, 0x74, 0xE9, 0xCC, 0x3C, 0x84, 0x7C, 0x7A, 0x3A, 0x27, 0x27, 0xC8, 0x36, 0xC9,
-    0x16, 0x43, 0x75, 0x3D, 0x0D, 0x11, 0x27, 0x45, 0x22, 0xD5, 0x77, 0xAE, 0x04, 0x78, 0xA4, 0xC8,
-    0xE5, 0xAB, 0x8C, 0x1C, 0x46, 0xA6, 0xCB, 0xC8, 0x03, 0x12, 0x9E, 0x93, 0x46, 0xC2, 0x7B, 0x71,
-    0x67, 0x51, 0x64, 0xC3, 0x01, 0x92, 0x53, 0x9C, 0xC1, 0x32, 0x10, 0xD0, 0x77, 0x2E, 0x86, 0x20,
-    0xDA, 0xE7, 0xA2, 0x9E, 0xA3, 0x93, 0x88, 0xCF, 0x11, 0x9D, 0xEE, 0xE0, 0x68, 0xA6, 0x8C, 0x3C,
-    0x2D, 0x39, 0x21, 0xA5, 0x31, 0xB8, 0x9B, 0xEB, 0xA8, 0x88, 0xE0, 0x8E, 0x7D, 0x46, 0x0F, 0x5D,
-    0xA0, 0x3B, 0x3E, 0xD0, 0xC7, 0x21, 0xD0, 0x47, 0x31, 0x27, 0xDF, 0x2E, 0xA3, 0x35, 0x46, 0x16,
-    0x23, 0xF1, 0x09, 0x90, 0xFE, 0x00, 0x48, 0xFD, 0x92, 0xE3, 0x47, 0xCA, 0xA8, 0xC9, 0x79, 0xD0,
-    0x21, 0xA7, 0x4B, 0x03, 0x45, 0xD4, 0x28, 0xEF, 0x1C, 0xE4, 0x81, 0x13, 0xAD, 0x0F, 0x0C, 0xEA,
-    0x0A, 0xA4, 0x52, 0x77, 0x4F, 0x05, 0x28, 0xF9, 0x11, 0x09, 0x4C, 0xF6, 0x68, 0x87, 0xDD, 0xB9,
-    0xC6, 0x6B, 0x56, 0xF9, 0x70, 0xDB, 0xEC, 0xA0, 0x5F, 0x41, 0xF2, 0x85, 0xCD, 0x53, 0x1C, 0x19,
-    0xA3, 0x78, 0x99, 0xF0, 0x15, 0x04, 0xAF, 0xD8, 0x80, 0xA3, 0xB1, 0xD3, 0xEF, 0xBD, 0xA4, 0xFD,
-    0x72, 0x4C, 0xE1, 0x1E, 0x85, 0x46, 0x29, 0xE8, 0x30, 0x98, 0xEB, 0x91, 0xD4, 0x38, 0xD0, 0x3C,
-    0x77, 0x39, 0xE7, 0x8E, 0x1D, 0x12, 0xF3, 0x23, 0x8C, 0x3A, 0x57, 0xB1, 0xD7, 0xBF, 0xB0, 0x79,
-    0x7B, 0x5B, 0x87, 0xC4, 0x77, 0xF6, 0x28, 0x07, 0x3D, 0x0E, 0xA9, 0xA3, 0x4E, 0xE9, 0x70, 0x94,
-    0x5D, 0xA6, 0xB9, 0x79, 0xDA, 0x34, 0x5E, 0x09, 0xD5, 0xBF, 0x7A, 0xB4, 0xCD, 0x79, 0x41, 0x7D,
-    0xE0, 0x1A, 0x57, 0x83, 0x12, 0x7D, 0x50, 0xE1, 0xDA, 0x97, 0xAF, 0x73, 0x2C, 0xC7, 0xF5, 0x81,
-    0x1C, 0x1A, 0xCB, 0x81, 0x7C, 0xE9, 0x50, 0x81, 0xE5, 0x98, 0x61, 0x39, 0xCA, 0x2C, 0x47, 0x8B,
-    0xB9, 0x23, 0xE1, 0xB4, 0x61, 0xE5, 0xD4, 0xD6, 0x59, 0x8E, 0x02, 0xCB, 0x31, 0x83, 0x59, 0xB5,
-    0x0A, 0xCB, 0xD1, 0x62, 0x39, 0x82, 0x81, 0x1C, 0x5A, 0xA7, 0xCF, 0xA5, 0xE9, 0xF0, 0x92, 0x05,
-    0x9E, 0xEE, 0x0F, 0x2C, 0x8E, 0xD9, 0xCA, 0xAB, 0xD3, 0x57, 0xD3, 0xC0, 0x8C, 0xA9, 0xE9, 0xCA,
-    0xE2, 0x78, 0x5F, 0x48, 0x1B, 0xA1, 0x10, 0xDB, 0x81, 0x7B, 0xA3, 0xA7, 0xEC, 0xBF, 0xC1, 0xB9,
-    0x2C, 0xF5, 0x1E, 0xD1, 0xB4, 0x2C, 0x41, 0xA4, 0xC7, 0xAD, 0xEC, 0x2D, 0xF5, 0x0E, 0x87, 0xB9,
-    0xAC, 0x3E, 0xF8, 0x54, 0xF4, 0xF3, 0x10, 0x63, 0x32, 0xCF, 0xA9, 0xCF, 0x9D, 0xF9, 0xB8, 0xCA,
-    0x59, 0xFF, 0x35, 0x70, 0x13, 0xBA, 0xBF, 0x47, 0x9C, 0xFF, 0xAB, 0xC6, 0x9D, 0xBE, 0x9E, 0x7A,
-    0xC8, 0xCE, 0xDB, 0x9C, 0x5C, 0x2A, 0x04, 0x6B, 0x59, 0x66, 0x05, 0xC1, 0x24, 0x56, 0xB9, 0xFA,
-    0xB7, 0x38, 0x12, 0x89, 0xF3, 0x9C, 0xC5, 0x3F, 0x1D, 0x94, 0x6B, 0xB2, 0x70, 0x7A, 0x2C, 0x92,
-    0x53, 0x1C, 0x54, 0xB5, 0x0E, 0x9A, 0x2F, 0x64, 0x96, 0x2C, 0xBF, 0xEE, 0x70, 0xDE, 0x45, 0xAD,
-    0x14, 0xA1, 0x95, 0x44, 0x2D, 0xA7, 0x46, 0x7B, 0x7F, 0x1A, 0x43, 0xA0, 0x46, 0xC8, 0x19, 0x68,
-    0x68, 0x06, 0x39, 0x19, 0xA1, 0x5E, 0xD2, 0xC8, 0xEA, 0x2C, 0xB4, 0xBB, 0x89, 0x70, 0xD5, 0x10,
-    0x0D, 0x67, 0xA0, 0x06, 0x80, 0xF0, 0xC5, 0x40, 0x0F, 0x9D, 0x60, 0xFB, 0xBA, 0x76, 0x37, 0x22,
-    0xED, 0x1E, 0x0C, 0xFC, 0x5E, 0x48, 0xDA, 0xDD, 0x04, 0xDA, 0xE8, 0xA0, 0x12, 0x33, 0x99, 0x62,
-    0x02, 0xCD, 0x34, 0xB4, 0x7B, 0x6E, 0x55, 0xBB, 0xEF, 0x55, 0x8D, 0xFB, 0xC1, 0x66, 0x33, 0x18,
-    0x36, 0x1B, 0x50, 0x1F, 0xCB, 0xFB, 0x33, 0xD9, 0x18, 0x41, 0xF6, 0x9B, 0x24, 0x1E, 0x04, 0x96,
-    0x12, 0xCD, 0x73, 0x29, 0xC4, 0xB7, 0xB2, 0x11, 0x5B, 0xEF, 0xC6, 0x0D, 0x8A, 0xDB, 0x14, 0x6F,
-    0x02, 0xAB, 0x71, 0xED, 0x87, 0x9B, 0x66, 0xD2, 0x1C, 0xAD, 0x87, 0x4A, 0xE7, 0xD9, 0xA7, 0x9F,
-    0x66, 0xF9, 0x16, 0xCA, 0x59, 0xD2, 0x3E, 0xF6, 0x8F, 0xC9, 0x3C, 0xB3, 0xAF, 0xE5, 0x48, 0x90,
-    0x46, 0x5C, 0x3E, 0xDD, 0x8C, 0xB2, 0xD4, 0xB8, 0xAF, 0xB5, 0xE3, 0x8A, 0x27, 0xAE, 0x05, 0xC6,
-    0xB5, 0xFC, 0xF8, 0xF7, 0x27, 0xF6, 0x14, 0x64, 0x76, 0xB5, 0xAB, 0xBE, 0xB6, 0xE0, 0x6B, 0xB7,
-    0x39, 0x8F, 0xEE, 0x5B, 0xF2, 0x9B, 0x72, 0xFA, 0xDF, 0x1E, 0xFA, 0x96, 0xD2, 0x57, 0xB1, 0xA4,
-    0xCB, 0x2B, 0x12, 0xCE, 0x7B, 0x40, 0xCA, 0x46, 0x9A, 0x76, 0xAD, 0x77, 0x77, 0x97, 0xEA, 0x0D,
-    0x7E, 0xC2, 0x1F, 0x3F, 0x68, 0x93, 0x9D, 0xB5, 0x0D, 0x67, 0x3D, 0x5B, 0x7B, 0xD3, 0x7C, 0x2F,
-    0x32, 0xBB, 0xFA, 0xC0, 0xAC, 0x2F, 0x91, 0xF1, 0x20, 0x34, 0x15, 0x74, 0xD1, 0x51, 0x83, 0xDC,
-    0xB6, 0xAC, 0xB3, 0xB3, 0xBB, 0x21, 0xB3, 0xA9, 0x43, 0xB3, 0xE2, 0x9F, 0x11, 0x3C, 0x8B, 0x7B,
-    0x7B, 0x04, 0x66, 0xE8, 0x4A, 0xF7, 0x94, 0x37, 0x5D, 0xA5, 0x27, 0x53, 0x7C, 0x76, 0xFA, 0x2B,
-    0xB2, 0x33, 0xCE, 0xA8, 0x3D, 0x0C, 0x24, 0xB5, 0xA4, 0x41, 0xED, 0x06, 0x35, 0x3A, 0x69, 0x77,
-    0x6B, 0xA9, 0x3E, 0xA4, 0x66, 0xD1, 0x94, 0xF8, 0x73, 0xAC, 0x0E, 0xBE, 0x20, 0x7D, 0xE5, 0xF4,
-    0xF7, 0xBD, 0xBC, 0x97, 0x9D, 0xBE, 0x77, 0x2C, 0xF3, 0xC3, 0xFD, 0x2C, 0xCF, 0x4E, 0x50, 0xBC,
-    0x3A, 0x88, 0x20, 0xFB, 0x63, 0xCD, 0xE9, 0x49, 0xF7, 0x08, 0x8B, 0xA7, 0x5D, 0x0B, 0x6E, 0xF4,
-    0xF5, 0x9F, 0x11, 0xCA, 0x84, 0x05, 0x72, 0x4A, 0xC8, 0xCE, 0xFF, 0xCD, 0xF3, 0x0C, 0x38, 0x5A,
-    0xB5, 0x7A, 0x7D, 0xE2, 0x9B, 0xE7, 0x9D, 0x3D, 0x99, 0xD8, 0x59, 0x85, 0xFE, 0x04, 0xAE, 0x28,
-    0x7C, 0x66, 0x91, 0xF9, 0x70, 0x32, 0x0E, 0x8E, 0xF9, 0x43, 0x9F, 0x54, 0xD9, 0xAB, 0xA1, 0x21,
-    0xBA, 0xDC, 0xC0, 0x79, 0xF7, 0xB0, 0x9B, 0x6D, 0x88, 0xE6, 0x60, 0x6F, 0x9C, 0xFE, 0xCC, 0x21,
-    0x34, 0x24, 0x94, 0x10, 0xE0, 0xAA, 0x24, 0x16, 0x62, 0x1A, 0xAA, 0x9A, 0x6B, 0x8C, 0xE6, 0x55,
-    0x4F, 0x56, 0x18, 0xDE, 0x6A, 0xF6, 0xF9, 0x6F, 0xE1, 0x06, 0x59, 0x77, 0x60, 0xC9, 0x89, 0x40,
-    0x7A, 0xD5, 0x82, 0x27, 0xFD, 0x8C, 0x50, 0x8B, 0x9A, 0x3D, 0x2D, 0xB3, 0x9B, 0x30, 0x6F, 0x98,
-    0xD1, 0xCB, 0xD0, 0x44, 0x7E, 0x04, 0x97, 0xE1, 0x90, 0x5F, 0x46, 0x52, 0x12, 0x1B, 0x3F, 0x96,
-    0x63, 0xAF, 0x6C, 0x99, 0x7C, 0x16, 0x96, 0xE4, 0xF2, 0xBD, 0x93, 0x8C, 0xE4, 0xCB, 0xCB, 0x7A,
-    0x99, 0x89, 0xB9, 0xF8, 0x9C, 0x7B, 0x46, 0x34, 0xD7, 0x00, 0x08, 0x9E, 0xEA, 0x7D, 0x9F, 0xC6,
-    0x07, 0x5F, 0x70, 0x0E, 0x42, 0xD3, 0xE5, 0xCF, 0xBD, 0xB3, 0x34, 0xD9, 0x8C, 0xE8, 0xA8, 0x1E,
-    0x1C, 0x98, 0x9E, 0xEA, 0x7A, 0x64, 0xDC, 0x0E, 0x49, 0xFF, 0x28, 0x1C, 0xC9, 0x7C, 0xC0, 0x3D,
-    0x57, 0x65, 0x8F, 0x3D, 0x54, 0x60, 0xFE, 0x8D, 0x99, 0xB2, 0xC8, 0xC5, 0x6F, 0xAB, 0xD9, 0x60,
-    0x0C, 0x2F, 0x7F, 0x00, 0x4E, 0x09, 0xE8, 0x75, 0xC1, 0xA7, 0x47, 0x0D, 0xF5, 0x7D, 0x94, 0x50,
-    0xE0, 0x50, 0x00, 0x14, 0x01, 0x65, 0x70, 0x0A, 0x2D, 0xAA, 0xF9, 0x25, 0x72, 0xDC, 0x8C, 0xD3,
-    0x99, 0x2C, 0x92, 0x8C, 0x2A, 0x08, 0x3B, 0x6F, 0x17, 0xD4, 0x2C, 0x45, 0x4D, 0xBB, 0xD3, 0x6E,
-    0xD3, 0xB7, 0x7C, 0x5D, 0xFE, 0xB4, 0xC7, 0x82, 0xC4, 0x01, 0xD2, 0xE0, 0xEE, 0x2F, 0x42, 0xEA,
-    0xFC, 0xBD, 0x37, 0xDA, 0x7E, 0xFB, 0x6B, 0x6D, 0xF8, 0x81, 0x69, 0x72, 0xFD, 0x69, 0x72, 0xEB,
-    0x8D, 0x58, 0x70, 0x7D, 0xE2, 0xE0, 0x34, 0xB9, 0xDD, 0x6E, 0xD7, 0x1E, 0x69, 0xB7, 0x0F, 0xBE,
-    0x6F, 0xAE, 0x11, 0xC2, 0xEC, 0x9F, 0x32, 0x79, 0xE7, 0xB1, 0xB4, 0x38, 0xBD, 0xD8, 0x09, 0x2D,
-    0x14, 0x04, 0xBA, 0x27, 0x3C, 0x1D, 0xCE, 0x21, 0x10, 0xB1, 0x27, 0x51, 0x16, 0x20, 0x57, 0xC7,
-    0x38, 0x85, 0x4D, 0x84, 0xDD, 0x06, 0x0A, 0x15, 0x1B, 0xEB, 0x4C, 0xEC, 0x51, 0xF8, 0x32, 0xC0,
-    0xCB, 0xFA, 0x96, 0xCF, 0x64, 0x3E, 0xFB, 0xAA, 0x31, 0x9E, 0x07, 0x92, 0x0E, 0xBF, 0xF6, 0x33,
-    0x27, 0x1B, 0xC2, 0xAD, 0xDF, 0x91, 0x7E, 0x87, 0x9B, 0x5F, 0xE1, 0xEB, 0xA1, 0x16, 0xE8, 0x28,
-    0x29, 0x74, 0x14, 0x27, 0x3A, 0x4A, 0xFF, 0x0C, 0xD4, 0x0C, 0x02, 0x2D, 0xD4, 0x81, 0xF5, 0x7F,
-    0x5F, 0xF1, 0xF4, 0x4F, 0xFA, 0x8F, 0xD2, 0xF0, 0xB3, 0xAF, 0x1B, 0x1D, 0xB6, 0x87, 0xB7, 0x66,
-    0x21, 0x1B, 0x77, 0xF9, 0x8D, 0xE1, 0xCE, 0x9E, 0xF5, 0x3E, 0xFE, 0x0B, 0xBD, 0x5A, 0x3D, 0x6C,
-    0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x6B, 0x6A, 0x64, 0x2D, 0xC8, 0x55, 0x21, 0x21, 0x41, 0x4C, 0x7B,
-    0x55, 0xA4, 0x10, 0x12, 0x92, 0xEB, 0x82, 0x89, 0x59, 0x90, 0xBC, 0x55, 0x5C, 0xA4, 0x70, 0xE1,
-    0x2B, 0x44, 0xBB, 0x30, 0x10, 0xB9, 0x48, 0x13, 0x23, 0x90, 0x88, 0x40, 0x08, 0x04, 0xE4, 0xC8,
-    0xDB, 0x34, 0x69, 0xDC, 0xA8, 0x88, 0x53, 0x33, 0x80, 0x10, 0xD8, 0x6A, 0xA4, 0xC2, 0x05, 0x83,
-    0x50, 0xBA, 0x91, 0x55, 0x08, 0x88, 0x11, 0x68, 0x11, 0x80, 0x71, 0x00, 0x37, 0x1B, 0x27, 0x06,
-    0x9C, 0x08, 0xB0, 0x36, 0xF6, 0x32, 0x3E, 0x59, 0x77, 0x37, 0xF9, 0xDE, 0x9B, 0xDD, 0xE3, 0x51,
-    0x96, 0x28, 0x1E, 0xFF, 0xC8, 0x9D, 0x47, 0xDE, 0xEE, 0xCE, 0xCC, 0x37, 0xEF, 0xCD, 0xFB, 0x9D,
-    0xA3, 0x9A, 0x89, 0x89, 0xBE, 0x77, 0x95, 0xAA, 0x9F, 0x1C, 0xCD, 0x2D, 0x40, 0xBC, 0x36, 0x88,
-    0x6A, 0x80, 0xF8, 0x73, 0x20, 0xA3, 0x11, 0xC8, 0x78, 0x08, 0x32, 0x13, 0x24, 0x44, 0xD3, 0xBE,
-    0x26, 0xBA, 0xAE, 0x52, 0x74, 0xF0, 0x32, 0x72, 0x8C, 0xC9, 0xC9, 0xD5, 0x54, 0x90, 0x97, 0x50,
-    0x87, 0x14, 0x51, 0x83, 0x02, 0xA2, 0x39, 0x0A, 0x63, 0x6A, 0x92, 0xC9, 0x95, 0xC9, 0x7C, 0x93,
-    0x1E, 0xBB, 0x8A, 0x8E, 0xE4, 0xBC, 0x47, 0xC1, 0xBD, 0x34, 0x72, 0xF2, 0x49, 0xBC, 0x2E, 0x97,
-    0x73, 0xAD, 0x88, 0x7E, 0x5B, 0x34, 0xA8, 0x58, 0xA3, 0x62, 0x15, 0xD4, 0x2D, 0xE6, 0x7F, 0xB2,
-    0x1A, 0xB6, 0x9B, 0x0C, 0xE7, 0x84, 0x0B, 0x32, 0xE1, 0x83, 0x04, 0xBD, 0x0A, 0xD9, 0xC1, 0x02,
-    0x1D, 0xA1, 0x44, 0x39, 0xDA, 0x33, 0x09, 0xDD, 0xA4, 0xA1, 0xE1, 0x1E, 0x18, 0x2A, 0xE6, 0x02,
-    0x8F, 0x7F, 0x9D, 0x21, 0xF1, 0x27, 0x87, 0x67, 0xA2, 0xAF, 0x99, 0xA3, 0xCD, 0x64, 0x08, 0x90,
-    0x6E, 0x4A, 0xE0, 0x26, 0x46, 0x07, 0x96, 0xE0, 0x33, 0x52, 0x1D, 0xCB, 0xCD, 0x79, 0xB4, 0x55,
-    0x3B, 0xB4, 0x1B, 0xDB, 0x5B, 0x51, 0x8F, 0xDC, 0x07, 0xA1, 0xF6, 0xB5, 0x97, 0x06, 0xB1, 0x97,
-    0x46, 0xE4, 0xC8, 0x5B, 0x4B, 0x65, 0x5B, 0x2B, 0xDB, 0x8D, 0xF2, 0x33, 0x3F, 0xAB, 0xA1, 0x01,
-    0x33, 0x05, 0x29, 0xA5, 0x5E, 0xF7, 0x0D, 0x4D, 0xCD, 0x5E, 0x5F, 0x5E, 0x4A, 0x53, 0x10, 0xD3,
-    0x24, 0xD1, 0x8B, 0xF2, 0xF1, 0x67, 0xE4, 0xDF, 0xCB, 0x42, 0x27, 0x9F, 0xA3, 0xBC, 0x41, 0xF1,
-    0x9A, 0x8C, 0x65, 0xAF, 0x06, 0xAF, 0x1C, 0x43, 0x7D, 0x37, 0xF8, 0x34, 0x77, 0x4D, 0xDA, 0xEF,
-    0x8F, 0x05, 0x07, 0x58, 0xDA, 0x24, 0xF8, 0xF0, 0xE2, 0xB1, 0x03, 0x81, 0xB8, 0x4C, 0x64, 0x62,
-    0xEF, 0xB6, 0x3E, 0x42, 0x2B, 0x43, 0x43, 0x04, 0x5F, 0xC9, 0x03, 0x44, 0x2F, 0xEB, 0x0F, 0xB7,
-    0xAF, 0xF0, 0x66, 0xE5, 0x9D, 0xD9, 0x6A, 0xE8, 0xA1, 0xD9, 0x77, 0xF1, 0x79, 0xB0, 0xEE, 0x12,
-    0x06, 0x06, 0x46, 0x95, 0x1E, 0x04, 0xFB, 0xD4, 0x99, 0xD4, 0xFD, 0x28, 0x21, 0x63, 0x5F, 0xDE,
-    0x05, 0x44, 0x9A, 0x1E, 0x03, 0x79, 0x81, 0xD7, 0xE8, 0x8B, 0x0A, 0x55, 0xAC, 0xAC, 0x99, 0x07,
-    0x18, 0x7E, 0xE3, 0x42, 0x4A, 0x6E, 0xEE, 0xB4, 0x41, 0x30, 0x03, 0x48, 0x8D, 0x49, 0x18, 0x33,
-    0x49, 0x40, 0x82, 0x27, 0x11, 0x79, 0xA5, 0x56, 0x75, 0xC3, 0x00, 0x6A, 0xE3, 0x8D, 0x0C, 0x83,
-    0x32, 0x72, 0xAF, 0x07, 0x3D, 0x58, 0xC6, 0xAE, 0x9C, 0xC2, 0xB6, 0x9A, 0xC2, 0xD6, 0x9C, 0x22,
-    0xE7, 0xDD, 0x29, 0xF2, 0xCD, 0x79, 0x8A, 0xCE, 0xF4, 0x00, 0x73, 0x19, 0x68, 0xE7, 0x01, 0x9A,
-    0xDB, 0x54, 0xBF, 0xF1, 0x3D, 0x6E, 0xF3, 0x30, 0x12, 0xE1, 0xEF, 0xEE, 0xC7, 0xCA, 0x84, 0xF9,
-    0x30, 0x48, 0x6B, 0x26, 0x0F, 0x92, 0x6F, 0x6D, 0xD4, 0x87, 0x42, 0x6A, 0x77, 0x28, 0x66, 0xC7,
-    0x9D, 0xDC, 0x8A, 0x63, 0x8A, 0x54, 0x6F, 0x8A, 0xC2, 0x8F, 0x3F, 0x17, 0x24, 0x15, 0xAA, 0x9D,
-    0x20, 0xA5, 0x16, 0xC6, 0x7B, 0xEB, 0xBD, 0x92, 0xBF, 0x26, 0x55, 0x1B, 0xAF, 0x67, 0x98, 0xB7,
-    0x6A, 0x75, 0x34, 0xEA, 0x37, 0x63, 0xC8, 0xDD, 0x38, 0x4B, 0x5B, 0xEE, 0xE5, 0x74, 0x1C, 0x6D,
-    0x9A, 0x9B, 0xDA, 0x58, 0x28, 0x30, 0x46, 0x01, 0x1B, 0x7F, 0xE4, 0xEA, 0xE5, 0x52, 0xF6, 0xF7,
-    0x53, 0x91, 0x7D, 0xBB, 0x41, 0x6B, 0x0D, 0x6A, 0xB4, 0x4C, 0xE7, 0xC6, 0xC2, 0xD9, 0xBE, 0xEC,
-    0x23, 0x3A, 0x11, 0xAC, 0x17, 0xA5, 0xEC, 0xEB, 0x47, 0x61, 0xD7, 0xC6, 0x01, 0x03, 0x26, 0xD3,
-    0x4F, 0xF7, 0x15, 0xD1, 0x08, 0xC5, 0x62, 0xCC, 0xB5, 0x35, 0xE6, 0xC3, 0xE1, 0xF2, 0xB4, 0x55,
-    0x15, 0xFE, 0xDB, 0xDF, 0x89, 0xFB, 0x83, 0x8B, 0x15, 0xF9, 0x86, 0x4C, 0x4A, 0x43, 0xE3, 0xDA,
-    0x37, 0x0C, 0xEC, 0x08, 0xC4, 0xAB, 0xCC, 0x90, 0x85, 0x52, 0x83, 0xD9, 0xC3, 0xEE, 0xD8, 0x39,
-    0x98, 0x17, 0xC4, 0x22, 0xD9, 0x2B, 0xCA, 0xE9, 0x88, 0xC8, 0x5E, 0x64, 0x39, 0xFB, 0x3E, 0x86,
-    0x82, 0xFE, 0xFA, 0x7A, 0x7F, 0xF9, 0x86, 0x11, 0x9D, 0xD4, 0xFB, 0x58, 0xCC, 0x4C, 0x63, 0x78,
-    0x91, 0xCA, 0x8F, 0xF8, 0x67, 0x71, 0x7C, 0x01, 0x16, 0x40, 0xA7, 0xBD, 0xD2, 0xE1, 0x51, 0x08,
-    0xA7, 0xEF, 0x3C, 0x78, 0xBD, 0x60, 0xA9, 0xB7, 0xD9, 0x5B, 0x15, 0xE8, 0x4D, 0xB1, 0x68, 0x9A,
-    0x35, 0x6A, 0x42, 0xD6, 0x2C, 0x19, 0x59, 0xC0, 0xC7, 0xC0, 0xC4, 0x4B, 0xE4, 0x74, 0xF8, 0x95,
-    0x36, 0x1B, 0xC7, 0x36, 0x5B, 0xC7, 0x36, 0x6F, 0x63, 0x68, 0xFF, 0x03, 0x68, 0x30, 0x5D, 0x30,
-    0x03, 0x1E, 0x41, 0xEC, 0x67, 0x0B, 0xB3, 0x7C, 0x92, 0x92, 0x17, 0x2F, 0xDA, 0x7B, 0x6F, 0xBD,
-    0xAA, 0xBD, 0x7B, 0x0F, 0x75, 0x90, 0x14, 0xF0, 0xCB, 0xAB, 0x70, 0xCC, 0x0D, 0x69, 0x41, 0xBC,
-    0x4A, 0xFE, 0x2D, 0x04, 0x06, 0x80, 0x8E, 0xB8, 0x40, 0xA4, 0xE5, 0xBF, 0x53, 0x27, 0xCF, 0x74,
-    0x49, 0x81, 0x5F, 0x73, 0x78, 0xE3, 0x12, 0xF9, 0x68, 0x41, 0x3C, 0x8B, 0x9E, 0xD1, 0x99, 0x35,
-    0xDC, 0xBF, 0x5C, 0xC6, 0x4C, 0xE3, 0xAA, 0x1F, 0x33, 0xB5, 0xE9, 0x50, 0xD6, 0xE7, 0xD2, 0x29,
-    0xE0, 0xE4, 0x68, 0x06, 0xAC, 0x5E, 0x8E, 0x0F, 0x66, 0x6D, 0x12, 0x60, 0x39, 0x45, 0x15, 0x6A,
-    0x6D, 0xFE, 0x1C, 0xB0, 0xEC, 0x26, 0x4B, 0xD9, 0x4D, 0x0D, 0x4C, 0xB9, 0xEF, 0x6B, 0x3B, 0x8C,
-    0x3D, 0x58, 0xAF, 0x62, 0x47, 0x0E, 0x58, 0xAC, 0x69, 0x73, 0xAB, 0x67, 0xAC, 0x08, 0x12, 0x6A,
-    0x0F, 0x2C, 0xF4, 0x40, 0x16, 0x29, 0x21, 0x85, 0x63, 0x78, 0xCA, 0xDB, 0x40, 0x70, 0x8C, 0x2E,
-    0x57, 0xE6, 0xD5, 0x31, 0x6D, 0xD5, 0xA6, 0x0B, 0xE9, 0x76, 0xFE, 0x1C, 0xC4, 0x18, 0x93, 0xB8,
-    0x1B, 0x0B, 0xE7, 0x92, 0xED, 0xDF, 0x53, 0x60, 0x9E, 0xE6, 0x41, 0x6D, 0x94, 0x8B, 0xA0, 0x85,
-    0xED, 0x1B, 0xCD, 0x20, 0x0E, 0x5A, 0x19, 0xB5, 0x5E, 0x50, 0x5B, 0x1B, 0xA5, 0x06, 0xDB, 0xAD,
-    0x2B, 0xA4, 0xEE, 0x1A, 0x52, 0x45, 0x98, 0xA8, 0x4C, 0x69, 0xA5, 0xBD, 0x6D, 0x9B, 0x9F, 0x79,
-    0x59, 0xAB, 0xE3, 0x75, 0x1E, 0x87, 0xFE, 0xFB, 0x5F, 0x5F, 0xBD, 0xF6, 0x19, 0x93, 0x7F, 0xED,
-    0x05, 0xFD, 0x20, 0xCA, 0x16, 0x38, 0xDE, 0x47, 0x7A, 0x07, 0xDC, 0xFE, 0xBC, 0x19, 0xAB, 0xDC,
-    0xD7, 0x2A, 0x55, 0x3B, 0x42, 0xF9, 0x0C, 0xD8, 0x7C, 0x4B, 0xFF, 0xC1, 0x24, 0xF1, 0x79, 0xCB,
-    0x72, 0x52, 0x12, 0xA8, 0xEC, 0xF0, 0x02, 0x28, 0x74, 0x19, 0x41, 0xC7, 0x54, 0xFF, 0xD2, 0xE8,
-    0xBA, 0xEC, 0x93, 0x91, 0xBA, 0x44, 0x6C, 0xDB, 0x5E, 0x30, 0x43, 0xD8, 0xDB, 0xE8, 0x6B, 0x93,
-    0xCD, 0xDD, 0xCD, 0x6B, 0x3A, 0x57, 0xDF, 0x25, 0x3A, 0x19, 0x47, 0xA9, 0xF7, 0x98, 0x5F, 0x3F,
-    0x6B, 0xF6, 0x4E, 0xB9, 0x9C, 0x2E, 0x86, 0x5D, 0x3A, 0x52, 0xEC, 0x7E, 0x9A, 0xFA, 0xD1, 0xEB,
-    0xE3, 0xB5, 0x36, 0xC7, 0x22, 0xDB, 0x4D, 0xB5, 0xBB, 0xB1, 0x29, 0x63, 0x85, 0xE1, 0x1C, 0x2C,
-    0x26, 0xFF, 0xDF, 0xE4, 0x76, 0xA1, 0x84, 0x2A, 0xB5, 0x31, 0xC6, 0x76, 0xB3, 0xB9, 0xDA, 0x87,
-    0x1E, 0x85, 0x48, 0xDA, 0x54, 0x07, 0x69, 0x1A, 0x72, 0x0D, 0x77, 0x33, 0x3E, 0xDE, 0x0D, 0x90,
-    0xED, 0x97, 0x06, 0x59, 0xA9, 0xB6, 0xEA, 0x72, 0x18, 0x5A, 0x70, 0x9F, 0xBD, 0x11, 0xCC, 0x28,
-    0x73, 0x8A, 0x4C, 0x8A, 0xCA, 0x04, 0x09, 0x91, 0x28, 0x3F, 0xE4, 0xE5, 0x77, 0xD9, 0x1E, 0x61,
-    0x13, 0xA7, 0xBE, 0x6C, 0xD9, 0xCA, 0x56, 0x9C, 0x8C, 0x19, 0x69, 0x13, 0x49, 0x8A, 0xDA, 0x51,
-    0xF3, 0xA1, 0xB2, 0xCD, 0xDE, 0xA0, 0x42, 0xB3, 0xEA, 0x80, 0xDB, 0x6C, 0x48, 0x1D, 0xEB, 0x0C,
-    0x3B, 0x30, 0x5C, 0xA4, 0xDE, 0x8E, 0x47, 0x1D, 0x9E, 0x26, 0x30, 0xDA, 0xE9, 0x0D, 0xE4, 0x27,
-    0x43, 0x5D, 0x6D, 0x5E, 0x06, 0x8C, 0xF5, 0xB2, 0x35, 0xA1, 0x50, 0xDC, 0x36, 0x4D, 0x4E, 0x22,
-    0x64, 0x29, 0x15, 0x03, 0x06, 0xC7, 0xD9, 0xF1, 0x05, 0x66, 0x79, 0x29, 0xE3, 0x5D, 0x66, 0xA9,
-    0xBA, 0x2C, 0x03, 0xEA, 0x55, 0x7C, 0x74, 0x38, 0xAB, 0x50, 0x31, 0xC8, 0x18, 0x47, 0x47, 0x33,
-    0x4C, 0x38, 0x4E, 0xFA, 0x12, 0x0C, 0x75, 0x1F, 0xC2, 0xC4, 0xB9, 0x9D, 0x26, 0xDF, 0x8B, 0x12,
-    0x90, 0x40, 0x5E, 0xE6, 0x11, 0x5D, 0xD9, 0x1A, 0x5D, 0x91, 0x3A, 0xEB, 0x9F, 0x5F, 0x39, 0xCE,
-    0xB3, 0x95, 0x30, 0xAC, 0x53, 0x65, 0x4E, 0x38, 0xF1, 0x13, 0x4C, 0xA2, 0x5E, 0xA8, 0x2B, 0xDD,
-    0x02, 0x67, 0x91, 0x71, 0xE8, 0x19, 0xB4, 0x8C, 0x14, 0x4C, 0xB7, 0xBA, 0x8B, 0x76, 0x1F, 0xFF,
-    0x7F, 0x02, 0x1E, 0xE8, 0x0E, 0xDA, 0x32, 0x5A, 0x44, 0x7E, 0x16, 0xA4, 0xAD, 0x4E, 0x19, 0x79,
-    0xF0, 0xA0, 0x22, 0x86, 0xD8, 0xBA, 0x96, 0xA3, 0x2C, 0xD3, 0x85, 0x7A, 0x73, 0xB7, 0xE3, 0x71,
-    0x15, 0x85, 0x6B, 0x2A, 0x08, 0x31, 0x49, 0xF7, 0x35, 0x80, 0x55, 0xE0, 0xD1, 0xF8, 0x71, 0xBB,
-    0xC6, 0xB1, 0xE5, 0x4C, 0x19, 0x5F, 0x5E, 0x1C, 0x88, 0x2F, 0xD7, 0xA8, 0x70, 0x53, 0x4F, 0x5C,
-    0x83, 0xCF, 0xBB, 0x71, 0x9B, 0x5F, 0x3F, 0x6B, 0x75, 0xF7, 0x71, 0x66, 0xCB, 0x29, 0xB6, 0x04,
-    0xEC, 0x51, 0x79, 0xFF, 0x8C, 0xEC, 0x14, 0x05, 0x77, 0xC5, 0x7F, 0xF1, 0x18, 0x98, 0x8B, 0x7D,
-    0x93, 0xAA, 0xB6, 0xA7, 0xDD, 0xDC, 0x43, 0x3A, 0xA9, 0x76, 0x8D, 0xA8, 0x75, 0x5B, 0xFB, 0xB7,
-    0x13, 0x75, 0x87, 0xD4, 0x9F, 0x59, 0x7C, 0x3B, 0xB9, 0xFC, 0x8C, 0x80, 0x65, 0x7B, 0x96, 0x78,
-    0xF0, 0x8E, 0x5E, 0x66, 0xFF, 0x3E, 0x05, 0x80, 0xE6, 0x7D, 0xF8, 0xF8, 0xB9, 0x3E, 0xC8, 0xD4,
-    0xED, 0x9C, 0xE9, 0x70, 0x00, 0xDE, 0x24, 0xF7, 0x2B, 0x28, 0x46, 0xCF, 0xD6, 0x6A, 0x38, 0x16,
-    0xF8, 0xE1, 0x36, 0x00, 0x9A, 0xA9, 0xDA, 0x6A, 0x1B, 0xFF, 0xE6, 0x75, 0xBD, 0x2C, 0x4C, 0x5F,
-    0xEA, 0xDF, 0x51, 0x79, 0xD3, 0x94, 0xDA, 0x24, 0x99, 0x0E, 0x5B, 0x19, 0x89, 0x15, 0xCB, 0x2A,
-    0x17, 0x76, 0x66, 0x46, 0xA6, 0x80, 0xEA, 0x85, 0x97, 0xDD, 0x0E, 0xAC, 0x3E, 0xA6, 0x06, 0xB9,
-    0x1F, 0x83, 0xDC, 0x85, 0x41, 0x77, 0xEF, 0x64, 0x20, 0x1F, 0x14, 0x20, 0xBA, 0xC3, 0x64, 0x99,
-    0x49, 0xC4, 0x24, 0xF8, 0x10, 0x44, 0xDD, 0x03, 0x71, 0x1F, 0x72, 0x71, 0xD0, 0x30, 0x69, 0xB2,
-    0xA5, 0xA9, 0x51, 0xAD, 0x23, 0x8A, 0x44, 0xA5, 0x22, 0xB4, 0x6D, 0xE1, 0xAE, 0xCC, 0x63, 0x4E,
-    0x9E, 0x79, 0x97, 0xA2, 0xBB, 0x26, 0xF6, 0xDA, 0x81, 0xF6, 0x72, 0x2F, 0x7D, 0xDA, 0x2F, 0x02,
-    0x83, 0xBC, 0xD9, 0xF5, 0xBA, 0x07, 0x8D, 0x94, 0x4E, 0x94, 0x75, 0x2C, 0xA2, 0x4B, 0x55, 0x29,
-    0x13, 0x81, 0xED, 0xAE, 0xF1, 0x5A, 0x8D, 0x41, 0x3C, 0xEB, 0x95, 0x39, 0x7A, 0xA9, 0x31, 0x65,
-    0x35, 0x2A, 0xE6, 0x52, 0xE6, 0x47, 0x2C, 0x14, 0x53, 0xF1, 0xE9, 0x10, 0xE4, 0xC1, 0x25, 0x2C,
-    0xAE, 0x60, 0x71, 0x38, 0x54, 0xD6, 0xAF, 0x76, 0xBB, 0x3E, 0xD9, 0x46, 0xCD, 0x2A, 0x69, 0xB4,
-    0x13, 0x8C, 0x2D, 0xB8, 0x57, 0x68, 0xA2, 0x75, 0xAE, 0x47, 0x59, 0x90, 0x47, 0x08, 0x20, 0x10,
-    0x98, 0x83, 0x60, 0xEF, 0xF9, 0xC9, 0x53, 0x49, 0x98, 0x22, 0xA2, 0x31, 0x1D, 0xBF, 0xF3, 0x14,
-    0x1E, 0xDC, 0x7E, 0x84, 0x07, 0xF3, 0xC2, 0x83, 0x57, 0x2A, 0x1E, 0x78, 0xC2, 0x03, 0xD3, 0xE7,
-    0x41, 0x8D, 0x79, 0x10, 0xF5, 0x79, 0xE0, 0x6F, 0x25, 0x5C, 0xD2, 0xA3, 0x9F, 0xDB, 0xA4, 0x6D,
-    0x17, 0x9C, 0x48, 0xC1, 0x89, 0xB4, 0x14, 0x71, 0x25, 0x66, 0x6D, 0x4B, 0x90, 0x7F, 0x24, 0x5B,
-    0x7C, 0xDC, 0x3C, 0xBC, 0xB8, 0x80, 0x8F, 0xEE, 0x83, 0xE7, 0xD8, 0x81, 0xC2, 0x97, 0x86, 0x6C,
-    0xCB, 0x6B, 0x9C, 0x2F, 0xCD, 0x73, 0xB1, 0x6C, 0x89, 0xF9, 0xB8, 0xC6, 0x41, 0xC0, 0x23, 0x44,
-    0x1E, 0xCC, 0xF1, 0x2B, 0x35, 0xA9, 0xB9, 0x73, 0xB7, 0x40, 0x03, 0xAE, 0x57, 0x70, 0x04, 0xD8,
-    0x2F, 0x70, 0x72, 0x15, 0xBE, 0x2C, 0x6F, 0x21, 0x2D, 0x02, 0xEF, 0x1F, 0xF2, 0x1C, 0x6B, 0xE8,
-    0x32, 0x87, 0x84, 0x88, 0xAB, 0x6D, 0xE1, 0x96, 0xD6, 0xC0, 0xD8, 0xB3, 0xB8, 0x3F, 0x0F, 0x1A,
-    0xFC, 0xBA, 0x4D, 0xFD, 0x12, 0xC4, 0x29, 0xDE, 0xA4, 0x33, 0xCC, 0x98, 0x88, 0xF3, 0x12, 0x95,
-    0x1D, 0x0E, 0x7E, 0x17, 0xB9, 0x9F, 0x07, 0xAD, 0x70, 0x8D, 0xA6, 0x32, 0x5A, 0xD9, 0xDB, 0x3A,
-    0x6C, 0x4E, 0x75, 0x87, 0x93, 0x2A, 0x3E, 0xD3, 0x98, 0xE5, 0x62, 0xCA, 0xE2, 0xCC, 0xE1, 0x2C,
-    0xC6, 0x46, 0x71, 0x48, 0x7B, 0xF3, 0x36, 0x79, 0xB7, 0x10, 0x30, 0xB0, 0xCB, 0xDC, 0x97, 0x05,
-    0x21, 0x59, 0x36, 0x46, 0x03, 0xF9, 0xA7, 0x6F, 0xB0, 0xEB, 0x4D, 0x5D, 0x1D, 0x62, 0x83, 0x3B,
-    0x5A, 0xB6, 0x79, 0x32, 0x2F, 0x15, 0xC1, 0x25, 0xA1, 0x6B, 0x15, 0x45, 0xCE, 0x0B, 0xBA, 0x7E,
-    0xB6, 0xBC, 0x63, 0x9F, 0xCE, 0x09, 0x95, 0x5E, 0xC7, 0x79, 0x04, 0xBA, 0x1E, 0x60, 0x34, 0xCA,
-    0xB1, 0x90, 0xF5, 0xD7, 0x72, 0x6A, 0x1A, 0x3E, 0xF4, 0x29, 0x31, 0xD3, 0x77, 0xA0, 0xC5, 0x0F,
-    0xB3, 0x1E, 0x52, 0x24, 0xFA, 0x53, 0xCA, 0xB8, 0x6B, 0x49, 0xC4, 0x38, 0x63, 0x8B, 0x38, 0x88,
-    0x41, 0x8D, 0x61, 0xFA, 0xCE, 0x82, 0xDC, 0x21, 0x79, 0xCA, 0xE6, 0xB4, 0x96, 0x08, 0xB7, 0xB4,
-    0x8B, 0xB5, 0xFC, 0xEF, 0xC1, 0x79, 0x5E, 0x4D, 0xB3, 0xBD, 0xA5, 0x34, 0x22, 0xC5, 0x02, 0x1B,
-    0x6B, 0xB3, 0x39, 0x3C, 0xB2, 0x59, 0xCC, 0xFC, 0x4C, 0x8A, 0xD5, 0x1C, 0x2E, 0xC2, 0x56, 0x81,
-    0x48, 0xB8, 0xB8, 0x95, 0x78, 0x1C, 0x47, 0x42, 0xDD, 0x5C, 0x23, 0x0E, 0x95, 0xA3, 0xCC, 0x7C,
-    0x59, 0xA2, 0x4C, 0x0E, 0x44, 0x03, 0xCD, 0x51, 0xA6, 0xF4, 0x95, 0x20, 0x5F, 0x7C, 0x6F, 0x33,
-    0x29, 0xFD, 0x61, 0x20, 0xE5, 0xC5, 0x45, 0x6B, 0x04, 0xAF, 0x44, 0x77, 0x3B, 0xDE, 0xDF, 0x97,
-    0xBC, 0x7C, 0x06, 0x73, 0x61, 0xD4, 0x6F, 0x5E, 0x3E, 0x97, 0xBA, 0x0F, 0x18, 0x95, 0xF5, 0x18,
-    0x62, 0x4B, 0x2C, 0x37, 0x6C, 0x98, 0x3E, 0x14, 0x42, 0x1B, 0xA8, 0x71, 0xC0, 0x11, 0xB3, 0x8D,
-    0x7B, 0xA6, 0xE2, 0x67, 0xC6, 0xB5, 0x54, 0x2E, 0x7C, 0x4A, 0xE5, 0xB3, 0x2A, 0x7D, 0x1E, 0x30,
-    0x9F, 0xC7, 0x60, 0x90, 0xEF, 0xC6, 0x65, 0xFA, 0x32, 0xE4, 0x2A, 0x4A, 0x19, 0xC1, 0x5D, 0xBD,
-    0x29, 0x06, 0xC2, 0x24, 0xE1, 0x8F, 0xF2, 0x59, 0xAE, 0xA3, 0x5E, 0xB4, 0xE5, 0x53, 0xE8, 0x60,
-    0x84, 0xF7, 0x31, 0x78, 0x2B, 0x15, 0x97, 0x06, 0x58, 0x4B, 0x8B, 0x34, 0x97, 0xD3, 0xEC, 0x2A,
-    0x35, 0x96, 0x9D, 0x9C, 0xAB, 0x55, 0xE5, 0x59, 0x92, 0x74, 0x40, 0x12, 0x23, 0x37, 0x9C, 0x2B,
-    0x34, 0x75, 0x8D, 0x2E, 0xF9, 0xC9, 0xFB, 0x5E, 0xBC, 0x2A, 0xD6, 0x26, 0x02, 0x6E, 0x4C, 0x8A,
-    0xDC, 0x44, 0xE9, 0x45, 0x4F, 0xE7, 0x9E, 0x5E, 0xF5, 0x93, 0xA8, 0x5B, 0xF1, 0xEE, 0x26, 0xBB,
-    0x69, 0x39, 0x7A, 0xBB, 0xBC, 0x47, 0x24, 0x48, 0x12, 0x3C, 0xB8, 0xA2, 0x80, 0xBE, 0x2D, 0x07,
-    0x99, 0xC3, 0x22, 0xD9, 0xE5, 0xD4, 0x8B, 0x32, 0x74, 0xC0, 0x97, 0x73, 0x81, 0x0F, 0x7F, 0x77,
-    0x3E, 0x2F, 0x5C, 0x28, 0x57, 0xA4, 0xA5, 0x8A, 0x3E, 0x02, 0x6B, 0x27, 0xEE, 0x80, 0xAB, 0xDC,
-    0x03, 0x87, 0x69, 0x7B, 0x61, 0xC8, 0x84, 0xA2, 0x60, 0xB2, 0x2C, 0x10, 0x0C, 0xCB, 0x10, 0x58,
-    0xA9, 0xF6, 0xD2, 0xB9, 0xF5, 0xD5, 0x45, 0x5F, 0xCF, 0xA2, 0x4D, 0xD4, 0x7D, 0x7D, 0x42, 0x36,
-    0xF6, 0x4E, 0x5B, 0x98, 0x92, 0xC3, 0xC7, 0x57, 0x5E, 0xE5, 0xE8, 0x0A, 0x9B, 0xB8, 0x9D, 0xCC,
-    0x05, 0x3F, 0xE2, 0x3F, 0x37, 0xE1, 0x74, 0x27, 0x58, 0xA7, 0x16, 0x52, 0xD3, 0xE4, 0xC9, 0x97,
-    0xE6, 0xFE, 0x08, 0x3B, 0xB8, 0xF7, 0x8D, 0x8A, 0xD5, 0xE7, 0xED, 0x39, 0x3B, 0xA7, 0xB0, 0x13,
-    0xDF, 0x38, 0x74, 0xD8, 0x3F, 0xF0, 0x29, 0xDB, 0x8A, 0x97, 0x63, 0xF7, 0x37, 0x43, 0x42, 0x7D,
-    0x3A, 0x86, 0x91, 0x73, 0xEB, 0xB1, 0x0F, 0x7F, 0xF3, 0x54, 0x0C, 0x4F, 0x60, 0x54, 0xB8, 0x4E,
-    0xD1, 0x7F, 0x9E, 0x38, 0x3B, 0x39, 0x92, 0x2F, 0x67, 0x2B, 0x44, 0x3F, 0x60, 0x27, 0x77, 0x2A,
-    0x2C, 0xCB, 0xF2, 0xAD, 0x1E, 0xDC, 0x44, 0x58, 0x50, 0x33, 0x86, 0x4B, 0x1A, 0xA7, 0xA1, 0x88,
-    0xB7, 0x49, 0x32, 0xD8, 0x77, 0xEC, 0x2A, 0x84, 0xF3, 0xBD, 0xD7, 0x58, 0xA0, 0x7D, 0x6B, 0xC0,
-    0xA1, 0xBE, 0x79, 0x99, 0x9C, 0x8F, 0x0D, 0x4C, 0xE5, 0x6A, 0xBF, 0x8C, 0xD3, 0xD4, 0x51, 0x99,
-    0xB4, 0x3E, 0xB9, 0x4E, 0x29, 0x34, 0x0D, 0xE0, 0x81, 0x7F, 0x85, 0x64, 0xEE, 0x9F, 0x56, 0x2F,
-    0x03, 0x8E, 0x59, 0xEC, 0xF7, 0x47, 0x0E, 0x01, 0x3D, 0x97, 0x8B, 0xB9, 0xCE, 0xB8, 0x57, 0xD4,
-    0x47, 0x39, 0x9F, 0x1F, 0x93, 0xF2, 0x38, 0x8B, 0xC3, 0xA9, 0xDC, 0xF2, 0x41, 0xE3, 0x97, 0x03,
-    0xD5, 0x89, 0x2D, 0x07, 0xAA, 0x7B, 0x5A, 0x07, 0x1D, 0xAF, 0xCE, 0x9F, 0x7D, 0x76, 0x97, 0xC7,
-    0x38, 0xD1, 0x54, 0xAF, 0xB0, 0x59, 0xEA, 0x1E, 0xD2, 0x8A, 0x78, 0x1F, 0x47, 0xB8, 0x33, 0x3D,
-    0x6D, 0x43, 0xCC, 0xE9, 0x8B, 0xA5, 0x93, 0xDD, 0xEB, 0xCA, 0xC4, 0xB8, 0x22, 0x86, 0x24, 0xEF,
-    0xAF, 0x18, 0x2E, 0xF8, 0x31, 0xB6, 0xD9, 0xF3, 0xC7, 0x0E, 0x69, 0x51, 0xB2, 0xB1, 0xDF, 0xD6,
-    0x14, 0x05, 0x31, 0xCD, 0x22, 0xDB, 0x5B, 0x99, 0xDE, 0xF3, 0x82, 0x9A, 0x3D, 0xC7, 0x64, 0xCF,
-    0x15, 0x74, 0x21, 0xC6, 0xB4, 0xA3, 0x0C, 0x60, 0x58, 0x22, 0xDD, 0x72, 0xE0, 0x76, 0xE4, 0x90,
-    0x7A, 0x00, 0x32, 0x07, 0x36, 0xAE, 0xAE, 0xE2, 0x26, 0x4B, 0xBE, 0x16, 0x3E, 0xED, 0x05, 0xF3,
-    0xB1, 0xB2, 0x26, 0x70, 0xD1, 0x7E, 0x01, 0x89, 0x96, 0x57, 0xFA, 0x92, 0x2D, 0x2B, 0xB5, 0x22,
-    0x22, 0x1B, 0xF7, 0xAB, 0xB7, 0xC5, 0x7E, 0xD9, 0xAA, 0x6D, 0x29, 0xA4, 0x0E, 0xFD, 0x94, 0x4C,
-    0x8E, 0x2E, 0xAB, 0x14, 0x72, 0x96, 0xCB, 0x69, 0x28, 0xE2, 0xF5, 0xAE, 0x2C, 0x06, 0xFD, 0x20,
-    0x81, 0xDC, 0xBB, 0x26, 0x32, 0xF0, 0x5E, 0xE5, 0xA3, 0xEE, 0x42, 0x05, 0x31, 0x66, 0x6B, 0xFB,
-    0xBE, 0xBE, 0x8E, 0xA8, 0x69, 0x4C, 0x69, 0x2C, 0x71, 0x69, 0xD4, 0x4B, 0xA1, 0x29, 0xF3, 0xE3,
-    0xDE, 0x3F, 0x30, 0x76, 0x74, 0xDA, 0xFD, 0x82, 0x6D, 0xEF, 0x34, 0x7D, 0x89, 0x95, 0x07, 0xD7,
-    0xE9, 0x61, 0x2C, 0xDF, 0x9C, 0x69, 0xB1, 0x0A, 0x64, 0x92, 0x94, 0x83, 0x5B, 0x73, 0x03, 0xA7,
-    0x8F, 0x22, 0xD3, 0x9A, 0xE8, 0x5A, 0x2E, 0xD5, 0xD4, 0xE4, 0x74, 0xF5, 0x6C, 0xA1, 0xEE, 0xD0,
-    0x42, 0xDC, 0xCA, 0x02, 0x78, 0xEA, 0x30, 0x0E, 0x93, 0x80, 0x82, 0x24, 0xD2, 0xA3, 0x30, 0xD4,
-    0x2F, 0x69, 0xEC, 0x16, 0xFD, 0x8B, 0xEC, 0x34, 0x46, 0xFB, 0x7D, 0x3E, 0x0D, 0xBC, 0x69, 0xBE,
-    0x48, 0xCE, 0x7F, 0xF5, 0x2A, 0x80, 0x7D, 0x91, 0x34, 0x30, 0xDC, 0x57, 0xF1, 0x1C, 0x9F, 0xF9,
-    0x50, 0x24, 0x39, 0x1B, 0x4F, 0x33, 0xB7, 0x59, 0x50, 0x19, 0x38, 0xC8, 0xE6, 0x8C, 0xE0, 0x74,
-    0xF5, 0xCD, 0xAD, 0x5A, 0x4F, 0x99, 0x04, 0x70, 0x6F, 0xB2, 0x24, 0x67, 0x58, 0x92, 0x8B, 0xCC,
-    0x48, 0x70, 0x75, 0x89, 0x05, 0x18, 0xB1, 0xFE, 0x06, 0xAC, 0xBF, 0xFE, 0x5F, 0xAA, 0x6F, 0xAA,
-    0x6D, 0xD6, 0xE3, 0x1F, 0x47, 0xE4, 0x95, 0x9A, 0x29, 0xB9, 0x8E, 0x60, 0x94, 0xCB, 0x28, 0xF4,
-    0x3E, 0x76, 0x44, 0x3A, 0x5E, 0xAE, 0xF1, 0x64, 0xBD, 0x95, 0x45, 0x79, 0x98, 0xA8, 0x24, 0x48,
-    0x14, 0x56, 0x15, 0x60, 0x4D, 0xA3, 0xE0, 0x39, 0x9E, 0x17, 0x60, 0xFA, 0x2A, 0xF6, 0x76, 0x03,
-    0x28, 0xE6, 0x32, 0x71, 0x69, 0x32, 0x86, 0x9F, 0x6C, 0x1E, 0x37, 0x4E, 0xDA, 0xAF, 0x20, 0x1C,
-    0xC1, 0x6C, 0x9C, 0xD0, 0xD0, 0xB3, 0x9C, 0xA5, 0x44, 0x9C, 0x56, 0x86, 0xFE, 0xA0, 0xBE, 0x1C,
-    0xF0, 0xD2, 0xB8, 0x94, 0xC6, 0xC7, 0x2A, 0x0A, 0x73, 0x3E, 0x5B, 0x1D, 0xC8, 0x9A, 0x34, 0x5A,
-    0x38, 0xA7, 0x27, 0xC0, 0xFD, 0x09, 0x84, 0x5D, 0x27, 0xE4, 0xF0, 0xB2, 0x6D, 0x2B, 0x88, 0x1C,
-    0xD2, 0xF0, 0x52, 0x38, 0x15, 0x9B, 0xB7, 0xBB, 0xD5, 0xB1, 0x8F, 0x8E, 0xC3, 0xF0, 0xAE, 0x00,
-    0x7F, 0x56, 0x5B, 0x78, 0x2D, 0xAB, 0x19, 0x7B, 0x00, 0x8B, 0xCF, 0xA1, 0x6C, 0x77, 0xF9, 0x7E,
-    0xD9, 0xC9, 0x85, 0x7A, 0xD3, 0xE4, 0x8B, 0x5E, 0xB6, 0xC2, 0xC5, 0x19, 0x39, 0xE2, 0x5D, 0xE3,
-    0x15, 0x41, 0x07, 0xE5, 0xC6, 0xF4, 0x3C, 0x4D, 0xDF, 0x5C, 0x28, 0xB8, 0x38, 0xAC, 0x06, 0x6A,
-    0xF2, 0xB4, 0xCF, 0xB8, 0x2E, 0xC9, 0xE3, 0xEA, 0xAB, 0x28, 0x43, 0x80, 0xAA, 0x72, 0x9E, 0x47,
-    0xC2, 0xAE, 0x7D, 0x64, 0x98, 0x8F, 0xE4, 0xE6, 0xC3, 0x81, 0xE4, 0x66, 0x28, 0x6C, 0xAD, 0xDC,
-    0xCD, 0xDA, 0x1E, 0x47, 0xB4, 0xC3, 0x94, 0xAF, 0x0D, 0xFD, 0x1F, 0xCD, 0x5A, 0x3F, 0x6C, 0xDC,
-    0xE6, 0x15, 0x7F, 0xE4, 0x17, 0x8B, 0x8D, 0x19, 0x8B, 0x19, 0x6C, 0x20, 0x48, 0x6C, 0xD3, 0x43,
-    0x06, 0xB7, 0x90, 0x45, 0x0F, 0x1A, 0x2E, 0x80, 0x4E, 0x47, 0x3B, 0x83, 0x87, 0x0E, 0xF5, 0xE0,
-    0x4B, 0x86, 0x16, 0x71, 0x86, 0x0E, 0x4D, 0x51, 0xC4, 0x2E, 0xE0, 0x41, 0x40, 0x4F, 0x3E, 0x3A,
-    0x19, 0xBA, 0x6A, 0x48, 0x33, 0x7B, 0xF0, 0xE0, 0xBA, 0x40, 0xED, 0x41, 0x83, 0x86, 0x53, 0x8E,
-    0x49, 0x87, 0x0C, 0x1E, 0xCC, 0x16, 0x08, 0xDC, 0xAD, 0x6C, 0x12, 0x14, 0x45, 0x3D, 0x98, 0x68,
-    0x4E, 0xC0, 0x29, 0x3E, 0x1D, 0xFB, 0xFB, 0xBD, 0x8F, 0x77, 0x92, 0x9C, 0xD8, 0x91, 0x2D, 0x4B,
-    0xEE, 0xE9, 0xBE, 0xF7, 0xEE, 0x28, 0xF2, 0xE3, 0xFB, 0xBE, 0xF7, 0xEF, 0xF7, 0x1E, 0x4F, 0xC4,
-    0xBE, 0xDC, 0x42, 0x2E, 0x0C, 0xDD, 0xC2, 0x5D, 0x7B, 0x2D, 0x2B, 0xFC, 0xD4, 0x29, 0xB2, 0x50,
-    0xA4, 0x1B, 0x37, 0x44, 0x16, 0x64, 0x4E, 0xF0, 0x5E, 0x10, 0x69, 0x48, 0x47, 0x24, 0x7A, 0x98,
-    0xE8, 0x3F, 0xEA, 0x3C, 0x05, 0x27, 0xD7, 0x05, 0x97, 0x75, 0x24, 0x48, 0x9D, 0x9E, 0x98, 0x9E,
-    0x9F, 0x89, 0xB4, 0x87, 0x32, 0x7E, 0x5D, 0x15, 0xC1, 0xF1, 0x5F, 0xC7, 0x3D, 0xFF, 0x41, 0x71,
-    0x31, 0x94, 0x95, 0xAC, 0x8E, 0x6B, 0x5A, 0x32, 0x8D, 0x2B, 0xC2, 0x2D, 0xA3, 0x85, 0x79, 0x67,
-    0x71, 0x7C, 0x0E, 0x34, 0xB8, 0xD2, 0x17, 0xB7, 0xCC, 0x64, 0xCB, 0xAB, 0xD3, 0x1D, 0xBA, 0x83,
-    0x4E, 0xD8, 0x93, 0xD6, 0xAC, 0x97, 0xC9, 0xE1, 0x1A, 0xC8, 0xD1, 0x1C, 0xE4, 0x88, 0xF0, 0xEB,
-    0x0F, 0x10, 0xB3, 0x41, 0x72, 0x99, 0xE2, 0xCA, 0xE7, 0x45, 0x86, 0x6F, 0x15, 0x58, 0x4D, 0x99,
-    0x8C, 0x6F, 0xE1, 0xC6, 0x20, 0x7E, 0x7A, 0x28, 0x3E, 0x74, 0x26, 0x6D, 0xA7, 0xD1, 0x67, 0xA9,
-    0x97, 0x7A, 0x77, 0x63, 0x2F, 0x35, 0x7D, 0x01, 0x49, 0x1F, 0x4D, 0x0C, 0xCE, 0xC4, 0xF4, 0x41,
-    0x2A, 0xEE, 0xDA, 0xEF, 0x72, 0xEC, 0xE2, 0x57, 0xEB, 0xF2, 0xDD, 0x97, 0xEF, 0xA4, 0xCA, 0xCD,
-    0xED, 0xD8, 0x1E, 0x28, 0x47, 0x4B, 0x1B, 0x9F, 0xD2, 0x28, 0xD7, 0xC4, 0x29, 0xCB, 0x75, 0x6F,
-    0xF5, 0x42, 0xE6, 0xAC, 0x36, 0xD7, 0xDD, 0xC2, 0xE9, 0x3B, 0x99, 0xF4, 0x21, 0xF0, 0x82, 0x93,
-    0x9A, 0x02, 0xBC, 0x21, 0xB1, 0x97, 0x83, 0x87, 0x31, 0xF6, 0x9C, 0x3C, 0x91, 0x28, 0x06, 0x0F,
-    0x12, 0xEC, 0x9D, 0xE5, 0x03, 0xCB, 0xB1, 0xF1, 0xCA, 0x4D, 0x61, 0x39, 0x74, 0xA3, 0xD7, 0xE1,
-    0x0C, 0x9D, 0xA7, 0x21, 0x0E, 0xE7, 0xC5, 0x9F, 0xC7, 0xFB, 0xE0, 0x32, 0xDF, 0x5B, 0xFD, 0x79,
-    0xEE, 0xAE, 0x35, 0x2F, 0x34, 0xCA, 0xA1, 0x98, 0xB2, 0x2C, 0xB7, 0xC8, 0x3F, 0xE5, 0xC5, 0x94,
-    0x4F, 0x82, 0xF7, 0x85, 0xF2, 0x89, 0xE1, 0x7D, 0x70, 0x9D, 0xA3, 0xF3, 0x2F, 0x54, 0x26, 0xD5,
-    0x90, 0x66, 0x33, 0xD6, 0xFB, 0x94, 0x65, 0x46, 0x7E, 0x25, 0x53, 0x39, 0x83, 0x2B, 0x69, 0x54,
-    0xC9, 0x57, 0x7F, 0x48, 0xCE, 0x4A, 0x3E, 0x33, 0x92, 0x2F, 0xB5, 0xF3, 0x84, 0x62, 0xE7, 0x9D,
-    0x93, 0xAB, 0x95, 0x7C, 0x39, 0xE5, 0x73, 0xD6, 0xDE, 0xCA, 0x2A, 0xF9, 0xC6, 0x26, 0x62, 0x86,
-    0x72, 0xC4, 0xC3, 0xAE, 0x5E, 0x16, 0xFF, 0x1D, 0x7C, 0x9D, 0xA6, 0x6C, 0x64, 0xD8, 0x02, 0x32,
-    0xBC, 0x9C, 0xEB, 0xD3, 0x14, 0xCC, 0x2F, 0xDF, 0x97, 0xB2, 0xCC, 0xA3, 0x53, 0x43, 0xC9, 0xFD,
-    0xB4, 0x8E, 0x0B, 0xD2, 0x30, 0x6E, 0x59, 0x7B, 0xEF, 0x90, 0x75, 0xF0, 0xA7, 0xD7, 0x91, 0xC1,
-    0x58, 0xC8, 0xFC, 0x54, 0x78, 0x0A, 0x76, 0x9C, 0x6C, 0x4E, 0xDE, 0x9D, 0x93, 0x4F, 0xF0, 0x8F,
-    0x3C, 0xFC, 0xF8, 0xFE, 0xA9, 0xB5, 0xB7, 0x72, 0xAF, 0x0C, 0xFF, 0x8B, 0x39, 0xC7, 0x2A, 0xA4,
-    0x07, 0x78, 0x7D, 0x91, 0xD7, 0x7A, 0x10, 0x1F, 0x66, 0xF1, 0xD4, 0xF4, 0x65, 0xA5, 0x35, 0xA5,
-    0x33, 0x4A, 0x2F, 0x99, 0xCC, 0x5B, 0x6D, 0xF6, 0x0C, 0x36, 0xA0, 0x04, 0xD5, 0xA5, 0x6F, 0xA2,
-    0x9E, 0x1A, 0x58, 0xA0, 0x16, 0x7D, 0x41, 0xF5, 0xD1, 0xB7, 0x96, 0x17, 0x53, 0xAA, 0x20, 0xA5,
-    0x54, 0x01, 0x95, 0x63, 0x55, 0x55, 0x51, 0x55, 0x97, 0x74, 0x13, 0xD2, 0x40, 0xA9, 0xFF, 0x38,
-    0xFA, 0xB2, 0xD2, 0x9A, 0xD2, 0x19, 0xA5, 0x97, 0xFC, 0x84, 0x52, 0xF9, 0x09, 0xA5, 0xF2, 0xF5,
-    0xEE, 0x96, 0x5A, 0x49, 0x02, 0x35, 0xF7, 0x50, 0x25, 0xB1, 0x56, 0xF2, 0xB5, 0x74, 0x53, 0x3F,
-    0xF1, 0x53, 0x48, 0x04, 0x4E, 0xA9, 0xED, 0x68, 0xC2, 0xD9, 0xDA, 0x3C, 0xB6, 0xAD, 0xE1, 0x43,
-    0x83, 0xDD, 0x75, 0x28, 0x47, 0x74, 0x24, 0xF6, 0x7E, 0x81, 0xD0, 0x0C, 0xC4, 0xED, 0x49, 0x23,
-    0x97, 0xB2, 0x07, 0x5F, 0xEA, 0x49, 0xB8, 0x18, 0xE6, 0x2E, 0xCC, 0x1B, 0x27, 0xBA, 0x43, 0xCB,
-    0xEE, 0xC7, 0xCA, 0xEE, 0xA4, 0xCA, 0x3E, 0xCF, 0x95, 0x7D, 0xD6, 0x53, 0x96, 0x0E, 0x2C, 0xBB,
-    0x6C, 0x59, 0x64, 0x59, 0x70, 0x5B, 0x99, 0x77, 0x4F, 0x99, 0xFB, 0x40, 0x19, 0x7C, 0x58, 0x59,
-    0x1B, 0x0C, 0x91, 0xA6, 0x01, 0xD6, 0x18, 0x40, 0x06, 0xDF, 0xBA, 0xFA, 0x56, 0x66, 0xB7, 0xA3,
-    0xDA, 0x09, 0x0A, 0x49, 0xC5, 0x7D, 0x2D, 0xD5, 0x41, 0x15, 0x37, 0x8A, 0xAD, 0xB8, 0xA2, 0xE2,
-    0x62, 0x19, 0x43, 0xCB, 0x28, 0x6E, 0x53, 0x54, 0xDC, 0xAE, 0xA8, 0xB8, 0x38, 0x85, 0xE2, 0x06,
-    0xA2, 0xE2, 0x92, 0x5D, 0xB6, 0x2C, 0xB2, 0x0C, 0xE2, 0x92, 0x41, 0x5C, 0x32, 0x88, 0x4B, 0x06,
-    0x71, 0x95, 0xB5, 0xC1, 0x54, 0xDC, 0x40, 0x54, 0xDC, 0xC0, 0x0A, 0x11, 0xC8, 0x66, 0x01, 0x2B,
-    0x36, 0xB7, 0x39, 0x48, 0x19, 0x6B, 0xE6, 0x46, 0x17, 0xE4, 0x6F, 0x32, 0xBA, 0xD1, 0xEB, 0xD0,
-    0xA9, 0xEB, 0x72, 0x28, 0x8E, 0xEE, 0x94, 0x71, 0x84, 0xB8, 0x49, 0x05, 0x9B, 0xC2, 0x64, 0x26,
-    0xC5, 0x78, 0x22, 0xEA, 0xE7, 0xB8, 0x2E, 0x6D, 0xAF, 0x9B, 0x75, 0x7B, 0xAF, 0xCD, 0xD4, 0xDE,
-    0xD1, 0x9A, 0x58, 0xA4, 0x77, 0xED, 0x57, 0x77, 0x3F, 0x62, 0x60, 0x6B, 0x1A, 0x02, 0x34, 0x00,
-    0xA8, 0xFB, 0xDB, 0x17, 0xAD, 0xDD, 0xE5, 0x57, 0xC3, 0x73, 0xBD, 0x16, 0x27, 0x40, 0x0A, 0x93,
-    0x03, 0x9C, 0xE0, 0x30, 0x97, 0x5A, 0xA3, 0x7A, 0x66, 0xA8, 0xAA, 0x5B, 0xD8, 0x1A, 0x29, 0xB0,
-    0x54, 0x84, 0xE2, 0x82, 0xDB, 0x85, 0xCC, 0xC6, 0x68, 0xE5, 0x09, 0x02, 0x40, 0xA0, 0x29, 0x2F,
-    0xC6, 0x16, 0x96, 0x85, 0xA7, 0x5E, 0xEF, 0x3B, 0x99, 0xB9, 0x9B, 0x30, 0x9A, 0xAB, 0x75, 0x3B,
-    0x7F, 0x94, 0xE0, 0x5E, 0x16, 0x39, 0xC5, 0x09, 0x5C, 0xA7, 0x6F, 0xE7, 0x66, 0x2F, 0xFA, 0xA8,
-    0xD7, 0x92, 0x5E, 0x47, 0x7A, 0xCB, 0xA0, 0x6E, 0x6F, 0xEE, 0x9D, 0xE5, 0xB0, 0xDF, 0xB6, 0x92,
-    0xD5, 0xA0, 0xAF, 0x13, 0x02, 0xD7, 0xB4, 0x1E, 0x09, 0x4F, 0xB5, 0x9F, 0xB7, 0xF9, 0x86, 0xBD,
-    0xD0, 0xB9, 0xE5, 0xD2, 0x91, 0x13, 0xF3, 0x41, 0x41, 0xC9, 0xB1, 0xFD, 0x99, 0xF9, 0x9E, 0x3F,
-    0x3F, 0x1F, 0x65, 0xE6, 0x99, 0x49, 0x90, 0xA3, 0xB3, 0x94, 0xBD, 0xB7, 0xA1, 0x54, 0x06, 0x0D,
-    0x9C, 0x40, 0x3C, 0x20, 0xC4, 0x03, 0x36, 0xB1, 0x3F, 0x5B, 0x3C, 0x20, 0x26, 0xC6, 0xB6, 0x7E,
-    0x95, 0xDA, 0xE4, 0x57, 0x99, 0x16, 0xF0, 0x81, 0x00, 0x1F, 0x28, 0x12, 0xA8, 0xE3, 0xEF, 0xC9,
-    0xF1, 0xC1, 0x24, 0x94, 0x24, 0xE6, 0x0E, 0x75, 0xBC, 0xBE, 0xD9, 0x1E, 0x80, 0x19, 0xCA, 0x0C,
-    0x98, 0xA1, 0x1D, 0x6F, 0x03, 0x24, 0x3C, 0x15, 0x66, 0x80, 0xB5, 0x4C, 0x89, 0xCC, 0x2E, 0xC1,
-    0x5D, 0xF2, 0xB1, 0xA3, 0x03, 0x41, 0xC4, 0x00, 0x10, 0xC4, 0x0F, 0x74, 0x80, 0x47, 0x0E, 0xA5,
-    0x4C, 0x8F, 0x44, 0x0D, 0x23, 0xD0, 0x10, 0x94, 0x98, 0x64, 0x5F, 0xB3, 0xC2, 0x08, 0x12, 0xD0,
-    0xDA, 0x83, 0x33, 0x3C, 0xE6, 0xC6, 0x7B, 0xB3, 0xAA, 0x12, 0x82, 0xDC, 0xB8, 0x6E, 0x3F, 0xF7,
-    0x60, 0x25, 0x7D, 0xE8, 0xF6, 0xDD, 0xE3, 0x3B, 0x5F, 0x99, 0xDD, 0x1E, 0x0D, 0x32, 0x27, 0x48,
-    0x4E, 0xF2, 0x9B, 0x19, 0x2D, 0x6F, 0xBF, 0x49, 0xF6, 0x48, 0x69, 0x2D, 0x6B, 0x21, 0x4E, 0x4E,
-    0x73, 0x84, 0x02, 0x8F, 0xDB, 0x25, 0x2E, 0xCD, 0xEE, 0x7C, 0x89, 0x07, 0x68, 0x88, 0xDE, 0x1D,
-    0xCC, 0xEA, 0xE8, 0x81, 0x6B, 0xCF, 0x67, 0x89, 0x8B, 0x2F, 0x62, 0x95, 0xCB, 0xD6, 0x26, 0xF7,
-    0x27, 0xD6, 0x46, 0x9F, 0xD5, 0x12, 0x35, 0x8B, 0x69, 0x08, 0x76, 0xF2, 0xE7, 0xA8, 0x45, 0xAC,
-    0x8E, 0x31, 0x47, 0xCD, 0x49, 0xB5, 0xF8, 0xEC, 0x96, 0xE8, 0x5C, 0x97, 0xB0, 0x4C, 0x6A, 0x5E,
-    0xFE, 0x32, 0xC3, 0x77, 0x5F, 0x73, 0x5F, 0xAB, 0x5B, 0x0E, 0x56, 0x9A, 0x1D, 0xC0, 0xC3, 0x16,
-    0x6F, 0x53, 0x44, 0x67, 0x80, 0xFB, 0xD4, 0x1F, 0x55, 0xA4, 0x43, 0x63, 0x7F, 0x9D, 0x26, 0xDC,
-    0x89, 0xB8, 0x49, 0x3F, 0x9A, 0xD8, 0xF5, 0xEC, 0xE3, 0x97, 0xD9, 0xC4, 0x0D, 0xEE, 0x88, 0xFF,
-    0x66, 0x16, 0x7C, 0x98, 0x4D, 0x38, 0xC9, 0x13, 0x27, 0xA0, 0x57, 0x6F, 0x50, 0xDE, 0x32, 0xDE,
-    0x54, 0xB1, 0x11, 0xD1, 0x57, 0x42, 0xEF, 0xBA, 0xF8, 0xFB, 0x55, 0x7C, 0xA9, 0xA9, 0x57, 0xD6,
-    0x9E, 0x22, 0x7F, 0x5A, 0xD1, 0x75, 0x15, 0xA3, 0xF0, 0xA5, 0x60, 0x7C, 0x7A, 0xF5, 0x6D, 0x88,
-    0xFD, 0x46, 0x41, 0xE1, 0x7F, 0x5B, 0xC8, 0x2D, 0x91, 0x7F, 0x02, 0xBB, 0x8A, 0xF3, 0x29, 0x17,
-    0x63, 0xAE, 0x90, 0x7A, 0xBA, 0xCE, 0x49, 0x87, 0x75, 0xCE, 0x61, 0x94, 0x5B, 0x10, 0x40, 0x73,
-    0x70, 0xB7, 0x24, 0xCD, 0xF9, 0x5F, 0x97, 0x79, 0xF0, 0x05, 0x13, 0x83, 0x1E, 0xF7, 0x69, 0x88,
-    0xB5, 0x28, 0x36, 0xAB, 0xCD, 0x7E, 0x59, 0x00, 0xEB, 0xF6, 0x6D, 0xAC, 0xAE, 0x96, 0x40, 0xC9,
-    0x55, 0xF6, 0x7F, 0xDC, 0x4F, 0x23, 0x07, 0x85, 0xF5, 0x09, 0xAC, 0x5A, 0xED, 0xA7, 0xAF, 0xC4,
-    0xB9, 0x59, 0x96, 0x83, 0xE8, 0xA3, 0xB5, 0xE6, 0xB9, 0x96, 0xB5, 0xA9, 0x3E, 0x8D, 0x18, 0x30,
-    0xA5, 0x03, 0x90, 0x77, 0x6C, 0xEE, 0x7C, 0xF8, 0x71, 0x11, 0x0E, 0xBC, 0x2D, 0xA9, 0x05, 0x56,
-    0x28, 0xCE, 0xDA, 0xDB, 0x3D, 0x7A, 0x45, 0x9F, 0x38, 0xBA, 0x47, 0xBC, 0x13, 0xDB, 0xBC, 0xB9,
-    0x30, 0x26, 0x1D, 0x4B, 0xF6, 0x35, 0xF1, 0x35, 0x28, 0xE3, 0x05, 0x71, 0x06, 0x3C, 0xA5, 0xCF,
-    0x1A, 0xAF, 0x8C, 0xB1, 0xDD, 0x7D, 0x42, 0x35, 0xE4, 0xCC, 0x35, 0x54, 0x51, 0x72, 0x61, 0x5C,
-    0xAA, 0x68, 0xEA, 0xFD, 0x59, 0x6A, 0xEE, 0x3D, 0x48, 0x83, 0xA4, 0x07, 0xE5, 0x2C, 0x6B, 0xA2,
-    0xE5, 0x08, 0xE2, 0x65, 0xF1, 0xB1, 0x55, 0x4C, 0xB3, 0xF4, 0x68, 0x82, 0x50, 0xFF, 0x0F, 0x67,
-    0x51, 0x74, 0xAD, 0x8B, 0x87, 0xFD, 0xAA, 0xE3, 0x8C, 0xF9, 0x7D, 0xE7, 0x17, 0xE7, 0xF7, 0xDF,
-    0xBC, 0x8A, 0x84, 0x2C, 0xD1, 0xA9, 0x0E, 0x8E, 0x2F, 0x6E, 0x54, 0x8A, 0x70, 0xCC, 0xEF, 0x81,
-    0x61, 0x3B, 0x5F, 0x10, 0xC8, 0x63, 0x17, 0x64, 0x12, 0x68, 0xFA, 0x1B, 0x68, 0xA5, 0x1D, 0x6F,
-    0xC2, 0x17, 0x3B, 0x58, 0x24, 0x8A, 0xA7, 0x79, 0xF0, 0xEF, 0x2E, 0x72, 0x03, 0x73, 0x38, 0xC3,
-    0xCD, 0x55, 0x7C, 0xA3, 0x74, 0xCB, 0x04, 0x10, 0x6E, 0x48, 0x73, 0x61, 0x09, 0xEE, 0xB0, 0xAE,
-    0xC5, 0x8E, 0xB8, 0xC5, 0x24, 0x0B, 0xAE, 0x1A, 0x09, 0x4D, 0xEB, 0x1B, 0x6C, 0x8B, 0xFB, 0x00,
-    0x1B, 0xE4, 0x0E, 0xDA, 0x3C, 0x16, 0xB1, 0x2E, 0x0F, 0xF4, 0x64, 0x22, 0x3B, 0x57, 0x51, 0xE0,
-    0xBA, 0x02, 0x3C, 0x54, 0x56, 0xE2, 0x5B, 0x7F, 0xCC, 0x71, 0xFD, 0x3C, 0x23, 0x61, 0x36, 0x2E,
-    0x28, 0xBA, 0x55, 0x09, 0xE4, 0x6D, 0x19, 0xCD, 0xB3, 0x5E, 0xDA, 0xCD, 0xBD, 0x74, 0x1A, 0x9F,
-    0x6B, 0x18, 0xB9, 0x78, 0x7F, 0x49, 0x91, 0x9B, 0x30, 0xEE, 0xE3, 0xF3, 0x97, 0x80, 0x8E, 0x29,
-    0xDC, 0x32, 0xBD, 0x8C, 0x11, 0x89, 0x9F, 0x07, 0x59, 0x77, 0x50, 0xD5, 0x8B, 0xBB, 0x88, 0x03,
-    0xB5, 0x50, 0x55, 0x08, 0x70, 0x74, 0x4C, 0x02, 0x62, 0x0D, 0xD6, 0xA6, 0x4F, 0x0D, 0x04, 0x19,
-    0x38, 0x60, 0x04, 0x6E, 0x66, 0x87, 0xF3, 0x6D, 0xCC, 0x56, 0x56, 0x75, 0xCB, 0x9F, 0xDC, 0xD8,
-    0x7D, 0x78, 0xFB, 0xD8, 0x65, 0xB1, 0x4C, 0x98, 0xB8, 0xB1, 0xB8, 0x33, 0xAC, 0x5B, 0xB3, 0x71,
-    0x58, 0x97, 0x98, 0x57, 0x4B, 0x6C, 0xC7, 0x5B, 0x6D, 0xBE, 0xBB, 0x61, 0xF3, 0x51, 0x39, 0xC4,
-    0x58, 0xC7, 0x0C, 0xF3, 0xF2, 0x3A, 0xF7, 0x86, 0x06, 0x4E, 0xD8, 0x3F, 0x6B, 0xE7, 0x71, 0xE8,
-    0x34, 0x13, 0xF4, 0xCE, 0x06, 0xFD, 0x92, 0xFE, 0x9A, 0x1C, 0x93, 0x30, 0x59, 0xC2, 0xE7, 0x01,
-    0x8E, 0xB5, 0x4F, 0x0D, 0xE0, 0xAD, 0x38, 0xE7, 0xE0, 0xC8, 0xD8, 0xCD, 0xED, 0x98, 0x86, 0xAE,
-    0x66, 0x7E, 0xA8, 0x79, 0xAE, 0x51, 0xF6, 0xE7, 0x6E, 0x14, 0x27, 0xDD, 0xEC, 0x18, 0x4C, 0x7B,
-    0x52, 0xE7, 0x85, 0xD5, 0xAE, 0x89, 0xD3, 0xCD, 0x34, 0x57, 0x74, 0x34, 0xA2, 0xD7, 0xF5, 0xDD,
-    0xBA, 0x25, 0x9D, 0x9E, 0xF4, 0x56, 0x5E, 0xCB, 0xC2, 0xE1, 0xA8, 0xE4, 0x99, 0xDD, 0x28, 0x79,
-    0xF6, 0x9D, 0x95, 0xB0, 0x60, 0xD2, 0xD9, 0xE6, 0x1B, 0x57, 0x19, 0xEA, 0x90, 0x25, 0xF4, 0xFF,
-    0x5B, 0xC7, 0x4C, 0x3B, 0x64, 0xD4, 0x3B, 0x3B, 0x64, 0xDA, 0x60, 0x71, 0xFA, 0x55, 0xA3, 0xE5,
-    0xF9, 0x74, 0xC8, 0xCC, 0x70, 0x73, 0xBB, 0xC1, 0x36, 0xC3, 0xB6, 0xB2, 0x3D, 0x6B, 0x8D, 0x55,
-    0x2F, 0x2D, 0xD9, 0x67, 0x47, 0xB8, 0xC2, 0x49, 0xF6, 0x2E, 0x39, 0x08, 0x14, 0xAB, 0xD1, 0x91,
-    0x9E, 0xFA, 0xCA, 0xEE, 0x24, 0x87, 0x46, 0xE9, 0x94, 0x7D, 0xF5, 0x7B, 0x1A, 0x80, 0x55, 0xE3,
-    0xB6, 0x18, 0x8C, 0xE7, 0xC3, 0xB2, 0x70, 0x57, 0x9B, 0xE7, 0x93, 0x76, 0xA2, 0x07, 0x2B, 0x6B,
-    0x78, 0x0C, 0x4B, 0xE7, 0x98, 0x1E, 0xBC, 0xAC, 0xC3, 0x1E, 0x80, 0x53, 0x16, 0x5B, 0xF6, 0xB9,
-    0xFD, 0x29, 0x44, 0x0F, 0x6F, 0xDF, 0xEB, 0x33, 0x0B, 0xAF, 0x70, 0xED, 0x0D, 0xAA, 0x2D, 0xA2,
-    0xF3, 0x84, 0xF1, 0x88, 0xE8, 0x57, 0x25, 0x73, 0x24, 0x0B, 0x24, 0x03, 0x10, 0x87, 0x4E, 0x86,
-    0xCF, 0x26, 0xC3, 0x96, 0x9A, 0x6C, 0x05, 0x9B, 0x77, 0x37, 0x17, 0x6B, 0x4E, 0x1A, 0xED, 0x1E,
-    0x22, 0x9A, 0x9E, 0xBA, 0x1B, 0xA5, 0xBE, 0xD6, 0x7A, 0xAE, 0x6E, 0xFE, 0x92, 0x6C, 0xDA, 0x6E,
-    0x6D, 0x73, 0x69, 0x93, 0x4B, 0x5B, 0x5C, 0xDA, 0xE0, 0xD2, 0xF6, 0x96, 0x36, 0xB7, 0xB4, 0xB5,
-    0xA5, 0x8D, 0x2D, 0x6D, 0x6B, 0x69, 0x53, 0x4B, 0x5B, 0x5A, 0xDA, 0xD0, 0xD2, 0x76, 0x96, 0x36,
-    0xB3, 0xB4, 0x95, 0xA5, 0x8D, 0x2C, 0x6D, 0x63, 0x69, 0x13, 0xCB, 0x4E, 0x5F, 0x35, 0x1C, 0xB5,
-    0x53, 0x74, 0x75, 0xDC, 0x92, 0x62, 0x43, 0x8A, 0xED, 0x28, 0x6D, 0x46, 0xFD, 0xC0, 0x1F, 0x5B,
-    0x4F, 0x6C, 0x3C, 0xD9, 0xB0, 0xA8, 0x45, 0x86, 0xC5, 0xC2, 0xFC, 0xE6, 0x31, 0x64, 0x4E, 0x32,
-    0x90, 0xBE, 0xE4, 0x8F, 0x3E, 0xE9, 0x31, 0x8B, 0x8F, 0x3B, 0x63, 0x68, 0x3C, 0xFD, 0x3D, 0xD0,
-    0x98, 0x1B, 0xF5, 0xED, 0x9F, 0x60, 0x53, 0xFF, 0xB9, 0x51, 0xD0, 0xA8, 0xFA, 0x82, 0xD8, 0xD9,
-    0xF9, 0x4E, 0x4B, 0x09, 0x4B, 0xC2, 0x12, 0xA6, 0x54, 0xF8, 0x4F, 0xC4, 0xBD, 0x9B, 0x98, 0x53,
-    0xA9, 0xF9, 0x20, 0x75, 0x80, 0x74, 0x0F, 0x3E, 0x71, 0x7B, 0x49, 0x36, 0xF5, 0xED, 0x6C, 0xCB,
-    0x6C, 0x52, 0x8F, 0x1C, 0x97, 0xE7, 0x01, 0x98, 0xAB, 0x9E, 0x46, 0x3A, 0x6A, 0x2F, 0x6A, 0x18,
-    0x78, 0x57, 0x76, 0x09, 0x3F, 0x5B, 0xDD, 0xF5, 0x47, 0xA5, 0xAA, 0xB1, 0xE9, 0xF2, 0x24, 0x81,
-    0xC0, 0xD5, 0x11, 0x10, 0x30, 0xCC, 0xC5, 0x1E, 0x53, 0xDE, 0x24, 0x03, 0xE9, 0x61, 0x02, 0x81,
-    0x19, 0x02, 0x81, 0x5B, 0x4C, 0xFF, 0x19, 0x08, 0xEC, 0x4F, 0x3A, 0x1E, 0x81, 0xC0, 0x24, 0x81,
-    0xC0, 0x61, 0x06, 0xBA, 0x1A, 0x35, 0x76, 0x8B, 0xBA, 0xCB, 0x46, 0x40, 0xC0, 0xD0, 0xF8, 0xFD,
-    0xF1, 0xAD, 0x59, 0x06, 0xD1, 0x10, 0xD9, 0xE9, 0x98, 0xD1, 0x2C, 0x87, 0x50, 0xF3, 0x0B, 0xE4,
-    0x7E, 0xC4, 0x28, 0x48, 0x5D, 0x07, 0xB2, 0x6B, 0xB9, 0x7F, 0xC6, 0xC4, 0xC8, 0xF9, 0x93, 0x18,
-    0x53, 0x18, 0x33, 0x08, 0x3C, 0x79, 0x24, 0x73, 0xC0, 0x6C, 0x8D, 0xD8, 0xE6, 0xFE, 0xA3, 0xF0,
-    0xE1, 0xDA, 0xF8, 0x01, 0x55, 0x41, 0x23, 0xEB, 0xB1, 0xFE, 0x9A, 0xE5, 0xBC, 0x07, 0xFC, 0xBD,
-    0xE8, 0x6F, 0xA2, 0xE2, 0xAD, 0x87, 0x12, 0xF8, 0xB1, 0x39, 0x9D, 0x3E, 0x71, 0x7D, 0xE6, 0xB0,
-    0x03, 0xE2, 0x33, 0x2C, 0x1C, 0xA5, 0xB0, 0xAF, 0xB8, 0xF1, 0xAE, 0x4B, 0xFC, 0x2B, 0xC4, 0xE8,
-    0xD8, 0x3B, 0x9D, 0xBE, 0x28, 0xE9, 0x53, 0xB4, 0x63, 0xC5, 0xFF, 0x3C, 0x15, 0xF3, 0x57, 0x48,
-    0x57, 0x20, 0x6E, 0xCD, 0x4C, 0x55, 0x98, 0xBE, 0xCC, 0xBC, 0xD5, 0xB7, 0x89, 0x22, 0x46, 0xE3,
-    0x2C, 0x2D, 0x7F, 0x3C, 0xE0, 0x11, 0xEE, 0xEA, 0x39, 0xD9, 0x72, 0x0C, 0xDE, 0xC3, 0x47, 0x24,
-    0x1C, 0x7C, 0x3C, 0xC2, 0x87, 0x23, 0xDA, 0x4F, 0xC7, 0xD2, 0x82, 0x9F, 0x26, 0x62, 0x3E, 0xC3,
-    0x9A, 0x32, 0x1B, 0xA2, 0xE4, 0x55, 0x94, 0x07, 0x0F, 0x10, 0xC9, 0x53, 0x26, 0x1E, 0xE4, 0x53,
-    0x58, 0x5B, 0x48, 0x8A, 0x79, 0xA3, 0x66, 0x53, 0x53, 0x66, 0x58, 0x45, 0x36, 0x3F, 0xDD, 0x27,
-    0x66, 0x15, 0xA9, 0xB0, 0x5B, 0x95, 0x55, 0x13, 0xD8, 0xA5, 0x06, 0x3E, 0x5F, 0x82, 0xAC, 0x8B,
-    0x2F, 0x3D, 0x5B, 0x79, 0xDF, 0x13, 0x16, 0x33, 0x1F, 0xA4, 0x13, 0xA2, 0xF0, 0xF5, 0x3D, 0xF1,
-    0xEF, 0x67, 0xA1, 0x53, 0xD4, 0xA5, 0xDF, 0xA2, 0x5D, 0xD8, 0xAE, 0xC8, 0xB9, 0x31, 0xD6, 0x8B,
-    0xE4, 0x60, 0xF0, 0x45, 0x6F, 0xDC, 0x9B, 0x9D, 0xA3, 0xD9, 0x24, 0xDE, 0x87, 0xA9, 0x93, 0x72,
-    0x9D, 0x06, 0xBA, 0x6B, 0x27, 0x5C, 0xCC, 0x36, 0xDF, 0xED, 0xD8, 0x68, 0x64, 0x69, 0xD5, 0x65,
-    0x1A, 0x53, 0x79, 0x89, 0x7B, 0x45, 0x55, 0x7A, 0x4E, 0xDB, 0xBC, 0xF5, 0xC7, 0xBE, 0x3F, 0x21,
-    0xEC, 0x76, 0x16, 0x25, 0x58, 0x97, 0x13, 0xA1, 0xBC, 0x6E, 0x9E, 0xBE, 0xB7, 0x3E, 0x91, 0x34,
-    0x7A, 0x97, 0x7E, 0xC3, 0x9D, 0xFD, 0xC1, 0xCE, 0xBA, 0xF9, 0x92, 0xE2, 0xAA, 0x97, 0xCE, 0x33,
-    0xB4, 0x1D, 0xDE, 0xBF, 0x77, 0x9D, 0xF5, 0x3A, 0x36, 0x2C, 0x84, 0x81, 0x78, 0x6F, 0xA6, 0xE2,
-    0xA4, 0xD9, 0xCE, 0x3B, 0xEB, 0x2E, 0x55, 0x1E, 0x32, 0xB7, 0xD5, 0x59, 0xCF, 0x9C, 0x9C, 0xD8,
-    0xA3, 0xB5, 0xFC, 0x98, 0xD5, 0x09, 0x7C, 0xF0, 0x0A, 0x62, 0x6A, 0x95, 0xC2, 0x77, 0xFC, 0x84,
-    0x20, 0x64, 0x28, 0xF1, 0x51, 0xFF, 0xA2, 0x80, 0xA2, 0x8A, 0x6E, 0xCD, 0x8C, 0xAB, 0xF5, 0x7F,
-    0x2B, 0x58, 0x27, 0xC2, 0x47, 0x7C, 0x01, 0xD1, 0xDA, 0x7B, 0x2B, 0x51, 0xDC, 0x8D, 0x08, 0xE3,
-    0x32, 0x83, 0xB9, 0x05, 0x4B, 0xF6, 0xE2, 0xB2, 0x96, 0xEC, 0xAC, 0xEA, 0x15, 0x8D, 0x7B, 0x7A,
-    0x6D, 0x8F, 0x26, 0xB3, 0x4E, 0xA3, 0x69, 0x27, 0x56, 0x25, 0xD0, 0x88, 0xDA, 0x7F, 0xA6, 0x40,
-    0xE4, 0x5A, 0x74, 0x67, 0x60, 0xFE, 0xBE, 0x60, 0x8A, 0x1A, 0xEE, 0xA5, 0xE0, 0xEA, 0xE1, 0xB7,
-    0x9F, 0xEB, 0xE3, 0x1C, 0xFA, 0xB4, 0x3A, 0xB5, 0x2C, 0x31, 0x30, 0x56, 0x6E, 0xBD, 0xAB, 0xE2,
-    0xD2, 0xD5, 0x01, 0x33, 0x32, 0x4F, 0x5D, 0xFD, 0x09, 0x64, 0xB5, 0xED, 0x58, 0x8A, 0x59, 0x27,
-    0xE8, 0x41, 0xA2, 0x80, 0x23, 0x9C, 0x4E, 0xF6, 0xEC, 0x09, 0x4C, 0xF0, 0x7B, 0x18, 0xCB, 0xDF,
-    0xF2, 0x2A, 0x60, 0x3F, 0x8B, 0xE7, 0x14, 0xBF, 0xD4, 0x60, 0xC5, 0xA9, 0xCF, 0xE0, 0x3E, 0x2F,
-    0x55, 0xBF, 0xDB, 0xD8, 0xF5, 0xB5, 0x4C, 0xC4, 0x56, 0xE7, 0x54, 0x79, 0xA5, 0xF1, 0x9D, 0xAD,
-    0x83, 0xC1, 0x3B, 0x3C, 0x5D, 0xCC, 0x32, 0x5A, 0x5F, 0xB2, 0x41, 0xBA, 0xA1, 0x9D, 0x23, 0x26,
-    0x64, 0xD4, 0xE9, 0x7C, 0xFA, 0x07, 0xEB, 0x58, 0xB8, 0x28, 0xF5, 0x42, 0x66, 0x97, 0xA5, 0x75,
-    0xD9, 0x29, 0x42, 0x2B, 0xCE, 0x41, 0x3D, 0x7B, 0x49, 0xDB, 0x2A, 0x09, 0xB3, 0xF8, 0xF4, 0x4D,
-    0x99, 0xF7, 0x93, 0x25, 0x83, 0xB2, 0x88, 0xB5, 0x64, 0x04, 0xDB, 0xC1, 0x0E, 0x45, 0x09, 0x72,
-    0xD6, 0x45, 0x93, 0x16, 0x26, 0x5D, 0xF6, 0x93, 0xC8, 0xDE, 0xF7, 0x2C, 0x71, 0x3F, 0x7F, 0x16,
-    0x03, 0x2B, 0x85, 0x63, 0x03, 0xF7, 0x2D, 0x9C, 0xFF, 0x62, 0xF9, 0xA2, 0x9F, 0xCE, 0x62, 0x4C,
-    0x9D, 0xF5, 0xD3, 0x83, 0x32, 0x7E, 0x6A, 0xBF, 0x8D, 0x11, 0x66, 0x88, 0x07, 0x55, 0x74, 0xD8,
-    0x17, 0x6F, 0x3C, 0xE5, 0x3F, 0x80, 0xF1, 0x82, 0xC2, 0x72, 0x37, 0xE1, 0xBD, 0x82, 0x2F, 0x00,
-    0x44, 0x89, 0x71, 0x1F, 0xF9, 0x4E, 0x85, 0x76, 0x5F, 0x56, 0x42, 0x12, 0x81, 0x00, 0x51, 0x20,
-    0x5A, 0x5A, 0x4C, 0x32, 0x01, 0xEC, 0x10, 0x9D, 0x5A, 0x11, 0xFB, 0x13, 0xA5, 0x10, 0x08, 0x39,
-    0xAC, 0xAA, 0x55, 0x04, 0x36, 0xAD, 0x25, 0xE1, 0x39, 0xFF, 0xEA, 0x55, 0xB5, 0xB4, 0xA6, 0xE4,
-    0xEA, 0x37, 0x07, 0xE4, 0x51, 0x6C, 0x8B, 0x0F, 0x6C, 0x01, 0x9C, 0x4A, 0xF3, 0x1C, 0x2E, 0x79,
-    0x83, 0xF3, 0x5E, 0x93, 0xC6, 0xCD, 0x78, 0xD9, 0x4B, 0x6F, 0x99, 0xFC, 0x98, 0xF5, 0x25, 0x48,
-    0x12, 0x89, 0x37, 0x94, 0x7D, 0x9E, 0x56, 0xF2, 0x04, 0xCE, 0xA3, 0xCE, 0x06, 0xAC, 0x05, 0xD3,
-    0xAD, 0xB0, 0x7A, 0xBC, 0xB6, 0xF1, 0xCB, 0xA1, 0x8C, 0xE5, 0x57, 0x32, 0xFA, 0xCD, 0xD0, 0xC2,
-    0x38, 0x1A, 0xA0, 0xD6, 0xD4, 0x4A, 0x53, 0x6B, 0xC2, 0x47, 0x13, 0x20, 0xFC, 0x44, 0x2B, 0xCB,
-    0xC7, 0x9F, 0x07, 0xC1, 0xA3, 0x94, 0x93, 0x0E, 0x74, 0xFA, 0x8B, 0x47, 0x00, 0x5F, 0x61, 0xA6,
-    0x41, 0x61, 0xE1, 0xEC, 0xA3, 0x5A, 0x8D, 0x9F, 0x5E, 0x13, 0xEF, 0x0E, 0x52, 0x6B, 0x2F, 0x4C,
-    0xBC, 0xFC, 0xF1, 0x76, 0xCA, 0x81, 0xFA, 0x2A, 0xEF, 0x0E, 0xCC, 0xE0, 0x7F, 0x7D, 0x54, 0x31,
-    0x6F, 0xDB, 0x46, 0x14, 0xFE, 0x48, 0x59, 0x66, 0x24, 0x4A, 0xA6, 0x52, 0xD8, 0x85, 0x9C, 0xCA,
-    0xA6, 0x06, 0x0D, 0xAA, 0x21, 0x87, 0x1A, 0x14, 0x40, 0x0D, 0x24, 0xF1, 0x90, 0xA9, 0x23, 0x07,
-    0xAB, 0x5D, 0x35, 0x78, 0x72, 0x07, 0x33, 0x80, 0x51, 0x68, 0x70, 0xA2, 0x03, 0xDA, 0xBD, 0xEA,
-    0x3F, 0xE0, 0xD0, 0x14, 0xA9, 0x96, 0x70, 0xB0, 0x01, 0x17, 0x55, 0xAA, 0x43, 0x33, 0x74, 0xBD,
-    0x76, 0xEC, 0x74, 0x4B, 0x87, 0x2C, 0x2D, 0x07, 0x17, 0x48, 0x0B, 0x59, 0xEC, 0x3B, 0xC9, 0x49,
-    0xDC, 0x16, 0xE8, 0x3D, 0xF2, 0xF8, 0x78, 0x77, 0xEF, 0xDD, 0xFB, 0xDE, 0xFB, 0xEE, 0x80, 0x47,
-    0xF0, 0x60, 0x33, 0x43, 0x00, 0xB6, 0x70, 0xD1, 0xC1, 0x00, 0x80, 0x23, 0xDD, 0xA4, 0x33, 0x8C,
-    0x8A, 0x06, 0xE0, 0x29, 0x79, 0x2F, 0x15, 0x25, 0x8F, 0xCD, 0x16, 0x47, 0xDF, 0x6C, 0xF5, 0x0F,
-    0xFC, 0x74, 0x1E, 0x64, 0x4F, 0x76, 0xFC, 0xB9, 0xAD, 0x3A, 0x8F, 0x3A, 0xA8, 0x95, 0xA7, 0xBD,
-    0x8B, 0x2E, 0x90, 0x65, 0x7E, 0x52, 0x3D, 0x41, 0x62, 0x71, 0x8B, 0xEC, 0xB3, 0x18, 0x49, 0x15,
-    0xCB, 0x30, 0x49, 0x7C, 0xF2, 0xAB, 0x1D, 0xFE, 0x28, 0x5D, 0x87, 0x75, 0xEE, 0x22, 0x6E, 0xD1,
-    0x5F, 0x5C, 0xE9, 0x9C, 0xB9, 0xCA, 0x16, 0x11, 0x35, 0xC4, 0x6A, 0x25, 0xCB, 0x75, 0xD3, 0x53,
-    0x74, 0x5D, 0x38, 0x36, 0xCB, 0x3C, 0x10, 0x26, 0xB7, 0x64, 0x46, 0x84, 0xC5, 0xDE, 0xD4, 0x49,
-    0x80, 0xF5, 0xB1, 0xF7, 0xAA, 0xDD, 0x18, 0xE4, 0xC0, 0x6D, 0x56, 0x41, 0x1B, 0x3D, 0xF8, 0xCC,
-    0x63, 0x14, 0x34, 0x73, 0x85, 0x23, 0x32, 0x22, 0xC3, 0x6D, 0x1A, 0x05, 0x76, 0x69, 0xDC, 0x27,
-    0x18, 0x0D, 0x6C, 0xC0, 0x14, 0xFF, 0x9D, 0x07, 0x59, 0x3A, 0xC8, 0x70, 0x48, 0x0D, 0xD8, 0xA1,
-    0x75, 0x21, 0x60, 0x7D, 0x32, 0xB3, 0x0C, 0xC8, 0x97, 0x0B, 0xC9, 0x66, 0xC9, 0x56, 0x88, 0xE6,
-    0xB5, 0xC0, 0x61, 0x0E, 0xD7, 0x90, 0x3A, 0x64, 0xB7, 0xD6, 0x0D, 0xC3, 0xF6, 0x4E, 0x16, 0x79,
-    0x92, 0x11, 0x59, 0x1F, 0x8D, 0x8F, 0xC7, 0x5A, 0xD7, 0x2D, 0x0F, 0x97, 0x8D, 0x64, 0x1E, 0x39,
-    0x1A, 0x3D, 0x1A, 0x03, 0x86, 0xD0, 0x62, 0x8A, 0x11, 0xEF, 0xD1, 0xAC, 0x5C, 0x8A, 0xC2, 0x8C,
-    0x79, 0xA8, 0xCE, 0xE7, 0xD5, 0xD7, 0x49, 0xF3, 0xF8, 0xB9, 0x52, 0xF1, 0xB9, 0xF2, 0xF8, 0x66,
-    0xA7, 0x1D, 0x06, 0x40, 0x11, 0x8E, 0x30, 0x95, 0xA1, 0x3E, 0x96, 0x23, 0x96, 0xA7, 0x4D, 0xCF,
-    0x70, 0x81, 0xC7, 0x63, 0x57, 0x22, 0x8E, 0xE3, 0x88, 0x1C, 0xCD, 0x52, 0xF5, 0xED, 0x47, 0x2A,
-    0x86, 0x0A, 0x10, 0x30, 0xE3, 0xC5, 0x67, 0xDF, 0xFD, 0x56, 0x3F, 0x0C, 0xB2, 0xED, 0xC6, 0xEE,
-    0x99, 0xAD, 0x4C, 0x6E, 0x72, 0x47, 0xED, 0x9E, 0xB5, 0x1B, 0x41, 0x16, 0xD0, 0x69, 0x73, 0x2F,
-    0x29, 0x10, 0xE6, 0x5E, 0x76, 0x4F, 0xC3, 0x22, 0x25, 0x90, 0xC1, 0x57, 0x32, 0xA4, 0x5A, 0xDE,
-    0xD1, 0x9E, 0x16, 0xFD, 0x3E, 0x7D, 0x46, 0xE9, 0xD5, 0xAA, 0xA6, 0x7B, 0x93, 0xA7, 0xF4, 0xBB,
-    0x52, 0x6E, 0x54, 0x1D, 0x47, 0x93, 0xF1, 0x28, 0x95, 0x13, 0x6A, 0xB3, 0x34, 0x5D, 0xC0, 0xE0,
-    0x14, 0x21, 0x9E, 0xC3, 0x52, 0x94, 0x46, 0x6C, 0x62, 0xD5, 0xA8, 0xA6, 0x31, 0x08, 0x9F, 0x21,
-    0x75, 0xCA, 0x33, 0x0C, 0x36, 0x28, 0xFB, 0xD8, 0x01, 0x65, 0xF7, 0xFF, 0x27, 0x6B, 0x40, 0xE9,
-    0xB4, 0x58, 0x6C, 0x9C, 0x90, 0x97, 0x08, 0x11, 0x21, 0x23, 0x88, 0xAB, 0x3D, 0x9F, 0xF4, 0x89,
-    0x1C, 0xD1, 0x79, 0x5F, 0x91, 0xBE, 0xB6, 0x39, 0x5A, 0xFC, 0xF0, 0x82, 0x3F, 0xA8, 0x72, 0x9F,
-    0x4A, 0xE6, 0x8B, 0xAA, 0xD8, 0x1E, 0xC6, 0xC3, 0xFD, 0x8D, 0xFD, 0x2A, 0x45, 0x4F, 0x18, 0xC8,
-    0xFA, 0xB5, 0xE2, 0x53, 0xCD, 0x32, 0x02, 0x54, 0x03, 0xE7, 0x9A, 0xCE, 0x37, 0xE1, 0x0C, 0x4F,
-    0x1B, 0xF5, 0x40, 0x87, 0xDC, 0x45, 0xB9, 0x33, 0xE8, 0x0E, 0x2F, 0x3B, 0xE1, 0xE5, 0x92, 0xF1,
-    0xA7, 0x24, 0x3E, 0x74, 0x66, 0xFE, 0x91, 0xE4, 0x7F, 0x65, 0xE6, 0x06, 0x57, 0xD3, 0xF7, 0xAC,
-    0x75, 0xFA, 0x18, 0x2D, 0x78, 0x89, 0x76, 0x7E, 0xFB, 0x77, 0x80, 0xE8, 0x98, 0x2C, 0x9F, 0x00,
-    0xAE, 0x94, 0xF7, 0x53, 0x31, 0xB8, 0xAB, 0x61, 0xE9, 0x91, 0xE8, 0x6D, 0x18, 0xB7, 0x3D, 0xF6,
-    0x26, 0x1E, 0x62, 0x55, 0xA9, 0x37, 0x1D, 0x5D, 0x95, 0x6B, 0xCB, 0x53, 0x42, 0x8C, 0x70, 0xA0,
-    0x25, 0xCD, 0xCC, 0x9D, 0xE4, 0xA5, 0xF1, 0xD5, 0x7A, 0x4C, 0x44, 0x43, 0x28, 0xB3, 0x4F, 0x88,
-    0xA6, 0x5B, 0x59, 0xDA, 0x60, 0x40, 0xD0, 0x0C, 0x46, 0xA9, 0xFF, 0x89, 0xBA, 0xF0, 0x67, 0xE0,
-    0xD6, 0xAA, 0xA3, 0x75, 0x6B, 0xA1, 0xC9, 0x51, 0xD6, 0xBB, 0x13, 0xC4, 0x03, 0x23, 0x80, 0xCC,
-    0x7D, 0x8D, 0x70, 0xE9, 0xE0, 0x57, 0xE3, 0x20, 0x1B, 0x2F, 0x9D, 0x82, 0x4E, 0x81, 0xCB, 0x6D,
-    0xD1, 0x45, 0x09, 0x6B, 0xFB, 0xC4, 0xE8, 0x1C, 0xED, 0x9B, 0xF4, 0xA6, 0x61, 0x31, 0x23, 0x2C,
-    0x69, 0xF2, 0x37, 0x29, 0xE6, 0xA0, 0x7A, 0x79, 0xAC, 0x07, 0x4B, 0x68, 0x60, 0x6F, 0xAD, 0xA4,
-    0x85, 0xEF, 0x6D, 0xE6, 0x7C, 0x21, 0x9E, 0xEF, 0x48, 0xD9, 0x8A, 0x97, 0xF5, 0x1B, 0x74, 0x1E,
-    0x13, 0x9F, 0xF1, 0xCE, 0xE7, 0xBD, 0xA9, 0xAD, 0x7A, 0x53, 0x93, 0xBB, 0xCF, 0xD8, 0xBD, 0x3F,
-    0x44, 0x18, 0x49, 0xEA, 0x49, 0xDF, 0x24, 0x1A, 0xF8, 0xE2, 0x5D, 0x3A, 0xD3, 0x54, 0x70, 0x8D,
-    0x5A, 0x5F, 0x03, 0x95, 0x0D, 0x7D, 0x17, 0x98, 0x7F, 0xF6, 0x8F, 0x39, 0xBC, 0xF4, 0xD5, 0x8A,
-    0x4B, 0xCB, 0x59, 0x7D, 0x50, 0x1B, 0x0E, 0x83, 0x91, 0x98, 0x7F, 0xF5, 0x9F, 0xDD, 0x98, 0xDD,
-    0x9B, 0x4C, 0x9E, 0x8E, 0xD2, 0xF4, 0x4A, 0xBF, 0x5A, 0x37, 0x27, 0x0C, 0x39, 0x37, 0x5D, 0xB0,
-    0x46, 0x0B, 0xC7, 0xE9, 0x25, 0xE1, 0xEE, 0x33, 0x64, 0x27, 0x81, 0xAE, 0xE2, 0x02, 0x96, 0xA4,
-    0x87, 0x88, 0x86, 0x13, 0x3A, 0xCA, 0x28, 0x5C, 0xB3, 0xB5, 0x7A, 0x34, 0x99, 0x5C, 0x90, 0x83,
-    0x39, 0xE9, 0xCD, 0xA5, 0x53, 0x5E, 0x12, 0x5B, 0xA2, 0x29, 0x1E, 0x8A, 0x72, 0x90, 0xE7, 0xCD,
-    0xE8, 0x7E, 0xD4, 0x44, 0x5D, 0x9F, 0x97, 0x0A, 0xEA, 0x85, 0x42, 0xA1, 0xB2, 0x7D, 0x87, 0x37,
-    0x07, 0x83, 0x66, 0x18, 0x36, 0xC7, 0xEB, 0xAC, 0x51, 0x2F, 0x94, 0xB5, 0x14, 0xEB, 0xE6, 0x87,
-    0x7B, 0xEC, 0x4B, 0x26, 0x20, 0x10, 0xB1, 0x6D, 0xED, 0x47, 0x21, 0xDA, 0x8B, 0x06, 0x4A, 0xDF,
-    0x6A, 0x4D, 0xB5, 0x5D, 0x25, 0x80, 0xB4, 0x67, 0x31, 0x2E, 0x5C, 0x5B, 0x6C, 0xDF, 0xFA, 0xF4,
-    0x17, 0xDE, 0x0A, 0x65, 0xAB, 0x39, 0x5E, 0x3D, 0x87, 0xB5, 0xE0, 0x7D, 0x55, 0xC0, 0x4A, 0xC8,
-    0xC3, 0xE6, 0x07, 0xB5, 0x5A, 0xAD, 0x9E, 0x3B, 0x0B, 0x9B, 0xA5, 0x3A, 0x2F, 0xD0, 0x7D, 0x65,
-    0x60, 0x18, 0x55, 0xE8, 0xF6, 0xC9, 0xF3, 0xAA, 0x3C, 0x8C, 0xFE, 0x06, 0xC5, 0x7C, 0x4F, 0x6C,
-    0x1C, 0xE9, 0x75, 0xE7, 0xAB, 0xAA, 0x21, 0x4B, 0xA3, 0x1A, 0xB1, 0x74, 0x10, 0xD7, 0x5E, 0x8B,
-    0xE3, 0xD2, 0x61, 0x0E, 0x42, 0x56, 0xC3, 0x1A, 0x20, 0x3C, 0xD0, 0x59, 0x76, 0x77, 0xC9, 0x03,
-    0xD8, 0xC0, 0xCE, 0x61, 0x7B, 0x01, 0xB5, 0x27, 0x80, 0xB0, 0xD1, 0x1C, 0x7C, 0x88, 0xBD, 0x49,
-    0xC8, 0x00, 0x04, 0x76, 0x92, 0x34, 0xD9, 0x35, 0x9E, 0x43, 0x0E, 0x3E, 0x84, 0x0B, 0x78, 0x9C,
-    0xCB, 0x02, 0x11, 0xB0, 0x73, 0xB0, 0xE8, 0xC5, 0x92, 0x0B, 0xE8, 0x40, 0x2C, 0x9A, 0xEC, 0xD2,
-    0x08, 0xC8, 0x65, 0xE0, 0x75, 0x79, 0x06, 0xF2, 0x5C, 0x16, 0x98, 0x72, 0x22, 0x61, 0x83, 0x11,
-    0x12, 0x55, 0x26, 0x45, 0xB8, 0x28, 0x75, 0x77, 0xE5, 0xF7, 0xFB, 0xBE, 0xEA, 0x66, 0x93, 0x22,
-    0x25, 0x4A, 0x22, 0x6D, 0xB2, 0xBF, 0x57, 0xDD, 0x55, 0xD5, 0xDF, 0xDF, 0xF7, 0xE7, 0xF7, 0xDE,
-    0xF7, 0xAA, 0xA5, 0x2E, 0x62, 0x64, 0x22, 0xD2, 0x44, 0x79, 0x15, 0xC5, 0x14, 0xF5, 0x57, 0x14,
-    0x45, 0xE8, 0x7D, 0xB1, 0x16, 0x3A, 0x91, 0x85, 0x62, 0xA2, 0x18, 0x81, 0x13, 0x89, 0x0C, 0x4B,
-    0xD1, 0x15, 0xE7, 0xCE, 0x15, 0xD9, 0x73, 0x2E, 0x92, 0x3A, 0x4A, 0xC2, 0xE2, 0xDD, 0x79, 0x3B,
-    0x46, 0x1D, 0xB1, 0x11, 0x7E, 0x57, 0xAC, 0xA4, 0x2B, 0x66, 0xBC, 0x21, 0x83, 0xBF, 0xE3, 0xAA,
-    0xBB, 0x56, 0x14, 0xB9, 0x2C, 0xAF, 0x7D, 0xD1, 0x96, 0x45, 0x37, 0x9A, 0x93, 0x05, 0x37, 0x9A,
-    0xD2, 0x44, 0x5C, 0x7C, 0xA3, 0x24, 0x7F, 0x7B, 0x03, 0xA4, 0x28, 0x22, 0x71, 0x63, 0x3B, 0xC5,
-    0x39, 0x0C, 0x16, 0x17, 0x72, 0x92, 0xEE, 0xF0, 0x1D, 0x89, 0x99, 0x8A, 0x17, 0x9F, 0x8F, 0x8D,
-    0xA2, 0x57, 0xD5, 0xDD, 0xC4, 0x09, 0xB1, 0x51, 0x87, 0x8B, 0xF7, 0x5F, 0x1D, 0xF6, 0x3C, 0x40,
-    0xCF, 0xD1, 0x5B, 0x1B, 0xC5, 0x2A, 0x8B, 0xC8, 0x51, 0x8B, 0x17, 0xB3, 0x8E, 0x72, 0x1A, 0xFC,
-    0xBE, 0x98, 0x3B, 0xD7, 0x22, 0xD4, 0x11, 0x7B, 0x62, 0x45, 0x35, 0x31, 0xA4, 0x82, 0xD3, 0x4B,
-    0x28, 0x6D, 0x94, 0x4E, 0x91, 0xCA, 0xD6, 0xEA, 0x75, 0xF5, 0x9E, 0xE7, 0xD8, 0xAB, 0x1A, 0x8A,
-    0x17, 0xA0, 0x4B, 0xB1, 0xC4, 0xD6, 0xCE, 0xD5, 0x48, 0x5A, 0xFD, 0xC1, 0xA4, 0x9A, 0x98, 0xD3,
-    0x6F, 0x65, 0x15, 0x69, 0x37, 0xE5, 0xDD, 0xA6, 0x5A, 0x4E, 0xDC, 0xEC, 0x25, 0x62, 0x17, 0x81,
-    0x74, 0x70, 0xC8, 0x05, 0xE3, 0x95, 0xCA, 0x1B, 0x52, 0xB9, 0x29, 0x95, 0x0D, 0x69, 0x56, 0x8D,
-    0xCC, 0x29, 0x42, 0x8E, 0xA9, 0xEB, 0x61, 0x56, 0x0F, 0xFF, 0xF7, 0xE2, 0xA2, 0xF7, 0xCE, 0xC5,
-    0xBC, 0x79, 0x73, 0x4E, 0x8E, 0x78, 0xB7, 0x5B, 0x44, 0x46, 0x5F, 0x0D, 0xE2, 0x39, 0x5E, 0xB9,
-    0x18, 0xA9, 0xD8, 0x89, 0x2C, 0x07, 0x62, 0x91, 0x51, 0x44, 0x96, 0x57, 0x7B, 0x68, 0x78, 0x16,
-    0x57, 0x0E, 0xA7, 0x33, 0x52, 0xEC, 0x90, 0xEE, 0xCC, 0xC7, 0xA0, 0xB9, 0x99, 0xC9, 0x02, 0xCE,
-    0x77, 0x65, 0x1D, 0xB4, 0x5D, 0xD2, 0x84, 0xD4, 0x8C, 0x79, 0xFE, 0x3C, 0x96, 0xDC, 0xC8, 0x8A,
-    0xD0, 0xDC, 0xB9, 0x1A, 0x77, 0xC4, 0x2B, 0x06, 0xB3, 0x58, 0x74, 0xDD, 0x22, 0xC6, 0xAC, 0xB1,
-    0xFB, 0x58, 0xAF, 0xF6, 0x13, 0xE8, 0x9D, 0xC6, 0x66, 0x1D, 0x9C, 0xCA, 0x2E, 0xF2, 0xCC, 0x78,
-    0xA6, 0xCE, 0x77, 0x15, 0x5D, 0x7A, 0x8C, 0x36, 0xF5, 0x55, 0xAC, 0x7F, 0xEF, 0x6A, 0xCA, 0x19,
-    0x2A, 0x02, 0xC5, 0xBD, 0x9A, 0x7D, 0x35, 0xFF, 0x96, 0xBC, 0xAB, 0xA9, 0xE6, 0xDE, 0x01, 0xBD,
-    0x75, 0x43, 0x4A, 0x2E, 0xC6, 0xD2, 0x3B, 0x89, 0x68, 0x76, 0x25, 0x37, 0x3F, 0x81, 0x7A, 0xB1,
-    0x81, 0xC9, 0x2C, 0x7A, 0x86, 0x5A, 0x66, 0x29, 0x59, 0x48, 0xF1, 0x13, 0xE6, 0x02, 0x1C, 0x13,
-    0x0E, 0x47, 0xED, 0xF4, 0x31, 0x68, 0x33, 0x17, 0xF2, 0xA2, 0x90, 0xB9, 0x41, 0xBE, 0xCE, 0xA1,
-    0xCE, 0x92, 0xE0, 0x66, 0xE7, 0xB6, 0x92, 0x4B, 0x92, 0xCF, 0x50, 0xB5, 0x73, 0x2B, 0xE7, 0x85,
-    0x1E, 0x49, 0x8D, 0xC4, 0x8B, 0x40, 0xD0, 0x31, 0x54, 0x90, 0x91, 0xCB, 0xFB, 0x52, 0xF4, 0xC4,
-    0x8F, 0xE4, 0x25, 0xD6, 0xEF, 0x91, 0x90, 0xFD, 0xC5, 0x88, 0xF9, 0xF6, 0x9D, 0x61, 0xBB, 0x56,
-    0x91, 0x82, 0x45, 0x5B, 0x9C, 0xC1, 0x9A, 0x0C, 0x48, 0x07, 0xC4, 0x2C, 0x58, 0x9F, 0x0F, 0xF2,
-    0x2A, 0xC9, 0x22, 0x49, 0x02, 0x72, 0x3B, 0x04, 0xF9, 0xBF, 0x02, 0xD2, 0x25, 0x49, 0x49, 0x22,
-    0x4D, 0x6A, 0x6C, 0xB7, 0x15, 0x14, 0x3D, 0x54, 0x2A, 0x17, 0x2D, 0x0C, 0xAE, 0x8D, 0xC1, 0x48,
-    0x6D, 0x0D, 0x0D, 0x8F, 0xDF, 0x18, 0x36, 0x09, 0x79, 0xF0, 0x13, 0xA3, 0xC7, 0x99, 0x5D, 0x14,
-    0x3B, 0x06, 0x6F, 0x58, 0xA9, 0xC4, 0xD0, 0x81, 0x06, 0xEE, 0xEB, 0xF2, 0x6B, 0x9B, 0x36, 0x25,
-    0xCD, 0xA1, 0x84, 0x9E, 0xE1, 0xB4, 0xFF, 0x77, 0xF6, 0x9E, 0x4C, 0x86, 0x1B, 0x31, 0x6B, 0xC9,
-    0x60, 0x1C, 0xD4, 0x0D, 0x16, 0x85, 0xD9, 0xE8, 0xC9, 0xEE, 0x4C, 0x16, 0x09, 0xD8, 0xA7, 0xA0,
-    0x56, 0x58, 0x62, 0xAF, 0x2A, 0x2F, 0x44, 0xBC, 0x3B, 0x8D, 0x65, 0x2A, 0x9D, 0x02, 0x02, 0xDC,
-    0x65, 0x4B, 0xEC, 0x81, 0xA4, 0x83, 0x15, 0x94, 0x95, 0xC1, 0x47, 0x93, 0x2A, 0xDC, 0x62, 0x27,
-    0x6D, 0x2A, 0x72, 0x97, 0x8A, 0xE4, 0x8C, 0x0F, 0x72, 0x89, 0x93, 0x3F, 0xEB, 0x62, 0x58, 0x8B,
-    0x5C, 0x81, 0x75, 0x8C, 0x58, 0x52, 0x2B, 0x01, 0x5F, 0x60, 0x96, 0x4C, 0x6A, 0x43, 0x0C, 0xB9,
-    0x2B, 0x36, 0x35, 0x06, 0x14, 0x5D, 0x85, 0xEA, 0xA5, 0x25, 0x45, 0x6A, 0x17, 0x09, 0x9A, 0x95,
-    0xBD, 0xCA, 0xCE, 0xDC, 0x55, 0x66, 0x77, 0xC0, 0x22, 0x58, 0x62, 0x27, 0xF2, 0x03, 0x2D, 0xF8,
-    0x76, 0x4C, 0xE6, 0xD1, 0x47, 0x16, 0x37, 0xF2, 0xEE, 0x74, 0xD0, 0xF7, 0x0C, 0xE5, 0x43, 0xD4,
-    0xC3, 0x55, 0x75, 0xC3, 0xBD, 0xCA, 0x82, 0x9F, 0xFF, 0x04, 0xF5, 0x80, 0xF1, 0xEE, 0xCC, 0xB3,
-    0x1D, 0x2A, 0x43, 0xA8, 0x17, 0x2B, 0x2D, 0x4B, 0xC2, 0xBA, 0xBC, 0x3B, 0xF3, 0x61, 0x01, 0xF1,
-    0x3E, 0x2E, 0xE5, 0x4B, 0xB5, 0x12, 0x43, 0xAB, 0x74, 0x02, 0xB9, 0x44, 0x3D, 0xB9, 0x8F, 0x5C,
-    0x24, 0x99, 0x25, 0x99, 0x19, 0x92, 0x05, 0x92, 0x75, 0x92, 0x84, 0x24, 0x06, 0x31, 0x23, 0x10,
-    0xCC, 0x5D, 0x53, 0xBC, 0x46, 0x63, 0x33, 0xE8, 0x70, 0x91, 0x36, 0x31, 0xFD, 0xC9, 0x4D, 0x2C,
-    0x53, 0xB2, 0xCE, 0x15, 0x52, 0xA4, 0x4E, 0x86, 0x3F, 0x2E, 0x8B, 0xE7, 0x75, 0xBD, 0xE2, 0x07,
-    0x45, 0x68, 0xA7, 0xE3, 0x3D, 0xD9, 0xE2, 0xCA, 0xE7, 0x72, 0x93, 0x9D, 0xCD, 0xC8, 0x90, 0xAF,
-    0x4A, 0x46, 0xF6, 0x75, 0x24, 0xA3, 0xC5, 0xB2, 0xA2, 0xEC, 0x92, 0xE2, 0x93, 0x6C, 0x91, 0x8C,
-    0x53, 0x14, 0xE4, 0x1F, 0x6B, 0x7B, 0x67, 0x93, 0xDC, 0x1C, 0x67, 0xB4, 0x24, 0x6E, 0x98, 0x41,
-    0x6E, 0x21, 0x38, 0x99, 0x83, 0xAF, 0x6F, 0xE2, 0xEB, 0x29, 0x8D, 0x44, 0x06, 0xB5, 0x61, 0xB1,
-    0xEA, 0x4D, 0x28, 0x1B, 0xB3, 0x2B, 0xB5, 0xA0, 0x15, 0x78, 0x45, 0xE4, 0x28, 0xB6, 0x73, 0x30,
-    0x75, 0xB5, 0xCB, 0x5D, 0x68, 0x91, 0x65, 0xD9, 0xC0, 0x57, 0xCF, 0x29, 0x9B, 0x54, 0xD5, 0x00,
-    0x82, 0x3A, 0x89, 0xCA, 0xE6, 0x3B, 0x64, 0xC4, 0x65, 0x0A, 0x90, 0xB2, 0x57, 0x17, 0x50, 0x6E,
-    0xE2, 0x3D, 0xAA, 0x92, 0x16, 0xBE, 0x7B, 0xBE, 0x48, 0x4E, 0x5A, 0xFE, 0x2F, 0x51, 0xB9, 0x35,
-    0x0F, 0x92, 0xFF, 0x93, 0x6A, 0xF2, 0xE4, 0x94, 0xE8, 0x80, 0x5F, 0xFB, 0x5C, 0xE9, 0xF6, 0xC1,
-    0x64, 0x66, 0x2F, 0x59, 0x20, 0x59, 0x1F, 0x92, 0x04, 0x04, 0x86, 0xAF, 0x2D, 0xE7, 0x69, 0x85,
-    0x8A, 0x10, 0x0A, 0xAB, 0x23, 0xB4, 0x74, 0x6A, 0x4A, 0xB8, 0x68, 0x89, 0x97, 0x09, 0xB5, 0x56,
-    0x2E, 0x66, 0x5F, 0x9C, 0xB6, 0x58, 0xCB, 0xE2, 0x54, 0xC4, 0xAE, 0x8A, 0x53, 0x93, 0xD3, 0xA0,
-    0x9E, 0x9C, 0x01, 0x75, 0xC3, 0x29, 0x50, 0x0C, 0x08, 0xD4, 0x8E, 0x67, 0x40, 0xAD, 0x64, 0x1D,
-    0xD4, 0x4C, 0x13, 0x50, 0x63, 0x3B, 0x02, 0x95, 0x87, 0x8A, 0x76, 0x02, 0xD2, 0x1A, 0x38, 0xC3,
-    0xC3, 0x3B, 0x6A, 0x94, 0x57, 0xD5, 0x24, 0xD9, 0x9C, 0x7E, 0xA3, 0x43, 0xEE, 0xAF, 0xCA, 0xE1,
-    0xA4, 0x80, 0x49, 0x76, 0xA8, 0xFC, 0x9E, 0x7C, 0x1F, 0x26, 0x09, 0x3A, 0xA6, 0x67, 0x17, 0xA9,
-    0x5E, 0xDE, 0x79, 0xCC, 0x91, 0xB9, 0x7D, 0x3E, 0xD6, 0x38, 0xCF, 0xA3, 0xB1, 0xAB, 0x12, 0x3D,
-    0x55, 0xC8, 0xA2, 0x4B, 0x64, 0xF5, 0x36, 0x99, 0x72, 0x1F, 0x51, 0x17, 0xD4, 0x2D, 0x55, 0x6A,
-    0x40, 0x9F, 0x5F, 0x53, 0x15, 0x58, 0x4A, 0x30, 0x86, 0x18, 0x4B, 0x29, 0x62, 0xEF, 0x8B, 0x55,
-    0xD5, 0xFB, 0xCA, 0x8B, 0x6A, 0xF7, 0x25, 0xF6, 0x7E, 0x0B, 0xBD, 0x77, 0xA8, 0x6A, 0x13, 0xA8,
-    0xC8, 0x3E, 0x79, 0x20, 0xA0, 0xEA, 0x2C, 0x55, 0xEA, 0x28, 0xAE, 0x0A, 0x9C, 0x3B, 0x5B, 0x98,
-    0x97, 0xBB, 0x47, 0xC4, 0x95, 0xDE, 0xA1, 0xB8, 0x72, 0xB4, 0x3C, 0x0D, 0x57, 0x12, 0xA3, 0x10,
-    0xA1, 0xC0, 0x76, 0xCC, 0x2D, 0x38, 0xD1, 0x14, 0x8B, 0x3C, 0x8B, 0xCE, 0x75, 0xC1, 0xF6, 0x58,
-    0xCA, 0x13, 0x36, 0xBB, 0x62, 0x34, 0x02, 0xAD, 0x9A, 0xF4, 0xB0, 0xBE, 0xD6, 0xFF, 0x11, 0xF8,
-    0xB8, 0xDF, 0x09, 0xDC, 0xA8, 0xE9, 0xC4, 0x35, 0x69, 0x9A, 0xD9, 0x12, 0xF4, 0x53, 0x17, 0x38,
-    0x4C, 0xDA, 0xFB, 0x08, 0x2F, 0xE4, 0xBC, 0x25, 0x55, 0x37, 0xAB, 0xAF, 0xA1, 0x82, 0x95, 0xB2,
-    0x2A, 0x85, 0x91, 0xC7, 0x50, 0x7D, 0xAB, 0x47, 0xF9, 0xCE, 0x60, 0x68, 0xAD, 0x14, 0xFD, 0x30,
-    0x72, 0xF6, 0xB9, 0xCB, 0xEE, 0x56, 0xE9, 0x36, 0xF9, 0xEF, 0xB2, 0xCF, 0xEC, 0xA9, 0xCD, 0x9E,
-    0x5A, 0xB4, 0xC7, 0x0E, 0x55, 0xEE, 0x14, 0xF5, 0xE0, 0x2C, 0x27, 0x38, 0x85, 0x15, 0x36, 0x23,
-    0x70, 0x94, 0x15, 0x62, 0x48, 0x5E, 0x68, 0x75, 0x21, 0x15, 0x5E, 0x11, 0x9C, 0x04, 0x68, 0xA8,
-    0x93, 0x57, 0x55, 0x6F, 0xD2, 0xBD, 0xB0, 0x61, 0x5D, 0x01, 0xB0, 0x56, 0x1F, 0x22, 0x73, 0x3E,
-    0x83, 0x1C, 0x42, 0x55, 0x55, 0xE5, 0x40, 0x92, 0x90, 0xA4, 0x20, 0x46, 0xCF, 0xD8, 0xA2, 0x3B,
-    0x02, 0x32, 0xFE, 0xA3, 0xEA, 0x10, 0x47, 0xEE, 0x23, 0x1D, 0x36, 0x46, 0x09, 0xF7, 0xFB, 0x1E,
-    0x8C, 0x5D, 0xE2, 0x64, 0xE3, 0x84, 0x07, 0x16, 0x51, 0xB7, 0x3A, 0x64, 0x27, 0x72, 0x80, 0x65,
-    0xDC, 0x6E, 0x74, 0x95, 0x68, 0x02, 0x1E, 0xFF, 0x56, 0x5A, 0xDF, 0x09, 0xCA, 0xD6, 0x15, 0x2B,
-    0x7A, 0xFA, 0x60, 0xE9, 0x83, 0xA9, 0x0F, 0x86, 0x3E, 0x48, 0x58, 0xD3, 0x98, 0x3F, 0x26, 0xE4,
-    0x0F, 0x88, 0xF5, 0x07, 0x44, 0x46, 0x48, 0x01, 0xE6, 0x73, 0x7F, 0xDC, 0xE3, 0x47, 0x9F, 0x04,
-    0x7C, 0x03, 0x12, 0xED, 0x25, 0xA1, 0xBE, 0xEA, 0x7F, 0xD0, 0x83, 0xEB, 0x07, 0xF5, 0x01, 0xFB,
-    0xAE, 0x46, 0x2E, 0x6A, 0xE0, 0xA2, 0xC6, 0x7D, 0x08, 0x85, 0x12, 0x01, 0xFD, 0xE5, 0x96, 0x3A,
-    0xE3, 0x86, 0xA4, 0x4E, 0x44, 0x6A, 0xC7, 0xDA, 0x7A, 0xED, 0xBE, 0xB7, 0xA3, 0xC1, 0x3D, 0x40,
-    0x73, 0x26, 0xE7, 0xF9, 0xAE, 0xC7, 0x69, 0x56, 0xAE, 0xE5, 0xC1, 0x52, 0x4F, 0x15, 0x85, 0xBA,
-    0x77, 0xD1, 0xDE, 0x1E, 0x64, 0xA8, 0x50, 0x9F, 0x46, 0x86, 0x77, 0x45, 0x03, 0x8A, 0x15, 0xA9,
-    0x7D, 0x2B, 0x57, 0x9A, 0x7A, 0x03, 0xBA, 0xF7, 0x9C, 0x10, 0xAC, 0xBA, 0xBB, 0x35, 0xD2, 0xF8,
-    0x35, 0xAE, 0xC6, 0x23, 0x3A, 0x25, 0xBA, 0x80, 0x7B, 0x34, 0xA0, 0xA8, 0xC8, 0x32, 0xD0, 0x8A,
-    0x57, 0x9A, 0xB2, 0x81, 0x8D, 0x97, 0x0E, 0xCE, 0x25, 0xF6, 0x5D, 0x62, 0x4A, 0x2F, 0x60, 0x9B,
-    0x55, 0x60, 0x13, 0x27, 0x82, 0xBA, 0x83, 0x9B, 0x46, 0x27, 0xD3, 0x89, 0xBA, 0x94, 0x5E, 0x8C,
-    0x4E, 0xDA, 0xC4, 0x9F, 0xA0, 0x77, 0x14, 0xD5, 0x67, 0xCA, 0xAB, 0xFA, 0xCE, 0xA6, 0xFA, 0x96,
-    0xAE, 0xC1, 0x83, 0xC0, 0x78, 0x31, 0x30, 0x29, 0x8C, 0x3E, 0x5B, 0x29, 0xFF, 0xC6, 0x01, 0x4D,
-    0xA5, 0xB5, 0x0A, 0x17, 0xB4, 0x0B, 0x59, 0x33, 0xD3, 0xC7, 0x89, 0x91, 0x53, 0x08, 0xB7, 0x94,
-    0x5F, 0x46, 0xC1, 0x74, 0x7E, 0xC9, 0x77, 0xEF, 0x81, 0xD4, 0x78, 0x6E, 0x93, 0x84, 0xDF, 0xB5,
-    0x78, 0xB3, 0x93, 0x00, 0xCA, 0xD7, 0xE0, 0x21, 0x06, 0xC6, 0x0D, 0xF1, 0xEE, 0xC7, 0x55, 0x23,
-    0x7D, 0x1D, 0xDC, 0xA6, 0x5E, 0xC6, 0x5A, 0xE6, 0x7F, 0x90, 0x35, 0x25, 0xCB, 0xD5, 0xAB, 0x6B,
-    0x66, 0xCB, 0x7F, 0xB0, 0xE1, 0xE5, 0xAD, 0xE1, 0xF0, 0xCF, 0x6B, 0x0B, 0x80, 0x41, 0xB9, 0xF7,
-    0x44, 0xBE, 0xAE, 0x5C, 0x64, 0x30, 0x59, 0x27, 0x96, 0xFF, 0xFA, 0xDF, 0xBA, 0x30, 0x38, 0x55,
-    0x4C, 0xB5, 0xC7, 0x12, 0xC0, 0xCA, 0x0D, 0x0B, 0xD0, 0x7F, 0x30, 0x87, 0xF3, 0xD3, 0xB8, 0xEE,
-    0x86, 0x80, 0x0B, 0x25, 0x46, 0x6B, 0x34, 0x18, 0x88, 0xC0, 0x3D, 0x6E, 0x50, 0x51, 0xAF, 0xB6,
-    0xFB, 0x45, 0xE2, 0xDE, 0xBF, 0xEB, 0x06, 0x4B, 0x6E, 0x50, 0x05, 0x0B, 0x82, 0x7A, 0x1F, 0xB4,
-    0xC1, 0x81, 0x8D, 0x46, 0xBD, 0x53, 0x64, 0x6E, 0x70, 0xD3, 0x0D, 0x66, 0xD4, 0x4B, 0xF6, 0xBF,
-    0x42, 0x0A, 0x07, 0x56, 0x67, 0x0C, 0xB7, 0x3A, 0xF4, 0x0C, 0xA8, 0x11, 0xD7, 0x71, 0xE5, 0x3A,
-    0x4A, 0x82, 0x12, 0xEB, 0x62, 0x44, 0x6E, 0x60, 0xA2, 0x58, 0xA1, 0x1B, 0xD8, 0x81, 0x1B, 0x78,
-    0x8D, 0x6B, 0xA8, 0xBA, 0xC8, 0xDB, 0x98, 0x45, 0xC0, 0xDD, 0x77, 0xA1, 0xC3, 0x66, 0xAF, 0xA3,
-    0x00, 0x5A, 0x9F, 0x93, 0x1B, 0xE2, 0xDC, 0x8F, 0xA7, 0x25, 0x9B, 0x53, 0xFA, 0x7C, 0x43, 0x2A,
-    0x45, 0xD1, 0xEB, 0xAF, 0xFE, 0x24, 0x57, 0xEA, 0xBB, 0x49, 0xE5, 0xF4, 0x55, 0xF7, 0xCE, 0x86,
-    0xA9, 0x38, 0xA4, 0x71, 0x19, 0xFF, 0x9D, 0x4F, 0x8A, 0xBF, 0xEC, 0x39, 0xC1, 0x92, 0x99, 0x58,
-    0xD1, 0x1C, 0x94, 0x78, 0x32, 0x07, 0x25, 0xBE, 0x38, 0x07, 0x9F, 0xBB, 0xBA, 0x85, 0xAF, 0xB4,
-    0xB0, 0xB0, 0x92, 0xCF, 0xF9, 0x58, 0xB6, 0x39, 0x37, 0xB4, 0xE2, 0x39, 0xDA, 0xE3, 0x39, 0x2B,
-    0xF5, 0x83, 0x2D, 0x23, 0x07, 0xD0, 0x8B, 0x5A, 0x5C, 0x93, 0x9F, 0xC6, 0x15, 0x23, 0x9D, 0xD3,
-    0x6B, 0x62, 0x26, 0xC6, 0x4F, 0x03, 0x63, 0x2D, 0x54, 0x6A, 0x76, 0xE3, 0x9C, 0xB4, 0xE7, 0x24,
-    0xAF, 0xC2, 0x9C, 0x28, 0xB7, 0xBB, 0x51, 0x9F, 0xBC, 0xD2, 0x49, 0x5B, 0xB9, 0x1B, 0xBA, 0x18,
-    0x11, 0xEA, 0x0A, 0x3C, 0x94, 0x4E, 0xE4, 0x7E, 0xF3, 0xE3, 0xC8, 0x7D, 0x0B, 0x9F, 0xC1, 0x6C,
-    0x6E, 0xAA, 0x6D, 0x3E, 0xAF, 0xE3, 0x6A, 0x5C, 0x64, 0xAD, 0xAE, 0x84, 0x5F, 0x45, 0xC5, 0xD3,
-    0x62, 0x6C, 0x83, 0x69, 0xE7, 0xCB, 0xB5, 0x78, 0xCE, 0xBA, 0x1A, 0xF5, 0x46, 0xD0, 0x49, 0x71,
-    0x5F, 0x58, 0xC1, 0x3A, 0x2C, 0xA2, 0x00, 0x20, 0xBD, 0x09, 0x05, 0xB2, 0x46, 0x65, 0x83, 0xE3,
-    0xB7, 0xF1, 0xF9, 0x9B, 0x29, 0xCE, 0x77, 0x51, 0x96, 0xB1, 0x4A, 0x7E, 0x50, 0x64, 0x4E, 0x5A,
-    0xAE, 0x53, 0xA2, 0xD6, 0x68, 0x1D, 0x4E, 0xC5, 0xF5, 0xB2, 0x24, 0x65, 0x89, 0x5D, 0x68, 0x36,
-    0x17, 0x4A, 0xCE, 0x15, 0x3B, 0x74, 0x05, 0x26, 0x3E, 0x04, 0xA0, 0xC9, 0x54, 0x5F, 0x03, 0x19,
-    0xBB, 0xD2, 0x49, 0xC4, 0xCF, 0x60, 0x14, 0x6B, 0xA1, 0x9B, 0x49, 0x27, 0x9C, 0xE8, 0xCA, 0x83,
-    0x70, 0xA2, 0x69, 0xFC, 0x3C, 0x9C, 0xA8, 0x5A, 0x7F, 0x15, 0x4E, 0xF8, 0x96, 0x1B, 0x4E, 0xB8,
-    0x3F, 0x04, 0x71, 0x7E, 0x06, 0x62, 0x77, 0x41, 0x2C, 0x8C, 0xCE, 0x33, 0x52, 0x2F, 0x2A, 0x92,
-    0xA4, 0xC8, 0xF7, 0x8D, 0x38, 0x1C, 0x96, 0xD5, 0xB5, 0xD0, 0x85, 0x4F, 0xB5, 0xE7, 0x1C, 0x8A,
-    0xC7, 0xF8, 0x53, 0xD6, 0xE9, 0xCA, 0xF7, 0x01, 0xBE, 0xEF, 0x13, 0xAA, 0x37, 0xA1, 0x22, 0x86,
-    0x1C, 0xCF, 0x38, 0x5F, 0xA0, 0x0B, 0xB9, 0xDF, 0xC3, 0x55, 0x1F, 0xD7, 0xE9, 0xF4, 0x02, 0xF8,
-    0x96, 0x4A, 0xA4, 0xA1, 0x18, 0x99, 0x9C, 0x8C, 0x56, 0x83, 0xA7, 0xFF, 0xA3, 0xCD, 0xA8, 0xC8,
-    0x8A, 0x7C, 0xF2, 0xF2, 0x0D, 0xF1, 0x3F, 0x2E, 0x22, 0xEB, 0x1F, 0xEC, 0x94, 0x52, 0x4C, 0xDB,
-    0x03, 0x4B, 0xCA, 0xD2, 0x2D, 0x4B, 0xAE, 0xCE, 0xA5, 0x70, 0xB4, 0x32, 0x33, 0xB5, 0xFE, 0xE9,
-    0x5A, 0x6C, 0x7D, 0x56, 0xD0, 0x02, 0xCB, 0x68, 0xA1, 0xC5, 0xAE, 0x11, 0xDA, 0xAC, 0x06, 0x18,
-    0x82, 0x4F, 0xCE, 0xCE, 0xDA, 0x52, 0xEF, 0x52, 0x75, 0x97, 0xAF, 0x01, 0x67, 0x9F, 0xF3, 0xEE,
-    0xDC, 0xB4, 0x55, 0xB7, 0x27, 0x21, 0xA7, 0x2D, 0x4C, 0xC8, 0xA2, 0x6F, 0x85, 0x0B, 0xAA, 0xC0,
-    0x01, 0xF2, 0x4B, 0x0F, 0xEC, 0xA0, 0x52, 0x63, 0x78, 0x2D, 0x25, 0x4B, 0xD5, 0x3B, 0x89, 0x9F,
-    0x7A, 0xA1, 0x0D, 0xF6, 0xB0, 0xA9, 0x2B, 0xD1, 0x89, 0x09, 0x30, 0x3F, 0xE4, 0x81, 0x0E, 0xE4,
-    0xC6, 0x0C, 0xDA, 0x5A, 0x40, 0x63, 0x89, 0x46, 0x99, 0x4A, 0x31, 0x83, 0xB1, 0x09, 0xD6, 0x08,
-    0x7E, 0xCE, 0x68, 0xCF, 0x0F, 0xEE, 0x83, 0xC2, 0x7A, 0xEA, 0xAF, 0x53, 0x2A, 0x6A, 0x6B, 0xA4,
-    0x9C, 0xBF, 0x2B, 0xD6, 0xA3, 0x07, 0xB1, 0xF7, 0xE6, 0xAD, 0xAC, 0x6A, 0x45, 0xCD, 0xA6, 0x15,
-    0x55, 0xDB, 0x56, 0xE4, 0xE7, 0x65, 0xE9, 0xA2, 0xE0, 0x73, 0x75, 0xC9, 0x8A, 0x2A, 0xBE, 0x15,
-    0xB5, 0xDD, 0x4F, 0xFF, 0x36, 0x35, 0xA8, 0x54, 0x19, 0xAF, 0x18, 0xD6, 0x43, 0x23, 0x80, 0x46,
-    0x3A, 0x1A, 0x9C, 0x4E, 0x5E, 0x69, 0xD4, 0x5B, 0x79, 0x27, 0xB6, 0x93, 0xAF, 0xA3, 0xBF, 0x50,
-    0x72, 0x39, 0xFB, 0x49, 0x34, 0x5C, 0x1A, 0x90, 0x7F, 0x87, 0x7B, 0xD7, 0xE1, 0xD7, 0x44, 0x74,
-    0xD4, 0x7D, 0x9C, 0xF6, 0x23, 0x00, 0x94, 0x0C, 0xE2, 0x50, 0x87, 0x38, 0x64, 0x58, 0xDE, 0xA3,
-    0x2D, 0xF0, 0x07, 0xD7, 0x56, 0x0A, 0x15, 0xAC, 0x53, 0xA1, 0xC6, 0x77, 0x4B, 0x8D, 0x7A, 0x11,
-    0xE5, 0xDC, 0xE4, 0x95, 0xC9, 0x2B, 0xAD, 0xBC, 0x95, 0x97, 0xA0, 0x3D, 0x1C, 0x14, 0xCC, 0x23,
-    0x40, 0x9E, 0x17, 0x1A, 0x8C, 0x60, 0x8E, 0x71, 0xC2, 0x06, 0x45, 0x41, 0x75, 0x8A, 0xE4, 0x7F,
-    0xA2, 0x50, 0x16, 0xBF, 0x2A, 0x62, 0x17, 0x7D, 0x83, 0xD2, 0x0D, 0x3C, 0xA9, 0x3C, 0x33, 0xF5,
-    0x3E, 0x98, 0x6F, 0xB4, 0x34, 0xFA, 0x49, 0x8E, 0xB3, 0xCE, 0x65, 0x8D, 0x69, 0xD4, 0x8A, 0x5A,
-    0x7A, 0x5D, 0x47, 0xE9, 0x75, 0x45, 0xEB, 0x93, 0x8D, 0x3A, 0xB8, 0x2E, 0x96, 0x45, 0x20, 0xC0,
-    0x85, 0xB2, 0x68, 0x7F, 0x02, 0xA3, 0xAE, 0xBE, 0x4D, 0xF0, 0x98, 0x2B, 0xE9, 0xD3, 0x25, 0x97,
-    0xE5, 0xB7, 0x53, 0x78, 0xB3, 0x21, 0xBE, 0x86, 0x25, 0x80, 0x4A, 0xC8, 0x08, 0x63, 0x42, 0x65,
-    0x1E, 0x46, 0x48, 0x01, 0x5B, 0xE0, 0x7E, 0xD0, 0xE5, 0xC7, 0x2A, 0x89, 0x3F, 0x24, 0x55, 0xAE,
-    0x46, 0x17, 0xF2, 0x56, 0x28, 0xE5, 0x80, 0x0A, 0x44, 0x01, 0xA1, 0xC1, 0x0B, 0xDF, 0xE4, 0xF7,
-    0xB4, 0x5D, 0xD2, 0xA6, 0xA9, 0x8B, 0x7B, 0xA9, 0xB1, 0xD7, 0xB4, 0xC6, 0x1E, 0x48, 0x4F, 0xA3,
-    0x6D, 0x10, 0xC5, 0x30, 0x52, 0x7E, 0x4E, 0x36, 0x20, 0x62, 0x55, 0x2B, 0x71, 0x8B, 0x40, 0x69,
-    0xD9, 0xF1, 0x0F, 0xA5, 0x93, 0xD6, 0xD6, 0x20, 0xFF, 0x99, 0x15, 0x43, 0x31, 0x42, 0x97, 0xBF,
-    0x99, 0x18, 0x20, 0xB1, 0x64, 0xEE, 0x4F, 0x21, 0xC6, 0x74, 0x9D, 0x73, 0xFD, 0x51, 0x13, 0x5E,
-    0xBD, 0x9C, 0x9A, 0x89, 0x17, 0x41, 0x05, 0x17, 0x99, 0x37, 0xF0, 0x18, 0x27, 0x1B, 0x01, 0xC7,
-    0x4B, 0xC5, 0xEB, 0xC9, 0x9C, 0x2E, 0x30, 0xB3, 0x8C, 0xF6, 0x9A, 0x6C, 0x7E, 0xA7, 0x49, 0x33,
-    0x03, 0x26, 0xE7, 0x39, 0x2A, 0xA3, 0x2D, 0x81, 0x89, 0x89, 0xF5, 0xA4, 0xD3, 0x9C, 0x80, 0xD9,
-    0x5E, 0x51, 0x35, 0x3D, 0x8B, 0x99, 0x1B, 0x37, 0x42, 0xF7, 0xFD, 0xD8, 0x7D, 0xB3, 0x04, 0x9D,
-    0xCF, 0xF4, 0xDD, 0x16, 0x65, 0xAC, 0xD4, 0x44, 0x2D, 0xAC, 0xFF, 0x50, 0x33, 0x7D, 0xD6, 0x17,
-    0xEB, 0x9F, 0xE6, 0xC1, 0xD4, 0x36, 0xA0, 0xAF, 0x15, 0x3F, 0xE9, 0xDF, 0x49, 0xAD, 0xB8, 0xD5,
-    0xDB, 0xA3, 0xD7, 0x22, 0xED, 0xB7, 0xD1, 0xC7, 0xDC, 0xD4, 0x30, 0x39, 0xA0, 0x53, 0x7A, 0x93,
-    0xB1, 0x34, 0xA5, 0x73, 0x8F, 0x8A, 0x1D, 0x1E, 0xD7, 0x8A, 0xBD, 0x2B, 0x74, 0x7D, 0x0F, 0xD4,
-    0x8A, 0x58, 0x48, 0x7F, 0x2D, 0xD8, 0xB0, 0xC3, 0xD4, 0x0A, 0x72, 0x15, 0x91, 0xF2, 0x33, 0xB1,
-    0xB1, 0x38, 0xAD, 0x08, 0xDD, 0xB9, 0x6E, 0xC5, 0xA9, 0x15, 0xE5, 0x4E, 0xE8, 0xAB, 0xE5, 0x42,
-    0xCF, 0x13, 0x4B, 0xF5, 0x66, 0x32, 0xF0, 0x0F, 0x1A, 0x57, 0x62, 0xA7, 0xAD, 0x62, 0xEE, 0xF5,
-    0x4A, 0x75, 0xEE, 0xF5, 0xA7, 0xDD, 0xF5, 0xD4, 0xBA, 0x76, 0xFF, 0x01, 0x89, 0x69, 0x7D, 0x68,
-    0x6B, 0x45, 0x19, 0x5B, 0x59, 0xA7, 0x7E, 0x56, 0xE4, 0xFA, 0x90, 0x24, 0x3E, 0x24, 0x2A, 0xF1,
-    0xBF, 0x93, 0x49, 0xEC, 0x4B, 0xDB, 0x88, 0x60, 0xD8, 0x4C, 0x12, 0x1B, 0x72, 0xDE, 0x2E, 0x82,
-    0xD6, 0x77, 0xB2, 0x2D, 0xB3, 0x28, 0xE3, 0xFC, 0xD4, 0x6F, 0x60, 0xE0, 0x0E, 0x0C, 0x7A, 0xE8,
-    0x29, 0x81, 0x92, 0x51, 0x52, 0x14, 0xFD, 0x15, 0xD8, 0xCF, 0xD5, 0x9C, 0x1F, 0x97, 0x48, 0xAA,
-    0x43, 0x52, 0x81, 0xE9, 0x6F, 0x74, 0xA1, 0x24, 0x8B, 0xA4, 0x46, 0x53, 0x74, 0x74, 0x46, 0x48,
-    0x0E, 0x2A, 0x60, 0x84, 0xB4, 0xD6, 0xB7, 0xB4, 0x34, 0x90, 0x9D, 0x95, 0x06, 0x0F, 0x06, 0x3C,
-    0x2D, 0xCF, 0x0B, 0x4C, 0xD4, 0x97, 0xF3, 0x72, 0xD3, 0x92, 0x08, 0xD7, 0x92, 0x17, 0x02, 0x48,
-    0x04, 0x5B, 0x16, 0x24, 0xC4, 0xDC, 0xDE, 0x1C, 0x05, 0x5B, 0xC7, 0x6E, 0x19, 0x9F, 0xC3, 0xF2,
-    0x44, 0xCA, 0xF2, 0xD0, 0xA9, 0xA4, 0x6F, 0xC8, 0x7A, 0x59, 0xBF, 0x31, 0x00, 0xFB, 0x5E, 0x04,
-    0xEF, 0x22, 0x6F, 0xA5, 0x46, 0x66, 0x76, 0xAD, 0x4C, 0x39, 0x44, 0x8C, 0xCD, 0xBE, 0x0E, 0xBA,
-    0x04, 0xBA, 0x24, 0x35, 0xD0, 0x2A, 0xE8, 0x25, 0x94, 0x1A, 0x54, 0x8F, 0x0F, 0x30, 0x36, 0x8B,
-    0xBA, 0xD6, 0x22, 0x4C, 0x77, 0xF8, 0x71, 0xB4, 0x2E, 0xCE, 0x47, 0x7F, 0x19, 0xC7, 0x62, 0xDF,
-    0x7E, 0xF3, 0x57, 0x11, 0x16, 0xD7, 0xFA, 0x17, 0x00, 0x83, 0x7F, 0x34, 0x7F, 0x0D, 0xD7, 0xB5,
-    0xCB, 0x00, 0x8B, 0xC1, 0x4A, 0x19, 0x3B, 0x48, 0x81, 0xB5, 0xEB, 0xF2, 0x4E, 0x07, 0xF3, 0x8E,
-    0xF9, 0x6D, 0x82, 0xF5, 0xA0, 0xC4, 0xE6, 0xAC, 0xA4, 0x2A, 0x73, 0x80, 0x6B, 0xB0, 0x88, 0xA9,
-    0xCB, 0x3D, 0x37, 0x2F, 0x5C, 0x97, 0xA6, 0x1F, 0xC5, 0x32, 0xF7, 0xBB, 0x1F, 0x45, 0x52, 0xF9,
-    0x1F, 0x9F, 0x06, 0xE2, 0x7F, 0x04, 0x06, 0x70, 0xDF, 0xEB, 0x72, 0x08, 0x29, 0x63, 0x04, 0x62,
-    0x74, 0x02, 0x51, 0x31, 0xA9, 0x65, 0xF2, 0x56, 0x21, 0x0B, 0x15, 0x47, 0xDE, 0xA9, 0x58, 0xFA,
-    0x5C, 0xAD, 0x1F, 0x28, 0xDB, 0x51, 0xC1, 0x38, 0x2A, 0x2A, 0x76, 0x57, 0x2D, 0x4B, 0x45, 0x9D,
-    0xDB, 0x1A, 0xCF, 0x20, 0x27, 0xE1, 0xA8, 0xA2, 0x1A, 0x2D, 0xFF, 0xE5, 0x61, 0x28, 0x5F, 0xB9,
-    0x17, 0xEC, 0x3D, 0x7F, 0xAF, 0x2E, 0xD6, 0x43, 0x42, 0x2D, 0x7A, 0xA2, 0x83, 0x7F, 0xAC, 0x68,
-    0xEC, 0x85, 0x2D, 0x6E, 0x1C, 0x96, 0xC1, 0x2E, 0x08, 0x60, 0x60, 0xE7, 0xB2, 0x79, 0x35, 0xA1,
-    0xCF, 0x66, 0xE2, 0xDF, 0x8A, 0x8D, 0x84, 0x7E, 0x9F, 0x04, 0x26, 0x9D, 0x15, 0x19, 0x50, 0x2A,
-    0x32, 0x53, 0x2D, 0x8D, 0xB9, 0x3D, 0xFF, 0x41, 0x7D, 0x70, 0x66, 0x70, 0x4F, 0x24, 0xCA, 0x5B,
-    0x24, 0x65, 0x38, 0x08, 0x35, 0x65, 0xB2, 0x6E, 0x67, 0xD2, 0xBF, 0x1A, 0xA3, 0x15, 0x5F, 0xD9,
-    0x19, 0x85, 0x60, 0x00, 0x54, 0xE7, 0x7B, 0xD6, 0x23, 0xB4, 0x03, 0x1E, 0x67, 0xBC, 0xEE, 0x5D,
-    0x2B, 0xAE, 0xCA, 0x59, 0x2B, 0xAE, 0xB0, 0xD7, 0xCB, 0x30, 0x1F, 0x0F, 0x3B, 0x80, 0x94, 0xEA,
-    0x23, 0x2E, 0x80, 0xF8, 0x24, 0x5E, 0x70, 0xCA, 0x49, 0x9C, 0x7B, 0x1B, 0xAD, 0x9E, 0x51, 0xFA,
-    0x69, 0x62, 0x24, 0xE5, 0x96, 0xF5, 0xC8, 0x36, 0xD0, 0x04, 0xE7, 0xF3, 0xD5, 0xEA, 0xEE, 0x36,
-    0x50, 0xC0, 0xF9, 0x46, 0xB7, 0x7E, 0xFD, 0xFF, 0x31, 0x2B, 0x9F, 0x7E, 0x9A, 0x88, 0x79, 0xFB,
-    0x13, 0xF8, 0x9C, 0xEF, 0xC7, 0x50, 0x8B, 0x6F, 0xC6, 0x5D, 0x71, 0xAC, 0xB8, 0x29, 0x13, 0x6C,
-    0xA9, 0x06, 0x15, 0x1E, 0x14, 0xB7, 0x3F, 0x81, 0x1E, 0x1D, 0x0B, 0x34, 0x73, 0x93, 0xC9, 0xBF,
-    0x81, 0x06, 0x16, 0x50, 0x12, 0xB4, 0x71, 0x8F, 0x5E, 0xE2, 0xA6, 0x58, 0xFF, 0xD1, 0x17, 0xDB,
-    0x75, 0x83, 0x09, 0xD7, 0x0D, 0xA7, 0x5C, 0x3B, 0xAA, 0xB8, 0x4E, 0x52, 0xB8, 0x5E, 0x8E, 0x81,
-    0xD2, 0x7C, 0x95, 0x1B, 0xCF, 0xEC, 0x59, 0x4F, 0x1D, 0xCC, 0xCF, 0xD5, 0xC1, 0xFA, 0x2B, 0x75,
-    0xB0, 0x19, 0x14, 0x83, 0xC7, 0x0B, 0xEB, 0x80, 0xC3, 0x19, 0xAC, 0x96, 0xA9, 0x43, 0x57, 0xE6,
-    0x76, 0xE3, 0xCF, 0x1E, 0xD2, 0x79, 0x96, 0x19, 0xF8, 0xB9, 0x38, 0xAC, 0x43, 0xDF, 0xE3, 0x90,
-    0x64, 0x4B, 0xF4, 0xA8, 0xA3, 0x8C, 0x0E, 0xB9, 0x15, 0x65, 0x74, 0xD4, 0xAC, 0x10, 0x22, 0x65,
-    0x67, 0x6E, 0x94, 0x79, 0x51, 0xAD, 0x68, 0xA5, 0x59, 0x27, 0xC5, 0xD4, 0x5E, 0x81, 0x2C, 0xF7,
-    0xD8, 0x36, 0x16, 0xB1, 0xA7, 0xF4, 0xFB, 0xDF, 0x90, 0xDA, 0x2E, 0xE9, 0x69, 0x88, 0xAA, 0x75,
-    0xEF, 0x0F, 0xAE, 0x82, 0xE7, 0x1F, 0x76, 0x1E, 0xC5, 0x38, 0x33, 0xF3, 0x25, 0x3A, 0x15, 0x2F,
-    0xA4, 0x19, 0x68, 0x92, 0x6E, 0x88, 0xF5, 0x8B, 0x28, 0x6D, 0x8A, 0xF3, 0x69, 0x9C, 0x6E, 0x49,
-    0xEB, 0xF3, 0x34, 0x2D, 0x42, 0xB5, 0x1F, 0xAD, 0x08, 0x74, 0x99, 0x4B, 0x83, 0x73, 0x89, 0xF6,
-    0x66, 0x91, 0x8C, 0x8D, 0xD9, 0xB7, 0x19, 0xDE, 0x37, 0x1F, 0x11, 0x60, 0x33, 0xB6, 0xD1, 0x5B,
-    0xDA, 0x82, 0xF4, 0x34, 0xD9, 0xBF, 0x26, 0x7C, 0xD9, 0xA4, 0x89, 0x2E, 0xC6, 0x4D, 0x06, 0x44,
-    0x9A, 0x36, 0xF0, 0x59, 0xD3, 0x4A, 0xFC, 0xA0, 0x6F, 0x66, 0x3D, 0xBB, 0x88, 0xB6, 0x8C, 0x46,
-    0xE3, 0x0A, 0x24, 0x03, 0xF6, 0x0D, 0x23, 0x84, 0x51, 0xCC, 0x19, 0xE9, 0xAC, 0xD8, 0xC4, 0xB1,
-    0x13, 0x94, 0x72, 0x88, 0x84, 0xF1, 0xF0, 0x11, 0xFA, 0xF7, 0xAB, 0x34, 0x17, 0xFB, 0x56, 0x0A,
-    0x8F, 0xFD, 0xBD, 0x14, 0x3A, 0xF3, 0x72, 0x8A, 0x95, 0x32, 0x33, 0x2F, 0xE8, 0xB9, 0x7D, 0x07,
-    0xAC, 0x65, 0xA8, 0xAD, 0x02, 0x4C, 0xB9, 0x3A, 0xA2, 0xAE, 0x36, 0xB7, 0xA8, 0x4C, 0x02, 0x31,
-    0x57, 0x4D, 0xB7, 0x1B, 0x5C, 0xD2, 0xD3, 0x0E, 0xF1, 0x57, 0x8B, 0x91, 0x26, 0x7A, 0x6D, 0x1E,
-    0x45, 0x9A, 0xA1, 0x29, 0x0D, 0x98, 0xFA, 0xD6, 0xFC, 0x7C, 0xA0, 0xBE, 0xEF, 0xBB, 0x6A, 0x61,
-    0x72, 0x5F, 0x2F, 0x50, 0xE6, 0x73, 0x85, 0x20, 0x18, 0x3E, 0x00, 0x0A, 0x26, 0x3E, 0xF5, 0x55,
-    0x25, 0x60, 0x4B, 0x28, 0x0A, 0xAE, 0x40, 0x0D, 0xAA, 0x1A, 0x4B, 0xF0, 0xCD, 0x02, 0x0E, 0x33,
-    0xC0, 0x71, 0xA3, 0x01, 0xFE, 0xAE, 0x15, 0x64, 0x61, 0x1F, 0x9A, 0x1F, 0x6C, 0x1E, 0x7E, 0x9D,
-    0x2B, 0x11, 0xCF, 0x52, 0x30, 0xD1, 0xB8, 0x75, 0xAF, 0xD1, 0x89, 0xB9, 0x06, 0xC5, 0x16, 0x39,
-    0xDC, 0xC3, 0x4C, 0xC5, 0x4D, 0x8F, 0x62, 0xDA, 0xF6, 0x78, 0x5F, 0xE6, 0x59, 0xA9, 0xF3, 0x49,
-    0xEA, 0x5F, 0xCE, 0x5A, 0x9F, 0xC7, 0x45, 0xB2, 0xA5, 0x63, 0x6B, 0x58, 0xD4, 0x7F, 0xC1, 0xE4,
-    0xB4, 0x18, 0x72, 0x4C, 0xD4, 0x7E, 0x54, 0x13, 0x43, 0x24, 0x80, 0xBA, 0xA8, 0xBD, 0x1B, 0x1D,
-    0xDB, 0x46, 0x9F, 0x4C, 0xB0, 0xBB, 0xA1, 0xF6, 0xA3, 0x5A, 0x65, 0x8C, 0x9B, 0xDE, 0x81, 0x2A,
-    0x81, 0xBA, 0xEF, 0xDF, 0x74, 0x75, 0x08, 0x2A, 0xD0, 0xD1, 0xF0, 0x25, 0xE9, 0x04, 0xFE, 0x5A,
-    0x11, 0x8E, 0xDF, 0xB0, 0x95, 0x35, 0x1D, 0x93, 0xBA, 0xF5, 0x7E, 0x66, 0xDC, 0x17, 0xA3, 0x2F,
-    0x2E, 0x50, 0xD4, 0x30, 0x12, 0x83, 0x49, 0x58, 0x0B, 0x4D, 0x46, 0xF2, 0xB2, 0xDD, 0xD4, 0x05,
-    0x3B, 0x75, 0x8A, 0xB0, 0x1A, 0x00, 0xE6, 0xC9, 0x9C, 0xD9, 0xF5, 0x3B, 0x3D, 0xA3, 0xFE, 0x4A,
-    0xE7, 0x56, 0x11, 0x15, 0x30, 0x44, 0xAD, 0x80, 0x81, 0xB9, 0xAA, 0x0A, 0x1E, 0x1E, 0x4C, 0xED,
-    0x01, 0x65, 0x1C, 0x28, 0xA9, 0x62, 0x66, 0x8D, 0xAC, 0x4A, 0x1B, 0xDC, 0xEA, 0x50, 0x61, 0x8E,
-    0x75, 0x56, 0x86, 0xD1, 0xD6, 0x3D, 0xB4, 0x45, 0x75, 0x62, 0xE9, 0x3D, 0x90, 0xC5, 0xC7, 0xCA,
-    0x64, 0xB0, 0x78, 0xAE, 0x15, 0x2D, 0xC2, 0xF4, 0x2D, 0x56, 0xB1, 0xEC, 0x90, 0xD0, 0x45, 0xA7,
-    0x2C, 0xF6, 0xC8, 0x7B, 0x48, 0xFD, 0xE2, 0x94, 0x95, 0x2E, 0xBE, 0x2B, 0xFD, 0xFF, 0x93, 0x6A,
-    0x15, 0xB5, 0x28, 0x07, 0x97, 0xE1, 0x4E, 0xCB, 0xCE, 0x79, 0x6E, 0x74, 0xA1, 0xB7, 0x6A, 0xA7,
-    0xA5, 0xB6, 0x77, 0xA7, 0x65, 0x73, 0x0B, 0x4B, 0xD1, 0x59, 0xDB, 0x6E, 0x01, 0xAF, 0x40, 0xC7,
-    0xEF, 0xDB, 0x69, 0xA9, 0xA9, 0xBD, 0xE6, 0xC3, 0x76, 0x5A, 0x06, 0xFE, 0xBB, 0xA7, 0x6C, 0x40,
-    0x05, 0x2B, 0x3B, 0xAD, 0xFC, 0xF7, 0xCE, 0x8E, 0x2F, 0x9B, 0xF3, 0x85, 0x0C, 0x7C, 0xF7, 0x39,
-    0x15, 0xAF, 0x02, 0x78, 0x7E, 0x6F, 0xD7, 0x7F, 0xE7, 0x6E, 0x72, 0xE4, 0xC7, 0x52, 0x8B, 0xC1,
-    0xBA, 0xEF, 0x32, 0xA6, 0x4E, 0xB9, 0x06, 0xCE, 0xB4, 0x12, 0x83, 0x3C, 0xCC, 0x90, 0xAC, 0xDA,
-    0x28, 0xED, 0xD2, 0x92, 0x36, 0x69, 0x52, 0x2B, 0x14, 0xB2, 0x1A, 0x0D, 0xB6, 0xA7, 0x52, 0x2F,
-    0xFE, 0x90, 0x26, 0xFC, 0xE6, 0x20, 0x7A, 0xAE, 0xF7, 0x1F, 0x62, 0x9A, 0x6F, 0xD8, 0xBF, 0xC4,
-    0xEA, 0x7A, 0xA1, 0xF3, 0xFB, 0x6E, 0x38, 0x81, 0x95, 0x9A, 0x42, 0xCD, 0x97, 0x50, 0xF1, 0x2C,
-    0xD0, 0x0D, 0xE0, 0x40, 0x06, 0x38, 0xD0, 0x86, 0x6F, 0xD4, 0x8C, 0xB5, 0x23, 0xEA, 0x87, 0x65,
-    0x48, 0x57, 0xC1, 0x1F, 0x32, 0xE1, 0x06, 0x93, 0x68, 0x5E, 0x27, 0x64, 0x39, 0x6D, 0x0F, 0xC2,
-    0x95, 0x27, 0xD6, 0x5F, 0x95, 0x3A, 0xF2, 0x43, 0x68, 0xB8, 0xDB, 0x31, 0xCC, 0x03, 0x35, 0xF7,
-    0xC5, 0x12, 0x86, 0xBC, 0xC0, 0x38, 0x14, 0xC3, 0xE9, 0xC0, 0xA7, 0x95, 0xCD, 0xAB, 0x93, 0x54,
-    0x6C, 0x3A, 0xCF, 0x43, 0xD9, 0x1F, 0x72, 0x65, 0x46, 0xF8, 0x84, 0x85, 0xCE, 0x8B, 0xA4, 0x95,
-    0x60, 0xD5, 0xBB, 0xBE, 0x8A, 0x33, 0x4A, 0x9B, 0x28, 0x53, 0x1D, 0xC3, 0x33, 0xEA, 0xC8, 0xB6,
-    0xDB, 0x2A, 0x55, 0x63, 0x96, 0xDC, 0xD1, 0x65, 0xFB, 0xFC, 0x1E, 0xFB, 0xC0, 0x7A, 0x64, 0x23,
-    0xD1, 0xF5, 0xCE, 0x01, 0x0A, 0x86, 0x98, 0x97, 0x1A, 0xC6, 0x73, 0x17, 0xB2, 0x4B, 0x11, 0xEE,
-    0xF4, 0x74, 0x76, 0x96, 0xEA, 0x44, 0x79, 0x7C, 0xB5, 0x3C, 0xCE, 0x95, 0xC7, 0x32, 0xED, 0xCC,
-    0x2E, 0xCD, 0xA4, 0x92, 0x95, 0xEF, 0x5F, 0x6E, 0x04, 0x8D, 0xC0, 0x79, 0xF4, 0x65, 0x11, 0x76,
-    0x42, 0xF0, 0xD8, 0x32, 0x40, 0x24, 0xD8, 0xAC, 0x2A, 0x53, 0xE4, 0x34, 0x7A, 0x69, 0x60, 0x30,
-    0xF8, 0x21, 0x3C, 0x38, 0x11, 0xB7, 0x50, 0x3D, 0x2B, 0x4A, 0xD4, 0x21, 0xE1, 0xDE, 0xBF, 0x6F,
-    0x7C, 0x19, 0x29, 0xDE, 0xFB, 0x75, 0xA8, 0xD8, 0xAF, 0x25, 0x8A, 0x03, 0x6B, 0xA2, 0x98, 0x70,
-    0x5A, 0xB7, 0x74, 0x69, 0x4F, 0x3F, 0x6E, 0x0E, 0x31, 0x30, 0x43, 0xB4, 0xDA, 0x33, 0xD3, 0xDC,
-    0x1E, 0x0C, 0xD2, 0x37, 0x7C, 0x6A, 0xF9, 0x47, 0xD0, 0xF2, 0x4E, 0xBC, 0xC2, 0xF0, 0x2C, 0x11,
-    0x9B, 0xA8, 0xED, 0x53, 0x8C, 0x7C, 0x89, 0x36, 0x78, 0x89, 0x71, 0x95, 0xF6, 0x90, 0x2C, 0x95,
-    0xC4, 0x8D, 0xD4, 0x2D, 0xEA, 0x66, 0x7C, 0x8D, 0x5B, 0xD3, 0x01, 0x1C, 0x4B, 0x56, 0xA5, 0x05,
-    0x59, 0xED, 0x46, 0x09, 0x33, 0x11, 0x4E, 0x53, 0x74, 0x57, 0xA0, 0x35, 0xBB, 0xE2, 0xFD, 0x07,
-    0x4F, 0x6D, 0xA3, 0x36, 0xA1, 0x4F, 0x51, 0x62, 0x98, 0x8A, 0xA4, 0x2C, 0x31, 0x3F, 0x57, 0xC0,
-    0x17, 0xD3, 0xF4, 0xCE, 0xFF, 0xA6, 0xA5, 0xA2, 0xC9, 0x4A, 0x61, 0x8E, 0x29, 0xE1, 0x54, 0x43,
-    0x51, 0xB8, 0xC9, 0x7C, 0x8F, 0x9A, 0x49, 0xE1, 0xDE, 0xC1, 0x9E, 0x87, 0x4E, 0x2B, 0x9A, 0xD8,
-    0xE5, 0x96, 0x4E, 0x4C, 0xAF, 0xEB, 0x97, 0xE9, 0xE6, 0x3C, 0x01, 0xE0, 0x4D, 0x86, 0x26, 0xEA,
-    0x17, 0xA8, 0xEB, 0x44, 0xB5, 0x42, 0x5F, 0x77, 0x49, 0xB1, 0xED, 0x92, 0x42, 0x30, 0xED, 0x11,
-    0xBA, 0x34, 0xA4, 0x56, 0xBA, 0xAC, 0xA8, 0xFA, 0x56, 0x02, 0xA3, 0x8A, 0x59, 0x72, 0xB9, 0x95,
-    0x10, 0x39, 0xDB, 0x9D, 0x9D, 0x0E, 0xBA, 0x93, 0xB4, 0x86, 0xE1, 0x78, 0x9F, 0xEC, 0xF8, 0xE7,
-    0x74, 0x87, 0x56, 0xB8, 0x71, 0x60, 0xEE, 0xEE, 0x7C, 0xC5, 0xBB, 0x19, 0x8E, 0x18, 0xC2, 0x87,
-    0xE6, 0x87, 0xF0, 0x35, 0xBC, 0x35, 0xA9, 0x38, 0x7F, 0xEC, 0x84, 0x73, 0xE3, 0xAF, 0xD8, 0x0C,
-    0xF6, 0x5B, 0x9C, 0x5D, 0x8B, 0xF9, 0x8A, 0xA3, 0x44, 0x9D, 0x6B, 0xD2, 0x8D, 0xAD, 0xC8, 0x75,
-    0x27, 0xF4, 0xBE, 0x95, 0x03, 0xF6, 0x14, 0xD7, 0xBA, 0xBB, 0x49, 0x8D, 0xE4, 0xB0, 0x7B, 0xF7,
-    0x94, 0x24, 0x04, 0xC1, 0x6F, 0x01, 0x9F, 0xCB, 0xD7, 0x56, 0x6F, 0x60, 0xE2, 0xFF, 0xD7, 0xFF,
-    0x14, 0x39, 0x75, 0xEA, 0x94, 0x6E, 0xFF, 0x78, 0x30, 0xFB, 0xFE, 0x6D, 0x65, 0x1A, 0x69, 0x1F,
-    0x4E, 0x48, 0x55, 0x06, 0x46, 0x73, 0x77, 0x4B, 0x79, 0xF3, 0xE0, 0x6D, 0x65, 0xB1, 0x7A, 0xD0,
-    0x52, 0x2D, 0xF6, 0x75, 0x5F, 0xE1, 0x28, 0x5C, 0x58, 0xE9, 0xEF, 0x41, 0xE3, 0x27, 0x9E, 0x01,
-    0x58, 0x03, 0xD8, 0x15, 0x8C, 0xA6, 0x04, 0x36, 0x95, 0x63, 0x80, 0xCA, 0xDC, 0x7B, 0xA1, 0x89,
-    0x55, 0x75, 0x1E, 0x7B, 0x09, 0x87, 0x0B, 0xAF, 0x7C, 0x05, 0xD2, 0xC6, 0x2D, 0x02, 0x9F, 0xA9,
-    0x9B, 0x99, 0xA8, 0xE4, 0x47, 0xD7, 0x09, 0x17, 0x71, 0xA9, 0x85, 0x5A, 0x1C, 0x9C, 0x32, 0x31,
-    0x30, 0xEB, 0x73, 0xD8, 0xAD, 0x1F, 0x44, 0x4A, 0x67, 0xBC, 0x3C, 0xE4, 0x86, 0xF8, 0x77, 0x7E,
-    0x9A, 0x2C, 0xAF, 0x86, 0xAF, 0xE9, 0x4F, 0xF0, 0x30, 0xEE, 0xC5, 0xDF, 0x93, 0xFA, 0xB9, 0xE6,
-    0xE2, 0xEC, 0xCB, 0xE7, 0x2A, 0xAF, 0x5E, 0x7A, 0x07, 0xF8, 0xF7, 0xF7, 0x8A, 0x95, 0xEB, 0xE7,
-    0xB9, 0xCE, 0xE3, 0x65, 0xEE, 0x5C, 0x2D, 0xD3, 0xC7, 0xC5, 0x52, 0xDA, 0xCF, 0x9E, 0x1A, 0xD9,
-    0x88, 0x92, 0x16, 0xEE, 0xB2, 0x30, 0xC4, 0x87, 0xCC, 0xD8, 0x5B, 0x83, 0x64, 0x40, 0xAF, 0xBE,
-    0x62, 0x05, 0xF2, 0x94, 0x3F, 0x23, 0xD0, 0xD4, 0x53, 0x95, 0x7B, 0xD9, 0x37, 0x88, 0xE5, 0xE5,
-    0x1B, 0x7F, 0xF4, 0x8E, 0x72, 0x9B, 0x2F, 0xBC, 0xFC, 0xB4, 0xEF, 0x6B, 0x29, 0xAD, 0xEB, 0x40,
-    0xAC, 0xDD, 0x13, 0xE3, 0x0E, 0xA6, 0x63, 0xE2, 0x2A, 0x6A, 0xBC, 0x80, 0x99, 0x32, 0x47, 0xEF,
-    0xF4, 0x4A, 0xB5, 0x58, 0x2D, 0x65, 0x67, 0x61, 0x6A, 0x6F, 0x4D, 0x66, 0xD9, 0x59, 0xBB, 0x3C,
-    0x3A, 0xC1, 0xA8, 0xB6, 0x7D, 0x43, 0xA7, 0xF6, 0x81, 0x91, 0xA6, 0x55, 0x56, 0x1F, 0x85, 0x99,
-    0xD3, 0xCE, 0xB3, 0x35, 0xDA, 0x8C, 0xB0, 0x3C, 0xF7, 0xE4, 0xEE, 0x06, 0x25, 0x2D, 0x14, 0xBE,
-    0x01, 0x6C, 0x50, 0x9D, 0xEA, 0x24, 0x86, 0x0A, 0x33, 0x8E, 0xAD, 0xCB, 0x51, 0xFE, 0x38, 0xF1,
-    0xB4, 0x92, 0xD3, 0xA5, 0xFC, 0xA3, 0x0F, 0x80, 0x6C, 0x63, 0x01, 0xB9, 0x43, 0x99, 0x0E, 0x9D,
-    0x49, 0x59, 0x6E, 0xC5, 0xEE, 0xB7, 0x16, 0x97, 0xF6, 0xD4, 0x35, 0x45, 0x1D, 0x36, 0xC7, 0x6F,
-    0xF8, 0xD7, 0x7E, 0x23, 0xD9, 0x43, 0x5D, 0x29, 0x83, 0xCA, 0x1A, 0x5F, 0xAD, 0x0F, 0xB6, 0xEB,
-    0x75, 0xBE, 0x64, 0x70, 0x9C, 0x9B, 0x41, 0xE5, 0x60, 0x67, 0xB8, 0xD8, 0x65, 0x2B, 0xAC, 0x30,
-    0xA0, 0x92, 0x1C, 0x94, 0xAF, 0x6C, 0xD7, 0x01, 0xE2, 0x53, 0x19, 0x3D, 0xA7, 0x4A, 0xF1, 0x0F,
-    0xF4, 0x77, 0x43, 0x78, 0xB5, 0x31, 0xC1, 0xBF, 0xB9, 0xE7, 0x9F, 0xA1, 0xAF, 0x6B, 0x61, 0xAD,
-    0xF4, 0xA7, 0x5F, 0xD4, 0x27, 0xAF, 0xA1, 0x2D, 0xFB, 0xD0, 0xB6, 0xFE, 0x1E, 0x5E, 0xF9, 0xBF,
-    0xC7, 0xF9, 0x5A, 0x60, 0x16, 0x7D, 0x3A, 0x20, 0xE8, 0xBF, 0xB1, 0x67, 0x0C, 0xE4, 0x43, 0x86,
-    0xA1, 0x1B, 0x97, 0x3F, 0x94, 0xD6, 0xCF, 0x0B, 0x38, 0x45, 0x6E, 0x64, 0x27, 0x68, 0x21, 0x36,
-    0x13, 0x1B, 0x5A, 0xD9, 0x06, 0x6E, 0xD5, 0x85, 0xEF, 0xBF, 0x89, 0x56, 0xFE, 0x1E, 0xFD, 0xFF,
-    0x8B, 0xD8, 0xFE, 0xC7, 0x56, 0x68, 0x7F, 0x8C, 0xFB, 0x23, 0x2B, 0xC0, 0xF5, 0xC8, 0x2E, 0x43,
-    0x97, 0x6A, 0xE3, 0xA1, 0x3B, 0xD8, 0xCC, 0x37, 0xD5, 0x96, 0x04, 0x1D, 0x1B, 0x7B, 0xBB, 0x11,
-    0x3C, 0x36, 0x4F, 0x47, 0x2C, 0x83, 0x3E, 0xAA, 0x3F, 0xAC, 0xC8, 0xCC, 0x64, 0x23, 0x9B, 0x2F,
-    0x32, 0x9B, 0xEE, 0xE8, 0xA1, 0x2F, 0x74, 0xA4, 0x55, 0x30, 0x33, 0x27, 0xB6, 0xB7, 0xAF, 0x62,
-    0x0A, 0x64, 0x50, 0xEA, 0xA3, 0x55, 0x33, 0x64, 0xC7, 0x65, 0x7C, 0x5A, 0xD3, 0x93, 0x8D, 0x2B,
-    0xF3, 0x60, 0xEB, 0x78, 0xCE, 0x8A, 0xA7, 0xAC, 0xF8, 0x14, 0xEA, 0xFF, 0xCA, 0x3D, 0xD6, 0xFF,
-    0xEC, 0x2D, 0x9A, 0x8F, 0xEE, 0x8A, 0x89, 0x05, 0x35, 0x53, 0x87, 0xE1, 0x93, 0x8C, 0xDE, 0x23,
-    0xCA, 0x12, 0xBD, 0x4F, 0x16, 0xB4, 0x58, 0x45, 0x8B, 0xB4, 0x0B, 0x15, 0x15, 0x1A, 0x4B, 0x78,
-    0xDD, 0xC8, 0x8C, 0x1D, 0x40, 0xFF, 0x12, 0xF9, 0xA3, 0x37, 0x82, 0xEE, 0xA0, 0xD1, 0x39, 0x14,
-    0xA2, 0xD2, 0x53, 0x25, 0xB3, 0x70, 0xBB, 0x2A, 0xC7, 0xFB, 0x9A, 0x68, 0xF3, 0x43, 0xA6, 0x01,
-    0xB3, 0x60, 0x29, 0x5B, 0xC5, 0x60, 0x89, 0xB8, 0x5C, 0x4E, 0x68, 0x72, 0x57, 0x32, 0x83, 0xA0,
-    0xB4, 0x12, 0xEE, 0xA1, 0xF7, 0x60, 0x91, 0x5A, 0xB1, 0x93, 0x59, 0x85, 0xBC, 0xB1, 0x80, 0xEF,
-    0x01, 0x01, 0x5D, 0x62, 0xD5, 0xC2, 0x60, 0x03, 0x45, 0xCE, 0x81, 0xD3, 0x4F, 0x7E, 0x7D, 0x33,
-    0xA6, 0xB0, 0x19, 0xB7, 0x7F, 0xA1, 0x12, 0x95, 0x1F, 0xDD, 0xE7, 0xB2, 0xB8, 0xF7, 0x1F, 0x29,
-    0x64, 0xA6, 0xCC, 0xBF, 0x54, 0x55, 0x08, 0x86, 0x3B, 0x79, 0x3E, 0x0D, 0xAF, 0x45, 0xC0, 0x6E,
-    0xA5, 0x64, 0x29, 0xB1, 0xC9, 0xBD, 0xF0, 0x57, 0x22, 0x3B, 0x35, 0xBA, 0x00, 0x76, 0xB5, 0x3E,
-    0x63, 0xCC, 0xC3, 0xBC, 0xE7, 0xC7, 0x12, 0x41, 0xF6, 0x1E, 0x82, 0x7F, 0xCB, 0x5D, 0x87, 0xA0,
-    0x15, 0x75, 0x92, 0x5A, 0xBC, 0x08, 0xCB, 0xFC, 0xCF, 0xF1, 0xD9, 0x59, 0xD7, 0x8C, 0x02, 0x99,
-    0x72, 0x69, 0x2E, 0x1C, 0x15, 0x05, 0xB0, 0x1F, 0xD0, 0xB6, 0xD6, 0xD6, 0x98, 0xD0, 0xD8, 0x75,
-    0x2D, 0x7A, 0x87, 0x2E, 0x5D, 0x27, 0x18, 0xF1, 0x2E, 0xD1, 0x90, 0x2C, 0x73, 0x8B, 0x2B, 0xAC,
-    0x85, 0x7D, 0x29, 0x52, 0x47, 0x1B, 0x26, 0x4D, 0x17, 0x07, 0x0C, 0xB6, 0x8F, 0x6A, 0xD5, 0xFE,
-    0x1C, 0x1E, 0xF4, 0x05, 0x94, 0x9B, 0x78, 0x3F, 0xC8, 0xE8, 0xF4, 0x08, 0x7E, 0x2E, 0x95, 0x7A,
-    0x95, 0xB6, 0x82, 0x76, 0xA2, 0xA3, 0xF0, 0x07, 0x83, 0xF0, 0x35, 0x06, 0xE1, 0xA3, 0x9B, 0x25,
-    0x37, 0x45, 0xA7, 0xB7, 0xE4, 0x74, 0x47, 0x69, 0x03, 0x33, 0x5D, 0x37, 0x53, 0x28, 0x0E, 0xE8,
-    0x2A, 0x06, 0xE1, 0x13, 0xD5, 0x31, 0x3A, 0xCF, 0x2A, 0x88, 0x45, 0x25, 0x84, 0x46, 0xED, 0x1C,
-    0xC6, 0x18, 0x22, 0xFE, 0x3E, 0x59, 0x8B, 0xBC, 0xF6, 0x0A, 0xC9, 0x45, 0x92, 0x37, 0xA4, 0x8C,
-    0x60, 0x3C, 0x22, 0xCC, 0x7B, 0xA8, 0xE2, 0x4C, 0xB5, 0x32, 0x3E, 0xA7, 0xC2, 0x70, 0xD4, 0x1E,
-    0x2A, 0x4E, 0xC1, 0x98, 0x51, 0x4E, 0xAE, 0xDF, 0x62, 0xA5, 0xFE, 0xD0, 0x4F, 0x1A, 0xC9, 0x8A,
-    0x5A, 0x18, 0x12, 0x99, 0xBC, 0x62, 0xAC, 0xCC, 0xF7, 0x9C, 0xDC, 0x8A, 0x5F, 0x9F, 0xB5, 0xE2,
-    0x19, 0x46, 0x84, 0xC4, 0xFA, 0x04, 0xAB, 0x0D, 0x89, 0xB1, 0xEE, 0xD3, 0x3F, 0x23, 0x8F, 0x2E,
-    0x95, 0xFC, 0x08, 0x3F, 0x2A, 0x71, 0x92, 0x4E, 0xCF, 0xEC, 0x95, 0xBC, 0xFD, 0x6A, 0x19, 0xFE,
-    0x1D, 0x14, 0x36, 0xE9, 0x85, 0x76, 0x0E, 0x28, 0x8C, 0x6E, 0xFC, 0x22, 0x62, 0xC4, 0x4A, 0xCC,
-    0x7F, 0xFE, 0x36, 0x7A, 0xFA, 0xE5, 0xCF, 0x48, 0xFE, 0x1F, 0x09, 0xC1, 0xC9, 0x23, 0x45, 0x0A,
-    0x7E, 0xFC, 0x1C, 0xB7, 0x7C, 0xF9, 0x31, 0x86, 0xF0, 0xE5, 0xED, 0x04, 0x37, 0xFF, 0x40, 0xA9,
-    0x63, 0x15, 0x20, 0xDA, 0xE4, 0x38, 0x98, 0x1E, 0x02, 0x7B, 0x32, 0x79, 0x45, 0xBE, 0x3B, 0xDF,
-    0xB3, 0x7A, 0x60, 0xC6, 0xFF, 0x6C, 0x7D, 0x32, 0xF5, 0x92, 0xF5, 0x19, 0x7A, 0xFB, 0xD9, 0x75,
-    0xB1, 0x1E, 0xA0, 0xC7, 0xF7, 0xD1, 0xCB, 0xCF, 0xAA, 0x28, 0x3E, 0x7A, 0x4F, 0xEF, 0xC9, 0x89,
-    0x9D, 0xC4, 0xCA, 0xE0, 0x36, 0x75, 0xF6, 0xCD, 0x6C, 0xAD, 0x70, 0xA8, 0xF6, 0x8F, 0x61, 0x66,
-    0xA3, 0xBD, 0x3B, 0x48, 0x61, 0xA9, 0xF0, 0x8D, 0x15, 0xB4, 0xFE, 0xAC, 0xF3, 0xD9, 0x6D, 0x15,
-    0x99, 0x95, 0xFE, 0xD9, 0xFC, 0x8A, 0x9B, 0x2F, 0xF8, 0x32, 0x3B, 0x03, 0xCE, 0x5C, 0x67, 0x18,
-    0x01, 0x35, 0xFA, 0x14, 0x28, 0x9F, 0xC2, 0xE1, 0xD3, 0xA7, 0xF1, 0x29, 0x1A, 0xFE, 0x9A, 0x3A,
-    0x47, 0xAF, 0x87, 0x8F, 0x34, 0x95, 0xD9, 0x9D, 0x55, 0x12, 0x66, 0x4A, 0x11, 0x8E, 0xD4, 0x50,
-    0xB5, 0x55, 0x64, 0x46, 0x6F, 0xB2, 0x51, 0x7F, 0x59, 0x96, 0x3B, 0x49, 0x2B, 0x42, 0xCD, 0x7F,
-    0x17, 0xD5, 0xA7, 0xAD, 0x30, 0x90, 0x69, 0x3A, 0xD7, 0xD3, 0xD4, 0x0D, 0x3E, 0xDD, 0x46, 0x9F,
-    0xBE, 0xCD, 0x34, 0x05, 0x78, 0x9A, 0x95, 0x4E, 0xD3, 0x4B, 0xAB, 0x12, 0xB2, 0xB6, 0x82, 0x16,
-    0xE3, 0x2D, 0x9E, 0x8A, 0xB8, 0xE5, 0x58, 0xD7, 0x79, 0x6A, 0x43, 0x37, 0x3C, 0x9C, 0x30, 0x68,
-    0x68, 0x6E, 0x37, 0xAE, 0x85, 0x4F, 0xBE, 0x0F, 0xB3, 0xE8, 0x47, 0xAC, 0x54, 0x19, 0x9A, 0xEE,
-    0xD0, 0x7F, 0x54, 0xA8, 0xEC, 0x95, 0x21, 0x79, 0x69, 0xF2, 0xCA, 0x18, 0x03, 0x6B, 0x4E, 0x1F,
-    0x9A, 0x90, 0x2A, 0x20, 0x96, 0x3D, 0xE4, 0xDE, 0x77, 0x40, 0x1E, 0xAE, 0x3E, 0x7E, 0x81, 0xC4,
-    0x61, 0x8E, 0x72, 0xAB, 0xA7, 0xD3, 0x53, 0x88, 0xD0, 0x14, 0x6C, 0xD2, 0xC4, 0x0C, 0x77, 0x9F,
-    0x0B, 0x51, 0xD1, 0xC4, 0x98, 0x83, 0xFB, 0xB1, 0x1E, 0xDD, 0x28, 0x0D, 0x14, 0x95, 0x3D, 0x54,
-    0x3D, 0xAD, 0xA3, 0x06, 0x29, 0x07, 0x5C, 0x7D, 0x8C, 0xAA, 0xB1, 0x8A, 0x1E, 0x2C, 0xC7, 0x73,
-    0x85, 0xE3, 0xE9, 0x72, 0x3C, 0x97, 0xD8, 0xCF, 0x29, 0x92, 0x97, 0x9E, 0x69, 0x3C, 0x35, 0x9D,
-    0xF3, 0x08, 0x8B, 0xDC, 0x52, 0xC1, 0x78, 0xA5, 0xC4, 0x8E, 0x78, 0xD8, 0x52, 0xE1, 0xCE, 0xDA,
-    0x5A, 0xA6, 0x4F, 0x6E, 0xE9, 0x83, 0x1F, 0xA8, 0x83, 0x7A, 0xDA, 0xA6, 0x26, 0xB6, 0x3E, 0x58,
-    0xB1, 0x3E, 0x24, 0x18, 0x41, 0x2B, 0xB0, 0x92, 0x5A, 0x01, 0x5E, 0xD0, 0xBB, 0x7D, 0x52, 0x1E,
-    0x68, 0x8D, 0xA0, 0x05, 0xD4, 0xEC, 0xFA, 0x1A, 0x24, 0x7B, 0xEF, 0x6D, 0x0E, 0xB4, 0xED, 0x70,
-    0x73, 0xB8, 0xD1, 0x00, 0x9C, 0x63, 0xAA, 0xB3, 0xAE, 0xF3, 0x60, 0xBA, 0x4D, 0x4D, 0x69, 0x2A,
-    0xA3, 0x68, 0xA6, 0xBE, 0xA2, 0x34, 0x7E, 0x0C, 0x7E, 0x2B, 0x0A, 0x91, 0xB6, 0x33, 0x2B, 0x69,
-    0xF5, 0xFC, 0x42, 0xEF, 0xD4, 0xEB, 0x3E, 0x28, 0x7A, 0x9D, 0x1D, 0x31, 0x52, 0xE5, 0x9E, 0xEF,
-    0xFC, 0x89, 0xF2, 0xE2, 0xB2, 0x41, 0x00, 0x2F, 0x67, 0x00, 0x6F, 0xAA, 0x34, 0x50, 0x9E, 0x8C,
-    0x33, 0xDE, 0xD0, 0x82, 0x8D, 0x96, 0xAC, 0x49, 0xA3, 0x5D, 0x95, 0x36, 0x86, 0x46, 0xE2, 0x8F,
-    0x90, 0x25, 0x92, 0xAA, 0x05, 0x55, 0x50, 0x33, 0x53, 0x06, 0xF0, 0x72, 0x06, 0xF0, 0x36, 0x19,
-    0xC0, 0xAB, 0x29, 0x79, 0xBF, 0xC7, 0x06, 0x07, 0xFB, 0x1B, 0xDF, 0x0F, 0xC4, 0x7E, 0x14, 0x29,
-    0x9B, 0x51, 0x91, 0xEF, 0xC2, 0xFD, 0x7C, 0x20, 0x4D, 0xF7, 0xAD, 0xA8, 0xED, 0xD9, 0x28, 0x96,
-    0x2A, 0x4D, 0xBC, 0x9F, 0xC3, 0xB9, 0x69, 0xE7, 0xE7, 0x81, 0xFB, 0x3E, 0xF3, 0xD6, 0xFA, 0x40,
-    0xFD, 0xA7, 0x57, 0x8E, 0xC1, 0xE5, 0x8C, 0xAD, 0x5E, 0x99, 0xC9, 0x4C, 0xDE, 0x56, 0x50, 0x3A,
-    0xD5, 0x85, 0xFB, 0x71, 0x74, 0xB2, 0x9E, 0xEE, 0x72, 0xBE, 0xE6, 0xDE, 0x4B, 0x19, 0xD3, 0x99,
-    0x53, 0x11, 0x0D, 0x47, 0x19, 0xB8, 0x82, 0x66, 0xAD, 0x55, 0x14, 0xF9, 0xD2, 0xB5, 0x3B, 0x1B,
-    0x0B, 0x3A, 0x33, 0xFA, 0x52, 0xDD, 0x89, 0xCE, 0xC9, 0x33, 0x3E, 0x8D, 0x62, 0xA8, 0xE7, 0xCE,
-    0x96, 0xCB, 0x3D, 0xCC, 0x89, 0xB2, 0x9C, 0x1E, 0x30, 0x47, 0x80, 0x36, 0xA2, 0x05, 0xCF, 0x44,
-    0x91, 0xA8, 0xEE, 0x49, 0xA8, 0x18, 0xE9, 0xB0, 0x52, 0x0B, 0x75, 0x94, 0xA6, 0x7C, 0x28, 0x6E,
-    0x37, 0x47, 0x45, 0xC7, 0xFC, 0x6A, 0x7D, 0xBB, 0x08, 0xDD, 0x14, 0x8C, 0x0D, 0x55, 0x36, 0x4B,
-    0xBB, 0xBE, 0x40, 0x05, 0x83, 0x89, 0x58, 0x1A, 0x6A, 0x52, 0xF7, 0x2D, 0xE2, 0x95, 0x9F, 0x0D,
-    0xB6, 0x90, 0x8C, 0xF4, 0x49, 0x44, 0xDD, 0x52, 0x03, 0x36, 0x28, 0x37, 0x4A, 0x33, 0x2F, 0xB4,
-    0x42, 0xD8, 0x18, 0xD1, 0x1B, 0xA5, 0x67, 0x20, 0x1F, 0x53, 0xB8, 0x13, 0xAD, 0x67, 0xB0, 0xE9,
-    0x6D, 0xB4, 0xD6, 0x4C, 0xCA, 0x68, 0x62, 0xB9, 0x99, 0xB9, 0xBF, 0xE0, 0x3C, 0xB4, 0xE9, 0x73,
-    0xF7, 0x54, 0xC5, 0xD0, 0x54, 0x14, 0xE6, 0xB8, 0x7B, 0x6A, 0x71, 0x9D, 0x0E, 0xE8, 0xE9, 0xFE,
-    0x94, 0xF0, 0xEC, 0xC9, 0x29, 0xE1, 0x7C, 0xE7, 0xAA, 0x94, 0x70, 0x32, 0xEB, 0xCC, 0x9E, 0x94,
-    0x70, 0x7B, 0x4F, 0x4A, 0x78, 0x34, 0xC8, 0x23, 0x56, 0x4E, 0xAB, 0x82, 0x8E, 0x1A, 0x38, 0x46,
-    0x47, 0x4F, 0x7C, 0x5A, 0xD8, 0x93, 0xF8, 0x14, 0x17, 0xA9, 0x62, 0x8E, 0x8D, 0x7D, 0x8C, 0xA1,
-    0x98, 0x03, 0x7C, 0xF6, 0xC3, 0x22, 0x5E, 0x9A, 0xBF, 0x7A, 0xAB, 0x1F, 0x2C, 0x50, 0x2E, 0x85,
-    0x5C, 0xD7, 0x96, 0xBA, 0x67, 0x50, 0x28, 0x54, 0x94, 0xFE, 0x85, 0x68, 0xAD, 0xD1, 0xD8, 0x52,
-    0x8F, 0x5D, 0x69, 0xE5, 0xA7, 0x63, 0xB1, 0xC6, 0xE3, 0x09, 0x45, 0xD7, 0x07, 0x8A, 0xF1, 0xCA,
-    0x64, 0xA3, 0x55, 0xF4, 0xFD, 0xFE, 0x42, 0x65, 0xC2, 0x4A, 0x16, 0x2A, 0xA7, 0xAD, 0xB8, 0x5E,
-    0x19, 0x83, 0x46, 0xAB, 0xC8, 0x53, 0xC9, 0x26, 0x54, 0x91, 0x6A, 0x4A, 0xCA, 0x4C, 0x37, 0xED,
-    0xEB, 0x3B, 0x43, 0xA2, 0x83, 0x11, 0x65, 0x06, 0xBC, 0x3C, 0x29, 0x03, 0x3E, 0x1E, 0x64, 0xC0,
-    0x9B, 0x3B, 0x4C, 0x1A, 0xE9, 0xF4, 0xA1, 0x60, 0xC6, 0xEA, 0x87, 0x66, 0xC0, 0xB7, 0x74, 0x06,
-    0xFC, 0x60, 0x1B, 0x56, 0x23, 0xCB, 0x05, 0x1D, 0x27, 0x19, 0x90, 0xB3, 0x0D, 0x9D, 0x30, 0xB6,
-    0xA3, 0x53, 0xA1, 0x77, 0x8B, 0xFA, 0xBF, 0xD7, 0x8A, 0xCC, 0xE2, 0xB3, 0x48, 0xCE, 0xED, 0x7A,
-    0x34, 0xA5, 0xE3, 0x79, 0x28, 0xB2, 0x7C, 0x42, 0x26, 0xFF, 0x59, 0x92, 0x75, 0x66, 0xF2, 0x93,
-    0xA4, 0xEB, 0xCC, 0xE4, 0xFF, 0xDF, 0xC3, 0x4C, 0xFE, 0x8C, 0x7D, 0x5E, 0xDF, 0x4B, 0xCE, 0x8E,
-    0x66, 0xF2, 0x1F, 0x98, 0xDA, 0x76, 0xFB, 0xAD, 0xD0, 0x46, 0xB1, 0x7E, 0x7D, 0x4D, 0xA7, 0xB6,
-    0xD9, 0x6F, 0x01, 0xC0, 0x95, 0xA5, 0x4C, 0x6D, 0xE3, 0xBE, 0xAF, 0xDA, 0xF5, 0xD5, 0xD3, 0xF0,
-    0x18, 0x19, 0x23, 0xB8, 0x2D, 0xE8, 0x57, 0x30, 0x75, 0x1D, 0x40, 0x96, 0x17, 0xFC, 0xC3, 0x09,
-    0xB1, 0x6E, 0x48, 0x1B, 0x9B, 0x0D, 0xF2, 0x0A, 0x47, 0x67, 0xC7, 0xBE, 0xF5, 0xA1, 0xD8, 0x74,
-    0xEF, 0x21, 0xD5, 0x76, 0xC2, 0x59, 0xB4, 0x9E, 0x58, 0x00, 0xFF, 0x92, 0x4E, 0xD7, 0x1A, 0x84,
-    0x6D, 0x5B, 0xDC, 0x93, 0xDE, 0x9E, 0x0F, 0x55, 0xC2, 0x3B, 0x0C, 0x87, 0xB2, 0xEC, 0x46, 0x36,
-    0x8B, 0x89, 0xC8, 0x37, 0x96, 0x48, 0xC0, 0xBE, 0x5D, 0x02, 0x8B, 0xEE, 0x78, 0x7F, 0x75, 0xF5,
-    0x27, 0xFA, 0xE9, 0xD9, 0xA5, 0xE1, 0x9A, 0xD7, 0xCA, 0x5C, 0x26, 0x65, 0x70, 0xD6, 0xC5, 0xEA,
-    0x5F, 0x55, 0xDB, 0x58, 0x83, 0x3D, 0x1F, 0x3E, 0x7B, 0xFE, 0x20, 0xA2, 0xFF, 0xFB, 0x5A, 0x53,
-    0xB2, 0x9B, 0x1B, 0xA8, 0x2F, 0x97, 0x9C, 0x4F, 0xD5, 0x8C, 0xED, 0xC0, 0xD5, 0xCD, 0x4A, 0x75,
-    0xDD, 0x56, 0xAB, 0xFB, 0x86, 0x78, 0x3F, 0x66, 0x7E, 0x44, 0x38, 0x1A, 0x41, 0x7C, 0xFE, 0xFE,
-    0x2D, 0x0F, 0xFB, 0xE7, 0x1F, 0xD4, 0x3F, 0xA5, 0x98, 0x14, 0x48, 0x18, 0x51, 0x32, 0x83, 0xA6,
-    0x9F, 0xBB, 0xE3, 0xDD, 0x32, 0x41, 0x72, 0x66, 0xA4, 0x28, 0xF7, 0xC7, 0xCE, 0xF5, 0x76, 0xF3,
-    0x91, 0x5E, 0x5C, 0x72, 0x72, 0xD1, 0x29, 0x1D, 0x09, 0xAD, 0x68, 0x44, 0xE3, 0x5F, 0x55, 0xEA,
-    0x6F, 0xBC, 0x3F, 0x12, 0xBE, 0xFC, 0xED, 0x3E, 0x0F, 0x39, 0xCE, 0x07, 0x70, 0x5D, 0x85, 0x28,
-    0x98, 0xCE, 0x6F, 0x6C, 0x95, 0xEB, 0x7E, 0x3C, 0x79, 0xE6, 0x47, 0x77, 0x7E, 0xB9, 0x67, 0xDF,
-    0xEF, 0xA8, 0x8D, 0xF9, 0x5C, 0x3B, 0x88, 0x8A, 0x4F, 0xF8, 0x8B, 0x06, 0x7A, 0xD3, 0x5F, 0x11,
-    0xCC, 0xAA, 0x4B, 0xA7, 0x71, 0xF7, 0x49, 0x13, 0x8F, 0xA1, 0x81, 0x2A, 0xAD, 0x02, 0x3A, 0xB4,
-    0x3C, 0xCE, 0xC8, 0xED, 0x80, 0xFB, 0x94, 0x07, 0x9C, 0xBB, 0x99, 0x15, 0x57, 0x16, 0xAD, 0x78,
-    0xE1, 0xAC, 0x15, 0xC3, 0x79, 0xFF, 0x14, 0x82, 0x5E, 0xDC, 0xE5, 0x6E, 0x3D, 0x23, 0x30, 0xB1,
-    0x86, 0x9F, 0x98, 0xA6, 0x58, 0x72, 0x68, 0xA9, 0x1C, 0x5A, 0x6A, 0x00, 0x40, 0x32, 0x79, 0x03,
-    0xB6, 0xF7, 0x26, 0x00, 0xE9, 0x12, 0x8C, 0x92, 0xB7, 0x23, 0x27, 0xF6, 0x10, 0xE3, 0xF0, 0x61,
-    0x68, 0x05, 0xF0, 0x14, 0x1B, 0x2B, 0x57, 0x46, 0x45, 0xAA, 0x0D, 0x79, 0xCE, 0x1C, 0xF6, 0xBC,
-    0x54, 0xD8, 0xEB, 0xBA, 0x72, 0xA3, 0xCC, 0x61, 0x34, 0xE4, 0x04, 0x3C, 0xBE, 0xC7, 0x17, 0xE5,
-    0x82, 0x5E, 0x14, 0x80, 0xD0, 0xE5, 0x6F, 0x61, 0x7C, 0xE7, 0x81, 0xA7, 0x5F, 0xCC, 0xE3, 0x03,
-    0x81, 0x26, 0xC9, 0x86, 0x56, 0x09, 0xE4, 0x2C, 0xB1, 0xD1, 0x3A, 0x25, 0x6B, 0xF3, 0x3C, 0x75,
-    0x77, 0x4F, 0xE4, 0xC4, 0xBC, 0x59, 0x25, 0xB1, 0x67, 0x86, 0x71, 0xF6, 0xDD, 0x40, 0xB7, 0xEA,
-    0x4C, 0xFD, 0xB9, 0xB3, 0xFC, 0x35, 0x7E, 0x99, 0x29, 0xD7, 0x29, 0x2D, 0x31, 0x45, 0x70, 0x02,
-    0xB6, 0xBD, 0xA3, 0x9E, 0x54, 0x4A, 0xB5, 0x35, 0xD6, 0xBC, 0xB5, 0x8B, 0x28, 0x4E, 0x97, 0xDA,
-    0xE8, 0xF9, 0x6D, 0xFB, 0x46, 0x39, 0x84, 0xF5, 0x12, 0x04, 0x69, 0x20, 0x54, 0xCB, 0xB9, 0xC1,
-    0xC4, 0x07, 0xFF, 0x3B, 0x2B, 0xDC, 0xB6, 0x2A, 0xC4, 0x7C, 0x20, 0xF2, 0x39, 0x33, 0xA8, 0xF8,
-    0xFA, 0x79, 0x68, 0x5D, 0x13, 0xF3, 0xE3, 0xC8, 0x86, 0x90, 0xDF, 0x8E, 0x1D, 0xD2, 0xE4, 0x0C,
-    0xE8, 0xAD, 0x74, 0x0A, 0x34, 0xCA, 0x66, 0x49, 0xDB, 0x33, 0xA4, 0xCD, 0x05, 0xD2, 0x4A, 0x42,
-    0xEA, 0xC7, 0xA4, 0x98, 0x43, 0x61, 0x1A, 0x92, 0x1F, 0xD6, 0x72, 0x47, 0x74, 0xBC, 0x41, 0x2F,
-    0x4C, 0xA9, 0xB3, 0xF5, 0xAE, 0x4B, 0x3A, 0x82, 0xD4, 0x82, 0x63, 0x79, 0xA6, 0x63, 0x77, 0xAB,
-    0x63, 0x61, 0xD8, 0x4C, 0xB2, 0x9B, 0xB0, 0xF0, 0x9C, 0xA6, 0xE2, 0x1C, 0x37, 0xAA, 0x9A, 0x14,
-    0xD1, 0xEA, 0x35, 0xEA, 0xFC, 0x9D, 0xA1, 0x89, 0x38, 0xE0, 0xD7, 0x11, 0x9C, 0xE1, 0xAF, 0x23,
-    0x4C, 0x0D, 0x7F, 0x1D, 0x61, 0xE6, 0xA0, 0x5F, 0x47, 0x90, 0x27, 0xFC, 0x3A, 0xC2, 0x98, 0xAC,
-    0x60, 0x4C, 0xEE, 0x5F, 0x27, 0xA6, 0xB2, 0xF6, 0xB0, 0x98, 0xEE, 0xFD, 0xD8, 0xDF, 0xF7, 0xA0,
-    0xD6, 0x8F, 0xF8, 0xA0, 0x56, 0x5B, 0xB2, 0x0D, 0x50, 0x33, 0xAB, 0x0E, 0x1F, 0xD4, 0x3A, 0x35,
-    0x4E, 0xC6, 0xA2, 0xB8, 0x4F, 0xBB, 0x7B, 0xB7, 0x03, 0x4F, 0xAA, 0xBB, 0x3A, 0x27, 0xDC, 0x79,
-    0x3F, 0x1E, 0x1A, 0xF8, 0x67, 0xE8, 0xAE, 0x68, 0xE4, 0x3E, 0xBD, 0xFD, 0x76, 0xAA, 0x52, 0x00,
-    0x41, 0xFF, 0x34, 0xE5, 0xD2, 0xFD, 0x2A, 0x95, 0xB3, 0x62, 0xDC, 0x52, 0x50, 0xE2, 0x3D, 0xE5,
-    0xE9, 0x28, 0x8F, 0x6B, 0x82, 0x09, 0x3F, 0x32, 0x65, 0x6C, 0x37, 0xD0, 0x5D, 0x05, 0xFB, 0x3A,
-    0x4A, 0x4F, 0x27, 0xBC, 0x6A, 0x32, 0x61, 0xE8, 0x25, 0x2B, 0x00, 0xBD, 0xE8, 0x70, 0x09, 0x67,
-    0xFD, 0xC0, 0xDA, 0x6E, 0xE4, 0x45, 0x4A, 0x78, 0x61, 0xDC, 0x50, 0x5D, 0xFB, 0xFC, 0x41, 0xE4,
-    0x1B, 0x7D, 0x33, 0xE5, 0x46, 0x79, 0x46, 0x93, 0xA2, 0x1E, 0x7C, 0xC9, 0x8D, 0x35, 0xD8, 0x6D,
-    0xFF, 0x47, 0x80, 0x20, 0x4D, 0x9D, 0xF1, 0x9D, 0x53, 0x76, 0xC0, 0x52, 0x6D, 0xC8, 0xC7, 0x85,
-    0xEA, 0x35, 0xE0, 0x10, 0xAF, 0x3B, 0x44, 0x50, 0xF5, 0x53, 0xC2, 0x6D, 0x6E, 0xD9, 0x61, 0xE2,
-    0xF7, 0xDD, 0xC1, 0x03, 0xCD, 0xB1, 0xBD, 0xFD, 0x76, 0xC2, 0x44, 0xC2, 0xB2, 0xEC, 0xDD, 0xC4,
-    0x40, 0xC7, 0xCD, 0xED, 0x2B, 0xFB, 0xB7, 0x4B, 0xCE, 0x32, 0x0D, 0x91, 0xC5, 0xDE, 0x6E, 0x64,
-    0xA8, 0x23, 0x83, 0xE5, 0x87, 0xDD, 0x77, 0xFF, 0x3A, 0x35, 0xB5, 0xCD, 0xFF, 0x9E, 0x38, 0x0F,
-    0x62, 0x15, 0x49, 0xC8, 0x9B, 0xFC, 0x09, 0x9E, 0x66, 0xA7, 0xE8, 0x6E, 0x36, 0xAE, 0x0C, 0x23,
-    0x09, 0xBE, 0x9C, 0x73, 0xEF, 0x64, 0xE6, 0xF0, 0x39, 0x45, 0x13, 0x00, 0xD8, 0xFD, 0xA2, 0x00,
-    0x46, 0x21, 0xE2, 0xB0, 0xCB, 0x24, 0x3C, 0x63, 0x80, 0xAB, 0xF2, 0x0E, 0xC6, 0xB9, 0xB5, 0xBA,
-    0xDA, 0x25, 0xBA, 0x43, 0x0D, 0xF9, 0x12, 0xAE, 0x55, 0x44, 0xC5, 0x7F, 0xF8, 0x70, 0x44, 0x64,
-    0x27, 0x2D, 0xE5, 0x82, 0xAA, 0xB5, 0xFC, 0x09, 0xCD, 0xF6, 0xAC, 0x9D, 0x9C, 0xD5, 0x53, 0xA5,
-    0xE2, 0x17, 0xAA, 0xFD, 0x76, 0x9B, 0x7D, 0xC9, 0x2B, 0x92, 0xFA, 0xDF, 0x4E, 0x6C, 0x1D, 0x95,
-    0xA9, 0xBF, 0x86, 0x49, 0xC1, 0x1D, 0x69, 0x73, 0x77, 0x93, 0xF7, 0x18, 0x3B, 0x33, 0x6E, 0x06,
-    0xEE, 0xB7, 0xA3, 0xE1, 0xB3, 0x07, 0xCF, 0xD6, 0x37, 0x79, 0x59, 0xEF, 0x37, 0x7B, 0x7A, 0xD3,
-    0xC4, 0x73, 0xC2, 0xFD, 0xBB, 0xBC, 0xBF, 0x65, 0xC0, 0x67, 0x5E, 0x66, 0xFD, 0xB7, 0xF9, 0xE8,
-    0xEB, 0xFB, 0xA3, 0x8F, 0x9C, 0x1E, 0x0F, 0xE0, 0x33, 0x83, 0x15, 0xB1, 0x3F, 0x82, 0x4E, 0xFB,
-    0x68, 0x18, 0x23, 0x3C, 0xD6, 0xDF, 0xDB, 0x30, 0x1F, 0xD3, 0x01, 0x47, 0x7F, 0x8E, 0xD1, 0x87,
-    0x11, 0xF7, 0x31, 0x82, 0x39, 0xC0, 0xFB, 0xD7, 0xA8, 0xB0, 0x39, 0xD3, 0x13, 0x65, 0x7C, 0x9A,
-    0xDC, 0xC2, 0x36, 0xC6, 0xBB, 0xA3, 0x11, 0xB8, 0x83, 0x77, 0x89, 0xCE, 0x29, 0xFF, 0xBE, 0x56,
-    0xE4, 0xD5, 0xD5, 0xF4, 0x0D, 0x33, 0xBE, 0x60, 0x07, 0xAC, 0x66, 0x8E, 0x95, 0x98, 0x3B, 0x62,
-    0x10, 0xC5, 0x66, 0x23, 0x21, 0x38, 0xBC, 0x9A, 0x80, 0x7F, 0x99, 0x64, 0x9B, 0xE7, 0x63, 0x3E,
-    0x57, 0xA3, 0x10, 0xEA, 0xD7, 0x56, 0x83, 0x13, 0xFF, 0x09, 0x21, 0xF5, 0xB0, 0xC9, 0x4F, 0x5E,
-    0x6C, 0xAF, 0xFD, 0x65, 0x26, 0x5B, 0xF8, 0x54, 0xD8, 0x7B, 0x79, 0xF9, 0x04, 0xBB, 0xFD, 0xCE,
-    0x6B, 0xC2, 0x08, 0xEE, 0xA8, 0x7C, 0x3F, 0x77, 0xF7, 0x5F, 0x63, 0x52, 0x45, 0x93, 0x4C, 0xD5,
-    0x9C, 0xDE, 0x23, 0x86, 0x87, 0x65, 0x7F, 0x56, 0x8F, 0xF8, 0x3B, 0x1B, 0x4F, 0xCE, 0xFE, 0x34,
-    0x83, 0x50, 0x09, 0xD9, 0xA8, 0x1C, 0xA8, 0x8C, 0xD0, 0x47, 0x8F, 0x67, 0x84, 0x8E, 0x96, 0xC3,
-    0x32, 0x42, 0x8F, 0x9A, 0xB1, 0xAA, 0x3A, 0xC9, 0x1F, 0xF2, 0x91, 0xCD, 0x46, 0x63, 0xFE, 0x78,
-    0x32, 0x56, 0xB7, 0x56, 0xD7, 0x50, 0x3A, 0x4F, 0xEE, 0xDF, 0x6B, 0x2F, 0x0F, 0xE6, 0x79, 0xCE,
-    0x3B, 0xD2, 0x3C, 0x1F, 0x4F, 0x9F, 0x39, 0xCF, 0xFB, 0xF5, 0xCD, 0x8B, 0x8C, 0xE3, 0x60, 0xFD,
-    0x75, 0x7C, 0x8F, 0xF7, 0x8F, 0x1B, 0xC1, 0xE8, 0x73, 0x6D, 0xCF, 0xF4, 0x54, 0x1F, 0x33, 0x18,
-    0x44, 0x7E, 0x67, 0xF5, 0x37, 0xF3, 0x3B, 0x60, 0xFB, 0x94, 0xC7, 0xE0, 0x41, 0xA2, 0x10, 0x3E,
-    0x11, 0x6E, 0x77, 0x55, 0xD4, 0x59, 0x3F, 0x48, 0x34, 0xBB, 0xFB, 0x20, 0x51, 0x65, 0xDF, 0x83,
-    0x44, 0x4E, 0x19, 0xBB, 0x7C, 0x5D, 0x2B, 0xFB, 0xF1, 0x54, 0x27, 0x55, 0xC9, 0xB9, 0x43, 0xB8,
-    0xE5, 0xA4, 0xC7, 0x34, 0xD0, 0x2C, 0xD9, 0xDC, 0xA8, 0x66, 0x39, 0xDE, 0xB1, 0x69, 0x9E, 0xA1,
-    0x81, 0x75, 0xDF, 0xC2, 0xAD, 0xAF, 0xF3, 0x9E, 0x99, 0x8B, 0xBF, 0xA1, 0x01, 0x0E, 0xF2, 0xA5,
-    0x89, 0xC9, 0xDF, 0x85, 0xFC, 0x5C, 0x5F, 0x3C, 0x99, 0x41, 0x8E, 0x13, 0xE5, 0x00, 0x25, 0x81,
-    0xD8, 0xD1, 0x68, 0xB0, 0xEF, 0xC4, 0x7E, 0x95, 0x45, 0xDE, 0x81, 0xD9, 0x05, 0xD6, 0x1A, 0x5D,
-    0xBB, 0xE7, 0x7D, 0x74, 0xB9, 0xCC, 0x03, 0x3A, 0x1C, 0x42, 0x1F, 0x35, 0xE9, 0x89, 0xBB, 0x15,
-    0x7C, 0xC8, 0x82, 0xCB, 0xC6, 0x3D, 0xE7, 0x32, 0xFA, 0xF8, 0x78, 0x46, 0xD2, 0x01, 0x39, 0x50,
-    0xA9, 0x92, 0x67, 0x5F, 0xCD, 0xAF, 0xA3, 0x62, 0xFA, 0x3A, 0xAC, 0x6F, 0x84, 0x75, 0x95, 0x20,
-    0xAC, 0x3C, 0xA8, 0x38, 0xDD, 0x0B, 0x1E, 0x7F, 0x93, 0x3F, 0x91, 0xA2, 0xA1, 0xAC, 0x02, 0xB2,
-    0x7B, 0x17, 0xF9, 0x78, 0x9E, 0x7D, 0x3E, 0x9E, 0xF4, 0xAF, 0x48, 0x4F, 0xBC, 0x59, 0x2E, 0x02,
-    0xD3, 0x1D, 0x96, 0xE5, 0xE8, 0x29, 0x61, 0x81, 0x58, 0xEA, 0x65, 0xAB, 0x3D, 0xD1, 0xF6, 0xC9,
-    0xED, 0x87, 0xA9, 0xE7, 0x5B, 0x86, 0x44, 0xE5, 0xA2, 0xAA, 0xED, 0x9D, 0xCD, 0xE7, 0xD9, 0x0A,
-    0x53, 0xBF, 0x01, 0x30, 0x12, 0x9E, 0x5E, 0xD4, 0x9D, 0x72, 0xE2, 0xA3, 0x76, 0xDF, 0xE5, 0x63,
-    0x7F, 0xC6, 0xDB, 0x98, 0xDD, 0xA3, 0x76, 0xFF, 0xB0, 0x5E, 0xF2, 0x17, 0x3D, 0xC7, 0xAE, 0xDD,
-    0x39, 0xB4, 0x97, 0xFF, 0x0A, 0xC5, 0x5A, 0x3D, 0x6C, 0x14, 0x47, 0x18, 0x7D, 0xBB, 0x6B, 0xDF,
-    0x62, 0x56, 0x64, 0x4F, 0x8A, 0x2D, 0x45, 0x04, 0xFB, 0x28, 0x5C, 0x80, 0x84, 0xBD, 0x14, 0x8E,
-    0xE4, 0x48, 0x3E, 0xDF, 0x8A, 0x14, 0x29, 0x28, 0x70, 0x61, 0x27, 0x5D, 0x94, 0x12, 0x88, 0xA2,
-    0xB8, 0x40, 0x11, 0x52, 0x0E, 0xBC, 0x21, 0x05, 0xAD, 0x8B, 0x48, 0x29, 0xD2, 0x50, 0xD0, 0x44,
-    0x8A, 0x08, 0x45, 0x14, 0xB9, 0x38, 0x73, 0xAB, 0xA4, 0x48, 0x15, 0x69, 0x15, 0x14, 0x51, 0xA4,
-    0x39, 0x04, 0xA9, 0x52, 0xB0, 0x48, 0x6B, 0xE9, 0x08, 0xF6, 0x6D, 0xDE, 0x37, 0xB3, 0x7B, 0x36,
-    0xC6, 0x84, 0xD8, 0x77, 0x7B, 0x5E, 0xDF, 0x7C, 0x3E, 0xEF, 0xCF, 0xCC, 0x7B, 0xDF, 0x37, 0xF3,
-    0xE6, 0x9B, 0x59, 0x03, 0x31, 0x00, 0x33, 0xA1, 0xB1, 0xDA, 0x34, 0x76, 0x9D, 0xC6, 0xA9, 0xD2,
-    0x1C, 0xF3, 0x68, 0x4E, 0x54, 0x68, 0x66, 0xDD, 0x00, 0x98, 0x71, 0x42, 0xE0, 0xAE, 0x1D, 0x01,
-    0xB1, 0xD5, 0x82, 0x91, 0xA6, 0x31, 0xCC, 0x10, 0x09, 0xAC, 0x00, 0x9B, 0xB0, 0x81, 0x3A, 0x5C,
-    0xA0, 0x8A, 0x8A, 0x8F, 0x15, 0xA4, 0xB1, 0x9D, 0xB6, 0xA0, 0x8F, 0x05, 0xA9, 0x3E, 0xCE, 0x0D,
-    0x56, 0x01, 0xE3, 0x3B, 0xB8, 0x7F, 0x47, 0x9E, 0x11, 0x4F, 0xF1, 0x71, 0xF5, 0x31, 0x7E, 0x48,
-    0xBC, 0xAF, 0x93, 0x3A, 0x92, 0x06, 0x92, 0x35, 0x5A, 0x33, 0x99, 0xFF, 0x68, 0xAD, 0xD2, 0x5E,
-    0x91, 0x07, 0x46, 0x81, 0x86, 0xFA, 0x4C, 0xF2, 0xC9, 0xDB, 0x02, 0x6E, 0x9D, 0x66, 0xE8, 0x0D,
-    0xB9, 0xF6, 0xA9, 0x98, 0xC7, 0x62, 0x22, 0xE4, 0x47, 0x61, 0x74, 0x16, 0x61, 0xA5, 0xBE, 0xC1,
-    0xEB, 0x8E, 0xCF, 0x0B, 0x38, 0x0B, 0x94, 0xF7, 0x49, 0x45, 0x91, 0x91, 0xAA, 0x61, 0xC4, 0x74,
-    0x8F, 0xB5, 0xE9, 0x03, 0xEE, 0x04, 0xCF, 0x4C, 0x9A, 0x7E, 0xE1, 0xF0, 0x61, 0xF0, 0x59, 0x9E,
-    0xBC, 0x38, 0x07, 0xA4, 0x65, 0x58, 0xBF, 0x06, 0x38, 0x2A, 0xD1, 0x80, 0x0A, 0x88, 0xD0, 0x00,
-    0x79, 0x40, 0x11, 0xC9, 0x0A, 0xB9, 0x80, 0x64, 0x58, 0x59, 0xC2, 0x00, 0x24, 0x58, 0x93, 0xDF,
-    0x04, 0x47, 0x46, 0xC8, 0x29, 0x0D, 0x8B, 0xB1, 0x42, 0xB1, 0x0F, 0x05, 0xFB, 0x9B, 0x9B, 0x18,
-    0x1C, 0xA9, 0xB2, 0xF6, 0x26, 0x26, 0x8E, 0x93, 0x44, 0x8D, 0x0F, 0x3F, 0x6D, 0xC1, 0x0C, 0x26,
-    0x75, 0xA3, 0x97, 0x7D, 0x58, 0xFF, 0x24, 0x70, 0xC2, 0x3A, 0x23, 0x26, 0xAD, 0x65, 0xE5, 0x93,
-    0x2D, 0x38, 0x7F, 0xB1, 0x16, 0x7E, 0xF7, 0x58, 0xA6, 0xD5, 0xEF, 0x75, 0xB8, 0xDF, 0xDC, 0x81,
-    0xDD, 0xA9, 0x84, 0xFA, 0x61, 0x53, 0x3C, 0x33, 0x7C, 0x45, 0xBE, 0xCE, 0xB0, 0xEE, 0xA7, 0x91,
-    0x84, 0x0B, 0x83, 0x0C, 0xD7, 0x02, 0x8C, 0xEF, 0x59, 0x0F, 0x2E, 0x5E, 0x61, 0xB8, 0x18, 0x2D,
-    0x1D, 0xAC, 0xFD, 0x76, 0x38, 0x1E, 0x95, 0xDF, 0x09, 0xE0, 0xDD, 0x94, 0x90, 0x4F, 0x4A, 0xF7,
-    0x33, 0x04, 0xF2, 0x80, 0xB9, 0xC0, 0x7A, 0x7C, 0xCB, 0x69, 0x46, 0x47, 0x4A, 0x3E, 0x2E, 0xB2,
-    0xF7, 0xA1, 0x17, 0x3A, 0x0A, 0xA1, 0xDD, 0xC5, 0x7F, 0xCA, 0x1A, 0x04, 0xFE, 0xBD, 0x85, 0x4C,
-    0x8E, 0x75, 0xD6, 0x40, 0x3E, 0xE1, 0x41, 0xF8, 0xEC, 0x94, 0x36, 0x7D, 0x08, 0x5C, 0x48, 0xAF,
-    0x1B, 0xBD, 0x41, 0x33, 0xE5, 0x08, 0xCB, 0x8E, 0x34, 0x79, 0x1B, 0x83, 0x60, 0xE9, 0x04, 0x98,
-    0x80, 0x31, 0xE9, 0xDB, 0x46, 0x68, 0xA5, 0x01, 0xEE, 0xE1, 0x60, 0x21, 0x72, 0xFD, 0x5C, 0x13,
-    0x46, 0xCF, 0x1D, 0x02, 0x0D, 0x4B, 0xEE, 0xEE, 0x03, 0x0D, 0x4B, 0xE0, 0xE1, 0xD4, 0x21, 0x86,
-    0x64, 0x0B, 0x38, 0x0F, 0x09, 0xC9, 0x4C, 0xCF, 0x21, 0x11, 0x11, 0xA8, 0x2A, 0x11, 0x10, 0xC5,
-    0x1E, 0x35, 0x0F, 0x23, 0x2E, 0xC9, 0xB2, 0x16, 0x01, 0x03, 0x3D, 0xD0, 0x51, 0xD0, 0xCF, 0x6C,
-    0x43, 0x4F, 0x70, 0x68, 0xE3, 0x7F, 0x18, 0x41, 0x0F, 0x3C, 0xB6, 0x07, 0x7F, 0x2D, 0x4D, 0x23,
-    0x7B, 0xE3, 0xC3, 0x16, 0x2B, 0xCE, 0xCB, 0x82, 0x34, 0xD2, 0x2D, 0x69, 0x0A, 0x73, 0x63, 0x11,
-    0x2F, 0x9C, 0x8B, 0x51, 0x66, 0x99, 0x91, 0x62, 0x6F, 0x2C, 0x25, 0xAC, 0x43, 0x7B, 0xC2, 0x60,
-    0x8C, 0x85, 0xA1, 0x14, 0xD1, 0xF6, 0x4B, 0x70, 0x9E, 0x44, 0x15, 0x23, 0xAE, 0xA2, 0x5D, 0x47,
-    0xA3, 0x8E, 0x7A, 0x33, 0xDD, 0x5C, 0x5F, 0x5A, 0x6C, 0xA8, 0x99, 0x93, 0xEE, 0xF1, 0x30, 0xEA,
-    0xFE, 0x91, 0x98, 0x69, 0xB4, 0x5B, 0x91, 0x4A, 0x64, 0x38, 0xBD, 0xC6, 0x93, 0x4C, 0x18, 0x38,
-    0xF5, 0xAB, 0x61, 0x45, 0x1F, 0xC9, 0xD1, 0x37, 0xC0, 0xBC, 0x25, 0xCB, 0xA9, 0x02, 0xC1, 0x32,
-    0xA3, 0x6A, 0xDF, 0x17, 0xE2, 0x21, 0x96, 0xE6, 0x57, 0x3E, 0x1E, 0xA4, 0x80, 0xBF, 0xDE, 0x57,
-    0x74, 0xF4, 0xA4, 0x9B, 0x9C, 0x1D, 0x6F, 0xC6, 0xA3, 0x4E, 0xB0, 0x6F, 0x5C, 0xBA, 0xBF, 0xC4,
-    0xB0, 0xEF, 0x87, 0x70, 0x9F, 0xD2, 0x89, 0xF4, 0xE2, 0xC7, 0x23, 0xFD, 0xF5, 0x9E, 0x4A, 0xBE,
-    0xB2, 0x94, 0xAE, 0x93, 0xA7, 0x74, 0x59, 0xEB, 0x97, 0x20, 0x68, 0x41, 0xB8, 0x84, 0xD6, 0x26,
-    0xC2, 0x06, 0x4B, 0x1D, 0x84, 0x0C, 0x62, 0x96, 0x10, 0xAB, 0xCC, 0x49, 0xC6, 0x07, 0x71, 0x83,
-    0xC0, 0x91, 0x23, 0x1F, 0xD3, 0xB5, 0xC2, 0xBA, 0xC9, 0xBF, 0x2F, 0xC4, 0x85, 0x60, 0xCF, 0x33,
-    0xB7, 0x71, 0x95, 0xB9, 0x05, 0x59, 0xE6, 0xA6, 0xE3, 0x8F, 0xE3, 0x3E, 0xCC, 0xE7, 0x09, 0x6C,
-    0x66, 0x6E, 0xAE, 0x3F, 0xCF, 0x4C, 0xCD, 0x63, 0xA1, 0x65, 0xDD, 0xDE, 0xD2, 0x12, 0x64, 0x38,
-    0x57, 0xB2, 0x69, 0xC6, 0x09, 0x87, 0x61, 0x6D, 0x5C, 0x63, 0x1F, 0xC8, 0x75, 0xE0, 0x28, 0xCF,
-    0x8E, 0x44, 0x6A, 0x49, 0x60, 0xDF, 0x67, 0x04, 0xE3, 0x82, 0x7C, 0xBF, 0x23, 0x3F, 0xEB, 0xE8,
-    0x84, 0x26, 0x3A, 0x40, 0x27, 0x21, 0x22, 0x2A, 0xFC, 0x4F, 0x14, 0x7A, 0x9F, 0x63, 0x4F, 0x44,
-    0xA9, 0x30, 0xC0, 0x92, 0x84, 0xB9, 0xDD, 0x24, 0xAC, 0x27, 0xCC, 0x4E, 0xAB, 0x48, 0x9C, 0x2F,
-    0x6B, 0x18, 0x8F, 0x2D, 0x9D, 0x67, 0x1D, 0x08, 0xF2, 0x0E, 0x55, 0x33, 0x6F, 0xC1, 0x6D, 0x60,
-    0x68, 0x5C, 0xEE, 0x33, 0xA8, 0xFE, 0xA1, 0xC6, 0x0E, 0xBB, 0x2D, 0x68, 0xFE, 0xE7, 0xC7, 0x4E,
-    0xE4, 0x91, 0x61, 0xBF, 0xD2, 0x2E, 0xCF, 0xE1, 0xAA, 0xD5, 0x12, 0x55, 0x1C, 0xF3, 0xBD, 0xC8,
-    0xDA, 0xE3, 0xC7, 0x69, 0xAD, 0x74, 0x0E, 0x56, 0xBF, 0x1C, 0x01, 0xAC, 0x58, 0x3E, 0xF2, 0x25,
-    0xB4, 0x23, 0xBD, 0xCE, 0xFA, 0xAF, 0xA6, 0xC4, 0x77, 0x76, 0x64, 0x47, 0x46, 0x96, 0x15, 0x7F,
-    0xC6, 0x33, 0xE6, 0xB3, 0xB7, 0x23, 0xBA, 0x92, 0x4A, 0x50, 0x11, 0x2F, 0xD4, 0x80, 0x6B, 0x98,
-    0x07, 0x3F, 0x1C, 0x36, 0x35, 0x71, 0x8B, 0xB7, 0xDB, 0xA8, 0x0B, 0x55, 0xB9, 0xA5, 0xA6, 0xA6,
-    0x42, 0x79, 0xCC, 0x0D, 0x0D, 0xCE, 0x91, 0x89, 0x43, 0x8F, 0x4A, 0x33, 0xE8, 0x06, 0x0A, 0x56,
-    0x2B, 0x37, 0x46, 0xA0, 0xD7, 0x5D, 0xCE, 0x73, 0x69, 0xAB, 0xC1, 0x47, 0xAB, 0xF4, 0xF3, 0x34,
-    0xBF, 0x55, 0x5E, 0x28, 0x75, 0xB6, 0x31, 0xC7, 0xF3, 0xF3, 0xB4, 0xEE, 0x97, 0xED, 0xAE, 0xF2,
-    0xA8, 0xF5, 0xF1, 0x7C, 0x56, 0xDE, 0x82, 0x9E, 0x83, 0x30, 0x21, 0x62, 0x35, 0x74, 0x26, 0x5B,
-    0x3A, 0xC3, 0x94, 0x7B, 0xCD, 0x30, 0x87, 0x50, 0x30, 0x43, 0x8A, 0xA1, 0xC1, 0x09, 0x1E, 0xE7,
-    0xD8, 0xA0, 0xCD, 0x32, 0x9D, 0xA7, 0x84, 0x3D, 0x32, 0xCD, 0xF6, 0x02, 0xD8, 0xDF, 0xAD, 0x87,
-    0xAC, 0xD6, 0xDD, 0x90, 0x84, 0x4C, 0x38, 0x9E, 0x2C, 0x0D, 0x88, 0x99, 0xDE, 0x10, 0xF0, 0x71,
-    0xFA, 0x8C, 0xDA, 0x10, 0x30, 0x39, 0x51, 0x95, 0x70, 0xAB, 0x67, 0x66, 0x6A, 0x43, 0xC0, 0x91,
-    0x7E, 0x61, 0xFE, 0x22, 0x7D, 0xE2, 0x42, 0x32, 0x68, 0x66, 0xE5, 0x2C, 0x67, 0x71, 0x39, 0x15,
-    0xA8, 0x5D, 0x81, 0x1F, 0xB9, 0x1A, 0x08, 0xB2, 0xA0, 0x1D, 0x5F, 0x85, 0xD9, 0x61, 0x9E, 0x17,
-    0x7A, 0xE4, 0xEE, 0xFA, 0x15, 0x66, 0x1E, 0x9E, 0xFA, 0x6B, 0xBB, 0xF0, 0x5C, 0xE8, 0xF2, 0xBC,
-    0x1B, 0xB8, 0xEC, 0xD6, 0xD7, 0x77, 0xCC, 0x2D, 0x25, 0xA1, 0x35, 0xA2, 0x12, 0x42, 0x3A, 0xCA,
-    0x7A, 0xC4, 0x7E, 0xE1, 0x26, 0x83, 0x0F, 0xDC, 0x22, 0xCB, 0x1D, 0x99, 0xEA, 0x80, 0xD3, 0xB3,
-    0x7D, 0x0D, 0x9E, 0x3E, 0xBC, 0x9B, 0x34, 0x9F, 0x4B, 0x7B, 0x0B, 0xA3, 0xF9, 0xD0, 0x3E, 0x0C,
-    0x9E, 0x92, 0xCE, 0x2F, 0xC3, 0x6E, 0xB6, 0x30, 0x2C, 0x9E, 0x3F, 0x0D, 0xD9, 0x3B, 0xE8, 0x33,
-    0x57, 0x3B, 0x7E, 0x81, 0xDC, 0xD9, 0xA3, 0x03, 0x22, 0xB7, 0x97, 0x72, 0xCA, 0x71, 0x5D, 0x48,
-    0xFA, 0xFD, 0x23, 0xB9, 0x5B, 0x51, 0x77, 0xEC, 0x33, 0xC8, 0x2A, 0xC9, 0x50, 0x08, 0xF4, 0x64,
-    0xC1, 0x99, 0xE7, 0xB3, 0x8E, 0x19, 0x0B, 0xE9, 0x58, 0x48, 0x47, 0x44, 0xDF, 0xF4, 0xFB, 0x1C,
-    0x51, 0x35, 0x9B, 0x89, 0x90, 0xBA, 0x4A, 0x48, 0xC9, 0x90, 0xF7, 0x5D, 0xF6, 0x13, 0x12, 0x5C,
-    0xAE, 0x60, 0x3D, 0xAA, 0xB2, 0x8E, 0xFD, 0x47, 0x71, 0x1E, 0x59, 0xCE, 0x9A, 0x6D, 0x45, 0xAE,
-    0x0E, 0x8E, 0x90, 0x0A, 0x5F, 0x9C, 0x49, 0xCE, 0x48, 0x1F, 0x08, 0xBD, 0x6E, 0xCE, 0x2B, 0x9E,
-    0xD5, 0xDE, 0x73, 0x5E, 0xEF, 0xCC, 0x64, 0xAD, 0x86, 0xE6, 0x0D, 0xF6, 0x36, 0x59, 0xAD, 0x21,
-    0x58, 0x1F, 0x10, 0x1F, 0xC9, 0x26, 0xDB, 0x93, 0x38, 0xB6, 0x12, 0xE3, 0x88, 0x1D, 0xF5, 0xA9,
-    0xCB, 0x0D, 0x02, 0xF8, 0xDE, 0x22, 0xD1, 0x3B, 0x81, 0x5D, 0xA2, 0xD0, 0xEC, 0xF0, 0x4A, 0x25,
-    0xC1, 0x0A, 0x53, 0x47, 0x9C, 0xC0, 0xBE, 0x8C, 0xB5, 0x6D, 0x5A, 0x38, 0x23, 0x3E, 0xB9, 0xCA,
-    0xC5, 0xC5, 0x07, 0x1C, 0x10, 0x5E, 0x9A, 0x6B, 0x9A, 0x5A, 0x0A, 0x1B, 0x49, 0x6E, 0xE4, 0xCF,
-    0x31, 0x7F, 0xCC, 0x5F, 0x09, 0xBD, 0xD0, 0x56, 0x3F, 0xD6, 0x2B, 0x8B, 0xB2, 0x91, 0x1B, 0x9A,
-    0xCF, 0xBE, 0x68, 0xA1, 0xF9, 0x68, 0xAB, 0xEB, 0x16, 0x59, 0x2A, 0x49, 0x51, 0x2E, 0x92, 0xED,
-    0x2B, 0xEB, 0x89, 0x5C, 0xB1, 0xFD, 0x6C, 0x71, 0x28, 0x30, 0x80, 0xE5, 0x0C, 0x40, 0xD1, 0x0C,
-    0x87, 0xD9, 0xAC, 0x47, 0x6E, 0xE5, 0x39, 0xDD, 0xB2, 0xDA, 0x2B, 0xD1, 0xAA, 0xDA, 0x13, 0xD3,
-    0x1D, 0xFB, 0xA9, 0xF3, 0x5D, 0x52, 0x59, 0x10, 0x1B, 0x24, 0xB5, 0xD9, 0x20, 0xA9, 0xFA, 0x9C,
-    0xE0, 0x9C, 0xA5, 0x99, 0x68, 0xD1, 0x8C, 0xF7, 0x2D, 0x6C, 0xBA, 0x99, 0x2C, 0x4D, 0xD5, 0x1A,
-    0x64, 0xE9, 0xF5, 0x98, 0x13, 0x92, 0xD6, 0xFB, 0x21, 0x79, 0xFD, 0x2C, 0xB4, 0x1E, 0xF8, 0xC4,
-    0xDE, 0x86, 0xD0, 0x78, 0xB5, 0x11, 0x82, 0x10, 0x86, 0x50, 0x14, 0x77, 0x71, 0x84, 0x6C, 0xCD,
-    0x29, 0xB5, 0xD1, 0x73, 0x92, 0xBC, 0x5F, 0x1B, 0x1C, 0xCB, 0xCD, 0xEE, 0xA4, 0xA8, 0x26, 0x11,
-    0xD3, 0x2F, 0x82, 0xE5, 0xEB, 0x7A, 0x69, 0xE1, 0x54, 0xA5, 0x97, 0xAA, 0x6E, 0xAA, 0xFB, 0xA9,
-    0x6A, 0xDC, 0x52, 0x51, 0x2D, 0x82, 0xAF, 0xA1, 0x5E, 0x3E, 0xB5, 0xA8, 0x56, 0xEF, 0x88, 0xEE,
-    0x9C, 0xAC, 0xF8, 0x83, 0x61, 0xA9, 0xD6, 0x55, 0xE9, 0x7B, 0x04, 0xF0, 0x67, 0x2A, 0xFA, 0xB0,
-    0x56, 0x54, 0x8F, 0x1D, 0x48, 0xEF, 0x7C, 0x59, 0x3A, 0x81, 0x22, 0xC6, 0xA0, 0xD2, 0x51, 0x11,
-    0x54, 0x6D, 0x8C, 0xEE, 0x5B, 0x35, 0xD5, 0x4D, 0x65, 0x23, 0x46, 0x0B, 0x40, 0x57, 0x52, 0x6B,
-    0x1D, 0x3B, 0x0D, 0xDC, 0x18, 0xF7, 0x24, 0xA3, 0x9B, 0x15, 0x78, 0xCB, 0x32, 0x8E, 0x58, 0xE9,
-    0x35, 0x49, 0x54, 0x3C, 0x91, 0x3F, 0xF7, 0xBC, 0x3C, 0xFB, 0x5B, 0xBE, 0x25, 0xAF, 0x5E, 0x3D,
-    0xBE, 0xD2, 0xA8, 0x5B, 0x6A, 0x69, 0xB6, 0xB0, 0x6F, 0xE7, 0xAF, 0x76, 0x95, 0xE8, 0xA8, 0x63,
-    0x69, 0x61, 0x6C, 0xA1, 0xD9, 0xF2, 0xE2, 0x4A, 0x60, 0x73, 0x6D, 0x66, 0x93, 0x11, 0xD7, 0x67,
-    0xD1, 0x31, 0x3A, 0xEE, 0x04, 0x15, 0x8A, 0x0B, 0xA1, 0xB5, 0x19, 0x3E, 0x43, 0x14, 0x55, 0x82,
-    0xA8, 0xC8, 0x56, 0x5A, 0xA8, 0x5E, 0x69, 0xC1, 0xC9, 0xC6, 0xF5, 0x94, 0xAE, 0xB3, 0xC4, 0xD6,
-    0x64, 0xCB, 0xB1, 0x60, 0x06, 0x59, 0xEC, 0xBA, 0x57, 0x25, 0x29, 0xED, 0x8D, 0x02, 0x97, 0xD6,
-    0x53, 0x94, 0xC9, 0xBA, 0x1B, 0x94, 0xE2, 0x92, 0xA2, 0x90, 0xFD, 0x47, 0x84, 0xBC, 0x7E, 0x18,
-    0x52, 0xCA, 0x35, 0x95, 0xAB, 0x75, 0xF7, 0x3F, 0x22, 0x0A, 0x64, 0x29, 0x7A, 0x52, 0xE3, 0xA9,
-    0xF2, 0x5D, 0x7D, 0x29, 0x07, 0x5A, 0x40, 0xAC, 0xB4, 0x9A, 0x78, 0xAD, 0x55, 0x51, 0x93, 0x70,
-    0x5B, 0x4D, 0x8A, 0xA4, 0x27, 0xFB, 0x08, 0xA9, 0x0D, 0xF3, 0xDB, 0x0E, 0x4C, 0x63, 0xAD, 0x10,
-    0x5A, 0xFF, 0x02, 0x95, 0x57, 0xBD, 0x6F, 0xDB, 0x46, 0x14, 0x7F, 0x14, 0x1D, 0xB3, 0x35, 0x23,
-    0x9F, 0x87, 0x04, 0x08, 0x10, 0x4B, 0xF4, 0x90, 0x02, 0x46, 0x20, 0x9B, 0x46, 0xA1, 0x14, 0x46,
-    0x21, 0x99, 0x97, 0x74, 0xF0, 0x18, 0x0F, 0x71, 0x97, 0x02, 0x8D, 0x51, 0x64, 0xEA, 0x12, 0x0F,
-    0x42, 0xA3, 0xC1, 0x91, 0x58, 0x64, 0xEC, 0xE2, 0xFF, 0xA0, 0x02, 0xDA, 0xA5, 0x6E, 0x80, 0x6A,
-    0x50, 0x81, 0xB4, 0x95, 0xAD, 0x03, 0x32, 0x74, 0xC8, 0xC2, 0xAD, 0x5B, 0x41, 0xA0, 0xC8, 0x58,
-    0x80, 0x03, 0x81, 0x32, 0x28, 0x2D, 0xF6, 0xF7, 0x48, 0x51, 0xA1, 0xE3, 0xD6, 0x51, 0xEF, 0xDE,
-    0x9D, 0xEE, 0xDE, 0x3D, 0xDE, 0xBD, 0xEF, 0x3B, 0xED, 0xF4, 0xCE, 0x15, 0x22, 0xDA, 0x3B, 0xBC,
-    0xE9, 0x0A, 0xB2, 0xDD, 0xCF, 0x0F, 0x17, 0xE8, 0xA2, 0xCA, 0x45, 0x97, 0xE4, 0x8D, 0x82, 0x9E,
-    0xF7, 0x0D, 0xF5, 0x2E, 0xAC, 0x5C, 0x0C, 0x5A, 0x26, 0x27, 0x5A, 0x5E, 0x35, 0x56, 0xE9, 0xE2,
-    0x4A, 0xDD, 0xB8, 0x1B, 0xE7, 0x7D, 0x92, 0x24, 0x47, 0x47, 0x47, 0x57, 0x77, 0x77, 0x77, 0x9C,
-    0x24, 0xF1, 0x79, 0x1F, 0x8C, 0x77, 0xB3, 0x29, 0x4A, 0x40, 0x59, 0xF9, 0x57, 0x64, 0xDF, 0xFF,
-    0xBF, 0xF5, 0xEA, 0xEE, 0x3D, 0x27, 0x39, 0x4D, 0xF7, 0x9B, 0x0C, 0x4A, 0x72, 0x91, 0xEA, 0xB4,
-    0x4F, 0xC7, 0x34, 0xA2, 0x2D, 0xCC, 0x17, 0xA1, 0x19, 0x4B, 0xE9, 0xAE, 0x2E, 0x17, 0x80, 0xE7,
-    0x62, 0x49, 0x5B, 0x09, 0xC6, 0x50, 0x85, 0x56, 0x68, 0x8D, 0xBA, 0x74, 0x42, 0x2D, 0xAC, 0x55,
-    0xC8, 0x90, 0xFC, 0xFD, 0xE1, 0xA2, 0xEE, 0xD6, 0xCB, 0xB4, 0xBF, 0x4C, 0xC7, 0xB6, 0x1C, 0xD9,
-    0x6A, 0x4B, 0xB8, 0xBC, 0x8F, 0xEE, 0xDA, 0x5F, 0xF9, 0xD6, 0xAF, 0x81, 0xEE, 0xFA, 0xBA, 0xF4,
-    0x16, 0x4A, 0x4C, 0x93, 0x15, 0x6B, 0xDB, 0xB3, 0x5F, 0x04, 0xE2, 0x79, 0xBA, 0x44, 0xAA, 0x62,
-    0xC8, 0x95, 0x77, 0x68, 0xCD, 0x94, 0x5D, 0x4B, 0x9D, 0xD8, 0x6E, 0xAB, 0x42, 0xA0, 0x04, 0xD2,
-    0xB8, 0xED, 0x31, 0xF5, 0x90, 0xA8, 0x9D, 0x42, 0x9D, 0xE1, 0xBD, 0x5B, 0x7B, 0x4E, 0x12, 0x2E,
-    0xD5, 0x97, 0x18, 0x13, 0xA7, 0xAB, 0x67, 0x09, 0x18, 0x36, 0x0A, 0xB0, 0x92, 0x13, 0xA4, 0x4B,
-    0x1F, 0x7E, 0x31, 0x70, 0x7E, 0x0E, 0x79, 0x9C, 0x7D, 0x38, 0x25, 0xAE, 0x4F, 0xC8, 0xB0, 0x33,
-    0xF6, 0xC7, 0x29, 0x8C, 0x69, 0x4D, 0x76, 0x9E, 0x97, 0x4E, 0x30, 0x8A, 0x92, 0x38, 0x89, 0x47,
-    0x91, 0x13, 0x2C, 0xB8, 0x3B, 0x44, 0x8F, 0x61, 0x3F, 0x8F, 0xBA, 0xA7, 0xD4, 0x1D, 0x53, 0xD7,
-    0xA7, 0x0E, 0xDC, 0x2A, 0x95, 0xED, 0x5A, 0xA7, 0xB3, 0x7A, 0x8D, 0xF6, 0x3A, 0x14, 0x77, 0xB4,
-    0x78, 0x95, 0x06, 0x29, 0x32, 0x2E, 0x05, 0x86, 0x8A, 0xF5, 0xD0, 0xF4, 0x86, 0x3C, 0xCA, 0xB4,
-    0xD0, 0xEC, 0x34, 0xD1, 0x8F, 0xC2, 0x1E, 0xF5, 0x66, 0x70, 0xAE, 0x6E, 0x44, 0xAB, 0x6F, 0xAD,
-    0x28, 0x49, 0x90, 0xD7, 0xB7, 0x3B, 0x77, 0xE2, 0x2B, 0xE2, 0x3A, 0x0B, 0xED, 0x28, 0x80, 0x96,
-    0x50, 0x67, 0xA1, 0xCD, 0x8A, 0x08, 0x11, 0x0F, 0x28, 0x8D, 0x35, 0x6A, 0xF0, 0x6F, 0x5B, 0xB0,
-    0x3E, 0x89, 0x06, 0x82, 0x52, 0xFF, 0x0D, 0x45, 0x66, 0xDF, 0x50, 0x7C, 0xA4, 0xB2, 0xDF, 0x6D,
-    0xC9, 0xBF, 0xCF, 0x84, 0x30, 0x7D, 0xB8, 0x58, 0xDB, 0xAA, 0x34, 0x0F, 0xF4, 0xDF, 0x54, 0xB3,
-    0xD9, 0x68, 0x57, 0x8D, 0x2F, 0x7D, 0x33, 0x6C, 0x0D, 0x84, 0xB8, 0x8D, 0x6F, 0x83, 0x50, 0xF0,
-    0x1E, 0x9A, 0x17, 0x8A, 0xBB, 0xF8, 0xD5, 0x55, 0x36, 0x37, 0x24, 0x7E, 0x65, 0x40, 0x02, 0x9F,
-    0x9A, 0xB7, 0x7D, 0xF8, 0x67, 0x63, 0x4D, 0x7F, 0xEE, 0xE1, 0x74, 0x2B, 0xD2, 0x12, 0x49, 0xE7,
-    0x4B, 0xCE, 0x62, 0x81, 0xCB, 0x02, 0xA3, 0x05, 0x5E, 0x0B, 0xEC, 0x16, 0x38, 0x2E, 0x30, 0x5D,
-    0xE0, 0x1B, 0xDD, 0x94, 0xF5, 0x03, 0xCA, 0xB9, 0x1F, 0xAC, 0x51, 0x2E, 0x40, 0x60, 0x51, 0x2E,
-    0x03, 0x0F, 0x27, 0x62, 0xF0, 0x70, 0x22, 0x09, 0x0F, 0x27, 0xC2, 0xF0, 0x70, 0x22, 0xCF, 0x60,
-    0x9D, 0x26, 0x22, 0xA9, 0x36, 0x58, 0x85, 0x54, 0x21, 0xA4, 0xB2, 0xC2, 0xA2, 0x40, 0x16, 0xAD,
-    0x63, 0xA1, 0x91, 0x06, 0x34, 0x66, 0xA6, 0xBB, 0x2E, 0x64, 0x43, 0x50, 0x03, 0x21, 0x55, 0xA3,
-    0xFD, 0xD4, 0x41, 0x2C, 0xF3, 0x89, 0xB7, 0x2E, 0xB6, 0x55, 0x43, 0x18, 0x6E, 0xA3, 0x62, 0x62,
-    0x61, 0x11, 0x2B, 0x59, 0x68, 0x82, 0x5D, 0xAA, 0xE2, 0x3C, 0x93, 0x74, 0x9E, 0xD9, 0xD4, 0x14,
-    0x54, 0x15, 0x52, 0x18, 0xD2, 0x44, 0xF8, 0x6B, 0x2A, 0x45, 0x0A, 0xB7, 0x29, 0x4C, 0x55, 0x85,
-    0x0E, 0x84, 0x71, 0x47, 0x61, 0xC1, 0xC3, 0x8A, 0x9F, 0x9D, 0x5F, 0x72, 0x75, 0x65, 0xFA, 0xE5,
-    0xFD, 0xDA, 0xE6, 0x66, 0xAD, 0xBF, 0x48, 0x3B, 0x9A, 0x32, 0x90, 0x6A, 0xB7, 0x10, 0x2D, 0x36,
-    0x99, 0x52, 0x57, 0xE4, 0x2D, 0x81, 0x3B, 0x1C, 0xE1, 0xEA, 0x9E, 0xEE, 0x1B, 0x4A, 0x20, 0x9D,
-    0x70, 0x92, 0xE9, 0x13, 0x6D, 0x52, 0xA4, 0x79, 0x55, 0x0A, 0x0D, 0x7C, 0x02, 0x39, 0x34, 0x1F,
-    0xDC, 0x50, 0x5B, 0x83, 0xFA, 0xAB, 0x88, 0x98, 0x2B, 0xC6, 0xD7, 0x24, 0x1F, 0x6B, 0xB1, 0x1E,
-    0x3C, 0xD6, 0x22, 0x3D, 0x58, 0x35, 0x7E, 0xD7, 0x0E, 0xC9, 0x02, 0x25, 0x1D, 0x80, 0x12, 0x54,
-    0x6D, 0x02, 0x55, 0x15, 0x1F, 0x86, 0x10, 0x8B, 0xB7, 0x82, 0x6D, 0x10, 0x63, 0xA6, 0xDA, 0x32,
-    0x55, 0xD3, 0x78, 0x0D, 0x0D, 0x7D, 0x02, 0x35, 0xDD, 0x9D, 0xC2, 0x24, 0x20, 0x4D, 0xD5, 0x31,
-    0xBD, 0x66, 0x1E, 0x9F, 0xD7, 0x13, 0xD9, 0x99, 0x0F, 0x22, 0x8A, 0xC2, 0x07, 0x07, 0x4B, 0xD1,
-    0x01, 0x85, 0x07, 0x34, 0x88, 0xE9, 0xC7, 0x80, 0x7E, 0x51, 0xB0, 0x32, 0x2B, 0x38, 0x83, 0xAC,
-    0x44, 0x69, 0x36, 0x8A, 0x26, 0xA9, 0x5A, 0x22, 0x4F, 0xBB, 0x4B, 0x18, 0xCF, 0xB1, 0x74, 0xCB,
-    0x8B, 0x2C, 0x62, 0xE9, 0xD5, 0xEE, 0x43, 0x97, 0xEC, 0x24, 0x9A, 0x7C, 0x71, 0xE9, 0x08, 0x69,
-    0x64, 0x94, 0x8C, 0xC9, 0xF0, 0x00, 0x15, 0x60, 0x5A, 0xC8, 0x43, 0x74, 0x39, 0xCD, 0x45, 0x50,
-    0x88, 0x47, 0x25, 0xC5, 0xF7, 0x8F, 0xC9, 0x39, 0x99, 0x6A, 0xAC, 0x21, 0x4E, 0x51, 0x7F, 0x52,
-    0xE9, 0x05, 0xE9, 0xDB, 0xB0, 0x88, 0x2A, 0x6B, 0x5E, 0x8D, 0x82, 0x4D, 0x6A, 0xF5, 0xD9, 0x77,
-    0x8D, 0x54, 0x0C, 0x4E, 0xC9, 0xA4, 0x3F, 0x31, 0x79, 0xF8, 0x57, 0x97, 0x27, 0x16, 0xBB, 0xAD,
-    0x36, 0x7A, 0xC5, 0x98, 0x3F, 0x6C, 0xCE, 0xD8, 0x46, 0x69, 0x4A, 0xF9, 0x60, 0x5E, 0x3E, 0x48,
-    0xF3, 0x5C, 0x8B, 0x36, 0xEA, 0x2B, 0x1B, 0xFB, 0x2B, 0x9D, 0xF7, 0x43, 0xC0, 0xF5, 0xE4, 0x10,
-    0xA0, 0x9D, 0x12, 0xA0, 0xFB, 0x28, 0x04, 0x6C, 0x6E, 0xF4, 0x01, 0x19, 0x25, 0x27, 0xC5, 0x01,
-    0x8D, 0xE2, 0x24, 0xAD, 0xBC, 0xD7, 0x6A, 0x8A, 0xE6, 0x90, 0x84, 0x0F, 0xF3, 0xCE, 0x82, 0x7D,
-    0x95, 0xB9, 0xFA, 0x6F, 0xF4, 0x28, 0x38, 0x86, 0x3C, 0x67, 0xEB, 0xF1, 0xCE, 0x49, 0xEF, 0x1C,
-    0x8E, 0x73, 0x0F, 0x2E, 0x56, 0x0D, 0xA6, 0x38, 0x5B, 0xAF, 0x46, 0x37, 0xCF, 0xE1, 0xB4, 0xC8,
-    0xC9, 0x15, 0x4C, 0x66, 0x22, 0x01, 0xCE, 0x9D, 0xC0, 0xBE, 0x13, 0x34, 0x29, 0x6C, 0x52, 0xD4,
-    0xA0, 0x21, 0x60, 0x2E, 0x85, 0xFC, 0x0A, 0x08, 0xD9, 0x6C, 0x7A, 0xC0, 0x60, 0x29, 0x12, 0x8A,
-    0x53, 0xFB, 0xE3, 0x82, 0x7D, 0xDF, 0x30, 0xF4, 0xD4, 0xDC, 0x99, 0xC5, 0xE3, 0x7C, 0xFC, 0xBA,
-    0xE0, 0x4C, 0x8B, 0x4F, 0xB5, 0x24, 0x0E, 0xB5, 0x24, 0x0E, 0x14, 0x12, 0xE7, 0x09, 0xBE, 0xCB,
-    0x44, 0x9A, 0x33, 0x60, 0xA1, 0x00, 0x9D, 0x05, 0xFF, 0xC7, 0x51, 0x82, 0x77, 0x4F, 0x3B, 0x93,
-    0xBB, 0x85, 0xB3, 0xE7, 0x58, 0x12, 0x67, 0xD8, 0x6E, 0x36, 0x9A, 0x96, 0xA6, 0x86, 0xB7, 0xC2,
-    0x16, 0xEE, 0x13, 0x84, 0xA8, 0x5C, 0xE7, 0x38, 0xB5, 0x80, 0xE3, 0x8E, 0x10, 0x6A, 0x50, 0xF0,
-    0x16, 0x77, 0x43, 0x74, 0x10, 0xAB, 0x86, 0x78, 0x43, 0x57, 0x66, 0x2F, 0xBA, 0x3C, 0xE9, 0x0A,
-    0x5B, 0x91, 0x43, 0xB8, 0xBF, 0x1C, 0x1E, 0x6D, 0xBD, 0x46, 0xFF, 0xF4, 0xF1, 0xD3, 0x51, 0x12,
-    0xDB, 0xE3, 0x61, 0xEA, 0x78, 0xAD, 0x54, 0x03, 0x7D, 0x36, 0x26, 0xF9, 0x6C, 0x4F, 0xF6, 0xCD,
-    0x0C, 0x5C, 0x36, 0xAC, 0xC9, 0x69, 0x8A, 0xFD, 0x74, 0x0E, 0x0F, 0x9A, 0x31, 0x59, 0xF7, 0x13,
-    0xD7, 0x34, 0x13, 0x85, 0xE6, 0x15, 0x9A, 0x9A, 0x34, 0x32, 0xCD, 0x7B, 0x68, 0x34, 0x53, 0xBB,
-    0x6F, 0x1E, 0xD2, 0xD8, 0x0C, 0x68, 0xFE, 0xE8, 0xC8, 0x75, 0xC6, 0x27, 0x72, 0x14, 0x6D, 0x52,
-    0xF2, 0x46, 0xEB, 0xC2, 0xB2, 0x36, 0x42, 0x4E, 0x43, 0xE8, 0x1D, 0x1D, 0x7D, 0x4B, 0x0F, 0x7F,
-    0xE0, 0x33, 0xA6, 0x3C, 0xE4, 0xCD, 0x15, 0xB0, 0x0D, 0x87, 0x1C, 0x5E, 0x52, 0xA9, 0x28, 0x7D,
-    0x1A, 0xEC, 0x07, 0xA3, 0xEF, 0x83, 0xF9, 0x53, 0x84, 0xBB, 0x7B, 0xFA, 0x59, 0xB0, 0xD7, 0xDF,
-    0x63, 0x29, 0xF7, 0xE8, 0x5D, 0x28, 0xC4, 0x41, 0x42, 0x39, 0x5B, 0x6C, 0x72, 0xE4, 0x16, 0xF4,
-    0xB1, 0x8C, 0x6C, 0xA6, 0x4D, 0xD2, 0x06, 0x1E, 0x00, 0x64, 0xBC, 0xBC, 0xEE, 0x31, 0xF1, 0x33,
-    0xD6, 0x55, 0x85, 0x9F, 0x02, 0x0B, 0x34, 0x6B, 0x01, 0x27, 0x97, 0x38, 0xA2, 0x2A, 0xBC, 0x01,
-    0xD2, 0x98, 0x67, 0x20, 0x99, 0x8E, 0xC6, 0xF9, 0xF2, 0x85, 0x5C, 0xBE, 0x95, 0xA0, 0xBA, 0xE0,
-    0x94, 0xED, 0x65, 0x98, 0x9C, 0x6F, 0x84, 0x1E, 0x79, 0x5A, 0xFA, 0xB2, 0x33, 0x60, 0xA9, 0x32,
-    0x90, 0x9B, 0xED, 0x8D, 0xB8, 0x3F, 0xCC, 0x6E, 0x0E, 0x6F, 0xB1, 0x19, 0x96, 0xF7, 0xD7, 0x6B,
-    0x7D, 0x13, 0x01, 0x01, 0x4F, 0xDB, 0x05, 0xF2, 0x61, 0xF2, 0x8A, 0xF4, 0x97, 0xF4, 0x89, 0x4A,
-    0x13, 0x58, 0x9A, 0xCA, 0x32, 0xA6, 0xAE, 0xB0, 0x53, 0x54, 0x36, 0x03, 0xF1, 0x81, 0x5F, 0xFA,
-    0x5B, 0x7E, 0x37, 0x7E, 0x3A, 0x1E, 0x9F, 0x6A, 0x50, 0xF9, 0x23, 0x6F, 0xBD, 0x1E, 0xCC, 0x41,
-    0x07, 0x37, 0x32, 0x22, 0xEC, 0x7D, 0x9A, 0xA6, 0x0B, 0x5A, 0xCA, 0xA3, 0xE5, 0xD9, 0x6B, 0xC9,
-    0xB3, 0x55, 0x3E, 0xDF, 0xB2, 0xC4, 0x5D, 0x77, 0x1D, 0x3D, 0xEE, 0xB7, 0xAA, 0x45, 0x8D, 0x46,
-    0x0D, 0x37, 0x16, 0xEE, 0x10, 0xDA, 0xDF, 0xA8, 0xD7, 0xF3, 0x7C, 0xC9, 0xFA, 0x97, 0x59, 0x5B,
-    0xCC, 0x50, 0xD8, 0x54, 0xC6, 0x64, 0xF8, 0xDC, 0x86, 0xA4, 0x7B, 0x85, 0x7B, 0x30, 0xA3, 0xB3,
-    0xB2, 0xE9, 0x0D, 0xD2, 0xA6, 0x74, 0x6D, 0x2A, 0x65, 0x74, 0x73, 0x85, 0xFD, 0xAC, 0x22, 0x53,
-    0xBA, 0x77, 0x66, 0xBF, 0x61, 0x1C, 0x2F, 0x15, 0xCC, 0x35, 0x8C, 0x87, 0x67, 0xCF, 0xB0, 0xCF,
-    0xBF, 0x2C, 0x1E, 0xE0, 0x22, 0xCC, 0xCF, 0xE3, 0xF1, 0x39, 0x82, 0x37, 0xF8, 0x5B, 0x9A, 0x03,
-    0x7F, 0x65, 0xC3, 0xE3, 0xB6, 0x57, 0x06, 0x3D, 0x5F, 0xC7, 0x68, 0xBB, 0x9F, 0xEE, 0x4A, 0x3C,
-    0xF7, 0xBD, 0x7C, 0xCE, 0xED, 0x59, 0x59, 0x57, 0x4C, 0xC7, 0xBF, 0x39, 0x6F, 0x37, 0xE2, 0xB8,
-    0x35, 0xE5, 0x2D, 0xC5, 0x15, 0x3B, 0xE6, 0x77, 0xE4, 0x67, 0xCF, 0xB3, 0x99, 0x9E, 0x85, 0x81,
-    0xDA, 0xE0, 0x3A, 0xD3, 0xB3, 0xD0, 0x77, 0x94, 0x25, 0x05, 0x2D, 0xD0, 0xDB, 0x69, 0x2F, 0x11,
-    0xFF, 0xEB, 0x72, 0x54, 0xCE, 0xCB, 0x45, 0xB4, 0x82, 0x6E, 0xA9, 0x5E, 0xEF, 0xA6, 0x3B, 0xCB,
-    0xBE, 0x27, 0x34, 0xAB, 0x6C, 0xFF, 0x00, 0xED, 0x53, 0x3D, 0x4F, 0xDB, 0x40, 0x18, 0x7E, 0x9C,
-    0x23, 0x36, 0x8A, 0x89, 0x8D, 0x54, 0x22, 0x55, 0x55, 0xEE, 0xCC, 0xC0, 0x10, 0xB5, 0xC4, 0x64,
-    0xF0, 0x60, 0x24, 0x3B, 0x1C, 0x43, 0xD5, 0x21, 0x8B, 0x87, 0x78, 0x41, 0x8A, 0xDA, 0xA1, 0x43,
-    0xD5, 0x89, 0x81, 0x01, 0xA4, 0x40, 0x4E, 0xFC, 0x02, 0xAB, 0x6B, 0xA5, 0x2A, 0x03, 0x43, 0xA7,
-    0x96, 0xA1, 0x95, 0x82, 0x1A, 0xE0, 0x7E, 0x82, 0x7F, 0x82, 0x07, 0xF6, 0x66, 0x60, 0xC8, 0x40,
-    0x49, 0xCF, 0x90, 0xA4, 0x88, 0x89, 0x1F, 0xD0, 0x7B, 0x9E, 0x3B, 0xBD, 0x7A, 0xDE, 0xBB, 0x7B,
-    0xDF, 0xF7, 0x3E, 0xB4, 0x13, 0x98, 0xDF, 0xC0, 0x4C, 0x1E, 0x1A, 0x32, 0x20, 0x53, 0x86, 0x8A,
-    0x86, 0x50, 0xA2, 0x72, 0x21, 0xC2, 0x22, 0x18, 0xF2, 0x56, 0x47, 0x79, 0x0E, 0x0B, 0x3D, 0x81,
-    0x15, 0x60, 0x08, 0xED, 0x06, 0xA4, 0x8B, 0x52, 0x80, 0x6A, 0x00, 0x2F, 0xC0, 0xE5, 0x24, 0x45,
-    0x17, 0x08, 0xA0, 0x5D, 0x70, 0x2D, 0x46, 0xA5, 0xBD, 0x75, 0xD3, 0x58, 0xDA, 0xC5, 0x3B, 0xF4,
-    0xC6, 0x68, 0xC2, 0x89, 0x9C, 0x91, 0x7B, 0x71, 0x53, 0xE4, 0xDA, 0x89, 0x7D, 0x18, 0xB0, 0xFD,
-    0x85, 0x9F, 0xD1, 0xED, 0xF0, 0x9A, 0xFD, 0xB0, 0x07, 0x76, 0xC0, 0x9C, 0xA1, 0x16, 0x55, 0xE2,
-    0xCB, 0x49, 0xDF, 0x12, 0x4B, 0xA8, 0xC1, 0xC3, 0x29, 0xD2, 0x82, 0x24, 0xC2, 0x80, 0x06, 0x3D,
-    0x41, 0xD8, 0xC5, 0xC0, 0xC5, 0x80, 0xE1, 0x28, 0x80, 0x33, 0x82, 0xFB, 0x07, 0x83, 0x0D, 0x8C,
-    0x6C, 0x5C, 0xDB, 0x68, 0x0E, 0x51, 0x8C, 0xA0, 0xF5, 0x61, 0x9F, 0xA3, 0x6E, 0x23, 0x30, 0x79,
-    0x60, 0x88, 0xBA, 0x29, 0xED, 0x89, 0x44, 0x4B, 0xC0, 0xE4, 0x6B, 0x36, 0xD8, 0xDD, 0x1C, 0x55,
-    0x0E, 0xFA, 0x53, 0x6E, 0x29, 0xEF, 0xCC, 0xCE, 0x75, 0xDC, 0x29, 0xB3, 0xF1, 0xBE, 0xDD, 0xDB,
-    0x99, 0x21, 0x1C, 0x84, 0xAA, 0xA8, 0xEE, 0x14, 0x81, 0x82, 0x0B, 0x9B, 0x17, 0x52, 0x2C, 0x03,
-    0x7B, 0xCA, 0x36, 0x05, 0x91, 0x0A, 0xE9, 0x1C, 0xD2, 0x54, 0x6B, 0xF6, 0xF3, 0x3D, 0x56, 0x50,
-    0xFF, 0x0D, 0x9B, 0x08, 0x8B, 0x88, 0xF2, 0x8C, 0x16, 0x91, 0xBD, 0xE3, 0x4C, 0x7B, 0xC2, 0xE9,
-    0x83, 0x9B, 0xF2, 0x97, 0x7C, 0x26, 0xC9, 0x03, 0xBC, 0x1A, 0x57, 0xDA, 0xA5, 0xE4, 0x70, 0x78,
-    0x1A, 0xAE, 0xE6, 0x59, 0xED, 0x23, 0x53, 0x3B, 0x16, 0x36, 0x77, 0x26, 0xB7, 0x71, 0x5B, 0x57,
-    0xFA, 0x28, 0x5C, 0x55, 0xAA, 0x99, 0x16, 0x87, 0x70, 0xC5, 0x46, 0x16, 0x5E, 0x8C, 0x8B, 0xFC,
-    0xFF, 0x6D, 0x3D, 0xE9, 0xB6, 0x4A, 0x57, 0xA8, 0x56, 0xB1, 0x50, 0x06, 0x28, 0x58, 0x07, 0x7E,
-    0x19, 0x1E, 0x45, 0xF8, 0x05, 0xFA, 0x6B, 0xE8, 0x19, 0xA5, 0xBE, 0xB5, 0xF9, 0x76, 0x33, 0xF6,
-    0xB1, 0x0E, 0xBB, 0xA3, 0x25, 0xFA, 0x15, 0xA8, 0x05, 0xDF, 0x80, 0x4F, 0xB8, 0x47, 0xB8, 0x1A,
-    0xD7, 0x0D, 0x58, 0x1D, 0x68, 0x09, 0x3E, 0xEE, 0x08, 0x66, 0xC1, 0x78, 0x8E, 0x42, 0x06, 0x8C,
-    0x50, 0xF0, 0xB1, 0x48, 0x55, 0xB5, 0x3C, 0xAE, 0x70, 0x33, 0x5B, 0xEB, 0xE6, 0x5F, 0xE8, 0xE5,
-    0x77, 0xDF, 0xF2, 0xCB, 0xB4, 0xAB, 0x25, 0x87, 0x79, 0xB4, 0x3B, 0x9E, 0xC1, 0x69, 0x81, 0x12,
-    0xF1, 0x90, 0x2E, 0x91, 0xF1, 0x76, 0xF4, 0x6F, 0xCE, 0x0B, 0xA1, 0x82, 0xD2, 0x1A, 0x68, 0x3F,
-    0x3F, 0x59, 0x1A, 0xE4, 0x39, 0xB8, 0x86, 0x88, 0x39, 0x3F, 0x57, 0xFE, 0xC7, 0x70, 0x11, 0xF3,
-    0xDA, 0x01, 0xE3, 0x4E, 0xEB, 0x53, 0xAA, 0x5E, 0x60, 0x56, 0x7E, 0xD4, 0x1D, 0x22, 0x47, 0x95,
-    0xED, 0xA8, 0xFD, 0xE1, 0x40, 0x85, 0xE6, 0x0F, 0xDF, 0xA8, 0xA2, 0x43, 0x52, 0xE5, 0xFB, 0x7A,
-    0x06, 0xF6, 0x86, 0x33, 0x22, 0x69, 0x61, 0x4A, 0x65, 0xB3, 0xCF, 0xA0, 0xEF, 0xA7, 0x29, 0xF5,
-    0x38, 0x4A, 0x89, 0xD7, 0xF0, 0x96, 0x9B, 0x30, 0x32, 0xEC, 0x35, 0x6A, 0xDE, 0xAE, 0xCE, 0x17,
-    0xB0, 0x84, 0x23, 0x51, 0x47, 0x75, 0x0E, 0x8B, 0xEB, 0xFC, 0x2F, 0x85, 0x56, 0xCF, 0x8F, 0x1C,
-    0xC5, 0x19, 0xFD, 0xBA, 0x2B, 0xB8, 0x25, 0xCA, 0x76, 0xE7, 0xC0, 0xCA, 0x0E, 0x1E, 0x51, 0x52,
-    0x4E, 0x28, 0xB2, 0xB7, 0x8D, 0x64, 0x0B, 0xA3, 0xCC, 0x4C, 0xD7, 0xC6, 0x20, 0x0E, 0x24, 0xB0,
-    0x87, 0x4C, 0x38, 0x10, 0xC9, 0x1C, 0x90, 0x90, 0xC2, 0x61, 0xF7, 0x90, 0x13, 0xCC, 0xB8, 0x1B,
-    0xF9, 0x1F, 0xC8, 0x05, 0x38, 0x24, 0x52, 0x36, 0x11, 0x52, 0xA2, 0xF5, 0x61, 0x91, 0xC2, 0x61,
-    0x84, 0x7A, 0xBD, 0xB5, 0xB6, 0x14, 0x24, 0xA4, 0x88, 0xB2, 0xAC, 0x55, 0x0E, 0x44, 0xB8, 0x41,
-    0x76, 0xAC, 0x60, 0x09, 0xDA, 0xA1, 0x2D, 0x66, 0x37, 0x33, 0x53, 0xBC, 0xAF, 0x7A, 0xF6, 0x07,
-    0x02, 0x91, 0x9E, 0x79, 0xAF, 0xBA, 0xAA, 0xBB, 0xBF, 0xAE, 0xFA, 0x7E, 0xBC, 0x6A, 0x22, 0xA2,
-    0xD0, 0xE5, 0xA4, 0xCE, 0x97, 0xD4, 0x0E, 0x2C, 0xF5, 0xD1, 0x1F, 0x02, 0xF5, 0x5C, 0x6F, 0xB1,
-    0x4E, 0x5C, 0x35, 0x92, 0xF9, 0xF2, 0x50, 0xE6, 0xA7, 0xDB, 0x12, 0xF7, 0x00, 0x87, 0x9C, 0x33,
-    0x84, 0xF6, 0x00, 0x1E, 0x05, 0xCE, 0x51, 0xEA, 0x46, 0x24, 0x7E, 0x41, 0x24, 0x7E, 0x4E, 0x74,
-    0x62, 0x42, 0x81, 0xCB, 0x8C, 0xFC, 0x20, 0xB1, 0xEA, 0xC1, 0xC7, 0x6D, 0xF7, 0xC8, 0x63, 0xBA,
-    0x73, 0xF8, 0x34, 0x0D, 0x5A, 0xCB, 0x54, 0x1C, 0x5F, 0xA1, 0xE2, 0x51, 0x4B, 0x83, 0x33, 0x86,
-    0x06, 0xA7, 0x0D, 0xA5, 0x8F, 0x19, 0x4A, 0xFE, 0x9B, 0xEB, 0xF8, 0xD3, 0x05, 0x2B, 0xDC, 0x17,
-    0x39, 0xB9, 0x6D, 0xA2, 0xF7, 0x89, 0x82, 0xBF, 0x63, 0x12, 0x4F, 0x51, 0x73, 0x24, 0x53, 0x0A,
-    0xB7, 0x95, 0x91, 0x46, 0xD8, 0x58, 0x0B, 0x9B, 0x50, 0x40, 0x5D, 0x0C, 0x0F, 0x18, 0xE9, 0x92,
-    0x29, 0xE4, 0x1D, 0x5B, 0x44, 0x9B, 0x7A, 0x3D, 0x82, 0x4D, 0xA0, 0x0B, 0xA4, 0x80, 0x7A, 0xDA,
-    0x50, 0xFC, 0x4F, 0x03, 0xBB, 0x1F, 0x19, 0xCA, 0xA6, 0xDE, 0x94, 0x73, 0x8E, 0xD4, 0xD6, 0x12,
-    0x49, 0x23, 0x81, 0x08, 0x08, 0x01, 0xDA, 0xC7, 0xD6, 0x22, 0x49, 0x57, 0xEF, 0xF5, 0xD7, 0x3E,
-    0x23, 0x7A, 0x61, 0x6B, 0xFF, 0x7A, 0x6C, 0x61, 0xA3, 0x31, 0x85, 0x35, 0x96, 0x14, 0x5D, 0x1F,
-    0x51, 0x4C, 0x6D, 0x52, 0x1E, 0x3F, 0x04, 0x70, 0x0F, 0x35, 0xAE, 0xD9, 0x80, 0xAB, 0x04, 0xEE,
-    0x0F, 0xF9, 0x19, 0x9C, 0x07, 0x65, 0x73, 0x2E, 0xD8, 0x6D, 0x7F, 0x0D, 0x75, 0x8A, 0xB9, 0xBC,
-    0x74, 0x62, 0x3C, 0x5B, 0x24, 0x1D, 0xF2, 0x7C, 0xD4, 0xF3, 0x61, 0xA2, 0xB9, 0x85, 0xB7, 0x4F,
-    0xBD, 0x4D, 0xC9, 0x87, 0x2E, 0x75, 0x24, 0x46, 0xAA, 0x56, 0x5A, 0x54, 0x51, 0xC9, 0x3E, 0x10,
-    0x36, 0x62, 0x36, 0xFB, 0x2C, 0x3D, 0xC7, 0x9E, 0x95, 0xE7, 0xD4, 0xF3, 0xE3, 0x60, 0x59, 0xFE,
-    0xAD, 0x8C, 0x6C, 0x36, 0xB9, 0x31, 0x8E, 0xC6, 0x14, 0x18, 0xB6, 0xCE, 0x13, 0x00, 0x33, 0xA5,
-    0x36, 0x9E, 0x92, 0xAC, 0xC2, 0x9A, 0x44, 0x4D, 0x25, 0x89, 0x31, 0xD3, 0x3A, 0x53, 0xC6, 0xF4,
-    0x47, 0x5D, 0x62, 0x19, 0xCE, 0x69, 0x71, 0xDE, 0x96, 0x74, 0xEC, 0xAD, 0xFB, 0xB7, 0x67, 0x5D,
-    0x5D, 0xE0, 0xAA, 0xEE, 0x30, 0x25, 0x4C, 0x31, 0x28, 0x97, 0xF0, 0x87, 0x11, 0x25, 0xA5, 0xA3,
-    0xB0, 0xA4, 0xCC, 0xAD, 0x60, 0x99, 0xB7, 0xAF, 0xE0, 0x45, 0xA5, 0xD2, 0xA0, 0x18, 0xDE, 0xC0,
-    0xFC, 0xF7, 0xE8, 0x6A, 0x8E, 0xB1, 0x4B, 0x20, 0xF5, 0x0C, 0x68, 0x3D, 0x9B, 0x08, 0x57, 0x4A,
-    0x9C, 0xD1, 0x77, 0x53, 0x54, 0xC1, 0x78, 0xE6, 0x74, 0x38, 0xF1, 0x1E, 0x4A, 0xDD, 0x2D, 0x6E,
-    0xA2, 0xFB, 0x19, 0x37, 0x61, 0xC5, 0xC1, 0x41, 0xC3, 0xFE, 0xE6, 0xA6, 0x3C, 0xB4, 0xE2, 0x9B,
-    0x8B, 0xEB, 0x7E, 0xB0, 0x52, 0x68, 0xA2, 0xCD, 0xF2, 0x28, 0x1A, 0x15, 0x54, 0x9C, 0xF3, 0x35,
-    0xC1, 0x50, 0x78, 0xAF, 0xA6, 0xCC, 0x62, 0x70, 0x4C, 0x72, 0x8C, 0xE6, 0x22, 0xA2, 0x86, 0x26,
-    0x41, 0x10, 0x75, 0x58, 0xC5, 0xAF, 0x1B, 0x89, 0x46, 0x5E, 0xB5, 0x52, 0x8B, 0x5A, 0xDC, 0x83,
-    0x95, 0xD4, 0x05, 0x93, 0x8D, 0xD1, 0x6E, 0xC8, 0x12, 0x47, 0x3F, 0xA2, 0x74, 0x1C, 0x8D, 0x68,
-    0x9E, 0xA2, 0x32, 0xAC, 0x28, 0x25, 0x61, 0x82, 0x9A, 0x52, 0x38, 0x88, 0x46, 0xB4, 0x91, 0x47,
-    0x44, 0x63, 0xBA, 0x8B, 0x5C, 0xA3, 0x82, 0x6E, 0x18, 0xC4, 0xB6, 0x13, 0x5C, 0xB3, 0x47, 0x60,
-    0x85, 0x8F, 0xF1, 0xDC, 0xD2, 0xF3, 0x6F, 0xDE, 0x1F, 0xFC, 0x92, 0x94, 0xD0, 0xD5, 0x19, 0xBC,
-    0xF2, 0x69, 0xAA, 0x97, 0xE1, 0xB3, 0x0F, 0xA8, 0x78, 0x07, 0x2B, 0xFB, 0x07, 0xB5, 0x91, 0x30,
-    0xE2, 0x5F, 0xD4, 0xE1, 0x9C, 0x19, 0x53, 0x82, 0x15, 0x86, 0x23, 0x52, 0xBC, 0xD0, 0x1A, 0xF3,
-    0x83, 0x87, 0x6F, 0x85, 0xE5, 0xA0, 0x77, 0x45, 0x94, 0x7D, 0x98, 0x00, 0xC5, 0x97, 0x40, 0x12,
-    0xF4, 0x30, 0x93, 0x92, 0xD7, 0xBE, 0x41, 0x11, 0x8F, 0xC1, 0xF1, 0x4C, 0x16, 0x14, 0x99, 0xBE,
-    0xEA, 0x2D, 0xE9, 0xBE, 0xE2, 0x92, 0x13, 0x9C, 0xD3, 0x58, 0x3D, 0x16, 0x82, 0xD9, 0xC1, 0x41,
-    0x5D, 0x7F, 0x1E, 0x4D, 0xE7, 0x49, 0x7D, 0xF4, 0x39, 0x7A, 0x57, 0x20, 0x0D, 0x5D, 0x8F, 0x02,
-    0xE3, 0xBB, 0xD8, 0x1D, 0xE3, 0xEB, 0xEA, 0xCD, 0x2F, 0x74, 0xE4, 0x54, 0xB5, 0xEF, 0x1C, 0x67,
-    0x1E, 0x5E, 0x5D, 0xCD, 0x9B, 0x0E, 0x7C, 0x56, 0x67, 0x78, 0x71, 0x8C, 0xF7, 0xC6, 0xBE, 0x3C,
-    0xB0, 0x02, 0x0F, 0xE7, 0x2C, 0x2D, 0xBD, 0xA1, 0x7D, 0xD9, 0x20, 0xB5, 0xE8, 0xC2, 0x1B, 0xCD,
-    0x38, 0x47, 0x14, 0x55, 0x4C, 0xA2, 0x0A, 0x88, 0x26, 0x27, 0x60, 0x63, 0x37, 0xF2, 0x10, 0x2C,
-    0xB8, 0x1C, 0xA2, 0x50, 0xC1, 0x11, 0x61, 0x15, 0x70, 0x00, 0x23, 0x0D, 0x3A, 0xCA, 0xB1, 0x3F,
-    0xC7, 0x54, 0xF9, 0x52, 0x1F, 0xD1, 0x31, 0x37, 0x59, 0xA4, 0x70, 0x9C, 0xF1, 0x58, 0x92, 0x83,
-    0x62, 0x7F, 0x73, 0x05, 0x82, 0x2F, 0x61, 0x60, 0x42, 0x11, 0xE2, 0x95, 0xA3, 0xC8, 0x64, 0x95,
-    0xE1, 0x89, 0xC1, 0x85, 0xAD, 0xE1, 0xB2, 0x34, 0x6D, 0xE0, 0xE4, 0xA2, 0x34, 0x0F, 0x91, 0xDC,
-    0xC4, 0x54, 0x6E, 0x02, 0x35, 0x71, 0x08, 0xC4, 0xDD, 0xAB, 0x14, 0x48, 0x78, 0x0B, 0x19, 0x4F,
-    0x1B, 0x86, 0xA2, 0xDF, 0x1F, 0x50, 0x0F, 0x65, 0x21, 0x0A, 0x53, 0xDA, 0x3B, 0x42, 0x7D, 0xA0,
-    0xA6, 0x1F, 0x18, 0x78, 0xD1, 0xF8, 0xCF, 0xB6, 0xF7, 0x50, 0x50, 0xB5, 0x7D, 0x11, 0xDA, 0xD8,
-    0x37, 0x48, 0x34, 0xAF, 0x1A, 0x11, 0xBB, 0x0B, 0x22, 0x67, 0xBC, 0x8E, 0xF8, 0x46, 0x7D, 0xA3,
-    0x99, 0xF7, 0x3E, 0xA1, 0x0E, 0xE2, 0x0C, 0x77, 0xB4, 0x29, 0x7E, 0x16, 0x4F, 0x42, 0x7B, 0x5A,
-    0x22, 0x4F, 0x86, 0xD4, 0x69, 0x0B, 0xF3, 0x62, 0x4D, 0x45, 0x5B, 0xE4, 0x2F, 0x7E, 0x1E, 0x96,
-    0x17, 0x25, 0x25, 0x0B, 0x4E, 0xBF, 0xD7, 0x68, 0xCC, 0x2C, 0x32, 0x4D, 0x13, 0x34, 0x0D, 0x0A,
-    0xB5, 0x79, 0xFF, 0xEE, 0x94, 0x11, 0x00, 0x71, 0x03, 0xCB, 0xCA, 0xED, 0x3E, 0x0C, 0xFA, 0x57,
-    0xB1, 0xF4, 0x1B, 0x39, 0x89, 0x3B, 0x78, 0x86, 0x57, 0x38, 0x6E, 0x60, 0x26, 0x24, 0x3E, 0x99,
-    0x52, 0xF4, 0xE5, 0x12, 0x1D, 0xC9, 0x62, 0xDD, 0x6A, 0x4B, 0x73, 0xE6, 0xB8, 0x8F, 0x9A, 0xA5,
-    0x1F, 0x00, 0x2D, 0x08, 0xDE, 0x29, 0x58, 0x57, 0x2F, 0xE4, 0x14, 0x4D, 0x7C, 0xD5, 0x46, 0xF7,
-    0xB9, 0xC4, 0x62, 0xF3, 0xCA, 0xCE, 0xDA, 0xAD, 0x57, 0x76, 0x2E, 0x8F, 0xB8, 0x4C, 0xB9, 0xE5,
-    0x3E, 0xC6, 0xF3, 0xB0, 0xCA, 0x50, 0x9E, 0xB7, 0x38, 0x38, 0xDF, 0x02, 0x62, 0x05, 0x1B, 0xEC,
-    0x23, 0xEF, 0x59, 0x2E, 0x76, 0x85, 0x6E, 0xB0, 0x7D, 0xA7, 0xA6, 0xC8, 0x5A, 0x68, 0xB1, 0xB6,
-    0x35, 0x25, 0x64, 0x35, 0x52, 0xD2, 0xF2, 0x16, 0xB1, 0x4B, 0x45, 0x43, 0x5B, 0x3D, 0x74, 0x6F,
-    0x3A, 0x3D, 0xA0, 0xEB, 0x63, 0xBE, 0x65, 0x84, 0x92, 0x05, 0x29, 0x0D, 0x92, 0x6C, 0x20, 0xDC,
-    0x86, 0xA2, 0xD3, 0x92, 0x2B, 0x67, 0xE6, 0x3D, 0xB1, 0x72, 0x23, 0x0F, 0x99, 0x6A, 0x0E, 0x53,
-    0xC1, 0x41, 0xE5, 0xAD, 0xF2, 0x48, 0x07, 0x74, 0x12, 0x72, 0xD1, 0x1B, 0x20, 0x85, 0x57, 0x77,
-    0xD6, 0x3E, 0xFB, 0x1D, 0xBD, 0xC3, 0x99, 0x00, 0xC9, 0xF5, 0x4A, 0x69, 0x43, 0x83, 0x79, 0x0B,
-    0x0D, 0x51, 0x80, 0x16, 0xF0, 0x5E, 0x81, 0x49, 0x40, 0x0E, 0xA7, 0xE4, 0xAA, 0xD8, 0x99, 0xDD,
-    0x6D, 0x44, 0xDA, 0x02, 0x53, 0x9F, 0xC7, 0x65, 0x85, 0xCD, 0x8D, 0x37, 0x91, 0x84, 0x7A, 0xBD,
-    0x0D, 0xBD, 0xBA, 0x36, 0xCD, 0x29, 0xAB, 0xE8, 0x57, 0x6E, 0x4B, 0xC3, 0x9C, 0x55, 0x39, 0x5F,
-    0xE1, 0xEA, 0x3C, 0x84, 0x4C, 0x90, 0x5A, 0xE1, 0x09, 0x69, 0x53, 0xD8, 0xD8, 0xD5, 0x24, 0xF8,
-    0x85, 0x45, 0x9E, 0xB7, 0xCC, 0x9D, 0x9B, 0x46, 0x6E, 0x5E, 0xB3, 0xF1, 0xC2, 0x35, 0x9B, 0x04,
-    0x9B, 0xD4, 0xC5, 0xF8, 0x60, 0x86, 0x62, 0x86, 0xF5, 0x59, 0x9F, 0xAF, 0xA5, 0x80, 0x5A, 0xC0,
-    0x96, 0x79, 0x1D, 0x5B, 0xE6, 0x74, 0xB6, 0x65, 0x86, 0xC6, 0xDB, 0x13, 0x76, 0x08, 0x14, 0x7B,
-    0x38, 0x76, 0x7B, 0xB2, 0x08, 0x11, 0xAB, 0x0E, 0x8E, 0x7D, 0x3F, 0x2E, 0x02, 0xC9, 0x9E, 0x36,
-    0x04, 0x1B, 0xD8, 0x2A, 0xEC, 0x3A, 0x66, 0x3F, 0x8F, 0xDF, 0x23, 0xAC, 0x3A, 0x7E, 0x5D, 0x31,
-    0x6F, 0x8D, 0x23, 0xF6, 0x09, 0x2F, 0xB4, 0x9E, 0xE5, 0x5A, 0xEA, 0x6B, 0xE2, 0xF8, 0x9F, 0x9F,
-    0xD3, 0xAF, 0xBD, 0xFA, 0xA1, 0x7E, 0xF9, 0xEC, 0x4D, 0xFA, 0xE9, 0x59, 0x08, 0x36, 0x6F, 0xBF,
-    0x4F, 0x20, 0x35, 0xCF, 0x9A, 0x99, 0x2E, 0x38, 0x33, 0xD7, 0xEB, 0xF9, 0xC4, 0xF8, 0x09, 0x74,
-    0xA7, 0xBB, 0x76, 0xD9, 0x9C, 0x89, 0x03, 0x73, 0x3A, 0x26, 0x0F, 0x2F, 0x30, 0xDF, 0x07, 0xD6,
-    0x07, 0x37, 0x86, 0xAC, 0x3A, 0x9A, 0xCB, 0x58, 0x84, 0x58, 0x80, 0x2C, 0xFD, 0xE6, 0xF2, 0x8E,
-    0x07, 0x9F, 0xFB, 0x31, 0x88, 0x49, 0x36, 0x6A, 0x66, 0xA5, 0xF4, 0xEC, 0xB6, 0x72, 0x96, 0x1F,
-    0x5C, 0x16, 0x57, 0xD8, 0x96, 0xC5, 0x7C, 0x30, 0x3E, 0x3A, 0x90, 0xBF, 0xF7, 0x4A, 0x2C, 0x47,
-    0x43, 0x67, 0x88, 0x5E, 0xBD, 0x87, 0xED, 0x09, 0xA5, 0x16, 0xD5, 0x0F, 0x20, 0xBC, 0x2A, 0xFF,
-    0x59, 0xA5, 0x90, 0x27, 0xA1, 0x65, 0x31, 0x03, 0x70, 0x2E, 0x72, 0x51, 0x2B, 0xFF, 0x55, 0xC5,
-    0x07, 0x84, 0x85, 0xCE, 0x61, 0x53, 0x58, 0x86, 0xB8, 0xFD, 0xF6, 0xD4, 0x2A, 0x7F, 0x3A, 0x54,
-    0x0F, 0x16, 0xF8, 0x52, 0x6B, 0xD1, 0x49, 0xE0, 0x30, 0xB5, 0x9E, 0x3C, 0x4C, 0xEA, 0xE3, 0x93,
-    0xF4, 0xC8, 0xFF, 0xDE, 0xA5, 0xF6, 0x8F, 0x2D, 0xCF, 0x23, 0xFC, 0x03, 0x27, 0x28, 0xBE, 0x49,
-    0x24, 0x9D, 0x23, 0xF1, 0x6F, 0x18, 0x72, 0xE5, 0x9E, 0x2A, 0x89, 0x19, 0x96, 0xB6, 0x49, 0x7C,
-    0xB5, 0x66, 0xE2, 0x4B, 0xE7, 0xAB, 0x79, 0xA1, 0xEB, 0x8E, 0xD0, 0xC3, 0xBE, 0xD0, 0x7D, 0xA0,
-    0x5D, 0x00, 0x43, 0xEC, 0xF1, 0xDF, 0x05, 0x87, 0xCD, 0x5D, 0x6D, 0xAD, 0x43, 0xF4, 0x14, 0x10,
-    0xE7, 0xF8, 0x9C, 0xE2, 0x5F, 0xDE, 0x9C, 0x63, 0x6C, 0xB3, 0xF0, 0xBA, 0xFE, 0x7F, 0x3F, 0xA3,
-    0x5A, 0x2B, 0x0D, 0xE6, 0xD9, 0x37, 0x4E, 0xC7, 0xBF, 0xFE, 0x8B, 0x9D, 0x6F, 0xFD, 0xA9, 0x6A,
-    0xB7, 0x56, 0xEA, 0x7E, 0x6B, 0x65, 0x58, 0xB4, 0x56, 0x96, 0x87, 0xB3, 0x4F, 0x52, 0x2E, 0xBA,
-    0xBE, 0x97, 0xBE, 0x26, 0x5C, 0x2C, 0x95, 0x5C, 0x98, 0xA8, 0xB2, 0x92, 0x41, 0xAF, 0xF3, 0x97,
-    0xA3, 0x73, 0x79, 0xF2, 0x56, 0x15, 0xEB, 0x71, 0xAC, 0x8B, 0x58, 0xF7, 0xFD, 0xBF, 0x88, 0x17,
-    0xB8, 0xD8, 0xE2, 0x5E, 0xED, 0xBB, 0xDD, 0x58, 0xA7, 0xFE, 0x8F, 0x93, 0x4E, 0xD2, 0x1B, 0xF1,
-    0x44, 0xDF, 0xF7, 0x5F, 0x9D, 0xAB, 0x5A, 0xDE, 0xC5, 0xE6, 0x5F, 0xB7, 0xA9, 0x2E, 0x68, 0x71,
-    0xCC, 0x05, 0x3B, 0xFB, 0x17, 0xFE, 0xDD, 0x5D, 0x7A, 0x48, 0x6D, 0xBD, 0x1B, 0x39, 0xDB, 0x64,
-    0xF1, 0x86, 0xAB, 0x7A, 0xBD, 0xC5, 0xAF, 0x01, 0xAB, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0x7F, 0x06,
-    0x06, 0x06, 0x00, 0xB5, 0x91, 0x21, 0x6F, 0xC3, 0x30, 0x10, 0x85, 0x9F, 0x63, 0x10, 0x10, 0x30,
-    0x32, 0xA9, 0x30, 0x74, 0x64, 0x33, 0x2D, 0xA9, 0x1A, 0x8D, 0x0E, 0xAC, 0x60, 0x1B, 0xD8, 0xAF,
-    0x18, 0x1C, 0x58, 0xD7, 0xFC, 0xA3, 0x91, 0x82, 0x80, 0x4A, 0x8D, 0xF6, 0x0B, 0x42, 0xC6, 0x4D,
-    0xCA, 0x0D, 0x5C, 0xA9, 0xA0, 0xD5, 0xED, 0x9D, 0x93, 0x4E, 0x83, 0xAD, 0xA6, 0x59, 0xCA, 0x3B,
-    0xFB, 0x2C, 0xDF, 0xFB, 0xEE, 0x02, 0xE8, 0x72, 0xD1, 0xED, 0x11, 0x57, 0xCB, 0x89, 0xF1, 0xE3,
-    0x70, 0x65, 0xBD, 0x09, 0xB0, 0x1D, 0x65, 0xB4, 0x79, 0xDE, 0x56, 0x53, 0x11, 0xE9, 0xD2, 0xF1,
-    0x74, 0xC9, 0x02, 0xF2, 0x60, 0x23, 0x16, 0x32, 0x95, 0x16, 0xE6, 0x41, 0x3D, 0xB8, 0xC1, 0x2E,
-    0xF7, 0x30, 0xC1, 0x76, 0xB0, 0x9E, 0x29, 0x46, 0xD0, 0xE3, 0x71, 0x06, 0x7A, 0x9C, 0x53, 0xFE,
-    0x28, 0x83, 0x87, 0x93, 0x0A, 0x7D, 0x1F, 0xAC, 0x42, 0x8F, 0x40, 0x0F, 0x12, 0x58, 0x9F, 0x0D,
-    0x2C, 0xA3, 0xCD, 0x6D, 0xA0, 0xC7, 0xE7, 0x70, 0x3C, 0x4B, 0x7E, 0x3C, 0x92, 0x43, 0xEA, 0x24,
-    0x96, 0x42, 0xF2, 0xB8, 0x7A, 0xB3, 0x74, 0xF2, 0xE3, 0xA8, 0x38, 0x1E, 0x01, 0x55, 0x4F, 0xA5,
-    0x3D, 0x3D, 0x6D, 0xFB, 0xAE, 0x44, 0x62, 0x9F, 0xFC, 0x4B, 0xC8, 0x34, 0x28, 0x47, 0xB6, 0x4F,
-    0x13, 0xBD, 0x97, 0x1A, 0xC3, 0x72, 0xF1, 0x82, 0x0E, 0x64, 0x99, 0x93, 0x52, 0x59, 0xF4, 0x81,
-    0xFF, 0xFD, 0x5C, 0x59, 0x66, 0x31, 0xB1, 0xF8, 0x7F, 0x62, 0x31, 0x4A, 0xB2, 0xD8, 0x81, 0x63,
-    0x2F, 0xF5, 0xAF, 0x16, 0x35, 0x6C, 0x4B, 0xC9, 0xDB, 0x0B, 0x95, 0xF2, 0x8B, 0xB2, 0x16, 0x4A,
-    0xCA, 0x9D, 0x2C, 0x2D, 0x0A, 0x9F, 0x77, 0x58, 0x4B, 0x26, 0xC7, 0x76, 0x2F, 0xF9, 0xE5, 0xDA,
-    0x7D, 0xA9, 0x73, 0xBE, 0x46, 0x03, 0x4C, 0x54, 0x74, 0x67, 0xD6, 0xE6, 0x30, 0xBB, 0xF9, 0xB8,
-    0x93, 0xF0, 0x5A, 0xD4, 0x0D, 0x96, 0xB6, 0x6A, 0xF4, 0xAA, 0xC1, 0xBB, 0x8A, 0x8B, 0x94, 0x5C,
-    0x34, 0xE3, 0x78, 0xCB, 0xFA, 0x0D, 0x5E, 0x2C, 0x25, 0xD8, 0x76, 0x85, 0xA6, 0xA8, 0xE7, 0x70,
-    0x07, 0xB8, 0x90, 0x6C, 0xBE, 0x01, 0x45, 0x8D, 0xB1, 0x0D, 0x80, 0x40, 0x0C, 0x03, 0x5F, 0x7C,
-    0x41, 0x41, 0x91, 0x51, 0x98, 0x00, 0x05, 0x46, 0x63, 0x12, 0x46, 0x21, 0xA3, 0x30, 0xC2, 0x17,
-    0x20, 0x01, 0x7A, 0x71, 0x24, 0xA2, 0x20, 0x52, 0x5C, 0xD8, 0xF2, 0x39, 0xA5, 0x9C, 0xE2, 0xC4,
-    0x42, 0xB5, 0x84, 0x52, 0x5D, 0x32, 0x84, 0x3D, 0x76, 0x1E, 0x0C, 0xED, 0xEC, 0x41, 0x15, 0xAB,
-    0x6E, 0x2F, 0x46, 0x12, 0x30, 0x4C, 0x61, 0xA2, 0xAC, 0x3C, 0x2D, 0xA7, 0xB2, 0xF7, 0x14, 0x61,
-    0xF7, 0x24, 0x73, 0x45, 0x19, 0x02, 0xA4, 0x07, 0xDE, 0x95, 0x4D, 0x9D, 0x93, 0x37, 0x0D, 0xFE,
-    0x5D, 0xFF, 0xAD, 0x6F, 0xB7, 0xF1, 0x7F, 0x01,
+static const uint8_t notoserif_12_regularBitmaps[26548] = {
+    0xB5, 0x58, 0x3F, 0x6C, 0xDC, 0xD6, 0x19, 0xFF, 0xC8, 0x57, 0x9B, 0xA8, 0x09, 0x89, 0x19, 0x2C,
+    0xB8, 0x40, 0x64, 0xB3, 0x83, 0x07, 0x01, 0x55, 0xC4, 0x0C, 0x02, 0x7A, 0x28, 0x8E, 0x77, 0x94,
+    0xD7, 0x0E, 0xBE, 0xC1, 0x97, 0x00, 0x35, 0x50, 0x2F, 0x5D, 0x1A, 0x14, 0xB5, 0x50, 0x78, 0x50,
+    0xD1, 0x3B, 0x1D, 0x9B, 0x35, 0x8B, 0x86, 0xB6, 0x59, 0x53, 0xC0, 0x43, 0x32, 0x59, 0x83, 0x87,
+    0x1B, 0x28, 0xDF, 0x73, 0x32, 0x64, 0x30, 0x0A, 0xB3, 0x83, 0xDB, 0x6E, 0x7D, 0x6D, 0x61, 0x34,
+    0x85, 0xD1, 0xFA, 0x35, 0xA1, 0x50, 0x0A, 0xE6, 0xDD, 0xEB, 0xEF, 0x7B, 0xE4, 0x09, 0x96, 0x61,
+    0xC9, 0x72, 0x8B, 0x90, 0xFC, 0xBE, 0x23, 0x79, 0xEF, 0xCF, 0xF7, 0xFF, 0x0F, 0xE3, 0x4E, 0x8C,
+    0xA3, 0xDD, 0x6E, 0xAF, 0xE2, 0x20, 0x8A, 0xB7, 0x63, 0xA2, 0x6F, 0x51, 0x21, 0x64, 0x90, 0x84,
+    0xD4, 0xA1, 0x98, 0x06, 0x38, 0xB3, 0xE6, 0xE4, 0xFB, 0x18, 0x6F, 0x43, 0x0A, 0x12, 0x21, 0x49,
+    0x13, 0x66, 0x7C, 0x9B, 0xD6, 0xC8, 0x4F, 0x45, 0xEE, 0x68, 0x2A, 0x68, 0xDC, 0x0C, 0x9A, 0x9F,
+    0x3C, 0xA9, 0x70, 0xB4, 0xAB, 0x3C, 0x79, 0x89, 0xD6, 0x89, 0x8F, 0x30, 0x89, 0x64, 0x20, 0x45,
+    0x2A, 0xE8, 0x22, 0xE6, 0x8E, 0xAA, 0x51, 0x45, 0xCD, 0xB6, 0x38, 0x1C, 0x93, 0x92, 0xFF, 0x07,
+    0x8D, 0x0D, 0xC6, 0xD8, 0xA6, 0x6D, 0x37, 0x1B, 0x50, 0x64, 0x21, 0x7B, 0x01, 0xE6, 0xEF, 0x79,
+    0x0C, 0x8F, 0xE5, 0x39, 0xFE, 0x7D, 0x4D, 0xAE, 0x91, 0x76, 0x2D, 0x7A, 0x8B, 0x68, 0x46, 0xFE,
+    0x3D, 0xDA, 0xEE, 0xD0, 0xE5, 0x0E, 0xD1, 0x2B, 0xAF, 0x09, 0x75, 0x0D, 0x13, 0x73, 0xD6, 0xA4,
+    0xE1, 0xFB, 0xBA, 0x43, 0x65, 0x4C, 0xD9, 0x32, 0xB6, 0xE2, 0xAB, 0x20, 0xF0, 0x07, 0x96, 0xFD,
+    0x84, 0x2E, 0x11, 0xB5, 0x88, 0x14, 0x3F, 0x05, 0x74, 0x6E, 0x95, 0x2E, 0x75, 0xCD, 0x6C, 0x64,
+    0x66, 0x98, 0xE8, 0x9A, 0x9D, 0xF0, 0xFD, 0xA2, 0x43, 0x59, 0x4C, 0xC3, 0x8B, 0xA0, 0x8D, 0xAF,
+    0x82, 0x44, 0x4E, 0x26, 0xA1, 0xEB, 0x85, 0x5D, 0x07, 0xDB, 0x44, 0xB8, 0xD6, 0xA9, 0xD3, 0xA6,
+    0x61, 0xC7, 0x2D, 0x7C, 0xB3, 0x63, 0x69, 0xC5, 0xBF, 0x02, 0xE0, 0x01, 0x16, 0x00, 0x2D, 0xC0,
+    0x26, 0x20, 0x2F, 0xC8, 0x95, 0x05, 0x79, 0xF8, 0x7F, 0x11, 0xB0, 0x0A, 0xF8, 0x79, 0xFF, 0x20,
+    0x99, 0x18, 0xA3, 0xEC, 0x9C, 0x39, 0xB8, 0xA0, 0xBB, 0x6B, 0x64, 0x68, 0x54, 0x64, 0xF4, 0x0A,
+    0xED, 0xB6, 0xE8, 0x6D, 0x48, 0xBB, 0xBE, 0xBE, 0xF7, 0x09, 0x6D, 0x4F, 0x24, 0x09, 0x6D, 0x47,
+    0x96, 0x44, 0x18, 0x5B, 0xF6, 0xA8, 0xD0, 0xAE, 0x9E, 0xBE, 0x99, 0x47, 0x33, 0x6A, 0x8E, 0x89,
+    0x12, 0x79, 0x19, 0x24, 0xED, 0x90, 0x5A, 0x50, 0x46, 0x6C, 0xA9, 0xCF, 0x6E, 0xA6, 0x93, 0x3F,
+    0xEA, 0x3D, 0xCA, 0x32, 0x1A, 0x42, 0xF5, 0x03, 0xEA, 0xC4, 0x14, 0x43, 0xD8, 0x21, 0x65, 0xFE,
+    0xEF, 0xB5, 0x63, 0x25, 0x3D, 0x31, 0x53, 0x63, 0x2A, 0x45, 0x5B, 0x92, 0xEE, 0xA6, 0xB0, 0x09,
+    0x47, 0x31, 0xCB, 0x2C, 0xAB, 0x14, 0x02, 0x82, 0x5A, 0x58, 0x11, 0xED, 0x46, 0x18, 0xF8, 0xDF,
+    0xB5, 0xFF, 0x5B, 0x71, 0xA5, 0xE1, 0x86, 0x8E, 0x69, 0xDC, 0xA6, 0xC1, 0x80, 0xDA, 0x30, 0xB5,
+    0x28, 0x29, 0x82, 0xBF, 0xE7, 0xAE, 0x21, 0xEF, 0xA9, 0x8A, 0x44, 0x39, 0xA0, 0xBD, 0x92, 0x3A,
+    0x25, 0x45, 0x25, 0xAD, 0x61, 0xF7, 0x2E, 0x95, 0xBE, 0xC9, 0x6B, 0x62, 0xDD, 0x19, 0x85, 0x1F,
+    0xE6, 0xB1, 0xA3, 0x07, 0x54, 0xC2, 0xC8, 0x2A, 0x1A, 0x54, 0x14, 0x67, 0x14, 0x0F, 0x69, 0x2F,
+    0xFA, 0x70, 0xEA, 0xCF, 0x6A, 0xE1, 0x43, 0xE0, 0x63, 0x6C, 0xF9, 0xB6, 0xAB, 0x62, 0x5F, 0x86,
+    0xE0, 0x34, 0xA1, 0xCB, 0x55, 0xB5, 0xD5, 0x30, 0x9C, 0x55, 0x19, 0x7D, 0x93, 0xBA, 0x38, 0x2F,
+    0xD1, 0xD1, 0x83, 0xDF, 0x85, 0x89, 0x47, 0xE7, 0x68, 0x8B, 0xAC, 0x7E, 0x7C, 0x93, 0x74, 0xAF,
+    0x80, 0xD4, 0xA2, 0x4D, 0xD9, 0x37, 0x0E, 0x4D, 0x02, 0x22, 0x0D, 0x25, 0x0D, 0xA1, 0xAA, 0xF9,
+    0x55, 0x1F, 0x8D, 0x8C, 0xEB, 0x07, 0xCD, 0xD4, 0xB2, 0x9A, 0x04, 0xBF, 0xF0, 0x06, 0xBC, 0x1A,
+    0x1B, 0xFB, 0x02, 0xEC, 0x80, 0x96, 0x21, 0x1D, 0x6A, 0x05, 0x29, 0x14, 0xE5, 0x43, 0x96, 0xBB,
+    0x1E, 0xD8, 0xD3, 0x42, 0xC1, 0x0F, 0x0C, 0x04, 0x25, 0x79, 0x8F, 0x14, 0x6B, 0x79, 0xCC, 0x4D,
+    0xC0, 0x4A, 0x09, 0x13, 0x1A, 0x91, 0xD1, 0x9E, 0x51, 0x5D, 0xF3, 0x0F, 0xF2, 0xF6, 0x6F, 0xA6,
+    0x2E, 0xC6, 0xBB, 0xFA, 0xF9, 0x93, 0x9F, 0x7D, 0xE9, 0xC2, 0x24, 0xDD, 0xFD, 0xEB, 0xD2, 0xD5,
+    0xF0, 0x3F, 0x4D, 0x25, 0xA0, 0x6A, 0x00, 0xF7, 0x4E, 0xE1, 0xED, 0x5F, 0xC7, 0x1A, 0x8D, 0xF6,
+    0x61, 0x05, 0xEE, 0x41, 0x28, 0x7D, 0x29, 0x72, 0x78, 0x76, 0x1E, 0x91, 0xC3, 0x96, 0xCA, 0xAC,
+    0x59, 0xC8, 0x1A, 0xD8, 0x6B, 0x9E, 0x3B, 0x56, 0x46, 0xEC, 0xCB, 0x44, 0x41, 0x4E, 0xB9, 0x98,
+    0x5E, 0x97, 0x34, 0xAA, 0xD7, 0xEA, 0x9A, 0x03, 0x62, 0xC2, 0x72, 0xC2, 0x2E, 0x25, 0x10, 0x66,
+    0x00, 0x75, 0x19, 0x85, 0x09, 0x23, 0x90, 0x4C, 0xC1, 0x71, 0xC8, 0x0E, 0xE9, 0xCE, 0xA7, 0x61,
+    0x01, 0xA6, 0x93, 0x2C, 0xA1, 0x5D, 0x63, 0x72, 0x6F, 0xFF, 0x5D, 0x70, 0x47, 0x73, 0xE8, 0x01,
+    0xE8, 0x10, 0x8C, 0x01, 0xC7, 0xD7, 0xE8, 0xC8, 0x3B, 0x4D, 0x6F, 0x00, 0xD6, 0x19, 0xBC, 0xFD,
+    0x7E, 0x81, 0x35, 0x8A, 0x57, 0xAE, 0xB3, 0xDF, 0x27, 0x2B, 0xBD, 0xA3, 0xEB, 0x1C, 0x02, 0x3B,
+    0x69, 0x17, 0x81, 0xAA, 0x3E, 0x42, 0xDC, 0x39, 0x07, 0xEF, 0xC2, 0x49, 0x73, 0xA8, 0x3C, 0x48,
+    0xA0, 0xB3, 0x88, 0x0D, 0x8D, 0x65, 0x64, 0x85, 0x55, 0xA3, 0xAC, 0x46, 0x67, 0xFA, 0x78, 0x0C,
+    0x4C, 0x32, 0x24, 0xA7, 0xE2, 0x21, 0x25, 0xCB, 0xB1, 0x64, 0x41, 0x96, 0xE4, 0xF3, 0x02, 0xEE,
+    0x01, 0x78, 0xA6, 0x9B, 0xEC, 0xDF, 0xB5, 0x34, 0x1D, 0x53, 0x7A, 0x25, 0xDD, 0xCC, 0x4F, 0x12,
+    0x1A, 0x90, 0x31, 0x26, 0x05, 0xE1, 0x37, 0xD2, 0x93, 0xC7, 0x81, 0xF6, 0x48, 0xF2, 0xA2, 0x55,
+    0x17, 0x5E, 0x66, 0xD5, 0x73, 0xCA, 0x0B, 0x33, 0x31, 0x25, 0x30, 0xD2, 0x99, 0x51, 0xE3, 0x01,
+    0xAF, 0x7B, 0x95, 0x1C, 0x44, 0x21, 0xA6, 0x6D, 0xE6, 0x0B, 0xDE, 0x8F, 0xFD, 0xAD, 0x94, 0x0B,
+    0xD6, 0x34, 0xDB, 0x8B, 0x97, 0x00, 0x2D, 0xB2, 0x94, 0x5B, 0x8C, 0x58, 0xDE, 0x5F, 0x71, 0x74,
+    0x7B, 0x56, 0x71, 0x88, 0x1B, 0xF1, 0xBB, 0x28, 0x05, 0x0A, 0xEC, 0x60, 0x26, 0xCB, 0xB5, 0x2C,
+    0x4C, 0x2D, 0x75, 0x29, 0xE8, 0xF3, 0x35, 0x10, 0x33, 0x76, 0xAC, 0xF6, 0x5E, 0x02, 0x6C, 0x21,
+    0xAD, 0xC6, 0x4A, 0x6E, 0x1D, 0x5A, 0x09, 0xD6, 0xE8, 0x16, 0x1E, 0x76, 0x9E, 0xEC, 0x20, 0xDA,
+    0x10, 0x6C, 0xEB, 0x29, 0xD1, 0x9F, 0xC9, 0xAD, 0xAF, 0x87, 0xA9, 0xB8, 0x41, 0xEE, 0x03, 0xE9,
+    0x85, 0xE4, 0x7E, 0x96, 0xFB, 0x8C, 0xD5, 0x02, 0xF0, 0x7D, 0x0D, 0x9F, 0x46, 0xCC, 0x6E, 0x31,
+    0xCE, 0xD6, 0x19, 0x0F, 0x36, 0x19, 0xC7, 0x8A, 0x71, 0x94, 0x33, 0x0E, 0x65, 0x08, 0x39, 0x04,
+    0x69, 0x94, 0x76, 0x4B, 0x9F, 0x4C, 0xD9, 0x55, 0x64, 0x0A, 0xB0, 0x10, 0xEE, 0x20, 0x90, 0xFB,
+    0x1C, 0xDC, 0x80, 0x9E, 0x26, 0x40, 0x0F, 0x25, 0xD0, 0xE7, 0x0A, 0xE8, 0xD3, 0x02, 0x48, 0x56,
+    0x8C, 0xB6, 0x19, 0x45, 0x8C, 0x82, 0x07, 0x40, 0xDE, 0x13, 0x20, 0xF7, 0x19, 0xC7, 0x0B, 0xC3,
+    0x68, 0xC4, 0x32, 0x46, 0x08, 0xAB, 0x38, 0x64, 0xD8, 0xE3, 0x26, 0xE8, 0x77, 0x0F, 0xDE, 0xCC,
+    0xC9, 0x97, 0x0E, 0x27, 0x57, 0x28, 0xA3, 0xCB, 0x76, 0x69, 0xF3, 0xDE, 0x90, 0x7D, 0x39, 0x23,
+    0x9B, 0x55, 0x8F, 0x20, 0xFB, 0x47, 0xCC, 0x43, 0xBA, 0x36, 0xF4, 0xF0, 0xB4, 0x40, 0x3A, 0x88,
+    0x49, 0x05, 0x4C, 0x75, 0xEE, 0xEF, 0xAC, 0xCB, 0x2F, 0x9A, 0x48, 0xE4, 0xC1, 0x4A, 0x85, 0x7E,
+    0x21, 0x1A, 0xE9, 0xFA, 0x7D, 0x94, 0xB8, 0xA6, 0x3C, 0x85, 0x3F, 0x7D, 0x7D, 0xB4, 0x0A, 0x1B,
+    0x8A, 0x19, 0x39, 0xC5, 0xA1, 0x4B, 0x76, 0x39, 0xBE, 0x9F, 0xDD, 0xB5, 0x4C, 0x58, 0x2E, 0x88,
+    0x03, 0x28, 0x23, 0x6B, 0x5E, 0x47, 0x91, 0x60, 0xBB, 0x83, 0xAF, 0x32, 0x27, 0xB8, 0x63, 0xAB,
+    0xD4, 0xDB, 0xD6, 0x2A, 0xD9, 0x70, 0x03, 0xC9, 0x56, 0x69, 0xE7, 0x16, 0xCC, 0xD4, 0x94, 0x1D,
+    0x66, 0x94, 0x36, 0x99, 0xEE, 0x8A, 0x6E, 0x13, 0x32, 0xDA, 0xAD, 0xCC, 0x66, 0x26, 0x50, 0x19,
+    0x81, 0x45, 0x90, 0x35, 0xC1, 0x4F, 0x61, 0x13, 0xC6, 0x70, 0x93, 0x62, 0x4D, 0xED, 0x31, 0x0D,
+    0xB6, 0x1D, 0x1D, 0x5A, 0x81, 0x8C, 0x8C, 0x29, 0x87, 0x37, 0x1E, 0x8D, 0x37, 0x7D, 0xD9, 0x06,
+    0xAC, 0xF6, 0x7C, 0x79, 0x9E, 0x38, 0x53, 0x9C, 0x16, 0xC2, 0x1C, 0xB9, 0x64, 0x06, 0x13, 0x13,
+    0x26, 0xC5, 0x86, 0x7B, 0x10, 0x0A, 0x72, 0x31, 0xFE, 0x59, 0xE7, 0x24, 0xBC, 0x4B, 0x60, 0x55,
+    0xD5, 0xDE, 0x47, 0x05, 0x4C, 0x87, 0x2A, 0xE4, 0x1B, 0x1A, 0xC0, 0x0F, 0x29, 0xF6, 0x59, 0x3A,
+    0x8B, 0x1C, 0xE1, 0x96, 0x81, 0x82, 0x9F, 0x70, 0xE2, 0x1A, 0x73, 0x0A, 0xD3, 0x87, 0xB2, 0x44,
+    0x90, 0x9A, 0x54, 0xF4, 0x23, 0x24, 0xA4, 0x50, 0x21, 0xD3, 0x86, 0x29, 0x16, 0x66, 0xAB, 0xF3,
+    0x72, 0x67, 0x4A, 0x0B, 0x58, 0x1C, 0x96, 0xBC, 0x8C, 0xB1, 0xE2, 0x0E, 0x4A, 0x17, 0x88, 0xE5,
+    0x2A, 0x57, 0x4E, 0x85, 0x17, 0x24, 0xB7, 0x10, 0x0C, 0x7C, 0x5F, 0xEE, 0x42, 0x09, 0x8B, 0x9E,
+    0xC4, 0x5A, 0xC3, 0x05, 0x91, 0x83, 0x86, 0xCE, 0xB2, 0xF8, 0x0B, 0xA8, 0x88, 0x56, 0xDC, 0x2F,
+    0x99, 0xF8, 0x75, 0xFA, 0x0A, 0xE4, 0x04, 0xBB, 0xF4, 0x8C, 0x13, 0x8D, 0x46, 0x85, 0x06, 0x1A,
+    0x14, 0x0C, 0x9C, 0x98, 0x7A, 0xA8, 0x7B, 0x84, 0x54, 0x4F, 0x61, 0xE1, 0x72, 0x2E, 0x06, 0x0F,
+    0x4E, 0xC1, 0xE4, 0x57, 0x4C, 0x79, 0xE7, 0x22, 0xA7, 0x35, 0x4E, 0xF5, 0x01, 0x93, 0xEA, 0xA9,
+    0x39, 0xD1, 0x01, 0x97, 0x78, 0xCB, 0x1C, 0x93, 0xD7, 0x39, 0x85, 0x69, 0x24, 0x5F, 0x57, 0xC2,
+    0x46, 0xBC, 0x94, 0xD3, 0x79, 0x2A, 0x2A, 0xE6, 0x06, 0xE9, 0x7E, 0xE6, 0x99, 0x14, 0x53, 0xEF,
+    0xF1, 0xAC, 0x16, 0x5B, 0xCC, 0x26, 0x2B, 0x09, 0xCB, 0x0C, 0x59, 0x4E, 0x91, 0x60, 0x8A, 0xBE,
+    0xCF, 0xF4, 0xFC, 0x6E, 0x9E, 0xDB, 0x1D, 0x7D, 0x12, 0xB2, 0x43, 0x50, 0xA3, 0x21, 0x61, 0x98,
+    0x3C, 0xEA, 0xDF, 0x90, 0xAB, 0xD8, 0x6D, 0x15, 0x86, 0x70, 0xDE, 0xA6, 0xD5, 0xB2, 0x26, 0x8F,
+    0xE9, 0x0C, 0x78, 0xFD, 0xA4, 0xCE, 0xB2, 0x20, 0xD6, 0xA9, 0xFF, 0x7A, 0x03, 0x34, 0x7E, 0x04,
+    0x62, 0x55, 0xB7, 0xFF, 0x0E, 0x12, 0xB7, 0x51, 0xCE, 0x27, 0x14, 0x3C, 0xC9, 0x23, 0x47, 0xBF,
+    0xC5, 0x75, 0x15, 0x5F, 0xCE, 0x9D, 0x22, 0xFA, 0x55, 0x31, 0xA0, 0x02, 0x45, 0xF7, 0x18, 0xD8,
+    0x2D, 0x3A, 0x3F, 0x1C, 0x87, 0x25, 0x8B, 0x6B, 0xD2, 0xD8, 0x83, 0xF7, 0x3C, 0xDC, 0xBF, 0x4D,
+    0xDE, 0x43, 0xA4, 0x81, 0x2F, 0x02, 0xE9, 0xA1, 0xF8, 0x83, 0x97, 0xA2, 0x4E, 0x87, 0x09, 0xC3,
+    0xF1, 0x6A, 0x70, 0x6B, 0xC8, 0x85, 0xF2, 0x80, 0xFD, 0x7F, 0xA2, 0x1A, 0xFC, 0xA0, 0xF1, 0xFA,
+    0x1F, 0x93, 0xFF, 0x44, 0x85, 0x0E, 0x6A, 0x22, 0x94, 0x60, 0xC9, 0xF3, 0x51, 0x7E, 0x60, 0x8B,
+    0xC7, 0x2E, 0x5D, 0x0E, 0x1E, 0x6B, 0xB7, 0xAE, 0xD7, 0x04, 0x4F, 0x82, 0xA3, 0xA0, 0x55, 0x98,
+    0x83, 0xF3, 0x31, 0xDA, 0x06, 0xF3, 0x53, 0x8A, 0x36, 0x66, 0x18, 0xBE, 0x8D, 0x59, 0xA8, 0x9B,
+    0x2D, 0xAC, 0x1D, 0xC2, 0xC0, 0x56, 0xFF, 0x5C, 0xDD, 0xDF, 0xA3, 0xF0, 0x37, 0x4F, 0x13, 0xCF,
+    0x84, 0x7A, 0xBE, 0xF9, 0xD3, 0xDC, 0x6E, 0x0E, 0x8F, 0xCA, 0xD0, 0x68, 0x4C, 0x4C, 0xB5, 0xD7,
+    0xBF, 0x76, 0xB8, 0x79, 0x44, 0xE7, 0x83, 0x47, 0x85, 0x3B, 0x2F, 0x16, 0x69, 0x54, 0x90, 0xCE,
+    0x5C, 0xB5, 0xCE, 0x75, 0x69, 0x4E, 0x17, 0x1E, 0x27, 0x08, 0x37, 0xF5, 0xFD, 0x71, 0x17, 0x8C,
+    0x7C, 0x84, 0xAA, 0x9D, 0x8F, 0xF7, 0xAE, 0x4A, 0xF1, 0xE4, 0x99, 0x0C, 0xD2, 0x02, 0x96, 0x0D,
+    0x23, 0xC7, 0x1E, 0x0C, 0x41, 0x32, 0x6F, 0x37, 0x72, 0x2E, 0xD2, 0x88, 0x8D, 0xCE, 0xFF, 0x75,
+    0x8F, 0x84, 0x41, 0x36, 0x42, 0x25, 0x12, 0x63, 0xC4, 0x16, 0xFA, 0x85, 0x2D, 0xFC, 0xB6, 0x31,
+    0x33, 0xDA, 0xC8, 0xF0, 0x7E, 0xE7, 0x64, 0x4D, 0x14, 0x61, 0xEA, 0x41, 0x07, 0x9E, 0x14, 0x27,
+    0x82, 0xAF, 0x84, 0x9A, 0x54, 0xA2, 0xC2, 0x53, 0x2E, 0x6C, 0xB7, 0xB3, 0x94, 0x44, 0xB9, 0x78,
+    0xC9, 0xE9, 0xAB, 0xD1, 0x8C, 0xEB, 0x3F, 0x6B, 0x82, 0x74, 0xA6, 0x17, 0xE2, 0xEE, 0xF8, 0x93,
+    0x23, 0x9C, 0x2F, 0xB7, 0x5F, 0x4E, 0xA3, 0xEC, 0xF7, 0x3C, 0x39, 0x01, 0x75, 0x6B, 0xB8, 0x6F,
+    0x01, 0x14, 0x79, 0x9F, 0x49, 0xD0, 0x2D, 0xB9, 0x5C, 0x27, 0xEF, 0xAF, 0xC8, 0xED, 0x12, 0xB5,
+    0x2A, 0xE6, 0x7B, 0x32, 0x82, 0x9F, 0x06, 0xF9, 0xA4, 0x72, 0xCB, 0x09, 0xAA, 0x4A, 0xEF, 0xC4,
+    0xD3, 0x57, 0x93, 0xE9, 0xD2, 0xC6, 0x6D, 0xE7, 0x36, 0x45, 0x0F, 0x4D, 0x68, 0xE0, 0x29, 0xE1,
+    0xDD, 0x30, 0x11, 0x08, 0xA5, 0x5C, 0x8F, 0xC2, 0x2E, 0x19, 0xCB, 0xD3, 0x61, 0x96, 0x8C, 0x97,
+    0x8F, 0xA6, 0xA2, 0xF2, 0xAA, 0xA5, 0x8D, 0x8F, 0x79, 0xC5, 0x44, 0x94, 0xE8, 0x37, 0xB5, 0xC8,
+    0x5F, 0x75, 0x62, 0xAE, 0xC6, 0xCC, 0x29, 0xBD, 0x97, 0x90, 0xFF, 0x8C, 0x73, 0x0F, 0x1A, 0x0A,
+    0xDB, 0x01, 0xB3, 0x39, 0x86, 0x47, 0x80, 0x1B, 0xCF, 0x36, 0xDE, 0x73, 0xE3, 0x19, 0xFC, 0xB2,
+    0xA4, 0xB9, 0xAD, 0xF5, 0x37, 0x6E, 0xD3, 0x88, 0x35, 0x59, 0x9E, 0xCE, 0xA7, 0x3C, 0xF8, 0x94,
+    0xF7, 0x60, 0xF6, 0x82, 0xA4, 0x6D, 0x94, 0xE3, 0xD0, 0x0A, 0x37, 0x39, 0xD3, 0xF3, 0xCD, 0x0D,
+    0x15, 0x6D, 0x98, 0x53, 0xBA, 0xC9, 0xBF, 0x60, 0x65, 0x6B, 0x47, 0x5C, 0xAD, 0x86, 0x11, 0x98,
+    0x32, 0x1A, 0x72, 0x8E, 0x1E, 0x56, 0xE2, 0x4F, 0x43, 0xA1, 0x5B, 0x42, 0xBD, 0xDC, 0xF6, 0x7D,
+    0xAE, 0xB7, 0x09, 0xEA, 0x58, 0xBB, 0x43, 0x5B, 0x7E, 0x7A, 0x57, 0xC0, 0xD2, 0xD9, 0x7B, 0x23,
+    0x64, 0x35, 0x14, 0x57, 0xA8, 0xC0, 0x3C, 0xB9, 0x29, 0xA4, 0x16, 0x72, 0xEC, 0xA7, 0xD1, 0xD4,
+    0xF2, 0x8D, 0xFC, 0x97, 0xB2, 0x1B, 0x04, 0x8F, 0xD0, 0x0F, 0x72, 0xE7, 0x77, 0xEC, 0x25, 0x39,
+    0xC6, 0xA1, 0xC5, 0xB3, 0x46, 0xBB, 0x94, 0x8C, 0x64, 0xD4, 0x98, 0xC1, 0xF1, 0xE6, 0x5E, 0xAB,
+    0x37, 0x90, 0xEE, 0xC1, 0x2F, 0x14, 0x4D, 0xFE, 0x66, 0x77, 0xEC, 0xF7, 0x96, 0x7A, 0x13, 0x15,
+    0xC1, 0x61, 0x44, 0x1A, 0xA4, 0x02, 0x24, 0xF9, 0xA0, 0x9D, 0x73, 0xCE, 0x32, 0xE2, 0xED, 0x0A,
+    0xA2, 0x21, 0x5A, 0xDF, 0x0C, 0x31, 0x7B, 0x00, 0x49, 0x76, 0x38, 0xA2, 0x02, 0x50, 0x9D, 0xF7,
+    0x7B, 0x0E, 0xF5, 0x93, 0x89, 0x0A, 0x90, 0x78, 0xC3, 0x24, 0x4C, 0x03, 0x14, 0xC5, 0x91, 0x5C,
+    0x00, 0x5D, 0xDF, 0x95, 0xCB, 0x58, 0xE5, 0x67, 0x6A, 0x05, 0xEB, 0xFC, 0x56, 0x23, 0x3F, 0xAA,
+    0x5C, 0x6F, 0x92, 0xF3, 0x6F, 0x39, 0x46, 0x9A, 0xFA, 0x32, 0x1D, 0x40, 0xC1, 0xFF, 0x49, 0x62,
+    0xC9, 0xDF, 0x09, 0x78, 0xAD, 0x6D, 0x84, 0x6F, 0x0E, 0x36, 0xA8, 0xB1, 0x96, 0xAE, 0xF5, 0x7B,
+    0xA3, 0x72, 0x92, 0x7B, 0xEA, 0x52, 0x5D, 0xBA, 0x96, 0x9B, 0xF5, 0x9E, 0x3C, 0x82, 0xA3, 0xF9,
+    0x77, 0x94, 0x6D, 0xE7, 0x1D, 0x39, 0x80, 0x8C, 0x22, 0xBC, 0x8E, 0xA4, 0xD1, 0xA6, 0x68, 0x78,
+    0xD0, 0x70, 0x7A, 0xF0, 0xE0, 0x61, 0xF7, 0xC0, 0xF2, 0xE0, 0x6A, 0x64, 0xDC, 0x02, 0xEB, 0x8C,
+    0xC1, 0xC3, 0x00, 0x6B, 0xC5, 0xCA, 0x66, 0x72, 0xBB, 0x96, 0xDF, 0xC4, 0x9A, 0xA0, 0xFE, 0xC2,
+    0xC1, 0x11, 0xEF, 0x2C, 0x9C, 0xBB, 0x8B, 0xD7, 0x4B, 0x20, 0xC3, 0xE8, 0x4D, 0xA1, 0x3E, 0x82,
+    0x94, 0x43, 0xDB, 0x82, 0x64, 0x9C, 0xB9, 0xA0, 0x68, 0xFB, 0x62, 0xBD, 0x43, 0xEB, 0xF7, 0xFA,
+    0x05, 0x8A, 0x5B, 0xAB, 0x33, 0x9B, 0x6F, 0x64, 0xBD, 0xD2, 0x4A, 0x13, 0x29, 0xFF, 0x0F, 0xD3,
+    0x5F, 0xEA, 0xF7, 0x7B, 0x5D, 0x53, 0x37, 0x2E, 0xB8, 0xEF, 0xD7, 0x8F, 0x86, 0x3B, 0xD9, 0xFA,
+    0x58, 0x84, 0xE9, 0x84, 0xFC, 0xE5, 0x27, 0x39, 0x67, 0xBF, 0x05, 0xB9, 0xC9, 0xCE, 0xA2, 0x48,
+    0xD7, 0x17, 0x68, 0x73, 0x19, 0x5D, 0x7B, 0x32, 0x89, 0x64, 0x87, 0x3B, 0x61, 0xC2, 0xCB, 0xE8,
+    0x03, 0x15, 0x7E, 0xAE, 0x45, 0xAA, 0x44, 0x92, 0x9F, 0x73, 0x79, 0xCC, 0xFC, 0xA8, 0xD8, 0x7F,
+    0x2A, 0xAE, 0xEA, 0x32, 0xBE, 0x7B, 0xAE, 0x69, 0x8F, 0x8A, 0xA8, 0x42, 0xD2, 0xBB, 0x1B, 0x3B,
+    0xAA, 0xA5, 0x57, 0x84, 0xE2, 0x0F, 0x36, 0xFC, 0x55, 0xEA, 0xC2, 0xE3, 0x1F, 0xEC, 0x27, 0x4C,
+    0x49, 0x6E, 0x1F, 0x4F, 0x8F, 0xB8, 0xE9, 0xE1, 0x52, 0x6E, 0x64, 0x38, 0x6D, 0x3B, 0xD7, 0x78,
+    0x0F, 0xFE, 0xE2, 0x51, 0xC2, 0x80, 0x1D, 0xAE, 0x05, 0x85, 0xAA, 0x0B, 0x11, 0xC2, 0x1E, 0xFD,
+    0x1E, 0xF7, 0xA7, 0xAF, 0xB3, 0xFC, 0x1C, 0x35, 0x7B, 0x44, 0x4D, 0xBA, 0xC1, 0x1E, 0x9A, 0xF7,
+    0xD0, 0x64, 0xFB, 0x76, 0x6E, 0xE6, 0x6B, 0x5A, 0x2E, 0x3C, 0xBE, 0x82, 0xCE, 0xD8, 0x7C, 0xDA,
+    0x3C, 0xBE, 0x16, 0x3A, 0xDC, 0xC3, 0xEE, 0x60, 0x39, 0x29, 0x42, 0xD6, 0x5B, 0x91, 0x0D, 0x04,
+    0x7F, 0xB2, 0x69, 0x15, 0x4C, 0x8E, 0x22, 0x0D, 0x4F, 0xB6, 0x54, 0x31, 0x4F, 0xEF, 0xEC, 0xD7,
+    0x5C, 0xB1, 0xC1, 0x34, 0x1F, 0xF8, 0xFE, 0xF7, 0x1F, 0xDB, 0xE7, 0x31, 0x1D, 0x68, 0x71, 0x58,
+    0xA2, 0x57, 0x0F, 0x2B, 0x7E, 0xD0, 0x12, 0xB0, 0x49, 0x16, 0xD9, 0x10, 0x54, 0x32, 0x2D, 0x3C,
+    0x41, 0x3D, 0x3F, 0x9D, 0x69, 0xE9, 0x15, 0x96, 0x16, 0xF5, 0xF5, 0xD0, 0xF2, 0x5F, 0x95, 0x53,
+    0xBB, 0x72, 0xD3, 0x40, 0x14, 0x3D, 0xD2, 0x32, 0x68, 0x40, 0xD8, 0x4B, 0x01, 0x0D, 0x89, 0xE3,
+    0x56, 0xE4, 0x61, 0x37, 0x2E, 0x54, 0x48, 0x68, 0x19, 0x0A, 0x7E, 0x00, 0xA8, 0x3D, 0x74, 0x81,
+    0x19, 0x70, 0xE1, 0xC2, 0x85, 0x88, 0x35, 0x7C, 0x41, 0x3E, 0x83, 0x81, 0xC6, 0x45, 0x0A, 0x17,
+    0x71, 0xAC, 0x19, 0x4A, 0x9A, 0xED, 0x28, 0x68, 0x5C, 0x53, 0xA9, 0xD8, 0xC2, 0x09, 0xB1, 0xC5,
+    0x59, 0x39, 0x4C, 0x32, 0x26, 0x0C, 0x70, 0xB5, 0x7B, 0xA4, 0xD5, 0x7D, 0x68, 0xEF, 0x39, 0xAB,
+    0xB4, 0x95, 0xB6, 0xD2, 0xBD, 0xB0, 0x11, 0x6E, 0x76, 0xEE, 0x00, 0x08, 0x6E, 0x03, 0x61, 0x1D,
+    0xE8, 0xD4, 0x80, 0xDE, 0x66, 0x35, 0xDB, 0x65, 0xA9, 0x1F, 0x9C, 0x9D, 0x64, 0xD0, 0x1D, 0xD8,
+    0xE9, 0xE4, 0x3D, 0xB8, 0xF9, 0x08, 0x3B, 0xDF, 0xCF, 0xD4, 0xB0, 0x2C, 0x33, 0xA1, 0x34, 0x3C,
+    0x27, 0x87, 0xEF, 0xE6, 0x90, 0x22, 0x43, 0x9D, 0x13, 0x81, 0x1D, 0x6E, 0xA9, 0xE5, 0xBE, 0x69,
+    0x05, 0xE3, 0x38, 0xE8, 0xC7, 0x01, 0xDA, 0x01, 0xE4, 0x1C, 0x62, 0x09, 0x0C, 0x67, 0xD8, 0x99,
+    0x23, 0x38, 0xEE, 0x04, 0xD1, 0x38, 0x88, 0xD2, 0x20, 0x4D, 0x1E, 0x16, 0x7E, 0x99, 0xAD, 0xB2,
+    0xEC, 0xA8, 0x4C, 0x1A, 0x70, 0x07, 0xD1, 0x1E, 0x22, 0x60, 0x20, 0xD1, 0x07, 0x8E, 0x24, 0x0A,
+    0xC0, 0xC8, 0xC7, 0xDA, 0xE2, 0x93, 0xDC, 0xE2, 0x53, 0x05, 0x8C, 0xA5, 0xF4, 0x67, 0x18, 0x34,
+    0x1B, 0x71, 0x8A, 0x38, 0x8E, 0x06, 0x5B, 0xF0, 0x4D, 0x9F, 0xC1, 0x40, 0x61, 0x88, 0x8E, 0x36,
+    0x52, 0x41, 0xE4, 0xF6, 0xD9, 0x53, 0x16, 0x25, 0x83, 0x81, 0x86, 0x2D, 0xCE, 0xEA, 0x4D, 0x83,
+    0xAB, 0x36, 0xE4, 0xD2, 0x31, 0x07, 0x80, 0xD0, 0x4D, 0x0B, 0xF2, 0x02, 0xDC, 0xA2, 0x45, 0xEF,
+    0x7C, 0x6E, 0x43, 0xB2, 0xED, 0x43, 0xA7, 0x54, 0xC9, 0xA1, 0xFF, 0x45, 0x47, 0x68, 0xBB, 0x26,
+    0xC4, 0x23, 0x4C, 0x3A, 0x88, 0x91, 0x8C, 0x08, 0x72, 0xC6, 0xA5, 0x28, 0xD0, 0x86, 0x77, 0x0E,
+    0xA9, 0xDF, 0x24, 0xA4, 0xC2, 0xC8, 0xD5, 0x57, 0xD2, 0x34, 0x0D, 0x43, 0x32, 0xC9, 0x46, 0x46,
+    0x38, 0xEA, 0x15, 0xD3, 0x4F, 0xC5, 0xCD, 0x05, 0x36, 0xCA, 0x6C, 0xF1, 0xB2, 0xE8, 0x8E, 0xBA,
+    0x7C, 0x89, 0x6E, 0x15, 0x18, 0x5E, 0x8E, 0x57, 0x27, 0x1F, 0x86, 0xE5, 0xE2, 0xEA, 0x1B, 0xDC,
+    0x03, 0xC9, 0xD9, 0xE5, 0x53, 0x07, 0x3D, 0xE6, 0xCC, 0xA0, 0x9D, 0xDC, 0xA5, 0x16, 0x1E, 0x7C,
+    0xD4, 0x51, 0x5B, 0x73, 0x5E, 0xD8, 0x2D, 0xE0, 0x18, 0x64, 0xEA, 0x00, 0xDE, 0x0C, 0x09, 0xB8,
+    0x49, 0xBB, 0xC2, 0x84, 0x37, 0x6D, 0x5D, 0x64, 0x64, 0xC5, 0x40, 0xB9, 0xB8, 0xFF, 0xFC, 0xD9,
+    0x25, 0x21, 0xBF, 0x96, 0xDD, 0xB5, 0x14, 0xE7, 0xBC, 0x2A, 0xA8, 0x57, 0x05, 0xE9, 0xEA, 0x5D,
+    0x64, 0xEC, 0x9C, 0x12, 0xBC, 0xD3, 0xD7, 0xAC, 0xDA, 0xA6, 0x3C, 0xD4, 0xC9, 0xD6, 0x16, 0x5C,
+    0xFA, 0xF0, 0xB2, 0xE4, 0x87, 0xA7, 0xA4, 0x53, 0xB4, 0x44, 0xB6, 0x25, 0xF2, 0x58, 0x64, 0x91,
+    0x9F, 0x45, 0x44, 0xA9, 0x88, 0x61, 0x13, 0xA9, 0x50, 0x54, 0x67, 0xEC, 0x59, 0x8D, 0x8C, 0x6F,
+    0xA5, 0x37, 0x35, 0x44, 0xFE, 0xD7, 0x77, 0x03, 0x44, 0xEE, 0x82, 0xDC, 0xEE, 0xAD, 0x8E, 0x47,
+    0x85, 0x7E, 0x0E, 0x47, 0xC1, 0x35, 0xD8, 0x50, 0x76, 0xA3, 0x56, 0x1C, 0x67, 0x9F, 0x30, 0x5D,
+    0xF2, 0xF4, 0x51, 0xD8, 0xA1, 0xF2, 0x34, 0xC9, 0xF8, 0x2F, 0x10, 0x97, 0x30, 0x23, 0x8D, 0x6E,
+    0x81, 0x01, 0xB0, 0x7C, 0x41, 0xC5, 0xDA, 0x3C, 0xA4, 0x95, 0x4D, 0x8B, 0x09, 0x3B, 0xFF, 0xFB,
+    0x35, 0x61, 0x24, 0x28, 0xC0, 0x88, 0xD4, 0x74, 0x28, 0xC8, 0x2E, 0x8B, 0xD6, 0x28, 0x10, 0x69,
+    0x80, 0x50, 0x22, 0xE3, 0x3F, 0x93, 0xAF, 0xB9, 0x91, 0xCC, 0x9D, 0x39, 0xFE, 0xE1, 0x72, 0xE6,
+    0x89, 0x6D, 0x37, 0xB0, 0x47, 0x18, 0x27, 0xC0, 0x37, 0xB8, 0x9F, 0x95, 0x78, 0x9F, 0x7B, 0xD0,
+    0x75, 0x14, 0x9B, 0xE8, 0x47, 0x88, 0xFA, 0x68, 0xDC, 0xC5, 0x8D, 0x84, 0xBF, 0xE9, 0xF6, 0xC7,
+    0x8F, 0xCA, 0xAA, 0xD5, 0xE2, 0xB7, 0xDD, 0x8C, 0xBC, 0x38, 0xC6, 0x76, 0xC6, 0x0E, 0xD7, 0x06,
+    0x29, 0x78, 0xAB, 0xE8, 0x87, 0x97, 0x5F, 0xE3, 0x65, 0x8A, 0xC3, 0x8E, 0xA6, 0xAC, 0x85, 0xD9,
+    0x9F, 0x6C, 0x59, 0xE9, 0x42, 0x06, 0xED, 0xF8, 0x2D, 0xDF, 0xEE, 0xF5, 0x40, 0x5D, 0xF3, 0xED,
+    0x2A, 0x9E, 0x89, 0x55, 0x71, 0x6B, 0x4D, 0x5D, 0x8F, 0x4D, 0xAD, 0xD7, 0xDA, 0x1D, 0xF9, 0x3C,
+    0x40, 0xEA, 0x27, 0xC5, 0x59, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0x24, 0x2D, 0xD1, 0x32, 0xAD,
+    0xFB, 0x0C, 0x44, 0x42, 0x0C, 0x58, 0x36, 0x3D, 0x68, 0x50, 0x91, 0xD3, 0xD1, 0xC3, 0x01, 0xBD,
+    0x00, 0xC7, 0x23, 0x95, 0x0C, 0x19, 0x8C, 0x22, 0x1A, 0x4E, 0x31, 0x50, 0x17, 0x4D, 0x86, 0x2E,
+    0x76, 0x83, 0x5A, 0x05, 0x8A, 0x42, 0x40, 0x4F, 0x3A, 0xC6, 0x1E, 0xBA, 0xAA, 0x40, 0x90, 0x0E,
+    0x5D, 0x0C, 0xB4, 0x83, 0xDD, 0x02, 0xD1, 0x0D, 0x01, 0x2A, 0x34, 0x27, 0x1D, 0x1D, 0x0F, 0x19,
+    0x82, 0xC0, 0xB4, 0x8D, 0xA6, 0x43, 0x87, 0x32, 0x68, 0x3B, 0x34, 0x46, 0x6B, 0x0E, 0x14, 0x40,
+    0x21, 0x77, 0xC7, 0xFE, 0xDE, 0x47, 0xDE, 0x9D, 0x9C, 0xD4, 0x71, 0x64, 0xD9, 0x2A, 0x8F, 0xEF,
+    0x41, 0x1F, 0xF9, 0x7D, 0xEF, 0xBD, 0xEF, 0x7D, 0xEF, 0x2F, 0x35, 0xB5, 0xB6, 0x36, 0x4F, 0x47,
+    0x8A, 0xC5, 0x62, 0x15, 0x97, 0x8D, 0xAB, 0xF6, 0x1D, 0x9A, 0x20, 0x9A, 0x24, 0xEA, 0x84, 0xFA,
+    0x7F, 0xBA, 0xE2, 0x7B, 0xB6, 0x35, 0x59, 0xAD, 0x4D, 0x92, 0x3D, 0xB8, 0x6B, 0xF2, 0x36, 0x27,
+    0x49, 0x7C, 0x7A, 0x5C, 0x4B, 0xBB, 0x74, 0x65, 0x9D, 0x27, 0xE3, 0xC6, 0xA5, 0xA4, 0x21, 0xE9,
+    0x77, 0xBB, 0x24, 0xA8, 0x4A, 0xA6, 0x84, 0x13, 0x00, 0xC2, 0x18, 0xE0, 0x12, 0x5D, 0xF9, 0xC2,
+    0xA3, 0x1F, 0x03, 0xD4, 0x00, 0x73, 0xC3, 0x0C, 0xF8, 0x6F, 0xCD, 0x23, 0x32, 0x6E, 0x28, 0xAE,
+    0x93, 0xA6, 0xF4, 0xA3, 0x53, 0x5D, 0xCA, 0xAF, 0xF2, 0xA5, 0xA2, 0x95, 0x26, 0x82, 0xA2, 0x19,
+    0x2A, 0x17, 0xA9, 0x82, 0x1B, 0x7F, 0x60, 0x68, 0xA5, 0x71, 0xE5, 0x52, 0x11, 0x13, 0x3A, 0x91,
+    0x13, 0x5A, 0x81, 0xE9, 0x09, 0xCF, 0x20, 0xC3, 0x2F, 0x90, 0x16, 0xCC, 0x90, 0x1A, 0x55, 0x88,
+    0xE2, 0x65, 0xA2, 0x4D, 0x10, 0xB7, 0x7D, 0x1A, 0xEF, 0xFC, 0x8B, 0xC6, 0x37, 0xBE, 0x90, 0x02,
+    0x8C, 0x6F, 0xDC, 0x94, 0x20, 0x85, 0x61, 0xB0, 0x3C, 0xE2, 0x3D, 0x84, 0xC3, 0x4B, 0xF2, 0x1D,
+    0x0D, 0x95, 0xD4, 0x33, 0x7E, 0x1D, 0x15, 0x28, 0x3A, 0x4D, 0xAD, 0x33, 0x44, 0xA6, 0x4B, 0x22,
+    0x26, 0x33, 0xA5, 0x4A, 0x33, 0xAC, 0xE8, 0x89, 0x4D, 0x6D, 0xCB, 0xB3, 0x45, 0x52, 0x54, 0xD3,
+    0xB7, 0xC9, 0x8A, 0x48, 0x8B, 0xC0, 0xF5, 0x28, 0x55, 0x4E, 0x53, 0xD9, 0xA4, 0x65, 0xF1, 0x59,
+    0xA8, 0x6C, 0xBB, 0xB3, 0x47, 0x1B, 0x56, 0xA3, 0x34, 0xD8, 0xD1, 0xA9, 0x74, 0x9D, 0xA8, 0xB7,
+    0xD4, 0x86, 0xA4, 0xE0, 0x2F, 0xE8, 0xB2, 0xEA, 0x17, 0x8D, 0xDF, 0x04, 0x61, 0xE5, 0x8C, 0x12,
+    0x2C, 0x2F, 0x57, 0xC9, 0x2D, 0xB7, 0x1A, 0x44, 0x95, 0xD6, 0x0A, 0xD1, 0x5C, 0x86, 0x78, 0x88,
+    0x17, 0x54, 0x2E, 0x97, 0x68, 0x71, 0xB9, 0x28, 0xDE, 0xF3, 0xA3, 0x82, 0xF2, 0x27, 0xD5, 0xD7,
+    0x7D, 0x32, 0x5C, 0xDA, 0x55, 0xB6, 0x20, 0x55, 0x1A, 0x64, 0xD4, 0x8D, 0x84, 0x4C, 0x93, 0x26,
+    0x04, 0x29, 0x1B, 0x54, 0x7A, 0x9D, 0xAA, 0x38, 0x06, 0x93, 0xAC, 0x3F, 0x78, 0x63, 0x0B, 0x2E,
+    0x2D, 0x9E, 0x50, 0xFC, 0x50, 0xBF, 0xE6, 0x0B, 0xC3, 0xAB, 0x59, 0xB4, 0xEA, 0x90, 0x25, 0x5C,
+    0xE3, 0x35, 0x5F, 0xBB, 0x15, 0x50, 0xB0, 0x7C, 0xF9, 0xF7, 0x37, 0x9A, 0x69, 0x8F, 0xF2, 0x83,
+    0xCC, 0xEF, 0x66, 0xB7, 0xD9, 0x7D, 0x8C, 0xDC, 0xD3, 0x75, 0xC8, 0x6D, 0x3D, 0xF4, 0xC2, 0x8A,
+    0xF1, 0x0A, 0xE4, 0x36, 0x16, 0xC2, 0x72, 0xCB, 0x58, 0x08, 0x2A, 0x2D, 0x50, 0x9C, 0x6B, 0x19,
+    0x7D, 0xC8, 0x6D, 0xBC, 0x0E, 0xB9, 0x8D, 0xF3, 0x5E, 0xB9, 0x6C, 0xBC, 0x1A, 0x2C, 0x17, 0xCD,
+    0x5F, 0xC5, 0x51, 0x61, 0x7A, 0xF1, 0x8D, 0xFF, 0x29, 0xF7, 0xF4, 0xD2, 0x12, 0x1F, 0x3D, 0x8C,
+    0xC0, 0x8C, 0xED, 0x46, 0xAB, 0x10, 0x89, 0x56, 0x61, 0x65, 0xDE, 0x4A, 0x14, 0x97, 0xDF, 0x56,
+    0x46, 0xF7, 0xE5, 0x6D, 0x29, 0xE7, 0x9E, 0x27, 0x34, 0x95, 0x11, 0xA8, 0xE3, 0xF9, 0xB1, 0xF5,
+    0xD5, 0x76, 0xCB, 0x3E, 0x6B, 0xC3, 0xF0, 0x56, 0x28, 0xD4, 0xBC, 0x82, 0xFA, 0xF2, 0xF7, 0xD3,
+    0xFE, 0x52, 0x7D, 0x1C, 0xCF, 0x23, 0xFB, 0x2C, 0x9E, 0x1A, 0xC1, 0x58, 0x9B, 0x4A, 0x9E, 0x15,
+    0xDA, 0xDB, 0xC9, 0x18, 0x9B, 0x80, 0x57, 0xC2, 0xD4, 0x75, 0x10, 0xA9, 0x53, 0x9B, 0x36, 0x9F,
+    0x00, 0x89, 0x84, 0x2D, 0xB5, 0x4B, 0x9D, 0x8B, 0xAB, 0xF4, 0xC7, 0x9E, 0xE5, 0xE2, 0xBC, 0x89,
+    0x21, 0x06, 0xF4, 0xD8, 0x1E, 0x01, 0x36, 0xF1, 0xCE, 0xD2, 0xA0, 0xD9, 0xFB, 0x09, 0x75, 0xBA,
+    0x45, 0x4A, 0xF7, 0x00, 0x8F, 0x9B, 0x00, 0x0B, 0xA0, 0xBC, 0x0D, 0x0B, 0x9E, 0xF9, 0x96, 0xD0,
+    0x28, 0xB9, 0x6A, 0xD7, 0x0C, 0x4E, 0xAE, 0xAD, 0xCD, 0xF1, 0xE1, 0x08, 0x5F, 0x0D, 0x95, 0xF0,
+    0x42, 0xD0, 0x74, 0xC9, 0x35, 0xFC, 0x0F, 0xFD, 0x17, 0x7C, 0x6D, 0xCF, 0xEF, 0xA5, 0x64, 0xBA,
+    0xAE, 0xF7, 0xC8, 0x14, 0xAE, 0xAD, 0xFB, 0x55, 0x2D, 0xBF, 0xE7, 0x75, 0x4F, 0x6C, 0x90, 0x52,
+    0xA7, 0x13, 0x53, 0x6C, 0xA1, 0x67, 0x04, 0x89, 0x5F, 0xFA, 0xDA, 0xBD, 0x48, 0xFB, 0x3C, 0x32,
+    0x6E, 0x07, 0x30, 0x8B, 0x62, 0x81, 0xBD, 0x8C, 0xA4, 0xCE, 0xF5, 0x80, 0x4D, 0xA0, 0x19, 0x10,
+    0x1E, 0xBC, 0x10, 0xB0, 0x9E, 0x71, 0xF0, 0x2D, 0x89, 0x43, 0xC6, 0xAA, 0xCF, 0x98, 0xDD, 0x56,
+    0x0B, 0x0C, 0x5A, 0x04, 0x2E, 0xA8, 0x11, 0xBD, 0xB4, 0x5B, 0xD4, 0x23, 0x9A, 0xAE, 0x57, 0x26,
+    0x59, 0x29, 0xAD, 0x39, 0xC6, 0xE1, 0x32, 0xB0, 0xEA, 0xFB, 0xC0, 0xDA, 0xD5, 0x34, 0x75, 0xC9,
+    0x20, 0x05, 0x7F, 0x17, 0xA4, 0xE2, 0x8A, 0xA4, 0xEF, 0x32, 0xBB, 0xB1, 0xFA, 0x88, 0xEF, 0x8C,
+    0xE4, 0x5B, 0x91, 0x7C, 0x1F, 0xCB, 0x91, 0x71, 0x61, 0x7C, 0x1D, 0xB8, 0x68, 0x37, 0xC0, 0xB7,
+    0xB2, 0x52, 0x02, 0xDF, 0xD6, 0x09, 0x76, 0xB4, 0x90, 0x4A, 0xCC, 0x11, 0x56, 0xC0, 0x71, 0x05,
+    0x24, 0x0C, 0x1E, 0x81, 0xA3, 0xA1, 0x32, 0x47, 0xFB, 0x02, 0xDB, 0x4D, 0x27, 0xCD, 0xEC, 0x86,
+    0x40, 0x84, 0x68, 0xB5, 0x0D, 0xB6, 0x91, 0x8D, 0xE7, 0xB0, 0x12, 0xAC, 0x80, 0xF9, 0x90, 0xC1,
+    0x2C, 0xC7, 0xDA, 0xCC, 0xB1, 0x04, 0x86, 0x9E, 0x55, 0x50, 0xDC, 0xD0, 0x2E, 0x1A, 0xFE, 0x76,
+    0x52, 0x31, 0xFD, 0x31, 0xB7, 0xF5, 0x5D, 0x10, 0x0D, 0x7F, 0xEB, 0x93, 0x7A, 0xEB, 0xB6, 0x4F,
+    0xDA, 0x35, 0x0D, 0x86, 0x6D, 0xC0, 0x38, 0x0B, 0x04, 0x13, 0x2F, 0x12, 0x86, 0x15, 0x32, 0xFF,
+    0xC1, 0x4C, 0x16, 0xE9, 0x08, 0x91, 0x23, 0xEF, 0x2C, 0x10, 0x60, 0x78, 0x9C, 0x78, 0xA3, 0x33,
+    0xA4, 0x74, 0x79, 0xCF, 0x88, 0x2B, 0x78, 0x59, 0x63, 0xE3, 0x61, 0xF3, 0x35, 0xA9, 0x6D, 0x7C,
+    0x16, 0xD3, 0xFB, 0x5E, 0xE6, 0x1E, 0x16, 0x23, 0xC1, 0x03, 0xDE, 0x07, 0xD1, 0xF5, 0x81, 0x57,
+    0x4A, 0xDB, 0x53, 0xD9, 0xF8, 0xB4, 0x84, 0x95, 0xD7, 0xE0, 0x18, 0xC0, 0xF6, 0x37, 0xC9, 0x4B,
+    0x66, 0x38, 0xF2, 0x56, 0x78, 0x5D, 0xD9, 0xC0, 0xBA, 0x16, 0xF8, 0x50, 0xA4, 0x85, 0x08, 0xD2,
+    0x69, 0xC4, 0x94, 0x62, 0x56, 0x0F, 0xD8, 0xC3, 0xBA, 0x38, 0x40, 0xDB, 0x2C, 0x45, 0x93, 0xD2,
+    0x48, 0x4F, 0xC3, 0x9C, 0xBC, 0xE9, 0xE6, 0xF6, 0x4C, 0x1F, 0x30, 0x0A, 0x0E, 0x89, 0xAF, 0xA4,
+    0xAC, 0x73, 0xEC, 0x11, 0x88, 0xB9, 0x34, 0xA7, 0xB9, 0xCF, 0x9D, 0xEF, 0x18, 0x53, 0x77, 0x02,
+    0x2C, 0xFB, 0x79, 0x0A, 0xB4, 0x58, 0x7A, 0xFE, 0x5B, 0x3D, 0x3A, 0x8E, 0xB5, 0x35, 0x4E, 0x42,
+    0x25, 0x31, 0xDC, 0xE0, 0x21, 0x68, 0x57, 0x12, 0x2D, 0xB0, 0x62, 0x8F, 0xB3, 0x1F, 0x4D, 0x16,
+    0x06, 0xCA, 0x7E, 0x3E, 0x2C, 0xD3, 0x94, 0x71, 0x69, 0xE7, 0x02, 0x76, 0xF5, 0x72, 0xC4, 0x7B,
+    0xFB, 0x69, 0xC4, 0x2E, 0xF6, 0x79, 0x84, 0xDA, 0x40, 0xB9, 0xC5, 0x7B, 0xD5, 0xDE, 0x61, 0xAC,
+    0x73, 0x58, 0xA0, 0x02, 0x88, 0x82, 0xA3, 0xB2, 0xB3, 0x04, 0x96, 0x2A, 0x3F, 0xE9, 0xA4, 0x32,
+    0x8C, 0x28, 0x32, 0x8C, 0x00, 0x1F, 0xD1, 0x5C, 0xE0, 0x39, 0x38, 0x75, 0x44, 0x15, 0xCB, 0xD5,
+    0x76, 0x96, 0x92, 0x34, 0x42, 0xF6, 0x48, 0x32, 0x5F, 0xE9, 0x93, 0xBA, 0x6B, 0xFA, 0x86, 0xAF,
+    0x05, 0xC2, 0xD5, 0x02, 0x8B, 0x14, 0x76, 0x2B, 0x5A, 0xCD, 0xA1, 0x9D, 0xC3, 0x56, 0x3E, 0xE6,
+    0x77, 0x4E, 0x6E, 0xE9, 0x02, 0x99, 0x50, 0xEB, 0x5D, 0xF4, 0xA9, 0xD9, 0x87, 0x4C, 0x78, 0xA0,
+    0x85, 0xB9, 0xE5, 0x03, 0xA6, 0xC1, 0xDE, 0xCA, 0x1D, 0xA0, 0x91, 0xFB, 0x24, 0xF2, 0x18, 0x29,
+    0xD2, 0x23, 0x09, 0xFC, 0x03, 0x7D, 0xE7, 0x42, 0x08, 0x99, 0x06, 0xB0, 0xC8, 0xD2, 0x0F, 0x01,
+    0xBB, 0x52, 0x77, 0xEA, 0xF4, 0xC8, 0x33, 0x68, 0x00, 0x50, 0x66, 0xD0, 0x77, 0x96, 0x62, 0xD0,
+    0x88, 0x47, 0x0C, 0xE2, 0xBC, 0x32, 0xA2, 0x67, 0x4F, 0xDF, 0xC0, 0xBE, 0x04, 0x26, 0x54, 0x11,
+    0x21, 0xDF, 0x9A, 0x78, 0xB6, 0xF4, 0xCF, 0x9E, 0x24, 0x42, 0x5D, 0x44, 0x9B, 0xF6, 0xD0, 0x9C,
+    0x9F, 0xA1, 0xEC, 0x8E, 0xAC, 0xDA, 0x10, 0x5A, 0xB3, 0x18, 0xE8, 0xA4, 0xA4, 0x27, 0x3C, 0xF7,
+    0x5B, 0xDE, 0x7A, 0xCC, 0x4B, 0x28, 0x23, 0xD4, 0x60, 0x47, 0x53, 0xBC, 0x03, 0xD1, 0x41, 0xC1,
+    0x67, 0x74, 0xE9, 0xCC, 0x3C, 0x84, 0x7C, 0x7A, 0x3A, 0x27, 0x27, 0xC8, 0x36, 0xC9, 0x16, 0x43,
+    0x75, 0x3D, 0x0D, 0x11, 0x27, 0x45, 0x22, 0xD5, 0x77, 0xAE, 0x04, 0x78, 0xA4, 0xC8, 0xE5, 0xAB,
+    0x8C, 0x1C, 0x46, 0xA6, 0xCB, 0xC8, 0x03, 0x12, 0x9E, 0x93, 0x46, 0xC2, 0x7B, 0x71, 0x67, 0x51,
+    0x64, 0xC3, 0x01, 0x92, 0x53, 0x9C, 0xC1, 0x32, 0x10, 0xD0, 0x77, 0x2E, 0x86, 0x20, 0xDA, 0xE7,
+    0xA2, 0x9E, 0xA3, 0x93, 0x88, 0xCF, 0x11, 0x9D, 0xEE, 0xE0, 0x68, 0xA6, 0x8C, 0x3C, 0x2D, 0x39,
+    0x21, 0xA5, 0x31, 0xB8, 0x9B, 0xEB, 0xA8, 0x88, 0xE0, 0x8E, 0x7D, 0x46, 0x0F, 0x5D, 0xA0, 0x3B,
+    0x3E, 0xD0, 0xC7, 0x21, 0xD0, 0x47, 0x31, 0x27, 0xDF, 0x2E, 0xA3, 0x35, 0x46, 0x16, 0x23, 0xF1,
+    0x09, 0x90, 0xFE, 0x00, 0x48, 0xFD, 0x92, 0xE3, 0x47, 0xCA, 0xA8, 0xC9, 0x79, 0xD0, 0x21, 0xA7,
+    0x4B, 0x03, 0x45, 0xD4, 0x28, 0xEF, 0x1C, 0xE4, 0x81, 0x13, 0xAD, 0x0F, 0x0C, 0xEA, 0x0A, 0xA4,
+    0x52, 0x77, 0x4F, 0x05, 0x28, 0xF9, 0x11, 0x09, 0x4C, 0xF6, 0x68, 0x87, 0xDD, 0xB9, 0xC6, 0x6B,
+    0x56, 0xF9, 0x70, 0xDB, 0xEC, 0xA0, 0x5F, 0x41, 0xF2, 0x85, 0xCD, 0x53, 0x1C, 0x19, 0xA3, 0x78,
+    0x99, 0xF0, 0x15, 0x04, 0xAF, 0xD8, 0x80, 0xA3, 0xB1, 0xD3, 0xEF, 0xBD, 0xA4, 0xFD, 0x72, 0x4C,
+    0xE1, 0x1E, 0x85, 0x46, 0x29, 0xE8, 0x30, 0x98, 0xEB, 0x91, 0xD4, 0x38, 0xD0, 0x3C, 0x77, 0x39,
+    0xE7, 0x8E, 0x1D, 0x12, 0xF3, 0x23, 0x8C, 0x3A, 0x57, 0xB1, 0xD7, 0xBF, 0xB0, 0x79, 0x7B, 0x5B,
+    0x87, 0xC4, 0x77, 0xF6, 0x28, 0x07, 0x3D, 0x0E, 0xA9, 0xA3, 0x4E, 0xE9, 0x70, 0x94, 0x5D, 0xA6,
+    0xB9, 0x79, 0xDA, 0x34, 0x5E, 0x09, 0xD5, 0xBF, 0x7A, 0xB4, 0xCD, 0x79, 0x41, 0x7D, 0xE0, 0x1A,
+    0x57, 0x83, 0x12, 0x7D, 0x50, 0xE1, 0xDA, 0x97, 0xAF, 0x73, 0x2C, 0xC7, 0xF5, 0x81, 0x1C, 0x1A,
+    0xCB, 0x81, 0x7C, 0xE9, 0x50, 0x81, 0xE5, 0x98, 0x61, 0x39, 0xCA, 0x2C, 0x47, 0x8B, 0xB9, 0x23,
+    0xE1, 0xB4, 0x61, 0xE5, 0xD4, 0xD6, 0x59, 0x8E, 0x02, 0xCB, 0x31, 0x83, 0x59, 0xB5, 0x0A, 0xCB,
+    0xD1, 0x62, 0x39, 0x82, 0x81, 0x1C, 0x5A, 0xA7, 0xCF, 0xA5, 0xE9, 0xF0, 0x92, 0x05, 0x9E, 0xEE,
+    0x0F, 0x2C, 0x8E, 0xD9, 0xCA, 0xAB, 0xD3, 0x57, 0xD3, 0xC0, 0x8C, 0xA9, 0xE9, 0xCA, 0xE2, 0x78,
+    0x5F, 0x48, 0x1B, 0xA1, 0x10, 0xDB, 0x81, 0x7B, 0xA3, 0xA7, 0xEC, 0xBF, 0xC1, 0xB9, 0x2C, 0xF5,
+    0x1E, 0xD1, 0xB4, 0x2C, 0x41, 0xA4, 0xC7, 0xAD, 0xEC, 0x2D, 0xF5, 0x0E, 0x87, 0xB9, 0xAC, 0x3E,
+    0xF8, 0x54, 0xF4, 0xF3, 0x10, 0x63, 0x32, 0xCF, 0xA9, 0xCF, 0x9D, 0xF9, 0xB8, 0xCA, 0x59, 0xFF,
+    0x35, 0x70, 0x13, 0xBA, 0xBF, 0x47, 0x9C, 0xFF, 0xAB, 0xC6, 0x9D, 0xBE, 0x9E, 0x7A, 0xC8, 0xCE,
+    0xDB, 0x9C, 0x5C, 0x2A, 0x04, 0x6B, 0x59, 0x66, 0x05, 0xC1, 0x24, 0x56, 0xB9, 0xFA, 0xB7, 0x38,
+    0x12, 0x89, 0xF3, 0x9C, 0xC5, 0x3F, 0x1D, 0x94, 0x6B, 0xB2, 0x70, 0x7A, 0x2C, 0x92, 0x53, 0x1C,
+    0x54, 0xB5, 0x0E, 0x9A, 0x2F, 0x64, 0x96, 0x2C, 0xBF, 0xEE, 0x70, 0xDE, 0x45, 0xAD, 0x14, 0xA1,
+    0x95, 0x44, 0x2D, 0xA7, 0x46, 0x7B, 0x7F, 0x1A, 0x43, 0xA0, 0x46, 0xC8, 0x19, 0x68, 0x68, 0x06,
+    0x39, 0x19, 0xA1, 0x5E, 0xD2, 0xC8, 0xEA, 0x2C, 0xB4, 0xBB, 0x89, 0x70, 0xD5, 0x10, 0x0D, 0x67,
+    0xA0, 0x06, 0x80, 0xF0, 0xC5, 0x40, 0x0F, 0x9D, 0x60, 0xFB, 0xBA, 0x76, 0x37, 0x22, 0xED, 0x1E,
+    0x0C, 0xFC, 0x5E, 0x48, 0xDA, 0xDD, 0x04, 0xDA, 0xE8, 0xA0, 0x12, 0x33, 0x99, 0x62, 0x02, 0xCD,
+    0x34, 0xB4, 0x7B, 0x6E, 0x55, 0xBB, 0xEF, 0x55, 0x8D, 0xFB, 0xC1, 0x66, 0x33, 0x18, 0x36, 0x1B,
+    0x50, 0x1F, 0xCB, 0xFB, 0x33, 0xD9, 0x18, 0x41, 0xF6, 0x9B, 0x24, 0x1E, 0x04, 0x96, 0x12, 0xCD,
+    0x73, 0x29, 0xC4, 0xB7, 0xB2, 0x11, 0x5B, 0xEF, 0xC6, 0x0D, 0x8A, 0xDB, 0x14, 0x6F, 0x02, 0xAB,
+    0x71, 0xED, 0x87, 0x9B, 0x66, 0xD2, 0x1C, 0xAD, 0x87, 0x4A, 0xE7, 0xD9, 0xA7, 0x9F, 0x66, 0xF9,
+    0x16, 0xCA, 0x59, 0xD2, 0x3E, 0xF6, 0x8F, 0xC9, 0x3C, 0xB3, 0xAF, 0xE5, 0x48, 0x90, 0x46, 0x5C,
+    0x3E, 0xDD, 0x8C, 0xB2, 0xD4, 0xB8, 0xAF, 0xB5, 0xE3, 0x8A, 0x27, 0xAE, 0x05, 0xC6, 0xB5, 0xFC,
+    0xF8, 0xF7, 0x27, 0xF6, 0x14, 0x64, 0x76, 0xB5, 0xAB, 0xBE, 0xB6, 0xE0, 0x6B, 0xB7, 0x39, 0x8F,
+    0xEE, 0x5B, 0xF2, 0x9B, 0x72, 0xFA, 0xDF, 0x1E, 0xFA, 0x96, 0xD2, 0x57, 0xB1, 0xA4, 0xCB, 0x2B,
+    0x12, 0xCE, 0x7B, 0x40, 0xCA, 0x46, 0x9A, 0x76, 0xAD, 0x77, 0x77, 0x97, 0xEA, 0x0D, 0x7E, 0xC2,
+    0x1F, 0x3F, 0x68, 0x93, 0x9D, 0xB5, 0x0D, 0x67, 0x3D, 0x5B, 0x7B, 0xD3, 0x7C, 0x2F, 0x32, 0xBB,
+    0xFA, 0xC0, 0xAC, 0x2F, 0x91, 0xF1, 0x20, 0x34, 0x15, 0x74, 0xD1, 0x51, 0x83, 0xDC, 0xB6, 0xAC,
+    0xB3, 0xB3, 0xBB, 0x21, 0xB3, 0xA9, 0x43, 0xB3, 0xE2, 0x9F, 0x11, 0x3C, 0x8B, 0x7B, 0x7B, 0x04,
+    0x66, 0xE8, 0x4A, 0xF7, 0x94, 0x37, 0x5D, 0xA5, 0x27, 0x53, 0x7C, 0x76, 0xFA, 0x2B, 0xB2, 0x33,
+    0xCE, 0xA8, 0x3D, 0x0C, 0x24, 0xB5, 0xA4, 0x41, 0xED, 0x06, 0x35, 0x3A, 0x69, 0x77, 0x6B, 0xA9,
+    0x3E, 0xA4, 0x66, 0xD1, 0x94, 0xF8, 0x73, 0xAC, 0x0E, 0xBE, 0x20, 0x7D, 0xE5, 0xF4, 0xF7, 0xBD,
+    0xBC, 0x97, 0x9D, 0xBE, 0x77, 0x2C, 0xF3, 0xC3, 0xFD, 0x2C, 0xCF, 0x4E, 0x50, 0xBC, 0x3A, 0x88,
+    0x20, 0xFB, 0x63, 0xCD, 0xE9, 0x49, 0xF7, 0x08, 0x8B, 0xA7, 0x5D, 0x0B, 0x6E, 0xF4, 0xF5, 0x9F,
+    0x11, 0xCA, 0x84, 0x05, 0x72, 0x4A, 0xC8, 0xCE, 0xFF, 0xCD, 0xF3, 0x0C, 0x38, 0x5A, 0xB5, 0x7A,
+    0x7D, 0xE2, 0x9B, 0xE7, 0x9D, 0x3D, 0x99, 0xD8, 0x59, 0x85, 0xFE, 0x04, 0xAE, 0x28, 0x7C, 0x66,
+    0x91, 0xF9, 0x70, 0x32, 0x0E, 0x8E, 0xF9, 0x43, 0x9F, 0x54, 0xD9, 0xAB, 0xA1, 0x21, 0xBA, 0xDC,
+    0xC0, 0x79, 0xF7, 0xB0, 0x9B, 0x6D, 0x88, 0xE6, 0x60, 0x6F, 0x9C, 0xFE, 0xCC, 0x21, 0x34, 0x24,
+    0x94, 0x10, 0xE0, 0xAA, 0x24, 0x16, 0x62, 0x1A, 0xAA, 0x9A, 0x6B, 0x8C, 0xE6, 0x55, 0x4F, 0x56,
+    0x18, 0xDE, 0x6A, 0xF6, 0xF9, 0x6F, 0xE1, 0x06, 0x59, 0x77, 0x60, 0xC9, 0x89, 0x40, 0x7A, 0xD5,
+    0x82, 0x27, 0xFD, 0x8C, 0x50, 0x8B, 0x9A, 0x3D, 0x2D, 0xB3, 0x9B, 0x30, 0x6F, 0x98, 0xD1, 0xCB,
+    0xD0, 0x44, 0x7E, 0x04, 0x97, 0xE1, 0x90, 0x5F, 0x46, 0x52, 0x12, 0x1B, 0x3F, 0x96, 0x63, 0xAF,
+    0x6C, 0x99, 0x7C, 0x16, 0x96, 0xE4, 0xF2, 0xBD, 0x93, 0x8C, 0xE4, 0xE3, 0x6B, 0x0D, 0x80, 0x40,
+    0xA7, 0xDE, 0xF7, 0x69, 0x7C, 0xF0, 0xB5, 0xE5, 0x20, 0x34, 0x5D, 0xFE, 0x34, 0x3B, 0x4B, 0x93,
+    0xCD, 0x88, 0x8E, 0xEA, 0xC1, 0x81, 0xE9, 0xA9, 0xAE, 0x47, 0xC6, 0xED, 0x90, 0xF4, 0x8F, 0xC2,
+    0x91, 0xCC, 0x07, 0xDC, 0x73, 0x55, 0xF6, 0xC3, 0x73, 0x03, 0x62, 0xF9, 0xF7, 0x60, 0xCA, 0xA2,
+    0x0C, 0xBF, 0xAD, 0x66, 0x83, 0x31, 0xBC, 0xFC, 0x01, 0x38, 0x25, 0xA0, 0xD7, 0x05, 0x9F, 0x1E,
+    0x35, 0xD4, 0xF7, 0x51, 0xEE, 0x80, 0x43, 0x01, 0x50, 0x04, 0x94, 0xC1, 0x29, 0xB4, 0xA8, 0xE6,
+    0x97, 0xC8, 0x71, 0x33, 0x4E, 0x67, 0x32, 0xAF, 0x1F, 0x65, 0x7B, 0x3B, 0x2F, 0xED, 0xD5, 0x2C,
+    0x9D, 0x4C, 0xBB, 0xD3, 0x6E, 0xD3, 0xB7, 0x7C, 0x5D, 0xFE, 0xB4, 0xC7, 0x82, 0xC4, 0x01, 0x52,
+    0xD6, 0xEE, 0x2F, 0x42, 0xEA, 0xFC, 0xBD, 0x37, 0xDA, 0x7E, 0xFB, 0x6B, 0x2D, 0xF3, 0x81, 0x69,
+    0x72, 0xAD, 0x68, 0x72, 0x9B, 0x0C, 0xBF, 0xBD, 0x3E, 0x71, 0x70, 0x9A, 0xDC, 0x1A, 0xB7, 0x6B,
+    0x8F, 0xB4, 0xC6, 0x07, 0xDF, 0x37, 0xE7, 0xF3, 0x30, 0xFB, 0x07, 0x4A, 0xDE, 0x25, 0x2C, 0x2D,
+    0x4E, 0x2F, 0x76, 0x42, 0x0B, 0xC9, 0x5B, 0xF7, 0x84, 0xA7, 0xA3, 0xA4, 0x14, 0x88, 0xAE, 0x93,
+    0x48, 0xE1, 0xC8, 0xAB, 0x31, 0x4E, 0x61, 0x13, 0x21, 0xB2, 0x81, 0xA2, 0xC2, 0xC6, 0x3A, 0x13,
+    0x7B, 0x14, 0xBE, 0x0C, 0xC6, 0xB2, 0x16, 0xE5, 0x33, 0x99, 0xCF, 0xBE, 0x40, 0x8C, 0xE7, 0x4E,
+    0xDF, 0xE1, 0xD7, 0x7E, 0x56, 0x9A, 0x0E, 0xE1, 0xD6, 0xEF, 0x48, 0xBF, 0xC3, 0x8D, 0xAA, 0xF0,
+    0xF5, 0x50, 0x0B, 0x74, 0xA4, 0x7F, 0x1D, 0x85, 0x84, 0x8E, 0x32, 0x3D, 0x03, 0x35, 0x83, 0x40,
+    0x0B, 0x75, 0x60, 0xFD, 0xDF, 0x57, 0x3C, 0xFD, 0x93, 0xFE, 0xA3, 0x34, 0xFC, 0xEC, 0x4B, 0x44,
+    0x87, 0xED, 0xE1, 0xAD, 0x59, 0xC8, 0xC6, 0x1D, 0x79, 0x63, 0xB8, 0xB3, 0x67, 0xBD, 0x8F, 0xFF,
+    0x02, 0xBD, 0x5A, 0x3D, 0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x6B, 0x6A, 0x64, 0x2D, 0xC8, 0x55,
+    0x21, 0x21, 0x41, 0x4C, 0x7B, 0x55, 0xA4, 0x10, 0x12, 0x92, 0xEB, 0x82, 0x89, 0x59, 0x90, 0xBC,
+    0x55, 0x5C, 0xA4, 0x70, 0xE1, 0x2B, 0x44, 0xBB, 0x30, 0x10, 0xB9, 0x48, 0x13, 0x23, 0x90, 0x88,
+    0x40, 0x08, 0x04, 0xE4, 0xC8, 0xDB, 0x34, 0x69, 0xDC, 0xA8, 0x88, 0x53, 0x33, 0x80, 0x10, 0xD8,
+    0x6A, 0xA4, 0xC2, 0x05, 0x83, 0x50, 0xBA, 0x91, 0x55, 0x08, 0x88, 0x11, 0x68, 0x11, 0x80, 0x71,
+    0x00, 0x37, 0x1B, 0x27, 0x06, 0x9C, 0x08, 0xB0, 0x36, 0xF6, 0x32, 0x3E, 0x59, 0x77, 0x37, 0xF9,
+    0xDE, 0x9B, 0xDD, 0xE3, 0x51, 0x96, 0x28, 0x1E, 0xFF, 0xC8, 0x9D, 0x47, 0xDE, 0xEE, 0xCE, 0xCC,
+    0x37, 0xEF, 0xCD, 0xFB, 0x9D, 0xA3, 0x9A, 0x89, 0x89, 0xBE, 0x77, 0x95, 0xAA, 0x9F, 0x1C, 0xCD,
+    0x2D, 0x40, 0xBC, 0x36, 0x88, 0x6A, 0x80, 0xF8, 0x73, 0x20, 0xA3, 0x11, 0xC8, 0x78, 0x08, 0x32,
+    0x13, 0x24, 0x44, 0xD3, 0xBE, 0x26, 0xBA, 0xAE, 0x52, 0x74, 0xF0, 0x32, 0x72, 0x8C, 0xC9, 0xC9,
+    0xD5, 0x54, 0x90, 0x97, 0x50, 0x87, 0x14, 0x51, 0x83, 0x02, 0xA2, 0x39, 0x0A, 0x63, 0x6A, 0x92,
+    0xC9, 0x95, 0xC9, 0x7C, 0x93, 0x1E, 0xBB, 0x8A, 0x8E, 0xE4, 0xBC, 0x47, 0xC1, 0xBD, 0x34, 0x72,
+    0xF2, 0x49, 0xBC, 0x2E, 0x97, 0x73, 0xAD, 0x88, 0x7E, 0x5B, 0x34, 0xA8, 0x58, 0xA3, 0x62, 0x15,
+    0xD4, 0x2D, 0xE6, 0x7F, 0xB2, 0x1A, 0xB6, 0x9B, 0x0C, 0xE7, 0x84, 0x0B, 0x32, 0xE1, 0x83, 0x04,
+    0xBD, 0x0A, 0xD9, 0xC1, 0x02, 0x1D, 0xA1, 0x44, 0x39, 0xDA, 0x33, 0x09, 0xDD, 0xA4, 0xA1, 0xE1,
+    0x1E, 0x18, 0x2A, 0xE6, 0x02, 0x8F, 0x7F, 0x9D, 0x21, 0xF1, 0x27, 0x87, 0x67, 0xA2, 0xAF, 0x99,
+    0xA3, 0xCD, 0x64, 0x08, 0x90, 0x6E, 0x4A, 0xE0, 0x26, 0x46, 0x07, 0x96, 0xE0, 0x33, 0x52, 0x1D,
+    0xCB, 0xCD, 0x79, 0xB4, 0x55, 0x3B, 0xB4, 0x1B, 0xDB, 0x5B, 0x51, 0x8F, 0xDC, 0x07, 0xA1, 0xF6,
+    0xB5, 0x97, 0x06, 0xB1, 0x97, 0x46, 0xE4, 0xC8, 0x5B, 0x4B, 0x65, 0x5B, 0x2B, 0xDB, 0x8D, 0xF2,
+    0x33, 0x3F, 0xAB, 0xA1, 0x01, 0x33, 0x05, 0x29, 0xA5, 0x5E, 0xF7, 0x0D, 0x4D, 0xCD, 0x5E, 0x5F,
+    0x5E, 0x4A, 0x53, 0x10, 0xD3, 0x24, 0xD1, 0x8B, 0xF2, 0xF1, 0x67, 0xE4, 0xDF, 0xCB, 0x42, 0x27,
+    0x9F, 0xA3, 0xBC, 0x41, 0xF1, 0x9A, 0x8C, 0x65, 0xAF, 0x06, 0xAF, 0x1C, 0x43, 0x7D, 0x37, 0xF8,
+    0x34, 0x77, 0x4D, 0xDA, 0xEF, 0x8F, 0x05, 0x07, 0x58, 0xDA, 0x24, 0xF8, 0xF0, 0xE2, 0xB1, 0x03,
+    0x81, 0xB8, 0x4C, 0x64, 0x62, 0xEF, 0xB6, 0x3E, 0x42, 0x2B, 0x43, 0x43, 0x04, 0x5F, 0xC9, 0x03,
+    0x44, 0x2F, 0xEB, 0x0F, 0xB7, 0xAF, 0xF0, 0x66, 0xE5, 0x9D, 0xD9, 0x6A, 0xE8, 0xA1, 0xD9, 0x77,
+    0xF1, 0x79, 0xB0, 0xEE, 0x12, 0x06, 0x06, 0x46, 0x95, 0x1E, 0x04, 0xFB, 0xD4, 0x99, 0xD4, 0xFD,
+    0x28, 0x21, 0x63, 0x5F, 0xDE, 0x05, 0x44, 0x9A, 0x1E, 0x03, 0x79, 0x81, 0xD7, 0xE8, 0x8B, 0x0A,
+    0x55, 0xAC, 0xAC, 0x99, 0x07, 0x18, 0x7E, 0xE3, 0x42, 0x4A, 0x6E, 0xEE, 0xB4, 0x41, 0x30, 0x03,
+    0x48, 0x8D, 0x49, 0x18, 0x33, 0x49, 0x40, 0x82, 0x27, 0x11, 0x79, 0xA5, 0x56, 0x75, 0xC3, 0x00,
+    0x6A, 0xE3, 0x8D, 0x0C, 0x83, 0x32, 0x72, 0xAF, 0x07, 0x3D, 0x58, 0xC6, 0xAE, 0x9C, 0xC2, 0xB6,
+    0x9A, 0xC2, 0xD6, 0x9C, 0x22, 0xE7, 0xDD, 0x29, 0xF2, 0xCD, 0x79, 0x8A, 0xCE, 0xF4, 0x00, 0x73,
+    0x19, 0x68, 0xE7, 0x01, 0x9A, 0xDB, 0x54, 0xBF, 0xF1, 0x3D, 0x6E, 0xF3, 0x30, 0x12, 0xE1, 0xEF,
+    0xEE, 0xC7, 0xCA, 0x84, 0xF9, 0x30, 0x48, 0x6B, 0x26, 0x0F, 0x92, 0x6F, 0x6D, 0xD4, 0x87, 0x42,
+    0x6A, 0x77, 0x28, 0x66, 0xC7, 0x9D, 0xDC, 0x8A, 0x63, 0x8A, 0x54, 0x6F, 0x8A, 0xC2, 0x8F, 0x3F,
+    0x17, 0x24, 0x15, 0xAA, 0x9D, 0x20, 0xA5, 0x16, 0xC6, 0x7B, 0xEB, 0xBD, 0x92, 0xBF, 0x26, 0x55,
+    0x1B, 0xAF, 0x67, 0x98, 0xB7, 0x6A, 0x75, 0x34, 0xEA, 0x37, 0x63, 0xC8, 0xDD, 0x38, 0x4B, 0x5B,
+    0xEE, 0xE5, 0x74, 0x1C, 0x6D, 0x9A, 0x9B, 0xDA, 0x58, 0x28, 0x30, 0x46, 0x01, 0x1B, 0x7F, 0xE4,
+    0xEA, 0xE5, 0x52, 0xF6, 0xF7, 0x53, 0x91, 0x7D, 0xBB, 0x41, 0x6B, 0x0D, 0x6A, 0xB4, 0x4C, 0xE7,
+    0xC6, 0xC2, 0xD9, 0xBE, 0xEC, 0x23, 0x3A, 0x11, 0xAC, 0x17, 0xA5, 0xEC, 0xEB, 0x47, 0x61, 0xD7,
+    0xC6, 0x01, 0x03, 0x26, 0xD3, 0x4F, 0xF7, 0x15, 0xD1, 0x08, 0xC5, 0x62, 0xCC, 0xB5, 0x35, 0xE6,
+    0xC3, 0xE1, 0xF2, 0xB4, 0x55, 0x15, 0xFE, 0xDB, 0xDF, 0x89, 0xFB, 0x83, 0x8B, 0x15, 0xF9, 0x86,
+    0x4C, 0x4A, 0x43, 0xE3, 0xDA, 0x37, 0x0C, 0xEC, 0x08, 0xC4, 0xAB, 0xCC, 0x90, 0x85, 0x52, 0x83,
+    0xD9, 0xC3, 0xEE, 0xD8, 0x39, 0x98, 0x17, 0xC4, 0x22, 0xD9, 0x2B, 0xCA, 0xE9, 0x88, 0xC8, 0x5E,
+    0x64, 0x39, 0xFB, 0x3E, 0x86, 0x82, 0xFE, 0xFA, 0x7A, 0x7F, 0xF9, 0x86, 0x11, 0x9D, 0xD4, 0xFB,
+    0x58, 0xCC, 0x4C, 0x63, 0x78, 0x91, 0xCA, 0x8F, 0xF8, 0x67, 0x71, 0x7C, 0x01, 0x16, 0x40, 0xA7,
+    0xBD, 0xD2, 0xE1, 0x51, 0x08, 0xA7, 0xEF, 0x3C, 0x78, 0xBD, 0x60, 0xA9, 0xB7, 0xD9, 0x5B, 0x15,
+    0xE8, 0x4D, 0xB1, 0x68, 0x9A, 0x35, 0x6A, 0x42, 0xD6, 0x2C, 0x19, 0x59, 0xC0, 0xC7, 0xC0, 0xC4,
+    0x4B, 0xE4, 0x74, 0xF8, 0x95, 0x36, 0x1B, 0xC7, 0x36, 0x5B, 0xC7, 0x36, 0x6F, 0x63, 0x68, 0xFF,
+    0x03, 0x68, 0x30, 0x5D, 0x30, 0x03, 0x1E, 0x41, 0xEC, 0x67, 0x0B, 0xB3, 0x7C, 0x92, 0x92, 0x17,
+    0x2F, 0xDA, 0x7B, 0x6F, 0xBD, 0xAA, 0xBD, 0x7B, 0x0F, 0x75, 0x90, 0x14, 0xF0, 0xCB, 0xAB, 0x70,
+    0xCC, 0x0D, 0x69, 0x41, 0xBC, 0x4A, 0xFE, 0x2D, 0x04, 0x06, 0x80, 0x8E, 0xB8, 0x40, 0xA4, 0xE5,
+    0xBF, 0x53, 0x27, 0xCF, 0x74, 0x49, 0x81, 0x5F, 0x73, 0x78, 0xE3, 0x12, 0xF9, 0x68, 0x41, 0x3C,
+    0x8B, 0x9E, 0xD1, 0x99, 0x35, 0xDC, 0xBF, 0x5C, 0xC6, 0x4C, 0xE3, 0xAA, 0x1F, 0x33, 0xB5, 0xE9,
+    0x50, 0xD6, 0xE7, 0xD2, 0x29, 0xE0, 0xE4, 0x68, 0x06, 0xAC, 0x5E, 0x8E, 0x0F, 0x66, 0x6D, 0x12,
+    0x60, 0x39, 0x45, 0x15, 0x6A, 0x6D, 0xFE, 0x1C, 0xB0, 0xEC, 0x26, 0x4B, 0xD9, 0x4D, 0x0D, 0x4C,
+    0xB9, 0xEF, 0x6B, 0x3B, 0x8C, 0x3D, 0x58, 0xAF, 0x62, 0x47, 0x0E, 0x58, 0xAC, 0x69, 0x73, 0xAB,
+    0x67, 0xAC, 0x08, 0x12, 0x6A, 0x0F, 0x2C, 0xF4, 0x40, 0x16, 0x29, 0x21, 0x85, 0x63, 0x78, 0xCA,
+    0xDB, 0x40, 0x70, 0x8C, 0x2E, 0x57, 0xE6, 0xD5, 0x31, 0x6D, 0xD5, 0xA6, 0x0B, 0xE9, 0x76, 0xFE,
+    0x1C, 0xC4, 0x18, 0x93, 0xB8, 0x1B, 0x0B, 0xE7, 0x92, 0xED, 0xDF, 0x53, 0x60, 0x9E, 0xE6, 0x41,
+    0x6D, 0x94, 0x8B, 0xA0, 0x85, 0xED, 0x1B, 0xCD, 0x20, 0x0E, 0x5A, 0x19, 0xB5, 0x5E, 0x50, 0x5B,
+    0x1B, 0xA5, 0x06, 0xDB, 0xAD, 0x2B, 0xA4, 0xEE, 0x1A, 0x52, 0x45, 0x98, 0xA8, 0x4C, 0x69, 0xA5,
+    0xBD, 0x6D, 0x9B, 0x9F, 0x79, 0x59, 0xAB, 0xE3, 0x75, 0x1E, 0x87, 0xFE, 0xFB, 0x5F, 0x5F, 0xBD,
+    0xF6, 0x19, 0x93, 0x7F, 0xED, 0x05, 0xFD, 0x20, 0xCA, 0x16, 0x38, 0xDE, 0x47, 0x7A, 0x07, 0xDC,
+    0xFE, 0xBC, 0x19, 0xAB, 0xDC, 0xD7, 0x2A, 0x55, 0x3B, 0x42, 0xF9, 0x0C, 0xD8, 0x7C, 0x4B, 0xFF,
+    0xC1, 0x24, 0xF1, 0x79, 0xCB, 0x72, 0x52, 0x12, 0xA8, 0xEC, 0xF0, 0x02, 0x28, 0x74, 0x19, 0x41,
+    0xC7, 0x54, 0xFF, 0xD2, 0xE8, 0xBA, 0xEC, 0x93, 0x91, 0xBA, 0x44, 0x6C, 0xDB, 0x5E, 0x30, 0x43,
+    0xD8, 0xDB, 0xE8, 0x6B, 0x93, 0xCD, 0xDD, 0xCD, 0x6B, 0x3A, 0x57, 0xDF, 0x25, 0x3A, 0x19, 0x47,
+    0xA9, 0xF7, 0x98, 0x5F, 0x3F, 0x6B, 0xF6, 0x4E, 0xB9, 0x9C, 0x2E, 0x86, 0x5D, 0x3A, 0x52, 0xEC,
+    0x7E, 0x9A, 0xFA, 0xD1, 0xEB, 0xE3, 0xB5, 0x36, 0xC7, 0x22, 0xDB, 0x4D, 0xB5, 0xBB, 0xB1, 0x29,
+    0x63, 0x85, 0xE1, 0x1C, 0x2C, 0x26, 0xFF, 0xDF, 0xE4, 0x76, 0xA1, 0x84, 0x2A, 0xB5, 0x31, 0xC6,
+    0x76, 0xB3, 0xB9, 0xDA, 0x87, 0x1E, 0x85, 0x48, 0xDA, 0x54, 0x07, 0x69, 0x1A, 0x72, 0x0D, 0x77,
+    0x33, 0x3E, 0xDE, 0x0D, 0x90, 0xED, 0x97, 0x06, 0x59, 0xA9, 0xB6, 0xEA, 0x72, 0x18, 0x5A, 0x70,
+    0x9F, 0xBD, 0x11, 0xCC, 0x28, 0x73, 0x8A, 0x4C, 0x8A, 0xCA, 0x04, 0x09, 0x91, 0x28, 0x3F, 0xE4,
+    0xE5, 0x77, 0xD9, 0x1E, 0x61, 0x13, 0xA7, 0xBE, 0x6C, 0xD9, 0xCA, 0x56, 0x9C, 0x8C, 0x19, 0x69,
+    0x13, 0x49, 0x8A, 0xDA, 0x51, 0xF3, 0xA1, 0xB2, 0xCD, 0xDE, 0xA0, 0x42, 0xB3, 0xEA, 0x80, 0xDB,
+    0x6C, 0x48, 0x1D, 0xEB, 0x0C, 0x3B, 0x30, 0x5C, 0xA4, 0xDE, 0x8E, 0x47, 0x1D, 0x9E, 0x26, 0x30,
+    0xDA, 0xE9, 0x0D, 0xE4, 0x27, 0x43, 0x5D, 0x6D, 0x5E, 0x06, 0x8C, 0xF5, 0xB2, 0x35, 0xA1, 0x50,
+    0xDC, 0x36, 0x4D, 0x4E, 0x22, 0x64, 0x29, 0x15, 0x03, 0x06, 0xC7, 0xD9, 0xF1, 0x05, 0x66, 0x79,
+    0x29, 0xE3, 0x5D, 0x66, 0xA9, 0xBA, 0x2C, 0x03, 0xEA, 0x55, 0x7C, 0x74, 0x38, 0xAB, 0x50, 0x31,
+    0xC8, 0x18, 0x47, 0x47, 0x33, 0x4C, 0x38, 0x4E, 0xFA, 0x12, 0x0C, 0x75, 0x1F, 0xC2, 0xC4, 0xB9,
+    0x9D, 0x26, 0xDF, 0x8B, 0x12, 0x90, 0x40, 0x5E, 0xE6, 0x11, 0x5D, 0xD9, 0x1A, 0x5D, 0x91, 0x3A,
+    0xEB, 0x9F, 0x5F, 0x39, 0xCE, 0xB3, 0x95, 0x30, 0xAC, 0x53, 0x65, 0x4E, 0x38, 0xF1, 0x13, 0x4C,
+    0xA2, 0x5E, 0xA8, 0x2B, 0xDD, 0x02, 0x67, 0x91, 0x71, 0xE8, 0x19, 0xB4, 0x8C, 0x14, 0x4C, 0xB7,
+    0xBA, 0x8B, 0x76, 0x1F, 0xFF, 0x7F, 0x02, 0x1E, 0xE8, 0x0E, 0xDA, 0x32, 0x5A, 0x44, 0x7E, 0x16,
+    0xA4, 0xAD, 0x4E, 0x19, 0x79, 0xF0, 0xA0, 0x22, 0x86, 0xD8, 0xBA, 0x96, 0xA3, 0x2C, 0xD3, 0x85,
+    0x7A, 0x73, 0xB7, 0xE3, 0x71, 0x15, 0x85, 0x6B, 0x2A, 0x08, 0x31, 0x49, 0xF7, 0x35, 0x80, 0x55,
+    0xE0, 0xD1, 0xF8, 0x71, 0xBB, 0xC6, 0xB1, 0xE5, 0x4C, 0x19, 0x5F, 0x5E, 0x1C, 0x88, 0x2F, 0xD7,
+    0xA8, 0x70, 0x53, 0x4F, 0x5C, 0x83, 0xCF, 0xBB, 0x71, 0x9B, 0x5F, 0x3F, 0x6B, 0x75, 0xF7, 0x71,
+    0x66, 0xCB, 0x29, 0xB6, 0x04, 0xEC, 0x51, 0x79, 0xFF, 0x8C, 0xEC, 0x14, 0x05, 0x77, 0xC5, 0x7F,
+    0xF1, 0x18, 0x98, 0x8B, 0x7D, 0x93, 0xAA, 0xB6, 0xA7, 0xDD, 0xDC, 0x43, 0x3A, 0xA9, 0x76, 0x8D,
+    0xA8, 0x75, 0x5B, 0xFB, 0xB7, 0x13, 0x75, 0x87, 0xD4, 0x9F, 0x59, 0x7C, 0x3B, 0xB9, 0xFC, 0x8C,
+    0x80, 0x65, 0x7B, 0x96, 0x78, 0xF0, 0x8E, 0x5E, 0x66, 0xFF, 0x3E, 0x05, 0x80, 0xE6, 0x7D, 0xF8,
+    0xF8, 0xB9, 0x3E, 0xC8, 0xD4, 0xED, 0x9C, 0xE9, 0x70, 0x00, 0xDE, 0x24, 0xF7, 0x2B, 0x28, 0x46,
+    0xCF, 0xD6, 0x6A, 0x38, 0x16, 0xF8, 0xE1, 0x36, 0x00, 0x9A, 0xA9, 0xDA, 0x6A, 0x1B, 0xFF, 0xE6,
+    0x75, 0xBD, 0x2C, 0x4C, 0x5F, 0xEA, 0xDF, 0x51, 0x79, 0xD3, 0x94, 0xDA, 0x24, 0x99, 0x0E, 0x5B,
+    0x19, 0x89, 0x15, 0xCB, 0x2A, 0x17, 0x76, 0x66, 0x46, 0xA6, 0x80, 0xEA, 0x85, 0x97, 0xDD, 0x0E,
+    0xAC, 0x3E, 0xA6, 0x06, 0xB9, 0x1F, 0x83, 0xDC, 0x85, 0x41, 0x77, 0xEF, 0x64, 0x20, 0x1F, 0x14,
+    0x20, 0xBA, 0xC3, 0x64, 0x99, 0x49, 0xC4, 0x24, 0xF8, 0x10, 0x44, 0xDD, 0x03, 0x71, 0x1F, 0x72,
+    0x71, 0xD0, 0x30, 0x69, 0xB2, 0xA5, 0xA9, 0x51, 0xAD, 0x23, 0x8A, 0x44, 0xA5, 0x22, 0xB4, 0x6D,
+    0xE1, 0xAE, 0xCC, 0x63, 0x4E, 0x9E, 0x79, 0x97, 0xA2, 0xBB, 0x26, 0xF6, 0xDA, 0x81, 0xF6, 0x72,
+    0x2F, 0x7D, 0xDA, 0x2F, 0x02, 0x83, 0xBC, 0xD9, 0xF5, 0xBA, 0x07, 0x8D, 0x94, 0x4E, 0x94, 0x75,
+    0x2C, 0xA2, 0x4B, 0x55, 0x29, 0x13, 0x81, 0xED, 0xAE, 0xF1, 0x5A, 0x8D, 0x41, 0x3C, 0xEB, 0x95,
+    0x39, 0x7A, 0xA9, 0x31, 0x65, 0x35, 0x2A, 0xE6, 0x52, 0xE6, 0x47, 0x2C, 0x14, 0x53, 0xF1, 0xE9,
+    0x10, 0xE4, 0xC1, 0x25, 0x2C, 0xAE, 0x60, 0x71, 0x38, 0x54, 0xD6, 0xAF, 0x76, 0xBB, 0x3E, 0xD9,
+    0x46, 0xCD, 0x2A, 0x69, 0xB4, 0x13, 0x8C, 0x2D, 0xB8, 0x57, 0x68, 0xA2, 0x75, 0xAE, 0x47, 0x59,
+    0x90, 0x47, 0x08, 0x20, 0x10, 0x98, 0x83, 0x60, 0xEF, 0xF9, 0xC9, 0x53, 0x49, 0x98, 0x22, 0xA2,
+    0x31, 0x1D, 0xBF, 0xF3, 0x14, 0x1E, 0xDC, 0x7E, 0x84, 0x07, 0xF3, 0xC2, 0x83, 0x57, 0x2A, 0x1E,
+    0x78, 0xC2, 0x03, 0xD3, 0xE7, 0x41, 0x8D, 0x79, 0x10, 0xF5, 0x79, 0xE0, 0x6F, 0x25, 0x5C, 0xD2,
+    0xA3, 0x9F, 0xDB, 0xA4, 0x6D, 0x17, 0x9C, 0x48, 0xC1, 0x89, 0xB4, 0x14, 0x71, 0x25, 0x66, 0x6D,
+    0x4B, 0x90, 0x7F, 0x24, 0x5B, 0x7C, 0xDC, 0x3C, 0xBC, 0xB8, 0x80, 0x8F, 0xEE, 0x83, 0xE7, 0xD8,
+    0x81, 0xC2, 0x97, 0x86, 0x6C, 0xCB, 0x6B, 0x9C, 0x2F, 0xCD, 0x73, 0xB1, 0x6C, 0x89, 0xF9, 0xB8,
+    0xC6, 0x41, 0xC0, 0x23, 0x44, 0x1E, 0xCC, 0xF1, 0x2B, 0x35, 0xA9, 0xB9, 0x73, 0xB7, 0x40, 0x03,
+    0xAE, 0x57, 0x70, 0x04, 0xD8, 0x2F, 0x70, 0x72, 0x15, 0xBE, 0x2C, 0x6F, 0x21, 0x2D, 0x02, 0xEF,
+    0x1F, 0xF2, 0x1C, 0x6B, 0xE8, 0x32, 0x87, 0x84, 0x88, 0xAB, 0x6D, 0xE1, 0x96, 0xD6, 0xC0, 0xD8,
+    0xB3, 0xB8, 0x3F, 0x0F, 0x1A, 0xFC, 0xBA, 0x4D, 0xFD, 0x12, 0xC4, 0x29, 0xDE, 0xA4, 0x33, 0xCC,
+    0x98, 0x88, 0xF3, 0x12, 0x95, 0x1D, 0x0E, 0x7E, 0x17, 0xB9, 0x9F, 0x07, 0xAD, 0x70, 0x8D, 0xA6,
+    0x32, 0x5A, 0xD9, 0xDB, 0x3A, 0x6C, 0x4E, 0x75, 0x87, 0x93, 0x2A, 0x3E, 0xD3, 0x98, 0xE5, 0x62,
+    0xCA, 0xE2, 0xCC, 0xE1, 0x2C, 0xC6, 0x46, 0x71, 0x48, 0x7B, 0xF3, 0x36, 0x79, 0xB7, 0x10, 0x30,
+    0xB0, 0xCB, 0xDC, 0x97, 0x05, 0x21, 0x59, 0x36, 0x46, 0x03, 0xF9, 0xA7, 0x6F, 0xB0, 0xEB, 0x4D,
+    0x5D, 0x1D, 0x62, 0x83, 0x3B, 0x5A, 0xB6, 0x79, 0x32, 0x2F, 0x15, 0xC1, 0x25, 0xA1, 0x6B, 0x15,
+    0x45, 0xCE, 0x0B, 0xBA, 0x7E, 0xB6, 0xBC, 0x63, 0x9F, 0xCE, 0x09, 0x95, 0x5E, 0xC7, 0x79, 0x04,
+    0xBA, 0x1E, 0x60, 0x34, 0xCA, 0xB1, 0x90, 0xF5, 0xD7, 0x72, 0x6A, 0x1A, 0x3E, 0xF4, 0x29, 0x31,
+    0xD3, 0x77, 0xA0, 0xC5, 0x0F, 0xB3, 0x1E, 0x52, 0x24, 0xFA, 0x53, 0xCA, 0xB8, 0x6B, 0x49, 0xC4,
+    0x38, 0x63, 0x8B, 0x38, 0x88, 0x41, 0x8D, 0x61, 0xFA, 0xCE, 0x82, 0xDC, 0x21, 0x79, 0xCA, 0xE6,
+    0xB4, 0x96, 0x08, 0xB7, 0xB4, 0x8B, 0xB5, 0xFC, 0xEF, 0xC1, 0x79, 0x5E, 0x4D, 0xB3, 0xBD, 0xA5,
+    0x34, 0x22, 0xC5, 0x02, 0x1B, 0x6B, 0xB3, 0x39, 0x3C, 0xB2, 0x59, 0xCC, 0xFC, 0x4C, 0x8A, 0xD5,
+    0x1C, 0x2E, 0xC2, 0x56, 0x81, 0x48, 0xB8, 0xB8, 0x95, 0x78, 0x1C, 0x47, 0x42, 0xDD, 0x5C, 0x23,
+    0x0E, 0x95, 0xA3, 0xCC, 0x7C, 0x59, 0xA2, 0x4C, 0x0E, 0x44, 0x03, 0xCD, 0x51, 0xA6, 0xF4, 0x95,
+    0x20, 0x5F, 0x7C, 0x6F, 0x33, 0x29, 0xFD, 0x61, 0x20, 0xE5, 0xC5, 0x45, 0x6B, 0x04, 0xAF, 0x44,
+    0x77, 0x3B, 0xDE, 0xDF, 0x97, 0xBC, 0x7C, 0x06, 0x73, 0x61, 0xD4, 0x6F, 0x5E, 0x3E, 0x97, 0xBA,
+    0x0F, 0x18, 0x95, 0xF5, 0x18, 0x62, 0x4B, 0x2C, 0x37, 0x6C, 0x98, 0x3E, 0x14, 0x42, 0x1B, 0xA8,
+    0x71, 0xC0, 0x11, 0xB3, 0x8D, 0x7B, 0xA6, 0xE2, 0x67, 0xC6, 0xB5, 0x54, 0x2E, 0x7C, 0x4A, 0xE5,
+    0xB3, 0x2A, 0x7D, 0x1E, 0x30, 0x9F, 0xC7, 0x60, 0x90, 0xEF, 0xC6, 0x65, 0xFA, 0x32, 0xE4, 0x2A,
+    0x4A, 0x19, 0xC1, 0x5D, 0xBD, 0x29, 0x06, 0xC2, 0x24, 0xE1, 0x8F, 0xF2, 0x59, 0xAE, 0xA3, 0x5E,
+    0xB4, 0xE5, 0x53, 0xE8, 0x60, 0x84, 0xF7, 0x31, 0x78, 0x2B, 0x15, 0x97, 0x06, 0x58, 0x4B, 0x8B,
+    0x34, 0x97, 0xD3, 0xEC, 0x2A, 0x35, 0x96, 0x9D, 0x9C, 0xAB, 0x55, 0xE5, 0x59, 0x92, 0x74, 0x40,
+    0x12, 0x23, 0x37, 0x9C, 0x2B, 0x34, 0x75, 0x8D, 0x2E, 0xF9, 0xC9, 0xFB, 0x5E, 0xBC, 0x2A, 0xD6,
+    0x26, 0x02, 0x6E, 0x4C, 0x8A, 0xDC, 0x44, 0xE9, 0x45, 0x4F, 0xE7, 0x9E, 0x5E, 0xF5, 0x93, 0xA8,
+    0x5B, 0xF1, 0xEE, 0x26, 0xBB, 0x69, 0x39, 0x7A, 0xBB, 0xBC, 0x47, 0x24, 0x48, 0x12, 0x3C, 0xB8,
+    0xA2, 0x80, 0xBE, 0x2D, 0x07, 0x99, 0xC3, 0x22, 0xD9, 0xE5, 0xD4, 0x8B, 0x32, 0x74, 0xC0, 0x97,
+    0x73, 0x81, 0x0F, 0x7F, 0x77, 0x3E, 0x2F, 0x5C, 0x28, 0x57, 0xA4, 0xA5, 0x8A, 0x3E, 0x02, 0x6B,
+    0x27, 0xEE, 0x80, 0xAB, 0xDC, 0x03, 0x87, 0x69, 0x7B, 0x61, 0xC8, 0x84, 0xA2, 0x60, 0xB2, 0x2C,
+    0x10, 0x0C, 0xCB, 0x10, 0x58, 0xA9, 0xF6, 0xD2, 0xB9, 0xF5, 0xD5, 0x45, 0x5F, 0xCF, 0xA2, 0x4D,
+    0xD4, 0x7D, 0x7D, 0x42, 0x36, 0xF6, 0x4E, 0x5B, 0x98, 0x92, 0xC3, 0xC7, 0x57, 0x5E, 0xE5, 0xE8,
+    0x0A, 0x9B, 0xB8, 0x9D, 0xCC, 0x05, 0x3F, 0xE2, 0x3F, 0x37, 0xE1, 0x74, 0x27, 0x58, 0xA7, 0x16,
+    0x52, 0xD3, 0xE4, 0xC9, 0x97, 0xE6, 0xFE, 0x08, 0x3B, 0xB8, 0xF7, 0x8D, 0x8A, 0xD5, 0xE7, 0xED,
+    0x39, 0x3B, 0xA7, 0xB0, 0x13, 0xDF, 0x38, 0x74, 0xD8, 0x3F, 0xF0, 0x29, 0xDB, 0x8A, 0x97, 0x63,
+    0xF7, 0x37, 0x43, 0x42, 0x7D, 0x3A, 0x86, 0x91, 0x73, 0xEB, 0xB1, 0x0F, 0x7F, 0xF3, 0x54, 0x0C,
+    0x4F, 0x60, 0x54, 0xB8, 0x4E, 0xD1, 0x7F, 0x9E, 0x38, 0x3B, 0x39, 0x92, 0x2F, 0x67, 0x2B, 0x44,
+    0x3F, 0x60, 0x27, 0x77, 0x2A, 0x2C, 0xCB, 0xF2, 0xAD, 0x1E, 0xDC, 0x44, 0x58, 0x50, 0x33, 0x86,
+    0x4B, 0x1A, 0xA7, 0xA1, 0x88, 0xB7, 0x49, 0x32, 0xD8, 0x77, 0xEC, 0x2A, 0x84, 0xF3, 0xBD, 0xD7,
+    0x58, 0xA0, 0x7D, 0x6B, 0xC0, 0xA1, 0xBE, 0x79, 0x99, 0x9C, 0x8F, 0x0D, 0x4C, 0xE5, 0x6A, 0xBF,
+    0x8C, 0xD3, 0xD4, 0x51, 0x99, 0xB4, 0x3E, 0xB9, 0x4E, 0x29, 0x34, 0x0D, 0xE0, 0x81, 0x7F, 0x85,
+    0x64, 0xEE, 0x9F, 0x56, 0x2F, 0x03, 0x8E, 0x59, 0xEC, 0xF7, 0x47, 0x0E, 0x01, 0x3D, 0x97, 0x8B,
+    0xB9, 0xCE, 0xB8, 0x57, 0xD4, 0x47, 0x39, 0x9F, 0x1F, 0x93, 0xF2, 0x38, 0x8B, 0xC3, 0xA9, 0xDC,
+    0xF2, 0x41, 0xE3, 0x97, 0x03, 0xD5, 0x89, 0x2D, 0x07, 0xAA, 0x7B, 0x5A, 0x07, 0x1D, 0xAF, 0xCE,
+    0x9F, 0x7D, 0x76, 0x97, 0xC7, 0x38, 0xD1, 0x54, 0xAF, 0xB0, 0x59, 0xEA, 0x1E, 0xD2, 0x8A, 0x78,
+    0x1F, 0x47, 0xB8, 0x33, 0x3D, 0x6D, 0x43, 0xCC, 0xE9, 0x8B, 0xA5, 0x93, 0xDD, 0xEB, 0xCA, 0xC4,
+    0xB8, 0x22, 0x86, 0x24, 0xEF, 0xAF, 0x18, 0x2E, 0xF8, 0x31, 0xB6, 0xD9, 0xF3, 0xC7, 0x0E, 0x69,
+    0x51, 0xB2, 0xB1, 0xDF, 0xD6, 0x14, 0x05, 0x31, 0xCD, 0x22, 0xDB, 0x5B, 0x99, 0xDE, 0xF3, 0x82,
+    0x9A, 0x3D, 0xC7, 0x64, 0xCF, 0x15, 0x74, 0x21, 0xC6, 0xB4, 0xA3, 0x0C, 0x60, 0x58, 0x22, 0xDD,
+    0x72, 0xE0, 0x76, 0xE4, 0x90, 0x7A, 0x00, 0x32, 0x07, 0x36, 0xAE, 0xAE, 0xE2, 0x26, 0x4B, 0xBE,
+    0x16, 0x3E, 0xED, 0x05, 0xF3, 0xB1, 0xB2, 0x26, 0x70, 0xD1, 0x7E, 0x01, 0x89, 0x96, 0x57, 0xFA,
+    0x92, 0x2D, 0x2B, 0xB5, 0x22, 0x22, 0x1B, 0xF7, 0xAB, 0xB7, 0xC5, 0x7E, 0xD9, 0xAA, 0x6D, 0x29,
+    0xA4, 0x0E, 0xFD, 0x94, 0x4C, 0x8E, 0x2E, 0xAB, 0x14, 0x72, 0x96, 0xCB, 0x69, 0x28, 0xE2, 0xF5,
+    0xAE, 0x2C, 0x06, 0xFD, 0x20, 0x81, 0xDC, 0xBB, 0x26, 0x32, 0xF0, 0x5E, 0xE5, 0xA3, 0xEE, 0x42,
+    0x05, 0x31, 0x66, 0x6B, 0xFB, 0xBE, 0xBE, 0x8E, 0xA8, 0x69, 0x4C, 0x69, 0x2C, 0x71, 0x69, 0xD4,
+    0x4B, 0xA1, 0x29, 0xF3, 0xE3, 0xDE, 0x3F, 0x30, 0x76, 0x74, 0xDA, 0xFD, 0x82, 0x6D, 0xEF, 0x34,
+    0x7D, 0x89, 0x95, 0x07, 0xD7, 0xE9, 0x61, 0x2C, 0xDF, 0x9C, 0x69, 0xB1, 0x0A, 0x64, 0x92, 0x94,
+    0x83, 0x5B, 0x73, 0x03, 0xA7, 0x8F, 0x22, 0xD3, 0x9A, 0xE8, 0x5A, 0x2E, 0xD5, 0xD4, 0xE4, 0x74,
+    0xF5, 0x6C, 0xA1, 0xEE, 0xD0, 0x42, 0xDC, 0xCA, 0x02, 0x78, 0xEA, 0x30, 0x0E, 0x93, 0x80, 0x82,
+    0x24, 0xD2, 0xA3, 0x30, 0xD4, 0x2F, 0x69, 0xEC, 0x16, 0xFD, 0x8B, 0xEC, 0x34, 0x46, 0xFB, 0x7D,
+    0x3E, 0x0D, 0xBC, 0x69, 0xBE, 0x48, 0xCE, 0x7F, 0xF5, 0x2A, 0x80, 0x7D, 0x91, 0x34, 0x30, 0xDC,
+    0x57, 0xF1, 0x1C, 0x9F, 0xF9, 0x50, 0x24, 0x39, 0x1B, 0x4F, 0x33, 0xB7, 0x59, 0x50, 0x19, 0x38,
+    0xC8, 0xE6, 0x8C, 0xE0, 0x74, 0xF5, 0xCD, 0xAD, 0x5A, 0x4F, 0x99, 0x04, 0x70, 0x6F, 0xB2, 0x24,
+    0x67, 0x58, 0x92, 0x8B, 0xCC, 0x48, 0x70, 0x75, 0x89, 0x05, 0x18, 0xB1, 0xFE, 0x06, 0xAC, 0xBF,
+    0xFE, 0x5F, 0xAA, 0x6F, 0xAA, 0x6D, 0xD6, 0xE3, 0x1F, 0x47, 0xE4, 0x95, 0x9A, 0x29, 0xB9, 0x8E,
+    0x60, 0x94, 0xCB, 0x28, 0xF4, 0x3E, 0x76, 0x44, 0x3A, 0x5E, 0xAE, 0xF1, 0x64, 0xBD, 0x95, 0x45,
+    0x79, 0x98, 0xA8, 0x24, 0x48, 0x14, 0x56, 0x15, 0x60, 0x4D, 0xA3, 0xE0, 0x39, 0x9E, 0x17, 0x60,
+    0xFA, 0x2A, 0xF6, 0x76, 0x03, 0x28, 0xE6, 0x32, 0x71, 0x69, 0x32, 0x86, 0x9F, 0x6C, 0x1E, 0x37,
+    0x4E, 0xDA, 0xAF, 0x20, 0x1C, 0xC1, 0x6C, 0x9C, 0xD0, 0xD0, 0xB3, 0x9C, 0xA5, 0x44, 0x9C, 0x56,
+    0x86, 0xFE, 0xA0, 0xBE, 0x1C, 0xF0, 0xD2, 0xB8, 0x94, 0xC6, 0xC7, 0x2A, 0x0A, 0x73, 0x3E, 0x5B,
+    0x1D, 0xC8, 0x9A, 0x34, 0x5A, 0x38, 0xA7, 0x27, 0xC0, 0xFD, 0x09, 0x84, 0x5D, 0x27, 0xE4, 0xF0,
+    0xB2, 0x6D, 0x2B, 0x88, 0x1C, 0xD2, 0xF0, 0x52, 0x38, 0x15, 0x9B, 0xB7, 0xBB, 0xD5, 0xB1, 0x8F,
+    0x8E, 0xC3, 0xF0, 0xAE, 0x00, 0x7F, 0x56, 0x5B, 0x78, 0x2D, 0xAB, 0x19, 0x7B, 0x00, 0x8B, 0xCF,
+    0xA1, 0x6C, 0x77, 0xF9, 0x7E, 0xD9, 0xC9, 0x85, 0x7A, 0xD3, 0xE4, 0x8B, 0x5E, 0xB6, 0xC2, 0xC5,
+    0x19, 0x39, 0xE2, 0x5D, 0xE3, 0x15, 0x41, 0x07, 0xE5, 0xC6, 0xF4, 0x3C, 0x4D, 0xDF, 0x5C, 0x28,
+    0xB8, 0x38, 0xAC, 0x06, 0x6A, 0xF2, 0xB4, 0xCF, 0xB8, 0x2E, 0xC9, 0xE3, 0xEA, 0xAB, 0x28, 0x43,
+    0x80, 0xAA, 0x72, 0x9E, 0x47, 0xC2, 0xAE, 0x7D, 0x64, 0x98, 0x8F, 0xE4, 0xE6, 0xC3, 0x81, 0xE4,
+    0x66, 0x28, 0x6C, 0xAD, 0xDC, 0xCD, 0xDA, 0x1E, 0x47, 0xB4, 0xC3, 0x94, 0xAF, 0x0D, 0xFD, 0x1F,
+    0xCD, 0x5A, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0xE4, 0x17, 0x8B, 0x8D, 0x19, 0x8B, 0x19, 0x6C,
+    0x20, 0x48, 0x6C, 0xD3, 0x43, 0x06, 0xB7, 0x90, 0x45, 0x0F, 0x1A, 0x2E, 0x80, 0x4E, 0x47, 0x3B,
+    0x83, 0x87, 0x0E, 0xF5, 0xE0, 0x4B, 0x86, 0x16, 0x71, 0x86, 0x0E, 0x4D, 0x51, 0xC4, 0x2E, 0xE0,
+    0x41, 0x40, 0x4F, 0x3E, 0x3A, 0x19, 0xBA, 0x6A, 0x48, 0x33, 0x7B, 0xF0, 0xE0, 0xBA, 0x40, 0xED,
+    0x41, 0x83, 0x86, 0x53, 0x8E, 0x49, 0x87, 0x0C, 0x1E, 0xCC, 0x16, 0x08, 0xDC, 0xAD, 0x6C, 0x12,
+    0x14, 0x45, 0x3D, 0x98, 0x68, 0x4E, 0xC0, 0x29, 0x3E, 0x1D, 0xFB, 0xFB, 0xBD, 0x8F, 0x77, 0x92,
+    0x9C, 0xD8, 0x91, 0x2D, 0x4B, 0xEE, 0xE9, 0xBE, 0xF7, 0xEE, 0x28, 0xF2, 0xE3, 0xFB, 0xBE, 0xF7,
+    0xEF, 0xF7, 0x1E, 0x4F, 0xC4, 0xBE, 0xDC, 0x42, 0x2E, 0x0C, 0xDD, 0xC2, 0x5D, 0x7B, 0x2D, 0x2B,
+    0xFC, 0xD4, 0x29, 0xB2, 0x50, 0xA4, 0x1B, 0x37, 0x44, 0x16, 0x64, 0x4E, 0xF0, 0x5E, 0x10, 0x69,
+    0x48, 0x47, 0x24, 0x7A, 0x98, 0xE8, 0x3F, 0xEA, 0x3C, 0x05, 0x27, 0xD7, 0x05, 0x97, 0x75, 0x24,
+    0x48, 0x9D, 0x9E, 0x98, 0x9E, 0x9F, 0x89, 0xB4, 0x87, 0x32, 0x7E, 0x5D, 0x15, 0xC1, 0xF1, 0x5F,
+    0xC7, 0x3D, 0xFF, 0x41, 0x71, 0x31, 0x94, 0x95, 0xAC, 0x8E, 0x6B, 0x5A, 0x32, 0x8D, 0x2B, 0xC2,
+    0x2D, 0xA3, 0x85, 0x79, 0x67, 0x71, 0x7C, 0x0E, 0x34, 0xB8, 0xD2, 0x17, 0xB7, 0xCC, 0x64, 0xCB,
+    0xAB, 0xD3, 0x1D, 0xBA, 0x83, 0x4E, 0xD8, 0x93, 0xD6, 0xAC, 0x97, 0xC9, 0xE1, 0x1A, 0xC8, 0xD1,
+    0x1C, 0xE4, 0x88, 0xF0, 0xEB, 0x0F, 0x10, 0xB3, 0x41, 0x72, 0x99, 0xE2, 0xCA, 0xE7, 0x45, 0x86,
+    0x6F, 0x15, 0x58, 0x4D, 0x99, 0x8C, 0x6F, 0xE1, 0xC6, 0x20, 0x7E, 0x7A, 0x28, 0x3E, 0x74, 0x26,
+    0x6D, 0xA7, 0xD1, 0x67, 0xA9, 0x97, 0x7A, 0x77, 0x63, 0x2F, 0x35, 0x7D, 0x01, 0x49, 0x1F, 0x4D,
+    0x0C, 0xCE, 0xC4, 0xF4, 0x41, 0x2A, 0xEE, 0xDA, 0xEF, 0x72, 0xEC, 0xE2, 0x57, 0xEB, 0xF2, 0xDD,
+    0x97, 0xEF, 0xA4, 0xCA, 0xCD, 0xED, 0xD8, 0x1E, 0x28, 0x47, 0x4B, 0x1B, 0x9F, 0xD2, 0x28, 0xD7,
+    0xC4, 0x29, 0xCB, 0x75, 0x6F, 0xF5, 0x42, 0xE6, 0xAC, 0x36, 0xD7, 0xDD, 0xC2, 0xE9, 0x3B, 0x99,
+    0xF4, 0x21, 0xF0, 0x82, 0x93, 0x9A, 0x02, 0xBC, 0x21, 0xB1, 0x97, 0x83, 0x87, 0x31, 0xF6, 0x9C,
+    0x3C, 0x91, 0x28, 0x06, 0x0F, 0x12, 0xEC, 0x9D, 0xE5, 0x03, 0xCB, 0xB1, 0xF1, 0xCA, 0x4D, 0x61,
+    0x39, 0x74, 0xA3, 0xD7, 0xE1, 0x0C, 0x9D, 0xA7, 0x21, 0x0E, 0xE7, 0xC5, 0x9F, 0xC7, 0xFB, 0xE0,
+    0x32, 0xDF, 0x5B, 0xFD, 0x79, 0xEE, 0xAE, 0x35, 0x2F, 0x34, 0xCA, 0xA1, 0x98, 0xB2, 0x2C, 0xB7,
+    0xC8, 0x3F, 0xE5, 0xC5, 0x94, 0x4F, 0x82, 0xF7, 0x85, 0xF2, 0x89, 0xE1, 0x7D, 0x70, 0x9D, 0xA3,
+    0xF3, 0x2F, 0x54, 0x26, 0xD5, 0x90, 0x66, 0x33, 0xD6, 0xFB, 0x94, 0x65, 0x46, 0x7E, 0x25, 0x53,
+    0x39, 0x83, 0x2B, 0x69, 0x54, 0xC9, 0x57, 0x7F, 0x48, 0xCE, 0x4A, 0x3E, 0x33, 0x92, 0x2F, 0xB5,
+    0xF3, 0x84, 0x62, 0xE7, 0x9D, 0x93, 0xAB, 0x95, 0x7C, 0x39, 0xE5, 0x73, 0xD6, 0xDE, 0xCA, 0x2A,
+    0xF9, 0xC6, 0x26, 0x62, 0x86, 0x72, 0xC4, 0xC3, 0xAE, 0x5E, 0x16, 0xFF, 0x1D, 0x7C, 0x9D, 0xA6,
+    0x6C, 0x64, 0xD8, 0x02, 0x32, 0xBC, 0x9C, 0xEB, 0xD3, 0x14, 0xCC, 0x2F, 0xDF, 0x97, 0xB2, 0xCC,
+    0xA3, 0x53, 0x43, 0xC9, 0xFD, 0xB4, 0x8E, 0x0B, 0xD2, 0x30, 0x6E, 0x59, 0x7B, 0xEF, 0x90, 0x75,
+    0xF0, 0xA7, 0xD7, 0x91, 0xC1, 0x58, 0xC8, 0xFC, 0x54, 0x78, 0x0A, 0x76, 0x9C, 0x6C, 0x4E, 0xDE,
+    0x9D, 0x93, 0x4F, 0xF0, 0x8F, 0x3C, 0xFC, 0xF8, 0xFE, 0xA9, 0xB5, 0xB7, 0x72, 0xAF, 0x0C, 0xFF,
+    0x8B, 0x39, 0xC7, 0x2A, 0xA4, 0x07, 0x78, 0x7D, 0x91, 0xD7, 0x7A, 0x10, 0x1F, 0x66, 0xF1, 0xD4,
+    0xF4, 0x65, 0xA5, 0x35, 0xA5, 0x33, 0x4A, 0x2F, 0x99, 0xCC, 0x5B, 0x6D, 0xF6, 0x0C, 0x36, 0xA0,
+    0x04, 0xD5, 0xA5, 0x6F, 0xA2, 0x9E, 0x1A, 0x58, 0xA0, 0x16, 0x7D, 0x41, 0xF5, 0xD1, 0xB7, 0x96,
+    0x17, 0x53, 0xAA, 0x20, 0xA5, 0x54, 0x01, 0x95, 0x63, 0x55, 0x55, 0x51, 0x55, 0x97, 0x74, 0x13,
+    0xD2, 0x40, 0xA9, 0xFF, 0x38, 0xFA, 0xB2, 0xD2, 0x9A, 0xD2, 0x19, 0xA5, 0x97, 0xFC, 0x84, 0x52,
+    0xF9, 0x09, 0xA5, 0xF2, 0xF5, 0xEE, 0x96, 0x5A, 0x49, 0x02, 0x35, 0xF7, 0x50, 0x25, 0xB1, 0x56,
+    0xF2, 0xB5, 0x74, 0x53, 0x3F, 0xF1, 0x53, 0x48, 0x04, 0x4E, 0xA9, 0xED, 0x68, 0xC2, 0xD9, 0xDA,
+    0x3C, 0xB6, 0xAD, 0xE1, 0x43, 0x83, 0xDD, 0x75, 0x28, 0x47, 0x74, 0x24, 0xF6, 0x7E, 0x81, 0xD0,
+    0x0C, 0xC4, 0xED, 0x49, 0x23, 0x97, 0xB2, 0x07, 0x5F, 0xEA, 0x49, 0xB8, 0x18, 0xE6, 0x2E, 0xCC,
+    0x1B, 0x27, 0xBA, 0x43, 0xCB, 0xEE, 0xC7, 0xCA, 0xEE, 0xA4, 0xCA, 0x3E, 0xCF, 0x95, 0x7D, 0xD6,
+    0x53, 0x96, 0x0E, 0x2C, 0xBB, 0x6C, 0x59, 0x64, 0x59, 0x70, 0x5B, 0x99, 0x77, 0x4F, 0x99, 0xFB,
+    0x40, 0x19, 0x7C, 0x58, 0x59, 0x1B, 0x0C, 0x91, 0xA6, 0x01, 0xD6, 0x18, 0x40, 0x06, 0xDF, 0xBA,
+    0xFA, 0x56, 0x66, 0xB7, 0xA3, 0xDA, 0x09, 0x0A, 0x49, 0xC5, 0x7D, 0x2D, 0xD5, 0x41, 0x15, 0x37,
+    0x8A, 0xAD, 0xB8, 0xA2, 0xE2, 0x62, 0x19, 0x43, 0xCB, 0x28, 0x6E, 0x53, 0x54, 0xDC, 0xAE, 0xA8,
+    0xB8, 0x38, 0x85, 0xE2, 0x06, 0xA2, 0xE2, 0x92, 0x5D, 0xB6, 0x2C, 0xB2, 0x0C, 0xE2, 0x92, 0x41,
+    0x5C, 0x32, 0x88, 0x4B, 0x06, 0x71, 0x95, 0xB5, 0xC1, 0x54, 0xDC, 0x40, 0x54, 0xDC, 0xC0, 0x0A,
+    0x11, 0xC8, 0x66, 0x01, 0x2B, 0x36, 0xB7, 0x39, 0x48, 0x19, 0x6B, 0xE6, 0x46, 0x17, 0xE4, 0x6F,
+    0x32, 0xBA, 0xD1, 0xEB, 0xD0, 0xA9, 0xEB, 0x72, 0x28, 0x8E, 0xEE, 0x94, 0x71, 0x84, 0xB8, 0x49,
+    0x05, 0x9B, 0xC2, 0x64, 0x26, 0xC5, 0x78, 0x22, 0xEA, 0xE7, 0xB8, 0x2E, 0x6D, 0xAF, 0x9B, 0x75,
+    0x7B, 0xAF, 0xCD, 0xD4, 0xDE, 0xD1, 0x9A, 0x58, 0xA4, 0x77, 0xED, 0x57, 0x77, 0x3F, 0x62, 0x60,
+    0x6B, 0x1A, 0x02, 0x34, 0x00, 0xA8, 0xFB, 0xDB, 0x17, 0xAD, 0xDD, 0xE5, 0x57, 0xC3, 0x73, 0xBD,
+    0x16, 0x27, 0x40, 0x0A, 0x93, 0x03, 0x9C, 0xE0, 0x30, 0x97, 0x5A, 0xA3, 0x7A, 0x66, 0xA8, 0xAA,
+    0x5B, 0xD8, 0x1A, 0x29, 0xB0, 0x54, 0x84, 0xE2, 0x82, 0xDB, 0x85, 0xCC, 0xC6, 0x68, 0xE5, 0x09,
+    0x02, 0x40, 0xA0, 0x29, 0x2F, 0xC6, 0x16, 0x96, 0x85, 0xA7, 0x5E, 0xEF, 0x3B, 0x99, 0xB9, 0x9B,
+    0x30, 0x9A, 0xAB, 0x75, 0x3B, 0x7F, 0x94, 0xE0, 0x5E, 0x16, 0x39, 0xC5, 0x09, 0x5C, 0xA7, 0x6F,
+    0xE7, 0x66, 0x2F, 0xFA, 0xA8, 0xD7, 0x92, 0x5E, 0x47, 0x7A, 0xCB, 0xA0, 0x6E, 0x6F, 0xEE, 0x9D,
+    0xE5, 0xB0, 0xDF, 0xB6, 0x92, 0xD5, 0xA0, 0xAF, 0x13, 0x02, 0xD7, 0xB4, 0x1E, 0x09, 0x4F, 0xB5,
+    0x9F, 0xB7, 0xF9, 0x86, 0xBD, 0xD0, 0xB9, 0xE5, 0xD2, 0x91, 0x13, 0xF3, 0x41, 0x41, 0xC9, 0xB1,
+    0xFD, 0x99, 0xF9, 0x9E, 0x3F, 0x3F, 0x1F, 0x65, 0xE6, 0x99, 0x49, 0x90, 0xA3, 0xB3, 0x94, 0xBD,
+    0xB7, 0xA1, 0x54, 0x06, 0x0D, 0x9C, 0x40, 0x3C, 0x20, 0xC4, 0x03, 0x36, 0xB1, 0x3F, 0x5B, 0x3C,
+    0x20, 0x26, 0xC6, 0xB6, 0x7E, 0x95, 0xDA, 0xE4, 0x57, 0x99, 0x16, 0xF0, 0x81, 0x00, 0x1F, 0x28,
+    0x12, 0xA8, 0xE3, 0xEF, 0xC9, 0xF1, 0xC1, 0x24, 0x94, 0x24, 0xE6, 0x0E, 0x75, 0xBC, 0xBE, 0xD9,
+    0x1E, 0x80, 0x19, 0xCA, 0x0C, 0x98, 0xA1, 0x1D, 0x6F, 0x03, 0x24, 0x3C, 0x15, 0x66, 0x80, 0xB5,
+    0x4C, 0x89, 0xCC, 0x2E, 0xC1, 0x5D, 0xF2, 0xB1, 0xA3, 0x03, 0x41, 0xC4, 0x00, 0x10, 0xC4, 0x0F,
+    0x74, 0x80, 0x47, 0x0E, 0xA5, 0x4C, 0x8F, 0x44, 0x0D, 0x23, 0xD0, 0x10, 0x94, 0x98, 0x64, 0x5F,
+    0xB3, 0xC2, 0x08, 0x12, 0xD0, 0xDA, 0x83, 0x33, 0x3C, 0xE6, 0xC6, 0x7B, 0xB3, 0xAA, 0x12, 0x82,
+    0xDC, 0xB8, 0x6E, 0x3F, 0xF7, 0x60, 0x25, 0x7D, 0xE8, 0xF6, 0xDD, 0xE3, 0x3B, 0x5F, 0x99, 0xDD,
+    0x1E, 0x0D, 0x32, 0x27, 0x48, 0x4E, 0xF2, 0x9B, 0x19, 0x2D, 0x6F, 0xBF, 0x49, 0xF6, 0x48, 0x69,
+    0x2D, 0x6B, 0x21, 0x4E, 0x4E, 0x73, 0x84, 0x02, 0x8F, 0xDB, 0x25, 0x2E, 0xCD, 0xEE, 0x7C, 0x89,
+    0x07, 0x68, 0x88, 0xDE, 0x1D, 0xCC, 0xEA, 0xE8, 0x81, 0x6B, 0xCF, 0x67, 0x89, 0x8B, 0x2F, 0x62,
+    0x95, 0xCB, 0xD6, 0x26, 0xF7, 0x27, 0xD6, 0x46, 0x9F, 0xD5, 0x12, 0x35, 0x8B, 0x69, 0x08, 0x76,
+    0xF2, 0xE7, 0xA8, 0x45, 0xAC, 0x8E, 0x31, 0x47, 0xCD, 0x49, 0xB5, 0xF8, 0xEC, 0x96, 0xE8, 0x5C,
+    0x97, 0xB0, 0x4C, 0x6A, 0x5E, 0xFE, 0x32, 0xC3, 0x77, 0x5F, 0x73, 0x5F, 0xAB, 0x5B, 0x0E, 0x56,
+    0x9A, 0x1D, 0xC0, 0xC3, 0x16, 0x6F, 0x53, 0x44, 0x67, 0x80, 0xFB, 0xD4, 0x1F, 0x55, 0xA4, 0x43,
+    0x63, 0x7F, 0x9D, 0x26, 0xDC, 0x89, 0xB8, 0x49, 0x3F, 0x9A, 0xD8, 0xF5, 0xEC, 0xE3, 0x97, 0xD9,
+    0xC4, 0x0D, 0xEE, 0x88, 0xFF, 0x66, 0x16, 0x7C, 0x98, 0x4D, 0x38, 0xC9, 0x13, 0x27, 0xA0, 0x57,
+    0x6F, 0x50, 0xDE, 0x32, 0xDE, 0x54, 0xB1, 0x11, 0xD1, 0x57, 0x42, 0xEF, 0xBA, 0xF8, 0xFB, 0x55,
+    0x7C, 0xA9, 0xA9, 0x57, 0xD6, 0x9E, 0x22, 0x7F, 0x5A, 0xD1, 0x75, 0x15, 0xA3, 0xF0, 0xA5, 0x60,
+    0x7C, 0x7A, 0xF5, 0x6D, 0x88, 0xFD, 0x46, 0x41, 0xE1, 0x7F, 0x5B, 0xC8, 0x2D, 0x91, 0x7F, 0x02,
+    0xBB, 0x8A, 0xF3, 0x29, 0x17, 0x63, 0xAE, 0x90, 0x7A, 0xBA, 0xCE, 0x49, 0x87, 0x75, 0xCE, 0x61,
+    0x94, 0x5B, 0x10, 0x40, 0x73, 0x70, 0xB7, 0x24, 0xCD, 0xF9, 0x5F, 0x97, 0x79, 0xF0, 0x05, 0x13,
+    0x83, 0x1E, 0xF7, 0x69, 0x88, 0xB5, 0x28, 0x36, 0xAB, 0xCD, 0x7E, 0x59, 0x00, 0xEB, 0xF6, 0x6D,
+    0xAC, 0xAE, 0x96, 0x40, 0xC9, 0x55, 0xF6, 0x7F, 0xDC, 0x4F, 0x23, 0x07, 0x85, 0xF5, 0x09, 0xAC,
+    0x5A, 0xED, 0xA7, 0xAF, 0xC4, 0xB9, 0x59, 0x96, 0x83, 0xE8, 0xA3, 0xB5, 0xE6, 0xB9, 0x96, 0xB5,
+    0xA9, 0x3E, 0x8D, 0x18, 0x30, 0xA5, 0x03, 0x90, 0x77, 0x6C, 0xEE, 0x7C, 0xF8, 0x71, 0x11, 0x0E,
+    0xBC, 0x2D, 0xA9, 0x05, 0x56, 0x28, 0xCE, 0xDA, 0xDB, 0x3D, 0x7A, 0x45, 0x9F, 0x38, 0xBA, 0x47,
+    0xBC, 0x13, 0xDB, 0xBC, 0xB9, 0x30, 0x26, 0x1D, 0x4B, 0xF6, 0x35, 0xF1, 0x35, 0x28, 0xE3, 0x05,
+    0x71, 0x06, 0x3C, 0xA5, 0xCF, 0x1A, 0xAF, 0x8C, 0xB1, 0xDD, 0x7D, 0x42, 0x35, 0xE4, 0xCC, 0x35,
+    0x54, 0x51, 0x72, 0x61, 0x5C, 0xAA, 0x68, 0xEA, 0xFD, 0x59, 0x6A, 0xEE, 0x3D, 0x48, 0x83, 0xA4,
+    0x07, 0xE5, 0x2C, 0x6B, 0xA2, 0xE5, 0x08, 0xE2, 0x65, 0xF1, 0xB1, 0x55, 0x4C, 0xB3, 0xF4, 0x68,
+    0x82, 0x50, 0xFF, 0x0F, 0x67, 0x51, 0x74, 0xAD, 0x8B, 0x87, 0xFD, 0xAA, 0xE3, 0x8C, 0xF9, 0x7D,
+    0xE7, 0x17, 0xE7, 0xF7, 0xDF, 0xBC, 0x8A, 0x84, 0x2C, 0xD1, 0xA9, 0x0E, 0x8E, 0x2F, 0x6E, 0x54,
+    0x8A, 0x70, 0xCC, 0xEF, 0x81, 0x61, 0x3B, 0x5F, 0x10, 0xC8, 0x63, 0x17, 0x64, 0x12, 0x68, 0xFA,
+    0x1B, 0x68, 0xA5, 0x1D, 0x6F, 0xC2, 0x17, 0x3B, 0x58, 0x24, 0x8A, 0xA7, 0x79, 0xF0, 0xEF, 0x2E,
+    0x72, 0x03, 0x73, 0x38, 0xC3, 0xCD, 0x55, 0x7C, 0xA3, 0x74, 0xCB, 0x04, 0x10, 0x6E, 0x48, 0x73,
+    0x61, 0x09, 0xEE, 0xB0, 0xAE, 0xC5, 0x8E, 0xB8, 0xC5, 0x24, 0x0B, 0xAE, 0x1A, 0x09, 0x4D, 0xEB,
+    0x1B, 0x6C, 0x8B, 0xFB, 0x00, 0x1B, 0xE4, 0x0E, 0xDA, 0x3C, 0x16, 0xB1, 0x2E, 0x0F, 0xF4, 0x64,
+    0x22, 0x3B, 0x57, 0x51, 0xE0, 0xBA, 0x02, 0x3C, 0x54, 0x56, 0xE2, 0x5B, 0x7F, 0xCC, 0x71, 0xFD,
+    0x3C, 0x23, 0x61, 0x36, 0x2E, 0x28, 0xBA, 0x55, 0x09, 0xE4, 0x6D, 0x19, 0xCD, 0xB3, 0x5E, 0xDA,
+    0xCD, 0xBD, 0x74, 0x1A, 0x9F, 0x6B, 0x18, 0xB9, 0x78, 0x7F, 0x49, 0x91, 0x9B, 0x30, 0xEE, 0xE3,
+    0xF3, 0x97, 0x80, 0x8E, 0x29, 0xDC, 0x32, 0xBD, 0x8C, 0x11, 0x89, 0x9F, 0x07, 0x59, 0x77, 0x50,
+    0xD5, 0x8B, 0xBB, 0x88, 0x03, 0xB5, 0x50, 0x55, 0x08, 0x70, 0x74, 0x4C, 0x02, 0x62, 0x0D, 0xD6,
+    0xA6, 0x4F, 0x0D, 0x04, 0x19, 0x38, 0x60, 0x04, 0x6E, 0x66, 0x87, 0xF3, 0x6D, 0xCC, 0x56, 0x56,
+    0x75, 0xCB, 0x9F, 0xDC, 0xD8, 0x7D, 0x78, 0xFB, 0xD8, 0x65, 0xB1, 0x4C, 0x98, 0xB8, 0xB1, 0xB8,
+    0x33, 0xAC, 0x5B, 0xB3, 0x71, 0x58, 0x97, 0x98, 0x57, 0x4B, 0x6C, 0xC7, 0x5B, 0x6D, 0xBE, 0xBB,
+    0x61, 0xF3, 0x51, 0x39, 0xC4, 0x58, 0xC7, 0x0C, 0xF3, 0xF2, 0x3A, 0xF7, 0x86, 0x06, 0x4E, 0xD8,
+    0x3F, 0x6B, 0xE7, 0x71, 0xE8, 0x34, 0x13, 0xF4, 0xCE, 0x06, 0xFD, 0x92, 0xFE, 0x9A, 0x1C, 0x93,
+    0x30, 0x59, 0xC2, 0xE7, 0x01, 0x8E, 0xB5, 0x4F, 0x0D, 0xE0, 0xAD, 0x38, 0xE7, 0xE0, 0xC8, 0xD8,
+    0xCD, 0xED, 0x98, 0x86, 0xAE, 0x66, 0x7E, 0xA8, 0x79, 0xAE, 0x51, 0xF6, 0xE7, 0x6E, 0x14, 0x27,
+    0xDD, 0xEC, 0x18, 0x4C, 0x7B, 0x52, 0xE7, 0x85, 0xD5, 0xAE, 0x89, 0xD3, 0xCD, 0x34, 0x57, 0x74,
+    0x34, 0xA2, 0xD7, 0xF5, 0xDD, 0xBA, 0x25, 0x9D, 0x9E, 0xF4, 0x56, 0x5E, 0xCB, 0xC2, 0xE1, 0xA8,
+    0xE4, 0x99, 0xDD, 0x28, 0x79, 0xF6, 0x9D, 0x95, 0xB0, 0x60, 0xD2, 0xD9, 0xE6, 0x1B, 0x57, 0x19,
+    0xEA, 0x90, 0x25, 0xF4, 0xFF, 0x5B, 0xC7, 0x4C, 0x3B, 0x64, 0xD4, 0x3B, 0x3B, 0x64, 0xDA, 0x60,
+    0x71, 0xFA, 0x55, 0xA3, 0xE5, 0xF9, 0x74, 0xC8, 0xCC, 0x70, 0x73, 0xBB, 0xC1, 0x36, 0xC3, 0xB6,
+    0xB2, 0x3D, 0x6B, 0x8D, 0x55, 0x2F, 0x2D, 0xD9, 0x67, 0x47, 0xB8, 0xC2, 0x49, 0xF6, 0x2E, 0x39,
+    0x08, 0x14, 0xAB, 0xD1, 0x91, 0x9E, 0xFA, 0xCA, 0xEE, 0x24, 0x87, 0x46, 0xE9, 0x94, 0x7D, 0xF5,
+    0x7B, 0x1A, 0x80, 0x55, 0xE3, 0xB6, 0x18, 0x8C, 0xE7, 0xC3, 0xB2, 0x70, 0x57, 0x9B, 0xE7, 0x93,
+    0x76, 0xA2, 0x07, 0x2B, 0x6B, 0x78, 0x0C, 0x4B, 0xE7, 0x98, 0x1E, 0xBC, 0xAC, 0xC3, 0x1E, 0x80,
+    0x53, 0x16, 0x5B, 0xF6, 0xB9, 0xFD, 0x29, 0x44, 0x0F, 0x6F, 0xDF, 0xEB, 0x33, 0x0B, 0xAF, 0x70,
+    0xED, 0x0D, 0xAA, 0x2D, 0xA2, 0xF3, 0x84, 0xF1, 0x88, 0xE8, 0x57, 0x25, 0x73, 0x24, 0x0B, 0x24,
+    0x03, 0x10, 0x87, 0x4E, 0x86, 0xCF, 0x26, 0xC3, 0x96, 0x9A, 0x6C, 0x05, 0x9B, 0x77, 0x37, 0x17,
+    0x6B, 0x4E, 0x1A, 0xED, 0x1E, 0x22, 0x9A, 0x9E, 0xBA, 0x1B, 0xA5, 0xBE, 0xD6, 0x7A, 0xAE, 0x6E,
+    0xFE, 0x92, 0x6C, 0xDA, 0x6E, 0x6D, 0x73, 0x69, 0x93, 0x4B, 0x5B, 0x5C, 0xDA, 0xE0, 0xD2, 0xF6,
+    0x96, 0x36, 0xB7, 0xB4, 0xB5, 0xA5, 0x8D, 0x2D, 0x6D, 0x6B, 0x69, 0x53, 0x4B, 0x5B, 0x5A, 0xDA,
+    0xD0, 0xD2, 0x76, 0x96, 0x36, 0xB3, 0xB4, 0x95, 0xA5, 0x8D, 0x2C, 0x6D, 0x63, 0x69, 0x13, 0xCB,
+    0x4E, 0x5F, 0x35, 0x1C, 0xB5, 0x53, 0x74, 0x75, 0xDC, 0x92, 0x62, 0x43, 0x8A, 0xED, 0x28, 0x6D,
+    0x46, 0xFD, 0xC0, 0x1F, 0x5B, 0x4F, 0x6C, 0x3C, 0xD9, 0xB0, 0xA8, 0x45, 0x86, 0xC5, 0xC2, 0xFC,
+    0xE6, 0x31, 0x64, 0x4E, 0x32, 0x90, 0xBE, 0xE4, 0x8F, 0x3E, 0xE9, 0x31, 0x8B, 0x8F, 0x3B, 0x63,
+    0x68, 0x3C, 0xFD, 0x3D, 0xD0, 0x98, 0x1B, 0xF5, 0xED, 0x9F, 0x60, 0x53, 0xFF, 0xB9, 0x51, 0xD0,
+    0xA8, 0xFA, 0x82, 0xD8, 0xD9, 0xF9, 0x4E, 0x4B, 0x09, 0x4B, 0xC2, 0x12, 0xA6, 0x54, 0xF8, 0x4F,
+    0xC4, 0xBD, 0x9B, 0x98, 0x53, 0xA9, 0xF9, 0x20, 0x75, 0x80, 0x74, 0x0F, 0x3E, 0x71, 0x7B, 0x49,
+    0x36, 0xF5, 0xED, 0x6C, 0xCB, 0x6C, 0x52, 0x8F, 0x1C, 0x97, 0xE7, 0x01, 0x98, 0xAB, 0x9E, 0x46,
+    0x3A, 0x6A, 0x2F, 0x6A, 0x18, 0x78, 0x57, 0x76, 0x09, 0x3F, 0x5B, 0xDD, 0xF5, 0x47, 0xA5, 0xAA,
+    0xB1, 0xE9, 0xF2, 0x24, 0x81, 0xC0, 0xD5, 0x11, 0x10, 0x30, 0xCC, 0xC5, 0x1E, 0x53, 0xDE, 0x24,
+    0x03, 0xE9, 0x61, 0x02, 0x81, 0x19, 0x02, 0x81, 0x5B, 0x4C, 0xFF, 0x19, 0x08, 0xEC, 0x4F, 0x3A,
+    0x1E, 0x81, 0xC0, 0x24, 0x81, 0xC0, 0x61, 0x06, 0xBA, 0x1A, 0x35, 0x76, 0x8B, 0xBA, 0xCB, 0x46,
+    0x40, 0xC0, 0xD0, 0xF8, 0xFD, 0xF1, 0xAD, 0x59, 0x06, 0xD1, 0x10, 0xD9, 0xE9, 0x98, 0xD1, 0x2C,
+    0x87, 0x50, 0xF3, 0x0B, 0xE4, 0x7E, 0xC4, 0x28, 0x48, 0x5D, 0x07, 0xB2, 0x6B, 0xB9, 0x7F, 0xC6,
+    0xC4, 0xC8, 0xF9, 0x93, 0x18, 0x53, 0x18, 0x33, 0x08, 0x3C, 0x79, 0x24, 0x73, 0xC0, 0x6C, 0x8D,
+    0xD8, 0xE6, 0xFE, 0xA3, 0xF0, 0xE1, 0xDA, 0xF8, 0x01, 0x55, 0x41, 0x23, 0xEB, 0xB1, 0xFE, 0x9A,
+    0xE5, 0xBC, 0x07, 0xFC, 0xBD, 0xE8, 0x6F, 0xA2, 0xE2, 0xAD, 0x87, 0x12, 0xF8, 0xB1, 0x39, 0x9D,
+    0x3E, 0x71, 0x7D, 0xE6, 0xB0, 0x03, 0xE2, 0x33, 0x2C, 0x1C, 0xA5, 0xB0, 0xAF, 0xB8, 0xF1, 0xAE,
+    0x4B, 0xFC, 0x2B, 0xC4, 0xE8, 0xD8, 0x3B, 0x9D, 0xBE, 0x28, 0xE9, 0x53, 0xB4, 0x63, 0xC5, 0xFF,
+    0x3C, 0x15, 0xF3, 0x57, 0x48, 0x57, 0x20, 0x6E, 0xCD, 0x4C, 0x55, 0x98, 0xBE, 0xCC, 0xBC, 0xD5,
+    0xB7, 0x89, 0x22, 0x46, 0xE3, 0x2C, 0x2D, 0x7F, 0x3C, 0xE0, 0x11, 0xEE, 0xEA, 0x39, 0xD9, 0x72,
+    0x0C, 0xDE, 0xC3, 0x47, 0x24, 0x1C, 0x7C, 0x3C, 0xC2, 0x87, 0x23, 0xDA, 0x4F, 0xC7, 0xD2, 0x82,
+    0x9F, 0x26, 0x62, 0x3E, 0xC3, 0x9A, 0x32, 0x1B, 0xA2, 0xE4, 0x55, 0x94, 0x07, 0x0F, 0x10, 0xC9,
+    0x53, 0x26, 0x1E, 0xE4, 0x53, 0x58, 0x5B, 0x48, 0x8A, 0x79, 0xA3, 0x66, 0x53, 0x53, 0x66, 0x58,
+    0x45, 0x36, 0x3F, 0xDD, 0x27, 0x66, 0x15, 0xA9, 0xB0, 0x5B, 0x95, 0x55, 0x13, 0xD8, 0xA5, 0x06,
+    0x3E, 0x5F, 0x82, 0xAC, 0x8B, 0x2F, 0x3D, 0x5B, 0x79, 0xDF, 0x13, 0x16, 0x33, 0x1F, 0xA4, 0x13,
+    0xA2, 0xF0, 0xF5, 0x3D, 0xF1, 0xEF, 0x67, 0xA1, 0x53, 0xD4, 0xA5, 0xDF, 0xA2, 0x5D, 0xD8, 0xAE,
+    0xC8, 0xB9, 0x31, 0xD6, 0x8B, 0xE4, 0x60, 0xF0, 0x45, 0x6F, 0xDC, 0x9B, 0x9D, 0xA3, 0xD9, 0x24,
+    0xDE, 0x87, 0xA9, 0x93, 0x72, 0x9D, 0x06, 0xBA, 0x6B, 0x27, 0x5C, 0xCC, 0x36, 0xDF, 0xED, 0xD8,
+    0x68, 0x64, 0x69, 0xD5, 0x65, 0x1A, 0x53, 0x79, 0x89, 0x7B, 0x45, 0x55, 0x7A, 0x4E, 0xDB, 0xBC,
+    0xF5, 0xC7, 0xBE, 0x3F, 0x21, 0xEC, 0x76, 0x16, 0x25, 0x58, 0x97, 0x13, 0xA1, 0xBC, 0x6E, 0x9E,
+    0xBE, 0xB7, 0x3E, 0x91, 0x34, 0x7A, 0x97, 0x7E, 0xC3, 0x9D, 0xFD, 0xC1, 0xCE, 0xBA, 0xF9, 0x92,
+    0xE2, 0xAA, 0x97, 0xCE, 0x33, 0xB4, 0x1D, 0xDE, 0xBF, 0x77, 0x9D, 0xF5, 0x3A, 0x36, 0x2C, 0x84,
+    0x81, 0x78, 0x6F, 0xA6, 0xE2, 0xA4, 0xD9, 0xCE, 0x3B, 0xEB, 0x2E, 0x55, 0x1E, 0x32, 0xB7, 0xD5,
+    0x59, 0xCF, 0x9C, 0x9C, 0xD8, 0xA3, 0xB5, 0xFC, 0x98, 0xD5, 0x09, 0x7C, 0xF0, 0x0A, 0x62, 0x6A,
+    0x95, 0xC2, 0x77, 0xFC, 0x84, 0x20, 0x64, 0x28, 0xF1, 0x51, 0xFF, 0xA2, 0x80, 0xA2, 0x8A, 0x6E,
+    0xCD, 0x8C, 0xAB, 0xF5, 0x7F, 0x2B, 0x58, 0x27, 0xC2, 0x47, 0x7C, 0x01, 0xD1, 0xDA, 0x7B, 0x2B,
+    0x51, 0xDC, 0x8D, 0x08, 0xE3, 0x32, 0x83, 0xB9, 0x05, 0x4B, 0xF6, 0xE2, 0xB2, 0x96, 0xEC, 0xAC,
+    0xEA, 0x15, 0x8D, 0x7B, 0x7A, 0x6D, 0x8F, 0x26, 0xB3, 0x4E, 0xA3, 0x69, 0x27, 0x56, 0x25, 0xD0,
+    0x88, 0xDA, 0x7F, 0xA6, 0x40, 0xE4, 0x5A, 0x74, 0x67, 0x60, 0xFE, 0xBE, 0x60, 0x8A, 0x1A, 0xEE,
+    0xA5, 0xE0, 0xEA, 0xE1, 0xB7, 0x9F, 0xEB, 0xE3, 0x1C, 0xFA, 0xB4, 0x3A, 0xB5, 0x2C, 0x31, 0x30,
+    0x56, 0x6E, 0xBD, 0xAB, 0xE2, 0xD2, 0xD5, 0x01, 0x33, 0x32, 0x4F, 0x5D, 0xFD, 0x09, 0x64, 0xB5,
+    0xED, 0x58, 0x8A, 0x59, 0x27, 0xE8, 0x41, 0xA2, 0x80, 0x23, 0x9C, 0x4E, 0xF6, 0xEC, 0x09, 0x4C,
+    0xF0, 0x7B, 0x18, 0xCB, 0xDF, 0xF2, 0x2A, 0x60, 0x3F, 0x8B, 0xE7, 0x14, 0xBF, 0xD4, 0x60, 0xC5,
+    0xA9, 0xCF, 0xE0, 0x3E, 0x2F, 0x55, 0xBF, 0xDB, 0xD8, 0xF5, 0xB5, 0x4C, 0xC4, 0x56, 0xE7, 0x54,
+    0x79, 0xA5, 0xF1, 0x9D, 0xAD, 0x83, 0xC1, 0x3B, 0x3C, 0x5D, 0xCC, 0x32, 0x5A, 0x5F, 0xB2, 0x41,
+    0xBA, 0xA1, 0x9D, 0x23, 0x26, 0x64, 0xD4, 0xE9, 0x7C, 0xFA, 0x07, 0xEB, 0x58, 0xB8, 0x28, 0xF5,
+    0x42, 0x66, 0x97, 0xA5, 0x75, 0xD9, 0x29, 0x42, 0x2B, 0xCE, 0x41, 0x3D, 0x7B, 0x49, 0xDB, 0x2A,
+    0x09, 0xB3, 0xF8, 0xF4, 0x4D, 0x99, 0xF7, 0x93, 0x25, 0x83, 0xB2, 0x88, 0xB5, 0x64, 0x04, 0xDB,
+    0xC1, 0x0E, 0x45, 0x09, 0x72, 0xD6, 0x45, 0x93, 0x16, 0x26, 0x5D, 0xF6, 0x93, 0xC8, 0xDE, 0xF7,
+    0x2C, 0x71, 0x3F, 0x7F, 0x16, 0x03, 0x2B, 0x85, 0x63, 0x03, 0xF7, 0x2D, 0x9C, 0xFF, 0x62, 0xF9,
+    0xA2, 0x9F, 0xCE, 0x62, 0x4C, 0x9D, 0xF5, 0xD3, 0x83, 0x32, 0x7E, 0x6A, 0xBF, 0x8D, 0x11, 0x66,
+    0x88, 0x07, 0x55, 0x74, 0xD8, 0x17, 0x6F, 0x3C, 0xE5, 0x3F, 0x80, 0xF1, 0x82, 0xC2, 0x72, 0x37,
+    0xE1, 0xBD, 0x82, 0x2F, 0x00, 0x44, 0x89, 0x71, 0x1F, 0xF9, 0x4E, 0x85, 0x76, 0x5F, 0x56, 0x42,
+    0x12, 0x81, 0x00, 0x51, 0x20, 0x5A, 0x5A, 0x4C, 0x32, 0x01, 0xEC, 0x10, 0x9D, 0x5A, 0x11, 0xFB,
+    0x13, 0xA5, 0x10, 0x08, 0x39, 0xAC, 0xAA, 0x55, 0x04, 0x36, 0xAD, 0x25, 0xE1, 0x39, 0xFF, 0xEA,
+    0x55, 0xB5, 0xB4, 0xA6, 0xE4, 0xEA, 0x37, 0x07, 0xE4, 0x51, 0x6C, 0x8B, 0x0F, 0x6C, 0x01, 0x9C,
+    0x4A, 0xF3, 0x1C, 0x2E, 0x79, 0x83, 0xF3, 0x5E, 0x93, 0xC6, 0xCD, 0x78, 0xD9, 0x4B, 0x6F, 0x99,
+    0xFC, 0x98, 0xF5, 0x25, 0x48, 0x12, 0x89, 0x37, 0x94, 0x7D, 0x9E, 0x56, 0xF2, 0x04, 0xCE, 0xA3,
+    0xCE, 0x06, 0xAC, 0x05, 0xD3, 0xAD, 0xB0, 0x7A, 0xBC, 0xB6, 0xF1, 0xCB, 0xA1, 0x8C, 0xE5, 0x57,
+    0x32, 0xFA, 0xCD, 0xD0, 0xC2, 0x38, 0x1A, 0xA0, 0xD6, 0xD4, 0x4A, 0x53, 0x6B, 0xC2, 0x47, 0x13,
+    0x20, 0xFC, 0x44, 0x2B, 0xCB, 0xC7, 0x9F, 0x07, 0xC1, 0xA3, 0x94, 0x93, 0x0E, 0x74, 0xFA, 0x8B,
+    0x47, 0x00, 0x5F, 0x61, 0xA6, 0x41, 0x61, 0xE1, 0xEC, 0xA3, 0x5A, 0x8D, 0x9F, 0x5E, 0x13, 0xEF,
+    0x0E, 0x52, 0x6B, 0x2F, 0x4C, 0xBC, 0xFC, 0xF1, 0x76, 0xCA, 0x81, 0xFA, 0x2A, 0xEF, 0x0E, 0xCC,
+    0xE0, 0x7F, 0x7D, 0x54, 0x31, 0x6F, 0xDB, 0x46, 0x14, 0xFE, 0x48, 0x59, 0x66, 0x24, 0x4A, 0xA6,
+    0x52, 0xD8, 0x85, 0x9C, 0xCA, 0xA6, 0x06, 0x0D, 0xAA, 0x21, 0x87, 0x1A, 0x14, 0x40, 0x0D, 0x24,
+    0xF1, 0x90, 0xA9, 0x23, 0x07, 0xAB, 0x5D, 0x35, 0x78, 0x72, 0x07, 0x33, 0x80, 0x51, 0x68, 0x70,
+    0xA2, 0x03, 0xDA, 0xBD, 0xEA, 0x3F, 0xE0, 0xD0, 0x14, 0xA9, 0x96, 0x70, 0xB0, 0x01, 0x17, 0x55,
+    0xAA, 0x43, 0x33, 0x74, 0xBD, 0x76, 0xEC, 0x74, 0x4B, 0x87, 0x2C, 0x2D, 0x07, 0x17, 0x48, 0x0B,
+    0x59, 0xEC, 0x3B, 0xC9, 0x49, 0xDC, 0x16, 0xE8, 0x3D, 0xF2, 0xF8, 0x78, 0x77, 0xEF, 0xDD, 0xFB,
+    0xDE, 0xFB, 0xEE, 0x80, 0x47, 0xF0, 0x60, 0x33, 0x43, 0x00, 0xB6, 0x70, 0xD1, 0xC1, 0x00, 0x80,
+    0x23, 0xDD, 0xA4, 0x33, 0x8C, 0x8A, 0x06, 0xE0, 0x29, 0x79, 0x2F, 0x15, 0x25, 0x8F, 0xCD, 0x16,
+    0x47, 0xDF, 0x6C, 0xF5, 0x0F, 0xFC, 0x74, 0x1E, 0x64, 0x4F, 0x76, 0xFC, 0xB9, 0xAD, 0x3A, 0x8F,
+    0x3A, 0xA8, 0x95, 0xA7, 0xBD, 0x8B, 0x2E, 0x90, 0x65, 0x7E, 0x52, 0x3D, 0x41, 0x62, 0x71, 0x8B,
+    0xEC, 0xB3, 0x18, 0x49, 0x15, 0xCB, 0x30, 0x49, 0x7C, 0xF2, 0xAB, 0x1D, 0xFE, 0x28, 0x5D, 0x87,
+    0x75, 0xEE, 0x22, 0x6E, 0xD1, 0x5F, 0x5C, 0xE9, 0x9C, 0xB9, 0xCA, 0x16, 0x11, 0x35, 0xC4, 0x6A,
+    0x25, 0xCB, 0x75, 0xD3, 0x53, 0x74, 0x5D, 0x38, 0x36, 0xCB, 0x3C, 0x10, 0x26, 0xB7, 0x64, 0x46,
+    0x84, 0xC5, 0xDE, 0xD4, 0x49, 0x80, 0xF5, 0xB1, 0xF7, 0xAA, 0xDD, 0x18, 0xE4, 0xC0, 0x6D, 0x56,
+    0x41, 0x1B, 0x3D, 0xF8, 0xCC, 0x63, 0x14, 0x34, 0x73, 0x85, 0x23, 0x32, 0x22, 0xC3, 0x6D, 0x1A,
+    0x05, 0x76, 0x69, 0xDC, 0x27, 0x18, 0x0D, 0x6C, 0xC0, 0x14, 0xFF, 0x9D, 0x07, 0x59, 0x3A, 0xC8,
+    0x70, 0x48, 0x0D, 0xD8, 0xA1, 0x75, 0x21, 0x60, 0x7D, 0x32, 0xB3, 0x0C, 0xC8, 0x97, 0x0B, 0xC9,
+    0x66, 0xC9, 0x56, 0x88, 0xE6, 0xB5, 0xC0, 0x61, 0x0E, 0xD7, 0x90, 0x3A, 0x64, 0xB7, 0xD6, 0x0D,
+    0xC3, 0xF6, 0x4E, 0x16, 0x79, 0x92, 0x11, 0x59, 0x1F, 0x8D, 0x8F, 0xC7, 0x5A, 0xD7, 0x2D, 0x0F,
+    0x97, 0x8D, 0x64, 0x1E, 0x39, 0x1A, 0x3D, 0x1A, 0x03, 0x86, 0xD0, 0x62, 0x8A, 0x11, 0xEF, 0xD1,
+    0xAC, 0x5C, 0x8A, 0xC2, 0x8C, 0x79, 0xA8, 0xCE, 0xE7, 0xD5, 0xD7, 0x49, 0xF3, 0xF8, 0xB9, 0x52,
+    0xF1, 0xB9, 0xF2, 0xF8, 0x66, 0xA7, 0x1D, 0x06, 0x40, 0x11, 0x8E, 0x30, 0x95, 0xA1, 0x3E, 0x96,
+    0x23, 0x96, 0xA7, 0x4D, 0xCF, 0x70, 0x81, 0xC7, 0x63, 0x57, 0x22, 0x8E, 0xE3, 0x88, 0x1C, 0xCD,
+    0x52, 0xF5, 0xED, 0x47, 0x2A, 0x86, 0x0A, 0x10, 0x30, 0xE3, 0xC5, 0x67, 0xDF, 0xFD, 0x56, 0x3F,
+    0x0C, 0xB2, 0xED, 0xC6, 0xEE, 0x99, 0xAD, 0x4C, 0x6E, 0x72, 0x47, 0xED, 0x9E, 0xB5, 0x1B, 0x41,
+    0x16, 0xD0, 0x69, 0x73, 0x2F, 0x29, 0x10, 0xE6, 0x5E, 0x76, 0x4F, 0xC3, 0x22, 0x25, 0x90, 0xC1,
+    0x57, 0x32, 0xA4, 0x5A, 0xDE, 0xD1, 0x9E, 0x16, 0xFD, 0x3E, 0x7D, 0x46, 0xE9, 0xD5, 0xAA, 0xA6,
+    0x7B, 0x93, 0xA7, 0xF4, 0xBB, 0x52, 0x6E, 0x54, 0x1D, 0x47, 0x93, 0xF1, 0x28, 0x95, 0x13, 0x6A,
+    0xB3, 0x34, 0x5D, 0xC0, 0xE0, 0x14, 0x21, 0x9E, 0xC3, 0x52, 0x94, 0x46, 0x6C, 0x62, 0xD5, 0xA8,
+    0xA6, 0x31, 0x08, 0x9F, 0x21, 0x75, 0xCA, 0x33, 0x0C, 0x36, 0x28, 0xFB, 0xD8, 0x01, 0x65, 0xF7,
+    0xFF, 0x27, 0x6B, 0x40, 0xE9, 0xB4, 0x58, 0x6C, 0x9C, 0x90, 0x97, 0x08, 0x11, 0x21, 0x23, 0x88,
+    0xAB, 0x3D, 0x9F, 0xF4, 0x89, 0x1C, 0xD1, 0x79, 0x5F, 0x91, 0xBE, 0xB6, 0x39, 0x5A, 0xFC, 0xF0,
+    0x82, 0x3F, 0xA8, 0x72, 0x9F, 0x4A, 0xE6, 0x8B, 0xAA, 0xD8, 0x1E, 0xC6, 0xC3, 0xFD, 0x8D, 0xFD,
+    0x2A, 0x45, 0x4F, 0x18, 0xC8, 0xFA, 0xB5, 0xE2, 0x53, 0xCD, 0x32, 0x02, 0x54, 0x03, 0xE7, 0x9A,
+    0xCE, 0x37, 0xE1, 0x0C, 0x4F, 0x1B, 0xF5, 0x40, 0x87, 0xDC, 0x45, 0xB9, 0x33, 0xE8, 0x0E, 0x2F,
+    0x3B, 0xE1, 0xE5, 0x92, 0xF1, 0xA7, 0x24, 0x3E, 0x74, 0x66, 0xFE, 0x91, 0xE4, 0x7F, 0x65, 0xE6,
+    0x06, 0x57, 0xD3, 0xF7, 0xAC, 0x75, 0xFA, 0x18, 0x2D, 0x78, 0x89, 0x76, 0x7E, 0xFB, 0x77, 0x80,
+    0xE8, 0x98, 0x2C, 0x9F, 0x00, 0xAE, 0x94, 0xF7, 0x53, 0x31, 0xB8, 0xAB, 0x61, 0xE9, 0x91, 0xE8,
+    0x6D, 0x18, 0xB7, 0x3D, 0xF6, 0x26, 0x1E, 0x62, 0x55, 0xA9, 0x37, 0x1D, 0x5D, 0x95, 0x6B, 0xCB,
+    0x53, 0x42, 0x8C, 0x70, 0xA0, 0x25, 0xCD, 0xCC, 0x9D, 0xE4, 0xA5, 0xF1, 0xD5, 0x7A, 0x4C, 0x44,
+    0x43, 0x28, 0xB3, 0x4F, 0x88, 0xA6, 0x5B, 0x59, 0xDA, 0x60, 0x40, 0xD0, 0x0C, 0x46, 0xA9, 0xFF,
+    0x89, 0xBA, 0xF0, 0x67, 0xE0, 0xD6, 0xAA, 0xA3, 0x75, 0x6B, 0xA1, 0xC9, 0x51, 0xD6, 0xBB, 0x13,
+    0xC4, 0x03, 0x23, 0x80, 0xCC, 0x7D, 0x8D, 0x70, 0xE9, 0xE0, 0x57, 0xE3, 0x20, 0x1B, 0x2F, 0x9D,
+    0x82, 0x4E, 0x81, 0xCB, 0x6D, 0xD1, 0x45, 0x09, 0x6B, 0xFB, 0xC4, 0xE8, 0x1C, 0xED, 0x9B, 0xF4,
+    0xA6, 0x61, 0x31, 0x23, 0x2C, 0x69, 0xF2, 0x37, 0x29, 0xE6, 0xA0, 0x7A, 0x79, 0xAC, 0x07, 0x4B,
+    0x68, 0x60, 0x6F, 0xAD, 0xA4, 0x85, 0xEF, 0x6D, 0xE6, 0x7C, 0x21, 0x9E, 0xEF, 0x48, 0xD9, 0x8A,
+    0x97, 0xF5, 0x1B, 0x74, 0x1E, 0x13, 0x9F, 0xF1, 0xCE, 0xE7, 0xBD, 0xA9, 0xAD, 0x7A, 0x53, 0x93,
+    0xBB, 0xCF, 0xD8, 0xBD, 0x3F, 0x44, 0x18, 0x49, 0xEA, 0x49, 0xDF, 0x24, 0x1A, 0xF8, 0xE2, 0x5D,
+    0x3A, 0xD3, 0x54, 0x70, 0x8D, 0x5A, 0x5F, 0x03, 0x95, 0x0D, 0x7D, 0x17, 0x98, 0x7F, 0xF6, 0x8F,
+    0x39, 0xBC, 0xF4, 0xD5, 0x8A, 0x4B, 0xCB, 0x59, 0x7D, 0x50, 0x1B, 0x0E, 0x83, 0x91, 0x98, 0x7F,
+    0xF5, 0x9F, 0xDD, 0x98, 0xDD, 0x9B, 0x4C, 0x9E, 0x8E, 0xD2, 0xF4, 0x4A, 0xBF, 0x5A, 0x37, 0x27,
+    0x0C, 0x39, 0x37, 0x5D, 0xB0, 0x46, 0x0B, 0xC7, 0xE9, 0x25, 0xE1, 0xEE, 0x33, 0x64, 0x27, 0x81,
+    0xAE, 0xE2, 0x02, 0x96, 0xA4, 0x87, 0x88, 0x86, 0x13, 0x3A, 0xCA, 0x28, 0x5C, 0xB3, 0xB5, 0x7A,
+    0x34, 0x99, 0x5C, 0x90, 0x83, 0x39, 0xE9, 0xCD, 0xA5, 0x53, 0x5E, 0x12, 0x5B, 0xA2, 0x29, 0x1E,
+    0x8A, 0x72, 0x90, 0xE7, 0xCD, 0xE8, 0x7E, 0xD4, 0x44, 0x5D, 0x9F, 0x97, 0x0A, 0xEA, 0x85, 0x42,
+    0xA1, 0xB2, 0x7D, 0x87, 0x37, 0x07, 0x83, 0x66, 0x18, 0x36, 0xC7, 0xEB, 0xAC, 0x51, 0x2F, 0x94,
+    0xB5, 0x14, 0xEB, 0xE6, 0x87, 0x7B, 0xEC, 0x4B, 0x26, 0x20, 0x10, 0xB1, 0x6D, 0xED, 0x47, 0x21,
+    0xDA, 0x8B, 0x06, 0x4A, 0xDF, 0x6A, 0x4D, 0xB5, 0x5D, 0x25, 0x80, 0xB4, 0x67, 0x31, 0x2E, 0x5C,
+    0x5B, 0x6C, 0xDF, 0xFA, 0xF4, 0x17, 0xDE, 0x0A, 0x65, 0xAB, 0x39, 0x5E, 0x3D, 0x87, 0xB5, 0xE0,
+    0x7D, 0x55, 0xC0, 0x4A, 0xC8, 0xC3, 0xE6, 0x07, 0xB5, 0x5A, 0xAD, 0x9E, 0x3B, 0x0B, 0x9B, 0xA5,
+    0x3A, 0x2F, 0xD0, 0x7D, 0x65, 0x60, 0x18, 0x55, 0xE8, 0xF6, 0xC9, 0xF3, 0xAA, 0x3C, 0x8C, 0xFE,
+    0x06, 0xC5, 0x7C, 0x4F, 0x6C, 0x1C, 0xE9, 0x75, 0xE7, 0xAB, 0xAA, 0x21, 0x4B, 0xA3, 0x1A, 0xB1,
+    0x74, 0x10, 0xD7, 0x5E, 0x8B, 0xE3, 0xD2, 0x61, 0x0E, 0x42, 0x56, 0xC3, 0x1A, 0x20, 0x3C, 0xD0,
+    0x59, 0x76, 0x77, 0xC9, 0x03, 0xD8, 0xC0, 0xCE, 0x61, 0x7B, 0x01, 0xB5, 0x27, 0x80, 0xB0, 0xD1,
+    0x1C, 0x7C, 0x88, 0xBD, 0x49, 0xC8, 0x00, 0x04, 0x76, 0x92, 0x34, 0xD9, 0x35, 0x9E, 0x43, 0x0E,
+    0x3E, 0x84, 0x0B, 0x78, 0x9C, 0xCB, 0x02, 0x11, 0xB0, 0x73, 0xB0, 0xE8, 0xC5, 0x92, 0x0B, 0xE8,
+    0x40, 0x2C, 0x9A, 0xEC, 0xD2, 0x08, 0xC8, 0x65, 0xE0, 0x75, 0x79, 0x06, 0xF2, 0x5C, 0x16, 0x98,
+    0x72, 0x22, 0x61, 0x83, 0x11, 0x12, 0x55, 0x26, 0x45, 0xB8, 0x28, 0x75, 0x77, 0xE5, 0xF7, 0xFB,
+    0xBE, 0xEA, 0x66, 0x93, 0x22, 0x25, 0x4A, 0x22, 0x6D, 0xB2, 0xBF, 0x57, 0xDD, 0x55, 0xD5, 0xDF,
+    0xDF, 0xF7, 0xE7, 0xF7, 0xDE, 0xF7, 0xAA, 0xA5, 0x2E, 0x62, 0x64, 0x22, 0xD2, 0x44, 0x79, 0x15,
+    0xC5, 0x14, 0xF5, 0x57, 0x14, 0x45, 0xE8, 0x7D, 0xB1, 0x16, 0x3A, 0x91, 0x85, 0x62, 0xA2, 0x18,
+    0x81, 0x13, 0x89, 0x0C, 0x4B, 0xD1, 0x15, 0xE7, 0xCE, 0x15, 0xD9, 0x73, 0x2E, 0x92, 0x3A, 0x4A,
+    0xC2, 0xE2, 0xDD, 0x79, 0x3B, 0x46, 0x1D, 0xB1, 0x11, 0x7E, 0x57, 0xAC, 0xA4, 0x2B, 0x66, 0xBC,
+    0x21, 0x83, 0xBF, 0xE3, 0xAA, 0xBB, 0x56, 0x14, 0xB9, 0x2C, 0xAF, 0x7D, 0xD1, 0x96, 0x45, 0x37,
+    0x9A, 0x93, 0x05, 0x37, 0x9A, 0xD2, 0x44, 0x5C, 0x7C, 0xA3, 0x24, 0x7F, 0x7B, 0x03, 0xA4, 0x28,
+    0x22, 0x71, 0x63, 0x3B, 0xC5, 0x39, 0x0C, 0x16, 0x17, 0x72, 0x92, 0xEE, 0xF0, 0x1D, 0x89, 0x99,
+    0x8A, 0x17, 0x9F, 0x8F, 0x8D, 0xA2, 0x57, 0xD5, 0xDD, 0xC4, 0x09, 0xB1, 0x51, 0x87, 0x8B, 0xF7,
+    0x5F, 0x1D, 0xF6, 0x3C, 0x40, 0xCF, 0xD1, 0x5B, 0x1B, 0xC5, 0x2A, 0x8B, 0xC8, 0x51, 0x8B, 0x17,
+    0xB3, 0x8E, 0x72, 0x1A, 0xFC, 0xBE, 0x98, 0x3B, 0xD7, 0x22, 0xD4, 0x11, 0x7B, 0x62, 0x45, 0x35,
+    0x31, 0xA4, 0x82, 0xD3, 0x4B, 0x28, 0x6D, 0x94, 0x4E, 0x91, 0xCA, 0xD6, 0xEA, 0x75, 0xF5, 0x9E,
+    0xE7, 0xD8, 0xAB, 0x1A, 0x8A, 0x17, 0xA0, 0x4B, 0xB1, 0xC4, 0xD6, 0xCE, 0xD5, 0x48, 0x5A, 0xFD,
+    0xC1, 0xA4, 0x9A, 0x98, 0xD3, 0x6F, 0x65, 0x15, 0x69, 0x37, 0xE5, 0xDD, 0xA6, 0x5A, 0x4E, 0xDC,
+    0xEC, 0x25, 0x62, 0x17, 0x81, 0x74, 0x70, 0xC8, 0x05, 0xE3, 0x95, 0xCA, 0x1B, 0x52, 0xB9, 0x29,
+    0x95, 0x0D, 0x69, 0x56, 0x8D, 0xCC, 0x29, 0x42, 0x8E, 0xA9, 0xEB, 0x61, 0x56, 0x0F, 0xFF, 0xF7,
+    0xE2, 0xA2, 0xF7, 0xCE, 0xC5, 0xBC, 0x79, 0x73, 0x4E, 0x8E, 0x78, 0xB7, 0x5B, 0x44, 0x46, 0x5F,
+    0x0D, 0xE2, 0x39, 0x5E, 0xB9, 0x18, 0xA9, 0xD8, 0x89, 0x2C, 0x07, 0x62, 0x91, 0x51, 0x44, 0x96,
+    0x57, 0x7B, 0x68, 0x78, 0x16, 0x57, 0x0E, 0xA7, 0x33, 0x52, 0xEC, 0x90, 0xEE, 0xCC, 0xC7, 0xA0,
+    0xB9, 0x99, 0xC9, 0x02, 0xCE, 0x77, 0x65, 0x1D, 0xB4, 0x5D, 0xD2, 0x84, 0xD4, 0x8C, 0x79, 0xFE,
+    0x3C, 0x96, 0xDC, 0xC8, 0x8A, 0xD0, 0xDC, 0xB9, 0x1A, 0x77, 0xC4, 0x2B, 0x06, 0xB3, 0x58, 0x74,
+    0xDD, 0x22, 0xC6, 0xAC, 0xB1, 0xFB, 0x58, 0xAF, 0xF6, 0x13, 0xE8, 0x9D, 0xC6, 0x66, 0x1D, 0x9C,
+    0xCA, 0x2E, 0xF2, 0xCC, 0x78, 0xA6, 0xCE, 0x77, 0x15, 0x5D, 0x7A, 0x8C, 0x36, 0xF5, 0x55, 0xAC,
+    0x7F, 0xEF, 0x6A, 0xCA, 0x19, 0x2A, 0x02, 0xC5, 0xBD, 0x9A, 0x7D, 0x35, 0xFF, 0x96, 0xBC, 0xAB,
+    0xA9, 0xE6, 0xDE, 0x01, 0xBD, 0x75, 0x43, 0x4A, 0x2E, 0xC6, 0xD2, 0x3B, 0x89, 0x68, 0x76, 0x25,
+    0x37, 0x3F, 0x81, 0x7A, 0xB1, 0x81, 0xC9, 0x2C, 0x7A, 0x86, 0x5A, 0x66, 0x29, 0x59, 0x48, 0xF1,
+    0x13, 0xE6, 0x02, 0x1C, 0x13, 0x0E, 0x47, 0xED, 0xF4, 0x31, 0x68, 0x33, 0x17, 0xF2, 0xA2, 0x90,
+    0xB9, 0x41, 0xBE, 0xCE, 0xA1, 0xCE, 0x92, 0xE0, 0x66, 0xE7, 0xB6, 0x92, 0x4B, 0x92, 0xCF, 0x50,
+    0xB5, 0x73, 0x2B, 0xE7, 0x85, 0x1E, 0x49, 0x8D, 0xC4, 0x8B, 0x40, 0xD0, 0x31, 0x54, 0x90, 0x91,
+    0xCB, 0xFB, 0x52, 0xF4, 0xC4, 0x8F, 0xE4, 0x25, 0xD6, 0xEF, 0x91, 0x90, 0xFD, 0xC5, 0x88, 0xF9,
+    0xF6, 0x9D, 0x61, 0xBB, 0x56, 0x91, 0x82, 0x45, 0x5B, 0x9C, 0xC1, 0x9A, 0x0C, 0x48, 0x07, 0xC4,
+    0x2C, 0x58, 0x9F, 0x0F, 0xF2, 0x2A, 0xC9, 0x22, 0x49, 0x02, 0x72, 0x3B, 0x04, 0xF9, 0xBF, 0x02,
+    0xD2, 0x25, 0x49, 0x49, 0x22, 0x4D, 0x6A, 0x6C, 0xB7, 0x15, 0x14, 0x3D, 0x54, 0x2A, 0x17, 0x2D,
+    0x0C, 0xAE, 0x8D, 0xC1, 0x48, 0x6D, 0x0D, 0x0D, 0x8F, 0xDF, 0x18, 0x36, 0x09, 0x79, 0xF0, 0x13,
+    0xA3, 0xC7, 0x99, 0x5D, 0x14, 0x3B, 0x06, 0x6F, 0x58, 0xA9, 0xC4, 0xD0, 0x81, 0x06, 0xEE, 0xEB,
+    0xF2, 0x6B, 0x9B, 0x36, 0x25, 0xCD, 0xA1, 0x84, 0x9E, 0xE1, 0xB4, 0xFF, 0x77, 0xF6, 0x9E, 0x4C,
+    0x86, 0x1B, 0x31, 0x6B, 0xC9, 0x60, 0x1C, 0xD4, 0x0D, 0x16, 0x85, 0xD9, 0xE8, 0xC9, 0xEE, 0x4C,
+    0x16, 0x09, 0xD8, 0xA7, 0xA0, 0x56, 0x58, 0x62, 0xAF, 0x2A, 0x2F, 0x44, 0xBC, 0x3B, 0x8D, 0x65,
+    0x2A, 0x9D, 0x02, 0x02, 0xDC, 0x65, 0x4B, 0xEC, 0x81, 0xA4, 0x83, 0x15, 0x94, 0x95, 0xC1, 0x47,
+    0x93, 0x2A, 0xDC, 0x62, 0x27, 0x6D, 0x2A, 0x72, 0x97, 0x8A, 0xE4, 0x8C, 0x0F, 0x72, 0x89, 0x93,
+    0x3F, 0xEB, 0x62, 0x58, 0x8B, 0x5C, 0x81, 0x75, 0x8C, 0x58, 0x52, 0x2B, 0x01, 0x5F, 0x60, 0x96,
+    0x4C, 0x6A, 0x43, 0x0C, 0xB9, 0x2B, 0x36, 0x35, 0x06, 0x14, 0x5D, 0x85, 0xEA, 0xA5, 0x25, 0x45,
+    0x6A, 0x17, 0x09, 0x9A, 0x95, 0xBD, 0xCA, 0xCE, 0xDC, 0x55, 0x66, 0x77, 0xC0, 0x22, 0x58, 0x62,
+    0x27, 0xF2, 0x03, 0x2D, 0xF8, 0x76, 0x4C, 0xE6, 0xD1, 0x47, 0x16, 0x37, 0xF2, 0xEE, 0x74, 0xD0,
+    0xF7, 0x0C, 0xE5, 0x43, 0xD4, 0xC3, 0x55, 0x75, 0xC3, 0xBD, 0xCA, 0x82, 0x9F, 0xFF, 0x04, 0xF5,
+    0x80, 0xF1, 0xEE, 0xCC, 0xB3, 0x1D, 0x2A, 0x43, 0xA8, 0x17, 0x2B, 0x2D, 0x4B, 0xC2, 0xBA, 0xBC,
+    0x3B, 0xF3, 0x61, 0x01, 0xF1, 0x3E, 0x2E, 0xE5, 0x4B, 0xB5, 0x12, 0x43, 0xAB, 0x74, 0x02, 0xB9,
+    0x44, 0x3D, 0xB9, 0x8F, 0x5C, 0x24, 0x99, 0x25, 0x99, 0x19, 0x92, 0x05, 0x92, 0x75, 0x92, 0x84,
+    0x24, 0x06, 0x31, 0x23, 0x10, 0xCC, 0x5D, 0x53, 0xBC, 0x46, 0x63, 0x33, 0xE8, 0x70, 0x91, 0x36,
+    0x31, 0xFD, 0xC9, 0x4D, 0x2C, 0x53, 0xB2, 0xCE, 0x15, 0x52, 0xA4, 0x4E, 0x86, 0x3F, 0x2E, 0x8B,
+    0xE7, 0x75, 0xBD, 0xE2, 0x07, 0x45, 0x68, 0xA7, 0xE3, 0x3D, 0xD9, 0xE2, 0xCA, 0xE7, 0x72, 0x93,
+    0x9D, 0xCD, 0xC8, 0x90, 0xAF, 0x4A, 0x46, 0xF6, 0x75, 0x24, 0xA3, 0xC5, 0xB2, 0xA2, 0xEC, 0x92,
+    0xE2, 0x93, 0x6C, 0x91, 0x8C, 0x53, 0x14, 0xE4, 0x1F, 0x6B, 0x7B, 0x67, 0x93, 0xDC, 0x1C, 0x67,
+    0xB4, 0x24, 0x6E, 0x98, 0x41, 0x6E, 0x21, 0x38, 0x99, 0x83, 0xAF, 0x6F, 0xE2, 0xEB, 0x29, 0x8D,
+    0x44, 0x06, 0xB5, 0x61, 0xB1, 0xEA, 0x4D, 0x28, 0x1B, 0xB3, 0x2B, 0xB5, 0xA0, 0x15, 0x78, 0x45,
+    0xE4, 0x28, 0xB6, 0x73, 0x30, 0x75, 0xB5, 0xCB, 0x5D, 0x68, 0x91, 0x65, 0xD9, 0xC0, 0x57, 0xCF,
+    0x29, 0x9B, 0x54, 0xD5, 0x00, 0x82, 0x3A, 0x89, 0xCA, 0xE6, 0x3B, 0x64, 0xC4, 0x65, 0x0A, 0x90,
+    0xB2, 0x57, 0x17, 0x50, 0x6E, 0xE2, 0x3D, 0xAA, 0x92, 0x16, 0xBE, 0x7B, 0xBE, 0x48, 0x4E, 0x5A,
+    0xFE, 0x2F, 0x51, 0xB9, 0x35, 0x0F, 0x92, 0xFF, 0x93, 0x6A, 0xF2, 0xE4, 0x94, 0xE8, 0x80, 0x5F,
+    0xFB, 0x5C, 0xE9, 0xF6, 0xC1, 0x64, 0x66, 0x2F, 0x59, 0x20, 0x59, 0x1F, 0x92, 0x04, 0x04, 0x86,
+    0xAF, 0x2D, 0xE7, 0x69, 0x85, 0x8A, 0x10, 0x0A, 0xAB, 0x23, 0xB4, 0x74, 0x6A, 0x4A, 0xB8, 0x68,
+    0x89, 0x97, 0x09, 0xB5, 0x56, 0x2E, 0x66, 0x5F, 0x9C, 0xB6, 0x58, 0xCB, 0xE2, 0x54, 0xC4, 0xAE,
+    0x8A, 0x53, 0x93, 0xD3, 0xA0, 0x9E, 0x9C, 0x01, 0x75, 0xC3, 0x29, 0x50, 0x0C, 0x08, 0xD4, 0x8E,
+    0x67, 0x40, 0xAD, 0x64, 0x1D, 0xD4, 0x4C, 0x13, 0x50, 0x63, 0x3B, 0x02, 0x95, 0x87, 0x8A, 0x76,
+    0x02, 0xD2, 0x1A, 0x38, 0xC3, 0xC3, 0x3B, 0x6A, 0x94, 0x57, 0xD5, 0x24, 0xD9, 0x9C, 0x7E, 0xA3,
+    0x43, 0xEE, 0xAF, 0xCA, 0xE1, 0xA4, 0x80, 0x49, 0x76, 0xA8, 0xFC, 0x9E, 0x7C, 0x1F, 0x26, 0x09,
+    0x3A, 0xA6, 0x67, 0x17, 0xA9, 0x5E, 0xDE, 0x79, 0xCC, 0x91, 0xB9, 0x7D, 0x3E, 0xD6, 0x38, 0xCF,
+    0xA3, 0xB1, 0xAB, 0x12, 0x3D, 0x55, 0xC8, 0xA2, 0x4B, 0x64, 0xF5, 0x36, 0x99, 0x72, 0x1F, 0x51,
+    0x17, 0xD4, 0x2D, 0x55, 0x6A, 0x40, 0x9F, 0x5F, 0x53, 0x15, 0x58, 0x4A, 0x30, 0x86, 0x18, 0x4B,
+    0x29, 0x62, 0xEF, 0x8B, 0x55, 0xD5, 0xFB, 0xCA, 0x8B, 0x6A, 0xF7, 0x25, 0xF6, 0x7E, 0x0B, 0xBD,
+    0x77, 0xA8, 0x6A, 0x13, 0xA8, 0xC8, 0x3E, 0x79, 0x20, 0xA0, 0xEA, 0x2C, 0x55, 0xEA, 0x28, 0xAE,
+    0x0A, 0x9C, 0x3B, 0x5B, 0x98, 0x97, 0xBB, 0x47, 0xC4, 0x95, 0xDE, 0xA1, 0xB8, 0x72, 0xB4, 0x3C,
+    0x0D, 0x57, 0x12, 0xA3, 0x10, 0xA1, 0xC0, 0x76, 0xCC, 0x2D, 0x38, 0xD1, 0x14, 0x8B, 0x3C, 0x8B,
+    0xCE, 0x75, 0xC1, 0xF6, 0x58, 0xCA, 0x13, 0x36, 0xBB, 0x62, 0x34, 0x02, 0xAD, 0x9A, 0xF4, 0xB0,
+    0xBE, 0xD6, 0xFF, 0x11, 0xF8, 0xB8, 0xDF, 0x09, 0xDC, 0xA8, 0xE9, 0xC4, 0x35, 0x69, 0x9A, 0xD9,
+    0x12, 0xF4, 0x53, 0x17, 0x38, 0x4C, 0xDA, 0xFB, 0x08, 0x2F, 0xE4, 0xBC, 0x25, 0x55, 0x37, 0xAB,
+    0xAF, 0xA1, 0x82, 0x95, 0xB2, 0x2A, 0x85, 0x91, 0xC7, 0x50, 0x7D, 0xAB, 0x47, 0xF9, 0xCE, 0x60,
+    0x68, 0xAD, 0x14, 0xFD, 0x30, 0x72, 0xF6, 0xB9, 0xCB, 0xEE, 0x56, 0xE9, 0x36, 0xF9, 0xEF, 0xB2,
+    0xCF, 0xEC, 0xA9, 0xCD, 0x9E, 0x5A, 0xB4, 0xC7, 0x0E, 0x55, 0xEE, 0x14, 0xF5, 0xE0, 0x2C, 0x27,
+    0x38, 0x85, 0x15, 0x36, 0x23, 0x70, 0x94, 0x15, 0x62, 0x48, 0x5E, 0x68, 0x75, 0x21, 0x15, 0x5E,
+    0x11, 0x9C, 0x04, 0x68, 0xA8, 0x93, 0x57, 0x55, 0x6F, 0xD2, 0xBD, 0xB0, 0x61, 0x5D, 0x01, 0xB0,
+    0x56, 0x1F, 0x22, 0x73, 0x3E, 0x83, 0x1C, 0x42, 0x55, 0x55, 0xE5, 0x40, 0x92, 0x90, 0xA4, 0x20,
+    0x46, 0xCF, 0xD8, 0xA2, 0x3B, 0x02, 0x32, 0xFE, 0xA3, 0xEA, 0x10, 0x47, 0xEE, 0x23, 0x1D, 0x36,
+    0x46, 0x09, 0xF7, 0xFB, 0x1E, 0x8C, 0x5D, 0xE2, 0x64, 0xE3, 0x84, 0x07, 0x16, 0x51, 0xB7, 0x3A,
+    0x64, 0x27, 0x72, 0x80, 0x65, 0xDC, 0x6E, 0x74, 0x95, 0x68, 0x02, 0x1E, 0xFF, 0x56, 0x5A, 0xDF,
+    0x09, 0xCA, 0xD6, 0x15, 0x2B, 0x7A, 0xFA, 0x60, 0xE9, 0x83, 0xA9, 0x0F, 0x86, 0x3E, 0x48, 0x58,
+    0xD3, 0x98, 0x3F, 0x26, 0xE4, 0x0F, 0x88, 0xF5, 0x07, 0x44, 0x46, 0x48, 0x01, 0xE6, 0x73, 0x7F,
+    0xDC, 0xE3, 0x47, 0x9F, 0x04, 0x7C, 0x03, 0x12, 0xED, 0x25, 0xA1, 0xBE, 0xEA, 0x7F, 0xD0, 0x83,
+    0xEB, 0x07, 0xF5, 0x01, 0xFB, 0xAE, 0x46, 0x2E, 0x6A, 0xE0, 0xA2, 0xC6, 0x7D, 0x08, 0x85, 0x12,
+    0x01, 0xFD, 0xE5, 0x96, 0x3A, 0xE3, 0x86, 0xA4, 0x4E, 0x44, 0x6A, 0xC7, 0xDA, 0x7A, 0xED, 0xBE,
+    0xB7, 0xA3, 0xC1, 0x3D, 0x40, 0x73, 0x26, 0xE7, 0xF9, 0xAE, 0xC7, 0x69, 0x56, 0xAE, 0xE5, 0xC1,
+    0x52, 0x4F, 0x15, 0x85, 0xBA, 0x77, 0xD1, 0xDE, 0x1E, 0x64, 0xA8, 0x50, 0x9F, 0x46, 0x86, 0x77,
+    0x45, 0x03, 0x8A, 0x15, 0xA9, 0x7D, 0x2B, 0x57, 0x9A, 0x7A, 0x03, 0xBA, 0xF7, 0x9C, 0x10, 0xAC,
+    0xBA, 0xBB, 0x35, 0xD2, 0xF8, 0x35, 0xAE, 0xC6, 0x23, 0x3A, 0x25, 0xBA, 0x80, 0x7B, 0x34, 0xA0,
+    0xA8, 0xC8, 0x32, 0xD0, 0x8A, 0x57, 0x9A, 0xB2, 0x81, 0x8D, 0x97, 0x0E, 0xCE, 0x25, 0xF6, 0x5D,
+    0x62, 0x4A, 0x2F, 0x60, 0x9B, 0x55, 0x60, 0x13, 0x27, 0x82, 0xBA, 0x83, 0x9B, 0x46, 0x27, 0xD3,
+    0x89, 0xBA, 0x94, 0x5E, 0x8C, 0x4E, 0xDA, 0xC4, 0x9F, 0xA0, 0x77, 0x14, 0xD5, 0x67, 0xCA, 0xAB,
+    0xFA, 0xCE, 0xA6, 0xFA, 0x96, 0xAE, 0xC1, 0x83, 0xC0, 0x78, 0x31, 0x30, 0x29, 0x8C, 0x3E, 0x5B,
+    0x29, 0xFF, 0xC6, 0x01, 0x4D, 0xA5, 0xB5, 0x0A, 0x17, 0xB4, 0x0B, 0x59, 0x33, 0xD3, 0xC7, 0x89,
+    0x91, 0x53, 0x08, 0xB7, 0x94, 0x5F, 0x46, 0xC1, 0x74, 0x7E, 0xC9, 0x77, 0xEF, 0x81, 0xD4, 0x78,
+    0x6E, 0x93, 0x84, 0xDF, 0xB5, 0x78, 0xB3, 0x93, 0x00, 0xCA, 0xD7, 0xE0, 0x21, 0x06, 0xC6, 0x0D,
+    0xF1, 0xEE, 0xC7, 0x55, 0x23, 0x7D, 0x1D, 0xDC, 0xA6, 0x5E, 0xC6, 0x5A, 0xE6, 0x7F, 0x90, 0x35,
+    0x25, 0xCB, 0xD5, 0xAB, 0x6B, 0x66, 0xCB, 0x7F, 0xB0, 0xE1, 0xE5, 0xAD, 0xE1, 0xF0, 0xCF, 0x6B,
+    0x0B, 0x80, 0x41, 0xB9, 0xF7, 0x44, 0xBE, 0xAE, 0x5C, 0x64, 0x30, 0x59, 0x27, 0x96, 0xFF, 0xFA,
+    0xDF, 0xBA, 0x30, 0x38, 0x55, 0x4C, 0xB5, 0xC7, 0x12, 0xC0, 0xCA, 0x0D, 0x0B, 0xD0, 0x7F, 0x30,
+    0x87, 0xF3, 0xD3, 0xB8, 0xEE, 0x86, 0x80, 0x0B, 0x25, 0x46, 0x6B, 0x34, 0x18, 0x88, 0xC0, 0x3D,
+    0x6E, 0x50, 0x51, 0xAF, 0xB6, 0xFB, 0x45, 0xE2, 0xDE, 0xBF, 0xEB, 0x06, 0x4B, 0x6E, 0x50, 0x05,
+    0x0B, 0x82, 0x7A, 0x1F, 0xB4, 0xC1, 0x81, 0x8D, 0x46, 0xBD, 0x53, 0x64, 0x6E, 0x70, 0xD3, 0x0D,
+    0x66, 0xD4, 0x4B, 0xF6, 0xBF, 0x42, 0x0A, 0x07, 0x56, 0x67, 0x0C, 0xB7, 0x3A, 0xF4, 0x0C, 0xA8,
+    0x11, 0xD7, 0x71, 0xE5, 0x3A, 0x4A, 0x82, 0x12, 0xEB, 0x62, 0x44, 0x6E, 0x60, 0xA2, 0x58, 0xA1,
+    0x1B, 0xD8, 0x81, 0x1B, 0x78, 0x8D, 0x6B, 0xA8, 0xBA, 0xC8, 0xDB, 0x98, 0x45, 0xC0, 0xDD, 0x77,
+    0xA1, 0xC3, 0x66, 0xAF, 0xA3, 0x00, 0x5A, 0x9F, 0x93, 0x1B, 0xE2, 0xDC, 0x8F, 0xA7, 0x25, 0x9B,
+    0x53, 0xFA, 0x7C, 0x43, 0x2A, 0x45, 0xD1, 0xEB, 0xAF, 0xFE, 0x24, 0x57, 0xEA, 0xBB, 0x49, 0xE5,
+    0xF4, 0x55, 0xF7, 0xCE, 0x86, 0xA9, 0x38, 0xA4, 0x71, 0x19, 0xFF, 0x9D, 0x4F, 0x8A, 0xBF, 0xEC,
+    0x39, 0xC1, 0x92, 0x99, 0x58, 0xD1, 0x1C, 0x94, 0x78, 0x32, 0x07, 0x25, 0xBE, 0x38, 0x07, 0x9F,
+    0xBB, 0xBA, 0x85, 0xAF, 0xB4, 0xB0, 0xB0, 0x92, 0xCF, 0xF9, 0x58, 0xB6, 0x39, 0x37, 0xB4, 0xE2,
+    0x39, 0xDA, 0xE3, 0x39, 0x2B, 0xF5, 0x83, 0x2D, 0x23, 0x07, 0xD0, 0x8B, 0x5A, 0x5C, 0x93, 0x9F,
+    0xC6, 0x15, 0x23, 0x9D, 0xD3, 0x6B, 0x62, 0x26, 0xC6, 0x4F, 0x03, 0x63, 0x2D, 0x54, 0x6A, 0x76,
+    0xE3, 0x9C, 0xB4, 0xE7, 0x24, 0xAF, 0xC2, 0x9C, 0x28, 0xB7, 0xBB, 0x51, 0x9F, 0xBC, 0xD2, 0x49,
+    0x5B, 0xB9, 0x1B, 0xBA, 0x18, 0x11, 0xEA, 0x0A, 0x3C, 0x94, 0x4E, 0xE4, 0x7E, 0xF3, 0xE3, 0xC8,
+    0x7D, 0x0B, 0x9F, 0xC1, 0x6C, 0x6E, 0xAA, 0x6D, 0x3E, 0xAF, 0xE3, 0x6A, 0x5C, 0x64, 0xAD, 0xAE,
+    0x84, 0x5F, 0x45, 0xC5, 0xD3, 0x62, 0x6C, 0x83, 0x69, 0xE7, 0xCB, 0xB5, 0x78, 0xCE, 0xBA, 0x1A,
+    0xF5, 0x46, 0xD0, 0x49, 0x71, 0x5F, 0x58, 0xC1, 0x3A, 0x2C, 0xA2, 0x00, 0x20, 0xBD, 0x09, 0x05,
+    0xB2, 0x46, 0x65, 0x83, 0xE3, 0xB7, 0xF1, 0xF9, 0x9B, 0x29, 0xCE, 0x77, 0x51, 0x96, 0xB1, 0x4A,
+    0x7E, 0x50, 0x64, 0x4E, 0x5A, 0xAE, 0x53, 0xA2, 0xD6, 0x68, 0x1D, 0x4E, 0xC5, 0xF5, 0xB2, 0x24,
+    0x65, 0x89, 0x5D, 0x68, 0x36, 0x17, 0x4A, 0xCE, 0x15, 0x3B, 0x74, 0x05, 0x26, 0x3E, 0x04, 0xA0,
+    0xC9, 0x54, 0x5F, 0x03, 0x19, 0xBB, 0xD2, 0x49, 0xC4, 0xCF, 0x60, 0x14, 0x6B, 0xA1, 0x9B, 0x49,
+    0x27, 0x9C, 0xE8, 0xCA, 0x83, 0x70, 0xA2, 0x69, 0xFC, 0x3C, 0x9C, 0xA8, 0x5A, 0x7F, 0x15, 0x4E,
+    0xF8, 0x96, 0x1B, 0x4E, 0xB8, 0x3F, 0x04, 0x71, 0x7E, 0x06, 0x62, 0x77, 0x41, 0x2C, 0x8C, 0xCE,
+    0x33, 0x52, 0x2F, 0x2A, 0x92, 0xA4, 0xC8, 0xF7, 0x8D, 0x38, 0x1C, 0x96, 0xD5, 0xB5, 0xD0, 0x85,
+    0x4F, 0xB5, 0xE7, 0x1C, 0x8A, 0xC7, 0xF8, 0x53, 0xD6, 0xE9, 0xCA, 0xF7, 0x01, 0xBE, 0xEF, 0x13,
+    0xAA, 0x37, 0xA1, 0x22, 0x86, 0x1C, 0xCF, 0x38, 0x5F, 0xA0, 0x0B, 0xB9, 0xDF, 0xC3, 0x55, 0x1F,
+    0xD7, 0xE9, 0xF4, 0x02, 0xF8, 0x96, 0x4A, 0xA4, 0xA1, 0x18, 0x99, 0x9C, 0x8C, 0x56, 0x83, 0xA7,
+    0xFF, 0xA3, 0xCD, 0xA8, 0xC8, 0x8A, 0x7C, 0xF2, 0xF2, 0x0D, 0xF1, 0x3F, 0x2E, 0x22, 0xEB, 0x1F,
+    0xEC, 0x94, 0x52, 0x4C, 0xDB, 0x03, 0x4B, 0xCA, 0xD2, 0x2D, 0x4B, 0xAE, 0xCE, 0xA5, 0x70, 0xB4,
+    0x32, 0x33, 0xB5, 0xFE, 0xE9, 0x5A, 0x6C, 0x7D, 0x56, 0xD0, 0x02, 0xCB, 0x68, 0xA1, 0xC5, 0xAE,
+    0x11, 0xDA, 0xAC, 0x06, 0x18, 0x82, 0x4F, 0xCE, 0xCE, 0xDA, 0x52, 0xEF, 0x52, 0x75, 0x97, 0xAF,
+    0x01, 0x67, 0x9F, 0xF3, 0xEE, 0xDC, 0xB4, 0x55, 0xB7, 0x27, 0x21, 0xA7, 0x2D, 0x4C, 0xC8, 0xA2,
+    0x6F, 0x85, 0x0B, 0xAA, 0xC0, 0x01, 0xF2, 0x4B, 0x0F, 0xEC, 0xA0, 0x52, 0x63, 0x78, 0x2D, 0x25,
+    0x4B, 0xD5, 0x3B, 0x89, 0x9F, 0x7A, 0xA1, 0x0D, 0xF6, 0xB0, 0xA9, 0x2B, 0xD1, 0x89, 0x09, 0x30,
+    0x3F, 0xE4, 0x81, 0x0E, 0xE4, 0xC6, 0x0C, 0xDA, 0x5A, 0x40, 0x63, 0x89, 0x46, 0x99, 0x4A, 0x31,
+    0x83, 0xB1, 0x09, 0xD6, 0x08, 0x7E, 0xCE, 0x68, 0xCF, 0x0F, 0xEE, 0x83, 0xC2, 0x7A, 0xEA, 0xAF,
+    0x53, 0x2A, 0x6A, 0x6B, 0xA4, 0x9C, 0xBF, 0x2B, 0xD6, 0xA3, 0x07, 0xB1, 0xF7, 0xE6, 0xAD, 0xAC,
+    0x6A, 0x45, 0xCD, 0xA6, 0x15, 0x55, 0xDB, 0x56, 0xE4, 0xE7, 0x65, 0xE9, 0xA2, 0xE0, 0x73, 0x75,
+    0xC9, 0x8A, 0x2A, 0xBE, 0x15, 0xB5, 0xDD, 0x4F, 0xFF, 0x36, 0x35, 0xA8, 0x54, 0x19, 0xAF, 0x18,
+    0xD6, 0x43, 0x23, 0x80, 0x46, 0x3A, 0x1A, 0x9C, 0x4E, 0x5E, 0x69, 0xD4, 0x5B, 0x79, 0x27, 0xB6,
+    0x93, 0xAF, 0xA3, 0xBF, 0x50, 0x72, 0x39, 0xFB, 0x49, 0x34, 0x5C, 0x1A, 0x90, 0x7F, 0x87, 0x7B,
+    0xD7, 0xE1, 0xD7, 0x44, 0x74, 0xD4, 0x7D, 0x9C, 0xF6, 0x23, 0x00, 0x94, 0x0C, 0xE2, 0x50, 0x87,
+    0x38, 0x64, 0x58, 0xDE, 0xA3, 0x2D, 0xF0, 0x07, 0xD7, 0x56, 0x0A, 0x15, 0xAC, 0x53, 0xA1, 0xC6,
+    0x77, 0x4B, 0x8D, 0x7A, 0x11, 0xE5, 0xDC, 0xE4, 0x95, 0xC9, 0x2B, 0xAD, 0xBC, 0x95, 0x97, 0xA0,
+    0x3D, 0x1C, 0x14, 0xCC, 0x23, 0x40, 0x9E, 0x17, 0x1A, 0x8C, 0x60, 0x8E, 0x71, 0xC2, 0x06, 0x45,
+    0x41, 0x75, 0x8A, 0xE4, 0x7F, 0xA2, 0x50, 0x16, 0xBF, 0x2A, 0x62, 0x17, 0x7D, 0x83, 0xD2, 0x0D,
+    0x3C, 0xA9, 0x3C, 0x33, 0xF5, 0x3E, 0x98, 0x6F, 0xB4, 0x34, 0xFA, 0x49, 0x8E, 0xB3, 0xCE, 0x65,
+    0x8D, 0x69, 0xD4, 0x8A, 0x5A, 0x7A, 0x5D, 0x47, 0xE9, 0x75, 0x45, 0xEB, 0x93, 0x8D, 0x3A, 0xB8,
+    0x2E, 0x96, 0x45, 0x20, 0xC0, 0x85, 0xB2, 0x68, 0x7F, 0x02, 0xA3, 0xAE, 0xBE, 0x4D, 0xF0, 0x98,
+    0x2B, 0xE9, 0xD3, 0x25, 0x97, 0xE5, 0xB7, 0x53, 0x78, 0xB3, 0x21, 0xBE, 0x86, 0x25, 0x80, 0x4A,
+    0xC8, 0x08, 0x63, 0x42, 0x65, 0x1E, 0x46, 0x48, 0x01, 0x5B, 0xE0, 0x7E, 0xD0, 0xE5, 0xC7, 0x2A,
+    0x89, 0x3F, 0x24, 0x55, 0xAE, 0x46, 0x17, 0xF2, 0x56, 0x28, 0xE5, 0x80, 0x0A, 0x44, 0x01, 0xA1,
+    0xC1, 0x0B, 0xDF, 0xE4, 0xF7, 0xB4, 0x5D, 0xD2, 0xA6, 0xA9, 0x8B, 0x7B, 0xA9, 0xB1, 0xD7, 0xB4,
+    0xC6, 0x1E, 0x48, 0x4F, 0xA3, 0x6D, 0x10, 0xC5, 0x30, 0x52, 0x7E, 0x4E, 0x36, 0x20, 0x62, 0x55,
+    0x2B, 0x71, 0x8B, 0x40, 0x69, 0xD9, 0xF1, 0x0F, 0xA5, 0x93, 0xD6, 0xD6, 0x20, 0xFF, 0x99, 0x15,
+    0x43, 0x31, 0x42, 0x97, 0xBF, 0x99, 0x18, 0x20, 0xB1, 0x64, 0xEE, 0x4F, 0x21, 0xC6, 0x74, 0x9D,
+    0x73, 0xFD, 0x51, 0x13, 0x5E, 0xBD, 0x9C, 0x9A, 0x89, 0x17, 0x41, 0x05, 0x17, 0x99, 0x37, 0xF0,
+    0x18, 0x27, 0x1B, 0x01, 0xC7, 0x4B, 0xC5, 0xEB, 0xC9, 0x9C, 0x2E, 0x30, 0xB3, 0x8C, 0xF6, 0x9A,
+    0x6C, 0x7E, 0xA7, 0x49, 0x33, 0x03, 0x26, 0xE7, 0x39, 0x2A, 0xA3, 0x2D, 0x81, 0x89, 0x89, 0xF5,
+    0xA4, 0xD3, 0x9C, 0x80, 0xD9, 0x5E, 0x51, 0x35, 0x3D, 0x8B, 0x99, 0x1B, 0x37, 0x42, 0xF7, 0xFD,
+    0xD8, 0x7D, 0xB3, 0x04, 0x9D, 0xCF, 0xF4, 0xDD, 0x16, 0x65, 0xAC, 0xD4, 0x44, 0x2D, 0xAC, 0xFF,
+    0x50, 0x33, 0x7D, 0xD6, 0x17, 0xEB, 0x9F, 0xE6, 0xC1, 0xD4, 0x36, 0xA0, 0xAF, 0x15, 0x3F, 0xE9,
+    0xDF, 0x49, 0xAD, 0xB8, 0xD5, 0xDB, 0xA3, 0xD7, 0x22, 0xED, 0xB7, 0xD1, 0xC7, 0xDC, 0xD4, 0x30,
+    0x39, 0xA0, 0x53, 0x7A, 0x93, 0xB1, 0x34, 0xA5, 0x73, 0x8F, 0x8A, 0x1D, 0x1E, 0xD7, 0x8A, 0xBD,
+    0x2B, 0x74, 0x7D, 0x0F, 0xD4, 0x8A, 0x58, 0x48, 0x7F, 0x2D, 0xD8, 0xB0, 0xC3, 0xD4, 0x0A, 0x72,
+    0x15, 0x91, 0xF2, 0x33, 0xB1, 0xB1, 0x38, 0xAD, 0x08, 0xDD, 0xB9, 0x6E, 0xC5, 0xA9, 0x15, 0xE5,
+    0x4E, 0xE8, 0xAB, 0xE5, 0x42, 0xCF, 0x13, 0x4B, 0xF5, 0x66, 0x32, 0xF0, 0x0F, 0x1A, 0x57, 0x62,
+    0xA7, 0xAD, 0x62, 0xEE, 0xF5, 0x4A, 0x75, 0xEE, 0xF5, 0xA7, 0xDD, 0xF5, 0xD4, 0xBA, 0x76, 0xFF,
+    0x01, 0x89, 0x69, 0x7D, 0x68, 0x6B, 0x45, 0x19, 0x5B, 0x59, 0xA7, 0x7E, 0x56, 0xE4, 0xFA, 0x90,
+    0x24, 0x3E, 0x24, 0x2A, 0xF1, 0xBF, 0x93, 0x49, 0xEC, 0x4B, 0xDB, 0x88, 0x60, 0xD8, 0x4C, 0x12,
+    0x1B, 0x72, 0xDE, 0x2E, 0x82, 0xD6, 0x77, 0xB2, 0x2D, 0xB3, 0x28, 0xE3, 0xFC, 0xD4, 0x6F, 0x60,
+    0xE0, 0x0E, 0x0C, 0x7A, 0xE8, 0x29, 0x81, 0x92, 0x51, 0x52, 0x14, 0xFD, 0x15, 0xD8, 0xCF, 0xD5,
+    0x9C, 0x1F, 0x97, 0x48, 0xAA, 0x43, 0x52, 0x81, 0xE9, 0x6F, 0x74, 0xA1, 0x24, 0x8B, 0xA4, 0x46,
+    0x53, 0x74, 0x74, 0x46, 0x48, 0x0E, 0x2A, 0x60, 0x84, 0xB4, 0xD6, 0xB7, 0xB4, 0x34, 0x90, 0x9D,
+    0x95, 0x06, 0x0F, 0x06, 0x3C, 0x2D, 0xCF, 0x0B, 0x4C, 0xD4, 0x97, 0xF3, 0x72, 0xD3, 0x92, 0x08,
+    0xD7, 0x92, 0x17, 0x02, 0x48, 0x04, 0x5B, 0x16, 0x24, 0xC4, 0xDC, 0xDE, 0x1C, 0x05, 0x5B, 0xC7,
+    0x6E, 0x19, 0x9F, 0xC3, 0xF2, 0x44, 0xCA, 0xF2, 0xD0, 0xA9, 0xA4, 0x6F, 0xC8, 0x7A, 0x59, 0xBF,
+    0x31, 0x00, 0xFB, 0x5E, 0x04, 0xEF, 0x22, 0x6F, 0xA5, 0x46, 0x66, 0x76, 0xAD, 0x4C, 0x39, 0x44,
+    0x8C, 0xCD, 0xBE, 0x0E, 0xBA, 0x04, 0xBA, 0x24, 0x35, 0xD0, 0x2A, 0xE8, 0x25, 0x94, 0x1A, 0x54,
+    0x8F, 0x0F, 0x30, 0x36, 0x8B, 0xBA, 0xD6, 0x22, 0x4C, 0x77, 0xF8, 0x71, 0xB4, 0x2E, 0xCE, 0x47,
+    0x7F, 0x19, 0xC7, 0x62, 0xDF, 0x7E, 0xF3, 0x57, 0x11, 0x16, 0xD7, 0xFA, 0x17, 0x00, 0x83, 0x7F,
+    0x34, 0x7F, 0x0D, 0xD7, 0xB5, 0xCB, 0x00, 0x8B, 0xC1, 0x4A, 0x19, 0x3B, 0x48, 0x81, 0xB5, 0xEB,
+    0xF2, 0x4E, 0x07, 0xF3, 0x8E, 0xF9, 0x6D, 0x82, 0xF5, 0xA0, 0xC4, 0xE6, 0xAC, 0xA4, 0x2A, 0x73,
+    0x80, 0x6B, 0xB0, 0x88, 0xA9, 0xCB, 0x3D, 0x37, 0x2F, 0x5C, 0x97, 0xA6, 0x1F, 0xC5, 0x32, 0xF7,
+    0xBB, 0x1F, 0x45, 0x52, 0xF9, 0x1F, 0x9F, 0x06, 0xE2, 0x7F, 0x04, 0x06, 0x70, 0xDF, 0xEB, 0x72,
+    0x08, 0x29, 0x63, 0x04, 0x62, 0x74, 0x02, 0x51, 0x31, 0xA9, 0x65, 0xF2, 0x56, 0x21, 0x0B, 0x15,
+    0x47, 0xDE, 0xA9, 0x58, 0xFA, 0x5C, 0xAD, 0x1F, 0x28, 0xDB, 0x51, 0xC1, 0x38, 0x2A, 0x2A, 0x76,
+    0x57, 0x2D, 0x4B, 0x45, 0x9D, 0xDB, 0x1A, 0xCF, 0x20, 0x27, 0xE1, 0xA8, 0xA2, 0x1A, 0x2D, 0xFF,
+    0xE5, 0x61, 0x28, 0x5F, 0xB9, 0x17, 0xEC, 0x3D, 0x7F, 0xAF, 0x2E, 0xD6, 0x43, 0x42, 0x2D, 0x7A,
+    0xA2, 0x83, 0x7F, 0xAC, 0x68, 0xEC, 0x85, 0x2D, 0x6E, 0x1C, 0x96, 0xC1, 0x2E, 0x08, 0x60, 0x60,
+    0xE7, 0xB2, 0x79, 0x35, 0xA1, 0xCF, 0x66, 0xE2, 0xDF, 0x8A, 0x8D, 0x84, 0x7E, 0x9F, 0x04, 0x26,
+    0x9D, 0x15, 0x19, 0x50, 0x2A, 0x32, 0x53, 0x2D, 0x8D, 0xB9, 0x3D, 0xFF, 0x41, 0x7D, 0x70, 0x66,
+    0x70, 0x4F, 0x24, 0xCA, 0x5B, 0x24, 0x65, 0x38, 0x08, 0x35, 0x65, 0xB2, 0x6E, 0x67, 0xD2, 0xBF,
+    0x1A, 0xA3, 0x15, 0x5F, 0xD9, 0x19, 0x85, 0x60, 0x00, 0x54, 0xE7, 0x7B, 0xD6, 0x23, 0xB4, 0x03,
+    0x1E, 0x67, 0xBC, 0xEE, 0x5D, 0x2B, 0xAE, 0xCA, 0x59, 0x2B, 0xAE, 0xB0, 0xD7, 0xCB, 0x30, 0x1F,
+    0x0F, 0x3B, 0x80, 0x94, 0xEA, 0x23, 0x2E, 0x80, 0xF8, 0x24, 0x5E, 0x70, 0xCA, 0x49, 0x9C, 0x7B,
+    0x1B, 0xAD, 0x9E, 0x51, 0xFA, 0x69, 0x62, 0x24, 0xE5, 0x96, 0xF5, 0xC8, 0x36, 0xD0, 0x04, 0xE7,
+    0xF3, 0xD5, 0xEA, 0xEE, 0x36, 0x50, 0xC0, 0xF9, 0x46, 0xB7, 0x7E, 0xFD, 0xFF, 0x31, 0x2B, 0x9F,
+    0x7E, 0x9A, 0x88, 0x79, 0xFB, 0x13, 0xF8, 0x9C, 0xEF, 0xC7, 0x50, 0x8B, 0x6F, 0xC6, 0x5D, 0x71,
+    0xAC, 0xB8, 0x29, 0x13, 0x6C, 0xA9, 0x06, 0x15, 0x1E, 0x14, 0xB7, 0x3F, 0x81, 0x1E, 0x1D, 0x0B,
+    0x34, 0x73, 0x93, 0xC9, 0xBF, 0x81, 0x06, 0x16, 0x50, 0x12, 0xB4, 0x71, 0x8F, 0x5E, 0xE2, 0xA6,
+    0x58, 0xFF, 0xD1, 0x17, 0xDB, 0x75, 0x83, 0x09, 0xD7, 0x0D, 0xA7, 0x5C, 0x3B, 0xAA, 0xB8, 0x4E,
+    0x52, 0xB8, 0x5E, 0x8E, 0x81, 0xD2, 0x7C, 0x95, 0x1B, 0xCF, 0xEC, 0x59, 0x4F, 0x1D, 0xCC, 0xCF,
+    0xD5, 0xC1, 0xFA, 0x2B, 0x75, 0xB0, 0x19, 0x14, 0x83, 0xC7, 0x0B, 0xEB, 0x80, 0xC3, 0x19, 0xAC,
+    0x96, 0xA9, 0x43, 0x57, 0xE6, 0x76, 0xE3, 0xCF, 0x1E, 0xD2, 0x79, 0x96, 0x19, 0xF8, 0xB9, 0x38,
+    0xAC, 0x43, 0xDF, 0xE3, 0x90, 0x64, 0x4B, 0xF4, 0xA8, 0xA3, 0x8C, 0x0E, 0xB9, 0x15, 0x65, 0x74,
+    0xD4, 0xAC, 0x10, 0x22, 0x65, 0x67, 0x6E, 0x94, 0x79, 0x51, 0xAD, 0x68, 0xA5, 0x59, 0x27, 0xC5,
+    0xD4, 0x5E, 0x81, 0x2C, 0xF7, 0xD8, 0x36, 0x16, 0xB1, 0xA7, 0xF4, 0xFB, 0xDF, 0x90, 0xDA, 0x2E,
+    0xE9, 0x69, 0x88, 0xAA, 0x75, 0xEF, 0x0F, 0xAE, 0x82, 0xE7, 0x1F, 0x76, 0x1E, 0xC5, 0x38, 0x33,
+    0xF3, 0x25, 0x3A, 0x15, 0x2F, 0xA4, 0x19, 0x68, 0x92, 0x6E, 0x88, 0xF5, 0x8B, 0x28, 0x6D, 0x8A,
+    0xF3, 0x69, 0x9C, 0x6E, 0x49, 0xEB, 0xF3, 0x34, 0x2D, 0x42, 0xB5, 0x1F, 0xAD, 0x08, 0x74, 0x99,
+    0x4B, 0x83, 0x73, 0x89, 0xF6, 0x66, 0x91, 0x8C, 0x8D, 0xD9, 0xB7, 0x19, 0xDE, 0x37, 0x1F, 0x11,
+    0x60, 0x33, 0xB6, 0xD1, 0x5B, 0xDA, 0x82, 0xF4, 0x34, 0xD9, 0xBF, 0x26, 0x7C, 0xD9, 0xA4, 0x89,
+    0x2E, 0xC6, 0x4D, 0x06, 0x44, 0x9A, 0x36, 0xF0, 0x59, 0xD3, 0x4A, 0xFC, 0xA0, 0x6F, 0x66, 0x3D,
+    0xBB, 0x88, 0xB6, 0x8C, 0x46, 0xE3, 0x0A, 0x24, 0x03, 0xF6, 0x0D, 0x23, 0x84, 0x51, 0xCC, 0x19,
+    0xE9, 0xAC, 0xD8, 0xC4, 0xB1, 0x13, 0x94, 0x72, 0x88, 0x84, 0xF1, 0xF0, 0x11, 0xFA, 0xF7, 0xAB,
+    0x34, 0x17, 0xFB, 0x56, 0x0A, 0x8F, 0xFD, 0xBD, 0x14, 0x3A, 0xF3, 0x72, 0x8A, 0x95, 0x32, 0x33,
+    0x2F, 0xE8, 0xB9, 0x7D, 0x07, 0xAC, 0x65, 0xA8, 0xAD, 0x02, 0x4C, 0xB9, 0x3A, 0xA2, 0xAE, 0x36,
+    0xB7, 0xA8, 0x4C, 0x02, 0x31, 0x57, 0x4D, 0xB7, 0x1B, 0x5C, 0xD2, 0xD3, 0x0E, 0xF1, 0x57, 0x8B,
+    0x91, 0x26, 0x7A, 0x6D, 0x1E, 0x45, 0x9A, 0xA1, 0x29, 0x0D, 0x98, 0xFA, 0xD6, 0xFC, 0x7C, 0xA0,
+    0xBE, 0xEF, 0xBB, 0x6A, 0x61, 0x72, 0x5F, 0x2F, 0x50, 0xE6, 0x73, 0x85, 0x20, 0x18, 0x3E, 0x00,
+    0x0A, 0x26, 0x3E, 0xF5, 0x55, 0x25, 0x60, 0x4B, 0x28, 0x0A, 0xAE, 0x40, 0x0D, 0xAA, 0x1A, 0x4B,
+    0xF0, 0xCD, 0x02, 0x0E, 0x33, 0xC0, 0x71, 0xA3, 0x01, 0xFE, 0xAE, 0x15, 0x64, 0x61, 0x1F, 0x9A,
+    0x1F, 0x6C, 0x1E, 0x7E, 0x9D, 0x2B, 0x11, 0xCF, 0x52, 0x30, 0xD1, 0xB8, 0x75, 0xAF, 0xD1, 0x89,
+    0xB9, 0x06, 0xC5, 0x16, 0x39, 0xDC, 0xC3, 0x4C, 0xC5, 0x4D, 0x8F, 0x62, 0xDA, 0xF6, 0x78, 0x5F,
+    0xE6, 0x59, 0xA9, 0xF3, 0x49, 0xEA, 0x5F, 0xCE, 0x5A, 0x9F, 0xC7, 0x45, 0xB2, 0xA5, 0x63, 0x6B,
+    0x58, 0xD4, 0x7F, 0xC1, 0xE4, 0xB4, 0x18, 0x72, 0x4C, 0xD4, 0x7E, 0x54, 0x13, 0x43, 0x24, 0x80,
+    0xBA, 0xA8, 0xBD, 0x1B, 0x1D, 0xDB, 0x46, 0x9F, 0x4C, 0xB0, 0xBB, 0xA1, 0xF6, 0xA3, 0x5A, 0x65,
+    0x8C, 0x9B, 0xDE, 0x81, 0x2A, 0x81, 0xBA, 0xEF, 0xDF, 0x74, 0x75, 0x08, 0x2A, 0xD0, 0xD1, 0xF0,
+    0x25, 0xE9, 0x04, 0xFE, 0x5A, 0x11, 0x8E, 0xDF, 0xB0, 0x95, 0x35, 0x1D, 0x93, 0xBA, 0xF5, 0x7E,
+    0x66, 0xDC, 0x17, 0xA3, 0x2F, 0x2E, 0x50, 0xD4, 0x30, 0x12, 0x83, 0x49, 0x58, 0x0B, 0x4D, 0x46,
+    0xF2, 0xB2, 0xDD, 0xD4, 0x05, 0x3B, 0x75, 0x8A, 0xB0, 0x1A, 0x00, 0xE6, 0xC9, 0x9C, 0xD9, 0xF5,
+    0x3B, 0x3D, 0xA3, 0xFE, 0x4A, 0xE7, 0x56, 0x11, 0x15, 0x30, 0x44, 0xAD, 0x80, 0x81, 0xB9, 0xAA,
+    0x0A, 0x1E, 0x1E, 0x4C, 0xED, 0x01, 0x65, 0x1C, 0x28, 0xA9, 0x62, 0x66, 0x8D, 0xAC, 0x4A, 0x1B,
+    0xDC, 0xEA, 0x50, 0x61, 0x8E, 0x75, 0x56, 0x86, 0xD1, 0xD6, 0x3D, 0xB4, 0x45, 0x75, 0x62, 0xE9,
+    0x3D, 0x90, 0xC5, 0xC7, 0xCA, 0x64, 0xB0, 0x78, 0xAE, 0x15, 0x2D, 0xC2, 0xF4, 0x2D, 0x56, 0xB1,
+    0xEC, 0x90, 0xD0, 0x45, 0xA7, 0x2C, 0xF6, 0xC8, 0x7B, 0x48, 0xFD, 0xE2, 0x94, 0x95, 0x2E, 0xBE,
+    0x2B, 0xFD, 0xFF, 0x93, 0x6A, 0x15, 0xB5, 0x28, 0x07, 0x97, 0xE1, 0x4E, 0xCB, 0xCE, 0x79, 0x6E,
+    0x74, 0xA1, 0xB7, 0x6A, 0xA7, 0xA5, 0xB6, 0x77, 0xA7, 0x65, 0x73, 0x0B, 0x4B, 0xD1, 0x59, 0xDB,
+    0x6E, 0x01, 0xAF, 0x40, 0xC7, 0xEF, 0xDB, 0x69, 0xA9, 0xA9, 0xBD, 0xE6, 0xC3, 0x76, 0x5A, 0x06,
+    0xFE, 0xBB, 0xA7, 0x6C, 0x40, 0x05, 0x2B, 0x3B, 0xAD, 0xFC, 0xF7, 0xCE, 0x8E, 0x2F, 0x9B, 0xF3,
+    0x85, 0x0C, 0x7C, 0xF7, 0x39, 0x15, 0xAF, 0x02, 0x78, 0x7E, 0x6F, 0xD7, 0x7F, 0xE7, 0x6E, 0x72,
+    0xE4, 0xC7, 0x52, 0x8B, 0xC1, 0xBA, 0xEF, 0x32, 0xA6, 0x4E, 0xB9, 0x06, 0xCE, 0xB4, 0x12, 0x83,
+    0x3C, 0xCC, 0x90, 0xAC, 0xDA, 0x28, 0xED, 0xD2, 0x92, 0x36, 0x69, 0x52, 0x2B, 0x14, 0xB2, 0x1A,
+    0x0D, 0xB6, 0xA7, 0x52, 0x2F, 0xFE, 0x90, 0x26, 0xFC, 0xE6, 0x20, 0x7A, 0xAE, 0xF7, 0x1F, 0x62,
+    0x9A, 0x6F, 0xD8, 0xBF, 0xC4, 0xEA, 0x7A, 0xA1, 0xF3, 0xFB, 0x6E, 0x38, 0x81, 0x95, 0x9A, 0x42,
+    0xCD, 0x97, 0x50, 0xF1, 0x2C, 0xD0, 0x0D, 0xE0, 0x40, 0x06, 0x38, 0xD0, 0x86, 0x6F, 0xD4, 0x8C,
+    0xB5, 0x23, 0xEA, 0x87, 0x65, 0x48, 0x57, 0xC1, 0x1F, 0x32, 0xE1, 0x06, 0x93, 0x68, 0x5E, 0x27,
+    0x64, 0x39, 0x6D, 0x0F, 0xC2, 0x95, 0x27, 0xD6, 0x5F, 0x95, 0x3A, 0xF2, 0x43, 0x68, 0xB8, 0xDB,
+    0x31, 0xCC, 0x03, 0x35, 0xF7, 0xC5, 0x12, 0x86, 0xBC, 0xC0, 0x38, 0x14, 0xC3, 0xE9, 0xC0, 0xA7,
+    0x95, 0xCD, 0xAB, 0x93, 0x54, 0x6C, 0x3A, 0xCF, 0x43, 0xD9, 0x1F, 0x72, 0x65, 0x46, 0xF8, 0x84,
+    0x85, 0xCE, 0x8B, 0xA4, 0x95, 0x60, 0xD5, 0xBB, 0xBE, 0x8A, 0x33, 0x4A, 0x9B, 0x28, 0x53, 0x1D,
+    0xC3, 0x33, 0xEA, 0xC8, 0xB6, 0xDB, 0x2A, 0x55, 0x63, 0x96, 0xDC, 0xD1, 0x65, 0xFB, 0xFC, 0x1E,
+    0xFB, 0xC0, 0x7A, 0x64, 0x23, 0xD1, 0xF5, 0xCE, 0x01, 0x0A, 0x86, 0x98, 0x97, 0x1A, 0xC6, 0x73,
+    0x17, 0xB2, 0x4B, 0x11, 0xEE, 0xF4, 0x74, 0x76, 0x96, 0xEA, 0x44, 0x79, 0x7C, 0xB5, 0x3C, 0xCE,
+    0x95, 0xC7, 0x32, 0xED, 0xCC, 0x2E, 0xCD, 0xA4, 0x92, 0x95, 0xEF, 0x5F, 0x6E, 0x04, 0x8D, 0xC0,
+    0x79, 0xF4, 0x65, 0x11, 0x76, 0x42, 0xF0, 0xD8, 0x32, 0x40, 0x24, 0xD8, 0xAC, 0x2A, 0x53, 0xE4,
+    0x34, 0x7A, 0x69, 0x60, 0x30, 0xF8, 0x21, 0x3C, 0x38, 0x11, 0xB7, 0x50, 0x3D, 0x2B, 0x4A, 0xD4,
+    0x21, 0xE1, 0xDE, 0xBF, 0x6F, 0x7C, 0x19, 0x29, 0xDE, 0xFB, 0x75, 0xA8, 0xD8, 0xAF, 0x25, 0x8A,
+    0x03, 0x6B, 0xA2, 0x98, 0x70, 0x5A, 0xB7, 0x74, 0x69, 0x4F, 0x3F, 0x6E, 0x0E, 0x31, 0x30, 0x43,
+    0xB4, 0xDA, 0x33, 0xD3, 0xDC, 0x1E, 0x0C, 0xD2, 0x37, 0x7C, 0x6A, 0xF9, 0x47, 0xD0, 0xF2, 0x4E,
+    0xBC, 0xC2, 0xF0, 0x2C, 0x11, 0x9B, 0xA8, 0xED, 0x53, 0x8C, 0x7C, 0x89, 0x36, 0x78, 0x89, 0x71,
+    0x95, 0xF6, 0x90, 0x2C, 0x95, 0xC4, 0x8D, 0xD4, 0x2D, 0xEA, 0x66, 0x7C, 0x8D, 0x5B, 0xD3, 0x01,
+    0x1C, 0x4B, 0x56, 0xA5, 0x05, 0x59, 0xED, 0x46, 0x09, 0x33, 0x11, 0x4E, 0x53, 0x74, 0x57, 0xA0,
+    0x35, 0xBB, 0xE2, 0xFD, 0x07, 0x4F, 0x6D, 0xA3, 0x36, 0xA1, 0x4F, 0x51, 0x62, 0x98, 0x8A, 0xA4,
+    0x2C, 0x31, 0x3F, 0x57, 0xC0, 0x17, 0xD3, 0xF4, 0xCE, 0xFF, 0xA6, 0xA5, 0xA2, 0xC9, 0x4A, 0x61,
+    0x8E, 0x29, 0xE1, 0x54, 0x43, 0x51, 0xB8, 0xC9, 0x7C, 0x8F, 0x9A, 0x49, 0xE1, 0xDE, 0xC1, 0x9E,
+    0x87, 0x4E, 0x2B, 0x9A, 0xD8, 0xE5, 0x96, 0x4E, 0x4C, 0xAF, 0xEB, 0x97, 0xE9, 0xE6, 0x3C, 0x01,
+    0xE0, 0x4D, 0x86, 0x26, 0xEA, 0x17, 0xA8, 0xEB, 0x44, 0xB5, 0x42, 0x5F, 0x77, 0x49, 0xB1, 0xED,
+    0x92, 0x42, 0x30, 0xED, 0x11, 0xBA, 0x34, 0xA4, 0x56, 0xBA, 0xAC, 0xA8, 0xFA, 0x56, 0x02, 0xA3,
+    0x8A, 0x59, 0x72, 0xB9, 0x95, 0x10, 0x39, 0xDB, 0x9D, 0x9D, 0x0E, 0xBA, 0x93, 0xB4, 0x86, 0xE1,
+    0x78, 0x9F, 0xEC, 0xF8, 0xE7, 0x74, 0x87, 0x56, 0xB8, 0x71, 0x60, 0xEE, 0xEE, 0x7C, 0xC5, 0xBB,
+    0x19, 0x8E, 0x18, 0xC2, 0x87, 0xE6, 0x87, 0xF0, 0x35, 0xBC, 0x35, 0xA9, 0x38, 0x7F, 0xEC, 0x84,
+    0x73, 0xE3, 0xAF, 0xD8, 0x0C, 0xF6, 0x5B, 0x9C, 0x5D, 0x8B, 0xF9, 0x8A, 0xA3, 0x44, 0x9D, 0x6B,
+    0xD2, 0x8D, 0xAD, 0xC8, 0x75, 0x27, 0xF4, 0xBE, 0x95, 0x03, 0xF6, 0x14, 0xD7, 0xBA, 0xBB, 0x49,
+    0x8D, 0xE4, 0xB0, 0x7B, 0xF7, 0x94, 0x24, 0x04, 0xC1, 0x6F, 0x01, 0x9F, 0xCB, 0xD7, 0x56, 0x6F,
+    0x60, 0xE2, 0xFF, 0xD7, 0xFF, 0x14, 0x39, 0x75, 0xEA, 0x94, 0x6E, 0xFF, 0x78, 0x30, 0xFB, 0xFE,
+    0x6D, 0x65, 0x1A, 0x69, 0x1F, 0x4E, 0x48, 0x55, 0x06, 0x46, 0x73, 0x77, 0x4B, 0x79, 0xF3, 0xE0,
+    0x6D, 0x65, 0xB1, 0x7A, 0xD0, 0x52, 0x2D, 0xF6, 0x75, 0x5F, 0xE1, 0x28, 0x5C, 0x58, 0xE9, 0xEF,
+    0x41, 0xE3, 0x27, 0x9E, 0x01, 0x58, 0x03, 0xD8, 0x15, 0x8C, 0xA6, 0x04, 0x36, 0x95, 0x63, 0x80,
+    0xCA, 0xDC, 0x7B, 0xA1, 0x89, 0x55, 0x75, 0x1E, 0x7B, 0x09, 0x87, 0x0B, 0xAF, 0x7C, 0x05, 0xD2,
+    0xC6, 0x2D, 0x02, 0x9F, 0xA9, 0x9B, 0x99, 0xA8, 0xE4, 0x47, 0xD7, 0x09, 0x17, 0x71, 0xA9, 0x85,
+    0x5A, 0x1C, 0x9C, 0x32, 0x31, 0x30, 0xEB, 0x73, 0xD8, 0xAD, 0x1F, 0x44, 0x4A, 0x67, 0xBC, 0x3C,
+    0xE4, 0x86, 0xF8, 0x77, 0x7E, 0x9A, 0x2C, 0xAF, 0x86, 0xAF, 0xE9, 0x4F, 0xF0, 0x30, 0xEE, 0xC5,
+    0xDF, 0x93, 0xFA, 0xB9, 0xE6, 0xE2, 0xEC, 0xCB, 0xE7, 0x2A, 0xAF, 0x5E, 0x7A, 0x07, 0xF8, 0xF7,
+    0xF7, 0x8A, 0x95, 0xEB, 0xE7, 0xB9, 0xCE, 0xE3, 0x65, 0xEE, 0x5C, 0x2D, 0xD3, 0xC7, 0xC5, 0x52,
+    0xDA, 0xCF, 0x9E, 0x1A, 0xD9, 0x88, 0x92, 0x16, 0xEE, 0xB2, 0x30, 0xC4, 0x87, 0xCC, 0xD8, 0x5B,
+    0x83, 0x64, 0x40, 0xAF, 0xBE, 0x62, 0x05, 0xF2, 0x94, 0x3F, 0x23, 0xD0, 0xD4, 0x53, 0x95, 0x7B,
+    0xD9, 0x37, 0x88, 0xE5, 0xE5, 0x1B, 0x7F, 0xF4, 0x8E, 0x72, 0x9B, 0x2F, 0xBC, 0xFC, 0xB4, 0xEF,
+    0x6B, 0x29, 0xAD, 0xEB, 0x40, 0xAC, 0xDD, 0x13, 0xE3, 0x0E, 0xA6, 0x63, 0xE2, 0x2A, 0x6A, 0xBC,
+    0x80, 0x99, 0x32, 0x47, 0xEF, 0xF4, 0x4A, 0xB5, 0x58, 0x2D, 0x65, 0x67, 0x61, 0x6A, 0x6F, 0x4D,
+    0x66, 0xD9, 0x59, 0xBB, 0x3C, 0x3A, 0xC1, 0xA8, 0xB6, 0x7D, 0x43, 0xA7, 0xF6, 0x81, 0x91, 0xA6,
+    0x55, 0x56, 0x1F, 0x85, 0x99, 0xD3, 0xCE, 0xB3, 0x35, 0xDA, 0x8C, 0xB0, 0x3C, 0xF7, 0xE4, 0xEE,
+    0x06, 0x25, 0x2D, 0x14, 0xBE, 0x01, 0x6C, 0x50, 0x9D, 0xEA, 0x24, 0x86, 0x0A, 0x33, 0x8E, 0xAD,
+    0xCB, 0x51, 0xFE, 0x38, 0xF1, 0xB4, 0x92, 0xD3, 0xA5, 0xFC, 0xA3, 0x0F, 0x80, 0x6C, 0x63, 0x01,
+    0xB9, 0x43, 0x99, 0x0E, 0x9D, 0x49, 0x59, 0x6E, 0xC5, 0xEE, 0xB7, 0x16, 0x97, 0xF6, 0xD4, 0x35,
+    0x45, 0x1D, 0x36, 0xC7, 0x6F, 0xF8, 0xD7, 0x7E, 0x23, 0xD9, 0x43, 0x5D, 0x29, 0x83, 0xCA, 0x1A,
+    0x5F, 0xAD, 0x0F, 0xB6, 0xEB, 0x75, 0xBE, 0x64, 0x70, 0x9C, 0x9B, 0x41, 0xE5, 0x60, 0x67, 0xB8,
+    0xD8, 0x65, 0x2B, 0xAC, 0x30, 0xA0, 0x92, 0x1C, 0x94, 0xAF, 0x6C, 0xD7, 0x01, 0xE2, 0x53, 0x19,
+    0x3D, 0xA7, 0x4A, 0xF1, 0x0F, 0xF4, 0x77, 0x43, 0x78, 0xB5, 0x31, 0xC1, 0xBF, 0xB9, 0xE7, 0x9F,
+    0xA1, 0xAF, 0x6B, 0x61, 0xAD, 0xF4, 0xA7, 0x5F, 0xD4, 0x27, 0xAF, 0xA1, 0x2D, 0xFB, 0xD0, 0xB6,
+    0xFE, 0x1E, 0x5E, 0xF9, 0xBF, 0xC7, 0xF9, 0x5A, 0x60, 0x16, 0x7D, 0x3A, 0x20, 0xE8, 0xBF, 0xB1,
+    0x67, 0x0C, 0xE4, 0x43, 0x86, 0xA1, 0x1B, 0x97, 0x3F, 0x94, 0xD6, 0xCF, 0x0B, 0x38, 0x45, 0x6E,
+    0x64, 0x27, 0x68, 0x21, 0x36, 0x13, 0x1B, 0x5A, 0xD9, 0x06, 0x6E, 0xD5, 0x85, 0xEF, 0xBF, 0x89,
+    0x56, 0xFE, 0x1E, 0xFD, 0xFF, 0x8B, 0xD8, 0xFE, 0xC7, 0x56, 0x68, 0x7F, 0x8C, 0xFB, 0x23, 0x2B,
+    0xC0, 0xF5, 0xC8, 0x2E, 0x43, 0x97, 0x6A, 0xE3, 0xA1, 0x3B, 0xD8, 0xCC, 0x37, 0xD5, 0x96, 0x04,
+    0x1D, 0x1B, 0x7B, 0xBB, 0x11, 0x3C, 0x36, 0x4F, 0x47, 0x2C, 0x83, 0x3E, 0xAA, 0x3F, 0xAC, 0xC8,
+    0xCC, 0x64, 0x23, 0x9B, 0x2F, 0x32, 0x9B, 0xEE, 0xE8, 0xA1, 0x2F, 0x74, 0xA4, 0x55, 0x30, 0x33,
+    0x27, 0xB6, 0xB7, 0xAF, 0x62, 0x0A, 0x64, 0x50, 0xEA, 0xA3, 0x55, 0x33, 0x64, 0xC7, 0x65, 0x7C,
+    0x5A, 0xD3, 0x93, 0x8D, 0x2B, 0xF3, 0x60, 0xEB, 0x78, 0xCE, 0x8A, 0xA7, 0xAC, 0xF8, 0x14, 0xEA,
+    0xFF, 0xCA, 0x3D, 0xD6, 0xFF, 0xEC, 0x2D, 0x9A, 0x8F, 0xEE, 0x8A, 0x89, 0x05, 0x35, 0x53, 0x87,
+    0xE1, 0x93, 0x8C, 0xDE, 0x23, 0xCA, 0x12, 0xBD, 0x4F, 0x16, 0xB4, 0x58, 0x45, 0x8B, 0xB4, 0x0B,
+    0x15, 0x15, 0x1A, 0x4B, 0x78, 0xDD, 0xC8, 0x8C, 0x1D, 0x40, 0xFF, 0x12, 0xF9, 0xA3, 0x37, 0x82,
+    0xEE, 0xA0, 0xD1, 0x39, 0x14, 0xA2, 0xD2, 0x53, 0x25, 0xB3, 0x70, 0xBB, 0x2A, 0xC7, 0xFB, 0x9A,
+    0x68, 0xF3, 0x43, 0xA6, 0x01, 0xB3, 0x60, 0x29, 0x5B, 0xC5, 0x60, 0x89, 0xB8, 0x5C, 0x4E, 0x68,
+    0x72, 0x57, 0x32, 0x83, 0xA0, 0xB4, 0x12, 0xEE, 0xA1, 0xF7, 0x60, 0x91, 0x5A, 0xB1, 0x93, 0x59,
+    0x85, 0xBC, 0xB1, 0x80, 0xEF, 0x01, 0x01, 0x5D, 0x62, 0xD5, 0xC2, 0x60, 0x03, 0x45, 0xCE, 0x81,
+    0xD3, 0x4F, 0x7E, 0x7D, 0x33, 0xA6, 0xB0, 0x19, 0xB7, 0x7F, 0xA1, 0x12, 0x95, 0x1F, 0xDD, 0xE7,
+    0xB2, 0xB8, 0xF7, 0x1F, 0x29, 0x64, 0xA6, 0xCC, 0xBF, 0x54, 0x55, 0x08, 0x86, 0x3B, 0x79, 0x3E,
+    0x0D, 0xAF, 0x45, 0xC0, 0x6E, 0xA5, 0x64, 0x29, 0xB1, 0xC9, 0xBD, 0xF0, 0x57, 0x22, 0x3B, 0x35,
+    0xBA, 0x00, 0x76, 0xB5, 0x3E, 0x63, 0xCC, 0xC3, 0xBC, 0xE7, 0xC7, 0x12, 0x41, 0xF6, 0x1E, 0x82,
+    0x7F, 0xCB, 0x5D, 0x87, 0xA0, 0x15, 0x75, 0x92, 0x5A, 0xBC, 0x08, 0xCB, 0xFC, 0xCF, 0xF1, 0xD9,
+    0x59, 0xD7, 0x8C, 0x02, 0x99, 0x72, 0x69, 0x2E, 0x1C, 0x15, 0x05, 0xB0, 0x1F, 0xD0, 0xB6, 0xD6,
+    0xD6, 0x98, 0xD0, 0xD8, 0x75, 0x2D, 0x7A, 0x87, 0x2E, 0x5D, 0x27, 0x18, 0xF1, 0x2E, 0xD1, 0x90,
+    0x2C, 0x73, 0x8B, 0x2B, 0xAC, 0x85, 0x7D, 0x29, 0x52, 0x47, 0x1B, 0x26, 0x4D, 0x17, 0x07, 0x0C,
+    0xB6, 0x8F, 0x6A, 0xD5, 0xFE, 0x1C, 0x1E, 0xF4, 0x05, 0x94, 0x9B, 0x78, 0x3F, 0xC8, 0xE8, 0xF4,
+    0x08, 0x7E, 0x2E, 0x95, 0x7A, 0x95, 0xB6, 0x82, 0x76, 0xA2, 0xA3, 0xF0, 0x07, 0x83, 0xF0, 0x35,
+    0x06, 0xE1, 0xA3, 0x9B, 0x25, 0x37, 0x45, 0xA7, 0xB7, 0xE4, 0x74, 0x47, 0x69, 0x03, 0x33, 0x5D,
+    0x37, 0x53, 0x28, 0x0E, 0xE8, 0x2A, 0x06, 0xE1, 0x13, 0xD5, 0x31, 0x3A, 0xCF, 0x2A, 0x88, 0x45,
+    0x25, 0x84, 0x46, 0xED, 0x1C, 0xC6, 0x18, 0x22, 0xFE, 0x3E, 0x59, 0x8B, 0xBC, 0xF6, 0x0A, 0xC9,
+    0x45, 0x92, 0x37, 0xA4, 0x8C, 0x60, 0x3C, 0x22, 0xCC, 0x7B, 0xA8, 0xE2, 0x4C, 0xB5, 0x32, 0x3E,
+    0xA7, 0xC2, 0x70, 0xD4, 0x1E, 0x2A, 0x4E, 0xC1, 0x98, 0x51, 0x4E, 0xAE, 0xDF, 0x62, 0xA5, 0xFE,
+    0xD0, 0x4F, 0x1A, 0xC9, 0x8A, 0x5A, 0x18, 0x12, 0x99, 0xBC, 0x62, 0xAC, 0xCC, 0xF7, 0x9C, 0xDC,
+    0x8A, 0x5F, 0x9F, 0xB5, 0xE2, 0x19, 0x46, 0x84, 0xC4, 0xFA, 0x04, 0xAB, 0x0D, 0x89, 0xB1, 0xEE,
+    0xD3, 0x3F, 0x23, 0x8F, 0x2E, 0x95, 0xFC, 0x08, 0x3F, 0x2A, 0x71, 0x92, 0x4E, 0xCF, 0xEC, 0x95,
+    0xBC, 0xFD, 0x6A, 0x19, 0xFE, 0x1D, 0x14, 0x36, 0xE9, 0x85, 0x76, 0x0E, 0x28, 0x8C, 0x6E, 0xFC,
+    0x22, 0x62, 0xC4, 0x4A, 0xCC, 0x7F, 0xFE, 0x36, 0x7A, 0xFA, 0xE5, 0xCF, 0x48, 0xFE, 0x1F, 0x09,
+    0xC1, 0xC9, 0x23, 0x45, 0x0A, 0x7E, 0xFC, 0x1C, 0xB7, 0x7C, 0xF9, 0x31, 0x86, 0xF0, 0xE5, 0xED,
+    0x04, 0x37, 0xFF, 0x40, 0xA9, 0x63, 0x15, 0x20, 0xDA, 0xE4, 0x38, 0x98, 0x1E, 0x02, 0x7B, 0x32,
+    0x79, 0x45, 0xBE, 0x3B, 0xDF, 0xB3, 0x7A, 0x60, 0xC6, 0xFF, 0x6C, 0x7D, 0x32, 0xF5, 0x92, 0xF5,
+    0x19, 0x7A, 0xFB, 0xD9, 0x75, 0xB1, 0x1E, 0xA0, 0xC7, 0xF7, 0xD1, 0xCB, 0xCF, 0xAA, 0x28, 0x3E,
+    0x7A, 0x4F, 0xEF, 0xC9, 0x89, 0x9D, 0xC4, 0xCA, 0xE0, 0x36, 0x75, 0xF6, 0xCD, 0x6C, 0xAD, 0x70,
+    0xA8, 0xF6, 0x8F, 0x61, 0x66, 0xA3, 0xBD, 0x3B, 0x48, 0x61, 0xA9, 0xF0, 0x8D, 0x15, 0xB4, 0xFE,
+    0xAC, 0xF3, 0xD9, 0x6D, 0x15, 0x99, 0x95, 0xFE, 0xD9, 0xFC, 0x8A, 0x9B, 0x2F, 0xF8, 0x32, 0x3B,
+    0x03, 0xCE, 0x5C, 0x67, 0x18, 0x01, 0x35, 0xFA, 0x14, 0x28, 0x9F, 0xC2, 0xE1, 0xD3, 0xA7, 0xF1,
+    0x29, 0x1A, 0xFE, 0x9A, 0x3A, 0x47, 0xAF, 0x87, 0x8F, 0x34, 0x95, 0xD9, 0x9D, 0x55, 0x12, 0x66,
+    0x4A, 0x11, 0x8E, 0xD4, 0x50, 0xB5, 0x55, 0x64, 0x46, 0x6F, 0xB2, 0x51, 0x7F, 0x59, 0x96, 0x3B,
+    0x49, 0x2B, 0x42, 0xCD, 0x7F, 0x17, 0xD5, 0xA7, 0xAD, 0x30, 0x90, 0x69, 0x3A, 0xD7, 0xD3, 0xD4,
+    0x0D, 0x3E, 0xDD, 0x46, 0x9F, 0xBE, 0xCD, 0x34, 0x05, 0x78, 0x9A, 0x95, 0x4E, 0xD3, 0x4B, 0xAB,
+    0x12, 0xB2, 0xB6, 0x82, 0x16, 0xE3, 0x2D, 0x9E, 0x8A, 0xB8, 0xE5, 0x58, 0xD7, 0x79, 0x6A, 0x43,
+    0x37, 0x3C, 0x9C, 0x30, 0x68, 0x68, 0x6E, 0x37, 0xAE, 0x85, 0x4F, 0xBE, 0x0F, 0xB3, 0xE8, 0x47,
+    0xAC, 0x54, 0x19, 0x9A, 0xEE, 0xD0, 0x7F, 0x54, 0xA8, 0xEC, 0x95, 0x21, 0x79, 0x69, 0xF2, 0xCA,
+    0x18, 0x03, 0x6B, 0x4E, 0x1F, 0x9A, 0x90, 0x2A, 0x20, 0x96, 0x3D, 0xE4, 0xDE, 0x77, 0x40, 0x1E,
+    0xAE, 0x3E, 0x7E, 0x81, 0xC4, 0x61, 0x8E, 0x72, 0xAB, 0xA7, 0xD3, 0x53, 0x88, 0xD0, 0x14, 0x6C,
+    0xD2, 0xC4, 0x0C, 0x77, 0x9F, 0x0B, 0x51, 0xD1, 0xC4, 0x98, 0x83, 0xFB, 0xB1, 0x1E, 0xDD, 0x28,
+    0x0D, 0x14, 0x95, 0x3D, 0x54, 0x3D, 0xAD, 0xA3, 0x06, 0x29, 0x07, 0x5C, 0x7D, 0x8C, 0xAA, 0xB1,
+    0x8A, 0x1E, 0x2C, 0xC7, 0x73, 0x85, 0xE3, 0xE9, 0x72, 0x3C, 0x97, 0xD8, 0xCF, 0x29, 0x92, 0x97,
+    0x9E, 0x69, 0x3C, 0x35, 0x9D, 0xF3, 0x08, 0x8B, 0xDC, 0x52, 0xC1, 0x78, 0xA5, 0xC4, 0x8E, 0x78,
+    0xD8, 0x52, 0xE1, 0xCE, 0xDA, 0x5A, 0xA6, 0x4F, 0x6E, 0xE9, 0x83, 0x1F, 0xA8, 0x83, 0x7A, 0xDA,
+    0xA6, 0x26, 0xB6, 0x3E, 0x58, 0xB1, 0x3E, 0x24, 0x18, 0x41, 0x2B, 0xB0, 0x92, 0x5A, 0x01, 0x5E,
+    0xD0, 0xBB, 0x7D, 0x52, 0x1E, 0x68, 0x8D, 0xA0, 0x05, 0xD4, 0xEC, 0xFA, 0x1A, 0x24, 0x7B, 0xEF,
+    0x6D, 0x0E, 0xB4, 0xED, 0x70, 0x73, 0xB8, 0xD1, 0x00, 0x9C, 0x63, 0xAA, 0xB3, 0xAE, 0xF3, 0x60,
+    0xBA, 0x4D, 0x4D, 0x69, 0x2A, 0xA3, 0x68, 0xA6, 0xBE, 0xA2, 0x34, 0x7E, 0x0C, 0x7E, 0x2B, 0x0A,
+    0x91, 0xB6, 0x33, 0x2B, 0x69, 0xF5, 0xFC, 0x42, 0xEF, 0xD4, 0xEB, 0x3E, 0x28, 0x7A, 0x9D, 0x1D,
+    0x31, 0x52, 0xE5, 0x9E, 0xEF, 0xFC, 0x89, 0xF2, 0xE2, 0xB2, 0x41, 0x00, 0x2F, 0x67, 0x00, 0x6F,
+    0xAA, 0x34, 0x50, 0x9E, 0x8C, 0x33, 0xDE, 0xD0, 0x82, 0x8D, 0x96, 0xAC, 0x49, 0xA3, 0x5D, 0x95,
+    0x36, 0x86, 0x46, 0xE2, 0x8F, 0x90, 0x25, 0x92, 0xAA, 0x05, 0x55, 0x50, 0x33, 0x53, 0x06, 0xF0,
+    0x72, 0x06, 0xF0, 0x36, 0x19, 0xC0, 0xAB, 0x29, 0x79, 0xBF, 0xC7, 0x06, 0x07, 0xFB, 0x1B, 0xDF,
+    0x0F, 0xC4, 0x7E, 0x14, 0x29, 0x9B, 0x51, 0x91, 0xEF, 0xC2, 0xFD, 0x7C, 0x20, 0x4D, 0xF7, 0xAD,
+    0xA8, 0xED, 0xD9, 0x28, 0x96, 0x2A, 0x4D, 0xBC, 0x9F, 0xC3, 0xB9, 0x69, 0xE7, 0xE7, 0x81, 0xFB,
+    0x3E, 0xF3, 0xD6, 0xFA, 0x40, 0xFD, 0xA7, 0x57, 0x8E, 0xC1, 0xE5, 0x8C, 0xAD, 0x5E, 0x99, 0xC9,
+    0x4C, 0xDE, 0x56, 0x50, 0x3A, 0xD5, 0x85, 0xFB, 0x71, 0x74, 0xB2, 0x9E, 0xEE, 0x72, 0xBE, 0xE6,
+    0xDE, 0x4B, 0x19, 0xD3, 0x99, 0x53, 0x11, 0x0D, 0x47, 0x19, 0xB8, 0x82, 0x66, 0xAD, 0x55, 0x14,
+    0xF9, 0xD2, 0xB5, 0x3B, 0x1B, 0x0B, 0x3A, 0x33, 0xFA, 0x52, 0xDD, 0x89, 0xCE, 0xC9, 0x33, 0x3E,
+    0x8D, 0x62, 0xA8, 0xE7, 0xCE, 0x96, 0xCB, 0x3D, 0xCC, 0x89, 0xB2, 0x9C, 0x1E, 0x30, 0x47, 0x80,
+    0x36, 0xA2, 0x05, 0xCF, 0x44, 0x91, 0xA8, 0xEE, 0x49, 0xA8, 0x18, 0xE9, 0xB0, 0x52, 0x0B, 0x75,
+    0x94, 0xA6, 0x7C, 0x28, 0x6E, 0x37, 0x47, 0x45, 0xC7, 0xFC, 0x6A, 0x7D, 0xBB, 0x08, 0xDD, 0x14,
+    0x8C, 0x0D, 0x55, 0x36, 0x4B, 0xBB, 0xBE, 0x40, 0x05, 0x83, 0x89, 0x58, 0x1A, 0x6A, 0x52, 0xF7,
+    0x2D, 0xE2, 0x95, 0x9F, 0x0D, 0xB6, 0x90, 0x8C, 0xF4, 0x49, 0x44, 0xDD, 0x52, 0x03, 0x36, 0x28,
+    0x37, 0x4A, 0x33, 0x2F, 0xB4, 0x42, 0xD8, 0x18, 0xD1, 0x1B, 0xA5, 0x67, 0x20, 0x1F, 0x53, 0xB8,
+    0x13, 0xAD, 0x67, 0xB0, 0xE9, 0x6D, 0xB4, 0xD6, 0x4C, 0xCA, 0x68, 0x62, 0xB9, 0x99, 0xB9, 0xBF,
+    0xE0, 0x3C, 0xB4, 0xE9, 0x73, 0xF7, 0x54, 0xC5, 0xD0, 0x54, 0x14, 0xE6, 0xB8, 0x7B, 0x6A, 0x71,
+    0x9D, 0x0E, 0xE8, 0xE9, 0xFE, 0x94, 0xF0, 0xEC, 0xC9, 0x29, 0xE1, 0x7C, 0xE7, 0xAA, 0x94, 0x70,
+    0x32, 0xEB, 0xCC, 0x9E, 0x94, 0x70, 0x7B, 0x4F, 0x4A, 0x78, 0x34, 0xC8, 0x23, 0x56, 0x4E, 0xAB,
+    0x82, 0x8E, 0x1A, 0x38, 0x46, 0x47, 0x4F, 0x7C, 0x5A, 0xD8, 0x93, 0xF8, 0x14, 0x17, 0xA9, 0x62,
+    0x8E, 0x8D, 0x7D, 0x8C, 0xA1, 0x98, 0x03, 0x7C, 0xF6, 0xC3, 0x22, 0x5E, 0x9A, 0xBF, 0x7A, 0xAB,
+    0x1F, 0x2C, 0x50, 0x2E, 0x85, 0x5C, 0xD7, 0x96, 0xBA, 0x67, 0x50, 0x28, 0x54, 0x94, 0xFE, 0x85,
+    0x68, 0xAD, 0xD1, 0xD8, 0x52, 0x8F, 0x5D, 0x69, 0xE5, 0xA7, 0x63, 0xB1, 0xC6, 0xE3, 0x09, 0x45,
+    0xD7, 0x07, 0x8A, 0xF1, 0xCA, 0x64, 0xA3, 0x55, 0xF4, 0xFD, 0xFE, 0x42, 0x65, 0xC2, 0x4A, 0x16,
+    0x2A, 0xA7, 0xAD, 0xB8, 0x5E, 0x19, 0x83, 0x46, 0xAB, 0xC8, 0x53, 0xC9, 0x26, 0x54, 0x91, 0x6A,
+    0x4A, 0xCA, 0x4C, 0x37, 0xED, 0xEB, 0x3B, 0x43, 0xA2, 0x83, 0x11, 0x65, 0x06, 0xBC, 0x3C, 0x29,
+    0x03, 0x3E, 0x1E, 0x64, 0xC0, 0x9B, 0x3B, 0x4C, 0x1A, 0xE9, 0xF4, 0xA1, 0x60, 0xC6, 0xEA, 0x87,
+    0x66, 0xC0, 0xB7, 0x74, 0x06, 0xFC, 0x60, 0x1B, 0x56, 0x23, 0xCB, 0x05, 0x1D, 0x27, 0x19, 0x90,
+    0xB3, 0x0D, 0x9D, 0x30, 0xB6, 0xA3, 0x53, 0xA1, 0x77, 0x8B, 0xFA, 0xBF, 0xD7, 0x8A, 0xCC, 0xE2,
+    0xB3, 0x48, 0xCE, 0xED, 0x7A, 0x34, 0xA5, 0xE3, 0x79, 0x28, 0xB2, 0x7C, 0x42, 0x26, 0xFF, 0x59,
+    0x92, 0x75, 0x66, 0xF2, 0x93, 0xA4, 0xEB, 0xCC, 0xE4, 0xFF, 0xDF, 0xC3, 0x4C, 0xFE, 0x8C, 0x7D,
+    0x5E, 0xDF, 0x4B, 0xCE, 0x8E, 0x66, 0xF2, 0x1F, 0x98, 0xDA, 0x76, 0xFB, 0xAD, 0xD0, 0x46, 0xB1,
+    0x7E, 0x7D, 0x4D, 0xA7, 0xB6, 0xD9, 0x6F, 0x01, 0xC0, 0x95, 0xA5, 0x4C, 0x6D, 0xE3, 0xBE, 0xAF,
+    0xDA, 0xF5, 0xD5, 0xD3, 0xF0, 0x18, 0x19, 0x23, 0xB8, 0x2D, 0xE8, 0x57, 0x30, 0x75, 0x1D, 0x40,
+    0x96, 0x17, 0xFC, 0xC3, 0x09, 0xB1, 0x6E, 0x48, 0x1B, 0x9B, 0x0D, 0xF2, 0x0A, 0x47, 0x67, 0xC7,
+    0xBE, 0xF5, 0xA1, 0xD8, 0x74, 0xEF, 0x21, 0xD5, 0x76, 0xC2, 0x59, 0xB4, 0x9E, 0x58, 0x00, 0xFF,
+    0x92, 0x4E, 0xD7, 0x1A, 0x84, 0x6D, 0x5B, 0xDC, 0x93, 0xDE, 0x9E, 0x0F, 0x55, 0xC2, 0x3B, 0x0C,
+    0x87, 0xB2, 0xEC, 0x46, 0x36, 0x8B, 0x89, 0xC8, 0x37, 0x96, 0x48, 0xC0, 0xBE, 0x5D, 0x02, 0x8B,
+    0xEE, 0x78, 0x7F, 0x75, 0xF5, 0x27, 0xFA, 0xE9, 0xD9, 0xA5, 0xE1, 0x9A, 0xD7, 0xCA, 0x5C, 0x26,
+    0x65, 0x70, 0xD6, 0xC5, 0xEA, 0x5F, 0x55, 0xDB, 0x58, 0x83, 0x3D, 0x1F, 0x3E, 0x7B, 0xFE, 0x20,
+    0xA2, 0xFF, 0xFB, 0x5A, 0x53, 0xB2, 0x9B, 0x1B, 0xA8, 0x2F, 0x97, 0x9C, 0x4F, 0xD5, 0x8C, 0xED,
+    0xC0, 0xD5, 0xCD, 0x4A, 0x75, 0xDD, 0x56, 0xAB, 0xFB, 0x86, 0x78, 0x3F, 0x66, 0x7E, 0x44, 0x38,
+    0x1A, 0x41, 0x7C, 0xFE, 0xFE, 0x2D, 0x0F, 0xFB, 0xE7, 0x1F, 0xD4, 0x3F, 0xA5, 0x98, 0x14, 0x48,
+    0x18, 0x51, 0x32, 0x83, 0xA6, 0x9F, 0xBB, 0xE3, 0xDD, 0x32, 0x41, 0x72, 0x66, 0xA4, 0x28, 0xF7,
+    0xC7, 0xCE, 0xF5, 0x76, 0xF3, 0x91, 0x5E, 0x5C, 0x72, 0x72, 0xD1, 0x29, 0x1D, 0x09, 0xAD, 0x68,
+    0x44, 0xE3, 0x5F, 0x55, 0xEA, 0x6F, 0xBC, 0x3F, 0x12, 0xBE, 0xFC, 0xED, 0x3E, 0x0F, 0x39, 0xCE,
+    0x07, 0x70, 0x5D, 0x85, 0x28, 0x98, 0xCE, 0x6F, 0x6C, 0x95, 0xEB, 0x7E, 0x3C, 0x79, 0xE6, 0x47,
+    0x77, 0x7E, 0xB9, 0x67, 0xDF, 0xEF, 0xA8, 0x8D, 0xF9, 0x5C, 0x3B, 0x88, 0x8A, 0x4F, 0xF8, 0x8B,
+    0x06, 0x7A, 0xD3, 0x5F, 0x11, 0xCC, 0xAA, 0x4B, 0xA7, 0x71, 0xF7, 0x49, 0x13, 0x8F, 0xA1, 0x81,
+    0x2A, 0xAD, 0x02, 0x3A, 0xB4, 0x3C, 0xCE, 0xC8, 0xED, 0x80, 0xFB, 0x94, 0x07, 0x9C, 0xBB, 0x99,
+    0x15, 0x57, 0x16, 0xAD, 0x78, 0xE1, 0xAC, 0x15, 0xC3, 0x79, 0xFF, 0x14, 0x82, 0x5E, 0xDC, 0xE5,
+    0x6E, 0x3D, 0x23, 0x30, 0xB1, 0x86, 0x9F, 0x98, 0xA6, 0x58, 0x72, 0x68, 0xA9, 0x1C, 0x5A, 0x6A,
+    0x00, 0x40, 0x32, 0x79, 0x03, 0xB6, 0xF7, 0x26, 0x00, 0xE9, 0x12, 0x8C, 0x92, 0xB7, 0x23, 0x27,
+    0xF6, 0x10, 0xE3, 0xF0, 0x61, 0x68, 0x05, 0xF0, 0x14, 0x1B, 0x2B, 0x57, 0x46, 0x45, 0xAA, 0x0D,
+    0x79, 0xCE, 0x1C, 0xF6, 0xBC, 0x54, 0xD8, 0xEB, 0xBA, 0x72, 0xA3, 0xCC, 0x61, 0x34, 0xE4, 0x04,
+    0x3C, 0xBE, 0xC7, 0x17, 0xE5, 0x82, 0x5E, 0x14, 0x80, 0xD0, 0xE5, 0x6F, 0x61, 0x7C, 0xE7, 0x81,
+    0xA7, 0x5F, 0xCC, 0xE3, 0x03, 0x81, 0x26, 0xC9, 0x86, 0x56, 0x09, 0xE4, 0x2C, 0xB1, 0xD1, 0x3A,
+    0x25, 0x6B, 0xF3, 0x3C, 0x75, 0x77, 0x4F, 0xE4, 0xC4, 0xBC, 0x59, 0x25, 0xB1, 0x67, 0x86, 0x71,
+    0xF6, 0xDD, 0x40, 0xB7, 0xEA, 0x4C, 0xFD, 0xB9, 0xB3, 0xFC, 0x35, 0x7E, 0x99, 0x29, 0xD7, 0x29,
+    0x2D, 0x31, 0x45, 0x70, 0x02, 0xB6, 0xBD, 0xA3, 0x9E, 0x54, 0x4A, 0xB5, 0x35, 0xD6, 0xBC, 0xB5,
+    0x8B, 0x28, 0x4E, 0x97, 0xDA, 0xE8, 0xF9, 0x6D, 0xFB, 0x46, 0x39, 0x84, 0xF5, 0x12, 0x04, 0x69,
+    0x20, 0x54, 0xCB, 0xB9, 0xC1, 0xC4, 0x07, 0xFF, 0x3B, 0x2B, 0xDC, 0xB6, 0x2A, 0xC4, 0x7C, 0x20,
+    0xF2, 0x39, 0x33, 0xA8, 0xF8, 0xFA, 0x79, 0x68, 0x5D, 0x13, 0xF3, 0xE3, 0xC8, 0x86, 0x90, 0xDF,
+    0x8E, 0x1D, 0xD2, 0xE4, 0x0C, 0xE8, 0xAD, 0x74, 0x0A, 0x34, 0xCA, 0x66, 0x49, 0xDB, 0x33, 0xA4,
+    0xCD, 0x05, 0xD2, 0x4A, 0x42, 0xEA, 0xC7, 0xA4, 0x98, 0x43, 0x61, 0x1A, 0x92, 0x1F, 0xD6, 0x72,
+    0x47, 0x74, 0xBC, 0x41, 0x2F, 0x4C, 0xA9, 0xB3, 0xF5, 0xAE, 0x4B, 0x3A, 0x82, 0xD4, 0x82, 0x63,
+    0x79, 0xA6, 0x63, 0x77, 0xAB, 0x63, 0x61, 0xD8, 0x4C, 0xB2, 0x9B, 0xB0, 0xF0, 0x9C, 0xA6, 0xE2,
+    0x1C, 0x37, 0xAA, 0x9A, 0x14, 0xD1, 0xEA, 0x35, 0xEA, 0xFC, 0x9D, 0xA1, 0x89, 0x38, 0xE0, 0xD7,
+    0x11, 0x9C, 0xE1, 0xAF, 0x23, 0x4C, 0x0D, 0x7F, 0x1D, 0x61, 0xE6, 0xA0, 0x5F, 0x47, 0x90, 0x27,
+    0xFC, 0x3A, 0xC2, 0x98, 0xAC, 0x60, 0x4C, 0xEE, 0x5F, 0x27, 0xA6, 0xB2, 0xF6, 0xB0, 0x98, 0xEE,
+    0xFD, 0xD8, 0xDF, 0xF7, 0xA0, 0xD6, 0x8F, 0xF8, 0xA0, 0x56, 0x5B, 0xB2, 0x0D, 0x50, 0x33, 0xAB,
+    0x0E, 0x1F, 0xD4, 0x3A, 0x35, 0x4E, 0xC6, 0xA2, 0xB8, 0x4F, 0xBB, 0x7B, 0xB7, 0x03, 0x4F, 0xAA,
+    0xBB, 0x3A, 0x27, 0xDC, 0x79, 0x3F, 0x1E, 0x1A, 0xF8, 0x67, 0xE8, 0xAE, 0x68, 0xE4, 0x3E, 0xBD,
+    0xFD, 0x76, 0xAA, 0x52, 0x00, 0x41, 0xFF, 0x34, 0xE5, 0xD2, 0xFD, 0x2A, 0x95, 0xB3, 0x62, 0xDC,
+    0x52, 0x50, 0xE2, 0x3D, 0xE5, 0xE9, 0x28, 0x8F, 0x6B, 0x82, 0x09, 0x3F, 0x32, 0x65, 0x6C, 0x37,
+    0xD0, 0x5D, 0x05, 0xFB, 0x3A, 0x4A, 0x4F, 0x27, 0xBC, 0x6A, 0x32, 0x61, 0xE8, 0x25, 0x2B, 0x00,
+    0xBD, 0xE8, 0x70, 0x09, 0x67, 0xFD, 0xC0, 0xDA, 0x6E, 0xE4, 0x45, 0x4A, 0x78, 0x61, 0xDC, 0x50,
+    0x5D, 0xFB, 0xFC, 0x41, 0xE4, 0x1B, 0x7D, 0x33, 0xE5, 0x46, 0x79, 0x46, 0x93, 0xA2, 0x1E, 0x7C,
+    0xC9, 0x8D, 0x35, 0xD8, 0x6D, 0xFF, 0x47, 0x80, 0x20, 0x4D, 0x9D, 0xF1, 0x9D, 0x53, 0x76, 0xC0,
+    0x52, 0x6D, 0xC8, 0xC7, 0x85, 0xEA, 0x35, 0xE0, 0x10, 0xAF, 0x3B, 0x44, 0x50, 0xF5, 0x53, 0xC2,
+    0x6D, 0x6E, 0xD9, 0x61, 0xE2, 0xF7, 0xDD, 0xC1, 0x03, 0xCD, 0xB1, 0xBD, 0xFD, 0x76, 0xC2, 0x44,
+    0xC2, 0xB2, 0xEC, 0xDD, 0xC4, 0x40, 0xC7, 0xCD, 0xED, 0x2B, 0xFB, 0xB7, 0x4B, 0xCE, 0x32, 0x0D,
+    0x91, 0xC5, 0xDE, 0x6E, 0x64, 0xA8, 0x23, 0x83, 0xE5, 0x87, 0xDD, 0x77, 0xFF, 0x3A, 0x35, 0xB5,
+    0xCD, 0xFF, 0x9E, 0x38, 0x0F, 0x62, 0x15, 0x49, 0xC8, 0x9B, 0xFC, 0x09, 0x9E, 0x66, 0xA7, 0xE8,
+    0x6E, 0x36, 0xAE, 0x0C, 0x23, 0x09, 0xBE, 0x9C, 0x73, 0xEF, 0x64, 0xE6, 0xF0, 0x39, 0x45, 0x13,
+    0x00, 0xD8, 0xFD, 0xA2, 0x00, 0x46, 0x21, 0xE2, 0xB0, 0xCB, 0x24, 0x3C, 0x63, 0x80, 0xAB, 0xF2,
+    0x0E, 0xC6, 0xB9, 0xB5, 0xBA, 0xDA, 0x25, 0xBA, 0x43, 0x0D, 0xF9, 0x12, 0xAE, 0x55, 0x44, 0xC5,
+    0x7F, 0xF8, 0x70, 0x44, 0x64, 0x27, 0x2D, 0xE5, 0x82, 0xAA, 0xB5, 0xFC, 0x09, 0xCD, 0xF6, 0xAC,
+    0x9D, 0x9C, 0xD5, 0x53, 0xA5, 0xE2, 0x17, 0xAA, 0xFD, 0x76, 0x9B, 0x7D, 0xC9, 0x2B, 0x92, 0xFA,
+    0xDF, 0x4E, 0x6C, 0x1D, 0x95, 0xA9, 0xBF, 0x86, 0x49, 0xC1, 0x1D, 0x69, 0x73, 0x77, 0x93, 0xF7,
+    0x18, 0x3B, 0x33, 0x6E, 0x06, 0xEE, 0xB7, 0xA3, 0xE1, 0xB3, 0x07, 0xCF, 0xD6, 0x37, 0x79, 0x59,
+    0xEF, 0x37, 0x7B, 0x7A, 0xD3, 0xC4, 0x73, 0xC2, 0xFD, 0xBB, 0xBC, 0xBF, 0x65, 0xC0, 0x67, 0x5E,
+    0x66, 0xFD, 0xB7, 0xF9, 0xE8, 0xEB, 0xFB, 0xA3, 0x8F, 0x9C, 0x1E, 0x0F, 0xE0, 0x33, 0x83, 0x15,
+    0xB1, 0x3F, 0x82, 0x4E, 0xFB, 0x68, 0x18, 0x23, 0x3C, 0xD6, 0xDF, 0xDB, 0x30, 0x1F, 0xD3, 0x01,
+    0x47, 0x7F, 0x8E, 0xD1, 0x87, 0x11, 0xF7, 0x31, 0x82, 0x39, 0xC0, 0xFB, 0xD7, 0xA8, 0xB0, 0x39,
+    0xD3, 0x13, 0x65, 0x7C, 0x9A, 0xDC, 0xC2, 0x36, 0xC6, 0xBB, 0xA3, 0x11, 0xB8, 0x83, 0x77, 0x89,
+    0xCE, 0x29, 0xFF, 0xBE, 0x56, 0xE4, 0xD5, 0xD5, 0xF4, 0x0D, 0x33, 0xBE, 0x60, 0x07, 0xAC, 0x66,
+    0x8E, 0x95, 0x98, 0x3B, 0x62, 0x10, 0xC5, 0x66, 0x23, 0x21, 0x38, 0xBC, 0x9A, 0x80, 0x7F, 0x99,
+    0x64, 0x9B, 0xE7, 0x63, 0x3E, 0x57, 0xA3, 0x10, 0xEA, 0xD7, 0x56, 0x83, 0x13, 0xFF, 0x09, 0x21,
+    0xF5, 0xB0, 0xC9, 0x4F, 0x5E, 0x6C, 0xAF, 0xFD, 0x65, 0x26, 0x5B, 0xF8, 0x54, 0xD8, 0x7B, 0x79,
+    0xF9, 0x04, 0xBB, 0xFD, 0xCE, 0x6B, 0xC2, 0x08, 0xEE, 0xA8, 0x7C, 0x3F, 0x77, 0xF7, 0x5F, 0x63,
+    0x52, 0x45, 0x93, 0x4C, 0xD5, 0x9C, 0xDE, 0x23, 0x86, 0x87, 0x65, 0x7F, 0x56, 0x8F, 0xF8, 0x3B,
+    0x1B, 0x4F, 0xCE, 0xFE, 0x34, 0x83, 0x50, 0x09, 0xD9, 0xA8, 0x1C, 0xA8, 0x8C, 0xD0, 0x47, 0x8F,
+    0x67, 0x84, 0x8E, 0x96, 0xC3, 0x32, 0x42, 0x8F, 0x9A, 0xB1, 0xAA, 0x3A, 0xC9, 0x1F, 0xF2, 0x91,
+    0xCD, 0x46, 0x63, 0xFE, 0x78, 0x32, 0x56, 0xB7, 0x56, 0xD7, 0x50, 0x3A, 0x4F, 0xEE, 0xDF, 0x6B,
+    0x2F, 0x0F, 0xE6, 0x79, 0xCE, 0x3B, 0xD2, 0x3C, 0x1F, 0x4F, 0x9F, 0x39, 0xCF, 0xFB, 0xF5, 0xCD,
+    0x8B, 0x8C, 0xE3, 0x60, 0xFD, 0x75, 0x7C, 0x8F, 0xF7, 0x8F, 0x1B, 0xC1, 0xE8, 0x73, 0x6D, 0xCF,
+    0xF4, 0x54, 0x1F, 0x33, 0x18, 0x44, 0x7E, 0x67, 0xF5, 0x37, 0xF3, 0x3B, 0x60, 0xFB, 0x94, 0xC7,
+    0xE0, 0x41, 0xA2, 0x10, 0x3E, 0x11, 0x6E, 0x77, 0x55, 0xD4, 0x59, 0x3F, 0x48, 0x34, 0xBB, 0xFB,
+    0x20, 0x51, 0x65, 0xDF, 0x83, 0x44, 0x4E, 0x19, 0xBB, 0x7C, 0x5D, 0x2B, 0xFB, 0xF1, 0x54, 0x27,
+    0x55, 0xC9, 0xB9, 0x43, 0xB8, 0xE5, 0xA4, 0xC7, 0x34, 0xD0, 0x2C, 0xD9, 0xDC, 0xA8, 0x66, 0x39,
+    0xDE, 0xB1, 0x69, 0x9E, 0xA1, 0x81, 0x75, 0xDF, 0xC2, 0xAD, 0xAF, 0xF3, 0x9E, 0x99, 0x8B, 0xBF,
+    0xA1, 0x01, 0x0E, 0xF2, 0xA5, 0x89, 0xC9, 0xDF, 0x85, 0xFC, 0x5C, 0x5F, 0x3C, 0x99, 0x41, 0x8E,
+    0x13, 0xE5, 0x00, 0x25, 0x81, 0xD8, 0xD1, 0x68, 0xB0, 0xEF, 0xC4, 0x7E, 0x95, 0x45, 0xDE, 0x81,
+    0xD9, 0x05, 0xD6, 0x1A, 0x5D, 0xBB, 0xE7, 0x7D, 0x74, 0xB9, 0xCC, 0x03, 0x3A, 0x1C, 0x42, 0x1F,
+    0x35, 0xE9, 0x89, 0xBB, 0x15, 0x7C, 0xC8, 0x82, 0xCB, 0xC6, 0x3D, 0xE7, 0x32, 0xFA, 0xF8, 0x78,
+    0x46, 0xD2, 0x01, 0x39, 0x50, 0xA9, 0x92, 0x67, 0x5F, 0xCD, 0xAF, 0xA3, 0x62, 0xFA, 0x3A, 0xAC,
+    0x6F, 0x84, 0x75, 0x95, 0x20, 0xAC, 0x3C, 0xA8, 0x38, 0xDD, 0x0B, 0x1E, 0x7F, 0x93, 0x3F, 0x91,
+    0xA2, 0xA1, 0xAC, 0x02, 0xB2, 0x7B, 0x17, 0xF9, 0x78, 0x9E, 0x7D, 0x3E, 0x9E, 0xF4, 0xAF, 0x48,
+    0x4F, 0xBC, 0x59, 0x2E, 0x02, 0xD3, 0x1D, 0x96, 0xE5, 0xE8, 0x29, 0x61, 0x81, 0x58, 0xEA, 0x65,
+    0xAB, 0x3D, 0xD1, 0xF6, 0xC9, 0xED, 0x87, 0xA9, 0xE7, 0x5B, 0x86, 0x44, 0xE5, 0xA2, 0xAA, 0xED,
+    0x9D, 0xCD, 0xE7, 0xD9, 0x0A, 0x53, 0xBF, 0x01, 0x30, 0x12, 0x9E, 0x5E, 0xD4, 0x9D, 0x72, 0xE2,
+    0xA3, 0x76, 0xDF, 0xE5, 0x63, 0x7F, 0xC6, 0xDB, 0x98, 0xDD, 0xA3, 0x76, 0xFF, 0xB0, 0x5E, 0xF2,
+    0x17, 0x3D, 0xC7, 0xAE, 0xDD, 0x39, 0xB4, 0x97, 0xFF, 0x0A, 0xC5, 0x5A, 0x3D, 0x6C, 0x14, 0x47,
+    0x18, 0x7D, 0xBB, 0x6B, 0xDF, 0x62, 0x56, 0x64, 0x4F, 0x8A, 0x2D, 0x45, 0x04, 0xFB, 0x28, 0x5C,
+    0x80, 0x84, 0xBD, 0x14, 0x8E, 0xE4, 0x48, 0x3E, 0xDF, 0x8A, 0x14, 0x29, 0x28, 0x70, 0x61, 0x27,
+    0x5D, 0x94, 0x12, 0x88, 0xA2, 0xB8, 0x40, 0x11, 0x52, 0x0E, 0xBC, 0x21, 0x05, 0xAD, 0x8B, 0x48,
+    0x29, 0xD2, 0x50, 0xD0, 0x44, 0x8A, 0x08, 0x45, 0x14, 0xB9, 0x38, 0x73, 0xAB, 0xA4, 0x48, 0x15,
+    0x69, 0x15, 0x14, 0x51, 0xA4, 0x39, 0x04, 0xA9, 0x52, 0xB0, 0x48, 0x6B, 0xE9, 0x08, 0xF6, 0x6D,
+    0xDE, 0x37, 0xB3, 0x7B, 0x36, 0xC6, 0x84, 0xD8, 0x77, 0x7B, 0x5E, 0xDF, 0x7C, 0x3E, 0xEF, 0xCF,
+    0xCC, 0x7B, 0xDF, 0x37, 0xF3, 0xE6, 0x9B, 0x59, 0x03, 0x31, 0x00, 0x33, 0xA1, 0xB1, 0xDA, 0x34,
+    0x76, 0x9D, 0xC6, 0xA9, 0xD2, 0x1C, 0xF3, 0x68, 0x4E, 0x54, 0x68, 0x66, 0xDD, 0x00, 0x98, 0x71,
+    0x42, 0xE0, 0xAE, 0x1D, 0x01, 0xB1, 0xD5, 0x82, 0x91, 0xA6, 0x31, 0xCC, 0x10, 0x09, 0xAC, 0x00,
+    0x9B, 0xB0, 0x81, 0x3A, 0x5C, 0xA0, 0x8A, 0x8A, 0x8F, 0x15, 0xA4, 0xB1, 0x9D, 0xB6, 0xA0, 0x8F,
+    0x05, 0xA9, 0x3E, 0xCE, 0x0D, 0x56, 0x01, 0xE3, 0x3B, 0xB8, 0x7F, 0x47, 0x9E, 0x11, 0x4F, 0xF1,
+    0x71, 0xF5, 0x31, 0x7E, 0x48, 0xBC, 0xAF, 0x93, 0x3A, 0x92, 0x06, 0x92, 0x35, 0x5A, 0x33, 0x99,
+    0xFF, 0x68, 0xAD, 0xD2, 0x5E, 0x91, 0x07, 0x46, 0x81, 0x86, 0xFA, 0x4C, 0xF2, 0xC9, 0xDB, 0x02,
+    0x6E, 0x9D, 0x66, 0xE8, 0x0D, 0xB9, 0xF6, 0xA9, 0x98, 0xC7, 0x62, 0x22, 0xE4, 0x47, 0x61, 0x74,
+    0x16, 0x61, 0xA5, 0xBE, 0xC1, 0xEB, 0x8E, 0xCF, 0x0B, 0x38, 0x0B, 0x94, 0xF7, 0x49, 0x45, 0x91,
+    0x91, 0xAA, 0x61, 0xC4, 0x74, 0x8F, 0xB5, 0xE9, 0x03, 0xEE, 0x04, 0xCF, 0x4C, 0x9A, 0x7E, 0xE1,
+    0xF0, 0x61, 0xF0, 0x59, 0x9E, 0xBC, 0x38, 0x07, 0xA4, 0x65, 0x58, 0xBF, 0x06, 0x38, 0x2A, 0xD1,
+    0x80, 0x0A, 0x88, 0xD0, 0x00, 0x79, 0x40, 0x11, 0xC9, 0x0A, 0xB9, 0x80, 0x64, 0x58, 0x59, 0xC2,
+    0x00, 0x24, 0x58, 0x93, 0xDF, 0x04, 0x47, 0x46, 0xC8, 0x29, 0x0D, 0x8B, 0xB1, 0x42, 0xB1, 0x0F,
+    0x05, 0xFB, 0x9B, 0x9B, 0x18, 0x1C, 0xA9, 0xB2, 0xF6, 0x26, 0x26, 0x8E, 0x93, 0x44, 0x8D, 0x0F,
+    0x3F, 0x6D, 0xC1, 0x0C, 0x26, 0x75, 0xA3, 0x97, 0x7D, 0x58, 0xFF, 0x24, 0x70, 0xC2, 0x3A, 0x23,
+    0x26, 0xAD, 0x65, 0xE5, 0x93, 0x2D, 0x38, 0x7F, 0xB1, 0x16, 0x7E, 0xF7, 0x58, 0xA6, 0xD5, 0xEF,
+    0x75, 0xB8, 0xDF, 0xDC, 0x81, 0xDD, 0xA9, 0x84, 0xFA, 0x61, 0x53, 0x3C, 0x33, 0x7C, 0x45, 0xBE,
+    0xCE, 0xB0, 0xEE, 0xA7, 0x91, 0x84, 0x0B, 0x83, 0x0C, 0xD7, 0x02, 0x8C, 0xEF, 0x59, 0x0F, 0x2E,
+    0x5E, 0x61, 0xB8, 0x18, 0x2D, 0x1D, 0xAC, 0xFD, 0x76, 0x38, 0x1E, 0x95, 0xDF, 0x09, 0xE0, 0xDD,
+    0x94, 0x90, 0x4F, 0x4A, 0xF7, 0x33, 0x04, 0xF2, 0x80, 0xB9, 0xC0, 0x7A, 0x7C, 0xCB, 0x69, 0x46,
+    0x47, 0x4A, 0x3E, 0x2E, 0xB2, 0xF7, 0xA1, 0x17, 0x3A, 0x0A, 0xA1, 0xDD, 0xC5, 0x7F, 0xCA, 0x1A,
+    0x04, 0xFE, 0xBD, 0x85, 0x4C, 0x8E, 0x75, 0xD6, 0x40, 0x3E, 0xE1, 0x41, 0xF8, 0xEC, 0x94, 0x36,
+    0x7D, 0x08, 0x5C, 0x48, 0xAF, 0x1B, 0xBD, 0x41, 0x33, 0xE5, 0x08, 0xCB, 0x8E, 0x34, 0x79, 0x1B,
+    0x83, 0x60, 0xE9, 0x04, 0x98, 0x80, 0x31, 0xE9, 0xDB, 0x46, 0x68, 0xA5, 0x01, 0xEE, 0xE1, 0x60,
+    0x21, 0x72, 0xFD, 0x5C, 0x13, 0x46, 0xCF, 0x1D, 0x02, 0x0D, 0x4B, 0xEE, 0xEE, 0x03, 0x0D, 0x4B,
+    0xE0, 0xE1, 0xD4, 0x21, 0x86, 0x64, 0x0B, 0x38, 0x0F, 0x09, 0xC9, 0x4C, 0xCF, 0x21, 0x11, 0x11,
+    0xA8, 0x2A, 0x11, 0x10, 0xC5, 0x1E, 0x35, 0x0F, 0x23, 0x2E, 0xC9, 0xB2, 0x16, 0x01, 0x03, 0x3D,
+    0xD0, 0x51, 0xD0, 0xCF, 0x6C, 0x43, 0x4F, 0x70, 0x68, 0xE3, 0x7F, 0x18, 0x41, 0x0F, 0x3C, 0xB6,
+    0x07, 0x7F, 0x2D, 0x4D, 0x23, 0x7B, 0xE3, 0xC3, 0x16, 0x2B, 0xCE, 0xCB, 0x82, 0x34, 0xD2, 0x2D,
+    0x69, 0x0A, 0x73, 0x63, 0x11, 0x2F, 0x9C, 0x8B, 0x51, 0x66, 0x99, 0x91, 0x62, 0x6F, 0x2C, 0x25,
+    0xAC, 0x43, 0x7B, 0xC2, 0x60, 0x8C, 0x85, 0xA1, 0x14, 0xD1, 0xF6, 0x4B, 0x70, 0x9E, 0x44, 0x15,
+    0x23, 0xAE, 0xA2, 0x5D, 0x47, 0xA3, 0x8E, 0x7A, 0x33, 0xDD, 0x5C, 0x5F, 0x5A, 0x6C, 0xA8, 0x99,
+    0x93, 0xEE, 0xF1, 0x30, 0xEA, 0xFE, 0x91, 0x98, 0x69, 0xB4, 0x5B, 0x91, 0x4A, 0x64, 0x38, 0xBD,
+    0xC6, 0x93, 0x4C, 0x18, 0x38, 0xF5, 0xAB, 0x61, 0x45, 0x1F, 0xC9, 0xD1, 0x37, 0xC0, 0xBC, 0x25,
+    0xCB, 0xA9, 0x02, 0xC1, 0x32, 0xA3, 0x6A, 0xDF, 0x17, 0xE2, 0x21, 0x96, 0xE6, 0x57, 0x3E, 0x1E,
+    0xA4, 0x80, 0xBF, 0xDE, 0x57, 0x74, 0xF4, 0xA4, 0x9B, 0x9C, 0x1D, 0x6F, 0xC6, 0xA3, 0x4E, 0xB0,
+    0x6F, 0x5C, 0xBA, 0xBF, 0xC4, 0xB0, 0xEF, 0x87, 0x70, 0x9F, 0xD2, 0x89, 0xF4, 0xE2, 0xC7, 0x23,
+    0xFD, 0xF5, 0x9E, 0x4A, 0xBE, 0xB2, 0x94, 0xAE, 0x93, 0xA7, 0x74, 0x59, 0xEB, 0x97, 0x20, 0x68,
+    0x41, 0xB8, 0x84, 0xD6, 0x26, 0xC2, 0x06, 0x4B, 0x1D, 0x84, 0x0C, 0x62, 0x96, 0x10, 0xAB, 0xCC,
+    0x49, 0xC6, 0x07, 0x71, 0x83, 0xC0, 0x91, 0x23, 0x1F, 0xD3, 0xB5, 0xC2, 0xBA, 0xC9, 0xBF, 0x2F,
+    0xC4, 0x85, 0x60, 0xCF, 0x33, 0xB7, 0x71, 0x95, 0xB9, 0x05, 0x59, 0xE6, 0xA6, 0xE3, 0x8F, 0xE3,
+    0x3E, 0xCC, 0xE7, 0x09, 0x6C, 0x66, 0x6E, 0xAE, 0x3F, 0xCF, 0x4C, 0xCD, 0x63, 0xA1, 0x65, 0xDD,
+    0xDE, 0xD2, 0x12, 0x64, 0x38, 0x57, 0xB2, 0x69, 0xC6, 0x09, 0x87, 0x61, 0x6D, 0x5C, 0x63, 0x1F,
+    0xC8, 0x75, 0xE0, 0x28, 0xCF, 0x8E, 0x44, 0x6A, 0x49, 0x60, 0xDF, 0x67, 0x04, 0xE3, 0x82, 0x7C,
+    0xBF, 0x23, 0x3F, 0xEB, 0xE8, 0x84, 0x26, 0x3A, 0x40, 0x27, 0x21, 0x22, 0x2A, 0xFC, 0x4F, 0x14,
+    0x7A, 0x9F, 0x63, 0x4F, 0x44, 0xA9, 0x30, 0xC0, 0x92, 0x84, 0xB9, 0xDD, 0x24, 0xAC, 0x27, 0xCC,
+    0x4E, 0xAB, 0x48, 0x9C, 0x2F, 0x6B, 0x18, 0x8F, 0x2D, 0x9D, 0x67, 0x1D, 0x08, 0xF2, 0x0E, 0x55,
+    0x33, 0x6F, 0xC1, 0x6D, 0x60, 0x68, 0x5C, 0xEE, 0x33, 0xA8, 0xFE, 0xA1, 0xC6, 0x0E, 0xBB, 0x2D,
+    0x68, 0xFE, 0xE7, 0xC7, 0x4E, 0xE4, 0x91, 0x61, 0xBF, 0xD2, 0x2E, 0xCF, 0xE1, 0xAA, 0xD5, 0x12,
+    0x55, 0x1C, 0xF3, 0xBD, 0xC8, 0xDA, 0xE3, 0xC7, 0x69, 0xAD, 0x74, 0x0E, 0x56, 0xBF, 0x1C, 0x01,
+    0xAC, 0x58, 0x3E, 0xF2, 0x25, 0xB4, 0x23, 0xBD, 0xCE, 0xFA, 0xAF, 0xA6, 0xC4, 0x77, 0x76, 0x64,
+    0x47, 0x46, 0x96, 0x15, 0x7F, 0xC6, 0x33, 0xE6, 0xB3, 0xB7, 0x23, 0xBA, 0x92, 0x4A, 0x50, 0x11,
+    0x2F, 0xD4, 0x80, 0x6B, 0x98, 0x07, 0x3F, 0x1C, 0x36, 0x35, 0x71, 0x8B, 0xB7, 0xDB, 0xA8, 0x0B,
+    0x55, 0xB9, 0xA5, 0xA6, 0xA6, 0x42, 0x79, 0xCC, 0x0D, 0x0D, 0xCE, 0x91, 0x89, 0x43, 0x8F, 0x4A,
+    0x33, 0xE8, 0x06, 0x0A, 0x56, 0x2B, 0x37, 0x46, 0xA0, 0xD7, 0x5D, 0xCE, 0x73, 0x69, 0xAB, 0xC1,
+    0x47, 0xAB, 0xF4, 0xF3, 0x34, 0xBF, 0x55, 0x5E, 0x28, 0x75, 0xB6, 0x31, 0xC7, 0xF3, 0xF3, 0xB4,
+    0xEE, 0x97, 0xED, 0xAE, 0xF2, 0xA8, 0xF5, 0xF1, 0x7C, 0x56, 0xDE, 0x82, 0x9E, 0x83, 0x30, 0x21,
+    0x62, 0x35, 0x74, 0x26, 0x5B, 0x3A, 0xC3, 0x94, 0x7B, 0xCD, 0x30, 0x87, 0x50, 0x30, 0x43, 0x8A,
+    0xA1, 0xC1, 0x09, 0x1E, 0xE7, 0xD8, 0xA0, 0xCD, 0x32, 0x9D, 0xA7, 0x84, 0x3D, 0x32, 0xCD, 0xF6,
+    0x02, 0xD8, 0xDF, 0xAD, 0x87, 0xAC, 0xD6, 0xDD, 0x90, 0x84, 0x4C, 0x38, 0x9E, 0x2C, 0x0D, 0x88,
+    0x99, 0xDE, 0x10, 0xF0, 0x71, 0xFA, 0x8C, 0xDA, 0x10, 0x30, 0x39, 0x51, 0x95, 0x70, 0xAB, 0x67,
+    0x66, 0x6A, 0x43, 0xC0, 0x91, 0x7E, 0x61, 0xFE, 0x22, 0x7D, 0xE2, 0x42, 0x32, 0x68, 0x66, 0xE5,
+    0x2C, 0x67, 0x71, 0x39, 0x15, 0xA8, 0x5D, 0x81, 0x1F, 0xB9, 0x1A, 0x08, 0xB2, 0xA0, 0x1D, 0x5F,
+    0x85, 0xD9, 0x61, 0x9E, 0x17, 0x7A, 0xE4, 0xEE, 0xFA, 0x15, 0x66, 0x1E, 0x9E, 0xFA, 0x6B, 0xBB,
+    0xF0, 0x5C, 0xE8, 0xF2, 0xBC, 0x1B, 0xB8, 0xEC, 0xD6, 0xD7, 0x77, 0xCC, 0x2D, 0x25, 0xA1, 0x35,
+    0xA2, 0x12, 0x42, 0x3A, 0xCA, 0x7A, 0xC4, 0x7E, 0xE1, 0x26, 0x83, 0x0F, 0xDC, 0x22, 0xCB, 0x1D,
+    0x99, 0xEA, 0x80, 0xD3, 0xB3, 0x7D, 0x0D, 0x9E, 0x3E, 0xBC, 0x9B, 0x34, 0x9F, 0x4B, 0x7B, 0x0B,
+    0xA3, 0xF9, 0xD0, 0x3E, 0x0C, 0x9E, 0x92, 0xCE, 0x2F, 0xC3, 0x6E, 0xB6, 0x30, 0x2C, 0x9E, 0x3F,
+    0x0D, 0xD9, 0x3B, 0xE8, 0x33, 0x57, 0x3B, 0x7E, 0x81, 0xDC, 0xD9, 0xA3, 0x03, 0x22, 0xB7, 0x97,
+    0x72, 0xCA, 0x71, 0x5D, 0x48, 0xFA, 0xFD, 0x23, 0xB9, 0x5B, 0x51, 0x77, 0xEC, 0x33, 0xC8, 0x2A,
+    0xC9, 0x50, 0x08, 0xF4, 0x64, 0xC1, 0x99, 0xE7, 0xB3, 0x8E, 0x19, 0x0B, 0xE9, 0x58, 0x48, 0x47,
+    0x44, 0xDF, 0xF4, 0xFB, 0x1C, 0x51, 0x35, 0x9B, 0x89, 0x90, 0xBA, 0x4A, 0x48, 0xC9, 0x90, 0xF7,
+    0x5D, 0xF6, 0x13, 0x12, 0x5C, 0xAE, 0x60, 0x3D, 0xAA, 0xB2, 0x8E, 0xFD, 0x47, 0x71, 0x1E, 0x59,
+    0xCE, 0x9A, 0x6D, 0x45, 0xAE, 0x0E, 0x8E, 0x90, 0x0A, 0x5F, 0x9C, 0x49, 0xCE, 0x48, 0x1F, 0x08,
+    0xBD, 0x6E, 0xCE, 0x2B, 0x9E, 0xD5, 0xDE, 0x73, 0x5E, 0xEF, 0xCC, 0x64, 0xAD, 0x86, 0xE6, 0x0D,
+    0xF6, 0x36, 0x59, 0xAD, 0x21, 0x58, 0x1F, 0x10, 0x1F, 0xC9, 0x26, 0xDB, 0x93, 0x38, 0xB6, 0x12,
+    0xE3, 0x88, 0x1D, 0xF5, 0xA9, 0xCB, 0x0D, 0x02, 0xF8, 0xDE, 0x22, 0xD1, 0x3B, 0x81, 0x5D, 0xA2,
+    0xD0, 0xEC, 0xF0, 0x4A, 0x25, 0xC1, 0x0A, 0x53, 0x47, 0x9C, 0xC0, 0xBE, 0x8C, 0xB5, 0x6D, 0x5A,
+    0x38, 0x23, 0x3E, 0xB9, 0xCA, 0xC5, 0xC5, 0x07, 0x1C, 0x10, 0x5E, 0x9A, 0x6B, 0x9A, 0x5A, 0x0A,
+    0x1B, 0x49, 0x6E, 0xE4, 0xCF, 0x31, 0x7F, 0xCC, 0x5F, 0x09, 0xBD, 0xD0, 0x56, 0x3F, 0xD6, 0x2B,
+    0x8B, 0xB2, 0x91, 0x1B, 0x9A, 0xCF, 0xBE, 0x68, 0xA1, 0xF9, 0x68, 0xAB, 0xEB, 0x16, 0x59, 0x2A,
+    0x49, 0x51, 0x2E, 0x92, 0xED, 0x2B, 0xEB, 0x89, 0x5C, 0xB1, 0xFD, 0x6C, 0x71, 0x28, 0x30, 0x80,
+    0xE5, 0x0C, 0x40, 0xD1, 0x0C, 0x87, 0xD9, 0xAC, 0x47, 0x6E, 0xE5, 0x39, 0xDD, 0xB2, 0xDA, 0x2B,
+    0xD1, 0xAA, 0xDA, 0x13, 0xD3, 0x1D, 0xFB, 0xA9, 0xF3, 0x5D, 0x52, 0x59, 0x10, 0x1B, 0x24, 0xB5,
+    0xD9, 0x20, 0xA9, 0xFA, 0x9C, 0xE0, 0x9C, 0xA5, 0x99, 0x68, 0xD1, 0x8C, 0xF7, 0x2D, 0x6C, 0xBA,
+    0x99, 0x2C, 0x4D, 0xD5, 0x1A, 0x64, 0xE9, 0xF5, 0x98, 0x13, 0x92, 0xD6, 0xFB, 0x21, 0x79, 0xFD,
+    0x2C, 0xB4, 0x1E, 0xF8, 0xC4, 0xDE, 0x86, 0xD0, 0x78, 0xB5, 0x11, 0x82, 0x10, 0x86, 0x50, 0x14,
+    0x77, 0x71, 0x84, 0x6C, 0xCD, 0x29, 0xB5, 0xD1, 0x73, 0x92, 0xBC, 0x5F, 0x1B, 0x1C, 0xCB, 0xCD,
+    0xEE, 0xA4, 0xA8, 0x26, 0x11, 0xD3, 0x2F, 0x82, 0xE5, 0xEB, 0x7A, 0x69, 0xE1, 0x54, 0xA5, 0x97,
+    0xAA, 0x6E, 0xAA, 0xFB, 0xA9, 0x6A, 0xDC, 0x52, 0x51, 0x2D, 0x82, 0xAF, 0xA1, 0x5E, 0x3E, 0xB5,
+    0xA8, 0x56, 0xEF, 0x88, 0xEE, 0x9C, 0xAC, 0xF8, 0x83, 0x61, 0xA9, 0xD6, 0x55, 0xE9, 0x7B, 0x04,
+    0xF0, 0x67, 0x2A, 0xFA, 0xB0, 0x56, 0x54, 0x8F, 0x1D, 0x48, 0xEF, 0x7C, 0x59, 0x3A, 0x81, 0x22,
+    0xC6, 0xA0, 0xD2, 0x51, 0x11, 0x54, 0x6D, 0x8C, 0xEE, 0x5B, 0x35, 0xD5, 0x4D, 0x65, 0x23, 0x46,
+    0x0B, 0x40, 0x57, 0x52, 0x6B, 0x1D, 0x3B, 0x0D, 0xDC, 0x18, 0xF7, 0x24, 0xA3, 0x9B, 0x15, 0x78,
+    0xCB, 0x32, 0x8E, 0x58, 0xE9, 0x35, 0x49, 0x54, 0x3C, 0x91, 0x3F, 0xF7, 0xBC, 0x3C, 0xFB, 0x5B,
+    0xBE, 0x25, 0xAF, 0x5E, 0x3D, 0xBE, 0xD2, 0xA8, 0x5B, 0x6A, 0x69, 0xB6, 0xB0, 0x6F, 0xE7, 0xAF,
+    0x76, 0x95, 0xE8, 0xA8, 0x63, 0x69, 0x61, 0x6C, 0xA1, 0xD9, 0xF2, 0xE2, 0x4A, 0x60, 0x73, 0x6D,
+    0x66, 0x93, 0x11, 0xD7, 0x67, 0xD1, 0x31, 0x3A, 0xEE, 0x04, 0x15, 0x8A, 0x0B, 0xA1, 0xB5, 0x19,
+    0x3E, 0x43, 0x14, 0x55, 0x82, 0xA8, 0xC8, 0x56, 0x5A, 0xA8, 0x5E, 0x69, 0xC1, 0xC9, 0xC6, 0xF5,
+    0x94, 0xAE, 0xB3, 0xC4, 0xD6, 0x64, 0xCB, 0xB1, 0x60, 0x06, 0x59, 0xEC, 0xBA, 0x57, 0x25, 0x29,
+    0xED, 0x8D, 0x02, 0x97, 0xD6, 0x53, 0x94, 0xC9, 0xBA, 0x1B, 0x94, 0xE2, 0x92, 0xA2, 0x90, 0xFD,
+    0x47, 0x84, 0xBC, 0x7E, 0x18, 0x52, 0xCA, 0x35, 0x95, 0xAB, 0x75, 0xF7, 0x3F, 0x22, 0x0A, 0x64,
+    0x29, 0x7A, 0x52, 0xE3, 0xA9, 0xF2, 0x5D, 0x7D, 0x29, 0x07, 0x5A, 0x40, 0xAC, 0xB4, 0x9A, 0x78,
+    0xAD, 0x55, 0x51, 0x93, 0x70, 0x5B, 0x4D, 0x8A, 0xA4, 0x27, 0xFB, 0x08, 0xA9, 0x0D, 0xF3, 0xDB,
+    0x0E, 0x4C, 0x63, 0xAD, 0x10, 0x5A, 0xFF, 0x02, 0x95, 0x57, 0xCF, 0x6F, 0xE3, 0xC4, 0x1E, 0xFF,
+    0x38, 0xEE, 0xD6, 0x50, 0x93, 0x4E, 0x0F, 0xAC, 0x84, 0xB4, 0x4D, 0xDC, 0xC3, 0x3E, 0xA9, 0x5A,
+    0xA5, 0x4D, 0xF5, 0x14, 0x50, 0x85, 0x92, 0xDA, 0xBB, 0x1C, 0xF6, 0x48, 0x0F, 0x94, 0x0B, 0x12,
+    0x54, 0x4F, 0x7B, 0x7A, 0x97, 0xED, 0x21, 0x82, 0x1C, 0xBA, 0x89, 0x9F, 0xF8, 0x07, 0xFA, 0x1F,
+    0xBC, 0x48, 0x8F, 0x0B, 0x05, 0x89, 0x1C, 0x82, 0xB4, 0x40, 0xB6, 0xB1, 0xC4, 0x91, 0x8B, 0x6F,
+    0xDC, 0x90, 0x25, 0xC4, 0x11, 0xC9, 0x07, 0x4B, 0x78, 0x85, 0x1B, 0xBF, 0xCF, 0xD7, 0x8E, 0xB3,
+    0xEE, 0x56, 0x74, 0xC3, 0xCC, 0x77, 0x26, 0xE3, 0xEF, 0x7C, 0x67, 0xBE, 0x3F, 0xE7, 0x3B, 0x93,
+    0xC3, 0xE1, 0xB5, 0x02, 0xE0, 0xF8, 0xEC, 0x9E, 0xAB, 0xD0, 0x74, 0xFF, 0x7D, 0xB6, 0x86, 0x9B,
+    0xAA, 0x14, 0xDD, 0x81, 0x3F, 0x0D, 0x87, 0xFE, 0xFF, 0x30, 0xBC, 0xB1, 0x4A, 0x31, 0xB0, 0x09,
+    0x3B, 0xDE, 0xDC, 0x36, 0xB6, 0x71, 0x73, 0xC5, 0x20, 0x19, 0x24, 0x45, 0x9F, 0xA6, 0xE9, 0xF9,
+    0xF9, 0xF9, 0xED, 0x23, 0x29, 0x87, 0x76, 0x2A, 0x25, 0x44, 0x5E, 0x46, 0xC1, 0xDF, 0xAD, 0xB7,
+    0x8F, 0x3E, 0xB0, 0xD3, 0x4B, 0x2E, 0x5D, 0x0C, 0x2A, 0xCE, 0x3A, 0x5A, 0x38, 0xC1, 0x33, 0x4C,
+    0x71, 0x90, 0xED, 0x6A, 0x39, 0x4D, 0x4F, 0x79, 0xBA, 0xAB, 0xA3, 0x86, 0x2D, 0xEC, 0x60, 0x80,
+    0x0B, 0x74, 0x49, 0x53, 0x83, 0xE1, 0xE4, 0x04, 0x0F, 0xFD, 0xE6, 0x4F, 0xA1, 0xFA, 0x31, 0xD4,
+    0xDD, 0x40, 0x87, 0x57, 0x33, 0x9C, 0xAD, 0xD7, 0xB0, 0x63, 0x3A, 0x03, 0xCB, 0xBB, 0x68, 0xBA,
+    0xDD, 0x1A, 0x5A, 0x55, 0x10, 0x69, 0xDC, 0xF7, 0x85, 0x7A, 0x02, 0xF4, 0x32, 0x68, 0x09, 0xFC,
+    0xE3, 0xED, 0x63, 0x3B, 0x8D, 0x36, 0x5A, 0x1B, 0x82, 0x49, 0xB2, 0xD9, 0xAB, 0x04, 0x02, 0x7B,
+    0x25, 0xD8, 0x2A, 0x08, 0xB2, 0xA9, 0x77, 0x3F, 0x1D, 0xDB, 0xDF, 0x47, 0x32, 0xCE, 0x17, 0x2E,
+    0x88, 0x5B, 0x73, 0x32, 0xEE, 0xCC, 0xFD, 0xC9, 0x45, 0x30, 0xDD, 0xF9, 0xCE, 0xAB, 0x8E, 0x1D,
+    0x4E, 0xE3, 0x34, 0x49, 0x93, 0x69, 0x6C, 0x87, 0x6B, 0xEE, 0x21, 0xF0, 0x84, 0xE6, 0xF5, 0x31,
+    0xB8, 0xC4, 0x60, 0x86, 0x41, 0x80, 0x3E, 0xBD, 0x9E, 0xE9, 0xF6, 0x56, 0xBF, 0xBF, 0xFD, 0x16,
+    0x8E, 0xFB, 0x48, 0xFA, 0x5A, 0xB2, 0x8D, 0x31, 0x3A, 0xFD, 0x0E, 0xD1, 0xD3, 0x68, 0x88, 0xE1,
+    0x12, 0x2E, 0x1E, 0xC4, 0xD8, 0x7E, 0x65, 0x65, 0x49, 0xC3, 0xA2, 0xBE, 0x3A, 0xC4, 0xD2, 0xC0,
+    0x83, 0xD4, 0x65, 0x68, 0xA7, 0x21, 0x8D, 0xC1, 0xBA, 0x0C, 0x6D, 0x5E, 0x54, 0xC4, 0xA8, 0x64,
+    0x69, 0xEF, 0xA0, 0x2D, 0xBF, 0x3D, 0x25, 0x66, 0x03, 0xC6, 0x0A, 0x59, 0x98, 0x45, 0x2A, 0x77,
+    0x63, 0xA4, 0xDE, 0xF3, 0xF2, 0xDF, 0x87, 0x59, 0x14, 0x3C, 0x55, 0xCA, 0x0C, 0x18, 0x19, 0x3D,
+    0xAB, 0xD6, 0x39, 0xD5, 0x7F, 0xF6, 0x3A, 0x9D, 0x76, 0xAF, 0x6E, 0xFC, 0x27, 0x30, 0xA3, 0xEE,
+    0x58, 0xA9, 0xFB, 0x5C, 0x1B, 0x46, 0x4A, 0xF6, 0xD0, 0xFC, 0x48, 0xBD, 0xCF, 0x5F, 0xDD, 0xCB,
+    0xBF, 0x0D, 0x87, 0xBF, 0x4E, 0x08, 0xC5, 0xA5, 0xE6, 0xFD, 0x80, 0x61, 0xD5, 0xDE, 0xD1, 0x7F,
+    0xF4, 0xC9, 0xDD, 0x8A, 0xB5, 0xD4, 0xC1, 0xF5, 0x52, 0x88, 0x58, 0x92, 0xB2, 0x24, 0x68, 0x49,
+    0xD6, 0x92, 0xB8, 0x25, 0x89, 0x4B, 0x42, 0x97, 0xE4, 0x66, 0xB7, 0x10, 0xFD, 0x14, 0x85, 0xF4,
+    0xE3, 0x1D, 0x14, 0x0A, 0x84, 0x16, 0x0A, 0x1D, 0x64, 0x38, 0x57, 0x43, 0x86, 0x73, 0x4D, 0x64,
+    0x38, 0x57, 0x46, 0x86, 0x73, 0x7D, 0xC6, 0xBB, 0x98, 0xAB, 0xE4, 0xF5, 0x28, 0x2A, 0xB5, 0x8A,
+    0xA8, 0x95, 0x15, 0x95, 0x15, 0xB2, 0xB0, 0xCB, 0x89, 0x76, 0x76, 0xEE, 0xF8, 0x65, 0xBA, 0xBB,
+    0xCA, 0x69, 0x2B, 0xB4, 0x79, 0x72, 0x1A, 0x38, 0xC9, 0x02, 0xC4, 0x32, 0x3F, 0xF7, 0x77, 0xD5,
+    0x43, 0xAF, 0xAD, 0x0C, 0xB7, 0x5D, 0x33, 0x39, 0xB1, 0xCE, 0x99, 0x6A, 0xB6, 0x9C, 0xE2, 0xA2,
+    0x4E, 0x7E, 0x26, 0x74, 0xF9, 0x6A, 0xA2, 0xA3, 0x50, 0x57, 0x8E, 0x32, 0x1C, 0x93, 0xA7, 0x56,
+    0xF3, 0x32, 0xA4, 0x72, 0x3B, 0xCA, 0xF4, 0xEA, 0xB4, 0x81, 0x32, 0x1E, 0x78, 0x9C, 0xF0, 0x39,
+    0x13, 0xE4, 0xFC, 0x2B, 0xAE, 0xEE, 0x99, 0x41, 0xF5, 0xA4, 0xB1, 0xBF, 0xDF, 0x18, 0xAD, 0xE3,
+    0x50, 0xF3, 0x0C, 0x26, 0xBC, 0x03, 0x1E, 0x8A, 0x26, 0x4C, 0x47, 0xF7, 0xE0, 0x6F, 0x50, 0x3A,
+    0xB2, 0x70, 0x75, 0x5F, 0x0F, 0x0C, 0x4F, 0x31, 0x0B, 0xB4, 0x24, 0xDF, 0x00, 0xFB, 0x88, 0x35,
+    0xBF, 0x8E, 0xC8, 0xE0, 0x12, 0xEA, 0xA1, 0x05, 0x94, 0x06, 0x3D, 0x8D, 0xE6, 0xAF, 0x1B, 0x1E,
+    0xDE, 0x34, 0xFE, 0x0B, 0xE7, 0x89, 0x96, 0xE8, 0xE1, 0x13, 0x2D, 0xD6, 0xC3, 0x6D, 0xE3, 0x17,
+    0xED, 0x0C, 0x16, 0x29, 0x71, 0x4A, 0x4A, 0x52, 0xF5, 0x40, 0xAA, 0x3A, 0x17, 0x46, 0x54, 0x4B,
+    0xB6, 0xA2, 0x6F, 0x80, 0x8E, 0xE9, 0x1D, 0x98, 0x5E, 0xC7, 0x78, 0x01, 0x6D, 0x7D, 0x0E, 0x0D,
+    0xDD, 0x5D, 0x40, 0x2E, 0x3C, 0x89, 0xFB, 0xA6, 0x4F, 0x9A, 0xFC, 0xF3, 0x4E, 0xEA, 0xF4, 0x57,
+    0xC3, 0x18, 0x71, 0xF4, 0xE8, 0x74, 0x23, 0x3E, 0x45, 0x74, 0x8A, 0x71, 0x82, 0x6F, 0x43, 0xFC,
+    0xE0, 0xD1, 0xCB, 0x62, 0xE0, 0x1C, 0xF2, 0x12, 0x67, 0x49, 0x27, 0x46, 0x96, 0x01, 0x8F, 0x1C,
+    0xA6, 0x53, 0x77, 0x83, 0xE3, 0x15, 0xD1, 0x6E, 0x73, 0x5D, 0x54, 0xAC, 0x3C, 0x3F, 0x7A, 0xEC,
+    0xA2, 0x99, 0xC6, 0xF3, 0x15, 0xB7, 0xCE, 0x99, 0x2D, 0xA6, 0xE9, 0x0C, 0x86, 0x4F, 0xA8, 0x11,
+    0xD3, 0x65, 0xBA, 0xC1, 0x1B, 0x59, 0xCA, 0xA1, 0x41, 0x7C, 0x54, 0x3C, 0xB9, 0x05, 0x4C, 0x80,
+    0xEB, 0x1B, 0x62, 0x21, 0xC9, 0x44, 0xBF, 0xA3, 0xF2, 0x13, 0xF4, 0x87, 0xF4, 0x88, 0x57, 0xD5,
+    0xFC, 0x06, 0xC2, 0x7D, 0x74, 0x47, 0x12, 0xBB, 0x46, 0xA6, 0x46, 0x96, 0x49, 0xF5, 0xCF, 0x4D,
+    0x19, 0xFE, 0x31, 0x90, 0x0F, 0x4B, 0xC2, 0x56, 0x9B, 0x3E, 0x17, 0xCC, 0xAF, 0x4D, 0x62, 0x2A,
+    0x46, 0x65, 0x41, 0xF9, 0x68, 0xD5, 0x79, 0x94, 0xA5, 0xB3, 0x2E, 0xF6, 0x5A, 0x5B, 0x7B, 0x27,
+    0x5B, 0xFD, 0x7F, 0x46, 0x84, 0x3B, 0xE9, 0x19, 0x41, 0xBB, 0x04, 0x61, 0xF0, 0x59, 0x44, 0xD8,
+    0xDF, 0x1B, 0x11, 0x72, 0x4A, 0xC9, 0x7D, 0x63, 0x4C, 0x93, 0x34, 0xAB, 0xB2, 0xD7, 0x76, 0x86,
+    0x96, 0x23, 0xC9, 0x18, 0x96, 0x9D, 0x95, 0xC4, 0xAA, 0x48, 0xF5, 0xD7, 0xE8, 0x69, 0xF8, 0x8C,
+    0xFA, 0x5C, 0xAD, 0xCF, 0x0E, 0x2F, 0x86, 0xD7, 0x70, 0x92, 0x7B, 0x78, 0xBD, 0x69, 0x74, 0xC5,
+    0xD5, 0x7A, 0x3B, 0xBE, 0x77, 0x0D, 0xA7, 0xC5, 0x76, 0x61, 0x60, 0x98, 0xA9, 0x43, 0xB0, 0x1F,
+    0x84, 0xCD, 0x07, 0x61, 0x07, 0x51, 0x07, 0x71, 0x1B, 0x13, 0xC2, 0x4A, 0x06, 0x45, 0xA6, 0x8F,
+    0xC4, 0x6D, 0x7A, 0x28, 0x60, 0x79, 0x50, 0x9E, 0x64, 0xF0, 0x27, 0x25, 0xFF, 0xBE, 0xE4, 0xE8,
+    0x85, 0xBB, 0x73, 0x8F, 0x27, 0xC5, 0xF8, 0x45, 0x21, 0x4F, 0x4B, 0xB8, 0x5A, 0x0E, 0x99, 0x5A,
+    0x0E, 0x19, 0x2A, 0x87, 0xFC, 0x94, 0x5C, 0x59, 0x2A, 0xCB, 0x19, 0xF4, 0x50, 0xC8, 0xCE, 0x62,
+    0xFC, 0x93, 0x95, 0x92, 0xDD, 0xB3, 0xCE, 0x94, 0x6E, 0xED, 0x2A, 0x1F, 0xCB, 0x21, 0x8F, 0xA6,
+    0x9B, 0x8F, 0x16, 0xA5, 0xA3, 0xA5, 0x01, 0x0E, 0x4C, 0x7F, 0xC2, 0x23, 0xEA, 0xEC, 0xCA, 0x39,
+    0xB5, 0x88, 0x93, 0x0E, 0x3C, 0x6A, 0x34, 0xF0, 0x81, 0x74, 0x13, 0x76, 0x54, 0xAB, 0xC1, 0xF3,
+    0xC6, 0xAE, 0x2A, 0x51, 0xF4, 0xC6, 0xBC, 0x2B, 0x6D, 0x05, 0x1B, 0xBC, 0xA6, 0x6C, 0x19, 0x1D,
+    0xBC, 0x40, 0x7F, 0xF7, 0xE1, 0xD7, 0xD3, 0x34, 0x69, 0xCE, 0x26, 0x59, 0xE0, 0x75, 0x33, 0x0B,
+    0x8C, 0xC4, 0x99, 0x08, 0xC4, 0x9F, 0x12, 0x9B, 0x39, 0xB8, 0xE2, 0x58, 0x53, 0xD2, 0x94, 0xC4,
+    0xE9, 0x0A, 0x9F, 0x15, 0x33, 0x58, 0x9F, 0xA4, 0xAE, 0x69, 0xA6, 0x1E, 0x9B, 0x5F, 0x6A, 0xDE,
+    0xBC, 0xC1, 0x34, 0x3F, 0x60, 0xC3, 0x52, 0xED, 0x13, 0xF3, 0x0C, 0x33, 0x33, 0xC4, 0xEA, 0xF9,
+    0xB9, 0x6B, 0xCF, 0x2E, 0x9C, 0x69, 0xBC, 0x8F, 0xF4, 0xA5, 0x36, 0xA0, 0x67, 0x9B, 0x3C, 0x72,
+    0x1A, 0x8F, 0xDE, 0xF9, 0xF9, 0x17, 0x78, 0xFC, 0x8D, 0xF0, 0x58, 0xC8, 0x50, 0x34, 0x57, 0xD1,
+    0x37, 0x72, 0xE4, 0xF8, 0xE0, 0xC9, 0x54, 0x19, 0x61, 0x7C, 0x12, 0x4E, 0xBF, 0x0A, 0x57, 0x2F,
+    0x79, 0xDC, 0xDD, 0xCB, 0x7F, 0x85, 0xC7, 0xA3, 0x63, 0xD1, 0xF2, 0x18, 0xAF, 0xD3, 0x20, 0x36,
+    0x13, 0xCA, 0xD5, 0xD2, 0x84, 0xED, 0x1C, 0xD0, 0x1E, 0x9B, 0xCC, 0x66, 0xDA, 0x3C, 0x6D, 0xF0,
+    0x9E, 0x87, 0xF1, 0xDB, 0x1D, 0x5F, 0x88, 0x9F, 0x8A, 0xAD, 0x6A, 0x72, 0xE3, 0xAF, 0x61, 0xD9,
+    0x42, 0x49, 0x6E, 0xC9, 0x89, 0xAA, 0xC9, 0x06, 0x4C, 0x63, 0xBE, 0xC1, 0x64, 0x3A, 0x9D, 0x15,
+    0xD3, 0x37, 0x4A, 0xF9, 0x4A, 0x82, 0xFA, 0x9A, 0x5D, 0x6D, 0x6E, 0xD2, 0xE5, 0x72, 0x23, 0x0C,
+    0xE1, 0x6B, 0xF2, 0xFC, 0x72, 0x0C, 0x7A, 0xAA, 0x4A, 0xE4, 0x7E, 0x6F, 0x2F, 0x19, 0x4D, 0xF2,
+    0x9B, 0xC3, 0x5F, 0xEF, 0x44, 0xD5, 0x93, 0xDD, 0xC6, 0xC8, 0xE4, 0x81, 0x60, 0xA4, 0x1D, 0x11,
+    0xF9, 0x38, 0x7D, 0x0E, 0xFD, 0x37, 0x7C, 0xE4, 0x65, 0x09, 0x2C, 0x4B, 0x65, 0xB9, 0x50, 0x6F,
+    0x4A, 0x50, 0xD4, 0xF6, 0x43, 0xF5, 0x4E, 0x50, 0xF9, 0xD3, 0xF9, 0x72, 0xF6, 0xF5, 0x6C, 0x76,
+    0xA9, 0xD1, 0xE4, 0x9F, 0xF9, 0xBB, 0xAD, 0x70, 0x85, 0x36, 0xB8, 0x9B, 0x13, 0x71, 0xEF, 0xCB,
+    0x2C, 0x5D, 0x60, 0xA3, 0x38, 0x2D, 0x4F, 0x5F, 0x68, 0x9E, 0xCF, 0x0A, 0x7F, 0xCB, 0x52, 0xEF,
+    0xBB, 0xBB, 0xEC, 0x79, 0xBF, 0xD5, 0x2D, 0xB4, 0xDB, 0x0D, 0xDE, 0x58, 0xBC, 0x43, 0x70, 0xB2,
+    0xD7, 0x6A, 0x15, 0xF9, 0x52, 0xEC, 0xEF, 0xE4, 0x6D, 0x3D, 0x47, 0x71, 0x53, 0x27, 0x81, 0x11,
+    0x48, 0x9B, 0x40, 0xF7, 0x4B, 0xF7, 0x60, 0x4E, 0x67, 0xE5, 0x9F, 0x77, 0xA1, 0x2D, 0xE8, 0x7A,
+    0xA8, 0xE4, 0x74, 0x2B, 0xA5, 0xFD, 0xAC, 0xB2, 0x50, 0xBA, 0x7F, 0x65, 0xBF, 0x49, 0x92, 0x6C,
+    0x94, 0xDC, 0x35, 0x49, 0x26, 0x57, 0x79, 0x34, 0xAF, 0xBF, 0x2C, 0x1E, 0xF1, 0x22, 0x2C, 0xF8,
+    0xC9, 0xF8, 0x1A, 0xC1, 0x4B, 0xF2, 0x6D, 0xAC, 0x50, 0xBE, 0xAA, 0xE1, 0x4B, 0x3B, 0xAE, 0x92,
+    0x5E, 0xAE, 0x63, 0xB6, 0xA3, 0x8F, 0x8F, 0x1C, 0xBE, 0xCA, 0xFD, 0xE2, 0x5B, 0xDA, 0xD3, 0xAA,
+    0xEE, 0x09, 0x9D, 0xFC, 0x16, 0xB2, 0xDD, 0x4D, 0x92, 0xEE, 0x42, 0xB6, 0x0C, 0x57, 0xEE, 0x44,
+    0xDE, 0x69, 0x90, 0x3F, 0xCF, 0x96, 0x7A, 0x16, 0x86, 0xDE, 0x9E, 0xD4, 0xA5, 0x9E, 0x85, 0x81,
+    0xED, 0x59, 0x8E, 0xC2, 0x1A, 0x5E, 0x4D, 0x7B, 0x0B, 0xF2, 0xDF, 0xC7, 0xF6, 0x0A, 0x59, 0x6E,
+    0xA2, 0x55, 0x78, 0xDB, 0x1B, 0x0E, 0xEF, 0xB9, 0xCB, 0xEC, 0x7B, 0x81, 0x65, 0x75, 0xFB, 0x3F,
+    0xED, 0x53, 0x3D, 0x4F, 0xDB, 0x40, 0x18, 0x7E, 0x9C, 0x23, 0x36, 0x8A, 0x89, 0x8D, 0x54, 0x22,
+    0x55, 0x55, 0xEE, 0xCC, 0xC0, 0x10, 0xB5, 0xC4, 0x64, 0xF0, 0x60, 0x24, 0x3B, 0x1C, 0x43, 0xD5,
+    0x21, 0x8B, 0x87, 0x78, 0x41, 0x8A, 0xDA, 0xA1, 0x43, 0xD5, 0x89, 0x81, 0x01, 0xA4, 0x40, 0x4E,
+    0xFC, 0x02, 0xAB, 0x6B, 0xA5, 0x2A, 0x03, 0x43, 0xA7, 0x96, 0xA1, 0x95, 0x82, 0x1A, 0xE0, 0x7E,
+    0x82, 0x7F, 0x82, 0x07, 0xF6, 0x66, 0x60, 0xC8, 0x40, 0x49, 0xCF, 0x90, 0xA4, 0x88, 0x89, 0x1F,
+    0xD0, 0x7B, 0x9E, 0x3B, 0xBD, 0x7A, 0xDE, 0xBB, 0x7B, 0xDF, 0xF7, 0x3E, 0xB4, 0x13, 0x98, 0xDF,
+    0xC0, 0x4C, 0x1E, 0x1A, 0x32, 0x20, 0x53, 0x86, 0x8A, 0x86, 0x50, 0xA2, 0x72, 0x21, 0xC2, 0x22,
+    0x18, 0xF2, 0x56, 0x47, 0x79, 0x0E, 0x0B, 0x3D, 0x81, 0x15, 0x60, 0x08, 0xED, 0x06, 0xA4, 0x8B,
+    0x52, 0x80, 0x6A, 0x00, 0x2F, 0xC0, 0xE5, 0x24, 0x45, 0x17, 0x08, 0xA0, 0x5D, 0x70, 0x2D, 0x46,
+    0xA5, 0xBD, 0x75, 0xD3, 0x58, 0xDA, 0xC5, 0x3B, 0xF4, 0xC6, 0x68, 0xC2, 0x89, 0x9C, 0x91, 0x7B,
+    0x71, 0x53, 0xE4, 0xDA, 0x89, 0x7D, 0x18, 0xB0, 0xFD, 0x85, 0x9F, 0xD1, 0xED, 0xF0, 0x9A, 0xFD,
+    0xB0, 0x07, 0x76, 0xC0, 0x9C, 0xA1, 0x16, 0x55, 0xE2, 0xCB, 0x49, 0xDF, 0x12, 0x4B, 0xA8, 0xC1,
+    0xC3, 0x29, 0xD2, 0x82, 0x24, 0xC2, 0x80, 0x06, 0x3D, 0x41, 0xD8, 0xC5, 0xC0, 0xC5, 0x80, 0xE1,
+    0x28, 0x80, 0x33, 0x82, 0xFB, 0x07, 0x83, 0x0D, 0x8C, 0x6C, 0x5C, 0xDB, 0x68, 0x0E, 0x51, 0x8C,
+    0xA0, 0xF5, 0x61, 0x9F, 0xA3, 0x6E, 0x23, 0x30, 0x79, 0x60, 0x88, 0xBA, 0x29, 0xED, 0x89, 0x44,
+    0x4B, 0xC0, 0xE4, 0x6B, 0x36, 0xD8, 0xDD, 0x1C, 0x55, 0x0E, 0xFA, 0x53, 0x6E, 0x29, 0xEF, 0xCC,
+    0xCE, 0x75, 0xDC, 0x29, 0xB3, 0xF1, 0xBE, 0xDD, 0xDB, 0x99, 0x21, 0x1C, 0x84, 0xAA, 0xA8, 0xEE,
+    0x14, 0x81, 0x82, 0x0B, 0x9B, 0x17, 0x52, 0x2C, 0x03, 0x7B, 0xCA, 0x36, 0x05, 0x91, 0x0A, 0xE9,
+    0x1C, 0xD2, 0x54, 0x6B, 0xF6, 0xF3, 0x3D, 0x56, 0x50, 0xFF, 0x0D, 0x9B, 0x08, 0x8B, 0x88, 0xF2,
+    0x8C, 0x16, 0x91, 0xBD, 0xE3, 0x4C, 0x7B, 0xC2, 0xE9, 0x83, 0x9B, 0xF2, 0x97, 0x7C, 0x26, 0xC9,
+    0x03, 0xBC, 0x1A, 0x57, 0xDA, 0xA5, 0xE4, 0x70, 0x78, 0x1A, 0xAE, 0xE6, 0x59, 0xED, 0x23, 0x53,
+    0x3B, 0x16, 0x36, 0x77, 0x26, 0xB7, 0x71, 0x5B, 0x57, 0xFA, 0x28, 0x5C, 0x55, 0xAA, 0x99, 0x16,
+    0x87, 0x70, 0xC5, 0x46, 0x16, 0x5E, 0x8C, 0x8B, 0xFC, 0xFF, 0x6D, 0x3D, 0xE9, 0xB6, 0x4A, 0x57,
+    0xA8, 0x56, 0xB1, 0x50, 0x06, 0x28, 0x58, 0x07, 0x7E, 0x19, 0x1E, 0x45, 0xF8, 0x05, 0xFA, 0x6B,
+    0xE8, 0x19, 0xA5, 0xBE, 0xB5, 0xF9, 0x76, 0x33, 0xF6, 0xB1, 0x0E, 0xBB, 0xA3, 0x25, 0xFA, 0x15,
+    0xA8, 0x05, 0xDF, 0x80, 0x4F, 0xB8, 0x47, 0xB8, 0x1A, 0xD7, 0x0D, 0x58, 0x1D, 0x68, 0x09, 0x3E,
+    0xEE, 0x08, 0x66, 0xC1, 0x78, 0x8E, 0x42, 0x06, 0x8C, 0x50, 0xF0, 0xB1, 0x48, 0x55, 0xB5, 0x3C,
+    0xAE, 0x70, 0x33, 0x5B, 0xEB, 0xE6, 0x5F, 0xE8, 0xE5, 0x77, 0xDF, 0xF2, 0xCB, 0xB4, 0xAB, 0x25,
+    0x87, 0x79, 0xB4, 0x3B, 0x9E, 0xC1, 0x69, 0x81, 0x12, 0xF1, 0x90, 0x2E, 0x91, 0xF1, 0x76, 0xF4,
+    0x6F, 0xCE, 0x0B, 0xA1, 0x82, 0xD2, 0x1A, 0x68, 0x3F, 0x3F, 0x59, 0x1A, 0xE4, 0x39, 0xB8, 0x86,
+    0x88, 0x39, 0x3F, 0x57, 0xFE, 0xC7, 0x70, 0x11, 0xF3, 0xDA, 0x01, 0xE3, 0x4E, 0xEB, 0x53, 0xAA,
+    0x5E, 0x60, 0x56, 0x7E, 0xD4, 0x1D, 0x22, 0x47, 0x95, 0xED, 0xA8, 0xFD, 0xE1, 0x40, 0x85, 0xE6,
+    0x0F, 0xDF, 0xA8, 0xA2, 0x43, 0x52, 0xE5, 0xFB, 0x7A, 0x06, 0xF6, 0x86, 0x33, 0x22, 0x69, 0x61,
+    0x4A, 0x65, 0xB3, 0xCF, 0xA0, 0xEF, 0xA7, 0x29, 0xF5, 0x38, 0x4A, 0x89, 0xD7, 0xF0, 0x96, 0x9B,
+    0x30, 0x32, 0xEC, 0x35, 0x6A, 0xDE, 0xAE, 0xCE, 0x17, 0xB0, 0x84, 0x23, 0x51, 0x47, 0x75, 0x0E,
+    0x8B, 0xEB, 0xFC, 0x2F, 0x85, 0x56, 0xCF, 0x8F, 0x1C, 0xC5, 0x19, 0xFD, 0xBA, 0x2B, 0xB8, 0x25,
+    0xCA, 0x76, 0xE7, 0xC0, 0xCA, 0x0E, 0x1E, 0x51, 0x52, 0x4E, 0x28, 0xB2, 0xB7, 0x8D, 0x64, 0x0B,
+    0xA3, 0xCC, 0x4C, 0xD7, 0xC6, 0x20, 0x0E, 0x24, 0xB0, 0x87, 0x4C, 0x38, 0x10, 0xC9, 0x1C, 0x90,
+    0x90, 0xC2, 0x61, 0xF7, 0x90, 0x13, 0xCC, 0xB8, 0x1B, 0xF9, 0x1F, 0xC8, 0x05, 0x38, 0x24, 0x52,
+    0x36, 0x11, 0x52, 0xA2, 0xF5, 0x61, 0x91, 0xC2, 0x61, 0x84, 0x7A, 0xBD, 0xB5, 0xB6, 0x14, 0x24,
+    0xA4, 0x88, 0xB2, 0xAC, 0x55, 0x0E, 0x44, 0xB8, 0x41, 0x76, 0xAC, 0x60, 0x09, 0xDA, 0xA1, 0x2D,
+    0x66, 0x37, 0x33, 0x53, 0xBC, 0xAF, 0x7A, 0xF6, 0x07, 0x02, 0x91, 0x9E, 0x79, 0xAF, 0xBA, 0xAA,
+    0xBB, 0xBF, 0xAE, 0xFA, 0x7E, 0xBC, 0x6A, 0x22, 0xA2, 0xD0, 0xE5, 0xA4, 0xCE, 0x97, 0xD4, 0x0E,
+    0x2C, 0xF5, 0xD1, 0x1F, 0x02, 0xF5, 0x5C, 0x6F, 0xB1, 0x4E, 0x5C, 0x35, 0x92, 0xF9, 0xF2, 0x50,
+    0xE6, 0xA7, 0xDB, 0x12, 0xF7, 0x00, 0x87, 0x9C, 0x33, 0x84, 0xF6, 0x00, 0x1E, 0x05, 0xCE, 0x51,
+    0xEA, 0x46, 0x24, 0x7E, 0x41, 0x24, 0x7E, 0x4E, 0x74, 0x62, 0x42, 0x81, 0xCB, 0x8C, 0xFC, 0x20,
+    0xB1, 0xEA, 0xC1, 0xC7, 0x6D, 0xF7, 0xC8, 0x63, 0xBA, 0x73, 0xF8, 0x34, 0x0D, 0x5A, 0xCB, 0x54,
+    0x1C, 0x5F, 0xA1, 0xE2, 0x51, 0x4B, 0x83, 0x33, 0x86, 0x06, 0xA7, 0x0D, 0xA5, 0x8F, 0x19, 0x4A,
+    0xFE, 0x9B, 0xEB, 0xF8, 0xD3, 0x05, 0x2B, 0xDC, 0x17, 0x39, 0xB9, 0x6D, 0xA2, 0xF7, 0x89, 0x82,
+    0xBF, 0x63, 0x12, 0x4F, 0x51, 0x73, 0x24, 0x53, 0x0A, 0xB7, 0x95, 0x91, 0x46, 0xD8, 0x58, 0x0B,
+    0x9B, 0x50, 0x40, 0x5D, 0x0C, 0x0F, 0x18, 0xE9, 0x92, 0x29, 0xE4, 0x1D, 0x5B, 0x44, 0x9B, 0x7A,
+    0x3D, 0x82, 0x4D, 0xA0, 0x0B, 0xA4, 0x80, 0x7A, 0xDA, 0x50, 0xFC, 0x4F, 0x03, 0xBB, 0x1F, 0x19,
+    0xCA, 0xA6, 0xDE, 0x94, 0x73, 0x8E, 0xD4, 0xD6, 0x12, 0x49, 0x23, 0x81, 0x08, 0x08, 0x01, 0xDA,
+    0xC7, 0xD6, 0x22, 0x49, 0x57, 0xEF, 0xF5, 0xD7, 0x3E, 0x23, 0x7A, 0x61, 0x6B, 0xFF, 0x7A, 0x6C,
+    0x61, 0xA3, 0x31, 0x85, 0x35, 0x96, 0x14, 0x5D, 0x1F, 0x51, 0x4C, 0x6D, 0x52, 0x1E, 0x3F, 0x04,
+    0x70, 0x0F, 0x35, 0xAE, 0xD9, 0x80, 0xAB, 0x04, 0xEE, 0x0F, 0xF9, 0x19, 0x9C, 0x07, 0x65, 0x73,
+    0x2E, 0xD8, 0x6D, 0x7F, 0x0D, 0x75, 0x8A, 0xB9, 0xBC, 0x74, 0x62, 0x3C, 0x5B, 0x24, 0x1D, 0xF2,
+    0x7C, 0xD4, 0xF3, 0x61, 0xA2, 0xB9, 0x85, 0xB7, 0x4F, 0xBD, 0x4D, 0xC9, 0x87, 0x2E, 0x75, 0x24,
+    0x46, 0xAA, 0x56, 0x5A, 0x54, 0x51, 0xC9, 0x3E, 0x10, 0x36, 0x62, 0x36, 0xFB, 0x2C, 0x3D, 0xC7,
+    0x9E, 0x95, 0xE7, 0xD4, 0xF3, 0xE3, 0x60, 0x59, 0xFE, 0xAD, 0x8C, 0x6C, 0x36, 0xB9, 0x31, 0x8E,
+    0xC6, 0x14, 0x18, 0xB6, 0xCE, 0x13, 0x00, 0x33, 0xA5, 0x36, 0x9E, 0x92, 0xAC, 0xC2, 0x9A, 0x44,
+    0x4D, 0x25, 0x89, 0x31, 0xD3, 0x3A, 0x53, 0xC6, 0xF4, 0x47, 0x5D, 0x62, 0x19, 0xCE, 0x69, 0x71,
+    0xDE, 0x96, 0x74, 0xEC, 0xAD, 0xFB, 0xB7, 0x67, 0x5D, 0x5D, 0xE0, 0xAA, 0xEE, 0x30, 0x25, 0x4C,
+    0x31, 0x28, 0x97, 0xF0, 0x87, 0x11, 0x25, 0xA5, 0xA3, 0xB0, 0xA4, 0xCC, 0xAD, 0x60, 0x99, 0xB7,
+    0xAF, 0xE0, 0x45, 0xA5, 0xD2, 0xA0, 0x18, 0xDE, 0xC0, 0xFC, 0xF7, 0xE8, 0x6A, 0x8E, 0xB1, 0x4B,
+    0x20, 0xF5, 0x0C, 0x68, 0x3D, 0x9B, 0x08, 0x57, 0x4A, 0x9C, 0xD1, 0x77, 0x53, 0x54, 0xC1, 0x78,
+    0xE6, 0x74, 0x38, 0xF1, 0x1E, 0x4A, 0xDD, 0x2D, 0x6E, 0xA2, 0xFB, 0x19, 0x37, 0x61, 0xC5, 0xC1,
+    0x41, 0xC3, 0xFE, 0xE6, 0xA6, 0x3C, 0xB4, 0xE2, 0x9B, 0x8B, 0xEB, 0x7E, 0xB0, 0x52, 0x68, 0xA2,
+    0xCD, 0xF2, 0x28, 0x1A, 0x15, 0x54, 0x9C, 0xF3, 0x35, 0xC1, 0x50, 0x78, 0xAF, 0xA6, 0xCC, 0x62,
+    0x70, 0x4C, 0x72, 0x8C, 0xE6, 0x22, 0xA2, 0x86, 0x26, 0x41, 0x10, 0x75, 0x58, 0xC5, 0xAF, 0x1B,
+    0x89, 0x46, 0x5E, 0xB5, 0x52, 0x8B, 0x5A, 0xDC, 0x83, 0x95, 0xD4, 0x05, 0x93, 0x8D, 0xD1, 0x6E,
+    0xC8, 0x12, 0x47, 0x3F, 0xA2, 0x74, 0x1C, 0x8D, 0x68, 0x9E, 0xA2, 0x32, 0xAC, 0x28, 0x25, 0x61,
+    0x82, 0x9A, 0x52, 0x38, 0x88, 0x46, 0xB4, 0x91, 0x47, 0x44, 0x63, 0xBA, 0x8B, 0x5C, 0xA3, 0x82,
+    0x6E, 0x18, 0xC4, 0xB6, 0x13, 0x5C, 0xB3, 0x47, 0x60, 0x85, 0x8F, 0xF1, 0xDC, 0xD2, 0xF3, 0x6F,
+    0xDE, 0x1F, 0xFC, 0x92, 0x94, 0xD0, 0xD5, 0x19, 0xBC, 0xF2, 0x69, 0xAA, 0x97, 0xE1, 0xB3, 0x0F,
+    0xA8, 0x78, 0x07, 0x2B, 0xFB, 0x07, 0xB5, 0x91, 0x30, 0xE2, 0x5F, 0xD4, 0xE1, 0x9C, 0x19, 0x53,
+    0x82, 0x15, 0x86, 0x23, 0x52, 0xBC, 0xD0, 0x1A, 0xF3, 0x83, 0x87, 0x6F, 0x85, 0xE5, 0xA0, 0x77,
+    0x45, 0x94, 0x7D, 0x98, 0x00, 0xC5, 0x97, 0x40, 0x12, 0xF4, 0x30, 0x93, 0x92, 0xD7, 0xBE, 0x41,
+    0x11, 0x8F, 0xC1, 0xF1, 0x4C, 0x16, 0x14, 0x99, 0xBE, 0xEA, 0x2D, 0xE9, 0xBE, 0xE2, 0x92, 0x13,
+    0x9C, 0xD3, 0x58, 0x3D, 0x16, 0x82, 0xD9, 0xC1, 0x41, 0x5D, 0x7F, 0x1E, 0x4D, 0xE7, 0x49, 0x7D,
+    0xF4, 0x39, 0x7A, 0x57, 0x20, 0x0D, 0x5D, 0x8F, 0x02, 0xE3, 0xBB, 0xD8, 0x1D, 0xE3, 0xEB, 0xEA,
+    0xCD, 0x2F, 0x74, 0xE4, 0x54, 0xB5, 0xEF, 0x1C, 0x67, 0x1E, 0x5E, 0x5D, 0xCD, 0x9B, 0x0E, 0x7C,
+    0x56, 0x67, 0x78, 0x71, 0x8C, 0xF7, 0xC6, 0xBE, 0x3C, 0xB0, 0x02, 0x0F, 0xE7, 0x2C, 0x2D, 0xBD,
+    0xA1, 0x7D, 0xD9, 0x20, 0xB5, 0xE8, 0xC2, 0x1B, 0xCD, 0x38, 0x47, 0x14, 0x55, 0x4C, 0xA2, 0x0A,
+    0x88, 0x26, 0x27, 0x60, 0x63, 0x37, 0xF2, 0x10, 0x2C, 0xB8, 0x1C, 0xA2, 0x50, 0xC1, 0x11, 0x61,
+    0x15, 0x70, 0x00, 0x23, 0x0D, 0x3A, 0xCA, 0xB1, 0x3F, 0xC7, 0x54, 0xF9, 0x52, 0x1F, 0xD1, 0x31,
+    0x37, 0x59, 0xA4, 0x70, 0x9C, 0xF1, 0x58, 0x92, 0x83, 0x62, 0x7F, 0x73, 0x05, 0x82, 0x2F, 0x61,
+    0x60, 0x42, 0x11, 0xE2, 0x95, 0xA3, 0xC8, 0x64, 0x95, 0xE1, 0x89, 0xC1, 0x85, 0xAD, 0xE1, 0xB2,
+    0x34, 0x6D, 0xE0, 0xE4, 0xA2, 0x34, 0x0F, 0x91, 0xDC, 0xC4, 0x54, 0x6E, 0x02, 0x35, 0x71, 0x08,
+    0xC4, 0xDD, 0xAB, 0x14, 0x48, 0x78, 0x0B, 0x19, 0x4F, 0x1B, 0x86, 0xA2, 0xDF, 0x1F, 0x50, 0x0F,
+    0x65, 0x21, 0x0A, 0x53, 0xDA, 0x3B, 0x42, 0x7D, 0xA0, 0xA6, 0x1F, 0x18, 0x78, 0xD1, 0xF8, 0xCF,
+    0xB6, 0xF7, 0x50, 0x50, 0xB5, 0x7D, 0x11, 0xDA, 0xD8, 0x37, 0x48, 0x34, 0xAF, 0x1A, 0x11, 0xBB,
+    0x0B, 0x22, 0x67, 0xBC, 0x8E, 0xF8, 0x46, 0x7D, 0xA3, 0x99, 0xF7, 0x3E, 0xA1, 0x0E, 0xE2, 0x0C,
+    0x77, 0xB4, 0x29, 0x7E, 0x16, 0x4F, 0x42, 0x7B, 0x5A, 0x22, 0x4F, 0x86, 0xD4, 0x69, 0x0B, 0xF3,
+    0x62, 0x4D, 0x45, 0x5B, 0xE4, 0x2F, 0x7E, 0x1E, 0x96, 0x17, 0x25, 0x25, 0x0B, 0x4E, 0xBF, 0xD7,
+    0x68, 0xCC, 0x2C, 0x32, 0x4D, 0x13, 0x34, 0x0D, 0x0A, 0xB5, 0x79, 0xFF, 0xEE, 0x94, 0x11, 0x00,
+    0x71, 0x03, 0xCB, 0xCA, 0xED, 0x3E, 0x0C, 0xFA, 0x57, 0xB1, 0xF4, 0x1B, 0x39, 0x89, 0x3B, 0x78,
+    0x86, 0x57, 0x38, 0x6E, 0x60, 0x26, 0x24, 0x3E, 0x99, 0x52, 0xF4, 0xE5, 0x12, 0x1D, 0xC9, 0x62,
+    0xDD, 0x6A, 0x4B, 0x73, 0xE6, 0xB8, 0x8F, 0x9A, 0xA5, 0x1F, 0x00, 0x2D, 0x08, 0xDE, 0x29, 0x58,
+    0x57, 0x2F, 0xE4, 0x14, 0x4D, 0x7C, 0xD5, 0x46, 0xF7, 0xB9, 0xC4, 0x62, 0xF3, 0xCA, 0xCE, 0xDA,
+    0xAD, 0x57, 0x76, 0x2E, 0x8F, 0xB8, 0x4C, 0xB9, 0xE5, 0x3E, 0xC6, 0xF3, 0xB0, 0xCA, 0x50, 0x9E,
+    0xB7, 0x38, 0x38, 0xDF, 0x02, 0x62, 0x05, 0x1B, 0xEC, 0x23, 0xEF, 0x59, 0x2E, 0x76, 0x85, 0x6E,
+    0xB0, 0x7D, 0xA7, 0xA6, 0xC8, 0x5A, 0x68, 0xB1, 0xB6, 0x35, 0x25, 0x64, 0x35, 0x52, 0xD2, 0xF2,
+    0x16, 0xB1, 0x4B, 0x45, 0x43, 0x5B, 0x3D, 0x74, 0x6F, 0x3A, 0x3D, 0xA0, 0xEB, 0x63, 0xBE, 0x65,
+    0x84, 0x92, 0x05, 0x29, 0x0D, 0x92, 0x6C, 0x20, 0xDC, 0x86, 0xA2, 0xD3, 0x92, 0x2B, 0x67, 0xE6,
+    0x3D, 0xB1, 0x72, 0x23, 0x0F, 0x99, 0x6A, 0x0E, 0x53, 0xC1, 0x41, 0xE5, 0xAD, 0xF2, 0x48, 0x07,
+    0x74, 0x12, 0x72, 0xD1, 0x1B, 0x20, 0x85, 0x57, 0x77, 0xD6, 0x3E, 0xFB, 0x1D, 0xBD, 0xC3, 0x99,
+    0x00, 0xC9, 0xF5, 0x4A, 0x69, 0x43, 0x83, 0x79, 0x0B, 0x0D, 0x51, 0x80, 0x16, 0xF0, 0x5E, 0x81,
+    0x49, 0x40, 0x0E, 0xA7, 0xE4, 0xAA, 0xD8, 0x99, 0xDD, 0x6D, 0x44, 0xDA, 0x02, 0x53, 0x9F, 0xC7,
+    0x65, 0x85, 0xCD, 0x8D, 0x37, 0x91, 0x84, 0x7A, 0xBD, 0x0D, 0xBD, 0xBA, 0x36, 0xCD, 0x29, 0xAB,
+    0xE8, 0x57, 0x6E, 0x4B, 0xC3, 0x9C, 0x55, 0x39, 0x5F, 0xE1, 0xEA, 0x3C, 0x84, 0x4C, 0x90, 0x5A,
+    0xE1, 0x09, 0x69, 0x53, 0xD8, 0xD8, 0xD5, 0x24, 0xF8, 0x85, 0x45, 0x9E, 0xB7, 0xCC, 0x9D, 0x9B,
+    0x46, 0x6E, 0x5E, 0xB3, 0xF1, 0xC2, 0x35, 0x9B, 0x04, 0x9B, 0xD4, 0xC5, 0xF8, 0x60, 0x86, 0x62,
+    0x86, 0xF5, 0x59, 0x9F, 0xAF, 0xA5, 0x80, 0x5A, 0xC0, 0x96, 0x79, 0x1D, 0x5B, 0xE6, 0x74, 0xB6,
+    0x65, 0x86, 0xC6, 0xDB, 0x13, 0x76, 0x08, 0x14, 0x7B, 0x38, 0x76, 0x7B, 0xB2, 0x08, 0x11, 0xAB,
+    0x0E, 0x8E, 0x7D, 0x3F, 0x2E, 0x02, 0xC9, 0x9E, 0x36, 0x04, 0x1B, 0xD8, 0x2A, 0xEC, 0x3A, 0x66,
+    0x3F, 0x8F, 0xDF, 0x23, 0xAC, 0x3A, 0x7E, 0x5D, 0x31, 0x6F, 0x8D, 0x23, 0xF6, 0x09, 0x2F, 0xB4,
+    0x9E, 0xE5, 0x5A, 0xEA, 0x6B, 0xE2, 0xF8, 0x9F, 0x9F, 0xD3, 0xAF, 0xBD, 0xFA, 0xA1, 0x7E, 0xF9,
+    0xEC, 0x4D, 0xFA, 0xE9, 0x59, 0x08, 0x36, 0x6F, 0xBF, 0x4F, 0x20, 0x35, 0xCF, 0x9A, 0x99, 0x2E,
+    0x38, 0x33, 0xD7, 0xEB, 0xF9, 0xC4, 0xF8, 0x09, 0x74, 0xA7, 0xBB, 0x76, 0xD9, 0x9C, 0x89, 0x03,
+    0x73, 0x3A, 0x26, 0x0F, 0x2F, 0x30, 0xDF, 0x07, 0xD6, 0x07, 0x37, 0x86, 0xAC, 0x3A, 0x9A, 0xCB,
+    0x58, 0x84, 0x58, 0x80, 0x2C, 0xFD, 0xE6, 0xF2, 0x8E, 0x07, 0x9F, 0xFB, 0x31, 0x88, 0x49, 0x36,
+    0x6A, 0x66, 0xA5, 0xF4, 0xEC, 0xB6, 0x72, 0x96, 0x1F, 0x5C, 0x16, 0x57, 0xD8, 0x96, 0xC5, 0x7C,
+    0x30, 0x3E, 0x3A, 0x90, 0xBF, 0xF7, 0x4A, 0x2C, 0x47, 0x43, 0x67, 0x88, 0x5E, 0xBD, 0x87, 0xED,
+    0x09, 0xA5, 0x16, 0xD5, 0x0F, 0x20, 0xBC, 0x2A, 0xFF, 0x59, 0xA5, 0x90, 0x27, 0xA1, 0x65, 0x31,
+    0x03, 0x70, 0x2E, 0x72, 0x51, 0x2B, 0xFF, 0x55, 0xC5, 0x07, 0x84, 0x85, 0xCE, 0x61, 0x53, 0x58,
+    0x86, 0xB8, 0xFD, 0xF6, 0xD4, 0x2A, 0x7F, 0x3A, 0x54, 0x0F, 0x16, 0xF8, 0x52, 0x6B, 0xD1, 0x49,
+    0xE0, 0x30, 0xB5, 0x9E, 0x3C, 0x4C, 0xEA, 0xE3, 0x93, 0xF4, 0xC8, 0xFF, 0xDE, 0xA5, 0xF6, 0x8F,
+    0x2D, 0xCF, 0x23, 0xFC, 0x03, 0x27, 0x28, 0xBE, 0x49, 0x24, 0x9D, 0x23, 0xF1, 0x6F, 0x18, 0x72,
+    0xE5, 0x9E, 0x2A, 0x89, 0x19, 0x96, 0xB6, 0x49, 0x7C, 0xB5, 0x66, 0xE2, 0x4B, 0xE7, 0xAB, 0x79,
+    0xA1, 0xEB, 0x8E, 0xD0, 0xC3, 0xBE, 0xD0, 0x7D, 0xA0, 0x5D, 0x00, 0x43, 0xEC, 0xF1, 0xDF, 0x05,
+    0x87, 0xCD, 0x5D, 0x6D, 0xAD, 0x43, 0xF4, 0x14, 0x10, 0xE7, 0xF8, 0x9C, 0xE2, 0x5F, 0xDE, 0x9C,
+    0x63, 0x6C, 0xB3, 0xF0, 0xBA, 0xFE, 0x7F, 0x3F, 0xA3, 0x5A, 0x2B, 0x0D, 0xE6, 0xD9, 0x37, 0x4E,
+    0xC7, 0xBF, 0xFE, 0x8B, 0x9D, 0x6F, 0xFD, 0xA9, 0x6A, 0xB7, 0x56, 0xEA, 0x7E, 0x6B, 0x65, 0x58,
+    0xB4, 0x56, 0x96, 0x87, 0xB3, 0x4F, 0x52, 0x2E, 0xBA, 0xBE, 0x97, 0xBE, 0x26, 0x5C, 0x2C, 0x95,
+    0x5C, 0x98, 0xA8, 0xB2, 0x92, 0x41, 0xAF, 0xF3, 0x97, 0xA3, 0x73, 0x79, 0xF2, 0x56, 0x15, 0xEB,
+    0x71, 0xAC, 0x8B, 0x58, 0xF7, 0xFD, 0xBF, 0x88, 0x17, 0xB8, 0xD8, 0xE2, 0x5E, 0xED, 0xBB, 0xDD,
+    0x58, 0xA7, 0xFE, 0x8F, 0x93, 0x4E, 0xD2, 0x1B, 0xF1, 0x44, 0xDF, 0xF7, 0x5F, 0x9D, 0xAB, 0x5A,
+    0xDE, 0xC5, 0xE6, 0x5F, 0xB7, 0xA9, 0x2E, 0x68, 0x71, 0xCC, 0x05, 0x3B, 0xFB, 0x17, 0xFE, 0xDD,
+    0x5D, 0x7A, 0x48, 0x6D, 0xBD, 0x1B, 0x39, 0xDB, 0x64, 0xF1, 0x86, 0xAB, 0x7A, 0xBD, 0xC5, 0xAF,
+    0x01, 0xAB, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0x7F, 0x06, 0x06, 0x06, 0x00, 0x8D, 0xCD, 0x21, 0x0E,
+    0x42, 0x31, 0x0C, 0xC6, 0xF1, 0xFF, 0x98, 0x98, 0x98, 0xC0, 0xE0, 0x77, 0x02, 0xD8, 0x09, 0x48,
+    0xF0, 0x18, 0x8E, 0x82, 0xC4, 0x00, 0xBB, 0x11, 0x06, 0x51, 0x41, 0xF2, 0x76, 0x84, 0x67, 0xF0,
+    0x1C, 0x61, 0x02, 0x81, 0x79, 0x29, 0xDD, 0x0B, 0x07, 0xA0, 0x49, 0x7F, 0x69, 0xBE, 0x26, 0x2D,
+    0x0E, 0xAB, 0xEB, 0x07, 0x5C, 0x4B, 0xE0, 0xC7, 0x58, 0xF0, 0xD5, 0x08, 0x75, 0xD9, 0x49, 0x4F,
+    0x63, 0x50, 0x63, 0xCE, 0xFE, 0xA6, 0x12, 0x5F, 0x61, 0x64, 0xD0, 0x85, 0xF2, 0xAB, 0x95, 0x75,
+    0xD0, 0x02, 0xC9, 0x35, 0x58, 0x23, 0xB0, 0xED, 0xF4, 0xC9, 0x0D, 0x6E, 0x3A, 0x6C, 0x6E, 0x7B,
+    0x6D, 0xA7, 0x58, 0x84, 0xBB, 0xDF, 0x49, 0x5F, 0x09, 0x97, 0x4E, 0x7E, 0x1B, 0x41, 0x7B, 0x92,
+    0x6D, 0x6B, 0xF7, 0x85, 0xA3, 0x37, 0x9A, 0xAF, 0x0F, 0x24, 0x96, 0x33, 0x79, 0x22, 0xB7, 0xF9,
+    0xCD, 0x17, 0x45, 0x8D, 0xB1, 0x0D, 0x80, 0x40, 0x0C, 0x03, 0x5F, 0x7C, 0x41, 0x41, 0x91, 0x51,
+    0x98, 0x00, 0x05, 0x46, 0x63, 0x12, 0x46, 0x21, 0xA3, 0x30, 0xC2, 0x17, 0x20, 0x01, 0x7A, 0x71,
+    0x24, 0xA2, 0x20, 0x52, 0x5C, 0xD8, 0xF2, 0x39, 0xA5, 0x9C, 0xE2, 0xC4, 0x42, 0xB5, 0x84, 0x52,
+    0x5D, 0x32, 0x84, 0x3D, 0x76, 0x1E, 0x0C, 0xED, 0xEC, 0x41, 0x15, 0xAB, 0x6E, 0x2F, 0x46, 0x12,
+    0x30, 0x4C, 0x61, 0xA2, 0xAC, 0x3C, 0x2D, 0xA7, 0xB2, 0xF7, 0x14, 0x61, 0xF7, 0x24, 0x73, 0x45,
+    0x19, 0x02, 0xA4, 0x07, 0xDE, 0x95, 0x4D, 0x9D, 0x93, 0x37, 0x0D, 0xFE, 0x5D, 0xFF, 0xAD, 0x6F,
+    0xB7, 0xF1, 0x7F, 0x01,
 };
 
 static const EpdGlyph notoserif_12_regularGlyphs[] = {
@@ -1673,99 +1676,99 @@ static const EpdGlyph notoserif_12_regularGlyphs[] = {
     { 0, 0, 104, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 104, 0, 0, 0, 0 }, // U+0020
     { 4, 19, 133, 2, 18, 19, 0 }, // !
-    { 8, 7, 163, 1, 18, 14, 19 }, // "
-    { 14, 18, 224, 0, 18, 63, 33 }, // #
-    { 12, 21, 224, 1, 19, 63, 96 }, // $
-    { 21, 20, 358, 1, 19, 105, 159 }, // %
-    { 19, 20, 297, 0, 19, 95, 264 }, // &
-    { 4, 7, 88, 1, 18, 7, 359 }, // '
-    { 7, 23, 138, 1, 19, 41, 366 }, // (
-    { 8, 23, 138, 0, 19, 46, 407 }, // )
-    { 11, 10, 200, 1, 19, 28, 453 }, // *
-    { 12, 12, 224, 1, 15, 36, 481 }, // +
-    { 5, 8, 100, 0, 4, 10, 517 }, // ,
-    { 8, 3, 124, 0, 8, 6, 527 }, // -
-    { 4, 5, 100, 1, 4, 5, 533 }, // .
-    { 8, 23, 115, 0, 19, 46, 538 }, // /
-    { 13, 20, 232, 1, 19, 65, 584 }, // 0
-    { 11, 18, 184, 0, 18, 50, 649 }, // 1
-    { 12, 19, 198, 0, 19, 57, 699 }, // 2
-    { 12, 20, 204, 0, 19, 60, 756 }, // 3
-    { 14, 18, 221, 0, 18, 63, 816 }, // 4
-    { 11, 19, 204, 1, 18, 53, 879 }, // 5
-    { 12, 20, 220, 1, 19, 60, 932 }, // 6
-    { 12, 18, 206, 1, 18, 54, 992 }, // 7
-    { 12, 20, 223, 1, 19, 60, 1046 }, // 8
-    { 12, 20, 220, 1, 19, 60, 1106 }, // 9
-    { 4, 15, 114, 2, 14, 15, 1166 }, // :
-    { 5, 18, 114, 1, 14, 23, 1181 }, // ;
-    { 12, 14, 224, 1, 16, 42, 1204 }, // <
-    { 12, 8, 224, 1, 13, 24, 1246 }, // =
-    { 12, 14, 224, 1, 16, 42, 1270 }, // >
-    { 11, 20, 190, 0, 19, 55, 1312 }, // ?
-    { 21, 22, 368, 1, 18, 116, 1367 }, // @
-    { 18, 18, 282, 0, 18, 81, 1483 }, // A
-    { 15, 18, 262, 0, 18, 68, 1564 }, // B
-    { 14, 20, 246, 1, 19, 70, 1632 }, // C
-    { 17, 18, 291, 0, 18, 77, 1702 }, // D
-    { 15, 18, 249, 0, 18, 68, 1779 }, // E
-    { 14, 18, 236, 0, 18, 63, 1847 }, // F
-    { 17, 20, 286, 1, 19, 85, 1910 }, // G
-    { 19, 18, 317, 0, 18, 86, 1995 }, // H
-    { 9, 18, 147, 0, 18, 41, 2081 }, // I
-    { 10, 24, 143, -1, 18, 60, 2122 }, // J
-    { 18, 18, 280, 0, 18, 81, 2182 }, // K
-    { 15, 18, 249, 0, 18, 68, 2263 }, // L
-    { 23, 18, 375, 0, 18, 104, 2331 }, // M
-    { 19, 18, 305, 0, 18, 86, 2435 }, // N
-    { 17, 20, 297, 1, 19, 85, 2521 }, // O
-    { 15, 18, 242, 0, 18, 68, 2606 }, // P
-    { 17, 25, 297, 1, 19, 107, 2674 }, // Q
-    { 17, 18, 262, 0, 18, 77, 2781 }, // R
-    { 12, 20, 218, 1, 19, 60, 2858 }, // S
-    { 15, 18, 245, 0, 18, 68, 2918 }, // T
-    { 18, 19, 287, 0, 18, 86, 2986 }, // U
-    { 17, 18, 270, 0, 18, 77, 3072 }, // V
-    { 26, 18, 419, 0, 18, 117, 3149 }, // W
-    { 17, 18, 264, 0, 18, 77, 3266 }, // X
-    { 17, 18, 250, -1, 18, 77, 3343 }, // Y
-    { 14, 18, 237, 0, 18, 63, 3420 }, // Z
-    { 7, 23, 144, 2, 19, 41, 3483 }, // [
-    { 8, 23, 115, 0, 19, 46, 3524 }, // <backslash>
-    { 7, 23, 144, 0, 19, 41, 3570 }, // ]
-    { 12, 12, 224, 1, 18, 36, 3611 }, // ^
-    { 13, 2, 184, -1, -2, 7, 3647 }, // _
-    { 5, 5, 110, 1, 20, 7, 3654 }, // `
-    { 12, 15, 225, 1, 14, 45, 3661 }, // a
-    { 14, 20, 246, 0, 19, 70, 3706 }, // b
-    { 11, 15, 197, 1, 14, 42, 3776 }, // c
-    { 14, 20, 246, 1, 19, 70, 3818 }, // d
-    { 12, 15, 214, 1, 14, 45, 3888 }, // e
-    { 11, 20, 148, 0, 20, 55, 3933 }, // f
-    { 14, 21, 215, 0, 15, 74, 3988 }, // g
-    { 16, 19, 254, 0, 19, 76, 4062 }, // h
-    { 8, 19, 128, 0, 19, 38, 4138 }, // i
-    { 7, 25, 120, -1, 19, 44, 4176 }, // j
-    { 15, 19, 234, 0, 19, 72, 4220 }, // k
-    { 8, 19, 124, 0, 19, 38, 4292 }, // l
-    { 23, 14, 378, 0, 14, 81, 4330 }, // m
-    { 16, 14, 258, 0, 14, 56, 4411 }, // n
-    { 13, 15, 231, 1, 14, 49, 4467 }, // o
-    { 14, 20, 246, 0, 14, 70, 4516 }, // p
-    { 14, 20, 246, 1, 14, 70, 4586 }, // q
-    { 12, 14, 188, 0, 14, 42, 4656 }, // r
-    { 10, 15, 180, 1, 14, 38, 4698 }, // s
-    { 9, 18, 141, 0, 17, 41, 4736 }, // t
-    { 16, 15, 254, 0, 14, 60, 4777 }, // u
-    { 15, 14, 232, 0, 14, 53, 4837 }, // v
-    { 22, 14, 345, 0, 14, 77, 4890 }, // w
-    { 15, 14, 231, 0, 14, 53, 4967 }, // x
-    { 15, 20, 226, 0, 14, 75, 5020 }, // y
-    { 11, 14, 204, 1, 14, 39, 5095 }, // z
-    { 9, 23, 171, 1, 19, 52, 5134 }, // {
-    { 2, 25, 224, 6, 19, 13, 5186 }, // |
-    { 9, 23, 171, 1, 19, 52, 5199 }, // }
-    { 12, 6, 224, 1, 12, 18, 5251 }, // ~
+    { 8, 7, 163, 1, 18, 14, 0 }, // "
+    { 14, 18, 224, 0, 18, 63, 14 }, // #
+    { 12, 21, 224, 1, 19, 63, 77 }, // $
+    { 21, 20, 358, 1, 19, 105, 140 }, // %
+    { 19, 20, 297, 0, 19, 95, 245 }, // &
+    { 4, 7, 88, 1, 18, 7, 340 }, // '
+    { 7, 23, 138, 1, 19, 41, 19 }, // (
+    { 8, 23, 138, 0, 19, 46, 60 }, // )
+    { 11, 10, 200, 1, 19, 28, 347 }, // *
+    { 12, 12, 224, 1, 15, 36, 375 }, // +
+    { 5, 8, 100, 0, 4, 10, 106 }, // ,
+    { 8, 3, 124, 0, 8, 6, 116 }, // -
+    { 4, 5, 100, 1, 4, 5, 122 }, // .
+    { 8, 23, 115, 0, 19, 46, 411 }, // /
+    { 13, 20, 232, 1, 19, 65, 127 }, // 0
+    { 11, 18, 184, 0, 18, 50, 192 }, // 1
+    { 12, 19, 198, 0, 19, 57, 242 }, // 2
+    { 12, 20, 204, 0, 19, 60, 299 }, // 3
+    { 14, 18, 221, 0, 18, 63, 359 }, // 4
+    { 11, 19, 204, 1, 18, 53, 422 }, // 5
+    { 12, 20, 220, 1, 19, 60, 475 }, // 6
+    { 12, 18, 206, 1, 18, 54, 535 }, // 7
+    { 12, 20, 223, 1, 19, 60, 589 }, // 8
+    { 12, 20, 220, 1, 19, 60, 649 }, // 9
+    { 4, 15, 114, 2, 14, 15, 709 }, // :
+    { 5, 18, 114, 1, 14, 23, 724 }, // ;
+    { 12, 14, 224, 1, 16, 42, 457 }, // <
+    { 12, 8, 224, 1, 13, 24, 499 }, // =
+    { 12, 14, 224, 1, 16, 42, 523 }, // >
+    { 11, 20, 190, 0, 19, 55, 747 }, // ?
+    { 21, 22, 368, 1, 18, 116, 565 }, // @
+    { 18, 18, 282, 0, 18, 81, 802 }, // A
+    { 15, 18, 262, 0, 18, 68, 883 }, // B
+    { 14, 20, 246, 1, 19, 70, 951 }, // C
+    { 17, 18, 291, 0, 18, 77, 1021 }, // D
+    { 15, 18, 249, 0, 18, 68, 1098 }, // E
+    { 14, 18, 236, 0, 18, 63, 1166 }, // F
+    { 17, 20, 286, 1, 19, 85, 1229 }, // G
+    { 19, 18, 317, 0, 18, 86, 1314 }, // H
+    { 9, 18, 147, 0, 18, 41, 1400 }, // I
+    { 10, 24, 143, -1, 18, 60, 1441 }, // J
+    { 18, 18, 280, 0, 18, 81, 1501 }, // K
+    { 15, 18, 249, 0, 18, 68, 1582 }, // L
+    { 23, 18, 375, 0, 18, 104, 1650 }, // M
+    { 19, 18, 305, 0, 18, 86, 1754 }, // N
+    { 17, 20, 297, 1, 19, 85, 1840 }, // O
+    { 15, 18, 242, 0, 18, 68, 1925 }, // P
+    { 17, 25, 297, 1, 19, 107, 1993 }, // Q
+    { 17, 18, 262, 0, 18, 77, 2100 }, // R
+    { 12, 20, 218, 1, 19, 60, 2177 }, // S
+    { 15, 18, 245, 0, 18, 68, 2237 }, // T
+    { 18, 19, 287, 0, 18, 86, 681 }, // U
+    { 17, 18, 270, 0, 18, 77, 2305 }, // V
+    { 26, 18, 419, 0, 18, 117, 2382 }, // W
+    { 17, 18, 264, 0, 18, 77, 2499 }, // X
+    { 17, 18, 250, -1, 18, 77, 2576 }, // Y
+    { 14, 18, 237, 0, 18, 63, 2653 }, // Z
+    { 7, 23, 144, 2, 19, 41, 767 }, // [
+    { 8, 23, 115, 0, 19, 46, 808 }, // <backslash>
+    { 7, 23, 144, 0, 19, 41, 854 }, // ]
+    { 12, 12, 224, 1, 18, 36, 895 }, // ^
+    { 13, 2, 184, -1, -2, 7, 931 }, // _
+    { 5, 5, 110, 1, 20, 7, 938 }, // `
+    { 12, 15, 225, 1, 14, 45, 2716 }, // a
+    { 14, 20, 246, 0, 19, 70, 2761 }, // b
+    { 11, 15, 197, 1, 14, 42, 2831 }, // c
+    { 14, 20, 246, 1, 19, 70, 2873 }, // d
+    { 12, 15, 214, 1, 14, 45, 2943 }, // e
+    { 11, 20, 148, 0, 20, 55, 2988 }, // f
+    { 14, 21, 215, 0, 15, 74, 3043 }, // g
+    { 16, 19, 254, 0, 19, 76, 3117 }, // h
+    { 8, 19, 128, 0, 19, 38, 3193 }, // i
+    { 7, 25, 120, -1, 19, 44, 3231 }, // j
+    { 15, 19, 234, 0, 19, 72, 3275 }, // k
+    { 8, 19, 124, 0, 19, 38, 3347 }, // l
+    { 23, 14, 378, 0, 14, 81, 3385 }, // m
+    { 16, 14, 258, 0, 14, 56, 3466 }, // n
+    { 13, 15, 231, 1, 14, 49, 3522 }, // o
+    { 14, 20, 246, 0, 14, 70, 3571 }, // p
+    { 14, 20, 246, 1, 14, 70, 3641 }, // q
+    { 12, 14, 188, 0, 14, 42, 3711 }, // r
+    { 10, 15, 180, 1, 14, 38, 3753 }, // s
+    { 9, 18, 141, 0, 17, 41, 3791 }, // t
+    { 16, 15, 254, 0, 14, 60, 3832 }, // u
+    { 15, 14, 232, 0, 14, 53, 3892 }, // v
+    { 22, 14, 345, 0, 14, 77, 3945 }, // w
+    { 15, 14, 231, 0, 14, 53, 4022 }, // x
+    { 15, 20, 226, 0, 14, 75, 4075 }, // y
+    { 11, 14, 204, 1, 14, 39, 4150 }, // z
+    { 9, 23, 171, 1, 19, 52, 945 }, // {
+    { 2, 25, 224, 6, 19, 13, 997 }, // |
+    { 9, 23, 171, 1, 19, 52, 1010 }, // }
+    { 12, 6, 224, 1, 12, 18, 1062 }, // ~
     { 0, 0, 104, 0, 0, 0, 0 }, // U+00A0
     { 4, 19, 133, 2, 14, 19, 0 }, // U+00A1
     { 12, 18, 224, 1, 18, 54, 19 }, // U+00A2
@@ -1849,19 +1852,19 @@ static const EpdGlyph notoserif_12_regularGlyphs[] = {
     { 13, 21, 231, 1, 20, 69, 5158 }, // U+00F0
     { 16, 19, 258, 0, 19, 76, 5227 }, // U+00F1
     { 13, 21, 231, 1, 20, 69, 5303 }, // U+00F2
-    { 13, 21, 231, 1, 20, 69, 5372 }, // U+00F3
-    { 13, 21, 231, 1, 20, 69, 5441 }, // U+00F4
-    { 13, 20, 231, 1, 19, 65, 5510 }, // U+00F5
-    { 13, 20, 231, 1, 19, 65, 5575 }, // U+00F6
-    { 12, 14, 224, 1, 16, 42, 5640 }, // U+00F7
-    { 13, 16, 231, 1, 15, 52, 5682 }, // U+00F8
-    { 16, 21, 254, 0, 20, 84, 5734 }, // U+00F9
-    { 16, 21, 254, 0, 20, 84, 5818 }, // U+00FA
-    { 16, 21, 254, 0, 20, 84, 5902 }, // U+00FB
-    { 16, 20, 254, 0, 19, 80, 5986 }, // U+00FC
-    { 15, 26, 226, 0, 20, 98, 6066 }, // U+00FD
-    { 14, 25, 246, 0, 19, 88, 6164 }, // U+00FE
-    { 15, 25, 226, 0, 19, 94, 6252 }, // U+00FF
+    { 13, 21, 231, 1, 20, 69, 4189 }, // U+00F3
+    { 13, 21, 231, 1, 20, 69, 5372 }, // U+00F4
+    { 13, 20, 231, 1, 19, 65, 5441 }, // U+00F5
+    { 13, 20, 231, 1, 19, 65, 5506 }, // U+00F6
+    { 12, 14, 224, 1, 16, 42, 5571 }, // U+00F7
+    { 13, 16, 231, 1, 15, 52, 5613 }, // U+00F8
+    { 16, 21, 254, 0, 20, 84, 5665 }, // U+00F9
+    { 16, 21, 254, 0, 20, 84, 5749 }, // U+00FA
+    { 16, 21, 254, 0, 20, 84, 5833 }, // U+00FB
+    { 16, 20, 254, 0, 19, 80, 5917 }, // U+00FC
+    { 15, 26, 226, 0, 20, 98, 5997 }, // U+00FD
+    { 14, 25, 246, 0, 19, 88, 6095 }, // U+00FE
+    { 15, 25, 226, 0, 19, 94, 6183 }, // U+00FF
     { 18, 21, 282, 0, 21, 95, 0 }, // U+0100
     { 12, 18, 225, 1, 17, 54, 95 }, // U+0101
     { 18, 23, 282, 0, 23, 104, 149 }, // U+0102
@@ -2563,98 +2566,98 @@ static const EpdGlyph notoserif_12_regularGlyphs[] = {
     { 8, 3, 124, 0, 8, 6, 121 }, // U+2010
     { 8, 3, 124, 0, 8, 6, 127 }, // U+2011
     { 12, 2, 224, 1, 10, 6, 133 }, // U+2012
-    { 14, 3, 200, -1, 8, 11, 139 }, // U+2013
-    { 27, 3, 400, -1, 8, 21, 150 }, // U+2014
-    { 27, 3, 400, -1, 8, 21, 171 }, // U+2015
-    { 6, 25, 224, 4, 19, 38, 192 }, // U+2016
-    { 12, 6, 164, -1, 0, 18, 230 }, // U+2017
-    { 5, 8, 100, 1, 18, 10, 248 }, // U+2018
-    { 5, 8, 100, 0, 18, 10, 258 }, // U+2019
-    { 5, 8, 100, 0, 4, 10, 268 }, // U+201A
-    { 5, 8, 100, 1, 18, 10, 278 }, // U+201B
-    { 10, 8, 180, 1, 18, 20, 288 }, // U+201C
-    { 10, 8, 180, 0, 18, 20, 308 }, // U+201D
-    { 10, 8, 180, 0, 4, 20, 328 }, // U+201E
-    { 10, 8, 180, 1, 18, 20, 348 }, // U+201F
-    { 11, 22, 179, 0, 19, 61, 368 }, // U+2020
-    { 11, 22, 179, 0, 19, 61, 429 }, // U+2021
-    { 7, 8, 145, 1, 13, 14, 490 }, // U+2022
-    { 9, 9, 200, 2, 13, 21, 504 }, // U+2023
-    { 4, 4, 100, 1, 11, 4, 525 }, // U+2024
-    { 11, 4, 214, 1, 11, 11, 529 }, // U+2025
-    { 18, 5, 343, 2, 4, 23, 540 }, // U+2026
-    { 4, 5, 100, 1, 10, 5, 563 }, // U+2027
-    { 0, 0, 240, 0, 0, 0, 568 }, // U+2028
-    { 0, 0, 240, 0, 0, 0, 568 }, // U+2029
-    { 7, 20, 0, -1, 16, 35, 568 }, // U+202A
-    { 7, 20, 0, -6, 16, 35, 603 }, // U+202B
-    { 6, 22, 0, -3, 18, 33, 638 }, // U+202C
-    { 6, 22, 0, -3, 18, 33, 671 }, // U+202D
-    { 6, 22, 0, -3, 18, 33, 704 }, // U+202E
-    { 0, 0, 66, 0, 0, 0, 737 }, // U+202F
-    { 31, 20, 516, 1, 19, 155, 737 }, // U+2030
-    { 41, 20, 674, 1, 19, 205, 892 }, // U+2031
-    { 5, 7, 75, 0, 18, 9, 1097 }, // U+2032
-    { 9, 7, 150, 0, 18, 16, 1106 }, // U+2033
-    { 14, 7, 226, 0, 18, 25, 1122 }, // U+2034
-    { 5, 7, 75, 0, 18, 9, 1147 }, // U+2035
-    { 9, 7, 150, 0, 18, 16, 1156 }, // U+2036
-    { 14, 7, 226, 0, 18, 25, 1172 }, // U+2037
-    { 8, 8, 160, 1, 2, 16, 1197 }, // U+2038
-    { 6, 10, 133, 1, 12, 15, 1213 }, // U+2039
-    { 6, 10, 133, 1, 12, 15, 1228 }, // U+203A
-    { 18, 18, 328, 1, 18, 81, 1243 }, // U+203B
-    { 10, 19, 224, 2, 18, 48, 1324 }, // U+203C
-    { 12, 20, 216, 1, 19, 60, 1372 }, // U+203D
-    { 13, 2, 184, -1, 21, 7, 1432 }, // U+203E
-    { 20, 6, 0, -10, 0, 30, 1439 }, // U+203F
-    { 20, 5, 0, -10, 21, 25, 1469 }, // U+2040
-    { 12, 18, 180, 0, 18, 54, 1494 }, // U+2041
-    { 23, 19, 400, 1, 19, 110, 1548 }, // U+2042
-    { 7, 5, 145, 1, 11, 9, 1658 }, // U+2043
-    { 12, 18, 25, -5, 18, 54, 1667 }, // U+2044
-    { 7, 23, 144, 2, 19, 41, 1721 }, // U+2045
-    { 7, 23, 144, 0, 19, 41, 1762 }, // U+2046
-    { 23, 20, 382, 0, 19, 115, 1803 }, // U+2047
-    { 17, 20, 307, 0, 19, 85, 1918 }, // U+2048
-    { 17, 20, 304, 2, 19, 85, 2003 }, // U+2049
-    { 12, 20, 224, 1, 15, 60, 2088 }, // U+204A
-    { 14, 22, 247, 1, 19, 77, 2148 }, // U+204B
-    { 13, 10, 239, 1, 14, 33, 2225 }, // U+204C
-    { 13, 10, 239, 1, 14, 33, 2258 }, // U+204D
-    { 11, 10, 200, 1, 14, 28, 2291 }, // U+204E
-    { 5, 18, 114, 1, 14, 23, 2319 }, // U+204F
-    { 17, 20, 292, 1, 19, 85, 2342 }, // U+2050
-    { 11, 21, 200, 1, 19, 58, 2427 }, // U+2051
-    { 8, 19, 132, 0, 18, 38, 2485 }, // U+2052
-    { 12, 6, 224, 1, 12, 18, 2523 }, // U+2053
-    { 20, 6, 0, -10, 0, 30, 2541 }, // U+2054
-    { 12, 12, 216, 1, 15, 36, 2571 }, // U+2055
-    { 12, 15, 246, 2, 14, 45, 2607 }, // U+2056
-    { 17, 7, 277, 0, 18, 30, 2652 }, // U+2057
-    { 14, 15, 284, 2, 14, 53, 2682 }, // U+2058
-    { 14, 15, 284, 2, 14, 53, 2735 }, // U+2059
-    { 4, 20, 115, 2, 19, 20, 2788 }, // U+205A
-    { 14, 20, 284, 2, 19, 70, 2808 }, // U+205B
-    { 14, 14, 279, 2, 14, 49, 2878 }, // U+205C
-    { 4, 20, 115, 2, 19, 20, 2927 }, // U+205D
-    { 4, 20, 115, 2, 19, 20, 2947 }, // U+205E
-    { 0, 0, 89, 0, 0, 0, 2967 }, // U+205F
-    { 0, 0, 240, 0, 0, 0, 2967 }, // U+2060
-    { 0, 0, 240, 0, 0, 0, 2967 }, // U+2061
-    { 0, 0, 240, 0, 0, 0, 2967 }, // U+2062
-    { 0, 0, 240, 0, 0, 0, 2967 }, // U+2063
-    { 0, 0, 240, 0, 0, 0, 2967 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 2967 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 2967 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 2967 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 2967 }, // U+2069
-    { 6, 22, 0, -3, 18, 33, 2967 }, // U+206A
-    { 6, 22, 0, -3, 18, 33, 3000 }, // U+206B
-    { 6, 22, 0, -3, 18, 33, 3033 }, // U+206C
-    { 6, 22, 0, -3, 18, 33, 3066 }, // U+206D
-    { 6, 22, 0, -3, 18, 33, 3099 }, // U+206E
-    { 6, 22, 0, -3, 18, 33, 3132 }, // U+206F
+    { 14, 3, 200, -1, 8, 11, 4258 }, // U+2013
+    { 27, 3, 400, -1, 8, 21, 4269 }, // U+2014
+    { 27, 3, 400, -1, 8, 21, 139 }, // U+2015
+    { 6, 25, 224, 4, 19, 38, 160 }, // U+2016
+    { 12, 6, 164, -1, 0, 18, 198 }, // U+2017
+    { 5, 8, 100, 1, 18, 10, 216 }, // U+2018
+    { 5, 8, 100, 0, 18, 10, 4290 }, // U+2019
+    { 5, 8, 100, 0, 4, 10, 226 }, // U+201A
+    { 5, 8, 100, 1, 18, 10, 236 }, // U+201B
+    { 10, 8, 180, 1, 18, 20, 4300 }, // U+201C
+    { 10, 8, 180, 0, 18, 20, 4320 }, // U+201D
+    { 10, 8, 180, 0, 4, 20, 246 }, // U+201E
+    { 10, 8, 180, 1, 18, 20, 266 }, // U+201F
+    { 11, 22, 179, 0, 19, 61, 286 }, // U+2020
+    { 11, 22, 179, 0, 19, 61, 347 }, // U+2021
+    { 7, 8, 145, 1, 13, 14, 408 }, // U+2022
+    { 9, 9, 200, 2, 13, 21, 422 }, // U+2023
+    { 4, 4, 100, 1, 11, 4, 443 }, // U+2024
+    { 11, 4, 214, 1, 11, 11, 447 }, // U+2025
+    { 18, 5, 343, 2, 4, 23, 4340 }, // U+2026
+    { 4, 5, 100, 1, 10, 5, 458 }, // U+2027
+    { 0, 0, 240, 0, 0, 0, 463 }, // U+2028
+    { 0, 0, 240, 0, 0, 0, 463 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 463 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 498 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 533 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 566 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 599 }, // U+202E
+    { 0, 0, 66, 0, 0, 0, 632 }, // U+202F
+    { 31, 20, 516, 1, 19, 155, 632 }, // U+2030
+    { 41, 20, 674, 1, 19, 205, 787 }, // U+2031
+    { 5, 7, 75, 0, 18, 9, 992 }, // U+2032
+    { 9, 7, 150, 0, 18, 16, 1001 }, // U+2033
+    { 14, 7, 226, 0, 18, 25, 1017 }, // U+2034
+    { 5, 7, 75, 0, 18, 9, 1042 }, // U+2035
+    { 9, 7, 150, 0, 18, 16, 1051 }, // U+2036
+    { 14, 7, 226, 0, 18, 25, 1067 }, // U+2037
+    { 8, 8, 160, 1, 2, 16, 1092 }, // U+2038
+    { 6, 10, 133, 1, 12, 15, 1108 }, // U+2039
+    { 6, 10, 133, 1, 12, 15, 1123 }, // U+203A
+    { 18, 18, 328, 1, 18, 81, 1138 }, // U+203B
+    { 10, 19, 224, 2, 18, 48, 1219 }, // U+203C
+    { 12, 20, 216, 1, 19, 60, 1267 }, // U+203D
+    { 13, 2, 184, -1, 21, 7, 1327 }, // U+203E
+    { 20, 6, 0, -10, 0, 30, 1334 }, // U+203F
+    { 20, 5, 0, -10, 21, 25, 1364 }, // U+2040
+    { 12, 18, 180, 0, 18, 54, 1389 }, // U+2041
+    { 23, 19, 400, 1, 19, 110, 1443 }, // U+2042
+    { 7, 5, 145, 1, 11, 9, 1553 }, // U+2043
+    { 12, 18, 25, -5, 18, 54, 1562 }, // U+2044
+    { 7, 23, 144, 2, 19, 41, 1616 }, // U+2045
+    { 7, 23, 144, 0, 19, 41, 1657 }, // U+2046
+    { 23, 20, 382, 0, 19, 115, 1698 }, // U+2047
+    { 17, 20, 307, 0, 19, 85, 1813 }, // U+2048
+    { 17, 20, 304, 2, 19, 85, 1898 }, // U+2049
+    { 12, 20, 224, 1, 15, 60, 1983 }, // U+204A
+    { 14, 22, 247, 1, 19, 77, 2043 }, // U+204B
+    { 13, 10, 239, 1, 14, 33, 2120 }, // U+204C
+    { 13, 10, 239, 1, 14, 33, 2153 }, // U+204D
+    { 11, 10, 200, 1, 14, 28, 2186 }, // U+204E
+    { 5, 18, 114, 1, 14, 23, 2214 }, // U+204F
+    { 17, 20, 292, 1, 19, 85, 2237 }, // U+2050
+    { 11, 21, 200, 1, 19, 58, 2322 }, // U+2051
+    { 8, 19, 132, 0, 18, 38, 2380 }, // U+2052
+    { 12, 6, 224, 1, 12, 18, 2418 }, // U+2053
+    { 20, 6, 0, -10, 0, 30, 2436 }, // U+2054
+    { 12, 12, 216, 1, 15, 36, 2466 }, // U+2055
+    { 12, 15, 246, 2, 14, 45, 2502 }, // U+2056
+    { 17, 7, 277, 0, 18, 30, 2547 }, // U+2057
+    { 14, 15, 284, 2, 14, 53, 2577 }, // U+2058
+    { 14, 15, 284, 2, 14, 53, 2630 }, // U+2059
+    { 4, 20, 115, 2, 19, 20, 2683 }, // U+205A
+    { 14, 20, 284, 2, 19, 70, 2703 }, // U+205B
+    { 14, 14, 279, 2, 14, 49, 2773 }, // U+205C
+    { 4, 20, 115, 2, 19, 20, 2822 }, // U+205D
+    { 4, 20, 115, 2, 19, 20, 2842 }, // U+205E
+    { 0, 0, 89, 0, 0, 0, 2862 }, // U+205F
+    { 0, 0, 240, 0, 0, 0, 2862 }, // U+2060
+    { 0, 0, 240, 0, 0, 0, 2862 }, // U+2061
+    { 0, 0, 240, 0, 0, 0, 2862 }, // U+2062
+    { 0, 0, 240, 0, 0, 0, 2862 }, // U+2063
+    { 0, 0, 240, 0, 0, 0, 2862 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 2862 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 2862 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 2862 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 2862 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 2862 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 2895 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 2928 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 2961 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 2994 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 3027 }, // U+206F
     { 10, 12, 160, 0, 21, 30, 0 }, // U+2070
     { 5, 12, 83, 0, 19, 15, 30 }, // U+2071
     { 10, 12, 160, 0, 21, 30, 45 }, // U+2074
@@ -2731,13 +2734,13 @@ static const EpdGlyph notoserif_12_regularGlyphs[] = {
     { 12, 22, 224, 1, 20, 66, 2484 }, // U+20BF
     { 11, 18, 197, 1, 14, 50, 2550 }, // U+20C0
     { 12, 3, 232, 1, 10, 9, 0 }, // U+2212
-    { 20, 20, 283, 0, 20, 100, 0 }, // U+FB00
-    { 17, 20, 265, 0, 20, 85, 100 }, // U+FB01
-    { 17, 20, 265, 0, 20, 85, 185 }, // U+FB02
-    { 25, 20, 401, 0, 20, 125, 270 }, // U+FB03
-    { 25, 20, 400, 0, 20, 125, 395 }, // U+FB04
-    { 17, 21, 267, 0, 20, 90, 520 }, // U+FB05
-    { 19, 21, 316, 1, 20, 100, 610 }, // U+FB06
+    { 20, 20, 283, 0, 20, 100, 4363 }, // U+FB00
+    { 17, 20, 265, 0, 20, 85, 4463 }, // U+FB01
+    { 17, 20, 265, 0, 20, 85, 4548 }, // U+FB02
+    { 25, 20, 401, 0, 20, 125, 4633 }, // U+FB03
+    { 25, 20, 400, 0, 20, 125, 4758 }, // U+FB04
+    { 17, 21, 267, 0, 20, 90, 0 }, // U+FB05
+    { 19, 21, 316, 1, 20, 100, 90 }, // U+FB06
     { 23, 23, 400, 1, 19, 133, 0 }, // U+FFFD
 };
 
@@ -2745,8 +2748,7 @@ static const EpdUnicodeInterval notoserif_12_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -2754,8 +2756,7 @@ static const EpdUnicodeInterval notoserif_12_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -2765,19 +2766,57 @@ static const EpdUnicodeInterval notoserif_12_regularIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_12_regularGroups[] = {
-    { 0, 2869, 5794, 97, 0 },
-    { 2869, 2503, 6973, 96, 97 },
-    { 5372, 3039, 11027, 128, 193 },
-    { 8411, 3058, 9864, 96, 321 },
-    { 11469, 975, 1451, 112, 417 },
-    { 12444, 8025, 22429, 256, 529 },
-    { 20469, 1774, 9086, 90, 785 },
-    { 22243, 1604, 3600, 111, 875 },
-    { 23847, 564, 1137, 42, 986 },
-    { 24411, 1677, 2883, 33, 1028 },
-    { 26088, 11, 9, 1, 1061 },
-    { 26099, 307, 790, 7, 1062 },
-    { 26406, 98, 138, 1, 1069 },
+    { 0, 2510, 5384, 83, 2 },
+    { 2510, 645, 1196, 26, 0 },
+    { 3155, 2494, 6889, 95, 97 },
+    { 5649, 3039, 11027, 128, 193 },
+    { 8688, 3058, 9864, 96, 321 },
+    { 11746, 975, 1451, 112, 417 },
+    { 12721, 8025, 22429, 256, 529 },
+    { 20746, 1774, 9086, 90, 785 },
+    { 22520, 1544, 3478, 105, 875 },
+    { 24064, 564, 1137, 42, 986 },
+    { 24628, 1677, 2883, 33, 1028 },
+    { 26305, 11, 9, 1, 1061 },
+    { 26316, 134, 210, 2, 1067 },
+    { 26450, 98, 138, 1, 1069 },
+};
+
+static const uint16_t notoserif_12_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_12_regularKernLeftClasses[] = {
@@ -3696,18 +3735,81 @@ static const EpdLigaturePair notoserif_12_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_12_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 0 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_12_regular = {
     notoserif_12_regularBitmaps,
     notoserif_12_regularGlyphs,
     notoserif_12_regularIntervals,
-    20,
+    18,
     34,
     27,
     -8,
     true,
     notoserif_12_regularGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_12_regularGlyphToGroup,
     notoserif_12_regularKernLeftClasses,
     notoserif_12_regularKernRightClasses,
     notoserif_12_regularKernMatrix,
@@ -3717,4 +3819,8 @@ static const EpdFontData notoserif_12_regular = {
     65,
     notoserif_12_regularLigaturePairs,
     5,
+    notoserif_12_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2192 +3,2195 @@
  * name: notoserif_14_bold
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_14_bold 14 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_14_bold 14 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_14_boldBitmaps[34866] = {
-    0xC5, 0x59, 0x4D, 0x8C, 0xDD, 0xD6, 0x75, 0x3E, 0x24, 0x2D, 0xD1, 0x35, 0x17, 0xF4, 0x42, 0x86,
-    0x81, 0x08, 0x10, 0xB3, 0x1E, 0x55, 0xC3, 0x2E, 0xBA, 0xC8, 0x62, 0x46, 0xA4, 0x2A, 0xA0, 0x5D,
-    0x46, 0x8B, 0x0C, 0xB2, 0xE8, 0xC2, 0xD9, 0xD6, 0x28, 0x30, 0x5B, 0x15, 0x18, 0x99, 0x74, 0x0B,
-    0xD4, 0xCB, 0xCC, 0xC6, 0x6B, 0x0F, 0x02, 0x2F, 0x9C, 0x17, 0x14, 0xCE, 0x42, 0x05, 0xA6, 0x80,
-    0x5D, 0x5E, 0xC5, 0x08, 0xBC, 0xF0, 0x22, 0x4C, 0x8D, 0x34, 0xCB, 0xD0, 0x88, 0x0A, 0x37, 0x36,
-    0x50, 0xB1, 0x0E, 0x5D, 0x73, 0x2C, 0x3E, 0x9E, 0x7E, 0xDF, 0x21, 0x39, 0x6F, 0xA4, 0x58, 0xB2,
-    0x94, 0x04, 0xC8, 0x1B, 0xDE, 0x73, 0xDF, 0x90, 0x97, 0xF7, 0x9E, 0x7B, 0x7E, 0xBE, 0x73, 0xCE,
-    0x7D, 0xEA, 0xD4, 0x55, 0xF8, 0x2B, 0x4A, 0xFC, 0xE5, 0x59, 0x9E, 0x09, 0xFF, 0x52, 0xFC, 0x6D,
-    0xCB, 0x33, 0x22, 0x72, 0x4E, 0x8A, 0x92, 0x23, 0x8A, 0x5C, 0x24, 0xFB, 0xF9, 0x88, 0x2B, 0xBD,
-    0x33, 0xA6, 0x6E, 0x9D, 0xB8, 0x21, 0x2E, 0x87, 0x38, 0x7F, 0x27, 0xCE, 0x6F, 0x62, 0x98, 0x44,
-    0xD7, 0x1A, 0x89, 0xD9, 0xFC, 0x5A, 0xE2, 0xC0, 0xC9, 0x25, 0xB4, 0xED, 0xD0, 0xC5, 0xAA, 0x23,
-    0x9B, 0xEC, 0xC4, 0xB9, 0x1C, 0xC4, 0x22, 0x37, 0xD1, 0x6E, 0x5F, 0x12, 0x69, 0xB7, 0x25, 0x53,
-    0xED, 0xD9, 0xFC, 0xE6, 0x40, 0xFC, 0xFA, 0x40, 0x82, 0xFA, 0x58, 0x02, 0x77, 0x1B, 0xAD, 0x95,
-    0xB0, 0x6C, 0xC5, 0x3E, 0xE1, 0xDC, 0x8A, 0x13, 0x09, 0x54, 0xCB, 0xF8, 0xFD, 0xD4, 0xA5, 0xAF,
-    0xC5, 0x2E, 0x7B, 0x2D, 0xCE, 0xB3, 0xF7, 0x45, 0xD2, 0xFB, 0x22, 0xB1, 0xE6, 0x12, 0x6A, 0x27,
-    0x9E, 0xAA, 0x48, 0xA2, 0x0E, 0xFF, 0x34, 0xCF, 0x86, 0x49, 0xBB, 0x1B, 0x46, 0xED, 0x2B, 0x68,
-    0x45, 0x18, 0xD7, 0x19, 0xDE, 0x8B, 0xC1, 0x86, 0xF7, 0xF6, 0xE1, 0x66, 0x4E, 0x36, 0x4F, 0x96,
-    0x8F, 0xA7, 0xA5, 0xEC, 0x60, 0x23, 0x1F, 0xB7, 0x72, 0x8C, 0x79, 0xEE, 0xF4, 0x02, 0x16, 0xD2,
-    0x72, 0xF0, 0x1B, 0xEC, 0x3C, 0x5F, 0x63, 0x3F, 0xEC, 0xA2, 0xD2, 0xBA, 0x38, 0xB7, 0x2E, 0x11,
-    0xEB, 0x76, 0xCF, 0x1F, 0x71, 0xE4, 0x41, 0x31, 0x4A, 0x7C, 0xA7, 0xEF, 0x86, 0x34, 0x0F, 0xEF,
-    0x7F, 0xF4, 0x59, 0x1F, 0x3B, 0xF9, 0xF7, 0xEB, 0x1F, 0x76, 0xE8, 0x24, 0x7C, 0xAF, 0x8B, 0x6B,
-    0xB0, 0x7A, 0xBD, 0x65, 0x97, 0x04, 0xD6, 0xED, 0x06, 0x76, 0xF3, 0xC0, 0xB7, 0x21, 0x9D, 0xD7,
-    0x27, 0xA5, 0x78, 0xAD, 0xAC, 0x33, 0x91, 0xA0, 0x91, 0x74, 0x98, 0xD8, 0xCA, 0x17, 0x06, 0x13,
-    0xE5, 0x57, 0x7D, 0x1B, 0xFC, 0x78, 0xEB, 0xA0, 0xC3, 0xA0, 0x21, 0xE8, 0x4F, 0xA9, 0xDD, 0xF1,
-    0x34, 0x6A, 0x6D, 0x8C, 0xA3, 0xC8, 0xD6, 0xDE, 0x5E, 0x2E, 0x45, 0x1F, 0xA8, 0x0B, 0x74, 0x8D,
-    0x41, 0xC9, 0x67, 0x7A, 0xBD, 0x95, 0xCC, 0x55, 0x1F, 0xD6, 0x52, 0xB9, 0xEC, 0xBE, 0x93, 0xAA,
-    0x8C, 0x21, 0x2F, 0x2D, 0x03, 0x4C, 0x5D, 0xE1, 0x4B, 0x2D, 0x05, 0x6E, 0x62, 0x4C, 0xEB, 0xEB,
-    0x00, 0xC1, 0x56, 0xEF, 0xEB, 0x91, 0xA7, 0xA3, 0xA7, 0xED, 0xC4, 0x47, 0x56, 0x67, 0x35, 0x14,
-    0xE0, 0x12, 0x17, 0x97, 0x71, 0x1E, 0x1B, 0x6B, 0xCF, 0x93, 0x67, 0xEC, 0xA3, 0xC8, 0xBD, 0x11,
-    0xCC, 0x48, 0xD4, 0x49, 0xDC, 0x4A, 0x8A, 0x49, 0x1A, 0xBB, 0xF0, 0xE4, 0xCC, 0x85, 0x7F, 0x71,
-    0x13, 0x4F, 0x13, 0xBC, 0xD4, 0x49, 0xD8, 0x8B, 0x8F, 0x7D, 0x42, 0x71, 0x29, 0xF4, 0x86, 0x9D,
-    0x7D, 0xCF, 0x66, 0x94, 0x5D, 0x8A, 0x5E, 0xB0, 0x99, 0x60, 0x7A, 0x0A, 0xFE, 0xC0, 0x59, 0xE6,
-    0x96, 0x49, 0x6D, 0x81, 0xD3, 0x2B, 0x6B, 0x97, 0x95, 0xB8, 0x25, 0x8C, 0xF7, 0xD7, 0x82, 0xFD,
-    0x82, 0x29, 0x88, 0xF2, 0x2F, 0x4F, 0x35, 0xCC, 0xFF, 0x9E, 0xBF, 0x2A, 0xF2, 0xAD, 0x2B, 0x89,
-    0x54, 0x7F, 0x5F, 0x49, 0xA1, 0x63, 0x4E, 0xAD, 0xA7, 0x7A, 0x22, 0xD5, 0xBF, 0x68, 0x7E, 0x0B,
-    0xF7, 0xBF, 0x79, 0xD5, 0xB3, 0x71, 0xF2, 0x02, 0x8D, 0x1A, 0x8D, 0x9B, 0x3C, 0xD3, 0x5E, 0x78,
-    0xE9, 0xF5, 0x1B, 0x30, 0xDA, 0x66, 0xEB, 0xED, 0xD5, 0xE1, 0xC3, 0xCF, 0xD8, 0xCE, 0x81, 0x49,
-    0x48, 0xA9, 0x49, 0xEA, 0xC0, 0x85, 0x2E, 0x85, 0x29, 0xE1, 0x9D, 0x3D, 0x2C, 0x95, 0xE3, 0xDA,
-    0x5A, 0xE1, 0x79, 0x8A, 0xA7, 0x59, 0x93, 0xBA, 0x89, 0xA5, 0xD8, 0x2E, 0xD8, 0xD1, 0xB6, 0x6D,
-    0x1A, 0x06, 0x78, 0x20, 0xB4, 0x3F, 0x28, 0xB3, 0xA5, 0x60, 0x61, 0x7D, 0x41, 0x0D, 0x97, 0x90,
-    0xD0, 0x09, 0x6C, 0x0F, 0x2B, 0x3C, 0x6A, 0xF8, 0xD1, 0xBC, 0xC9, 0xAA, 0xA7, 0xA7, 0x40, 0x07,
-    0x99, 0x4B, 0xC0, 0x46, 0x56, 0xF3, 0x5B, 0xDC, 0x16, 0x2E, 0xEE, 0xD0, 0x7A, 0xB6, 0xEA, 0xA1,
-    0x36, 0xDF, 0xEF, 0x38, 0x8E, 0xE3, 0xF1, 0x5E, 0xC3, 0xB7, 0x82, 0x51, 0x6D, 0x3E, 0xF3, 0x92,
-    0x10, 0x6B, 0xA4, 0xF4, 0xB2, 0x4E, 0x92, 0x7B, 0x9D, 0x14, 0xDF, 0xEF, 0x64, 0x1B, 0x1A, 0x94,
-    0xA7, 0x6E, 0xBD, 0x9C, 0xAF, 0xC6, 0x23, 0xA0, 0x82, 0xB9, 0xB8, 0x57, 0x9D, 0x48, 0x34, 0x6A,
-    0x99, 0x36, 0x10, 0x9B, 0x4B, 0xC9, 0x75, 0x9B, 0x94, 0x49, 0xEB, 0xE5, 0x09, 0xFD, 0x8F, 0xCE,
-    0x07, 0x51, 0x55, 0x90, 0xEE, 0x28, 0x54, 0xAA, 0xC4, 0x8D, 0xD9, 0x86, 0xBC, 0x2B, 0xE2, 0x77,
-    0xB2, 0x13, 0xD5, 0x72, 0x90, 0x94, 0x5E, 0xBF, 0xA0, 0x09, 0xDB, 0xE4, 0xCE, 0x36, 0xAF, 0xC3,
-    0xBC, 0xCD, 0x32, 0x6F, 0x5C, 0x72, 0x4E, 0x36, 0xD8, 0x0A, 0xE7, 0xFC, 0x11, 0x86, 0x02, 0x15,
-    0xC0, 0x04, 0xFE, 0x87, 0x21, 0x91, 0x39, 0x89, 0x86, 0x67, 0xD1, 0x76, 0xD1, 0x32, 0x30, 0x9C,
-    0x95, 0x59, 0x9B, 0xAA, 0xBA, 0x50, 0xD7, 0x44, 0x43, 0xFA, 0x15, 0x16, 0x87, 0xD7, 0xF8, 0x86,
-    0x34, 0x4E, 0x62, 0x18, 0xDD, 0x15, 0xB4, 0x1D, 0xB4, 0xAE, 0x72, 0x5E, 0x53, 0xB9, 0x00, 0x80,
-    0x19, 0x95, 0x90, 0x2C, 0x9C, 0x6A, 0x17, 0xED, 0xD6, 0x5E, 0xF5, 0x8B, 0x4A, 0x55, 0x5F, 0x5E,
-    0xE9, 0x6F, 0x84, 0x8E, 0x66, 0x0D, 0xEF, 0x5E, 0x04, 0x93, 0xA9, 0x8E, 0xA1, 0x6A, 0x8D, 0xD6,
-    0x44, 0x6C, 0xAF, 0x7F, 0xB7, 0x89, 0xC4, 0x6B, 0xA0, 0xE6, 0x1B, 0xF1, 0x64, 0x20, 0x12, 0xBF,
-    0x0C, 0x5B, 0x03, 0x9F, 0xCF, 0xED, 0x29, 0x51, 0x68, 0xDE, 0xC3, 0x2C, 0x4C, 0xF4, 0x57, 0xD0,
-    0xAE, 0x82, 0xFF, 0x2C, 0x2F, 0xEA, 0x44, 0x35, 0x0F, 0x29, 0x82, 0x73, 0xB3, 0x3D, 0xA4, 0x40,
-    0xBD, 0xB1, 0x72, 0x61, 0x17, 0x37, 0x71, 0x13, 0xC1, 0x22, 0x22, 0x97, 0x39, 0xCF, 0xA4, 0xCA,
-    0x9D, 0x54, 0xFF, 0x7C, 0x57, 0xC0, 0x5B, 0x5E, 0xDD, 0x2D, 0xEA, 0x0A, 0xF2, 0x01, 0x24, 0xB0,
-    0x75, 0x45, 0x69, 0xF6, 0x60, 0x36, 0x91, 0xD4, 0x78, 0xB7, 0x4D, 0x69, 0x0F, 0xC0, 0x89, 0xB5,
-    0xD9, 0x43, 0x01, 0xFD, 0x55, 0x53, 0x6B, 0xDE, 0xDD, 0x7B, 0xA9, 0xBE, 0x2D, 0xB1, 0xFB, 0x31,
-    0x14, 0xF3, 0xBC, 0x79, 0x4F, 0x81, 0xC6, 0x71, 0xC3, 0xA4, 0xB3, 0x00, 0xEC, 0x12, 0x99, 0x08,
-    0x77, 0xB4, 0xFC, 0x0C, 0x0B, 0x33, 0xA2, 0xE8, 0x34, 0xCC, 0x9F, 0x87, 0x4D, 0xF6, 0x4B, 0xBD,
-    0x81, 0x13, 0xDA, 0xAE, 0x9B, 0x6C, 0xD7, 0x1A, 0xB8, 0x4F, 0x3B, 0x00, 0xCF, 0x58, 0x40, 0xF4,
-    0x18, 0x5C, 0x8D, 0x12, 0xDE, 0x87, 0x7E, 0xEB, 0xAA, 0xCD, 0xCA, 0xB4, 0xAB, 0x72, 0xD8, 0xB2,
-    0x84, 0x43, 0x95, 0x87, 0x7D, 0x91, 0x47, 0xC6, 0x77, 0x7C, 0x52, 0x39, 0x9F, 0xFA, 0x3D, 0xB7,
-    0x40, 0x7C, 0x23, 0x11, 0xF4, 0x98, 0x36, 0x08, 0x75, 0x90, 0x42, 0x51, 0x26, 0x35, 0xDE, 0x6B,
-    0x34, 0x8F, 0x5B, 0x36, 0xEE, 0xBD, 0x80, 0x9D, 0x64, 0x4D, 0xD1, 0xC6, 0x7A, 0x0F, 0x20, 0xF8,
-    0x6D, 0x32, 0x4D, 0x79, 0xC3, 0xE8, 0x92, 0xFA, 0x59, 0x30, 0xBF, 0x23, 0x0C, 0x92, 0x2A, 0xE9,
-    0xA7, 0x80, 0x3A, 0x00, 0xA6, 0x5C, 0x10, 0xB9, 0x0A, 0x08, 0x55, 0xA7, 0xE5, 0xB6, 0x9C, 0xFD,
-    0x5C, 0x80, 0x85, 0xE1, 0xAE, 0x85, 0xCE, 0xB8, 0x84, 0x15, 0x62, 0x5E, 0x86, 0x8F, 0xCD, 0x07,
-    0x60, 0xE0, 0x78, 0x3F, 0x6E, 0x82, 0x26, 0x70, 0x49, 0x7E, 0xB0, 0x79, 0x04, 0x1C, 0x24, 0x1C,
-    0xC2, 0x4E, 0x81, 0x65, 0x74, 0x03, 0x80, 0xAB, 0x71, 0x91, 0xE5, 0x93, 0x57, 0xF0, 0x36, 0xB0,
-    0x04, 0xC3, 0xF8, 0xA5, 0x70, 0xD3, 0xF8, 0x09, 0x05, 0x5E, 0xD8, 0xDB, 0xBB, 0x51, 0x10, 0xA4,
-    0x56, 0x00, 0xA9, 0x33, 0x9F, 0x87, 0xEF, 0x7F, 0x53, 0xC8, 0xFB, 0x34, 0x8D, 0xCD, 0x57, 0x70,
-    0xBE, 0x61, 0xB6, 0x71, 0x3A, 0x1A, 0xE6, 0x0D, 0xD6, 0x36, 0xC0, 0x1F, 0xA7, 0x75, 0x39, 0xFE,
-    0x2F, 0xCE, 0xCC, 0x19, 0x41, 0xA6, 0xD9, 0xFD, 0x51, 0xB8, 0x7F, 0x80, 0x9C, 0x2B, 0xC0, 0xB3,
-    0x67, 0xFE, 0xC5, 0xC9, 0x60, 0xE7, 0x1E, 0xC3, 0xF3, 0x7A, 0x72, 0x2F, 0x32, 0xCF, 0x09, 0x76,
-    0x4D, 0x3C, 0x8B, 0x98, 0xCC, 0x0E, 0x38, 0x8C, 0x30, 0x2F, 0xD5, 0x32, 0xF3, 0xF9, 0xCA, 0x98,
-    0xA4, 0x71, 0x1A, 0xFA, 0x5C, 0x9C, 0x1C, 0xDF, 0xEB, 0xCD, 0xF7, 0x31, 0x07, 0xDC, 0xFF, 0x3B,
-    0x48, 0x54, 0x42, 0xF8, 0xCD, 0x10, 0xC3, 0xFC, 0xB2, 0xBF, 0x42, 0x42, 0x92, 0xE4, 0x6B, 0xBF,
-    0x8F, 0xF2, 0xD4, 0x1F, 0xFC, 0x2E, 0x2A, 0xB3, 0xA0, 0x0F, 0xD0, 0x5D, 0x0D, 0xBB, 0xA0, 0x8D,
-    0xF2, 0x5B, 0x51, 0x1B, 0xB6, 0xF1, 0xDC, 0x09, 0xBA, 0xA8, 0xB9, 0x24, 0xB7, 0xF0, 0xBD, 0xD9,
-    0x91, 0xAB, 0x41, 0xBF, 0xD5, 0x1E, 0x4B, 0x86, 0x58, 0x87, 0x1D, 0xA5, 0xB2, 0x95, 0x6F, 0x01,
-    0x6B, 0x27, 0x75, 0x01, 0x63, 0xF8, 0xB1, 0x08, 0x8B, 0x3B, 0x63, 0x2E, 0x09, 0xE4, 0x9D, 0x7C,
-    0xF9, 0xA3, 0xB5, 0x01, 0x98, 0x9E, 0x15, 0x72, 0x66, 0xC0, 0x5E, 0x34, 0xC6, 0xBA, 0x21, 0x1C,
-    0x00, 0x13, 0xA3, 0x3E, 0xA5, 0x7D, 0x07, 0xBF, 0xA4, 0x70, 0x83, 0xF7, 0xF8, 0x5E, 0xF4, 0x8F,
-    0xB4, 0xFE, 0xF8, 0x1A, 0x69, 0x62, 0x3B, 0xDF, 0x36, 0x58, 0xD8, 0x35, 0x65, 0xBE, 0xB2, 0xAA,
-    0x30, 0x85, 0x1A, 0x48, 0x76, 0x74, 0x77, 0xBF, 0xA5, 0xB3, 0x23, 0x2F, 0x88, 0x06, 0x09, 0x6B,
-    0x4A, 0x34, 0x26, 0xFE, 0xD0, 0x5D, 0xF6, 0xB5, 0x81, 0x91, 0x57, 0xDA, 0x66, 0x3A, 0x1E, 0x02,
-    0x4F, 0xF0, 0x8F, 0xAF, 0x08, 0x6C, 0x1E, 0x9E, 0xD6, 0x20, 0x45, 0x03, 0x92, 0x35, 0xCB, 0x37,
-    0xDE, 0xB3, 0xA7, 0x00, 0x1F, 0x90, 0xB5, 0xF0, 0x9E, 0xE3, 0x90, 0x16, 0x24, 0xE9, 0x4E, 0x49,
-    0xBF, 0x7C, 0x4B, 0xE1, 0x09, 0x78, 0xF7, 0x32, 0xD8, 0x29, 0x81, 0xAF, 0x77, 0x17, 0x05, 0xD1,
-    0x0D, 0x61, 0x4F, 0xB6, 0x90, 0x83, 0xDD, 0x20, 0x76, 0x80, 0x57, 0x38, 0x90, 0x7C, 0xC3, 0x50,
-    0x8A, 0x51, 0x79, 0x96, 0xC5, 0x57, 0x11, 0x7B, 0x6A, 0xE3, 0x68, 0x1B, 0x86, 0x65, 0x79, 0x04,
-    0x76, 0x6A, 0x5F, 0x0F, 0x21, 0x60, 0x53, 0x7C, 0x64, 0x68, 0x8E, 0x60, 0x8C, 0x75, 0xDF, 0x14,
-    0x6E, 0x0E, 0x37, 0xC1, 0x0D, 0xA4, 0x83, 0x55, 0xE3, 0x81, 0x34, 0xB4, 0x2D, 0x04, 0x4A, 0xEA,
-    0x2B, 0x42, 0xBA, 0x4C, 0x9B, 0x97, 0x07, 0xA8, 0x3B, 0xFD, 0xEE, 0xCD, 0x34, 0xB7, 0xF1, 0xF6,
-    0xEE, 0x48, 0x1A, 0xD9, 0x6C, 0x49, 0x2F, 0xB6, 0x5B, 0xB9, 0x6C, 0x6B, 0x4D, 0xFB, 0x05, 0x05,
-    0xD4, 0x90, 0xE0, 0x59, 0xC4, 0xA9, 0x82, 0x53, 0xE2, 0xD9, 0xFC, 0x72, 0x96, 0xE8, 0xB0, 0x90,
-    0x87, 0x1E, 0xCC, 0xE4, 0x06, 0x49, 0x6B, 0x04, 0xF3, 0xF9, 0x2D, 0x97, 0x6A, 0xB3, 0x85, 0x3C,
-    0xC5, 0x42, 0x9B, 0xD5, 0x56, 0x6F, 0x3D, 0x72, 0xB5, 0x89, 0xF8, 0x34, 0xB1, 0xCB, 0x0C, 0x40,
-    0x19, 0x21, 0x71, 0xFE, 0x00, 0x1E, 0x73, 0xDB, 0x5E, 0x4B, 0x81, 0x60, 0xEF, 0x70, 0x77, 0x24,
-    0x65, 0x34, 0xB5, 0xC9, 0xEC, 0xCA, 0x49, 0x43, 0x0B, 0x6D, 0x36, 0xD6, 0xBD, 0x50, 0x30, 0x90,
-    0x4F, 0x14, 0x4F, 0x93, 0x81, 0x23, 0xF1, 0x7A, 0x6A, 0x74, 0xBA, 0x68, 0xAC, 0x94, 0x6A, 0x4E,
-    0x15, 0x17, 0x63, 0x05, 0x87, 0x40, 0xB8, 0xA3, 0x6F, 0x9D, 0xB3, 0xC5, 0xBB, 0x54, 0x87, 0x54,
-    0xBB, 0x04, 0xB5, 0x00, 0x95, 0xB2, 0xD1, 0xCE, 0x63, 0x29, 0xD5, 0xB3, 0xD0, 0x27, 0x19, 0x4F,
-    0x3A, 0xCD, 0x7F, 0x59, 0xEF, 0x5E, 0xD4, 0xFF, 0xCE, 0xB4, 0xC7, 0xBA, 0x19, 0x97, 0xEE, 0x17,
-    0xB3, 0x79, 0xD2, 0x0B, 0xE3, 0x31, 0x09, 0xDE, 0x45, 0x1A, 0x13, 0xD1, 0xF9, 0x2C, 0xF7, 0xFC,
-    0xBD, 0xAF, 0x6A, 0x4A, 0xC2, 0x91, 0xAC, 0x0B, 0x40, 0x0F, 0x8C, 0x21, 0x59, 0x4C, 0xC9, 0x21,
-    0x19, 0x8E, 0x3A, 0x33, 0x75, 0x22, 0x29, 0x70, 0x89, 0xF4, 0x16, 0xA9, 0x67, 0xF9, 0x3E, 0x92,
-    0x43, 0x50, 0xE2, 0x94, 0xA7, 0xC4, 0x0D, 0xCF, 0x10, 0x03, 0xD4, 0x9E, 0x7E, 0x7B, 0x20, 0x0D,
-    0x47, 0x1B, 0x09, 0xFD, 0xD3, 0xF1, 0x6D, 0x9E, 0xC9, 0x7D, 0xB2, 0x8E, 0x1B, 0x41, 0xA1, 0x81,
-    0xBD, 0x44, 0x74, 0xED, 0x01, 0x89, 0x10, 0x28, 0xFD, 0xAC, 0x9F, 0x2D, 0xE6, 0xF1, 0x46, 0xF5,
-    0x58, 0xF2, 0x3D, 0x92, 0x1F, 0x3F, 0x60, 0xEA, 0xC1, 0x03, 0xA6, 0x0E, 0x18, 0xA3, 0xF4, 0x19,
-    0x94, 0xA1, 0x81, 0x96, 0x95, 0x9C, 0xA5, 0x97, 0xE8, 0xEE, 0xF5, 0xB2, 0x8D, 0xEE, 0xE3, 0x41,
-    0x76, 0xD1, 0xFD, 0x7A, 0x2D, 0xFF, 0xC0, 0x6E, 0x94, 0x7F, 0x45, 0xF7, 0x91, 0xCA, 0xFF, 0xA2,
-    0x6B, 0xF4, 0xDA, 0x47, 0xEC, 0xAA, 0x9F, 0xFC, 0x9C, 0x5D, 0xF1, 0xDE, 0x1D, 0x76, 0xD9, 0x2F,
-    0x5F, 0x65, 0x97, 0xDE, 0xBF, 0xC6, 0x2E, 0x51, 0xAA, 0xBE, 0x89, 0x47, 0xEB, 0xA2, 0xB5, 0x75,
-    0xE1, 0x40, 0x4B, 0x68, 0x03, 0xE0, 0x5B, 0x7E, 0x79, 0x44, 0x98, 0xA0, 0xA4, 0xBD, 0x36, 0x81,
-    0x31, 0xA0, 0x82, 0xA1, 0x35, 0x42, 0xEC, 0x77, 0x99, 0xDF, 0xA5, 0x96, 0x32, 0x24, 0x53, 0xD2,
-    0x0B, 0x3A, 0x90, 0xFE, 0x5A, 0x49, 0x3F, 0xD2, 0x12, 0x14, 0xC9, 0x1E, 0x69, 0xD6, 0x92, 0x26,
-    0x3D, 0x69, 0xB4, 0x26, 0x0D, 0x94, 0x54, 0xF4, 0x0D, 0xD2, 0x4A, 0x49, 0x33, 0xA3, 0xB1, 0xD1,
-    0x90, 0x5E, 0x4F, 0x9C, 0xB9, 0x3C, 0x32, 0xFA, 0x65, 0xAC, 0x6F, 0x36, 0x11, 0x95, 0x01, 0xA3,
-    0x98, 0x81, 0x0E, 0x3E, 0x05, 0x64, 0x05, 0xAE, 0xB2, 0x5A, 0x1A, 0xE8, 0x56, 0xF0, 0x50, 0xB8,
-    0x58, 0x60, 0x8F, 0x26, 0xA4, 0x5A, 0x68, 0xFE, 0x3B, 0x74, 0x1E, 0x33, 0x8D, 0xE7, 0xBB, 0xE3,
-    0x3C, 0x4F, 0x64, 0x73, 0x22, 0xA8, 0x33, 0xA6, 0x57, 0x9F, 0xD0, 0x19, 0x27, 0xA8, 0xB5, 0xC2,
-    0x07, 0xFA, 0x39, 0x13, 0x48, 0x88, 0x3D, 0x45, 0xBD, 0x04, 0x88, 0xAF, 0x22, 0xF6, 0x94, 0x7E,
-    0xFB, 0x36, 0x81, 0x14, 0xEF, 0x3E, 0x25, 0x0A, 0xFD, 0x89, 0xB7, 0x5C, 0x59, 0x7C, 0x2F, 0xEA,
-    0x0D, 0xC2, 0x59, 0x40, 0x92, 0x78, 0x3D, 0x41, 0x64, 0x3B, 0xDF, 0x7A, 0x38, 0x06, 0xD5, 0xE6,
-    0x44, 0xAD, 0x39, 0xA6, 0x39, 0x69, 0x72, 0x86, 0xA6, 0xED, 0xE6, 0xA9, 0xA5, 0x41, 0xF7, 0xCC,
-    0x0D, 0xB9, 0x22, 0xCA, 0x74, 0x73, 0xCC, 0xC0, 0xEE, 0xF8, 0xE6, 0x98, 0xF2, 0x80, 0x63, 0xD2,
-    0x36, 0xF2, 0x64, 0xE3, 0x98, 0xBD, 0x57, 0x4D, 0x05, 0x23, 0x6D, 0x73, 0xAC, 0x5A, 0xA4, 0x2E,
-    0x43, 0x5C, 0x07, 0x43, 0x52, 0xFB, 0x7D, 0xDA, 0x78, 0x87, 0x09, 0x6B, 0x81, 0x91, 0x67, 0x21,
-    0xA8, 0x17, 0x29, 0x58, 0x54, 0x14, 0xF0, 0xA3, 0xDE, 0x6C, 0x56, 0x92, 0xD1, 0x83, 0x18, 0x50,
-    0x35, 0x2A, 0x12, 0xB0, 0x11, 0xD9, 0xFF, 0x3A, 0x6D, 0x82, 0x3E, 0x1E, 0xF7, 0x1B, 0x83, 0x7F,
-    0x94, 0xF6, 0x10, 0xBD, 0xF6, 0x2C, 0x51, 0xFA, 0x77, 0x21, 0xB5, 0xFE, 0x18, 0xE4, 0xE6, 0xED,
-    0x85, 0x7C, 0x8B, 0x92, 0x94, 0x3F, 0x88, 0xEC, 0x33, 0x88, 0x56, 0xE0, 0xA7, 0xD0, 0x2E, 0xD6,
-    0x7A, 0x5F, 0xE1, 0x74, 0x87, 0x7C, 0x32, 0xD8, 0xF3, 0xE3, 0x3F, 0x1A, 0x85, 0x5A, 0xA4, 0x33,
-    0xBC, 0x87, 0xD2, 0x50, 0x55, 0x35, 0x66, 0xCC, 0x25, 0x03, 0xCE, 0x7A, 0x4A, 0xB9, 0x4D, 0x36,
-    0x70, 0x38, 0xA4, 0x6D, 0x97, 0xC7, 0x1C, 0x19, 0x04, 0x1C, 0x11, 0x01, 0x8A, 0x85, 0xF6, 0xC8,
-    0x5A, 0x1B, 0x33, 0x84, 0x96, 0xB5, 0x32, 0x57, 0xD7, 0x92, 0x75, 0x3D, 0x9D, 0x9C, 0xF6, 0xB1,
-    0x6D, 0xF6, 0xB1, 0x6B, 0xC6, 0xC0, 0x5C, 0x3D, 0xE9, 0x8E, 0x2D, 0x6F, 0xA1, 0x7D, 0x44, 0x6B,
-    0xD2, 0x60, 0x6C, 0x6C, 0xCB, 0xCE, 0xEC, 0xC6, 0x54, 0x66, 0xA7, 0x36, 0x56, 0xE9, 0x4C, 0x65,
-    0x11, 0xF2, 0x6F, 0xEF, 0x10, 0x6A, 0xA9, 0xB4, 0x09, 0x5A, 0xAF, 0xEA, 0x61, 0x64, 0x08, 0xB5,
-    0xB1, 0x03, 0x0F, 0xB4, 0xFA, 0x92, 0xF6, 0x8A, 0x9E, 0xFB, 0xC1, 0xA3, 0x84, 0xFC, 0x24, 0x8A,
-    0xDC, 0xD0, 0x63, 0x48, 0x60, 0xE6, 0xAC, 0xE5, 0xAE, 0x96, 0x3B, 0xE4, 0xEA, 0x00, 0x17, 0xF9,
-    0x3A, 0xC6, 0x45, 0xCE, 0x3A, 0x5C, 0x8C, 0xD4, 0x6D, 0xDA, 0xB2, 0x66, 0xF9, 0xAC, 0x89, 0x3F,
-    0x67, 0xFD, 0xF2, 0x45, 0x1D, 0x7F, 0x09, 0xB6, 0xE2, 0xFB, 0x2E, 0x1C, 0x6B, 0x1A, 0xBD, 0x33,
-    0x06, 0x43, 0xC2, 0x9C, 0x93, 0x29, 0x71, 0xCA, 0xC5, 0x44, 0x67, 0x7E, 0x3A, 0x5A, 0x12, 0x9E,
-    0x31, 0x20, 0xE7, 0x16, 0x96, 0x73, 0x1E, 0x21, 0x75, 0xCC, 0xA1, 0x18, 0x6E, 0x0A, 0xAB, 0x62,
-    0xB2, 0x8E, 0x32, 0x89, 0x07, 0x4A, 0x23, 0x1C, 0x2D, 0xB9, 0x9D, 0xFC, 0x64, 0xDA, 0x75, 0x65,
-    0x6E, 0x64, 0x77, 0x78, 0x94, 0x84, 0x31, 0x1F, 0xD0, 0xDD, 0x13, 0xB3, 0x86, 0x5D, 0x46, 0x21,
-    0xE9, 0xE9, 0x40, 0xBE, 0x9D, 0xDE, 0x84, 0x2D, 0x8F, 0xBB, 0x8A, 0x13, 0xE4, 0xD2, 0x65, 0x35,
-    0xFA, 0xC8, 0x7E, 0x20, 0xA5, 0x02, 0xDE, 0xA0, 0xCD, 0xBE, 0xD2, 0xB0, 0xB1, 0x3A, 0xA2, 0x58,
-    0x60, 0x3E, 0x1D, 0x6C, 0xB4, 0xE3, 0xE2, 0x8D, 0x5E, 0xDA, 0x1D, 0xD3, 0x05, 0x35, 0x12, 0x0D,
-    0xA6, 0x0B, 0x6D, 0xCE, 0x68, 0xA1, 0x7C, 0x0C, 0xF5, 0x8C, 0x1A, 0x2A, 0x4D, 0xB0, 0xC4, 0xF8,
-    0x94, 0x4F, 0x84, 0x2B, 0xEE, 0x52, 0x13, 0x3B, 0xCC, 0x0C, 0x77, 0xA6, 0x3C, 0xA8, 0xB2, 0xA8,
-    0xEB, 0x66, 0xE3, 0x8E, 0x46, 0x93, 0x04, 0x5F, 0xEE, 0x96, 0xBC, 0x88, 0x0F, 0x0D, 0xEB, 0x42,
-    0x32, 0x8C, 0x87, 0x81, 0x4B, 0x91, 0x08, 0x39, 0x26, 0x47, 0x8E, 0x8E, 0xE6, 0x98, 0xB9, 0x38,
-    0x5B, 0xD0, 0x65, 0x27, 0xF9, 0x74, 0x7E, 0xF5, 0xFB, 0x5F, 0x04, 0x27, 0xB7, 0xB5, 0xE2, 0x3E,
-    0xC0, 0xE0, 0x6D, 0x91, 0x9B, 0x76, 0x3A, 0x84, 0xEB, 0x8A, 0xC8, 0xA5, 0xE5, 0x9C, 0x29, 0x42,
-    0x29, 0x56, 0x52, 0x80, 0xB8, 0xFC, 0x9A, 0x81, 0x88, 0xA3, 0x1F, 0xF3, 0xC2, 0x79, 0x93, 0x91,
-    0xCA, 0xDF, 0x3E, 0x4D, 0x72, 0xF4, 0x88, 0x8C, 0x89, 0xF3, 0xAC, 0x56, 0x9B, 0x53, 0x35, 0x3B,
-    0x08, 0x80, 0x20, 0xFF, 0x8D, 0x2C, 0xC0, 0x67, 0x9B, 0x9B, 0x60, 0x6B, 0x07, 0x32, 0xDA, 0xC6,
-    0xE3, 0x18, 0x96, 0x1F, 0x95, 0xBB, 0xB8, 0x73, 0x00, 0xD7, 0x44, 0x8D, 0x78, 0x03, 0x45, 0xEB,
-    0x9B, 0xCB, 0xE1, 0xCE, 0x5E, 0xCE, 0x32, 0x3D, 0xE8, 0x51, 0x08, 0x3E, 0xB3, 0x1C, 0x22, 0x21,
-    0x13, 0x2B, 0x93, 0x06, 0xF7, 0xEB, 0xAC, 0x81, 0x9C, 0x9B, 0x09, 0xCA, 0x8B, 0xE6, 0x3C, 0x4C,
-    0x29, 0x3D, 0x29, 0x9A, 0x02, 0xF7, 0x2B, 0xB7, 0x69, 0x45, 0xCD, 0x14, 0xE4, 0x57, 0x27, 0xD1,
-    0x08, 0xFB, 0xBA, 0xB1, 0x1C, 0x3E, 0x10, 0x24, 0x12, 0x92, 0xE0, 0x2B, 0x49, 0x7A, 0x17, 0x44,
-    0x99, 0x25, 0xFC, 0x07, 0xBD, 0x02, 0x3E, 0x08, 0x77, 0x2D, 0x48, 0xB2, 0x9A, 0x41, 0xCA, 0x48,
-    0xF3, 0x20, 0xA9, 0xA7, 0x21, 0x56, 0x23, 0xE9, 0xAB, 0x5A, 0xEE, 0x9F, 0x40, 0x10, 0x55, 0x5B,
-    0xF4, 0x67, 0x8E, 0x9F, 0x8B, 0x13, 0xCB, 0x88, 0x79, 0xD4, 0xC1, 0x13, 0xD6, 0xCC, 0xA5, 0xAE,
-    0x70, 0x2F, 0x9C, 0x1E, 0x15, 0x2D, 0xAD, 0x98, 0x1B, 0x76, 0xE6, 0x92, 0x2E, 0x74, 0x91, 0x15,
-    0x5F, 0xEB, 0xB3, 0xA7, 0xC4, 0xE6, 0x6C, 0xFB, 0x83, 0x79, 0x81, 0xCC, 0xD5, 0xFC, 0x42, 0xBC,
-    0xEA, 0x35, 0x1E, 0x5A, 0x7C, 0x81, 0x34, 0xA6, 0x2B, 0x90, 0xA8, 0x37, 0xB0, 0xCB, 0xC2, 0x19,
-    0xC1, 0xE0, 0x6A, 0x22, 0xE1, 0x83, 0x24, 0x9A, 0x9F, 0xA2, 0xB6, 0x63, 0x28, 0x4E, 0x91, 0xCA,
-    0xEB, 0x17, 0x7A, 0xE8, 0x43, 0x00, 0xF5, 0x24, 0x7C, 0xE3, 0xDF, 0x0E, 0x1D, 0x73, 0x1E, 0x17,
-    0xA5, 0x4D, 0x72, 0x7A, 0xE0, 0x58, 0xFD, 0xE2, 0xA5, 0x0E, 0xC6, 0xDE, 0x55, 0x9F, 0xAC, 0x8E,
-    0x16, 0xFE, 0xA9, 0x72, 0x98, 0xEB, 0x51, 0xDC, 0xFB, 0x4D, 0x48, 0x17, 0xA8, 0xC6, 0x89, 0x7F,
-    0x6F, 0x8F, 0xE1, 0xAD, 0x96, 0xEA, 0x8D, 0x56, 0x34, 0x44, 0x68, 0xF2, 0x73, 0x1E, 0x3A, 0xB0,
-    0x5D, 0xD6, 0x1F, 0xF2, 0xB4, 0x56, 0x5E, 0xD4, 0x3D, 0x59, 0xEE, 0x7D, 0x5D, 0xA3, 0x6B, 0x22,
-    0x87, 0xC6, 0x7B, 0x76, 0x90, 0xFE, 0x0A, 0x24, 0xF8, 0x7F, 0x4A, 0x29, 0xBF, 0xC1, 0xB3, 0xD1,
-    0x9F, 0x4A, 0x52, 0xA7, 0xB5, 0xA4, 0x75, 0xD2, 0x9C, 0x21, 0x31, 0xCF, 0x65, 0xA3, 0xCF, 0x8B,
-    0x12, 0x16, 0xCB, 0x69, 0xFE, 0x0B, 0x76, 0x11, 0xD1, 0x49, 0x79, 0x70, 0x45, 0x0B, 0x63, 0xC6,
-    0xAA, 0xCC, 0x9A, 0x31, 0x69, 0xFA, 0x09, 0xEA, 0xFF, 0x4A, 0xBC, 0x35, 0x4F, 0x26, 0x07, 0x10,
-    0x1F, 0xF2, 0xCA, 0xA3, 0x96, 0x09, 0x02, 0xDC, 0xAB, 0xFA, 0xCD, 0x93, 0xDA, 0x54, 0xB7, 0xD8,
-    0xD4, 0xA7, 0xAC, 0x62, 0x81, 0x6D, 0x30, 0x18, 0x94, 0x03, 0xEB, 0x27, 0x23, 0x21, 0xCF, 0x5E,
-    0x52, 0x3D, 0xD4, 0xAE, 0xD0, 0x06, 0xEE, 0x71, 0x83, 0x67, 0xE6, 0x0C, 0x26, 0xA8, 0x8A, 0xDF,
-    0x9C, 0x59, 0x78, 0xF9, 0x2D, 0x29, 0xD6, 0x08, 0x51, 0x5C, 0xF2, 0x31, 0x17, 0xA6, 0xDA, 0xD7,
-    0xC3, 0x0A, 0xA8, 0x7D, 0x81, 0xA1, 0xC0, 0x2A, 0xB1, 0x5C, 0xFE, 0x6E, 0x9E, 0xE4, 0x1B, 0x2B,
-    0x66, 0xE6, 0x04, 0xB5, 0xA7, 0xB9, 0x26, 0xD7, 0x07, 0x33, 0x45, 0x67, 0xA7, 0xB8, 0x4F, 0x22,
-    0x91, 0xE7, 0x56, 0x87, 0xC1, 0x3A, 0x52, 0x38, 0x93, 0x47, 0xBE, 0x7C, 0x26, 0x80, 0x11, 0x4F,
-    0xA2, 0x92, 0x1C, 0xA4, 0x60, 0x98, 0x05, 0x62, 0x07, 0x54, 0x47, 0xA0, 0x05, 0x9F, 0x5A, 0xE1,
-    0xCA, 0x48, 0xBA, 0x86, 0xDA, 0x43, 0x44, 0x90, 0x92, 0x1B, 0x81, 0xED, 0xB5, 0x17, 0xFB, 0x69,
-    0xC1, 0xE4, 0xEB, 0x36, 0xFF, 0x35, 0x12, 0x99, 0x3F, 0x5B, 0x6F, 0xA5, 0x1D, 0xF1, 0x3E, 0x1B,
-    0x74, 0xCC, 0xEC, 0x04, 0xF8, 0x53, 0xFD, 0xD2, 0xF8, 0xF0, 0x90, 0x55, 0x58, 0x0E, 0x01, 0x6D,
-    0x58, 0xC6, 0xAA, 0xE5, 0xD2, 0x27, 0x4F, 0xDF, 0x9B, 0x56, 0x13, 0xDA, 0x12, 0x14, 0x9B, 0x00,
-    0x40, 0xA8, 0xDB, 0x44, 0x37, 0x4C, 0x18, 0x07, 0xB6, 0xFC, 0x1F, 0x62, 0x33, 0x77, 0x27, 0x9B,
-    0xE1, 0x67, 0xDF, 0x7E, 0x61, 0x83, 0xD3, 0x26, 0x6D, 0xDA, 0x44, 0x7D, 0x06, 0xF7, 0x07, 0x6A,
-    0xAD, 0xAB, 0x4D, 0x1B, 0xD9, 0xF3, 0x1E, 0x9F, 0x65, 0x75, 0xD4, 0xC7, 0x6D, 0xDC, 0x86, 0x23,
-    0x82, 0xE1, 0xEC, 0xC2, 0x5B, 0x6F, 0x22, 0xB5, 0x2E, 0x7A, 0x00, 0x52, 0xA4, 0xFF, 0x69, 0x27,
-    0x32, 0x5A, 0x4E, 0xE0, 0x07, 0x18, 0x74, 0xA7, 0xF8, 0x88, 0xBC, 0xF5, 0x2C, 0x5C, 0x9E, 0xC1,
-    0xC7, 0x40, 0xAF, 0x71, 0x27, 0xC0, 0xC7, 0x60, 0xE0, 0xEF, 0x18, 0xC3, 0xB9, 0xDC, 0x7E, 0x01,
-    0x9A, 0xC9, 0x7A, 0x09, 0xB6, 0xA6, 0x90, 0x97, 0x57, 0x47, 0x44, 0xFE, 0x57, 0x57, 0x87, 0x91,
-    0x7E, 0xA6, 0x75, 0x72, 0x52, 0xAC, 0x27, 0x48, 0xCB, 0x9E, 0x12, 0xD2, 0xF8, 0x4B, 0xD7, 0x7D,
-    0xE4, 0x81, 0xFA, 0x3E, 0x56, 0x79, 0x26, 0xFC, 0x1D, 0xD8, 0x9C, 0x0A, 0x01, 0x9F, 0xE6, 0xE6,
-    0xAD, 0x56, 0x87, 0xDC, 0x65, 0x06, 0xF6, 0xC2, 0xB5, 0x0E, 0x81, 0xFE, 0x53, 0x1F, 0x68, 0xD0,
-    0x30, 0x93, 0x27, 0x7B, 0x8F, 0x6A, 0x2C, 0xC1, 0x53, 0x3D, 0x62, 0xFA, 0x6B, 0xBF, 0xA8, 0x00,
-    0xB8, 0x25, 0x71, 0x59, 0x9E, 0x96, 0x49, 0x9E, 0xB9, 0x3F, 0xB3, 0xC4, 0x21, 0x81, 0x4D, 0xC7,
-    0x4A, 0x3E, 0x0C, 0xB9, 0x98, 0xE5, 0xB8, 0x4B, 0x3C, 0x21, 0x9E, 0x47, 0xA6, 0x9F, 0x10, 0xBE,
-    0xFA, 0xA9, 0x42, 0xBB, 0x60, 0xBF, 0xFC, 0x0C, 0x3C, 0x61, 0xBF, 0x38, 0xBE, 0x05, 0x8C, 0x7B,
-    0x71, 0xFD, 0x1D, 0x08, 0xE9, 0x91, 0xD7, 0x9A, 0xDA, 0x60, 0x26, 0x56, 0xE1, 0x1D, 0x18, 0xD0,
-    0x73, 0xAB, 0x3C, 0x1B, 0x62, 0x2D, 0x21, 0x06, 0xE8, 0xE8, 0x09, 0xC8, 0xC6, 0x80, 0x50, 0x4B,
-    0x97, 0x81, 0xFE, 0x0D, 0xC1, 0x61, 0xAC, 0xEE, 0x42, 0xDF, 0x59, 0x6F, 0x71, 0x6C, 0xB5, 0x82,
-    0x2A, 0x54, 0x7F, 0xA2, 0xA6, 0x03, 0x86, 0x9F, 0x5D, 0xAE, 0xBB, 0x43, 0x9F, 0xB8, 0x49, 0x10,
-    0x60, 0x06, 0x99, 0x33, 0x2D, 0x7F, 0x95, 0x81, 0xF9, 0x3D, 0xC6, 0x81, 0x0F, 0x01, 0xAE, 0xE9,
-    0xC7, 0x25, 0x37, 0x6F, 0x00, 0x6B, 0x89, 0xF4, 0xAC, 0xEF, 0xAD, 0xD5, 0xE1, 0x05, 0x6F, 0x75,
-    0x94, 0x69, 0x7D, 0x15, 0x25, 0x18, 0x24, 0x98, 0x49, 0x96, 0x63, 0xC2, 0x2A, 0xDF, 0x26, 0xC0,
-    0x6B, 0x79, 0x65, 0x3A, 0xCF, 0x40, 0xCA, 0x82, 0x1A, 0xAA, 0x46, 0xFE, 0x52, 0x5D, 0xFF, 0x55,
-    0x83, 0x4C, 0xA6, 0x78, 0xED, 0xFB, 0xCC, 0x7F, 0xB3, 0x0F, 0xA2, 0x8E, 0x59, 0xC0, 0xCF, 0xC2,
-    0x2F, 0xF9, 0xB3, 0xC3, 0xFF, 0x58, 0xD2, 0x1B, 0x0F, 0xFE, 0xD4, 0x59, 0xCA, 0x1B, 0xF5, 0x96,
-    0xF1, 0x22, 0xFD, 0xAC, 0xB8, 0xDE, 0x0F, 0xB8, 0xDA, 0x6F, 0xB1, 0x16, 0x4A, 0x49, 0xA6, 0x86,
-    0xEF, 0x30, 0xB9, 0xE4, 0xAF, 0x50, 0xBF, 0xAD, 0xA7, 0x9F, 0x99, 0x97, 0x8A, 0x86, 0xAF, 0xF2,
-    0xEC, 0x7F, 0x9B, 0x75, 0xE2, 0x01, 0x53, 0xBF, 0x96, 0xC5, 0x43, 0x8B, 0x27, 0xFB, 0x27, 0x17,
-    0x11, 0xEF, 0xC6, 0x54, 0xFB, 0xD5, 0xEA, 0xAF, 0x57, 0xA5, 0x42, 0x50, 0x2E, 0x61, 0xA2, 0x12,
-    0xF7, 0xF2, 0x0E, 0x85, 0x42, 0xB4, 0x47, 0xCA, 0xE5, 0x8F, 0x7E, 0x33, 0x9F, 0xDF, 0xE8, 0x75,
-    0x86, 0xC6, 0x0F, 0x98, 0x54, 0xFF, 0x8C, 0xB5, 0xC5, 0xBD, 0x05, 0x1D, 0x2D, 0xA7, 0x0C, 0xFB,
-    0xF9, 0xE8, 0xD9, 0x7E, 0x45, 0x99, 0x4E, 0xF9, 0xF9, 0x7B, 0xB1, 0xFD, 0x08, 0x66, 0x35, 0x75,
-    0xC6, 0x11, 0x5B, 0xC4, 0xD6, 0xE7, 0x56, 0xAB, 0xA3, 0x44, 0xB5, 0x4D, 0x5F, 0x2F, 0x1A, 0x9E,
-    0x26, 0xFF, 0x39, 0x9F, 0xD3, 0x36, 0x99, 0x0B, 0x2C, 0xBF, 0x7B, 0xC1, 0xCC, 0xA0, 0x8C, 0xE7,
-    0xC1, 0xC5, 0x4D, 0xF0, 0x74, 0x9C, 0xB6, 0x1E, 0x22, 0x87, 0x5A, 0x9B, 0x8B, 0x71, 0x8C, 0xFB,
-    0x7C, 0x0A, 0xD6, 0xD5, 0x23, 0x1A, 0x65, 0x88, 0x79, 0x42, 0x9D, 0x72, 0xDE, 0x74, 0xBD, 0x1C,
-    0xE0, 0x97, 0x8F, 0x7E, 0xA7, 0x9A, 0x83, 0x3F, 0x55, 0xED, 0x21, 0x0F, 0xEC, 0x1E, 0xF7, 0x91,
-    0x79, 0x5F, 0x2F, 0xEA, 0x5C, 0x42, 0x69, 0xF9, 0xE8, 0x66, 0x33, 0xDB, 0xA1, 0x22, 0x6B, 0xDD,
-    0xA9, 0x92, 0x7F, 0xDC, 0xF8, 0x49, 0x02, 0x92, 0x81, 0xEB, 0xAD, 0xF9, 0xEC, 0x3E, 0xEE, 0xA4,
-    0xCD, 0x46, 0x69, 0x0F, 0xD2, 0x3B, 0xED, 0x71, 0xA8, 0xF5, 0x6D, 0x18, 0xF9, 0x0D, 0xE4, 0x37,
-    0xFF, 0x0F, 0xCD, 0x5A, 0x3F, 0x6C, 0xDE, 0xD6, 0x11, 0x3F, 0x92, 0x91, 0xD8, 0x9A, 0x40, 0xE9,
+static const uint8_t notoserif_14_boldBitmaps[34921] = {
+    0xC5, 0x59, 0x3D, 0x90, 0xDD, 0xD4, 0x15, 0xBE, 0x92, 0xB0, 0x45, 0xAC, 0x42, 0x14, 0x78, 0x98,
+    0xE0, 0x19, 0xD4, 0xA4, 0xF2, 0x86, 0x55, 0x93, 0x22, 0xC5, 0xAE, 0x25, 0x0F, 0x33, 0x49, 0x89,
+    0x0B, 0x76, 0x52, 0xA4, 0x80, 0x36, 0x6E, 0xB6, 0x75, 0x66, 0x8C, 0x25, 0x27, 0x33, 0xA1, 0x48,
+    0xE1, 0xD7, 0x50, 0x7B, 0x27, 0xE3, 0xC2, 0x79, 0x14, 0xA1, 0x20, 0x33, 0x2E, 0x70, 0x74, 0xC1,
+    0x93, 0x49, 0x41, 0x81, 0x82, 0x87, 0x50, 0xA4, 0x40, 0x1E, 0x96, 0x21, 0xD8, 0x33, 0x59, 0x05,
+    0x04, 0x68, 0x6D, 0x49, 0x27, 0xDF, 0x77, 0x24, 0xED, 0xAE, 0x0D, 0x18, 0x1B, 0xC8, 0xE4, 0xAD,
+    0xEE, 0xD1, 0x7B, 0xBA, 0x57, 0xF7, 0x9E, 0x7B, 0xCE, 0x77, 0xFE, 0xEE, 0x8A, 0x15, 0x5B, 0xE0,
+    0x2F, 0xCB, 0xF1, 0x97, 0x26, 0x69, 0x62, 0xF8, 0x17, 0xE3, 0x6F, 0xD5, 0x3C, 0x62, 0x8C, 0x39,
+    0x64, 0xB2, 0x9C, 0x23, 0xB2, 0x14, 0x3F, 0xCC, 0x63, 0xC6, 0xA9, 0x4D, 0x58, 0x9A, 0x2C, 0x75,
+    0x06, 0xE3, 0x75, 0x26, 0x68, 0x4C, 0x58, 0x9B, 0xB8, 0x36, 0x49, 0xA5, 0x17, 0x7A, 0x0E, 0x5C,
+    0xF8, 0x89, 0x87, 0xE8, 0x8D, 0xF0, 0x52, 0x63, 0xFC, 0xD6, 0xB8, 0x9D, 0x31, 0x62, 0x4C, 0x6C,
+    0x8D, 0x5F, 0x19, 0xF3, 0x82, 0xCE, 0x68, 0xD6, 0xF1, 0x20, 0x37, 0x41, 0xCD, 0x09, 0xD9, 0x2B,
+    0xA9, 0xC9, 0xAC, 0x49, 0xEC, 0x3C, 0xA9, 0x2E, 0xB0, 0x77, 0x25, 0xF5, 0xBC, 0x92, 0x35, 0x45,
+    0x8E, 0xF1, 0x6E, 0x6F, 0xBC, 0x96, 0x4C, 0x25, 0xC6, 0xFC, 0x84, 0x4C, 0x82, 0xE7, 0xC4, 0x26,
+    0x65, 0x52, 0x45, 0xA5, 0x67, 0x7D, 0x1B, 0x9B, 0x2B, 0x26, 0x35, 0x47, 0x37, 0x4C, 0x26, 0x29,
+    0xAE, 0xE3, 0x4B, 0xF4, 0xC7, 0xE8, 0x4D, 0x2A, 0xB0, 0x31, 0x7E, 0x8A, 0xD6, 0x78, 0x22, 0xD8,
+    0x4A, 0x62, 0x23, 0xBC, 0x95, 0x94, 0xFC, 0x16, 0xD6, 0x99, 0x0D, 0x1B, 0xB4, 0x96, 0xAD, 0xB8,
+    0xA7, 0x4D, 0xCF, 0x1B, 0x8E, 0xE3, 0x78, 0xBC, 0x57, 0xF1, 0x2D, 0x6F, 0x10, 0x9D, 0xCF, 0x38,
+    0x98, 0xD7, 0x6F, 0xB0, 0xB5, 0xC6, 0x38, 0xD2, 0x98, 0x68, 0xA7, 0x31, 0xD9, 0x85, 0xC6, 0xAC,
+    0x42, 0x10, 0xE6, 0xA1, 0x5B, 0x6B, 0x0E, 0x17, 0xC3, 0x56, 0x28, 0x52, 0x93, 0x5D, 0xA7, 0xD8,
+    0x35, 0xC1, 0x20, 0x79, 0x5C, 0x61, 0x97, 0x36, 0x26, 0xD7, 0x75, 0x94, 0x47, 0xB5, 0x93, 0x42,
+    0xD0, 0x26, 0x86, 0x64, 0x21, 0x3C, 0x53, 0x40, 0x63, 0x83, 0xA1, 0x6C, 0x4C, 0x58, 0xA9, 0x88,
+    0xCD, 0x55, 0x63, 0xDC, 0xC6, 0xAC, 0x05, 0xA5, 0x39, 0x1B, 0xE5, 0x4E, 0x9B, 0x88, 0xEC, 0x35,
+    0x9D, 0x57, 0x74, 0x5E, 0x8B, 0x79, 0xAB, 0x79, 0xDE, 0x30, 0xE7, 0x9C, 0x6C, 0x10, 0x39, 0xE7,
+    0x7C, 0x05, 0x43, 0x65, 0x20, 0x13, 0xF8, 0x0D, 0x7D, 0x90, 0x39, 0x13, 0x74, 0x8F, 0xA2, 0xAD,
+    0xA3, 0x25, 0x60, 0x38, 0xC9, 0x93, 0x3A, 0x16, 0xB1, 0xBE, 0xF4, 0x54, 0x06, 0x3E, 0x19, 0x16,
+    0x17, 0x6B, 0x5C, 0x34, 0x1F, 0x2D, 0x84, 0xEE, 0x9E, 0x46, 0x5B, 0x43, 0x6B, 0x0A, 0xEB, 0x54,
+    0x85, 0xF5, 0x80, 0xB1, 0x20, 0x87, 0x64, 0x4D, 0x61, 0xD7, 0xD1, 0x5E, 0xDC, 0x28, 0xDE, 0x2D,
+    0x44, 0xE4, 0xF4, 0x52, 0x3E, 0xC6, 0xBA, 0x76, 0x6C, 0x78, 0xF7, 0x18, 0x98, 0x8C, 0x65, 0xF0,
+    0x45, 0x4A, 0xB4, 0x2A, 0x60, 0x7B, 0xF9, 0x17, 0x55, 0x60, 0x9C, 0x2A, 0x34, 0xE6, 0x14, 0x9A,
+    0xD1, 0x76, 0x7A, 0x61, 0x42, 0xF0, 0x79, 0x64, 0x03, 0xEF, 0x10, 0x34, 0xBA, 0x87, 0x49, 0x98,
+    0xB8, 0x3F, 0x8D, 0x76, 0x02, 0xFC, 0x27, 0x69, 0x56, 0x46, 0x22, 0xA9, 0x4F, 0x11, 0x1C, 0x9A,
+    0xF0, 0x10, 0x0F, 0xC6, 0x19, 0x0A, 0xEB, 0x37, 0x61, 0x15, 0x56, 0x01, 0x10, 0x11, 0xD8, 0xC4,
+    0x3A, 0x2A, 0x55, 0xEE, 0xA4, 0xF8, 0xDD, 0xB6, 0x01, 0x6F, 0x69, 0xB1, 0x9D, 0x95, 0x05, 0xE4,
+    0x53, 0xE4, 0x21, 0x5B, 0x93, 0xE5, 0x8A, 0x07, 0xC5, 0x44, 0x54, 0xE2, 0xDD, 0x3A, 0x26, 0x1E,
+    0x52, 0x53, 0xF4, 0x8A, 0x87, 0x0C, 0xFA, 0x2B, 0xC6, 0x56, 0x5D, 0xDD, 0x78, 0xBE, 0x7C, 0xCD,
+    0x84, 0xF6, 0x55, 0x28, 0xE6, 0x31, 0x42, 0xD7, 0x64, 0x68, 0x1C, 0xD7, 0x8D, 0x3A, 0xF3, 0xC0,
+    0x6E, 0x40, 0x96, 0x4B, 0xB5, 0x17, 0x93, 0x60, 0x61, 0x1A, 0xA1, 0x8C, 0xC3, 0xDC, 0x69, 0xD8,
+    0x88, 0x5F, 0xEA, 0x0D, 0x9C, 0x10, 0xBB, 0x76, 0xC4, 0xAE, 0x36, 0x70, 0x1F, 0x37, 0x91, 0x0D,
+    0x87, 0x0C, 0xA2, 0xC7, 0xE0, 0x62, 0x30, 0xFE, 0x1D, 0xE8, 0xB7, 0x2C, 0xEA, 0x24, 0x8F, 0x9B,
+    0x22, 0x05, 0x96, 0x8D, 0xDF, 0x15, 0xA9, 0xDF, 0x66, 0x69, 0xA0, 0x7C, 0x87, 0xBB, 0x85, 0x75,
+    0xA9, 0xDF, 0x49, 0x16, 0x8E, 0x54, 0x26, 0x80, 0x1E, 0xE3, 0x0A, 0xDE, 0x01, 0x52, 0xC8, 0xF2,
+    0xA8, 0xC4, 0x7B, 0x95, 0xA4, 0x61, 0xCD, 0xC6, 0xBD, 0x67, 0xC0, 0x49, 0x52, 0x65, 0x75, 0x28,
+    0x3B, 0xB5, 0x2B, 0xCF, 0x92, 0x69, 0xCA, 0x1B, 0xA0, 0x8B, 0xCA, 0x47, 0xC1, 0xFC, 0x9A, 0xA1,
+    0x5F, 0x11, 0x13, 0xDF, 0x82, 0xC7, 0x10, 0xEC, 0xE7, 0x71, 0x63, 0x4E, 0x18, 0x81, 0x5F, 0x91,
+    0x7C, 0xD5, 0x1C, 0xFC, 0x3C, 0x0E, 0x84, 0xE1, 0xA9, 0x7A, 0x9B, 0x30, 0x07, 0x0A, 0x31, 0x6F,
+    0x90, 0x1F, 0x1C, 0x01, 0xDB, 0xB5, 0x7C, 0x1E, 0x56, 0x5E, 0xE5, 0xD9, 0x28, 0x3D, 0x3B, 0x3D,
+    0x0F, 0xC0, 0x67, 0x72, 0x67, 0x30, 0x9C, 0x13, 0x76, 0x6E, 0x33, 0xE0, 0xD5, 0x51, 0xCC, 0x66,
+    0xA5, 0x62, 0xC7, 0x81, 0x1E, 0xFC, 0x7E, 0x84, 0x6C, 0x92, 0x92, 0x01, 0xF5, 0x3C, 0xE4, 0x65,
+    0x5A, 0x5A, 0x65, 0xCB, 0x61, 0xF4, 0x40, 0xA6, 0x98, 0x57, 0x4C, 0xD4, 0x4B, 0x64, 0x95, 0x0A,
+    0x5A, 0xED, 0x0F, 0xE6, 0x8C, 0x81, 0xB7, 0x28, 0x7D, 0xEF, 0xBD, 0x8E, 0xF4, 0x5A, 0x4F, 0x16,
+    0x7E, 0x43, 0xDD, 0x84, 0x27, 0x49, 0x23, 0x9D, 0x63, 0x55, 0x41, 0xBB, 0x4E, 0x57, 0x65, 0xCE,
+    0x2D, 0x0B, 0x4C, 0x21, 0x6A, 0xC2, 0x0D, 0xC1, 0xE8, 0xD6, 0x84, 0xA2, 0x07, 0xF1, 0x76, 0xC6,
+    0x2F, 0xC9, 0x5B, 0x48, 0xEB, 0xA0, 0x32, 0x37, 0xA5, 0x82, 0x0A, 0x0A, 0xA9, 0x13, 0x19, 0x16,
+    0x40, 0x3B, 0x7E, 0xB8, 0xE2, 0x48, 0xEE, 0xA0, 0xB7, 0x04, 0xC9, 0x2A, 0x90, 0xA4, 0x9A, 0xBF,
+    0xF1, 0x99, 0xF6, 0xC2, 0x34, 0x40, 0x7A, 0xC3, 0x67, 0x96, 0x43, 0x6A, 0x90, 0xA8, 0xD9, 0x23,
+    0xED, 0xFC, 0x2D, 0x86, 0x9E, 0xF0, 0xEE, 0x0A, 0xD8, 0xC9, 0x61, 0xFD, 0xDB, 0xD3, 0x56, 0x0F,
+    0x13, 0x24, 0x40, 0xA9, 0x2E, 0x64, 0xFD, 0x0E, 0xF2, 0x83, 0xC5, 0x44, 0x50, 0xAF, 0x79, 0x52,
+    0x6D, 0x88, 0xAE, 0x77, 0x92, 0xC5, 0x57, 0x11, 0xED, 0xD5, 0x71, 0x94, 0xB2, 0x5A, 0x5A, 0x1A,
+    0x80, 0x9D, 0xD2, 0x95, 0x45, 0x64, 0xD5, 0x66, 0xA0, 0x28, 0xCA, 0xED, 0x28, 0xC6, 0x89, 0x5C,
+    0x32, 0xDC, 0x1C, 0x1E, 0x82, 0x1B, 0x48, 0x07, 0xAB, 0x86, 0x1D, 0xA9, 0xAF, 0x5B, 0xF0, 0x84,
+    0xD4, 0x95, 0xD4, 0xE1, 0x17, 0xF2, 0x64, 0xEE, 0xA2, 0x76, 0xEF, 0xBB, 0x33, 0xD1, 0x54, 0xC7,
+    0xEB, 0xBB, 0x03, 0x69, 0xA0, 0xB3, 0x45, 0xAD, 0xD1, 0xDD, 0x9A, 0x15, 0x5D, 0x6B, 0xDC, 0x2F,
+    0x28, 0x0C, 0x81, 0x04, 0x7D, 0x01, 0xA7, 0xF2, 0xF6, 0x88, 0xA3, 0xF3, 0x9B, 0x83, 0x44, 0xBA,
+    0x99, 0xDC, 0xD3, 0x31, 0x91, 0x53, 0x24, 0xB5, 0x12, 0xCC, 0xE7, 0xD6, 0x5C, 0xAA, 0x4E, 0x66,
+    0xF2, 0x10, 0x0B, 0xED, 0xAF, 0xB6, 0xBC, 0xFC, 0xB5, 0xAB, 0x8D, 0xC4, 0x25, 0xC4, 0x56, 0xE8,
+    0x1E, 0x13, 0x1A, 0xEC, 0xF4, 0x81, 0xF1, 0xA6, 0xBA, 0xBD, 0x9A, 0x02, 0xC1, 0xDE, 0xBD, 0x9E,
+    0x91, 0x97, 0x50, 0x1B, 0x61, 0x97, 0x8F, 0x1A, 0x9A, 0x69, 0xB5, 0x8F, 0xEE, 0x99, 0x82, 0x81,
+    0x74, 0xA4, 0xE8, 0x8D, 0x3A, 0x8E, 0xC4, 0xEB, 0xB1, 0xD2, 0xF1, 0x22, 0x58, 0x29, 0xD5, 0x94,
+    0x2A, 0xCE, 0x86, 0x02, 0x06, 0x01, 0x67, 0x4C, 0x43, 0x3D, 0xA4, 0x8B, 0x37, 0xB1, 0x74, 0xB1,
+    0x34, 0x91, 0xB4, 0xAA, 0xBE, 0x7D, 0xED, 0xDC, 0x97, 0x52, 0x3D, 0x33, 0x7D, 0x90, 0xF1, 0xA4,
+    0xE3, 0xFC, 0x2B, 0xB2, 0x7D, 0x4C, 0xFE, 0x95, 0x48, 0x8B, 0x75, 0x13, 0x2E, 0xDD, 0xCE, 0xB0,
+    0x79, 0xD0, 0x0B, 0xE3, 0x31, 0x09, 0xDE, 0x45, 0x90, 0x0D, 0x68, 0x7C, 0x9A, 0x60, 0x7C, 0xEB,
+    0x0B, 0x76, 0x2F, 0x39, 0x00, 0x9C, 0xB5, 0xA6, 0x58, 0x40, 0x20, 0x2D, 0x32, 0x8F, 0x98, 0x1C,
+    0x92, 0xE1, 0xA0, 0x51, 0xA8, 0xD3, 0x27, 0x21, 0xCF, 0x22, 0x7D, 0x91, 0xD4, 0x69, 0x48, 0xBD,
+    0x92, 0x34, 0xCC, 0x49, 0xE9, 0x37, 0x1C, 0xF5, 0x18, 0xA0, 0xDA, 0xFB, 0x6C, 0x47, 0xEA, 0x0F,
+    0x3A, 0x12, 0xFA, 0xA7, 0xE1, 0xEB, 0x3C, 0xA3, 0xF9, 0x24, 0x0D, 0x37, 0x12, 0x77, 0x80, 0xC5,
+    0x76, 0x40, 0xD3, 0xEE, 0x10, 0xA6, 0x41, 0x69, 0x67, 0xED, 0x84, 0x98, 0xFB, 0x83, 0xEA, 0xBE,
+    0xE4, 0x05, 0x92, 0x57, 0xEF, 0x82, 0xBA, 0x77, 0x17, 0xD4, 0xE1, 0xC6, 0x28, 0x7D, 0x86, 0x0C,
+    0x68, 0x00, 0x80, 0xA1, 0x16, 0x00, 0x3B, 0xDC, 0x76, 0x5A, 0xB3, 0x8A, 0xDB, 0x47, 0x9D, 0x59,
+    0xC7, 0xED, 0x83, 0xDE, 0xFC, 0x9A, 0xB7, 0xC1, 0xFC, 0x19, 0xB7, 0x1B, 0x62, 0xFE, 0x83, 0x5B,
+    0x25, 0x27, 0x6F, 0xF0, 0x56, 0xBC, 0xF9, 0x77, 0xDE, 0xB2, 0x6B, 0x6F, 0xF0, 0x96, 0xBC, 0x77,
+    0x9E, 0xB7, 0xF8, 0xCE, 0x49, 0xDE, 0x22, 0xA1, 0xEA, 0xAB, 0x70, 0xD0, 0x5B, 0xD0, 0xEB, 0xCD,
+    0xEF, 0x88, 0x84, 0xDA, 0x83, 0x7F, 0x4B, 0x57, 0x06, 0xB7, 0x09, 0x28, 0x69, 0xA7, 0x8E, 0x00,
+    0x06, 0xA4, 0xA9, 0x44, 0x23, 0xC4, 0xBE, 0xCD, 0xEC, 0x23, 0xD6, 0x80, 0x16, 0x8D, 0x29, 0x19,
+    0x68, 0x47, 0xFA, 0x81, 0x90, 0xDE, 0x90, 0x1C, 0x14, 0xA9, 0x08, 0x69, 0x52, 0x93, 0x46, 0x2D,
+    0x69, 0xD0, 0x93, 0x7A, 0x42, 0x6A, 0xE4, 0x22, 0x69, 0x21, 0xA4, 0x89, 0xD2, 0x50, 0xA9, 0x4F,
+    0xAB, 0xA7, 0x9F, 0x59, 0x19, 0x18, 0x47, 0x12, 0x26, 0xB1, 0x66, 0x2F, 0x36, 0x31, 0x60, 0x64,
+    0x93, 0xA3, 0x83, 0x4D, 0xC1, 0xB3, 0xC2, 0xAF, 0x32, 0x25, 0xEE, 0x68, 0x56, 0xB0, 0x50, 0x98,
+    0x98, 0xA7, 0x5D, 0xA3, 0xA7, 0x9A, 0x69, 0xFA, 0x25, 0x3A, 0x8D, 0x19, 0xC7, 0xF3, 0xDD, 0x61,
+    0x9A, 0x27, 0xD0, 0x39, 0xDD, 0x41, 0xF3, 0xBF, 0xE2, 0x26, 0x8D, 0x71, 0x74, 0xB5, 0xF4, 0xB5,
+    0xF4, 0x07, 0x07, 0x02, 0x09, 0x7D, 0x4F, 0x56, 0xCE, 0x01, 0xE2, 0xAB, 0x88, 0xF6, 0xD2, 0x6E,
+    0xFF, 0x44, 0x47, 0x8A, 0x77, 0x1F, 0xD2, 0x0B, 0xFD, 0x9F, 0xB7, 0xCC, 0xDC, 0x74, 0x8C, 0xFC,
+    0xB3, 0x87, 0xD3, 0x80, 0x64, 0xC2, 0x7E, 0x74, 0x91, 0xF5, 0xF4, 0xE8, 0xDE, 0x18, 0x54, 0xAA,
+    0x11, 0xD5, 0x6A, 0x98, 0x6A, 0xA4, 0xD1, 0x01, 0x1A, 0xD7, 0xFB, 0xBD, 0x9A, 0x50, 0xEC, 0xA8,
+    0x19, 0x72, 0x45, 0x47, 0x02, 0x35, 0x4C, 0x4F, 0x9F, 0xB8, 0x6A, 0x98, 0xE6, 0x2E, 0xC3, 0x24,
+    0x36, 0xD2, 0x68, 0xDF, 0x30, 0x5B, 0xA7, 0x18, 0xAB, 0x0F, 0x62, 0x73, 0x28, 0xEA, 0xA0, 0x0E,
+    0xBA, 0xB0, 0xF4, 0xBA, 0xA8, 0x74, 0xDB, 0xB8, 0x72, 0x16, 0x11, 0x33, 0x55, 0xCC, 0x16, 0x02,
+    0xAE, 0x1E, 0x05, 0x8B, 0x7C, 0x17, 0x76, 0xD4, 0x2A, 0x66, 0x4D, 0x34, 0x38, 0x10, 0x43, 0x84,
+    0xA7, 0x48, 0x65, 0x06, 0xE4, 0xA6, 0x7D, 0x5C, 0x79, 0x6D, 0x38, 0x6C, 0x56, 0xEA, 0xFE, 0x9D,
+    0x94, 0xA2, 0x97, 0x96, 0x09, 0x74, 0x7B, 0x15, 0x52, 0x6B, 0xAF, 0x80, 0x9C, 0x79, 0x6D, 0x26,
+    0x3F, 0xA5, 0x24, 0xCD, 0x77, 0x22, 0x9B, 0x0C, 0xA2, 0x05, 0xF8, 0x01, 0x5F, 0x00, 0x7B, 0x21,
+    0x8B, 0x95, 0x21, 0x45, 0xF4, 0x86, 0x11, 0x20, 0x38, 0xB8, 0x15, 0xB5, 0x04, 0x57, 0x06, 0xA1,
+    0xFA, 0x9A, 0x7B, 0x31, 0x8B, 0x93, 0x3C, 0x64, 0x62, 0x05, 0x03, 0xA3, 0x6E, 0x56, 0x55, 0x37,
+    0xEB, 0xAA, 0x08, 0x66, 0x71, 0x51, 0x73, 0x45, 0x73, 0x06, 0xEA, 0x26, 0xE8, 0x49, 0xBD, 0xA1,
+    0xD2, 0xE5, 0xAC, 0xEA, 0x4C, 0xC5, 0x25, 0x5A, 0x86, 0x8A, 0x4A, 0x8E, 0xF6, 0x85, 0x4C, 0xDA,
+    0x59, 0x40, 0x24, 0x85, 0x54, 0x5E, 0xED, 0x14, 0x2D, 0x14, 0x8C, 0x30, 0x17, 0x5A, 0xF0, 0x40,
+    0xC4, 0xE5, 0xC4, 0x0A, 0xEE, 0xE4, 0x19, 0x5D, 0x11, 0xF9, 0x89, 0x04, 0x79, 0x99, 0x43, 0x77,
+    0xCC, 0xFC, 0x4F, 0xF2, 0x75, 0xC9, 0xD7, 0xC8, 0xD5, 0x59, 0x5C, 0xE4, 0xEB, 0x0A, 0x2E, 0x72,
+    0xD6, 0xE0, 0x62, 0x94, 0xAC, 0xE3, 0x9A, 0xD9, 0xEC, 0x27, 0x55, 0xF8, 0x19, 0x33, 0xDB, 0x2F,
+    0xCA, 0xF0, 0x36, 0xD8, 0x0A, 0xEF, 0x58, 0x7F, 0x28, 0x09, 0x38, 0xAB, 0x0C, 0xFA, 0x74, 0x31,
+    0xD6, 0x8C, 0x49, 0x4B, 0x4A, 0x7E, 0x47, 0x36, 0x51, 0x27, 0x33, 0x95, 0x4C, 0x18, 0x0C, 0x53,
+    0x0D, 0x89, 0x29, 0xC6, 0x83, 0x47, 0xC0, 0x83, 0xAE, 0x3E, 0xD3, 0xFC, 0x36, 0x69, 0x28, 0x93,
+    0xB0, 0xA3, 0x34, 0xFC, 0x41, 0x13, 0xCB, 0x11, 0xA3, 0xE3, 0xAE, 0x0B, 0x85, 0xB0, 0x3E, 0x71,
+    0xA9, 0x7E, 0xE3, 0xBF, 0x45, 0x53, 0x8B, 0x54, 0x13, 0xEB, 0x8C, 0x00, 0xA6, 0x25, 0x78, 0x5D,
+    0x2D, 0x8F, 0x7D, 0xD4, 0xC9, 0x9D, 0xC9, 0x76, 0x9D, 0x42, 0xF2, 0x62, 0x70, 0x91, 0x79, 0x40,
+    0x4A, 0x19, 0x90, 0x28, 0xD5, 0xA6, 0x10, 0x54, 0x58, 0x1D, 0x11, 0xC4, 0x53, 0x7B, 0xF2, 0xF6,
+    0xB5, 0x63, 0xC3, 0x7D, 0xBD, 0xD4, 0x6B, 0xAA, 0x0B, 0x6A, 0x24, 0xE8, 0x54, 0x17, 0x52, 0x1D,
+    0xD0, 0x42, 0x7E, 0x1F, 0xEA, 0x28, 0x55, 0x8F, 0x30, 0xBA, 0x04, 0xC6, 0x86, 0x74, 0x24, 0x5C,
+    0x71, 0x9D, 0x9A, 0x58, 0x63, 0x56, 0xB6, 0x36, 0xE6, 0x20, 0x85, 0x46, 0x3C, 0x3B, 0x01, 0x2B,
+    0x18, 0x54, 0x12, 0x7C, 0xB9, 0x99, 0x73, 0x12, 0x76, 0xAA, 0x9F, 0xF1, 0xC9, 0x30, 0x3A, 0x3D,
+    0x1B, 0x23, 0x09, 0xB1, 0x4C, 0x4C, 0x2C, 0x41, 0x6E, 0x99, 0x35, 0xD8, 0xB9, 0x36, 0x46, 0x08,
+    0x47, 0x2D, 0x84, 0xAA, 0x04, 0x55, 0x3E, 0x06, 0x55, 0xA3, 0x0F, 0xC8, 0xAA, 0xC3, 0x90, 0x43,
+    0xBC, 0x9B, 0x55, 0x19, 0x9E, 0x17, 0x76, 0xBF, 0x65, 0x25, 0x63, 0xD7, 0xFB, 0xBB, 0xC1, 0x00,
+    0xE1, 0x9C, 0x9A, 0x6B, 0x2A, 0xBA, 0x8A, 0x88, 0xC4, 0xFB, 0x4A, 0x12, 0x6F, 0x83, 0x08, 0xC3,
+    0xCB, 0x3B, 0x54, 0x29, 0x00, 0x04, 0xAC, 0x65, 0x24, 0x49, 0x49, 0xEF, 0xA6, 0xA4, 0xBA, 0x9B,
+    0x94, 0xE3, 0x10, 0x4D, 0xAE, 0xE5, 0xBC, 0xE4, 0x9B, 0xBB, 0x82, 0xEF, 0x75, 0x46, 0x85, 0x3B,
+    0xD3, 0xBA, 0xD9, 0xAE, 0xA6, 0x52, 0xAC, 0xE0, 0x92, 0x12, 0xB5, 0x8E, 0x8D, 0x6D, 0x66, 0x8F,
+    0xEE, 0x55, 0xC0, 0x73, 0xCB, 0xA6, 0x86, 0x9D, 0xD9, 0xA8, 0xF1, 0x6D, 0xA0, 0x59, 0x3B, 0xEB,
+    0xC7, 0x74, 0xF6, 0xC1, 0x8A, 0x94, 0xCD, 0x4E, 0x55, 0x48, 0xCC, 0x1C, 0x24, 0x4E, 0xF1, 0x12,
+    0x6B, 0xB1, 0x2F, 0x10, 0xFF, 0x9A, 0x0C, 0x19, 0x5E, 0x05, 0xA1, 0x66, 0x56, 0x09, 0x06, 0x17,
+    0x23, 0xF1, 0xEF, 0x26, 0xC1, 0xD4, 0x8B, 0xA2, 0x80, 0x3E, 0x3C, 0x46, 0x0E, 0x28, 0x5F, 0xC8,
+    0xC2, 0x85, 0x00, 0x4A, 0x3D, 0x2B, 0x1A, 0xF9, 0xD7, 0xB3, 0x94, 0x94, 0x55, 0x70, 0x5C, 0x45,
+    0x7B, 0xE7, 0x28, 0xC5, 0xBB, 0xCF, 0x37, 0xD0, 0x54, 0x53, 0xDC, 0x5C, 0x6E, 0xCD, 0xFC, 0xB3,
+    0x3A, 0x83, 0x0A, 0xB7, 0xC2, 0xD6, 0xAD, 0x7C, 0xEA, 0xAF, 0x18, 0x46, 0xFE, 0x9D, 0x0D, 0xFA,
+    0xC5, 0xD2, 0x14, 0x17, 0x6B, 0x23, 0x3E, 0x7C, 0x9A, 0x0B, 0x1F, 0x69, 0xE8, 0xE9, 0x81, 0xAB,
+    0x3F, 0xC2, 0xB7, 0x0D, 0xE6, 0x09, 0xD9, 0x30, 0xF3, 0xB3, 0x6F, 0x6A, 0xC4, 0x15, 0x92, 0x2F,
+    0xBC, 0xC7, 0xDD, 0x9B, 0x73, 0x90, 0xE0, 0xE7, 0x42, 0x29, 0x5F, 0xE4, 0x91, 0xCF, 0x5F, 0x51,
+    0xA5, 0xC6, 0xA5, 0x89, 0x4B, 0x14, 0xAC, 0xFB, 0x24, 0xE4, 0xE9, 0x50, 0xF0, 0x19, 0xCA, 0x7D,
+    0x87, 0x18, 0x76, 0x3F, 0x04, 0x2E, 0x02, 0x22, 0x8C, 0xF5, 0x38, 0x11, 0xC6, 0x54, 0x47, 0x98,
+    0x6E, 0x61, 0xD2, 0xF8, 0xE6, 0x2B, 0x3D, 0xAC, 0xDC, 0xE9, 0x79, 0xE0, 0xD2, 0x81, 0xA0, 0x3A,
+    0x2F, 0x52, 0x54, 0xEF, 0x3C, 0x05, 0x31, 0x6E, 0xF1, 0xF1, 0x83, 0x62, 0xAA, 0x99, 0x31, 0x75,
+    0x8B, 0xE5, 0x0F, 0x0C, 0x13, 0x80, 0x41, 0x1E, 0xD9, 0x3F, 0x18, 0xF1, 0x59, 0xFE, 0xC6, 0xB2,
+    0x90, 0x26, 0x43, 0x01, 0xD9, 0x02, 0xCA, 0x5E, 0x47, 0x6F, 0xCC, 0x72, 0xEA, 0xD2, 0xC4, 0xC2,
+    0xE9, 0xCB, 0x26, 0xEB, 0xE1, 0x5F, 0xB9, 0xE4, 0x7D, 0x2E, 0x4C, 0xB5, 0x29, 0x0B, 0x54, 0xA0,
+    0xAC, 0x8B, 0xA7, 0x02, 0x2B, 0x35, 0xBF, 0x9A, 0x26, 0x79, 0x72, 0xC9, 0x94, 0x8E, 0x16, 0xF9,
+    0x30, 0xD7, 0x58, 0x9C, 0x81, 0x99, 0xAC, 0xD1, 0xC3, 0xA9, 0x07, 0x91, 0xC8, 0x91, 0xE5, 0xC2,
+    0xEB, 0x03, 0x81, 0x31, 0x39, 0xE4, 0xCB, 0x65, 0xE6, 0x00, 0x35, 0x78, 0x7D, 0x94, 0x82, 0x64,
+    0x8C, 0x11, 0x70, 0x37, 0x1E, 0xD5, 0xE1, 0x49, 0xC6, 0x5E, 0xAD, 0x78, 0x18, 0x06, 0x7A, 0xA8,
+    0xDD, 0x87, 0xFB, 0xCB, 0xB9, 0x11, 0x60, 0xAF, 0x3E, 0xD6, 0x8E, 0x0B, 0x46, 0xDF, 0xB4, 0xF9,
+    0x6F, 0x90, 0xC8, 0xF4, 0x39, 0x7E, 0x39, 0x6E, 0xE8, 0xAC, 0x92, 0x4E, 0x86, 0x44, 0x0F, 0xB6,
+    0x6E, 0xC9, 0x6D, 0xE5, 0xC3, 0x41, 0x48, 0xD4, 0x00, 0x08, 0x6D, 0x68, 0xAA, 0x23, 0xF9, 0x7C,
+    0x8F, 0x1E, 0xFE, 0xAE, 0x5A, 0x8D, 0x88, 0x25, 0x28, 0x36, 0x82, 0x03, 0xA1, 0x6E, 0x23, 0xD9,
+    0x67, 0x42, 0x39, 0xD0, 0xE5, 0xBF, 0x0B, 0x66, 0xB6, 0x47, 0xCC, 0xF0, 0xB3, 0xB9, 0x4B, 0x89,
+    0xC2, 0x68, 0xA3, 0x3A, 0xAE, 0x82, 0x36, 0x81, 0xF9, 0xC3, 0x6B, 0xF5, 0xC5, 0x7E, 0x1B, 0x78,
+    0xE7, 0x33, 0xF6, 0x25, 0x65, 0xD0, 0x86, 0x75, 0x58, 0xFB, 0x03, 0x3C, 0xF9, 0x64, 0xC2, 0xC7,
+    0x2F, 0x21, 0x27, 0xCB, 0x5A, 0x38, 0xA4, 0x40, 0xFE, 0xA1, 0xA5, 0xBC, 0xE4, 0xA3, 0xF3, 0x83,
+    0x1B, 0xB4, 0x7B, 0xFE, 0x11, 0x09, 0xCF, 0x41, 0x77, 0x79, 0xC0, 0x3F, 0x7A, 0x72, 0x92, 0x3B,
+    0x81, 0x7F, 0xF4, 0x3A, 0x1E, 0xCF, 0x76, 0x28, 0x2C, 0x3D, 0x3D, 0x6B, 0xE9, 0x66, 0x74, 0x68,
+    0xA4, 0x50, 0x85, 0x9C, 0x5E, 0x6E, 0xD1, 0xF3, 0x9F, 0x5F, 0x2E, 0x02, 0xF9, 0x44, 0xCA, 0x68,
+    0x37, 0xEB, 0x47, 0x97, 0x96, 0x3C, 0xA4, 0x4B, 0x43, 0xAA, 0x20, 0x77, 0x90, 0xC4, 0xC8, 0xDF,
+    0xB0, 0xCA, 0x23, 0xFE, 0x97, 0xDC, 0xE6, 0x98, 0x41, 0xBA, 0x84, 0x9B, 0xB3, 0x5C, 0x2E, 0xB8,
+    0xCB, 0x04, 0xEC, 0xF9, 0xBD, 0x74, 0x9E, 0xFC, 0xB6, 0xF5, 0xC4, 0xAB, 0x98, 0x02, 0x92, 0xBD,
+    0xAF, 0x6B, 0xAC, 0xDD, 0x62, 0xD9, 0x82, 0x1A, 0x1B, 0x3D, 0x28, 0x86, 0xE3, 0x36, 0x91, 0x4D,
+    0xD2, 0x38, 0x8F, 0xD2, 0xC4, 0xFE, 0x40, 0xA3, 0x5E, 0x04, 0x4C, 0x87, 0x42, 0x3E, 0xD4, 0x73,
+    0x31, 0x44, 0xDB, 0xA7, 0x78, 0xF0, 0x35, 0x8D, 0x8C, 0x6F, 0xD2, 0x7D, 0xB5, 0x63, 0x6A, 0x0F,
+    0x03, 0x3D, 0x4B, 0xAF, 0xE3, 0x74, 0xE6, 0xD8, 0x70, 0x19, 0x3E, 0xEE, 0x89, 0xFE, 0x39, 0x08,
+    0xE9, 0x6B, 0xAF, 0x9E, 0xDA, 0x60, 0x1A, 0x51, 0xE0, 0x1D, 0x00, 0xE8, 0xC8, 0x32, 0x4D, 0x50,
+    0xF5, 0xE6, 0x10, 0x03, 0x74, 0xF4, 0x00, 0x64, 0x1F, 0x40, 0x28, 0xC2, 0x50, 0xE4, 0xFE, 0x9C,
+    0xCE, 0x61, 0x28, 0xB6, 0xA1, 0xEF, 0xA4, 0xD5, 0x38, 0xB6, 0x5C, 0x42, 0x15, 0x22, 0x6F, 0x8A,
+    0xEA, 0x80, 0xE1, 0x67, 0x9D, 0xEB, 0xAE, 0xD1, 0x26, 0xCE, 0xD0, 0x09, 0x30, 0xFD, 0x49, 0xA1,
+    0x38, 0x39, 0xCF, 0xC0, 0x7C, 0x8D, 0x71, 0xE0, 0x3A, 0x9C, 0x6B, 0xFC, 0x51, 0xCE, 0xCD, 0xAB,
+    0x83, 0xD5, 0x2C, 0x70, 0xD2, 0xF7, 0xF1, 0xE5, 0xE2, 0x71, 0x67, 0xB9, 0x85, 0xFA, 0xF2, 0x04,
+    0x72, 0x77, 0x48, 0x30, 0x31, 0x49, 0x8A, 0x09, 0x8B, 0x74, 0x95, 0x0E, 0x5E, 0xF2, 0xA7, 0xC7,
+    0x42, 0x18, 0x49, 0x0B, 0x92, 0xEF, 0xF2, 0x0C, 0x04, 0xFB, 0xCC, 0xFB, 0xD5, 0x6B, 0x98, 0xFA,
+    0xA5, 0x0B, 0x4C, 0xDE, 0x92, 0xB7, 0x82, 0x86, 0x59, 0xC0, 0xDB, 0xFE, 0x6D, 0x9E, 0xA6, 0xFE,
+    0x5B, 0x33, 0xB6, 0xB0, 0x73, 0xC7, 0x9B, 0xE6, 0x6B, 0x41, 0xAB, 0xE9, 0x1A, 0x72, 0xA7, 0x82,
+    0xEB, 0xFD, 0x81, 0xAB, 0x7D, 0x8A, 0xB5, 0x50, 0x83, 0x30, 0xAF, 0x79, 0x9D, 0x99, 0x11, 0x0F,
+    0xD7, 0x3F, 0x2D, 0xC9, 0x5C, 0xBA, 0x97, 0x0A, 0xF3, 0x55, 0x1E, 0x69, 0xAE, 0xB2, 0xC0, 0x38,
+    0xCB, 0xBC, 0xA5, 0x66, 0xE6, 0x5B, 0xA3, 0x67, 0x73, 0xF7, 0x18, 0xE2, 0xDD, 0x80, 0xCA, 0x7B,
+    0xB9, 0xFC, 0xD9, 0x32, 0x17, 0x08, 0xCA, 0xC2, 0x3B, 0x5D, 0xE5, 0xD1, 0xC9, 0xEB, 0x14, 0x0A,
+    0xBD, 0xBD, 0x41, 0x61, 0x30, 0xB8, 0xD5, 0x54, 0xF8, 0xCB, 0x33, 0x0C, 0x8D, 0x6F, 0x31, 0x23,
+    0x7C, 0x9B, 0x89, 0xF1, 0xCE, 0xEC, 0x1D, 0x35, 0x21, 0xF2, 0x35, 0x31, 0x64, 0x56, 0xC4, 0xC3,
+    0x61, 0xFD, 0x17, 0x0A, 0x4F, 0x11, 0xC6, 0xB3, 0x7D, 0x2D, 0xC6, 0x12, 0x8E, 0x38, 0x4E, 0xDF,
+    0x7A, 0x64, 0xB9, 0xDC, 0x8A, 0x50, 0x93, 0xC7, 0x2F, 0x67, 0x15, 0x8F, 0x21, 0x7F, 0xCC, 0x7E,
+    0x62, 0x93, 0xB9, 0xC0, 0x7C, 0x9C, 0x0F, 0x98, 0x41, 0x19, 0x8F, 0x81, 0x8B, 0x33, 0xE0, 0xE9,
+    0x4A, 0x5C, 0x3B, 0x88, 0x1C, 0xA2, 0x0D, 0xD8, 0x4A, 0xC7, 0x28, 0x8D, 0xF7, 0x5C, 0x4C, 0xEB,
+    0x97, 0xFB, 0xE7, 0xE3, 0xDF, 0x83, 0x83, 0x40, 0x3E, 0x38, 0xB0, 0x99, 0xB1, 0x38, 0xE5, 0xA7,
+    0x99, 0xEF, 0xB3, 0x87, 0x7D, 0x2A, 0x1D, 0xFF, 0x8F, 0x13, 0x94, 0x9E, 0x0D, 0xF2, 0x73, 0x46,
+    0x63, 0xD8, 0x0B, 0x87, 0xBD, 0x2A, 0x09, 0xD3, 0x66, 0xDD, 0x2D, 0x4F, 0x78, 0x55, 0x76, 0xAD,
+    0xCB, 0xAE, 0xF7, 0xC9, 0xF5, 0x3E, 0x7A, 0x83, 0x12, 0x7A, 0xEA, 0x64, 0x93, 0x5C, 0xEB, 0x92,
+    0xEB, 0x43, 0xF2, 0xC1, 0x10, 0x94, 0x7F, 0xF1, 0xEC, 0x5A, 0x90, 0x5F, 0x39, 0xE7, 0x57, 0x97,
+    0x82, 0x54, 0x2D, 0xE5, 0x10, 0x96, 0x2E, 0xD2, 0xB8, 0x0C, 0x6B, 0x41, 0xDE, 0x17, 0xB6, 0x4A,
+    0x9B, 0x2C, 0x8D, 0x6D, 0x50, 0x1F, 0x38, 0x63, 0x66, 0xAC, 0x47, 0xEE, 0x8C, 0x9D, 0x67, 0x3B,
+    0xD7, 0x7B, 0x06, 0xAF, 0xE0, 0x56, 0x93, 0xF1, 0xE0, 0xE5, 0x42, 0xFD, 0x23, 0x22, 0x8E, 0xE7,
+    0xDB, 0xB8, 0x51, 0x8E, 0x2B, 0xB2, 0x94, 0xDB, 0x5B, 0x5A, 0x6F, 0xC1, 0x15, 0x21, 0x2D, 0xD9,
+    0xFC, 0xEC, 0xD4, 0xDC, 0xF7, 0x1D, 0x6F, 0x9E, 0x56, 0xA1, 0x70, 0x00, 0x1F, 0x16, 0xC3, 0x02,
+    0x2B, 0xDC, 0x11, 0x4D, 0xC2, 0x8F, 0x9E, 0xD2, 0x02, 0x9B, 0x69, 0x76, 0xF2, 0x2E, 0xB1, 0xA7,
+    0x95, 0x33, 0x8B, 0x4C, 0xCB, 0x37, 0x7F, 0x38, 0x26, 0x3D, 0xCA, 0xD9, 0x72, 0x64, 0x6C, 0xE4,
+    0xAB, 0x9E, 0xE6, 0xFD, 0x76, 0x74, 0x64, 0x46, 0x79, 0x49, 0x95, 0x95, 0x74, 0x9F, 0x93, 0x5A,
+    0x39, 0xA9, 0x95, 0x93, 0x7A, 0x2A, 0x95, 0x0F, 0xBE, 0xBB, 0x22, 0x97, 0x41, 0x33, 0xE9, 0x23,
+    0x72, 0xF2, 0x5C, 0xF4, 0xFD, 0x70, 0x72, 0x43, 0x39, 0xF9, 0x5C, 0xC6, 0x9A, 0xD0, 0xD9, 0x50,
+    0x53, 0xCC, 0x35, 0xC9, 0xCB, 0x76, 0xDE, 0x19, 0x9E, 0x67, 0x05, 0x16, 0x7C, 0xD4, 0x6A, 0x45,
+    0x06, 0xC5, 0xB9, 0xFD, 0xA4, 0xB9, 0xC5, 0x2C, 0x5F, 0x4A, 0xA8, 0xB8, 0xBD, 0x5C, 0xA6, 0xD9,
+    0x08, 0xBC, 0x54, 0xB5, 0xB7, 0xC1, 0x82, 0x9C, 0xFD, 0xDF, 0xDF, 0x7D, 0xE4, 0x18, 0x59, 0x00,
+    0xA5, 0xF7, 0x7B, 0x86, 0x5A, 0xC8, 0xEF, 0x7D, 0x32, 0x7A, 0x4A, 0x73, 0x5D, 0x3A, 0x7C, 0x3D,
+    0x2B, 0xC9, 0x2E, 0xBE, 0x33, 0xFC, 0x92, 0x78, 0xF3, 0xFF, 0x39, 0x9E, 0x60, 0x7A, 0x17, 0xA6,
+    0x79, 0xC2, 0x83, 0xF3, 0x29, 0xDF, 0x0B, 0x19, 0xF9, 0xAE, 0x26, 0xBE, 0xD3, 0xFF, 0x25, 0xDF,
+    0x90, 0x75, 0x40, 0xBE, 0x3F, 0x11, 0x79, 0x56, 0xBA, 0xFF, 0x02, 0xAD, 0x54, 0x31, 0x6F, 0xE4,
+    0x44, 0x14, 0xFE, 0x6C, 0x43, 0x8C, 0xE4, 0x62, 0x28, 0x88, 0x28, 0x90, 0xE2, 0xAB, 0x57, 0xBA,
+    0x98, 0x92, 0x22, 0x59, 0x0F, 0xE4, 0x0F, 0xA4, 0x20, 0x15, 0x05, 0xFC, 0x00, 0x24, 0xDA, 0x14,
+    0x1B, 0xEC, 0xEE, 0xDA, 0x34, 0xF4, 0x29, 0xA8, 0x16, 0xA1, 0x34, 0x29, 0x82, 0xC4, 0xE1, 0x89,
+    0x28, 0xD2, 0xFA, 0x74, 0x7F, 0xC0, 0x54, 0xB4, 0xA3, 0x93, 0x91, 0x36, 0xC4, 0xF6, 0xE3, 0x7B,
+    0xB3, 0x9B, 0xE4, 0x74, 0x52, 0x52, 0x00, 0xA3, 0x79, 0x7E, 0xDE, 0xD9, 0x37, 0xCF, 0xDF, 0xBC,
+    0xEF, 0x9B, 0x57, 0xBE, 0x9A, 0xCA, 0x57, 0x53, 0x71, 0x35, 0x15, 0x6E, 0xCC, 0xDD, 0x60, 0xEA,
+    0xC1, 0xD8, 0x5F, 0x8D, 0x3D, 0x06, 0x47, 0xF6, 0x79, 0x07, 0xA3, 0x16, 0xB7, 0x30, 0x89, 0xC3,
+    0x0E, 0x6D, 0x37, 0x75, 0x46, 0x64, 0x52, 0xC3, 0x9E, 0xB1, 0x58, 0x18, 0xE0, 0x98, 0x76, 0xB1,
+    0x03, 0xF8, 0x5D, 0x94, 0x22, 0x2B, 0xB5, 0xB8, 0x5B, 0x20, 0x6E, 0x17, 0x48, 0xDA, 0x4B, 0x24,
+    0xEE, 0x82, 0xE6, 0x91, 0xD6, 0x1E, 0x61, 0xA4, 0x1B, 0xAB, 0x6E, 0x90, 0x88, 0xD4, 0xE6, 0xBA,
+    0x70, 0xC5, 0x0B, 0xE3, 0xCA, 0x17, 0xC6, 0x96, 0xD7, 0x40, 0x71, 0x0B, 0x18, 0xB1, 0x48, 0xA5,
+    0x47, 0x24, 0x02, 0xE4, 0xE2, 0xF8, 0xA3, 0xFB, 0x20, 0xCD, 0xFD, 0x7E, 0x9A, 0xF9, 0xEF, 0x69,
+    0x55, 0x6A, 0xDA, 0x92, 0xFB, 0x0C, 0x61, 0x44, 0xE7, 0xA7, 0x0F, 0x39, 0xD5, 0x22, 0xDC, 0x8D,
+    0x48, 0x6A, 0xEC, 0xF1, 0x20, 0x7F, 0x7A, 0x5C, 0x32, 0xCF, 0xD5, 0x0A, 0x84, 0x50, 0xD4, 0x43,
+    0xDC, 0x01, 0xA5, 0x1D, 0x79, 0x1E, 0x75, 0x59, 0x1D, 0x1C, 0x4F, 0xA3, 0x2E, 0x47, 0x70, 0xFB,
+    0x5B, 0x67, 0x1A, 0xB9, 0xA8, 0x26, 0x98, 0xAB, 0x55, 0x3F, 0x14, 0x36, 0xBD, 0xFD, 0xE3, 0xCD,
+    0xCA, 0x38, 0xFC, 0x76, 0xF0, 0xBA, 0xA7, 0x43, 0xFA, 0x7B, 0x6F, 0x5A, 0x42, 0x3D, 0xF0, 0xEA,
+    0xF2, 0x24, 0xB8, 0xFD, 0x24, 0x2C, 0x2E, 0xE2, 0x10, 0xD2, 0x47, 0xAB, 0xBC, 0x46, 0xE4, 0x31,
+    0x96, 0x40, 0xD2, 0xA1, 0x18, 0xD6, 0xB0, 0xEC, 0x1D, 0xC0, 0x5C, 0xF4, 0x55, 0xCE, 0x89, 0x27,
+    0x1A, 0x93, 0x9E, 0x41, 0x43, 0xB2, 0xBA, 0x7F, 0x86, 0x95, 0x48, 0x32, 0x1F, 0x62, 0x9C, 0x96,
+    0x6C, 0x8C, 0x8E, 0x2C, 0xAA, 0x55, 0x22, 0x2E, 0x91, 0x91, 0x41, 0xF9, 0x1B, 0x39, 0xF0, 0x28,
+    0x5D, 0xF3, 0xBA, 0x45, 0xE3, 0xCA, 0x5B, 0x87, 0xA6, 0x36, 0xAC, 0x97, 0xD4, 0x09, 0x53, 0x37,
+    0x7C, 0x69, 0x51, 0x71, 0x91, 0x31, 0x3E, 0x96, 0x81, 0x85, 0x6D, 0xAE, 0xE5, 0x2C, 0x92, 0x29,
+    0x12, 0xBF, 0xC6, 0x51, 0xB6, 0x65, 0x4B, 0x02, 0x5C, 0xEE, 0x4C, 0x6D, 0xAC, 0xB9, 0x83, 0x46,
+    0xC0, 0x1F, 0xCE, 0x81, 0xCF, 0x9E, 0xE7, 0x68, 0xBE, 0x6D, 0x50, 0xC9, 0x64, 0xB5, 0x9A, 0x85,
+    0xDC, 0xA0, 0xF9, 0x59, 0xEC, 0x09, 0xD7, 0x9F, 0xCD, 0xA3, 0x10, 0x87, 0x6D, 0x15, 0x0B, 0x4D,
+    0x37, 0xBF, 0x65, 0xDB, 0x5F, 0xFF, 0x70, 0x48, 0x31, 0x74, 0xB3, 0xF3, 0xE5, 0xE9, 0xBB, 0xFF,
+    0x61, 0xF3, 0x21, 0x13, 0x26, 0x6B, 0xBE, 0xCB, 0xDA, 0x41, 0xC9, 0x5A, 0x40, 0xB9, 0xE2, 0xC1,
+    0xBD, 0x16, 0x8E, 0x4C, 0x25, 0x2D, 0xE5, 0x83, 0xD4, 0x81, 0x3C, 0x71, 0xD7, 0x63, 0xE1, 0x67,
+    0xF7, 0xAC, 0x7F, 0x43, 0x6E, 0x94, 0xE0, 0x16, 0xF1, 0x48, 0xBA, 0x3B, 0x44, 0x13, 0xF7, 0x04,
+    0xCA, 0xC3, 0xCF, 0xB0, 0x8C, 0x82, 0x34, 0xA5, 0xFA, 0x52, 0xB9, 0x75, 0xFC, 0x3A, 0xC3, 0xF6,
+    0xD1, 0xD1, 0x61, 0xA5, 0xA0, 0x97, 0x04, 0xFD, 0xD6, 0x78, 0x77, 0xFD, 0x19, 0x6D, 0xBE, 0x49,
+    0x13, 0xF2, 0x55, 0x9A, 0x4F, 0xF9, 0xAD, 0x28, 0x27, 0xD3, 0x85, 0xBC, 0xC9, 0x18, 0x02, 0xE2,
+    0x69, 0xFD, 0x5D, 0x8D, 0xFF, 0xF4, 0x3E, 0xE3, 0x56, 0x13, 0x12, 0x35, 0xA2, 0x1A, 0x48, 0x7B,
+    0x7C, 0xD2, 0xA9, 0x36, 0x11, 0x91, 0xF9, 0x97, 0xD0, 0xE3, 0xC5, 0x3D, 0xBE, 0x44, 0x41, 0x6C,
+    0x99, 0x0C, 0x06, 0xBC, 0x20, 0x5F, 0xF0, 0x72, 0xE6, 0x76, 0x8C, 0x57, 0x99, 0x2D, 0xE2, 0x21,
+    0xEE, 0xB3, 0xBA, 0x4C, 0x56, 0x09, 0xDD, 0x3C, 0xED, 0x13, 0x9F, 0xD9, 0x93, 0xCC, 0xA7, 0xDE,
+    0x6C, 0x1C, 0xE8, 0xB2, 0x6E, 0x07, 0x27, 0x7C, 0xEF, 0xF6, 0x30, 0x4F, 0x56, 0x33, 0x7F, 0x89,
+    0x92, 0xBC, 0x0B, 0x85, 0x88, 0x99, 0x9D, 0xB1, 0x96, 0x75, 0x40, 0x92, 0xB5, 0xC1, 0x05, 0xB5,
+    0x71, 0x65, 0xB2, 0xC8, 0x59, 0x93, 0xFC, 0xEF, 0x9F, 0xF4, 0x5C, 0x51, 0x23, 0x0F, 0x85, 0xA8,
+    0xA4, 0x37, 0xD2, 0x7E, 0x27, 0x7D, 0x26, 0xA7, 0x09, 0xAF, 0xE6, 0x00, 0x7D, 0x5E, 0xFE, 0x6F,
+    0xCF, 0x58, 0x94, 0xCB, 0x48, 0x2C, 0xA9, 0xA7, 0x74, 0x03, 0x8D, 0x6C, 0x11, 0xAC, 0x8F, 0x28,
+    0x16, 0xBC, 0xBF, 0x11, 0xA7, 0xB8, 0xF2, 0xC6, 0x96, 0x9D, 0x72, 0xFC, 0xEF, 0xA7, 0xD7, 0x3C,
+    0xB3, 0xA5, 0xD6, 0x80, 0x5F, 0xBB, 0x60, 0x23, 0x0B, 0x8A, 0xE2, 0x7C, 0x0E, 0xEC, 0xDC, 0x69,
+    0x33, 0x63, 0x27, 0xAA, 0x55, 0x81, 0x9C, 0x6C, 0x84, 0x51, 0x17, 0xA2, 0x9F, 0xD8, 0xB0, 0xA5,
+    0x08, 0xD9, 0xB7, 0xBE, 0x12, 0x1E, 0xE4, 0x3F, 0x4D, 0x56, 0x83, 0x79, 0x96, 0xCB, 0x87, 0xDB,
+    0x55, 0xB8, 0xA0, 0x6B, 0xFC, 0xA2, 0x10, 0x58, 0xA8, 0xEE, 0x98, 0xB0, 0xF6, 0x78, 0x39, 0x76,
+    0xF9, 0xB7, 0xE1, 0xC5, 0xC8, 0xEA, 0x7D, 0xAE, 0xB0, 0xF9, 0x76, 0x1F, 0x01, 0x87, 0x14, 0xEB,
+    0x8F, 0xDA, 0x8E, 0x15, 0xD1, 0x91, 0xAD, 0x5C, 0xEE, 0xD9, 0x32, 0x5E, 0xE2, 0xBD, 0x35, 0xEB,
+    0xAC, 0x75, 0xF9, 0xD7, 0x5A, 0xFF, 0xCD, 0x23, 0x26, 0x6A, 0x35, 0xAB, 0xCF, 0x50, 0xAA, 0xA3,
+    0x18, 0xB5, 0x1F, 0xD9, 0xB0, 0xF6, 0xE8, 0x9E, 0x66, 0x83, 0x31, 0xE7, 0xA6, 0x88, 0xD8, 0xFB,
+    0xA7, 0x46, 0x60, 0x93, 0xF8, 0x3E, 0x16, 0x2D, 0xDA, 0x26, 0xF3, 0x63, 0x16, 0x32, 0xF7, 0x08,
+    0x70, 0xF2, 0x69, 0x7D, 0xE5, 0x9E, 0x8A, 0xA7, 0xA9, 0xA0, 0x4A, 0xA2, 0x9E, 0x6D, 0x34, 0x6C,
+    0x7A, 0xF8, 0x72, 0x82, 0x5F, 0x14, 0x57, 0xFE, 0x32, 0x95, 0xF6, 0x82, 0x4D, 0xED, 0x90, 0x05,
+    0xF9, 0x07, 0xCD, 0x5A, 0x3F, 0x6C, 0xDE, 0xD6, 0x11, 0x3F, 0x92, 0x91, 0xD8, 0x9A, 0x40, 0xE9,
     0x21, 0x42, 0x00, 0x07, 0xD5, 0xEB, 0x18, 0x48, 0xB1, 0xB8, 0x7A, 0x90, 0xFD, 0x18, 0x04, 0xA8,
-    0x87, 0x0E, 0xF1, 0x60, 0xC1, 0xA3, 0x8B, 0x8E, 0xE9, 0x20, 0x14, 0x48, 0x91, 0x0C, 0xB6, 0xC8,
-    0xD8, 0x43, 0x87, 0x0E, 0x51, 0x81, 0x76, 0xCA, 0x10, 0x0F, 0x19, 0x9C, 0x6F, 0x51, 0x07, 0x0F,
+    0x86, 0x0E, 0xF1, 0x60, 0xC1, 0xA3, 0x8B, 0x8E, 0xE9, 0x20, 0x14, 0x48, 0x91, 0x0C, 0xB2, 0xC8,
+    0xC4, 0x43, 0x87, 0x0E, 0x51, 0x81, 0x76, 0xCA, 0x10, 0x0F, 0x19, 0x9C, 0x6F, 0x51, 0x07, 0x0F,
     0x0A, 0xA0, 0x9A, 0xAC, 0x35, 0x64, 0xC8, 0x10, 0xC6, 0x45, 0x9B, 0x2D, 0x65, 0x6B, 0x15, 0x69,
-    0xEC, 0x41, 0xAF, 0x29, 0x8D, 0x50, 0x36, 0xF9, 0xBD, 0xFE, 0xEE, 0xC8, 0xEF, 0x8F, 0x14, 0x44,
+    0xEC, 0xC1, 0xAF, 0x29, 0x8D, 0x50, 0x36, 0xF9, 0xBD, 0xFC, 0xEE, 0xC8, 0xEF, 0x8F, 0x94, 0xC6,
     0x70, 0x6A, 0x25, 0xD1, 0xA7, 0xEF, 0x1D, 0xF9, 0x91, 0x8F, 0xF7, 0xEE, 0xDD, 0xBB, 0xFB, 0xDD,
     0xDD, 0xA3, 0x96, 0x28, 0xCB, 0x6D, 0x9E, 0xE5, 0x4B, 0xC4, 0x9F, 0x79, 0x5A, 0xA2, 0x88, 0x74,
     0xF7, 0x17, 0xEB, 0x38, 0x89, 0x93, 0x34, 0x4B, 0xB9, 0x87, 0xCD, 0xE7, 0x62, 0x72, 0x73, 0x92,
-    0xF6, 0xFC, 0xE7, 0xE4, 0x58, 0x5B, 0x04, 0x76, 0xD7, 0xA8, 0x2F, 0x3E, 0xAC, 0xA2, 0x7F, 0x7E,
-    0x60, 0xF4, 0xDD, 0x0F, 0x52, 0x7D, 0x27, 0xA7, 0x64, 0xAA, 0xE9, 0xBB, 0x5D, 0x8B, 0xBE, 0xC8,
-    0x7F, 0xA2, 0x1E, 0xE5, 0x06, 0xFD, 0x4B, 0x3C, 0x97, 0xD2, 0x73, 0x3B, 0x34, 0xE6, 0xC5, 0x9F,
-    0x08, 0xD7, 0x6C, 0x66, 0xBC, 0x26, 0xA8, 0xFD, 0xDA, 0xAB, 0xFD, 0xCA, 0xAB, 0x82, 0xCA, 0x8D,
-    0xFD, 0x9A, 0xC8, 0xE3, 0xD6, 0x10, 0x25, 0xD6, 0xC6, 0xDC, 0x28, 0x43, 0xFF, 0x24, 0xEE, 0x1B,
-    0xCE, 0x6F, 0xA3, 0xD5, 0xE4, 0x78, 0x8F, 0xD7, 0x7F, 0xA8, 0xAC, 0x6D, 0x35, 0xDA, 0x59, 0x27,
-    0xAB, 0x4E, 0x92, 0x13, 0x9F, 0xC4, 0xAD, 0xCD, 0x57, 0x43, 0x3C, 0x3B, 0x24, 0xF5, 0xBB, 0x06,
-    0x73, 0x5B, 0xC6, 0xDF, 0x69, 0xB4, 0x79, 0xB4, 0x25, 0x3A, 0x0B, 0xAA, 0xDE, 0x6C, 0x48, 0xE3,
-    0xFE, 0x66, 0x76, 0x99, 0x4E, 0xD2, 0x0C, 0x65, 0xF6, 0xBC, 0xED, 0x88, 0xAA, 0xA9, 0xA1, 0xB0,
-    0xA6, 0x8A, 0xFC, 0x86, 0x0C, 0x79, 0xAD, 0x5B, 0x60, 0xD6, 0x1E, 0x44, 0xB6, 0xE7, 0x79, 0xEC,
-    0xB7, 0xC0, 0x5D, 0x7F, 0xCA, 0xD2, 0x43, 0xBC, 0xD0, 0xDA, 0x9A, 0x02, 0x26, 0xFC, 0x08, 0xCD,
-    0x5C, 0x6E, 0x2F, 0x76, 0xD7, 0x66, 0x2E, 0xEF, 0x5D, 0xE8, 0xAE, 0x51, 0x88, 0x7E, 0x4E, 0x86,
-    0xA9, 0xBA, 0xD0, 0x1D, 0x51, 0x35, 0xF9, 0xFC, 0x5C, 0xB4, 0x70, 0x63, 0xEA, 0x8A, 0x5C, 0xC8,
-    0x6A, 0xF2, 0xF7, 0x2C, 0x85, 0xB9, 0x8E, 0x55, 0x1A, 0xC5, 0x2A, 0x56, 0xA4, 0x30, 0x7C, 0x58,
-    0x12, 0x05, 0x43, 0x1E, 0xB3, 0xA4, 0xA5, 0xA4, 0xA5, 0x73, 0xBE, 0x4D, 0x35, 0x25, 0x85, 0x4E,
-    0xC3, 0x52, 0x55, 0x3E, 0xD4, 0xFC, 0x32, 0xD4, 0xFC, 0x18, 0x7A, 0x87, 0xBA, 0x5C, 0x34, 0xD2,
-    0xE9, 0x2C, 0xB8, 0x28, 0x0A, 0xF2, 0x28, 0x0E, 0x52, 0x95, 0x87, 0x71, 0xF8, 0x70, 0x0D, 0xB7,
-    0x30, 0xCC, 0x0C, 0xD1, 0x39, 0xAF, 0x4C, 0x7C, 0x83, 0xEF, 0x92, 0x5B, 0x76, 0xEB, 0x81, 0x5B,
-    0x7B, 0x3C, 0xB1, 0x47, 0x19, 0xE4, 0x6C, 0xC9, 0xAD, 0xC9, 0xC3, 0x9D, 0x73, 0x14, 0xA4, 0x49,
-    0x1D, 0xC6, 0xCA, 0xDD, 0x4B, 0xBC, 0xFC, 0x74, 0x90, 0x2B, 0xB7, 0x58, 0x0E, 0xD3, 0x1F, 0x38,
-    0xE5, 0x19, 0x85, 0x41, 0xCC, 0x1B, 0x11, 0x1D, 0xA0, 0xDD, 0x75, 0xF4, 0x21, 0xA7, 0x3C, 0x1B,
-    0xE4, 0x9E, 0x5B, 0x28, 0xAF, 0x52, 0x1E, 0xC6, 0xCF, 0xC0, 0xC7, 0x2B, 0x66, 0xE2, 0x88, 0x1C,
-    0x2C, 0x1E, 0x14, 0xA3, 0x3F, 0xDF, 0xC0, 0x10, 0xB3, 0x58, 0x09, 0x12, 0xA1, 0x70, 0x9A, 0x86,
-    0x9F, 0x98, 0xF0, 0x7A, 0x45, 0x5E, 0x35, 0x6B, 0xAB, 0x68, 0xBB, 0xD2, 0x2F, 0x57, 0xFA, 0x7C,
-    0xA5, 0x87, 0x6D, 0x50, 0xBE, 0x47, 0x2F, 0xB8, 0x29, 0x6D, 0x85, 0xA9, 0x5B, 0x45, 0xE4, 0x9B,
-    0xDB, 0xA4, 0x3E, 0xC6, 0x32, 0x6E, 0xD7, 0xA4, 0xAF, 0xD7, 0x14, 0xDD, 0x69, 0x28, 0x28, 0x87,
-    0xE4, 0x19, 0x0D, 0xD3, 0xC0, 0xE0, 0xCB, 0x5E, 0xBE, 0x30, 0x18, 0xAC, 0xC3, 0x34, 0xCA, 0xB9,
-    0x95, 0x4B, 0x18, 0xC6, 0x3D, 0xD8, 0x8A, 0xB9, 0x15, 0x58, 0x09, 0x0C, 0x2C, 0x5E, 0x18, 0xD0,
-    0x7E, 0x1D, 0xDC, 0xEF, 0x74, 0x00, 0x31, 0x3D, 0x9C, 0x2C, 0x51, 0xF0, 0x8A, 0xBD, 0x11, 0xC6,
-    0xF3, 0xFE, 0xA3, 0xD6, 0xCB, 0x5F, 0x74, 0x4D, 0x04, 0x1D, 0xB8, 0x46, 0x51, 0x79, 0x86, 0xA9,
-    0x79, 0xCD, 0x35, 0xE7, 0x98, 0x62, 0xE5, 0x41, 0x1F, 0x1B, 0xE8, 0xC0, 0x35, 0x15, 0x74, 0xE0,
-    0x9A, 0x2D, 0x2A, 0x41, 0xCF, 0xB9, 0xC5, 0x3C, 0x74, 0x70, 0x3D, 0x0F, 0x5F, 0x19, 0x06, 0x0F,
-    0x62, 0xE6, 0x39, 0xD1, 0xC1, 0xBF, 0x56, 0xF7, 0xEB, 0x00, 0x12, 0x57, 0xDC, 0x70, 0x1A, 0xB4,
-    0xF8, 0x95, 0x5E, 0x0D, 0xF2, 0xDA, 0x2B, 0xF0, 0xDD, 0xF4, 0x8A, 0xB5, 0x30, 0xC7, 0x02, 0xFB,
-    0x7B, 0x22, 0x6C, 0xC0, 0xF6, 0x15, 0xEF, 0x6B, 0x73, 0x97, 0xFF, 0x70, 0x81, 0xA7, 0xBC, 0xB0,
-    0x31, 0x58, 0x3F, 0x78, 0x4F, 0x5A, 0xFF, 0xE1, 0x3E, 0xDC, 0x70, 0xAA, 0x5A, 0x5A, 0x5B, 0x4D,
-    0xB7, 0x54, 0xBE, 0x1C, 0xE6, 0xA4, 0x52, 0x48, 0x46, 0x57, 0xC8, 0x31, 0xE4, 0xA7, 0x98, 0x78,
-    0x71, 0x7B, 0x50, 0xC0, 0x70, 0xA1, 0x48, 0xF4, 0xF4, 0x6D, 0xAC, 0xDE, 0x2E, 0x23, 0xCF, 0x9C,
-    0xF0, 0x0C, 0x94, 0x4D, 0xAB, 0xA9, 0x03, 0xC3, 0xF6, 0x0D, 0xB9, 0xD5, 0x0B, 0x6E, 0xB5, 0x0C,
-    0xD5, 0x6F, 0x14, 0xC1, 0x1E, 0x39, 0x17, 0xFD, 0x26, 0x34, 0x3A, 0xBD, 0x4A, 0x17, 0x68, 0x21,
-    0x3D, 0xF1, 0x2E, 0x25, 0x79, 0x58, 0x7D, 0x43, 0x52, 0x28, 0x90, 0x32, 0x02, 0xA9, 0xB2, 0x06,
-    0xAB, 0x74, 0xCF, 0xC6, 0xEF, 0x5B, 0xA0, 0xD2, 0xD6, 0x33, 0x90, 0x63, 0x8B, 0x46, 0xE4, 0xB6,
-    0x78, 0x4C, 0xC1, 0x13, 0x92, 0xA9, 0xA4, 0xA3, 0xF9, 0xC1, 0x2B, 0x2D, 0x26, 0xF9, 0x60, 0x0F,
-    0xCF, 0x6E, 0x97, 0xF0, 0xED, 0xED, 0x82, 0xEC, 0x98, 0x64, 0x63, 0xA2, 0x99, 0x28, 0x26, 0xB3,
-    0x1B, 0x20, 0xE4, 0x3F, 0x05, 0xB9, 0xBC, 0xFD, 0x10, 0x30, 0xB1, 0x6D, 0x3B, 0x09, 0x4E, 0xC4,
-    0xBA, 0xD0, 0xA5, 0x2E, 0x55, 0xEA, 0x60, 0xA1, 0xC2, 0x72, 0xB6, 0x01, 0xB2, 0x34, 0x59, 0x9D,
-    0x14, 0x4E, 0x45, 0x41, 0x4D, 0x6B, 0x35, 0xFD, 0xBA, 0x16, 0x23, 0xF8, 0xCA, 0x77, 0x71, 0x98,
-    0x2E, 0x0C, 0x52, 0x7F, 0x18, 0xEB, 0xDD, 0x32, 0xF3, 0xCC, 0xD0, 0xAB, 0x5B, 0x97, 0xBF, 0x38,
-    0x49, 0x3C, 0x13, 0xED, 0x96, 0xB3, 0xC3, 0x98, 0x5D, 0x21, 0x72, 0x0D, 0x3C, 0x1C, 0x78, 0x51,
-    0xDE, 0x06, 0x64, 0xEA, 0xD4, 0x69, 0xA3, 0xDC, 0x69, 0x55, 0xE1, 0x35, 0x3A, 0xF5, 0x4D, 0x86,
-    0x7B, 0x0D, 0x29, 0xF4, 0x39, 0x0B, 0x83, 0xC3, 0xA0, 0x74, 0x8B, 0x82, 0x8A, 0x57, 0xF6, 0x76,
-    0xC5, 0x66, 0xFD, 0x0B, 0x60, 0x5C, 0x8E, 0xA5, 0x63, 0xB3, 0x00, 0x55, 0xC4, 0xF4, 0xAC, 0xD0,
-    0x2B, 0x42, 0x2B, 0xBF, 0x74, 0x2B, 0xC7, 0x84, 0xA0, 0x5E, 0x11, 0x95, 0x8B, 0xC3, 0xF3, 0xF9,
-    0xEB, 0xE5, 0xAB, 0x83, 0xB7, 0xE2, 0x7B, 0xD0, 0xB5, 0xF2, 0xA0, 0x56, 0x3A, 0x1B, 0x30, 0x46,
-    0x5C, 0x99, 0xBF, 0x04, 0xEE, 0x55, 0x04, 0x95, 0x3B, 0x66, 0xE6, 0xD2, 0x43, 0xE6, 0x8E, 0xEB,
-    0xE0, 0x1E, 0xED, 0x31, 0xF7, 0x85, 0xF7, 0x78, 0x74, 0xC3, 0xA3, 0xC3, 0xF1, 0xD6, 0x30, 0x7A,
-    0x4E, 0xBF, 0x82, 0x12, 0x52, 0x96, 0x2A, 0x24, 0xA6, 0x4B, 0x42, 0x97, 0x85, 0x6E, 0x0A, 0x35,
-    0x59, 0xE9, 0x54, 0xEE, 0xBD, 0x87, 0x8D, 0x53, 0x63, 0xA8, 0x76, 0x71, 0xF8, 0xDB, 0x6B, 0x45,
-    0xBB, 0x30, 0x00, 0x00, 0x37, 0xEC, 0x91, 0xCC, 0x71, 0x59, 0x10, 0x6A, 0x53, 0xEC, 0x1A, 0xB3,
-    0x74, 0x98, 0xBB, 0xF1, 0xC1, 0xDD, 0xBF, 0xBF, 0x01, 0xEE, 0xB0, 0x01, 0x70, 0x9F, 0x1D, 0xF4,
-    0xCE, 0x0D, 0xEB, 0x65, 0xE8, 0x7F, 0xBB, 0xC4, 0x13, 0xB0, 0x61, 0x3C, 0x01, 0x33, 0x66, 0x20,
-    0x08, 0x4A, 0xC6, 0xF7, 0xD5, 0x94, 0xE5, 0x01, 0xFE, 0x70, 0x57, 0xC3, 0x91, 0x11, 0x26, 0xED,
-    0x97, 0x30, 0xEC, 0xCD, 0xB0, 0x84, 0x6D, 0x9B, 0xA8, 0xD4, 0x1B, 0x77, 0xCB, 0xD7, 0xCB, 0x60,
-    0xCF, 0xCB, 0x59, 0x03, 0xC1, 0x75, 0xD6, 0x40, 0x28, 0x1A, 0x58, 0x12, 0x0D, 0x2C, 0xB3, 0x06,
-    0x68, 0x93, 0x35, 0xC0, 0xB1, 0xA3, 0x64, 0x79, 0xA0, 0x01, 0x70, 0x5F, 0x78, 0x8F, 0x66, 0xE1,
-    0x41, 0xCA, 0xA0, 0x55, 0xDD, 0x31, 0x28, 0xC6, 0xCE, 0xC8, 0x3D, 0x58, 0x5B, 0x80, 0x6A, 0x84,
-    0x98, 0x82, 0xDC, 0x61, 0x17, 0x3C, 0x22, 0xD3, 0xD9, 0x35, 0x2E, 0xA1, 0xFD, 0x08, 0x06, 0xA5,
-    0x60, 0x50, 0x91, 0x09, 0xAB, 0xA4, 0x74, 0x39, 0xA4, 0x9E, 0xFA, 0x3D, 0x20, 0xE3, 0x02, 0x73,
-    0x08, 0x25, 0x78, 0x70, 0xCC, 0xC4, 0x47, 0xA0, 0x84, 0x94, 0x78, 0xBB, 0x33, 0xF1, 0x79, 0xD2,
-    0x12, 0x79, 0x13, 0xC1, 0xFB, 0xCC, 0x30, 0x15, 0x94, 0x71, 0x1E, 0x70, 0xA0, 0xF2, 0x3E, 0xE1,
-    0x87, 0xBD, 0xED, 0x96, 0xBD, 0xE7, 0x1A, 0x1B, 0x71, 0xF8, 0x12, 0x53, 0x45, 0x1C, 0x4C, 0x96,
-    0x90, 0x31, 0x60, 0xB9, 0xE1, 0x9D, 0x44, 0x6B, 0x83, 0x0C, 0x2C, 0xE0, 0x60, 0x60, 0x51, 0xF1,
-    0x5C, 0xD8, 0x0C, 0x25, 0x5A, 0x04, 0x0D, 0xF9, 0x05, 0xF9, 0x2D, 0x2C, 0x0F, 0xEA, 0xA6, 0x6C,
-    0x8F, 0x56, 0x6D, 0x09, 0x64, 0xCB, 0xB8, 0x2B, 0xAD, 0x88, 0x3C, 0x76, 0x22, 0x68, 0x28, 0x92,
-    0x44, 0x22, 0xE1, 0xB3, 0x74, 0x5C, 0xE4, 0x9C, 0x8B, 0x27, 0xA3, 0xCB, 0xB8, 0x9E, 0xE1, 0x11,
-    0x11, 0x46, 0x05, 0xA0, 0x67, 0x8E, 0x8D, 0x3E, 0xC5, 0xA8, 0x5B, 0xC0, 0x34, 0x92, 0x82, 0x77,
-    0xC0, 0x33, 0xCA, 0x98, 0xFF, 0x69, 0xBF, 0x95, 0x3B, 0x17, 0x8E, 0x89, 0x9C, 0x7E, 0x71, 0x95,
-    0x79, 0x1A, 0xE1, 0x6C, 0xD8, 0x34, 0xFD, 0xFC, 0x0A, 0x1D, 0xF8, 0x7C, 0xBF, 0x9A, 0x3C, 0x15,
-    0x4F, 0xC6, 0x35, 0xB7, 0x78, 0xDC, 0xE2, 0x0C, 0xD3, 0xF2, 0x35, 0x91, 0xC4, 0x3C, 0xB1, 0x6C,
-    0xC3, 0xC3, 0x65, 0x2B, 0xFE, 0x0F, 0xD9, 0x00, 0x29, 0xB6, 0xA1, 0xC9, 0xD1, 0xDB, 0x35, 0x24,
-    0xE6, 0xB8, 0x6A, 0x18, 0xA6, 0x49, 0x01, 0x24, 0x00, 0x9B, 0x74, 0x16, 0xC7, 0x17, 0x70, 0xBC,
-    0x12, 0x75, 0xA6, 0x51, 0x75, 0x47, 0xC7, 0x74, 0x47, 0x00, 0xB8, 0xB5, 0x8C, 0x32, 0x69, 0x77,
-    0x0C, 0xA9, 0xBB, 0x1E, 0xAD, 0xAC, 0x9A, 0x3E, 0x1F, 0x90, 0xE3, 0xFB, 0xFD, 0x6F, 0xC3, 0xF7,
-    0x67, 0x04, 0xC0, 0x20, 0xA6, 0x40, 0xB9, 0xC1, 0xA4, 0x42, 0x39, 0x6A, 0x24, 0xA9, 0x6E, 0xC6,
-    0x11, 0xD6, 0xB6, 0xBE, 0xE5, 0x63, 0xF7, 0x99, 0xE5, 0x4C, 0x18, 0xF9, 0x3A, 0xD2, 0x02, 0x4C,
-    0x1C, 0x09, 0xB4, 0x2E, 0x80, 0x4B, 0x2A, 0xC7, 0x64, 0x4F, 0x91, 0x36, 0xA3, 0x28, 0x9D, 0x7C,
-    0x1D, 0x91, 0xBB, 0xD2, 0x4F, 0x84, 0x63, 0x08, 0x8C, 0x91, 0x02, 0x39, 0x85, 0x6B, 0xD7, 0x91,
-    0x03, 0x67, 0x5C, 0x09, 0x04, 0x3C, 0x06, 0x87, 0x29, 0xF4, 0xE4, 0x65, 0x53, 0x0C, 0xA3, 0x0C,
-    0xC1, 0x88, 0x82, 0x38, 0xE1, 0xB9, 0x31, 0x7C, 0x76, 0x5E, 0xAC, 0x0B, 0x31, 0x3A, 0xEA, 0x2A,
-    0x0A, 0xA2, 0xAB, 0xA3, 0x1C, 0xAB, 0x9F, 0xB2, 0xCD, 0x59, 0xAD, 0xB9, 0x6B, 0xE1, 0xDD, 0x90,
-    0xD9, 0x1B, 0x13, 0x27, 0x15, 0x9C, 0x9A, 0x26, 0xD0, 0x7E, 0x4F, 0x0E, 0xDC, 0xE8, 0xC9, 0x05,
-    0x26, 0x46, 0x08, 0xF8, 0xB9, 0x66, 0x91, 0x97, 0x5A, 0x77, 0xEB, 0x3D, 0x73, 0x71, 0x04, 0xD1,
-    0x22, 0x11, 0x57, 0x30, 0x24, 0x02, 0xC5, 0xDF, 0xB9, 0x2C, 0x0E, 0x8B, 0xE2, 0x89, 0x13, 0xB1,
-    0x85, 0x46, 0x3F, 0x83, 0x40, 0x5B, 0x30, 0x45, 0xE0, 0xC5, 0xC9, 0xEF, 0x5A, 0x16, 0xCE, 0x5F,
-    0x24, 0x79, 0xEF, 0xC8, 0xBC, 0x53, 0x4E, 0x43, 0xC2, 0x77, 0x25, 0x06, 0x2C, 0x05, 0x86, 0xC7,
-    0xB9, 0x09, 0xFC, 0x6A, 0xAD, 0xB7, 0x0F, 0x6D, 0x9B, 0xC8, 0xD6, 0xA8, 0xA3, 0x78, 0xB4, 0x27,
-    0xFE, 0xA2, 0xFF, 0xA2, 0xDD, 0xD1, 0x2C, 0xC6, 0x45, 0x36, 0xDF, 0xA8, 0xE0, 0x8A, 0xB5, 0xEE,
-    0xC1, 0xF8, 0x69, 0x79, 0xAE, 0xF0, 0xB9, 0x6F, 0xF3, 0xF0, 0x03, 0x94, 0x1B, 0xF5, 0xB3, 0x12,
-    0x32, 0x9F, 0x92, 0xA7, 0x72, 0x0C, 0x54, 0x8F, 0xEF, 0x58, 0xF7, 0x4F, 0xC9, 0x10, 0x1A, 0x7D,
-    0xB7, 0x03, 0x2B, 0xAE, 0x42, 0x09, 0x70, 0x8C, 0xBB, 0xA1, 0x2C, 0x0B, 0x00, 0x8E, 0xD7, 0x6F,
-    0xD4, 0x5F, 0x1E, 0x94, 0x75, 0xB4, 0xC0, 0xA4, 0x21, 0xA8, 0x66, 0x40, 0xC9, 0xBB, 0x2B, 0xE3,
-    0xBB, 0x8E, 0xF4, 0x74, 0xE5, 0x29, 0x6F, 0xC8, 0x34, 0x10, 0x6E, 0x28, 0xD4, 0x71, 0x11, 0xB0,
-    0xB1, 0x28, 0x63, 0xE1, 0xD9, 0x1D, 0x16, 0xFF, 0x64, 0x97, 0x63, 0xB8, 0x9C, 0x93, 0xDB, 0x07,
-    0x9C, 0x52, 0xED, 0x0A, 0xDC, 0xB9, 0x1D, 0x46, 0x8D, 0xB3, 0x0C, 0x8D, 0x4A, 0x11, 0xF5, 0xA5,
-    0x8D, 0x5D, 0xBB, 0xE3, 0xA2, 0x07, 0xCA, 0x31, 0x14, 0x43, 0x0A, 0xB4, 0x12, 0xDA, 0x30, 0xBD,
-    0x67, 0x99, 0xFE, 0xC3, 0xA6, 0xA0, 0x65, 0x96, 0x33, 0xD5, 0x86, 0xA9, 0xAA, 0x99, 0x06, 0x2D,
-    0x53, 0xCF, 0x32, 0x25, 0xFB, 0x0E, 0x53, 0x44, 0x60, 0x50, 0x2D, 0x34, 0x14, 0xEA, 0xB3, 0xB1,
-    0xB1, 0xA8, 0x8B, 0x40, 0x25, 0x2E, 0x49, 0x62, 0x76, 0xFF, 0x39, 0x31, 0x08, 0x25, 0x50, 0xEB,
-    0x4F, 0x27, 0x6D, 0x5D, 0x32, 0xE4, 0x4C, 0xDC, 0x20, 0x90, 0x60, 0x93, 0xF4, 0xFA, 0x84, 0xA1,
-    0xA2, 0x3B, 0x90, 0x24, 0x94, 0x0D, 0x8A, 0x88, 0x77, 0x28, 0x18, 0x31, 0x3D, 0xB9, 0xD5, 0x29,
-    0x64, 0x44, 0xE3, 0xAF, 0xD0, 0xBE, 0x4F, 0xD7, 0x9F, 0x9F, 0x1D, 0xF6, 0x7C, 0x02, 0xE1, 0x09,
-    0xDC, 0x8C, 0x60, 0x05, 0xD9, 0x7D, 0x64, 0x96, 0x3D, 0xCE, 0xD2, 0x9C, 0x08, 0xE1, 0x48, 0xEA,
-    0xE6, 0xB5, 0x93, 0x4C, 0x53, 0x49, 0xC0, 0x3E, 0x47, 0x63, 0x9D, 0x1F, 0x23, 0x69, 0x3B, 0xCA,
-    0xCB, 0x8E, 0xE7, 0xD9, 0xAC, 0x83, 0xBB, 0x95, 0xE4, 0xC3, 0x0C, 0xFF, 0xCF, 0xD0, 0x33, 0xC7,
-    0x4B, 0x5A, 0x59, 0xF0, 0xA0, 0x0E, 0x25, 0xC6, 0x6F, 0xB0, 0x52, 0x33, 0xD6, 0xF3, 0x1B, 0x41,
-    0x4D, 0xD3, 0x11, 0xE2, 0x78, 0x48, 0x1B, 0xA6, 0x7C, 0xCE, 0x7B, 0x2D, 0xD0, 0xE7, 0x9F, 0x25,
-    0x0F, 0x89, 0x6F, 0x1D, 0xC8, 0xE5, 0x8E, 0x85, 0x56, 0x89, 0xCE, 0xD0, 0x3C, 0xD0, 0x7C, 0x8D,
-    0xD4, 0x9B, 0x28, 0x90, 0x3F, 0x63, 0x1C, 0x42, 0x9F, 0x8C, 0xE4, 0xC8, 0xBF, 0xF9, 0x3A, 0xDF,
-    0x7F, 0x03, 0xFD, 0xF6, 0x7D, 0x18, 0x3B, 0x02, 0xFB, 0x65, 0xDE, 0xA5, 0x32, 0x93, 0x39, 0x44,
-    0x32, 0x87, 0x44, 0xE6, 0xF0, 0x25, 0xCF, 0x81, 0xF1, 0x41, 0x97, 0xDE, 0x1D, 0x96, 0xDE, 0xBF,
-    0xC6, 0x34, 0x14, 0xB9, 0xE7, 0x85, 0x2E, 0x0B, 0xBD, 0x25, 0x8F, 0x73, 0xC8, 0xD1, 0x5F, 0x14,
-    0x3C, 0x87, 0x2F, 0x73, 0x9E, 0x03, 0x70, 0x1C, 0x73, 0xB0, 0xCC, 0x90, 0x2F, 0x8E, 0xE7, 0xF0,
-    0x98, 0xE7, 0xE0, 0x94, 0x73, 0x13, 0x69, 0x24, 0x75, 0xE8, 0x31, 0xA2, 0xAB, 0x9D, 0x48, 0xCB,
-    0x2E, 0x47, 0x5F, 0x3F, 0x8E, 0xED, 0x23, 0xB1, 0x55, 0x68, 0x8B, 0x55, 0x5B, 0x05, 0x76, 0x9D,
-    0xE3, 0x7B, 0x23, 0x51, 0x7E, 0xF3, 0xC8, 0x28, 0x23, 0x68, 0x25, 0x70, 0x0C, 0xD4, 0xB2, 0x05,
-    0x67, 0x5B, 0x9A, 0xF5, 0x03, 0x84, 0x6B, 0xA7, 0xD2, 0xAA, 0xAF, 0x29, 0xF2, 0xD4, 0x81, 0x22,
-    0xEF, 0x78, 0x48, 0xDB, 0xD5, 0xCE, 0x92, 0x71, 0x52, 0xC6, 0xD2, 0x3A, 0xF5, 0x9A, 0xA4, 0x93,
+    0xF6, 0xEC, 0x67, 0xE4, 0x58, 0x5B, 0x04, 0xF6, 0x9E, 0x51, 0x9F, 0x7F, 0x50, 0x45, 0xFF, 0x7C,
+    0xDF, 0xE8, 0x5B, 0xEF, 0xA7, 0xFA, 0x66, 0x4E, 0xC9, 0x54, 0xD3, 0xB7, 0xBA, 0x16, 0x7D, 0x9E,
+    0xFF, 0x44, 0x3D, 0xC8, 0x0D, 0xFA, 0x97, 0x78, 0x2E, 0xA5, 0x67, 0xF6, 0x68, 0xCC, 0x8B, 0x3F,
+    0x11, 0xAE, 0xD9, 0xCC, 0x78, 0x4D, 0x50, 0xFB, 0xB5, 0x57, 0xFB, 0x95, 0x57, 0x05, 0x95, 0x1B,
+    0xFB, 0x35, 0x91, 0xC7, 0xAD, 0x21, 0x4A, 0xAC, 0x8D, 0xB9, 0x51, 0x86, 0xFE, 0x49, 0xDC, 0x37,
+    0x9C, 0xDF, 0x40, 0xAB, 0xC9, 0xF1, 0x1E, 0x6E, 0xFE, 0x50, 0x59, 0xDB, 0x6A, 0xB4, 0xB3, 0x4E,
+    0x56, 0x9D, 0x24, 0x27, 0x3E, 0x89, 0x5B, 0xDB, 0x2F, 0x87, 0x78, 0x76, 0x48, 0xEA, 0x77, 0x0D,
+    0xE6, 0xB6, 0x8C, 0xBF, 0xD3, 0x68, 0xF3, 0x68, 0x4B, 0x74, 0x16, 0x54, 0xBD, 0xDE, 0x90, 0xC6,
+    0xFD, 0xED, 0xEC, 0x12, 0x9D, 0xA4, 0x19, 0xCA, 0xEC, 0x8A, 0xED, 0x88, 0xAA, 0xA9, 0xA1, 0xB0,
+    0xA6, 0x8A, 0xFC, 0x86, 0x0C, 0x79, 0xAD, 0x5B, 0x60, 0xD6, 0x1E, 0x44, 0xB6, 0x2B, 0x3C, 0xF6,
+    0x9B, 0xE0, 0xAE, 0x3F, 0x61, 0xE9, 0x21, 0x5E, 0x68, 0x6D, 0x4D, 0x01, 0x13, 0x7E, 0x84, 0x66,
+    0x2E, 0xB5, 0x17, 0xBA, 0x6B, 0x33, 0x97, 0xF6, 0xCF, 0x77, 0xD7, 0x28, 0x44, 0x3F, 0x27, 0xC3,
+    0x54, 0x5D, 0xE8, 0x8E, 0xA8, 0x9A, 0x7C, 0x7E, 0x2E, 0x5A, 0xB8, 0x3A, 0x75, 0x45, 0x2E, 0x64,
+    0x35, 0xF9, 0xFB, 0x96, 0xC2, 0x5C, 0xC7, 0x2A, 0x8D, 0x62, 0x15, 0x2B, 0x52, 0x18, 0x3E, 0x2C,
+    0x89, 0x82, 0x21, 0x8F, 0x59, 0xD2, 0x52, 0xD2, 0xD2, 0x39, 0xDF, 0xA6, 0x9A, 0x92, 0x42, 0xA7,
+    0x61, 0xA9, 0x2A, 0x1F, 0x6A, 0x7E, 0x11, 0x6A, 0x7E, 0x08, 0xBD, 0x43, 0x5D, 0x2E, 0x1A, 0xE9,
+    0x74, 0x16, 0x5C, 0x14, 0x05, 0x79, 0x14, 0x07, 0xA9, 0xCA, 0xC3, 0x38, 0xBC, 0xBF, 0x81, 0x5B,
+    0x18, 0x66, 0x86, 0xE8, 0x9C, 0x57, 0x26, 0xBE, 0xC1, 0x77, 0xC9, 0x2D, 0xBB, 0xF5, 0xC0, 0xAD,
+    0x7D, 0x9E, 0xD8, 0x83, 0x0C, 0x72, 0xB6, 0xE4, 0xD6, 0xE4, 0xE1, 0xCE, 0x39, 0x0A, 0xD2, 0xA4,
+    0x0E, 0x63, 0xE5, 0xEE, 0x27, 0x5E, 0x7E, 0x3A, 0xC8, 0x95, 0x5B, 0x2C, 0x87, 0xE9, 0x0F, 0x9C,
+    0xF2, 0x8C, 0xC2, 0x20, 0xE6, 0xB5, 0x88, 0x0E, 0xD1, 0xEE, 0x3A, 0xFA, 0x90, 0x53, 0x9E, 0x0D,
+    0x72, 0xCF, 0x2D, 0x94, 0x57, 0x29, 0x0F, 0xE3, 0x67, 0xE0, 0xE3, 0x15, 0x33, 0x71, 0x44, 0x0E,
+    0x16, 0x0F, 0x8A, 0xD1, 0x9F, 0x6D, 0x61, 0x88, 0x59, 0xAC, 0x04, 0x89, 0x50, 0x38, 0x4D, 0xC3,
+    0x8F, 0x4D, 0x78, 0xA5, 0x22, 0xAF, 0x9A, 0xB5, 0x55, 0xB4, 0x5B, 0xE9, 0x17, 0x2B, 0xBD, 0x52,
+    0xE9, 0x61, 0x1B, 0x94, 0xEF, 0xD2, 0x73, 0x6E, 0x4A, 0x3B, 0x61, 0xEA, 0x56, 0x11, 0xF9, 0xE6,
+    0x06, 0xA9, 0x8F, 0xB0, 0x8C, 0xBB, 0x35, 0xE9, 0x2B, 0x35, 0x45, 0x37, 0x1B, 0x0A, 0xCA, 0x21,
+    0x79, 0x46, 0xC3, 0x34, 0x30, 0xF8, 0xB2, 0x97, 0x2F, 0x0C, 0x06, 0x9B, 0x30, 0x8D, 0x72, 0x6E,
+    0xF5, 0x22, 0x86, 0x71, 0x0F, 0xB7, 0x62, 0x6E, 0x15, 0x56, 0x02, 0x03, 0x8B, 0x17, 0x06, 0x74,
+    0x50, 0x07, 0x77, 0x3A, 0x1D, 0x40, 0x4C, 0x0F, 0x27, 0x4B, 0x14, 0xBC, 0x64, 0xAF, 0x86, 0xF1,
+    0xBC, 0xFF, 0xA0, 0xF5, 0xF2, 0xE7, 0x5D, 0x13, 0x41, 0x07, 0xAE, 0x51, 0x54, 0x9E, 0x61, 0x6A,
+    0x5E, 0x71, 0xCD, 0x39, 0xA6, 0x58, 0x79, 0xD0, 0x87, 0x06, 0x3A, 0x70, 0x4D, 0x05, 0x1D, 0xB8,
+    0x66, 0x87, 0x4A, 0xD0, 0x73, 0x6E, 0x31, 0x0F, 0x1D, 0x5C, 0xC9, 0xC3, 0x97, 0x86, 0xC1, 0xDD,
+    0x98, 0x79, 0x4E, 0x74, 0xF0, 0xAF, 0xB5, 0x83, 0x3A, 0x80, 0xC4, 0x15, 0x37, 0x9C, 0x06, 0x2D,
+    0x7E, 0xA5, 0x97, 0x83, 0xBC, 0xF6, 0x0A, 0x7C, 0xB7, 0xBD, 0x62, 0x23, 0xCC, 0xB1, 0xC0, 0xFE,
+    0xBE, 0x08, 0x1B, 0xB0, 0x7D, 0xC5, 0x07, 0xDA, 0xDC, 0xA5, 0x3F, 0x9C, 0xE7, 0x29, 0x2F, 0x6C,
+    0x0D, 0x36, 0x0F, 0xDF, 0x93, 0xD6, 0x7F, 0xB8, 0x0F, 0x37, 0x9C, 0xAA, 0x96, 0x36, 0xD6, 0xD2,
+    0x1D, 0x95, 0x2F, 0x87, 0x39, 0xA9, 0x14, 0x92, 0xD1, 0x3A, 0x39, 0x86, 0xFC, 0x14, 0x13, 0x2F,
+    0x6E, 0x0C, 0x0A, 0x18, 0x2E, 0x14, 0x89, 0x9E, 0xBE, 0x8D, 0xD5, 0x5B, 0x65, 0xE4, 0x99, 0x13,
+    0x9E, 0x81, 0xB2, 0x69, 0x2D, 0x75, 0x60, 0xD8, 0xBE, 0x21, 0xB7, 0x7A, 0xCE, 0xAD, 0x96, 0xA1,
+    0xFA, 0xAD, 0x22, 0xD8, 0x27, 0xE7, 0x82, 0xDF, 0x84, 0x46, 0xA7, 0x97, 0xE9, 0x3C, 0x2D, 0xA4,
+    0x27, 0xDE, 0xA1, 0x24, 0x0F, 0xAB, 0x6F, 0x48, 0x0A, 0x05, 0x52, 0x46, 0x20, 0x55, 0xD6, 0x60,
+    0x95, 0x6E, 0xDB, 0xF8, 0x3D, 0x0B, 0x54, 0xDA, 0x79, 0x0A, 0x72, 0xEC, 0xD0, 0x88, 0xDC, 0x10,
+    0x8F, 0x29, 0x78, 0x42, 0x32, 0x95, 0x74, 0x34, 0x3F, 0x78, 0xA5, 0xC5, 0x24, 0xEF, 0xEE, 0xE3,
+    0xD9, 0xDD, 0x12, 0xBE, 0xBD, 0x5B, 0x90, 0x1D, 0x93, 0x6C, 0x4C, 0x34, 0x13, 0xC5, 0x64, 0x76,
+    0x0B, 0x84, 0xFC, 0x27, 0x20, 0x97, 0x76, 0xEF, 0x03, 0x26, 0x76, 0x6D, 0x27, 0xC1, 0x89, 0x58,
+    0x17, 0xBA, 0xD4, 0xA5, 0x4A, 0x1D, 0x2C, 0x54, 0x58, 0xCE, 0x36, 0x40, 0x96, 0x26, 0xAB, 0x93,
+    0xC2, 0xA9, 0x28, 0xA8, 0x69, 0xA3, 0xA6, 0x5F, 0xD7, 0x62, 0x04, 0x5F, 0xF9, 0x2E, 0x0E, 0xD3,
+    0x85, 0x41, 0xEA, 0x0F, 0x63, 0x7D, 0xAF, 0xCC, 0x3C, 0x33, 0xF4, 0xEA, 0xD6, 0xE5, 0x2F, 0x4E,
+    0x12, 0xCF, 0x44, 0xF7, 0xCA, 0xD9, 0x61, 0xCC, 0xAE, 0x10, 0xB9, 0x06, 0x1E, 0x0E, 0xBC, 0x28,
+    0x6F, 0x00, 0x32, 0x75, 0xEA, 0xB4, 0x51, 0xEE, 0xB4, 0xAA, 0xF0, 0x1A, 0x9D, 0xFA, 0x26, 0xC3,
+    0xBD, 0x86, 0x14, 0xFA, 0x9C, 0x85, 0xC1, 0x61, 0x50, 0xBA, 0x4E, 0x41, 0xC5, 0x2B, 0x7B, 0xA3,
+    0x62, 0xB3, 0xFE, 0x05, 0x30, 0x2E, 0xC7, 0xD2, 0xB1, 0x59, 0x80, 0x2A, 0x62, 0x7A, 0x56, 0xE8,
+    0xBA, 0xD0, 0xCA, 0x2F, 0xDD, 0xCA, 0x31, 0x21, 0xA8, 0x57, 0x44, 0xE5, 0xE2, 0x70, 0x25, 0x7F,
+    0xB5, 0x7C, 0x79, 0xF0, 0x66, 0x7C, 0x1B, 0xBA, 0x56, 0x1E, 0xD4, 0x4A, 0x67, 0x03, 0xC6, 0x88,
+    0xF5, 0xF9, 0x8B, 0xE0, 0x5E, 0x45, 0x50, 0xB9, 0x63, 0x66, 0x2E, 0xDE, 0x67, 0xEE, 0xB8, 0x0E,
+    0xEE, 0xD1, 0x3E, 0x73, 0x5F, 0x78, 0x97, 0x47, 0x37, 0x3C, 0x3A, 0x1C, 0x6F, 0x03, 0xA3, 0xE7,
+    0xF4, 0x2B, 0x28, 0x21, 0x65, 0xA9, 0x42, 0x62, 0xBA, 0x24, 0x74, 0x59, 0xE8, 0xB6, 0x50, 0x93,
+    0x95, 0x4E, 0xE5, 0xDE, 0xBE, 0xDF, 0x38, 0x35, 0x86, 0x6A, 0x17, 0x87, 0xBF, 0x7D, 0xA3, 0x68,
+    0x17, 0x06, 0x00, 0xE0, 0x86, 0x3D, 0x92, 0x39, 0x2E, 0x0B, 0x42, 0x6D, 0x8B, 0x5D, 0x63, 0x96,
+    0x0E, 0x73, 0x37, 0x3E, 0xB8, 0xFB, 0x77, 0xB6, 0xC0, 0x1D, 0x36, 0x00, 0xEE, 0xB3, 0x83, 0xDE,
+    0xB9, 0x61, 0xBD, 0x0C, 0xFD, 0x6F, 0x95, 0x78, 0x02, 0x36, 0x8C, 0x27, 0x60, 0xC6, 0x0C, 0x04,
+    0x41, 0xC9, 0xF8, 0xBE, 0x96, 0xB2, 0x3C, 0xC0, 0x1F, 0xEE, 0x6A, 0x38, 0x32, 0xC2, 0xA4, 0xFD,
+    0x12, 0x86, 0xBD, 0x1D, 0x96, 0xB0, 0x6D, 0x13, 0x95, 0x7A, 0xEB, 0x56, 0xF9, 0x6A, 0x19, 0xEC,
+    0x7B, 0x39, 0x6B, 0x20, 0xB8, 0xC2, 0x1A, 0x08, 0x45, 0x03, 0x4B, 0xA2, 0x81, 0x65, 0xD6, 0x00,
+    0x6D, 0xB3, 0x06, 0x38, 0x76, 0x94, 0x2C, 0x0F, 0x34, 0x00, 0xEE, 0x0B, 0xEF, 0xD2, 0x2C, 0x3C,
+    0x48, 0x19, 0xB4, 0xAA, 0x3B, 0x06, 0xC5, 0xD8, 0x19, 0xB9, 0x07, 0x6B, 0x0B, 0x50, 0x8D, 0x10,
+    0x53, 0x90, 0x3B, 0xEC, 0x82, 0x47, 0x64, 0x3A, 0xBB, 0xC6, 0x25, 0xB4, 0x1F, 0xC1, 0xA0, 0x14,
+    0x0C, 0x2A, 0x32, 0x61, 0x95, 0x94, 0x2E, 0x87, 0xD4, 0x53, 0xBF, 0x07, 0x64, 0x9C, 0x67, 0x0E,
+    0xA1, 0x04, 0x0F, 0x8E, 0x99, 0xF8, 0x08, 0x94, 0x90, 0x12, 0x6F, 0x77, 0x26, 0x3E, 0x4F, 0x5A,
+    0x22, 0x6F, 0x22, 0x78, 0x9F, 0x19, 0xA6, 0x82, 0x32, 0xCE, 0x5D, 0x0E, 0x54, 0xDE, 0xC7, 0xFC,
+    0xB0, 0xB7, 0xDB, 0xB2, 0xF7, 0xBC, 0xC1, 0x46, 0x1C, 0xBE, 0xC0, 0x54, 0x11, 0x07, 0x93, 0x25,
+    0x64, 0x0C, 0x58, 0x6E, 0x78, 0x27, 0xD1, 0xC6, 0x20, 0x03, 0x0B, 0x38, 0x18, 0x58, 0x54, 0x3C,
+    0x17, 0x36, 0x43, 0x89, 0x16, 0x41, 0x43, 0x7E, 0x41, 0x7E, 0x0B, 0xCB, 0x83, 0xBA, 0x29, 0xDB,
+    0xA7, 0x35, 0x5B, 0x02, 0xD9, 0x32, 0xEE, 0x4A, 0xAB, 0x22, 0x8F, 0x9D, 0x08, 0x1A, 0x8A, 0x24,
+    0x91, 0x48, 0xF8, 0x34, 0x1D, 0x17, 0x39, 0xE7, 0xE2, 0xC9, 0xE8, 0x32, 0xAE, 0x67, 0x78, 0x44,
+    0x84, 0x51, 0x01, 0xE8, 0x99, 0x63, 0xA3, 0x4F, 0x31, 0xEA, 0x16, 0x30, 0x8D, 0xA4, 0xE0, 0x6D,
+    0xF0, 0x8C, 0x32, 0xE6, 0x7F, 0xDA, 0x6F, 0xE5, 0xCE, 0xF9, 0x63, 0x22, 0xA7, 0x5F, 0x5C, 0x66,
+    0x9E, 0x46, 0x38, 0x1B, 0x36, 0x4D, 0x3F, 0x5F, 0xA7, 0x43, 0x9F, 0xEF, 0x57, 0x93, 0xA7, 0xE2,
+    0xC9, 0xB8, 0xE6, 0x3A, 0x8F, 0x5B, 0x9C, 0x61, 0x5A, 0xBE, 0x22, 0x92, 0x98, 0xC7, 0x96, 0x6D,
+    0xF8, 0x68, 0xD9, 0x8A, 0xFF, 0x43, 0x36, 0x40, 0x8A, 0x6D, 0x68, 0x72, 0xF4, 0xEE, 0x19, 0x12,
+    0x73, 0x5C, 0x33, 0x0C, 0xD3, 0xA4, 0x00, 0x12, 0x80, 0x4D, 0x3A, 0x8B, 0xE3, 0x73, 0x38, 0xAE,
+    0x47, 0x9D, 0x69, 0x54, 0xDD, 0xD1, 0x31, 0xDD, 0x11, 0x00, 0x6E, 0x2D, 0xA3, 0x4C, 0xDA, 0x1D,
+    0x43, 0xEA, 0xAE, 0x47, 0xAB, 0x6B, 0xA6, 0xCF, 0x07, 0xE4, 0xF8, 0x5E, 0xFF, 0xDB, 0xF0, 0xFD,
+    0x19, 0x01, 0x30, 0x88, 0x29, 0x50, 0x6E, 0x30, 0xA9, 0x50, 0x8E, 0x1A, 0x49, 0xAA, 0x9B, 0x71,
+    0x84, 0xB5, 0xAD, 0x6F, 0xF9, 0xD8, 0x7D, 0x66, 0x39, 0x13, 0x46, 0xBE, 0x8E, 0xB4, 0x00, 0x13,
+    0x47, 0x02, 0xAD, 0x0B, 0xE0, 0x92, 0xCA, 0x31, 0xD9, 0x53, 0xA4, 0xCD, 0x28, 0x4A, 0x27, 0x5F,
+    0x47, 0xE4, 0xAE, 0xF4, 0x13, 0xE1, 0x18, 0x02, 0x63, 0xA4, 0x40, 0x4E, 0xE1, 0xDA, 0x4D, 0xE4,
+    0xC0, 0x19, 0x57, 0x02, 0x01, 0x8F, 0xC1, 0x61, 0x0A, 0x3D, 0x79, 0xD9, 0x14, 0xC3, 0x28, 0x43,
+    0x30, 0xA2, 0x20, 0x4E, 0x78, 0x6E, 0x0C, 0x9F, 0x9D, 0x17, 0xEB, 0x42, 0x8C, 0x8E, 0xBA, 0x8A,
+    0x82, 0xE8, 0xF2, 0x28, 0xC7, 0xEA, 0xA7, 0x6C, 0x73, 0x56, 0x6B, 0xEE, 0x5A, 0x78, 0x37, 0x64,
+    0xF6, 0xC6, 0xC4, 0x49, 0x05, 0xA7, 0xA6, 0x09, 0xB4, 0xDF, 0x93, 0x43, 0x37, 0x7A, 0x72, 0x9E,
+    0x89, 0x11, 0x02, 0x7E, 0xAE, 0x59, 0xE4, 0xA5, 0xD6, 0xDD, 0x7A, 0xCF, 0x5C, 0x18, 0x41, 0xB4,
+    0x48, 0xC4, 0x15, 0x0C, 0x89, 0x40, 0xF1, 0x77, 0x2E, 0x8B, 0xC3, 0xA2, 0x78, 0xE2, 0x44, 0x6C,
+    0xA1, 0xD1, 0xCF, 0x20, 0xD0, 0x0E, 0x4C, 0x11, 0x78, 0x71, 0xF2, 0xBB, 0x96, 0x85, 0xF3, 0x17,
+    0x49, 0xDE, 0x3B, 0x32, 0xEF, 0x94, 0xD3, 0x90, 0xF0, 0x5D, 0x89, 0x01, 0x4B, 0x81, 0xE1, 0x71,
+    0x6E, 0x02, 0xBF, 0xDA, 0xE8, 0xED, 0x43, 0xDB, 0x26, 0xB2, 0x35, 0xEA, 0x28, 0x1E, 0xED, 0xB1,
+    0xBF, 0xE8, 0xBF, 0x68, 0xF7, 0x34, 0x8B, 0x71, 0x81, 0xCD, 0x37, 0x2A, 0xB8, 0x62, 0xAD, 0x7B,
+    0x30, 0x7E, 0x52, 0x9E, 0xAB, 0x7C, 0xEE, 0xDB, 0x3C, 0x7C, 0x1F, 0xE5, 0x46, 0xFD, 0xB4, 0x84,
+    0xCC, 0x27, 0xE4, 0xA9, 0x1C, 0x03, 0xD5, 0xE3, 0x3B, 0xD6, 0xFD, 0x13, 0x32, 0x84, 0x46, 0xDF,
+    0xE9, 0xC0, 0x8A, 0xAB, 0x50, 0x02, 0x1C, 0xE3, 0x6E, 0x28, 0xCB, 0x02, 0x80, 0xE3, 0xF5, 0x1B,
+    0xF5, 0x97, 0x07, 0x65, 0x1D, 0x2D, 0x30, 0x69, 0x08, 0xAA, 0x19, 0x50, 0xF2, 0xEE, 0xCA, 0xF8,
+    0xAE, 0x23, 0x3D, 0x5D, 0x79, 0xCA, 0x1B, 0x32, 0x0D, 0x84, 0x1B, 0x0A, 0x75, 0x5C, 0x04, 0x6C,
+    0x2C, 0xCA, 0x58, 0x78, 0x76, 0x8F, 0xC5, 0x3F, 0xD9, 0xE5, 0x18, 0x2E, 0xE7, 0xE4, 0xF6, 0x2E,
+    0xA7, 0x54, 0xF7, 0x04, 0xEE, 0xDC, 0x0E, 0xA3, 0xC6, 0x59, 0x86, 0x46, 0xA5, 0x88, 0xFA, 0xD2,
+    0xC6, 0xAE, 0xDD, 0x73, 0xD1, 0x03, 0xE5, 0x18, 0x8A, 0x21, 0x05, 0x5A, 0x09, 0x6D, 0x98, 0xDE,
+    0xB6, 0x4C, 0xFF, 0x61, 0x53, 0xD0, 0x32, 0xCB, 0x99, 0x6A, 0xC3, 0x54, 0xD5, 0x4C, 0x83, 0x96,
+    0xA9, 0x67, 0x99, 0x92, 0x7D, 0x9B, 0x29, 0x22, 0x30, 0xA8, 0x16, 0x1A, 0x0A, 0xF5, 0xD9, 0xD8,
+    0x58, 0xD4, 0x45, 0xA0, 0x12, 0x97, 0x24, 0x31, 0xBB, 0xFF, 0x9C, 0x18, 0x84, 0x12, 0xA8, 0xF5,
+    0xA7, 0x93, 0xB6, 0x2E, 0x19, 0x72, 0x26, 0x6E, 0x10, 0x48, 0xB0, 0x49, 0x7A, 0x7D, 0xC2, 0x50,
+    0xD1, 0x1D, 0x48, 0x12, 0xCA, 0x06, 0x45, 0xC4, 0x3B, 0x14, 0x8C, 0x98, 0x9E, 0xDC, 0xEA, 0x14,
+    0x32, 0xA2, 0xF1, 0x57, 0x68, 0xDF, 0xA7, 0xEB, 0xCF, 0xCF, 0x0E, 0x7B, 0x3E, 0x81, 0xF0, 0x04,
+    0x6E, 0x46, 0xB0, 0x82, 0xEC, 0x0E, 0x32, 0xCB, 0x1E, 0x67, 0x69, 0x4E, 0x84, 0x70, 0x24, 0x75,
+    0xF3, 0xDA, 0x49, 0xA6, 0xA9, 0x24, 0x60, 0x9F, 0xA3, 0xB1, 0xCE, 0x8F, 0x91, 0xB4, 0x1D, 0xE5,
+    0x65, 0xC7, 0xF3, 0x6C, 0xD6, 0xC1, 0xAD, 0x4A, 0xF2, 0x61, 0x86, 0xFF, 0xA7, 0xE8, 0xA9, 0xE3,
+    0x25, 0xAD, 0x2C, 0x78, 0x50, 0x87, 0x12, 0xE3, 0xB7, 0x58, 0xA9, 0x19, 0xEB, 0xF9, 0xB5, 0xA0,
+    0xA6, 0xE9, 0x08, 0x71, 0x3C, 0xA4, 0x0D, 0x53, 0x3E, 0xE7, 0xBD, 0x16, 0xE8, 0xF3, 0xCF, 0x92,
+    0x87, 0xC4, 0xD7, 0x0F, 0xE5, 0x72, 0xC7, 0x42, 0xAB, 0x44, 0x67, 0x68, 0x1E, 0x68, 0xBE, 0x41,
+    0xEA, 0x75, 0x14, 0xC8, 0x9F, 0x32, 0x0E, 0xA1, 0x4F, 0x46, 0x72, 0xE4, 0xDF, 0x7C, 0x9D, 0xEF,
+    0xBF, 0x86, 0x7E, 0x07, 0x3E, 0x8C, 0x1D, 0x81, 0xFD, 0x22, 0xEF, 0x52, 0x99, 0xC9, 0x1C, 0x22,
+    0x99, 0x43, 0x22, 0x73, 0xF8, 0x82, 0xE7, 0xC0, 0xF8, 0xA0, 0x4B, 0xEF, 0x26, 0x4B, 0xEF, 0xBF,
+    0xC1, 0x34, 0x14, 0xB9, 0xE7, 0x85, 0x2E, 0x0B, 0xBD, 0x2E, 0x8F, 0x73, 0xC8, 0xD1, 0x9F, 0x17,
+    0x3C, 0x87, 0x2F, 0x72, 0x9E, 0x03, 0x70, 0x1C, 0x73, 0xB0, 0xCC, 0x90, 0x2F, 0x8E, 0xE7, 0xF0,
+    0x90, 0xE7, 0xE0, 0x94, 0x73, 0x13, 0x69, 0x24, 0x75, 0xE8, 0x31, 0xA2, 0xAB, 0x9D, 0x48, 0xCB,
+    0x2E, 0x47, 0x5F, 0x3F, 0x8E, 0xED, 0x23, 0xB1, 0x55, 0x68, 0x8B, 0x35, 0x5B, 0x05, 0x76, 0x93,
+    0xE3, 0x7B, 0x23, 0x51, 0x7E, 0xFB, 0xC8, 0x28, 0x23, 0x68, 0x25, 0x70, 0x0C, 0xD4, 0xB2, 0x05,
+    0x67, 0x5B, 0x9A, 0xF5, 0x03, 0x84, 0x6B, 0xA7, 0xD2, 0xAA, 0xAF, 0x29, 0xF2, 0xD4, 0xA1, 0x22,
+    0xEF, 0x78, 0x48, 0xDB, 0xD5, 0xCE, 0x92, 0x71, 0x52, 0xC6, 0xD2, 0x3A, 0xF5, 0x86, 0xA4, 0x93,
     0x2C, 0xAE, 0x33, 0xA9, 0x9D, 0x8F, 0x85, 0xB4, 0xAE, 0x89, 0x24, 0x91, 0xE5, 0xE5, 0xEF, 0xA8,
-    0x53, 0x1E, 0x30, 0xDD, 0xE3, 0x64, 0x03, 0x9E, 0x04, 0xB4, 0xA0, 0x8B, 0x16, 0xC5, 0x24, 0x5A,
-    0x4C, 0x6C, 0xC0, 0xDA, 0x32, 0xE1, 0x6D, 0xF7, 0x72, 0x15, 0x8E, 0x80, 0x78, 0x0C, 0xC7, 0xE6,
+    0x53, 0x1E, 0x32, 0xDD, 0xE3, 0x64, 0x03, 0x9E, 0x04, 0xB4, 0xA0, 0x8B, 0x16, 0xC5, 0x24, 0x5A,
+    0x4C, 0x6C, 0xC0, 0xDA, 0x32, 0xE1, 0x6D, 0xF7, 0x72, 0x0D, 0x8E, 0x80, 0x78, 0x0C, 0xC7, 0xE6,
     0xFD, 0x5B, 0x1E, 0xCB, 0xCB, 0x79, 0x94, 0x20, 0x65, 0x18, 0x67, 0x64, 0x4C, 0x8A, 0x25, 0x59,
-    0xA8, 0x65, 0x29, 0x0B, 0x36, 0x99, 0x71, 0x23, 0x69, 0xBD, 0xE0, 0xBB, 0x2B, 0x58, 0x4F, 0x36,
-    0x3D, 0x84, 0x8A, 0xFB, 0x23, 0x59, 0xF8, 0x5C, 0x72, 0x9C, 0xA1, 0x24, 0x3A, 0x8C, 0xB8, 0x35,
-    0x75, 0xBB, 0xE5, 0xA3, 0x34, 0x92, 0x81, 0x62, 0x97, 0xF3, 0x0C, 0xA7, 0x2F, 0x63, 0x1C, 0x76,
-    0x6C, 0x87, 0xBD, 0x78, 0x1F, 0x49, 0x8A, 0xFE, 0xAE, 0xA4, 0x26, 0x60, 0xE3, 0xD8, 0x61, 0xDA,
-    0x71, 0x11, 0x7E, 0x8B, 0xF6, 0xDF, 0xFD, 0x18, 0xD0, 0x07, 0x7E, 0x2B, 0x3E, 0x4D, 0x3E, 0x96,
-    0x6C, 0x46, 0xE7, 0x00, 0x2E, 0x55, 0x00, 0x08, 0x55, 0x09, 0x12, 0x9A, 0x5F, 0xB6, 0x4E, 0x66,
-    0x92, 0x36, 0x18, 0xDE, 0x78, 0xAE, 0x85, 0xAE, 0xBC, 0x16, 0xF5, 0xF0, 0x88, 0x94, 0x20, 0xAA,
-    0x05, 0x09, 0x6D, 0xEE, 0xB5, 0xAE, 0xAD, 0xF0, 0x44, 0xD4, 0x80, 0xF8, 0xAD, 0xD7, 0xBE, 0xE8,
-    0x82, 0x5C, 0x71, 0x40, 0xD6, 0xDC, 0x66, 0xB5, 0xD5, 0x6F, 0x57, 0xB6, 0x0D, 0xF8, 0x3D, 0x03,
-    0xD4, 0xCC, 0x99, 0xBE, 0x84, 0x6C, 0xDB, 0x63, 0x86, 0x5F, 0x8C, 0xB7, 0x05, 0x1C, 0x14, 0x99,
-    0x21, 0x56, 0x4E, 0x95, 0x49, 0xAE, 0x0A, 0x5D, 0xFA, 0x39, 0xD7, 0x5E, 0xB2, 0xD7, 0x54, 0xCE,
-    0x42, 0x09, 0xD1, 0x5E, 0x52, 0x26, 0xB8, 0x9E, 0xE5, 0x93, 0x96, 0x14, 0x9C, 0x30, 0xFF, 0x7D,
-    0x2F, 0x18, 0x62, 0xB1, 0x84, 0x0D, 0xD7, 0x58, 0x8C, 0x90, 0xD0, 0xA6, 0x8F, 0x75, 0x46, 0x71,
-    0x38, 0xB2, 0x80, 0x23, 0xE1, 0xCF, 0xDE, 0x09, 0xD0, 0x65, 0xC8, 0xA5, 0x26, 0x81, 0x57, 0x86,
-    0xA9, 0x13, 0x77, 0x3E, 0x79, 0x24, 0xFC, 0x4F, 0xF2, 0x82, 0x73, 0x02, 0xF7, 0xA0, 0xE0, 0x2C,
-    0xB1, 0xCB, 0x11, 0x9F, 0x3D, 0x32, 0xF9, 0xD9, 0x5F, 0xD9, 0x4F, 0xD1, 0xE2, 0x69, 0x4F, 0x3D,
-    0x12, 0xD9, 0x4F, 0xAC, 0xE3, 0x11, 0xD8, 0xEE, 0x2D, 0x78, 0xC4, 0x1F, 0x7F, 0x0C, 0xDF, 0x5C,
-    0xEE, 0x7E, 0xCF, 0xA6, 0x47, 0xB8, 0xBE, 0x1D, 0xA7, 0xFA, 0x79, 0x0E, 0x58, 0x36, 0xB3, 0x05,
-    0xB8, 0x35, 0xA1, 0x01, 0xBF, 0x2A, 0xA8, 0xC1, 0xD1, 0x70, 0x54, 0xD2, 0x46, 0x5E, 0xD4, 0x3D,
-    0xBC, 0xD4, 0xCE, 0xF2, 0x4E, 0x40, 0x0B, 0xCE, 0x8F, 0x06, 0x37, 0xC1, 0x1B, 0xEE, 0x09, 0xAE,
-    0xD3, 0xB4, 0xA6, 0x33, 0x18, 0x63, 0x48, 0xB5, 0xB6, 0xFF, 0x41, 0xDD, 0x15, 0x70, 0xDE, 0x9F,
-    0xF2, 0x48, 0xFD, 0x60, 0xC9, 0x1E, 0x70, 0xC4, 0xA6, 0xA1, 0xD1, 0xB9, 0x2E, 0xA2, 0x5C, 0xE7,
-    0x51, 0x9E, 0xE4, 0x73, 0xB2, 0x85, 0x32, 0xDD, 0x92, 0xBE, 0x61, 0x36, 0xB9, 0xAA, 0xFC, 0x3C,
-    0x90, 0x0D, 0x87, 0xB6, 0x7F, 0xC5, 0xC1, 0xEF, 0x52, 0x38, 0x0F, 0x68, 0xBA, 0x96, 0x55, 0xF2,
-    0x7E, 0x40, 0x7C, 0x81, 0x97, 0x37, 0xE3, 0x9A, 0x97, 0xF7, 0x41, 0xCC, 0x64, 0x8B, 0x2C, 0xA9,
-    0x71, 0xCF, 0xC6, 0x61, 0x85, 0x11, 0x4B, 0x85, 0xD1, 0x43, 0xC3, 0x2F, 0x21, 0xB2, 0xBF, 0x5E,
-    0xAE, 0x32, 0x6B, 0xAB, 0xEC, 0xFE, 0xE0, 0xC6, 0x68, 0x5C, 0x2E, 0xDF, 0x31, 0x9B, 0x1B, 0x61,
-    0xED, 0x96, 0x3E, 0x6F, 0xA4, 0x64, 0xC3, 0x7E, 0x8B, 0x75, 0xCA, 0x17, 0xBC, 0xFD, 0xBE, 0x70,
-    0x24, 0xFC, 0x0F, 0xF1, 0x85, 0xA3, 0xE0, 0x3F, 0x65, 0xAB, 0xE9, 0xBE, 0xA8, 0x72, 0x04, 0xBC,
-    0xA1, 0x19, 0x64, 0x4C, 0x41, 0xFF, 0xB6, 0xAB, 0x57, 0xCB, 0xA9, 0x01, 0x10, 0x31, 0x66, 0xA4,
-    0x3C, 0xF4, 0x0B, 0x10, 0x7E, 0xDE, 0xEE, 0x44, 0xC0, 0x4E, 0x28, 0x00, 0xCC, 0x93, 0x94, 0x24,
-    0x50, 0x74, 0x33, 0x7F, 0xF5, 0x26, 0x25, 0x2D, 0xBF, 0x24, 0xF3, 0x0E, 0xFD, 0x22, 0xAA, 0xAC,
-    0xDA, 0x75, 0xDE, 0x4D, 0xE3, 0x0A, 0x1A, 0x36, 0x96, 0xAB, 0xDF, 0x94, 0xE3, 0x0A, 0xFA, 0x9B,
-    0x4A, 0x12, 0xB9, 0x5D, 0xC9, 0x5C, 0x8D, 0x4B, 0xE6, 0x6F, 0x3C, 0x17, 0x0E, 0x5C, 0x3B, 0x6E,
-    0xEA, 0xDA, 0x8D, 0x98, 0x14, 0x47, 0x21, 0x18, 0x6F, 0x0B, 0xCB, 0x2C, 0xA2, 0x82, 0xB7, 0xAB,
-    0x9C, 0x8C, 0x03, 0x38, 0x8A, 0x73, 0xA3, 0x1A, 0x5D, 0x04, 0x6D, 0x92, 0xFB, 0x68, 0x5E, 0x9B,
-    0x21, 0x75, 0xCC, 0xBA, 0x23, 0xFF, 0x6E, 0xB8, 0xE1, 0x7E, 0xAD, 0x4C, 0x68, 0x7C, 0xDC, 0x19,
-    0x1B, 0x8B, 0x94, 0x8F, 0x51, 0x79, 0x1A, 0xEB, 0x32, 0xDC, 0x22, 0x7A, 0xC4, 0x41, 0xCE, 0x70,
-    0x92, 0x39, 0x2E, 0x2C, 0x17, 0x6E, 0xC2, 0x98, 0x74, 0x03, 0x67, 0x44, 0x95, 0xCC, 0x45, 0x39,
-    0xA2, 0xAD, 0xC7, 0x35, 0x38, 0xD4, 0xF5, 0x44, 0x04, 0x3A, 0xE5, 0xDD, 0x99, 0x75, 0xBB, 0x93,
-    0xD8, 0xD2, 0xD6, 0x87, 0xC5, 0x1A, 0x5A, 0xDD, 0x63, 0x1B, 0x82, 0xD5, 0x28, 0x08, 0x11, 0xD4,
-    0x3A, 0xF7, 0x9B, 0x7E, 0x3A, 0xA3, 0x36, 0xEC, 0xA7, 0xD4, 0xF2, 0x3D, 0x9E, 0x52, 0xD8, 0x4D,
-    0xA9, 0xD8, 0xEF, 0x5F, 0x6C, 0x65, 0x18, 0xC0, 0xAD, 0x3B, 0xFE, 0x23, 0xFF, 0x3A, 0x0A, 0xFE,
-    0xFB, 0xFC, 0x4B, 0xEF, 0xF7, 0xAF, 0xA3, 0xE0, 0x2F, 0xB1, 0xE6, 0x25, 0xC4, 0x9A, 0xCF, 0xBA,
-    0x58, 0xE3, 0x4C, 0x62, 0xCD, 0x51, 0xF0, 0x77, 0x2A, 0x15, 0x8F, 0xFD, 0xD7, 0x4C, 0xF9, 0xEF,
-    0x51, 0xC8, 0x1E, 0xC4, 0x5D, 0xBD, 0xCF, 0x6D, 0x76, 0xC2, 0x7A, 0x6E, 0x65, 0xA5, 0x7B, 0xD5,
-    0xDC, 0xBD, 0x1C, 0xEE, 0xCB, 0x15, 0x9A, 0xF4, 0x9D, 0xBC, 0x6E, 0xBE, 0x45, 0xAB, 0x8F, 0x0C,
-    0xE4, 0x28, 0x3A, 0x39, 0x42, 0xC8, 0x11, 0x41, 0x8E, 0x04, 0xE3, 0xFF, 0xB7, 0xCD, 0xEE, 0xFC,
-    0xA5, 0xCD, 0xB6, 0xB7, 0x87, 0xD9, 0x47, 0x90, 0xE3, 0x53, 0xC8, 0xD1, 0x40, 0x8E, 0x6A, 0x22,
-    0x47, 0x00, 0x2B, 0x0D, 0x47, 0xA9, 0xF8, 0xCA, 0x38, 0xA1, 0x93, 0x9D, 0xD4, 0xC0, 0x48, 0xD2,
-    0x3E, 0x9D, 0x57, 0x2E, 0xDC, 0x3C, 0x31, 0x88, 0x75, 0x13, 0xDA, 0x14, 0x35, 0x22, 0xAC, 0xF5,
-    0x09, 0xC8, 0xC4, 0xB4, 0x87, 0x70, 0x52, 0xCF, 0x9E, 0xE7, 0x80, 0x32, 0xCC, 0x76, 0x80, 0x7E,
-    0x08, 0x5A, 0xCE, 0xA4, 0x0E, 0x3B, 0x6C, 0x0B, 0xF7, 0x5B, 0x1A, 0x77, 0x6A, 0xBB, 0x36, 0xED,
-    0xB7, 0x6B, 0xAF, 0x3A, 0xD3, 0xDB, 0xB5, 0xDF, 0xCE, 0xB8, 0xE7, 0x78, 0x4B, 0x3D, 0x39, 0xCF,
-    0x1E, 0x71, 0x1E, 0xA3, 0x4D, 0xFE, 0x49, 0xE4, 0xDB, 0x54, 0xF1, 0x85, 0xD1, 0x3B, 0x00, 0x8E,
-    0xD2, 0x4E, 0x3B, 0xDA, 0xD8, 0x1F, 0x97, 0x61, 0x83, 0xC1, 0x4F, 0x07, 0xA9, 0xC5, 0xB3, 0xB9,
-    0xAA, 0xE9, 0x4F, 0xBC, 0xC1, 0xBA, 0xC5, 0x1B, 0x01, 0x15, 0x43, 0x8F, 0x41, 0xE8, 0x75, 0x39,
-    0x79, 0xE7, 0x7F, 0xAE, 0xB0, 0x2F, 0x73, 0x4C, 0xFA, 0x10, 0x0A, 0xD3, 0x1F, 0x31, 0x14, 0xEE,
-    0x76, 0xFF, 0xE6, 0xD0, 0xFD, 0x37, 0x0E, 0xF9, 0xF2, 0xE2, 0xA6, 0x7B, 0xB3, 0xD7, 0xBF, 0x37,
-    0x90, 0x78, 0x4D, 0x51, 0xDA, 0xD7, 0x01, 0x9C, 0x49, 0xD1, 0xC2, 0xA4, 0xB4, 0x96, 0xED, 0x8E,
-    0x66, 0x54, 0x87, 0x7B, 0x07, 0x49, 0xC4, 0x39, 0x3A, 0x32, 0x10, 0xCF, 0xFE, 0x4D, 0x36, 0x38,
-    0x79, 0x96, 0xC4, 0x2E, 0x85, 0x4C, 0x9F, 0x49, 0xD1, 0x91, 0x66, 0x7C, 0x26, 0x44, 0xBA, 0x70,
-    0x0D, 0xE1, 0xD9, 0x97, 0x18, 0x7D, 0x2D, 0x9E, 0x6D, 0x38, 0xDE, 0x36, 0x33, 0xF1, 0xC1, 0x31,
-    0xE4, 0x9D, 0x1E, 0x82, 0x18, 0xF5, 0xAF, 0xFE, 0xAE, 0x32, 0xFE, 0x59, 0x7E, 0xB3, 0x21, 0xE4,
-    0x8A, 0x9F, 0x4F, 0x2D, 0xCF, 0xF7, 0xA0, 0xA6, 0xFF, 0x01, 0xCD, 0x5B, 0x3D, 0x8C, 0xDC, 0xD6,
-    0x11, 0x7E, 0x24, 0x75, 0x22, 0x22, 0x02, 0xA1, 0x0A, 0x29, 0x06, 0x24, 0x40, 0x6C, 0x5C, 0x49,
-    0xB6, 0xD8, 0x1A, 0x89, 0x24, 0xD2, 0x30, 0x10, 0x97, 0xBE, 0xE2, 0x2E, 0x2E, 0x5C, 0x38, 0x65,
-    0xE0, 0x14, 0xD7, 0xA4, 0x70, 0x21, 0x1D, 0x99, 0xA4, 0x70, 0xE1, 0x22, 0x57, 0xC4, 0x69, 0xAD,
-    0x42, 0xC5, 0xE1, 0x52, 0xC4, 0x85, 0x8A, 0x2B, 0x24, 0x91, 0x89, 0x11, 0x18, 0x88, 0x8B, 0xD0,
-    0x0E, 0x0C, 0x97, 0xA2, 0x11, 0x19, 0xB0, 0x65, 0x20, 0x26, 0x02, 0x3A, 0xA6, 0x6C, 0x92, 0x2F,
-    0xDF, 0x37, 0x8F, 0xDC, 0xDD, 0xB3, 0xFE, 0x4E, 0xDA, 0xBD, 0x9F, 0xD3, 0xEE, 0x70, 0x45, 0x72,
-    0xF9, 0xE6, 0xE7, 0xBD, 0x99, 0x6F, 0xE6, 0xCD, 0x2A, 0x57, 0xB7, 0x4A, 0x29, 0x43, 0xAD, 0xD5,
-    0x15, 0x35, 0xF9, 0x8B, 0x72, 0xD2, 0xA4, 0x24, 0xCD, 0x2A, 0x52, 0x5D, 0xF3, 0x9E, 0xAF, 0x1A,
-    0x50, 0xE7, 0x53, 0xDE, 0xEF, 0xBC, 0xDF, 0x81, 0x7A, 0xBF, 0xD3, 0xA0, 0xFE, 0x8B, 0xA4, 0x81,
-    0xD2, 0xB1, 0x52, 0xE7, 0x55, 0x86, 0x2F, 0x5F, 0x54, 0x09, 0xE8, 0xFA, 0x56, 0x86, 0x47, 0x68,
-    0xAD, 0xF1, 0x88, 0x5A, 0x05, 0x95, 0xB2, 0x2B, 0xE5, 0x37, 0xCA, 0x29, 0x95, 0xD7, 0x2A, 0xB7,
-    0x50, 0x6E, 0xA7, 0xFC, 0x1C, 0xE3, 0xAB, 0xEC, 0x9E, 0x5A, 0xD3, 0xA5, 0xEE, 0x55, 0xA6, 0x2B,
-    0x4B, 0x6B, 0x65, 0xE3, 0xAD, 0x56, 0x57, 0x85, 0x17, 0x0B, 0x17, 0x7D, 0xAD, 0xD3, 0xA0, 0x4C,
-    0xF2, 0xA0, 0x88, 0x4A, 0x37, 0x8F, 0xF0, 0x50, 0xBE, 0x93, 0xF2, 0xA8, 0xD6, 0x65, 0x78, 0x2F,
-    0x29, 0x13, 0x9C, 0xCF, 0xF2, 0xE9, 0x3B, 0x29, 0x74, 0x15, 0xE9, 0xDB, 0xF7, 0xBC, 0xDE, 0xEF,
-    0xD5, 0x32, 0x1F, 0xA2, 0x8E, 0x50, 0xD2, 0xF4, 0x0C, 0x39, 0xFF, 0xFC, 0x26, 0xA8, 0x2D, 0x52,
-    0xAB, 0x4C, 0x64, 0x5C, 0x52, 0x87, 0x44, 0x76, 0x70, 0xE2, 0xE6, 0xBE, 0x72, 0xBE, 0x59, 0x57,
-    0x16, 0x19, 0x4C, 0xAA, 0x09, 0x73, 0x0B, 0xD1, 0xC3, 0x81, 0x4A, 0xC7, 0xD1, 0xB6, 0x49, 0x1C,
-    0x19, 0xDE, 0x13, 0x56, 0x7C, 0x43, 0xE5, 0x8C, 0xAB, 0xF9, 0x1F, 0x4B, 0xA7, 0x8B, 0x91, 0xF7,
-    0x0A, 0x1E, 0x02, 0xE1, 0x1C, 0x0C, 0xEC, 0xE2, 0x6B, 0x2E, 0x3F, 0x6B, 0x7C, 0xC8, 0x0A, 0x4E,
-    0x77, 0xF2, 0x21, 0x82, 0x52, 0xFE, 0x00, 0xA7, 0xD4, 0x25, 0x0E, 0x7B, 0x62, 0x9C, 0x07, 0x47,
-    0x35, 0x54, 0x92, 0x80, 0x01, 0x0B, 0x52, 0xE4, 0x6E, 0xAB, 0xA2, 0xC2, 0x87, 0xA8, 0x39, 0x84,
-    0x3D, 0xA5, 0x22, 0x0A, 0x43, 0x5E, 0x8C, 0x2A, 0x1F, 0x44, 0xE4, 0xAA, 0xDC, 0x17, 0x92, 0x40,
-    0x3B, 0x2A, 0xF6, 0x3A, 0x65, 0x15, 0xB6, 0xDE, 0x08, 0x72, 0xE8, 0x03, 0x3A, 0xF5, 0x38, 0x86,
-    0x3A, 0xC9, 0xE1, 0x56, 0x63, 0x08, 0x1E, 0x0B, 0x4B, 0x1E, 0xEE, 0x0F, 0xA0, 0x83, 0x23, 0x03,
-    0x27, 0xC9, 0x3D, 0x68, 0x46, 0xA7, 0x7E, 0x15, 0xE5, 0x51, 0x11, 0xE6, 0x51, 0x1E, 0xE6, 0x49,
-    0x7E, 0x52, 0xAC, 0x31, 0xFB, 0x4E, 0x86, 0x37, 0x06, 0xCE, 0x83, 0xDA, 0xCD, 0x3D, 0xE1, 0x1D,
-    0xCF, 0xB3, 0x62, 0x3E, 0x7F, 0xD4, 0xAC, 0xA3, 0x21, 0xAB, 0xFF, 0x3E, 0xC6, 0x08, 0xD5, 0x0D,
-    0xCA, 0x7B, 0xE2, 0x40, 0x04, 0x5E, 0x8A, 0xCD, 0xCD, 0x38, 0x61, 0xD7, 0x37, 0x31, 0x67, 0x82,
-    0xD8, 0xC2, 0x32, 0x5D, 0x9C, 0xC0, 0xA2, 0x55, 0xCE, 0x5B, 0x25, 0xB3, 0x4A, 0x26, 0xD5, 0x59,
-    0x35, 0xFB, 0xB7, 0xFF, 0x02, 0x87, 0xA5, 0xF9, 0x02, 0xBF, 0x79, 0x2C, 0x9D, 0x72, 0xB2, 0x08,
-    0x81, 0xC5, 0x90, 0xA1, 0x6A, 0x07, 0xE3, 0x8A, 0x99, 0xCD, 0x52, 0x5A, 0x3D, 0x10, 0x81, 0x97,
-    0x60, 0x4D, 0x5A, 0xD5, 0x6E, 0xE0, 0x6E, 0xB3, 0xC6, 0x7C, 0x91, 0x4A, 0x58, 0x94, 0xC0, 0x4B,
-    0xE2, 0x19, 0xFD, 0xF4, 0x0A, 0x3D, 0xC7, 0x67, 0x8D, 0xCC, 0x6F, 0xF1, 0x31, 0x99, 0xB8, 0x94,
-    0x93, 0x53, 0x8F, 0xAE, 0xF5, 0x35, 0xB0, 0xAC, 0xC9, 0x9E, 0xAD, 0xE9, 0xF2, 0x21, 0xBF, 0xDF,
-    0x92, 0xC2, 0x4F, 0x81, 0x3A, 0x9A, 0xD4, 0xD6, 0xB1, 0xC5, 0x0F, 0xD4, 0x8E, 0xDA, 0x41, 0xF3,
-    0xC9, 0x67, 0x6B, 0xA0, 0xB1, 0xDC, 0x2F, 0xDF, 0xED, 0x49, 0x3D, 0x79, 0x5A, 0xD0, 0xF0, 0x24,
-    0x54, 0x75, 0x4E, 0xC6, 0xC2, 0xB8, 0x77, 0xA6, 0x36, 0xD6, 0x2D, 0x54, 0xA4, 0xD6, 0xDA, 0x10,
-    0xAC, 0x7B, 0x6D, 0x44, 0xA6, 0xDB, 0x0B, 0x42, 0x9F, 0x15, 0x4A, 0x8F, 0xF7, 0x16, 0xA8, 0xA7,
-    0xBF, 0x05, 0x0D, 0xEA, 0xA4, 0xA5, 0xDC, 0x3E, 0x83, 0x40, 0x6E, 0x28, 0x06, 0x81, 0x6C, 0x86,
-    0xBA, 0xF7, 0x51, 0x6F, 0x72, 0x0F, 0xAC, 0xDA, 0xD2, 0x44, 0x21, 0x14, 0xE5, 0xEB, 0x6F, 0xF5,
-    0x06, 0xB8, 0xFA, 0x98, 0xD3, 0xE1, 0xC8, 0xD3, 0x6B, 0x23, 0x84, 0x0B, 0xD7, 0x29, 0xBE, 0xBB,
-    0x18, 0x6D, 0x48, 0xF0, 0x5D, 0x23, 0x21, 0xC3, 0x4B, 0xAF, 0x75, 0x31, 0x7D, 0x7D, 0x69, 0xFE,
-    0x4B, 0x65, 0x58, 0x1A, 0xBA, 0xF0, 0xF5, 0xF7, 0xAD, 0x0A, 0xEB, 0xA8, 0x35, 0x8A, 0x10, 0x3D,
-    0x88, 0xA0, 0x22, 0xF3, 0x2C, 0xF1, 0x5A, 0x23, 0xBB, 0x88, 0x2E, 0x92, 0x8B, 0xE0, 0x46, 0x6E,
-    0x11, 0x3B, 0xE4, 0xDC, 0x10, 0xB2, 0xB4, 0xBA, 0x3C, 0x99, 0x17, 0x3A, 0xA7, 0x22, 0x72, 0xF0,
-    0xE9, 0x51, 0x2C, 0x67, 0x42, 0x2C, 0x91, 0x5B, 0xCD, 0x12, 0xDD, 0x8E, 0xE4, 0x07, 0x17, 0x06,
-    0xB2, 0x4C, 0x52, 0x09, 0xC1, 0xF3, 0xEC, 0x8A, 0x62, 0x57, 0x1C, 0x43, 0x20, 0x8D, 0x35, 0x03,
-    0x69, 0x54, 0x82, 0x50, 0x09, 0x9D, 0xF8, 0x35, 0x26, 0x7E, 0x19, 0x60, 0x11, 0xF8, 0x15, 0x84,
-    0xAB, 0xB3, 0x4F, 0x5E, 0xAF, 0xB1, 0x88, 0xEA, 0xEC, 0xEE, 0xD6, 0xD5, 0x71, 0xFA, 0x47, 0x85,
-    0xAC, 0x9C, 0xAB, 0x7E, 0x63, 0x97, 0x58, 0x32, 0x58, 0x65, 0xBD, 0x99, 0xFE, 0x47, 0xD4, 0x71,
-    0x46, 0x63, 0x44, 0xAF, 0xF0, 0xD5, 0x8A, 0x86, 0x2E, 0xB8, 0xE8, 0xE3, 0x99, 0x10, 0xB6, 0x7F,
-    0xF2, 0x61, 0xA9, 0x3B, 0x80, 0x2D, 0xF6, 0x37, 0x09, 0x4C, 0x8B, 0x59, 0x17, 0xD5, 0x83, 0x13,
-    0x5E, 0x90, 0xAC, 0x6A, 0x65, 0x64, 0xC4, 0xD1, 0x82, 0xDD, 0xF8, 0xE0, 0xCD, 0xFD, 0x16, 0x53,
-    0xBC, 0x57, 0x50, 0x19, 0x4F, 0x46, 0x0F, 0xB8, 0xC3, 0x85, 0xCF, 0x2F, 0xE6, 0xFE, 0x09, 0xA2,
-    0x14, 0x9D, 0xA6, 0x5D, 0x8D, 0x58, 0xCC, 0x15, 0x52, 0xAB, 0x21, 0x6C, 0x0C, 0x1E, 0x74, 0x3E,
-    0x99, 0x30, 0xAE, 0x8D, 0x27, 0xBA, 0x85, 0xC1, 0x78, 0x04, 0x34, 0x3E, 0x3F, 0x23, 0x24, 0xC1,
-    0xB7, 0x60, 0xF2, 0x62, 0x9A, 0x5E, 0x22, 0x3E, 0x0B, 0xDE, 0xE6, 0xBA, 0x67, 0x90, 0x16, 0xE3,
-    0xAA, 0x95, 0x83, 0x98, 0xBE, 0x82, 0x3F, 0x1E, 0x18, 0xA9, 0x16, 0x31, 0x7D, 0x4F, 0xCA, 0xC3,
-    0x88, 0x3B, 0x87, 0x18, 0xE5, 0x54, 0xAD, 0xC4, 0xAE, 0x4B, 0x6A, 0x8C, 0x63, 0xE6, 0xCF, 0xD6,
-    0x7D, 0x2C, 0x92, 0x57, 0x74, 0xAB, 0xF0, 0xA0, 0xC0, 0x83, 0x6E, 0x23, 0xD0, 0xDA, 0xC0, 0xEC,
-    0xD4, 0xC4, 0xDF, 0x91, 0x96, 0x53, 0x34, 0x3F, 0x52, 0x28, 0x21, 0x36, 0x14, 0x57, 0x83, 0x96,
-    0x77, 0xE2, 0xEB, 0xA1, 0x50, 0xF3, 0x22, 0x38, 0xA7, 0x6F, 0x8E, 0x19, 0xC0, 0x93, 0x3E, 0xA3,
-    0x95, 0xB4, 0x20, 0x05, 0x11, 0x5A, 0x88, 0x3C, 0x3F, 0x63, 0x50, 0x6A, 0x6E, 0x29, 0xD1, 0x8E,
-    0x1A, 0xE1, 0xD9, 0x3A, 0x2E, 0xFC, 0x4F, 0xF3, 0x2B, 0xEF, 0x2A, 0x04, 0xF0, 0xBF, 0x03, 0x3C,
-    0x87, 0x85, 0x0A, 0x8B, 0xA0, 0x9C, 0x21, 0x7E, 0x19, 0xE6, 0xCA, 0xFB, 0x26, 0x49, 0x21, 0x07,
-    0xB4, 0x60, 0x7F, 0xBE, 0x3C, 0x00, 0x7E, 0xCE, 0x01, 0xFA, 0xFA, 0x82, 0x0F, 0xA8, 0x99, 0xE9,
-    0xC1, 0x61, 0xDF, 0xFD, 0x73, 0xA7, 0x32, 0x65, 0x75, 0x0A, 0xB7, 0xB6, 0x20, 0x36, 0x7C, 0x7A,
-    0x0C, 0x18, 0x1C, 0x52, 0x8B, 0x76, 0xF6, 0xE5, 0x24, 0x83, 0xF3, 0xE2, 0xF3, 0x9C, 0xA9, 0x9F,
-    0xDF, 0x90, 0xA9, 0xDA, 0x3C, 0x30, 0x83, 0x3B, 0x04, 0x3A, 0x14, 0x55, 0xD1, 0x23, 0x22, 0x93,
-    0x4B, 0x94, 0x49, 0xE5, 0x54, 0x22, 0x89, 0x96, 0x3A, 0x40, 0x1D, 0x0E, 0x5A, 0x4A, 0xF2, 0xC9,
-    0x6C, 0x1C, 0x3E, 0x9F, 0x8A, 0xD5, 0xCE, 0xBF, 0x43, 0x33, 0x0F, 0xC3, 0x09, 0xE4, 0x14, 0x32,
-    0xEB, 0x71, 0x0F, 0x48, 0x87, 0x87, 0x46, 0x3F, 0xA3, 0x9B, 0x94, 0xCF, 0x91, 0x7C, 0xBE, 0x21,
-    0xB4, 0x16, 0x6A, 0x40, 0xCE, 0xF1, 0xF1, 0x84, 0x71, 0xF6, 0x24, 0x5E, 0x39, 0x7D, 0xC2, 0x41,
-    0xCD, 0x43, 0x61, 0x2E, 0x10, 0x46, 0x23, 0xA9, 0xC3, 0x08, 0x20, 0x76, 0x2A, 0x46, 0x0A, 0x2B,
-    0x1E, 0xA1, 0x03, 0x14, 0x5C, 0x87, 0xBA, 0x0D, 0x75, 0x1D, 0xE8, 0x46, 0x00, 0xE9, 0x14, 0x6F,
-    0x3E, 0x92, 0x12, 0x70, 0x8E, 0x74, 0x37, 0xF7, 0x93, 0x9A, 0xE7, 0x9F, 0xD3, 0x77, 0x4E, 0xEB,
-    0x2F, 0x22, 0xDD, 0x60, 0x5C, 0xE3, 0xB6, 0x19, 0x98, 0x6C, 0x3A, 0x6D, 0xC9, 0x31, 0x24, 0xDD,
-    0x38, 0x32, 0x71, 0x37, 0x19, 0x2B, 0x08, 0x41, 0x37, 0xD6, 0x12, 0xEE, 0x23, 0x61, 0x0D, 0x02,
-    0xA5, 0x39, 0xFA, 0x2B, 0x02, 0x6B, 0x0C, 0xE3, 0x10, 0x47, 0xE3, 0xEA, 0xAE, 0x88, 0x8B, 0x9B,
-    0x11, 0x02, 0x37, 0x74, 0x9D, 0xE8, 0x52, 0x37, 0x0F, 0x53, 0x87, 0x7C, 0x8E, 0x13, 0x0A, 0xDC,
-    0xFD, 0x44, 0xBF, 0xF3, 0x0B, 0xFD, 0xC7, 0x3D, 0x51, 0xC7, 0x03, 0x04, 0x7E, 0xB5, 0x07, 0xA2,
-    0xCD, 0x08, 0x6D, 0x1F, 0x2C, 0xF5, 0xA7, 0x4F, 0x28, 0xF5, 0x0F, 0x04, 0xB6, 0x88, 0xB7, 0x9E,
-    0x4F, 0xFA, 0x9B, 0xB7, 0x74, 0x5B, 0x61, 0x69, 0xC8, 0xC4, 0x88, 0xA8, 0x82, 0x66, 0xCC, 0x4F,
-    0x76, 0xFB, 0xC2, 0xFD, 0x10, 0x26, 0x12, 0x31, 0xFC, 0xFA, 0x4C, 0xA4, 0xD7, 0xD7, 0x75, 0x7B,
-    0x1D, 0x53, 0x50, 0x9E, 0x79, 0x6A, 0x4B, 0x05, 0x22, 0xB3, 0x7A, 0xE4, 0x0B, 0x1A, 0x39, 0xAD,
-    0xEF, 0x40, 0x17, 0x81, 0xAE, 0xF0, 0x32, 0x99, 0xC4, 0x9C, 0xFC, 0x64, 0x3A, 0xC7, 0xEB, 0xE4,
-    0x2A, 0xD9, 0x78, 0x63, 0x53, 0x25, 0x9D, 0x42, 0x4A, 0xED, 0x3C, 0xF2, 0x05, 0x2D, 0xAD, 0xE9,
-    0x8D, 0x4C, 0x57, 0xC8, 0x01, 0x90, 0x01, 0x04, 0x7F, 0xAA, 0x7C, 0x5D, 0x3A, 0xF0, 0x0C, 0x27,
-    0xD4, 0xFC, 0xFC, 0x1C, 0x57, 0xF1, 0x75, 0xBB, 0x58, 0x7F, 0x2D, 0x8F, 0x74, 0xEA, 0xF5, 0x83,
-    0x1F, 0x79, 0x52, 0xC6, 0xE6, 0xB5, 0x11, 0xA2, 0x7C, 0x43, 0x97, 0x05, 0x87, 0xE5, 0x34, 0xB2,
-    0xFC, 0xE0, 0x36, 0x97, 0x95, 0xD3, 0xD2, 0x29, 0x32, 0x4D, 0xBD, 0x36, 0x2C, 0xC0, 0x27, 0x65,
-    0x4C, 0x6D, 0x4B, 0x91, 0x32, 0x27, 0x26, 0xF5, 0x4B, 0x56, 0x1C, 0x2D, 0xD1, 0x9B, 0x19, 0x9D,
-    0x89, 0xC5, 0xAF, 0x26, 0xBE, 0x67, 0x2E, 0x11, 0x9E, 0x42, 0x63, 0x09, 0x97, 0x59, 0xB3, 0xA6,
-    0xBF, 0xC0, 0x43, 0xC6, 0x24, 0x7C, 0x4F, 0xA8, 0x91, 0x14, 0x7C, 0x82, 0x62, 0x5C, 0x93, 0x4E,
-    0xCD, 0x52, 0x2C, 0xD7, 0xA1, 0x26, 0xA1, 0x98, 0xC6, 0xF3, 0x74, 0x39, 0x9E, 0x5E, 0x86, 0xF3,
-    0x73, 0x98, 0x69, 0xC3, 0x0C, 0x51, 0x45, 0x52, 0xC2, 0x1A, 0xC7, 0x66, 0x22, 0xD2, 0x1B, 0x9B,
-    0xF6, 0xD6, 0x46, 0xD2, 0x39, 0xBA, 0x84, 0xF8, 0x49, 0xE9, 0xF0, 0x96, 0x27, 0x22, 0x50, 0x4A,
-    0x54, 0x42, 0x2D, 0x51, 0x49, 0xC5, 0x4C, 0x2B, 0x4F, 0x42, 0x8A, 0x11, 0xB5, 0x30, 0x12, 0x06,
-    0xE4, 0x08, 0x21, 0x4A, 0x5C, 0x35, 0x10, 0x0D, 0xD1, 0x35, 0xB1, 0x35, 0x91, 0xF5, 0x88, 0xAB,
-    0x11, 0xA0, 0x90, 0x5E, 0xF4, 0x06, 0xF1, 0x24, 0xF9, 0x62, 0xDF, 0xC4, 0xFE, 0x60, 0x84, 0x99,
-    0x0B, 0x32, 0x05, 0x95, 0x6D, 0x48, 0x02, 0xE3, 0x70, 0xC4, 0x1C, 0x89, 0xCD, 0x15, 0xAB, 0x3E,
-    0x2E, 0x31, 0x78, 0x97, 0x0E, 0xE6, 0x3E, 0x7F, 0x43, 0x83, 0x40, 0xC7, 0xC0, 0x8E, 0x19, 0x13,
-    0xC4, 0x26, 0xD1, 0x71, 0x48, 0x87, 0xCC, 0x47, 0x79, 0xB5, 0x94, 0x6E, 0x72, 0xD2, 0x50, 0x92,
-    0x1C, 0x56, 0xBC, 0x35, 0x73, 0x2A, 0x4B, 0x3B, 0x52, 0xFE, 0xF3, 0x53, 0x52, 0x32, 0x6A, 0x49,
-    0xDE, 0x67, 0x31, 0x4E, 0x83, 0xBE, 0x42, 0x64, 0xAF, 0xDD, 0x5E, 0xEE, 0xD4, 0x2C, 0x3D, 0x5B,
-    0x5A, 0x9E, 0x63, 0xCA, 0x41, 0x11, 0x83, 0x79, 0x1C, 0xB6, 0x9C, 0x23, 0x1E, 0xCB, 0x3E, 0xAD,
-    0x65, 0xE0, 0xE2, 0xF4, 0x4F, 0x62, 0xFF, 0x50, 0xBD, 0x0F, 0xE4, 0x8C, 0x94, 0xCF, 0xA7, 0xF5,
-    0xF3, 0xC7, 0x85, 0xC6, 0x63, 0x5B, 0x1B, 0x4E, 0xE7, 0xE9, 0xC2, 0xE9, 0x2C, 0xAE, 0x04, 0x2E,
-    0xF6, 0x0E, 0xEB, 0xD2, 0xE9, 0x02, 0x56, 0xC1, 0x13, 0xCE, 0x36, 0x51, 0x2C, 0xD0, 0x85, 0xA3,
-    0x13, 0x5E, 0x15, 0x98, 0xE5, 0xF3, 0x66, 0xE8, 0xD7, 0xED, 0x6D, 0x9D, 0x72, 0xE9, 0x20, 0x0D,
-    0xAB, 0x4E, 0x37, 0xB3, 0xAC, 0x65, 0x02, 0x28, 0x48, 0xA4, 0x28, 0x48, 0xCC, 0x43, 0x27, 0xFF,
-    0xC6, 0xE6, 0x31, 0x4E, 0x4B, 0x0C, 0xE9, 0x3D, 0x70, 0xC8, 0x75, 0x19, 0x32, 0xE6, 0x90, 0x38,
-    0xA7, 0xA1, 0x89, 0x21, 0x92, 0xF9, 0x2D, 0x08, 0x74, 0xE5, 0xF6, 0x8E, 0x0C, 0xA9, 0x39, 0x64,
-    0xD8, 0x98, 0xC2, 0xAA, 0x2C, 0x18, 0xB7, 0x19, 0xF7, 0x30, 0xA2, 0xD9, 0x02, 0x8C, 0x92, 0x70,
-    0x13, 0x32, 0x4F, 0xA1, 0xE5, 0x1F, 0x9A, 0x9A, 0xEE, 0x82, 0xFC, 0x92, 0xE4, 0xBD, 0x1D, 0x29,
-    0xAC, 0xB3, 0xA3, 0x34, 0xB1, 0x4C, 0xD8, 0x19, 0xE5, 0x84, 0x5E, 0x43, 0x4C, 0xA3, 0x05, 0x82,
-    0xC7, 0xF9, 0x9F, 0xC7, 0x3A, 0xA5, 0x7D, 0xE2, 0x7F, 0xE6, 0xAF, 0x1B, 0xCD, 0x67, 0x4D, 0xEA,
-    0x13, 0x03, 0x20, 0x9C, 0x5F, 0xA0, 0x01, 0xBD, 0x37, 0x12, 0x58, 0x00, 0x5B, 0x73, 0xFA, 0x08,
-    0x48, 0xE9, 0x15, 0x90, 0xD2, 0xCF, 0x21, 0x65, 0x90, 0xCA, 0x6A, 0x02, 0x79, 0x6E, 0x4F, 0xA4,
-    0xCC, 0x3A, 0xBF, 0x08, 0xBA, 0x00, 0x70, 0x27, 0x04, 0x67, 0x17, 0xF1, 0x7E, 0x56, 0x56, 0xC4,
-    0xD3, 0xBC, 0xB9, 0x7E, 0x21, 0x97, 0xEC, 0xAD, 0x3D, 0x81, 0xA9, 0x96, 0x64, 0x89, 0x17, 0x96,
-    0x96, 0x2C, 0xC4, 0x7C, 0x3A, 0x15, 0x3F, 0x99, 0x10, 0x66, 0x69, 0x3F, 0x9E, 0x49, 0x2B, 0xC6,
-    0xEA, 0xAA, 0xB8, 0x90, 0xCC, 0xF1, 0xE8, 0xC6, 0x3C, 0x42, 0xD8, 0xF4, 0x54, 0x21, 0x09, 0xF7,
-    0x00, 0x18, 0x93, 0xE4, 0x82, 0xAB, 0x65, 0xAD, 0x81, 0xFC, 0x74, 0xF7, 0x42, 0x3C, 0x7C, 0x32,
-    0x1D, 0x77, 0x7A, 0xA0, 0xA9, 0x02, 0xD1, 0x8E, 0xD1, 0xAD, 0x53, 0x3F, 0x7B, 0xF8, 0x64, 0x32,
-    0x85, 0x1D, 0x93, 0x44, 0x9B, 0xC8, 0x29, 0x9E, 0xC8, 0x2B, 0x76, 0xD6, 0x24, 0x22, 0x62, 0x61,
-    0x60, 0x77, 0x78, 0x6D, 0xC4, 0xDC, 0x5C, 0xE6, 0x17, 0x92, 0x3E, 0xD0, 0x5A, 0x68, 0x4B, 0xFA,
-    0x6F, 0x4D, 0xFA, 0x99, 0x4E, 0x41, 0xCB, 0x2C, 0x27, 0x8D, 0x2A, 0xD2, 0xA0, 0x21, 0xF5, 0x3A,
-    0x52, 0x47, 0x93, 0x2A, 0xA4, 0x6B, 0xA0, 0x99, 0x26, 0x8D, 0x84, 0xFA, 0x42, 0x5D, 0x56, 0xB6,
-    0xE8, 0x93, 0xCE, 0xF5, 0x64, 0x08, 0x71, 0x42, 0x25, 0xD4, 0x08, 0x6B, 0x6A, 0xDC, 0x14, 0x90,
-    0x58, 0xA9, 0xA2, 0x74, 0x5C, 0x66, 0x43, 0x25, 0x5C, 0x9D, 0xDD, 0x84, 0xA7, 0x8B, 0x5A, 0x44,
-    0x49, 0x77, 0xCE, 0x4C, 0xE5, 0x8E, 0xC9, 0x54, 0x0E, 0x58, 0xE0, 0x1D, 0x91, 0xAA, 0x9C, 0x89,
-    0x54, 0x62, 0xAF, 0xF3, 0x3B, 0x23, 0xD5, 0xA2, 0x85, 0x9F, 0x1D, 0xBC, 0x9F, 0x38, 0x33, 0x49,
-    0xC2, 0x27, 0xCE, 0xCC, 0x24, 0xB9, 0x76, 0x25, 0x79, 0x74, 0x27, 0xD9, 0x7B, 0xD4, 0x4D, 0xE0,
-    0xD6, 0x90, 0x20, 0x1F, 0x82, 0xA9, 0x23, 0xBB, 0x8A, 0x97, 0x18, 0x48, 0xFD, 0x0F, 0xAA, 0x61,
-    0x87, 0x5E, 0xD6, 0xE6, 0x64, 0x57, 0x71, 0xD1, 0xDA, 0x33, 0x26, 0x1A, 0x1A, 0x15, 0x86, 0xCA,
-    0xC9, 0x78, 0xF0, 0xCC, 0xC1, 0xF9, 0xC7, 0xD6, 0xCB, 0x60, 0xD2, 0x7B, 0x5B, 0xBF, 0x0B, 0x7E,
-    0xD6, 0x95, 0xBE, 0x87, 0x60, 0x7D, 0x1D, 0xD8, 0xC5, 0x54, 0x2D, 0xB9, 0x9F, 0xF9, 0xF4, 0x07,
-    0xE0, 0xB6, 0x9A, 0xF5, 0xE8, 0x86, 0xD8, 0xD2, 0x67, 0xAA, 0xF7, 0x34, 0x36, 0x28, 0xA6, 0x36,
-    0xF0, 0xC5, 0x06, 0xAE, 0xD8, 0xC0, 0x1E, 0x6C, 0x70, 0x7B, 0xAA, 0xFD, 0x40, 0xA8, 0x27, 0xD4,
-    0x11, 0x1B, 0x58, 0xC6, 0x06, 0x99, 0xD8, 0xC0, 0x14, 0x76, 0x0C, 0xC2, 0x3A, 0xA3, 0xA6, 0xB3,
-    0xF7, 0xE2, 0xB4, 0xE0, 0xE3, 0x35, 0x53, 0x40, 0xB6, 0x20, 0x7B, 0xA4, 0xB4, 0x47, 0x4A, 0x7B,
-    0xA4, 0xE3, 0xDE, 0xB9, 0x21, 0xA3, 0x57, 0x96, 0x54, 0x80, 0x18, 0x48, 0x45, 0x1B, 0x54, 0x93,
-    0x00, 0x20, 0xA1, 0x93, 0xED, 0x35, 0x72, 0x26, 0xCD, 0x25, 0xC9, 0xB0, 0xD5, 0x08, 0x23, 0x22,
-    0xA5, 0xF0, 0x6B, 0xBE, 0x5C, 0x6E, 0xD3, 0xD1, 0x9B, 0xC2, 0x64, 0x8E, 0x5C, 0x32, 0x7B, 0x85,
-    0x23, 0x8D, 0xEF, 0xA3, 0xC3, 0x3D, 0xE6, 0x7E, 0x7E, 0xB7, 0x1F, 0x9E, 0xE3, 0xC9, 0x33, 0xED,
-    0x5E, 0x6A, 0x85, 0xD9, 0x5D, 0xF2, 0x69, 0x36, 0xA1, 0x65, 0x0B, 0xF8, 0xBE, 0xBD, 0xB7, 0xB5,
-    0x7B, 0x82, 0xF0, 0xFC, 0x3A, 0xA8, 0xC2, 0xD2, 0x6B, 0xA2, 0xDC, 0x6D, 0x93, 0xDC, 0xE9, 0xB2,
-    0xE9, 0xBB, 0xE7, 0x91, 0xE7, 0x78, 0x2D, 0x2A, 0xBC, 0xC6, 0xAF, 0xFC, 0xCA, 0xED, 0x81, 0x80,
-    0xA7, 0x7B, 0x6F, 0x2C, 0x46, 0xFB, 0x8A, 0xFB, 0xB7, 0xFE, 0x27, 0x8D, 0x84, 0x20, 0x81, 0x99,
-    0xD2, 0x6A, 0x30, 0xF5, 0x2C, 0x87, 0x42, 0x03, 0x2A, 0xB6, 0x94, 0x5D, 0x78, 0xB1, 0x75, 0x6F,
-    0x0D, 0x06, 0xEC, 0x8D, 0xD9, 0xC6, 0x12, 0xDB, 0x22, 0xB4, 0xA1, 0x56, 0xA5, 0x9A, 0xD8, 0x87,
-    0xF4, 0x0D, 0x0D, 0x11, 0xB0, 0x5B, 0xD2, 0x97, 0xF9, 0xBF, 0xAD, 0x25, 0x0A, 0xC6, 0x87, 0x4A,
-    0x1B, 0x4B, 0x2F, 0xAE, 0xA8, 0xE8, 0xFD, 0x46, 0x25, 0x88, 0x0B, 0x6D, 0x90, 0xDA, 0xD5, 0x25,
-    0x08, 0x71, 0x62, 0x81, 0xDA, 0x18, 0x45, 0xC5, 0x5F, 0xA3, 0xA4, 0x28, 0xD7, 0x18, 0x3E, 0x1B,
-    0x57, 0xAA, 0xBC, 0x37, 0xC0, 0x1D, 0x0E, 0x97, 0xC1, 0x33, 0x0E, 0xCF, 0x46, 0xD5, 0xD8, 0x12,
-    0xC2, 0x43, 0x32, 0x3D, 0x68, 0x2C, 0x40, 0x39, 0xE4, 0xC9, 0x8E, 0x6B, 0xC3, 0x9D, 0xC3, 0xF7,
-    0xCC, 0x53, 0x96, 0xCC, 0x33, 0x03, 0x4F, 0x46, 0x38, 0x0F, 0xE1, 0x71, 0xB8, 0x44, 0xE9, 0x35,
-    0x2C, 0x2E, 0xBC, 0xF4, 0xB3, 0x2D, 0x11, 0xB2, 0xB1, 0x65, 0x49, 0x6A, 0xA5, 0x5F, 0xD1, 0x54,
-    0x58, 0xA0, 0xFF, 0x0A, 0x35, 0x96, 0xF0, 0x43, 0x3A, 0x86, 0x6C, 0xC8, 0x04, 0x53, 0x88, 0xD9,
-    0x03, 0xDB, 0x50, 0xEA, 0xD5, 0x8C, 0x07, 0xEE, 0xC5, 0xF1, 0xB0, 0xB5, 0x95, 0xF2, 0xA4, 0x20,
-    0x1F, 0x39, 0xC8, 0x17, 0x98, 0x9B, 0x7B, 0xF0, 0x35, 0x71, 0x50, 0xF9, 0xBA, 0x08, 0x62, 0x68,
-    0xE5, 0x36, 0x17, 0x5E, 0xD6, 0xD9, 0xDA, 0xCC, 0x38, 0x01, 0x44, 0x82, 0x45, 0xA4, 0x77, 0x64,
-    0x40, 0x23, 0x43, 0x05, 0xBB, 0x55, 0xB3, 0x80, 0xE4, 0xFE, 0x3E, 0x85, 0x42, 0x50, 0xAB, 0x78,
-    0xC7, 0x50, 0x12, 0xDF, 0x60, 0x86, 0x86, 0xD5, 0xF4, 0x6A, 0xC6, 0x44, 0xF6, 0x6B, 0x49, 0x6D,
-    0x65, 0x5C, 0xED, 0x49, 0xB2, 0xEB, 0xC8, 0x19, 0x5B, 0x92, 0x5D, 0xB5, 0x23, 0xD9, 0x65, 0xD4,
-    0x8B, 0x83, 0x69, 0xB2, 0xDB, 0x58, 0xCC, 0xEA, 0x57, 0x8D, 0xA7, 0x73, 0xDA, 0xFB, 0x1A, 0xB2,
-    0xCE, 0x5E, 0x0B, 0xCB, 0xA8, 0xCD, 0x1A, 0xB7, 0xD3, 0xAD, 0xA3, 0x7F, 0xDF, 0x38, 0xDA, 0x29,
-    0xF9, 0xF4, 0xC7, 0x41, 0xF5, 0x50, 0x5F, 0xC5, 0x7C, 0xA8, 0x0F, 0x5C, 0xB2, 0xD9, 0xBF, 0x68,
-    0xDC, 0x06, 0x78, 0xC0, 0xEE, 0xC1, 0xBC, 0x72, 0x8E, 0x7F, 0x56, 0x6B, 0xB6, 0x82, 0xB9, 0xFB,
-    0xE0, 0xE4, 0xC3, 0x2A, 0x31, 0x65, 0x91, 0x2B, 0x02, 0x8B, 0x64, 0x07, 0x18, 0xB3, 0x34, 0x1D,
-    0x37, 0xF8, 0xA7, 0x9B, 0xC0, 0x07, 0x3D, 0x0F, 0x88, 0xD3, 0x9C, 0xD2, 0x4F, 0x55, 0x0B, 0x1D,
-    0x25, 0xAD, 0xD9, 0xF7, 0x1F, 0xD0, 0xD9, 0xFC, 0xFA, 0xE1, 0x83, 0xA4, 0xA1, 0x00, 0x5A, 0xB9,
-    0x65, 0x30, 0xE2, 0xE8, 0x42, 0x88, 0x36, 0xFA, 0xAC, 0xF2, 0x2A, 0xAF, 0xF5, 0x0B, 0xA7, 0x0D,
-    0x0A, 0xBB, 0x09, 0x4B, 0x6B, 0x83, 0xD8, 0xC4, 0x17, 0x60, 0x42, 0xB4, 0x40, 0xA4, 0x86, 0x45,
-    0x1C, 0x40, 0x3E, 0xD9, 0x63, 0x0C, 0x7A, 0x0B, 0x7E, 0x10, 0x60, 0x41, 0x63, 0x4D, 0xF5, 0x51,
-    0x6E, 0x75, 0x61, 0xE9, 0x34, 0x7E, 0xBF, 0x56, 0xCA, 0x86, 0x95, 0x71, 0xD6, 0xB1, 0x84, 0x71,
-    0x61, 0x86, 0x7D, 0x23, 0x33, 0x8D, 0x86, 0x59, 0x43, 0x57, 0xA1, 0x82, 0x3C, 0x8A, 0xC3, 0x34,
-    0x80, 0x1B, 0xF8, 0x91, 0x74, 0x72, 0x04, 0x30, 0x0C, 0x80, 0x90, 0xE9, 0xCA, 0x0D, 0x45, 0x65,
-    0xF9, 0x19, 0x15, 0xE6, 0xD1, 0x70, 0x67, 0x78, 0x97, 0x3B, 0x48, 0xCD, 0x10, 0x6F, 0x57, 0x4C,
-    0xA6, 0x11, 0xE2, 0xDE, 0x75, 0x2C, 0x9A, 0xC6, 0x2D, 0x10, 0x00, 0x96, 0xF7, 0x54, 0x26, 0x66,
-    0x61, 0xDC, 0x56, 0x83, 0x4E, 0x59, 0xFC, 0xF3, 0xF2, 0x70, 0xBA, 0xA9, 0xBE, 0x08, 0x99, 0xF6,
-    0x8A, 0x77, 0x97, 0x3D, 0x0F, 0xB4, 0x79, 0x37, 0x94, 0xCF, 0xD6, 0xCD, 0x76, 0x18, 0xD1, 0xEE,
-    0xBC, 0x7C, 0x13, 0x2B, 0x32, 0x20, 0xD3, 0x77, 0x71, 0xF1, 0xD9, 0xB5, 0x69, 0x3D, 0xE0, 0x22,
-    0x5B, 0xC6, 0x3F, 0xDA, 0x85, 0xF6, 0x01, 0xFC, 0x14, 0x7B, 0x59, 0xCB, 0x7B, 0x3A, 0xEF, 0x68,
-    0x0F, 0xDA, 0xC5, 0xA9, 0x5B, 0xD3, 0x72, 0x9C, 0x94, 0x63, 0xF6, 0xBC, 0x10, 0x1B, 0x31, 0xCE,
-    0x36, 0x19, 0xC9, 0x4D, 0x78, 0x90, 0x66, 0x1B, 0xE4, 0xCD, 0xEB, 0x23, 0x79, 0xC1, 0x78, 0x95,
-    0x79, 0xC8, 0x1A, 0x9B, 0xD7, 0x32, 0x81, 0x11, 0xEF, 0x4D, 0xF2, 0xBA, 0xB5, 0x74, 0x4C, 0x2C,
-    0x49, 0x3C, 0x82, 0x63, 0xB7, 0x33, 0xF8, 0xEF, 0x32, 0x03, 0x1A, 0x1C, 0xDF, 0xE9, 0x7E, 0x33,
-    0xD1, 0xED, 0x33, 0xDD, 0x0A, 0xE2, 0xC8, 0x43, 0x5F, 0x9D, 0x00, 0x7F, 0x48, 0x9A, 0xB5, 0xB4,
-    0x5B, 0x50, 0xD0, 0x6A, 0x30, 0x18, 0x5E, 0x30, 0x19, 0xB4, 0x20, 0xCE, 0xF2, 0xCA, 0x4C, 0xB3,
-    0x4C, 0xFA, 0xC3, 0x66, 0x99, 0x7D, 0x94, 0x7F, 0x4C, 0x36, 0x20, 0xF3, 0x09, 0x98, 0xFC, 0x0A,
-    0x26, 0xEE, 0xCD, 0x13, 0x32, 0x87, 0xBD, 0x7E, 0x13, 0x8C, 0xB4, 0xEA, 0x99, 0x7E, 0x65, 0xF7,
-    0x75, 0x2C, 0xF6, 0x09, 0xB1, 0x9C, 0x23, 0xCD, 0x26, 0x4F, 0x23, 0x08, 0x61, 0x89, 0xB2, 0x5E,
-    0xD5, 0xAB, 0xBB, 0x12, 0xE4, 0xD7, 0x13, 0x41, 0x1E, 0x69, 0xA5, 0x48, 0xD7, 0x78, 0x3D, 0xD4,
-    0x4A, 0xD6, 0xB8, 0xB5, 0x6E, 0xF7, 0x76, 0x41, 0xF4, 0xFF, 0x15, 0x26, 0x80, 0xFF, 0x17, 0xDA,
-    0xC5, 0x37, 0x5B, 0x28, 0xE6, 0xB2, 0x31, 0x4D, 0x0D, 0x3C, 0xB4, 0xA6, 0x6B, 0x4F, 0x6F, 0x90,
-    0x85, 0x56, 0x18, 0xD9, 0x5E, 0x18, 0xE5, 0x78, 0xB5, 0x6C, 0xDC, 0x72, 0x79, 0x17, 0xEC, 0xE5,
-    0x8A, 0xA4, 0x4D, 0xC0, 0xD5, 0xDD, 0xA4, 0x0C, 0x25, 0x7D, 0x27, 0x61, 0xF9, 0x3C, 0x1B, 0x09,
-    0x10, 0xE7, 0xBF, 0xA3, 0x02, 0x2A, 0xE9, 0xE2, 0xB5, 0x26, 0x79, 0xFC, 0xB1, 0xAD, 0x38, 0x6A,
-    0x7D, 0x9D, 0x22, 0x4E, 0x22, 0x15, 0xDC, 0x05, 0x99, 0xE6, 0x8D, 0xBD, 0x05, 0xA2, 0x5F, 0xE6,
-    0x86, 0x74, 0x9F, 0xDD, 0x01, 0xB6, 0x8C, 0x1A, 0xF3, 0x60, 0x49, 0xBD, 0xCC, 0x0A, 0x9E, 0xA6,
-    0x60, 0x87, 0x44, 0x27, 0x91, 0x2E, 0x07, 0x62, 0x76, 0x5F, 0xF7, 0x4E, 0x09, 0x72, 0x90, 0x7E,
-    0x20, 0xD3, 0x10, 0x34, 0x34, 0xC0, 0x9A, 0x96, 0xA0, 0x89, 0x05, 0x0E, 0x89, 0x5A, 0xC4, 0xD9,
-    0x5C, 0x50, 0xD5, 0x6C, 0x63, 0xA9, 0xAB, 0xE3, 0x99, 0x29, 0xBD, 0x37, 0x5A, 0x52, 0xA7, 0xD2,
-    0xC9, 0xAF, 0x52, 0xAC, 0xF2, 0x37, 0xA4, 0xC5, 0x0B, 0x3C, 0x53, 0x5D, 0x9F, 0xFE, 0x5A, 0x65,
-    0xDA, 0xA9, 0x74, 0x38, 0x96, 0xD5, 0xA6, 0x00, 0x57, 0x7A, 0x44, 0x17, 0x97, 0x7E, 0x4C, 0x78,
-    0x2B, 0x9F, 0x24, 0x1F, 0x52, 0xD7, 0xF6, 0x56, 0x61, 0x4C, 0x65, 0xC1, 0xD5, 0x07, 0x92, 0x54,
-    0x4B, 0x99, 0xB3, 0x65, 0x9A, 0xC2, 0x94, 0x56, 0x4D, 0x93, 0xDA, 0xC3, 0xA2, 0xAA, 0x95, 0x93,
-    0x2C, 0x8F, 0x67, 0x84, 0x24, 0x6C, 0x4C, 0xFF, 0x1B, 0xB8, 0x8E, 0xD8, 0x1D, 0x7A, 0x62, 0x4F,
-    0x3D, 0x10, 0x60, 0x3C, 0x30, 0x4B, 0xA8, 0x1B, 0x4F, 0x17, 0x04, 0xFD, 0x37, 0x84, 0xDB, 0xCB,
-    0x73, 0x51, 0x6B, 0x07, 0x8D, 0xF9, 0xA3, 0x26, 0x48, 0x2B, 0xA0, 0xC6, 0x91, 0x2E, 0x73, 0x96,
-    0x81, 0x8E, 0xEA, 0x7E, 0xBA, 0x15, 0x10, 0x8A, 0x80, 0x57, 0x84, 0xDE, 0x9C, 0x6E, 0x52, 0x0E,
-    0xCD, 0x4F, 0x4C, 0x4C, 0x16, 0x2F, 0xBC, 0xA4, 0x56, 0xA6, 0x4F, 0x2B, 0x1D, 0x4B, 0xDF, 0x81,
-    0xE9, 0xD8, 0x8A, 0xC7, 0x8D, 0xFE, 0x11, 0xF5, 0xF9, 0xED, 0x80, 0xFE, 0x7A, 0x73, 0xBC, 0x15,
-    0xCA, 0x3A, 0xB3, 0x6A, 0xD7, 0x54, 0x15, 0xE3, 0x99, 0x22, 0x0E, 0xA0, 0x1F, 0x00, 0xA1, 0xC5,
-    0xCE, 0x15, 0x88, 0x6B, 0x65, 0x0D, 0xB7, 0x64, 0x6B, 0xC0, 0x01, 0xB6, 0x66, 0x70, 0xEB, 0x9D,
-    0x95, 0x18, 0x1C, 0x39, 0x39, 0x70, 0x29, 0xE0, 0x50, 0x40, 0x99, 0xE7, 0xA9, 0x2A, 0x64, 0x05,
-    0x17, 0xA9, 0xAC, 0x8B, 0x3A, 0xBD, 0xC0, 0x8A, 0xEB, 0x65, 0xBC, 0xA0, 0xB6, 0x62, 0x1B, 0x2F,
-    0xE2, 0xDE, 0x1A, 0x2F, 0x96, 0x36, 0x10, 0x9A, 0x98, 0x73, 0xFF, 0xB7, 0xF4, 0xBF, 0xA1, 0x0B,
-    0xFA, 0xB6, 0xF0, 0xBF, 0xC3, 0xA4, 0xF2, 0xBF, 0xCF, 0xDD, 0xBE, 0x90, 0x66, 0x61, 0x87, 0x2A,
-    0x76, 0x59, 0x91, 0x35, 0x7D, 0xC3, 0xD6, 0x28, 0x93, 0x6C, 0x00, 0xF5, 0xA3, 0x7E, 0x07, 0xF4,
-    0x6E, 0xCA, 0x72, 0xF2, 0xE3, 0x2F, 0x7C, 0xFB, 0xE3, 0xDA, 0x6C, 0x05, 0x5C, 0x36, 0xB5, 0xBA,
-    0x23, 0x13, 0xC1, 0xCE, 0x6E, 0x6D, 0x9C, 0xB0, 0xB6, 0xAE, 0x46, 0xBA, 0xB8, 0x64, 0xEB, 0x8A,
-    0x5D, 0x08, 0x2A, 0x8A, 0xA1, 0xE1, 0x2C, 0x3E, 0xCF, 0x7A, 0x92, 0x4E, 0x9F, 0x37, 0x1B, 0xE5,
-    0x60, 0x1D, 0x09, 0x64, 0xF1, 0x26, 0x46, 0x79, 0xE9, 0x76, 0x09, 0xEF, 0x94, 0xBC, 0xF5, 0x07,
-    0xF2, 0x1B, 0x7D, 0xE8, 0xD5, 0x9C, 0xFB, 0xFF, 0x74, 0xBF, 0x03, 0x97, 0xE1, 0x7F, 0x84, 0x49,
-    0xBF, 0xB5, 0xCD, 0x41, 0x58, 0xF4, 0x1A, 0xE1, 0x10, 0x99, 0x97, 0x30, 0x68, 0x02, 0xE2, 0x90,
-    0xF8, 0x52, 0xD5, 0xDE, 0xBF, 0x6A, 0x35, 0xFC, 0x32, 0x6B, 0xE6, 0xA7, 0x59, 0x54, 0x79, 0x82,
-    0x3C, 0x55, 0x97, 0x6B, 0x9A, 0x30, 0x1C, 0xEA, 0x06, 0x77, 0x8E, 0x94, 0xBE, 0x1C, 0xE2, 0xE2,
-    0xD8, 0x4B, 0x29, 0x25, 0x03, 0x4C, 0x52, 0x9C, 0x97, 0xBE, 0x43, 0xA9, 0x4D, 0x36, 0xDB, 0x32,
-    0xBD, 0xAA, 0x89, 0xF4, 0xB6, 0x51, 0x85, 0xF9, 0x89, 0xDD, 0x43, 0xA8, 0xF9, 0xD5, 0xD0, 0x39,
-    0xFD, 0xA5, 0x2C, 0x9F, 0x7E, 0x9C, 0x26, 0x32, 0x47, 0x98, 0xD6, 0x49, 0xDE, 0xA0, 0x64, 0x6A,
-    0x8C, 0x99, 0x9D, 0xDA, 0xDA, 0xFA, 0xF9, 0x56, 0xAA, 0x31, 0x05, 0xF3, 0xA0, 0xC1, 0x0C, 0xF7,
-    0x1B, 0x48, 0x80, 0x89, 0xCC, 0xED, 0x73, 0x44, 0x12, 0xA0, 0xA4, 0x72, 0xE8, 0x49, 0xD0, 0x2F,
-    0xB1, 0x73, 0xE2, 0xC3, 0x94, 0x6A, 0xE2, 0xF3, 0xBE, 0x1E, 0xBB, 0x04, 0xE4, 0xF1, 0xB2, 0x91,
-    0xEE, 0xD4, 0x63, 0xAB, 0xA2, 0xF4, 0xA5, 0x0B, 0xC0, 0x0E, 0xD3, 0xA1, 0xF0, 0x1C, 0xF1, 0x8E,
-    0xB3, 0x32, 0x1B, 0xFD, 0x94, 0x9F, 0x83, 0x8F, 0xA4, 0xD1, 0xE0, 0x23, 0xF9, 0x31, 0x49, 0xBA,
-    0xBD, 0xB3, 0xBC, 0x71, 0xC0, 0x7A, 0x33, 0x95, 0x02, 0xD9, 0xBC, 0xC8, 0xD2, 0x21, 0xCF, 0x73,
-    0x2A, 0x35, 0x53, 0x28, 0xE4, 0x6E, 0x64, 0x6C, 0x08, 0x99, 0xBA, 0xC8, 0x15, 0x73, 0x81, 0x9B,
-    0x40, 0x17, 0x86, 0x16, 0xEC, 0x62, 0xA8, 0x2A, 0x0B, 0x78, 0x65, 0x3F, 0x96, 0x51, 0x54, 0x54,
-    0x8F, 0xAD, 0xA4, 0x93, 0x1D, 0x19, 0x97, 0x32, 0xB1, 0x57, 0x21, 0x0F, 0x1B, 0xA4, 0x96, 0xEC,
-    0x27, 0xCD, 0x09, 0xA4, 0x73, 0x56, 0xFF, 0xF2, 0xA1, 0x45, 0x26, 0x97, 0xC5, 0xC1, 0x5D, 0x4A,
-    0x3A, 0xA6, 0x21, 0x47, 0x3E, 0xB6, 0xB5, 0x75, 0x35, 0xD0, 0xBA, 0x0A, 0xDF, 0x49, 0x4A, 0xFE,
-    0xCA, 0xF3, 0x39, 0x29, 0x7C, 0xF5, 0xC6, 0x31, 0x49, 0x7D, 0xA2, 0x10, 0x11, 0xB1, 0xBE, 0x8E,
-    0xC3, 0x9E, 0x6F, 0xC2, 0xBA, 0xDB, 0x61, 0x65, 0xD5, 0xC0, 0xEA, 0xF2, 0x36, 0xE5, 0x22, 0xD3,
-    0xD7, 0xD1, 0x4F, 0xDA, 0x87, 0xAE, 0xED, 0xA8, 0x33, 0xED, 0x9B, 0x9C, 0x54, 0xAD, 0x5F, 0x9B,
-    0xAF, 0xB3, 0xCA, 0x68, 0x6F, 0x4C, 0x98, 0x98, 0x5B, 0x4E, 0x26, 0xCE, 0xAA, 0xA5, 0x05, 0x23,
-    0xCE, 0x4A, 0x5F, 0x96, 0x72, 0x37, 0x29, 0x6A, 0xEE, 0xA7, 0x9C, 0x2C, 0x4C, 0xC9, 0xF6, 0x21,
-    0x37, 0x0F, 0xB9, 0x75, 0xC8, 0x8D, 0xC3, 0xA1, 0x30, 0x35, 0xB7, 0x9C, 0x14, 0x87, 0x09, 0xB7,
-    0x7E, 0xBD, 0xB4, 0x7B, 0xAF, 0x74, 0xBA, 0xA3, 0xF1, 0xD3, 0xF6, 0x28, 0x4C, 0xB7, 0xF8, 0xAF,
-    0x29, 0xF6, 0x07, 0xFF, 0x1F, 0xE5, 0x5A, 0x31, 0x90, 0xDE, 0xD6, 0x71, 0x5E, 0x00, 0x3C, 0x62,
-    0x4C, 0x14, 0xB8, 0x82, 0x8C, 0x9D, 0x70, 0x2C, 0x34, 0x29, 0x32, 0x52, 0x24, 0xB4, 0x2A, 0x44,
-    0x02, 0x8E, 0x0B, 0x17, 0x29, 0x74, 0x05, 0x6F, 0x54, 0xB8, 0xB0, 0xEB, 0x34, 0xD7, 0xA4, 0x70,
-    0x21, 0x11, 0xBF, 0xE5, 0x22, 0x85, 0x9B, 0x6B, 0x12, 0x95, 0x66, 0xC1, 0x82, 0xF9, 0x5D, 0x58,
-    0x05, 0x0B, 0x79, 0xC6, 0x34, 0x30, 0xE2, 0x78, 0x54, 0x1A, 0x23, 0x8F, 0x27, 0x45, 0x66, 0x12,
-    0x38, 0x39, 0x4F, 0x1C, 0xAA, 0x30, 0x94, 0x40, 0x21, 0x8E, 0x02, 0xF0, 0xFC, 0x7D, 0xFB, 0x1E,
-    0xF0, 0xFF, 0x47, 0x4A, 0x32, 0x4D, 0x9E, 0xC4, 0xD3, 0xE4, 0x9F, 0xC3, 0xBE, 0x77, 0x3F, 0xF0,
-    0x3F, 0xBC, 0xDD, 0xB7, 0x6F, 0xF7, 0xDB, 0xDD, 0x27, 0x82, 0xCF, 0x1E, 0x89, 0x37, 0x48, 0x64,
-    0x3A, 0x7F, 0x92, 0xC2, 0x98, 0x7C, 0xF2, 0x8D, 0x64, 0xF5, 0x95, 0x70, 0x90, 0xB8, 0x7B, 0x25,
-    0xEE, 0x24, 0x1C, 0xBB, 0xB4, 0x95, 0xC0, 0x54, 0x19, 0xA9, 0x64, 0x8D, 0xE0, 0x81, 0x62, 0x43,
-    0xF3, 0x47, 0xA8, 0x7B, 0xC6, 0x3E, 0xCF, 0xDF, 0x8E, 0xC2, 0x71, 0xF0, 0x12, 0x8E, 0x29, 0x78,
-    0x4F, 0xDA, 0x88, 0x94, 0xF7, 0xCC, 0x4A, 0xF0, 0xDE, 0x9E, 0x33, 0xB8, 0x24, 0xF6, 0x93, 0xE3,
-    0x0A, 0x5B, 0x10, 0x3C, 0x77, 0x70, 0x1C, 0x76, 0x81, 0x31, 0xEF, 0x76, 0x71, 0x97, 0x7C, 0xD8,
-    0xA6, 0x4D, 0xF4, 0x71, 0x95, 0x55, 0x21, 0xDE, 0x5A, 0x05, 0x83, 0x94, 0x15, 0x46, 0x9D, 0xC9,
-    0x64, 0x7B, 0x05, 0x09, 0x1E, 0x19, 0x30, 0xFF, 0xA8, 0x97, 0xB8, 0x8D, 0x5B, 0x09, 0xA7, 0xB2,
-    0xC6, 0xBB, 0x26, 0x72, 0x99, 0xBB, 0x97, 0x5C, 0xB4, 0x4D, 0x01, 0x76, 0xBB, 0xA4, 0x2B, 0x57,
-    0x07, 0xE6, 0x28, 0xEA, 0xB3, 0x15, 0x26, 0x2B, 0x7D, 0x9C, 0xB3, 0x79, 0x27, 0x16, 0x6D, 0xAE,
-    0x68, 0x53, 0x2A, 0x23, 0x72, 0x47, 0xEC, 0x97, 0x4F, 0xDE, 0x40, 0x28, 0xD2, 0x61, 0x22, 0x26,
-    0x17, 0xF2, 0x68, 0xEA, 0x10, 0x72, 0x90, 0xCC, 0x98, 0x8A, 0x6C, 0x9B, 0x49, 0xA7, 0xB5, 0x23,
-    0xB2, 0x25, 0x0C, 0x2B, 0x0D, 0x89, 0xBA, 0xE7, 0x6F, 0x5D, 0x58, 0x7F, 0xAB, 0xCF, 0x86, 0xD8,
-    0x7C, 0xBF, 0x8B, 0x06, 0xCF, 0xAC, 0x5A, 0x48, 0xC1, 0xBC, 0x59, 0x93, 0x9A, 0x9C, 0xF4, 0x48,
-    0x48, 0x57, 0x9F, 0x44, 0xC7, 0x2D, 0x3A, 0x79, 0xA4, 0xE6, 0x5B, 0xA0, 0x9E, 0x99, 0xCA, 0x23,
-    0x08, 0xA2, 0xCF, 0xB0, 0x08, 0x9E, 0xC8, 0xD6, 0x9B, 0xF7, 0xE6, 0x6E, 0x17, 0xD6, 0x73, 0xF7,
-    0x7A, 0xBA, 0x9A, 0xBB, 0xE9, 0xB4, 0x3C, 0x1B, 0x0F, 0x4B, 0xD7, 0xDB, 0x93, 0xED, 0x0F, 0x18,
-    0xBB, 0x09, 0xE9, 0x19, 0x30, 0x96, 0x1A, 0x4C, 0x92, 0x5D, 0x43, 0x21, 0x94, 0x8D, 0x40, 0x25,
-    0x46, 0xBC, 0x9F, 0xBF, 0xEE, 0x25, 0xE9, 0xD9, 0x0D, 0x47, 0x08, 0x07, 0x4A, 0x83, 0x2E, 0xE4,
-    0xD5, 0x09, 0x16, 0xCE, 0xE3, 0xE3, 0x39, 0x9A, 0x8A, 0x5D, 0x3B, 0x71, 0xCA, 0x4F, 0xC8, 0x49,
-    0x34, 0x2D, 0x5D, 0xCE, 0x41, 0xBB, 0x95, 0x64, 0xDD, 0xF2, 0x2D, 0x94, 0x71, 0xFE, 0x19, 0x25,
-    0xAC, 0xDD, 0x9C, 0xE3, 0xD9, 0x71, 0x21, 0x71, 0xD1, 0x2E, 0xF4, 0x07, 0x03, 0x44, 0x2B, 0x74,
-    0xA1, 0xA1, 0x29, 0x34, 0x87, 0x5D, 0x4C, 0x0A, 0x93, 0x89, 0x73, 0xAB, 0xE7, 0x98, 0x4C, 0x9A,
-    0xBF, 0x40, 0x2E, 0x3C, 0x43, 0x0A, 0xDE, 0x8E, 0xC4, 0x76, 0x67, 0xA5, 0x3A, 0xE7, 0xD8, 0x4E,
-    0xF2, 0xD7, 0x1D, 0xEB, 0xD1, 0xFB, 0x9D, 0xE3, 0xDC, 0x37, 0x8D, 0x63, 0x5C, 0x2C, 0x2F, 0x9C,
-    0xF1, 0x25, 0x71, 0x6C, 0x8B, 0x9B, 0x87, 0x91, 0xF5, 0x7A, 0x9D, 0x5B, 0xA6, 0xF1, 0xB3, 0x95,
-    0x9D, 0xFC, 0xF1, 0x6B, 0xC6, 0x71, 0xD4, 0x86, 0xA3, 0xED, 0x7D, 0xBF, 0x89, 0xFB, 0x99, 0xE1,
-    0xB4, 0x5D, 0xF8, 0x5D, 0xA4, 0xA4, 0x6B, 0x6B, 0xB9, 0x5D, 0x98, 0x1D, 0x16, 0x5E, 0x3B, 0xC9,
-    0x2D, 0xAB, 0x59, 0x13, 0x54, 0x96, 0x53, 0xEC, 0x9F, 0xCA, 0x32, 0x6A, 0xF2, 0xB8, 0x52, 0x3E,
-    0xB1, 0xF5, 0xB0, 0xE7, 0xC9, 0xA6, 0xF6, 0x1C, 0x93, 0xDC, 0x3B, 0x66, 0x90, 0xAB, 0xC2, 0x6D,
-    0x7B, 0x80, 0xFD, 0xFC, 0x1E, 0xF5, 0x13, 0x63, 0x85, 0x56, 0x89, 0x07, 0x5D, 0x30, 0xED, 0xC8,
-    0xBE, 0xB8, 0x0E, 0xD9, 0x2B, 0xFF, 0x61, 0xF0, 0xC0, 0x1D, 0x36, 0xFC, 0xFD, 0xC1, 0xA7, 0x1E,
-    0x24, 0x5D, 0x31, 0xF8, 0x1F, 0xBD, 0x36, 0x61, 0x16, 0xF1, 0xE0, 0xD7, 0x18, 0xA2, 0xA8, 0xD0,
-    0xA9, 0x92, 0x16, 0x1D, 0xFC, 0x87, 0x4D, 0x8C, 0x69, 0xB1, 0x83, 0x91, 0x4B, 0xEE, 0x6A, 0xB2,
-    0xA9, 0x1D, 0x68, 0xB2, 0xED, 0x40, 0x0A, 0xF6, 0x99, 0xB4, 0xF5, 0xEC, 0xAF, 0x8A, 0x3A, 0xCC,
-    0xB3, 0x3A, 0xA6, 0xDA, 0x47, 0x79, 0xDA, 0xA6, 0x23, 0xB8, 0x4A, 0xF2, 0xD8, 0xDC, 0x37, 0x6F,
-    0x91, 0x29, 0xDF, 0xBC, 0x6F, 0xFE, 0x55, 0x57, 0xE4, 0xDC, 0xA2, 0xA4, 0x7C, 0x83, 0x69, 0x53,
-    0x1A, 0xA2, 0xD2, 0x34, 0x3A, 0x7D, 0xA8, 0x16, 0x5F, 0x26, 0x4E, 0xDE, 0xA7, 0xDD, 0x7E, 0xD7,
-    0xB5, 0x6F, 0xBB, 0xB6, 0xDD, 0x6A, 0x31, 0xDF, 0x80, 0x2D, 0xD7, 0x80, 0x6D, 0xE6, 0x5A, 0xFD,
-    0x2C, 0xAD, 0xDB, 0x73, 0x91, 0x6B, 0xE3, 0xDE, 0x31, 0xD3, 0xDA, 0xDB, 0x6E, 0xB9, 0xA2, 0xE3,
-    0x79, 0x63, 0x5A, 0x25, 0x8D, 0x3B, 0xE5, 0x36, 0xE9, 0x95, 0xD9, 0xB8, 0x53, 0x5E, 0xCF, 0x1F,
-    0xEA, 0xD4, 0xEC, 0xAE, 0x71, 0x8D, 0xB7, 0xBE, 0xA9, 0x8D, 0xE9, 0xF4, 0xCB, 0xC4, 0x36, 0xF1,
-    0xE3, 0x36, 0xDF, 0xB5, 0xCD, 0xDB, 0xB6, 0x69, 0x97, 0x46, 0x79, 0x8B, 0x3B, 0x65, 0x8D, 0x73,
-    0xD1, 0xC6, 0xCD, 0xEC, 0x44, 0x63, 0xD9, 0x48, 0x6D, 0x53, 0xD4, 0x96, 0x27, 0xE5, 0x21, 0xEA,
-    0xAD, 0x8D, 0x2C, 0x21, 0x99, 0x3A, 0x01, 0x69, 0x69, 0xF3, 0x1B, 0x90, 0x0B, 0x39, 0xD5, 0x42,
-    0x1C, 0xF1, 0xD7, 0x87, 0xC1, 0x18, 0x18, 0xDE, 0x28, 0x9A, 0xF9, 0x91, 0xC7, 0x27, 0x21, 0xD5,
-    0xF2, 0xC0, 0x1C, 0x66, 0x4D, 0x69, 0xDA, 0x4C, 0xAD, 0xF4, 0x86, 0x70, 0x3E, 0x05, 0x25, 0x4C,
-    0x07, 0x96, 0xD0, 0x12, 0x26, 0x8D, 0x64, 0x13, 0xF6, 0x49, 0xA7, 0x8A, 0x04, 0x2D, 0x3B, 0x52,
-    0x4D, 0xC2, 0xE6, 0x94, 0x88, 0x4B, 0xDB, 0x48, 0x22, 0xAA, 0xC0, 0xDD, 0xDC, 0x19, 0x5C, 0xE7,
-    0x3F, 0x8D, 0xEB, 0xFC, 0xC6, 0xAC, 0x6C, 0xA7, 0x29, 0x2B, 0xD7, 0xC9, 0x5A, 0xD7, 0x49, 0x7A,
-    0xD7, 0x89, 0x46, 0xD7, 0x09, 0x8C, 0xEB, 0x88, 0xF9, 0x91, 0xEB, 0x94, 0xC6, 0x75, 0xB2, 0xB9,
-    0x13, 0xCF, 0x9D, 0x50, 0x3B, 0x7E, 0xEB, 0xEC, 0xC0, 0x0B, 0x98, 0xB2, 0x76, 0x32, 0xC8, 0xB4,
-    0x58, 0x94, 0xE9, 0x13, 0x3A, 0xB3, 0x7E, 0xCD, 0x0B, 0xB3, 0x68, 0x18, 0x86, 0x74, 0xBE, 0x20,
-    0xEA, 0xE5, 0xA4, 0x92, 0x61, 0xF5, 0xAC, 0x2C, 0x92, 0xCE, 0x8A, 0x22, 0xE9, 0xAC, 0x24, 0xA8,
-    0x68, 0x14, 0x84, 0x38, 0x39, 0x88, 0x15, 0x83, 0xB7, 0xBE, 0xA1, 0x52, 0xA0, 0xB2, 0xA9, 0x10,
-    0xD2, 0xCE, 0xCA, 0x00, 0x6A, 0xA3, 0x22, 0x60, 0x4B, 0x09, 0xB0, 0xA5, 0x00, 0xD8, 0x92, 0x7F,
-    0xB6, 0x64, 0x5F, 0x5B, 0x70, 0xAF, 0x6D, 0xE6, 0xDA, 0xD8, 0xB5, 0x21, 0x5B, 0xCB, 0x39, 0x14,
-    0x4F, 0x19, 0xA7, 0xE6, 0x91, 0xEF, 0x99, 0xA7, 0x87, 0xDB, 0xC4, 0xB1, 0xE8, 0xD4, 0xCF, 0xE9,
-    0xDF, 0xAC, 0x80, 0x70, 0xC5, 0x27, 0x9C, 0x9D, 0xE3, 0xDF, 0x79, 0x41, 0xD7, 0xF8, 0x37, 0x4E,
-    0x38, 0x42, 0x79, 0xFE, 0x56, 0xDA, 0xC9, 0xFA, 0x56, 0x36, 0xC0, 0x15, 0x9A, 0x21, 0x34, 0x1F,
-    0xD0, 0x01, 0x04, 0x06, 0x06, 0x3A, 0x1A, 0x60, 0x91, 0x61, 0xAB, 0x06, 0xF5, 0xCE, 0x4F, 0xD0,
-    0x40, 0x53, 0x0D, 0x0C, 0x5F, 0x6A, 0x0E, 0x81, 0x62, 0x86, 0xC2, 0x34, 0xA6, 0x77, 0xAB, 0x36,
-    0x37, 0xFD, 0xB6, 0x89, 0x70, 0x4C, 0xAA, 0x22, 0x63, 0x91, 0x74, 0x11, 0x83, 0x63, 0xEE, 0x28,
-    0xE2, 0x8E, 0xB8, 0xCA, 0xF8, 0x7F, 0xAB, 0xBF, 0x34, 0xED, 0x86, 0xFB, 0x4B, 0xF9, 0x96, 0x5B,
-    0x57, 0xE3, 0x52, 0xE8, 0x08, 0xA5, 0x3E, 0x63, 0x38, 0xA8, 0xF7, 0x01, 0xDF, 0x10, 0xFC, 0x0B,
-    0x7F, 0x1B, 0xDC, 0xE5, 0x2E, 0x8C, 0xDE, 0x54, 0x93, 0xF0, 0x0D, 0x35, 0x21, 0x42, 0xF1, 0xBD,
-    0x04, 0x6B, 0x2D, 0x72, 0x45, 0x77, 0xCF, 0xF5, 0xB5, 0x7A, 0x43, 0xC3, 0xD7, 0x74, 0x14, 0x3A,
-    0x56, 0x09, 0x93, 0x0C, 0x1A, 0xF5, 0x26, 0x35, 0x6D, 0x5D, 0x5C, 0x71, 0xFD, 0xCA, 0x63, 0x39,
-    0x00, 0x5B, 0x00, 0x79, 0x06, 0x56, 0xDE, 0xCB, 0x83, 0x26, 0xC9, 0xBD, 0xFE, 0x3A, 0x5E, 0x3E,
-    0x58, 0x7D, 0xDC, 0xC9, 0x9D, 0x8B, 0x39, 0xC6, 0xB2, 0x43, 0x83, 0x9A, 0xA2, 0x4A, 0x6A, 0xEC,
-    0xE1, 0x8A, 0x5C, 0xF2, 0x2A, 0x9A, 0xF3, 0xC6, 0x34, 0xE9, 0x71, 0xD1, 0x14, 0xF8, 0xBE, 0xAC,
-    0x36, 0x57, 0x51, 0x63, 0x7B, 0x9B, 0x7F, 0x3F, 0x8E, 0xA6, 0x78, 0x22, 0xE6, 0x81, 0x83, 0x83,
-    0x6B, 0x83, 0x53, 0x83, 0x09, 0xA5, 0x75, 0xDC, 0x77, 0x2E, 0x02, 0x06, 0xD3, 0xA7, 0xEB, 0x97,
-    0xC7, 0xFF, 0xC3, 0xF3, 0x2F, 0x98, 0x23, 0xFC, 0x76, 0x57, 0x76, 0xDF, 0xF0, 0xBA, 0xE4, 0x87,
-    0x75, 0x64, 0x14, 0x63, 0x5E, 0xE3, 0x98, 0x7F, 0xB1, 0x96, 0xC4, 0x82, 0x91, 0xCF, 0xFC, 0x83,
-    0x33, 0xBF, 0x6C, 0x8E, 0x52, 0xEC, 0x93, 0x73, 0xEA, 0xB1, 0x92, 0xFC, 0x0D, 0xAA, 0xE2, 0x7F,
-    0x50, 0xE0, 0xC4, 0x14, 0xA2, 0xDE, 0x71, 0x0B, 0x40, 0x53, 0xEC, 0xBA, 0x1C, 0x85, 0x85, 0x1D,
-    0xE4, 0x5F, 0xA1, 0xBC, 0x83, 0xE0, 0x16, 0x8E, 0x3F, 0x39, 0x94, 0x9F, 0x1E, 0x0B, 0xCA, 0x7B,
-    0x39, 0x97, 0x29, 0x5E, 0xC9, 0x50, 0x60, 0x26, 0x58, 0x26, 0xA8, 0xBF, 0xEC, 0x38, 0x74, 0x78,
-    0x70, 0x4C, 0x44, 0x51, 0x01, 0xD5, 0x13, 0xD4, 0xF7, 0x04, 0xEC, 0x44, 0xEE, 0xE5, 0xE6, 0x9A,
-    0xD8, 0xF2, 0x3B, 0xDE, 0x23, 0x96, 0x27, 0x94, 0x57, 0x24, 0x4F, 0x20, 0x4F, 0x3B, 0xC3, 0x17,
-    0x40, 0xCD, 0xF8, 0x0A, 0x91, 0xE1, 0xBA, 0x2A, 0xE4, 0xB0, 0xD9, 0xB4, 0x3B, 0x0B, 0x10, 0x05,
-    0xC4, 0x8F, 0x4D, 0x7D, 0x60, 0xBA, 0xC8, 0x1C, 0x52, 0xF8, 0x83, 0xC3, 0xE2, 0xA7, 0x45, 0x2D,
-    0xA4, 0xC7, 0x46, 0xF6, 0xDA, 0x19, 0xD0, 0xC3, 0xAF, 0xAD, 0x68, 0x2E, 0xC6, 0x05, 0xCD, 0xEF,
-    0x51, 0xB5, 0x7E, 0x06, 0xFD, 0x96, 0xEC, 0x55, 0xAC, 0x56, 0xCC, 0xAD, 0x10, 0x6A, 0x48, 0x72,
-    0x6D, 0x31, 0x10, 0x17, 0xD6, 0x39, 0xC1, 0x3D, 0x76, 0x34, 0xB6, 0x75, 0xF0, 0x18, 0x64, 0x5C,
-    0x08, 0x11, 0xBD, 0x02, 0x7A, 0x8B, 0xE7, 0x15, 0xCE, 0x2B, 0x9A, 0x07, 0xE0, 0x52, 0x3D, 0x51,
-    0x9C, 0xBB, 0xFE, 0x67, 0x45, 0xF6, 0xE7, 0x74, 0x83, 0xEB, 0x36, 0xEF, 0xB2, 0x7C, 0xEE, 0x6F,
-    0x7D, 0xCE, 0x84, 0xC4, 0x32, 0x53, 0x93, 0xE0, 0xDE, 0xA5, 0x7D, 0x4C, 0xF2, 0x6B, 0x1E, 0xEE,
-    0x17, 0x0C, 0x85, 0x94, 0x5C, 0x0D, 0x9A, 0x13, 0xC6, 0xF5, 0xF3, 0x90, 0x1D, 0x5E, 0xA5, 0xC6,
-    0x51, 0x41, 0x91, 0xA7, 0x9A, 0x1D, 0xA8, 0x29, 0xFC, 0xC6, 0x97, 0x43, 0x82, 0x5B, 0x3E, 0x2D,
-    0xE1, 0xBC, 0x39, 0x53, 0xF9, 0x99, 0x3C, 0x13, 0x59, 0x06, 0x35, 0xBD, 0xBD, 0xF4, 0x77, 0x54,
-    0x3A, 0xDD, 0xB6, 0x73, 0xFD, 0x64, 0x59, 0xE6, 0xE7, 0xCE, 0x9E, 0x2C, 0xAF, 0x50, 0x50, 0xC9,
-    0x8F, 0x2A, 0x1A, 0xBA, 0x19, 0x67, 0x5E, 0xA4, 0x15, 0xFA, 0x62, 0x65, 0x69, 0xE1, 0x87, 0x6F,
-    0x7D, 0xFB, 0xCF, 0x5D, 0xC0, 0xF9, 0x65, 0xD3, 0x4B, 0x85, 0x52, 0x8A, 0x23, 0x22, 0xEA, 0x26,
-    0x9F, 0x7F, 0x36, 0x7B, 0x1C, 0x73, 0x3E, 0x82, 0x23, 0x06, 0xDA, 0xFF, 0x1B, 0xB3, 0x7A, 0x19,
-    0x60, 0x67, 0x57, 0x01, 0x03, 0x21, 0xA0, 0x5E, 0x00, 0xF4, 0x00, 0xF5, 0xF7, 0x7E, 0xD2, 0x96,
-    0xAB, 0xA4, 0x05, 0x28, 0x6D, 0xB3, 0x2A, 0xAD, 0xD3, 0x1A, 0x91, 0xEA, 0x03, 0x7A, 0xF8, 0xDE,
-    0x32, 0xE5, 0xAB, 0x6D, 0x0D, 0x34, 0x81, 0xE3, 0x6F, 0xD9, 0xD9, 0xB0, 0x2D, 0x16, 0x1A, 0x34,
-    0x57, 0xE5, 0xA1, 0xCF, 0x33, 0x05, 0x52, 0x9A, 0x89, 0xC1, 0x80, 0xFB, 0x80, 0x38, 0x87, 0x5F,
-    0x51, 0x95, 0xE1, 0xE5, 0xB7, 0xE9, 0x26, 0x9D, 0x73, 0x0A, 0x80, 0x0A, 0xF2, 0xB8, 0xA5, 0xB2,
-    0x19, 0x97, 0xFE, 0x9C, 0x42, 0x52, 0xEE, 0x35, 0x98, 0x72, 0x92, 0xB8, 0x70, 0x46, 0x40, 0xA6,
-    0x8F, 0x66, 0x91, 0x8D, 0x67, 0xC3, 0x3B, 0x35, 0x58, 0x6C, 0xCF, 0x9F, 0x1E, 0xD8, 0x54, 0xAC,
-    0x36, 0x9C, 0x68, 0xBD, 0xFD, 0x6B, 0xDB, 0x1A, 0xC2, 0xE4, 0xD1, 0xB0, 0xD5, 0x06, 0xBF, 0x6F,
-    0x85, 0x6D, 0x74, 0xD0, 0xCA, 0xEB, 0x9C, 0x18, 0x66, 0xF5, 0x0A, 0x6D, 0x13, 0xDA, 0xBF, 0x42,
-    0xFB, 0xBA, 0x33, 0xAB, 0x9D, 0x6D, 0xBD, 0xD6, 0xB6, 0x41, 0x9D, 0x6A, 0x06, 0x27, 0x5C, 0xD9,
-    0x36, 0x76, 0xE6, 0x37, 0xDD, 0x3F, 0x68, 0x5D, 0xA2, 0x4E, 0xDB, 0x9F, 0xBA, 0xFF, 0x5B, 0xDE,
-    0xDF, 0x11, 0xBF, 0x61, 0x1B, 0x4B, 0xA8, 0x49, 0xA6, 0x84, 0x92, 0x42, 0x9B, 0x49, 0xD9, 0xFB,
-    0x9A, 0xC9, 0x33, 0x63, 0xC8, 0x04, 0x18, 0x57, 0x48, 0x41, 0xA8, 0xA5, 0xEA, 0xB0, 0x9D, 0x8C,
-    0xFA, 0xCB, 0x13, 0xA5, 0x54, 0x9A, 0x1A, 0x72, 0x1A, 0xE2, 0x16, 0x92, 0xEA, 0xA2, 0x1E, 0xB2,
-    0x6A, 0x43, 0xC5, 0xEE, 0xD8, 0xA9, 0x52, 0x7C, 0xF4, 0xDA, 0x78, 0x9E, 0xE3, 0x8C, 0x90, 0xD9,
-    0x83, 0xF5, 0x2D, 0x48, 0xAD, 0x65, 0x56, 0xE7, 0x04, 0xED, 0xE5, 0x65, 0x48, 0x6F, 0x92, 0x3E,
-    0x33, 0x1F, 0x62, 0xB2, 0x40, 0xD2, 0x29, 0x0C, 0xCB, 0x9E, 0x6C, 0xF2, 0x94, 0x58, 0xB4, 0xDC,
-    0x71, 0x02, 0x0B, 0x94, 0xF4, 0x34, 0xD0, 0x61, 0xAF, 0x8B, 0x6D, 0x17, 0x7E, 0xE5, 0x62, 0x57,
-    0x47, 0x9B, 0x8D, 0x7E, 0xCD, 0x14, 0x6B, 0x4E, 0xD4, 0x5B, 0x30, 0xF6, 0xE7, 0x0F, 0xF1, 0x24,
-    0xC6, 0x49, 0x5B, 0xAE, 0x73, 0xDC, 0x5F, 0xF8, 0xC9, 0x94, 0x53, 0x5D, 0x7A, 0x82, 0x63, 0x46,
-    0x53, 0xC5, 0x54, 0x76, 0xB4, 0x6D, 0x1A, 0x44, 0xB9, 0x18, 0x84, 0x51, 0xC9, 0xFF, 0x31, 0xB3,
-    0xC8, 0xB8, 0xB4, 0xCD, 0x7E, 0x01, 0xDF, 0x9B, 0xD6, 0x92, 0x82, 0xFD, 0x2D, 0x12, 0x37, 0xD0,
-    0xFD, 0xE8, 0xA3, 0x42, 0x13, 0xB0, 0x98, 0xF9, 0x6F, 0xC1, 0x44, 0x44, 0xD1, 0xC5, 0xDC, 0x0C,
-    0x78, 0x5B, 0xCD, 0x01, 0x3A, 0xEA, 0x20, 0x00, 0xFB, 0xBD, 0x1F, 0x8F, 0x52, 0x8A, 0x37, 0xCA,
-    0x04, 0xD4, 0xBC, 0x9A, 0xFC, 0x1F, 0x4F, 0x79, 0x99, 0xC3, 0x0B, 0x64, 0x7C, 0xEE, 0xBC, 0x39,
-    0x96, 0x39, 0x78, 0x8B, 0x2A, 0x6E, 0x5D, 0xBF, 0x1B, 0x97, 0xDD, 0xE2, 0xB8, 0xDC, 0x0A, 0xDE,
-    0x4E, 0x41, 0x4A, 0x9E, 0x4A, 0x89, 0x14, 0x77, 0x93, 0x41, 0x93, 0xA4, 0xBD, 0x2A, 0x4A, 0xEF,
-    0xFE, 0x3E, 0x5B, 0x4A, 0x1E, 0xB7, 0x54, 0x58, 0xC3, 0x69, 0x79, 0x3D, 0xFD, 0x57, 0xD9, 0xCF,
-    0xAF, 0xFB, 0x22, 0x64, 0x48, 0xAF, 0x37, 0xD1, 0x7D, 0x42, 0x86, 0xAD, 0xE8, 0x76, 0xF0, 0xCB,
-    0xFF, 0x56, 0x19, 0x72, 0xA7, 0x87, 0x8A, 0x54, 0x7C, 0x8B, 0x54, 0x74, 0x66, 0x4E, 0x12, 0x3B,
-    0xF9, 0x26, 0xAB, 0xDD, 0x17, 0x26, 0x4F, 0xCD, 0xEF, 0x32, 0x8D, 0xDF, 0xA2, 0x4E, 0xD3, 0xB9,
-    0x9A, 0x7A, 0x4D, 0x35, 0x7B, 0xF6, 0x06, 0xA9, 0xA7, 0x69, 0x68, 0x22, 0x46, 0xCF, 0x30, 0x48,
-    0xF1, 0x4C, 0xA1, 0x29, 0x68, 0x6E, 0x34, 0x8F, 0x13, 0x03, 0x7D, 0x55, 0x53, 0xB2, 0xA1, 0xA6,
-    0xB1, 0x03, 0x4D, 0x73, 0xBB, 0x44, 0x37, 0x6C, 0x16, 0x68, 0xC6, 0xD9, 0xE7, 0xE9, 0x20, 0x08,
-    0x23, 0xA1, 0xF0, 0x88, 0x24, 0x3D, 0x44, 0x40, 0x9A, 0x82, 0xD5, 0xF4, 0x6B, 0xFC, 0x5E, 0xE3,
-    0x52, 0x7D, 0xBE, 0x82, 0xD4, 0x7D, 0x37, 0xC1, 0x92, 0x0A, 0x90, 0x6C, 0xE5, 0xC2, 0x1E, 0x22,
-    0x17, 0x98, 0x1A, 0x8B, 0x4C, 0x1D, 0x8C, 0x10, 0x48, 0x30, 0xFA, 0x8C, 0x08, 0x21, 0xBA, 0x60,
-    0xC4, 0x92, 0x20, 0xEC, 0xC2, 0x23, 0x93, 0x26, 0xDA, 0x21, 0xC2, 0xC0, 0x14, 0xBC, 0xAB, 0x7A,
-    0x12, 0xF3, 0x61, 0x38, 0xFA, 0x70, 0xF2, 0xCD, 0xEA, 0xC0, 0x1C, 0x96, 0x1D, 0x4C, 0xE5, 0xE5,
-    0xFE, 0x6C, 0x04, 0x9D, 0x1A, 0x01, 0x8A, 0x45, 0xE9, 0xED, 0x16, 0xED, 0xAD, 0xD2, 0xB7, 0x1B,
-    0x05, 0x3E, 0x85, 0x00, 0x94, 0xEB, 0x79, 0xD5, 0xA1, 0x69, 0x5A, 0xE3, 0xC9, 0x45, 0x9F, 0x09,
-    0x17, 0x45, 0xE7, 0x63, 0xE9, 0xCE, 0xFE, 0xDE, 0x59, 0x09, 0xCA, 0x1F, 0x57, 0x3E, 0x84, 0x05,
-    0xDE, 0xEC, 0xFA, 0x3E, 0x67, 0x59, 0x31, 0x86, 0xF7, 0x5B, 0xEC, 0x9C, 0x01, 0x38, 0x35, 0x1B,
-    0xAD, 0xFC, 0x5C, 0xE4, 0x9E, 0x18, 0xD3, 0xBB, 0xAB, 0x4B, 0xF7, 0x5F, 0x6B, 0x5E, 0xC4, 0x40,
-    0x2F, 0xEA, 0x40, 0x3D, 0xA1, 0x94, 0x1D, 0x37, 0x9B, 0xE8, 0x19, 0x09, 0xD7, 0x06, 0xAB, 0xDC,
-    0x81, 0xF9, 0x1A, 0x98, 0xB9, 0x23, 0xB3, 0x03, 0xC7, 0xFC, 0x80, 0x17, 0xB3, 0x07, 0x65, 0x13,
-    0xD1, 0xEE, 0x61, 0x0F, 0x6B, 0x62, 0x62, 0x79, 0x27, 0xE7, 0xB1, 0x49, 0x4C, 0x5C, 0x58, 0xAF,
-    0x6F, 0xC2, 0x70, 0xF4, 0xB8, 0xBA, 0xF8, 0x1F, 0xBF, 0xDD, 0xC4, 0x78, 0xC9, 0xD7, 0x25, 0xB3,
-    0x93, 0x67, 0xF0, 0x0E, 0x3F, 0x28, 0xC9, 0xA1, 0x7D, 0xEF, 0x9F, 0x31, 0x40, 0x65, 0x56, 0x83,
-    0x36, 0x8E, 0x99, 0xB6, 0x50, 0xAF, 0x1D, 0x5C, 0x57, 0x25, 0xEA, 0x99, 0x5D, 0xCC, 0x56, 0x69,
-    0x93, 0x3C, 0xD0, 0x14, 0xA8, 0xEC, 0xCA, 0xC5, 0x2B, 0xCC, 0x01, 0x35, 0x4F, 0x90, 0x03, 0x7A,
-    0x24, 0x25, 0xA4, 0x69, 0xDC, 0x91, 0x81, 0x54, 0x99, 0xFF, 0x7F, 0x29, 0xB2, 0x59, 0x36, 0x67,
-    0x4C, 0x94, 0x3B, 0x67, 0xA6, 0x05, 0x35, 0x3B, 0xBE, 0xCB, 0xBC, 0x7E, 0xC9, 0x0A, 0x6A, 0x2E,
-    0x1C, 0x9A, 0xD3, 0xEC, 0x07, 0x8F, 0x24, 0xDE, 0x3F, 0x35, 0x39, 0x7F, 0x66, 0x0B, 0x6A, 0x73,
-    0x56, 0xCB, 0xCE, 0xD3, 0x96, 0x72, 0x2C, 0xD6, 0xB7, 0x46, 0x68, 0x57, 0xCE, 0x12, 0x1A, 0xB1,
-    0x6E, 0x53, 0x1D, 0x28, 0xC1, 0x28, 0x70, 0x05, 0xA7, 0x9B, 0x6F, 0x4E, 0x09, 0x3C, 0x13, 0x34,
-    0x02, 0x8C, 0x91, 0x39, 0xE0, 0xFF, 0x3B, 0xAD, 0xD5, 0x89, 0x66, 0x9F, 0x57, 0x32, 0x6F, 0xB0,
-    0x3F, 0xBD, 0x83, 0xCF, 0x37, 0x31, 0xFE, 0x56, 0xC7, 0xC9, 0xDC, 0x75, 0xBA, 0x3F, 0xD2, 0x91,
-    0x4D, 0x67, 0xC5, 0xA5, 0xA1, 0xA5, 0x61, 0xCC, 0x03, 0x70, 0x22, 0xE9, 0x03, 0xDA, 0x04, 0x33,
-    0xCC, 0x81, 0xFE, 0x76, 0xAC, 0x9F, 0x75, 0xC9, 0x94, 0x67, 0x7D, 0x69, 0x9A, 0x70, 0xEA, 0x92,
-    0x2E, 0x60, 0xB1, 0x02, 0x60, 0x47, 0xA1, 0x44, 0x30, 0x61, 0xF7, 0x80, 0x8C, 0x8F, 0x90, 0x91,
-    0x9A, 0xC0, 0x12, 0x87, 0xD6, 0x39, 0xE2, 0x0E, 0x24, 0xD1, 0x4A, 0x5F, 0xCD, 0x13, 0x1F, 0xB9,
-    0xDE, 0x07, 0x2E, 0xE9, 0xB8, 0x95, 0x68, 0xAF, 0x8E, 0x3E, 0x19, 0xEC, 0x68, 0x92, 0xF5, 0xC0,
-    0xDC, 0xA0, 0x81, 0x6C, 0x17, 0xCD, 0x0C, 0xA6, 0x4D, 0x12, 0xC2, 0xA9, 0x66, 0x68, 0xED, 0xC8,
-    0xE2, 0xAF, 0x6D, 0x05, 0xCB, 0xD6, 0xAF, 0x6C, 0xF5, 0xCA, 0xD6, 0xAE, 0x6C, 0xE5, 0xCA, 0x96,
-    0xEF, 0x6C, 0xED, 0xCE, 0xD6, 0xAC, 0x6C, 0xC5, 0xCA, 0xD6, 0xAB, 0x6C, 0xB5, 0xCA, 0xD6, 0xAA,
-    0x6C, 0xA5, 0xCA, 0xD6, 0xA9, 0x6C, 0x95, 0xCA, 0xD6, 0xA8, 0x6C, 0x85, 0xCA, 0xD6, 0xA7, 0x6C,
-    0x75, 0xCA, 0xD6, 0xA6, 0x6C, 0x65, 0xCA, 0x22, 0x76, 0x8D, 0xD1, 0xB4, 0x7A, 0xE3, 0xE9, 0x56,
-    0xCA, 0xB6, 0xE5, 0xAA, 0x15, 0x25, 0xAD, 0x27, 0x69, 0x35, 0x49, 0x6B, 0x49, 0x5A, 0x49, 0xDA,
-    0xCA, 0x7B, 0x7C, 0x26, 0xD1, 0xBA, 0x91, 0x56, 0x8D, 0xB4, 0x66, 0x24, 0x4E, 0x51, 0x02, 0xBB,
-    0x6B, 0x35, 0x2A, 0x7F, 0x69, 0x6B, 0x25, 0xAD, 0xA1, 0x6D, 0x6F, 0x73, 0x36, 0xF5, 0xCB, 0xA4,
-    0xCD, 0xDF, 0x6F, 0x15, 0x89, 0x9A, 0x4D, 0xFF, 0x63, 0xAD, 0x4D, 0xFC, 0x97, 0x8D, 0xD0, 0x49,
-    0xC3, 0xBB, 0xD3, 0x23, 0x11, 0xBA, 0x59, 0x22, 0x74, 0xB8, 0xAB, 0x39, 0x42, 0xF7, 0x5A, 0x9A,
-    0x52, 0x78, 0x77, 0x58, 0x1B, 0x20, 0x67, 0x02, 0x9A, 0x8A, 0x4B, 0xB8, 0x1D, 0x9B, 0xD3, 0x3C,
-    0x89, 0x87, 0x01, 0x43, 0xFA, 0xDE, 0xDC, 0x56, 0x03, 0xE8, 0x87, 0xBF, 0x87, 0x78, 0xF8, 0xED,
-    0x17, 0x45, 0x6E, 0xFF, 0x35, 0x00, 0xC7, 0x60, 0x63, 0xF5, 0xED, 0x38, 0xBD, 0xCD, 0xAA, 0xA4,
-    0x41, 0x9C, 0x5E, 0x3F, 0x51, 0x9C, 0xBE, 0x64, 0xEA, 0x67, 0xC3, 0xEC, 0x86, 0x97, 0xCC, 0x95,
-    0x41, 0x67, 0xBD, 0x3F, 0x79, 0x02, 0xE6, 0xCB, 0x12, 0xBF, 0x3B, 0x08, 0x64, 0x0D, 0x6C, 0xA9,
-    0x66, 0x66, 0xDC, 0xA0, 0xC4, 0xE5, 0xE0, 0xD4, 0x17, 0x16, 0xD1, 0x7B, 0x8A, 0x3E, 0x75, 0x0B,
-    0xBB, 0x8A, 0x65, 0xA2, 0xDB, 0xF4, 0xEA, 0xB6, 0x07, 0xF1, 0x6B, 0xC2, 0xDB, 0xFB, 0x95, 0xC2,
-    0xEA, 0xD5, 0x06, 0x56, 0xA7, 0x0A, 0xAB, 0x0B, 0x85, 0xD5, 0xF7, 0x09, 0xAB, 0xB9, 0x51, 0xE1,
-    0x99, 0xDF, 0xA5, 0x3B, 0x0E, 0xDF, 0x24, 0x8D, 0x15, 0x4A, 0x3F, 0xA7, 0xF4, 0x15, 0xA5, 0xB7,
-    0xF5, 0xE7, 0x2D, 0xE9, 0xFF, 0xD4, 0x84, 0xD5, 0xF7, 0x79, 0xAC, 0x2C, 0x36, 0x39, 0xB5, 0xD0,
-    0xA8, 0x5E, 0x9A, 0x2D, 0x58, 0xFD, 0xB1, 0xEE, 0x98, 0x66, 0xAB, 0xEA, 0xA6, 0x7B, 0x96, 0x0A,
-    0x6D, 0x18, 0x3F, 0x32, 0x92, 0x9C, 0xB7, 0xCE, 0x6D, 0x39, 0x78, 0xD0, 0x32, 0x9C, 0xB2, 0x20,
-    0x3A, 0x06, 0x88, 0x4E, 0x01, 0xA2, 0x0B, 0x80, 0xE7, 0xFF, 0x1D, 0xCB, 0x77, 0x7F, 0x35, 0x96,
-    0x77, 0xEF, 0x4E, 0xE5, 0x2F, 0x01, 0xA2, 0xFF, 0x0D, 0x20, 0x7A, 0x00, 0x88, 0xEE, 0x36, 0x20,
-    0x1A, 0xC0, 0x55, 0xE2, 0x79, 0x01, 0xAE, 0x69, 0x6D, 0x6D, 0x52, 0x93, 0x55, 0xA8, 0xA7, 0x4A,
-    0x7E, 0xD0, 0x6A, 0xD4, 0xAA, 0x5A, 0x99, 0x5F, 0x3C, 0x1B, 0xF9, 0xB3, 0x4B, 0xD0, 0xA6, 0xEC,
-    0x87, 0xD0, 0xB8, 0x77, 0xE1, 0x7D, 0x1B, 0x20, 0xAC, 0x0E, 0x81, 0xF1, 0xEE, 0xCE, 0x69, 0xE6,
-    0xCD, 0x36, 0x36, 0x49, 0x93, 0xB0, 0x12, 0xFC, 0x96, 0x11, 0x7B, 0xB4, 0xA2, 0xC9, 0xF2, 0xB6,
-    0xA0, 0xC8, 0x33, 0x95, 0x83, 0x66, 0x14, 0x08, 0x95, 0xE1, 0x15, 0xFD, 0xE3, 0x02, 0xDB, 0x38,
-    0x46, 0xF8, 0xE1, 0x9D, 0x9A, 0x1C, 0x76, 0xF6, 0xAE, 0xD1, 0x0E, 0x52, 0xE1, 0x06, 0x26, 0xFC,
-    0xEF, 0x60, 0x0A, 0x92, 0x32, 0x3A, 0xDA, 0x99, 0xC5, 0xC4, 0x33, 0x36, 0x15, 0xAD, 0x0F, 0xC1,
-    0x68, 0x44, 0xA7, 0x1F, 0x2C, 0xC4, 0x5B, 0x79, 0x66, 0x3E, 0xF6, 0xE3, 0x88, 0x19, 0x66, 0xF2,
-    0xD0, 0x0D, 0x47, 0xF6, 0xF4, 0x20, 0x8F, 0x12, 0x9F, 0x8E, 0x4B, 0x4F, 0xF2, 0xE8, 0x39, 0x9E,
-    0x4B, 0x00, 0x53, 0xC5, 0xDF, 0x62, 0xCD, 0xEF, 0xF6, 0x12, 0x35, 0x18, 0xA1, 0xBD, 0xBA, 0xAC,
-    0xB9, 0x14, 0x3D, 0xFD, 0x74, 0x8E, 0x90, 0xA8, 0x42, 0x48, 0x04, 0x4B, 0x1C, 0xB7, 0x80, 0xA6,
-    0x5D, 0xF9, 0xEB, 0xEF, 0x74, 0x30, 0x44, 0x5D, 0x79, 0x6F, 0x7D, 0x83, 0xA2, 0xA6, 0xA0, 0x99,
-    0x0F, 0x86, 0x85, 0xB8, 0x11, 0xF7, 0x7E, 0x13, 0xD2, 0xD8, 0xCD, 0x15, 0x5F, 0xDD, 0xF5, 0x1A,
-    0x4C, 0xC4, 0x34, 0x81, 0xD9, 0xB7, 0xC1, 0xE6, 0x2B, 0x3C, 0x46, 0x79, 0xF1, 0x0B, 0xE7, 0xF5,
-    0x91, 0x75, 0xAD, 0x62, 0x99, 0xD7, 0xF5, 0x34, 0x78, 0xDD, 0xA7, 0x2C, 0x5F, 0x85, 0x11, 0xBF,
-    0xDB, 0x49, 0x54, 0xF3, 0xE0, 0x0E, 0x64, 0xB9, 0x67, 0x65, 0x19, 0x28, 0x7B, 0x30, 0x41, 0xF4,
-    0x79, 0x4B, 0x99, 0xE2, 0x09, 0x2E, 0xFC, 0xDE, 0x2F, 0x27, 0x06, 0x25, 0xD5, 0x89, 0xF7, 0x35,
-    0x27, 0xDF, 0xE7, 0xAD, 0x6F, 0x28, 0xE8, 0xB1, 0xB1, 0xEE, 0x63, 0x5E, 0x44, 0x95, 0x18, 0xDB,
-    0xB7, 0x51, 0x0E, 0xA1, 0xB7, 0x69, 0x92, 0xB7, 0xDA, 0x17, 0xA5, 0xBB, 0xA8, 0xCB, 0xF8, 0x94,
-    0x07, 0x2A, 0x44, 0x0F, 0xE8, 0x65, 0x66, 0x75, 0xFD, 0x3B, 0xD5, 0x6D, 0xBF, 0xDE, 0xD3, 0x83,
-    0xB2, 0x7F, 0x77, 0x4B, 0x8A, 0x91, 0xA7, 0xAD, 0x82, 0xCF, 0xFC, 0x03, 0x9C, 0x60, 0xEE, 0xCA,
-    0xB4, 0x9E, 0x35, 0xA6, 0xA3, 0x1A, 0x88, 0x52, 0x01, 0x4F, 0xFA, 0x4D, 0x45, 0x5C, 0x95, 0x42,
-    0xAE, 0x2D, 0x63, 0x7A, 0x06, 0x0E, 0x54, 0xA8, 0x49, 0x7D, 0x0F, 0xEF, 0x7C, 0x1F, 0xE6, 0xA6,
-    0x85, 0xAD, 0xEB, 0x61, 0x52, 0x2F, 0xEE, 0x9C, 0xDE, 0x81, 0x0A, 0x6B, 0x33, 0x3D, 0x5D, 0xB0,
-    0x40, 0xD1, 0x44, 0xFC, 0x6B, 0xCD, 0x64, 0x29, 0x3E, 0xD9, 0x91, 0x33, 0x25, 0x0D, 0x8B, 0xAD,
-    0xF0, 0x2F, 0xEC, 0xAC, 0x77, 0x7C, 0x00, 0xA0, 0x13, 0xE5, 0x32, 0x6F, 0xC0, 0x53, 0x90, 0x86,
-    0xB7, 0x47, 0xFC, 0x11, 0xF6, 0xA5, 0x62, 0x6F, 0x85, 0x78, 0xD7, 0x69, 0x5B, 0x25, 0x51, 0x0D,
-    0xF1, 0xB6, 0xE2, 0x04, 0x4D, 0x4B, 0xCC, 0x67, 0x7C, 0x5D, 0x36, 0xC5, 0xA6, 0x57, 0x52, 0x8D,
-    0x96, 0x92, 0x2D, 0x6A, 0x13, 0x0B, 0xF6, 0x2E, 0x51, 0xAC, 0xF9, 0xBD, 0x26, 0x57, 0x2C, 0xF8,
-    0x8E, 0x34, 0x9D, 0x10, 0xE8, 0x37, 0x36, 0x1D, 0x23, 0x27, 0x92, 0xC1, 0x1A, 0x72, 0x25, 0x9B,
-    0x64, 0x70, 0xEF, 0x95, 0xD5, 0x25, 0x6F, 0x0F, 0x9B, 0x16, 0x51, 0xEE, 0x6F, 0x00, 0x98, 0x5B,
-    0x44, 0xAA, 0x43, 0x92, 0xCB, 0x45, 0x2B, 0x87, 0xE7, 0x6F, 0xA6, 0x4D, 0x36, 0x94, 0x7D, 0x38,
-    0x1A, 0xC4, 0x5B, 0x3F, 0xE8, 0x03, 0x13, 0x34, 0x1C, 0x5D, 0xF3, 0x64, 0x9F, 0x72, 0x85, 0x9A,
-    0x50, 0xBB, 0xC1, 0x42, 0xF1, 0x26, 0x44, 0x5F, 0xE9, 0x9A, 0xAB, 0x46, 0xFC, 0x13, 0xBF, 0x7E,
-    0x8E, 0x27, 0xD9, 0xA1, 0x2E, 0xBB, 0x67, 0x43, 0x06, 0x56, 0x17, 0xAC, 0x31, 0xF6, 0x1E, 0x72,
-    0xB2, 0x4F, 0x2D, 0x83, 0x7D, 0x4D, 0x11, 0xD0, 0x36, 0x8A, 0x5A, 0x47, 0x51, 0x7B, 0x2C, 0xD6,
-    0x42, 0x2E, 0x36, 0xF2, 0x8C, 0x94, 0xD6, 0x77, 0x72, 0xC0, 0x81, 0xF8, 0x43, 0xF2, 0xD1, 0xB3,
-    0xE2, 0x3C, 0x24, 0xCC, 0xBD, 0x5A, 0x1C, 0x9A, 0x7F, 0xAE, 0x65, 0x74, 0x6F, 0x59, 0x04, 0x5D,
-    0x06, 0x51, 0xAF, 0x28, 0xBA, 0x14, 0xB2, 0xF1, 0x8C, 0x67, 0xE5, 0x00, 0xC2, 0xAE, 0xF5, 0x49,
-    0x04, 0x12, 0xCC, 0xE1, 0xBE, 0xD5, 0x12, 0xE4, 0x75, 0x04, 0x12, 0xBB, 0x9F, 0xF3, 0x61, 0x03,
-    0x61, 0x42, 0x61, 0x2A, 0xDB, 0xA8, 0x8D, 0x86, 0xB8, 0x0E, 0x86, 0xA4, 0xF6, 0xFB, 0xB4, 0xF1,
-    0x0E, 0x99, 0x84, 0x8E, 0x99, 0x2C, 0x47, 0x28, 0xAC, 0xA7, 0x08, 0x98, 0x30, 0x4A, 0x4C, 0xAF,
-    0x89, 0x06, 0x49, 0x26, 0x0F, 0x86, 0x31, 0xC1, 0xB7, 0x00, 0x79, 0x53, 0x56, 0x79, 0x63, 0xDA,
-    0x04, 0x7D, 0x3C, 0x1D, 0x34, 0x9A, 0x3F, 0x5B, 0x8E, 0xDD, 0xD6, 0x3C, 0xBF, 0x69, 0x4F, 0x83,
-    0xBC, 0xE4, 0xF2, 0x57, 0x25, 0xC0, 0x18, 0x33, 0x83, 0x55, 0x96, 0xA7, 0xAB, 0x24, 0xCF, 0xAA,
-    0xAF, 0x28, 0x6E, 0x49, 0x98, 0xCD, 0x35, 0x83, 0x2D, 0x72, 0xA7, 0xBA, 0xC5, 0xAA, 0xE7, 0x24,
-    0xAD, 0x32, 0xF7, 0x64, 0x7A, 0x8F, 0x09, 0xAF, 0x7E, 0x63, 0x6C, 0x89, 0x2E, 0x99, 0x7E, 0xE0,
-    0xE1, 0xC3, 0x77, 0x6C, 0x94, 0x0B, 0x07, 0x60, 0x7A, 0x86, 0x91, 0xFD, 0x1D, 0x08, 0xBF, 0x7F,
-    0x07, 0xE4, 0x7B, 0xB7, 0x67, 0xF2, 0xB2, 0x2E, 0xC8, 0x53, 0x91, 0x03, 0xE6, 0x74, 0x4A, 0xD3,
-    0x9F, 0x88, 0xA7, 0x87, 0xF9, 0x2C, 0x16, 0xD3, 0xF1, 0xF6, 0x3C, 0x96, 0xE7, 0x72, 0x75, 0xAF,
-    0xF3, 0xAE, 0x37, 0xC8, 0xE5, 0xE9, 0x56, 0x61, 0x86, 0xAF, 0x8E, 0xD7, 0xB0, 0x30, 0x9F, 0xFA,
-    0x37, 0xF2, 0x1D, 0x3E, 0x24, 0x50, 0x0E, 0x6E, 0x71, 0x32, 0xCD, 0xF4, 0x0D, 0x8C, 0x9D, 0x9D,
-    0x75, 0x07, 0x82, 0xC1, 0xA2, 0x98, 0x26, 0xAB, 0x93, 0x9E, 0x89, 0xD4, 0x02, 0xDA, 0x90, 0xE6,
-    0x34, 0x51, 0x4C, 0x35, 0x13, 0xE6, 0xC0, 0x85, 0x31, 0x3D, 0xCE, 0x45, 0xB8, 0x59, 0xB4, 0xF6,
-    0xFB, 0x70, 0xB4, 0xF3, 0x5F, 0x2E, 0x3C, 0x00, 0x50, 0xA2, 0xF7, 0xD4, 0x7E, 0x01, 0xB9, 0x8D,
-    0x72, 0xD9, 0x1C, 0x4A, 0x06, 0xFE, 0xFE, 0x12, 0xEF, 0x39, 0x8F, 0x45, 0x4F, 0x3F, 0x18, 0xA5,
-    0xC8, 0x4D, 0xFE, 0x73, 0x04, 0xDF, 0xD7, 0x61, 0x17, 0xFF, 0x5C, 0x43, 0x8F, 0x52, 0x93, 0xCE,
-    0xF4, 0x85, 0x1E, 0x0C, 0xA0, 0xFF, 0xF1, 0xE8, 0x92, 0x56, 0x0B, 0x76, 0x74, 0x97, 0x46, 0x9D,
-    0x36, 0x6B, 0x0F, 0xE3, 0x78, 0x1E, 0xBA, 0x83, 0xE0, 0x42, 0x7E, 0x2A, 0xB2, 0x9C, 0x93, 0x6C,
-    0xED, 0x39, 0xC9, 0x42, 0x39, 0xD5, 0x58, 0x31, 0xE9, 0x4E, 0x9E, 0x93, 0xCC, 0x98, 0xED, 0x02,
-    0x2A, 0xEB, 0x12, 0x07, 0xCC, 0x6C, 0xAE, 0x3C, 0xFF, 0x63, 0x74, 0x93, 0xAC, 0x7F, 0xBC, 0xE7,
-    0x5D, 0x75, 0x00, 0xE3, 0xC3, 0x88, 0x5F, 0x66, 0x11, 0xB5, 0xE7, 0xE9, 0xD6, 0xA7, 0xAF, 0x6A,
-    0xC2, 0xFA, 0x04, 0xA3, 0x61, 0xDA, 0xEE, 0xE9, 0xD2, 0x61, 0x9D, 0xA6, 0xC3, 0xFE, 0x00, 0x8D,
-    0x55, 0xBF, 0x8F, 0x1B, 0x45, 0x14, 0xFE, 0xC6, 0x7B, 0xBE, 0x0D, 0xB7, 0xC1, 0x6B, 0x81, 0x1D,
-    0x85, 0x84, 0xF3, 0x5E, 0x19, 0x4E, 0xB1, 0x37, 0x45, 0x84, 0x02, 0x5A, 0x7B, 0xE6, 0x4F, 0x70,
-    0x61, 0x8B, 0x22, 0xCD, 0x15, 0x54, 0x29, 0xC8, 0x21, 0x1D, 0x92, 0x15, 0xD9, 0xDE, 0xED, 0x69,
-    0x5C, 0x51, 0x21, 0xC5, 0x45, 0x0A, 0x62, 0x01, 0xB9, 0xC2, 0x48, 0x57, 0xD8, 0xDE, 0x95, 0x52,
-    0x44, 0x4A, 0x35, 0x1D, 0xED, 0x02, 0xE9, 0x59, 0xA4, 0x45, 0x72, 0xB1, 0xF6, 0xF0, 0x66, 0xED,
-    0xBB, 0x24, 0x07, 0x91, 0xD8, 0x37, 0x33, 0x3B, 0x3F, 0xDE, 0xBC, 0x79, 0xF3, 0xDE, 0xF7, 0xDE,
-    0x54, 0x05, 0x8F, 0xED, 0xB4, 0x90, 0x61, 0x88, 0x22, 0xEB, 0x1A, 0x2B, 0x3B, 0x75, 0xA2, 0x16,
-    0xCA, 0x40, 0x07, 0x86, 0x82, 0xA5, 0x02, 0xE7, 0x5B, 0x39, 0x60, 0x69, 0x99, 0xA6, 0x04, 0x60,
-    0x66, 0x96, 0x70, 0xD4, 0x33, 0xF0, 0x50, 0xC1, 0xB3, 0x32, 0x00, 0x6D, 0x70, 0x15, 0x51, 0xA9,
-    0x76, 0x85, 0x52, 0x2A, 0x0E, 0xA9, 0x12, 0xE7, 0x59, 0x21, 0x1E, 0xDE, 0x97, 0xAE, 0x0A, 0xAC,
-    0xB5, 0x66, 0x29, 0x82, 0x47, 0xBE, 0xF4, 0xE5, 0x0D, 0x31, 0x30, 0xA5, 0xB2, 0x13, 0x2A, 0x7D,
-    0x33, 0x02, 0x9C, 0x65, 0x6B, 0x7E, 0xD0, 0x42, 0xAB, 0xB0, 0x34, 0xA2, 0x42, 0xB4, 0x3B, 0xE2,
-    0x59, 0xAF, 0x7E, 0xB2, 0xDF, 0xAB, 0xBB, 0xCB, 0xDD, 0x11, 0x6B, 0x77, 0xED, 0xBF, 0x56, 0xCE,
-    0xF3, 0x25, 0x37, 0xE3, 0x99, 0x1D, 0xB4, 0x8B, 0xA8, 0xA0, 0xD2, 0xC2, 0xD2, 0x7E, 0x91, 0x98,
-    0x2A, 0x2A, 0x28, 0x81, 0x2E, 0xE0, 0xE9, 0x0F, 0xE8, 0x37, 0xCF, 0xA9, 0xCA, 0x48, 0xA1, 0x17,
-    0x29, 0xEC, 0xDF, 0x32, 0x18, 0xC9, 0x10, 0x58, 0x3A, 0x02, 0x15, 0x06, 0xF6, 0x04, 0x46, 0xA6,
-    0x4B, 0x61, 0x89, 0x94, 0x25, 0x73, 0x33, 0x26, 0x9D, 0x2D, 0xA5, 0x95, 0xA3, 0x8F, 0xB4, 0x24,
-    0x5D, 0x49, 0x63, 0xD2, 0x5B, 0xDF, 0xB3, 0x6D, 0xC6, 0x0E, 0x3C, 0x0C, 0x10, 0x06, 0x61, 0xE4,
-    0x47, 0x6E, 0x40, 0xAA, 0x0A, 0x1E, 0xF1, 0x98, 0xC7, 0x56, 0x6C, 0x44, 0x56, 0x30, 0xC4, 0x94,
-    0xB6, 0xDD, 0xA4, 0xB9, 0x90, 0x68, 0x48, 0xBC, 0x0D, 0x58, 0x92, 0x8D, 0xFF, 0x9B, 0xAF, 0x2A,
-    0x7C, 0x69, 0x27, 0xC6, 0x12, 0x73, 0xEC, 0xB0, 0x8E, 0xB9, 0xB2, 0x13, 0x97, 0xF6, 0x94, 0xC1,
-    0x22, 0x16, 0xF1, 0xE8, 0x1A, 0xB5, 0xC0, 0x5D, 0x22, 0x1E, 0x7D, 0x26, 0xEE, 0x6A, 0x7D, 0x10,
-    0x2A, 0x32, 0xB0, 0x73, 0x41, 0x7B, 0xDA, 0x80, 0x3C, 0x76, 0x62, 0x43, 0x3A, 0xC1, 0x5C, 0x33,
-    0xB8, 0xBD, 0xD3, 0xD3, 0x41, 0xAD, 0x08, 0x9B, 0xE8, 0xE1, 0x48, 0x25, 0xDD, 0xB6, 0x4A, 0x74,
-    0x7F, 0x8F, 0xC8, 0x46, 0x18, 0x3F, 0x1B, 0xEB, 0x3E, 0xC0, 0xB3, 0x6A, 0x87, 0x7E, 0x89, 0x26,
-    0x96, 0xA8, 0x58, 0x45, 0x87, 0xE7, 0x43, 0xA4, 0x08, 0x13, 0x9E, 0xEC, 0x05, 0x0C, 0xAE, 0xE4,
-    0x09, 0x89, 0x0F, 0x2E, 0xBC, 0xE3, 0x99, 0x11, 0x13, 0x6E, 0xDA, 0xEC, 0x9F, 0xEC, 0x9F, 0xEC,
-    0xB7, 0x66, 0x56, 0x4C, 0x17, 0x23, 0x33, 0x70, 0xBA, 0x68, 0x05, 0x0C, 0xA6, 0xB0, 0x12, 0x82,
-    0xCC, 0x1C, 0x2B, 0x3F, 0xE3, 0xB1, 0x29, 0x1D, 0xB4, 0x08, 0x3F, 0xBE, 0xE0, 0x2B, 0x6B, 0x75,
-    0x4B, 0xBB, 0xA4, 0xC2, 0x55, 0xE6, 0xAB, 0x55, 0x0F, 0xF5, 0x63, 0xBC, 0x7F, 0x80, 0x2B, 0x74,
-    0xE6, 0x38, 0x1E, 0x7F, 0x9D, 0x48, 0x1E, 0x46, 0x3B, 0xB9, 0x27, 0x5D, 0xF2, 0xE4, 0xF3, 0xC4,
-    0x50, 0x11, 0x23, 0x4F, 0x56, 0x41, 0xCE, 0xA4, 0x0E, 0x0D, 0x69, 0x92, 0x23, 0x23, 0x86, 0x73,
-    0x14, 0x45, 0x5B, 0x14, 0xE5, 0x58, 0xA3, 0x0E, 0x7F, 0xC3, 0x51, 0x4C, 0xC0, 0x49, 0x6B, 0x5C,
-    0xCD, 0xE7, 0x61, 0x36, 0x75, 0x92, 0x9C, 0x69, 0x8B, 0x47, 0x9C, 0x0F, 0xF4, 0x68, 0x33, 0x7C,
-    0xB3, 0x5F, 0xED, 0x76, 0x85, 0xEE, 0xEB, 0x3F, 0x0D, 0x6D, 0x2D, 0x65, 0x30, 0x54, 0x24, 0x25,
-    0x05, 0x13, 0xDD, 0x6E, 0x37, 0x54, 0xEB, 0x07, 0x93, 0xA7, 0xB4, 0xDC, 0xED, 0xF8, 0x04, 0xEC,
-    0xD5, 0x83, 0xC9, 0x64, 0xF2, 0x34, 0x17, 0x79, 0x0B, 0x2C, 0xA3, 0x63, 0x11, 0x0A, 0x6B, 0x09,
-    0x1E, 0xA0, 0x89, 0xD7, 0x9F, 0x4D, 0xC2, 0x6C, 0xFA, 0x37, 0xA8, 0x12, 0x2E, 0xD1, 0xA3, 0x9A,
-    0xE6, 0x06, 0x47, 0x81, 0x6C, 0x68, 0xD0, 0xD9, 0x1A, 0xF7, 0x97, 0xD9, 0xFA, 0xFF, 0x8F, 0x6D,
-    0x47, 0x1F, 0xB1, 0xAC, 0x97, 0x4A, 0x83, 0xE9, 0x1D, 0x5C, 0x3D, 0xC1, 0xFE, 0x00, 0x03, 0xB2,
-    0xF2, 0xE1, 0xE4, 0x07, 0x2A, 0x8F, 0x26, 0x3F, 0x91, 0xAD, 0xA9, 0x50, 0x87, 0x86, 0x1A, 0x23,
-    0x8F, 0xA3, 0x6F, 0xFE, 0x96, 0xE3, 0xD3, 0x31, 0x41, 0xAD, 0x2C, 0x7E, 0x89, 0xDD, 0xC8, 0x11,
-    0x43, 0x79, 0x30, 0xDA, 0x69, 0x25, 0x49, 0xBF, 0x61, 0xD7, 0x66, 0x97, 0xAD, 0x70, 0x61, 0xA1,
-    0xAA, 0xE0, 0x04, 0xD8, 0x6D, 0x52, 0xE8, 0x98, 0x99, 0x9D, 0xF0, 0x60, 0xB0, 0x09, 0x95, 0x4B,
-    0x96, 0xAA, 0x60, 0x01, 0x05, 0x17, 0x25, 0x9C, 0xE9, 0xD5, 0x8F, 0xB4, 0x90, 0x00, 0x1E, 0xAF,
-    0x63, 0xD1, 0xF2, 0xB1, 0xF0, 0x7C, 0xDC, 0xEA, 0x7D, 0x02, 0x9D, 0x4F, 0xAA, 0x1A, 0xC2, 0x9A,
-    0x12, 0x4B, 0x5E, 0x42, 0xC7, 0xBB, 0x1D, 0xF3, 0x3A, 0xB0, 0xC3, 0x38, 0x8C, 0x0B, 0x39, 0xE5,
-    0x01, 0x0B, 0x5B, 0xD9, 0x5C, 0xFD, 0xFC, 0x48, 0x65, 0xA7, 0x61, 0x8A, 0x8D, 0xE7, 0x2B, 0x20,
-    0x55, 0x74, 0x19, 0x90, 0x62, 0x25, 0x67, 0x3D, 0xA4, 0x63, 0xCE, 0x1E, 0xA6, 0x14, 0x94, 0xA4,
-    0xA4, 0x9E, 0x0F, 0xCF, 0xBD, 0xF4, 0xF6, 0x1D, 0xFE, 0x3D, 0xC3, 0x76, 0x50, 0xBA, 0xAF, 0x81,
-    0xE4, 0x28, 0x51, 0x2C, 0x6E, 0x37, 0x91, 0xFE, 0x8E, 0xB0, 0xF3, 0x88, 0xF3, 0xF5, 0x3D, 0xE4,
-    0xA6, 0x3D, 0xD6, 0x8B, 0xD4, 0x12, 0x9B, 0x3C, 0xC2, 0xCB, 0x3B, 0x18, 0xE1, 0x8A, 0xF8, 0x80,
-    0xE6, 0xAE, 0xC2, 0xA0, 0xF6, 0x48, 0xC3, 0xF6, 0x88, 0xDA, 0xF1, 0x68, 0xCB, 0x29, 0x81, 0x3B,
-    0xF2, 0x98, 0x4E, 0x2D, 0xCB, 0x63, 0xBD, 0x2A, 0x35, 0x0F, 0x29, 0x79, 0x05, 0x05, 0xBD, 0x4B,
-    0x7C, 0x08, 0x1C, 0xB0, 0x97, 0x77, 0x11, 0x6C, 0x64, 0x6E, 0x76, 0x3D, 0x0A, 0x0E, 0x83, 0x43,
-    0x3A, 0xD1, 0x97, 0x5C, 0x0A, 0xB2, 0xB5, 0x33, 0x32, 0x63, 0x57, 0xE8, 0xE4, 0xB2, 0xD7, 0x9A,
-    0x9E, 0x9E, 0xF1, 0xE2, 0x26, 0x8B, 0x91, 0xCA, 0x14, 0xC3, 0x94, 0xE0, 0x0A, 0xE9, 0x36, 0xDF,
-    0xB1, 0xF4, 0xC2, 0xF7, 0xBE, 0x3C, 0x08, 0x50, 0x2E, 0xC4, 0x0F, 0xC5, 0x9C, 0xA2, 0x99, 0x91,
-    0x21, 0xDF, 0x96, 0x34, 0xC2, 0x68, 0xCE, 0x12, 0xE7, 0xF7, 0xC4, 0xFA, 0x63, 0xB9, 0x30, 0x6F,
-    0x8F, 0x4B, 0xA5, 0xF1, 0xAC, 0x56, 0x6A, 0x64, 0x94, 0x7A, 0xFD, 0x28, 0xA4, 0xC3, 0x6F, 0x08,
-    0x8D, 0xCD, 0xCF, 0x7F, 0xBC, 0xF9, 0xCA, 0x5D, 0x7E, 0xFA, 0x3D, 0xE5, 0xB7, 0xEF, 0xE2, 0xC6,
-    0xE2, 0xEC, 0x9E, 0x77, 0x9B, 0x4A, 0x7D, 0xD1, 0xB3, 0x7E, 0x8D, 0xEF, 0x51, 0x16, 0xF3, 0xE3,
-    0x07, 0x92, 0x32, 0x5B, 0xB0, 0x31, 0x9B, 0x16, 0xCC, 0xE2, 0x96, 0x56, 0x2F, 0xB2, 0x5F, 0x81,
-    0x85, 0x14, 0xE7, 0x4A, 0x11, 0xD8, 0x6F, 0xAA, 0xB5, 0xD8, 0xFA, 0x63, 0x9C, 0x37, 0x3A, 0x08,
-    0x8C, 0xC8, 0xA1, 0x7D, 0xAE, 0x30, 0xD7, 0xDD, 0xFB, 0x2B, 0x80, 0x22, 0x8F, 0xAC, 0xC5, 0x26,
-    0x4F, 0x74, 0x46, 0xA4, 0x97, 0x45, 0x07, 0xE1, 0x28, 0x6F, 0xF2, 0x61, 0xBE, 0x99, 0x4D, 0x48,
-    0xCC, 0x7B, 0xB6, 0x52, 0x23, 0x34, 0x08, 0x38, 0x6A, 0x92, 0xF5, 0x49, 0xB6, 0x4A, 0x4F, 0x81,
-    0x6B, 0x6A, 0xAB, 0x04, 0x76, 0xF5, 0xB2, 0x96, 0xB1, 0x06, 0x89, 0xEE, 0x86, 0x52, 0xA7, 0xF4,
-    0xC2, 0x52, 0x87, 0xE7, 0x1B, 0xF1, 0xCB, 0x34, 0xFA, 0xBE, 0x10, 0x5A, 0xB6, 0xD4, 0x41, 0xAF,
-    0x01, 0x69, 0x6C, 0x96, 0x8A, 0xED, 0x5A, 0x6F, 0xC7, 0xDB, 0x9B, 0xE9, 0xE4, 0xE6, 0x7C, 0x45,
-    0x63, 0xD1, 0x4C, 0xA6, 0xD3, 0x75, 0x9A, 0xA2, 0x57, 0x76, 0x73, 0x45, 0x3C, 0x5C, 0xA7, 0x37,
-    0x73, 0x80, 0x7A, 0x4E, 0x4D, 0x02, 0x1B, 0x6B, 0xD7, 0xFA, 0x5E, 0x4D, 0xD3, 0xED, 0xBA, 0x45,
-    0x37, 0xAE, 0x54, 0xE0, 0x35, 0xE1, 0xD5, 0xB7, 0xA5, 0xDE, 0x84, 0xF3, 0x67, 0x2E, 0x9B, 0x64,
-    0xF5, 0x8E, 0xA6, 0xE4, 0x0B, 0xAF, 0xEC, 0x68, 0x59, 0x33, 0x2D, 0xAD, 0xE8, 0xA1, 0x35, 0xA3,
-    0x07, 0x0E, 0xBD, 0xBC, 0xD0, 0x4E, 0xE7, 0x31, 0xCE, 0x17, 0xD1, 0xA4, 0x67, 0x6E, 0x86, 0x66,
-    0xFD, 0xB5, 0xB8, 0xD0, 0x45, 0xA7, 0xDD, 0xC6, 0x70, 0x41, 0x9B, 0xF2, 0xF9, 0xC6, 0x45, 0x5D,
-    0xB8, 0x8E, 0xE8, 0xB4, 0x87, 0x69, 0xF3, 0x80, 0xE4, 0x10, 0x2D, 0xC4, 0x2E, 0xBD, 0x53, 0x6E,
-    0x7B, 0x03, 0x66, 0x1B, 0x3A, 0xBD, 0x57, 0x8B, 0x68, 0x95, 0x50, 0xBB, 0x0A, 0xFB, 0x3A, 0xAC,
-    0x23, 0x7A, 0x3B, 0x51, 0x90, 0xA8, 0x56, 0xE1, 0xEE, 0xC3, 0xFA, 0x12, 0x46, 0x8C, 0xDD, 0x04,
-    0x1F, 0x7B, 0x98, 0xFB, 0xE2, 0x1F, 0xD5, 0x7D, 0x4D, 0x8C, 0x1D, 0xD7, 0x95, 0xDE, 0xAD, 0x2A,
-    0x36, 0x6B, 0x46, 0x95, 0xB8, 0xB4, 0x90, 0x3C, 0x8E, 0x18, 0xB3, 0xB2, 0xF0, 0xC2, 0x23, 0x99,
-    0xAC, 0x2C, 0x66, 0xC1, 0x31, 0xBA, 0x59, 0x25, 0x19, 0x18, 0x01, 0xF1, 0xC2, 0x4C, 0x20, 0xC2,
-    0x40, 0x04, 0x44, 0x0E, 0x82, 0x59, 0x44, 0x46, 0xD0, 0x5E, 0xC8, 0x00, 0x03, 0x34, 0x55, 0x25,
-    0x09, 0x89, 0x80, 0xCC, 0x62, 0x7A, 0x31, 0x4E, 0x80, 0x64, 0x61, 0x4E, 0x40, 0x04, 0xD2, 0x33,
-    0x82, 0x56, 0x30, 0x34, 0xA6, 0x83, 0x34, 0x55, 0x25, 0x69, 0x21, 0x20, 0x5A, 0xA8, 0x34, 0x9A,
-    0x89, 0x16, 0xB3, 0x50, 0x59, 0xA6, 0xC6, 0x1A, 0x69, 0xC1, 0x92, 0x55, 0xB2, 0xAA, 0xA9, 0x7A,
-    0x75, 0x73, 0xBE, 0xEF, 0xDE, 0x7A, 0x3F, 0xDD, 0xFC, 0x11, 0xA9, 0x16, 0x29, 0x37, 0xF9, 0xCE,
-    0x7D, 0xFD, 0x5E, 0xBD, 0x7A, 0xF7, 0xE7, 0xDC, 0x73, 0xBE, 0xF3, 0x77, 0x5B, 0x29, 0xFC, 0x64,
-    0x95, 0x90, 0xA8, 0x11, 0xE2, 0x75, 0xF8, 0xFD, 0x22, 0xC8, 0x3F, 0x52, 0xE6, 0x27, 0xD1, 0x5A,
-    0x97, 0x31, 0x88, 0xAB, 0xD3, 0xB0, 0x74, 0xB4, 0xF2, 0x41, 0x3C, 0x10, 0x37, 0x17, 0xA2, 0xD4,
-    0x22, 0xD1, 0xFD, 0x48, 0xF6, 0xBC, 0x61, 0xC9, 0x29, 0x90, 0x46, 0x88, 0xD3, 0xB8, 0x72, 0x97,
-    0xE6, 0x01, 0xB9, 0x73, 0x83, 0xEF, 0x68, 0x82, 0x74, 0x5B, 0xA9, 0xF8, 0x8D, 0x29, 0xC8, 0xA0,
-    0x54, 0x98, 0xF7, 0x6A, 0xE1, 0xE7, 0xB6, 0x75, 0x23, 0x13, 0xD2, 0x29, 0xD0, 0x5E, 0x3D, 0xE9,
-    0x0D, 0x4E, 0xAF, 0x76, 0xBC, 0x41, 0x6D, 0xA8, 0x6D, 0xA1, 0xAB, 0xEA, 0x09, 0xA1, 0x27, 0x64,
-    0x9E, 0x06, 0xF4, 0x69, 0xA4, 0x2B, 0x7F, 0x26, 0x54, 0x3E, 0x90, 0x93, 0x36, 0x42, 0x55, 0xDC,
-    0xE1, 0xDD, 0xB0, 0x9F, 0xD3, 0x60, 0x81, 0xDA, 0xD7, 0x3B, 0x5E, 0xD9, 0xA8, 0x75, 0xFD, 0xE7,
-    0xBA, 0x54, 0x85, 0xFE, 0x50, 0xC6, 0xAE, 0x56, 0x1E, 0xC1, 0x62, 0xB4, 0x18, 0x32, 0x96, 0xA5,
-    0x40, 0x87, 0xB9, 0x2A, 0xE9, 0xC2, 0x4C, 0xA4, 0x98, 0x89, 0x5C, 0x3E, 0x1D, 0xE5, 0xD2, 0xFD,
-    0x00, 0xC4, 0x9F, 0x11, 0xA5, 0x3E, 0x0F, 0x79, 0x40, 0xBF, 0x87, 0xEF, 0x98, 0x8E, 0x13, 0x1F,
-    0xC8, 0x6C, 0x48, 0xDF, 0x74, 0xEA, 0x0E, 0x4A, 0x97, 0x41, 0xA7, 0x92, 0x52, 0x58, 0x25, 0xC9,
-    0x93, 0x46, 0xFD, 0xBE, 0x4A, 0xEA, 0x91, 0x7D, 0x0A, 0x92, 0xF7, 0x27, 0xBC, 0x56, 0xC8, 0xBB,
-    0xA7, 0xED, 0x6B, 0x7C, 0x97, 0xD7, 0x25, 0x8D, 0x1D, 0x59, 0x8A, 0xF1, 0x97, 0x9E, 0xCE, 0xA3,
-    0x5C, 0x69, 0x5C, 0x7D, 0x04, 0xDF, 0xA1, 0xEE, 0xB5, 0xDF, 0x58, 0xC8, 0x34, 0x0D, 0xBA, 0x8C,
-    0xE4, 0x7B, 0x92, 0x34, 0x68, 0xB2, 0xD4, 0xAF, 0xB3, 0xDC, 0x4D, 0x71, 0xA3, 0xA4, 0x43, 0xDF,
-    0x72, 0x15, 0x4A, 0xFF, 0x5C, 0x4C, 0x78, 0xA6, 0x6B, 0x79, 0xD2, 0xE2, 0x9D, 0x43, 0x32, 0xB9,
-    0x1B, 0xCA, 0xEB, 0xA7, 0xC2, 0xC5, 0xB2, 0xA4, 0x6D, 0x91, 0x87, 0x4D, 0xB2, 0x5B, 0xE4, 0x01,
-    0xC6, 0xB2, 0x82, 0xCF, 0xB5, 0xB1, 0x6E, 0x3D, 0x19, 0x88, 0x56, 0x37, 0xF5, 0xFF, 0x01, 0x7D,
-    0x29, 0xD1, 0xDD, 0x51, 0xB7, 0x4E, 0x9E, 0x69, 0x93, 0x67, 0xDB, 0xF8, 0xA1, 0x66, 0x5C, 0x88,
-    0xCF, 0x75, 0xC3, 0x50, 0x0F, 0x81, 0xBE, 0x82, 0x49, 0xCA, 0xCA, 0x5B, 0xFC, 0x5F, 0x94, 0xB2,
-    0x24, 0x8E, 0x4E, 0x7D, 0xAD, 0x32, 0xE1, 0xD9, 0x1C, 0x73, 0x82, 0x59, 0x71, 0x65, 0x0D, 0x06,
-    0xE1, 0x97, 0x28, 0xE5, 0x9C, 0x87, 0x60, 0xB2, 0x6B, 0x34, 0xD1, 0xAC, 0xD1, 0xBB, 0xA6, 0x11,
-    0x56, 0x8C, 0xE5, 0xC5, 0xAC, 0x51, 0xC7, 0xA5, 0x91, 0xA5, 0x3A, 0x29, 0x8D, 0xF0, 0xED, 0x9A,
-    0x34, 0xFE, 0xD4, 0x34, 0x83, 0xDA, 0xE1, 0x6F, 0xB2, 0x3B, 0xF0, 0xDE, 0xCF, 0x3A, 0x5E, 0x29,
-    0xEB, 0x90, 0x34, 0x71, 0xA3, 0x6B, 0x7C, 0x7F, 0x99, 0x95, 0xBE, 0x96, 0x7B, 0x1E, 0x1A, 0x27,
-    0xAB, 0x2B, 0xB0, 0x4E, 0xB1, 0x7E, 0x6F, 0x5D, 0x5F, 0x02, 0xAF, 0xA5, 0x9E, 0xDD, 0x8C, 0xDC,
-    0x46, 0x37, 0x6E, 0x4F, 0x7F, 0x5F, 0x3F, 0xC2, 0xAD, 0x2D, 0x3F, 0xB5, 0xB4, 0x93, 0x9F, 0xE9,
-    0xAD, 0xA9, 0x79, 0x5F, 0x6E, 0x66, 0xAE, 0xD3, 0xA5, 0x69, 0x8B, 0xB1, 0xAD, 0xF6, 0xFC, 0x6E,
-    0x5B, 0x9D, 0xE3, 0xFB, 0x07, 0x9F, 0x6B, 0xB1, 0x8E, 0xAD, 0x9E, 0xE8, 0x5E, 0x3A, 0xBD, 0xA9,
-    0xCC, 0xF6, 0xB7, 0xFB, 0xDF, 0x0A, 0x00, 0x2B, 0x01, 0xAC, 0x08, 0x18, 0x65, 0x80, 0xDD, 0xFE,
-    0xF3, 0x06, 0x62, 0xC0, 0xCA, 0x01, 0x36, 0x35, 0x1A, 0x72, 0xBD, 0x5C, 0x02, 0xBE, 0x37, 0x7B,
-    0xFE, 0xFA, 0x8D, 0x66, 0xB3, 0xAE, 0xCF, 0x85, 0x43, 0x2E, 0x5B, 0xA9, 0x0D, 0x35, 0xF6, 0xCF,
-    0x69, 0x6E, 0x7E, 0x0D, 0xEA, 0x71, 0x67, 0xFA, 0xE4, 0xC1, 0x30, 0x07, 0x3D, 0xB4, 0x20, 0x24,
-    0xBB, 0x0C, 0xB2, 0xE1, 0xBD, 0x04, 0x4C, 0x99, 0x06, 0x2D, 0xA6, 0x27, 0x2C, 0x41, 0x63, 0x4E,
-    0xE5, 0x59, 0x50, 0xA7, 0x05, 0xF5, 0x2A, 0x50, 0x79, 0x13, 0x53, 0x5A, 0x93, 0xF2, 0xF5, 0xA8,
-    0x07, 0x0D, 0xA6, 0xBC, 0x46, 0x83, 0xBA, 0x32, 0x20, 0xF9, 0xAC, 0xE6, 0x7D, 0x84, 0x2D, 0x84,
-    0x26, 0x2D, 0x16, 0x50, 0x2E, 0x95, 0xE9, 0x0B, 0x74, 0x2E, 0x93, 0xE7, 0x70, 0xB3, 0xAB, 0x59,
-    0x07, 0x95, 0x36, 0x3D, 0x2A, 0x29, 0x43, 0xCC, 0x7B, 0x9B, 0xF3, 0x7E, 0xB6, 0x91, 0xEE, 0x65,
-    0xF3, 0xC8, 0xC6, 0xF7, 0xB0, 0x76, 0x25, 0x44, 0x8F, 0xCE, 0x67, 0xD4, 0x25, 0x0D, 0x48, 0x23,
-    0xD2, 0x0D, 0x50, 0xA7, 0x01, 0xF5, 0x2A, 0xD0, 0x30, 0x05, 0x5D, 0xE3, 0xF5, 0x1D, 0x69, 0x4D,
-    0x9A, 0x2F, 0xDE, 0x67, 0x46, 0x1F, 0xD0, 0x75, 0x80, 0x69, 0xC1, 0xF7, 0xDA, 0x4E, 0x84, 0xB9,
-    0xCC, 0x89, 0x8A, 0xCB, 0x44, 0x26, 0x31, 0x7E, 0xB7, 0x48, 0x21, 0xEA, 0xB8, 0x94, 0xF7, 0x8E,
-    0x92, 0x56, 0x84, 0x53, 0x2D, 0x33, 0x59, 0xE8, 0x3A, 0x16, 0x9D, 0x03, 0x99, 0xA2, 0x84, 0x63,
-    0x5C, 0x0A, 0x78, 0x99, 0x3E, 0x47, 0xE7, 0xBE, 0x0C, 0x4F, 0x97, 0xA1, 0x7C, 0x20, 0xAB, 0x23,
-    0x8A, 0xB8, 0xE3, 0xD8, 0x4C, 0xDD, 0x2A, 0xEE, 0xDF, 0x6F, 0x63, 0xA1, 0x86, 0x86, 0x92, 0x95,
-    0xEB, 0xC5, 0xB5, 0xC4, 0xAE, 0xC5, 0xA5, 0xFC, 0x96, 0x04, 0xE4, 0x9F, 0x53, 0xE1, 0x16, 0xEC,
-    0x58, 0xD1, 0xAA, 0x51, 0xF4, 0x2B, 0xC7, 0xCE, 0x95, 0x11, 0x34, 0x94, 0x35, 0xEA, 0x16, 0xC4,
-    0xCD, 0xCD, 0x8B, 0x27, 0xF9, 0xB9, 0x04, 0x35, 0x83, 0x9D, 0x10, 0xB3, 0x43, 0x21, 0x3B, 0x14,
-    0xB0, 0xE7, 0x3E, 0xA9, 0x97, 0xCF, 0xBA, 0x68, 0x57, 0xD9, 0x70, 0x00, 0x47, 0xEA, 0x90, 0xBA,
-    0x6F, 0x43, 0xAC, 0x7B, 0xAF, 0x61, 0x60, 0xFE, 0xAB, 0x60, 0x8B, 0xF0, 0x3B, 0x98, 0xE1, 0x90,
-    0x8A, 0xE6, 0xB8, 0x03, 0x7E, 0xC6, 0x02, 0x2A, 0xD9, 0x55, 0x98, 0x94, 0x17, 0x27, 0xB8, 0x05,
-    0x55, 0xA8, 0xF3, 0xF1, 0xE9, 0xF5, 0x46, 0xB9, 0xB5, 0xCC, 0x25, 0xA6, 0x5A, 0xA4, 0x90, 0x7C,
-    0xAB, 0x30, 0xA5, 0xF0, 0x6B, 0xA0, 0x55, 0xB1, 0x2B, 0x3B, 0xA4, 0x12, 0xB9, 0x5E, 0x18, 0xA5,
-    0x0D, 0xA9, 0x45, 0x8E, 0x8F, 0x21, 0x07, 0x42, 0x90, 0x00, 0xC4, 0x4F, 0x17, 0xB5, 0xFE, 0x69,
-    0xCB, 0xE4, 0x8E, 0xDE, 0xD2, 0x86, 0xA1, 0xC1, 0xCF, 0x90, 0x10, 0x49, 0xBD, 0x44, 0xF8, 0x5A,
-    0x21, 0x3C, 0x29, 0x77, 0x94, 0xC9, 0x98, 0x42, 0xE5, 0x6E, 0x1A, 0x82, 0x2F, 0x92, 0x35, 0x30,
-    0x1C, 0x9B, 0xD5, 0x2E, 0xF6, 0xF7, 0x8C, 0xF0, 0xD7, 0x4A, 0x08, 0xFA, 0x22, 0x73, 0x27, 0x64,
-    0xC0, 0x84, 0x16, 0x78, 0x2D, 0xC6, 0x25, 0x61, 0x37, 0x23, 0xFD, 0xF8, 0x2C, 0x6A, 0x71, 0x2B,
-    0x22, 0x10, 0xD9, 0x48, 0xF2, 0xB1, 0xDB, 0xA6, 0xE0, 0x29, 0x4B, 0x4B, 0xC7, 0xE8, 0x8C, 0x30,
-    0x85, 0xE0, 0x09, 0x55, 0xD8, 0xDE, 0x88, 0x1E, 0x25, 0x3D, 0x4E, 0x7A, 0x8C, 0x74, 0x75, 0x81,
-    0x9E, 0x21, 0x6D, 0x49, 0x1B, 0x50, 0x59, 0x44, 0xA1, 0x5E, 0x09, 0x5A, 0xF0, 0x1B, 0x2D, 0x4D,
-    0xB1, 0xFB, 0x76, 0xC8, 0x56, 0xD8, 0x29, 0x5E, 0x79, 0x81, 0xF4, 0x05, 0x74, 0xB4, 0x3C, 0x45,
-    0xC8, 0x73, 0xDB, 0x50, 0x5F, 0xA2, 0xBF, 0xA7, 0x75, 0xA4, 0xAB, 0x44, 0x7F, 0x57, 0x0F, 0xD2,
-    0x7A, 0xBD, 0xAC, 0xAE, 0x07, 0xD1, 0x2F, 0xDC, 0xE0, 0xD5, 0xD8, 0xA8, 0x59, 0x05, 0xF6, 0x0F,
-    0xF3, 0xAC, 0xC2, 0x4E, 0xF7, 0xAB, 0xAC, 0x5A, 0x43, 0x4F, 0x9B, 0xAC, 0x02, 0x97, 0x3B, 0x7D,
-    0xF6, 0x57, 0x9D, 0x95, 0xFF, 0xE4, 0x77, 0xAD, 0x29, 0x4D, 0xC2, 0x3E, 0x7B, 0x53, 0x53, 0x26,
-    0x64, 0x6F, 0x80, 0xD3, 0x13, 0xB9, 0x5E, 0x24, 0xA9, 0xDC, 0x3D, 0xAB, 0xB2, 0x1A, 0xD2, 0x23,
-    0xAB, 0x12, 0xC8, 0x54, 0xC1, 0x37, 0x11, 0x01, 0x61, 0x56, 0x85, 0x53, 0xB0, 0x7A, 0x56, 0x89,
-    0xB0, 0x29, 0xFA, 0xC3, 0xFA, 0x8A, 0x88, 0x36, 0x5D, 0x85, 0xC2, 0x78, 0xEB, 0x06, 0x79, 0x38,
-    0x85, 0x70, 0x62, 0x00, 0x56, 0x11, 0xE5, 0x3B, 0xC8, 0xEE, 0x03, 0x8C, 0x2C, 0x47, 0x3E, 0xB1,
-    0xCB, 0x4C, 0x31, 0x1C, 0x60, 0xD1, 0xF0, 0xB5, 0x21, 0x44, 0xBC, 0x3A, 0x32, 0xE5, 0xBB, 0x90,
-    0x3C, 0x78, 0x11, 0x78, 0x0E, 0x24, 0x21, 0x91, 0xBD, 0x92, 0x27, 0x15, 0x58, 0x6E, 0x10, 0x51,
-    0xE4, 0x82, 0xDB, 0x95, 0x73, 0xEA, 0x4B, 0x22, 0xAC, 0xBD, 0x1A, 0x93, 0x1F, 0x34, 0xA1, 0x0C,
-    0x23, 0xD8, 0x5D, 0xAF, 0x94, 0x81, 0x7F, 0x02, 0xEC, 0x4E, 0x7D, 0x39, 0x94, 0xCA, 0x9D, 0x55,
-    0xBD, 0xC4, 0x7D, 0x25, 0x60, 0x97, 0x7C, 0x20, 0x4A, 0x23, 0xEE, 0xE4, 0xA8, 0xBD, 0x1A, 0x8D,
-    0xF6, 0xD1, 0x98, 0xF4, 0x38, 0xE9, 0x49, 0xD2, 0xB5, 0x05, 0xBA, 0x03, 0x2A, 0x20, 0x48, 0xA8,
-    0xC0, 0x3C, 0xA1, 0xD2, 0x57, 0x50, 0x01, 0x79, 0x43, 0x9E, 0x09, 0xEB, 0xE9, 0xF2, 0x90, 0x9D,
-    0xFF, 0x5A, 0xD8, 0x77, 0x1A, 0x8B, 0xF4, 0xF6, 0xF5, 0x2E, 0x40, 0x79, 0x00, 0xE1, 0xD2, 0x83,
-    0x01, 0x9D, 0x4F, 0x7B, 0x75, 0x54, 0x9A, 0x4F, 0x04, 0x3F, 0x4A, 0xF3, 0x91, 0x56, 0xAB, 0xD2,
-    0xFC, 0x5A, 0xAB, 0x33, 0xD2, 0x7C, 0xA8, 0xD3, 0x56, 0x9A, 0x46, 0x97, 0x0D, 0x9A, 0xE2, 0xA5,
-    0x1A, 0x4D, 0xF6, 0xCB, 0x12, 0x4D, 0xF2, 0x11, 0x9B, 0xF8, 0xD3, 0x1C, 0x4D, 0x24, 0x73, 0x21,
-    0x4D, 0x68, 0x9A, 0x60, 0x60, 0xE3, 0xF7, 0x58, 0x91, 0x46, 0x76, 0xAB, 0x2E, 0x1F, 0xB8, 0xE2,
-    0xB6, 0x5C, 0x13, 0x25, 0x17, 0x4D, 0xA9, 0x38, 0xBB, 0x18, 0x0B, 0xD4, 0x51, 0x71, 0x62, 0xE1,
-    0x1C, 0x6A, 0xD0, 0xEB, 0x52, 0xA3, 0x4D, 0x0C, 0xFD, 0x2C, 0xD7, 0xCF, 0xA9, 0xB0, 0xC4, 0x11,
-    0xE8, 0x4E, 0xF9, 0xDE, 0x7E, 0x66, 0x40, 0x41, 0x83, 0x16, 0x1F, 0xC8, 0xB6, 0x13, 0x90, 0x27,
-    0x9A, 0x5D, 0x6C, 0x28, 0x11, 0x85, 0x62, 0x44, 0x09, 0xA8, 0x96, 0xAD, 0x2F, 0x98, 0x5A, 0xCC,
-    0x23, 0x79, 0x4B, 0x0C, 0x1C, 0x0F, 0xCA, 0xC2, 0x52, 0x77, 0x1F, 0xA5, 0x70, 0x20, 0xA6, 0xE4,
-    0xF5, 0xE6, 0xB3, 0xE6, 0x3E, 0x21, 0xEF, 0xE9, 0xF1, 0x56, 0x4A, 0xFF, 0x1D, 0xB6, 0x78, 0x44,
-    0xA3, 0x4A, 0xDD, 0x63, 0x4D, 0x46, 0x74, 0x09, 0xD4, 0xC3, 0x46, 0xB8, 0x0D, 0x18, 0xA2, 0xA6,
-    0x95, 0x23, 0xD8, 0xA5, 0x4B, 0xF4, 0x40, 0xC5, 0x09, 0x93, 0xED, 0x8F, 0x88, 0xD4, 0x6F, 0xA4,
-    0x79, 0x65, 0xA3, 0xE0, 0x3A, 0x3D, 0x35, 0x1B, 0x84, 0x40, 0xE1, 0x6A, 0x32, 0x9D, 0xA2, 0xEC,
-    0x01, 0xFD, 0xF7, 0x18, 0xE1, 0x70, 0x4B, 0x06, 0x6B, 0xB9, 0x4C, 0x6E, 0xDA, 0x60, 0xC5, 0xCC,
-    0x76, 0x34, 0x16, 0x9E, 0x94, 0x51, 0xF7, 0x1B, 0x10, 0x2A, 0x20, 0xAB, 0x67, 0x40, 0xD4, 0xE7,
-    0x53, 0xD6, 0xA9, 0x55, 0xD6, 0x99, 0xF0, 0xD2, 0x97, 0x01, 0x8A, 0x8A, 0x1D, 0x62, 0x0D, 0x11,
-    0x6A, 0x13, 0xF5, 0xD8, 0xC0, 0xDF, 0x02, 0x02, 0xFE, 0x75, 0xEB, 0x00, 0xB9, 0x3C, 0x14, 0xC2,
-    0x8B, 0xBD, 0xDF, 0xFB, 0xE0, 0x50, 0x5F, 0x60, 0x4E, 0x9A, 0xD5, 0xD8, 0xA2, 0x65, 0x51, 0x49,
-    0x53, 0x94, 0xBA, 0x44, 0x53, 0x2D, 0x37, 0xF6, 0x3D, 0x7B, 0xA5, 0xFD, 0x9C, 0xBD, 0x8B, 0xBD,
-    0xA7, 0xFD, 0x86, 0xF1, 0xFB, 0x54, 0x38, 0x55, 0x0B, 0x7D, 0x61, 0xCF, 0x28, 0x8A, 0x53, 0xEE,
-    0x77, 0xB1, 0x2E, 0x4B, 0x99, 0x24, 0xB9, 0x19, 0xA4, 0x6D, 0x56, 0x07, 0xD0, 0xBD, 0x6D, 0xC4,
-    0xC9, 0x58, 0xE3, 0x64, 0x18, 0x6D, 0x6D, 0x26, 0xC3, 0xE0, 0x57, 0xDE, 0x88, 0xBB, 0xD5, 0xBD,
-    0x8C, 0x19, 0x08, 0x5E, 0x03, 0x53, 0x45, 0xB4, 0x53, 0xD7, 0x1C, 0x5C, 0xD4, 0x71, 0x33, 0x36,
-    0xDC, 0x7A, 0x8D, 0x8A, 0x05, 0x24, 0xEC, 0x8A, 0x32, 0xCE, 0x0B, 0xB1, 0x40, 0xA5, 0xD7, 0x77,
-    0x06, 0xA9, 0x77, 0xDC, 0xDD, 0x5C, 0x31, 0xCF, 0xC8, 0x1C, 0x43, 0x77, 0x48, 0x37, 0x48, 0x57,
-    0x49, 0xEF, 0x11, 0xB8, 0x2C, 0xFF, 0xB7, 0x74, 0x2D, 0x7C, 0x24, 0x02, 0x04, 0x73, 0x3B, 0x40,
-    0x68, 0xDC, 0x80, 0x6A, 0x50, 0x11, 0x9E, 0x22, 0x6D, 0x94, 0x1E, 0x80, 0x1C, 0x13, 0x4D, 0xFC,
-    0xF8, 0xFC, 0x77, 0xA6, 0x73, 0x8B, 0x6F, 0x3F, 0xF5, 0x2D, 0x63, 0x9C, 0xE3, 0x32, 0x09, 0xC6,
-    0xDA, 0xD5, 0xFA, 0x2D, 0x62, 0xDB, 0xF7, 0x0A, 0xFD, 0x9F, 0xF5, 0x90, 0x72, 0x8D, 0x15, 0xE1,
-    0x0F, 0x85, 0x61, 0x7D, 0x87, 0x9F, 0xB8, 0xDA, 0xCA, 0x64, 0x4E, 0xAC, 0xD6, 0x57, 0x8C, 0xE4,
-    0x84, 0x22, 0xF8, 0xAD, 0xE9, 0x7C, 0x3D, 0x76, 0x9E, 0xD6, 0x84, 0x79, 0x62, 0x25, 0x63, 0x96,
-    0xCF, 0x4C, 0xDF, 0x51, 0x56, 0x8E, 0x4F, 0xFC, 0x7D, 0x4F, 0xDC, 0x34, 0xE3, 0xD6, 0x12, 0x2A,
-    0xEB, 0xF7, 0x24, 0x37, 0xDD, 0x4E, 0x00, 0xD6, 0xDA, 0x26, 0x7D, 0x82, 0x54, 0x2D, 0x51, 0x3A,
-    0x9D, 0x02, 0xA2, 0x99, 0xA0, 0xC7, 0x27, 0x02, 0x58, 0x39, 0x42, 0x21, 0xC1, 0x03, 0xA8, 0xE9,
-    0x3D, 0xD4, 0xBC, 0x6E, 0xAE, 0xC1, 0xF5, 0x5B, 0xFC, 0x2C, 0x9D, 0x57, 0x02, 0x6C, 0x70, 0x43,
-    0x99, 0x6E, 0x34, 0x14, 0x86, 0x45, 0x4D, 0xA9, 0x4F, 0x25, 0x71, 0x9D, 0x06, 0x5E, 0x9C, 0x8A,
-    0xDA, 0x03, 0x0D, 0xE4, 0x8F, 0xD1, 0x2A, 0x6C, 0x04, 0x75, 0x1B, 0xBD, 0x73, 0x95, 0xC6, 0xBE,
-    0x87, 0x2B, 0x5D, 0xF3, 0x39, 0x58, 0x7F, 0x87, 0xF5, 0x2E, 0x4C, 0x3F, 0xC1, 0xDF, 0xE8, 0x12,
-    0x1C, 0x58, 0x56, 0x36, 0x5F, 0xCB, 0xCA, 0x50, 0xEC, 0x82, 0x55, 0x5F, 0xC6, 0x35, 0x55, 0xDC,
-    0x9C, 0xA9, 0x69, 0x16, 0x00, 0x5B, 0x2C, 0x1E, 0x34, 0xFC, 0x83, 0xA2, 0x84, 0x8A, 0x54, 0x44,
-    0x63, 0x86, 0x2D, 0x79, 0xC4, 0xE8, 0x07, 0x67, 0x01, 0xC7, 0xE7, 0xC6, 0x6F, 0x97, 0x68, 0x4A,
-    0x32, 0x43, 0x72, 0x5C, 0x42, 0x92, 0x7E, 0x0D, 0x9F, 0xB8, 0x48, 0xC7, 0x97, 0x82, 0x9C, 0xCD,
-    0xA1, 0x10, 0xAF, 0x14, 0xB0, 0xA5, 0xE9, 0x72, 0x5E, 0xF2, 0xB3, 0x77, 0xB2, 0x63, 0x53, 0x0C,
-    0xD3, 0xC7, 0x62, 0x00, 0x6B, 0xB6, 0x1E, 0xFD, 0x6C, 0xA2, 0x09, 0xEC, 0x60, 0xCC, 0x78, 0xE4,
-    0x2A, 0x74, 0x1F, 0x43, 0xC6, 0x58, 0xD0, 0xA9, 0xA4, 0x31, 0xC8, 0x15, 0xAD, 0x5E, 0x68, 0xE3,
-    0x85, 0xD7, 0xC7, 0xD6, 0x5D, 0x6C, 0x6B, 0x73, 0xBF, 0x04, 0xD3, 0x21, 0x9D, 0xE6, 0xFD, 0x93,
-    0x92, 0x86, 0x74, 0x1A, 0x35, 0xD2, 0x71, 0x41, 0x13, 0xFE, 0xB0, 0xD5, 0x92, 0x2D, 0x0A, 0xCB,
-    0xD1, 0xB0, 0x4E, 0x94, 0x23, 0x3C, 0x93, 0x0A, 0xD8, 0x01, 0xCD, 0x6A, 0x38, 0x33, 0x75, 0x2E,
-    0x14, 0xCE, 0x00, 0x50, 0xB5, 0x87, 0x3A, 0x7C, 0x57, 0xC4, 0x38, 0x68, 0x3C, 0x14, 0x0D, 0x4D,
-    0xB5, 0x06, 0x5A, 0x05, 0xD6, 0x55, 0xD8, 0xF3, 0xF5, 0x06, 0xD4, 0xDE, 0xAD, 0x9C, 0x7D, 0xCA,
-    0x78, 0xF3, 0xE2, 0xA9, 0x20, 0xDF, 0x34, 0xA9, 0x05, 0xF9, 0xA6, 0x4E, 0x71, 0x49, 0xE0, 0xAD,
-    0x7C, 0x55, 0x55, 0x94, 0x71, 0x99, 0x88, 0x85, 0x08, 0x75, 0x69, 0x1E, 0x87, 0xB5, 0xAE, 0xE2,
-    0x5D, 0xF0, 0x54, 0x22, 0x5A, 0x4E, 0x1E, 0x39, 0xDA, 0xAC, 0x2A, 0xDE, 0x80, 0x2A, 0xFF, 0x69,
-    0x17, 0x0E, 0xA2, 0xC1, 0x8C, 0xF5, 0x22, 0x00, 0x7A, 0x65, 0x47, 0x40, 0x45, 0x0F, 0x4B, 0x40,
-    0xBA, 0x53, 0x87, 0x82, 0x69, 0xE2, 0x0A, 0x70, 0x5C, 0x24, 0xF8, 0x91, 0x5D, 0xB5, 0x2D, 0xF7,
-    0xFA, 0xCB, 0x26, 0x6A, 0x8B, 0x2A, 0xE8, 0x45, 0xA3, 0xE1, 0x31, 0x95, 0xC7, 0xA0, 0x73, 0x6F,
-    0x28, 0xE4, 0x21, 0x38, 0x7C, 0x9A, 0xF0, 0xE1, 0xF7, 0x51, 0x1D, 0xB6, 0xFE, 0x54, 0x94, 0x99,
-    0xF4, 0x52, 0x39, 0xA9, 0x7A, 0x7C, 0x32, 0x49, 0xB1, 0x8B, 0x3B, 0x91, 0xC7, 0x3E, 0x44, 0xB9,
-    0xB3, 0x4C, 0x28, 0xE1, 0x89, 0xDD, 0xE5, 0x12, 0xFB, 0x9A, 0xCC, 0xA1, 0x90, 0xA2, 0xB4, 0xCF,
-    0x84, 0x85, 0xD6, 0x61, 0xCE, 0x52, 0x22, 0xC8, 0xFD, 0xCE, 0xC9, 0x93, 0xC6, 0x9F, 0x0A, 0xE6,
-    0x9E, 0x2A, 0x3C, 0x5E, 0x90, 0xC7, 0x8F, 0x20, 0xF3, 0xAF, 0xF7, 0x80, 0x1E, 0xC8, 0x84, 0xA3,
-    0xEE, 0x9A, 0x4C, 0x26, 0x9B, 0x01, 0xFD, 0xA3, 0x3B, 0xD0, 0x10, 0x67, 0xA0, 0xB5, 0xE6, 0xE4,
-    0xC2, 0x8C, 0x34, 0x23, 0x71, 0x40, 0x5C, 0x98, 0xE3, 0x02, 0xC2, 0x44, 0x2A, 0x80, 0xC0, 0xD4,
-    0xA9, 0xE9, 0x0A, 0x16, 0x1D, 0x1D, 0xD4, 0x70, 0x9D, 0xD6, 0x30, 0xA2, 0x6A, 0x28, 0x74, 0x43,
-    0x0C, 0x43, 0xAF, 0x5F, 0xC2, 0x02, 0xAB, 0xA8, 0x4E, 0xCA, 0x44, 0x96, 0x52, 0xF6, 0x52, 0x53,
-    0x94, 0x61, 0xAB, 0xCB, 0xA8, 0x83, 0xF2, 0xD4, 0xEF, 0x4F, 0xCE, 0x83, 0x9D, 0x80, 0x84, 0xB2,
-    0x92, 0xC0, 0xEF, 0x5C, 0xD4, 0xB9, 0x62, 0xD8, 0x09, 0x48, 0x2D, 0xE4, 0xDE, 0x98, 0xC1, 0xE7,
-    0xEF, 0x9F, 0xFC, 0xA7, 0x49, 0x9E, 0x89, 0x3D, 0xF1, 0xA7, 0x82, 0x57, 0xDA, 0x60, 0xEA, 0xCA,
-    0xF7, 0x75, 0x7E, 0x0F, 0xC7, 0xC0, 0x59, 0xBF, 0x87, 0x14, 0x8D, 0xFC, 0x1E, 0xEE, 0xC4, 0xF0,
-    0xD5, 0xFE, 0x49, 0x60, 0x06, 0x72, 0x3D, 0xB5, 0x07, 0xEE, 0xFD, 0x6A, 0x4F, 0xC7, 0xD6, 0xB3,
-    0x7D, 0x02, 0x36, 0x94, 0x25, 0x6A, 0xB1, 0x16, 0xBD, 0xA8, 0x8F, 0xB0, 0x0F, 0x7A, 0x98, 0xF9,
-    0x82, 0x19, 0x1E, 0xD2, 0x60, 0x11, 0xE1, 0x90, 0x66, 0xE4, 0xAA, 0xA4, 0x2C, 0xC4, 0x2C, 0x4F,
-    0xAA, 0x88, 0x1C, 0x85, 0xDE, 0xC9, 0x4D, 0x33, 0x19, 0x65, 0x06, 0x5C, 0x62, 0x7A, 0xBB, 0x22,
-    0xCC, 0x9A, 0xE0, 0x21, 0xD7, 0xC5, 0xEF, 0xEA, 0x59, 0xB4, 0xE3, 0xF1, 0xC9, 0xD3, 0x93, 0xE7,
-    0x32, 0xFD, 0xAA, 0x9E, 0xFA, 0x80, 0xC1, 0xE3, 0x6A, 0x82, 0xB8, 0xF8, 0x35, 0x00, 0x89, 0xF1,
-    0xEB, 0xB6, 0x10, 0x41, 0x04, 0x80, 0xB7, 0x42, 0x86, 0xF9, 0x75, 0x42, 0xD6, 0xF5, 0xD3, 0x80,
-    0xB7, 0xAF, 0x8E, 0xE1, 0xA0, 0x93, 0x0A, 0xBE, 0x71, 0xB8, 0xC4, 0xB3, 0xFF, 0xD2, 0x63, 0x98,
-    0x98, 0xE4, 0x47, 0xAC, 0xE8, 0x38, 0xE8, 0xAF, 0x7C, 0x7C, 0xF2, 0x1F, 0x27, 0x9B, 0x99, 0x7E,
-    0x4D, 0x57, 0xFE, 0xE0, 0x4C, 0xC1, 0x9A, 0xB2, 0x05, 0xA7, 0x82, 0x73, 0xBD, 0xA9, 0xC0, 0x5C,
-    0x61, 0x76, 0x7A, 0x5B, 0x18, 0x74, 0xC3, 0x6B, 0x30, 0x8A, 0xA6, 0x31, 0x8C, 0x20, 0xA0, 0x75,
-    0xF4, 0x41, 0x78, 0x1B, 0x8C, 0x9B, 0xEB, 0x3A, 0xC3, 0x2E, 0x3E, 0x0C, 0xC6, 0xF3, 0xC9, 0x78,
-    0x67, 0xE5, 0x5D, 0xB5, 0x0A, 0xAE, 0x9C, 0x93, 0x8D, 0x19, 0x39, 0x03, 0xB2, 0x0D, 0x42, 0xC9,
-    0x07, 0x0E, 0x7F, 0x14, 0x44, 0x40, 0xD3, 0x14, 0xF2, 0x40, 0x6F, 0x66, 0x82, 0x07, 0xEA, 0x43,
-    0x66, 0xD0, 0xA9, 0xBA, 0x7F, 0x22, 0x8C, 0x8D, 0x00, 0x5E, 0xEA, 0x8B, 0xB4, 0x66, 0x00, 0xB0,
-    0x86, 0x07, 0xD4, 0xBB, 0xDC, 0xC8, 0x7F, 0xE5, 0xBD, 0xDE, 0xF9, 0x3F, 0x6D, 0xE0, 0x07, 0x0D,
-    0x45, 0xEE, 0x7A, 0xAF, 0x4C, 0xBF, 0xC2, 0x46, 0x1F, 0x43, 0xF3, 0x92, 0xDE, 0x40, 0x53, 0x0A,
-    0x66, 0x45, 0x93, 0x35, 0x6C, 0x92, 0x9A, 0x4D, 0x0C, 0xD9, 0xB3, 0xDE, 0x85, 0x4F, 0x09, 0x23,
-    0x66, 0x7D, 0xF8, 0x90, 0xF0, 0x04, 0x26, 0x85, 0x93, 0xDC, 0xCF, 0x26, 0x39, 0xDF, 0x4B, 0x8C,
-    0xEB, 0x50, 0xEB, 0xFC, 0xAA, 0xEF, 0x62, 0x08, 0x98, 0xE4, 0xF7, 0x78, 0x17, 0xB5, 0xBE, 0xCB,
-    0x59, 0x0C, 0xE5, 0x8B, 0x45, 0x7E, 0x75, 0x99, 0x48, 0x10, 0xAC, 0x04, 0x24, 0xCB, 0xE2, 0x03,
-    0xAF, 0xE1, 0xBD, 0xA4, 0x0C, 0xFA, 0xB8, 0x0E, 0x9B, 0x40, 0x24, 0xDB, 0x6C, 0x7F, 0xC8, 0xC4,
-    0x3E, 0x47, 0x23, 0xC8, 0xB7, 0x92, 0x43, 0xE0, 0xF7, 0xCD, 0x92, 0x7C, 0x5D, 0x3F, 0xAB, 0x2F,
-    0x61, 0xB9, 0xFB, 0xC7, 0xCF, 0xC7, 0x97, 0x54, 0xB1, 0x2B, 0x02, 0x27, 0xD0, 0xFF, 0x8F, 0x5E,
-    0x50, 0x72, 0x49, 0x52, 0xD1, 0xBE, 0x05, 0x81, 0x40, 0x20, 0x89, 0xED, 0x33, 0xBE, 0xC1, 0x4B,
-    0x44, 0xA7, 0x82, 0xAF, 0x28, 0x1D, 0x45, 0x94, 0xF5, 0x99, 0x08, 0xB5, 0xDE, 0xB1, 0xD8, 0x78,
-    0x4E, 0x88, 0x4D, 0x09, 0x4D, 0x0B, 0xDA, 0x00, 0x32, 0x0D, 0xC2, 0x1A, 0x39, 0x26, 0x41, 0x36,
-    0x5C, 0x25, 0x62, 0x42, 0x36, 0xDF, 0x0A, 0xB5, 0xE8, 0xD2, 0xA3, 0x34, 0xA2, 0x42, 0x98, 0xAD,
-    0x8C, 0x5B, 0x1F, 0x5E, 0xB9, 0xDC, 0x21, 0x16, 0xE6, 0x34, 0x3C, 0x2F, 0xB3, 0x30, 0x9C, 0x8D,
-    0xDA, 0xE3, 0x4F, 0x84, 0xED, 0x57, 0x5E, 0x08, 0xDB, 0xF0, 0x07, 0x61, 0xBB, 0x62, 0x5C, 0xA7,
-    0xD7, 0x7E, 0xC8, 0x34, 0xC2, 0xDB, 0x90, 0x4F, 0x26, 0x4F, 0x4D, 0x36, 0xB5, 0x7E, 0x59, 0xD7,
-    0x91, 0x8C, 0x49, 0x31, 0xE4, 0x26, 0x03, 0xA3, 0x15, 0xB9, 0x0D, 0x35, 0x0E, 0x6D, 0xF4, 0x14,
-    0x14, 0xD3, 0xCB, 0x50, 0x30, 0x6F, 0x4A, 0x37, 0xE2, 0x4F, 0xE8, 0xDB, 0x23, 0xEA, 0x1A, 0x43,
-    0x51, 0x1C, 0x9E, 0x43, 0x40, 0x46, 0x03, 0x8E, 0x46, 0x1F, 0xF6, 0x69, 0x04, 0x0F, 0x1A, 0x06,
-    0x61, 0xAE, 0xED, 0x17, 0x83, 0xCA, 0x10, 0x5D, 0x84, 0x0D, 0x87, 0x8D, 0x2D, 0x94, 0x5D, 0x9D,
-    0x1E, 0x11, 0x48, 0xCC, 0x20, 0x63, 0xA3, 0xC2, 0x2E, 0x7B, 0x75, 0xAA, 0xE2, 0x3A, 0x2B, 0xA1,
-    0xA9, 0x33, 0x99, 0x2D, 0xC1, 0x4D, 0x22, 0x62, 0x75, 0x9E, 0x51, 0xD9, 0x09, 0xAD, 0x17, 0x29,
-    0xDF, 0x95, 0x79, 0xC5, 0xBF, 0x04, 0x9F, 0x4A, 0xC3, 0x36, 0x7B, 0x19, 0xD6, 0x5D, 0x71, 0xD9,
-    0x18, 0x77, 0xF9, 0x2C, 0x86, 0xB0, 0xFF, 0xDB, 0x0B, 0xD3, 0xB7, 0x8E, 0xFD, 0x94, 0xE9, 0xBE,
-    0x7F, 0xF2, 0xDF, 0x27, 0xE7, 0x12, 0xFD, 0x91, 0xA8, 0x21, 0xB9, 0x3D, 0xF4, 0xF3, 0x0E, 0xC0,
-    0x1F, 0xBC, 0x59, 0x1F, 0x55, 0xD6, 0xE7, 0x49, 0xBB, 0xCD, 0xC3, 0xE4, 0x30, 0x88, 0x76, 0x1C,
-    0xDA, 0x7C, 0x27, 0xA4, 0x3A, 0x11, 0xDB, 0xA7, 0x81, 0x6C, 0xD8, 0x3D, 0xA2, 0x2F, 0x15, 0x82,
-    0x31, 0x3B, 0xBB, 0xAD, 0x5E, 0xC3, 0xB6, 0x72, 0x6E, 0x95, 0x85, 0xA1, 0x24, 0x75, 0x6F, 0x43,
-    0x87, 0x76, 0x09, 0x76, 0x66, 0xE6, 0x17, 0xC9, 0xB7, 0xAC, 0xA4, 0xFC, 0x67, 0x93, 0xF3, 0x85,
-    0x28, 0x93, 0x16, 0x61, 0x80, 0x1C, 0x38, 0x58, 0xED, 0x21, 0x3E, 0x15, 0xB1, 0xFE, 0x6F, 0x5A,
-    0x19, 0x04, 0x75, 0xDF, 0x4F, 0xF6, 0x62, 0x4C, 0x2E, 0x7A, 0x0D, 0x21, 0xDC, 0x3E, 0x2E, 0xEA,
-    0xE9, 0x7F, 0xA0, 0xFF, 0xAF, 0xEB, 0x5F, 0x61, 0x04, 0x02, 0x7E, 0x20, 0x1A, 0x80, 0xD5, 0xF2,
-    0x03, 0x69, 0xCA, 0x75, 0x1A, 0x12, 0xEF, 0x65, 0x6C, 0xFA, 0x2F, 0xFC, 0xFB, 0x72, 0xF3, 0x7D,
-    0xBD, 0xF9, 0x3E, 0xA3, 0x7C, 0x1C, 0xAB, 0x83, 0xD6, 0x96, 0x9A, 0x63, 0xA6, 0xF9, 0xBA, 0x69,
-    0x0E, 0x8D, 0x60, 0x27, 0x55, 0x67, 0x11, 0xB8, 0x7A, 0x02, 0x59, 0x2D, 0x2F, 0x80, 0xFC, 0x80,
-    0xF9, 0x2D, 0xD1, 0x95, 0xF3, 0x54, 0xCE, 0xA5, 0x8A, 0x10, 0xE0, 0x8E, 0x1A, 0x3A, 0xE2, 0xC2,
-    0x4E, 0x48, 0xD0, 0x99, 0x67, 0xC0, 0x7E, 0x62, 0xD3, 0x6B, 0x91, 0x24, 0x22, 0x80, 0x1E, 0x9F,
-    0x6C, 0xAA, 0x89, 0xA8, 0x7E, 0xF8, 0x81, 0x45, 0xF5, 0x23, 0x2F, 0xA5, 0x27, 0x9A, 0x41, 0xF2,
-    0xC6, 0x72, 0xA3, 0x9F, 0x4F, 0xD9, 0xC8, 0xA2, 0xE2, 0xC5, 0x23, 0x53, 0x36, 0xAE, 0x0E, 0x0D,
-    0xAA, 0x5A, 0x6C, 0xEC, 0x8B, 0xFE, 0x10, 0x02, 0x6C, 0xEB, 0x6E, 0x7D, 0x90, 0x6F, 0xD0, 0xB2,
-    0xF7, 0x4B, 0x7C, 0x1F, 0x93, 0x1A, 0x60, 0x9C, 0x5B, 0x3B, 0x7A, 0x81, 0xC8, 0x77, 0xF0, 0x1B,
-    0x78, 0x7F, 0xDE, 0x68, 0x09, 0xCA, 0xF1, 0x57, 0xF9, 0xE0, 0xBA, 0x4D, 0x61, 0x11, 0x2B, 0x44,
-    0x70, 0x60, 0xA8, 0x11, 0x23, 0x28, 0x72, 0x03, 0x25, 0xE2, 0x5A, 0x31, 0xE4, 0x2F, 0xF3, 0x71,
-    0xBF, 0xA0, 0xDF, 0x4C, 0x9B, 0xE7, 0xF2, 0xDA, 0xEF, 0x12, 0x4A, 0x88, 0xFC, 0x13, 0x43, 0x31,
-    0xFE, 0x3B, 0x6D, 0x1C, 0x97, 0xF7, 0x82, 0x5B, 0xF3, 0x23, 0x03, 0x7A, 0x55, 0xCA, 0xAC, 0x48,
-    0xBF, 0xBC, 0x3E, 0x40, 0x07, 0x82, 0x0E, 0x80, 0x6C, 0x1A, 0x36, 0x2E, 0x34, 0x6D, 0xC4, 0x88,
-    0xCA, 0x14, 0x40, 0x1F, 0x3D, 0x5C, 0x6C, 0xEC, 0x8B, 0xE3, 0x25, 0xF6, 0x03, 0x21, 0x74, 0xAB,
-    0x68, 0xE8, 0xDE, 0xC7, 0x1C, 0x3C, 0xA5, 0xD7, 0xD1, 0x17, 0xD1, 0xAD, 0x46, 0x22, 0x01, 0x17,
-    0xDF, 0x27, 0x13, 0x0F, 0x59, 0x53, 0x06, 0x53, 0x78, 0x38, 0x5B, 0x21, 0x51, 0x33, 0x12, 0xFE,
-    0xCA, 0x37, 0x5C, 0x6E, 0x37, 0x7D, 0x19, 0x61, 0x1F, 0xA6, 0xD7, 0x08, 0x11, 0x4C, 0x06, 0x9F,
-    0xA8, 0x90, 0xA2, 0x01, 0x00, 0x48, 0x0B, 0x5D, 0x39, 0x8F, 0x58, 0x01, 0xA9, 0x19, 0xF6, 0x95,
-    0x19, 0xAE, 0xED, 0x17, 0x1D, 0x0C, 0x4A, 0xF4, 0xEA, 0x93, 0x22, 0x55, 0x0A, 0x79, 0x64, 0xCA,
-    0xAD, 0x8E, 0xCD, 0x05, 0xEB, 0x01, 0xDC, 0xDB, 0x98, 0xEF, 0x60, 0x81, 0x68, 0xC6, 0x0C, 0x0F,
-    0xE8, 0x09, 0xAD, 0xF3, 0x65, 0x2E, 0x41, 0xE2, 0xD1, 0x54, 0x43, 0xAC, 0xBE, 0xC5, 0x0C, 0x0B,
-    0xE8, 0x6E, 0x43, 0x8A, 0x7C, 0x11, 0x91, 0x5D, 0x85, 0x00, 0x87, 0x09, 0xB6, 0x11, 0x41, 0x0D,
-    0x6C, 0x06, 0xA1, 0x9B, 0xCF, 0x0C, 0xCC, 0xD1, 0xDC, 0x25, 0x57, 0x26, 0xD0, 0x2B, 0xF7, 0xA7,
-    0x36, 0x2F, 0x01, 0x7E, 0xED, 0xA9, 0xC9, 0x48, 0x80, 0x5F, 0xE1, 0xD0, 0x08, 0x06, 0x3F, 0x9F,
-    0x95, 0xB0, 0x5F, 0x21, 0x87, 0x39, 0x3A, 0x45, 0x25, 0xFC, 0xFE, 0x26, 0xDD, 0x7E, 0xBA, 0xBC,
-    0xBE, 0x42, 0x56, 0x85, 0x9D, 0x79, 0x41, 0xD1, 0x71, 0x1E, 0x09, 0x9E, 0xFE, 0x5D, 0xF6, 0x3D,
-    0x66, 0x06, 0x11, 0x39, 0x07, 0xBF, 0x20, 0xB8, 0x52, 0x1E, 0x15, 0x96, 0x38, 0x89, 0x2B, 0x55,
-    0x9C, 0xC7, 0xEF, 0xCA, 0x2A, 0x42, 0xD7, 0xAC, 0x90, 0x41, 0x84, 0xCD, 0x05, 0x2D, 0xC8, 0x7F,
-    0xE7, 0xFC, 0x88, 0x74, 0x9F, 0xC3, 0x62, 0xF8, 0x53, 0x7A, 0xC7, 0xAE, 0xFB, 0x7F, 0x5D, 0xB0,
-    0xA2, 0x6E, 0x0E, 0x39, 0x69, 0xF2, 0xBD, 0x2A, 0xFB, 0x69, 0x9D, 0x7D, 0xAF, 0xBE, 0xEF, 0x70,
-    0x7E, 0x6B, 0x37, 0x81, 0x27, 0x9F, 0x31, 0x06, 0x88, 0xFE, 0x7F, 0x6B, 0x7B, 0x72, 0xDF, 0x44,
-    0xC4, 0x19, 0x5F, 0xB9, 0x99, 0xFF, 0x0E, 0xBD, 0x87, 0xF2, 0xD5, 0x19, 0xFC, 0x0A, 0x8A, 0xC0,
-    0x98, 0x11, 0xCB, 0x0A, 0xF6, 0x0C, 0x18, 0x69, 0xD5, 0xEF, 0xF7, 0xD0, 0x0D, 0x7F, 0x78, 0x1E,
-    0x14, 0xBA, 0xFF, 0x8C, 0x98, 0x30, 0xBD, 0xDA, 0x16, 0x03, 0x68, 0x50, 0xAD, 0xDF, 0xBB, 0x83,
-    0x43, 0x87, 0xED, 0xA3, 0x0D, 0x5E, 0xD1, 0x35, 0x76, 0x1F, 0x30, 0xA6, 0x6E, 0x33, 0x38, 0x91,
-    0xF2, 0x43, 0x96, 0x23, 0x44, 0xC5, 0x82, 0x63, 0x5F, 0xC3, 0x7E, 0xA5, 0x9A, 0xE5, 0x92, 0x83,
-    0xB7, 0xF6, 0x34, 0xC3, 0x69, 0xFD, 0x13, 0x13, 0x4A, 0x85, 0x49, 0x3A, 0x4C, 0xF4, 0xCF, 0x8C,
-    0x51, 0x9A, 0x1A, 0x8B, 0x34, 0xCD, 0xAE, 0xD6, 0x18, 0x04, 0x29, 0x4B, 0x8A, 0x6F, 0x40, 0x8A,
-    0xD1, 0x6C, 0xCF, 0x1C, 0x99, 0xED, 0x8F, 0x1F, 0x5E, 0x7D, 0xCF, 0xB4, 0xF3, 0x3D, 0x03, 0xD4,
-    0x80, 0xD4, 0x20, 0x8B, 0x63, 0x3F, 0x0B, 0x91, 0xE5, 0x01, 0x70, 0x6D, 0xC0, 0x31, 0x10, 0x32,
-    0xCC, 0xE0, 0xA1, 0xF9, 0xAE, 0x32, 0x6C, 0x92, 0x4E, 0xCD, 0xE5, 0x8C, 0x3A, 0x68, 0xA3, 0xC6,
-    0x64, 0xAB, 0xD0, 0x49, 0x1F, 0x12, 0xE9, 0x11, 0x75, 0x9C, 0x55, 0x0B, 0x6E, 0x9D, 0x2F, 0xC6,
-    0x14, 0x3C, 0x8B, 0x58, 0xE6, 0x8B, 0x30, 0x84, 0x8B, 0x87, 0xBB, 0xBD, 0xA6, 0xE0, 0x9D, 0x82,
-    0xB2, 0x07, 0x02, 0xE3, 0x08, 0x3E, 0x2E, 0x19, 0x18, 0x47, 0xF8, 0xA8, 0xA6, 0x33, 0x24, 0x77,
-    0x06, 0x04, 0xC9, 0x5F, 0xEA, 0xEE, 0xB9, 0x80, 0x17, 0x75, 0x98, 0xD4, 0xB2, 0x98, 0x19, 0x2D,
-    0x13, 0xE1, 0x1F, 0x8D, 0xAC, 0x99, 0x42, 0xC4, 0x2F, 0x10, 0x41, 0x22, 0xF2, 0x28, 0x97, 0xD5,
-    0x43, 0xEC, 0xA8, 0x0C, 0xD8, 0x16, 0x15, 0x32, 0xC2, 0x52, 0xD8, 0x2C, 0x9A, 0x2D, 0x34, 0x63,
-    0xAC, 0x98, 0x23, 0x92, 0x26, 0x30, 0x0A, 0x64, 0x05, 0xD6, 0xC0, 0x48, 0xB2, 0x36, 0x1B, 0x70,
-    0x8E, 0x86, 0x45, 0x29, 0x93, 0xEC, 0xF7, 0xC7, 0x93, 0x37, 0x90, 0x4F, 0x36, 0x5D, 0x4D, 0x7E,
-    0x89, 0xF4, 0xB2, 0x61, 0x27, 0xFE, 0x55, 0x09, 0x44, 0x8E, 0x88, 0x07, 0xD3, 0x6E, 0x42, 0x6D,
-    0xA2, 0x3B, 0x26, 0x3A, 0xA2, 0x4B, 0xF2, 0xA2, 0xF4, 0x25, 0x80, 0x8B, 0xAB, 0x76, 0x9F, 0x53,
-    0x91, 0x2A, 0x3A, 0x61, 0x92, 0x24, 0x7F, 0x74, 0xEA, 0x0C, 0x22, 0xF4, 0xE8, 0x14, 0x64, 0x6A,
-    0x45, 0x81, 0xFC, 0x1E, 0xD9, 0x4E, 0xB9, 0x88, 0x71, 0x20, 0x79, 0xE1, 0x47, 0xD1, 0x57, 0x65,
-    0x08, 0xF6, 0x8A, 0xEB, 0xE3, 0x0A, 0x60, 0xBF, 0x59, 0x05, 0x9F, 0xE9, 0x46, 0xE6, 0x21, 0xFC,
-    0xF5, 0x5B, 0x2D, 0x6E, 0xFA, 0xE9, 0x33, 0x43, 0x05, 0x27, 0x9A, 0x07, 0x51, 0xEC, 0xF5, 0x26,
-    0xF9, 0xA0, 0xC3, 0xAA, 0x91, 0x87, 0xC7, 0x40, 0x7D, 0xC4, 0x8E, 0xC0, 0xE4, 0xC1, 0x06, 0x1C,
-    0x18, 0xA2, 0x13, 0xBA, 0x1D, 0x22, 0x28, 0x73, 0x41, 0x4C, 0xA5, 0xF1, 0x5D, 0x15, 0x5E, 0xF9,
-    0x09, 0x61, 0x3E, 0x38, 0x2A, 0xEC, 0xE2, 0x1E, 0xAF, 0x13, 0x79, 0x21, 0xAA, 0x22, 0xD4, 0xB5,
-    0x34, 0x9D, 0xBD, 0x02, 0x1A, 0x01, 0x10, 0x88, 0xBE, 0x04, 0x38, 0x32, 0xD9, 0x8F, 0x1C, 0xF8,
-    0xB2, 0xCE, 0xBC, 0x1A, 0x61, 0xBE, 0xEA, 0x0F, 0x21, 0xDC, 0xAE, 0x7A, 0x89, 0xD6, 0xE7, 0x79,
-    0x43, 0xC2, 0x2B, 0xF2, 0x47, 0x39, 0x23, 0xB9, 0x6F, 0x5C, 0x63, 0x5B, 0xC8, 0x44, 0xD2, 0xF5,
-    0x82, 0x13, 0xB5, 0x25, 0x7A, 0x8A, 0x45, 0x0C, 0xE1, 0xF6, 0xEE, 0x3C, 0x39, 0x91, 0xF1, 0x48,
-    0x69, 0x19, 0x92, 0xA4, 0x17, 0x58, 0xFD, 0xBE, 0x75, 0xAE, 0x52, 0xC5, 0x66, 0xB6, 0xA5, 0x02,
-    0x66, 0x6A, 0xCE, 0x30, 0x26, 0x3D, 0x2A, 0x9B, 0x0A, 0xB0, 0xF8, 0xBE, 0x31, 0x98, 0xF0, 0xB9,
-    0xDA, 0xB4, 0x89, 0x49, 0xBF, 0x62, 0xDA, 0x16, 0x93, 0xA1, 0xE0, 0x34, 0x73, 0x19, 0x8D, 0x8A,
-    0xF2, 0x07, 0xA4, 0x3F, 0xB8, 0x11, 0x9C, 0xBC, 0x36, 0x3C, 0x3C, 0x4F, 0xBB, 0x05, 0xCE, 0x73,
-    0x21, 0x55, 0xAA, 0x58, 0x4F, 0x03, 0xD9, 0xFC, 0x4F, 0x69, 0x84, 0xD4, 0x95, 0xE6, 0x9A, 0x0A,
-    0x50, 0x93, 0x21, 0x9C, 0x22, 0x35, 0x92, 0x39, 0xB5, 0xD4, 0xBC, 0x62, 0x29, 0xD6, 0xC6, 0x83,
-    0x5B, 0xDF, 0xF7, 0xE9, 0x2A, 0x59, 0x87, 0x4B, 0x6B, 0x2A, 0xE8, 0xCB, 0x44, 0xC1, 0x19, 0x8D,
-    0x26, 0x12, 0x37, 0x20, 0x02, 0x69, 0xAB, 0xF2, 0xF3, 0x7F, 0xB8, 0x81, 0x3F, 0xC2, 0x7C, 0x23,
-    0x29, 0x40, 0x6E, 0xF1, 0x06, 0x69, 0xC9, 0x2D, 0x4E, 0xBD, 0x1F, 0x52, 0x39, 0x45, 0x9C, 0xE5,
-    0xB5, 0x0C, 0x00, 0x76, 0x35, 0x03, 0xBB, 0x6C, 0x67, 0x32, 0x42, 0xD5, 0x66, 0x3E, 0xEC, 0xBA,
-    0x0C, 0x01, 0xAB, 0x3A, 0xC3, 0x70, 0xAB, 0x4C, 0x3A, 0x11, 0x94, 0x19, 0xE2, 0x8E, 0xF2, 0xAE,
-    0xC0, 0xAC, 0x2E, 0x0B, 0x90, 0x1A, 0xF4, 0xBC, 0xB2, 0x96, 0xA1, 0x4F, 0xCB, 0x10, 0xF7, 0x8E,
-    0x30, 0xF9, 0xC7, 0x78, 0x4F, 0xDC, 0xB2, 0x20, 0x9E, 0xC4, 0xB5, 0xBF, 0xFA, 0x48, 0xEE, 0xF7,
-    0xEA, 0x87, 0xA2, 0x2A, 0x5F, 0x6D, 0x64, 0x0F, 0x3F, 0x0C, 0xEC, 0x26, 0xF0, 0xAE, 0x2E, 0xE4,
-    0xB5, 0x5D, 0xFD, 0xD6, 0xAF, 0x99, 0x61, 0x60, 0xE2, 0x2A, 0x58, 0x6A, 0x65, 0xD8, 0x1D, 0xF3,
-    0x5F, 0x1B, 0xBC, 0xE4, 0x5E, 0x6E, 0xCC, 0x13, 0xEF, 0xF5, 0xD6, 0x3C, 0xF1, 0x5F, 0xEB, 0xCD,
-    0x93, 0xF0, 0x61, 0xFB, 0x24, 0xF2, 0x06, 0xF3, 0xE4, 0xB8, 0xF9, 0xA8, 0x89, 0x37, 0x8D, 0x4F,
-    0x98, 0xFF, 0xA1, 0x3E, 0xEE, 0x0B, 0xA6, 0x80, 0x38, 0x1F, 0xF6, 0x09, 0xA2, 0xBD, 0xCA, 0xFD,
-    0x45, 0x6F, 0x22, 0x4F, 0xDE, 0x1B, 0x7D, 0xC4, 0x27, 0xFE, 0x4B, 0xBD, 0xEC, 0x75, 0xAC, 0xF8,
-    0x53, 0x00, 0xBF, 0x78, 0xE2, 0xC0, 0x1F, 0x83, 0x9C, 0x34, 0xA7, 0xF7, 0x10, 0x2C, 0x7C, 0x47,
-    0xCB, 0xC5, 0x70, 0x3E, 0x7F, 0x22, 0x4F, 0x62, 0xDD, 0xC8, 0x82, 0x2B, 0xEA, 0xC3, 0x0A, 0xBA,
-    0x38, 0x80, 0x02, 0x2C, 0x89, 0x76, 0x90, 0x6B, 0x20, 0xF8, 0xF9, 0xB1, 0x86, 0x0D, 0x12, 0x0B,
-    0x7A, 0x75, 0x0C, 0xD8, 0xDA, 0x58, 0x63, 0x9E, 0x61, 0x4B, 0x79, 0xF1, 0xA3, 0x5D, 0xB8, 0x58,
-    0x9C, 0x5F, 0x76, 0x22, 0x6B, 0x7B, 0xEF, 0xCD, 0x4E, 0x54, 0x71, 0xEF, 0xBF, 0xD2, 0x25, 0x02,
-    0x01, 0xC2, 0x67, 0xBA, 0xA4, 0x59, 0xEF, 0xD7, 0xDF, 0xEC, 0x8A, 0xA1, 0xE8, 0xB3, 0x8F, 0x3A,
-    0x6A, 0x66, 0xC6, 0x77, 0x6C, 0x03, 0x67, 0x68, 0xC3, 0x4D, 0x8F, 0xD8, 0xB5, 0x2C, 0x20, 0x82,
-    0xD7, 0xD2, 0x5D, 0x5A, 0x76, 0x3A, 0xDF, 0x26, 0x97, 0xBC, 0x41, 0x66, 0x89, 0x3E, 0x29, 0x4D,
-    0x28, 0xF1, 0x12, 0xC3, 0x4C, 0x94, 0x28, 0xC9, 0x3B, 0xD0, 0x8E, 0xA2, 0x41, 0xA6, 0x50, 0x7C,
-    0xFA, 0x69, 0x31, 0x48, 0x10, 0x6F, 0x99, 0xCA, 0x8D, 0xDC, 0xC1, 0x9D, 0x32, 0x76, 0xE9, 0x4E,
-    0x69, 0x4F, 0xBB, 0x10, 0xED, 0x22, 0x32, 0xA0, 0xD1, 0x8A, 0xE6, 0x88, 0xDE, 0x4C, 0x5A, 0xF0,
-    0x65, 0x2D, 0x43, 0x12, 0xE8, 0xF3, 0x3C, 0x73, 0x0E, 0x61, 0xE1, 0xBC, 0x7B, 0x1A, 0x4E, 0xCD,
-    0xC6, 0x81, 0x58, 0xEB, 0xD1, 0x29, 0x77, 0x08, 0xD9, 0x99, 0x8B, 0xF4, 0x7D, 0x20, 0x32, 0x53,
-    0x98, 0xFC, 0xB2, 0xE8, 0x1D, 0x1A, 0x3D, 0x35, 0xE2, 0x29, 0x42, 0xD3, 0xA0, 0x8B, 0x6A, 0x81,
-    0xA8, 0x62, 0x3B, 0x26, 0x55, 0x51, 0x17, 0xBD, 0x40, 0xFB, 0x54, 0xF4, 0x6D, 0x0F, 0xFE, 0xD0,
-    0x04, 0x56, 0xC2, 0x20, 0x8E, 0x79, 0x86, 0x65, 0x46, 0xEC, 0x85, 0x2B, 0x0A, 0x01, 0x10, 0x59,
-    0x8E, 0x68, 0x31, 0x74, 0x32, 0x49, 0x0F, 0xD0, 0x40, 0x06, 0xD2, 0xAE, 0xE5, 0x20, 0xA5, 0x9F,
-    0x2D, 0xED, 0xB3, 0xEC, 0x6D, 0x35, 0x63, 0x94, 0xCD, 0xD9, 0x33, 0xCB, 0x45, 0xC5, 0x6B, 0x9D,
-    0x61, 0x1A, 0xB1, 0x86, 0x3A, 0xC3, 0x2C, 0x62, 0x12, 0x75, 0xB1, 0xE1, 0x96, 0x3E, 0xE8, 0x42,
-    0x1B, 0xB1, 0x94, 0x67, 0x86, 0x5F, 0xDA, 0xA0, 0xF3, 0xC9, 0x30, 0xB1, 0x18, 0xC1, 0x1E, 0x33,
-    0x16, 0x93, 0x3A, 0xE8, 0x1C, 0xC3, 0x32, 0xE5, 0xFA, 0x90, 0x92, 0x67, 0x06, 0x58, 0xC0, 0x31,
-    0x98, 0xE6, 0x7E, 0x99, 0x34, 0x70, 0x0D, 0x13, 0x15, 0x85, 0x6D, 0xE2, 0x8F, 0x4F, 0x3F, 0x09,
-    0x6E, 0x90, 0x05, 0xD8, 0x46, 0xEB, 0x0D, 0x2E, 0x39, 0x47, 0xE9, 0x87, 0xC9, 0x4F, 0x2A, 0xB9,
-    0x6C, 0x65, 0x86, 0xAC, 0x9F, 0xA7, 0x67, 0xDC, 0x53, 0xFC, 0x49, 0x0B, 0xF9, 0xA1, 0x74, 0xD0,
-    0x82, 0x71, 0xDC, 0x21, 0x68, 0x13, 0x69, 0x05, 0x91, 0xB4, 0xB1, 0x70, 0x90, 0xF0, 0x50, 0x17,
-    0x09, 0x0B, 0xC5, 0x6D, 0x36, 0x04, 0xE0, 0xA1, 0x2A, 0xD3, 0xAE, 0xF6, 0xF2, 0x20, 0x77, 0x5A,
-    0x19, 0xD8, 0xC5, 0x8B, 0xA9, 0x09, 0xE8, 0x0C, 0x69, 0x28, 0xA0, 0x33, 0xA9, 0x42, 0x3A, 0x2F,
-    0x93, 0xDC, 0xEF, 0x63, 0xDC, 0x15, 0xB3, 0x48, 0x8D, 0x22, 0x16, 0xEF, 0xCF, 0x06, 0xCC, 0x92,
-    0x30, 0xCD, 0x7A, 0x6B, 0x5C, 0x7F, 0xD8, 0x73, 0xAE, 0x9E, 0x3F, 0x20, 0xEB, 0x05, 0xAA, 0xFC,
-    0x10, 0x19, 0x5D, 0xBB, 0xC4, 0x6E, 0x09, 0x53, 0x22, 0xFC, 0x2E, 0x79, 0xAA, 0x18, 0x44, 0xF8,
-    0x0C, 0xCE, 0x24, 0x85, 0x07, 0xE7, 0xEE, 0x43, 0x62, 0xE1, 0x84, 0x79, 0xA6, 0xBC, 0x5F, 0x00,
-    0x4A, 0x63, 0x35, 0x2F, 0xA9, 0xE8, 0x53, 0xB1, 0xB0, 0x73, 0xA8, 0x6E, 0x31, 0x58, 0x8C, 0x89,
-    0x92, 0xC2, 0x54, 0x42, 0xFA, 0x98, 0xB3, 0x35, 0xB5, 0x56, 0x14, 0x8C, 0xBB, 0xCC, 0x38, 0xF2,
-    0x65, 0xBF, 0x39, 0x5B, 0x32, 0x71, 0xF2, 0x3E, 0xD2, 0x20, 0x7B, 0x06, 0xED, 0xE3, 0xF4, 0x45,
-    0x9F, 0x93, 0x5A, 0x1D, 0x7E, 0xDE, 0x33, 0xBE, 0x2F, 0xD9, 0xA5, 0x7D, 0x32, 0x45, 0xD3, 0x25,
-    0xC2, 0x4D, 0x22, 0xD2, 0x92, 0x9A, 0x42, 0x19, 0xF3, 0x74, 0xE3, 0x66, 0xCA, 0x06, 0x79, 0x30,
-    0x90, 0x51, 0x9A, 0xFF, 0xA4, 0x0B, 0x1A, 0x33, 0x60, 0x22, 0x30, 0x4A, 0xFD, 0x4B, 0xFD, 0xFC,
-    0x42, 0xBE, 0xF6, 0x72, 0x63, 0x42, 0x8C, 0xC2, 0xF9, 0xEF, 0x19, 0xAD, 0x36, 0xAF, 0xC8, 0xF1,
-    0xD3, 0x6B, 0x93, 0xFB, 0xCF, 0xFB, 0x0F, 0x56, 0x59, 0xE7, 0x7F, 0xA7, 0xF1, 0x3B, 0xFF, 0xA1,
-    0xCE, 0xEB, 0xFC, 0x74, 0x07, 0x64, 0xF5, 0xBA, 0xE4, 0x84, 0x48, 0x8E, 0xF4, 0x82, 0x33, 0xF5,
-    0x1F, 0x6C, 0x84, 0x6F, 0x1E, 0xAE, 0x10, 0x3C, 0x49, 0x8D, 0x19, 0xA6, 0x82, 0xF4, 0x06, 0x5F,
-    0xB9, 0x94, 0x6A, 0x45, 0xF7, 0x0F, 0x99, 0x98, 0x42, 0x85, 0xA9, 0xA8, 0x3E, 0x5C, 0xC5, 0xCC,
-    0x8F, 0x6A, 0x6C, 0x02, 0x15, 0x92, 0x6E, 0xDF, 0x39, 0x07, 0xCA, 0xE8, 0x72, 0x36, 0x80, 0x99,
-    0xB3, 0x3A, 0x22, 0x75, 0xFE, 0xC5, 0x78, 0x8D, 0xB9, 0x1E, 0x9F, 0x1D, 0xEC, 0x7D, 0xE8, 0x7C,
-    0x10, 0xC9, 0x40, 0x4F, 0x4A, 0xF1, 0xBE, 0x41, 0xA1, 0xDD, 0x92, 0x26, 0x35, 0x3E, 0x75, 0xB1,
-    0xF1, 0xA3, 0x26, 0x16, 0x21, 0x93, 0x54, 0x5E, 0x0F, 0x23, 0xA5, 0xF8, 0xBF, 0xDE, 0x50, 0xE8,
-    0x0F, 0x86, 0xE2, 0x03, 0x3D, 0x14, 0xE5, 0xBF, 0x41, 0xD4, 0x6E, 0x60, 0xD4, 0x0E, 0xE2, 0xB2,
-    0x01, 0xC8, 0x99, 0x47, 0xED, 0x28, 0x32, 0x4A, 0x24, 0x7A, 0x6A, 0xD4, 0x60, 0xB8, 0xB0, 0xA4,
-    0x45, 0xB7, 0x01, 0x38, 0x8A, 0x60, 0x42, 0xEE, 0x30, 0x54, 0x44, 0x1A, 0x92, 0xB7, 0x22, 0x7A,
-    0x48, 0x8F, 0xD1, 0x5B, 0xBA, 0xCA, 0xEC, 0x25, 0xA4, 0x7D, 0xC4, 0xCD, 0x36, 0xB5, 0x2D, 0xAB,
-    0x3D, 0x00, 0xD5, 0x54, 0x30, 0xAD, 0x09, 0xAD, 0x2B, 0xEA, 0xC0, 0x92, 0x41, 0xE6, 0x7C, 0x56,
-    0x59, 0x60, 0x17, 0x3D, 0x23, 0x7E, 0xCF, 0xDD, 0x1A, 0x23, 0x40, 0x8C, 0x2A, 0xDE, 0x1E, 0xF1,
-    0xFB, 0x36, 0x66, 0x81, 0x99, 0x8D, 0x90, 0xB8, 0x0F, 0x62, 0xFC, 0xCF, 0x80, 0xA1, 0x5F, 0x81,
-    0x01, 0xFE, 0x16, 0xB4, 0xE0, 0x07, 0xF4, 0xB6, 0x2A, 0x4B, 0x68, 0x4A, 0x12, 0x9D, 0x3F, 0x42,
-    0x33, 0x45, 0x47, 0xCC, 0xAD, 0xFA, 0x2E, 0x7B, 0xF4, 0x32, 0x13, 0x70, 0x6A, 0xC2, 0xEA, 0x53,
-    0xF7, 0xCC, 0x53, 0xEE, 0xEF, 0xE4, 0xB8, 0x57, 0xD2, 0x47, 0x90, 0x65, 0x0A, 0x28, 0xD3, 0xE1,
-    0xF7, 0x1E, 0x86, 0x46, 0xE2, 0x57, 0x30, 0xA6, 0xD2, 0xD1, 0xB4, 0x39, 0xE0, 0xA9, 0x59, 0xB0,
-    0x23, 0x66, 0x10, 0xB2, 0x18, 0xD3, 0xD9, 0xA0, 0xB2, 0x8C, 0xBF, 0x00, 0xB9, 0x1D, 0xA6, 0x8C,
-    0xC2, 0x24, 0x0F, 0x2A, 0x8E, 0x54, 0x00, 0xF2, 0x64, 0xF2, 0xD0, 0x04, 0xC9, 0x6D, 0x61, 0xAF,
-    0xF5, 0x33, 0xBA, 0x14, 0xB6, 0x0D, 0x7A, 0x01, 0xCD, 0x2F, 0x02, 0x12, 0x06, 0x30, 0x1B, 0x37,
-    0xCC, 0x33, 0x61, 0xDD, 0x6D, 0xF3, 0x0C, 0xFE, 0x18, 0xF3, 0x0C, 0xD9, 0xAF, 0xE6, 0x99, 0xD2,
-    0x6E, 0xA5, 0xF8, 0x59, 0xE9, 0x78, 0xA9, 0x78, 0x3F, 0x95, 0xBD, 0x9A, 0x9B, 0xEF, 0x50, 0xC9,
-    0x6B, 0xA9, 0xFD, 0xDE, 0xF8, 0xB2, 0xB2, 0x79, 0x26, 0xE1, 0x40, 0x39, 0x5A, 0xE4, 0x26, 0xFD,
-    0xA3, 0xF8, 0x60, 0x30, 0x32, 0x57, 0x50, 0x9A, 0xA8, 0x69, 0x6F, 0x86, 0xF7, 0xDC, 0x46, 0xCD,
-    0xB2, 0x78, 0x67, 0x43, 0x1D, 0xAB, 0x45, 0x68, 0xCA, 0xD9, 0x41, 0x8F, 0x4F, 0xE2, 0x59, 0xF1,
-    0x59, 0x52, 0x2F, 0xCE, 0xCF, 0xFA, 0xAE, 0x3B, 0x79, 0xEE, 0xBE, 0x89, 0x6C, 0xAD, 0x57, 0xF4,
-    0x34, 0xD2, 0xD8, 0x5E, 0x45, 0xED, 0x89, 0xAE, 0x10, 0x45, 0x57, 0xBB, 0x35, 0x82, 0xDF, 0x71,
-    0x23, 0xC8, 0xAF, 0x84, 0x93, 0xD1, 0x2B, 0x61, 0xB8, 0x8A, 0x05, 0x05, 0x53, 0x16, 0xC1, 0x56,
-    0xBA, 0xB8, 0x44, 0x67, 0x1B, 0xC3, 0x77, 0x38, 0xA6, 0x8C, 0xDF, 0x60, 0x55, 0x25, 0x4C, 0x41,
-    0xDB, 0x56, 0x08, 0x7F, 0xC1, 0x23, 0x22, 0x5B, 0xD1, 0x64, 0x78, 0x0D, 0x82, 0x83, 0xB8, 0xC9,
-    0x07, 0x53, 0x00, 0x01, 0x97, 0x52, 0x68, 0xBB, 0x1B, 0x59, 0x76, 0x48, 0x6C, 0xDF, 0x5E, 0xB4,
-    0x72, 0xB1, 0xB7, 0x82, 0xD3, 0x76, 0xDC, 0xC8, 0xD6, 0xBB, 0xE6, 0x55, 0x12, 0x87, 0x51, 0x66,
-    0x05, 0x11, 0x05, 0xCD, 0xB1, 0xFE, 0x7A, 0x27, 0x9F, 0x70, 0xA4, 0x1B, 0x46, 0x15, 0x9B, 0xEC,
-    0x05, 0x40, 0xF8, 0x02, 0xEB, 0xC8, 0x84, 0x38, 0x08, 0xEC, 0x05, 0x5A, 0x2F, 0xBE, 0x62, 0xAE,
-    0x31, 0xD7, 0x9B, 0xCF, 0x86, 0x64, 0x41, 0x9F, 0xF5, 0x85, 0xAE, 0x8E, 0xFF, 0xC4, 0xA4, 0x42,
-    0xD6, 0xB3, 0xDA, 0x16, 0x5B, 0x8F, 0x93, 0x8E, 0x06, 0xB3, 0xC7, 0xD8, 0x97, 0x81, 0xF4, 0xB2,
-    0xA2, 0xBF, 0xF9, 0xDB, 0x4E, 0x46, 0x0C, 0x31, 0xC9, 0x84, 0x95, 0xD2, 0x18, 0x1A, 0xF0, 0xBB,
-    0x2C, 0x91, 0xCC, 0xA4, 0x67, 0xD0, 0x6C, 0x11, 0x0E, 0x0D, 0x3F, 0x14, 0x2C, 0x6B, 0xB2, 0x28,
-    0x98, 0x9A, 0xC1, 0xE2, 0x24, 0x27, 0x5F, 0x9C, 0x17, 0x4F, 0xEF, 0x9A, 0x5C, 0x41, 0x93, 0xA1,
-    0x22, 0xD8, 0xD4, 0xA4, 0x1E, 0xAE, 0x84, 0xFF, 0xC1, 0x4C, 0xE4, 0x38, 0xAF, 0x5E, 0xB9, 0xA0,
-    0x60, 0xE4, 0xE7, 0x6B, 0x4B, 0x3B, 0x24, 0x16, 0xBC, 0xA1, 0x2B, 0x66, 0x85, 0x42, 0x1B, 0x41,
-    0x6C, 0x66, 0x4F, 0x01, 0xC2, 0xC0, 0xE9, 0x8A, 0xB4, 0x16, 0xAF, 0x49, 0x60, 0xBB, 0x36, 0x6E,
-    0x7E, 0x97, 0x30, 0x8F, 0x61, 0x9F, 0xA4, 0x19, 0xDB, 0x6C, 0xA9, 0x8D, 0xAF, 0xD1, 0xCE, 0xAF,
-    0x4F, 0x8C, 0xA5, 0x82, 0x3C, 0x10, 0x0F, 0xF3, 0x1D, 0xB5, 0x98, 0xBA, 0xA2, 0x84, 0x35, 0x5F,
-    0xC2, 0xBF, 0x20, 0xF3, 0xD1, 0xFA, 0xC8, 0x05, 0xD7, 0x6D, 0xC1, 0x62, 0x19, 0x91, 0x49, 0xCC,
-    0xAC, 0x3C, 0x65, 0x1D, 0x04, 0x87, 0xCD, 0x30, 0xB2, 0x5D, 0x2B, 0xDC, 0x58, 0x2A, 0xF0, 0x31,
-    0xAD, 0x1E, 0xA7, 0xFA, 0xF3, 0x0B, 0xDC, 0xE2, 0xD6, 0x0E, 0xB3, 0xCD, 0x8F, 0xCC, 0xBE, 0xAF,
-    0xD4, 0xBE, 0x9F, 0xF5, 0x4B, 0x0E, 0x93, 0x80, 0x07, 0x1F, 0x49, 0xD5, 0x4D, 0x11, 0xD6, 0x85,
-    0x20, 0x95, 0x24, 0xA8, 0x92, 0x3C, 0x29, 0x57, 0xBD, 0x12, 0x51, 0x38, 0xFA, 0x82, 0x38, 0xB5,
-    0x71, 0x7D, 0xD5, 0xC6, 0x5C, 0x22, 0x7B, 0x45, 0xFD, 0x00, 0xAE, 0xFE, 0x4A, 0x64, 0x96, 0xE0,
-    0xD6, 0x96, 0x86, 0xAC, 0x2C, 0xE1, 0x16, 0xDC, 0x3B, 0xC5, 0xD4, 0xA7, 0x01, 0x93, 0x72, 0xFB,
-    0x22, 0x61, 0x63, 0xD3, 0x04, 0x08, 0x4D, 0xD2, 0xE8, 0x61, 0xEF, 0xC1, 0x72, 0x7F, 0xEF, 0x7E,
-    0x5B, 0x9C, 0x20, 0xCA, 0x9D, 0x4C, 0xCE, 0x1B, 0xC3, 0x1E, 0x12, 0xCA, 0x29, 0xAB, 0x1F, 0xED,
-    0x1B, 0xCA, 0x6D, 0xF6, 0x93, 0x98, 0x9F, 0xC3, 0xB6, 0xEE, 0x30, 0xE7, 0xA6, 0xF3, 0x21, 0xEE,
-    0x21, 0x71, 0x91, 0xBC, 0x7C, 0x9F, 0x31, 0xEB, 0x4D, 0xF2, 0xF2, 0xB5, 0xC8, 0x3C, 0x65, 0xD9,
-    0xD4, 0x77, 0x76, 0x63, 0xAA, 0xAC, 0xAB, 0x37, 0xEF, 0xB6, 0x61, 0xEE, 0x40, 0xCF, 0xDE, 0x8F,
-    0x96, 0x09, 0xFC, 0x05, 0xC8, 0xE8, 0xB7, 0x4E, 0x1B, 0xC3, 0xB3, 0x3E, 0x13, 0x03, 0x92, 0x52,
-    0xC6, 0x85, 0xD0, 0x85, 0xF0, 0xD7, 0xBD, 0x74, 0x3C, 0x2C, 0x3E, 0x18, 0xB2, 0x30, 0x0E, 0x78,
-    0x15, 0xB5, 0x87, 0x98, 0x52, 0x46, 0x07, 0xBC, 0x7F, 0x1D, 0x2F, 0xBF, 0x11, 0x92, 0x32, 0x1D,
-    0x5E, 0xA5, 0x4E, 0xC8, 0x6C, 0x66, 0x8F, 0x29, 0xAA, 0x13, 0x87, 0xF1, 0x19, 0x01, 0x5E, 0xBF,
-    0xEE, 0xEF, 0xF6, 0xAA, 0x13, 0x6B, 0x41, 0xAE, 0x92, 0xB7, 0x6D, 0xD4, 0x81, 0xB0, 0x5A, 0x80,
-    0xD7, 0x87, 0x22, 0xDC, 0xAA, 0xAF, 0x31, 0x75, 0xD1, 0x5F, 0x5C, 0xB5, 0x8D, 0x58, 0x4F, 0x33,
-    0xDD, 0x9F, 0x35, 0x4A, 0x07, 0xFB, 0xA5, 0x5E, 0xD7, 0x7D, 0x31, 0x5C, 0x2C, 0xF2, 0xA3, 0xF2,
-    0xDB, 0x37, 0x2F, 0x6E, 0x3F, 0x71, 0x54, 0x7D, 0xF3, 0xC9, 0xA3, 0x5F, 0xBF, 0x60, 0x04, 0xCC,
-    0x00, 0x45, 0xB5, 0x9B, 0x9E, 0xF4, 0x75, 0xB9, 0xA6, 0x8E, 0x2C, 0x71, 0xB4, 0x33, 0x26, 0x93,
-    0xFB, 0x76, 0x2E, 0xD4, 0x57, 0x1C, 0x2B, 0xD0, 0x7F, 0x67, 0xE6, 0xC9, 0xB5, 0x0E, 0x78, 0x88,
-    0xB9, 0xC3, 0xE7, 0x6D, 0xDD, 0x5B, 0x2C, 0x76, 0xC6, 0x5F, 0x03, 0x83, 0xFC, 0xE1, 0x11, 0xE5,
-    0xE6, 0xFF, 0x58, 0x9E, 0xFC, 0x53, 0x2F, 0x55, 0x37, 0xF3, 0x73, 0x97, 0xC9, 0xFE, 0xBB, 0xEB,
-    0x5C, 0x62, 0x18, 0x23, 0xE9, 0x7F, 0xFE, 0xEF, 0xF8, 0xE4, 0xE7, 0xFF, 0xAA, 0x32, 0x6A, 0xE4,
-    0x5C, 0x70, 0x53, 0x37, 0x14, 0x4C, 0x63, 0x53, 0xE5, 0x8A, 0xC6, 0xF8, 0xC2, 0x9C, 0x2B, 0xC0,
-    0x47, 0x27, 0xD7, 0x95, 0x5B, 0x22, 0x1C, 0xFD, 0xA3, 0x3D, 0x3D, 0x1C, 0xA1, 0x98, 0x6B, 0x43,
-    0x71, 0x2A, 0xF8, 0x60, 0x9C, 0x84, 0x31, 0xA7, 0xEA, 0xD0, 0xFE, 0x6F, 0x09, 0xC7, 0x27, 0x47,
-    0xC7, 0x27, 0x6B, 0xE3, 0x93, 0xD5, 0x51, 0x07, 0xEE, 0x8C, 0x57, 0xF6, 0xBC, 0x85, 0xAC, 0xFB,
-    0xDD, 0x8C, 0xEA, 0x12, 0x16, 0x20, 0xCF, 0x9E, 0x48, 0x81, 0x59, 0xAA, 0xDD, 0x18, 0xDA, 0x3D,
-    0xF7, 0xD9, 0x07, 0xFA, 0xC7, 0xA6, 0xF9, 0x03, 0xEB, 0x54, 0x92, 0xFD, 0x73, 0x64, 0x9C, 0x43,
-    0x9B, 0x06, 0xED, 0xFC, 0x4F, 0x75, 0xF3, 0x3F, 0x77, 0x8D, 0x7E, 0x5F, 0xE4, 0x77, 0xB9, 0xF4,
-    0x27, 0xE6, 0xB6, 0x42, 0x1F, 0x35, 0x49, 0x99, 0xEC, 0x7E, 0x8E, 0xE0, 0x1E, 0xA4, 0x47, 0x39,
-    0xCD, 0x38, 0xF6, 0x73, 0x0B, 0xE9, 0xD7, 0x48, 0x9A, 0x1D, 0x9F, 0xCC, 0xC0, 0xD0, 0x22, 0x1F,
-    0xB9, 0x0D, 0x42, 0x67, 0x5E, 0x03, 0x2D, 0xE8, 0x75, 0xB1, 0xA9, 0x0C, 0xC2, 0xF4, 0x7F, 0xF5,
-    0xCF, 0xEE, 0x70, 0x79, 0xD3, 0x2E, 0xBF, 0x77, 0x58, 0x88, 0xB5, 0xAF, 0x2E, 0x64, 0x97, 0x73,
-    0xA2, 0x1D, 0x22, 0x3D, 0xAF, 0x59, 0x9C, 0x34, 0x93, 0x28, 0x86, 0x85, 0x4E, 0xBE, 0xC8, 0x44,
-    0xB1, 0xDD, 0x59, 0x40, 0x62, 0x75, 0x36, 0xDB, 0xDD, 0x18, 0x2E, 0x20, 0x37, 0x2D, 0x76, 0x6B,
-    0x4F, 0x9A, 0xEE, 0x57, 0x11, 0x64, 0x4A, 0x8C, 0xB1, 0x78, 0xCD, 0x74, 0xDE, 0xF7, 0x99, 0xC9,
-    0x0B, 0xF7, 0x81, 0xB3, 0x50, 0xB5, 0xD2, 0xEC, 0x27, 0x19, 0x0B, 0x3F, 0xCB, 0x07, 0xF4, 0x65,
-    0xF8, 0x57, 0xE1, 0xE8, 0xF8, 0x62, 0x7D, 0xCD, 0x8B, 0x55, 0x35, 0xD7, 0x4F, 0x32, 0xBE, 0x07,
-    0xAF, 0xAD, 0xE2, 0xDD, 0x10, 0xD7, 0x6D, 0xCD, 0xAA, 0x6A, 0x14, 0x3D, 0x41, 0x67, 0x40, 0xEE,
-    0xBE, 0x46, 0x55, 0x0D, 0x52, 0x6D, 0xCE, 0x0B, 0x06, 0xCE, 0x3A, 0x79, 0x8A, 0x6C, 0x2C, 0x35,
-    0xC6, 0x94, 0x89, 0x9E, 0xE9, 0x63, 0x30, 0x79, 0x59, 0x28, 0x99, 0x1C, 0x9F, 0x91, 0x0C, 0xDF,
-    0x42, 0x22, 0x56, 0x84, 0xC5, 0xFB, 0x2E, 0x22, 0x6A, 0xCC, 0xC6, 0x2A, 0x90, 0x8D, 0xB5, 0x42,
-    0x2F, 0xD1, 0x1A, 0xC8, 0xEF, 0xD8, 0x3A, 0xC5, 0x41, 0x59, 0x0D, 0xF5, 0xF8, 0x64, 0xBE, 0xE3,
-    0x8F, 0xDA, 0x07, 0x0A, 0x59, 0x4E, 0xCA, 0x9C, 0x0E, 0x18, 0xAE, 0x71, 0x92, 0xDE, 0xFA, 0x03,
-    0xA3, 0xC3, 0xE0, 0x4C, 0xC5, 0x10, 0x50, 0x2A, 0x20, 0x27, 0x1E, 0x7E, 0xF9, 0xF8, 0x64, 0xAB,
-    0xCC, 0x98, 0x70, 0x70, 0xFD, 0x20, 0xF5, 0xE2, 0x03, 0x7A, 0x04, 0x41, 0x6B, 0xF4, 0x9E, 0xF9,
-    0x9E, 0xB6, 0x5C, 0x95, 0x08, 0x71, 0xA1, 0x5C, 0x95, 0xE4, 0xA6, 0xD9, 0xEF, 0x1A, 0x95, 0x4E,
-    0x63, 0x74, 0x5D, 0x6C, 0xB9, 0x06, 0x21, 0x44, 0x1B, 0x61, 0xC7, 0x43, 0xD8, 0xEB, 0x3C, 0x2B,
-    0x86, 0x6E, 0xD8, 0x51, 0x16, 0x33, 0xD3, 0xA6, 0x8E, 0xE8, 0x8A, 0xF4, 0x49, 0x3D, 0x52, 0xD7,
-    0x38, 0x27, 0xD5, 0x1E, 0x7A, 0xDA, 0x38, 0x1E, 0xE9, 0x9C, 0xFC, 0xAF, 0xC6, 0xCD, 0x68, 0xDC,
-    0xD0, 0xC6, 0x7E, 0x31, 0x7E, 0x67, 0x6F, 0x20, 0xD5, 0x96, 0x9A, 0x93, 0x1E, 0xA4, 0xEF, 0xF0,
-    0xBB, 0xE8, 0x29, 0x7D, 0xEF, 0xF4, 0xBF, 0x1D, 0x62, 0xB7, 0xCE, 0xD2, 0x7A, 0x2C, 0xE8, 0xA9,
-    0x2B, 0x72, 0x98, 0x5B, 0xC9, 0x95, 0x3D, 0x3E, 0x15, 0x8C, 0x16, 0xC8, 0xA8, 0x11, 0x3C, 0xC3,
-    0x70, 0xA9, 0x22, 0x39, 0xB7, 0xB4, 0x75, 0x0C, 0x74, 0xE9, 0xC6, 0x20, 0xE9, 0x18, 0xCB, 0xA3,
-    0xA8, 0xF0, 0xC1, 0xAE, 0x32, 0xF6, 0xAC, 0x94, 0xC1, 0x13, 0x01, 0x67, 0xB6, 0xE6, 0x6B, 0x03,
-    0xB0, 0x02, 0x6E, 0x32, 0xB1, 0x7F, 0xA7, 0xCA, 0x64, 0x1E, 0x20, 0xB0, 0x18, 0xE3, 0xF0, 0x0A,
-    0x1C, 0x0E, 0xD0, 0x1E, 0xD6, 0x57, 0x04, 0x91, 0x9C, 0xDC, 0x81, 0xA9, 0xF3, 0x49, 0xFD, 0x8D,
-    0xE3, 0x30, 0x17, 0xCB, 0x52, 0xB4, 0x58, 0x02, 0xC4, 0xA7, 0x7C, 0xC1, 0xDE, 0x47, 0x69, 0xB7,
-    0x24, 0x74, 0x41, 0x28, 0x81, 0x4B, 0x0C, 0x12, 0x5E, 0x48, 0x4A, 0x8A, 0x9E, 0x93, 0xD9, 0x5B,
-    0x63, 0x28, 0x87, 0x88, 0x6C, 0xC8, 0x3E, 0x60, 0x3D, 0x70, 0x9B, 0x30, 0xBA, 0x01, 0x28, 0x4E,
-    0xC7, 0xA0, 0x7C, 0x3E, 0x31, 0xE6, 0x1F, 0xB2, 0xFD, 0xE1, 0x79, 0x02, 0x4E, 0x1E, 0xF7, 0x18,
-    0x2A, 0x4D, 0x44, 0xC0, 0xA4, 0x45, 0xC3, 0xFE, 0x5C, 0x42, 0xA2, 0xAF, 0x56, 0x16, 0x23, 0x8C,
-    0x56, 0xE7, 0x58, 0xF9, 0x33, 0x57, 0x3B, 0x1B, 0x4B, 0x2A, 0x78, 0xDE, 0xAA, 0x38, 0xBF, 0x6F,
-    0xB2, 0x19, 0x54, 0x59, 0x13, 0xEB, 0x2A, 0x69, 0xCF, 0x6E, 0xCB, 0xAA, 0xEC, 0xB6, 0xFF, 0x64,
-    0xCD, 0x1D, 0x9C, 0xFA, 0x07, 0x2A, 0x74, 0x07, 0xEE, 0x87, 0xA7, 0x07, 0x7A, 0xE4, 0xDF, 0x19,
-    0x8E, 0x91, 0x03, 0xB9, 0x61, 0xA2, 0x4F, 0x69, 0x05, 0x64, 0x7F, 0x35, 0x00, 0x36, 0xEA, 0x97,
-    0x07, 0xAE, 0xBC, 0x3B, 0xC0, 0x4B, 0x33, 0xC8, 0xE7, 0xC0, 0x04, 0x1E, 0x62, 0xAF, 0x85, 0xA8,
-    0x8D, 0xCD, 0x62, 0x57, 0x6F, 0x26, 0xBA, 0x3E, 0x32, 0xC6, 0x8C, 0xAF, 0x96, 0xB3, 0xB5, 0xDC,
-    0xFC, 0x43, 0x1B, 0xB7, 0xD7, 0x9B, 0xC8, 0x0C, 0x44, 0x55, 0x23, 0xAC, 0x04, 0x08, 0xD8, 0x10,
-    0xF2, 0x2C, 0xA8, 0xD4, 0x6C, 0x4F, 0x30, 0x44, 0x2C, 0x26, 0xBB, 0xBA, 0x5F, 0x33, 0x69, 0xAA,
-    0x1A, 0x43, 0xFD, 0x63, 0x65, 0xC4, 0x61, 0xDA, 0xC5, 0x34, 0x91, 0x61, 0xB5, 0xB1, 0x9E, 0x20,
-    0x46, 0x91, 0x7E, 0x38, 0x6C, 0x8D, 0x15, 0xCE, 0xC6, 0x39, 0xB1, 0x33, 0xEB, 0x1D, 0x32, 0xEE,
-    0x57, 0x2E, 0x8E, 0x25, 0x2D, 0x4C, 0xBD, 0x29, 0x04, 0x08, 0x0F, 0x02, 0x84, 0xE1, 0x62, 0x16,
-    0xB3, 0xDC, 0xA7, 0x69, 0x4E, 0xCF, 0xBA, 0x18, 0x31, 0x1D, 0x92, 0x0A, 0x52, 0x56, 0x30, 0x48,
-    0x37, 0x51, 0x50, 0x9B, 0x48, 0x8B, 0x6A, 0xC3, 0xE8, 0x37, 0x5A, 0x98, 0x68, 0x30, 0x28, 0x01,
-    0x00, 0x81, 0xC5, 0xBF, 0xF2, 0xF8, 0xBD, 0xD6, 0xA0, 0x65, 0x73, 0x26, 0x8D, 0x82, 0x1B, 0xF8,
-    0x92, 0xCF, 0x20, 0x61, 0xB8, 0x85, 0x91, 0x1D, 0x3F, 0x0C, 0xBA, 0xCA, 0x51, 0x5E, 0x50, 0xD6,
-    0xA5, 0x24, 0x73, 0x4C, 0x54, 0xE0, 0xB3, 0xA2, 0x63, 0xDD, 0x70, 0x14, 0xEB, 0x88, 0xD7, 0xBB,
-    0xBD, 0x55, 0xC3, 0x0E, 0xC3, 0x47, 0x63, 0xD5, 0x70, 0x6D, 0x77, 0x29, 0x0F, 0x1D, 0x98, 0x55,
-    0x0D, 0x77, 0x8E, 0x31, 0xE6, 0x98, 0xA6, 0xA0, 0x7C, 0x52, 0x6F, 0x81, 0xBA, 0xD5, 0xA2, 0x19,
-    0xFA, 0xF8, 0x24, 0x17, 0x66, 0xD1, 0xC2, 0x2F, 0x81, 0x30, 0x8A, 0x88, 0x19, 0xB7, 0x3A, 0x35,
-    0x66, 0x2D, 0x60, 0x07, 0xAE, 0x71, 0x07, 0xAA, 0x59, 0xD6, 0x02, 0xF6, 0x27, 0xAA, 0xD9, 0x4D,
-    0xD6, 0x82, 0xF4, 0x8A, 0x39, 0x82, 0xC8, 0x5A, 0xB8, 0x54, 0x08, 0xC3, 0xF5, 0x33, 0x9E, 0x9D,
-    0xE7, 0x48, 0x6E, 0x2C, 0x27, 0x4A, 0x72, 0x6A, 0xE2, 0x9C, 0x51, 0x13, 0x68, 0x56, 0xEF, 0x03,
-    0x46, 0x4F, 0x9F, 0x82, 0x75, 0x14, 0x62, 0x90, 0x7F, 0x70, 0x0C, 0xF4, 0x04, 0xA7, 0xE9, 0x04,
-    0xA7, 0xE9, 0x0F, 0x19, 0x74, 0xCB, 0xCA, 0x79, 0x41, 0x75, 0xC6, 0x98, 0xC8, 0xB7, 0x39, 0x1D,
-    0x27, 0x38, 0x1D, 0x27, 0x32, 0xAC, 0xDB, 0x09, 0x23, 0xB4, 0x22, 0x13, 0xFF, 0xE8, 0x19, 0x9F,
-    0xE5, 0x51, 0x30, 0x0E, 0xFC, 0x0A, 0x9D, 0x5A, 0x47, 0x94, 0xE3, 0xF0, 0x25, 0x19, 0x70, 0xD4,
-    0x8B, 0x6A, 0x5A, 0xDB, 0xF0, 0xA6, 0xA7, 0xDA, 0x6F, 0x78, 0xD3, 0xFF, 0x85, 0x6C, 0x8C, 0xBF,
-    0xC0, 0x08, 0x8B, 0x79, 0x9A, 0x06, 0xC6, 0x5A, 0x60, 0x98, 0x7F, 0x89, 0x74, 0x8E, 0xBF, 0x30,
-    0xC9, 0x78, 0xB9, 0x8F, 0xC3, 0x67, 0x10, 0xFD, 0xDC, 0x45, 0xF0, 0x73, 0xD8, 0xBF, 0xD0, 0x2E,
-    0x17, 0x5A, 0xBE, 0x6D, 0x15, 0xAA, 0xE0, 0x91, 0x2F, 0x62, 0xA1, 0x7D, 0xB3, 0xD0, 0xC6, 0xD3,
-    0xB2, 0x37, 0x14, 0xFE, 0xC3, 0xE1, 0x39, 0xA8, 0xDC, 0xE9, 0x1C, 0x80, 0x04, 0x9B, 0x42, 0x32,
-    0xE8, 0x10, 0xAE, 0x70, 0x7D, 0xAD, 0x15, 0xAE, 0x98, 0xD2, 0x87, 0x37, 0x28, 0x6D, 0xA7, 0xE3,
-    0x0A, 0x3B, 0xC8, 0x9C, 0xC8, 0x0B, 0xAC, 0x70, 0x84, 0x9A, 0xD8, 0xDA, 0x65, 0x99, 0xC6, 0x39,
-    0xB1, 0xC2, 0x2F, 0xA2, 0xC8, 0xF9, 0x2C, 0x32, 0x86, 0xD4, 0x99, 0x7F, 0xA0, 0x2E, 0x48, 0x83,
-    0xBC, 0x4C, 0xBF, 0xA7, 0x55, 0xE5, 0xF7, 0x74, 0xFA, 0xF8, 0xBD, 0x71, 0xF3, 0xF7, 0xA1, 0xA9,
-    0x1D, 0xDC, 0x30, 0x06, 0x18, 0x1D, 0xB5, 0xFE, 0x94, 0xC6, 0x8B, 0xDF, 0x33, 0x8B, 0x80, 0x95,
-    0x13, 0xFC, 0xDC, 0xC0, 0x86, 0xA6, 0x34, 0x0B, 0x47, 0xD9, 0x20, 0x24, 0xEE, 0xB3, 0x32, 0x4F,
-    0x6D, 0xE9, 0xCD, 0x68, 0x60, 0xF1, 0xA1, 0x5C, 0x23, 0x6A, 0x24, 0x3F, 0x92, 0xE3, 0x68, 0xA2,
-    0xA2, 0xD9, 0x91, 0xEE, 0xFE, 0xA6, 0x41, 0x06, 0x53, 0xB9, 0xB9, 0xCD, 0x6F, 0xBE, 0x5B, 0x6E,
-    0xCE, 0xDB, 0x6C, 0xF0, 0x6B, 0xA7, 0x34, 0x11, 0xCD, 0x1D, 0xB1, 0x59, 0xFD, 0x1E, 0x16, 0xB2,
-    0xF9, 0x66, 0xDF, 0xD4, 0xB6, 0x51, 0x95, 0x21, 0x75, 0x91, 0xB9, 0xA1, 0xB1, 0x29, 0xFE, 0xEC,
-    0x4D, 0xB5, 0x39, 0x11, 0x59, 0xEE, 0xD8, 0x7C, 0xAD, 0xEB, 0x53, 0x04, 0x1E, 0x46, 0xFA, 0x59,
-    0xAE, 0x37, 0xD5, 0xE6, 0xB8, 0xBF, 0xAC, 0xF1, 0x11, 0x14, 0xBB, 0x77, 0xB6, 0xDA, 0xDC, 0x3A,
-    0x13, 0x16, 0x6B, 0x3E, 0xBF, 0xB5, 0x8F, 0x12, 0x7E, 0x3F, 0x9F, 0xE9, 0x37, 0x71, 0xFE, 0x94,
-    0x2A, 0xEA, 0x19, 0x64, 0x2B, 0x17, 0x08, 0x90, 0x81, 0x21, 0x7B, 0xDE, 0x00, 0x81, 0x3A, 0xAD,
-    0x08, 0xBF, 0x0B, 0xDC, 0x05, 0xF7, 0x1C, 0x46, 0xD9, 0x49, 0xB0, 0x66, 0xC8, 0xD1, 0xB9, 0x39,
-    0xC8, 0xA9, 0xB1, 0x95, 0xF8, 0x76, 0x72, 0xD2, 0xCE, 0x8C, 0x64, 0x63, 0xA9, 0x39, 0x61, 0x1A,
-    0xB5, 0xB7, 0x99, 0x87, 0xC4, 0xF7, 0xBF, 0x77, 0xC3, 0xC6, 0x4C, 0x96, 0x32, 0xB3, 0xA5, 0xEC,
-    0x74, 0x61, 0x16, 0xCC, 0x34, 0xE8, 0x29, 0xE6, 0xA1, 0x3A, 0xCB, 0xB1, 0xAD, 0x91, 0x1E, 0x23,
-    0x3D, 0x44, 0xCA, 0x88, 0xE5, 0x8C, 0x9A, 0x57, 0xF6, 0x51, 0x4E, 0x89, 0xE2, 0x9C, 0x28, 0x33,
-    0x29, 0xB3, 0xF3, 0x73, 0x98, 0x38, 0xAD, 0x4C, 0xC5, 0xAE, 0xC1, 0x79, 0xB6, 0x7C, 0xEF, 0x26,
-    0xDA, 0xD3, 0xB6, 0xD5, 0x9D, 0x69, 0x1F, 0x25, 0x6F, 0xF1, 0x08, 0x1A, 0xD3, 0x46, 0xAD, 0x69,
-    0x99, 0x3B, 0xEE, 0xDA, 0xF4, 0x71, 0xA6, 0x9D, 0xD8, 0x56, 0x9B, 0xA2, 0x7F, 0x4F, 0xCB, 0x2C,
-    0xC8, 0x7F, 0x0F, 0xC5, 0x8C, 0x82, 0x12, 0x3D, 0x1B, 0xEF, 0x33, 0x87, 0x58, 0x1D, 0xB2, 0x25,
-    0xBB, 0x67, 0x6D, 0x41, 0xE7, 0x60, 0x33, 0x72, 0x10, 0x76, 0xA4, 0x56, 0xBE, 0xA2, 0xD3, 0x59,
-    0x89, 0xBD, 0x45, 0x67, 0x2C, 0xFE, 0x98, 0x1D, 0x98, 0x85, 0x40, 0x42, 0x69, 0x12, 0xF9, 0xF2,
-    0xEB, 0x34, 0xC6, 0x3C, 0xE2, 0x59, 0x3A, 0x78, 0xD1, 0x16, 0x9A, 0xB1, 0xB6, 0x03, 0x95, 0x76,
-    0x6C, 0xA2, 0x86, 0xD6, 0x61, 0xD8, 0x22, 0xAD, 0xAF, 0x0B, 0xDB, 0x42, 0xBF, 0xAD, 0x7B, 0xD3,
-    0x1F, 0xDB, 0x2D, 0xE3, 0xB9, 0x0A, 0x53, 0xE3, 0xC0, 0xCA, 0x19, 0x1E, 0x89, 0x8D, 0x13, 0x34,
-    0x34, 0x6C, 0xE9, 0x8C, 0x79, 0x80, 0x70, 0xAF, 0x61, 0x68, 0xD9, 0xF0, 0xA2, 0x2D, 0x8B, 0xB4,
-    0x43, 0x45, 0xC6, 0x37, 0xE2, 0x1A, 0xC8, 0x05, 0x45, 0xD9, 0x39, 0x8A, 0x13, 0xC2, 0x36, 0xA9,
-    0xB2, 0x5A, 0xB4, 0x78, 0x83, 0x12, 0xC0, 0xB8, 0xC1, 0x09, 0x2D, 0x33, 0x5A, 0x83, 0x26, 0x7C,
-    0x3D, 0x41, 0xCD, 0x8C, 0xB4, 0xB8, 0x1E, 0xF9, 0xC8, 0x08, 0x3F, 0x7B, 0x53, 0xCC, 0x33, 0x1D,
-    0x60, 0x32, 0x5B, 0x74, 0xB9, 0xE9, 0x41, 0x8C, 0xFF, 0x15, 0xC7, 0x94, 0xD3, 0x5B, 0x8C, 0xE2,
-    0xC0, 0x10, 0xF4, 0x31, 0x8B, 0x51, 0xED, 0x9C, 0x82, 0xFF, 0x10, 0x10, 0x55, 0x0B, 0x16, 0x7C,
-    0x7A, 0x1A, 0x57, 0xC5, 0x33, 0x7D, 0xD4, 0xCC, 0x49, 0xF6, 0xCA, 0x34, 0xAA, 0x93, 0x97, 0x87,
-    0xB8, 0x8A, 0x6B, 0xB9, 0x24, 0x6C, 0x33, 0x40, 0xEA, 0x82, 0xD9, 0xB2, 0x98, 0xF4, 0x53, 0x47,
-    0xBA, 0x2F, 0xCC, 0x85, 0x98, 0xCA, 0x8A, 0x3A, 0xA2, 0x80, 0x37, 0xA3, 0x92, 0x87, 0x2A, 0xD8,
-    0xB5, 0x27, 0x56, 0x8A, 0x67, 0xB5, 0xC4, 0x3C, 0xCB, 0x64, 0x3D, 0x1F, 0x0D, 0x85, 0xD1, 0x85,
-    0x74, 0x13, 0x2E, 0x44, 0x9B, 0xF9, 0x2C, 0xD8, 0xD7, 0x2F, 0x83, 0x31, 0x87, 0x97, 0x4E, 0x91,
-    0xCA, 0x80, 0x34, 0x3C, 0x7E, 0xAF, 0x31, 0xA9, 0x8E, 0x2B, 0x86, 0xDF, 0x3A, 0x14, 0x01, 0x76,
-    0x17, 0x85, 0x87, 0x3B, 0x00, 0xD8, 0x33, 0x17, 0x46, 0x72, 0x62, 0xAC, 0xFD, 0xB8, 0x75, 0xC2,
-    0x54, 0x13, 0xFA, 0xF4, 0xAD, 0x83, 0xBE, 0x5B, 0x4E, 0xFF, 0x9B, 0x13, 0x14, 0xA3, 0x4C, 0x26,
-    0xE8, 0xCF, 0xD9, 0xB0, 0x8B, 0x37, 0xC2, 0x2E, 0x3A, 0x13, 0x76, 0xE1, 0xDD, 0x61, 0xB7, 0xC2,
-    0x09, 0xBC, 0xDE, 0xA3, 0x18, 0x64, 0x9C, 0xD8, 0x2F, 0xF0, 0xF8, 0x84, 0xA5, 0x39, 0x5A, 0xCB,
-    0x2F, 0xE7, 0x26, 0x29, 0x8F, 0x37, 0xC8, 0x64, 0x31, 0x75, 0xBD, 0x0E, 0xD8, 0xCA, 0x73, 0x1F,
-    0x06, 0x38, 0x35, 0x3C, 0x6B, 0xA9, 0xA5, 0x01, 0xAB, 0x92, 0x42, 0xD6, 0x3E, 0x1F, 0xE7, 0xF2,
-    0xF1, 0xC4, 0x87, 0x6E, 0x9B, 0x18, 0x96, 0x2E, 0x10, 0x3A, 0x5F, 0x5C, 0xE3, 0xCA, 0xB4, 0x71,
-    0xCF, 0xAB, 0x53, 0xB3, 0x31, 0x68, 0x66, 0x1A, 0x3B, 0x73, 0x9E, 0xC7, 0x19, 0xCE, 0xF2, 0x38,
-    0x85, 0xAD, 0x56, 0x21, 0x2F, 0xCE, 0x40, 0xAE, 0x5C, 0x40, 0xF4, 0x94, 0xC9, 0x9C, 0xF5, 0x98,
-    0xCC, 0x39, 0x8B, 0x78, 0x46, 0x9F, 0x8E, 0x11, 0x4F, 0x9A, 0xF7, 0xFE, 0xB5, 0x12, 0xF0, 0x6C,
-    0x29, 0x16, 0x93, 0x6B, 0xEA, 0x83, 0x1E, 0xB0, 0x2D, 0x81, 0x26, 0x8C, 0x60, 0x56, 0xF1, 0x6D,
-    0x1C, 0xB0, 0x81, 0x4B, 0x62, 0x13, 0x7F, 0x7F, 0x78, 0xE4, 0xDA, 0x03, 0x3E, 0x90, 0x43, 0x2B,
-    0xCC, 0xC9, 0x1E, 0x44, 0x45, 0x37, 0x75, 0x68, 0x45, 0x35, 0x3F, 0xDC, 0x6D, 0x3F, 0xEE, 0x77,
-    0x16, 0xE8, 0x72, 0xC9, 0x55, 0x9A, 0x61, 0x02, 0x59, 0x72, 0xD5, 0xCC, 0x4A, 0xAE, 0xD2, 0xC5,
-    0x92, 0xAB, 0x60, 0x56, 0x72, 0xB5, 0x11, 0xB2, 0x8C, 0x17, 0x8B, 0xB8, 0x54, 0x72, 0x35, 0x3B,
-    0x6E, 0xB6, 0x9B, 0xF9, 0x47, 0xCF, 0x2C, 0x13, 0x6E, 0xF2, 0x87, 0xB5, 0x66, 0xB1, 0xEF, 0xB3,
-    0xB2, 0x3C, 0x3B, 0x61, 0x1F, 0xE6, 0x32, 0x98, 0xED, 0xB0, 0x0F, 0x72, 0x91, 0x18, 0x17, 0xC2,
-    0xDE, 0x47, 0xFB, 0x42, 0xD8, 0x7B, 0x68, 0x81, 0x7B, 0xD5, 0x17, 0xDE, 0x56, 0xAC, 0x39, 0xC7,
-    0xE9, 0x10, 0xAE, 0xB6, 0x89, 0x99, 0x4B, 0xF1, 0xEB, 0x78, 0x8C, 0x6C, 0xEF, 0x71, 0x8D, 0xEF,
-    0x6D, 0x29, 0x38, 0xCE, 0x4D, 0x26, 0xC8, 0x91, 0x6F, 0x44, 0xB4, 0x9E, 0x4D, 0xDE, 0x69, 0x44,
-    0x17, 0x6D, 0x24, 0x35, 0x8A, 0x40, 0xCF, 0x98, 0xE6, 0xEE, 0xA4, 0x3E, 0x05, 0xFD, 0x86, 0x34,
-    0xB1, 0x5B, 0x68, 0x5C, 0x7D, 0x65, 0x52, 0x0C, 0x26, 0x55, 0xD3, 0xC6, 0x32, 0xE2, 0x72, 0x31,
-    0xE0, 0x6A, 0x8E, 0xF4, 0xB3, 0x67, 0xFA, 0xED, 0x69, 0xB0, 0x00, 0x38, 0x30, 0x24, 0xE3, 0x81,
-    0x21, 0x62, 0xB9, 0x04, 0x3C, 0x12, 0xC4, 0xBF, 0x21, 0x65, 0x6D, 0x01, 0x4E, 0xC1, 0xC2, 0x81,
-    0x21, 0x57, 0xE6, 0x07, 0x86, 0x1C, 0x9E, 0x3C, 0xBC, 0x70, 0x30, 0xC8, 0x7E, 0x6A, 0x4E, 0x76,
-    0xD9, 0x1A, 0x0F, 0x0C, 0x99, 0x1F, 0x74, 0x69, 0xDD, 0xEA, 0x8B, 0xF4, 0x85, 0x05, 0xAA, 0x66,
-    0x55, 0xB1, 0x53, 0x11, 0x19, 0xDA, 0x9C, 0x25, 0x83, 0xE3, 0x12, 0x16, 0x89, 0x20, 0x22, 0x81,
-    0xB4, 0x5B, 0xF0, 0xE2, 0x4E, 0x65, 0x2D, 0xEF, 0xDF, 0x9C, 0x3B, 0x82, 0x46, 0x6F, 0x90, 0xBA,
-    0x8B, 0x87, 0xA0, 0x5E, 0x15, 0xD2, 0x1E, 0xDD, 0x03, 0x69, 0x3F, 0xDB, 0x59, 0x2A, 0x0E, 0x69,
-    0x38, 0xA7, 0x3A, 0xE4, 0x59, 0x2A, 0x7F, 0xCA, 0xB3, 0x54, 0xF4, 0xC2, 0x59, 0x2A, 0x5B, 0x3C,
-    0x4B, 0x25, 0xF4, 0xF6, 0xD2, 0xE0, 0xAA, 0x67, 0xA9, 0x5C, 0xA7, 0x82, 0xF0, 0x5F, 0x83, 0xFC,
-    0x18, 0x4B, 0xF0, 0x63, 0xE0, 0xBD, 0x4F, 0x67, 0x15, 0x84, 0x1F, 0x83, 0x51, 0x7F, 0x3C, 0x23,
-    0x4B, 0x15, 0x84, 0x09, 0xF7, 0x23, 0xCF, 0xB6, 0xB0, 0x81, 0x9F, 0xAB, 0xB9, 0xFF, 0x0C, 0x75,
-    0x78, 0x0C, 0x6B, 0x61, 0xE2, 0xF0, 0x44, 0xA4, 0x79, 0x44, 0xC7, 0x9F, 0x3F, 0x5C, 0xC5, 0xFD,
-    0xB7, 0x9F, 0x8E, 0x0E, 0xC1, 0x4B, 0x32, 0x1A, 0x1E, 0xBB, 0xDA, 0x7C, 0xA6, 0x54, 0xED, 0x79,
-    0x95, 0xC6, 0x07, 0xE6, 0x08, 0xC6, 0x9B, 0xAB, 0xD2, 0x20, 0x98, 0x8C, 0xF5, 0xA6, 0x16, 0xF4,
-    0x54, 0x8F, 0xF8, 0x15, 0x83, 0x35, 0x03, 0xD7, 0xAC, 0x64, 0x92, 0xBD, 0x8D, 0xC4, 0xAE, 0x66,
-    0x4C, 0x1C, 0x43, 0x81, 0xBE, 0x68, 0x75, 0x99, 0xD0, 0x1D, 0xC4, 0xFE, 0xFB, 0x8B, 0xD2, 0x89,
-    0x60, 0x9A, 0x15, 0x57, 0x26, 0x5B, 0xD3, 0xC8, 0x24, 0xC3, 0x9A, 0xF3, 0x31, 0x0D, 0x8D, 0x5A,
-    0x35, 0x46, 0x5E, 0x29, 0x2A, 0xC6, 0x65, 0x83, 0x44, 0x14, 0xAC, 0xA0, 0x2F, 0x1D, 0x6E, 0xB9,
-    0xDE, 0x35, 0xA0, 0xDA, 0x30, 0x0B, 0xCE, 0xCD, 0x92, 0x5E, 0x68, 0xE9, 0x7B, 0x7D, 0xD8, 0xAC,
-    0x21, 0x29, 0x73, 0x27, 0x14, 0x3C, 0x7A, 0x31, 0x6A, 0xBC, 0x3E, 0xCB, 0x3E, 0xFE, 0xFE, 0x14,
-    0x86, 0xC4, 0xD4, 0xC9, 0xAE, 0x08, 0xDA, 0x8E, 0x97, 0xA3, 0xB8, 0xF2, 0x85, 0x27, 0x30, 0xF9,
-    0x3C, 0x71, 0xB2, 0x01, 0x97, 0xE4, 0x4B, 0xF1, 0x25, 0x1E, 0x90, 0x3C, 0x8E, 0x11, 0x72, 0x72,
-    0x71, 0x8C, 0x2C, 0x94, 0x5B, 0x3B, 0x98, 0x31, 0x7E, 0x73, 0x61, 0x8C, 0x8C, 0x75, 0x73, 0x8C,
-    0x34, 0xDD, 0xAD, 0xD8, 0x31, 0x27, 0xCF, 0x84, 0xE9, 0x3C, 0x0B, 0x25, 0xD8, 0x13, 0x1F, 0xFD,
-    0x7C, 0xF3, 0xF0, 0x0D, 0x33, 0x0F, 0x0E, 0xE7, 0x21, 0xA3, 0x1F, 0x99, 0xDC, 0xD3, 0xCE, 0x84,
-    0xC8, 0x1E, 0xC2, 0xB4, 0xC6, 0xD8, 0xDA, 0xA4, 0xEA, 0xB3, 0xFF, 0xE7, 0x79, 0x2D, 0x97, 0x16,
-    0x53, 0x22, 0x45, 0x94, 0x9E, 0xB4, 0x19, 0x4D, 0x26, 0x29, 0x28, 0x7C, 0xB7, 0xB0, 0xB9, 0x2F,
-    0x96, 0xDB, 0x56, 0x96, 0x0F, 0x34, 0xFF, 0x2D, 0x3A, 0x71, 0x92, 0x6A, 0x9A, 0x00, 0xC1, 0xED,
-    0x4D, 0x76, 0xCF, 0xF0, 0x58, 0x63, 0x14, 0x44, 0x3E, 0x3B, 0x89, 0x65, 0x8C, 0xEE, 0xDD, 0xE6,
-    0xD3, 0x32, 0x3E, 0xA7, 0x0F, 0x95, 0x4E, 0xB5, 0x47, 0x8D, 0xB3, 0xC0, 0xB8, 0xD0, 0xA2, 0x76,
-    0x1E, 0xCB, 0xF0, 0xA7, 0x7B, 0x44, 0x97, 0x75, 0x14, 0x32, 0x96, 0xD1, 0x2D, 0xC6, 0x32, 0xFC,
-    0x59, 0x2C, 0x63, 0xB8, 0x7E, 0x2C, 0x23, 0x0F, 0x36, 0x97, 0x3D, 0xA9, 0x9B, 0xFB, 0xFC, 0x6C,
-    0x3C, 0x8D, 0x65, 0x6B, 0x30, 0x9E, 0x44, 0x38, 0xE5, 0x2A, 0x73, 0xE8, 0x01, 0x4E, 0xFB, 0xF3,
-    0xE1, 0x0E, 0x5F, 0x87, 0x79, 0x0C, 0x3F, 0xDB, 0x3C, 0x7F, 0xA3, 0x11, 0xA4, 0x2A, 0x3A, 0xFF,
-    0x45, 0x9E, 0x0B, 0x0E, 0xD9, 0x4E, 0xDE, 0xF4, 0x05, 0x65, 0xDE, 0xA1, 0xC3, 0x21, 0x37, 0x79,
-    0x38, 0x64, 0x75, 0x68, 0x96, 0xD4, 0xE5, 0xEF, 0x93, 0x00, 0xF1, 0x52, 0x0A, 0xDD, 0xC1, 0x9D,
-    0xCF, 0x71, 0x0E, 0xE7, 0x73, 0x34, 0x87, 0x6C, 0xB1, 0x18, 0xF9, 0x96, 0x5F, 0x4E, 0xCC, 0x83,
-    0xE8, 0xBD, 0x8A, 0xD3, 0xB9, 0x5F, 0xEA, 0x76, 0xBA, 0xEC, 0x52, 0x3A, 0x99, 0x53, 0xFA, 0xDF,
-    0xE7, 0x5A, 0x16, 0x8E, 0x9E, 0xA3, 0xE4, 0xA3, 0x84, 0x7E, 0xF1, 0x24, 0x67, 0xDE, 0xFA, 0x95,
-    0x62, 0x2E, 0x44, 0x57, 0xAC, 0xE3, 0x6E, 0x42, 0x8F, 0x95, 0xD8, 0x17, 0x74, 0xD4, 0x2E, 0x05,
-    0x5C, 0x49, 0xB4, 0xA9, 0x5C, 0xD7, 0xD5, 0xD5, 0xDE, 0xC5, 0x91, 0x7C, 0x74, 0x4A, 0xC3, 0x97,
-    0x4F, 0x77, 0xC9, 0x48, 0x56, 0xE0, 0xC4, 0x8A, 0xC1, 0x3B, 0x49, 0x8A, 0xE3, 0x94, 0x98, 0xCB,
-    0x49, 0xB5, 0x71, 0xCF, 0x1D, 0x98, 0xA5, 0x45, 0xC7, 0xE6, 0x74, 0xC1, 0x99, 0xB9, 0xB1, 0x37,
-    0xE9, 0xC0, 0x44, 0x6F, 0xC6, 0x18, 0xFF, 0xC1, 0x9D, 0x8D, 0xD2, 0x2D, 0xE7, 0x15, 0xEC, 0x8C,
-    0x5F, 0xCB, 0x6F, 0xF5, 0x16, 0xF2, 0x0A, 0x0E, 0x0C, 0x20, 0x67, 0xB7, 0x08, 0x90, 0x87, 0x85,
-    0xDC, 0xC1, 0xFD, 0x20, 0xB9, 0x56, 0xEA, 0x60, 0x01, 0x32, 0x25, 0x59, 0x84, 0xAE, 0x32, 0x95,
-    0x9B, 0x7B, 0x29, 0x52, 0xFB, 0x09, 0xF7, 0x56, 0x25, 0x2C, 0xD4, 0xA3, 0xC6, 0x21, 0x00, 0xDF,
-    0x34, 0x8A, 0xE9, 0x07, 0x2D, 0x0B, 0x96, 0x2F, 0x77, 0xEA, 0xB8, 0x34, 0xBF, 0x12, 0xFB, 0x5A,
-    0x9A, 0x5F, 0x4E, 0xD5, 0xBF, 0x47, 0x33, 0xA8, 0x9F, 0x4B, 0xF3, 0x0B, 0xAD, 0x3E, 0x94, 0xA6,
-    0xD6, 0x0F, 0xFE, 0x02, 0x4D, 0xF1, 0xF2, 0x1B, 0x68, 0xB2, 0x57, 0x5E, 0x42, 0x93, 0xBC, 0xF5,
-    0x14, 0x9A, 0xF8, 0xD3, 0x07, 0xD1, 0x44, 0x3C, 0x28, 0xB4, 0x0E, 0x07, 0x36, 0xC1, 0x94, 0x0D,
-    0xEB, 0x24, 0xDC, 0xC6, 0xC3, 0x16, 0x7B, 0x60, 0xC0, 0x79, 0xB0, 0x7F, 0x9F, 0x68, 0x9C, 0x1D,
-    0x3B, 0x2C, 0x25, 0x26, 0x6D, 0x2C, 0x85, 0x4C, 0xCD, 0x0C, 0xBA, 0xC6, 0x47, 0x37, 0x4B, 0x1A,
-    0xB9, 0x5D, 0xA7, 0xFB, 0xA4, 0xF6, 0x74, 0x9F, 0x45, 0xFB, 0x30, 0x1A, 0x33, 0x69, 0x16, 0x43,
-    0xA7, 0x3B, 0xCB, 0x71, 0xDE, 0x03, 0x02, 0x2F, 0x41, 0x49, 0x6D, 0x8C, 0x30, 0xA9, 0x0A, 0x3F,
-    0x2E, 0x66, 0xBE, 0x84, 0x05, 0x78, 0x3A, 0xA6, 0x0E, 0x9B, 0x14, 0x59, 0x03, 0xE9, 0x4C, 0x02,
-    0xE5, 0x07, 0x04, 0x21, 0x6F, 0xF1, 0x64, 0x9D, 0x57, 0x68, 0xB1, 0x3C, 0xCD, 0x2C, 0xF7, 0x07,
-    0x09, 0x42, 0x98, 0x62, 0x7F, 0x9C, 0xBC, 0xB3, 0x46, 0x36, 0x7A, 0x72, 0x02, 0x97, 0x05, 0x8F,
-    0x90, 0x51, 0x4C, 0x28, 0x77, 0x99, 0x60, 0xEE, 0x31, 0xF5, 0xDC, 0xAF, 0xC0, 0xE8, 0x22, 0xA6,
-    0x7D, 0x7B, 0xC8, 0x7B, 0x2D, 0x8B, 0x66, 0x0D, 0x04, 0xAF, 0x0A, 0xD3, 0xA0, 0x8E, 0x04, 0x51,
-    0x64, 0x22, 0x7F, 0x86, 0x59, 0xE7, 0x1C, 0xB9, 0x10, 0x55, 0xFF, 0x28, 0xC0, 0x8A, 0xAA, 0x59,
-    0x7C, 0x96, 0xC9, 0xD2, 0x87, 0x45, 0x99, 0xC4, 0xBB, 0x40, 0x3E, 0x38, 0x80, 0x66, 0xFE, 0x10,
-    0x44, 0x24, 0xB8, 0xE1, 0xED, 0xDD, 0x60, 0x90, 0xED, 0x70, 0x8A, 0xE0, 0xEA, 0x2C, 0x2B, 0xA8,
-    0xD9, 0xF3, 0x86, 0xDE, 0x9B, 0x72, 0x63, 0x6F, 0x26, 0xD8, 0x9D, 0x9C, 0x01, 0xB7, 0x89, 0x95,
-    0xD7, 0x25, 0xB9, 0x3C, 0x84, 0xC5, 0x8F, 0xCE, 0x73, 0x9A, 0x0E, 0x62, 0xF4, 0x0C, 0x52, 0xF4,
-    0x0B, 0x2D, 0x18, 0x9B, 0x27, 0xA0, 0x0A, 0xFE, 0xC3, 0x34, 0x44, 0xC2, 0xA9, 0x90, 0x84, 0x6B,
-    0xD2, 0x7E, 0x93, 0xB9, 0x96, 0x66, 0x87, 0xB4, 0xB1, 0x35, 0xCF, 0x63, 0xBB, 0x44, 0x3C, 0x86,
-    0x50, 0xF9, 0xB9, 0x69, 0xED, 0xDF, 0x18, 0x51, 0xF1, 0x69, 0x83, 0x23, 0x13, 0x6B, 0xD4, 0xFF,
-    0x6F, 0xFB, 0x7B, 0x83, 0xF7, 0x57, 0xA0, 0xA5, 0x51, 0x65, 0x00, 0x1D, 0x2D, 0x6D, 0x84, 0xD1,
-    0x4B, 0x9B, 0x20, 0x01, 0x17, 0xA0, 0x45, 0xE9, 0xA9, 0xBF, 0xE0, 0x66, 0x71, 0x8A, 0xEE, 0xC8,
-    0x80, 0x31, 0x03, 0xFF, 0xD4, 0xB2, 0x71, 0x1A, 0x19, 0x37, 0x6A, 0xD8, 0x78, 0x6C, 0xAC, 0x32,
-    0xE7, 0x42, 0x29, 0x58, 0x0A, 0x87, 0x69, 0xBD, 0xC8, 0x0C, 0x88, 0xAD, 0x40, 0xCC, 0x3B, 0x4B,
-    0x96, 0xB7, 0x54, 0xEC, 0x26, 0x99, 0x0B, 0x31, 0x18, 0x12, 0xFD, 0x21, 0xB2, 0x69, 0x90, 0xBC,
-    0x93, 0x63, 0x46, 0x46, 0x38, 0x7B, 0xDD, 0x22, 0xF7, 0xC5, 0xC3, 0xE9, 0x65, 0x0B, 0x2D, 0x25,
-    0xFA, 0x38, 0x9F, 0xE3, 0x70, 0x7A, 0x85, 0x60, 0xA5, 0xBB, 0x70, 0x38, 0xFD, 0xF5, 0xB8, 0x1F,
-    0xC9, 0x8E, 0x38, 0x89, 0x30, 0x6C, 0x93, 0x32, 0x46, 0xCC, 0xA2, 0x0C, 0x1B, 0x24, 0x74, 0x17,
-    0x7F, 0xF3, 0x58, 0x5B, 0x20, 0x2D, 0xFD, 0xFD, 0xC9, 0xB9, 0x59, 0x9A, 0x6E, 0x45, 0xEF, 0xFE,
-    0xB9, 0xB0, 0x73, 0x45, 0x59, 0x41, 0xA6, 0x2D, 0x9C, 0x2E, 0xC2, 0xD4, 0x7D, 0x1E, 0x2A, 0x1F,
-    0xFD, 0x75, 0xA4, 0xD5, 0x31, 0xEB, 0x1B, 0x65, 0x7D, 0xF1, 0x3C, 0x24, 0x40, 0xEB, 0x8F, 0x41,
-    0x58, 0x86, 0x78, 0x45, 0x51, 0x8A, 0x99, 0xD8, 0x89, 0xD9, 0x1C, 0xB5, 0x70, 0x38, 0x81, 0x20,
-    0x2E, 0xA2, 0x10, 0x1A, 0x31, 0xD1, 0x07, 0xE8, 0x19, 0x4A, 0x9D, 0x2D, 0x1E, 0x9E, 0x59, 0xCD,
-    0x2D, 0x53, 0x56, 0xCE, 0xC9, 0x50, 0x4E, 0x3E, 0xA4, 0xF3, 0x13, 0x82, 0x71, 0xEF, 0x36, 0x39,
-    0xC4, 0xF6, 0x3C, 0x9A, 0xA8, 0x45, 0x95, 0xA8, 0x7E, 0x7F, 0xAB, 0x41, 0x5E, 0x7F, 0x81, 0x3F,
-    0x06, 0x54, 0xC6, 0x55, 0x8C, 0x83, 0x40, 0xAE, 0x68, 0x63, 0xB6, 0xAF, 0xF0, 0x48, 0x52, 0x19,
-    0xD8, 0x80, 0x63, 0xE1, 0x49, 0xCE, 0xCC, 0xCE, 0x2F, 0xBD, 0xFD, 0x63, 0x82, 0x0C, 0x81, 0x04,
-    0xC1, 0x63, 0x51, 0x7A, 0x1C, 0xC8, 0x38, 0xAD, 0x84, 0x42, 0x75, 0x52, 0xB1, 0xD4, 0x7A, 0xD5,
-    0xDA, 0x55, 0x92, 0x56, 0x7F, 0x7B, 0xAC, 0xCB, 0xB3, 0x26, 0xF7, 0x84, 0xAB, 0x37, 0x6B, 0x36,
-    0x96, 0x97, 0xF1, 0x4E, 0x98, 0x95, 0xA6, 0x63, 0x9A, 0xB5, 0xC5, 0xE8, 0xD4, 0x86, 0xBF, 0x98,
-    0x22, 0x7E, 0x7B, 0xFF, 0x04, 0x83, 0x39, 0x5A, 0x28, 0x33, 0x47, 0x0B, 0xD5, 0xC7, 0x16, 0x7A,
-    0xF1, 0xF9, 0x0F, 0x8A, 0x44, 0x40, 0xDE, 0x3E, 0xDA, 0xF8, 0xF4, 0xF7, 0xE5, 0xEE, 0x61, 0x7E,
-    0x8C, 0xA8, 0xA3, 0x33, 0x69, 0x4B, 0x30, 0xD8, 0x92, 0x41, 0xB1, 0x58, 0x15, 0x35, 0xB2, 0x26,
-    0xA1, 0x50, 0xE3, 0x4C, 0xD9, 0x8B, 0xF2, 0x18, 0x78, 0x8C, 0x8E, 0x37, 0x2D, 0xF2, 0xA0, 0x4F,
-    0xAE, 0x14, 0x35, 0x0F, 0x01, 0x16, 0xE1, 0x74, 0xD7, 0x64, 0x72, 0x5E, 0xFA, 0xD6, 0x85, 0x38,
-    0x10, 0xEB, 0x27, 0x8F, 0xD6, 0xA1, 0xDC, 0xE8, 0xEB, 0xB4, 0xF5, 0x76, 0x0C, 0x6E, 0xC7, 0x7C,
-    0x46, 0x9B, 0xE6, 0xDE, 0x5F, 0xC5, 0x1E, 0x82, 0x7F, 0x09, 0x7E, 0xA5, 0xC0, 0xD6, 0xEE, 0xFA,
-    0xFD, 0x8A, 0x3C, 0x4E, 0xAA, 0xA0, 0xCB, 0xC4, 0xA2, 0x4E, 0xC4, 0x9E, 0x8E, 0xAE, 0xC0, 0x40,
-    0xB8, 0x44, 0xF0, 0xAB, 0x66, 0xF4, 0xF4, 0xE9, 0x2F, 0xC9, 0xDF, 0x15, 0x8A, 0x78, 0x96, 0x16,
-    0xC8, 0xCA, 0xE9, 0x53, 0x5F, 0xD0, 0xD9, 0x2B, 0x4E, 0x8B, 0xCA, 0x33, 0xAF, 0x4F, 0xCA, 0x91,
-    0xAA, 0x36, 0xDC, 0xBB, 0xF7, 0xEF, 0xEC, 0x2C, 0x3C, 0x08, 0x07, 0xE0, 0x2B, 0xF8, 0x4B, 0x6D,
-    0xCF, 0x40, 0x67, 0x3A, 0x8B, 0x89, 0xE1, 0x07, 0x3E, 0x1F, 0x61, 0x4E, 0xFF, 0xED, 0xCB, 0xAC,
-    0x3B, 0x7C, 0x89, 0x98, 0x25, 0xBD, 0xB0, 0xB7, 0x9E, 0xE7, 0x26, 0xCB, 0x82, 0xE7, 0x34, 0xDD,
-    0x47, 0x6F, 0xB1, 0x2C, 0x18, 0xCB, 0x66, 0xE1, 0x5B, 0xEE, 0x34, 0x47, 0x17, 0x6B, 0x1A, 0x17,
-    0x4B, 0x85, 0x3B, 0xD4, 0x22, 0xB2, 0x54, 0x78, 0xFE, 0xB0, 0x47, 0x6F, 0x9A, 0xC3, 0x7D, 0x51,
-    0xA3, 0x88, 0xFA, 0x44, 0xD6, 0x26, 0x2E, 0xA9, 0xEF, 0x5B, 0x1C, 0x25, 0xCD, 0x73, 0x4B, 0x3F,
-    0xF7, 0x28, 0x6F, 0x38, 0x22, 0x8D, 0xB3, 0x40, 0xF4, 0x8D, 0x47, 0xF4, 0xC5, 0xAD, 0xEA, 0x81,
-    0x8E, 0xF7, 0x96, 0x56, 0xF5, 0x33, 0xCE, 0x81, 0x83, 0xB8, 0x2F, 0x6E, 0x6C, 0xC8, 0x22, 0xE6,
-    0xBF, 0xED, 0x87, 0x83, 0x8F, 0xC8, 0x26, 0x68, 0xF4, 0x12, 0xDE, 0x38, 0x88, 0xD3, 0x05, 0xE5,
-    0x06, 0xDD, 0x8C, 0xCE, 0xE4, 0xE6, 0x97, 0xE3, 0x6F, 0xAF, 0xD1, 0xF0, 0x37, 0xE4, 0xDE, 0xD3,
-    0xB3, 0xFA, 0xEF, 0x3F, 0x9A, 0xE4, 0x08, 0x4B, 0x97, 0x02, 0x6F, 0x2E, 0x42, 0x61, 0xED, 0x80,
-    0x4B, 0x5A, 0x93, 0x96, 0xEE, 0x0E, 0x6E, 0x6D, 0xFF, 0xC2, 0x8F, 0xFE, 0x0E, 0x3E, 0xFB, 0x1A,
-    0xB4, 0xE7, 0xEB, 0x60, 0xE6, 0xCB, 0x63, 0x78, 0xCB, 0x24, 0x2F, 0x76, 0x63, 0x58, 0x82, 0xCE,
-    0x06, 0x9E, 0x45, 0x48, 0xF7, 0x64, 0x3C, 0x66, 0xD1, 0xE0, 0x6F, 0x5D, 0x9A, 0x53, 0xF6, 0x04,
-    0x54, 0xB0, 0xA2, 0xFD, 0x8D, 0xE9, 0x8C, 0x9A, 0x57, 0x16, 0x7E, 0xBE, 0x14, 0xD3, 0xB5, 0x2D,
-    0x20, 0xCC, 0x99, 0x46, 0x95, 0x21, 0xFC, 0x75, 0xFE, 0x73, 0x27, 0x26, 0x4E, 0x3D, 0x02, 0x33,
-    0xC9, 0x99, 0x52, 0x5B, 0xB6, 0x19, 0x6B, 0x3B, 0x71, 0x93, 0xF0, 0x69, 0x7C, 0xF6, 0x90, 0xF3,
-    0xA5, 0xFA, 0x4B, 0x7F, 0x6A, 0xE5, 0x94, 0x98, 0x96, 0xE1, 0x3B, 0xB0, 0x29, 0x5E, 0x81, 0x0E,
-    0x45, 0x91, 0x7C, 0x0F, 0x75, 0x7F, 0xEA, 0xD0, 0x1D, 0x9C, 0x43, 0x63, 0x78, 0x18, 0x73, 0xC3,
-    0xD0, 0x7D, 0x26, 0xC7, 0x9D, 0xFD, 0xBB, 0x22, 0xEA, 0x24, 0x60, 0x6A, 0x86, 0xB8, 0x14, 0xC9,
-    0xF1, 0xA5, 0xE2, 0xE9, 0x83, 0x3E, 0x6B, 0xF7, 0x7A, 0x35, 0x3E, 0x6E, 0x79, 0xFD, 0x2A, 0x9E,
-    0xCF, 0x54, 0xE3, 0xF3, 0xDE, 0x78, 0xD2, 0x8A, 0x3B, 0xCF, 0x90, 0xDF, 0x93, 0x1C, 0xBF, 0xAA,
-    0x96, 0x0F, 0xD9, 0x0C, 0x96, 0x4B, 0x80, 0x4E, 0x7D, 0xD6, 0x7A, 0x25, 0x85, 0x82, 0x68, 0xB0,
-    0x80, 0x63, 0x1F, 0xAA, 0x59, 0xA8, 0x50, 0x0C, 0xF8, 0xC7, 0xF9, 0x54, 0x58, 0x0F, 0x0B, 0x8D,
-    0x9F, 0x9F, 0xD9, 0x6F, 0x6B, 0x7E, 0xE9, 0xFE, 0x52, 0x87, 0x32, 0x3C, 0x21, 0xDF, 0xF2, 0xB0,
-    0x09, 0x53, 0x9A, 0x34, 0x92, 0xE3, 0x6E, 0xBD, 0xCF, 0xAC, 0xBC, 0xCD, 0x07, 0xFC, 0xDE, 0xB6,
-    0x12, 0x31, 0x9B, 0xA7, 0xF2, 0xF5, 0xD1, 0xE3, 0xFD, 0x95, 0x7E, 0x0C, 0xDB, 0x63, 0xBB, 0xDF,
-    0x7A, 0x01, 0xD9, 0x79, 0x9B, 0x15, 0x79, 0xC2, 0x66, 0x69, 0x89, 0xE8, 0xFB, 0xB6, 0x39, 0xCC,
-    0x0B, 0x96, 0xE2, 0x9D, 0x4F, 0x66, 0x5B, 0x4C, 0x60, 0x33, 0x71, 0xC7, 0xCB, 0xB3, 0x3C, 0x40,
-    0x1C, 0x47, 0x71, 0x70, 0x69, 0x6C, 0x2D, 0xD2, 0xD8, 0xFA, 0xD9, 0x7E, 0x3C, 0x31, 0xA6, 0xB1,
-    0x7D, 0xBB, 0x1D, 0xDD, 0x4B, 0x61, 0x7E, 0x6B, 0xF3, 0xE1, 0xFC, 0x4C, 0x5F, 0x39, 0x67, 0xCF,
-    0x59, 0xFF, 0x1C, 0xF3, 0x51, 0x5E, 0x7F, 0xAC, 0x2B, 0x8F, 0xE9, 0xBF, 0xB1, 0x87, 0xA9, 0x79,
-    0x06, 0xD8, 0xDE, 0x28, 0x65, 0xEF, 0xFF, 0x03, 0xD5, 0x5A, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E,
-    0x24, 0x25, 0xD1, 0x11, 0x81, 0x32, 0x08, 0x94, 0x21, 0x31, 0x12, 0x76, 0xC8, 0x10, 0xCB, 0x88,
-    0xB9, 0x16, 0x89, 0x64, 0x32, 0x2D, 0x50, 0x0F, 0x5D, 0x34, 0x38, 0xE8, 0xE8, 0x0E, 0x1D, 0x0A,
-    0x2F, 0x5A, 0x3B, 0xD8, 0x22, 0xEB, 0x02, 0x31, 0xD0, 0xC5, 0xDA, 0xBA, 0x7A, 0xE8, 0x60, 0x6B,
-    0xA8, 0x33, 0xBA, 0x85, 0x13, 0x12, 0x09, 0xD0, 0x02, 0xCD, 0x50, 0xA2, 0x40, 0xD1, 0x31, 0x04,
-    0xEA, 0xA2, 0x68, 0x3C, 0x98, 0x6D, 0x68, 0x94, 0x92, 0x49, 0xDE, 0x9E, 0xEF, 0x5C, 0xF2, 0x51,
-    0x2F, 0xFE, 0x89, 0xE2, 0xBE, 0xF7, 0x44, 0x51, 0xEF, 0x1D, 0xBD, 0xF7, 0xC8, 0x7B, 0xEE, 0x39,
-    0xDF, 0x3D, 0xF7, 0xFC, 0xDC, 0x7B, 0x89, 0x82, 0x94, 0xF8, 0x8A, 0x72, 0xD0, 0xA4, 0x00, 0x55,
-    0x25, 0x13, 0xE3, 0x41, 0xC5, 0xD4, 0xFA, 0x5B, 0x0D, 0xFA, 0x59, 0xC3, 0xD4, 0xB9, 0xA6, 0x98,
-    0xBA, 0xEF, 0x83, 0x7A, 0xA4, 0x42, 0xA2, 0x73, 0x94, 0x70, 0xE3, 0x4D, 0x8A, 0x98, 0xEE, 0xEC,
-    0x25, 0xCC, 0x42, 0x29, 0xC5, 0x2C, 0x4A, 0xF2, 0x0A, 0x32, 0x0B, 0x72, 0x2B, 0xB2, 0x72, 0x72,
-    0x6A, 0xB2, 0x33, 0xB2, 0x1B, 0x72, 0x53, 0xB2, 0x15, 0x25, 0xFB, 0xB4, 0xAD, 0x72, 0xD5, 0x52,
-    0xA2, 0xA4, 0x37, 0x5C, 0x4B, 0x42, 0xA3, 0x58, 0x7A, 0x17, 0x79, 0x12, 0xA1, 0x7E, 0xA8, 0xEF,
-    0x1B, 0xDC, 0xC8, 0x55, 0x2A, 0xF6, 0xF2, 0x28, 0xF5, 0xB2, 0x20, 0xB7, 0xD3, 0x80, 0x3B, 0xC3,
-    0x3B, 0xCA, 0x57, 0x94, 0xCA, 0xFD, 0xFD, 0x28, 0x8F, 0xF8, 0xF7, 0x24, 0x1D, 0xDE, 0x51, 0xA6,
-    0x8A, 0x40, 0x7D, 0xB1, 0xEF, 0xB4, 0x6E, 0x4B, 0x5B, 0x60, 0x02, 0x86, 0x19, 0x37, 0x2B, 0x74,
-    0x53, 0x0F, 0xDD, 0x6D, 0xEF, 0x82, 0xFF, 0x63, 0x68, 0x4C, 0xBB, 0x95, 0x74, 0x26, 0xD4, 0x16,
-    0xD9, 0x5C, 0xE9, 0xDF, 0xA5, 0xE1, 0x3A, 0x76, 0xB4, 0x20, 0xF9, 0x01, 0x77, 0xB6, 0x75, 0x8F,
-    0xBF, 0x70, 0x77, 0x36, 0x7F, 0x77, 0x98, 0xBB, 0x3D, 0x43, 0xA4, 0xF8, 0xFA, 0xD9, 0x04, 0x8A,
-    0xF5, 0x6B, 0x50, 0x36, 0xF9, 0x0F, 0xF7, 0x61, 0x3E, 0xC2, 0x0F, 0x76, 0x76, 0x9E, 0xE9, 0x2A,
-    0xAD, 0x8C, 0x06, 0x95, 0x75, 0x7E, 0x5F, 0x21, 0x2F, 0x2F, 0x28, 0xD8, 0x8F, 0xA9, 0xDE, 0xE1,
-    0x16, 0x6E, 0x6C, 0x84, 0x46, 0x38, 0x2B, 0x44, 0x0C, 0xB1, 0x12, 0x43, 0xAC, 0x84, 0xAE, 0xAC,
-    0xC3, 0x70, 0x5E, 0x12, 0x3D, 0xCD, 0xFD, 0x11, 0x22, 0x72, 0x86, 0x84, 0x17, 0x04, 0xBB, 0x8E,
-    0xEE, 0x6E, 0x80, 0x77, 0x00, 0x73, 0xAF, 0xB8, 0x21, 0xEB, 0xD3, 0x8D, 0x31, 0x6D, 0xB7, 0x21,
-    0x59, 0x0C, 0x01, 0xD9, 0x15, 0xB3, 0xB6, 0x4B, 0xE6, 0x6C, 0x14, 0x2E, 0x9A, 0x08, 0xF1, 0xF8,
-    0x6B, 0xA2, 0x2A, 0x72, 0xDA, 0x4B, 0x15, 0x79, 0xB8, 0xEB, 0x17, 0x53, 0xC4, 0x2B, 0x83, 0x9A,
-    0xB1, 0xFD, 0x6F, 0x1B, 0x9A, 0xEA, 0x97, 0x2A, 0xA6, 0x35, 0xCD, 0xD6, 0x11, 0xB4, 0xDE, 0xD0,
-    0xF6, 0x5A, 0x0C, 0x26, 0xF4, 0xD5, 0x78, 0x4D, 0xC8, 0xE6, 0xBE, 0x56, 0xAF, 0x30, 0xC7, 0x0D,
-    0x6D, 0x46, 0xD5, 0x5C, 0xCC, 0x88, 0x8C, 0xFD, 0x15, 0x66, 0xE6, 0xA8, 0x87, 0xD0, 0xE0, 0x52,
-    0x0B, 0xCF, 0x67, 0xFC, 0x06, 0xDC, 0xC5, 0xA4, 0xB4, 0xDE, 0xC6, 0x48, 0x27, 0x19, 0xB7, 0xF9,
-    0x7E, 0xCA, 0xD6, 0x92, 0xDA, 0xD7, 0x15, 0xFB, 0x52, 0x1E, 0x6B, 0x0F, 0x00, 0x70, 0xE7, 0xF3,
-    0x40, 0x8A, 0x5E, 0x0D, 0x07, 0x6D, 0x45, 0x4F, 0xAB, 0x80, 0x86, 0x4E, 0xEA, 0x33, 0x5D, 0xE6,
-    0xBF, 0xF1, 0xE0, 0x32, 0xB9, 0x94, 0xA8, 0xAF, 0xE2, 0x09, 0xA5, 0x1D, 0x90, 0x65, 0x56, 0xC8,
-    0x67, 0x91, 0x22, 0x16, 0xA5, 0x8E, 0xE6, 0x60, 0x55, 0x4F, 0x0B, 0x6C, 0x1A, 0x45, 0x53, 0x24,
-    0xB4, 0x80, 0x90, 0xB1, 0xBA, 0x24, 0x1F, 0x37, 0x41, 0x55, 0x2D, 0xF2, 0x16, 0x03, 0xD2, 0x63,
-    0xC0, 0x92, 0xA7, 0x82, 0x51, 0x88, 0xB8, 0xE6, 0x87, 0x2F, 0x91, 0xC5, 0x53, 0xC0, 0x80, 0xA0,
-    0x10, 0x64, 0x79, 0x96, 0xE1, 0x6D, 0x6B, 0x88, 0xF3, 0xB4, 0x49, 0x27, 0x02, 0x1B, 0x78, 0x09,
-    0x44, 0xFC, 0x73, 0x34, 0x67, 0x6C, 0x5E, 0x15, 0x5E, 0xEF, 0x89, 0xAE, 0xAF, 0x64, 0x12, 0x44,
-    0xC4, 0x7A, 0xBE, 0x33, 0x76, 0x84, 0x5E, 0x67, 0x2E, 0xEF, 0xB1, 0xC0, 0x46, 0x2E, 0x22, 0x9B,
-    0xBF, 0x9A, 0x27, 0x4A, 0x77, 0x57, 0x05, 0x87, 0xDF, 0x02, 0x9E, 0xCF, 0x6B, 0x99, 0x83, 0x37,
-    0x85, 0x6A, 0x94, 0x36, 0x30, 0xF5, 0x0E, 0xEA, 0x01, 0x87, 0xF1, 0xCC, 0x31, 0xBE, 0x1A, 0x87,
-    0x4C, 0xA5, 0xC8, 0xFA, 0x63, 0x2D, 0x73, 0xC1, 0x08, 0x97, 0xC8, 0xCC, 0xDE, 0x61, 0x5E, 0xFC,
-    0x3D, 0x9A, 0x31, 0x52, 0x1A, 0x11, 0x3B, 0x7E, 0x13, 0x5A, 0xFD, 0xE3, 0x63, 0xE0, 0xA2, 0xAD,
-    0x27, 0x11, 0xFD, 0x97, 0x69, 0x5C, 0x7E, 0xFC, 0x79, 0x85, 0x88, 0xC1, 0xD2, 0xDA, 0xA9, 0x4B,
-    0xD6, 0xA3, 0x1D, 0x6D, 0x55, 0xB3, 0xC7, 0xEA, 0x09, 0x3F, 0x1E, 0xB0, 0x1E, 0xA9, 0x0F, 0x62,
-    0x2A, 0x8E, 0x7D, 0x06, 0x8F, 0xDA, 0x84, 0x18, 0xB1, 0xA1, 0x24, 0xD2, 0x0C, 0x84, 0xA5, 0xEA,
-    0xC8, 0xD7, 0x6E, 0x74, 0x64, 0x0B, 0xA4, 0x10, 0xC2, 0xFC, 0xCC, 0xE2, 0x2C, 0x60, 0x0A, 0x34,
-    0x56, 0x72, 0xBD, 0x8C, 0x07, 0x5B, 0xB1, 0xED, 0x9E, 0xD0, 0xC7, 0xDD, 0xBD, 0xA8, 0x42, 0xB2,
-    0x18, 0xBA, 0x65, 0x90, 0xFA, 0xB9, 0x57, 0x04, 0xA9, 0x5B, 0x44, 0xA9, 0x5B, 0x26, 0x7F, 0xBD,
-    0x54, 0x26, 0x4A, 0x95, 0xC9, 0x97, 0x7B, 0x37, 0x01, 0x16, 0xC6, 0x20, 0xD0, 0x5A, 0xDC, 0x74,
-    0x2B, 0x33, 0xB7, 0x59, 0x78, 0x4A, 0x98, 0xA7, 0x11, 0x6A, 0x15, 0x79, 0x48, 0x38, 0x7D, 0xD4,
-    0x6F, 0x27, 0xEB, 0xFA, 0xB3, 0x1F, 0x72, 0x33, 0xCB, 0xCE, 0x24, 0xF5, 0x01, 0x0E, 0xB1, 0xE4,
-    0xF4, 0x7C, 0x7D, 0xAF, 0x37, 0x8F, 0x85, 0x42, 0x01, 0xFC, 0x7F, 0x5F, 0x1F, 0x2A, 0xB3, 0x8A,
-    0xAE, 0xCC, 0x0A, 0x67, 0x0B, 0x06, 0xF9, 0x39, 0xCF, 0xBC, 0xA8, 0xE5, 0x6E, 0x0E, 0x38, 0xD5,
-    0xA6, 0xC2, 0x2F, 0x3A, 0x4B, 0x58, 0xAC, 0xCE, 0x2F, 0xE3, 0x09, 0x23, 0xB7, 0xD4, 0x83, 0xCC,
-    0x79, 0xA8, 0x52, 0xD7, 0x44, 0x9B, 0xB5, 0xD9, 0xE9, 0x4A, 0xB4, 0x82, 0x11, 0x75, 0x63, 0x32,
-    0x6F, 0xBF, 0x89, 0x14, 0xF8, 0x2D, 0x36, 0x84, 0x1B, 0xDC, 0xE2, 0xAA, 0xC5, 0x0A, 0xFF, 0x84,
-    0xFF, 0x16, 0x3E, 0xC8, 0x4F, 0xA9, 0x1A, 0xBD, 0x49, 0x62, 0x36, 0x0B, 0xA5, 0x5F, 0x97, 0x3A,
-    0x0C, 0xEC, 0xAC, 0x4F, 0x6F, 0x33, 0xFD, 0xB5, 0x38, 0xAC, 0x89, 0xD2, 0x3F, 0xE5, 0xBF, 0xC5,
-    0x2A, 0x7D, 0xA6, 0xAB, 0x0B, 0xA5, 0x2C, 0xBC, 0xD1, 0xEA, 0xA2, 0x10, 0x35, 0x61, 0x5F, 0x12,
-    0x7A, 0x2D, 0x3C, 0x67, 0x66, 0x35, 0x6E, 0xE1, 0x54, 0x76, 0xED, 0x16, 0x56, 0xED, 0x15, 0x56,
-    0xE3, 0x3F, 0xFA, 0x71, 0xC3, 0xF2, 0x35, 0xFE, 0xC1, 0xDE, 0x2D, 0xD8, 0x27, 0x66, 0xB0, 0xCB,
-    0xBE, 0xD9, 0xAD, 0xE9, 0x6D, 0xAB, 0xA5, 0xBB, 0x06, 0x00, 0xF5, 0x91, 0xF1, 0x0A, 0x9B, 0xDF,
-    0x81, 0x7C, 0x01, 0xBD, 0x79, 0xC6, 0x98, 0xB7, 0xCF, 0x61, 0xB8, 0xDF, 0x3E, 0xEE, 0xE1, 0x9E,
-    0xAA, 0xF0, 0xF2, 0xA1, 0xC2, 0x9B, 0xED, 0x90, 0x93, 0xB7, 0xFB, 0x16, 0xA6, 0x33, 0x77, 0xF6,
-    0x08, 0xBD, 0x6E, 0x21, 0x2B, 0x31, 0x31, 0xF8, 0xF6, 0xF4, 0xE0, 0x2F, 0x06, 0x02, 0xEB, 0xEB,
-    0x6E, 0x6D, 0xAA, 0x84, 0xBB, 0xF8, 0xCC, 0x12, 0x6E, 0x36, 0xEE, 0xED, 0x62, 0x1F, 0x42, 0x5C,
-    0xC4, 0x68, 0xFF, 0x47, 0xFC, 0xE0, 0x3D, 0x14, 0x24, 0x5B, 0x12, 0x66, 0x16, 0xEE, 0xD2, 0x9F,
-    0x1D, 0xDD, 0x9E, 0x53, 0xA0, 0xCD, 0x36, 0xEA, 0x95, 0x93, 0xA8, 0xC7, 0x62, 0x70, 0xC8, 0xB3,
-    0xAC, 0x0C, 0xE1, 0x8E, 0x83, 0xDD, 0x46, 0x17, 0xE8, 0x02, 0x55, 0xFB, 0xAA, 0x32, 0x55, 0x08,
-    0x08, 0x8E, 0xFC, 0xE2, 0xE7, 0xCF, 0xAA, 0xFB, 0x81, 0x64, 0x56, 0x4E, 0x43, 0x5E, 0x42, 0xA7,
-    0xD8, 0xEF, 0x70, 0xA5, 0xDC, 0x48, 0x41, 0x25, 0x69, 0xFC, 0xE5, 0x5B, 0x14, 0x35, 0xB8, 0x6B,
-    0x3D, 0xF7, 0x65, 0xB7, 0x9C, 0x15, 0xED, 0x26, 0x00, 0xEE, 0xFF, 0x95, 0x04, 0x78, 0xCB, 0x2F,
-    0xFC, 0x02, 0xCE, 0x5B, 0x64, 0xD5, 0x48, 0xBF, 0xF8, 0xA5, 0x57, 0x3D, 0x5E, 0x40, 0x2A, 0xDD,
-    0x6A, 0xC2, 0xC7, 0xAC, 0xFA, 0xCC, 0xCD, 0x91, 0x64, 0x31, 0xE2, 0xA1, 0xE2, 0x1E, 0x11, 0xBE,
-    0xED, 0x1A, 0x3E, 0x8A, 0x5F, 0xFC, 0x81, 0x41, 0x67, 0x26, 0x3C, 0x36, 0x96, 0xDC, 0xE2, 0x07,
-    0xA2, 0x81, 0x86, 0x4F, 0xD0, 0xEE, 0x19, 0xFD, 0x3C, 0xDA, 0xB6, 0x1D, 0x1F, 0x47, 0x78, 0x9A,
-    0x2D, 0x47, 0x6D, 0xCE, 0x0C, 0xBF, 0x84, 0xC7, 0x73, 0x54, 0x35, 0x94, 0x4D, 0x3A, 0x7D, 0x4C,
-    0xC2, 0x21, 0x7D, 0xD4, 0x74, 0xA7, 0x97, 0x72, 0x7B, 0x1F, 0xD6, 0xC4, 0xF6, 0xE3, 0x15, 0x7E,
-    0xEE, 0x54, 0x41, 0x6A, 0xD7, 0x51, 0x6A, 0x35, 0xC9, 0xF0, 0x6E, 0xF1, 0x1F, 0xBF, 0xE1, 0x5E,
-    0x90, 0x39, 0x95, 0x5B, 0xB8, 0x85, 0xDD, 0x26, 0xD9, 0xA1, 0x50, 0xCA, 0x33, 0xAA, 0xB3, 0x26,
-    0x8F, 0xDF, 0x4E, 0xDE, 0xF7, 0x69, 0x2A, 0x7C, 0x34, 0xAE, 0x15, 0x43, 0xE9, 0x7F, 0x5A, 0xC6,
-    0xFE, 0x9C, 0x34, 0x7A, 0x67, 0xC8, 0xB5, 0x47, 0x81, 0x16, 0x69, 0x1D, 0xCE, 0x73, 0x4E, 0xFF,
-    0x5D, 0xAC, 0x76, 0x5D, 0x65, 0xA1, 0x4B, 0xBD, 0x5A, 0x61, 0xC5, 0x33, 0xC5, 0xEB, 0xE6, 0x04,
-    0x90, 0xCB, 0x17, 0x52, 0x38, 0x8B, 0x3F, 0xC1, 0x88, 0xBE, 0x2A, 0x24, 0x23, 0x41, 0x86, 0xF7,
-    0x1A, 0xFF, 0x8D, 0x0B, 0x9B, 0x75, 0x01, 0xC4, 0x2B, 0x38, 0x3B, 0x69, 0x74, 0xA8, 0x2A, 0x0E,
-    0x79, 0xA5, 0x19, 0xE0, 0x22, 0xF9, 0x18, 0xCA, 0x22, 0x59, 0xA5, 0xBD, 0x0C, 0xBE, 0x67, 0x54,
-    0x36, 0x6E, 0x5C, 0xD6, 0x87, 0x95, 0xED, 0xCF, 0xEA, 0xA9, 0x95, 0xED, 0x7A, 0x7A, 0x65, 0xFB,
-    0x74, 0x1B, 0x22, 0x93, 0x81, 0x50, 0x60, 0x5A, 0x31, 0x43, 0x17, 0x91, 0x81, 0xBD, 0xB0, 0x0A,
-    0xFD, 0x29, 0x12, 0xCB, 0x27, 0xB9, 0x21, 0x8F, 0xB8, 0x25, 0x3F, 0x6C, 0xD5, 0x16, 0xE2, 0xCC,
-    0x1D, 0x38, 0x6C, 0x59, 0xC9, 0xD3, 0x8C, 0x4F, 0x0B, 0xFA, 0xEF, 0xCA, 0x9C, 0xC2, 0x3A, 0x43,
-    0x6F, 0x4E, 0x7F, 0x18, 0xBB, 0x39, 0x21, 0xFB, 0x59, 0xE9, 0xB2, 0x1F, 0x98, 0x54, 0x3D, 0x17,
-    0x93, 0xE2, 0x6E, 0x56, 0x25, 0xDC, 0x7F, 0x02, 0x6F, 0xB3, 0x8D, 0x11, 0x5A, 0x33, 0x65, 0x33,
-    0x40, 0xCC, 0xCB, 0x10, 0x67, 0x68, 0xFD, 0xFD, 0xD8, 0x71, 0xB2, 0x9E, 0xE7, 0x92, 0x24, 0x45,
-    0x7A, 0x8C, 0x14, 0x29, 0x94, 0x55, 0x6E, 0xB8, 0xDA, 0xA0, 0x96, 0x14, 0xC9, 0xCC, 0x67, 0x8C,
-    0x57, 0xD7, 0xAB, 0xE0, 0xA2, 0x9D, 0xB7, 0xF3, 0x97, 0x52, 0x8A, 0x86, 0xAB, 0x12, 0x4D, 0x96,
-    0xE8, 0xE4, 0x84, 0xB7, 0xA9, 0x24, 0x2A, 0x98, 0x4E, 0xA2, 0xE6, 0x16, 0xF6, 0x8C, 0x0F, 0xC4,
-    0x89, 0x35, 0x72, 0x53, 0xB6, 0xE7, 0x3C, 0x91, 0xE8, 0x7C, 0x9F, 0xEF, 0xC9, 0xBC, 0x35, 0x6A,
-    0xE0, 0xC7, 0x7A, 0x01, 0xBF, 0x16, 0xAA, 0x67, 0x9B, 0x82, 0xDF, 0x06, 0xF4, 0x6E, 0x4A, 0x60,
-    0xA0, 0xD2, 0x17, 0xC7, 0xAF, 0x39, 0x22, 0x7E, 0xB2, 0x0A, 0x88, 0x4C, 0x51, 0x76, 0x0A, 0x4C,
-    0xBD, 0xCF, 0x43, 0x21, 0xD6, 0x95, 0x0A, 0xAD, 0xC0, 0xF6, 0xBE, 0x5D, 0x32, 0x52, 0x9F, 0x96,
-    0x0C, 0xD5, 0xBF, 0x81, 0xD5, 0xE3, 0x94, 0x01, 0x61, 0x49, 0x52, 0xF6, 0x47, 0x80, 0x68, 0x42,
-    0x5A, 0xFD, 0x09, 0x90, 0x11, 0x30, 0x23, 0x80, 0x46, 0x40, 0x8D, 0x04, 0x36, 0xC1, 0xAD, 0x33,
-    0x32, 0x01, 0xC1, 0x93, 0x7C, 0xC0, 0x96, 0xC4, 0x8C, 0x5A, 0x1A, 0xB6, 0xD7, 0x8D, 0x51, 0xA1,
-    0xA4, 0xAB, 0x86, 0x66, 0xB2, 0x9D, 0x12, 0xC4, 0x3D, 0x4A, 0xB4, 0x35, 0x57, 0x94, 0x8E, 0x94,
-    0x42, 0xBD, 0x31, 0x32, 0x8B, 0xEA, 0x73, 0x28, 0x49, 0xA2, 0x74, 0x16, 0x85, 0x34, 0x4A, 0xF2,
-    0x28, 0x24, 0x52, 0x21, 0x67, 0x52, 0xF3, 0x45, 0x4D, 0x08, 0x4F, 0x57, 0x08, 0xA2, 0xEE, 0x40,
-    0x92, 0x04, 0xA2, 0xFC, 0xDC, 0xD1, 0x99, 0x79, 0x38, 0x2A, 0xBC, 0xA4, 0x00, 0x54, 0xEF, 0xE7,
-    0xDC, 0xEC, 0x9F, 0x19, 0x61, 0xA1, 0x8B, 0x5C, 0x0E, 0xF9, 0xAC, 0xC3, 0xDA, 0x7C, 0x51, 0xA2,
-    0x91, 0xD9, 0xCD, 0x37, 0x15, 0x2A, 0x61, 0x7F, 0x04, 0x66, 0x9E, 0x88, 0x88, 0x3B, 0xD7, 0xE6,
-    0x0B, 0x87, 0x2E, 0x1E, 0x3D, 0x52, 0xA5, 0xAB, 0xB2, 0x6D, 0x55, 0x3A, 0x6A, 0x17, 0x05, 0x7A,
-    0x2D, 0x65, 0xFA, 0xDD, 0x99, 0x51, 0xAC, 0x6B, 0x96, 0x6C, 0x03, 0x21, 0xEA, 0x62, 0x95, 0xE1,
-    0xF4, 0x4C, 0xA0, 0x00, 0x8F, 0xAD, 0x9A, 0x61, 0x43, 0xC2, 0x78, 0x62, 0x43, 0x22, 0x10, 0x8A,
-    0x4C, 0x73, 0xFD, 0xD6, 0xEA, 0x5E, 0x18, 0xD4, 0xAE, 0x8A, 0x19, 0x64, 0x15, 0x5B, 0x47, 0x20,
-    0xCD, 0x84, 0xB4, 0x06, 0x13, 0x75, 0x41, 0xC5, 0x86, 0x6A, 0x93, 0xFB, 0x14, 0x55, 0x41, 0x35,
-    0x59, 0xEC, 0xED, 0xC3, 0x02, 0x16, 0x4B, 0x0C, 0x10, 0xFA, 0x44, 0xA6, 0xF7, 0xB7, 0x3A, 0xA1,
-    0x34, 0x0E, 0xFC, 0x44, 0x3E, 0x8C, 0xB5, 0x7B, 0x87, 0xE5, 0x3B, 0xE5, 0x76, 0x4B, 0xBF, 0x9D,
-    0x46, 0x22, 0xF8, 0x47, 0xDD, 0x63, 0xF3, 0x82, 0xF3, 0x03, 0x3D, 0x90, 0xAA, 0x5F, 0x2F, 0x10,
-    0x98, 0x74, 0xB1, 0xE3, 0x69, 0x03, 0x5C, 0x1B, 0x16, 0xB8, 0x01, 0x9B, 0x57, 0x26, 0xF1, 0xB6,
-    0xBA, 0xCF, 0xD9, 0x49, 0x0C, 0x55, 0x2B, 0x37, 0x14, 0x8D, 0x5D, 0xAD, 0xF8, 0xA6, 0xFC, 0x4B,
-    0x64, 0xA2, 0x61, 0x2D, 0x43, 0xA3, 0xF1, 0xC2, 0xFF, 0x34, 0x8C, 0x32, 0xCC, 0x40, 0x43, 0x03,
-    0x09, 0x24, 0x53, 0x59, 0x2A, 0xD4, 0xE1, 0xB9, 0xC3, 0x72, 0xF9, 0xE2, 0x90, 0xDD, 0x04, 0x99,
-    0x96, 0xB7, 0xB3, 0x82, 0x10, 0x2F, 0x6D, 0x08, 0x4E, 0x09, 0x24, 0x2F, 0x54, 0x80, 0xF2, 0x17,
-    0xA5, 0x53, 0x33, 0x32, 0x05, 0xE0, 0xBA, 0x96, 0x81, 0xAA, 0x10, 0xF4, 0x3E, 0x09, 0x80, 0x4F,
-    0xA3, 0xCD, 0x21, 0x0A, 0x54, 0x49, 0x60, 0x25, 0x8D, 0xAB, 0x06, 0xB6, 0x43, 0x56, 0x8B, 0xD3,
-    0x27, 0x12, 0x1D, 0xC0, 0x3A, 0x4C, 0xEB, 0xFD, 0x1C, 0xED, 0x3F, 0x4E, 0x02, 0xB4, 0xDA, 0x46,
-    0xF4, 0x49, 0x0D, 0x8D, 0xAC, 0x23, 0x58, 0x1A, 0x1A, 0xDA, 0xB5, 0x45, 0x43, 0xDB, 0xCD, 0xF5,
-    0x6E, 0xB2, 0xF7, 0xB3, 0xBD, 0x3B, 0xA8, 0xA0, 0x65, 0xE9, 0x26, 0x3C, 0x66, 0xFC, 0x89, 0x30,
-    0xDE, 0xC1, 0x15, 0x68, 0x5F, 0xD0, 0x39, 0x03, 0xED, 0x0D, 0xB4, 0x3B, 0x00, 0x93, 0x10, 0x0E,
-    0x61, 0xD1, 0x68, 0xEB, 0x55, 0x68, 0xB3, 0x35, 0x65, 0xD7, 0x51, 0x3D, 0x48, 0x45, 0x48, 0x31,
-    0x07, 0xBD, 0xFF, 0x25, 0xCF, 0x9C, 0x04, 0x98, 0xB5, 0x42, 0xB2, 0x95, 0xA8, 0xF7, 0x12, 0xF5,
-    0x66, 0xA2, 0xEC, 0x26, 0xCA, 0xFA, 0xF3, 0xA2, 0xA1, 0xA5, 0x13, 0x62, 0x9E, 0xC6, 0xE1, 0xA3,
-    0x07, 0x5D, 0xA8, 0xEF, 0x62, 0x7D, 0x77, 0x8C, 0x6A, 0x92, 0xE3, 0x1E, 0x03, 0x84, 0x7D, 0x0D,
-    0x24, 0x29, 0x41, 0x97, 0x13, 0xE8, 0x39, 0xB3, 0x2C, 0xD9, 0xA4, 0x9C, 0xD2, 0xEC, 0x83, 0x5B,
-    0x72, 0x48, 0xE8, 0x21, 0xC5, 0x52, 0x2A, 0x8F, 0x14, 0x25, 0x2A, 0xDF, 0x56, 0xE4, 0xB6, 0x64,
-    0x95, 0x98, 0x8C, 0x96, 0x40, 0xCD, 0xE5, 0x01, 0xB3, 0x74, 0x62, 0xE4, 0x7E, 0x48, 0x20, 0xA2,
-    0x0C, 0x35, 0x4E, 0x50, 0x6C, 0x08, 0xE7, 0xBB, 0x50, 0xB6, 0x2E, 0x64, 0x9F, 0x24, 0x17, 0x19,
-    0xD2, 0xC1, 0x59, 0x3E, 0x83, 0xEA, 0x43, 0x6F, 0x67, 0xD5, 0xBF, 0x04, 0xEF, 0xB6, 0xF7, 0xB0,
-    0x22, 0xB7, 0x40, 0x2C, 0x09, 0x9F, 0x3E, 0x46, 0xDB, 0x99, 0x07, 0xED, 0xED, 0xFD, 0x70, 0x2F,
-    0x56, 0x8C, 0x42, 0xEA, 0x55, 0x3C, 0xF8, 0xAC, 0xD2, 0x3D, 0x64, 0xAF, 0x25, 0x50, 0x2A, 0x30,
-    0x39, 0x73, 0x66, 0x6B, 0xF1, 0x0C, 0x55, 0x3F, 0xC0, 0x36, 0xCB, 0xE7, 0xDC, 0x43, 0xF0, 0x67,
-    0x18, 0x3B, 0xCE, 0x50, 0x7A, 0xC8, 0x39, 0x5C, 0xE8, 0x6F, 0xCB, 0x21, 0x11, 0x7D, 0x4E, 0x90,
-    0xF4, 0xA9, 0x68, 0x1C, 0xF3, 0xD0, 0x07, 0x09, 0x24, 0x48, 0x05, 0x72, 0x98, 0x39, 0x3C, 0x7E,
-    0x4C, 0xA6, 0x8E, 0x9A, 0x1C, 0x3A, 0x32, 0x48, 0xC3, 0x91, 0xC1, 0x79, 0x81, 0xC2, 0x1E, 0xCF,
-    0xC5, 0xC2, 0xA9, 0x7F, 0xBD, 0x05, 0x83, 0x96, 0x41, 0xE1, 0x58, 0xB7, 0xAE, 0xAD, 0x25, 0x41,
-    0xF7, 0xE6, 0xE3, 0x6F, 0xAA, 0x7F, 0xC7, 0x61, 0x58, 0x3A, 0xDB, 0x80, 0xA6, 0x1E, 0x0C, 0xFF,
-    0x94, 0xE4, 0x74, 0xBE, 0x9C, 0x6E, 0xEA, 0xD7, 0x66, 0x29, 0x3B, 0x3E, 0x13, 0x3B, 0x42, 0x5D,
-    0x3C, 0x0E, 0x1C, 0x97, 0xF4, 0xC8, 0x33, 0x0C, 0xEA, 0x80, 0x3B, 0x7D, 0xC0, 0xAC, 0xAC, 0x54,
-    0x2C, 0x61, 0xE9, 0xF8, 0xD0, 0xFB, 0x1F, 0x9D, 0x58, 0x41, 0x6F, 0xDD, 0xC6, 0x11, 0x1E, 0x92,
-    0x96, 0x58, 0x88, 0x35, 0xD8, 0x83, 0x7C, 0x70, 0xDC, 0x9A, 0x39, 0x1A, 0x82, 0x2D, 0xF6, 0x50,
-    0x14, 0x3E, 0xE8, 0x89, 0x6B, 0xEB, 0xD6, 0x1E, 0xAA, 0x43, 0x74, 0x69, 0x0F, 0xF1, 0xA5, 0x17,
-    0xA3, 0x40, 0x72, 0x09, 0xE0, 0x83, 0x9E, 0xC8, 0xF8, 0x0F, 0x54, 0x3F, 0xA0, 0x07, 0x15, 0x48,
-    0x81, 0x58, 0x40, 0xD3, 0x1C, 0x0C, 0x54, 0x08, 0x6C, 0x71, 0x65, 0x1D, 0x72, 0xE8, 0x21, 0x74,
-    0x8C, 0xC2, 0xC7, 0xB2, 0xAD, 0x01, 0x03, 0x09, 0xD0, 0x6C, 0x53, 0xA2, 0xA0, 0x6C, 0xBE, 0xB7,
-    0xF9, 0x66, 0x48, 0x3E, 0xBD, 0xA7, 0xD6, 0xB6, 0xEC, 0xE5, 0xEE, 0x72, 0xDF, 0xEE, 0xEC, 0xEE,
-    0xCC, 0xB7, 0x33, 0xB3, 0xC3, 0x47, 0x3B, 0xFF, 0x37, 0x11, 0xFD, 0xF8, 0xFB, 0x3F, 0xFC, 0x89,
-    0x5F, 0xF8, 0x45, 0x54, 0xFD, 0xF4, 0x77, 0x6E, 0xF6, 0xEA, 0x87, 0xC8, 0xC9, 0xA8, 0xBC, 0xB9,
-    0xF7, 0xD9, 0xDE, 0x4E, 0xF9, 0xFB, 0x6C, 0x87, 0x5E, 0xFD, 0x10, 0xB9, 0x2A, 0xA0, 0xE5, 0x3B,
-    0xCB, 0x9F, 0x04, 0x0B, 0xEE, 0xCF, 0x68, 0xE1, 0xD5, 0xCF, 0xB9, 0x0D, 0x4A, 0xAD, 0x42, 0x5E,
-    0xDA, 0xA5, 0xE9, 0xF6, 0xCD, 0xDD, 0xDD, 0x9D, 0xDC, 0x5A, 0xB3, 0xB1, 0xB1, 0xB1, 0x9E, 0x58,
-    0x3B, 0xE6, 0x82, 0xE5, 0x09, 0x6F, 0x4E, 0x55, 0xFF, 0xA6, 0x2E, 0x2D, 0xED, 0x4A, 0xDA, 0x39,
-    0xD9, 0x4F, 0x74, 0x2B, 0x7C, 0xD3, 0xE7, 0xDC, 0xC6, 0x86, 0xC2, 0x7A, 0x9A, 0xDF, 0xDD, 0xDE,
-    0x9A, 0x0B, 0xDD, 0xF0, 0xCA, 0x50, 0x0D, 0x68, 0x95, 0x52, 0x9D, 0x16, 0x49, 0x11, 0x69, 0xA2,
-    0x8B, 0x2A, 0xD1, 0x49, 0x91, 0x94, 0x41, 0xE1, 0xE9, 0x20, 0xDB, 0xA2, 0x8F, 0x40, 0x3F, 0x47,
-    0x6D, 0x5F, 0x84, 0x3E, 0x5F, 0xC7, 0xB4, 0x47, 0x8A, 0x82, 0x2C, 0x29, 0xD2, 0x22, 0xD5, 0x09,
-    0x0D, 0x28, 0x22, 0xBF, 0xA4, 0x4F, 0x41, 0x78, 0x63, 0xDE, 0x2B, 0x93, 0x50, 0x55, 0x03, 0xB7,
-    0x58, 0xF5, 0xCA, 0xF4, 0xB0, 0x49, 0x1F, 0x8D, 0x92, 0x47, 0xA3, 0xE8, 0xA0, 0xC1, 0xE0, 0xC5,
-    0x6B, 0x55, 0x72, 0xD8, 0x24, 0x8F, 0xC6, 0xC9, 0x3F, 0xC7, 0x41, 0xB1, 0xEF, 0xE9, 0x95, 0x20,
-    0xDB, 0xDB, 0xF2, 0xCB, 0x8F, 0x02, 0x25, 0x7B, 0xAC, 0xCB, 0xE8, 0x08, 0xA3, 0xD1, 0xC3, 0xB1,
-    0xA7, 0x07, 0xBE, 0xDE, 0x8C, 0x1D, 0xB3, 0x17, 0x64, 0x18, 0x06, 0x25, 0x86, 0xB0, 0x5A, 0xFA,
-    0x79, 0x93, 0x78, 0x66, 0xE0, 0x15, 0x91, 0x63, 0xFC, 0x72, 0x8B, 0x3E, 0x0D, 0x3A, 0x74, 0xF6,
-    0x25, 0x0F, 0x89, 0x56, 0x38, 0xAF, 0xAF, 0xCC, 0xB5, 0xF8, 0xFD, 0x61, 0xE5, 0x97, 0xDC, 0x69,
-    0xFB, 0x3C, 0x21, 0xEB, 0x29, 0x4F, 0xE6, 0xAB, 0x74, 0xBC, 0x60, 0x4F, 0x63, 0xF7, 0x79, 0xA9,
-    0x67, 0xC3, 0x3F, 0xD1, 0xA6, 0xF4, 0xDB, 0xD9, 0xE9, 0xC3, 0x7E, 0xE5, 0x21, 0x1D, 0x0D, 0xDF,
-    0x63, 0xD2, 0x7D, 0xAB, 0x56, 0x9C, 0x6E, 0x68, 0x9F, 0x17, 0xF3, 0x6B, 0x8A, 0x2D, 0x70, 0xCF,
-    0x52, 0xAB, 0xDB, 0x9C, 0x58, 0x1D, 0x5B, 0x15, 0x8C, 0x78, 0x74, 0x9B, 0x08, 0x6F, 0x5B, 0x90,
-    0x1D, 0x91, 0xB5, 0x19, 0xD7, 0x05, 0xF7, 0x14, 0xC2, 0xC8, 0x82, 0x62, 0xEC, 0x81, 0x7E, 0xB6,
-    0xA0, 0x16, 0x80, 0x7A, 0x8C, 0x76, 0x62, 0xB8, 0x44, 0x59, 0xA8, 0x17, 0x81, 0x9C, 0xA3, 0x72,
-    0x15, 0x17, 0xA1, 0xC1, 0xAA, 0x65, 0x58, 0x4B, 0x5D, 0xA5, 0x2A, 0xD6, 0x81, 0x69, 0x45, 0x99,
-    0xA3, 0x58, 0x56, 0x88, 0x71, 0xBE, 0x37, 0x3F, 0xFE, 0xEC, 0xE3, 0xD3, 0x58, 0x00, 0x3F, 0x4B,
-    0x77, 0x96, 0x3E, 0x39, 0x8D, 0xEE, 0xCB, 0x43, 0xE9, 0xE8, 0xF8, 0x39, 0x9D, 0x55, 0xA6, 0xA3,
-    0xF7, 0xA9, 0x7D, 0x4E, 0x3F, 0x83, 0xCE, 0xB6, 0xCF, 0x69, 0x67, 0xF4, 0xC9, 0xB1, 0x19, 0x1F,
-    0x08, 0x52, 0xF0, 0xD4, 0x40, 0x83, 0x39, 0x45, 0x07, 0x35, 0xB5, 0x10, 0xC5, 0x59, 0xE3, 0x96,
-    0xD2, 0x4A, 0xD4, 0xC8, 0xD3, 0x7D, 0x2B, 0xC8, 0xFA, 0x56, 0xA8, 0xFA, 0x56, 0x44, 0x7D, 0x6B,
-    0x30, 0xBF, 0x43, 0xF3, 0xDB, 0x3C, 0x77, 0x33, 0x1D, 0x33, 0x6B, 0xE1, 0x41, 0x5D, 0x35, 0xF1,
-    0xB5, 0x26, 0x21, 0xFF, 0xF9, 0xDF, 0xBF, 0xAD, 0xC3, 0xC3, 0x2A, 0xCA, 0x68, 0x7F, 0xED, 0x51,
-    0x15, 0x1E, 0x9A, 0x10, 0x8B, 0xFA, 0x87, 0x55, 0xF8, 0x48, 0x5A, 0xE1, 0x9A, 0x09, 0x1F, 0x4B,
-    0x2B, 0xF2, 0xFA, 0xD6, 0xC0, 0xEB, 0x47, 0x37, 0x5D, 0x9E, 0xC1, 0xD6, 0x58, 0x39, 0x75, 0x74,
-    0xBB, 0x8A, 0x33, 0x72, 0x0C, 0x8D, 0x12, 0x1A, 0xA5, 0x44, 0x5E, 0x49, 0x71, 0x43, 0x49, 0xDD,
-    0x4A, 0xA5, 0x38, 0xCF, 0xA4, 0x63, 0x41, 0x67, 0x64, 0x9D, 0x11, 0x77, 0x46, 0xE2, 0x19, 0xA1,
-    0x67, 0xE4, 0x9E, 0x11, 0x7D, 0x46, 0xFA, 0x29, 0x00, 0x24, 0xF7, 0x18, 0x48, 0x6E, 0x61, 0x50,
-    0x6D, 0xF6, 0x9F, 0xFF, 0x1B, 0x48, 0x3C, 0x90, 0xAC, 0x3B, 0x30, 0x24, 0x17, 0x1D, 0x1E, 0x92,
-    0x8B, 0x16, 0x92, 0xC9, 0x0F, 0x46, 0x65, 0xF2, 0x43, 0x80, 0xE9, 0x7F, 0x30, 0x36, 0x0F, 0x24,
-    0x77, 0xF0, 0x7C, 0x28, 0x59, 0xF7, 0x08, 0x49, 0xEE, 0x40, 0xE2, 0x3C, 0x9A, 0xC6, 0x49, 0x51,
-    0x58, 0x45, 0x06, 0xC6, 0xA0, 0x13, 0x95, 0xB0, 0x71, 0xE2, 0x37, 0xDC, 0x9E, 0x49, 0x75, 0x5C,
-    0xE4, 0x70, 0x7C, 0x96, 0xA5, 0xA2, 0x84, 0x1A, 0x1A, 0x3A, 0xAD, 0xE7, 0xE5, 0x71, 0xAB, 0x40,
-    0x71, 0x60, 0x61, 0x44, 0xF9, 0x75, 0x8C, 0x6A, 0xEB, 0x35, 0x82, 0x58, 0xC5, 0x94, 0x9E, 0x61,
-    0x5A, 0xBF, 0xE8, 0x51, 0x29, 0x62, 0x13, 0x9A, 0xC0, 0x78, 0x95, 0x5B, 0x51, 0xCD, 0xBF, 0xAD,
-    0x8A, 0x4D, 0xAE, 0x43, 0x93, 0xC0, 0x1C, 0x63, 0x0D, 0x51, 0x0A, 0xB7, 0x0A, 0x0A, 0xAA, 0xBD,
-    0xB2, 0xA5, 0xB7, 0x6B, 0x23, 0x02, 0xC5, 0x03, 0x4B, 0x4C, 0x63, 0x89, 0xA9, 0x72, 0x62, 0xBA,
-    0x44, 0x31, 0x65, 0xA4, 0x98, 0x36, 0x9C, 0x52, 0x65, 0x28, 0x81, 0xCD, 0x1C, 0xAB, 0xBD, 0xFF,
-    0x94, 0xFE, 0x97, 0x50, 0x98, 0x3A, 0x52, 0xF7, 0x12, 0x38, 0xF1, 0x4B, 0x74, 0xCF, 0xAD, 0x7C,
-    0x13, 0xB1, 0x78, 0x19, 0xAC, 0xBF, 0x04, 0x6F, 0x35, 0xAD, 0x5C, 0xA2, 0x98, 0x42, 0xED, 0x97,
-    0x5E, 0xED, 0x8C, 0x9C, 0x91, 0xD7, 0xF8, 0x98, 0x12, 0xC1, 0x6B, 0x03, 0x65, 0x40, 0xF2, 0x23,
-    0x08, 0x14, 0x50, 0xAC, 0xD2, 0x22, 0x56, 0x01, 0x66, 0xEE, 0x93, 0x5B, 0x2D, 0xB8, 0xE0, 0xFC,
-    0x3E, 0x05, 0xE0, 0x30, 0x56, 0x50, 0x3E, 0x82, 0xBB, 0x86, 0x1F, 0xBA, 0xFE, 0xDF, 0xFA, 0x2D,
-    0x50, 0xE7, 0x65, 0xCA, 0xB7, 0x41, 0x96, 0xA3, 0xCE, 0x71, 0x03, 0x44, 0xD7, 0x9F, 0x55, 0xCB,
-    0xA0, 0x29, 0xEF, 0x8B, 0x5A, 0xC5, 0x8A, 0x7D, 0x1E, 0x24, 0x74, 0xEB, 0x39, 0x60, 0x10, 0x94,
-    0x89, 0xBE, 0x8F, 0x6E, 0x40, 0xAC, 0x2E, 0xE2, 0x9E, 0x61, 0x67, 0xCF, 0x4B, 0x5A, 0x08, 0xCC,
-    0x85, 0x05, 0xCF, 0x01, 0x6E, 0xFA, 0x21, 0x4A, 0x06, 0xFD, 0x51, 0x63, 0x80, 0x8B, 0x42, 0xA3,
-    0xAE, 0xDC, 0x03, 0xFF, 0x5C, 0x36, 0x69, 0x19, 0xE5, 0x0C, 0x2D, 0x76, 0x3E, 0x6D, 0x11, 0xF4,
-    0xC7, 0x6B, 0xF0, 0xBC, 0x3E, 0xCD, 0xDB, 0x23, 0x4A, 0x9E, 0xD9, 0xC2, 0xEA, 0xB0, 0xB2, 0x59,
-    0xD0, 0xA4, 0xEF, 0x3D, 0x1D, 0x39, 0xF1, 0x63, 0xE0, 0xFC, 0xB8, 0xA1, 0xE8, 0x2F, 0x28, 0x5F,
-    0x18, 0x0A, 0x71, 0xFF, 0x85, 0xD0, 0x0E, 0xD1, 0x3D, 0x30, 0xC4, 0x6A, 0x3E, 0x47, 0xBD, 0xC3,
-    0xC4, 0xC9, 0x40, 0xBF, 0xD2, 0xA2, 0x2D, 0x49, 0xE7, 0x11, 0xDA, 0xFB, 0xBA, 0xBB, 0x93, 0xEF,
-    0xB2, 0x5E, 0x95, 0xAB, 0x6C, 0x65, 0x3A, 0x7C, 0x42, 0x4E, 0x0E, 0xD3, 0x93, 0xC1, 0x0B, 0x76,
-    0x7C, 0xC2, 0x26, 0xE7, 0xAD, 0x85, 0x8F, 0xCF, 0xF9, 0xEA, 0xF7, 0xC7, 0x1B, 0x1B, 0x79, 0xC1,
-    0x08, 0xB8, 0xF5, 0x2D, 0x1E, 0x1B, 0x4C, 0x6C, 0x95, 0xD5, 0x0D, 0xE5, 0x0A, 0xC9, 0xAD, 0x22,
-    0xEB, 0xC3, 0x5C, 0x5D, 0xEC, 0xCF, 0xC6, 0xC9, 0xC0, 0xF1, 0x70, 0x2C, 0xB6, 0x47, 0xF4, 0x67,
-    0xF4, 0x7D, 0x0B, 0x94, 0x0B, 0x83, 0xE1, 0xBB, 0x18, 0x5E, 0xC1, 0xF0, 0x15, 0x3C, 0x21, 0x66,
-    0x07, 0xEA, 0x2E, 0x1D, 0x5B, 0x34, 0x51, 0x23, 0xB5, 0xBA, 0x27, 0x2F, 0xB3, 0xC7, 0xCB, 0x3B,
-    0xA3, 0x0F, 0xD8, 0x36, 0x9C, 0xDC, 0x8A, 0x89, 0xF8, 0x56, 0x78, 0xCE, 0x01, 0x1D, 0x3A, 0xC7,
-    0x1F, 0x08, 0x9A, 0xD5, 0xAD, 0x95, 0x76, 0xDE, 0x19, 0xD4, 0xE7, 0xA8, 0x71, 0xD6, 0xB1, 0x37,
-    0xBD, 0x83, 0x63, 0x7D, 0x7B, 0xD5, 0x71, 0xAE, 0x99, 0xB7, 0x87, 0x57, 0x62, 0xB7, 0x34, 0x55,
-    0xFE, 0x47, 0xBB, 0xD6, 0x3C, 0x6D, 0x2E, 0xD8, 0x23, 0x2C, 0xF7, 0xC4, 0xC1, 0xED, 0x75, 0x61,
-    0xAC, 0xF2, 0x7F, 0xD9, 0xB5, 0xB1, 0xAD, 0xF3, 0xCB, 0xA9, 0x57, 0xFD, 0xA3, 0xBE, 0x3A, 0x58,
-    0x70, 0x0F, 0xCC, 0xFB, 0x50, 0x53, 0xB6, 0x54, 0xAC, 0x02, 0x3D, 0x43, 0x94, 0x84, 0x0D, 0x8F,
-    0x73, 0x27, 0x68, 0xD6, 0x0A, 0xBA, 0xDC, 0xE1, 0xB0, 0xD7, 0xE1, 0x50, 0xBE, 0xD1, 0xB0, 0x1C,
-    0x9B, 0x4E, 0x8E, 0x54, 0x52, 0xC2, 0xD8, 0x5E, 0x9C, 0x41, 0xF3, 0x2C, 0x7B, 0x19, 0x81, 0x61,
-    0x9A, 0xA5, 0x5D, 0xB6, 0x43, 0x6B, 0xE9, 0x57, 0x16, 0xA7, 0xFD, 0xB2, 0x0C, 0x9A, 0xDD, 0x97,
-    0x12, 0xB8, 0x2D, 0xCD, 0xEE, 0xE4, 0x8C, 0x02, 0x0B, 0xA7, 0x05, 0x3D, 0x49, 0x9E, 0x8F, 0xC9,
-    0x7E, 0x53, 0x93, 0xD5, 0xF6, 0xB6, 0x75, 0xD1, 0x56, 0xE9, 0xE1, 0x08, 0x13, 0x52, 0x4A, 0x1E,
-    0x22, 0x32, 0x50, 0x0E, 0xD8, 0x39, 0x43, 0x7C, 0x5C, 0x50, 0x4D, 0x87, 0xDF, 0xB9, 0xE6, 0xD5,
-    0xA4, 0xED, 0xE1, 0x30, 0x7D, 0xD6, 0x6A, 0x58, 0x70, 0x0C, 0x58, 0xF2, 0xA2, 0xD5, 0x16, 0x3E,
-    0x63, 0x56, 0xD5, 0xBA, 0xD3, 0x38, 0xD6, 0x61, 0x36, 0xA4, 0xF5, 0x29, 0x2D, 0xED, 0x7F, 0x63,
-    0x29, 0x78, 0xB8, 0x76, 0x39, 0x56, 0x83, 0x6E, 0x59, 0xCA, 0x81, 0x72, 0x43, 0x27, 0x12, 0xB8,
-    0x06, 0x21, 0x78, 0x46, 0x0D, 0x8E, 0x33, 0xD4, 0x2A, 0xD5, 0xC2, 0x6D, 0x01, 0x39, 0xA5, 0x66,
-    0x4E, 0xB9, 0xCE, 0xE1, 0xD8, 0x78, 0xD9, 0x7D, 0xE1, 0x71, 0x4B, 0x38, 0x1C, 0x0A, 0x7F, 0x43,
-    0xE1, 0x6E, 0x20, 0x79, 0x45, 0x38, 0x59, 0x9C, 0xE2, 0x6A, 0xB1, 0x8B, 0xDE, 0x30, 0x95, 0x99,
-    0x6A, 0x73, 0x2E, 0x9D, 0x53, 0x89, 0x03, 0xAA, 0x8C, 0xEC, 0x81, 0xFD, 0xA6, 0xA2, 0xFC, 0x70,
-    0x0C, 0x96, 0xF3, 0xC3, 0x06, 0xB8, 0xA4, 0xB7, 0xA5, 0xCE, 0xCE, 0x70, 0xAD, 0x18, 0xA9, 0x44,
-    0x04, 0x83, 0x0A, 0x06, 0x0D, 0xD7, 0x11, 0x3B, 0x72, 0xB8, 0x54, 0x98, 0x16, 0x3B, 0xBE, 0x58,
-    0x14, 0x74, 0x59, 0xEA, 0x33, 0x53, 0x08, 0xCD, 0x49, 0x3B, 0xCD, 0x18, 0x1B, 0xAB, 0x31, 0x15,
-    0xF2, 0xF8, 0xA8, 0x53, 0xE5, 0xD5, 0xD3, 0x7C, 0xE4, 0xBB, 0x79, 0x05, 0x53, 0x97, 0x02, 0x6F,
-    0x61, 0x22, 0x14, 0x67, 0xE3, 0x3A, 0xEB, 0x27, 0xDF, 0x79, 0xAC, 0xA3, 0xFA, 0xD8, 0xE5, 0x44,
-    0x9D, 0x49, 0xAF, 0x76, 0x07, 0xB3, 0xD9, 0xA9, 0x74, 0xD5, 0xAA, 0xB5, 0xD3, 0xA9, 0xF6, 0x44,
-    0x48, 0xF6, 0x30, 0xEF, 0x7E, 0x0D, 0x9B, 0xF5, 0x1E, 0x40, 0x7D, 0x5E, 0x56, 0x09, 0x49, 0x8D,
-    0xEA, 0xD9, 0x36, 0x2A, 0xDE, 0xFE, 0xCD, 0xAA, 0x77, 0x1F, 0x1C, 0x89, 0xBB, 0x56, 0x13, 0x5F,
-    0x36, 0x8E, 0xAD, 0x3D, 0x4A, 0xAC, 0xA7, 0x73, 0x14, 0xDB, 0x15, 0x6E, 0xA7, 0x28, 0x89, 0x5D,
-    0x2B, 0x42, 0xD0, 0x38, 0x37, 0x77, 0xEF, 0x00, 0x82, 0x6D, 0x04, 0xC4, 0x35, 0x28, 0x1A, 0x94,
-    0xF1, 0x31, 0xB5, 0xB4, 0x47, 0xFE, 0x81, 0x6D, 0xF8, 0xE3, 0x08, 0xA4, 0x5D, 0x7C, 0x45, 0xF4,
-    0x03, 0x20, 0x71, 0xF5, 0x4A, 0x44, 0xF9, 0x6F, 0x72, 0xF8, 0x87, 0xB1, 0xE2, 0x78, 0x26, 0x86,
-    0x57, 0x82, 0x8F, 0x51, 0x43, 0xF4, 0xC3, 0xF3, 0x08, 0x1D, 0xFC, 0x11, 0x0E, 0x09, 0x0A, 0x07,
-    0xA5, 0x5B, 0x9E, 0x51, 0x84, 0x39, 0x1C, 0x52, 0xCE, 0xAA, 0x88, 0x6B, 0x63, 0x05, 0x97, 0xDC,
-    0xE4, 0x72, 0x66, 0xD7, 0x5C, 0x91, 0xB8, 0xE9, 0x8C, 0xFC, 0x8A, 0x2E, 0x18, 0x42, 0x80, 0x06,
-    0xE7, 0xB8, 0x2A, 0x07, 0xF0, 0x0E, 0x1D, 0xDF, 0x00, 0xAF, 0x9B, 0x16, 0x65, 0xEE, 0x40, 0xD6,
-    0xE1, 0x1B, 0xB0, 0xA1, 0xE0, 0x09, 0xF9, 0x06, 0x7B, 0x7D, 0x85, 0xBD, 0x28, 0xB2, 0x75, 0x4F,
-    0xF5, 0xDA, 0x72, 0x2E, 0xBD, 0x3E, 0x2E, 0x71, 0x66, 0xD2, 0x87, 0x26, 0xFD, 0xB2, 0x4C, 0x0E,
-    0x8B, 0xB7, 0xD6, 0x34, 0x3B, 0x45, 0xE8, 0x5A, 0x28, 0x5E, 0xB1, 0xB5, 0xB0, 0x3D, 0xD1, 0x30,
-    0x43, 0xAE, 0x61, 0xAD, 0xF4, 0xF4, 0xBA, 0xFF, 0x79, 0x13, 0xFE, 0xBC, 0x09, 0x83, 0x26, 0x9A,
-    0x68, 0x73, 0x58, 0x91, 0x49, 0xC6, 0x64, 0x36, 0xE3, 0x03, 0xB3, 0xE7, 0xDB, 0xE2, 0x2E, 0xB6,
-    0x5C, 0x27, 0xB9, 0x0A, 0xF8, 0xB4, 0x62, 0x46, 0xD1, 0xB5, 0x5F, 0xE5, 0xB5, 0xDC, 0xA1, 0xA9,
-    0x48, 0xEF, 0x6B, 0xFE, 0x0E, 0xA4, 0x92, 0xF5, 0x7A, 0x3E, 0xFA, 0x1E, 0x45, 0xBF, 0x40, 0xF0,
-    0xF1, 0xC5, 0x16, 0xE8, 0x6A, 0xFA, 0x75, 0xFE, 0xD7, 0x6D, 0x40, 0x5F, 0xEE, 0xE7, 0x5F, 0x17,
-    0x8E, 0x35, 0x14, 0xFC, 0xED, 0x3E, 0x45, 0xBF, 0x4D, 0x28, 0x88, 0xCE, 0xB6, 0x76, 0x20, 0xE0,
-    0x07, 0x1C, 0xFE, 0x19, 0xB1, 0x4A, 0x79, 0x23, 0xC2, 0x6E, 0x63, 0x1E, 0xB6, 0x50, 0x18, 0x1E,
-    0x0C, 0x0C, 0xEF, 0xF3, 0x7D, 0x58, 0x87, 0xA8, 0xA9, 0xA3, 0xAD, 0xDA, 0x76, 0x17, 0xB3, 0xAD,
-    0x8D, 0x24, 0x68, 0xF3, 0x1B, 0x89, 0xDA, 0x82, 0x4A, 0xC2, 0x36, 0x44, 0x58, 0x1C, 0xB7, 0x21,
-    0xB4, 0xE2, 0xC0, 0x2D, 0xD4, 0x12, 0xB9, 0x45, 0x93, 0xCB, 0xDA, 0xE1, 0x8F, 0x5D, 0x71, 0x75,
-    0xE2, 0xF7, 0xA4, 0xE5, 0xF4, 0x68, 0xC0, 0x75, 0x84, 0x25, 0xB6, 0x8F, 0xF0, 0x99, 0x45, 0x71,
-    0x05, 0x26, 0x42, 0x73, 0xBE, 0x65, 0x81, 0x5D, 0x04, 0x7B, 0x85, 0x6E, 0x2E, 0x57, 0x13, 0x47,
-    0xB9, 0xCC, 0x12, 0x80, 0xB8, 0x9B, 0x66, 0xB9, 0xB5, 0xDC, 0x4A, 0x49, 0x3D, 0xDD, 0xD4, 0x96,
-    0x32, 0xED, 0x86, 0x68, 0x0A, 0x7F, 0xD5, 0x51, 0x28, 0xD3, 0x8C, 0xEC, 0x2B, 0x1C, 0x4C, 0x62,
-    0x40, 0xD6, 0xFC, 0x3C, 0x3B, 0xFF, 0x42, 0x7D, 0xCC, 0xD9, 0x1D, 0xEB, 0x74, 0x22, 0xDC, 0x8B,
-    0x76, 0x3A, 0x91, 0xC0, 0x9B, 0xBF, 0x6D, 0x5F, 0xC8, 0xEF, 0x54, 0x7A, 0x99, 0xD4, 0xE7, 0xDD,
-    0xEC, 0x52, 0x0E, 0x9F, 0x80, 0x62, 0x53, 0xBC, 0x17, 0x3D, 0x7C, 0xA8, 0xF2, 0xF5, 0x8C, 0x02,
-    0x83, 0xB7, 0x5C, 0xC4, 0x1D, 0x76, 0x7D, 0xAB, 0x9E, 0xDE, 0x62, 0x5A, 0x2E, 0x68, 0x0F, 0xFF,
-    0x57, 0xC0, 0x93, 0xA6, 0x3E, 0x2B, 0xA0, 0x50, 0x67, 0xDC, 0x3E, 0xC7, 0xFD, 0x59, 0x9E, 0xAD,
-    0xCA, 0x9C, 0x1C, 0xBD, 0xB9, 0x3A, 0x3F, 0x43, 0x41, 0x53, 0x5F, 0x9B, 0xAF, 0xF1, 0xA5, 0x7A,
-    0xB6, 0x7D, 0x4E, 0x3B, 0x23, 0x69, 0xE2, 0x3A, 0x34, 0x7E, 0xE1, 0xE9, 0xD3, 0xD0, 0xCB, 0x7F,
-    0x54, 0xCA, 0xD3, 0x3E, 0xBE, 0xE2, 0xE3, 0x3A, 0x69, 0x4E, 0x37, 0xC3, 0xCD, 0x82, 0xF2, 0xEA,
-    0xE5, 0xAB, 0x97, 0x11, 0xE9, 0xEB, 0x53, 0xCA, 0x91, 0xBD, 0x9E, 0xE4, 0xDF, 0x01, 0xED, 0x54,
-    0x31, 0x6C, 0xD5, 0x30, 0x10, 0x7D, 0x49, 0xA4, 0x1A, 0xD5, 0x42, 0xC7, 0xC2, 0x06, 0x35, 0x23,
-    0x02, 0x84, 0x59, 0x91, 0x4A, 0x6D, 0xB1, 0x76, 0x80, 0x85, 0xB9, 0xFB, 0x5F, 0xB2, 0xC0, 0x80,
-    0x04, 0xAD, 0x05, 0x03, 0x23, 0x7F, 0x67, 0x68, 0x07, 0x90, 0xE0, 0x33, 0xFC, 0x19, 0xF1, 0xDB,
-    0xB8, 0x30, 0x32, 0x60, 0x04, 0x12, 0x03, 0x03, 0x06, 0x55, 0x80, 0xC4, 0x40, 0x86, 0x0C, 0x81,
-    0xA6, 0x3F, 0x5C, 0xFE, 0x2F, 0x50, 0x04, 0x42, 0x6C, 0x2C, 0xF8, 0xEE, 0xAC, 0xF8, 0xEC, 0x3B,
-    0xDF, 0xBD, 0xBB, 0x18, 0x40, 0xDA, 0x5A, 0xFA, 0x18, 0xF5, 0xF5, 0xD2, 0x9C, 0xAD, 0x4D, 0xD2,
-    0x30, 0xAF, 0x4C, 0x66, 0x93, 0x36, 0xAC, 0x61, 0x3D, 0x7D, 0x0A, 0xC9, 0xD8, 0x4A, 0xAB, 0xFC,
-    0xAC, 0x05, 0x0A, 0xA7, 0x3D, 0xED, 0x21, 0x1D, 0x7A, 0x6B, 0x20, 0x0F, 0xED, 0xB1, 0xE2, 0xF1,
-    0xDA, 0x67, 0x37, 0xBD, 0x24, 0x7F, 0x98, 0xFC, 0xE9, 0xA5, 0x17, 0x45, 0xDB, 0x1C, 0x5C, 0x7A,
-    0xD1, 0xED, 0x0E, 0xB7, 0x30, 0xB8, 0x2D, 0xDB, 0x40, 0x6D, 0xA4, 0x41, 0xDC, 0x8F, 0xB5, 0x43,
-    0xC0, 0x5C, 0x6B, 0xE7, 0x86, 0x11, 0xA2, 0x42, 0x56, 0x9D, 0xC8, 0xAA, 0x05, 0x51, 0x9A, 0x61,
-    0x90, 0x63, 0x60, 0x1A, 0xD3, 0xA2, 0x5F, 0x10, 0xFE, 0x0C, 0x30, 0x02, 0x36, 0xC6, 0x18, 0x2B,
-    0xDF, 0xC8, 0x30, 0x12, 0xE1, 0x8A, 0x08, 0x0B, 0xD2, 0xAB, 0x55, 0x37, 0xF3, 0x19, 0x45, 0x1B,
-    0xDA, 0x36, 0x7C, 0xB9, 0xEF, 0x63, 0xE6, 0x9D, 0xB4, 0x20, 0x80, 0x0D, 0xAE, 0x00, 0x35, 0x92,
-    0x12, 0x59, 0x84, 0x0C, 0x98, 0x75, 0x53, 0x87, 0x8E, 0x5E, 0x96, 0x9A, 0x33, 0xBC, 0x56, 0xE9,
-    0xE7, 0xA5, 0x6C, 0x5D, 0xDA, 0x06, 0xF5, 0xBA, 0xEE, 0x92, 0x44, 0x97, 0xAD, 0xFA, 0x58, 0xF2,
-    0x19, 0x3E, 0x29, 0x6B, 0x98, 0xDC, 0x5E, 0x95, 0x7E, 0x24, 0x7C, 0x23, 0xC2, 0xBA, 0x08, 0x26,
-    0x0F, 0xF2, 0x7D, 0x80, 0xF0, 0x90, 0xFE, 0x14, 0xD9, 0xCB, 0xCB, 0x50, 0x5B, 0xC0, 0xFC, 0x0F,
-    0x36, 0x6D, 0xC3, 0xBC, 0x57, 0xC3, 0x63, 0x57, 0xB9, 0xFB, 0x51, 0x63, 0x32, 0x8E, 0x0D, 0xEE,
-    0x4E, 0x95, 0xD8, 0x87, 0x51, 0x16, 0xC9, 0x2B, 0x6B, 0xB0, 0x97, 0xB4, 0x55, 0x4E, 0x86, 0xB4,
-    0xEA, 0x92, 0xE8, 0x63, 0x1D, 0xDD, 0x2A, 0x2B, 0x99, 0xAA, 0x74, 0x97, 0xBA, 0x95, 0x08, 0xE4,
-    0x17, 0x50, 0xB1, 0x9B, 0x95, 0xA5, 0x08, 0xB5, 0x5D, 0x81, 0x36, 0x6B, 0x86, 0xB9, 0xF9, 0x45,
-    0x74, 0xD8, 0x41, 0x6F, 0x6D, 0xF0, 0x0D, 0xD3, 0xBF, 0xA8, 0x73, 0x52, 0x75, 0x10, 0x2C, 0xD7,
-    0xB8, 0xC4, 0x20, 0xFE, 0x8E, 0x8F, 0x8F, 0xDD, 0xB1, 0x41, 0x87, 0x94, 0xDA, 0xC1, 0x72, 0xEE,
-    0x46, 0xCA, 0xCF, 0x73, 0x81, 0x95, 0x83, 0xEE, 0xA0, 0x67, 0xDC, 0x85, 0xC3, 0x49, 0x84, 0x8D,
-    0x41, 0x57, 0x9B, 0xC1, 0xA0, 0xCF, 0x27, 0x45, 0x6B, 0xD5, 0xAD, 0xA8, 0xB3, 0x72, 0x36, 0x2B,
-    0x21, 0x23, 0x72, 0x97, 0x30, 0xD6, 0xA2, 0x44, 0x5A, 0x1D, 0x4D, 0xAB, 0xF9, 0x6C, 0x52, 0xF8,
-    0xCF, 0xF8, 0xDF, 0x46, 0xFF, 0xAA, 0x8D, 0xD2, 0x31, 0x68, 0xD5, 0x93, 0xE0, 0xF0, 0xE2, 0xCC,
-    0x30, 0xEA, 0x1B, 0xD1, 0x88, 0x68, 0x64, 0x34, 0x4B, 0xA5, 0x7C, 0x5B, 0x27, 0x1B, 0xA0, 0x57,
-    0x5E, 0x67, 0xD1, 0x70, 0xA5, 0xDA, 0xD2, 0x5C, 0x38, 0x6F, 0xC0, 0x57, 0x1C, 0xA0, 0x77, 0x81,
-    0x11, 0x4E, 0x36, 0x2C, 0xBD, 0x8C, 0x3A, 0x2D, 0x4D, 0x52, 0x1B, 0x4C, 0x38, 0xA9, 0x75, 0x5A,
-    0xD1, 0x8D, 0xC8, 0xBB, 0xBD, 0x3B, 0xF7, 0xA0, 0xDF, 0xD4, 0xEC, 0x37, 0x22, 0xDD, 0x66, 0x64,
-    0x0A, 0xBE, 0xAE, 0xB0, 0x48, 0x9E, 0x7A, 0x08, 0xEE, 0x06, 0x95, 0x35, 0x28, 0x9E, 0xB4, 0xE0,
-    0x32, 0xCC, 0x0D, 0xDD, 0x11, 0x46, 0x9A, 0x95, 0xD3, 0x6B, 0x78, 0xCE, 0xA2, 0x3A, 0xE7, 0x39,
-    0xB8, 0x1E, 0x3F, 0x3C, 0xB9, 0x9F, 0x34, 0xC8, 0x54, 0x9E, 0xF4, 0x41, 0x7F, 0x68, 0x7B, 0xAE,
-    0x32, 0x8A, 0xB2, 0xFD, 0xD5, 0xEE, 0xD1, 0x5D, 0x16, 0xB6, 0x7B, 0xEC, 0xD9, 0x07, 0xAF, 0x3F,
-    0xB1, 0x70, 0xBD, 0xE8, 0x69, 0x60, 0x1D, 0x47, 0xF3, 0x6C, 0x07, 0x45, 0x95, 0xB3, 0x5D, 0xFE,
-    0xD3, 0x23, 0xF7, 0x8D, 0x54, 0x28, 0xAA, 0xDE, 0x62, 0x78, 0x00, 0xBD, 0xBD, 0x5D, 0x58, 0xDA,
-    0x6C, 0x14, 0x2B, 0x1B, 0xFA, 0xED, 0xC4, 0x31, 0x50, 0xE0, 0x20, 0xA8, 0xEC, 0x2D, 0xF6, 0xD9,
-    0xE0, 0x2F, 0xA2, 0x95, 0x7D, 0xFD, 0xB0, 0x9A, 0x18, 0x8F, 0xC8, 0xAD, 0x77, 0xEC, 0xD7, 0xBB,
-    0xE5, 0xBB, 0x9A, 0x56, 0x23, 0x71, 0x98, 0xAE, 0xFB, 0x3F, 0x8A, 0x0A, 0x33, 0x35, 0x4E, 0xE6,
-    0x98, 0x27, 0x18, 0x0B, 0xC3, 0xE0, 0xB6, 0x9C, 0xA6, 0xBD, 0x48, 0xF6, 0xAA, 0x82, 0xAA, 0x91,
-    0x3A, 0xE1, 0xF4, 0x87, 0xFC, 0x03, 0xB9, 0xEF, 0xE4, 0x69, 0x4B, 0x34, 0x5F, 0x01, 0x95, 0x57,
-    0x3D, 0x8C, 0xDE, 0xC6, 0x11, 0x5D, 0x92, 0x27, 0x11, 0x12, 0x91, 0xAC, 0x0A, 0x4B, 0x08, 0xAC,
-    0x73, 0xD8, 0xB8, 0x08, 0x2C, 0x5B, 0xEC, 0x0C, 0xC1, 0xB8, 0x13, 0x89, 0x04, 0x48, 0x13, 0x20,
-    0x52, 0x80, 0x9C, 0x1B, 0x17, 0x71, 0x91, 0x2A, 0x2E, 0x2E, 0x85, 0x02, 0xA8, 0x90, 0x4D, 0x02,
-    0x06, 0xA2, 0xE2, 0x1A, 0x35, 0x42, 0x8A, 0x14, 0x51, 0xE1, 0xE2, 0x72, 0x09, 0x70, 0x0A, 0x90,
-    0x00, 0x57, 0x48, 0x5A, 0x1A, 0x0A, 0x90, 0x42, 0x85, 0x18, 0x09, 0x41, 0x4A, 0x13, 0xD1, 0x25,
-    0x70, 0xAC, 0x42, 0x34, 0x42, 0xD9, 0xD4, 0x89, 0xE4, 0xF8, 0xBD, 0x21, 0xBF, 0x93, 0x14, 0xFF,
-    0x25, 0xDF, 0x1D, 0xDF, 0xF2, 0xE3, 0xEE, 0x72, 0x67, 0x67, 0xDE, 0xBC, 0xD9, 0xCF, 0x18, 0xFD,
-    0xB8, 0x01, 0x10, 0xED, 0x49, 0x61, 0x4C, 0x52, 0x25, 0xA5, 0x31, 0x69, 0x11, 0x67, 0x78, 0x9C,
-    0xB1, 0x53, 0x74, 0x88, 0x78, 0x6B, 0x6B, 0x6B, 0x46, 0x7C, 0x91, 0x11, 0x4F, 0xD2, 0xEA, 0x34,
-    0x7A, 0x93, 0xEA, 0xA4, 0x49, 0xCB, 0xA4, 0x3A, 0x64, 0x92, 0x3A, 0xA9, 0xF0, 0x86, 0x31, 0xFF,
-    0xE7, 0x59, 0x4C, 0x13, 0x69, 0x30, 0x23, 0xFF, 0x1B, 0xEE, 0x0D, 0x9F, 0x3F, 0xC1, 0x28, 0x23,
-    0xDA, 0xCC, 0x78, 0xF9, 0x47, 0x78, 0x3B, 0xDE, 0x36, 0xBD, 0x1D, 0x9F, 0xE5, 0x53, 0x80, 0x97,
-    0xCF, 0x19, 0xE3, 0xDD, 0x68, 0x31, 0x19, 0x1D, 0xBE, 0x3C, 0x94, 0x32, 0xEA, 0xAF, 0x4A, 0x15,
-    0xB7, 0x1F, 0x3F, 0x28, 0xD3, 0xE6, 0x1F, 0xB7, 0x8B, 0xB4, 0xBE, 0xFB, 0x67, 0x93, 0xFF, 0xF5,
-    0x66, 0x61, 0xDC, 0x9D, 0x9B, 0x99, 0x71, 0x77, 0x2F, 0x62, 0xBD, 0xBB, 0x1B, 0x98, 0xF0, 0xF7,
-    0x1F, 0xC2, 0xEC, 0xFB, 0xDF, 0x04, 0xC8, 0x0B, 0xC6, 0xC4, 0xE3, 0xCB, 0xA6, 0xB4, 0xE3, 0x4A,
-    0x58, 0x06, 0x32, 0x3A, 0x8C, 0x86, 0xD9, 0xE6, 0xB4, 0x5C, 0x31, 0xE6, 0xD4, 0x55, 0xAC, 0x73,
-    0x8E, 0x06, 0xBE, 0x79, 0x69, 0xB1, 0xF6, 0x41, 0xE9, 0x74, 0xC9, 0xC2, 0x1F, 0x4D, 0x5E, 0x86,
-    0x3D, 0x6D, 0x6C, 0x4D, 0x5C, 0x26, 0x8D, 0x79, 0xDE, 0xA4, 0x35, 0x46, 0x28, 0xE4, 0x77, 0x36,
-    0x93, 0x2C, 0xBF, 0x33, 0x48, 0x99, 0x57, 0xF2, 0x41, 0x95, 0x57, 0x2E, 0xC2, 0x9D, 0x63, 0xEF,
-    0x02, 0x92, 0x06, 0x60, 0x3B, 0x67, 0xB2, 0x68, 0x70, 0x5E, 0x15, 0x88, 0xC4, 0x25, 0x1D, 0x92,
-    0x99, 0xE3, 0x5C, 0xC3, 0x1C, 0xA5, 0x7D, 0x32, 0x24, 0x70, 0xA3, 0x2F, 0xE6, 0x1D, 0x4F, 0xCC,
-    0x49, 0x5C, 0xDF, 0xC6, 0x75, 0x08, 0x97, 0x79, 0x72, 0xAD, 0x9D, 0xF5, 0x44, 0x6A, 0xB4, 0xD9,
-    0xE2, 0x59, 0x8A, 0x2D, 0x60, 0xEE, 0xFE, 0x18, 0xCC, 0x37, 0x27, 0xE4, 0x43, 0x3C, 0x1B, 0xA6,
-    0x5D, 0xC4, 0x88, 0x9F, 0xB8, 0x26, 0xE8, 0xA3, 0x2E, 0xE8, 0x82, 0x3E, 0x6C, 0x83, 0x36, 0x6C,
-    0xFD, 0x2C, 0xC4, 0xBA, 0x41, 0x8F, 0xF1, 0xBD, 0xAE, 0x5D, 0xF0, 0x32, 0xB0, 0xF2, 0xA8, 0xBB,
-    0xAC, 0xDF, 0xD1, 0x66, 0xE6, 0x1D, 0xCC, 0xEF, 0x8C, 0x17, 0x48, 0x75, 0x38, 0x86, 0x6D, 0xB4,
-    0x71, 0xD5, 0x73, 0xDD, 0x11, 0xE3, 0x29, 0x07, 0x0E, 0xCC, 0x8E, 0x7A, 0x65, 0x6E, 0x57, 0xE6,
-    0xF6, 0x3C, 0xAE, 0x97, 0x36, 0x93, 0xF6, 0x31, 0xBC, 0x9B, 0xF6, 0x88, 0xA6, 0x94, 0x26, 0x94,
-    0xFB, 0xB2, 0x27, 0x95, 0x09, 0xC4, 0x93, 0x0A, 0x7E, 0x0B, 0x40, 0x18, 0x7A, 0x32, 0x18, 0x8C,
-    0x14, 0x8B, 0x36, 0xFE, 0x7F, 0x5A, 0x5F, 0xDB, 0x70, 0x0C, 0xA4, 0x44, 0x9B, 0xC8, 0xAF, 0x64,
-    0x37, 0x46, 0xA0, 0xB0, 0x4E, 0x17, 0x93, 0x3F, 0x76, 0xB6, 0xE6, 0xE4, 0x7F, 0x59, 0xF7, 0xA2,
-    0x62, 0x3A, 0xC0, 0x94, 0x36, 0x21, 0x9F, 0x76, 0x7D, 0xD8, 0x97, 0xC0, 0x7B, 0xB5, 0x89, 0x81,
-    0xAD, 0x62, 0x4F, 0xBC, 0x37, 0x02, 0x8F, 0x7D, 0x22, 0x97, 0xD7, 0xCF, 0x72, 0x17, 0xD2, 0xBF,
-    0xFE, 0x30, 0x7F, 0xB4, 0xFE, 0x63, 0xAF, 0x8E, 0xBB, 0x98, 0xF1, 0x13, 0xE9, 0x26, 0xF4, 0x6A,
-    0x23, 0xBF, 0x31, 0xC0, 0x5C, 0x88, 0xA9, 0xA2, 0x55, 0x0C, 0xB1, 0x44, 0xC3, 0xB0, 0x9C, 0xD8,
-    0x63, 0xD6, 0xA4, 0x08, 0x7A, 0xCE, 0xA8, 0x15, 0xA4, 0xBE, 0x68, 0xF8, 0x7D, 0x46, 0x1D, 0xE1,
-    0x83, 0x4B, 0x32, 0x6D, 0xF2, 0xF2, 0xD9, 0x26, 0xD3, 0xE6, 0xFD, 0x9A, 0x8D, 0x7B, 0x57, 0x1B,
-    0xF9, 0x01, 0x1B, 0x7F, 0x5C, 0x97, 0xC2, 0x93, 0xED, 0x16, 0x2E, 0x06, 0x33, 0x32, 0xAB, 0x7D,
-    0xE6, 0x6B, 0x1A, 0xAE, 0x66, 0xE9, 0xB2, 0x0F, 0x91, 0x9C, 0x88, 0x7C, 0x6F, 0xE8, 0x01, 0x7E,
-    0x9E, 0xA3, 0x65, 0x53, 0x02, 0xC0, 0xB6, 0x89, 0x41, 0x8C, 0x18, 0x8D, 0xE5, 0x34, 0x57, 0xCE,
-    0x37, 0x79, 0x35, 0xDF, 0xA4, 0x95, 0xE7, 0x76, 0xA7, 0x1B, 0xFB, 0x78, 0xD0, 0xAE, 0x32, 0xCD,
-    0x9C, 0x0E, 0x2E, 0xB0, 0x51, 0xDC, 0x80, 0x96, 0x79, 0xF6, 0x1D, 0xA6, 0x75, 0x67, 0xF2, 0x9A,
-    0xB3, 0xA0, 0x04, 0xE9, 0xC8, 0x44, 0xB7, 0x1D, 0xF8, 0xD9, 0xE2, 0x06, 0xD9, 0x15, 0x0A, 0xA7,
-    0x83, 0x17, 0x66, 0x5D, 0xA6, 0x59, 0x4B, 0xBE, 0x64, 0x78, 0x8F, 0x14, 0x17, 0xF0, 0x02, 0x5D,
-    0xF4, 0xBA, 0x49, 0x79, 0x93, 0x22, 0x9F, 0x72, 0xD0, 0xFC, 0x3D, 0x3B, 0xA6, 0xFF, 0x1A, 0x60,
-    0x73, 0xEB, 0x4B, 0x24, 0xF5, 0x1C, 0xE0, 0xE7, 0xC8, 0xE8, 0xCE, 0x6C, 0x32, 0x18, 0x09, 0x6E,
-    0x06, 0xB3, 0x3E, 0x62, 0x17, 0x4C, 0x99, 0xA0, 0x41, 0x68, 0xF9, 0x86, 0x00, 0x83, 0xA5, 0xC0,
-    0xC3, 0x00, 0x1B, 0x91, 0x32, 0x70, 0x45, 0x88, 0xAD, 0xB9, 0x32, 0x5A, 0x2F, 0x23, 0x6C, 0x36,
-    0xAF, 0x6C, 0x4C, 0x41, 0x42, 0xFA, 0x5A, 0x5B, 0x5B, 0x4D, 0x11, 0xFD, 0x64, 0xFB, 0x37, 0xC6,
-    0xB6, 0x2B, 0x41, 0xBB, 0x4A, 0xA2, 0xF5, 0x2B, 0x41, 0x4F, 0x76, 0x85, 0xFD, 0x39, 0xBF, 0xBF,
-    0x40, 0x97, 0x0D, 0x57, 0xBD, 0x61, 0x87, 0x37, 0x63, 0x63, 0xC6, 0x56, 0x3D, 0x55, 0x1B, 0x47,
-    0x79, 0x01, 0xFB, 0x4D, 0xDE, 0xA8, 0x76, 0x96, 0x93, 0x7E, 0xD0, 0xA9, 0xA9, 0xBA, 0x33, 0xCF,
-    0x0C, 0x65, 0x96, 0x92, 0x7A, 0x80, 0x84, 0xAB, 0x6D, 0x43, 0xD2, 0x01, 0x8D, 0x3F, 0x10, 0xCD,
-    0xA8, 0x28, 0x40, 0x0C, 0x00, 0x7E, 0xDD, 0xBF, 0x99, 0xB1, 0x26, 0xC6, 0x95, 0xD8, 0x87, 0x6B,
-    0xAE, 0x14, 0x4B, 0xFB, 0x89, 0xDD, 0x42, 0xEA, 0x40, 0x01, 0xB8, 0x9D, 0x10, 0x01, 0x0E, 0xBC,
-    0x31, 0x60, 0x7B, 0x42, 0x87, 0xF2, 0x2B, 0xF6, 0x05, 0xB3, 0x2F, 0xF6, 0x78, 0xF4, 0x18, 0x22,
-    0xD8, 0xA6, 0x3D, 0xDD, 0xD2, 0x23, 0xD0, 0x00, 0xB8, 0x8C, 0x10, 0x3E, 0x0B, 0x11, 0x7B, 0x01,
-    0x20, 0x05, 0x66, 0x34, 0xC9, 0x80, 0xB9, 0x9F, 0xCA, 0x25, 0x5F, 0xEE, 0x60, 0xFB, 0x4B, 0x8B,
-    0x55, 0x0F, 0x6F, 0x6D, 0xFD, 0x96, 0xEB, 0x8C, 0xE6, 0xC9, 0xE7, 0x20, 0x56, 0x4D, 0x60, 0x8E,
-    0xFB, 0xEE, 0x48, 0x96, 0x43, 0x9E, 0x06, 0xC8, 0xD4, 0x15, 0xBC, 0x55, 0x6D, 0xA1, 0xD4, 0x25,
-    0xE3, 0x96, 0x89, 0x60, 0x7A, 0x32, 0xBE, 0x67, 0x48, 0xDE, 0xE3, 0xC3, 0x59, 0x9A, 0x38, 0xC9,
-    0xD9, 0xA0, 0xB5, 0xE9, 0x10, 0x6C, 0x38, 0xA9, 0xEF, 0x09, 0x59, 0x75, 0x96, 0x48, 0x88, 0x5C,
-    0x32, 0x30, 0x3E, 0x65, 0xF8, 0xB3, 0xA8, 0xA5, 0x58, 0xDA, 0x92, 0x98, 0xA8, 0x70, 0xBE, 0x4D,
-    0xF4, 0x5A, 0x22, 0x29, 0xE1, 0x89, 0x05, 0x0D, 0xDE, 0x12, 0xF7, 0xD1, 0x96, 0xD1, 0x78, 0x4F,
-    0xF4, 0xC5, 0xF3, 0x33, 0x3D, 0x31, 0x1C, 0x75, 0x24, 0x68, 0x80, 0x59, 0xA2, 0xEF, 0x71, 0x35,
-    0x31, 0x25, 0x9B, 0xB3, 0xA4, 0x07, 0x3B, 0x77, 0x23, 0xCA, 0x6A, 0xEF, 0xB9, 0x2A, 0x5F, 0x28,
-    0x45, 0x77, 0x2D, 0x10, 0xD3, 0xED, 0x00, 0xCE, 0xFF, 0x71, 0x01, 0xA7, 0xC0, 0xCD, 0x43, 0x4C,
-    0xB3, 0x1B, 0x84, 0x96, 0xA0, 0xE9, 0x77, 0x80, 0x4B, 0xE6, 0xC6, 0xBB, 0xCB, 0x75, 0xB9, 0x92,
-    0x89, 0x55, 0xE3, 0x29, 0xF2, 0xF7, 0xC4, 0xCC, 0xE3, 0x14, 0xD6, 0x65, 0x97, 0x05, 0x56, 0xC3,
-    0x79, 0x70, 0x76, 0x64, 0x9C, 0x4D, 0xED, 0xF5, 0xA9, 0x39, 0xD6, 0x6B, 0x73, 0x5C, 0x44, 0xA9,
-    0x36, 0xC4, 0xF7, 0xF4, 0x41, 0x91, 0x96, 0x53, 0xAD, 0xCD, 0x8B, 0x5C, 0x27, 0xB8, 0x2C, 0x2D,
-    0xA7, 0xFA, 0xAE, 0x2D, 0xFD, 0x53, 0xA9, 0x44, 0xA1, 0x9A, 0x2B, 0xB3, 0xE7, 0xB6, 0x9F, 0xDA,
-    0x70, 0x6E, 0x11, 0x8F, 0xB4, 0x7A, 0x3E, 0x33, 0x70, 0x6C, 0xFA, 0x3E, 0x36, 0x01, 0xBA, 0xE5,
-    0x7F, 0xF9, 0x78, 0x60, 0xEB, 0xCE, 0xD4, 0x72, 0x1C, 0x51, 0x15, 0xF0, 0xEF, 0xB4, 0xAB, 0xFC,
-    0x21, 0xA9, 0xE4, 0x7C, 0xD2, 0x84, 0x5D, 0x5A, 0x8F, 0xAB, 0x6E, 0x74, 0x55, 0xFA, 0x49, 0x9F,
-    0x74, 0x2A, 0xDD, 0xD5, 0x74, 0xEE, 0x98, 0x2D, 0x97, 0x45, 0x3B, 0x35, 0xDE, 0xDC, 0xFA, 0x73,
-    0x61, 0xF3, 0x37, 0xF7, 0x49, 0x93, 0x70, 0xE7, 0x0E, 0xD5, 0xCB, 0xEB, 0xB1, 0xED, 0xA0, 0x47,
-    0xEC, 0x82, 0x0E, 0xD1, 0x9D, 0xEE, 0xFA, 0x18, 0x30, 0x24, 0xDC, 0x44, 0xCA, 0xD7, 0x5C, 0x5F,
-    0x10, 0x7E, 0x3A, 0x90, 0xC0, 0xFC, 0xAB, 0x4C, 0xC4, 0x2E, 0x45, 0x55, 0xE9, 0xF3, 0x0E, 0x94,
-    0x11, 0x72, 0xFD, 0x53, 0x6C, 0x39, 0xBD, 0x23, 0xE6, 0xB4, 0x2D, 0x24, 0xBB, 0x16, 0x19, 0x15,
-    0x41, 0x48, 0xB2, 0x47, 0x0F, 0xD9, 0x12, 0x10, 0x97, 0x69, 0x81, 0xDC, 0x82, 0xE3, 0x22, 0x6A,
-    0xA5, 0xE7, 0xEA, 0x49, 0xD8, 0x13, 0x51, 0x49, 0x0D, 0x48, 0x1A, 0xA4, 0xB9, 0x06, 0xFE, 0x2D,
-    0xD9, 0x92, 0x96, 0x2C, 0xA9, 0x5E, 0x97, 0xCB, 0xB2, 0xAB, 0xCF, 0x8E, 0xC9, 0x9A, 0x5C, 0xF2,
-    0x70, 0x7A, 0x82, 0x51, 0xDB, 0x1D, 0x43, 0x5B, 0x4C, 0xBB, 0xFC, 0x22, 0xF0, 0xE9, 0x8E, 0x13,
-    0xF2, 0x6F, 0xB3, 0x28, 0xED, 0x87, 0x75, 0xEB, 0x76, 0xD2, 0xE1, 0x31, 0xD3, 0xDC, 0xA0, 0xBC,
-    0x9D, 0x89, 0x3B, 0x6C, 0xD7, 0xA2, 0xC0, 0xDB, 0xCE, 0x06, 0xA8, 0x66, 0x8D, 0xF5, 0x0B, 0x48,
-    0x26, 0x47, 0xCE, 0x48, 0x45, 0xC3, 0xC6, 0x9F, 0x41, 0x48, 0xC2, 0x84, 0xE8, 0x8D, 0x7B, 0x8E,
-    0x84, 0x38, 0x27, 0x8A, 0x78, 0x0F, 0x30, 0x1C, 0x88, 0xBE, 0x9C, 0xB1, 0x7A, 0x2C, 0x72, 0x60,
-    0x6A, 0x28, 0xEA, 0x14, 0x9B, 0xED, 0x5B, 0x32, 0x9F, 0x09, 0xF2, 0x62, 0x56, 0x38, 0x62, 0x35,
-    0xEB, 0x1F, 0x58, 0xF3, 0x01, 0x3D, 0x1E, 0xDC, 0xA6, 0x22, 0x46, 0x1B, 0x0C, 0x9A, 0x65, 0xE2,
-    0x1A, 0xCB, 0xD4, 0x65, 0x92, 0x48, 0x35, 0xA1, 0xB9, 0xA0, 0x51, 0xDF, 0xA1, 0xD3, 0x9F, 0x7E,
-    0x8E, 0x4A, 0x0A, 0xA9, 0x84, 0x78, 0x23, 0x56, 0x61, 0x05, 0xF3, 0x4C, 0x84, 0x30, 0x74, 0xC6,
-    0x3D, 0xF2, 0xDC, 0x98, 0x09, 0xCE, 0x02, 0x73, 0x21, 0x43, 0x0C, 0xE8, 0xCB, 0x07, 0x2D, 0x5C,
-    0xE1, 0x0D, 0xA4, 0xAB, 0x33, 0xF0, 0x05, 0x28, 0xF2, 0xE6, 0x54, 0x64, 0xC5, 0xBC, 0xB4, 0xF5,
-    0x3B, 0xB9, 0x44, 0x39, 0x6F, 0x8E, 0xAE, 0x0B, 0x04, 0xCF, 0x49, 0xAD, 0x32, 0x5F, 0x2B, 0x58,
-    0x8A, 0x12, 0x76, 0xBA, 0x44, 0x0A, 0xC7, 0x5A, 0x2E, 0x8B, 0x10, 0xAB, 0x97, 0x41, 0xC7, 0x17,
-    0xC8, 0xAF, 0xC5, 0x68, 0xE9, 0xD2, 0x72, 0x83, 0x73, 0x2A, 0xE1, 0x85, 0xA7, 0x0F, 0x8D, 0x9E,
-    0x2C, 0x53, 0x0C, 0x97, 0x21, 0x81, 0xED, 0x72, 0x8C, 0x23, 0xCA, 0x32, 0x0E, 0x8D, 0xCD, 0x32,
-    0xBD, 0xBF, 0x4C, 0x87, 0x7F, 0x09, 0x68, 0xAF, 0x8E, 0x4B, 0x08, 0xB6, 0x5B, 0xE6, 0xA1, 0x71,
-    0xD9, 0xAB, 0x7C, 0xF9, 0xFD, 0xE2, 0xD0, 0x18, 0x69, 0xA6, 0xBF, 0xB2, 0xBF, 0xEE, 0x12, 0xCB,
-    0x39, 0xD2, 0xD4, 0x36, 0xE9, 0xE7, 0x60, 0x7B, 0xCF, 0xED, 0x65, 0xF4, 0x1D, 0x0E, 0x4B, 0x60,
-    0xF9, 0x17, 0x0D, 0xF9, 0x2A, 0xE0, 0x8C, 0x84, 0x65, 0x24, 0x96, 0xD2, 0x36, 0xA1, 0x86, 0xFB,
-    0xC8, 0xBE, 0x87, 0xFD, 0xD1, 0x35, 0x51, 0x63, 0x7B, 0x5B, 0x21, 0xC9, 0xAA, 0xA0, 0x8D, 0x6B,
-    0xEF, 0x52, 0x0C, 0x9F, 0xD0, 0x79, 0x11, 0x34, 0x29, 0xA0, 0xB5, 0xF4, 0x6B, 0x44, 0x4F, 0xE5,
-    0xD4, 0xF0, 0x81, 0x09, 0x9C, 0xDC, 0x68, 0x87, 0x57, 0x6F, 0xAF, 0xF4, 0xAF, 0xDE, 0x5A, 0xE9,
-    0x5F, 0xBB, 0x95, 0xB6, 0xF1, 0x03, 0x57, 0x85, 0x28, 0x03, 0xFE, 0xAD, 0x15, 0xBD, 0xBC, 0x5F,
-    0x7E, 0x8B, 0xA1, 0xE0, 0x81, 0x73, 0xFF, 0x97, 0x80, 0x7E, 0xDF, 0x1E, 0x65, 0xD5, 0xB6, 0xC9,
-    0x05, 0xDB, 0xC6, 0xB8, 0xEC, 0x8B, 0xB6, 0x3D, 0x84, 0x3A, 0x6C, 0xBE, 0xFA, 0x82, 0xB3, 0x40,
-    0x0E, 0x64, 0x17, 0x33, 0xB1, 0xD1, 0xDF, 0x21, 0xAC, 0xC0, 0x09, 0xFA, 0x48, 0x1D, 0x7C, 0xFF,
-    0xD9, 0xF6, 0x78, 0x85, 0xF7, 0xA4, 0x15, 0x8F, 0x81, 0x8E, 0x66, 0xB7, 0xFA, 0x55, 0xB5, 0xC5,
-    0x0E, 0xE4, 0x3A, 0xC5, 0xB6, 0x98, 0xF8, 0xCC, 0x52, 0x9E, 0x8C, 0x8C, 0xB6, 0x1E, 0x35, 0x12,
-    0x3D, 0xC3, 0x2C, 0x0E, 0xE9, 0x21, 0xD6, 0x72, 0x68, 0x77, 0x31, 0xC7, 0x03, 0x17, 0xE2, 0xEC,
-    0x4F, 0xD8, 0x1B, 0x0B, 0x3F, 0x04, 0xBC, 0x75, 0x12, 0x0C, 0x3F, 0x12, 0x3D, 0xDF, 0xA4, 0x54,
-    0xD7, 0xF9, 0x5A, 0xC5, 0xFC, 0x6B, 0x27, 0xE4, 0x7E, 0x93, 0xCA, 0xAC, 0x7B, 0x96, 0xB9, 0x92,
-    0x32, 0x3D, 0xCE, 0x33, 0xD4, 0xE7, 0xF0, 0x23, 0xC6, 0xBC, 0xFD, 0x13, 0x19, 0x94, 0xA4, 0x45,
-    0x2C, 0x7B, 0xDB, 0x95, 0xF7, 0x86, 0xF1, 0xE1, 0x5C, 0x63, 0x00, 0x47, 0x08, 0xBF, 0x28, 0xE9,
-    0xEB, 0xFF, 0x20, 0x74, 0x0F, 0x60, 0x6A, 0xF2, 0x8D, 0xD3, 0x86, 0x94, 0x37, 0xFE, 0x63, 0xBE,
-    0xF2, 0x62, 0xE1, 0x41, 0x08, 0xAB, 0xA0, 0x84, 0x10, 0x6E, 0x23, 0x4D, 0x34, 0x79, 0x13, 0x2D,
-    0xBE, 0xEC, 0xFE, 0xA9, 0xD1, 0x8C, 0x7B, 0x1A, 0xD6, 0x75, 0x5F, 0x88, 0x81, 0x6D, 0x77, 0x5C,
-    0x19, 0x57, 0x3B, 0x49, 0x95, 0x96, 0x3B, 0xA0, 0x45, 0x01, 0xC8, 0x8B, 0x9D, 0xA8, 0x75, 0xD9,
-    0x04, 0x61, 0xF7, 0x3F, 0x40, 0x2A, 0x7B, 0x19, 0xC5, 0x11, 0x49, 0x39, 0x86, 0x48, 0x4A, 0x1E,
-    0x7B, 0x83, 0x11, 0x07, 0x32, 0xFE, 0x18, 0x58, 0x00, 0x4F, 0x69, 0x53, 0x07, 0x86, 0x9C, 0xA0,
-    0xCC, 0xA4, 0x54, 0x37, 0x9E, 0x0B, 0x27, 0x60, 0xC9, 0x9F, 0xE0, 0xC9, 0x33, 0x85, 0x44, 0x36,
-    0xE7, 0x8E, 0xE9, 0x13, 0x6C, 0xEC, 0xC3, 0x03, 0x6A, 0x92, 0x50, 0xBD, 0x36, 0x70, 0x48, 0xBE,
-    0xB7, 0x91, 0x94, 0xF1, 0xCD, 0x0D, 0x5B, 0xA7, 0xEF, 0x6E, 0x44, 0x4D, 0xFE, 0xBD, 0x8D, 0xA0,
-    0x71, 0xC1, 0x46, 0x50, 0x3B, 0xFF, 0xFB, 0x7E, 0xE6, 0xB4, 0x04, 0xA9, 0x88, 0x29, 0xED, 0xE8,
-    0x9A, 0x44, 0x55, 0x8E, 0xCA, 0x12, 0x52, 0xC6, 0x7C, 0x2D, 0x37, 0x32, 0x11, 0x6A, 0x06, 0xF3,
-    0x73, 0xD0, 0xE2, 0x0F, 0xA4, 0x4E, 0xCB, 0x2E, 0xA8, 0x2E, 0x8E, 0x47, 0x48, 0x22, 0xA4, 0x4F,
-    0x3D, 0x5F, 0xB8, 0x4F, 0xF1, 0x2C, 0xCF, 0xAC, 0xF0, 0x3C, 0x34, 0x22, 0xC2, 0x1C, 0x13, 0xA3,
-    0xEF, 0xF3, 0x7F, 0xC8, 0x56, 0x6A, 0x5E, 0x21, 0xF2, 0x48, 0xDF, 0xAB, 0xD7, 0x11, 0x18, 0xB3,
-    0xFE, 0x48, 0x65, 0x97, 0xFD, 0x69, 0x15, 0x57, 0x79, 0x19, 0x97, 0xAE, 0x3C, 0xA0, 0xD5, 0xE9,
-    0x99, 0x4B, 0x8F, 0xB3, 0xFA, 0x13, 0xB5, 0x4C, 0xDA, 0xB0, 0xB2, 0x2A, 0x49, 0xAC, 0x52, 0xD9,
-    0x7E, 0xD9, 0x74, 0x93, 0xF1, 0xAA, 0x98, 0x9F, 0x01, 0xD3, 0x5A, 0xB5, 0x6A, 0x81, 0xFD, 0xFF,
-    0xFF, 0x1F, 0xB4, 0x80, 0x34, 0x00, 0xB5, 0x92, 0xBD, 0x4E, 0xE3, 0x50, 0x10, 0x85, 0x8F, 0x6D,
-    0xA1, 0x14, 0x2E, 0x42, 0x83, 0x10, 0x95, 0x1B, 0x3A, 0x24, 0xFC, 0x08, 0xBE, 0x15, 0x2D, 0x29,
-    0x48, 0x45, 0xB1, 0x15, 0xC5, 0x56, 0x3C, 0xC2, 0x35, 0x05, 0xD5, 0x16, 0xE4, 0x0D, 0xA0, 0xD8,
-    0x02, 0xE5, 0x25, 0xEC, 0x47, 0x88, 0x40, 0x54, 0x5B, 0x6C, 0x90, 0x88, 0x56, 0x5A, 0x8A, 0xB5,
-    0x50, 0x40, 0x51, 0x88, 0x7D, 0x76, 0x66, 0x1C, 0xC4, 0x22, 0x6D, 0x81, 0xF8, 0x71, 0x31, 0xC7,
-    0xF6, 0x9D, 0x19, 0x7F, 0x9E, 0x33, 0x00, 0xB0, 0xD2, 0x03, 0x62, 0xE6, 0x05, 0x01, 0xFF, 0xE7,
-    0xB2, 0xA6, 0x03, 0xE3, 0xDB, 0xA9, 0x47, 0xC0, 0xCE, 0x49, 0xB5, 0x89, 0xB0, 0x41, 0xB7, 0x82,
-    0x4A, 0x22, 0xB2, 0xC5, 0x21, 0xE7, 0x67, 0xF0, 0x94, 0xAB, 0xC2, 0x3A, 0xFB, 0x87, 0xF7, 0xBD,
-    0xA7, 0xB3, 0x77, 0x4A, 0x44, 0xA4, 0x53, 0x20, 0xE5, 0xA4, 0x68, 0x06, 0xF2, 0x85, 0x47, 0x72,
-    0x2C, 0x78, 0x6B, 0x82, 0x27, 0x7C, 0xCC, 0x81, 0xEC, 0x8A, 0x23, 0x80, 0xF0, 0x63, 0x81, 0x43,
-    0x56, 0x6A, 0xE5, 0x86, 0xD5, 0xC3, 0xC8, 0x86, 0x2D, 0x58, 0xCB, 0x55, 0x2D, 0xFB, 0xBE, 0x2D,
-    0xB6, 0x30, 0xC6, 0xE2, 0x0C, 0xC5, 0x3D, 0x93, 0x54, 0x46, 0x52, 0x19, 0x49, 0xA5, 0x24, 0xE9,
-    0xCB, 0xDA, 0x2D, 0x9E, 0x4B, 0xF4, 0xAC, 0x13, 0x25, 0xD9, 0x4B, 0x3E, 0x86, 0xE4, 0xDA, 0x48,
-    0x1E, 0x8C, 0x04, 0x08, 0xFA, 0xCE, 0x5C, 0xF3, 0x5C, 0xA8, 0x6D, 0x17, 0xCD, 0x17, 0xB1, 0x8F,
-    0xF1, 0xAF, 0x99, 0xA4, 0x9B, 0x71, 0x61, 0xBD, 0x74, 0x6E, 0xF0, 0x34, 0x5F, 0x9D, 0x50, 0x31,
-    0x1F, 0x0E, 0x9D, 0x99, 0x27, 0x7D, 0xCC, 0xBD, 0x3E, 0x5D, 0x7B, 0xFE, 0x71, 0xDA, 0x12, 0x33,
-    0xB7, 0xE9, 0x7D, 0xE3, 0x8D, 0xCD, 0xEF, 0xA7, 0x82, 0xF6, 0x84, 0x5B, 0x40, 0x12, 0xE5, 0x96,
-    0xFF, 0xF0, 0xA7, 0x17, 0xCD, 0xBE, 0xEE, 0x5B, 0xE7, 0xC7, 0x2C, 0xA4, 0x0B, 0x18, 0x9D, 0x2C,
-    0xFB, 0x74, 0xFF, 0xED, 0x67, 0xDC, 0x03, 0xB6, 0xDC, 0xE3, 0x25, 0xB7, 0xFB, 0x4C, 0x6E, 0x99,
-    0x75, 0xAC, 0xDC, 0x77, 0xE4, 0xAE, 0x72, 0x7F, 0x75, 0x46, 0x5D, 0x4B, 0x2C, 0x8E, 0x64, 0x13,
-    0x75, 0xFB, 0x46, 0x90, 0x11, 0x4B, 0x8C, 0x5E, 0xC4, 0x80, 0xF3, 0x3C, 0xAA, 0x23, 0xB2, 0x94,
-    0x7B, 0x3F, 0x71, 0xD1, 0x7F, 0x72, 0x5E, 0x17, 0xC7, 0xE8, 0x34, 0xC8, 0x2A, 0x1C, 0xF2, 0x7B,
-    0xC2, 0x11, 0xB9, 0x88, 0x59, 0xAA, 0xF3, 0xAB, 0xEA, 0xFE, 0x81, 0xDE, 0xC9, 0x52, 0x4C, 0x55,
-    0xB8, 0xA3, 0x3B, 0x11, 0x2C, 0xA0, 0x09, 0xE1, 0x02, 0x45, 0x2B, 0x5E, 0xD3, 0xDB, 0xA7, 0xA2,
-    0x09, 0xF9, 0xDB, 0xC5, 0x73, 0xF9, 0x1B, 0xE6, 0x49, 0x99, 0x1D, 0xF3, 0x0A, 0x69, 0x9E, 0x3A,
-    0x39, 0xCB, 0xCA, 0x0D, 0x4D, 0xC9, 0xA4, 0x93, 0x88, 0x38, 0xA3, 0x12, 0x73, 0xA6, 0x12, 0x92,
-    0x56, 0x2E, 0x6F, 0x55, 0xA4, 0xBF, 0xC8, 0x36, 0x52, 0x95, 0x0C, 0x89, 0x89, 0x4B, 0x73, 0x3F,
-    0x42, 0x3A, 0x91, 0x89, 0xB0, 0xEC, 0x48, 0x9D, 0xB6, 0x58, 0x81, 0x7A, 0xFD, 0x17, 0x35, 0xCE,
-    0xB1, 0x11, 0xC2, 0x30, 0x0C, 0x40, 0x51, 0x05, 0x15, 0x29, 0x28, 0xCC, 0x06, 0x19, 0x21, 0x0D,
-    0x7D, 0xE8, 0x59, 0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D, 0x8B, 0x30, 0x84, 0x47, 0x70, 0xC3, 0x06,
-    0x29, 0x52, 0x20, 0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE, 0xC5, 0x3B, 0x9D, 0x25, 0xF2, 0x3F, 0xC7,
-    0x1E, 0xFB, 0xBD, 0xCA, 0x29, 0x92, 0x28, 0x91, 0x85, 0x35, 0xD2, 0x1E, 0x81, 0x5A, 0x64, 0x76,
-    0x4C, 0xF9, 0xB5, 0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F, 0x53, 0xF3, 0x29, 0xCC, 0x27, 0x13, 0x7C,
-    0x94, 0xB2, 0xC0, 0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6, 0x09, 0x76, 0x50, 0x47, 0x38, 0x43, 0x1E,
-    0xE0, 0x4E, 0x13, 0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A, 0x8C, 0x4D, 0xC9, 0x22, 0x83, 0x69, 0x8B,
-    0xFF, 0xAE, 0xBA, 0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41, 0x8E, 0xAD, 0xEF, 0x79, 0xE9, 0x39, 0xF8,
-    0xFD, 0x02,
+    0xA8, 0x65, 0x29, 0x0B, 0xB6, 0x99, 0x71, 0x23, 0x69, 0xBD, 0xE0, 0xBB, 0x2B, 0x58, 0x4F, 0x36,
+    0x7D, 0x04, 0x15, 0xF7, 0x47, 0xB2, 0xF0, 0x99, 0xE4, 0x38, 0x43, 0x49, 0x74, 0x18, 0x71, 0x6B,
+    0xEA, 0x76, 0xCB, 0x47, 0x69, 0x24, 0x03, 0xC5, 0x3D, 0xCE, 0x33, 0x9C, 0xBE, 0x8C, 0x71, 0xD8,
+    0xB1, 0x1D, 0xF6, 0xE2, 0x03, 0x24, 0x29, 0xFA, 0xBB, 0x92, 0x9A, 0x80, 0x8D, 0x63, 0x87, 0x69,
+    0xC7, 0x45, 0xF8, 0x2D, 0xDA, 0x7F, 0xF7, 0x63, 0x40, 0x1F, 0xF8, 0xAD, 0xF8, 0x34, 0xF9, 0x48,
+    0xB2, 0x19, 0x9D, 0x03, 0xB8, 0x54, 0x01, 0x20, 0x54, 0x25, 0x48, 0x68, 0x7E, 0xD9, 0x3A, 0x99,
+    0x49, 0xDA, 0x60, 0x78, 0xF5, 0x99, 0x16, 0xBA, 0xF2, 0x5A, 0xD4, 0xC3, 0x23, 0x52, 0x82, 0xA8,
+    0x16, 0x24, 0xB4, 0xB9, 0xD7, 0xBA, 0xB6, 0xC2, 0x13, 0x51, 0x03, 0xE2, 0xB7, 0x5E, 0xFB, 0xBC,
+    0x0B, 0xB2, 0xEE, 0x80, 0x6C, 0xB8, 0xCD, 0x5A, 0xAB, 0xDF, 0xAA, 0x6C, 0x1B, 0xF0, 0x7B, 0x06,
+    0xA8, 0x99, 0x33, 0x7D, 0x09, 0xD9, 0xB6, 0xC7, 0x0C, 0xBF, 0x18, 0x6F, 0x0B, 0x38, 0x28, 0x32,
+    0x43, 0xAC, 0x9C, 0x2A, 0x93, 0x5C, 0x15, 0xBA, 0xF4, 0x73, 0xAE, 0xBD, 0x64, 0xAF, 0xA9, 0x9C,
+    0x85, 0x12, 0xA2, 0xFD, 0xA4, 0x4C, 0x70, 0x3D, 0xCB, 0x27, 0x2D, 0x29, 0x38, 0x61, 0xFE, 0xFB,
+    0x7E, 0x30, 0xC4, 0x62, 0x09, 0x1B, 0xAE, 0xB1, 0x18, 0x21, 0xA1, 0x4D, 0x1F, 0xEB, 0x8C, 0xE2,
+    0x70, 0x64, 0x01, 0x47, 0xC2, 0x9F, 0xBD, 0x13, 0xA0, 0xCB, 0x90, 0x4B, 0x4D, 0x02, 0xAF, 0x0C,
+    0x53, 0x27, 0xEE, 0x7C, 0xF2, 0x48, 0xF8, 0x9F, 0xE4, 0x05, 0xE7, 0x04, 0xEE, 0x6E, 0xC1, 0x59,
+    0x62, 0x97, 0x23, 0x3E, 0x7D, 0x64, 0xF2, 0xB3, 0xBF, 0xB2, 0x9F, 0xA2, 0xC5, 0xD3, 0x9E, 0x7A,
+    0x24, 0xB2, 0x9F, 0xD8, 0xC4, 0x23, 0xB0, 0xDD, 0xEB, 0xF0, 0x88, 0x3F, 0xFE, 0x18, 0xBE, 0xB9,
+    0xDC, 0xFD, 0x9E, 0x4D, 0x8F, 0x70, 0x7D, 0x3B, 0x4E, 0xF5, 0xB3, 0x1C, 0xB0, 0x6C, 0x66, 0x0B,
+    0x70, 0x6B, 0x42, 0x03, 0x7E, 0x55, 0x50, 0x83, 0xA3, 0xE1, 0xA8, 0xA4, 0x8D, 0xBC, 0xA8, 0xBB,
+    0x7F, 0xB1, 0x9D, 0xE5, 0x9D, 0x80, 0x16, 0x9C, 0x1F, 0x0C, 0xAE, 0x81, 0x37, 0xDC, 0x13, 0x5C,
+    0xA7, 0x69, 0x4D, 0x67, 0x30, 0xC6, 0x90, 0x6A, 0x6D, 0xFF, 0x83, 0xBA, 0x2B, 0xE0, 0xBC, 0x3F,
+    0xE5, 0x91, 0xFA, 0xC1, 0x92, 0x7D, 0xE0, 0x88, 0x4D, 0x43, 0xA3, 0x73, 0x5D, 0x44, 0xB9, 0xCE,
+    0xA3, 0x3C, 0xC9, 0xE7, 0x64, 0x0B, 0x65, 0xBA, 0x25, 0x7D, 0xC3, 0x6C, 0x72, 0x55, 0xF9, 0x79,
+    0x20, 0x1B, 0x0E, 0x6D, 0xFF, 0x8A, 0x83, 0xDF, 0xA5, 0x70, 0x1E, 0xD0, 0x74, 0x2D, 0xAB, 0xE4,
+    0xFD, 0x80, 0xF8, 0x02, 0x2F, 0x6F, 0xC6, 0x35, 0x2F, 0xEF, 0x83, 0x98, 0xC9, 0x16, 0x59, 0x52,
+    0xE3, 0x9E, 0x8D, 0xC3, 0x0A, 0x23, 0x96, 0x0A, 0xA3, 0x87, 0x86, 0x5F, 0x42, 0x64, 0x7F, 0xBD,
+    0x54, 0x65, 0xD6, 0x56, 0xD9, 0x9D, 0xC1, 0xD5, 0xD1, 0xB8, 0x5C, 0xBE, 0x63, 0x36, 0x57, 0xC3,
+    0xDA, 0x2D, 0x7D, 0xDE, 0x48, 0xC9, 0x86, 0xFD, 0x16, 0xEB, 0x94, 0x2F, 0x78, 0x07, 0x7D, 0xE1,
+    0x48, 0xF8, 0x3F, 0xC2, 0x17, 0x8E, 0x82, 0xFF, 0x94, 0xAD, 0xA6, 0x07, 0xA2, 0xCA, 0x11, 0xF0,
+    0x86, 0x66, 0x90, 0x31, 0x05, 0xFD, 0xDB, 0xAE, 0x5E, 0x2D, 0xA7, 0x06, 0x40, 0xC4, 0x98, 0x91,
+    0xF2, 0x91, 0x5F, 0x80, 0xF0, 0xB3, 0x76, 0x2F, 0x02, 0x76, 0x42, 0x01, 0x60, 0x9E, 0xA4, 0x24,
+    0x81, 0xA2, 0x9B, 0xF9, 0xCB, 0xD7, 0x28, 0x69, 0xF9, 0x25, 0x99, 0xF7, 0xC8, 0x2F, 0xA2, 0xCA,
+    0x9A, 0xDD, 0xE4, 0xDD, 0x34, 0xAE, 0xA0, 0x61, 0x63, 0xB9, 0xFA, 0x4D, 0x39, 0xAE, 0xA0, 0xBF,
+    0xA9, 0x24, 0x91, 0xDB, 0x95, 0xCC, 0xD5, 0xB8, 0x64, 0xFE, 0xC6, 0x73, 0xE1, 0xC0, 0xB5, 0xE7,
+    0xA6, 0xAE, 0xDD, 0x8A, 0x49, 0x71, 0x14, 0x82, 0xF1, 0xB6, 0xB0, 0xCC, 0x22, 0x2A, 0x78, 0xBB,
+    0xCA, 0xC9, 0x38, 0x80, 0xA3, 0x38, 0x37, 0xAA, 0xD1, 0x45, 0xD0, 0x26, 0xB9, 0x8F, 0xE6, 0xB5,
+    0x19, 0x52, 0xC7, 0xAC, 0x3B, 0xF2, 0xEF, 0x86, 0x1B, 0xEE, 0xD7, 0xCA, 0x84, 0xC6, 0xC7, 0x9D,
+    0xB1, 0xB1, 0x48, 0xF9, 0x18, 0x95, 0xA7, 0xB1, 0x2E, 0xC3, 0x1D, 0xA2, 0x07, 0x1C, 0xE4, 0x0C,
+    0x27, 0x99, 0xE3, 0xC2, 0x72, 0xE1, 0x1A, 0x8C, 0x49, 0x37, 0x70, 0x46, 0x54, 0xC9, 0x5C, 0x94,
+    0x23, 0xDA, 0x7A, 0x5C, 0x83, 0x43, 0x5D, 0x8F, 0x45, 0xA0, 0x53, 0xDE, 0x9D, 0xD9, 0xB4, 0x7B,
+    0x89, 0x2D, 0x6D, 0xFD, 0xA8, 0x58, 0x43, 0x6B, 0xFB, 0x6C, 0x43, 0xB0, 0x1A, 0x05, 0x21, 0x82,
+    0x5A, 0xE7, 0x7E, 0xD3, 0x4F, 0x67, 0xD4, 0x86, 0xFD, 0x94, 0x5A, 0xBE, 0xC7, 0x53, 0x0A, 0xBB,
+    0x29, 0x15, 0xFF, 0xDB, 0xFE, 0xF5, 0x41, 0xFB, 0x3F, 0x0A, 0xFE, 0x12, 0x0B, 0x5E, 0x40, 0x2C,
+    0xF8, 0xB4, 0x8B, 0x05, 0xCE, 0x24, 0x16, 0x1C, 0x05, 0x7F, 0xA7, 0x52, 0xF1, 0xD8, 0xBF, 0xCC,
+    0x94, 0x7F, 0x1D, 0x85, 0xEC, 0x41, 0xDC, 0xD5, 0xE3, 0xDC, 0x66, 0x27, 0xAC, 0xE7, 0x56, 0x57,
+    0xBB, 0x57, 0xC1, 0xDD, 0xCB, 0xDB, 0xBE, 0x9C, 0xA0, 0x49, 0xDF, 0xC9, 0xEB, 0xE0, 0xEB, 0xB4,
+    0xF6, 0xC0, 0x40, 0x8E, 0xA2, 0x93, 0x23, 0x84, 0x1C, 0x11, 0xE4, 0x48, 0x30, 0xFE, 0x7F, 0xDB,
+    0xEC, 0xE6, 0x5F, 0xDA, 0x6C, 0x77, 0x77, 0x98, 0x7D, 0x08, 0x39, 0x3E, 0x81, 0x1C, 0x0D, 0xE4,
+    0xA8, 0x26, 0x72, 0x04, 0xB0, 0xA2, 0x70, 0x94, 0x2A, 0xAF, 0x8E, 0x13, 0x2E, 0xD9, 0xE9, 0x0C,
+    0x8C, 0x24, 0xD5, 0xD3, 0x79, 0xDF, 0xC2, 0xB5, 0x13, 0x83, 0x58, 0x37, 0xA1, 0x4D, 0x51, 0xC3,
+    0xC1, 0x9A, 0x1E, 0x83, 0x4C, 0x4C, 0x6F, 0x08, 0x27, 0xF2, 0xEC, 0x0A, 0x03, 0xFE, 0x30, 0xDB,
+    0x03, 0x3A, 0x21, 0xA8, 0x38, 0x93, 0x3A, 0xE9, 0x51, 0x5B, 0xAC, 0xDF, 0xD2, 0xB8, 0x53, 0xDB,
+    0xA9, 0x69, 0xBF, 0x9D, 0x7A, 0xD9, 0x99, 0xDE, 0x4E, 0xFD, 0x76, 0xC6, 0x3D, 0xC7, 0x5B, 0xDE,
+    0xC9, 0x0A, 0x7B, 0xC4, 0x0A, 0x46, 0x9B, 0xFC, 0x13, 0xC7, 0xB7, 0xA9, 0xE2, 0xF3, 0xA3, 0x3D,
+    0x7A, 0x8E, 0xA2, 0x4E, 0x3B, 0xDA, 0x78, 0x1F, 0x97, 0x49, 0x83, 0xC1, 0x4F, 0x07, 0xA9, 0xC5,
+    0xB3, 0xB9, 0xAA, 0xE9, 0x4F, 0xBC, 0x01, 0xBA, 0xC3, 0x85, 0x7A, 0xC5, 0xD0, 0x60, 0x10, 0x1A,
+    0x5D, 0x4E, 0xAE, 0xF9, 0x9F, 0x1F, 0xEC, 0x8B, 0x1C, 0x33, 0x3E, 0x80, 0xC2, 0xF4, 0x87, 0x0C,
+    0x55, 0xF7, 0xBA, 0x7F, 0x43, 0xE8, 0xFE, 0x5B, 0x86, 0x7C, 0x79, 0xB1, 0xD2, 0xBD, 0x79, 0xEB,
+    0xF7, 0xF5, 0x25, 0x9E, 0x52, 0x94, 0xF6, 0x79, 0x3A, 0x67, 0x3A, 0xB4, 0x30, 0x29, 0x7D, 0x65,
+    0x3B, 0xA2, 0x19, 0xD5, 0xC9, 0xDE, 0x61, 0x12, 0x71, 0x0E, 0x8D, 0x0C, 0xC1, 0xB3, 0x7F, 0x93,
+    0x0D, 0x48, 0x9E, 0x25, 0xB1, 0x4B, 0x21, 0x13, 0x67, 0x52, 0x74, 0xA4, 0x19, 0x9F, 0x09, 0x91,
+    0x2E, 0x9C, 0xE3, 0x7B, 0xF6, 0x05, 0x46, 0x47, 0x8B, 0x67, 0x1B, 0x8E, 0x87, 0xCD, 0x4C, 0x7C,
+    0x78, 0x0C, 0x79, 0xE7, 0x86, 0x20, 0x43, 0xFD, 0xAB, 0xB9, 0xCB, 0x8C, 0x7F, 0x96, 0xDF, 0x3C,
+    0x08, 0x59, 0xF7, 0xF3, 0xA9, 0xE5, 0xF9, 0x1E, 0xD4, 0xF4, 0x25, 0xCD, 0x5B, 0x3D, 0x8C, 0xDC,
+    0xD6, 0x11, 0x7E, 0x24, 0x75, 0x22, 0x22, 0x02, 0xA1, 0x0A, 0x29, 0x06, 0x24, 0x40, 0x6C, 0x5C,
+    0x49, 0xB6, 0xD8, 0x1A, 0x89, 0x24, 0xD2, 0x30, 0x10, 0x97, 0xBE, 0xE2, 0x2E, 0x2E, 0x5C, 0x38,
+    0x65, 0xE0, 0x14, 0xD7, 0xA4, 0x70, 0x21, 0x1D, 0x99, 0xA4, 0x70, 0xE1, 0x22, 0x57, 0xC4, 0x69,
+    0xAD, 0x42, 0xC5, 0xE1, 0x52, 0xC4, 0x85, 0x8A, 0x2B, 0x24, 0x91, 0x89, 0x11, 0x18, 0x88, 0x8B,
+    0xD0, 0x0E, 0x0C, 0x97, 0xA2, 0x11, 0x19, 0xB0, 0x65, 0x20, 0x26, 0x02, 0x3A, 0xA6, 0x6C, 0x92,
+    0x2F, 0xDF, 0x37, 0x8F, 0xDC, 0xDD, 0xB3, 0xFE, 0x4E, 0xDA, 0xBD, 0x9F, 0xD3, 0xEE, 0x70, 0x45,
+    0x72, 0xF9, 0xE6, 0xE7, 0xBD, 0x99, 0x6F, 0xE6, 0xCD, 0x2A, 0x57, 0xB7, 0x4A, 0x29, 0x43, 0xAD,
+    0xD5, 0x15, 0x35, 0xF9, 0x8B, 0x72, 0xD2, 0xA4, 0x24, 0xCD, 0x2A, 0x52, 0x5D, 0xF3, 0x9E, 0xAF,
+    0x1A, 0x50, 0xE7, 0x53, 0xDE, 0xEF, 0xBC, 0xDF, 0x81, 0x7A, 0xBF, 0xD3, 0xA0, 0xFE, 0x8B, 0xA4,
+    0x81, 0xD2, 0xB1, 0x52, 0xE7, 0x55, 0x86, 0x2F, 0x5F, 0x54, 0x09, 0xE8, 0xFA, 0x56, 0x86, 0x47,
+    0x68, 0xAD, 0xF1, 0x88, 0x5A, 0x05, 0x95, 0xB2, 0x2B, 0xE5, 0x37, 0xCA, 0x29, 0x95, 0xD7, 0x2A,
+    0xB7, 0x50, 0x6E, 0xA7, 0xFC, 0x1C, 0xE3, 0xAB, 0xEC, 0x9E, 0x5A, 0xD3, 0xA5, 0xEE, 0x55, 0xA6,
+    0x2B, 0x4B, 0x6B, 0x65, 0xE3, 0xAD, 0x56, 0x57, 0x85, 0x17, 0x0B, 0x17, 0x7D, 0xAD, 0xD3, 0xA0,
+    0x4C, 0xF2, 0xA0, 0x88, 0x4A, 0x37, 0x8F, 0xF0, 0x50, 0xBE, 0x93, 0xF2, 0xA8, 0xD6, 0x65, 0x78,
+    0x2F, 0x29, 0x13, 0x9C, 0xCF, 0xF2, 0xE9, 0x3B, 0x29, 0x74, 0x15, 0xE9, 0xDB, 0xF7, 0xBC, 0xDE,
+    0xEF, 0xD5, 0x32, 0x1F, 0xA2, 0x8E, 0x50, 0xD2, 0xF4, 0x0C, 0x39, 0xFF, 0xFC, 0x26, 0xA8, 0x2D,
+    0x52, 0xAB, 0x4C, 0x64, 0x5C, 0x52, 0x87, 0x44, 0x76, 0x70, 0xE2, 0xE6, 0xBE, 0x72, 0xBE, 0x59,
+    0x57, 0x16, 0x19, 0x4C, 0xAA, 0x09, 0x73, 0x0B, 0xD1, 0xC3, 0x81, 0x4A, 0xC7, 0xD1, 0xB6, 0x49,
+    0x1C, 0x19, 0xDE, 0x13, 0x56, 0x7C, 0x43, 0xE5, 0x8C, 0xAB, 0xF9, 0x1F, 0x4B, 0xA7, 0x8B, 0x91,
+    0xF7, 0x0A, 0x1E, 0x02, 0xE1, 0x1C, 0x0C, 0xEC, 0xE2, 0x6B, 0x2E, 0x3F, 0x6B, 0x7C, 0xC8, 0x0A,
+    0x4E, 0x77, 0xF2, 0x21, 0x82, 0x52, 0xFE, 0x00, 0xA7, 0xD4, 0x25, 0x0E, 0x7B, 0x62, 0x9C, 0x07,
+    0x47, 0x35, 0x54, 0x92, 0x80, 0x01, 0x0B, 0x52, 0xE4, 0x6E, 0xAB, 0xA2, 0xC2, 0x87, 0xA8, 0x39,
+    0x84, 0x3D, 0xA5, 0x22, 0x0A, 0x43, 0x5E, 0x8C, 0x2A, 0x1F, 0x44, 0xE4, 0xAA, 0xDC, 0x17, 0x92,
+    0x40, 0x3B, 0x2A, 0xF6, 0x3A, 0x65, 0x15, 0xB6, 0xDE, 0x08, 0x72, 0xE8, 0x03, 0x3A, 0xF5, 0x38,
+    0x86, 0x3A, 0xC9, 0xE1, 0x56, 0x63, 0x08, 0x1E, 0x0B, 0x4B, 0x1E, 0xEE, 0x0F, 0xA0, 0x83, 0x23,
+    0x03, 0x27, 0xC9, 0x3D, 0x68, 0x46, 0xA7, 0x7E, 0x15, 0xE5, 0x51, 0x11, 0xE6, 0x51, 0x1E, 0xE6,
+    0x49, 0x7E, 0x52, 0xAC, 0x31, 0xFB, 0x4E, 0x86, 0x37, 0x06, 0xCE, 0x83, 0xDA, 0xCD, 0x3D, 0xE1,
+    0x1D, 0xCF, 0xB3, 0x62, 0x3E, 0x7F, 0xD4, 0xAC, 0xA3, 0x21, 0xAB, 0xFF, 0x3E, 0xC6, 0x08, 0xD5,
+    0x0D, 0xCA, 0x7B, 0xE2, 0x40, 0x04, 0x5E, 0x8A, 0xCD, 0xCD, 0x38, 0x61, 0xD7, 0x37, 0x31, 0x67,
+    0x82, 0xD8, 0xC2, 0x32, 0x5D, 0x9C, 0xC0, 0xA2, 0x55, 0xCE, 0x5B, 0x25, 0xB3, 0x4A, 0x26, 0xD5,
+    0x59, 0x35, 0xFB, 0xB7, 0xFF, 0x02, 0x87, 0xA5, 0xF9, 0x02, 0xBF, 0x79, 0x2C, 0x9D, 0x72, 0xB2,
+    0x08, 0x81, 0xC5, 0x90, 0xA1, 0x6A, 0x07, 0xE3, 0x8A, 0x99, 0xCD, 0x52, 0x5A, 0x3D, 0x10, 0x81,
+    0x97, 0x60, 0x4D, 0x5A, 0xD5, 0x6E, 0xE0, 0x6E, 0xB3, 0xC6, 0x7C, 0x91, 0x4A, 0x58, 0x94, 0xC0,
+    0x4B, 0xE2, 0x19, 0xFD, 0xF4, 0x0A, 0x3D, 0xC7, 0x67, 0x8D, 0xCC, 0x6F, 0xF1, 0x31, 0x99, 0xB8,
+    0x94, 0x93, 0x53, 0x8F, 0xAE, 0xF5, 0x35, 0xB0, 0xAC, 0xC9, 0x9E, 0xAD, 0xE9, 0xF2, 0x21, 0xBF,
+    0xDF, 0x92, 0xC2, 0x4F, 0x81, 0x3A, 0x9A, 0xD4, 0xD6, 0xB1, 0xC5, 0x0F, 0xD4, 0x8E, 0xDA, 0x41,
+    0xF3, 0xC9, 0x67, 0x6B, 0xA0, 0xB1, 0xDC, 0x2F, 0xDF, 0xED, 0x49, 0x3D, 0x79, 0x5A, 0xD0, 0xF0,
+    0x24, 0x54, 0x75, 0x4E, 0xC6, 0xC2, 0xB8, 0x77, 0xA6, 0x36, 0xD6, 0x2D, 0x54, 0xA4, 0xD6, 0xDA,
+    0x10, 0xAC, 0x7B, 0x6D, 0x44, 0xA6, 0xDB, 0x0B, 0x42, 0x9F, 0x15, 0x4A, 0x8F, 0xF7, 0x16, 0xA8,
+    0xA7, 0xBF, 0x05, 0x0D, 0xEA, 0xA4, 0xA5, 0xDC, 0x3E, 0x83, 0x40, 0x6E, 0x28, 0x06, 0x81, 0x6C,
+    0x86, 0xBA, 0xF7, 0x51, 0x6F, 0x72, 0x0F, 0xAC, 0xDA, 0xD2, 0x44, 0x21, 0x14, 0xE5, 0xEB, 0x6F,
+    0xF5, 0x06, 0xB8, 0xFA, 0x98, 0xD3, 0xE1, 0xC8, 0xD3, 0x6B, 0x23, 0x84, 0x0B, 0xD7, 0x29, 0xBE,
+    0xBB, 0x18, 0x6D, 0x48, 0xF0, 0x5D, 0x23, 0x21, 0xC3, 0x4B, 0xAF, 0x75, 0x31, 0x7D, 0x7D, 0x69,
+    0xFE, 0x4B, 0x65, 0x58, 0x1A, 0xBA, 0xF0, 0xF5, 0xF7, 0xAD, 0x0A, 0xEB, 0xA8, 0x35, 0x8A, 0x10,
+    0x3D, 0x88, 0xA0, 0x22, 0xF3, 0x2C, 0xF1, 0x5A, 0x23, 0xBB, 0x88, 0x2E, 0x92, 0x8B, 0xE0, 0x46,
+    0x6E, 0x11, 0x3B, 0xE4, 0xDC, 0x10, 0xB2, 0xB4, 0xBA, 0x3C, 0x99, 0x17, 0x3A, 0xA7, 0x22, 0x72,
+    0xF0, 0xE9, 0x51, 0x2C, 0x67, 0x42, 0x2C, 0x91, 0x5B, 0xCD, 0x12, 0xDD, 0x8E, 0xE4, 0x07, 0x17,
+    0x06, 0xB2, 0x4C, 0x52, 0x09, 0xC1, 0xF3, 0xEC, 0x8A, 0x62, 0x57, 0x1C, 0x43, 0x20, 0x8D, 0x35,
+    0x03, 0x69, 0x54, 0x82, 0x50, 0x09, 0x9D, 0xF8, 0x35, 0x26, 0x7E, 0x19, 0x60, 0x11, 0xF8, 0x15,
+    0x84, 0xAB, 0xB3, 0x4F, 0x5E, 0xAF, 0xB1, 0x88, 0xEA, 0xEC, 0xEE, 0xD6, 0xD5, 0x71, 0xFA, 0x47,
+    0x85, 0xAC, 0x9C, 0xAB, 0x7E, 0x63, 0x97, 0x58, 0x32, 0x58, 0x65, 0xBD, 0x99, 0xFE, 0x47, 0xD4,
+    0x71, 0x46, 0x63, 0x44, 0xAF, 0xF0, 0xD5, 0x8A, 0x86, 0x2E, 0xB8, 0xE8, 0xE3, 0x99, 0x10, 0xB6,
+    0x7F, 0xF2, 0x61, 0xA9, 0x3B, 0x80, 0x2D, 0xF6, 0x37, 0x09, 0x4C, 0x8B, 0x59, 0x17, 0xD5, 0x83,
+    0x13, 0x5E, 0x90, 0xAC, 0x6A, 0x65, 0x64, 0xC4, 0xD1, 0x82, 0xDD, 0xF8, 0xE0, 0xCD, 0xFD, 0x16,
+    0x53, 0xBC, 0x57, 0x50, 0x19, 0x4F, 0x46, 0x0F, 0xB8, 0xC3, 0x85, 0xCF, 0x2F, 0xE6, 0xFE, 0x09,
+    0xA2, 0x14, 0x9D, 0xA6, 0x5D, 0x8D, 0x58, 0xCC, 0x15, 0x52, 0xAB, 0x21, 0x6C, 0x0C, 0x1E, 0x74,
+    0x3E, 0x99, 0x30, 0xAE, 0x8D, 0x27, 0xBA, 0x85, 0xC1, 0x78, 0x04, 0x34, 0x3E, 0x3F, 0x23, 0x24,
+    0xC1, 0xB7, 0x60, 0xF2, 0x62, 0x9A, 0x5E, 0x22, 0x3E, 0x0B, 0xDE, 0xE6, 0xBA, 0x67, 0x90, 0x16,
+    0xE3, 0xAA, 0x95, 0x83, 0x98, 0xBE, 0x82, 0x3F, 0x1E, 0x18, 0xA9, 0x16, 0x31, 0x7D, 0x4F, 0xCA,
+    0xC3, 0x88, 0x3B, 0x87, 0x18, 0xE5, 0x54, 0xAD, 0xC4, 0xAE, 0x4B, 0x6A, 0x8C, 0x63, 0xE6, 0xCF,
+    0xD6, 0x7D, 0x2C, 0x92, 0x57, 0x74, 0xAB, 0xF0, 0xA0, 0xC0, 0x83, 0x6E, 0x23, 0xD0, 0xDA, 0xC0,
+    0xEC, 0xD4, 0xC4, 0xDF, 0x91, 0x96, 0x53, 0x34, 0x3F, 0x52, 0x28, 0x21, 0x36, 0x14, 0x57, 0x83,
+    0x96, 0x77, 0xE2, 0xEB, 0xA1, 0x50, 0xF3, 0x22, 0x38, 0xA7, 0x6F, 0x8E, 0x19, 0xC0, 0x93, 0x3E,
+    0xA3, 0x95, 0xB4, 0x20, 0x05, 0x11, 0x5A, 0x88, 0x3C, 0x3F, 0x63, 0x50, 0x6A, 0x6E, 0x29, 0xD1,
+    0x8E, 0x1A, 0xE1, 0xD9, 0x3A, 0x2E, 0xFC, 0x4F, 0xF3, 0x2B, 0xEF, 0x2A, 0x04, 0xF0, 0xBF, 0x03,
+    0x3C, 0x87, 0x85, 0x0A, 0x8B, 0xA0, 0x9C, 0x21, 0x7E, 0x19, 0xE6, 0xCA, 0xFB, 0x26, 0x49, 0x21,
+    0x07, 0xB4, 0x60, 0x7F, 0xBE, 0x3C, 0x00, 0x7E, 0xCE, 0x01, 0xFA, 0xFA, 0x82, 0x0F, 0xA8, 0x99,
+    0xE9, 0xC1, 0x61, 0xDF, 0xFD, 0x73, 0xA7, 0x32, 0x65, 0x75, 0x0A, 0xB7, 0xB6, 0x20, 0x36, 0x7C,
+    0x7A, 0x0C, 0x18, 0x1C, 0x52, 0x8B, 0x76, 0xF6, 0xE5, 0x24, 0x83, 0xF3, 0xE2, 0xF3, 0x9C, 0xA9,
+    0x9F, 0xDF, 0x90, 0xA9, 0xDA, 0x3C, 0x30, 0x83, 0x3B, 0x04, 0x3A, 0x14, 0x55, 0xD1, 0x23, 0x22,
+    0x93, 0x4B, 0x94, 0x49, 0xE5, 0x54, 0x22, 0x89, 0x96, 0x3A, 0x40, 0x1D, 0x0E, 0x5A, 0x4A, 0xF2,
+    0xC9, 0x6C, 0x1C, 0x3E, 0x9F, 0x8A, 0xD5, 0xCE, 0xBF, 0x43, 0x33, 0x0F, 0xC3, 0x09, 0xE4, 0x14,
+    0x32, 0xEB, 0x71, 0x0F, 0x48, 0x87, 0x87, 0x46, 0x3F, 0xA3, 0x9B, 0x94, 0xCF, 0x91, 0x7C, 0xBE,
+    0x21, 0xB4, 0x16, 0x6A, 0x40, 0xCE, 0xF1, 0xF1, 0x84, 0x71, 0xF6, 0x24, 0x5E, 0x39, 0x7D, 0xC2,
+    0x41, 0xCD, 0x43, 0x61, 0x2E, 0x10, 0x46, 0x23, 0xA9, 0xC3, 0x08, 0x20, 0x76, 0x2A, 0x46, 0x0A,
+    0x2B, 0x1E, 0xA1, 0x03, 0x14, 0x5C, 0x87, 0xBA, 0x0D, 0x75, 0x1D, 0xE8, 0x46, 0x00, 0xE9, 0x14,
+    0x6F, 0x3E, 0x92, 0x12, 0x70, 0x8E, 0x74, 0x37, 0xF7, 0x93, 0x9A, 0xE7, 0x9F, 0xD3, 0x77, 0x4E,
+    0xEB, 0x2F, 0x22, 0xDD, 0x60, 0x5C, 0xE3, 0xB6, 0x19, 0x98, 0x6C, 0x3A, 0x6D, 0xC9, 0x31, 0x24,
+    0xDD, 0x38, 0x32, 0x71, 0x37, 0x19, 0x2B, 0x08, 0x41, 0x37, 0xD6, 0x12, 0xEE, 0x23, 0x61, 0x0D,
+    0x02, 0xA5, 0x39, 0xFA, 0x2B, 0x02, 0x6B, 0x0C, 0xE3, 0x10, 0x47, 0xE3, 0xEA, 0xAE, 0x88, 0x8B,
+    0x9B, 0x11, 0x02, 0x37, 0x74, 0x9D, 0xE8, 0x52, 0x37, 0x0F, 0x53, 0x87, 0x7C, 0x8E, 0x13, 0x0A,
+    0xDC, 0xFD, 0x44, 0xBF, 0xF3, 0x0B, 0xFD, 0xC7, 0x3D, 0x51, 0xC7, 0x03, 0x04, 0x7E, 0xB5, 0x07,
+    0xA2, 0xCD, 0x08, 0x6D, 0x1F, 0x2C, 0xF5, 0xA7, 0x4F, 0x28, 0xF5, 0x0F, 0x04, 0xB6, 0x88, 0xB7,
+    0x9E, 0x4F, 0xFA, 0x9B, 0xB7, 0x74, 0x5B, 0x61, 0x69, 0xC8, 0xC4, 0x88, 0xA8, 0x82, 0x66, 0xCC,
+    0x4F, 0x76, 0xFB, 0xC2, 0xFD, 0x10, 0x26, 0x12, 0x31, 0xFC, 0xFA, 0x4C, 0xA4, 0xD7, 0xD7, 0x75,
+    0x7B, 0x1D, 0x53, 0x50, 0x9E, 0x79, 0x6A, 0x4B, 0x05, 0x22, 0xB3, 0x7A, 0xE4, 0x0B, 0x1A, 0x39,
+    0xAD, 0xEF, 0x40, 0x17, 0x81, 0xAE, 0xF0, 0x32, 0x99, 0xC4, 0x9C, 0xFC, 0x64, 0x3A, 0xC7, 0xEB,
+    0xE4, 0x2A, 0xD9, 0x78, 0x63, 0x53, 0x25, 0x9D, 0x42, 0x4A, 0xED, 0x3C, 0xF2, 0x05, 0x2D, 0xAD,
+    0xE9, 0x8D, 0x4C, 0x57, 0xC8, 0x01, 0x90, 0x01, 0x04, 0x7F, 0xAA, 0x7C, 0x5D, 0x3A, 0xF0, 0x0C,
+    0x27, 0xD4, 0xFC, 0xFC, 0x1C, 0x57, 0xF1, 0x75, 0xBB, 0x58, 0x7F, 0x2D, 0x8F, 0x74, 0xEA, 0xF5,
+    0x83, 0x1F, 0x79, 0x52, 0xC6, 0xE6, 0xB5, 0x11, 0xA2, 0x7C, 0x43, 0x97, 0x05, 0x87, 0xE5, 0x34,
+    0xB2, 0xFC, 0xE0, 0x36, 0x97, 0x95, 0xD3, 0xD2, 0x29, 0x32, 0x4D, 0xBD, 0x36, 0x2C, 0xC0, 0x27,
+    0x65, 0x4C, 0x6D, 0x4B, 0x91, 0x32, 0x27, 0x26, 0xF5, 0x4B, 0x56, 0x1C, 0x2D, 0xD1, 0x9B, 0x19,
+    0x9D, 0x89, 0xC5, 0xAF, 0x26, 0xBE, 0x67, 0x2E, 0x11, 0x9E, 0x42, 0x63, 0x09, 0x97, 0x59, 0xB3,
+    0xA6, 0xBF, 0xC0, 0x43, 0xC6, 0x24, 0x7C, 0x4F, 0xA8, 0x91, 0x14, 0x7C, 0x82, 0x62, 0x5C, 0x93,
+    0x4E, 0xCD, 0x52, 0x2C, 0xD7, 0xA1, 0x26, 0xA1, 0x98, 0xC6, 0xF3, 0x74, 0x39, 0x9E, 0x5E, 0x86,
+    0xF3, 0x73, 0x98, 0x69, 0xC3, 0x0C, 0x51, 0x45, 0x52, 0xC2, 0x1A, 0xC7, 0x66, 0x22, 0xD2, 0x1B,
+    0x9B, 0xF6, 0xD6, 0x46, 0xD2, 0x39, 0xBA, 0x84, 0xF8, 0x49, 0xE9, 0xF0, 0x96, 0x27, 0x22, 0x50,
+    0x4A, 0x54, 0x42, 0x2D, 0x51, 0x49, 0xC5, 0x4C, 0x2B, 0x4F, 0x42, 0x8A, 0x11, 0xB5, 0x30, 0x12,
+    0x06, 0xE4, 0x08, 0x21, 0x4A, 0x5C, 0x35, 0x10, 0x0D, 0xD1, 0x35, 0xB1, 0x35, 0x91, 0xF5, 0x88,
+    0xAB, 0x11, 0xA0, 0x90, 0x5E, 0xF4, 0x06, 0xF1, 0x24, 0xF9, 0x62, 0xDF, 0xC4, 0xFE, 0x60, 0x84,
+    0x99, 0x0B, 0x32, 0x05, 0x95, 0x6D, 0x48, 0x02, 0xE3, 0x70, 0xC4, 0x1C, 0x89, 0xCD, 0x15, 0xAB,
+    0x3E, 0x2E, 0x31, 0x78, 0x97, 0x0E, 0xE6, 0x3E, 0x7F, 0x43, 0x83, 0x40, 0xC7, 0xC0, 0x8E, 0x19,
+    0x13, 0xC4, 0x26, 0xD1, 0x71, 0x48, 0x87, 0xCC, 0x47, 0x79, 0xB5, 0x94, 0x6E, 0x72, 0xD2, 0x50,
+    0x92, 0x1C, 0x56, 0xBC, 0x35, 0x73, 0x2A, 0x4B, 0x3B, 0x52, 0xFE, 0xF3, 0x53, 0x52, 0x32, 0x6A,
+    0x49, 0xDE, 0x67, 0x31, 0x4E, 0x83, 0xBE, 0x42, 0x64, 0xAF, 0xDD, 0x5E, 0xEE, 0xD4, 0x2C, 0x3D,
+    0x5B, 0x5A, 0x9E, 0x63, 0xCA, 0x41, 0x11, 0x83, 0x79, 0x1C, 0xB6, 0x9C, 0x23, 0x1E, 0xCB, 0x3E,
+    0xAD, 0x65, 0xE0, 0xE2, 0xF4, 0x4F, 0x62, 0xFF, 0x50, 0xBD, 0x0F, 0xE4, 0x8C, 0x94, 0xCF, 0xA7,
+    0xF5, 0xF3, 0xC7, 0x85, 0xC6, 0x63, 0x5B, 0x1B, 0x4E, 0xE7, 0xE9, 0xC2, 0xE9, 0x2C, 0xAE, 0x04,
+    0x2E, 0xF6, 0x0E, 0xEB, 0xD2, 0xE9, 0x02, 0x56, 0xC1, 0x13, 0xCE, 0x36, 0x51, 0x2C, 0xD0, 0x85,
+    0xA3, 0x13, 0x5E, 0x15, 0x98, 0xE5, 0xF3, 0x66, 0xE8, 0xD7, 0xED, 0x6D, 0x9D, 0x72, 0xE9, 0x20,
+    0x0D, 0xAB, 0x4E, 0x37, 0xB3, 0xAC, 0x65, 0x02, 0x28, 0x48, 0xA4, 0x28, 0x48, 0xCC, 0x43, 0x27,
+    0xFF, 0xC6, 0xE6, 0x31, 0x4E, 0x4B, 0x0C, 0xE9, 0x3D, 0x70, 0xC8, 0x75, 0x19, 0x32, 0xE6, 0x90,
+    0x38, 0xA7, 0xA1, 0x89, 0x21, 0x92, 0xF9, 0x2D, 0x08, 0x74, 0xE5, 0xF6, 0x8E, 0x0C, 0xA9, 0x39,
+    0x64, 0xD8, 0x98, 0xC2, 0xAA, 0x2C, 0x18, 0xB7, 0x19, 0xF7, 0x30, 0xA2, 0xD9, 0x02, 0x8C, 0x92,
+    0x70, 0x13, 0x32, 0x4F, 0xA1, 0xE5, 0x1F, 0x9A, 0x9A, 0xEE, 0x82, 0xFC, 0x92, 0xE4, 0xBD, 0x1D,
+    0x29, 0xAC, 0xB3, 0xA3, 0x34, 0xB1, 0x4C, 0xD8, 0x19, 0xE5, 0x84, 0x5E, 0x43, 0x4C, 0xA3, 0x05,
+    0x82, 0xC7, 0xF9, 0x9F, 0xC7, 0x3A, 0xA5, 0x7D, 0xE2, 0x7F, 0xE6, 0xAF, 0x1B, 0xCD, 0x67, 0x4D,
+    0xEA, 0x13, 0x03, 0x20, 0x9C, 0x5F, 0xA0, 0x01, 0xBD, 0x37, 0x12, 0x58, 0x00, 0x5B, 0x73, 0xFA,
+    0x08, 0x48, 0xE9, 0x15, 0x90, 0xD2, 0xCF, 0x21, 0x65, 0x90, 0xCA, 0x6A, 0x02, 0x79, 0x6E, 0x4F,
+    0xA4, 0xCC, 0x3A, 0xBF, 0x08, 0xBA, 0x00, 0x70, 0x27, 0x04, 0x67, 0x17, 0xF1, 0x7E, 0x56, 0x56,
+    0xC4, 0xD3, 0xBC, 0xB9, 0x7E, 0x21, 0x97, 0xEC, 0xAD, 0x3D, 0x81, 0xA9, 0x96, 0x64, 0x89, 0x17,
+    0x96, 0x96, 0x2C, 0xC4, 0x7C, 0x3A, 0x15, 0x3F, 0x99, 0x10, 0x66, 0x69, 0x3F, 0x9E, 0x49, 0x2B,
+    0xC6, 0xEA, 0xAA, 0xB8, 0x90, 0xCC, 0xF1, 0xE8, 0xC6, 0x3C, 0x42, 0xD8, 0xF4, 0x54, 0x21, 0x09,
+    0xF7, 0x00, 0x18, 0x93, 0xE4, 0x82, 0xAB, 0x65, 0xAD, 0x81, 0xFC, 0x74, 0xF7, 0x42, 0x3C, 0x7C,
+    0x32, 0x1D, 0x77, 0x7A, 0xA0, 0xA9, 0x02, 0xD1, 0x8E, 0xD1, 0xAD, 0x53, 0x3F, 0x7B, 0xF8, 0x64,
+    0x32, 0x85, 0x1D, 0x93, 0x44, 0x9B, 0xC8, 0x29, 0x9E, 0xC8, 0x2B, 0x76, 0xD6, 0x24, 0x22, 0x62,
+    0x61, 0x60, 0x77, 0x78, 0x6D, 0xC4, 0xDC, 0x5C, 0xE6, 0x17, 0x92, 0x3E, 0xD0, 0x5A, 0x68, 0x4B,
+    0xFA, 0x6F, 0x4D, 0xFA, 0x99, 0x4E, 0x41, 0xCB, 0x2C, 0x27, 0x8D, 0x2A, 0xD2, 0xA0, 0x21, 0xF5,
+    0x3A, 0x52, 0x47, 0x93, 0x2A, 0xA4, 0x6B, 0xA0, 0x99, 0x26, 0x8D, 0x84, 0xFA, 0x42, 0x5D, 0x56,
+    0xB6, 0xE8, 0x93, 0xCE, 0xF5, 0x64, 0x08, 0x71, 0x42, 0x25, 0xD4, 0x08, 0x6B, 0x6A, 0xDC, 0x14,
+    0x90, 0x58, 0xA9, 0xA2, 0x74, 0x5C, 0x66, 0x43, 0x25, 0x5C, 0x9D, 0xDD, 0x84, 0xA7, 0x8B, 0x5A,
+    0x44, 0x49, 0x77, 0xCE, 0x4C, 0xE5, 0x8E, 0xC9, 0x54, 0x0E, 0x58, 0xE0, 0x1D, 0x91, 0xAA, 0x9C,
+    0x89, 0x54, 0x62, 0xAF, 0xF3, 0x3B, 0x23, 0xD5, 0xA2, 0x85, 0x9F, 0x1D, 0xBC, 0x9F, 0x38, 0x33,
+    0x49, 0xC2, 0x27, 0xCE, 0xCC, 0x24, 0xB9, 0x76, 0x25, 0x79, 0x74, 0x27, 0xD9, 0x7B, 0xD4, 0x4D,
+    0xE0, 0xD6, 0x90, 0x20, 0x1F, 0x82, 0xA9, 0x23, 0xBB, 0x8A, 0x97, 0x18, 0x48, 0xFD, 0x0F, 0xAA,
+    0x61, 0x87, 0x5E, 0xD6, 0xE6, 0x64, 0x57, 0x71, 0xD1, 0xDA, 0x33, 0x26, 0x1A, 0x1A, 0x15, 0x86,
+    0xCA, 0xC9, 0x78, 0xF0, 0xCC, 0xC1, 0xF9, 0xC7, 0xD6, 0xCB, 0x60, 0xD2, 0x7B, 0x5B, 0xBF, 0x0B,
+    0x7E, 0xD6, 0x95, 0xBE, 0x87, 0x60, 0x7D, 0x1D, 0xD8, 0xC5, 0x54, 0x2D, 0xB9, 0x9F, 0xF9, 0xF4,
+    0x07, 0xE0, 0xB6, 0x9A, 0xF5, 0xE8, 0x86, 0xD8, 0xD2, 0x67, 0xAA, 0xF7, 0x34, 0x36, 0x28, 0xA6,
+    0x36, 0xF0, 0xC5, 0x06, 0xAE, 0xD8, 0xC0, 0x1E, 0x6C, 0x70, 0x7B, 0xAA, 0xFD, 0x40, 0xA8, 0x27,
+    0xD4, 0x11, 0x1B, 0x58, 0xC6, 0x06, 0x99, 0xD8, 0xC0, 0x14, 0x76, 0x0C, 0xC2, 0x3A, 0xA3, 0xA6,
+    0xB3, 0xF7, 0xE2, 0xB4, 0xE0, 0xE3, 0x35, 0x53, 0x40, 0xB6, 0x20, 0x7B, 0xA4, 0xB4, 0x47, 0x4A,
+    0x7B, 0xA4, 0xE3, 0xDE, 0xB9, 0x21, 0xA3, 0x57, 0x96, 0x54, 0x80, 0x18, 0x48, 0x45, 0x1B, 0x54,
+    0x93, 0x00, 0x20, 0xA1, 0x93, 0xED, 0x35, 0x72, 0x26, 0xCD, 0x25, 0xC9, 0xB0, 0xD5, 0x08, 0x23,
+    0x22, 0xA5, 0xF0, 0x6B, 0xBE, 0x5C, 0x6E, 0xD3, 0xD1, 0x9B, 0xC2, 0x64, 0x8E, 0x5C, 0x32, 0x7B,
+    0x85, 0x23, 0x8D, 0xEF, 0xA3, 0xC3, 0x3D, 0xE6, 0x7E, 0x7E, 0xB7, 0x1F, 0x9E, 0xE3, 0xC9, 0x33,
+    0xED, 0x5E, 0x6A, 0x85, 0xD9, 0x5D, 0xF2, 0x69, 0x36, 0xA1, 0x65, 0x0B, 0xF8, 0xBE, 0xBD, 0xB7,
+    0xB5, 0x7B, 0x82, 0xF0, 0xFC, 0x3A, 0xA8, 0xC2, 0xD2, 0x6B, 0xA2, 0xDC, 0x6D, 0x93, 0xDC, 0xE9,
+    0xB2, 0xE9, 0xBB, 0xE7, 0x91, 0xE7, 0x78, 0x2D, 0x2A, 0xBC, 0xC6, 0xAF, 0xFC, 0xCA, 0xED, 0x81,
+    0x80, 0xA7, 0x7B, 0x6F, 0x2C, 0x46, 0xFB, 0x8A, 0xFB, 0xB7, 0xFE, 0x27, 0x8D, 0x84, 0x20, 0x81,
+    0x99, 0xD2, 0x6A, 0x30, 0xF5, 0x2C, 0x87, 0x42, 0x03, 0x2A, 0xB6, 0x94, 0x5D, 0x78, 0xB1, 0x75,
+    0x6F, 0x0D, 0x06, 0xEC, 0x8D, 0xD9, 0xC6, 0x12, 0xDB, 0x22, 0xB4, 0xA1, 0x56, 0xA5, 0x9A, 0xD8,
+    0x87, 0xF4, 0x0D, 0x0D, 0x11, 0xB0, 0x5B, 0xD2, 0x97, 0xF9, 0xBF, 0xAD, 0x25, 0x0A, 0xC6, 0x87,
+    0x4A, 0x1B, 0x4B, 0x2F, 0xAE, 0xA8, 0xE8, 0xFD, 0x46, 0x25, 0x88, 0x0B, 0x6D, 0x90, 0xDA, 0xD5,
+    0x25, 0x08, 0x71, 0x62, 0x81, 0xDA, 0x18, 0x45, 0xC5, 0x5F, 0xA3, 0xA4, 0x28, 0xD7, 0x18, 0x3E,
+    0x1B, 0x57, 0xAA, 0xBC, 0x37, 0xC0, 0x1D, 0x0E, 0x97, 0xC1, 0x33, 0x0E, 0xCF, 0x46, 0xD5, 0xD8,
+    0x12, 0xC2, 0x43, 0x32, 0x3D, 0x68, 0x2C, 0x40, 0x39, 0xE4, 0xC9, 0x8E, 0x6B, 0xC3, 0x9D, 0xC3,
+    0xF7, 0xCC, 0x53, 0x96, 0xCC, 0x33, 0x03, 0x4F, 0x46, 0x38, 0x0F, 0xE1, 0x71, 0xB8, 0x44, 0xE9,
+    0x35, 0x2C, 0x2E, 0xBC, 0xF4, 0xB3, 0x2D, 0x11, 0xB2, 0xB1, 0x65, 0x49, 0x6A, 0xA5, 0x5F, 0xD1,
+    0x54, 0x58, 0xA0, 0xFF, 0x0A, 0x35, 0x96, 0xF0, 0x43, 0x3A, 0x86, 0x6C, 0xC8, 0x04, 0x53, 0x88,
+    0xD9, 0x03, 0xDB, 0x50, 0xEA, 0xD5, 0x8C, 0x07, 0xEE, 0xC5, 0xF1, 0xB0, 0xB5, 0x95, 0xF2, 0xA4,
+    0x20, 0x1F, 0x39, 0xC8, 0x17, 0x98, 0x9B, 0x7B, 0xF0, 0x35, 0x71, 0x50, 0xF9, 0xBA, 0x08, 0x62,
+    0x68, 0xE5, 0x36, 0x17, 0x5E, 0xD6, 0xD9, 0xDA, 0xCC, 0x38, 0x01, 0x44, 0x82, 0x45, 0xA4, 0x77,
+    0x64, 0x40, 0x23, 0x43, 0x05, 0xBB, 0x55, 0xB3, 0x80, 0xE4, 0xFE, 0x3E, 0x85, 0x42, 0x50, 0xAB,
+    0x78, 0xC7, 0x50, 0x12, 0xDF, 0x60, 0x86, 0x86, 0xD5, 0xF4, 0x6A, 0xC6, 0x44, 0xF6, 0x6B, 0x49,
+    0x6D, 0x65, 0x5C, 0xED, 0x49, 0xB2, 0xEB, 0xC8, 0x19, 0x5B, 0x92, 0x5D, 0xB5, 0x23, 0xD9, 0x65,
+    0xD4, 0x8B, 0x83, 0x69, 0xB2, 0xDB, 0x58, 0xCC, 0xEA, 0x57, 0x8D, 0xA7, 0x73, 0xDA, 0xFB, 0x1A,
+    0xB2, 0xCE, 0x5E, 0x0B, 0xCB, 0xA8, 0xCD, 0x1A, 0xB7, 0xD3, 0xAD, 0xA3, 0x7F, 0xDF, 0x38, 0xDA,
+    0x29, 0xF9, 0xF4, 0xC7, 0x41, 0xF5, 0x50, 0x5F, 0xC5, 0x7C, 0xA8, 0x0F, 0x5C, 0xB2, 0xD9, 0xBF,
+    0x68, 0xDC, 0x06, 0x78, 0xC0, 0xEE, 0xC1, 0xBC, 0x72, 0x8E, 0x7F, 0x56, 0x6B, 0xB6, 0x82, 0xB9,
+    0xFB, 0xE0, 0xE4, 0xC3, 0x2A, 0x31, 0x65, 0x91, 0x2B, 0x02, 0x8B, 0x64, 0x07, 0x18, 0xB3, 0x34,
+    0x1D, 0x37, 0xF8, 0xA7, 0x9B, 0xC0, 0x07, 0x3D, 0x0F, 0x88, 0xD3, 0x9C, 0xD2, 0x4F, 0x55, 0x0B,
+    0x1D, 0x25, 0xAD, 0xD9, 0xF7, 0x1F, 0xD0, 0xD9, 0xFC, 0xFA, 0xE1, 0x83, 0xA4, 0xA1, 0x00, 0x5A,
+    0xB9, 0x65, 0x30, 0xE2, 0xE8, 0x42, 0x88, 0x36, 0xFA, 0xAC, 0xF2, 0x2A, 0xAF, 0xF5, 0x0B, 0xA7,
+    0x0D, 0x0A, 0xBB, 0x09, 0x4B, 0x6B, 0x83, 0xD8, 0xC4, 0x17, 0x60, 0x42, 0xB4, 0x40, 0xA4, 0x86,
+    0x45, 0x1C, 0x40, 0x3E, 0xD9, 0x63, 0x0C, 0x7A, 0x0B, 0x7E, 0x10, 0x60, 0x41, 0x63, 0x4D, 0xF5,
+    0x51, 0x6E, 0x75, 0x61, 0xE9, 0x34, 0x7E, 0xBF, 0x56, 0xCA, 0x86, 0x95, 0x71, 0xD6, 0xB1, 0x84,
+    0x71, 0x61, 0x86, 0x7D, 0x23, 0x33, 0x8D, 0x86, 0x59, 0x43, 0x57, 0xA1, 0x82, 0x3C, 0x8A, 0xC3,
+    0x34, 0x80, 0x1B, 0xF8, 0x91, 0x74, 0x72, 0x04, 0x30, 0x0C, 0x80, 0x90, 0xE9, 0xCA, 0x0D, 0x45,
+    0x65, 0xF9, 0x19, 0x15, 0xE6, 0xD1, 0x70, 0x67, 0x78, 0x97, 0x3B, 0x48, 0xCD, 0x10, 0x6F, 0x57,
+    0x4C, 0xA6, 0x11, 0xE2, 0xDE, 0x75, 0x2C, 0x9A, 0xC6, 0x2D, 0x10, 0x00, 0x96, 0xF7, 0x54, 0x26,
+    0x66, 0x61, 0xDC, 0x56, 0x83, 0x4E, 0x59, 0xFC, 0xF3, 0xF2, 0x70, 0xBA, 0xA9, 0xBE, 0x08, 0x99,
+    0xF6, 0x8A, 0x77, 0x97, 0x3D, 0x0F, 0xB4, 0x79, 0x37, 0x94, 0xCF, 0xD6, 0xCD, 0x76, 0x18, 0xD1,
+    0xEE, 0xBC, 0x7C, 0x13, 0x2B, 0x32, 0x20, 0xD3, 0x77, 0x71, 0xF1, 0xD9, 0xB5, 0x69, 0x3D, 0xE0,
+    0x22, 0x5B, 0xC6, 0x3F, 0xDA, 0x85, 0xF6, 0x01, 0xFC, 0x14, 0x7B, 0x59, 0xCB, 0x7B, 0x3A, 0xEF,
+    0x68, 0x0F, 0xDA, 0xC5, 0xA9, 0x5B, 0xD3, 0x72, 0x9C, 0x94, 0x63, 0xF6, 0xBC, 0x10, 0x1B, 0x31,
+    0xCE, 0x36, 0x19, 0xC9, 0x4D, 0x78, 0x90, 0x66, 0x1B, 0xE4, 0xCD, 0xEB, 0x23, 0x79, 0xC1, 0x78,
+    0x95, 0x79, 0xC8, 0x1A, 0x9B, 0xD7, 0x32, 0x81, 0x11, 0xEF, 0x4D, 0xF2, 0xBA, 0xB5, 0x74, 0x4C,
+    0x2C, 0x49, 0x3C, 0x82, 0x63, 0xB7, 0x33, 0xF8, 0xEF, 0x32, 0x03, 0x1A, 0x1C, 0xDF, 0xE9, 0x7E,
+    0x33, 0xD1, 0xED, 0x33, 0xDD, 0x0A, 0xE2, 0xC8, 0x43, 0x5F, 0x9D, 0x00, 0x7F, 0x48, 0x9A, 0xB5,
+    0xB4, 0x5B, 0x50, 0xD0, 0x6A, 0x30, 0x18, 0x5E, 0x30, 0x19, 0xB4, 0x20, 0xCE, 0xF2, 0xCA, 0x4C,
+    0xB3, 0x4C, 0xFA, 0xC3, 0x66, 0x99, 0x7D, 0x94, 0x7F, 0x4C, 0x36, 0x20, 0xF3, 0x09, 0x98, 0xFC,
+    0x0A, 0x26, 0xEE, 0xCD, 0x13, 0x32, 0x87, 0xBD, 0x7E, 0x13, 0x8C, 0xB4, 0xEA, 0x99, 0x7E, 0x65,
+    0xF7, 0x75, 0x2C, 0xF6, 0x09, 0xB1, 0x9C, 0x23, 0xCD, 0x26, 0x4F, 0x23, 0x08, 0x61, 0x89, 0xB2,
+    0x5E, 0xD5, 0xAB, 0xBB, 0x12, 0xE4, 0xD7, 0x13, 0x41, 0x1E, 0x69, 0xA5, 0x48, 0xD7, 0x78, 0x3D,
+    0xD4, 0x4A, 0xD6, 0xB8, 0xB5, 0x6E, 0xF7, 0x76, 0x41, 0xF4, 0xFF, 0x15, 0x26, 0x80, 0xFF, 0x17,
+    0xDA, 0xC5, 0x37, 0x5B, 0x28, 0xE6, 0xB2, 0x31, 0x4D, 0x0D, 0x3C, 0xB4, 0xA6, 0x6B, 0x4F, 0x6F,
+    0x90, 0x85, 0x56, 0x18, 0xD9, 0x5E, 0x18, 0xE5, 0x78, 0xB5, 0x6C, 0xDC, 0x72, 0x79, 0x17, 0xEC,
+    0xE5, 0x8A, 0xA4, 0x4D, 0xC0, 0xD5, 0xDD, 0xA4, 0x0C, 0x25, 0x7D, 0x27, 0x61, 0xF9, 0x3C, 0x1B,
+    0x09, 0x10, 0xE7, 0xBF, 0xA3, 0x02, 0x2A, 0xE9, 0xE2, 0xB5, 0x26, 0x79, 0xFC, 0xB1, 0xAD, 0x38,
+    0x6A, 0x7D, 0x9D, 0x22, 0x4E, 0x22, 0x15, 0xDC, 0x05, 0x99, 0xE6, 0x8D, 0xBD, 0x05, 0xA2, 0x5F,
+    0xE6, 0x86, 0x74, 0x9F, 0xDD, 0x01, 0xB6, 0x8C, 0x1A, 0xF3, 0x60, 0x49, 0xBD, 0xCC, 0x0A, 0x9E,
+    0xA6, 0x60, 0x87, 0x44, 0x27, 0x91, 0x2E, 0x07, 0x62, 0x76, 0x5F, 0xF7, 0x4E, 0x09, 0x72, 0x90,
+    0x7E, 0x20, 0xD3, 0x10, 0x34, 0x34, 0xC0, 0x9A, 0x96, 0xA0, 0x89, 0x05, 0x0E, 0x89, 0x5A, 0xC4,
+    0xD9, 0x5C, 0x50, 0xD5, 0x6C, 0x63, 0xA9, 0xAB, 0xE3, 0x99, 0x29, 0xBD, 0x37, 0x5A, 0x52, 0xA7,
+    0xD2, 0xC9, 0xAF, 0x52, 0xAC, 0xF2, 0x37, 0xA4, 0xC5, 0x0B, 0x3C, 0x53, 0x5D, 0x9F, 0xFE, 0x5A,
+    0x65, 0xDA, 0xA9, 0x74, 0x38, 0x96, 0xD5, 0xA6, 0x00, 0x57, 0x7A, 0x44, 0x17, 0x97, 0x7E, 0x4C,
+    0x78, 0x2B, 0x9F, 0x24, 0x1F, 0x52, 0xD7, 0xF6, 0x56, 0x61, 0x4C, 0x65, 0xC1, 0xD5, 0x07, 0x92,
+    0x54, 0x4B, 0x99, 0xB3, 0x65, 0x9A, 0xC2, 0x94, 0x56, 0x4D, 0x93, 0xDA, 0xC3, 0xA2, 0xAA, 0x95,
+    0x93, 0x2C, 0x8F, 0x67, 0x84, 0x24, 0x6C, 0x4C, 0xFF, 0x1B, 0xB8, 0x8E, 0xD8, 0x1D, 0x7A, 0x62,
+    0x4F, 0x3D, 0x10, 0x60, 0x3C, 0x30, 0x4B, 0xA8, 0x1B, 0x4F, 0x17, 0x04, 0xFD, 0x37, 0x84, 0xDB,
+    0xCB, 0x73, 0x51, 0x6B, 0x07, 0x8D, 0xF9, 0xA3, 0x26, 0x48, 0x2B, 0xA0, 0xC6, 0x91, 0x2E, 0x73,
+    0x96, 0x81, 0x8E, 0xEA, 0x7E, 0xBA, 0x15, 0x10, 0x8A, 0x80, 0x57, 0x84, 0xDE, 0x9C, 0x6E, 0x52,
+    0x0E, 0xCD, 0x4F, 0x4C, 0x4C, 0x16, 0x2F, 0xBC, 0xA4, 0x56, 0xA6, 0x4F, 0x2B, 0x1D, 0x4B, 0xDF,
+    0x81, 0xE9, 0xD8, 0x8A, 0xC7, 0x8D, 0xFE, 0x11, 0xF5, 0xF9, 0xED, 0x80, 0xFE, 0x7A, 0x73, 0xBC,
+    0x15, 0xCA, 0x3A, 0xB3, 0x6A, 0xD7, 0x54, 0x15, 0xE3, 0x99, 0x22, 0x0E, 0xA0, 0x1F, 0x00, 0xA1,
+    0xC5, 0xCE, 0x15, 0x88, 0x6B, 0x65, 0x0D, 0xB7, 0x64, 0x6B, 0xC0, 0x01, 0xB6, 0x66, 0x70, 0xEB,
+    0x9D, 0x95, 0x18, 0x1C, 0x39, 0x39, 0x70, 0x29, 0xE0, 0x50, 0x40, 0x99, 0xE7, 0xA9, 0x2A, 0x64,
+    0x05, 0x17, 0xA9, 0xAC, 0x8B, 0x3A, 0xBD, 0xC0, 0x8A, 0xEB, 0x65, 0xBC, 0xA0, 0xB6, 0x62, 0x1B,
+    0x2F, 0xE2, 0xDE, 0x1A, 0x2F, 0x96, 0x36, 0x10, 0x9A, 0x98, 0x73, 0xFF, 0xB7, 0xF4, 0xBF, 0xA1,
+    0x0B, 0xFA, 0xB6, 0xF0, 0xBF, 0xC3, 0xA4, 0xF2, 0xBF, 0xCF, 0xDD, 0xBE, 0x90, 0x66, 0x61, 0x87,
+    0x2A, 0x76, 0x59, 0x91, 0x35, 0x7D, 0xC3, 0xD6, 0x28, 0x93, 0x6C, 0x00, 0xF5, 0xA3, 0x7E, 0x07,
+    0xF4, 0x6E, 0xCA, 0x72, 0xF2, 0xE3, 0x2F, 0x7C, 0xFB, 0xE3, 0xDA, 0x6C, 0x05, 0x5C, 0x36, 0xB5,
+    0xBA, 0x23, 0x13, 0xC1, 0xCE, 0x6E, 0x6D, 0x9C, 0xB0, 0xB6, 0xAE, 0x46, 0xBA, 0xB8, 0x64, 0xEB,
+    0x8A, 0x5D, 0x08, 0x2A, 0x8A, 0xA1, 0xE1, 0x2C, 0x3E, 0xCF, 0x7A, 0x92, 0x4E, 0x9F, 0x37, 0x1B,
+    0xE5, 0x60, 0x1D, 0x09, 0x64, 0xF1, 0x26, 0x46, 0x79, 0xE9, 0x76, 0x09, 0xEF, 0x94, 0xBC, 0xF5,
+    0x07, 0xF2, 0x1B, 0x7D, 0xE8, 0xD5, 0x9C, 0xFB, 0xFF, 0x74, 0xBF, 0x03, 0x97, 0xE1, 0x7F, 0x84,
+    0x49, 0xBF, 0xB5, 0xCD, 0x41, 0x58, 0xF4, 0x1A, 0xE1, 0x10, 0x99, 0x97, 0x30, 0x68, 0x02, 0xE2,
+    0x90, 0xF8, 0x52, 0xD5, 0xDE, 0xBF, 0x6A, 0x35, 0xFC, 0x32, 0x6B, 0xE6, 0xA7, 0x59, 0x54, 0x79,
+    0x82, 0x3C, 0x55, 0x97, 0x6B, 0x9A, 0x30, 0x1C, 0xEA, 0x06, 0x77, 0x8E, 0x94, 0xBE, 0x1C, 0xE2,
+    0xE2, 0xD8, 0x4B, 0x29, 0x25, 0x03, 0x4C, 0x52, 0x9C, 0x97, 0xBE, 0x43, 0xA9, 0x4D, 0x36, 0xDB,
+    0x32, 0xBD, 0xAA, 0x89, 0xF4, 0xB6, 0x51, 0x85, 0xF9, 0x89, 0xDD, 0x43, 0xA8, 0xF9, 0xD5, 0xD0,
+    0x39, 0xFD, 0xA5, 0x2C, 0x9F, 0x7E, 0x9C, 0x26, 0x32, 0x47, 0x98, 0xD6, 0x49, 0xDE, 0xA0, 0x64,
+    0x6A, 0x8C, 0x99, 0x9D, 0xDA, 0xDA, 0xFA, 0xF9, 0x56, 0xAA, 0x31, 0x05, 0xF3, 0xA0, 0xC1, 0x0C,
+    0xF7, 0x1B, 0x48, 0x80, 0x89, 0xCC, 0xED, 0x73, 0x44, 0x12, 0xA0, 0xA4, 0x72, 0xE8, 0x49, 0xD0,
+    0x2F, 0xB1, 0x73, 0xE2, 0xC3, 0x94, 0x6A, 0xE2, 0xF3, 0xBE, 0x1E, 0xBB, 0x04, 0xE4, 0xF1, 0xB2,
+    0x91, 0xEE, 0xD4, 0x63, 0xAB, 0xA2, 0xF4, 0xA5, 0x0B, 0xC0, 0x0E, 0xD3, 0xA1, 0xF0, 0x1C, 0xF1,
+    0x8E, 0xB3, 0x32, 0x1B, 0xFD, 0x94, 0x9F, 0x83, 0x8F, 0xA4, 0xD1, 0xE0, 0x23, 0xF9, 0x31, 0x49,
+    0xBA, 0xBD, 0xB3, 0xBC, 0x71, 0xC0, 0x7A, 0x33, 0x95, 0x02, 0xD9, 0xBC, 0xC8, 0xD2, 0x21, 0xCF,
+    0x73, 0x2A, 0x35, 0x53, 0x28, 0xE4, 0x6E, 0x64, 0x6C, 0x08, 0x99, 0xBA, 0xC8, 0x15, 0x73, 0x81,
+    0x9B, 0x40, 0x17, 0x86, 0x16, 0xEC, 0x62, 0xA8, 0x2A, 0x0B, 0x78, 0x65, 0x3F, 0x96, 0x51, 0x54,
+    0x54, 0x8F, 0xAD, 0xA4, 0x93, 0x1D, 0x19, 0x97, 0x32, 0xB1, 0x57, 0x21, 0x0F, 0x1B, 0xA4, 0x96,
+    0xEC, 0x27, 0xCD, 0x09, 0xA4, 0x73, 0x56, 0xFF, 0xF2, 0xA1, 0x45, 0x26, 0x97, 0xC5, 0xC1, 0x5D,
+    0x4A, 0x3A, 0xA6, 0x21, 0x47, 0x3E, 0xB6, 0xB5, 0x75, 0x35, 0xD0, 0xBA, 0x0A, 0xDF, 0x49, 0x4A,
+    0xFE, 0xCA, 0xF3, 0x39, 0x29, 0x7C, 0xF5, 0xC6, 0x31, 0x49, 0x7D, 0xA2, 0x10, 0x11, 0xB1, 0xBE,
+    0x8E, 0xC3, 0x9E, 0x6F, 0xC2, 0xBA, 0xDB, 0x61, 0x65, 0xD5, 0xC0, 0xEA, 0xF2, 0x36, 0xE5, 0x22,
+    0xD3, 0xD7, 0xD1, 0x4F, 0xDA, 0x87, 0xAE, 0xED, 0xA8, 0x33, 0xED, 0x9B, 0x9C, 0x54, 0xAD, 0x5F,
+    0x9B, 0xAF, 0xB3, 0xCA, 0x68, 0x6F, 0x4C, 0x98, 0x98, 0x5B, 0x4E, 0x26, 0xCE, 0xAA, 0xA5, 0x05,
+    0x23, 0xCE, 0x4A, 0x5F, 0x96, 0x72, 0x37, 0x29, 0x6A, 0xEE, 0xA7, 0x9C, 0x2C, 0x4C, 0xC9, 0xF6,
+    0x21, 0x37, 0x0F, 0xB9, 0x75, 0xC8, 0x8D, 0xC3, 0xA1, 0x30, 0x35, 0xB7, 0x9C, 0x14, 0x87, 0x09,
+    0xB7, 0x7E, 0xBD, 0xB4, 0x7B, 0xAF, 0x74, 0xBA, 0xA3, 0xF1, 0xD3, 0xF6, 0x28, 0x4C, 0xB7, 0xF8,
+    0xAF, 0x29, 0xF6, 0x07, 0xFF, 0x1F, 0xE5, 0x5A, 0x31, 0x90, 0xDE, 0xD6, 0x71, 0x5E, 0x00, 0x3C,
+    0x62, 0x4C, 0x14, 0xB8, 0x82, 0x8C, 0x9D, 0x70, 0x2C, 0x34, 0x29, 0x32, 0x52, 0x24, 0xB4, 0x2A,
+    0x44, 0x02, 0x8E, 0x0B, 0x17, 0x29, 0x74, 0x05, 0x6F, 0x54, 0xB8, 0xB0, 0xEB, 0x34, 0xD7, 0xA4,
+    0x70, 0x21, 0x11, 0xBF, 0xE5, 0x22, 0x85, 0x9B, 0x6B, 0x12, 0x95, 0x66, 0xC1, 0x82, 0xF9, 0x5D,
+    0x58, 0x05, 0x0B, 0x79, 0xC6, 0x34, 0x30, 0xE2, 0x78, 0x54, 0x1A, 0x23, 0x8F, 0x27, 0x45, 0x66,
+    0x12, 0x38, 0x39, 0x4F, 0x1C, 0xAA, 0x30, 0x94, 0x40, 0x21, 0x8E, 0x02, 0xF0, 0xFC, 0x7D, 0xFB,
+    0x1E, 0xF0, 0xFF, 0x47, 0x4A, 0x32, 0x4D, 0x9E, 0xC4, 0xD3, 0xE4, 0x9F, 0xC3, 0xBE, 0x77, 0x3F,
+    0xF0, 0x3F, 0xBC, 0xDD, 0xB7, 0x6F, 0xF7, 0xDB, 0xDD, 0x27, 0x82, 0xCF, 0x1E, 0x89, 0x37, 0x48,
+    0x64, 0x3A, 0x7F, 0x92, 0xC2, 0x98, 0x7C, 0xF2, 0x8D, 0x64, 0xF5, 0x95, 0x70, 0x90, 0xB8, 0x7B,
+    0x25, 0xEE, 0x24, 0x1C, 0xBB, 0xB4, 0x95, 0xC0, 0x54, 0x19, 0xA9, 0x64, 0x8D, 0xE0, 0x81, 0x62,
+    0x43, 0xF3, 0x47, 0xA8, 0x7B, 0xC6, 0x3E, 0xCF, 0xDF, 0x8E, 0xC2, 0x71, 0xF0, 0x12, 0x8E, 0x29,
+    0x78, 0x4F, 0xDA, 0x88, 0x94, 0xF7, 0xCC, 0x4A, 0xF0, 0xDE, 0x9E, 0x33, 0xB8, 0x24, 0xF6, 0x93,
+    0xE3, 0x0A, 0x5B, 0x10, 0x3C, 0x77, 0x70, 0x1C, 0x76, 0x81, 0x31, 0xEF, 0x76, 0x71, 0x97, 0x7C,
+    0xD8, 0xA6, 0x4D, 0xF4, 0x71, 0x95, 0x55, 0x21, 0xDE, 0x5A, 0x05, 0x83, 0x94, 0x15, 0x46, 0x9D,
+    0xC9, 0x64, 0x7B, 0x05, 0x09, 0x1E, 0x19, 0x30, 0xFF, 0xA8, 0x97, 0xB8, 0x8D, 0x5B, 0x09, 0xA7,
+    0xB2, 0xC6, 0xBB, 0x26, 0x72, 0x99, 0xBB, 0x97, 0x5C, 0xB4, 0x4D, 0x01, 0x76, 0xBB, 0xA4, 0x2B,
+    0x57, 0x07, 0xE6, 0x28, 0xEA, 0xB3, 0x15, 0x26, 0x2B, 0x7D, 0x9C, 0xB3, 0x79, 0x27, 0x16, 0x6D,
+    0xAE, 0x68, 0x53, 0x2A, 0x23, 0x72, 0x47, 0xEC, 0x97, 0x4F, 0xDE, 0x40, 0x28, 0xD2, 0x61, 0x22,
+    0x26, 0x17, 0xF2, 0x68, 0xEA, 0x10, 0x72, 0x90, 0xCC, 0x98, 0x8A, 0x6C, 0x9B, 0x49, 0xA7, 0xB5,
+    0x23, 0xB2, 0x25, 0x0C, 0x2B, 0x0D, 0x89, 0xBA, 0xE7, 0x6F, 0x5D, 0x58, 0x7F, 0xAB, 0xCF, 0x86,
+    0xD8, 0x7C, 0xBF, 0x8B, 0x06, 0xCF, 0xAC, 0x5A, 0x48, 0xC1, 0xBC, 0x59, 0x93, 0x9A, 0x9C, 0xF4,
+    0x48, 0x48, 0x57, 0x9F, 0x44, 0xC7, 0x2D, 0x3A, 0x79, 0xA4, 0xE6, 0x5B, 0xA0, 0x9E, 0x99, 0xCA,
+    0x23, 0x08, 0xA2, 0xCF, 0xB0, 0x08, 0x9E, 0xC8, 0xD6, 0x9B, 0xF7, 0xE6, 0x6E, 0x17, 0xD6, 0x73,
+    0xF7, 0x7A, 0xBA, 0x9A, 0xBB, 0xE9, 0xB4, 0x3C, 0x1B, 0x0F, 0x4B, 0xD7, 0xDB, 0x93, 0xED, 0x0F,
+    0x18, 0xBB, 0x09, 0xE9, 0x19, 0x30, 0x96, 0x1A, 0x4C, 0x92, 0x5D, 0x43, 0x21, 0x94, 0x8D, 0x40,
+    0x25, 0x46, 0xBC, 0x9F, 0xBF, 0xEE, 0x25, 0xE9, 0xD9, 0x0D, 0x47, 0x08, 0x07, 0x4A, 0x83, 0x2E,
+    0xE4, 0xD5, 0x09, 0x16, 0xCE, 0xE3, 0xE3, 0x39, 0x9A, 0x8A, 0x5D, 0x3B, 0x71, 0xCA, 0x4F, 0xC8,
+    0x49, 0x34, 0x2D, 0x5D, 0xCE, 0x41, 0xBB, 0x95, 0x64, 0xDD, 0xF2, 0x2D, 0x94, 0x71, 0xFE, 0x19,
+    0x25, 0xAC, 0xDD, 0x9C, 0xE3, 0xD9, 0x71, 0x21, 0x71, 0xD1, 0x2E, 0xF4, 0x07, 0x03, 0x44, 0x2B,
+    0x74, 0xA1, 0xA1, 0x29, 0x34, 0x87, 0x5D, 0x4C, 0x0A, 0x93, 0x89, 0x73, 0xAB, 0xE7, 0x98, 0x4C,
+    0x9A, 0xBF, 0x40, 0x2E, 0x3C, 0x43, 0x0A, 0xDE, 0x8E, 0xC4, 0x76, 0x67, 0xA5, 0x3A, 0xE7, 0xD8,
+    0x4E, 0xF2, 0xD7, 0x1D, 0xEB, 0xD1, 0xFB, 0x9D, 0xE3, 0xDC, 0x37, 0x8D, 0x63, 0x5C, 0x2C, 0x2F,
+    0x9C, 0xF1, 0x25, 0x71, 0x6C, 0x8B, 0x9B, 0x87, 0x91, 0xF5, 0x7A, 0x9D, 0x5B, 0xA6, 0xF1, 0xB3,
+    0x95, 0x9D, 0xFC, 0xF1, 0x6B, 0xC6, 0x71, 0xD4, 0x86, 0xA3, 0xED, 0x7D, 0xBF, 0x89, 0xFB, 0x99,
+    0xE1, 0xB4, 0x5D, 0xF8, 0x5D, 0xA4, 0xA4, 0x6B, 0x6B, 0xB9, 0x5D, 0x98, 0x1D, 0x16, 0x5E, 0x3B,
+    0xC9, 0x2D, 0xAB, 0x59, 0x13, 0x54, 0x96, 0x53, 0xEC, 0x9F, 0xCA, 0x32, 0x6A, 0xF2, 0xB8, 0x52,
+    0x3E, 0xB1, 0xF5, 0xB0, 0xE7, 0xC9, 0xA6, 0xF6, 0x1C, 0x93, 0xDC, 0x3B, 0x66, 0x90, 0xAB, 0xC2,
+    0x6D, 0x7B, 0x80, 0xFD, 0xFC, 0x1E, 0xF5, 0x13, 0x63, 0x85, 0x56, 0x89, 0x07, 0x5D, 0x30, 0xED,
+    0xC8, 0xBE, 0xB8, 0x0E, 0xD9, 0x2B, 0xFF, 0x61, 0xF0, 0xC0, 0x1D, 0x36, 0xFC, 0xFD, 0xC1, 0xA7,
+    0x1E, 0x24, 0x5D, 0x31, 0xF8, 0x1F, 0xBD, 0x36, 0x61, 0x16, 0xF1, 0xE0, 0xD7, 0x18, 0xA2, 0xA8,
+    0xD0, 0xA9, 0x92, 0x16, 0x1D, 0xFC, 0x87, 0x4D, 0x8C, 0x69, 0xB1, 0x83, 0x91, 0x4B, 0xEE, 0x6A,
+    0xB2, 0xA9, 0x1D, 0x68, 0xB2, 0xED, 0x40, 0x0A, 0xF6, 0x99, 0xB4, 0xF5, 0xEC, 0xAF, 0x8A, 0x3A,
+    0xCC, 0xB3, 0x3A, 0xA6, 0xDA, 0x47, 0x79, 0xDA, 0xA6, 0x23, 0xB8, 0x4A, 0xF2, 0xD8, 0xDC, 0x37,
+    0x6F, 0x91, 0x29, 0xDF, 0xBC, 0x6F, 0xFE, 0x55, 0x57, 0xE4, 0xDC, 0xA2, 0xA4, 0x7C, 0x83, 0x69,
+    0x53, 0x1A, 0xA2, 0xD2, 0x34, 0x3A, 0x7D, 0xA8, 0x16, 0x5F, 0x26, 0x4E, 0xDE, 0xA7, 0xDD, 0x7E,
+    0xD7, 0xB5, 0x6F, 0xBB, 0xB6, 0xDD, 0x6A, 0x31, 0xDF, 0x80, 0x2D, 0xD7, 0x80, 0x6D, 0xE6, 0x5A,
+    0xFD, 0x2C, 0xAD, 0xDB, 0x73, 0x91, 0x6B, 0xE3, 0xDE, 0x31, 0xD3, 0xDA, 0xDB, 0x6E, 0xB9, 0xA2,
+    0xE3, 0x79, 0x63, 0x5A, 0x25, 0x8D, 0x3B, 0xE5, 0x36, 0xE9, 0x95, 0xD9, 0xB8, 0x53, 0x5E, 0xCF,
+    0x1F, 0xEA, 0xD4, 0xEC, 0xAE, 0x71, 0x8D, 0xB7, 0xBE, 0xA9, 0x8D, 0xE9, 0xF4, 0xCB, 0xC4, 0x36,
+    0xF1, 0xE3, 0x36, 0xDF, 0xB5, 0xCD, 0xDB, 0xB6, 0x69, 0x97, 0x46, 0x79, 0x8B, 0x3B, 0x65, 0x8D,
+    0x73, 0xD1, 0xC6, 0xCD, 0xEC, 0x44, 0x63, 0xD9, 0x48, 0x6D, 0x53, 0xD4, 0x96, 0x27, 0xE5, 0x21,
+    0xEA, 0xAD, 0x8D, 0x2C, 0x21, 0x99, 0x3A, 0x01, 0x69, 0x69, 0xF3, 0x1B, 0x90, 0x0B, 0x39, 0xD5,
+    0x42, 0x1C, 0xF1, 0xD7, 0x87, 0xC1, 0x18, 0x18, 0xDE, 0x28, 0x9A, 0xF9, 0x91, 0xC7, 0x27, 0x21,
+    0xD5, 0xF2, 0xC0, 0x1C, 0x66, 0x4D, 0x69, 0xDA, 0x4C, 0xAD, 0xF4, 0x86, 0x70, 0x3E, 0x05, 0x25,
+    0x4C, 0x07, 0x96, 0xD0, 0x12, 0x26, 0x8D, 0x64, 0x13, 0xF6, 0x49, 0xA7, 0x8A, 0x04, 0x2D, 0x3B,
+    0x52, 0x4D, 0xC2, 0xE6, 0x94, 0x88, 0x4B, 0xDB, 0x48, 0x22, 0xAA, 0xC0, 0xDD, 0xDC, 0x19, 0x5C,
+    0xE7, 0x3F, 0x8D, 0xEB, 0xFC, 0xC6, 0xAC, 0x6C, 0xA7, 0x29, 0x2B, 0xD7, 0xC9, 0x5A, 0xD7, 0x49,
+    0x7A, 0xD7, 0x89, 0x46, 0xD7, 0x09, 0x8C, 0xEB, 0x88, 0xF9, 0x91, 0xEB, 0x94, 0xC6, 0x75, 0xB2,
+    0xB9, 0x13, 0xCF, 0x9D, 0x50, 0x3B, 0x7E, 0xEB, 0xEC, 0xC0, 0x0B, 0x98, 0xB2, 0x76, 0x32, 0xC8,
+    0xB4, 0x58, 0x94, 0xE9, 0x13, 0x3A, 0xB3, 0x7E, 0xCD, 0x0B, 0xB3, 0x68, 0x18, 0x86, 0x74, 0xBE,
+    0x20, 0xEA, 0xE5, 0xA4, 0x92, 0x61, 0xF5, 0xAC, 0x2C, 0x92, 0xCE, 0x8A, 0x22, 0xE9, 0xAC, 0x24,
+    0xA8, 0x68, 0x14, 0x84, 0x38, 0x39, 0x88, 0x15, 0x83, 0xB7, 0xBE, 0xA1, 0x52, 0xA0, 0xB2, 0xA9,
+    0x10, 0xD2, 0xCE, 0xCA, 0x00, 0x6A, 0xA3, 0x22, 0x60, 0x4B, 0x09, 0xB0, 0xA5, 0x00, 0xD8, 0x92,
+    0x7F, 0xB6, 0x64, 0x5F, 0x5B, 0x70, 0xAF, 0x6D, 0xE6, 0xDA, 0xD8, 0xB5, 0x21, 0x5B, 0xCB, 0x39,
+    0x14, 0x4F, 0x19, 0xA7, 0xE6, 0x91, 0xEF, 0x99, 0xA7, 0x87, 0xDB, 0xC4, 0xB1, 0xE8, 0xD4, 0xCF,
+    0xE9, 0xDF, 0xAC, 0x80, 0x70, 0xC5, 0x27, 0x9C, 0x9D, 0xE3, 0xDF, 0x79, 0x41, 0xD7, 0xF8, 0x37,
+    0x4E, 0x38, 0x42, 0x79, 0xFE, 0x56, 0xDA, 0xC9, 0xFA, 0x56, 0x36, 0xC0, 0x15, 0x9A, 0x21, 0x34,
+    0x1F, 0xD0, 0x01, 0x04, 0x06, 0x06, 0x3A, 0x1A, 0x60, 0x91, 0x61, 0xAB, 0x06, 0xF5, 0xCE, 0x4F,
+    0xD0, 0x40, 0x53, 0x0D, 0x0C, 0x5F, 0x6A, 0x0E, 0x81, 0x62, 0x86, 0xC2, 0x34, 0xA6, 0x77, 0xAB,
+    0x36, 0x37, 0xFD, 0xB6, 0x89, 0x70, 0x4C, 0xAA, 0x22, 0x63, 0x91, 0x74, 0x11, 0x83, 0x63, 0xEE,
+    0x28, 0xE2, 0x8E, 0xB8, 0xCA, 0xF8, 0x7F, 0xAB, 0xBF, 0x34, 0xED, 0x86, 0xFB, 0x4B, 0xF9, 0x96,
+    0x5B, 0x57, 0xE3, 0x52, 0xE8, 0x08, 0xA5, 0x3E, 0x63, 0x38, 0xA8, 0xF7, 0x01, 0xDF, 0x10, 0xFC,
+    0x0B, 0x7F, 0x1B, 0xDC, 0xE5, 0x2E, 0x8C, 0xDE, 0x54, 0x93, 0xF0, 0x0D, 0x35, 0x21, 0x42, 0xF1,
+    0xBD, 0x04, 0x6B, 0x2D, 0x72, 0x45, 0x77, 0xCF, 0xF5, 0xB5, 0x7A, 0x43, 0xC3, 0xD7, 0x74, 0x14,
+    0x3A, 0x56, 0x09, 0x93, 0x0C, 0x1A, 0xF5, 0x26, 0x35, 0x6D, 0x5D, 0x5C, 0x71, 0xFD, 0xCA, 0x63,
+    0x39, 0x00, 0x5B, 0x00, 0x79, 0x06, 0x56, 0xDE, 0xCB, 0x83, 0x26, 0xC9, 0xBD, 0xFE, 0x3A, 0x5E,
+    0x3E, 0x58, 0x7D, 0xDC, 0xC9, 0x9D, 0x8B, 0x39, 0xC6, 0xB2, 0x43, 0x83, 0x9A, 0xA2, 0x4A, 0x6A,
+    0xEC, 0xE1, 0x8A, 0x5C, 0xF2, 0x2A, 0x9A, 0xF3, 0xC6, 0x34, 0xE9, 0x71, 0xD1, 0x14, 0xF8, 0xBE,
+    0xAC, 0x36, 0x57, 0x51, 0x63, 0x7B, 0x9B, 0x7F, 0x3F, 0x8E, 0xA6, 0x78, 0x22, 0xE6, 0x81, 0x83,
+    0x83, 0x6B, 0x83, 0x53, 0x83, 0x09, 0xA5, 0x75, 0xDC, 0x77, 0x2E, 0x02, 0x06, 0xD3, 0xA7, 0xEB,
+    0x97, 0xC7, 0xFF, 0xC3, 0xF3, 0x2F, 0x98, 0x23, 0xFC, 0x76, 0x57, 0x76, 0xDF, 0xF0, 0xBA, 0xE4,
+    0x87, 0x75, 0x64, 0x14, 0x63, 0x5E, 0xE3, 0x98, 0x7F, 0xB1, 0x96, 0xC4, 0x82, 0x91, 0xCF, 0xFC,
+    0x83, 0x33, 0xBF, 0x6C, 0x8E, 0x52, 0xEC, 0x93, 0x73, 0xEA, 0xB1, 0x92, 0xFC, 0x0D, 0xAA, 0xE2,
+    0x7F, 0x50, 0xE0, 0xC4, 0x14, 0xA2, 0xDE, 0x71, 0x0B, 0x40, 0x53, 0xEC, 0xBA, 0x1C, 0x85, 0x85,
+    0x1D, 0xE4, 0x5F, 0xA1, 0xBC, 0x83, 0xE0, 0x16, 0x8E, 0x3F, 0x39, 0x94, 0x9F, 0x1E, 0x0B, 0xCA,
+    0x7B, 0x39, 0x97, 0x29, 0x5E, 0xC9, 0x50, 0x60, 0x26, 0x58, 0x26, 0xA8, 0xBF, 0xEC, 0x38, 0x74,
+    0x78, 0x70, 0x4C, 0x44, 0x51, 0x01, 0xD5, 0x13, 0xD4, 0xF7, 0x04, 0xEC, 0x44, 0xEE, 0xE5, 0xE6,
+    0x9A, 0xD8, 0xF2, 0x3B, 0xDE, 0x23, 0x96, 0x27, 0x94, 0x57, 0x24, 0x4F, 0x20, 0x4F, 0x3B, 0xC3,
+    0x17, 0x40, 0xCD, 0xF8, 0x0A, 0x91, 0xE1, 0xBA, 0x2A, 0xE4, 0xB0, 0xD9, 0xB4, 0x3B, 0x0B, 0x10,
+    0x05, 0xC4, 0x8F, 0x4D, 0x7D, 0x60, 0xBA, 0xC8, 0x1C, 0x52, 0xF8, 0x83, 0xC3, 0xE2, 0xA7, 0x45,
+    0x2D, 0xA4, 0xC7, 0x46, 0xF6, 0xDA, 0x19, 0xD0, 0xC3, 0xAF, 0xAD, 0x68, 0x2E, 0xC6, 0x05, 0xCD,
+    0xEF, 0x51, 0xB5, 0x7E, 0x06, 0xFD, 0x96, 0xEC, 0x55, 0xAC, 0x56, 0xCC, 0xAD, 0x10, 0x6A, 0x48,
+    0x72, 0x6D, 0x31, 0x10, 0x17, 0xD6, 0x39, 0xC1, 0x3D, 0x76, 0x34, 0xB6, 0x75, 0xF0, 0x18, 0x64,
+    0x5C, 0x08, 0x11, 0xBD, 0x02, 0x7A, 0x8B, 0xE7, 0x15, 0xCE, 0x2B, 0x9A, 0x07, 0xE0, 0x52, 0x3D,
+    0x51, 0x9C, 0xBB, 0xFE, 0x67, 0x45, 0xF6, 0xE7, 0x74, 0x83, 0xEB, 0x36, 0xEF, 0xB2, 0x7C, 0xEE,
+    0x6F, 0x7D, 0xCE, 0x84, 0xC4, 0x32, 0x53, 0x93, 0xE0, 0xDE, 0xA5, 0x7D, 0x4C, 0xF2, 0x6B, 0x1E,
+    0xEE, 0x17, 0x0C, 0x85, 0x94, 0x5C, 0x0D, 0x9A, 0x13, 0xC6, 0xF5, 0xF3, 0x90, 0x1D, 0x5E, 0xA5,
+    0xC6, 0x51, 0x41, 0x91, 0xA7, 0x9A, 0x1D, 0xA8, 0x29, 0xFC, 0xC6, 0x97, 0x43, 0x82, 0x5B, 0x3E,
+    0x2D, 0xE1, 0xBC, 0x39, 0x53, 0xF9, 0x99, 0x3C, 0x13, 0x59, 0x06, 0x35, 0xBD, 0xBD, 0xF4, 0x77,
+    0x54, 0x3A, 0xDD, 0xB6, 0x73, 0xFD, 0x64, 0x59, 0xE6, 0xE7, 0xCE, 0x9E, 0x2C, 0xAF, 0x50, 0x50,
+    0xC9, 0x8F, 0x2A, 0x1A, 0xBA, 0x19, 0x67, 0x5E, 0xA4, 0x15, 0xFA, 0x62, 0x65, 0x69, 0xE1, 0x87,
+    0x6F, 0x7D, 0xFB, 0xCF, 0x5D, 0xC0, 0xF9, 0x65, 0xD3, 0x4B, 0x85, 0x52, 0x8A, 0x23, 0x22, 0xEA,
+    0x26, 0x9F, 0x7F, 0x36, 0x7B, 0x1C, 0x73, 0x3E, 0x82, 0x23, 0x06, 0xDA, 0xFF, 0x1B, 0xB3, 0x7A,
+    0x19, 0x60, 0x67, 0x57, 0x01, 0x03, 0x21, 0xA0, 0x5E, 0x00, 0xF4, 0x00, 0xF5, 0xF7, 0x7E, 0xD2,
+    0x96, 0xAB, 0xA4, 0x05, 0x28, 0x6D, 0xB3, 0x2A, 0xAD, 0xD3, 0x1A, 0x91, 0xEA, 0x03, 0x7A, 0xF8,
+    0xDE, 0x32, 0xE5, 0xAB, 0x6D, 0x0D, 0x34, 0x81, 0xE3, 0x6F, 0xD9, 0xD9, 0xB0, 0x2D, 0x16, 0x1A,
+    0x34, 0x57, 0xE5, 0xA1, 0xCF, 0x33, 0x05, 0x52, 0x9A, 0x89, 0xC1, 0x80, 0xFB, 0x80, 0x38, 0x87,
+    0x5F, 0x51, 0x95, 0xE1, 0xE5, 0xB7, 0xE9, 0x26, 0x9D, 0x73, 0x0A, 0x80, 0x0A, 0xF2, 0xB8, 0xA5,
+    0xB2, 0x19, 0x97, 0xFE, 0x9C, 0x42, 0x52, 0xEE, 0x35, 0x98, 0x72, 0x92, 0xB8, 0x70, 0x46, 0x40,
+    0xA6, 0x8F, 0x66, 0x91, 0x8D, 0x67, 0xC3, 0x3B, 0x35, 0x58, 0x6C, 0xCF, 0x9F, 0x1E, 0xD8, 0x54,
+    0xAC, 0x36, 0x9C, 0x68, 0xBD, 0xFD, 0x6B, 0xDB, 0x1A, 0xC2, 0xE4, 0xD1, 0xB0, 0xD5, 0x06, 0xBF,
+    0x6F, 0x85, 0x6D, 0x74, 0xD0, 0xCA, 0xEB, 0x9C, 0x18, 0x66, 0xF5, 0x0A, 0x6D, 0x13, 0xDA, 0xBF,
+    0x42, 0xFB, 0xBA, 0x33, 0xAB, 0x9D, 0x6D, 0xBD, 0xD6, 0xB6, 0x41, 0x9D, 0x6A, 0x06, 0x27, 0x5C,
+    0xD9, 0x36, 0x76, 0xE6, 0x37, 0xDD, 0x3F, 0x68, 0x5D, 0xA2, 0x4E, 0xDB, 0x9F, 0xBA, 0xFF, 0x5B,
+    0xDE, 0xDF, 0x11, 0xBF, 0x61, 0x1B, 0x4B, 0xA8, 0x49, 0xA6, 0x84, 0x92, 0x42, 0x9B, 0x49, 0xD9,
+    0xFB, 0x9A, 0xC9, 0x33, 0x63, 0xC8, 0x04, 0x18, 0x57, 0x48, 0x41, 0xA8, 0xA5, 0xEA, 0xB0, 0x9D,
+    0x8C, 0xFA, 0xCB, 0x13, 0xA5, 0x54, 0x9A, 0x1A, 0x72, 0x1A, 0xE2, 0x16, 0x92, 0xEA, 0xA2, 0x1E,
+    0xB2, 0x6A, 0x43, 0xC5, 0xEE, 0xD8, 0xA9, 0x52, 0x7C, 0xF4, 0xDA, 0x78, 0x9E, 0xE3, 0x8C, 0x90,
+    0xD9, 0x83, 0xF5, 0x2D, 0x48, 0xAD, 0x65, 0x56, 0xE7, 0x04, 0xED, 0xE5, 0x65, 0x48, 0x6F, 0x92,
+    0x3E, 0x33, 0x1F, 0x62, 0xB2, 0x40, 0xD2, 0x29, 0x0C, 0xCB, 0x9E, 0x6C, 0xF2, 0x94, 0x58, 0xB4,
+    0xDC, 0x71, 0x02, 0x0B, 0x94, 0xF4, 0x34, 0xD0, 0x61, 0xAF, 0x8B, 0x6D, 0x17, 0x7E, 0xE5, 0x62,
+    0x57, 0x47, 0x9B, 0x8D, 0x7E, 0xCD, 0x14, 0x6B, 0x4E, 0xD4, 0x5B, 0x30, 0xF6, 0xE7, 0x0F, 0xF1,
+    0x24, 0xC6, 0x49, 0x5B, 0xAE, 0x73, 0xDC, 0x5F, 0xF8, 0xC9, 0x94, 0x53, 0x5D, 0x7A, 0x82, 0x63,
+    0x46, 0x53, 0xC5, 0x54, 0x76, 0xB4, 0x6D, 0x1A, 0x44, 0xB9, 0x18, 0x84, 0x51, 0xC9, 0xFF, 0x31,
+    0xB3, 0xC8, 0xB8, 0xB4, 0xCD, 0x7E, 0x01, 0xDF, 0x9B, 0xD6, 0x92, 0x82, 0xFD, 0x2D, 0x12, 0x37,
+    0xD0, 0xFD, 0xE8, 0xA3, 0x42, 0x13, 0xB0, 0x98, 0xF9, 0x6F, 0xC1, 0x44, 0x44, 0xD1, 0xC5, 0xDC,
+    0x0C, 0x78, 0x5B, 0xCD, 0x01, 0x3A, 0xEA, 0x20, 0x00, 0xFB, 0xBD, 0x1F, 0x8F, 0x52, 0x8A, 0x37,
+    0xCA, 0x04, 0xD4, 0xBC, 0x9A, 0xFC, 0x1F, 0x4F, 0x79, 0x99, 0xC3, 0x0B, 0x64, 0x7C, 0xEE, 0xBC,
+    0x39, 0x96, 0x39, 0x78, 0x8B, 0x2A, 0x6E, 0x5D, 0xBF, 0x1B, 0x97, 0xDD, 0xE2, 0xB8, 0xDC, 0x0A,
+    0xDE, 0x4E, 0x41, 0x4A, 0x9E, 0x4A, 0x89, 0x14, 0x77, 0x93, 0x41, 0x93, 0xA4, 0xBD, 0x2A, 0x4A,
+    0xEF, 0xFE, 0x3E, 0x5B, 0x4A, 0x1E, 0xB7, 0x54, 0x58, 0xC3, 0x69, 0x79, 0x3D, 0xFD, 0x57, 0xD9,
+    0xCF, 0xAF, 0xFB, 0x22, 0x64, 0x48, 0xAF, 0x37, 0xD1, 0x7D, 0x42, 0x86, 0xAD, 0xE8, 0x76, 0xF0,
+    0xCB, 0xFF, 0x56, 0x19, 0x72, 0xA7, 0x87, 0x8A, 0x54, 0x7C, 0x8B, 0x54, 0x74, 0x66, 0x4E, 0x12,
+    0x3B, 0xF9, 0x26, 0xAB, 0xDD, 0x17, 0x26, 0x4F, 0xCD, 0xEF, 0x32, 0x8D, 0xDF, 0xA2, 0x4E, 0xD3,
+    0xB9, 0x9A, 0x7A, 0x4D, 0x35, 0x7B, 0xF6, 0x06, 0xA9, 0xA7, 0x69, 0x68, 0x22, 0x46, 0xCF, 0x30,
+    0x48, 0xF1, 0x4C, 0xA1, 0x29, 0x68, 0x6E, 0x34, 0x8F, 0x13, 0x03, 0x7D, 0x55, 0x53, 0xB2, 0xA1,
+    0xA6, 0xB1, 0x03, 0x4D, 0x73, 0xBB, 0x44, 0x37, 0x6C, 0x16, 0x68, 0xC6, 0xD9, 0xE7, 0xE9, 0x20,
+    0x08, 0x23, 0xA1, 0xF0, 0x88, 0x24, 0x3D, 0x44, 0x40, 0x9A, 0x82, 0xD5, 0xF4, 0x6B, 0xFC, 0x5E,
+    0xE3, 0x52, 0x7D, 0xBE, 0x82, 0xD4, 0x7D, 0x37, 0xC1, 0x92, 0x0A, 0x90, 0x6C, 0xE5, 0xC2, 0x1E,
+    0x22, 0x17, 0x98, 0x1A, 0x8B, 0x4C, 0x1D, 0x8C, 0x10, 0x48, 0x30, 0xFA, 0x8C, 0x08, 0x21, 0xBA,
+    0x60, 0xC4, 0x92, 0x20, 0xEC, 0xC2, 0x23, 0x93, 0x26, 0xDA, 0x21, 0xC2, 0xC0, 0x14, 0xBC, 0xAB,
+    0x7A, 0x12, 0xF3, 0x61, 0x38, 0xFA, 0x70, 0xF2, 0xCD, 0xEA, 0xC0, 0x1C, 0x96, 0x1D, 0x4C, 0xE5,
+    0xE5, 0xFE, 0x6C, 0x04, 0x9D, 0x1A, 0x01, 0x8A, 0x45, 0xE9, 0xED, 0x16, 0xED, 0xAD, 0xD2, 0xB7,
+    0x1B, 0x05, 0x3E, 0x85, 0x00, 0x94, 0xEB, 0x79, 0xD5, 0xA1, 0x69, 0x5A, 0xE3, 0xC9, 0x45, 0x9F,
+    0x09, 0x17, 0x45, 0xE7, 0x63, 0xE9, 0xCE, 0xFE, 0xDE, 0x59, 0x09, 0xCA, 0x1F, 0x57, 0x3E, 0x84,
+    0x05, 0xDE, 0xEC, 0xFA, 0x3E, 0x67, 0x59, 0x31, 0x86, 0xF7, 0x5B, 0xEC, 0x9C, 0x01, 0x38, 0x35,
+    0x1B, 0xAD, 0xFC, 0x5C, 0xE4, 0x9E, 0x18, 0xD3, 0xBB, 0xAB, 0x4B, 0xF7, 0x5F, 0x6B, 0x5E, 0xC4,
+    0x40, 0x2F, 0xEA, 0x40, 0x3D, 0xA1, 0x94, 0x1D, 0x37, 0x9B, 0xE8, 0x19, 0x09, 0xD7, 0x06, 0xAB,
+    0xDC, 0x81, 0xF9, 0x1A, 0x98, 0xB9, 0x23, 0xB3, 0x03, 0xC7, 0xFC, 0x80, 0x17, 0xB3, 0x07, 0x65,
+    0x13, 0xD1, 0xEE, 0x61, 0x0F, 0x6B, 0x62, 0x62, 0x79, 0x27, 0xE7, 0xB1, 0x49, 0x4C, 0x5C, 0x58,
+    0xAF, 0x6F, 0xC2, 0x70, 0xF4, 0xB8, 0xBA, 0xF8, 0x1F, 0xBF, 0xDD, 0xC4, 0x78, 0xC9, 0xD7, 0x25,
+    0xB3, 0x93, 0x67, 0xF0, 0x0E, 0x3F, 0x28, 0xC9, 0xA1, 0x7D, 0xEF, 0x9F, 0x31, 0x40, 0x65, 0x56,
+    0x83, 0x36, 0x8E, 0x99, 0xB6, 0x50, 0xAF, 0x1D, 0x5C, 0x57, 0x25, 0xEA, 0x99, 0x5D, 0xCC, 0x56,
+    0x69, 0x93, 0x3C, 0xD0, 0x14, 0xA8, 0xEC, 0xCA, 0xC5, 0x2B, 0xCC, 0x01, 0x35, 0x4F, 0x90, 0x03,
+    0x7A, 0x24, 0x25, 0xA4, 0x69, 0xDC, 0x91, 0x81, 0x54, 0x99, 0xFF, 0x7F, 0x29, 0xB2, 0x59, 0x36,
+    0x67, 0x4C, 0x94, 0x3B, 0x67, 0xA6, 0x05, 0x35, 0x3B, 0xBE, 0xCB, 0xBC, 0x7E, 0xC9, 0x0A, 0x6A,
+    0x2E, 0x1C, 0x9A, 0xD3, 0xEC, 0x07, 0x8F, 0x24, 0xDE, 0x3F, 0x35, 0x39, 0x7F, 0x66, 0x0B, 0x6A,
+    0x73, 0x56, 0xCB, 0xCE, 0xD3, 0x96, 0x72, 0x2C, 0xD6, 0xB7, 0x46, 0x68, 0x57, 0xCE, 0x12, 0x1A,
+    0xB1, 0x6E, 0x53, 0x1D, 0x28, 0xC1, 0x28, 0x70, 0x05, 0xA7, 0x9B, 0x6F, 0x4E, 0x09, 0x3C, 0x13,
+    0x34, 0x02, 0x8C, 0x91, 0x39, 0xE0, 0xFF, 0x3B, 0xAD, 0xD5, 0x89, 0x66, 0x9F, 0x57, 0x32, 0x6F,
+    0xB0, 0x3F, 0xBD, 0x83, 0xCF, 0x37, 0x31, 0xFE, 0x56, 0xC7, 0xC9, 0xDC, 0x75, 0xBA, 0x3F, 0xD2,
+    0x91, 0x4D, 0x67, 0xC5, 0xA5, 0xA1, 0xA5, 0x61, 0xCC, 0x03, 0x70, 0x22, 0xE9, 0x03, 0xDA, 0x04,
+    0x33, 0xCC, 0x81, 0xFE, 0x76, 0xAC, 0x9F, 0x75, 0xC9, 0x94, 0x67, 0x7D, 0x69, 0x9A, 0x70, 0xEA,
+    0x92, 0x2E, 0x60, 0xB1, 0x02, 0x60, 0x47, 0xA1, 0x44, 0x30, 0x61, 0xF7, 0x80, 0x8C, 0x8F, 0x90,
+    0x91, 0x9A, 0xC0, 0x12, 0x87, 0xD6, 0x39, 0xE2, 0x0E, 0x24, 0xD1, 0x4A, 0x5F, 0xCD, 0x13, 0x1F,
+    0xB9, 0xDE, 0x07, 0x2E, 0xE9, 0xB8, 0x95, 0x68, 0xAF, 0x8E, 0x3E, 0x19, 0xEC, 0x68, 0x92, 0xF5,
+    0xC0, 0xDC, 0xA0, 0x81, 0x6C, 0x17, 0xCD, 0x0C, 0xA6, 0x4D, 0x12, 0xC2, 0xA9, 0x66, 0x68, 0xED,
+    0xC8, 0xE2, 0xAF, 0x6D, 0x05, 0xCB, 0xD6, 0xAF, 0x6C, 0xF5, 0xCA, 0xD6, 0xAE, 0x6C, 0xE5, 0xCA,
+    0x96, 0xEF, 0x6C, 0xED, 0xCE, 0xD6, 0xAC, 0x6C, 0xC5, 0xCA, 0xD6, 0xAB, 0x6C, 0xB5, 0xCA, 0xD6,
+    0xAA, 0x6C, 0xA5, 0xCA, 0xD6, 0xA9, 0x6C, 0x95, 0xCA, 0xD6, 0xA8, 0x6C, 0x85, 0xCA, 0xD6, 0xA7,
+    0x6C, 0x75, 0xCA, 0xD6, 0xA6, 0x6C, 0x65, 0xCA, 0x22, 0x76, 0x8D, 0xD1, 0xB4, 0x7A, 0xE3, 0xE9,
+    0x56, 0xCA, 0xB6, 0xE5, 0xAA, 0x15, 0x25, 0xAD, 0x27, 0x69, 0x35, 0x49, 0x6B, 0x49, 0x5A, 0x49,
+    0xDA, 0xCA, 0x7B, 0x7C, 0x26, 0xD1, 0xBA, 0x91, 0x56, 0x8D, 0xB4, 0x66, 0x24, 0x4E, 0x51, 0x02,
+    0xBB, 0x6B, 0x35, 0x2A, 0x7F, 0x69, 0x6B, 0x25, 0xAD, 0xA1, 0x6D, 0x6F, 0x73, 0x36, 0xF5, 0xCB,
+    0xA4, 0xCD, 0xDF, 0x6F, 0x15, 0x89, 0x9A, 0x4D, 0xFF, 0x63, 0xAD, 0x4D, 0xFC, 0x97, 0x8D, 0xD0,
+    0x49, 0xC3, 0xBB, 0xD3, 0x23, 0x11, 0xBA, 0x59, 0x22, 0x74, 0xB8, 0xAB, 0x39, 0x42, 0xF7, 0x5A,
+    0x9A, 0x52, 0x78, 0x77, 0x58, 0x1B, 0x20, 0x67, 0x02, 0x9A, 0x8A, 0x4B, 0xB8, 0x1D, 0x9B, 0xD3,
+    0x3C, 0x89, 0x87, 0x01, 0x43, 0xFA, 0xDE, 0xDC, 0x56, 0x03, 0xE8, 0x87, 0xBF, 0x87, 0x78, 0xF8,
+    0xED, 0x17, 0x45, 0x6E, 0xFF, 0x35, 0x00, 0xC7, 0x60, 0x63, 0xF5, 0xED, 0x38, 0xBD, 0xCD, 0xAA,
+    0xA4, 0x41, 0x9C, 0x5E, 0x3F, 0x51, 0x9C, 0xBE, 0x64, 0xEA, 0x67, 0xC3, 0xEC, 0x86, 0x97, 0xCC,
+    0x95, 0x41, 0x67, 0xBD, 0x3F, 0x79, 0x02, 0xE6, 0xCB, 0x12, 0xBF, 0x3B, 0x08, 0x64, 0x0D, 0x6C,
+    0xA9, 0x66, 0x66, 0xDC, 0xA0, 0xC4, 0xE5, 0xE0, 0xD4, 0x17, 0x16, 0xD1, 0x7B, 0x8A, 0x3E, 0x75,
+    0x0B, 0xBB, 0x8A, 0x65, 0xA2, 0xDB, 0xF4, 0xEA, 0xB6, 0x07, 0xF1, 0x6B, 0xC2, 0xDB, 0xFB, 0x95,
+    0xC2, 0xEA, 0xD5, 0x06, 0x56, 0xA7, 0x0A, 0xAB, 0x0B, 0x85, 0xD5, 0xF7, 0x09, 0xAB, 0xB9, 0x51,
+    0xE1, 0x99, 0xDF, 0xA5, 0x3B, 0x0E, 0xDF, 0x24, 0x8D, 0x15, 0x4A, 0x3F, 0xA7, 0xF4, 0x15, 0xA5,
+    0xB7, 0xF5, 0xE7, 0x2D, 0xE9, 0xFF, 0xD4, 0x84, 0xD5, 0xF7, 0x79, 0xAC, 0x2C, 0x36, 0x39, 0xB5,
+    0xD0, 0xA8, 0x5E, 0x9A, 0x2D, 0x58, 0xFD, 0xB1, 0xEE, 0x98, 0x66, 0xAB, 0xEA, 0xA6, 0x7B, 0x96,
+    0x0A, 0x6D, 0x18, 0x3F, 0x32, 0x92, 0x9C, 0xB7, 0xCE, 0x6D, 0x39, 0x78, 0xD0, 0x32, 0x9C, 0xB2,
+    0x20, 0x3A, 0x06, 0x88, 0x4E, 0x01, 0xA2, 0x0B, 0x80, 0xE7, 0xFF, 0x1D, 0xCB, 0x77, 0x7F, 0x35,
+    0x96, 0x77, 0xEF, 0x4E, 0xE5, 0x2F, 0x01, 0xA2, 0xFF, 0x0D, 0x20, 0x7A, 0x00, 0x88, 0xEE, 0x36,
+    0x20, 0x1A, 0xC0, 0x55, 0xE2, 0x79, 0x01, 0xAE, 0x69, 0x6D, 0x6D, 0x52, 0x93, 0x55, 0xA8, 0xA7,
+    0x4A, 0x7E, 0xD0, 0x6A, 0xD4, 0xAA, 0x5A, 0x99, 0x5F, 0x3C, 0x1B, 0xF9, 0xB3, 0x4B, 0xD0, 0xA6,
+    0xEC, 0x87, 0xD0, 0xB8, 0x77, 0xE1, 0x7D, 0x1B, 0x20, 0xAC, 0x0E, 0x81, 0xF1, 0xEE, 0xCE, 0x69,
+    0xE6, 0xCD, 0x36, 0x36, 0x49, 0x93, 0xB0, 0x12, 0xFC, 0x96, 0x11, 0x7B, 0xB4, 0xA2, 0xC9, 0xF2,
+    0xB6, 0xA0, 0xC8, 0x33, 0x95, 0x83, 0x66, 0x14, 0x08, 0x95, 0xE1, 0x15, 0xFD, 0xE3, 0x02, 0xDB,
+    0x38, 0x46, 0xF8, 0xE1, 0x9D, 0x9A, 0x1C, 0x76, 0xF6, 0xAE, 0xD1, 0x0E, 0x52, 0xE1, 0x06, 0x26,
+    0xFC, 0xEF, 0x60, 0x0A, 0x92, 0x32, 0x3A, 0xDA, 0x99, 0xC5, 0xC4, 0x33, 0x36, 0x15, 0xAD, 0x0F,
+    0xC1, 0x68, 0x44, 0xA7, 0x1F, 0x2C, 0xC4, 0x5B, 0x79, 0x66, 0x3E, 0xF6, 0xE3, 0x88, 0x19, 0x66,
+    0xF2, 0xD0, 0x0D, 0x47, 0xF6, 0xF4, 0x20, 0x8F, 0x12, 0x9F, 0x8E, 0x4B, 0x4F, 0xF2, 0xE8, 0x39,
+    0x9E, 0x4B, 0x00, 0x53, 0xC5, 0xDF, 0x62, 0xCD, 0xEF, 0xF6, 0x12, 0x35, 0x18, 0xA1, 0xBD, 0xBA,
+    0xAC, 0xB9, 0x14, 0x3D, 0xFD, 0x74, 0x8E, 0x90, 0xA8, 0x42, 0x48, 0x04, 0x4B, 0x1C, 0xB7, 0x80,
+    0xA6, 0x5D, 0xF9, 0xEB, 0xEF, 0x74, 0x30, 0x44, 0x5D, 0x79, 0x6F, 0x7D, 0x83, 0xA2, 0xA6, 0xA0,
+    0x99, 0x0F, 0x86, 0x85, 0xB8, 0x11, 0xF7, 0x7E, 0x13, 0xD2, 0xD8, 0xCD, 0x15, 0x5F, 0xDD, 0xF5,
+    0x1A, 0x4C, 0xC4, 0x34, 0x81, 0xD9, 0xB7, 0xC1, 0xE6, 0x2B, 0x3C, 0x46, 0x79, 0xF1, 0x0B, 0xE7,
+    0xF5, 0x91, 0x75, 0xAD, 0x62, 0x99, 0xD7, 0xF5, 0x34, 0x78, 0xDD, 0xA7, 0x2C, 0x5F, 0x85, 0x11,
+    0xBF, 0xDB, 0x49, 0x54, 0xF3, 0xE0, 0x0E, 0x64, 0xB9, 0x67, 0x65, 0x19, 0x28, 0x7B, 0x30, 0x41,
+    0xF4, 0x79, 0x4B, 0x99, 0xE2, 0x09, 0x2E, 0xFC, 0xDE, 0x2F, 0x27, 0x06, 0x25, 0xD5, 0x89, 0xF7,
+    0x35, 0x27, 0xDF, 0xE7, 0xAD, 0x6F, 0x28, 0xE8, 0xB1, 0xB1, 0xEE, 0x63, 0x5E, 0x44, 0x95, 0x18,
+    0xDB, 0xB7, 0x51, 0x0E, 0xA1, 0xB7, 0x69, 0x92, 0xB7, 0xDA, 0x17, 0xA5, 0xBB, 0xA8, 0xCB, 0xF8,
+    0x94, 0x07, 0x2A, 0x44, 0x0F, 0xE8, 0x65, 0x66, 0x75, 0xFD, 0x3B, 0xD5, 0x6D, 0xBF, 0xDE, 0xD3,
+    0x83, 0xB2, 0x7F, 0x77, 0x4B, 0x8A, 0x91, 0xA7, 0xAD, 0x82, 0xCF, 0xFC, 0x03, 0x9C, 0x60, 0xEE,
+    0xCA, 0xB4, 0x9E, 0x35, 0xA6, 0xA3, 0x1A, 0x88, 0x52, 0x01, 0x4F, 0xFA, 0x4D, 0x45, 0x5C, 0x95,
+    0x42, 0xAE, 0x2D, 0x63, 0x7A, 0x06, 0x0E, 0x54, 0xA8, 0x49, 0x7D, 0x0F, 0xEF, 0x7C, 0x1F, 0xE6,
+    0xA6, 0x85, 0xAD, 0xEB, 0x61, 0x52, 0x2F, 0xEE, 0x9C, 0xDE, 0x81, 0x0A, 0x6B, 0x33, 0x3D, 0x5D,
+    0xB0, 0x40, 0xD1, 0x44, 0xFC, 0x6B, 0xCD, 0x64, 0x29, 0x3E, 0xD9, 0x91, 0x33, 0x25, 0x0D, 0x8B,
+    0xAD, 0xF0, 0x2F, 0xEC, 0xAC, 0x77, 0x7C, 0x00, 0xA0, 0x13, 0xE5, 0x32, 0x6F, 0xC0, 0x53, 0x90,
+    0x86, 0xB7, 0x47, 0xFC, 0x11, 0xF6, 0xA5, 0x62, 0x6F, 0x85, 0x78, 0xD7, 0x69, 0x5B, 0x25, 0x51,
+    0x0D, 0xF1, 0xB6, 0xE2, 0x04, 0x4D, 0x4B, 0xCC, 0x67, 0x7C, 0x5D, 0x36, 0xC5, 0xA6, 0x57, 0x52,
+    0x8D, 0x96, 0x92, 0x2D, 0x6A, 0x13, 0x0B, 0xF6, 0x2E, 0x51, 0xAC, 0xF9, 0xBD, 0x26, 0x57, 0x2C,
+    0xF8, 0x8E, 0x34, 0x9D, 0x10, 0xE8, 0x37, 0x36, 0x1D, 0x23, 0x27, 0x92, 0xC1, 0x1A, 0x72, 0x25,
+    0x9B, 0x64, 0x70, 0xEF, 0x95, 0xD5, 0x25, 0x6F, 0x0F, 0x9B, 0x16, 0x51, 0xEE, 0x6F, 0x00, 0x98,
+    0x5B, 0x44, 0xAA, 0x43, 0x92, 0xCB, 0x45, 0x2B, 0x87, 0xE7, 0x6F, 0xA6, 0x4D, 0x36, 0x94, 0x7D,
+    0x38, 0x1A, 0xC4, 0x5B, 0x3F, 0xE8, 0x03, 0x13, 0x34, 0x1C, 0x5D, 0xF3, 0x64, 0x9F, 0x72, 0x85,
+    0x9A, 0x50, 0xBB, 0xC1, 0x42, 0xF1, 0x26, 0x44, 0x5F, 0xE9, 0x9A, 0xAB, 0x46, 0xFC, 0x13, 0xBF,
+    0x7E, 0x8E, 0x27, 0xD9, 0xA1, 0x2E, 0xBB, 0x67, 0x43, 0x06, 0x56, 0x17, 0xAC, 0x31, 0xF6, 0x1E,
+    0x72, 0xB2, 0x4F, 0x2D, 0x83, 0x7D, 0x4D, 0x11, 0xD0, 0x36, 0x8A, 0x5A, 0x47, 0x51, 0x7B, 0x2C,
+    0xD6, 0x42, 0x2E, 0x36, 0xF2, 0x8C, 0x94, 0xD6, 0x77, 0x72, 0xC0, 0x81, 0xF8, 0x43, 0xF2, 0xD1,
+    0xB3, 0xE2, 0x3C, 0x24, 0xCC, 0xBD, 0x5A, 0x1C, 0x9A, 0x7F, 0xAE, 0x65, 0x74, 0x6F, 0x59, 0x04,
+    0x5D, 0x06, 0x51, 0xAF, 0x28, 0xBA, 0x14, 0xB2, 0xF1, 0x8C, 0x67, 0xE5, 0x00, 0xC2, 0xAE, 0xF5,
+    0x49, 0x04, 0x12, 0xCC, 0xE1, 0xBE, 0xD5, 0x12, 0xE4, 0x75, 0x04, 0x12, 0xBB, 0x9F, 0xF3, 0x61,
+    0x03, 0x61, 0x42, 0x61, 0x2A, 0xDB, 0xA8, 0x8D, 0x86, 0xB8, 0x0E, 0x86, 0xA4, 0xF6, 0xFB, 0xB4,
+    0xF1, 0x0E, 0x99, 0x84, 0x8E, 0x99, 0x2C, 0x47, 0x28, 0xAC, 0xA7, 0x08, 0x98, 0x30, 0x4A, 0x4C,
+    0xAF, 0x89, 0x06, 0x49, 0x26, 0x0F, 0x86, 0x31, 0xC1, 0xB7, 0x00, 0x79, 0x53, 0x56, 0x79, 0x63,
+    0xDA, 0x04, 0x7D, 0x3C, 0x1D, 0x34, 0x9A, 0x3F, 0x5B, 0x8E, 0xDD, 0xD6, 0x3C, 0xBF, 0x69, 0x4F,
+    0x83, 0xBC, 0xE4, 0xF2, 0x57, 0x25, 0xC0, 0x18, 0x33, 0x83, 0x55, 0x96, 0xA7, 0xAB, 0x24, 0xCF,
+    0xAA, 0xAF, 0x28, 0x6E, 0x49, 0x98, 0xCD, 0x35, 0x83, 0x2D, 0x72, 0xA7, 0xBA, 0xC5, 0xAA, 0xE7,
+    0x24, 0xAD, 0x32, 0xF7, 0x64, 0x7A, 0x8F, 0x09, 0xAF, 0x7E, 0x63, 0x6C, 0x89, 0x2E, 0x99, 0x7E,
+    0xE0, 0xE1, 0xC3, 0x77, 0x6C, 0x94, 0x0B, 0x07, 0x60, 0x7A, 0x86, 0x91, 0xFD, 0x1D, 0x08, 0xBF,
+    0x7F, 0x07, 0xE4, 0x7B, 0xB7, 0x67, 0xF2, 0xB2, 0x2E, 0xC8, 0x53, 0x91, 0x03, 0xE6, 0x74, 0x4A,
+    0xD3, 0x9F, 0x88, 0xA7, 0x87, 0xF9, 0x2C, 0x16, 0xD3, 0xF1, 0xF6, 0x3C, 0x96, 0xE7, 0x72, 0x75,
+    0xAF, 0xF3, 0xAE, 0x37, 0xC8, 0xE5, 0xE9, 0x56, 0x61, 0x86, 0xAF, 0x8E, 0xD7, 0xB0, 0x30, 0x9F,
+    0xFA, 0x37, 0xF2, 0x1D, 0x3E, 0x24, 0x50, 0x0E, 0x6E, 0x71, 0x32, 0xCD, 0xF4, 0x0D, 0x8C, 0x9D,
+    0x9D, 0x75, 0x07, 0x82, 0xC1, 0xA2, 0x98, 0x26, 0xAB, 0x93, 0x9E, 0x89, 0xD4, 0x02, 0xDA, 0x90,
+    0xE6, 0x34, 0x51, 0x4C, 0x35, 0x13, 0xE6, 0xC0, 0x85, 0x31, 0x3D, 0xCE, 0x45, 0xB8, 0x59, 0xB4,
+    0xF6, 0xFB, 0x70, 0xB4, 0xF3, 0x5F, 0x2E, 0x3C, 0x00, 0x50, 0xA2, 0xF7, 0xD4, 0x7E, 0x01, 0xB9,
+    0x8D, 0x72, 0xD9, 0x1C, 0x4A, 0x06, 0xFE, 0xFE, 0x12, 0xEF, 0x39, 0x8F, 0x45, 0x4F, 0x3F, 0x18,
+    0xA5, 0xC8, 0x4D, 0xFE, 0x73, 0x04, 0xDF, 0xD7, 0x61, 0x17, 0xFF, 0x5C, 0x43, 0x8F, 0x52, 0x93,
+    0xCE, 0xF4, 0x85, 0x1E, 0x0C, 0xA0, 0xFF, 0xF1, 0xE8, 0x92, 0x56, 0x0B, 0x76, 0x74, 0x97, 0x46,
+    0x9D, 0x36, 0x6B, 0x0F, 0xE3, 0x78, 0x1E, 0xBA, 0x83, 0xE0, 0x42, 0x7E, 0x2A, 0xB2, 0x9C, 0x93,
+    0x6C, 0xED, 0x39, 0xC9, 0x42, 0x39, 0xD5, 0x58, 0x31, 0xE9, 0x4E, 0x9E, 0x93, 0xCC, 0x98, 0xED,
+    0x02, 0x2A, 0xEB, 0x12, 0x07, 0xCC, 0x6C, 0xAE, 0x3C, 0xFF, 0x63, 0x74, 0x93, 0xAC, 0x7F, 0xBC,
+    0xE7, 0x5D, 0x75, 0x00, 0xE3, 0xC3, 0x88, 0x5F, 0x66, 0x11, 0xB5, 0xE7, 0xE9, 0xD6, 0xA7, 0xAF,
+    0x6A, 0xC2, 0xFA, 0x04, 0xA3, 0x61, 0xDA, 0xEE, 0xE9, 0xD2, 0x61, 0x9D, 0xA6, 0xC3, 0xFE, 0x00,
+    0x8D, 0x55, 0xBF, 0x8F, 0x1B, 0x45, 0x14, 0xFE, 0xC6, 0x7B, 0xBE, 0x0D, 0xB7, 0xC1, 0x6B, 0x81,
+    0x1D, 0x85, 0x84, 0xF3, 0x5E, 0x19, 0x4E, 0xB1, 0x37, 0x45, 0x84, 0x02, 0x5A, 0x7B, 0xE6, 0x4F,
+    0x70, 0x61, 0x8B, 0x22, 0xCD, 0x15, 0x54, 0x29, 0xC8, 0x21, 0x1D, 0x92, 0x15, 0xD9, 0xDE, 0xED,
+    0x69, 0x5C, 0x51, 0x21, 0xC5, 0x45, 0x0A, 0x62, 0x01, 0xB9, 0xC2, 0x48, 0x57, 0xD8, 0xDE, 0x95,
+    0x52, 0x44, 0x4A, 0x35, 0x1D, 0xED, 0x02, 0xE9, 0x59, 0xA4, 0x45, 0x72, 0xB1, 0xF6, 0xF0, 0x66,
+    0xED, 0xBB, 0x24, 0x07, 0x91, 0xD8, 0x37, 0x33, 0x3B, 0x3F, 0xDE, 0xBC, 0x79, 0xF3, 0xDE, 0xF7,
+    0xDE, 0x54, 0x05, 0x8F, 0xED, 0xB4, 0x90, 0x61, 0x88, 0x22, 0xEB, 0x1A, 0x2B, 0x3B, 0x75, 0xA2,
+    0x16, 0xCA, 0x40, 0x07, 0x86, 0x82, 0xA5, 0x02, 0xE7, 0x5B, 0x39, 0x60, 0x69, 0x99, 0xA6, 0x04,
+    0x60, 0x66, 0x96, 0x70, 0xD4, 0x33, 0xF0, 0x50, 0xC1, 0xB3, 0x32, 0x00, 0x6D, 0x70, 0x15, 0x51,
+    0xA9, 0x76, 0x85, 0x52, 0x2A, 0x0E, 0xA9, 0x12, 0xE7, 0x59, 0x21, 0x1E, 0xDE, 0x97, 0xAE, 0x0A,
+    0xAC, 0xB5, 0x66, 0x29, 0x82, 0x47, 0xBE, 0xF4, 0xE5, 0x0D, 0x31, 0x30, 0xA5, 0xB2, 0x13, 0x2A,
+    0x7D, 0x33, 0x02, 0x9C, 0x65, 0x6B, 0x7E, 0xD0, 0x42, 0xAB, 0xB0, 0x34, 0xA2, 0x42, 0xB4, 0x3B,
+    0xE2, 0x59, 0xAF, 0x7E, 0xB2, 0xDF, 0xAB, 0xBB, 0xCB, 0xDD, 0x11, 0x6B, 0x77, 0xED, 0xBF, 0x56,
+    0xCE, 0xF3, 0x25, 0x37, 0xE3, 0x99, 0x1D, 0xB4, 0x8B, 0xA8, 0xA0, 0xD2, 0xC2, 0xD2, 0x7E, 0x91,
+    0x98, 0x2A, 0x2A, 0x28, 0x81, 0x2E, 0xE0, 0xE9, 0x0F, 0xE8, 0x37, 0xCF, 0xA9, 0xCA, 0x48, 0xA1,
+    0x17, 0x29, 0xEC, 0xDF, 0x32, 0x18, 0xC9, 0x10, 0x58, 0x3A, 0x02, 0x15, 0x06, 0xF6, 0x04, 0x46,
+    0xA6, 0x4B, 0x61, 0x89, 0x94, 0x25, 0x73, 0x33, 0x26, 0x9D, 0x2D, 0xA5, 0x95, 0xA3, 0x8F, 0xB4,
+    0x24, 0x5D, 0x49, 0x63, 0xD2, 0x5B, 0xDF, 0xB3, 0x6D, 0xC6, 0x0E, 0x3C, 0x0C, 0x10, 0x06, 0x61,
+    0xE4, 0x47, 0x6E, 0x40, 0xAA, 0x0A, 0x1E, 0xF1, 0x98, 0xC7, 0x56, 0x6C, 0x44, 0x56, 0x30, 0xC4,
+    0x94, 0xB6, 0xDD, 0xA4, 0xB9, 0x90, 0x68, 0x48, 0xBC, 0x0D, 0x58, 0x92, 0x8D, 0xFF, 0x9B, 0xAF,
+    0x2A, 0x7C, 0x69, 0x27, 0xC6, 0x12, 0x73, 0xEC, 0xB0, 0x8E, 0xB9, 0xB2, 0x13, 0x97, 0xF6, 0x94,
+    0xC1, 0x22, 0x16, 0xF1, 0xE8, 0x1A, 0xB5, 0xC0, 0x5D, 0x22, 0x1E, 0x7D, 0x26, 0xEE, 0x6A, 0x7D,
+    0x10, 0x2A, 0x32, 0xB0, 0x73, 0x41, 0x7B, 0xDA, 0x80, 0x3C, 0x76, 0x62, 0x43, 0x3A, 0xC1, 0x5C,
+    0x33, 0xB8, 0xBD, 0xD3, 0xD3, 0x41, 0xAD, 0x08, 0x9B, 0xE8, 0xE1, 0x48, 0x25, 0xDD, 0xB6, 0x4A,
+    0x74, 0x7F, 0x8F, 0xC8, 0x46, 0x18, 0x3F, 0x1B, 0xEB, 0x3E, 0xC0, 0xB3, 0x6A, 0x87, 0x7E, 0x89,
+    0x26, 0x96, 0xA8, 0x58, 0x45, 0x87, 0xE7, 0x43, 0xA4, 0x08, 0x13, 0x9E, 0xEC, 0x05, 0x0C, 0xAE,
+    0xE4, 0x09, 0x89, 0x0F, 0x2E, 0xBC, 0xE3, 0x99, 0x11, 0x13, 0x6E, 0xDA, 0xEC, 0x9F, 0xEC, 0x9F,
+    0xEC, 0xB7, 0x66, 0x56, 0x4C, 0x17, 0x23, 0x33, 0x70, 0xBA, 0x68, 0x05, 0x0C, 0xA6, 0xB0, 0x12,
+    0x82, 0xCC, 0x1C, 0x2B, 0x3F, 0xE3, 0xB1, 0x29, 0x1D, 0xB4, 0x08, 0x3F, 0xBE, 0xE0, 0x2B, 0x6B,
+    0x75, 0x4B, 0xBB, 0xA4, 0xC2, 0x55, 0xE6, 0xAB, 0x55, 0x0F, 0xF5, 0x63, 0xBC, 0x7F, 0x80, 0x2B,
+    0x74, 0xE6, 0x38, 0x1E, 0x7F, 0x9D, 0x48, 0x1E, 0x46, 0x3B, 0xB9, 0x27, 0x5D, 0xF2, 0xE4, 0xF3,
+    0xC4, 0x50, 0x11, 0x23, 0x4F, 0x56, 0x41, 0xCE, 0xA4, 0x0E, 0x0D, 0x69, 0x92, 0x23, 0x23, 0x86,
+    0x73, 0x14, 0x45, 0x5B, 0x14, 0xE5, 0x58, 0xA3, 0x0E, 0x7F, 0xC3, 0x51, 0x4C, 0xC0, 0x49, 0x6B,
+    0x5C, 0xCD, 0xE7, 0x61, 0x36, 0x75, 0x92, 0x9C, 0x69, 0x8B, 0x47, 0x9C, 0x0F, 0xF4, 0x68, 0x33,
+    0x7C, 0xB3, 0x5F, 0xED, 0x76, 0x85, 0xEE, 0xEB, 0x3F, 0x0D, 0x6D, 0x2D, 0x65, 0x30, 0x54, 0x24,
+    0x25, 0x05, 0x13, 0xDD, 0x6E, 0x37, 0x54, 0xEB, 0x07, 0x93, 0xA7, 0xB4, 0xDC, 0xED, 0xF8, 0x04,
+    0xEC, 0xD5, 0x83, 0xC9, 0x64, 0xF2, 0x34, 0x17, 0x79, 0x0B, 0x2C, 0xA3, 0x63, 0x11, 0x0A, 0x6B,
+    0x09, 0x1E, 0xA0, 0x89, 0xD7, 0x9F, 0x4D, 0xC2, 0x6C, 0xFA, 0x37, 0xA8, 0x12, 0x2E, 0xD1, 0xA3,
+    0x9A, 0xE6, 0x06, 0x47, 0x81, 0x6C, 0x68, 0xD0, 0xD9, 0x1A, 0xF7, 0x97, 0xD9, 0xFA, 0xFF, 0x8F,
+    0x6D, 0x47, 0x1F, 0xB1, 0xAC, 0x97, 0x4A, 0x83, 0xE9, 0x1D, 0x5C, 0x3D, 0xC1, 0xFE, 0x00, 0x03,
+    0xB2, 0xF2, 0xE1, 0xE4, 0x07, 0x2A, 0x8F, 0x26, 0x3F, 0x91, 0xAD, 0xA9, 0x50, 0x87, 0x86, 0x1A,
+    0x23, 0x8F, 0xA3, 0x6F, 0xFE, 0x96, 0xE3, 0xD3, 0x31, 0x41, 0xAD, 0x2C, 0x7E, 0x89, 0xDD, 0xC8,
+    0x11, 0x43, 0x79, 0x30, 0xDA, 0x69, 0x25, 0x49, 0xBF, 0x61, 0xD7, 0x66, 0x97, 0xAD, 0x70, 0x61,
+    0xA1, 0xAA, 0xE0, 0x04, 0xD8, 0x6D, 0x52, 0xE8, 0x98, 0x99, 0x9D, 0xF0, 0x60, 0xB0, 0x09, 0x95,
+    0x4B, 0x96, 0xAA, 0x60, 0x01, 0x05, 0x17, 0x25, 0x9C, 0xE9, 0xD5, 0x8F, 0xB4, 0x90, 0x00, 0x1E,
+    0xAF, 0x63, 0xD1, 0xF2, 0xB1, 0xF0, 0x7C, 0xDC, 0xEA, 0x7D, 0x02, 0x9D, 0x4F, 0xAA, 0x1A, 0xC2,
+    0x9A, 0x12, 0x4B, 0x5E, 0x42, 0xC7, 0xBB, 0x1D, 0xF3, 0x3A, 0xB0, 0xC3, 0x38, 0x8C, 0x0B, 0x39,
+    0xE5, 0x01, 0x0B, 0x5B, 0xD9, 0x5C, 0xFD, 0xFC, 0x48, 0x65, 0xA7, 0x61, 0x8A, 0x8D, 0xE7, 0x2B,
+    0x20, 0x55, 0x74, 0x19, 0x90, 0x62, 0x25, 0x67, 0x3D, 0xA4, 0x63, 0xCE, 0x1E, 0xA6, 0x14, 0x94,
+    0xA4, 0xA4, 0x9E, 0x0F, 0xCF, 0xBD, 0xF4, 0xF6, 0x1D, 0xFE, 0x3D, 0xC3, 0x76, 0x50, 0xBA, 0xAF,
+    0x81, 0xE4, 0x28, 0x51, 0x2C, 0x6E, 0x37, 0x91, 0xFE, 0x8E, 0xB0, 0xF3, 0x88, 0xF3, 0xF5, 0x3D,
+    0xE4, 0xA6, 0x3D, 0xD6, 0x8B, 0xD4, 0x12, 0x9B, 0x3C, 0xC2, 0xCB, 0x3B, 0x18, 0xE1, 0x8A, 0xF8,
+    0x80, 0xE6, 0xAE, 0xC2, 0xA0, 0xF6, 0x48, 0xC3, 0xF6, 0x88, 0xDA, 0xF1, 0x68, 0xCB, 0x29, 0x81,
+    0x3B, 0xF2, 0x98, 0x4E, 0x2D, 0xCB, 0x63, 0xBD, 0x2A, 0x35, 0x0F, 0x29, 0x79, 0x05, 0x05, 0xBD,
+    0x4B, 0x7C, 0x08, 0x1C, 0xB0, 0x97, 0x77, 0x11, 0x6C, 0x64, 0x6E, 0x76, 0x3D, 0x0A, 0x0E, 0x83,
+    0x43, 0x3A, 0xD1, 0x97, 0x5C, 0x0A, 0xB2, 0xB5, 0x33, 0x32, 0x63, 0x57, 0xE8, 0xE4, 0xB2, 0xD7,
+    0x9A, 0x9E, 0x9E, 0xF1, 0xE2, 0x26, 0x8B, 0x91, 0xCA, 0x14, 0xC3, 0x94, 0xE0, 0x0A, 0xE9, 0x36,
+    0xDF, 0xB1, 0xF4, 0xC2, 0xF7, 0xBE, 0x3C, 0x08, 0x50, 0x2E, 0xC4, 0x0F, 0xC5, 0x9C, 0xA2, 0x99,
+    0x91, 0x21, 0xDF, 0x96, 0x34, 0xC2, 0x68, 0xCE, 0x12, 0xE7, 0xF7, 0xC4, 0xFA, 0x63, 0xB9, 0x30,
+    0x6F, 0x8F, 0x4B, 0xA5, 0xF1, 0xAC, 0x56, 0x6A, 0x64, 0x94, 0x7A, 0xFD, 0x28, 0xA4, 0xC3, 0x6F,
+    0x08, 0x8D, 0xCD, 0xCF, 0x7F, 0xBC, 0xF9, 0xCA, 0x5D, 0x7E, 0xFA, 0x3D, 0xE5, 0xB7, 0xEF, 0xE2,
+    0xC6, 0xE2, 0xEC, 0x9E, 0x77, 0x9B, 0x4A, 0x7D, 0xD1, 0xB3, 0x7E, 0x8D, 0xEF, 0x51, 0x16, 0xF3,
+    0xE3, 0x07, 0x92, 0x32, 0x5B, 0xB0, 0x31, 0x9B, 0x16, 0xCC, 0xE2, 0x96, 0x56, 0x2F, 0xB2, 0x5F,
+    0x81, 0x85, 0x14, 0xE7, 0x4A, 0x11, 0xD8, 0x6F, 0xAA, 0xB5, 0xD8, 0xFA, 0x63, 0x9C, 0x37, 0x3A,
+    0x08, 0x8C, 0xC8, 0xA1, 0x7D, 0xAE, 0x30, 0xD7, 0xDD, 0xFB, 0x2B, 0x80, 0x22, 0x8F, 0xAC, 0xC5,
+    0x26, 0x4F, 0x74, 0x46, 0xA4, 0x97, 0x45, 0x07, 0xE1, 0x28, 0x6F, 0xF2, 0x61, 0xBE, 0x99, 0x4D,
+    0x48, 0xCC, 0x7B, 0xB6, 0x52, 0x23, 0x34, 0x08, 0x38, 0x6A, 0x92, 0xF5, 0x49, 0xB6, 0x4A, 0x4F,
+    0x81, 0x6B, 0x6A, 0xAB, 0x04, 0x76, 0xF5, 0xB2, 0x96, 0xB1, 0x06, 0x89, 0xEE, 0x86, 0x52, 0xA7,
+    0xF4, 0xC2, 0x52, 0x87, 0xE7, 0x1B, 0xF1, 0xCB, 0x34, 0xFA, 0xBE, 0x10, 0x5A, 0xB6, 0xD4, 0x41,
+    0xAF, 0x01, 0x69, 0x6C, 0x96, 0x8A, 0xED, 0x5A, 0x6F, 0xC7, 0xDB, 0x9B, 0xE9, 0xE4, 0xE6, 0x7C,
+    0x45, 0x63, 0xD1, 0x4C, 0xA6, 0xD3, 0x75, 0x9A, 0xA2, 0x57, 0x76, 0x73, 0x45, 0x3C, 0x5C, 0xA7,
+    0x37, 0x73, 0x80, 0x7A, 0x4E, 0x4D, 0x02, 0x1B, 0x6B, 0xD7, 0xFA, 0x5E, 0x4D, 0xD3, 0xED, 0xBA,
+    0x45, 0x37, 0xAE, 0x54, 0xE0, 0x35, 0xE1, 0xD5, 0xB7, 0xA5, 0xDE, 0x84, 0xF3, 0x67, 0x2E, 0x9B,
+    0x64, 0xF5, 0x8E, 0xA6, 0xE4, 0x0B, 0xAF, 0xEC, 0x68, 0x59, 0x33, 0x2D, 0xAD, 0xE8, 0xA1, 0x35,
+    0xA3, 0x07, 0x0E, 0xBD, 0xBC, 0xD0, 0x4E, 0xE7, 0x31, 0xCE, 0x17, 0xD1, 0xA4, 0x67, 0x6E, 0x86,
+    0x66, 0xFD, 0xB5, 0xB8, 0xD0, 0x45, 0xA7, 0xDD, 0xC6, 0x70, 0x41, 0x9B, 0xF2, 0xF9, 0xC6, 0x45,
+    0x5D, 0xB8, 0x8E, 0xE8, 0xB4, 0x87, 0x69, 0xF3, 0x80, 0xE4, 0x10, 0x2D, 0xC4, 0x2E, 0xBD, 0x53,
+    0x6E, 0x7B, 0x03, 0x66, 0x1B, 0x3A, 0xBD, 0x57, 0x8B, 0x68, 0x95, 0x50, 0xBB, 0x0A, 0xFB, 0x3A,
+    0xAC, 0x23, 0x7A, 0x3B, 0x51, 0x90, 0xA8, 0x56, 0xE1, 0xEE, 0xC3, 0xFA, 0x12, 0x46, 0x8C, 0xDD,
+    0x04, 0x1F, 0x7B, 0x98, 0xFB, 0xE2, 0x1F, 0xD5, 0x7D, 0x4D, 0x8C, 0x1D, 0xD7, 0x95, 0xDE, 0xAD,
+    0x2A, 0x36, 0x6B, 0x46, 0x95, 0xB8, 0xB4, 0x90, 0x3C, 0x8E, 0x18, 0xB3, 0xB2, 0xF0, 0xC2, 0x23,
+    0x99, 0xAC, 0x2C, 0x66, 0xC1, 0x31, 0xBA, 0x59, 0x25, 0x19, 0x18, 0x01, 0xF1, 0xC2, 0x4C, 0x20,
+    0xC2, 0x40, 0x04, 0x44, 0x0E, 0x82, 0x59, 0x44, 0x46, 0xD0, 0x5E, 0xC8, 0x00, 0x03, 0x34, 0x55,
+    0x25, 0x09, 0x89, 0x80, 0xCC, 0x62, 0x7A, 0x31, 0x4E, 0x80, 0x64, 0x61, 0x4E, 0x40, 0x04, 0xD2,
+    0x33, 0x82, 0x56, 0x30, 0x34, 0xA6, 0x83, 0x34, 0x55, 0x25, 0x69, 0x21, 0x20, 0x5A, 0xA8, 0x34,
+    0x9A, 0x89, 0x16, 0xB3, 0x50, 0x59, 0xA6, 0xC6, 0x1A, 0x69, 0xC1, 0x92, 0x55, 0xB2, 0xAA, 0xA9,
+    0x7A, 0x75, 0x73, 0xBE, 0xEF, 0xDE, 0x7A, 0x3F, 0xDD, 0xFC, 0x11, 0xA9, 0x16, 0x29, 0x37, 0xF9,
+    0xCE, 0x7D, 0xFD, 0x5E, 0xBD, 0x7A, 0xF7, 0xE7, 0xDC, 0x73, 0xBE, 0xF3, 0x77, 0x5B, 0x29, 0xFC,
+    0x64, 0x95, 0x90, 0xA8, 0x11, 0xE2, 0x75, 0xF8, 0xFD, 0x22, 0xC8, 0x3F, 0x52, 0xE6, 0x27, 0xD1,
+    0x5A, 0x97, 0x31, 0x88, 0xAB, 0xD3, 0xB0, 0x74, 0xB4, 0xF2, 0x41, 0x3C, 0x10, 0x37, 0x17, 0xA2,
+    0xD4, 0x22, 0xD1, 0xFD, 0x48, 0xF6, 0xBC, 0x61, 0xC9, 0x29, 0x90, 0x46, 0x88, 0xD3, 0xB8, 0x72,
+    0x97, 0xE6, 0x01, 0xB9, 0x73, 0x83, 0xEF, 0x68, 0x82, 0x74, 0x5B, 0xA9, 0xF8, 0x8D, 0x29, 0xC8,
+    0xA0, 0x54, 0x98, 0xF7, 0x6A, 0xE1, 0xE7, 0xB6, 0x75, 0x23, 0x13, 0xD2, 0x29, 0xD0, 0x5E, 0x3D,
+    0xE9, 0x0D, 0x4E, 0xAF, 0x76, 0xBC, 0x41, 0x6D, 0xA8, 0x6D, 0xA1, 0xAB, 0xEA, 0x09, 0xA1, 0x27,
+    0x64, 0x9E, 0x06, 0xF4, 0x69, 0xA4, 0x2B, 0x7F, 0x26, 0x54, 0x3E, 0x90, 0x93, 0x36, 0x42, 0x55,
+    0xDC, 0xE1, 0xDD, 0xB0, 0x9F, 0xD3, 0x60, 0x81, 0xDA, 0xD7, 0x3B, 0x5E, 0xD9, 0xA8, 0x75, 0xFD,
+    0xE7, 0xBA, 0x54, 0x85, 0xFE, 0x50, 0xC6, 0xAE, 0x56, 0x1E, 0xC1, 0x62, 0xB4, 0x18, 0x32, 0x96,
+    0xA5, 0x40, 0x87, 0xB9, 0x2A, 0xE9, 0xC2, 0x4C, 0xA4, 0x98, 0x89, 0x5C, 0x3E, 0x1D, 0xE5, 0xD2,
+    0xFD, 0x00, 0xC4, 0x9F, 0x11, 0xA5, 0x3E, 0x0F, 0x79, 0x40, 0xBF, 0x87, 0xEF, 0x98, 0x8E, 0x13,
+    0x1F, 0xC8, 0x6C, 0x48, 0xDF, 0x74, 0xEA, 0x0E, 0x4A, 0x97, 0x41, 0xA7, 0x92, 0x52, 0x58, 0x25,
+    0xC9, 0x93, 0x46, 0xFD, 0xBE, 0x4A, 0xEA, 0x91, 0x7D, 0x0A, 0x92, 0xF7, 0x27, 0xBC, 0x56, 0xC8,
+    0xBB, 0xA7, 0xED, 0x6B, 0x7C, 0x97, 0xD7, 0x25, 0x8D, 0x1D, 0x59, 0x8A, 0xF1, 0x97, 0x9E, 0xCE,
+    0xA3, 0x5C, 0x69, 0x5C, 0x7D, 0x04, 0xDF, 0xA1, 0xEE, 0xB5, 0xDF, 0x58, 0xC8, 0x34, 0x0D, 0xBA,
+    0x8C, 0xE4, 0x7B, 0x92, 0x34, 0x68, 0xB2, 0xD4, 0xAF, 0xB3, 0xDC, 0x4D, 0x71, 0xA3, 0xA4, 0x43,
+    0xDF, 0x72, 0x15, 0x4A, 0xFF, 0x5C, 0x4C, 0x78, 0xA6, 0x6B, 0x79, 0xD2, 0xE2, 0x9D, 0x43, 0x32,
+    0xB9, 0x1B, 0xCA, 0xEB, 0xA7, 0xC2, 0xC5, 0xB2, 0xA4, 0x6D, 0x91, 0x87, 0x4D, 0xB2, 0x5B, 0xE4,
+    0x01, 0xC6, 0xB2, 0x82, 0xCF, 0xB5, 0xB1, 0x6E, 0x3D, 0x19, 0x88, 0x56, 0x37, 0xF5, 0xFF, 0x01,
+    0x7D, 0x29, 0xD1, 0xDD, 0x51, 0xB7, 0x4E, 0x9E, 0x69, 0x93, 0x67, 0xDB, 0xF8, 0xA1, 0x66, 0x5C,
+    0x88, 0xCF, 0x75, 0xC3, 0x50, 0x0F, 0x81, 0xBE, 0x82, 0x49, 0xCA, 0xCA, 0x5B, 0xFC, 0x5F, 0x94,
+    0xB2, 0x24, 0x8E, 0x4E, 0x7D, 0xAD, 0x32, 0xE1, 0xD9, 0x1C, 0x73, 0x82, 0x59, 0x71, 0x65, 0x0D,
+    0x06, 0xE1, 0x97, 0x28, 0xE5, 0x9C, 0x87, 0x60, 0xB2, 0x6B, 0x34, 0xD1, 0xAC, 0xD1, 0xBB, 0xA6,
+    0x11, 0x56, 0x8C, 0xE5, 0xC5, 0xAC, 0x51, 0xC7, 0xA5, 0x91, 0xA5, 0x3A, 0x29, 0x8D, 0xF0, 0xED,
+    0x9A, 0x34, 0xFE, 0xD4, 0x34, 0x83, 0xDA, 0xE1, 0x6F, 0xB2, 0x3B, 0xF0, 0xDE, 0xCF, 0x3A, 0x5E,
+    0x29, 0xEB, 0x90, 0x34, 0x71, 0xA3, 0x6B, 0x7C, 0x7F, 0x99, 0x95, 0xBE, 0x96, 0x7B, 0x1E, 0x1A,
+    0x27, 0xAB, 0x2B, 0xB0, 0x4E, 0xB1, 0x7E, 0x6F, 0x5D, 0x5F, 0x02, 0xAF, 0xA5, 0x9E, 0xDD, 0x8C,
+    0xDC, 0x46, 0x37, 0x6E, 0x4F, 0x7F, 0x5F, 0x3F, 0xC2, 0xAD, 0x2D, 0x3F, 0xB5, 0xB4, 0x93, 0x9F,
+    0xE9, 0xAD, 0xA9, 0x79, 0x5F, 0x6E, 0x66, 0xAE, 0xD3, 0xA5, 0x69, 0x8B, 0xB1, 0xAD, 0xF6, 0xFC,
+    0x6E, 0x5B, 0x9D, 0xE3, 0xFB, 0x07, 0x9F, 0x6B, 0xB1, 0x8E, 0xAD, 0x9E, 0xE8, 0x5E, 0x3A, 0xBD,
+    0xA9, 0xCC, 0xF6, 0xB7, 0xFB, 0xDF, 0x0A, 0x00, 0x2B, 0x01, 0xAC, 0x08, 0x18, 0x65, 0x80, 0xDD,
+    0xFE, 0xF3, 0x06, 0x62, 0xC0, 0xCA, 0x01, 0x36, 0x35, 0x1A, 0x72, 0xBD, 0x5C, 0x02, 0xBE, 0x37,
+    0x7B, 0xFE, 0xFA, 0x8D, 0x66, 0xB3, 0xAE, 0xCF, 0x85, 0x43, 0x2E, 0x5B, 0xA9, 0x0D, 0x35, 0xF6,
+    0xCF, 0x69, 0x6E, 0x7E, 0x0D, 0xEA, 0x71, 0x67, 0xFA, 0xE4, 0xC1, 0x30, 0x07, 0x3D, 0xB4, 0x20,
+    0x24, 0xBB, 0x0C, 0xB2, 0xE1, 0xBD, 0x04, 0x4C, 0x99, 0x06, 0x2D, 0xA6, 0x27, 0x2C, 0x41, 0x63,
+    0x4E, 0xE5, 0x59, 0x50, 0xA7, 0x05, 0xF5, 0x2A, 0x50, 0x79, 0x13, 0x53, 0x5A, 0x93, 0xF2, 0xF5,
+    0xA8, 0x07, 0x0D, 0xA6, 0xBC, 0x46, 0x83, 0xBA, 0x32, 0x20, 0xF9, 0xAC, 0xE6, 0x7D, 0x84, 0x2D,
+    0x84, 0x26, 0x2D, 0x16, 0x50, 0x2E, 0x95, 0xE9, 0x0B, 0x74, 0x2E, 0x93, 0xE7, 0x70, 0xB3, 0xAB,
+    0x59, 0x07, 0x95, 0x36, 0x3D, 0x2A, 0x29, 0x43, 0xCC, 0x7B, 0x9B, 0xF3, 0x7E, 0xB6, 0x91, 0xEE,
+    0x65, 0xF3, 0xC8, 0xC6, 0xF7, 0xB0, 0x76, 0x25, 0x44, 0x8F, 0xCE, 0x67, 0xD4, 0x25, 0x0D, 0x48,
+    0x23, 0xD2, 0x0D, 0x50, 0xA7, 0x01, 0xF5, 0x2A, 0xD0, 0x30, 0x05, 0x5D, 0xE3, 0xF5, 0x1D, 0x69,
+    0x4D, 0x9A, 0x2F, 0xDE, 0x67, 0x46, 0x1F, 0xD0, 0x75, 0x80, 0x69, 0xC1, 0xF7, 0xDA, 0x4E, 0x84,
+    0xB9, 0xCC, 0x89, 0x8A, 0xCB, 0x44, 0x26, 0x31, 0x7E, 0xB7, 0x48, 0x21, 0xEA, 0xB8, 0x94, 0xF7,
+    0x8E, 0x92, 0x56, 0x84, 0x53, 0x2D, 0x33, 0x59, 0xE8, 0x3A, 0x16, 0x9D, 0x03, 0x99, 0xA2, 0x84,
+    0x63, 0x5C, 0x0A, 0x78, 0x99, 0x3E, 0x47, 0xE7, 0xBE, 0x0C, 0x4F, 0x97, 0xA1, 0x7C, 0x20, 0xAB,
+    0x23, 0x8A, 0xB8, 0xE3, 0xD8, 0x4C, 0xDD, 0x2A, 0xEE, 0xDF, 0x6F, 0x63, 0xA1, 0x86, 0x86, 0x92,
+    0x95, 0xEB, 0xC5, 0xB5, 0xC4, 0xAE, 0xC5, 0xA5, 0xFC, 0x96, 0x04, 0xE4, 0x9F, 0x53, 0xE1, 0x16,
+    0xEC, 0x58, 0xD1, 0xAA, 0x51, 0xF4, 0x2B, 0xC7, 0xCE, 0x95, 0x11, 0x34, 0x94, 0x35, 0xEA, 0x16,
+    0xC4, 0xCD, 0xCD, 0x8B, 0x27, 0xF9, 0xB9, 0x04, 0x35, 0x83, 0x9D, 0x10, 0xB3, 0x43, 0x21, 0x3B,
+    0x14, 0xB0, 0xE7, 0x3E, 0xA9, 0x97, 0xCF, 0xBA, 0x68, 0x57, 0xD9, 0x70, 0x00, 0x47, 0xEA, 0x90,
+    0xBA, 0x6F, 0x43, 0xAC, 0x7B, 0xAF, 0x61, 0x60, 0xFE, 0xAB, 0x60, 0x8B, 0xF0, 0x3B, 0x98, 0xE1,
+    0x90, 0x8A, 0xE6, 0xB8, 0x03, 0x7E, 0xC6, 0x02, 0x2A, 0xD9, 0x55, 0x98, 0x94, 0x17, 0x27, 0xB8,
+    0x05, 0x55, 0xA8, 0xF3, 0xF1, 0xE9, 0xF5, 0x46, 0xB9, 0xB5, 0xCC, 0x25, 0xA6, 0x5A, 0xA4, 0x90,
+    0x7C, 0xAB, 0x30, 0xA5, 0xF0, 0x6B, 0xA0, 0x55, 0xB1, 0x2B, 0x3B, 0xA4, 0x12, 0xB9, 0x5E, 0x18,
+    0xA5, 0x0D, 0xA9, 0x45, 0x8E, 0x8F, 0x21, 0x07, 0x42, 0x90, 0x00, 0xC4, 0x4F, 0x17, 0xB5, 0xFE,
+    0x69, 0xCB, 0xE4, 0x8E, 0xDE, 0xD2, 0x86, 0xA1, 0xC1, 0xCF, 0x90, 0x10, 0x49, 0xBD, 0x44, 0xF8,
+    0x5A, 0x21, 0x3C, 0x29, 0x77, 0x94, 0xC9, 0x98, 0x42, 0xE5, 0x6E, 0x1A, 0x82, 0x2F, 0x92, 0x35,
+    0x30, 0x1C, 0x9B, 0xD5, 0x2E, 0xF6, 0xF7, 0x8C, 0xF0, 0xD7, 0x4A, 0x08, 0xFA, 0x22, 0x73, 0x27,
+    0x64, 0xC0, 0x84, 0x16, 0x78, 0x2D, 0xC6, 0x25, 0x61, 0x37, 0x23, 0xFD, 0xF8, 0x2C, 0x6A, 0x71,
+    0x2B, 0x22, 0x10, 0xD9, 0x48, 0xF2, 0xB1, 0xDB, 0xA6, 0xE0, 0x29, 0x4B, 0x4B, 0xC7, 0xE8, 0x8C,
+    0x30, 0x85, 0xE0, 0x09, 0x55, 0xD8, 0xDE, 0x88, 0x1E, 0x25, 0x3D, 0x4E, 0x7A, 0x8C, 0x74, 0x75,
+    0x81, 0x9E, 0x21, 0x6D, 0x49, 0x1B, 0x50, 0x59, 0x44, 0xA1, 0x5E, 0x09, 0x5A, 0xF0, 0x1B, 0x2D,
+    0x4D, 0xB1, 0xFB, 0x76, 0xC8, 0x56, 0xD8, 0x29, 0x5E, 0x79, 0x81, 0xF4, 0x05, 0x74, 0xB4, 0x3C,
+    0x45, 0xC8, 0x73, 0xDB, 0x50, 0x5F, 0xA2, 0xBF, 0xA7, 0x75, 0xA4, 0xAB, 0x44, 0x7F, 0x57, 0x0F,
+    0xD2, 0x7A, 0xBD, 0xAC, 0xAE, 0x07, 0xD1, 0x2F, 0xDC, 0xE0, 0xD5, 0xD8, 0xA8, 0x59, 0x05, 0xF6,
+    0x0F, 0xF3, 0xAC, 0xC2, 0x4E, 0xF7, 0xAB, 0xAC, 0x5A, 0x43, 0x4F, 0x9B, 0xAC, 0x02, 0x97, 0x3B,
+    0x7D, 0xF6, 0x57, 0x9D, 0x95, 0xFF, 0xE4, 0x77, 0xAD, 0x29, 0x4D, 0xC2, 0x3E, 0x7B, 0x53, 0x53,
+    0x26, 0x64, 0x6F, 0x80, 0xD3, 0x13, 0xB9, 0x5E, 0x24, 0xA9, 0xDC, 0x3D, 0xAB, 0xB2, 0x1A, 0xD2,
+    0x23, 0xAB, 0x12, 0xC8, 0x54, 0xC1, 0x37, 0x11, 0x01, 0x61, 0x56, 0x85, 0x53, 0xB0, 0x7A, 0x56,
+    0x89, 0xB0, 0x29, 0xFA, 0xC3, 0xFA, 0x8A, 0x88, 0x36, 0x5D, 0x85, 0xC2, 0x78, 0xEB, 0x06, 0x79,
+    0x38, 0x85, 0x70, 0x62, 0x00, 0x56, 0x11, 0xE5, 0x3B, 0xC8, 0xEE, 0x03, 0x8C, 0x2C, 0x47, 0x3E,
+    0xB1, 0xCB, 0x4C, 0x31, 0x1C, 0x60, 0xD1, 0xF0, 0xB5, 0x21, 0x44, 0xBC, 0x3A, 0x32, 0xE5, 0xBB,
+    0x90, 0x3C, 0x78, 0x11, 0x78, 0x0E, 0x24, 0x21, 0x91, 0xBD, 0x92, 0x27, 0x15, 0x58, 0x6E, 0x10,
+    0x51, 0xE4, 0x82, 0xDB, 0x95, 0x73, 0xEA, 0x4B, 0x22, 0xAC, 0xBD, 0x1A, 0x93, 0x1F, 0x34, 0xA1,
+    0x0C, 0x23, 0xD8, 0x5D, 0xAF, 0x94, 0x81, 0x7F, 0x02, 0xEC, 0x4E, 0x7D, 0x39, 0x94, 0xCA, 0x9D,
+    0x55, 0xBD, 0xC4, 0x7D, 0x25, 0x60, 0x97, 0x7C, 0x20, 0x4A, 0x23, 0xEE, 0xE4, 0xA8, 0xBD, 0x1A,
+    0x8D, 0xF6, 0xD1, 0x98, 0xF4, 0x38, 0xE9, 0x49, 0xD2, 0xB5, 0x05, 0xBA, 0x03, 0x2A, 0x20, 0x48,
+    0xA8, 0xC0, 0x3C, 0xA1, 0xD2, 0x57, 0x50, 0x01, 0x79, 0x43, 0x9E, 0x09, 0xEB, 0xE9, 0xF2, 0x90,
+    0x9D, 0xFF, 0x5A, 0xD8, 0x77, 0x1A, 0x8B, 0xF4, 0xF6, 0xF5, 0x2E, 0x40, 0x79, 0x00, 0xE1, 0xD2,
+    0x83, 0x01, 0x9D, 0x4F, 0x7B, 0x75, 0x54, 0x9A, 0x4F, 0x04, 0x3F, 0x4A, 0xF3, 0x91, 0x56, 0xAB,
+    0xD2, 0xFC, 0x5A, 0xAB, 0x33, 0xD2, 0x7C, 0xA8, 0xD3, 0x56, 0x9A, 0x46, 0x97, 0x0D, 0x9A, 0xE2,
+    0xA5, 0x1A, 0x4D, 0xF6, 0xCB, 0x12, 0x4D, 0xF2, 0x11, 0x9B, 0xF8, 0xD3, 0x1C, 0x4D, 0x24, 0x73,
+    0x21, 0x4D, 0x68, 0x9A, 0x60, 0x60, 0xE3, 0xF7, 0x58, 0x91, 0x46, 0x76, 0xAB, 0x2E, 0x1F, 0xB8,
+    0xE2, 0xB6, 0x5C, 0x13, 0x25, 0x17, 0x4D, 0xA9, 0x38, 0xBB, 0x18, 0x0B, 0xD4, 0x51, 0x71, 0x62,
+    0xE1, 0x1C, 0x6A, 0xD0, 0xEB, 0x52, 0xA3, 0x4D, 0x0C, 0xFD, 0x2C, 0xD7, 0xCF, 0xA9, 0xB0, 0xC4,
+    0x11, 0xE8, 0x4E, 0xF9, 0xDE, 0x7E, 0x66, 0x40, 0x41, 0x83, 0x16, 0x1F, 0xC8, 0xB6, 0x13, 0x90,
+    0x27, 0x9A, 0x5D, 0x6C, 0x28, 0x11, 0x85, 0x62, 0x44, 0x09, 0xA8, 0x96, 0xAD, 0x2F, 0x98, 0x5A,
+    0xCC, 0x23, 0x79, 0x4B, 0x0C, 0x1C, 0x0F, 0xCA, 0xC2, 0x52, 0x77, 0x1F, 0xA5, 0x70, 0x20, 0xA6,
+    0xE4, 0xF5, 0xE6, 0xB3, 0xE6, 0x3E, 0x21, 0xEF, 0xE9, 0xF1, 0x56, 0x4A, 0xFF, 0x1D, 0xB6, 0x78,
+    0x44, 0xA3, 0x4A, 0xDD, 0x63, 0x4D, 0x46, 0x74, 0x09, 0xD4, 0xC3, 0x46, 0xB8, 0x0D, 0x18, 0xA2,
+    0xA6, 0x95, 0x23, 0xD8, 0xA5, 0x4B, 0xF4, 0x40, 0xC5, 0x09, 0x93, 0xED, 0x8F, 0x88, 0xD4, 0x6F,
+    0xA4, 0x79, 0x65, 0xA3, 0xE0, 0x3A, 0x3D, 0x35, 0x1B, 0x84, 0x40, 0xE1, 0x6A, 0x32, 0x9D, 0xA2,
+    0xEC, 0x01, 0xFD, 0xF7, 0x18, 0xE1, 0x70, 0x4B, 0x06, 0x6B, 0xB9, 0x4C, 0x6E, 0xDA, 0x60, 0xC5,
+    0xCC, 0x76, 0x34, 0x16, 0x9E, 0x94, 0x51, 0xF7, 0x1B, 0x10, 0x2A, 0x20, 0xAB, 0x67, 0x40, 0xD4,
+    0xE7, 0x53, 0xD6, 0xA9, 0x55, 0xD6, 0x99, 0xF0, 0xD2, 0x97, 0x01, 0x8A, 0x8A, 0x1D, 0x62, 0x0D,
+    0x11, 0x6A, 0x13, 0xF5, 0xD8, 0xC0, 0xDF, 0x02, 0x02, 0xFE, 0x75, 0xEB, 0x00, 0xB9, 0x3C, 0x14,
+    0xC2, 0x8B, 0xBD, 0xDF, 0xFB, 0xE0, 0x50, 0x5F, 0x60, 0x4E, 0x9A, 0xD5, 0xD8, 0xA2, 0x65, 0x51,
+    0x49, 0x53, 0x94, 0xBA, 0x44, 0x53, 0x2D, 0x37, 0xF6, 0x3D, 0x7B, 0xA5, 0xFD, 0x9C, 0xBD, 0x8B,
+    0xBD, 0xA7, 0xFD, 0x86, 0xF1, 0xFB, 0x54, 0x38, 0x55, 0x0B, 0x7D, 0x61, 0xCF, 0x28, 0x8A, 0x53,
+    0xEE, 0x77, 0xB1, 0x2E, 0x4B, 0x99, 0x24, 0xB9, 0x19, 0xA4, 0x6D, 0x56, 0x07, 0xD0, 0xBD, 0x6D,
+    0xC4, 0xC9, 0x58, 0xE3, 0x64, 0x18, 0x6D, 0x6D, 0x26, 0xC3, 0xE0, 0x57, 0xDE, 0x88, 0xBB, 0xD5,
+    0xBD, 0x8C, 0x19, 0x08, 0x5E, 0x03, 0x53, 0x45, 0xB4, 0x53, 0xD7, 0x1C, 0x5C, 0xD4, 0x71, 0x33,
+    0x36, 0xDC, 0x7A, 0x8D, 0x8A, 0x05, 0x24, 0xEC, 0x8A, 0x32, 0xCE, 0x0B, 0xB1, 0x40, 0xA5, 0xD7,
+    0x77, 0x06, 0xA9, 0x77, 0xDC, 0xDD, 0x5C, 0x31, 0xCF, 0xC8, 0x1C, 0x43, 0x77, 0x48, 0x37, 0x48,
+    0x57, 0x49, 0xEF, 0x11, 0xB8, 0x2C, 0xFF, 0xB7, 0x74, 0x2D, 0x7C, 0x24, 0x02, 0x04, 0x73, 0x3B,
+    0x40, 0x68, 0xDC, 0x80, 0x6A, 0x50, 0x11, 0x9E, 0x22, 0x6D, 0x94, 0x1E, 0x80, 0x1C, 0x13, 0x4D,
+    0xFC, 0xF8, 0xFC, 0x77, 0xA6, 0x73, 0x8B, 0x6F, 0x3F, 0xF5, 0x2D, 0x63, 0x9C, 0xE3, 0x32, 0x09,
+    0xC6, 0xDA, 0xD5, 0xFA, 0x2D, 0x62, 0xDB, 0xF7, 0x0A, 0xFD, 0x9F, 0xF5, 0x90, 0x72, 0x8D, 0x15,
+    0xE1, 0x0F, 0x85, 0x61, 0x7D, 0x87, 0x9F, 0xB8, 0xDA, 0xCA, 0x64, 0x4E, 0xAC, 0xD6, 0x57, 0x8C,
+    0xE4, 0x84, 0x22, 0xF8, 0xAD, 0xE9, 0x7C, 0x3D, 0x76, 0x9E, 0xD6, 0x84, 0x79, 0x62, 0x25, 0x63,
+    0x96, 0xCF, 0x4C, 0xDF, 0x51, 0x56, 0x8E, 0x4F, 0xFC, 0x7D, 0x4F, 0xDC, 0x34, 0xE3, 0xD6, 0x12,
+    0x2A, 0xEB, 0xF7, 0x24, 0x37, 0xDD, 0x4E, 0x00, 0xD6, 0xDA, 0x26, 0x7D, 0x82, 0x54, 0x2D, 0x51,
+    0x3A, 0x9D, 0x02, 0xA2, 0x99, 0xA0, 0xC7, 0x27, 0x02, 0x58, 0x39, 0x42, 0x21, 0xC1, 0x03, 0xA8,
+    0xE9, 0x3D, 0xD4, 0xBC, 0x6E, 0xAE, 0xC1, 0xF5, 0x5B, 0xFC, 0x2C, 0x9D, 0x57, 0x02, 0x6C, 0x70,
+    0x43, 0x99, 0x6E, 0x34, 0x14, 0x86, 0x45, 0x4D, 0xA9, 0x4F, 0x25, 0x71, 0x9D, 0x06, 0x5E, 0x9C,
+    0x8A, 0xDA, 0x03, 0x0D, 0xE4, 0x8F, 0xD1, 0x2A, 0x6C, 0x04, 0x75, 0x1B, 0xBD, 0x73, 0x95, 0xC6,
+    0xBE, 0x87, 0x2B, 0x5D, 0xF3, 0x39, 0x58, 0x7F, 0x87, 0xF5, 0x2E, 0x4C, 0x3F, 0xC1, 0xDF, 0xE8,
+    0x12, 0x1C, 0x58, 0x56, 0x36, 0x5F, 0xCB, 0xCA, 0x50, 0xEC, 0x82, 0x55, 0x5F, 0xC6, 0x35, 0x55,
+    0xDC, 0x9C, 0xA9, 0x69, 0x16, 0x00, 0x5B, 0x2C, 0x1E, 0x34, 0xFC, 0x83, 0xA2, 0x84, 0x8A, 0x54,
+    0x44, 0x63, 0x86, 0x2D, 0x79, 0xC4, 0xE8, 0x07, 0x67, 0x01, 0xC7, 0xE7, 0xC6, 0x6F, 0x97, 0x68,
+    0x4A, 0x32, 0x43, 0x72, 0x5C, 0x42, 0x92, 0x7E, 0x0D, 0x9F, 0xB8, 0x48, 0xC7, 0x97, 0x82, 0x9C,
+    0xCD, 0xA1, 0x10, 0xAF, 0x14, 0xB0, 0xA5, 0xE9, 0x72, 0x5E, 0xF2, 0xB3, 0x77, 0xB2, 0x63, 0x53,
+    0x0C, 0xD3, 0xC7, 0x62, 0x00, 0x6B, 0xB6, 0x1E, 0xFD, 0x6C, 0xA2, 0x09, 0xEC, 0x60, 0xCC, 0x78,
+    0xE4, 0x2A, 0x74, 0x1F, 0x43, 0xC6, 0x58, 0xD0, 0xA9, 0xA4, 0x31, 0xC8, 0x15, 0xAD, 0x5E, 0x68,
+    0xE3, 0x85, 0xD7, 0xC7, 0xD6, 0x5D, 0x6C, 0x6B, 0x73, 0xBF, 0x04, 0xD3, 0x21, 0x9D, 0xE6, 0xFD,
+    0x93, 0x92, 0x86, 0x74, 0x1A, 0x35, 0xD2, 0x71, 0x41, 0x13, 0xFE, 0xB0, 0xD5, 0x92, 0x2D, 0x0A,
+    0xCB, 0xD1, 0xB0, 0x4E, 0x94, 0x23, 0x3C, 0x93, 0x0A, 0xD8, 0x01, 0xCD, 0x6A, 0x38, 0x33, 0x75,
+    0x2E, 0x14, 0xCE, 0x00, 0x50, 0xB5, 0x87, 0x3A, 0x7C, 0x57, 0xC4, 0x38, 0x68, 0x3C, 0x14, 0x0D,
+    0x4D, 0xB5, 0x06, 0x5A, 0x05, 0xD6, 0x55, 0xD8, 0xF3, 0xF5, 0x06, 0xD4, 0xDE, 0xAD, 0x9C, 0x7D,
+    0xCA, 0x78, 0xF3, 0xE2, 0xA9, 0x20, 0xDF, 0x34, 0xA9, 0x05, 0xF9, 0xA6, 0x4E, 0x71, 0x49, 0xE0,
+    0xAD, 0x7C, 0x55, 0x55, 0x94, 0x71, 0x99, 0x88, 0x85, 0x08, 0x75, 0x69, 0x1E, 0x87, 0xB5, 0xAE,
+    0xE2, 0x5D, 0xF0, 0x54, 0x22, 0x5A, 0x4E, 0x1E, 0x39, 0xDA, 0xAC, 0x2A, 0xDE, 0x80, 0x2A, 0xFF,
+    0x69, 0x17, 0x0E, 0xA2, 0xC1, 0x8C, 0xF5, 0x22, 0x00, 0x7A, 0x65, 0x47, 0x40, 0x45, 0x0F, 0x4B,
+    0x40, 0xBA, 0x53, 0x87, 0x82, 0x69, 0xE2, 0x0A, 0x70, 0x5C, 0x24, 0xF8, 0x91, 0x5D, 0xB5, 0x2D,
+    0xF7, 0xFA, 0xCB, 0x26, 0x6A, 0x8B, 0x2A, 0xE8, 0x45, 0xA3, 0xE1, 0x31, 0x95, 0xC7, 0xA0, 0x73,
+    0x6F, 0x28, 0xE4, 0x21, 0x38, 0x7C, 0x9A, 0xF0, 0xE1, 0xF7, 0x51, 0x1D, 0xB6, 0xFE, 0x54, 0x94,
+    0x99, 0xF4, 0x52, 0x39, 0xA9, 0x7A, 0x7C, 0x32, 0x49, 0xB1, 0x8B, 0x3B, 0x91, 0xC7, 0x3E, 0x44,
+    0xB9, 0xB3, 0x4C, 0x28, 0xE1, 0x89, 0xDD, 0xE5, 0x12, 0xFB, 0x9A, 0xCC, 0xA1, 0x90, 0xA2, 0xB4,
+    0xCF, 0x84, 0x85, 0xD6, 0x61, 0xCE, 0x52, 0x22, 0xC8, 0xFD, 0xCE, 0xC9, 0x93, 0xC6, 0x9F, 0x0A,
+    0xE6, 0x9E, 0x2A, 0x3C, 0x5E, 0x90, 0xC7, 0x8F, 0x20, 0xF3, 0xAF, 0xF7, 0x80, 0x1E, 0xC8, 0x84,
+    0xA3, 0xEE, 0x9A, 0x4C, 0x26, 0x9B, 0x01, 0xFD, 0xA3, 0x3B, 0xD0, 0x10, 0x67, 0xA0, 0xB5, 0xE6,
+    0xE4, 0xC2, 0x8C, 0x34, 0x23, 0x71, 0x40, 0x5C, 0x98, 0xE3, 0x02, 0xC2, 0x44, 0x2A, 0x80, 0xC0,
+    0xD4, 0xA9, 0xE9, 0x0A, 0x16, 0x1D, 0x1D, 0xD4, 0x70, 0x9D, 0xD6, 0x30, 0xA2, 0x6A, 0x28, 0x74,
+    0x43, 0x0C, 0x43, 0xAF, 0x5F, 0xC2, 0x02, 0xAB, 0xA8, 0x4E, 0xCA, 0x44, 0x96, 0x52, 0xF6, 0x52,
+    0x53, 0x94, 0x61, 0xAB, 0xCB, 0xA8, 0x83, 0xF2, 0xD4, 0xEF, 0x4F, 0xCE, 0x83, 0x9D, 0x80, 0x84,
+    0xB2, 0x92, 0xC0, 0xEF, 0x5C, 0xD4, 0xB9, 0x62, 0xD8, 0x09, 0x48, 0x2D, 0xE4, 0xDE, 0x98, 0xC1,
+    0xE7, 0xEF, 0x9F, 0xFC, 0xA7, 0x49, 0x9E, 0x89, 0x3D, 0xF1, 0xA7, 0x82, 0x57, 0xDA, 0x60, 0xEA,
+    0xCA, 0xF7, 0x75, 0x7E, 0x0F, 0xC7, 0xC0, 0x59, 0xBF, 0x87, 0x14, 0x8D, 0xFC, 0x1E, 0xEE, 0xC4,
+    0xF0, 0xD5, 0xFE, 0x49, 0x60, 0x06, 0x72, 0x3D, 0xB5, 0x07, 0xEE, 0xFD, 0x6A, 0x4F, 0xC7, 0xD6,
+    0xB3, 0x7D, 0x02, 0x36, 0x94, 0x25, 0x6A, 0xB1, 0x16, 0xBD, 0xA8, 0x8F, 0xB0, 0x0F, 0x7A, 0x98,
+    0xF9, 0x82, 0x19, 0x1E, 0xD2, 0x60, 0x11, 0xE1, 0x90, 0x66, 0xE4, 0xAA, 0xA4, 0x2C, 0xC4, 0x2C,
+    0x4F, 0xAA, 0x88, 0x1C, 0x85, 0xDE, 0xC9, 0x4D, 0x33, 0x19, 0x65, 0x06, 0x5C, 0x62, 0x7A, 0xBB,
+    0x22, 0xCC, 0x9A, 0xE0, 0x21, 0xD7, 0xC5, 0xEF, 0xEA, 0x59, 0xB4, 0xE3, 0xF1, 0xC9, 0xD3, 0x93,
+    0xE7, 0x32, 0xFD, 0xAA, 0x9E, 0xFA, 0x80, 0xC1, 0xE3, 0x6A, 0x82, 0xB8, 0xF8, 0x35, 0x00, 0x89,
+    0xF1, 0xEB, 0xB6, 0x10, 0x41, 0x04, 0x80, 0xB7, 0x42, 0x86, 0xF9, 0x75, 0x42, 0xD6, 0xF5, 0xD3,
+    0x80, 0xB7, 0xAF, 0x8E, 0xE1, 0xA0, 0x93, 0x0A, 0xBE, 0x71, 0xB8, 0xC4, 0xB3, 0xFF, 0xD2, 0x63,
+    0x98, 0x98, 0xE4, 0x47, 0xAC, 0xE8, 0x38, 0xE8, 0xAF, 0x7C, 0x7C, 0xF2, 0x1F, 0x27, 0x9B, 0x99,
+    0x7E, 0x4D, 0x57, 0xFE, 0xE0, 0x4C, 0xC1, 0x9A, 0xB2, 0x05, 0xA7, 0x82, 0x73, 0xBD, 0xA9, 0xC0,
+    0x5C, 0x61, 0x76, 0x7A, 0x5B, 0x18, 0x74, 0xC3, 0x6B, 0x30, 0x8A, 0xA6, 0x31, 0x8C, 0x20, 0xA0,
+    0x75, 0xF4, 0x41, 0x78, 0x1B, 0x8C, 0x9B, 0xEB, 0x3A, 0xC3, 0x2E, 0x3E, 0x0C, 0xC6, 0xF3, 0xC9,
+    0x78, 0x67, 0xE5, 0x5D, 0xB5, 0x0A, 0xAE, 0x9C, 0x93, 0x8D, 0x19, 0x39, 0x03, 0xB2, 0x0D, 0x42,
+    0xC9, 0x07, 0x0E, 0x7F, 0x14, 0x44, 0x40, 0xD3, 0x14, 0xF2, 0x40, 0x6F, 0x66, 0x82, 0x07, 0xEA,
+    0x43, 0x66, 0xD0, 0xA9, 0xBA, 0x7F, 0x22, 0x8C, 0x8D, 0x00, 0x5E, 0xEA, 0x8B, 0xB4, 0x66, 0x00,
+    0xB0, 0x86, 0x07, 0xD4, 0xBB, 0xDC, 0xC8, 0x7F, 0xE5, 0xBD, 0xDE, 0xF9, 0x3F, 0x6D, 0xE0, 0x07,
+    0x0D, 0x45, 0xEE, 0x7A, 0xAF, 0x4C, 0xBF, 0xC2, 0x46, 0x1F, 0x43, 0xF3, 0x92, 0xDE, 0x40, 0x53,
+    0x0A, 0x66, 0x45, 0x93, 0x35, 0x6C, 0x92, 0x9A, 0x4D, 0x0C, 0xD9, 0xB3, 0xDE, 0x85, 0x4F, 0x09,
+    0x23, 0x66, 0x7D, 0xF8, 0x90, 0xF0, 0x04, 0x26, 0x85, 0x93, 0xDC, 0xCF, 0x26, 0x39, 0xDF, 0x4B,
+    0x8C, 0xEB, 0x50, 0xEB, 0xFC, 0xAA, 0xEF, 0x62, 0x08, 0x98, 0xE4, 0xF7, 0x78, 0x17, 0xB5, 0xBE,
+    0xCB, 0x59, 0x0C, 0xE5, 0x8B, 0x45, 0x7E, 0x75, 0x99, 0x48, 0x10, 0xAC, 0x04, 0x24, 0xCB, 0xE2,
+    0x03, 0xAF, 0xE1, 0xBD, 0xA4, 0x0C, 0xFA, 0xB8, 0x0E, 0x9B, 0x40, 0x24, 0xDB, 0x6C, 0x7F, 0xC8,
+    0xC4, 0x3E, 0x47, 0x23, 0xC8, 0xB7, 0x92, 0x43, 0xE0, 0xF7, 0xCD, 0x92, 0x7C, 0x5D, 0x3F, 0xAB,
+    0x2F, 0x61, 0xB9, 0xFB, 0xC7, 0xCF, 0xC7, 0x97, 0x54, 0xB1, 0x2B, 0x02, 0x27, 0xD0, 0xFF, 0x8F,
+    0x5E, 0x50, 0x72, 0x49, 0x52, 0xD1, 0xBE, 0x05, 0x81, 0x40, 0x20, 0x89, 0xED, 0x33, 0xBE, 0xC1,
+    0x4B, 0x44, 0xA7, 0x82, 0xAF, 0x28, 0x1D, 0x45, 0x94, 0xF5, 0x99, 0x08, 0xB5, 0xDE, 0xB1, 0xD8,
+    0x78, 0x4E, 0x88, 0x4D, 0x09, 0x4D, 0x0B, 0xDA, 0x00, 0x32, 0x0D, 0xC2, 0x1A, 0x39, 0x26, 0x41,
+    0x36, 0x5C, 0x25, 0x62, 0x42, 0x36, 0xDF, 0x0A, 0xB5, 0xE8, 0xD2, 0xA3, 0x34, 0xA2, 0x42, 0x98,
+    0xAD, 0x8C, 0x5B, 0x1F, 0x5E, 0xB9, 0xDC, 0x21, 0x16, 0xE6, 0x34, 0x3C, 0x2F, 0xB3, 0x30, 0x9C,
+    0x8D, 0xDA, 0xE3, 0x4F, 0x84, 0xED, 0x57, 0x5E, 0x08, 0xDB, 0xF0, 0x07, 0x61, 0xBB, 0x62, 0x5C,
+    0xA7, 0xD7, 0x7E, 0xC8, 0x34, 0xC2, 0xDB, 0x90, 0x4F, 0x26, 0x4F, 0x4D, 0x36, 0xB5, 0x7E, 0x59,
+    0xD7, 0x91, 0x8C, 0x49, 0x31, 0xE4, 0x26, 0x03, 0xA3, 0x15, 0xB9, 0x0D, 0x35, 0x0E, 0x6D, 0xF4,
+    0x14, 0x14, 0xD3, 0xCB, 0x50, 0x30, 0x6F, 0x4A, 0x37, 0xE2, 0x4F, 0xE8, 0xDB, 0x23, 0xEA, 0x1A,
+    0x43, 0x51, 0x1C, 0x9E, 0x43, 0x40, 0x46, 0x03, 0x8E, 0x46, 0x1F, 0xF6, 0x69, 0x04, 0x0F, 0x1A,
+    0x06, 0x61, 0xAE, 0xED, 0x17, 0x83, 0xCA, 0x10, 0x5D, 0x84, 0x0D, 0x87, 0x8D, 0x2D, 0x94, 0x5D,
+    0x9D, 0x1E, 0x11, 0x48, 0xCC, 0x20, 0x63, 0xA3, 0xC2, 0x2E, 0x7B, 0x75, 0xAA, 0xE2, 0x3A, 0x2B,
+    0xA1, 0xA9, 0x33, 0x99, 0x2D, 0xC1, 0x4D, 0x22, 0x62, 0x75, 0x9E, 0x51, 0xD9, 0x09, 0xAD, 0x17,
+    0x29, 0xDF, 0x95, 0x79, 0xC5, 0xBF, 0x04, 0x9F, 0x4A, 0xC3, 0x36, 0x7B, 0x19, 0xD6, 0x5D, 0x71,
+    0xD9, 0x18, 0x77, 0xF9, 0x2C, 0x86, 0xB0, 0xFF, 0xDB, 0x0B, 0xD3, 0xB7, 0x8E, 0xFD, 0x94, 0xE9,
+    0xBE, 0x7F, 0xF2, 0xDF, 0x27, 0xE7, 0x12, 0xFD, 0x91, 0xA8, 0x21, 0xB9, 0x3D, 0xF4, 0xF3, 0x0E,
+    0xC0, 0x1F, 0xBC, 0x59, 0x1F, 0x55, 0xD6, 0xE7, 0x49, 0xBB, 0xCD, 0xC3, 0xE4, 0x30, 0x88, 0x76,
+    0x1C, 0xDA, 0x7C, 0x27, 0xA4, 0x3A, 0x11, 0xDB, 0xA7, 0x81, 0x6C, 0xD8, 0x3D, 0xA2, 0x2F, 0x15,
+    0x82, 0x31, 0x3B, 0xBB, 0xAD, 0x5E, 0xC3, 0xB6, 0x72, 0x6E, 0x95, 0x85, 0xA1, 0x24, 0x75, 0x6F,
+    0x43, 0x87, 0x76, 0x09, 0x76, 0x66, 0xE6, 0x17, 0xC9, 0xB7, 0xAC, 0xA4, 0xFC, 0x67, 0x93, 0xF3,
+    0x85, 0x28, 0x93, 0x16, 0x61, 0x80, 0x1C, 0x38, 0x58, 0xED, 0x21, 0x3E, 0x15, 0xB1, 0xFE, 0x6F,
+    0x5A, 0x19, 0x04, 0x75, 0xDF, 0x4F, 0xF6, 0x62, 0x4C, 0x2E, 0x7A, 0x0D, 0x21, 0xDC, 0x3E, 0x2E,
+    0xEA, 0xE9, 0x7F, 0xA0, 0xFF, 0xAF, 0xEB, 0x5F, 0x61, 0x04, 0x02, 0x7E, 0x20, 0x1A, 0x80, 0xD5,
+    0xF2, 0x03, 0x69, 0xCA, 0x75, 0x1A, 0x12, 0xEF, 0x65, 0x6C, 0xFA, 0x2F, 0xFC, 0xFB, 0x72, 0xF3,
+    0x7D, 0xBD, 0xF9, 0x3E, 0xA3, 0x7C, 0x1C, 0xAB, 0x83, 0xD6, 0x96, 0x9A, 0x63, 0xA6, 0xF9, 0xBA,
+    0x69, 0x0E, 0x8D, 0x60, 0x27, 0x55, 0x67, 0x11, 0xB8, 0x7A, 0x02, 0x59, 0x2D, 0x2F, 0x80, 0xFC,
+    0x80, 0xF9, 0x2D, 0xD1, 0x95, 0xF3, 0x54, 0xCE, 0xA5, 0x8A, 0x10, 0xE0, 0x8E, 0x1A, 0x3A, 0xE2,
+    0xC2, 0x4E, 0x48, 0xD0, 0x99, 0x67, 0xC0, 0x7E, 0x62, 0xD3, 0x6B, 0x91, 0x24, 0x22, 0x80, 0x1E,
+    0x9F, 0x6C, 0xAA, 0x89, 0xA8, 0x7E, 0xF8, 0x81, 0x45, 0xF5, 0x23, 0x2F, 0xA5, 0x27, 0x9A, 0x41,
+    0xF2, 0xC6, 0x72, 0xA3, 0x9F, 0x4F, 0xD9, 0xC8, 0xA2, 0xE2, 0xC5, 0x23, 0x53, 0x36, 0xAE, 0x0E,
+    0x0D, 0xAA, 0x5A, 0x6C, 0xEC, 0x8B, 0xFE, 0x10, 0x02, 0x6C, 0xEB, 0x6E, 0x7D, 0x90, 0x6F, 0xD0,
+    0xB2, 0xF7, 0x4B, 0x7C, 0x1F, 0x93, 0x1A, 0x60, 0x9C, 0x5B, 0x3B, 0x7A, 0x81, 0xC8, 0x77, 0xF0,
+    0x1B, 0x78, 0x7F, 0xDE, 0x68, 0x09, 0xCA, 0xF1, 0x57, 0xF9, 0xE0, 0xBA, 0x4D, 0x61, 0x11, 0x2B,
+    0x44, 0x70, 0x60, 0xA8, 0x11, 0x23, 0x28, 0x72, 0x03, 0x25, 0xE2, 0x5A, 0x31, 0xE4, 0x2F, 0xF3,
+    0x71, 0xBF, 0xA0, 0xDF, 0x4C, 0x9B, 0xE7, 0xF2, 0xDA, 0xEF, 0x12, 0x4A, 0x88, 0xFC, 0x13, 0x43,
+    0x31, 0xFE, 0x3B, 0x6D, 0x1C, 0x97, 0xF7, 0x82, 0x5B, 0xF3, 0x23, 0x03, 0x7A, 0x55, 0xCA, 0xAC,
+    0x48, 0xBF, 0xBC, 0x3E, 0x40, 0x07, 0x82, 0x0E, 0x80, 0x6C, 0x1A, 0x36, 0x2E, 0x34, 0x6D, 0xC4,
+    0x88, 0xCA, 0x14, 0x40, 0x1F, 0x3D, 0x5C, 0x6C, 0xEC, 0x8B, 0xE3, 0x25, 0xF6, 0x03, 0x21, 0x74,
+    0xAB, 0x68, 0xE8, 0xDE, 0xC7, 0x1C, 0x3C, 0xA5, 0xD7, 0xD1, 0x17, 0xD1, 0xAD, 0x46, 0x22, 0x01,
+    0x17, 0xDF, 0x27, 0x13, 0x0F, 0x59, 0x53, 0x06, 0x53, 0x78, 0x38, 0x5B, 0x21, 0x51, 0x33, 0x12,
+    0xFE, 0xCA, 0x37, 0x5C, 0x6E, 0x37, 0x7D, 0x19, 0x61, 0x1F, 0xA6, 0xD7, 0x08, 0x11, 0x4C, 0x06,
+    0x9F, 0xA8, 0x90, 0xA2, 0x01, 0x00, 0x48, 0x0B, 0x5D, 0x39, 0x8F, 0x58, 0x01, 0xA9, 0x19, 0xF6,
+    0x95, 0x19, 0xAE, 0xED, 0x17, 0x1D, 0x0C, 0x4A, 0xF4, 0xEA, 0x93, 0x22, 0x55, 0x0A, 0x79, 0x64,
+    0xCA, 0xAD, 0x8E, 0xCD, 0x05, 0xEB, 0x01, 0xDC, 0xDB, 0x98, 0xEF, 0x60, 0x81, 0x68, 0xC6, 0x0C,
+    0x0F, 0xE8, 0x09, 0xAD, 0xF3, 0x65, 0x2E, 0x41, 0xE2, 0xD1, 0x54, 0x43, 0xAC, 0xBE, 0xC5, 0x0C,
+    0x0B, 0xE8, 0x6E, 0x43, 0x8A, 0x7C, 0x11, 0x91, 0x5D, 0x85, 0x00, 0x87, 0x09, 0xB6, 0x11, 0x41,
+    0x0D, 0x6C, 0x06, 0xA1, 0x9B, 0xCF, 0x0C, 0xCC, 0xD1, 0xDC, 0x25, 0x57, 0x26, 0xD0, 0x2B, 0xF7,
+    0xA7, 0x36, 0x2F, 0x01, 0x7E, 0xED, 0xA9, 0xC9, 0x48, 0x80, 0x5F, 0xE1, 0xD0, 0x08, 0x06, 0x3F,
+    0x9F, 0x95, 0xB0, 0x5F, 0x21, 0x87, 0x39, 0x3A, 0x45, 0x25, 0xFC, 0xFE, 0x26, 0xDD, 0x7E, 0xBA,
+    0xBC, 0xBE, 0x42, 0x56, 0x85, 0x9D, 0x79, 0x41, 0xD1, 0x71, 0x1E, 0x09, 0x9E, 0xFE, 0x5D, 0xF6,
+    0x3D, 0x66, 0x06, 0x11, 0x39, 0x07, 0xBF, 0x20, 0xB8, 0x52, 0x1E, 0x15, 0x96, 0x38, 0x89, 0x2B,
+    0x55, 0x9C, 0xC7, 0xEF, 0xCA, 0x2A, 0x42, 0xD7, 0xAC, 0x90, 0x41, 0x84, 0xCD, 0x05, 0x2D, 0xC8,
+    0x7F, 0xE7, 0xFC, 0x88, 0x74, 0x9F, 0xC3, 0x62, 0xF8, 0x53, 0x7A, 0xC7, 0xAE, 0xFB, 0x7F, 0x5D,
+    0xB0, 0xA2, 0x6E, 0x0E, 0x39, 0x69, 0xF2, 0xBD, 0x2A, 0xFB, 0x69, 0x9D, 0x7D, 0xAF, 0xBE, 0xEF,
+    0x70, 0x7E, 0x6B, 0x37, 0x81, 0x27, 0x9F, 0x31, 0x06, 0x88, 0xFE, 0x7F, 0x6B, 0x7B, 0x72, 0xDF,
+    0x44, 0xC4, 0x19, 0x5F, 0xB9, 0x99, 0xFF, 0x0E, 0xBD, 0x87, 0xF2, 0xD5, 0x19, 0xFC, 0x0A, 0x8A,
+    0xC0, 0x98, 0x11, 0xCB, 0x0A, 0xF6, 0x0C, 0x18, 0x69, 0xD5, 0xEF, 0xF7, 0xD0, 0x0D, 0x7F, 0x78,
+    0x1E, 0x14, 0xBA, 0xFF, 0x8C, 0x98, 0x30, 0xBD, 0xDA, 0x16, 0x03, 0x68, 0x50, 0xAD, 0xDF, 0xBB,
+    0x83, 0x43, 0x87, 0xED, 0xA3, 0x0D, 0x5E, 0xD1, 0x35, 0x76, 0x1F, 0x30, 0xA6, 0x6E, 0x33, 0x38,
+    0x91, 0xF2, 0x43, 0x96, 0x23, 0x44, 0xC5, 0x82, 0x63, 0x5F, 0xC3, 0x7E, 0xA5, 0x9A, 0xE5, 0x92,
+    0x83, 0xB7, 0xF6, 0x34, 0xC3, 0x69, 0xFD, 0x13, 0x13, 0x4A, 0x85, 0x49, 0x3A, 0x4C, 0xF4, 0xCF,
+    0x8C, 0x51, 0x9A, 0x1A, 0x8B, 0x34, 0xCD, 0xAE, 0xD6, 0x18, 0x04, 0x29, 0x4B, 0x8A, 0x6F, 0x40,
+    0x8A, 0xD1, 0x6C, 0xCF, 0x1C, 0x99, 0xED, 0x8F, 0x1F, 0x5E, 0x7D, 0xCF, 0xB4, 0xF3, 0x3D, 0x03,
+    0xD4, 0x80, 0xD4, 0x20, 0x8B, 0x63, 0x3F, 0x0B, 0x91, 0xE5, 0x01, 0x70, 0x6D, 0xC0, 0x31, 0x10,
+    0x32, 0xCC, 0xE0, 0xA1, 0xF9, 0xAE, 0x32, 0x6C, 0x92, 0x4E, 0xCD, 0xE5, 0x8C, 0x3A, 0x68, 0xA3,
+    0xC6, 0x64, 0xAB, 0xD0, 0x49, 0x1F, 0x12, 0xE9, 0x11, 0x75, 0x9C, 0x55, 0x0B, 0x6E, 0x9D, 0x2F,
+    0xC6, 0x14, 0x3C, 0x8B, 0x58, 0xE6, 0x8B, 0x30, 0x84, 0x8B, 0x87, 0xBB, 0xBD, 0xA6, 0xE0, 0x9D,
+    0x82, 0xB2, 0x07, 0x02, 0xE3, 0x08, 0x3E, 0x2E, 0x19, 0x18, 0x47, 0xF8, 0xA8, 0xA6, 0x33, 0x24,
+    0x77, 0x06, 0x04, 0xC9, 0x5F, 0xEA, 0xEE, 0xB9, 0x80, 0x17, 0x75, 0x98, 0xD4, 0xB2, 0x98, 0x19,
+    0x2D, 0x13, 0xE1, 0x1F, 0x8D, 0xAC, 0x99, 0x42, 0xC4, 0x2F, 0x10, 0x41, 0x22, 0xF2, 0x28, 0x97,
+    0xD5, 0x43, 0xEC, 0xA8, 0x0C, 0xD8, 0x16, 0x15, 0x32, 0xC2, 0x52, 0xD8, 0x2C, 0x9A, 0x2D, 0x34,
+    0x63, 0xAC, 0x98, 0x23, 0x92, 0x26, 0x30, 0x0A, 0x64, 0x05, 0xD6, 0xC0, 0x48, 0xB2, 0x36, 0x1B,
+    0x70, 0x8E, 0x86, 0x45, 0x29, 0x93, 0xEC, 0xF7, 0xC7, 0x93, 0x37, 0x90, 0x4F, 0x36, 0x5D, 0x4D,
+    0x7E, 0x89, 0xF4, 0xB2, 0x61, 0x27, 0xFE, 0x55, 0x09, 0x44, 0x8E, 0x88, 0x07, 0xD3, 0x6E, 0x42,
+    0x6D, 0xA2, 0x3B, 0x26, 0x3A, 0xA2, 0x4B, 0xF2, 0xA2, 0xF4, 0x25, 0x80, 0x8B, 0xAB, 0x76, 0x9F,
+    0x53, 0x91, 0x2A, 0x3A, 0x61, 0x92, 0x24, 0x7F, 0x74, 0xEA, 0x0C, 0x22, 0xF4, 0xE8, 0x14, 0x64,
+    0x6A, 0x45, 0x81, 0xFC, 0x1E, 0xD9, 0x4E, 0xB9, 0x88, 0x71, 0x20, 0x79, 0xE1, 0x47, 0xD1, 0x57,
+    0x65, 0x08, 0xF6, 0x8A, 0xEB, 0xE3, 0x0A, 0x60, 0xBF, 0x59, 0x05, 0x9F, 0xE9, 0x46, 0xE6, 0x21,
+    0xFC, 0xF5, 0x5B, 0x2D, 0x6E, 0xFA, 0xE9, 0x33, 0x43, 0x05, 0x27, 0x9A, 0x07, 0x51, 0xEC, 0xF5,
+    0x26, 0xF9, 0xA0, 0xC3, 0xAA, 0x91, 0x87, 0xC7, 0x40, 0x7D, 0xC4, 0x8E, 0xC0, 0xE4, 0xC1, 0x06,
+    0x1C, 0x18, 0xA2, 0x13, 0xBA, 0x1D, 0x22, 0x28, 0x73, 0x41, 0x4C, 0xA5, 0xF1, 0x5D, 0x15, 0x5E,
+    0xF9, 0x09, 0x61, 0x3E, 0x38, 0x2A, 0xEC, 0xE2, 0x1E, 0xAF, 0x13, 0x79, 0x21, 0xAA, 0x22, 0xD4,
+    0xB5, 0x34, 0x9D, 0xBD, 0x02, 0x1A, 0x01, 0x10, 0x88, 0xBE, 0x04, 0x38, 0x32, 0xD9, 0x8F, 0x1C,
+    0xF8, 0xB2, 0xCE, 0xBC, 0x1A, 0x61, 0xBE, 0xEA, 0x0F, 0x21, 0xDC, 0xAE, 0x7A, 0x89, 0xD6, 0xE7,
+    0x79, 0x43, 0xC2, 0x2B, 0xF2, 0x47, 0x39, 0x23, 0xB9, 0x6F, 0x5C, 0x63, 0x5B, 0xC8, 0x44, 0xD2,
+    0xF5, 0x82, 0x13, 0xB5, 0x25, 0x7A, 0x8A, 0x45, 0x0C, 0xE1, 0xF6, 0xEE, 0x3C, 0x39, 0x91, 0xF1,
+    0x48, 0x69, 0x19, 0x92, 0xA4, 0x17, 0x58, 0xFD, 0xBE, 0x75, 0xAE, 0x52, 0xC5, 0x66, 0xB6, 0xA5,
+    0x02, 0x66, 0x6A, 0xCE, 0x30, 0x26, 0x3D, 0x2A, 0x9B, 0x0A, 0xB0, 0xF8, 0xBE, 0x31, 0x98, 0xF0,
+    0xB9, 0xDA, 0xB4, 0x89, 0x49, 0xBF, 0x62, 0xDA, 0x16, 0x93, 0xA1, 0xE0, 0x34, 0x73, 0x19, 0x8D,
+    0x8A, 0xF2, 0x07, 0xA4, 0x3F, 0xB8, 0x11, 0x9C, 0xBC, 0x36, 0x3C, 0x3C, 0x4F, 0xBB, 0x05, 0xCE,
+    0x73, 0x21, 0x55, 0xAA, 0x58, 0x4F, 0x03, 0xD9, 0xFC, 0x4F, 0x69, 0x84, 0xD4, 0x95, 0xE6, 0x9A,
+    0x0A, 0x50, 0x93, 0x21, 0x9C, 0x22, 0x35, 0x92, 0x39, 0xB5, 0xD4, 0xBC, 0x62, 0x29, 0xD6, 0xC6,
+    0x83, 0x5B, 0xDF, 0xF7, 0xE9, 0x2A, 0x59, 0x87, 0x4B, 0x6B, 0x2A, 0xE8, 0xCB, 0x44, 0xC1, 0x19,
+    0x8D, 0x26, 0x12, 0x37, 0x20, 0x02, 0x69, 0xAB, 0xF2, 0xF3, 0x7F, 0xB8, 0x81, 0x3F, 0xC2, 0x7C,
+    0x23, 0x29, 0x40, 0x6E, 0xF1, 0x06, 0x69, 0xC9, 0x2D, 0x4E, 0xBD, 0x1F, 0x52, 0x39, 0x45, 0x9C,
+    0xE5, 0xB5, 0x0C, 0x00, 0x76, 0x35, 0x03, 0xBB, 0x6C, 0x67, 0x32, 0x42, 0xD5, 0x66, 0x3E, 0xEC,
+    0xBA, 0x0C, 0x01, 0xAB, 0x3A, 0xC3, 0x70, 0xAB, 0x4C, 0x3A, 0x11, 0x94, 0x19, 0xE2, 0x8E, 0xF2,
+    0xAE, 0xC0, 0xAC, 0x2E, 0x0B, 0x90, 0x1A, 0xF4, 0xBC, 0xB2, 0x96, 0xA1, 0x4F, 0xCB, 0x10, 0xF7,
+    0x8E, 0x30, 0xF9, 0xC7, 0x78, 0x4F, 0xDC, 0xB2, 0x20, 0x9E, 0xC4, 0xB5, 0xBF, 0xFA, 0x48, 0xEE,
+    0xF7, 0xEA, 0x87, 0xA2, 0x2A, 0x5F, 0x6D, 0x64, 0x0F, 0x3F, 0x0C, 0xEC, 0x26, 0xF0, 0xAE, 0x2E,
+    0xE4, 0xB5, 0x5D, 0xFD, 0xD6, 0xAF, 0x99, 0x61, 0x60, 0xE2, 0x2A, 0x58, 0x6A, 0x65, 0xD8, 0x1D,
+    0xF3, 0x5F, 0x1B, 0xBC, 0xE4, 0x5E, 0x6E, 0xCC, 0x13, 0xEF, 0xF5, 0xD6, 0x3C, 0xF1, 0x5F, 0xEB,
+    0xCD, 0x93, 0xF0, 0x61, 0xFB, 0x24, 0xF2, 0x06, 0xF3, 0xE4, 0xB8, 0xF9, 0xA8, 0x89, 0x37, 0x8D,
+    0x4F, 0x98, 0xFF, 0xA1, 0x3E, 0xEE, 0x0B, 0xA6, 0x80, 0x38, 0x1F, 0xF6, 0x09, 0xA2, 0xBD, 0xCA,
+    0xFD, 0x45, 0x6F, 0x22, 0x4F, 0xDE, 0x1B, 0x7D, 0xC4, 0x27, 0xFE, 0x4B, 0xBD, 0xEC, 0x75, 0xAC,
+    0xF8, 0x53, 0x00, 0xBF, 0x78, 0xE2, 0xC0, 0x1F, 0x83, 0x9C, 0x34, 0xA7, 0xF7, 0x10, 0x2C, 0x7C,
+    0x47, 0xCB, 0xC5, 0x70, 0x3E, 0x7F, 0x22, 0x4F, 0x62, 0xDD, 0xC8, 0x82, 0x2B, 0xEA, 0xC3, 0x0A,
+    0xBA, 0x38, 0x80, 0x02, 0x2C, 0x89, 0x76, 0x90, 0x6B, 0x20, 0xF8, 0xF9, 0xB1, 0x86, 0x0D, 0x12,
+    0x0B, 0x7A, 0x75, 0x0C, 0xD8, 0xDA, 0x58, 0x63, 0x9E, 0x61, 0x4B, 0x79, 0xF1, 0xA3, 0x5D, 0xB8,
+    0x58, 0x9C, 0x5F, 0x76, 0x22, 0x6B, 0x7B, 0xEF, 0xCD, 0x4E, 0x54, 0x71, 0xEF, 0xBF, 0xD2, 0x25,
+    0x02, 0x01, 0xC2, 0x67, 0xBA, 0xA4, 0x59, 0xEF, 0xD7, 0xDF, 0xEC, 0x8A, 0xA1, 0xE8, 0xB3, 0x8F,
+    0x3A, 0x6A, 0x66, 0xC6, 0x77, 0x6C, 0x03, 0x67, 0x68, 0xC3, 0x4D, 0x8F, 0xD8, 0xB5, 0x2C, 0x20,
+    0x82, 0xD7, 0xD2, 0x5D, 0x5A, 0x76, 0x3A, 0xDF, 0x26, 0x97, 0xBC, 0x41, 0x66, 0x89, 0x3E, 0x29,
+    0x4D, 0x28, 0xF1, 0x12, 0xC3, 0x4C, 0x94, 0x28, 0xC9, 0x3B, 0xD0, 0x8E, 0xA2, 0x41, 0xA6, 0x50,
+    0x7C, 0xFA, 0x69, 0x31, 0x48, 0x10, 0x6F, 0x99, 0xCA, 0x8D, 0xDC, 0xC1, 0x9D, 0x32, 0x76, 0xE9,
+    0x4E, 0x69, 0x4F, 0xBB, 0x10, 0xED, 0x22, 0x32, 0xA0, 0xD1, 0x8A, 0xE6, 0x88, 0xDE, 0x4C, 0x5A,
+    0xF0, 0x65, 0x2D, 0x43, 0x12, 0xE8, 0xF3, 0x3C, 0x73, 0x0E, 0x61, 0xE1, 0xBC, 0x7B, 0x1A, 0x4E,
+    0xCD, 0xC6, 0x81, 0x58, 0xEB, 0xD1, 0x29, 0x77, 0x08, 0xD9, 0x99, 0x8B, 0xF4, 0x7D, 0x20, 0x32,
+    0x53, 0x98, 0xFC, 0xB2, 0xE8, 0x1D, 0x1A, 0x3D, 0x35, 0xE2, 0x29, 0x42, 0xD3, 0xA0, 0x8B, 0x6A,
+    0x81, 0xA8, 0x62, 0x3B, 0x26, 0x55, 0x51, 0x17, 0xBD, 0x40, 0xFB, 0x54, 0xF4, 0x6D, 0x0F, 0xFE,
+    0xD0, 0x04, 0x56, 0xC2, 0x20, 0x8E, 0x79, 0x86, 0x65, 0x46, 0xEC, 0x85, 0x2B, 0x0A, 0x01, 0x10,
+    0x59, 0x8E, 0x68, 0x31, 0x74, 0x32, 0x49, 0x0F, 0xD0, 0x40, 0x06, 0xD2, 0xAE, 0xE5, 0x20, 0xA5,
+    0x9F, 0x2D, 0xED, 0xB3, 0xEC, 0x6D, 0x35, 0x63, 0x94, 0xCD, 0xD9, 0x33, 0xCB, 0x45, 0xC5, 0x6B,
+    0x9D, 0x61, 0x1A, 0xB1, 0x86, 0x3A, 0xC3, 0x2C, 0x62, 0x12, 0x75, 0xB1, 0xE1, 0x96, 0x3E, 0xE8,
+    0x42, 0x1B, 0xB1, 0x94, 0x67, 0x86, 0x5F, 0xDA, 0xA0, 0xF3, 0xC9, 0x30, 0xB1, 0x18, 0xC1, 0x1E,
+    0x33, 0x16, 0x93, 0x3A, 0xE8, 0x1C, 0xC3, 0x32, 0xE5, 0xFA, 0x90, 0x92, 0x67, 0x06, 0x58, 0xC0,
+    0x31, 0x98, 0xE6, 0x7E, 0x99, 0x34, 0x70, 0x0D, 0x13, 0x15, 0x85, 0x6D, 0xE2, 0x8F, 0x4F, 0x3F,
+    0x09, 0x6E, 0x90, 0x05, 0xD8, 0x46, 0xEB, 0x0D, 0x2E, 0x39, 0x47, 0xE9, 0x87, 0xC9, 0x4F, 0x2A,
+    0xB9, 0x6C, 0x65, 0x86, 0xAC, 0x9F, 0xA7, 0x67, 0xDC, 0x53, 0xFC, 0x49, 0x0B, 0xF9, 0xA1, 0x74,
+    0xD0, 0x82, 0x71, 0xDC, 0x21, 0x68, 0x13, 0x69, 0x05, 0x91, 0xB4, 0xB1, 0x70, 0x90, 0xF0, 0x50,
+    0x17, 0x09, 0x0B, 0xC5, 0x6D, 0x36, 0x04, 0xE0, 0xA1, 0x2A, 0xD3, 0xAE, 0xF6, 0xF2, 0x20, 0x77,
+    0x5A, 0x19, 0xD8, 0xC5, 0x8B, 0xA9, 0x09, 0xE8, 0x0C, 0x69, 0x28, 0xA0, 0x33, 0xA9, 0x42, 0x3A,
+    0x2F, 0x93, 0xDC, 0xEF, 0x63, 0xDC, 0x15, 0xB3, 0x48, 0x8D, 0x22, 0x16, 0xEF, 0xCF, 0x06, 0xCC,
+    0x92, 0x30, 0xCD, 0x7A, 0x6B, 0x5C, 0x7F, 0xD8, 0x73, 0xAE, 0x9E, 0x3F, 0x20, 0xEB, 0x05, 0xAA,
+    0xFC, 0x10, 0x19, 0x5D, 0xBB, 0xC4, 0x6E, 0x09, 0x53, 0x22, 0xFC, 0x2E, 0x79, 0xAA, 0x18, 0x44,
+    0xF8, 0x0C, 0xCE, 0x24, 0x85, 0x07, 0xE7, 0xEE, 0x43, 0x62, 0xE1, 0x84, 0x79, 0xA6, 0xBC, 0x5F,
+    0x00, 0x4A, 0x63, 0x35, 0x2F, 0xA9, 0xE8, 0x53, 0xB1, 0xB0, 0x73, 0xA8, 0x6E, 0x31, 0x58, 0x8C,
+    0x89, 0x92, 0xC2, 0x54, 0x42, 0xFA, 0x98, 0xB3, 0x35, 0xB5, 0x56, 0x14, 0x8C, 0xBB, 0xCC, 0x38,
+    0xF2, 0x65, 0xBF, 0x39, 0x5B, 0x32, 0x71, 0xF2, 0x3E, 0xD2, 0x20, 0x7B, 0x06, 0xED, 0xE3, 0xF4,
+    0x45, 0x9F, 0x93, 0x5A, 0x1D, 0x7E, 0xDE, 0x33, 0xBE, 0x2F, 0xD9, 0xA5, 0x7D, 0x32, 0x45, 0xD3,
+    0x25, 0xC2, 0x4D, 0x22, 0xD2, 0x92, 0x9A, 0x42, 0x19, 0xF3, 0x74, 0xE3, 0x66, 0xCA, 0x06, 0x79,
+    0x30, 0x90, 0x51, 0x9A, 0xFF, 0xA4, 0x0B, 0x1A, 0x33, 0x60, 0x22, 0x30, 0x4A, 0xFD, 0x4B, 0xFD,
+    0xFC, 0x42, 0xBE, 0xF6, 0x72, 0x63, 0x42, 0x8C, 0xC2, 0xF9, 0xEF, 0x19, 0xAD, 0x36, 0xAF, 0xC8,
+    0xF1, 0xD3, 0x6B, 0x93, 0xFB, 0xCF, 0xFB, 0x0F, 0x56, 0x59, 0xE7, 0x7F, 0xA7, 0xF1, 0x3B, 0xFF,
+    0xA1, 0xCE, 0xEB, 0xFC, 0x74, 0x07, 0x64, 0xF5, 0xBA, 0xE4, 0x84, 0x48, 0x8E, 0xF4, 0x82, 0x33,
+    0xF5, 0x1F, 0x6C, 0x84, 0x6F, 0x1E, 0xAE, 0x10, 0x3C, 0x49, 0x8D, 0x19, 0xA6, 0x82, 0xF4, 0x06,
+    0x5F, 0xB9, 0x94, 0x6A, 0x45, 0xF7, 0x0F, 0x99, 0x98, 0x42, 0x85, 0xA9, 0xA8, 0x3E, 0x5C, 0xC5,
+    0xCC, 0x8F, 0x6A, 0x6C, 0x02, 0x15, 0x92, 0x6E, 0xDF, 0x39, 0x07, 0xCA, 0xE8, 0x72, 0x36, 0x80,
+    0x99, 0xB3, 0x3A, 0x22, 0x75, 0xFE, 0xC5, 0x78, 0x8D, 0xB9, 0x1E, 0x9F, 0x1D, 0xEC, 0x7D, 0xE8,
+    0x7C, 0x10, 0xC9, 0x40, 0x4F, 0x4A, 0xF1, 0xBE, 0x41, 0xA1, 0xDD, 0x92, 0x26, 0x35, 0x3E, 0x75,
+    0xB1, 0xF1, 0xA3, 0x26, 0x16, 0x21, 0x93, 0x54, 0x5E, 0x0F, 0x23, 0xA5, 0xF8, 0xBF, 0xDE, 0x50,
+    0xE8, 0x0F, 0x86, 0xE2, 0x03, 0x3D, 0x14, 0xE5, 0xBF, 0x41, 0xD4, 0x6E, 0x60, 0xD4, 0x0E, 0xE2,
+    0xB2, 0x01, 0xC8, 0x99, 0x47, 0xED, 0x28, 0x32, 0x4A, 0x24, 0x7A, 0x6A, 0xD4, 0x60, 0xB8, 0xB0,
+    0xA4, 0x45, 0xB7, 0x01, 0x38, 0x8A, 0x60, 0x42, 0xEE, 0x30, 0x54, 0x44, 0x1A, 0x92, 0xB7, 0x22,
+    0x7A, 0x48, 0x8F, 0xD1, 0x5B, 0xBA, 0xCA, 0xEC, 0x25, 0xA4, 0x7D, 0xC4, 0xCD, 0x36, 0xB5, 0x2D,
+    0xAB, 0x3D, 0x00, 0xD5, 0x54, 0x30, 0xAD, 0x09, 0xAD, 0x2B, 0xEA, 0xC0, 0x92, 0x41, 0xE6, 0x7C,
+    0x56, 0x59, 0x60, 0x17, 0x3D, 0x23, 0x7E, 0xCF, 0xDD, 0x1A, 0x23, 0x40, 0x8C, 0x2A, 0xDE, 0x1E,
+    0xF1, 0xFB, 0x36, 0x66, 0x81, 0x99, 0x8D, 0x90, 0xB8, 0x0F, 0x62, 0xFC, 0xCF, 0x80, 0xA1, 0x5F,
+    0x81, 0x01, 0xFE, 0x16, 0xB4, 0xE0, 0x07, 0xF4, 0xB6, 0x2A, 0x4B, 0x68, 0x4A, 0x12, 0x9D, 0x3F,
+    0x42, 0x33, 0x45, 0x47, 0xCC, 0xAD, 0xFA, 0x2E, 0x7B, 0xF4, 0x32, 0x13, 0x70, 0x6A, 0xC2, 0xEA,
+    0x53, 0xF7, 0xCC, 0x53, 0xEE, 0xEF, 0xE4, 0xB8, 0x57, 0xD2, 0x47, 0x90, 0x65, 0x0A, 0x28, 0xD3,
+    0xE1, 0xF7, 0x1E, 0x86, 0x46, 0xE2, 0x57, 0x30, 0xA6, 0xD2, 0xD1, 0xB4, 0x39, 0xE0, 0xA9, 0x59,
+    0xB0, 0x23, 0x66, 0x10, 0xB2, 0x18, 0xD3, 0xD9, 0xA0, 0xB2, 0x8C, 0xBF, 0x00, 0xB9, 0x1D, 0xA6,
+    0x8C, 0xC2, 0x24, 0x0F, 0x2A, 0x8E, 0x54, 0x00, 0xF2, 0x64, 0xF2, 0xD0, 0x04, 0xC9, 0x6D, 0x61,
+    0xAF, 0xF5, 0x33, 0xBA, 0x14, 0xB6, 0x0D, 0x7A, 0x01, 0xCD, 0x2F, 0x02, 0x12, 0x06, 0x30, 0x1B,
+    0x37, 0xCC, 0x33, 0x61, 0xDD, 0x6D, 0xF3, 0x0C, 0xFE, 0x18, 0xF3, 0x0C, 0xD9, 0xAF, 0xE6, 0x99,
+    0xD2, 0x6E, 0xA5, 0xF8, 0x59, 0xE9, 0x78, 0xA9, 0x78, 0x3F, 0x95, 0xBD, 0x9A, 0x9B, 0xEF, 0x50,
+    0xC9, 0x6B, 0xA9, 0xFD, 0xDE, 0xF8, 0xB2, 0xB2, 0x79, 0x26, 0xE1, 0x40, 0x39, 0x5A, 0xE4, 0x26,
+    0xFD, 0xA3, 0xF8, 0x60, 0x30, 0x32, 0x57, 0x50, 0x9A, 0xA8, 0x69, 0x6F, 0x86, 0xF7, 0xDC, 0x46,
+    0xCD, 0xB2, 0x78, 0x67, 0x43, 0x1D, 0xAB, 0x45, 0x68, 0xCA, 0xD9, 0x41, 0x8F, 0x4F, 0xE2, 0x59,
+    0xF1, 0x59, 0x52, 0x2F, 0xCE, 0xCF, 0xFA, 0xAE, 0x3B, 0x79, 0xEE, 0xBE, 0x89, 0x6C, 0xAD, 0x57,
+    0xF4, 0x34, 0xD2, 0xD8, 0x5E, 0x45, 0xED, 0x89, 0xAE, 0x10, 0x45, 0x57, 0xBB, 0x35, 0x82, 0xDF,
+    0x71, 0x23, 0xC8, 0xAF, 0x84, 0x93, 0xD1, 0x2B, 0x61, 0xB8, 0x8A, 0x05, 0x05, 0x53, 0x16, 0xC1,
+    0x56, 0xBA, 0xB8, 0x44, 0x67, 0x1B, 0xC3, 0x77, 0x38, 0xA6, 0x8C, 0xDF, 0x60, 0x55, 0x25, 0x4C,
+    0x41, 0xDB, 0x56, 0x08, 0x7F, 0xC1, 0x23, 0x22, 0x5B, 0xD1, 0x64, 0x78, 0x0D, 0x82, 0x83, 0xB8,
+    0xC9, 0x07, 0x53, 0x00, 0x01, 0x97, 0x52, 0x68, 0xBB, 0x1B, 0x59, 0x76, 0x48, 0x6C, 0xDF, 0x5E,
+    0xB4, 0x72, 0xB1, 0xB7, 0x82, 0xD3, 0x76, 0xDC, 0xC8, 0xD6, 0xBB, 0xE6, 0x55, 0x12, 0x87, 0x51,
+    0x66, 0x05, 0x11, 0x05, 0xCD, 0xB1, 0xFE, 0x7A, 0x27, 0x9F, 0x70, 0xA4, 0x1B, 0x46, 0x15, 0x9B,
+    0xEC, 0x05, 0x40, 0xF8, 0x02, 0xEB, 0xC8, 0x84, 0x38, 0x08, 0xEC, 0x05, 0x5A, 0x2F, 0xBE, 0x62,
+    0xAE, 0x31, 0xD7, 0x9B, 0xCF, 0x86, 0x64, 0x41, 0x9F, 0xF5, 0x85, 0xAE, 0x8E, 0xFF, 0xC4, 0xA4,
+    0x42, 0xD6, 0xB3, 0xDA, 0x16, 0x5B, 0x8F, 0x93, 0x8E, 0x06, 0xB3, 0xC7, 0xD8, 0x97, 0x81, 0xF4,
+    0xB2, 0xA2, 0xBF, 0xF9, 0xDB, 0x4E, 0x46, 0x0C, 0x31, 0xC9, 0x84, 0x95, 0xD2, 0x18, 0x1A, 0xF0,
+    0xBB, 0x2C, 0x91, 0xCC, 0xA4, 0x67, 0xD0, 0x6C, 0x11, 0x0E, 0x0D, 0x3F, 0x14, 0x2C, 0x6B, 0xB2,
+    0x28, 0x98, 0x9A, 0xC1, 0xE2, 0x24, 0x27, 0x5F, 0x9C, 0x17, 0x4F, 0xEF, 0x9A, 0x5C, 0x41, 0x93,
+    0xA1, 0x22, 0xD8, 0xD4, 0xA4, 0x1E, 0xAE, 0x84, 0xFF, 0xC1, 0x4C, 0xE4, 0x38, 0xAF, 0x5E, 0xB9,
+    0xA0, 0x60, 0xE4, 0xE7, 0x6B, 0x4B, 0x3B, 0x24, 0x16, 0xBC, 0xA1, 0x2B, 0x66, 0x85, 0x42, 0x1B,
+    0x41, 0x6C, 0x66, 0x4F, 0x01, 0xC2, 0xC0, 0xE9, 0x8A, 0xB4, 0x16, 0xAF, 0x49, 0x60, 0xBB, 0x36,
+    0x6E, 0x7E, 0x97, 0x30, 0x8F, 0x61, 0x9F, 0xA4, 0x19, 0xDB, 0x6C, 0xA9, 0x8D, 0xAF, 0xD1, 0xCE,
+    0xAF, 0x4F, 0x8C, 0xA5, 0x82, 0x3C, 0x10, 0x0F, 0xF3, 0x1D, 0xB5, 0x98, 0xBA, 0xA2, 0x84, 0x35,
+    0x5F, 0xC2, 0xBF, 0x20, 0xF3, 0xD1, 0xFA, 0xC8, 0x05, 0xD7, 0x6D, 0xC1, 0x62, 0x19, 0x91, 0x49,
+    0xCC, 0xAC, 0x3C, 0x65, 0x1D, 0x04, 0x87, 0xCD, 0x30, 0xB2, 0x5D, 0x2B, 0xDC, 0x58, 0x2A, 0xF0,
+    0x31, 0xAD, 0x1E, 0xA7, 0xFA, 0xF3, 0x0B, 0xDC, 0xE2, 0xD6, 0x0E, 0xB3, 0xCD, 0x8F, 0xCC, 0xBE,
+    0xAF, 0xD4, 0xBE, 0x9F, 0xF5, 0x4B, 0x0E, 0x93, 0x80, 0x07, 0x1F, 0x49, 0xD5, 0x4D, 0x11, 0xD6,
+    0x85, 0x20, 0x95, 0x24, 0xA8, 0x92, 0x3C, 0x29, 0x57, 0xBD, 0x12, 0x51, 0x38, 0xFA, 0x82, 0x38,
+    0xB5, 0x71, 0x7D, 0xD5, 0xC6, 0x5C, 0x22, 0x7B, 0x45, 0xFD, 0x00, 0xAE, 0xFE, 0x4A, 0x64, 0x96,
+    0xE0, 0xD6, 0x96, 0x86, 0xAC, 0x2C, 0xE1, 0x16, 0xDC, 0x3B, 0xC5, 0xD4, 0xA7, 0x01, 0x93, 0x72,
+    0xFB, 0x22, 0x61, 0x63, 0xD3, 0x04, 0x08, 0x4D, 0xD2, 0xE8, 0x61, 0xEF, 0xC1, 0x72, 0x7F, 0xEF,
+    0x7E, 0x5B, 0x9C, 0x20, 0xCA, 0x9D, 0x4C, 0xCE, 0x1B, 0xC3, 0x1E, 0x12, 0xCA, 0x29, 0xAB, 0x1F,
+    0xED, 0x1B, 0xCA, 0x6D, 0xF6, 0x93, 0x98, 0x9F, 0xC3, 0xB6, 0xEE, 0x30, 0xE7, 0xA6, 0xF3, 0x21,
+    0xEE, 0x21, 0x71, 0x91, 0xBC, 0x7C, 0x9F, 0x31, 0xEB, 0x4D, 0xF2, 0xF2, 0xB5, 0xC8, 0x3C, 0x65,
+    0xD9, 0xD4, 0x77, 0x76, 0x63, 0xAA, 0xAC, 0xAB, 0x37, 0xEF, 0xB6, 0x61, 0xEE, 0x40, 0xCF, 0xDE,
+    0x8F, 0x96, 0x09, 0xFC, 0x05, 0xC8, 0xE8, 0xB7, 0x4E, 0x1B, 0xC3, 0xB3, 0x3E, 0x13, 0x03, 0x92,
+    0x52, 0xC6, 0x85, 0xD0, 0x85, 0xF0, 0xD7, 0xBD, 0x74, 0x3C, 0x2C, 0x3E, 0x18, 0xB2, 0x30, 0x0E,
+    0x78, 0x15, 0xB5, 0x87, 0x98, 0x52, 0x46, 0x07, 0xBC, 0x7F, 0x1D, 0x2F, 0xBF, 0x11, 0x92, 0x32,
+    0x1D, 0x5E, 0xA5, 0x4E, 0xC8, 0x6C, 0x66, 0x8F, 0x29, 0xAA, 0x13, 0x87, 0xF1, 0x19, 0x01, 0x5E,
+    0xBF, 0xEE, 0xEF, 0xF6, 0xAA, 0x13, 0x6B, 0x41, 0xAE, 0x92, 0xB7, 0x6D, 0xD4, 0x81, 0xB0, 0x5A,
+    0x80, 0xD7, 0x87, 0x22, 0xDC, 0xAA, 0xAF, 0x31, 0x75, 0xD1, 0x5F, 0x5C, 0xB5, 0x8D, 0x58, 0x4F,
+    0x33, 0xDD, 0x9F, 0x35, 0x4A, 0x07, 0xFB, 0xA5, 0x5E, 0xD7, 0x7D, 0x31, 0x5C, 0x2C, 0xF2, 0xA3,
+    0xF2, 0xDB, 0x37, 0x2F, 0x6E, 0x3F, 0x71, 0x54, 0x7D, 0xF3, 0xC9, 0xA3, 0x5F, 0xBF, 0x60, 0x04,
+    0xCC, 0x00, 0x45, 0xB5, 0x9B, 0x9E, 0xF4, 0x75, 0xB9, 0xA6, 0x8E, 0x2C, 0x71, 0xB4, 0x33, 0x26,
+    0x93, 0xFB, 0x76, 0x2E, 0xD4, 0x57, 0x1C, 0x2B, 0xD0, 0x7F, 0x67, 0xE6, 0xC9, 0xB5, 0x0E, 0x78,
+    0x88, 0xB9, 0xC3, 0xE7, 0x6D, 0xDD, 0x5B, 0x2C, 0x76, 0xC6, 0x5F, 0x03, 0x83, 0xFC, 0xE1, 0x11,
+    0xE5, 0xE6, 0xFF, 0x58, 0x9E, 0xFC, 0x53, 0x2F, 0x55, 0x37, 0xF3, 0x73, 0x97, 0xC9, 0xFE, 0xBB,
+    0xEB, 0x5C, 0x62, 0x18, 0x23, 0xE9, 0x7F, 0xFE, 0xEF, 0xF8, 0xE4, 0xE7, 0xFF, 0xAA, 0x32, 0x6A,
+    0xE4, 0x5C, 0x70, 0x53, 0x37, 0x14, 0x4C, 0x63, 0x53, 0xE5, 0x8A, 0xC6, 0xF8, 0xC2, 0x9C, 0x2B,
+    0xC0, 0x47, 0x27, 0xD7, 0x95, 0x5B, 0x22, 0x1C, 0xFD, 0xA3, 0x3D, 0x3D, 0x1C, 0xA1, 0x98, 0x6B,
+    0x43, 0x71, 0x2A, 0xF8, 0x60, 0x9C, 0x84, 0x31, 0xA7, 0xEA, 0xD0, 0xFE, 0x6F, 0x09, 0xC7, 0x27,
+    0x47, 0xC7, 0x27, 0x6B, 0xE3, 0x93, 0xD5, 0x51, 0x07, 0xEE, 0x8C, 0x57, 0xF6, 0xBC, 0x85, 0xAC,
+    0xFB, 0xDD, 0x8C, 0xEA, 0x12, 0x16, 0x20, 0xCF, 0x9E, 0x48, 0x81, 0x59, 0xAA, 0xDD, 0x18, 0xDA,
+    0x3D, 0xF7, 0xD9, 0x07, 0xFA, 0xC7, 0xA6, 0xF9, 0x03, 0xEB, 0x54, 0x92, 0xFD, 0x73, 0x64, 0x9C,
+    0x43, 0x9B, 0x06, 0xED, 0xFC, 0x4F, 0x75, 0xF3, 0x3F, 0x77, 0x8D, 0x7E, 0x5F, 0xE4, 0x77, 0xB9,
+    0xF4, 0x27, 0xE6, 0xB6, 0x42, 0x1F, 0x35, 0x49, 0x99, 0xEC, 0x7E, 0x8E, 0xE0, 0x1E, 0xA4, 0x47,
+    0x39, 0xCD, 0x38, 0xF6, 0x73, 0x0B, 0xE9, 0xD7, 0x48, 0x9A, 0x1D, 0x9F, 0xCC, 0xC0, 0xD0, 0x22,
+    0x1F, 0xB9, 0x0D, 0x42, 0x67, 0x5E, 0x03, 0x2D, 0xE8, 0x75, 0xB1, 0xA9, 0x0C, 0xC2, 0xF4, 0x7F,
+    0xF5, 0xCF, 0xEE, 0x70, 0x79, 0xD3, 0x2E, 0xBF, 0x77, 0x58, 0x88, 0xB5, 0xAF, 0x2E, 0x64, 0x97,
+    0x73, 0xA2, 0x1D, 0x22, 0x3D, 0xAF, 0x59, 0x9C, 0x34, 0x93, 0x28, 0x86, 0x85, 0x4E, 0xBE, 0xC8,
+    0x44, 0xB1, 0xDD, 0x59, 0x40, 0x62, 0x75, 0x36, 0xDB, 0xDD, 0x18, 0x2E, 0x20, 0x37, 0x2D, 0x76,
+    0x6B, 0x4F, 0x9A, 0xEE, 0x57, 0x11, 0x64, 0x4A, 0x8C, 0xB1, 0x78, 0xCD, 0x74, 0xDE, 0xF7, 0x99,
+    0xC9, 0x0B, 0xF7, 0x81, 0xB3, 0x50, 0xB5, 0xD2, 0xEC, 0x27, 0x19, 0x0B, 0x3F, 0xCB, 0x07, 0xF4,
+    0x65, 0xF8, 0x57, 0xE1, 0xE8, 0xF8, 0x62, 0x7D, 0xCD, 0x8B, 0x55, 0x35, 0xD7, 0x4F, 0x32, 0xBE,
+    0x07, 0xAF, 0xAD, 0xE2, 0xDD, 0x10, 0xD7, 0x6D, 0xCD, 0xAA, 0x6A, 0x14, 0x3D, 0x41, 0x67, 0x40,
+    0xEE, 0xBE, 0x46, 0x55, 0x0D, 0x52, 0x6D, 0xCE, 0x0B, 0x06, 0xCE, 0x3A, 0x79, 0x8A, 0x6C, 0x2C,
+    0x35, 0xC6, 0x94, 0x89, 0x9E, 0xE9, 0x63, 0x30, 0x79, 0x59, 0x28, 0x99, 0x1C, 0x9F, 0x91, 0x0C,
+    0xDF, 0x42, 0x22, 0x56, 0x84, 0xC5, 0xFB, 0x2E, 0x22, 0x6A, 0xCC, 0xC6, 0x2A, 0x90, 0x8D, 0xB5,
+    0x42, 0x2F, 0xD1, 0x1A, 0xC8, 0xEF, 0xD8, 0x3A, 0xC5, 0x41, 0x59, 0x0D, 0xF5, 0xF8, 0x64, 0xBE,
+    0xE3, 0x8F, 0xDA, 0x07, 0x0A, 0x59, 0x4E, 0xCA, 0x9C, 0x0E, 0x18, 0xAE, 0x71, 0x92, 0xDE, 0xFA,
+    0x03, 0xA3, 0xC3, 0xE0, 0x4C, 0xC5, 0x10, 0x50, 0x2A, 0x20, 0x27, 0x1E, 0x7E, 0xF9, 0xF8, 0x64,
+    0xAB, 0xCC, 0x98, 0x70, 0x70, 0xFD, 0x20, 0xF5, 0xE2, 0x03, 0x7A, 0x04, 0x41, 0x6B, 0xF4, 0x9E,
+    0xF9, 0x9E, 0xB6, 0x5C, 0x95, 0x08, 0x71, 0xA1, 0x5C, 0x95, 0xE4, 0xA6, 0xD9, 0xEF, 0x1A, 0x95,
+    0x4E, 0x63, 0x74, 0x5D, 0x6C, 0xB9, 0x06, 0x21, 0x44, 0x1B, 0x61, 0xC7, 0x43, 0xD8, 0xEB, 0x3C,
+    0x2B, 0x86, 0x6E, 0xD8, 0x51, 0x16, 0x33, 0xD3, 0xA6, 0x8E, 0xE8, 0x8A, 0xF4, 0x49, 0x3D, 0x52,
+    0xD7, 0x38, 0x27, 0xD5, 0x1E, 0x7A, 0xDA, 0x38, 0x1E, 0xE9, 0x9C, 0xFC, 0xAF, 0xC6, 0xCD, 0x68,
+    0xDC, 0xD0, 0xC6, 0x7E, 0x31, 0x7E, 0x67, 0x6F, 0x20, 0xD5, 0x96, 0x9A, 0x93, 0x1E, 0xA4, 0xEF,
+    0xF0, 0xBB, 0xE8, 0x29, 0x7D, 0xEF, 0xF4, 0xBF, 0x1D, 0x62, 0xB7, 0xCE, 0xD2, 0x7A, 0x2C, 0xE8,
+    0xA9, 0x2B, 0x72, 0x98, 0x5B, 0xC9, 0x95, 0x3D, 0x3E, 0x15, 0x8C, 0x16, 0xC8, 0xA8, 0x11, 0x3C,
+    0xC3, 0x70, 0xA9, 0x22, 0x39, 0xB7, 0xB4, 0x75, 0x0C, 0x74, 0xE9, 0xC6, 0x20, 0xE9, 0x18, 0xCB,
+    0xA3, 0xA8, 0xF0, 0xC1, 0xAE, 0x32, 0xF6, 0xAC, 0x94, 0xC1, 0x13, 0x01, 0x67, 0xB6, 0xE6, 0x6B,
+    0x03, 0xB0, 0x02, 0x6E, 0x32, 0xB1, 0x7F, 0xA7, 0xCA, 0x64, 0x1E, 0x20, 0xB0, 0x18, 0xE3, 0xF0,
+    0x0A, 0x1C, 0x0E, 0xD0, 0x1E, 0xD6, 0x57, 0x04, 0x91, 0x9C, 0xDC, 0x81, 0xA9, 0xF3, 0x49, 0xFD,
+    0x8D, 0xE3, 0x30, 0x17, 0xCB, 0x52, 0xB4, 0x58, 0x02, 0xC4, 0xA7, 0x7C, 0xC1, 0xDE, 0x47, 0x69,
+    0xB7, 0x24, 0x74, 0x41, 0x28, 0x81, 0x4B, 0x0C, 0x12, 0x5E, 0x48, 0x4A, 0x8A, 0x9E, 0x93, 0xD9,
+    0x5B, 0x63, 0x28, 0x87, 0x88, 0x6C, 0xC8, 0x3E, 0x60, 0x3D, 0x70, 0x9B, 0x30, 0xBA, 0x01, 0x28,
+    0x4E, 0xC7, 0xA0, 0x7C, 0x3E, 0x31, 0xE6, 0x1F, 0xB2, 0xFD, 0xE1, 0x79, 0x02, 0x4E, 0x1E, 0xF7,
+    0x18, 0x2A, 0x4D, 0x44, 0xC0, 0xA4, 0x45, 0xC3, 0xFE, 0x5C, 0x42, 0xA2, 0xAF, 0x56, 0x16, 0x23,
+    0x8C, 0x56, 0xE7, 0x58, 0xF9, 0x33, 0x57, 0x3B, 0x1B, 0x4B, 0x2A, 0x78, 0xDE, 0xAA, 0x38, 0xBF,
+    0x6F, 0xB2, 0x19, 0x54, 0x59, 0x13, 0xEB, 0x2A, 0x69, 0xCF, 0x6E, 0xCB, 0xAA, 0xEC, 0xB6, 0xFF,
+    0x64, 0xCD, 0x1D, 0x9C, 0xFA, 0x07, 0x2A, 0x74, 0x07, 0xEE, 0x87, 0xA7, 0x07, 0x7A, 0xE4, 0xDF,
+    0x19, 0x8E, 0x91, 0x03, 0xB9, 0x61, 0xA2, 0x4F, 0x69, 0x05, 0x64, 0x7F, 0x35, 0x00, 0x36, 0xEA,
+    0x97, 0x07, 0xAE, 0xBC, 0x3B, 0xC0, 0x4B, 0x33, 0xC8, 0xE7, 0xC0, 0x04, 0x1E, 0x62, 0xAF, 0x85,
+    0xA8, 0x8D, 0xCD, 0x62, 0x57, 0x6F, 0x26, 0xBA, 0x3E, 0x32, 0xC6, 0x8C, 0xAF, 0x96, 0xB3, 0xB5,
+    0xDC, 0xFC, 0x43, 0x1B, 0xB7, 0xD7, 0x9B, 0xC8, 0x0C, 0x44, 0x55, 0x23, 0xAC, 0x04, 0x08, 0xD8,
+    0x10, 0xF2, 0x2C, 0xA8, 0xD4, 0x6C, 0x4F, 0x30, 0x44, 0x2C, 0x26, 0xBB, 0xBA, 0x5F, 0x33, 0x69,
+    0xAA, 0x1A, 0x43, 0xFD, 0x63, 0x65, 0xC4, 0x61, 0xDA, 0xC5, 0x34, 0x91, 0x61, 0xB5, 0xB1, 0x9E,
+    0x20, 0x46, 0x91, 0x7E, 0x38, 0x6C, 0x8D, 0x15, 0xCE, 0xC6, 0x39, 0xB1, 0x33, 0xEB, 0x1D, 0x32,
+    0xEE, 0x57, 0x2E, 0x8E, 0x25, 0x2D, 0x4C, 0xBD, 0x29, 0x04, 0x08, 0x0F, 0x02, 0x84, 0xE1, 0x62,
+    0x16, 0xB3, 0xDC, 0xA7, 0x69, 0x4E, 0xCF, 0xBA, 0x18, 0x31, 0x1D, 0x92, 0x0A, 0x52, 0x56, 0x30,
+    0x48, 0x37, 0x51, 0x50, 0x9B, 0x48, 0x8B, 0x6A, 0xC3, 0xE8, 0x37, 0x5A, 0x98, 0x68, 0x30, 0x28,
+    0x01, 0x00, 0x81, 0xC5, 0xBF, 0xF2, 0xF8, 0xBD, 0xD6, 0xA0, 0x65, 0x73, 0x26, 0x8D, 0x82, 0x1B,
+    0xF8, 0x92, 0xCF, 0x20, 0x61, 0xB8, 0x85, 0x91, 0x1D, 0x3F, 0x0C, 0xBA, 0xCA, 0x51, 0x5E, 0x50,
+    0xD6, 0xA5, 0x24, 0x73, 0x4C, 0x54, 0xE0, 0xB3, 0xA2, 0x63, 0xDD, 0x70, 0x14, 0xEB, 0x88, 0xD7,
+    0xBB, 0xBD, 0x55, 0xC3, 0x0E, 0xC3, 0x47, 0x63, 0xD5, 0x70, 0x6D, 0x77, 0x29, 0x0F, 0x1D, 0x98,
+    0x55, 0x0D, 0x77, 0x8E, 0x31, 0xE6, 0x98, 0xA6, 0xA0, 0x7C, 0x52, 0x6F, 0x81, 0xBA, 0xD5, 0xA2,
+    0x19, 0xFA, 0xF8, 0x24, 0x17, 0x66, 0xD1, 0xC2, 0x2F, 0x81, 0x30, 0x8A, 0x88, 0x19, 0xB7, 0x3A,
+    0x35, 0x66, 0x2D, 0x60, 0x07, 0xAE, 0x71, 0x07, 0xAA, 0x59, 0xD6, 0x02, 0xF6, 0x27, 0xAA, 0xD9,
+    0x4D, 0xD6, 0x82, 0xF4, 0x8A, 0x39, 0x82, 0xC8, 0x5A, 0xB8, 0x54, 0x08, 0xC3, 0xF5, 0x33, 0x9E,
+    0x9D, 0xE7, 0x48, 0x6E, 0x2C, 0x27, 0x4A, 0x72, 0x6A, 0xE2, 0x9C, 0x51, 0x13, 0x68, 0x56, 0xEF,
+    0x03, 0x46, 0x4F, 0x9F, 0x82, 0x75, 0x14, 0x62, 0x90, 0x7F, 0x70, 0x0C, 0xF4, 0x04, 0xA7, 0xE9,
+    0x04, 0xA7, 0xE9, 0x0F, 0x19, 0x74, 0xCB, 0xCA, 0x79, 0x41, 0x75, 0xC6, 0x98, 0xC8, 0xB7, 0x39,
+    0x1D, 0x27, 0x38, 0x1D, 0x27, 0x32, 0xAC, 0xDB, 0x09, 0x23, 0xB4, 0x22, 0x13, 0xFF, 0xE8, 0x19,
+    0x9F, 0xE5, 0x51, 0x30, 0x0E, 0xFC, 0x0A, 0x9D, 0x5A, 0x47, 0x94, 0xE3, 0xF0, 0x25, 0x19, 0x70,
+    0xD4, 0x8B, 0x6A, 0x5A, 0xDB, 0xF0, 0xA6, 0xA7, 0xDA, 0x6F, 0x78, 0xD3, 0xFF, 0x85, 0x6C, 0x8C,
+    0xBF, 0xC0, 0x08, 0x8B, 0x79, 0x9A, 0x06, 0xC6, 0x5A, 0x60, 0x98, 0x7F, 0x89, 0x74, 0x8E, 0xBF,
+    0x30, 0xC9, 0x78, 0xB9, 0x8F, 0xC3, 0x67, 0x10, 0xFD, 0xDC, 0x45, 0xF0, 0x73, 0xD8, 0xBF, 0xD0,
+    0x2E, 0x17, 0x5A, 0xBE, 0x6D, 0x15, 0xAA, 0xE0, 0x91, 0x2F, 0x62, 0xA1, 0x7D, 0xB3, 0xD0, 0xC6,
+    0xD3, 0xB2, 0x37, 0x14, 0xFE, 0xC3, 0xE1, 0x39, 0xA8, 0xDC, 0xE9, 0x1C, 0x80, 0x04, 0x9B, 0x42,
+    0x32, 0xE8, 0x10, 0xAE, 0x70, 0x7D, 0xAD, 0x15, 0xAE, 0x98, 0xD2, 0x87, 0x37, 0x28, 0x6D, 0xA7,
+    0xE3, 0x0A, 0x3B, 0xC8, 0x9C, 0xC8, 0x0B, 0xAC, 0x70, 0x84, 0x9A, 0xD8, 0xDA, 0x65, 0x99, 0xC6,
+    0x39, 0xB1, 0xC2, 0x2F, 0xA2, 0xC8, 0xF9, 0x2C, 0x32, 0x86, 0xD4, 0x99, 0x7F, 0xA0, 0x2E, 0x48,
+    0x83, 0xBC, 0x4C, 0xBF, 0xA7, 0x55, 0xE5, 0xF7, 0x74, 0xFA, 0xF8, 0xBD, 0x71, 0xF3, 0xF7, 0xA1,
+    0xA9, 0x1D, 0xDC, 0x30, 0x06, 0x18, 0x1D, 0xB5, 0xFE, 0x94, 0xC6, 0x8B, 0xDF, 0x33, 0x8B, 0x80,
+    0x95, 0x13, 0xFC, 0xDC, 0xC0, 0x86, 0xA6, 0x34, 0x0B, 0x47, 0xD9, 0x20, 0x24, 0xEE, 0xB3, 0x32,
+    0x4F, 0x6D, 0xE9, 0xCD, 0x68, 0x60, 0xF1, 0xA1, 0x5C, 0x23, 0x6A, 0x24, 0x3F, 0x92, 0xE3, 0x68,
+    0xA2, 0xA2, 0xD9, 0x91, 0xEE, 0xFE, 0xA6, 0x41, 0x06, 0x53, 0xB9, 0xB9, 0xCD, 0x6F, 0xBE, 0x5B,
+    0x6E, 0xCE, 0xDB, 0x6C, 0xF0, 0x6B, 0xA7, 0x34, 0x11, 0xCD, 0x1D, 0xB1, 0x59, 0xFD, 0x1E, 0x16,
+    0xB2, 0xF9, 0x66, 0xDF, 0xD4, 0xB6, 0x51, 0x95, 0x21, 0x75, 0x91, 0xB9, 0xA1, 0xB1, 0x29, 0xFE,
+    0xEC, 0x4D, 0xB5, 0x39, 0x11, 0x59, 0xEE, 0xD8, 0x7C, 0xAD, 0xEB, 0x53, 0x04, 0x1E, 0x46, 0xFA,
+    0x59, 0xAE, 0x37, 0xD5, 0xE6, 0xB8, 0xBF, 0xAC, 0xF1, 0x11, 0x14, 0xBB, 0x77, 0xB6, 0xDA, 0xDC,
+    0x3A, 0x13, 0x16, 0x6B, 0x3E, 0xBF, 0xB5, 0x8F, 0x12, 0x7E, 0x3F, 0x9F, 0xE9, 0x37, 0x71, 0xFE,
+    0x94, 0x2A, 0xEA, 0x19, 0x64, 0x2B, 0x17, 0x08, 0x90, 0x81, 0x21, 0x7B, 0xDE, 0x00, 0x81, 0x3A,
+    0xAD, 0x08, 0xBF, 0x0B, 0xDC, 0x05, 0xF7, 0x1C, 0x46, 0xD9, 0x49, 0xB0, 0x66, 0xC8, 0xD1, 0xB9,
+    0x39, 0xC8, 0xA9, 0xB1, 0x95, 0xF8, 0x76, 0x72, 0xD2, 0xCE, 0x8C, 0x64, 0x63, 0xA9, 0x39, 0x61,
+    0x1A, 0xB5, 0xB7, 0x99, 0x87, 0xC4, 0xF7, 0xBF, 0x77, 0xC3, 0xC6, 0x4C, 0x96, 0x32, 0xB3, 0xA5,
+    0xEC, 0x74, 0x61, 0x16, 0xCC, 0x34, 0xE8, 0x29, 0xE6, 0xA1, 0x3A, 0xCB, 0xB1, 0xAD, 0x91, 0x1E,
+    0x23, 0x3D, 0x44, 0xCA, 0x88, 0xE5, 0x8C, 0x9A, 0x57, 0xF6, 0x51, 0x4E, 0x89, 0xE2, 0x9C, 0x28,
+    0x33, 0x29, 0xB3, 0xF3, 0x73, 0x98, 0x38, 0xAD, 0x4C, 0xC5, 0xAE, 0xC1, 0x79, 0xB6, 0x7C, 0xEF,
+    0x26, 0xDA, 0xD3, 0xB6, 0xD5, 0x9D, 0x69, 0x1F, 0x25, 0x6F, 0xF1, 0x08, 0x1A, 0xD3, 0x46, 0xAD,
+    0x69, 0x99, 0x3B, 0xEE, 0xDA, 0xF4, 0x71, 0xA6, 0x9D, 0xD8, 0x56, 0x9B, 0xA2, 0x7F, 0x4F, 0xCB,
+    0x2C, 0xC8, 0x7F, 0x0F, 0xC5, 0x8C, 0x82, 0x12, 0x3D, 0x1B, 0xEF, 0x33, 0x87, 0x58, 0x1D, 0xB2,
+    0x25, 0xBB, 0x67, 0x6D, 0x41, 0xE7, 0x60, 0x33, 0x72, 0x10, 0x76, 0xA4, 0x56, 0xBE, 0xA2, 0xD3,
+    0x59, 0x89, 0xBD, 0x45, 0x67, 0x2C, 0xFE, 0x98, 0x1D, 0x98, 0x85, 0x40, 0x42, 0x69, 0x12, 0xF9,
+    0xF2, 0xEB, 0x34, 0xC6, 0x3C, 0xE2, 0x59, 0x3A, 0x78, 0xD1, 0x16, 0x9A, 0xB1, 0xB6, 0x03, 0x95,
+    0x76, 0x6C, 0xA2, 0x86, 0xD6, 0x61, 0xD8, 0x22, 0xAD, 0xAF, 0x0B, 0xDB, 0x42, 0xBF, 0xAD, 0x7B,
+    0xD3, 0x1F, 0xDB, 0x2D, 0xE3, 0xB9, 0x0A, 0x53, 0xE3, 0xC0, 0xCA, 0x19, 0x1E, 0x89, 0x8D, 0x13,
+    0x34, 0x34, 0x6C, 0xE9, 0x8C, 0x79, 0x80, 0x70, 0xAF, 0x61, 0x68, 0xD9, 0xF0, 0xA2, 0x2D, 0x8B,
+    0xB4, 0x43, 0x45, 0xC6, 0x37, 0xE2, 0x1A, 0xC8, 0x05, 0x45, 0xD9, 0x39, 0x8A, 0x13, 0xC2, 0x36,
+    0xA9, 0xB2, 0x5A, 0xB4, 0x78, 0x83, 0x12, 0xC0, 0xB8, 0xC1, 0x09, 0x2D, 0x33, 0x5A, 0x83, 0x26,
+    0x7C, 0x3D, 0x41, 0xCD, 0x8C, 0xB4, 0xB8, 0x1E, 0xF9, 0xC8, 0x08, 0x3F, 0x7B, 0x53, 0xCC, 0x33,
+    0x1D, 0x60, 0x32, 0x5B, 0x74, 0xB9, 0xE9, 0x41, 0x8C, 0xFF, 0x15, 0xC7, 0x94, 0xD3, 0x5B, 0x8C,
+    0xE2, 0xC0, 0x10, 0xF4, 0x31, 0x8B, 0x51, 0xED, 0x9C, 0x82, 0xFF, 0x10, 0x10, 0x55, 0x0B, 0x16,
+    0x7C, 0x7A, 0x1A, 0x57, 0xC5, 0x33, 0x7D, 0xD4, 0xCC, 0x49, 0xF6, 0xCA, 0x34, 0xAA, 0x93, 0x97,
+    0x87, 0xB8, 0x8A, 0x6B, 0xB9, 0x24, 0x6C, 0x33, 0x40, 0xEA, 0x82, 0xD9, 0xB2, 0x98, 0xF4, 0x53,
+    0x47, 0xBA, 0x2F, 0xCC, 0x85, 0x98, 0xCA, 0x8A, 0x3A, 0xA2, 0x80, 0x37, 0xA3, 0x92, 0x87, 0x2A,
+    0xD8, 0xB5, 0x27, 0x56, 0x8A, 0x67, 0xB5, 0xC4, 0x3C, 0xCB, 0x64, 0x3D, 0x1F, 0x0D, 0x85, 0xD1,
+    0x85, 0x74, 0x13, 0x2E, 0x44, 0x9B, 0xF9, 0x2C, 0xD8, 0xD7, 0x2F, 0x83, 0x31, 0x87, 0x97, 0x4E,
+    0x91, 0xCA, 0x80, 0x34, 0x3C, 0x7E, 0xAF, 0x31, 0xA9, 0x8E, 0x2B, 0x86, 0xDF, 0x3A, 0x14, 0x01,
+    0x76, 0x17, 0x85, 0x87, 0x3B, 0x00, 0xD8, 0x33, 0x17, 0x46, 0x72, 0x62, 0xAC, 0xFD, 0xB8, 0x75,
+    0xC2, 0x54, 0x13, 0xFA, 0xF4, 0xAD, 0x83, 0xBE, 0x5B, 0x4E, 0xFF, 0x9B, 0x13, 0x14, 0xA3, 0x4C,
+    0x26, 0xE8, 0xCF, 0xD9, 0xB0, 0x8B, 0x37, 0xC2, 0x2E, 0x3A, 0x13, 0x76, 0xE1, 0xDD, 0x61, 0xB7,
+    0xC2, 0x09, 0xBC, 0xDE, 0xA3, 0x18, 0x64, 0x9C, 0xD8, 0x2F, 0xF0, 0xF8, 0x84, 0xA5, 0x39, 0x5A,
+    0xCB, 0x2F, 0xE7, 0x26, 0x29, 0x8F, 0x37, 0xC8, 0x64, 0x31, 0x75, 0xBD, 0x0E, 0xD8, 0xCA, 0x73,
+    0x1F, 0x06, 0x38, 0x35, 0x3C, 0x6B, 0xA9, 0xA5, 0x01, 0xAB, 0x92, 0x42, 0xD6, 0x3E, 0x1F, 0xE7,
+    0xF2, 0xF1, 0xC4, 0x87, 0x6E, 0x9B, 0x18, 0x96, 0x2E, 0x10, 0x3A, 0x5F, 0x5C, 0xE3, 0xCA, 0xB4,
+    0x71, 0xCF, 0xAB, 0x53, 0xB3, 0x31, 0x68, 0x66, 0x1A, 0x3B, 0x73, 0x9E, 0xC7, 0x19, 0xCE, 0xF2,
+    0x38, 0x85, 0xAD, 0x56, 0x21, 0x2F, 0xCE, 0x40, 0xAE, 0x5C, 0x40, 0xF4, 0x94, 0xC9, 0x9C, 0xF5,
+    0x98, 0xCC, 0x39, 0x8B, 0x78, 0x46, 0x9F, 0x8E, 0x11, 0x4F, 0x9A, 0xF7, 0xFE, 0xB5, 0x12, 0xF0,
+    0x6C, 0x29, 0x16, 0x93, 0x6B, 0xEA, 0x83, 0x1E, 0xB0, 0x2D, 0x81, 0x26, 0x8C, 0x60, 0x56, 0xF1,
+    0x6D, 0x1C, 0xB0, 0x81, 0x4B, 0x62, 0x13, 0x7F, 0x7F, 0x78, 0xE4, 0xDA, 0x03, 0x3E, 0x90, 0x43,
+    0x2B, 0xCC, 0xC9, 0x1E, 0x44, 0x45, 0x37, 0x75, 0x68, 0x45, 0x35, 0x3F, 0xDC, 0x6D, 0x3F, 0xEE,
+    0x77, 0x16, 0xE8, 0x72, 0xC9, 0x55, 0x9A, 0x61, 0x02, 0x59, 0x72, 0xD5, 0xCC, 0x4A, 0xAE, 0xD2,
+    0xC5, 0x92, 0xAB, 0x60, 0x56, 0x72, 0xB5, 0x11, 0xB2, 0x8C, 0x17, 0x8B, 0xB8, 0x54, 0x72, 0x35,
+    0x3B, 0x6E, 0xB6, 0x9B, 0xF9, 0x47, 0xCF, 0x2C, 0x13, 0x6E, 0xF2, 0x87, 0xB5, 0x66, 0xB1, 0xEF,
+    0xB3, 0xB2, 0x3C, 0x3B, 0x61, 0x1F, 0xE6, 0x32, 0x98, 0xED, 0xB0, 0x0F, 0x72, 0x91, 0x18, 0x17,
+    0xC2, 0xDE, 0x47, 0xFB, 0x42, 0xD8, 0x7B, 0x68, 0x81, 0x7B, 0xD5, 0x17, 0xDE, 0x56, 0xAC, 0x39,
+    0xC7, 0xE9, 0x10, 0xAE, 0xB6, 0x89, 0x99, 0x4B, 0xF1, 0xEB, 0x78, 0x8C, 0x6C, 0xEF, 0x71, 0x8D,
+    0xEF, 0x6D, 0x29, 0x38, 0xCE, 0x4D, 0x26, 0xC8, 0x91, 0x6F, 0x44, 0xB4, 0x9E, 0x4D, 0xDE, 0x69,
+    0x44, 0x17, 0x6D, 0x24, 0x35, 0x8A, 0x40, 0xCF, 0x98, 0xE6, 0xEE, 0xA4, 0x3E, 0x05, 0xFD, 0x86,
+    0x34, 0xB1, 0x5B, 0x68, 0x5C, 0x7D, 0x65, 0x52, 0x0C, 0x26, 0x55, 0xD3, 0xC6, 0x32, 0xE2, 0x72,
+    0x31, 0xE0, 0x6A, 0x8E, 0xF4, 0xB3, 0x67, 0xFA, 0xED, 0x69, 0xB0, 0x00, 0x38, 0x30, 0x24, 0xE3,
+    0x81, 0x21, 0x62, 0xB9, 0x04, 0x3C, 0x12, 0xC4, 0xBF, 0x21, 0x65, 0x6D, 0x01, 0x4E, 0xC1, 0xC2,
+    0x81, 0x21, 0x57, 0xE6, 0x07, 0x86, 0x1C, 0x9E, 0x3C, 0xBC, 0x70, 0x30, 0xC8, 0x7E, 0x6A, 0x4E,
+    0x76, 0xD9, 0x1A, 0x0F, 0x0C, 0x99, 0x1F, 0x74, 0x69, 0xDD, 0xEA, 0x8B, 0xF4, 0x85, 0x05, 0xAA,
+    0x66, 0x55, 0xB1, 0x53, 0x11, 0x19, 0xDA, 0x9C, 0x25, 0x83, 0xE3, 0x12, 0x16, 0x89, 0x20, 0x22,
+    0x81, 0xB4, 0x5B, 0xF0, 0xE2, 0x4E, 0x65, 0x2D, 0xEF, 0xDF, 0x9C, 0x3B, 0x82, 0x46, 0x6F, 0x90,
+    0xBA, 0x8B, 0x87, 0xA0, 0x5E, 0x15, 0xD2, 0x1E, 0xDD, 0x03, 0x69, 0x3F, 0xDB, 0x59, 0x2A, 0x0E,
+    0x69, 0x38, 0xA7, 0x3A, 0xE4, 0x59, 0x2A, 0x7F, 0xCA, 0xB3, 0x54, 0xF4, 0xC2, 0x59, 0x2A, 0x5B,
+    0x3C, 0x4B, 0x25, 0xF4, 0xF6, 0xD2, 0xE0, 0xAA, 0x67, 0xA9, 0x5C, 0xA7, 0x82, 0xF0, 0x5F, 0x83,
+    0xFC, 0x18, 0x4B, 0xF0, 0x63, 0xE0, 0xBD, 0x4F, 0x67, 0x15, 0x84, 0x1F, 0x83, 0x51, 0x7F, 0x3C,
+    0x23, 0x4B, 0x15, 0x84, 0x09, 0xF7, 0x23, 0xCF, 0xB6, 0xB0, 0x81, 0x9F, 0xAB, 0xB9, 0xFF, 0x0C,
+    0x75, 0x78, 0x0C, 0x6B, 0x61, 0xE2, 0xF0, 0x44, 0xA4, 0x79, 0x44, 0xC7, 0x9F, 0x3F, 0x5C, 0xC5,
+    0xFD, 0xB7, 0x9F, 0x8E, 0x0E, 0xC1, 0x4B, 0x32, 0x1A, 0x1E, 0xBB, 0xDA, 0x7C, 0xA6, 0x54, 0xED,
+    0x79, 0x95, 0xC6, 0x07, 0xE6, 0x08, 0xC6, 0x9B, 0xAB, 0xD2, 0x20, 0x98, 0x8C, 0xF5, 0xA6, 0x16,
+    0xF4, 0x54, 0x8F, 0xF8, 0x15, 0x83, 0x35, 0x03, 0xD7, 0xAC, 0x64, 0x92, 0xBD, 0x8D, 0xC4, 0xAE,
+    0x66, 0x4C, 0x1C, 0x43, 0x81, 0xBE, 0x68, 0x75, 0x99, 0xD0, 0x1D, 0xC4, 0xFE, 0xFB, 0x8B, 0xD2,
+    0x89, 0x60, 0x9A, 0x15, 0x57, 0x26, 0x5B, 0xD3, 0xC8, 0x24, 0xC3, 0x9A, 0xF3, 0x31, 0x0D, 0x8D,
+    0x5A, 0x35, 0x46, 0x5E, 0x29, 0x2A, 0xC6, 0x65, 0x83, 0x44, 0x14, 0xAC, 0xA0, 0x2F, 0x1D, 0x6E,
+    0xB9, 0xDE, 0x35, 0xA0, 0xDA, 0x30, 0x0B, 0xCE, 0xCD, 0x92, 0x5E, 0x68, 0xE9, 0x7B, 0x7D, 0xD8,
+    0xAC, 0x21, 0x29, 0x73, 0x27, 0x14, 0x3C, 0x7A, 0x31, 0x6A, 0xBC, 0x3E, 0xCB, 0x3E, 0xFE, 0xFE,
+    0x14, 0x86, 0xC4, 0xD4, 0xC9, 0xAE, 0x08, 0xDA, 0x8E, 0x97, 0xA3, 0xB8, 0xF2, 0x85, 0x27, 0x30,
+    0xF9, 0x3C, 0x71, 0xB2, 0x01, 0x97, 0xE4, 0x4B, 0xF1, 0x25, 0x1E, 0x90, 0x3C, 0x8E, 0x11, 0x72,
+    0x72, 0x71, 0x8C, 0x2C, 0x94, 0x5B, 0x3B, 0x98, 0x31, 0x7E, 0x73, 0x61, 0x8C, 0x8C, 0x75, 0x73,
+    0x8C, 0x34, 0xDD, 0xAD, 0xD8, 0x31, 0x27, 0xCF, 0x84, 0xE9, 0x3C, 0x0B, 0x25, 0xD8, 0x13, 0x1F,
+    0xFD, 0x7C, 0xF3, 0xF0, 0x0D, 0x33, 0x0F, 0x0E, 0xE7, 0x21, 0xA3, 0x1F, 0x99, 0xDC, 0xD3, 0xCE,
+    0x84, 0xC8, 0x1E, 0xC2, 0xB4, 0xC6, 0xD8, 0xDA, 0xA4, 0xEA, 0xB3, 0xFF, 0xE7, 0x79, 0x2D, 0x97,
+    0x16, 0x53, 0x22, 0x45, 0x94, 0x9E, 0xB4, 0x19, 0x4D, 0x26, 0x29, 0x28, 0x7C, 0xB7, 0xB0, 0xB9,
+    0x2F, 0x96, 0xDB, 0x56, 0x96, 0x0F, 0x34, 0xFF, 0x2D, 0x3A, 0x71, 0x92, 0x6A, 0x9A, 0x00, 0xC1,
+    0xED, 0x4D, 0x76, 0xCF, 0xF0, 0x58, 0x63, 0x14, 0x44, 0x3E, 0x3B, 0x89, 0x65, 0x8C, 0xEE, 0xDD,
+    0xE6, 0xD3, 0x32, 0x3E, 0xA7, 0x0F, 0x95, 0x4E, 0xB5, 0x47, 0x8D, 0xB3, 0xC0, 0xB8, 0xD0, 0xA2,
+    0x76, 0x1E, 0xCB, 0xF0, 0xA7, 0x7B, 0x44, 0x97, 0x75, 0x14, 0x32, 0x96, 0xD1, 0x2D, 0xC6, 0x32,
+    0xFC, 0x59, 0x2C, 0x63, 0xB8, 0x7E, 0x2C, 0x23, 0x0F, 0x36, 0x97, 0x3D, 0xA9, 0x9B, 0xFB, 0xFC,
+    0x6C, 0x3C, 0x8D, 0x65, 0x6B, 0x30, 0x9E, 0x44, 0x38, 0xE5, 0x2A, 0x73, 0xE8, 0x01, 0x4E, 0xFB,
+    0xF3, 0xE1, 0x0E, 0x5F, 0x87, 0x79, 0x0C, 0x3F, 0xDB, 0x3C, 0x7F, 0xA3, 0x11, 0xA4, 0x2A, 0x3A,
+    0xFF, 0x45, 0x9E, 0x0B, 0x0E, 0xD9, 0x4E, 0xDE, 0xF4, 0x05, 0x65, 0xDE, 0xA1, 0xC3, 0x21, 0x37,
+    0x79, 0x38, 0x64, 0x75, 0x68, 0x96, 0xD4, 0xE5, 0xEF, 0x93, 0x00, 0xF1, 0x52, 0x0A, 0xDD, 0xC1,
+    0x9D, 0xCF, 0x71, 0x0E, 0xE7, 0x73, 0x34, 0x87, 0x6C, 0xB1, 0x18, 0xF9, 0x96, 0x5F, 0x4E, 0xCC,
+    0x83, 0xE8, 0xBD, 0x8A, 0xD3, 0xB9, 0x5F, 0xEA, 0x76, 0xBA, 0xEC, 0x52, 0x3A, 0x99, 0x53, 0xFA,
+    0xDF, 0xE7, 0x5A, 0x16, 0x8E, 0x9E, 0xA3, 0xE4, 0xA3, 0x84, 0x7E, 0xF1, 0x24, 0x67, 0xDE, 0xFA,
+    0x95, 0x62, 0x2E, 0x44, 0x57, 0xAC, 0xE3, 0x6E, 0x42, 0x8F, 0x95, 0xD8, 0x17, 0x74, 0xD4, 0x2E,
+    0x05, 0x5C, 0x49, 0xB4, 0xA9, 0x5C, 0xD7, 0xD5, 0xD5, 0xDE, 0xC5, 0x91, 0x7C, 0x74, 0x4A, 0xC3,
+    0x97, 0x4F, 0x77, 0xC9, 0x48, 0x56, 0xE0, 0xC4, 0x8A, 0xC1, 0x3B, 0x49, 0x8A, 0xE3, 0x94, 0x98,
+    0xCB, 0x49, 0xB5, 0x71, 0xCF, 0x1D, 0x98, 0xA5, 0x45, 0xC7, 0xE6, 0x74, 0xC1, 0x99, 0xB9, 0xB1,
+    0x37, 0xE9, 0xC0, 0x44, 0x6F, 0xC6, 0x18, 0xFF, 0xC1, 0x9D, 0x8D, 0xD2, 0x2D, 0xE7, 0x15, 0xEC,
+    0x8C, 0x5F, 0xCB, 0x6F, 0xF5, 0x16, 0xF2, 0x0A, 0x0E, 0x0C, 0x20, 0x67, 0xB7, 0x08, 0x90, 0x87,
+    0x85, 0xDC, 0xC1, 0xFD, 0x20, 0xB9, 0x56, 0xEA, 0x60, 0x01, 0x32, 0x25, 0x59, 0x84, 0xAE, 0x32,
+    0x95, 0x9B, 0x7B, 0x29, 0x52, 0xFB, 0x09, 0xF7, 0x56, 0x25, 0x2C, 0xD4, 0xA3, 0xC6, 0x21, 0x00,
+    0xDF, 0x34, 0x8A, 0xE9, 0x07, 0x2D, 0x0B, 0x96, 0x2F, 0x77, 0xEA, 0xB8, 0x34, 0xBF, 0x12, 0xFB,
+    0x5A, 0x9A, 0x5F, 0x4E, 0xD5, 0xBF, 0x47, 0x33, 0xA8, 0x9F, 0x4B, 0xF3, 0x0B, 0xAD, 0x3E, 0x94,
+    0xA6, 0xD6, 0x0F, 0xFE, 0x02, 0x4D, 0xF1, 0xF2, 0x1B, 0x68, 0xB2, 0x57, 0x5E, 0x42, 0x93, 0xBC,
+    0xF5, 0x14, 0x9A, 0xF8, 0xD3, 0x07, 0xD1, 0x44, 0x3C, 0x28, 0xB4, 0x0E, 0x07, 0x36, 0xC1, 0x94,
+    0x0D, 0xEB, 0x24, 0xDC, 0xC6, 0xC3, 0x16, 0x7B, 0x60, 0xC0, 0x79, 0xB0, 0x7F, 0x9F, 0x68, 0x9C,
+    0x1D, 0x3B, 0x2C, 0x25, 0x26, 0x6D, 0x2C, 0x85, 0x4C, 0xCD, 0x0C, 0xBA, 0xC6, 0x47, 0x37, 0x4B,
+    0x1A, 0xB9, 0x5D, 0xA7, 0xFB, 0xA4, 0xF6, 0x74, 0x9F, 0x45, 0xFB, 0x30, 0x1A, 0x33, 0x69, 0x16,
+    0x43, 0xA7, 0x3B, 0xCB, 0x71, 0xDE, 0x03, 0x02, 0x2F, 0x41, 0x49, 0x6D, 0x8C, 0x30, 0xA9, 0x0A,
+    0x3F, 0x2E, 0x66, 0xBE, 0x84, 0x05, 0x78, 0x3A, 0xA6, 0x0E, 0x9B, 0x14, 0x59, 0x03, 0xE9, 0x4C,
+    0x02, 0xE5, 0x07, 0x04, 0x21, 0x6F, 0xF1, 0x64, 0x9D, 0x57, 0x68, 0xB1, 0x3C, 0xCD, 0x2C, 0xF7,
+    0x07, 0x09, 0x42, 0x98, 0x62, 0x7F, 0x9C, 0xBC, 0xB3, 0x46, 0x36, 0x7A, 0x72, 0x02, 0x97, 0x05,
+    0x8F, 0x90, 0x51, 0x4C, 0x28, 0x77, 0x99, 0x60, 0xEE, 0x31, 0xF5, 0xDC, 0xAF, 0xC0, 0xE8, 0x22,
+    0xA6, 0x7D, 0x7B, 0xC8, 0x7B, 0x2D, 0x8B, 0x66, 0x0D, 0x04, 0xAF, 0x0A, 0xD3, 0xA0, 0x8E, 0x04,
+    0x51, 0x64, 0x22, 0x7F, 0x86, 0x59, 0xE7, 0x1C, 0xB9, 0x10, 0x55, 0xFF, 0x28, 0xC0, 0x8A, 0xAA,
+    0x59, 0x7C, 0x96, 0xC9, 0xD2, 0x87, 0x45, 0x99, 0xC4, 0xBB, 0x40, 0x3E, 0x38, 0x80, 0x66, 0xFE,
+    0x10, 0x44, 0x24, 0xB8, 0xE1, 0xED, 0xDD, 0x60, 0x90, 0xED, 0x70, 0x8A, 0xE0, 0xEA, 0x2C, 0x2B,
+    0xA8, 0xD9, 0xF3, 0x86, 0xDE, 0x9B, 0x72, 0x63, 0x6F, 0x26, 0xD8, 0x9D, 0x9C, 0x01, 0xB7, 0x89,
+    0x95, 0xD7, 0x25, 0xB9, 0x3C, 0x84, 0xC5, 0x8F, 0xCE, 0x73, 0x9A, 0x0E, 0x62, 0xF4, 0x0C, 0x52,
+    0xF4, 0x0B, 0x2D, 0x18, 0x9B, 0x27, 0xA0, 0x0A, 0xFE, 0xC3, 0x34, 0x44, 0xC2, 0xA9, 0x90, 0x84,
+    0x6B, 0xD2, 0x7E, 0x93, 0xB9, 0x96, 0x66, 0x87, 0xB4, 0xB1, 0x35, 0xCF, 0x63, 0xBB, 0x44, 0x3C,
+    0x86, 0x50, 0xF9, 0xB9, 0x69, 0xED, 0xDF, 0x18, 0x51, 0xF1, 0x69, 0x83, 0x23, 0x13, 0x6B, 0xD4,
+    0xFF, 0x6F, 0xFB, 0x7B, 0x83, 0xF7, 0x57, 0xA0, 0xA5, 0x51, 0x65, 0x00, 0x1D, 0x2D, 0x6D, 0x84,
+    0xD1, 0x4B, 0x9B, 0x20, 0x01, 0x17, 0xA0, 0x45, 0xE9, 0xA9, 0xBF, 0xE0, 0x66, 0x71, 0x8A, 0xEE,
+    0xC8, 0x80, 0x31, 0x03, 0xFF, 0xD4, 0xB2, 0x71, 0x1A, 0x19, 0x37, 0x6A, 0xD8, 0x78, 0x6C, 0xAC,
+    0x32, 0xE7, 0x42, 0x29, 0x58, 0x0A, 0x87, 0x69, 0xBD, 0xC8, 0x0C, 0x88, 0xAD, 0x40, 0xCC, 0x3B,
+    0x4B, 0x96, 0xB7, 0x54, 0xEC, 0x26, 0x99, 0x0B, 0x31, 0x18, 0x12, 0xFD, 0x21, 0xB2, 0x69, 0x90,
+    0xBC, 0x93, 0x63, 0x46, 0x46, 0x38, 0x7B, 0xDD, 0x22, 0xF7, 0xC5, 0xC3, 0xE9, 0x65, 0x0B, 0x2D,
+    0x25, 0xFA, 0x38, 0x9F, 0xE3, 0x70, 0x7A, 0x85, 0x60, 0xA5, 0xBB, 0x70, 0x38, 0xFD, 0xF5, 0xB8,
+    0x1F, 0xC9, 0x8E, 0x38, 0x89, 0x30, 0x6C, 0x93, 0x32, 0x46, 0xCC, 0xA2, 0x0C, 0x1B, 0x24, 0x74,
+    0x17, 0x7F, 0xF3, 0x58, 0x5B, 0x20, 0x2D, 0xFD, 0xFD, 0xC9, 0xB9, 0x59, 0x9A, 0x6E, 0x45, 0xEF,
+    0xFE, 0xB9, 0xB0, 0x73, 0x45, 0x59, 0x41, 0xA6, 0x2D, 0x9C, 0x2E, 0xC2, 0xD4, 0x7D, 0x1E, 0x2A,
+    0x1F, 0xFD, 0x75, 0xA4, 0xD5, 0x31, 0xEB, 0x1B, 0x65, 0x7D, 0xF1, 0x3C, 0x24, 0x40, 0xEB, 0x8F,
+    0x41, 0x58, 0x86, 0x78, 0x45, 0x51, 0x8A, 0x99, 0xD8, 0x89, 0xD9, 0x1C, 0xB5, 0x70, 0x38, 0x81,
+    0x20, 0x2E, 0xA2, 0x10, 0x1A, 0x31, 0xD1, 0x07, 0xE8, 0x19, 0x4A, 0x9D, 0x2D, 0x1E, 0x9E, 0x59,
+    0xCD, 0x2D, 0x53, 0x56, 0xCE, 0xC9, 0x50, 0x4E, 0x3E, 0xA4, 0xF3, 0x13, 0x82, 0x71, 0xEF, 0x36,
+    0x39, 0xC4, 0xF6, 0x3C, 0x9A, 0xA8, 0x45, 0x95, 0xA8, 0x7E, 0x7F, 0xAB, 0x41, 0x5E, 0x7F, 0x81,
+    0x3F, 0x06, 0x54, 0xC6, 0x55, 0x8C, 0x83, 0x40, 0xAE, 0x68, 0x63, 0xB6, 0xAF, 0xF0, 0x48, 0x52,
+    0x19, 0xD8, 0x80, 0x63, 0xE1, 0x49, 0xCE, 0xCC, 0xCE, 0x2F, 0xBD, 0xFD, 0x63, 0x82, 0x0C, 0x81,
+    0x04, 0xC1, 0x63, 0x51, 0x7A, 0x1C, 0xC8, 0x38, 0xAD, 0x84, 0x42, 0x75, 0x52, 0xB1, 0xD4, 0x7A,
+    0xD5, 0xDA, 0x55, 0x92, 0x56, 0x7F, 0x7B, 0xAC, 0xCB, 0xB3, 0x26, 0xF7, 0x84, 0xAB, 0x37, 0x6B,
+    0x36, 0x96, 0x97, 0xF1, 0x4E, 0x98, 0x95, 0xA6, 0x63, 0x9A, 0xB5, 0xC5, 0xE8, 0xD4, 0x86, 0xBF,
+    0x98, 0x22, 0x7E, 0x7B, 0xFF, 0x04, 0x83, 0x39, 0x5A, 0x28, 0x33, 0x47, 0x0B, 0xD5, 0xC7, 0x16,
+    0x7A, 0xF1, 0xF9, 0x0F, 0x8A, 0x44, 0x40, 0xDE, 0x3E, 0xDA, 0xF8, 0xF4, 0xF7, 0xE5, 0xEE, 0x61,
+    0x7E, 0x8C, 0xA8, 0xA3, 0x33, 0x69, 0x4B, 0x30, 0xD8, 0x92, 0x41, 0xB1, 0x58, 0x15, 0x35, 0xB2,
+    0x26, 0xA1, 0x50, 0xE3, 0x4C, 0xD9, 0x8B, 0xF2, 0x18, 0x78, 0x8C, 0x8E, 0x37, 0x2D, 0xF2, 0xA0,
+    0x4F, 0xAE, 0x14, 0x35, 0x0F, 0x01, 0x16, 0xE1, 0x74, 0xD7, 0x64, 0x72, 0x5E, 0xFA, 0xD6, 0x85,
+    0x38, 0x10, 0xEB, 0x27, 0x8F, 0xD6, 0xA1, 0xDC, 0xE8, 0xEB, 0xB4, 0xF5, 0x76, 0x0C, 0x6E, 0xC7,
+    0x7C, 0x46, 0x9B, 0xE6, 0xDE, 0x5F, 0xC5, 0x1E, 0x82, 0x7F, 0x09, 0x7E, 0xA5, 0xC0, 0xD6, 0xEE,
+    0xFA, 0xFD, 0x8A, 0x3C, 0x4E, 0xAA, 0xA0, 0xCB, 0xC4, 0xA2, 0x4E, 0xC4, 0x9E, 0x8E, 0xAE, 0xC0,
+    0x40, 0xB8, 0x44, 0xF0, 0xAB, 0x66, 0xF4, 0xF4, 0xE9, 0x2F, 0xC9, 0xDF, 0x15, 0x8A, 0x78, 0x96,
+    0x16, 0xC8, 0xCA, 0xE9, 0x53, 0x5F, 0xD0, 0xD9, 0x2B, 0x4E, 0x8B, 0xCA, 0x33, 0xAF, 0x4F, 0xCA,
+    0x91, 0xAA, 0x36, 0xDC, 0xBB, 0xF7, 0xEF, 0xEC, 0x2C, 0x3C, 0x08, 0x07, 0xE0, 0x2B, 0xF8, 0x4B,
+    0x6D, 0xCF, 0x40, 0x67, 0x3A, 0x8B, 0x89, 0xE1, 0x07, 0x3E, 0x1F, 0x61, 0x4E, 0xFF, 0xED, 0xCB,
+    0xAC, 0x3B, 0x7C, 0x89, 0x98, 0x25, 0xBD, 0xB0, 0xB7, 0x9E, 0xE7, 0x26, 0xCB, 0x82, 0xE7, 0x34,
+    0xDD, 0x47, 0x6F, 0xB1, 0x2C, 0x18, 0xCB, 0x66, 0xE1, 0x5B, 0xEE, 0x34, 0x47, 0x17, 0x6B, 0x1A,
+    0x17, 0x4B, 0x85, 0x3B, 0xD4, 0x22, 0xB2, 0x54, 0x78, 0xFE, 0xB0, 0x47, 0x6F, 0x9A, 0xC3, 0x7D,
+    0x51, 0xA3, 0x88, 0xFA, 0x44, 0xD6, 0x26, 0x2E, 0xA9, 0xEF, 0x5B, 0x1C, 0x25, 0xCD, 0x73, 0x4B,
+    0x3F, 0xF7, 0x28, 0x6F, 0x38, 0x22, 0x8D, 0xB3, 0x40, 0xF4, 0x8D, 0x47, 0xF4, 0xC5, 0xAD, 0xEA,
+    0x81, 0x8E, 0xF7, 0x96, 0x56, 0xF5, 0x33, 0xCE, 0x81, 0x83, 0xB8, 0x2F, 0x6E, 0x6C, 0xC8, 0x22,
+    0xE6, 0xBF, 0xED, 0x87, 0x83, 0x8F, 0xC8, 0x26, 0x68, 0xF4, 0x12, 0xDE, 0x38, 0x88, 0xD3, 0x05,
+    0xE5, 0x06, 0xDD, 0x8C, 0xCE, 0xE4, 0xE6, 0x97, 0xE3, 0x6F, 0xAF, 0xD1, 0xF0, 0x37, 0xE4, 0xDE,
+    0xD3, 0xB3, 0xFA, 0xEF, 0x3F, 0x9A, 0xE4, 0x08, 0x4B, 0x97, 0x02, 0x6F, 0x2E, 0x42, 0x61, 0xED,
+    0x80, 0x4B, 0x5A, 0x93, 0x96, 0xEE, 0x0E, 0x6E, 0x6D, 0xFF, 0xC2, 0x8F, 0xFE, 0x0E, 0x3E, 0xFB,
+    0x1A, 0xB4, 0xE7, 0xEB, 0x60, 0xE6, 0xCB, 0x63, 0x78, 0xCB, 0x24, 0x2F, 0x76, 0x63, 0x58, 0x82,
+    0xCE, 0x06, 0x9E, 0x45, 0x48, 0xF7, 0x64, 0x3C, 0x66, 0xD1, 0xE0, 0x6F, 0x5D, 0x9A, 0x53, 0xF6,
+    0x04, 0x54, 0xB0, 0xA2, 0xFD, 0x8D, 0xE9, 0x8C, 0x9A, 0x57, 0x16, 0x7E, 0xBE, 0x14, 0xD3, 0xB5,
+    0x2D, 0x20, 0xCC, 0x99, 0x46, 0x95, 0x21, 0xFC, 0x75, 0xFE, 0x73, 0x27, 0x26, 0x4E, 0x3D, 0x02,
+    0x33, 0xC9, 0x99, 0x52, 0x5B, 0xB6, 0x19, 0x6B, 0x3B, 0x71, 0x93, 0xF0, 0x69, 0x7C, 0xF6, 0x90,
+    0xF3, 0xA5, 0xFA, 0x4B, 0x7F, 0x6A, 0xE5, 0x94, 0x98, 0x96, 0xE1, 0x3B, 0xB0, 0x29, 0x5E, 0x81,
+    0x0E, 0x45, 0x91, 0x7C, 0x0F, 0x75, 0x7F, 0xEA, 0xD0, 0x1D, 0x9C, 0x43, 0x63, 0x78, 0x18, 0x73,
+    0xC3, 0xD0, 0x7D, 0x26, 0xC7, 0x9D, 0xFD, 0xBB, 0x22, 0xEA, 0x24, 0x60, 0x6A, 0x86, 0xB8, 0x14,
+    0xC9, 0xF1, 0xA5, 0xE2, 0xE9, 0x83, 0x3E, 0x6B, 0xF7, 0x7A, 0x35, 0x3E, 0x6E, 0x79, 0xFD, 0x2A,
+    0x9E, 0xCF, 0x54, 0xE3, 0xF3, 0xDE, 0x78, 0xD2, 0x8A, 0x3B, 0xCF, 0x90, 0xDF, 0x93, 0x1C, 0xBF,
+    0xAA, 0x96, 0x0F, 0xD9, 0x0C, 0x96, 0x4B, 0x80, 0x4E, 0x7D, 0xD6, 0x7A, 0x25, 0x85, 0x82, 0x68,
+    0xB0, 0x80, 0x63, 0x1F, 0xAA, 0x59, 0xA8, 0x50, 0x0C, 0xF8, 0xC7, 0xF9, 0x54, 0x58, 0x0F, 0x0B,
+    0x8D, 0x9F, 0x9F, 0xD9, 0x6F, 0x6B, 0x7E, 0xE9, 0xFE, 0x52, 0x87, 0x32, 0x3C, 0x21, 0xDF, 0xF2,
+    0xB0, 0x09, 0x53, 0x9A, 0x34, 0x92, 0xE3, 0x6E, 0xBD, 0xCF, 0xAC, 0xBC, 0xCD, 0x07, 0xFC, 0xDE,
+    0xB6, 0x12, 0x31, 0x9B, 0xA7, 0xF2, 0xF5, 0xD1, 0xE3, 0xFD, 0x95, 0x7E, 0x0C, 0xDB, 0x63, 0xBB,
+    0xDF, 0x7A, 0x01, 0xD9, 0x79, 0x9B, 0x15, 0x79, 0xC2, 0x66, 0x69, 0x89, 0xE8, 0xFB, 0xB6, 0x39,
+    0xCC, 0x0B, 0x96, 0xE2, 0x9D, 0x4F, 0x66, 0x5B, 0x4C, 0x60, 0x33, 0x71, 0xC7, 0xCB, 0xB3, 0x3C,
+    0x40, 0x1C, 0x47, 0x71, 0x70, 0x69, 0x6C, 0x2D, 0xD2, 0xD8, 0xFA, 0xD9, 0x7E, 0x3C, 0x31, 0xA6,
+    0xB1, 0x7D, 0xBB, 0x1D, 0xDD, 0x4B, 0x61, 0x7E, 0x6B, 0xF3, 0xE1, 0xFC, 0x4C, 0x5F, 0x39, 0x67,
+    0xCF, 0x59, 0xFF, 0x1C, 0xF3, 0x51, 0x5E, 0x7F, 0xAC, 0x2B, 0x8F, 0xE9, 0xBF, 0xB1, 0x87, 0xA9,
+    0x79, 0x06, 0xD8, 0xDE, 0x28, 0x65, 0xEF, 0xFF, 0x03, 0xD5, 0x5A, 0x3D, 0x6C, 0xDD, 0xD6, 0x15,
+    0x3E, 0x24, 0x25, 0xD1, 0x11, 0x81, 0x32, 0x08, 0x94, 0x21, 0x31, 0x12, 0x76, 0xC8, 0x10, 0xCB,
+    0x88, 0xB9, 0x16, 0x89, 0x64, 0x32, 0x2D, 0x50, 0x0F, 0x5D, 0x34, 0x38, 0xE8, 0xE8, 0x0E, 0x1D,
+    0x0A, 0x2F, 0x5A, 0x3B, 0xD8, 0x22, 0xEB, 0x02, 0x31, 0xD0, 0xC5, 0xDA, 0xBA, 0x7A, 0xE8, 0x60,
+    0x6B, 0xA8, 0x33, 0xBA, 0x85, 0x13, 0x12, 0x09, 0xD0, 0x02, 0xCD, 0x50, 0xA2, 0x40, 0xD1, 0x31,
+    0x04, 0xEA, 0xA2, 0x68, 0x3C, 0x98, 0x6D, 0x68, 0x94, 0x92, 0x49, 0xDE, 0x9E, 0xEF, 0x5C, 0xF2,
+    0x51, 0x2F, 0xFE, 0x89, 0xE2, 0xBE, 0xF7, 0x44, 0x51, 0xEF, 0x1D, 0xBD, 0xF7, 0xC8, 0x7B, 0xEE,
+    0x39, 0xDF, 0x3D, 0xF7, 0xFC, 0xDC, 0x7B, 0x89, 0x82, 0x94, 0xF8, 0x8A, 0x72, 0xD0, 0xA4, 0x00,
+    0x55, 0x25, 0x13, 0xE3, 0x41, 0xC5, 0xD4, 0xFA, 0x5B, 0x0D, 0xFA, 0x59, 0xC3, 0xD4, 0xB9, 0xA6,
+    0x98, 0xBA, 0xEF, 0x83, 0x7A, 0xA4, 0x42, 0xA2, 0x73, 0x94, 0x70, 0xE3, 0x4D, 0x8A, 0x98, 0xEE,
+    0xEC, 0x25, 0xCC, 0x42, 0x29, 0xC5, 0x2C, 0x4A, 0xF2, 0x0A, 0x32, 0x0B, 0x72, 0x2B, 0xB2, 0x72,
+    0x72, 0x6A, 0xB2, 0x33, 0xB2, 0x1B, 0x72, 0x53, 0xB2, 0x15, 0x25, 0xFB, 0xB4, 0xAD, 0x72, 0xD5,
+    0x52, 0xA2, 0xA4, 0x37, 0x5C, 0x4B, 0x42, 0xA3, 0x58, 0x7A, 0x17, 0x79, 0x12, 0xA1, 0x7E, 0xA8,
+    0xEF, 0x1B, 0xDC, 0xC8, 0x55, 0x2A, 0xF6, 0xF2, 0x28, 0xF5, 0xB2, 0x20, 0xB7, 0xD3, 0x80, 0x3B,
+    0xC3, 0x3B, 0xCA, 0x57, 0x94, 0xCA, 0xFD, 0xFD, 0x28, 0x8F, 0xF8, 0xF7, 0x24, 0x1D, 0xDE, 0x51,
+    0xA6, 0x8A, 0x40, 0x7D, 0xB1, 0xEF, 0xB4, 0x6E, 0x4B, 0x5B, 0x60, 0x02, 0x86, 0x19, 0x37, 0x2B,
+    0x74, 0x53, 0x0F, 0xDD, 0x6D, 0xEF, 0x82, 0xFF, 0x63, 0x68, 0x4C, 0xBB, 0x95, 0x74, 0x26, 0xD4,
+    0x16, 0xD9, 0x5C, 0xE9, 0xDF, 0xA5, 0xE1, 0x3A, 0x76, 0xB4, 0x20, 0xF9, 0x01, 0x77, 0xB6, 0x75,
+    0x8F, 0xBF, 0x70, 0x77, 0x36, 0x7F, 0x77, 0x98, 0xBB, 0x3D, 0x43, 0xA4, 0xF8, 0xFA, 0xD9, 0x04,
+    0x8A, 0xF5, 0x6B, 0x50, 0x36, 0xF9, 0x0F, 0xF7, 0x61, 0x3E, 0xC2, 0x0F, 0x76, 0x76, 0x9E, 0xE9,
+    0x2A, 0xAD, 0x8C, 0x06, 0x95, 0x75, 0x7E, 0x5F, 0x21, 0x2F, 0x2F, 0x28, 0xD8, 0x8F, 0xA9, 0xDE,
+    0xE1, 0x16, 0x6E, 0x6C, 0x84, 0x46, 0x38, 0x2B, 0x44, 0x0C, 0xB1, 0x12, 0x43, 0xAC, 0x84, 0xAE,
+    0xAC, 0xC3, 0x70, 0x5E, 0x12, 0x3D, 0xCD, 0xFD, 0x11, 0x22, 0x72, 0x86, 0x84, 0x17, 0x04, 0xBB,
+    0x8E, 0xEE, 0x6E, 0x80, 0x77, 0x00, 0x73, 0xAF, 0xB8, 0x21, 0xEB, 0xD3, 0x8D, 0x31, 0x6D, 0xB7,
+    0x21, 0x59, 0x0C, 0x01, 0xD9, 0x15, 0xB3, 0xB6, 0x4B, 0xE6, 0x6C, 0x14, 0x2E, 0x9A, 0x08, 0xF1,
+    0xF8, 0x6B, 0xA2, 0x2A, 0x72, 0xDA, 0x4B, 0x15, 0x79, 0xB8, 0xEB, 0x17, 0x53, 0xC4, 0x2B, 0x83,
+    0x9A, 0xB1, 0xFD, 0x6F, 0x1B, 0x9A, 0xEA, 0x97, 0x2A, 0xA6, 0x35, 0xCD, 0xD6, 0x11, 0xB4, 0xDE,
+    0xD0, 0xF6, 0x5A, 0x0C, 0x26, 0xF4, 0xD5, 0x78, 0x4D, 0xC8, 0xE6, 0xBE, 0x56, 0xAF, 0x30, 0xC7,
+    0x0D, 0x6D, 0x46, 0xD5, 0x5C, 0xCC, 0x88, 0x8C, 0xFD, 0x15, 0x66, 0xE6, 0xA8, 0x87, 0xD0, 0xE0,
+    0x52, 0x0B, 0xCF, 0x67, 0xFC, 0x06, 0xDC, 0xC5, 0xA4, 0xB4, 0xDE, 0xC6, 0x48, 0x27, 0x19, 0xB7,
+    0xF9, 0x7E, 0xCA, 0xD6, 0x92, 0xDA, 0xD7, 0x15, 0xFB, 0x52, 0x1E, 0x6B, 0x0F, 0x00, 0x70, 0xE7,
+    0xF3, 0x40, 0x8A, 0x5E, 0x0D, 0x07, 0x6D, 0x45, 0x4F, 0xAB, 0x80, 0x86, 0x4E, 0xEA, 0x33, 0x5D,
+    0xE6, 0xBF, 0xF1, 0xE0, 0x32, 0xB9, 0x94, 0xA8, 0xAF, 0xE2, 0x09, 0xA5, 0x1D, 0x90, 0x65, 0x56,
+    0xC8, 0x67, 0x91, 0x22, 0x16, 0xA5, 0x8E, 0xE6, 0x60, 0x55, 0x4F, 0x0B, 0x6C, 0x1A, 0x45, 0x53,
+    0x24, 0xB4, 0x80, 0x90, 0xB1, 0xBA, 0x24, 0x1F, 0x37, 0x41, 0x55, 0x2D, 0xF2, 0x16, 0x03, 0xD2,
+    0x63, 0xC0, 0x92, 0xA7, 0x82, 0x51, 0x88, 0xB8, 0xE6, 0x87, 0x2F, 0x91, 0xC5, 0x53, 0xC0, 0x80,
+    0xA0, 0x10, 0x64, 0x79, 0x96, 0xE1, 0x6D, 0x6B, 0x88, 0xF3, 0xB4, 0x49, 0x27, 0x02, 0x1B, 0x78,
+    0x09, 0x44, 0xFC, 0x73, 0x34, 0x67, 0x6C, 0x5E, 0x15, 0x5E, 0xEF, 0x89, 0xAE, 0xAF, 0x64, 0x12,
+    0x44, 0xC4, 0x7A, 0xBE, 0x33, 0x76, 0x84, 0x5E, 0x67, 0x2E, 0xEF, 0xB1, 0xC0, 0x46, 0x2E, 0x22,
+    0x9B, 0xBF, 0x9A, 0x27, 0x4A, 0x77, 0x57, 0x05, 0x87, 0xDF, 0x02, 0x9E, 0xCF, 0x6B, 0x99, 0x83,
+    0x37, 0x85, 0x6A, 0x94, 0x36, 0x30, 0xF5, 0x0E, 0xEA, 0x01, 0x87, 0xF1, 0xCC, 0x31, 0xBE, 0x1A,
+    0x87, 0x4C, 0xA5, 0xC8, 0xFA, 0x63, 0x2D, 0x73, 0xC1, 0x08, 0x97, 0xC8, 0xCC, 0xDE, 0x61, 0x5E,
+    0xFC, 0x3D, 0x9A, 0x31, 0x52, 0x1A, 0x11, 0x3B, 0x7E, 0x13, 0x5A, 0xFD, 0xE3, 0x63, 0xE0, 0xA2,
+    0xAD, 0x27, 0x11, 0xFD, 0x97, 0x69, 0x5C, 0x7E, 0xFC, 0x79, 0x85, 0x88, 0xC1, 0xD2, 0xDA, 0xA9,
+    0x4B, 0xD6, 0xA3, 0x1D, 0x6D, 0x55, 0xB3, 0xC7, 0xEA, 0x09, 0x3F, 0x1E, 0xB0, 0x1E, 0xA9, 0x0F,
+    0x62, 0x2A, 0x8E, 0x7D, 0x06, 0x8F, 0xDA, 0x84, 0x18, 0xB1, 0xA1, 0x24, 0xD2, 0x0C, 0x84, 0xA5,
+    0xEA, 0xC8, 0xD7, 0x6E, 0x74, 0x64, 0x0B, 0xA4, 0x10, 0xC2, 0xFC, 0xCC, 0xE2, 0x2C, 0x60, 0x0A,
+    0x34, 0x56, 0x72, 0xBD, 0x8C, 0x07, 0x5B, 0xB1, 0xED, 0x9E, 0xD0, 0xC7, 0xDD, 0xBD, 0xA8, 0x42,
+    0xB2, 0x18, 0xBA, 0x65, 0x90, 0xFA, 0xB9, 0x57, 0x04, 0xA9, 0x5B, 0x44, 0xA9, 0x5B, 0x26, 0x7F,
+    0xBD, 0x54, 0x26, 0x4A, 0x95, 0xC9, 0x97, 0x7B, 0x37, 0x01, 0x16, 0xC6, 0x20, 0xD0, 0x5A, 0xDC,
+    0x74, 0x2B, 0x33, 0xB7, 0x59, 0x78, 0x4A, 0x98, 0xA7, 0x11, 0x6A, 0x15, 0x79, 0x48, 0x38, 0x7D,
+    0xD4, 0x6F, 0x27, 0xEB, 0xFA, 0xB3, 0x1F, 0x72, 0x33, 0xCB, 0xCE, 0x24, 0xF5, 0x01, 0x0E, 0xB1,
+    0xE4, 0xF4, 0x7C, 0x7D, 0xAF, 0x37, 0x8F, 0x85, 0x42, 0x01, 0xFC, 0x7F, 0x5F, 0x1F, 0x2A, 0xB3,
+    0x8A, 0xAE, 0xCC, 0x0A, 0x67, 0x0B, 0x06, 0xF9, 0x39, 0xCF, 0xBC, 0xA8, 0xE5, 0x6E, 0x0E, 0x38,
+    0xD5, 0xA6, 0xC2, 0x2F, 0x3A, 0x4B, 0x58, 0xAC, 0xCE, 0x2F, 0xE3, 0x09, 0x23, 0xB7, 0xD4, 0x83,
+    0xCC, 0x79, 0xA8, 0x52, 0xD7, 0x44, 0x9B, 0xB5, 0xD9, 0xE9, 0x4A, 0xB4, 0x82, 0x11, 0x75, 0x63,
+    0x32, 0x6F, 0xBF, 0x89, 0x14, 0xF8, 0x2D, 0x36, 0x84, 0x1B, 0xDC, 0xE2, 0xAA, 0xC5, 0x0A, 0xFF,
+    0x84, 0xFF, 0x16, 0x3E, 0xC8, 0x4F, 0xA9, 0x1A, 0xBD, 0x49, 0x62, 0x36, 0x0B, 0xA5, 0x5F, 0x97,
+    0x3A, 0x0C, 0xEC, 0xAC, 0x4F, 0x6F, 0x33, 0xFD, 0xB5, 0x38, 0xAC, 0x89, 0xD2, 0x3F, 0xE5, 0xBF,
+    0xC5, 0x2A, 0x7D, 0xA6, 0xAB, 0x0B, 0xA5, 0x2C, 0xBC, 0xD1, 0xEA, 0xA2, 0x10, 0x35, 0x61, 0x5F,
+    0x12, 0x7A, 0x2D, 0x3C, 0x67, 0x66, 0x35, 0x6E, 0xE1, 0x54, 0x76, 0xED, 0x16, 0x56, 0xED, 0x15,
+    0x56, 0xE3, 0x3F, 0xFA, 0x71, 0xC3, 0xF2, 0x35, 0xFE, 0xC1, 0xDE, 0x2D, 0xD8, 0x27, 0x66, 0xB0,
+    0xCB, 0xBE, 0xD9, 0xAD, 0xE9, 0x6D, 0xAB, 0xA5, 0xBB, 0x06, 0x00, 0xF5, 0x91, 0xF1, 0x0A, 0x9B,
+    0xDF, 0x81, 0x7C, 0x01, 0xBD, 0x79, 0xC6, 0x98, 0xB7, 0xCF, 0x61, 0xB8, 0xDF, 0x3E, 0xEE, 0xE1,
+    0x9E, 0xAA, 0xF0, 0xF2, 0xA1, 0xC2, 0x9B, 0xED, 0x90, 0x93, 0xB7, 0xFB, 0x16, 0xA6, 0x33, 0x77,
+    0xF6, 0x08, 0xBD, 0x6E, 0x21, 0x2B, 0x31, 0x31, 0xF8, 0xF6, 0xF4, 0xE0, 0x2F, 0x06, 0x02, 0xEB,
+    0xEB, 0x6E, 0x6D, 0xAA, 0x84, 0xBB, 0xF8, 0xCC, 0x12, 0x6E, 0x36, 0xEE, 0xED, 0x62, 0x1F, 0x42,
+    0x5C, 0xC4, 0x68, 0xFF, 0x47, 0xFC, 0xE0, 0x3D, 0x14, 0x24, 0x5B, 0x12, 0x66, 0x16, 0xEE, 0xD2,
+    0x9F, 0x1D, 0xDD, 0x9E, 0x53, 0xA0, 0xCD, 0x36, 0xEA, 0x95, 0x93, 0xA8, 0xC7, 0x62, 0x70, 0xC8,
+    0xB3, 0xAC, 0x0C, 0xE1, 0x8E, 0x83, 0xDD, 0x46, 0x17, 0xE8, 0x02, 0x55, 0xFB, 0xAA, 0x32, 0x55,
+    0x08, 0x08, 0x8E, 0xFC, 0xE2, 0xE7, 0xCF, 0xAA, 0xFB, 0x81, 0x64, 0x56, 0x4E, 0x43, 0x5E, 0x42,
+    0xA7, 0xD8, 0xEF, 0x70, 0xA5, 0xDC, 0x48, 0x41, 0x25, 0x69, 0xFC, 0xE5, 0x5B, 0x14, 0x35, 0xB8,
+    0x6B, 0x3D, 0xF7, 0x65, 0xB7, 0x9C, 0x15, 0xED, 0x26, 0x00, 0xEE, 0xFF, 0x95, 0x04, 0x78, 0xCB,
+    0x2F, 0xFC, 0x02, 0xCE, 0x5B, 0x64, 0xD5, 0x48, 0xBF, 0xF8, 0xA5, 0x57, 0x3D, 0x5E, 0x40, 0x2A,
+    0xDD, 0x6A, 0xC2, 0xC7, 0xAC, 0xFA, 0xCC, 0xCD, 0x91, 0x64, 0x31, 0xE2, 0xA1, 0xE2, 0x1E, 0x11,
+    0xBE, 0xED, 0x1A, 0x3E, 0x8A, 0x5F, 0xFC, 0x81, 0x41, 0x67, 0x26, 0x3C, 0x36, 0x96, 0xDC, 0xE2,
+    0x07, 0xA2, 0x81, 0x86, 0x4F, 0xD0, 0xEE, 0x19, 0xFD, 0x3C, 0xDA, 0xB6, 0x1D, 0x1F, 0x47, 0x78,
+    0x9A, 0x2D, 0x47, 0x6D, 0xCE, 0x0C, 0xBF, 0x84, 0xC7, 0x73, 0x54, 0x35, 0x94, 0x4D, 0x3A, 0x7D,
+    0x4C, 0xC2, 0x21, 0x7D, 0xD4, 0x74, 0xA7, 0x97, 0x72, 0x7B, 0x1F, 0xD6, 0xC4, 0xF6, 0xE3, 0x15,
+    0x7E, 0xEE, 0x54, 0x41, 0x6A, 0xD7, 0x51, 0x6A, 0x35, 0xC9, 0xF0, 0x6E, 0xF1, 0x1F, 0xBF, 0xE1,
+    0x5E, 0x90, 0x39, 0x95, 0x5B, 0xB8, 0x85, 0xDD, 0x26, 0xD9, 0xA1, 0x50, 0xCA, 0x33, 0xAA, 0xB3,
+    0x26, 0x8F, 0xDF, 0x4E, 0xDE, 0xF7, 0x69, 0x2A, 0x7C, 0x34, 0xAE, 0x15, 0x43, 0xE9, 0x7F, 0x5A,
+    0xC6, 0xFE, 0x9C, 0x34, 0x7A, 0x67, 0xC8, 0xB5, 0x47, 0x81, 0x16, 0x69, 0x1D, 0xCE, 0x73, 0x4E,
+    0xFF, 0x5D, 0xAC, 0x76, 0x5D, 0x65, 0xA1, 0x4B, 0xBD, 0x5A, 0x61, 0xC5, 0x33, 0xC5, 0xEB, 0xE6,
+    0x04, 0x90, 0xCB, 0x17, 0x52, 0x38, 0x8B, 0x3F, 0xC1, 0x88, 0xBE, 0x2A, 0x24, 0x23, 0x41, 0x86,
+    0xF7, 0x1A, 0xFF, 0x8D, 0x0B, 0x9B, 0x75, 0x01, 0xC4, 0x2B, 0x38, 0x3B, 0x69, 0x74, 0xA8, 0x2A,
+    0x0E, 0x79, 0xA5, 0x19, 0xE0, 0x22, 0xF9, 0x18, 0xCA, 0x22, 0x59, 0xA5, 0xBD, 0x0C, 0xBE, 0x67,
+    0x54, 0x36, 0x6E, 0x5C, 0xD6, 0x87, 0x95, 0xED, 0xCF, 0xEA, 0xA9, 0x95, 0xED, 0x7A, 0x7A, 0x65,
+    0xFB, 0x74, 0x1B, 0x22, 0x93, 0x81, 0x50, 0x60, 0x5A, 0x31, 0x43, 0x17, 0x91, 0x81, 0xBD, 0xB0,
+    0x0A, 0xFD, 0x29, 0x12, 0xCB, 0x27, 0xB9, 0x21, 0x8F, 0xB8, 0x25, 0x3F, 0x6C, 0xD5, 0x16, 0xE2,
+    0xCC, 0x1D, 0x38, 0x6C, 0x59, 0xC9, 0xD3, 0x8C, 0x4F, 0x0B, 0xFA, 0xEF, 0xCA, 0x9C, 0xC2, 0x3A,
+    0x43, 0x6F, 0x4E, 0x7F, 0x18, 0xBB, 0x39, 0x21, 0xFB, 0x59, 0xE9, 0xB2, 0x1F, 0x98, 0x54, 0x3D,
+    0x17, 0x93, 0xE2, 0x6E, 0x56, 0x25, 0xDC, 0x7F, 0x02, 0x6F, 0xB3, 0x8D, 0x11, 0x5A, 0x33, 0x65,
+    0x33, 0x40, 0xCC, 0xCB, 0x10, 0x67, 0x68, 0xFD, 0xFD, 0xD8, 0x71, 0xB2, 0x9E, 0xE7, 0x92, 0x24,
+    0x45, 0x7A, 0x8C, 0x14, 0x29, 0x94, 0x55, 0x6E, 0xB8, 0xDA, 0xA0, 0x96, 0x14, 0xC9, 0xCC, 0x67,
+    0x8C, 0x57, 0xD7, 0xAB, 0xE0, 0xA2, 0x9D, 0xB7, 0xF3, 0x97, 0x52, 0x8A, 0x86, 0xAB, 0x12, 0x4D,
+    0x96, 0xE8, 0xE4, 0x84, 0xB7, 0xA9, 0x24, 0x2A, 0x98, 0x4E, 0xA2, 0xE6, 0x16, 0xF6, 0x8C, 0x0F,
+    0xC4, 0x89, 0x35, 0x72, 0x53, 0xB6, 0xE7, 0x3C, 0x91, 0xE8, 0x7C, 0x9F, 0xEF, 0xC9, 0xBC, 0x35,
+    0x6A, 0xE0, 0xC7, 0x7A, 0x01, 0xBF, 0x16, 0xAA, 0x67, 0x9B, 0x82, 0xDF, 0x06, 0xF4, 0x6E, 0x4A,
+    0x60, 0xA0, 0xD2, 0x17, 0xC7, 0xAF, 0x39, 0x22, 0x7E, 0xB2, 0x0A, 0x88, 0x4C, 0x51, 0x76, 0x0A,
+    0x4C, 0xBD, 0xCF, 0x43, 0x21, 0xD6, 0x95, 0x0A, 0xAD, 0xC0, 0xF6, 0xBE, 0x5D, 0x32, 0x52, 0x9F,
+    0x96, 0x0C, 0xD5, 0xBF, 0x81, 0xD5, 0xE3, 0x94, 0x01, 0x61, 0x49, 0x52, 0xF6, 0x47, 0x80, 0x68,
+    0x42, 0x5A, 0xFD, 0x09, 0x90, 0x11, 0x30, 0x23, 0x80, 0x46, 0x40, 0x8D, 0x04, 0x36, 0xC1, 0xAD,
+    0x33, 0x32, 0x01, 0xC1, 0x93, 0x7C, 0xC0, 0x96, 0xC4, 0x8C, 0x5A, 0x1A, 0xB6, 0xD7, 0x8D, 0x51,
+    0xA1, 0xA4, 0xAB, 0x86, 0x66, 0xB2, 0x9D, 0x12, 0xC4, 0x3D, 0x4A, 0xB4, 0x35, 0x57, 0x94, 0x8E,
+    0x94, 0x42, 0xBD, 0x31, 0x32, 0x8B, 0xEA, 0x73, 0x28, 0x49, 0xA2, 0x74, 0x16, 0x85, 0x34, 0x4A,
+    0xF2, 0x28, 0x24, 0x52, 0x21, 0x67, 0x52, 0xF3, 0x45, 0x4D, 0x08, 0x4F, 0x57, 0x08, 0xA2, 0xEE,
+    0x40, 0x92, 0x04, 0xA2, 0xFC, 0xDC, 0xD1, 0x99, 0x79, 0x38, 0x2A, 0xBC, 0xA4, 0x00, 0x54, 0xEF,
+    0xE7, 0xDC, 0xEC, 0x9F, 0x19, 0x61, 0xA1, 0x8B, 0x5C, 0x0E, 0xF9, 0xAC, 0xC3, 0xDA, 0x7C, 0x51,
+    0xA2, 0x91, 0xD9, 0xCD, 0x37, 0x15, 0x2A, 0x61, 0x7F, 0x04, 0x66, 0x9E, 0x88, 0x88, 0x3B, 0xD7,
+    0xE6, 0x0B, 0x87, 0x2E, 0x1E, 0x3D, 0x52, 0xA5, 0xAB, 0xB2, 0x6D, 0x55, 0x3A, 0x6A, 0x17, 0x05,
+    0x7A, 0x2D, 0x65, 0xFA, 0xDD, 0x99, 0x51, 0xAC, 0x6B, 0x96, 0x6C, 0x03, 0x21, 0xEA, 0x62, 0x95,
+    0xE1, 0xF4, 0x4C, 0xA0, 0x00, 0x8F, 0xAD, 0x9A, 0x61, 0x43, 0xC2, 0x78, 0x62, 0x43, 0x22, 0x10,
+    0x8A, 0x4C, 0x73, 0xFD, 0xD6, 0xEA, 0x5E, 0x18, 0xD4, 0xAE, 0x8A, 0x19, 0x64, 0x15, 0x5B, 0x47,
+    0x20, 0xCD, 0x84, 0xB4, 0x06, 0x13, 0x75, 0x41, 0xC5, 0x86, 0x6A, 0x93, 0xFB, 0x14, 0x55, 0x41,
+    0x35, 0x59, 0xEC, 0xED, 0xC3, 0x02, 0x16, 0x4B, 0x0C, 0x10, 0xFA, 0x44, 0xA6, 0xF7, 0xB7, 0x3A,
+    0xA1, 0x34, 0x0E, 0xFC, 0x44, 0x3E, 0x8C, 0xB5, 0x7B, 0x87, 0xE5, 0x3B, 0xE5, 0x76, 0x4B, 0xBF,
+    0x9D, 0x46, 0x22, 0xF8, 0x47, 0xDD, 0x63, 0xF3, 0x82, 0xF3, 0x03, 0x3D, 0x90, 0xAA, 0x5F, 0x2F,
+    0x10, 0x98, 0x74, 0xB1, 0xE3, 0x69, 0x03, 0x5C, 0x1B, 0x16, 0xB8, 0x01, 0x9B, 0x57, 0x26, 0xF1,
+    0xB6, 0xBA, 0xCF, 0xD9, 0x49, 0x0C, 0x55, 0x2B, 0x37, 0x14, 0x8D, 0x5D, 0xAD, 0xF8, 0xA6, 0xFC,
+    0x4B, 0x64, 0xA2, 0x61, 0x2D, 0x43, 0xA3, 0xF1, 0xC2, 0xFF, 0x34, 0x8C, 0x32, 0xCC, 0x40, 0x43,
+    0x03, 0x09, 0x24, 0x53, 0x59, 0x2A, 0xD4, 0xE1, 0xB9, 0xC3, 0x72, 0xF9, 0xE2, 0x90, 0xDD, 0x04,
+    0x99, 0x96, 0xB7, 0xB3, 0x82, 0x10, 0x2F, 0x6D, 0x08, 0x4E, 0x09, 0x24, 0x2F, 0x54, 0x80, 0xF2,
+    0x17, 0xA5, 0x53, 0x33, 0x32, 0x05, 0xE0, 0xBA, 0x96, 0x81, 0xAA, 0x10, 0xF4, 0x3E, 0x09, 0x80,
+    0x4F, 0xA3, 0xCD, 0x21, 0x0A, 0x54, 0x49, 0x60, 0x25, 0x8D, 0xAB, 0x06, 0xB6, 0x43, 0x56, 0x8B,
+    0xD3, 0x27, 0x12, 0x1D, 0xC0, 0x3A, 0x4C, 0xEB, 0xFD, 0x1C, 0xED, 0x3F, 0x4E, 0x02, 0xB4, 0xDA,
+    0x46, 0xF4, 0x49, 0x0D, 0x8D, 0xAC, 0x23, 0x58, 0x1A, 0x1A, 0xDA, 0xB5, 0x45, 0x43, 0xDB, 0xCD,
+    0xF5, 0x6E, 0xB2, 0xF7, 0xB3, 0xBD, 0x3B, 0xA8, 0xA0, 0x65, 0xE9, 0x26, 0x3C, 0x66, 0xFC, 0x89,
+    0x30, 0xDE, 0xC1, 0x15, 0x68, 0x5F, 0xD0, 0x39, 0x03, 0xED, 0x0D, 0xB4, 0x3B, 0x00, 0x93, 0x10,
+    0x0E, 0x61, 0xD1, 0x68, 0xEB, 0x55, 0x68, 0xB3, 0x35, 0x65, 0xD7, 0x51, 0x3D, 0x48, 0x45, 0x48,
+    0x31, 0x07, 0xBD, 0xFF, 0x25, 0xCF, 0x9C, 0x04, 0x98, 0xB5, 0x42, 0xB2, 0x95, 0xA8, 0xF7, 0x12,
+    0xF5, 0x66, 0xA2, 0xEC, 0x26, 0xCA, 0xFA, 0xF3, 0xA2, 0xA1, 0xA5, 0x13, 0x62, 0x9E, 0xC6, 0xE1,
+    0xA3, 0x07, 0x5D, 0xA8, 0xEF, 0x62, 0x7D, 0x77, 0x8C, 0x6A, 0x92, 0xE3, 0x1E, 0x03, 0x84, 0x7D,
+    0x0D, 0x24, 0x29, 0x41, 0x97, 0x13, 0xE8, 0x39, 0xB3, 0x2C, 0xD9, 0xA4, 0x9C, 0xD2, 0xEC, 0x83,
+    0x5B, 0x72, 0x48, 0xE8, 0x21, 0xC5, 0x52, 0x2A, 0x8F, 0x14, 0x25, 0x2A, 0xDF, 0x56, 0xE4, 0xB6,
+    0x64, 0x95, 0x98, 0x8C, 0x96, 0x40, 0xCD, 0xE5, 0x01, 0xB3, 0x74, 0x62, 0xE4, 0x7E, 0x48, 0x20,
+    0xA2, 0x0C, 0x35, 0x4E, 0x50, 0x6C, 0x08, 0xE7, 0xBB, 0x50, 0xB6, 0x2E, 0x64, 0x9F, 0x24, 0x17,
+    0x19, 0xD2, 0xC1, 0x59, 0x3E, 0x83, 0xEA, 0x43, 0x6F, 0x67, 0xD5, 0xBF, 0x04, 0xEF, 0xB6, 0xF7,
+    0xB0, 0x22, 0xB7, 0x40, 0x2C, 0x09, 0x9F, 0x3E, 0x46, 0xDB, 0x99, 0x07, 0xED, 0xED, 0xFD, 0x70,
+    0x2F, 0x56, 0x8C, 0x42, 0xEA, 0x55, 0x3C, 0xF8, 0xAC, 0xD2, 0x3D, 0x64, 0xAF, 0x25, 0x50, 0x2A,
+    0x30, 0x39, 0x73, 0x66, 0x6B, 0xF1, 0x0C, 0x55, 0x3F, 0xC0, 0x36, 0xCB, 0xE7, 0xDC, 0x43, 0xF0,
+    0x67, 0x18, 0x3B, 0xCE, 0x50, 0x7A, 0xC8, 0x39, 0x5C, 0xE8, 0x6F, 0xCB, 0x21, 0x11, 0x7D, 0x4E,
+    0x90, 0xF4, 0xA9, 0x68, 0x1C, 0xF3, 0xD0, 0x07, 0x09, 0x24, 0x48, 0x05, 0x72, 0x98, 0x39, 0x3C,
+    0x7E, 0x4C, 0xA6, 0x8E, 0x9A, 0x1C, 0x3A, 0x32, 0x48, 0xC3, 0x91, 0xC1, 0x79, 0x81, 0xC2, 0x1E,
+    0xCF, 0xC5, 0xC2, 0xA9, 0x7F, 0xBD, 0x05, 0x83, 0x96, 0x41, 0xE1, 0x58, 0xB7, 0xAE, 0xAD, 0x25,
+    0x41, 0xF7, 0xE6, 0xE3, 0x6F, 0xAA, 0x7F, 0xC7, 0x61, 0x58, 0x3A, 0xDB, 0x80, 0xA6, 0x1E, 0x0C,
+    0xFF, 0x94, 0xE4, 0x74, 0xBE, 0x9C, 0x6E, 0xEA, 0xD7, 0x66, 0x29, 0x3B, 0x3E, 0x13, 0x3B, 0x42,
+    0x5D, 0x3C, 0x0E, 0x1C, 0x97, 0xF4, 0xC8, 0x33, 0x0C, 0xEA, 0x80, 0x3B, 0x7D, 0xC0, 0xAC, 0xAC,
+    0x54, 0x2C, 0x61, 0xE9, 0xF8, 0xD0, 0xFB, 0x1F, 0x9D, 0x58, 0x41, 0x6F, 0xDD, 0xC6, 0x11, 0x1E,
+    0x92, 0x92, 0x59, 0x88, 0x35, 0xD8, 0x83, 0x7C, 0x50, 0xDC, 0x96, 0x39, 0x1A, 0x82, 0x2D, 0xF6,
+    0x50, 0x14, 0x3A, 0x48, 0xE2, 0xC6, 0xBA, 0xB5, 0x87, 0xEA, 0x10, 0x5D, 0xDA, 0x43, 0x72, 0xE9,
+    0xC5, 0x28, 0x90, 0x5C, 0x02, 0xF8, 0xA0, 0x67, 0x32, 0xFE, 0x03, 0xD5, 0x0F, 0xE8, 0x41, 0x05,
+    0x5A, 0x20, 0x16, 0xD0, 0xD4, 0x07, 0x03, 0x15, 0x02, 0x5B, 0x5C, 0x49, 0x87, 0x1C, 0x7A, 0x08,
+    0x1D, 0xA3, 0xF0, 0xB1, 0x6C, 0x6B, 0xC0, 0x40, 0x02, 0x34, 0xDB, 0x94, 0x28, 0x28, 0x9B, 0xEF,
+    0x6D, 0xBE, 0x19, 0x92, 0x4F, 0xEF, 0x29, 0xB1, 0x2C, 0x7B, 0xB9, 0xBB, 0xDC, 0xC7, 0x9D, 0xDD,
+    0x9D, 0xF9, 0xF6, 0x9B, 0xD9, 0x95, 0x68, 0xE7, 0x3B, 0x13, 0xD1, 0x4F, 0xBE, 0xFF, 0xC3, 0x9F,
+    0xFA, 0x85, 0x5F, 0x44, 0xD5, 0xCF, 0x7E, 0xEF, 0x66, 0x2F, 0x7F, 0x88, 0x9C, 0x8C, 0xCA, 0x1B,
+    0x7B, 0x9F, 0xEC, 0xED, 0x94, 0x7F, 0xC8, 0x76, 0xE8, 0xE5, 0x0F, 0x91, 0xAB, 0x02, 0x5A, 0xBA,
+    0xB3, 0xF4, 0x71, 0x30, 0xE7, 0xFE, 0x9C, 0xE6, 0x5E, 0xFE, 0x5C, 0xDA, 0xA4, 0xD4, 0x2A, 0xE4,
+    0xC5, 0x5D, 0x9A, 0x6C, 0xDF, 0xD8, 0xDD, 0xDD, 0xC9, 0xAD, 0x35, 0x9B, 0x9B, 0x9B, 0x1B, 0x8B,
+    0xBB, 0x92, 0x76, 0x12, 0x2B, 0xA9, 0xA2, 0x71, 0xBA, 0x19, 0xBE, 0xEE, 0x73, 0x69, 0x73, 0x53,
+    0x61, 0x3E, 0xCD, 0x6F, 0x9E, 0x89, 0xDB, 0x5C, 0xE8, 0x5D, 0xAF, 0x0C, 0xD5, 0x2A, 0xAD, 0x51,
+    0xAA, 0xD3, 0x22, 0x29, 0x22, 0x4D, 0x34, 0x4B, 0x89, 0x4E, 0x8A, 0xA4, 0x8C, 0x0A, 0x4F, 0xFB,
+    0x3A, 0xA6, 0x3D, 0x52, 0x14, 0x64, 0x49, 0x91, 0x16, 0xA9, 0x4E, 0x68, 0x95, 0x22, 0xF2, 0x4B,
+    0xBA, 0xCB, 0x72, 0x1B, 0xC9, 0x51, 0x93, 0x3C, 0x1A, 0x26, 0xFF, 0x1E, 0x45, 0x0F, 0x47, 0x9E,
+    0x5E, 0xF5, 0xF5, 0x56, 0xEC, 0x98, 0xBD, 0x20, 0xC3, 0x1A, 0x41, 0xB6, 0x87, 0xAE, 0x14, 0xF9,
+    0xD3, 0x26, 0xF1, 0xCC, 0xAA, 0x57, 0x44, 0x8E, 0xF1, 0xCB, 0x5B, 0x74, 0x37, 0xE8, 0xAC, 0xD9,
+    0x97, 0x3C, 0x20, 0x5A, 0xE1, 0xBC, 0xB1, 0x32, 0xDB, 0xDA, 0xFB, 0xA7, 0x95, 0x5F, 0xF1, 0x47,
+    0xDB, 0xE7, 0xB1, 0x58, 0x2F, 0x79, 0x3A, 0x2F, 0xD3, 0xC9, 0x84, 0xBD, 0x8C, 0xDD, 0xE7, 0xA9,
+    0x9E, 0x0D, 0xFE, 0x42, 0x5B, 0xF2, 0xDD, 0x4E, 0x0F, 0x1F, 0xF4, 0x33, 0x0F, 0xE8, 0x78, 0xF0,
+    0x1E, 0x8B, 0xEE, 0x5B, 0xB5, 0xE2, 0x74, 0x5D, 0xFB, 0x3C, 0x99, 0x5F, 0x53, 0x6C, 0x81, 0x53,
+    0x96, 0x5A, 0xDD, 0xE6, 0xC4, 0xEA, 0xD8, 0xAA, 0x60, 0xC8, 0xBD, 0xDB, 0x44, 0x78, 0xDB, 0x82,
+    0xEC, 0x90, 0xAC, 0xCD, 0xB8, 0x2E, 0xF8, 0x4B, 0x21, 0x8A, 0xCC, 0x29, 0xC6, 0x0F, 0x08, 0x66,
+    0x73, 0x6A, 0x0E, 0xC8, 0xC5, 0x68, 0x27, 0x86, 0x4B, 0x94, 0x85, 0x7A, 0x96, 0x62, 0xE9, 0x8D,
+    0x81, 0xF5, 0x8D, 0x8F, 0x3E, 0xF9, 0xE8, 0x3C, 0x4C, 0xE3, 0x67, 0xF1, 0xCE, 0xE2, 0xC7, 0xE7,
+    0xE1, 0x98, 0x3C, 0x94, 0x0E, 0x4F, 0x9E, 0xF3, 0xB1, 0x3F, 0x1D, 0xBE, 0x4F, 0xED, 0x73, 0xFE,
+    0x11, 0x74, 0xB1, 0x7D, 0xCE, 0x3B, 0xA2, 0x4F, 0x8E, 0xCD, 0x18, 0x6C, 0xA4, 0xE0, 0xA9, 0x01,
+    0xC3, 0x38, 0x45, 0x07, 0x35, 0x19, 0x69, 0xC5, 0x59, 0xE3, 0x96, 0xD2, 0x4A, 0xD4, 0xD0, 0xD3,
+    0x7D, 0x2B, 0xC8, 0xFA, 0x56, 0xA8, 0xFA, 0x56, 0x44, 0x7D, 0x6B, 0xF5, 0xC2, 0x0E, 0x5D, 0xD8,
+    0xE6, 0xB1, 0x5B, 0xE9, 0x88, 0x55, 0x0B, 0x0F, 0xEA, 0xAA, 0x89, 0xDF, 0x6A, 0x12, 0xF2, 0x9F,
+    0xFF, 0xF3, 0xEB, 0x3A, 0x3C, 0xAA, 0xA2, 0x8C, 0xF6, 0xD7, 0x1F, 0x55, 0xE1, 0x91, 0x09, 0x31,
+    0xA9, 0x7F, 0x54, 0x85, 0x8F, 0xA4, 0x15, 0xAE, 0x9B, 0xF0, 0xB1, 0xB4, 0x22, 0xAF, 0x6F, 0xAD,
+    0x7A, 0x7D, 0xEF, 0x96, 0xCB, 0x23, 0xD8, 0x33, 0x2A, 0xA7, 0x8E, 0x6E, 0x57, 0x71, 0x46, 0x8E,
+    0xA1, 0x61, 0x42, 0xC3, 0x94, 0xC8, 0x2B, 0x29, 0x6E, 0x28, 0xA9, 0x5B, 0xAB, 0x14, 0xE7, 0xA9,
+    0x74, 0x62, 0xE8, 0x94, 0xAD, 0x53, 0xE6, 0x4E, 0x59, 0x3C, 0x65, 0xF4, 0x94, 0xDD, 0x53, 0xA6,
+    0x4F, 0x59, 0x3F, 0x01, 0x80, 0xE4, 0x1E, 0x03, 0xC9, 0x2D, 0x0C, 0xAA, 0xCD, 0xFE, 0xF3, 0xFF,
+    0x02, 0x89, 0x43, 0xC9, 0xBA, 0x03, 0x43, 0x72, 0xD1, 0xE1, 0x21, 0xB9, 0x68, 0x21, 0x19, 0xFF,
+    0x60, 0x54, 0xC6, 0x3F, 0x04, 0x98, 0xFE, 0x07, 0x63, 0x73, 0x28, 0xB9, 0x83, 0xE7, 0x43, 0xC9,
+    0xBA, 0x47, 0x48, 0x72, 0x07, 0x12, 0xE7, 0xE1, 0x24, 0x4E, 0x8A, 0xC2, 0x2A, 0x32, 0x70, 0x06,
+    0x9D, 0xA8, 0x84, 0x1D, 0x0F, 0xBF, 0x11, 0x82, 0x4C, 0xAA, 0xE3, 0x22, 0x57, 0x89, 0xB6, 0x6C,
+    0x15, 0x25, 0xD4, 0xD0, 0xC0, 0x69, 0xA3, 0x20, 0xF7, 0x5B, 0x05, 0x89, 0x03, 0x0B, 0x27, 0xCA,
+    0xAF, 0xA3, 0x57, 0x5B, 0xAF, 0x11, 0xC4, 0x2A, 0x96, 0xF4, 0x0C, 0xCB, 0xFA, 0x45, 0x8F, 0x4A,
+    0x11, 0x9B, 0xD0, 0x04, 0xC6, 0xAB, 0xDC, 0x8A, 0x6A, 0xFE, 0x6D, 0x55, 0x6C, 0x72, 0x1D, 0x9A,
+    0x44, 0x07, 0x26, 0xD6, 0x30, 0xA5, 0x70, 0xAB, 0xA0, 0xA0, 0xDA, 0x2B, 0x5B, 0x79, 0xBB, 0x3E,
+    0x24, 0x48, 0x1C, 0x5A, 0x62, 0x19, 0x4B, 0x2C, 0x95, 0x13, 0xCB, 0x25, 0x8A, 0x25, 0x23, 0xC5,
+    0xB2, 0xE1, 0x04, 0x95, 0x41, 0x02, 0x9B, 0x39, 0x56, 0x7B, 0xFF, 0x2B, 0xFD, 0xCF, 0x41, 0x98,
+    0x3A, 0x52, 0xF7, 0x13, 0x04, 0xD4, 0x2B, 0x74, 0xDF, 0xAD, 0x7C, 0x13, 0xB1, 0x79, 0x59, 0xAC,
+    0x83, 0x12, 0xBA, 0xD5, 0xB4, 0x72, 0x85, 0x62, 0x0A, 0xB5, 0x5F, 0x7A, 0xB5, 0x33, 0x74, 0x86,
+    0x5E, 0xE3, 0x63, 0x48, 0x84, 0xA8, 0x0A, 0x94, 0x01, 0xC9, 0x8F, 0x60, 0x50, 0x40, 0xB1, 0x4A,
+    0x8B, 0x58, 0x05, 0x18, 0xB9, 0x4F, 0x6E, 0x35, 0xE7, 0x42, 0xF3, 0x07, 0x14, 0x40, 0xC3, 0x58,
+    0x81, 0x7C, 0x14, 0x14, 0x88, 0x50, 0x73, 0xD7, 0xFF, 0x5F, 0xBF, 0x01, 0xE9, 0xBC, 0x4C, 0x39,
+    0x5A, 0x67, 0x39, 0xEA, 0x1C, 0x11, 0x3A, 0xBA, 0xFE, 0xAC, 0x5A, 0x82, 0x4C, 0xF9, 0x40, 0x68,
+    0x15, 0x2B, 0x8E, 0x67, 0xB0, 0xD0, 0xAD, 0x67, 0x81, 0x41, 0x50, 0x26, 0xFA, 0x01, 0x3E, 0x03,
+    0x62, 0xF5, 0x63, 0xC4, 0xFC, 0x40, 0xB1, 0x10, 0x2C, 0x80, 0xC1, 0x5C, 0xD8, 0xF0, 0x1C, 0xE0,
+    0xA6, 0x1F, 0xA2, 0x64, 0xE0, 0x8F, 0x1A, 0x01, 0x5C, 0x14, 0x1A, 0x76, 0xE5, 0x3E, 0xF4, 0xE7,
+    0xB2, 0x45, 0x4B, 0x28, 0x33, 0x34, 0x2F, 0x20, 0xCC, 0xE2, 0x9D, 0x66, 0x27, 0x73, 0xF0, 0xB8,
+    0x3E, 0x5D, 0xB0, 0xC7, 0x94, 0x3C, 0xB3, 0x85, 0xD5, 0x61, 0x65, 0xB3, 0xA0, 0x49, 0xDF, 0x7B,
+    0x3A, 0x74, 0xE2, 0xC7, 0xC0, 0xF9, 0x71, 0x43, 0xD1, 0xDF, 0x50, 0x3E, 0x33, 0x14, 0xE2, 0x2C,
+    0x0A, 0xC1, 0x0E, 0xE1, 0x1E, 0x14, 0x62, 0x9A, 0xCF, 0x76, 0x13, 0xF0, 0x3B, 0x01, 0xBF, 0xD2,
+    0xA2, 0x2D, 0x49, 0x17, 0x11, 0x70, 0x36, 0x26, 0xE3, 0xF3, 0xF1, 0x1E, 0xF3, 0xAA, 0x5C, 0x63,
+    0x2F, 0xD3, 0xE1, 0x13, 0x72, 0x72, 0xB8, 0x9E, 0x74, 0x5E, 0xB6, 0xA3, 0x53, 0x3E, 0x79, 0xC1,
+    0x5A, 0xC4, 0x6F, 0x1C, 0xB7, 0x23, 0xF2, 0x47, 0x9B, 0x9B, 0x79, 0xC1, 0x08, 0xB8, 0xF5, 0x4D,
+    0xEE, 0x5B, 0x1D, 0xFB, 0x2A, 0xD3, 0x0D, 0xE5, 0x1A, 0xC9, 0x89, 0x21, 0xF3, 0xC3, 0x5D, 0x5D,
+    0xAC, 0xCF, 0xCE, 0xC9, 0xC0, 0x71, 0x77, 0x2C, 0xBE, 0x47, 0xF4, 0x57, 0x7C, 0xFB, 0x1A, 0x28,
+    0x17, 0x06, 0xDD, 0xF7, 0xD0, 0xBD, 0x82, 0xEE, 0x6B, 0x78, 0x42, 0x8C, 0x0E, 0xD4, 0x3D, 0x3A,
+    0xF1, 0x68, 0x02, 0xA1, 0x39, 0xA9, 0xFB, 0xF2, 0x32, 0x7B, 0x3C, 0xBD, 0x33, 0xFC, 0x80, 0x7D,
+    0xC3, 0xC9, 0xAD, 0xB8, 0x88, 0x6F, 0x45, 0xE7, 0x1C, 0xD0, 0xE1, 0xE3, 0xE8, 0x03, 0x41, 0xB3,
+    0xBA, 0xB9, 0xD2, 0x8E, 0x9B, 0x41, 0x7D, 0x89, 0x1A, 0x67, 0x03, 0x6B, 0xD3, 0xDB, 0xD8, 0xD6,
+    0x37, 0xD7, 0x1C, 0xE7, 0x2D, 0xF3, 0xE6, 0xE0, 0x5A, 0xEC, 0x96, 0xA6, 0xCA, 0xFF, 0x6C, 0xD7,
+    0x9B, 0xA7, 0xCD, 0x65, 0x7B, 0x8C, 0xE9, 0x9E, 0x38, 0x38, 0x99, 0x2E, 0x8F, 0x54, 0xFE, 0x1F,
+    0xBB, 0x3E, 0xB2, 0x75, 0x7E, 0x35, 0xF5, 0xAA, 0x7F, 0xD5, 0xCB, 0xAB, 0x73, 0xEE, 0x81, 0x79,
+    0x1F, 0x34, 0x65, 0x4F, 0xC5, 0x2C, 0xE0, 0x19, 0x6E, 0x23, 0x58, 0xF0, 0x24, 0x77, 0x86, 0x66,
+    0xAD, 0xA1, 0x4B, 0x1D, 0x0E, 0x7B, 0x1D, 0x0E, 0xE5, 0x6B, 0x75, 0xCB, 0xB6, 0xE9, 0xE4, 0x58,
+    0x25, 0x25, 0x9C, 0xED, 0xC5, 0x19, 0x32, 0xCF, 0xB2, 0xB3, 0x04, 0x0C, 0xCB, 0x2C, 0xEE, 0xB2,
+    0x1F, 0x5A, 0x4B, 0xBF, 0xB6, 0xD8, 0xED, 0xB3, 0x32, 0x64, 0x76, 0xCF, 0x14, 0x70, 0x5B, 0x99,
+    0xDD, 0xF1, 0x1E, 0x05, 0x16, 0x41, 0x0B, 0x3C, 0x49, 0x9E, 0x8F, 0xC8, 0x7E, 0x55, 0x93, 0xD5,
+    0xF6, 0xB6, 0x75, 0xD1, 0x56, 0xE9, 0xD1, 0x10, 0x03, 0x52, 0x4A, 0x1E, 0xE2, 0xD4, 0x57, 0x0E,
+    0xD4, 0x99, 0x21, 0xDE, 0x2E, 0x50, 0xD3, 0xE1, 0x77, 0xAE, 0x79, 0x36, 0x69, 0x7B, 0xD8, 0x4C,
+    0x9F, 0x59, 0x0D, 0x0F, 0x8E, 0x01, 0x4B, 0x5E, 0xB4, 0x6C, 0xE1, 0x3D, 0x66, 0xAA, 0xD6, 0x1D,
+    0xE3, 0x98, 0xC3, 0xEC, 0x48, 0x1B, 0x13, 0x2C, 0xED, 0x7F, 0x63, 0x2A, 0x44, 0xB8, 0x76, 0x3A,
+    0xA6, 0x41, 0x37, 0x2D, 0xE5, 0x40, 0xB9, 0xA1, 0x53, 0x09, 0x5A, 0x43, 0x10, 0x3A, 0xA3, 0x86,
+    0xC6, 0x19, 0x6A, 0x95, 0x6A, 0xD1, 0xB6, 0x80, 0x9D, 0x52, 0xB3, 0xA6, 0x5C, 0xE7, 0x08, 0x6C,
+    0x3C, 0xED, 0xBE, 0xE8, 0x78, 0x4B, 0x34, 0x1C, 0x88, 0x7E, 0x03, 0xD1, 0x6E, 0x55, 0xF2, 0x8A,
+    0x68, 0x32, 0x3F, 0xA1, 0xD5, 0x7C, 0x77, 0x33, 0xC3, 0x50, 0x56, 0xAA, 0xCD, 0xB9, 0x7C, 0x9C,
+    0x48, 0x7C, 0x59, 0xCA, 0xC8, 0x1E, 0xD8, 0xAF, 0x2A, 0xCA, 0x8F, 0x46, 0x50, 0x39, 0x3F, 0x6A,
+    0x80, 0x4B, 0x7A, 0x5B, 0xEA, 0x6C, 0x86, 0x6B, 0xC5, 0x48, 0x25, 0x62, 0x18, 0x28, 0x18, 0x34,
+    0x5C, 0x47, 0x1C, 0xC8, 0x11, 0x52, 0xE1, 0x5A, 0x1C, 0xF8, 0x62, 0x21, 0xE8, 0x92, 0xD4, 0x33,
+    0x13, 0x08, 0xCD, 0x4A, 0x3B, 0xCD, 0x18, 0x1B, 0xAB, 0x31, 0x14, 0xF6, 0xF8, 0xA8, 0x53, 0xE5,
+    0xD5, 0x93, 0x7A, 0xE4, 0xBB, 0x79, 0x05, 0x57, 0x97, 0x82, 0x68, 0x61, 0x22, 0x14, 0x67, 0xF3,
+    0x3A, 0xF3, 0x93, 0xCF, 0x3C, 0xE6, 0xA8, 0x3E, 0x09, 0x39, 0x51, 0xE7, 0xD2, 0x6B, 0xDD, 0xC6,
+    0x6C, 0x75, 0x94, 0xAE, 0x5A, 0x5A, 0x3B, 0x1D, 0xB5, 0xC7, 0x46, 0x72, 0x84, 0x79, 0xE7, 0x4B,
+    0xF8, 0xAC, 0x77, 0x08, 0xFA, 0x9C, 0x55, 0x89, 0x48, 0x8D, 0xEA, 0xD9, 0x36, 0x2A, 0x5E, 0xFE,
+    0xF5, 0xAA, 0x77, 0x0E, 0x8F, 0x25, 0x5C, 0xAB, 0x71, 0x2C, 0x1B, 0xC5, 0xD6, 0x1E, 0x27, 0xD6,
+    0xD3, 0x39, 0x8A, 0xED, 0x0A, 0xB7, 0x53, 0x94, 0xC4, 0xAE, 0x17, 0x21, 0x64, 0x9C, 0x1B, 0xBB,
+    0x77, 0x00, 0xC1, 0x36, 0x2E, 0xBB, 0x35, 0x24, 0x1A, 0x94, 0xD1, 0x89, 0xB4, 0xB4, 0x87, 0xFE,
+    0x81, 0x6D, 0xF8, 0x8F, 0x10, 0x88, 0x76, 0xF7, 0x2B, 0xA2, 0x1F, 0x00, 0x89, 0xE5, 0x6B, 0x11,
+    0xE5, 0xBF, 0xCD, 0x11, 0x1F, 0x46, 0x8A, 0xEF, 0x33, 0x31, 0xA2, 0x12, 0x62, 0x8C, 0x1A, 0xE0,
+    0x3B, 0x22, 0x8F, 0xC8, 0x21, 0x1E, 0x61, 0x93, 0x40, 0x38, 0x90, 0x6E, 0x69, 0x8A, 0x08, 0xB3,
+    0xD8, 0xA4, 0x9C, 0xA9, 0x88, 0x63, 0x63, 0x05, 0x87, 0xDC, 0xF8, 0x70, 0xE6, 0xD0, 0x5C, 0x91,
+    0x84, 0xE9, 0x8C, 0xFC, 0x8A, 0x2E, 0x1B, 0xC2, 0x05, 0x0D, 0xC1, 0x71, 0x4D, 0x36, 0xE0, 0x6D,
+    0x3A, 0x39, 0x01, 0x5E, 0x35, 0xCD, 0xCB, 0xD8, 0x55, 0x99, 0x87, 0x4F, 0xC0, 0x86, 0x82, 0x27,
+    0xE4, 0x1B, 0xAC, 0xF5, 0x05, 0xD6, 0xA2, 0xC8, 0xD6, 0xBD, 0xD4, 0x2B, 0xDB, 0xB9, 0xF8, 0xEA,
+    0xB8, 0xC4, 0x99, 0x49, 0x1F, 0x9A, 0xF4, 0xF3, 0x32, 0x39, 0x2A, 0xDE, 0x58, 0xD7, 0x1C, 0x14,
+    0xC1, 0xB5, 0x50, 0xA2, 0x62, 0xEB, 0x61, 0x7B, 0xC2, 0x30, 0x43, 0xAE, 0x61, 0x56, 0x7A, 0x7A,
+    0xC3, 0xFF, 0xB4, 0x09, 0x7F, 0xD1, 0x84, 0x41, 0x13, 0x8D, 0xD9, 0x1C, 0x56, 0x64, 0x92, 0x11,
+    0x99, 0xAD, 0xF8, 0xC0, 0xEC, 0xF9, 0xB6, 0xB8, 0x87, 0x25, 0x37, 0x48, 0x8E, 0x02, 0xDE, 0xAD,
+    0x98, 0x51, 0x74, 0xED, 0x17, 0x79, 0x2D, 0x67, 0x68, 0x2A, 0xD6, 0xFB, 0xFA, 0x2E, 0x0F, 0x2D,
+    0x99, 0xD7, 0x17, 0xA2, 0xEF, 0x51, 0xF4, 0x4B, 0x5C, 0x3E, 0x3E, 0xBB, 0x05, 0xB9, 0x9A, 0x7E,
+    0x93, 0xFF, 0x7D, 0x1B, 0xD0, 0x97, 0xFB, 0xF9, 0x97, 0x85, 0x63, 0x0D, 0x05, 0xFF, 0x78, 0x40,
+    0xD1, 0xEF, 0x12, 0x0A, 0xA2, 0x8B, 0xAD, 0x1F, 0x08, 0xF8, 0x01, 0x5F, 0xFF, 0x8C, 0x78, 0xA5,
+    0xBC, 0x71, 0xC3, 0x6E, 0xEF, 0x3C, 0xEC, 0xA1, 0x70, 0x3C, 0x38, 0x18, 0xDE, 0x0B, 0xFD, 0xB5,
+    0x0E, 0xB7, 0xA6, 0x4E, 0xB6, 0x6A, 0xDB, 0xDD, 0x9D, 0x6D, 0x7D, 0x28, 0x97, 0x36, 0xBF, 0x91,
+    0x5B, 0x5B, 0x50, 0xC9, 0xB5, 0x0D, 0x37, 0x2C, 0xBE, 0xB7, 0xE1, 0x6A, 0xC5, 0x17, 0xB7, 0x50,
+    0xCB, 0xCD, 0x2D, 0x1A, 0x1F, 0xD6, 0xCE, 0x1F, 0xF9, 0x08, 0xE2, 0x50, 0x27, 0x71, 0x4F, 0x5A,
+    0x4E, 0x8F, 0x06, 0x42, 0x47, 0x58, 0x62, 0xF9, 0xC8, 0xA0, 0x8A, 0x2B, 0x28, 0x11, 0x9A, 0x85,
+    0x56, 0x05, 0x0E, 0x11, 0x1C, 0x15, 0xBA, 0xB1, 0x5C, 0x8D, 0x03, 0xE5, 0x12, 0x5B, 0x00, 0xE1,
+    0x6E, 0x98, 0xE5, 0xD6, 0x52, 0x6B, 0x25, 0xF5, 0x72, 0x13, 0x4B, 0xCA, 0xB0, 0x77, 0x85, 0x29,
+    0x8E, 0xCA, 0xB1, 0xA4, 0x0C, 0x33, 0xB2, 0xAE, 0x68, 0x30, 0xBE, 0x03, 0x32, 0xF3, 0xF3, 0x6C,
+    0xE1, 0x85, 0x7C, 0xCC, 0x39, 0x1C, 0xEB, 0x74, 0x6C, 0xDC, 0x8B, 0x56, 0x3A, 0x95, 0xA0, 0x9B,
+    0xBF, 0x6D, 0x5F, 0xA8, 0xEF, 0x44, 0x3A, 0xCB, 0xEA, 0x05, 0x37, 0xBB, 0x92, 0x23, 0x26, 0xA0,
+    0xD8, 0x14, 0xEF, 0x79, 0x4F, 0xCF, 0xCB, 0xF1, 0x8C, 0x02, 0x87, 0xB7, 0x5C, 0x24, 0x1C, 0x76,
+    0xDF, 0xD6, 0x3C, 0x7D, 0x8B, 0x65, 0xB9, 0xA0, 0x3D, 0xF8, 0xB6, 0x81, 0xA7, 0x5D, 0x7D, 0xDA,
+    0x40, 0x91, 0xCE, 0xB8, 0x7D, 0x89, 0xBF, 0x67, 0x79, 0xB6, 0x26, 0x63, 0x72, 0x7C, 0xCD, 0xD5,
+    0xC2, 0x94, 0x04, 0x4D, 0xFC, 0xB5, 0xF9, 0x0A, 0x7F, 0xA9, 0x5E, 0x6C, 0x9F, 0xF3, 0x8E, 0x48,
+    0x9A, 0xB8, 0x0E, 0x8D, 0x5F, 0x78, 0xFA, 0x3C, 0xF2, 0xF2, 0xBF, 0x20, 0xE5, 0x69, 0xBF, 0x08,
+    0x4D, 0x5C, 0x27, 0xCD, 0xF9, 0x46, 0xB8, 0x59, 0x50, 0x2E, 0x5F, 0x5D, 0xBE, 0x8A, 0x9B, 0xBE,
+    0x3E, 0xA7, 0x1D, 0xD9, 0xAB, 0x59, 0xFE, 0x0D, 0xED, 0x54, 0x31, 0x6C, 0xD5, 0x30, 0x10, 0x7D,
+    0x49, 0xA4, 0x1A, 0xD5, 0x42, 0xC7, 0xC2, 0x06, 0x35, 0x23, 0x02, 0x84, 0x59, 0x91, 0x4A, 0x6D,
+    0xB1, 0x76, 0x80, 0x85, 0xB9, 0xFB, 0x5F, 0xB2, 0xC0, 0x80, 0x04, 0xAD, 0x05, 0x03, 0x23, 0x7F,
+    0x67, 0x68, 0x07, 0x90, 0xE0, 0x33, 0xFC, 0x19, 0xF1, 0xDB, 0xB8, 0x30, 0x32, 0x60, 0x04, 0x12,
+    0x03, 0x03, 0x06, 0x55, 0x80, 0xC4, 0x40, 0x86, 0x0C, 0x81, 0xA6, 0x3F, 0x5C, 0xFE, 0x2F, 0x50,
+    0x04, 0x42, 0x6C, 0x2C, 0xF8, 0xEE, 0xAC, 0xF8, 0xEC, 0x3B, 0xDF, 0xBD, 0xBB, 0x18, 0x40, 0xDA,
+    0x5A, 0xFA, 0x18, 0xF5, 0xF5, 0xD2, 0x9C, 0xAD, 0x4D, 0xD2, 0x30, 0xAF, 0x4C, 0x66, 0x93, 0x36,
+    0xAC, 0x61, 0x3D, 0x7D, 0x0A, 0xC9, 0xD8, 0x4A, 0xAB, 0xFC, 0xAC, 0x05, 0x0A, 0xA7, 0x3D, 0xED,
+    0x21, 0x1D, 0x7A, 0x6B, 0x20, 0x0F, 0xED, 0xB1, 0xE2, 0xF1, 0xDA, 0x67, 0x37, 0xBD, 0x24, 0x7F,
+    0x98, 0xFC, 0xE9, 0xA5, 0x17, 0x45, 0xDB, 0x1C, 0x5C, 0x7A, 0xD1, 0xED, 0x0E, 0xB7, 0x30, 0xB8,
+    0x2D, 0xDB, 0x40, 0x6D, 0xA4, 0x41, 0xDC, 0x8F, 0xB5, 0x43, 0xC0, 0x5C, 0x6B, 0xE7, 0x86, 0x11,
+    0xA2, 0x42, 0x56, 0x9D, 0xC8, 0xAA, 0x05, 0x51, 0x9A, 0x61, 0x90, 0x63, 0x60, 0x1A, 0xD3, 0xA2,
+    0x5F, 0x10, 0xFE, 0x0C, 0x30, 0x02, 0x36, 0xC6, 0x18, 0x2B, 0xDF, 0xC8, 0x30, 0x12, 0xE1, 0x8A,
+    0x08, 0x0B, 0xD2, 0xAB, 0x55, 0x37, 0xF3, 0x19, 0x45, 0x1B, 0xDA, 0x36, 0x7C, 0xB9, 0xEF, 0x63,
+    0xE6, 0x9D, 0xB4, 0x20, 0x80, 0x0D, 0xAE, 0x00, 0x35, 0x92, 0x12, 0x59, 0x84, 0x0C, 0x98, 0x75,
+    0x53, 0x87, 0x8E, 0x5E, 0x96, 0x9A, 0x33, 0xBC, 0x56, 0xE9, 0xE7, 0xA5, 0x6C, 0x5D, 0xDA, 0x06,
+    0xF5, 0xBA, 0xEE, 0x92, 0x44, 0x97, 0xAD, 0xFA, 0x58, 0xF2, 0x19, 0x3E, 0x29, 0x6B, 0x98, 0xDC,
+    0x5E, 0x95, 0x7E, 0x24, 0x7C, 0x23, 0xC2, 0xBA, 0x08, 0x26, 0x0F, 0xF2, 0x7D, 0x80, 0xF0, 0x90,
+    0xFE, 0x14, 0xD9, 0xCB, 0xCB, 0x50, 0x5B, 0xC0, 0xFC, 0x0F, 0x36, 0x6D, 0xC3, 0xBC, 0x57, 0xC3,
+    0x63, 0x57, 0xB9, 0xFB, 0x51, 0x63, 0x32, 0x8E, 0x0D, 0xEE, 0x4E, 0x95, 0xD8, 0x87, 0x51, 0x16,
+    0xC9, 0x2B, 0x6B, 0xB0, 0x97, 0xB4, 0x55, 0x4E, 0x86, 0xB4, 0xEA, 0x92, 0xE8, 0x63, 0x1D, 0xDD,
+    0x2A, 0x2B, 0x99, 0xAA, 0x74, 0x97, 0xBA, 0x95, 0x08, 0xE4, 0x17, 0x50, 0xB1, 0x9B, 0x95, 0xA5,
+    0x08, 0xB5, 0x5D, 0x81, 0x36, 0x6B, 0x86, 0xB9, 0xF9, 0x45, 0x74, 0xD8, 0x41, 0x6F, 0x6D, 0xF0,
+    0x0D, 0xD3, 0xBF, 0xA8, 0x73, 0x52, 0x75, 0x10, 0x2C, 0xD7, 0xB8, 0xC4, 0x20, 0xFE, 0x8E, 0x8F,
+    0x8F, 0xDD, 0xB1, 0x41, 0x87, 0x94, 0xDA, 0xC1, 0x72, 0xEE, 0x46, 0xCA, 0xCF, 0x73, 0x81, 0x95,
+    0x83, 0xEE, 0xA0, 0x67, 0xDC, 0x85, 0xC3, 0x49, 0x84, 0x8D, 0x41, 0x57, 0x9B, 0xC1, 0xA0, 0xCF,
+    0x27, 0x45, 0x6B, 0xD5, 0xAD, 0xA8, 0xB3, 0x72, 0x36, 0x2B, 0x21, 0x23, 0x72, 0x97, 0x30, 0xD6,
+    0xA2, 0x44, 0x5A, 0x1D, 0x4D, 0xAB, 0xF9, 0x6C, 0x52, 0xF8, 0xCF, 0xF8, 0xDF, 0x46, 0xFF, 0xAA,
+    0x8D, 0xD2, 0x31, 0x68, 0xD5, 0x93, 0xE0, 0xF0, 0xE2, 0xCC, 0x30, 0xEA, 0x1B, 0xD1, 0x88, 0x68,
+    0x64, 0x34, 0x4B, 0xA5, 0x7C, 0x5B, 0x27, 0x1B, 0xA0, 0x57, 0x5E, 0x67, 0xD1, 0x70, 0xA5, 0xDA,
+    0xD2, 0x5C, 0x38, 0x6F, 0xC0, 0x57, 0x1C, 0xA0, 0x77, 0x81, 0x11, 0x4E, 0x36, 0x2C, 0xBD, 0x8C,
+    0x3A, 0x2D, 0x4D, 0x52, 0x1B, 0x4C, 0x38, 0xA9, 0x75, 0x5A, 0xD1, 0x8D, 0xC8, 0xBB, 0xBD, 0x3B,
+    0xF7, 0xA0, 0xDF, 0xD4, 0xEC, 0x37, 0x22, 0xDD, 0x66, 0x64, 0x0A, 0xBE, 0xAE, 0xB0, 0x48, 0x9E,
+    0x7A, 0x08, 0xEE, 0x06, 0x95, 0x35, 0x28, 0x9E, 0xB4, 0xE0, 0x32, 0xCC, 0x0D, 0xDD, 0x11, 0x46,
+    0x9A, 0x95, 0xD3, 0x6B, 0x78, 0xCE, 0xA2, 0x3A, 0xE7, 0x39, 0xB8, 0x1E, 0x3F, 0x3C, 0xB9, 0x9F,
+    0x34, 0xC8, 0x54, 0x9E, 0xF4, 0x41, 0x7F, 0x68, 0x7B, 0xAE, 0x32, 0x8A, 0xB2, 0xFD, 0xD5, 0xEE,
+    0xD1, 0x5D, 0x16, 0xB6, 0x7B, 0xEC, 0xD9, 0x07, 0xAF, 0x3F, 0xB1, 0x70, 0xBD, 0xE8, 0x69, 0x60,
+    0x1D, 0x47, 0xF3, 0x6C, 0x07, 0x45, 0x95, 0xB3, 0x5D, 0xFE, 0xD3, 0x23, 0xF7, 0x8D, 0x54, 0x28,
+    0xAA, 0xDE, 0x62, 0x78, 0x00, 0xBD, 0xBD, 0x5D, 0x58, 0xDA, 0x6C, 0x14, 0x2B, 0x1B, 0xFA, 0xED,
+    0xC4, 0x31, 0x50, 0xE0, 0x20, 0xA8, 0xEC, 0x2D, 0xF6, 0xD9, 0xE0, 0x2F, 0xA2, 0x95, 0x7D, 0xFD,
+    0xB0, 0x9A, 0x18, 0x8F, 0xC8, 0xAD, 0x77, 0xEC, 0xD7, 0xBB, 0xE5, 0xBB, 0x9A, 0x56, 0x23, 0x71,
+    0x98, 0xAE, 0xFB, 0x3F, 0x8A, 0x0A, 0x33, 0x35, 0x4E, 0xE6, 0x98, 0x27, 0x18, 0x0B, 0xC3, 0xE0,
+    0xB6, 0x9C, 0xA6, 0xBD, 0x48, 0xF6, 0xAA, 0x82, 0xAA, 0x91, 0x3A, 0xE1, 0xF4, 0x87, 0xFC, 0x03,
+    0xB9, 0xEF, 0xE4, 0x69, 0x4B, 0x34, 0x5F, 0x01, 0x95, 0x57, 0x3D, 0x8C, 0xDE, 0xC6, 0x11, 0x5D,
+    0x92, 0x27, 0x11, 0x12, 0x91, 0xAC, 0x0A, 0x4B, 0x08, 0xAC, 0x73, 0xD8, 0xB8, 0x08, 0x2C, 0x5B,
+    0xEC, 0x0C, 0xC1, 0xB8, 0x13, 0x89, 0x04, 0x48, 0x13, 0x20, 0x52, 0x80, 0x9C, 0x1B, 0x17, 0x71,
+    0x91, 0x2A, 0x2E, 0x2E, 0x85, 0x02, 0xA8, 0x90, 0x4D, 0x02, 0x06, 0xA2, 0xE2, 0x1A, 0x35, 0x42,
+    0x8A, 0x14, 0x51, 0xE1, 0xE2, 0x72, 0x09, 0x70, 0x0A, 0x90, 0x00, 0x57, 0x48, 0x5A, 0x1A, 0x0A,
+    0x90, 0x42, 0x85, 0x18, 0x09, 0x41, 0x4A, 0x13, 0xD1, 0x25, 0x70, 0xAC, 0x42, 0x34, 0x42, 0xD9,
+    0xD4, 0x89, 0xE4, 0xF8, 0xBD, 0x21, 0xBF, 0x93, 0x14, 0xFF, 0x25, 0xDF, 0x1D, 0xDF, 0xF2, 0xE3,
+    0xEE, 0x72, 0x67, 0x67, 0xDE, 0xBC, 0xD9, 0xCF, 0x18, 0xFD, 0xB8, 0x01, 0x10, 0xED, 0x49, 0x61,
+    0x4C, 0x52, 0x25, 0xA5, 0x31, 0x69, 0x11, 0x67, 0x78, 0x9C, 0xB1, 0x53, 0x74, 0x88, 0x78, 0x6B,
+    0x6B, 0x6B, 0x46, 0x7C, 0x91, 0x11, 0x4F, 0xD2, 0xEA, 0x34, 0x7A, 0x93, 0xEA, 0xA4, 0x49, 0xCB,
+    0xA4, 0x3A, 0x64, 0x92, 0x3A, 0xA9, 0xF0, 0x86, 0x31, 0xFF, 0xE7, 0x59, 0x4C, 0x13, 0x69, 0x30,
+    0x23, 0xFF, 0x1B, 0xEE, 0x0D, 0x9F, 0x3F, 0xC1, 0x28, 0x23, 0xDA, 0xCC, 0x78, 0xF9, 0x47, 0x78,
+    0x3B, 0xDE, 0x36, 0xBD, 0x1D, 0x9F, 0xE5, 0x53, 0x80, 0x97, 0xCF, 0x19, 0xE3, 0xDD, 0x68, 0x31,
+    0x19, 0x1D, 0xBE, 0x3C, 0x94, 0x32, 0xEA, 0xAF, 0x4A, 0x15, 0xB7, 0x1F, 0x3F, 0x28, 0xD3, 0xE6,
+    0x1F, 0xB7, 0x8B, 0xB4, 0xBE, 0xFB, 0x67, 0x93, 0xFF, 0xF5, 0x66, 0x61, 0xDC, 0x9D, 0x9B, 0x99,
+    0x71, 0x77, 0x2F, 0x62, 0xBD, 0xBB, 0x1B, 0x98, 0xF0, 0xF7, 0x1F, 0xC2, 0xEC, 0xFB, 0xDF, 0x04,
+    0xC8, 0x0B, 0xC6, 0xC4, 0xE3, 0xCB, 0xA6, 0xB4, 0xE3, 0x4A, 0x58, 0x06, 0x32, 0x3A, 0x8C, 0x86,
+    0xD9, 0xE6, 0xB4, 0x5C, 0x31, 0xE6, 0xD4, 0x55, 0xAC, 0x73, 0x8E, 0x06, 0xBE, 0x79, 0x69, 0xB1,
+    0xF6, 0x41, 0xE9, 0x74, 0xC9, 0xC2, 0x1F, 0x4D, 0x5E, 0x86, 0x3D, 0x6D, 0x6C, 0x4D, 0x5C, 0x26,
+    0x8D, 0x79, 0xDE, 0xA4, 0x35, 0x46, 0x28, 0xE4, 0x77, 0x36, 0x93, 0x2C, 0xBF, 0x33, 0x48, 0x99,
+    0x57, 0xF2, 0x41, 0x95, 0x57, 0x2E, 0xC2, 0x9D, 0x63, 0xEF, 0x02, 0x92, 0x06, 0x60, 0x3B, 0x67,
+    0xB2, 0x68, 0x70, 0x5E, 0x15, 0x88, 0xC4, 0x25, 0x1D, 0x92, 0x99, 0xE3, 0x5C, 0xC3, 0x1C, 0xA5,
+    0x7D, 0x32, 0x24, 0x70, 0xA3, 0x2F, 0xE6, 0x1D, 0x4F, 0xCC, 0x49, 0x5C, 0xDF, 0xC6, 0x75, 0x08,
+    0x97, 0x79, 0x72, 0xAD, 0x9D, 0xF5, 0x44, 0x6A, 0xB4, 0xD9, 0xE2, 0x59, 0x8A, 0x2D, 0x60, 0xEE,
+    0xFE, 0x18, 0xCC, 0x37, 0x27, 0xE4, 0x43, 0x3C, 0x1B, 0xA6, 0x5D, 0xC4, 0x88, 0x9F, 0xB8, 0x26,
+    0xE8, 0xA3, 0x2E, 0xE8, 0x82, 0x3E, 0x6C, 0x83, 0x36, 0x6C, 0xFD, 0x2C, 0xC4, 0xBA, 0x41, 0x8F,
+    0xF1, 0xBD, 0xAE, 0x5D, 0xF0, 0x32, 0xB0, 0xF2, 0xA8, 0xBB, 0xAC, 0xDF, 0xD1, 0x66, 0xE6, 0x1D,
+    0xCC, 0xEF, 0x8C, 0x17, 0x48, 0x75, 0x38, 0x86, 0x6D, 0xB4, 0x71, 0xD5, 0x73, 0xDD, 0x11, 0xE3,
+    0x29, 0x07, 0x0E, 0xCC, 0x8E, 0x7A, 0x65, 0x6E, 0x57, 0xE6, 0xF6, 0x3C, 0xAE, 0x97, 0x36, 0x93,
+    0xF6, 0x31, 0xBC, 0x9B, 0xF6, 0x88, 0xA6, 0x94, 0x26, 0x94, 0xFB, 0xB2, 0x27, 0x95, 0x09, 0xC4,
+    0x93, 0x0A, 0x7E, 0x0B, 0x40, 0x18, 0x7A, 0x32, 0x18, 0x8C, 0x14, 0x8B, 0x36, 0xFE, 0x7F, 0x5A,
+    0x5F, 0xDB, 0x70, 0x0C, 0xA4, 0x44, 0x9B, 0xC8, 0xAF, 0x64, 0x37, 0x46, 0xA0, 0xB0, 0x4E, 0x17,
+    0x93, 0x3F, 0x76, 0xB6, 0xE6, 0xE4, 0x7F, 0x59, 0xF7, 0xA2, 0x62, 0x3A, 0xC0, 0x94, 0x36, 0x21,
+    0x9F, 0x76, 0x7D, 0xD8, 0x97, 0xC0, 0x7B, 0xB5, 0x89, 0x81, 0xAD, 0x62, 0x4F, 0xBC, 0x37, 0x02,
+    0x8F, 0x7D, 0x22, 0x97, 0xD7, 0xCF, 0x72, 0x17, 0xD2, 0xBF, 0xFE, 0x30, 0x7F, 0xB4, 0xFE, 0x63,
+    0xAF, 0x8E, 0xBB, 0x98, 0xF1, 0x13, 0xE9, 0x26, 0xF4, 0x6A, 0x23, 0xBF, 0x31, 0xC0, 0x5C, 0x88,
+    0xA9, 0xA2, 0x55, 0x0C, 0xB1, 0x44, 0xC3, 0xB0, 0x9C, 0xD8, 0x63, 0xD6, 0xA4, 0x08, 0x7A, 0xCE,
+    0xA8, 0x15, 0xA4, 0xBE, 0x68, 0xF8, 0x7D, 0x46, 0x1D, 0xE1, 0x83, 0x4B, 0x32, 0x6D, 0xF2, 0xF2,
+    0xD9, 0x26, 0xD3, 0xE6, 0xFD, 0x9A, 0x8D, 0x7B, 0x57, 0x1B, 0xF9, 0x01, 0x1B, 0x7F, 0x5C, 0x97,
+    0xC2, 0x93, 0xED, 0x16, 0x2E, 0x06, 0x33, 0x32, 0xAB, 0x7D, 0xE6, 0x6B, 0x1A, 0xAE, 0x66, 0xE9,
+    0xB2, 0x0F, 0x91, 0x9C, 0x88, 0x7C, 0x6F, 0xE8, 0x01, 0x7E, 0x9E, 0xA3, 0x65, 0x53, 0x02, 0xC0,
+    0xB6, 0x89, 0x41, 0x8C, 0x18, 0x8D, 0xE5, 0x34, 0x57, 0xCE, 0x37, 0x79, 0x35, 0xDF, 0xA4, 0x95,
+    0xE7, 0x76, 0xA7, 0x1B, 0xFB, 0x78, 0xD0, 0xAE, 0x32, 0xCD, 0x9C, 0x0E, 0x2E, 0xB0, 0x51, 0xDC,
+    0x80, 0x96, 0x79, 0xF6, 0x1D, 0xA6, 0x75, 0x67, 0xF2, 0x9A, 0xB3, 0xA0, 0x04, 0xE9, 0xC8, 0x44,
+    0xB7, 0x1D, 0xF8, 0xD9, 0xE2, 0x06, 0xD9, 0x15, 0x0A, 0xA7, 0x83, 0x17, 0x66, 0x5D, 0xA6, 0x59,
+    0x4B, 0xBE, 0x64, 0x78, 0x8F, 0x14, 0x17, 0xF0, 0x02, 0x5D, 0xF4, 0xBA, 0x49, 0x79, 0x93, 0x22,
+    0x9F, 0x72, 0xD0, 0xFC, 0x3D, 0x3B, 0xA6, 0xFF, 0x1A, 0x60, 0x73, 0xEB, 0x4B, 0x24, 0xF5, 0x1C,
+    0xE0, 0xE7, 0xC8, 0xE8, 0xCE, 0x6C, 0x32, 0x18, 0x09, 0x6E, 0x06, 0xB3, 0x3E, 0x62, 0x17, 0x4C,
+    0x99, 0xA0, 0x41, 0x68, 0xF9, 0x86, 0x00, 0x83, 0xA5, 0xC0, 0xC3, 0x00, 0x1B, 0x91, 0x32, 0x70,
+    0x45, 0x88, 0xAD, 0xB9, 0x32, 0x5A, 0x2F, 0x23, 0x6C, 0x36, 0xAF, 0x6C, 0x4C, 0x41, 0x42, 0xFA,
+    0x5A, 0x5B, 0x5B, 0x4D, 0x11, 0xFD, 0x64, 0xFB, 0x37, 0xC6, 0xB6, 0x2B, 0x41, 0xBB, 0x4A, 0xA2,
+    0xF5, 0x2B, 0x41, 0x4F, 0x76, 0x85, 0xFD, 0x39, 0xBF, 0xBF, 0x40, 0x97, 0x0D, 0x57, 0xBD, 0x61,
+    0x87, 0x37, 0x63, 0x63, 0xC6, 0x56, 0x3D, 0x55, 0x1B, 0x47, 0x79, 0x01, 0xFB, 0x4D, 0xDE, 0xA8,
+    0x76, 0x96, 0x93, 0x7E, 0xD0, 0xA9, 0xA9, 0xBA, 0x33, 0xCF, 0x0C, 0x65, 0x96, 0x92, 0x7A, 0x80,
+    0x84, 0xAB, 0x6D, 0x43, 0xD2, 0x01, 0x8D, 0x3F, 0x10, 0xCD, 0xA8, 0x28, 0x40, 0x0C, 0x00, 0x7E,
+    0xDD, 0xBF, 0x99, 0xB1, 0x26, 0xC6, 0x95, 0xD8, 0x87, 0x6B, 0xAE, 0x14, 0x4B, 0xFB, 0x89, 0xDD,
+    0x42, 0xEA, 0x40, 0x01, 0xB8, 0x9D, 0x10, 0x01, 0x0E, 0xBC, 0x31, 0x60, 0x7B, 0x42, 0x87, 0xF2,
+    0x2B, 0xF6, 0x05, 0xB3, 0x2F, 0xF6, 0x78, 0xF4, 0x18, 0x22, 0xD8, 0xA6, 0x3D, 0xDD, 0xD2, 0x23,
+    0xD0, 0x00, 0xB8, 0x8C, 0x10, 0x3E, 0x0B, 0x11, 0x7B, 0x01, 0x20, 0x05, 0x66, 0x34, 0xC9, 0x80,
+    0xB9, 0x9F, 0xCA, 0x25, 0x5F, 0xEE, 0x60, 0xFB, 0x4B, 0x8B, 0x55, 0x0F, 0x6F, 0x6D, 0xFD, 0x96,
+    0xEB, 0x8C, 0xE6, 0xC9, 0xE7, 0x20, 0x56, 0x4D, 0x60, 0x8E, 0xFB, 0xEE, 0x48, 0x96, 0x43, 0x9E,
+    0x06, 0xC8, 0xD4, 0x15, 0xBC, 0x55, 0x6D, 0xA1, 0xD4, 0x25, 0xE3, 0x96, 0x89, 0x60, 0x7A, 0x32,
+    0xBE, 0x67, 0x48, 0xDE, 0xE3, 0xC3, 0x59, 0x9A, 0x38, 0xC9, 0xD9, 0xA0, 0xB5, 0xE9, 0x10, 0x6C,
+    0x38, 0xA9, 0xEF, 0x09, 0x59, 0x75, 0x96, 0x48, 0x88, 0x5C, 0x32, 0x30, 0x3E, 0x65, 0xF8, 0xB3,
+    0xA8, 0xA5, 0x58, 0xDA, 0x92, 0x98, 0xA8, 0x70, 0xBE, 0x4D, 0xF4, 0x5A, 0x22, 0x29, 0xE1, 0x89,
+    0x05, 0x0D, 0xDE, 0x12, 0xF7, 0xD1, 0x96, 0xD1, 0x78, 0x4F, 0xF4, 0xC5, 0xF3, 0x33, 0x3D, 0x31,
+    0x1C, 0x75, 0x24, 0x68, 0x80, 0x59, 0xA2, 0xEF, 0x71, 0x35, 0x31, 0x25, 0x9B, 0xB3, 0xA4, 0x07,
+    0x3B, 0x77, 0x23, 0xCA, 0x6A, 0xEF, 0xB9, 0x2A, 0x5F, 0x28, 0x45, 0x77, 0x2D, 0x10, 0xD3, 0xED,
+    0x00, 0xCE, 0xFF, 0x71, 0x01, 0xA7, 0xC0, 0xCD, 0x43, 0x4C, 0xB3, 0x1B, 0x84, 0x96, 0xA0, 0xE9,
+    0x77, 0x80, 0x4B, 0xE6, 0xC6, 0xBB, 0xCB, 0x75, 0xB9, 0x92, 0x89, 0x55, 0xE3, 0x29, 0xF2, 0xF7,
+    0xC4, 0xCC, 0xE3, 0x14, 0xD6, 0x65, 0x97, 0x05, 0x56, 0xC3, 0x79, 0x70, 0x76, 0x64, 0x9C, 0x4D,
+    0xED, 0xF5, 0xA9, 0x39, 0xD6, 0x6B, 0x73, 0x5C, 0x44, 0xA9, 0x36, 0xC4, 0xF7, 0xF4, 0x41, 0x91,
+    0x96, 0x53, 0xAD, 0xCD, 0x8B, 0x5C, 0x27, 0xB8, 0x2C, 0x2D, 0xA7, 0xFA, 0xAE, 0x2D, 0xFD, 0x53,
+    0xA9, 0x44, 0xA1, 0x9A, 0x2B, 0xB3, 0xE7, 0xB6, 0x9F, 0xDA, 0x70, 0x6E, 0x11, 0x8F, 0xB4, 0x7A,
+    0x3E, 0x33, 0x70, 0x6C, 0xFA, 0x3E, 0x36, 0x01, 0xBA, 0xE5, 0x7F, 0xF9, 0x78, 0x60, 0xEB, 0xCE,
+    0xD4, 0x72, 0x1C, 0x51, 0x15, 0xF0, 0xEF, 0xB4, 0xAB, 0xFC, 0x21, 0xA9, 0xE4, 0x7C, 0xD2, 0x84,
+    0x5D, 0x5A, 0x8F, 0xAB, 0x6E, 0x74, 0x55, 0xFA, 0x49, 0x9F, 0x74, 0x2A, 0xDD, 0xD5, 0x74, 0xEE,
+    0x98, 0x2D, 0x97, 0x45, 0x3B, 0x35, 0xDE, 0xDC, 0xFA, 0x73, 0x61, 0xF3, 0x37, 0xF7, 0x49, 0x93,
+    0x70, 0xE7, 0x0E, 0xD5, 0xCB, 0xEB, 0xB1, 0xED, 0xA0, 0x47, 0xEC, 0x82, 0x0E, 0xD1, 0x9D, 0xEE,
+    0xFA, 0x18, 0x30, 0x24, 0xDC, 0x44, 0xCA, 0xD7, 0x5C, 0x5F, 0x10, 0x7E, 0x3A, 0x90, 0xC0, 0xFC,
+    0xAB, 0x4C, 0xC4, 0x2E, 0x45, 0x55, 0xE9, 0xF3, 0x0E, 0x94, 0x11, 0x72, 0xFD, 0x53, 0x6C, 0x39,
+    0xBD, 0x23, 0xE6, 0xB4, 0x2D, 0x24, 0xBB, 0x16, 0x19, 0x15, 0x41, 0x48, 0xB2, 0x47, 0x0F, 0xD9,
+    0x12, 0x10, 0x97, 0x69, 0x81, 0xDC, 0x82, 0xE3, 0x22, 0x6A, 0xA5, 0xE7, 0xEA, 0x49, 0xD8, 0x13,
+    0x51, 0x49, 0x0D, 0x48, 0x1A, 0xA4, 0xB9, 0x06, 0xFE, 0x2D, 0xD9, 0x92, 0x96, 0x2C, 0xA9, 0x5E,
+    0x97, 0xCB, 0xB2, 0xAB, 0xCF, 0x8E, 0xC9, 0x9A, 0x5C, 0xF2, 0x70, 0x7A, 0x82, 0x51, 0xDB, 0x1D,
+    0x43, 0x5B, 0x4C, 0xBB, 0xFC, 0x22, 0xF0, 0xE9, 0x8E, 0x13, 0xF2, 0x6F, 0xB3, 0x28, 0xED, 0x87,
+    0x75, 0xEB, 0x76, 0xD2, 0xE1, 0x31, 0xD3, 0xDC, 0xA0, 0xBC, 0x9D, 0x89, 0x3B, 0x6C, 0xD7, 0xA2,
+    0xC0, 0xDB, 0xCE, 0x06, 0xA8, 0x66, 0x8D, 0xF5, 0x0B, 0x48, 0x26, 0x47, 0xCE, 0x48, 0x45, 0xC3,
+    0xC6, 0x9F, 0x41, 0x48, 0xC2, 0x84, 0xE8, 0x8D, 0x7B, 0x8E, 0x84, 0x38, 0x27, 0x8A, 0x78, 0x0F,
+    0x30, 0x1C, 0x88, 0xBE, 0x9C, 0xB1, 0x7A, 0x2C, 0x72, 0x60, 0x6A, 0x28, 0xEA, 0x14, 0x9B, 0xED,
+    0x5B, 0x32, 0x9F, 0x09, 0xF2, 0x62, 0x56, 0x38, 0x62, 0x35, 0xEB, 0x1F, 0x58, 0xF3, 0x01, 0x3D,
+    0x1E, 0xDC, 0xA6, 0x22, 0x46, 0x1B, 0x0C, 0x9A, 0x65, 0xE2, 0x1A, 0xCB, 0xD4, 0x65, 0x92, 0x48,
+    0x35, 0xA1, 0xB9, 0xA0, 0x51, 0xDF, 0xA1, 0xD3, 0x9F, 0x7E, 0x8E, 0x4A, 0x0A, 0xA9, 0x84, 0x78,
+    0x23, 0x56, 0x61, 0x05, 0xF3, 0x4C, 0x84, 0x30, 0x74, 0xC6, 0x3D, 0xF2, 0xDC, 0x98, 0x09, 0xCE,
+    0x02, 0x73, 0x21, 0x43, 0x0C, 0xE8, 0xCB, 0x07, 0x2D, 0x5C, 0xE1, 0x0D, 0xA4, 0xAB, 0x33, 0xF0,
+    0x05, 0x28, 0xF2, 0xE6, 0x54, 0x64, 0xC5, 0xBC, 0xB4, 0xF5, 0x3B, 0xB9, 0x44, 0x39, 0x6F, 0x8E,
+    0xAE, 0x0B, 0x04, 0xCF, 0x49, 0xAD, 0x32, 0x5F, 0x2B, 0x58, 0x8A, 0x12, 0x76, 0xBA, 0x44, 0x0A,
+    0xC7, 0x5A, 0x2E, 0x8B, 0x10, 0xAB, 0x97, 0x41, 0xC7, 0x17, 0xC8, 0xAF, 0xC5, 0x68, 0xE9, 0xD2,
+    0x72, 0x83, 0x73, 0x2A, 0xE1, 0x85, 0xA7, 0x0F, 0x8D, 0x9E, 0x2C, 0x53, 0x0C, 0x97, 0x21, 0x81,
+    0xED, 0x72, 0x8C, 0x23, 0xCA, 0x32, 0x0E, 0x8D, 0xCD, 0x32, 0xBD, 0xBF, 0x4C, 0x87, 0x7F, 0x09,
+    0x68, 0xAF, 0x8E, 0x4B, 0x08, 0xB6, 0x5B, 0xE6, 0xA1, 0x71, 0xD9, 0xAB, 0x7C, 0xF9, 0xFD, 0xE2,
+    0xD0, 0x18, 0x69, 0xA6, 0xBF, 0xB2, 0xBF, 0xEE, 0x12, 0xCB, 0x39, 0xD2, 0xD4, 0x36, 0xE9, 0xE7,
+    0x60, 0x7B, 0xCF, 0xED, 0x65, 0xF4, 0x1D, 0x0E, 0x4B, 0x60, 0xF9, 0x17, 0x0D, 0xF9, 0x2A, 0xE0,
+    0x8C, 0x84, 0x65, 0x24, 0x96, 0xD2, 0x36, 0xA1, 0x86, 0xFB, 0xC8, 0xBE, 0x87, 0xFD, 0xD1, 0x35,
+    0x51, 0x63, 0x7B, 0x5B, 0x21, 0xC9, 0xAA, 0xA0, 0x8D, 0x6B, 0xEF, 0x52, 0x0C, 0x9F, 0xD0, 0x79,
+    0x11, 0x34, 0x29, 0xA0, 0xB5, 0xF4, 0x6B, 0x44, 0x4F, 0xE5, 0xD4, 0xF0, 0x81, 0x09, 0x9C, 0xDC,
+    0x68, 0x87, 0x57, 0x6F, 0xAF, 0xF4, 0xAF, 0xDE, 0x5A, 0xE9, 0x5F, 0xBB, 0x95, 0xB6, 0xF1, 0x03,
+    0x57, 0x85, 0x28, 0x03, 0xFE, 0xAD, 0x15, 0xBD, 0xBC, 0x5F, 0x7E, 0x8B, 0xA1, 0xE0, 0x81, 0x73,
+    0xFF, 0x97, 0x80, 0x7E, 0xDF, 0x1E, 0x65, 0xD5, 0xB6, 0xC9, 0x05, 0xDB, 0xC6, 0xB8, 0xEC, 0x8B,
+    0xB6, 0x3D, 0x84, 0x3A, 0x6C, 0xBE, 0xFA, 0x82, 0xB3, 0x40, 0x0E, 0x64, 0x17, 0x33, 0xB1, 0xD1,
+    0xDF, 0x21, 0xAC, 0xC0, 0x09, 0xFA, 0x48, 0x1D, 0x7C, 0xFF, 0xD9, 0xF6, 0x78, 0x85, 0xF7, 0xA4,
+    0x15, 0x8F, 0x81, 0x8E, 0x66, 0xB7, 0xFA, 0x55, 0xB5, 0xC5, 0x0E, 0xE4, 0x3A, 0xC5, 0xB6, 0x98,
+    0xF8, 0xCC, 0x52, 0x9E, 0x8C, 0x8C, 0xB6, 0x1E, 0x35, 0x12, 0x3D, 0xC3, 0x2C, 0x0E, 0xE9, 0x21,
+    0xD6, 0x72, 0x68, 0x77, 0x31, 0xC7, 0x03, 0x17, 0xE2, 0xEC, 0x4F, 0xD8, 0x1B, 0x0B, 0x3F, 0x04,
+    0xBC, 0x75, 0x12, 0x0C, 0x3F, 0x12, 0x3D, 0xDF, 0xA4, 0x54, 0xD7, 0xF9, 0x5A, 0xC5, 0xFC, 0x6B,
+    0x27, 0xE4, 0x7E, 0x93, 0xCA, 0xAC, 0x7B, 0x96, 0xB9, 0x92, 0x32, 0x3D, 0xCE, 0x33, 0xD4, 0xE7,
+    0xF0, 0x23, 0xC6, 0xBC, 0xFD, 0x13, 0x19, 0x94, 0xA4, 0x45, 0x2C, 0x7B, 0xDB, 0x95, 0xF7, 0x86,
+    0xF1, 0xE1, 0x5C, 0x63, 0x00, 0x47, 0x08, 0xBF, 0x28, 0xE9, 0xEB, 0xFF, 0x20, 0x74, 0x0F, 0x60,
+    0x6A, 0xF2, 0x8D, 0xD3, 0x86, 0x94, 0x37, 0xFE, 0x63, 0xBE, 0xF2, 0x62, 0xE1, 0x41, 0x08, 0xAB,
+    0xA0, 0x84, 0x10, 0x6E, 0x23, 0x4D, 0x34, 0x79, 0x13, 0x2D, 0xBE, 0xEC, 0xFE, 0xA9, 0xD1, 0x8C,
+    0x7B, 0x1A, 0xD6, 0x75, 0x5F, 0x88, 0x81, 0x6D, 0x77, 0x5C, 0x19, 0x57, 0x3B, 0x49, 0x95, 0x96,
+    0x3B, 0xA0, 0x45, 0x01, 0xC8, 0x8B, 0x9D, 0xA8, 0x75, 0xD9, 0x04, 0x61, 0xF7, 0x3F, 0x40, 0x2A,
+    0x7B, 0x19, 0xC5, 0x11, 0x49, 0x39, 0x86, 0x48, 0x4A, 0x1E, 0x7B, 0x83, 0x11, 0x07, 0x32, 0xFE,
+    0x18, 0x58, 0x00, 0x4F, 0x69, 0x53, 0x07, 0x86, 0x9C, 0xA0, 0xCC, 0xA4, 0x54, 0x37, 0x9E, 0x0B,
+    0x27, 0x60, 0xC9, 0x9F, 0xE0, 0xC9, 0x33, 0x85, 0x44, 0x36, 0xE7, 0x8E, 0xE9, 0x13, 0x6C, 0xEC,
+    0xC3, 0x03, 0x6A, 0x92, 0x50, 0xBD, 0x36, 0x70, 0x48, 0xBE, 0xB7, 0x91, 0x94, 0xF1, 0xCD, 0x0D,
+    0x5B, 0xA7, 0xEF, 0x6E, 0x44, 0x4D, 0xFE, 0xBD, 0x8D, 0xA0, 0x71, 0xC1, 0x46, 0x50, 0x3B, 0xFF,
+    0xFB, 0x7E, 0xE6, 0xB4, 0x04, 0xA9, 0x88, 0x29, 0xED, 0xE8, 0x9A, 0x44, 0x55, 0x8E, 0xCA, 0x12,
+    0x52, 0xC6, 0x7C, 0x2D, 0x37, 0x32, 0x11, 0x6A, 0x06, 0xF3, 0x73, 0xD0, 0xE2, 0x0F, 0xA4, 0x4E,
+    0xCB, 0x2E, 0xA8, 0x2E, 0x8E, 0x47, 0x48, 0x22, 0xA4, 0x4F, 0x3D, 0x5F, 0xB8, 0x4F, 0xF1, 0x2C,
+    0xCF, 0xAC, 0xF0, 0x3C, 0x34, 0x22, 0xC2, 0x1C, 0x13, 0xA3, 0xEF, 0xF3, 0x7F, 0xC8, 0x56, 0x6A,
+    0x5E, 0x21, 0xF2, 0x48, 0xDF, 0xAB, 0xD7, 0x11, 0x18, 0xB3, 0xFE, 0x48, 0x65, 0x97, 0xFD, 0x69,
+    0x15, 0x57, 0x79, 0x19, 0x97, 0xAE, 0x3C, 0xA0, 0xD5, 0xE9, 0x99, 0x4B, 0x8F, 0xB3, 0xFA, 0x13,
+    0xB5, 0x4C, 0xDA, 0xB0, 0xB2, 0x2A, 0x49, 0xAC, 0x52, 0xD9, 0x7E, 0xD9, 0x74, 0x93, 0xF1, 0xAA,
+    0x98, 0x9F, 0x01, 0xD3, 0x5A, 0xB5, 0x6A, 0x81, 0xFD, 0xFF, 0xFF, 0x1F, 0xB4, 0x80, 0x34, 0x00,
+    0x8D, 0x90, 0x2D, 0x12, 0xC2, 0x30, 0x14, 0x84, 0xB7, 0xC9, 0x30, 0x88, 0x1A, 0x2C, 0x2A, 0x37,
+    0x20, 0x47, 0x48, 0x14, 0x16, 0x2E, 0x81, 0x40, 0x71, 0x84, 0x06, 0xC1, 0x4D, 0xB8, 0x47, 0x73,
+    0x84, 0x1A, 0x3C, 0xA6, 0x06, 0x85, 0x40, 0x30, 0x9D, 0xB6, 0xCB, 0x7B, 0xAD, 0x62, 0x06, 0x81,
+    0xC8, 0x7E, 0x2F, 0xC9, 0xBE, 0xCD, 0x0F, 0x70, 0x8C, 0x00, 0x1C, 0x07, 0xD1, 0xFA, 0xCC, 0x84,
+    0x82, 0x08, 0x0D, 0xCC, 0xA0, 0x6A, 0xBF, 0xB4, 0x60, 0x97, 0xEC, 0x60, 0xC9, 0x2C, 0x75, 0xD5,
+    0x46, 0xFB, 0xC3, 0xF3, 0x9F, 0xDE, 0xB1, 0x1C, 0x11, 0x9E, 0x38, 0xF1, 0xEA, 0xD8, 0x90, 0x7D,
+    0xC9, 0x2C, 0xE7, 0x63, 0x25, 0xA3, 0x38, 0x68, 0x05, 0xCF, 0x97, 0x82, 0x5B, 0xCA, 0xFD, 0x8A,
+    0x1E, 0x6A, 0x30, 0x3D, 0xEA, 0x19, 0x95, 0xDA, 0xE7, 0x59, 0x3D, 0x1A, 0x3E, 0x62, 0xD9, 0x71,
+    0x47, 0x26, 0x97, 0xC3, 0x85, 0x37, 0xF8, 0xE4, 0xA3, 0xEC, 0x85, 0xBC, 0x56, 0x4B, 0x90, 0x24,
+    0x81, 0x93, 0xC7, 0x09, 0x4A, 0xBE, 0x15, 0x86, 0x9C, 0xDA, 0x65, 0x55, 0x21, 0xF9, 0x82, 0x0D,
+    0xBC, 0x22, 0xC0, 0x4D, 0x88, 0x3E, 0x55, 0x0D, 0x7C, 0x2B, 0x3F, 0xC2, 0xBC, 0x94, 0x3E, 0x8D,
+    0x58, 0x88, 0x79, 0x8F, 0x0F, 0x35, 0xCE, 0xB1, 0x11, 0xC2, 0x30, 0x0C, 0x40, 0x51, 0x05, 0x15,
+    0x29, 0x28, 0xCC, 0x06, 0x19, 0x21, 0x0D, 0x7D, 0xE8, 0x59, 0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D,
+    0x8B, 0x30, 0x84, 0x47, 0x70, 0xC3, 0x06, 0x29, 0x52, 0x20, 0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE,
+    0xC5, 0x3B, 0x9D, 0x25, 0xF2, 0x3F, 0xC7, 0x1E, 0xFB, 0xBD, 0xCA, 0x29, 0x92, 0x28, 0x91, 0x85,
+    0x35, 0xD2, 0x1E, 0x81, 0x5A, 0x64, 0x76, 0x4C, 0xF9, 0xB5, 0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F,
+    0x53, 0xF3, 0x29, 0xCC, 0x27, 0x13, 0x7C, 0x94, 0xB2, 0xC0, 0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6,
+    0x09, 0x76, 0x50, 0x47, 0x38, 0x43, 0x1E, 0xE0, 0x4E, 0x13, 0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A,
+    0x8C, 0x4D, 0xC9, 0x22, 0x83, 0x69, 0x8B, 0xFF, 0xAE, 0xBA, 0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41,
+    0x8E, 0xAD, 0xEF, 0x79, 0xE9, 0x39, 0xF8, 0xFD, 0x02,
 };
 
 static const EpdGlyph notoserif_14_boldGlyphs[] = {
@@ -2196,99 +2199,99 @@ static const EpdGlyph notoserif_14_boldGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 6, 22, 178, 3, 21, 33, 0 }, // !
-    { 12, 9, 238, 1, 21, 27, 33 }, // "
-    { 16, 21, 264, 0, 21, 84, 60 }, // #
-    { 14, 26, 264, 1, 23, 91, 144 }, // $
-    { 26, 23, 423, 0, 22, 150, 235 }, // %
-    { 22, 23, 374, 1, 22, 127, 385 }, // &
-    { 6, 9, 135, 1, 21, 14, 512 }, // '
-    { 10, 28, 187, 1, 23, 70, 526 }, // (
-    { 11, 28, 187, 0, 23, 77, 596 }, // )
-    { 13, 13, 234, 1, 23, 43, 673 }, // *
-    { 14, 13, 264, 1, 17, 46, 716 }, // +
-    { 6, 10, 137, 1, 5, 15, 762 }, // ,
-    { 9, 4, 145, 0, 10, 9, 777 }, // -
-    { 6, 6, 137, 1, 5, 9, 786 }, // .
-    { 9, 27, 134, 0, 23, 61, 795 }, // /
-    { 15, 23, 272, 1, 22, 87, 856 }, // 0
-    { 15, 21, 236, 0, 21, 79, 943 }, // 1
-    { 15, 22, 248, 0, 22, 83, 1022 }, // 2
-    { 15, 23, 252, 0, 22, 87, 1105 }, // 3
-    { 16, 21, 260, 0, 21, 84, 1192 }, // 4
-    { 15, 22, 247, 0, 21, 83, 1276 }, // 5
-    { 15, 23, 261, 1, 22, 87, 1359 }, // 6
-    { 15, 21, 253, 1, 21, 79, 1446 }, // 7
-    { 15, 23, 270, 1, 22, 87, 1525 }, // 8
-    { 15, 23, 261, 1, 22, 87, 1612 }, // 9
-    { 5, 17, 142, 2, 16, 22, 1699 }, // :
-    { 6, 21, 142, 1, 16, 32, 1721 }, // ;
-    { 14, 17, 264, 1, 19, 60, 1753 }, // <
-    { 14, 9, 264, 1, 15, 32, 1813 }, // =
-    { 14, 17, 264, 1, 19, 60, 1845 }, // >
-    { 14, 23, 257, 1, 22, 81, 1905 }, // ?
-    { 25, 26, 430, 1, 21, 163, 1986 }, // @
-    { 22, 21, 351, 0, 21, 116, 2149 }, // A
-    { 19, 21, 314, 0, 21, 100, 2265 }, // B
-    { 18, 23, 312, 1, 22, 104, 2365 }, // C
-    { 21, 21, 358, 0, 21, 111, 2469 }, // D
-    { 19, 21, 305, 0, 21, 100, 2580 }, // E
-    { 18, 21, 290, 0, 21, 95, 2680 }, // F
-    { 21, 23, 359, 1, 22, 121, 2775 }, // G
-    { 24, 21, 382, 0, 21, 126, 2896 }, // H
-    { 11, 21, 187, 0, 21, 58, 3022 }, // I
-    { 12, 28, 185, -1, 21, 84, 3080 }, // J
-    { 22, 21, 343, 0, 21, 116, 3164 }, // K
-    { 19, 21, 305, 0, 21, 100, 3280 }, // L
-    { 27, 21, 444, 0, 21, 142, 3380 }, // M
-    { 23, 21, 368, 0, 21, 121, 3522 }, // N
-    { 21, 23, 367, 1, 22, 121, 3643 }, // O
-    { 19, 21, 298, 0, 21, 100, 3764 }, // P
-    { 21, 29, 367, 1, 22, 153, 3864 }, // Q
-    { 21, 21, 332, 0, 21, 111, 4017 }, // R
-    { 16, 23, 270, 0, 22, 92, 4128 }, // S
-    { 19, 21, 305, 0, 21, 100, 4220 }, // T
-    { 22, 22, 349, 0, 21, 121, 4320 }, // U
-    { 21, 21, 326, 0, 21, 111, 4441 }, // V
-    { 32, 21, 498, 0, 21, 168, 4552 }, // W
-    { 22, 21, 342, 0, 21, 116, 4720 }, // X
-    { 21, 21, 323, 0, 21, 111, 4836 }, // Y
-    { 18, 21, 311, 1, 21, 95, 4947 }, // Z
-    { 10, 27, 194, 2, 23, 68, 5042 }, // [
-    { 9, 27, 134, 0, 23, 61, 5110 }, // <backslash>
-    { 9, 27, 194, 1, 23, 61, 5171 }, // ]
-    { 14, 14, 261, 1, 21, 49, 5232 }, // ^
-    { 15, 3, 214, -1, -2, 12, 5281 }, // _
-    { 8, 6, 156, 1, 23, 12, 5293 }, // `
-    { 16, 18, 280, 1, 17, 72, 5305 }, // a
-    { 18, 24, 303, 0, 23, 108, 5377 }, // b
-    { 14, 18, 246, 1, 17, 63, 5485 }, // c
-    { 18, 24, 303, 1, 23, 108, 5548 }, // d
-    { 15, 18, 267, 1, 17, 68, 5656 }, // e
-    { 14, 23, 190, 0, 23, 81, 5724 }, // f
-    { 17, 24, 261, 0, 17, 102, 5805 }, // g
-    { 19, 23, 311, 0, 23, 110, 5907 }, // h
-    { 10, 23, 164, 0, 23, 58, 6017 }, // i
-    { 9, 30, 161, -1, 23, 68, 6075 }, // j
-    { 19, 23, 297, 0, 23, 110, 6143 }, // k
-    { 10, 23, 164, 0, 23, 58, 6253 }, // l
-    { 29, 17, 460, 0, 17, 124, 6311 }, // m
-    { 19, 17, 311, 0, 17, 81, 6435 }, // n
-    { 16, 18, 287, 1, 17, 72, 6516 }, // o
-    { 18, 23, 301, 0, 16, 104, 6588 }, // p
-    { 18, 23, 302, 1, 16, 104, 6692 }, // q
-    { 15, 16, 244, 0, 16, 60, 6796 }, // r
-    { 14, 17, 225, 0, 16, 60, 6856 }, // s
-    { 12, 21, 189, 0, 20, 63, 6916 }, // t
-    { 19, 17, 311, 0, 16, 81, 6979 }, // u
-    { 18, 16, 283, 0, 16, 72, 7060 }, // v
-    { 26, 16, 400, -1, 16, 104, 7132 }, // w
-    { 19, 16, 302, 0, 16, 76, 7236 }, // x
-    { 17, 23, 270, 0, 16, 98, 7312 }, // y
-    { 15, 16, 247, 0, 16, 60, 7410 }, // z
-    { 13, 27, 206, 0, 23, 88, 7470 }, // {
-    { 3, 30, 264, 7, 23, 23, 7558 }, // |
-    { 13, 27, 206, 0, 23, 88, 7581 }, // }
-    { 15, 7, 264, 1, 14, 27, 7669 }, // ~
+    { 12, 9, 238, 1, 21, 27, 0 }, // "
+    { 16, 21, 264, 0, 21, 84, 27 }, // #
+    { 14, 26, 264, 1, 23, 91, 111 }, // $
+    { 26, 23, 423, 0, 22, 150, 202 }, // %
+    { 22, 23, 374, 1, 22, 127, 352 }, // &
+    { 6, 9, 135, 1, 21, 14, 479 }, // '
+    { 10, 28, 187, 1, 23, 70, 33 }, // (
+    { 11, 28, 187, 0, 23, 77, 103 }, // )
+    { 13, 13, 234, 1, 23, 43, 493 }, // *
+    { 14, 13, 264, 1, 17, 46, 536 }, // +
+    { 6, 10, 137, 1, 5, 15, 180 }, // ,
+    { 9, 4, 145, 0, 10, 9, 195 }, // -
+    { 6, 6, 137, 1, 5, 9, 204 }, // .
+    { 9, 27, 134, 0, 23, 61, 582 }, // /
+    { 15, 23, 272, 1, 22, 87, 213 }, // 0
+    { 15, 21, 236, 0, 21, 79, 300 }, // 1
+    { 15, 22, 248, 0, 22, 83, 379 }, // 2
+    { 15, 23, 252, 0, 22, 87, 462 }, // 3
+    { 16, 21, 260, 0, 21, 84, 549 }, // 4
+    { 15, 22, 247, 0, 21, 83, 633 }, // 5
+    { 15, 23, 261, 1, 22, 87, 716 }, // 6
+    { 15, 21, 253, 1, 21, 79, 803 }, // 7
+    { 15, 23, 270, 1, 22, 87, 882 }, // 8
+    { 15, 23, 261, 1, 22, 87, 969 }, // 9
+    { 5, 17, 142, 2, 16, 22, 1056 }, // :
+    { 6, 21, 142, 1, 16, 32, 1078 }, // ;
+    { 14, 17, 264, 1, 19, 60, 643 }, // <
+    { 14, 9, 264, 1, 15, 32, 703 }, // =
+    { 14, 17, 264, 1, 19, 60, 735 }, // >
+    { 14, 23, 257, 1, 22, 81, 1110 }, // ?
+    { 25, 26, 430, 1, 21, 163, 795 }, // @
+    { 22, 21, 351, 0, 21, 116, 1191 }, // A
+    { 19, 21, 314, 0, 21, 100, 1307 }, // B
+    { 18, 23, 312, 1, 22, 104, 1407 }, // C
+    { 21, 21, 358, 0, 21, 111, 1511 }, // D
+    { 19, 21, 305, 0, 21, 100, 1622 }, // E
+    { 18, 21, 290, 0, 21, 95, 1722 }, // F
+    { 21, 23, 359, 1, 22, 121, 1817 }, // G
+    { 24, 21, 382, 0, 21, 126, 1938 }, // H
+    { 11, 21, 187, 0, 21, 58, 2064 }, // I
+    { 12, 28, 185, -1, 21, 84, 2122 }, // J
+    { 22, 21, 343, 0, 21, 116, 2206 }, // K
+    { 19, 21, 305, 0, 21, 100, 2322 }, // L
+    { 27, 21, 444, 0, 21, 142, 2422 }, // M
+    { 23, 21, 368, 0, 21, 121, 2564 }, // N
+    { 21, 23, 367, 1, 22, 121, 2685 }, // O
+    { 19, 21, 298, 0, 21, 100, 2806 }, // P
+    { 21, 29, 367, 1, 22, 153, 2906 }, // Q
+    { 21, 21, 332, 0, 21, 111, 3059 }, // R
+    { 16, 23, 270, 0, 22, 92, 3170 }, // S
+    { 19, 21, 305, 0, 21, 100, 3262 }, // T
+    { 22, 22, 349, 0, 21, 121, 958 }, // U
+    { 21, 21, 326, 0, 21, 111, 3362 }, // V
+    { 32, 21, 498, 0, 21, 168, 3473 }, // W
+    { 22, 21, 342, 0, 21, 116, 3641 }, // X
+    { 21, 21, 323, 0, 21, 111, 3757 }, // Y
+    { 18, 21, 311, 1, 21, 95, 3868 }, // Z
+    { 10, 27, 194, 2, 23, 68, 1079 }, // [
+    { 9, 27, 134, 0, 23, 61, 1147 }, // <backslash>
+    { 9, 27, 194, 1, 23, 61, 1208 }, // ]
+    { 14, 14, 261, 1, 21, 49, 1269 }, // ^
+    { 15, 3, 214, -1, -2, 12, 1318 }, // _
+    { 8, 6, 156, 1, 23, 12, 1330 }, // `
+    { 16, 18, 280, 1, 17, 72, 3963 }, // a
+    { 18, 24, 303, 0, 23, 108, 4035 }, // b
+    { 14, 18, 246, 1, 17, 63, 4143 }, // c
+    { 18, 24, 303, 1, 23, 108, 4206 }, // d
+    { 15, 18, 267, 1, 17, 68, 4314 }, // e
+    { 14, 23, 190, 0, 23, 81, 4382 }, // f
+    { 17, 24, 261, 0, 17, 102, 4463 }, // g
+    { 19, 23, 311, 0, 23, 110, 4565 }, // h
+    { 10, 23, 164, 0, 23, 58, 4675 }, // i
+    { 9, 30, 161, -1, 23, 68, 4733 }, // j
+    { 19, 23, 297, 0, 23, 110, 4801 }, // k
+    { 10, 23, 164, 0, 23, 58, 4911 }, // l
+    { 29, 17, 460, 0, 17, 124, 4969 }, // m
+    { 19, 17, 311, 0, 17, 81, 5093 }, // n
+    { 16, 18, 287, 1, 17, 72, 5174 }, // o
+    { 18, 23, 301, 0, 16, 104, 5246 }, // p
+    { 18, 23, 302, 1, 16, 104, 5350 }, // q
+    { 15, 16, 244, 0, 16, 60, 5454 }, // r
+    { 14, 17, 225, 0, 16, 60, 5514 }, // s
+    { 12, 21, 189, 0, 20, 63, 5574 }, // t
+    { 19, 17, 311, 0, 16, 81, 5637 }, // u
+    { 18, 16, 283, 0, 16, 72, 5718 }, // v
+    { 26, 16, 400, -1, 16, 104, 5790 }, // w
+    { 19, 16, 302, 0, 16, 76, 5894 }, // x
+    { 17, 23, 270, 0, 16, 98, 5970 }, // y
+    { 15, 16, 247, 0, 16, 60, 6068 }, // z
+    { 13, 27, 206, 0, 23, 88, 1342 }, // {
+    { 3, 30, 264, 7, 23, 23, 1430 }, // |
+    { 13, 27, 206, 0, 23, 88, 1453 }, // }
+    { 15, 7, 264, 1, 14, 27, 1541 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 6, 22, 178, 3, 16, 33, 0 }, // U+00A1
     { 15, 21, 264, 1, 21, 79, 33 }, // U+00A2
@@ -2372,19 +2375,19 @@ static const EpdGlyph notoserif_14_boldGlyphs[] = {
     { 16, 24, 287, 1, 23, 96, 7437 }, // U+00F0
     { 19, 23, 311, 0, 23, 110, 7533 }, // U+00F1
     { 16, 24, 287, 1, 23, 96, 7643 }, // U+00F2
-    { 16, 24, 287, 1, 23, 96, 7739 }, // U+00F3
-    { 16, 24, 287, 1, 23, 96, 7835 }, // U+00F4
-    { 16, 24, 287, 1, 23, 96, 7931 }, // U+00F5
-    { 16, 23, 287, 1, 22, 92, 8027 }, // U+00F6
-    { 14, 16, 264, 1, 18, 56, 8119 }, // U+00F7
-    { 16, 19, 287, 1, 17, 76, 8175 }, // U+00F8
-    { 19, 24, 311, 0, 23, 114, 8251 }, // U+00F9
-    { 19, 24, 311, 0, 23, 114, 8365 }, // U+00FA
-    { 19, 24, 311, 0, 23, 114, 8479 }, // U+00FB
-    { 19, 23, 311, 0, 22, 110, 8593 }, // U+00FC
-    { 17, 30, 270, 0, 23, 128, 8703 }, // U+00FD
-    { 18, 30, 301, 0, 23, 135, 8831 }, // U+00FE
-    { 17, 29, 270, 0, 22, 124, 8966 }, // U+00FF
+    { 16, 24, 287, 1, 23, 96, 6128 }, // U+00F3
+    { 16, 24, 287, 1, 23, 96, 7739 }, // U+00F4
+    { 16, 24, 287, 1, 23, 96, 7835 }, // U+00F5
+    { 16, 23, 287, 1, 22, 92, 7931 }, // U+00F6
+    { 14, 16, 264, 1, 18, 56, 8023 }, // U+00F7
+    { 16, 19, 287, 1, 17, 76, 8079 }, // U+00F8
+    { 19, 24, 311, 0, 23, 114, 8155 }, // U+00F9
+    { 19, 24, 311, 0, 23, 114, 8269 }, // U+00FA
+    { 19, 24, 311, 0, 23, 114, 8383 }, // U+00FB
+    { 19, 23, 311, 0, 22, 110, 8497 }, // U+00FC
+    { 17, 30, 270, 0, 23, 128, 8607 }, // U+00FD
+    { 18, 30, 301, 0, 23, 135, 8735 }, // U+00FE
+    { 17, 29, 270, 0, 22, 124, 8870 }, // U+00FF
     { 22, 25, 351, 0, 25, 138, 0 }, // U+0100
     { 16, 21, 280, 1, 20, 84, 138 }, // U+0101
     { 22, 28, 351, 0, 28, 154, 222 }, // U+0102
@@ -3086,98 +3089,98 @@ static const EpdGlyph notoserif_14_boldGlyphs[] = {
     { 9, 4, 145, 0, 10, 9, 162 }, // U+2010
     { 9, 4, 145, 0, 10, 9, 171 }, // U+2011
     { 15, 3, 264, 1, 12, 12, 180 }, // U+2012
-    { 16, 3, 233, -1, 9, 12, 192 }, // U+2013
-    { 31, 3, 467, -1, 9, 24, 204 }, // U+2014
-    { 31, 3, 467, -1, 9, 24, 228 }, // U+2015
-    { 8, 30, 261, 4, 23, 60, 252 }, // U+2016
-    { 14, 6, 192, -1, 0, 21, 312 }, // U+2017
-    { 6, 10, 131, 1, 21, 15, 333 }, // U+2018
-    { 6, 10, 131, 1, 21, 15, 348 }, // U+2019
-    { 6, 10, 137, 1, 5, 15, 363 }, // U+201A
-    { 6, 10, 131, 1, 21, 15, 378 }, // U+201B
-    { 12, 10, 228, 1, 21, 30, 393 }, // U+201C
-    { 12, 10, 228, 1, 21, 30, 423 }, // U+201D
-    { 12, 10, 228, 1, 5, 30, 453 }, // U+201E
-    { 12, 10, 228, 1, 21, 30, 483 }, // U+201F
-    { 12, 27, 223, 1, 23, 81, 513 }, // U+2020
-    { 12, 27, 223, 1, 23, 81, 594 }, // U+2021
-    { 10, 10, 187, 1, 15, 25, 675 }, // U+2022
-    { 10, 10, 233, 3, 15, 25, 700 }, // U+2023
-    { 6, 5, 137, 1, 13, 8, 725 }, // U+2024
-    { 14, 5, 269, 1, 13, 18, 733 }, // U+2025
-    { 23, 6, 426, 2, 5, 35, 751 }, // U+2026
-    { 6, 6, 137, 1, 12, 9, 786 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 795 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 795 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 795 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 839 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 883 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 933 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 983 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 1033 }, // U+202F
-    { 38, 23, 611, 0, 22, 219, 1033 }, // U+2030
-    { 50, 23, 807, 0, 22, 288, 1252 }, // U+2031
-    { 7, 8, 117, 0, 21, 14, 1540 }, // U+2032
-    { 14, 8, 229, 0, 21, 28, 1554 }, // U+2033
-    { 21, 8, 341, 0, 21, 42, 1582 }, // U+2034
-    { 7, 8, 117, 0, 21, 14, 1624 }, // U+2035
-    { 14, 8, 229, 0, 21, 28, 1638 }, // U+2036
-    { 21, 8, 341, 0, 21, 42, 1666 }, // U+2037
-    { 12, 9, 205, 0, 2, 27, 1708 }, // U+2038
-    { 8, 12, 165, 1, 14, 24, 1735 }, // U+2039
-    { 8, 12, 165, 1, 14, 24, 1759 }, // U+203A
-    { 22, 21, 382, 1, 21, 116, 1783 }, // U+203B
-    { 13, 22, 294, 3, 21, 72, 1899 }, // U+203C
-    { 16, 23, 288, 1, 22, 92, 1971 }, // U+203D
-    { 15, 2, 214, -1, 24, 8, 2063 }, // U+203E
-    { 22, 7, 0, -11, 0, 39, 2071 }, // U+203F
-    { 24, 7, 0, -12, 25, 42, 2110 }, // U+2040
-    { 14, 21, 210, 0, 21, 74, 2152 }, // U+2041
-    { 28, 23, 467, 1, 23, 161, 2226 }, // U+2042
-    { 9, 5, 169, 1, 13, 12, 2387 }, // U+2043
-    { 14, 21, 29, -6, 21, 74, 2399 }, // U+2044
-    { 10, 27, 194, 2, 23, 68, 2473 }, // U+2045
-    { 9, 27, 194, 1, 23, 61, 2541 }, // U+2046
-    { 29, 23, 498, 1, 22, 167, 2602 }, // U+2047
-    { 21, 23, 394, 1, 22, 121, 2769 }, // U+2048
-    { 21, 23, 396, 3, 22, 121, 2890 }, // U+2049
-    { 15, 23, 285, 1, 17, 87, 3011 }, // U+204A
-    { 17, 27, 293, 1, 23, 115, 3098 }, // U+204B
-    { 16, 11, 288, 1, 16, 44, 3213 }, // U+204C
-    { 16, 11, 288, 1, 16, 44, 3257 }, // U+204D
-    { 13, 13, 234, 1, 17, 43, 3301 }, // U+204E
-    { 6, 21, 142, 2, 16, 32, 3344 }, // U+204F
-    { 21, 23, 359, 1, 22, 121, 3376 }, // U+2050
-    { 13, 25, 234, 1, 23, 82, 3497 }, // U+2051
-    { 12, 22, 188, 0, 21, 66, 3579 }, // U+2052
-    { 15, 7, 261, 1, 14, 27, 3645 }, // U+2053
-    { 22, 6, 0, -11, 0, 33, 3672 }, // U+2054
-    { 14, 14, 252, 1, 17, 49, 3705 }, // U+2055
-    { 15, 17, 294, 2, 16, 64, 3754 }, // U+2056
-    { 28, 8, 453, 0, 21, 56, 3818 }, // U+2057
-    { 19, 17, 357, 2, 16, 81, 3874 }, // U+2058
-    { 19, 17, 357, 2, 16, 81, 3955 }, // U+2059
-    { 5, 23, 142, 2, 22, 29, 4036 }, // U+205A
-    { 19, 23, 357, 2, 22, 110, 4065 }, // U+205B
-    { 16, 16, 325, 2, 16, 64, 4175 }, // U+205C
-    { 5, 23, 142, 2, 22, 29, 4239 }, // U+205D
-    { 5, 23, 142, 2, 22, 29, 4268 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 4297 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 4297 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 4297 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 4297 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 4297 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 4297 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 4297 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 4297 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 4297 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 4297 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 4297 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4347 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4397 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4447 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4497 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 4547 }, // U+206F
+    { 16, 3, 233, -1, 9, 12, 6224 }, // U+2013
+    { 31, 3, 467, -1, 9, 24, 6236 }, // U+2014
+    { 31, 3, 467, -1, 9, 24, 192 }, // U+2015
+    { 8, 30, 261, 4, 23, 60, 216 }, // U+2016
+    { 14, 6, 192, -1, 0, 21, 276 }, // U+2017
+    { 6, 10, 131, 1, 21, 15, 297 }, // U+2018
+    { 6, 10, 131, 1, 21, 15, 6260 }, // U+2019
+    { 6, 10, 137, 1, 5, 15, 312 }, // U+201A
+    { 6, 10, 131, 1, 21, 15, 327 }, // U+201B
+    { 12, 10, 228, 1, 21, 30, 6275 }, // U+201C
+    { 12, 10, 228, 1, 21, 30, 6305 }, // U+201D
+    { 12, 10, 228, 1, 5, 30, 342 }, // U+201E
+    { 12, 10, 228, 1, 21, 30, 372 }, // U+201F
+    { 12, 27, 223, 1, 23, 81, 402 }, // U+2020
+    { 12, 27, 223, 1, 23, 81, 483 }, // U+2021
+    { 10, 10, 187, 1, 15, 25, 564 }, // U+2022
+    { 10, 10, 233, 3, 15, 25, 589 }, // U+2023
+    { 6, 5, 137, 1, 13, 8, 614 }, // U+2024
+    { 14, 5, 269, 1, 13, 18, 622 }, // U+2025
+    { 23, 6, 426, 2, 5, 35, 6335 }, // U+2026
+    { 6, 6, 137, 1, 12, 9, 640 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 649 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 649 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 649 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 693 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 737 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 787 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 837 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 887 }, // U+202F
+    { 38, 23, 611, 0, 22, 219, 887 }, // U+2030
+    { 50, 23, 807, 0, 22, 288, 1106 }, // U+2031
+    { 7, 8, 117, 0, 21, 14, 1394 }, // U+2032
+    { 14, 8, 229, 0, 21, 28, 1408 }, // U+2033
+    { 21, 8, 341, 0, 21, 42, 1436 }, // U+2034
+    { 7, 8, 117, 0, 21, 14, 1478 }, // U+2035
+    { 14, 8, 229, 0, 21, 28, 1492 }, // U+2036
+    { 21, 8, 341, 0, 21, 42, 1520 }, // U+2037
+    { 12, 9, 205, 0, 2, 27, 1562 }, // U+2038
+    { 8, 12, 165, 1, 14, 24, 1589 }, // U+2039
+    { 8, 12, 165, 1, 14, 24, 1613 }, // U+203A
+    { 22, 21, 382, 1, 21, 116, 1637 }, // U+203B
+    { 13, 22, 294, 3, 21, 72, 1753 }, // U+203C
+    { 16, 23, 288, 1, 22, 92, 1825 }, // U+203D
+    { 15, 2, 214, -1, 24, 8, 1917 }, // U+203E
+    { 22, 7, 0, -11, 0, 39, 1925 }, // U+203F
+    { 24, 7, 0, -12, 25, 42, 1964 }, // U+2040
+    { 14, 21, 210, 0, 21, 74, 2006 }, // U+2041
+    { 28, 23, 467, 1, 23, 161, 2080 }, // U+2042
+    { 9, 5, 169, 1, 13, 12, 2241 }, // U+2043
+    { 14, 21, 29, -6, 21, 74, 2253 }, // U+2044
+    { 10, 27, 194, 2, 23, 68, 2327 }, // U+2045
+    { 9, 27, 194, 1, 23, 61, 2395 }, // U+2046
+    { 29, 23, 498, 1, 22, 167, 2456 }, // U+2047
+    { 21, 23, 394, 1, 22, 121, 2623 }, // U+2048
+    { 21, 23, 396, 3, 22, 121, 2744 }, // U+2049
+    { 15, 23, 285, 1, 17, 87, 2865 }, // U+204A
+    { 17, 27, 293, 1, 23, 115, 2952 }, // U+204B
+    { 16, 11, 288, 1, 16, 44, 3067 }, // U+204C
+    { 16, 11, 288, 1, 16, 44, 3111 }, // U+204D
+    { 13, 13, 234, 1, 17, 43, 3155 }, // U+204E
+    { 6, 21, 142, 2, 16, 32, 3198 }, // U+204F
+    { 21, 23, 359, 1, 22, 121, 3230 }, // U+2050
+    { 13, 25, 234, 1, 23, 82, 3351 }, // U+2051
+    { 12, 22, 188, 0, 21, 66, 3433 }, // U+2052
+    { 15, 7, 261, 1, 14, 27, 3499 }, // U+2053
+    { 22, 6, 0, -11, 0, 33, 3526 }, // U+2054
+    { 14, 14, 252, 1, 17, 49, 3559 }, // U+2055
+    { 15, 17, 294, 2, 16, 64, 3608 }, // U+2056
+    { 28, 8, 453, 0, 21, 56, 3672 }, // U+2057
+    { 19, 17, 357, 2, 16, 81, 3728 }, // U+2058
+    { 19, 17, 357, 2, 16, 81, 3809 }, // U+2059
+    { 5, 23, 142, 2, 22, 29, 3890 }, // U+205A
+    { 19, 23, 357, 2, 22, 110, 3919 }, // U+205B
+    { 16, 16, 325, 2, 16, 64, 4029 }, // U+205C
+    { 5, 23, 142, 2, 22, 29, 4093 }, // U+205D
+    { 5, 23, 142, 2, 22, 29, 4122 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 4151 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 4151 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 4151 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 4151 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 4151 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 4151 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 4151 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 4151 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 4151 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 4151 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 4151 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 4201 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 4251 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4301 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4351 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4401 }, // U+206F
     { 11, 14, 187, 0, 25, 39, 0 }, // U+2070
     { 7, 14, 107, 0, 22, 25, 39 }, // U+2071
     { 12, 13, 187, 0, 24, 39, 64 }, // U+2074
@@ -3254,13 +3257,13 @@ static const EpdGlyph notoserif_14_boldGlyphs[] = {
     { 15, 26, 264, 1, 23, 98, 3614 }, // U+20BF
     { 14, 22, 246, 1, 16, 77, 3712 }, // U+20C0
     { 14, 3, 267, 1, 12, 11, 0 }, // U+2212
-    { 25, 23, 356, 0, 23, 144, 0 }, // U+FB00
-    { 21, 23, 336, 0, 23, 121, 144 }, // U+FB01
-    { 21, 23, 336, 0, 23, 121, 265 }, // U+FB02
-    { 31, 23, 501, 0, 23, 179, 386 }, // U+FB03
-    { 31, 23, 501, 0, 23, 179, 565 }, // U+FB04
-    { 22, 24, 351, 0, 23, 132, 744 }, // U+FB05
-    { 25, 24, 406, 0, 23, 150, 876 }, // U+FB06
+    { 25, 23, 356, 0, 23, 144, 6370 }, // U+FB00
+    { 21, 23, 336, 0, 23, 121, 6514 }, // U+FB01
+    { 21, 23, 336, 0, 23, 121, 6635 }, // U+FB02
+    { 31, 23, 501, 0, 23, 179, 6756 }, // U+FB03
+    { 31, 23, 501, 0, 23, 179, 6935 }, // U+FB04
+    { 22, 24, 351, 0, 23, 132, 0 }, // U+FB05
+    { 25, 24, 406, 0, 23, 150, 132 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -3268,8 +3271,7 @@ static const EpdUnicodeInterval notoserif_14_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3277,8 +3279,7 @@ static const EpdUnicodeInterval notoserif_14_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3288,19 +3289,57 @@ static const EpdUnicodeInterval notoserif_14_boldIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_14_boldGroups[] = {
-    { 0, 3794, 8480, 97, 0 },
-    { 3794, 3272, 9809, 96, 97 },
-    { 7066, 4043, 15989, 128, 193 },
-    { 11109, 4042, 14108, 96, 321 },
-    { 15151, 1271, 2098, 112, 417 },
-    { 16422, 10530, 32303, 256, 529 },
-    { 26952, 2367, 12949, 90, 785 },
-    { 29319, 2135, 4995, 111, 875 },
-    { 31454, 688, 1517, 42, 986 },
-    { 32142, 2139, 4084, 33, 1028 },
-    { 34281, 13, 12, 1, 1061 },
-    { 34294, 440, 1117, 7, 1062 },
-    { 34734, 132, 196, 1, 1069 },
+    { 0, 3339, 7733, 83, 2 },
+    { 3339, 871, 1800, 26, 0 },
+    { 4210, 3257, 9713, 95, 97 },
+    { 7467, 4043, 15989, 128, 193 },
+    { 11510, 4042, 14108, 96, 321 },
+    { 15552, 1271, 2098, 112, 417 },
+    { 16823, 10530, 32303, 256, 529 },
+    { 27353, 2367, 12949, 90, 785 },
+    { 29720, 2048, 4843, 105, 875 },
+    { 31768, 688, 1517, 42, 986 },
+    { 32456, 2139, 4084, 33, 1028 },
+    { 34595, 13, 12, 1, 1061 },
+    { 34608, 181, 312, 2, 1067 },
+    { 34789, 132, 196, 1, 1069 },
+};
+
+static const uint16_t notoserif_14_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_14_boldKernLeftClasses[] = {
@@ -4219,18 +4258,81 @@ static const EpdLigaturePair notoserif_14_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_14_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 0 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_14_bold = {
     notoserif_14_boldBitmaps,
     notoserif_14_boldGlyphs,
     notoserif_14_boldIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notoserif_14_boldGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_14_boldGlyphToGroup,
     notoserif_14_boldKernLeftClasses,
     notoserif_14_boldKernRightClasses,
     notoserif_14_boldKernMatrix,
@@ -4240,4 +4342,8 @@ static const EpdFontData notoserif_14_bold = {
     65,
     notoserif_14_boldLigaturePairs,
     5,
+    notoserif_14_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
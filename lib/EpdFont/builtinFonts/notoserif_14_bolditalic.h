@@ -3,2560 +3,2569 @@
  * name: notoserif_14_bolditalic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_14_bolditalic 14 ../builtinFonts/source/NotoSerif/NotoSerif-BoldItalic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_14_bolditalic 14 ../builtinFonts/source/NotoSerif/NotoSerif-BoldItalic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_14_bolditalicBitmaps[40768] = {
-    0xA5, 0x5A, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0x3E, 0x00, 0xC4, 0x45, 0x6C, 0x4C, 0x04, 0x16, 0xD4,
-    0x64, 0x2C, 0xC6, 0x84, 0xEB, 0x15, 0xB9, 0x68, 0x3C, 0x13, 0x8F, 0x67, 0x97, 0x17, 0x8E, 0x26,
-    0x51, 0xA1, 0xC2, 0x2C, 0xC4, 0xB4, 0x4C, 0x1B, 0x16, 0x66, 0x93, 0x82, 0x13, 0xBF, 0x15, 0x20,
-    0xAB, 0x70, 0x91, 0x42, 0xDB, 0xB8, 0x8E, 0x0A, 0x16, 0xD2, 0x66, 0x26, 0xEB, 0x42, 0xC5, 0x3A,
-    0xB3, 0x14, 0xA0, 0x68, 0x26, 0x29, 0x54, 0x18, 0x52, 0x46, 0xE3, 0x99, 0xA4, 0x08, 0x14, 0xD3,
-    0x51, 0x66, 0x58, 0x08, 0x93, 0x41, 0x2C, 0x70, 0x17, 0xC0, 0xF5, 0xF7, 0x9D, 0x0B, 0xBC, 0xDD,
-    0xA5, 0x56, 0x96, 0xE3, 0x3C, 0x2E, 0xEE, 0x7B, 0x0F, 0xF7, 0xE1, 0xDE, 0xF3, 0xFB, 0x9D, 0x9F,
-    0x4B, 0xB1, 0x95, 0xD8, 0x42, 0x6C, 0xE6, 0x59, 0xF1, 0x26, 0xF1, 0x47, 0xF1, 0x07, 0x09, 0x7A,
-    0x09, 0x3A, 0x09, 0x5A, 0x09, 0x1A, 0x09, 0x6B, 0x09, 0x2B, 0x89, 0x0A, 0xF1, 0x84, 0xAF, 0x4B,
-    0x22, 0x79, 0x25, 0xA5, 0xFE, 0xE5, 0x19, 0xEF, 0xA4, 0x1F, 0x4E, 0x62, 0xFE, 0x69, 0x14, 0xF3,
-    0xA3, 0x41, 0xCC, 0x8B, 0xBD, 0x18, 0x3C, 0xBA, 0x8B, 0x67, 0x57, 0x41, 0x2D, 0x87, 0x41, 0x25,
-    0xEE, 0xD5, 0x5E, 0x17, 0xF1, 0xDA, 0x6D, 0x11, 0xBF, 0xB9, 0x2F, 0x12, 0x54, 0xEF, 0x70, 0x68,
-    0x45, 0xC2, 0xF7, 0x5A, 0x09, 0xAD, 0xB5, 0x99, 0x0E, 0x92, 0xF0, 0x81, 0x1B, 0x61, 0x21, 0xB2,
-    0x1D, 0x67, 0x1C, 0xF0, 0xE8, 0xFD, 0x6B, 0x22, 0xC6, 0xDA, 0xDE, 0x0D, 0x5E, 0xB3, 0xC2, 0x22,
-    0xF5, 0xE1, 0xF2, 0x3C, 0x87, 0xE8, 0xB5, 0x46, 0x24, 0xF6, 0x6B, 0x59, 0x5E, 0x11, 0x07, 0x3E,
-    0xBB, 0x61, 0x1F, 0xF1, 0xE1, 0x49, 0xC4, 0x5E, 0x07, 0x83, 0xE3, 0xF5, 0x1C, 0xFC, 0x7D, 0xC7,
-    0x80, 0xCF, 0x6F, 0x5F, 0x11, 0xCF, 0x82, 0x0A, 0xB1, 0x58, 0x40, 0x72, 0xFC, 0x42, 0x12, 0xC8,
-    0x42, 0x7C, 0x7E, 0xF7, 0x6C, 0x27, 0x1B, 0xFE, 0xCF, 0xC9, 0xCC, 0xFB, 0x1C, 0x5E, 0xC7, 0xF0,
-    0xE3, 0x97, 0x5A, 0x31, 0x8F, 0xE3, 0x46, 0x62, 0x0B, 0x81, 0x79, 0x25, 0x16, 0x96, 0x3F, 0xE4,
-    0x3E, 0xDF, 0xE4, 0x70, 0x9D, 0xC3, 0x33, 0x6B, 0x02, 0xA4, 0xAC, 0xE5, 0x86, 0x04, 0xBF, 0xEE,
-    0x64, 0x5B, 0xE2, 0x6A, 0x90, 0x4E, 0xD2, 0x6C, 0xF0, 0x1B, 0x31, 0x32, 0x40, 0x9A, 0xB9, 0x0C,
-    0x20, 0xEE, 0x5D, 0x6F, 0xD8, 0x12, 0x19, 0xFD, 0x0E, 0x0C, 0x8D, 0x41, 0xDB, 0x3E, 0x9F, 0x8D,
-    0xE1, 0x2F, 0x3F, 0xB2, 0xED, 0xBB, 0xF1, 0xBF, 0xFC, 0x6D, 0xD3, 0x9B, 0x32, 0x4E, 0xAA, 0x21,
-    0x7A, 0xB4, 0x63, 0xB2, 0x41, 0xE4, 0x10, 0x0F, 0x42, 0x7E, 0xAF, 0x62, 0x0C, 0xEA, 0x77, 0xBD,
-    0x1E, 0x0A, 0xC1, 0x83, 0x92, 0xF0, 0x41, 0x6C, 0xF1, 0x30, 0x82, 0xAC, 0xC5, 0xDC, 0xC9, 0xBC,
-    0x56, 0x92, 0x51, 0x09, 0xC8, 0xD6, 0xA4, 0xDC, 0x23, 0x6F, 0xBE, 0x85, 0xC2, 0x24, 0xEC, 0x63,
-    0x08, 0x29, 0x6E, 0xA3, 0xE6, 0x74, 0xD4, 0x3B, 0x5D, 0x0A, 0x91, 0x87, 0x23, 0x7F, 0x19, 0xD8,
-    0xE6, 0xB9, 0x57, 0xA0, 0x93, 0xCC, 0x0C, 0x52, 0xDA, 0xCA, 0x14, 0xC1, 0x68, 0x9A, 0x5D, 0xFC,
-    0x24, 0xE9, 0x06, 0x49, 0x9B, 0x68, 0xEC, 0xC4, 0xD4, 0x01, 0xA4, 0x64, 0x6A, 0x81, 0xC0, 0x30,
-    0xE6, 0xB5, 0x18, 0xB0, 0x86, 0xAD, 0x3B, 0xCF, 0x0E, 0x12, 0xD9, 0x83, 0x4F, 0xED, 0x9E, 0x67,
-    0x27, 0xDF, 0x36, 0xE2, 0x91, 0x0E, 0x53, 0x99, 0x2A, 0x2F, 0x72, 0xF0, 0xBD, 0x2B, 0x2B, 0x10,
-    0xCA, 0x17, 0xCD, 0x29, 0xCD, 0x68, 0x73, 0x12, 0x75, 0xF8, 0x08, 0x2A, 0x4A, 0x88, 0xD5, 0x82,
-    0x00, 0x30, 0x10, 0x81, 0xE7, 0xB8, 0x87, 0x4A, 0xA0, 0x0C, 0xC3, 0x0B, 0xA4, 0xE6, 0xFC, 0x49,
-    0x75, 0x7A, 0x51, 0x5B, 0x78, 0x44, 0x2F, 0xD8, 0x24, 0x76, 0x71, 0xCB, 0xC4, 0xF8, 0x3D, 0x2C,
-    0x58, 0x20, 0x2B, 0x91, 0x3F, 0x9E, 0x85, 0x40, 0xD5, 0xC4, 0xC5, 0x3C, 0x89, 0x09, 0xEE, 0x2B,
-    0x96, 0x8A, 0xCA, 0xE6, 0x55, 0x9E, 0x5A, 0x59, 0x2F, 0x12, 0x94, 0x41, 0x76, 0x94, 0xCA, 0x05,
-    0x84, 0xF1, 0x27, 0x19, 0x7D, 0x06, 0xD2, 0xC1, 0x57, 0xAC, 0xF2, 0x6D, 0x39, 0xF3, 0x82, 0x52,
-    0x9E, 0x8D, 0x2A, 0x49, 0x5F, 0x2E, 0x24, 0xFD, 0xF7, 0xA8, 0xF0, 0xA0, 0x82, 0xBB, 0xD6, 0x56,
-    0xF9, 0x67, 0x8D, 0xEC, 0xDE, 0x98, 0xE4, 0xF2, 0x36, 0x1C, 0x68, 0x05, 0xE3, 0x1E, 0x9E, 0x71,
-    0xF4, 0x7D, 0x7D, 0x36, 0xDA, 0x33, 0xD7, 0x73, 0x77, 0x7E, 0x92, 0xC1, 0xEC, 0xEB, 0xCD, 0x83,
-    0xFD, 0xE2, 0xE9, 0x39, 0x5E, 0x5E, 0x16, 0x76, 0xF1, 0x10, 0x0D, 0x70, 0xDA, 0xCE, 0x6F, 0xAF,
-    0x56, 0xBB, 0xB8, 0xFD, 0xDC, 0x6D, 0xC9, 0x6D, 0x96, 0x5B, 0xB9, 0xBB, 0x2F, 0x97, 0xB2, 0xB4,
-    0x31, 0xAD, 0x69, 0xD3, 0x6A, 0x4D, 0x55, 0x47, 0x47, 0x04, 0x33, 0x35, 0x9D, 0x07, 0x8B, 0x80,
-    0xFF, 0x04, 0xB7, 0x77, 0x70, 0xC1, 0x10, 0xA5, 0x77, 0xD3, 0xB0, 0x55, 0xA1, 0x2F, 0x46, 0x85,
-    0xDB, 0x0B, 0x96, 0x0A, 0x3B, 0x13, 0x55, 0xDE, 0x97, 0x4C, 0x73, 0x85, 0x23, 0x5C, 0x7F, 0xB9,
-    0xEC, 0x04, 0x1B, 0x82, 0xEF, 0x35, 0x62, 0x83, 0x3E, 0x00, 0x85, 0x61, 0xE7, 0x8D, 0x71, 0xEB,
-    0x8D, 0x49, 0xE3, 0x8D, 0xA6, 0xC6, 0x55, 0xF9, 0x63, 0x5E, 0xF9, 0x43, 0x59, 0x04, 0x43, 0x99,
-    0x05, 0x03, 0x30, 0xA0, 0xB7, 0x30, 0x06, 0x0B, 0x25, 0xE1, 0x6A, 0x4A, 0x49, 0xAB, 0x3C, 0x33,
-    0x99, 0xA9, 0x26, 0x49, 0x4E, 0x00, 0x49, 0x16, 0x24, 0x5F, 0x51, 0xC8, 0xA9, 0xA0, 0x17, 0x80,
-    0x92, 0xAD, 0xBC, 0x09, 0x4F, 0xF7, 0x36, 0xF3, 0x1B, 0x2B, 0x6A, 0x3C, 0x3E, 0xF4, 0x1A, 0x4C,
-    0x4E, 0x57, 0xE1, 0xE0, 0xAE, 0xA8, 0x77, 0x0A, 0xA2, 0xEE, 0xA9, 0xB7, 0x94, 0x17, 0x18, 0x80,
-    0xE9, 0x6E, 0xDA, 0xE3, 0x02, 0xF2, 0x9D, 0xA5, 0xE3, 0x5B, 0x6A, 0xF6, 0x84, 0x64, 0x57, 0x84,
-    0xB8, 0x0C, 0xBF, 0x28, 0xF9, 0x33, 0x43, 0x5D, 0x5F, 0x92, 0xBC, 0x98, 0x8D, 0xC6, 0xA3, 0x69,
-    0x05, 0x04, 0x8E, 0x98, 0x8F, 0x1A, 0xDE, 0xA2, 0xC5, 0x85, 0x84, 0xA0, 0x54, 0xD4, 0xF6, 0x9E,
-    0x25, 0x7A, 0xDE, 0x90, 0xA4, 0xF0, 0x8E, 0x88, 0x5C, 0x83, 0x83, 0xAF, 0x9C, 0x83, 0x7B, 0x79,
-    0xEB, 0xDD, 0x72, 0xDD, 0x4D, 0x96, 0xDD, 0xB6, 0xD4, 0x9C, 0xD5, 0x12, 0xC9, 0x92, 0x44, 0xE0,
-    0xE5, 0xEB, 0x96, 0xCE, 0x6A, 0xF7, 0xE8, 0xCF, 0xBA, 0x13, 0xBD, 0x3C, 0x70, 0x9E, 0x2D, 0x1B,
-    0x34, 0xCF, 0x34, 0xC3, 0x57, 0x53, 0x80, 0x61, 0x53, 0x27, 0x80, 0x06, 0x58, 0x0D, 0xE6, 0x26,
-    0x87, 0xD9, 0xFC, 0xDD, 0xE8, 0x56, 0x4A, 0x40, 0x3B, 0x5C, 0x5B, 0x28, 0xD1, 0x0F, 0x00, 0x24,
-    0xDF, 0xEF, 0xE4, 0x1A, 0x24, 0xB3, 0x82, 0x64, 0xDA, 0xB4, 0x09, 0x6A, 0x53, 0x47, 0x10, 0xF9,
-    0x16, 0x38, 0xDE, 0xBD, 0x5D, 0x7E, 0x0C, 0x54, 0x9E, 0xF6, 0xF7, 0xED, 0xDB, 0xCA, 0xB7, 0x0A,
-    0x18, 0xD7, 0x01, 0x95, 0x0A, 0x04, 0x48, 0xAC, 0x6A, 0x78, 0x19, 0x76, 0x6F, 0xDF, 0x11, 0x79,
-    0x87, 0xF6, 0xD0, 0x62, 0x4F, 0x5A, 0x91, 0x28, 0x26, 0x07, 0xFF, 0xF6, 0x80, 0x0E, 0x04, 0x6F,
-    0xF2, 0x7F, 0x52, 0x36, 0x04, 0xDA, 0x4E, 0x9C, 0x17, 0xA9, 0x6A, 0x38, 0x3C, 0xC3, 0x61, 0x9B,
-    0x1A, 0x7A, 0x28, 0x49, 0x03, 0x31, 0x40, 0x02, 0x58, 0x93, 0x2C, 0x13, 0x67, 0xAF, 0xAC, 0xAD,
-    0xD7, 0x2B, 0xF1, 0x6C, 0x74, 0x32, 0xD1, 0xDD, 0x30, 0x3D, 0xE1, 0xA7, 0xB0, 0xFD, 0x5D, 0x20,
-    0x9B, 0x5C, 0x56, 0x05, 0xAB, 0x86, 0x25, 0xFD, 0xCF, 0x9F, 0xE1, 0x17, 0x9F, 0x11, 0x9F, 0x3A,
-    0xA8, 0x3A, 0xAF, 0x30, 0x95, 0x17, 0x30, 0x82, 0xBC, 0x00, 0xDA, 0x94, 0x1C, 0xF2, 0xCC, 0xDD,
-    0x03, 0x90, 0x55, 0x80, 0x8D, 0xA4, 0x86, 0xFF, 0x46, 0xC7, 0x93, 0x03, 0x7F, 0xE7, 0x90, 0xA0,
-    0xD9, 0x16, 0x3A, 0x68, 0x74, 0x8A, 0x3E, 0xBE, 0x3D, 0x81, 0x3B, 0xEC, 0x17, 0x33, 0x3E, 0x3E,
-    0x03, 0x1B, 0xE5, 0x7E, 0x6A, 0x01, 0xD9, 0x39, 0xCB, 0x20, 0x57, 0x8E, 0x18, 0xF2, 0x4F, 0x60,
-    0x00, 0x9D, 0x98, 0x1C, 0x97, 0xC9, 0xE8, 0x74, 0xF2, 0xD4, 0x33, 0x5D, 0xB0, 0x3A, 0x19, 0x89,
-    0x2A, 0x25, 0x11, 0xCA, 0x64, 0x50, 0x9A, 0x29, 0x30, 0xE4, 0x99, 0x4F, 0x56, 0xC5, 0x72, 0x89,
-    0xF2, 0x17, 0x04, 0x1F, 0x4B, 0xC7, 0x25, 0x42, 0x4D, 0xD0, 0x06, 0x00, 0x1C, 0xB0, 0x5C, 0x01,
-    0x9D, 0x72, 0x78, 0x93, 0xD0, 0x9D, 0xDC, 0x90, 0x67, 0xD8, 0x0F, 0x13, 0xAD, 0xC4, 0x4F, 0xCA,
-    0xF3, 0x06, 0xE1, 0x2C, 0xBE, 0xE6, 0x2A, 0x20, 0xA9, 0x7C, 0x6D, 0xE4, 0x96, 0x96, 0xE8, 0x58,
-    0xD2, 0x6D, 0x4A, 0xAA, 0xA4, 0x24, 0x38, 0x5B, 0x7E, 0xE2, 0x00, 0xDD, 0x07, 0x63, 0x32, 0x71,
-    0x15, 0x90, 0x91, 0xFF, 0xEB, 0x9A, 0xD7, 0xA8, 0x73, 0x0C, 0xFF, 0x01, 0xA5, 0xB1, 0x43, 0x69,
-    0x18, 0xA1, 0x8A, 0x1E, 0xD3, 0xF3, 0x2C, 0xD9, 0xBF, 0xC5, 0xDD, 0x0E, 0x83, 0x89, 0xFF, 0xBC,
-    0xFE, 0x2C, 0x4A, 0x5E, 0x52, 0x67, 0x2B, 0x2B, 0xCD, 0x26, 0x80, 0x27, 0x0C, 0x25, 0xFA, 0x97,
-    0x14, 0xF2, 0xC5, 0xD7, 0x2D, 0x6A, 0x1A, 0x6C, 0x82, 0x40, 0x8A, 0xBA, 0xA7, 0x99, 0x5D, 0xAD,
-    0x14, 0x7B, 0xE6, 0x79, 0x75, 0x42, 0x20, 0x04, 0xED, 0x1D, 0xAA, 0x27, 0xD0, 0x2B, 0x58, 0x67,
-    0xCE, 0xE9, 0x09, 0x10, 0x1A, 0x26, 0x88, 0x10, 0xEA, 0x68, 0xEA, 0xB4, 0xB7, 0x9E, 0xBB, 0x7D,
-    0x5B, 0x91, 0x96, 0xD7, 0xD9, 0x0D, 0x37, 0xF7, 0xF7, 0xF7, 0x78, 0x8F, 0xF3, 0xDF, 0x9A, 0x51,
-    0xCE, 0xD4, 0xB3, 0x03, 0x12, 0x10, 0xD4, 0x84, 0x19, 0x41, 0x18, 0x48, 0x71, 0x83, 0x88, 0x83,
-    0x50, 0xC5, 0xE5, 0xB9, 0xCD, 0x4D, 0xCC, 0x7E, 0x6B, 0x6D, 0xBC, 0xA3, 0xC4, 0x93, 0xAD, 0x80,
-    0xC9, 0x0D, 0x8C, 0xAE, 0xE5, 0x15, 0x15, 0xE9, 0x12, 0xDF, 0x2A, 0x8D, 0x36, 0xF4, 0x51, 0x7A,
-    0xC9, 0xE8, 0xB0, 0x9A, 0x68, 0xEB, 0xA4, 0x27, 0x1A, 0x4C, 0x09, 0x64, 0x49, 0xEF, 0x7C, 0x48,
-    0x4D, 0xCC, 0x99, 0x4E, 0xB9, 0xA7, 0xEB, 0x3F, 0xB6, 0x4E, 0x1B, 0x57, 0x6B, 0xE5, 0xD8, 0xEB,
-    0x5C, 0x14, 0x5C, 0x11, 0xAC, 0x5E, 0x01, 0x2D, 0x51, 0x1D, 0xD9, 0x3E, 0x81, 0x68, 0x91, 0xA9,
-    0xC5, 0x59, 0x8A, 0xF4, 0xA1, 0x8B, 0x33, 0xE3, 0xF7, 0x41, 0x1B, 0x67, 0xAF, 0x06, 0x1D, 0xDF,
-    0x1E, 0x46, 0x6D, 0x88, 0xB7, 0x23, 0xE6, 0x07, 0xB1, 0x1C, 0xC5, 0x4D, 0xD4, 0x24, 0x7C, 0x8B,
-    0xEB, 0x2D, 0x39, 0x8A, 0xDA, 0xA4, 0x46, 0xBA, 0x11, 0x74, 0x7F, 0xD2, 0x74, 0xF2, 0xAA, 0x67,
-    0x3F, 0xB1, 0x04, 0xC7, 0xCD, 0x6C, 0x13, 0x04, 0xB9, 0x8C, 0x23, 0x76, 0xF6, 0xAC, 0xE0, 0x58,
-    0xD0, 0x41, 0x05, 0x21, 0x50, 0x92, 0x27, 0x7F, 0x31, 0x2A, 0x81, 0x8A, 0x60, 0xEB, 0x97, 0x63,
-    0xC0, 0xE8, 0x98, 0x93, 0x59, 0x51, 0xDF, 0xF3, 0x69, 0x37, 0x8A, 0x4E, 0x78, 0xFA, 0xC7, 0x64,
-    0x20, 0xA1, 0x54, 0x65, 0x47, 0xC7, 0x95, 0x6A, 0xAE, 0xE3, 0xE8, 0x37, 0x8A, 0xF5, 0xC7, 0x7F,
-    0x3F, 0xD1, 0xCE, 0x88, 0x17, 0x89, 0x02, 0xD4, 0x4D, 0x85, 0xAA, 0x23, 0x95, 0x67, 0x47, 0x77,
-    0x82, 0xBB, 0x22, 0x62, 0xA4, 0x93, 0xBC, 0x60, 0x1F, 0x21, 0x38, 0x1A, 0x45, 0xE2, 0x09, 0xB4,
-    0xE4, 0x44, 0x66, 0x09, 0xA7, 0xD0, 0x52, 0xA5, 0x3E, 0x7E, 0x1F, 0x0E, 0x1E, 0x2C, 0x36, 0xD2,
-    0x31, 0xEE, 0x79, 0x27, 0xEE, 0x18, 0xFD, 0x93, 0x8E, 0xB1, 0x3F, 0x55, 0xF3, 0x30, 0x04, 0x33,
-    0x28, 0x2D, 0x65, 0xD8, 0xAF, 0x63, 0x6A, 0xBC, 0x52, 0xBD, 0x55, 0x34, 0x0B, 0xAB, 0x9F, 0x6D,
-    0xC1, 0xFB, 0x36, 0x03, 0xCE, 0x81, 0xA4, 0xBC, 0xE5, 0xA3, 0xC0, 0xA3, 0xF2, 0x34, 0x00, 0x70,
-    0xB5, 0x06, 0x93, 0x07, 0x00, 0x94, 0x0E, 0x0F, 0x9A, 0x0A, 0x3C, 0x21, 0x96, 0x0D, 0x60, 0xCA,
-    0x6F, 0x94, 0xD7, 0x78, 0x58, 0xE0, 0x92, 0x56, 0xE2, 0x24, 0xE5, 0x86, 0xE6, 0xFC, 0xA0, 0xA0,
-    0x07, 0x26, 0xF9, 0x44, 0x98, 0x45, 0x76, 0xEF, 0x1E, 0x18, 0xB6, 0xA3, 0xDB, 0xC2, 0x01, 0x28,
-    0x58, 0x75, 0x0C, 0x6B, 0x88, 0xF4, 0x41, 0x0B, 0xF6, 0xCC, 0x1B, 0x1A, 0x2C, 0x16, 0x07, 0x73,
-    0x30, 0xAB, 0xD8, 0xFD, 0x75, 0x5C, 0x26, 0xD1, 0x11, 0x53, 0x18, 0xB1, 0x3E, 0xEE, 0xD3, 0x29,
-    0x7B, 0x5A, 0x3F, 0x6E, 0x12, 0xA0, 0x5B, 0xAD, 0x02, 0x34, 0x0D, 0xD4, 0x32, 0x82, 0xA2, 0x07,
-    0x4C, 0x8E, 0xCA, 0x70, 0xA7, 0x0C, 0x17, 0x64, 0xF8, 0x91, 0xDB, 0x9D, 0x91, 0x4E, 0x47, 0x06,
-    0x2A, 0xF5, 0xA0, 0x44, 0x03, 0xF4, 0x35, 0x4D, 0xAB, 0xBE, 0x31, 0x87, 0x04, 0xB5, 0xF0, 0x99,
-    0x69, 0x2E, 0x91, 0x89, 0x8B, 0x2E, 0x8E, 0x51, 0xF5, 0x3D, 0xE7, 0xB7, 0x2E, 0x42, 0x6A, 0xA6,
-    0x76, 0x4B, 0x73, 0xB5, 0x96, 0xBB, 0x03, 0x0F, 0xB0, 0x7B, 0xD8, 0xE8, 0xEE, 0x35, 0x77, 0x67,
-    0x74, 0xCF, 0x95, 0x14, 0x37, 0x62, 0x77, 0x24, 0x9E, 0xEB, 0xDD, 0x63, 0xDD, 0xFD, 0x6B, 0x17,
-    0xEE, 0xEE, 0xCC, 0x53, 0x57, 0x30, 0xC7, 0xFB, 0xD9, 0x97, 0xEC, 0x2E, 0xBA, 0xBB, 0x68, 0x32,
-    0xE8, 0x02, 0x24, 0x09, 0x27, 0xD3, 0xA5, 0x9A, 0xF3, 0xF2, 0xBA, 0xCA, 0x6F, 0x9E, 0x9A, 0x29,
-    0x0D, 0xAB, 0x9A, 0x33, 0x68, 0x12, 0xA6, 0xA2, 0xDB, 0x75, 0xA0, 0xE2, 0x94, 0x7E, 0x9E, 0x84,
-    0x79, 0xC4, 0xC3, 0x95, 0x69, 0xE0, 0x45, 0xC5, 0xAC, 0x8A, 0x86, 0xD8, 0x86, 0xD9, 0x54, 0xFF,
-    0xD6, 0x5A, 0x82, 0x0A, 0x72, 0x82, 0xFD, 0x63, 0x52, 0x97, 0x5A, 0x5D, 0x55, 0x63, 0x68, 0x6E,
-    0x7B, 0xDA, 0xFE, 0x3D, 0xDB, 0xA5, 0x78, 0x83, 0x24, 0x02, 0xB5, 0x7B, 0xCD, 0x24, 0x20, 0x8B,
-    0xD0, 0x65, 0xB8, 0xA1, 0x4B, 0x72, 0x35, 0xD7, 0xED, 0x5C, 0xBA, 0xDB, 0xA9, 0x60, 0x28, 0xD3,
-    0x4E, 0x25, 0x62, 0x1D, 0x68, 0x69, 0x6E, 0x5E, 0x2F, 0xF0, 0x65, 0x5C, 0x86, 0x9E, 0xBB, 0xF4,
-    0xB9, 0x74, 0x19, 0xB4, 0x75, 0x59, 0x32, 0xA3, 0xBF, 0x55, 0x87, 0x84, 0x68, 0xE0, 0x85, 0x94,
-    0x4D, 0x4E, 0x57, 0xC8, 0xD5, 0x17, 0xBB, 0x73, 0x59, 0xDB, 0x92, 0x65, 0x2B, 0xD8, 0x75, 0x73,
-    0xC6, 0x36, 0xC3, 0x24, 0x37, 0xC9, 0xCF, 0x26, 0xEA, 0x85, 0xCB, 0xC2, 0xAD, 0x13, 0xBA, 0x13,
-    0xF9, 0xBC, 0x72, 0x37, 0xE7, 0x48, 0x2A, 0x57, 0x75, 0xA8, 0x68, 0x58, 0x52, 0x0F, 0x55, 0xB4,
-    0x4B, 0x16, 0x9E, 0xF2, 0xAA, 0x7A, 0x51, 0xB1, 0x6A, 0x58, 0x15, 0xCC, 0x4D, 0x48, 0xBB, 0x4B,
-    0xC8, 0x54, 0xC5, 0xBA, 0x70, 0x70, 0xBA, 0xF0, 0x3A, 0xE6, 0xF3, 0xF9, 0x1F, 0xF2, 0x17, 0xF9,
-    0xA3, 0x59, 0xE4, 0xB9, 0x5A, 0x7E, 0x97, 0x3B, 0xD3, 0x47, 0x7E, 0x43, 0x82, 0x60, 0x83, 0x7C,
-    0xF2, 0x48, 0x89, 0xF2, 0x35, 0x97, 0xEC, 0x09, 0x95, 0x20, 0xEC, 0xA6, 0xEA, 0xBF, 0x55, 0x33,
-    0x48, 0x3F, 0x1F, 0x67, 0x23, 0x3C, 0xFB, 0xF6, 0x89, 0x1A, 0x5C, 0x5E, 0x59, 0x47, 0x66, 0x59,
-    0x2B, 0xA1, 0x79, 0xAB, 0xA4, 0x9A, 0x4E, 0x6D, 0x31, 0x1D, 0x94, 0xD2, 0x58, 0x41, 0xE0, 0x51,
-    0xA8, 0xAE, 0xD8, 0x79, 0x65, 0xF5, 0x7F, 0x90, 0x4E, 0xF7, 0x15, 0xD2, 0xB9, 0x42, 0xE9, 0x6C,
-    0x53, 0x3A, 0x87, 0xD4, 0x41, 0xC7, 0x04, 0xA1, 0xA5, 0x91, 0xB4, 0xF4, 0x3B, 0xE4, 0x5D, 0x44,
-    0x52, 0xD5, 0x6F, 0x85, 0x2C, 0x03, 0x3A, 0xA6, 0xD1, 0xD3, 0xE2, 0xE0, 0x99, 0x39, 0x75, 0x0D,
-    0xC2, 0x4F, 0xA8, 0xEF, 0x83, 0xC6, 0xFB, 0x94, 0x3A, 0xBF, 0xD7, 0x04, 0x1F, 0xF0, 0x3D, 0x69,
-    0xA3, 0x37, 0x68, 0x76, 0x49, 0x1B, 0x93, 0x92, 0xAD, 0xB8, 0xDD, 0xA2, 0xAA, 0x76, 0xE2, 0x6E,
-    0x9B, 0xF4, 0x6C, 0xC7, 0xDD, 0xA1, 0xBE, 0x47, 0x7D, 0x4B, 0xAA, 0x56, 0xD1, 0x49, 0x4D, 0xC2,
-    0x0E, 0x43, 0x08, 0x01, 0xB4, 0x75, 0x28, 0x3D, 0xC8, 0x68, 0x0B, 0xF3, 0xA6, 0xA4, 0x5A, 0x05,
-    0x56, 0xF1, 0xDB, 0xA0, 0x57, 0x0B, 0x3C, 0x0E, 0x5A, 0x67, 0x82, 0x7E, 0xE3, 0x64, 0x01, 0x0F,
-    0x80, 0x45, 0xA3, 0x66, 0x42, 0xF5, 0x8B, 0x2B, 0x63, 0x98, 0x0F, 0x95, 0x37, 0x7D, 0x43, 0x61,
-    0x14, 0x01, 0x29, 0x51, 0xFC, 0xC4, 0x77, 0x5A, 0x46, 0x94, 0x18, 0x42, 0x6A, 0x35, 0x2C, 0x31,
-    0xCD, 0xDD, 0x02, 0x9C, 0x82, 0x8A, 0x1D, 0xCF, 0x32, 0xDF, 0x85, 0x3C, 0x5E, 0xD7, 0xB7, 0xFC,
-    0xFD, 0x8A, 0xA1, 0xD7, 0x7C, 0x5A, 0xB1, 0x6E, 0x4A, 0x4F, 0x0A, 0x06, 0xF4, 0x98, 0x56, 0x04,
-    0xB8, 0xB5, 0x1A, 0xDA, 0xE9, 0x7E, 0x7E, 0xEB, 0x8C, 0xF7, 0x58, 0xA3, 0x65, 0x89, 0x8F, 0x0F,
-    0xE5, 0x4C, 0x84, 0x28, 0xA8, 0x45, 0xAB, 0xCE, 0x40, 0x6D, 0x21, 0x5F, 0xA4, 0x37, 0x51, 0xDD,
-    0xFC, 0x8A, 0x88, 0xA3, 0xD1, 0x47, 0x63, 0x10, 0xF3, 0x7E, 0x8C, 0x94, 0x4C, 0x59, 0x99, 0xF5,
-    0x48, 0xCC, 0xA0, 0x41, 0x18, 0x06, 0x1B, 0x6A, 0x91, 0xF8, 0xBB, 0xE0, 0x7E, 0xAC, 0x9E, 0x9D,
-    0xEA, 0xD7, 0x92, 0x3E, 0xFA, 0x78, 0xD4, 0x6D, 0x6B, 0x59, 0xF2, 0x8E, 0xDC, 0x1E, 0x67, 0x8A,
-    0xA0, 0x6A, 0x2F, 0x0C, 0x6D, 0xE1, 0xA8, 0xB0, 0x31, 0x68, 0xBA, 0xA2, 0x63, 0xDC, 0x9F, 0x8E,
-    0x49, 0xA7, 0xEC, 0xB4, 0x4A, 0x6D, 0x4B, 0xC2, 0xCC, 0x31, 0x83, 0x90, 0xB6, 0x61, 0xB4, 0x8A,
-    0xFF, 0x4A, 0xEC, 0xFC, 0x6F, 0xC5, 0xCE, 0x41, 0xBE, 0x44, 0x0E, 0xE1, 0x44, 0x96, 0xBD, 0x59,
-    0x0E, 0xC5, 0x39, 0x39, 0xF4, 0x17, 0xC9, 0xC1, 0xBA, 0xB1, 0xF8, 0x5D, 0xE4, 0x10, 0x31, 0x73,
-    0x3E, 0x2F, 0x07, 0xF5, 0x12, 0xD5, 0xD5, 0x32, 0xFA, 0x4A, 0xEE, 0xCC, 0x80, 0x79, 0x22, 0x73,
-    0x95, 0x76, 0x1A, 0x63, 0x47, 0x3E, 0x45, 0x43, 0x82, 0x73, 0x31, 0xD2, 0x0E, 0x1C, 0x23, 0x1D,
-    0x41, 0x22, 0xC7, 0x8E, 0x09, 0x46, 0xD2, 0x3A, 0x59, 0x45, 0x4E, 0x4A, 0xF5, 0xE2, 0xE1, 0xE6,
-    0x43, 0x6E, 0x00, 0xFF, 0xD6, 0xCE, 0x84, 0x83, 0x3A, 0x4A, 0x0E, 0x2C, 0x68, 0x94, 0x43, 0xA8,
-    0xC7, 0x83, 0x28, 0xE5, 0x20, 0xAB, 0x08, 0xB6, 0x6E, 0x07, 0xAF, 0x2C, 0x96, 0x94, 0x1E, 0xE4,
-    0xA4, 0x27, 0x74, 0xF7, 0x0C, 0xBE, 0x00, 0x16, 0x51, 0x6B, 0x23, 0x21, 0x46, 0xE2, 0xFB, 0x0D,
-    0x27, 0x60, 0xCF, 0x41, 0x9A, 0xE6, 0xAD, 0xDC, 0x46, 0x53, 0x84, 0xD0, 0x7D, 0x57, 0x00, 0x18,
-    0x59, 0x51, 0x6A, 0xF9, 0x81, 0xA2, 0x23, 0xC3, 0xD3, 0x25, 0xCA, 0x74, 0x88, 0x0A, 0xA9, 0x77,
-    0x32, 0x1D, 0x34, 0x4B, 0x15, 0x81, 0x47, 0x23, 0xCB, 0x80, 0xCE, 0xD4, 0x0B, 0x40, 0x53, 0xE4,
-    0x55, 0x8A, 0xA0, 0x5A, 0x56, 0x09, 0xEA, 0x5E, 0x5B, 0x5D, 0x53, 0x64, 0xF8, 0xE6, 0xA2, 0x5B,
-    0x6F, 0x16, 0xDC, 0x19, 0x51, 0xAA, 0x58, 0x5D, 0xCC, 0x53, 0xF8, 0x71, 0xF8, 0xF3, 0xE5, 0x81,
-    0xB8, 0xD5, 0x22, 0x89, 0x4F, 0xC5, 0x2A, 0x25, 0x44, 0xB6, 0xD0, 0x02, 0x6F, 0xFA, 0xC8, 0x36,
-    0xD4, 0xC8, 0xAE, 0x2E, 0xBF, 0xD2, 0xE5, 0x0F, 0x75, 0xF9, 0x4E, 0x97, 0x6F, 0xB5, 0x5C, 0xD0,
-    0x1C, 0xC7, 0x6B, 0xB8, 0xBC, 0xCF, 0x8A, 0x89, 0x2D, 0x10, 0x80, 0x4A, 0x50, 0x71, 0xF9, 0x50,
-    0xD3, 0x19, 0x57, 0x7E, 0xC4, 0x19, 0x51, 0x2E, 0x56, 0xAC, 0x4B, 0x14, 0xF6, 0x76, 0x98, 0x5C,
-    0x79, 0x5A, 0xCC, 0x50, 0x56, 0x9E, 0x75, 0x1C, 0x69, 0x6F, 0xCB, 0x76, 0x09, 0x74, 0x63, 0x9B,
-    0xAB, 0xB6, 0x88, 0x26, 0xB6, 0x01, 0x80, 0x35, 0x70, 0x69, 0xC6, 0xD6, 0x9A, 0x23, 0x30, 0x1D,
-    0xF4, 0xC4, 0xCA, 0xFA, 0x96, 0x8E, 0x2B, 0x15, 0x06, 0x1B, 0x2D, 0xF6, 0x7B, 0x8A, 0xD8, 0x2F,
-    0x2A, 0x7C, 0xBF, 0xAC, 0x5A, 0x79, 0x83, 0x8B, 0x96, 0xFF, 0xA0, 0x4E, 0x72, 0xA4, 0xEE, 0xA7,
-    0xD2, 0xC8, 0xDB, 0xD3, 0xE4, 0xC7, 0x95, 0x8C, 0xC6, 0xED, 0xDE, 0xCA, 0x03, 0x62, 0x06, 0x08,
-    0xC0, 0xD6, 0xE5, 0xA4, 0xC1, 0xBC, 0x67, 0xEB, 0x09, 0x1F, 0x98, 0xDD, 0x14, 0xA4, 0x87, 0xD9,
-    0x9C, 0x06, 0x2B, 0x58, 0xCC, 0x96, 0x0A, 0xDE, 0x8C, 0x64, 0x0A, 0x1F, 0x00, 0x7D, 0x47, 0xFA,
-    0xE1, 0xF3, 0x89, 0xC0, 0xE6, 0x5B, 0xFF, 0x7F, 0x26, 0x46, 0x23, 0xDF, 0x06, 0x1F, 0x59, 0x36,
-    0x89, 0x7C, 0x1B, 0xBD, 0x67, 0x23, 0xED, 0x45, 0xC4, 0x62, 0x63, 0x8D, 0x81, 0x5B, 0x62, 0xEF,
-    0xA8, 0x4A, 0xA1, 0xE1, 0x5D, 0x75, 0x04, 0xE0, 0xBF, 0x52, 0x0B, 0x7A, 0x4A, 0x97, 0xC8, 0x37,
-    0x33, 0xCD, 0x30, 0xB6, 0xBC, 0x99, 0xFD, 0xDC, 0x51, 0x6E, 0xE7, 0x92, 0x18, 0xD2, 0x1C, 0x23,
-    0x8D, 0x0C, 0x50, 0x20, 0x5B, 0x6D, 0x95, 0x56, 0x86, 0xB6, 0x0E, 0xF8, 0xFB, 0xBC, 0x61, 0x73,
-    0x09, 0x5A, 0xD9, 0x52, 0x0B, 0xE8, 0x75, 0xF9, 0x78, 0xD2, 0x35, 0x23, 0xE7, 0x78, 0xA1, 0x75,
-    0xB5, 0x86, 0x73, 0xC6, 0xC8, 0x01, 0x49, 0xE2, 0xE6, 0x56, 0xDA, 0x69, 0xF0, 0x5A, 0x35, 0x9A,
-    0xB0, 0x4A, 0x35, 0x9E, 0xB9, 0xD4, 0x6A, 0xA5, 0x31, 0xD1, 0x1B, 0x14, 0x84, 0x51, 0x13, 0xDC,
-    0x63, 0x11, 0x83, 0x40, 0x01, 0x92, 0x0D, 0xCD, 0x09, 0xDA, 0x7C, 0x33, 0x55, 0x6D, 0xFA, 0x2E,
-    0x47, 0x52, 0x9C, 0x86, 0x85, 0x30, 0x9A, 0x66, 0xCC, 0x03, 0xB6, 0x94, 0x9D, 0x95, 0x02, 0x99,
-    0xB6, 0x8F, 0xDF, 0xD7, 0x52, 0xFE, 0x17, 0x4A, 0xF0, 0x67, 0x4A, 0xC5, 0x78, 0x6A, 0xC9, 0x17,
-    0x64, 0x72, 0x2A, 0x10, 0x15, 0xCB, 0xF3, 0xF6, 0xD8, 0xE5, 0xB9, 0x4E, 0x20, 0xCC, 0x59, 0x13,
-    0x1D, 0xD3, 0x22, 0x00, 0x43, 0x5B, 0x4A, 0xE4, 0xB6, 0x76, 0x6D, 0xB6, 0x17, 0x89, 0xD6, 0x6B,
-    0xA6, 0x23, 0x75, 0xA1, 0x74, 0x38, 0x35, 0x11, 0xE5, 0xDE, 0x4D, 0xC6, 0x6E, 0x72, 0xB1, 0x9F,
-    0x6D, 0x75, 0xFC, 0x95, 0x4E, 0xF6, 0x14, 0x41, 0xE0, 0x52, 0xF4, 0x76, 0xC9, 0xE7, 0x1C, 0x05,
-    0x80, 0xC2, 0xE9, 0xD6, 0xBA, 0x4F, 0xF6, 0x74, 0xC6, 0x55, 0xBA, 0x6C, 0x8B, 0xD7, 0xD2, 0x0D,
-    0x5A, 0x12, 0xB7, 0x60, 0xB8, 0x20, 0x79, 0x3B, 0xD3, 0x72, 0xD3, 0x5C, 0x11, 0x14, 0x6C, 0xEE,
-    0x33, 0x22, 0xBF, 0x83, 0xD7, 0x7D, 0xBC, 0x56, 0xDB, 0xEE, 0xB5, 0x73, 0xE3, 0xC6, 0x8D, 0xAD,
-    0x6B, 0xD7, 0xAE, 0x7D, 0x6D, 0x4D, 0xC6, 0x25, 0x3B, 0xEF, 0x4D, 0xAB, 0x59, 0x67, 0x7C, 0xC5,
-    0x7A, 0xEF, 0x8B, 0xDA, 0x7D, 0xD1, 0xD9, 0x76, 0x5F, 0x27, 0x17, 0xB2, 0x41, 0x83, 0xC4, 0x75,
-    0x97, 0xF9, 0x3C, 0x0F, 0x0A, 0x68, 0xD2, 0xEC, 0x8F, 0x72, 0xFE, 0x67, 0xF8, 0x6D, 0x8B, 0x32,
-    0xAA, 0xB9, 0x0F, 0x5C, 0xD8, 0x86, 0xCE, 0xB7, 0x30, 0x1D, 0xC3, 0x70, 0xA2, 0x62, 0x07, 0x77,
-    0x56, 0x40, 0x0E, 0xE4, 0xD1, 0xB7, 0x36, 0xF7, 0xF7, 0xDF, 0x2C, 0x67, 0x99, 0xDD, 0xC6, 0xA2,
-    0x49, 0x1D, 0xB6, 0xA8, 0xB5, 0x2F, 0xCB, 0xC6, 0xF4, 0xE7, 0x5A, 0xE4, 0x64, 0x48, 0x05, 0xD8,
-    0x4A, 0xA1, 0xC5, 0x30, 0x6C, 0x27, 0xCC, 0x40, 0x4C, 0xCD, 0x86, 0x0C, 0x03, 0x55, 0xC9, 0x4E,
-    0x4D, 0x59, 0x30, 0x12, 0x14, 0xB0, 0x0E, 0x45, 0xF5, 0xB2, 0x38, 0x40, 0x06, 0xF2, 0xD1, 0xCF,
-    0x3B, 0x54, 0xA7, 0xDF, 0xB7, 0x55, 0x3C, 0x32, 0xCA, 0x65, 0x4B, 0xE9, 0x1F, 0x3A, 0xDC, 0xA9,
-    0x97, 0x08, 0x7A, 0x26, 0x3F, 0xD5, 0xA6, 0xE4, 0x4B, 0x3D, 0x66, 0x0D, 0xCF, 0x70, 0xFE, 0x11,
-    0x15, 0xE4, 0x84, 0x90, 0x01, 0x35, 0xE7, 0x18, 0xB8, 0xE1, 0xC8, 0xF2, 0x94, 0xBB, 0xEA, 0x86,
-    0x31, 0x3B, 0x3A, 0x0C, 0x3F, 0xA4, 0x8A, 0xB1, 0x2F, 0x62, 0xCD, 0x80, 0xAC, 0xD4, 0x4C, 0x58,
-    0x6B, 0xB7, 0x1C, 0xE7, 0xEE, 0x3C, 0xA0, 0x96, 0xBC, 0xB4, 0xDE, 0x88, 0x88, 0x8B, 0x7F, 0x71,
-    0x8B, 0xDC, 0xAE, 0xF1, 0xB3, 0x2F, 0xA8, 0x63, 0xDD, 0x83, 0xC7, 0x5C, 0x1B, 0x67, 0x89, 0x65,
-    0x87, 0xA8, 0x3B, 0xDB, 0x66, 0x0A, 0xF4, 0x50, 0xA5, 0x3C, 0x9F, 0x3F, 0x3A, 0x16, 0x0A, 0xD9,
-    0x18, 0x5D, 0x69, 0xE6, 0x64, 0x16, 0xAE, 0x65, 0x96, 0xFE, 0x7F, 0x64, 0xB6, 0xA1, 0x4D, 0xC9,
-    0x99, 0xF6, 0x18, 0xB4, 0xC7, 0x5D, 0xDA, 0xC4, 0xAD, 0xA9, 0x4C, 0x9D, 0xFF, 0x33, 0x03, 0x26,
-    0x56, 0xF8, 0xF8, 0x2B, 0x69, 0xF7, 0x5E, 0x71, 0x49, 0xB7, 0x66, 0xFF, 0xF7, 0xD8, 0x34, 0x1A,
-    0xD8, 0xE5, 0x89, 0x06, 0x3D, 0x4A, 0x38, 0x13, 0xA6, 0xEE, 0x1D, 0xEF, 0x69, 0xBB, 0x90, 0x4A,
-    0xCA, 0xFF, 0x37, 0x7B, 0x0A, 0xAA, 0xCF, 0xD5, 0x8B, 0xA7, 0xD9, 0x8E, 0x8B, 0x88, 0x73, 0x5C,
-    0x9C, 0x4E, 0x23, 0x62, 0xF0, 0x85, 0x88, 0x18, 0x9D, 0x8D, 0x88, 0x6A, 0x75, 0xA9, 0x2B, 0x44,
-    0xB9, 0xD8, 0x0B, 0xD3, 0x29, 0xA4, 0xE8, 0x4D, 0x4E, 0xFF, 0x4A, 0x4B, 0x22, 0xFB, 0x77, 0xAC,
-    0x49, 0xF2, 0x3F, 0xA3, 0x81, 0x13, 0x72, 0x4D, 0xA1, 0xCA, 0xCB, 0xF8, 0x5C, 0x9E, 0xF1, 0xE8,
-    0x23, 0xCF, 0x26, 0x45, 0x2E, 0x8D, 0xFB, 0xDA, 0x2A, 0x48, 0x6E, 0xCB, 0xDC, 0xC8, 0x77, 0xFD,
-    0x4A, 0x46, 0x3B, 0x36, 0x6D, 0xB4, 0x51, 0x82, 0x50, 0xC3, 0x8E, 0xCE, 0x93, 0x03, 0x87, 0xE1,
-    0x56, 0xFB, 0x9A, 0x6E, 0x64, 0x47, 0x30, 0x43, 0x86, 0x30, 0xB7, 0x48, 0x36, 0xEC, 0x93, 0xD3,
-    0x73, 0x80, 0xDF, 0x6E, 0xBB, 0x7F, 0x3A, 0x62, 0x36, 0x85, 0xD9, 0xDA, 0xBF, 0x61, 0x0F, 0xA1,
-    0x46, 0x66, 0x6B, 0x0B, 0x36, 0x5E, 0x31, 0xCF, 0xF4, 0x29, 0x63, 0x8E, 0xA9, 0x25, 0x33, 0x44,
-    0x00, 0x41, 0xC5, 0xED, 0xE2, 0x51, 0xCE, 0x44, 0x9A, 0x60, 0xBA, 0xCC, 0x23, 0xA9, 0x8E, 0x39,
-    0x61, 0xED, 0x7A, 0xB7, 0x57, 0xB4, 0x17, 0x60, 0x0B, 0x26, 0x89, 0x7F, 0xB5, 0xB4, 0xF2, 0xDE,
-    0x86, 0x89, 0xCF, 0x71, 0x11, 0x7F, 0x10, 0xAD, 0xEB, 0x75, 0x24, 0xAE, 0x7E, 0x76, 0x7D, 0x47,
-    0x84, 0x82, 0x4F, 0x60, 0x4D, 0x05, 0x43, 0x44, 0x76, 0x41, 0xCF, 0x6D, 0xE3, 0xB4, 0x81, 0xE5,
-    0xEF, 0xEF, 0x69, 0xBD, 0xA0, 0x5C, 0xE5, 0x8B, 0x57, 0x14, 0xE7, 0x40, 0xEA, 0x1C, 0x40, 0x8E,
-    0x17, 0x03, 0x64, 0xEA, 0x8A, 0x68, 0x8A, 0xE4, 0x05, 0xCA, 0xB5, 0xFB, 0x5D, 0xE5, 0xB6, 0xFF,
-    0xC0, 0xB3, 0x60, 0x1B, 0x7B, 0x58, 0x18, 0x10, 0x53, 0x8F, 0x29, 0x64, 0xE7, 0x91, 0xED, 0x8D,
-    0xE1, 0x21, 0xA3, 0xC3, 0x34, 0xA7, 0x4A, 0x31, 0x7D, 0x2C, 0x6E, 0xF1, 0x70, 0xC2, 0x82, 0x29,
-    0x65, 0x58, 0x84, 0xCF, 0xF3, 0xAC, 0x20, 0x22, 0x4E, 0x68, 0x6D, 0xCB, 0x76, 0x72, 0x48, 0xA9,
-    0xF1, 0x30, 0x98, 0xF0, 0x35, 0x91, 0x64, 0x27, 0xA9, 0xA8, 0x3F, 0x27, 0xAC, 0x59, 0x52, 0xD5,
-    0x72, 0x18, 0xFC, 0x21, 0x6B, 0x27, 0x44, 0x1A, 0x6F, 0x7D, 0xEC, 0xB8, 0xF9, 0x76, 0xD8, 0xFB,
-    0xCC, 0x33, 0xCC, 0x14, 0x53, 0x8D, 0x27, 0xF6, 0xBB, 0xB6, 0x0A, 0xED, 0x8F, 0x6C, 0x83, 0x54,
-    0x1D, 0x8E, 0x0E, 0x84, 0x8A, 0x46, 0x52, 0x5E, 0xC4, 0xEC, 0x77, 0x21, 0x89, 0xEC, 0xB4, 0x48,
-    0x4B, 0x5A, 0xD6, 0x15, 0x9A, 0x12, 0x6B, 0x92, 0x1E, 0xF5, 0xCC, 0x56, 0x6A, 0x9D, 0x35, 0x95,
-    0xBE, 0x01, 0x6F, 0x61, 0x01, 0x57, 0x4A, 0xBE, 0xD9, 0xCE, 0xB2, 0x81, 0xBA, 0xEE, 0xD9, 0x6E,
-    0xBE, 0x05, 0x13, 0xC4, 0xA6, 0x00, 0x12, 0x6C, 0x09, 0x11, 0xBE, 0xC6, 0xA3, 0x65, 0x2C, 0x18,
-    0x8D, 0xB4, 0xA1, 0xF3, 0x80, 0x9C, 0xB6, 0xA1, 0xA6, 0xB5, 0x2A, 0x86, 0x81, 0xCB, 0xF7, 0x5A,
-    0x4A, 0x5D, 0x06, 0x6D, 0xB6, 0xA5, 0x2D, 0x52, 0xCE, 0x97, 0xA1, 0xF4, 0x49, 0x91, 0xD0, 0x9F,
-    0xA2, 0x01, 0xF4, 0x8C, 0x31, 0x3E, 0x19, 0x64, 0x9C, 0xA6, 0xF6, 0x2D, 0x30, 0x76, 0x02, 0xD8,
-    0x4E, 0xE4, 0x11, 0x39, 0xC3, 0x00, 0x84, 0xEA, 0x4A, 0xF6, 0x76, 0x6B, 0x90, 0x69, 0xD9, 0x60,
-    0xE9, 0xD4, 0x1A, 0x37, 0xF6, 0xBF, 0x87, 0x5C, 0xD0, 0xBE, 0xC1, 0x86, 0xCF, 0x0F, 0x50, 0xF6,
-    0xDA, 0x9F, 0x2A, 0xD9, 0x10, 0x27, 0xE0, 0xAC, 0xF5, 0xC8, 0xB8, 0x6F, 0x5D, 0xD5, 0x04, 0x83,
-    0xD6, 0x66, 0xE0, 0x0C, 0x7C, 0x6A, 0xFF, 0xB0, 0xFA, 0x9E, 0xE9, 0x9C, 0x3D, 0x98, 0x8F, 0x5D,
-    0x92, 0xF6, 0x96, 0x6B, 0x68, 0x3B, 0xA4, 0x31, 0xA7, 0x88, 0x4A, 0xBF, 0xD3, 0x24, 0x19, 0x64,
-    0xBF, 0xFC, 0x7B, 0x47, 0xA3, 0x4A, 0x91, 0xF5, 0x3F, 0x98, 0x1C, 0xDC, 0x41, 0x4A, 0x3C, 0x12,
-    0x70, 0x14, 0xFA, 0xDD, 0x56, 0x9A, 0xC0, 0x69, 0xCB, 0xBE, 0xD4, 0xA3, 0x0F, 0x56, 0x6C, 0x00,
-    0x88, 0xCD, 0xB7, 0xA2, 0xCE, 0x0C, 0xF9, 0x10, 0x0E, 0x27, 0x43, 0x38, 0xBD, 0x37, 0x20, 0x43,
-    0xEB, 0x90, 0xA3, 0x64, 0xF1, 0x72, 0x6C, 0xDA, 0x9D, 0x8F, 0xC7, 0xE7, 0x9A, 0x39, 0x5C, 0xF2,
-    0x2A, 0x24, 0x6D, 0xCB, 0x26, 0xE8, 0xE3, 0x96, 0x7D, 0xE8, 0xA8, 0x0B, 0x6A, 0xAD, 0x38, 0xF5,
-    0x30, 0x8B, 0x15, 0x9E, 0x9D, 0xB3, 0xBF, 0xB2, 0xBA, 0x09, 0x4A, 0x72, 0x77, 0x46, 0x58, 0x98,
-    0xFF, 0xA2, 0x70, 0xBB, 0xF5, 0x49, 0x11, 0x52, 0xC7, 0x04, 0xAC, 0xE3, 0xB9, 0xB7, 0x8C, 0x1D,
-    0xFE, 0x68, 0x7A, 0xE5, 0x42, 0x97, 0x37, 0x6B, 0x97, 0x6F, 0xF7, 0x50, 0xE9, 0x31, 0x99, 0xBA,
-    0x85, 0xF4, 0x44, 0x36, 0x0B, 0xE0, 0x84, 0xC6, 0xCD, 0xB2, 0x50, 0x05, 0x70, 0x90, 0xB3, 0x28,
-    0x74, 0x6A, 0x41, 0x11, 0x0F, 0xC5, 0xD9, 0x21, 0x6D, 0x52, 0x0E, 0x3F, 0x84, 0xF5, 0xFD, 0xFA,
-    0x83, 0xE1, 0xB2, 0xB1, 0x2F, 0x5B, 0xD4, 0xBE, 0x4C, 0xE1, 0x32, 0x58, 0xD0, 0xE6, 0x03, 0x14,
-    0x27, 0x79, 0xBF, 0xAC, 0x02, 0xC9, 0x1B, 0x0E, 0x29, 0x1D, 0x6C, 0x8B, 0x47, 0x15, 0x3B, 0x8C,
-    0x00, 0x2B, 0x42, 0x06, 0x3B, 0xD5, 0x6C, 0x2A, 0x58, 0x9E, 0xAF, 0x6A, 0xBE, 0x6D, 0x7F, 0xB0,
-    0x54, 0x66, 0x9A, 0xE2, 0xE5, 0xCB, 0x89, 0xD1, 0xDD, 0x37, 0x91, 0x7C, 0xAC, 0x4A, 0x58, 0x90,
-    0x4C, 0x1A, 0xCF, 0x4B, 0xED, 0x54, 0x9B, 0xA8, 0x83, 0xD8, 0x6F, 0x46, 0x5D, 0x54, 0x66, 0x3B,
-    0x51, 0xF7, 0x6C, 0x99, 0xAD, 0xA2, 0xEE, 0x7A, 0x9E, 0xBD, 0x13, 0xF5, 0xDF, 0xC9, 0x33, 0x44,
-    0xFB, 0x9F, 0xE6, 0x2F, 0xD6, 0x51, 0xDF, 0xE4, 0x2F, 0x15, 0xD1, 0x49, 0x95, 0xBF, 0x21, 0x44,
-    0x80, 0x23, 0xE6, 0x99, 0x79, 0xB7, 0xB4, 0x84, 0x7B, 0x17, 0x5A, 0x14, 0xFE, 0xF7, 0x0B, 0xFF,
-    0x01, 0x50, 0x39, 0xEA, 0x20, 0x26, 0x08, 0x35, 0x6E, 0x77, 0xA8, 0xCB, 0x8E, 0x5D, 0x73, 0x9E,
-    0x02, 0xBB, 0xC2, 0x5C, 0xE6, 0xFE, 0x98, 0x7E, 0x8D, 0xA9, 0xCE, 0x1D, 0xEA, 0x98, 0x5D, 0x1A,
-    0xBF, 0x85, 0xCC, 0xD3, 0x2A, 0x9E, 0x32, 0xC4, 0x07, 0xFC, 0xE6, 0xF9, 0xB7, 0xD8, 0xFB, 0x32,
-    0xF4, 0x63, 0x2C, 0xC1, 0x91, 0x22, 0xE5, 0xE1, 0x87, 0x1E, 0x1E, 0x00, 0x09, 0x14, 0x42, 0x63,
-    0x05, 0xBB, 0x2D, 0x65, 0x78, 0x5B, 0xCD, 0xFC, 0x50, 0xC3, 0x9C, 0x76, 0xEC, 0x7E, 0x49, 0x9B,
-    0x8F, 0x3F, 0x2F, 0x34, 0x6A, 0xAD, 0xAB, 0x6F, 0xD2, 0xBD, 0x9C, 0x3D, 0xE8, 0xB1, 0x83, 0xFE,
-    0x17, 0x03, 0x71, 0x67, 0x29, 0xEE, 0x90, 0xAA, 0x74, 0x1D, 0xB3, 0xDE, 0xE1, 0xF7, 0xFE, 0xDB,
-    0x21, 0x4A, 0xF5, 0xE8, 0x57, 0x77, 0xFA, 0x98, 0xE1, 0x9F, 0x66, 0x48, 0x2E, 0x98, 0x45, 0xD0,
-    0x5A, 0x5D, 0x0B, 0x85, 0xB7, 0x2E, 0x43, 0x2E, 0x7F, 0x8D, 0x5B, 0x9D, 0x69, 0x7D, 0xF6, 0xB6,
-    0x5A, 0x6D, 0x6F, 0xB9, 0xE8, 0x88, 0xE2, 0x11, 0x09, 0xF3, 0x39, 0xEB, 0xBE, 0xA8, 0x55, 0x99,
-    0xC1, 0xB6, 0xDD, 0xC9, 0x0E, 0x77, 0x0F, 0xC7, 0x0B, 0x12, 0xD7, 0x33, 0x71, 0x41, 0xAF, 0xDE,
-    0x75, 0x9F, 0xE4, 0x2E, 0x13, 0xE6, 0xDF, 0xF6, 0x52, 0x4A, 0x12, 0x2C, 0x77, 0xC9, 0x9E, 0xF9,
-    0xAF, 0x0C, 0x4F, 0x85, 0xA1, 0x75, 0x28, 0xD2, 0x33, 0xCE, 0x3D, 0x0D, 0x34, 0x9E, 0xD5, 0x66,
-    0xF1, 0xC5, 0xB9, 0x72, 0xBD, 0x6E, 0xB2, 0xB2, 0xB8, 0x66, 0xBF, 0xEE, 0xEE, 0x1C, 0xFC, 0x60,
-    0x6D, 0xAD, 0x99, 0xBC, 0x76, 0x3B, 0x7D, 0xBD, 0xB9, 0x0F, 0x12, 0x0F, 0x29, 0x22, 0xF8, 0xDE,
-    0x6F, 0x00, 0xCD, 0x5A, 0x4B, 0x8C, 0xDE, 0xD4, 0x15, 0x3E, 0xB6, 0x93, 0xB8, 0x8A, 0x55, 0x39,
-    0x0B, 0x66, 0x01, 0x14, 0xDC, 0x05, 0x8B, 0x28, 0x90, 0xF1, 0xA6, 0x8B, 0x48, 0x9D, 0x89, 0x4D,
-    0x90, 0xCA, 0x22, 0x8B, 0xCC, 0xA2, 0xD3, 0x0D, 0x0B, 0xBA, 0x2D, 0xA8, 0xCD, 0x36, 0x55, 0x27,
-    0xB1, 0x03, 0x0B, 0x96, 0x49, 0xA5, 0x56, 0xEA, 0xAA, 0x64, 0xC1, 0x82, 0x0E, 0x52, 0x13, 0xA9,
-    0x59, 0xA4, 0x22, 0x89, 0x1D, 0x45, 0x6A, 0x17, 0x2C, 0x30, 0x2F, 0xB1, 0xE8, 0xA2, 0x4E, 0x09,
-    0x4D, 0x05, 0x8B, 0x18, 0x61, 0xC0, 0x99, 0xD8, 0xBE, 0xFD, 0xBE, 0x73, 0xFF, 0xC7, 0x4C, 0x80,
-    0x52, 0x01, 0x23, 0xE6, 0x9F, 0xDF, 0xC7, 0xF3, 0xFB, 0x71, 0xCF, 0xE3, 0x9E, 0xF3, 0x9D, 0x73,
-    0xAE, 0x2D, 0x51, 0x2A, 0x59, 0x29, 0x45, 0x45, 0x1A, 0xA7, 0x62, 0x3F, 0x8F, 0x89, 0x2C, 0x89,
-    0xAC, 0x89, 0x74, 0xFC, 0xBA, 0xAD, 0x78, 0xAD, 0xF8, 0x8D, 0x04, 0x8D, 0x84, 0x8D, 0x44, 0x8D,
-    0xC4, 0xB5, 0x24, 0xB5, 0x64, 0xB5, 0xBD, 0x3A, 0xC0, 0x16, 0x62, 0x3B, 0x7E, 0x56, 0x02, 0xD3,
-    0x4B, 0x72, 0x7E, 0x94, 0x71, 0xC9, 0x78, 0xFD, 0xA1, 0x21, 0xE8, 0x4E, 0xBC, 0x14, 0x36, 0x17,
-    0x25, 0x6E, 0x2E, 0xE0, 0x86, 0x06, 0x1B, 0x6E, 0x7C, 0xA3, 0x92, 0xE4, 0xCD, 0x52, 0x92, 0x8F,
-    0xCB, 0x1F, 0x46, 0x9F, 0x5D, 0xAB, 0x03, 0x73, 0xBB, 0x72, 0x8C, 0x49, 0x25, 0xFA, 0x9D, 0x1D,
-    0x26, 0x94, 0xE9, 0x27, 0x1E, 0x53, 0x71, 0x0D, 0x64, 0x0B, 0x5A, 0x30, 0x0D, 0x6B, 0x32, 0xAF,
-    0xC2, 0x4A, 0xE2, 0x72, 0x0F, 0x4E, 0x96, 0x32, 0x25, 0x95, 0x88, 0x67, 0x0C, 0x44, 0x24, 0xC1,
-    0x75, 0x32, 0x25, 0x38, 0x21, 0x11, 0x2F, 0x49, 0xA8, 0xD9, 0x49, 0x6C, 0xCE, 0xDD, 0x9B, 0x6E,
-    0x1A, 0x18, 0x63, 0xF2, 0xC4, 0x98, 0x51, 0xF6, 0x4B, 0xD6, 0xF2, 0xA8, 0xC8, 0x3E, 0x90, 0xB5,
-    0x67, 0x8E, 0xA5, 0x38, 0x2C, 0xE1, 0x1B, 0x83, 0x44, 0xB2, 0x2C, 0x07, 0x41, 0x97, 0x20, 0xCF,
-    0x41, 0x6C, 0x91, 0x2C, 0x4A, 0x98, 0x5F, 0x11, 0x9E, 0x3F, 0x59, 0x9C, 0xC9, 0x79, 0x7D, 0x68,
-    0x6E, 0x98, 0x3A, 0x32, 0xBF, 0x35, 0x95, 0x37, 0x48, 0x22, 0xEE, 0x08, 0x93, 0x39, 0xA3, 0x60,
-    0x44, 0xE3, 0x80, 0xBF, 0xF1, 0xC0, 0xBA, 0x38, 0x0A, 0xD6, 0xD9, 0x31, 0xCA, 0x70, 0x99, 0x04,
-    0x27, 0x63, 0x63, 0x6A, 0x12, 0x48, 0x97, 0x60, 0x3B, 0x50, 0x7C, 0x90, 0x4B, 0x61, 0x0C, 0x2E,
-    0x36, 0x39, 0x2E, 0x81, 0x29, 0xC4, 0x21, 0x79, 0xD4, 0xFC, 0x07, 0xF7, 0xC3, 0xA2, 0x22, 0xCD,
-    0xFC, 0xF3, 0x73, 0x35, 0xCD, 0xB9, 0x4D, 0x47, 0xF4, 0x80, 0x0B, 0xD5, 0xC3, 0x5B, 0x14, 0x63,
-    0x94, 0x53, 0xF8, 0xBB, 0x02, 0xC9, 0xAF, 0xE2, 0x78, 0x86, 0x81, 0x12, 0x0A, 0x33, 0x8A, 0xF7,
-    0xAE, 0xA9, 0xFC, 0xB2, 0x68, 0x82, 0x32, 0xE8, 0x82, 0xDA, 0xE9, 0xFD, 0x41, 0x7A, 0xD7, 0x54,
-    0xAD, 0x14, 0x1B, 0xB5, 0x44, 0xE0, 0xAD, 0x5C, 0x93, 0x7C, 0x97, 0x44, 0xF9, 0x32, 0x94, 0xCD,
-    0x24, 0x4C, 0xB3, 0x34, 0x96, 0xE4, 0xFD, 0x1E, 0x13, 0x8B, 0x31, 0x16, 0x94, 0xD3, 0x15, 0xAF,
-    0x31, 0x7E, 0x3B, 0xFA, 0xCD, 0x09, 0xB7, 0x9A, 0x4C, 0x94, 0x6B, 0xEE, 0x70, 0x1E, 0x36, 0x30,
-    0x55, 0x32, 0x88, 0xDB, 0x89, 0x87, 0xAB, 0x0F, 0x4B, 0x90, 0x67, 0x7D, 0x98, 0x46, 0xDE, 0x27,
-    0x99, 0x57, 0x1E, 0x0C, 0xCA, 0xC8, 0xAD, 0x96, 0xC2, 0xF4, 0x7B, 0x4E, 0x7D, 0x28, 0xA2, 0x4A,
-    0x27, 0xE2, 0x7B, 0xA9, 0x3D, 0xBE, 0x14, 0x42, 0x92, 0x7A, 0x39, 0x2C, 0x3D, 0xB7, 0x8A, 0xBC,
-    0x36, 0xF2, 0xCA, 0x30, 0x2D, 0x30, 0x8E, 0x57, 0xED, 0x86, 0x30, 0x4E, 0x27, 0x0E, 0x2C, 0x92,
-    0xBC, 0x7F, 0x1E, 0x2C, 0xF6, 0x40, 0x2B, 0x7C, 0x76, 0x93, 0x14, 0x7F, 0xF0, 0xFF, 0xDD, 0x47,
-    0xD7, 0xBA, 0xE4, 0x48, 0x9B, 0x79, 0xED, 0x55, 0xAF, 0x19, 0x83, 0xA6, 0x78, 0xB0, 0xC9, 0x3E,
-    0xDE, 0x88, 0x4E, 0x77, 0xB2, 0x37, 0x3D, 0x27, 0x31, 0xA4, 0xEA, 0x31, 0x6C, 0x9B, 0x49, 0x74,
-    0x03, 0x96, 0xBA, 0xDE, 0x49, 0xF2, 0x42, 0x2B, 0x31, 0xF6, 0xE1, 0xB5, 0x5E, 0xFC, 0xEA, 0x0A,
-    0xE4, 0x3E, 0x0C, 0x09, 0x22, 0x59, 0x58, 0x5D, 0xA5, 0x27, 0x54, 0x07, 0xD6, 0x5F, 0x81, 0x4A,
-    0xEE, 0xE7, 0xB6, 0x85, 0x55, 0xC9, 0x4C, 0x9A, 0x19, 0x79, 0x66, 0x5D, 0xBE, 0xC2, 0x06, 0x67,
-    0x4C, 0x0D, 0x1B, 0xF8, 0x9F, 0x5E, 0x81, 0x0D, 0x9C, 0x86, 0x36, 0x70, 0x9A, 0x10, 0x36, 0xC0,
-    0xFF, 0xD0, 0xDB, 0x69, 0x16, 0x49, 0xEF, 0x76, 0x4A, 0x6B, 0xD8, 0xC0, 0x69, 0x5A, 0xD8, 0xC0,
-    0x69, 0x2E, 0xC3, 0x06, 0x4E, 0x73, 0x18, 0x36, 0x70, 0xDB, 0xE8, 0x89, 0x32, 0x3C, 0x36, 0x06,
-    0xB7, 0x61, 0x03, 0xB0, 0xF8, 0x52, 0x1B, 0xC0, 0xA7, 0x7A, 0x48, 0x8D, 0xA0, 0x15, 0x7F, 0xC4,
-    0x8C, 0x96, 0xCB, 0x5E, 0xB5, 0xE6, 0xD6, 0xF8, 0x2E, 0x79, 0x75, 0xF2, 0x54, 0x19, 0x9A, 0xD4,
-    0x79, 0x49, 0x64, 0xAF, 0xCC, 0x03, 0x6D, 0xB2, 0x2D, 0x3C, 0xFD, 0x7B, 0xAB, 0xEF, 0xF9, 0xF5,
-    0xFC, 0xDE, 0x73, 0x9B, 0x02, 0x92, 0xDE, 0x5F, 0x25, 0xEA, 0xB9, 0x08, 0xF7, 0xD6, 0xB9, 0x33,
-    0x78, 0xCD, 0x29, 0xA7, 0x82, 0x9F, 0xF5, 0xE2, 0x20, 0xFE, 0x4A, 0x04, 0x89, 0xB4, 0xBB, 0xFC,
-    0x72, 0x7F, 0xBC, 0x7E, 0x29, 0x31, 0xED, 0x81, 0xF5, 0x73, 0xD3, 0x2B, 0xE1, 0x35, 0x99, 0x9C,
-    0x3B, 0xC5, 0x2B, 0x1F, 0x04, 0x74, 0x54, 0xB4, 0x90, 0xF4, 0x8F, 0x49, 0x7F, 0xD8, 0xE9, 0xE2,
-    0xDB, 0x8D, 0x8F, 0x50, 0x5F, 0x15, 0x6F, 0x94, 0xA0, 0x43, 0x8C, 0xC3, 0x7F, 0x11, 0x90, 0x22,
-    0x0F, 0x9C, 0x73, 0x5F, 0x86, 0x5A, 0xB5, 0x4F, 0x6D, 0xEB, 0x80, 0xB4, 0x0A, 0x71, 0x5F, 0x56,
-    0x86, 0x88, 0xA3, 0xA2, 0x04, 0x2A, 0x20, 0x66, 0x94, 0xA6, 0x31, 0x29, 0x5D, 0xDD, 0x31, 0x0C,
-    0x2B, 0xD7, 0x10, 0xD1, 0x30, 0x20, 0xE2, 0xCA, 0x33, 0x0E, 0xA8, 0x6F, 0x8E, 0x16, 0xD7, 0x24,
-    0x28, 0x86, 0x04, 0x11, 0x1E, 0xB5, 0x31, 0x66, 0xDD, 0x49, 0x11, 0xF9, 0x91, 0xC5, 0x1A, 0xAB,
-    0x9F, 0x22, 0x60, 0xA2, 0xC0, 0x96, 0x68, 0x60, 0x45, 0xF9, 0x4C, 0x79, 0xC0, 0x8B, 0x29, 0x23,
-    0xB3, 0x31, 0xC0, 0x54, 0x04, 0xB3, 0x2F, 0x23, 0x11, 0x49, 0x40, 0xE2, 0xBC, 0x02, 0x22, 0xEE,
-    0x37, 0x20, 0x0F, 0xD6, 0x03, 0x00, 0xBA, 0x26, 0x38, 0xD0, 0x1E, 0x69, 0x52, 0x66, 0x55, 0x56,
-    0x02, 0xA8, 0x61, 0x9E, 0x9A, 0x8E, 0x20, 0x05, 0x24, 0xE5, 0x37, 0x19, 0x54, 0x6E, 0x04, 0x4F,
-    0x91, 0xC3, 0x53, 0xF6, 0xEA, 0x41, 0x38, 0x20, 0x61, 0xEF, 0x32, 0xCD, 0xCE, 0x39, 0xEA, 0xE4,
-    0xD1, 0x31, 0x7F, 0x06, 0x73, 0x5C, 0x9C, 0x0D, 0xEE, 0xB6, 0xF1, 0xB5, 0x3E, 0x91, 0xFE, 0xAA,
-    0xF4, 0x83, 0xD3, 0x0F, 0x88, 0x19, 0xBF, 0x4E, 0x70, 0xEF, 0x1D, 0x71, 0xCF, 0xEE, 0x17, 0xB7,
-    0x81, 0x45, 0x3A, 0x64, 0x07, 0x44, 0x8C, 0x14, 0x80, 0xD3, 0xEC, 0xC9, 0x56, 0xB2, 0xA3, 0x8D,
-    0x8C, 0x51, 0xED, 0x75, 0x49, 0x1A, 0x20, 0x5A, 0xA2, 0xC7, 0x5B, 0x59, 0x26, 0xC8, 0xE1, 0xB2,
-    0x30, 0x85, 0xF5, 0x89, 0x91, 0x05, 0x13, 0xC7, 0xF7, 0xC1, 0x1A, 0x33, 0x74, 0x4A, 0x83, 0xE0,
-    0x8A, 0x04, 0x25, 0x65, 0xA0, 0xA1, 0x7B, 0xC0, 0x2A, 0x73, 0xCA, 0x25, 0xAF, 0x71, 0x3A, 0x04,
-    0x42, 0xED, 0xB6, 0x5E, 0x95, 0x54, 0xCF, 0x8E, 0xC7, 0xF2, 0x57, 0xAB, 0xF5, 0xF5, 0xE3, 0xEE,
-    0xEB, 0xB8, 0x74, 0x2D, 0x00, 0x4F, 0x69, 0x1F, 0x83, 0x2E, 0x6E, 0xF3, 0x57, 0xA4, 0x15, 0xBF,
-    0xA4, 0x57, 0x87, 0xE9, 0x6A, 0xB6, 0x42, 0x8D, 0x12, 0x8E, 0xE6, 0x9A, 0xDC, 0x69, 0x64, 0x0F,
-    0x74, 0x01, 0xF7, 0x45, 0xCE, 0x3D, 0xF8, 0x92, 0x7B, 0x4B, 0xEE, 0x6E, 0x4D, 0xEE, 0x70, 0x48,
-    0x70, 0x87, 0x68, 0xB8, 0xFE, 0xB0, 0x72, 0x27, 0x06, 0x77, 0xCE, 0x47, 0xE6, 0xAC, 0xD3, 0x79,
-    0xFF, 0xB8, 0xD5, 0xB8, 0x6D, 0x70, 0xE6, 0xB9, 0xEE, 0xD9, 0xF1, 0xE9, 0xE0, 0x48, 0xBB, 0xBE,
-    0x7E, 0x52, 0xBC, 0x86, 0xC2, 0x41, 0x5C, 0xB7, 0xA1, 0xB8, 0xB8, 0xFF, 0x12, 0x4C, 0x8A, 0xB0,
-    0xDB, 0x07, 0x07, 0x89, 0xE4, 0x1C, 0x58, 0x5C, 0x5D, 0xAF, 0xC0, 0x02, 0x9E, 0x00, 0xD5, 0xD6,
-    0xD7, 0xA7, 0xDE, 0x51, 0xD4, 0x60, 0xE9, 0x7D, 0x02, 0x14, 0xC1, 0x71, 0xB2, 0x74, 0xCA, 0x81,
-    0x2C, 0x1D, 0x65, 0xF9, 0x54, 0xE5, 0xA8, 0xA7, 0x32, 0x7C, 0xFD, 0x36, 0xC0, 0x4D, 0x4E, 0x17,
-    0x49, 0xBF, 0xE4, 0x74, 0xCB, 0x5E, 0x77, 0xD2, 0x6B, 0xBB, 0xB0, 0x4D, 0xCE, 0xBF, 0xD9, 0x2C,
-    0xB6, 0xC1, 0xE8, 0x97, 0x7F, 0xC1, 0xA5, 0xE1, 0x91, 0xEB, 0xA0, 0x71, 0x40, 0xF3, 0xAD, 0x2D,
-    0x3E, 0x75, 0x13, 0x5A, 0x25, 0x44, 0xF0, 0x7A, 0xE1, 0xE9, 0xB7, 0x29, 0x1E, 0xEC, 0x13, 0x29,
-    0xD3, 0xC3, 0xE2, 0x30, 0xC6, 0x7E, 0xC9, 0x94, 0x41, 0x0C, 0x4A, 0x75, 0x0F, 0xA5, 0xE7, 0x1F,
-    0xBA, 0x31, 0xE6, 0xC2, 0x65, 0xE6, 0x69, 0xF4, 0x12, 0x86, 0x10, 0x7D, 0x25, 0x63, 0xCA, 0x29,
-    0xEF, 0x83, 0x60, 0x71, 0x8E, 0x84, 0x58, 0x16, 0x65, 0x56, 0x26, 0xEF, 0x9B, 0x34, 0x34, 0x83,
-    0xC8, 0x2F, 0x34, 0x14, 0x56, 0x49, 0x74, 0x48, 0x9B, 0x4A, 0x26, 0xF9, 0x54, 0xE7, 0x15, 0x9F,
-    0x95, 0x39, 0x9B, 0xB0, 0x99, 0x07, 0x8D, 0x26, 0x55, 0x61, 0x32, 0x16, 0xF7, 0x43, 0xC2, 0x91,
-    0xF7, 0x1A, 0x69, 0xF0, 0x02, 0x73, 0x59, 0xC4, 0x68, 0x96, 0x65, 0xA5, 0x6B, 0x48, 0x9C, 0x90,
-    0x8E, 0x14, 0xE6, 0x03, 0x90, 0x79, 0x1B, 0xAF, 0x80, 0x86, 0x88, 0x34, 0x06, 0x26, 0x82, 0x98,
-    0x1A, 0x1A, 0xCE, 0x1F, 0x93, 0x13, 0x33, 0x6B, 0x8A, 0x5A, 0x04, 0xE1, 0x1C, 0x8F, 0xC8, 0x8F,
-    0x37, 0x01, 0xC2, 0x89, 0xE2, 0x9D, 0xEC, 0x5E, 0x99, 0x47, 0x6E, 0x41, 0x41, 0x9D, 0x41, 0x63,
-    0x56, 0x0F, 0x38, 0xB2, 0x53, 0xE4, 0x74, 0x7E, 0xAA, 0x32, 0xA8, 0x6C, 0xB1, 0x9A, 0xF5, 0x2A,
-    0xAB, 0x2E, 0xF8, 0x21, 0xCC, 0x0A, 0x38, 0x4A, 0x77, 0x88, 0x9C, 0xBB, 0xEC, 0x8C, 0xE7, 0x17,
-    0x38, 0xFB, 0x1B, 0x10, 0xC2, 0xFB, 0x90, 0xA8, 0xEF, 0xE5, 0x46, 0x25, 0xDC, 0xB5, 0x63, 0xE6,
-    0x5D, 0xA7, 0xB7, 0x23, 0x5E, 0xB8, 0x3D, 0x8B, 0x3E, 0x50, 0x66, 0xA7, 0x26, 0xC8, 0x65, 0xEB,
-    0xE7, 0xBB, 0x95, 0x73, 0x8F, 0x8A, 0x93, 0xA8, 0xC8, 0x27, 0x96, 0x48, 0x2F, 0x3C, 0x44, 0x7A,
-    0xF1, 0xB1, 0xF9, 0xF1, 0xEF, 0x4A, 0x36, 0x96, 0xC3, 0xC3, 0xA6, 0xBD, 0xFB, 0xCF, 0x8E, 0xE9,
-    0x42, 0xFC, 0x33, 0x2D, 0x7B, 0x00, 0x24, 0xCB, 0x46, 0xF7, 0xCB, 0x80, 0x8F, 0x47, 0xB0, 0xBF,
-    0x64, 0x05, 0x75, 0x1A, 0x1B, 0x6D, 0x5E, 0x99, 0x68, 0x3D, 0x80, 0x62, 0x51, 0x4B, 0x91, 0x45,
-    0xD4, 0xAC, 0xDC, 0xAF, 0xD9, 0x72, 0x56, 0xEE, 0xAC, 0xEA, 0x1E, 0x15, 0xBA, 0xFA, 0x4E, 0xF0,
-    0xCE, 0xCF, 0xD4, 0xEF, 0x55, 0x42, 0xF8, 0xFB, 0x32, 0x93, 0x34, 0x80, 0x11, 0x05, 0xD3, 0x00,
-    0xF4, 0x04, 0x4C, 0xA1, 0x2E, 0x8D, 0x28, 0xE3, 0x79, 0x5B, 0xA6, 0xA3, 0x39, 0xB0, 0x77, 0xDA,
-    0x98, 0x01, 0xD0, 0x9A, 0xF3, 0xBD, 0x84, 0x2D, 0x2E, 0x4B, 0x4A, 0xDC, 0x63, 0x52, 0xB7, 0xC7,
-    0x10, 0xAE, 0x56, 0x09, 0x12, 0xAA, 0x99, 0x68, 0x3D, 0x16, 0x04, 0xD6, 0xA6, 0x96, 0xD4, 0x5B,
-    0x09, 0x8F, 0xC5, 0x2D, 0xAB, 0x78, 0x80, 0x36, 0x5A, 0x82, 0xB3, 0xC7, 0x61, 0x1A, 0xEA, 0x4F,
-    0x16, 0xE2, 0xBD, 0x4D, 0x91, 0x75, 0x12, 0x7A, 0x99, 0x02, 0x2A, 0xFF, 0x53, 0x8B, 0x15, 0x67,
-    0xF9, 0x73, 0xC1, 0x16, 0x0B, 0xD5, 0xDC, 0xBB, 0xF4, 0x06, 0x4D, 0xB7, 0xF8, 0xDC, 0x37, 0x73,
-    0xBD, 0x4C, 0x15, 0xB0, 0x14, 0x92, 0x22, 0x7D, 0x51, 0x45, 0xD0, 0x5E, 0x1E, 0x86, 0x41, 0x7A,
-    0xB9, 0x5F, 0x14, 0x93, 0x41, 0x75, 0x00, 0x15, 0x9F, 0xD5, 0x5C, 0xAA, 0x15, 0x57, 0x3A, 0xAB,
-    0x48, 0x94, 0x55, 0xA6, 0x00, 0x5C, 0x28, 0x45, 0x5D, 0xB0, 0xA2, 0x6D, 0x83, 0x96, 0x40, 0x0E,
-    0xE1, 0x9D, 0x90, 0x87, 0x5B, 0x11, 0xAD, 0x85, 0x31, 0xB6, 0x6E, 0xB0, 0xA0, 0xA3, 0xE6, 0x61,
-    0xF7, 0xC6, 0x91, 0xF2, 0xA9, 0x3E, 0x9B, 0x31, 0xFC, 0xBB, 0x96, 0xD3, 0x1A, 0x94, 0x05, 0x34,
-    0xCE, 0x53, 0xCE, 0xE0, 0x86, 0x4E, 0x64, 0xBA, 0xA6, 0xE6, 0xBC, 0x6F, 0xA7, 0xC8, 0x69, 0x3D,
-    0x31, 0xA5, 0xF9, 0x92, 0xE7, 0x94, 0x1E, 0xE9, 0xD5, 0xF1, 0xDB, 0xAD, 0x90, 0xF3, 0xDD, 0xCA,
-    0x49, 0x6B, 0x72, 0xB6, 0xFD, 0x56, 0xCB, 0x10, 0xDB, 0xFF, 0xEE, 0x9A, 0x4A, 0xD6, 0x61, 0x6B,
-    0x45, 0x61, 0x63, 0xB0, 0xBE, 0xC1, 0xF2, 0x9A, 0xD2, 0x50, 0x96, 0xC8, 0x16, 0x0B, 0xBA, 0x51,
-    0x06, 0x4A, 0x40, 0xFE, 0x85, 0x56, 0x0C, 0xB6, 0x51, 0x35, 0xA9, 0x62, 0x4C, 0x6C, 0x6E, 0x82,
-    0x63, 0x3B, 0x2D, 0x16, 0x38, 0xA2, 0x55, 0x47, 0x7B, 0xF3, 0x93, 0x5B, 0x3C, 0x8C, 0x6C, 0x95,
-    0xAF, 0xBD, 0x4C, 0x01, 0x4C, 0xDD, 0x32, 0xD0, 0xD0, 0xED, 0xA6, 0xB7, 0xCE, 0xE3, 0x37, 0x9E,
-    0x87, 0x6E, 0x35, 0xB5, 0x81, 0x9A, 0x40, 0x67, 0x62, 0xD6, 0x2F, 0x53, 0x10, 0x95, 0x64, 0x2A,
-    0x0A, 0x95, 0x2F, 0x2A, 0x75, 0xA3, 0xE0, 0x5F, 0xE8, 0xF1, 0xD2, 0xCB, 0x33, 0x07, 0xDA, 0x1E,
-    0xDD, 0xD9, 0x29, 0xF4, 0x92, 0x5C, 0x1B, 0x74, 0x7B, 0x98, 0x75, 0xA3, 0x6C, 0x9F, 0xAD, 0xE1,
-    0x53, 0x67, 0x95, 0x72, 0xCC, 0xD1, 0x65, 0x77, 0x33, 0x70, 0x3D, 0x06, 0x63, 0x63, 0x18, 0x8C,
-    0x1E, 0x75, 0x1C, 0x9F, 0xDF, 0x96, 0x00, 0x17, 0x91, 0x02, 0x81, 0xEB, 0x09, 0xED, 0xC8, 0x09,
-    0xD7, 0x80, 0x17, 0xAE, 0x07, 0x37, 0xC0, 0x21, 0xF8, 0xA1, 0x2D, 0xC3, 0x50, 0xFC, 0xE6, 0x64,
-    0x67, 0xD2, 0x60, 0xD0, 0x46, 0xAA, 0x55, 0xCF, 0xD2, 0x55, 0x8A, 0x9B, 0xB2, 0x29, 0xFF, 0x17,
-    0x79, 0xA3, 0xE5, 0xE1, 0x06, 0x27, 0x08, 0x15, 0x02, 0xE7, 0xC4, 0x4F, 0x27, 0x60, 0xBD, 0xA9,
-    0x46, 0xC8, 0x06, 0xC0, 0x3F, 0xF8, 0x18, 0xEC, 0x6A, 0x6C, 0x44, 0x7D, 0xB4, 0x53, 0x25, 0x57,
-    0x99, 0xB8, 0x43, 0x7C, 0x07, 0x90, 0x9E, 0xB5, 0xF6, 0xD3, 0x0D, 0xA3, 0x28, 0x84, 0x84, 0x8D,
-    0xA6, 0x3B, 0x16, 0xCE, 0x8B, 0x50, 0x11, 0x1C, 0x96, 0x1D, 0xC3, 0xEE, 0x7B, 0x49, 0xCC, 0xF3,
-    0xBA, 0xCB, 0xAE, 0xB3, 0x57, 0x90, 0xE4, 0x16, 0x76, 0x97, 0x24, 0xBE, 0x9B, 0xB3, 0xCE, 0x0D,
-    0xC9, 0x9D, 0xED, 0x97, 0x56, 0xBE, 0x1E, 0x8B, 0xE2, 0xC6, 0xDA, 0x6E, 0x43, 0x64, 0xA4, 0x7F,
-    0x4C, 0xC0, 0xDC, 0x2E, 0x66, 0xD8, 0xA0, 0x8A, 0x34, 0xC0, 0x7C, 0x9B, 0xD6, 0xBA, 0x7B, 0xD0,
-    0x1B, 0xBA, 0xE7, 0xF4, 0x30, 0xA3, 0xF3, 0xC5, 0x59, 0x4C, 0x4A, 0x4E, 0x08, 0x0D, 0x54, 0xF2,
-    0x67, 0x51, 0x72, 0x4A, 0xD1, 0x93, 0x92, 0x56, 0x9C, 0xCE, 0xAC, 0xE2, 0x64, 0x16, 0x65, 0x32,
-    0xA3, 0xA6, 0xD4, 0x45, 0x98, 0x34, 0x61, 0xFA, 0xA2, 0xF1, 0x89, 0x07, 0xD3, 0xF9, 0xE2, 0x1C,
-    0xB5, 0x5C, 0x54, 0xC3, 0xCF, 0x02, 0x3D, 0x8F, 0xF9, 0x70, 0x50, 0xB6, 0xD5, 0xA6, 0xE0, 0xB1,
-    0x18, 0x1E, 0x58, 0x0C, 0xAF, 0xE7, 0xBD, 0xAA, 0x95, 0x36, 0xDD, 0x61, 0xD2, 0x4E, 0xDA, 0x06,
-    0xF5, 0x07, 0x3D, 0x11, 0xB1, 0x9F, 0x41, 0x47, 0xD6, 0xEA, 0x35, 0xFB, 0x76, 0x94, 0xB4, 0xB6,
-    0x3B, 0x88, 0x6A, 0x96, 0x62, 0xD9, 0xC8, 0xC0, 0xDD, 0x60, 0xF6, 0x71, 0x6A, 0x8B, 0xBB, 0xCE,
-    0x0E, 0xB3, 0xAD, 0x5D, 0xA8, 0x50, 0x37, 0xCD, 0x9E, 0xE8, 0x67, 0x74, 0x51, 0x9A, 0x7B, 0x2A,
-    0xDE, 0x1D, 0x21, 0xED, 0x21, 0xF9, 0xC1, 0x29, 0x39, 0x15, 0x9D, 0xEE, 0xFC, 0x5B, 0xB5, 0x43,
-    0x08, 0x81, 0x5B, 0xE4, 0xF8, 0x1F, 0x47, 0x70, 0xFC, 0x90, 0x3C, 0xB4, 0x45, 0xE4, 0x20, 0xE5,
-    0xFD, 0x7F, 0x54, 0xB1, 0xFB, 0xB9, 0xD8, 0xAE, 0x8A, 0xED, 0xAB, 0xD8, 0xA1, 0x8A, 0xBD, 0xA4,
-    0x62, 0x5F, 0xA4, 0xD8, 0x4E, 0x4D, 0xB1, 0xBD, 0x92, 0x02, 0x87, 0x2A, 0xF6, 0x41, 0x15, 0xFB,
-    0x84, 0x8A, 0xDD, 0x50, 0xEC, 0xF7, 0x2A, 0x8A, 0xFD, 0x61, 0x4A, 0xB1, 0xC7, 0x09, 0x24, 0xCE,
-    0xC4, 0xF6, 0x54, 0x6C, 0xFF, 0x36, 0xC5, 0x0E, 0xB7, 0x18, 0x59, 0xBD, 0x58, 0x2C, 0x9C, 0x25,
-    0x0A, 0x14, 0xDA, 0x5B, 0x10, 0x51, 0xB6, 0xCC, 0x47, 0x6C, 0x06, 0xDF, 0x34, 0xB1, 0xE9, 0x02,
-    0x53, 0x53, 0xD4, 0x93, 0x0A, 0x38, 0x6B, 0x8A, 0x3E, 0x97, 0x14, 0xF7, 0xB5, 0xA8, 0xC5, 0x04,
-    0x81, 0xA3, 0xA3, 0xF8, 0xEC, 0xD4, 0x04, 0x67, 0xA0, 0x1A, 0x84, 0x41, 0xF1, 0x8B, 0x3C, 0xED,
-    0x95, 0x34, 0xA9, 0xAF, 0x50, 0x8C, 0xE6, 0x05, 0x46, 0x0E, 0x53, 0xE2, 0x73, 0xA8, 0x19, 0x21,
-    0xD2, 0xDC, 0xB0, 0xCC, 0x92, 0x95, 0x33, 0x1F, 0x72, 0x09, 0x59, 0x1C, 0x5B, 0x17, 0x4F, 0x9B,
-    0xC6, 0x49, 0x6F, 0xD9, 0xCE, 0x4B, 0x86, 0xAB, 0x2A, 0xAD, 0x1E, 0x98, 0x77, 0x96, 0x3B, 0x44,
-    0xDA, 0x55, 0xBB, 0x68, 0xAA, 0x2D, 0x81, 0x02, 0x45, 0xFC, 0x02, 0x65, 0xBE, 0x42, 0xC0, 0x87,
-    0x69, 0x57, 0x76, 0x96, 0xB4, 0xD3, 0x95, 0x6F, 0xD0, 0x31, 0x20, 0x1D, 0x94, 0xCE, 0x97, 0xC0,
-    0x77, 0x94, 0xB4, 0x0B, 0x6A, 0xBD, 0x4C, 0x65, 0xD3, 0x66, 0xCB, 0xD3, 0x34, 0x11, 0x54, 0xB3,
-    0xD5, 0xF2, 0xC9, 0x6A, 0x2E, 0x44, 0x2D, 0x33, 0x73, 0x0E, 0x48, 0x11, 0x8C, 0xBA, 0x66, 0x3D,
-    0x72, 0x09, 0x0C, 0xD2, 0x82, 0x3B, 0x24, 0x0F, 0xB9, 0x9C, 0x94, 0x2E, 0x6A, 0xA5, 0xB5, 0xA6,
-    0x95, 0x17, 0x95, 0xCE, 0xAE, 0x73, 0x9C, 0xE4, 0x5D, 0x16, 0x5F, 0xC9, 0x6D, 0xC5, 0x4E, 0x5D,
-    0xCF, 0xB0, 0xA5, 0xEC, 0xA4, 0x88, 0xDD, 0xD4, 0x6D, 0xDB, 0x22, 0x56, 0x9F, 0x16, 0x3D, 0x60,
-    0x36, 0x6C, 0x85, 0xFB, 0x05, 0xD5, 0xA0, 0xAF, 0xD5, 0x20, 0x2B, 0x9A, 0x60, 0x34, 0x34, 0x0A,
-    0x6B, 0x98, 0x96, 0xB5, 0x0C, 0x51, 0x00, 0x11, 0x8E, 0x10, 0x56, 0x52, 0xB3, 0xF3, 0xAB, 0x70,
-    0x02, 0x18, 0xD0, 0x41, 0x26, 0x8C, 0xAC, 0x25, 0xB6, 0x31, 0x2F, 0x7D, 0x49, 0x35, 0x38, 0x0D,
-    0xE5, 0x58, 0x7F, 0x3A, 0xE6, 0x49, 0xB2, 0xF2, 0x7A, 0xB5, 0x4D, 0xD0, 0xE9, 0x0E, 0xD6, 0x37,
-    0xB6, 0x3D, 0x62, 0xC9, 0x50, 0x34, 0x91, 0x61, 0xCB, 0x5A, 0x9B, 0x0F, 0x70, 0x7D, 0xF6, 0x96,
-    0xEA, 0x97, 0x5D, 0xD7, 0xEC, 0x9B, 0xFD, 0x5D, 0x77, 0xC5, 0xF3, 0x7A, 0xD0, 0x3C, 0x6F, 0x8B,
-    0xD0, 0xC7, 0x39, 0x34, 0x97, 0x9E, 0x7B, 0xE5, 0x1F, 0x68, 0x61, 0xA6, 0x92, 0x78, 0xC3, 0x22,
-    0xBB, 0x70, 0xAF, 0xCF, 0x9C, 0x91, 0xD5, 0x5F, 0xE6, 0x0E, 0x4C, 0xE4, 0x09, 0x9B, 0xFB, 0x10,
-    0x8E, 0x52, 0x29, 0xF3, 0x7D, 0xB3, 0xDE, 0x8C, 0xC8, 0x34, 0x47, 0x1C, 0xBB, 0x98, 0x25, 0x3F,
-    0x1E, 0x64, 0x6E, 0xCA, 0x49, 0xA7, 0xA4, 0xD7, 0xA9, 0x1B, 0xBA, 0x6A, 0xF9, 0x93, 0x5B, 0xAA,
-    0xAE, 0x3D, 0xE3, 0x4F, 0xB4, 0xF7, 0x48, 0x51, 0x35, 0xA1, 0xEE, 0xEA, 0x39, 0x9D, 0x34, 0x64,
-    0xD4, 0xF0, 0x61, 0x55, 0xE5, 0xD1, 0x7C, 0x04, 0xC0, 0x32, 0x20, 0x0A, 0xC2, 0x90, 0x26, 0xC7,
-    0xD4, 0xA1, 0xE1, 0x46, 0x25, 0x98, 0x9F, 0x47, 0xB1, 0xF6, 0xE6, 0xEB, 0x6D, 0x9A, 0x98, 0x63,
-    0xA6, 0x0C, 0x07, 0x7F, 0x64, 0x89, 0xB1, 0x32, 0xAB, 0xF1, 0x87, 0x2D, 0x35, 0xFE, 0x95, 0x2D,
-    0x60, 0xB8, 0x3D, 0x7C, 0x17, 0x26, 0x5D, 0x8F, 0x16, 0x90, 0x12, 0xBE, 0xC5, 0x5A, 0x99, 0xB5,
-    0xCF, 0xBC, 0x2B, 0xDC, 0x1E, 0xBE, 0xB4, 0xB3, 0xDF, 0x05, 0x8C, 0xB3, 0xF3, 0x22, 0x87, 0x0B,
-    0x68, 0x7E, 0x28, 0x68, 0x37, 0x97, 0x5C, 0xDB, 0x64, 0xE7, 0x69, 0x8E, 0xD7, 0xE4, 0xAE, 0xE4,
-    0xA0, 0x53, 0x6F, 0x86, 0x9A, 0xED, 0xE1, 0x7B, 0xFF, 0xB4, 0x6E, 0xF3, 0xDE, 0xE0, 0xA2, 0x1F,
-    0xEB, 0x7B, 0x8F, 0x41, 0xEF, 0x68, 0x52, 0xFF, 0xD5, 0xB6, 0x32, 0xDF, 0x33, 0xCA, 0x71, 0x45,
-    0x84, 0x5B, 0xC0, 0x07, 0x0E, 0x5C, 0x99, 0xD4, 0xE3, 0xFD, 0x18, 0xA1, 0x45, 0x08, 0x99, 0x34,
-    0x62, 0xFC, 0x1B, 0x65, 0x00, 0x3E, 0x60, 0x31, 0x1C, 0x6F, 0xC9, 0x84, 0xD1, 0x8F, 0x8B, 0x06,
-    0xED, 0x89, 0xA3, 0x4E, 0xF1, 0x8A, 0x81, 0x88, 0x83, 0xAF, 0xF6, 0xF2, 0x08, 0xD8, 0x5D, 0x37,
-    0x72, 0x11, 0x78, 0xF7, 0xB8, 0x41, 0x65, 0x17, 0x0E, 0xB6, 0x34, 0x4A, 0xAD, 0xD7, 0xEE, 0xD1,
-    0x1E, 0xBD, 0x71, 0x86, 0xB0, 0xF5, 0xF1, 0x17, 0x36, 0x5E, 0x13, 0xD7, 0x6E, 0xCA, 0xF0, 0x9B,
-    0xB5, 0x61, 0xB9, 0xDD, 0x50, 0x2D, 0xE0, 0x18, 0xCE, 0x35, 0x61, 0x1A, 0x99, 0x51, 0x1F, 0xBA,
-    0xCA, 0xAF, 0x27, 0x89, 0x36, 0xC3, 0x49, 0xAE, 0x43, 0x46, 0xB9, 0x10, 0x3C, 0x54, 0x8C, 0x69,
-    0x0F, 0x4E, 0x97, 0x71, 0xEF, 0xE9, 0xC1, 0xC9, 0x37, 0x99, 0xF2, 0x0D, 0xC1, 0x37, 0x6C, 0xE3,
-    0x3A, 0x6C, 0x92, 0x32, 0xA9, 0xB2, 0xBF, 0x99, 0x94, 0xD0, 0x65, 0xDE, 0xF9, 0x1F, 0x7C, 0x77,
-    0xCB, 0x17, 0xC4, 0x63, 0xFE, 0xF9, 0x78, 0xB4, 0xAB, 0x09, 0x8D, 0x90, 0x91, 0x90, 0x93, 0x90,
-    0x95, 0x90, 0x97, 0x90, 0x99, 0x90, 0x9B, 0x45, 0x4A, 0xF2, 0xB3, 0x4D, 0x35, 0x39, 0x2A, 0x4B,
-    0x21, 0x4F, 0x21, 0x53, 0xCB, 0x75, 0xCE, 0xD6, 0x3E, 0x53, 0xAB, 0xB4, 0xB4, 0x67, 0x61, 0x3F,
-    0x2D, 0xEB, 0xBF, 0x1D, 0xBD, 0x70, 0x02, 0x85, 0x4B, 0x81, 0xC4, 0x55, 0x78, 0xAD, 0x2C, 0xBB,
-    0x73, 0xDF, 0xFF, 0x16, 0xC6, 0x5F, 0xB0, 0xF9, 0xB4, 0xD1, 0x05, 0xBB, 0xCB, 0x93, 0x19, 0x39,
-    0xF0, 0x27, 0x49, 0x46, 0x66, 0x21, 0x38, 0x2E, 0xBE, 0xF0, 0x5C, 0xDB, 0x3E, 0xF3, 0x7D, 0x87,
-    0xE9, 0x2B, 0x0F, 0xB8, 0x2B, 0xB9, 0x01, 0xC7, 0xCD, 0xB9, 0x82, 0xCF, 0xE7, 0xF4, 0xAB, 0x34,
-    0x3E, 0x0D, 0x99, 0xD3, 0xEC, 0x2B, 0x5F, 0x77, 0x1C, 0x08, 0x54, 0x54, 0xAE, 0x69, 0x82, 0x1B,
-    0x6D, 0x9C, 0xAE, 0x59, 0x50, 0xDB, 0xBB, 0x9E, 0x86, 0x26, 0x77, 0x18, 0x63, 0x4C, 0x2C, 0x8C,
-    0xB3, 0x51, 0xD7, 0x48, 0x75, 0xCC, 0x60, 0xD6, 0xDD, 0x77, 0x2B, 0xA1, 0xA9, 0xD9, 0x53, 0xEF,
-    0x9B, 0x58, 0x0D, 0x46, 0x83, 0xCD, 0x66, 0x26, 0xFB, 0x3A, 0xF2, 0xD8, 0x05, 0xAE, 0xFD, 0x12,
-    0x7D, 0xCA, 0x05, 0xE3, 0xB3, 0x98, 0xE7, 0x5C, 0xE2, 0x17, 0x2B, 0xF9, 0x11, 0x7B, 0x64, 0xCC,
-    0xC9, 0x83, 0x77, 0x91, 0x3C, 0xCD, 0xE0, 0x0D, 0xC1, 0xC8, 0xB8, 0x8F, 0xC1, 0x3F, 0x81, 0xFC,
-    0xB0, 0xF5, 0x58, 0xA0, 0x48, 0x37, 0xB9, 0x37, 0xA0, 0xCA, 0xEF, 0x8B, 0x3C, 0xE8, 0xB2, 0x32,
-    0x6A, 0x30, 0x33, 0x65, 0x64, 0x58, 0xC1, 0xB7, 0x93, 0xCE, 0xFA, 0x2B, 0x71, 0xF5, 0xC0, 0xCB,
-    0x7E, 0x27, 0x09, 0x9F, 0xD5, 0xFA, 0xC3, 0x5D, 0xDE, 0x79, 0xDA, 0xA4, 0xBE, 0x81, 0x1D, 0x82,
-    0x01, 0x24, 0xDC, 0x8A, 0x38, 0x71, 0x03, 0xC5, 0x12, 0x2E, 0x00, 0x6B, 0x5D, 0x90, 0xB0, 0x2E,
-    0x60, 0x83, 0xB0, 0x8F, 0xD8, 0xD0, 0x70, 0x31, 0x83, 0xEE, 0xBC, 0xCF, 0xC6, 0x23, 0xD3, 0x26,
-    0xB3, 0xA6, 0x26, 0xCD, 0xCD, 0xF1, 0x38, 0x2A, 0x0E, 0xB8, 0x63, 0xD0, 0x07, 0x9D, 0x37, 0x84,
-    0xF8, 0x2F, 0x41, 0x11, 0x67, 0xF5, 0xF2, 0x26, 0x7A, 0xF9, 0xD0, 0x2B, 0xE8, 0x09, 0x48, 0x45,
-    0x19, 0x4F, 0xF4, 0xC2, 0xAC, 0xCC, 0xF4, 0xD2, 0x78, 0xD4, 0xFA, 0xC3, 0xEF, 0xA6, 0xFD, 0x42,
-    0xB2, 0x65, 0x3D, 0x81, 0x6C, 0xC8, 0x47, 0xC8, 0x48, 0xC8, 0x49, 0xC8, 0x4A, 0xC8, 0x4B, 0xC8,
-    0x4C, 0xC8, 0x4D, 0xC8, 0x4E, 0xC8, 0x4F, 0xC8, 0x90, 0xE8, 0x46, 0xA4, 0xC3, 0x84, 0x91, 0xA7,
-    0x8D, 0x47, 0xE5, 0x3A, 0x19, 0x98, 0x8A, 0x99, 0x2F, 0x5E, 0xEF, 0xFA, 0x56, 0xF4, 0xFA, 0x7F,
-    0xF2, 0xE0, 0x76, 0xE8, 0xB5, 0x79, 0x5D, 0xED, 0x34, 0x97, 0x4D, 0x2F, 0xCA, 0x66, 0x43, 0x7E,
-    0x53, 0xBD, 0xF6, 0x4E, 0x9E, 0xF0, 0x73, 0x0B, 0xE6, 0xB9, 0x75, 0xFE, 0xFA, 0xC7, 0xFA, 0xFC,
-    0x31, 0xD2, 0xEC, 0xDA, 0xD2, 0xF6, 0xA9, 0xD3, 0xB7, 0x02, 0x4A, 0x71, 0x8A, 0x17, 0x71, 0x98,
-    0xCF, 0x0E, 0x8A, 0xE7, 0x10, 0xA8, 0xA3, 0xCB, 0xBC, 0x85, 0x90, 0x09, 0xBB, 0x10, 0x09, 0xAE,
-    0x5D, 0xE6, 0x8B, 0x0A, 0x97, 0x4C, 0x1E, 0x7F, 0x54, 0x23, 0x2D, 0xDD, 0xBA, 0xC6, 0xE7, 0x2E,
-    0x30, 0x47, 0x3C, 0xD0, 0x73, 0x3B, 0xC6, 0x23, 0x5F, 0x6F, 0x0A, 0xB8, 0xC0, 0xA6, 0x4F, 0x5E,
-    0x97, 0x77, 0xCF, 0xD4, 0xD7, 0xA7, 0x9A, 0xFA, 0x6C, 0x41, 0xDD, 0x49, 0x97, 0x71, 0xF5, 0x49,
-    0xF6, 0x0C, 0x25, 0x0F, 0xAC, 0xCB, 0x81, 0x1C, 0xF1, 0xCD, 0x64, 0x08, 0x6B, 0x22, 0x04, 0x0C,
-    0xDB, 0x5C, 0xC4, 0x49, 0xCF, 0x38, 0xE9, 0xEE, 0x89, 0x93, 0x80, 0x8D, 0x6F, 0xC8, 0x60, 0x89,
-    0x49, 0x7E, 0x83, 0x18, 0xFB, 0xF4, 0xB5, 0x7E, 0x5F, 0x62, 0x8E, 0x9A, 0x86, 0x6B, 0x83, 0xB9,
-    0x4C, 0x70, 0x64, 0x75, 0xFA, 0x16, 0x92, 0xD7, 0x4F, 0x5F, 0xA7, 0xD2, 0xD7, 0xC3, 0xEE, 0xDB,
-    0x5E, 0xBE, 0xBB, 0xD3, 0x69, 0xDB, 0xA0, 0x7D, 0x41, 0xCB, 0x45, 0x80, 0xFC, 0x30, 0xD5, 0xDD,
-    0xB5, 0xBD, 0xFA, 0xEA, 0xB3, 0xE2, 0x84, 0xC6, 0xCE, 0x52, 0xA8, 0x9B, 0xE1, 0x67, 0x7E, 0x70,
-    0x53, 0xB9, 0xB5, 0x6D, 0x7C, 0xB5, 0x33, 0xD1, 0x06, 0x48, 0x6C, 0x40, 0xD9, 0x07, 0xEC, 0xA7,
-    0xEE, 0x79, 0x36, 0xF3, 0xC0, 0xCB, 0xB4, 0x7F, 0xC2, 0xAA, 0x87, 0x2F, 0xF7, 0x64, 0xB6, 0x3F,
-    0x2B, 0x99, 0x19, 0x58, 0x74, 0x98, 0x34, 0xD4, 0x1A, 0x25, 0xD4, 0x2E, 0x6D, 0x51, 0x93, 0xF7,
-    0x92, 0xAE, 0x03, 0x5C, 0xD2, 0xB6, 0x41, 0xD7, 0xD2, 0xDF, 0x23, 0x1A, 0x85, 0x9F, 0xD1, 0xA5,
-    0x43, 0xED, 0xC0, 0x02, 0xFB, 0x8C, 0x5C, 0xBB, 0x07, 0xED, 0x6D, 0xF5, 0x4D, 0x8D, 0xC9, 0x4C,
-    0xCB, 0x30, 0x93, 0xA9, 0xD0, 0x06, 0xBD, 0x98, 0x3D, 0x70, 0x05, 0xD7, 0x6E, 0xFA, 0xA8, 0x52,
-    0xFB, 0xBD, 0xE8, 0x9E, 0xB5, 0xFA, 0x37, 0xA0, 0x4F, 0xF6, 0x3A, 0xEE, 0xCA, 0xFE, 0x5C, 0x54,
-    0x52, 0x5C, 0xC0, 0x29, 0x53, 0xB1, 0xB7, 0xCA, 0xA3, 0xC6, 0x61, 0x1D, 0x47, 0xFF, 0xB7, 0xCD,
-    0x9C, 0xA7, 0x8F, 0xF1, 0x26, 0x05, 0xA3, 0x49, 0x61, 0xCE, 0x11, 0xE6, 0xC4, 0xFF, 0x40, 0x1A,
-    0xBE, 0x4B, 0xC3, 0x37, 0x03, 0x9B, 0x95, 0x49, 0xB7, 0xA3, 0xCB, 0x1A, 0xDA, 0x18, 0xD9, 0x27,
-    0x01, 0x7C, 0xE5, 0xCA, 0xBE, 0xFF, 0xB4, 0x09, 0x2C, 0x44, 0xE1, 0x62, 0x4A, 0x37, 0x2F, 0xC5,
-    0xEF, 0x2C, 0x4B, 0xFE, 0x17, 0xCD, 0x5B, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0x76, 0x89,
-    0x19, 0x23, 0x23, 0xB0, 0x58, 0x8E, 0x23, 0x2A, 0x26, 0x9A, 0x34, 0xA1, 0x22, 0xA2, 0xD5, 0x4C,
-    0x96, 0x04, 0x62, 0x4D, 0xE2, 0xCC, 0xA4, 0xD0, 0x16, 0xDC, 0x49, 0xE1, 0x82, 0x6D, 0x9C, 0xCC,
-    0x44, 0x4D, 0x0A, 0x8F, 0xBD, 0x12, 0x90, 0x71, 0xA1, 0xC2, 0x85, 0xD9, 0xC4, 0x6D, 0x54, 0xB0,
-    0xA0, 0xD6, 0x33, 0x61, 0x0A, 0x15, 0x2C, 0x28, 0x01, 0x8A, 0x32, 0x51, 0xE1, 0xC2, 0x4F, 0xF4,
-    0xC8, 0x2E, 0x03, 0x25, 0x54, 0x92, 0x89, 0x32, 0x63, 0x24, 0x03, 0x47, 0x4F, 0x24, 0x1E, 0x6E,
-    0xCE, 0xF7, 0x1D, 0xFC, 0x2D, 0xB9, 0x22, 0xD7, 0xE2, 0x2E, 0xF7, 0x2D, 0x77, 0xEF, 0x7B, 0x7C,
-    0x0F, 0xB8, 0xF7, 0x9C, 0xEF, 0x9E, 0x7B, 0xFE, 0x61, 0x8C, 0xB1, 0x36, 0x37, 0x18, 0x53, 0x19,
-    0x77, 0x77, 0xCD, 0xF8, 0x13, 0xD6, 0x18, 0x13, 0x8E, 0x59, 0x83, 0xD1, 0x62, 0x74, 0x3F, 0x5B,
-    0xCA, 0xE8, 0xFD, 0x14, 0x63, 0xF0, 0x66, 0x2B, 0x63, 0xE4, 0x63, 0xBC, 0xCC, 0x71, 0xCF, 0x5B,
-    0xC9, 0xD8, 0x60, 0x74, 0x2B, 0xAF, 0x93, 0x0B, 0xEF, 0xFF, 0x44, 0xC6, 0xD0, 0x5A, 0x2B, 0x17,
-    0x1A, 0x57, 0xC6, 0x2B, 0xC6, 0x91, 0xF1, 0x8E, 0x8C, 0xA9, 0x91, 0x09, 0x6D, 0xEA, 0x35, 0xF2,
-    0xBE, 0x8C, 0x3B, 0xF3, 0xA2, 0xBD, 0x97, 0xD9, 0x34, 0xB1, 0x4B, 0xB9, 0x5E, 0xBE, 0x89, 0xAC,
-    0xAC, 0xBD, 0xB9, 0xBB, 0xD3, 0xD3, 0x73, 0xA6, 0xFB, 0xE3, 0xD4, 0x64, 0x42, 0xA7, 0x63, 0x65,
-    0x1A, 0xAF, 0x95, 0x21, 0x6C, 0x64, 0x89, 0xA8, 0x96, 0xD5, 0x92, 0x85, 0xD7, 0x9A, 0xAC, 0x14,
-    0x1A, 0x8A, 0x32, 0x90, 0x21, 0x0F, 0x97, 0xC6, 0xE6, 0x51, 0x23, 0x83, 0x70, 0x50, 0xE4, 0xB7,
-    0x6A, 0x93, 0xDD, 0xFD, 0x59, 0x23, 0x93, 0xBF, 0x6A, 0xCB, 0x70, 0xE5, 0x0B, 0x4D, 0xA9, 0xE1,
-    0xCC, 0x67, 0x0D, 0x18, 0xAF, 0xBD, 0x52, 0xC6, 0x77, 0xAF, 0x01, 0x8A, 0xC4, 0xE2, 0xF3, 0x08,
-    0x0C, 0x1A, 0x27, 0x5D, 0x0F, 0x40, 0x36, 0xE4, 0x9F, 0x09, 0xCD, 0x9E, 0x0C, 0xBF, 0x90, 0x6B,
-    0x7C, 0x5B, 0xC9, 0x7C, 0xDC, 0xB2, 0x2D, 0x73, 0xB2, 0xF8, 0x9C, 0x26, 0xD7, 0xF2, 0x73, 0x1B,
-    0x83, 0xBF, 0xE0, 0x8E, 0x60, 0x73, 0x4C, 0xCC, 0x1D, 0x89, 0x4B, 0x7E, 0xC2, 0x9D, 0xF2, 0x57,
-    0x27, 0xC0, 0x3C, 0x97, 0x8C, 0x31, 0xFD, 0xEB, 0x18, 0xC0, 0x8E, 0xE9, 0x88, 0x01, 0xC8, 0x8A,
-    0x08, 0x84, 0xE1, 0x69, 0xF1, 0xF8, 0x71, 0xD0, 0x4C, 0x64, 0xBD, 0xC1, 0x2F, 0x77, 0x26, 0xC9,
-    0x89, 0x75, 0xBB, 0x6E, 0x09, 0x34, 0x61, 0x03, 0x72, 0x93, 0x12, 0xD0, 0xD8, 0xD4, 0x6D, 0x71,
-    0xBB, 0x5B, 0x19, 0xA2, 0x66, 0x42, 0x8E, 0x3A, 0x79, 0x3C, 0xC3, 0xBD, 0x1F, 0xAB, 0x47, 0x46,
-    0x7E, 0x1E, 0x0B, 0x70, 0xBC, 0xD7, 0x4F, 0x4D, 0x60, 0xAF, 0xBF, 0x26, 0x52, 0x6B, 0xED, 0x6A,
-    0x58, 0x76, 0x94, 0x10, 0x10, 0x0B, 0xE0, 0x8D, 0x4F, 0x0E, 0xC0, 0xDF, 0x15, 0x3D, 0x00, 0x83,
-    0x00, 0x41, 0x9E, 0x32, 0x39, 0x74, 0xCE, 0x2A, 0x6C, 0x8C, 0xDF, 0xF8, 0x8D, 0x6C, 0xBE, 0x57,
-    0x9B, 0xB8, 0x72, 0x53, 0xA1, 0x18, 0xBC, 0x63, 0x28, 0x30, 0xA8, 0xCE, 0xC0, 0x50, 0xE4, 0xFC,
-    0x02, 0x97, 0xD4, 0x61, 0x2A, 0x5B, 0xD2, 0x61, 0x19, 0xB0, 0xB0, 0x39, 0xAD, 0xEB, 0xE0, 0x52,
-    0xDF, 0xCA, 0x9D, 0xD1, 0x07, 0x35, 0x00, 0x6A, 0x80, 0xCF, 0xD9, 0x19, 0x3C, 0x44, 0x87, 0xE0,
-    0x10, 0x1B, 0x40, 0x43, 0x64, 0x08, 0x0C, 0x71, 0x21, 0x2C, 0x44, 0x25, 0x99, 0x86, 0xEA, 0xE0,
-    0x50, 0x0F, 0x70, 0x10, 0x0D, 0x82, 0xA1, 0x58, 0x28, 0x14, 0x44, 0xE2, 0x9C, 0x70, 0x69, 0x17,
-    0xB2, 0x60, 0x6D, 0x82, 0x7F, 0x6D, 0x44, 0x9E, 0xEE, 0xC8, 0xE7, 0x5B, 0x23, 0x02, 0x02, 0x00,
-    0xF8, 0x07, 0xFB, 0xE0, 0x1E, 0xCC, 0x83, 0x77, 0xB0, 0x0E, 0xCE, 0xC1, 0x08, 0xFE, 0xC0, 0x36,
-    0xB8, 0x06, 0xD3, 0xE0, 0x99, 0x2C, 0x2B, 0xC7, 0xE7, 0x78, 0x48, 0xD2, 0x9E, 0x6B, 0xBE, 0x33,
-    0xDF, 0x31, 0xF3, 0x9F, 0x67, 0xCC, 0x70, 0xBF, 0x4B, 0xB6, 0x27, 0xFF, 0xF7, 0x26, 0x42, 0x8E,
-    0x85, 0xE1, 0x0D, 0xBC, 0x44, 0xE9, 0xBB, 0x72, 0x08, 0x7E, 0x2E, 0x9F, 0x79, 0x02, 0x6E, 0xAF,
-    0x9B, 0x76, 0x4F, 0x85, 0x61, 0xEC, 0x66, 0x2C, 0x9A, 0x25, 0xFC, 0xB0, 0xA6, 0xCC, 0x79, 0x10,
-    0xFA, 0xAB, 0xC7, 0xC8, 0xF0, 0x26, 0x5F, 0xC2, 0x14, 0xE7, 0xDC, 0xBF, 0x4B, 0x3D, 0xC8, 0xC5,
-    0x75, 0xBF, 0x27, 0xAE, 0xA1, 0x90, 0xAE, 0x73, 0x84, 0x06, 0xEC, 0x5C, 0xA1, 0x45, 0xB8, 0xCF,
-    0x78, 0xDA, 0x85, 0x4D, 0x51, 0x45, 0x62, 0x64, 0x42, 0xFD, 0x6D, 0xC0, 0x50, 0xC4, 0x51, 0xBE,
-    0x92, 0x51, 0x38, 0x95, 0xCF, 0x85, 0x69, 0xB9, 0x26, 0x59, 0xE0, 0x43, 0x21, 0x10, 0xEA, 0xAA,
-    0x34, 0xD9, 0x02, 0x7B, 0x89, 0xDF, 0x1C, 0x07, 0xDA, 0xA6, 0xC1, 0x0A, 0x27, 0x5B, 0xB4, 0x73,
-    0x6C, 0x61, 0xCD, 0x0B, 0x6B, 0xEF, 0xCD, 0xA4, 0xCD, 0xB3, 0x35, 0x54, 0x94, 0x53, 0x54, 0x54,
-    0x2F, 0xC9, 0x5D, 0xD5, 0xE5, 0x1F, 0x50, 0xA9, 0x66, 0xFF, 0x48, 0x7D, 0xCA, 0x53, 0x7C, 0x66,
-    0x45, 0x06, 0x32, 0xAB, 0xC2, 0xAB, 0xCA, 0xA2, 0xE5, 0x0B, 0x95, 0x29, 0x36, 0x87, 0x8A, 0x9D,
-    0x0A, 0xD5, 0xA8, 0x4A, 0x35, 0xAA, 0x54, 0x8D, 0xAA, 0x55, 0xA3, 0x8A, 0xD5, 0xA8, 0x6A, 0x35,
-    0xAA, 0x5C, 0x8D, 0xAA, 0x57, 0x58, 0xD6, 0x57, 0x21, 0x84, 0xAA, 0x62, 0x47, 0x0B, 0xF3, 0x95,
-    0x50, 0xF2, 0xAC, 0xAD, 0xFA, 0xF1, 0x38, 0x50, 0xF2, 0xE0, 0x6B, 0x08, 0x42, 0x64, 0x4E, 0xB6,
-    0xB0, 0xF8, 0x18, 0x2E, 0xD1, 0x6A, 0xD4, 0x74, 0xA9, 0x79, 0xA1, 0x93, 0x41, 0xEE, 0x11, 0x12,
-    0x45, 0xA0, 0x82, 0xE5, 0x68, 0x5C, 0x2A, 0xC1, 0x22, 0xF9, 0x0A, 0x96, 0x35, 0xC4, 0x92, 0xEA,
-    0xE4, 0xCC, 0xBC, 0x1C, 0xE0, 0x40, 0x19, 0xC5, 0x28, 0x6B, 0x24, 0xB4, 0x6F, 0x11, 0x36, 0xC2,
-    0x5C, 0x30, 0x40, 0xE3, 0x79, 0x63, 0x08, 0x34, 0xD0, 0x98, 0xAC, 0x05, 0xF7, 0x2C, 0xD1, 0x51,
-    0x6D, 0x83, 0x6E, 0x2F, 0x0D, 0x12, 0x55, 0x36, 0xA0, 0xD8, 0x21, 0x3F, 0x35, 0x18, 0x72, 0x6A,
-    0xA0, 0xE1, 0x57, 0x44, 0x63, 0x01, 0xCE, 0xB8, 0x35, 0x22, 0xE4, 0x20, 0x6C, 0x20, 0x08, 0xE7,
-    0x25, 0x19, 0xCE, 0x4B, 0x28, 0xE7, 0x25, 0x6C, 0xE2, 0x2A, 0xAC, 0x93, 0x32, 0x59, 0x64, 0xFF,
-    0x6C, 0xD3, 0x42, 0x2E, 0xB7, 0x1F, 0x3F, 0x59, 0x41, 0x40, 0xD3, 0xBF, 0x64, 0xC8, 0xEF, 0x9F,
-    0x55, 0xE4, 0x1D, 0x14, 0xF9, 0xF6, 0x21, 0x43, 0x79, 0xBA, 0xBC, 0x83, 0xCC, 0x0B, 0xE6, 0xBB,
-    0x26, 0xFC, 0xB1, 0x48, 0x9D, 0x7C, 0xEC, 0x61, 0xC2, 0xB3, 0xE6, 0xF8, 0x70, 0x50, 0x75, 0xCC,
-    0xF3, 0xA4, 0x4A, 0xA9, 0xF7, 0x1D, 0xCC, 0xCD, 0x35, 0x41, 0x80, 0x04, 0x5A, 0xD5, 0xDE, 0x24,
-    0xF3, 0xE6, 0x41, 0x53, 0xF1, 0xB4, 0x08, 0x9C, 0x32, 0x77, 0xE6, 0x5D, 0x62, 0xCE, 0x29, 0x42,
-    0x75, 0x20, 0x75, 0xE4, 0x74, 0x21, 0x77, 0xC4, 0xED, 0x8E, 0x81, 0x57, 0x4C, 0x08, 0xDF, 0xAA,
-    0xED, 0xFF, 0x56, 0xBD, 0xD7, 0x1C, 0x57, 0xBD, 0x79, 0x82, 0x6B, 0x49, 0xB3, 0xF7, 0x21, 0xCE,
-    0x44, 0x40, 0xEA, 0x54, 0x22, 0x9C, 0xAB, 0x6B, 0x73, 0x1A, 0x36, 0x69, 0xD4, 0x61, 0xD3, 0x3D,
-    0xFA, 0x4B, 0xE9, 0x68, 0xDA, 0x8E, 0xE7, 0x34, 0xD0, 0x4F, 0x32, 0x3D, 0xEF, 0xA0, 0x31, 0xFC,
-    0x79, 0x4D, 0xA7, 0x74, 0x49, 0x94, 0x46, 0xBF, 0xD4, 0xBC, 0x80, 0x7B, 0x1C, 0xC6, 0x0E, 0xE1,
-    0x12, 0xF6, 0x21, 0x51, 0xD5, 0x9E, 0x9B, 0x8C, 0xAA, 0xFD, 0x75, 0x86, 0x00, 0x8F, 0x73, 0x9F,
-    0xE5, 0xE6, 0x32, 0xA9, 0x9C, 0x42, 0x74, 0xB2, 0x9A, 0x0A, 0x19, 0x6B, 0x7C, 0x1B, 0xF3, 0x77,
-    0xB4, 0xB5, 0x62, 0x22, 0x32, 0xB0, 0xFA, 0x19, 0xA8, 0x8A, 0xA9, 0xFF, 0x7B, 0xD7, 0x50, 0xF7,
-    0x45, 0x57, 0x88, 0x79, 0x6A, 0xDF, 0x43, 0x24, 0xE2, 0xD6, 0x41, 0x89, 0x28, 0xB1, 0x8F, 0x13,
-    0x33, 0x7C, 0xFB, 0x29, 0x4F, 0x8F, 0xFD, 0x3B, 0xC4, 0x4E, 0xD9, 0x1F, 0x21, 0x28, 0x48, 0x04,
-    0x84, 0x24, 0xA7, 0x93, 0x91, 0x66, 0x00, 0x24, 0x2D, 0xE0, 0x6A, 0xA7, 0x98, 0x27, 0xF9, 0x25,
-    0x05, 0x81, 0x0E, 0x44, 0x44, 0x7C, 0xEF, 0x70, 0x3D, 0xAE, 0xED, 0xD0, 0x34, 0x8A, 0x25, 0xA2,
-    0x81, 0x85, 0x81, 0x0C, 0xBE, 0xB8, 0x65, 0x31, 0x19, 0x8E, 0x69, 0x61, 0xFA, 0x71, 0x85, 0xC9,
-    0xE0, 0xD6, 0xC7, 0xD8, 0x40, 0xD9, 0x9E, 0x2F, 0x8C, 0xEA, 0xDD, 0x0D, 0x4C, 0x6D, 0xB6, 0x21,
-    0x63, 0x1F, 0x37, 0xD4, 0xB8, 0xF5, 0xE4, 0xA7, 0x6C, 0x99, 0xB5, 0x42, 0x78, 0xE7, 0x48, 0x81,
-    0xF8, 0x7A, 0x21, 0x3C, 0xC8, 0x70, 0x3A, 0xA2, 0xEA, 0xF0, 0xFD, 0x43, 0xFE, 0xFE, 0x9A, 0x20,
-    0xAC, 0x96, 0x56, 0x43, 0xCD, 0x80, 0x9F, 0xD3, 0x71, 0x33, 0xEE, 0x5B, 0x73, 0x4A, 0xD7, 0x0C,
-    0xE1, 0xF5, 0x41, 0x8F, 0xC6, 0x83, 0x53, 0xFB, 0x73, 0x13, 0x62, 0xE6, 0x97, 0xA8, 0x66, 0xBB,
-    0x64, 0x46, 0x6B, 0xE3, 0xB4, 0xD3, 0x6D, 0xCE, 0xCE, 0x5A, 0x22, 0xDC, 0x9B, 0x1C, 0xC5, 0xCE,
-    0x24, 0xEA, 0x92, 0xAC, 0x98, 0xFB, 0xF0, 0xA8, 0xDE, 0x26, 0xFD, 0xA6, 0x66, 0x69, 0x89, 0xDC,
-    0xCC, 0x6B, 0xB6, 0x89, 0xE5, 0x45, 0x0C, 0x13, 0x0C, 0x97, 0xC0, 0x0F, 0x5F, 0x46, 0x64, 0x0B,
-    0x1B, 0x21, 0x62, 0x05, 0x29, 0x13, 0x44, 0x03, 0xA6, 0x3C, 0x68, 0xA6, 0xE0, 0xB6, 0x37, 0x5C,
-    0x1C, 0x9B, 0x29, 0x06, 0x0A, 0xBA, 0x48, 0x10, 0xC7, 0x0E, 0xC9, 0x76, 0xC2, 0x56, 0x65, 0xDC,
-    0x58, 0x3A, 0xEF, 0x25, 0x2D, 0x43, 0x1F, 0x8F, 0x31, 0x72, 0x4D, 0xF1, 0x4E, 0x36, 0x1B, 0x27,
-    0x2C, 0xB6, 0xF7, 0x5E, 0x14, 0xEF, 0x5D, 0x0C, 0x4D, 0xC6, 0x34, 0x11, 0x59, 0x20, 0x03, 0x24,
-    0x7F, 0x95, 0x80, 0xF4, 0x30, 0x9F, 0x08, 0x67, 0xC2, 0xCC, 0xA1, 0x95, 0xC9, 0x16, 0x87, 0x64,
-    0x32, 0xBE, 0xB9, 0x92, 0x6F, 0x63, 0x89, 0x49, 0xED, 0xF7, 0x10, 0x2E, 0x2C, 0x6C, 0xE9, 0xD9,
-    0xDC, 0xE6, 0xC2, 0x9A, 0xCD, 0x7D, 0x04, 0xAB, 0x41, 0xEB, 0x58, 0xCA, 0x9E, 0x30, 0x21, 0x3E,
-    0x82, 0x04, 0x8E, 0xBD, 0xFF, 0x1F, 0xF7, 0x41, 0x40, 0x77, 0x56, 0xA2, 0x22, 0xA1, 0xA7, 0xD4,
-    0x55, 0x36, 0x1E, 0x0F, 0x54, 0x40, 0xA0, 0x64, 0xFF, 0x01, 0x83, 0x73, 0x6D, 0xB5, 0x7B, 0x6D,
-    0xB5, 0xF3, 0x2C, 0x80, 0x7A, 0x14, 0x8A, 0xCD, 0xE2, 0xE3, 0x14, 0x89, 0xB9, 0xC5, 0x18, 0xEA,
-    0xEC, 0xC8, 0xB7, 0x01, 0x2C, 0x75, 0x62, 0x53, 0xAF, 0xFB, 0x35, 0x50, 0x28, 0x07, 0x28, 0xBA,
-    0x11, 0x8A, 0xF6, 0x37, 0x81, 0x82, 0xAA, 0xDD, 0x5F, 0x86, 0x88, 0x77, 0xFE, 0x5E, 0x4C, 0x7C,
-    0x21, 0x5B, 0xF5, 0x5D, 0xF5, 0x5A, 0xD2, 0x49, 0xAC, 0x30, 0x34, 0xBD, 0x53, 0xCC, 0x38, 0x93,
-    0xAA, 0x8A, 0x3A, 0x8A, 0x7E, 0x0E, 0x6F, 0x98, 0x92, 0x04, 0xF1, 0x94, 0x1F, 0x78, 0x68, 0x4B,
-    0xCB, 0x59, 0xDC, 0xA6, 0x8E, 0x6C, 0x8C, 0x58, 0xAF, 0x60, 0x5A, 0x2A, 0xC5, 0xBC, 0x81, 0xB0,
-    0x7C, 0xCB, 0x5C, 0x2A, 0x56, 0xE6, 0xE5, 0x60, 0x39, 0x52, 0xF1, 0xB5, 0x7D, 0x40, 0x91, 0x13,
-    0x39, 0x64, 0x27, 0x1D, 0xAB, 0xB7, 0x33, 0x83, 0xB9, 0x52, 0x7A, 0x40, 0x0E, 0x6E, 0x01, 0x45,
-    0x20, 0x28, 0x5C, 0xEE, 0xF0, 0x5C, 0x8E, 0xD1, 0x82, 0x86, 0x50, 0xCD, 0x18, 0x42, 0x81, 0x31,
-    0xF0, 0xF5, 0xF0, 0x24, 0xC3, 0x04, 0x60, 0x08, 0xAC, 0xC4, 0xBA, 0xCB, 0x64, 0x66, 0xCC, 0x45,
-    0x0C, 0xF9, 0x08, 0xF5, 0xC7, 0x63, 0xDD, 0x4A, 0x79, 0xAD, 0x13, 0x5B, 0x9D, 0xDB, 0x05, 0xD5,
-    0x17, 0xDF, 0x86, 0xCC, 0x8B, 0x30, 0xF9, 0x3C, 0x74, 0x32, 0xB3, 0x06, 0xCA, 0x91, 0xAA, 0xB6,
-    0x8A, 0x92, 0x23, 0x52, 0xF3, 0x89, 0x44, 0xA0, 0x79, 0xB8, 0x22, 0xAB, 0x70, 0x0C, 0xE0, 0x16,
-    0x84, 0xE2, 0x14, 0x40, 0x1C, 0x68, 0xBA, 0xB6, 0xCC, 0x49, 0x91, 0x2B, 0x81, 0xD5, 0x05, 0xF3,
-    0x8E, 0x84, 0x55, 0xA1, 0x5D, 0x00, 0x26, 0x7A, 0x76, 0x5F, 0x85, 0xEE, 0x13, 0xA0, 0x0D, 0x09,
-    0x66, 0xE4, 0x7A, 0x45, 0x59, 0x98, 0x38, 0xD7, 0x0C, 0x6E, 0xA8, 0xE7, 0x94, 0xDA, 0x5C, 0xA6,
-    0xC8, 0x2A, 0x1C, 0x94, 0xF3, 0xBD, 0xA0, 0x8A, 0x8C, 0x88, 0x88, 0x38, 0xC8, 0x34, 0x43, 0x3E,
-    0x90, 0x6D, 0xEE, 0x40, 0x8C, 0xF2, 0x10, 0x8C, 0x79, 0x8A, 0xE5, 0x8E, 0x48, 0x85, 0x70, 0xEB,
-    0x36, 0x98, 0x5B, 0x14, 0x12, 0x7E, 0xC5, 0x6D, 0xE6, 0x35, 0x8F, 0x26, 0xE5, 0x66, 0x0E, 0xC3,
-    0x09, 0x70, 0xF9, 0x15, 0xC1, 0xC6, 0xAD, 0x42, 0x49, 0x01, 0xF1, 0xEE, 0xE8, 0x32, 0x08, 0x3D,
-    0x20, 0x45, 0xE6, 0x08, 0x95, 0xAA, 0x50, 0x8F, 0x02, 0x4F, 0x02, 0xE7, 0x03, 0x79, 0x3D, 0x75,
-    0x20, 0xAE, 0x7F, 0x49, 0x88, 0x21, 0xD1, 0xD4, 0x54, 0x5B, 0xA1, 0x04, 0x5B, 0x85, 0x00, 0x67,
-    0x87, 0xA0, 0x32, 0x29, 0xAE, 0xA7, 0xCE, 0x53, 0xFA, 0x81, 0x82, 0xD0, 0x41, 0x7D, 0x30, 0x38,
-    0x2F, 0xBD, 0xDF, 0xD2, 0xC7, 0x3D, 0xBD, 0xA5, 0xEF, 0x23, 0x9C, 0x9F, 0xA8, 0xFD, 0x2A, 0xFA,
-    0xD4, 0xB7, 0xD8, 0x5C, 0xD1, 0x58, 0x4B, 0x91, 0xF0, 0x50, 0xD4, 0x56, 0x2A, 0xA4, 0x7E, 0xC7,
-    0xB8, 0xD7, 0x27, 0xB0, 0x2F, 0xBE, 0xED, 0xEC, 0xBF, 0x95, 0x74, 0x9E, 0xAD, 0x91, 0x98, 0x44,
-    0x32, 0x52, 0x87, 0x45, 0x80, 0x92, 0x81, 0x5C, 0x5E, 0x94, 0x21, 0x72, 0x39, 0xC2, 0x99, 0x4D,
-    0x65, 0x21, 0x2B, 0x68, 0xC9, 0xB6, 0x27, 0x95, 0x50, 0x28, 0x5A, 0x4E, 0xC2, 0xB2, 0x4F, 0x5E,
-    0x91, 0x1B, 0xED, 0x9B, 0x02, 0xC5, 0x0A, 0x64, 0xA5, 0xC1, 0xA8, 0xAA, 0x58, 0x3A, 0x61, 0xCC,
-    0x07, 0xD2, 0xCE, 0x83, 0xBB, 0x58, 0x95, 0x30, 0x72, 0xD0, 0xDC, 0x2B, 0x26, 0x0E, 0xC3, 0xBB,
-    0xD0, 0xF3, 0xB0, 0xE8, 0x5B, 0xA3, 0x23, 0xF1, 0x90, 0x3A, 0xF4, 0xBF, 0x54, 0x1D, 0xD6, 0x07,
-    0x73, 0xA6, 0x8F, 0x53, 0x87, 0x8E, 0xE6, 0xF5, 0x86, 0x1C, 0xC4, 0xC3, 0x7A, 0x76, 0x39, 0x90,
-    0x8C, 0xFB, 0xBF, 0x8F, 0x2B, 0x32, 0x4D, 0x90, 0x6D, 0xEE, 0x68, 0xD2, 0x55, 0xE6, 0x93, 0x0B,
-    0xDD, 0x25, 0x32, 0xBD, 0x8B, 0x78, 0xC8, 0x83, 0xD2, 0x83, 0xDC, 0xBF, 0x3E, 0x24, 0x41, 0x27,
-    0xF3, 0xAA, 0x14, 0xE4, 0x73, 0x5D, 0x7C, 0xD8, 0xE2, 0xDE, 0x11, 0x58, 0x5B, 0xF4, 0xBC, 0xBC,
-    0x88, 0x5B, 0x93, 0xA6, 0x07, 0x28, 0x63, 0x78, 0xDC, 0x64, 0x1A, 0x1F, 0x47, 0x15, 0x61, 0x8A,
-    0xA9, 0xDF, 0xE9, 0x1E, 0x05, 0xAD, 0x5B, 0x73, 0x46, 0x3A, 0x31, 0x61, 0xC3, 0x72, 0x47, 0x54,
-    0x6B, 0x0C, 0xF7, 0x39, 0x05, 0x2A, 0xB1, 0x76, 0xFE, 0xF2, 0x89, 0x26, 0x40, 0x4B, 0xAB, 0xE0,
-    0x15, 0x0B, 0xC2, 0x97, 0xD5, 0x9A, 0xD0, 0x64, 0x5E, 0x33, 0x8D, 0x5B, 0xB2, 0x10, 0x32, 0xE7,
-    0x7C, 0xCF, 0x67, 0x26, 0xB1, 0x71, 0x34, 0xB0, 0x3E, 0xF0, 0xA3, 0x82, 0xA8, 0x0E, 0xA0, 0x71,
-    0x55, 0x46, 0x3D, 0xBD, 0xCC, 0x99, 0xAE, 0x7A, 0xA2, 0x67, 0xB2, 0x7F, 0xC3, 0xB1, 0x62, 0x4D,
-    0x65, 0x49, 0xD1, 0x36, 0x9D, 0x03, 0x4F, 0x42, 0x14, 0x96, 0xB7, 0x12, 0x46, 0xFD, 0x16, 0x5B,
-    0xD1, 0x69, 0x65, 0x0D, 0x79, 0x55, 0xB9, 0x25, 0xAC, 0xE5, 0xE6, 0xA8, 0x16, 0x41, 0x88, 0xEB,
-    0x04, 0x87, 0x2F, 0xA2, 0x34, 0xDB, 0x14, 0xE6, 0x78, 0x56, 0xCD, 0x84, 0x77, 0xA8, 0xAE, 0x28,
-    0x33, 0x11, 0x4C, 0xCE, 0xD1, 0x0C, 0x9E, 0xDF, 0x77, 0xF7, 0x6F, 0xC4, 0x58, 0x12, 0x26, 0x5F,
-    0x56, 0x7B, 0xFA, 0x25, 0x55, 0xDC, 0x65, 0x3D, 0x17, 0xA0, 0x07, 0xCC, 0x03, 0x1E, 0xA8, 0x5D,
-    0x1E, 0x59, 0xDA, 0x9B, 0x27, 0x48, 0xFB, 0x16, 0xA4, 0x7D, 0x1B, 0x6B, 0xDD, 0x86, 0xC0, 0x01,
-    0x35, 0xAF, 0x86, 0x27, 0x55, 0x23, 0xAD, 0x51, 0xF5, 0xD5, 0x9F, 0x9C, 0x84, 0xF8, 0x8D, 0xD6,
-    0x14, 0x37, 0x94, 0x86, 0x48, 0x3E, 0xF6, 0x69, 0xF8, 0xD3, 0x23, 0x19, 0xFE, 0xE8, 0x21, 0x15,
-    0x3C, 0xAF, 0x21, 0x14, 0x1F, 0x81, 0x1D, 0x3D, 0xEE, 0xF4, 0x40, 0x9F, 0x1D, 0x83, 0x07, 0x43,
-    0x95, 0xA0, 0x1A, 0x02, 0x95, 0x68, 0x16, 0xA6, 0x38, 0xB0, 0x30, 0x0D, 0x16, 0x53, 0x03, 0xA0,
-    0xDA, 0x5F, 0xB5, 0xB2, 0x1C, 0x58, 0x38, 0x92, 0xE9, 0xDC, 0xB6, 0x79, 0x83, 0xD5, 0x08, 0x56,
-    0x67, 0x7D, 0x5B, 0xBB, 0x72, 0x01, 0x67, 0x92, 0x9D, 0x0C, 0x17, 0xD8, 0xCA, 0x2B, 0x3A, 0x35,
-    0x3C, 0x5E, 0x1E, 0xC9, 0x82, 0x7C, 0xC2, 0x50, 0xAC, 0x9C, 0x9A, 0x45, 0x84, 0x72, 0x50, 0xDA,
-    0x87, 0x64, 0xAC, 0x1E, 0xAD, 0x71, 0x1E, 0xCC, 0x58, 0x6D, 0x19, 0x65, 0x5A, 0xB9, 0x26, 0xDB,
-    0xA4, 0xAD, 0xA6, 0x8F, 0x5C, 0x9B, 0x89, 0xF3, 0xC8, 0xFE, 0x60, 0xE9, 0xDB, 0x6F, 0x49, 0xB4,
-    0xF7, 0xAA, 0x88, 0x5E, 0x28, 0x57, 0xFD, 0xF6, 0xB3, 0xDE, 0xC3, 0x1D, 0xE1, 0x8A, 0xBE, 0xB0,
-    0xF8, 0xCA, 0x89, 0x1A, 0x15, 0xE7, 0xC6, 0x6F, 0xBC, 0x87, 0x47, 0x13, 0xC6, 0x4D, 0x59, 0x55,
-    0x8C, 0x54, 0x53, 0x2C, 0x22, 0x39, 0x82, 0x71, 0x7D, 0xF1, 0x78, 0x18, 0xF9, 0x1D, 0x19, 0x7E,
-    0x8D, 0x40, 0x04, 0x5A, 0x29, 0x5E, 0xF5, 0x9B, 0xE3, 0x80, 0x32, 0xE4, 0xC5, 0xCD, 0x73, 0x47,
-    0x67, 0xE4, 0xCB, 0x25, 0xED, 0x9F, 0x60, 0x4C, 0x2C, 0x6A, 0x25, 0xBE, 0xD8, 0x54, 0x6B, 0xFE,
-    0xE0, 0xB1, 0x92, 0x66, 0xCE, 0xF5, 0xCE, 0xF4, 0x42, 0x13, 0x2E, 0x2A, 0xE1, 0x6A, 0x4C, 0x83,
-    0xC5, 0x2C, 0xF4, 0xEE, 0xF5, 0xC9, 0x8A, 0x15, 0x9D, 0xCC, 0xD2, 0x28, 0xC1, 0xE7, 0xBC, 0xAC,
-    0xF5, 0xE7, 0x6D, 0x7D, 0xD9, 0x93, 0xBB, 0xC4, 0xAD, 0x13, 0x61, 0x0A, 0xAF, 0xD5, 0x28, 0x46,
-    0x87, 0xB2, 0x7D, 0x35, 0x7B, 0x18, 0x20, 0xAF, 0x97, 0xBC, 0xCE, 0x15, 0xEA, 0x2F, 0x3B, 0xD6,
-    0x95, 0xB9, 0x85, 0xC1, 0x1F, 0xF0, 0x25, 0xFB, 0x40, 0xF8, 0xDE, 0x33, 0xC9, 0x7F, 0x94, 0x70,
-    0x1B, 0xE3, 0x07, 0xA2, 0x3B, 0xE0, 0xEA, 0xA7, 0x50, 0x9E, 0x81, 0xA5, 0x0E, 0x85, 0xD3, 0xE2,
-    0xD6, 0xEA, 0x7B, 0xDD, 0xA7, 0x09, 0x28, 0x6C, 0x9F, 0x09, 0xE8, 0x0B, 0xE1, 0xA0, 0x9B, 0x30,
-    0xF3, 0x68, 0xCF, 0x73, 0x07, 0x17, 0x6F, 0x4A, 0x70, 0x9E, 0xAC, 0x12, 0x2B, 0x3B, 0xF2, 0x40,
-    0x06, 0xFB, 0x37, 0x36, 0xF5, 0xAD, 0xDC, 0x11, 0xAC, 0xA6, 0x80, 0x6B, 0x8A, 0xB5, 0x0E, 0xB8,
-    0x2A, 0x09, 0x5C, 0x15, 0x11, 0x85, 0xF6, 0x6C, 0x51, 0x06, 0xB6, 0x46, 0x0C, 0x9B, 0x6B, 0x6D,
-    0x7F, 0x2D, 0xA1, 0x38, 0xF0, 0x93, 0xA8, 0x55, 0x7A, 0x4F, 0xFF, 0xA7, 0x7B, 0xEA, 0xA8, 0xB9,
-    0xD4, 0xE8, 0xFD, 0x64, 0x80, 0x31, 0x63, 0xC3, 0x46, 0x32, 0xB6, 0x79, 0x34, 0x53, 0x3D, 0xAA,
-    0x4F, 0x1D, 0xB8, 0xB5, 0xA6, 0x79, 0xDA, 0x4C, 0xDD, 0xCA, 0x3E, 0x49, 0x52, 0x4F, 0x6E, 0xDC,
-    0xFA, 0x8A, 0x9C, 0x83, 0x33, 0xE1, 0x97, 0x31, 0x92, 0x21, 0x2D, 0x64, 0x8F, 0x7E, 0xCC, 0x62,
-    0x4C, 0x5B, 0x9E, 0x10, 0xB2, 0x6E, 0x75, 0x88, 0xAB, 0xEE, 0xE9, 0x8B, 0xE9, 0x5F, 0x9A, 0xFD,
-    0x1B, 0xE2, 0xAF, 0xB9, 0x95, 0x6D, 0x6C, 0x2B, 0x71, 0x57, 0xF4, 0xF9, 0xAF, 0x5A, 0xF3, 0xB2,
-    0x28, 0x1C, 0xEA, 0xA2, 0xA8, 0xE5, 0xBD, 0x71, 0xC3, 0x97, 0xA4, 0xE6, 0x14, 0x49, 0x45, 0x0D,
-    0x0B, 0x75, 0x47, 0xE5, 0x13, 0x6A, 0x79, 0x99, 0x4E, 0x22, 0x3D, 0x73, 0xBE, 0xD0, 0x97, 0x12,
-    0x4A, 0x19, 0xFE, 0xC4, 0x28, 0xFE, 0x4B, 0xDC, 0xA2, 0x8E, 0x18, 0x63, 0x9A, 0xB5, 0x3C, 0x0C,
-    0x77, 0xE6, 0xD0, 0x38, 0x7A, 0x00, 0x3C, 0x95, 0xB0, 0x90, 0xBA, 0xED, 0x39, 0x75, 0xDC, 0x08,
-    0xC0, 0x23, 0x5B, 0xF6, 0xFE, 0x51, 0xB7, 0x6C, 0x39, 0x6E, 0x59, 0x23, 0xF8, 0x21, 0xA0, 0xC9,
-    0x0F, 0x4D, 0xA1, 0xE4, 0xBD, 0x9A, 0xFA, 0xCB, 0x76, 0x8C, 0xA3, 0x62, 0x8A, 0x4E, 0x42, 0x95,
-    0xAE, 0x69, 0x87, 0xA1, 0xAF, 0x03, 0x4E, 0x9D, 0xB5, 0xCB, 0xA1, 0x43, 0x20, 0x61, 0x2C, 0x87,
-    0x72, 0x7B, 0xC9, 0xC0, 0x8D, 0x1D, 0x02, 0x10, 0x12, 0xA8, 0x6E, 0x98, 0xFB, 0x6C, 0x81, 0x35,
-    0x8B, 0x32, 0x19, 0x47, 0xE4, 0x65, 0xB1, 0x77, 0x09, 0x5A, 0x44, 0x40, 0x0C, 0x82, 0xAA, 0xA1,
-    0xFA, 0x1F, 0x32, 0x17, 0x16, 0xF3, 0xBF, 0x05, 0xB2, 0x5A, 0x9F, 0x69, 0x63, 0xD3, 0x62, 0x3C,
-    0xA8, 0x48, 0xB5, 0x44, 0xF3, 0x8A, 0x75, 0xC7, 0x0E, 0x0F, 0xB7, 0x0B, 0xDA, 0x60, 0xE9, 0xAD,
-    0x42, 0x79, 0x87, 0x60, 0x2D, 0x59, 0xB8, 0x36, 0x13, 0x9A, 0x0A, 0xF9, 0x43, 0x4A, 0xCF, 0xE6,
-    0x41, 0x5B, 0xE4, 0x62, 0x3A, 0xC5, 0x6C, 0x26, 0x8B, 0xAC, 0x44, 0x6D, 0xCA, 0x83, 0x49, 0xDC,
-    0x9A, 0x2A, 0xD6, 0x97, 0xCC, 0x3B, 0x90, 0xC6, 0x1F, 0xD7, 0x63, 0xC5, 0x5A, 0x6B, 0x74, 0xB3,
-    0xD2, 0xD4, 0x3A, 0x20, 0x30, 0x66, 0x73, 0x7E, 0xA1, 0xD9, 0x1C, 0x77, 0x96, 0xCD, 0x39, 0x16,
-    0x34, 0xCC, 0xB9, 0x4D, 0x6C, 0x79, 0x07, 0x65, 0xE9, 0x2D, 0x33, 0x9A, 0x5C, 0xF6, 0xEB, 0xBC,
-    0x02, 0x79, 0xD8, 0x70, 0xD6, 0x4A, 0x1E, 0x94, 0x58, 0xD0, 0xEA, 0x2E, 0x51, 0x32, 0x45, 0xD3,
-    0x4B, 0xF4, 0xCD, 0x6A, 0x4E, 0x27, 0x40, 0x61, 0xA3, 0x1B, 0x60, 0x41, 0x2B, 0xC7, 0xCA, 0x00,
-    0x98, 0x21, 0xA8, 0x47, 0x93, 0x08, 0xA8, 0x05, 0x38, 0x7D, 0xFA, 0x37, 0xD7, 0xCE, 0x0E, 0x9C,
-    0x1B, 0x38, 0x31, 0x82, 0x90, 0x36, 0xBA, 0x11, 0xA3, 0x79, 0x7D, 0x40, 0x0B, 0xB0, 0x28, 0xA0,
-    0x6A, 0x6E, 0x37, 0x07, 0x0E, 0x16, 0x99, 0xA5, 0xA4, 0x94, 0xD7, 0x30, 0x65, 0x44, 0x25, 0xDB,
-    0xE5, 0x31, 0x1D, 0xF3, 0xB5, 0x3E, 0x21, 0xC3, 0xE4, 0x75, 0xD0, 0xF7, 0x40, 0xF1, 0x98, 0x83,
-    0x57, 0x4C, 0x23, 0x88, 0x44, 0xFD, 0xEB, 0x70, 0x58, 0x87, 0xC8, 0x60, 0xE8, 0x8A, 0xE2, 0xD1,
-    0x45, 0x82, 0x05, 0x0E, 0x59, 0xCC, 0xDE, 0x97, 0xDB, 0x40, 0x49, 0xEE, 0x6A, 0x30, 0xB9, 0xCD,
-    0xBD, 0x9A, 0x15, 0x0D, 0x26, 0x92, 0x49, 0x5E, 0x35, 0xB5, 0x5D, 0x08, 0x18, 0x2F, 0x7C, 0x01,
-    0x38, 0xFE, 0xC7, 0xDA, 0xD4, 0xED, 0xC4, 0xE9, 0x42, 0x5B, 0x8F, 0x27, 0xBB, 0x20, 0x2A, 0x56,
-    0x44, 0x29, 0x29, 0x63, 0xC0, 0x52, 0xE4, 0x00, 0xC6, 0x51, 0x68, 0xAE, 0x21, 0x2D, 0xE2, 0x21,
-    0x67, 0x2C, 0x73, 0x77, 0x57, 0xE1, 0x98, 0xB3, 0x9E, 0x54, 0x30, 0x77, 0x04, 0x90, 0x3A, 0xF3,
-    0x5B, 0x80, 0xC9, 0xE6, 0x7B, 0x00, 0x8A, 0xD9, 0x2C, 0x7B, 0x2F, 0xC4, 0x36, 0x6D, 0x0D, 0xC7,
-    0xC7, 0xD9, 0x1D, 0x9A, 0x37, 0xC7, 0x26, 0xD3, 0x7C, 0x2C, 0x9B, 0x1C, 0x6C, 0x0A, 0xD1, 0xF6,
-    0x20, 0xA4, 0x9F, 0x3A, 0xE8, 0x6C, 0xEC, 0x48, 0x49, 0xCE, 0x4A, 0x80, 0x26, 0x23, 0x7A, 0x6E,
-    0x64, 0x6C, 0x90, 0xC8, 0x8C, 0x6A, 0x6A, 0x59, 0x5A, 0x8D, 0xE4, 0x3E, 0x96, 0xD4, 0xE8, 0x3E,
-    0xF9, 0x88, 0xFD, 0x8D, 0x25, 0xAB, 0xD2, 0xA5, 0x26, 0xCB, 0xB2, 0xC5, 0xD0, 0xA9, 0x24, 0xB6,
-    0x83, 0x41, 0x85, 0x84, 0xAE, 0xB1, 0xFD, 0xCF, 0x00, 0x45, 0xEC, 0xD6, 0x81, 0x2A, 0x44, 0xF2,
-    0x03, 0xC8, 0xA3, 0x22, 0xB3, 0x52, 0xBD, 0xDC, 0x0B, 0xD2, 0xC5, 0x9B, 0x41, 0x93, 0xB4, 0x99,
-    0x18, 0xAB, 0x07, 0xAD, 0xDF, 0xBD, 0xDF, 0x8A, 0x1F, 0xDB, 0x88, 0xAD, 0x49, 0xC3, 0x3E, 0x57,
-    0x37, 0xE4, 0xE9, 0x46, 0x9F, 0x7C, 0x71, 0xB0, 0xC9, 0xEC, 0xB4, 0x39, 0x9B, 0xFF, 0x14, 0x93,
-    0x05, 0x72, 0xE8, 0x04, 0x79, 0x8B, 0xD1, 0xFF, 0x72, 0xF7, 0xF3, 0x22, 0xF5, 0xEC, 0x87, 0x42,
-    0x47, 0xF6, 0x33, 0x94, 0x1C, 0xFE, 0x3B, 0x92, 0x01, 0xCD, 0x9E, 0x45, 0xB5, 0xF1, 0x70, 0x7A,
-    0xE9, 0x08, 0xC9, 0x9D, 0x59, 0x47, 0xF5, 0x18, 0x9D, 0xB2, 0xDA, 0x74, 0x79, 0xA6, 0x5B, 0x35,
-    0x13, 0x76, 0x85, 0xD6, 0x30, 0xFA, 0x61, 0xC5, 0x2E, 0x89, 0xFC, 0x4B, 0xBA, 0x24, 0x4E, 0x11,
-    0xC4, 0x1D, 0xF9, 0xB7, 0x14, 0x99, 0xB8, 0x22, 0x90, 0xC4, 0x56, 0x6B, 0x50, 0x9B, 0x3B, 0xC7,
-    0x23, 0x1E, 0xFD, 0x4C, 0x3C, 0xDE, 0x84, 0xB6, 0x1D, 0x82, 0x9D, 0x31, 0xD4, 0x71, 0x51, 0xC3,
-    0x8B, 0x1F, 0x20, 0x07, 0x95, 0xCA, 0xBD, 0xA2, 0xC2, 0x16, 0x8E, 0x58, 0xFD, 0x52, 0x94, 0xD9,
-    0xF3, 0xBA, 0x15, 0x8E, 0x6E, 0xCF, 0x92, 0x95, 0xC1, 0xB4, 0x6F, 0x93, 0xF4, 0xF5, 0xFF, 0xDC,
-    0x91, 0x95, 0x39, 0x43, 0x0D, 0x2B, 0x67, 0x5F, 0x26, 0x91, 0xBB, 0x8B, 0xD2, 0xA5, 0xCF, 0xB0,
-    0x34, 0x51, 0x77, 0x0B, 0x3A, 0x18, 0x9B, 0xB9, 0x99, 0x8E, 0x21, 0x0C, 0xB7, 0x54, 0x53, 0x9B,
-    0xF9, 0x70, 0x5C, 0xC7, 0xD3, 0xFA, 0x02, 0x54, 0xAB, 0x15, 0xA7, 0xC1, 0x5B, 0xCA, 0x25, 0x41,
-    0xED, 0xCB, 0xD0, 0x88, 0x2C, 0x51, 0x3D, 0xF8, 0xDA, 0x19, 0xCA, 0xD6, 0x41, 0x3B, 0xF6, 0xBD,
-    0x08, 0xBF, 0x57, 0x60, 0x27, 0x32, 0x38, 0xE3, 0x59, 0x2A, 0x4A, 0x20, 0xF9, 0x77, 0x54, 0xC8,
-    0x66, 0xAA, 0x95, 0x38, 0xB0, 0x0F, 0x20, 0x83, 0x1F, 0xDB, 0xBE, 0x01, 0xBD, 0x1E, 0x01, 0x07,
-    0xE7, 0x74, 0x80, 0xD8, 0xD5, 0x72, 0x3F, 0x5C, 0xC6, 0xE8, 0xC3, 0xCA, 0xBC, 0x2E, 0xCE, 0xE1,
-    0xD0, 0xCE, 0x0C, 0x04, 0x04, 0x00, 0xF0, 0x0F, 0xF6, 0xC1, 0x3D, 0x98, 0xF7, 0xD9, 0x42, 0xD3,
-    0x2A, 0xE7, 0x64, 0xBC, 0x28, 0xC1, 0x36, 0xB8, 0x06, 0xD3, 0xE0, 0x39, 0x98, 0x2C, 0xEE, 0xB3,
-    0x64, 0x29, 0x48, 0x87, 0xA3, 0x88, 0x8C, 0x98, 0x3A, 0xA0, 0x6E, 0xD3, 0xC7, 0x0B, 0x9A, 0xC0,
-    0x7B, 0x5A, 0xA6, 0xB6, 0x87, 0xAA, 0x77, 0xA9, 0xE7, 0x5D, 0xFE, 0xE0, 0x1F, 0x53, 0x1D, 0x30,
-    0xD0, 0xF2, 0xAA, 0x28, 0x97, 0x95, 0x11, 0x03, 0x16, 0xCB, 0x21, 0xC0, 0x1A, 0xC3, 0xAB, 0x67,
-    0xBB, 0xBB, 0x1B, 0x12, 0x1E, 0x45, 0x22, 0xD7, 0xE1, 0x07, 0x4D, 0xCF, 0x61, 0x3A, 0xF6, 0x0F,
-    0x1F, 0xC3, 0xEE, 0x06, 0x30, 0xC0, 0x29, 0x1E, 0x85, 0x10, 0x7F, 0x20, 0xCF, 0x24, 0x3C, 0x8B,
-    0xE0, 0x8E, 0x9B, 0x97, 0x44, 0xE1, 0x5C, 0x60, 0x36, 0xE5, 0x1B, 0x53, 0x4B, 0xC9, 0xE1, 0x0D,
-    0x83, 0x6A, 0x34, 0xFB, 0x46, 0x8E, 0x27, 0x67, 0xD5, 0xCE, 0x90, 0xB7, 0x50, 0x73, 0xDC, 0xDF,
-    0x50, 0x27, 0x85, 0x0A, 0x26, 0xAA, 0xA6, 0x50, 0x83, 0x99, 0x42, 0x5F, 0xFB, 0x32, 0xBB, 0x51,
-    0xBB, 0x22, 0xDC, 0x41, 0x79, 0x4C, 0xD4, 0x9B, 0x63, 0xFF, 0x8B, 0x73, 0x6C, 0xDA, 0xBF, 0x7D,
-    0x6C, 0x71, 0x34, 0x9C, 0x17, 0x47, 0xDB, 0xDF, 0x25, 0xDF, 0x74, 0x49, 0xEF, 0xA1, 0x76, 0x20,
-    0xF7, 0xBD, 0xD7, 0x87, 0xDC, 0x22, 0x10, 0x49, 0xDB, 0x87, 0x1F, 0x1A, 0x6D, 0xF7, 0xC1, 0xB6,
-    0xC6, 0xDA, 0x1A, 0x6A, 0x6B, 0xA4, 0xBD, 0x39, 0xBA, 0x98, 0xA7, 0x8C, 0xDE, 0x98, 0x77, 0x12,
-    0xC5, 0x66, 0x02, 0xB1, 0x2F, 0x3F, 0x92, 0x3B, 0xFE, 0x84, 0xBC, 0xF8, 0xF6, 0xA6, 0x98, 0x92,
-    0xD6, 0x7C, 0x5D, 0x1C, 0x22, 0xBF, 0x3D, 0xA4, 0x6C, 0x37, 0xCF, 0x35, 0x0E, 0x3A, 0xBF, 0xBE,
-    0x4E, 0xE7, 0x95, 0x21, 0xEA, 0xCE, 0xD3, 0x71, 0xE7, 0xB3, 0x81, 0xDA, 0xF9, 0x36, 0xFC, 0xB1,
-    0xA7, 0xE0, 0xEE, 0x08, 0x3B, 0x8E, 0x76, 0x86, 0xC4, 0x36, 0x4F, 0xDE, 0xF1, 0xAD, 0xA9, 0xD6,
-    0x11, 0x55, 0xD4, 0x01, 0x1D, 0x9E, 0xE7, 0xB9, 0x4F, 0xC5, 0xB2, 0xD0, 0x2C, 0xAF, 0x33, 0xF9,
-    0xCD, 0x2B, 0x71, 0x3E, 0x65, 0xEE, 0xC0, 0x56, 0x38, 0x72, 0xAF, 0x73, 0xAD, 0x3D, 0x32, 0x77,
-    0x9B, 0x5B, 0xD7, 0x70, 0xEB, 0x6A, 0xAC, 0xEB, 0xB0, 0x31, 0xDC, 0xA9, 0xB0, 0xAE, 0x50, 0x2C,
-    0x2B, 0x8B, 0x91, 0x11, 0x84, 0xBD, 0x12, 0xCC, 0xF9, 0xF4, 0x97, 0x83, 0x1C, 0x38, 0x8B, 0x9B,
-    0x22, 0x0B, 0x85, 0xC4, 0x3B, 0x22, 0xF2, 0x97, 0x91, 0x5A, 0x80, 0x96, 0x0B, 0xAD, 0xD6, 0x5E,
-    0x14, 0xCF, 0x74, 0x0C, 0xED, 0xDC, 0x4E, 0xA6, 0x09, 0xEC, 0xBF, 0x88, 0x82, 0x42, 0x1B, 0xCD,
-    0x4B, 0x0A, 0x66, 0x6F, 0xE3, 0x2E, 0xEE, 0x9B, 0x8B, 0x79, 0xD2, 0xA1, 0xF9, 0x5D, 0x94, 0x48,
-    0x0E, 0x37, 0x23, 0xC5, 0x60, 0xE6, 0x1D, 0x22, 0x53, 0xFC, 0x2D, 0x54, 0xC6, 0x15, 0xDA, 0xF9,
-    0xAB, 0x18, 0xC3, 0xF7, 0x05, 0xB9, 0xFF, 0xFB, 0x69, 0x7B, 0x36, 0xB1, 0x7F, 0x6A, 0x6B, 0xF4,
-    0xAF, 0xE7, 0x46, 0xEB, 0xE1, 0x45, 0xFF, 0x14, 0x5E, 0x7E, 0xE0, 0x29, 0xBC, 0xB5, 0xC0, 0xC4,
-    0x87, 0x62, 0xE3, 0xE0, 0xEC, 0x5E, 0x3D, 0x51, 0x10, 0xF4, 0x59, 0xBC, 0xDB, 0x48, 0xAE, 0x98,
-    0x37, 0xBE, 0x5D, 0x8E, 0x2D, 0x80, 0x7D, 0x6B, 0x52, 0xBA, 0x56, 0xB0, 0x38, 0x28, 0x1C, 0xF9,
-    0xF9, 0x4B, 0x32, 0x7C, 0x7A, 0x67, 0x08, 0x05, 0xC7, 0x86, 0x97, 0x13, 0x44, 0xC9, 0x61, 0xF9,
-    0x3A, 0x22, 0x26, 0xDB, 0x17, 0x30, 0xBE, 0x1C, 0x4E, 0xEF, 0x63, 0x7E, 0x7E, 0xA6, 0x5A, 0xAF,
-    0x63, 0xF5, 0xFC, 0x60, 0xA3, 0xBD, 0x8F, 0xE4, 0x3B, 0x2F, 0xAF, 0x51, 0x0A, 0xAD, 0x87, 0xC2,
-    0xE7, 0x5F, 0x9D, 0x30, 0x60, 0x57, 0xCF, 0xD1, 0xB9, 0xE1, 0x83, 0x2C, 0x7C, 0x5E, 0x27, 0x61,
-    0x07, 0xDF, 0x9D, 0x10, 0xC4, 0xED, 0x6C, 0xAC, 0x17, 0x54, 0x9B, 0x7F, 0x28, 0x87, 0x2C, 0x79,
-    0x53, 0xA4, 0xE9, 0xBD, 0x70, 0x21, 0x3E, 0x11, 0x7A, 0xD9, 0x16, 0x77, 0x20, 0x6F, 0x27, 0xA9,
-    0x81, 0x4E, 0x99, 0x77, 0xAD, 0xE1, 0xC4, 0x53, 0xDF, 0x64, 0x9F, 0x0D, 0xED, 0x9B, 0x39, 0x96,
-    0xA3, 0xD5, 0x3A, 0x7E, 0xE6, 0x19, 0xEF, 0x6A, 0x10, 0x9A, 0x0E, 0xC5, 0x00, 0x66, 0x22, 0x58,
-    0xF9, 0xEA, 0xD3, 0xD7, 0xBB, 0xA3, 0x27, 0x9A, 0x0E, 0x7E, 0x48, 0x5F, 0xF0, 0x8F, 0xDF, 0xD4,
-    0xF2, 0x93, 0x79, 0xB7, 0xAF, 0x59, 0x30, 0x26, 0x9C, 0x97, 0x37, 0xC4, 0xDA, 0xDD, 0x40, 0xBA,
-    0x37, 0xB3, 0x95, 0xF0, 0x5D, 0x30, 0xF1, 0x23, 0x2E, 0x84, 0xB0, 0xAC, 0x0D, 0x39, 0x61, 0x0E,
-    0xFF, 0x09, 0x0F, 0x36, 0xD1, 0x91, 0x92, 0x83, 0x7D, 0x89, 0xAE, 0x4A, 0xB2, 0x02, 0x58, 0xF2,
-    0x26, 0x5B, 0x21, 0x45, 0x2C, 0x6F, 0x3E, 0xEF, 0x90, 0x93, 0x76, 0xAD, 0xFB, 0xBF, 0x1D, 0xFA,
-    0x09, 0x5C, 0xEB, 0xDD, 0xB5, 0x1E, 0x63, 0xAA, 0xE0, 0x7D, 0xCB, 0x46, 0x74, 0x1B, 0x1A, 0x1B,
-    0xB2, 0xD1, 0xE2, 0x92, 0xB1, 0xD7, 0x78, 0xE8, 0xC4, 0x6B, 0x60, 0x6D, 0xC3, 0xDE, 0x36, 0x96,
-    0x99, 0x66, 0x54, 0x4C, 0xF5, 0x41, 0xDE, 0xCA, 0xB0, 0xB5, 0x01, 0xC1, 0x71, 0x46, 0x85, 0x61,
-    0x73, 0x7D, 0xD0, 0xD3, 0xD8, 0x21, 0x1B, 0x33, 0x78, 0xE1, 0x7D, 0xFA, 0x93, 0x81, 0xF8, 0x5D,
-    0x16, 0xA9, 0x99, 0xB6, 0x9E, 0x1A, 0x56, 0xFE, 0xE2, 0x2D, 0x01, 0x69, 0xAF, 0x40, 0x87, 0x4C,
-    0x87, 0x48, 0xDB, 0x14, 0xCC, 0x7C, 0x25, 0x41, 0x23, 0x81, 0xEF, 0x95, 0xA0, 0x09, 0x8A, 0xF4,
-    0x72, 0xD0, 0x3C, 0x57, 0xA4, 0x7B, 0x41, 0xF3, 0xFB, 0x59, 0xFA, 0x4E, 0xB0, 0x7C, 0x39, 0x4B,
-    0xEB, 0x60, 0xF9, 0x0F, 0xD9, 0x2B, 0x8B, 0x60, 0x59, 0x65, 0xDF, 0xCA, 0x83, 0x07, 0x65, 0xF6,
-    0x23, 0x83, 0xB6, 0x81, 0x3B, 0x48, 0x9B, 0x67, 0xCD, 0xF0, 0x1C, 0xD8, 0x92, 0xC9, 0x97, 0xA1,
-    0xC3, 0x76, 0xC7, 0x0C, 0xDD, 0x28, 0xEA, 0x22, 0xBA, 0xCB, 0x37, 0x28, 0x40, 0x91, 0x99, 0x07,
-    0x84, 0x80, 0x3D, 0x96, 0x08, 0xDE, 0xBE, 0x15, 0xDB, 0x1C, 0xDD, 0x8C, 0xDA, 0x81, 0xC9, 0x4C,
-    0xBC, 0x5F, 0xB2, 0x81, 0x83, 0xD5, 0xD5, 0x4B, 0xE4, 0x7A, 0x8F, 0x71, 0x68, 0x3D, 0x3E, 0x16,
-    0x97, 0xFC, 0x92, 0xFD, 0xE7, 0xBF, 0xA2, 0xA2, 0x5D, 0x4D, 0x4E, 0xD4, 0x97, 0x15, 0xAC, 0x89,
-    0xDE, 0x79, 0x7B, 0x5F, 0xD3, 0x7F, 0x3D, 0xA1, 0xE9, 0x74, 0x15, 0x6D, 0x83, 0xD7, 0x30, 0x12,
-    0xC9, 0xAF, 0x98, 0x79, 0xEB, 0x8C, 0x39, 0x7F, 0x13, 0x82, 0x27, 0x9B, 0x2D, 0x91, 0x8D, 0x0F,
-    0xC1, 0x26, 0x71, 0xF0, 0xBE, 0x28, 0x95, 0xE2, 0x0E, 0xF2, 0x81, 0xC4, 0x90, 0x24, 0x5E, 0x62,
-    0x96, 0x7E, 0x9B, 0x69, 0x81, 0xDB, 0x5C, 0x9E, 0x81, 0xF8, 0xBF, 0xF1, 0xF1, 0x89, 0xCF, 0xF3,
-    0xF1, 0x31, 0x16, 0x6D, 0xEF, 0xE6, 0x93, 0xBE, 0x83, 0x7F, 0x5F, 0x4E, 0x4F, 0x4F, 0xAF, 0xC6,
-    0x27, 0x96, 0x0B, 0x0D, 0xC1, 0x0F, 0xA4, 0x65, 0x5A, 0x1C, 0x46, 0xB7, 0x45, 0x44, 0x28, 0x23,
-    0x66, 0x7E, 0xC7, 0x3F, 0x98, 0x2E, 0x3A, 0x75, 0x6C, 0xFB, 0x27, 0xAF, 0x67, 0xB9, 0xC3, 0xF8,
-    0xD0, 0xDC, 0x61, 0xC8, 0x27, 0x5A, 0x22, 0x8E, 0x71, 0x8E, 0xE3, 0x7E, 0x89, 0x15, 0x99, 0x6D,
-    0x9A, 0xCF, 0xED, 0x41, 0xFC, 0x17, 0x94, 0x6D, 0xEA, 0xA1, 0x6E, 0xB2, 0xA1, 0xE3, 0xD9, 0x18,
-    0xBE, 0x0C, 0xF5, 0xCB, 0x65, 0xFF, 0xE5, 0x36, 0x2D, 0xDA, 0x1E, 0xBF, 0x5C, 0x22, 0xC2, 0xF4,
-    0x9A, 0xBE, 0x21, 0xA1, 0xEF, 0xD9, 0x65, 0x8A, 0x93, 0x8D, 0xD0, 0xB5, 0x1E, 0xA7, 0x76, 0x24,
-    0xCE, 0xDD, 0xDF, 0x7F, 0x5B, 0x1C, 0xF6, 0x55, 0xF0, 0xE9, 0xB5, 0x65, 0x88, 0x87, 0x63, 0x90,
-    0x06, 0x41, 0xAC, 0x8D, 0xD8, 0x0B, 0x78, 0x68, 0x3E, 0x1C, 0x1F, 0x9D, 0x95, 0x53, 0xF0, 0xD7,
-    0xF2, 0x51, 0x93, 0xD4, 0x2E, 0xEA, 0xEA, 0x75, 0x9F, 0xBF, 0xED, 0x1F, 0x3D, 0xC8, 0x47, 0x22,
-    0xCD, 0xE1, 0x8F, 0x1E, 0x9C, 0x32, 0x06, 0x5B, 0x4A, 0xD8, 0xD0, 0xC8, 0x60, 0xFE, 0x7C, 0x8A,
-    0x2D, 0x9F, 0x1A, 0x83, 0xF9, 0x83, 0xB8, 0xC1, 0xE3, 0x1E, 0xC4, 0x3D, 0x5D, 0x0C, 0x36, 0x04,
-    0x84, 0xE8, 0xF0, 0x07, 0x92, 0x8F, 0x41, 0x0E, 0x34, 0x17, 0x9A, 0x69, 0x06, 0xF6, 0xB5, 0x05,
-    0x4A, 0xAD, 0x38, 0xB4, 0x41, 0x0B, 0xBD, 0x71, 0x20, 0xF6, 0xAB, 0x67, 0x07, 0x6C, 0xD6, 0x67,
-    0xA3, 0x1A, 0xFF, 0xC0, 0xF3, 0x61, 0xF9, 0x24, 0x4E, 0x9A, 0x6F, 0x9D, 0x07, 0x9B, 0xDD, 0x74,
-    0xF6, 0xE6, 0x61, 0x66, 0xF0, 0xE8, 0x52, 0xDA, 0xC6, 0x83, 0xC9, 0x5E, 0xEC, 0xA6, 0x55, 0xFF,
-    0x1F, 0xE5, 0x5B, 0xBF, 0x8F, 0xDD, 0xD6, 0x95, 0xBE, 0x24, 0x35, 0x43, 0xC0, 0x2C, 0xA8, 0x62,
-    0x04, 0xC4, 0x36, 0xD6, 0x6C, 0x52, 0x04, 0x76, 0x36, 0xFC, 0x07, 0x34, 0x43, 0xDA, 0x41, 0x92,
-    0x62, 0x8B, 0xA8, 0xD0, 0x6C, 0xB3, 0x45, 0x7A, 0x17, 0xAB, 0xD6, 0xC8, 0x8E, 0x45, 0x26, 0x41,
-    0x90, 0xC2, 0x45, 0x04, 0x2C, 0x82, 0xED, 0x36, 0x2E, 0x52, 0x28, 0x2F, 0x85, 0xB6, 0x70, 0x21,
-    0x60, 0x35, 0x26, 0xBD, 0x02, 0x36, 0x45, 0x8A, 0xD0, 0x02, 0x92, 0x2D, 0x52, 0x98, 0x4E, 0xEC,
-    0xB5, 0xB1, 0x2A, 0x4C, 0x03, 0x4C, 0x42, 0x4B, 0x7C, 0xBC, 0x39, 0xDF, 0x77, 0x2E, 0xDF, 0xE3,
-    0xCC, 0xC6, 0x4A, 0x90, 0x78, 0xEC, 0x11, 0x32, 0xF6, 0x5C, 0x3E, 0xBD, 0xC7, 0xC7, 0x7B, 0xCF,
-    0xB9, 0xE7, 0xD7, 0xF7, 0x9D, 0x3B, 0xC6, 0xC8, 0x8F, 0x97, 0x63, 0x34, 0x51, 0x67, 0x4C, 0x6A,
-    0xCB, 0xB8, 0x33, 0xBE, 0xB5, 0x83, 0xFC, 0x2B, 0xEE, 0x83, 0x29, 0x68, 0x4D, 0x56, 0x1B, 0xFB,
-    0x65, 0xF9, 0x35, 0xC6, 0xBE, 0x65, 0x82, 0xC9, 0x98, 0x6A, 0x30, 0xE1, 0x68, 0x4C, 0x51, 0x9B,
-    0x18, 0x97, 0xC6, 0x24, 0x3D, 0x2F, 0xA9, 0x3C, 0xA0, 0xAA, 0x4D, 0xB6, 0xBD, 0x58, 0xB9, 0xB4,
-    0x72, 0xC9, 0x71, 0xF1, 0xE5, 0x09, 0x72, 0xC1, 0x13, 0xE4, 0x82, 0x27, 0xA4, 0x98, 0xC3, 0xE0,
-    0x37, 0x95, 0xBB, 0xE4, 0x9D, 0xAA, 0x34, 0x72, 0xDB, 0xFD, 0x35, 0x96, 0x93, 0xDA, 0x86, 0xCB,
-    0xBA, 0x62, 0xDC, 0xCF, 0x05, 0x8E, 0xAF, 0x73, 0x94, 0x47, 0xED, 0x4E, 0xB9, 0x8C, 0x85, 0xED,
-    0x0E, 0x8C, 0x3F, 0x45, 0xE3, 0x65, 0x13, 0x0D, 0xC1, 0x24, 0x0F, 0xEC, 0x7C, 0x5B, 0xCA, 0x04,
-    0x9C, 0xAD, 0xC1, 0x58, 0xD4, 0x5C, 0x34, 0x47, 0x5B, 0x86, 0x6B, 0x8C, 0x91, 0xCC, 0x5E, 0x95,
-    0x98, 0xBC, 0xAA, 0xB1, 0xEC, 0xAC, 0x11, 0x69, 0x4C, 0x62, 0xE5, 0x16, 0x13, 0xD8, 0x1E, 0x53,
-    0xEC, 0xCD, 0xF3, 0x9A, 0x1D, 0xBD, 0x24, 0x75, 0x6A, 0xD7, 0xE1, 0x3A, 0x6B, 0x52, 0xD1, 0xCE,
-    0x98, 0xD4, 0xBE, 0x88, 0x75, 0x14, 0xD7, 0x98, 0xE2, 0x28, 0xCE, 0x03, 0xB9, 0xDC, 0x7E, 0x99,
-    0xD2, 0x59, 0x91, 0x4E, 0x66, 0xE9, 0x29, 0x92, 0x27, 0x4F, 0x97, 0xD9, 0x3C, 0x11, 0x30, 0x1E,
-    0x8C, 0xDF, 0x50, 0xDC, 0x40, 0x2E, 0x49, 0x67, 0x82, 0x9A, 0x3A, 0x08, 0xE5, 0x22, 0xDA, 0x8A,
-    0x4A, 0x2A, 0x26, 0xCE, 0xB1, 0x1C, 0x13, 0x1B, 0x5E, 0x12, 0xC3, 0x37, 0xF7, 0xA1, 0x90, 0xDE,
-    0x1B, 0xE4, 0x12, 0x5B, 0x79, 0xBE, 0x6C, 0x9A, 0xB5, 0xF9, 0x62, 0xF3, 0xF0, 0x73, 0x11, 0x83,
-    0x3F, 0x62, 0x0C, 0xC6, 0x67, 0x57, 0xE6, 0xD9, 0x6F, 0x8F, 0xD9, 0x24, 0xE2, 0x8F, 0xB2, 0x9A,
-    0xAA, 0xEC, 0x65, 0x31, 0xF6, 0x6B, 0x0D, 0xC6, 0x49, 0x56, 0xE4, 0xD9, 0x1B, 0xB2, 0x20, 0x2C,
-    0x1E, 0xDB, 0x8C, 0xE5, 0x04, 0x6B, 0xAC, 0x06, 0x9A, 0x49, 0x5B, 0x6C, 0x6C, 0xD6, 0xA6, 0x1C,
-    0xFF, 0x45, 0x66, 0xCD, 0x7E, 0xF7, 0xB3, 0xF1, 0xA2, 0xC9, 0xEC, 0x3F, 0x58, 0xD1, 0xF0, 0x18,
-    0x88, 0x86, 0x4D, 0xAE, 0xF3, 0x19, 0xB7, 0x49, 0x9B, 0x6D, 0xBA, 0x13, 0x74, 0xF3, 0xCB, 0x2C,
-    0xA9, 0xE7, 0x97, 0xA9, 0xDD, 0xDC, 0x1B, 0x8F, 0x9B, 0x97, 0xDE, 0x15, 0xB3, 0xFC, 0x29, 0xAC,
-    0x2C, 0xCA, 0x54, 0x56, 0x16, 0x58, 0x60, 0x30, 0x16, 0x63, 0x30, 0xF9, 0x62, 0x47, 0xA3, 0x49,
-    0x46, 0xA8, 0xB5, 0x68, 0x45, 0xA3, 0x45, 0x07, 0xD5, 0xA6, 0x9D, 0xDF, 0x1A, 0xB1, 0x12, 0x59,
-    0x72, 0x32, 0x04, 0x0D, 0x56, 0x25, 0x2A, 0x96, 0xFF, 0x4D, 0x34, 0x51, 0xCD, 0x98, 0x09, 0x32,
-    0x24, 0xFA, 0xB2, 0xE8, 0xD4, 0xE4, 0xE4, 0x25, 0x6C, 0x4B, 0x54, 0x2E, 0xF7, 0x06, 0x50, 0xA3,
-    0x68, 0x38, 0x91, 0x6F, 0x4E, 0xAA, 0x73, 0xB9, 0x07, 0xDF, 0x82, 0x81, 0x67, 0x9C, 0x8B, 0xF6,
-    0x5C, 0x34, 0x9E, 0x85, 0x38, 0x32, 0xD8, 0x5A, 0xBE, 0x25, 0x5B, 0x69, 0x4B, 0xD1, 0x5F, 0xBC,
-    0xC6, 0x3E, 0xDA, 0x3C, 0x5A, 0x9B, 0x74, 0x30, 0x11, 0xEC, 0xA1, 0xE8, 0x4D, 0xD5, 0x99, 0xA4,
-    0x4C, 0x65, 0xFD, 0xA5, 0x6C, 0x94, 0x6C, 0x95, 0x08, 0xF5, 0x0E, 0xFC, 0xCA, 0xDA, 0xED, 0x6E,
-    0xCD, 0x16, 0xB6, 0xEF, 0xF7, 0x4E, 0xF4, 0xF4, 0xEB, 0x8D, 0x93, 0x3C, 0x96, 0x65, 0xA9, 0xE0,
-    0xF2, 0x5C, 0x95, 0xDB, 0x78, 0x57, 0x8D, 0x8A, 0xAD, 0xEE, 0x0A, 0xA9, 0x77, 0x57, 0xAB, 0x9B,
-    0x2A, 0xB4, 0x98, 0xC5, 0xA0, 0x32, 0xC7, 0x3F, 0x90, 0x25, 0x53, 0xE4, 0xC4, 0x79, 0x65, 0x3C,
-    0x7E, 0xD1, 0x83, 0x53, 0xA8, 0xC0, 0xD3, 0x46, 0xDE, 0x71, 0x23, 0x6E, 0xB7, 0x91, 0xB6, 0xD9,
-    0x08, 0x9B, 0xCF, 0xB2, 0x4E, 0xB2, 0x56, 0x15, 0x75, 0x34, 0x9D, 0x93, 0xB4, 0xF3, 0x5A, 0x15,
-    0xB4, 0x68, 0xC2, 0x86, 0x72, 0x62, 0xB3, 0x6A, 0x8A, 0x09, 0x89, 0xDD, 0xC6, 0xE7, 0xB0, 0x8B,
-    0x40, 0x8C, 0xA6, 0x8F, 0xE4, 0xC1, 0x5E, 0xD5, 0x9A, 0xE3, 0x2C, 0x57, 0x2D, 0x67, 0xF4, 0x72,
-    0x99, 0x35, 0xED, 0xDD, 0x8B, 0x1D, 0x5A, 0x03, 0x62, 0x80, 0xFC, 0xEC, 0xAE, 0x6D, 0xF9, 0xD4,
-    0x6A, 0xF5, 0x2A, 0xF4, 0x91, 0x67, 0x62, 0xF3, 0x9E, 0x95, 0x09, 0x0F, 0x0E, 0x6D, 0x1D, 0x8E,
-    0xF2, 0xE2, 0x48, 0xD6, 0x47, 0xC3, 0xFD, 0x8F, 0x70, 0x92, 0xD5, 0xC0, 0x76, 0x45, 0xB6, 0xAC,
-    0x09, 0x46, 0x6E, 0x6C, 0x51, 0x23, 0xBE, 0x88, 0x20, 0x55, 0x0D, 0xE7, 0x13, 0x59, 0xC4, 0xDB,
-    0x07, 0xA3, 0xCE, 0x0F, 0xDD, 0x0C, 0x26, 0xB7, 0xA5, 0xDC, 0x98, 0x75, 0x41, 0x5D, 0x95, 0xB7,
-    0x3A, 0xB9, 0x31, 0x2C, 0x8B, 0x7B, 0x3F, 0xEF, 0x9F, 0xB7, 0x79, 0x22, 0xF3, 0x7D, 0xDD, 0xDE,
-    0xC5, 0x5E, 0xC5, 0xEB, 0x70, 0x0A, 0xB9, 0x69, 0xF9, 0x6C, 0xE1, 0x85, 0xE8, 0xD9, 0x83, 0x0F,
-    0x16, 0x12, 0x27, 0xE4, 0x45, 0x43, 0x8D, 0x52, 0x99, 0x78, 0x3C, 0x23, 0x1A, 0x26, 0x87, 0x83,
-    0x63, 0x93, 0x68, 0x73, 0xB4, 0x4A, 0xC6, 0x42, 0x7C, 0xCC, 0x17, 0x08, 0x9A, 0x54, 0x37, 0xF7,
-    0xB3, 0xD0, 0x18, 0xC0, 0x35, 0xF3, 0x63, 0x03, 0x1F, 0xCB, 0x10, 0x02, 0xB1, 0x11, 0xF8, 0x98,
-    0x3B, 0x22, 0x1F, 0xEF, 0xC1, 0x69, 0xB1, 0x35, 0x97, 0x03, 0xAB, 0xF7, 0xDD, 0xE6, 0x0A, 0xE4,
-    0xE3, 0x1E, 0x7A, 0x90, 0x8F, 0x83, 0x8E, 0xE1, 0x55, 0x16, 0x4E, 0x7F, 0x96, 0x5D, 0xB1, 0xED,
-    0xC6, 0xED, 0xB8, 0x14, 0x06, 0xB4, 0x7E, 0x76, 0xCE, 0xD9, 0x63, 0xB3, 0xD9, 0x5F, 0xAD, 0x8B,
-    0x2A, 0xF7, 0xDD, 0x97, 0x10, 0x2D, 0x36, 0xE1, 0xD0, 0x7D, 0x96, 0x35, 0xD4, 0x05, 0x2C, 0x13,
-    0xAA, 0x80, 0x2C, 0x5C, 0xC7, 0x53, 0xB9, 0x2A, 0xC2, 0x38, 0x3D, 0xA8, 0xAD, 0x9A, 0x27, 0x56,
-    0x74, 0x4F, 0xB1, 0xEC, 0x92, 0x4A, 0x80, 0x38, 0x5C, 0x81, 0x5C, 0xB1, 0x00, 0xCF, 0xAA, 0x06,
-    0x5C, 0x9A, 0x50, 0x3B, 0x15, 0xF9, 0x21, 0x12, 0xC4, 0x77, 0x1B, 0xBA, 0x87, 0x2B, 0x84, 0xC7,
-    0x33, 0x21, 0x3B, 0x9E, 0x09, 0xD1, 0xE5, 0x99, 0x94, 0x5C, 0xD4, 0x4E, 0xC1, 0xE5, 0x99, 0x94,
-    0x9B, 0xCA, 0x34, 0x4E, 0x97, 0x0B, 0x19, 0x8B, 0xFA, 0x84, 0xA8, 0x9E, 0x73, 0xCC, 0x5B, 0x6E,
-    0xC9, 0x55, 0xE3, 0x22, 0x54, 0x22, 0xD9, 0x62, 0x08, 0xC5, 0xDA, 0x46, 0x98, 0xDC, 0x20, 0xF7,
-    0xF9, 0x37, 0xB8, 0x03, 0x14, 0x36, 0x58, 0x7B, 0xAB, 0x57, 0x43, 0x89, 0x88, 0x50, 0x74, 0xD6,
-    0x46, 0x62, 0x83, 0x2D, 0x0D, 0x51, 0x96, 0x53, 0xD4, 0x49, 0xA7, 0xF9, 0x45, 0x4C, 0x4D, 0x22,
-    0x55, 0x2E, 0x4B, 0xB0, 0x32, 0xBF, 0x3C, 0xA2, 0x40, 0x98, 0x60, 0x4A, 0xAA, 0xDE, 0x14, 0x01,
-    0x0B, 0x0B, 0xBF, 0x1E, 0x60, 0xAA, 0x79, 0x34, 0x38, 0x23, 0x92, 0x54, 0x86, 0xBD, 0x69, 0xDD,
-    0x5A, 0x9F, 0xC2, 0x42, 0x53, 0x7C, 0x58, 0x48, 0xC4, 0xB1, 0x1F, 0xAA, 0x09, 0xCA, 0xAB, 0xB7,
-    0x69, 0x83, 0xF2, 0xE9, 0x3E, 0xF5, 0x1B, 0x42, 0x39, 0xD4, 0x2C, 0x5E, 0x1D, 0x51, 0xB7, 0x91,
-    0xEC, 0xD1, 0x6D, 0xB5, 0xC3, 0x6F, 0x88, 0x2F, 0xAA, 0x21, 0xCA, 0xCD, 0x1D, 0xB5, 0x92, 0x84,
-    0x23, 0x62, 0xAA, 0xCC, 0xF1, 0x25, 0x09, 0x39, 0x2D, 0x4D, 0x70, 0x5F, 0xDC, 0xAD, 0x81, 0x9E,
-    0xE5, 0x59, 0xF6, 0x3B, 0x0D, 0xAD, 0xF1, 0xB2, 0x29, 0xEE, 0xD6, 0xD4, 0xD7, 0x91, 0xC9, 0xDE,
-    0xAB, 0xA9, 0x31, 0x79, 0xEA, 0xC3, 0x92, 0xEA, 0xE8, 0x11, 0xB3, 0x68, 0x91, 0x92, 0xCA, 0xAC,
-    0x6A, 0x47, 0x52, 0x9C, 0xA5, 0x31, 0xF8, 0x28, 0x2A, 0x34, 0xE7, 0x3F, 0x30, 0x66, 0x32, 0x6A,
-    0x95, 0xC6, 0x1C, 0x6F, 0xAD, 0x51, 0x65, 0x56, 0xC3, 0xDC, 0x64, 0x90, 0xB4, 0xDD, 0xE4, 0x86,
-    0x4D, 0x2A, 0x99, 0x6D, 0xD3, 0xFB, 0x60, 0xB6, 0xE8, 0xA5, 0x75, 0xCE, 0xD9, 0x5A, 0xED, 0x13,
-    0x9A, 0xEA, 0x0A, 0xA7, 0xA8, 0xB6, 0x98, 0xF5, 0x04, 0x13, 0xA5, 0x9A, 0xCC, 0xAC, 0x25, 0xE3,
-    0x94, 0xF4, 0xC4, 0x2A, 0x57, 0x1D, 0x25, 0x30, 0x53, 0xA8, 0x88, 0x76, 0x0A, 0x0D, 0x41, 0x5E,
-    0x2A, 0x08, 0xE2, 0x52, 0x3F, 0xFE, 0xE4, 0xD4, 0x13, 0x4C, 0x4E, 0x3B, 0x30, 0x56, 0x2A, 0x07,
-    0xA2, 0x52, 0x37, 0x90, 0x94, 0xAA, 0x81, 0xA0, 0xD4, 0x0C, 0xE4, 0xA4, 0x62, 0x50, 0x69, 0x51,
-    0x2F, 0x30, 0x59, 0xAA, 0x85, 0x36, 0x0B, 0xAD, 0xCC, 0x46, 0xBB, 0xB1, 0xDA, 0xAD, 0xFC, 0xD5,
-    0x69, 0x1F, 0xF5, 0xE7, 0x94, 0x32, 0x9B, 0xAE, 0xB1, 0xF3, 0x97, 0xE6, 0x14, 0x33, 0x1B, 0x77,
-    0x60, 0x4F, 0x7D, 0xE5, 0xA6, 0x39, 0xFD, 0xF3, 0xEC, 0xCD, 0x70, 0x30, 0x2F, 0xDE, 0x94, 0xF0,
-    0x9C, 0x89, 0x85, 0x22, 0xE5, 0x3E, 0x64, 0xE0, 0x0F, 0xED, 0xB7, 0x24, 0xF2, 0xE3, 0x2A, 0x0F,
-    0x13, 0x59, 0xA2, 0xB5, 0x67, 0x35, 0xDF, 0xA8, 0x00, 0x0C, 0xC6, 0xB2, 0x7E, 0xD6, 0x11, 0xB2,
-    0x6D, 0x29, 0x42, 0x90, 0x88, 0x91, 0xB5, 0xB8, 0x4A, 0xB8, 0x6F, 0xE4, 0xCB, 0xC8, 0x31, 0xB5,
-    0x7C, 0x19, 0x19, 0xA6, 0x8E, 0xC7, 0x8B, 0xA2, 0x63, 0x09, 0xD0, 0xB6, 0x13, 0x51, 0x90, 0x60,
-    0x4A, 0x5D, 0xD6, 0x45, 0xEF, 0xD4, 0x32, 0x83, 0x53, 0xE1, 0xC4, 0x59, 0x8A, 0xEF, 0x7C, 0x34,
-    0x9C, 0x96, 0x45, 0xC8, 0x10, 0x42, 0x77, 0xD7, 0x53, 0xA4, 0x91, 0x8C, 0x9F, 0x24, 0x34, 0xB1,
-    0x9D, 0x45, 0xAD, 0x41, 0xCF, 0xD2, 0x78, 0x8B, 0x1C, 0x06, 0x95, 0x61, 0xF4, 0xEF, 0xE3, 0xCE,
-    0xE0, 0x67, 0x18, 0xA3, 0xEF, 0x31, 0x86, 0x73, 0xCA, 0x7D, 0x8E, 0x47, 0x5C, 0x86, 0x86, 0xD8,
-    0x16, 0x3B, 0x1E, 0x3C, 0xF8, 0x09, 0x33, 0x35, 0xD2, 0x43, 0xC2, 0xC5, 0x1E, 0x50, 0xD3, 0x77,
-    0x18, 0xDB, 0x7A, 0xEC, 0x50, 0x80, 0x14, 0x51, 0xA7, 0x93, 0x79, 0xCE, 0xBE, 0x53, 0x20, 0x8F,
-    0x0D, 0x62, 0x9F, 0x62, 0xA1, 0x71, 0x79, 0x5D, 0xD6, 0xFD, 0xEB, 0x01, 0x5B, 0xD2, 0x62, 0x7F,
-    0xB0, 0xDA, 0xC3, 0x79, 0x79, 0xBB, 0xD3, 0x57, 0x73, 0xE6, 0x3D, 0xE6, 0xBC, 0x00, 0x1A, 0xA6,
-    0x7A, 0xA9, 0x5B, 0xE6, 0x38, 0xE6, 0x37, 0xE6, 0x36, 0xE6, 0x35, 0xE6, 0x34, 0xE6, 0x33, 0xE6,
-    0x32, 0xE4, 0x31, 0xE6, 0xB0, 0x1A, 0xF9, 0xCB, 0xE5, 0x2E, 0x9D, 0x37, 0x97, 0x79, 0xA3, 0x7B,
-    0x1F, 0x33, 0xAF, 0x86, 0x73, 0xA8, 0xC2, 0xC5, 0xB6, 0x59, 0xE7, 0x4C, 0x63, 0xF1, 0x26, 0x30,
-    0x31, 0x6C, 0x33, 0x69, 0x70, 0xA0, 0xB1, 0xD2, 0x50, 0x69, 0xA4, 0x95, 0xAB, 0x92, 0x34, 0x85,
-    0xD1, 0x4C, 0xB9, 0x91, 0xA9, 0x94, 0x06, 0x62, 0xDE, 0x3D, 0xAC, 0x72, 0xEF, 0xC0, 0x1B, 0x92,
-    0x57, 0xDA, 0xC8, 0x96, 0x62, 0x92, 0xA8, 0x6B, 0xC4, 0xF0, 0x7E, 0x8C, 0xED, 0x92, 0x60, 0x21,
-    0x33, 0xCA, 0xFF, 0x32, 0x65, 0xCC, 0x82, 0x26, 0x61, 0x79, 0x92, 0xB6, 0x34, 0x26, 0xB1, 0xA3,
-    0xB7, 0x45, 0xB2, 0x52, 0x8A, 0x2E, 0x93, 0x13, 0x13, 0x5C, 0xC2, 0x7A, 0xC4, 0x63, 0x64, 0x69,
-    0x77, 0x3B, 0xE7, 0xCE, 0x46, 0xAB, 0x3A, 0x63, 0xAE, 0x6E, 0xB7, 0x3C, 0xB5, 0xC4, 0x16, 0x90,
-    0x50, 0x0B, 0xDE, 0x8C, 0xA1, 0x0C, 0xA8, 0xC6, 0xE1, 0x03, 0xC5, 0x34, 0x0A, 0x69, 0x14, 0xD1,
-    0x28, 0xA0, 0xC9, 0x36, 0xA3, 0xAD, 0x15, 0xCD, 0x28, 0x98, 0x51, 0x2C, 0xA3, 0x50, 0x46, 0x91,
-    0x8C, 0x02, 0x19, 0xC5, 0x31, 0x0E, 0xC6, 0x38, 0x14, 0x73, 0x45, 0x23, 0xD3, 0x9F, 0xB1, 0xF3,
-    0x39, 0x31, 0x0D, 0x21, 0x0D, 0x10, 0xCD, 0x1A, 0x80, 0x66, 0x52, 0x3C, 0x43, 0x38, 0x43, 0x34,
-    0xC3, 0xCC, 0x41, 0x2C, 0x43, 0x28, 0x43, 0x24, 0xC3, 0x44, 0x43, 0x1C, 0x43, 0x18, 0xA3, 0x28,
-    0x66, 0x6F, 0x51, 0x6A, 0x1E, 0xF9, 0x2C, 0x3D, 0xE2, 0xC6, 0x68, 0x79, 0x69, 0x58, 0x5A, 0x2E,
-    0x8B, 0x70, 0xE0, 0x1B, 0x49, 0x9C, 0x02, 0x6F, 0x6C, 0x0B, 0x74, 0xF3, 0x32, 0x37, 0xEE, 0x88,
-    0x61, 0xE3, 0x36, 0x6D, 0xA2, 0x67, 0x34, 0xEF, 0x1C, 0xB0, 0x51, 0x5C, 0x03, 0x58, 0xD3, 0x3A,
-    0x54, 0xA3, 0xA0, 0x46, 0x31, 0x8D, 0x42, 0x1A, 0x45, 0x34, 0x0A, 0x68, 0x14, 0xCF, 0x28, 0x9C,
-    0x51, 0x34, 0xA3, 0x60, 0xC6, 0x61, 0x19, 0x85, 0x32, 0x1E, 0xAE, 0x61, 0x9D, 0x4A, 0xFD, 0xDB,
-    0xAD, 0x67, 0xCF, 0xA4, 0xA7, 0x5F, 0x9A, 0x43, 0x94, 0x40, 0x9B, 0x92, 0xC8, 0x86, 0xC0, 0x06,
-    0x88, 0x26, 0xC7, 0x40, 0x54, 0xA3, 0xA0, 0x66, 0xEB, 0x2E, 0x44, 0x34, 0x04, 0x34, 0xC4, 0x33,
-    0x84, 0x33, 0x44, 0x33, 0x04, 0x33, 0x8A, 0x65, 0x14, 0xCA, 0xEC, 0x1C, 0x42, 0x11, 0x09, 0xE7,
-    0x7B, 0x4A, 0x0A, 0x4F, 0xB3, 0x29, 0xCF, 0x99, 0x82, 0x43, 0x58, 0xD7, 0x75, 0x8E, 0x5F, 0xF0,
-    0xCA, 0x73, 0xA5, 0xB1, 0xD5, 0x0A, 0xFB, 0x2D, 0x53, 0x7A, 0x87, 0xB3, 0x25, 0x85, 0xCD, 0xCB,
-    0x72, 0x6F, 0x2B, 0x68, 0x39, 0x6A, 0x8E, 0x71, 0xE3, 0xDE, 0x99, 0xEA, 0xCE, 0xFD, 0x44, 0x8C,
-    0xA8, 0x31, 0x33, 0x54, 0xC6, 0x77, 0x6E, 0x3F, 0x16, 0x1A, 0x74, 0x1E, 0x88, 0xA0, 0xE7, 0x0F,
-    0xD4, 0x1E, 0xC4, 0xF8, 0xF4, 0xD5, 0xB8, 0x43, 0x47, 0x8D, 0x9F, 0x87, 0x09, 0x06, 0xBF, 0xAA,
-    0xB7, 0x29, 0xF0, 0xE6, 0xE3, 0x61, 0x88, 0x37, 0x9E, 0x90, 0x6B, 0x7F, 0x80, 0xF5, 0xF5, 0x73,
-    0x4E, 0x00, 0x5C, 0x08, 0x6B, 0xA8, 0xB1, 0xF9, 0x74, 0xAD, 0x51, 0x0B, 0x7D, 0x86, 0x3B, 0xE3,
-    0x38, 0x89, 0xD7, 0x1E, 0x0F, 0x35, 0x22, 0x0E, 0x05, 0x2C, 0x5A, 0x58, 0xF0, 0x1C, 0x98, 0xCF,
-    0xC4, 0x1A, 0x9F, 0xFE, 0x08, 0x04, 0x4C, 0x1D, 0xFC, 0xB6, 0xE8, 0x02, 0x00, 0x1F, 0x96, 0x02,
-    0xEE, 0xF7, 0x69, 0x2B, 0x4F, 0xFE, 0x60, 0x8C, 0xC6, 0x78, 0x48, 0xBA, 0xB8, 0xCB, 0x9A, 0xA4,
-    0xCD, 0x6A, 0xFC, 0x57, 0x99, 0xF4, 0xF7, 0x92, 0xB8, 0x90, 0xF5, 0x34, 0xAD, 0x5C, 0x3A, 0xCC,
-    0x59, 0x59, 0x60, 0x1B, 0x5E, 0x5C, 0x95, 0x9B, 0xDD, 0xE9, 0x41, 0x77, 0x79, 0x23, 0x18, 0x22,
-    0x29, 0x05, 0xB0, 0x55, 0xAF, 0xEE, 0x9E, 0x8F, 0x02, 0xCD, 0x5F, 0xFD, 0x18, 0x65, 0xC4, 0x1A,
-    0xE1, 0x74, 0x2E, 0x20, 0xE2, 0x12, 0x34, 0x52, 0x3D, 0x22, 0xB8, 0x8D, 0xF0, 0xD3, 0x8B, 0x67,
-    0x59, 0xAA, 0x7D, 0xBC, 0xD6, 0xD4, 0x8E, 0xA3, 0x7E, 0x3B, 0xFA, 0x37, 0xCE, 0x87, 0xD6, 0x76,
-    0x57, 0x12, 0xA3, 0x22, 0x0B, 0xE5, 0x50, 0x6B, 0x34, 0xCD, 0xCA, 0x71, 0xB5, 0x6E, 0xD8, 0x33,
-    0x67, 0xAB, 0x35, 0xD8, 0x6B, 0xEE, 0xAE, 0x2E, 0xAC, 0x1F, 0x2E, 0xB1, 0x4D, 0x24, 0x32, 0xAD,
-    0x17, 0x57, 0xFF, 0xAD, 0x81, 0x1E, 0x16, 0x7E, 0xBF, 0x27, 0x04, 0x8C, 0xC5, 0x79, 0x71, 0xDD,
-    0x17, 0xF7, 0xFD, 0x3C, 0x92, 0x97, 0xAA, 0xD2, 0xEB, 0x14, 0x8E, 0x05, 0xB5, 0xA2, 0xB1, 0x38,
-    0x2F, 0x48, 0x14, 0x7F, 0x49, 0xAA, 0x59, 0x5C, 0x8F, 0xB4, 0xD0, 0x35, 0x1F, 0x1D, 0xF2, 0x1A,
-    0x58, 0x5D, 0x45, 0xF4, 0x8B, 0x7F, 0xE4, 0x2A, 0xA8, 0x43, 0x0F, 0xB0, 0x53, 0x24, 0x94, 0x08,
-    0x31, 0xA0, 0xB0, 0x0E, 0x6B, 0x9F, 0x91, 0x24, 0x81, 0x16, 0x6F, 0x81, 0x3F, 0xCB, 0xAC, 0x32,
-    0x85, 0x4E, 0x8B, 0xB8, 0x28, 0x6E, 0x39, 0x5C, 0x00, 0x97, 0xDD, 0xC9, 0x5C, 0x63, 0x8D, 0xFE,
-    0x9E, 0x48, 0x08, 0xE5, 0x35, 0xB2, 0x19, 0xD0, 0x11, 0x4A, 0x40, 0xD9, 0x24, 0x9B, 0x8B, 0x0A,
-    0x27, 0xB0, 0x0C, 0xA2, 0x44, 0x10, 0x0B, 0x12, 0x11, 0xAE, 0xF5, 0x04, 0x59, 0xCA, 0x81, 0xAD,
-    0xAF, 0x90, 0x01, 0x1B, 0x58, 0x9D, 0x67, 0x23, 0xF9, 0xB6, 0xFF, 0x1C, 0x45, 0xDA, 0xE2, 0xDE,
-    0x5D, 0x2B, 0xF1, 0x31, 0xB3, 0xCF, 0x5B, 0x70, 0xBC, 0x6B, 0x2D, 0x98, 0xF3, 0x05, 0xFF, 0x2E,
-    0x11, 0xC1, 0x92, 0xB7, 0x81, 0x72, 0x11, 0x54, 0x6A, 0x84, 0x33, 0x50, 0x84, 0xA5, 0x29, 0xC8,
-    0x01, 0xBC, 0xEC, 0x88, 0x1F, 0xA5, 0x9A, 0x94, 0x5E, 0x4A, 0x17, 0x36, 0x99, 0x09, 0x86, 0x46,
-    0x0D, 0xED, 0x55, 0x24, 0x44, 0x92, 0x81, 0x44, 0x24, 0x48, 0x38, 0xB1, 0xB6, 0x32, 0xED, 0x9E,
-    0xA8, 0x1E, 0x00, 0x26, 0xCB, 0x9B, 0x52, 0x99, 0x0A, 0x58, 0x97, 0x1A, 0x1A, 0xD5, 0x7C, 0xCA,
-    0xCD, 0xDA, 0x58, 0x4F, 0x81, 0xA7, 0xBE, 0x2B, 0xE2, 0x48, 0x35, 0xFF, 0x43, 0x18, 0x7D, 0xF1,
-    0x15, 0x79, 0xA3, 0xCE, 0xC0, 0x97, 0x95, 0x08, 0xFA, 0x45, 0x5E, 0x94, 0x18, 0x2B, 0xD4, 0xD2,
-    0x39, 0x49, 0xDD, 0xFF, 0x21, 0x80, 0x21, 0x71, 0x9E, 0xD0, 0x24, 0xEE, 0x70, 0x63, 0xB5, 0xFE,
-    0x25, 0xF5, 0x2A, 0x26, 0x43, 0x6D, 0x60, 0x47, 0xA3, 0x8F, 0x6E, 0x81, 0x84, 0x2A, 0x61, 0xB5,
-    0x95, 0x07, 0x7D, 0x54, 0xDE, 0x6A, 0x7A, 0x55, 0x1E, 0x26, 0xD8, 0x18, 0xEC, 0x92, 0x98, 0xC1,
-    0xAE, 0xFD, 0xC8, 0x6C, 0x8A, 0x7A, 0xC5, 0x55, 0x26, 0xBC, 0x47, 0x47, 0x73, 0xFC, 0x7C, 0x69,
-    0x96, 0x95, 0xFD, 0x59, 0x6A, 0xCF, 0x51, 0xB8, 0xCA, 0xEF, 0x3E, 0x52, 0x7B, 0x0A, 0x91, 0x95,
-    0xA2, 0x57, 0x76, 0x5E, 0x89, 0x79, 0x9D, 0x73, 0x86, 0xC8, 0x9F, 0xB2, 0x86, 0x8D, 0x1B, 0x41,
-    0xF4, 0xFD, 0x11, 0x0D, 0x7B, 0x39, 0xD3, 0x62, 0xD0, 0x6A, 0x5D, 0x39, 0x54, 0x4A, 0x83, 0x28,
-    0x17, 0xA0, 0xAA, 0x31, 0x97, 0xF2, 0x65, 0x17, 0x61, 0x90, 0x98, 0x04, 0x1C, 0x5B, 0x90, 0x44,
-    0x37, 0x49, 0x4B, 0x6A, 0x36, 0xCD, 0x99, 0xBA, 0xEE, 0x10, 0xCF, 0xFA, 0x1D, 0x11, 0x6D, 0x54,
-    0x13, 0xD3, 0x1E, 0x28, 0xEB, 0xC4, 0x47, 0xA6, 0xBF, 0xE7, 0x9A, 0x33, 0x0D, 0x21, 0xF3, 0xE5,
-    0x6D, 0x6E, 0x67, 0x51, 0x5B, 0x45, 0xB8, 0xC4, 0x23, 0xB6, 0x66, 0x6F, 0x40, 0x76, 0x43, 0x69,
-    0x4C, 0x34, 0x0D, 0xB4, 0x21, 0x00, 0xAC, 0x1B, 0x82, 0xDC, 0xB0, 0xBD, 0x47, 0x38, 0x0C, 0x11,
-    0xBC, 0x0E, 0xB3, 0x8D, 0xA8, 0x8B, 0x0B, 0xCC, 0xC4, 0x6F, 0xCD, 0x64, 0x6A, 0xA8, 0x55, 0x40,
-    0xE3, 0x38, 0xE1, 0x25, 0x92, 0x26, 0x88, 0x7E, 0x61, 0xF5, 0x23, 0xCF, 0x0A, 0xA6, 0x93, 0xE7,
-    0x5B, 0x01, 0x87, 0x1E, 0x78, 0x7C, 0xA9, 0x52, 0x83, 0xB5, 0x48, 0x15, 0x8E, 0xC7, 0x68, 0x79,
-    0x68, 0xD0, 0x96, 0x61, 0x0D, 0xEA, 0xAA, 0x93, 0x2F, 0x27, 0x08, 0x5C, 0x69, 0x07, 0x9A, 0xBB,
-    0x4D, 0xC0, 0xC2, 0x44, 0x36, 0x2F, 0x6A, 0xCF, 0xE6, 0xE7, 0x02, 0x14, 0xFB, 0x9A, 0xC5, 0xB8,
-    0xA9, 0x69, 0xBE, 0x85, 0x0C, 0x19, 0x1D, 0x27, 0x9D, 0xB6, 0x8C, 0x0F, 0x50, 0xB1, 0x80, 0x62,
-    0x60, 0x62, 0x40, 0x62, 0x20, 0x62, 0x00, 0x62, 0xE0, 0x61, 0xC0, 0x61, 0xA0, 0x61, 0x80, 0x61,
-    0x60, 0x61, 0xC4, 0x41, 0x20, 0x61, 0x00, 0x61, 0xE0, 0x60, 0xC2, 0xE0, 0xEB, 0x24, 0x20, 0x0D,
-    0x88, 0x21, 0xB4, 0x21, 0x80, 0x52, 0xB0, 0x3B, 0xAA, 0x88, 0xC4, 0x92, 0xC8, 0xE0, 0xB8, 0x8C,
-    0xB5, 0x8F, 0x89, 0x6E, 0x62, 0xB4, 0x7D, 0x44, 0xC8, 0x79, 0xE9, 0x67, 0xAA, 0x2B, 0xE6, 0x59,
-    0xB6, 0x72, 0xD8, 0xC6, 0x61, 0x0B, 0x87, 0xED, 0x9B, 0x0D, 0xB9, 0x96, 0x21, 0x5A, 0x72, 0x28,
-    0xE0, 0xC4, 0xC7, 0x87, 0xD7, 0x72, 0x29, 0x96, 0xC5, 0xE7, 0x3A, 0xF5, 0x38, 0xAC, 0x1F, 0xCD,
-    0x4C, 0xAF, 0x37, 0xFA, 0x60, 0x19, 0x86, 0x99, 0xC3, 0x53, 0xB0, 0xC3, 0x99, 0x6C, 0x7E, 0x19,
-    0xC3, 0x31, 0x2A, 0x0F, 0x18, 0xBC, 0xD6, 0x02, 0xD9, 0x83, 0x4A, 0x0A, 0x6B, 0x0B, 0x92, 0x64,
-    0x27, 0x9F, 0x43, 0x43, 0xD0, 0x24, 0xA2, 0xBD, 0x1E, 0x8D, 0x61, 0x3E, 0xAA, 0x68, 0x97, 0x01,
-    0xE1, 0xC5, 0xD5, 0x0A, 0x7E, 0x88, 0x40, 0x8B, 0x26, 0xD5, 0xFA, 0xF0, 0x75, 0x54, 0xEC, 0xBD,
-    0xF1, 0x6B, 0x82, 0xBC, 0x64, 0x0E, 0x55, 0x04, 0x05, 0xF1, 0xFB, 0x34, 0x08, 0xA8, 0xBD, 0xE8,
-    0x66, 0xCA, 0x8B, 0x7A, 0x0E, 0x96, 0xC3, 0xE7, 0xF0, 0x1E, 0xA9, 0xEB, 0x35, 0x02, 0xB0, 0x25,
-    0xAF, 0x79, 0x1F, 0x61, 0x4D, 0x43, 0x3F, 0x56, 0xE5, 0x77, 0x08, 0x57, 0x63, 0xB1, 0xF1, 0xF6,
-    0x6E, 0xE1, 0xED, 0x52, 0x63, 0xDE, 0x98, 0x13, 0xC5, 0xD6, 0xDD, 0xD5, 0xE7, 0xCB, 0x25, 0x71,
-    0x46, 0x26, 0x74, 0xD9, 0x6D, 0x78, 0x24, 0x2D, 0xB7, 0x65, 0xE4, 0x1A, 0x17, 0x3D, 0x9E, 0xB3,
-    0x73, 0xA0, 0xF9, 0x5B, 0x69, 0xAE, 0xAA, 0x98, 0x4E, 0x60, 0x47, 0x0C, 0xAB, 0x90, 0xF4, 0x99,
-    0xB5, 0x9A, 0xC7, 0x63, 0xD7, 0x48, 0x75, 0xF4, 0xBD, 0x6B, 0x8C, 0xA0, 0x91, 0xFA, 0x71, 0xFD,
-    0x81, 0x6D, 0xA3, 0xE0, 0x9C, 0x37, 0x52, 0x8D, 0x23, 0x7E, 0xB5, 0x03, 0xA4, 0x82, 0x30, 0xB7,
-    0x33, 0x36, 0x2C, 0x0F, 0x36, 0x9C, 0x8B, 0xD2, 0xC9, 0xC5, 0x38, 0x7D, 0x6C, 0x41, 0xDD, 0xF2,
-    0xD3, 0xA0, 0x5D, 0xAE, 0xF6, 0x5C, 0x95, 0x4E, 0x52, 0x09, 0x65, 0x1A, 0x12, 0x6D, 0x9F, 0xF2,
-    0x05, 0x10, 0x88, 0x75, 0x8E, 0x10, 0xCC, 0x59, 0x44, 0x75, 0x17, 0x8D, 0x73, 0x46, 0x19, 0x34,
-    0xB0, 0xD0, 0x09, 0x06, 0xA7, 0x50, 0x6D, 0xB9, 0xC0, 0x3E, 0xFB, 0x4C, 0x36, 0x23, 0x43, 0x87,
-    0x15, 0x9D, 0x02, 0x90, 0xF2, 0x5D, 0x60, 0xB5, 0xA3, 0x4F, 0xF8, 0x08, 0xF3, 0x6F, 0xF0, 0x48,
-    0x36, 0x79, 0x22, 0xED, 0xD6, 0x56, 0xB5, 0x6B, 0xD7, 0x56, 0xB5, 0xEB, 0xD7, 0x56, 0x75, 0xC2,
-    0x86, 0xAD, 0xDC, 0x83, 0x5D, 0x10, 0x6B, 0x4F, 0x1F, 0xE0, 0x46, 0x79, 0x66, 0x38, 0xFB, 0xED,
-    0xB6, 0x97, 0xA7, 0xC9, 0xA2, 0xEA, 0x21, 0xDA, 0x4F, 0xF9, 0x71, 0xF6, 0xD6, 0x0B, 0x6C, 0x8C,
-    0x0F, 0x0C, 0x96, 0x45, 0xC7, 0x70, 0x27, 0x65, 0x19, 0xCC, 0xDF, 0xD6, 0x7A, 0xC1, 0x74, 0xB4,
-    0x59, 0x5B, 0x72, 0x2A, 0x2D, 0x07, 0x11, 0x53, 0xA1, 0x87, 0x89, 0xA1, 0xD4, 0x11, 0x1A, 0x90,
-    0x8F, 0xBC, 0x08, 0xE5, 0x87, 0xEB, 0xC4, 0x3D, 0xDA, 0x7B, 0x62, 0x25, 0x2E, 0xB6, 0xD2, 0xAF,
-    0xD2, 0x87, 0xAE, 0x38, 0x64, 0x8C, 0x71, 0x5D, 0x3A, 0xE7, 0x71, 0xD5, 0x89, 0x8B, 0x3A, 0xEE,
-    0xD3, 0xF6, 0x7D, 0xBD, 0x7F, 0x5C, 0x5A, 0xFC, 0xA6, 0xA1, 0xE5, 0x50, 0x6A, 0xE6, 0x0E, 0x60,
-    0xD5, 0xE6, 0xB4, 0xE1, 0x6B, 0x03, 0xD3, 0xB5, 0x2F, 0x5D, 0xF3, 0x72, 0x6E, 0x5D, 0xBA, 0xC6,
-    0xA5, 0xF6, 0x76, 0x5D, 0x63, 0xD7, 0x75, 0x75, 0x5D, 0x4B, 0xD7, 0xF5, 0x73, 0x5D, 0x33, 0xD7,
-    0x75, 0x72, 0x5D, 0x1B, 0x57, 0xDB, 0x94, 0xAE, 0x49, 0xE9, 0x5A, 0x94, 0xAE, 0x41, 0xE9, 0xDA,
-    0x93, 0xAE, 0x39, 0xE9, 0x5A, 0x93, 0xAE, 0x31, 0xE9, 0xDC, 0x80, 0x96, 0xA2, 0x47, 0x8D, 0x78,
-    0x20, 0x2B, 0x61, 0x36, 0x5E, 0xB6, 0x10, 0xD9, 0x3F, 0x64, 0xF3, 0x90, 0x9D, 0x43, 0xB6, 0x0D,
-    0xB5, 0x67, 0x38, 0x9E, 0xA2, 0xA3, 0xD8, 0x27, 0x64, 0x93, 0x10, 0x19, 0x1E, 0xF6, 0xC1, 0xDE,
-    0xA0, 0x36, 0x06, 0xD1, 0x15, 0x9C, 0x8F, 0x36, 0xCD, 0xBE, 0x57, 0xCF, 0x5C, 0xAD, 0x09, 0xB4,
-    0x4C, 0x2A, 0xB7, 0xC7, 0x12, 0x98, 0x50, 0x4C, 0xFF, 0x12, 0xC6, 0x96, 0xFD, 0xDD, 0x8E, 0x63,
-    0xD5, 0x6F, 0xA3, 0x01, 0xA3, 0xA8, 0xF7, 0x01, 0xC6, 0xE0, 0xE7, 0x78, 0x3F, 0x7A, 0x05, 0x66,
-    0x9E, 0x44, 0x5B, 0x52, 0xE4, 0x36, 0xC2, 0x9F, 0xC7, 0x68, 0x18, 0xB0, 0xBB, 0x1B, 0xB9, 0x53,
-    0x39, 0x96, 0x74, 0x88, 0x92, 0x82, 0x8F, 0xA2, 0x43, 0x5C, 0x05, 0xC2, 0xB5, 0xDA, 0x99, 0xCE,
-    0x23, 0x80, 0xA1, 0x4D, 0x3F, 0x49, 0xD7, 0x96, 0x7F, 0x06, 0x6F, 0xCA, 0x32, 0x82, 0x12, 0x43,
-    0xDD, 0xCD, 0x08, 0xE0, 0x9F, 0xCF, 0x9C, 0x27, 0xD9, 0xD4, 0x47, 0x8A, 0x52, 0x8D, 0xBF, 0x5E,
-    0x12, 0xF8, 0x6E, 0x3F, 0x4F, 0x1C, 0x82, 0x7B, 0x8C, 0xF8, 0x93, 0x19, 0x75, 0xFB, 0x1A, 0x46,
-    0x22, 0x3D, 0x61, 0x90, 0x68, 0xA6, 0x3C, 0x58, 0x9C, 0x95, 0xFB, 0xAC, 0x49, 0x15, 0x8D, 0x06,
-    0x1A, 0x6C, 0x93, 0x76, 0x1B, 0x09, 0x06, 0x77, 0x76, 0x4A, 0x97, 0x8F, 0x63, 0x1F, 0xF6, 0xDF,
-    0x89, 0x45, 0xC6, 0x2D, 0x16, 0xF1, 0x89, 0x45, 0x42, 0x56, 0x15, 0x31, 0xB1, 0xC8, 0x65, 0x62,
-    0x91, 0xD7, 0x80, 0x45, 0xBC, 0x16, 0x58, 0x44, 0x12, 0xB2, 0xC4, 0xD6, 0x98, 0x58, 0xE4, 0xEF,
-    0x89, 0x45, 0x5E, 0x22, 0x16, 0xE9, 0x80, 0x45, 0x7E, 0x03, 0xB3, 0xCE, 0xEE, 0x83, 0x27, 0x16,
-    0x0D, 0x6A, 0x3D, 0xB7, 0xC1, 0x22, 0x01, 0xB1, 0x48, 0xF8, 0x01, 0xAC, 0x31, 0x36, 0x27, 0x0E,
-    0xE9, 0xD1, 0x70, 0x10, 0xE3, 0xBC, 0x69, 0x76, 0xC0, 0xAD, 0x59, 0x83, 0xF4, 0xF6, 0xAA, 0x1F,
-    0xA2, 0x86, 0x46, 0x02, 0xF8, 0x36, 0x2A, 0x77, 0x1F, 0xCA, 0x94, 0xE0, 0x8D, 0xCA, 0xAA, 0x8E,
-    0xFB, 0x7D, 0x09, 0xFC, 0xDD, 0x6D, 0x5B, 0xA6, 0x1F, 0xB6, 0xA2, 0xAB, 0xF7, 0xDE, 0x80, 0xBB,
-    0xC8, 0x7A, 0xD2, 0x35, 0x62, 0x01, 0x4E, 0xC0, 0xC4, 0x7D, 0x82, 0x28, 0x84, 0x7A, 0x13, 0x0F,
-    0xD9, 0xDF, 0xD9, 0x9A, 0xE1, 0x25, 0xC6, 0x9E, 0xEC, 0x15, 0x58, 0x55, 0xF2, 0x5F, 0xAC, 0xCD,
-    0xBB, 0x63, 0x16, 0x0C, 0x29, 0xF7, 0x74, 0xE7, 0x7C, 0x50, 0xA1, 0x57, 0xA1, 0xA3, 0x29, 0x45,
-    0xB2, 0x8F, 0x71, 0xD0, 0xEB, 0x3B, 0xC0, 0x50, 0x0D, 0x26, 0x98, 0x09, 0xFB, 0x33, 0x74, 0xEC,
-    0x4D, 0x5B, 0x37, 0xA3, 0xF3, 0x1C, 0x5F, 0xC3, 0x7E, 0x75, 0x61, 0xE9, 0x48, 0x88, 0xF3, 0xA0,
-    0x1F, 0x3D, 0xC9, 0xCB, 0xE8, 0x87, 0x50, 0x1C, 0xFF, 0x52, 0x6E, 0x7C, 0xC6, 0xBC, 0x84, 0xF7,
-    0xCF, 0x94, 0x56, 0xDF, 0xC9, 0xE1, 0x6F, 0xF1, 0x87, 0x04, 0x51, 0x7D, 0xC1, 0xFE, 0x0A, 0x8F,
-    0x89, 0x1C, 0x84, 0x6A, 0xC1, 0xF9, 0xE2, 0x20, 0x2A, 0x19, 0x24, 0xAB, 0x15, 0x43, 0xC6, 0x7A,
-    0x29, 0x61, 0xDA, 0x7B, 0x86, 0x0E, 0xFB, 0xE4, 0x5C, 0xB6, 0x6A, 0x5D, 0x94, 0xCC, 0xD5, 0x51,
-    0x4E, 0x04, 0x9C, 0xCF, 0xA5, 0x81, 0xC6, 0x3B, 0x4D, 0x58, 0x5A, 0x17, 0x88, 0xD4, 0x0C, 0x16,
-    0x48, 0xD2, 0x22, 0x9D, 0x1E, 0x8B, 0x6A, 0x59, 0x58, 0x35, 0x3C, 0xAF, 0x86, 0x63, 0x90, 0x57,
-    0x25, 0x0E, 0x8B, 0xEB, 0x8C, 0x12, 0x0D, 0x8E, 0xC5, 0xB9, 0x52, 0x29, 0x31, 0x77, 0xDC, 0x06,
-    0xEF, 0xE2, 0x2C, 0xB5, 0xED, 0xBC, 0x75, 0xDC, 0x87, 0x7D, 0xDC, 0xC7, 0x52, 0x9D, 0xA4, 0x6D,
-    0xDC, 0x65, 0x12, 0x5A, 0x8B, 0xFF, 0x06, 0x12, 0x12, 0x2D, 0xFC, 0x42, 0xC3, 0x3A, 0x8A, 0x98,
-    0xA2, 0xF6, 0x73, 0x09, 0x01, 0x39, 0xE0, 0xBD, 0x8F, 0x1D, 0xDE, 0xD9, 0x46, 0x3F, 0x3D, 0x36,
-    0x93, 0x30, 0xE6, 0x1E, 0xFC, 0x13, 0x56, 0xF7, 0x12, 0xAA, 0x04, 0xF9, 0xF0, 0x7C, 0xE8, 0x41,
-    0xED, 0x44, 0x5E, 0xC0, 0x4A, 0x60, 0x24, 0xCF, 0x48, 0xB1, 0x32, 0x9B, 0xC8, 0x27, 0xA0, 0x07,
-    0xEF, 0xEA, 0x25, 0xE8, 0xB8, 0x34, 0x53, 0x22, 0x25, 0x6B, 0x28, 0x73, 0xBC, 0x21, 0xB6, 0x9A,
-    0x5F, 0xDC, 0x1C, 0x85, 0x41, 0x7D, 0xEB, 0xAA, 0x44, 0x16, 0x3C, 0x08, 0xD4, 0x3C, 0xC1, 0xD8,
-    0xAB, 0xA4, 0xA9, 0x42, 0x5E, 0xCA, 0x08, 0x09, 0x21, 0x5F, 0xA5, 0xE5, 0x27, 0x27, 0x26, 0x0A,
-    0xD0, 0x73, 0x2F, 0x58, 0x0F, 0xA2, 0x17, 0x62, 0x57, 0x72, 0x57, 0xF0, 0x53, 0x2B, 0x60, 0xAA,
-    0xCF, 0xB6, 0x31, 0x6B, 0xF5, 0x23, 0x65, 0x2F, 0xF0, 0x5C, 0xE0, 0xF8, 0xE4, 0x63, 0x9E, 0x0D,
-    0x61, 0xDC, 0xB3, 0x8D, 0xFD, 0xAE, 0xC1, 0x59, 0x6E, 0xE2, 0x7B, 0x6F, 0xB3, 0x65, 0x2D, 0x05,
-    0x0C, 0xDF, 0x95, 0x48, 0x2A, 0xA5, 0xDE, 0x8E, 0x8B, 0x9D, 0x67, 0x20, 0x0F, 0xE6, 0x2C, 0x04,
-    0x4D, 0x0E, 0xC1, 0xBB, 0x77, 0xA2, 0x5C, 0xE2, 0xF4, 0x85, 0xBF, 0xF0, 0x14, 0x8F, 0x77, 0x05,
-    0x7E, 0x19, 0xF6, 0x00, 0x7F, 0xDE, 0x48, 0x8A, 0xEB, 0x3A, 0x73, 0x4A, 0xF2, 0x65, 0x56, 0x6A,
-    0xE6, 0x9C, 0x90, 0x72, 0x5C, 0xC7, 0xC6, 0x6A, 0x5E, 0x87, 0xD5, 0x7C, 0x4D, 0x52, 0xD5, 0xC2,
-    0x6A, 0xFE, 0x5A, 0xF2, 0x6D, 0x51, 0x6E, 0x69, 0xFF, 0x80, 0x8D, 0x54, 0x93, 0xFC, 0x5B, 0x47,
-    0xDA, 0xAC, 0x63, 0x2A, 0x3C, 0x4F, 0xDA, 0x78, 0xB4, 0x8F, 0x7E, 0x02, 0xDA, 0xF0, 0xAE, 0x1C,
-    0xB2, 0x7A, 0x56, 0xDB, 0x48, 0x49, 0x93, 0x45, 0xD4, 0xC9, 0x0B, 0xA7, 0x6C, 0x43, 0x89, 0x9F,
-    0x82, 0x95, 0x69, 0x30, 0x01, 0x2A, 0xE1, 0x78, 0x54, 0x8D, 0xA5, 0xE3, 0x14, 0x3D, 0x47, 0x24,
-    0x0A, 0x19, 0x7B, 0x28, 0x37, 0xE9, 0x68, 0xCC, 0x3C, 0x20, 0x9D, 0x3D, 0x20, 0x67, 0x45, 0xAE,
-    0x3F, 0x7B, 0x53, 0x0F, 0x5C, 0x33, 0x74, 0xD4, 0x6A, 0xFF, 0x20, 0x73, 0x98, 0x5C, 0xC0, 0xF2,
-    0x13, 0xB6, 0x26, 0xA2, 0x1F, 0xFB, 0x7E, 0x84, 0x48, 0x33, 0x7A, 0x55, 0x89, 0xD4, 0x82, 0xC4,
-    0xC2, 0xB4, 0x82, 0xA4, 0x82, 0x94, 0xE2, 0x12, 0xCA, 0xB3, 0x37, 0xA3, 0x3E, 0x1B, 0x8B, 0x31,
-    0x1C, 0x1F, 0x8E, 0xE1, 0xF4, 0x86, 0xD4, 0x42, 0xA6, 0x8F, 0x26, 0x93, 0xC7, 0xCE, 0xFD, 0x66,
-    0xD7, 0x9B, 0xDD, 0xEE, 0x84, 0xEB, 0x95, 0x8F, 0xB2, 0x88, 0xCB, 0xA7, 0x2D, 0xE2, 0x33, 0xD5,
-    0xC1, 0xE6, 0x2C, 0x66, 0x2A, 0x5F, 0x3E, 0xF8, 0x46, 0x6D, 0x5E, 0x0B, 0x10, 0xE4, 0x3F, 0x19,
-    0x1D, 0xB8, 0xD2, 0xEF, 0xA7, 0xAC, 0x37, 0xEF, 0x91, 0x87, 0xED, 0x88, 0x3C, 0x07, 0x96, 0x7E,
-    0x7B, 0x3B, 0xE7, 0xE9, 0x0C, 0x1B, 0x8D, 0x36, 0x18, 0x0B, 0x79, 0xBD, 0x46, 0x93, 0x2D, 0x8B,
-    0x40, 0x2B, 0x7C, 0x0B, 0xF8, 0xCE, 0x05, 0x8A, 0x33, 0x3B, 0xF9, 0x72, 0x71, 0x7B, 0xCC, 0x57,
-    0x79, 0xEC, 0x3F, 0x9E, 0xD9, 0xCF, 0xC7, 0xA9, 0x2B, 0xCF, 0x25, 0x2C, 0x79, 0x1B, 0xE7, 0x21,
-    0xDF, 0xBD, 0x03, 0xB4, 0xB3, 0x8F, 0xE4, 0x7C, 0xE1, 0xCC, 0xCF, 0x07, 0xF9, 0xA0, 0xC8, 0xD2,
-    0x87, 0xE0, 0x88, 0x72, 0xB1, 0x34, 0x09, 0x7A, 0x8D, 0x27, 0xCF, 0xA8, 0x05, 0x34, 0x3E, 0xA9,
-    0x8C, 0xBB, 0x63, 0xA4, 0x07, 0x12, 0x6F, 0x04, 0x61, 0xED, 0xDC, 0xAD, 0x60, 0xF3, 0x51, 0xB2,
-    0xD7, 0x2E, 0xA3, 0x65, 0x8E, 0xF6, 0x44, 0x2E, 0xDF, 0xAE, 0x6A, 0x9F, 0x5C, 0xC6, 0x60, 0x92,
-    0xE9, 0x16, 0xE2, 0xE9, 0xB4, 0xE4, 0xFC, 0x15, 0xDC, 0xBD, 0x3E, 0x1F, 0xEB, 0xF1, 0xBA, 0x8D,
-    0x22, 0x9E, 0x96, 0x40, 0x69, 0xAB, 0x36, 0x18, 0xE2, 0x2E, 0xEA, 0xC2, 0x2E, 0xEA, 0x83, 0x86,
-    0x7F, 0xF5, 0x63, 0xC1, 0x44, 0x22, 0x76, 0x5B, 0xF8, 0x3D, 0xDD, 0xE1, 0x40, 0x62, 0x7C, 0x21,
-    0xCB, 0x2C, 0xF2, 0xAC, 0xCC, 0xFE, 0x77, 0x92, 0xB7, 0x17, 0x69, 0x63, 0xAD, 0xC7, 0xD7, 0xC0,
-    0x48, 0xA2, 0xA2, 0xDD, 0x71, 0x50, 0xDD, 0xE6, 0x31, 0xB9, 0xF1, 0xB8, 0x2C, 0xEA, 0x54, 0xF6,
-    0x45, 0x10, 0x98, 0x01, 0x1E, 0x7C, 0x06, 0x8C, 0x50, 0xF9, 0x77, 0x73, 0xCB, 0x45, 0x4F, 0x5D,
-    0x6B, 0x0F, 0x46, 0x2D, 0xC8, 0x31, 0x84, 0xEB, 0x6D, 0xB7, 0x29, 0x1A, 0xB7, 0x8C, 0xED, 0x89,
-    0x92, 0x6F, 0x0B, 0x27, 0x76, 0x29, 0x75, 0xBC, 0xFD, 0x43, 0xA7, 0x13, 0xE2, 0xBB, 0xBF, 0xDF,
-    0x1B, 0xCD, 0xAC, 0x81, 0x25, 0xDD, 0x05, 0xAE, 0x0A, 0x5D, 0x99, 0x04, 0xAC, 0xDD, 0xFF, 0xF1,
-    0x19, 0x3B, 0xF6, 0x07, 0x5C, 0x18, 0x7E, 0x7D, 0x25, 0xEE, 0xFE, 0x7F, 0xFD, 0xE2, 0x6A, 0x98,
-    0x78, 0xFC, 0x3C, 0xF5, 0x41, 0xCA, 0x68, 0x6F, 0x4B, 0x68, 0xA0, 0x96, 0x00, 0xA1, 0xB1, 0x7F,
-    0x92, 0xD0, 0xC0, 0xA6, 0x46, 0x53, 0x85, 0x43, 0xB3, 0xE0, 0x9C, 0x78, 0x90, 0x16, 0xCF, 0xCC,
-    0x5C, 0x5F, 0xA5, 0x77, 0x7F, 0x7F, 0x40, 0x02, 0xFF, 0x1A, 0xFF, 0xB2, 0x02, 0x24, 0xE1, 0xBF,
-    0xDA, 0x0D, 0xBD, 0x57, 0x6D, 0xDA, 0xB5, 0x55, 0xB3, 0x3C, 0xF8, 0xCC, 0x6F, 0x84, 0x3C, 0xF3,
-    0x3C, 0x38, 0x4E, 0xE7, 0x1A, 0xE3, 0x22, 0x1A, 0x30, 0x37, 0x36, 0xA9, 0xD3, 0xAB, 0xDE, 0x91,
-    0x69, 0x1E, 0x22, 0x6F, 0x97, 0x28, 0xB3, 0x91, 0x62, 0xAF, 0xE3, 0x29, 0x4F, 0xBA, 0x06, 0xD0,
-    0xCC, 0x14, 0x82, 0x1B, 0xD8, 0xC5, 0x5B, 0x89, 0x40, 0x1B, 0x73, 0x21, 0xDA, 0x76, 0xA5, 0x4E,
-    0xF6, 0x83, 0x48, 0x7F, 0xB3, 0x1F, 0x57, 0xD1, 0x54, 0x73, 0x99, 0x02, 0x7F, 0xBC, 0x87, 0x7E,
-    0xD9, 0x37, 0xF3, 0x13, 0x7F, 0xA9, 0xD7, 0xF3, 0x94, 0xBC, 0x39, 0x26, 0xFE, 0x71, 0xE7, 0xE4,
-    0xDD, 0x41, 0xF9, 0x13, 0x27, 0xE5, 0x1D, 0x85, 0x7C, 0x4D, 0x09, 0x64, 0x47, 0x1F, 0x3B, 0xF2,
-    0xD8, 0x51, 0xC7, 0x8E, 0x38, 0x76, 0xB4, 0xB1, 0x23, 0x8D, 0x1D, 0x65, 0x4C, 0xC2, 0xD8, 0x28,
-    0x5D, 0x6C, 0x94, 0x2C, 0x76, 0x54, 0xB1, 0x23, 0x8A, 0x1D, 0x4D, 0xEC, 0x48, 0x62, 0x06, 0x7B,
-    0x96, 0x9B, 0x33, 0x67, 0x0B, 0x55, 0x4A, 0xC1, 0xF9, 0x9C, 0xD6, 0x9C, 0x3C, 0xA0, 0xAE, 0x22,
-    0xF0, 0x98, 0x3F, 0x4F, 0xF9, 0x73, 0xF1, 0x5C, 0xFA, 0xBC, 0xF0, 0x3F, 0xD9, 0x4C, 0x5F, 0xCB,
-    0xA7, 0x92, 0xA5, 0x7C, 0xFB, 0x4D, 0x10, 0x8C, 0x0D, 0x5A, 0x4E, 0x25, 0x8F, 0xA2, 0xEB, 0x99,
-    0xEA, 0x7C, 0x19, 0x5E, 0xC4, 0xB9, 0xE3, 0x6E, 0x1B, 0x63, 0x80, 0x3F, 0x05, 0xFB, 0x5E, 0x14,
-    0x10, 0x2A, 0xEB, 0xA9, 0x75, 0x96, 0x0B, 0xE6, 0x0F, 0x65, 0x55, 0x3F, 0x6C, 0xDC, 0x54, 0x18,
-    0xFF, 0xD9, 0x97, 0xD4, 0x69, 0xDC, 0xC6, 0x27, 0xB8, 0x93, 0x50, 0xD3, 0x9E, 0x3B, 0x30, 0x54,
-    0xA1, 0x17, 0x67, 0xE8, 0x10, 0x24, 0xFB, 0xDE, 0x1B, 0x90, 0x18, 0xB9, 0x81, 0xA8, 0x12, 0x1D,
-    0x9A, 0x81, 0xA9, 0x14, 0x7A, 0x43, 0x86, 0x03, 0x5D, 0x73, 0x66, 0x62, 0xBD, 0x05, 0xB1, 0x66,
-    0x60, 0x80, 0x43, 0x22, 0x1D, 0x8C, 0x54, 0xA4, 0xA4, 0x7E, 0xA2, 0x12, 0x42, 0x9D, 0xBC, 0x33,
-    0x60, 0x4A, 0x07, 0xD8, 0x1E, 0x92, 0x07, 0x53, 0x39, 0xF7, 0xF8, 0x3E, 0x3B, 0x09, 0xAA, 0x38,
-    0x3F, 0xBF, 0xF3, 0xB3, 0xBF, 0x7F, 0xEF, 0xFB, 0x7E, 0xDF, 0xEF, 0x75, 0xA5, 0x50, 0x7E, 0xEE,
-    0x68, 0x94, 0xE8, 0xA0, 0x2B, 0x61, 0x64, 0xEB, 0x04, 0xAE, 0x46, 0x20, 0x69, 0x0D, 0x7E, 0x93,
-    0x66, 0xB6, 0xD1, 0xEE, 0xF3, 0x22, 0x90, 0x47, 0x9D, 0xFA, 0x9D, 0x57, 0xAC, 0x89, 0xC5, 0x64,
-    0xDF, 0x94, 0xDA, 0xD7, 0xB0, 0x64, 0x60, 0x72, 0x61, 0xF2, 0xEE, 0x8E, 0x14, 0x26, 0xA3, 0x41,
-    0x0F, 0x6D, 0xB4, 0x43, 0xE8, 0xE0, 0x76, 0xE6, 0x1B, 0xE5, 0x2C, 0x80, 0x21, 0x96, 0x21, 0x54,
-    0x9A, 0xA5, 0x6A, 0x83, 0xD4, 0x21, 0xEC, 0x62, 0xDA, 0x2A, 0x69, 0xF4, 0xAD, 0x1C, 0xF0, 0xF5,
-    0xA0, 0x6A, 0x1F, 0xA1, 0x72, 0x72, 0x0F, 0xAB, 0xB8, 0x20, 0x45, 0x91, 0x84, 0xFA, 0xA6, 0x0E,
-    0xA7, 0xA5, 0x3B, 0xC3, 0xFB, 0xCB, 0xD2, 0xAE, 0x44, 0xEC, 0xE8, 0x05, 0xBC, 0x9F, 0x0A, 0x0C,
-    0x9C, 0x0C, 0x1D, 0x8B, 0x0D, 0x0E, 0x8F, 0x6C, 0x2D, 0x7C, 0xE5, 0x1B, 0x78, 0x15, 0xAC, 0x21,
-    0x59, 0xF5, 0xB1, 0x89, 0x3E, 0x22, 0x84, 0xEC, 0xC2, 0xF7, 0x64, 0xCF, 0xC3, 0xA6, 0x8F, 0x68,
-    0x13, 0x61, 0x1F, 0x5D, 0x92, 0x08, 0x9E, 0x96, 0xF0, 0x7E, 0xAF, 0xD0, 0xD2, 0xFB, 0x40, 0xE5,
-    0xCB, 0xDA, 0xD0, 0x01, 0xEC, 0x92, 0x47, 0x5B, 0xCB, 0xC7, 0x76, 0xB6, 0x7F, 0x47, 0x09, 0x03,
-    0xB7, 0x44, 0xF3, 0xB3, 0x8D, 0xF4, 0x8C, 0x0A, 0xBE, 0xCA, 0x69, 0x33, 0x6D, 0xF2, 0xF9, 0x61,
-    0xAB, 0xF0, 0x65, 0x84, 0x87, 0x48, 0xA5, 0x51, 0xA9, 0x0A, 0x58, 0x24, 0xF7, 0x4A, 0xAF, 0x72,
-    0x2A, 0xAB, 0xB4, 0x74, 0x2B, 0x13, 0x72, 0x8F, 0xDE, 0xB9, 0x71, 0x90, 0x4F, 0xF3, 0x54, 0x1D,
-    0x63, 0x42, 0xC1, 0xF8, 0xB1, 0x1D, 0xB3, 0x9C, 0xFB, 0x3F, 0xB9, 0x2E, 0xA6, 0xCA, 0xCF, 0x1C,
-    0x6D, 0x71, 0xE6, 0x77, 0xC8, 0x1B, 0x9C, 0x12, 0x7E, 0x86, 0x01, 0xD0, 0x06, 0x2C, 0x65, 0x93,
-    0x8F, 0xDB, 0x71, 0x4B, 0x02, 0x97, 0x71, 0x15, 0x81, 0x8E, 0x86, 0xB7, 0x9A, 0xB8, 0x84, 0xA1,
-    0x30, 0x15, 0x5C, 0x1A, 0x31, 0x3C, 0x09, 0x8F, 0x37, 0x8F, 0x8B, 0x54, 0x0A, 0x4F, 0xFB, 0x85,
-    0xAB, 0x5B, 0x7A, 0x9D, 0x9C, 0xD3, 0x4F, 0xBA, 0x6A, 0x53, 0x86, 0x14, 0x44, 0x00, 0x97, 0x56,
-    0x36, 0x99, 0x7C, 0xEB, 0x85, 0x28, 0xBA, 0xC3, 0xA9, 0x76, 0xB1, 0x46, 0x66, 0x1D, 0xBA, 0xD2,
-    0xFC, 0x70, 0x76, 0x19, 0x2B, 0x24, 0x9E, 0x96, 0xDD, 0x21, 0x99, 0xE9, 0x51, 0x1A, 0x49, 0x69,
-    0x50, 0x0A, 0x7D, 0x85, 0x42, 0x1F, 0x23, 0xC1, 0x23, 0x14, 0x30, 0x79, 0x9A, 0x5D, 0x91, 0x16,
-    0x82, 0x6C, 0x9A, 0x4F, 0x33, 0x82, 0x07, 0x08, 0x23, 0x95, 0xF8, 0x9C, 0x47, 0x0F, 0xC9, 0x85,
-    0x59, 0x50, 0x8E, 0xFB, 0xC9, 0xB5, 0x71, 0x5F, 0x54, 0xAB, 0x33, 0x02, 0x89, 0xF6, 0x28, 0x43,
-    0x51, 0x0D, 0x18, 0xE4, 0x76, 0x69, 0x3D, 0x81, 0xC0, 0x54, 0x54, 0x22, 0xB7, 0x73, 0x5F, 0x0E,
-    0x70, 0x8C, 0x14, 0xA2, 0xF2, 0x0B, 0x44, 0xE1, 0xE4, 0x71, 0x12, 0x98, 0x85, 0x30, 0x8B, 0x10,
-    0xFD, 0x11, 0xAE, 0xEE, 0xD6, 0xC1, 0x6C, 0x8D, 0xB6, 0x46, 0x3A, 0x17, 0xA9, 0x5A, 0x5A, 0xA6,
-    0x74, 0x0C, 0x27, 0x54, 0x6E, 0xAF, 0x2E, 0xF7, 0x49, 0x5D, 0xEE, 0x2E, 0x2C, 0xC2, 0x96, 0xC9,
-    0xFC, 0xA7, 0x54, 0xCE, 0x82, 0x00, 0xC7, 0x98, 0xB3, 0xF2, 0xC1, 0x1D, 0x15, 0x98, 0xD8, 0x3D,
-    0x61, 0x88, 0xD0, 0x8F, 0xC0, 0x17, 0x18, 0x39, 0xB8, 0xAB, 0x92, 0x96, 0x1A, 0x42, 0xD2, 0x05,
-    0xA7, 0x72, 0xA9, 0xAA, 0x87, 0xD8, 0x4C, 0x4F, 0xB0, 0x5D, 0x97, 0x5A, 0x52, 0x42, 0xB3, 0xA9,
-    0x51, 0x04, 0xDC, 0x26, 0xBB, 0x46, 0x4D, 0xE9, 0xE6, 0xE7, 0xC0, 0x30, 0xA4, 0x9B, 0xE7, 0xEE,
-    0xCE, 0x0E, 0x52, 0x63, 0xE2, 0x1D, 0xFA, 0x67, 0x43, 0x54, 0x50, 0xF8, 0xE6, 0x13, 0x0C, 0xD2,
-    0x0A, 0x7B, 0xB4, 0x0F, 0x7E, 0x49, 0x32, 0xA9, 0x59, 0xCC, 0xE7, 0xDF, 0xD2, 0xC3, 0xCE, 0x0E,
-    0x59, 0x31, 0x8B, 0x7B, 0xF3, 0xF9, 0xFC, 0x9B, 0xBA, 0x6C, 0x97, 0x81, 0x27, 0x70, 0x0B, 0x42,
-    0x4F, 0x3D, 0xE1, 0xF1, 0x29, 0xCC, 0x60, 0xF1, 0xE4, 0xB2, 0x73, 0x8F, 0x9F, 0x22, 0x9E, 0xC6,
-    0x3C, 0x69, 0x46, 0x58, 0xC6, 0xFB, 0x50, 0x67, 0x1F, 0x37, 0x79, 0xAA, 0x21, 0x9E, 0xB0, 0x26,
-    0x4B, 0xB4, 0x54, 0x0D, 0xBA, 0x57, 0xD4, 0x27, 0xE7, 0xEA, 0xF9, 0xB9, 0x3A, 0x3B, 0xE8, 0x9D,
-    0xAB, 0x9F, 0x7B, 0xC7, 0x12, 0xA1, 0xC7, 0x95, 0xAD, 0xD8, 0x89, 0x03, 0x72, 0x7B, 0x03, 0xAB,
-    0xDB, 0x58, 0x23, 0x94, 0x4F, 0x4D, 0x75, 0x6F, 0xFE, 0xCD, 0xEA, 0x7C, 0x2E, 0xD7, 0xE6, 0xDF,
-    0xC9, 0xAB, 0x68, 0xE1, 0x26, 0xA1, 0x65, 0x30, 0x3F, 0xC4, 0xC6, 0xFC, 0xDB, 0xBA, 0xC7, 0x7E,
-    0xCD, 0xDE, 0xFE, 0xF1, 0xD1, 0x68, 0x34, 0xA2, 0xFA, 0xAC, 0x5C, 0xF7, 0x73, 0xAA, 0xB7, 0xDA,
-    0x52, 0xA7, 0xB0, 0xA3, 0x30, 0x36, 0x29, 0x1E, 0xBE, 0x8E, 0x9A, 0xE4, 0x49, 0x4E, 0x24, 0xFF,
-    0xB3, 0x2E, 0x27, 0x92, 0x6E, 0xD9, 0x95, 0x22, 0xF3, 0x74, 0xAB, 0x20, 0xA1, 0x25, 0xEA, 0x01,
-    0x8B, 0x7A, 0xA0, 0x82, 0x97, 0x13, 0x54, 0x6A, 0xE0, 0xFC, 0x2F, 0xCD, 0xBA, 0x7E, 0x49, 0x6C,
-    0x12, 0x0B, 0xB5, 0x1E, 0xBB, 0xF2, 0x21, 0x1B, 0xBB, 0xC0, 0xC1, 0x28, 0x88, 0xE0, 0x50, 0xA6,
-    0x82, 0x78, 0x26, 0x12, 0x71, 0x7F, 0xBB, 0x57, 0x77, 0xD1, 0xF2, 0x30, 0xC8, 0x44, 0x26, 0x94,
-    0x28, 0x28, 0x3E, 0xF2, 0xE7, 0x1B, 0x43, 0xE8, 0xF6, 0x40, 0x5B, 0xC4, 0x9B, 0x84, 0x75, 0x5A,
-    0xE7, 0x54, 0xE4, 0xFC, 0xB4, 0xC0, 0x72, 0xFA, 0x5F, 0x8C, 0x9E, 0x27, 0x7D, 0xA2, 0x10, 0x0F,
-    0x91, 0x8F, 0x70, 0x13, 0x53, 0x9D, 0xE6, 0xAD, 0x8C, 0x2E, 0xD5, 0xD4, 0x2C, 0x83, 0x63, 0x9E,
-    0xC6, 0xBE, 0xF9, 0x4D, 0x0E, 0xD2, 0x05, 0xF6, 0xA6, 0x65, 0x93, 0xEF, 0x1A, 0x75, 0x54, 0x0B,
-    0x4F, 0x35, 0xF7, 0xAA, 0x84, 0xF5, 0xB5, 0x13, 0x33, 0xE2, 0x08, 0xE3, 0x08, 0xD7, 0x0B, 0xEC,
-    0xB2, 0xCC, 0x80, 0x93, 0x40, 0x37, 0x71, 0x51, 0xD3, 0x22, 0x54, 0xAA, 0xD2, 0x21, 0x64, 0xDE,
-    0x6D, 0xE4, 0xFC, 0x0A, 0x6D, 0x6B, 0x06, 0x7B, 0xB6, 0x4C, 0x04, 0xD7, 0x23, 0x50, 0x56, 0x18,
-    0x93, 0x8F, 0x5D, 0x37, 0x83, 0x65, 0x61, 0xED, 0x4E, 0x43, 0x02, 0x58, 0x59, 0x69, 0x74, 0x5D,
-    0x66, 0xF1, 0x9A, 0x02, 0x23, 0x62, 0x15, 0xDA, 0x6F, 0xD6, 0xCC, 0x23, 0xFE, 0x48, 0xF3, 0x32,
-    0xCD, 0xBB, 0x78, 0xB6, 0x85, 0x19, 0x56, 0xE4, 0x6B, 0xF4, 0xEE, 0x12, 0xD5, 0x13, 0x1C, 0xCA,
-    0x10, 0xBB, 0x34, 0x1F, 0xCC, 0x4E, 0x25, 0x09, 0x6D, 0x5B, 0xD9, 0x88, 0xF6, 0xDF, 0xCE, 0x46,
-    0xFC, 0x35, 0x63, 0x99, 0x03, 0x50, 0x4B, 0xDA, 0xAC, 0x25, 0x5F, 0x07, 0xAE, 0x5B, 0xCF, 0x6E,
-    0x21, 0x6E, 0x6C, 0x36, 0x5A, 0x9F, 0xC5, 0x1B, 0xF1, 0x06, 0x79, 0x9C, 0x52, 0xAE, 0x25, 0x01,
-    0x33, 0x88, 0x9D, 0x5C, 0x48, 0x6E, 0x09, 0xA2, 0x73, 0x39, 0x26, 0xFA, 0x48, 0x28, 0xAE, 0x95,
-    0x73, 0x4E, 0xCD, 0x82, 0x77, 0x99, 0x53, 0x19, 0x83, 0x55, 0x3D, 0x76, 0xD1, 0x96, 0x9F, 0xE6,
-    0x81, 0xF2, 0xE3, 0xFD, 0xFC, 0xFA, 0x0C, 0xD7, 0x2F, 0xE8, 0x54, 0xA6, 0x72, 0x3D, 0xC7, 0x68,
-    0x46, 0x3D, 0xE3, 0x6B, 0x57, 0xEF, 0xCB, 0x03, 0x0A, 0x75, 0x76, 0x0C, 0xED, 0x3F, 0x2F, 0xDC,
-    0x3F, 0xCA, 0x7D, 0xE7, 0xFE, 0x81, 0xB7, 0x76, 0x11, 0x5E, 0xDC, 0x52, 0x2D, 0xE5, 0x28, 0x41,
-    0xE5, 0x24, 0x58, 0xD4, 0xDC, 0x74, 0x85, 0xC2, 0xEF, 0x66, 0xD1, 0x2F, 0xEE, 0xC9, 0x34, 0x7F,
-    0x7D, 0xE2, 0xBC, 0x43, 0xE9, 0xF9, 0x22, 0x1B, 0x2C, 0x92, 0xBD, 0xED, 0xED, 0xBD, 0x5B, 0xDB,
-    0xD1, 0x71, 0xE2, 0xFD, 0x9A, 0x5F, 0x25, 0x08, 0x08, 0xBD, 0x91, 0x23, 0x43, 0xDC, 0xA4, 0xB0,
-    0xEE, 0xA7, 0x3C, 0xAA, 0x7B, 0x89, 0x58, 0xD8, 0x3A, 0x41, 0xCB, 0xD4, 0xC8, 0x78, 0x60, 0xFE,
-    0x39, 0x6B, 0x95, 0xBA, 0x74, 0x07, 0x93, 0xBA, 0xE9, 0x98, 0x01, 0x1F, 0xC0, 0x7D, 0xB9, 0xF3,
-    0x51, 0x49, 0xB8, 0x25, 0x3C, 0x13, 0xDA, 0xE6, 0xB3, 0x9A, 0x3F, 0x8C, 0xE6, 0xD6, 0xD7, 0x4C,
-    0x02, 0x74, 0x3A, 0x1A, 0x53, 0x88, 0xB3, 0xE5, 0xF0, 0xAC, 0xE5, 0xCD, 0x5F, 0x8C, 0x13, 0xD7,
-    0x90, 0x6D, 0x1F, 0xC1, 0x97, 0xD4, 0x0B, 0x27, 0xD4, 0xB4, 0x56, 0x6A, 0x0A, 0x66, 0x2E, 0xEB,
-    0x1E, 0x23, 0xF0, 0x83, 0x05, 0x99, 0xC3, 0x3A, 0xE9, 0xD2, 0xCA, 0xBC, 0x9C, 0x1B, 0x0D, 0xE7,
-    0x05, 0xE5, 0xB4, 0x6A, 0x58, 0x60, 0xD0, 0x00, 0x67, 0xB9, 0x36, 0x28, 0xD9, 0xBA, 0xAA, 0xFD,
-    0xF0, 0xC4, 0xA4, 0x61, 0x9F, 0xBA, 0x92, 0xBD, 0xC9, 0x76, 0x98, 0x8C, 0x75, 0xF2, 0x77, 0xF1,
-    0x90, 0xFB, 0x65, 0xE8, 0x4C, 0xAE, 0xDD, 0x8C, 0x12, 0x3A, 0x29, 0x97, 0x3C, 0x06, 0x7E, 0xEF,
-    0x62, 0x27, 0x0A, 0xC3, 0x71, 0xB2, 0x4F, 0xC4, 0xDA, 0x9B, 0x84, 0x7D, 0x62, 0xF1, 0x30, 0x49,
-    0x02, 0x32, 0xD1, 0x59, 0x42, 0x44, 0x67, 0x41, 0xC8, 0x63, 0x3C, 0xC6, 0x0F, 0x25, 0x1E, 0x0E,
-    0x6A, 0x9B, 0x43, 0xF7, 0xFE, 0xB5, 0x15, 0x3E, 0x58, 0x4E, 0x4D, 0x08, 0xF4, 0xAC, 0x8F, 0x5F,
-    0x75, 0x43, 0xE0, 0xA7, 0x3E, 0x70, 0xDF, 0x87, 0x77, 0x08, 0xEF, 0x3D, 0xD0, 0x69, 0xDC, 0xEF,
-    0xF1, 0x51, 0x1C, 0xFA, 0x9C, 0xEF, 0x4E, 0xA7, 0x83, 0xC1, 0xF1, 0x11, 0xA2, 0x88, 0x8D, 0xB3,
-    0x75, 0x3A, 0x66, 0x92, 0xC7, 0xD0, 0x8F, 0xF6, 0xD1, 0xED, 0xF8, 0xDF, 0x7B, 0x2B, 0xA7, 0xA7,
-    0x10, 0x85, 0xEF, 0xCA, 0x60, 0x78, 0xB6, 0xE2, 0xA4, 0x77, 0x96, 0xC2, 0x9B, 0xFD, 0x4B, 0xD7,
-    0xDE, 0xE8, 0x6D, 0x79, 0x33, 0x26, 0xB5, 0x65, 0x4B, 0x3A, 0x3F, 0xC3, 0xFE, 0x93, 0x1B, 0xD0,
-    0x2E, 0x70, 0x71, 0x82, 0x1B, 0x03, 0xFC, 0x0B, 0xDD, 0x7D, 0x4F, 0xB0, 0xDE, 0xD6, 0x75, 0xDF,
-    0x05, 0x20, 0x3E, 0xD4, 0xFC, 0xA6, 0x02, 0x17, 0x8C, 0xE3, 0x8A, 0x35, 0xD1, 0x85, 0x27, 0x93,
-    0xA1, 0x24, 0x22, 0x0B, 0x2F, 0xDC, 0xF4, 0x3D, 0x02, 0x92, 0xD2, 0x68, 0xE1, 0x85, 0x39, 0x19,
-    0xB3, 0x9A, 0x89, 0x67, 0x6A, 0x6F, 0x32, 0xD3, 0x3A, 0xD3, 0xBC, 0x2C, 0xB2, 0x50, 0x13, 0x4A,
-    0x80, 0xEC, 0x4C, 0xB3, 0xF0, 0x42, 0x5C, 0xB4, 0x2B, 0x2F, 0xC2, 0x85, 0x3A, 0x43, 0x3D, 0x4F,
-    0x43, 0x4F, 0x47, 0x99, 0xB2, 0x53, 0x4A, 0x80, 0xA4, 0x99, 0x78, 0xA1, 0x69, 0x05, 0x5B, 0x71,
-    0xB3, 0xF0, 0x42, 0x88, 0xCC, 0xD8, 0x89, 0x39, 0x1D, 0x41, 0x31, 0x68, 0x81, 0x4F, 0x00, 0x6E,
-    0xCF, 0xEF, 0x77, 0x2E, 0xF0, 0xBE, 0x8F, 0xA4, 0x64, 0xFD, 0x21, 0x2D, 0x26, 0x4F, 0x7A, 0x17,
-    0x1F, 0xDF, 0x7B, 0x1F, 0x70, 0xEF, 0xB9, 0xE7, 0x9E, 0xF3, 0x3B, 0x7F, 0x3F, 0x63, 0x7E, 0x29,
-    0x33, 0xF2, 0x95, 0x34, 0x18, 0x57, 0x2D, 0x46, 0xBF, 0xC7, 0x68, 0xCE, 0x72, 0xBC, 0xC7, 0xCC,
-    0x5F, 0xB9, 0xB5, 0x36, 0x33, 0x25, 0xC7, 0xD5, 0x68, 0x12, 0xF9, 0xF3, 0xC1, 0xC4, 0xF3, 0x18,
-    0xF5, 0xE6, 0x13, 0x32, 0x76, 0xF8, 0xCB, 0x98, 0x63, 0xC2, 0x9B, 0xA5, 0xD6, 0x16, 0x1C, 0xE5,
-    0x31, 0x69, 0xCD, 0xFB, 0x54, 0x18, 0x4B, 0x8E, 0x56, 0xC7, 0xC2, 0x1C, 0x31, 0x9E, 0xFC, 0x45,
-    0x2B, 0xA3, 0xF1, 0x5A, 0x13, 0x58, 0x13, 0x36, 0x66, 0x57, 0x1E, 0x55, 0x1B, 0x19, 0xF8, 0x57,
-    0x27, 0x3D, 0x4C, 0xB1, 0x7C, 0xB4, 0x5F, 0xC6, 0x27, 0x83, 0xD6, 0x6C, 0x7C, 0x7D, 0xAC, 0x33,
-    0x5C, 0xE1, 0x92, 0x45, 0x18, 0x4D, 0x5C, 0xD8, 0x2A, 0x37, 0x27, 0xE5, 0x6D, 0xB1, 0xD9, 0x31,
-    0x36, 0x3B, 0x6E, 0xB6, 0xE5, 0x6D, 0x9F, 0x16, 0xD2, 0x5A, 0xDC, 0x2D, 0xD0, 0x71, 0xFA, 0xE4,
-    0x69, 0x63, 0x42, 0x6B, 0x47, 0x8E, 0xF2, 0x08, 0x99, 0xA7, 0xDC, 0x48, 0xE6, 0x99, 0x37, 0x18,
-    0xD3, 0x06, 0xF3, 0x94, 0x51, 0xE6, 0xA9, 0x63, 0x5E, 0xE3, 0x85, 0xFC, 0x4D, 0xDE, 0xC8, 0x9D,
-    0x0E, 0xDB, 0xFD, 0x44, 0x56, 0x66, 0xA7, 0xF4, 0x1C, 0xEE, 0xE7, 0x7D, 0x11, 0x63, 0xC4, 0xCD,
-    0x4B, 0xB8, 0x8E, 0x92, 0x3F, 0xE6, 0x0F, 0xBC, 0x6C, 0x83, 0x4A, 0x86, 0x54, 0x92, 0xE7, 0x8E,
-    0x26, 0x97, 0x71, 0x30, 0xC7, 0x49, 0xA5, 0x93, 0x7C, 0xFF, 0xA7, 0xE7, 0xBB, 0x6C, 0x50, 0x49,
-    0x47, 0xB2, 0xC9, 0x7B, 0x50, 0x09, 0x23, 0x1E, 0xE5, 0xAD, 0x2D, 0x74, 0xD7, 0xFE, 0x2D, 0x7E,
-    0x6C, 0x87, 0x83, 0x9D, 0xDA, 0x95, 0x3F, 0x95, 0x35, 0x77, 0x72, 0x73, 0x79, 0x6C, 0x59, 0x04,
-    0x83, 0xAC, 0x27, 0xE8, 0x83, 0xD1, 0xF8, 0xE7, 0xA2, 0x61, 0x7E, 0x34, 0x9F, 0x9C, 0xEE, 0xEF,
-    0x65, 0xBA, 0x3B, 0xF9, 0xDF, 0x9C, 0x31, 0x20, 0xC1, 0xC6, 0xD0, 0xE8, 0xDC, 0x3C, 0x93, 0xF4,
-    0x66, 0x65, 0x22, 0x9B, 0x3D, 0x29, 0x4F, 0xC5, 0xA3, 0x72, 0x8B, 0xDF, 0x9F, 0x9E, 0x9F, 0xE8,
-    0x95, 0x93, 0xC1, 0x1E, 0x55, 0x26, 0xAD, 0x64, 0x15, 0x79, 0x16, 0x09, 0x21, 0x4D, 0x24, 0xBB,
-    0x07, 0xAE, 0xE0, 0xCC, 0x2D, 0x19, 0x6C, 0x24, 0x4B, 0xC8, 0xBF, 0x23, 0xDB, 0x62, 0xC3, 0x30,
-    0x9B, 0x7C, 0xC2, 0xE1, 0xC0, 0x62, 0x7C, 0x6C, 0xAE, 0xBC, 0x27, 0xAD, 0x74, 0x10, 0x2E, 0x6B,
-    0x83, 0x41, 0xFE, 0xF6, 0x22, 0x38, 0x03, 0x4B, 0x27, 0xA5, 0x73, 0x59, 0x5A, 0x29, 0xF7, 0x0B,
-    0x27, 0xD2, 0x95, 0xDF, 0xA0, 0x29, 0xB8, 0x0F, 0x4B, 0xC3, 0xCA, 0x40, 0x51, 0xD0, 0x13, 0xD4,
-    0x04, 0x2D, 0x41, 0x49, 0xD0, 0x51, 0x9E, 0x0D, 0x4E, 0x03, 0x05, 0x41, 0xBF, 0x5D, 0xB9, 0x8D,
-    0xC5, 0x54, 0x56, 0xC5, 0x73, 0x26, 0xFE, 0x9E, 0x6C, 0xF8, 0x4B, 0xF2, 0xBC, 0xA7, 0xBA, 0xB5,
-    0xFD, 0xBC, 0xFD, 0xCF, 0xF2, 0xC0, 0xD7, 0x3E, 0x0F, 0x46, 0x0C, 0x56, 0x88, 0xDB, 0x65, 0x3B,
-    0x9A, 0x79, 0x20, 0xFD, 0xB9, 0xFD, 0xDC, 0x7D, 0x25, 0x21, 0x08, 0x80, 0x81, 0x8C, 0xCE, 0xED,
-    0x0F, 0x40, 0xBB, 0x00, 0x54, 0x0D, 0x41, 0x4A, 0xCC, 0xCE, 0x70, 0x8B, 0xC9, 0x63, 0x6B, 0xFB,
-    0xDC, 0x38, 0x9E, 0xF2, 0x70, 0x27, 0x52, 0x9C, 0x9B, 0x6B, 0x66, 0x09, 0xE0, 0x95, 0x3C, 0x24,
-    0xF2, 0xC6, 0x2C, 0xE1, 0xEA, 0x23, 0xC7, 0x94, 0xB1, 0x63, 0xCB, 0x93, 0x8E, 0x31, 0x77, 0x1C,
-    0x6B, 0x6E, 0x3B, 0xE6, 0x3C, 0x2B, 0x77, 0xC0, 0x09, 0xB9, 0x64, 0x78, 0xD6, 0x4C, 0xEB, 0xD9,
-    0x47, 0x65, 0x66, 0x9E, 0x5C, 0x31, 0x75, 0x1F, 0x67, 0x49, 0xFE, 0x32, 0xA8, 0x65, 0xAA, 0x72,
-    0x5D, 0x55, 0x7A, 0x8D, 0x0A, 0x39, 0x1D, 0xE0, 0x17, 0x9E, 0xCB, 0xE2, 0x57, 0xAC, 0x5C, 0x65,
-    0x45, 0xE9, 0x28, 0x33, 0x8F, 0x47, 0x93, 0xF6, 0x98, 0x50, 0x2B, 0x92, 0x53, 0xF8, 0x4D, 0x66,
-    0xEB, 0xAD, 0xED, 0x07, 0x69, 0x28, 0x7B, 0x82, 0x6D, 0xC1, 0xBE, 0x44, 0x6E, 0xE5, 0x5C, 0x32,
-    0xAE, 0x9D, 0xAE, 0x9F, 0x64, 0x8D, 0x3A, 0x25, 0x00, 0xCE, 0x3A, 0xC9, 0x7C, 0xED, 0x4C, 0x7E,
-    0x4D, 0xE5, 0x92, 0xB5, 0x3D, 0x0F, 0x80, 0xBD, 0x2A, 0x34, 0x95, 0xC5, 0x95, 0x95, 0xCC, 0x4B,
-    0x16, 0x67, 0x0B, 0x59, 0x71, 0xC9, 0x6B, 0x2B, 0x53, 0x14, 0x8A, 0xE3, 0x5A, 0xC8, 0x3A, 0xD2,
-    0x46, 0xFE, 0x21, 0xD7, 0xBC, 0x96, 0xC5, 0xC9, 0x3A, 0x6C, 0x05, 0x49, 0x35, 0x86, 0x16, 0x7B,
-    0x7B, 0x11, 0xF7, 0xB3, 0xF6, 0x2D, 0x99, 0x6F, 0xF6, 0x11, 0xE4, 0xD5, 0x74, 0xB3, 0xBC, 0xAA,
-    0xDD, 0x28, 0x6B, 0x90, 0xE9, 0xC9, 0x72, 0x4A, 0x8E, 0xA0, 0x5E, 0x03, 0xCE, 0xC8, 0x31, 0x8A,
-    0xBC, 0xF2, 0xEC, 0x15, 0x91, 0x57, 0xBE, 0xA5, 0x78, 0x39, 0x63, 0xCC, 0xFC, 0x84, 0x90, 0x3F,
-    0x88, 0xB8, 0x7D, 0x29, 0xA9, 0x78, 0x74, 0x9D, 0xBF, 0xE5, 0xEC, 0x82, 0x9A, 0x23, 0x68, 0x29,
-    0xA2, 0x4D, 0x9E, 0x9B, 0x92, 0x8E, 0xE4, 0xF4, 0xA0, 0x01, 0x0D, 0x23, 0xB0, 0x6A, 0x77, 0x8A,
-    0xDC, 0x34, 0x90, 0x7A, 0x3A, 0x82, 0x8F, 0xD2, 0xD7, 0xF0, 0x90, 0xFC, 0x25, 0x30, 0x66, 0x59,
-    0x91, 0xEF, 0xAB, 0xB2, 0x06, 0xCB, 0xE6, 0x38, 0xB5, 0x20, 0x9E, 0x2C, 0x57, 0x18, 0x5D, 0x16,
-    0x1A, 0x8D, 0xA0, 0x54, 0x68, 0x0B, 0xEC, 0x21, 0xF8, 0x47, 0xC5, 0xAA, 0x13, 0x68, 0x4E, 0xA6,
-    0xCA, 0x43, 0x28, 0xEA, 0x4C, 0x58, 0xEB, 0x3F, 0xB3, 0x75, 0x25, 0xD4, 0xA5, 0xB2, 0x3E, 0x99,
-    0x6F, 0x22, 0x07, 0x53, 0x26, 0x0C, 0xEA, 0xC9, 0x5C, 0x03, 0x3D, 0x9E, 0xC2, 0x53, 0xDC, 0xF9,
-    0x81, 0x1B, 0x9F, 0x0F, 0x98, 0xB5, 0x07, 0x7A, 0x88, 0x24, 0x7C, 0xBD, 0xC3, 0x49, 0x4D, 0x62,
-    0x1E, 0xD6, 0x81, 0xE7, 0xF6, 0xB5, 0x16, 0x3C, 0x91, 0xBF, 0x8E, 0x0D, 0x37, 0x42, 0x06, 0x70,
-    0xB8, 0xFC, 0x35, 0x18, 0xDC, 0x82, 0x1F, 0x78, 0xDA, 0x6C, 0xC5, 0xE9, 0x09, 0x9D, 0xE5, 0x59,
-    0xF8, 0x81, 0xAC, 0xE0, 0x7E, 0x7B, 0x05, 0x47, 0x39, 0x57, 0x52, 0x73, 0x05, 0xAD, 0xF9, 0xB6,
-    0xEC, 0x62, 0xE7, 0xD7, 0xD8, 0xCB, 0x5D, 0x9E, 0x54, 0xFE, 0xF2, 0x50, 0x76, 0x30, 0x77, 0x99,
-    0x74, 0x25, 0x92, 0x33, 0xB1, 0x45, 0x24, 0x33, 0xEF, 0x31, 0x5D, 0xD1, 0xB2, 0x32, 0xF7, 0xB0,
-    0x22, 0x75, 0x20, 0x2B, 0xB2, 0x84, 0xC7, 0xFD, 0x2C, 0x4F, 0x3E, 0xEE, 0x90, 0x7F, 0x8F, 0x07,
-    0xF8, 0x87, 0xD5, 0x2C, 0x3A, 0x45, 0x29, 0x99, 0xF9, 0x98, 0x3B, 0x5D, 0x12, 0xB6, 0x0B, 0xBD,
-    0x8E, 0xEE, 0x16, 0xFC, 0x43, 0x6E, 0x36, 0xFF, 0x84, 0xE7, 0x60, 0x3E, 0x41, 0xD8, 0x6F, 0xD0,
-    0x5E, 0x8F, 0x8F, 0x10, 0x70, 0x35, 0x52, 0x76, 0x38, 0xD9, 0x46, 0xD1, 0xD6, 0xCF, 0x12, 0x2E,
-    0x56, 0x21, 0x07, 0x5A, 0xC9, 0xB7, 0x13, 0x75, 0x94, 0x74, 0x0D, 0x69, 0x25, 0xDF, 0xA0, 0x95,
-    0x7C, 0x97, 0x2A, 0xF6, 0x74, 0xF7, 0x29, 0xAD, 0xE4, 0x9B, 0xB2, 0x2F, 0x03, 0xF1, 0xE4, 0xDB,
-    0x57, 0x29, 0xA8, 0x82, 0x50, 0xBE, 0x1A, 0x4A, 0x1E, 0x1C, 0x65, 0x53, 0xEA, 0x3E, 0xA7, 0x4A,
-    0x29, 0xE5, 0x50, 0x39, 0x29, 0x46, 0xC5, 0xCC, 0x06, 0xC3, 0xC6, 0xCD, 0x81, 0xBA, 0x2C, 0x5B,
-    0x72, 0x0E, 0xC6, 0x00, 0x9B, 0x6B, 0xC2, 0x57, 0x79, 0xF2, 0x49, 0x92, 0x93, 0x2B, 0x8C, 0xDB,
-    0x14, 0x88, 0x97, 0x20, 0x1B, 0xBD, 0x16, 0xA3, 0x88, 0x21, 0xAC, 0xF7, 0x27, 0xDF, 0x02, 0xA3,
-    0xF0, 0xB0, 0x25, 0x67, 0x1E, 0x9B, 0xF0, 0x18, 0x4C, 0xAC, 0xC7, 0x2C, 0x65, 0x27, 0xA1, 0x2E,
-    0x31, 0x66, 0xBB, 0x93, 0xB9, 0x1F, 0x94, 0x12, 0x7A, 0xB6, 0x50, 0xED, 0x38, 0x29, 0x32, 0xC8,
-    0xBE, 0x3D, 0x09, 0x6A, 0xED, 0x60, 0xD8, 0x06, 0xB5, 0xB6, 0x55, 0xEA, 0xA8, 0xC0, 0x55, 0xF9,
-    0x32, 0x42, 0xB8, 0xE0, 0x8C, 0xD6, 0xD0, 0x88, 0x15, 0x8F, 0xAD, 0xFC, 0xDE, 0x72, 0x28, 0x92,
-    0x96, 0x47, 0x43, 0x08, 0x53, 0xD6, 0x81, 0xF5, 0x6D, 0xB1, 0x0B, 0xF1, 0x69, 0x29, 0x4B, 0x73,
-    0x48, 0x90, 0x12, 0x0A, 0x3C, 0x1C, 0x45, 0x16, 0x52, 0x30, 0x72, 0x90, 0xE3, 0x28, 0x43, 0x27,
-    0x0C, 0x13, 0x77, 0xF2, 0xE4, 0xA4, 0x05, 0x76, 0x81, 0x5E, 0xD4, 0xA1, 0x96, 0x03, 0x97, 0x57,
-    0x32, 0x9B, 0xB2, 0x8A, 0x20, 0x3C, 0x30, 0x14, 0xD1, 0x20, 0x0F, 0x8A, 0x7B, 0x79, 0x50, 0xDA,
-    0x05, 0xD6, 0xB3, 0x0D, 0xA8, 0x2F, 0xE7, 0x4F, 0x38, 0xF8, 0xE3, 0x06, 0x2B, 0x90, 0xC1, 0xF2,
-    0x2A, 0x51, 0x49, 0x1C, 0x88, 0xA6, 0x90, 0xBF, 0x0F, 0x2A, 0x55, 0x6C, 0x15, 0x55, 0xDB, 0x0A,
-    0x6A, 0x02, 0x4A, 0x89, 0xEA, 0x2D, 0x52, 0x05, 0x17, 0xEB, 0xA4, 0x1E, 0x54, 0x9A, 0x6F, 0xEB,
-    0xE4, 0xCE, 0xEA, 0xEC, 0x54, 0xCC, 0x7B, 0xCA, 0xA6, 0x81, 0xB2, 0x69, 0x48, 0xB1, 0x2E, 0x2A,
-    0x87, 0x53, 0x4C, 0x74, 0x8E, 0x4F, 0x70, 0x92, 0x94, 0xD0, 0x80, 0x79, 0xBC, 0x00, 0xD8, 0xF9,
-    0x03, 0xFE, 0x02, 0xBC, 0x40, 0x0E, 0xEC, 0x94, 0x03, 0x5B, 0xF3, 0xB8, 0x5E, 0xBE, 0x82, 0xCB,
-    0xB9, 0x8F, 0x1B, 0xAF, 0xA7, 0xF6, 0x4F, 0xAC, 0xFC, 0x8F, 0xDD, 0xFF, 0x4D, 0x3B, 0x3D, 0x2A,
-    0x87, 0x49, 0xA4, 0x89, 0x2C, 0x7C, 0xE2, 0xC4, 0xF3, 0xDA, 0x57, 0x8A, 0xE4, 0x15, 0x45, 0xC2,
-    0x49, 0x70, 0x5E, 0x46, 0x32, 0xDA, 0xE2, 0x09, 0x4A, 0x8A, 0xCA, 0x3E, 0xC4, 0x09, 0xAD, 0xBE,
-    0x6B, 0x3F, 0xCF, 0x79, 0xC4, 0x3C, 0x92, 0x6E, 0x53, 0xF8, 0x2B, 0xFB, 0xF2, 0xC4, 0xA9, 0x07,
-    0xF6, 0x91, 0x51, 0x55, 0xEB, 0x14, 0x0E, 0x4A, 0xFF, 0x7E, 0x35, 0x70, 0x5B, 0xD2, 0x36, 0x1A,
-    0xB8, 0x5B, 0xC2, 0x6B, 0x3D, 0x0E, 0xB8, 0xEC, 0x20, 0x04, 0xAE, 0x28, 0x2F, 0x51, 0x25, 0x1D,
-    0xB1, 0xB4, 0xFC, 0x7C, 0xCA, 0x72, 0xE1, 0xC9, 0x5A, 0x74, 0x62, 0x76, 0x6C, 0x16, 0x98, 0x3E,
-    0xCE, 0x47, 0x82, 0xC5, 0x94, 0x15, 0xD4, 0x2B, 0xFE, 0x1C, 0x6C, 0x2D, 0xBB, 0xBA, 0x86, 0x5A,
-    0x6A, 0x65, 0x22, 0x8A, 0x52, 0xDF, 0xE2, 0xE7, 0x5B, 0x76, 0x61, 0x2F, 0x92, 0x2E, 0xAF, 0xB7,
-    0x30, 0x24, 0x19, 0xEE, 0x53, 0x40, 0x67, 0xCB, 0x71, 0x32, 0xF1, 0x54, 0x0E, 0xF2, 0xA7, 0x38,
-    0x4C, 0x87, 0xB2, 0xBB, 0x59, 0x6D, 0x08, 0xAB, 0x76, 0x50, 0x1C, 0xB2, 0x7F, 0xD0, 0x1C, 0x4E,
-    0x75, 0xC8, 0xDB, 0x46, 0xB3, 0xA9, 0x3C, 0xEE, 0xCA, 0x35, 0x7C, 0xCC, 0xE0, 0x41, 0xD5, 0x08,
-    0x91, 0xEB, 0x39, 0x30, 0x37, 0xC1, 0x74, 0xA4, 0xFC, 0x13, 0x2B, 0x07, 0x9D, 0x54, 0x69, 0xB5,
-    0xA3, 0xE2, 0x6A, 0x5B, 0x39, 0xEA, 0xAC, 0xB2, 0xCE, 0x25, 0x3D, 0x76, 0x04, 0x52, 0x38, 0x67,
-    0x60, 0x2A, 0xBF, 0xA1, 0xD0, 0x0A, 0x6A, 0x4A, 0xAD, 0x55, 0x45, 0x00, 0x15, 0x15, 0x94, 0x45,
-    0x29, 0x49, 0xFD, 0x2B, 0x96, 0xA4, 0x4E, 0x47, 0xCA, 0xA2, 0x14, 0x1B, 0x72, 0x4E, 0x60, 0xAA,
-    0x8F, 0xD3, 0xE9, 0x2D, 0x5B, 0x05, 0x8B, 0x55, 0x4C, 0x2F, 0xF9, 0x59, 0x24, 0x84, 0x0A, 0xE5,
-    0x9A, 0x40, 0xC6, 0xCA, 0x74, 0x53, 0x6C, 0x97, 0xA8, 0xAE, 0xB7, 0xB1, 0x5F, 0x79, 0xEB, 0xF1,
-    0x2A, 0x66, 0xCE, 0x2B, 0xD8, 0xB1, 0xA4, 0x0D, 0x9F, 0x96, 0xEB, 0xC9, 0xB8, 0xA3, 0x16, 0xDB,
-    0x89, 0xBB, 0x93, 0x10, 0x22, 0xDB, 0x51, 0xBF, 0x8D, 0xCD, 0x93, 0xEB, 0x73, 0x58, 0xD6, 0xD9,
-    0x68, 0xE0, 0xF6, 0x5D, 0x8A, 0x26, 0x28, 0x17, 0xD3, 0xAD, 0x04, 0x57, 0xC8, 0xCA, 0x5A, 0xB1,
-    0xA2, 0x64, 0x69, 0xA2, 0xEA, 0x88, 0xB1, 0xBD, 0x26, 0x1C, 0xB8, 0x79, 0x4D, 0xD0, 0xE3, 0x50,
-    0xEE, 0x5E, 0x0F, 0xDA, 0x63, 0x22, 0x81, 0xED, 0x14, 0xD4, 0xA9, 0x5A, 0x71, 0x9D, 0xB3, 0x6F,
-    0x72, 0xD9, 0x55, 0x79, 0x93, 0xB3, 0x72, 0x42, 0x05, 0x03, 0xCE, 0xD6, 0x89, 0x94, 0xA5, 0x30,
-    0xA1, 0xB8, 0x9B, 0x8D, 0x1E, 0xF2, 0x92, 0x8A, 0x8A, 0x54, 0x45, 0x47, 0x4A, 0xF3, 0x19, 0xCF,
-    0xC7, 0x54, 0xCA, 0x6A, 0x36, 0x83, 0x4A, 0xB5, 0x84, 0x9C, 0x31, 0xA4, 0xF6, 0x10, 0x5E, 0x2D,
-    0x60, 0x40, 0x34, 0x12, 0x59, 0xAA, 0xB4, 0x07, 0x66, 0xD7, 0xAE, 0x68, 0x40, 0xE0, 0x60, 0x20,
-    0x8F, 0x06, 0xF3, 0x28, 0xB1, 0x07, 0x7C, 0x27, 0xCD, 0x1D, 0x5B, 0xE0, 0x87, 0xA2, 0xDD, 0x7A,
-    0x3C, 0x03, 0x34, 0xB1, 0x15, 0x79, 0xA5, 0xD0, 0x51, 0x20, 0xB1, 0xC8, 0x22, 0x99, 0x48, 0x00,
-    0xB4, 0x8E, 0x8D, 0xCB, 0x95, 0x39, 0x67, 0xDB, 0x5F, 0x97, 0x20, 0x93, 0x85, 0x7E, 0x84, 0x70,
-    0xB9, 0x48, 0xAC, 0x45, 0x53, 0x46, 0xED, 0xDA, 0x5C, 0xE1, 0x49, 0xA9, 0x5C, 0x26, 0x7B, 0xFE,
-    0xFE, 0x91, 0x52, 0x7A, 0xFB, 0x90, 0x92, 0x10, 0xE7, 0x3C, 0x88, 0x43, 0x52, 0xE4, 0x76, 0x3F,
-    0xA3, 0xBE, 0x6E, 0xA1, 0xAF, 0x63, 0x4E, 0x44, 0x8F, 0x3F, 0xFE, 0x58, 0x45, 0x70, 0xD4, 0x61,
-    0x8C, 0x3B, 0xFC, 0x24, 0x01, 0x23, 0x50, 0x4A, 0x63, 0x22, 0xB9, 0xEE, 0x15, 0xA6, 0x61, 0xAF,
-    0xDF, 0x4A, 0x5F, 0x7B, 0x1F, 0xD0, 0xB9, 0x10, 0xFD, 0x3C, 0xE7, 0xC2, 0x81, 0xE5, 0xD9, 0x98,
-    0x0F, 0xE3, 0x5C, 0xD8, 0xB4, 0xA2, 0xCA, 0x3A, 0x57, 0x55, 0x06, 0x2B, 0xAA, 0x10, 0x2B, 0x4A,
-    0xC8, 0xF6, 0xE9, 0x79, 0xD6, 0x9B, 0xB6, 0x94, 0x99, 0xAD, 0x62, 0x35, 0x8B, 0x15, 0x36, 0x6C,
-    0x20, 0x66, 0xA7, 0x9B, 0xDB, 0x1B, 0x60, 0xCD, 0x96, 0xDD, 0x37, 0x44, 0x86, 0x77, 0x0B, 0x5E,
-    0x37, 0xDE, 0x19, 0x5A, 0x72, 0x21, 0xA7, 0x24, 0xC2, 0xEE, 0x9A, 0x4A, 0x98, 0x5A, 0x7F, 0x66,
-    0x29, 0xBD, 0xED, 0x9B, 0x32, 0x31, 0x91, 0x8B, 0x4F, 0x09, 0xB1, 0x04, 0x44, 0x66, 0x42, 0x23,
-    0x02, 0xBE, 0x26, 0x6D, 0x61, 0xB5, 0x8A, 0xAC, 0x90, 0x39, 0xA7, 0x6D, 0xDE, 0x08, 0x4D, 0xE4,
-    0x02, 0x0C, 0x2C, 0xEC, 0x00, 0xE9, 0x50, 0x8A, 0xFC, 0xA0, 0xA1, 0x29, 0xBB, 0x29, 0xE0, 0x32,
-    0x8B, 0x86, 0xA8, 0x8B, 0x71, 0xB3, 0x37, 0x27, 0x9C, 0xC6, 0x9C, 0xC6, 0xEC, 0x0C, 0xF9, 0x4C,
-    0xAE, 0x98, 0x41, 0xA7, 0x72, 0x48, 0x27, 0x16, 0xDB, 0x41, 0xA4, 0x8F, 0x5C, 0xFA, 0x48, 0x16,
-    0xEB, 0xDB, 0x8A, 0x0E, 0x4E, 0xB1, 0x8C, 0xE9, 0xEF, 0xA9, 0x23, 0xAE, 0xAE, 0x3D, 0xC5, 0xE5,
-    0x75, 0x97, 0xF8, 0x8E, 0x89, 0xB7, 0x89, 0x94, 0xF3, 0x42, 0x35, 0xFD, 0x74, 0xE7, 0xC0, 0x05,
-    0x0A, 0x42, 0xF8, 0xBB, 0x9E, 0x96, 0x41, 0x40, 0x59, 0x27, 0xC2, 0x58, 0x0D, 0x78, 0xF5, 0x99,
-    0x5C, 0x26, 0x3D, 0xE5, 0x59, 0x11, 0x30, 0xFC, 0x44, 0x29, 0x9C, 0x5B, 0x03, 0x29, 0x7C, 0x83,
-    0x8D, 0xB3, 0x52, 0x1B, 0x67, 0xF5, 0x31, 0xD8, 0x38, 0xDD, 0x81, 0x8D, 0x33, 0xBB, 0x7F, 0x4D,
-    0xD0, 0x6C, 0x5C, 0xD4, 0xF4, 0x09, 0x2A, 0xDD, 0xEB, 0x42, 0x56, 0xDE, 0x8B, 0x6A, 0x15, 0x0D,
-    0x2F, 0x42, 0x11, 0xC0, 0x8F, 0x7E, 0x06, 0xE1, 0x3B, 0xFC, 0x3F, 0x38, 0xF1, 0xA3, 0x6B, 0x88,
-    0x06, 0x27, 0x95, 0x65, 0xF6, 0x11, 0x8C, 0x01, 0x28, 0x48, 0x99, 0x7B, 0x68, 0xDF, 0x84, 0x56,
-    0x24, 0x5C, 0x34, 0x9F, 0xFC, 0xCF, 0xEF, 0x82, 0xCD, 0xE7, 0x53, 0x83, 0x31, 0x81, 0x2D, 0x60,
-    0x4A, 0xDD, 0xF0, 0x9F, 0x59, 0xFB, 0xAA, 0x5A, 0x05, 0x6F, 0x58, 0xFB, 0x0D, 0x28, 0xE9, 0x05,
-    0xCB, 0x19, 0xDA, 0x1C, 0x7C, 0xBF, 0x8A, 0x52, 0xBC, 0x9B, 0xE2, 0x94, 0x77, 0x03, 0xEC, 0xA8,
-    0x79, 0x0E, 0x65, 0x46, 0xA5, 0xC2, 0x78, 0xBA, 0x29, 0x54, 0x7B, 0xE2, 0x8D, 0x3C, 0x93, 0x7C,
-    0x23, 0xCF, 0x65, 0x0A, 0x35, 0xCB, 0xB3, 0x99, 0x43, 0xD3, 0xF2, 0x84, 0xF0, 0x8D, 0x91, 0xE3,
-    0xA1, 0x49, 0xA5, 0x89, 0x85, 0x15, 0x10, 0xD3, 0x73, 0x86, 0x37, 0x26, 0x7C, 0xE5, 0xE6, 0x60,
-    0xF4, 0xCF, 0xF1, 0x8A, 0x34, 0xB7, 0x38, 0xC1, 0xD6, 0x7D, 0x99, 0x7F, 0x1C, 0x2B, 0xB2, 0x1B,
-    0x2B, 0xD2, 0xAF, 0x69, 0x79, 0x75, 0x6A, 0x79, 0xB5, 0xB3, 0xBC, 0xDA, 0xBE, 0xC5, 0xAB, 0xCF,
-    0xF0, 0xE8, 0x8E, 0x90, 0x6E, 0xC2, 0x34, 0x4F, 0xC9, 0xA2, 0x4F, 0x62, 0x6D, 0x3B, 0x58, 0xD6,
-    0xF6, 0x8D, 0x8E, 0x44, 0x68, 0x88, 0x08, 0x2C, 0x14, 0xF5, 0x09, 0x0E, 0x89, 0xAC, 0x24, 0x6E,
-    0x39, 0xD3, 0x10, 0xC2, 0x83, 0x83, 0x4C, 0x37, 0xAF, 0xA1, 0x04, 0xA0, 0x80, 0xED, 0x8B, 0x65,
-    0x7D, 0x0C, 0xE2, 0x3A, 0x75, 0xA6, 0xA5, 0x1C, 0x26, 0x42, 0x20, 0xD1, 0xB5, 0xF2, 0x3C, 0x21,
-    0x39, 0xB9, 0x0D, 0xB4, 0xF1, 0x15, 0xB8, 0x52, 0x4E, 0x83, 0x2E, 0xBC, 0x76, 0x34, 0x41, 0x49,
-    0x9D, 0xD5, 0xA0, 0x3C, 0x49, 0x80, 0x05, 0x05, 0x00, 0x3F, 0x5D, 0x23, 0xB2, 0x04, 0x30, 0xB6,
-    0x4E, 0x5B, 0xFC, 0x4D, 0x2E, 0x66, 0x34, 0xA8, 0x06, 0x9B, 0x3A, 0xA5, 0xFA, 0x97, 0x6B, 0x63,
-    0x68, 0x59, 0xCB, 0x91, 0x25, 0x74, 0xCC, 0x09, 0x5F, 0xCB, 0x1A, 0xEE, 0x47, 0xBB, 0x65, 0x33,
-    0xD9, 0x70, 0x58, 0xD9, 0x84, 0x40, 0x02, 0x19, 0x1D, 0x04, 0x52, 0x67, 0x22, 0x99, 0xC2, 0x29,
-    0x8A, 0xD5, 0xE2, 0x40, 0x5D, 0x33, 0xEA, 0xB1, 0x28, 0x35, 0xB3, 0x65, 0x26, 0x9C, 0x06, 0xE7,
-    0xF0, 0x1E, 0x46, 0xBD, 0x3C, 0x71, 0xCD, 0xA8, 0x77, 0x56, 0x0F, 0x00, 0xF9, 0xBE, 0x90, 0xBE,
-    0x2C, 0x12, 0xBA, 0xC8, 0x61, 0xF5, 0xC8, 0xF3, 0x1E, 0x54, 0xB2, 0xD3, 0xAA, 0x82, 0xCE, 0xE6,
-    0x80, 0x37, 0x7B, 0xEA, 0x55, 0x8D, 0x36, 0x1D, 0xBB, 0x49, 0xBB, 0x05, 0x92, 0x88, 0xD5, 0x93,
-    0xD3, 0xEA, 0x91, 0xF9, 0x80, 0x9F, 0xF6, 0x4B, 0x1C, 0x7F, 0x48, 0xEC, 0x75, 0xC3, 0x41, 0x7D,
-    0xD8, 0x23, 0x97, 0x49, 0x1F, 0x7D, 0x08, 0xB8, 0x2F, 0xC4, 0x83, 0xE0, 0xC7, 0x4D, 0x05, 0x3E,
-    0x50, 0xC0, 0x44, 0xBD, 0x9A, 0x13, 0x02, 0xD9, 0x3B, 0x30, 0x21, 0x29, 0x2C, 0xD7, 0x04, 0x02,
-    0x18, 0xCE, 0x59, 0xA8, 0x1B, 0xBD, 0xD6, 0x7A, 0x13, 0xDC, 0x6C, 0x94, 0x39, 0x00, 0xEF, 0x0E,
-    0x0A, 0xE0, 0xE9, 0x79, 0x80, 0x42, 0x00, 0x41, 0x84, 0xF2, 0x20, 0x07, 0x80, 0x58, 0x5E, 0x51,
-    0x23, 0xC9, 0x41, 0xE1, 0x9D, 0x03, 0x07, 0xE6, 0x65, 0xC6, 0x8A, 0xB2, 0x74, 0xC2, 0x1A, 0x49,
-    0xD9, 0x2A, 0x69, 0x21, 0xD3, 0xE1, 0x22, 0x34, 0xAB, 0xA1, 0x06, 0x14, 0xD2, 0xEA, 0xED, 0x8D,
-    0xDE, 0x1D, 0xAA, 0x92, 0xE7, 0x14, 0x17, 0x33, 0x43, 0x1F, 0x87, 0x89, 0xE4, 0x7D, 0x57, 0x27,
-    0x0A, 0x3A, 0x12, 0x30, 0xB0, 0x5F, 0xE2, 0xD6, 0x4E, 0x6A, 0xC1, 0x0E, 0x24, 0xA3, 0x20, 0x23,
-    0xEC, 0x6D, 0xD9, 0xE8, 0x49, 0x24, 0x8E, 0xC4, 0xFA, 0xA0, 0x0B, 0xC6, 0x2D, 0x3C, 0xBC, 0x6C,
-    0x14, 0x0B, 0xF8, 0xF6, 0x6B, 0x85, 0x9A, 0xAB, 0xC2, 0x46, 0x38, 0xF4, 0x3C, 0xB6, 0xD8, 0x3F,
-    0x98, 0x27, 0xD4, 0xB2, 0x0D, 0x74, 0x2C, 0x54, 0x6B, 0x5E, 0xCB, 0xAF, 0x72, 0x78, 0x5F, 0x84,
-    0x41, 0x70, 0x44, 0xFE, 0x95, 0x1C, 0xE6, 0xBF, 0xFE, 0xF1, 0x70, 0x3A, 0xB1, 0xDF, 0x91, 0x1D,
-    0x98, 0x70, 0x0C, 0x32, 0xB1, 0xF1, 0xF1, 0x05, 0x51, 0xFC, 0x25, 0xB0, 0x29, 0x55, 0x28, 0x3D,
-    0x0A, 0x02, 0xA4, 0xEC, 0xFE, 0x69, 0xC0, 0x0D, 0xE8, 0x3C, 0x2C, 0x2B, 0x94, 0x9F, 0x9F, 0x04,
-    0xA3, 0xEE, 0xC0, 0xFE, 0x4E, 0x41, 0xBB, 0x1C, 0x1A, 0xBD, 0x54, 0x9F, 0xFA, 0x32, 0x40, 0xA6,
-    0x94, 0x05, 0x43, 0x3E, 0x90, 0x1F, 0x85, 0xAC, 0x2A, 0xA9, 0x52, 0xD9, 0x92, 0x7D, 0x3B, 0x9B,
-    0xCF, 0x2E, 0x5A, 0x73, 0x8E, 0x67, 0x73, 0x0A, 0xA6, 0x40, 0x90, 0xE3, 0xAA, 0x0B, 0xA6, 0x48,
-    0xCE, 0x36, 0xDC, 0x49, 0x62, 0x95, 0xE1, 0x00, 0x17, 0xE0, 0x0F, 0xB8, 0x92, 0x52, 0x59, 0x46,
-    0x5A, 0x47, 0x7D, 0x2C, 0x94, 0x5A, 0x4D, 0xA5, 0x48, 0xB7, 0x49, 0x99, 0x6B, 0xF7, 0x3A, 0x22,
-    0x18, 0x55, 0x28, 0x7B, 0xB3, 0xC5, 0xF8, 0x26, 0xBE, 0xE5, 0x59, 0xD8, 0x81, 0xDD, 0x2B, 0x64,
-    0x64, 0xFC, 0xC4, 0x81, 0x7F, 0xB8, 0xCF, 0xC5, 0xAE, 0x8C, 0x65, 0x4B, 0x05, 0x47, 0xE3, 0xB4,
-    0xC1, 0xA1, 0x77, 0xE8, 0x8B, 0x64, 0x4E, 0xF9, 0xF5, 0xAF, 0xD3, 0x97, 0xC7, 0xAD, 0xA1, 0x0C,
-    0xE2, 0x3E, 0xAA, 0x8A, 0x82, 0x33, 0xE1, 0x3A, 0x0E, 0x8C, 0xCC, 0xCA, 0x9F, 0x02, 0x00, 0x7F,
-    0xC1, 0xF7, 0x91, 0x1E, 0x37, 0xD9, 0x06, 0x88, 0x6A, 0xA3, 0x43, 0xED, 0x03, 0xE6, 0x03, 0xDC,
-    0x60, 0x07, 0x44, 0x3E, 0x41, 0x9F, 0xC7, 0x22, 0xC2, 0xC6, 0x32, 0xD3, 0xA3, 0x67, 0x0E, 0x1D,
-    0xAC, 0xBF, 0x37, 0x53, 0x38, 0xCA, 0xFA, 0x47, 0x59, 0xFF, 0xA8, 0xEB, 0x17, 0x11, 0x72, 0x4D,
-    0x10, 0x91, 0xAC, 0x31, 0xFD, 0xBB, 0xD3, 0xC4, 0x58, 0x44, 0x00, 0xAD, 0x39, 0x17, 0xF7, 0x01,
-    0xFC, 0x17, 0x85, 0x07, 0x66, 0xC2, 0x4D, 0x76, 0x6B, 0xEF, 0x59, 0x9A, 0x7D, 0x82, 0x7C, 0x3D,
-    0x3B, 0x84, 0x7F, 0x25, 0xB7, 0x0A, 0xDB, 0x31, 0xF4, 0xA7, 0x70, 0x88, 0xAA, 0xCB, 0x32, 0x79,
-    0xB9, 0x61, 0x75, 0x5E, 0xAE, 0xAB, 0x3E, 0x65, 0xF0, 0x26, 0xEA, 0x4A, 0x7A, 0x85, 0x55, 0x88,
-    0xCF, 0x57, 0x7F, 0x4C, 0x1A, 0x5E, 0x87, 0xA4, 0x96, 0xEB, 0x3D, 0x41, 0x9F, 0xE2, 0xBA, 0x13,
-    0xB6, 0x69, 0x65, 0x4D, 0xF1, 0x42, 0x54, 0xE7, 0x55, 0xF9, 0xB5, 0x2A, 0x2F, 0xB3, 0xB2, 0x10,
-    0x34, 0x99, 0x80, 0xF3, 0xE2, 0xC9, 0x9D, 0x13, 0xDD, 0x07, 0x01, 0xCD, 0xD5, 0xAA, 0x4D, 0x9B,
-    0x48, 0xF8, 0x37, 0x24, 0x0F, 0x33, 0x10, 0x55, 0xC0, 0x38, 0x85, 0x9D, 0xAA, 0x3B, 0x90, 0x57,
-    0x9F, 0x92, 0xEF, 0xCB, 0xB2, 0x23, 0x23, 0x0E, 0xE6, 0x37, 0x27, 0x15, 0x69, 0xB2, 0x05, 0x27,
-    0x2E, 0x98, 0xAF, 0x66, 0xB9, 0x70, 0x73, 0x86, 0xC3, 0x95, 0x81, 0xBE, 0x6A, 0x4B, 0xA8, 0xA7,
-    0xB1, 0x0D, 0xA0, 0xA9, 0x02, 0x11, 0xFD, 0x00, 0x8C, 0x29, 0x04, 0x7E, 0x5A, 0xC7, 0x70, 0x15,
-    0xA4, 0x88, 0x47, 0x5C, 0x94, 0xE1, 0xC7, 0xAF, 0xF6, 0xC2, 0x35, 0x91, 0x20, 0xE5, 0x5E, 0x00,
-    0x8B, 0x37, 0x33, 0x37, 0xDC, 0x77, 0xF7, 0xCA, 0x61, 0xAB, 0x44, 0x07, 0x45, 0xFB, 0xB0, 0x59,
-    0x08, 0x3D, 0xBE, 0xE8, 0x7E, 0x79, 0x47, 0x9E, 0x7B, 0x78, 0xEF, 0xA1, 0xBD, 0xF3, 0xB1, 0x7D,
-    0xD8, 0xE2, 0x4C, 0x96, 0x60, 0xA4, 0xDE, 0xF8, 0x93, 0x98, 0xF5, 0xB2, 0xC7, 0x62, 0x09, 0x8F,
-    0x29, 0x61, 0x73, 0xA6, 0xC1, 0xCA, 0xA8, 0x47, 0x24, 0x0A, 0x7A, 0x23, 0x6A, 0x69, 0x10, 0xC6,
-    0xCE, 0xAC, 0x11, 0x05, 0x27, 0x9C, 0x55, 0x7B, 0xB2, 0x63, 0x5B, 0x7B, 0x7B, 0xCF, 0xA8, 0xCA,
-    0x34, 0x1D, 0x34, 0x41, 0x0B, 0x59, 0x81, 0xC1, 0xAB, 0x85, 0xC1, 0x83, 0x4A, 0x68, 0xCD, 0x21,
-    0x2C, 0x44, 0xDD, 0xAC, 0x32, 0xDC, 0x50, 0xCE, 0x9F, 0x28, 0x65, 0x41, 0x85, 0xD8, 0x2C, 0xC1,
-    0xF4, 0xF6, 0x8F, 0x01, 0x15, 0xC6, 0xA4, 0x56, 0x1C, 0x2D, 0xC8, 0x7E, 0x6B, 0xAF, 0x30, 0x27,
-    0xCE, 0xCB, 0x6D, 0x6B, 0x7A, 0xB1, 0xAD, 0xB0, 0x2F, 0x74, 0x57, 0x1B, 0x00, 0xB3, 0xD9, 0x76,
-    0x05, 0xE3, 0xFD, 0xCD, 0x36, 0x96, 0x3B, 0x06, 0xAF, 0x76, 0xDB, 0xD0, 0x5F, 0xAF, 0xF4, 0x97,
-    0x60, 0x78, 0x7D, 0xA3, 0x6F, 0x31, 0xF9, 0x47, 0x2D, 0x98, 0x24, 0x0A, 0x04, 0xF1, 0x8B, 0xFE,
-    0x87, 0xFF, 0xD8, 0x78, 0x63, 0x30, 0x42, 0x02, 0x0D, 0xBE, 0x90, 0xF0, 0xA8, 0x48, 0x5D, 0x21,
-    0x40, 0x2F, 0x8F, 0xAC, 0x8D, 0xAD, 0x5D, 0xAE, 0xC1, 0xE1, 0xBD, 0xEC, 0xBE, 0x73, 0x31, 0x8E,
-    0x8C, 0xCF, 0xD3, 0x02, 0x67, 0x81, 0x4F, 0xE1, 0x01, 0xB9, 0xA1, 0x42, 0x0D, 0x5C, 0x09, 0xB3,
-    0x6B, 0x6D, 0x27, 0x22, 0xB7, 0x13, 0x8C, 0xC6, 0x4E, 0x47, 0x44, 0xD0, 0xD9, 0x4E, 0x16, 0x4C,
-    0x30, 0x79, 0x0F, 0xCE, 0xEA, 0x39, 0xC3, 0xE3, 0x64, 0xAC, 0xFC, 0x71, 0x80, 0x5D, 0x5C, 0xF5,
-    0xD8, 0xD4, 0xF9, 0x88, 0x16, 0x8C, 0x52, 0x11, 0x52, 0xE9, 0x43, 0x6B, 0x95, 0x94, 0x3C, 0xA2,
-    0x3D, 0x8E, 0xA8, 0x80, 0xF4, 0xB1, 0x2C, 0x5C, 0xC4, 0x04, 0xA7, 0xEB, 0xF0, 0x9E, 0xCC, 0x2B,
-    0xB6, 0x31, 0xA2, 0x6E, 0x4F, 0x8A, 0x49, 0x21, 0x48, 0x5E, 0x86, 0x2A, 0x07, 0x92, 0x9A, 0x65,
-    0x9D, 0xF2, 0x0C, 0x64, 0x30, 0x6C, 0x1D, 0xCA, 0xFE, 0xA8, 0x55, 0xC6, 0x99, 0xE6, 0x99, 0xFA,
-    0x3A, 0xD3, 0x9A, 0x33, 0xF5, 0xF7, 0x9E, 0x7A, 0x41, 0x36, 0xFF, 0x1B, 0x20, 0xFA, 0x9F, 0x09,
-    0xD9, 0x4B, 0xF8, 0x52, 0x44, 0xF6, 0x43, 0x7D, 0x63, 0xB2, 0x74, 0x5D, 0xAA, 0x30, 0x4F, 0x68,
-    0x30, 0xD1, 0x5C, 0xC2, 0x3C, 0xCB, 0x8A, 0xC2, 0x9E, 0x7A, 0x32, 0x9A, 0x76, 0x3B, 0xF0, 0x43,
-    0x21, 0x7F, 0x79, 0x7A, 0x8E, 0xDD, 0x2E, 0x61, 0x5B, 0xFA, 0x97, 0xF2, 0x7D, 0xC2, 0xE9, 0x75,
-    0x51, 0x63, 0x65, 0x73, 0x06, 0x6F, 0x5C, 0xF5, 0x5E, 0x1F, 0xB5, 0x26, 0x4B, 0xD6, 0x22, 0xC6,
-    0x3C, 0xAC, 0xB5, 0xFB, 0x77, 0x6B, 0xC4, 0x74, 0x0B, 0xAB, 0x75, 0x51, 0x23, 0xB4, 0x90, 0xED,
-    0xC9, 0x40, 0x0D, 0xD9, 0x76, 0xD0, 0xE3, 0xE9, 0x52, 0x16, 0xD6, 0xD8, 0x1E, 0xD6, 0x5D, 0x51,
-    0x36, 0xD8, 0x10, 0xB8, 0x3F, 0xA0, 0x80, 0x20, 0xB9, 0x39, 0xD7, 0xBC, 0xE2, 0x79, 0x82, 0x0C,
-    0xC7, 0x16, 0x8B, 0xC0, 0xE4, 0xFE, 0x46, 0x38, 0x50, 0xB2, 0x52, 0x5E, 0x00, 0xE6, 0xE4, 0xF2,
-    0x1B, 0x6A, 0x02, 0x8A, 0x9C, 0x97, 0xDD, 0x50, 0x13, 0x4F, 0x78, 0xF4, 0xF0, 0x9E, 0x89, 0x8A,
-    0x48, 0xF9, 0x24, 0x03, 0x56, 0x29, 0x56, 0xF0, 0x0B, 0x86, 0xD0, 0xE4, 0x2B, 0x44, 0x1E, 0x57,
-    0x05, 0xF4, 0x27, 0x28, 0x70, 0x1C, 0xAA, 0x17, 0x67, 0xBC, 0x7F, 0x1C, 0x42, 0x1C, 0x07, 0x7D,
-    0x42, 0x18, 0x0C, 0x1C, 0xA2, 0x92, 0x9C, 0x60, 0x75, 0x50, 0x7F, 0x3A, 0x9D, 0x6C, 0x90, 0x0A,
-    0xCE, 0xEA, 0xA5, 0xD1, 0x4B, 0x0A, 0x2E, 0x41, 0x5E, 0x66, 0xCD, 0x84, 0x54, 0x58, 0xF1, 0x1B,
-    0x84, 0xD5, 0xB4, 0xAC, 0xCB, 0xE2, 0xF4, 0x1C, 0x54, 0x30, 0x78, 0x67, 0xB8, 0x6F, 0xC5, 0x78,
-    0x86, 0x9F, 0x46, 0xF4, 0x7F, 0x60, 0xFF, 0x74, 0x80, 0x34, 0x17, 0xF1, 0xDB, 0x85, 0x03, 0x24,
-    0x3A, 0xB6, 0x2B, 0x69, 0xC4, 0xAC, 0x1D, 0x45, 0x78, 0x74, 0x01, 0xF4, 0x98, 0xAC, 0x57, 0x74,
-    0xB2, 0xFC, 0x26, 0xAF, 0xE4, 0x37, 0x9D, 0x88, 0x12, 0x51, 0xFD, 0x82, 0xE5, 0xF0, 0x5F, 0x5B,
-    0x56, 0x65, 0x21, 0x3A, 0xF8, 0x47, 0x70, 0x83, 0xC1, 0x76, 0x33, 0xA7, 0xED, 0xBF, 0x9E, 0x1F,
-    0xA5, 0x5E, 0x91, 0x88, 0xCA, 0x29, 0x61, 0x3C, 0x35, 0x7E, 0xB3, 0x21, 0x4C, 0xA3, 0xCB, 0x64,
-    0xAF, 0xD8, 0x7A, 0x46, 0xCE, 0xAE, 0x6C, 0x6D, 0xDE, 0xA4, 0x80, 0x67, 0x97, 0xE5, 0x8F, 0xAF,
-    0xB7, 0x86, 0x27, 0xDC, 0x84, 0x74, 0x29, 0xDA, 0x59, 0xAF, 0x85, 0x9A, 0xFF, 0x20, 0xEB, 0xDF,
-    0xC1, 0xBE, 0xCB, 0x36, 0x1A, 0xBF, 0x15, 0x90, 0xBD, 0x5B, 0x89, 0x2D, 0x5B, 0x66, 0x62, 0x02,
-    0xDF, 0x0E, 0xC9, 0xD8, 0xD5, 0x90, 0x8C, 0x8D, 0x48, 0xC6, 0xB1, 0x16, 0xC9, 0xE8, 0x57, 0x8E,
-    0xE6, 0x9C, 0x0C, 0x3D, 0x12, 0x69, 0x3F, 0x07, 0xDD, 0x3E, 0x2B, 0xC2, 0xF8, 0x59, 0x79, 0x64,
-    0x3A, 0xA9, 0x61, 0x02, 0x70, 0x23, 0x8F, 0xE4, 0xB0, 0x1A, 0x84, 0x7F, 0x40, 0x44, 0x0C, 0x82,
-    0x15, 0xA7, 0x8B, 0x83, 0x73, 0xD3, 0x7C, 0xF5, 0x0B, 0x0B, 0x44, 0x76, 0x21, 0xF7, 0xCC, 0x2D,
-    0x58, 0x8D, 0xF9, 0x23, 0x90, 0xF0, 0x7B, 0xD9, 0x89, 0x73, 0x5C, 0x09, 0xA6, 0x09, 0x25, 0x2D,
-    0x7C, 0xE9, 0xDF, 0xC4, 0x97, 0x45, 0x3C, 0xF3, 0x25, 0x9F, 0x09, 0x97, 0x1F, 0x45, 0x94, 0x3C,
-    0x92, 0x58, 0xB5, 0x23, 0xCA, 0x14, 0x76, 0x23, 0xD8, 0x6C, 0x85, 0x65, 0xF2, 0xB7, 0x5F, 0xBD,
-    0xFE, 0xF6, 0x78, 0x04, 0x6B, 0x7C, 0xD9, 0xB6, 0xF1, 0x10, 0x5A, 0xC1, 0x6F, 0xD4, 0x00, 0xF7,
-    0xDC, 0xF9, 0xC7, 0x7E, 0x56, 0x1F, 0xDB, 0xE9, 0x63, 0xBF, 0xAD, 0x0A, 0x4F, 0x0F, 0x4E, 0xD8,
-    0x28, 0xB7, 0xD4, 0xEA, 0x29, 0xA1, 0xC1, 0x1D, 0xA9, 0xAD, 0x16, 0xAB, 0x1C, 0xFE, 0x34, 0x8E,
-    0xF4, 0xDE, 0x79, 0xC0, 0x3D, 0xC1, 0x27, 0xFF, 0x65, 0xB7, 0x16, 0x5D, 0x81, 0x08, 0x24, 0xB8,
-    0xEA, 0x08, 0x53, 0x8B, 0xCA, 0x9F, 0x00, 0xAE, 0x08, 0x07, 0x06, 0xE3, 0xB1, 0x71, 0x8E, 0xFC,
-    0xF9, 0xB3, 0x8C, 0x03, 0x0B, 0xAC, 0x86, 0x10, 0xBB, 0x20, 0x92, 0x48, 0xE4, 0x8C, 0x70, 0x93,
-    0x27, 0x07, 0xE3, 0xAB, 0x17, 0x8C, 0xD9, 0xBB, 0x50, 0xC2, 0x2D, 0xDA, 0x47, 0x74, 0xFF, 0xAB,
-    0x87, 0x83, 0x99, 0x2A, 0x6D, 0x44, 0xFF, 0x46, 0xBC, 0xFF, 0x5F, 0x61, 0x36, 0x88, 0xEE, 0x43,
-    0x54, 0x32, 0x17, 0x8C, 0x21, 0x8C, 0x83, 0x63, 0x50, 0x41, 0x15, 0x0A, 0x75, 0x3A, 0x11, 0x20,
-    0x72, 0x40, 0x20, 0x46, 0xD2, 0xC6, 0xFE, 0x71, 0x7C, 0xDD, 0x56, 0xE5, 0x88, 0x58, 0x8D, 0x70,
-    0xD6, 0x21, 0x9C, 0x50, 0xA1, 0x2D, 0x83, 0x0B, 0xD1, 0x8D, 0xB9, 0x30, 0xFB, 0xCF, 0x62, 0x45,
-    0x80, 0x8D, 0x2D, 0x08, 0xC8, 0xEF, 0x8A, 0x57, 0xD1, 0xAF, 0xA2, 0x54, 0xAF, 0x43, 0x82, 0xCF,
-    0xE0, 0x09, 0xFE, 0x7C, 0x08, 0x23, 0xF9, 0x2D, 0x41, 0x0B, 0xA4, 0xA8, 0xCB, 0xA8, 0x49, 0x65,
-    0xDD, 0x34, 0xCA, 0x54, 0x46, 0xFE, 0xAA, 0x6C, 0x9D, 0x80, 0x96, 0x6C, 0x14, 0x19, 0x52, 0x7E,
-    0x53, 0xB4, 0x05, 0x96, 0x7B, 0x1A, 0x24, 0xCC, 0x7C, 0xC8, 0x60, 0x91, 0x4D, 0xF2, 0x06, 0xA1,
-    0x8B, 0x85, 0x07, 0xD2, 0xD2, 0x1B, 0xE9, 0x4F, 0xAB, 0x9E, 0x7E, 0x62, 0xA0, 0xF3, 0x4C, 0x84,
-    0x00, 0xAC, 0x84, 0x90, 0x52, 0x02, 0xBA, 0x0D, 0xDA, 0x0F, 0x13, 0x63, 0x2C, 0x95, 0x88, 0x1D,
-    0x13, 0x09, 0x61, 0xE0, 0x0A, 0x88, 0x02, 0x02, 0x88, 0x5B, 0xE8, 0xEA, 0x66, 0x05, 0xDC, 0x08,
-    0x8B, 0x5E, 0xC3, 0x35, 0xC4, 0x8E, 0x5B, 0x70, 0xC1, 0xA6, 0xD8, 0x3A, 0x48, 0xDC, 0x59, 0x8F,
-    0xA6, 0x15, 0x99, 0x4B, 0x1E, 0x23, 0x6A, 0xAC, 0xAC, 0xE5, 0x88, 0x11, 0xCC, 0x27, 0xEF, 0xC8,
-    0x41, 0x48, 0xDF, 0x80, 0xF9, 0xFE, 0x12, 0xBC, 0xD7, 0x8F, 0x20, 0x68, 0x13, 0x88, 0x76, 0x96,
-    0x59, 0xF6, 0xB9, 0xA8, 0x9C, 0xDA, 0xA3, 0x0A, 0x3D, 0x04, 0x5F, 0x27, 0x0C, 0x61, 0xC8, 0xBA,
-    0x17, 0xE8, 0xE4, 0x5A, 0xA4, 0xE1, 0xED, 0x00, 0xAB, 0xE4, 0xBE, 0x42, 0xE4, 0x45, 0x25, 0x9A,
-    0x51, 0xF0, 0x5F, 0x64, 0x2E, 0x99, 0x4D, 0x63, 0xE0, 0xA3, 0xDF, 0x3F, 0x60, 0x66, 0x53, 0x39,
-    0x2B, 0xC1, 0xAD, 0x72, 0xFF, 0x1C, 0x88, 0x5D, 0xCF, 0x59, 0x4C, 0xC4, 0xC0, 0x8F, 0xC2, 0xAA,
-    0x4D, 0xF0, 0xCE, 0xFF, 0x09, 0xAD, 0x5E, 0xC3, 0x35, 0x52, 0xD0, 0x3F, 0xE2, 0xE4, 0x0E, 0x15,
-    0xFA, 0xEA, 0x26, 0x85, 0x3E, 0xAA, 0xAA, 0x4A, 0x55, 0xDE, 0xAD, 0x36, 0xE5, 0xCE, 0x9A, 0x0A,
-    0x96, 0x27, 0x1D, 0xA2, 0xE3, 0x66, 0x5C, 0x6C, 0x49, 0x64, 0x98, 0x80, 0x49, 0x71, 0xB2, 0x4A,
-    0x4D, 0xD8, 0x9B, 0xD3, 0xF5, 0x6E, 0x87, 0x0D, 0xF3, 0x5E, 0x0A, 0x7E, 0xFF, 0x19, 0x72, 0x33,
-    0xA3, 0x22, 0xEF, 0xA1, 0xE0, 0xCD, 0x31, 0x86, 0xFB, 0x1B, 0x5F, 0x0C, 0x88, 0xA0, 0x0F, 0xDA,
-    0xB0, 0xF7, 0x0A, 0x98, 0xFF, 0x01, 0xDD, 0x78, 0x23, 0x4C, 0xA4, 0x4C, 0xC4, 0x36, 0xBD, 0x8F,
-    0xC7, 0x65, 0x1D, 0x29, 0xAC, 0xBA, 0x2C, 0x2D, 0x92, 0x1F, 0x81, 0x9D, 0x7B, 0x9D, 0xC7, 0x51,
-    0xE8, 0x29, 0x9F, 0xD9, 0x49, 0xE6, 0xC2, 0x01, 0xC0, 0x96, 0xA3, 0x1A, 0x2D, 0x0E, 0xC3, 0x0E,
-    0xA4, 0x82, 0x51, 0x48, 0xCF, 0xA6, 0x3A, 0x36, 0xF1, 0xFF, 0x8B, 0x50, 0xC4, 0x49, 0x0F, 0xBA,
-    0x78, 0x26, 0x8B, 0xBE, 0xD3, 0x26, 0x3F, 0xE8, 0x92, 0x57, 0xDA, 0xC3, 0x0F, 0x9F, 0xFB, 0xD0,
-    0xF7, 0xD1, 0x85, 0x11, 0xDA, 0x68, 0x4C, 0xC8, 0xDC, 0x77, 0xE0, 0x8F, 0x90, 0xB3, 0x8B, 0x83,
-    0x6B, 0x34, 0x62, 0x2C, 0xDF, 0x93, 0x9A, 0x7D, 0x81, 0x06, 0x58, 0x36, 0xE4, 0x0A, 0xE4, 0x56,
-    0xBC, 0x48, 0x03, 0xC7, 0x83, 0x95, 0xCB, 0xB3, 0x2B, 0xA8, 0x9C, 0x81, 0x2E, 0x8E, 0x21, 0x44,
-    0xD4, 0xCC, 0x67, 0x74, 0xEF, 0xCF, 0x9E, 0x51, 0x2F, 0x3E, 0x65, 0x72, 0xA7, 0xFE, 0xFD, 0xD6,
-    0x5D, 0x88, 0xD3, 0xBC, 0x9A, 0x48, 0x4D, 0x90, 0xFB, 0x4F, 0x9E, 0xC1, 0x25, 0xC7, 0x71, 0x0D,
-    0x8B, 0xF2, 0x45, 0x78, 0x32, 0x32, 0x42, 0xD6, 0x88, 0xC6, 0x25, 0x81, 0xBC, 0x60, 0x57, 0x42,
-    0xF9, 0x3A, 0x85, 0x6D, 0xCD, 0x80, 0x75, 0x2A, 0xC4, 0x47, 0xBC, 0xD3, 0xC9, 0x86, 0xA3, 0x5C,
-    0xD5, 0x89, 0x73, 0x50, 0xAD, 0x59, 0xAA, 0xB8, 0x27, 0xD7, 0x0B, 0xD8, 0xC7, 0x9F, 0xC8, 0x41,
-    0x84, 0x60, 0xF0, 0x77, 0x9D, 0xB1, 0x67, 0xD4, 0x7D, 0x4F, 0xCF, 0xD8, 0xB7, 0xEC, 0xB7, 0x98,
-    0xDB, 0x31, 0xD1, 0xB0, 0xA5, 0x62, 0x22, 0xE6, 0xA6, 0x7E, 0xC2, 0x5B, 0x00, 0x47, 0x7D, 0xF5,
-    0x9E, 0x7C, 0x13, 0x07, 0x40, 0x38, 0x4E, 0xDD, 0xC7, 0xA7, 0x7F, 0x11, 0x87, 0xEF, 0xD6, 0x68,
-    0xDA, 0xA5, 0x98, 0x69, 0x96, 0x06, 0x3D, 0x64, 0x78, 0xD2, 0x93, 0xEB, 0xB3, 0xBA, 0xED, 0xB6,
-    0x18, 0x71, 0x21, 0x8F, 0x3B, 0x9F, 0xE8, 0x13, 0x51, 0x3E, 0xB1, 0x9E, 0x48, 0x7D, 0xA7, 0x6C,
-    0x59, 0x0F, 0x1E, 0xFB, 0x40, 0x58, 0x04, 0x88, 0x37, 0x9C, 0x2E, 0x63, 0x67, 0x41, 0xED, 0x5F,
-    0x5A, 0x96, 0xFA, 0xF1, 0xA0, 0xE5, 0xDB, 0xBA, 0xDE, 0xC7, 0xB0, 0xDE, 0xE6, 0x88, 0x03, 0x31,
-    0xC9, 0x41, 0x1A, 0x2A, 0xC8, 0xFE, 0x3C, 0x1E, 0xF7, 0xED, 0x83, 0x43, 0x2C, 0x3B, 0x20, 0x4A,
-    0xB3, 0x4F, 0x79, 0xDB, 0xD1, 0xD2, 0x29, 0x3C, 0xD1, 0x6A, 0x32, 0x13, 0x2D, 0x28, 0x33, 0x79,
-    0xBC, 0x8C, 0x34, 0xAA, 0x8C, 0xE2, 0x2C, 0xD3, 0xF3, 0xE2, 0xB7, 0x6A, 0x84, 0xC0, 0x1D, 0x98,
-    0x76, 0x21, 0xA2, 0x29, 0x25, 0xF2, 0x04, 0xC4, 0x9E, 0xED, 0x62, 0xE1, 0xD2, 0xAF, 0xBF, 0xDA,
-    0xED, 0xC8, 0x73, 0xBF, 0xF1, 0x34, 0x22, 0x46, 0xE5, 0xEB, 0x84, 0xD2, 0xE5, 0x40, 0xCC, 0x5C,
-    0xF6, 0x8C, 0x11, 0x95, 0x2D, 0x51, 0x55, 0x59, 0x51, 0x19, 0xE4, 0x05, 0xA2, 0x2B, 0xC7, 0xEA,
-    0xAD, 0x67, 0xCC, 0xE5, 0x52, 0x84, 0xA8, 0x37, 0x7D, 0x59, 0x00, 0xBF, 0x79, 0x21, 0x00, 0x64,
-    0x7D, 0x42, 0x40, 0xC1, 0x60, 0xCE, 0xFA, 0x18, 0x2F, 0xFB, 0x22, 0xA4, 0x4D, 0xE7, 0x8D, 0xF2,
-    0x5F, 0xEB, 0x8D, 0xFE, 0x18, 0xD4, 0xDE, 0x18, 0x4E, 0x32, 0x83, 0xF1, 0xF8, 0x24, 0xDB, 0x33,
-    0x3D, 0x3E, 0x3D, 0x28, 0x63, 0x3B, 0x5D, 0x82, 0x4B, 0x99, 0x46, 0x39, 0x4F, 0xCF, 0x40, 0x7F,
-    0x7B, 0xAA, 0x49, 0x2B, 0xFD, 0x5A, 0xF2, 0x2D, 0x82, 0x93, 0x05, 0x86, 0x2C, 0x16, 0xCB, 0x23,
-    0x7B, 0x70, 0x35, 0x44, 0xB3, 0xEF, 0x18, 0x2E, 0x74, 0x40, 0x22, 0xF8, 0x4F, 0x91, 0x96, 0x44,
-    0x9F, 0x7E, 0xE4, 0xB6, 0x81, 0xFE, 0xC1, 0x12, 0xC9, 0x5A, 0x62, 0x24, 0xC3, 0x52, 0xCE, 0x9B,
-    0xFB, 0x71, 0x2B, 0x7A, 0xCF, 0x4F, 0x5C, 0x08, 0xE9, 0xBA, 0x49, 0x99, 0x97, 0xF5, 0x0E, 0x33,
-    0x07, 0x9E, 0xA2, 0x12, 0x80, 0xBC, 0x5B, 0x81, 0xA2, 0x22, 0x8E, 0x35, 0xDA, 0x2B, 0x40, 0x4A,
-    0x6C, 0x98, 0xC0, 0x5E, 0x1C, 0x90, 0x2B, 0x1D, 0x4C, 0xD0, 0x91, 0xBE, 0x05, 0x9E, 0x91, 0x51,
-    0xEC, 0xD6, 0x60, 0x12, 0xAB, 0x79, 0x0C, 0x47, 0xC0, 0xAF, 0xB2, 0x43, 0xB6, 0xA8, 0xE6, 0x66,
-    0x9D, 0xDE, 0x70, 0x10, 0x8B, 0x18, 0xD2, 0xF0, 0x4F, 0x67, 0x4A, 0xB8, 0x4D, 0x19, 0x74, 0xF2,
-    0x34, 0x2D, 0x2C, 0x46, 0x7A, 0x0E, 0x04, 0xB3, 0xC8, 0x35, 0xCD, 0x0F, 0x90, 0x3B, 0x3C, 0x63,
-    0xD4, 0xEE, 0xD6, 0x58, 0x6A, 0xE0, 0x10, 0x6E, 0x17, 0x6A, 0xDE, 0x4A, 0x62, 0x5D, 0x3A, 0x51,
-    0x3A, 0xC7, 0xBF, 0xB8, 0x72, 0xCD, 0x18, 0xD3, 0x10, 0xA8, 0x66, 0xAA, 0x69, 0x6C, 0xCA, 0xBD,
-    0x60, 0xC6, 0x9A, 0x46, 0xA8, 0xA0, 0x02, 0x20, 0xDD, 0x05, 0xB6, 0xC1, 0x74, 0x01, 0xA8, 0x13,
-    0xD5, 0x5B, 0xD0, 0x67, 0x55, 0x6A, 0x30, 0xA7, 0xD3, 0x29, 0x2F, 0xE9, 0x81, 0x27, 0xF6, 0x44,
-    0x02, 0xD6, 0x62, 0xC2, 0x44, 0x16, 0xD9, 0x49, 0xF9, 0x23, 0x62, 0x0A, 0x62, 0x9F, 0x85, 0x04,
-    0x83, 0x19, 0x56, 0xBD, 0x30, 0xCA, 0x69, 0x41, 0xC3, 0xAD, 0xEE, 0xD9, 0xC8, 0x8C, 0x27, 0xE0,
-    0x8A, 0x94, 0x8A, 0x5F, 0x75, 0x8B, 0x02, 0x00, 0x59, 0xF0, 0x39, 0xEC, 0x4F, 0x40, 0x11, 0x29,
-    0x6C, 0x50, 0x20, 0x43, 0x66, 0x41, 0x14, 0x61, 0x77, 0x10, 0xC8, 0xD5, 0x88, 0x6D, 0xCE, 0xF1,
-    0xA7, 0xF4, 0x5C, 0xBE, 0x41, 0x6F, 0xF3, 0x4B, 0xF8, 0xFB, 0xE8, 0x6B, 0x0C, 0x1D, 0x91, 0x4A,
-    0x29, 0xBD, 0x7D, 0xEA, 0xD7, 0xFE, 0xFB, 0x01, 0x49, 0x19, 0xAF, 0xF5, 0xA2, 0xBF, 0xC2, 0x97,
-    0x3B, 0x88, 0xBD, 0x47, 0x11, 0xAB, 0x38, 0xB9, 0x6A, 0xE5, 0xB8, 0x9D, 0x8D, 0x1A, 0x11, 0xB2,
-    0x7D, 0x24, 0xF8, 0xDB, 0x6F, 0x63, 0x31, 0x4B, 0x93, 0x21, 0x7E, 0xD1, 0x8E, 0xF9, 0x90, 0xBC,
-    0x4C, 0x6F, 0xF8, 0x85, 0x39, 0x10, 0x10, 0xE3, 0x41, 0xA7, 0xF0, 0x9C, 0x3F, 0x87, 0x12, 0x84,
-    0x17, 0x31, 0xA8, 0x54, 0x9A, 0x02, 0x17, 0xCB, 0x59, 0xD9, 0x7E, 0x41, 0xEE, 0x7A, 0x49, 0xAC,
-    0x5F, 0xAF, 0x1D, 0xD2, 0x26, 0xF8, 0xAE, 0x70, 0xC8, 0xEA, 0x25, 0x19, 0x76, 0xE5, 0xD1, 0x53,
-    0xF9, 0xC3, 0x6B, 0x72, 0x3F, 0x6C, 0x38, 0xCF, 0x77, 0x4E, 0x5E, 0x2F, 0x94, 0xA9, 0x29, 0x8B,
-    0xA0, 0x89, 0xC3, 0xD2, 0xBD, 0x88, 0xA0, 0xD3, 0x70, 0xD4, 0x4E, 0x42, 0xBF, 0x30, 0x27, 0x25,
-    0x69, 0xF4, 0x05, 0xD5, 0x2B, 0xFC, 0x61, 0xF4, 0x8C, 0x25, 0x73, 0xC4, 0x93, 0x3B, 0x6F, 0x19,
-    0xB1, 0x31, 0x71, 0xFA, 0x74, 0x4F, 0xB5, 0xBD, 0xC3, 0x17, 0x32, 0xAB, 0xCB, 0xE9, 0xE7, 0x07,
-    0x2A, 0xA7, 0x2E, 0x0F, 0x99, 0xC8, 0xE1, 0x37, 0x25, 0x5F, 0x64, 0x61, 0x35, 0x31, 0xC1, 0x43,
-    0xE4, 0x29, 0xFC, 0x59, 0x10, 0x25, 0x1E, 0x2C, 0xA0, 0xC4, 0xFE, 0xB5, 0x7D, 0x69, 0x88, 0x45,
-    0x6D, 0xD9, 0x9F, 0xDA, 0x97, 0x87, 0xD4, 0xD6, 0xB2, 0xE1, 0xE6, 0x44, 0xC1, 0x84, 0x1A, 0x8D,
-    0x43, 0xF8, 0x08, 0x4B, 0x88, 0x5D, 0x24, 0x96, 0xB9, 0x5C, 0x22, 0x99, 0x8E, 0xCC, 0xF8, 0xB8,
-    0xEC, 0xB8, 0x4C, 0x73, 0x3B, 0xEA, 0x34, 0xD9, 0xAF, 0x5F, 0x92, 0xFD, 0xDA, 0xE0, 0x95, 0x1F,
-    0x43, 0x32, 0xAE, 0xBE, 0xF0, 0x1A, 0xFC, 0x3C, 0x71, 0xF4, 0xB2, 0x48, 0xAF, 0x6A, 0x3B, 0x7E,
-    0x09, 0xAA, 0xFB, 0x72, 0x22, 0x9B, 0x57, 0xFE, 0xC5, 0x98, 0x7E, 0xC3, 0x36, 0xF6, 0xE9, 0x29,
-    0xFD, 0x32, 0x53, 0x5C, 0x5C, 0xCE, 0xB8, 0x5E, 0x44, 0xFD, 0xA3, 0x46, 0x06, 0xF7, 0xAF, 0x28,
-    0x0F, 0x81, 0xDA, 0x85, 0xD7, 0x2E, 0x53, 0x86, 0xFB, 0x9A, 0x44, 0x47, 0x0F, 0xBE, 0x49, 0x5F,
-    0x77, 0x61, 0x8D, 0x42, 0x13, 0x4B, 0x98, 0xCE, 0x16, 0xBF, 0x41, 0xBC, 0x93, 0x34, 0x0C, 0x7F,
-    0xD1, 0xFD, 0x1B, 0xD3, 0xEB, 0x8B, 0x22, 0x8A, 0xAA, 0x04, 0xBE, 0xC9, 0x0B, 0xD9, 0x1B, 0x99,
-    0x47, 0x96, 0x67, 0x70, 0xEE, 0x64, 0x79, 0x95, 0x0C, 0x02, 0x3D, 0xD3, 0x2E, 0xAF, 0x63, 0xDB,
-    0xCA, 0xEA, 0xBC, 0xBD, 0xBD, 0xBD, 0x0B, 0x40, 0xB1, 0x72, 0x4B, 0xCF, 0x9E, 0x79, 0x0C, 0x72,
-    0x32, 0x43, 0xCC, 0x3D, 0xAD, 0x4E, 0x31, 0x5D, 0x96, 0x51, 0x84, 0x77, 0x6A, 0x26, 0xF8, 0x03,
-    0x52, 0xBD, 0x33, 0xE1, 0xFE, 0x42, 0x3F, 0xE1, 0xE9, 0x47, 0x06, 0x14, 0x5A, 0x88, 0x0C, 0x17,
-    0x01, 0xB1, 0xEA, 0x93, 0x0A, 0xAE, 0x93, 0xB8, 0xD9, 0x6D, 0xF3, 0x49, 0x94, 0x71, 0x61, 0xA7,
-    0xAD, 0x01, 0xFC, 0xE1, 0x6B, 0xCE, 0xA1, 0x30, 0x48, 0xA0, 0xAF, 0xB0, 0x2B, 0x13, 0x6D, 0x14,
-    0xEE, 0x18, 0x62, 0xF1, 0x7C, 0x95, 0x17, 0x58, 0x33, 0x98, 0x44, 0x6E, 0x55, 0xCD, 0xF0, 0x2D,
-    0xD6, 0x38, 0xAA, 0xD0, 0xE7, 0x09, 0xA7, 0xBC, 0x83, 0xB1, 0x9B, 0x45, 0x04, 0xF3, 0x50, 0x94,
-    0x53, 0x98, 0xD6, 0x88, 0x1C, 0x77, 0xEB, 0x50, 0x78, 0xFA, 0xE2, 0x84, 0xC3, 0x8A, 0xC0, 0xFB,
-    0xD7, 0xF8, 0x0A, 0xB1, 0x77, 0x7F, 0x84, 0xA0, 0x47, 0x04, 0x26, 0x18, 0x70, 0x0E, 0xE1, 0xA9,
-    0x90, 0x57, 0x3D, 0x19, 0xA6, 0x0B, 0xFB, 0x80, 0x29, 0xBC, 0xC2, 0xE7, 0x10, 0xFC, 0x89, 0x7D,
-    0xC3, 0x56, 0x17, 0xA7, 0x87, 0x45, 0xB9, 0xD8, 0x9F, 0x0A, 0xF9, 0x90, 0x18, 0x21, 0x4C, 0x73,
-    0x42, 0x68, 0x06, 0x57, 0x07, 0x9E, 0x0B, 0xE0, 0x93, 0x5C, 0x3B, 0xF3, 0x24, 0x19, 0x06, 0xDA,
-    0x89, 0x41, 0x76, 0x51, 0xDB, 0xB2, 0x0C, 0x7F, 0x94, 0xB9, 0x63, 0xEA, 0xF6, 0x79, 0x95, 0x19,
-    0x56, 0xED, 0x3A, 0x5B, 0xBE, 0xD9, 0xB2, 0x30, 0x25, 0xFD, 0x8E, 0xEC, 0x39, 0xDC, 0x48, 0x5F,
-    0xEF, 0xC1, 0x3F, 0x4D, 0xF9, 0xF5, 0x81, 0x5B, 0x67, 0x1F, 0x81, 0x7C, 0x17, 0x0A, 0xC2, 0x71,
-    0xF7, 0x1D, 0xBB, 0xB2, 0xDF, 0xB5, 0x85, 0x7D, 0x5A, 0xF4, 0x56, 0x83, 0x88, 0x64, 0xB3, 0x05,
-    0xA7, 0x0F, 0x0E, 0xCD, 0xA9, 0x17, 0x4E, 0x2B, 0xB0, 0xF5, 0x10, 0x9D, 0x8B, 0x91, 0x2C, 0xCC,
-    0x3C, 0x61, 0x86, 0x05, 0x4B, 0x0C, 0x27, 0x9D, 0x99, 0x33, 0x27, 0xD2, 0x20, 0x8B, 0xEB, 0xF0,
-    0x45, 0x86, 0x66, 0x1B, 0x1A, 0x0E, 0x4B, 0x98, 0x84, 0x38, 0x6F, 0x6D, 0x98, 0xEB, 0x45, 0x60,
-    0x48, 0xFC, 0x36, 0x65, 0xA5, 0x18, 0x19, 0xF4, 0x2E, 0x30, 0xBF, 0xFA, 0x49, 0x73, 0x4C, 0x54,
-    0xD2, 0x43, 0x9A, 0xFA, 0x3A, 0x18, 0xFF, 0x59, 0x42, 0x0D, 0x04, 0x14, 0x08, 0x2B, 0x56, 0x55,
-    0x9E, 0x99, 0xE0, 0xAF, 0x99, 0xDC, 0x00, 0x3C, 0xC9, 0xAC, 0x8A, 0x37, 0xB1, 0xDB, 0xD8, 0x79,
-    0x2A, 0x86, 0xCB, 0x9E, 0x86, 0x2F, 0x1C, 0x18, 0xA3, 0x5D, 0x7E, 0x82, 0xD8, 0x90, 0x53, 0xD6,
-    0x70, 0x26, 0x43, 0x6E, 0x73, 0x89, 0xCB, 0x27, 0x71, 0x3C, 0xA9, 0x14, 0xFF, 0x72, 0x9E, 0x46,
-    0x6A, 0x8E, 0x15, 0x98, 0x46, 0xAB, 0xDE, 0x10, 0xFF, 0x59, 0x97, 0x0F, 0x21, 0x12, 0x35, 0xB1,
-    0x43, 0x32, 0xE1, 0xD2, 0xA7, 0xA3, 0xFA, 0x6E, 0xC4, 0xEE, 0xA3, 0xB7, 0x9A, 0x10, 0xB9, 0x74,
-    0x10, 0x79, 0x76, 0x65, 0x1E, 0xB8, 0x70, 0xF0, 0x47, 0xD8, 0x15, 0xA2, 0x1E, 0x31, 0x65, 0x7B,
-    0x30, 0x21, 0xFC, 0x1F, 0xAB, 0xEB, 0x49, 0x5B, 0x56, 0x3C, 0x2C, 0x98, 0xF5, 0x27, 0xE1, 0x66,
-    0x71, 0x46, 0xE3, 0x92, 0x88, 0xAB, 0x84, 0x9B, 0xF3, 0x97, 0x8F, 0x31, 0xFD, 0xC9, 0x25, 0x2C,
-    0xCE, 0x5F, 0xDD, 0x3C, 0x78, 0xD8, 0x15, 0x1E, 0x73, 0x96, 0xCA, 0x09, 0x98, 0x39, 0xD6, 0x84,
-    0xDF, 0x6B, 0x6C, 0xBF, 0x7A, 0xA5, 0xBF, 0x38, 0x44, 0xAF, 0x0C, 0x82, 0x05, 0xAA, 0x31, 0xEA,
-    0xE3, 0x62, 0x47, 0x8E, 0x77, 0x71, 0x52, 0x0E, 0x77, 0xF6, 0x69, 0x19, 0xCC, 0x83, 0x49, 0x93,
-    0x9B, 0x07, 0xD2, 0xA6, 0x34, 0xDB, 0x69, 0x3D, 0x99, 0x3F, 0x48, 0x9B, 0x51, 0xCC, 0x92, 0xB7,
-    0xC6, 0xB0, 0x8A, 0xED, 0x58, 0x66, 0x2B, 0xEC, 0x88, 0xC7, 0xA0, 0x31, 0x3D, 0x8D, 0xAB, 0x03,
-    0x0F, 0x5B, 0x7B, 0x73, 0xB5, 0x90, 0xFB, 0x22, 0xFD, 0x7D, 0x4A, 0x16, 0x55, 0xC7, 0x38, 0xDA,
-    0x90, 0x1D, 0x2E, 0x5B, 0x81, 0x2E, 0x6C, 0xA7, 0x73, 0x45, 0x78, 0x5C, 0x7B, 0x06, 0x49, 0xB3,
-    0x3C, 0x11, 0xE9, 0x54, 0xC2, 0x1F, 0xD4, 0x86, 0x18, 0x1B, 0xF3, 0x3B, 0xB4, 0x7A, 0xD4, 0xDA,
-    0x50, 0x38, 0xA7, 0xF9, 0x09, 0x90, 0x9F, 0x60, 0x77, 0xFC, 0xB3, 0x44, 0xA2, 0xCF, 0x55, 0xFA,
-    0x42, 0xD5, 0xD1, 0x45, 0x30, 0xB1, 0x25, 0x1C, 0x96, 0x0B, 0xD6, 0x9F, 0x56, 0xC3, 0x8A, 0x0E,
-    0x58, 0x7F, 0x82, 0xCD, 0x90, 0x7E, 0xDF, 0xB7, 0xB9, 0xBD, 0x3A, 0x95, 0x57, 0xED, 0x64, 0x8B,
-    0xC7, 0x46, 0x28, 0x77, 0x38, 0xE0, 0x90, 0x35, 0x90, 0xD6, 0xB9, 0xAC, 0x19, 0x5E, 0x91, 0x8E,
-    0x4A, 0x1C, 0xE6, 0xF2, 0xAA, 0x81, 0x2E, 0xCA, 0x3B, 0xC4, 0xE3, 0x2D, 0xF6, 0x38, 0x68, 0xCF,
-    0xB9, 0x94, 0xAB, 0x09, 0x29, 0x57, 0xA2, 0x0B, 0x4E, 0x12, 0x29, 0x6F, 0x73, 0xBC, 0x44, 0xDF,
-    0x2C, 0xE3, 0xB7, 0x0F, 0x83, 0x1E, 0xF6, 0x11, 0x5A, 0x3C, 0x9F, 0xE7, 0x01, 0x78, 0x9A, 0x5B,
-    0xFA, 0x67, 0x1C, 0x2F, 0x73, 0x97, 0xBB, 0x83, 0x3C, 0x26, 0x4D, 0xC0, 0xD6, 0xED, 0xA7, 0x1B,
-    0xF4, 0x84, 0x80, 0x9A, 0x4B, 0x39, 0xD2, 0xBC, 0x60, 0xE8, 0xFE, 0x3F, 0x61, 0xA0, 0x53, 0x90,
-    0xE7, 0x67, 0x61, 0xB7, 0x09, 0x73, 0x8E, 0x9E, 0xD0, 0x65, 0x0A, 0x10, 0xAD, 0x5D, 0x21, 0x58,
-    0x11, 0xE1, 0x09, 0xC7, 0x31, 0x20, 0xC7, 0xC2, 0x5E, 0x9A, 0x4B, 0x12, 0x34, 0xBB, 0xAD, 0x5A,
-    0x9C, 0xD9, 0x0F, 0x81, 0x3A, 0xF1, 0x6B, 0x3C, 0x0B, 0x2D, 0x31, 0x42, 0x4F, 0xE6, 0xBF, 0xCC,
-    0xDC, 0xA8, 0xA3, 0x4B, 0xF1, 0xE0, 0xC7, 0xBB, 0x78, 0xF3, 0x45, 0x84, 0x75, 0xCB, 0x08, 0xC2,
-    0xF7, 0x4F, 0xA0, 0xD6, 0x5E, 0x04, 0xCC, 0x6D, 0x21, 0xB4, 0x4F, 0x3B, 0xEB, 0xEA, 0xCE, 0xD0,
-    0x67, 0xED, 0x6B, 0x77, 0x4E, 0x6A, 0x09, 0xAD, 0x0B, 0x5A, 0xF1, 0x24, 0xBB, 0xDA, 0xA0, 0x22,
-    0x18, 0xE6, 0x62, 0x21, 0x87, 0x37, 0xE9, 0xF2, 0x3B, 0x7C, 0x41, 0xA6, 0x21, 0x13, 0x12, 0x85,
-    0xCA, 0x08, 0x07, 0x34, 0x00, 0x05, 0x44, 0x0C, 0xBF, 0x20, 0x84, 0x01, 0xA2, 0x50, 0xBE, 0x85,
-    0x19, 0x92, 0x31, 0x91, 0x01, 0xAF, 0xE0, 0x89, 0xA1, 0x4A, 0x3D, 0x49, 0x16, 0xC7, 0x3B, 0xB7,
-    0xF1, 0x8A, 0xD1, 0xF3, 0x4B, 0x2E, 0x4F, 0x34, 0xAF, 0x98, 0x0A, 0x26, 0x27, 0x2E, 0x7D, 0xA9,
-    0x76, 0x85, 0xA2, 0xE9, 0x77, 0x2A, 0x9C, 0x43, 0x64, 0x36, 0xBC, 0x0E, 0x30, 0x0C, 0x14, 0x9E,
-    0x8C, 0x73, 0x06, 0x69, 0x3C, 0xCC, 0x21, 0x6D, 0x9E, 0x55, 0xF8, 0x65, 0x5D, 0xE1, 0x95, 0xFA,
-    0xE0, 0xE6, 0x57, 0x4F, 0x2E, 0xEE, 0xB7, 0x45, 0xB4, 0xC4, 0xF3, 0x69, 0xB6, 0x76, 0xE6, 0x88,
-    0xF2, 0x8A, 0x9A, 0x5A, 0x93, 0xF9, 0xEA, 0x39, 0x1F, 0x79, 0xBA, 0xB5, 0x6D, 0x81, 0xE8, 0x61,
-    0x21, 0x87, 0x02, 0x69, 0xA1, 0xB0, 0xCD, 0x00, 0x09, 0x88, 0xAB, 0x40, 0x3C, 0xF9, 0x99, 0xE9,
-    0x91, 0x7F, 0x20, 0x87, 0xB4, 0xC5, 0x91, 0x17, 0xA1, 0x28, 0xD7, 0x15, 0x22, 0x23, 0x15, 0x6A,
-    0x41, 0x44, 0xD1, 0x17, 0x70, 0x32, 0xF8, 0x13, 0xA2, 0x94, 0x71, 0xEB, 0x4D, 0xA8, 0xE7, 0x83,
-    0x55, 0xFF, 0xB8, 0xB0, 0x84, 0x9C, 0x6B, 0x8A, 0xE2, 0x89, 0x49, 0xE0, 0xB4, 0x70, 0x21, 0x0F,
-    0x81, 0xAE, 0x73, 0x37, 0xA5, 0xCB, 0x2E, 0x91, 0xC5, 0x6D, 0xCA, 0x6A, 0x96, 0xD7, 0x99, 0xFA,
-    0xBB, 0x75, 0x35, 0x2B, 0xEB, 0x16, 0xFA, 0xEF, 0xCC, 0x62, 0xCF, 0xD2, 0x65, 0xE1, 0x33, 0xA3,
-    0x23, 0xBA, 0x26, 0x42, 0x40, 0x78, 0xEF, 0x08, 0x9E, 0x9B, 0x69, 0xB0, 0x4D, 0xB3, 0x8B, 0x34,
-    0xD1, 0x48, 0x46, 0xCD, 0xCA, 0x23, 0xB2, 0x64, 0x7A, 0x0F, 0x53, 0x50, 0x90, 0xC9, 0xC8, 0xC4,
-    0x3C, 0xCD, 0x33, 0x66, 0xE6, 0x3A, 0x47, 0xDA, 0x99, 0x4C, 0x5C, 0x81, 0xB6, 0x09, 0x87, 0x17,
-    0x92, 0x86, 0x62, 0x3E, 0xC3, 0x63, 0xBB, 0x65, 0x0A, 0x6B, 0x5E, 0x4F, 0x7A, 0x0D, 0xB6, 0xB4,
-    0xD8, 0x46, 0x58, 0x67, 0xFA, 0xC3, 0xC9, 0x05, 0x2D, 0x5D, 0xBC, 0xB2, 0x2C, 0x30, 0xB7, 0x82,
-    0xD5, 0x80, 0xA5, 0x26, 0x7D, 0xA0, 0x9E, 0x11, 0x45, 0x80, 0x8C, 0x94, 0xD2, 0xEE, 0x4C, 0xBF,
-    0x9F, 0x50, 0x71, 0x21, 0x3D, 0x9E, 0x40, 0x06, 0xAB, 0xFE, 0x84, 0x7B, 0xC0, 0x0B, 0x99, 0xF3,
-    0xCC, 0x5C, 0xCF, 0x34, 0xB1, 0x51, 0x63, 0x01, 0xC7, 0x3D, 0xA5, 0xCD, 0xD1, 0xD8, 0x39, 0x4E,
-    0x5D, 0xB9, 0x93, 0x89, 0xDC, 0xF5, 0x9F, 0xBB, 0xEB, 0xF9, 0xCD, 0xE2, 0xEB, 0x9E, 0x4C, 0x26,
-    0xE7, 0x82, 0xA9, 0x22, 0x49, 0x9D, 0x3F, 0x32, 0x08, 0x12, 0x92, 0x69, 0x3E, 0xDA, 0x05, 0xCC,
-    0xF5, 0x0C, 0x60, 0xFD, 0x8D, 0xE6, 0x33, 0xE6, 0x7C, 0x30, 0x6A, 0xBA, 0x6B, 0xA0, 0x65, 0x1B,
-    0x72, 0xD5, 0x12, 0x14, 0x38, 0xC2, 0x79, 0xB8, 0x46, 0x4D, 0xE7, 0x5C, 0x8D, 0xAA, 0x40, 0xA2,
-    0x61, 0xF3, 0x9A, 0x74, 0xAE, 0xB6, 0x07, 0xD4, 0x3E, 0x0C, 0x0F, 0x9E, 0xFC, 0x7D, 0xAC, 0x29,
-    0x56, 0x02, 0xF2, 0x98, 0x89, 0x2F, 0xBC, 0xC1, 0x34, 0x51, 0xFB, 0x3D, 0xAD, 0xC6, 0x14, 0x4B,
-    0x62, 0xD2, 0xF2, 0x5C, 0x27, 0xCE, 0x7E, 0xC9, 0x1D, 0xD5, 0x2B, 0x4A, 0x04, 0x05, 0x06, 0xFF,
-    0x89, 0x34, 0xB8, 0xF7, 0xF0, 0xB1, 0x6A, 0xED, 0x34, 0x44, 0x7A, 0x59, 0xE9, 0x42, 0x3F, 0x77,
-    0xB3, 0x54, 0x38, 0x36, 0xC2, 0xA9, 0x28, 0xC7, 0xE2, 0x29, 0xD9, 0xD1, 0x60, 0x88, 0x5F, 0x1E,
-    0x92, 0x2A, 0x6A, 0xA3, 0x97, 0xDB, 0xA8, 0x89, 0x9B, 0xC8, 0x6B, 0xE1, 0xBD, 0xA7, 0x72, 0xA4,
-    0x4C, 0x89, 0xDB, 0xD2, 0x5D, 0x0A, 0x8A, 0x0F, 0x1E, 0xA6, 0xB4, 0xE6, 0x45, 0x40, 0x59, 0x66,
-    0x74, 0x4B, 0x99, 0xE1, 0x9F, 0x36, 0x71, 0xB7, 0x82, 0x25, 0xC8, 0x78, 0x5F, 0x88, 0x7C, 0xDF,
-    0x82, 0xBE, 0xA4, 0xD3, 0xEA, 0xD3, 0xD9, 0xC3, 0x26, 0x44, 0x17, 0xAF, 0xE2, 0x86, 0x9F, 0x08,
-    0xFC, 0xEC, 0x86, 0x89, 0xDD, 0x85, 0x2E, 0x10, 0x18, 0x04, 0x17, 0x98, 0x5D, 0x82, 0x9F, 0x55,
-    0xE7, 0x7F, 0x6D, 0x93, 0x92, 0x77, 0xDA, 0x41, 0x32, 0x63, 0x11, 0x1C, 0xBF, 0x8B, 0xC8, 0x4F,
-    0x45, 0x9E, 0x60, 0x45, 0x9C, 0xE6, 0x23, 0x2B, 0xCB, 0x6F, 0xC2, 0x25, 0x91, 0xED, 0xC6, 0x3C,
-    0xF1, 0xCD, 0xFA, 0xE7, 0xB4, 0x99, 0x7F, 0xC6, 0x72, 0x64, 0xAD, 0xF1, 0xB5, 0xE7, 0x18, 0x18,
-    0xAB, 0x1C, 0xDC, 0xF1, 0xB4, 0x20, 0xDA, 0xDC, 0x54, 0x10, 0x8D, 0x9C, 0x79, 0x2D, 0xB5, 0xDE,
-    0xB2, 0xC4, 0x24, 0xDE, 0x28, 0x53, 0x91, 0xFF, 0x04, 0x33, 0xB6, 0x49, 0xE3, 0x67, 0x8B, 0x07,
-    0x79, 0x71, 0xED, 0xAB, 0xA4, 0xC3, 0xCF, 0xD2, 0xF6, 0x88, 0x70, 0x04, 0x34, 0xC6, 0xAD, 0x5C,
-    0xCE, 0xF3, 0x1B, 0x66, 0x5E, 0xF0, 0x6A, 0x26, 0xF1, 0x7E, 0x4E, 0xEC, 0xBC, 0xFC, 0xCB, 0x1A,
-    0xEA, 0xA3, 0xB0, 0x01, 0x09, 0xFE, 0x7E, 0x38, 0x12, 0xD4, 0x9F, 0xDB, 0x81, 0xEB, 0xEF, 0x75,
-    0x97, 0xD6, 0xC7, 0xF7, 0x8A, 0x5E, 0x7A, 0x4B, 0xCC, 0xD4, 0xFA, 0x53, 0x46, 0x7E, 0x65, 0xC2,
-    0xF5, 0x1D, 0x3A, 0x2B, 0xB0, 0x57, 0xF6, 0x0E, 0xA1, 0x40, 0xA7, 0x15, 0xFA, 0xFB, 0xC5, 0xF8,
-    0x9F, 0x5E, 0x28, 0x0B, 0x68, 0xD2, 0x4F, 0x3D, 0xDF, 0x7D, 0x7B, 0x5B, 0x44, 0x4C, 0x2A, 0xE2,
-    0xE2, 0x5E, 0xF3, 0xDC, 0xCC, 0x87, 0xA8, 0x47, 0x11, 0x09, 0xF4, 0xC4, 0x31, 0x9B, 0x3D, 0x67,
-    0x76, 0x37, 0xB6, 0xDC, 0x3B, 0x50, 0xA9, 0x4E, 0xE3, 0xDE, 0xEB, 0x39, 0x45, 0xF3, 0x4F, 0x36,
-    0x7C, 0x40, 0xC6, 0xDC, 0x87, 0x03, 0x23, 0x0C, 0x62, 0xE8, 0xB0, 0x49, 0x26, 0xE3, 0xFD, 0x25,
-    0xB2, 0xDA, 0xFF, 0xE5, 0x31, 0xE3, 0x17, 0x90, 0x4A, 0xBF, 0x16, 0x64, 0xE6, 0x83, 0x7C, 0x1D,
-    0xD6, 0xF0, 0xC1, 0xE1, 0xF3, 0xA9, 0xF3, 0xFC, 0x0C, 0x7F, 0xFE, 0x1F, 0xF8, 0xE2, 0xCF, 0xFF,
-    0x6D, 0x7D, 0x58, 0x65, 0xDC, 0xEA, 0x03, 0xDD, 0x50, 0xB3, 0x1A, 0xA1, 0x53, 0x89, 0x23, 0x44,
-    0x00, 0x79, 0xFB, 0x10, 0xE9, 0xA7, 0x76, 0x8D, 0x5F, 0x3D, 0x20, 0x2F, 0x7E, 0xFF, 0x86, 0x19,
-    0x1E, 0x5D, 0xD2, 0x2E, 0xDD, 0xCF, 0x57, 0x57, 0x67, 0x22, 0x18, 0x47, 0x84, 0x7B, 0x6E, 0x7E,
-    0xCA, 0x2C, 0x89, 0x51, 0x09, 0x79, 0x43, 0x5E, 0xAD, 0x26, 0xD3, 0x1E, 0x9E, 0xD5, 0x60, 0x44,
-    0x37, 0xED, 0x3D, 0xCC, 0xD3, 0x3B, 0x62, 0xBC, 0xD1, 0xA5, 0x75, 0x83, 0xB3, 0x69, 0x17, 0xE4,
-    0x05, 0xEB, 0xF1, 0x50, 0xAA, 0x78, 0x93, 0x44, 0x7F, 0xCF, 0xAF, 0xDF, 0xD1, 0xCB, 0x67, 0x21,
-    0xF7, 0x15, 0xAD, 0x1D, 0x9B, 0x69, 0xE8, 0x3A, 0x87, 0x78, 0xFF, 0xCD, 0x7C, 0xF0, 0x2F, 0x52,
-    0xFD, 0x71, 0x17, 0x5F, 0xA4, 0xE9, 0x16, 0x17, 0xEE, 0x20, 0xC2, 0x4F, 0x21, 0x4A, 0x3C, 0xE5,
-    0x0A, 0x8E, 0x22, 0xA9, 0xD8, 0x6B, 0xE7, 0xB5, 0x9F, 0x5F, 0xEB, 0x58, 0xB2, 0xAE, 0x45, 0x97,
-    0x06, 0x21, 0x07, 0x7C, 0x04, 0x72, 0x06, 0x9D, 0x79, 0x40, 0x2F, 0x2C, 0x1F, 0x1C, 0xBF, 0x44,
-    0x8C, 0x60, 0x95, 0x11, 0x3F, 0x79, 0x7A, 0xC3, 0xED, 0x88, 0x8A, 0xB6, 0xDC, 0x76, 0xF0, 0xA9,
-    0x06, 0x5A, 0xD1, 0x86, 0x1A, 0x8B, 0x49, 0x0B, 0x6D, 0x34, 0x6B, 0x3F, 0xD1, 0x68, 0x50, 0x39,
-    0x68, 0x82, 0x27, 0x40, 0x56, 0xBB, 0x7A, 0x95, 0x55, 0x48, 0x49, 0xCC, 0xC2, 0xB6, 0xCB, 0x0C,
-    0x0E, 0xBD, 0xA1, 0x10, 0xE1, 0x07, 0x44, 0x04, 0xF9, 0x9B, 0x3C, 0xB6, 0xE5, 0xA0, 0x15, 0x6D,
-    0xED, 0x5C, 0x8C, 0xC4, 0xE4, 0xFD, 0xCC, 0xB0, 0x52, 0x81, 0xF2, 0x23, 0xB1, 0x57, 0xEE, 0xB7,
-    0x3F, 0x81, 0x3B, 0x31, 0x9F, 0x93, 0xAB, 0x4F, 0x9A, 0xF5, 0xF5, 0xEA, 0x06, 0xF8, 0x1B, 0xC9,
-    0xFB, 0xAB, 0xFA, 0xE0, 0x7C, 0x65, 0xB2, 0xFA, 0xB8, 0x12, 0x31, 0x90, 0x54, 0x72, 0x9A, 0xA3,
-    0x6B, 0xCF, 0x6B, 0x99, 0xD7, 0x01, 0xF3, 0xC1, 0xE3, 0x50, 0xA4, 0x13, 0x8A, 0x31, 0xC7, 0x39,
-    0x6F, 0xC9, 0xA5, 0x13, 0xDD, 0xEC, 0xAC, 0x67, 0xC7, 0x8E, 0x84, 0x5E, 0xE2, 0x26, 0xC1, 0xF0,
-    0x47, 0x02, 0x33, 0x7E, 0xF6, 0xCA, 0x70, 0x24, 0xB5, 0x9F, 0xB7, 0xAC, 0xB6, 0x6C, 0xC4, 0x48,
-    0xFF, 0xE5, 0x8A, 0xB9, 0x75, 0x2C, 0x73, 0x9B, 0x21, 0xC4, 0xF3, 0x4B, 0xD0, 0x60, 0x99, 0xDA,
-    0x81, 0x64, 0x04, 0xED, 0x1F, 0x9B, 0xCE, 0x40, 0x28, 0x4E, 0xEF, 0x99, 0xE4, 0xFC, 0x77, 0xAE,
-    0x44, 0x88, 0xD5, 0x42, 0xC8, 0x80, 0x40, 0x0E, 0x6B, 0xEF, 0x1C, 0xD5, 0x78, 0x65, 0x01, 0xAB,
-    0x91, 0xE4, 0x8C, 0x90, 0x3B, 0x2C, 0x48, 0x31, 0x21, 0x99, 0xF0, 0xAD, 0x15, 0x10, 0x5A, 0x02,
-    0x31, 0xD1, 0xD3, 0x69, 0x7E, 0x77, 0x7A, 0xF6, 0xA6, 0x78, 0x1E, 0xE0, 0x52, 0xBC, 0x5F, 0x76,
-    0x58, 0x23, 0xF2, 0x8E, 0xD2, 0x7A, 0xC5, 0x2B, 0xE2, 0xCD, 0xD1, 0x84, 0xD8, 0xBC, 0x4B, 0x30,
-    0xD5, 0x5A, 0xA7, 0x9C, 0x2E, 0xC4, 0x60, 0x62, 0xED, 0xD5, 0x48, 0xFE, 0x40, 0x3D, 0x33, 0x69,
-    0x97, 0xD1, 0x03, 0x3D, 0x8F, 0xF1, 0x35, 0x78, 0x5B, 0x93, 0xB7, 0x5E, 0x63, 0xC5, 0x13, 0x80,
-    0x68, 0xBA, 0xAF, 0x3E, 0x3B, 0x36, 0xBB, 0xA8, 0x1F, 0xA0, 0xAA, 0xBC, 0x97, 0x6E, 0xE6, 0x4F,
-    0x6C, 0x56, 0x28, 0x6B, 0xED, 0x50, 0x42, 0x63, 0xBF, 0x24, 0x84, 0xDD, 0xDA, 0x7B, 0x48, 0x00,
-    0xA1, 0x7D, 0x1A, 0x1C, 0xF3, 0x7B, 0xA5, 0x20, 0xC1, 0x6F, 0xC3, 0x2D, 0x53, 0xC3, 0x13, 0x5E,
-    0x30, 0xE7, 0xF8, 0xC6, 0x2C, 0xB1, 0x2A, 0x00, 0xA7, 0x85, 0xC3, 0x11, 0xC4, 0x60, 0xFE, 0x23,
-    0x12, 0x66, 0x12, 0xF4, 0x2D, 0x29, 0x5B, 0xF5, 0xC4, 0xC6, 0xED, 0x6F, 0xD5, 0xB0, 0x9D, 0x6B,
-    0xB5, 0xBB, 0x68, 0x76, 0x11, 0xAD, 0x94, 0xD7, 0x0F, 0x8E, 0xC6, 0x8C, 0x81, 0xA2, 0x35, 0x2E,
-    0x7C, 0x82, 0x24, 0x18, 0xE6, 0x51, 0xED, 0x9E, 0xF0, 0xE6, 0xCA, 0xA6, 0xF5, 0x9A, 0xA6, 0x0F,
-    0x5F, 0xAA, 0x3D, 0x13, 0x62, 0x29, 0x07, 0xC1, 0xD7, 0x57, 0xF4, 0xA4, 0x7B, 0xAC, 0xA7, 0x3E,
-    0xB1, 0x77, 0xB1, 0x06, 0x83, 0x84, 0xD3, 0x19, 0x16, 0x3C, 0x70, 0x7B, 0xFB, 0xB5, 0xED, 0x7D,
-    0xB7, 0x50, 0x6D, 0x35, 0x17, 0xED, 0x12, 0x96, 0xEB, 0x08, 0xEA, 0x71, 0x35, 0xEA, 0x4A, 0xD4,
-    0xEA, 0xE9, 0xE3, 0xB7, 0xA8, 0xD0, 0xF2, 0xCB, 0xFD, 0xF3, 0x2C, 0x5E, 0x68, 0x3F, 0xCC, 0x6A,
-    0x0E, 0xB6, 0x55, 0x10, 0xDD, 0x05, 0x01, 0xE2, 0xE0, 0x1D, 0xB8, 0xAF, 0xCE, 0xCA, 0xF7, 0xE3,
-    0x62, 0x20, 0x1E, 0x01, 0x59, 0x7F, 0x77, 0x7A, 0xC6, 0x30, 0x1C, 0xFB, 0x1E, 0xC1, 0xE7, 0x0F,
-    0x37, 0x7B, 0x93, 0x5C, 0x3B, 0x6D, 0x96, 0xAA, 0xEF, 0x6B, 0x25, 0x13, 0x74, 0x23, 0x7A, 0x63,
-    0xE0, 0xE9, 0xD6, 0xBA, 0x12, 0xCB, 0x52, 0x53, 0x1A, 0x18, 0x86, 0x51, 0x7C, 0x9F, 0x75, 0x44,
-    0x32, 0x7B, 0xA4, 0x3C, 0xDA, 0x81, 0xE8, 0x81, 0x93, 0x3B, 0x02, 0x30, 0xE4, 0xB1, 0x54, 0x29,
-    0xE8, 0x58, 0xDC, 0x88, 0x84, 0x68, 0x00, 0xAE, 0xD1, 0xCC, 0xB5, 0x73, 0x94, 0xC8, 0x27, 0x04,
-    0xBF, 0x22, 0x53, 0x25, 0x1C, 0x7D, 0x38, 0xC7, 0x60, 0x5F, 0x9D, 0x5F, 0xF6, 0x4A, 0xE0, 0x02,
-    0x38, 0x93, 0x39, 0xDF, 0x0D, 0xD2, 0x60, 0x90, 0xAE, 0xB3, 0xEA, 0x73, 0x26, 0x02, 0x45, 0x3D,
-    0x33, 0xAC, 0xDD, 0xDA, 0x1F, 0x94, 0xE9, 0xBE, 0x80, 0xB8, 0x37, 0x9C, 0x42, 0x8C, 0x14, 0xC1,
-    0xBC, 0x45, 0xC5, 0x6B, 0x26, 0x36, 0x6B, 0xCA, 0x02, 0x6F, 0x59, 0xD4, 0xA9, 0xCB, 0xC8, 0x87,
-    0xDE, 0x6F, 0xCD, 0x67, 0xC4, 0xA4, 0xAE, 0xC2, 0xAA, 0x66, 0x0F, 0x99, 0x2A, 0x72, 0xCD, 0x64,
-    0x2A, 0xEA, 0xC0, 0xB0, 0xC8, 0x8B, 0xC7, 0xB5, 0xE2, 0xA9, 0xCC, 0xB4, 0x1F, 0x56, 0x63, 0x5D,
-    0xF5, 0xD3, 0x75, 0xAB, 0xB5, 0xCF, 0xC7, 0xAC, 0xB3, 0xFE, 0xCB, 0x1F, 0x4D, 0xB9, 0xF6, 0x78,
-    0x78, 0x58, 0x4D, 0x19, 0xE4, 0xAB, 0xBB, 0x16, 0x37, 0x81, 0x56, 0xA0, 0x27, 0xF0, 0xF9, 0xB2,
-    0xCC, 0xA7, 0x59, 0x69, 0xF6, 0xBF, 0xE6, 0x72, 0xC2, 0x24, 0xA3, 0x31, 0x57, 0x99, 0xDD, 0xD1,
-    0x2F, 0xA7, 0x2C, 0xBF, 0x2E, 0xD6, 0x34, 0x93, 0x8E, 0xC6, 0x19, 0x14, 0x2C, 0xC2, 0x72, 0x79,
-    0x71, 0xF9, 0x26, 0x15, 0xF7, 0xDC, 0x4D, 0xBA, 0xCE, 0x30, 0x37, 0xE4, 0x44, 0xC6, 0x4E, 0x30,
-    0x56, 0x74, 0x66, 0x6C, 0x9B, 0xF0, 0xFF, 0x0A, 0x78, 0x37, 0xE5, 0xAA, 0x3D, 0x8C, 0x3C, 0x31,
-    0x41, 0xBA, 0x0C, 0x7B, 0x4C, 0x32, 0x35, 0xEE, 0x35, 0x5C, 0x61, 0xD8, 0xFA, 0xEF, 0x8E, 0xAE,
-    0x7D, 0xC5, 0xD5, 0x49, 0x5B, 0x5E, 0xA4, 0xF3, 0x4A, 0xF3, 0xAF, 0xF7, 0xEA, 0x8A, 0x29, 0x1F,
-    0xE9, 0xF0, 0x62, 0xC7, 0x58, 0x24, 0x80, 0x1B, 0x33, 0xFA, 0x03, 0x52, 0xBB, 0x7D, 0xF9, 0xB7,
-    0x80, 0xD7, 0x44, 0x2C, 0x83, 0xF2, 0x62, 0x1D, 0x35, 0x91, 0x88, 0x0C, 0x01, 0x68, 0x71, 0xCD,
-    0x94, 0x2A, 0x52, 0xED, 0x9E, 0xA5, 0xD0, 0x67, 0x51, 0xD4, 0x4B, 0xAD, 0xBD, 0x3B, 0xC9, 0xC1,
-    0xC5, 0x76, 0x4E, 0x17, 0x98, 0x15, 0xD8, 0x57, 0x67, 0xC0, 0xB4, 0xA5, 0xCD, 0x70, 0x58, 0xA1,
-    0xCB, 0xAC, 0xE0, 0xA4, 0xF1, 0xA0, 0x89, 0xCC, 0x65, 0x97, 0x5A, 0x33, 0xF7, 0x23, 0x02, 0x91,
-    0xEF, 0x2B, 0xB1, 0x40, 0xDE, 0x24, 0xEE, 0x67, 0xFD, 0xA2, 0xC1, 0x40, 0xB8, 0x51, 0x44, 0x17,
-    0x3C, 0x8F, 0x7F, 0xD2, 0x4F, 0x03, 0xEF, 0x83, 0xDC, 0x98, 0x95, 0x29, 0x38, 0x00, 0x0C, 0x88,
-    0x50, 0x8F, 0x06, 0x8B, 0xEB, 0xF4, 0x9B, 0xED, 0x7C, 0x7E, 0xA9, 0x34, 0x93, 0x49, 0xA8, 0x5B,
-    0x36, 0x61, 0x2F, 0xA0, 0xBD, 0x5D, 0xF5, 0x7E, 0x4B, 0xAE, 0x6D, 0xE9, 0x39, 0xC2, 0x7A, 0xBF,
-    0xC5, 0x0D, 0xAF, 0xEE, 0x11, 0x33, 0xF8, 0xAC, 0xCC, 0x4E, 0x4E, 0x60, 0x8D, 0x14, 0xAC, 0xFC,
-    0x47, 0x56, 0x78, 0xA7, 0x57, 0x74, 0x03, 0xAB, 0x12, 0x61, 0x19, 0xF9, 0xF6, 0x77, 0x2B, 0xB5,
-    0x0D, 0x4E, 0x2B, 0xE6, 0x00, 0x24, 0x16, 0xCC, 0xB1, 0xD2, 0x33, 0x9C, 0x5C, 0xE4, 0x21, 0x3E,
-    0xFB, 0x4F, 0x79, 0x8A, 0xB5, 0x0C, 0x81, 0xA5, 0xF8, 0x51, 0x1F, 0xB2, 0x1F, 0x52, 0x17, 0xE9,
-    0x49, 0xDE, 0xD1, 0xA3, 0xDC, 0x99, 0x39, 0x10, 0x2C, 0x97, 0x1F, 0x6B, 0xD9, 0x66, 0xED, 0xFA,
-    0x11, 0x38, 0xFF, 0x3B, 0x2B, 0x5B, 0xAD, 0x96, 0x2B, 0x32, 0xBA, 0x0B, 0xB2, 0xC4, 0x8C, 0xF9,
-    0x30, 0x33, 0x49, 0x04, 0x6C, 0x68, 0xCF, 0x41, 0xC2, 0x7A, 0x2E, 0x8F, 0x43, 0x3B, 0x8A, 0x71,
-    0xC2, 0x73, 0xD5, 0x87, 0x53, 0xF0, 0x72, 0xC9, 0xD6, 0xED, 0x63, 0xE0, 0xF4, 0x3D, 0x31, 0xE4,
-    0x12, 0x8B, 0x1A, 0x10, 0xEB, 0xBD, 0x23, 0x3A, 0x28, 0x7C, 0x51, 0x74, 0x50, 0x84, 0xD8, 0xD3,
-    0x0E, 0x16, 0x81, 0x60, 0x0B, 0x44, 0x78, 0x44, 0x5F, 0x0B, 0x42, 0xBE, 0x34, 0x8D, 0x91, 0xDD,
-    0x26, 0xD4, 0xA2, 0x17, 0x0B, 0xA1, 0xE8, 0x7A, 0x35, 0x61, 0xA7, 0x39, 0x75, 0x3E, 0x83, 0xEB,
-    0x64, 0xEF, 0x0B, 0xA4, 0xA0, 0xBD, 0x83, 0x53, 0x41, 0x2B, 0xF2, 0xBE, 0x73, 0x86, 0xE7, 0x3E,
-    0x47, 0xF8, 0xB5, 0x43, 0x90, 0x0D, 0x19, 0x88, 0x82, 0xA4, 0x91, 0x5C, 0x20, 0x88, 0x3B, 0x18,
-    0x88, 0x8B, 0xC3, 0xA1, 0xC6, 0x69, 0x59, 0x5D, 0xFF, 0x2E, 0xFB, 0x2E, 0xFD, 0xEC, 0x65, 0xD6,
-    0xAE, 0xFC, 0xF4, 0x15, 0xE6, 0x6C, 0xBC, 0x3D, 0xBA, 0x26, 0x13, 0xAC, 0x37, 0xBC, 0xCA, 0xBD,
-    0x4E, 0x7F, 0xA0, 0x46, 0xDE, 0xAB, 0xD4, 0x55, 0xF9, 0xFF, 0xA1, 0xE2, 0x2A, 0xFF, 0x37, 0x4D,
-    0x3D, 0x8D, 0x00, 0x03, 0x29, 0x4D, 0xEA, 0xF0, 0x13, 0x42, 0xDF, 0x6F, 0xAF, 0x80, 0x5E, 0x08,
-    0x59, 0x8A, 0x58, 0x10, 0x2A, 0xF8, 0x7D, 0x02, 0x82, 0xA2, 0x62, 0xE7, 0xF9, 0x60, 0x3A, 0x72,
-    0xE9, 0x81, 0x60, 0xFC, 0xEF, 0x8D, 0x4C, 0xE7, 0xED, 0x4A, 0x26, 0x83, 0x40, 0xB9, 0x1D, 0x9D,
-    0xE3, 0x25, 0xFA, 0x99, 0xBC, 0x31, 0xFA, 0xE9, 0xEB, 0xA2, 0x8E, 0x7F, 0xFA, 0x74, 0x37, 0x03,
-    0xAC, 0x90, 0xE9, 0xDD, 0xF4, 0xF2, 0x94, 0xF5, 0x52, 0x2A, 0xA5, 0xEC, 0xD1, 0xAC, 0xB1, 0xC7,
-    0x97, 0xC6, 0xD3, 0x60, 0x0F, 0x6B, 0x1B, 0xAE, 0x4C, 0x3B, 0x35, 0x08, 0x6F, 0x92, 0x3D, 0xDA,
-    0x9F, 0xCF, 0x1E, 0xD5, 0x06, 0x7B, 0x14, 0xCA, 0x1E, 0x99, 0xB2, 0x87, 0x76, 0xDB, 0x62, 0x8B,
-    0x83, 0x03, 0xF6, 0x68, 0x94, 0x3D, 0xDA, 0x65, 0x5A, 0x80, 0x7D, 0x2E, 0xA9, 0x14, 0x2A, 0xEF,
-    0x50, 0xF9, 0xFD, 0xB9, 0x48, 0xD9, 0x35, 0x06, 0x3B, 0x06, 0x77, 0x46, 0x2E, 0xA0, 0x44, 0x18,
-    0xC2, 0xBF, 0x0D, 0x0C, 0xC1, 0xF8, 0x9C, 0xE0, 0x3E, 0x88, 0xA8, 0x3E, 0xB4, 0xC5, 0x29, 0x14,
-    0x6D, 0x5D, 0xCC, 0xCE, 0x0A, 0x45, 0xB6, 0x0F, 0x9B, 0x4B, 0x42, 0x39, 0xB9, 0xE9, 0xB7, 0x45,
-    0xAB, 0x34, 0x5A, 0x70, 0xC5, 0xBD, 0xEE, 0x23, 0xB2, 0x51, 0x47, 0xE8, 0x12, 0x5F, 0xD3, 0x5E,
-    0x79, 0x0A, 0x6E, 0xD2, 0x9F, 0xA9, 0x1F, 0xA6, 0xD1, 0x9D, 0xAF, 0x9D, 0x0F, 0x98, 0x0C, 0x50,
-    0xBA, 0x93, 0x52, 0xB9, 0xCA, 0x48, 0x30, 0x80, 0x48, 0x57, 0x40, 0xBE, 0xFB, 0x51, 0x04, 0xDB,
-    0x30, 0x3F, 0xA1, 0x6C, 0xA0, 0xBE, 0x05, 0x6A, 0x0B, 0x13, 0xC9, 0x3F, 0x12, 0xDF, 0xFA, 0xEF,
-    0xB4, 0x3B, 0x60, 0xFE, 0x7A, 0x9B, 0x8B, 0x3D, 0x12, 0x0E, 0xDB, 0xC6, 0x65, 0xD4, 0x68, 0x7E,
-    0x9E, 0x2E, 0xD8, 0x44, 0x6F, 0x69, 0x8D, 0x18, 0x9B, 0xBF, 0xD0, 0x57, 0x84, 0xC2, 0x68, 0xCC,
-    0x82, 0xE6, 0x03, 0xB2, 0xAE, 0x59, 0xAD, 0x99, 0xBD, 0x3F, 0xB3, 0x24, 0x1C, 0x97, 0x1E, 0x09,
-    0x91, 0x83, 0x0B, 0x4B, 0x73, 0x84, 0xA8, 0xD3, 0xC0, 0x66, 0x77, 0xD0, 0x1C, 0xA1, 0xD1, 0x6E,
-    0x00, 0x4B, 0x73, 0x84, 0x54, 0x93, 0xB2, 0xF2, 0xCD, 0xE6, 0x08, 0xB7, 0x34, 0x4B, 0xAE, 0xA8,
-    0x59, 0xD2, 0xCF, 0xCE, 0xA6, 0x35, 0x43, 0xC4, 0xDB, 0xBC, 0xA8, 0x14, 0xF1, 0x17, 0xB3, 0x64,
-    0xB6, 0x39, 0xD2, 0x8A, 0x19, 0xCC, 0xE1, 0x5C, 0xC2, 0x50, 0xB8, 0xCA, 0x0C, 0x18, 0x1E, 0x2C,
-    0xAA, 0x87, 0x3D, 0x90, 0xD0, 0xF0, 0x68, 0x96, 0xBA, 0xA9, 0x8A, 0xE5, 0x6B, 0xE1, 0xF8, 0x2F,
-    0xE4, 0x3D, 0xB6, 0x03, 0x24, 0xC1, 0x53, 0x8E, 0xB6, 0xF3, 0xF3, 0x28, 0xBC, 0x21, 0xAA, 0xEE,
-    0xC5, 0xEC, 0x99, 0x4A, 0xEE, 0x5D, 0x70, 0x64, 0x63, 0xF2, 0xAE, 0xD0, 0x0D, 0xC9, 0xCB, 0x13,
-    0xF4, 0x75, 0xAB, 0x94, 0x93, 0x37, 0x92, 0x74, 0x5E, 0xEB, 0x68, 0xD7, 0xCC, 0xC4, 0x9B, 0xA9,
-    0x37, 0x93, 0x6F, 0xA6, 0xDF, 0xD2, 0x88, 0xC6, 0x51, 0x70, 0x26, 0xE1, 0x4C, 0xC3, 0x99, 0x88,
-    0x33, 0x15, 0x67, 0x32, 0x3A, 0x3A, 0xCE, 0x84, 0x9C, 0x29, 0xB9, 0x90, 0x92, 0x01, 0xE0, 0x0B,
-    0x0C, 0xFF, 0x32, 0x4D, 0xA4, 0xBA, 0x4C, 0xEA, 0x9C, 0x25, 0x79, 0x1E, 0x27, 0x7D, 0x8E, 0x90,
-    0x40, 0x4A, 0x21, 0x25, 0x91, 0xD2, 0x48, 0x89, 0xA4, 0x54, 0x52, 0x32, 0x29, 0x9D, 0x40, 0x5C,
-    0xAB, 0x2D, 0xE2, 0x8A, 0xD9, 0xED, 0x90, 0xBB, 0xEC, 0x07, 0x7D, 0x71, 0x45, 0x95, 0xE4, 0x02,
-    0xDF, 0x15, 0xBB, 0xBB, 0x66, 0x12, 0x5A, 0x94, 0x3E, 0xE3, 0xF8, 0x05, 0x3E, 0x2E, 0x68, 0x7E,
-    0x69, 0x52, 0xE0, 0x70, 0x64, 0x3B, 0x43, 0xC9, 0x06, 0x68, 0x52, 0x81, 0x76, 0xCE, 0xAC, 0x1A,
-    0xE6, 0x61, 0x86, 0xA3, 0xEB, 0xBE, 0x11, 0x4C, 0xAE, 0x50, 0x3D, 0xB0, 0xAE, 0x54, 0x9D, 0x2F,
-    0x80, 0x5C, 0x02, 0x6B, 0xD6, 0x20, 0xE6, 0x15, 0xD4, 0x9A, 0xA3, 0x84, 0xBE, 0x93, 0xFF, 0xC3,
-    0x19, 0x1F, 0xB9, 0x5C, 0x9C, 0x23, 0x6E, 0x46, 0x8A, 0x38, 0xD5, 0xAE, 0xE7, 0xE9, 0x25, 0xEE,
-    0xCC, 0xD4, 0xBD, 0x72, 0xD1, 0xBD, 0xA9, 0x5C, 0x80, 0x85, 0x03, 0xA0, 0x7B, 0x17, 0x5C, 0x97,
-    0x27, 0xED, 0xF6, 0x47, 0xE3, 0x97, 0xA3, 0xD1, 0x44, 0x43, 0x98, 0xF4, 0x93, 0x4B, 0x63, 0x42,
-    0xB6, 0xA3, 0xD0, 0x0C, 0xA1, 0x8D, 0x70, 0x40, 0x1A, 0x53, 0x30, 0x21, 0xD7, 0x17, 0x69, 0x4C,
-    0xB0, 0x92, 0x91, 0x9D, 0xEE, 0xDB, 0xB2, 0x82, 0xE9, 0x85, 0xC2, 0xA2, 0x1B, 0xBB, 0x3C, 0xAC,
-    0xD8, 0x0C, 0x24, 0x66, 0x01, 0x5C, 0x5C, 0xB1, 0xE1, 0x93, 0x55, 0x5C, 0x72, 0x10, 0x26, 0x8D,
-    0x95, 0x33, 0xDE, 0xD4, 0xD4, 0x95, 0xD3, 0x73, 0x00, 0x4C, 0x84, 0x0D, 0x37, 0x27, 0x17, 0xC3,
-    0x46, 0x16, 0x15, 0xA1, 0x17, 0xC2, 0x18, 0x75, 0x68, 0xB2, 0x15, 0x75, 0xE8, 0x8C, 0x20, 0x00,
-    0x19, 0x31, 0x64, 0x19, 0x91, 0x1C, 0x0E, 0xF1, 0x01, 0xD8, 0x3C, 0xFF, 0x07, 0x39, 0x96, 0x34,
-    0x98, 0x53, 0xFC, 0x16, 0x8C, 0xF9, 0xE8, 0x6D, 0xB0, 0xF8, 0xCA, 0xA2, 0x13, 0xC9, 0x55, 0x5B,
-    0xE0, 0x34, 0x5B, 0x38, 0x9E, 0x8E, 0x1E, 0xB3, 0x07, 0x70, 0xAB, 0xD0, 0x36, 0x31, 0xBE, 0xCB,
-    0x9F, 0x3C, 0x6D, 0xE2, 0x86, 0xA9, 0xA3, 0xE5, 0x97, 0xAB, 0xFC, 0xC5, 0x29, 0x42, 0x32, 0x41,
-    0xD4, 0x96, 0x8F, 0x0C, 0x71, 0x63, 0x1F, 0xE5, 0xD0, 0xA7, 0x35, 0x33, 0x36, 0xF2, 0x97, 0x07,
-    0x11, 0xCB, 0xDF, 0x45, 0x21, 0xF7, 0x44, 0x37, 0x25, 0x9B, 0xE0, 0x64, 0x17, 0x8B, 0x3B, 0xE5,
-    0x7D, 0xF5, 0xF0, 0x8E, 0x30, 0x5B, 0xD9, 0x73, 0xBB, 0xAE, 0x9A, 0x56, 0x63, 0x39, 0x4B, 0x20,
-    0x5C, 0x01, 0x34, 0x86, 0x5F, 0xE9, 0xE7, 0xF7, 0xB9, 0x64, 0xF9, 0x0F, 0xE8, 0x7D, 0x95, 0xDF,
-    0xB5, 0x51, 0x86, 0x7D, 0x63, 0xB9, 0xEA, 0x29, 0x07, 0x48, 0x90, 0x43, 0x12, 0x17, 0xE6, 0x50,
-    0xCE, 0x5E, 0x5B, 0x37, 0xB5, 0x06, 0x89, 0x44, 0x83, 0x27, 0x62, 0x80, 0xA1, 0x35, 0xC8, 0x83,
-    0xC2, 0x66, 0x6C, 0x0D, 0x52, 0x7C, 0x7A, 0xB3, 0x01, 0xD9, 0xCD, 0x0D, 0x42, 0x3E, 0xA0, 0x19,
-    0xBD, 0xA5, 0xCA, 0xC4, 0xDA, 0xB5, 0x86, 0x85, 0xE9, 0x5A, 0x01, 0xFE, 0xCE, 0x9A, 0x87, 0x70,
-    0xFB, 0x46, 0xCF, 0xDB, 0x89, 0x67, 0x43, 0xE4, 0x25, 0xA4, 0x63, 0x3A, 0x45, 0x48, 0x3A, 0x79,
-    0xC7, 0xFE, 0xBA, 0xF0, 0x9A, 0xFD, 0x1A, 0x0A, 0xDB, 0x42, 0xEB, 0x5B, 0xC1, 0x06, 0xAB, 0x11,
-    0x2E, 0x15, 0xC4, 0xE8, 0x26, 0xCA, 0x68, 0x97, 0xDD, 0xA0, 0x69, 0x0D, 0xAD, 0x56, 0xA6, 0x34,
-    0x2B, 0xAD, 0x4C, 0xE1, 0x6F, 0x53, 0xCD, 0x84, 0x40, 0x41, 0x53, 0x30, 0x1D, 0xC5, 0xC1, 0x08,
-    0x6C, 0xAF, 0x25, 0x77, 0xFD, 0x86, 0xF5, 0xD2, 0xAE, 0x6B, 0x8E, 0x55, 0xB3, 0xD6, 0x7C, 0xC3,
-    0xB5, 0xDB, 0x30, 0xFF, 0x1E, 0x0D, 0xEE, 0xD8, 0xEC, 0xE4, 0x7C, 0x22, 0x4A, 0x62, 0x42, 0x63,
-    0x0D, 0xC8, 0x2B, 0x6D, 0x3E, 0xC6, 0xFC, 0x3B, 0x6D, 0x76, 0x72, 0x72, 0x69, 0x76, 0x52, 0x56,
-    0x44, 0x6D, 0x2F, 0xD3, 0x9F, 0xF1, 0x57, 0xEC, 0xF2, 0xF1, 0xA6, 0x99, 0xD3, 0xD2, 0x7E, 0x4E,
-    0xD7, 0x38, 0x22, 0xA0, 0xFB, 0xD8, 0x6A, 0x25, 0x21, 0x3D, 0x4F, 0x3C, 0x63, 0x9E, 0x80, 0xAF,
-    0xD3, 0x39, 0xC5, 0x50, 0x1A, 0x88, 0x21, 0xC1, 0xF1, 0x3E, 0x09, 0x4F, 0xE5, 0x0E, 0x0E, 0xCA,
-    0x59, 0x90, 0x1D, 0xF9, 0x38, 0x50, 0x43, 0xB4, 0x1A, 0x2D, 0x10, 0x87, 0xFD, 0x3D, 0x43, 0x4F,
-    0x9F, 0x0B, 0x6D, 0xE7, 0x4B, 0x12, 0xCC, 0xD2, 0x34, 0xD5, 0xAC, 0x05, 0x0A, 0xAE, 0x80, 0x09,
-    0x98, 0xC4, 0x75, 0x5B, 0x17, 0xAC, 0x8D, 0x5C, 0x19, 0x76, 0x39, 0xB4, 0x3B, 0xCB, 0xE9, 0x5F,
-    0xDC, 0x82, 0xD9, 0x58, 0xEE, 0x84, 0x45, 0x46, 0xCB, 0xBB, 0x2D, 0x58, 0x36, 0x7B, 0x74, 0x9D,
-    0x5A, 0x56, 0x6C, 0xC6, 0x54, 0xB1, 0x79, 0xB1, 0xAD, 0x03, 0xED, 0xD0, 0xB3, 0xD2, 0x4E, 0x2D,
-    0x04, 0x6F, 0x49, 0x7F, 0x59, 0x0B, 0x97, 0xDA, 0xB5, 0x32, 0xA6, 0x60, 0xEE, 0xD4, 0xA2, 0x59,
-    0x90, 0xAA, 0xEB, 0x62, 0xFD, 0xDD, 0x59, 0xE6, 0x9E, 0x7B, 0xDA, 0xA9, 0x25, 0xAC, 0x12, 0x6D,
-    0xC1, 0x45, 0x49, 0x73, 0x96, 0xA0, 0x56, 0x8C, 0x49, 0xB4, 0xF8, 0x15, 0xA3, 0x75, 0x57, 0x74,
-    0x44, 0x8A, 0x4E, 0x2D, 0xB7, 0x32, 0x7D, 0xC2, 0xCD, 0xCB, 0x86, 0x05, 0xA4, 0x85, 0x76, 0xFE,
-    0x33, 0x62, 0x81, 0x20, 0xF2, 0x86, 0xCC, 0xB2, 0x08, 0xB0, 0x3B, 0xEA, 0xD1, 0x3B, 0x62, 0x62,
-    0xE3, 0x8C, 0x62, 0xBD, 0x76, 0x9C, 0xFF, 0x8C, 0xC0, 0x0A, 0x3B, 0xD8, 0x86, 0x4B, 0x48, 0x03,
-    0x40, 0x16, 0x6E, 0x22, 0x90, 0x2F, 0xCB, 0x33, 0x56, 0xC2, 0x99, 0x68, 0x31, 0x7D, 0x16, 0x37,
-    0xAA, 0x9A, 0x3E, 0x9D, 0x9A, 0x3E, 0x10, 0x34, 0xD7, 0x64, 0xB2, 0x10, 0x35, 0x6F, 0x89, 0xB9,
-    0x1E, 0x3D, 0x65, 0x7D, 0xA4, 0xA5, 0xC7, 0x82, 0xB5, 0x91, 0xA3, 0xFE, 0xA0, 0x18, 0x61, 0xE8,
-    0x1F, 0xF0, 0x80, 0x80, 0x1C, 0x34, 0x55, 0xD0, 0xEE, 0x60, 0x8D, 0x0A, 0x16, 0x00, 0x15, 0x88,
-    0x16, 0x28, 0x4C, 0x1C, 0x89, 0xD2, 0xA5, 0xC5, 0xB9, 0x16, 0x06, 0xE4, 0x50, 0x36, 0xAF, 0xCA,
-    0x78, 0xD5, 0x4C, 0xD1, 0x46, 0x97, 0x90, 0xD6, 0x4A, 0xF1, 0xBC, 0x52, 0x79, 0x55, 0x56, 0xAA,
-    0xEC, 0x34, 0xD7, 0x91, 0x5E, 0x12, 0xE4, 0x08, 0x69, 0xF6, 0x9C, 0x53, 0xBB, 0x2E, 0x97, 0x69,
-    0xA6, 0xE6, 0x6C, 0x49, 0xCE, 0xA6, 0xE4, 0x42, 0xC9, 0xB5, 0xB8, 0xCB, 0x7D, 0x7B, 0x7B, 0xCF,
-    0xDC, 0x77, 0x0E, 0x68, 0x3F, 0x6D, 0x4E, 0xC5, 0x6D, 0x97, 0xD6, 0xDB, 0x49, 0xDB, 0xE5, 0xD5,
-    0xE3, 0x69, 0x23, 0x88, 0xF9, 0x48, 0x5A, 0x9F, 0x2E, 0x0B, 0x97, 0x4C, 0x94, 0x73, 0x2C, 0x9D,
-    0xA7, 0x4A, 0xC1, 0x04, 0x13, 0x55, 0x18, 0x8A, 0xB1, 0xE6, 0x7F, 0x60, 0xFC, 0xC1, 0x6B, 0xD3,
-    0x51, 0xD9, 0x5C, 0xB0, 0x5C, 0xDE, 0xA3, 0x74, 0xCA, 0x13, 0xC5, 0xF7, 0xDC, 0x81, 0x1C, 0x52,
-    0x31, 0xC4, 0x0C, 0x73, 0x6E, 0x8D, 0x89, 0xB4, 0x1F, 0xCD, 0xB3, 0xD0, 0x14, 0x6C, 0x2C, 0x87,
-    0xAE, 0x3D, 0xAB, 0x69, 0xAD, 0xDE, 0x64, 0x69, 0x74, 0xD3, 0xBA, 0x76, 0xBE, 0xDA, 0xCC, 0x77,
-    0x69, 0xDC, 0x8D, 0xB4, 0x41, 0x79, 0x54, 0x45, 0xC4, 0x56, 0xA1, 0x03, 0x06, 0xE8, 0xFB, 0xDB,
-    0xD9, 0x4D, 0x4D, 0xAD, 0xFC, 0x75, 0xE9, 0xCF, 0xF1, 0x22, 0x22, 0x85, 0x9E, 0x2B, 0x14, 0x51,
-    0xEF, 0x8C, 0x3A, 0xF7, 0x95, 0x03, 0xD5, 0x33, 0xA5, 0x6C, 0x18, 0x16, 0x6B, 0xE0, 0xFA, 0x5C,
-    0x8A, 0x5C, 0x7F, 0x40, 0x86, 0x2A, 0x98, 0x11, 0x36, 0x4C, 0xD6, 0xB9, 0x88, 0x62, 0x08, 0x51,
-    0x9B, 0x53, 0x02, 0x60, 0xBD, 0x2D, 0x0F, 0x7A, 0x96, 0x3B, 0x17, 0x2C, 0x39, 0x71, 0xE1, 0x78,
-    0xC4, 0x9D, 0x4A, 0x8F, 0x7C, 0x76, 0x03, 0xB8, 0xC6, 0x14, 0x08, 0xAE, 0x29, 0x9F, 0xBD, 0x0B,
-    0xEF, 0xB3, 0x2B, 0xD0, 0x3D, 0x24, 0xD6, 0x03, 0x24, 0xD6, 0x36, 0xBB, 0x02, 0x7D, 0x8E, 0x5D,
-    0x81, 0x3E, 0xCB, 0xAE, 0x40, 0x76, 0xAD, 0x2B, 0x50, 0x47, 0x21, 0xD9, 0xB0, 0x03, 0x6F, 0xCD,
-    0xC2, 0x03, 0xDA, 0xA8, 0xFE, 0x8B, 0xB7, 0xEC, 0x0A, 0xF4, 0x1E, 0xB5, 0xA1, 0xBF, 0x05, 0x57,
-    0xF7, 0x0F, 0x51, 0x1B, 0xFA, 0x1A, 0x0E, 0xB8, 0x9D, 0x6B, 0x43, 0x7F, 0x17, 0x79, 0xBE, 0xC1,
-    0xD3, 0xF0, 0xDD, 0x7F, 0xE1, 0xD6, 0xB5, 0xA1, 0x46, 0x0D, 0x1B, 0x26, 0x20, 0xBB, 0x1F, 0xBE,
-    0xBB, 0x42, 0x46, 0x40, 0x20, 0xDE, 0x77, 0x2D, 0x23, 0xD1, 0x83, 0xE5, 0xBA, 0xEF, 0xBA, 0x1F,
-    0x57, 0xDA, 0xB9, 0x99, 0xBC, 0x59, 0x69, 0xD7, 0x66, 0x82, 0x5E, 0x18, 0x01, 0xDE, 0x8D, 0xBE,
-    0xD4, 0x2B, 0x09, 0x98, 0x8B, 0xCD, 0xA1, 0x54, 0x84, 0x1D, 0x58, 0xD5, 0xF5, 0x2D, 0x34, 0xC7,
-    0xC3, 0xE0, 0xE7, 0x04, 0x77, 0xF8, 0x43, 0x60, 0xFB, 0x1A, 0xED, 0x9E, 0x0B, 0x32, 0xFE, 0x52,
-    0x30, 0x73, 0x10, 0xC1, 0xF1, 0xA7, 0x8D, 0x6A, 0x35, 0xB6, 0xD8, 0x42, 0xD5, 0x4C, 0x1D, 0x88,
-    0xE1, 0x51, 0x79, 0x07, 0x55, 0x33, 0x73, 0x1B, 0x35, 0x6D, 0x70, 0xD7, 0xCC, 0x29, 0x4E, 0x64,
-    0x1F, 0x12, 0x16, 0x7C, 0xB2, 0x1A, 0x4E, 0xD1, 0x16, 0xB8, 0xCC, 0x2A, 0x98, 0x01, 0x15, 0x8C,
-    0x55, 0x59, 0x5E, 0x13, 0x9C, 0x9D, 0x68, 0x3B, 0x99, 0xF2, 0x6F, 0xCC, 0xD2, 0x39, 0x77, 0x7D,
-    0xCC, 0xE7, 0x06, 0xB9, 0x9E, 0xD1, 0xBE, 0x6A, 0x42, 0xF5, 0x87, 0x4A, 0xE3, 0xB6, 0x85, 0xC2,
-    0x77, 0x0E, 0xD8, 0xA1, 0x74, 0x0D, 0xDA, 0x40, 0xDE, 0xF4, 0xC8, 0xC0, 0xFE, 0x01, 0xC9, 0x23,
-    0x43, 0x30, 0xA4, 0xA8, 0x9F, 0x4E, 0x91, 0x33, 0x99, 0xD8, 0xB7, 0x80, 0x4E, 0xD8, 0xC9, 0xF6,
-    0x6F, 0xE6, 0x8E, 0xA5, 0x54, 0x68, 0xC2, 0x56, 0x05, 0x1C, 0x64, 0x38, 0x6C, 0x44, 0x6F, 0xE3,
-    0x66, 0x17, 0xFC, 0x8F, 0x6B, 0x79, 0xEA, 0xFD, 0x56, 0x17, 0xAF, 0xF6, 0x58, 0xD3, 0x88, 0x9D,
-    0x3B, 0xC7, 0xD5, 0xC6, 0x39, 0xBE, 0xBD, 0x24, 0xB0, 0xE3, 0xFC, 0x1B, 0xE6, 0xB5, 0x44, 0x4B,
-    0x24, 0xE7, 0xB8, 0x2B, 0xFA, 0x3D, 0x28, 0xB5, 0xC8, 0xD5, 0x3A, 0xBE, 0x65, 0xBD, 0xDB, 0xDC,
-    0x53, 0x3E, 0x79, 0xF7, 0x9E, 0xF2, 0xC6, 0x95, 0xCE, 0x69, 0x2D, 0x44, 0xB7, 0x09, 0x34, 0x2F,
-    0xB9, 0xC0, 0xB6, 0x37, 0x38, 0xAF, 0xBA, 0xB1, 0x17, 0x0F, 0x72, 0x88, 0xCC, 0x4D, 0x5D, 0x45,
-    0xCD, 0x3F, 0xF8, 0x66, 0xB2, 0x9E, 0x3B, 0x56, 0xB1, 0x4B, 0x9D, 0x4A, 0x35, 0xC0, 0x60, 0x92,
-    0xAB, 0xCD, 0x7A, 0x4B, 0xB9, 0xCD, 0x8A, 0x97, 0xBB, 0xA6, 0x7F, 0xCB, 0xED, 0xF2, 0x47, 0xAB,
-    0x7B, 0x8D, 0xC1, 0x25, 0x17, 0x5D, 0x72, 0xE1, 0xA5, 0xB9, 0x6F, 0x99, 0x06, 0x98, 0x5C, 0x84,
-    0x49, 0xC5, 0xA2, 0x93, 0x8B, 0x60, 0xA4, 0x40, 0x4B, 0x6A, 0x54, 0x29, 0xAA, 0x91, 0xC5, 0x38,
-    0x13, 0xDA, 0xD3, 0x02, 0xCC, 0x05, 0xDA, 0x8F, 0x4C, 0x43, 0x4D, 0x8B, 0xC1, 0xEF, 0x82, 0x4D,
-    0x4A, 0xD9, 0xF7, 0xE5, 0x96, 0x9E, 0x04, 0xB3, 0x4D, 0x82, 0x15, 0xA3, 0x6E, 0x85, 0xBC, 0xEC,
-    0x60, 0x70, 0xF2, 0xB2, 0xD1, 0x48, 0xEA, 0xB4, 0xA6, 0x54, 0x0F, 0x3E, 0xD2, 0x20, 0x42, 0x2F,
-    0x91, 0x04, 0x0D, 0xB3, 0x12, 0xF8, 0x50, 0x23, 0xED, 0x0A, 0xB5, 0x30, 0x18, 0xDC, 0x7A, 0xFB,
-    0x2C, 0xAD, 0xF0, 0x09, 0xC0, 0x50, 0xD5, 0xD9, 0xE8, 0xA5, 0xD6, 0x90, 0x13, 0xC3, 0xE5, 0x99,
-    0xA2, 0x0D, 0x75, 0x12, 0x1D, 0x57, 0x11, 0xFF, 0xA0, 0xA2, 0xE5, 0x6D, 0x85, 0x07, 0x8F, 0x2B,
-    0x3E, 0x50, 0xCF, 0x82, 0xD7, 0x68, 0x17, 0xA9, 0x9A, 0xCC, 0x19, 0x54, 0x6A, 0x3A, 0x43, 0xBD,
-    0x9B, 0x5F, 0x4D, 0x78, 0x5C, 0x9F, 0x1C, 0x88, 0xFA, 0xF3, 0xCE, 0x2F, 0xA7, 0xF3, 0xF4, 0x24,
-    0x3B, 0xBD, 0xE2, 0x37, 0xEB, 0x4D, 0xFD, 0x1C, 0x16, 0x8B, 0x37, 0xBA, 0x9B, 0x3F, 0xBF, 0xC6,
-    0x8A, 0x21, 0x30, 0x48, 0x82, 0xF7, 0x3E, 0xC1, 0xDE, 0x32, 0x58, 0x03, 0x52, 0x1C, 0x7D, 0xD7,
-    0x5B, 0x46, 0x24, 0x4C, 0x96, 0xBB, 0xB6, 0x32, 0xF7, 0x62, 0xDE, 0x9C, 0x35, 0xE6, 0xFC, 0xFB,
-    0x97, 0x64, 0xD8, 0x17, 0xE1, 0xF9, 0x1B, 0x68, 0x0D, 0x3D, 0xE6, 0x85, 0x56, 0x22, 0x1D, 0xEA,
-    0x36, 0xD1, 0x44, 0x35, 0x67, 0xD9, 0xA5, 0x77, 0x89, 0x87, 0xD3, 0xA8, 0x87, 0xD3, 0x53, 0xA6,
-    0xF3, 0x9D, 0x5D, 0x31, 0x51, 0x43, 0x86, 0xCE, 0x66, 0xC0, 0x45, 0x5B, 0xE4, 0x99, 0xC9, 0x95,
-    0x21, 0x5E, 0xE5, 0x66, 0xC5, 0x4E, 0xE4, 0x1D, 0xFD, 0xE8, 0x8E, 0xCE, 0xD5, 0xB0, 0xF4, 0x4B,
-    0xEF, 0x58, 0x74, 0xBB, 0x56, 0x4D, 0x7E, 0x98, 0x75, 0xB6, 0xA0, 0x79, 0xFA, 0x10, 0xDD, 0x80,
-    0x83, 0x4B, 0x18, 0xBD, 0x7B, 0xFC, 0xC3, 0x1F, 0x3E, 0x6D, 0xE5, 0x0E, 0xF8, 0x87, 0x7F, 0xB9,
-    0x9E, 0x35, 0x2C, 0x59, 0x2D, 0x59, 0xB2, 0x9C, 0x87, 0x99, 0xE7, 0x3E, 0x56, 0x74, 0xCF, 0x6C,
-    0x27, 0x8D, 0x36, 0xBA, 0xA6, 0x9B, 0xEB, 0xD8, 0xFE, 0xC0, 0xC2, 0x7C, 0x1F, 0xE8, 0x3E, 0x7B,
-    0x17, 0x74, 0xBF, 0xF1, 0x29, 0x2C, 0x5E, 0xC9, 0x18, 0x34, 0xCA, 0xA5, 0xFA, 0x79, 0x07, 0xC2,
-    0x25, 0x6D, 0xE7, 0xC0, 0xE8, 0x74, 0xB4, 0x29, 0x58, 0x49, 0x9E, 0xD3, 0x3C, 0xEF, 0x58, 0x7F,
-    0xC7, 0xDA, 0x4F, 0x39, 0xD6, 0x39, 0x40, 0x82, 0x80, 0x1F, 0x18, 0xA5, 0xAB, 0x8B, 0x8D, 0xF7,
-    0x63, 0x30, 0xD4, 0x6E, 0xC3, 0x7E, 0xD1, 0x51, 0xDC, 0xAE, 0x00, 0xB4, 0xE3, 0xB8, 0x8D, 0xC0,
-    0x5A, 0x27, 0xA3, 0xF6, 0x24, 0xF8, 0x77, 0x27, 0xEA, 0xB6, 0x13, 0xF6, 0x8B, 0xEE, 0x2E, 0xF1,
-    0xBA, 0xEA, 0x99, 0x39, 0x7D, 0x76, 0xF5, 0x0E, 0xEB, 0xDE, 0x2F, 0x85, 0x96, 0x0E, 0xD2, 0x2E,
-    0xB4, 0x94, 0x8A, 0x6D, 0xA0, 0x49, 0x9C, 0x5A, 0x51, 0x23, 0x5C, 0x13, 0x30, 0xA5, 0x26, 0xD9,
-    0x0F, 0x5A, 0xE5, 0x32, 0xBF, 0x59, 0xD8, 0x6C, 0x49, 0x86, 0x3B, 0xBB, 0x19, 0x65, 0xF6, 0xE7,
-    0xD8, 0x72, 0xB3, 0x69, 0x82, 0x6A, 0x26, 0xAD, 0x6B, 0x77, 0x55, 0x69, 0xBB, 0xAB, 0x5A, 0xDB,
-    0x5D, 0xD5, 0x81, 0x66, 0x99, 0xAF, 0x64, 0x79, 0xC1, 0xEB, 0x0D, 0xDB, 0x5D, 0xFD, 0x69, 0x8B,
-    0x76, 0x57, 0xAB, 0x2F, 0xB4, 0xCF, 0x21, 0x4C, 0x15, 0xBD, 0x85, 0xFC, 0xDD, 0xE3, 0xD1, 0xDB,
-    0xA8, 0x8A, 0x7B, 0x60, 0x65, 0x71, 0x12, 0xB7, 0x43, 0x24, 0xD7, 0x7E, 0xE5, 0xB9, 0x10, 0x8D,
-    0x69, 0xF6, 0xDB, 0xA0, 0x0B, 0xEC, 0x3D, 0x68, 0x37, 0xEB, 0xDB, 0xA1, 0xC4, 0xA6, 0x96, 0xAE,
-    0x5B, 0xC7, 0x86, 0x2C, 0x0E, 0x37, 0x64, 0x71, 0xB2, 0x21, 0x8B, 0xEF, 0x1C, 0x2A, 0x3B, 0x42,
-    0x72, 0xFD, 0x01, 0x64, 0x17, 0x43, 0x34, 0xF9, 0x9B, 0x95, 0x66, 0x56, 0xDE, 0x80, 0x96, 0xB5,
-    0x58, 0xC0, 0x79, 0x8C, 0xB4, 0x4A, 0x83, 0x77, 0xF0, 0xAF, 0x92, 0x77, 0x5E, 0x21, 0x60, 0xFA,
-    0x13, 0xA2, 0x25, 0x32, 0xD8, 0x8E, 0x0A, 0x49, 0x72, 0x1C, 0x5C, 0x80, 0xB2, 0x4A, 0xCE, 0x7C,
-    0xFF, 0x5B, 0xD3, 0x12, 0xB6, 0xE0, 0x64, 0x4E, 0xF1, 0x68, 0x5C, 0xE6, 0x31, 0x61, 0xB5, 0x5C,
-    0xD0, 0xB1, 0xCF, 0x21, 0x3E, 0xD6, 0xE2, 0x4A, 0x8E, 0x5E, 0x9D, 0xBD, 0xD6, 0xB6, 0xD7, 0x61,
-    0x66, 0x56, 0x28, 0x4D, 0x0F, 0xA7, 0x61, 0x56, 0xAE, 0x07, 0x1F, 0x12, 0xB3, 0x35, 0xFD, 0x26,
-    0xB3, 0x5E, 0x32, 0x0F, 0x9D, 0xC6, 0xD8, 0x63, 0xE5, 0x20, 0x65, 0x8D, 0x1D, 0xB2, 0x9C, 0x0C,
-    0x99, 0x7B, 0x0F, 0x6A, 0x96, 0x18, 0x7A, 0x71, 0x97, 0xC5, 0xC5, 0xD6, 0xE4, 0xDF, 0x7B, 0xB5,
-    0x93, 0x67, 0x7D, 0x41, 0x90, 0xDD, 0x88, 0x93, 0x99, 0xAD, 0x61, 0x31, 0xAF, 0xC7, 0xA6, 0xF8,
-    0x03, 0x0A, 0x4F, 0x64, 0xC4, 0xD1, 0x6C, 0x57, 0xC5, 0x8D, 0x29, 0x99, 0x1F, 0x27, 0x7D, 0xF8,
-    0x68, 0xCF, 0xD9, 0x08, 0x3A, 0x3C, 0xE8, 0x35, 0xEB, 0xD3, 0xBB, 0x43, 0xF4, 0x59, 0xB9, 0x4A,
-    0xB5, 0xF9, 0xEA, 0xBF, 0xDE, 0x53, 0x9A, 0x86, 0x62, 0x57, 0xE3, 0xF4, 0xA1, 0xC2, 0x15, 0xD7,
-    0x1D, 0x61, 0xCB, 0xCF, 0x00, 0xFB, 0x2B, 0x81, 0x3C, 0x6D, 0x71, 0x31, 0xE3, 0x1F, 0x11, 0x36,
-    0x39, 0x5D, 0xD7, 0x82, 0xDC, 0x79, 0x3D, 0xEB, 0x92, 0xA4, 0xAE, 0x9F, 0xE1, 0x35, 0xD0, 0x42,
-    0x09, 0xB3, 0xFA, 0xFE, 0xBF, 0xB1, 0x8A, 0xA3, 0x7D, 0xF6, 0x3D, 0xD8, 0xA1, 0x6A, 0xAB, 0xE5,
-    0x7C, 0xA3, 0x3B, 0x68, 0xE5, 0x77, 0xAC, 0x05, 0x07, 0x6D, 0x2E, 0x6A, 0xA1, 0xBA, 0xA7, 0x15,
-    0x91, 0x5B, 0x13, 0xFA, 0xF9, 0xC8, 0xF2, 0x7F, 0x6C, 0xA1, 0x9B, 0x60, 0x27, 0x67, 0x01, 0xFB,
-    0x64, 0x14, 0x54, 0x24, 0xCC, 0x72, 0x9F, 0xD8, 0xA3, 0x94, 0x15, 0x0A, 0x50, 0x1D, 0xBB, 0xE8,
-    0x9B, 0xBA, 0x62, 0xBF, 0xCB, 0x22, 0x1A, 0x4F, 0xE3, 0x00, 0xD1, 0x81, 0x2A, 0xB7, 0x65, 0xC7,
-    0xDC, 0xE2, 0x7F, 0x0D, 0xB2, 0xA2, 0xFC, 0x7B, 0x2F, 0x5B, 0xF3, 0x9C, 0x48, 0xC2, 0x87, 0x20,
-    0xC2, 0xA3, 0x51, 0xB3, 0xBE, 0xB3, 0x75, 0x24, 0x1F, 0xA1, 0xC1, 0xA0, 0x76, 0x18, 0xD4, 0x16,
-    0x83, 0x73, 0xED, 0xC9, 0x17, 0x6F, 0xFC, 0xE0, 0xBA, 0x1B, 0x92, 0xB6, 0xE2, 0xB5, 0xCF, 0x3A,
-    0xF9, 0x67, 0xB7, 0xF4, 0xFC, 0x6B, 0x8C, 0x6D, 0x8E, 0xB4, 0xBD, 0x5B, 0xCA, 0x19, 0xE7, 0x6E,
-    0xE8, 0xC2, 0xD3, 0x0F, 0x8E, 0x09, 0x1B, 0x6A, 0xF8, 0x9A, 0x8D, 0xE3, 0x2B, 0x4E, 0x77, 0x55,
-    0xAD, 0x4C, 0x54, 0x3F, 0x28, 0x13, 0xEC, 0x28, 0xD2, 0x97, 0x93, 0xB5, 0xC5, 0x8F, 0x6E, 0x71,
-    0xF1, 0x11, 0xD4, 0xA6, 0x47, 0xC8, 0x8B, 0x64, 0x57, 0xA6, 0xFC, 0x2F, 0x90, 0x58, 0x29, 0x4C,
-    0xF2, 0xFD, 0x9B, 0xE3, 0x23, 0xF1, 0x1C, 0x1F, 0x39, 0xB4, 0x54, 0x22, 0xB0, 0x54, 0x07, 0x3F,
-    0x1E, 0x1F, 0x13, 0x59, 0x28, 0x0F, 0x6F, 0x7C, 0x77, 0x5E, 0xE2, 0x6E, 0xC9, 0xF3, 0x5C, 0x06,
-    0xA1, 0xF5, 0x16, 0x40, 0x48, 0xB9, 0x5F, 0xA2, 0xD2, 0x2C, 0xE5, 0xE7, 0xC8, 0x34, 0x6C, 0x71,
-    0x4D, 0x0F, 0x8A, 0xAB, 0x73, 0xA1, 0x9E, 0x47, 0x9F, 0x97, 0x7D, 0xF6, 0x7C, 0x5F, 0xFA, 0x67,
-    0x1E, 0xBB, 0x8E, 0x64, 0x88, 0x2A, 0xB8, 0x26, 0x50, 0x3F, 0x8B, 0x7A, 0xCF, 0xCC, 0x99, 0x80,
-    0xF2, 0x7D, 0x0C, 0xD9, 0x75, 0x6F, 0xA2, 0xF4, 0x11, 0x3D, 0x43, 0x5B, 0x94, 0xC5, 0xA2, 0x24,
-    0x16, 0xF5, 0xCC, 0xC9, 0xDB, 0x70, 0x11, 0xD5, 0x6B, 0xDB, 0x17, 0xB4, 0x62, 0x2B, 0x87, 0xC8,
-    0x78, 0xE2, 0xE0, 0x37, 0xF1, 0x46, 0x79, 0xC5, 0x2F, 0x74, 0x51, 0xDC, 0x61, 0x61, 0xF2, 0x5C,
-    0xF4, 0x35, 0xBE, 0xD7, 0x8F, 0xF8, 0x6D, 0x5B, 0xF0, 0x2C, 0xF2, 0x9C, 0x5F, 0x56, 0xA5, 0x9E,
-    0x59, 0x04, 0x1F, 0xC4, 0xD5, 0x4D, 0xB2, 0xEF, 0x1F, 0x85, 0x91, 0xBE, 0x9C, 0xD7, 0x4A, 0x2D,
-    0x1F, 0x74, 0xA2, 0xD2, 0xAB, 0x46, 0x8E, 0xA3, 0xEC, 0xF1, 0x5B, 0xD5, 0x03, 0xDE, 0x25, 0x46,
-    0xFA, 0x81, 0xA2, 0x0A, 0x86, 0x58, 0xB0, 0x4A, 0x1F, 0xA3, 0x8E, 0x7B, 0xB5, 0xAE, 0xC1, 0x7F,
-    0xB1, 0x9F, 0x67, 0x43, 0x13, 0x52, 0xC0, 0xAC, 0x0D, 0xE5, 0x29, 0x61, 0x2B, 0x96, 0xEB, 0x41,
-    0x46, 0xFA, 0x6D, 0xE8, 0x08, 0xAB, 0x0D, 0xCE, 0x38, 0xE4, 0x10, 0x65, 0xCF, 0x9F, 0xD9, 0xC5,
-    0xC7, 0x11, 0x5D, 0x16, 0xD5, 0x4C, 0x98, 0x47, 0x84, 0xBF, 0xA3, 0x1F, 0x5E, 0xE3, 0x22, 0x41,
-    0x7A, 0x92, 0xC2, 0x69, 0xC1, 0xE1, 0x2E, 0x0C, 0x85, 0x6C, 0xC0, 0xCC, 0x65, 0x03, 0xFA, 0x9B,
-    0xD9, 0x80, 0x4B, 0x9F, 0xEA, 0xAF, 0xEE, 0xED, 0xB1, 0xBF, 0x6F, 0x65, 0xF8, 0xC1, 0x77, 0xE3,
-    0x99, 0x17, 0x90, 0xD1, 0xD2, 0x89, 0x01, 0x4C, 0x66, 0x8E, 0xE7, 0xD4, 0x4C, 0x62, 0xB9, 0xE8,
-    0x6F, 0x97, 0xA8, 0x53, 0xDE, 0xCE, 0x67, 0x9F, 0xFA, 0x3E, 0x58, 0x1F, 0x3E, 0x85, 0x9F, 0x3D,
-    0x8F, 0xDF, 0xBA, 0x06, 0x26, 0x30, 0xAD, 0xAE, 0x4E, 0x73, 0x66, 0x10, 0xCE, 0x73, 0xB1, 0x56,
-    0x6C, 0xA9, 0x9F, 0x65, 0x70, 0xD7, 0x7E, 0xD0, 0x4E, 0x08, 0xEB, 0x93, 0x83, 0x77, 0xE6, 0x8B,
-    0x77, 0xA4, 0xAC, 0xA0, 0x30, 0x07, 0x5D, 0x7B, 0x17, 0x54, 0xA6, 0xEC, 0xBE, 0x5C, 0xBC, 0xE6,
-    0x66, 0xE1, 0x74, 0xB7, 0x7E, 0xB2, 0x52, 0x88, 0x3E, 0x9C, 0x51, 0x9B, 0x67, 0x26, 0x6A, 0xF0,
-    0xB9, 0x66, 0xC5, 0x83, 0xEB, 0xD1, 0xF8, 0x3B, 0x49, 0x3B, 0x42, 0x45, 0x85, 0x89, 0x6E, 0x3C,
-    0x69, 0x6E, 0xF8, 0x28, 0xDD, 0xF7, 0x5F, 0xAD, 0xCF, 0xD8, 0x21, 0xFB, 0xDD, 0xD7, 0xDA, 0xED,
-    0x3E, 0x5D, 0x46, 0xAB, 0xA5, 0xAF, 0x1F, 0xB6, 0x5A, 0x7F, 0xEE, 0x09, 0x98, 0xBE, 0x28, 0x10,
-    0xF5, 0x29, 0x40, 0xA1, 0xE7, 0xD6, 0xF0, 0xEC, 0x41, 0x25, 0x7F, 0xBF, 0x56, 0xC9, 0x5F, 0x23,
-    0x0B, 0x27, 0x98, 0x90, 0x5A, 0x84, 0x08, 0xC8, 0x7B, 0x55, 0xF2, 0x7F, 0xA4, 0x95, 0xB2, 0x1D,
-    0x48, 0xAA, 0xE3, 0x47, 0x5F, 0xE9, 0x7B, 0xAD, 0xC6, 0xDA, 0xA9, 0xFC, 0xC9, 0xB7, 0xDE, 0xF7,
-    0x6A, 0xEE, 0xD8, 0xDE, 0xDE, 0xDE, 0x15, 0x7F, 0xD8, 0xBD, 0xFD, 0x40, 0xD4, 0xF0, 0x3B, 0xE8,
-    0xC3, 0x3E, 0x71, 0xC3, 0x4D, 0xFA, 0xF0, 0x17, 0xFD, 0x49, 0x07, 0x83, 0x20, 0x6F, 0x74, 0x87,
-    0xC1, 0xF7, 0xA5, 0xE0, 0xC0, 0xFB, 0x70, 0x1B, 0x9A, 0x8D, 0xCE, 0x6A, 0x42, 0xC7, 0x03, 0x5D,
-    0x71, 0x77, 0x7C, 0x42, 0x50, 0xE0, 0x3E, 0xE0, 0x80, 0x31, 0xB8, 0x33, 0x8B, 0xE1, 0x73, 0xDF,
-    0x05, 0xF8, 0x39, 0x52, 0x18, 0x5C, 0xA0, 0x71, 0xAE, 0x49, 0x2D, 0x94, 0x9D, 0x11, 0xDD, 0x89,
-    0x11, 0x53, 0xAF, 0x22, 0x5A, 0x33, 0x27, 0x89, 0x3F, 0xB6, 0x89, 0x51, 0x2E, 0x31, 0x90, 0x45,
-    0x37, 0xE8, 0x0F, 0x19, 0x78, 0x78, 0x9B, 0x2E, 0x2B, 0xBB, 0x44, 0x06, 0xDC, 0x07, 0xCA, 0xAA,
-    0x33, 0x4D, 0xA1, 0xAC, 0x7A, 0x54, 0xC6, 0x25, 0x51, 0xB5, 0xA4, 0x82, 0x2E, 0x7B, 0x73, 0xA3,
-    0x4A, 0x51, 0x55, 0x42, 0x04, 0x75, 0x23, 0xCB, 0xDC, 0x2D, 0xF4, 0x3C, 0x38, 0x3F, 0x86, 0x27,
-    0x68, 0x1E, 0x8F, 0xAF, 0xF7, 0x0F, 0xB8, 0xCB, 0x28, 0xEC, 0x9D, 0x3E, 0xC3, 0x4C, 0x67, 0x4A,
-    0x82, 0x97, 0xF1, 0xFB, 0x27, 0xE9, 0xED, 0xED, 0x08, 0x9E, 0xB2, 0xA3, 0x77, 0x19, 0x85, 0x0F,
-    0xB1, 0x27, 0x4A, 0xFA, 0x0D, 0x7A, 0xF7, 0xC1, 0x0A, 0x7E, 0x97, 0xF2, 0xCD, 0x3D, 0xFF, 0xEA,
-    0xF4, 0x3F, 0x60, 0x1E, 0xFE, 0x98, 0x3F, 0xC0, 0xC9, 0x39, 0xFA, 0x01, 0x7E, 0x9A, 0x12, 0xBD,
-    0x47, 0x4A, 0xB8, 0x9C, 0x77, 0x36, 0x52, 0x11, 0xEF, 0x40, 0xA7, 0xEF, 0x0F, 0x5B, 0x19, 0xF7,
-    0x51, 0xAA, 0x14, 0x0F, 0xEA, 0xFA, 0x5C, 0xCE, 0x88, 0xD7, 0x1F, 0x34, 0x68, 0x72, 0x6A, 0xB9,
-    0xBD, 0xA1, 0x78, 0xCB, 0xDF, 0xDB, 0xDB, 0xA3, 0xC7, 0x8B, 0x5A, 0x97, 0x1F, 0x23, 0x84, 0xE1,
-    0x38, 0x1C, 0x2C, 0xF7, 0x6C, 0x7C, 0xCC, 0xFA, 0x46, 0xED, 0xEC, 0x0D, 0xE9, 0x3B, 0x2B, 0x7E,
-    0xDE, 0xA4, 0xAD, 0xE7, 0x28, 0xC2, 0x5A, 0xD8, 0x43, 0xDE, 0xFB, 0xEB, 0xCC, 0xDA, 0xC2, 0x3B,
-    0xB6, 0x6E, 0x28, 0xF9, 0x9E, 0xAD, 0xDF, 0xD8, 0x59, 0xBF, 0xF3, 0x75, 0x75, 0x4B, 0xEB, 0xF7,
-    0x1F, 0xCA, 0x47, 0x28, 0x6D, 0x60, 0xA3, 0xF4, 0xE1, 0x61, 0x19, 0x6F, 0xC4, 0x46, 0xBF, 0x98,
-    0x0E, 0xE5, 0x1F, 0x6F, 0x89, 0xE9, 0x9C, 0xFB, 0xFB, 0xF8, 0x41, 0x02, 0xEE, 0x1F, 0xB5, 0x07,
-    0xF9, 0x2B, 0x27, 0xB2, 0x8F, 0x52, 0x86, 0x3A, 0xC1, 0x5D, 0x98, 0x69, 0xE4, 0x28, 0xD2, 0xD4,
-    0x12, 0xE4, 0xBA, 0x80, 0x96, 0x5B, 0xE7, 0xEE, 0xA6, 0x0C, 0xCF, 0x46, 0x33, 0x3C, 0xDB, 0xF5,
-    0xFC, 0x63, 0xE7, 0x4F, 0xD3, 0xE0, 0x9B, 0xCF, 0x48, 0xC8, 0xD2, 0x98, 0xE1, 0xD9, 0xDB, 0x9E,
-    0xDA, 0x59, 0xCD, 0xB1, 0xBD, 0xA5, 0xB4, 0x6D, 0x55, 0xCE, 0x0A, 0xCB, 0x3F, 0xFF, 0x91, 0x49,
-    0xB5, 0x75, 0xD1, 0xFE, 0xA4, 0x50, 0xCF, 0x7C, 0x75, 0xE0, 0x74, 0xFE, 0x48, 0xC9, 0xB0, 0x3F,
-    0x87, 0x00, 0x8F, 0xD9, 0xEF, 0xA3, 0xE0, 0xD4, 0x7D, 0x8C, 0xEA, 0xFB, 0xC8, 0x6D, 0xFD, 0xFF,
-    0xD5, 0x9A, 0x3F, 0x8C, 0x1C, 0x57, 0x1D, 0xC7, 0x7F, 0x33, 0x73, 0xE7, 0x75, 0x3C, 0x0A, 0xB3,
-    0xC5, 0x59, 0x90, 0x0B, 0x78, 0x3B, 0x0A, 0x13, 0x7B, 0x9B, 0x08, 0x21, 0x72, 0xF6, 0x0C, 0x44,
-    0x22, 0x05, 0x45, 0xAE, 0xC0, 0x35, 0x14, 0x14, 0x54, 0x54, 0x14, 0x11, 0x9C, 0x3D, 0x2B, 0x28,
-    0xD2, 0x50, 0xB8, 0xA4, 0x8B, 0x8B, 0x14, 0xC1, 0x14, 0xA1, 0x70, 0x61, 0x21, 0xDB, 0x33, 0x52,
-    0xA4, 0x80, 0x14, 0x24, 0x96, 0x3F, 0x21, 0x41, 0x14, 0x99, 0x10, 0x4B, 0x14, 0x2E, 0x6E, 0x8A,
-    0x01, 0x56, 0xCE, 0xEE, 0x3E, 0x7E, 0xDF, 0xEF, 0xEF, 0xCD, 0xEE, 0x9E, 0x31, 0xA2, 0xE0, 0x6E,
-    0x6F, 0x76, 0xEC, 0xFB, 0xDD, 0xDE, 0xEE, 0xEC, 0xBC, 0xDF, 0xFB, 0xBC, 0xDF, 0x7B, 0xBF, 0xEF,
-    0xFB, 0x23, 0x22, 0x49, 0x2D, 0x7A, 0xA5, 0xB4, 0x79, 0x03, 0xEB, 0x60, 0xC3, 0x47, 0x13, 0xB5,
-    0xD1, 0x7B, 0xB0, 0xF1, 0xEB, 0x53, 0xB5, 0x83, 0x1E, 0xEC, 0x15, 0xDA, 0x83, 0x68, 0xA6, 0xB6,
-    0x81, 0x0D, 0xAB, 0x68, 0xAE, 0x37, 0x3E, 0xFE, 0x85, 0xDA, 0xC4, 0x39, 0xA7, 0x37, 0x4A, 0xA8,
-    0xF6, 0xAA, 0x04, 0x6A, 0xEF, 0xA9, 0xCD, 0x44, 0x1F, 0xE8, 0xB2, 0xA8, 0xD1, 0xD7, 0xE5, 0x70,
-    0x2E, 0x5F, 0x72, 0x0F, 0x73, 0x97, 0xA5, 0x0E, 0x8F, 0xE6, 0xB5, 0x43, 0xAB, 0xF7, 0xE9, 0xD3,
-    0x68, 0xF1, 0x4D, 0xBD, 0xBE, 0x07, 0x73, 0x66, 0xFE, 0x8D, 0x4C, 0x72, 0xE7, 0xB2, 0xC0, 0xE9,
-    0x63, 0xA3, 0xA9, 0x9A, 0xA4, 0xD1, 0x22, 0x07, 0xB5, 0x96, 0x9E, 0x8E, 0xA3, 0xA9, 0xE4, 0xA5,
-    0xFA, 0x54, 0x94, 0xB1, 0x9A, 0x51, 0x32, 0x11, 0x37, 0x1A, 0x34, 0x6A, 0xB4, 0x46, 0xC5, 0xE8,
-    0xED, 0x5A, 0xF2, 0x3F, 0xFC, 0xAE, 0xD1, 0xC2, 0x5E, 0x75, 0x65, 0x32, 0xEB, 0xA9, 0x8F, 0x99,
-    0xEC, 0x8B, 0x6C, 0xB3, 0xCE, 0xA5, 0x9A, 0x62, 0x8C, 0x7A, 0xE3, 0xD5, 0xAE, 0x39, 0x73, 0x86,
-    0x6E, 0x0D, 0xE6, 0xB0, 0x67, 0x53, 0xBE, 0x75, 0x15, 0x26, 0x44, 0xBD, 0x25, 0x2A, 0x69, 0x47,
-    0xB2, 0xB8, 0x4E, 0x9F, 0x5F, 0xA1, 0xDE, 0x04, 0x9F, 0x56, 0xFA, 0xEA, 0xEB, 0xF0, 0x22, 0xC2,
-    0xAB, 0x21, 0x3C, 0xDC, 0xC3, 0xA7, 0x5F, 0x69, 0x1D, 0x3D, 0x11, 0x90, 0x7C, 0x70, 0xC6, 0x5F,
-    0x43, 0xBE, 0x7E, 0xF3, 0x80, 0x50, 0x66, 0x37, 0xC9, 0x23, 0x87, 0x0D, 0x9A, 0x04, 0xDE, 0x84,
-    0xA3, 0x70, 0x05, 0x9B, 0xE7, 0xE6, 0xC1, 0x79, 0x72, 0x86, 0xCE, 0xB3, 0xF3, 0xF0, 0x3C, 0x3D,
-    0x8F, 0xCF, 0xF3, 0xF3, 0x00, 0x8D, 0xA0, 0x47, 0xE8, 0x19, 0x7A, 0x88, 0x9E, 0xA2, 0xC7, 0xE8,
-    0x39, 0x1A, 0x48, 0x31, 0x92, 0x62, 0x28, 0x65, 0x85, 0xE5, 0x9B, 0x1E, 0x5F, 0xF1, 0x6A, 0xA6,
-    0xDF, 0xFE, 0x50, 0xCB, 0xFE, 0xA0, 0xC2, 0x23, 0x26, 0x88, 0xD1, 0x9D, 0x13, 0xE5, 0xF8, 0x9C,
-    0x41, 0x21, 0xCA, 0xDE, 0xBB, 0x70, 0x24, 0x78, 0x63, 0xBA, 0x60, 0x68, 0x08, 0x8F, 0x10, 0x3C,
-    0xC5, 0xB8, 0x0B, 0xD1, 0xB8, 0x01, 0x4B, 0x7E, 0xAD, 0x50, 0x8F, 0x77, 0x15, 0xE6, 0x1A, 0x51,
-    0xE9, 0x75, 0x97, 0x71, 0xF5, 0x91, 0x81, 0x58, 0x84, 0x5D, 0x32, 0xBD, 0xD5, 0x4D, 0x60, 0x78,
-    0x28, 0x06, 0x8E, 0x2F, 0xA2, 0x6B, 0x86, 0xE3, 0x36, 0xC0, 0x7E, 0xB3, 0x56, 0x6A, 0x83, 0xD1,
-    0x77, 0x50, 0xF3, 0xC7, 0x00, 0xF0, 0x0F, 0xB4, 0x98, 0x64, 0xBB, 0xD6, 0x65, 0x49, 0xA7, 0xAB,
-    0xC1, 0x66, 0x0E, 0x44, 0x93, 0xCF, 0xE0, 0x9B, 0xF7, 0x45, 0x2E, 0xC4, 0x7C, 0x0B, 0x55, 0x42,
-    0xEC, 0x85, 0x6B, 0x8E, 0xBD, 0xE0, 0x5B, 0x36, 0xBE, 0x71, 0xC4, 0x63, 0x9A, 0x7A, 0x30, 0x84,
-    0x1B, 0x4D, 0xAC, 0x7E, 0x04, 0x59, 0x90, 0x75, 0x28, 0x31, 0x58, 0x9A, 0xB3, 0xEC, 0x26, 0x6E,
-    0xC5, 0x5E, 0xE4, 0xFB, 0xE7, 0xDB, 0x37, 0x22, 0xA7, 0xF8, 0x92, 0x3F, 0xAA, 0xA7, 0xE9, 0x1A,
-    0x18, 0x5A, 0xEE, 0x1D, 0x3F, 0x2D, 0xF7, 0xCA, 0x76, 0xB6, 0xC8, 0x24, 0xC2, 0x44, 0xD2, 0xFF,
-    0x3D, 0xEC, 0x9D, 0x1E, 0x42, 0x31, 0x2D, 0xF8, 0x21, 0x03, 0x35, 0xD8, 0xEF, 0x48, 0x06, 0x0E,
-    0x6E, 0xB5, 0x29, 0x17, 0x63, 0xF7, 0xF6, 0xE7, 0xFA, 0x78, 0xA1, 0xAE, 0xF4, 0xC0, 0xD4, 0xD4,
-    0xCC, 0xCE, 0x09, 0x67, 0x60, 0x6B, 0x65, 0xE6, 0x58, 0xAF, 0x4F, 0xBA, 0x4E, 0x8D, 0xD0, 0xA4,
-    0x69, 0x5B, 0x79, 0xFB, 0xEC, 0x29, 0x50, 0x13, 0x76, 0x64, 0x93, 0x11, 0xC1, 0x17, 0x36, 0x28,
-    0xE2, 0x76, 0x41, 0xE7, 0xA5, 0xB2, 0x6D, 0x6C, 0x86, 0xDD, 0xE7, 0x4F, 0x01, 0x60, 0x7C, 0x13,
-    0xF9, 0x24, 0x65, 0x3E, 0x79, 0x8D, 0x5D, 0xB9, 0x7F, 0x8E, 0x00, 0x83, 0x8E, 0x03, 0xA4, 0x33,
-    0xB3, 0x73, 0x18, 0xF7, 0xF4, 0x51, 0x71, 0x3C, 0xF5, 0xF9, 0x64, 0x5B, 0x4E, 0x81, 0x62, 0x5F,
-    0x50, 0x4A, 0xCD, 0xA6, 0xBC, 0xFF, 0x6D, 0x32, 0x63, 0x56, 0x19, 0xD0, 0xD1, 0x95, 0x74, 0xD2,
-    0x85, 0x7C, 0xB2, 0x65, 0x22, 0x9D, 0x9E, 0xAD, 0x4E, 0xD4, 0xEE, 0xDB, 0x87, 0x5B, 0x10, 0x63,
-    0xDA, 0x89, 0x92, 0x3F, 0x37, 0x6B, 0x64, 0x48, 0xA7, 0x20, 0x05, 0xF4, 0xC6, 0xD6, 0x5C, 0x27,
-    0x24, 0xAD, 0x64, 0xE6, 0xAD, 0x16, 0xA2, 0x73, 0xB9, 0xDE, 0x4C, 0xEB, 0x2C, 0x5A, 0xC2, 0x05,
-    0x65, 0x35, 0x85, 0xE6, 0x4E, 0x58, 0xB7, 0x84, 0x38, 0x07, 0x8D, 0x25, 0x75, 0xF8, 0x9C, 0x9A,
-    0xAD, 0x16, 0xB9, 0xCA, 0x67, 0xD1, 0xA2, 0xCD, 0xA2, 0xFB, 0x2C, 0xA9, 0x06, 0x2F, 0x55, 0xC2,
-    0x5A, 0x91, 0x5E, 0x85, 0xAF, 0xBA, 0xB1, 0x14, 0x6A, 0x4B, 0x39, 0x72, 0x59, 0xD3, 0x0D, 0x57,
-    0x6C, 0xCC, 0xD1, 0xFA, 0x8C, 0x16, 0x92, 0xBA, 0x3A, 0x98, 0x25, 0x4D, 0xAF, 0x49, 0x9A, 0xA4,
-    0x4E, 0x9A, 0x61, 0x95, 0xD4, 0x69, 0x99, 0x8E, 0xF3, 0x77, 0x5D, 0x56, 0x68, 0x03, 0xBB, 0xF7,
-    0xAD, 0x4A, 0x98, 0xE4, 0xE5, 0x65, 0x98, 0xA5, 0x75, 0x92, 0x0D, 0xDC, 0x5C, 0x4B, 0x6C, 0x6C,
-    0xE4, 0x57, 0x37, 0xE3, 0xC6, 0xF4, 0x1B, 0x2A, 0xD3, 0xA3, 0xCB, 0xC1, 0x03, 0x0E, 0x6E, 0x87,
-    0x9C, 0x77, 0xC5, 0xF4, 0x26, 0xA1, 0xE5, 0x84, 0xCC, 0x46, 0x5E, 0xA9, 0x17, 0xFE, 0x9D, 0x3E,
-    0x29, 0x04, 0x52, 0x74, 0x58, 0x9A, 0xB3, 0x48, 0x65, 0x0F, 0xBC, 0x83, 0x95, 0x8F, 0x9C, 0x63,
-    0x20, 0xD5, 0x36, 0x46, 0x73, 0x01, 0xAE, 0xCE, 0x31, 0xDA, 0xDF, 0x60, 0x6C, 0xD7, 0x43, 0x83,
-    0xD6, 0x11, 0x1E, 0x01, 0x23, 0xE6, 0x92, 0xBA, 0x78, 0x4F, 0x7E, 0xA5, 0xCE, 0xD3, 0xBD, 0xE0,
-    0x78, 0x39, 0x30, 0x01, 0x53, 0xB6, 0xDC, 0x4E, 0xA8, 0xA2, 0x7F, 0x86, 0xA0, 0xFC, 0x2B, 0xFC,
-    0x4D, 0x43, 0x70, 0xFF, 0xAE, 0xFE, 0xEB, 0x48, 0x74, 0x98, 0xC4, 0xC2, 0xAC, 0x29, 0xC1, 0x98,
-    0xFD, 0x27, 0x2D, 0xE7, 0xD7, 0xFA, 0xD7, 0x8D, 0xA0, 0xC1, 0xB0, 0xDD, 0x97, 0x25, 0x19, 0xA0,
-    0x11, 0xB0, 0x11, 0xC0, 0x11, 0xD0, 0x11, 0xE0, 0x11, 0xF0, 0x11, 0x00, 0x12, 0x10, 0x22, 0x22,
-    0x1B, 0x28, 0x00, 0x89, 0x94, 0x04, 0x98, 0x04, 0x9C, 0x0C, 0x94, 0x91, 0xB2, 0x29, 0x50, 0x68,
-    0x3D, 0xA5, 0xB9, 0x4D, 0xED, 0xCC, 0xEF, 0x75, 0x11, 0x15, 0xA6, 0xE5, 0x74, 0xE8, 0x8E, 0x66,
-    0xDD, 0xCF, 0xEA, 0x1B, 0xC0, 0x04, 0x4A, 0x2D, 0xA4, 0x63, 0x0A, 0x9E, 0xE7, 0x99, 0x94, 0x5E,
-    0xA2, 0x8B, 0x98, 0xCC, 0x6A, 0x08, 0x61, 0xBE, 0xE8, 0x7E, 0xDA, 0xDD, 0x10, 0xE2, 0x72, 0xD8,
-    0x97, 0xC7, 0x5E, 0x33, 0x15, 0xDA, 0xD2, 0x11, 0x66, 0xDF, 0x6B, 0x8B, 0x23, 0x09, 0x1F, 0x3E,
-    0x23, 0x7E, 0x02, 0x2B, 0x17, 0x98, 0xDB, 0xB7, 0x02, 0x2E, 0x91, 0x31, 0xA6, 0xC2, 0xCE, 0xC6,
-    0x14, 0xAF, 0x5E, 0xF3, 0xAC, 0xBA, 0x7E, 0x4F, 0x2E, 0xE1, 0xD1, 0x90, 0x24, 0x05, 0xFA, 0xE1,
-    0x49, 0xC5, 0xD7, 0x79, 0x86, 0x17, 0x05, 0x65, 0xE8, 0xC0, 0x22, 0xFE, 0x18, 0x35, 0x1A, 0x66,
-    0x07, 0xB2, 0x3A, 0x37, 0xDD, 0x80, 0xF4, 0x2E, 0xD7, 0x84, 0x0B, 0x8D, 0x3D, 0xFD, 0xDA, 0xE0,
-    0x9D, 0x5A, 0x6E, 0xC8, 0xF1, 0xB2, 0x7A, 0x6A, 0xEA, 0xCF, 0x33, 0x2D, 0x53, 0x5F, 0xFD, 0xA4,
-    0xB6, 0x01, 0x1E, 0xA1, 0xBF, 0xB7, 0x5C, 0x07, 0xCE, 0x35, 0xE3, 0xE5, 0xFA, 0x00, 0x6A, 0xC1,
-    0x19, 0x69, 0x81, 0x15, 0x1F, 0x00, 0x4E, 0xA0, 0x84, 0x3A, 0xE0, 0x07, 0x7C, 0x40, 0x07, 0x6C,
-    0x40, 0x06, 0xF5, 0x86, 0x43, 0x2E, 0xA3, 0x70, 0x1C, 0xBA, 0x87, 0xD6, 0x0D, 0x18, 0xFF, 0xC1,
-    0xA3, 0x4A, 0x5E, 0xAE, 0xA4, 0x37, 0xD6, 0x96, 0x42, 0x81, 0x2F, 0x72, 0xB0, 0xFC, 0xB9, 0x66,
-    0x31, 0xB4, 0x8B, 0x16, 0xA3, 0xFF, 0xB5, 0x20, 0x2D, 0x47, 0x8B, 0x19, 0xD4, 0x28, 0x40, 0xF3,
-    0x9A, 0x16, 0xA1, 0x25, 0xA4, 0x1F, 0xAB, 0xAA, 0x1B, 0x61, 0x51, 0x25, 0x3B, 0x31, 0x0F, 0xF1,
-    0xE8, 0xDE, 0xE4, 0x09, 0x5A, 0xDB, 0xFC, 0x7A, 0x5E, 0x49, 0x3E, 0xB6, 0x79, 0x95, 0x5E, 0xE7,
-    0x6E, 0x67, 0x89, 0x1B, 0x05, 0x10, 0xA9, 0x90, 0x25, 0x10, 0xAA, 0x73, 0x38, 0x62, 0xFE, 0xC7,
-    0x13, 0x5F, 0x85, 0x64, 0xB2, 0x9F, 0xB8, 0x2A, 0xD2, 0x92, 0xFA, 0x7E, 0x33, 0xA1, 0xE0, 0xFF,
-    0xCB, 0xCB, 0xB8, 0x18, 0x3A, 0x8E, 0x8B, 0x8E, 0x8E, 0xA3, 0x3A, 0x7A, 0x93, 0xDE, 0xEF, 0xE0,
-    0x27, 0xFE, 0x2C, 0x20, 0x76, 0xD5, 0x77, 0xB8, 0x94, 0x8F, 0x51, 0xAF, 0x7C, 0x8C, 0x5A, 0x15,
-    0x65, 0xBA, 0xB0, 0xAE, 0x44, 0x1D, 0x55, 0x85, 0x57, 0xF0, 0x44, 0x2D, 0x42, 0xBD, 0x82, 0x33,
-    0x7A, 0x27, 0xDC, 0xC0, 0xC8, 0x84, 0x3F, 0x35, 0x4A, 0x42, 0xF7, 0x68, 0xC6, 0x62, 0xC7, 0xED,
-    0x0A, 0x19, 0x6B, 0x6D, 0x51, 0xD2, 0x4E, 0x29, 0xAC, 0x1B, 0xC4, 0x63, 0xD3, 0xE3, 0xE8, 0x40,
-    0x75, 0x38, 0x8F, 0xA7, 0xF1, 0x24, 0x9A, 0x25, 0xFA, 0x2A, 0xAD, 0x42, 0x97, 0x8E, 0x43, 0x97,
-    0xAB, 0x87, 0x85, 0xFE, 0xB8, 0x51, 0x6F, 0xE6, 0x46, 0xF1, 0x54, 0xE5, 0x78, 0x53, 0x94, 0xC3,
-    0x5A, 0xC3, 0xB3, 0x44, 0x10, 0x46, 0xC0, 0xBA, 0xC3, 0x09, 0x8C, 0x04, 0x68, 0x29, 0x67, 0x3F,
-    0xB6, 0x34, 0x2B, 0x5E, 0x7F, 0xA2, 0xA3, 0x84, 0xAF, 0xB0, 0x2C, 0x53, 0xA1, 0xC3, 0x6C, 0xB1,
-    0x7C, 0x2B, 0xBF, 0xEC, 0x16, 0x29, 0xBF, 0x95, 0x82, 0x38, 0x46, 0x20, 0x53, 0x71, 0xB4, 0x9D,
-    0xE7, 0xC5, 0x76, 0xFE, 0xF2, 0xFF, 0xF3, 0x7A, 0x42, 0x7D, 0xC5, 0x54, 0x5F, 0x1F, 0x2E, 0x87,
-    0xFF, 0xE0, 0x89, 0xE1, 0xBF, 0x23, 0x6C, 0xDE, 0xF2, 0x3A, 0x28, 0x7F, 0x5D, 0x11, 0xB9, 0xBF,
-    0x68, 0xFF, 0xF9, 0x04, 0x7D, 0x30, 0xBB, 0x77, 0x74, 0xBD, 0x90, 0xFD, 0x57, 0x07, 0xCC, 0x39,
-    0xBB, 0x8A, 0xF6, 0x1A, 0x30, 0x12, 0x40, 0x12, 0x50, 0x12, 0x60, 0x12, 0x70, 0x12, 0x80, 0x12,
-    0x90, 0xC2, 0x4C, 0xAF, 0x11, 0xB0, 0x12, 0xC0, 0xB2, 0xDC, 0x49, 0x5C, 0xF6, 0x5C, 0xCB, 0x93,
-    0x5E, 0x83, 0xDD, 0xF1, 0x1A, 0xAC, 0xEC, 0x34, 0x30, 0x2A, 0x56, 0x54, 0x60, 0x2F, 0x1F, 0xC9,
-    0x33, 0xFA, 0x3E, 0x60, 0x81, 0x55, 0x8B, 0xEA, 0x98, 0x02, 0xE9, 0x79, 0xA6, 0x99, 0xAF, 0xAE,
-    0x28, 0xB1, 0x98, 0x55, 0xFF, 0x6D, 0xD7, 0xC3, 0x29, 0xC1, 0x1F, 0xCF, 0xD5, 0x7E, 0x16, 0x6A,
-    0x31, 0xF5, 0xFE, 0x1A, 0x63, 0xEA, 0x7F, 0xEA, 0xB1, 0xB2, 0xF3, 0x1D, 0x52, 0x5D, 0x98, 0xC5,
-    0x58, 0x66, 0x39, 0x54, 0x37, 0x16, 0x6B, 0x58, 0x92, 0x63, 0x33, 0x18, 0x77, 0xAE, 0x8F, 0x25,
-    0x64, 0x8E, 0x09, 0x1D, 0xA1, 0xD4, 0x11, 0x8A, 0x1D, 0xA1, 0xDC, 0x59, 0x55, 0xD6, 0x1B, 0x90,
-    0x10, 0x29, 0x3E, 0xF5, 0x6E, 0x08, 0xCF, 0xF8, 0x6F, 0xCD, 0xB1, 0xF7, 0xD9, 0xA7, 0x27, 0x4B,
-    0xDB, 0x53, 0x12, 0x6B, 0x44, 0x19, 0xD8, 0x92, 0x47, 0x6A, 0x72, 0x64, 0xD2, 0x8A, 0x17, 0xBF,
-    0x14, 0x18, 0xD7, 0xC4, 0x98, 0xD4, 0xE4, 0x18, 0xD7, 0x04, 0xA9, 0xA9, 0x04, 0x24, 0x5F, 0x2E,
-    0x89, 0xF2, 0x23, 0x4A, 0xA7, 0x62, 0x22, 0x06, 0x53, 0x8C, 0xA6, 0x18, 0x4E, 0x31, 0x9E, 0x92,
-    0x2E, 0x7F, 0x69, 0xC3, 0x19, 0x52, 0x31, 0xA6, 0x1E, 0xAA, 0xA7, 0xEA, 0xB1, 0x7A, 0xAE, 0x1E,
-    0x6C, 0x4B, 0xB6, 0x45, 0xBB, 0x88, 0xCA, 0x6B, 0xD6, 0x7D, 0x38, 0x6B, 0x98, 0x2C, 0x7A, 0xBA,
-    0x8A, 0xF3, 0x2D, 0x86, 0xCB, 0x83, 0x76, 0x01, 0x51, 0x61, 0x3A, 0x86, 0xE2, 0x55, 0xC6, 0xE2,
-    0x1E, 0x82, 0x71, 0x5E, 0x23, 0x1A, 0x35, 0x44, 0x18, 0x8E, 0x16, 0x8F, 0x16, 0x90, 0x16, 0x91,
-    0x16, 0x92, 0x16, 0x93, 0x16, 0x94, 0x16, 0x95, 0x16, 0x96, 0x16, 0x97, 0x3E, 0x30, 0xDB, 0xC8,
-    0x3C, 0x2F, 0x2B, 0x3B, 0x60, 0x32, 0x30, 0x5F, 0x7B, 0x96, 0x4A, 0x82, 0x49, 0x7B, 0xFA, 0x64,
-    0x13, 0xD0, 0xDA, 0xAC, 0xC8, 0x16, 0xAA, 0x62, 0x56, 0x20, 0x34, 0xFF, 0xAF, 0x13, 0xED, 0xD6,
-    0xDA, 0xD1, 0xFA, 0x02, 0x4D, 0xE3, 0xB5, 0x22, 0xCF, 0xAB, 0x3C, 0x2F, 0xF3, 0x7C, 0x78, 0xAB,
-    0xD0, 0xDB, 0x8C, 0xE0, 0x5D, 0x9C, 0xA6, 0x31, 0x11, 0x68, 0x32, 0xD0, 0x84, 0xA0, 0x5F, 0x42,
-    0x50, 0x31, 0xB8, 0x45, 0x39, 0xB8, 0x6E, 0xDA, 0x7E, 0xF9, 0x6F, 0x50, 0xBD, 0xC0, 0x78, 0x9E,
-    0x93, 0xEC, 0x63, 0x4E, 0x8F, 0x83, 0xCA, 0x66, 0xB0, 0x7A, 0xCF, 0x46, 0x60, 0xB6, 0x01, 0x78,
-    0x92, 0xF0, 0x93, 0xEF, 0xE3, 0x88, 0x4E, 0x81, 0x81, 0xEF, 0x07, 0x83, 0x7A, 0x8B, 0x3B, 0x1E,
-    0x6B, 0x0F, 0x64, 0xD9, 0xA4, 0xF0, 0x8C, 0x2C, 0x49, 0xC4, 0xB3, 0xD5, 0x94, 0x11, 0x3E, 0x3C,
-    0xBA, 0x43, 0xB3, 0x66, 0x84, 0x56, 0x28, 0xB7, 0x60, 0xDA, 0x63, 0x06, 0xEC, 0x2C, 0x37, 0xAC,
-    0x16, 0xB3, 0x9E, 0xAB, 0x87, 0xCA, 0xD3, 0x55, 0xD8, 0x0E, 0xBA, 0x4E, 0x0C, 0x07, 0xCC, 0x7F,
-    0x77, 0xC9, 0xA2, 0xC1, 0x02, 0x81, 0xEA, 0x40, 0xAD, 0xBE, 0x6A, 0x2D, 0x2D, 0x35, 0xA8, 0x30,
-    0xC7, 0x0E, 0x2B, 0x70, 0xD1, 0xCE, 0x37, 0xA8, 0xB1, 0x6A, 0xA7, 0x1E, 0xF4, 0xC8, 0x34, 0x86,
-    0xE7, 0xD8, 0xF6, 0xD4, 0xB0, 0x4F, 0x38, 0x7F, 0x1F, 0x90, 0xE7, 0x15, 0x2D, 0xAB, 0xC1, 0xA0,
-    0x9E, 0x38, 0xAC, 0x7F, 0x04, 0xCE, 0x76, 0xA8, 0xB2, 0xA5, 0x87, 0xF9, 0xE8, 0xA9, 0x1E, 0x5E,
-    0xBC, 0x2D, 0x17, 0x47, 0xE9, 0x1C, 0x7B, 0x4F, 0x33, 0xAD, 0xB0, 0xBA, 0xE1, 0x32, 0x18, 0x75,
-    0x45, 0xE7, 0xFF, 0xC9, 0xE4, 0xC8, 0x2E, 0xD5, 0xB0, 0x56, 0x07, 0x87, 0x95, 0xB6, 0x7B, 0x5A,
-    0x0D, 0x61, 0x7E, 0x34, 0x91, 0xF4, 0x9F, 0xEF, 0x4D, 0xFB, 0xA9, 0xFB, 0xA6, 0xAB, 0x93, 0x69,
-    0xA4, 0x0F, 0xE6, 0x92, 0x40, 0xB0, 0xC8, 0xE5, 0xDC, 0xB2, 0xE3, 0x5A, 0xD3, 0x60, 0xB4, 0x1C,
-    0xB8, 0x13, 0x6E, 0x8D, 0x9E, 0x1D, 0x2E, 0xCF, 0xCE, 0x05, 0xD3, 0xE5, 0x68, 0x13, 0x95, 0x4B,
-    0xCD, 0xD4, 0x01, 0x7E, 0x76, 0x71, 0x9C, 0xF9, 0x14, 0xB5, 0xF9, 0x5A, 0xD3, 0x4E, 0xC9, 0x78,
-    0xAE, 0xE9, 0x12, 0x3E, 0x7D, 0xC1, 0xDF, 0x75, 0x32, 0x38, 0x17, 0x2A, 0xC9, 0x16, 0xF3, 0xFC,
-    0xAA, 0x9D, 0x8F, 0xF4, 0xB0, 0x69, 0xBB, 0xB1, 0x5F, 0xA2, 0x1E, 0x94, 0xC0, 0x36, 0x4B, 0xC7,
-    0xE0, 0x36, 0x1D, 0x94, 0x00, 0x77, 0x90, 0x94, 0x24, 0x97, 0x64, 0x44, 0x77, 0x9D, 0xEC, 0xB4,
-    0xA6, 0x80, 0xD7, 0x88, 0xA7, 0xE7, 0xF1, 0x91, 0xDF, 0x58, 0x3C, 0x40, 0x4F, 0xD0, 0x23, 0xF4,
-    0x0C, 0x3D, 0x44, 0x4F, 0xD1, 0x63, 0xF4, 0x1C, 0x3D, 0x48, 0x4F, 0xB2, 0x45, 0xB9, 0x64, 0x79,
-    0x2D, 0x5B, 0xEC, 0xA0, 0x5A, 0x7F, 0x4E, 0x2A, 0x9F, 0x35, 0xFB, 0xE8, 0x53, 0xFE, 0xA8, 0xE9,
-    0x14, 0x24, 0x7F, 0x3C, 0x25, 0xCA, 0x29, 0x59, 0x36, 0xE0, 0xF8, 0xCA, 0x18, 0x76, 0x4E, 0x9C,
-    0x37, 0x8D, 0xA7, 0x57, 0xD3, 0x24, 0x6A, 0x48, 0x8D, 0xA9, 0x41, 0x35, 0xAA, 0x86, 0x55, 0xC8,
-    0x55, 0x0C, 0x6C, 0x4B, 0xF6, 0x9A, 0x2C, 0x0F, 0xE0, 0xFA, 0x63, 0xB1, 0xAD, 0x70, 0x6B, 0xE7,
-    0xDD, 0x3A, 0x08, 0x6D, 0x02, 0xDA, 0xFF, 0xAA, 0x92, 0x0E, 0xA8, 0xBD, 0xB7, 0xD6, 0x8E, 0xD6,
-    0x17, 0x6F, 0x9D, 0xBD, 0xED, 0xED, 0xFE, 0x80, 0x93, 0xF5, 0x77, 0xDF, 0xE1, 0x41, 0x61, 0x33,
-    0x82, 0x77, 0xA5, 0xFB, 0x71, 0x2C, 0xB0, 0xC1, 0xC0, 0x07, 0x0A, 0x87, 0x03, 0x8C, 0x07, 0x7D,
-    0x0C, 0x08, 0xEB, 0xA6, 0xBD, 0x50, 0x49, 0x7B, 0xFF, 0xA9, 0x92, 0xC6, 0x0B, 0x95, 0xB4, 0x39,
-    0x98, 0xA3, 0x19, 0x4E, 0xD1, 0x24, 0xEE, 0x0D, 0xB8, 0x5B, 0x20, 0xEF, 0xEE, 0xC5, 0x13, 0x56,
-    0x35, 0x5B, 0x37, 0xDA, 0xC5, 0x4E, 0x56, 0xC7, 0xB9, 0x65, 0xAB, 0x87, 0xCB, 0x6D, 0x6A, 0xDF,
-    0xFE, 0xF2, 0x53, 0x7C, 0x3B, 0x75, 0xB3, 0x3C, 0xD1, 0xBF, 0x4E, 0x84, 0x8B, 0xBD, 0xA2, 0x66,
-    0x65, 0xAF, 0xE8, 0xE6, 0xF2, 0x74, 0x94, 0x1D, 0x6E, 0x0F, 0x4C, 0xDC, 0xD9, 0x59, 0x0D, 0xD3,
-    0x0C, 0xCB, 0xB0, 0x48, 0x21, 0x06, 0xCA, 0xDC, 0xDD, 0x52, 0xA5, 0x1A, 0xCF, 0x31, 0xC0, 0x60,
-    0x7B, 0xA2, 0x86, 0x1E, 0x50, 0x80, 0x48, 0xAE, 0xD8, 0x00, 0xCA, 0x2E, 0x53, 0xE3, 0x1C, 0x70,
-    0x4F, 0x0B, 0xC5, 0xE4, 0xEF, 0x70, 0x31, 0xEB, 0x03, 0x9E, 0x30, 0x3A, 0xE4, 0x83, 0x59, 0x4A,
-    0xB2, 0xB2, 0x06, 0x32, 0x5C, 0x39, 0x61, 0x64, 0x7B, 0x63, 0x39, 0xEC, 0xAE, 0x7B, 0x6C, 0x1B,
-    0x67, 0x16, 0x05, 0xFB, 0xCB, 0x6A, 0x44, 0x36, 0xBA, 0xD9, 0x38, 0x96, 0xAE, 0x06, 0x09, 0xBE,
-    0xF6, 0x16, 0x12, 0x5A, 0x3A, 0x83, 0x4C, 0xEE, 0x01, 0x2E, 0x9D, 0x2B, 0xB1, 0xA7, 0x82, 0xB3,
-    0x28, 0x2E, 0xC3, 0xAE, 0xB1, 0xAA, 0x6D, 0xBA, 0x78, 0x99, 0xB3, 0xF4, 0x3D, 0x36, 0xF6, 0x5D,
-    0x16, 0x8F, 0x02, 0x86, 0x9F, 0xC0, 0xE9, 0xE4, 0x5F, 0x23, 0xB6, 0xF7, 0x52, 0xF7, 0xDA, 0xD2,
-    0x42, 0x54, 0x3F, 0xB9, 0xAF, 0x30, 0x5B, 0xAC, 0xED, 0x14, 0x54, 0x79, 0xC5, 0xA4, 0x0B, 0xC4,
-    0x96, 0x97, 0x1D, 0x97, 0x8A, 0x56, 0xAC, 0x9F, 0x22, 0x9F, 0x06, 0xAB, 0x01, 0x7A, 0x64, 0x83,
-    0xA3, 0x55, 0x0E, 0x0B, 0x6B, 0xCA, 0x8A, 0xBB, 0x96, 0x31, 0xE7, 0x12, 0x97, 0xD9, 0xA6, 0x3B,
-    0x57, 0x96, 0xE7, 0x22, 0x4D, 0x63, 0xF1, 0x54, 0x9F, 0xC4, 0xD2, 0x95, 0x68, 0x6C, 0x45, 0x32,
-    0x3F, 0xFF, 0x21, 0xBF, 0xDD, 0xB7, 0x93, 0x73, 0x2B, 0xAB, 0x7A, 0x09, 0xEF, 0x79, 0xB6, 0x7B,
-    0x91, 0xD9, 0x5E, 0x2E, 0xC3, 0x7E, 0x93, 0xFB, 0xBB, 0x7E, 0xD2, 0x3B, 0xC4, 0x88, 0x91, 0xF8,
-    0x83, 0x75, 0x3B, 0x9D, 0xE1, 0x6C, 0xF9, 0x75, 0x1E, 0xC2, 0x45, 0xF7, 0x08, 0x2E, 0xBE, 0x8D,
-    0x4F, 0x2E, 0xD8, 0x01, 0xDA, 0xE5, 0x00, 0xD7, 0x19, 0xB6, 0xFF, 0x06, 0xB5, 0x58, 0xBF, 0x8F,
-    0xDC, 0xC6, 0x15, 0x7E, 0x24, 0xA5, 0x10, 0x39, 0xC6, 0x1E, 0x15, 0x52, 0xA1, 0x53, 0x74, 0x4C,
-    0xE1, 0x22, 0x38, 0x58, 0x47, 0x17, 0x41, 0xA0, 0xE2, 0x6E, 0x39, 0x3E, 0x15, 0x01, 0x62, 0x20,
-    0xBE, 0x46, 0x8D, 0x1B, 0xA5, 0x71, 0x73, 0x08, 0xE0, 0x14, 0x06, 0x72, 0x85, 0x74, 0x1C, 0xC0,
-    0x40, 0x52, 0xB8, 0xF0, 0xFD, 0x01, 0x09, 0xA0, 0x00, 0x09, 0x20, 0x5D, 0x00, 0xB9, 0x49, 0x71,
-    0x31, 0x74, 0x3B, 0x73, 0x52, 0xA1, 0x22, 0x45, 0x18, 0xFD, 0x03, 0x26, 0x62, 0x05, 0x41, 0xEC,
-    0xC2, 0x03, 0x98, 0x30, 0x28, 0x89, 0xCB, 0xC9, 0xF7, 0x86, 0xCB, 0xDD, 0x3D, 0xC1, 0x92, 0xCE,
-    0x06, 0x32, 0xDC, 0x19, 0x72, 0x97, 0x6F, 0xE6, 0xFD, 0x98, 0xF7, 0xBE, 0xF7, 0x66, 0xE9, 0xE6,
-    0x37, 0x36, 0xA2, 0x37, 0x7E, 0xF0, 0xC3, 0x9F, 0xC4, 0x65, 0x5C, 0xA6, 0xF5, 0x4F, 0x7F, 0x1F,
-    0xAA, 0x97, 0x5F, 0x44, 0x81, 0xA2, 0x6A, 0xFB, 0xE0, 0x93, 0x83, 0x9B, 0xD5, 0x1F, 0xD5, 0x4D,
-    0x7A, 0xF9, 0x45, 0x14, 0xCA, 0x84, 0xD6, 0x6E, 0xAF, 0xDD, 0x49, 0x96, 0xC2, 0x9F, 0xD3, 0xD2,
-    0xCB, 0xAF, 0x73, 0x57, 0xA9, 0x70, 0xB2, 0x70, 0xB4, 0xBD, 0x4F, 0x8B, 0xCF, 0xCB, 0xFB, 0xFB,
-    0xFB, 0x94, 0x3B, 0xE7, 0x68, 0x75, 0x7F, 0xFF, 0xB6, 0x7F, 0x42, 0xEF, 0xC0, 0xC1, 0x3F, 0xA3,
-    0xD5, 0xC3, 0x9D, 0xA6, 0xED, 0x79, 0xBF, 0xA3, 0xED, 0x44, 0xE6, 0xFF, 0xF1, 0x39, 0x77, 0xF5,
-    0xEA, 0x16, 0xB8, 0x35, 0x7C, 0x67, 0x36, 0xDA, 0x39, 0x0B, 0xCE, 0x15, 0xBD, 0x16, 0xD5, 0x42,
-    0x8E, 0x68, 0x97, 0xB4, 0xD4, 0xA6, 0x30, 0x99, 0x84, 0x61, 0xAA, 0xA4, 0x49, 0xDA, 0xB8, 0x0D,
-    0x1A, 0xB2, 0x51, 0x95, 0xC9, 0xF7, 0x41, 0x1F, 0xC8, 0xA4, 0x16, 0x6D, 0xD2, 0x86, 0x0D, 0xD5,
-    0xA1, 0x4D, 0xCD, 0x0D, 0xFC, 0x86, 0xED, 0xB1, 0xB9, 0xCD, 0xCB, 0x5D, 0x5A, 0xA7, 0x0D, 0x12,
-    0x2A, 0x34, 0xF8, 0xF1, 0xB5, 0x50, 0x45, 0x75, 0x26, 0x85, 0xAC, 0x69, 0x14, 0x55, 0xB4, 0x1B,
-    0x57, 0xA4, 0xDF, 0xAA, 0x49, 0xFF, 0xBD, 0xA5, 0xE2, 0x41, 0x4B, 0xD9, 0x66, 0xAF, 0x6C, 0x58,
-    0xAD, 0x51, 0xD2, 0x68, 0x95, 0xB4, 0xDA, 0xC4, 0x6D, 0x6E, 0x82, 0x46, 0x18, 0xB2, 0x42, 0x46,
-    0xD5, 0xC8, 0xD3, 0xBC, 0x1F, 0xCB, 0xDE, 0x1E, 0x5B, 0xA7, 0x29, 0x6E, 0x8A, 0x29, 0x5D, 0x61,
-    0x82, 0x36, 0x35, 0xD4, 0x08, 0x15, 0xD8, 0x94, 0x2E, 0x1C, 0xDD, 0xF5, 0x3C, 0xB8, 0x25, 0x6A,
-    0x8D, 0xF2, 0x0A, 0x5B, 0xF2, 0x2F, 0x27, 0xF5, 0xFD, 0x8E, 0x0E, 0xA3, 0x9A, 0xAE, 0x87, 0x25,
-    0xAD, 0x07, 0x96, 0x52, 0x75, 0x48, 0xA1, 0xBA, 0x38, 0xB7, 0x71, 0x62, 0xD1, 0x4B, 0x22, 0xB0,
-    0x84, 0xD8, 0xE8, 0x44, 0x67, 0x45, 0x20, 0x61, 0x1F, 0x55, 0x38, 0x27, 0xDF, 0xBD, 0xB4, 0x4C,
-    0x30, 0x08, 0x11, 0xF6, 0x30, 0x70, 0xE8, 0x13, 0xF4, 0x16, 0xBD, 0x81, 0xDC, 0x10, 0x3F, 0xB4,
-    0x2C, 0x3F, 0x51, 0x84, 0x25, 0x22, 0x2C, 0x11, 0x61, 0x09, 0x16, 0x37, 0xE6, 0xA5, 0xD1, 0x5F,
-    0xA5, 0x63, 0x2D, 0x53, 0x3C, 0xD0, 0x30, 0x5C, 0x42, 0x77, 0x63, 0x2C, 0xCB, 0x1E, 0x13, 0x3C,
-    0xFE, 0xDB, 0x1D, 0x7C, 0x6F, 0xA9, 0xE7, 0x40, 0x91, 0x7F, 0xB2, 0x4C, 0x57, 0xF2, 0xC0, 0x16,
-    0xF5, 0x66, 0x65, 0x3E, 0x24, 0x58, 0x57, 0xC1, 0x2F, 0x58, 0xEA, 0xB5, 0x6B, 0xEF, 0x18, 0xF6,
-    0x24, 0x0C, 0x5F, 0x3A, 0x45, 0x67, 0xBC, 0x82, 0x23, 0x1E, 0x58, 0x76, 0xEA, 0x06, 0xFE, 0x71,
-    0x43, 0x99, 0x03, 0xA1, 0xD2, 0xCE, 0xF8, 0x0F, 0x1E, 0xA0, 0x2B, 0xA5, 0x0D, 0xBF, 0xDD, 0x23,
-    0x82, 0x7A, 0xAE, 0x24, 0x37, 0x81, 0x44, 0x06, 0x7E, 0x0B, 0xA7, 0xC0, 0xDC, 0xDE, 0xAC, 0xCB,
-    0x32, 0x37, 0x45, 0xC9, 0x6E, 0xB1, 0x2C, 0x97, 0xF0, 0x9C, 0x57, 0x45, 0x89, 0x6E, 0xF2, 0x32,
-    0x93, 0xA9, 0x3A, 0x45, 0x01, 0x91, 0xCC, 0x95, 0x28, 0xE3, 0x5A, 0x9B, 0xCC, 0x62, 0x43, 0x4D,
-    0x56, 0x89, 0x26, 0x97, 0xA9, 0x89, 0x6D, 0xCF, 0xFD, 0x34, 0x15, 0x06, 0xCB, 0x9A, 0x02, 0x06,
-    0xDA, 0xBE, 0xF5, 0xC9, 0xAD, 0x93, 0xC4, 0x26, 0x5F, 0xAB, 0xB7, 0x57, 0xEF, 0x9C, 0x24, 0x2A,
-    0xFD, 0x45, 0xC5, 0x64, 0x7E, 0x9D, 0x0C, 0x2F, 0x8A, 0xC9, 0xAF, 0xA9, 0xBF, 0x4E, 0x3E, 0x83,
-    0x5E, 0xE9, 0xAF, 0x93, 0xCE, 0x18, 0x9A, 0x2E, 0xFD, 0xAE, 0x53, 0xF4, 0x75, 0x8D, 0x50, 0xE1,
-    0xED, 0x33, 0x2D, 0xF9, 0x38, 0xC8, 0x64, 0x1B, 0x7A, 0x4B, 0xE7, 0xD4, 0xC6, 0xBC, 0xC5, 0x54,
-    0x50, 0x2B, 0xFC, 0xA4, 0x71, 0xD0, 0xAE, 0xF9, 0x87, 0x49, 0x58, 0x5F, 0xEF, 0x1F, 0x22, 0x6B,
-    0x97, 0x25, 0xAD, 0xCA, 0x49, 0xFC, 0xD9, 0x43, 0x67, 0x43, 0x67, 0xC7, 0xE2, 0xC1, 0x87, 0x55,
-    0x93, 0xFC, 0xB3, 0xC9, 0xB5, 0x48, 0x4D, 0x9B, 0xAA, 0x36, 0x79, 0xB4, 0x91, 0xCB, 0x36, 0x67,
-    0x8F, 0x3A, 0xC0, 0x88, 0xD5, 0xE0, 0x4E, 0xBB, 0xD4, 0x62, 0x35, 0xF8, 0xEB, 0x38, 0x68, 0x26,
-    0xF0, 0xE2, 0x44, 0x61, 0xCD, 0x36, 0x42, 0x64, 0xF0, 0x9A, 0xFC, 0xB0, 0x4E, 0x87, 0x49, 0x39,
-    0x49, 0x0C, 0x1D, 0x50, 0x7E, 0x4D, 0x16, 0x99, 0xE4, 0xB0, 0x99, 0x50, 0xDA, 0x7A, 0xC6, 0xD2,
-    0x7F, 0x16, 0xDB, 0xA0, 0xD1, 0xA2, 0x52, 0x8B, 0x7A, 0x2D, 0xAA, 0xB6, 0xA8, 0xDD, 0xA2, 0x82,
-    0x8B, 0x3A, 0x2E, 0xAA, 0xB9, 0xA8, 0x29, 0x6D, 0xCF, 0x95, 0x0D, 0x5D, 0x35, 0xD3, 0x57, 0x3C,
-    0xAC, 0x67, 0x2A, 0x67, 0x6F, 0x36, 0x33, 0xAD, 0x17, 0x15, 0x67, 0x95, 0x07, 0xDD, 0x59, 0xEB,
-    0x41, 0xFD, 0x16, 0x31, 0x3C, 0x58, 0x60, 0xD1, 0x08, 0x2D, 0xA0, 0x6A, 0xB0, 0x43, 0x2B, 0xE6,
-    0xA6, 0x18, 0x67, 0x34, 0xB3, 0x46, 0xD6, 0xCC, 0x0D, 0x12, 0x48, 0x84, 0x96, 0xA8, 0x85, 0x15,
-    0x65, 0xAA, 0x32, 0x44, 0xDE, 0xBA, 0x0F, 0xB6, 0xBC, 0x14, 0x75, 0x6E, 0x84, 0x2D, 0xA4, 0x28,
-    0x35, 0xB0, 0x67, 0x82, 0xB0, 0x6F, 0xF1, 0x16, 0x46, 0x0E, 0xAA, 0x69, 0x40, 0xE6, 0xA5, 0x23,
-    0x50, 0x1D, 0x75, 0x04, 0xBA, 0xCD, 0x16, 0x31, 0xAD, 0xA3, 0x86, 0x69, 0x21, 0x0E, 0xA8, 0xE3,
-    0x92, 0xE9, 0xB1, 0x1B, 0x98, 0x21, 0x06, 0xCB, 0x23, 0xE8, 0x4C, 0x66, 0x52, 0x23, 0x4C, 0x52,
-    0x46, 0x25, 0x63, 0x4F, 0x71, 0xAF, 0x23, 0x5E, 0x23, 0x33, 0x08, 0x66, 0xA3, 0x61, 0xFD, 0x02,
-    0xB0, 0x96, 0x43, 0xD1, 0x0C, 0xBD, 0x37, 0x32, 0x68, 0x3C, 0x23, 0x51, 0x83, 0x2A, 0xAE, 0x41,
-    0x06, 0xBC, 0x37, 0x45, 0xD8, 0x80, 0x30, 0x68, 0x98, 0xB2, 0x61, 0xD2, 0x83, 0xD9, 0xCE, 0x16,
-    0x00, 0x03, 0x15, 0x3A, 0x13, 0x7D, 0x56, 0x25, 0xF7, 0xAC, 0x50, 0x4D, 0x46, 0x77, 0x47, 0x10,
-    0x67, 0x49, 0x32, 0x7C, 0xC1, 0x89, 0x6A, 0x4A, 0x2B, 0xCA, 0x01, 0x3A, 0x0A, 0x8C, 0x19, 0x42,
-    0x21, 0x2D, 0x83, 0xB0, 0xA5, 0x70, 0xCF, 0x43, 0x63, 0xE3, 0xF1, 0x4C, 0x63, 0x29, 0xC9, 0x9F,
-    0x8E, 0xA0, 0x1A, 0xD0, 0x36, 0x95, 0x48, 0x12, 0x68, 0xB8, 0xD3, 0x45, 0x2C, 0x90, 0xC0, 0x43,
-    0x18, 0x58, 0x20, 0x88, 0x19, 0x03, 0x57, 0x97, 0x90, 0x5A, 0xE8, 0x90, 0x92, 0x8A, 0x5D, 0x87,
-    0x31, 0x33, 0x29, 0xC7, 0x44, 0x4B, 0x9B, 0x5F, 0x37, 0xCB, 0xA0, 0xD6, 0x1E, 0x74, 0x72, 0xC5,
-    0x56, 0xD0, 0x00, 0xA4, 0x74, 0xF3, 0x49, 0x0D, 0xD7, 0x49, 0xAA, 0x43, 0x8F, 0xB0, 0x9C, 0xB6,
-    0xC6, 0xCC, 0x25, 0x6C, 0x4E, 0xF3, 0xF6, 0x56, 0xB9, 0x39, 0xC4, 0xCF, 0xBC, 0xFE, 0x0A, 0x2C,
-    0x97, 0x48, 0x5E, 0x94, 0x81, 0xF7, 0x1E, 0x03, 0xEF, 0x07, 0x3C, 0x5C, 0xE9, 0x00, 0xEE, 0xC0,
-    0xDB, 0xA0, 0xC3, 0x10, 0x4E, 0x80, 0x92, 0x61, 0x0B, 0xD0, 0x8A, 0x1A, 0x64, 0x87, 0xA8, 0x86,
-    0x18, 0x91, 0x85, 0x72, 0x51, 0xE5, 0x35, 0xC4, 0x2E, 0xC4, 0x46, 0x70, 0x9A, 0x49, 0x81, 0xCF,
-    0x74, 0x8A, 0x06, 0x70, 0x3B, 0xCB, 0x1B, 0x83, 0xE5, 0xF4, 0x91, 0x93, 0xA4, 0x79, 0xF5, 0x42,
-    0x76, 0x0B, 0x81, 0x92, 0xB8, 0xC7, 0x54, 0x3C, 0x75, 0x0A, 0x88, 0x5B, 0x75, 0x94, 0xDA, 0x1B,
-    0xFA, 0x23, 0x7B, 0x4A, 0x0B, 0x4B, 0x3A, 0xB5, 0x34, 0xCE, 0x4B, 0xBA, 0x5B, 0x28, 0xEA, 0x18,
-    0x81, 0x2B, 0x0F, 0xC4, 0x3E, 0x7C, 0x18, 0x3A, 0xB7, 0xFA, 0xF9, 0x01, 0xEE, 0x09, 0x0C, 0x23,
-    0x60, 0x52, 0xD1, 0xF4, 0xA9, 0xCB, 0x47, 0x97, 0x73, 0x2D, 0xE7, 0xF3, 0xFE, 0x9B, 0x8F, 0xBF,
-    0xBF, 0xA6, 0x3E, 0x27, 0x27, 0x8F, 0x28, 0xD0, 0x50, 0xCD, 0x97, 0x15, 0x17, 0x5C, 0x37, 0x8F,
-    0xDC, 0x77, 0x3A, 0x80, 0x3D, 0x7E, 0x42, 0x9A, 0x83, 0xC0, 0x4F, 0xF6, 0x9D, 0xA5, 0x98, 0xD3,
-    0x59, 0xEB, 0xF7, 0x04, 0xDB, 0x7B, 0xB6, 0xD7, 0xA9, 0x4F, 0x39, 0x71, 0x9F, 0x18, 0x69, 0x65,
-    0xBA, 0xFE, 0x4E, 0x2F, 0x18, 0xFB, 0x70, 0x34, 0xBC, 0x46, 0x47, 0x3A, 0xA6, 0x0D, 0xFC, 0xB6,
-    0x83, 0x77, 0x76, 0x07, 0xAF, 0xD7, 0xF1, 0x7A, 0x05, 0xAF, 0x05, 0x66, 0xC7, 0x6A, 0x05, 0xDF,
-    0xD6, 0x29, 0xA8, 0x16, 0xD2, 0xA1, 0x17, 0xE8, 0x72, 0xD6, 0x03, 0x40, 0x1F, 0xFE, 0xC5, 0xAF,
-    0x56, 0x7C, 0x60, 0x74, 0x8E, 0x55, 0xFE, 0x8B, 0xF3, 0x37, 0xA7, 0x3D, 0x84, 0x36, 0xBF, 0xF1,
-    0x4A, 0x4A, 0x3B, 0xF1, 0xF6, 0xB0, 0x97, 0x59, 0xC6, 0x4D, 0x0B, 0x61, 0x4F, 0xC5, 0xD5, 0x99,
-    0x1F, 0xE5, 0x24, 0x00, 0x2D, 0x3B, 0xA8, 0x1A, 0x1E, 0x28, 0xD9, 0xAD, 0x9F, 0x4A, 0x9E, 0xA6,
-    0x26, 0xDB, 0x19, 0xA3, 0xC0, 0x31, 0xB1, 0xEB, 0x0A, 0xF7, 0xDF, 0x4D, 0xE7, 0xFE, 0x9C, 0x7F,
-    0x5A, 0x87, 0x9D, 0x2E, 0x2F, 0x5F, 0xD2, 0x6F, 0x96, 0x5F, 0xB5, 0xB4, 0xC1, 0xF8, 0xD6, 0xD2,
-    0x8D, 0x25, 0xEC, 0xF1, 0x1B, 0x74, 0xA3, 0xCF, 0xE8, 0x83, 0x5D, 0x55, 0xCE, 0x55, 0x80, 0xD4,
-    0x8E, 0xBC, 0x18, 0xD3, 0xCC, 0x3B, 0xCB, 0xE1, 0x1E, 0xA3, 0x6A, 0xEA, 0x2B, 0x00, 0xF2, 0xA8,
-    0xE6, 0x43, 0xD4, 0x27, 0xDE, 0xBB, 0x43, 0xF6, 0xE6, 0xF0, 0xA4, 0x84, 0x5F, 0xF2, 0xA6, 0xF4,
-    0x8E, 0xCF, 0x6A, 0x78, 0x46, 0xF1, 0x37, 0xAC, 0xD8, 0xC3, 0x27, 0x76, 0x44, 0x74, 0x5B, 0x70,
-    0x13, 0xBC, 0x42, 0xCF, 0xC1, 0x22, 0xE7, 0x40, 0xC7, 0x04, 0xCD, 0x5D, 0x71, 0x70, 0xA2, 0x4B,
-    0x5F, 0x97, 0x84, 0x48, 0xD6, 0x91, 0xBB, 0x45, 0xD1, 0xA4, 0x2F, 0x1C, 0x62, 0xF4, 0x64, 0xEA,
-    0x27, 0x02, 0x22, 0xF2, 0x32, 0xB3, 0xA5, 0xB8, 0xA3, 0x54, 0x58, 0xDD, 0x57, 0x73, 0x5E, 0xA7,
-    0xDD, 0x94, 0x01, 0xC2, 0x79, 0xC6, 0x64, 0x81, 0x81, 0x67, 0x02, 0x6F, 0x8E, 0x98, 0xCF, 0x84,
-    0xC2, 0x8F, 0x9F, 0x61, 0x20, 0x16, 0x19, 0x2C, 0xC8, 0x0A, 0x3E, 0x05, 0xFA, 0xF6, 0xFE, 0xDC,
-    0xF7, 0x02, 0x8D, 0xF9, 0x70, 0x57, 0xD1, 0x39, 0x93, 0x3E, 0x75, 0x32, 0xAB, 0xB8, 0x8C, 0xD0,
-    0x8C, 0x69, 0x56, 0x2B, 0x44, 0x36, 0xEE, 0x85, 0xCC, 0xCB, 0x44, 0x65, 0xA8, 0xEC, 0xBC, 0x4C,
-    0x55, 0xBF, 0x58, 0xD1, 0xCB, 0x14, 0x40, 0xA6, 0x10, 0xF2, 0x24, 0x50, 0x96, 0x2B, 0x17, 0x5D,
-    0xE1, 0xA7, 0xD2, 0xC7, 0x4C, 0xD4, 0xF4, 0x5B, 0x12, 0xD9, 0xDE, 0x45, 0xFD, 0xCE, 0x6C, 0xD1,
-    0xB1, 0xA4, 0x05, 0xB0, 0xF6, 0xDD, 0xDB, 0xA5, 0xEA, 0x97, 0x60, 0x9B, 0xA4, 0x75, 0x7F, 0xF7,
-    0xAA, 0x94, 0xF4, 0x4C, 0x63, 0xA9, 0x33, 0xCB, 0x32, 0xE7, 0x96, 0x25, 0xEE, 0xE5, 0xCC, 0xBD,
-    0xD4, 0x40, 0x15, 0xC5, 0x32, 0xB3, 0xA4, 0xDA, 0xE3, 0xF3, 0x98, 0x2D, 0x26, 0x27, 0x5E, 0xC6,
-    0xD6, 0x4B, 0xD8, 0x78, 0xF9, 0x6A, 0xFE, 0xB0, 0x5B, 0x58, 0x1F, 0x08, 0x5B, 0x73, 0xC1, 0x02,
-    0x9F, 0x45, 0x20, 0x13, 0xD8, 0x43, 0x22, 0xD8, 0x11, 0xF2, 0x60, 0xC4, 0x57, 0x51, 0x1D, 0x17,
-    0xC5, 0x99, 0xF7, 0x10, 0xCA, 0x80, 0x2E, 0x2C, 0xEB, 0xDE, 0x46, 0xDE, 0x09, 0x1C, 0x32, 0x4F,
-    0x1B, 0x74, 0xA2, 0x42, 0x55, 0x3E, 0x09, 0x4B, 0x8C, 0x7E, 0x6B, 0xD8, 0x1A, 0xA9, 0x05, 0x4C,
-    0x53, 0x51, 0xC2, 0x22, 0xB0, 0x19, 0xD0, 0x39, 0xAB, 0x19, 0xA6, 0x0B, 0x46, 0x31, 0xF6, 0xF7,
-    0x44, 0xB1, 0xD7, 0xA1, 0x78, 0x3B, 0x43, 0x33, 0x24, 0x63, 0xB9, 0x0A, 0xC3, 0x7E, 0x84, 0x4A,
-    0x7B, 0x32, 0x8C, 0x85, 0x8C, 0xDA, 0x63, 0x89, 0x7F, 0x5F, 0xD7, 0x38, 0x3B, 0xF8, 0x0E, 0xFC,
-    0xB1, 0x29, 0x7A, 0x70, 0x75, 0x73, 0x5A, 0x0D, 0xB3, 0x67, 0x27, 0x43, 0x51, 0x2D, 0x7B, 0xE7,
-    0xCF, 0xA6, 0xC1, 0xB1, 0x31, 0x75, 0xF5, 0x83, 0x39, 0xC8, 0x05, 0xC3, 0x66, 0x0D, 0x3A, 0x32,
-    0x66, 0x5D, 0xFB, 0x02, 0xAE, 0x16, 0x1D, 0x21, 0xF8, 0x5E, 0x34, 0x78, 0x12, 0x64, 0xA3, 0xA3,
-    0x27, 0x7B, 0x18, 0x98, 0xFD, 0x77, 0x18, 0xC0, 0xFE, 0xDA, 0xD1, 0x63, 0xF0, 0x65, 0xF0, 0xF6,
-    0xED, 0x7B, 0x38, 0xB8, 0x01, 0x5A, 0x1F, 0xE7, 0x2E, 0x42, 0xA1, 0x1C, 0x19, 0x37, 0xED, 0xFC,
-    0x5C, 0xA0, 0xE7, 0xEE, 0x4A, 0x29, 0x40, 0x13, 0x6C, 0xEF, 0xDF, 0x86, 0x09, 0xF6, 0xDE, 0x03,
-    0x04, 0x83, 0xA2, 0x45, 0xEF, 0xE6, 0xD4, 0xFE, 0x79, 0x12, 0x43, 0x40, 0x3E, 0x66, 0x81, 0xB4,
-    0x5F, 0x1D, 0x3B, 0x90, 0xA0, 0xA7, 0xBF, 0x33, 0x94, 0xFE, 0xE7, 0x67, 0x06, 0x00, 0x67, 0x56,
-    0x51, 0x72, 0xE7, 0x5F, 0x56, 0x34, 0xBA, 0xD8, 0xD1, 0x99, 0x0D, 0xA4, 0xD4, 0x0D, 0xC1, 0x49,
-    0x90, 0x7C, 0x86, 0x39, 0x88, 0x3A, 0xBE, 0x82, 0xE6, 0xB8, 0x27, 0x88, 0x0A, 0x2E, 0x58, 0x15,
-    0x6A, 0x03, 0xB0, 0xBC, 0xC6, 0xE6, 0x56, 0xB3, 0x5C, 0xD3, 0xF4, 0x27, 0x3B, 0xC5, 0x35, 0x7F,
-    0x52, 0xFB, 0xF3, 0xCD, 0x04, 0xC5, 0x17, 0x17, 0x60, 0x67, 0xA7, 0xD0, 0xFE, 0x5D, 0x5A, 0x3F,
-    0x77, 0xE4, 0x37, 0x33, 0x55, 0x2C, 0x20, 0xF2, 0x06, 0xA7, 0x0E, 0xF7, 0x39, 0x87, 0xE0, 0x05,
-    0xE4, 0x38, 0xB4, 0x73, 0xF3, 0x09, 0x9C, 0x4F, 0xD6, 0x79, 0xD8, 0x65, 0x0F, 0x28, 0xFE, 0x90,
-    0x4E, 0xB1, 0xDD, 0x23, 0xBB, 0xC7, 0x75, 0x8F, 0xEA, 0xB2, 0xE6, 0x54, 0x59, 0xAF, 0xF7, 0xC7,
-    0xAA, 0xDE, 0x1B, 0x39, 0x88, 0x63, 0xAE, 0x27, 0xC4, 0x7D, 0x76, 0xA6, 0xAF, 0x7E, 0xCB, 0xB0,
-    0x84, 0x72, 0x73, 0x55, 0x03, 0xAC, 0x72, 0xCE, 0x69, 0x6B, 0xBF, 0xD0, 0x58, 0x79, 0x05, 0xC5,
-    0x07, 0x8D, 0xF8, 0xB8, 0x35, 0x0A, 0xA6, 0xAA, 0x65, 0xAA, 0xCE, 0x4B, 0x5B, 0x3C, 0xAC, 0xF2,
-    0xFB, 0xE5, 0xD2, 0x15, 0xC3, 0x5E, 0x0E, 0x27, 0x14, 0xDE, 0x05, 0x37, 0x7C, 0x12, 0xBB, 0xEE,
-    0x5D, 0xCF, 0xB2, 0xE3, 0xC1, 0x5D, 0x23, 0xB3, 0x15, 0xDF, 0x6F, 0xC5, 0x87, 0xAD, 0x88, 0xDB,
-    0x34, 0x1A, 0xAC, 0x8C, 0xC8, 0xB2, 0x79, 0x17, 0xD8, 0xF5, 0xEC, 0x83, 0x6A, 0x27, 0x76, 0xE6,
-    0x00, 0x31, 0x7D, 0xA6, 0x37, 0xC1, 0x96, 0x37, 0x32, 0x83, 0xA6, 0xFE, 0xFC, 0xE3, 0x8E, 0xE2,
-    0x47, 0xCC, 0x73, 0xCD, 0xC3, 0x3D, 0x9F, 0x91, 0xB1, 0x30, 0xF8, 0x85, 0xE2, 0xFB, 0x24, 0xDE,
-    0x4E, 0xA5, 0xF8, 0x47, 0xEE, 0x11, 0xEF, 0x5D, 0xFD, 0xEF, 0x3D, 0xEC, 0x49, 0x35, 0xD6, 0x5F,
-    0x54, 0x01, 0xE4, 0x8F, 0x3F, 0xDD, 0xA5, 0xF4, 0xA3, 0x4C, 0xC6, 0xE2, 0xD5, 0x3E, 0x48, 0xFC,
-    0xAE, 0xC4, 0xD5, 0x14, 0x56, 0xA7, 0x3D, 0xBC, 0x39, 0x1C, 0x1D, 0x07, 0x5C, 0xE6, 0xFB, 0xF2,
-    0x0C, 0xCB, 0x92, 0x7A, 0x4E, 0x1B, 0x7B, 0xE3, 0x45, 0x2D, 0xAA, 0xCA, 0xB7, 0x9A, 0xA4, 0xC9,
-    0x8D, 0xE3, 0xAA, 0xB4, 0xD8, 0x9C, 0x88, 0xCA, 0x17, 0x96, 0x29, 0xAA, 0x46, 0x54, 0x96, 0xA8,
-    0x92, 0x50, 0x5A, 0x56, 0x59, 0x5F, 0x5B, 0x8E, 0xFA, 0xE2, 0x72, 0x7D, 0x8E, 0x75, 0x7F, 0xE2,
-    0x45, 0x38, 0xC9, 0x46, 0xDD, 0xF0, 0x34, 0x73, 0x3D, 0x20, 0x87, 0xA8, 0x00, 0xE9, 0xA9, 0xC5,
-    0xC0, 0x88, 0x0D, 0x88, 0x3A, 0xDF, 0x4B, 0xB2, 0x35, 0x1C, 0x5B, 0xFB, 0xB9, 0x3C, 0x84, 0x03,
-    0x64, 0xC0, 0x36, 0xF1, 0x1E, 0x88, 0xA7, 0xD3, 0x1C, 0x3F, 0xAD, 0xF5, 0x67, 0x6F, 0x1A, 0xE8,
-    0x16, 0x58, 0xFA, 0x69, 0xBF, 0xF4, 0xFE, 0x16, 0x48, 0x6C, 0xB2, 0x98, 0x4E, 0x63, 0xBE, 0x5E,
-    0x82, 0x59, 0x8D, 0x8A, 0x82, 0xCA, 0x68, 0x75, 0xFE, 0xB9, 0xFE, 0xAA, 0xE5, 0x70, 0xE6, 0x7C,
-    0x31, 0xA7, 0x67, 0x9A, 0x97, 0xD7, 0x3D, 0x57, 0xDE, 0x85, 0xF6, 0x22, 0xAD, 0xCF, 0x87, 0xEA,
-    0xC7, 0x05, 0x30, 0x43, 0x03, 0x05, 0xF8, 0x7E, 0x36, 0x32, 0x67, 0xFB, 0x3F, 0x0A, 0x0C, 0x47,
-    0xA7, 0xE3, 0x3E, 0xFF, 0xF3, 0xC0, 0xD0, 0x28, 0x32, 0x37, 0x98, 0x96, 0x3B, 0x3F, 0x23, 0x5C,
-    0xA5, 0x36, 0xFC, 0x6F, 0xCC, 0xF9, 0x99, 0x5C, 0x9C, 0x2B, 0xB5, 0x59, 0x93, 0xF3, 0x43, 0x35,
-    0x7F, 0xCF, 0xD5, 0xCC, 0x1C, 0x8A, 0x95, 0x3D, 0xC7, 0x8A, 0x2B, 0xAD, 0x46, 0x7E, 0x8E, 0xC6,
-    0xAF, 0x5A, 0x9E, 0x3F, 0x46, 0x41, 0x0B, 0xC7, 0xDD, 0x6F, 0x71, 0x54, 0x7E, 0xA5, 0xBF, 0x4E,
-    0x3A, 0x23, 0x6F, 0xB3, 0x46, 0xD8, 0xB8, 0x8C, 0xCC, 0x49, 0xE8, 0xFD, 0xDF, 0x77, 0x32, 0x32,
-    0x28, 0xB3, 0x6D, 0xD6, 0xE4, 0xED, 0xC9, 0x66, 0x84, 0x2A, 0xA9, 0x2E, 0xBF, 0x7E, 0xF9, 0xF5,
-    0xA4, 0x3A, 0x19, 0x17, 0xE8, 0xA1, 0xBE, 0x9D, 0xE6, 0xFF, 0x03, 0x65, 0x54, 0x31, 0x6F, 0x1C,
-    0x45, 0x14, 0xFE, 0x76, 0x06, 0x65, 0x25, 0x46, 0xCA, 0xB8, 0xA1, 0x89, 0x25, 0x0F, 0x25, 0x18,
-    0x29, 0x9B, 0x82, 0x22, 0x48, 0xF6, 0xED, 0x24, 0x14, 0x14, 0x14, 0x49, 0x01, 0x95, 0x0B, 0x37,
-    0x14, 0x11, 0x12, 0x1C, 0x65, 0x24, 0x7C, 0x77, 0x1B, 0x90, 0xA0, 0xA0, 0xC0, 0xFF, 0x20, 0x2E,
-    0x52, 0x58, 0x17, 0x09, 0x17, 0x58, 0x22, 0xA0, 0xBB, 0xEC, 0x04, 0x0A, 0xDA, 0x41, 0x44, 0x4A,
-    0x41, 0x91, 0x09, 0x58, 0x24, 0xE0, 0xC2, 0x83, 0x34, 0x36, 0x9B, 0x68, 0xED, 0xE1, 0xCD, 0x9E,
-    0xA3, 0x18, 0x79, 0xF5, 0x4E, 0xDA, 0x7B, 0x3B, 0xEF, 0xBD, 0xF9, 0xBE, 0xF7, 0xBD, 0x07, 0x00,
-    0x7D, 0xCB, 0xF6, 0x43, 0x6E, 0x5B, 0x69, 0x5A, 0x55, 0xB5, 0x85, 0x6E, 0x4B, 0xB4, 0x65, 0xD6,
-    0xF4, 0xB8, 0xEF, 0x71, 0x57, 0x0A, 0xA3, 0xFA, 0x3A, 0x6F, 0xC0, 0x6C, 0xEE, 0x58, 0x05, 0x94,
-    0x46, 0x19, 0x69, 0x54, 0x55, 0xE8, 0x12, 0x25, 0x7A, 0x28, 0x37, 0xE6, 0xC9, 0xDB, 0x82, 0xB7,
-    0x90, 0x0D, 0xCE, 0x07, 0x7C, 0xEB, 0xD9, 0x4F, 0x5E, 0xBC, 0xED, 0x16, 0x56, 0x76, 0xCA, 0x78,
-    0xF4, 0xCA, 0xEA, 0x7D, 0x48, 0x83, 0xDA, 0x65, 0xE3, 0x8D, 0x2C, 0x36, 0x9C, 0x6C, 0xBC, 0x2D,
-    0x70, 0xE1, 0x2C, 0x20, 0xA3, 0x5E, 0xD8, 0x72, 0xE0, 0x9E, 0xEC, 0x3A, 0xF7, 0x93, 0xDC, 0x95,
-    0x5B, 0x95, 0x78, 0x8A, 0xF4, 0x8C, 0x1C, 0x7F, 0x14, 0xA4, 0xF1, 0x05, 0x15, 0xA4, 0x7F, 0x51,
-    0xDF, 0x95, 0x86, 0x0E, 0xB4, 0x64, 0xC2, 0x4E, 0xA4, 0xE9, 0x8D, 0x20, 0x02, 0x54, 0x6C, 0x8A,
-    0xD8, 0xF4, 0xC6, 0xFE, 0xCD, 0xCC, 0xCD, 0x71, 0x03, 0x09, 0x9C, 0x07, 0xD6, 0x00, 0x4A, 0xE9,
-    0x20, 0x0C, 0x14, 0xF0, 0x7A, 0x97, 0x2F, 0xAB, 0x6D, 0xFE, 0x67, 0x43, 0x08, 0xA5, 0x69, 0xE4,
-    0x23, 0x9F, 0xC7, 0x8A, 0xC7, 0xAA, 0x50, 0x54, 0xD4, 0xB7, 0x54, 0x9A, 0xFB, 0xE1, 0xAA, 0x39,
-    0x2E, 0x5D, 0x5B, 0xBE, 0x1F, 0xD2, 0xC9, 0x6A, 0x42, 0x74, 0x90, 0xC9, 0x07, 0x2D, 0x7B, 0x4A,
-    0x04, 0xA4, 0xA4, 0x17, 0x85, 0xE9, 0xF5, 0xA1, 0x76, 0x80, 0xEB, 0x2F, 0xAC, 0x8C, 0xCD, 0x28,
-    0x36, 0x27, 0x3D, 0xF4, 0x74, 0xCE, 0x36, 0x41, 0x89, 0x2D, 0xBD, 0x77, 0xA9, 0xB1, 0x38, 0xDE,
-    0x9C, 0x39, 0x41, 0x54, 0x16, 0xC8, 0x1A, 0xE4, 0x2E, 0xD1, 0x53, 0xE8, 0x04, 0x73, 0x08, 0x4C,
-    0x4F, 0xD8, 0x00, 0x44, 0x2F, 0x9D, 0x82, 0xAC, 0xC0, 0x4C, 0x17, 0x4F, 0x4C, 0x37, 0xCF, 0xBD,
-    0xAA, 0x4A, 0x91, 0x33, 0xA3, 0x77, 0xB2, 0x59, 0x96, 0x69, 0xD7, 0x0D, 0x9F, 0x1C, 0x83, 0x2E,
-    0xA8, 0xFC, 0xD2, 0xAB, 0x5D, 0x42, 0xDD, 0xA8, 0x7B, 0x4D, 0x71, 0x39, 0x94, 0xDC, 0x93, 0x0D,
-    0xB9, 0x1F, 0xF0, 0x67, 0xD7, 0xB2, 0x3B, 0x1D, 0xE4, 0x8A, 0xFF, 0xE1, 0xE5, 0x3D, 0x5F, 0x5C,
-    0x0A, 0x25, 0x0B, 0x43, 0x16, 0xA6, 0x1D, 0x27, 0x44, 0x38, 0x51, 0xBD, 0xA6, 0x74, 0x6F, 0x08,
-    0x41, 0x90, 0x89, 0xD0, 0x91, 0xC9, 0xF7, 0xAA, 0x5C, 0x69, 0xCC, 0x1A, 0x33, 0xBB, 0x34, 0x95,
-    0x99, 0xA4, 0xA2, 0x6F, 0x1C, 0x55, 0x8B, 0xE3, 0xAA, 0x4B, 0xE8, 0xF8, 0x41, 0x93, 0x9B, 0x96,
-    0x9B, 0x16, 0x59, 0x48, 0xCD, 0x90, 0x9A, 0x8E, 0x31, 0x37, 0x27, 0xF5, 0x85, 0xE1, 0xD8, 0xD7,
-    0xD1, 0x8D, 0xC7, 0xEB, 0xC7, 0x27, 0xF7, 0x5B, 0x12, 0x1F, 0xA3, 0x93, 0xAC, 0xC1, 0x8A, 0x45,
-    0xAC, 0x90, 0x7B, 0xB0, 0x70, 0x91, 0x05, 0xBA, 0xC3, 0x68, 0xCB, 0xCE, 0x53, 0x5F, 0x58, 0x48,
-    0x4E, 0xE5, 0xF1, 0xA9, 0xCB, 0x1E, 0xDB, 0xFC, 0x2B, 0x7B, 0x56, 0x9A, 0xE5, 0xD5, 0xFB, 0x31,
-    0xB6, 0xEF, 0xF7, 0xD7, 0x09, 0x38, 0xAB, 0x2D, 0xA3, 0x84, 0xB1, 0x65, 0xB1, 0xE5, 0x7F, 0x4F,
-    0xB8, 0x7E, 0x2D, 0x4F, 0x02, 0xAB, 0xE4, 0x6D, 0xEA, 0x5A, 0xA0, 0xF0, 0x25, 0x16, 0x96, 0x09,
-    0xF8, 0x96, 0x11, 0x47, 0x1D, 0x29, 0xFD, 0xC0, 0x42, 0x2B, 0xCC, 0xB6, 0xAC, 0x3A, 0x28, 0x75,
-    0x55, 0xBE, 0xE3, 0x3A, 0x4E, 0xC8, 0xDC, 0xB2, 0x30, 0x45, 0x27, 0xFA, 0x32, 0xFA, 0x51, 0xF4,
-    0x3F, 0xDC, 0x76, 0x8E, 0x1B, 0x2D, 0x34, 0x16, 0x80, 0x25, 0x80, 0xF2, 0x39, 0xE4, 0x9D, 0xDC,
-    0xA8, 0x15, 0xD7, 0x66, 0xAD, 0xED, 0x80, 0x24, 0x6D, 0xDA, 0x89, 0xF0, 0x81, 0x47, 0xCB, 0xA2,
-    0x55, 0x57, 0x68, 0x84, 0x9A, 0x35, 0xD6, 0x0C, 0x98, 0x2F, 0x57, 0xEC, 0xAC, 0x74, 0x16, 0x2B,
-    0xF1, 0xAB, 0x53, 0x97, 0x7C, 0x99, 0x85, 0x64, 0x2C, 0xA8, 0x9B, 0x3E, 0x7F, 0xEC, 0x93, 0x14,
-    0x84, 0xF9, 0x44, 0xE9, 0xEF, 0xA7, 0x28, 0x1C, 0xB0, 0xFD, 0xC2, 0xEA, 0x18, 0xC8, 0x4E, 0x7A,
-    0x52, 0xC1, 0x99, 0x13, 0x88, 0x91, 0xF8, 0xF4, 0xB3, 0x5B, 0x8C, 0xC7, 0x1B, 0x71, 0xF6, 0x9E,
-    0xE9, 0xD3, 0x02, 0x9B, 0x1E, 0xAB, 0xE3, 0xD8, 0x26, 0x5D, 0xEB, 0xC8, 0x4F, 0xFD, 0x24, 0x38,
-    0xD0, 0xC0, 0xD5, 0xCE, 0x5B, 0x76, 0x9A, 0xA3, 0x30, 0xEA, 0xB8, 0xB0, 0xC9, 0xA4, 0x3D, 0x56,
-    0xDA, 0xF3, 0x44, 0x94, 0x99, 0xDC, 0x04, 0x7F, 0x8E, 0x6A, 0x7D, 0xF8, 0x5E, 0x1A, 0xAE, 0x1B,
-    0x84, 0x25, 0xE9, 0x6A, 0xCA, 0xDD, 0x84, 0x88, 0x50, 0x76, 0xF8, 0xDD, 0x93, 0xE2, 0xF3, 0x80,
-    0x8F, 0x75, 0xFE, 0x9B, 0x55, 0xDC, 0xF5, 0x84, 0x19, 0x14, 0xBA, 0xDE, 0x49, 0xA5, 0xA7, 0x19,
-    0xCA, 0x15, 0x08, 0x12, 0x33, 0x7D, 0xDD, 0x75, 0xEA, 0x72, 0x62, 0x63, 0xD0, 0x09, 0x2F, 0xCD,
-    0xA3, 0xB0, 0x65, 0x5F, 0xD3, 0xD7, 0x97, 0xD7, 0xCF, 0xE5, 0xFE, 0xAD, 0xAC, 0x71, 0x49, 0x15,
-    0x23, 0x9A, 0x25, 0x64, 0x7B, 0x9A, 0x5F, 0x31, 0x0B, 0xC2, 0xDD, 0xC9, 0x03, 0xDB, 0xC4, 0x42,
-    0xAD, 0x5F, 0x4D, 0xF7, 0xB4, 0xD9, 0x96, 0x55, 0x37, 0xCD, 0x40, 0xD2, 0x02, 0x43, 0xBB, 0x86,
-    0xC2, 0xE2, 0xCC, 0x2D, 0x80, 0x5A, 0x98, 0xA4, 0x93, 0xC6, 0x01, 0xFC, 0x9F, 0x6D, 0xF0, 0xDD,
-    0x43, 0xE4, 0x61, 0x0A, 0xE1, 0x26, 0x04, 0xA6, 0xED, 0x7E, 0xEA, 0x46, 0x03, 0x12, 0x3E, 0xCA,
-    0xEC, 0x99, 0xEE, 0xE1, 0xEE, 0xE9, 0x38, 0x3F, 0xD6, 0xDC, 0x51, 0x9C, 0xA5, 0xFE, 0xFC, 0xAC,
-    0x21, 0xF7, 0x3A, 0x65, 0x41, 0x7D, 0x4D, 0x6C, 0xBC, 0xEB, 0x50, 0x92, 0xBE, 0x7A, 0xC4, 0xDA,
-    0xB9, 0x75, 0xE5, 0x84, 0x95, 0xB4, 0x1C, 0x65, 0xA5, 0x74, 0x81, 0xB4, 0x1E, 0x87, 0xC4, 0xD4,
-    0x70, 0xBD, 0xA8, 0x16, 0xBF, 0x70, 0x1F, 0xA1, 0x78, 0x78, 0x50, 0x43, 0xFE, 0x7E, 0x58, 0x68,
-    0xF5, 0x63, 0x53, 0xA0, 0x20, 0xCC, 0x14, 0xEC, 0x69, 0x85, 0x72, 0x37, 0xC4, 0x30, 0xB7, 0x53,
-    0x4C, 0x85, 0xAD, 0xD7, 0x27, 0xA4, 0x3E, 0x4D, 0x11, 0xC5, 0xC3, 0xD3, 0x43, 0xEB, 0xA6, 0xFC,
-    0x60, 0xC2, 0x9A, 0x33, 0xB7, 0x36, 0xC1, 0xFE, 0xAD, 0xA9, 0x0B, 0x4A, 0xB3, 0x46, 0x55, 0xDC,
-    0x2B, 0xCD, 0x69, 0x59, 0xD2, 0x0A, 0x25, 0x2E, 0x08, 0xDB, 0x2F, 0x61, 0x76, 0x47, 0x9A, 0x46,
-    0xEA, 0x58, 0x92, 0x38, 0xCA, 0x24, 0x8B, 0x6F, 0x74, 0xFE, 0xC0, 0xC9, 0xCF, 0x2C, 0xF5, 0x53,
-    0x1C, 0x26, 0x29, 0xBE, 0xA4, 0xCC, 0x12, 0xED, 0x34, 0xA9, 0xD3, 0x94, 0x5D, 0xCD, 0xEC, 0xFC,
-    0x5F, 0xC5, 0x93, 0xFF, 0xAD, 0xF7, 0x0F, 0x94, 0xFD, 0x0F, 0x7D, 0x58, 0x4D, 0x8C, 0xDE, 0x56,
-    0x15, 0xBD, 0xB6, 0x49, 0x9C, 0x8C, 0x95, 0x98, 0x45, 0xAA, 0x0A, 0x26, 0xAD, 0x59, 0x80, 0x14,
-    0xDA, 0x04, 0x23, 0x60, 0x11, 0xA4, 0xE9, 0x3C, 0x17, 0x16, 0x2C, 0x2A, 0xC8, 0x6C, 0x06, 0x16,
-    0x08, 0x85, 0x05, 0x2B, 0x84, 0x9A, 0x8A, 0x6E, 0x90, 0x68, 0xC6, 0x86, 0xCD, 0x48, 0x20, 0xA1,
-    0x6E, 0xBA, 0x0E, 0x52, 0xBB, 0x48, 0x67, 0x04, 0x13, 0x89, 0x48, 0x44, 0x22, 0x60, 0x27, 0x11,
-    0x62, 0x11, 0x89, 0x7C, 0x10, 0x45, 0x2C, 0xE3, 0x8A, 0xA8, 0x09, 0x01, 0x31, 0x6E, 0xE4, 0xA8,
-    0x9E, 0x19, 0xDB, 0x8F, 0x73, 0xEE, 0xF3, 0x37, 0xD3, 0x6E, 0xB0, 0x34, 0xF7, 0xF9, 0xB3, 0xFD,
-    0xDE, 0xBB, 0x3F, 0xE7, 0x9E, 0x7B, 0xDF, 0x88, 0xE8, 0x15, 0xD9, 0x1A, 0xB2, 0xDC, 0xEA, 0x44,
-    0x82, 0x3E, 0x80, 0x8C, 0x9B, 0x00, 0x4F, 0x12, 0x3E, 0x15, 0x53, 0x39, 0xB9, 0xBA, 0xBA, 0x2A,
-    0x79, 0x61, 0xAD, 0x85, 0x4C, 0xEA, 0x94, 0x72, 0x96, 0x88, 0x29, 0xD2, 0xD9, 0x51, 0xBC, 0xE5,
-    0x57, 0xF1, 0x4E, 0x7E, 0x2F, 0x13, 0x1F, 0x9F, 0xCC, 0x44, 0xBC, 0xF2, 0xAD, 0x0C, 0xF3, 0xAC,
-    0x6E, 0x30, 0x97, 0x6F, 0xE0, 0xF9, 0x28, 0xD7, 0x44, 0x9E, 0xB5, 0x1B, 0x2D, 0x16, 0xB5, 0xB6,
-    0x91, 0xE9, 0xF2, 0x6E, 0x15, 0xD8, 0xFD, 0x36, 0xEE, 0x16, 0x2F, 0x89, 0x84, 0x5C, 0x23, 0x1F,
-    0xF3, 0xD6, 0xB7, 0x3F, 0xCA, 0xBB, 0x70, 0x38, 0xFB, 0x87, 0x36, 0xEE, 0x5E, 0x7B, 0x58, 0xA7,
-    0xCD, 0x93, 0x3F, 0x8B, 0x79, 0xEF, 0x6E, 0x21, 0xF9, 0xDD, 0xBF, 0x64, 0x92, 0xDF, 0x3A, 0x07,
-    0xBD, 0x6F, 0x3F, 0x07, 0xF1, 0xD7, 0xD3, 0x10, 0xFF, 0x39, 0x2B, 0x92, 0xF7, 0x57, 0xB0, 0x72,
-    0x5B, 0x07, 0x92, 0xEE, 0x56, 0x09, 0x6C, 0x7B, 0x3C, 0x48, 0xC0, 0x8D, 0x82, 0x4B, 0xEF, 0xC2,
-    0xD4, 0xE3, 0xD8, 0x21, 0xC6, 0xB7, 0x72, 0xF4, 0x94, 0xEC, 0x5F, 0x29, 0x1C, 0xE0, 0xDB, 0xAD,
-    0x5E, 0xE2, 0x36, 0x1C, 0x60, 0x4D, 0x30, 0x88, 0xCD, 0xFC, 0x3E, 0x18, 0xC5, 0xAF, 0xC3, 0x9E,
-    0x33, 0x28, 0x92, 0xF6, 0x87, 0xEB, 0xD0, 0xA0, 0xBC, 0xDF, 0x9A, 0x26, 0xFD, 0xB0, 0x83, 0xB8,
-    0xD9, 0x98, 0xDA, 0x14, 0x02, 0x91, 0x41, 0xE4, 0xD8, 0xB7, 0x29, 0xB1, 0x5A, 0x3B, 0x7A, 0x98,
-    0x31, 0x84, 0x59, 0x64, 0x87, 0x0B, 0xE2, 0x59, 0x3B, 0xB8, 0x2D, 0x44, 0x4E, 0x88, 0x5A, 0xDD,
-    0xCB, 0x05, 0x0A, 0x6C, 0x03, 0xD1, 0xCB, 0x75, 0xC1, 0x26, 0xD7, 0x24, 0xEA, 0xE5, 0x07, 0x12,
-    0x77, 0xDC, 0xAE, 0xA5, 0xA0, 0x6F, 0x92, 0x46, 0xD5, 0xC3, 0x02, 0x66, 0xF7, 0x32, 0xC4, 0x6C,
-    0x8A, 0xC8, 0x82, 0x7D, 0x5C, 0x48, 0x62, 0x2D, 0x9C, 0x66, 0xE7, 0x7E, 0xF6, 0x28, 0x5E, 0xB4,
-    0x8F, 0xE0, 0x03, 0xDB, 0x1F, 0xD8, 0x36, 0x32, 0x26, 0xE5, 0x4C, 0xA2, 0x16, 0x8B, 0xC5, 0x35,
-    0x96, 0x4D, 0x66, 0xF1, 0x4C, 0xD2, 0xEA, 0x30, 0x5E, 0x32, 0xB8, 0x4E, 0x60, 0x65, 0xB8, 0xA9,
-    0xA5, 0xEB, 0xB1, 0x7B, 0x0C, 0x6D, 0x0F, 0x9D, 0x7F, 0x9A, 0x49, 0x6C, 0xA1, 0xF8, 0xA1, 0x0B,
-    0x08, 0xAC, 0x18, 0x6E, 0x74, 0x91, 0x1B, 0xED, 0x3D, 0xF0, 0x61, 0x1B, 0x76, 0x87, 0x2D, 0xA3,
-    0x9C, 0x92, 0x9C, 0xFA, 0x7A, 0x53, 0x20, 0x33, 0x1D, 0xC2, 0x42, 0x87, 0xD8, 0x3D, 0x3C, 0x23,
-    0xF2, 0xC2, 0xBB, 0x61, 0xB7, 0x36, 0x8A, 0x19, 0xCC, 0x88, 0x89, 0xE1, 0xB0, 0x67, 0x77, 0x6D,
-    0x15, 0xDA, 0x9F, 0xDB, 0xBA, 0xC4, 0xE0, 0xDB, 0xAA, 0xAC, 0xA2, 0xC1, 0xB7, 0x62, 0x8B, 0x98,
-    0x8E, 0xB7, 0x59, 0xDC, 0x6A, 0x18, 0x92, 0x26, 0xEC, 0x61, 0x59, 0xDA, 0x44, 0x3D, 0xDE, 0x9A,
-    0x3A, 0xEE, 0xF0, 0xD6, 0xCC, 0x0C, 0xDF, 0x9A, 0x2A, 0xE7, 0x90, 0x57, 0xB6, 0x09, 0xC6, 0x13,
-    0xE5, 0xAD, 0xED, 0x26, 0xB0, 0xAD, 0x5D, 0xDF, 0x6A, 0x04, 0xF0, 0x99, 0xB6, 0x7E, 0xC9, 0x0D,
-    0x3F, 0x71, 0xC3, 0xAF, 0xDD, 0x90, 0x13, 0x13, 0x0D, 0xFC, 0x84, 0xA1, 0xC6, 0x5F, 0xC6, 0xCF,
-    0x42, 0x5B, 0xC9, 0x92, 0x1B, 0x00, 0xD4, 0x28, 0xAF, 0x89, 0xD4, 0xF8, 0x7C, 0x23, 0xAD, 0x78,
-    0xE7, 0x2F, 0x0D, 0xAB, 0x3B, 0x19, 0x1C, 0x84, 0xAB, 0xF2, 0x5E, 0xFD, 0x8E, 0xFD, 0xF6, 0x53,
-    0x2C, 0xED, 0x59, 0xBF, 0xA6, 0x87, 0x70, 0x65, 0x0B, 0xE3, 0x86, 0xB5, 0x8F, 0x05, 0x53, 0xCD,
-    0x43, 0x38, 0xF4, 0x9A, 0xA4, 0x7B, 0x70, 0x41, 0x8B, 0xD7, 0x70, 0x48, 0x03, 0x1C, 0x0A, 0x87,
-    0x00, 0x83, 0xDF, 0x20, 0x20, 0xF0, 0xF8, 0xAE, 0xC8, 0x08, 0xD0, 0xE2, 0xF6, 0x8F, 0x1A, 0xE4,
-    0x31, 0x73, 0x58, 0xB4, 0x84, 0x00, 0x3E, 0x09, 0x47, 0x37, 0xFA, 0x1A, 0x61, 0xFA, 0x84, 0x3E,
-    0xA5, 0x53, 0x38, 0x86, 0x1C, 0x57, 0x84, 0xA8, 0xB1, 0x45, 0x4D, 0x88, 0x7A, 0xF6, 0xEB, 0x08,
-    0x22, 0xFC, 0x63, 0x23, 0x66, 0x63, 0x1B, 0x0F, 0xB0, 0x4F, 0x92, 0x5D, 0xFB, 0xC4, 0x5A, 0xB7,
-    0x3E, 0xB0, 0x0A, 0x88, 0xC2, 0x7C, 0x46, 0x13, 0x73, 0x72, 0xBA, 0x02, 0x73, 0x4A, 0x8E, 0x95,
-    0xAA, 0x23, 0xE5, 0x34, 0x5A, 0x37, 0x2E, 0xDA, 0x7F, 0xE1, 0xFE, 0x37, 0x40, 0x2D, 0x7E, 0x98,
-    0xFE, 0x20, 0xC6, 0xF9, 0xA4, 0x2F, 0x6E, 0x9C, 0xC2, 0xD0, 0x30, 0x1A, 0x5D, 0xEC, 0x87, 0xC0,
-    0x65, 0x7C, 0xD8, 0x4F, 0x37, 0x1A, 0xBB, 0x45, 0x4C, 0xA0, 0x76, 0x9E, 0x2D, 0xE1, 0xB5, 0x36,
-    0xB0, 0x41, 0x47, 0x30, 0x22, 0xB0, 0x51, 0x13, 0x35, 0x88, 0x70, 0xD2, 0xC6, 0x4D, 0x38, 0x13,
-    0xB3, 0x07, 0x0C, 0x0C, 0x9A, 0x29, 0x3D, 0xA2, 0x01, 0xFD, 0xCC, 0x5D, 0x64, 0x22, 0x31, 0x9D,
-    0xDF, 0xB2, 0xCE, 0x63, 0xE5, 0x0D, 0x38, 0x25, 0x82, 0x23, 0x6C, 0x65, 0x8B, 0x4F, 0x50, 0x59,
-    0x5B, 0xD8, 0x6A, 0x99, 0xB9, 0x61, 0xB3, 0x7C, 0x56, 0xE2, 0x86, 0x68, 0x69, 0xCA, 0xCC, 0x64,
-    0xA9, 0x7D, 0x94, 0x0C, 0xE6, 0xFD, 0x11, 0x13, 0xFB, 0xC3, 0x63, 0x44, 0x78, 0xEB, 0x85, 0x64,
-    0x8C, 0xB1, 0xE8, 0xE7, 0xE1, 0x9A, 0x2A, 0x81, 0x0D, 0x6B, 0xB8, 0x29, 0x3C, 0xAC, 0x8B, 0xCD,
-    0x10, 0x72, 0x9B, 0x01, 0x76, 0xE4, 0x41, 0x8B, 0xB8, 0x4B, 0x58, 0xF1, 0x26, 0xB4, 0x12, 0x31,
-    0xE5, 0x0A, 0x44, 0x35, 0xCE, 0x78, 0x93, 0xD8, 0x2C, 0x15, 0x79, 0xC6, 0xDE, 0x5B, 0xB3, 0x6F,
-    0xAD, 0xAD, 0x60, 0x0B, 0xBD, 0x5A, 0x3E, 0x79, 0x5A, 0xDE, 0xDB, 0x41, 0x80, 0xCA, 0x9B, 0x4D,
-    0x7E, 0x93, 0x69, 0x9C, 0xDF, 0xAA, 0xCC, 0x2D, 0x26, 0x70, 0x7E, 0xBB, 0x30, 0xFF, 0x60, 0xD2,
-    0xE5, 0x77, 0xC4, 0xDC, 0xA7, 0x17, 0xCD, 0x7F, 0xC5, 0x6C, 0x2B, 0xCF, 0xF6, 0x92, 0x0E, 0x7A,
-    0xD3, 0x49, 0xA2, 0xDE, 0x46, 0xBC, 0x12, 0xF5, 0x2F, 0x02, 0xA6, 0x94, 0x40, 0x1B, 0x99, 0x9E,
-    0xF2, 0x0C, 0x18, 0xF9, 0xD0, 0x0A, 0xDC, 0xDF, 0x46, 0x2D, 0xE4, 0x00, 0x09, 0xF5, 0x29, 0xA5,
-    0x74, 0xF2, 0x95, 0x36, 0xFF, 0xD9, 0x4A, 0x0E, 0xB9, 0xDE, 0xFD, 0x7F, 0x09, 0x72, 0x50, 0xD9,
-    0x50, 0xC6, 0x90, 0x3B, 0xAB, 0x79, 0x9D, 0xAF, 0x13, 0xEC, 0x94, 0x3B, 0x73, 0x32, 0x61, 0xD2,
-    0x80, 0xDA, 0xB9, 0x3B, 0xA9, 0x68, 0xB5, 0xBC, 0x07, 0x1F, 0x90, 0x9D, 0x1C, 0x26, 0xE1, 0xBB,
-    0xC5, 0x11, 0x02, 0x5E, 0x00, 0x1A, 0xE0, 0xB5, 0x88, 0xC9, 0x9A, 0x34, 0x4C, 0xD5, 0x1A, 0x44,
-    0x67, 0x2A, 0x10, 0x1D, 0xF2, 0x1C, 0xA2, 0x00, 0xD1, 0xC1, 0x7B, 0x2D, 0x04, 0x2C, 0x2C, 0x0B,
-    0xE4, 0x6C, 0xFE, 0xF7, 0x3B, 0x6D, 0x66, 0xEC, 0x39, 0x5B, 0xC5, 0x03, 0xB1, 0x9F, 0xC9, 0x8A,
-    0xDB, 0xF5, 0x85, 0x8D, 0x8D, 0x77, 0x48, 0x9B, 0xAD, 0x7C, 0xF4, 0x4A, 0x46, 0x52, 0x1E, 0xE0,
-    0x11, 0xB6, 0x29, 0x39, 0x0D, 0xEC, 0x66, 0x2A, 0x10, 0x5B, 0x99, 0x2D, 0x38, 0x3E, 0x64, 0x92,
-    0x91, 0x23, 0x2B, 0x28, 0xB5, 0x51, 0x88, 0x12, 0x79, 0x3A, 0x5E, 0x76, 0xB8, 0x92, 0x84, 0xB1,
-    0x89, 0xE8, 0x59, 0x27, 0xF8, 0x16, 0x2A, 0x7E, 0x96, 0xD3, 0xAE, 0xD2, 0xAA, 0x86, 0x39, 0x43,
-    0xAB, 0x56, 0x14, 0xE4, 0x5D, 0x0E, 0xC3, 0x72, 0xDB, 0x72, 0xA0, 0x51, 0xB5, 0xA6, 0x60, 0x9A,
-    0x11, 0xE5, 0xE4, 0x0B, 0x62, 0x9C, 0xE1, 0x89, 0xBB, 0xB8, 0x50, 0x0A, 0x5F, 0x56, 0x25, 0x3F,
-    0xE0, 0xBA, 0x0B, 0x70, 0xC8, 0xC6, 0x9B, 0x8E, 0x29, 0x08, 0xE7, 0x7F, 0x6A, 0x56, 0x98, 0xBF,
-    0xE9, 0xF2, 0x60, 0xAF, 0x4A, 0xF3, 0xAE, 0x9C, 0x69, 0xDA, 0xE5, 0x8D, 0xBA, 0xD3, 0xB4, 0xEA,
-    0xD0, 0xB4, 0x57, 0x43, 0x62, 0x2D, 0x21, 0x0F, 0x42, 0xCC, 0x28, 0x6D, 0xEB, 0x21, 0x49, 0x23,
-    0x65, 0x1D, 0x5D, 0x52, 0xE2, 0x22, 0xAF, 0x52, 0x49, 0xB0, 0x46, 0x02, 0xAA, 0xB5, 0xD5, 0xF3,
-    0xE0, 0x31, 0x5B, 0x3C, 0xC7, 0x05, 0x5E, 0xD1, 0xC2, 0x30, 0xAA, 0x3B, 0x18, 0xB6, 0x50, 0xB7,
-    0x2E, 0xC7, 0x23, 0xB0, 0x76, 0x6F, 0xC4, 0xAA, 0x7E, 0xA8, 0xCF, 0x35, 0xE1, 0xA4, 0xD4, 0xEA,
-    0xA3, 0x8E, 0x3E, 0x9E, 0xA8, 0xBB, 0xD3, 0x66, 0x02, 0xA1, 0xC8, 0x61, 0x5D, 0x26, 0xB6, 0x2E,
-    0xA5, 0xE5, 0xD0, 0xBC, 0xC0, 0x4C, 0xE3, 0xE0, 0x86, 0x67, 0x1D, 0x47, 0x24, 0x6A, 0xA9, 0xC8,
-    0x4E, 0x7A, 0x57, 0xD1, 0x5B, 0x98, 0xCA, 0x91, 0x43, 0x59, 0x94, 0x53, 0x37, 0x60, 0x8A, 0x69,
-    0xA4, 0xF9, 0xFE, 0xE8, 0x8A, 0x1B, 0xA0, 0x92, 0xCE, 0x5C, 0x28, 0x52, 0xD5, 0xB7, 0x77, 0xBF,
-    0x31, 0xEA, 0x7B, 0x04, 0xCB, 0xCC, 0x3E, 0x9D, 0xB1, 0x44, 0x9A, 0x1B, 0x50, 0x14, 0x29, 0x91,
-    0xAF, 0x3F, 0xE9, 0x59, 0x28, 0xED, 0xB9, 0xD9, 0x98, 0xC0, 0x18, 0x9B, 0x54, 0x76, 0xAD, 0xAC,
-    0x82, 0x3E, 0x9D, 0x8D, 0x57, 0x4D, 0x1D, 0xB5, 0x66, 0x36, 0x5C, 0x2C, 0xC7, 0x72, 0x66, 0x3E,
-    0xEC, 0xD2, 0x36, 0x1D, 0x11, 0xC5, 0x99, 0x53, 0xC5, 0x11, 0xD8, 0xD4, 0x9E, 0xEC, 0x8F, 0xDE,
-    0x38, 0x81, 0x7D, 0xB2, 0xC8, 0xBF, 0xBC, 0x8F, 0x39, 0x25, 0x38, 0xB3, 0x0D, 0x85, 0xF3, 0x08,
-    0x6B, 0x8C, 0x21, 0x54, 0x1C, 0x95, 0x23, 0x42, 0x15, 0x78, 0x66, 0x63, 0x32, 0xC5, 0x39, 0xD8,
-    0x56, 0x6E, 0x93, 0x66, 0x47, 0x99, 0x78, 0x93, 0x59, 0x7C, 0x9A, 0xE5, 0xFD, 0x22, 0xBB, 0x09,
-    0x0B, 0x3D, 0x3C, 0xC6, 0x2E, 0xB0, 0x83, 0xCD, 0xA2, 0x3B, 0x6D, 0x59, 0xC5, 0xDF, 0xA8, 0xF3,
-    0xCA, 0xF8, 0x15, 0x99, 0x59, 0x8D, 0x5F, 0x81, 0x71, 0x41, 0x03, 0x11, 0x36, 0x48, 0xF8, 0xA0,
-    0x4B, 0x2A, 0x76, 0x57, 0x58, 0xF4, 0x42, 0x47, 0x44, 0xEE, 0x2A, 0x0B, 0x33, 0x58, 0x60, 0xDE,
-    0x61, 0xA2, 0x5D, 0x4F, 0xE9, 0xC7, 0xDB, 0x42, 0x35, 0x02, 0x5F, 0x74, 0x60, 0x31, 0x7F, 0x6B,
-    0xDC, 0xB4, 0xB5, 0x96, 0xAE, 0x1A, 0xE1, 0x0C, 0xC8, 0xE3, 0x0D, 0x55, 0x30, 0xBB, 0x8C, 0xBC,
-    0x12, 0xBB, 0x56, 0x01, 0xC7, 0xFD, 0x8E, 0xF9, 0xA7, 0x84, 0x76, 0xCD, 0x85, 0x26, 0x12, 0xE0,
-    0xF7, 0x88, 0x9F, 0x7C, 0xA4, 0xB5, 0xC0, 0xB5, 0x44, 0xB1, 0x48, 0x1D, 0xD4, 0x18, 0x84, 0xE7,
-    0xC7, 0x98, 0x6E, 0x66, 0x57, 0x94, 0x91, 0x9B, 0xBC, 0xC0, 0xDC, 0xFA, 0x22, 0x54, 0xF3, 0x58,
-    0x9A, 0x7A, 0xBF, 0x62, 0x1B, 0x45, 0x09, 0x45, 0xB4, 0x18, 0x05, 0xF4, 0x51, 0x83, 0xA6, 0x03,
-    0x66, 0x47, 0x25, 0x60, 0x5F, 0xC7, 0x70, 0x94, 0xA9, 0x8F, 0x33, 0x9D, 0x9B, 0x63, 0x29, 0xEB,
-    0xC2, 0x49, 0xC0, 0x2F, 0x6E, 0x4F, 0xC3, 0x2F, 0xD1, 0xB0, 0x04, 0x4D, 0xD9, 0x62, 0x56, 0x53,
-    0x5B, 0x24, 0x4C, 0x56, 0x5C, 0x57, 0x9C, 0x3E, 0x8E, 0x21, 0x1D, 0x5E, 0xC5, 0xF5, 0x25, 0x30,
-    0x42, 0x07, 0xFF, 0xDF, 0x0A, 0xC4, 0xE0, 0xB6, 0x0E, 0xD1, 0xBA, 0xDA, 0x91, 0x28, 0x2B, 0xC8,
-    0x4B, 0x1C, 0xD4, 0x75, 0xF0, 0xE0, 0xE6, 0xEE, 0xA6, 0x45, 0xAB, 0xE8, 0xD7, 0x74, 0x95, 0xCF,
-    0x5F, 0x97, 0x45, 0xDD, 0x47, 0xD6, 0x70, 0xCE, 0x58, 0x76, 0xCD, 0xD6, 0x75, 0x56, 0x09, 0x16,
-    0x79, 0xFA, 0x29, 0x60, 0xCD, 0xA8, 0xC0, 0x30, 0xE8, 0xC1, 0x1E, 0x20, 0x30, 0xA0, 0xB2, 0x6E,
-    0xDF, 0x4F, 0xE5, 0xA8, 0x7D, 0x36, 0x1D, 0x9C, 0xB0, 0xD8, 0x01, 0xD4, 0x21, 0x64, 0x52, 0x85,
-    0x98, 0x7C, 0x38, 0x8B, 0x5C, 0xAE, 0xB5, 0x8E, 0x22, 0xB2, 0x85, 0x8D, 0x92, 0xAD, 0x84, 0xEF,
-    0xEA, 0x36, 0x09, 0xD6, 0xA8, 0x0C, 0xD4, 0x92, 0x50, 0x83, 0xA2, 0x8D, 0xE2, 0x64, 0x2F, 0xD1,
-    0xA1, 0x12, 0x3D, 0x0F, 0x16, 0x5F, 0x23, 0x22, 0xBE, 0xDB, 0x2B, 0x6D, 0x69, 0x5C, 0x57, 0x3E,
-    0x12, 0xB1, 0xAB, 0xFB, 0xFD, 0xAE, 0x65, 0xBF, 0xFB, 0x10, 0x6B, 0xDF, 0xB8, 0x8B, 0x5E, 0xE2,
-    0x6B, 0x37, 0xD1, 0x76, 0xF9, 0x37, 0xD1, 0xEF, 0x22, 0x30, 0x31, 0x45, 0xD2, 0x86, 0x19, 0xFB,
-    0x2E, 0xC5, 0x0B, 0xC5, 0x71, 0x16, 0xA1, 0x63, 0x14, 0x27, 0x29, 0x4E, 0xF3, 0xD9, 0x12, 0xD5,
-    0x3E, 0xCB, 0x7E, 0xF7, 0x2B, 0xEC, 0x77, 0xDB, 0x8F, 0xF7, 0xBB, 0x0F, 0x98, 0x4E, 0xAE, 0x67,
-    0x45, 0xB2, 0x99, 0x8A, 0x14, 0x5A, 0xB0, 0x7C, 0x67, 0x10, 0xF6, 0xE5, 0x11, 0x7D, 0xEC, 0xA6,
-    0x7D, 0x87, 0x46, 0x77, 0xFE, 0x88, 0x94, 0xF7, 0x87, 0x90, 0x1D, 0x71, 0xD8, 0x41, 0xC0, 0x27,
-    0x61, 0x0F, 0xFB, 0x22, 0x76, 0x09, 0xB1, 0x36, 0xAF, 0x4D, 0xCA, 0x1A, 0x08, 0x1E, 0x48, 0x6A,
-    0x90, 0x46, 0x4A, 0x81, 0x4E, 0x70, 0xC6, 0xF3, 0x07, 0x8E, 0x25, 0x15, 0x2B, 0xC2, 0xBC, 0xFF,
-    0xA4, 0xF7, 0x50, 0xB6, 0xD2, 0x3D, 0x32, 0x66, 0x86, 0xE6, 0x86, 0xFC, 0xE2, 0x81, 0x5C, 0x2A,
-    0x30, 0xCD, 0xA7, 0x5C, 0x14, 0x3D, 0x45, 0xBA, 0x46, 0xA9, 0xA4, 0x4F, 0x55, 0xE7, 0xD0, 0xFD,
-    0xEE, 0xE7, 0x9C, 0x48, 0x62, 0xFA, 0x53, 0x37, 0xCA, 0xEB, 0x77, 0xCE, 0x0E, 0xF2, 0xBB, 0x5F,
-    0x7D, 0xB5, 0x97, 0xDF, 0x7F, 0xF3, 0xA7, 0xC0, 0xE6, 0x6F, 0x31, 0x39, 0xE6, 0x16, 0xF1, 0x12,
-    0x66, 0x1D, 0x3F, 0x0B, 0x2B, 0x8F, 0x7E, 0xA6, 0x10, 0xE5, 0xE5, 0x2A, 0x76, 0x08, 0x3D, 0x38,
-    0x5F, 0x20, 0xA8, 0x66, 0x7B, 0x2C, 0x65, 0x39, 0xEA, 0x52, 0x79, 0x03, 0xD6, 0xC8, 0xB5, 0xB8,
-    0x7D, 0x5E, 0xBE, 0x9F, 0x34, 0x47, 0x27, 0x8E, 0x4D, 0xE7, 0x45, 0xD5, 0xF1, 0x61, 0x5E, 0xCD,
-    0xF3, 0x71, 0x5E, 0x59, 0x1D, 0xE4, 0x16, 0x5D, 0xCE, 0x36, 0xDA, 0xAD, 0xDB, 0x42, 0x85, 0x76,
-    0x95, 0x0E, 0x8A, 0xFC, 0x9A, 0x9B, 0xCB, 0xC2, 0x26, 0x1B, 0x37, 0x7D, 0xA1, 0xA4, 0x95, 0xF7,
-    0x54, 0x83, 0xC5, 0x87, 0x10, 0x52, 0x91, 0x76, 0xF3, 0x93, 0x4D, 0x3C, 0xCE, 0x2B, 0x03, 0x5B,
-    0x61, 0x38, 0x67, 0xDF, 0x2F, 0xFA, 0x8D, 0x6E, 0x97, 0x73, 0xE3, 0x40, 0xAB, 0x64, 0x87, 0x56,
-    0x3F, 0x6C, 0x5F, 0xC5, 0xCA, 0x7B, 0x3C, 0x2C, 0xAA, 0xEB, 0xDA, 0x23, 0x98, 0xFB, 0xDE, 0x75,
-    0x09, 0xB6, 0xB6, 0xF1, 0x9D, 0xF6, 0x30, 0xE5, 0xEC, 0x0C, 0x5B, 0x34, 0x2B, 0xC7, 0xF3, 0x8C,
-    0x4D, 0x41, 0x86, 0x62, 0x59, 0x4A, 0x92, 0x81, 0x67, 0x53, 0xF6, 0x96, 0xCB, 0xF4, 0xED, 0x75,
-    0x68, 0xB5, 0xD9, 0x1C, 0x74, 0x93, 0xAE, 0x1A, 0xA7, 0x54, 0x68, 0x29, 0x61, 0xDF, 0x1E, 0xF1,
-    0xD0, 0x71, 0x7E, 0x4A, 0x81, 0x2C, 0xB1, 0x8F, 0xCB, 0xCA, 0xFB, 0x1E, 0xDB, 0xB1, 0x93, 0x12,
-    0x54, 0x72, 0x3A, 0x83, 0x58, 0xBE, 0x8D, 0xD3, 0x86, 0xB1, 0xE7, 0xF1, 0x21, 0xBE, 0xF3, 0xDB,
-    0xB7, 0x1B, 0x66, 0x01, 0xB2, 0x94, 0xE2, 0x44, 0x83, 0x9A, 0x2E, 0x1D, 0x71, 0x5F, 0x62, 0x23,
-    0x7C, 0x57, 0x4F, 0x3A, 0x4F, 0x69, 0x71, 0xEA, 0x80, 0xC8, 0xB4, 0x8E, 0xB3, 0x77, 0x57, 0x44,
-    0xB4, 0x1A, 0x4C, 0xD2, 0x65, 0xFD, 0x01, 0xF5, 0x7F, 0xB9, 0x46, 0x4F, 0x35, 0xFA, 0x40, 0x9D,
-    0x3F, 0x04, 0x33, 0x9C, 0x12, 0xFB, 0x00, 0xE7, 0xDE, 0xB0, 0xA3, 0x8C, 0xDA, 0xB0, 0xC8, 0x8B,
-    0xB8, 0x89, 0xB2, 0x32, 0x8B, 0x91, 0x2D, 0x4E, 0x5A, 0x00, 0x35, 0xA1, 0xB9, 0xB3, 0x2F, 0xA0,
-    0xA8, 0x98, 0xEA, 0x8C, 0xCF, 0x33, 0xCB, 0x12, 0x0B, 0x8B, 0x21, 0x7D, 0xA7, 0xEC, 0x32, 0xC2,
-    0x01, 0x31, 0x40, 0xD6, 0x0D, 0xE8, 0x20, 0xC0, 0x38, 0xDA, 0x32, 0xE9, 0x21, 0x07, 0x87, 0x51,
-    0xD6, 0x35, 0x24, 0x7A, 0xDA, 0x98, 0xC6, 0x2F, 0x01, 0x65, 0xF0, 0xE4, 0x83, 0x09, 0x25, 0x04,
-    0x48, 0xCC, 0x6A, 0xA0, 0xE2, 0x00, 0x20, 0xFE, 0xFE, 0x29, 0xD0, 0x38, 0xAA, 0xF6, 0x3E, 0xC9,
-    0x0E, 0xE4, 0x8B, 0x3C, 0xF2, 0xBE, 0x06, 0x71, 0x61, 0x54, 0xE8, 0x20, 0x87, 0x7A, 0x6C, 0x6E,
-    0x1E, 0xDD, 0x47, 0xE1, 0xFC, 0xDC, 0x9D, 0x99, 0x37, 0x7E, 0xE9, 0x17, 0xA8, 0x78, 0x5F, 0x06,
-    0x8F, 0xF5, 0xAF, 0xB3, 0xDC, 0xBE, 0xFD, 0xB1, 0xEE, 0x68, 0x5F, 0x28, 0x02, 0xFC, 0x71, 0xBF,
-    0x36, 0xB8, 0x22, 0x3D, 0xAE, 0xB8, 0xFE, 0x4C, 0x4F, 0xF4, 0xB9, 0x3B, 0xD6, 0x7B, 0x3C, 0x10,
-    0x06, 0xBF, 0xE4, 0xEB, 0x6F, 0x4D, 0x65, 0x26, 0x65, 0x56, 0xA0, 0x2E, 0xA3, 0xAC, 0x31, 0xB3,
-    0xC3, 0x0E, 0x39, 0x1E, 0xA1, 0x7B, 0x45, 0x52, 0x33, 0xC7, 0x59, 0xE5, 0x90, 0xDE, 0x15, 0x9A,
-    0x87, 0x61, 0x7E, 0xEA, 0x25, 0x65, 0xE8, 0xBF, 0x17, 0xF2, 0x62, 0x2E, 0xD0, 0xD3, 0x57, 0xAE,
-    0x6D, 0xB0, 0xE8, 0x26, 0xBC, 0x11, 0x66, 0xBF, 0x48, 0x32, 0xC3, 0xE6, 0x6F, 0x22, 0x13, 0x79,
-    0xB8, 0x3F, 0xC6, 0x70, 0x1E, 0x41, 0xDC, 0xFF, 0x07, 0x13, 0x0D, 0x65, 0xA8, 0xFF, 0xEF, 0x50,
-    0xFF, 0x9F, 0x21, 0x6B, 0x15, 0x03, 0x00, 0x9D, 0x94, 0x31, 0x92, 0xD3, 0x30, 0x14, 0x86, 0x65,
-    0xBB, 0x70, 0xA1, 0xC2, 0x5B, 0xB0, 0x43, 0x41, 0x91, 0x03, 0x50, 0xE4, 0x06, 0xC8, 0x33, 0x5C,
-    0x20, 0x45, 0x32, 0x14, 0x1C, 0x62, 0x8F, 0x60, 0x0F, 0x27, 0xD8, 0xA1, 0xD9, 0x2B, 0x2C, 0xE1,
-    0x10, 0xF6, 0x11, 0xC2, 0x50, 0xD0, 0x9A, 0x86, 0x16, 0x15, 0xD9, 0x19, 0xB3, 0x63, 0xEB, 0xF1,
-    0xFE, 0x5F, 0x8A, 0x43, 0x96, 0x82, 0x61, 0x55, 0xE4, 0x29, 0x89, 0xF4, 0xF4, 0xBE, 0xFF, 0xFD,
-    0x92, 0x31, 0x18, 0x3B, 0x7C, 0xAC, 0x82, 0x15, 0xAF, 0x51, 0x3A, 0xF9, 0x36, 0x19, 0x53, 0xCC,
-    0x95, 0x7C, 0xD0, 0x58, 0x4E, 0x56, 0x32, 0xFD, 0xBD, 0x1A, 0x33, 0xC1, 0xB2, 0xEA, 0x98, 0x33,
-    0xDE, 0x3C, 0x7E, 0x96, 0x7B, 0x5D, 0x26, 0x3A, 0x74, 0x59, 0xD6, 0x3C, 0xBC, 0x9F, 0xB7, 0xFA,
-    0xBB, 0x3B, 0xD8, 0x09, 0xFF, 0xBB, 0xDE, 0x8E, 0x88, 0x4D, 0x5F, 0x31, 0x76, 0x7D, 0x75, 0x44,
-    0x94, 0x76, 0xE5, 0x19, 0xEB, 0x35, 0xA2, 0x26, 0x75, 0x43, 0x8A, 0x07, 0x8D, 0x79, 0xD0, 0x9D,
-    0x1A, 0x8B, 0xA0, 0x3B, 0x11, 0x67, 0xDD, 0x69, 0x50, 0x86, 0xEE, 0xD4, 0xA8, 0xC9, 0xA5, 0x46,
-    0x7C, 0x52, 0xCE, 0xCA, 0xEB, 0x4A, 0x1D, 0xEB, 0x43, 0xC1, 0xE3, 0x9B, 0xB6, 0x42, 0xFA, 0xD7,
-    0xA1, 0x14, 0x6C, 0x77, 0x43, 0xF9, 0xCB, 0xA4, 0xB1, 0xAB, 0xB9, 0x41, 0xB8, 0x5E, 0xEE, 0xB0,
-    0x3D, 0x9F, 0x73, 0x64, 0x2D, 0xA7, 0x2C, 0x20, 0xE7, 0x68, 0x36, 0x4C, 0x6D, 0x22, 0xE8, 0xFE,
-    0x53, 0xE4, 0x4C, 0x98, 0xD3, 0x99, 0xD2, 0x45, 0xB8, 0x26, 0xB2, 0x75, 0x3D, 0xD1, 0x12, 0xA1,
-    0x02, 0x0E, 0x0B, 0x5F, 0xC2, 0xCB, 0x23, 0x55, 0x82, 0xD3, 0x8A, 0x9B, 0x2F, 0x44, 0x73, 0x42,
-    0xB2, 0xD5, 0x08, 0x30, 0x93, 0xD5, 0xCB, 0xE1, 0x51, 0x2B, 0xA5, 0x32, 0x11, 0xCA, 0x90, 0x89,
-    0x5F, 0x28, 0x9B, 0x39, 0xF7, 0x4F, 0x89, 0x88, 0xAA, 0x44, 0x7D, 0x24, 0x6A, 0x49, 0x04, 0xB0,
-    0xD4, 0xBC, 0xEA, 0xC8, 0x70, 0xF3, 0xF8, 0x51, 0x48, 0xF4, 0x35, 0x90, 0xE8, 0xED, 0x4C, 0xA2,
-    0x32, 0x12, 0x11, 0x2C, 0x75, 0x2D, 0x35, 0x4D, 0xDA, 0x18, 0x6A, 0x94, 0xA3, 0x29, 0xD6, 0x7E,
-    0x01, 0x43, 0xBF, 0x0E, 0x24, 0x62, 0x98, 0x8D, 0xFB, 0x9E, 0x88, 0x6A, 0x12, 0xCD, 0x24, 0x32,
-    0xFF, 0x4B, 0x64, 0xCC, 0xF5, 0x36, 0x9A, 0x32, 0x17, 0xF6, 0x5D, 0xBA, 0x9F, 0x0F, 0x32, 0x44,
-    0x5B, 0xF6, 0xCE, 0x47, 0x5F, 0xD6, 0x38, 0x93, 0x6C, 0xD7, 0x7F, 0x58, 0x81, 0xD6, 0xDC, 0xEF,
-    0xDB, 0xE8, 0x4D, 0x6C, 0xA7, 0x39, 0x77, 0xC8, 0x43, 0x4A, 0x28, 0x02, 0x7B, 0x52, 0x0C, 0x90,
-    0x72, 0x1F, 0x58, 0x8B, 0x90, 0xFA, 0x47, 0x33, 0xC1, 0xA2, 0x98, 0x80, 0x78, 0x80, 0x3A, 0xEC,
-    0x22, 0xF4, 0x21, 0x35, 0x14, 0x62, 0x27, 0x39, 0x81, 0x4F, 0xAB, 0x69, 0x13, 0x8D, 0x6A, 0xB5,
-    0x54, 0x3A, 0xB5, 0x80, 0x0C, 0xA3, 0xD1, 0xFC, 0x57, 0x8B, 0xFC, 0x67, 0xB3, 0x2E, 0x6E, 0x3D,
-    0xD9, 0x75, 0xF1, 0xEB, 0x85, 0x61, 0xA1, 0xC6, 0xE6, 0xA4, 0x46, 0x18, 0x4F, 0x6A, 0x1C, 0xFF,
-    0x52, 0xE3, 0x74, 0x4D, 0x21, 0x24, 0xD5, 0x80, 0x3E, 0xBC, 0xA8, 0x3A, 0x89, 0x37, 0x55, 0x7D,
-    0x47, 0x35, 0x36, 0xB8, 0x55, 0x51, 0x8D, 0x36, 0x5D, 0x56, 0xC8, 0x02, 0x98, 0xEC, 0xA4, 0x06,
-    0x27, 0x50, 0x83, 0xFA, 0x50, 0x8D, 0x90, 0xD4, 0x48, 0xB2, 0x44, 0xD3, 0x50, 0x0D, 0x4C, 0xA8,
-    0x86, 0x9D, 0x92, 0x1A, 0x76, 0xBA, 0x8A, 0x6A, 0x94, 0xFA, 0xAE, 0x50, 0x0D, 0x58, 0x32, 0xAA,
-    0xF1, 0xE2, 0xF9, 0x6A, 0x64, 0xD1, 0xED, 0x6B, 0x19, 0xF9, 0x6C, 0xDC, 0x85, 0xF8, 0x4A, 0xC8,
-    0xF9, 0x71, 0xA8, 0x78, 0xC4, 0xE9, 0x80, 0x95, 0x2F, 0xF1, 0x50, 0xAD, 0xBD, 0xC3, 0x05, 0x76,
-    0xC3, 0xCB, 0xB0, 0xFD, 0xA7, 0xDB, 0xFD, 0xE2, 0x76, 0x73, 0xE9, 0x76, 0x79, 0xEA, 0xF6, 0xE1,
-    0x36, 0xBA, 0xFD, 0x80, 0xC3, 0xAB, 0xF0, 0x2C, 0xB7, 0x5F, 0x12, 0x85, 0x77, 0xA8, 0xBA, 0x38,
-    0x12, 0xC5, 0x7A, 0xD3, 0x21, 0xDB, 0x10, 0xC1, 0x06, 0x80, 0xBD, 0x92, 0x01, 0x44, 0xD2, 0x81,
-    0xA8, 0x18, 0x2B, 0xAF, 0x44, 0xD6, 0x97, 0x5E, 0xEB, 0xB0, 0xC7, 0x02, 0x60, 0x76, 0xA6, 0x16,
-    0xA5, 0x56, 0xA5, 0x60, 0xB9, 0x72, 0xA3, 0x9C, 0x46, 0x58, 0x8E, 0x95, 0x9E, 0x2F, 0x6F, 0xD7,
-    0x6B, 0x05, 0x6F, 0x54, 0x02, 0x45, 0x69, 0xCC, 0x9A, 0xA1, 0x76, 0xAD, 0xF3, 0xB7, 0xEE, 0x47,
-    0xD0, 0x62, 0x0E, 0x56, 0x1D, 0x66, 0x03, 0x7B, 0xA5, 0xEF, 0xE1, 0x6F, 0x35, 0xCE, 0xB1, 0x11,
-    0xC2, 0x30, 0x0C, 0x40, 0x51, 0x05, 0x15, 0x29, 0x28, 0xCC, 0x06, 0x19, 0x21, 0x0D, 0x7D, 0xE8,
-    0x59, 0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D, 0x8B, 0x30, 0x84, 0x47, 0x70, 0xC3, 0x06, 0x29, 0x52,
-    0x20, 0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE, 0xC5, 0x3B, 0x9D, 0x25, 0xF2, 0x3F, 0xC7, 0x1E, 0xFB,
-    0xBD, 0xCA, 0x29, 0x92, 0x28, 0x91, 0x85, 0x35, 0xD2, 0x1E, 0x81, 0x5A, 0x64, 0x76, 0x4C, 0xF9,
-    0xB5, 0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F, 0x53, 0xF3, 0x29, 0xCC, 0x27, 0x13, 0x7C, 0x94, 0xB2,
-    0xC0, 0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6, 0x09, 0x76, 0x50, 0x47, 0x38, 0x43, 0x1E, 0xE0, 0x4E,
-    0x13, 0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A, 0x8C, 0x4D, 0xC9, 0x22, 0x83, 0x69, 0x8B, 0xFF, 0xAE,
-    0xBA, 0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41, 0x8E, 0xAD, 0xEF, 0x79, 0xE9, 0x39, 0xF8, 0xFD, 0x02,
+static const uint8_t notoserif_14_bolditalicBitmaps[40904] = {
+    0xA5, 0x59, 0x3D, 0x8C, 0xDD, 0xD8, 0x75, 0xBE, 0x8F, 0xDC, 0x15, 0x93, 0x10, 0x30, 0x55, 0x68,
+    0x11, 0xD8, 0x4A, 0x96, 0x4D, 0x2A, 0x6D, 0x32, 0x6C, 0x52, 0x04, 0x81, 0x24, 0xD2, 0x5E, 0x24,
+    0x2E, 0xB6, 0xF0, 0x14, 0xAB, 0x2A, 0x85, 0xEA, 0xB8, 0xB0, 0x9A, 0xAD, 0xE2, 0x51, 0x48, 0x3B,
+    0x45, 0xCA, 0x15, 0x02, 0x04, 0x29, 0xE3, 0x42, 0x85, 0x76, 0x0C, 0x44, 0x2E, 0x5C, 0x28, 0x81,
+    0x0C, 0xD2, 0x30, 0x90, 0x14, 0x5B, 0x84, 0x6B, 0x63, 0x61, 0x20, 0x4D, 0xB8, 0x89, 0x1C, 0x07,
+    0xD8, 0x62, 0x89, 0x80, 0xCE, 0x72, 0x67, 0x48, 0xDE, 0x7C, 0xDF, 0x77, 0xC8, 0xF7, 0x66, 0xB4,
+    0x5A, 0x78, 0xED, 0x8C, 0xF4, 0xEE, 0xBC, 0x79, 0x7C, 0xBC, 0xF7, 0x9C, 0xEF, 0x9C, 0xF3, 0x9D,
+    0x1F, 0x3A, 0xDF, 0x38, 0x5F, 0x39, 0x5F, 0xEC, 0xBC, 0xDB, 0x2D, 0x2E, 0x98, 0x5D, 0x30, 0xB9,
+    0x70, 0x74, 0xE1, 0xE0, 0xC2, 0xDE, 0x85, 0x9D, 0x8B, 0x5A, 0x17, 0x35, 0x2E, 0xAE, 0xDC, 0xCE,
+    0xF1, 0xE7, 0x65, 0xE7, 0xCA, 0xC6, 0xD5, 0xFA, 0x5F, 0x16, 0xFA, 0x48, 0x57, 0xB2, 0x82, 0xB7,
+    0xBB, 0x78, 0xC0, 0xDB, 0xD6, 0xB9, 0x1A, 0xDF, 0xF7, 0xCE, 0x85, 0x33, 0x3E, 0x9A, 0x9C, 0x4B,
+    0x46, 0xE7, 0xD2, 0xDE, 0xB9, 0x9C, 0xAF, 0x0E, 0x5B, 0xF0, 0x2B, 0xCD, 0xE1, 0xE5, 0x1B, 0xDD,
+    0xA2, 0x17, 0xB6, 0x77, 0x79, 0x63, 0xDB, 0x24, 0xF8, 0x3E, 0x84, 0x71, 0x0E, 0x7B, 0xB8, 0xDF,
+    0xB1, 0xD3, 0xDC, 0x4B, 0x78, 0x25, 0xD5, 0x7A, 0x11, 0x17, 0x78, 0xAE, 0xC3, 0x61, 0xAE, 0x2E,
+    0xD6, 0x5D, 0x9E, 0xDB, 0x59, 0x2F, 0x0A, 0x54, 0xB8, 0x80, 0x42, 0xBD, 0x48, 0x30, 0x7E, 0xA5,
+    0xA0, 0xFA, 0x2E, 0x81, 0x0A, 0x39, 0x76, 0xF9, 0xC3, 0xF5, 0xB8, 0x5D, 0x11, 0x0D, 0xC9, 0x14,
+    0x4F, 0xC0, 0x65, 0x08, 0xFA, 0xEB, 0xCD, 0x7D, 0x7C, 0xF6, 0xCA, 0x1D, 0x57, 0xFA, 0xA2, 0xF4,
+    0xEE, 0xEB, 0xA7, 0xEE, 0xE5, 0x22, 0xEB, 0xF2, 0x3E, 0xEF, 0xB3, 0x66, 0xBD, 0x21, 0xC2, 0x46,
+    0xB9, 0xEF, 0x9C, 0x0F, 0xC7, 0x10, 0x77, 0x45, 0xC3, 0x6E, 0x4E, 0xFA, 0xDD, 0x9C, 0x76, 0xBB,
+    0x39, 0x6F, 0xF1, 0x6A, 0x82, 0xB9, 0x6C, 0x82, 0xA9, 0xAE, 0xC2, 0xA9, 0x2E, 0xC2, 0xC9, 0x17,
+    0xD1, 0xE8, 0x01, 0x9C, 0x87, 0x42, 0x78, 0x75, 0xB5, 0xCB, 0x9A, 0xB2, 0xC8, 0x8B, 0xBC, 0x59,
+    0x5C, 0x7A, 0x0E, 0x4B, 0x78, 0x00, 0x71, 0x8D, 0x1B, 0xE3, 0x84, 0x1D, 0x74, 0x89, 0x7D, 0xB3,
+    0x5B, 0x70, 0xF7, 0xE8, 0x8B, 0xA0, 0x83, 0x2E, 0x04, 0x3A, 0x00, 0x06, 0xE1, 0x62, 0x7A, 0x45,
+    0x93, 0xBD, 0xE2, 0xD1, 0x94, 0x21, 0x4E, 0xD4, 0x31, 0xE3, 0x0B, 0xE0, 0xE7, 0xAD, 0xBB, 0xE1,
+    0xCF, 0xAA, 0xDC, 0xFB, 0x55, 0xE2, 0xC0, 0x13, 0x85, 0x73, 0x8A, 0xDD, 0xD0, 0xB2, 0x05, 0xBE,
+    0x51, 0xF3, 0x6B, 0x39, 0x71, 0x79, 0xD9, 0x95, 0xD5, 0x0A, 0xF0, 0x8E, 0x66, 0x80, 0x5B, 0x60,
+    0x4F, 0xDE, 0x9A, 0xF3, 0x23, 0x5A, 0x07, 0x3E, 0x82, 0xAD, 0x9D, 0xEC, 0xF4, 0x05, 0x3A, 0xCD,
+    0x1F, 0xB8, 0xB4, 0xDA, 0x3D, 0x05, 0x0A, 0x7E, 0xE2, 0x32, 0x02, 0x2D, 0x9E, 0x61, 0x78, 0xEE,
+    0x4F, 0x2B, 0x75, 0x9A, 0xDB, 0x4E, 0x3B, 0x92, 0xE9, 0x65, 0x35, 0xAA, 0xE4, 0x62, 0xE8, 0xF2,
+    0x5B, 0xC0, 0xD1, 0x25, 0xFE, 0x01, 0xFE, 0xBC, 0xA7, 0x93, 0x66, 0x67, 0x8A, 0xD2, 0x92, 0x57,
+    0x68, 0xCA, 0xAC, 0xC0, 0x9F, 0x79, 0x05, 0x85, 0xF3, 0x36, 0x1D, 0x5C, 0xEA, 0x01, 0x57, 0xE0,
+    0x17, 0x73, 0x55, 0x7E, 0x6F, 0xB6, 0x9D, 0x52, 0xC8, 0x9E, 0xE3, 0x45, 0x44, 0xDF, 0x1D, 0x5D,
+    0xFC, 0xB5, 0xC1, 0xBD, 0x0A, 0x64, 0x4E, 0x80, 0x4C, 0x9F, 0x75, 0x61, 0x9B, 0xB7, 0x31, 0x20,
+    0x3F, 0x82, 0xC6, 0xF7, 0xEF, 0xD4, 0xEF, 0x7B, 0xEF, 0x97, 0xD3, 0x53, 0xFF, 0x8E, 0xF4, 0x16,
+    0xC0, 0x78, 0x3D, 0xA6, 0x51, 0x7D, 0xCF, 0x33, 0x68, 0xE1, 0x6D, 0xB9, 0x7F, 0xE7, 0xAE, 0x73,
+    0xDF, 0x77, 0x89, 0x73, 0x3D, 0xCE, 0xDC, 0x11, 0x9E, 0x80, 0x80, 0x84, 0xFF, 0xF6, 0x90, 0xCE,
+    0x06, 0xCF, 0x0B, 0xFE, 0xB6, 0x86, 0x1A, 0x0E, 0xE2, 0x99, 0xC7, 0xC9, 0x34, 0x5C, 0x5E, 0xE2,
+    0x72, 0x93, 0x16, 0xFA, 0x81, 0x4B, 0x3B, 0xC0, 0x00, 0x04, 0xB0, 0x27, 0x55, 0x7E, 0xE6, 0x56,
+    0xAB, 0x1B, 0x68, 0x35, 0xEE, 0x8D, 0xCF, 0x17, 0xBA, 0x26, 0x2E, 0x2F, 0xF8, 0x2A, 0xFC, 0xF1,
+    0xBE, 0x8B, 0x46, 0x77, 0x55, 0x06, 0x96, 0x85, 0x5D, 0xF6, 0x1F, 0xFF, 0x88, 0x6F, 0x7C, 0x04,
+    0xC3, 0xE6, 0x03, 0x4C, 0x5D, 0x36, 0xB8, 0x54, 0x56, 0x70, 0x82, 0xB2, 0x42, 0x64, 0xD6, 0x5C,
+    0xCA, 0xC2, 0x3E, 0xEB, 0xA1, 0x29, 0x42, 0x2C, 0x6D, 0xE1, 0xEB, 0xF1, 0xD9, 0x42, 0x2D, 0x87,
+    0x35, 0xB8, 0x20, 0xB3, 0xAF, 0xB4, 0x44, 0x58, 0x8A, 0xF8, 0xFD, 0x3B, 0x0B, 0xB4, 0xC3, 0x79,
+    0x09, 0x69, 0xE1, 0x25, 0xF8, 0x28, 0xCF, 0x93, 0x07, 0x14, 0x97, 0x3C, 0x83, 0x5A, 0x99, 0x30,
+    0xD4, 0x9F, 0x41, 0x04, 0x39, 0x71, 0x71, 0xDE, 0x2E, 0xC6, 0x87, 0x8B, 0xCD, 0x5E, 0xB7, 0x2B,
+    0xD4, 0x35, 0x3F, 0x9F, 0x19, 0x81, 0x35, 0xA3, 0x39, 0x2F, 0x60, 0xB4, 0xBC, 0xC2, 0x52, 0x16,
+    0x01, 0x55, 0x75, 0x9E, 0x5B, 0xD4, 0x3F, 0x65, 0xA0, 0x02, 0x70, 0x18, 0x00, 0xD1, 0xBC, 0xC0,
+    0x1A, 0xC9, 0x90, 0x0D, 0xD8, 0x0A, 0x91, 0x5C, 0x22, 0x9A, 0x1C, 0xC3, 0xC9, 0x96, 0xB2, 0xC0,
+    0x79, 0xB8, 0xD0, 0xBB, 0xE4, 0x93, 0xFA, 0xB2, 0x43, 0x98, 0xC7, 0xB7, 0xDC, 0x05, 0x22, 0xD5,
+    0xDF, 0x9A, 0x79, 0xA4, 0x27, 0x93, 0xD4, 0x0C, 0x9B, 0x9A, 0x26, 0xA9, 0x49, 0x64, 0x9E, 0xEF,
+    0xB8, 0xC0, 0xF6, 0xE1, 0x9C, 0x2E, 0xDC, 0x05, 0x62, 0x94, 0x3F, 0xD9, 0xEB, 0x1A, 0x0F, 0xA6,
+    0xF0, 0x6F, 0x10, 0x8D, 0x5B, 0x44, 0x23, 0x77, 0x34, 0xD1, 0x87, 0x8C, 0x3C, 0x4F, 0xF5, 0x8F,
+    0x79, 0xDA, 0x93, 0x70, 0xE1, 0xBF, 0xDD, 0xE8, 0x2E, 0xFC, 0xBC, 0xAC, 0x60, 0xAB, 0x1B, 0x91,
+    0x28, 0xE8, 0x15, 0xB4, 0x68, 0xFF, 0xD3, 0xCA, 0x7D, 0xFA, 0xE7, 0x98, 0x96, 0x86, 0x9A, 0x10,
+    0x90, 0x50, 0x8F, 0x74, 0xB3, 0xEB, 0x3C, 0xF3, 0xE0, 0x20, 0xB3, 0x4B, 0x16, 0xDF, 0x80, 0x8B,
+    0x3A, 0x18, 0xB6, 0xE7, 0x2B, 0xAE, 0xB2, 0x8D, 0x6F, 0x1B, 0xB1, 0x1F, 0xE3, 0x80, 0x9E, 0x48,
+    0x7B, 0x50, 0xF4, 0x7E, 0x93, 0x90, 0x2C, 0x67, 0x64, 0x91, 0x8E, 0xE6, 0xA7, 0x32, 0xA3, 0xFD,
+    0xD8, 0xDB, 0x5C, 0x6B, 0xC9, 0xDB, 0x9C, 0x3C, 0x25, 0xA0, 0x96, 0x8A, 0x25, 0xC8, 0xFF, 0xD7,
+    0xC4, 0x24, 0x25, 0xEB, 0xB8, 0x5B, 0x5A, 0x4F, 0x42, 0x1D, 0xC2, 0x35, 0xE8, 0xC4, 0x4C, 0x67,
+    0xDF, 0x5D, 0x88, 0x0A, 0xBD, 0x3B, 0x55, 0x38, 0xDD, 0x56, 0x60, 0x3D, 0x95, 0x64, 0x03, 0x8D,
+    0x0F, 0xE7, 0x02, 0xBF, 0x65, 0x8B, 0x7B, 0xCD, 0x3F, 0x03, 0xBD, 0xE6, 0xE2, 0x8D, 0x05, 0xB1,
+    0x5F, 0x92, 0x47, 0x5C, 0xB4, 0x44, 0x9E, 0x0C, 0x10, 0xE0, 0xFB, 0xD1, 0xB4, 0x03, 0xBE, 0xB1,
+    0xD6, 0x64, 0xE4, 0x27, 0xC9, 0x40, 0x5E, 0x4F, 0x07, 0xB2, 0x7A, 0x46, 0x12, 0x60, 0x20, 0x55,
+    0x54, 0x3F, 0x23, 0xA1, 0xB7, 0xC9, 0x44, 0x18, 0x84, 0x40, 0x43, 0x16, 0xF1, 0x7A, 0xEF, 0x2B,
+    0x7E, 0xEE, 0x0B, 0x44, 0x25, 0x44, 0x2A, 0x7B, 0xDE, 0x8A, 0xE8, 0xA9, 0x0F, 0x74, 0xC5, 0xDD,
+    0x3A, 0x5C, 0x7C, 0x0C, 0xF7, 0x1F, 0x70, 0x63, 0xDE, 0x40, 0x27, 0x30, 0xEF, 0x04, 0xA5, 0x82,
+    0x4E, 0xBA, 0x26, 0xD3, 0x16, 0xDC, 0xC4, 0xDB, 0x90, 0xB2, 0xA5, 0xBB, 0xBC, 0x28, 0x44, 0xA1,
+    0x24, 0xEF, 0x88, 0x8A, 0xD8, 0x3F, 0xB8, 0x07, 0x85, 0xFD, 0x6C, 0x47, 0x58, 0xB8, 0x43, 0x55,
+    0x53, 0x58, 0x84, 0x1E, 0x40, 0x16, 0x9C, 0x59, 0x76, 0x34, 0x3C, 0x36, 0x87, 0x72, 0x30, 0x50,
+    0x62, 0xFF, 0x07, 0x6E, 0x93, 0x6A, 0xC5, 0x25, 0xAC, 0xD8, 0x1F, 0x9F, 0xD3, 0x85, 0x46, 0xF2,
+    0x29, 0x3E, 0x24, 0x9D, 0xF4, 0x4A, 0xD5, 0x2D, 0xB3, 0xA0, 0x72, 0x3D, 0xA1, 0x47, 0x50, 0xCF,
+    0x52, 0x78, 0x90, 0xC2, 0x15, 0x15, 0x7E, 0x66, 0xA7, 0x93, 0x97, 0xB5, 0x92, 0x56, 0x45, 0xB8,
+    0xA9, 0xD2, 0xC9, 0xAB, 0x4A, 0x98, 0x5F, 0x5C, 0x09, 0x4C, 0xBE, 0xB2, 0x2A, 0xCD, 0x2D, 0x0A,
+    0x67, 0x5C, 0x68, 0x8A, 0xF2, 0x74, 0x67, 0x99, 0xDC, 0xF8, 0x5C, 0x39, 0xF8, 0x58, 0x59, 0xB8,
+    0xE7, 0xE9, 0xF0, 0x5E, 0x9C, 0x1E, 0x75, 0x3A, 0xBD, 0xE5, 0xE9, 0xCC, 0x45, 0xA5, 0x44, 0xB1,
+    0x15, 0xA7, 0xA3, 0xA4, 0xD8, 0x9F, 0x9E, 0xE8, 0xF4, 0xDF, 0x7C, 0xE1, 0xE9, 0xE6, 0x9E, 0xDA,
+    0x21, 0x3F, 0x3B, 0x2D, 0x3E, 0xE3, 0x74, 0xA7, 0xD3, 0x9D, 0xD2, 0xBC, 0xD1, 0x39, 0x05, 0xA7,
+    0xD2, 0xB5, 0xDC, 0x79, 0xFB, 0xB9, 0xCE, 0xBF, 0x76, 0x72, 0x53, 0x3A, 0x56, 0xC3, 0xDD, 0xAC,
+    0x46, 0x2A, 0x05, 0xDD, 0x7D, 0xCB, 0x41, 0x66, 0xF4, 0xCB, 0x22, 0xAC, 0x2B, 0x6E, 0x6E, 0xF2,
+    0x6E, 0x57, 0xFB, 0x6A, 0x35, 0x45, 0x47, 0x72, 0xC6, 0xD5, 0x4C, 0xFF, 0xF7, 0x56, 0x82, 0x09,
+    0x4A, 0x52, 0xD3, 0x87, 0x94, 0x2E, 0xF3, 0xDA, 0x55, 0x8C, 0x5F, 0xFA, 0x91, 0xBE, 0x7F, 0xCF,
+    0x0F, 0x19, 0x7E, 0x01, 0x89, 0x50, 0x7E, 0xAF, 0xBC, 0x07, 0x2C, 0x22, 0xAB, 0x5D, 0x22, 0x2B,
+    0x5F, 0x54, 0xC5, 0x0C, 0x56, 0xC8, 0x0C, 0x02, 0x86, 0x98, 0x0E, 0x42, 0xC4, 0x5B, 0xF8, 0xAB,
+    0xEA, 0x6A, 0x37, 0x22, 0xC8, 0xAD, 0xF6, 0x2A, 0xAD, 0x30, 0xAA, 0xAD, 0x36, 0xF2, 0x56, 0xFF,
+    0x30, 0x57, 0x79, 0x05, 0x24, 0xA0, 0x41, 0x14, 0x12, 0x9B, 0x92, 0xA1, 0x50, 0x2A, 0x16, 0x87,
+    0x4B, 0x35, 0xC6, 0x56, 0x3F, 0x89, 0x36, 0x86, 0xB5, 0xBE, 0x58, 0x09, 0x87, 0x87, 0x94, 0x17,
+    0x4B, 0xB0, 0xCA, 0xEA, 0x2B, 0x6F, 0xA0, 0x1B, 0xE4, 0xEB, 0xCE, 0xC3, 0x9A, 0xD1, 0x85, 0xAB,
+    0x02, 0x2A, 0x9E, 0xB6, 0x44, 0x29, 0x43, 0x5B, 0x6A, 0x7B, 0x2E, 0xAA, 0xDA, 0xCD, 0xC4, 0xB2,
+    0xB0, 0x0C, 0xCC, 0x43, 0x28, 0xBB, 0x95, 0x0F, 0x32, 0xB1, 0x36, 0x0E, 0x0F, 0x1B, 0xEF, 0x33,
+    0x14, 0xEF, 0xFF, 0x26, 0xBF, 0x51, 0x3E, 0x5B, 0x21, 0x2F, 0xE5, 0xF9, 0x43, 0x69, 0xAE, 0x8F,
+    0x6C, 0x4C, 0x81, 0xE0, 0x83, 0xBC, 0xF3, 0xA9, 0x84, 0x0A, 0x54, 0xF9, 0x8C, 0x71, 0x23, 0xC1,
+    0x6E, 0xCB, 0xFE, 0xBD, 0xDC, 0x20, 0xFB, 0x78, 0x5E, 0x9D, 0xF0, 0xE2, 0xAF, 0x0F, 0xE4, 0x70,
+    0x65, 0xE3, 0x4D, 0xCC, 0xBA, 0x95, 0xA0, 0x65, 0x2F, 0x51, 0xF3, 0x41, 0xBE, 0x98, 0x4D, 0x92,
+    0x34, 0x11, 0x09, 0x3C, 0x8B, 0x14, 0x8A, 0xC3, 0xAE, 0x6E, 0x7E, 0x05, 0x74, 0x86, 0x5F, 0x82,
+    0xCE, 0x35, 0xA2, 0x73, 0x93, 0xE8, 0x3C, 0xA1, 0x0D, 0x06, 0xA6, 0xB3, 0x9E, 0x4E, 0xD2, 0x33,
+    0xEE, 0x50, 0x25, 0x90, 0x49, 0x65, 0xDF, 0x06, 0x39, 0x11, 0x36, 0xA6, 0xD3, 0xD3, 0xE3, 0x10,
+    0x99, 0x25, 0x6D, 0x0D, 0xC1, 0xCF, 0x69, 0xEF, 0xC7, 0xDD, 0xEE, 0xE7, 0xB4, 0xF9, 0xBD, 0x2E,
+    0x7C, 0x97, 0xBF, 0xD3, 0x3E, 0x7E, 0x9B, 0x6E, 0x97, 0xF6, 0x09, 0x25, 0x39, 0x4A, 0xFA, 0x23,
+    0x9A, 0xEA, 0x56, 0x32, 0xDC, 0xA4, 0x3C, 0x37, 0x93, 0xE1, 0x89, 0x7E, 0xC7, 0x63, 0x4F, 0xA9,
+    0x4E, 0xE2, 0xF3, 0x96, 0x82, 0x3D, 0x89, 0x00, 0x02, 0x64, 0x1B, 0x50, 0x28, 0x53, 0xD1, 0x1E,
+    0xEE, 0x4D, 0xA4, 0x7A, 0x11, 0xAB, 0x0B, 0xFA, 0x70, 0x94, 0x07, 0x9E, 0x85, 0xBD, 0xB9, 0x60,
+    0xD0, 0x19, 0x16, 0x88, 0x00, 0x78, 0x34, 0xAA, 0xEE, 0x10, 0x52, 0x87, 0xF8, 0xCA, 0x2D, 0x0A,
+    0x49, 0xDD, 0xF4, 0xEB, 0x04, 0x22, 0x82, 0x29, 0x9F, 0x40, 0xB2, 0xBB, 0x3D, 0x33, 0x4A, 0x02,
+    0x90, 0x7A, 0xA5, 0x25, 0x16, 0x65, 0x47, 0xA0, 0x53, 0x48, 0x71, 0x6B, 0xE7, 0x59, 0x9D, 0x01,
+    0x8F, 0xBF, 0xD2, 0xAF, 0xF2, 0x47, 0x10, 0xE1, 0xC4, 0xE5, 0x3F, 0xC7, 0xAF, 0x27, 0x2E, 0x3B,
+    0xAF, 0x98, 0x1A, 0x13, 0x7A, 0x11, 0xE8, 0xD6, 0x2B, 0x49, 0x32, 0xFC, 0x82, 0xDE, 0x9C, 0xF7,
+    0x8C, 0xC5, 0x17, 0x64, 0x72, 0xA8, 0xD8, 0x2E, 0x64, 0x88, 0x8A, 0x56, 0xF4, 0x0A, 0x06, 0x5A,
+    0x0B, 0xD5, 0x0D, 0xA3, 0x89, 0xE6, 0xE6, 0x9F, 0xC8, 0x38, 0xCA, 0x3E, 0xCA, 0x41, 0xAC, 0x52,
+    0xB1, 0x12, 0x99, 0xBA, 0xC9, 0xF7, 0x2B, 0x39, 0x83, 0x0E, 0x91, 0x33, 0xD9, 0xD0, 0x8A, 0xE4,
+    0xDF, 0x8D, 0xF7, 0x13, 0x45, 0x76, 0xA6, 0x3F, 0x6B, 0xC6, 0xE8, 0x87, 0xB3, 0x8E, 0x6D, 0xDD,
+    0x96, 0xC1, 0x4B, 0x7F, 0x56, 0x88, 0x41, 0xE5, 0x2F, 0x4C, 0x6D, 0xD1, 0x2C, 0xDA, 0x98, 0x94,
+    0xF8, 0xB5, 0x26, 0xE3, 0x61, 0x4D, 0x07, 0xA9, 0xD3, 0x4B, 0xDA, 0x9E, 0x82, 0xE5, 0x67, 0x4C,
+    0x42, 0xB9, 0x2A, 0xA5, 0xB2, 0xFD, 0x1C, 0xDC, 0xF9, 0xDF, 0xE2, 0xCE, 0xC9, 0x7D, 0x06, 0x0E,
+    0xD1, 0x42, 0x95, 0x77, 0x2B, 0x0E, 0xD5, 0x25, 0x1C, 0xC6, 0x17, 0xE1, 0xE0, 0x6D, 0xAD, 0x3E,
+    0x0F, 0x0E, 0x31, 0xEB, 0xBC, 0xCB, 0x38, 0x28, 0x4A, 0x64, 0xAB, 0x6D, 0x0D, 0x24, 0xEE, 0xAA,
+    0x40, 0xFE, 0x89, 0x5B, 0x7B, 0x8A, 0x43, 0x8E, 0x9D, 0x79, 0x17, 0x1D, 0x09, 0xC1, 0xC5, 0x4C,
+    0x3B, 0x71, 0x8D, 0xB5, 0x42, 0x44, 0xAE, 0x03, 0x0B, 0x8C, 0xB4, 0x37, 0xAC, 0x62, 0x43, 0xA9,
+    0xDD, 0x22, 0x3C, 0x7F, 0x8F, 0x07, 0x20, 0xBE, 0xD5, 0x73, 0x1A, 0xD5, 0x11, 0x39, 0xA8, 0xA0,
+    0x2C, 0x87, 0x54, 0x8F, 0x1B, 0xD1, 0x78, 0x00, 0xAB, 0x18, 0xBE, 0xEE, 0xA7, 0x5D, 0x5D, 0x6D,
+    0x05, 0x28, 0xC4, 0xC9, 0xCE, 0x19, 0xEE, 0x05, 0x62, 0x01, 0x2A, 0xA2, 0x33, 0x44, 0x83, 0x87,
+    0x72, 0xF7, 0x8B, 0x06, 0xF0, 0xCE, 0x28, 0x6D, 0x14, 0xC8, 0xC5, 0x5A, 0x22, 0x44, 0xF6, 0xB7,
+    0x08, 0x60, 0x66, 0xFF, 0xA3, 0x62, 0x19, 0x25, 0x72, 0x81, 0xBB, 0x6B, 0x34, 0x95, 0x80, 0x0A,
+    0x85, 0x62, 0xBA, 0x3C, 0xEE, 0xB6, 0x9A, 0x17, 0xB7, 0xC6, 0x9E, 0x09, 0x9D, 0xA5, 0x17, 0x88,
+    0xA6, 0x2A, 0x9B, 0x0C, 0x49, 0xB5, 0x6E, 0x52, 0x74, 0x69, 0xBE, 0x79, 0x55, 0xCC, 0xF0, 0xBB,
+    0x9B, 0x6D, 0x77, 0x2B, 0x70, 0x17, 0xA0, 0x14, 0xAC, 0x96, 0xF3, 0x44, 0x3F, 0xC6, 0x3F, 0x9F,
+    0x9D, 0x88, 0x7B, 0x95, 0xF4, 0xBC, 0x2B, 0x31, 0x94, 0xFC, 0x90, 0x02, 0x17, 0xDF, 0x5D, 0xF7,
+    0x55, 0xBC, 0xB0, 0x61, 0x44, 0x9C, 0x23, 0x9C, 0x98, 0xD7, 0x5A, 0xAE, 0xE0, 0x53, 0x1C, 0x95,
+    0xE8, 0xD8, 0x23, 0xAD, 0x27, 0x12, 0x64, 0xE4, 0xFA, 0x65, 0xB1, 0xE5, 0xEB, 0xA2, 0xCE, 0x37,
+    0x84, 0xC8, 0xDB, 0x94, 0xB3, 0xFE, 0x07, 0x39, 0xE8, 0x53, 0xB9, 0xBE, 0x24, 0x29, 0xFB, 0x43,
+    0xE1, 0x61, 0xCD, 0x85, 0x9A, 0x93, 0x1C, 0x8C, 0xF1, 0x90, 0xF1, 0x0A, 0x01, 0x70, 0x74, 0xBD,
+    0x28, 0x91, 0x22, 0x6D, 0xB6, 0x7C, 0xC3, 0xCA, 0xA2, 0xA2, 0x3C, 0xAC, 0xA4, 0x94, 0x28, 0x60,
+    0xAD, 0x23, 0x29, 0x9D, 0xCF, 0xA4, 0x17, 0xBC, 0x01, 0xED, 0x3C, 0xD5, 0x9B, 0x8F, 0x17, 0x92,
+    0x4A, 0xE0, 0x83, 0xFF, 0x59, 0x98, 0x09, 0x02, 0x1F, 0xFE, 0xD8, 0x43, 0x03, 0xBC, 0x89, 0x7F,
+    0xE8, 0x63, 0x75, 0xAD, 0x89, 0xF3, 0x89, 0xF2, 0xCF, 0x91, 0xF3, 0x77, 0x05, 0x27, 0xD0, 0xBD,
+    0x2F, 0x27, 0x04, 0xF7, 0x4A, 0x5A, 0xC8, 0x53, 0x5B, 0x11, 0xDD, 0xAD, 0x32, 0xC3, 0xD0, 0x65,
+    0xB7, 0xC6, 0x98, 0x49, 0xEE, 0xD7, 0xE6, 0x09, 0x08, 0xCE, 0xB1, 0x58, 0x79, 0x8C, 0x35, 0xC0,
+    0x68, 0xD4, 0x43, 0xF8, 0x36, 0xE4, 0xF7, 0xCB, 0x2E, 0xAE, 0x04, 0xF8, 0x91, 0xD0, 0x1F, 0xB5,
+    0x7D, 0xB2, 0x68, 0xCF, 0xD8, 0x9C, 0x3E, 0x92, 0x09, 0xC5, 0x95, 0xFA, 0x50, 0x9B, 0xA6, 0x76,
+    0xED, 0x44, 0x3D, 0xE9, 0xAE, 0x97, 0xC1, 0xA2, 0x26, 0x53, 0x2E, 0xB1, 0xB2, 0xE6, 0x44, 0xF9,
+    0x08, 0x8D, 0x06, 0x09, 0x10, 0xF5, 0xF8, 0x3D, 0xF8, 0x3C, 0x32, 0x02, 0x93, 0x05, 0xF0, 0xCC,
+    0x68, 0xCD, 0xEF, 0x64, 0xB2, 0x66, 0x60, 0xF5, 0x89, 0x38, 0x32, 0x6A, 0x94, 0xC9, 0x0A, 0xE6,
+    0xE0, 0x23, 0xA9, 0x73, 0x22, 0x12, 0xE1, 0xFE, 0xE5, 0x8F, 0xD4, 0xF4, 0xFD, 0x54, 0x02, 0x7F,
+    0x24, 0x29, 0xE6, 0x83, 0x17, 0xBD, 0xA0, 0x8A, 0x12, 0x20, 0x82, 0xE5, 0x4B, 0xFE, 0xCC, 0x6A,
+    0x4C, 0x03, 0x84, 0xF5, 0x62, 0xAA, 0x35, 0x43, 0x8F, 0x5A, 0xC1, 0x5A, 0x14, 0xF2, 0xA6, 0xFA,
+    0xFB, 0x9B, 0x1B, 0xA2, 0xED, 0x5E, 0xE9, 0x58, 0xEE, 0x9B, 0x4D, 0x07, 0x17, 0x91, 0xF6, 0x76,
+    0x31, 0xB1, 0x8B, 0x9B, 0xFF, 0xDC, 0x54, 0xD0, 0x9D, 0xE8, 0xE2, 0x48, 0x08, 0x42, 0x2B, 0x8F,
+    0xFB, 0xAD, 0x96, 0xBA, 0xB2, 0xFC, 0xA9, 0xAA, 0xE3, 0x02, 0x39, 0x84, 0x1D, 0x23, 0xD5, 0x25,
+    0xDF, 0xA7, 0x4C, 0x5D, 0x79, 0xCB, 0xBE, 0x93, 0x0C, 0x57, 0xB3, 0x21, 0xAD, 0x2B, 0x52, 0x48,
+    0x05, 0xD5, 0x44, 0x07, 0x75, 0xF5, 0x18, 0xA9, 0xEB, 0xC7, 0xFF, 0x3A, 0xA0, 0xAD, 0xF9, 0x9A,
+    0x6F, 0x92, 0x99, 0xF4, 0x58, 0x6C, 0xDD, 0x57, 0xC4, 0xE0, 0xDE, 0x49, 0xEC, 0xF2, 0xB9, 0xC2,
+    0x46, 0xB3, 0x97, 0xAF, 0xA2, 0xE1, 0xF3, 0x39, 0x27, 0x74, 0xFF, 0x84, 0xD6, 0x63, 0x01, 0xD7,
+    0x40, 0xC6, 0x12, 0x0B, 0x0F, 0x9C, 0xD9, 0xD7, 0xF0, 0x54, 0x1D, 0x98, 0xB0, 0x71, 0x25, 0x6F,
+    0x51, 0x2A, 0x92, 0x66, 0xCC, 0x62, 0x13, 0xE5, 0x4C, 0xBE, 0x60, 0xAF, 0xFB, 0xF5, 0xBC, 0x0E,
+    0xEC, 0x10, 0xA3, 0xD4, 0xA5, 0xDF, 0xCD, 0xA0, 0x6A, 0xFC, 0x4B, 0x7A, 0x14, 0x05, 0x5D, 0x50,
+    0xD0, 0x03, 0xF7, 0x95, 0x5B, 0x65, 0x2F, 0x1B, 0xCB, 0xE1, 0x5A, 0x9F, 0x14, 0xA9, 0x67, 0x23,
+    0x3C, 0x5C, 0xEC, 0xA6, 0x99, 0x95, 0xD1, 0x80, 0x5E, 0x2E, 0x3C, 0x4C, 0x85, 0xCA, 0x5D, 0x99,
+    0xAD, 0xA6, 0x37, 0xCC, 0xA2, 0x3D, 0x66, 0xD9, 0xFF, 0x07, 0xB3, 0x2B, 0x9A, 0xBD, 0xAC, 0xB2,
+    0x27, 0x90, 0x3D, 0x19, 0xB2, 0x2E, 0x41, 0xD3, 0x9B, 0xB7, 0xE5, 0x3F, 0x93, 0x69, 0xB1, 0xC3,
+    0xFB, 0xBF, 0x54, 0xF6, 0xDD, 0x9B, 0x56, 0xAD, 0xA9, 0x6C, 0xBC, 0xD7, 0x72, 0x9A, 0x98, 0xB4,
+    0xE4, 0x37, 0x4D, 0x17, 0x2F, 0xF0, 0xDB, 0xBD, 0xB3, 0x07, 0x9A, 0x8A, 0xD0, 0x48, 0xE5, 0x2F,
+    0x8A, 0xE7, 0x78, 0xE6, 0x52, 0xA3, 0x71, 0x48, 0x93, 0x46, 0xA5, 0x2B, 0xA1, 0x2E, 0x07, 0x2A,
+    0x0D, 0x3F, 0x45, 0xA5, 0xF1, 0x45, 0x2A, 0x95, 0x8F, 0x66, 0xD6, 0xC1, 0x70, 0xB3, 0xD7, 0x96,
+    0x43, 0x3C, 0xE8, 0x43, 0x5E, 0xFE, 0x99, 0x6A, 0x69, 0xFF, 0xF7, 0x2C, 0x66, 0xCB, 0x3F, 0xE1,
+    0x64, 0x90, 0x7C, 0x91, 0x57, 0x32, 0x5E, 0xC1, 0xFB, 0xCA, 0x82, 0xD3, 0xD0, 0xB2, 0x58, 0x14,
+    0x76, 0x4A, 0x18, 0xEA, 0x31, 0xD3, 0x3B, 0xDC, 0x44, 0x54, 0xA1, 0xB1, 0x0C, 0x5B, 0x1D, 0x4E,
+    0xD7, 0xD4, 0x61, 0x83, 0x27, 0x39, 0xC3, 0xFD, 0xE4, 0xB1, 0x11, 0x90, 0xD7, 0xF8, 0xC6, 0x56,
+    0x0E, 0x3E, 0x0A, 0xA4, 0x96, 0xB5, 0xB7, 0xBE, 0xE2, 0x3F, 0x71, 0xEE, 0xF3, 0xF9, 0xEE, 0x57,
+    0x66, 0x5C, 0xCD, 0xE0, 0xB6, 0xFE, 0x2F, 0xD8, 0x7C, 0xB6, 0x28, 0x89, 0x7C, 0xC5, 0xF9, 0x12,
+    0xAE, 0x33, 0xEF, 0x16, 0x2C, 0x4E, 0xD4, 0x6B, 0x01, 0x02, 0x00, 0x95, 0xF4, 0x5B, 0x44, 0x99,
+    0x8B, 0x74, 0xE1, 0x72, 0x15, 0x7E, 0x82, 0xCA, 0xBC, 0xB1, 0x53, 0x5E, 0x52, 0x9B, 0x44, 0x87,
+    0xAA, 0x58, 0x5D, 0xFC, 0xF9, 0x2A, 0xC7, 0x8D, 0x77, 0xE0, 0xE2, 0x2B, 0xA9, 0xE3, 0x3F, 0xA0,
+    0xB5, 0x26, 0x39, 0xB5, 0xC6, 0xCB, 0xC6, 0x2B, 0xE0, 0xB1, 0x0F, 0xE0, 0x4D, 0x15, 0xF9, 0xAD,
+    0x78, 0xC1, 0xD8, 0xE3, 0xCA, 0x83, 0xC3, 0x8C, 0xE8, 0xF4, 0x81, 0x0A, 0x4D, 0x69, 0x55, 0x6E,
+    0x51, 0x51, 0xED, 0x7B, 0x99, 0x6D, 0x2A, 0xB8, 0xB5, 0x44, 0x2F, 0x6C, 0x8B, 0xB6, 0x96, 0xC8,
+    0x7A, 0xAE, 0xD7, 0x88, 0xEB, 0xF0, 0x79, 0x71, 0x3B, 0x7D, 0xB8, 0xF3, 0x50, 0x1B, 0x67, 0x78,
+    0x38, 0x10, 0xF3, 0xE6, 0x12, 0x21, 0x61, 0xCE, 0xEC, 0x8B, 0xA7, 0x1F, 0x90, 0xDA, 0x96, 0x35,
+    0xC7, 0x26, 0x8C, 0xB1, 0xA4, 0xC7, 0xCD, 0x29, 0x2B, 0xED, 0x8C, 0x9C, 0x8E, 0x98, 0xE7, 0x48,
+    0x34, 0x26, 0x4F, 0xA8, 0x29, 0xE2, 0xD4, 0x2C, 0x22, 0x6A, 0x1C, 0xF5, 0x93, 0xBE, 0x16, 0x8A,
+    0x6C, 0x48, 0xC5, 0xE3, 0x25, 0xB0, 0x56, 0xA4, 0x9A, 0x6D, 0xD4, 0xFF, 0x1E, 0x8B, 0x6E, 0xD0,
+    0xE4, 0xAE, 0x70, 0x7B, 0xB0, 0xA3, 0x31, 0x60, 0x92, 0xCC, 0x97, 0x84, 0x66, 0x3C, 0xF7, 0x7F,
+    0xEC, 0x9B, 0xC8, 0x7F, 0xDB, 0x77, 0xA8, 0xF1, 0x10, 0xE8, 0x60, 0xA8, 0x78, 0xA6, 0xE4, 0x55,
+    0xC2, 0x41, 0x09, 0xAA, 0x8F, 0x41, 0xD5, 0x7D, 0xDA, 0xB3, 0x20, 0x55, 0x2D, 0xA5, 0xEA, 0x2E,
+    0x1E, 0x99, 0x6A, 0x5B, 0x5D, 0xCD, 0x1B, 0xFD, 0x2A, 0x1B, 0x18, 0x7F, 0xB9, 0x56, 0xF3, 0x97,
+    0x1F, 0x3C, 0x67, 0x58, 0x56, 0xE7, 0xF2, 0xD8, 0x47, 0x70, 0x41, 0x1C, 0x0A, 0x22, 0xC1, 0x91,
+    0x80, 0xF0, 0x5B, 0xBE, 0x88, 0x3C, 0x36, 0x8C, 0x67, 0xFA, 0xD0, 0x65, 0x42, 0xCE, 0xFA, 0x48,
+    0xF5, 0x90, 0x60, 0x98, 0xB8, 0xFD, 0xA8, 0x1A, 0xFC, 0x2A, 0x64, 0xF3, 0x3D, 0x7D, 0x91, 0x38,
+    0x5F, 0x25, 0xAD, 0x8B, 0x09, 0x83, 0x25, 0x9E, 0x20, 0xCF, 0x9C, 0xE0, 0x5D, 0xDE, 0x05, 0x3E,
+    0x6F, 0x03, 0x0F, 0x8E, 0x5D, 0x40, 0xB6, 0x0B, 0x75, 0x44, 0xC2, 0x9B, 0xC0, 0x50, 0x43, 0xCD,
+    0xF1, 0x5A, 0x0B, 0x31, 0x3D, 0x3B, 0xF3, 0x41, 0xDE, 0x78, 0xE5, 0xF4, 0xCB, 0x28, 0x64, 0xFC,
+    0xDB, 0x9C, 0x14, 0x7C, 0x03, 0xFD, 0x92, 0xFF, 0x9E, 0xC4, 0x06, 0x9C, 0xA0, 0xB3, 0x7E, 0x47,
+    0xC5, 0x03, 0x6F, 0xE5, 0x36, 0x1C, 0x5A, 0x53, 0xA4, 0x95, 0xF8, 0xE4, 0xFF, 0xF0, 0xFA, 0x91,
+    0xB5, 0x88, 0x7F, 0xBC, 0x4E, 0x97, 0xD3, 0xFE, 0xD8, 0x86, 0xF5, 0xC6, 0x34, 0xF9, 0x81, 0x51,
+    0x19, 0x77, 0xAA, 0xAE, 0x20, 0xF6, 0x1B, 0xBF, 0x76, 0x36, 0x6A, 0xC4, 0xAC, 0xFF, 0xCE, 0xCC,
+    0x76, 0xB7, 0x83, 0xFF, 0x90, 0x70, 0x44, 0xFD, 0x76, 0x94, 0xAA, 0x0F, 0x4D, 0x26, 0x6B, 0x4D,
+    0x78, 0x59, 0xEA, 0x83, 0x20, 0x6E, 0x3C, 0x8A, 0x87, 0x7C, 0x2A, 0xA7, 0x68, 0x3A, 0x9F, 0xA2,
+    0xE5, 0x87, 0x13, 0xCA, 0x8B, 0x01, 0x09, 0xB6, 0x48, 0xB6, 0x27, 0x29, 0xC3, 0xE5, 0x09, 0xC0,
+    0xA5, 0x29, 0x00, 0xB7, 0xBC, 0x0E, 0xA4, 0x7D, 0xDD, 0x85, 0x63, 0xD2, 0xC7, 0x7D, 0xD4, 0xC7,
+    0x43, 0xD8, 0xAA, 0x55, 0xD1, 0xCC, 0x9E, 0xAD, 0x81, 0x5F, 0x4B, 0x97, 0xBA, 0xB9, 0x0D, 0x49,
+    0x4A, 0x7B, 0x14, 0x52, 0xE5, 0xFF, 0x45, 0x70, 0x87, 0xFD, 0x40, 0x1C, 0x75, 0x4F, 0x0A, 0xD5,
+    0x71, 0xDF, 0xA3, 0xDC, 0x4F, 0xBF, 0xBD, 0xBC, 0xF9, 0xC2, 0x90, 0xCF, 0xF7, 0x21, 0xDF, 0x3F,
+    0x40, 0x8B, 0xC0, 0x4A, 0xE0, 0xD8, 0xDD, 0x38, 0x75, 0x37, 0x2A, 0xF0, 0x84, 0xF2, 0x66, 0x5D,
+    0xC9, 0x00, 0x5C, 0xDC, 0x45, 0x16, 0x3A, 0x78, 0x10, 0xB6, 0x44, 0x62, 0xA1, 0x1B, 0x65, 0x5C,
+    0xBE, 0x09, 0xEF, 0xFB, 0xDF, 0x77, 0xA7, 0xAB, 0xB9, 0x7F, 0xC3, 0xA3, 0x69, 0x62, 0xFD, 0x51,
+    0xC0, 0x83, 0x6E, 0x3C, 0x74, 0xF7, 0x59, 0x86, 0xAE, 0xBB, 0x00, 0xF9, 0x9C, 0x4B, 0xC6, 0x00,
+    0x3B, 0xE2, 0x13, 0x88, 0x5B, 0xCC, 0x00, 0x27, 0xA4, 0x0C, 0x8E, 0x38, 0xD9, 0x8D, 0xFA, 0x90,
+    0x98, 0xB0, 0x58, 0xF4, 0xDF, 0xD8, 0x4A, 0x7A, 0xD5, 0x27, 0xE5, 0x36, 0x18, 0xFF, 0xFA, 0x77,
+    0xDC, 0x1D, 0x14, 0x69, 0xF0, 0x20, 0xB7, 0x28, 0x9F, 0xD7, 0x1A, 0x71, 0xE6, 0x31, 0xFA, 0x66,
+    0x77, 0x3B, 0x1E, 0xE2, 0xBA, 0xB8, 0x15, 0x0F, 0x5F, 0xA8, 0x8B, 0x93, 0x78, 0xF8, 0xFD, 0xB2,
+    0xF8, 0x7E, 0x3C, 0xFE, 0x51, 0x59, 0x20, 0xDB, 0x7F, 0xAF, 0x7C, 0xBD, 0x8D, 0xC7, 0xAE, 0xFC,
+    0x6A, 0x15, 0x9F, 0x37, 0xE5, 0xDB, 0x8E, 0x0C, 0xF0, 0x94, 0x45, 0x52, 0x39, 0x6C, 0xB3, 0xC4,
+    0xD1, 0x52, 0x8B, 0xE8, 0xFF, 0xB4, 0x0A, 0x1E, 0x82, 0x95, 0xE3, 0x01, 0x30, 0x01, 0xD4, 0xA4,
+    0xBF, 0x45, 0x5B, 0x0E, 0x1C, 0xB7, 0x76, 0x4C, 0x7A, 0x95, 0xDB, 0xFA, 0x91, 0x62, 0xFD, 0x33,
+    0xA1, 0x39, 0x6F, 0xD1, 0xC6, 0x6C, 0xEF, 0x83, 0x1E, 0x98, 0x67, 0x4D, 0xB2, 0x14, 0xC8, 0x0F,
+    0xF8, 0xCE, 0x97, 0x1E, 0x71, 0x68, 0x92, 0x33, 0x8E, 0xB1, 0x05, 0x57, 0x42, 0xCA, 0xF9, 0xB3,
+    0x1E, 0x1A, 0x81, 0x09, 0x44, 0xA1, 0x89, 0xC8, 0xEE, 0x48, 0x0A, 0xDF, 0x94, 0x9B, 0x3F, 0x51,
+    0x9A, 0xD3, 0xA8, 0xE7, 0x3F, 0xE9, 0xF3, 0xC9, 0xC7, 0x95, 0xB2, 0xD6, 0xBE, 0x6D, 0xA3, 0xDC,
+    0xDB, 0xF3, 0x27, 0xA7, 0x21, 0x8C, 0xC6, 0x33, 0x36, 0xCE, 0xB6, 0x59, 0x7C, 0x6D, 0xA3, 0x96,
+    0xD1, 0xF8, 0xFB, 0xF4, 0x9D, 0x08, 0x3D, 0x5E, 0xFC, 0xB3, 0xBB, 0x63, 0xC2, 0xF4, 0x4F, 0x37,
+    0xA4, 0x16, 0xAC, 0x22, 0xE8, 0xAD, 0xD6, 0x7B, 0xF3, 0xA3, 0xAB, 0xC0, 0xE5, 0x2D, 0x7C, 0x34,
+    0xE4, 0x7D, 0xC0, 0xA1, 0x48, 0xAF, 0xB9, 0x88, 0x73, 0x77, 0xB6, 0x5E, 0x48, 0x27, 0x27, 0xED,
+    0xFA, 0xCC, 0xEB, 0xF0, 0x5C, 0x86, 0xCC, 0x41, 0xEA, 0x70, 0xE4, 0x0E, 0x47, 0xF2, 0x70, 0x64,
+    0x0F, 0x47, 0xFA, 0x70, 0xE4, 0x0F, 0x47, 0x02, 0x71, 0x64, 0x90, 0x35, 0xDB, 0x55, 0x16, 0x8C,
+    0x83, 0x23, 0x8B, 0x38, 0xD2, 0x88, 0x4B, 0x35, 0xEB, 0xD5, 0x44, 0xEC, 0x9A, 0x4D, 0x8F, 0x50,
+    0xEA, 0x59, 0x88, 0xF3, 0x3D, 0xA7, 0x79, 0xDB, 0xEF, 0x7D, 0x6E, 0x02, 0x71, 0xC6, 0x08, 0x43,
+    0x24, 0x85, 0x3E, 0xEC, 0xB2, 0xE2, 0x2D, 0x7E, 0xF8, 0x7B, 0x41, 0x15, 0x0E, 0x59, 0x91, 0x14,
+    0x83, 0xBB, 0x8D, 0x06, 0xE1, 0x2F, 0xA3, 0xCE, 0xD5, 0x6F, 0xE0, 0xA0, 0x77, 0x41, 0x04, 0xFF,
+    0x02, 0x6F, 0xFC, 0xCA, 0xB0, 0xDE, 0x8B, 0x92, 0x79, 0xAC, 0x49, 0x66, 0xA0, 0x87, 0x1C, 0x2D,
+    0x05, 0xEC, 0x82, 0xE2, 0x28, 0xEC, 0x6E, 0xEB, 0x3B, 0x6F, 0x45, 0xC5, 0xFA, 0x98, 0x75, 0x47,
+    0x4E, 0xA8, 0x92, 0x36, 0x12, 0xE5, 0xE1, 0x9E, 0x06, 0xB1, 0x30, 0xE6, 0x45, 0xDA, 0x44, 0xFD,
+    0xC5, 0x87, 0x13, 0x2A, 0x29, 0xD2, 0x25, 0xF6, 0xEA, 0xD5, 0x6A, 0xCF, 0x72, 0x03, 0x34, 0xEA,
+    0xBF, 0xAD, 0x07, 0x91, 0xB1, 0xFC, 0x9D, 0x53, 0x07, 0xAB, 0x72, 0xAC, 0xB9, 0xBC, 0x77, 0xF6,
+    0x5D, 0xFF, 0xC8, 0x1E, 0x35, 0x31, 0xF0, 0x51, 0x56, 0xFD, 0xD9, 0xFC, 0xA6, 0xFC, 0xC0, 0x6A,
+    0xA2, 0xBC, 0xB1, 0xAA, 0xC8, 0x86, 0x05, 0x34, 0x94, 0xD5, 0x47, 0xA4, 0x53, 0x2B, 0xB1, 0xD4,
+    0x2E, 0xEC, 0xBC, 0x95, 0x46, 0xFC, 0xDD, 0x5A, 0xA1, 0x25, 0x02, 0x0B, 0x17, 0x0B, 0xA4, 0x70,
+    0xB6, 0x94, 0xCA, 0x10, 0xAF, 0xAC, 0xE0, 0xB2, 0xB6, 0xE0, 0x39, 0x71, 0x14, 0xEE, 0x2A, 0xBC,
+    0x42, 0x6B, 0x15, 0x2A, 0x4D, 0x09, 0x5F, 0x5B, 0x22, 0x79, 0x14, 0xB2, 0xC8, 0xBE, 0xDE, 0xB9,
+    0x53, 0x58, 0x13, 0xA5, 0xEF, 0xFB, 0xBF, 0xD3, 0xA8, 0x51, 0xCF, 0x24, 0x38, 0x6B, 0x59, 0xAC,
+    0xA7, 0x39, 0xDE, 0xD7, 0x73, 0x50, 0xF4, 0xF4, 0x1D, 0xD3, 0x73, 0x55, 0x73, 0x3A, 0x68, 0x99,
+    0x9B, 0x72, 0xA5, 0xE9, 0xC6, 0x8C, 0x77, 0xD0, 0x10, 0x0A, 0x76, 0x7B, 0xFD, 0x56, 0xF5, 0x02,
+    0xD3, 0x6A, 0x55, 0x8E, 0xB9, 0xF2, 0x3D, 0xA9, 0xC6, 0x69, 0x9D, 0x3D, 0x1A, 0x60, 0x26, 0xDF,
+    0x6A, 0x9A, 0x7D, 0x35, 0xB9, 0x96, 0x93, 0x6B, 0xD0, 0x5B, 0x41, 0x79, 0xA1, 0xA2, 0x34, 0xFB,
+    0x31, 0xEF, 0x34, 0xA6, 0x51, 0x63, 0x1A, 0x55, 0xDB, 0xF4, 0x68, 0x33, 0x9E, 0x58, 0x88, 0x1A,
+    0xFD, 0x8D, 0x9E, 0xA2, 0xFB, 0x9F, 0x2C, 0xD2, 0xE8, 0xF5, 0x59, 0x1A, 0x45, 0xA6, 0x91, 0x14,
+    0x5B, 0xAD, 0xB6, 0x1A, 0x4D, 0x4D, 0x89, 0x53, 0xF6, 0x97, 0x2A, 0x59, 0xBF, 0x57, 0x8C, 0xF6,
+    0x6A, 0xAD, 0xDF, 0x6E, 0xA5, 0x51, 0xFE, 0xC1, 0xAA, 0x51, 0x21, 0x8D, 0x66, 0xAB, 0x8E, 0x7F,
+    0x55, 0x8D, 0x9C, 0x7B, 0xE5, 0x4D, 0x73, 0xCA, 0xC0, 0x5B, 0x35, 0x55, 0x7F, 0xF4, 0x0B, 0x86,
+    0x34, 0xDD, 0x52, 0x63, 0x26, 0xFA, 0x25, 0x9F, 0x73, 0x9B, 0x6E, 0xAF, 0x5C, 0x70, 0x05, 0xB9,
+    0xE6, 0xE9, 0x69, 0x65, 0xBE, 0xC9, 0xDB, 0xE5, 0x9C, 0x77, 0xF4, 0x30, 0xA9, 0x8D, 0xCC, 0x81,
+    0xE8, 0x9E, 0x02, 0x83, 0x9A, 0xEA, 0x3E, 0xEA, 0xAA, 0x02, 0x9F, 0xF6, 0x93, 0x33, 0xD1, 0x45,
+    0xF9, 0x86, 0x1A, 0xEB, 0x41, 0x91, 0xAC, 0x48, 0x7C, 0xA4, 0x35, 0x11, 0x92, 0x25, 0xF5, 0x86,
+    0x7E, 0x9A, 0x4C, 0xC7, 0xE6, 0xA8, 0xB1, 0xEF, 0xCC, 0x53, 0xD9, 0x89, 0xEA, 0x21, 0x24, 0xCB,
+    0x94, 0x15, 0xFE, 0x83, 0xB3, 0xEE, 0xBD, 0x75, 0x73, 0xD7, 0xBD, 0xBF, 0x5E, 0x72, 0x58, 0xA2,
+    0x71, 0xBC, 0xA1, 0xB1, 0x8C, 0x1B, 0x1A, 0xC3, 0xA7, 0xD0, 0xD8, 0xC2, 0x94, 0x40, 0x0A, 0x0D,
+    0xE2, 0xA3, 0x40, 0xC5, 0x1B, 0x8B, 0x54, 0x3E, 0x48, 0x24, 0x1A, 0xC7, 0x8C, 0x2A, 0x43, 0xA3,
+    0x5A, 0x83, 0xD5, 0x66, 0x61, 0xAB, 0xAB, 0x10, 0x0D, 0xBD, 0x21, 0x1A, 0xC2, 0x47, 0x68, 0x2C,
+    0x2B, 0x1A, 0x2B, 0x2C, 0xE6, 0x34, 0x42, 0x83, 0x6F, 0x84, 0x46, 0x3C, 0xAD, 0x68, 0xC4, 0xD3,
+    0x55, 0x43, 0x23, 0xF2, 0xBD, 0xA1, 0x41, 0x97, 0x34, 0x34, 0xAE, 0xFD, 0x9A, 0x68, 0xFC, 0x1F,
+    0x7D, 0x55, 0x31, 0x6C, 0xE4, 0x44, 0x14, 0x7D, 0xB6, 0xEF, 0x62, 0xC1, 0x08, 0x26, 0x45, 0xD2,
+    0x70, 0x22, 0xBE, 0x7A, 0x95, 0x8D, 0x1B, 0x24, 0x28, 0x36, 0x8C, 0x25, 0x0A, 0x0A, 0x9A, 0x14,
+    0x17, 0xDA, 0xA3, 0x4E, 0x43, 0xBB, 0xC5, 0x26, 0x36, 0x5C, 0x41, 0x41, 0x93, 0x86, 0x9E, 0x3A,
+    0xCD, 0x35, 0x57, 0xE4, 0xA4, 0x5C, 0x6C, 0xA0, 0xA0, 0xC4, 0xD0, 0xD2, 0x18, 0x71, 0x12, 0xC5,
+    0x15, 0x4C, 0x61, 0x21, 0x23, 0xD9, 0x3B, 0xBC, 0x3F, 0xDE, 0xDD, 0x44, 0x39, 0x1D, 0x23, 0xCD,
+    0xB7, 0x76, 0x66, 0xFE, 0xFF, 0xEF, 0xBF, 0xFF, 0x66, 0x36, 0xFD, 0x75, 0x09, 0xF3, 0xE3, 0x00,
+    0xF3, 0x75, 0x0F, 0xF3, 0x49, 0x07, 0x13, 0xB5, 0x38, 0x8D, 0x2C, 0x16, 0x51, 0x8D, 0xCB, 0xA8,
+    0xC2, 0x38, 0xEC, 0x3E, 0x10, 0xD8, 0x19, 0x10, 0x36, 0x73, 0x20, 0xAA, 0x9E, 0x89, 0xB1, 0x40,
+    0xFC, 0x83, 0x45, 0xEC, 0x9C, 0xCB, 0xBC, 0x41, 0x22, 0x0E, 0xD3, 0xB8, 0x00, 0x66, 0x3A, 0x13,
+    0x43, 0xD7, 0xF9, 0x1E, 0x60, 0x9C, 0xEB, 0x46, 0x13, 0x34, 0x0B, 0x06, 0xA9, 0x2F, 0xD7, 0xFE,
+    0x62, 0xD4, 0x57, 0x0D, 0xA0, 0xC3, 0x1A, 0xEB, 0xA1, 0xC4, 0x88, 0xEF, 0x96, 0x7B, 0x29, 0xCE,
+    0x4B, 0xC0, 0xED, 0x3B, 0x04, 0xC3, 0x7E, 0x8E, 0xB0, 0xFF, 0xC8, 0x20, 0x1C, 0x3E, 0xD8, 0x41,
+    0xE0, 0x88, 0x02, 0x8E, 0x01, 0x90, 0xF3, 0x04, 0x12, 0xC7, 0xE4, 0xA1, 0xFC, 0x0E, 0x5C, 0x8B,
+    0xAD, 0xF0, 0x17, 0x29, 0xE6, 0x27, 0x31, 0x4F, 0x68, 0xBE, 0xF9, 0xD4, 0xC2, 0xBC, 0xD2, 0x0D,
+    0xB4, 0x73, 0x05, 0x82, 0x92, 0x81, 0xF1, 0x8E, 0xE4, 0x79, 0x5F, 0xCC, 0xBE, 0x98, 0x7B, 0x1B,
+    0x00, 0x28, 0x6B, 0x4C, 0x11, 0xFD, 0xD3, 0x62, 0x06, 0x5D, 0xF5, 0x68, 0x91, 0x66, 0x7D, 0xD8,
+    0xC0, 0xA0, 0x8F, 0x2B, 0xE4, 0xE8, 0x09, 0xEE, 0x3A, 0xE8, 0x0F, 0x80, 0x21, 0x6C, 0x59, 0xD0,
+    0x10, 0x59, 0xFB, 0x5E, 0x36, 0xC4, 0x7F, 0xFE, 0xE6, 0xEC, 0xB5, 0xFE, 0xF9, 0xDB, 0xA6, 0x33,
+    0xA5, 0x4E, 0xAA, 0x5E, 0xBD, 0x3C, 0x34, 0x59, 0x0F, 0x5C, 0xD2, 0x91, 0xFC, 0x9D, 0xD1, 0x46,
+    0xF5, 0x75, 0xD0, 0x41, 0x15, 0x74, 0x44, 0x22, 0x8E, 0x4C, 0xF1, 0x42, 0x91, 0x6B, 0x98, 0xC7,
+    0x59, 0x60, 0x91, 0x0C, 0x1E, 0x40, 0xB6, 0x81, 0xF2, 0xA5, 0xD4, 0x16, 0xBA, 0x92, 0xC5, 0xC5,
+    0x9D, 0x26, 0x49, 0xDA, 0xAA, 0xE6, 0xC6, 0xFA, 0x95, 0x36, 0x25, 0xE5, 0xF1, 0x20, 0x27, 0x23,
+    0xD7, 0xEC, 0x3E, 0x62, 0x4F, 0x32, 0xD3, 0xA3, 0x74, 0x95, 0x29, 0xA2, 0xC1, 0x34, 0xA7, 0x3C,
+    0x92, 0xB4, 0x3D, 0xD2, 0x46, 0x0D, 0x2D, 0x4C, 0x1D, 0x91, 0x25, 0x53, 0x83, 0x84, 0xD1, 0xE6,
+    0x35, 0x0C, 0x4B, 0x63, 0xEA, 0x36, 0x70, 0x3D, 0x94, 0x7B, 0xFA, 0x97, 0x3B, 0x0F, 0xDC, 0x32,
+    0x74, 0x0D, 0x02, 0xC1, 0x61, 0x2A, 0x53, 0xE5, 0x45, 0xCE, 0xBA, 0x4F, 0xB1, 0x20, 0xD0, 0x75,
+    0x97, 0x6A, 0xBC, 0xAB, 0x2A, 0xA4, 0x9F, 0x15, 0x48, 0x7F, 0x57, 0x45, 0x40, 0x88, 0x27, 0xCE,
+    0x55, 0xF9, 0xDF, 0x0D, 0x4E, 0xA7, 0x4B, 0x6C, 0xCF, 0xF2, 0x0C, 0x0B, 0x36, 0xBF, 0xBF, 0x37,
+    0x52, 0xFB, 0xF6, 0xAA, 0xA9, 0xB7, 0xE6, 0xEE, 0xE3, 0xEF, 0x32, 0xCA, 0xA2, 0x9E, 0x3C, 0xBD,
+    0x28, 0xEE, 0xEE, 0xF9, 0x39, 0x8E, 0x56, 0xC4, 0xC7, 0xD2, 0x6A, 0x11, 0x0C, 0x37, 0x08, 0x2A,
+    0xE1, 0xF2, 0x21, 0x27, 0xC9, 0x47, 0x37, 0x6E, 0xB3, 0x3F, 0x10, 0xFD, 0xA9, 0x62, 0xF4, 0x65,
+    0x77, 0xC8, 0x2D, 0x3C, 0xE0, 0x37, 0x6C, 0x4B, 0x84, 0x2B, 0xCE, 0x2F, 0xC6, 0x3C, 0x47, 0x8C,
+    0xCF, 0x1C, 0x69, 0x45, 0x81, 0xF1, 0xC3, 0xF2, 0xC9, 0x68, 0x42, 0x5F, 0x93, 0xF9, 0x9F, 0x08,
+    0x85, 0xE1, 0x94, 0x47, 0x22, 0xE9, 0x52, 0x5E, 0x8D, 0xE7, 0x71, 0xB4, 0x7B, 0x7C, 0xEC, 0xEB,
+    0x90, 0x89, 0x5B, 0x63, 0x72, 0x71, 0x71, 0x2E, 0x6B, 0xB2, 0xFF, 0x70, 0x95, 0xCF, 0x48, 0x15,
+    0xDE, 0x9D, 0x40, 0x54, 0x27, 0x62, 0x13, 0x44, 0xB5, 0x5F, 0x88, 0x29, 0x16, 0xF6, 0x43, 0xC2,
+    0x4B, 0x9A, 0x8F, 0xB9, 0xFB, 0xD0, 0x47, 0xDA, 0x2A, 0xCF, 0x69, 0x83, 0xF2, 0x95, 0x13, 0xE6,
+    0x5B, 0x3C, 0xA8, 0x3D, 0xAA, 0x80, 0xD4, 0xF4, 0x9E, 0x06, 0x0A, 0xE9, 0x11, 0xCF, 0xAB, 0x5A,
+    0xB9, 0x2E, 0x41, 0x52, 0xF0, 0x2E, 0xEB, 0x2C, 0xA5, 0xC0, 0x5A, 0x9D, 0x99, 0xB0, 0x8B, 0xAC,
+    0xCE, 0xCE, 0xA2, 0x56, 0x3E, 0x2F, 0x94, 0x8D, 0xF9, 0xB9, 0x12, 0x05, 0x69, 0x5C, 0xE9, 0x46,
+    0x35, 0x89, 0x7C, 0x74, 0x7D, 0x80, 0x2B, 0x65, 0x93, 0x9A, 0x82, 0x8C, 0xDA, 0x0F, 0x9B, 0x16,
+    0x67, 0x81, 0xFB, 0x83, 0x05, 0x19, 0x4C, 0xB2, 0x09, 0x89, 0x18, 0x35, 0xA9, 0xC7, 0x37, 0x21,
+    0x92, 0x7B, 0x47, 0xE0, 0x64, 0x84, 0x22, 0x40, 0xF2, 0xEF, 0xE7, 0x83, 0x07, 0xE8, 0xCE, 0x37,
+    0xD5, 0xA7, 0x6E, 0x88, 0x9D, 0x4D, 0x5D, 0xA7, 0x5C, 0x13, 0xF2, 0x75, 0x38, 0xA5, 0x8C, 0x3D,
+    0x54, 0x27, 0x4D, 0x89, 0x96, 0xD2, 0x58, 0x61, 0xC2, 0x4A, 0xD9, 0xEC, 0xA0, 0xA2, 0xE5, 0xFD,
+    0xEC, 0xA4, 0x55, 0xBA, 0x95, 0x76, 0x93, 0x7B, 0xB6, 0x2C, 0xB5, 0xD2, 0x76, 0x0A, 0x94, 0xAD,
+    0xA3, 0x52, 0xD9, 0x7E, 0x72, 0xA8, 0x3D, 0x93, 0x94, 0x01, 0x57, 0x48, 0x6B, 0xDA, 0xF2, 0x56,
+    0xC9, 0xDD, 0x6E, 0xE4, 0xFA, 0x3B, 0x81, 0x1A, 0x6C, 0xEE, 0x90, 0xA6, 0xDC, 0xF5, 0xF2, 0xC8,
+    0xB7, 0x32, 0xB5, 0xDE, 0xC5, 0xB7, 0x41, 0x1A, 0x28, 0xF7, 0x4A, 0x1A, 0x20, 0x2E, 0x9C, 0x81,
+    0x83, 0x47, 0x29, 0xE8, 0xA4, 0x0B, 0x11, 0xD9, 0x95, 0xA6, 0x10, 0x9B, 0x20, 0x13, 0x5C, 0x3E,
+    0xCC, 0x26, 0x94, 0x4C, 0xDE, 0xA3, 0x09, 0x05, 0x0C, 0xFB, 0x8C, 0x63, 0xCE, 0xB1, 0x98, 0x8D,
+    0xE3, 0x70, 0x3A, 0x9D, 0x1E, 0xEC, 0xED, 0xED, 0xBD, 0xB5, 0x81, 0x71, 0xDF, 0xAD, 0x72, 0x9B,
+    0xEA, 0x26, 0xBF, 0x2B, 0x36, 0xB9, 0x7D, 0xFE, 0xE5, 0x4D, 0xFE, 0x75, 0x6E, 0xB5, 0xCA, 0xBD,
+    0xCE, 0x7F, 0xB7, 0x0C, 0x42, 0xC8, 0x39, 0x4F, 0x2E, 0xB2, 0xF1, 0xF9, 0x94, 0x3B, 0x42, 0x1D,
+    0xFB, 0xFD, 0xE7, 0x3C, 0x6B, 0x5B, 0x72, 0x3B, 0x27, 0x9B, 0x33, 0x72, 0x79, 0xC0, 0x6D, 0x4D,
+    0xEE, 0x54, 0x71, 0xC8, 0x95, 0x05, 0xF9, 0xDE, 0xA1, 0x88, 0x29, 0xD6, 0xEF, 0x4B, 0xE7, 0xDF,
+    0x53, 0x1C, 0x33, 0x68, 0x52, 0xC7, 0x96, 0xFA, 0xDA, 0xF6, 0xD8, 0x03, 0xAE, 0xC7, 0xA4, 0x50,
+    0x38, 0x48, 0xDA, 0x5B, 0xB5, 0xDF, 0xA1, 0x92, 0x65, 0x3C, 0x20, 0xF4, 0x92, 0xCB, 0x65, 0x37,
+    0x0A, 0xFD, 0xB5, 0x52, 0x6E, 0x51, 0xE9, 0xA7, 0x9C, 0x93, 0xB7, 0xFB, 0x44, 0x28, 0xFC, 0xBF,
+    0xE1, 0x91, 0x24, 0x0C, 0x77, 0x5F, 0x18, 0x2B, 0x5F, 0x67, 0x2F, 0xBC, 0xDD, 0xBD, 0xA5, 0xA0,
+    0xA6, 0x1A, 0x0D, 0x4B, 0x27, 0xEB, 0x6A, 0x78, 0x03, 0x7B, 0xF5, 0x2A, 0x0C, 0x6F, 0x3D, 0xC3,
+    0xE4, 0x3C, 0x76, 0xB2, 0xD2, 0xB0, 0x6E, 0x03, 0x6B, 0x96, 0xFC, 0xDF, 0x4B, 0x9F, 0x34, 0x73,
+    0x42, 0xBC, 0x0C, 0x5C, 0xB6, 0x8D, 0x1D, 0xFC, 0x07, 0xCD, 0x5A, 0x4D, 0x8C, 0xDD, 0xD4, 0x15,
+    0x3E, 0xB6, 0x93, 0xB8, 0x8A, 0x55, 0x39, 0x8B, 0xCC, 0x02, 0x28, 0xB8, 0x0B, 0x16, 0x28, 0x90,
+    0xF1, 0xA6, 0x8B, 0x48, 0x9D, 0x19, 0x1B, 0x90, 0xCA, 0x82, 0x45, 0x66, 0xD1, 0xE9, 0x86, 0x05,
+    0xDD, 0x16, 0xD4, 0x66, 0x9B, 0xAA, 0x93, 0xD8, 0x81, 0x05, 0xCB, 0xA4, 0x52, 0x2B, 0x75, 0x55,
+    0xB2, 0x60, 0x41, 0x07, 0xA9, 0x41, 0x6A, 0x16, 0xA9, 0x48, 0x62, 0x47, 0x91, 0xDA, 0x05, 0x0B,
+    0xCC, 0x9F, 0x58, 0x74, 0x51, 0xA7, 0x84, 0xA6, 0x82, 0x45, 0x8C, 0x30, 0xE0, 0x4C, 0x6C, 0xDF,
+    0x7E, 0xDF, 0xB9, 0xEF, 0x67, 0x26, 0x40, 0xA9, 0x80, 0x51, 0xE6, 0xCD, 0xBC, 0xF3, 0x66, 0xFC,
+    0xEC, 0x7B, 0xCE, 0x3D, 0xF7, 0x9C, 0xEF, 0x7C, 0xE7, 0xDA, 0x12, 0xA5, 0x92, 0x95, 0x52, 0x54,
+    0x94, 0x71, 0x2A, 0xF6, 0xF5, 0x88, 0xC8, 0x92, 0xC8, 0xBA, 0x48, 0xC7, 0x5F, 0xB7, 0x15, 0xAF,
+    0x15, 0xBF, 0x91, 0xA0, 0x91, 0xB0, 0x91, 0xA8, 0x91, 0xB8, 0x96, 0xA4, 0x96, 0xAC, 0xB6, 0x67,
+    0x07, 0x78, 0x87, 0x78, 0x1F, 0x3B, 0x23, 0x81, 0xE9, 0x25, 0x39, 0x37, 0xCA, 0xB8, 0x64, 0xBC,
+    0xFE, 0xC8, 0x10, 0x74, 0xC7, 0x5F, 0x0A, 0x9B, 0xF3, 0x12, 0x37, 0xAF, 0xE2, 0x82, 0x06, 0x6F,
+    0x5C, 0xF8, 0x66, 0x25, 0xC9, 0x5B, 0xA5, 0x24, 0x9F, 0x94, 0x3F, 0x8C, 0x3E, 0xBF, 0x52, 0x07,
+    0xE6, 0x66, 0xE5, 0x18, 0x93, 0x4A, 0xF4, 0x3B, 0x3B, 0x4C, 0x28, 0xD3, 0x57, 0x3C, 0xA6, 0xE2,
+    0x1A, 0xD8, 0x16, 0xB4, 0x50, 0x1A, 0xD6, 0x54, 0x5E, 0x85, 0x95, 0xC4, 0xE5, 0x3E, 0x7C, 0x59,
+    0xCA, 0x54, 0x54, 0x22, 0x9E, 0x31, 0x30, 0x91, 0x02, 0xE7, 0xC9, 0x54, 0xE0, 0x0B, 0x89, 0x78,
+    0x4A, 0xC2, 0x99, 0x9D, 0xC0, 0xDB, 0xB9, 0x7D, 0xDD, 0x4D, 0x03, 0x63, 0x4C, 0x9E, 0x18, 0x33,
+    0xCA, 0x43, 0x92, 0xB5, 0x3C, 0x2A, 0x72, 0x00, 0x62, 0xFD, 0x99, 0xA3, 0x29, 0x0E, 0x4B, 0xF8,
+    0xE6, 0x20, 0x91, 0x2C, 0xCB, 0x61, 0xC8, 0x25, 0xD8, 0x73, 0x18, 0xEF, 0x48, 0x16, 0x25, 0xCC,
+    0x2F, 0x09, 0xBF, 0x3F, 0x51, 0x9C, 0xCE, 0x79, 0x7E, 0x68, 0xAE, 0x99, 0x3A, 0x32, 0xBF, 0x35,
+    0x95, 0x37, 0x48, 0x22, 0xEE, 0x08, 0x97, 0x39, 0xA3, 0x60, 0x44, 0xE3, 0x40, 0xBF, 0xF1, 0xA0,
+    0xBA, 0x78, 0x12, 0xAA, 0xB3, 0xA3, 0xB4, 0xE1, 0x22, 0x05, 0xBE, 0x8C, 0x8D, 0xA9, 0x29, 0x60,
+    0x5D, 0x82, 0xF7, 0xA1, 0xE2, 0xC3, 0x5C, 0x0A, 0x63, 0x70, 0xB2, 0xC9, 0x71, 0x0A, 0x5C, 0x21,
+    0x0E, 0xC5, 0xC3, 0xE6, 0x3F, 0xB8, 0x1E, 0x1E, 0x15, 0x69, 0xE6, 0xAF, 0x9F, 0xAB, 0x6B, 0xCE,
+    0x6E, 0x39, 0xA2, 0x07, 0x5C, 0x4C, 0x3D, 0xBC, 0x41, 0x33, 0x46, 0x39, 0x89, 0x9F, 0x4B, 0xB0,
+    0xFC, 0x32, 0x8E, 0x67, 0x18, 0x28, 0xA1, 0x31, 0xA3, 0x78, 0xEF, 0x99, 0xCA, 0x2F, 0x8B, 0x26,
+    0x28, 0x83, 0x2E, 0xA8, 0x9D, 0xDE, 0x1F, 0xA4, 0x77, 0x4D, 0xD5, 0x4A, 0xB1, 0x59, 0x4B, 0x04,
+    0xDD, 0xAA, 0x35, 0xC9, 0xF7, 0x48, 0x94, 0x2F, 0x63, 0xB2, 0x99, 0x84, 0x69, 0x96, 0xC6, 0x92,
+    0x7C, 0xD0, 0x63, 0x61, 0x31, 0xC6, 0x82, 0x6A, 0xBA, 0xE4, 0x35, 0xC6, 0x6F, 0x47, 0xBF, 0x39,
+    0xEE, 0x56, 0x93, 0x85, 0x72, 0xCD, 0x2D, 0xAE, 0xC3, 0x26, 0x96, 0x4A, 0x06, 0x71, 0x3B, 0xF1,
+    0x70, 0xF6, 0x8A, 0x04, 0x79, 0xD6, 0x87, 0x69, 0xE4, 0x7D, 0x9A, 0x79, 0xE5, 0xE1, 0xA0, 0x8C,
+    0xDC, 0x6A, 0x29, 0x4C, 0xBF, 0xE7, 0xD4, 0x47, 0x22, 0x4E, 0xE9, 0x78, 0x7C, 0xA7, 0xB4, 0xC7,
+    0x97, 0x42, 0x58, 0x52, 0x2F, 0x87, 0xA5, 0xE7, 0x56, 0x91, 0xD7, 0x46, 0x5E, 0x19, 0xA6, 0x05,
+    0xC6, 0xF1, 0xAA, 0xBD, 0x30, 0xC6, 0xE9, 0xC4, 0x81, 0x47, 0x92, 0x0F, 0xCE, 0x41, 0xC5, 0x3E,
+    0xCC, 0x0A, 0xAF, 0xBD, 0x14, 0xC5, 0x1F, 0xFC, 0x7F, 0xF7, 0xD1, 0x95, 0x2E, 0x79, 0xAC, 0xCD,
+    0xBC, 0xF6, 0xB2, 0xD7, 0x8C, 0x41, 0x53, 0xDC, 0xD7, 0x64, 0x9F, 0x6C, 0x46, 0xA7, 0x3A, 0xD9,
+    0x9F, 0x9E, 0x95, 0x18, 0x56, 0xF5, 0x18, 0xB6, 0xCD, 0x24, 0xBA, 0x06, 0x4F, 0x5D, 0xED, 0x24,
+    0x79, 0xA1, 0x95, 0x18, 0x9F, 0xE1, 0x95, 0x5E, 0xFC, 0xEA, 0x12, 0xEC, 0x5E, 0x81, 0x05, 0x91,
+    0x2C, 0xAC, 0xAD, 0x31, 0x12, 0xAA, 0x43, 0x1B, 0xAF, 0x60, 0x4A, 0xEE, 0x17, 0xDE, 0x0B, 0x6B,
+    0x92, 0x99, 0x34, 0x33, 0xF2, 0xCC, 0x86, 0x7C, 0x8D, 0x0F, 0x4E, 0x9B, 0x1A, 0x3E, 0xF0, 0x3F,
+    0xBB, 0x04, 0x1F, 0x38, 0x0D, 0x7D, 0xE0, 0x34, 0x21, 0x7C, 0x80, 0xBF, 0x31, 0x6F, 0xA7, 0x59,
+    0xA4, 0xBC, 0xDD, 0xA9, 0xAC, 0xE1, 0x03, 0xA7, 0x69, 0xE1, 0x03, 0xA7, 0xB9, 0x08, 0x1F, 0x38,
+    0xCD, 0x0A, 0x7C, 0xE0, 0xB6, 0xD1, 0xE3, 0x65, 0x78, 0x74, 0x0C, 0x6E, 0xC2, 0x07, 0x50, 0xF1,
+    0x95, 0x3E, 0x40, 0x4C, 0xF5, 0xB0, 0x1A, 0x49, 0x2B, 0xFE, 0x88, 0x15, 0x2D, 0x97, 0xBD, 0x6A,
+    0xDD, 0xAD, 0xF1, 0xBB, 0xE4, 0xD5, 0xC9, 0x53, 0x65, 0x68, 0x52, 0xE7, 0x25, 0x91, 0xFD, 0x32,
+    0x4F, 0xB4, 0xC9, 0x7B, 0xE1, 0xE9, 0xDF, 0xDB, 0xF9, 0x9E, 0xDB, 0xC8, 0xEF, 0xFC, 0x6E, 0x4B,
+    0x42, 0x32, 0xFA, 0xAB, 0x44, 0x23, 0x17, 0xE9, 0xDE, 0x3A, 0xB7, 0x06, 0xAF, 0x39, 0xE9, 0x54,
+    0x88, 0xB3, 0x5E, 0x1C, 0xE4, 0x5F, 0x89, 0x24, 0x91, 0x76, 0x8F, 0x5F, 0x3E, 0x14, 0x6F, 0x5C,
+    0x48, 0x4C, 0x7B, 0x68, 0xE3, 0xEC, 0xF4, 0x4C, 0x44, 0x4D, 0x26, 0x67, 0x4F, 0xF2, 0xCC, 0xFB,
+    0x00, 0x1D, 0x15, 0x3D, 0x24, 0xFD, 0x23, 0xD2, 0xAF, 0x38, 0x5D, 0x7C, 0xB3, 0xF1, 0x91, 0xEA,
+    0x6B, 0xE2, 0x8D, 0x12, 0x74, 0xC8, 0x71, 0xC4, 0x2F, 0x12, 0x52, 0xE4, 0xDE, 0xB3, 0xEE, 0xCB,
+    0x98, 0x56, 0xED, 0x73, 0xB6, 0x75, 0x40, 0x59, 0x85, 0xB8, 0x2E, 0x2B, 0x43, 0xE4, 0x51, 0x51,
+    0x02, 0x15, 0x90, 0x33, 0x2A, 0xD3, 0x98, 0x92, 0xA1, 0xEE, 0x18, 0xA6, 0x95, 0x6B, 0x88, 0x68,
+    0x18, 0x10, 0x79, 0xE5, 0x19, 0x07, 0xD2, 0x37, 0x4F, 0x16, 0x57, 0x24, 0x28, 0x86, 0x04, 0x19,
+    0x1E, 0xB5, 0x31, 0x56, 0xDD, 0x49, 0x91, 0xF9, 0x91, 0xC5, 0x1A, 0x3B, 0x3F, 0x45, 0xC0, 0x44,
+    0x81, 0x2D, 0xD1, 0xC4, 0x8A, 0xF2, 0xD9, 0xE4, 0x01, 0x2F, 0xA6, 0x8C, 0xCC, 0xE6, 0x00, 0x57,
+    0x11, 0xCC, 0xBE, 0x4A, 0x44, 0x14, 0x01, 0x85, 0xF3, 0x0A, 0x84, 0xB8, 0xDF, 0x42, 0xDC, 0x57,
+    0x0F, 0x00, 0xE8, 0x9A, 0xE0, 0x40, 0x7F, 0xA4, 0x49, 0x99, 0x55, 0x59, 0x09, 0xA0, 0x86, 0x7B,
+    0x6A, 0x06, 0x82, 0x14, 0xB0, 0x94, 0xBF, 0xC9, 0xA0, 0x76, 0x23, 0x79, 0x8A, 0x1C, 0x91, 0xB2,
+    0x5F, 0x0F, 0x22, 0x00, 0x09, 0x7B, 0x17, 0xE9, 0x76, 0xAE, 0x51, 0x27, 0x0F, 0x8F, 0xF9, 0x33,
+    0x58, 0xE3, 0xE2, 0x4C, 0x70, 0xBB, 0x8D, 0xAF, 0xF4, 0x89, 0xF4, 0x97, 0xA5, 0x1F, 0x9C, 0x7E,
+    0x40, 0xCE, 0xF8, 0x75, 0x82, 0x6B, 0x6F, 0x89, 0x7B, 0xE6, 0x21, 0x71, 0x1B, 0x78, 0xA4, 0x43,
+    0x75, 0x40, 0xC6, 0x48, 0x01, 0x38, 0xCD, 0x9E, 0x68, 0x25, 0x7B, 0xB2, 0x91, 0x31, 0xAA, 0xBD,
+    0x2E, 0x49, 0x03, 0x64, 0x4B, 0xF4, 0x68, 0x2B, 0xCB, 0x04, 0x39, 0x9C, 0x16, 0xA6, 0xF0, 0x3E,
+    0x31, 0xB2, 0x60, 0xE1, 0xF8, 0x3E, 0x54, 0x63, 0x85, 0x4E, 0x6A, 0x12, 0x5C, 0x92, 0xA0, 0xA4,
+    0x0D, 0x74, 0x74, 0x0F, 0x58, 0x65, 0x4D, 0xB9, 0xE0, 0x35, 0x4E, 0x87, 0x44, 0xA8, 0xDD, 0xD6,
+    0xAB, 0x92, 0xEA, 0xD9, 0xF1, 0x68, 0xFE, 0x5A, 0xB5, 0xB1, 0x71, 0xCC, 0x7D, 0x03, 0xA7, 0xAE,
+    0x07, 0xD0, 0x29, 0xED, 0x23, 0x98, 0x8B, 0xDB, 0xFC, 0x15, 0x65, 0xC5, 0x2F, 0x19, 0xD5, 0x61,
+    0xBA, 0x96, 0xAD, 0x72, 0x46, 0x09, 0x47, 0x73, 0x4D, 0xEE, 0x34, 0xB2, 0x0F, 0x73, 0x81, 0xF6,
+    0x45, 0xAE, 0x3D, 0xF4, 0x52, 0x7B, 0x4B, 0xED, 0x6E, 0x4D, 0xED, 0x08, 0x48, 0x68, 0x87, 0x69,
+    0x38, 0x7F, 0x45, 0xB5, 0x13, 0x83, 0x3B, 0xE7, 0x63, 0x73, 0xC6, 0xE9, 0xBC, 0x7F, 0xDC, 0x68,
+    0xDC, 0x36, 0x38, 0xFD, 0x5C, 0xF7, 0xEC, 0xF8, 0x74, 0xF0, 0x58, 0xBB, 0xB1, 0x71, 0x42, 0xBC,
+    0x86, 0xC6, 0xC1, 0x5C, 0xB7, 0xA1, 0xB9, 0xB8, 0xFE, 0x02, 0x5C, 0x8A, 0xB4, 0x3B, 0x80, 0x00,
+    0x89, 0xE4, 0x2C, 0x54, 0x5C, 0xDE, 0xA8, 0xA0, 0x02, 0x91, 0x80, 0xA9, 0x6D, 0x6C, 0x4C, 0xA3,
+    0xA3, 0xA8, 0xA1, 0xD2, 0xFB, 0x14, 0x28, 0x82, 0xE3, 0x54, 0xE9, 0x94, 0x03, 0x55, 0x3A, 0xAA,
+    0xF2, 0xA9, 0xCA, 0xD1, 0x48, 0x65, 0xFA, 0xFA, 0x6D, 0x80, 0x8B, 0x9C, 0x2E, 0x92, 0x7E, 0xC9,
+    0xE9, 0x96, 0xBD, 0xEE, 0x84, 0xD7, 0x76, 0x61, 0x9B, 0x9C, 0x7B, 0xAB, 0x59, 0x6C, 0x83, 0xD1,
+    0x2F, 0xFF, 0x82, 0x53, 0xC3, 0xC7, 0xAE, 0x42, 0xC6, 0x01, 0xDD, 0xB7, 0xBE, 0xF8, 0xD4, 0x75,
+    0xCC, 0x2A, 0x21, 0x82, 0xD7, 0x0B, 0x4F, 0xBF, 0x43, 0xF3, 0xE0, 0x9F, 0x48, 0x95, 0xAE, 0x88,
+    0xC3, 0x1C, 0xFB, 0x25, 0x4B, 0x06, 0x31, 0x28, 0xD5, 0x4F, 0x4C, 0x7A, 0xFE, 0x62, 0x18, 0x63,
+    0x2D, 0x5C, 0x56, 0x9E, 0x46, 0x4F, 0x61, 0x0A, 0x31, 0x56, 0x32, 0x96, 0x9C, 0xF2, 0x20, 0x0C,
+    0x8B, 0x73, 0x14, 0xC4, 0xB2, 0x28, 0xB3, 0x32, 0xF9, 0xC0, 0xA4, 0xA1, 0x19, 0x44, 0x7E, 0xA1,
+    0xA9, 0xB0, 0x46, 0xA1, 0x43, 0xDA, 0x52, 0x32, 0xA9, 0xA7, 0xBA, 0xAE, 0x78, 0xAD, 0xCE, 0xD5,
+    0x84, 0xCD, 0x3C, 0x69, 0xB4, 0xA8, 0x0A, 0x8B, 0xB1, 0xB8, 0x1F, 0x11, 0x8E, 0xBC, 0xD7, 0x29,
+    0x83, 0x17, 0x58, 0xCB, 0x22, 0x66, 0xB3, 0x2C, 0xAB, 0x5C, 0x47, 0xE1, 0x84, 0x75, 0x94, 0x70,
+    0x1F, 0x80, 0xCC, 0xDB, 0x7C, 0x05, 0x32, 0x44, 0xA6, 0x31, 0x31, 0x91, 0xC4, 0x9C, 0xA1, 0xE1,
+    0xFA, 0xB1, 0x38, 0xB1, 0xB2, 0xA6, 0xE0, 0x22, 0x48, 0xE7, 0x78, 0x44, 0x7D, 0xBC, 0x0E, 0x10,
+    0x4E, 0x14, 0xEF, 0x64, 0xEF, 0xEA, 0x3C, 0x73, 0x0B, 0x1A, 0xEA, 0x0C, 0x9A, 0xB3, 0x7A, 0xC0,
+    0x91, 0xDD, 0x62, 0xA7, 0xF3, 0x53, 0xB5, 0x41, 0x6D, 0x8B, 0xD5, 0xAD, 0x97, 0xC9, 0xBA, 0x10,
+    0x87, 0x70, 0x2B, 0xE0, 0x28, 0xDD, 0x25, 0x76, 0xEE, 0xB1, 0x2B, 0x9E, 0xBF, 0xCA, 0xD5, 0xDF,
+    0x84, 0x11, 0xDE, 0x47, 0x44, 0x7D, 0x2F, 0x37, 0x6A, 0xE1, 0x9E, 0x5D, 0xB3, 0xEE, 0xBA, 0xBC,
+    0x1D, 0xF1, 0xC2, 0xED, 0x49, 0xFA, 0x20, 0x59, 0x9D, 0x9A, 0x20, 0x97, 0xED, 0xAF, 0xBB, 0x6B,
+    0xE7, 0x3E, 0x35, 0x27, 0x51, 0x93, 0x8F, 0x2F, 0x51, 0xBE, 0x7A, 0x3F, 0xE5, 0xF9, 0x47, 0xE6,
+    0xC7, 0xEF, 0x96, 0x6D, 0xA4, 0xC3, 0xC3, 0x96, 0x4F, 0xF7, 0x9F, 0x1D, 0xCB, 0x85, 0xF8, 0xA7,
+    0x5B, 0xF6, 0x00, 0x28, 0x96, 0x8D, 0x7E, 0x2E, 0x03, 0x3E, 0x1E, 0xC4, 0xE7, 0x05, 0x6B, 0xA8,
+    0xD3, 0xD8, 0x6C, 0xF3, 0xCA, 0x44, 0xF9, 0x00, 0xC8, 0xA2, 0x52, 0x91, 0x45, 0x70, 0x56, 0x7E,
+    0xAE, 0x5B, 0x3A, 0x2B, 0xB7, 0xD6, 0xF4, 0x13, 0x0C, 0x5D, 0x63, 0x27, 0x78, 0xF7, 0x67, 0x1A,
+    0xF7, 0x6A, 0x21, 0xE2, 0x7D, 0x99, 0x45, 0x1A, 0xC0, 0x08, 0xC2, 0x34, 0x00, 0x3D, 0x01, 0x53,
+    0xE0, 0xA5, 0x11, 0x6D, 0x3C, 0x67, 0x69, 0x3A, 0x9A, 0x03, 0x7B, 0xA5, 0xCD, 0x19, 0x00, 0xAD,
+    0x39, 0xD7, 0x4B, 0xD8, 0xE2, 0xB4, 0xA4, 0xC4, 0x35, 0x26, 0x75, 0x7B, 0x0C, 0xE1, 0x2A, 0x4B,
+    0x90, 0x50, 0xDD, 0x44, 0xEF, 0x91, 0x10, 0x58, 0x9F, 0x5A, 0x51, 0x6F, 0x17, 0x3C, 0x16, 0xB7,
+    0x64, 0xF1, 0x00, 0x6D, 0xB4, 0x04, 0x67, 0x8E, 0xC1, 0x35, 0x9C, 0x3F, 0x55, 0x88, 0xF7, 0x0E,
+    0x4D, 0xD6, 0x45, 0xE8, 0x65, 0x0A, 0xA8, 0xFC, 0x4B, 0x3D, 0x56, 0x9C, 0xE1, 0xBF, 0x0B, 0x96,
+    0x2C, 0x54, 0xF3, 0xE8, 0xD2, 0x0B, 0xB4, 0xDC, 0xE2, 0x75, 0x70, 0x16, 0x7A, 0x99, 0x4E, 0xC0,
+    0x4A, 0x58, 0x8A, 0xF2, 0xC5, 0x29, 0x42, 0xF6, 0xF2, 0x00, 0x1C, 0xD2, 0xCB, 0x3D, 0xA2, 0x98,
+    0x0C, 0xA9, 0x03, 0xA8, 0xF9, 0x64, 0x73, 0xA9, 0x32, 0xAE, 0x74, 0xC6, 0x48, 0x54, 0x55, 0xA6,
+    0x00, 0x5C, 0xA8, 0x04, 0x2F, 0x58, 0xD5, 0xB6, 0x41, 0x29, 0x90, 0x43, 0x78, 0x27, 0xE4, 0xE1,
+    0x52, 0x64, 0x6B, 0x61, 0x8C, 0xE5, 0x0D, 0x16, 0x74, 0xD4, 0x3D, 0xEC, 0xDE, 0x38, 0x52, 0x3E,
+    0x9D, 0xCF, 0x56, 0x0C, 0xBF, 0xDB, 0x76, 0x5A, 0x87, 0x92, 0x40, 0xE3, 0x7B, 0xDA, 0x19, 0x5C,
+    0xD3, 0x85, 0x4C, 0xD7, 0xD5, 0x9D, 0x07, 0x77, 0x8B, 0x9D, 0x36, 0x12, 0x53, 0xBA, 0x2F, 0x79,
+    0x4E, 0xE5, 0x63, 0xBD, 0x06, 0x7E, 0xBB, 0x1D, 0x72, 0xEE, 0xAE, 0x9D, 0xF4, 0x26, 0x57, 0xDB,
+    0x6F, 0x95, 0x86, 0xD8, 0xFE, 0x77, 0xCF, 0xD4, 0xB2, 0x0E, 0xEF, 0x56, 0x14, 0x36, 0x06, 0x1B,
+    0x1B, 0xA4, 0xD7, 0xB4, 0x86, 0xB6, 0x44, 0x96, 0x2C, 0xE8, 0x9B, 0x36, 0xD0, 0x02, 0xEA, 0x2F,
+    0x94, 0x31, 0xD8, 0x46, 0xD5, 0xA4, 0x8A, 0x31, 0xB1, 0xB9, 0x0E, 0x8D, 0xED, 0x94, 0x2C, 0x70,
+    0x44, 0x3B, 0x1D, 0xED, 0xCD, 0x4F, 0x6C, 0x8B, 0x30, 0xAA, 0x55, 0xBD, 0xF6, 0x34, 0x05, 0x30,
+    0x0D, 0xCB, 0x40, 0x53, 0xB7, 0x9B, 0x5E, 0x3A, 0xCF, 0xDF, 0x78, 0x9E, 0xBA, 0xD5, 0xD4, 0x07,
+    0xEA, 0x02, 0x5D, 0x89, 0x59, 0xBF, 0x4C, 0x43, 0xD4, 0x92, 0xA9, 0x29, 0x9C, 0x7C, 0x51, 0x69,
+    0x18, 0x05, 0xFF, 0x42, 0x8F, 0x97, 0x5E, 0x9C, 0x05, 0xD0, 0xCE, 0xCC, 0x9D, 0x9D, 0x42, 0x2F,
+    0xC9, 0x95, 0x41, 0xDF, 0x0F, 0x90, 0x37, 0xCA, 0xCE, 0xF9, 0x1A, 0x31, 0x75, 0x46, 0x25, 0xC7,
+    0x1C, 0x5D, 0x76, 0x37, 0x03, 0xF7, 0x63, 0x30, 0x36, 0x86, 0xC1, 0xE8, 0x51, 0xC7, 0xF1, 0xF9,
+    0xDB, 0x12, 0xE0, 0x22, 0x4A, 0x20, 0x70, 0x3D, 0x91, 0x1D, 0x35, 0xE1, 0x1C, 0xE8, 0xC2, 0xF9,
+    0xD0, 0x06, 0x38, 0x84, 0x3E, 0xB4, 0x65, 0x18, 0x8A, 0xBF, 0x39, 0xD5, 0x99, 0x34, 0x18, 0xB4,
+    0x91, 0x6A, 0x35, 0xB2, 0x74, 0x97, 0xE2, 0xBA, 0x6C, 0xA9, 0xFF, 0x45, 0xDE, 0x28, 0x3D, 0xDC,
+    0xE4, 0x02, 0x81, 0x21, 0x70, 0x4D, 0xFC, 0x74, 0x02, 0xD6, 0x5B, 0x38, 0x42, 0x36, 0x00, 0xFE,
+    0xA1, 0xC7, 0xE0, 0xA3, 0xC6, 0x9B, 0xA8, 0x8F, 0x76, 0xAA, 0xE4, 0x2E, 0x13, 0x3F, 0x90, 0xDF,
+    0x01, 0xAC, 0x27, 0xD7, 0x7E, 0xBA, 0x61, 0x16, 0x85, 0xB0, 0xB0, 0xD1, 0x72, 0x47, 0xE2, 0xBC,
+    0x88, 0x29, 0x42, 0xC3, 0xB2, 0x63, 0xD8, 0x7D, 0x2F, 0x89, 0x79, 0x5E, 0x3F, 0xB2, 0xAB, 0xEC,
+    0x15, 0x24, 0xB9, 0x81, 0x8F, 0x0B, 0x12, 0xDF, 0xCE, 0xC9, 0x73, 0x43, 0x6A, 0x67, 0xFB, 0xA5,
+    0xCC, 0xD7, 0x23, 0x29, 0x6E, 0xAC, 0xEF, 0x36, 0x45, 0x46, 0xC6, 0xC7, 0x04, 0xCC, 0xED, 0x66,
+    0x86, 0x4D, 0xAA, 0x48, 0x13, 0xCC, 0xB7, 0x65, 0xAD, 0xBB, 0x03, 0xBD, 0x31, 0xF7, 0x9C, 0x11,
+    0x66, 0x74, 0xBD, 0xB8, 0x8A, 0x49, 0xC9, 0x05, 0xA1, 0x83, 0x4A, 0xFE, 0x5B, 0x94, 0x5C, 0x52,
+    0xF4, 0xA4, 0x94, 0x15, 0x97, 0x33, 0xAB, 0xB8, 0x98, 0x45, 0x99, 0xCC, 0xA4, 0x29, 0x75, 0x13,
+    0x26, 0x4D, 0x58, 0xBE, 0xE8, 0x7C, 0xE2, 0xC1, 0x74, 0xBD, 0xB8, 0x46, 0x2D, 0x37, 0xD5, 0xF0,
+    0x6F, 0x81, 0x9E, 0xC7, 0x7C, 0x34, 0xA8, 0xDA, 0x6A, 0x4B, 0xF2, 0x58, 0x0C, 0x0F, 0x2C, 0x86,
+    0xD7, 0xF3, 0x5E, 0xD5, 0x5A, 0x9B, 0xEE, 0x32, 0x6B, 0x27, 0x6D, 0x83, 0xC6, 0x83, 0x7E, 0x11,
+    0xB1, 0x9F, 0x41, 0x47, 0xD6, 0xEA, 0x39, 0x07, 0x76, 0x95, 0xB5, 0xB6, 0x3B, 0x88, 0x6A, 0x52,
+    0xB1, 0x6C, 0x64, 0xE2, 0x6E, 0xB2, 0xFA, 0x38, 0xB5, 0xC5, 0x5D, 0x67, 0x97, 0xF9, 0xD6, 0x6E,
+    0x54, 0x68, 0x98, 0x66, 0x8F, 0xF7, 0x33, 0xB9, 0x28, 0xCD, 0x1D, 0x8C, 0x77, 0x57, 0x58, 0x7B,
+    0x44, 0x7E, 0x70, 0x52, 0x4E, 0x46, 0xA7, 0x3A, 0xFF, 0x46, 0xED, 0x10, 0x42, 0x10, 0x16, 0x39,
+    0xFE, 0xC6, 0x11, 0x1C, 0x3F, 0x22, 0xF7, 0x6F, 0x33, 0x39, 0x48, 0x79, 0xFD, 0x1F, 0xD5, 0xEC,
+    0x7E, 0x6E, 0xB6, 0xAB, 0x66, 0xFB, 0x6A, 0x76, 0xA8, 0x66, 0x2F, 0xA9, 0xD9, 0xE7, 0x69, 0xB6,
+    0x53, 0xD3, 0x6C, 0xAF, 0xA4, 0xC1, 0xA1, 0x9A, 0x7D, 0x58, 0xCD, 0x3E, 0xAE, 0x66, 0x37, 0x34,
+    0xFB, 0xFD, 0x8A, 0x66, 0x7F, 0x94, 0xD2, 0xEC, 0x71, 0x02, 0x89, 0x33, 0xB3, 0x3D, 0x35, 0xDB,
+    0xBF, 0x49, 0xB3, 0xC3, 0x6D, 0x4E, 0xD6, 0x28, 0x16, 0x0B, 0x67, 0x89, 0x02, 0x85, 0xF6, 0x16,
+    0x44, 0x94, 0x6D, 0xEB, 0x11, 0x9B, 0xC1, 0x37, 0x4D, 0x6C, 0xBA, 0xC0, 0xD4, 0x34, 0xF5, 0x84,
+    0x02, 0xCE, 0xBA, 0xA2, 0xCF, 0x05, 0xC5, 0x7D, 0x25, 0xB5, 0x58, 0x20, 0x68, 0x74, 0x14, 0x9F,
+    0x9D, 0x9A, 0xE0, 0x0C, 0x54, 0x83, 0x31, 0x20, 0xBF, 0xA8, 0xD3, 0x5E, 0x49, 0x97, 0xFA, 0x0A,
+    0xC5, 0x68, 0x5E, 0xE0, 0xE4, 0x30, 0x25, 0x3E, 0x87, 0x5A, 0x11, 0x22, 0xAD, 0x0D, 0xCB, 0xA4,
+    0xAC, 0x5C, 0xF9, 0x90, 0x5B, 0xC8, 0xE2, 0x58, 0x5E, 0x3C, 0x6D, 0x1A, 0x27, 0xBD, 0x65, 0x3B,
+    0xA7, 0x0C, 0x97, 0xD5, 0x5A, 0x3D, 0x30, 0xEF, 0x2C, 0x77, 0x89, 0xB5, 0x6B, 0x76, 0xD3, 0x54,
+    0x5B, 0x02, 0x05, 0x8A, 0xF8, 0x05, 0xDA, 0x7C, 0x89, 0x80, 0x0F, 0xD7, 0xAE, 0xEE, 0x2E, 0x6B,
+    0xA7, 0x3B, 0xDF, 0x90, 0x63, 0x40, 0x39, 0xA8, 0x9C, 0x6F, 0x81, 0xEF, 0x2A, 0x6B, 0x17, 0xD4,
+    0x7B, 0x99, 0xDA, 0xA6, 0xCD, 0x96, 0xA7, 0x65, 0x22, 0xA8, 0x66, 0xBB, 0xE5, 0x93, 0xDD, 0x5C,
+    0x98, 0x5A, 0x66, 0xE6, 0x2C, 0x90, 0x22, 0x18, 0x75, 0xCF, 0x7A, 0xE4, 0x16, 0x18, 0xAC, 0x85,
+    0x76, 0x58, 0x1E, 0x72, 0x3B, 0x29, 0x5D, 0x54, 0xA6, 0xB5, 0xAE, 0xCC, 0x8B, 0x93, 0xCE, 0xAE,
+    0x72, 0x9C, 0xE4, 0x3D, 0x92, 0xAF, 0xE4, 0xA6, 0x62, 0xA7, 0xEE, 0x67, 0x58, 0x2A, 0x3B, 0x21,
+    0xB1, 0x5B, 0xBA, 0x6D, 0x4B, 0x62, 0xF5, 0x6E, 0xD1, 0xBD, 0x66, 0xD3, 0x32, 0xDC, 0x2F, 0x61,
+    0x83, 0xBE, 0xB2, 0x41, 0x32, 0x9A, 0x60, 0x34, 0x74, 0x0A, 0x39, 0x4C, 0x4B, 0x2E, 0x43, 0x14,
+    0x40, 0x86, 0x23, 0x85, 0x55, 0xD4, 0xEC, 0xFC, 0x2A, 0x7C, 0x01, 0x0C, 0xE8, 0x60, 0x13, 0x46,
+    0x56, 0x8A, 0x6D, 0xCC, 0x4B, 0x5F, 0xC1, 0x06, 0xA7, 0xA9, 0x1C, 0xEB, 0xBF, 0x8E, 0x79, 0x82,
+    0xAA, 0xBC, 0x5E, 0x7D, 0x13, 0x74, 0xFA, 0x01, 0xEF, 0x1B, 0xDB, 0x1E, 0x91, 0x32, 0x14, 0x4D,
+    0x64, 0xD8, 0xB2, 0xD6, 0xE6, 0x43, 0x9C, 0x9F, 0xBD, 0xAD, 0xF3, 0xCB, 0xAE, 0x6A, 0xF5, 0xCD,
+    0xFE, 0xAE, 0x1F, 0xC5, 0xF3, 0x7A, 0xD0, 0x3C, 0x6F, 0x49, 0xE8, 0xA3, 0x1C, 0x9A, 0x5B, 0xCF,
+    0xBD, 0xEA, 0x0F, 0x94, 0x98, 0xA9, 0x25, 0xDE, 0xB0, 0xC8, 0x2E, 0xDC, 0xEB, 0x33, 0x67, 0x24,
+    0xFB, 0xCB, 0xDC, 0x81, 0x85, 0x3C, 0x61, 0x73, 0x1F, 0x22, 0x50, 0x2A, 0x55, 0x7E, 0x60, 0xD6,
+    0x9B, 0x11, 0x99, 0xE6, 0x88, 0x63, 0x37, 0xB3, 0xE4, 0xC7, 0x83, 0xCC, 0x5D, 0x39, 0xE9, 0x94,
+    0xF4, 0x3C, 0x0D, 0x43, 0x57, 0x3D, 0x7F, 0x62, 0x1B, 0xEB, 0xDA, 0x37, 0xFE, 0x44, 0x7B, 0x8F,
+    0x14, 0xAC, 0x09, 0xBC, 0xAB, 0xE7, 0x72, 0xD2, 0x91, 0x51, 0xC3, 0x9B, 0x55, 0x95, 0x47, 0xF7,
+    0x11, 0x00, 0xCB, 0x80, 0x28, 0x08, 0x47, 0x9A, 0x1C, 0x4B, 0x87, 0x86, 0x1B, 0x4C, 0x30, 0x3F,
+    0x07, 0xB2, 0xF6, 0xD6, 0x1B, 0x6D, 0x9A, 0x98, 0xA3, 0xA6, 0x0C, 0x07, 0x7F, 0x24, 0xC5, 0x58,
+    0x9D, 0x71, 0xFC, 0x61, 0x1B, 0xC7, 0xBF, 0xB4, 0x0D, 0x0C, 0x77, 0x46, 0xEF, 0xC2, 0xA4, 0xEB,
+    0x51, 0x02, 0x29, 0xE1, 0xDB, 0xE4, 0xCA, 0xE4, 0x3E, 0xF3, 0xAE, 0x70, 0x67, 0xF4, 0xD2, 0xCF,
+    0x7E, 0x17, 0x30, 0xCF, 0xCE, 0x89, 0xAC, 0x14, 0x98, 0xF9, 0x91, 0xA0, 0xDD, 0x4A, 0xB9, 0x76,
+    0xC8, 0xCF, 0xD3, 0x1A, 0xAF, 0xC5, 0x5D, 0xC5, 0x61, 0xA7, 0xDE, 0x0A, 0x35, 0x3B, 0xA3, 0xF7,
+    0x9E, 0x29, 0x6F, 0xF3, 0xDE, 0xE4, 0xA6, 0x1F, 0xF9, 0xBD, 0xC7, 0xA4, 0x77, 0xB4, 0xA8, 0xFF,
+    0x6A, 0x47, 0x95, 0xEF, 0x1B, 0xE5, 0x98, 0x22, 0xC2, 0x0D, 0xE0, 0x03, 0x07, 0xAE, 0x4C, 0xEA,
+    0xF1, 0x7A, 0x8C, 0xD0, 0x22, 0x85, 0x4C, 0x1A, 0x31, 0xFF, 0x8D, 0x2A, 0x80, 0x1E, 0xA8, 0x18,
+    0x8E, 0xB5, 0x54, 0xC2, 0xEC, 0xC7, 0x49, 0x83, 0xF6, 0xC4, 0x51, 0xA7, 0x78, 0xC5, 0x44, 0xC4,
+    0xC1, 0xD7, 0x7A, 0x79, 0x10, 0xEA, 0xAE, 0x1A, 0x39, 0x0F, 0xBC, 0x7B, 0xD4, 0x80, 0xD9, 0x85,
+    0x83, 0xA5, 0x46, 0xA9, 0x8D, 0xDA, 0x7D, 0xDA, 0xA3, 0x37, 0xCE, 0x10, 0xB6, 0x3E, 0x7E, 0xC2,
+    0xC6, 0x6B, 0xE2, 0xDA, 0x4D, 0x99, 0x7E, 0xB3, 0x36, 0x2C, 0xB7, 0x6F, 0xB0, 0x05, 0x1C, 0xC3,
+    0x77, 0x4D, 0x98, 0x46, 0x66, 0xD4, 0x9B, 0xAE, 0xF2, 0xEB, 0x49, 0xA1, 0xCD, 0xF0, 0x25, 0xF7,
+    0x21, 0xA3, 0x5C, 0x08, 0x1E, 0x6A, 0xC6, 0xB4, 0x07, 0x67, 0xC8, 0xB8, 0x77, 0xF4, 0xE0, 0xD4,
+    0x9B, 0x4C, 0xF5, 0x86, 0xD0, 0x1B, 0xB6, 0x71, 0x1D, 0x36, 0x49, 0x99, 0x54, 0xD9, 0xDF, 0x4C,
+    0x4A, 0xE8, 0x32, 0xEF, 0xFE, 0x0F, 0xBD, 0x7B, 0xE5, 0x4B, 0xF2, 0x31, 0xFF, 0x62, 0x3E, 0xDA,
+    0xDD, 0x84, 0x46, 0xA8, 0x48, 0xA8, 0x49, 0xA8, 0x4A, 0xA8, 0x4B, 0xA8, 0x4C, 0xA8, 0xCD, 0x22,
+    0x25, 0xF5, 0xD9, 0xA6, 0x9A, 0x1A, 0x55, 0xA5, 0x50, 0xA7, 0x50, 0xA9, 0xD5, 0x3A, 0x57, 0x6B,
+    0xEF, 0xA9, 0x55, 0x4A, 0xED, 0x49, 0xEC, 0xA7, 0xB4, 0xFE, 0xBB, 0x99, 0x17, 0xBE, 0x00, 0x71,
+    0x29, 0x50, 0xB8, 0x0A, 0xAF, 0x95, 0x65, 0x77, 0x1E, 0xFB, 0xDF, 0xC1, 0xF8, 0x0B, 0xB6, 0x9E,
+    0x36, 0xBA, 0x61, 0x77, 0x71, 0xB2, 0x22, 0x87, 0xFE, 0x24, 0xC9, 0xC8, 0x2A, 0x84, 0xC0, 0xC5,
+    0x2F, 0x22, 0xD7, 0xB6, 0xCF, 0x7C, 0xDE, 0x61, 0xFA, 0xC8, 0x03, 0xAE, 0x4A, 0xAE, 0x21, 0x70,
+    0x73, 0xEE, 0xE0, 0xF3, 0x3E, 0xFD, 0x1A, 0x9D, 0x4F, 0x47, 0xE6, 0x74, 0xFB, 0xEA, 0x37, 0x1D,
+    0x07, 0x06, 0x15, 0x95, 0x6B, 0x9A, 0xE0, 0x5A, 0x1B, 0xA7, 0xEB, 0x16, 0xD4, 0xF6, 0x6F, 0xA4,
+    0xA1, 0xC9, 0x1D, 0xE6, 0x18, 0x0B, 0x0B, 0xF3, 0x6C, 0xD4, 0x3D, 0x52, 0x1D, 0x33, 0x98, 0x75,
+    0xF7, 0xDD, 0x6A, 0x68, 0x6A, 0xF6, 0xD4, 0x07, 0x26, 0x5E, 0x83, 0xD3, 0xE0, 0xB3, 0x99, 0xCB,
+    0xBE, 0x89, 0x3D, 0x76, 0x83, 0xEB, 0x21, 0x89, 0x3E, 0xE3, 0x86, 0xF1, 0x19, 0xAC, 0x73, 0x2E,
+    0xF1, 0x8B, 0x95, 0xFC, 0x88, 0x3D, 0x32, 0xD6, 0xE4, 0xBE, 0xDB, 0x28, 0x9E, 0x66, 0xF0, 0x86,
+    0x60, 0x64, 0xDE, 0xC7, 0xD0, 0x9F, 0xC0, 0x7E, 0xF8, 0x7A, 0x2C, 0x40, 0xD2, 0x4D, 0xEE, 0x0D,
+    0x60, 0xF9, 0x7D, 0x91, 0x07, 0x5D, 0x56, 0x46, 0x0D, 0x56, 0xA6, 0x8C, 0x0C, 0x19, 0x7C, 0x3B,
+    0xE9, 0xAC, 0xBF, 0x16, 0x57, 0x0F, 0xBD, 0xEC, 0x77, 0x92, 0xF0, 0x5E, 0xAD, 0x3F, 0xDC, 0xE6,
+    0x95, 0xA7, 0x4C, 0xEA, 0x1B, 0xF8, 0x21, 0x18, 0x20, 0xC2, 0xED, 0x88, 0x13, 0x37, 0x98, 0x58,
+    0xC2, 0x0D, 0x60, 0xE5, 0x05, 0x09, 0x79, 0x01, 0x1B, 0x84, 0x03, 0xC4, 0x86, 0x86, 0x9B, 0x19,
+    0x0C, 0xE7, 0x03, 0x36, 0x1F, 0x59, 0x36, 0x59, 0x35, 0xB5, 0x68, 0x6E, 0xCD, 0xC7, 0x51, 0x71,
+    0xC0, 0x1D, 0x83, 0x3E, 0xE8, 0xBC, 0x21, 0xC4, 0x5F, 0x09, 0x48, 0x9C, 0x9D, 0x97, 0x37, 0x99,
+    0x97, 0x8F, 0x79, 0x05, 0x3D, 0x01, 0xA9, 0x28, 0xE3, 0xC9, 0xBC, 0xB0, 0x2A, 0xB3, 0x79, 0x51,
+    0x81, 0xF9, 0xF2, 0x7D, 0xA7, 0xEF, 0x64, 0xFC, 0xFF, 0xA7, 0x1E, 0xF1, 0x81, 0x13, 0xE8, 0xA7,
+    0x22, 0xA1, 0x26, 0xA1, 0x2A, 0xA1, 0x2E, 0xA1, 0x32, 0xA1, 0x36, 0xA1, 0x3A, 0xA1, 0x3E, 0xA1,
+    0x42, 0xA2, 0x27, 0x91, 0x14, 0x01, 0x41, 0x9D, 0x36, 0xDF, 0x55, 0xEB, 0x7C, 0x23, 0x64, 0xB6,
+    0xBF, 0x75, 0x8A, 0xDB, 0x97, 0xE7, 0xB7, 0x14, 0xA2, 0x6F, 0x3F, 0xAF, 0xFD, 0x93, 0x3B, 0xED,
+    0x7C, 0x07, 0xF3, 0x1A, 0x37, 0x7F, 0x0C, 0x63, 0x63, 0x7E, 0x3B, 0x67, 0x76, 0x6E, 0x69, 0xFB,
+    0xC5, 0xE9, 0xDD, 0xF9, 0x52, 0x9C, 0xE2, 0x45, 0x1C, 0xE6, 0x1E, 0x7E, 0xF1, 0x1C, 0x12, 0x66,
+    0x74, 0x59, 0x3F, 0x10, 0xBA, 0x61, 0x17, 0xA2, 0xD0, 0xB4, 0xCB, 0x7C, 0x60, 0xE0, 0x82, 0xC9,
+    0xE3, 0x8F, 0x6B, 0x94, 0x87, 0x1B, 0x57, 0x78, 0xFF, 0x03, 0xEE, 0x88, 0x07, 0x46, 0x50, 0xC7,
+    0xBC, 0xE0, 0x63, 0x46, 0x01, 0x37, 0xBA, 0xF4, 0x0E, 0xE8, 0xF2, 0xDE, 0xD9, 0xF4, 0xF5, 0xEE,
+    0xA2, 0xEE, 0xF1, 0xFB, 0x7A, 0x17, 0x4F, 0x19, 0xE0, 0xCA, 0x56, 0x36, 0x7D, 0x68, 0x43, 0x0E,
+    0xE5, 0xC8, 0x33, 0x16, 0x25, 0x78, 0x13, 0xA1, 0x68, 0xD8, 0x6E, 0x22, 0x5E, 0x7B, 0xC6, 0x6B,
+    0x77, 0x47, 0xBC, 0x06, 0x6C, 0x40, 0x43, 0x06, 0x6D, 0x4C, 0xF1, 0x1B, 0xC4, 0xFA, 0x67, 0xAF,
+    0xF7, 0x07, 0x12, 0xF3, 0xA4, 0x69, 0xB8, 0x47, 0x97, 0xCB, 0x24, 0x9F, 0xD7, 0xA6, 0x4F, 0x03,
+    0x79, 0xFD, 0xF4, 0xB1, 0x26, 0x7D, 0x4C, 0xEB, 0xE0, 0xCE, 0xEA, 0xDD, 0x9B, 0x4E, 0xE9, 0xBB,
+    0xF2, 0xF3, 0x96, 0xCD, 0x78, 0xBE, 0xC2, 0xE9, 0xEE, 0xD9, 0xD9, 0xF9, 0xEA, 0x3D, 0xDB, 0x84,
+    0xCE, 0xCE, 0x52, 0x4C, 0x37, 0xC3, 0xBF, 0xF9, 0xE1, 0x2D, 0xB4, 0x67, 0xC7, 0xF4, 0x6A, 0x87,
+    0xA0, 0x8D, 0x88, 0xD8, 0x84, 0xB2, 0x37, 0xBA, 0x4F, 0xDE, 0x71, 0x8F, 0xE4, 0xDE, 0x97, 0xE9,
+    0xFF, 0x84, 0xEC, 0x83, 0x0F, 0xD9, 0x64, 0xB6, 0x4F, 0x2A, 0x89, 0xD0, 0x2C, 0xFE, 0x26, 0x0D,
+    0x95, 0x2B, 0x84, 0xDA, 0x2D, 0x2D, 0x6A, 0x11, 0x5D, 0xD2, 0x7E, 0xFC, 0x82, 0xD2, 0x77, 0xDD,
+    0xD3, 0x7E, 0x9F, 0x5C, 0x2A, 0xFC, 0x9C, 0x21, 0x1D, 0x6A, 0x27, 0x14, 0xD8, 0x7B, 0xD5, 0xCA,
+    0xE2, 0xB5, 0xC7, 0xD4, 0x27, 0x26, 0x26, 0x2B, 0x2D, 0xC3, 0xCC, 0xA6, 0x42, 0x1B, 0xE5, 0x62,
+    0x76, 0xE3, 0x13, 0x5A, 0xBB, 0xE9, 0x2D, 0x43, 0xED, 0xBB, 0xA2, 0x3B, 0xF6, 0xCC, 0xDF, 0xC4,
+    0x7C, 0xB2, 0x37, 0x70, 0x55, 0xF6, 0xE7, 0xA2, 0x92, 0xE2, 0x55, 0x7C, 0x65, 0x2A, 0xF6, 0x38,
+    0x79, 0xD4, 0x38, 0xE4, 0x53, 0x8C, 0x7F, 0xDB, 0x54, 0x79, 0x7A, 0x3B, 0x6D, 0x42, 0xDC, 0x4C,
+    0x0A, 0x77, 0x8E, 0x70, 0x27, 0xFE, 0x06, 0xD2, 0xF0, 0x99, 0x16, 0x3E, 0xA1, 0xD7, 0xAC, 0x4E,
+    0xBA, 0x0E, 0xDD, 0x5E, 0xD0, 0x06, 0xC5, 0xEE, 0xC8, 0xF3, 0xD1, 0x27, 0xFB, 0x1C, 0xD2, 0x16,
+    0xB0, 0x10, 0x85, 0x8B, 0xA9, 0xDC, 0xBA, 0x25, 0xBE, 0xBB, 0x3C, 0xF9, 0x5F, 0xCD, 0x5B, 0x3D,
+    0x90, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0x76, 0x89, 0x19, 0x23, 0x23, 0xB0, 0x58, 0x8E, 0x23, 0x2A,
+    0x26, 0x9A, 0x34, 0xA1, 0x22, 0xA2, 0xD5, 0x4C, 0x96, 0x04, 0x62, 0x4D, 0xE2, 0xCC, 0xA4, 0xD0,
+    0x16, 0xDC, 0x49, 0xE1, 0x82, 0x6D, 0x9C, 0xCC, 0x44, 0x4D, 0x0A, 0x8F, 0xBD, 0x12, 0x90, 0x71,
+    0xA1, 0xC2, 0x85, 0xD9, 0xC4, 0x6D, 0x54, 0xB0, 0xA0, 0xD6, 0x33, 0x61, 0x0A, 0x15, 0x2C, 0x28,
+    0x01, 0x8A, 0x32, 0x51, 0xE1, 0xC2, 0x4F, 0xF4, 0xC8, 0x2E, 0x03, 0x25, 0x54, 0x92, 0x89, 0x32,
+    0x63, 0x24, 0x03, 0x47, 0x4F, 0x24, 0x1E, 0x6E, 0xCE, 0xF7, 0x1D, 0xFC, 0x2D, 0xB9, 0x22, 0xD7,
+    0xE2, 0x2E, 0xF7, 0x2D, 0x77, 0xEF, 0x7B, 0x7C, 0x0F, 0xB8, 0xF7, 0x9C, 0xEF, 0x9E, 0x7B, 0xFE,
+    0x61, 0x8C, 0xB1, 0x36, 0x37, 0x18, 0x53, 0x19, 0x77, 0x77, 0xCD, 0xF8, 0x13, 0xD6, 0x18, 0x13,
+    0x8E, 0x59, 0x83, 0xD1, 0x62, 0x74, 0x3F, 0x5B, 0xCA, 0xE8, 0xFD, 0x14, 0x63, 0xF0, 0x66, 0x2B,
+    0x63, 0xE4, 0x63, 0xBC, 0xCC, 0x71, 0xCF, 0x5B, 0xC9, 0xD8, 0x60, 0x74, 0x2B, 0xAF, 0x93, 0x0B,
+    0xEF, 0xFF, 0x44, 0xC6, 0xD0, 0x5A, 0x2B, 0x17, 0x1A, 0x57, 0xC6, 0x2B, 0xC6, 0x91, 0xF1, 0x8E,
+    0x8C, 0xA9, 0x91, 0x09, 0x6D, 0xEA, 0x35, 0xF2, 0xBE, 0x8C, 0x3B, 0xF3, 0xA2, 0xBD, 0x97, 0xD9,
+    0x34, 0xB1, 0x4B, 0xB9, 0x5E, 0xBE, 0x89, 0xAC, 0xAC, 0xBD, 0xB9, 0xBB, 0xD3, 0xD3, 0x73, 0xA6,
+    0xFB, 0xE3, 0xD4, 0x64, 0x42, 0xA7, 0x63, 0x65, 0x1A, 0xAF, 0x95, 0x21, 0x6C, 0x64, 0x89, 0xA8,
+    0x96, 0xD5, 0x92, 0x85, 0xD7, 0x9A, 0xAC, 0x14, 0x1A, 0x8A, 0x32, 0x90, 0x21, 0x0F, 0x97, 0xC6,
+    0xE6, 0x51, 0x23, 0x83, 0x70, 0x50, 0xE4, 0xB7, 0x6A, 0x93, 0xDD, 0xFD, 0x59, 0x23, 0x93, 0xBF,
+    0x6A, 0xCB, 0x70, 0xE5, 0x0B, 0x4D, 0xA9, 0xE1, 0xCC, 0x67, 0x0D, 0x18, 0xAF, 0xBD, 0x52, 0xC6,
+    0x77, 0xAF, 0x01, 0x8A, 0xC4, 0xE2, 0xF3, 0x08, 0x0C, 0x1A, 0x27, 0x5D, 0x0F, 0x40, 0x36, 0xE4,
+    0x9F, 0x09, 0xCD, 0x9E, 0x0C, 0xBF, 0x90, 0x6B, 0x7C, 0x5B, 0xC9, 0x7C, 0xDC, 0xB2, 0x2D, 0x73,
+    0xB2, 0xF8, 0x9C, 0x26, 0xD7, 0xF2, 0x73, 0x1B, 0x83, 0xBF, 0xE0, 0x8E, 0x60, 0x73, 0x4C, 0xCC,
+    0x1D, 0x89, 0x4B, 0x7E, 0xC2, 0x9D, 0xF2, 0x57, 0x27, 0xC0, 0x3C, 0x97, 0x8C, 0x31, 0xFD, 0xEB,
+    0x18, 0xC0, 0x8E, 0xE9, 0x88, 0x01, 0xC8, 0x8A, 0x08, 0x84, 0xE1, 0x69, 0xF1, 0xF8, 0x71, 0xD0,
+    0x4C, 0x64, 0xBD, 0xC1, 0x2F, 0x77, 0x26, 0xC9, 0x89, 0x75, 0xBB, 0x6E, 0x09, 0x34, 0x61, 0x03,
+    0x72, 0x93, 0x12, 0xD0, 0xD8, 0xD4, 0x6D, 0x71, 0xBB, 0x5B, 0x19, 0xA2, 0x66, 0x42, 0x8E, 0x3A,
+    0x79, 0x3C, 0xC3, 0xBD, 0x1F, 0xAB, 0x47, 0x46, 0x7E, 0x1E, 0x0B, 0x70, 0xBC, 0xD7, 0x4F, 0x4D,
+    0x60, 0xAF, 0xBF, 0x26, 0x52, 0x6B, 0xED, 0x6A, 0x58, 0x76, 0x94, 0x10, 0x10, 0x0B, 0xE0, 0x8D,
+    0x4F, 0x0E, 0xC0, 0xDF, 0x15, 0x3D, 0x00, 0x83, 0x00, 0x41, 0x9E, 0x32, 0x39, 0x74, 0xCE, 0x2A,
+    0x6C, 0x8C, 0xDF, 0xF8, 0x8D, 0x6C, 0xBE, 0x57, 0x9B, 0xB8, 0x72, 0x53, 0xA1, 0x18, 0xBC, 0x63,
+    0x28, 0x30, 0xA8, 0xCE, 0xC0, 0x50, 0xE4, 0xFC, 0x02, 0x97, 0xD4, 0x61, 0x2A, 0x5B, 0xD2, 0x61,
+    0x19, 0xB0, 0xB0, 0x39, 0xAD, 0xEB, 0xE0, 0x52, 0xDF, 0xCA, 0x9D, 0xD1, 0x07, 0x35, 0x00, 0x6A,
+    0x80, 0xCF, 0xD9, 0x19, 0x3C, 0x44, 0x87, 0xE0, 0x10, 0x1B, 0x40, 0x43, 0x64, 0x08, 0x0C, 0x71,
+    0x21, 0x2C, 0x44, 0x25, 0x99, 0x86, 0xEA, 0xE0, 0x50, 0x0F, 0x70, 0x10, 0x0D, 0x82, 0xA1, 0x58,
+    0x28, 0x14, 0x44, 0xE2, 0x9C, 0x70, 0x69, 0x17, 0xB2, 0x60, 0x6D, 0x82, 0x7F, 0x6D, 0x44, 0x9E,
+    0xEE, 0xC8, 0xE7, 0x5B, 0x23, 0x02, 0x02, 0x00, 0xF8, 0x07, 0xFB, 0xE0, 0x1E, 0xCC, 0x83, 0x77,
+    0xB0, 0x0E, 0xCE, 0xC1, 0x08, 0xFE, 0xC0, 0x36, 0xB8, 0x06, 0xD3, 0xE0, 0x99, 0x2C, 0x2B, 0xC7,
+    0xE7, 0x78, 0x48, 0xD2, 0x9E, 0x6B, 0xBE, 0x33, 0xDF, 0x31, 0xF3, 0x9F, 0x67, 0xCC, 0x70, 0xBF,
+    0x4B, 0xB6, 0x27, 0xFF, 0xF7, 0x26, 0x42, 0x8E, 0x85, 0xE1, 0x0D, 0xBC, 0x44, 0xE9, 0xBB, 0x72,
+    0x08, 0x7E, 0x2E, 0x9F, 0x79, 0x02, 0x6E, 0xAF, 0x9B, 0x76, 0x4F, 0x85, 0x61, 0xEC, 0x66, 0x2C,
+    0x9A, 0x25, 0xFC, 0xB0, 0xA6, 0xCC, 0x79, 0x10, 0xFA, 0xAB, 0xC7, 0xC8, 0xF0, 0x26, 0x5F, 0xC2,
+    0x14, 0xE7, 0xDC, 0xBF, 0x4B, 0x3D, 0xC8, 0xC5, 0x75, 0xBF, 0x27, 0xAE, 0xA1, 0x90, 0xAE, 0x73,
+    0x84, 0x06, 0xEC, 0x5C, 0xA1, 0x45, 0xB8, 0xCF, 0x78, 0xDA, 0x85, 0x4D, 0x51, 0x45, 0x62, 0x64,
+    0x42, 0xFD, 0x6D, 0xC0, 0x50, 0xC4, 0x51, 0xBE, 0x92, 0x51, 0x38, 0x95, 0xCF, 0x85, 0x69, 0xB9,
+    0x26, 0x59, 0xE0, 0x43, 0x21, 0x10, 0xEA, 0xAA, 0x34, 0xD9, 0x02, 0x7B, 0x89, 0xDF, 0x1C, 0x07,
+    0xDA, 0xA6, 0xC1, 0x0A, 0x27, 0x5B, 0xB4, 0x73, 0x6C, 0x61, 0xCD, 0x0B, 0x6B, 0xEF, 0xCD, 0xA4,
+    0xCD, 0xB3, 0x35, 0x54, 0x94, 0x53, 0x54, 0x54, 0x2F, 0xC9, 0x5D, 0xD5, 0xE5, 0x1F, 0x50, 0xA9,
+    0x66, 0xFF, 0x48, 0x7D, 0xCA, 0x53, 0x7C, 0x66, 0x45, 0x06, 0x32, 0xAB, 0xC2, 0xAB, 0xCA, 0xA2,
+    0xE5, 0x0B, 0x95, 0x29, 0x36, 0x87, 0x8A, 0x9D, 0x0A, 0xD5, 0xA8, 0x4A, 0x35, 0xAA, 0x54, 0x8D,
+    0xAA, 0x55, 0xA3, 0x8A, 0xD5, 0xA8, 0x6A, 0x35, 0xAA, 0x5C, 0x8D, 0xAA, 0x57, 0x58, 0xD6, 0x57,
+    0x21, 0x84, 0xAA, 0x62, 0x47, 0x0B, 0xF3, 0x95, 0x50, 0xF2, 0xAC, 0xAD, 0xFA, 0xF1, 0x38, 0x50,
+    0xF2, 0xE0, 0x6B, 0x08, 0x42, 0x64, 0x4E, 0xB6, 0xB0, 0xF8, 0x18, 0x2E, 0xD1, 0x6A, 0xD4, 0x74,
+    0xA9, 0x79, 0xA1, 0x93, 0x41, 0xEE, 0x11, 0x12, 0x45, 0xA0, 0x82, 0xE5, 0x68, 0x5C, 0x2A, 0xC1,
+    0x22, 0xF9, 0x0A, 0x96, 0x35, 0xC4, 0x92, 0xEA, 0xE4, 0xCC, 0xBC, 0x1C, 0xE0, 0x40, 0x19, 0xC5,
+    0x28, 0x6B, 0x24, 0xB4, 0x6F, 0x11, 0x36, 0xC2, 0x5C, 0x30, 0x40, 0xE3, 0x79, 0x63, 0x08, 0x34,
+    0xD0, 0x98, 0xAC, 0x05, 0xF7, 0x2C, 0xD1, 0x51, 0x6D, 0x83, 0x6E, 0x2F, 0x0D, 0x12, 0x55, 0x36,
+    0xA0, 0xD8, 0x21, 0x3F, 0x35, 0x18, 0x72, 0x6A, 0xA0, 0xE1, 0x57, 0x44, 0x63, 0x01, 0xCE, 0xB8,
+    0x35, 0x22, 0xE4, 0x20, 0x6C, 0x20, 0x08, 0xE7, 0x25, 0x19, 0xCE, 0x4B, 0x28, 0xE7, 0x25, 0x6C,
+    0xE2, 0x2A, 0xAC, 0x93, 0x32, 0x59, 0x64, 0xFF, 0x6C, 0xD3, 0x42, 0x2E, 0xB7, 0x1F, 0x3F, 0x59,
+    0x41, 0x40, 0xD3, 0xBF, 0x64, 0xC8, 0xEF, 0x9F, 0x55, 0xE4, 0x1D, 0x14, 0xF9, 0xF6, 0x21, 0x43,
+    0x79, 0xBA, 0xBC, 0x83, 0xCC, 0x0B, 0xE6, 0xBB, 0x26, 0xFC, 0xB1, 0x48, 0x9D, 0x7C, 0xEC, 0x61,
+    0xC2, 0xB3, 0xE6, 0xF8, 0x70, 0x50, 0x75, 0xCC, 0xF3, 0xA4, 0x4A, 0xA9, 0xF7, 0x1D, 0xCC, 0xCD,
+    0x35, 0x41, 0x80, 0x04, 0x5A, 0xD5, 0xDE, 0x24, 0xF3, 0xE6, 0x41, 0x53, 0xF1, 0xB4, 0x08, 0x9C,
+    0x32, 0x77, 0xE6, 0x5D, 0x62, 0xCE, 0x29, 0x42, 0x75, 0x20, 0x75, 0xE4, 0x74, 0x21, 0x77, 0xC4,
+    0xED, 0x8E, 0x81, 0x57, 0x4C, 0x08, 0xDF, 0xAA, 0xED, 0xFF, 0x56, 0xBD, 0xD7, 0x1C, 0x57, 0xBD,
+    0x79, 0x82, 0x6B, 0x49, 0xB3, 0xF7, 0x21, 0xCE, 0x44, 0x40, 0xEA, 0x54, 0x22, 0x9C, 0xAB, 0x6B,
+    0x73, 0x1A, 0x36, 0x69, 0xD4, 0x61, 0xD3, 0x3D, 0xFA, 0x4B, 0xE9, 0x68, 0xDA, 0x8E, 0xE7, 0x34,
+    0xD0, 0x4F, 0x32, 0x3D, 0xEF, 0xA0, 0x31, 0xFC, 0x79, 0x4D, 0xA7, 0x74, 0x49, 0x94, 0x46, 0xBF,
+    0xD4, 0xBC, 0x80, 0x7B, 0x1C, 0xC6, 0x0E, 0xE1, 0x12, 0xF6, 0x21, 0x51, 0xD5, 0x9E, 0x9B, 0x8C,
+    0xAA, 0xFD, 0x75, 0x86, 0x00, 0x8F, 0x73, 0x9F, 0xE5, 0xE6, 0x32, 0xA9, 0x9C, 0x42, 0x74, 0xB2,
+    0x9A, 0x0A, 0x19, 0x6B, 0x7C, 0x1B, 0xF3, 0x77, 0xB4, 0xB5, 0x62, 0x22, 0x32, 0xB0, 0xFA, 0x19,
+    0xA8, 0x8A, 0xA9, 0xFF, 0x7B, 0xD7, 0x50, 0xF7, 0x45, 0x57, 0x88, 0x79, 0x6A, 0xDF, 0x43, 0x24,
+    0xE2, 0xD6, 0x41, 0x89, 0x28, 0xB1, 0x8F, 0x13, 0x33, 0x7C, 0xFB, 0x29, 0x4F, 0x8F, 0xFD, 0x3B,
+    0xC4, 0x4E, 0xD9, 0x1F, 0x21, 0x28, 0x48, 0x04, 0x84, 0x24, 0xA7, 0x93, 0x91, 0x66, 0x00, 0x24,
+    0x2D, 0xE0, 0x6A, 0xA7, 0x98, 0x27, 0xF9, 0x25, 0x05, 0x81, 0x0E, 0x44, 0x44, 0x7C, 0xEF, 0x70,
+    0x3D, 0xAE, 0xED, 0xD0, 0x34, 0x8A, 0x25, 0xA2, 0x81, 0x85, 0x81, 0x0C, 0xBE, 0xB8, 0x65, 0x31,
+    0x19, 0x8E, 0x69, 0x61, 0xFA, 0x71, 0x85, 0xC9, 0xE0, 0xD6, 0xC7, 0xD8, 0x40, 0xD9, 0x9E, 0x2F,
+    0x8C, 0xEA, 0xDD, 0x0D, 0x4C, 0x6D, 0xB6, 0x21, 0x63, 0x1F, 0x37, 0xD4, 0xB8, 0xF5, 0xE4, 0xA7,
+    0x6C, 0x99, 0xB5, 0x42, 0x78, 0xE7, 0x48, 0x81, 0xF8, 0x7A, 0x21, 0x3C, 0xC8, 0x70, 0x3A, 0xA2,
+    0xEA, 0xF0, 0xFD, 0x43, 0xFE, 0xFE, 0x9A, 0x20, 0xAC, 0x96, 0x56, 0x43, 0xCD, 0x80, 0x9F, 0xD3,
+    0x71, 0x33, 0xEE, 0x5B, 0x73, 0x4A, 0xD7, 0x0C, 0xE1, 0xF5, 0x41, 0x8F, 0xC6, 0x83, 0x53, 0xFB,
+    0x73, 0x13, 0x62, 0xE6, 0x97, 0xA8, 0x66, 0xBB, 0x64, 0x46, 0x6B, 0xE3, 0xB4, 0xD3, 0x6D, 0xCE,
+    0xCE, 0x5A, 0x22, 0xDC, 0x9B, 0x1C, 0xC5, 0xCE, 0x24, 0xEA, 0x92, 0xAC, 0x98, 0xFB, 0xF0, 0xA8,
+    0xDE, 0x26, 0xFD, 0xA6, 0x66, 0x69, 0x89, 0xDC, 0xCC, 0x6B, 0xB6, 0x89, 0xE5, 0x45, 0x0C, 0x13,
+    0x0C, 0x97, 0xC0, 0x0F, 0x5F, 0x46, 0x64, 0x0B, 0x1B, 0x21, 0x62, 0x05, 0x29, 0x13, 0x44, 0x03,
+    0xA6, 0x3C, 0x68, 0xA6, 0xE0, 0xB6, 0x37, 0x5C, 0x1C, 0x9B, 0x29, 0x06, 0x0A, 0xBA, 0x48, 0x10,
+    0xC7, 0x0E, 0xC9, 0x76, 0xC2, 0x56, 0x65, 0xDC, 0x58, 0x3A, 0xEF, 0x25, 0x2D, 0x43, 0x1F, 0x8F,
+    0x31, 0x72, 0x4D, 0xF1, 0x4E, 0x36, 0x1B, 0x27, 0x2C, 0xB6, 0xF7, 0x5E, 0x14, 0xEF, 0x5D, 0x0C,
+    0x4D, 0xC6, 0x34, 0x11, 0x59, 0x20, 0x03, 0x24, 0x7F, 0x95, 0x80, 0xF4, 0x30, 0x9F, 0x08, 0x67,
+    0xC2, 0xCC, 0xA1, 0x95, 0xC9, 0x16, 0x87, 0x64, 0x32, 0xBE, 0xB9, 0x92, 0x6F, 0x63, 0x89, 0x49,
+    0xED, 0xF7, 0x10, 0x2E, 0x2C, 0x6C, 0xE9, 0xD9, 0xDC, 0xE6, 0xC2, 0x9A, 0xCD, 0x7D, 0x04, 0xAB,
+    0x41, 0xEB, 0x58, 0xCA, 0x9E, 0x30, 0x21, 0x3E, 0x82, 0x04, 0x8E, 0xBD, 0xFF, 0x1F, 0xF7, 0x41,
+    0x40, 0x77, 0x56, 0xA2, 0x22, 0xA1, 0xA7, 0xD4, 0x55, 0x36, 0x1E, 0x0F, 0x54, 0x40, 0xA0, 0x64,
+    0xFF, 0x01, 0x83, 0x73, 0x6D, 0xB5, 0x7B, 0x6D, 0xB5, 0xF3, 0x2C, 0x80, 0x7A, 0x14, 0x8A, 0xCD,
+    0xE2, 0xE3, 0x14, 0x89, 0xB9, 0xC5, 0x18, 0xEA, 0xEC, 0xC8, 0xB7, 0x01, 0x2C, 0x75, 0x62, 0x53,
+    0xAF, 0xFB, 0x35, 0x50, 0x28, 0x07, 0x28, 0xBA, 0x11, 0x8A, 0xF6, 0x37, 0x81, 0x82, 0xAA, 0xDD,
+    0x5F, 0x86, 0x88, 0x77, 0xFE, 0x5E, 0x4C, 0x7C, 0x21, 0x5B, 0xF5, 0x5D, 0xF5, 0x5A, 0xD2, 0x49,
+    0xAC, 0x30, 0x34, 0xBD, 0x53, 0xCC, 0x38, 0x93, 0xAA, 0x8A, 0x3A, 0x8A, 0x7E, 0x0E, 0x6F, 0x98,
+    0x92, 0x04, 0xF1, 0x94, 0x1F, 0x78, 0x68, 0x4B, 0xCB, 0x59, 0xDC, 0xA6, 0x8E, 0x6C, 0x8C, 0x58,
+    0xAF, 0x60, 0x5A, 0x2A, 0xC5, 0xBC, 0x81, 0xB0, 0x7C, 0xCB, 0x5C, 0x2A, 0x56, 0xE6, 0xE5, 0x60,
+    0x39, 0x52, 0xF1, 0xB5, 0x7D, 0x40, 0x91, 0x13, 0x39, 0x64, 0x27, 0x1D, 0xAB, 0xB7, 0x33, 0x83,
+    0xB9, 0x52, 0x7A, 0x40, 0x0E, 0x6E, 0x01, 0x45, 0x20, 0x28, 0x5C, 0xEE, 0xF0, 0x5C, 0x8E, 0xD1,
+    0x82, 0x86, 0x50, 0xCD, 0x18, 0x42, 0x81, 0x31, 0xF0, 0xF5, 0xF0, 0x24, 0xC3, 0x04, 0x60, 0x08,
+    0xAC, 0xC4, 0xBA, 0xCB, 0x64, 0x66, 0xCC, 0x45, 0x0C, 0xF9, 0x08, 0xF5, 0xC7, 0x63, 0xDD, 0x4A,
+    0x79, 0xAD, 0x13, 0x5B, 0x9D, 0xDB, 0x05, 0xD5, 0x17, 0xDF, 0x86, 0xCC, 0x8B, 0x30, 0xF9, 0x3C,
+    0x74, 0x32, 0xB3, 0x06, 0xCA, 0x91, 0xAA, 0xB6, 0x8A, 0x92, 0x23, 0x52, 0xF3, 0x89, 0x44, 0xA0,
+    0x79, 0xB8, 0x22, 0xAB, 0x70, 0x0C, 0xE0, 0x16, 0x84, 0xE2, 0x14, 0x40, 0x1C, 0x68, 0xBA, 0xB6,
+    0xCC, 0x49, 0x91, 0x2B, 0x81, 0xD5, 0x05, 0xF3, 0x8E, 0x84, 0x55, 0xA1, 0x5D, 0x00, 0x26, 0x7A,
+    0x76, 0x5F, 0x85, 0xEE, 0x13, 0xA0, 0x0D, 0x09, 0x66, 0xE4, 0x7A, 0x45, 0x59, 0x98, 0x38, 0xD7,
+    0x0C, 0x6E, 0xA8, 0xE7, 0x94, 0xDA, 0x5C, 0xA6, 0xC8, 0x2A, 0x1C, 0x94, 0xF3, 0xBD, 0xA0, 0x8A,
+    0x8C, 0x88, 0x88, 0x38, 0xC8, 0x34, 0x43, 0x3E, 0x90, 0x6D, 0xEE, 0x40, 0x8C, 0xF2, 0x10, 0x8C,
+    0x79, 0x8A, 0xE5, 0x8E, 0x48, 0x85, 0x70, 0xEB, 0x36, 0x98, 0x5B, 0x14, 0x12, 0x7E, 0xC5, 0x6D,
+    0xE6, 0x35, 0x8F, 0x26, 0xE5, 0x66, 0x0E, 0xC3, 0x09, 0x70, 0xF9, 0x15, 0xC1, 0xC6, 0xAD, 0x42,
+    0x49, 0x01, 0xF1, 0xEE, 0xE8, 0x32, 0x08, 0x3D, 0x20, 0x45, 0xE6, 0x08, 0x95, 0xAA, 0x50, 0x8F,
+    0x02, 0x4F, 0x02, 0xE7, 0x03, 0x79, 0x3D, 0x75, 0x20, 0xAE, 0x7F, 0x49, 0x88, 0x21, 0xD1, 0xD4,
+    0x54, 0x5B, 0xA1, 0x04, 0x5B, 0x85, 0x00, 0x67, 0x87, 0xA0, 0x32, 0x29, 0xAE, 0xA7, 0xCE, 0x53,
+    0xFA, 0x81, 0x82, 0xD0, 0x41, 0x7D, 0x30, 0x38, 0x2F, 0xBD, 0xDF, 0xD2, 0xC7, 0x3D, 0xBD, 0xA5,
+    0xEF, 0x23, 0x9C, 0x9F, 0xA8, 0xFD, 0x2A, 0xFA, 0xD4, 0xB7, 0xD8, 0x5C, 0xD1, 0x58, 0x4B, 0x91,
+    0xF0, 0x50, 0xD4, 0x56, 0x2A, 0xA4, 0x7E, 0xC7, 0xB8, 0xD7, 0x27, 0xB0, 0x2F, 0xBE, 0xED, 0xEC,
+    0xBF, 0x95, 0x74, 0x9E, 0xAD, 0x91, 0x98, 0x44, 0x32, 0x52, 0x87, 0x45, 0x80, 0x92, 0x81, 0x5C,
+    0x5E, 0x94, 0x21, 0x72, 0x39, 0xC2, 0x99, 0x4D, 0x65, 0x21, 0x2B, 0x68, 0xC9, 0xB6, 0x27, 0x95,
+    0x50, 0x28, 0x5A, 0x4E, 0xC2, 0xB2, 0x4F, 0x5E, 0x91, 0x1B, 0xED, 0x9B, 0x02, 0xC5, 0x0A, 0x64,
+    0xA5, 0xC1, 0xA8, 0xAA, 0x58, 0x3A, 0x61, 0xCC, 0x07, 0xD2, 0xCE, 0x83, 0xBB, 0x58, 0x95, 0x30,
+    0x72, 0xD0, 0xDC, 0x2B, 0x26, 0x0E, 0xC3, 0xBB, 0xD0, 0xF3, 0xB0, 0xE8, 0x5B, 0xA3, 0x23, 0xF1,
+    0x90, 0x3A, 0xF4, 0xBF, 0x54, 0x1D, 0xD6, 0x07, 0x73, 0xA6, 0x8F, 0x53, 0x87, 0x8E, 0xE6, 0xF5,
+    0x86, 0x1C, 0xC4, 0xC3, 0x7A, 0x76, 0x39, 0x90, 0x8C, 0xFB, 0xBF, 0x8F, 0x2B, 0x32, 0x4D, 0x90,
+    0x6D, 0xEE, 0x68, 0xD2, 0x55, 0xE6, 0x93, 0x0B, 0xDD, 0x25, 0x32, 0xBD, 0x8B, 0x78, 0xC8, 0x83,
+    0xD2, 0x83, 0xDC, 0xBF, 0x3E, 0x24, 0x41, 0x27, 0xF3, 0xAA, 0x14, 0xE4, 0x73, 0x5D, 0x7C, 0xD8,
+    0xE2, 0xDE, 0x11, 0x58, 0x5B, 0xF4, 0xBC, 0xBC, 0x88, 0x5B, 0x93, 0xA6, 0x07, 0x28, 0x63, 0x78,
+    0xDC, 0x64, 0x1A, 0x1F, 0x47, 0x15, 0x61, 0x8A, 0xA9, 0xDF, 0xE9, 0x1E, 0x05, 0xAD, 0x5B, 0x73,
+    0x46, 0x3A, 0x31, 0x61, 0xC3, 0x72, 0x47, 0x54, 0x6B, 0x0C, 0xF7, 0x39, 0x05, 0x2A, 0xB1, 0x76,
+    0xFE, 0xF2, 0x89, 0x26, 0x40, 0x4B, 0xAB, 0xE0, 0x15, 0x0B, 0xC2, 0x97, 0xD5, 0x9A, 0xD0, 0x64,
+    0x5E, 0x33, 0x8D, 0x5B, 0xB2, 0x10, 0x32, 0xE7, 0x7C, 0xCF, 0x67, 0x26, 0xB1, 0x71, 0x34, 0xB0,
+    0x3E, 0xF0, 0xA3, 0x82, 0xA8, 0x0E, 0xA0, 0x71, 0x55, 0x46, 0x3D, 0xBD, 0xCC, 0x99, 0xAE, 0x7A,
+    0xA2, 0x67, 0xB2, 0x7F, 0xC3, 0xB1, 0x62, 0x4D, 0x65, 0x49, 0xD1, 0x36, 0x9D, 0x03, 0x4F, 0x42,
+    0x14, 0x96, 0xB7, 0x12, 0x46, 0xFD, 0x16, 0x5B, 0xD1, 0x69, 0x65, 0x0D, 0x79, 0x55, 0xB9, 0x25,
+    0xAC, 0xE5, 0xE6, 0xA8, 0x16, 0x41, 0x88, 0xEB, 0x04, 0x87, 0x2F, 0xA2, 0x34, 0xDB, 0x14, 0xE6,
+    0x78, 0x56, 0xCD, 0x84, 0x77, 0xA8, 0xAE, 0x28, 0x33, 0x11, 0x4C, 0xCE, 0xD1, 0x0C, 0x9E, 0xDF,
+    0x77, 0xF7, 0x6F, 0xC4, 0x58, 0x12, 0x26, 0x5F, 0x56, 0x7B, 0xFA, 0x25, 0x55, 0xDC, 0x65, 0x3D,
+    0x17, 0xA0, 0x07, 0xCC, 0x03, 0x1E, 0xA8, 0x5D, 0x1E, 0x59, 0xDA, 0x9B, 0x27, 0x48, 0xFB, 0x16,
+    0xA4, 0x7D, 0x1B, 0x6B, 0xDD, 0x86, 0xC0, 0x01, 0x35, 0xAF, 0x86, 0x27, 0x55, 0x23, 0xAD, 0x51,
+    0xF5, 0xD5, 0x9F, 0x9C, 0x84, 0xF8, 0x8D, 0xD6, 0x14, 0x37, 0x94, 0x86, 0x48, 0x3E, 0xF6, 0x69,
+    0xF8, 0xD3, 0x23, 0x19, 0xFE, 0xE8, 0x21, 0x15, 0x3C, 0xAF, 0x21, 0x14, 0x1F, 0x81, 0x1D, 0x3D,
+    0xEE, 0xF4, 0x40, 0x9F, 0x1D, 0x83, 0x07, 0x43, 0x95, 0xA0, 0x1A, 0x02, 0x95, 0x68, 0x16, 0xA6,
+    0x38, 0xB0, 0x30, 0x0D, 0x16, 0x53, 0x03, 0xA0, 0xDA, 0x5F, 0xB5, 0xB2, 0x1C, 0x58, 0x38, 0x92,
+    0xE9, 0xDC, 0xB6, 0x79, 0x83, 0xD5, 0x08, 0x56, 0x67, 0x7D, 0x5B, 0xBB, 0x72, 0x01, 0x67, 0x92,
+    0x9D, 0x0C, 0x17, 0xD8, 0xCA, 0x2B, 0x3A, 0x35, 0x3C, 0x5E, 0x1E, 0xC9, 0x82, 0x7C, 0xC2, 0x50,
+    0xAC, 0x9C, 0x9A, 0x45, 0x84, 0x72, 0x50, 0xDA, 0x87, 0x64, 0xAC, 0x1E, 0xAD, 0x71, 0x1E, 0xCC,
+    0x58, 0x6D, 0x19, 0x65, 0x5A, 0xB9, 0x26, 0xDB, 0xA4, 0xAD, 0xA6, 0x8F, 0x5C, 0x9B, 0x89, 0xF3,
+    0xC8, 0xFE, 0x60, 0xE9, 0xDB, 0x6F, 0x49, 0xB4, 0xF7, 0xAA, 0x88, 0x5E, 0x28, 0x57, 0xFD, 0xF6,
+    0xB3, 0xDE, 0xC3, 0x1D, 0xE1, 0x8A, 0xBE, 0xB0, 0xF8, 0xCA, 0x89, 0x1A, 0x15, 0xE7, 0xC6, 0x6F,
+    0xBC, 0x87, 0x47, 0x13, 0xC6, 0x4D, 0x59, 0x55, 0x8C, 0x54, 0x53, 0x2C, 0x22, 0x39, 0x82, 0x71,
+    0x7D, 0xF1, 0x78, 0x18, 0xF9, 0x1D, 0x19, 0x7E, 0x8D, 0x40, 0x04, 0x5A, 0x29, 0x5E, 0xF5, 0x9B,
+    0xE3, 0x80, 0x32, 0xE4, 0xC5, 0xCD, 0x73, 0x47, 0x67, 0xE4, 0xCB, 0x25, 0xED, 0x9F, 0x60, 0x4C,
+    0x2C, 0x6A, 0x25, 0xBE, 0xD8, 0x54, 0x6B, 0xFE, 0xE0, 0xB1, 0x92, 0x66, 0xCE, 0xF5, 0xCE, 0xF4,
+    0x42, 0x13, 0x2E, 0x2A, 0xE1, 0x6A, 0x4C, 0x83, 0xC5, 0x2C, 0xF4, 0xEE, 0xF5, 0xC9, 0x8A, 0x15,
+    0x9D, 0xCC, 0xD2, 0x28, 0xC1, 0xE7, 0xBC, 0xAC, 0xF5, 0xE7, 0x6D, 0x7D, 0xD9, 0x93, 0xBB, 0xC4,
+    0xAD, 0x13, 0x61, 0x0A, 0xAF, 0xD5, 0x28, 0x46, 0x87, 0xB2, 0x7D, 0x35, 0x7B, 0x18, 0x20, 0xAF,
+    0x97, 0xBC, 0xCE, 0x15, 0xEA, 0x2F, 0x3B, 0xD6, 0x95, 0xB9, 0x85, 0xC1, 0x1F, 0xF0, 0x25, 0xFB,
+    0x40, 0xF8, 0xDE, 0x33, 0xC9, 0x7F, 0x94, 0x70, 0x1B, 0xE3, 0x07, 0xA2, 0x3B, 0xE0, 0xEA, 0xA7,
+    0x50, 0x9E, 0x81, 0xA5, 0x0E, 0x85, 0xD3, 0xE2, 0xD6, 0xEA, 0x7B, 0xDD, 0xA7, 0x09, 0x28, 0x6C,
+    0x9F, 0x09, 0xE8, 0x0B, 0xE1, 0xA0, 0x9B, 0x30, 0xF3, 0x68, 0xCF, 0x73, 0x07, 0x17, 0x6F, 0x4A,
+    0x70, 0x9E, 0xAC, 0x12, 0x2B, 0x3B, 0xF2, 0x40, 0x06, 0xFB, 0x37, 0x36, 0xF5, 0xAD, 0xDC, 0x11,
+    0xAC, 0xA6, 0x80, 0x6B, 0x8A, 0xB5, 0x0E, 0xB8, 0x2A, 0x09, 0x5C, 0x15, 0x11, 0x85, 0xF6, 0x6C,
+    0x51, 0x06, 0xB6, 0x46, 0x0C, 0x9B, 0x6B, 0x6D, 0x7F, 0x2D, 0xA1, 0x38, 0xF0, 0x93, 0xA8, 0x55,
+    0x7A, 0x4F, 0xFF, 0xA7, 0x7B, 0xEA, 0xA8, 0xB9, 0xD4, 0xE8, 0xFD, 0x64, 0x80, 0x31, 0x63, 0xC3,
+    0x46, 0x32, 0xB6, 0x79, 0x34, 0x53, 0x3D, 0xAA, 0x4F, 0x1D, 0xB8, 0xB5, 0xA6, 0x79, 0xDA, 0x4C,
+    0xDD, 0xCA, 0x3E, 0x49, 0x52, 0x4F, 0x6E, 0xDC, 0xFA, 0x8A, 0x9C, 0x83, 0x33, 0xE1, 0x97, 0x31,
+    0x92, 0x21, 0x2D, 0x64, 0x8F, 0x7E, 0xCC, 0x62, 0x4C, 0x5B, 0x9E, 0x10, 0xB2, 0x6E, 0x75, 0x88,
+    0xAB, 0xEE, 0xE9, 0x8B, 0xE9, 0x5F, 0x9A, 0xFD, 0x1B, 0xE2, 0xAF, 0xB9, 0x95, 0x6D, 0x6C, 0x2B,
+    0x71, 0x57, 0xF4, 0xF9, 0xAF, 0x5A, 0xF3, 0xB2, 0x28, 0x1C, 0xEA, 0xA2, 0xA8, 0xE5, 0xBD, 0x71,
+    0xC3, 0x97, 0xA4, 0xE6, 0x14, 0x49, 0x45, 0x0D, 0x0B, 0x75, 0x47, 0xE5, 0x13, 0x6A, 0x79, 0x99,
+    0x4E, 0x22, 0x3D, 0x73, 0xBE, 0xD0, 0x97, 0x12, 0x4A, 0x19, 0xFE, 0xC4, 0x28, 0xFE, 0x4B, 0xDC,
+    0xA2, 0x8E, 0x18, 0x63, 0x9A, 0xB5, 0x3C, 0x0C, 0x77, 0xE6, 0xD0, 0x38, 0x7A, 0x00, 0x3C, 0x95,
+    0xB0, 0x90, 0xBA, 0xED, 0x39, 0x75, 0xDC, 0x08, 0xC0, 0x23, 0x5B, 0xF6, 0xFE, 0x51, 0xB7, 0x6C,
+    0x39, 0x6E, 0x59, 0x23, 0xF8, 0x21, 0xA0, 0xC9, 0x0F, 0x4D, 0xA1, 0xE4, 0xBD, 0x9A, 0xFA, 0xCB,
+    0x76, 0x8C, 0xA3, 0x62, 0x8A, 0x4E, 0x42, 0x95, 0xAE, 0x69, 0x87, 0xA1, 0xAF, 0x03, 0x4E, 0x9D,
+    0xB5, 0xCB, 0xA1, 0x43, 0x20, 0x61, 0x2C, 0x87, 0x72, 0x7B, 0xC9, 0xC0, 0x8D, 0x1D, 0x02, 0x10,
+    0x12, 0xA8, 0x6E, 0x98, 0xFB, 0x6C, 0x81, 0x35, 0x8B, 0x32, 0x19, 0x47, 0xE4, 0x65, 0xB1, 0x77,
+    0x09, 0x5A, 0x44, 0x40, 0x0C, 0x82, 0xAA, 0xA1, 0xFA, 0x1F, 0x32, 0x17, 0x16, 0xF3, 0xBF, 0x05,
+    0xB2, 0x5A, 0x9F, 0x69, 0x63, 0xD3, 0x62, 0x3C, 0xA8, 0x48, 0xB5, 0x44, 0xF3, 0x8A, 0x75, 0xC7,
+    0x0E, 0x0F, 0xB7, 0x0B, 0xDA, 0x60, 0xE9, 0xAD, 0x42, 0x79, 0x87, 0x60, 0x2D, 0x59, 0xB8, 0x36,
+    0x13, 0x9A, 0x0A, 0xF9, 0x43, 0x4A, 0xCF, 0xE6, 0x41, 0x5B, 0xE4, 0x62, 0x3A, 0xC5, 0x6C, 0x26,
+    0x8B, 0xAC, 0x44, 0x6D, 0xCA, 0x83, 0x49, 0xDC, 0x9A, 0x2A, 0xD6, 0x97, 0xCC, 0x3B, 0x90, 0xC6,
+    0x1F, 0xD7, 0x63, 0xC5, 0x5A, 0x6B, 0x74, 0xB3, 0xD2, 0xD4, 0x3A, 0x20, 0x30, 0x66, 0x73, 0x7E,
+    0xA1, 0xD9, 0x1C, 0x77, 0x96, 0xCD, 0x39, 0x16, 0x34, 0xCC, 0xB9, 0x4D, 0x6C, 0x79, 0x07, 0x65,
+    0xE9, 0x2D, 0x33, 0x9A, 0x5C, 0xF6, 0xEB, 0xBC, 0x02, 0x79, 0xD8, 0x70, 0xD6, 0x4A, 0x1E, 0x94,
+    0x58, 0xD0, 0xEA, 0x2E, 0x51, 0x32, 0x45, 0xD3, 0x4B, 0xF4, 0xCD, 0x6A, 0x4E, 0x27, 0x40, 0x61,
+    0xA3, 0x1B, 0x60, 0x41, 0x2B, 0xC7, 0xCA, 0x00, 0x98, 0x21, 0xA8, 0x47, 0x93, 0x08, 0xA8, 0x05,
+    0x38, 0x7D, 0xFA, 0x37, 0xD7, 0xCE, 0x0E, 0x9C, 0x1B, 0x38, 0x31, 0x82, 0x90, 0x36, 0xBA, 0x11,
+    0xA3, 0x79, 0x7D, 0x40, 0x0B, 0xB0, 0x28, 0xA0, 0x6A, 0x6E, 0x37, 0x07, 0x0E, 0x16, 0x99, 0xA5,
+    0xA4, 0x94, 0xD7, 0x30, 0x65, 0x44, 0x25, 0xDB, 0xE5, 0x31, 0x1D, 0xF3, 0xB5, 0x3E, 0x21, 0xC3,
+    0xE4, 0x75, 0xD0, 0xF7, 0x40, 0xF1, 0x98, 0x83, 0x57, 0x4C, 0x23, 0x88, 0x44, 0xFD, 0xEB, 0x70,
+    0x58, 0x87, 0xC8, 0x60, 0xE8, 0x8A, 0xE2, 0xD1, 0x45, 0x82, 0x05, 0x0E, 0x59, 0xCC, 0xDE, 0x97,
+    0xDB, 0x40, 0x49, 0xEE, 0x6A, 0x30, 0xB9, 0xCD, 0xBD, 0x9A, 0x15, 0x0D, 0x26, 0x92, 0x49, 0x5E,
+    0x35, 0xB5, 0x5D, 0x08, 0x18, 0x2F, 0x7C, 0x01, 0x38, 0xFE, 0xC7, 0xDA, 0xD4, 0xED, 0xC4, 0xE9,
+    0x42, 0x5B, 0x8F, 0x27, 0xBB, 0x20, 0x2A, 0x56, 0x44, 0x29, 0x29, 0x63, 0xC0, 0x52, 0xE4, 0x00,
+    0xC6, 0x51, 0x68, 0xAE, 0x21, 0x2D, 0xE2, 0x21, 0x67, 0x2C, 0x73, 0x77, 0x57, 0xE1, 0x98, 0xB3,
+    0x9E, 0x54, 0x30, 0x77, 0x04, 0x90, 0x3A, 0xF3, 0x5B, 0x80, 0xC9, 0xE6, 0x7B, 0x00, 0x8A, 0xD9,
+    0x2C, 0x7B, 0x2F, 0xC4, 0x36, 0x6D, 0x0D, 0xC7, 0xC7, 0xD9, 0x1D, 0x9A, 0x37, 0xC7, 0x26, 0xD3,
+    0x7C, 0x2C, 0x9B, 0x1C, 0x6C, 0x0A, 0xD1, 0xF6, 0x20, 0xA4, 0x9F, 0x3A, 0xE8, 0x6C, 0xEC, 0x48,
+    0x49, 0xCE, 0x4A, 0x80, 0x26, 0x23, 0x7A, 0x6E, 0x64, 0x6C, 0x90, 0xC8, 0x8C, 0x6A, 0x6A, 0x59,
+    0x5A, 0x8D, 0xE4, 0x3E, 0x96, 0xD4, 0xE8, 0x3E, 0xF9, 0x88, 0xFD, 0x8D, 0x25, 0xAB, 0xD2, 0xA5,
+    0x26, 0xCB, 0xB2, 0xC5, 0xD0, 0xA9, 0x24, 0xB6, 0x83, 0x41, 0x85, 0x84, 0xAE, 0xB1, 0xFD, 0xCF,
+    0x00, 0x45, 0xEC, 0xD6, 0x81, 0x2A, 0x44, 0xF2, 0x03, 0xC8, 0xA3, 0x22, 0xB3, 0x52, 0xBD, 0xDC,
+    0x0B, 0xD2, 0xC5, 0x9B, 0x41, 0x93, 0xB4, 0x99, 0x18, 0xAB, 0x07, 0xAD, 0xDF, 0xBD, 0xDF, 0x8A,
+    0x1F, 0xDB, 0x88, 0xAD, 0x49, 0xC3, 0x3E, 0x57, 0x37, 0xE4, 0xE9, 0x46, 0x9F, 0x7C, 0x71, 0xB0,
+    0xC9, 0xEC, 0xB4, 0x39, 0x9B, 0xFF, 0x14, 0x93, 0x05, 0x72, 0xE8, 0x04, 0x79, 0x8B, 0xD1, 0xFF,
+    0x72, 0xF7, 0xF3, 0x22, 0xF5, 0xEC, 0x87, 0x42, 0x47, 0xF6, 0x33, 0x94, 0x1C, 0xFE, 0x3B, 0x92,
+    0x01, 0xCD, 0x9E, 0x45, 0xB5, 0xF1, 0x70, 0x7A, 0xE9, 0x08, 0xC9, 0x9D, 0x59, 0x47, 0xF5, 0x18,
+    0x9D, 0xB2, 0xDA, 0x74, 0x79, 0xA6, 0x5B, 0x35, 0x13, 0x76, 0x85, 0xD6, 0x30, 0xFA, 0x61, 0xC5,
+    0x2E, 0x89, 0xFC, 0x4B, 0xBA, 0x24, 0x4E, 0x11, 0xC4, 0x1D, 0xF9, 0xB7, 0x14, 0x99, 0xB8, 0x22,
+    0x90, 0xC4, 0x56, 0x6B, 0x50, 0x9B, 0x3B, 0xC7, 0x23, 0x1E, 0xFD, 0x4C, 0x3C, 0xDE, 0x84, 0xB6,
+    0x1D, 0x82, 0x9D, 0x31, 0xD4, 0x71, 0x51, 0xC3, 0x8B, 0x1F, 0x20, 0x07, 0x95, 0xCA, 0xBD, 0xA2,
+    0xC2, 0x16, 0x8E, 0x58, 0xFD, 0x52, 0x94, 0xD9, 0xF3, 0xBA, 0x15, 0x8E, 0x6E, 0xCF, 0x92, 0x95,
+    0xC1, 0xB4, 0x6F, 0x93, 0xF4, 0xF5, 0xFF, 0xDC, 0x91, 0x95, 0x39, 0x43, 0x0D, 0x2B, 0x67, 0x5F,
+    0x26, 0x91, 0xBB, 0x8B, 0xD2, 0xA5, 0xCF, 0xB0, 0x34, 0x51, 0x77, 0x0B, 0x3A, 0x18, 0x9B, 0xB9,
+    0x99, 0x8E, 0x21, 0x0C, 0xB7, 0x54, 0x53, 0x9B, 0xF9, 0x70, 0x5C, 0xC7, 0xD3, 0xFA, 0x02, 0x54,
+    0xAB, 0x15, 0xA7, 0xC1, 0x5B, 0xCA, 0x25, 0x41, 0xED, 0xCB, 0xD0, 0x88, 0x2C, 0x51, 0x3D, 0xF8,
+    0xDA, 0x19, 0xCA, 0xD6, 0x41, 0x3B, 0xF6, 0xBD, 0x08, 0xBF, 0x57, 0x60, 0x27, 0x32, 0x38, 0xE3,
+    0x59, 0x2A, 0x4A, 0x20, 0xF9, 0x77, 0x54, 0xC8, 0x66, 0xAA, 0x95, 0x38, 0xB0, 0x0F, 0x20, 0x83,
+    0x1F, 0xDB, 0xBE, 0x01, 0xBD, 0x1E, 0x01, 0x07, 0xE7, 0x74, 0x80, 0xD8, 0xD5, 0x72, 0x3F, 0x5C,
+    0xC6, 0xE8, 0xC3, 0xCA, 0xBC, 0x2E, 0xCE, 0xE1, 0xD0, 0xCE, 0x0C, 0x04, 0x04, 0x00, 0xF0, 0x0F,
+    0xF6, 0xC1, 0x3D, 0x98, 0xF7, 0xD9, 0x42, 0xD3, 0x2A, 0xE7, 0x64, 0xBC, 0x28, 0xC1, 0x36, 0xB8,
+    0x06, 0xD3, 0xE0, 0x39, 0x98, 0x2C, 0xEE, 0xB3, 0x64, 0x29, 0x48, 0x87, 0xA3, 0x88, 0x8C, 0x98,
+    0x3A, 0xA0, 0x6E, 0xD3, 0xC7, 0x0B, 0x9A, 0xC0, 0x7B, 0x5A, 0xA6, 0xB6, 0x87, 0xAA, 0x77, 0xA9,
+    0xE7, 0x5D, 0xFE, 0xE0, 0x1F, 0x53, 0x1D, 0x30, 0xD0, 0xF2, 0xAA, 0x28, 0x97, 0x95, 0x11, 0x03,
+    0x16, 0xCB, 0x21, 0xC0, 0x1A, 0xC3, 0xAB, 0x67, 0xBB, 0xBB, 0x1B, 0x12, 0x1E, 0x45, 0x22, 0xD7,
+    0xE1, 0x07, 0x4D, 0xCF, 0x61, 0x3A, 0xF6, 0x0F, 0x1F, 0xC3, 0xEE, 0x06, 0x30, 0xC0, 0x29, 0x1E,
+    0x85, 0x10, 0x7F, 0x20, 0xCF, 0x24, 0x3C, 0x8B, 0xE0, 0x8E, 0x9B, 0x97, 0x44, 0xE1, 0x5C, 0x60,
+    0x36, 0xE5, 0x1B, 0x53, 0x4B, 0xC9, 0xE1, 0x0D, 0x83, 0x6A, 0x34, 0xFB, 0x46, 0x8E, 0x27, 0x67,
+    0xD5, 0xCE, 0x90, 0xB7, 0x50, 0x73, 0xDC, 0xDF, 0x50, 0x27, 0x85, 0x0A, 0x26, 0xAA, 0xA6, 0x50,
+    0x83, 0x99, 0x42, 0x5F, 0xFB, 0x32, 0xBB, 0x51, 0xBB, 0x22, 0xDC, 0x41, 0x79, 0x4C, 0xD4, 0x9B,
+    0x63, 0xFF, 0x8B, 0x73, 0x6C, 0xDA, 0xBF, 0x7D, 0x6C, 0x71, 0x34, 0x9C, 0x17, 0x47, 0xDB, 0xDF,
+    0x25, 0xDF, 0x74, 0x49, 0xEF, 0xA1, 0x76, 0x20, 0xF7, 0xBD, 0xD7, 0x87, 0xDC, 0x22, 0x10, 0x49,
+    0xDB, 0x87, 0x1F, 0x1A, 0x6D, 0xF7, 0xC1, 0xB6, 0xC6, 0xDA, 0x1A, 0x6A, 0x6B, 0xA4, 0xBD, 0x39,
+    0xBA, 0x98, 0xA7, 0x8C, 0xDE, 0x98, 0x77, 0x12, 0xC5, 0x66, 0x02, 0xB1, 0x2F, 0x3F, 0x92, 0x3B,
+    0xFE, 0x84, 0xBC, 0xF8, 0xF6, 0xA6, 0x98, 0x92, 0xD6, 0x7C, 0x5D, 0x1C, 0x22, 0xBF, 0x3D, 0xA4,
+    0x6C, 0x37, 0xCF, 0x35, 0x0E, 0x3A, 0xBF, 0xBE, 0x4E, 0xE7, 0x95, 0x21, 0xEA, 0xCE, 0xD3, 0x71,
+    0xE7, 0xB3, 0x81, 0xDA, 0xF9, 0x36, 0xFC, 0xB1, 0xA7, 0xE0, 0xEE, 0x08, 0x3B, 0x8E, 0x76, 0x86,
+    0xC4, 0x36, 0x4F, 0xDE, 0xF1, 0xAD, 0xA9, 0xD6, 0x11, 0x55, 0xD4, 0x01, 0x1D, 0x9E, 0xE7, 0xB9,
+    0x4F, 0xC5, 0xB2, 0xD0, 0x2C, 0xAF, 0x33, 0xF9, 0xCD, 0x2B, 0x71, 0x3E, 0x65, 0xEE, 0xC0, 0x56,
+    0x38, 0x72, 0xAF, 0x73, 0xAD, 0x3D, 0x32, 0x77, 0x9B, 0x5B, 0xD7, 0x70, 0xEB, 0x6A, 0xAC, 0xEB,
+    0xB0, 0x31, 0xDC, 0xA9, 0xB0, 0xAE, 0x50, 0x2C, 0x2B, 0x8B, 0x91, 0x11, 0x84, 0xBD, 0x12, 0xCC,
+    0xF9, 0xF4, 0x97, 0x83, 0x1C, 0x38, 0x8B, 0x9B, 0x22, 0x0B, 0x85, 0xC4, 0x3B, 0x22, 0xF2, 0x97,
+    0x91, 0x5A, 0x80, 0x96, 0x0B, 0xAD, 0xD6, 0x5E, 0x14, 0xCF, 0x74, 0x0C, 0xED, 0xDC, 0x4E, 0xA6,
+    0x09, 0xEC, 0xBF, 0x88, 0x82, 0x42, 0x1B, 0xCD, 0x4B, 0x0A, 0x66, 0x6F, 0xE3, 0x2E, 0xEE, 0x9B,
+    0x8B, 0x79, 0xD2, 0xA1, 0xF9, 0x5D, 0x94, 0x48, 0x0E, 0x37, 0x23, 0xC5, 0x60, 0xE6, 0x1D, 0x22,
+    0x53, 0xFC, 0x2D, 0x54, 0xC6, 0x15, 0xDA, 0xF9, 0xAB, 0x18, 0xC3, 0xF7, 0x05, 0xB9, 0xFF, 0xFB,
+    0x69, 0x7B, 0x36, 0xB1, 0x7F, 0x6A, 0x6B, 0xF4, 0xAF, 0xE7, 0x46, 0xEB, 0xE1, 0x45, 0xFF, 0x14,
+    0x5E, 0x7E, 0xE0, 0x29, 0xBC, 0xB5, 0xC0, 0xC4, 0x87, 0x62, 0xE3, 0xE0, 0xEC, 0x5E, 0x3D, 0x51,
+    0x10, 0xF4, 0x59, 0xBC, 0xDB, 0x48, 0xAE, 0x98, 0x37, 0xBE, 0x5D, 0x8E, 0x2D, 0x80, 0x7D, 0x6B,
+    0x52, 0xBA, 0x56, 0xB0, 0x38, 0x28, 0x1C, 0xF9, 0xF9, 0x4B, 0x32, 0x7C, 0x7A, 0x67, 0x08, 0x05,
+    0xC7, 0x86, 0x97, 0x13, 0x44, 0xC9, 0x61, 0xF9, 0x3A, 0x22, 0x26, 0xDB, 0x17, 0x30, 0xBE, 0x1C,
+    0x4E, 0xEF, 0x63, 0x7E, 0x7E, 0xA6, 0x5A, 0xAF, 0x63, 0xF5, 0xFC, 0x60, 0xA3, 0xBD, 0x8F, 0xE4,
+    0x3B, 0x2F, 0xAF, 0x51, 0x0A, 0xAD, 0x87, 0xC2, 0xE7, 0x5F, 0x9D, 0x30, 0x60, 0x57, 0xCF, 0xD1,
+    0xB9, 0xE1, 0x83, 0x2C, 0x7C, 0x5E, 0x27, 0x61, 0x07, 0xDF, 0x9D, 0x10, 0xC4, 0xED, 0x6C, 0xAC,
+    0x17, 0x54, 0x9B, 0x7F, 0x28, 0x87, 0x2C, 0x79, 0x53, 0xA4, 0xE9, 0xBD, 0x70, 0x21, 0x3E, 0x11,
+    0x7A, 0xD9, 0x16, 0x77, 0x20, 0x6F, 0x27, 0xA9, 0x81, 0x4E, 0x99, 0x77, 0xAD, 0xE1, 0xC4, 0x53,
+    0xDF, 0x64, 0x9F, 0x0D, 0xED, 0x9B, 0x39, 0x96, 0xA3, 0xD5, 0x3A, 0x7E, 0xE6, 0x19, 0xEF, 0x6A,
+    0x10, 0x9A, 0x0E, 0xC5, 0x00, 0x66, 0x22, 0x58, 0xF9, 0xEA, 0xD3, 0xD7, 0xBB, 0xA3, 0x27, 0x9A,
+    0x0E, 0x7E, 0x48, 0x5F, 0xF0, 0x8F, 0xDF, 0xD4, 0xF2, 0x93, 0x79, 0xB7, 0xAF, 0x59, 0x30, 0x26,
+    0x9C, 0x97, 0x37, 0xC4, 0xDA, 0xDD, 0x40, 0xBA, 0x37, 0xB3, 0x95, 0xF0, 0x5D, 0x30, 0xF1, 0x23,
+    0x2E, 0x84, 0xB0, 0xAC, 0x0D, 0x39, 0x61, 0x0E, 0xFF, 0x09, 0x0F, 0x36, 0xD1, 0x91, 0x92, 0x83,
+    0x7D, 0x89, 0xAE, 0x4A, 0xB2, 0x02, 0x58, 0xF2, 0x26, 0x5B, 0x21, 0x45, 0x2C, 0x6F, 0x3E, 0xEF,
+    0x90, 0x93, 0x76, 0xAD, 0xFB, 0xBF, 0x1D, 0xFA, 0x09, 0x5C, 0xEB, 0xDD, 0xB5, 0x1E, 0x63, 0xAA,
+    0xE0, 0x7D, 0xCB, 0x46, 0x74, 0x1B, 0x1A, 0x1B, 0xB2, 0xD1, 0xE2, 0x92, 0xB1, 0xD7, 0x78, 0xE8,
+    0xC4, 0x6B, 0x60, 0x6D, 0xC3, 0xDE, 0x36, 0x96, 0x99, 0x66, 0x54, 0x4C, 0xF5, 0x41, 0xDE, 0xCA,
+    0xB0, 0xB5, 0x01, 0xC1, 0x71, 0x46, 0x85, 0x61, 0x73, 0x7D, 0xD0, 0xD3, 0xD8, 0x21, 0x1B, 0x33,
+    0x78, 0xE1, 0x7D, 0xFA, 0x93, 0x81, 0xF8, 0x5D, 0x16, 0xA9, 0x99, 0xB6, 0x9E, 0x1A, 0x56, 0xFE,
+    0xE2, 0x2D, 0x01, 0x69, 0xAF, 0x40, 0x87, 0x4C, 0x87, 0x48, 0xDB, 0x14, 0xCC, 0x7C, 0x25, 0x41,
+    0x23, 0x81, 0xEF, 0x95, 0xA0, 0x09, 0x8A, 0xF4, 0x72, 0xD0, 0x3C, 0x57, 0xA4, 0x7B, 0x41, 0xF3,
+    0xFB, 0x59, 0xFA, 0x4E, 0xB0, 0x7C, 0x39, 0x4B, 0xEB, 0x60, 0xF9, 0x0F, 0xD9, 0x2B, 0x8B, 0x60,
+    0x59, 0x65, 0xDF, 0xCA, 0x83, 0x07, 0x65, 0xF6, 0x23, 0x83, 0xB6, 0x81, 0x3B, 0x48, 0x9B, 0x67,
+    0xCD, 0xF0, 0x1C, 0xD8, 0x92, 0xC9, 0x97, 0xA1, 0xC3, 0x76, 0xC7, 0x0C, 0xDD, 0x28, 0xEA, 0x22,
+    0xBA, 0xCB, 0x37, 0x28, 0x40, 0x91, 0x99, 0x07, 0x84, 0x80, 0x3D, 0x96, 0x08, 0xDE, 0xBE, 0x15,
+    0xDB, 0x1C, 0xDD, 0x8C, 0xDA, 0x81, 0xC9, 0x4C, 0xBC, 0x5F, 0xB2, 0x81, 0x83, 0xD5, 0xD5, 0x4B,
+    0xE4, 0x7A, 0x8F, 0x71, 0x68, 0x3D, 0x3E, 0x16, 0x97, 0xFC, 0x92, 0xFD, 0xE7, 0xBF, 0xA2, 0xA2,
+    0x5D, 0x4D, 0x4E, 0xD4, 0x97, 0x15, 0xAC, 0x89, 0xDE, 0x79, 0x7B, 0x5F, 0xD3, 0x7F, 0x3D, 0xA1,
+    0xE9, 0x74, 0x15, 0x6D, 0x83, 0xD7, 0x30, 0x12, 0xC9, 0xAF, 0x98, 0x79, 0xEB, 0x8C, 0x39, 0x7F,
+    0x13, 0x82, 0x27, 0x9B, 0x2D, 0x91, 0x8D, 0x0F, 0xC1, 0x26, 0x71, 0xF0, 0xBE, 0x28, 0x95, 0xE2,
+    0x0E, 0xF2, 0x81, 0xC4, 0x90, 0x24, 0x5E, 0x62, 0x96, 0x7E, 0x9B, 0x69, 0x81, 0xDB, 0x5C, 0x9E,
+    0x81, 0xF8, 0xBF, 0xF1, 0xF1, 0x89, 0xCF, 0xF3, 0xF1, 0x31, 0x16, 0x6D, 0xEF, 0xE6, 0x93, 0xBE,
+    0x83, 0x7F, 0x5F, 0x4E, 0x4F, 0x4F, 0xAF, 0xC6, 0x27, 0x96, 0x0B, 0x0D, 0xC1, 0x0F, 0xA4, 0x65,
+    0x5A, 0x1C, 0x46, 0xB7, 0x45, 0x44, 0x28, 0x23, 0x66, 0x7E, 0xC7, 0x3F, 0x98, 0x2E, 0x3A, 0x75,
+    0x6C, 0xFB, 0x27, 0xAF, 0x67, 0xB9, 0xC3, 0xF8, 0xD0, 0xDC, 0x61, 0xC8, 0x27, 0x5A, 0x22, 0x8E,
+    0x71, 0x8E, 0xE3, 0x7E, 0x89, 0x15, 0x99, 0x6D, 0x9A, 0xCF, 0xED, 0x41, 0xFC, 0x17, 0x94, 0x6D,
+    0xEA, 0xA1, 0x6E, 0xB2, 0xA1, 0xE3, 0xD9, 0x18, 0xBE, 0x0C, 0xF5, 0xCB, 0x65, 0xFF, 0xE5, 0x36,
+    0x2D, 0xDA, 0x1E, 0xBF, 0x5C, 0x22, 0xC2, 0xF4, 0x9A, 0xBE, 0x21, 0xA1, 0xEF, 0xD9, 0x65, 0x8A,
+    0x93, 0x8D, 0xD0, 0xB5, 0x1E, 0xA7, 0x76, 0x24, 0xCE, 0xDD, 0xDF, 0x7F, 0x5B, 0x1C, 0xF6, 0x55,
+    0xF0, 0xE9, 0xB5, 0x65, 0x88, 0x87, 0x63, 0x90, 0x06, 0x41, 0xAC, 0x8D, 0xD8, 0x0B, 0x78, 0x68,
+    0x3E, 0x1C, 0x1F, 0x9D, 0x95, 0x53, 0xF0, 0xD7, 0xF2, 0x51, 0x93, 0xD4, 0x2E, 0xEA, 0xEA, 0x75,
+    0x9F, 0xBF, 0xED, 0x1F, 0x3D, 0xC8, 0x47, 0x22, 0xCD, 0xE1, 0x8F, 0x1E, 0x9C, 0x32, 0x06, 0x5B,
+    0x4A, 0xD8, 0xD0, 0xC8, 0x60, 0xFE, 0x7C, 0x8A, 0x2D, 0x9F, 0x1A, 0x83, 0xF9, 0x83, 0xB8, 0xC1,
+    0xE3, 0x1E, 0xC4, 0x3D, 0x5D, 0x0C, 0x36, 0x04, 0x84, 0xE8, 0xF0, 0x07, 0x92, 0x8F, 0x41, 0x0E,
+    0x34, 0x17, 0x9A, 0x69, 0x06, 0xF6, 0xB5, 0x05, 0x4A, 0xAD, 0x38, 0xB4, 0x41, 0x0B, 0xBD, 0x71,
+    0x20, 0xF6, 0xAB, 0x67, 0x07, 0x6C, 0xD6, 0x67, 0xA3, 0x1A, 0xFF, 0xC0, 0xF3, 0x61, 0xF9, 0x24,
+    0x4E, 0x9A, 0x6F, 0x9D, 0x07, 0x9B, 0xDD, 0x74, 0xF6, 0xE6, 0x61, 0x66, 0xF0, 0xE8, 0x52, 0xDA,
+    0xC6, 0x83, 0xC9, 0x5E, 0xEC, 0xA6, 0x55, 0xFF, 0x1F, 0xE5, 0x5B, 0xBF, 0x8F, 0xDD, 0xD6, 0x95,
+    0xBE, 0x24, 0x35, 0x43, 0xC0, 0x2C, 0xA8, 0x62, 0x04, 0xC4, 0x36, 0xD6, 0x6C, 0x52, 0x04, 0x76,
+    0x36, 0xFC, 0x07, 0x34, 0x43, 0xDA, 0x41, 0x92, 0x62, 0x8B, 0xA8, 0xD0, 0x6C, 0xB3, 0x45, 0x7A,
+    0x17, 0xAB, 0xD6, 0xC8, 0x8E, 0x45, 0x26, 0x41, 0x90, 0xC2, 0x45, 0x04, 0x2C, 0x82, 0xED, 0x36,
+    0x2E, 0x52, 0x28, 0x2F, 0x85, 0xB6, 0x70, 0x21, 0x60, 0x35, 0x26, 0xBD, 0x02, 0x36, 0x45, 0x8A,
+    0xD0, 0x02, 0x92, 0x2D, 0x52, 0x98, 0x4E, 0xEC, 0xB5, 0xB1, 0x2A, 0x4C, 0x03, 0x4C, 0x42, 0x4B,
+    0x7C, 0xBC, 0x39, 0xDF, 0x77, 0x2E, 0xDF, 0xE3, 0xCC, 0xC6, 0x4A, 0x90, 0x78, 0xEC, 0x11, 0x32,
+    0xF6, 0x5C, 0x3E, 0xBD, 0xC7, 0xC7, 0x7B, 0xCF, 0xB9, 0xE7, 0xD7, 0xF7, 0x9D, 0x3B, 0xC6, 0xC8,
+    0x8F, 0x97, 0x63, 0x34, 0x51, 0x67, 0x4C, 0x6A, 0xCB, 0xB8, 0x33, 0xBE, 0xB5, 0x83, 0xFC, 0x2B,
+    0xEE, 0x83, 0x29, 0x68, 0x4D, 0x56, 0x1B, 0xFB, 0x65, 0xF9, 0x35, 0xC6, 0xBE, 0x65, 0x82, 0xC9,
+    0x98, 0x6A, 0x30, 0xE1, 0x68, 0x4C, 0x51, 0x9B, 0x18, 0x97, 0xC6, 0x24, 0x3D, 0x2F, 0xA9, 0x3C,
+    0xA0, 0xAA, 0x4D, 0xB6, 0xBD, 0x58, 0xB9, 0xB4, 0x72, 0xC9, 0x71, 0xF1, 0xE5, 0x09, 0x72, 0xC1,
+    0x13, 0xE4, 0x82, 0x27, 0xA4, 0x98, 0xC3, 0xE0, 0x37, 0x95, 0xBB, 0xE4, 0x9D, 0xAA, 0x34, 0x72,
+    0xDB, 0xFD, 0x35, 0x96, 0x93, 0xDA, 0x86, 0xCB, 0xBA, 0x62, 0xDC, 0xCF, 0x05, 0x8E, 0xAF, 0x73,
+    0x94, 0x47, 0xED, 0x4E, 0xB9, 0x8C, 0x85, 0xED, 0x0E, 0x8C, 0x3F, 0x45, 0xE3, 0x65, 0x13, 0x0D,
+    0xC1, 0x24, 0x0F, 0xEC, 0x7C, 0x5B, 0xCA, 0x04, 0x9C, 0xAD, 0xC1, 0x58, 0xD4, 0x5C, 0x34, 0x47,
+    0x5B, 0x86, 0x6B, 0x8C, 0x91, 0xCC, 0x5E, 0x95, 0x98, 0xBC, 0xAA, 0xB1, 0xEC, 0xAC, 0x11, 0x69,
+    0x4C, 0x62, 0xE5, 0x16, 0x13, 0xD8, 0x1E, 0x53, 0xEC, 0xCD, 0xF3, 0x9A, 0x1D, 0xBD, 0x24, 0x75,
+    0x6A, 0xD7, 0xE1, 0x3A, 0x6B, 0x52, 0xD1, 0xCE, 0x98, 0xD4, 0xBE, 0x88, 0x75, 0x14, 0xD7, 0x98,
+    0xE2, 0x28, 0xCE, 0x03, 0xB9, 0xDC, 0x7E, 0x99, 0xD2, 0x59, 0x91, 0x4E, 0x66, 0xE9, 0x29, 0x92,
+    0x27, 0x4F, 0x97, 0xD9, 0x3C, 0x11, 0x30, 0x1E, 0x8C, 0xDF, 0x50, 0xDC, 0x40, 0x2E, 0x49, 0x67,
+    0x82, 0x9A, 0x3A, 0x08, 0xE5, 0x22, 0xDA, 0x8A, 0x4A, 0x2A, 0x26, 0xCE, 0xB1, 0x1C, 0x13, 0x1B,
+    0x5E, 0x12, 0xC3, 0x37, 0xF7, 0xA1, 0x90, 0xDE, 0x1B, 0xE4, 0x12, 0x5B, 0x79, 0xBE, 0x6C, 0x9A,
+    0xB5, 0xF9, 0x62, 0xF3, 0xF0, 0x73, 0x11, 0x83, 0x3F, 0x62, 0x0C, 0xC6, 0x67, 0x57, 0xE6, 0xD9,
+    0x6F, 0x8F, 0xD9, 0x24, 0xE2, 0x8F, 0xB2, 0x9A, 0xAA, 0xEC, 0x65, 0x31, 0xF6, 0x6B, 0x0D, 0xC6,
+    0x49, 0x56, 0xE4, 0xD9, 0x1B, 0xB2, 0x20, 0x2C, 0x1E, 0xDB, 0x8C, 0xE5, 0x04, 0x6B, 0xAC, 0x06,
+    0x9A, 0x49, 0x5B, 0x6C, 0x6C, 0xD6, 0xA6, 0x1C, 0xFF, 0x45, 0x66, 0xCD, 0x7E, 0xF7, 0xB3, 0xF1,
+    0xA2, 0xC9, 0xEC, 0x3F, 0x58, 0xD1, 0xF0, 0x18, 0x88, 0x86, 0x4D, 0xAE, 0xF3, 0x19, 0xB7, 0x49,
+    0x9B, 0x6D, 0xBA, 0x13, 0x74, 0xF3, 0xCB, 0x2C, 0xA9, 0xE7, 0x97, 0xA9, 0xDD, 0xDC, 0x1B, 0x8F,
+    0x9B, 0x97, 0xDE, 0x15, 0xB3, 0xFC, 0x29, 0xAC, 0x2C, 0xCA, 0x54, 0x56, 0x16, 0x58, 0x60, 0x30,
+    0x16, 0x63, 0x30, 0xF9, 0x62, 0x47, 0xA3, 0x49, 0x46, 0xA8, 0xB5, 0x68, 0x45, 0xA3, 0x45, 0x07,
+    0xD5, 0xA6, 0x9D, 0xDF, 0x1A, 0xB1, 0x12, 0x59, 0x72, 0x32, 0x04, 0x0D, 0x56, 0x25, 0x2A, 0x96,
+    0xFF, 0x4D, 0x34, 0x51, 0xCD, 0x98, 0x09, 0x32, 0x24, 0xFA, 0xB2, 0xE8, 0xD4, 0xE4, 0xE4, 0x25,
+    0x6C, 0x4B, 0x54, 0x2E, 0xF7, 0x06, 0x50, 0xA3, 0x68, 0x38, 0x91, 0x6F, 0x4E, 0xAA, 0x73, 0xB9,
+    0x07, 0xDF, 0x82, 0x81, 0x67, 0x9C, 0x8B, 0xF6, 0x5C, 0x34, 0x9E, 0x85, 0x38, 0x32, 0xD8, 0x5A,
+    0xBE, 0x25, 0x5B, 0x69, 0x4B, 0xD1, 0x5F, 0xBC, 0xC6, 0x3E, 0xDA, 0x3C, 0x5A, 0x9B, 0x74, 0x30,
+    0x11, 0xEC, 0xA1, 0xE8, 0x4D, 0xD5, 0x99, 0xA4, 0x4C, 0x65, 0xFD, 0xA5, 0x6C, 0x94, 0x6C, 0x95,
+    0x08, 0xF5, 0x0E, 0xFC, 0xCA, 0xDA, 0xED, 0x6E, 0xCD, 0x16, 0xB6, 0xEF, 0xF7, 0x4E, 0xF4, 0xF4,
+    0xEB, 0x8D, 0x93, 0x3C, 0x96, 0x65, 0xA9, 0xE0, 0xF2, 0x5C, 0x95, 0xDB, 0x78, 0x57, 0x8D, 0x8A,
+    0xAD, 0xEE, 0x0A, 0xA9, 0x77, 0x57, 0xAB, 0x9B, 0x2A, 0xB4, 0x98, 0xC5, 0xA0, 0x32, 0xC7, 0x3F,
+    0x90, 0x25, 0x53, 0xE4, 0xC4, 0x79, 0x65, 0x3C, 0x7E, 0xD1, 0x83, 0x53, 0xA8, 0xC0, 0xD3, 0x46,
+    0xDE, 0x71, 0x23, 0x6E, 0xB7, 0x91, 0xB6, 0xD9, 0x08, 0x9B, 0xCF, 0xB2, 0x4E, 0xB2, 0x56, 0x15,
+    0x75, 0x34, 0x9D, 0x93, 0xB4, 0xF3, 0x5A, 0x15, 0xB4, 0x68, 0xC2, 0x86, 0x72, 0x62, 0xB3, 0x6A,
+    0x8A, 0x09, 0x89, 0xDD, 0xC6, 0xE7, 0xB0, 0x8B, 0x40, 0x8C, 0xA6, 0x8F, 0xE4, 0xC1, 0x5E, 0xD5,
+    0x9A, 0xE3, 0x2C, 0x57, 0x2D, 0x67, 0xF4, 0x72, 0x99, 0x35, 0xED, 0xDD, 0x8B, 0x1D, 0x5A, 0x03,
+    0x62, 0x80, 0xFC, 0xEC, 0xAE, 0x6D, 0xF9, 0xD4, 0x6A, 0xF5, 0x2A, 0xF4, 0x91, 0x67, 0x62, 0xF3,
+    0x9E, 0x95, 0x09, 0x0F, 0x0E, 0x6D, 0x1D, 0x8E, 0xF2, 0xE2, 0x48, 0xD6, 0x47, 0xC3, 0xFD, 0x8F,
+    0x70, 0x92, 0xD5, 0xC0, 0x76, 0x45, 0xB6, 0xAC, 0x09, 0x46, 0x6E, 0x6C, 0x51, 0x23, 0xBE, 0x88,
+    0x20, 0x55, 0x0D, 0xE7, 0x13, 0x59, 0xC4, 0xDB, 0x07, 0xA3, 0xCE, 0x0F, 0xDD, 0x0C, 0x26, 0xB7,
+    0xA5, 0xDC, 0x98, 0x75, 0x41, 0x5D, 0x95, 0xB7, 0x3A, 0xB9, 0x31, 0x2C, 0x8B, 0x7B, 0x3F, 0xEF,
+    0x9F, 0xB7, 0x79, 0x22, 0xF3, 0x7D, 0xDD, 0xDE, 0xC5, 0x5E, 0xC5, 0xEB, 0x70, 0x0A, 0xB9, 0x69,
+    0xF9, 0x6C, 0xE1, 0x85, 0xE8, 0xD9, 0x83, 0x0F, 0x16, 0x12, 0x27, 0xE4, 0x45, 0x43, 0x8D, 0x52,
+    0x99, 0x78, 0x3C, 0x23, 0x1A, 0x26, 0x87, 0x83, 0x63, 0x93, 0x68, 0x73, 0xB4, 0x4A, 0xC6, 0x42,
+    0x7C, 0xCC, 0x17, 0x08, 0x9A, 0x54, 0x37, 0xF7, 0xB3, 0xD0, 0x18, 0xC0, 0x35, 0xF3, 0x63, 0x03,
+    0x1F, 0xCB, 0x10, 0x02, 0xB1, 0x11, 0xF8, 0x98, 0x3B, 0x22, 0x1F, 0xEF, 0xC1, 0x69, 0xB1, 0x35,
+    0x97, 0x03, 0xAB, 0xF7, 0xDD, 0xE6, 0x0A, 0xE4, 0xE3, 0x1E, 0x7A, 0x90, 0x8F, 0x83, 0x8E, 0xE1,
+    0x55, 0x16, 0x4E, 0x7F, 0x96, 0x5D, 0xB1, 0xED, 0xC6, 0xED, 0xB8, 0x14, 0x06, 0xB4, 0x7E, 0x76,
+    0xCE, 0xD9, 0x63, 0xB3, 0xD9, 0x5F, 0xAD, 0x8B, 0x2A, 0xF7, 0xDD, 0x97, 0x10, 0x2D, 0x36, 0xE1,
+    0xD0, 0x7D, 0x96, 0x35, 0xD4, 0x05, 0x2C, 0x13, 0xAA, 0x80, 0x2C, 0x5C, 0xC7, 0x53, 0xB9, 0x2A,
+    0xC2, 0x38, 0x3D, 0xA8, 0xAD, 0x9A, 0x27, 0x56, 0x74, 0x4F, 0xB1, 0xEC, 0x92, 0x4A, 0x80, 0x38,
+    0x5C, 0x81, 0x5C, 0xB1, 0x00, 0xCF, 0xAA, 0x06, 0x5C, 0x9A, 0x50, 0x3B, 0x15, 0xF9, 0x21, 0x12,
+    0xC4, 0x77, 0x1B, 0xBA, 0x87, 0x2B, 0x84, 0xC7, 0x33, 0x21, 0x3B, 0x9E, 0x09, 0xD1, 0xE5, 0x99,
+    0x94, 0x5C, 0xD4, 0x4E, 0xC1, 0xE5, 0x99, 0x94, 0x9B, 0xCA, 0x34, 0x4E, 0x97, 0x0B, 0x19, 0x8B,
+    0xFA, 0x84, 0xA8, 0x9E, 0x73, 0xCC, 0x5B, 0x6E, 0xC9, 0x55, 0xE3, 0x22, 0x54, 0x22, 0xD9, 0x62,
+    0x08, 0xC5, 0xDA, 0x46, 0x98, 0xDC, 0x20, 0xF7, 0xF9, 0x37, 0xB8, 0x03, 0x14, 0x36, 0x58, 0x7B,
+    0xAB, 0x57, 0x43, 0x89, 0x88, 0x50, 0x74, 0xD6, 0x46, 0x62, 0x83, 0x2D, 0x0D, 0x51, 0x96, 0x53,
+    0xD4, 0x49, 0xA7, 0xF9, 0x45, 0x4C, 0x4D, 0x22, 0x55, 0x2E, 0x4B, 0xB0, 0x32, 0xBF, 0x3C, 0xA2,
+    0x40, 0x98, 0x60, 0x4A, 0xAA, 0xDE, 0x14, 0x01, 0x0B, 0x0B, 0xBF, 0x1E, 0x60, 0xAA, 0x79, 0x34,
+    0x38, 0x23, 0x92, 0x54, 0x86, 0xBD, 0x69, 0xDD, 0x5A, 0x9F, 0xC2, 0x42, 0x53, 0x7C, 0x58, 0x48,
+    0xC4, 0xB1, 0x1F, 0xAA, 0x09, 0xCA, 0xAB, 0xB7, 0x69, 0x83, 0xF2, 0xE9, 0x3E, 0xF5, 0x1B, 0x42,
+    0x39, 0xD4, 0x2C, 0x5E, 0x1D, 0x51, 0xB7, 0x91, 0xEC, 0xD1, 0x6D, 0xB5, 0xC3, 0x6F, 0x88, 0x2F,
+    0xAA, 0x21, 0xCA, 0xCD, 0x1D, 0xB5, 0x92, 0x84, 0x23, 0x62, 0xAA, 0xCC, 0xF1, 0x25, 0x09, 0x39,
+    0x2D, 0x4D, 0x70, 0x5F, 0xDC, 0xAD, 0x81, 0x9E, 0xE5, 0x59, 0xF6, 0x3B, 0x0D, 0xAD, 0xF1, 0xB2,
+    0x29, 0xEE, 0xD6, 0xD4, 0xD7, 0x91, 0xC9, 0xDE, 0xAB, 0xA9, 0x31, 0x79, 0xEA, 0xC3, 0x92, 0xEA,
+    0xE8, 0x11, 0xB3, 0x68, 0x91, 0x92, 0xCA, 0xAC, 0x6A, 0x47, 0x52, 0x9C, 0xA5, 0x31, 0xF8, 0x28,
+    0x2A, 0x34, 0xE7, 0x3F, 0x30, 0x66, 0x32, 0x6A, 0x95, 0xC6, 0x1C, 0x6F, 0xAD, 0x51, 0x65, 0x56,
+    0xC3, 0xDC, 0x64, 0x90, 0xB4, 0xDD, 0xE4, 0x86, 0x4D, 0x2A, 0x99, 0x6D, 0xD3, 0xFB, 0x60, 0xB6,
+    0xE8, 0xA5, 0x75, 0xCE, 0xD9, 0x5A, 0xED, 0x13, 0x9A, 0xEA, 0x0A, 0xA7, 0xA8, 0xB6, 0x98, 0xF5,
+    0x04, 0x13, 0xA5, 0x9A, 0xCC, 0xAC, 0x25, 0xE3, 0x94, 0xF4, 0xC4, 0x2A, 0x57, 0x1D, 0x25, 0x30,
+    0x53, 0xA8, 0x88, 0x76, 0x0A, 0x0D, 0x41, 0x5E, 0x2A, 0x08, 0xE2, 0x52, 0x3F, 0xFE, 0xE4, 0xD4,
+    0x13, 0x4C, 0x4E, 0x3B, 0x30, 0x56, 0x2A, 0x07, 0xA2, 0x52, 0x37, 0x90, 0x94, 0xAA, 0x81, 0xA0,
+    0xD4, 0x0C, 0xE4, 0xA4, 0x62, 0x50, 0x69, 0x51, 0x2F, 0x30, 0x59, 0xAA, 0x85, 0x36, 0x0B, 0xAD,
+    0xCC, 0x46, 0xBB, 0xB1, 0xDA, 0xAD, 0xFC, 0xD5, 0x69, 0x1F, 0xF5, 0xE7, 0x94, 0x32, 0x9B, 0xAE,
+    0xB1, 0xF3, 0x97, 0xE6, 0x14, 0x33, 0x1B, 0x77, 0x60, 0x4F, 0x7D, 0xE5, 0xA6, 0x39, 0xFD, 0xF3,
+    0xEC, 0xCD, 0x70, 0x30, 0x2F, 0xDE, 0x94, 0xF0, 0x9C, 0x89, 0x85, 0x22, 0xE5, 0x3E, 0x64, 0xE0,
+    0x0F, 0xED, 0xB7, 0x24, 0xF2, 0xE3, 0x2A, 0x0F, 0x13, 0x59, 0xA2, 0xB5, 0x67, 0x35, 0xDF, 0xA8,
+    0x00, 0x0C, 0xC6, 0xB2, 0x7E, 0xD6, 0x11, 0xB2, 0x6D, 0x29, 0x42, 0x90, 0x88, 0x91, 0xB5, 0xB8,
+    0x4A, 0xB8, 0x6F, 0xE4, 0xCB, 0xC8, 0x31, 0xB5, 0x7C, 0x19, 0x19, 0xA6, 0x8E, 0xC7, 0x8B, 0xA2,
+    0x63, 0x09, 0xD0, 0xB6, 0x13, 0x51, 0x90, 0x60, 0x4A, 0x5D, 0xD6, 0x45, 0xEF, 0xD4, 0x32, 0x83,
+    0x53, 0xE1, 0xC4, 0x59, 0x8A, 0xEF, 0x7C, 0x34, 0x9C, 0x96, 0x45, 0xC8, 0x10, 0x42, 0x77, 0xD7,
+    0x53, 0xA4, 0x91, 0x8C, 0x9F, 0x24, 0x34, 0xB1, 0x9D, 0x45, 0xAD, 0x41, 0xCF, 0xD2, 0x78, 0x8B,
+    0x1C, 0x06, 0x95, 0x61, 0xF4, 0xEF, 0xE3, 0xCE, 0xE0, 0x67, 0x18, 0xA3, 0xEF, 0x31, 0x86, 0x73,
+    0xCA, 0x7D, 0x8E, 0x47, 0x5C, 0x86, 0x86, 0xD8, 0x16, 0x3B, 0x1E, 0x3C, 0xF8, 0x09, 0x33, 0x35,
+    0xD2, 0x43, 0xC2, 0xC5, 0x1E, 0x50, 0xD3, 0x77, 0x18, 0xDB, 0x7A, 0xEC, 0x50, 0x80, 0x14, 0x51,
+    0xA7, 0x93, 0x79, 0xCE, 0xBE, 0x53, 0x20, 0x8F, 0x0D, 0x62, 0x9F, 0x62, 0xA1, 0x71, 0x79, 0x5D,
+    0xD6, 0xFD, 0xEB, 0x01, 0x5B, 0xD2, 0x62, 0x7F, 0xB0, 0xDA, 0xC3, 0x79, 0x79, 0xBB, 0xD3, 0x57,
+    0x73, 0xE6, 0x3D, 0xE6, 0xBC, 0x00, 0x1A, 0xA6, 0x7A, 0xA9, 0x5B, 0xE6, 0x38, 0xE6, 0x37, 0xE6,
+    0x36, 0xE6, 0x35, 0xE6, 0x34, 0xE6, 0x33, 0xE6, 0x32, 0xE4, 0x31, 0xE6, 0xB0, 0x1A, 0xF9, 0xCB,
+    0xE5, 0x2E, 0x9D, 0x37, 0x97, 0x79, 0xA3, 0x7B, 0x1F, 0x33, 0xAF, 0x86, 0x73, 0xA8, 0xC2, 0xC5,
+    0xB6, 0x59, 0xE7, 0x4C, 0x63, 0xF1, 0x26, 0x30, 0x31, 0x6C, 0x33, 0x69, 0x70, 0xA0, 0xB1, 0xD2,
+    0x50, 0x69, 0xA4, 0x95, 0xAB, 0x92, 0x34, 0x85, 0xD1, 0x4C, 0xB9, 0x91, 0xA9, 0x94, 0x06, 0x62,
+    0xDE, 0x3D, 0xAC, 0x72, 0xEF, 0xC0, 0x1B, 0x92, 0x57, 0xDA, 0xC8, 0x96, 0x62, 0x92, 0xA8, 0x6B,
+    0xC4, 0xF0, 0x7E, 0x8C, 0xED, 0x92, 0x60, 0x21, 0x33, 0xCA, 0xFF, 0x32, 0x65, 0xCC, 0x82, 0x26,
+    0x61, 0x79, 0x92, 0xB6, 0x34, 0x26, 0xB1, 0xA3, 0xB7, 0x45, 0xB2, 0x52, 0x8A, 0x2E, 0x93, 0x13,
+    0x13, 0x5C, 0xC2, 0x7A, 0xC4, 0x63, 0x64, 0x69, 0x77, 0x3B, 0xE7, 0xCE, 0x46, 0xAB, 0x3A, 0x63,
+    0xAE, 0x6E, 0xB7, 0x3C, 0xB5, 0xC4, 0x16, 0x90, 0x50, 0x0B, 0xDE, 0x8C, 0xA1, 0x0C, 0xA8, 0xC6,
+    0xE1, 0x03, 0xC5, 0x34, 0x0A, 0x69, 0x14, 0xD1, 0x28, 0xA0, 0xC9, 0x36, 0xA3, 0xAD, 0x15, 0xCD,
+    0x28, 0x98, 0x51, 0x2C, 0xA3, 0x50, 0x46, 0x91, 0x8C, 0x02, 0x19, 0xC5, 0x31, 0x0E, 0xC6, 0x38,
+    0x14, 0x73, 0x45, 0x23, 0xD3, 0x9F, 0xB1, 0xF3, 0x39, 0x31, 0x0D, 0x21, 0x0D, 0x10, 0xCD, 0x1A,
+    0x80, 0x66, 0x52, 0x3C, 0x43, 0x38, 0x43, 0x34, 0xC3, 0xCC, 0x41, 0x2C, 0x43, 0x28, 0x43, 0x24,
+    0xC3, 0x44, 0x43, 0x1C, 0x43, 0x18, 0xA3, 0x28, 0x66, 0x6F, 0x51, 0x6A, 0x1E, 0xF9, 0x2C, 0x3D,
+    0xE2, 0xC6, 0x68, 0x79, 0x69, 0x58, 0x5A, 0x2E, 0x8B, 0x70, 0xE0, 0x1B, 0x49, 0x9C, 0x02, 0x6F,
+    0x6C, 0x0B, 0x74, 0xF3, 0x32, 0x37, 0xEE, 0x88, 0x61, 0xE3, 0x36, 0x6D, 0xA2, 0x67, 0x34, 0xEF,
+    0x1C, 0xB0, 0x51, 0x5C, 0x03, 0x58, 0xD3, 0x3A, 0x54, 0xA3, 0xA0, 0x46, 0x31, 0x8D, 0x42, 0x1A,
+    0x45, 0x34, 0x0A, 0x68, 0x14, 0xCF, 0x28, 0x9C, 0x51, 0x34, 0xA3, 0x60, 0xC6, 0x61, 0x19, 0x85,
+    0x32, 0x1E, 0xAE, 0x61, 0x9D, 0x4A, 0xFD, 0xDB, 0xAD, 0x67, 0xCF, 0xA4, 0xA7, 0x5F, 0x9A, 0x43,
+    0x94, 0x40, 0x9B, 0x92, 0xC8, 0x86, 0xC0, 0x06, 0x88, 0x26, 0xC7, 0x40, 0x54, 0xA3, 0xA0, 0x66,
+    0xEB, 0x2E, 0x44, 0x34, 0x04, 0x34, 0xC4, 0x33, 0x84, 0x33, 0x44, 0x33, 0x04, 0x33, 0x8A, 0x65,
+    0x14, 0xCA, 0xEC, 0x1C, 0x42, 0x11, 0x09, 0xE7, 0x7B, 0x4A, 0x0A, 0x4F, 0xB3, 0x29, 0xCF, 0x99,
+    0x82, 0x43, 0x58, 0xD7, 0x75, 0x8E, 0x5F, 0xF0, 0xCA, 0x73, 0xA5, 0xB1, 0xD5, 0x0A, 0xFB, 0x2D,
+    0x53, 0x7A, 0x87, 0xB3, 0x25, 0x85, 0xCD, 0xCB, 0x72, 0x6F, 0x2B, 0x68, 0x39, 0x6A, 0x8E, 0x71,
+    0xE3, 0xDE, 0x99, 0xEA, 0xCE, 0xFD, 0x44, 0x8C, 0xA8, 0x31, 0x33, 0x54, 0xC6, 0x77, 0x6E, 0x3F,
+    0x16, 0x1A, 0x74, 0x1E, 0x88, 0xA0, 0xE7, 0x0F, 0xD4, 0x1E, 0xC4, 0xF8, 0xF4, 0xD5, 0xB8, 0x43,
+    0x47, 0x8D, 0x9F, 0x87, 0x09, 0x06, 0xBF, 0xAA, 0xB7, 0x29, 0xF0, 0xE6, 0xE3, 0x61, 0x88, 0x37,
+    0x9E, 0x90, 0x6B, 0x7F, 0x80, 0xF5, 0xF5, 0x73, 0x4E, 0x00, 0x5C, 0x08, 0x6B, 0xA8, 0xB1, 0xF9,
+    0x74, 0xAD, 0x51, 0x0B, 0x7D, 0x86, 0x3B, 0xE3, 0x38, 0x89, 0xD7, 0x1E, 0x0F, 0x35, 0x22, 0x0E,
+    0x05, 0x2C, 0x5A, 0x58, 0xF0, 0x1C, 0x98, 0xCF, 0xC4, 0x1A, 0x9F, 0xFE, 0x08, 0x04, 0x4C, 0x1D,
+    0xFC, 0xB6, 0xE8, 0x02, 0x00, 0x1F, 0x96, 0x02, 0xEE, 0xF7, 0x69, 0x2B, 0x4F, 0xFE, 0x60, 0x8C,
+    0xC6, 0x78, 0x48, 0xBA, 0xB8, 0xCB, 0x9A, 0xA4, 0xCD, 0x6A, 0xFC, 0x57, 0x99, 0xF4, 0xF7, 0x92,
+    0xB8, 0x90, 0xF5, 0x34, 0xAD, 0x5C, 0x3A, 0xCC, 0x59, 0x59, 0x60, 0x1B, 0x5E, 0x5C, 0x95, 0x9B,
+    0xDD, 0xE9, 0x41, 0x77, 0x79, 0x23, 0x18, 0x22, 0x29, 0x05, 0xB0, 0x55, 0xAF, 0xEE, 0x9E, 0x8F,
+    0x02, 0xCD, 0x5F, 0xFD, 0x18, 0x65, 0xC4, 0x1A, 0xE1, 0x74, 0x2E, 0x20, 0xE2, 0x12, 0x34, 0x52,
+    0x3D, 0x22, 0xB8, 0x8D, 0xF0, 0xD3, 0x8B, 0x67, 0x59, 0xAA, 0x7D, 0xBC, 0xD6, 0xD4, 0x8E, 0xA3,
+    0x7E, 0x3B, 0xFA, 0x37, 0xCE, 0x87, 0xD6, 0x76, 0x57, 0x12, 0xA3, 0x22, 0x0B, 0xE5, 0x50, 0x6B,
+    0x34, 0xCD, 0xCA, 0x71, 0xB5, 0x6E, 0xD8, 0x33, 0x67, 0xAB, 0x35, 0xD8, 0x6B, 0xEE, 0xAE, 0x2E,
+    0xAC, 0x1F, 0x2E, 0xB1, 0x4D, 0x24, 0x32, 0xAD, 0x17, 0x57, 0xFF, 0xAD, 0x81, 0x1E, 0x16, 0x7E,
+    0xBF, 0x27, 0x04, 0x8C, 0xC5, 0x79, 0x71, 0xDD, 0x17, 0xF7, 0xFD, 0x3C, 0x92, 0x97, 0xAA, 0xD2,
+    0xEB, 0x14, 0x8E, 0x05, 0xB5, 0xA2, 0xB1, 0x38, 0x2F, 0x48, 0x14, 0x7F, 0x49, 0xAA, 0x59, 0x5C,
+    0x8F, 0xB4, 0xD0, 0x35, 0x1F, 0x1D, 0xF2, 0x1A, 0x58, 0x5D, 0x45, 0xF4, 0x8B, 0x7F, 0xE4, 0x2A,
+    0xA8, 0x43, 0x0F, 0xB0, 0x53, 0x24, 0x94, 0x08, 0x31, 0xA0, 0xB0, 0x0E, 0x6B, 0x9F, 0x91, 0x24,
+    0x81, 0x16, 0x6F, 0x81, 0x3F, 0xCB, 0xAC, 0x32, 0x85, 0x4E, 0x8B, 0xB8, 0x28, 0x6E, 0x39, 0x5C,
+    0x00, 0x97, 0xDD, 0xC9, 0x5C, 0x63, 0x8D, 0xFE, 0x9E, 0x48, 0x08, 0xE5, 0x35, 0xB2, 0x19, 0xD0,
+    0x11, 0x4A, 0x40, 0xD9, 0x24, 0x9B, 0x8B, 0x0A, 0x27, 0xB0, 0x0C, 0xA2, 0x44, 0x10, 0x0B, 0x12,
+    0x11, 0xAE, 0xF5, 0x04, 0x59, 0xCA, 0x81, 0xAD, 0xAF, 0x90, 0x01, 0x1B, 0x58, 0x9D, 0x67, 0x23,
+    0xF9, 0xB6, 0xFF, 0x1C, 0x45, 0xDA, 0xE2, 0xDE, 0x5D, 0x2B, 0xF1, 0x31, 0xB3, 0xCF, 0x5B, 0x70,
+    0xBC, 0x6B, 0x2D, 0x98, 0xF3, 0x05, 0xFF, 0x2E, 0x11, 0xC1, 0x92, 0xB7, 0x81, 0x72, 0x11, 0x54,
+    0x6A, 0x84, 0x33, 0x50, 0x84, 0xA5, 0x29, 0xC8, 0x01, 0xBC, 0xEC, 0x88, 0x1F, 0xA5, 0x9A, 0x94,
+    0x5E, 0x4A, 0x17, 0x36, 0x99, 0x09, 0x86, 0x46, 0x0D, 0xED, 0x55, 0x24, 0x44, 0x92, 0x81, 0x44,
+    0x24, 0x48, 0x38, 0xB1, 0xB6, 0x32, 0xED, 0x9E, 0xA8, 0x1E, 0x00, 0x26, 0xCB, 0x9B, 0x52, 0x99,
+    0x0A, 0x58, 0x97, 0x1A, 0x1A, 0xD5, 0x7C, 0xCA, 0xCD, 0xDA, 0x58, 0x4F, 0x81, 0xA7, 0xBE, 0x2B,
+    0xE2, 0x48, 0x35, 0xFF, 0x43, 0x18, 0x7D, 0xF1, 0x15, 0x79, 0xA3, 0xCE, 0xC0, 0x97, 0x95, 0x08,
+    0xFA, 0x45, 0x5E, 0x94, 0x18, 0x2B, 0xD4, 0xD2, 0x39, 0x49, 0xDD, 0xFF, 0x21, 0x80, 0x21, 0x71,
+    0x9E, 0xD0, 0x24, 0xEE, 0x70, 0x63, 0xB5, 0xFE, 0x25, 0xF5, 0x2A, 0x26, 0x43, 0x6D, 0x60, 0x47,
+    0xA3, 0x8F, 0x6E, 0x81, 0x84, 0x2A, 0x61, 0xB5, 0x95, 0x07, 0x7D, 0x54, 0xDE, 0x6A, 0x7A, 0x55,
+    0x1E, 0x26, 0xD8, 0x18, 0xEC, 0x92, 0x98, 0xC1, 0xAE, 0xFD, 0xC8, 0x6C, 0x8A, 0x7A, 0xC5, 0x55,
+    0x26, 0xBC, 0x47, 0x47, 0x73, 0xFC, 0x7C, 0x69, 0x96, 0x95, 0xFD, 0x59, 0x6A, 0xCF, 0x51, 0xB8,
+    0xCA, 0xEF, 0x3E, 0x52, 0x7B, 0x0A, 0x91, 0x95, 0xA2, 0x57, 0x76, 0x5E, 0x89, 0x79, 0x9D, 0x73,
+    0x86, 0xC8, 0x9F, 0xB2, 0x86, 0x8D, 0x1B, 0x41, 0xF4, 0xFD, 0x11, 0x0D, 0x7B, 0x39, 0xD3, 0x62,
+    0xD0, 0x6A, 0x5D, 0x39, 0x54, 0x4A, 0x83, 0x28, 0x17, 0xA0, 0xAA, 0x31, 0x97, 0xF2, 0x65, 0x17,
+    0x61, 0x90, 0x98, 0x04, 0x1C, 0x5B, 0x90, 0x44, 0x37, 0x49, 0x4B, 0x6A, 0x36, 0xCD, 0x99, 0xBA,
+    0xEE, 0x10, 0xCF, 0xFA, 0x1D, 0x11, 0x6D, 0x54, 0x13, 0xD3, 0x1E, 0x28, 0xEB, 0xC4, 0x47, 0xA6,
+    0xBF, 0xE7, 0x9A, 0x33, 0x0D, 0x21, 0xF3, 0xE5, 0x6D, 0x6E, 0x67, 0x51, 0x5B, 0x45, 0xB8, 0xC4,
+    0x23, 0xB6, 0x66, 0x6F, 0x40, 0x76, 0x43, 0x69, 0x4C, 0x34, 0x0D, 0xB4, 0x21, 0x00, 0xAC, 0x1B,
+    0x82, 0xDC, 0xB0, 0xBD, 0x47, 0x38, 0x0C, 0x11, 0xBC, 0x0E, 0xB3, 0x8D, 0xA8, 0x8B, 0x0B, 0xCC,
+    0xC4, 0x6F, 0xCD, 0x64, 0x6A, 0xA8, 0x55, 0x40, 0xE3, 0x38, 0xE1, 0x25, 0x92, 0x26, 0x88, 0x7E,
+    0x61, 0xF5, 0x23, 0xCF, 0x0A, 0xA6, 0x93, 0xE7, 0x5B, 0x01, 0x87, 0x1E, 0x78, 0x7C, 0xA9, 0x52,
+    0x83, 0xB5, 0x48, 0x15, 0x8E, 0xC7, 0x68, 0x79, 0x68, 0xD0, 0x96, 0x61, 0x0D, 0xEA, 0xAA, 0x93,
+    0x2F, 0x27, 0x08, 0x5C, 0x69, 0x07, 0x9A, 0xBB, 0x4D, 0xC0, 0xC2, 0x44, 0x36, 0x2F, 0x6A, 0xCF,
+    0xE6, 0xE7, 0x02, 0x14, 0xFB, 0x9A, 0xC5, 0xB8, 0xA9, 0x69, 0xBE, 0x85, 0x0C, 0x19, 0x1D, 0x27,
+    0x9D, 0xB6, 0x8C, 0x0F, 0x50, 0xB1, 0x80, 0x62, 0x60, 0x62, 0x40, 0x62, 0x20, 0x62, 0x00, 0x62,
+    0xE0, 0x61, 0xC0, 0x61, 0xA0, 0x61, 0x80, 0x61, 0x60, 0x61, 0xC4, 0x41, 0x20, 0x61, 0x00, 0x61,
+    0xE0, 0x60, 0xC2, 0xE0, 0xEB, 0x24, 0x20, 0x0D, 0x88, 0x21, 0xB4, 0x21, 0x80, 0x52, 0xB0, 0x3B,
+    0xAA, 0x88, 0xC4, 0x92, 0xC8, 0xE0, 0xB8, 0x8C, 0xB5, 0x8F, 0x89, 0x6E, 0x62, 0xB4, 0x7D, 0x44,
+    0xC8, 0x79, 0xE9, 0x67, 0xAA, 0x2B, 0xE6, 0x59, 0xB6, 0x72, 0xD8, 0xC6, 0x61, 0x0B, 0x87, 0xED,
+    0x9B, 0x0D, 0xB9, 0x96, 0x21, 0x5A, 0x72, 0x28, 0xE0, 0xC4, 0xC7, 0x87, 0xD7, 0x72, 0x29, 0x96,
+    0xC5, 0xE7, 0x3A, 0xF5, 0x38, 0xAC, 0x1F, 0xCD, 0x4C, 0xAF, 0x37, 0xFA, 0x60, 0x19, 0x86, 0x99,
+    0xC3, 0x53, 0xB0, 0xC3, 0x99, 0x6C, 0x7E, 0x19, 0xC3, 0x31, 0x2A, 0x0F, 0x18, 0xBC, 0xD6, 0x02,
+    0xD9, 0x83, 0x4A, 0x0A, 0x6B, 0x0B, 0x92, 0x64, 0x27, 0x9F, 0x43, 0x43, 0xD0, 0x24, 0xA2, 0xBD,
+    0x1E, 0x8D, 0x61, 0x3E, 0xAA, 0x68, 0x97, 0x01, 0xE1, 0xC5, 0xD5, 0x0A, 0x7E, 0x88, 0x40, 0x8B,
+    0x26, 0xD5, 0xFA, 0xF0, 0x75, 0x54, 0xEC, 0xBD, 0xF1, 0x6B, 0x82, 0xBC, 0x64, 0x0E, 0x55, 0x04,
+    0x05, 0xF1, 0xFB, 0x34, 0x08, 0xA8, 0xBD, 0xE8, 0x66, 0xCA, 0x8B, 0x7A, 0x0E, 0x96, 0xC3, 0xE7,
+    0xF0, 0x1E, 0xA9, 0xEB, 0x35, 0x02, 0xB0, 0x25, 0xAF, 0x79, 0x1F, 0x61, 0x4D, 0x43, 0x3F, 0x56,
+    0xE5, 0x77, 0x08, 0x57, 0x63, 0xB1, 0xF1, 0xF6, 0x6E, 0xE1, 0xED, 0x52, 0x63, 0xDE, 0x98, 0x13,
+    0xC5, 0xD6, 0xDD, 0xD5, 0xE7, 0xCB, 0x25, 0x71, 0x46, 0x26, 0x74, 0xD9, 0x6D, 0x78, 0x24, 0x2D,
+    0xB7, 0x65, 0xE4, 0x1A, 0x17, 0x3D, 0x9E, 0xB3, 0x73, 0xA0, 0xF9, 0x5B, 0x69, 0xAE, 0xAA, 0x98,
+    0x4E, 0x60, 0x47, 0x0C, 0xAB, 0x90, 0xF4, 0x99, 0xB5, 0x9A, 0xC7, 0x63, 0xD7, 0x48, 0x75, 0xF4,
+    0xBD, 0x6B, 0x8C, 0xA0, 0x91, 0xFA, 0x71, 0xFD, 0x81, 0x6D, 0xA3, 0xE0, 0x9C, 0x37, 0x52, 0x8D,
+    0x23, 0x7E, 0xB5, 0x03, 0xA4, 0x82, 0x30, 0xB7, 0x33, 0x36, 0x2C, 0x0F, 0x36, 0x9C, 0x8B, 0xD2,
+    0xC9, 0xC5, 0x38, 0x7D, 0x6C, 0x41, 0xDD, 0xF2, 0xD3, 0xA0, 0x5D, 0xAE, 0xF6, 0x5C, 0x95, 0x4E,
+    0x52, 0x09, 0x65, 0x1A, 0x12, 0x6D, 0x9F, 0xF2, 0x05, 0x10, 0x88, 0x75, 0x8E, 0x10, 0xCC, 0x59,
+    0x44, 0x75, 0x17, 0x8D, 0x73, 0x46, 0x19, 0x34, 0xB0, 0xD0, 0x09, 0x06, 0xA7, 0x50, 0x6D, 0xB9,
+    0xC0, 0x3E, 0xFB, 0x4C, 0x36, 0x23, 0x43, 0x87, 0x15, 0x9D, 0x02, 0x90, 0xF2, 0x5D, 0x60, 0xB5,
+    0xA3, 0x4F, 0xF8, 0x08, 0xF3, 0x6F, 0xF0, 0x48, 0x36, 0x79, 0x22, 0xED, 0xD6, 0x56, 0xB5, 0x6B,
+    0xD7, 0x56, 0xB5, 0xEB, 0xD7, 0x56, 0x75, 0xC2, 0x86, 0xAD, 0xDC, 0x83, 0x5D, 0x10, 0x6B, 0x4F,
+    0x1F, 0xE0, 0x46, 0x79, 0x66, 0x38, 0xFB, 0xED, 0xB6, 0x97, 0xA7, 0xC9, 0xA2, 0xEA, 0x21, 0xDA,
+    0x4F, 0xF9, 0x71, 0xF6, 0xD6, 0x0B, 0x6C, 0x8C, 0x0F, 0x0C, 0x96, 0x45, 0xC7, 0x70, 0x27, 0x65,
+    0x19, 0xCC, 0xDF, 0xD6, 0x7A, 0xC1, 0x74, 0xB4, 0x59, 0x5B, 0x72, 0x2A, 0x2D, 0x07, 0x11, 0x53,
+    0xA1, 0x87, 0x89, 0xA1, 0xD4, 0x11, 0x1A, 0x90, 0x8F, 0xBC, 0x08, 0xE5, 0x87, 0xEB, 0xC4, 0x3D,
+    0xDA, 0x7B, 0x62, 0x25, 0x2E, 0xB6, 0xD2, 0xAF, 0xD2, 0x87, 0xAE, 0x38, 0x64, 0x8C, 0x71, 0x5D,
+    0x3A, 0xE7, 0x71, 0xD5, 0x89, 0x8B, 0x3A, 0xEE, 0xD3, 0xF6, 0x7D, 0xBD, 0x7F, 0x5C, 0x5A, 0xFC,
+    0xA6, 0xA1, 0xE5, 0x50, 0x6A, 0xE6, 0x0E, 0x60, 0xD5, 0xE6, 0xB4, 0xE1, 0x6B, 0x03, 0xD3, 0xB5,
+    0x2F, 0x5D, 0xF3, 0x72, 0x6E, 0x5D, 0xBA, 0xC6, 0xA5, 0xF6, 0x76, 0x5D, 0x63, 0xD7, 0x75, 0x75,
+    0x5D, 0x4B, 0xD7, 0xF5, 0x73, 0x5D, 0x33, 0xD7, 0x75, 0x72, 0x5D, 0x1B, 0x57, 0xDB, 0x94, 0xAE,
+    0x49, 0xE9, 0x5A, 0x94, 0xAE, 0x41, 0xE9, 0xDA, 0x93, 0xAE, 0x39, 0xE9, 0x5A, 0x93, 0xAE, 0x31,
+    0xE9, 0xDC, 0x80, 0x96, 0xA2, 0x47, 0x8D, 0x78, 0x20, 0x2B, 0x61, 0x36, 0x5E, 0xB6, 0x10, 0xD9,
+    0x3F, 0x64, 0xF3, 0x90, 0x9D, 0x43, 0xB6, 0x0D, 0xB5, 0x67, 0x38, 0x9E, 0xA2, 0xA3, 0xD8, 0x27,
+    0x64, 0x93, 0x10, 0x19, 0x1E, 0xF6, 0xC1, 0xDE, 0xA0, 0x36, 0x06, 0xD1, 0x15, 0x9C, 0x8F, 0x36,
+    0xCD, 0xBE, 0x57, 0xCF, 0x5C, 0xAD, 0x09, 0xB4, 0x4C, 0x2A, 0xB7, 0xC7, 0x12, 0x98, 0x50, 0x4C,
+    0xFF, 0x12, 0xC6, 0x96, 0xFD, 0xDD, 0x8E, 0x63, 0xD5, 0x6F, 0xA3, 0x01, 0xA3, 0xA8, 0xF7, 0x01,
+    0xC6, 0xE0, 0xE7, 0x78, 0x3F, 0x7A, 0x05, 0x66, 0x9E, 0x44, 0x5B, 0x52, 0xE4, 0x36, 0xC2, 0x9F,
+    0xC7, 0x68, 0x18, 0xB0, 0xBB, 0x1B, 0xB9, 0x53, 0x39, 0x96, 0x74, 0x88, 0x92, 0x82, 0x8F, 0xA2,
+    0x43, 0x5C, 0x05, 0xC2, 0xB5, 0xDA, 0x99, 0xCE, 0x23, 0x80, 0xA1, 0x4D, 0x3F, 0x49, 0xD7, 0x96,
+    0x7F, 0x06, 0x6F, 0xCA, 0x32, 0x82, 0x12, 0x43, 0xDD, 0xCD, 0x08, 0xE0, 0x9F, 0xCF, 0x9C, 0x27,
+    0xD9, 0xD4, 0x47, 0x8A, 0x52, 0x8D, 0xBF, 0x5E, 0x12, 0xF8, 0x6E, 0x3F, 0x4F, 0x1C, 0x82, 0x7B,
+    0x8C, 0xF8, 0x93, 0x19, 0x75, 0xFB, 0x1A, 0x46, 0x22, 0x3D, 0x61, 0x90, 0x68, 0xA6, 0x3C, 0x58,
+    0x9C, 0x95, 0xFB, 0xAC, 0x49, 0x15, 0x8D, 0x06, 0x1A, 0x6C, 0x93, 0x76, 0x1B, 0x09, 0x06, 0x77,
+    0x76, 0x4A, 0x97, 0x8F, 0x63, 0x1F, 0xF6, 0xDF, 0x89, 0x45, 0xC6, 0x2D, 0x16, 0xF1, 0x89, 0x45,
+    0x42, 0x56, 0x15, 0x31, 0xB1, 0xC8, 0x65, 0x62, 0x91, 0xD7, 0x80, 0x45, 0xBC, 0x16, 0x58, 0x44,
+    0x12, 0xB2, 0xC4, 0xD6, 0x98, 0x58, 0xE4, 0xEF, 0x89, 0x45, 0x5E, 0x22, 0x16, 0xE9, 0x80, 0x45,
+    0x7E, 0x03, 0xB3, 0xCE, 0xEE, 0x83, 0x27, 0x16, 0x0D, 0x6A, 0x3D, 0xB7, 0xC1, 0x22, 0x01, 0xB1,
+    0x48, 0xF8, 0x01, 0xAC, 0x31, 0x36, 0x27, 0x0E, 0xE9, 0xD1, 0x70, 0x10, 0xE3, 0xBC, 0x69, 0x76,
+    0xC0, 0xAD, 0x59, 0x83, 0xF4, 0xF6, 0xAA, 0x1F, 0xA2, 0x86, 0x46, 0x02, 0xF8, 0x36, 0x2A, 0x77,
+    0x1F, 0xCA, 0x94, 0xE0, 0x8D, 0xCA, 0xAA, 0x8E, 0xFB, 0x7D, 0x09, 0xFC, 0xDD, 0x6D, 0x5B, 0xA6,
+    0x1F, 0xB6, 0xA2, 0xAB, 0xF7, 0xDE, 0x80, 0xBB, 0xC8, 0x7A, 0xD2, 0x35, 0x62, 0x01, 0x4E, 0xC0,
+    0xC4, 0x7D, 0x82, 0x28, 0x84, 0x7A, 0x13, 0x0F, 0xD9, 0xDF, 0xD9, 0x9A, 0xE1, 0x25, 0xC6, 0x9E,
+    0xEC, 0x15, 0x58, 0x55, 0xF2, 0x5F, 0xAC, 0xCD, 0xBB, 0x63, 0x16, 0x0C, 0x29, 0xF7, 0x74, 0xE7,
+    0x7C, 0x50, 0xA1, 0x57, 0xA1, 0xA3, 0x29, 0x45, 0xB2, 0x8F, 0x71, 0xD0, 0xEB, 0x3B, 0xC0, 0x50,
+    0x0D, 0x26, 0x98, 0x09, 0xFB, 0x33, 0x74, 0xEC, 0x4D, 0x5B, 0x37, 0xA3, 0xF3, 0x1C, 0x5F, 0xC3,
+    0x7E, 0x75, 0x61, 0xE9, 0x48, 0x88, 0xF3, 0xA0, 0x1F, 0x3D, 0xC9, 0xCB, 0xE8, 0x87, 0x50, 0x1C,
+    0xFF, 0x52, 0x6E, 0x7C, 0xC6, 0xBC, 0x84, 0xF7, 0xCF, 0x94, 0x56, 0xDF, 0xC9, 0xE1, 0x6F, 0xF1,
+    0x87, 0x04, 0x51, 0x7D, 0xC1, 0xFE, 0x0A, 0x8F, 0x89, 0x1C, 0x84, 0x6A, 0xC1, 0xF9, 0xE2, 0x20,
+    0x2A, 0x19, 0x24, 0xAB, 0x15, 0x43, 0xC6, 0x7A, 0x29, 0x61, 0xDA, 0x7B, 0x86, 0x0E, 0xFB, 0xE4,
+    0x5C, 0xB6, 0x6A, 0x5D, 0x94, 0xCC, 0xD5, 0x51, 0x4E, 0x04, 0x9C, 0xCF, 0xA5, 0x81, 0xC6, 0x3B,
+    0x4D, 0x58, 0x5A, 0x17, 0x88, 0xD4, 0x0C, 0x16, 0x48, 0xD2, 0x22, 0x9D, 0x1E, 0x8B, 0x6A, 0x59,
+    0x58, 0x35, 0x3C, 0xAF, 0x86, 0x63, 0x90, 0x57, 0x25, 0x0E, 0x8B, 0xEB, 0x8C, 0x12, 0x0D, 0x8E,
+    0xC5, 0xB9, 0x52, 0x29, 0x31, 0x77, 0xDC, 0x06, 0xEF, 0xE2, 0x2C, 0xB5, 0xED, 0xBC, 0x75, 0xDC,
+    0x87, 0x7D, 0xDC, 0xC7, 0x52, 0x9D, 0xA4, 0x6D, 0xDC, 0x65, 0x12, 0x5A, 0x8B, 0xFF, 0x06, 0x12,
+    0x12, 0x2D, 0xFC, 0x42, 0xC3, 0x3A, 0x8A, 0x98, 0xA2, 0xF6, 0x73, 0x09, 0x01, 0x39, 0xE0, 0xBD,
+    0x8F, 0x1D, 0xDE, 0xD9, 0x46, 0x3F, 0x3D, 0x36, 0x93, 0x30, 0xE6, 0x1E, 0xFC, 0x13, 0x56, 0xF7,
+    0x12, 0xAA, 0x04, 0xF9, 0xF0, 0x7C, 0xE8, 0x41, 0xED, 0x44, 0x5E, 0xC0, 0x4A, 0x60, 0x24, 0xCF,
+    0x48, 0xB1, 0x32, 0x9B, 0xC8, 0x27, 0xA0, 0x07, 0xEF, 0xEA, 0x25, 0xE8, 0xB8, 0x34, 0x53, 0x22,
+    0x25, 0x6B, 0x28, 0x73, 0xBC, 0x21, 0xB6, 0x9A, 0x5F, 0xDC, 0x1C, 0x85, 0x41, 0x7D, 0xEB, 0xAA,
+    0x44, 0x16, 0x3C, 0x08, 0xD4, 0x3C, 0xC1, 0xD8, 0xAB, 0xA4, 0xA9, 0x42, 0x5E, 0xCA, 0x08, 0x09,
+    0x21, 0x5F, 0xA5, 0xE5, 0x27, 0x27, 0x26, 0x0A, 0xD0, 0x73, 0x2F, 0x58, 0x0F, 0xA2, 0x17, 0x62,
+    0x57, 0x72, 0x57, 0xF0, 0x53, 0x2B, 0x60, 0xAA, 0xCF, 0xB6, 0x31, 0x6B, 0xF5, 0x23, 0x65, 0x2F,
+    0xF0, 0x5C, 0xE0, 0xF8, 0xE4, 0x63, 0x9E, 0x0D, 0x61, 0xDC, 0xB3, 0x8D, 0xFD, 0xAE, 0xC1, 0x59,
+    0x6E, 0xE2, 0x7B, 0x6F, 0xB3, 0x65, 0x2D, 0x05, 0x0C, 0xDF, 0x95, 0x48, 0x2A, 0xA5, 0xDE, 0x8E,
+    0x8B, 0x9D, 0x67, 0x20, 0x0F, 0xE6, 0x2C, 0x04, 0x4D, 0x0E, 0xC1, 0xBB, 0x77, 0xA2, 0x5C, 0xE2,
+    0xF4, 0x85, 0xBF, 0xF0, 0x14, 0x8F, 0x77, 0x05, 0x7E, 0x19, 0xF6, 0x00, 0x7F, 0xDE, 0x48, 0x8A,
+    0xEB, 0x3A, 0x73, 0x4A, 0xF2, 0x65, 0x56, 0x6A, 0xE6, 0x9C, 0x90, 0x72, 0x5C, 0xC7, 0xC6, 0x6A,
+    0x5E, 0x87, 0xD5, 0x7C, 0x4D, 0x52, 0xD5, 0xC2, 0x6A, 0xFE, 0x5A, 0xF2, 0x6D, 0x51, 0x6E, 0x69,
+    0xFF, 0x80, 0x8D, 0x54, 0x93, 0xFC, 0x5B, 0x47, 0xDA, 0xAC, 0x63, 0x2A, 0x3C, 0x4F, 0xDA, 0x78,
+    0xB4, 0x8F, 0x7E, 0x02, 0xDA, 0xF0, 0xAE, 0x1C, 0xB2, 0x7A, 0x56, 0xDB, 0x48, 0x49, 0x93, 0x45,
+    0xD4, 0xC9, 0x0B, 0xA7, 0x6C, 0x43, 0x89, 0x9F, 0x82, 0x95, 0x69, 0x30, 0x01, 0x2A, 0xE1, 0x78,
+    0x54, 0x8D, 0xA5, 0xE3, 0x14, 0x3D, 0x47, 0x24, 0x0A, 0x19, 0x7B, 0x28, 0x37, 0xE9, 0x68, 0xCC,
+    0x3C, 0x20, 0x9D, 0x3D, 0x20, 0x67, 0x45, 0xAE, 0x3F, 0x7B, 0x53, 0x0F, 0x5C, 0x33, 0x74, 0xD4,
+    0x6A, 0xFF, 0x20, 0x73, 0x98, 0x5C, 0xC0, 0xF2, 0x13, 0xB6, 0x26, 0xA2, 0x1F, 0xFB, 0x7E, 0x84,
+    0x48, 0x33, 0x7A, 0x55, 0x89, 0xD4, 0x82, 0xC4, 0xC2, 0xB4, 0x82, 0xA4, 0x82, 0x94, 0xE2, 0x12,
+    0xCA, 0xB3, 0x37, 0xA3, 0x3E, 0x1B, 0x8B, 0x31, 0x1C, 0x1F, 0x8E, 0xE1, 0xF4, 0x86, 0xD4, 0x42,
+    0xA6, 0x8F, 0x26, 0x93, 0xC7, 0xCE, 0xFD, 0x66, 0xD7, 0x9B, 0xDD, 0xEE, 0x84, 0xEB, 0x95, 0x8F,
+    0xB2, 0x88, 0xCB, 0xA7, 0x2D, 0xE2, 0x33, 0xD5, 0xC1, 0xE6, 0x2C, 0x66, 0x2A, 0x5F, 0x3E, 0xF8,
+    0x46, 0x6D, 0x5E, 0x0B, 0x10, 0xE4, 0x3F, 0x19, 0x1D, 0xB8, 0xD2, 0xEF, 0xA7, 0xAC, 0x37, 0xEF,
+    0x91, 0x87, 0xED, 0x88, 0x3C, 0x07, 0x96, 0x7E, 0x7B, 0x3B, 0xE7, 0xE9, 0x0C, 0x1B, 0x8D, 0x36,
+    0x18, 0x0B, 0x79, 0xBD, 0x46, 0x93, 0x2D, 0x8B, 0x40, 0x2B, 0x7C, 0x0B, 0xF8, 0xCE, 0x05, 0x8A,
+    0x33, 0x3B, 0xF9, 0x72, 0x71, 0x7B, 0xCC, 0x57, 0x79, 0xEC, 0x3F, 0x9E, 0xD9, 0xCF, 0xC7, 0xA9,
+    0x2B, 0xCF, 0x25, 0x2C, 0x79, 0x1B, 0xE7, 0x21, 0xDF, 0xBD, 0x03, 0xB4, 0xB3, 0x8F, 0xE4, 0x7C,
+    0xE1, 0xCC, 0xCF, 0x07, 0xF9, 0xA0, 0xC8, 0xD2, 0x87, 0xE0, 0x88, 0x72, 0xB1, 0x34, 0x09, 0x7A,
+    0x8D, 0x27, 0xCF, 0xA8, 0x05, 0x34, 0x3E, 0xA9, 0x8C, 0xBB, 0x63, 0xA4, 0x07, 0x12, 0x6F, 0x04,
+    0x61, 0xED, 0xDC, 0xAD, 0x60, 0xF3, 0x51, 0xB2, 0xD7, 0x2E, 0xA3, 0x65, 0x8E, 0xF6, 0x44, 0x2E,
+    0xDF, 0xAE, 0x6A, 0x9F, 0x5C, 0xC6, 0x60, 0x92, 0xE9, 0x16, 0xE2, 0xE9, 0xB4, 0xE4, 0xFC, 0x15,
+    0xDC, 0xBD, 0x3E, 0x1F, 0xEB, 0xF1, 0xBA, 0x8D, 0x22, 0x9E, 0x96, 0x40, 0x69, 0xAB, 0x36, 0x18,
+    0xE2, 0x2E, 0xEA, 0xC2, 0x2E, 0xEA, 0x83, 0x86, 0x7F, 0xF5, 0x63, 0xC1, 0x44, 0x22, 0x76, 0x5B,
+    0xF8, 0x3D, 0xDD, 0xE1, 0x40, 0x62, 0x7C, 0x21, 0xCB, 0x2C, 0xF2, 0xAC, 0xCC, 0xFE, 0x77, 0x92,
+    0xB7, 0x17, 0x69, 0x63, 0xAD, 0xC7, 0xD7, 0xC0, 0x48, 0xA2, 0xA2, 0xDD, 0x71, 0x50, 0xDD, 0xE6,
+    0x31, 0xB9, 0xF1, 0xB8, 0x2C, 0xEA, 0x54, 0xF6, 0x45, 0x10, 0x98, 0x01, 0x1E, 0x7C, 0x06, 0x8C,
+    0x50, 0xF9, 0x77, 0x73, 0xCB, 0x45, 0x4F, 0x5D, 0x6B, 0x0F, 0x46, 0x2D, 0xC8, 0x31, 0x84, 0xEB,
+    0x6D, 0xB7, 0x29, 0x1A, 0xB7, 0x8C, 0xED, 0x89, 0x92, 0x6F, 0x0B, 0x27, 0x76, 0x29, 0x75, 0xBC,
+    0xFD, 0x43, 0xA7, 0x13, 0xE2, 0xBB, 0xBF, 0xDF, 0x1B, 0xCD, 0xAC, 0x81, 0x25, 0xDD, 0x05, 0xAE,
+    0x0A, 0x5D, 0x99, 0x04, 0xAC, 0xDD, 0xFF, 0xF1, 0x19, 0x3B, 0xF6, 0x07, 0x5C, 0x18, 0x7E, 0x7D,
+    0x25, 0xEE, 0xFE, 0x7F, 0xFD, 0xE2, 0x6A, 0x98, 0x78, 0xFC, 0x3C, 0xF5, 0x41, 0xCA, 0x68, 0x6F,
+    0x4B, 0x68, 0xA0, 0x96, 0x00, 0xA1, 0xB1, 0x7F, 0x92, 0xD0, 0xC0, 0xA6, 0x46, 0x53, 0x85, 0x43,
+    0xB3, 0xE0, 0x9C, 0x78, 0x90, 0x16, 0xCF, 0xCC, 0x5C, 0x5F, 0xA5, 0x77, 0x7F, 0x7F, 0x40, 0x02,
+    0xFF, 0x1A, 0xFF, 0xB2, 0x02, 0x24, 0xE1, 0xBF, 0xDA, 0x0D, 0xBD, 0x57, 0x6D, 0xDA, 0xB5, 0x55,
+    0xB3, 0x3C, 0xF8, 0xCC, 0x6F, 0x84, 0x3C, 0xF3, 0x3C, 0x38, 0x4E, 0xE7, 0x1A, 0xE3, 0x22, 0x1A,
+    0x30, 0x37, 0x36, 0xA9, 0xD3, 0xAB, 0xDE, 0x91, 0x69, 0x1E, 0x22, 0x6F, 0x97, 0x28, 0xB3, 0x91,
+    0x62, 0xAF, 0xE3, 0x29, 0x4F, 0xBA, 0x06, 0xD0, 0xCC, 0x14, 0x82, 0x1B, 0xD8, 0xC5, 0x5B, 0x89,
+    0x40, 0x1B, 0x73, 0x21, 0xDA, 0x76, 0xA5, 0x4E, 0xF6, 0x83, 0x48, 0x7F, 0xB3, 0x1F, 0x57, 0xD1,
+    0x54, 0x73, 0x99, 0x02, 0x7F, 0xBC, 0x87, 0x7E, 0xD9, 0x37, 0xF3, 0x13, 0x7F, 0xA9, 0xD7, 0xF3,
+    0x94, 0xBC, 0x39, 0x26, 0xFE, 0x71, 0xE7, 0xE4, 0xDD, 0x41, 0xF9, 0x13, 0x27, 0xE5, 0x1D, 0x85,
+    0x7C, 0x4D, 0x09, 0x64, 0x47, 0x1F, 0x3B, 0xF2, 0xD8, 0x51, 0xC7, 0x8E, 0x38, 0x76, 0xB4, 0xB1,
+    0x23, 0x8D, 0x1D, 0x65, 0x4C, 0xC2, 0xD8, 0x28, 0x5D, 0x6C, 0x94, 0x2C, 0x76, 0x54, 0xB1, 0x23,
+    0x8A, 0x1D, 0x4D, 0xEC, 0x48, 0x62, 0x06, 0x7B, 0x96, 0x9B, 0x33, 0x67, 0x0B, 0x55, 0x4A, 0xC1,
+    0xF9, 0x9C, 0xD6, 0x9C, 0x3C, 0xA0, 0xAE, 0x22, 0xF0, 0x98, 0x3F, 0x4F, 0xF9, 0x73, 0xF1, 0x5C,
+    0xFA, 0xBC, 0xF0, 0x3F, 0xD9, 0x4C, 0x5F, 0xCB, 0xA7, 0x92, 0xA5, 0x7C, 0xFB, 0x4D, 0x10, 0x8C,
+    0x0D, 0x5A, 0x4E, 0x25, 0x8F, 0xA2, 0xEB, 0x99, 0xEA, 0x7C, 0x19, 0x5E, 0xC4, 0xB9, 0xE3, 0x6E,
+    0x1B, 0x63, 0x80, 0x3F, 0x05, 0xFB, 0x5E, 0x14, 0x10, 0x2A, 0xEB, 0xA9, 0x75, 0x96, 0x0B, 0xE6,
+    0x0F, 0x65, 0x55, 0x3F, 0x6C, 0xDC, 0x54, 0x18, 0xFF, 0xD9, 0x97, 0xD4, 0x69, 0xDC, 0xC6, 0x27,
+    0xB8, 0x93, 0x50, 0xD3, 0x9E, 0x3B, 0x30, 0x54, 0xA1, 0x17, 0x67, 0xE8, 0x10, 0x24, 0xFB, 0xDE,
+    0x1B, 0x90, 0x18, 0xB9, 0x81, 0xA8, 0x12, 0x1D, 0x9A, 0x81, 0xA9, 0x14, 0x7A, 0x43, 0x86, 0x03,
+    0x5D, 0x73, 0x66, 0x62, 0xBD, 0x05, 0xB1, 0x66, 0x60, 0x80, 0x43, 0x22, 0x1D, 0x8C, 0x54, 0xA4,
+    0xA4, 0x7E, 0xA2, 0x12, 0x42, 0x9D, 0xBC, 0x33, 0x60, 0x4A, 0x07, 0xD8, 0x1E, 0x92, 0x07, 0x53,
+    0x39, 0xF7, 0xF8, 0x3E, 0x3B, 0x09, 0xAA, 0x38, 0x3F, 0xBF, 0xF3, 0xB3, 0xBF, 0x7F, 0xEF, 0xFB,
+    0x7E, 0xDF, 0xEF, 0x75, 0xA5, 0x50, 0x7E, 0xEE, 0x68, 0x94, 0xE8, 0xA0, 0x2B, 0x61, 0x64, 0xEB,
+    0x04, 0xAE, 0x46, 0x20, 0x69, 0x0D, 0x7E, 0x93, 0x66, 0xB6, 0xD1, 0xEE, 0xF3, 0x22, 0x90, 0x47,
+    0x9D, 0xFA, 0x9D, 0x57, 0xAC, 0x89, 0xC5, 0x64, 0xDF, 0x94, 0xDA, 0xD7, 0xB0, 0x64, 0x60, 0x72,
+    0x61, 0xF2, 0xEE, 0x8E, 0x14, 0x26, 0xA3, 0x41, 0x0F, 0x6D, 0xB4, 0x43, 0xE8, 0xE0, 0x76, 0xE6,
+    0x1B, 0xE5, 0x2C, 0x80, 0x21, 0x96, 0x21, 0x54, 0x9A, 0xA5, 0x6A, 0x83, 0xD4, 0x21, 0xEC, 0x62,
+    0xDA, 0x2A, 0x69, 0xF4, 0xAD, 0x1C, 0xF0, 0xF5, 0xA0, 0x6A, 0x1F, 0xA1, 0x72, 0x72, 0x0F, 0xAB,
+    0xB8, 0x20, 0x45, 0x91, 0x84, 0xFA, 0xA6, 0x0E, 0xA7, 0xA5, 0x3B, 0xC3, 0xFB, 0xCB, 0xD2, 0xAE,
+    0x44, 0xEC, 0xE8, 0x05, 0xBC, 0x9F, 0x0A, 0x0C, 0x9C, 0x0C, 0x1D, 0x8B, 0x0D, 0x0E, 0x8F, 0x6C,
+    0x2D, 0x7C, 0xE5, 0x1B, 0x78, 0x15, 0xAC, 0x21, 0x59, 0xF5, 0xB1, 0x89, 0x3E, 0x22, 0x84, 0xEC,
+    0xC2, 0xF7, 0x64, 0xCF, 0xC3, 0xA6, 0x8F, 0x68, 0x13, 0x61, 0x1F, 0x5D, 0x92, 0x08, 0x9E, 0x96,
+    0xF0, 0x7E, 0xAF, 0xD0, 0xD2, 0xFB, 0x40, 0xE5, 0xCB, 0xDA, 0xD0, 0x01, 0xEC, 0x92, 0x47, 0x5B,
+    0xCB, 0xC7, 0x76, 0xB6, 0x7F, 0x47, 0x09, 0x03, 0xB7, 0x44, 0xF3, 0xB3, 0x8D, 0xF4, 0x8C, 0x0A,
+    0xBE, 0xCA, 0x69, 0x33, 0x6D, 0xF2, 0xF9, 0x61, 0xAB, 0xF0, 0x65, 0x84, 0x87, 0x48, 0xA5, 0x51,
+    0xA9, 0x0A, 0x58, 0x24, 0xF7, 0x4A, 0xAF, 0x72, 0x2A, 0xAB, 0xB4, 0x74, 0x2B, 0x13, 0x72, 0x8F,
+    0xDE, 0xB9, 0x71, 0x90, 0x4F, 0xF3, 0x54, 0x1D, 0x63, 0x42, 0xC1, 0xF8, 0xB1, 0x1D, 0xB3, 0x9C,
+    0xFB, 0x3F, 0xB9, 0x2E, 0xA6, 0xCA, 0xCF, 0x1C, 0x6D, 0x71, 0xE6, 0x77, 0xC8, 0x1B, 0x9C, 0x12,
+    0x7E, 0x86, 0x01, 0xD0, 0x06, 0x2C, 0x65, 0x93, 0x8F, 0xDB, 0x71, 0x4B, 0x02, 0x97, 0x71, 0x15,
+    0x81, 0x8E, 0x86, 0xB7, 0x9A, 0xB8, 0x84, 0xA1, 0x30, 0x15, 0x5C, 0x1A, 0x31, 0x3C, 0x09, 0x8F,
+    0x37, 0x8F, 0x8B, 0x54, 0x0A, 0x4F, 0xFB, 0x85, 0xAB, 0x5B, 0x7A, 0x9D, 0x9C, 0xD3, 0x4F, 0xBA,
+    0x6A, 0x53, 0x86, 0x14, 0x44, 0x00, 0x97, 0x56, 0x36, 0x99, 0x7C, 0xEB, 0x85, 0x28, 0xBA, 0xC3,
+    0xA9, 0x76, 0xB1, 0x46, 0x66, 0x1D, 0xBA, 0xD2, 0xFC, 0x70, 0x76, 0x19, 0x2B, 0x24, 0x9E, 0x96,
+    0xDD, 0x21, 0x99, 0xE9, 0x51, 0x1A, 0x49, 0x69, 0x50, 0x0A, 0x7D, 0x85, 0x42, 0x1F, 0x23, 0xC1,
+    0x23, 0x14, 0x30, 0x79, 0x9A, 0x5D, 0x91, 0x16, 0x82, 0x6C, 0x9A, 0x4F, 0x33, 0x82, 0x07, 0x08,
+    0x23, 0x95, 0xF8, 0x9C, 0x47, 0x0F, 0xC9, 0x85, 0x59, 0x50, 0x8E, 0xFB, 0xC9, 0xB5, 0x71, 0x5F,
+    0x54, 0xAB, 0x33, 0x02, 0x89, 0xF6, 0x28, 0x43, 0x51, 0x0D, 0x18, 0xE4, 0x76, 0x69, 0x3D, 0x81,
+    0xC0, 0x54, 0x54, 0x22, 0xB7, 0x73, 0x5F, 0x0E, 0x70, 0x8C, 0x14, 0xA2, 0xF2, 0x0B, 0x44, 0xE1,
+    0xE4, 0x71, 0x12, 0x98, 0x85, 0x30, 0x8B, 0x10, 0xFD, 0x11, 0xAE, 0xEE, 0xD6, 0xC1, 0x6C, 0x8D,
+    0xB6, 0x46, 0x3A, 0x17, 0xA9, 0x5A, 0x5A, 0xA6, 0x74, 0x0C, 0x27, 0x54, 0x6E, 0xAF, 0x2E, 0xF7,
+    0x49, 0x5D, 0xEE, 0x2E, 0x2C, 0xC2, 0x96, 0xC9, 0xFC, 0xA7, 0x54, 0xCE, 0x82, 0x00, 0xC7, 0x98,
+    0xB3, 0xF2, 0xC1, 0x1D, 0x15, 0x98, 0xD8, 0x3D, 0x61, 0x88, 0xD0, 0x8F, 0xC0, 0x17, 0x18, 0x39,
+    0xB8, 0xAB, 0x92, 0x96, 0x1A, 0x42, 0xD2, 0x05, 0xA7, 0x72, 0xA9, 0xAA, 0x87, 0xD8, 0x4C, 0x4F,
+    0xB0, 0x5D, 0x97, 0x5A, 0x52, 0x42, 0xB3, 0xA9, 0x51, 0x04, 0xDC, 0x26, 0xBB, 0x46, 0x4D, 0xE9,
+    0xE6, 0xE7, 0xC0, 0x30, 0xA4, 0x9B, 0xE7, 0xEE, 0xCE, 0x0E, 0x52, 0x63, 0xE2, 0x1D, 0xFA, 0x67,
+    0x43, 0x54, 0x50, 0xF8, 0xE6, 0x13, 0x0C, 0xD2, 0x0A, 0x7B, 0xB4, 0x0F, 0x7E, 0x49, 0x32, 0xA9,
+    0x59, 0xCC, 0xE7, 0xDF, 0xD2, 0xC3, 0xCE, 0x0E, 0x59, 0x31, 0x8B, 0x7B, 0xF3, 0xF9, 0xFC, 0x9B,
+    0xBA, 0x6C, 0x97, 0x81, 0x27, 0x70, 0x0B, 0x42, 0x4F, 0x3D, 0xE1, 0xF1, 0x29, 0xCC, 0x60, 0xF1,
+    0xE4, 0xB2, 0x73, 0x8F, 0x9F, 0x22, 0x9E, 0xC6, 0x3C, 0x69, 0x46, 0x58, 0xC6, 0xFB, 0x50, 0x67,
+    0x1F, 0x37, 0x79, 0xAA, 0x21, 0x9E, 0xB0, 0x26, 0x4B, 0xB4, 0x54, 0x0D, 0xBA, 0x57, 0xD4, 0x27,
+    0xE7, 0xEA, 0xF9, 0xB9, 0x3A, 0x3B, 0xE8, 0x9D, 0xAB, 0x9F, 0x7B, 0xC7, 0x12, 0xA1, 0xC7, 0x95,
+    0xAD, 0xD8, 0x89, 0x03, 0x72, 0x7B, 0x03, 0xAB, 0xDB, 0x58, 0x23, 0x94, 0x4F, 0x4D, 0x75, 0x6F,
+    0xFE, 0xCD, 0xEA, 0x7C, 0x2E, 0xD7, 0xE6, 0xDF, 0xC9, 0xAB, 0x68, 0xE1, 0x26, 0xA1, 0x65, 0x30,
+    0x3F, 0xC4, 0xC6, 0xFC, 0xDB, 0xBA, 0xC7, 0x7E, 0xCD, 0xDE, 0xFE, 0xF1, 0xD1, 0x68, 0x34, 0xA2,
+    0xFA, 0xAC, 0x5C, 0xF7, 0x73, 0xAA, 0xB7, 0xDA, 0x52, 0xA7, 0xB0, 0xA3, 0x30, 0x36, 0x29, 0x1E,
+    0xBE, 0x8E, 0x9A, 0xE4, 0x49, 0x4E, 0x24, 0xFF, 0xB3, 0x2E, 0x27, 0x92, 0x6E, 0xD9, 0x95, 0x22,
+    0xF3, 0x74, 0xAB, 0x20, 0xA1, 0x25, 0xEA, 0x01, 0x8B, 0x7A, 0xA0, 0x82, 0x97, 0x13, 0x54, 0x6A,
+    0xE0, 0xFC, 0x2F, 0xCD, 0xBA, 0x7E, 0x49, 0x6C, 0x12, 0x0B, 0xB5, 0x1E, 0xBB, 0xF2, 0x21, 0x1B,
+    0xBB, 0xC0, 0xC1, 0x28, 0x88, 0xE0, 0x50, 0xA6, 0x82, 0x78, 0x26, 0x12, 0x71, 0x7F, 0xBB, 0x57,
+    0x77, 0xD1, 0xF2, 0x30, 0xC8, 0x44, 0x26, 0x94, 0x28, 0x28, 0x3E, 0xF2, 0xE7, 0x1B, 0x43, 0xE8,
+    0xF6, 0x40, 0x5B, 0xC4, 0x9B, 0x84, 0x75, 0x5A, 0xE7, 0x54, 0xE4, 0xFC, 0xB4, 0xC0, 0x72, 0xFA,
+    0x5F, 0x8C, 0x9E, 0x27, 0x7D, 0xA2, 0x10, 0x0F, 0x91, 0x8F, 0x70, 0x13, 0x53, 0x9D, 0xE6, 0xAD,
+    0x8C, 0x2E, 0xD5, 0xD4, 0x2C, 0x83, 0x63, 0x9E, 0xC6, 0xBE, 0xF9, 0x4D, 0x0E, 0xD2, 0x05, 0xF6,
+    0xA6, 0x65, 0x93, 0xEF, 0x1A, 0x75, 0x54, 0x0B, 0x4F, 0x35, 0xF7, 0xAA, 0x84, 0xF5, 0xB5, 0x13,
+    0x33, 0xE2, 0x08, 0xE3, 0x08, 0xD7, 0x0B, 0xEC, 0xB2, 0xCC, 0x80, 0x93, 0x40, 0x37, 0x71, 0x51,
+    0xD3, 0x22, 0x54, 0xAA, 0xD2, 0x21, 0x64, 0xDE, 0x6D, 0xE4, 0xFC, 0x0A, 0x6D, 0x6B, 0x06, 0x7B,
+    0xB6, 0x4C, 0x04, 0xD7, 0x23, 0x50, 0x56, 0x18, 0x93, 0x8F, 0x5D, 0x37, 0x83, 0x65, 0x61, 0xED,
+    0x4E, 0x43, 0x02, 0x58, 0x59, 0x69, 0x74, 0x5D, 0x66, 0xF1, 0x9A, 0x02, 0x23, 0x62, 0x15, 0xDA,
+    0x6F, 0xD6, 0xCC, 0x23, 0xFE, 0x48, 0xF3, 0x32, 0xCD, 0xBB, 0x78, 0xB6, 0x85, 0x19, 0x56, 0xE4,
+    0x6B, 0xF4, 0xEE, 0x12, 0xD5, 0x13, 0x1C, 0xCA, 0x10, 0xBB, 0x34, 0x1F, 0xCC, 0x4E, 0x25, 0x09,
+    0x6D, 0x5B, 0xD9, 0x88, 0xF6, 0xDF, 0xCE, 0x46, 0xFC, 0x35, 0x63, 0x99, 0x03, 0x50, 0x4B, 0xDA,
+    0xAC, 0x25, 0x5F, 0x07, 0xAE, 0x5B, 0xCF, 0x6E, 0x21, 0x6E, 0x6C, 0x36, 0x5A, 0x9F, 0xC5, 0x1B,
+    0xF1, 0x06, 0x79, 0x9C, 0x52, 0xAE, 0x25, 0x01, 0x33, 0x88, 0x9D, 0x5C, 0x48, 0x6E, 0x09, 0xA2,
+    0x73, 0x39, 0x26, 0xFA, 0x48, 0x28, 0xAE, 0x95, 0x73, 0x4E, 0xCD, 0x82, 0x77, 0x99, 0x53, 0x19,
+    0x83, 0x55, 0x3D, 0x76, 0xD1, 0x96, 0x9F, 0xE6, 0x81, 0xF2, 0xE3, 0xFD, 0xFC, 0xFA, 0x0C, 0xD7,
+    0x2F, 0xE8, 0x54, 0xA6, 0x72, 0x3D, 0xC7, 0x68, 0x46, 0x3D, 0xE3, 0x6B, 0x57, 0xEF, 0xCB, 0x03,
+    0x0A, 0x75, 0x76, 0x0C, 0xED, 0x3F, 0x2F, 0xDC, 0x3F, 0xCA, 0x7D, 0xE7, 0xFE, 0x81, 0xB7, 0x76,
+    0x11, 0x5E, 0xDC, 0x52, 0x2D, 0xE5, 0x28, 0x41, 0xE5, 0x24, 0x58, 0xD4, 0xDC, 0x74, 0x85, 0xC2,
+    0xEF, 0x66, 0xD1, 0x2F, 0xEE, 0xC9, 0x34, 0x7F, 0x7D, 0xE2, 0xBC, 0x43, 0xE9, 0xF9, 0x22, 0x1B,
+    0x2C, 0x92, 0xBD, 0xED, 0xED, 0xBD, 0x5B, 0xDB, 0xD1, 0x71, 0xE2, 0xFD, 0x9A, 0x5F, 0x25, 0x08,
+    0x08, 0xBD, 0x91, 0x23, 0x43, 0xDC, 0xA4, 0xB0, 0xEE, 0xA7, 0x3C, 0xAA, 0x7B, 0x89, 0x58, 0xD8,
+    0x3A, 0x41, 0xCB, 0xD4, 0xC8, 0x78, 0x60, 0xFE, 0x39, 0x6B, 0x95, 0xBA, 0x74, 0x07, 0x93, 0xBA,
+    0xE9, 0x98, 0x01, 0x1F, 0xC0, 0x7D, 0xB9, 0xF3, 0x51, 0x49, 0xB8, 0x25, 0x3C, 0x13, 0xDA, 0xE6,
+    0xB3, 0x9A, 0x3F, 0x8C, 0xE6, 0xD6, 0xD7, 0x4C, 0x02, 0x74, 0x3A, 0x1A, 0x53, 0x88, 0xB3, 0xE5,
+    0xF0, 0xAC, 0xE5, 0xCD, 0x5F, 0x8C, 0x13, 0xD7, 0x90, 0x6D, 0x1F, 0xC1, 0x97, 0xD4, 0x0B, 0x27,
+    0xD4, 0xB4, 0x56, 0x6A, 0x0A, 0x66, 0x2E, 0xEB, 0x1E, 0x23, 0xF0, 0x83, 0x05, 0x99, 0xC3, 0x3A,
+    0xE9, 0xD2, 0xCA, 0xBC, 0x9C, 0x1B, 0x0D, 0xE7, 0x05, 0xE5, 0xB4, 0x6A, 0x58, 0x60, 0xD0, 0x00,
+    0x67, 0xB9, 0x36, 0x28, 0xD9, 0xBA, 0xAA, 0xFD, 0xF0, 0xC4, 0xA4, 0x61, 0x9F, 0xBA, 0x92, 0xBD,
+    0xC9, 0x76, 0x98, 0x8C, 0x75, 0xF2, 0x77, 0xF1, 0x90, 0xFB, 0x65, 0xE8, 0x4C, 0xAE, 0xDD, 0x8C,
+    0x12, 0x3A, 0x29, 0x97, 0x3C, 0x06, 0x7E, 0xEF, 0x62, 0x27, 0x0A, 0xC3, 0x71, 0xB2, 0x4F, 0xC4,
+    0xDA, 0x9B, 0x84, 0x7D, 0x62, 0xF1, 0x30, 0x49, 0x02, 0x32, 0xD1, 0x59, 0x42, 0x44, 0x67, 0x41,
+    0xC8, 0x63, 0x3C, 0xC6, 0x0F, 0x25, 0x1E, 0x0E, 0x6A, 0x9B, 0x43, 0xF7, 0xFE, 0xB5, 0x15, 0x3E,
+    0x58, 0x4E, 0x4D, 0x08, 0xF4, 0xAC, 0x8F, 0x5F, 0x75, 0x43, 0xE0, 0xA7, 0x3E, 0x70, 0xDF, 0x87,
+    0x77, 0x08, 0xEF, 0x3D, 0xD0, 0x69, 0xDC, 0xEF, 0xF1, 0x51, 0x1C, 0xFA, 0x9C, 0xEF, 0x4E, 0xA7,
+    0x83, 0xC1, 0xF1, 0x11, 0xA2, 0x88, 0x8D, 0xB3, 0x75, 0x3A, 0x66, 0x92, 0xC7, 0xD0, 0x8F, 0xF6,
+    0xD1, 0xED, 0xF8, 0xDF, 0x7B, 0x2B, 0xA7, 0xA7, 0x10, 0x85, 0xEF, 0xCA, 0x60, 0x78, 0xB6, 0xE2,
+    0xA4, 0x77, 0x96, 0xC2, 0x9B, 0xFD, 0x4B, 0xD7, 0xDE, 0xE8, 0x6D, 0x79, 0x33, 0x26, 0xB5, 0x65,
+    0x4B, 0x3A, 0x3F, 0xC3, 0xFE, 0x93, 0x1B, 0xD0, 0x2E, 0x70, 0x71, 0x82, 0x1B, 0x03, 0xFC, 0x0B,
+    0xDD, 0x7D, 0x4F, 0xB0, 0xDE, 0xD6, 0x75, 0xDF, 0x05, 0x20, 0x3E, 0xD4, 0xFC, 0xA6, 0x02, 0x17,
+    0x8C, 0xE3, 0x8A, 0x35, 0xD1, 0x85, 0x27, 0x93, 0xA1, 0x24, 0x22, 0x0B, 0x2F, 0xDC, 0xF4, 0x3D,
+    0x02, 0x92, 0xD2, 0x68, 0xE1, 0x85, 0x39, 0x19, 0xB3, 0x9A, 0x89, 0x67, 0x6A, 0x6F, 0x32, 0xD3,
+    0x3A, 0xD3, 0xBC, 0x2C, 0xB2, 0x50, 0x13, 0x4A, 0x80, 0xEC, 0x4C, 0xB3, 0xF0, 0x42, 0x5C, 0xB4,
+    0x2B, 0x2F, 0xC2, 0x85, 0x3A, 0x43, 0x3D, 0x4F, 0x43, 0x4F, 0x47, 0x99, 0xB2, 0x53, 0x4A, 0x80,
+    0xA4, 0x99, 0x78, 0xA1, 0x69, 0x05, 0x5B, 0x71, 0xB3, 0xF0, 0x42, 0x88, 0xCC, 0xD8, 0x89, 0x39,
+    0x1D, 0x41, 0x31, 0x68, 0x81, 0x4F, 0x00, 0x6E, 0xCF, 0xEF, 0x77, 0x2E, 0xF0, 0xBE, 0x8F, 0xA4,
+    0x64, 0xFD, 0x21, 0x2D, 0x26, 0x4F, 0x7A, 0x17, 0x1F, 0xDF, 0x7B, 0x1F, 0x70, 0xEF, 0xB9, 0xE7,
+    0x9E, 0xF3, 0x3B, 0x7F, 0x3F, 0x63, 0x7E, 0x29, 0x33, 0xF2, 0x95, 0x34, 0x18, 0x57, 0x2D, 0x46,
+    0xBF, 0xC7, 0x68, 0xCE, 0x72, 0xBC, 0xC7, 0xCC, 0x5F, 0xB9, 0xB5, 0x36, 0x33, 0x25, 0xC7, 0xD5,
+    0x68, 0x12, 0xF9, 0xF3, 0xC1, 0xC4, 0xF3, 0x18, 0xF5, 0xE6, 0x13, 0x32, 0x76, 0xF8, 0xCB, 0x98,
+    0x63, 0xC2, 0x9B, 0xA5, 0xD6, 0x16, 0x1C, 0xE5, 0x31, 0x69, 0xCD, 0xFB, 0x54, 0x18, 0x4B, 0x8E,
+    0x56, 0xC7, 0xC2, 0x1C, 0x31, 0x9E, 0xFC, 0x45, 0x2B, 0xA3, 0xF1, 0x5A, 0x13, 0x58, 0x13, 0x36,
+    0x66, 0x57, 0x1E, 0x55, 0x1B, 0x19, 0xF8, 0x57, 0x27, 0x3D, 0x4C, 0xB1, 0x7C, 0xB4, 0x5F, 0xC6,
+    0x27, 0x83, 0xD6, 0x6C, 0x7C, 0x7D, 0xAC, 0x33, 0x5C, 0xE1, 0x92, 0x45, 0x18, 0x4D, 0x5C, 0xD8,
+    0x2A, 0x37, 0x27, 0xE5, 0x6D, 0xB1, 0xD9, 0x31, 0x36, 0x3B, 0x6E, 0xB6, 0xE5, 0x6D, 0x9F, 0x16,
+    0xD2, 0x5A, 0xDC, 0x2D, 0xD0, 0x71, 0xFA, 0xE4, 0x69, 0x63, 0x42, 0x6B, 0x47, 0x8E, 0xF2, 0x08,
+    0x99, 0xA7, 0xDC, 0x48, 0xE6, 0x99, 0x37, 0x18, 0xD3, 0x06, 0xF3, 0x94, 0x51, 0xE6, 0xA9, 0x63,
+    0x5E, 0xE3, 0x85, 0xFC, 0x4D, 0xDE, 0xC8, 0x9D, 0x0E, 0xDB, 0xFD, 0x44, 0x56, 0x66, 0xA7, 0xF4,
+    0x1C, 0xEE, 0xE7, 0x7D, 0x11, 0x63, 0xC4, 0xCD, 0x4B, 0xB8, 0x8E, 0x92, 0x3F, 0xE6, 0x0F, 0xBC,
+    0x6C, 0x83, 0x4A, 0x86, 0x54, 0x92, 0xE7, 0x8E, 0x26, 0x97, 0x71, 0x30, 0xC7, 0x49, 0xA5, 0x93,
+    0x7C, 0xFF, 0xA7, 0xE7, 0xBB, 0x6C, 0x50, 0x49, 0x47, 0xB2, 0xC9, 0x7B, 0x50, 0x09, 0x23, 0x1E,
+    0xE5, 0xAD, 0x2D, 0x74, 0xD7, 0xFE, 0x2D, 0x7E, 0x6C, 0x87, 0x83, 0x9D, 0xDA, 0x95, 0x3F, 0x95,
+    0x35, 0x77, 0x72, 0x73, 0x79, 0x6C, 0x59, 0x04, 0x83, 0xAC, 0x27, 0xE8, 0x83, 0xD1, 0xF8, 0xE7,
+    0xA2, 0x61, 0x7E, 0x34, 0x9F, 0x9C, 0xEE, 0xEF, 0x65, 0xBA, 0x3B, 0xF9, 0xDF, 0x9C, 0x31, 0x20,
+    0xC1, 0xC6, 0xD0, 0xE8, 0xDC, 0x3C, 0x93, 0xF4, 0x66, 0x65, 0x22, 0x9B, 0x3D, 0x29, 0x4F, 0xC5,
+    0xA3, 0x72, 0x8B, 0xDF, 0x9F, 0x9E, 0x9F, 0xE8, 0x95, 0x93, 0xC1, 0x1E, 0x55, 0x26, 0xAD, 0x64,
+    0x15, 0x79, 0x16, 0x09, 0x21, 0x4D, 0x24, 0xBB, 0x07, 0xAE, 0xE0, 0xCC, 0x2D, 0x19, 0x6C, 0x24,
+    0x4B, 0xC8, 0xBF, 0x23, 0xDB, 0x62, 0xC3, 0x30, 0x9B, 0x7C, 0xC2, 0xE1, 0xC0, 0x62, 0x7C, 0x6C,
+    0xAE, 0xBC, 0x27, 0xAD, 0x74, 0x10, 0x2E, 0x6B, 0x83, 0x41, 0xFE, 0xF6, 0x22, 0x38, 0x03, 0x4B,
+    0x27, 0xA5, 0x73, 0x59, 0x5A, 0x29, 0xF7, 0x0B, 0x27, 0xD2, 0x95, 0xDF, 0xA0, 0x29, 0xB8, 0x0F,
+    0x4B, 0xC3, 0xCA, 0x40, 0x51, 0xD0, 0x13, 0xD4, 0x04, 0x2D, 0x41, 0x49, 0xD0, 0x51, 0x9E, 0x0D,
+    0x4E, 0x03, 0x05, 0x41, 0xBF, 0x5D, 0xB9, 0x8D, 0xC5, 0x54, 0x56, 0xC5, 0x73, 0x26, 0xFE, 0x9E,
+    0x6C, 0xF8, 0x4B, 0xF2, 0xBC, 0xA7, 0xBA, 0xB5, 0xFD, 0xBC, 0xFD, 0xCF, 0xF2, 0xC0, 0xD7, 0x3E,
+    0x0F, 0x46, 0x0C, 0x56, 0x88, 0xDB, 0x65, 0x3B, 0x9A, 0x79, 0x20, 0xFD, 0xB9, 0xFD, 0xDC, 0x7D,
+    0x25, 0x21, 0x08, 0x80, 0x81, 0x8C, 0xCE, 0xED, 0x0F, 0x40, 0xBB, 0x00, 0x54, 0x0D, 0x41, 0x4A,
+    0xCC, 0xCE, 0x70, 0x8B, 0xC9, 0x63, 0x6B, 0xFB, 0xDC, 0x38, 0x9E, 0xF2, 0x70, 0x27, 0x52, 0x9C,
+    0x9B, 0x6B, 0x66, 0x09, 0xE0, 0x95, 0x3C, 0x24, 0xF2, 0xC6, 0x2C, 0xE1, 0xEA, 0x23, 0xC7, 0x94,
+    0xB1, 0x63, 0xCB, 0x93, 0x8E, 0x31, 0x77, 0x1C, 0x6B, 0x6E, 0x3B, 0xE6, 0x3C, 0x2B, 0x77, 0xC0,
+    0x09, 0xB9, 0x64, 0x78, 0xD6, 0x4C, 0xEB, 0xD9, 0x47, 0x65, 0x66, 0x9E, 0x5C, 0x31, 0x75, 0x1F,
+    0x67, 0x49, 0xFE, 0x32, 0xA8, 0x65, 0xAA, 0x72, 0x5D, 0x55, 0x7A, 0x8D, 0x0A, 0x39, 0x1D, 0xE0,
+    0x17, 0x9E, 0xCB, 0xE2, 0x57, 0xAC, 0x5C, 0x65, 0x45, 0xE9, 0x28, 0x33, 0x8F, 0x47, 0x93, 0xF6,
+    0x98, 0x50, 0x2B, 0x92, 0x53, 0xF8, 0x4D, 0x66, 0xEB, 0xAD, 0xED, 0x07, 0x69, 0x28, 0x7B, 0x82,
+    0x6D, 0xC1, 0xBE, 0x44, 0x6E, 0xE5, 0x5C, 0x32, 0xAE, 0x9D, 0xAE, 0x9F, 0x64, 0x8D, 0x3A, 0x25,
+    0x00, 0xCE, 0x3A, 0xC9, 0x7C, 0xED, 0x4C, 0x7E, 0x4D, 0xE5, 0x92, 0xB5, 0x3D, 0x0F, 0x80, 0xBD,
+    0x2A, 0x34, 0x95, 0xC5, 0x95, 0x95, 0xCC, 0x4B, 0x16, 0x67, 0x0B, 0x59, 0x71, 0xC9, 0x6B, 0x2B,
+    0x53, 0x14, 0x8A, 0xE3, 0x5A, 0xC8, 0x3A, 0xD2, 0x46, 0xFE, 0x21, 0xD7, 0xBC, 0x96, 0xC5, 0xC9,
+    0x3A, 0x6C, 0x05, 0x49, 0x35, 0x86, 0x16, 0x7B, 0x7B, 0x11, 0xF7, 0xB3, 0xF6, 0x2D, 0x99, 0x6F,
+    0xF6, 0x11, 0xE4, 0xD5, 0x74, 0xB3, 0xBC, 0xAA, 0xDD, 0x28, 0x6B, 0x90, 0xE9, 0xC9, 0x72, 0x4A,
+    0x8E, 0xA0, 0x5E, 0x03, 0xCE, 0xC8, 0x31, 0x8A, 0xBC, 0xF2, 0xEC, 0x15, 0x91, 0x57, 0xBE, 0xA5,
+    0x78, 0x39, 0x63, 0xCC, 0xFC, 0x84, 0x90, 0x3F, 0x88, 0xB8, 0x7D, 0x29, 0xA9, 0x78, 0x74, 0x9D,
+    0xBF, 0xE5, 0xEC, 0x82, 0x9A, 0x23, 0x68, 0x29, 0xA2, 0x4D, 0x9E, 0x9B, 0x92, 0x8E, 0xE4, 0xF4,
+    0xA0, 0x01, 0x0D, 0x23, 0xB0, 0x6A, 0x77, 0x8A, 0xDC, 0x34, 0x90, 0x7A, 0x3A, 0x82, 0x8F, 0xD2,
+    0xD7, 0xF0, 0x90, 0xFC, 0x25, 0x30, 0x66, 0x59, 0x91, 0xEF, 0xAB, 0xB2, 0x06, 0xCB, 0xE6, 0x38,
+    0xB5, 0x20, 0x9E, 0x2C, 0x57, 0x18, 0x5D, 0x16, 0x1A, 0x8D, 0xA0, 0x54, 0x68, 0x0B, 0xEC, 0x21,
+    0xF8, 0x47, 0xC5, 0xAA, 0x13, 0x68, 0x4E, 0xA6, 0xCA, 0x43, 0x28, 0xEA, 0x4C, 0x58, 0xEB, 0x3F,
+    0xB3, 0x75, 0x25, 0xD4, 0xA5, 0xB2, 0x3E, 0x99, 0x6F, 0x22, 0x07, 0x53, 0x26, 0x0C, 0xEA, 0xC9,
+    0x5C, 0x03, 0x3D, 0x9E, 0xC2, 0x53, 0xDC, 0xF9, 0x81, 0x1B, 0x9F, 0x0F, 0x98, 0xB5, 0x07, 0x7A,
+    0x88, 0x24, 0x7C, 0xBD, 0xC3, 0x49, 0x4D, 0x62, 0x1E, 0xD6, 0x81, 0xE7, 0xF6, 0xB5, 0x16, 0x3C,
+    0x91, 0xBF, 0x8E, 0x0D, 0x37, 0x42, 0x06, 0x70, 0xB8, 0xFC, 0x35, 0x18, 0xDC, 0x82, 0x1F, 0x78,
+    0xDA, 0x6C, 0xC5, 0xE9, 0x09, 0x9D, 0xE5, 0x59, 0xF8, 0x81, 0xAC, 0xE0, 0x7E, 0x7B, 0x05, 0x47,
+    0x39, 0x57, 0x52, 0x73, 0x05, 0xAD, 0xF9, 0xB6, 0xEC, 0x62, 0xE7, 0xD7, 0xD8, 0xCB, 0x5D, 0x9E,
+    0x54, 0xFE, 0xF2, 0x50, 0x76, 0x30, 0x77, 0x99, 0x74, 0x25, 0x92, 0x33, 0xB1, 0x45, 0x24, 0x33,
+    0xEF, 0x31, 0x5D, 0xD1, 0xB2, 0x32, 0xF7, 0xB0, 0x22, 0x75, 0x20, 0x2B, 0xB2, 0x84, 0xC7, 0xFD,
+    0x2C, 0x4F, 0x3E, 0xEE, 0x90, 0x7F, 0x8F, 0x07, 0xF8, 0x87, 0xD5, 0x2C, 0x3A, 0x45, 0x29, 0x99,
+    0xF9, 0x98, 0x3B, 0x5D, 0x12, 0xB6, 0x0B, 0xBD, 0x8E, 0xEE, 0x16, 0xFC, 0x43, 0x6E, 0x36, 0xFF,
+    0x84, 0xE7, 0x60, 0x3E, 0x41, 0xD8, 0x6F, 0xD0, 0x5E, 0x8F, 0x8F, 0x10, 0x70, 0x35, 0x52, 0x76,
+    0x38, 0xD9, 0x46, 0xD1, 0xD6, 0xCF, 0x12, 0x2E, 0x56, 0x21, 0x07, 0x5A, 0xC9, 0xB7, 0x13, 0x75,
+    0x94, 0x74, 0x0D, 0x69, 0x25, 0xDF, 0xA0, 0x95, 0x7C, 0x97, 0x2A, 0xF6, 0x74, 0xF7, 0x29, 0xAD,
+    0xE4, 0x9B, 0xB2, 0x2F, 0x03, 0xF1, 0xE4, 0xDB, 0x57, 0x29, 0xA8, 0x82, 0x50, 0xBE, 0x1A, 0x4A,
+    0x1E, 0x1C, 0x65, 0x53, 0xEA, 0x3E, 0xA7, 0x4A, 0x29, 0xE5, 0x50, 0x39, 0x29, 0x46, 0xC5, 0xCC,
+    0x06, 0xC3, 0xC6, 0xCD, 0x81, 0xBA, 0x2C, 0x5B, 0x72, 0x0E, 0xC6, 0x00, 0x9B, 0x6B, 0xC2, 0x57,
+    0x79, 0xF2, 0x49, 0x92, 0x93, 0x2B, 0x8C, 0xDB, 0x14, 0x88, 0x97, 0x20, 0x1B, 0xBD, 0x16, 0xA3,
+    0x88, 0x21, 0xAC, 0xF7, 0x27, 0xDF, 0x02, 0xA3, 0xF0, 0xB0, 0x25, 0x67, 0x1E, 0x9B, 0xF0, 0x18,
+    0x4C, 0xAC, 0xC7, 0x2C, 0x65, 0x27, 0xA1, 0x2E, 0x31, 0x66, 0xBB, 0x93, 0xB9, 0x1F, 0x94, 0x12,
+    0x7A, 0xB6, 0x50, 0xED, 0x38, 0x29, 0x32, 0xC8, 0xBE, 0x3D, 0x09, 0x6A, 0xED, 0x60, 0xD8, 0x06,
+    0xB5, 0xB6, 0x55, 0xEA, 0xA8, 0xC0, 0x55, 0xF9, 0x32, 0x42, 0xB8, 0xE0, 0x8C, 0xD6, 0xD0, 0x88,
+    0x15, 0x8F, 0xAD, 0xFC, 0xDE, 0x72, 0x28, 0x92, 0x96, 0x47, 0x43, 0x08, 0x53, 0xD6, 0x81, 0xF5,
+    0x6D, 0xB1, 0x0B, 0xF1, 0x69, 0x29, 0x4B, 0x73, 0x48, 0x90, 0x12, 0x0A, 0x3C, 0x1C, 0x45, 0x16,
+    0x52, 0x30, 0x72, 0x90, 0xE3, 0x28, 0x43, 0x27, 0x0C, 0x13, 0x77, 0xF2, 0xE4, 0xA4, 0x05, 0x76,
+    0x81, 0x5E, 0xD4, 0xA1, 0x96, 0x03, 0x97, 0x57, 0x32, 0x9B, 0xB2, 0x8A, 0x20, 0x3C, 0x30, 0x14,
+    0xD1, 0x20, 0x0F, 0x8A, 0x7B, 0x79, 0x50, 0xDA, 0x05, 0xD6, 0xB3, 0x0D, 0xA8, 0x2F, 0xE7, 0x4F,
+    0x38, 0xF8, 0xE3, 0x06, 0x2B, 0x90, 0xC1, 0xF2, 0x2A, 0x51, 0x49, 0x1C, 0x88, 0xA6, 0x90, 0xBF,
+    0x0F, 0x2A, 0x55, 0x6C, 0x15, 0x55, 0xDB, 0x0A, 0x6A, 0x02, 0x4A, 0x89, 0xEA, 0x2D, 0x52, 0x05,
+    0x17, 0xEB, 0xA4, 0x1E, 0x54, 0x9A, 0x6F, 0xEB, 0xE4, 0xCE, 0xEA, 0xEC, 0x54, 0xCC, 0x7B, 0xCA,
+    0xA6, 0x81, 0xB2, 0x69, 0x48, 0xB1, 0x2E, 0x2A, 0x87, 0x53, 0x4C, 0x74, 0x8E, 0x4F, 0x70, 0x92,
+    0x94, 0xD0, 0x80, 0x79, 0xBC, 0x00, 0xD8, 0xF9, 0x03, 0xFE, 0x02, 0xBC, 0x40, 0x0E, 0xEC, 0x94,
+    0x03, 0x5B, 0xF3, 0xB8, 0x5E, 0xBE, 0x82, 0xCB, 0xB9, 0x8F, 0x1B, 0xAF, 0xA7, 0xF6, 0x4F, 0xAC,
+    0xFC, 0x8F, 0xDD, 0xFF, 0x4D, 0x3B, 0x3D, 0x2A, 0x87, 0x49, 0xA4, 0x89, 0x2C, 0x7C, 0xE2, 0xC4,
+    0xF3, 0xDA, 0x57, 0x8A, 0xE4, 0x15, 0x45, 0xC2, 0x49, 0x70, 0x5E, 0x46, 0x32, 0xDA, 0xE2, 0x09,
+    0x4A, 0x8A, 0xCA, 0x3E, 0xC4, 0x09, 0xAD, 0xBE, 0x6B, 0x3F, 0xCF, 0x79, 0xC4, 0x3C, 0x92, 0x6E,
+    0x53, 0xF8, 0x2B, 0xFB, 0xF2, 0xC4, 0xA9, 0x07, 0xF6, 0x91, 0x51, 0x55, 0xEB, 0x14, 0x0E, 0x4A,
+    0xFF, 0x7E, 0x35, 0x70, 0x5B, 0xD2, 0x36, 0x1A, 0xB8, 0x5B, 0xC2, 0x6B, 0x3D, 0x0E, 0xB8, 0xEC,
+    0x20, 0x04, 0xAE, 0x28, 0x2F, 0x51, 0x25, 0x1D, 0xB1, 0xB4, 0xFC, 0x7C, 0xCA, 0x72, 0xE1, 0xC9,
+    0x5A, 0x74, 0x62, 0x76, 0x6C, 0x16, 0x98, 0x3E, 0xCE, 0x47, 0x82, 0xC5, 0x94, 0x15, 0xD4, 0x2B,
+    0xFE, 0x1C, 0x6C, 0x2D, 0xBB, 0xBA, 0x86, 0x5A, 0x6A, 0x65, 0x22, 0x8A, 0x52, 0xDF, 0xE2, 0xE7,
+    0x5B, 0x76, 0x61, 0x2F, 0x92, 0x2E, 0xAF, 0xB7, 0x30, 0x24, 0x19, 0xEE, 0x53, 0x40, 0x67, 0xCB,
+    0x71, 0x32, 0xF1, 0x54, 0x0E, 0xF2, 0xA7, 0x38, 0x4C, 0x87, 0xB2, 0xBB, 0x59, 0x6D, 0x08, 0xAB,
+    0x76, 0x50, 0x1C, 0xB2, 0x7F, 0xD0, 0x1C, 0x4E, 0x75, 0xC8, 0xDB, 0x46, 0xB3, 0xA9, 0x3C, 0xEE,
+    0xCA, 0x35, 0x7C, 0xCC, 0xE0, 0x41, 0xD5, 0x08, 0x91, 0xEB, 0x39, 0x30, 0x37, 0xC1, 0x74, 0xA4,
+    0xFC, 0x13, 0x2B, 0x07, 0x9D, 0x54, 0x69, 0xB5, 0xA3, 0xE2, 0x6A, 0x5B, 0x39, 0xEA, 0xAC, 0xB2,
+    0xCE, 0x25, 0x3D, 0x76, 0x04, 0x52, 0x38, 0x67, 0x60, 0x2A, 0xBF, 0xA1, 0xD0, 0x0A, 0x6A, 0x4A,
+    0xAD, 0x55, 0x45, 0x00, 0x15, 0x15, 0x94, 0x45, 0x29, 0x49, 0xFD, 0x2B, 0x96, 0xA4, 0x4E, 0x47,
+    0xCA, 0xA2, 0x14, 0x1B, 0x72, 0x4E, 0x60, 0xAA, 0x8F, 0xD3, 0xE9, 0x2D, 0x5B, 0x05, 0x8B, 0x55,
+    0x4C, 0x2F, 0xF9, 0x59, 0x24, 0x84, 0x0A, 0xE5, 0x9A, 0x40, 0xC6, 0xCA, 0x74, 0x53, 0x6C, 0x97,
+    0xA8, 0xAE, 0xB7, 0xB1, 0x5F, 0x79, 0xEB, 0xF1, 0x2A, 0x66, 0xCE, 0x2B, 0xD8, 0xB1, 0xA4, 0x0D,
+    0x9F, 0x96, 0xEB, 0xC9, 0xB8, 0xA3, 0x16, 0xDB, 0x89, 0xBB, 0x93, 0x10, 0x22, 0xDB, 0x51, 0xBF,
+    0x8D, 0xCD, 0x93, 0xEB, 0x73, 0x58, 0xD6, 0xD9, 0x68, 0xE0, 0xF6, 0x5D, 0x8A, 0x26, 0x28, 0x17,
+    0xD3, 0xAD, 0x04, 0x57, 0xC8, 0xCA, 0x5A, 0xB1, 0xA2, 0x64, 0x69, 0xA2, 0xEA, 0x88, 0xB1, 0xBD,
+    0x26, 0x1C, 0xB8, 0x79, 0x4D, 0xD0, 0xE3, 0x50, 0xEE, 0x5E, 0x0F, 0xDA, 0x63, 0x22, 0x81, 0xED,
+    0x14, 0xD4, 0xA9, 0x5A, 0x71, 0x9D, 0xB3, 0x6F, 0x72, 0xD9, 0x55, 0x79, 0x93, 0xB3, 0x72, 0x42,
+    0x05, 0x03, 0xCE, 0xD6, 0x89, 0x94, 0xA5, 0x30, 0xA1, 0xB8, 0x9B, 0x8D, 0x1E, 0xF2, 0x92, 0x8A,
+    0x8A, 0x54, 0x45, 0x47, 0x4A, 0xF3, 0x19, 0xCF, 0xC7, 0x54, 0xCA, 0x6A, 0x36, 0x83, 0x4A, 0xB5,
+    0x84, 0x9C, 0x31, 0xA4, 0xF6, 0x10, 0x5E, 0x2D, 0x60, 0x40, 0x34, 0x12, 0x59, 0xAA, 0xB4, 0x07,
+    0x66, 0xD7, 0xAE, 0x68, 0x40, 0xE0, 0x60, 0x20, 0x8F, 0x06, 0xF3, 0x28, 0xB1, 0x07, 0x7C, 0x27,
+    0xCD, 0x1D, 0x5B, 0xE0, 0x87, 0xA2, 0xDD, 0x7A, 0x3C, 0x03, 0x34, 0xB1, 0x15, 0x79, 0xA5, 0xD0,
+    0x51, 0x20, 0xB1, 0xC8, 0x22, 0x99, 0x48, 0x00, 0xB4, 0x8E, 0x8D, 0xCB, 0x95, 0x39, 0x67, 0xDB,
+    0x5F, 0x97, 0x20, 0x93, 0x85, 0x7E, 0x84, 0x70, 0xB9, 0x48, 0xAC, 0x45, 0x53, 0x46, 0xED, 0xDA,
+    0x5C, 0xE1, 0x49, 0xA9, 0x5C, 0x26, 0x7B, 0xFE, 0xFE, 0x91, 0x52, 0x7A, 0xFB, 0x90, 0x92, 0x10,
+    0xE7, 0x3C, 0x88, 0x43, 0x52, 0xE4, 0x76, 0x3F, 0xA3, 0xBE, 0x6E, 0xA1, 0xAF, 0x63, 0x4E, 0x44,
+    0x8F, 0x3F, 0xFE, 0x58, 0x45, 0x70, 0xD4, 0x61, 0x8C, 0x3B, 0xFC, 0x24, 0x01, 0x23, 0x50, 0x4A,
+    0x63, 0x22, 0xB9, 0xEE, 0x15, 0xA6, 0x61, 0xAF, 0xDF, 0x4A, 0x5F, 0x7B, 0x1F, 0xD0, 0xB9, 0x10,
+    0xFD, 0x3C, 0xE7, 0xC2, 0x81, 0xE5, 0xD9, 0x98, 0x0F, 0xE3, 0x5C, 0xD8, 0xB4, 0xA2, 0xCA, 0x3A,
+    0x57, 0x55, 0x06, 0x2B, 0xAA, 0x10, 0x2B, 0x4A, 0xC8, 0xF6, 0xE9, 0x79, 0xD6, 0x9B, 0xB6, 0x94,
+    0x99, 0xAD, 0x62, 0x35, 0x8B, 0x15, 0x36, 0x6C, 0x20, 0x66, 0xA7, 0x9B, 0xDB, 0x1B, 0x60, 0xCD,
+    0x96, 0xDD, 0x37, 0x44, 0x86, 0x77, 0x0B, 0x5E, 0x37, 0xDE, 0x19, 0x5A, 0x72, 0x21, 0xA7, 0x24,
+    0xC2, 0xEE, 0x9A, 0x4A, 0x98, 0x5A, 0x7F, 0x66, 0x29, 0xBD, 0xED, 0x9B, 0x32, 0x31, 0x91, 0x8B,
+    0x4F, 0x09, 0xB1, 0x04, 0x44, 0x66, 0x42, 0x23, 0x02, 0xBE, 0x26, 0x6D, 0x61, 0xB5, 0x8A, 0xAC,
+    0x90, 0x39, 0xA7, 0x6D, 0xDE, 0x08, 0x4D, 0xE4, 0x02, 0x0C, 0x2C, 0xEC, 0x00, 0xE9, 0x50, 0x8A,
+    0xFC, 0xA0, 0xA1, 0x29, 0xBB, 0x29, 0xE0, 0x32, 0x8B, 0x86, 0xA8, 0x8B, 0x71, 0xB3, 0x37, 0x27,
+    0x9C, 0xC6, 0x9C, 0xC6, 0xEC, 0x0C, 0xF9, 0x4C, 0xAE, 0x98, 0x41, 0xA7, 0x72, 0x48, 0x27, 0x16,
+    0xDB, 0x41, 0xA4, 0x8F, 0x5C, 0xFA, 0x48, 0x16, 0xEB, 0xDB, 0x8A, 0x0E, 0x4E, 0xB1, 0x8C, 0xE9,
+    0xEF, 0xA9, 0x23, 0xAE, 0xAE, 0x3D, 0xC5, 0xE5, 0x75, 0x97, 0xF8, 0x8E, 0x89, 0xB7, 0x89, 0x94,
+    0xF3, 0x42, 0x35, 0xFD, 0x74, 0xE7, 0xC0, 0x05, 0x0A, 0x42, 0xF8, 0xBB, 0x9E, 0x96, 0x41, 0x40,
+    0x59, 0x27, 0xC2, 0x58, 0x0D, 0x78, 0xF5, 0x99, 0x5C, 0x26, 0x3D, 0xE5, 0x59, 0x11, 0x30, 0xFC,
+    0x44, 0x29, 0x9C, 0x5B, 0x03, 0x29, 0x7C, 0x83, 0x8D, 0xB3, 0x52, 0x1B, 0x67, 0xF5, 0x31, 0xD8,
+    0x38, 0xDD, 0x81, 0x8D, 0x33, 0xBB, 0x7F, 0x4D, 0xD0, 0x6C, 0x5C, 0xD4, 0xF4, 0x09, 0x2A, 0xDD,
+    0xEB, 0x42, 0x56, 0xDE, 0x8B, 0x6A, 0x15, 0x0D, 0x2F, 0x42, 0x11, 0xC0, 0x8F, 0x7E, 0x06, 0xE1,
+    0x3B, 0xFC, 0x3F, 0x38, 0xF1, 0xA3, 0x6B, 0x88, 0x06, 0x27, 0x95, 0x65, 0xF6, 0x11, 0x8C, 0x01,
+    0x28, 0x48, 0x99, 0x7B, 0x68, 0xDF, 0x84, 0x56, 0x24, 0x5C, 0x34, 0x9F, 0xFC, 0xCF, 0xEF, 0x82,
+    0xCD, 0xE7, 0x53, 0x83, 0x31, 0x81, 0x2D, 0x60, 0x4A, 0xDD, 0xF0, 0x9F, 0x59, 0xFB, 0xAA, 0x5A,
+    0x05, 0x6F, 0x58, 0xFB, 0x0D, 0x28, 0xE9, 0x05, 0xCB, 0x19, 0xDA, 0x1C, 0x7C, 0xBF, 0x8A, 0x52,
+    0xBC, 0x9B, 0xE2, 0x94, 0x77, 0x03, 0xEC, 0xA8, 0x79, 0x0E, 0x65, 0x46, 0xA5, 0xC2, 0x78, 0xBA,
+    0x29, 0x54, 0x7B, 0xE2, 0x8D, 0x3C, 0x93, 0x7C, 0x23, 0xCF, 0x65, 0x0A, 0x35, 0xCB, 0xB3, 0x99,
+    0x43, 0xD3, 0xF2, 0x84, 0xF0, 0x8D, 0x91, 0xE3, 0xA1, 0x49, 0xA5, 0x89, 0x85, 0x15, 0x10, 0xD3,
+    0x73, 0x86, 0x37, 0x26, 0x7C, 0xE5, 0xE6, 0x60, 0xF4, 0xCF, 0xF1, 0x8A, 0x34, 0xB7, 0x38, 0xC1,
+    0xD6, 0x7D, 0x99, 0x7F, 0x1C, 0x2B, 0xB2, 0x1B, 0x2B, 0xD2, 0xAF, 0x69, 0x79, 0x75, 0x6A, 0x79,
+    0xB5, 0xB3, 0xBC, 0xDA, 0xBE, 0xC5, 0xAB, 0xCF, 0xF0, 0xE8, 0x8E, 0x90, 0x6E, 0xC2, 0x34, 0x4F,
+    0xC9, 0xA2, 0x4F, 0x62, 0x6D, 0x3B, 0x58, 0xD6, 0xF6, 0x8D, 0x8E, 0x44, 0x68, 0x88, 0x08, 0x2C,
+    0x14, 0xF5, 0x09, 0x0E, 0x89, 0xAC, 0x24, 0x6E, 0x39, 0xD3, 0x10, 0xC2, 0x83, 0x83, 0x4C, 0x37,
+    0xAF, 0xA1, 0x04, 0xA0, 0x80, 0xED, 0x8B, 0x65, 0x7D, 0x0C, 0xE2, 0x3A, 0x75, 0xA6, 0xA5, 0x1C,
+    0x26, 0x42, 0x20, 0xD1, 0xB5, 0xF2, 0x3C, 0x21, 0x39, 0xB9, 0x0D, 0xB4, 0xF1, 0x15, 0xB8, 0x52,
+    0x4E, 0x83, 0x2E, 0xBC, 0x76, 0x34, 0x41, 0x49, 0x9D, 0xD5, 0xA0, 0x3C, 0x49, 0x80, 0x05, 0x05,
+    0x00, 0x3F, 0x5D, 0x23, 0xB2, 0x04, 0x30, 0xB6, 0x4E, 0x5B, 0xFC, 0x4D, 0x2E, 0x66, 0x34, 0xA8,
+    0x06, 0x9B, 0x3A, 0xA5, 0xFA, 0x97, 0x6B, 0x63, 0x68, 0x59, 0xCB, 0x91, 0x25, 0x74, 0xCC, 0x09,
+    0x5F, 0xCB, 0x1A, 0xEE, 0x47, 0xBB, 0x65, 0x33, 0xD9, 0x70, 0x58, 0xD9, 0x84, 0x40, 0x02, 0x19,
+    0x1D, 0x04, 0x52, 0x67, 0x22, 0x99, 0xC2, 0x29, 0x8A, 0xD5, 0xE2, 0x40, 0x5D, 0x33, 0xEA, 0xB1,
+    0x28, 0x35, 0xB3, 0x65, 0x26, 0x9C, 0x06, 0xE7, 0xF0, 0x1E, 0x46, 0xBD, 0x3C, 0x71, 0xCD, 0xA8,
+    0x77, 0x56, 0x0F, 0x00, 0xF9, 0xBE, 0x90, 0xBE, 0x2C, 0x12, 0xBA, 0xC8, 0x61, 0xF5, 0xC8, 0xF3,
+    0x1E, 0x54, 0xB2, 0xD3, 0xAA, 0x82, 0xCE, 0xE6, 0x80, 0x37, 0x7B, 0xEA, 0x55, 0x8D, 0x36, 0x1D,
+    0xBB, 0x49, 0xBB, 0x05, 0x92, 0x88, 0xD5, 0x93, 0xD3, 0xEA, 0x91, 0xF9, 0x80, 0x9F, 0xF6, 0x4B,
+    0x1C, 0x7F, 0x48, 0xEC, 0x75, 0xC3, 0x41, 0x7D, 0xD8, 0x23, 0x97, 0x49, 0x1F, 0x7D, 0x08, 0xB8,
+    0x2F, 0xC4, 0x83, 0xE0, 0xC7, 0x4D, 0x05, 0x3E, 0x50, 0xC0, 0x44, 0xBD, 0x9A, 0x13, 0x02, 0xD9,
+    0x3B, 0x30, 0x21, 0x29, 0x2C, 0xD7, 0x04, 0x02, 0x18, 0xCE, 0x59, 0xA8, 0x1B, 0xBD, 0xD6, 0x7A,
+    0x13, 0xDC, 0x6C, 0x94, 0x39, 0x00, 0xEF, 0x0E, 0x0A, 0xE0, 0xE9, 0x79, 0x80, 0x42, 0x00, 0x41,
+    0x84, 0xF2, 0x20, 0x07, 0x80, 0x58, 0x5E, 0x51, 0x23, 0xC9, 0x41, 0xE1, 0x9D, 0x03, 0x07, 0xE6,
+    0x65, 0xC6, 0x8A, 0xB2, 0x74, 0xC2, 0x1A, 0x49, 0xD9, 0x2A, 0x69, 0x21, 0xD3, 0xE1, 0x22, 0x34,
+    0xAB, 0xA1, 0x06, 0x14, 0xD2, 0xEA, 0xED, 0x8D, 0xDE, 0x1D, 0xAA, 0x92, 0xE7, 0x14, 0x17, 0x33,
+    0x43, 0x1F, 0x87, 0x89, 0xE4, 0x7D, 0x57, 0x27, 0x0A, 0x3A, 0x12, 0x30, 0xB0, 0x5F, 0xE2, 0xD6,
+    0x4E, 0x6A, 0xC1, 0x0E, 0x24, 0xA3, 0x20, 0x23, 0xEC, 0x6D, 0xD9, 0xE8, 0x49, 0x24, 0x8E, 0xC4,
+    0xFA, 0xA0, 0x0B, 0xC6, 0x2D, 0x3C, 0xBC, 0x6C, 0x14, 0x0B, 0xF8, 0xF6, 0x6B, 0x85, 0x9A, 0xAB,
+    0xC2, 0x46, 0x38, 0xF4, 0x3C, 0xB6, 0xD8, 0x3F, 0x98, 0x27, 0xD4, 0xB2, 0x0D, 0x74, 0x2C, 0x54,
+    0x6B, 0x5E, 0xCB, 0xAF, 0x72, 0x78, 0x5F, 0x84, 0x41, 0x70, 0x44, 0xFE, 0x95, 0x1C, 0xE6, 0xBF,
+    0xFE, 0xF1, 0x70, 0x3A, 0xB1, 0xDF, 0x91, 0x1D, 0x98, 0x70, 0x0C, 0x32, 0xB1, 0xF1, 0xF1, 0x05,
+    0x51, 0xFC, 0x25, 0xB0, 0x29, 0x55, 0x28, 0x3D, 0x0A, 0x02, 0xA4, 0xEC, 0xFE, 0x69, 0xC0, 0x0D,
+    0xE8, 0x3C, 0x2C, 0x2B, 0x94, 0x9F, 0x9F, 0x04, 0xA3, 0xEE, 0xC0, 0xFE, 0x4E, 0x41, 0xBB, 0x1C,
+    0x1A, 0xBD, 0x54, 0x9F, 0xFA, 0x32, 0x40, 0xA6, 0x94, 0x05, 0x43, 0x3E, 0x90, 0x1F, 0x85, 0xAC,
+    0x2A, 0xA9, 0x52, 0xD9, 0x92, 0x7D, 0x3B, 0x9B, 0xCF, 0x2E, 0x5A, 0x73, 0x8E, 0x67, 0x73, 0x0A,
+    0xA6, 0x40, 0x90, 0xE3, 0xAA, 0x0B, 0xA6, 0x48, 0xCE, 0x36, 0xDC, 0x49, 0x62, 0x95, 0xE1, 0x00,
+    0x17, 0xE0, 0x0F, 0xB8, 0x92, 0x52, 0x59, 0x46, 0x5A, 0x47, 0x7D, 0x2C, 0x94, 0x5A, 0x4D, 0xA5,
+    0x48, 0xB7, 0x49, 0x99, 0x6B, 0xF7, 0x3A, 0x22, 0x18, 0x55, 0x28, 0x7B, 0xB3, 0xC5, 0xF8, 0x26,
+    0xBE, 0xE5, 0x59, 0xD8, 0x81, 0xDD, 0x2B, 0x64, 0x64, 0xFC, 0xC4, 0x81, 0x7F, 0xB8, 0xCF, 0xC5,
+    0xAE, 0x8C, 0x65, 0x4B, 0x05, 0x47, 0xE3, 0xB4, 0xC1, 0xA1, 0x77, 0xE8, 0x8B, 0x64, 0x4E, 0xF9,
+    0xF5, 0xAF, 0xD3, 0x97, 0xC7, 0xAD, 0xA1, 0x0C, 0xE2, 0x3E, 0xAA, 0x8A, 0x82, 0x33, 0xE1, 0x3A,
+    0x0E, 0x8C, 0xCC, 0xCA, 0x9F, 0x02, 0x00, 0x7F, 0xC1, 0xF7, 0x91, 0x1E, 0x37, 0xD9, 0x06, 0x88,
+    0x6A, 0xA3, 0x43, 0xED, 0x03, 0xE6, 0x03, 0xDC, 0x60, 0x07, 0x44, 0x3E, 0x41, 0x9F, 0xC7, 0x22,
+    0xC2, 0xC6, 0x32, 0xD3, 0xA3, 0x67, 0x0E, 0x1D, 0xAC, 0xBF, 0x37, 0x53, 0x38, 0xCA, 0xFA, 0x47,
+    0x59, 0xFF, 0xA8, 0xEB, 0x17, 0x11, 0x72, 0x4D, 0x10, 0x91, 0xAC, 0x31, 0xFD, 0xBB, 0xD3, 0xC4,
+    0x58, 0x44, 0x00, 0xAD, 0x39, 0x17, 0xF7, 0x01, 0xFC, 0x17, 0x85, 0x07, 0x66, 0xC2, 0x4D, 0x76,
+    0x6B, 0xEF, 0x59, 0x9A, 0x7D, 0x82, 0x7C, 0x3D, 0x3B, 0x84, 0x7F, 0x25, 0xB7, 0x0A, 0xDB, 0x31,
+    0xF4, 0xA7, 0x70, 0x88, 0xAA, 0xCB, 0x32, 0x79, 0xB9, 0x61, 0x75, 0x5E, 0xAE, 0xAB, 0x3E, 0x65,
+    0xF0, 0x26, 0xEA, 0x4A, 0x7A, 0x85, 0x55, 0x88, 0xCF, 0x57, 0x7F, 0x4C, 0x1A, 0x5E, 0x87, 0xA4,
+    0x96, 0xEB, 0x3D, 0x41, 0x9F, 0xE2, 0xBA, 0x13, 0xB6, 0x69, 0x65, 0x4D, 0xF1, 0x42, 0x54, 0xE7,
+    0x55, 0xF9, 0xB5, 0x2A, 0x2F, 0xB3, 0xB2, 0x10, 0x34, 0x99, 0x80, 0xF3, 0xE2, 0xC9, 0x9D, 0x13,
+    0xDD, 0x07, 0x01, 0xCD, 0xD5, 0xAA, 0x4D, 0x9B, 0x48, 0xF8, 0x37, 0x24, 0x0F, 0x33, 0x10, 0x55,
+    0xC0, 0x38, 0x85, 0x9D, 0xAA, 0x3B, 0x90, 0x57, 0x9F, 0x92, 0xEF, 0xCB, 0xB2, 0x23, 0x23, 0x0E,
+    0xE6, 0x37, 0x27, 0x15, 0x69, 0xB2, 0x05, 0x27, 0x2E, 0x98, 0xAF, 0x66, 0xB9, 0x70, 0x73, 0x86,
+    0xC3, 0x95, 0x81, 0xBE, 0x6A, 0x4B, 0xA8, 0xA7, 0xB1, 0x0D, 0xA0, 0xA9, 0x02, 0x11, 0xFD, 0x00,
+    0x8C, 0x29, 0x04, 0x7E, 0x5A, 0xC7, 0x70, 0x15, 0xA4, 0x88, 0x47, 0x5C, 0x94, 0xE1, 0xC7, 0xAF,
+    0xF6, 0xC2, 0x35, 0x91, 0x20, 0xE5, 0x5E, 0x00, 0x8B, 0x37, 0x33, 0x37, 0xDC, 0x77, 0xF7, 0xCA,
+    0x61, 0xAB, 0x44, 0x07, 0x45, 0xFB, 0xB0, 0x59, 0x08, 0x3D, 0xBE, 0xE8, 0x7E, 0x79, 0x47, 0x9E,
+    0x7B, 0x78, 0xEF, 0xA1, 0xBD, 0xF3, 0xB1, 0x7D, 0xD8, 0xE2, 0x4C, 0x96, 0x60, 0xA4, 0xDE, 0xF8,
+    0x93, 0x98, 0xF5, 0xB2, 0xC7, 0x62, 0x09, 0x8F, 0x29, 0x61, 0x73, 0xA6, 0xC1, 0xCA, 0xA8, 0x47,
+    0x24, 0x0A, 0x7A, 0x23, 0x6A, 0x69, 0x10, 0xC6, 0xCE, 0xAC, 0x11, 0x05, 0x27, 0x9C, 0x55, 0x7B,
+    0xB2, 0x63, 0x5B, 0x7B, 0x7B, 0xCF, 0xA8, 0xCA, 0x34, 0x1D, 0x34, 0x41, 0x0B, 0x59, 0x81, 0xC1,
+    0xAB, 0x85, 0xC1, 0x83, 0x4A, 0x68, 0xCD, 0x21, 0x2C, 0x44, 0xDD, 0xAC, 0x32, 0xDC, 0x50, 0xCE,
+    0x9F, 0x28, 0x65, 0x41, 0x85, 0xD8, 0x2C, 0xC1, 0xF4, 0xF6, 0x8F, 0x01, 0x15, 0xC6, 0xA4, 0x56,
+    0x1C, 0x2D, 0xC8, 0x7E, 0x6B, 0xAF, 0x30, 0x27, 0xCE, 0xCB, 0x6D, 0x6B, 0x7A, 0xB1, 0xAD, 0xB0,
+    0x2F, 0x74, 0x57, 0x1B, 0x00, 0xB3, 0xD9, 0x76, 0x05, 0xE3, 0xFD, 0xCD, 0x36, 0x96, 0x3B, 0x06,
+    0xAF, 0x76, 0xDB, 0xD0, 0x5F, 0xAF, 0xF4, 0x97, 0x60, 0x78, 0x7D, 0xA3, 0x6F, 0x31, 0xF9, 0x47,
+    0x2D, 0x98, 0x24, 0x0A, 0x04, 0xF1, 0x8B, 0xFE, 0x87, 0xFF, 0xD8, 0x78, 0x63, 0x30, 0x42, 0x02,
+    0x0D, 0xBE, 0x90, 0xF0, 0xA8, 0x48, 0x5D, 0x21, 0x40, 0x2F, 0x8F, 0xAC, 0x8D, 0xAD, 0x5D, 0xAE,
+    0xC1, 0xE1, 0xBD, 0xEC, 0xBE, 0x73, 0x31, 0x8E, 0x8C, 0xCF, 0xD3, 0x02, 0x67, 0x81, 0x4F, 0xE1,
+    0x01, 0xB9, 0xA1, 0x42, 0x0D, 0x5C, 0x09, 0xB3, 0x6B, 0x6D, 0x27, 0x22, 0xB7, 0x13, 0x8C, 0xC6,
+    0x4E, 0x47, 0x44, 0xD0, 0xD9, 0x4E, 0x16, 0x4C, 0x30, 0x79, 0x0F, 0xCE, 0xEA, 0x39, 0xC3, 0xE3,
+    0x64, 0xAC, 0xFC, 0x71, 0x80, 0x5D, 0x5C, 0xF5, 0xD8, 0xD4, 0xF9, 0x88, 0x16, 0x8C, 0x52, 0x11,
+    0x52, 0xE9, 0x43, 0x6B, 0x95, 0x94, 0x3C, 0xA2, 0x3D, 0x8E, 0xA8, 0x80, 0xF4, 0xB1, 0x2C, 0x5C,
+    0xC4, 0x04, 0xA7, 0xEB, 0xF0, 0x9E, 0xCC, 0x2B, 0xB6, 0x31, 0xA2, 0x6E, 0x4F, 0x8A, 0x49, 0x21,
+    0x48, 0x5E, 0x86, 0x2A, 0x07, 0x92, 0x9A, 0x65, 0x9D, 0xF2, 0x0C, 0x64, 0x30, 0x6C, 0x1D, 0xCA,
+    0xFE, 0xA8, 0x55, 0xC6, 0x99, 0xE6, 0x99, 0xFA, 0x3A, 0xD3, 0x9A, 0x33, 0xF5, 0xF7, 0x9E, 0x7A,
+    0x41, 0x36, 0xFF, 0x1B, 0x20, 0xFA, 0x9F, 0x09, 0xD9, 0x4B, 0xF8, 0x52, 0x44, 0xF6, 0x43, 0x7D,
+    0x63, 0xB2, 0x74, 0x5D, 0xAA, 0x30, 0x4F, 0x68, 0x30, 0xD1, 0x5C, 0xC2, 0x3C, 0xCB, 0x8A, 0xC2,
+    0x9E, 0x7A, 0x32, 0x9A, 0x76, 0x3B, 0xF0, 0x43, 0x21, 0x7F, 0x79, 0x7A, 0x8E, 0xDD, 0x2E, 0x61,
+    0x5B, 0xFA, 0x97, 0xF2, 0x7D, 0xC2, 0xE9, 0x75, 0x51, 0x63, 0x65, 0x73, 0x06, 0x6F, 0x5C, 0xF5,
+    0x5E, 0x1F, 0xB5, 0x26, 0x4B, 0xD6, 0x22, 0xC6, 0x3C, 0xAC, 0xB5, 0xFB, 0x77, 0x6B, 0xC4, 0x74,
+    0x0B, 0xAB, 0x75, 0x51, 0x23, 0xB4, 0x90, 0xED, 0xC9, 0x40, 0x0D, 0xD9, 0x76, 0xD0, 0xE3, 0xE9,
+    0x52, 0x16, 0xD6, 0xD8, 0x1E, 0xD6, 0x5D, 0x51, 0x36, 0xD8, 0x10, 0xB8, 0x3F, 0xA0, 0x80, 0x20,
+    0xB9, 0x39, 0xD7, 0xBC, 0xE2, 0x79, 0x82, 0x0C, 0xC7, 0x16, 0x8B, 0xC0, 0xE4, 0xFE, 0x46, 0x38,
+    0x50, 0xB2, 0x52, 0x5E, 0x00, 0xE6, 0xE4, 0xF2, 0x1B, 0x6A, 0x02, 0x8A, 0x9C, 0x97, 0xDD, 0x50,
+    0x13, 0x4F, 0x78, 0xF4, 0xF0, 0x9E, 0x89, 0x8A, 0x48, 0xF9, 0x24, 0x03, 0x56, 0x29, 0x56, 0xF0,
+    0x0B, 0x86, 0xD0, 0xE4, 0x2B, 0x44, 0x1E, 0x57, 0x05, 0xF4, 0x27, 0x28, 0x70, 0x1C, 0xAA, 0x17,
+    0x67, 0xBC, 0x7F, 0x1C, 0x42, 0x1C, 0x07, 0x7D, 0x42, 0x18, 0x0C, 0x1C, 0xA2, 0x92, 0x9C, 0x60,
+    0x75, 0x50, 0x7F, 0x3A, 0x9D, 0x6C, 0x90, 0x0A, 0xCE, 0xEA, 0xA5, 0xD1, 0x4B, 0x0A, 0x2E, 0x41,
+    0x5E, 0x66, 0xCD, 0x84, 0x54, 0x58, 0xF1, 0x1B, 0x84, 0xD5, 0xB4, 0xAC, 0xCB, 0xE2, 0xF4, 0x1C,
+    0x54, 0x30, 0x78, 0x67, 0xB8, 0x6F, 0xC5, 0x78, 0x86, 0x9F, 0x46, 0xF4, 0x7F, 0x60, 0xFF, 0x74,
+    0x80, 0x34, 0x17, 0xF1, 0xDB, 0x85, 0x03, 0x24, 0x3A, 0xB6, 0x2B, 0x69, 0xC4, 0xAC, 0x1D, 0x45,
+    0x78, 0x74, 0x01, 0xF4, 0x98, 0xAC, 0x57, 0x74, 0xB2, 0xFC, 0x26, 0xAF, 0xE4, 0x37, 0x9D, 0x88,
+    0x12, 0x51, 0xFD, 0x82, 0xE5, 0xF0, 0x5F, 0x5B, 0x56, 0x65, 0x21, 0x3A, 0xF8, 0x47, 0x70, 0x83,
+    0xC1, 0x76, 0x33, 0xA7, 0xED, 0xBF, 0x9E, 0x1F, 0xA5, 0x5E, 0x91, 0x88, 0xCA, 0x29, 0x61, 0x3C,
+    0x35, 0x7E, 0xB3, 0x21, 0x4C, 0xA3, 0xCB, 0x64, 0xAF, 0xD8, 0x7A, 0x46, 0xCE, 0xAE, 0x6C, 0x6D,
+    0xDE, 0xA4, 0x80, 0x67, 0x97, 0xE5, 0x8F, 0xAF, 0xB7, 0x86, 0x27, 0xDC, 0x84, 0x74, 0x29, 0xDA,
+    0x59, 0xAF, 0x85, 0x9A, 0xFF, 0x20, 0xEB, 0xDF, 0xC1, 0xBE, 0xCB, 0x36, 0x1A, 0xBF, 0x15, 0x90,
+    0xBD, 0x5B, 0x89, 0x2D, 0x5B, 0x66, 0x62, 0x02, 0xDF, 0x0E, 0xC9, 0xD8, 0xD5, 0x90, 0x8C, 0x8D,
+    0x48, 0xC6, 0xB1, 0x16, 0xC9, 0xE8, 0x57, 0x8E, 0xE6, 0x9C, 0x0C, 0x3D, 0x12, 0x69, 0x3F, 0x07,
+    0xDD, 0x3E, 0x2B, 0xC2, 0xF8, 0x59, 0x79, 0x64, 0x3A, 0xA9, 0x61, 0x02, 0x70, 0x23, 0x8F, 0xE4,
+    0xB0, 0x1A, 0x84, 0x7F, 0x40, 0x44, 0x0C, 0x82, 0x15, 0xA7, 0x8B, 0x83, 0x73, 0xD3, 0x7C, 0xF5,
+    0x0B, 0x0B, 0x44, 0x76, 0x21, 0xF7, 0xCC, 0x2D, 0x58, 0x8D, 0xF9, 0x23, 0x90, 0xF0, 0x7B, 0xD9,
+    0x89, 0x73, 0x5C, 0x09, 0xA6, 0x09, 0x25, 0x2D, 0x7C, 0xE9, 0xDF, 0xC4, 0x97, 0x45, 0x3C, 0xF3,
+    0x25, 0x9F, 0x09, 0x97, 0x1F, 0x45, 0x94, 0x3C, 0x92, 0x58, 0xB5, 0x23, 0xCA, 0x14, 0x76, 0x23,
+    0xD8, 0x6C, 0x85, 0x65, 0xF2, 0xB7, 0x5F, 0xBD, 0xFE, 0xF6, 0x78, 0x04, 0x6B, 0x7C, 0xD9, 0xB6,
+    0xF1, 0x10, 0x5A, 0xC1, 0x6F, 0xD4, 0x00, 0xF7, 0xDC, 0xF9, 0xC7, 0x7E, 0x56, 0x1F, 0xDB, 0xE9,
+    0x63, 0xBF, 0xAD, 0x0A, 0x4F, 0x0F, 0x4E, 0xD8, 0x28, 0xB7, 0xD4, 0xEA, 0x29, 0xA1, 0xC1, 0x1D,
+    0xA9, 0xAD, 0x16, 0xAB, 0x1C, 0xFE, 0x34, 0x8E, 0xF4, 0xDE, 0x79, 0xC0, 0x3D, 0xC1, 0x27, 0xFF,
+    0x65, 0xB7, 0x16, 0x5D, 0x81, 0x08, 0x24, 0xB8, 0xEA, 0x08, 0x53, 0x8B, 0xCA, 0x9F, 0x00, 0xAE,
+    0x08, 0x07, 0x06, 0xE3, 0xB1, 0x71, 0x8E, 0xFC, 0xF9, 0xB3, 0x8C, 0x03, 0x0B, 0xAC, 0x86, 0x10,
+    0xBB, 0x20, 0x92, 0x48, 0xE4, 0x8C, 0x70, 0x93, 0x27, 0x07, 0xE3, 0xAB, 0x17, 0x8C, 0xD9, 0xBB,
+    0x50, 0xC2, 0x2D, 0xDA, 0x47, 0x74, 0xFF, 0xAB, 0x87, 0x83, 0x99, 0x2A, 0x6D, 0x44, 0xFF, 0x46,
+    0xBC, 0xFF, 0x5F, 0x61, 0x36, 0x88, 0xEE, 0x43, 0x54, 0x32, 0x17, 0x8C, 0x21, 0x8C, 0x83, 0x63,
+    0x50, 0x41, 0x15, 0x0A, 0x75, 0x3A, 0x11, 0x20, 0x72, 0x40, 0x20, 0x46, 0xD2, 0xC6, 0xFE, 0x71,
+    0x7C, 0xDD, 0x56, 0xE5, 0x88, 0x58, 0x8D, 0x70, 0xD6, 0x21, 0x9C, 0x50, 0xA1, 0x2D, 0x83, 0x0B,
+    0xD1, 0x8D, 0xB9, 0x30, 0xFB, 0xCF, 0x62, 0x45, 0x80, 0x8D, 0x2D, 0x08, 0xC8, 0xEF, 0x8A, 0x57,
+    0xD1, 0xAF, 0xA2, 0x54, 0xAF, 0x43, 0x82, 0xCF, 0xE0, 0x09, 0xFE, 0x7C, 0x08, 0x23, 0xF9, 0x2D,
+    0x41, 0x0B, 0xA4, 0xA8, 0xCB, 0xA8, 0x49, 0x65, 0xDD, 0x34, 0xCA, 0x54, 0x46, 0xFE, 0xAA, 0x6C,
+    0x9D, 0x80, 0x96, 0x6C, 0x14, 0x19, 0x52, 0x7E, 0x53, 0xB4, 0x05, 0x96, 0x7B, 0x1A, 0x24, 0xCC,
+    0x7C, 0xC8, 0x60, 0x91, 0x4D, 0xF2, 0x06, 0xA1, 0x8B, 0x85, 0x07, 0xD2, 0xD2, 0x1B, 0xE9, 0x4F,
+    0xAB, 0x9E, 0x7E, 0x62, 0xA0, 0xF3, 0x4C, 0x84, 0x00, 0xAC, 0x84, 0x90, 0x52, 0x02, 0xBA, 0x0D,
+    0xDA, 0x0F, 0x13, 0x63, 0x2C, 0x95, 0x88, 0x1D, 0x13, 0x09, 0x61, 0xE0, 0x0A, 0x88, 0x02, 0x02,
+    0x88, 0x5B, 0xE8, 0xEA, 0x66, 0x05, 0xDC, 0x08, 0x8B, 0x5E, 0xC3, 0x35, 0xC4, 0x8E, 0x5B, 0x70,
+    0xC1, 0xA6, 0xD8, 0x3A, 0x48, 0xDC, 0x59, 0x8F, 0xA6, 0x15, 0x99, 0x4B, 0x1E, 0x23, 0x6A, 0xAC,
+    0xAC, 0xE5, 0x88, 0x11, 0xCC, 0x27, 0xEF, 0xC8, 0x41, 0x48, 0xDF, 0x80, 0xF9, 0xFE, 0x12, 0xBC,
+    0xD7, 0x8F, 0x20, 0x68, 0x13, 0x88, 0x76, 0x96, 0x59, 0xF6, 0xB9, 0xA8, 0x9C, 0xDA, 0xA3, 0x0A,
+    0x3D, 0x04, 0x5F, 0x27, 0x0C, 0x61, 0xC8, 0xBA, 0x17, 0xE8, 0xE4, 0x5A, 0xA4, 0xE1, 0xED, 0x00,
+    0xAB, 0xE4, 0xBE, 0x42, 0xE4, 0x45, 0x25, 0x9A, 0x51, 0xF0, 0x5F, 0x64, 0x2E, 0x99, 0x4D, 0x63,
+    0xE0, 0xA3, 0xDF, 0x3F, 0x60, 0x66, 0x53, 0x39, 0x2B, 0xC1, 0xAD, 0x72, 0xFF, 0x1C, 0x88, 0x5D,
+    0xCF, 0x59, 0x4C, 0xC4, 0xC0, 0x8F, 0xC2, 0xAA, 0x4D, 0xF0, 0xCE, 0xFF, 0x09, 0xAD, 0x5E, 0xC3,
+    0x35, 0x52, 0xD0, 0x3F, 0xE2, 0xE4, 0x0E, 0x15, 0xFA, 0xEA, 0x26, 0x85, 0x3E, 0xAA, 0xAA, 0x4A,
+    0x55, 0xDE, 0xAD, 0x36, 0xE5, 0xCE, 0x9A, 0x0A, 0x96, 0x27, 0x1D, 0xA2, 0xE3, 0x66, 0x5C, 0x6C,
+    0x49, 0x64, 0x98, 0x80, 0x49, 0x71, 0xB2, 0x4A, 0x4D, 0xD8, 0x9B, 0xD3, 0xF5, 0x6E, 0x87, 0x0D,
+    0xF3, 0x5E, 0x0A, 0x7E, 0xFF, 0x19, 0x72, 0x33, 0xA3, 0x22, 0xEF, 0xA1, 0xE0, 0xCD, 0x31, 0x86,
+    0xFB, 0x1B, 0x5F, 0x0C, 0x88, 0xA0, 0x0F, 0xDA, 0xB0, 0xF7, 0x0A, 0x98, 0xFF, 0x01, 0xDD, 0x78,
+    0x23, 0x4C, 0xA4, 0x4C, 0xC4, 0x36, 0xBD, 0x8F, 0xC7, 0x65, 0x1D, 0x29, 0xAC, 0xBA, 0x2C, 0x2D,
+    0x92, 0x1F, 0x81, 0x9D, 0x7B, 0x9D, 0xC7, 0x51, 0xE8, 0x29, 0x9F, 0xD9, 0x49, 0xE6, 0xC2, 0x01,
+    0xC0, 0x96, 0xA3, 0x1A, 0x2D, 0x0E, 0xC3, 0x0E, 0xA4, 0x82, 0x51, 0x48, 0xCF, 0xA6, 0x3A, 0x36,
+    0xF1, 0xFF, 0x8B, 0x50, 0xC4, 0x49, 0x0F, 0xBA, 0x78, 0x26, 0x8B, 0xBE, 0xD3, 0x26, 0x3F, 0xE8,
+    0x92, 0x57, 0xDA, 0xC3, 0x0F, 0x9F, 0xFB, 0xD0, 0xF7, 0xD1, 0x85, 0x11, 0xDA, 0x68, 0x4C, 0xC8,
+    0xDC, 0x77, 0xE0, 0x8F, 0x90, 0xB3, 0x8B, 0x83, 0x6B, 0x34, 0x62, 0x2C, 0xDF, 0x93, 0x9A, 0x7D,
+    0x81, 0x06, 0x58, 0x36, 0xE4, 0x0A, 0xE4, 0x56, 0xBC, 0x48, 0x03, 0xC7, 0x83, 0x95, 0xCB, 0xB3,
+    0x2B, 0xA8, 0x9C, 0x81, 0x2E, 0x8E, 0x21, 0x44, 0xD4, 0xCC, 0x67, 0x74, 0xEF, 0xCF, 0x9E, 0x51,
+    0x2F, 0x3E, 0x65, 0x72, 0xA7, 0xFE, 0xFD, 0xD6, 0x5D, 0x88, 0xD3, 0xBC, 0x9A, 0x48, 0x4D, 0x90,
+    0xFB, 0x4F, 0x9E, 0xC1, 0x25, 0xC7, 0x71, 0x0D, 0x8B, 0xF2, 0x45, 0x78, 0x32, 0x32, 0x42, 0xD6,
+    0x88, 0xC6, 0x25, 0x81, 0xBC, 0x60, 0x57, 0x42, 0xF9, 0x3A, 0x85, 0x6D, 0xCD, 0x80, 0x75, 0x2A,
+    0xC4, 0x47, 0xBC, 0xD3, 0xC9, 0x86, 0xA3, 0x5C, 0xD5, 0x89, 0x73, 0x50, 0xAD, 0x59, 0xAA, 0xB8,
+    0x27, 0xD7, 0x0B, 0xD8, 0xC7, 0x9F, 0xC8, 0x41, 0x84, 0x60, 0xF0, 0x77, 0x9D, 0xB1, 0x67, 0xD4,
+    0x7D, 0x4F, 0xCF, 0xD8, 0xB7, 0xEC, 0xB7, 0x98, 0xDB, 0x31, 0xD1, 0xB0, 0xA5, 0x62, 0x22, 0xE6,
+    0xA6, 0x7E, 0xC2, 0x5B, 0x00, 0x47, 0x7D, 0xF5, 0x9E, 0x7C, 0x13, 0x07, 0x40, 0x38, 0x4E, 0xDD,
+    0xC7, 0xA7, 0x7F, 0x11, 0x87, 0xEF, 0xD6, 0x68, 0xDA, 0xA5, 0x98, 0x69, 0x96, 0x06, 0x3D, 0x64,
+    0x78, 0xD2, 0x93, 0xEB, 0xB3, 0xBA, 0xED, 0xB6, 0x18, 0x71, 0x21, 0x8F, 0x3B, 0x9F, 0xE8, 0x13,
+    0x51, 0x3E, 0xB1, 0x9E, 0x48, 0x7D, 0xA7, 0x6C, 0x59, 0x0F, 0x1E, 0xFB, 0x40, 0x58, 0x04, 0x88,
+    0x37, 0x9C, 0x2E, 0x63, 0x67, 0x41, 0xED, 0x5F, 0x5A, 0x96, 0xFA, 0xF1, 0xA0, 0xE5, 0xDB, 0xBA,
+    0xDE, 0xC7, 0xB0, 0xDE, 0xE6, 0x88, 0x03, 0x31, 0xC9, 0x41, 0x1A, 0x2A, 0xC8, 0xFE, 0x3C, 0x1E,
+    0xF7, 0xED, 0x83, 0x43, 0x2C, 0x3B, 0x20, 0x4A, 0xB3, 0x4F, 0x79, 0xDB, 0xD1, 0xD2, 0x29, 0x3C,
+    0xD1, 0x6A, 0x32, 0x13, 0x2D, 0x28, 0x33, 0x79, 0xBC, 0x8C, 0x34, 0xAA, 0x8C, 0xE2, 0x2C, 0xD3,
+    0xF3, 0xE2, 0xB7, 0x6A, 0x84, 0xC0, 0x1D, 0x98, 0x76, 0x21, 0xA2, 0x29, 0x25, 0xF2, 0x04, 0xC4,
+    0x9E, 0xED, 0x62, 0xE1, 0xD2, 0xAF, 0xBF, 0xDA, 0xED, 0xC8, 0x73, 0xBF, 0xF1, 0x34, 0x22, 0x46,
+    0xE5, 0xEB, 0x84, 0xD2, 0xE5, 0x40, 0xCC, 0x5C, 0xF6, 0x8C, 0x11, 0x95, 0x2D, 0x51, 0x55, 0x59,
+    0x51, 0x19, 0xE4, 0x05, 0xA2, 0x2B, 0xC7, 0xEA, 0xAD, 0x67, 0xCC, 0xE5, 0x52, 0x84, 0xA8, 0x37,
+    0x7D, 0x59, 0x00, 0xBF, 0x79, 0x21, 0x00, 0x64, 0x7D, 0x42, 0x40, 0xC1, 0x60, 0xCE, 0xFA, 0x18,
+    0x2F, 0xFB, 0x22, 0xA4, 0x4D, 0xE7, 0x8D, 0xF2, 0x5F, 0xEB, 0x8D, 0xFE, 0x18, 0xD4, 0xDE, 0x18,
+    0x4E, 0x32, 0x83, 0xF1, 0xF8, 0x24, 0xDB, 0x33, 0x3D, 0x3E, 0x3D, 0x28, 0x63, 0x3B, 0x5D, 0x82,
+    0x4B, 0x99, 0x46, 0x39, 0x4F, 0xCF, 0x40, 0x7F, 0x7B, 0xAA, 0x49, 0x2B, 0xFD, 0x5A, 0xF2, 0x2D,
+    0x82, 0x93, 0x05, 0x86, 0x2C, 0x16, 0xCB, 0x23, 0x7B, 0x70, 0x35, 0x44, 0xB3, 0xEF, 0x18, 0x2E,
+    0x74, 0x40, 0x22, 0xF8, 0x4F, 0x91, 0x96, 0x44, 0x9F, 0x7E, 0xE4, 0xB6, 0x81, 0xFE, 0xC1, 0x12,
+    0xC9, 0x5A, 0x62, 0x24, 0xC3, 0x52, 0xCE, 0x9B, 0xFB, 0x71, 0x2B, 0x7A, 0xCF, 0x4F, 0x5C, 0x08,
+    0xE9, 0xBA, 0x49, 0x99, 0x97, 0xF5, 0x0E, 0x33, 0x07, 0x9E, 0xA2, 0x12, 0x80, 0xBC, 0x5B, 0x81,
+    0xA2, 0x22, 0x8E, 0x35, 0xDA, 0x2B, 0x40, 0x4A, 0x6C, 0x98, 0xC0, 0x5E, 0x1C, 0x90, 0x2B, 0x1D,
+    0x4C, 0xD0, 0x91, 0xBE, 0x05, 0x9E, 0x91, 0x51, 0xEC, 0xD6, 0x60, 0x12, 0xAB, 0x79, 0x0C, 0x47,
+    0xC0, 0xAF, 0xB2, 0x43, 0xB6, 0xA8, 0xE6, 0x66, 0x9D, 0xDE, 0x70, 0x10, 0x8B, 0x18, 0xD2, 0xF0,
+    0x4F, 0x67, 0x4A, 0xB8, 0x4D, 0x19, 0x74, 0xF2, 0x34, 0x2D, 0x2C, 0x46, 0x7A, 0x0E, 0x04, 0xB3,
+    0xC8, 0x35, 0xCD, 0x0F, 0x90, 0x3B, 0x3C, 0x63, 0xD4, 0xEE, 0xD6, 0x58, 0x6A, 0xE0, 0x10, 0x6E,
+    0x17, 0x6A, 0xDE, 0x4A, 0x62, 0x5D, 0x3A, 0x51, 0x3A, 0xC7, 0xBF, 0xB8, 0x72, 0xCD, 0x18, 0xD3,
+    0x10, 0xA8, 0x66, 0xAA, 0x69, 0x6C, 0xCA, 0xBD, 0x60, 0xC6, 0x9A, 0x46, 0xA8, 0xA0, 0x02, 0x20,
+    0xDD, 0x05, 0xB6, 0xC1, 0x74, 0x01, 0xA8, 0x13, 0xD5, 0x5B, 0xD0, 0x67, 0x55, 0x6A, 0x30, 0xA7,
+    0xD3, 0x29, 0x2F, 0xE9, 0x81, 0x27, 0xF6, 0x44, 0x02, 0xD6, 0x62, 0xC2, 0x44, 0x16, 0xD9, 0x49,
+    0xF9, 0x23, 0x62, 0x0A, 0x62, 0x9F, 0x85, 0x04, 0x83, 0x19, 0x56, 0xBD, 0x30, 0xCA, 0x69, 0x41,
+    0xC3, 0xAD, 0xEE, 0xD9, 0xC8, 0x8C, 0x27, 0xE0, 0x8A, 0x94, 0x8A, 0x5F, 0x75, 0x8B, 0x02, 0x00,
+    0x59, 0xF0, 0x39, 0xEC, 0x4F, 0x40, 0x11, 0x29, 0x6C, 0x50, 0x20, 0x43, 0x66, 0x41, 0x14, 0x61,
+    0x77, 0x10, 0xC8, 0xD5, 0x88, 0x6D, 0xCE, 0xF1, 0xA7, 0xF4, 0x5C, 0xBE, 0x41, 0x6F, 0xF3, 0x4B,
+    0xF8, 0xFB, 0xE8, 0x6B, 0x0C, 0x1D, 0x91, 0x4A, 0x29, 0xBD, 0x7D, 0xEA, 0xD7, 0xFE, 0xFB, 0x01,
+    0x49, 0x19, 0xAF, 0xF5, 0xA2, 0xBF, 0xC2, 0x97, 0x3B, 0x88, 0xBD, 0x47, 0x11, 0xAB, 0x38, 0xB9,
+    0x6A, 0xE5, 0xB8, 0x9D, 0x8D, 0x1A, 0x11, 0xB2, 0x7D, 0x24, 0xF8, 0xDB, 0x6F, 0x63, 0x31, 0x4B,
+    0x93, 0x21, 0x7E, 0xD1, 0x8E, 0xF9, 0x90, 0xBC, 0x4C, 0x6F, 0xF8, 0x85, 0x39, 0x10, 0x10, 0xE3,
+    0x41, 0xA7, 0xF0, 0x9C, 0x3F, 0x87, 0x12, 0x84, 0x17, 0x31, 0xA8, 0x54, 0x9A, 0x02, 0x17, 0xCB,
+    0x59, 0xD9, 0x7E, 0x41, 0xEE, 0x7A, 0x49, 0xAC, 0x5F, 0xAF, 0x1D, 0xD2, 0x26, 0xF8, 0xAE, 0x70,
+    0xC8, 0xEA, 0x25, 0x19, 0x76, 0xE5, 0xD1, 0x53, 0xF9, 0xC3, 0x6B, 0x72, 0x3F, 0x6C, 0x38, 0xCF,
+    0x77, 0x4E, 0x5E, 0x2F, 0x94, 0xA9, 0x29, 0x8B, 0xA0, 0x89, 0xC3, 0xD2, 0xBD, 0x88, 0xA0, 0xD3,
+    0x70, 0xD4, 0x4E, 0x42, 0xBF, 0x30, 0x27, 0x25, 0x69, 0xF4, 0x05, 0xD5, 0x2B, 0xFC, 0x61, 0xF4,
+    0x8C, 0x25, 0x73, 0xC4, 0x93, 0x3B, 0x6F, 0x19, 0xB1, 0x31, 0x71, 0xFA, 0x74, 0x4F, 0xB5, 0xBD,
+    0xC3, 0x17, 0x32, 0xAB, 0xCB, 0xE9, 0xE7, 0x07, 0x2A, 0xA7, 0x2E, 0x0F, 0x99, 0xC8, 0xE1, 0x37,
+    0x25, 0x5F, 0x64, 0x61, 0x35, 0x31, 0xC1, 0x43, 0xE4, 0x29, 0xFC, 0x59, 0x10, 0x25, 0x1E, 0x2C,
+    0xA0, 0xC4, 0xFE, 0xB5, 0x7D, 0x69, 0x88, 0x45, 0x6D, 0xD9, 0x9F, 0xDA, 0x97, 0x87, 0xD4, 0xD6,
+    0xB2, 0xE1, 0xE6, 0x44, 0xC1, 0x84, 0x1A, 0x8D, 0x43, 0xF8, 0x08, 0x4B, 0x88, 0x5D, 0x24, 0x96,
+    0xB9, 0x5C, 0x22, 0x99, 0x8E, 0xCC, 0xF8, 0xB8, 0xEC, 0xB8, 0x4C, 0x73, 0x3B, 0xEA, 0x34, 0xD9,
+    0xAF, 0x5F, 0x92, 0xFD, 0xDA, 0xE0, 0x95, 0x1F, 0x43, 0x32, 0xAE, 0xBE, 0xF0, 0x1A, 0xFC, 0x3C,
+    0x71, 0xF4, 0xB2, 0x48, 0xAF, 0x6A, 0x3B, 0x7E, 0x09, 0xAA, 0xFB, 0x72, 0x22, 0x9B, 0x57, 0xFE,
+    0xC5, 0x98, 0x7E, 0xC3, 0x36, 0xF6, 0xE9, 0x29, 0xFD, 0x32, 0x53, 0x5C, 0x5C, 0xCE, 0xB8, 0x5E,
+    0x44, 0xFD, 0xA3, 0x46, 0x06, 0xF7, 0xAF, 0x28, 0x0F, 0x81, 0xDA, 0x85, 0xD7, 0x2E, 0x53, 0x86,
+    0xFB, 0x9A, 0x44, 0x47, 0x0F, 0xBE, 0x49, 0x5F, 0x77, 0x61, 0x8D, 0x42, 0x13, 0x4B, 0x98, 0xCE,
+    0x16, 0xBF, 0x41, 0xBC, 0x93, 0x34, 0x0C, 0x7F, 0xD1, 0xFD, 0x1B, 0xD3, 0xEB, 0x8B, 0x22, 0x8A,
+    0xAA, 0x04, 0xBE, 0xC9, 0x0B, 0xD9, 0x1B, 0x99, 0x47, 0x96, 0x67, 0x70, 0xEE, 0x64, 0x79, 0x95,
+    0x0C, 0x02, 0x3D, 0xD3, 0x2E, 0xAF, 0x63, 0xDB, 0xCA, 0xEA, 0xBC, 0xBD, 0xBD, 0xBD, 0x0B, 0x40,
+    0xB1, 0x72, 0x4B, 0xCF, 0x9E, 0x79, 0x0C, 0x72, 0x32, 0x43, 0xCC, 0x3D, 0xAD, 0x4E, 0x31, 0x5D,
+    0x96, 0x51, 0x84, 0x77, 0x6A, 0x26, 0xF8, 0x03, 0x52, 0xBD, 0x33, 0xE1, 0xFE, 0x42, 0x3F, 0xE1,
+    0xE9, 0x47, 0x06, 0x14, 0x5A, 0x88, 0x0C, 0x17, 0x01, 0xB1, 0xEA, 0x93, 0x0A, 0xAE, 0x93, 0xB8,
+    0xD9, 0x6D, 0xF3, 0x49, 0x94, 0x71, 0x61, 0xA7, 0xAD, 0x01, 0xFC, 0xE1, 0x6B, 0xCE, 0xA1, 0x30,
+    0x48, 0xA0, 0xAF, 0xB0, 0x2B, 0x13, 0x6D, 0x14, 0xEE, 0x18, 0x62, 0xF1, 0x7C, 0x95, 0x17, 0x58,
+    0x33, 0x98, 0x44, 0x6E, 0x55, 0xCD, 0xF0, 0x2D, 0xD6, 0x38, 0xAA, 0xD0, 0xE7, 0x09, 0xA7, 0xBC,
+    0x83, 0xB1, 0x9B, 0x45, 0x04, 0xF3, 0x50, 0x94, 0x53, 0x98, 0xD6, 0x88, 0x1C, 0x77, 0xEB, 0x50,
+    0x78, 0xFA, 0xE2, 0x84, 0xC3, 0x8A, 0xC0, 0xFB, 0xD7, 0xF8, 0x0A, 0xB1, 0x77, 0x7F, 0x84, 0xA0,
+    0x47, 0x04, 0x26, 0x18, 0x70, 0x0E, 0xE1, 0xA9, 0x90, 0x57, 0x3D, 0x19, 0xA6, 0x0B, 0xFB, 0x80,
+    0x29, 0xBC, 0xC2, 0xE7, 0x10, 0xFC, 0x89, 0x7D, 0xC3, 0x56, 0x17, 0xA7, 0x87, 0x45, 0xB9, 0xD8,
+    0x9F, 0x0A, 0xF9, 0x90, 0x18, 0x21, 0x4C, 0x73, 0x42, 0x68, 0x06, 0x57, 0x07, 0x9E, 0x0B, 0xE0,
+    0x93, 0x5C, 0x3B, 0xF3, 0x24, 0x19, 0x06, 0xDA, 0x89, 0x41, 0x76, 0x51, 0xDB, 0xB2, 0x0C, 0x7F,
+    0x94, 0xB9, 0x63, 0xEA, 0xF6, 0x79, 0x95, 0x19, 0x56, 0xED, 0x3A, 0x5B, 0xBE, 0xD9, 0xB2, 0x30,
+    0x25, 0xFD, 0x8E, 0xEC, 0x39, 0xDC, 0x48, 0x5F, 0xEF, 0xC1, 0x3F, 0x4D, 0xF9, 0xF5, 0x81, 0x5B,
+    0x67, 0x1F, 0x81, 0x7C, 0x17, 0x0A, 0xC2, 0x71, 0xF7, 0x1D, 0xBB, 0xB2, 0xDF, 0xB5, 0x85, 0x7D,
+    0x5A, 0xF4, 0x56, 0x83, 0x88, 0x64, 0xB3, 0x05, 0xA7, 0x0F, 0x0E, 0xCD, 0xA9, 0x17, 0x4E, 0x2B,
+    0xB0, 0xF5, 0x10, 0x9D, 0x8B, 0x91, 0x2C, 0xCC, 0x3C, 0x61, 0x86, 0x05, 0x4B, 0x0C, 0x27, 0x9D,
+    0x99, 0x33, 0x27, 0xD2, 0x20, 0x8B, 0xEB, 0xF0, 0x45, 0x86, 0x66, 0x1B, 0x1A, 0x0E, 0x4B, 0x98,
+    0x84, 0x38, 0x6F, 0x6D, 0x98, 0xEB, 0x45, 0x60, 0x48, 0xFC, 0x36, 0x65, 0xA5, 0x18, 0x19, 0xF4,
+    0x2E, 0x30, 0xBF, 0xFA, 0x49, 0x73, 0x4C, 0x54, 0xD2, 0x43, 0x9A, 0xFA, 0x3A, 0x18, 0xFF, 0x59,
+    0x42, 0x0D, 0x04, 0x14, 0x08, 0x2B, 0x56, 0x55, 0x9E, 0x99, 0xE0, 0xAF, 0x99, 0xDC, 0x00, 0x3C,
+    0xC9, 0xAC, 0x8A, 0x37, 0xB1, 0xDB, 0xD8, 0x79, 0x2A, 0x86, 0xCB, 0x9E, 0x86, 0x2F, 0x1C, 0x18,
+    0xA3, 0x5D, 0x7E, 0x82, 0xD8, 0x90, 0x53, 0xD6, 0x70, 0x26, 0x43, 0x6E, 0x73, 0x89, 0xCB, 0x27,
+    0x71, 0x3C, 0xA9, 0x14, 0xFF, 0x72, 0x9E, 0x46, 0x6A, 0x8E, 0x15, 0x98, 0x46, 0xAB, 0xDE, 0x10,
+    0xFF, 0x59, 0x97, 0x0F, 0x21, 0x12, 0x35, 0xB1, 0x43, 0x32, 0xE1, 0xD2, 0xA7, 0xA3, 0xFA, 0x6E,
+    0xC4, 0xEE, 0xA3, 0xB7, 0x9A, 0x10, 0xB9, 0x74, 0x10, 0x79, 0x76, 0x65, 0x1E, 0xB8, 0x70, 0xF0,
+    0x47, 0xD8, 0x15, 0xA2, 0x1E, 0x31, 0x65, 0x7B, 0x30, 0x21, 0xFC, 0x1F, 0xAB, 0xEB, 0x49, 0x5B,
+    0x56, 0x3C, 0x2C, 0x98, 0xF5, 0x27, 0xE1, 0x66, 0x71, 0x46, 0xE3, 0x92, 0x88, 0xAB, 0x84, 0x9B,
+    0xF3, 0x97, 0x8F, 0x31, 0xFD, 0xC9, 0x25, 0x2C, 0xCE, 0x5F, 0xDD, 0x3C, 0x78, 0xD8, 0x15, 0x1E,
+    0x73, 0x96, 0xCA, 0x09, 0x98, 0x39, 0xD6, 0x84, 0xDF, 0x6B, 0x6C, 0xBF, 0x7A, 0xA5, 0xBF, 0x38,
+    0x44, 0xAF, 0x0C, 0x82, 0x05, 0xAA, 0x31, 0xEA, 0xE3, 0x62, 0x47, 0x8E, 0x77, 0x71, 0x52, 0x0E,
+    0x77, 0xF6, 0x69, 0x19, 0xCC, 0x83, 0x49, 0x93, 0x9B, 0x07, 0xD2, 0xA6, 0x34, 0xDB, 0x69, 0x3D,
+    0x99, 0x3F, 0x48, 0x9B, 0x51, 0xCC, 0x92, 0xB7, 0xC6, 0xB0, 0x8A, 0xED, 0x58, 0x66, 0x2B, 0xEC,
+    0x88, 0xC7, 0xA0, 0x31, 0x3D, 0x8D, 0xAB, 0x03, 0x0F, 0x5B, 0x7B, 0x73, 0xB5, 0x90, 0xFB, 0x22,
+    0xFD, 0x7D, 0x4A, 0x16, 0x55, 0xC7, 0x38, 0xDA, 0x90, 0x1D, 0x2E, 0x5B, 0x81, 0x2E, 0x6C, 0xA7,
+    0x73, 0x45, 0x78, 0x5C, 0x7B, 0x06, 0x49, 0xB3, 0x3C, 0x11, 0xE9, 0x54, 0xC2, 0x1F, 0xD4, 0x86,
+    0x18, 0x1B, 0xF3, 0x3B, 0xB4, 0x7A, 0xD4, 0xDA, 0x50, 0x38, 0xA7, 0xF9, 0x09, 0x90, 0x9F, 0x60,
+    0x77, 0xFC, 0xB3, 0x44, 0xA2, 0xCF, 0x55, 0xFA, 0x42, 0xD5, 0xD1, 0x45, 0x30, 0xB1, 0x25, 0x1C,
+    0x96, 0x0B, 0xD6, 0x9F, 0x56, 0xC3, 0x8A, 0x0E, 0x58, 0x7F, 0x82, 0xCD, 0x90, 0x7E, 0xDF, 0xB7,
+    0xB9, 0xBD, 0x3A, 0x95, 0x57, 0xED, 0x64, 0x8B, 0xC7, 0x46, 0x28, 0x77, 0x38, 0xE0, 0x90, 0x35,
+    0x90, 0xD6, 0xB9, 0xAC, 0x19, 0x5E, 0x91, 0x8E, 0x4A, 0x1C, 0xE6, 0xF2, 0xAA, 0x81, 0x2E, 0xCA,
+    0x3B, 0xC4, 0xE3, 0x2D, 0xF6, 0x38, 0x68, 0xCF, 0xB9, 0x94, 0xAB, 0x09, 0x29, 0x57, 0xA2, 0x0B,
+    0x4E, 0x12, 0x29, 0x6F, 0x73, 0xBC, 0x44, 0xDF, 0x2C, 0xE3, 0xB7, 0x0F, 0x83, 0x1E, 0xF6, 0x11,
+    0x5A, 0x3C, 0x9F, 0xE7, 0x01, 0x78, 0x9A, 0x5B, 0xFA, 0x67, 0x1C, 0x2F, 0x73, 0x97, 0xBB, 0x83,
+    0x3C, 0x26, 0x4D, 0xC0, 0xD6, 0xED, 0xA7, 0x1B, 0xF4, 0x84, 0x80, 0x9A, 0x4B, 0x39, 0xD2, 0xBC,
+    0x60, 0xE8, 0xFE, 0x3F, 0x61, 0xA0, 0x53, 0x90, 0xE7, 0x67, 0x61, 0xB7, 0x09, 0x73, 0x8E, 0x9E,
+    0xD0, 0x65, 0x0A, 0x10, 0xAD, 0x5D, 0x21, 0x58, 0x11, 0xE1, 0x09, 0xC7, 0x31, 0x20, 0xC7, 0xC2,
+    0x5E, 0x9A, 0x4B, 0x12, 0x34, 0xBB, 0xAD, 0x5A, 0x9C, 0xD9, 0x0F, 0x81, 0x3A, 0xF1, 0x6B, 0x3C,
+    0x0B, 0x2D, 0x31, 0x42, 0x4F, 0xE6, 0xBF, 0xCC, 0xDC, 0xA8, 0xA3, 0x4B, 0xF1, 0xE0, 0xC7, 0xBB,
+    0x78, 0xF3, 0x45, 0x84, 0x75, 0xCB, 0x08, 0xC2, 0xF7, 0x4F, 0xA0, 0xD6, 0x5E, 0x04, 0xCC, 0x6D,
+    0x21, 0xB4, 0x4F, 0x3B, 0xEB, 0xEA, 0xCE, 0xD0, 0x67, 0xED, 0x6B, 0x77, 0x4E, 0x6A, 0x09, 0xAD,
+    0x0B, 0x5A, 0xF1, 0x24, 0xBB, 0xDA, 0xA0, 0x22, 0x18, 0xE6, 0x62, 0x21, 0x87, 0x37, 0xE9, 0xF2,
+    0x3B, 0x7C, 0x41, 0xA6, 0x21, 0x13, 0x12, 0x85, 0xCA, 0x08, 0x07, 0x34, 0x00, 0x05, 0x44, 0x0C,
+    0xBF, 0x20, 0x84, 0x01, 0xA2, 0x50, 0xBE, 0x85, 0x19, 0x92, 0x31, 0x91, 0x01, 0xAF, 0xE0, 0x89,
+    0xA1, 0x4A, 0x3D, 0x49, 0x16, 0xC7, 0x3B, 0xB7, 0xF1, 0x8A, 0xD1, 0xF3, 0x4B, 0x2E, 0x4F, 0x34,
+    0xAF, 0x98, 0x0A, 0x26, 0x27, 0x2E, 0x7D, 0xA9, 0x76, 0x85, 0xA2, 0xE9, 0x77, 0x2A, 0x9C, 0x43,
+    0x64, 0x36, 0xBC, 0x0E, 0x30, 0x0C, 0x14, 0x9E, 0x8C, 0x73, 0x06, 0x69, 0x3C, 0xCC, 0x21, 0x6D,
+    0x9E, 0x55, 0xF8, 0x65, 0x5D, 0xE1, 0x95, 0xFA, 0xE0, 0xE6, 0x57, 0x4F, 0x2E, 0xEE, 0xB7, 0x45,
+    0xB4, 0xC4, 0xF3, 0x69, 0xB6, 0x76, 0xE6, 0x88, 0xF2, 0x8A, 0x9A, 0x5A, 0x93, 0xF9, 0xEA, 0x39,
+    0x1F, 0x79, 0xBA, 0xB5, 0x6D, 0x81, 0xE8, 0x61, 0x21, 0x87, 0x02, 0x69, 0xA1, 0xB0, 0xCD, 0x00,
+    0x09, 0x88, 0xAB, 0x40, 0x3C, 0xF9, 0x99, 0xE9, 0x91, 0x7F, 0x20, 0x87, 0xB4, 0xC5, 0x91, 0x17,
+    0xA1, 0x28, 0xD7, 0x15, 0x22, 0x23, 0x15, 0x6A, 0x41, 0x44, 0xD1, 0x17, 0x70, 0x32, 0xF8, 0x13,
+    0xA2, 0x94, 0x71, 0xEB, 0x4D, 0xA8, 0xE7, 0x83, 0x55, 0xFF, 0xB8, 0xB0, 0x84, 0x9C, 0x6B, 0x8A,
+    0xE2, 0x89, 0x49, 0xE0, 0xB4, 0x70, 0x21, 0x0F, 0x81, 0xAE, 0x73, 0x37, 0xA5, 0xCB, 0x2E, 0x91,
+    0xC5, 0x6D, 0xCA, 0x6A, 0x96, 0xD7, 0x99, 0xFA, 0xBB, 0x75, 0x35, 0x2B, 0xEB, 0x16, 0xFA, 0xEF,
+    0xCC, 0x62, 0xCF, 0xD2, 0x65, 0xE1, 0x33, 0xA3, 0x23, 0xBA, 0x26, 0x42, 0x40, 0x78, 0xEF, 0x08,
+    0x9E, 0x9B, 0x69, 0xB0, 0x4D, 0xB3, 0x8B, 0x34, 0xD1, 0x48, 0x46, 0xCD, 0xCA, 0x23, 0xB2, 0x64,
+    0x7A, 0x0F, 0x53, 0x50, 0x90, 0xC9, 0xC8, 0xC4, 0x3C, 0xCD, 0x33, 0x66, 0xE6, 0x3A, 0x47, 0xDA,
+    0x99, 0x4C, 0x5C, 0x81, 0xB6, 0x09, 0x87, 0x17, 0x92, 0x86, 0x62, 0x3E, 0xC3, 0x63, 0xBB, 0x65,
+    0x0A, 0x6B, 0x5E, 0x4F, 0x7A, 0x0D, 0xB6, 0xB4, 0xD8, 0x46, 0x58, 0x67, 0xFA, 0xC3, 0xC9, 0x05,
+    0x2D, 0x5D, 0xBC, 0xB2, 0x2C, 0x30, 0xB7, 0x82, 0xD5, 0x80, 0xA5, 0x26, 0x7D, 0xA0, 0x9E, 0x11,
+    0x45, 0x80, 0x8C, 0x94, 0xD2, 0xEE, 0x4C, 0xBF, 0x9F, 0x50, 0x71, 0x21, 0x3D, 0x9E, 0x40, 0x06,
+    0xAB, 0xFE, 0x84, 0x7B, 0xC0, 0x0B, 0x99, 0xF3, 0xCC, 0x5C, 0xCF, 0x34, 0xB1, 0x51, 0x63, 0x01,
+    0xC7, 0x3D, 0xA5, 0xCD, 0xD1, 0xD8, 0x39, 0x4E, 0x5D, 0xB9, 0x93, 0x89, 0xDC, 0xF5, 0x9F, 0xBB,
+    0xEB, 0xF9, 0xCD, 0xE2, 0xEB, 0x9E, 0x4C, 0x26, 0xE7, 0x82, 0xA9, 0x22, 0x49, 0x9D, 0x3F, 0x32,
+    0x08, 0x12, 0x92, 0x69, 0x3E, 0xDA, 0x05, 0xCC, 0xF5, 0x0C, 0x60, 0xFD, 0x8D, 0xE6, 0x33, 0xE6,
+    0x7C, 0x30, 0x6A, 0xBA, 0x6B, 0xA0, 0x65, 0x1B, 0x72, 0xD5, 0x12, 0x14, 0x38, 0xC2, 0x79, 0xB8,
+    0x46, 0x4D, 0xE7, 0x5C, 0x8D, 0xAA, 0x40, 0xA2, 0x61, 0xF3, 0x9A, 0x74, 0xAE, 0xB6, 0x07, 0xD4,
+    0x3E, 0x0C, 0x0F, 0x9E, 0xFC, 0x7D, 0xAC, 0x29, 0x56, 0x02, 0xF2, 0x98, 0x89, 0x2F, 0xBC, 0xC1,
+    0x34, 0x51, 0xFB, 0x3D, 0xAD, 0xC6, 0x14, 0x4B, 0x62, 0xD2, 0xF2, 0x5C, 0x27, 0xCE, 0x7E, 0xC9,
+    0x1D, 0xD5, 0x2B, 0x4A, 0x04, 0x05, 0x06, 0xFF, 0x89, 0x34, 0xB8, 0xF7, 0xF0, 0xB1, 0x6A, 0xED,
+    0x34, 0x44, 0x7A, 0x59, 0xE9, 0x42, 0x3F, 0x77, 0xB3, 0x54, 0x38, 0x36, 0xC2, 0xA9, 0x28, 0xC7,
+    0xE2, 0x29, 0xD9, 0xD1, 0x60, 0x88, 0x5F, 0x1E, 0x92, 0x2A, 0x6A, 0xA3, 0x97, 0xDB, 0xA8, 0x89,
+    0x9B, 0xC8, 0x6B, 0xE1, 0xBD, 0xA7, 0x72, 0xA4, 0x4C, 0x89, 0xDB, 0xD2, 0x5D, 0x0A, 0x8A, 0x0F,
+    0x1E, 0xA6, 0xB4, 0xE6, 0x45, 0x40, 0x59, 0x66, 0x74, 0x4B, 0x99, 0xE1, 0x9F, 0x36, 0x71, 0xB7,
+    0x82, 0x25, 0xC8, 0x78, 0x5F, 0x88, 0x7C, 0xDF, 0x82, 0xBE, 0xA4, 0xD3, 0xEA, 0xD3, 0xD9, 0xC3,
+    0x26, 0x44, 0x17, 0xAF, 0xE2, 0x86, 0x9F, 0x08, 0xFC, 0xEC, 0x86, 0x89, 0xDD, 0x85, 0x2E, 0x10,
+    0x18, 0x04, 0x17, 0x98, 0x5D, 0x82, 0x9F, 0x55, 0xE7, 0x7F, 0x6D, 0x93, 0x92, 0x77, 0xDA, 0x41,
+    0x32, 0x63, 0x11, 0x1C, 0xBF, 0x8B, 0xC8, 0x4F, 0x45, 0x9E, 0x60, 0x45, 0x9C, 0xE6, 0x23, 0x2B,
+    0xCB, 0x6F, 0xC2, 0x25, 0x91, 0xED, 0xC6, 0x3C, 0xF1, 0xCD, 0xFA, 0xE7, 0xB4, 0x99, 0x7F, 0xC6,
+    0x72, 0x64, 0xAD, 0xF1, 0xB5, 0xE7, 0x18, 0x18, 0xAB, 0x1C, 0xDC, 0xF1, 0xB4, 0x20, 0xDA, 0xDC,
+    0x54, 0x10, 0x8D, 0x9C, 0x79, 0x2D, 0xB5, 0xDE, 0xB2, 0xC4, 0x24, 0xDE, 0x28, 0x53, 0x91, 0xFF,
+    0x04, 0x33, 0xB6, 0x49, 0xE3, 0x67, 0x8B, 0x07, 0x79, 0x71, 0xED, 0xAB, 0xA4, 0xC3, 0xCF, 0xD2,
+    0xF6, 0x88, 0x70, 0x04, 0x34, 0xC6, 0xAD, 0x5C, 0xCE, 0xF3, 0x1B, 0x66, 0x5E, 0xF0, 0x6A, 0x26,
+    0xF1, 0x7E, 0x4E, 0xEC, 0xBC, 0xFC, 0xCB, 0x1A, 0xEA, 0xA3, 0xB0, 0x01, 0x09, 0xFE, 0x7E, 0x38,
+    0x12, 0xD4, 0x9F, 0xDB, 0x81, 0xEB, 0xEF, 0x75, 0x97, 0xD6, 0xC7, 0xF7, 0x8A, 0x5E, 0x7A, 0x4B,
+    0xCC, 0xD4, 0xFA, 0x53, 0x46, 0x7E, 0x65, 0xC2, 0xF5, 0x1D, 0x3A, 0x2B, 0xB0, 0x57, 0xF6, 0x0E,
+    0xA1, 0x40, 0xA7, 0x15, 0xFA, 0xFB, 0xC5, 0xF8, 0x9F, 0x5E, 0x28, 0x0B, 0x68, 0xD2, 0x4F, 0x3D,
+    0xDF, 0x7D, 0x7B, 0x5B, 0x44, 0x4C, 0x2A, 0xE2, 0xE2, 0x5E, 0xF3, 0xDC, 0xCC, 0x87, 0xA8, 0x47,
+    0x11, 0x09, 0xF4, 0xC4, 0x31, 0x9B, 0x3D, 0x67, 0x76, 0x37, 0xB6, 0xDC, 0x3B, 0x50, 0xA9, 0x4E,
+    0xE3, 0xDE, 0xEB, 0x39, 0x45, 0xF3, 0x4F, 0x36, 0x7C, 0x40, 0xC6, 0xDC, 0x87, 0x03, 0x23, 0x0C,
+    0x62, 0xE8, 0xB0, 0x49, 0x26, 0xE3, 0xFD, 0x25, 0xB2, 0xDA, 0xFF, 0xE5, 0x31, 0xE3, 0x17, 0x90,
+    0x4A, 0xBF, 0x16, 0x64, 0xE6, 0x83, 0x7C, 0x1D, 0xD6, 0xF0, 0xC1, 0xE1, 0xF3, 0xA9, 0xF3, 0xFC,
+    0x0C, 0x7F, 0xFE, 0x1F, 0xF8, 0xE2, 0xCF, 0xFF, 0x6D, 0x7D, 0x58, 0x65, 0xDC, 0xEA, 0x03, 0xDD,
+    0x50, 0xB3, 0x1A, 0xA1, 0x53, 0x89, 0x23, 0x44, 0x00, 0x79, 0xFB, 0x10, 0xE9, 0xA7, 0x76, 0x8D,
+    0x5F, 0x3D, 0x20, 0x2F, 0x7E, 0xFF, 0x86, 0x19, 0x1E, 0x5D, 0xD2, 0x2E, 0xDD, 0xCF, 0x57, 0x57,
+    0x67, 0x22, 0x18, 0x47, 0x84, 0x7B, 0x6E, 0x7E, 0xCA, 0x2C, 0x89, 0x51, 0x09, 0x79, 0x43, 0x5E,
+    0xAD, 0x26, 0xD3, 0x1E, 0x9E, 0xD5, 0x60, 0x44, 0x37, 0xED, 0x3D, 0xCC, 0xD3, 0x3B, 0x62, 0xBC,
+    0xD1, 0xA5, 0x75, 0x83, 0xB3, 0x69, 0x17, 0xE4, 0x05, 0xEB, 0xF1, 0x50, 0xAA, 0x78, 0x93, 0x44,
+    0x7F, 0xCF, 0xAF, 0xDF, 0xD1, 0xCB, 0x67, 0x21, 0xF7, 0x15, 0xAD, 0x1D, 0x9B, 0x69, 0xE8, 0x3A,
+    0x87, 0x78, 0xFF, 0xCD, 0x7C, 0xF0, 0x2F, 0x52, 0xFD, 0x71, 0x17, 0x5F, 0xA4, 0xE9, 0x16, 0x17,
+    0xEE, 0x20, 0xC2, 0x4F, 0x21, 0x4A, 0x3C, 0xE5, 0x0A, 0x8E, 0x22, 0xA9, 0xD8, 0x6B, 0xE7, 0xB5,
+    0x9F, 0x5F, 0xEB, 0x58, 0xB2, 0xAE, 0x45, 0x97, 0x06, 0x21, 0x07, 0x7C, 0x04, 0x72, 0x06, 0x9D,
+    0x79, 0x40, 0x2F, 0x2C, 0x1F, 0x1C, 0xBF, 0x44, 0x8C, 0x60, 0x95, 0x11, 0x3F, 0x79, 0x7A, 0xC3,
+    0xED, 0x88, 0x8A, 0xB6, 0xDC, 0x76, 0xF0, 0xA9, 0x06, 0x5A, 0xD1, 0x86, 0x1A, 0x8B, 0x49, 0x0B,
+    0x6D, 0x34, 0x6B, 0x3F, 0xD1, 0x68, 0x50, 0x39, 0x68, 0x82, 0x27, 0x40, 0x56, 0xBB, 0x7A, 0x95,
+    0x55, 0x48, 0x49, 0xCC, 0xC2, 0xB6, 0xCB, 0x0C, 0x0E, 0xBD, 0xA1, 0x10, 0xE1, 0x07, 0x44, 0x04,
+    0xF9, 0x9B, 0x3C, 0xB6, 0xE5, 0xA0, 0x15, 0x6D, 0xED, 0x5C, 0x8C, 0xC4, 0xE4, 0xFD, 0xCC, 0xB0,
+    0x52, 0x81, 0xF2, 0x23, 0xB1, 0x57, 0xEE, 0xB7, 0x3F, 0x81, 0x3B, 0x31, 0x9F, 0x93, 0xAB, 0x4F,
+    0x9A, 0xF5, 0xF5, 0xEA, 0x06, 0xF8, 0x1B, 0xC9, 0xFB, 0xAB, 0xFA, 0xE0, 0x7C, 0x65, 0xB2, 0xFA,
+    0xB8, 0x12, 0x31, 0x90, 0x54, 0x72, 0x9A, 0xA3, 0x6B, 0xCF, 0x6B, 0x99, 0xD7, 0x01, 0xF3, 0xC1,
+    0xE3, 0x50, 0xA4, 0x13, 0x8A, 0x31, 0xC7, 0x39, 0x6F, 0xC9, 0xA5, 0x13, 0xDD, 0xEC, 0xAC, 0x67,
+    0xC7, 0x8E, 0x84, 0x5E, 0xE2, 0x26, 0xC1, 0xF0, 0x47, 0x02, 0x33, 0x7E, 0xF6, 0xCA, 0x70, 0x24,
+    0xB5, 0x9F, 0xB7, 0xAC, 0xB6, 0x6C, 0xC4, 0x48, 0xFF, 0xE5, 0x8A, 0xB9, 0x75, 0x2C, 0x73, 0x9B,
+    0x21, 0xC4, 0xF3, 0x4B, 0xD0, 0x60, 0x99, 0xDA, 0x81, 0x64, 0x04, 0xED, 0x1F, 0x9B, 0xCE, 0x40,
+    0x28, 0x4E, 0xEF, 0x99, 0xE4, 0xFC, 0x77, 0xAE, 0x44, 0x88, 0xD5, 0x42, 0xC8, 0x80, 0x40, 0x0E,
+    0x6B, 0xEF, 0x1C, 0xD5, 0x78, 0x65, 0x01, 0xAB, 0x91, 0xE4, 0x8C, 0x90, 0x3B, 0x2C, 0x48, 0x31,
+    0x21, 0x99, 0xF0, 0xAD, 0x15, 0x10, 0x5A, 0x02, 0x31, 0xD1, 0xD3, 0x69, 0x7E, 0x77, 0x7A, 0xF6,
+    0xA6, 0x78, 0x1E, 0xE0, 0x52, 0xBC, 0x5F, 0x76, 0x58, 0x23, 0xF2, 0x8E, 0xD2, 0x7A, 0xC5, 0x2B,
+    0xE2, 0xCD, 0xD1, 0x84, 0xD8, 0xBC, 0x4B, 0x30, 0xD5, 0x5A, 0xA7, 0x9C, 0x2E, 0xC4, 0x60, 0x62,
+    0xED, 0xD5, 0x48, 0xFE, 0x40, 0x3D, 0x33, 0x69, 0x97, 0xD1, 0x03, 0x3D, 0x8F, 0xF1, 0x35, 0x78,
+    0x5B, 0x93, 0xB7, 0x5E, 0x63, 0xC5, 0x13, 0x80, 0x68, 0xBA, 0xAF, 0x3E, 0x3B, 0x36, 0xBB, 0xA8,
+    0x1F, 0xA0, 0xAA, 0xBC, 0x97, 0x6E, 0xE6, 0x4F, 0x6C, 0x56, 0x28, 0x6B, 0xED, 0x50, 0x42, 0x63,
+    0xBF, 0x24, 0x84, 0xDD, 0xDA, 0x7B, 0x48, 0x00, 0xA1, 0x7D, 0x1A, 0x1C, 0xF3, 0x7B, 0xA5, 0x20,
+    0xC1, 0x6F, 0xC3, 0x2D, 0x53, 0xC3, 0x13, 0x5E, 0x30, 0xE7, 0xF8, 0xC6, 0x2C, 0xB1, 0x2A, 0x00,
+    0xA7, 0x85, 0xC3, 0x11, 0xC4, 0x60, 0xFE, 0x23, 0x12, 0x66, 0x12, 0xF4, 0x2D, 0x29, 0x5B, 0xF5,
+    0xC4, 0xC6, 0xED, 0x6F, 0xD5, 0xB0, 0x9D, 0x6B, 0xB5, 0xBB, 0x68, 0x76, 0x11, 0xAD, 0x94, 0xD7,
+    0x0F, 0x8E, 0xC6, 0x8C, 0x81, 0xA2, 0x35, 0x2E, 0x7C, 0x82, 0x24, 0x18, 0xE6, 0x51, 0xED, 0x9E,
+    0xF0, 0xE6, 0xCA, 0xA6, 0xF5, 0x9A, 0xA6, 0x0F, 0x5F, 0xAA, 0x3D, 0x13, 0x62, 0x29, 0x07, 0xC1,
+    0xD7, 0x57, 0xF4, 0xA4, 0x7B, 0xAC, 0xA7, 0x3E, 0xB1, 0x77, 0xB1, 0x06, 0x83, 0x84, 0xD3, 0x19,
+    0x16, 0x3C, 0x70, 0x7B, 0xFB, 0xB5, 0xED, 0x7D, 0xB7, 0x50, 0x6D, 0x35, 0x17, 0xED, 0x12, 0x96,
+    0xEB, 0x08, 0xEA, 0x71, 0x35, 0xEA, 0x4A, 0xD4, 0xEA, 0xE9, 0xE3, 0xB7, 0xA8, 0xD0, 0xF2, 0xCB,
+    0xFD, 0xF3, 0x2C, 0x5E, 0x68, 0x3F, 0xCC, 0x6A, 0x0E, 0xB6, 0x55, 0x10, 0xDD, 0x05, 0x01, 0xE2,
+    0xE0, 0x1D, 0xB8, 0xAF, 0xCE, 0xCA, 0xF7, 0xE3, 0x62, 0x20, 0x1E, 0x01, 0x59, 0x7F, 0x77, 0x7A,
+    0xC6, 0x30, 0x1C, 0xFB, 0x1E, 0xC1, 0xE7, 0x0F, 0x37, 0x7B, 0x93, 0x5C, 0x3B, 0x6D, 0x96, 0xAA,
+    0xEF, 0x6B, 0x25, 0x13, 0x74, 0x23, 0x7A, 0x63, 0xE0, 0xE9, 0xD6, 0xBA, 0x12, 0xCB, 0x52, 0x53,
+    0x1A, 0x18, 0x86, 0x51, 0x7C, 0x9F, 0x75, 0x44, 0x32, 0x7B, 0xA4, 0x3C, 0xDA, 0x81, 0xE8, 0x81,
+    0x93, 0x3B, 0x02, 0x30, 0xE4, 0xB1, 0x54, 0x29, 0xE8, 0x58, 0xDC, 0x88, 0x84, 0x68, 0x00, 0xAE,
+    0xD1, 0xCC, 0xB5, 0x73, 0x94, 0xC8, 0x27, 0x04, 0xBF, 0x22, 0x53, 0x25, 0x1C, 0x7D, 0x38, 0xC7,
+    0x60, 0x5F, 0x9D, 0x5F, 0xF6, 0x4A, 0xE0, 0x02, 0x38, 0x93, 0x39, 0xDF, 0x0D, 0xD2, 0x60, 0x90,
+    0xAE, 0xB3, 0xEA, 0x73, 0x26, 0x02, 0x45, 0x3D, 0x33, 0xAC, 0xDD, 0xDA, 0x1F, 0x94, 0xE9, 0xBE,
+    0x80, 0xB8, 0x37, 0x9C, 0x42, 0x8C, 0x14, 0xC1, 0xBC, 0x45, 0xC5, 0x6B, 0x26, 0x36, 0x6B, 0xCA,
+    0x02, 0x6F, 0x59, 0xD4, 0xA9, 0xCB, 0xC8, 0x87, 0xDE, 0x6F, 0xCD, 0x67, 0xC4, 0xA4, 0xAE, 0xC2,
+    0xAA, 0x66, 0x0F, 0x99, 0x2A, 0x72, 0xCD, 0x64, 0x2A, 0xEA, 0xC0, 0xB0, 0xC8, 0x8B, 0xC7, 0xB5,
+    0xE2, 0xA9, 0xCC, 0xB4, 0x1F, 0x56, 0x63, 0x5D, 0xF5, 0xD3, 0x75, 0xAB, 0xB5, 0xCF, 0xC7, 0xAC,
+    0xB3, 0xFE, 0xCB, 0x1F, 0x4D, 0xB9, 0xF6, 0x78, 0x78, 0x58, 0x4D, 0x19, 0xE4, 0xAB, 0xBB, 0x16,
+    0x37, 0x81, 0x56, 0xA0, 0x27, 0xF0, 0xF9, 0xB2, 0xCC, 0xA7, 0x59, 0x69, 0xF6, 0xBF, 0xE6, 0x72,
+    0xC2, 0x24, 0xA3, 0x31, 0x57, 0x99, 0xDD, 0xD1, 0x2F, 0xA7, 0x2C, 0xBF, 0x2E, 0xD6, 0x34, 0x93,
+    0x8E, 0xC6, 0x19, 0x14, 0x2C, 0xC2, 0x72, 0x79, 0x71, 0xF9, 0x26, 0x15, 0xF7, 0xDC, 0x4D, 0xBA,
+    0xCE, 0x30, 0x37, 0xE4, 0x44, 0xC6, 0x4E, 0x30, 0x56, 0x74, 0x66, 0x6C, 0x9B, 0xF0, 0xFF, 0x0A,
+    0x78, 0x37, 0xE5, 0xAA, 0x3D, 0x8C, 0x3C, 0x31, 0x41, 0xBA, 0x0C, 0x7B, 0x4C, 0x32, 0x35, 0xEE,
+    0x35, 0x5C, 0x61, 0xD8, 0xFA, 0xEF, 0x8E, 0xAE, 0x7D, 0xC5, 0xD5, 0x49, 0x5B, 0x5E, 0xA4, 0xF3,
+    0x4A, 0xF3, 0xAF, 0xF7, 0xEA, 0x8A, 0x29, 0x1F, 0xE9, 0xF0, 0x62, 0xC7, 0x58, 0x24, 0x80, 0x1B,
+    0x33, 0xFA, 0x03, 0x52, 0xBB, 0x7D, 0xF9, 0xB7, 0x80, 0xD7, 0x44, 0x2C, 0x83, 0xF2, 0x62, 0x1D,
+    0x35, 0x91, 0x88, 0x0C, 0x01, 0x68, 0x71, 0xCD, 0x94, 0x2A, 0x52, 0xED, 0x9E, 0xA5, 0xD0, 0x67,
+    0x51, 0xD4, 0x4B, 0xAD, 0xBD, 0x3B, 0xC9, 0xC1, 0xC5, 0x76, 0x4E, 0x17, 0x98, 0x15, 0xD8, 0x57,
+    0x67, 0xC0, 0xB4, 0xA5, 0xCD, 0x70, 0x58, 0xA1, 0xCB, 0xAC, 0xE0, 0xA4, 0xF1, 0xA0, 0x89, 0xCC,
+    0x65, 0x97, 0x5A, 0x33, 0xF7, 0x23, 0x02, 0x91, 0xEF, 0x2B, 0xB1, 0x40, 0xDE, 0x24, 0xEE, 0x67,
+    0xFD, 0xA2, 0xC1, 0x40, 0xB8, 0x51, 0x44, 0x17, 0x3C, 0x8F, 0x7F, 0xD2, 0x4F, 0x03, 0xEF, 0x83,
+    0xDC, 0x98, 0x95, 0x29, 0x38, 0x00, 0x0C, 0x88, 0x50, 0x8F, 0x06, 0x8B, 0xEB, 0xF4, 0x9B, 0xED,
+    0x7C, 0x7E, 0xA9, 0x34, 0x93, 0x49, 0xA8, 0x5B, 0x36, 0x61, 0x2F, 0xA0, 0xBD, 0x5D, 0xF5, 0x7E,
+    0x4B, 0xAE, 0x6D, 0xE9, 0x39, 0xC2, 0x7A, 0xBF, 0xC5, 0x0D, 0xAF, 0xEE, 0x11, 0x33, 0xF8, 0xAC,
+    0xCC, 0x4E, 0x4E, 0x60, 0x8D, 0x14, 0xAC, 0xFC, 0x47, 0x56, 0x78, 0xA7, 0x57, 0x74, 0x03, 0xAB,
+    0x12, 0x61, 0x19, 0xF9, 0xF6, 0x77, 0x2B, 0xB5, 0x0D, 0x4E, 0x2B, 0xE6, 0x00, 0x24, 0x16, 0xCC,
+    0xB1, 0xD2, 0x33, 0x9C, 0x5C, 0xE4, 0x21, 0x3E, 0xFB, 0x4F, 0x79, 0x8A, 0xB5, 0x0C, 0x81, 0xA5,
+    0xF8, 0x51, 0x1F, 0xB2, 0x1F, 0x52, 0x17, 0xE9, 0x49, 0xDE, 0xD1, 0xA3, 0xDC, 0x99, 0x39, 0x10,
+    0x2C, 0x97, 0x1F, 0x6B, 0xD9, 0x66, 0xED, 0xFA, 0x11, 0x38, 0xFF, 0x3B, 0x2B, 0x5B, 0xAD, 0x96,
+    0x2B, 0x32, 0xBA, 0x0B, 0xB2, 0xC4, 0x8C, 0xF9, 0x30, 0x33, 0x49, 0x04, 0x6C, 0x68, 0xCF, 0x41,
+    0xC2, 0x7A, 0x2E, 0x8F, 0x43, 0x3B, 0x8A, 0x71, 0xC2, 0x73, 0xD5, 0x87, 0x53, 0xF0, 0x72, 0xC9,
+    0xD6, 0xED, 0x63, 0xE0, 0xF4, 0x3D, 0x31, 0xE4, 0x12, 0x8B, 0x1A, 0x10, 0xEB, 0xBD, 0x23, 0x3A,
+    0x28, 0x7C, 0x51, 0x74, 0x50, 0x84, 0xD8, 0xD3, 0x0E, 0x16, 0x81, 0x60, 0x0B, 0x44, 0x78, 0x44,
+    0x5F, 0x0B, 0x42, 0xBE, 0x34, 0x8D, 0x91, 0xDD, 0x26, 0xD4, 0xA2, 0x17, 0x0B, 0xA1, 0xE8, 0x7A,
+    0x35, 0x61, 0xA7, 0x39, 0x75, 0x3E, 0x83, 0xEB, 0x64, 0xEF, 0x0B, 0xA4, 0xA0, 0xBD, 0x83, 0x53,
+    0x41, 0x2B, 0xF2, 0xBE, 0x73, 0x86, 0xE7, 0x3E, 0x47, 0xF8, 0xB5, 0x43, 0x90, 0x0D, 0x19, 0x88,
+    0x82, 0xA4, 0x91, 0x5C, 0x20, 0x88, 0x3B, 0x18, 0x88, 0x8B, 0xC3, 0xA1, 0xC6, 0x69, 0x59, 0x5D,
+    0xFF, 0x2E, 0xFB, 0x2E, 0xFD, 0xEC, 0x65, 0xD6, 0xAE, 0xFC, 0xF4, 0x15, 0xE6, 0x6C, 0xBC, 0x3D,
+    0xBA, 0x26, 0x13, 0xAC, 0x37, 0xBC, 0xCA, 0xBD, 0x4E, 0x7F, 0xA0, 0x46, 0xDE, 0xAB, 0xD4, 0x55,
+    0xF9, 0xFF, 0xA1, 0xE2, 0x2A, 0xFF, 0x37, 0x4D, 0x3D, 0x8D, 0x00, 0x03, 0x29, 0x4D, 0xEA, 0xF0,
+    0x13, 0x42, 0xDF, 0x6F, 0xAF, 0x80, 0x5E, 0x08, 0x59, 0x8A, 0x58, 0x10, 0x2A, 0xF8, 0x7D, 0x02,
+    0x82, 0xA2, 0x62, 0xE7, 0xF9, 0x60, 0x3A, 0x72, 0xE9, 0x81, 0x60, 0xFC, 0xEF, 0x8D, 0x4C, 0xE7,
+    0xED, 0x4A, 0x26, 0x83, 0x40, 0xB9, 0x1D, 0x9D, 0xE3, 0x25, 0xFA, 0x99, 0xBC, 0x31, 0xFA, 0xE9,
+    0xEB, 0xA2, 0x8E, 0x7F, 0xFA, 0x74, 0x37, 0x03, 0xAC, 0x90, 0xE9, 0xDD, 0xF4, 0xF2, 0x94, 0xF5,
+    0x52, 0x2A, 0xA5, 0xEC, 0xD1, 0xAC, 0xB1, 0xC7, 0x97, 0xC6, 0xD3, 0x60, 0x0F, 0x6B, 0x1B, 0xAE,
+    0x4C, 0x3B, 0x35, 0x08, 0x6F, 0x92, 0x3D, 0xDA, 0x9F, 0xCF, 0x1E, 0xD5, 0x06, 0x7B, 0x14, 0xCA,
+    0x1E, 0x99, 0xB2, 0x87, 0x76, 0xDB, 0x62, 0x8B, 0x83, 0x03, 0xF6, 0x68, 0x94, 0x3D, 0xDA, 0x65,
+    0x5A, 0x80, 0x7D, 0x2E, 0xA9, 0x14, 0x2A, 0xEF, 0x50, 0xF9, 0xFD, 0xB9, 0x48, 0xD9, 0x35, 0x06,
+    0x3B, 0x06, 0x77, 0x46, 0x2E, 0xA0, 0x44, 0x18, 0xC2, 0xBF, 0x0D, 0x0C, 0xC1, 0xF8, 0x9C, 0xE0,
+    0x3E, 0x88, 0xA8, 0x3E, 0xB4, 0xC5, 0x29, 0x14, 0x6D, 0x5D, 0xCC, 0xCE, 0x0A, 0x45, 0xB6, 0x0F,
+    0x9B, 0x4B, 0x42, 0x39, 0xB9, 0xE9, 0xB7, 0x45, 0xAB, 0x34, 0x5A, 0x70, 0xC5, 0xBD, 0xEE, 0x23,
+    0xB2, 0x51, 0x47, 0xE8, 0x12, 0x5F, 0xD3, 0x5E, 0x79, 0x0A, 0x6E, 0xD2, 0x9F, 0xA9, 0x1F, 0xA6,
+    0xD1, 0x9D, 0xAF, 0x9D, 0x0F, 0x98, 0x0C, 0x50, 0xBA, 0x93, 0x52, 0xB9, 0xCA, 0x48, 0x30, 0x80,
+    0x48, 0x57, 0x40, 0xBE, 0xFB, 0x51, 0x04, 0xDB, 0x30, 0x3F, 0xA1, 0x6C, 0xA0, 0xBE, 0x05, 0x6A,
+    0x0B, 0x13, 0xC9, 0x3F, 0x12, 0xDF, 0xFA, 0xEF, 0xB4, 0x3B, 0x60, 0xFE, 0x7A, 0x9B, 0x8B, 0x3D,
+    0x12, 0x0E, 0xDB, 0xC6, 0x65, 0xD4, 0x68, 0x7E, 0x9E, 0x2E, 0xD8, 0x44, 0x6F, 0x69, 0x8D, 0x18,
+    0x9B, 0xBF, 0xD0, 0x57, 0x84, 0xC2, 0x68, 0xCC, 0x82, 0xE6, 0x03, 0xB2, 0xAE, 0x59, 0xAD, 0x99,
+    0xBD, 0x3F, 0xB3, 0x24, 0x1C, 0x97, 0x1E, 0x09, 0x91, 0x83, 0x0B, 0x4B, 0x73, 0x84, 0xA8, 0xD3,
+    0xC0, 0x66, 0x77, 0xD0, 0x1C, 0xA1, 0xD1, 0x6E, 0x00, 0x4B, 0x73, 0x84, 0x54, 0x93, 0xB2, 0xF2,
+    0xCD, 0xE6, 0x08, 0xB7, 0x34, 0x4B, 0xAE, 0xA8, 0x59, 0xD2, 0xCF, 0xCE, 0xA6, 0x35, 0x43, 0xC4,
+    0xDB, 0xBC, 0xA8, 0x14, 0xF1, 0x17, 0xB3, 0x64, 0xB6, 0x39, 0xD2, 0x8A, 0x19, 0xCC, 0xE1, 0x5C,
+    0xC2, 0x50, 0xB8, 0xCA, 0x0C, 0x18, 0x1E, 0x2C, 0xAA, 0x87, 0x3D, 0x90, 0xD0, 0xF0, 0x68, 0x96,
+    0xBA, 0xA9, 0x8A, 0xE5, 0x6B, 0xE1, 0xF8, 0x2F, 0xE4, 0x3D, 0xB6, 0x03, 0x24, 0xC1, 0x53, 0x8E,
+    0xB6, 0xF3, 0xF3, 0x28, 0xBC, 0x21, 0xAA, 0xEE, 0xC5, 0xEC, 0x99, 0x4A, 0xEE, 0x5D, 0x70, 0x64,
+    0x63, 0xF2, 0xAE, 0xD0, 0x0D, 0xC9, 0xCB, 0x13, 0xF4, 0x75, 0xAB, 0x94, 0x93, 0x37, 0x92, 0x74,
+    0x5E, 0xEB, 0x68, 0xD7, 0xCC, 0xC4, 0x9B, 0xA9, 0x37, 0x93, 0x6F, 0xA6, 0xDF, 0xD2, 0x88, 0xC6,
+    0x51, 0x70, 0x26, 0xE1, 0x4C, 0xC3, 0x99, 0x88, 0x33, 0x15, 0x67, 0x32, 0x3A, 0x3A, 0xCE, 0x84,
+    0x9C, 0x29, 0xB9, 0x90, 0x92, 0x01, 0xE0, 0x0B, 0x0C, 0xFF, 0x32, 0x4D, 0xA4, 0xBA, 0x4C, 0xEA,
+    0x9C, 0x25, 0x79, 0x1E, 0x27, 0x7D, 0x8E, 0x90, 0x40, 0x4A, 0x21, 0x25, 0x91, 0xD2, 0x48, 0x89,
+    0xA4, 0x54, 0x52, 0x32, 0x29, 0x9D, 0x40, 0x5C, 0xAB, 0x2D, 0xE2, 0x8A, 0xD9, 0xED, 0x90, 0xBB,
+    0xEC, 0x07, 0x7D, 0x71, 0x45, 0x95, 0xE4, 0x02, 0xDF, 0x15, 0xBB, 0xBB, 0x66, 0x12, 0x5A, 0x94,
+    0x3E, 0xE3, 0xF8, 0x05, 0x3E, 0x2E, 0x68, 0x7E, 0x69, 0x52, 0xE0, 0x70, 0x64, 0x3B, 0x43, 0xC9,
+    0x06, 0x68, 0x52, 0x81, 0x76, 0xCE, 0xAC, 0x1A, 0xE6, 0x61, 0x86, 0xA3, 0xEB, 0xBE, 0x11, 0x4C,
+    0xAE, 0x50, 0x3D, 0xB0, 0xAE, 0x54, 0x9D, 0x2F, 0x80, 0x5C, 0x02, 0x6B, 0xD6, 0x20, 0xE6, 0x15,
+    0xD4, 0x9A, 0xA3, 0x84, 0xBE, 0x93, 0xFF, 0xC3, 0x19, 0x1F, 0xB9, 0x5C, 0x9C, 0x23, 0x6E, 0x46,
+    0x8A, 0x38, 0xD5, 0xAE, 0xE7, 0xE9, 0x25, 0xEE, 0xCC, 0xD4, 0xBD, 0x72, 0xD1, 0xBD, 0xA9, 0x5C,
+    0x80, 0x85, 0x03, 0xA0, 0x7B, 0x17, 0x5C, 0x97, 0x27, 0xED, 0xF6, 0x47, 0xE3, 0x97, 0xA3, 0xD1,
+    0x44, 0x43, 0x98, 0xF4, 0x93, 0x4B, 0x63, 0x42, 0xB6, 0xA3, 0xD0, 0x0C, 0xA1, 0x8D, 0x70, 0x40,
+    0x1A, 0x53, 0x30, 0x21, 0xD7, 0x17, 0x69, 0x4C, 0xB0, 0x92, 0x91, 0x9D, 0xEE, 0xDB, 0xB2, 0x82,
+    0xE9, 0x85, 0xC2, 0xA2, 0x1B, 0xBB, 0x3C, 0xAC, 0xD8, 0x0C, 0x24, 0x66, 0x01, 0x5C, 0x5C, 0xB1,
+    0xE1, 0x93, 0x55, 0x5C, 0x72, 0x10, 0x26, 0x8D, 0x95, 0x33, 0xDE, 0xD4, 0xD4, 0x95, 0xD3, 0x73,
+    0x00, 0x4C, 0x84, 0x0D, 0x37, 0x27, 0x17, 0xC3, 0x46, 0x16, 0x15, 0xA1, 0x17, 0xC2, 0x18, 0x75,
+    0x68, 0xB2, 0x15, 0x75, 0xE8, 0x8C, 0x20, 0x00, 0x19, 0x31, 0x64, 0x19, 0x91, 0x1C, 0x0E, 0xF1,
+    0x01, 0xD8, 0x3C, 0xFF, 0x07, 0x39, 0x96, 0x34, 0x98, 0x53, 0xFC, 0x16, 0x8C, 0xF9, 0xE8, 0x6D,
+    0xB0, 0xF8, 0xCA, 0xA2, 0x13, 0xC9, 0x55, 0x5B, 0xE0, 0x34, 0x5B, 0x38, 0x9E, 0x8E, 0x1E, 0xB3,
+    0x07, 0x70, 0xAB, 0xD0, 0x36, 0x31, 0xBE, 0xCB, 0x9F, 0x3C, 0x6D, 0xE2, 0x86, 0xA9, 0xA3, 0xE5,
+    0x97, 0xAB, 0xFC, 0xC5, 0x29, 0x42, 0x32, 0x41, 0xD4, 0x96, 0x8F, 0x0C, 0x71, 0x63, 0x1F, 0xE5,
+    0xD0, 0xA7, 0x35, 0x33, 0x36, 0xF2, 0x97, 0x07, 0x11, 0xCB, 0xDF, 0x45, 0x21, 0xF7, 0x44, 0x37,
+    0x25, 0x9B, 0xE0, 0x64, 0x17, 0x8B, 0x3B, 0xE5, 0x7D, 0xF5, 0xF0, 0x8E, 0x30, 0x5B, 0xD9, 0x73,
+    0xBB, 0xAE, 0x9A, 0x56, 0x63, 0x39, 0x4B, 0x20, 0x5C, 0x01, 0x34, 0x86, 0x5F, 0xE9, 0xE7, 0xF7,
+    0xB9, 0x64, 0xF9, 0x0F, 0xE8, 0x7D, 0x95, 0xDF, 0xB5, 0x51, 0x86, 0x7D, 0x63, 0xB9, 0xEA, 0x29,
+    0x07, 0x48, 0x90, 0x43, 0x12, 0x17, 0xE6, 0x50, 0xCE, 0x5E, 0x5B, 0x37, 0xB5, 0x06, 0x89, 0x44,
+    0x83, 0x27, 0x62, 0x80, 0xA1, 0x35, 0xC8, 0x83, 0xC2, 0x66, 0x6C, 0x0D, 0x52, 0x7C, 0x7A, 0xB3,
+    0x01, 0xD9, 0xCD, 0x0D, 0x42, 0x3E, 0xA0, 0x19, 0xBD, 0xA5, 0xCA, 0xC4, 0xDA, 0xB5, 0x86, 0x85,
+    0xE9, 0x5A, 0x01, 0xFE, 0xCE, 0x9A, 0x87, 0x70, 0xFB, 0x46, 0xCF, 0xDB, 0x89, 0x67, 0x43, 0xE4,
+    0x25, 0xA4, 0x63, 0x3A, 0x45, 0x48, 0x3A, 0x79, 0xC7, 0xFE, 0xBA, 0xF0, 0x9A, 0xFD, 0x1A, 0x0A,
+    0xDB, 0x42, 0xEB, 0x5B, 0xC1, 0x06, 0xAB, 0x11, 0x2E, 0x15, 0xC4, 0xE8, 0x26, 0xCA, 0x68, 0x97,
+    0xDD, 0xA0, 0x69, 0x0D, 0xAD, 0x56, 0xA6, 0x34, 0x2B, 0xAD, 0x4C, 0xE1, 0x6F, 0x53, 0xCD, 0x84,
+    0x40, 0x41, 0x53, 0x30, 0x1D, 0xC5, 0xC1, 0x08, 0x6C, 0xAF, 0x25, 0x77, 0xFD, 0x86, 0xF5, 0xD2,
+    0xAE, 0x6B, 0x8E, 0x55, 0xB3, 0xD6, 0x7C, 0xC3, 0xB5, 0xDB, 0x30, 0xFF, 0x1E, 0x0D, 0xEE, 0xD8,
+    0xEC, 0xE4, 0x7C, 0x22, 0x4A, 0x62, 0x42, 0x63, 0x0D, 0xC8, 0x2B, 0x6D, 0x3E, 0xC6, 0xFC, 0x3B,
+    0x6D, 0x76, 0x72, 0x72, 0x69, 0x76, 0x52, 0x56, 0x44, 0x6D, 0x2F, 0xD3, 0x9F, 0xF1, 0x57, 0xEC,
+    0xF2, 0xF1, 0xA6, 0x99, 0xD3, 0xD2, 0x7E, 0x4E, 0xD7, 0x38, 0x22, 0xA0, 0xFB, 0xD8, 0x6A, 0x25,
+    0x21, 0x3D, 0x4F, 0x3C, 0x63, 0x9E, 0x80, 0xAF, 0xD3, 0x39, 0xC5, 0x50, 0x1A, 0x88, 0x21, 0xC1,
+    0xF1, 0x3E, 0x09, 0x4F, 0xE5, 0x0E, 0x0E, 0xCA, 0x59, 0x90, 0x1D, 0xF9, 0x38, 0x50, 0x43, 0xB4,
+    0x1A, 0x2D, 0x10, 0x87, 0xFD, 0x3D, 0x43, 0x4F, 0x9F, 0x0B, 0x6D, 0xE7, 0x4B, 0x12, 0xCC, 0xD2,
+    0x34, 0xD5, 0xAC, 0x05, 0x0A, 0xAE, 0x80, 0x09, 0x98, 0xC4, 0x75, 0x5B, 0x17, 0xAC, 0x8D, 0x5C,
+    0x19, 0x76, 0x39, 0xB4, 0x3B, 0xCB, 0xE9, 0x5F, 0xDC, 0x82, 0xD9, 0x58, 0xEE, 0x84, 0x45, 0x46,
+    0xCB, 0xBB, 0x2D, 0x58, 0x36, 0x7B, 0x74, 0x9D, 0x5A, 0x56, 0x6C, 0xC6, 0x54, 0xB1, 0x79, 0xB1,
+    0xAD, 0x03, 0xED, 0xD0, 0xB3, 0xD2, 0x4E, 0x2D, 0x04, 0x6F, 0x49, 0x7F, 0x59, 0x0B, 0x97, 0xDA,
+    0xB5, 0x32, 0xA6, 0x60, 0xEE, 0xD4, 0xA2, 0x59, 0x90, 0xAA, 0xEB, 0x62, 0xFD, 0xDD, 0x59, 0xE6,
+    0x9E, 0x7B, 0xDA, 0xA9, 0x25, 0xAC, 0x12, 0x6D, 0xC1, 0x45, 0x49, 0x73, 0x96, 0xA0, 0x56, 0x8C,
+    0x49, 0xB4, 0xF8, 0x15, 0xA3, 0x75, 0x57, 0x74, 0x44, 0x8A, 0x4E, 0x2D, 0xB7, 0x32, 0x7D, 0xC2,
+    0xCD, 0xCB, 0x86, 0x05, 0xA4, 0x85, 0x76, 0xFE, 0x33, 0x62, 0x81, 0x20, 0xF2, 0x86, 0xCC, 0xB2,
+    0x08, 0xB0, 0x3B, 0xEA, 0xD1, 0x3B, 0x62, 0x62, 0xE3, 0x8C, 0x62, 0xBD, 0x76, 0x9C, 0xFF, 0x8C,
+    0xC0, 0x0A, 0x3B, 0xD8, 0x86, 0x4B, 0x48, 0x03, 0x40, 0x16, 0x6E, 0x22, 0x90, 0x2F, 0xCB, 0x33,
+    0x56, 0xC2, 0x99, 0x68, 0x31, 0x7D, 0x16, 0x37, 0xAA, 0x9A, 0x3E, 0x9D, 0x9A, 0x3E, 0x10, 0x34,
+    0xD7, 0x64, 0xB2, 0x10, 0x35, 0x6F, 0x89, 0xB9, 0x1E, 0x3D, 0x65, 0x7D, 0xA4, 0xA5, 0xC7, 0x82,
+    0xB5, 0x91, 0xA3, 0xFE, 0xA0, 0x18, 0x61, 0xE8, 0x1F, 0xF0, 0x80, 0x80, 0x1C, 0x34, 0x55, 0xD0,
+    0xEE, 0x60, 0x8D, 0x0A, 0x16, 0x00, 0x15, 0x88, 0x16, 0x28, 0x4C, 0x1C, 0x89, 0xD2, 0xA5, 0xC5,
+    0xB9, 0x16, 0x06, 0xE4, 0x50, 0x36, 0xAF, 0xCA, 0x78, 0xD5, 0x4C, 0xD1, 0x46, 0x97, 0x90, 0xD6,
+    0x4A, 0xF1, 0xBC, 0x52, 0x79, 0x55, 0x56, 0xAA, 0xEC, 0x34, 0xD7, 0x91, 0x5E, 0x12, 0xE4, 0x08,
+    0x69, 0xF6, 0x9C, 0x53, 0xBB, 0x2E, 0x97, 0x69, 0xA6, 0xE6, 0x6C, 0x49, 0xCE, 0xA6, 0xE4, 0x42,
+    0xC9, 0xB5, 0xB8, 0xCB, 0x7D, 0x7B, 0x7B, 0xCF, 0xDC, 0x77, 0x0E, 0x68, 0x3F, 0x6D, 0x4E, 0xC5,
+    0x6D, 0x97, 0xD6, 0xDB, 0x49, 0xDB, 0xE5, 0xD5, 0xE3, 0x69, 0x23, 0x88, 0xF9, 0x48, 0x5A, 0x9F,
+    0x2E, 0x0B, 0x97, 0x4C, 0x94, 0x73, 0x2C, 0x9D, 0xA7, 0x4A, 0xC1, 0x04, 0x13, 0x55, 0x18, 0x8A,
+    0xB1, 0xE6, 0x7F, 0x60, 0xFC, 0xC1, 0x6B, 0xD3, 0x51, 0xD9, 0x5C, 0xB0, 0x5C, 0xDE, 0xA3, 0x74,
+    0xCA, 0x13, 0xC5, 0xF7, 0xDC, 0x81, 0x1C, 0x52, 0x31, 0xC4, 0x0C, 0x73, 0x6E, 0x8D, 0x89, 0xB4,
+    0x1F, 0xCD, 0xB3, 0xD0, 0x14, 0x6C, 0x2C, 0x87, 0xAE, 0x3D, 0xAB, 0x69, 0xAD, 0xDE, 0x64, 0x69,
+    0x74, 0xD3, 0xBA, 0x76, 0xBE, 0xDA, 0xCC, 0x77, 0x69, 0xDC, 0x8D, 0xB4, 0x41, 0x79, 0x54, 0x45,
+    0xC4, 0x56, 0xA1, 0x03, 0x06, 0xE8, 0xFB, 0xDB, 0xD9, 0x4D, 0x4D, 0xAD, 0xFC, 0x75, 0xE9, 0xCF,
+    0xF1, 0x22, 0x22, 0x85, 0x9E, 0x2B, 0x14, 0x51, 0xEF, 0x8C, 0x3A, 0xF7, 0x95, 0x03, 0xD5, 0x33,
+    0xA5, 0x6C, 0x18, 0x16, 0x6B, 0xE0, 0xFA, 0x5C, 0x8A, 0x5C, 0x7F, 0x40, 0x86, 0x2A, 0x98, 0x11,
+    0x36, 0x4C, 0xD6, 0xB9, 0x88, 0x62, 0x08, 0x51, 0x9B, 0x53, 0x02, 0x60, 0xBD, 0x2D, 0x0F, 0x7A,
+    0x96, 0x3B, 0x17, 0x2C, 0x39, 0x71, 0xE1, 0x78, 0xC4, 0x9D, 0x4A, 0x8F, 0x7C, 0x76, 0x03, 0xB8,
+    0xC6, 0x14, 0x08, 0xAE, 0x29, 0x9F, 0xBD, 0x0B, 0xEF, 0xB3, 0x2B, 0xD0, 0x3D, 0x24, 0xD6, 0x03,
+    0x24, 0xD6, 0x36, 0xBB, 0x02, 0x7D, 0x8E, 0x5D, 0x81, 0x3E, 0xCB, 0xAE, 0x40, 0x76, 0xAD, 0x2B,
+    0x50, 0x47, 0x21, 0xD9, 0xB0, 0x03, 0x6F, 0xCD, 0xC2, 0x03, 0xDA, 0xA8, 0xFE, 0x8B, 0xB7, 0xEC,
+    0x0A, 0xF4, 0x1E, 0xB5, 0xA1, 0xBF, 0x05, 0x57, 0xF7, 0x0F, 0x51, 0x1B, 0xFA, 0x1A, 0x0E, 0xB8,
+    0x9D, 0x6B, 0x43, 0x7F, 0x17, 0x79, 0xBE, 0xC1, 0xD3, 0xF0, 0xDD, 0x7F, 0xE1, 0xD6, 0xB5, 0xA1,
+    0x46, 0x0D, 0x1B, 0x26, 0x20, 0xBB, 0x1F, 0xBE, 0xBB, 0x42, 0x46, 0x40, 0x20, 0xDE, 0x77, 0x2D,
+    0x23, 0xD1, 0x83, 0xE5, 0xBA, 0xEF, 0xBA, 0x1F, 0x57, 0xDA, 0xB9, 0x99, 0xBC, 0x59, 0x69, 0xD7,
+    0x66, 0x82, 0x5E, 0x18, 0x01, 0xDE, 0x8D, 0xBE, 0xD4, 0x2B, 0x09, 0x98, 0x8B, 0xCD, 0xA1, 0x54,
+    0x84, 0x1D, 0x58, 0xD5, 0xF5, 0x2D, 0x34, 0xC7, 0xC3, 0xE0, 0xE7, 0x04, 0x77, 0xF8, 0x43, 0x60,
+    0xFB, 0x1A, 0xED, 0x9E, 0x0B, 0x32, 0xFE, 0x52, 0x30, 0x73, 0x10, 0xC1, 0xF1, 0xA7, 0x8D, 0x6A,
+    0x35, 0xB6, 0xD8, 0x42, 0xD5, 0x4C, 0x1D, 0x88, 0xE1, 0x51, 0x79, 0x07, 0x55, 0x33, 0x73, 0x1B,
+    0x35, 0x6D, 0x70, 0xD7, 0xCC, 0x29, 0x4E, 0x64, 0x1F, 0x12, 0x16, 0x7C, 0xB2, 0x1A, 0x4E, 0xD1,
+    0x16, 0xB8, 0xCC, 0x2A, 0x98, 0x01, 0x15, 0x8C, 0x55, 0x59, 0x5E, 0x13, 0x9C, 0x9D, 0x68, 0x3B,
+    0x99, 0xF2, 0x6F, 0xCC, 0xD2, 0x39, 0x77, 0x7D, 0xCC, 0xE7, 0x06, 0xB9, 0x9E, 0xD1, 0xBE, 0x6A,
+    0x42, 0xF5, 0x87, 0x4A, 0xE3, 0xB6, 0x85, 0xC2, 0x77, 0x0E, 0xD8, 0xA1, 0x74, 0x0D, 0xDA, 0x40,
+    0xDE, 0xF4, 0xC8, 0xC0, 0xFE, 0x01, 0xC9, 0x23, 0x43, 0x30, 0xA4, 0xA8, 0x9F, 0x4E, 0x91, 0x33,
+    0x99, 0xD8, 0xB7, 0x80, 0x4E, 0xD8, 0xC9, 0xF6, 0x6F, 0xE6, 0x8E, 0xA5, 0x54, 0x68, 0xC2, 0x56,
+    0x05, 0x1C, 0x64, 0x38, 0x6C, 0x44, 0x6F, 0xE3, 0x66, 0x17, 0xFC, 0x8F, 0x6B, 0x79, 0xEA, 0xFD,
+    0x56, 0x17, 0xAF, 0xF6, 0x58, 0xD3, 0x88, 0x9D, 0x3B, 0xC7, 0xD5, 0xC6, 0x39, 0xBE, 0xBD, 0x24,
+    0xB0, 0xE3, 0xFC, 0x1B, 0xE6, 0xB5, 0x44, 0x4B, 0x24, 0xE7, 0xB8, 0x2B, 0xFA, 0x3D, 0x28, 0xB5,
+    0xC8, 0xD5, 0x3A, 0xBE, 0x65, 0xBD, 0xDB, 0xDC, 0x53, 0x3E, 0x79, 0xF7, 0x9E, 0xF2, 0xC6, 0x95,
+    0xCE, 0x69, 0x2D, 0x44, 0xB7, 0x09, 0x34, 0x2F, 0xB9, 0xC0, 0xB6, 0x37, 0x38, 0xAF, 0xBA, 0xB1,
+    0x17, 0x0F, 0x72, 0x88, 0xCC, 0x4D, 0x5D, 0x45, 0xCD, 0x3F, 0xF8, 0x66, 0xB2, 0x9E, 0x3B, 0x56,
+    0xB1, 0x4B, 0x9D, 0x4A, 0x35, 0xC0, 0x60, 0x92, 0xAB, 0xCD, 0x7A, 0x4B, 0xB9, 0xCD, 0x8A, 0x97,
+    0xBB, 0xA6, 0x7F, 0xCB, 0xED, 0xF2, 0x47, 0xAB, 0x7B, 0x8D, 0xC1, 0x25, 0x17, 0x5D, 0x72, 0xE1,
+    0xA5, 0xB9, 0x6F, 0x99, 0x06, 0x98, 0x5C, 0x84, 0x49, 0xC5, 0xA2, 0x93, 0x8B, 0x60, 0xA4, 0x40,
+    0x4B, 0x6A, 0x54, 0x29, 0xAA, 0x91, 0xC5, 0x38, 0x13, 0xDA, 0xD3, 0x02, 0xCC, 0x05, 0xDA, 0x8F,
+    0x4C, 0x43, 0x4D, 0x8B, 0xC1, 0xEF, 0x82, 0x4D, 0x4A, 0xD9, 0xF7, 0xE5, 0x96, 0x9E, 0x04, 0xB3,
+    0x4D, 0x82, 0x15, 0xA3, 0x6E, 0x85, 0xBC, 0xEC, 0x60, 0x70, 0xF2, 0xB2, 0xD1, 0x48, 0xEA, 0xB4,
+    0xA6, 0x54, 0x0F, 0x3E, 0xD2, 0x20, 0x42, 0x2F, 0x91, 0x04, 0x0D, 0xB3, 0x12, 0xF8, 0x50, 0x23,
+    0xED, 0x0A, 0xB5, 0x30, 0x18, 0xDC, 0x7A, 0xFB, 0x2C, 0xAD, 0xF0, 0x09, 0xC0, 0x50, 0xD5, 0xD9,
+    0xE8, 0xA5, 0xD6, 0x90, 0x13, 0xC3, 0xE5, 0x99, 0xA2, 0x0D, 0x75, 0x12, 0x1D, 0x57, 0x11, 0xFF,
+    0xA0, 0xA2, 0xE5, 0x6D, 0x85, 0x07, 0x8F, 0x2B, 0x3E, 0x50, 0xCF, 0x82, 0xD7, 0x68, 0x17, 0xA9,
+    0x9A, 0xCC, 0x19, 0x54, 0x6A, 0x3A, 0x43, 0xBD, 0x9B, 0x5F, 0x4D, 0x78, 0x5C, 0x9F, 0x1C, 0x88,
+    0xFA, 0xF3, 0xCE, 0x2F, 0xA7, 0xF3, 0xF4, 0x24, 0x3B, 0xBD, 0xE2, 0x37, 0xEB, 0x4D, 0xFD, 0x1C,
+    0x16, 0x8B, 0x37, 0xBA, 0x9B, 0x3F, 0xBF, 0xC6, 0x8A, 0x21, 0x30, 0x48, 0x82, 0xF7, 0x3E, 0xC1,
+    0xDE, 0x32, 0x58, 0x03, 0x52, 0x1C, 0x7D, 0xD7, 0x5B, 0x46, 0x24, 0x4C, 0x96, 0xBB, 0xB6, 0x32,
+    0xF7, 0x62, 0xDE, 0x9C, 0x35, 0xE6, 0xFC, 0xFB, 0x97, 0x64, 0xD8, 0x17, 0xE1, 0xF9, 0x1B, 0x68,
+    0x0D, 0x3D, 0xE6, 0x85, 0x56, 0x22, 0x1D, 0xEA, 0x36, 0xD1, 0x44, 0x35, 0x67, 0xD9, 0xA5, 0x77,
+    0x89, 0x87, 0xD3, 0xA8, 0x87, 0xD3, 0x53, 0xA6, 0xF3, 0x9D, 0x5D, 0x31, 0x51, 0x43, 0x86, 0xCE,
+    0x66, 0xC0, 0x45, 0x5B, 0xE4, 0x99, 0xC9, 0x95, 0x21, 0x5E, 0xE5, 0x66, 0xC5, 0x4E, 0xE4, 0x1D,
+    0xFD, 0xE8, 0x8E, 0xCE, 0xD5, 0xB0, 0xF4, 0x4B, 0xEF, 0x58, 0x74, 0xBB, 0x56, 0x4D, 0x7E, 0x98,
+    0x75, 0xB6, 0xA0, 0x79, 0xFA, 0x10, 0xDD, 0x80, 0x83, 0x4B, 0x18, 0xBD, 0x7B, 0xFC, 0xC3, 0x1F,
+    0x3E, 0x6D, 0xE5, 0x0E, 0xF8, 0x87, 0x7F, 0xB9, 0x9E, 0x35, 0x2C, 0x59, 0x2D, 0x59, 0xB2, 0x9C,
+    0x87, 0x99, 0xE7, 0x3E, 0x56, 0x74, 0xCF, 0x6C, 0x27, 0x8D, 0x36, 0xBA, 0xA6, 0x9B, 0xEB, 0xD8,
+    0xFE, 0xC0, 0xC2, 0x7C, 0x1F, 0xE8, 0x3E, 0x7B, 0x17, 0x74, 0xBF, 0xF1, 0x29, 0x2C, 0x5E, 0xC9,
+    0x18, 0x34, 0xCA, 0xA5, 0xFA, 0x79, 0x07, 0xC2, 0x25, 0x6D, 0xE7, 0xC0, 0xE8, 0x74, 0xB4, 0x29,
+    0x58, 0x49, 0x9E, 0xD3, 0x3C, 0xEF, 0x58, 0x7F, 0xC7, 0xDA, 0x4F, 0x39, 0xD6, 0x39, 0x40, 0x82,
+    0x80, 0x1F, 0x18, 0xA5, 0xAB, 0x8B, 0x8D, 0xF7, 0x63, 0x30, 0xD4, 0x6E, 0xC3, 0x7E, 0xD1, 0x51,
+    0xDC, 0xAE, 0x00, 0xB4, 0xE3, 0xB8, 0x8D, 0xC0, 0x5A, 0x27, 0xA3, 0xF6, 0x24, 0xF8, 0x77, 0x27,
+    0xEA, 0xB6, 0x13, 0xF6, 0x8B, 0xEE, 0x2E, 0xF1, 0xBA, 0xEA, 0x99, 0x39, 0x7D, 0x76, 0xF5, 0x0E,
+    0xEB, 0xDE, 0x2F, 0x85, 0x96, 0x0E, 0xD2, 0x2E, 0xB4, 0x94, 0x8A, 0x6D, 0xA0, 0x49, 0x9C, 0x5A,
+    0x51, 0x23, 0x5C, 0x13, 0x30, 0xA5, 0x26, 0xD9, 0x0F, 0x5A, 0xE5, 0x32, 0xBF, 0x59, 0xD8, 0x6C,
+    0x49, 0x86, 0x3B, 0xBB, 0x19, 0x65, 0xF6, 0xE7, 0xD8, 0x72, 0xB3, 0x69, 0x82, 0x6A, 0x26, 0xAD,
+    0x6B, 0x77, 0x55, 0x69, 0xBB, 0xAB, 0x5A, 0xDB, 0x5D, 0xD5, 0x81, 0x66, 0x99, 0xAF, 0x64, 0x79,
+    0xC1, 0xEB, 0x0D, 0xDB, 0x5D, 0xFD, 0x69, 0x8B, 0x76, 0x57, 0xAB, 0x2F, 0xB4, 0xCF, 0x21, 0x4C,
+    0x15, 0xBD, 0x85, 0xFC, 0xDD, 0xE3, 0xD1, 0xDB, 0xA8, 0x8A, 0x7B, 0x60, 0x65, 0x71, 0x12, 0xB7,
+    0x43, 0x24, 0xD7, 0x7E, 0xE5, 0xB9, 0x10, 0x8D, 0x69, 0xF6, 0xDB, 0xA0, 0x0B, 0xEC, 0x3D, 0x68,
+    0x37, 0xEB, 0xDB, 0xA1, 0xC4, 0xA6, 0x96, 0xAE, 0x5B, 0xC7, 0x86, 0x2C, 0x0E, 0x37, 0x64, 0x71,
+    0xB2, 0x21, 0x8B, 0xEF, 0x1C, 0x2A, 0x3B, 0x42, 0x72, 0xFD, 0x01, 0x64, 0x17, 0x43, 0x34, 0xF9,
+    0x9B, 0x95, 0x66, 0x56, 0xDE, 0x80, 0x96, 0xB5, 0x58, 0xC0, 0x79, 0x8C, 0xB4, 0x4A, 0x83, 0x77,
+    0xF0, 0xAF, 0x92, 0x77, 0x5E, 0x21, 0x60, 0xFA, 0x13, 0xA2, 0x25, 0x32, 0xD8, 0x8E, 0x0A, 0x49,
+    0x72, 0x1C, 0x5C, 0x80, 0xB2, 0x4A, 0xCE, 0x7C, 0xFF, 0x5B, 0xD3, 0x12, 0xB6, 0xE0, 0x64, 0x4E,
+    0xF1, 0x68, 0x5C, 0xE6, 0x31, 0x61, 0xB5, 0x5C, 0xD0, 0xB1, 0xCF, 0x21, 0x3E, 0xD6, 0xE2, 0x4A,
+    0x8E, 0x5E, 0x9D, 0xBD, 0xD6, 0xB6, 0xD7, 0x61, 0x66, 0x56, 0x28, 0x4D, 0x0F, 0xA7, 0x61, 0x56,
+    0xAE, 0x07, 0x1F, 0x12, 0xB3, 0x35, 0xFD, 0x26, 0xB3, 0x5E, 0x32, 0x0F, 0x9D, 0xC6, 0xD8, 0x63,
+    0xE5, 0x20, 0x65, 0x8D, 0x1D, 0xB2, 0x9C, 0x0C, 0x99, 0x7B, 0x0F, 0x6A, 0x96, 0x18, 0x7A, 0x71,
+    0x97, 0xC5, 0xC5, 0xD6, 0xE4, 0xDF, 0x7B, 0xB5, 0x93, 0x67, 0x7D, 0x41, 0x90, 0xDD, 0x88, 0x93,
+    0x99, 0xAD, 0x61, 0x31, 0xAF, 0xC7, 0xA6, 0xF8, 0x03, 0x0A, 0x4F, 0x64, 0xC4, 0xD1, 0x6C, 0x57,
+    0xC5, 0x8D, 0x29, 0x99, 0x1F, 0x27, 0x7D, 0xF8, 0x68, 0xCF, 0xD9, 0x08, 0x3A, 0x3C, 0xE8, 0x35,
+    0xEB, 0xD3, 0xBB, 0x43, 0xF4, 0x59, 0xB9, 0x4A, 0xB5, 0xF9, 0xEA, 0xBF, 0xDE, 0x53, 0x9A, 0x86,
+    0x62, 0x57, 0xE3, 0xF4, 0xA1, 0xC2, 0x15, 0xD7, 0x1D, 0x61, 0xCB, 0xCF, 0x00, 0xFB, 0x2B, 0x81,
+    0x3C, 0x6D, 0x71, 0x31, 0xE3, 0x1F, 0x11, 0x36, 0x39, 0x5D, 0xD7, 0x82, 0xDC, 0x79, 0x3D, 0xEB,
+    0x92, 0xA4, 0xAE, 0x9F, 0xE1, 0x35, 0xD0, 0x42, 0x09, 0xB3, 0xFA, 0xFE, 0xBF, 0xB1, 0x8A, 0xA3,
+    0x7D, 0xF6, 0x3D, 0xD8, 0xA1, 0x6A, 0xAB, 0xE5, 0x7C, 0xA3, 0x3B, 0x68, 0xE5, 0x77, 0xAC, 0x05,
+    0x07, 0x6D, 0x2E, 0x6A, 0xA1, 0xBA, 0xA7, 0x15, 0x91, 0x5B, 0x13, 0xFA, 0xF9, 0xC8, 0xF2, 0x7F,
+    0x6C, 0xA1, 0x9B, 0x60, 0x27, 0x67, 0x01, 0xFB, 0x64, 0x14, 0x54, 0x24, 0xCC, 0x72, 0x9F, 0xD8,
+    0xA3, 0x94, 0x15, 0x0A, 0x50, 0x1D, 0xBB, 0xE8, 0x9B, 0xBA, 0x62, 0xBF, 0xCB, 0x22, 0x1A, 0x4F,
+    0xE3, 0x00, 0xD1, 0x81, 0x2A, 0xB7, 0x65, 0xC7, 0xDC, 0xE2, 0x7F, 0x0D, 0xB2, 0xA2, 0xFC, 0x7B,
+    0x2F, 0x5B, 0xF3, 0x9C, 0x48, 0xC2, 0x87, 0x20, 0xC2, 0xA3, 0x51, 0xB3, 0xBE, 0xB3, 0x75, 0x24,
+    0x1F, 0xA1, 0xC1, 0xA0, 0x76, 0x18, 0xD4, 0x16, 0x83, 0x73, 0xED, 0xC9, 0x17, 0x6F, 0xFC, 0xE0,
+    0xBA, 0x1B, 0x92, 0xB6, 0xE2, 0xB5, 0xCF, 0x3A, 0xF9, 0x67, 0xB7, 0xF4, 0xFC, 0x6B, 0x8C, 0x6D,
+    0x8E, 0xB4, 0xBD, 0x5B, 0xCA, 0x19, 0xE7, 0x6E, 0xE8, 0xC2, 0xD3, 0x0F, 0x8E, 0x09, 0x1B, 0x6A,
+    0xF8, 0x9A, 0x8D, 0xE3, 0x2B, 0x4E, 0x77, 0x55, 0xAD, 0x4C, 0x54, 0x3F, 0x28, 0x13, 0xEC, 0x28,
+    0xD2, 0x97, 0x93, 0xB5, 0xC5, 0x8F, 0x6E, 0x71, 0xF1, 0x11, 0xD4, 0xA6, 0x47, 0xC8, 0x8B, 0x64,
+    0x57, 0xA6, 0xFC, 0x2F, 0x90, 0x58, 0x29, 0x4C, 0xF2, 0xFD, 0x9B, 0xE3, 0x23, 0xF1, 0x1C, 0x1F,
+    0x39, 0xB4, 0x54, 0x22, 0xB0, 0x54, 0x07, 0x3F, 0x1E, 0x1F, 0x13, 0x59, 0x28, 0x0F, 0x6F, 0x7C,
+    0x77, 0x5E, 0xE2, 0x6E, 0xC9, 0xF3, 0x5C, 0x06, 0xA1, 0xF5, 0x16, 0x40, 0x48, 0xB9, 0x5F, 0xA2,
+    0xD2, 0x2C, 0xE5, 0xE7, 0xC8, 0x34, 0x6C, 0x71, 0x4D, 0x0F, 0x8A, 0xAB, 0x73, 0xA1, 0x9E, 0x47,
+    0x9F, 0x97, 0x7D, 0xF6, 0x7C, 0x5F, 0xFA, 0x67, 0x1E, 0xBB, 0x8E, 0x64, 0x88, 0x2A, 0xB8, 0x26,
+    0x50, 0x3F, 0x8B, 0x7A, 0xCF, 0xCC, 0x99, 0x80, 0xF2, 0x7D, 0x0C, 0xD9, 0x75, 0x6F, 0xA2, 0xF4,
+    0x11, 0x3D, 0x43, 0x5B, 0x94, 0xC5, 0xA2, 0x24, 0x16, 0xF5, 0xCC, 0xC9, 0xDB, 0x70, 0x11, 0xD5,
+    0x6B, 0xDB, 0x17, 0xB4, 0x62, 0x2B, 0x87, 0xC8, 0x78, 0xE2, 0xE0, 0x37, 0xF1, 0x46, 0x79, 0xC5,
+    0x2F, 0x74, 0x51, 0xDC, 0x61, 0x61, 0xF2, 0x5C, 0xF4, 0x35, 0xBE, 0xD7, 0x8F, 0xF8, 0x6D, 0x5B,
+    0xF0, 0x2C, 0xF2, 0x9C, 0x5F, 0x56, 0xA5, 0x9E, 0x59, 0x04, 0x1F, 0xC4, 0xD5, 0x4D, 0xB2, 0xEF,
+    0x1F, 0x85, 0x91, 0xBE, 0x9C, 0xD7, 0x4A, 0x2D, 0x1F, 0x74, 0xA2, 0xD2, 0xAB, 0x46, 0x8E, 0xA3,
+    0xEC, 0xF1, 0x5B, 0xD5, 0x03, 0xDE, 0x25, 0x46, 0xFA, 0x81, 0xA2, 0x0A, 0x86, 0x58, 0xB0, 0x4A,
+    0x1F, 0xA3, 0x8E, 0x7B, 0xB5, 0xAE, 0xC1, 0x7F, 0xB1, 0x9F, 0x67, 0x43, 0x13, 0x52, 0xC0, 0xAC,
+    0x0D, 0xE5, 0x29, 0x61, 0x2B, 0x96, 0xEB, 0x41, 0x46, 0xFA, 0x6D, 0xE8, 0x08, 0xAB, 0x0D, 0xCE,
+    0x38, 0xE4, 0x10, 0x65, 0xCF, 0x9F, 0xD9, 0xC5, 0xC7, 0x11, 0x5D, 0x16, 0xD5, 0x4C, 0x98, 0x47,
+    0x84, 0xBF, 0xA3, 0x1F, 0x5E, 0xE3, 0x22, 0x41, 0x7A, 0x92, 0xC2, 0x69, 0xC1, 0xE1, 0x2E, 0x0C,
+    0x85, 0x6C, 0xC0, 0xCC, 0x65, 0x03, 0xFA, 0x9B, 0xD9, 0x80, 0x4B, 0x9F, 0xEA, 0xAF, 0xEE, 0xED,
+    0xB1, 0xBF, 0x6F, 0x65, 0xF8, 0xC1, 0x77, 0xE3, 0x99, 0x17, 0x90, 0xD1, 0xD2, 0x89, 0x01, 0x4C,
+    0x66, 0x8E, 0xE7, 0xD4, 0x4C, 0x62, 0xB9, 0xE8, 0x6F, 0x97, 0xA8, 0x53, 0xDE, 0xCE, 0x67, 0x9F,
+    0xFA, 0x3E, 0x58, 0x1F, 0x3E, 0x85, 0x9F, 0x3D, 0x8F, 0xDF, 0xBA, 0x06, 0x26, 0x30, 0xAD, 0xAE,
+    0x4E, 0x73, 0x66, 0x10, 0xCE, 0x73, 0xB1, 0x56, 0x6C, 0xA9, 0x9F, 0x65, 0x70, 0xD7, 0x7E, 0xD0,
+    0x4E, 0x08, 0xEB, 0x93, 0x83, 0x77, 0xE6, 0x8B, 0x77, 0xA4, 0xAC, 0xA0, 0x30, 0x07, 0x5D, 0x7B,
+    0x17, 0x54, 0xA6, 0xEC, 0xBE, 0x5C, 0xBC, 0xE6, 0x66, 0xE1, 0x74, 0xB7, 0x7E, 0xB2, 0x52, 0x88,
+    0x3E, 0x9C, 0x51, 0x9B, 0x67, 0x26, 0x6A, 0xF0, 0xB9, 0x66, 0xC5, 0x83, 0xEB, 0xD1, 0xF8, 0x3B,
+    0x49, 0x3B, 0x42, 0x45, 0x85, 0x89, 0x6E, 0x3C, 0x69, 0x6E, 0xF8, 0x28, 0xDD, 0xF7, 0x5F, 0xAD,
+    0xCF, 0xD8, 0x21, 0xFB, 0xDD, 0xD7, 0xDA, 0xED, 0x3E, 0x5D, 0x46, 0xAB, 0xA5, 0xAF, 0x1F, 0xB6,
+    0x5A, 0x7F, 0xEE, 0x09, 0x98, 0xBE, 0x28, 0x10, 0xF5, 0x29, 0x40, 0xA1, 0xE7, 0xD6, 0xF0, 0xEC,
+    0x41, 0x25, 0x7F, 0xBF, 0x56, 0xC9, 0x5F, 0x23, 0x0B, 0x27, 0x98, 0x90, 0x5A, 0x84, 0x08, 0xC8,
+    0x7B, 0x55, 0xF2, 0x7F, 0xA4, 0x95, 0xB2, 0x1D, 0x48, 0xAA, 0xE3, 0x47, 0x5F, 0xE9, 0x7B, 0xAD,
+    0xC6, 0xDA, 0xA9, 0xFC, 0xC9, 0xB7, 0xDE, 0xF7, 0x6A, 0xEE, 0xD8, 0xDE, 0xDE, 0xDE, 0x15, 0x7F,
+    0xD8, 0xBD, 0xFD, 0x40, 0xD4, 0xF0, 0x3B, 0xE8, 0xC3, 0x3E, 0x71, 0xC3, 0x4D, 0xFA, 0xF0, 0x17,
+    0xFD, 0x49, 0x07, 0x83, 0x20, 0x6F, 0x74, 0x87, 0xC1, 0xF7, 0xA5, 0xE0, 0xC0, 0xFB, 0x70, 0x1B,
+    0x9A, 0x8D, 0xCE, 0x6A, 0x42, 0xC7, 0x03, 0x5D, 0x71, 0x77, 0x7C, 0x42, 0x50, 0xE0, 0x3E, 0xE0,
+    0x80, 0x31, 0xB8, 0x33, 0x8B, 0xE1, 0x73, 0xDF, 0x05, 0xF8, 0x39, 0x52, 0x18, 0x5C, 0xA0, 0x71,
+    0xAE, 0x49, 0x2D, 0x94, 0x9D, 0x11, 0xDD, 0x89, 0x11, 0x53, 0xAF, 0x22, 0x5A, 0x33, 0x27, 0x89,
+    0x3F, 0xB6, 0x89, 0x51, 0x2E, 0x31, 0x90, 0x45, 0x37, 0xE8, 0x0F, 0x19, 0x78, 0x78, 0x9B, 0x2E,
+    0x2B, 0xBB, 0x44, 0x06, 0xDC, 0x07, 0xCA, 0xAA, 0x33, 0x4D, 0xA1, 0xAC, 0x7A, 0x54, 0xC6, 0x25,
+    0x51, 0xB5, 0xA4, 0x82, 0x2E, 0x7B, 0x73, 0xA3, 0x4A, 0x51, 0x55, 0x42, 0x04, 0x75, 0x23, 0xCB,
+    0xDC, 0x2D, 0xF4, 0x3C, 0x38, 0x3F, 0x86, 0x27, 0x68, 0x1E, 0x8F, 0xAF, 0xF7, 0x0F, 0xB8, 0xCB,
+    0x28, 0xEC, 0x9D, 0x3E, 0xC3, 0x4C, 0x67, 0x4A, 0x82, 0x97, 0xF1, 0xFB, 0x27, 0xE9, 0xED, 0xED,
+    0x08, 0x9E, 0xB2, 0xA3, 0x77, 0x19, 0x85, 0x0F, 0xB1, 0x27, 0x4A, 0xFA, 0x0D, 0x7A, 0xF7, 0xC1,
+    0x0A, 0x7E, 0x97, 0xF2, 0xCD, 0x3D, 0xFF, 0xEA, 0xF4, 0x3F, 0x60, 0x1E, 0xFE, 0x98, 0x3F, 0xC0,
+    0xC9, 0x39, 0xFA, 0x01, 0x7E, 0x9A, 0x12, 0xBD, 0x47, 0x4A, 0xB8, 0x9C, 0x77, 0x36, 0x52, 0x11,
+    0xEF, 0x40, 0xA7, 0xEF, 0x0F, 0x5B, 0x19, 0xF7, 0x51, 0xAA, 0x14, 0x0F, 0xEA, 0xFA, 0x5C, 0xCE,
+    0x88, 0xD7, 0x1F, 0x34, 0x68, 0x72, 0x6A, 0xB9, 0xBD, 0xA1, 0x78, 0xCB, 0xDF, 0xDB, 0xDB, 0xA3,
+    0xC7, 0x8B, 0x5A, 0x97, 0x1F, 0x23, 0x84, 0xE1, 0x38, 0x1C, 0x2C, 0xF7, 0x6C, 0x7C, 0xCC, 0xFA,
+    0x46, 0xED, 0xEC, 0x0D, 0xE9, 0x3B, 0x2B, 0x7E, 0xDE, 0xA4, 0xAD, 0xE7, 0x28, 0xC2, 0x5A, 0xD8,
+    0x43, 0xDE, 0xFB, 0xEB, 0xCC, 0xDA, 0xC2, 0x3B, 0xB6, 0x6E, 0x28, 0xF9, 0x9E, 0xAD, 0xDF, 0xD8,
+    0x59, 0xBF, 0xF3, 0x75, 0x75, 0x4B, 0xEB, 0xF7, 0x1F, 0xCA, 0x47, 0x28, 0x6D, 0x60, 0xA3, 0xF4,
+    0xE1, 0x61, 0x19, 0x6F, 0xC4, 0x46, 0xBF, 0x98, 0x0E, 0xE5, 0x1F, 0x6F, 0x89, 0xE9, 0x9C, 0xFB,
+    0xFB, 0xF8, 0x41, 0x02, 0xEE, 0x1F, 0xB5, 0x07, 0xF9, 0x2B, 0x27, 0xB2, 0x8F, 0x52, 0x86, 0x3A,
+    0xC1, 0x5D, 0x98, 0x69, 0xE4, 0x28, 0xD2, 0xD4, 0x12, 0xE4, 0xBA, 0x80, 0x96, 0x5B, 0xE7, 0xEE,
+    0xA6, 0x0C, 0xCF, 0x46, 0x33, 0x3C, 0xDB, 0xF5, 0xFC, 0x63, 0xE7, 0x4F, 0xD3, 0xE0, 0x9B, 0xCF,
+    0x48, 0xC8, 0xD2, 0x98, 0xE1, 0xD9, 0xDB, 0x9E, 0xDA, 0x59, 0xCD, 0xB1, 0xBD, 0xA5, 0xB4, 0x6D,
+    0x55, 0xCE, 0x0A, 0xCB, 0x3F, 0xFF, 0x91, 0x49, 0xB5, 0x75, 0xD1, 0xFE, 0xA4, 0x50, 0xCF, 0x7C,
+    0x75, 0xE0, 0x74, 0xFE, 0x48, 0xC9, 0xB0, 0x3F, 0x87, 0x00, 0x8F, 0xD9, 0xEF, 0xA3, 0xE0, 0xD4,
+    0x7D, 0x8C, 0xEA, 0xFB, 0xC8, 0x6D, 0xFD, 0xFF, 0xD5, 0x9A, 0x3F, 0x8C, 0x1C, 0x57, 0x1D, 0xC7,
+    0x7F, 0x33, 0x73, 0xE7, 0x75, 0x3C, 0x0A, 0xB3, 0xC5, 0x59, 0x90, 0x0B, 0x78, 0x3B, 0x0A, 0x13,
+    0x7B, 0x9B, 0x08, 0x21, 0x72, 0xF6, 0x0C, 0x44, 0x22, 0x05, 0x45, 0xAE, 0xC0, 0x35, 0x14, 0x14,
+    0x54, 0x54, 0x14, 0x11, 0x9C, 0x3D, 0x2B, 0x28, 0xD2, 0x50, 0xB8, 0xA4, 0x8B, 0x8B, 0x14, 0xC1,
+    0x14, 0xA1, 0x70, 0x61, 0x21, 0xDB, 0x33, 0x52, 0xA4, 0x80, 0x14, 0x24, 0x96, 0x3F, 0x21, 0x41,
+    0x14, 0x99, 0x10, 0x4B, 0x14, 0x2E, 0x6E, 0x8A, 0x01, 0x56, 0xCE, 0xEE, 0x3E, 0x7E, 0xDF, 0xEF,
+    0xEF, 0xCD, 0xEE, 0x9E, 0x31, 0xA2, 0xE0, 0x6E, 0x6F, 0x76, 0xEC, 0xFB, 0xDD, 0xDE, 0xEE, 0xEC,
+    0xBC, 0xDF, 0xFB, 0xBC, 0xDF, 0x7B, 0xBF, 0xEF, 0xFB, 0x23, 0x22, 0x49, 0x2D, 0x7A, 0xA5, 0xB4,
+    0x79, 0x03, 0xEB, 0x60, 0xC3, 0x47, 0x13, 0xB5, 0xD1, 0x7B, 0xB0, 0xF1, 0xEB, 0x53, 0xB5, 0x83,
+    0x1E, 0xEC, 0x15, 0xDA, 0x83, 0x68, 0xA6, 0xB6, 0x81, 0x0D, 0xAB, 0x68, 0xAE, 0x37, 0x3E, 0xFE,
+    0x85, 0xDA, 0xC4, 0x39, 0xA7, 0x37, 0x4A, 0xA8, 0xF6, 0xAA, 0x04, 0x6A, 0xEF, 0xA9, 0xCD, 0x44,
+    0x1F, 0xE8, 0xB2, 0xA8, 0xD1, 0xD7, 0xE5, 0x70, 0x2E, 0x5F, 0x72, 0x0F, 0x73, 0x97, 0xA5, 0x0E,
+    0x8F, 0xE6, 0xB5, 0x43, 0xAB, 0xF7, 0xE9, 0xD3, 0x68, 0xF1, 0x4D, 0xBD, 0xBE, 0x07, 0x73, 0x66,
+    0xFE, 0x8D, 0x4C, 0x72, 0xE7, 0xB2, 0xC0, 0xE9, 0x63, 0xA3, 0xA9, 0x9A, 0xA4, 0xD1, 0x22, 0x07,
+    0xB5, 0x96, 0x9E, 0x8E, 0xA3, 0xA9, 0xE4, 0xA5, 0xFA, 0x54, 0x94, 0xB1, 0x9A, 0x51, 0x32, 0x11,
+    0x37, 0x1A, 0x34, 0x6A, 0xB4, 0x46, 0xC5, 0xE8, 0xED, 0x5A, 0xF2, 0x3F, 0xFC, 0xAE, 0xD1, 0xC2,
+    0x5E, 0x75, 0x65, 0x32, 0xEB, 0xA9, 0x8F, 0x99, 0xEC, 0x8B, 0x6C, 0xB3, 0xCE, 0xA5, 0x9A, 0x62,
+    0x8C, 0x7A, 0xE3, 0xD5, 0xAE, 0x39, 0x73, 0x86, 0x6E, 0x0D, 0xE6, 0xB0, 0x67, 0x53, 0xBE, 0x75,
+    0x15, 0x26, 0x44, 0xBD, 0x25, 0x2A, 0x69, 0x47, 0xB2, 0xB8, 0x4E, 0x9F, 0x5F, 0xA1, 0xDE, 0x04,
+    0x9F, 0x56, 0xFA, 0xEA, 0xEB, 0xF0, 0x22, 0xC2, 0xAB, 0x21, 0x3C, 0xDC, 0xC3, 0xA7, 0x5F, 0x69,
+    0x1D, 0x3D, 0x11, 0x90, 0x7C, 0x70, 0xC6, 0x5F, 0x43, 0xBE, 0x7E, 0xF3, 0x80, 0x50, 0x66, 0x37,
+    0xC9, 0x23, 0x87, 0x0D, 0x9A, 0x04, 0xDE, 0x84, 0xA3, 0x70, 0x05, 0x9B, 0xE7, 0xE6, 0xC1, 0x79,
+    0x72, 0x86, 0xCE, 0xB3, 0xF3, 0xF0, 0x3C, 0x3D, 0x8F, 0xCF, 0xF3, 0xF3, 0x00, 0x8D, 0xA0, 0x47,
+    0xE8, 0x19, 0x7A, 0x88, 0x9E, 0xA2, 0xC7, 0xE8, 0x39, 0x1A, 0x48, 0x31, 0x92, 0x62, 0x28, 0x65,
+    0x85, 0xE5, 0x9B, 0x1E, 0x5F, 0xF1, 0x6A, 0xA6, 0xDF, 0xFE, 0x50, 0xCB, 0xFE, 0xA0, 0xC2, 0x23,
+    0x26, 0x88, 0xD1, 0x9D, 0x13, 0xE5, 0xF8, 0x9C, 0x41, 0x21, 0xCA, 0xDE, 0xBB, 0x70, 0x24, 0x78,
+    0x63, 0xBA, 0x60, 0x68, 0x08, 0x8F, 0x10, 0x3C, 0xC5, 0xB8, 0x0B, 0xD1, 0xB8, 0x01, 0x4B, 0x7E,
+    0xAD, 0x50, 0x8F, 0x77, 0x15, 0xE6, 0x1A, 0x51, 0xE9, 0x75, 0x97, 0x71, 0xF5, 0x91, 0x81, 0x58,
+    0x84, 0x5D, 0x32, 0xBD, 0xD5, 0x4D, 0x60, 0x78, 0x28, 0x06, 0x8E, 0x2F, 0xA2, 0x6B, 0x86, 0xE3,
+    0x36, 0xC0, 0x7E, 0xB3, 0x56, 0x6A, 0x83, 0xD1, 0x77, 0x50, 0xF3, 0xC7, 0x00, 0xF0, 0x0F, 0xB4,
+    0x98, 0x64, 0xBB, 0xD6, 0x65, 0x49, 0xA7, 0xAB, 0xC1, 0x66, 0x0E, 0x44, 0x93, 0xCF, 0xE0, 0x9B,
+    0xF7, 0x45, 0x2E, 0xC4, 0x7C, 0x0B, 0x55, 0x42, 0xEC, 0x85, 0x6B, 0x8E, 0xBD, 0xE0, 0x5B, 0x36,
+    0xBE, 0x71, 0xC4, 0x63, 0x9A, 0x7A, 0x30, 0x84, 0x1B, 0x4D, 0xAC, 0x7E, 0x04, 0x59, 0x90, 0x75,
+    0x28, 0x31, 0x58, 0x9A, 0xB3, 0xEC, 0x26, 0x6E, 0xC5, 0x5E, 0xE4, 0xFB, 0xE7, 0xDB, 0x37, 0x22,
+    0xA7, 0xF8, 0x92, 0x3F, 0xAA, 0xA7, 0xE9, 0x1A, 0x18, 0x5A, 0xEE, 0x1D, 0x3F, 0x2D, 0xF7, 0xCA,
+    0x76, 0xB6, 0xC8, 0x24, 0xC2, 0x44, 0xD2, 0xFF, 0x3D, 0xEC, 0x9D, 0x1E, 0x42, 0x31, 0x2D, 0xF8,
+    0x21, 0x03, 0x35, 0xD8, 0xEF, 0x48, 0x06, 0x0E, 0x6E, 0xB5, 0x29, 0x17, 0x63, 0xF7, 0xF6, 0xE7,
+    0xFA, 0x78, 0xA1, 0xAE, 0xF4, 0xC0, 0xD4, 0xD4, 0xCC, 0xCE, 0x09, 0x67, 0x60, 0x6B, 0x65, 0xE6,
+    0x58, 0xAF, 0x4F, 0xBA, 0x4E, 0x8D, 0xD0, 0xA4, 0x69, 0x5B, 0x79, 0xFB, 0xEC, 0x29, 0x50, 0x13,
+    0x76, 0x64, 0x93, 0x11, 0xC1, 0x17, 0x36, 0x28, 0xE2, 0x76, 0x41, 0xE7, 0xA5, 0xB2, 0x6D, 0x6C,
+    0x86, 0xDD, 0xE7, 0x4F, 0x01, 0x60, 0x7C, 0x13, 0xF9, 0x24, 0x65, 0x3E, 0x79, 0x8D, 0x5D, 0xB9,
+    0x7F, 0x8E, 0x00, 0x83, 0x8E, 0x03, 0xA4, 0x33, 0xB3, 0x73, 0x18, 0xF7, 0xF4, 0x51, 0x71, 0x3C,
+    0xF5, 0xF9, 0x64, 0x5B, 0x4E, 0x81, 0x62, 0x5F, 0x50, 0x4A, 0xCD, 0xA6, 0xBC, 0xFF, 0x6D, 0x32,
+    0x63, 0x56, 0x19, 0xD0, 0xD1, 0x95, 0x74, 0xD2, 0x85, 0x7C, 0xB2, 0x65, 0x22, 0x9D, 0x9E, 0xAD,
+    0x4E, 0xD4, 0xEE, 0xDB, 0x87, 0x5B, 0x10, 0x63, 0xDA, 0x89, 0x92, 0x3F, 0x37, 0x6B, 0x64, 0x48,
+    0xA7, 0x20, 0x05, 0xF4, 0xC6, 0xD6, 0x5C, 0x27, 0x24, 0xAD, 0x64, 0xE6, 0xAD, 0x16, 0xA2, 0x73,
+    0xB9, 0xDE, 0x4C, 0xEB, 0x2C, 0x5A, 0xC2, 0x05, 0x65, 0x35, 0x85, 0xE6, 0x4E, 0x58, 0xB7, 0x84,
+    0x38, 0x07, 0x8D, 0x25, 0x75, 0xF8, 0x9C, 0x9A, 0xAD, 0x16, 0xB9, 0xCA, 0x67, 0xD1, 0xA2, 0xCD,
+    0xA2, 0xFB, 0x2C, 0xA9, 0x06, 0x2F, 0x55, 0xC2, 0x5A, 0x91, 0x5E, 0x85, 0xAF, 0xBA, 0xB1, 0x14,
+    0x6A, 0x4B, 0x39, 0x72, 0x59, 0xD3, 0x0D, 0x57, 0x6C, 0xCC, 0xD1, 0xFA, 0x8C, 0x16, 0x92, 0xBA,
+    0x3A, 0x98, 0x25, 0x4D, 0xAF, 0x49, 0x9A, 0xA4, 0x4E, 0x9A, 0x61, 0x95, 0xD4, 0x69, 0x99, 0x8E,
+    0xF3, 0x77, 0x5D, 0x56, 0x68, 0x03, 0xBB, 0xF7, 0xAD, 0x4A, 0x98, 0xE4, 0xE5, 0x65, 0x98, 0xA5,
+    0x75, 0x92, 0x0D, 0xDC, 0x5C, 0x4B, 0x6C, 0x6C, 0xE4, 0x57, 0x37, 0xE3, 0xC6, 0xF4, 0x1B, 0x2A,
+    0xD3, 0xA3, 0xCB, 0xC1, 0x03, 0x0E, 0x6E, 0x87, 0x9C, 0x77, 0xC5, 0xF4, 0x26, 0xA1, 0xE5, 0x84,
+    0xCC, 0x46, 0x5E, 0xA9, 0x17, 0xFE, 0x9D, 0x3E, 0x29, 0x04, 0x52, 0x74, 0x58, 0x9A, 0xB3, 0x48,
+    0x65, 0x0F, 0xBC, 0x83, 0x95, 0x8F, 0x9C, 0x63, 0x20, 0xD5, 0x36, 0x46, 0x73, 0x01, 0xAE, 0xCE,
+    0x31, 0xDA, 0xDF, 0x60, 0x6C, 0xD7, 0x43, 0x83, 0xD6, 0x11, 0x1E, 0x01, 0x23, 0xE6, 0x92, 0xBA,
+    0x78, 0x4F, 0x7E, 0xA5, 0xCE, 0xD3, 0xBD, 0xE0, 0x78, 0x39, 0x30, 0x01, 0x53, 0xB6, 0xDC, 0x4E,
+    0xA8, 0xA2, 0x7F, 0x86, 0xA0, 0xFC, 0x2B, 0xFC, 0x4D, 0x43, 0x70, 0xFF, 0xAE, 0xFE, 0xEB, 0x48,
+    0x74, 0x98, 0xC4, 0xC2, 0xAC, 0x29, 0xC1, 0x98, 0xFD, 0x27, 0x2D, 0xE7, 0xD7, 0xFA, 0xD7, 0x8D,
+    0xA0, 0xC1, 0xB0, 0xDD, 0x97, 0x25, 0x19, 0xA0, 0x11, 0xB0, 0x11, 0xC0, 0x11, 0xD0, 0x11, 0xE0,
+    0x11, 0xF0, 0x11, 0x00, 0x12, 0x10, 0x22, 0x22, 0x1B, 0x28, 0x00, 0x89, 0x94, 0x04, 0x98, 0x04,
+    0x9C, 0x0C, 0x94, 0x91, 0xB2, 0x29, 0x50, 0x68, 0x3D, 0xA5, 0xB9, 0x4D, 0xED, 0xCC, 0xEF, 0x75,
+    0x11, 0x15, 0xA6, 0xE5, 0x74, 0xE8, 0x8E, 0x66, 0xDD, 0xCF, 0xEA, 0x1B, 0xC0, 0x04, 0x4A, 0x2D,
+    0xA4, 0x63, 0x0A, 0x9E, 0xE7, 0x99, 0x94, 0x5E, 0xA2, 0x8B, 0x98, 0xCC, 0x6A, 0x08, 0x61, 0xBE,
+    0xE8, 0x7E, 0xDA, 0xDD, 0x10, 0xE2, 0x72, 0xD8, 0x97, 0xC7, 0x5E, 0x33, 0x15, 0xDA, 0xD2, 0x11,
+    0x66, 0xDF, 0x6B, 0x8B, 0x23, 0x09, 0x1F, 0x3E, 0x23, 0x7E, 0x02, 0x2B, 0x17, 0x98, 0xDB, 0xB7,
+    0x02, 0x2E, 0x91, 0x31, 0xA6, 0xC2, 0xCE, 0xC6, 0x14, 0xAF, 0x5E, 0xF3, 0xAC, 0xBA, 0x7E, 0x4F,
+    0x2E, 0xE1, 0xD1, 0x90, 0x24, 0x05, 0xFA, 0xE1, 0x49, 0xC5, 0xD7, 0x79, 0x86, 0x17, 0x05, 0x65,
+    0xE8, 0xC0, 0x22, 0xFE, 0x18, 0x35, 0x1A, 0x66, 0x07, 0xB2, 0x3A, 0x37, 0xDD, 0x80, 0xF4, 0x2E,
+    0xD7, 0x84, 0x0B, 0x8D, 0x3D, 0xFD, 0xDA, 0xE0, 0x9D, 0x5A, 0x6E, 0xC8, 0xF1, 0xB2, 0x7A, 0x6A,
+    0xEA, 0xCF, 0x33, 0x2D, 0x53, 0x5F, 0xFD, 0xA4, 0xB6, 0x01, 0x1E, 0xA1, 0xBF, 0xB7, 0x5C, 0x07,
+    0xCE, 0x35, 0xE3, 0xE5, 0xFA, 0x00, 0x6A, 0xC1, 0x19, 0x69, 0x81, 0x15, 0x1F, 0x00, 0x4E, 0xA0,
+    0x84, 0x3A, 0xE0, 0x07, 0x7C, 0x40, 0x07, 0x6C, 0x40, 0x06, 0xF5, 0x86, 0x43, 0x2E, 0xA3, 0x70,
+    0x1C, 0xBA, 0x87, 0xD6, 0x0D, 0x18, 0xFF, 0xC1, 0xA3, 0x4A, 0x5E, 0xAE, 0xA4, 0x37, 0xD6, 0x96,
+    0x42, 0x81, 0x2F, 0x72, 0xB0, 0xFC, 0xB9, 0x66, 0x31, 0xB4, 0x8B, 0x16, 0xA3, 0xFF, 0xB5, 0x20,
+    0x2D, 0x47, 0x8B, 0x19, 0xD4, 0x28, 0x40, 0xF3, 0x9A, 0x16, 0xA1, 0x25, 0xA4, 0x1F, 0xAB, 0xAA,
+    0x1B, 0x61, 0x51, 0x25, 0x3B, 0x31, 0x0F, 0xF1, 0xE8, 0xDE, 0xE4, 0x09, 0x5A, 0xDB, 0xFC, 0x7A,
+    0x5E, 0x49, 0x3E, 0xB6, 0x79, 0x95, 0x5E, 0xE7, 0x6E, 0x67, 0x89, 0x1B, 0x05, 0x10, 0xA9, 0x90,
+    0x25, 0x10, 0xAA, 0x73, 0x38, 0x62, 0xFE, 0xC7, 0x13, 0x5F, 0x85, 0x64, 0xB2, 0x9F, 0xB8, 0x2A,
+    0xD2, 0x92, 0xFA, 0x7E, 0x33, 0xA1, 0xE0, 0xFF, 0xCB, 0xCB, 0xB8, 0x18, 0x3A, 0x8E, 0x8B, 0x8E,
+    0x8E, 0xA3, 0x3A, 0x7A, 0x93, 0xDE, 0xEF, 0xE0, 0x27, 0xFE, 0x2C, 0x20, 0x76, 0xD5, 0x77, 0xB8,
+    0x94, 0x8F, 0x51, 0xAF, 0x7C, 0x8C, 0x5A, 0x15, 0x65, 0xBA, 0xB0, 0xAE, 0x44, 0x1D, 0x55, 0x85,
+    0x57, 0xF0, 0x44, 0x2D, 0x42, 0xBD, 0x82, 0x33, 0x7A, 0x27, 0xDC, 0xC0, 0xC8, 0x84, 0x3F, 0x35,
+    0x4A, 0x42, 0xF7, 0x68, 0xC6, 0x62, 0xC7, 0xED, 0x0A, 0x19, 0x6B, 0x6D, 0x51, 0xD2, 0x4E, 0x29,
+    0xAC, 0x1B, 0xC4, 0x63, 0xD3, 0xE3, 0xE8, 0x40, 0x75, 0x38, 0x8F, 0xA7, 0xF1, 0x24, 0x9A, 0x25,
+    0xFA, 0x2A, 0xAD, 0x42, 0x97, 0x8E, 0x43, 0x97, 0xAB, 0x87, 0x85, 0xFE, 0xB8, 0x51, 0x6F, 0xE6,
+    0x46, 0xF1, 0x54, 0xE5, 0x78, 0x53, 0x94, 0xC3, 0x5A, 0xC3, 0xB3, 0x44, 0x10, 0x46, 0xC0, 0xBA,
+    0xC3, 0x09, 0x8C, 0x04, 0x68, 0x29, 0x67, 0x3F, 0xB6, 0x34, 0x2B, 0x5E, 0x7F, 0xA2, 0xA3, 0x84,
+    0xAF, 0xB0, 0x2C, 0x53, 0xA1, 0xC3, 0x6C, 0xB1, 0x7C, 0x2B, 0xBF, 0xEC, 0x16, 0x29, 0xBF, 0x95,
+    0x82, 0x38, 0x46, 0x20, 0x53, 0x71, 0xB4, 0x9D, 0xE7, 0xC5, 0x76, 0xFE, 0xF2, 0xFF, 0xF3, 0x7A,
+    0x42, 0x7D, 0xC5, 0x54, 0x5F, 0x1F, 0x2E, 0x87, 0xFF, 0xE0, 0x89, 0xE1, 0xBF, 0x23, 0x6C, 0xDE,
+    0xF2, 0x3A, 0x28, 0x7F, 0x5D, 0x11, 0xB9, 0xBF, 0x68, 0xFF, 0xF9, 0x04, 0x7D, 0x30, 0xBB, 0x77,
+    0x74, 0xBD, 0x90, 0xFD, 0x57, 0x07, 0xCC, 0x39, 0xBB, 0x8A, 0xF6, 0x1A, 0x30, 0x12, 0x40, 0x12,
+    0x50, 0x12, 0x60, 0x12, 0x70, 0x12, 0x80, 0x12, 0x90, 0xC2, 0x4C, 0xAF, 0x11, 0xB0, 0x12, 0xC0,
+    0xB2, 0xDC, 0x49, 0x5C, 0xF6, 0x5C, 0xCB, 0x93, 0x5E, 0x83, 0xDD, 0xF1, 0x1A, 0xAC, 0xEC, 0x34,
+    0x30, 0x2A, 0x56, 0x54, 0x60, 0x2F, 0x1F, 0xC9, 0x33, 0xFA, 0x3E, 0x60, 0x81, 0x55, 0x8B, 0xEA,
+    0x98, 0x02, 0xE9, 0x79, 0xA6, 0x99, 0xAF, 0xAE, 0x28, 0xB1, 0x98, 0x55, 0xFF, 0x6D, 0xD7, 0xC3,
+    0x29, 0xC1, 0x1F, 0xCF, 0xD5, 0x7E, 0x16, 0x6A, 0x31, 0xF5, 0xFE, 0x1A, 0x63, 0xEA, 0x7F, 0xEA,
+    0xB1, 0xB2, 0xF3, 0x1D, 0x52, 0x5D, 0x98, 0xC5, 0x58, 0x66, 0x39, 0x54, 0x37, 0x16, 0x6B, 0x58,
+    0x92, 0x63, 0x33, 0x18, 0x77, 0xAE, 0x8F, 0x25, 0x64, 0x8E, 0x09, 0x1D, 0xA1, 0xD4, 0x11, 0x8A,
+    0x1D, 0xA1, 0xDC, 0x59, 0x55, 0xD6, 0x1B, 0x90, 0x10, 0x29, 0x3E, 0xF5, 0x6E, 0x08, 0xCF, 0xF8,
+    0x6F, 0xCD, 0xB1, 0xF7, 0xD9, 0xA7, 0x27, 0x4B, 0xDB, 0x53, 0x12, 0x6B, 0x44, 0x19, 0xD8, 0x92,
+    0x47, 0x6A, 0x72, 0x64, 0xD2, 0x8A, 0x17, 0xBF, 0x14, 0x18, 0xD7, 0xC4, 0x98, 0xD4, 0xE4, 0x18,
+    0xD7, 0x04, 0xA9, 0xA9, 0x04, 0x24, 0x5F, 0x2E, 0x89, 0xF2, 0x23, 0x4A, 0xA7, 0x62, 0x22, 0x06,
+    0x53, 0x8C, 0xA6, 0x18, 0x4E, 0x31, 0x9E, 0x92, 0x2E, 0x7F, 0x69, 0xC3, 0x19, 0x52, 0x31, 0xA6,
+    0x1E, 0xAA, 0xA7, 0xEA, 0xB1, 0x7A, 0xAE, 0x1E, 0x6C, 0x4B, 0xB6, 0x45, 0xBB, 0x88, 0xCA, 0x6B,
+    0xD6, 0x7D, 0x38, 0x6B, 0x98, 0x2C, 0x7A, 0xBA, 0x8A, 0xF3, 0x2D, 0x86, 0xCB, 0x83, 0x76, 0x01,
+    0x51, 0x61, 0x3A, 0x86, 0xE2, 0x55, 0xC6, 0xE2, 0x1E, 0x82, 0x71, 0x5E, 0x23, 0x1A, 0x35, 0x44,
+    0x18, 0x8E, 0x16, 0x8F, 0x16, 0x90, 0x16, 0x91, 0x16, 0x92, 0x16, 0x93, 0x16, 0x94, 0x16, 0x95,
+    0x16, 0x96, 0x16, 0x97, 0x3E, 0x30, 0xDB, 0xC8, 0x3C, 0x2F, 0x2B, 0x3B, 0x60, 0x32, 0x30, 0x5F,
+    0x7B, 0x96, 0x4A, 0x82, 0x49, 0x7B, 0xFA, 0x64, 0x13, 0xD0, 0xDA, 0xAC, 0xC8, 0x16, 0xAA, 0x62,
+    0x56, 0x20, 0x34, 0xFF, 0xAF, 0x13, 0xED, 0xD6, 0xDA, 0xD1, 0xFA, 0x02, 0x4D, 0xE3, 0xB5, 0x22,
+    0xCF, 0xAB, 0x3C, 0x2F, 0xF3, 0x7C, 0x78, 0xAB, 0xD0, 0xDB, 0x8C, 0xE0, 0x5D, 0x9C, 0xA6, 0x31,
+    0x11, 0x68, 0x32, 0xD0, 0x84, 0xA0, 0x5F, 0x42, 0x50, 0x31, 0xB8, 0x45, 0x39, 0xB8, 0x6E, 0xDA,
+    0x7E, 0xF9, 0x6F, 0x50, 0xBD, 0xC0, 0x78, 0x9E, 0x93, 0xEC, 0x63, 0x4E, 0x8F, 0x83, 0xCA, 0x66,
+    0xB0, 0x7A, 0xCF, 0x46, 0x60, 0xB6, 0x01, 0x78, 0x92, 0xF0, 0x93, 0xEF, 0xE3, 0x88, 0x4E, 0x81,
+    0x81, 0xEF, 0x07, 0x83, 0x7A, 0x8B, 0x3B, 0x1E, 0x6B, 0x0F, 0x64, 0xD9, 0xA4, 0xF0, 0x8C, 0x2C,
+    0x49, 0xC4, 0xB3, 0xD5, 0x94, 0x11, 0x3E, 0x3C, 0xBA, 0x43, 0xB3, 0x66, 0x84, 0x56, 0x28, 0xB7,
+    0x60, 0xDA, 0x63, 0x06, 0xEC, 0x2C, 0x37, 0xAC, 0x16, 0xB3, 0x9E, 0xAB, 0x87, 0xCA, 0xD3, 0x55,
+    0xD8, 0x0E, 0xBA, 0x4E, 0x0C, 0x07, 0xCC, 0x7F, 0x77, 0xC9, 0xA2, 0xC1, 0x02, 0x81, 0xEA, 0x40,
+    0xAD, 0xBE, 0x6A, 0x2D, 0x2D, 0x35, 0xA8, 0x30, 0xC7, 0x0E, 0x2B, 0x70, 0xD1, 0xCE, 0x37, 0xA8,
+    0xB1, 0x6A, 0xA7, 0x1E, 0xF4, 0xC8, 0x34, 0x86, 0xE7, 0xD8, 0xF6, 0xD4, 0xB0, 0x4F, 0x38, 0x7F,
+    0x1F, 0x90, 0xE7, 0x15, 0x2D, 0xAB, 0xC1, 0xA0, 0x9E, 0x38, 0xAC, 0x7F, 0x04, 0xCE, 0x76, 0xA8,
+    0xB2, 0xA5, 0x87, 0xF9, 0xE8, 0xA9, 0x1E, 0x5E, 0xBC, 0x2D, 0x17, 0x47, 0xE9, 0x1C, 0x7B, 0x4F,
+    0x33, 0xAD, 0xB0, 0xBA, 0xE1, 0x32, 0x18, 0x75, 0x45, 0xE7, 0xFF, 0xC9, 0xE4, 0xC8, 0x2E, 0xD5,
+    0xB0, 0x56, 0x07, 0x87, 0x95, 0xB6, 0x7B, 0x5A, 0x0D, 0x61, 0x7E, 0x34, 0x91, 0xF4, 0x9F, 0xEF,
+    0x4D, 0xFB, 0xA9, 0xFB, 0xA6, 0xAB, 0x93, 0x69, 0xA4, 0x0F, 0xE6, 0x92, 0x40, 0xB0, 0xC8, 0xE5,
+    0xDC, 0xB2, 0xE3, 0x5A, 0xD3, 0x60, 0xB4, 0x1C, 0xB8, 0x13, 0x6E, 0x8D, 0x9E, 0x1D, 0x2E, 0xCF,
+    0xCE, 0x05, 0xD3, 0xE5, 0x68, 0x13, 0x95, 0x4B, 0xCD, 0xD4, 0x01, 0x7E, 0x76, 0x71, 0x9C, 0xF9,
+    0x14, 0xB5, 0xF9, 0x5A, 0xD3, 0x4E, 0xC9, 0x78, 0xAE, 0xE9, 0x12, 0x3E, 0x7D, 0xC1, 0xDF, 0x75,
+    0x32, 0x38, 0x17, 0x2A, 0xC9, 0x16, 0xF3, 0xFC, 0xAA, 0x9D, 0x8F, 0xF4, 0xB0, 0x69, 0xBB, 0xB1,
+    0x5F, 0xA2, 0x1E, 0x94, 0xC0, 0x36, 0x4B, 0xC7, 0xE0, 0x36, 0x1D, 0x94, 0x00, 0x77, 0x90, 0x94,
+    0x24, 0x97, 0x64, 0x44, 0x77, 0x9D, 0xEC, 0xB4, 0xA6, 0x80, 0xD7, 0x88, 0xA7, 0xE7, 0xF1, 0x91,
+    0xDF, 0x58, 0x3C, 0x40, 0x4F, 0xD0, 0x23, 0xF4, 0x0C, 0x3D, 0x44, 0x4F, 0xD1, 0x63, 0xF4, 0x1C,
+    0x3D, 0x48, 0x4F, 0xB2, 0x45, 0xB9, 0x64, 0x79, 0x2D, 0x5B, 0xEC, 0xA0, 0x5A, 0x7F, 0x4E, 0x2A,
+    0x9F, 0x35, 0xFB, 0xE8, 0x53, 0xFE, 0xA8, 0xE9, 0x14, 0x24, 0x7F, 0x3C, 0x25, 0xCA, 0x29, 0x59,
+    0x36, 0xE0, 0xF8, 0xCA, 0x18, 0x76, 0x4E, 0x9C, 0x37, 0x8D, 0xA7, 0x57, 0xD3, 0x24, 0x6A, 0x48,
+    0x8D, 0xA9, 0x41, 0x35, 0xAA, 0x86, 0x55, 0xC8, 0x55, 0x0C, 0x6C, 0x4B, 0xF6, 0x9A, 0x2C, 0x0F,
+    0xE0, 0xFA, 0x63, 0xB1, 0xAD, 0x70, 0x6B, 0xE7, 0xDD, 0x3A, 0x08, 0x6D, 0x02, 0xDA, 0xFF, 0xAA,
+    0x92, 0x0E, 0xA8, 0xBD, 0xB7, 0xD6, 0x8E, 0xD6, 0x17, 0x6F, 0x9D, 0xBD, 0xED, 0xED, 0xFE, 0x80,
+    0x93, 0xF5, 0x77, 0xDF, 0xE1, 0x41, 0x61, 0x33, 0x82, 0x77, 0xA5, 0xFB, 0x71, 0x2C, 0xB0, 0xC1,
+    0xC0, 0x07, 0x0A, 0x87, 0x03, 0x8C, 0x07, 0x7D, 0x0C, 0x08, 0xEB, 0xA6, 0xBD, 0x50, 0x49, 0x7B,
+    0xFF, 0xA9, 0x92, 0xC6, 0x0B, 0x95, 0xB4, 0x39, 0x98, 0xA3, 0x19, 0x4E, 0xD1, 0x24, 0xEE, 0x0D,
+    0xB8, 0x5B, 0x20, 0xEF, 0xEE, 0xC5, 0x13, 0x56, 0x35, 0x5B, 0x37, 0xDA, 0xC5, 0x4E, 0x56, 0xC7,
+    0xB9, 0x65, 0xAB, 0x87, 0xCB, 0x6D, 0x6A, 0xDF, 0xFE, 0xF2, 0x53, 0x7C, 0x3B, 0x75, 0xB3, 0x3C,
+    0xD1, 0xBF, 0x4E, 0x84, 0x8B, 0xBD, 0xA2, 0x66, 0x65, 0xAF, 0xE8, 0xE6, 0xF2, 0x74, 0x94, 0x1D,
+    0x6E, 0x0F, 0x4C, 0xDC, 0xD9, 0x59, 0x0D, 0xD3, 0x0C, 0xCB, 0xB0, 0x48, 0x21, 0x06, 0xCA, 0xDC,
+    0xDD, 0x52, 0xA5, 0x1A, 0xCF, 0x31, 0xC0, 0x60, 0x7B, 0xA2, 0x86, 0x1E, 0x50, 0x80, 0x48, 0xAE,
+    0xD8, 0x00, 0xCA, 0x2E, 0x53, 0xE3, 0x1C, 0x70, 0x4F, 0x0B, 0xC5, 0xE4, 0xEF, 0x70, 0x31, 0xEB,
+    0x03, 0x9E, 0x30, 0x3A, 0xE4, 0x83, 0x59, 0x4A, 0xB2, 0xB2, 0x06, 0x32, 0x5C, 0x39, 0x61, 0x64,
+    0x7B, 0x63, 0x39, 0xEC, 0xAE, 0x7B, 0x6C, 0x1B, 0x67, 0x16, 0x05, 0xFB, 0xCB, 0x6A, 0x44, 0x36,
+    0xBA, 0xD9, 0x38, 0x96, 0xAE, 0x06, 0x09, 0xBE, 0xF6, 0x16, 0x12, 0x5A, 0x3A, 0x83, 0x4C, 0xEE,
+    0x01, 0x2E, 0x9D, 0x2B, 0xB1, 0xA7, 0x82, 0xB3, 0x28, 0x2E, 0xC3, 0xAE, 0xB1, 0xAA, 0x6D, 0xBA,
+    0x78, 0x99, 0xB3, 0xF4, 0x3D, 0x36, 0xF6, 0x5D, 0x16, 0x8F, 0x02, 0x86, 0x9F, 0xC0, 0xE9, 0xE4,
+    0x5F, 0x23, 0xB6, 0xF7, 0x52, 0xF7, 0xDA, 0xD2, 0x42, 0x54, 0x3F, 0xB9, 0xAF, 0x30, 0x5B, 0xAC,
+    0xED, 0x14, 0x54, 0x79, 0xC5, 0xA4, 0x0B, 0xC4, 0x96, 0x97, 0x1D, 0x97, 0x8A, 0x56, 0xAC, 0x9F,
+    0x22, 0x9F, 0x06, 0xAB, 0x01, 0x7A, 0x64, 0x83, 0xA3, 0x55, 0x0E, 0x0B, 0x6B, 0xCA, 0x8A, 0xBB,
+    0x96, 0x31, 0xE7, 0x12, 0x97, 0xD9, 0xA6, 0x3B, 0x57, 0x96, 0xE7, 0x22, 0x4D, 0x63, 0xF1, 0x54,
+    0x9F, 0xC4, 0xD2, 0x95, 0x68, 0x6C, 0x45, 0x32, 0x3F, 0xFF, 0x21, 0xBF, 0xDD, 0xB7, 0x93, 0x73,
+    0x2B, 0xAB, 0x7A, 0x09, 0xEF, 0x79, 0xB6, 0x7B, 0x91, 0xD9, 0x5E, 0x2E, 0xC3, 0x7E, 0x93, 0xFB,
+    0xBB, 0x7E, 0xD2, 0x3B, 0xC4, 0x88, 0x91, 0xF8, 0x83, 0x75, 0x3B, 0x9D, 0xE1, 0x6C, 0xF9, 0x75,
+    0x1E, 0xC2, 0x45, 0xF7, 0x08, 0x2E, 0xBE, 0x8D, 0x4F, 0x2E, 0xD8, 0x01, 0xDA, 0xE5, 0x00, 0xD7,
+    0x19, 0xB6, 0xFF, 0x06, 0xB5, 0x58, 0xBF, 0x8F, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0xA5, 0x10, 0x39,
+    0xC6, 0x1E, 0x15, 0xA7, 0x42, 0xA7, 0xE8, 0x98, 0x22, 0x45, 0x70, 0xB0, 0x8E, 0x2E, 0x82, 0x40,
+    0xC5, 0xDD, 0x72, 0x7C, 0x2A, 0x02, 0x24, 0x40, 0x7C, 0x8D, 0x1A, 0x37, 0x4A, 0xE3, 0xE6, 0x10,
+    0xC0, 0x29, 0x02, 0xE4, 0x0A, 0x49, 0x1C, 0xC0, 0x40, 0x52, 0xB8, 0xF0, 0xFD, 0x01, 0x09, 0xA0,
+    0x00, 0x09, 0x20, 0x6D, 0x00, 0xB9, 0x49, 0x71, 0x31, 0x74, 0x3B, 0x73, 0x52, 0xE1, 0x32, 0x8C,
+    0xFE, 0x01, 0x13, 0xB1, 0x82, 0x20, 0x76, 0x61, 0x02, 0x26, 0x0C, 0x4A, 0xE2, 0x72, 0xF2, 0xBD,
+    0x99, 0xE5, 0xEE, 0x9E, 0x60, 0x4B, 0x67, 0x03, 0x19, 0xEE, 0x0C, 0x67, 0x97, 0x33, 0xF3, 0x7E,
+    0x7F, 0xEF, 0x71, 0xE9, 0xF6, 0x57, 0x36, 0xA2, 0xD7, 0xBF, 0xF7, 0xFD, 0x1F, 0xC7, 0x65, 0x5C,
+    0xA6, 0xCD, 0x4F, 0xFE, 0x10, 0xAA, 0x97, 0x5F, 0x44, 0x81, 0xA2, 0x6A, 0xEF, 0xF0, 0xC3, 0xC3,
+    0xDB, 0xD5, 0x9F, 0xD4, 0x6D, 0x7A, 0xF9, 0x45, 0x14, 0xCA, 0x84, 0x36, 0xEF, 0x6E, 0xDE, 0x4B,
+    0x56, 0xC2, 0x9F, 0xD1, 0xCA, 0xCB, 0xAF, 0xF3, 0xD7, 0xA8, 0xB0, 0xB2, 0xB0, 0xB4, 0x37, 0xA6,
+    0xE5, 0xF9, 0xDA, 0x78, 0x3C, 0xA6, 0xDC, 0x5A, 0x4B, 0x1B, 0xE3, 0xF1, 0x5D, 0x37, 0x43, 0x6B,
+    0x86, 0x3B, 0x2D, 0xDA, 0x7E, 0x64, 0xFE, 0x1F, 0x9F, 0xF3, 0xD7, 0xAE, 0xED, 0x82, 0x5A, 0xCB,
+    0x77, 0x26, 0xA3, 0xAD, 0xAD, 0x41, 0xB9, 0xA2, 0x1F, 0x46, 0x8D, 0x90, 0x23, 0xBA, 0x45, 0x5A,
+    0x6A, 0x53, 0x98, 0x4C, 0x42, 0x4D, 0x32, 0x69, 0x44, 0x97, 0x74, 0x61, 0x4B, 0x4D, 0x58, 0xA7,
+    0xE6, 0x26, 0xD6, 0x43, 0xCD, 0x75, 0x5E, 0xE7, 0xE5, 0x2D, 0xDA, 0xA2, 0x6D, 0x12, 0x2A, 0x34,
+    0xF8, 0x71, 0xF7, 0x2C, 0xC5, 0x6D, 0xA1, 0x92, 0x4E, 0x9B, 0xB8, 0x2B, 0x4C, 0xD0, 0xA5, 0x86,
+    0x5A, 0xA1, 0x82, 0x3A, 0xA5, 0x8B, 0xC7, 0xF7, 0x69, 0x14, 0x55, 0x4E, 0xA4, 0x44, 0x6D, 0x52,
+    0x5E, 0x41, 0x15, 0xFF, 0xB2, 0x52, 0x3F, 0xEC, 0xE9, 0x28, 0x6A, 0xE8, 0x46, 0x58, 0xD2, 0x56,
+    0x50, 0x53, 0xAA, 0x8E, 0x28, 0x54, 0x97, 0x16, 0xF2, 0x27, 0x35, 0x7A, 0x49, 0x24, 0x40, 0x40,
+    0xC0, 0x66, 0x82, 0x68, 0x55, 0x04, 0x12, 0xBC, 0xAB, 0xC2, 0x5A, 0xF9, 0xF6, 0xE5, 0x35, 0x02,
+    0xB3, 0x44, 0x3D, 0xF8, 0xB4, 0xE8, 0x53, 0xF4, 0x0E, 0xBD, 0x85, 0xB1, 0xA0, 0xC7, 0x10, 0xDB,
+    0x43, 0x90, 0x8D, 0x70, 0x44, 0x84, 0x23, 0x22, 0x1C, 0x11, 0x43, 0xA6, 0x98, 0x8F, 0x46, 0x7F,
+    0x95, 0x4E, 0xB4, 0x4C, 0xF1, 0x40, 0xC3, 0x70, 0x19, 0xDD, 0x4E, 0x70, 0x2C, 0x5B, 0x2A, 0x78,
+    0xF2, 0xF7, 0x7B, 0xF8, 0x8E, 0xC3, 0x1D, 0x05, 0x8A, 0xDC, 0xAC, 0xE6, 0x75, 0x25, 0x0F, 0xAC,
+    0x01, 0xA7, 0x06, 0xA6, 0x43, 0x82, 0x65, 0x15, 0xFC, 0x80, 0xB9, 0xDE, 0xBC, 0xFE, 0x96, 0x61,
+    0x2B, 0x63, 0xF8, 0xDC, 0x2A, 0x3A, 0xE7, 0x04, 0x1C, 0xF1, 0xC0, 0xBC, 0x33, 0xF3, 0xBE, 0xC5,
+    0x2D, 0x65, 0x16, 0x0B, 0x95, 0xB6, 0xC6, 0x7D, 0x30, 0x81, 0xAC, 0x94, 0xB6, 0xFC, 0xF4, 0x80,
+    0x08, 0xE2, 0xD9, 0x92, 0xEC, 0x14, 0x1C, 0x19, 0xDB, 0x13, 0x0C, 0x86, 0xBD, 0x5E, 0xAD, 0x6B,
+    0x32, 0x37, 0x45, 0xC9, 0x26, 0x5B, 0x93, 0x2B, 0x98, 0xE7, 0x55, 0x51, 0xA2, 0x9B, 0xBC, 0xCC,
+    0x64, 0xAA, 0xCE, 0x52, 0x61, 0xB0, 0xC5, 0x14, 0x10, 0x7E, 0xEF, 0xCE, 0x87, 0x77, 0x4E, 0xE3,
+    0xEF, 0x7C, 0x6D, 0xDC, 0xDD, 0xB8, 0x77, 0x1A, 0x4F, 0x77, 0x17, 0x15, 0xD3, 0xC5, 0x75, 0xBA,
+    0x18, 0x2C, 0xA6, 0xBF, 0x26, 0x7F, 0x9D, 0x7E, 0x07, 0xBD, 0xE2, 0xAF, 0xD3, 0xEE, 0x18, 0x9A,
+    0x2E, 0x9D, 0x45, 0x29, 0xFA, 0xB2, 0x81, 0xDB, 0xB2, 0x69, 0x4C, 0x47, 0x2E, 0xD8, 0x32, 0xD9,
+    0x85, 0x4E, 0x8B, 0x39, 0x75, 0x31, 0x9B, 0x8F, 0x0A, 0xEA, 0x84, 0xDB, 0x34, 0x09, 0xBA, 0x4D,
+    0x37, 0x99, 0x86, 0xCD, 0x0D, 0x3F, 0x89, 0xEA, 0x7A, 0x4D, 0xD2, 0x86, 0x9C, 0xC6, 0x9F, 0x3C,
+    0xB2, 0x75, 0x68, 0xEB, 0x89, 0xF8, 0xE8, 0xBD, 0xAA, 0x4D, 0xFE, 0xD9, 0xE6, 0x5A, 0xA4, 0xA6,
+    0x4B, 0x55, 0x97, 0x3C, 0xDE, 0xCE, 0x65, 0x97, 0xB3, 0xB7, 0x1C, 0x62, 0xC4, 0x69, 0x70, 0x95,
+    0x5B, 0xD4, 0xE1, 0x34, 0xF8, 0xE2, 0x24, 0x68, 0xA7, 0xF0, 0xD0, 0x44, 0xE1, 0xCC, 0x2E, 0x82,
+    0xD7, 0xF3, 0x99, 0x3C, 0xD9, 0xA2, 0xA3, 0xA4, 0x9C, 0x26, 0x86, 0x0E, 0x29, 0xBF, 0x2E, 0x8B,
+    0x4C, 0x72, 0x48, 0x4C, 0x29, 0xED, 0x1C, 0x61, 0xE9, 0x3E, 0xCB, 0x6D, 0x90, 0x68, 0x59, 0xA8,
+    0x65, 0xB9, 0x96, 0x45, 0x5B, 0x96, 0x6E, 0x59, 0xC0, 0x65, 0x19, 0x97, 0xC5, 0x5C, 0x96, 0x94,
+    0xF6, 0x16, 0xC2, 0x86, 0xB6, 0x9A, 0xCB, 0x2B, 0x1E, 0x35, 0x73, 0x91, 0xB3, 0x37, 0xDA, 0xB9,
+    0xD4, 0xCB, 0x82, 0xB3, 0xC8, 0x83, 0xEC, 0x2C, 0xF5, 0x20, 0x7E, 0x87, 0xF8, 0x1C, 0x34, 0xB0,
+    0xAC, 0x84, 0x2E, 0xAE, 0xE6, 0x7A, 0xE8, 0xC4, 0x42, 0x15, 0x93, 0x8C, 0xE6, 0xDA, 0xC8, 0xDA,
+    0x85, 0x42, 0x02, 0x89, 0xB0, 0x11, 0x8D, 0xA8, 0x45, 0x99, 0xAA, 0x0C, 0x51, 0xB5, 0xE5, 0x02,
+    0x29, 0x2F, 0x45, 0x93, 0x1B, 0x51, 0x17, 0x52, 0x94, 0x1A, 0xB8, 0x32, 0x45, 0x48, 0x77, 0x78,
+    0x0A, 0x25, 0x07, 0xD5, 0x2C, 0xD8, 0xF2, 0xD2, 0x12, 0x56, 0x1D, 0xF7, 0x84, 0x75, 0x3B, 0x1D,
+    0xE2, 0x55, 0x47, 0x2D, 0xAF, 0x05, 0x3B, 0x58, 0x1D, 0x97, 0xBC, 0x1E, 0xD6, 0xC0, 0x0E, 0x31,
+    0x68, 0x1E, 0x01, 0x65, 0x32, 0x93, 0x1A, 0x61, 0x92, 0x32, 0x2A, 0x19, 0x57, 0x8A, 0x07, 0x3D,
+    0xF1, 0x19, 0x99, 0x41, 0xA0, 0x1A, 0x0D, 0xED, 0x17, 0x80, 0xAC, 0x1C, 0x82, 0x66, 0xE8, 0x5E,
+    0xC9, 0x58, 0xE3, 0x08, 0x89, 0x06, 0xAB, 0xE2, 0x06, 0xCB, 0x80, 0xB3, 0xA6, 0x08, 0x5B, 0x2C,
+    0x0C, 0x5A, 0x5E, 0xD9, 0xF2, 0xD2, 0xC3, 0xB9, 0x65, 0x0B, 0x04, 0xBA, 0x0A, 0xAD, 0x89, 0x3E,
+    0xA9, 0x92, 0x07, 0xB5, 0x50, 0x6D, 0x46, 0xF7, 0x47, 0x60, 0x67, 0x45, 0x32, 0x34, 0xC1, 0x89,
+    0x1A, 0x4A, 0x2B, 0xCA, 0x01, 0x28, 0x0A, 0x84, 0x19, 0x1E, 0xC1, 0x2D, 0x03, 0x6C, 0x4D, 0xE1,
+    0x81, 0x83, 0xBD, 0xD6, 0x61, 0x95, 0xC6, 0x51, 0x92, 0x3F, 0x3D, 0x41, 0x34, 0x20, 0x69, 0x2A,
+    0x01, 0xD8, 0x68, 0xB8, 0xD3, 0x25, 0x1C, 0x90, 0xC0, 0x43, 0x18, 0x34, 0xC0, 0x88, 0x99, 0x00,
+    0x33, 0x57, 0x00, 0xF3, 0x74, 0x44, 0x49, 0xC5, 0xAE, 0xC3, 0x78, 0x98, 0x94, 0x13, 0xA2, 0x95,
+    0x9D, 0x2F, 0xDB, 0x35, 0xAC, 0xD6, 0x0E, 0x50, 0x72, 0xC5, 0x5A, 0xD0, 0x00, 0x9B, 0x74, 0xE7,
+    0x69, 0x03, 0xD7, 0x49, 0xAA, 0x23, 0x87, 0x9E, 0x9C, 0x2E, 0x26, 0x4C, 0x25, 0x6C, 0xCF, 0xB2,
+    0x79, 0xAB, 0xDC, 0x1C, 0xE1, 0x67, 0x3E, 0x7F, 0x1D, 0x9A, 0x4B, 0x24, 0x1F, 0xCA, 0xA0, 0xFA,
+    0x80, 0x41, 0xF5, 0x5D, 0x1E, 0xAE, 0xF6, 0x00, 0x6E, 0x60, 0x69, 0xD0, 0x63, 0x08, 0xA7, 0x40,
+    0xC0, 0xB0, 0x8B, 0x6B, 0x30, 0x0B, 0xE4, 0x8F, 0x1A, 0xB0, 0x11, 0xD5, 0x10, 0x2E, 0xAA, 0x9C,
+    0x84, 0xB0, 0x42, 0x6C, 0x04, 0xA7, 0x90, 0x14, 0xD8, 0x4B, 0x67, 0x66, 0xCA, 0x3A, 0x4B, 0xAB,
+    0x6C, 0x18, 0x1C, 0xA7, 0x8F, 0xAD, 0x24, 0xCD, 0xA7, 0x17, 0xB2, 0x5F, 0x0A, 0x94, 0xC4, 0x3E,
+    0xA1, 0xE2, 0x99, 0x55, 0x40, 0xD3, 0xAA, 0xA7, 0xB4, 0xBE, 0xA9, 0xDF, 0xAF, 0xCF, 0x68, 0x51,
+    0x93, 0x4E, 0x6B, 0x9A, 0xE4, 0x25, 0xDD, 0x2F, 0x14, 0xF5, 0x8C, 0xAE, 0x95, 0x03, 0x59, 0x17,
+    0x3E, 0x8C, 0xED, 0xBB, 0x7E, 0x7F, 0x80, 0x7B, 0x02, 0xC5, 0x08, 0xA8, 0x54, 0xB4, 0x3E, 0x2D,
+    0xB9, 0xE8, 0xB2, 0xB6, 0xE3, 0x3C, 0xEA, 0xBF, 0xB9, 0xF8, 0xFB, 0x5B, 0xEA, 0xF2, 0x63, 0xF2,
+    0x98, 0x02, 0x0D, 0xD1, 0x5C, 0x3A, 0xBF, 0x68, 0xFB, 0x45, 0xE4, 0xBE, 0xD5, 0x03, 0xC8, 0xF1,
+    0x13, 0x52, 0x18, 0x18, 0x7E, 0x3A, 0xB6, 0x35, 0xC5, 0x9C, 0xAA, 0x3A, 0x67, 0x13, 0x98, 0x77,
+    0xD5, 0xCB, 0xE4, 0xD3, 0x49, 0xEC, 0x93, 0x1E, 0xAD, 0xCF, 0xCE, 0xDF, 0xF7, 0x8C, 0xB1, 0x0F,
+    0x47, 0xC3, 0x63, 0x74, 0xA4, 0x5A, 0xDA, 0xC6, 0x6F, 0xFB, 0x78, 0x56, 0xEF, 0xE3, 0xF1, 0x16,
+    0x1E, 0xAF, 0xE3, 0xB1, 0xC0, 0xEE, 0x58, 0xAD, 0xE3, 0xDB, 0x16, 0x05, 0xD5, 0x52, 0xAA, 0x73,
+    0x0C, 0x5D, 0xC9, 0x3C, 0x00, 0xF8, 0xF0, 0x2F, 0x7E, 0xB5, 0xEE, 0x02, 0xA3, 0xB7, 0x2C, 0xF2,
+    0x5F, 0xAD, 0xBB, 0x59, 0xED, 0x20, 0xB4, 0xFD, 0xAD, 0x13, 0x52, 0xD6, 0x53, 0xA7, 0x8F, 0xFA,
+    0x0A, 0xF3, 0xB8, 0x53, 0x83, 0xD9, 0x33, 0x71, 0x75, 0xEE, 0x07, 0x39, 0x09, 0x40, 0xCB, 0xFE,
+    0x88, 0xB2, 0x8F, 0x94, 0xEC, 0xB7, 0xCE, 0x24, 0xCF, 0x52, 0x93, 0xED, 0x4F, 0x50, 0x58, 0x98,
+    0xD8, 0xF6, 0x85, 0xFD, 0xEF, 0x8E, 0xB5, 0x7F, 0xC9, 0x3F, 0x6E, 0xC2, 0x5E, 0x97, 0x57, 0x2E,
+    0xEB, 0x37, 0xCA, 0x2F, 0x3A, 0xDA, 0x66, 0x7C, 0xEB, 0xE8, 0xE6, 0x0A, 0x6C, 0xFC, 0x3A, 0xDD,
+    0xF4, 0xD9, 0x7A, 0xD0, 0xAB, 0xCA, 0x39, 0xC3, 0x4B, 0x6D, 0xC9, 0xB1, 0x31, 0xCB, 0xAA, 0xF3,
+    0xFC, 0xEC, 0x30, 0x8A, 0x8D, 0xE4, 0xC0, 0xCD, 0xA1, 0x9A, 0x0B, 0x51, 0x97, 0x54, 0xEF, 0x0F,
+    0x99, 0x99, 0xC3, 0x93, 0x12, 0x7E, 0xC8, 0x46, 0xF1, 0x8E, 0xCF, 0x62, 0x38, 0x42, 0xF1, 0x57,
+    0x9C, 0xE8, 0xE1, 0x13, 0x16, 0x11, 0xFD, 0x2E, 0xDC, 0x04, 0x8F, 0xD0, 0x73, 0x90, 0xC8, 0x39,
+    0xD0, 0xB1, 0x41, 0x73, 0x57, 0x1C, 0x9C, 0xE8, 0xD2, 0xD5, 0x1C, 0x21, 0x12, 0x71, 0x64, 0xEF,
+    0x50, 0x34, 0xF5, 0x45, 0x41, 0x8C, 0x9E, 0xCC, 0xFC, 0x44, 0x80, 0x45, 0x3E, 0x66, 0x7E, 0x14,
+    0x77, 0x94, 0x01, 0x1B, 0x63, 0xB5, 0xA0, 0x75, 0xD6, 0xCE, 0x08, 0x20, 0x9C, 0xE7, 0x44, 0x96,
+    0x08, 0x38, 0x22, 0xF0, 0xE6, 0x88, 0xE9, 0x4C, 0x29, 0xFC, 0xE0, 0x39, 0x02, 0x62, 0x99, 0xC0,
+    0x12, 0xAF, 0xA0, 0x53, 0xA0, 0xEF, 0x8D, 0x17, 0xBE, 0x17, 0x68, 0xEC, 0x87, 0xBB, 0x8A, 0xDE,
+    0x9A, 0xF4, 0x99, 0x95, 0x59, 0xC5, 0x25, 0x82, 0x66, 0x4C, 0xAB, 0xB5, 0x42, 0x64, 0xE3, 0x5E,
+    0xC8, 0xBC, 0x4C, 0x54, 0x86, 0xAA, 0xCD, 0xF1, 0x54, 0xF9, 0xC3, 0x0A, 0xCF, 0x53, 0x00, 0x9E,
+    0x42, 0xF0, 0x93, 0x40, 0x58, 0xAE, 0x4A, 0x74, 0x85, 0x9F, 0x4A, 0x17, 0x33, 0x51, 0xEB, 0x4D,
+    0x12, 0xD5, 0xDE, 0x45, 0x9D, 0x65, 0x76, 0xE9, 0x44, 0xD2, 0x0A, 0xA4, 0xEF, 0x4E, 0x2F, 0x95,
+    0x3F, 0x82, 0x75, 0x92, 0x36, 0xFE, 0xEE, 0x44, 0x29, 0xE9, 0xB9, 0xC6, 0x5C, 0x67, 0x35, 0xF3,
+    0x9C, 0xD7, 0xCC, 0xB1, 0xE7, 0x33, 0x77, 0x5C, 0x03, 0x55, 0x14, 0xF3, 0xCC, 0x9C, 0x6A, 0x87,
+    0xCF, 0x13, 0xD6, 0x98, 0x9C, 0x3A, 0x1E, 0x3B, 0xC7, 0x61, 0xEB, 0xF8, 0x6B, 0xF8, 0xC3, 0x6E,
+    0x51, 0xBB, 0x40, 0xD8, 0x5D, 0x30, 0x16, 0xB8, 0x2C, 0x02, 0x9E, 0x40, 0x1E, 0x1C, 0x41, 0x8F,
+    0xE0, 0x07, 0x23, 0xBE, 0x8A, 0xEA, 0x24, 0x2B, 0xD6, 0xBC, 0x83, 0x50, 0x06, 0x74, 0xE1, 0x58,
+    0xFB, 0x26, 0xF2, 0x4E, 0x60, 0x91, 0x79, 0xBA, 0xA0, 0x17, 0x15, 0x2A, 0xE4, 0x69, 0x58, 0x62,
+    0x74, 0xA6, 0x61, 0x6D, 0xA4, 0x35, 0x60, 0x9A, 0x8A, 0x12, 0x1A, 0x81, 0xCE, 0x80, 0xCE, 0x59,
+    0xC3, 0x30, 0x5D, 0x30, 0x8A, 0xB1, 0xBF, 0x27, 0x8A, 0xBD, 0x2E, 0x20, 0x3A, 0x47, 0x73, 0x24,
+    0x63, 0xBE, 0x0A, 0xC3, 0x7E, 0x84, 0x2A, 0x7A, 0x3A, 0x8C, 0x85, 0x8C, 0xBA, 0x13, 0x89, 0x7F,
+    0xAC, 0x1B, 0xD4, 0xEC, 0xAE, 0x03, 0x7F, 0xEA, 0x14, 0x3D, 0xB8, 0xB6, 0x33, 0xAB, 0x74, 0xD9,
+    0xB3, 0x93, 0xA1, 0x60, 0x96, 0xDE, 0xF9, 0xB3, 0x59, 0x70, 0x6C, 0xCF, 0x5C, 0xFD, 0x70, 0x01,
+    0x72, 0xC1, 0x60, 0xAC, 0x41, 0x46, 0xC6, 0xAC, 0xEB, 0x9F, 0xC1, 0xD5, 0xA2, 0x63, 0x04, 0xDF,
+    0x8B, 0x06, 0xB7, 0x04, 0xD9, 0xE8, 0xF8, 0xE9, 0x01, 0x06, 0x26, 0xFF, 0x2D, 0x06, 0x90, 0xBF,
+    0x7E, 0xFC, 0x04, 0x74, 0x19, 0xBC, 0x5D, 0xFB, 0x8E, 0xB5, 0x3D, 0xA0, 0xF5, 0x49, 0x6E, 0x23,
+    0x14, 0xC1, 0x91, 0xB1, 0xB3, 0xCE, 0xF3, 0x02, 0x3D, 0xB7, 0x57, 0x4B, 0x81, 0x35, 0xC1, 0xDE,
+    0xF8, 0x2E, 0x54, 0x70, 0xF0, 0x0E, 0x20, 0x18, 0x2B, 0x3A, 0xF4, 0x7E, 0xB1, 0xDA, 0xCD, 0xA7,
+    0x31, 0x18, 0xE4, 0xD7, 0x1B, 0x2C, 0xF5, 0xA7, 0xC3, 0x02, 0x09, 0x7A, 0xFA, 0x7B, 0x43, 0xE9,
+    0x7F, 0x7E, 0x6A, 0x00, 0x70, 0x66, 0x03, 0xE5, 0x74, 0xFE, 0x79, 0x45, 0xA3, 0x4B, 0x3D, 0x9D,
+    0xDB, 0x46, 0x4A, 0xDD, 0x16, 0x9C, 0x04, 0xC9, 0x65, 0x98, 0xC3, 0xA8, 0xE7, 0x2B, 0x68, 0x4F,
+    0x7A, 0x82, 0xA8, 0xE0, 0x82, 0x55, 0xA1, 0xB6, 0x01, 0xCB, 0x9B, 0xAC, 0x6E, 0x35, 0xCF, 0x35,
+    0xAD, 0x7F, 0xA3, 0x52, 0x5C, 0xCF, 0x27, 0x8D, 0x7B, 0x77, 0x99, 0xA2, 0xF8, 0xE2, 0x02, 0x6C,
+    0x75, 0x06, 0xED, 0xDF, 0xA6, 0xF9, 0xBD, 0x23, 0x67, 0xCC, 0x54, 0x31, 0x83, 0xC8, 0x1B, 0x9C,
+    0x3A, 0xEC, 0xA7, 0x1C, 0x82, 0x17, 0x91, 0xE3, 0xD0, 0xCE, 0x2F, 0x36, 0x70, 0x3E, 0xD9, 0xE2,
+    0xE1, 0x16, 0x7B, 0x40, 0xF1, 0xC7, 0x74, 0x86, 0xED, 0x0E, 0xD9, 0x1D, 0xAE, 0x3B, 0x54, 0x97,
+    0x0D, 0xA7, 0xCA, 0x66, 0xCB, 0xBF, 0x32, 0x79, 0x6F, 0xE4, 0x20, 0x8E, 0xB9, 0x9E, 0x10, 0x0F,
+    0xD9, 0x99, 0xBE, 0xF8, 0x1D, 0xC3, 0x12, 0xCA, 0xCD, 0x0D, 0x0D, 0xB0, 0xCA, 0x39, 0xA7, 0x6D,
+    0xFE, 0x42, 0xE3, 0xE4, 0x75, 0x14, 0x1F, 0x34, 0xE2, 0x57, 0xA9, 0x51, 0x30, 0x13, 0x2D, 0x53,
+    0x4D, 0x5E, 0xD6, 0xC5, 0xA3, 0x2A, 0x7F, 0x58, 0xAE, 0x5C, 0x35, 0xEC, 0xE5, 0x70, 0x42, 0xE1,
+    0x5C, 0x70, 0xDB, 0x25, 0xB1, 0x1B, 0xCE, 0xF5, 0x6A, 0x76, 0x3C, 0xB8, 0x6B, 0x64, 0x76, 0xE3,
+    0x87, 0x9D, 0x78, 0xAF, 0x13, 0x71, 0x97, 0x46, 0x83, 0x96, 0x11, 0x59, 0x75, 0xDE, 0x07, 0xF5,
+    0x56, 0xF6, 0x6E, 0xB5, 0x1F, 0x5B, 0x73, 0x88, 0x98, 0x3E, 0xE7, 0x55, 0xB0, 0xEB, 0x94, 0xCC,
+    0xA0, 0xA9, 0x3F, 0xFD, 0xA0, 0xA7, 0xF8, 0x31, 0xD3, 0xDC, 0x74, 0x70, 0xFF, 0x1B, 0x72, 0x2E,
+    0x0D, 0x7A, 0xA1, 0xF8, 0x2E, 0x89, 0x37, 0x53, 0x29, 0xFE, 0x91, 0x3B, 0xC4, 0x7B, 0x5B, 0xFF,
+    0xFB, 0x00, 0x36, 0xA9, 0x26, 0xFA, 0xB3, 0x2A, 0x00, 0xFF, 0xF1, 0xC7, 0xB7, 0x28, 0x7D, 0x3F,
+    0x93, 0xB1, 0x78, 0xD5, 0x07, 0x89, 0xB3, 0x4A, 0x5C, 0xCD, 0x60, 0x75, 0xD6, 0xC3, 0xDB, 0xC3,
+    0x6B, 0xE1, 0x80, 0xCB, 0x7C, 0x5F, 0x9B, 0x63, 0x59, 0xD2, 0x2C, 0xD6, 0xC6, 0x4E, 0x79, 0x51,
+    0x87, 0xAA, 0xF2, 0xE7, 0x6D, 0xD2, 0xE6, 0xC6, 0x72, 0x55, 0x5A, 0xEC, 0x4C, 0x45, 0xE5, 0x0A,
+    0xCB, 0x14, 0x55, 0x23, 0x2A, 0x4B, 0x54, 0x49, 0x28, 0x2D, 0xAB, 0xCC, 0xD7, 0x96, 0x23, 0x5F,
+    0x5C, 0x6E, 0x2D, 0xB0, 0xEE, 0xCF, 0x7C, 0x08, 0x27, 0xD9, 0xA8, 0x1F, 0x66, 0x73, 0xD7, 0x03,
+    0x72, 0x88, 0x0A, 0x90, 0x9E, 0xD6, 0x18, 0x18, 0xB1, 0x01, 0x51, 0x17, 0x3C, 0x27, 0xBB, 0xC3,
+    0x2B, 0xA9, 0xDF, 0xCB, 0x43, 0x38, 0x40, 0x06, 0x74, 0x13, 0x1F, 0x60, 0xF1, 0x6C, 0x9B, 0xE5,
+    0xD9, 0xA6, 0x7F, 0xAF, 0xA6, 0x61, 0xDD, 0x12, 0x49, 0xB7, 0xED, 0x97, 0xCE, 0xDF, 0x02, 0x09,
+    0x23, 0x8B, 0xD9, 0x36, 0xA6, 0xEB, 0x38, 0x98, 0xD7, 0xA8, 0x28, 0xA8, 0x8C, 0x56, 0x17, 0xBE,
+    0xD6, 0x5F, 0xB5, 0x1C, 0xDE, 0x39, 0x5F, 0x4C, 0xE9, 0xB9, 0xE6, 0xF8, 0xB5, 0x5F, 0xCB, 0xEF,
+    0x52, 0x7B, 0x91, 0xD4, 0x17, 0x42, 0xF5, 0xA3, 0x02, 0x98, 0xA1, 0x81, 0x02, 0x7C, 0x5F, 0x8D,
+    0xCC, 0xAA, 0xFF, 0x13, 0xC0, 0x70, 0x74, 0x5A, 0xEE, 0x8B, 0x3F, 0x06, 0x0C, 0x8D, 0x22, 0x73,
+    0x93, 0xD7, 0x72, 0xE7, 0x39, 0xC2, 0x55, 0x6A, 0xC3, 0xFF, 0x82, 0x5C, 0x98, 0xF3, 0xC5, 0xB9,
+    0x52, 0x9B, 0x4D, 0x39, 0xA0, 0xB5, 0xFF, 0x9E, 0xAB, 0xB9, 0x3A, 0x14, 0x0B, 0x7B, 0x9E, 0x05,
+    0x57, 0x5A, 0x8D, 0xDC, 0x1E, 0x8D, 0x5F, 0xB5, 0xBC, 0x70, 0x62, 0x05, 0x2D, 0xBD, 0xEE, 0x7E,
+    0x83, 0x57, 0xE5, 0x57, 0xFC, 0x75, 0xDA, 0x1D, 0x79, 0x97, 0xB5, 0xA2, 0x8E, 0xCB, 0xC8, 0x9C,
+    0x66, 0xBD, 0xFB, 0x4B, 0x4C, 0x46, 0x06, 0x65, 0x76, 0x9D, 0xB5, 0x79, 0x77, 0xBA, 0x1D, 0xA1,
+    0x4A, 0xAA, 0x2B, 0xAF, 0x5D, 0x79, 0x2D, 0xA9, 0x4E, 0x47, 0x05, 0x72, 0xA8, 0x6F, 0x26, 0xF9,
+    0xFF, 0x00, 0x65, 0x54, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x06, 0x65, 0x25, 0x46, 0xCA,
+    0xB8, 0xA1, 0x89, 0x25, 0x0F, 0x25, 0x18, 0x29, 0x9B, 0x82, 0x22, 0x48, 0xF6, 0xED, 0x24, 0x14,
+    0x14, 0x14, 0x49, 0x01, 0x95, 0x0B, 0x37, 0x14, 0x11, 0x12, 0x1C, 0x65, 0x24, 0x7C, 0x77, 0x1B,
+    0x90, 0xA0, 0xA0, 0xC0, 0xFF, 0x20, 0x2E, 0x52, 0x58, 0x17, 0x09, 0x17, 0x58, 0x22, 0xA0, 0xBB,
+    0xEC, 0x04, 0x0A, 0xDA, 0x41, 0x44, 0x4A, 0x41, 0x91, 0x09, 0x58, 0x24, 0xE0, 0xC2, 0x83, 0x34,
+    0x36, 0x9B, 0x68, 0xED, 0xE1, 0xCD, 0x9E, 0xA3, 0x18, 0x79, 0xF5, 0x4E, 0xDA, 0x7B, 0x3B, 0xEF,
+    0xBD, 0xF9, 0xBE, 0xF7, 0xBD, 0x07, 0x00, 0x7D, 0xCB, 0xF6, 0x43, 0x6E, 0x5B, 0x69, 0x5A, 0x55,
+    0xB5, 0x85, 0x6E, 0x4B, 0xB4, 0x65, 0xD6, 0xF4, 0xB8, 0xEF, 0x71, 0x57, 0x0A, 0xA3, 0xFA, 0x3A,
+    0x6F, 0xC0, 0x6C, 0xEE, 0x58, 0x05, 0x94, 0x46, 0x19, 0x69, 0x54, 0x55, 0xE8, 0x12, 0x25, 0x7A,
+    0x28, 0x37, 0xE6, 0xC9, 0xDB, 0x82, 0xB7, 0x90, 0x0D, 0xCE, 0x07, 0x7C, 0xEB, 0xD9, 0x4F, 0x5E,
+    0xBC, 0xED, 0x16, 0x56, 0x76, 0xCA, 0x78, 0xF4, 0xCA, 0xEA, 0x7D, 0x48, 0x83, 0xDA, 0x65, 0xE3,
+    0x8D, 0x2C, 0x36, 0x9C, 0x6C, 0xBC, 0x2D, 0x70, 0xE1, 0x2C, 0x20, 0xA3, 0x5E, 0xD8, 0x72, 0xE0,
+    0x9E, 0xEC, 0x3A, 0xF7, 0x93, 0xDC, 0x95, 0x5B, 0x95, 0x78, 0x8A, 0xF4, 0x8C, 0x1C, 0x7F, 0x14,
+    0xA4, 0xF1, 0x05, 0x15, 0xA4, 0x7F, 0x51, 0xDF, 0x95, 0x86, 0x0E, 0xB4, 0x64, 0xC2, 0x4E, 0xA4,
+    0xE9, 0x8D, 0x20, 0x02, 0x54, 0x6C, 0x8A, 0xD8, 0xF4, 0xC6, 0xFE, 0xCD, 0xCC, 0xCD, 0x71, 0x03,
+    0x09, 0x9C, 0x07, 0xD6, 0x00, 0x4A, 0xE9, 0x20, 0x0C, 0x14, 0xF0, 0x7A, 0x97, 0x2F, 0xAB, 0x6D,
+    0xFE, 0x67, 0x43, 0x08, 0xA5, 0x69, 0xE4, 0x23, 0x9F, 0xC7, 0x8A, 0xC7, 0xAA, 0x50, 0x54, 0xD4,
+    0xB7, 0x54, 0x9A, 0xFB, 0xE1, 0xAA, 0x39, 0x2E, 0x5D, 0x5B, 0xBE, 0x1F, 0xD2, 0xC9, 0x6A, 0x42,
+    0x74, 0x90, 0xC9, 0x07, 0x2D, 0x7B, 0x4A, 0x04, 0xA4, 0xA4, 0x17, 0x85, 0xE9, 0xF5, 0xA1, 0x76,
+    0x80, 0xEB, 0x2F, 0xAC, 0x8C, 0xCD, 0x28, 0x36, 0x27, 0x3D, 0xF4, 0x74, 0xCE, 0x36, 0x41, 0x89,
+    0x2D, 0xBD, 0x77, 0xA9, 0xB1, 0x38, 0xDE, 0x9C, 0x39, 0x41, 0x54, 0x16, 0xC8, 0x1A, 0xE4, 0x2E,
+    0xD1, 0x53, 0xE8, 0x04, 0x73, 0x08, 0x4C, 0x4F, 0xD8, 0x00, 0x44, 0x2F, 0x9D, 0x82, 0xAC, 0xC0,
+    0x4C, 0x17, 0x4F, 0x4C, 0x37, 0xCF, 0xBD, 0xAA, 0x4A, 0x91, 0x33, 0xA3, 0x77, 0xB2, 0x59, 0x96,
+    0x69, 0xD7, 0x0D, 0x9F, 0x1C, 0x83, 0x2E, 0xA8, 0xFC, 0xD2, 0xAB, 0x5D, 0x42, 0xDD, 0xA8, 0x7B,
+    0x4D, 0x71, 0x39, 0x94, 0xDC, 0x93, 0x0D, 0xB9, 0x1F, 0xF0, 0x67, 0xD7, 0xB2, 0x3B, 0x1D, 0xE4,
+    0x8A, 0xFF, 0xE1, 0xE5, 0x3D, 0x5F, 0x5C, 0x0A, 0x25, 0x0B, 0x43, 0x16, 0xA6, 0x1D, 0x27, 0x44,
+    0x38, 0x51, 0xBD, 0xA6, 0x74, 0x6F, 0x08, 0x41, 0x90, 0x89, 0xD0, 0x91, 0xC9, 0xF7, 0xAA, 0x5C,
+    0x69, 0xCC, 0x1A, 0x33, 0xBB, 0x34, 0x95, 0x99, 0xA4, 0xA2, 0x6F, 0x1C, 0x55, 0x8B, 0xE3, 0xAA,
+    0x4B, 0xE8, 0xF8, 0x41, 0x93, 0x9B, 0x96, 0x9B, 0x16, 0x59, 0x48, 0xCD, 0x90, 0x9A, 0x8E, 0x31,
+    0x37, 0x27, 0xF5, 0x85, 0xE1, 0xD8, 0xD7, 0xD1, 0x8D, 0xC7, 0xEB, 0xC7, 0x27, 0xF7, 0x5B, 0x12,
+    0x1F, 0xA3, 0x93, 0xAC, 0xC1, 0x8A, 0x45, 0xAC, 0x90, 0x7B, 0xB0, 0x70, 0x91, 0x05, 0xBA, 0xC3,
+    0x68, 0xCB, 0xCE, 0x53, 0x5F, 0x58, 0x48, 0x4E, 0xE5, 0xF1, 0xA9, 0xCB, 0x1E, 0xDB, 0xFC, 0x2B,
+    0x7B, 0x56, 0x9A, 0xE5, 0xD5, 0xFB, 0x31, 0xB6, 0xEF, 0xF7, 0xD7, 0x09, 0x38, 0xAB, 0x2D, 0xA3,
+    0x84, 0xB1, 0x65, 0xB1, 0xE5, 0x7F, 0x4F, 0xB8, 0x7E, 0x2D, 0x4F, 0x02, 0xAB, 0xE4, 0x6D, 0xEA,
+    0x5A, 0xA0, 0xF0, 0x25, 0x16, 0x96, 0x09, 0xF8, 0x96, 0x11, 0x47, 0x1D, 0x29, 0xFD, 0xC0, 0x42,
+    0x2B, 0xCC, 0xB6, 0xAC, 0x3A, 0x28, 0x75, 0x55, 0xBE, 0xE3, 0x3A, 0x4E, 0xC8, 0xDC, 0xB2, 0x30,
+    0x45, 0x27, 0xFA, 0x32, 0xFA, 0x51, 0xF4, 0x3F, 0xDC, 0x76, 0x8E, 0x1B, 0x2D, 0x34, 0x16, 0x80,
+    0x25, 0x80, 0xF2, 0x39, 0xE4, 0x9D, 0xDC, 0xA8, 0x15, 0xD7, 0x66, 0xAD, 0xED, 0x80, 0x24, 0x6D,
+    0xDA, 0x89, 0xF0, 0x81, 0x47, 0xCB, 0xA2, 0x55, 0x57, 0x68, 0x84, 0x9A, 0x35, 0xD6, 0x0C, 0x98,
+    0x2F, 0x57, 0xEC, 0xAC, 0x74, 0x16, 0x2B, 0xF1, 0xAB, 0x53, 0x97, 0x7C, 0x99, 0x85, 0x64, 0x2C,
+    0xA8, 0x9B, 0x3E, 0x7F, 0xEC, 0x93, 0x14, 0x84, 0xF9, 0x44, 0xE9, 0xEF, 0xA7, 0x28, 0x1C, 0xB0,
+    0xFD, 0xC2, 0xEA, 0x18, 0xC8, 0x4E, 0x7A, 0x52, 0xC1, 0x99, 0x13, 0x88, 0x91, 0xF8, 0xF4, 0xB3,
+    0x5B, 0x8C, 0xC7, 0x1B, 0x71, 0xF6, 0x9E, 0xE9, 0xD3, 0x02, 0x9B, 0x1E, 0xAB, 0xE3, 0xD8, 0x26,
+    0x5D, 0xEB, 0xC8, 0x4F, 0xFD, 0x24, 0x38, 0xD0, 0xC0, 0xD5, 0xCE, 0x5B, 0x76, 0x9A, 0xA3, 0x30,
+    0xEA, 0xB8, 0xB0, 0xC9, 0xA4, 0x3D, 0x56, 0xDA, 0xF3, 0x44, 0x94, 0x99, 0xDC, 0x04, 0x7F, 0x8E,
+    0x6A, 0x7D, 0xF8, 0x5E, 0x1A, 0xAE, 0x1B, 0x84, 0x25, 0xE9, 0x6A, 0xCA, 0xDD, 0x84, 0x88, 0x50,
+    0x76, 0xF8, 0xDD, 0x93, 0xE2, 0xF3, 0x80, 0x8F, 0x75, 0xFE, 0x9B, 0x55, 0xDC, 0xF5, 0x84, 0x19,
+    0x14, 0xBA, 0xDE, 0x49, 0xA5, 0xA7, 0x19, 0xCA, 0x15, 0x08, 0x12, 0x33, 0x7D, 0xDD, 0x75, 0xEA,
+    0x72, 0x62, 0x63, 0xD0, 0x09, 0x2F, 0xCD, 0xA3, 0xB0, 0x65, 0x5F, 0xD3, 0xD7, 0x97, 0xD7, 0xCF,
+    0xE5, 0xFE, 0xAD, 0xAC, 0x71, 0x49, 0x15, 0x23, 0x9A, 0x25, 0x64, 0x7B, 0x9A, 0x5F, 0x31, 0x0B,
+    0xC2, 0xDD, 0xC9, 0x03, 0xDB, 0xC4, 0x42, 0xAD, 0x5F, 0x4D, 0xF7, 0xB4, 0xD9, 0x96, 0x55, 0x37,
+    0xCD, 0x40, 0xD2, 0x02, 0x43, 0xBB, 0x86, 0xC2, 0xE2, 0xCC, 0x2D, 0x80, 0x5A, 0x98, 0xA4, 0x93,
+    0xC6, 0x01, 0xFC, 0x9F, 0x6D, 0xF0, 0xDD, 0x43, 0xE4, 0x61, 0x0A, 0xE1, 0x26, 0x04, 0xA6, 0xED,
+    0x7E, 0xEA, 0x46, 0x03, 0x12, 0x3E, 0xCA, 0xEC, 0x99, 0xEE, 0xE1, 0xEE, 0xE9, 0x38, 0x3F, 0xD6,
+    0xDC, 0x51, 0x9C, 0xA5, 0xFE, 0xFC, 0xAC, 0x21, 0xF7, 0x3A, 0x65, 0x41, 0x7D, 0x4D, 0x6C, 0xBC,
+    0xEB, 0x50, 0x92, 0xBE, 0x7A, 0xC4, 0xDA, 0xB9, 0x75, 0xE5, 0x84, 0x95, 0xB4, 0x1C, 0x65, 0xA5,
+    0x74, 0x81, 0xB4, 0x1E, 0x87, 0xC4, 0xD4, 0x70, 0xBD, 0xA8, 0x16, 0xBF, 0x70, 0x1F, 0xA1, 0x78,
+    0x78, 0x50, 0x43, 0xFE, 0x7E, 0x58, 0x68, 0xF5, 0x63, 0x53, 0xA0, 0x20, 0xCC, 0x14, 0xEC, 0x69,
+    0x85, 0x72, 0x37, 0xC4, 0x30, 0xB7, 0x53, 0x4C, 0x85, 0xAD, 0xD7, 0x27, 0xA4, 0x3E, 0x4D, 0x11,
+    0xC5, 0xC3, 0xD3, 0x43, 0xEB, 0xA6, 0xFC, 0x60, 0xC2, 0x9A, 0x33, 0xB7, 0x36, 0xC1, 0xFE, 0xAD,
+    0xA9, 0x0B, 0x4A, 0xB3, 0x46, 0x55, 0xDC, 0x2B, 0xCD, 0x69, 0x59, 0xD2, 0x0A, 0x25, 0x2E, 0x08,
+    0xDB, 0x2F, 0x61, 0x76, 0x47, 0x9A, 0x46, 0xEA, 0x58, 0x92, 0x38, 0xCA, 0x24, 0x8B, 0x6F, 0x74,
+    0xFE, 0xC0, 0xC9, 0xCF, 0x2C, 0xF5, 0x53, 0x1C, 0x26, 0x29, 0xBE, 0xA4, 0xCC, 0x12, 0xED, 0x34,
+    0xA9, 0xD3, 0x94, 0x5D, 0xCD, 0xEC, 0xFC, 0x5F, 0xC5, 0x93, 0xFF, 0xAD, 0xF7, 0x0F, 0x94, 0xFD,
+    0x0F, 0x7D, 0x58, 0x4D, 0x8C, 0xDE, 0x56, 0x15, 0xBD, 0xB6, 0x49, 0x9C, 0x8C, 0x95, 0x98, 0x45,
+    0xAA, 0x0A, 0x26, 0xAD, 0x59, 0x80, 0x14, 0xDA, 0x04, 0x23, 0x60, 0x11, 0xA4, 0xE9, 0x3C, 0x17,
+    0x16, 0x2C, 0x2A, 0xC8, 0x6C, 0x06, 0x16, 0x08, 0x85, 0x05, 0x2B, 0x84, 0x9A, 0x8A, 0x6E, 0x90,
+    0x68, 0xC6, 0x86, 0xCD, 0x48, 0x20, 0xA1, 0x6E, 0xBA, 0x0E, 0x52, 0xBB, 0x48, 0x67, 0x04, 0x13,
+    0x89, 0x48, 0x44, 0x22, 0x60, 0x27, 0x11, 0x62, 0x11, 0x89, 0x7C, 0x10, 0x45, 0x2C, 0xE3, 0x8A,
+    0xA8, 0x09, 0x01, 0x31, 0x6E, 0xE4, 0xA8, 0x9E, 0x19, 0xDB, 0x8F, 0x73, 0xEE, 0xF3, 0x37, 0xD3,
+    0x6E, 0xB0, 0x34, 0xF7, 0xF9, 0xB3, 0xFD, 0xDE, 0xBB, 0x3F, 0xE7, 0x9E, 0x7B, 0xDF, 0x88, 0xE8,
+    0x15, 0xD9, 0x1A, 0xB2, 0xDC, 0xEA, 0x44, 0x82, 0x3E, 0x80, 0x8C, 0x9B, 0x00, 0x4F, 0x12, 0x3E,
+    0x15, 0x53, 0x39, 0xB9, 0xBA, 0xBA, 0x2A, 0x79, 0x61, 0xAD, 0x85, 0x4C, 0xEA, 0x94, 0x72, 0x96,
+    0x88, 0x29, 0xD2, 0xD9, 0x51, 0xBC, 0xE5, 0x57, 0xF1, 0x4E, 0x7E, 0x2F, 0x13, 0x1F, 0x9F, 0xCC,
+    0x44, 0xBC, 0xF2, 0xAD, 0x0C, 0xF3, 0xAC, 0x6E, 0x30, 0x97, 0x6F, 0xE0, 0xF9, 0x28, 0xD7, 0x44,
+    0x9E, 0xB5, 0x1B, 0x2D, 0x16, 0xB5, 0xB6, 0x91, 0xE9, 0xF2, 0x6E, 0x15, 0xD8, 0xFD, 0x36, 0xEE,
+    0x16, 0x2F, 0x89, 0x84, 0x5C, 0x23, 0x1F, 0xF3, 0xD6, 0xB7, 0x3F, 0xCA, 0xBB, 0x70, 0x38, 0xFB,
+    0x87, 0x36, 0xEE, 0x5E, 0x7B, 0x58, 0xA7, 0xCD, 0x93, 0x3F, 0x8B, 0x79, 0xEF, 0x6E, 0x21, 0xF9,
+    0xDD, 0xBF, 0x64, 0x92, 0xDF, 0x3A, 0x07, 0xBD, 0x6F, 0x3F, 0x07, 0xF1, 0xD7, 0xD3, 0x10, 0xFF,
+    0x39, 0x2B, 0x92, 0xF7, 0x57, 0xB0, 0x72, 0x5B, 0x07, 0x92, 0xEE, 0x56, 0x09, 0x6C, 0x7B, 0x3C,
+    0x48, 0xC0, 0x8D, 0x82, 0x4B, 0xEF, 0xC2, 0xD4, 0xE3, 0xD8, 0x21, 0xC6, 0xB7, 0x72, 0xF4, 0x94,
+    0xEC, 0x5F, 0x29, 0x1C, 0xE0, 0xDB, 0xAD, 0x5E, 0xE2, 0x36, 0x1C, 0x60, 0x4D, 0x30, 0x88, 0xCD,
+    0xFC, 0x3E, 0x18, 0xC5, 0xAF, 0xC3, 0x9E, 0x33, 0x28, 0x92, 0xF6, 0x87, 0xEB, 0xD0, 0xA0, 0xBC,
+    0xDF, 0x9A, 0x26, 0xFD, 0xB0, 0x83, 0xB8, 0xD9, 0x98, 0xDA, 0x14, 0x02, 0x91, 0x41, 0xE4, 0xD8,
+    0xB7, 0x29, 0xB1, 0x5A, 0x3B, 0x7A, 0x98, 0x31, 0x84, 0x59, 0x64, 0x87, 0x0B, 0xE2, 0x59, 0x3B,
+    0xB8, 0x2D, 0x44, 0x4E, 0x88, 0x5A, 0xDD, 0xCB, 0x05, 0x0A, 0x6C, 0x03, 0xD1, 0xCB, 0x75, 0xC1,
+    0x26, 0xD7, 0x24, 0xEA, 0xE5, 0x07, 0x12, 0x77, 0xDC, 0xAE, 0xA5, 0xA0, 0x6F, 0x92, 0x46, 0xD5,
+    0xC3, 0x02, 0x66, 0xF7, 0x32, 0xC4, 0x6C, 0x8A, 0xC8, 0x82, 0x7D, 0x5C, 0x48, 0x62, 0x2D, 0x9C,
+    0x66, 0xE7, 0x7E, 0xF6, 0x28, 0x5E, 0xB4, 0x8F, 0xE0, 0x03, 0xDB, 0x1F, 0xD8, 0x36, 0x32, 0x26,
+    0xE5, 0x4C, 0xA2, 0x16, 0x8B, 0xC5, 0x35, 0x96, 0x4D, 0x66, 0xF1, 0x4C, 0xD2, 0xEA, 0x30, 0x5E,
+    0x32, 0xB8, 0x4E, 0x60, 0x65, 0xB8, 0xA9, 0xA5, 0xEB, 0xB1, 0x7B, 0x0C, 0x6D, 0x0F, 0x9D, 0x7F,
+    0x9A, 0x49, 0x6C, 0xA1, 0xF8, 0xA1, 0x0B, 0x08, 0xAC, 0x18, 0x6E, 0x74, 0x91, 0x1B, 0xED, 0x3D,
+    0xF0, 0x61, 0x1B, 0x76, 0x87, 0x2D, 0xA3, 0x9C, 0x92, 0x9C, 0xFA, 0x7A, 0x53, 0x20, 0x33, 0x1D,
+    0xC2, 0x42, 0x87, 0xD8, 0x3D, 0x3C, 0x23, 0xF2, 0xC2, 0xBB, 0x61, 0xB7, 0x36, 0x8A, 0x19, 0xCC,
+    0x88, 0x89, 0xE1, 0xB0, 0x67, 0x77, 0x6D, 0x15, 0xDA, 0x9F, 0xDB, 0xBA, 0xC4, 0xE0, 0xDB, 0xAA,
+    0xAC, 0xA2, 0xC1, 0xB7, 0x62, 0x8B, 0x98, 0x8E, 0xB7, 0x59, 0xDC, 0x6A, 0x18, 0x92, 0x26, 0xEC,
+    0x61, 0x59, 0xDA, 0x44, 0x3D, 0xDE, 0x9A, 0x3A, 0xEE, 0xF0, 0xD6, 0xCC, 0x0C, 0xDF, 0x9A, 0x2A,
+    0xE7, 0x90, 0x57, 0xB6, 0x09, 0xC6, 0x13, 0xE5, 0xAD, 0xED, 0x26, 0xB0, 0xAD, 0x5D, 0xDF, 0x6A,
+    0x04, 0xF0, 0x99, 0xB6, 0x7E, 0xC9, 0x0D, 0x3F, 0x71, 0xC3, 0xAF, 0xDD, 0x90, 0x13, 0x13, 0x0D,
+    0xFC, 0x84, 0xA1, 0xC6, 0x5F, 0xC6, 0xCF, 0x42, 0x5B, 0xC9, 0x92, 0x1B, 0x00, 0xD4, 0x28, 0xAF,
+    0x89, 0xD4, 0xF8, 0x7C, 0x23, 0xAD, 0x78, 0xE7, 0x2F, 0x0D, 0xAB, 0x3B, 0x19, 0x1C, 0x84, 0xAB,
+    0xF2, 0x5E, 0xFD, 0x8E, 0xFD, 0xF6, 0x53, 0x2C, 0xED, 0x59, 0xBF, 0xA6, 0x87, 0x70, 0x65, 0x0B,
+    0xE3, 0x86, 0xB5, 0x8F, 0x05, 0x53, 0xCD, 0x43, 0x38, 0xF4, 0x9A, 0xA4, 0x7B, 0x70, 0x41, 0x8B,
+    0xD7, 0x70, 0x48, 0x03, 0x1C, 0x0A, 0x87, 0x00, 0x83, 0xDF, 0x20, 0x20, 0xF0, 0xF8, 0xAE, 0xC8,
+    0x08, 0xD0, 0xE2, 0xF6, 0x8F, 0x1A, 0xE4, 0x31, 0x73, 0x58, 0xB4, 0x84, 0x00, 0x3E, 0x09, 0x47,
+    0x37, 0xFA, 0x1A, 0x61, 0xFA, 0x84, 0x3E, 0xA5, 0x53, 0x38, 0x86, 0x1C, 0x57, 0x84, 0xA8, 0xB1,
+    0x45, 0x4D, 0x88, 0x7A, 0xF6, 0xEB, 0x08, 0x22, 0xFC, 0x63, 0x23, 0x66, 0x63, 0x1B, 0x0F, 0xB0,
+    0x4F, 0x92, 0x5D, 0xFB, 0xC4, 0x5A, 0xB7, 0x3E, 0xB0, 0x0A, 0x88, 0xC2, 0x7C, 0x46, 0x13, 0x73,
+    0x72, 0xBA, 0x02, 0x73, 0x4A, 0x8E, 0x95, 0xAA, 0x23, 0xE5, 0x34, 0x5A, 0x37, 0x2E, 0xDA, 0x7F,
+    0xE1, 0xFE, 0x37, 0x40, 0x2D, 0x7E, 0x98, 0xFE, 0x20, 0xC6, 0xF9, 0xA4, 0x2F, 0x6E, 0x9C, 0xC2,
+    0xD0, 0x30, 0x1A, 0x5D, 0xEC, 0x87, 0xC0, 0x65, 0x7C, 0xD8, 0x4F, 0x37, 0x1A, 0xBB, 0x45, 0x4C,
+    0xA0, 0x76, 0x9E, 0x2D, 0xE1, 0xB5, 0x36, 0xB0, 0x41, 0x47, 0x30, 0x22, 0xB0, 0x51, 0x13, 0x35,
+    0x88, 0x70, 0xD2, 0xC6, 0x4D, 0x38, 0x13, 0xB3, 0x07, 0x0C, 0x0C, 0x9A, 0x29, 0x3D, 0xA2, 0x01,
+    0xFD, 0xCC, 0x5D, 0x64, 0x22, 0x31, 0x9D, 0xDF, 0xB2, 0xCE, 0x63, 0xE5, 0x0D, 0x38, 0x25, 0x82,
+    0x23, 0x6C, 0x65, 0x8B, 0x4F, 0x50, 0x59, 0x5B, 0xD8, 0x6A, 0x99, 0xB9, 0x61, 0xB3, 0x7C, 0x56,
+    0xE2, 0x86, 0x68, 0x69, 0xCA, 0xCC, 0x64, 0xA9, 0x7D, 0x94, 0x0C, 0xE6, 0xFD, 0x11, 0x13, 0xFB,
+    0xC3, 0x63, 0x44, 0x78, 0xEB, 0x85, 0x64, 0x8C, 0xB1, 0xE8, 0xE7, 0xE1, 0x9A, 0x2A, 0x81, 0x0D,
+    0x6B, 0xB8, 0x29, 0x3C, 0xAC, 0x8B, 0xCD, 0x10, 0x72, 0x9B, 0x01, 0x76, 0xE4, 0x41, 0x8B, 0xB8,
+    0x4B, 0x58, 0xF1, 0x26, 0xB4, 0x12, 0x31, 0xE5, 0x0A, 0x44, 0x35, 0xCE, 0x78, 0x93, 0xD8, 0x2C,
+    0x15, 0x79, 0xC6, 0xDE, 0x5B, 0xB3, 0x6F, 0xAD, 0xAD, 0x60, 0x0B, 0xBD, 0x5A, 0x3E, 0x79, 0x5A,
+    0xDE, 0xDB, 0x41, 0x80, 0xCA, 0x9B, 0x4D, 0x7E, 0x93, 0x69, 0x9C, 0xDF, 0xAA, 0xCC, 0x2D, 0x26,
+    0x70, 0x7E, 0xBB, 0x30, 0xFF, 0x60, 0xD2, 0xE5, 0x77, 0xC4, 0xDC, 0xA7, 0x17, 0xCD, 0x7F, 0xC5,
+    0x6C, 0x2B, 0xCF, 0xF6, 0x92, 0x0E, 0x7A, 0xD3, 0x49, 0xA2, 0xDE, 0x46, 0xBC, 0x12, 0xF5, 0x2F,
+    0x02, 0xA6, 0x94, 0x40, 0x1B, 0x99, 0x9E, 0xF2, 0x0C, 0x18, 0xF9, 0xD0, 0x0A, 0xDC, 0xDF, 0x46,
+    0x2D, 0xE4, 0x00, 0x09, 0xF5, 0x29, 0xA5, 0x74, 0xF2, 0x95, 0x36, 0xFF, 0xD9, 0x4A, 0x0E, 0xB9,
+    0xDE, 0xFD, 0x7F, 0x09, 0x72, 0x50, 0xD9, 0x50, 0xC6, 0x90, 0x3B, 0xAB, 0x79, 0x9D, 0xAF, 0x13,
+    0xEC, 0x94, 0x3B, 0x73, 0x32, 0x61, 0xD2, 0x80, 0xDA, 0xB9, 0x3B, 0xA9, 0x68, 0xB5, 0xBC, 0x07,
+    0x1F, 0x90, 0x9D, 0x1C, 0x26, 0xE1, 0xBB, 0xC5, 0x11, 0x02, 0x5E, 0x00, 0x1A, 0xE0, 0xB5, 0x88,
+    0xC9, 0x9A, 0x34, 0x4C, 0xD5, 0x1A, 0x44, 0x67, 0x2A, 0x10, 0x1D, 0xF2, 0x1C, 0xA2, 0x00, 0xD1,
+    0xC1, 0x7B, 0x2D, 0x04, 0x2C, 0x2C, 0x0B, 0xE4, 0x6C, 0xFE, 0xF7, 0x3B, 0x6D, 0x66, 0xEC, 0x39,
+    0x5B, 0xC5, 0x03, 0xB1, 0x9F, 0xC9, 0x8A, 0xDB, 0xF5, 0x85, 0x8D, 0x8D, 0x77, 0x48, 0x9B, 0xAD,
+    0x7C, 0xF4, 0x4A, 0x46, 0x52, 0x1E, 0xE0, 0x11, 0xB6, 0x29, 0x39, 0x0D, 0xEC, 0x66, 0x2A, 0x10,
+    0x5B, 0x99, 0x2D, 0x38, 0x3E, 0x64, 0x92, 0x91, 0x23, 0x2B, 0x28, 0xB5, 0x51, 0x88, 0x12, 0x79,
+    0x3A, 0x5E, 0x76, 0xB8, 0x92, 0x84, 0xB1, 0x89, 0xE8, 0x59, 0x27, 0xF8, 0x16, 0x2A, 0x7E, 0x96,
+    0xD3, 0xAE, 0xD2, 0xAA, 0x86, 0x39, 0x43, 0xAB, 0x56, 0x14, 0xE4, 0x5D, 0x0E, 0xC3, 0x72, 0xDB,
+    0x72, 0xA0, 0x51, 0xB5, 0xA6, 0x60, 0x9A, 0x11, 0xE5, 0xE4, 0x0B, 0x62, 0x9C, 0xE1, 0x89, 0xBB,
+    0xB8, 0x50, 0x0A, 0x5F, 0x56, 0x25, 0x3F, 0xE0, 0xBA, 0x0B, 0x70, 0xC8, 0xC6, 0x9B, 0x8E, 0x29,
+    0x08, 0xE7, 0x7F, 0x6A, 0x56, 0x98, 0xBF, 0xE9, 0xF2, 0x60, 0xAF, 0x4A, 0xF3, 0xAE, 0x9C, 0x69,
+    0xDA, 0xE5, 0x8D, 0xBA, 0xD3, 0xB4, 0xEA, 0xD0, 0xB4, 0x57, 0x43, 0x62, 0x2D, 0x21, 0x0F, 0x42,
+    0xCC, 0x28, 0x6D, 0xEB, 0x21, 0x49, 0x23, 0x65, 0x1D, 0x5D, 0x52, 0xE2, 0x22, 0xAF, 0x52, 0x49,
+    0xB0, 0x46, 0x02, 0xAA, 0xB5, 0xD5, 0xF3, 0xE0, 0x31, 0x5B, 0x3C, 0xC7, 0x05, 0x5E, 0xD1, 0xC2,
+    0x30, 0xAA, 0x3B, 0x18, 0xB6, 0x50, 0xB7, 0x2E, 0xC7, 0x23, 0xB0, 0x76, 0x6F, 0xC4, 0xAA, 0x7E,
+    0xA8, 0xCF, 0x35, 0xE1, 0xA4, 0xD4, 0xEA, 0xA3, 0x8E, 0x3E, 0x9E, 0xA8, 0xBB, 0xD3, 0x66, 0x02,
+    0xA1, 0xC8, 0x61, 0x5D, 0x26, 0xB6, 0x2E, 0xA5, 0xE5, 0xD0, 0xBC, 0xC0, 0x4C, 0xE3, 0xE0, 0x86,
+    0x67, 0x1D, 0x47, 0x24, 0x6A, 0xA9, 0xC8, 0x4E, 0x7A, 0x57, 0xD1, 0x5B, 0x98, 0xCA, 0x91, 0x43,
+    0x59, 0x94, 0x53, 0x37, 0x60, 0x8A, 0x69, 0xA4, 0xF9, 0xFE, 0xE8, 0x8A, 0x1B, 0xA0, 0x92, 0xCE,
+    0x5C, 0x28, 0x52, 0xD5, 0xB7, 0x77, 0xBF, 0x31, 0xEA, 0x7B, 0x04, 0xCB, 0xCC, 0x3E, 0x9D, 0xB1,
+    0x44, 0x9A, 0x1B, 0x50, 0x14, 0x29, 0x91, 0xAF, 0x3F, 0xE9, 0x59, 0x28, 0xED, 0xB9, 0xD9, 0x98,
+    0xC0, 0x18, 0x9B, 0x54, 0x76, 0xAD, 0xAC, 0x82, 0x3E, 0x9D, 0x8D, 0x57, 0x4D, 0x1D, 0xB5, 0x66,
+    0x36, 0x5C, 0x2C, 0xC7, 0x72, 0x66, 0x3E, 0xEC, 0xD2, 0x36, 0x1D, 0x11, 0xC5, 0x99, 0x53, 0xC5,
+    0x11, 0xD8, 0xD4, 0x9E, 0xEC, 0x8F, 0xDE, 0x38, 0x81, 0x7D, 0xB2, 0xC8, 0xBF, 0xBC, 0x8F, 0x39,
+    0x25, 0x38, 0xB3, 0x0D, 0x85, 0xF3, 0x08, 0x6B, 0x8C, 0x21, 0x54, 0x1C, 0x95, 0x23, 0x42, 0x15,
+    0x78, 0x66, 0x63, 0x32, 0xC5, 0x39, 0xD8, 0x56, 0x6E, 0x93, 0x66, 0x47, 0x99, 0x78, 0x93, 0x59,
+    0x7C, 0x9A, 0xE5, 0xFD, 0x22, 0xBB, 0x09, 0x0B, 0x3D, 0x3C, 0xC6, 0x2E, 0xB0, 0x83, 0xCD, 0xA2,
+    0x3B, 0x6D, 0x59, 0xC5, 0xDF, 0xA8, 0xF3, 0xCA, 0xF8, 0x15, 0x99, 0x59, 0x8D, 0x5F, 0x81, 0x71,
+    0x41, 0x03, 0x11, 0x36, 0x48, 0xF8, 0xA0, 0x4B, 0x2A, 0x76, 0x57, 0x58, 0xF4, 0x42, 0x47, 0x44,
+    0xEE, 0x2A, 0x0B, 0x33, 0x58, 0x60, 0xDE, 0x61, 0xA2, 0x5D, 0x4F, 0xE9, 0xC7, 0xDB, 0x42, 0x35,
+    0x02, 0x5F, 0x74, 0x60, 0x31, 0x7F, 0x6B, 0xDC, 0xB4, 0xB5, 0x96, 0xAE, 0x1A, 0xE1, 0x0C, 0xC8,
+    0xE3, 0x0D, 0x55, 0x30, 0xBB, 0x8C, 0xBC, 0x12, 0xBB, 0x56, 0x01, 0xC7, 0xFD, 0x8E, 0xF9, 0xA7,
+    0x84, 0x76, 0xCD, 0x85, 0x26, 0x12, 0xE0, 0xF7, 0x88, 0x9F, 0x7C, 0xA4, 0xB5, 0xC0, 0xB5, 0x44,
+    0xB1, 0x48, 0x1D, 0xD4, 0x18, 0x84, 0xE7, 0xC7, 0x98, 0x6E, 0x66, 0x57, 0x94, 0x91, 0x9B, 0xBC,
+    0xC0, 0xDC, 0xFA, 0x22, 0x54, 0xF3, 0x58, 0x9A, 0x7A, 0xBF, 0x62, 0x1B, 0x45, 0x09, 0x45, 0xB4,
+    0x18, 0x05, 0xF4, 0x51, 0x83, 0xA6, 0x03, 0x66, 0x47, 0x25, 0x60, 0x5F, 0xC7, 0x70, 0x94, 0xA9,
+    0x8F, 0x33, 0x9D, 0x9B, 0x63, 0x29, 0xEB, 0xC2, 0x49, 0xC0, 0x2F, 0x6E, 0x4F, 0xC3, 0x2F, 0xD1,
+    0xB0, 0x04, 0x4D, 0xD9, 0x62, 0x56, 0x53, 0x5B, 0x24, 0x4C, 0x56, 0x5C, 0x57, 0x9C, 0x3E, 0x8E,
+    0x21, 0x1D, 0x5E, 0xC5, 0xF5, 0x25, 0x30, 0x42, 0x07, 0xFF, 0xDF, 0x0A, 0xC4, 0xE0, 0xB6, 0x0E,
+    0xD1, 0xBA, 0xDA, 0x91, 0x28, 0x2B, 0xC8, 0x4B, 0x1C, 0xD4, 0x75, 0xF0, 0xE0, 0xE6, 0xEE, 0xA6,
+    0x45, 0xAB, 0xE8, 0xD7, 0x74, 0x95, 0xCF, 0x5F, 0x97, 0x45, 0xDD, 0x47, 0xD6, 0x70, 0xCE, 0x58,
+    0x76, 0xCD, 0xD6, 0x75, 0x56, 0x09, 0x16, 0x79, 0xFA, 0x29, 0x60, 0xCD, 0xA8, 0xC0, 0x30, 0xE8,
+    0xC1, 0x1E, 0x20, 0x30, 0xA0, 0xB2, 0x6E, 0xDF, 0x4F, 0xE5, 0xA8, 0x7D, 0x36, 0x1D, 0x9C, 0xB0,
+    0xD8, 0x01, 0xD4, 0x21, 0x64, 0x52, 0x85, 0x98, 0x7C, 0x38, 0x8B, 0x5C, 0xAE, 0xB5, 0x8E, 0x22,
+    0xB2, 0x85, 0x8D, 0x92, 0xAD, 0x84, 0xEF, 0xEA, 0x36, 0x09, 0xD6, 0xA8, 0x0C, 0xD4, 0x92, 0x50,
+    0x83, 0xA2, 0x8D, 0xE2, 0x64, 0x2F, 0xD1, 0xA1, 0x12, 0x3D, 0x0F, 0x16, 0x5F, 0x23, 0x22, 0xBE,
+    0xDB, 0x2B, 0x6D, 0x69, 0x5C, 0x57, 0x3E, 0x12, 0xB1, 0xAB, 0xFB, 0xFD, 0xAE, 0x65, 0xBF, 0xFB,
+    0x10, 0x6B, 0xDF, 0xB8, 0x8B, 0x5E, 0xE2, 0x6B, 0x37, 0xD1, 0x76, 0xF9, 0x37, 0xD1, 0xEF, 0x22,
+    0x30, 0x31, 0x45, 0xD2, 0x86, 0x19, 0xFB, 0x2E, 0xC5, 0x0B, 0xC5, 0x71, 0x16, 0xA1, 0x63, 0x14,
+    0x27, 0x29, 0x4E, 0xF3, 0xD9, 0x12, 0xD5, 0x3E, 0xCB, 0x7E, 0xF7, 0x2B, 0xEC, 0x77, 0xDB, 0x8F,
+    0xF7, 0xBB, 0x0F, 0x98, 0x4E, 0xAE, 0x67, 0x45, 0xB2, 0x99, 0x8A, 0x14, 0x5A, 0xB0, 0x7C, 0x67,
+    0x10, 0xF6, 0xE5, 0x11, 0x7D, 0xEC, 0xA6, 0x7D, 0x87, 0x46, 0x77, 0xFE, 0x88, 0x94, 0xF7, 0x87,
+    0x90, 0x1D, 0x71, 0xD8, 0x41, 0xC0, 0x27, 0x61, 0x0F, 0xFB, 0x22, 0x76, 0x09, 0xB1, 0x36, 0xAF,
+    0x4D, 0xCA, 0x1A, 0x08, 0x1E, 0x48, 0x6A, 0x90, 0x46, 0x4A, 0x81, 0x4E, 0x70, 0xC6, 0xF3, 0x07,
+    0x8E, 0x25, 0x15, 0x2B, 0xC2, 0xBC, 0xFF, 0xA4, 0xF7, 0x50, 0xB6, 0xD2, 0x3D, 0x32, 0x66, 0x86,
+    0xE6, 0x86, 0xFC, 0xE2, 0x81, 0x5C, 0x2A, 0x30, 0xCD, 0xA7, 0x5C, 0x14, 0x3D, 0x45, 0xBA, 0x46,
+    0xA9, 0xA4, 0x4F, 0x55, 0xE7, 0xD0, 0xFD, 0xEE, 0xE7, 0x9C, 0x48, 0x62, 0xFA, 0x53, 0x37, 0xCA,
+    0xEB, 0x77, 0xCE, 0x0E, 0xF2, 0xBB, 0x5F, 0x7D, 0xB5, 0x97, 0xDF, 0x7F, 0xF3, 0xA7, 0xC0, 0xE6,
+    0x6F, 0x31, 0x39, 0xE6, 0x16, 0xF1, 0x12, 0x66, 0x1D, 0x3F, 0x0B, 0x2B, 0x8F, 0x7E, 0xA6, 0x10,
+    0xE5, 0xE5, 0x2A, 0x76, 0x08, 0x3D, 0x38, 0x5F, 0x20, 0xA8, 0x66, 0x7B, 0x2C, 0x65, 0x39, 0xEA,
+    0x52, 0x79, 0x03, 0xD6, 0xC8, 0xB5, 0xB8, 0x7D, 0x5E, 0xBE, 0x9F, 0x34, 0x47, 0x27, 0x8E, 0x4D,
+    0xE7, 0x45, 0xD5, 0xF1, 0x61, 0x5E, 0xCD, 0xF3, 0x71, 0x5E, 0x59, 0x1D, 0xE4, 0x16, 0x5D, 0xCE,
+    0x36, 0xDA, 0xAD, 0xDB, 0x42, 0x85, 0x76, 0x95, 0x0E, 0x8A, 0xFC, 0x9A, 0x9B, 0xCB, 0xC2, 0x26,
+    0x1B, 0x37, 0x7D, 0xA1, 0xA4, 0x95, 0xF7, 0x54, 0x83, 0xC5, 0x87, 0x10, 0x52, 0x91, 0x76, 0xF3,
+    0x93, 0x4D, 0x3C, 0xCE, 0x2B, 0x03, 0x5B, 0x61, 0x38, 0x67, 0xDF, 0x2F, 0xFA, 0x8D, 0x6E, 0x97,
+    0x73, 0xE3, 0x40, 0xAB, 0x64, 0x87, 0x56, 0x3F, 0x6C, 0x5F, 0xC5, 0xCA, 0x7B, 0x3C, 0x2C, 0xAA,
+    0xEB, 0xDA, 0x23, 0x98, 0xFB, 0xDE, 0x75, 0x09, 0xB6, 0xB6, 0xF1, 0x9D, 0xF6, 0x30, 0xE5, 0xEC,
+    0x0C, 0x5B, 0x34, 0x2B, 0xC7, 0xF3, 0x8C, 0x4D, 0x41, 0x86, 0x62, 0x59, 0x4A, 0x92, 0x81, 0x67,
+    0x53, 0xF6, 0x96, 0xCB, 0xF4, 0xED, 0x75, 0x68, 0xB5, 0xD9, 0x1C, 0x74, 0x93, 0xAE, 0x1A, 0xA7,
+    0x54, 0x68, 0x29, 0x61, 0xDF, 0x1E, 0xF1, 0xD0, 0x71, 0x7E, 0x4A, 0x81, 0x2C, 0xB1, 0x8F, 0xCB,
+    0xCA, 0xFB, 0x1E, 0xDB, 0xB1, 0x93, 0x12, 0x54, 0x72, 0x3A, 0x83, 0x58, 0xBE, 0x8D, 0xD3, 0x86,
+    0xB1, 0xE7, 0xF1, 0x21, 0xBE, 0xF3, 0xDB, 0xB7, 0x1B, 0x66, 0x01, 0xB2, 0x94, 0xE2, 0x44, 0x83,
+    0x9A, 0x2E, 0x1D, 0x71, 0x5F, 0x62, 0x23, 0x7C, 0x57, 0x4F, 0x3A, 0x4F, 0x69, 0x71, 0xEA, 0x80,
+    0xC8, 0xB4, 0x8E, 0xB3, 0x77, 0x57, 0x44, 0xB4, 0x1A, 0x4C, 0xD2, 0x65, 0xFD, 0x01, 0xF5, 0x7F,
+    0xB9, 0x46, 0x4F, 0x35, 0xFA, 0x40, 0x9D, 0x3F, 0x04, 0x33, 0x9C, 0x12, 0xFB, 0x00, 0xE7, 0xDE,
+    0xB0, 0xA3, 0x8C, 0xDA, 0xB0, 0xC8, 0x8B, 0xB8, 0x89, 0xB2, 0x32, 0x8B, 0x91, 0x2D, 0x4E, 0x5A,
+    0x00, 0x35, 0xA1, 0xB9, 0xB3, 0x2F, 0xA0, 0xA8, 0x98, 0xEA, 0x8C, 0xCF, 0x33, 0xCB, 0x12, 0x0B,
+    0x8B, 0x21, 0x7D, 0xA7, 0xEC, 0x32, 0xC2, 0x01, 0x31, 0x40, 0xD6, 0x0D, 0xE8, 0x20, 0xC0, 0x38,
+    0xDA, 0x32, 0xE9, 0x21, 0x07, 0x87, 0x51, 0xD6, 0x35, 0x24, 0x7A, 0xDA, 0x98, 0xC6, 0x2F, 0x01,
+    0x65, 0xF0, 0xE4, 0x83, 0x09, 0x25, 0x04, 0x48, 0xCC, 0x6A, 0xA0, 0xE2, 0x00, 0x20, 0xFE, 0xFE,
+    0x29, 0xD0, 0x38, 0xAA, 0xF6, 0x3E, 0xC9, 0x0E, 0xE4, 0x8B, 0x3C, 0xF2, 0xBE, 0x06, 0x71, 0x61,
+    0x54, 0xE8, 0x20, 0x87, 0x7A, 0x6C, 0x6E, 0x1E, 0xDD, 0x47, 0xE1, 0xFC, 0xDC, 0x9D, 0x99, 0x37,
+    0x7E, 0xE9, 0x17, 0xA8, 0x78, 0x5F, 0x06, 0x8F, 0xF5, 0xAF, 0xB3, 0xDC, 0xBE, 0xFD, 0xB1, 0xEE,
+    0x68, 0x5F, 0x28, 0x02, 0xFC, 0x71, 0xBF, 0x36, 0xB8, 0x22, 0x3D, 0xAE, 0xB8, 0xFE, 0x4C, 0x4F,
+    0xF4, 0xB9, 0x3B, 0xD6, 0x7B, 0x3C, 0x10, 0x06, 0xBF, 0xE4, 0xEB, 0x6F, 0x4D, 0x65, 0x26, 0x65,
+    0x56, 0xA0, 0x2E, 0xA3, 0xAC, 0x31, 0xB3, 0xC3, 0x0E, 0x39, 0x1E, 0xA1, 0x7B, 0x45, 0x52, 0x33,
+    0xC7, 0x59, 0xE5, 0x90, 0xDE, 0x15, 0x9A, 0x87, 0x61, 0x7E, 0xEA, 0x25, 0x65, 0xE8, 0xBF, 0x17,
+    0xF2, 0x62, 0x2E, 0xD0, 0xD3, 0x57, 0xAE, 0x6D, 0xB0, 0xE8, 0x26, 0xBC, 0x11, 0x66, 0xBF, 0x48,
+    0x32, 0xC3, 0xE6, 0x6F, 0x22, 0x13, 0x79, 0xB8, 0x3F, 0xC6, 0x70, 0x1E, 0x41, 0xDC, 0xFF, 0x07,
+    0x13, 0x0D, 0x65, 0xA8, 0xFF, 0xEF, 0x50, 0xFF, 0x9F, 0x21, 0x6B, 0x15, 0x03, 0x00, 0x55, 0x90,
+    0xA1, 0x91, 0xC3, 0x30, 0x10, 0x45, 0xD7, 0x31, 0x30, 0x58, 0x20, 0x72, 0x33, 0x01, 0x07, 0x52,
+    0x40, 0x40, 0x3A, 0x38, 0xB9, 0x84, 0x03, 0xC9, 0x5C, 0x39, 0x76, 0x09, 0x61, 0xD7, 0x42, 0xBA,
+    0xB0, 0x4B, 0x50, 0x09, 0x46, 0x87, 0x05, 0x04, 0x0C, 0x6C, 0x6D, 0xFE, 0x5F, 0xA3, 0x13, 0xD0,
+    0x9B, 0xD5, 0x48, 0xBB, 0xFF, 0x49, 0x44, 0x9A, 0x87, 0x70, 0xDD, 0x6C, 0xC5, 0xDE, 0xD8, 0x6F,
+    0x05, 0xDA, 0x5D, 0x0C, 0xD0, 0x4D, 0xAC, 0x17, 0x09, 0xAB, 0x57, 0xA1, 0x34, 0xC4, 0x25, 0x77,
+    0xF6, 0xC2, 0xFD, 0x1C, 0x6D, 0x13, 0x89, 0xCB, 0xB9, 0xDE, 0x81, 0xD4, 0xA1, 0x90, 0x38, 0x2B,
+    0x31, 0xCC, 0x81, 0xCD, 0xA6, 0x39, 0x14, 0xC0, 0xC6, 0x90, 0x89, 0xFE, 0xE2, 0xC0, 0x4B, 0xCE,
+    0xC1, 0x4B, 0x91, 0x13, 0x90, 0x30, 0xAE, 0x1E, 0xD8, 0x71, 0xF8, 0x14, 0x74, 0x8A, 0x96, 0x38,
+    0x3C, 0x20, 0x8B, 0xA2, 0x13, 0x33, 0x14, 0x4F, 0xE9, 0x2D, 0x30, 0x3C, 0x39, 0x86, 0x91, 0xFB,
+    0xB5, 0x7A, 0xC1, 0x7E, 0xC7, 0xFA, 0x6F, 0x54, 0x7F, 0x98, 0xBA, 0x2D, 0xAE, 0xA2, 0x59, 0x26,
+    0x76, 0x5B, 0x0E, 0xB1, 0x85, 0x62, 0x9F, 0xB6, 0xD0, 0xC8, 0x26, 0x1A, 0xB5, 0x6B, 0xC8, 0x30,
+    0xD2, 0xDC, 0x65, 0xE4, 0xD0, 0xD2, 0x52, 0x4C, 0x77, 0xFF, 0x8B, 0x0E, 0xA9, 0x20, 0x76, 0x82,
+    0x37, 0xE3, 0x0C, 0xE6, 0x71, 0xD4, 0x66, 0x1A, 0xC1, 0x16, 0x09, 0xBE, 0xF0, 0x05, 0x50, 0x19,
+    0xE4, 0xE6, 0xE8, 0xE3, 0x18, 0xF3, 0x33, 0xFE, 0x55, 0x84, 0x49, 0x6A, 0x45, 0x14, 0x59, 0x3F,
+    0x70, 0xF9, 0x5B, 0xDE, 0x35, 0xCE, 0xB1, 0x11, 0xC2, 0x30, 0x0C, 0x40, 0x51, 0x05, 0x15, 0x29,
+    0x28, 0xCC, 0x06, 0x19, 0x21, 0x0D, 0x7D, 0xE8, 0x59, 0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D, 0x8B,
+    0x30, 0x84, 0x47, 0x70, 0xC3, 0x06, 0x29, 0x52, 0x20, 0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE, 0xC5,
+    0x3B, 0x9D, 0x25, 0xF2, 0x3F, 0xC7, 0x1E, 0xFB, 0xBD, 0xCA, 0x29, 0x92, 0x28, 0x91, 0x85, 0x35,
+    0xD2, 0x1E, 0x81, 0x5A, 0x64, 0x76, 0x4C, 0xF9, 0xB5, 0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F, 0x53,
+    0xF3, 0x29, 0xCC, 0x27, 0x13, 0x7C, 0x94, 0xB2, 0xC0, 0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6, 0x09,
+    0x76, 0x50, 0x47, 0x38, 0x43, 0x1E, 0xE0, 0x4E, 0x13, 0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A, 0x8C,
+    0x4D, 0xC9, 0x22, 0x83, 0x69, 0x8B, 0xFF, 0xAE, 0xBA, 0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41, 0x8E,
+    0xAD, 0xEF, 0x79, 0xE9, 0x39, 0xF8, 0xFD, 0x02,
 };
 
 static const EpdGlyph notoserif_14_bolditalicGlyphs[] = {
@@ -2564,99 +2573,99 @@ static const EpdGlyph notoserif_14_bolditalicGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 10, 22, 184, 2, 21, 55, 0 }, // !
-    { 13, 9, 237, 4, 21, 30, 55 }, // "
-    { 17, 21, 261, 0, 21, 90, 85 }, // #
-    { 17, 26, 261, 0, 23, 111, 175 }, // $
-    { 24, 23, 418, 2, 22, 138, 286 }, // %
-    { 24, 23, 374, 0, 22, 138, 424 }, // &
-    { 6, 9, 135, 4, 21, 14, 562 }, // '
-    { 13, 28, 187, 1, 23, 91, 576 }, // (
-    { 13, 28, 187, -2, 23, 91, 667 }, // )
-    { 14, 13, 288, 4, 23, 46, 758 }, // *
-    { 14, 13, 261, 1, 17, 46, 804 }, // +
-    { 7, 10, 142, -1, 5, 18, 850 }, // ,
-    { 9, 4, 145, 0, 10, 9, 868 }, // -
-    { 6, 6, 142, 0, 5, 9, 877 }, // .
-    { 15, 27, 134, -3, 23, 102, 886 }, // /
-    { 16, 23, 261, 1, 22, 92, 988 }, // 0
-    { 14, 21, 241, 0, 21, 74, 1080 }, // 1
-    { 18, 22, 261, -1, 22, 99, 1154 }, // 2
-    { 18, 23, 261, -1, 22, 104, 1253 }, // 3
-    { 16, 21, 261, 0, 21, 84, 1357 }, // 4
-    { 17, 22, 261, 0, 21, 94, 1441 }, // 5
-    { 17, 23, 261, 1, 22, 98, 1535 }, // 6
-    { 17, 21, 261, 1, 21, 90, 1633 }, // 7
-    { 17, 23, 261, 0, 22, 98, 1723 }, // 8
-    { 17, 23, 261, 0, 22, 98, 1821 }, // 9
-    { 8, 17, 167, 1, 16, 34, 1919 }, // :
-    { 10, 21, 167, -1, 16, 53, 1953 }, // ;
-    { 14, 15, 261, 1, 18, 53, 2006 }, // <
-    { 14, 9, 261, 1, 15, 32, 2059 }, // =
-    { 14, 15, 261, 1, 18, 53, 2091 }, // >
-    { 14, 23, 250, 2, 22, 81, 2144 }, // ?
-    { 25, 26, 430, 1, 21, 163, 2225 }, // @
-    { 23, 21, 351, -2, 21, 121, 2388 }, // A
-    { 21, 21, 314, -1, 21, 111, 2509 }, // B
-    { 20, 23, 312, 1, 22, 115, 2620 }, // C
-    { 23, 21, 358, -1, 21, 121, 2735 }, // D
-    { 21, 21, 295, -1, 21, 111, 2856 }, // E
-    { 21, 21, 290, -1, 21, 111, 2967 }, // F
-    { 22, 23, 372, 1, 22, 127, 3078 }, // G
-    { 27, 21, 382, -1, 21, 142, 3205 }, // H
-    { 15, 21, 187, -1, 21, 79, 3347 }, // I
-    { 19, 28, 187, -5, 21, 133, 3426 }, // J
-    { 25, 21, 346, -1, 21, 132, 3559 }, // K
-    { 20, 21, 305, -1, 21, 105, 3691 }, // L
-    { 31, 21, 444, -1, 21, 163, 3796 }, // M
-    { 27, 21, 368, -1, 21, 142, 3959 }, // N
-    { 22, 23, 370, 1, 22, 127, 4101 }, // O
-    { 21, 21, 309, -1, 21, 111, 4228 }, // P
-    { 22, 29, 367, 1, 22, 160, 4339 }, // Q
-    { 22, 21, 330, -1, 21, 116, 4499 }, // R
-    { 18, 23, 274, 0, 22, 104, 4615 }, // S
-    { 21, 21, 305, 1, 21, 111, 4719 }, // T
-    { 23, 22, 349, 2, 21, 127, 4830 }, // U
-    { 22, 21, 326, 2, 21, 116, 4957 }, // V
-    { 33, 21, 498, 2, 21, 174, 5073 }, // W
-    { 26, 21, 342, -2, 21, 137, 5247 }, // X
-    { 22, 21, 323, 2, 21, 116, 5384 }, // Y
-    { 22, 21, 311, -1, 21, 116, 5500 }, // Z
-    { 15, 27, 193, 0, 23, 102, 5616 }, // [
-    { 4, 27, 134, 3, 23, 27, 5718 }, // <backslash>
-    { 15, 27, 193, -2, 23, 102, 5745 }, // ]
-    { 14, 14, 261, 1, 21, 49, 5847 }, // ^
-    { 15, 3, 214, -3, -2, 12, 5896 }, // _
-    { 7, 6, 156, 4, 23, 11, 5908 }, // `
-    { 18, 17, 310, 1, 16, 77, 5919 }, // a
-    { 17, 24, 291, 0, 23, 102, 5996 }, // b
-    { 15, 17, 246, 1, 16, 64, 6098 }, // c
-    { 18, 24, 310, 1, 23, 108, 6162 }, // d
-    { 15, 17, 250, 1, 16, 64, 6270 }, // e
-    { 22, 30, 189, -5, 23, 165, 6334 }, // f
-    { 21, 24, 271, -2, 17, 126, 6499 }, // g
-    { 19, 24, 306, 0, 23, 114, 6625 }, // h
-    { 9, 24, 165, 1, 23, 54, 6739 }, // i
-    { 15, 30, 158, -5, 23, 113, 6793 }, // j
-    { 19, 23, 279, 0, 23, 110, 6906 }, // k
-    { 9, 24, 165, 1, 23, 54, 7016 }, // l
-    { 27, 18, 452, 1, 17, 122, 7070 }, // m
-    { 19, 17, 314, 1, 16, 81, 7192 }, // n
-    { 16, 17, 288, 1, 16, 68, 7273 }, // o
-    { 18, 23, 291, -1, 16, 104, 7341 }, // p
-    { 17, 23, 295, 1, 16, 98, 7445 }, // q
-    { 16, 16, 257, 1, 16, 64, 7543 }, // r
-    { 15, 17, 240, 0, 16, 64, 7607 }, // s
-    { 12, 21, 195, 1, 20, 63, 7671 }, // t
-    { 19, 17, 314, 1, 16, 81, 7734 }, // u
-    { 17, 17, 274, 0, 16, 73, 7815 }, // v
-    { 24, 17, 408, 1, 16, 102, 7888 }, // w
-    { 19, 16, 282, -1, 16, 76, 7990 }, // x
-    { 22, 23, 274, -5, 16, 127, 8066 }, // y
-    { 16, 16, 260, 0, 16, 64, 8193 }, // z
-    { 15, 27, 206, 1, 23, 102, 8257 }, // {
-    { 3, 30, 261, 7, 23, 23, 8359 }, // |
-    { 15, 27, 206, -2, 23, 102, 8382 }, // }
-    { 14, 7, 261, 1, 14, 25, 8484 }, // ~
+    { 13, 9, 237, 4, 21, 30, 0 }, // "
+    { 17, 21, 261, 0, 21, 90, 30 }, // #
+    { 17, 26, 261, 0, 23, 111, 120 }, // $
+    { 24, 23, 418, 2, 22, 138, 231 }, // %
+    { 24, 23, 374, 0, 22, 138, 369 }, // &
+    { 6, 9, 135, 4, 21, 14, 507 }, // '
+    { 13, 28, 187, 1, 23, 91, 55 }, // (
+    { 13, 28, 187, -2, 23, 91, 146 }, // )
+    { 14, 13, 288, 4, 23, 46, 521 }, // *
+    { 14, 13, 261, 1, 17, 46, 567 }, // +
+    { 7, 10, 142, -1, 5, 18, 237 }, // ,
+    { 9, 4, 145, 0, 10, 9, 255 }, // -
+    { 6, 6, 142, 0, 5, 9, 264 }, // .
+    { 15, 27, 134, -3, 23, 102, 613 }, // /
+    { 16, 23, 261, 1, 22, 92, 273 }, // 0
+    { 14, 21, 241, 0, 21, 74, 365 }, // 1
+    { 18, 22, 261, -1, 22, 99, 439 }, // 2
+    { 18, 23, 261, -1, 22, 104, 538 }, // 3
+    { 16, 21, 261, 0, 21, 84, 642 }, // 4
+    { 17, 22, 261, 0, 21, 94, 726 }, // 5
+    { 17, 23, 261, 1, 22, 98, 820 }, // 6
+    { 17, 21, 261, 1, 21, 90, 918 }, // 7
+    { 17, 23, 261, 0, 22, 98, 1008 }, // 8
+    { 17, 23, 261, 0, 22, 98, 1106 }, // 9
+    { 8, 17, 167, 1, 16, 34, 1204 }, // :
+    { 10, 21, 167, -1, 16, 53, 1238 }, // ;
+    { 14, 15, 261, 1, 18, 53, 715 }, // <
+    { 14, 9, 261, 1, 15, 32, 768 }, // =
+    { 14, 15, 261, 1, 18, 53, 800 }, // >
+    { 14, 23, 250, 2, 22, 81, 1291 }, // ?
+    { 25, 26, 430, 1, 21, 163, 853 }, // @
+    { 23, 21, 351, -2, 21, 121, 1372 }, // A
+    { 21, 21, 314, -1, 21, 111, 1493 }, // B
+    { 20, 23, 312, 1, 22, 115, 1604 }, // C
+    { 23, 21, 358, -1, 21, 121, 1719 }, // D
+    { 21, 21, 295, -1, 21, 111, 1840 }, // E
+    { 21, 21, 290, -1, 21, 111, 1951 }, // F
+    { 22, 23, 372, 1, 22, 127, 2062 }, // G
+    { 27, 21, 382, -1, 21, 142, 2189 }, // H
+    { 15, 21, 187, -1, 21, 79, 2331 }, // I
+    { 19, 28, 187, -5, 21, 133, 2410 }, // J
+    { 25, 21, 346, -1, 21, 132, 2543 }, // K
+    { 20, 21, 305, -1, 21, 105, 2675 }, // L
+    { 31, 21, 444, -1, 21, 163, 2780 }, // M
+    { 27, 21, 368, -1, 21, 142, 2943 }, // N
+    { 22, 23, 370, 1, 22, 127, 3085 }, // O
+    { 21, 21, 309, -1, 21, 111, 3212 }, // P
+    { 22, 29, 367, 1, 22, 160, 3323 }, // Q
+    { 22, 21, 330, -1, 21, 116, 3483 }, // R
+    { 18, 23, 274, 0, 22, 104, 3599 }, // S
+    { 21, 21, 305, 1, 21, 111, 3703 }, // T
+    { 23, 22, 349, 2, 21, 127, 1016 }, // U
+    { 22, 21, 326, 2, 21, 116, 3814 }, // V
+    { 33, 21, 498, 2, 21, 174, 3930 }, // W
+    { 26, 21, 342, -2, 21, 137, 4104 }, // X
+    { 22, 21, 323, 2, 21, 116, 4241 }, // Y
+    { 22, 21, 311, -1, 21, 116, 4357 }, // Z
+    { 15, 27, 193, 0, 23, 102, 1143 }, // [
+    { 4, 27, 134, 3, 23, 27, 1245 }, // <backslash>
+    { 15, 27, 193, -2, 23, 102, 1272 }, // ]
+    { 14, 14, 261, 1, 21, 49, 1374 }, // ^
+    { 15, 3, 214, -3, -2, 12, 1423 }, // _
+    { 7, 6, 156, 4, 23, 11, 1435 }, // `
+    { 18, 17, 310, 1, 16, 77, 4473 }, // a
+    { 17, 24, 291, 0, 23, 102, 4550 }, // b
+    { 15, 17, 246, 1, 16, 64, 4652 }, // c
+    { 18, 24, 310, 1, 23, 108, 4716 }, // d
+    { 15, 17, 250, 1, 16, 64, 4824 }, // e
+    { 22, 30, 189, -5, 23, 165, 4888 }, // f
+    { 21, 24, 271, -2, 17, 126, 5053 }, // g
+    { 19, 24, 306, 0, 23, 114, 5179 }, // h
+    { 9, 24, 165, 1, 23, 54, 5293 }, // i
+    { 15, 30, 158, -5, 23, 113, 5347 }, // j
+    { 19, 23, 279, 0, 23, 110, 5460 }, // k
+    { 9, 24, 165, 1, 23, 54, 5570 }, // l
+    { 27, 18, 452, 1, 17, 122, 5624 }, // m
+    { 19, 17, 314, 1, 16, 81, 5746 }, // n
+    { 16, 17, 288, 1, 16, 68, 5827 }, // o
+    { 18, 23, 291, -1, 16, 104, 5895 }, // p
+    { 17, 23, 295, 1, 16, 98, 5999 }, // q
+    { 16, 16, 257, 1, 16, 64, 6097 }, // r
+    { 15, 17, 240, 0, 16, 64, 6161 }, // s
+    { 12, 21, 195, 1, 20, 63, 6225 }, // t
+    { 19, 17, 314, 1, 16, 81, 6288 }, // u
+    { 17, 17, 274, 0, 16, 73, 6369 }, // v
+    { 24, 17, 408, 1, 16, 102, 6442 }, // w
+    { 19, 16, 282, -1, 16, 76, 6544 }, // x
+    { 22, 23, 274, -5, 16, 127, 6620 }, // y
+    { 16, 16, 260, 0, 16, 64, 6747 }, // z
+    { 15, 27, 206, 1, 23, 102, 1446 }, // {
+    { 3, 30, 261, 7, 23, 23, 1548 }, // |
+    { 15, 27, 206, -2, 23, 102, 1571 }, // }
+    { 14, 7, 261, 1, 14, 25, 1673 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 10, 22, 184, 0, 16, 55, 0 }, // U+00A1
     { 16, 21, 261, 1, 21, 84, 55 }, // U+00A2
@@ -2740,19 +2749,19 @@ static const EpdGlyph notoserif_14_bolditalicGlyphs[] = {
     { 16, 24, 287, 1, 23, 96, 8102 }, // U+00F0
     { 19, 24, 314, 1, 23, 114, 8198 }, // U+00F1
     { 16, 24, 288, 1, 23, 96, 8312 }, // U+00F2
-    { 17, 24, 288, 1, 23, 102, 8408 }, // U+00F3
-    { 16, 24, 288, 1, 23, 96, 8510 }, // U+00F4
-    { 17, 24, 288, 1, 23, 102, 8606 }, // U+00F5
-    { 16, 24, 288, 1, 23, 96, 8708 }, // U+00F6
-    { 14, 15, 261, 1, 18, 53, 8804 }, // U+00F7
-    { 18, 20, 288, 0, 18, 90, 8857 }, // U+00F8
-    { 19, 24, 314, 1, 23, 114, 8947 }, // U+00F9
-    { 19, 24, 314, 1, 23, 114, 9061 }, // U+00FA
-    { 19, 24, 314, 1, 23, 114, 9175 }, // U+00FB
-    { 19, 24, 314, 1, 23, 114, 9289 }, // U+00FC
-    { 22, 30, 274, -5, 23, 165, 9403 }, // U+00FD
-    { 18, 30, 291, -1, 23, 135, 9568 }, // U+00FE
-    { 22, 30, 274, -5, 23, 165, 9703 }, // U+00FF
+    { 17, 24, 288, 1, 23, 102, 6811 }, // U+00F3
+    { 16, 24, 288, 1, 23, 96, 8408 }, // U+00F4
+    { 17, 24, 288, 1, 23, 102, 8504 }, // U+00F5
+    { 16, 24, 288, 1, 23, 96, 8606 }, // U+00F6
+    { 14, 15, 261, 1, 18, 53, 8702 }, // U+00F7
+    { 18, 20, 288, 0, 18, 90, 8755 }, // U+00F8
+    { 19, 24, 314, 1, 23, 114, 8845 }, // U+00F9
+    { 19, 24, 314, 1, 23, 114, 8959 }, // U+00FA
+    { 19, 24, 314, 1, 23, 114, 9073 }, // U+00FB
+    { 19, 24, 314, 1, 23, 114, 9187 }, // U+00FC
+    { 22, 30, 274, -5, 23, 165, 9301 }, // U+00FD
+    { 18, 30, 291, -1, 23, 135, 9466 }, // U+00FE
+    { 22, 30, 274, -5, 23, 165, 9601 }, // U+00FF
     { 23, 25, 351, -2, 25, 144, 0 }, // U+0100
     { 18, 21, 310, 1, 20, 95, 144 }, // U+0101
     { 23, 28, 351, -2, 28, 161, 239 }, // U+0102
@@ -3454,98 +3463,98 @@ static const EpdGlyph notoserif_14_bolditalicGlyphs[] = {
     { 9, 4, 145, 0, 10, 9, 162 }, // U+2010
     { 9, 4, 145, 0, 10, 9, 171 }, // U+2011
     { 17, 3, 261, 0, 12, 13, 180 }, // U+2012
-    { 16, 3, 233, -1, 9, 12, 193 }, // U+2013
-    { 31, 3, 467, -1, 9, 24, 205 }, // U+2014
-    { 31, 3, 467, -1, 9, 24, 229 }, // U+2015
-    { 9, 30, 261, 4, 23, 68, 253 }, // U+2016
-    { 15, 6, 192, -3, 0, 23, 321 }, // U+2017
-    { 7, 10, 131, 3, 21, 18, 344 }, // U+2018
-    { 7, 10, 131, 2, 21, 18, 362 }, // U+2019
-    { 7, 10, 131, -1, 5, 18, 380 }, // U+201A
-    { 6, 10, 131, 3, 21, 15, 398 }, // U+201B
-    { 13, 10, 228, 3, 21, 33, 413 }, // U+201C
-    { 14, 10, 228, 2, 21, 35, 446 }, // U+201D
-    { 14, 10, 228, -1, 5, 35, 481 }, // U+201E
-    { 13, 10, 228, 3, 21, 33, 516 }, // U+201F
-    { 13, 27, 223, 2, 23, 88, 549 }, // U+2020
-    { 17, 27, 223, -1, 23, 115, 637 }, // U+2021
-    { 9, 10, 187, 2, 15, 23, 752 }, // U+2022
-    { 10, 10, 233, 4, 15, 25, 775 }, // U+2023
-    { 6, 5, 142, 2, 13, 8, 800 }, // U+2024
-    { 14, 5, 275, 2, 13, 18, 808 }, // U+2025
-    { 23, 6, 427, 1, 5, 35, 826 }, // U+2026
-    { 6, 6, 142, 2, 11, 9, 861 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 870 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 870 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 870 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 914 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 958 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 1008 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 1058 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 1108 }, // U+202F
-    { 35, 23, 608, 2, 22, 202, 1108 }, // U+2030
-    { 47, 23, 796, 2, 22, 271, 1310 }, // U+2031
-    { 8, 9, 135, 3, 21, 18, 1581 }, // U+2032
-    { 14, 9, 242, 3, 21, 32, 1599 }, // U+2033
-    { 21, 9, 348, 3, 21, 48, 1631 }, // U+2034
-    { 6, 9, 135, 4, 21, 14, 1679 }, // U+2035
-    { 13, 9, 242, 4, 21, 30, 1693 }, // U+2036
-    { 19, 9, 348, 4, 21, 43, 1723 }, // U+2037
-    { 12, 9, 205, -1, 2, 27, 1766 }, // U+2038
-    { 9, 12, 165, 1, 14, 27, 1793 }, // U+2039
-    { 9, 12, 165, 0, 14, 27, 1820 }, // U+203A
-    { 22, 21, 382, 1, 21, 116, 1847 }, // U+203B
-    { 17, 22, 294, 2, 21, 94, 1963 }, // U+203C
-    { 15, 23, 270, 3, 22, 87, 2057 }, // U+203D
-    { 15, 2, 214, 2, 24, 8, 2144 }, // U+203E
-    { 23, 7, 0, -21, 0, 41, 2152 }, // U+203F
-    { 25, 6, 0, -19, 25, 38, 2193 }, // U+2040
-    { 14, 21, 210, -2, 21, 74, 2231 }, // U+2041
-    { 28, 24, 467, 0, 23, 168, 2305 }, // U+2042
-    { 9, 5, 169, 1, 13, 12, 2473 }, // U+2043
-    { 18, 21, 29, -8, 21, 95, 2485 }, // U+2044
-    { 15, 27, 193, 0, 23, 102, 2580 }, // U+2045
-    { 14, 27, 193, -2, 23, 95, 2682 }, // U+2046
-    { 30, 23, 497, 2, 22, 173, 2777 }, // U+2047
-    { 23, 23, 394, 2, 22, 133, 2950 }, // U+2048
-    { 23, 23, 393, 2, 22, 133, 3083 }, // U+2049
-    { 15, 23, 285, 1, 17, 87, 3216 }, // U+204A
-    { 17, 27, 293, 3, 23, 115, 3303 }, // U+204B
-    { 16, 11, 288, 1, 16, 44, 3418 }, // U+204C
-    { 16, 11, 288, 1, 16, 44, 3462 }, // U+204D
-    { 14, 13, 234, 1, 17, 46, 3506 }, // U+204E
-    { 8, 21, 167, 1, 16, 42, 3552 }, // U+204F
-    { 21, 23, 359, 1, 22, 121, 3594 }, // U+2050
-    { 17, 25, 234, -1, 23, 107, 3715 }, // U+2051
-    { 12, 22, 205, 1, 21, 66, 3822 }, // U+2052
-    { 14, 7, 261, 1, 14, 25, 3888 }, // U+2053
-    { 23, 6, 0, -8, 0, 35, 3913 }, // U+2054
-    { 14, 14, 252, 1, 17, 49, 3948 }, // U+2055
-    { 15, 17, 294, 1, 16, 64, 3997 }, // U+2056
-    { 28, 9, 454, 3, 21, 63, 4061 }, // U+2057
-    { 19, 17, 357, 2, 16, 81, 4124 }, // U+2058
-    { 19, 17, 357, 2, 16, 81, 4205 }, // U+2059
-    { 5, 23, 142, 2, 22, 29, 4286 }, // U+205A
-    { 19, 23, 357, 2, 22, 110, 4315 }, // U+205B
-    { 16, 16, 325, 2, 16, 64, 4425 }, // U+205C
-    { 6, 23, 142, 2, 22, 35, 4489 }, // U+205D
-    { 5, 23, 142, 2, 22, 29, 4524 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 4553 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2064
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2066
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2067
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2068
-    { 0, 0, 280, 0, 0, 0, 4553 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 4553 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4603 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4653 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4703 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4753 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 4803 }, // U+206F
+    { 16, 3, 233, -1, 9, 12, 6913 }, // U+2013
+    { 31, 3, 467, -1, 9, 24, 6925 }, // U+2014
+    { 31, 3, 467, -1, 9, 24, 193 }, // U+2015
+    { 9, 30, 261, 4, 23, 68, 217 }, // U+2016
+    { 15, 6, 192, -3, 0, 23, 285 }, // U+2017
+    { 7, 10, 131, 3, 21, 18, 308 }, // U+2018
+    { 7, 10, 131, 2, 21, 18, 6949 }, // U+2019
+    { 7, 10, 131, -1, 5, 18, 326 }, // U+201A
+    { 6, 10, 131, 3, 21, 15, 344 }, // U+201B
+    { 13, 10, 228, 3, 21, 33, 6967 }, // U+201C
+    { 14, 10, 228, 2, 21, 35, 7000 }, // U+201D
+    { 14, 10, 228, -1, 5, 35, 359 }, // U+201E
+    { 13, 10, 228, 3, 21, 33, 394 }, // U+201F
+    { 13, 27, 223, 2, 23, 88, 427 }, // U+2020
+    { 17, 27, 223, -1, 23, 115, 515 }, // U+2021
+    { 9, 10, 187, 2, 15, 23, 630 }, // U+2022
+    { 10, 10, 233, 4, 15, 25, 653 }, // U+2023
+    { 6, 5, 142, 2, 13, 8, 678 }, // U+2024
+    { 14, 5, 275, 2, 13, 18, 686 }, // U+2025
+    { 23, 6, 427, 1, 5, 35, 7035 }, // U+2026
+    { 6, 6, 142, 2, 11, 9, 704 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 713 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 713 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 713 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 757 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 801 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 851 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 901 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 951 }, // U+202F
+    { 35, 23, 608, 2, 22, 202, 951 }, // U+2030
+    { 47, 23, 796, 2, 22, 271, 1153 }, // U+2031
+    { 8, 9, 135, 3, 21, 18, 1424 }, // U+2032
+    { 14, 9, 242, 3, 21, 32, 1442 }, // U+2033
+    { 21, 9, 348, 3, 21, 48, 1474 }, // U+2034
+    { 6, 9, 135, 4, 21, 14, 1522 }, // U+2035
+    { 13, 9, 242, 4, 21, 30, 1536 }, // U+2036
+    { 19, 9, 348, 4, 21, 43, 1566 }, // U+2037
+    { 12, 9, 205, -1, 2, 27, 1609 }, // U+2038
+    { 9, 12, 165, 1, 14, 27, 1636 }, // U+2039
+    { 9, 12, 165, 0, 14, 27, 1663 }, // U+203A
+    { 22, 21, 382, 1, 21, 116, 1690 }, // U+203B
+    { 17, 22, 294, 2, 21, 94, 1806 }, // U+203C
+    { 15, 23, 270, 3, 22, 87, 1900 }, // U+203D
+    { 15, 2, 214, 2, 24, 8, 1987 }, // U+203E
+    { 23, 7, 0, -21, 0, 41, 1995 }, // U+203F
+    { 25, 6, 0, -19, 25, 38, 2036 }, // U+2040
+    { 14, 21, 210, -2, 21, 74, 2074 }, // U+2041
+    { 28, 24, 467, 0, 23, 168, 2148 }, // U+2042
+    { 9, 5, 169, 1, 13, 12, 2316 }, // U+2043
+    { 18, 21, 29, -8, 21, 95, 2328 }, // U+2044
+    { 15, 27, 193, 0, 23, 102, 2423 }, // U+2045
+    { 14, 27, 193, -2, 23, 95, 2525 }, // U+2046
+    { 30, 23, 497, 2, 22, 173, 2620 }, // U+2047
+    { 23, 23, 394, 2, 22, 133, 2793 }, // U+2048
+    { 23, 23, 393, 2, 22, 133, 2926 }, // U+2049
+    { 15, 23, 285, 1, 17, 87, 3059 }, // U+204A
+    { 17, 27, 293, 3, 23, 115, 3146 }, // U+204B
+    { 16, 11, 288, 1, 16, 44, 3261 }, // U+204C
+    { 16, 11, 288, 1, 16, 44, 3305 }, // U+204D
+    { 14, 13, 234, 1, 17, 46, 3349 }, // U+204E
+    { 8, 21, 167, 1, 16, 42, 3395 }, // U+204F
+    { 21, 23, 359, 1, 22, 121, 3437 }, // U+2050
+    { 17, 25, 234, -1, 23, 107, 3558 }, // U+2051
+    { 12, 22, 205, 1, 21, 66, 3665 }, // U+2052
+    { 14, 7, 261, 1, 14, 25, 3731 }, // U+2053
+    { 23, 6, 0, -8, 0, 35, 3756 }, // U+2054
+    { 14, 14, 252, 1, 17, 49, 3791 }, // U+2055
+    { 15, 17, 294, 1, 16, 64, 3840 }, // U+2056
+    { 28, 9, 454, 3, 21, 63, 3904 }, // U+2057
+    { 19, 17, 357, 2, 16, 81, 3967 }, // U+2058
+    { 19, 17, 357, 2, 16, 81, 4048 }, // U+2059
+    { 5, 23, 142, 2, 22, 29, 4129 }, // U+205A
+    { 19, 23, 357, 2, 22, 110, 4158 }, // U+205B
+    { 16, 16, 325, 2, 16, 64, 4268 }, // U+205C
+    { 6, 23, 142, 2, 22, 35, 4332 }, // U+205D
+    { 5, 23, 142, 2, 22, 29, 4367 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 4396 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2064
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2066
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2067
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2068
+    { 0, 0, 280, 0, 0, 0, 4396 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 4396 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 4446 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 4496 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4546 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4596 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4646 }, // U+206F
     { 12, 14, 187, 2, 25, 42, 0 }, // U+2070
     { 6, 14, 107, 2, 22, 21, 42 }, // U+2071
     { 12, 13, 187, 1, 24, 39, 63 }, // U+2074
@@ -3621,13 +3630,13 @@ static const EpdGlyph notoserif_14_bolditalicGlyphs[] = {
     { 18, 24, 261, 0, 24, 108, 3801 }, // U+20BE
     { 19, 27, 261, -2, 24, 129, 3909 }, // U+20BF
     { 9, 4, 145, 0, 10, 9, 0 }, // U+2212
-    { 31, 30, 340, -5, 23, 233, 0 }, // U+FB00
-    { 25, 30, 320, -5, 23, 188, 233 }, // U+FB01
-    { 26, 30, 331, -5, 23, 195, 421 }, // U+FB02
-    { 34, 30, 472, -5, 23, 255, 616 }, // U+FB03
-    { 35, 30, 484, -5, 23, 263, 871 }, // U+FB04
-    { 28, 30, 353, -5, 23, 210, 1134 }, // U+FB05
-    { 28, 24, 435, 0, 23, 168, 1344 }, // U+FB06
+    { 31, 30, 340, -5, 23, 233, 7070 }, // U+FB00
+    { 25, 30, 320, -5, 23, 188, 7303 }, // U+FB01
+    { 26, 30, 331, -5, 23, 195, 7491 }, // U+FB02
+    { 34, 30, 472, -5, 23, 255, 7686 }, // U+FB03
+    { 35, 30, 484, -5, 23, 263, 7941 }, // U+FB04
+    { 28, 30, 353, -5, 23, 210, 0 }, // U+FB05
+    { 28, 24, 435, 0, 23, 168, 210 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -3635,8 +3644,7 @@ static const EpdUnicodeInterval notoserif_14_bolditalicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3644,8 +3652,7 @@ static const EpdUnicodeInterval notoserif_14_bolditalicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3655,19 +3662,57 @@ static const EpdUnicodeInterval notoserif_14_bolditalicIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_14_bolditalicGroups[] = {
-    { 0, 4450, 9294, 97, 0 },
-    { 4450, 3715, 10620, 96, 97 },
-    { 8165, 4748, 17524, 128, 193 },
-    { 12913, 4728, 15177, 96, 321 },
-    { 17641, 1471, 2263, 112, 417 },
-    { 19112, 12392, 34429, 256, 529 },
-    { 31504, 2604, 14043, 90, 785 },
-    { 34108, 2415, 5278, 111, 875 },
-    { 36523, 1023, 1573, 42, 986 },
-    { 37546, 2431, 4322, 32, 1028 },
-    { 39977, 14, 12, 1, 1060 },
-    { 39991, 645, 1578, 7, 1061 },
-    { 40636, 132, 196, 1, 1068 },
+    { 0, 4112, 8942, 83, 2 },
+    { 4112, 1001, 1844, 26, 0 },
+    { 5113, 3700, 10500, 95, 97 },
+    { 8813, 4748, 17524, 128, 193 },
+    { 13561, 4728, 15177, 96, 321 },
+    { 18289, 1471, 2263, 112, 417 },
+    { 19760, 12392, 34429, 256, 529 },
+    { 32152, 2604, 14043, 90, 785 },
+    { 34756, 2318, 5106, 105, 875 },
+    { 37074, 1023, 1573, 42, 986 },
+    { 38097, 2431, 4322, 32, 1028 },
+    { 40528, 14, 12, 1, 1060 },
+    { 40542, 230, 378, 2, 1066 },
+    { 40772, 132, 196, 1, 1068 },
+};
+
+static const uint16_t notoserif_14_bolditalicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_14_bolditalicKernLeftClasses[] = {
@@ -4898,18 +4943,81 @@ static const EpdLigaturePair notoserif_14_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_14_bolditalicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 0 }, { 0x0004, 1, 1 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 2 }, { 0x0009, 1, 1 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 3 }, { 0x000C, 4, 4 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 10 }, { 0x0024, 8, 11 }, { 0x0025, 9, 12 }, { 0x0026, 10, 11 }, { 0x0027, 11, 11 }, { 0x0028, 12, 11 }, { 0x0029, 13, 12 }, // U+0040
+    { 0x002A, 0, 11 }, { 0x002B, 0, 11 }, { 0x002C, 14, 11 }, { 0x002D, 15, 11 }, { 0x002E, 16, 11 }, { 0x002F, 0, 11 }, { 0x0030, 17, 11 }, { 0x0031, 10, 12 }, // U+0048
+    { 0x0032, 18, 11 }, { 0x0033, 10, 12 }, { 0x0034, 19, 11 }, { 0x0035, 20, 13 }, { 0x0036, 21, 14 }, { 0x0037, 22, 15 }, { 0x0038, 23, 16 }, { 0x0039, 24, 17 }, // U+0050
+    { 0x003A, 25, 18 }, { 0x003B, 26, 19 }, { 0x003C, 0, 20 }, { 0x003D, 3, 0 }, { 0x003E, 0, 21 }, { 0x003F, 0, 3 }, { 0x0040, 0, 0 }, { 0x0041, 27, 22 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 28, 23 }, { 0x0044, 29, 24 }, { 0x0045, 30, 25 }, { 0x0046, 0, 25 }, { 0x0047, 30, 25 }, { 0x0048, 31, 0 }, { 0x0049, 0, 26 }, // U+0060
+    { 0x004A, 28, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 32, 24 }, { 0x004E, 0, 28 }, { 0x004F, 28, 29 }, { 0x0050, 28, 29 }, { 0x0051, 29, 25 }, // U+0068
+    { 0x0052, 29, 29 }, { 0x0053, 33, 25 }, { 0x0054, 34, 29 }, { 0x0055, 35, 30 }, { 0x0056, 0, 31 }, { 0x0057, 0, 32 }, { 0x0058, 36, 33 }, { 0x0059, 37, 34 }, // U+0070
+    { 0x005A, 0, 35 }, { 0x005B, 38, 36 }, { 0x005C, 39, 37 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 3 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 40, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 38 }, { 0x006B, 0, 0 }, { 0x006C, 41, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 38 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 39 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 42, 0 }, // U+00B8
+    { 0x0081, 43, 10 }, { 0x0082, 43, 10 }, { 0x0083, 43, 10 }, { 0x0084, 43, 10 }, { 0x0085, 43, 10 }, { 0x0086, 43, 10 }, { 0x0087, 11, 40 }, { 0x0088, 9, 12 }, // U+00C0
+    { 0x0089, 11, 11 }, { 0x008A, 11, 11 }, { 0x008B, 11, 11 }, { 0x008C, 11, 11 }, { 0x008D, 0, 11 }, { 0x008E, 0, 11 }, { 0x008F, 0, 11 }, { 0x0090, 0, 11 }, // U+00C8
+    { 0x0091, 10, 11 }, { 0x0092, 17, 11 }, { 0x0093, 10, 12 }, { 0x0094, 10, 12 }, { 0x0095, 10, 12 }, { 0x0096, 10, 12 }, { 0x0097, 10, 12 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 12 }, { 0x009A, 22, 15 }, { 0x009B, 22, 15 }, { 0x009C, 22, 15 }, { 0x009D, 22, 15 }, { 0x009E, 26, 19 }, { 0x009F, 10, 11 }, { 0x00A0, 35, 0 }, // U+00D8
+    { 0x00A1, 28, 23 }, { 0x00A2, 28, 23 }, { 0x00A3, 28, 23 }, { 0x00A4, 28, 23 }, { 0x00A5, 28, 23 }, { 0x00A6, 28, 23 }, { 0x00A7, 30, 23 }, { 0x00A8, 30, 25 }, // U+00E0
+    { 0x00A9, 30, 25 }, { 0x00AA, 30, 25 }, { 0x00AB, 30, 25 }, { 0x00AC, 30, 25 }, { 0x00AD, 0, 27 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 27 }, { 0x00B0, 0, 27 }, // U+00E8
+    { 0x00B1, 29, 25 }, { 0x00B2, 28, 29 }, { 0x00B3, 29, 25 }, { 0x00B4, 29, 25 }, { 0x00B5, 29, 25 }, { 0x00B6, 29, 25 }, { 0x00B7, 29, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 29, 25 }, { 0x00BA, 28, 32 }, { 0x00BB, 28, 32 }, { 0x00BC, 28, 32 }, { 0x00BD, 28, 32 }, { 0x00BE, 38, 36 }, { 0x00BF, 29, 24 }, { 0x00C0, 38, 36 }, // U+00F8
+    { 0x00C1, 7, 10 }, { 0x00C2, 28, 23 }, { 0x00C3, 43, 10 }, { 0x00C4, 28, 23 }, { 0x00C5, 43, 10 }, { 0x00C6, 28, 23 }, { 0x00C7, 9, 12 }, { 0x00C8, 30, 25 }, // U+0100
+    { 0x00C9, 9, 12 }, { 0x00CA, 30, 25 }, { 0x00CB, 9, 12 }, { 0x00CC, 30, 25 }, { 0x00CD, 9, 12 }, { 0x00CE, 30, 25 }, { 0x00CF, 10, 11 }, { 0x00D0, 44, 25 }, // U+0108
+    { 0x00D1, 10, 11 }, { 0x00D2, 0, 25 }, { 0x00D3, 11, 11 }, { 0x00D4, 30, 25 }, { 0x00D5, 11, 11 }, { 0x00D6, 30, 25 }, { 0x00D7, 11, 11 }, { 0x00D8, 30, 25 }, // U+0110
+    { 0x00D9, 11, 11 }, { 0x00DA, 30, 25 }, { 0x00DB, 11, 11 }, { 0x00DC, 30, 25 }, { 0x00DD, 13, 12 }, { 0x00DE, 0, 25 }, { 0x00DF, 13, 12 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 13, 12 }, { 0x00E2, 0, 25 }, { 0x00E3, 13, 12 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 11 }, { 0x00E6, 28, 24 }, { 0x00E7, 0, 11 }, { 0x00E8, 28, 24 }, // U+0120
+    { 0x00E9, 0, 11 }, { 0x00EA, 0, 27 }, { 0x00EB, 0, 11 }, { 0x00EC, 0, 27 }, { 0x00ED, 0, 11 }, { 0x00EE, 0, 27 }, { 0x00EF, 0, 11 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 11 }, { 0x00F2, 0, 0 }, { 0x00F3, 14, 11 }, { 0x00F4, 0, 27 }, { 0x00F5, 14, 11 }, { 0x00F6, 0, 0 }, { 0x00F7, 15, 11 }, { 0x00F8, 32, 24 }, // U+0130
+    { 0x00F9, 32, 29 }, { 0x00FA, 16, 11 }, { 0x00FB, 0, 28 }, { 0x00FC, 16, 11 }, { 0x00FD, 0, 28 }, { 0x00FE, 45, 11 }, { 0x00FF, 44, 28 }, { 0x0100, 0, 11 }, // U+0138
+    { 0x0101, 0, 28 }, { 0x0102, 16, 11 }, { 0x0103, 0, 28 }, { 0x0104, 17, 11 }, { 0x0105, 28, 29 }, { 0x0106, 17, 11 }, { 0x0107, 28, 29 }, { 0x0108, 17, 11 }, // U+0140
+    { 0x0109, 28, 29 }, { 0x010A, 28, 41 }, { 0x010B, 14, 11 }, { 0x010C, 28, 29 }, { 0x010D, 10, 12 }, { 0x010E, 29, 25 }, { 0x010F, 10, 12 }, { 0x0110, 29, 25 }, // U+0148
+    { 0x0111, 10, 12 }, { 0x0112, 29, 25 }, { 0x0113, 11, 12 }, { 0x0114, 30, 25 }, { 0x0115, 19, 11 }, { 0x0116, 34, 29 }, { 0x0117, 19, 11 }, { 0x0118, 34, 29 }, // U+0150
+    { 0x0119, 19, 11 }, { 0x011A, 34, 29 }, { 0x011B, 20, 13 }, { 0x011C, 35, 30 }, { 0x011D, 20, 13 }, { 0x011E, 35, 30 }, { 0x011F, 20, 13 }, { 0x0120, 35, 30 }, // U+0158
+    { 0x0121, 20, 13 }, { 0x0122, 35, 30 }, { 0x0123, 21, 0 }, { 0x0124, 0, 31 }, { 0x0125, 21, 0 }, { 0x0126, 0, 31 }, { 0x0127, 21, 0 }, { 0x0128, 0, 31 }, // U+0160
+    { 0x0129, 22, 15 }, { 0x012A, 28, 32 }, { 0x012B, 22, 15 }, { 0x012C, 28, 32 }, { 0x012D, 22, 15 }, { 0x012E, 28, 32 }, { 0x012F, 22, 15 }, { 0x0130, 28, 32 }, // U+0168
+    { 0x0131, 22, 15 }, { 0x0132, 28, 32 }, { 0x0133, 22, 15 }, { 0x0134, 28, 32 }, { 0x0135, 24, 17 }, { 0x0136, 37, 34 }, { 0x0137, 26, 19 }, { 0x0138, 38, 36 }, // U+0170
+    { 0x0139, 26, 19 }, { 0x013A, 0, 20 }, { 0x013B, 39, 37 }, { 0x013C, 0, 20 }, { 0x013D, 39, 37 }, { 0x013E, 0, 20 }, { 0x013F, 39, 37 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 50, 42 }, { 0x0212, 50, 42 }, { 0x0213, 51, 43 }, { 0x0214, 52, 42 }, { 0x0215, 53, 44 }, { 0x0216, 54, 45 }, { 0x0217, 55, 42 }, { 0x0218, 55, 42 }, // U+0400
+    { 0x0219, 56, 46 }, { 0x021A, 57, 47 }, { 0x021B, 57, 42 }, { 0x021C, 58, 43 }, { 0x021D, 59, 42 }, { 0x021E, 55, 42 }, { 0x021F, 60, 48 }, { 0x0220, 55, 42 }, // U+0408
+    { 0x0221, 61, 49 }, { 0x0222, 62, 42 }, { 0x0223, 63, 42 }, { 0x0224, 52, 42 }, { 0x0225, 64, 50 }, { 0x0226, 50, 42 }, { 0x0227, 59, 51 }, { 0x0228, 63, 52 }, // U+0410
+    { 0x0229, 55, 42 }, { 0x022A, 55, 42 }, { 0x022B, 59, 42 }, { 0x022C, 55, 47 }, { 0x022D, 55, 42 }, { 0x022E, 55, 42 }, { 0x022F, 65, 44 }, { 0x0230, 55, 42 }, // U+0418
+    { 0x0231, 66, 42 }, { 0x0232, 53, 44 }, { 0x0233, 52, 43 }, { 0x0234, 60, 48 }, { 0x0235, 67, 53 }, { 0x0236, 68, 54 }, { 0x0237, 64, 42 }, { 0x0238, 55, 55 }, // U+0420
+    { 0x0239, 55, 42 }, { 0x023A, 64, 42 }, { 0x023B, 57, 43 }, { 0x023C, 55, 42 }, { 0x023D, 57, 42 }, { 0x023E, 65, 52 }, { 0x023F, 65, 42 }, { 0x0240, 55, 56 }, // U+0428
+    { 0x0241, 69, 57 }, { 0x0242, 70, 58 }, { 0x0243, 71, 57 }, { 0x0244, 72, 59 }, { 0x0245, 73, 60 }, { 0x0246, 74, 57 }, { 0x0247, 75, 61 }, { 0x0248, 71, 62 }, // U+0430
+    { 0x0249, 69, 63 }, { 0x024A, 69, 63 }, { 0x024B, 76, 64 }, { 0x024C, 69, 65 }, { 0x024D, 69, 65 }, { 0x024E, 69, 64 }, { 0x024F, 77, 57 }, { 0x0250, 78, 64 }, // U+0438
+    { 0x0251, 77, 66 }, { 0x0252, 79, 57 }, { 0x0253, 78, 64 }, { 0x0254, 80, 67 }, { 0x0255, 77, 57 }, { 0x0256, 76, 68 }, { 0x0257, 81, 63 }, { 0x0258, 69, 69 }, // U+0440
+    { 0x0259, 69, 63 }, { 0x025A, 81, 63 }, { 0x025B, 82, 70 }, { 0x025C, 69, 63 }, { 0x025D, 82, 63 }, { 0x025E, 77, 61 }, { 0x025F, 77, 64 }, { 0x0260, 69, 71 }, // U+0448
+    { 0x0261, 74, 57 }, { 0x0262, 74, 57 }, { 0x0263, 83, 72 }, { 0x0264, 72, 59 }, { 0x0265, 79, 57 }, { 0x0266, 84, 73 }, { 0x0267, 69, 74 }, { 0x0268, 85, 75 }, // U+0450
+    { 0x0269, 86, 76 }, { 0x026A, 82, 65 }, { 0x026B, 82, 64 }, { 0x026C, 78, 72 }, { 0x026D, 76, 64 }, { 0x026E, 69, 63 }, { 0x026F, 80, 67 }, { 0x0270, 69, 63 }, // U+0458
+};
+
 static const EpdFontData notoserif_14_bolditalic = {
     notoserif_14_bolditalicBitmaps,
     notoserif_14_bolditalicGlyphs,
     notoserif_14_bolditalicIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notoserif_14_bolditalicGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_14_bolditalicGlyphToGroup,
     notoserif_14_bolditalicKernLeftClasses,
     notoserif_14_bolditalicKernRightClasses,
     notoserif_14_bolditalicKernMatrix,
@@ -4919,4 +5027,8 @@ static const EpdFontData notoserif_14_bolditalic = {
     90,
     notoserif_14_bolditalicLigaturePairs,
     5,
+    notoserif_14_bolditalicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2401 +3,2408 @@
  * name: notoserif_14_italic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_14_italic 14 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_14_italic 14 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_14_italicBitmaps[38212] = {
-    0xAD, 0x59, 0x3D, 0x8C, 0xE4, 0x66, 0x19, 0x7E, 0x6D, 0x27, 0x6B, 0x14, 0xC3, 0xF9, 0x8A, 0x1C,
-    0x87, 0xB2, 0xDC, 0x39, 0x05, 0x05, 0x3A, 0xF6, 0xCE, 0x14, 0x57, 0xAC, 0xD0, 0xEC, 0xD8, 0x90,
-    0x82, 0x22, 0x05, 0x29, 0x72, 0x41, 0x02, 0x21, 0x28, 0x28, 0x50, 0x90, 0xD8, 0x14, 0x5B, 0x9C,
-    0xE0, 0x76, 0x6C, 0xE5, 0x24, 0x1A, 0x0A, 0x0E, 0x89, 0xA4, 0xA0, 0x21, 0x45, 0x8A, 0xB0, 0x41,
-    0xEC, 0x08, 0x1D, 0xD2, 0x16, 0xF3, 0x63, 0x88, 0xA8, 0x10, 0xC2, 0xFC, 0x1C, 0x48, 0x08, 0x81,
-    0x05, 0x09, 0x88, 0x0B, 0x3F, 0x46, 0x31, 0x8A, 0x77, 0xE3, 0x59, 0xF3, 0x3C, 0xEF, 0xE7, 0x99,
-    0x9D, 0xDD, 0xDC, 0x1E, 0x91, 0x60, 0x76, 0xFC, 0x79, 0xD6, 0xF6, 0xF7, 0x7D, 0xEF, 0xEF, 0xF3,
-    0x3E, 0xDF, 0x67, 0x89, 0x44, 0x12, 0x91, 0x89, 0xC8, 0x58, 0xA4, 0xD1, 0x6F, 0x25, 0x56, 0xC9,
-    0xAF, 0x5D, 0x88, 0x9D, 0x8B, 0x93, 0xE9, 0x37, 0x15, 0x37, 0x16, 0xF3, 0x79, 0x48, 0x24, 0x8A,
-    0xF5, 0xAB, 0xFF, 0x86, 0x8F, 0x15, 0xA1, 0x53, 0xF4, 0xDD, 0x6C, 0xC3, 0xCD, 0x7A, 0x6E, 0xBA,
-    0xEE, 0xC9, 0x55, 0x4F, 0x6F, 0x58, 0xF9, 0xFB, 0x45, 0xEC, 0xAC, 0x27, 0x18, 0x60, 0x1D, 0x4D,
-    0xBA, 0x25, 0xE2, 0xC9, 0x50, 0xC4, 0x97, 0x52, 0xDC, 0xB6, 0x6D, 0xE3, 0x95, 0xC9, 0xCB, 0x77,
-    0x45, 0xD6, 0x30, 0xBE, 0xF4, 0x30, 0x83, 0x6C, 0x71, 0x8E, 0x21, 0x7B, 0x97, 0x67, 0x44, 0x2E,
-    0x1D, 0xEC, 0xBE, 0x28, 0x49, 0xDB, 0xD6, 0xE8, 0xDF, 0xEB, 0xFA, 0xBB, 0xF1, 0x90, 0x83, 0x94,
-    0x1C, 0xA4, 0x10, 0x39, 0x63, 0xE5, 0x9D, 0x50, 0x82, 0x0E, 0xF2, 0x1E, 0xCC, 0xD7, 0x16, 0x12,
-    0x7C, 0xAF, 0x91, 0xED, 0xB5, 0x6D, 0x69, 0xD6, 0x37, 0xA4, 0xBE, 0xBA, 0x2E, 0xF5, 0x33, 0xD0,
-    0x0B, 0xFD, 0xA6, 0xE8, 0x16, 0xE1, 0xF0, 0x0E, 0x21, 0x5C, 0x9B, 0x8A, 0xFD, 0xB3, 0xE2, 0x01,
-    0xE7, 0x66, 0xD9, 0x73, 0x1E, 0xD3, 0xA3, 0xEF, 0x3A, 0x79, 0xF4, 0xB8, 0x9F, 0xF9, 0xED, 0x44,
-    0xAC, 0x29, 0x46, 0x87, 0xF8, 0x7A, 0xAC, 0xC9, 0xF2, 0x27, 0xC9, 0x21, 0x80, 0x5D, 0x94, 0x72,
-    0x51, 0xDC, 0x6C, 0x4F, 0x7A, 0xE2, 0xC7, 0x23, 0xD8, 0x2C, 0x90, 0x11, 0x0C, 0x76, 0x45, 0x46,
-    0xD0, 0x06, 0xD3, 0xFA, 0x82, 0xB6, 0xBA, 0x0C, 0xC5, 0xAC, 0xF2, 0xFA, 0xCA, 0xAD, 0x0D, 0x74,
-    0x18, 0x8C, 0x2E, 0xBB, 0x3F, 0xCA, 0xCB, 0x0D, 0x7F, 0xD3, 0xBD, 0x99, 0x5F, 0xB1, 0x5F, 0xF5,
-    0xDD, 0x2C, 0xC4, 0x53, 0x5E, 0x8A, 0x76, 0xCF, 0x8F, 0xFB, 0xB0, 0xB9, 0x1F, 0x6F, 0x40, 0x59,
-    0x5F, 0x6E, 0x88, 0x17, 0xFB, 0xB2, 0x87, 0x41, 0xFD, 0xB8, 0xC4, 0x14, 0xDE, 0xCD, 0x1C, 0x53,
-    0xD8, 0x6D, 0x7C, 0x4C, 0x12, 0xEA, 0x0A, 0x43, 0xBC, 0xD6, 0xD0, 0x0B, 0xD2, 0x47, 0xDB, 0x57,
-    0x9F, 0xCC, 0x5B, 0x5E, 0x89, 0x44, 0xEF, 0x3E, 0xAE, 0x4F, 0x1E, 0xCA, 0xB5, 0x58, 0xC2, 0x12,
-    0xBA, 0xDB, 0x6F, 0x55, 0x76, 0x25, 0xFE, 0x0F, 0x1B, 0x48, 0x1B, 0xC9, 0xD4, 0x4D, 0xE1, 0xFE,
-    0xE8, 0x6B, 0x74, 0xBF, 0xFF, 0x7B, 0xB6, 0xAE, 0x86, 0x82, 0x8D, 0x76, 0x24, 0xD6, 0x8C, 0x21,
-    0xE2, 0xB6, 0x18, 0xE6, 0xB5, 0x49, 0xF0, 0x2B, 0xFC, 0xAA, 0x3C, 0xDC, 0x78, 0x58, 0x9D, 0x8F,
-    0xDE, 0x7D, 0x08, 0xD8, 0x93, 0x75, 0x79, 0x66, 0x2E, 0xD7, 0x17, 0xC4, 0x2E, 0xC5, 0x4F, 0x39,
-    0x7F, 0xC3, 0x9F, 0x6E, 0x21, 0x7E, 0xC6, 0x6F, 0xA8, 0x31, 0x83, 0xEF, 0x40, 0xC3, 0x6D, 0x34,
-    0x8F, 0xB8, 0x91, 0x7E, 0x6F, 0xD0, 0x64, 0xEC, 0x14, 0xC0, 0x45, 0x29, 0xC3, 0x4F, 0x9E, 0x10,
-    0x79, 0x17, 0xE4, 0x8E, 0xC5, 0xC9, 0x19, 0x91, 0xB0, 0x01, 0x8C, 0xD2, 0x3D, 0xBE, 0xF8, 0x36,
-    0xDD, 0xD7, 0xAA, 0x05, 0x3A, 0x39, 0xF3, 0xF9, 0x82, 0x94, 0x33, 0x8D, 0xC5, 0xAA, 0xC4, 0xCD,
-    0x21, 0xA8, 0x7C, 0xBE, 0x13, 0xCF, 0xCB, 0xE4, 0x3D, 0x1E, 0xEC, 0xF0, 0x38, 0x7E, 0xFE, 0x16,
-    0x3F, 0x26, 0x6D, 0xFA, 0x74, 0xFB, 0x9C, 0x24, 0xBB, 0xB9, 0x5C, 0x5D, 0x83, 0xAE, 0x3D, 0x74,
-    0xBB, 0xFE, 0x6E, 0x1C, 0x47, 0xF1, 0x2E, 0xDE, 0xF1, 0xE3, 0xDC, 0x67, 0xAF, 0xC5, 0x51, 0xDB,
-    0xE6, 0x3C, 0x9F, 0xBC, 0xC7, 0xE3, 0xA1, 0x38, 0xCC, 0xC2, 0xDC, 0xCB, 0x9D, 0xCC, 0x49, 0x03,
-    0xB9, 0x6D, 0xC6, 0x89, 0xDA, 0x38, 0x69, 0xCD, 0x80, 0x51, 0x8C, 0xBF, 0x23, 0x47, 0x42, 0x33,
-    0x64, 0x1A, 0xF3, 0x4C, 0xB3, 0x0C, 0xB1, 0x23, 0x17, 0x70, 0x20, 0xE8, 0x55, 0x08, 0xDC, 0x66,
-    0xB0, 0xDB, 0x19, 0x93, 0xC0, 0xCC, 0xC1, 0x68, 0xBF, 0xDC, 0x3D, 0x72, 0xDB, 0x3C, 0x62, 0x9D,
-    0x18, 0xE1, 0x62, 0x77, 0x1B, 0xA9, 0x27, 0x9F, 0x9B, 0xCF, 0xC4, 0xD0, 0x1F, 0x6C, 0x66, 0x56,
-    0xE5, 0x14, 0x4E, 0x61, 0x97, 0x1E, 0x7E, 0xF9, 0xA9, 0x55, 0x05, 0xB0, 0x52, 0x84, 0x03, 0x31,
-    0x58, 0x0D, 0x60, 0xC5, 0x31, 0xDC, 0x36, 0x82, 0x29, 0x1B, 0x71, 0x0A, 0x04, 0x43, 0xDE, 0xC0,
-    0x68, 0x08, 0x8D, 0x74, 0x04, 0xDF, 0x6C, 0x6B, 0x64, 0xE1, 0xD7, 0xF3, 0xCC, 0xE2, 0x74, 0x11,
-    0x08, 0x22, 0x87, 0x3A, 0xBE, 0x35, 0x1E, 0x8B, 0x53, 0xC1, 0x23, 0x31, 0x0E, 0xF8, 0x84, 0x0E,
-    0x60, 0x14, 0xD0, 0x33, 0x7A, 0xC0, 0x3D, 0xE2, 0x41, 0x58, 0xF8, 0x68, 0x71, 0xC0, 0x59, 0x8C,
-    0x0E, 0x7A, 0xCC, 0x6A, 0x6F, 0xC1, 0x54, 0x87, 0x46, 0xDE, 0x15, 0x84, 0x78, 0xF8, 0x7C, 0x03,
-    0x7C, 0x9A, 0xC0, 0xC3, 0x11, 0x02, 0x20, 0x92, 0x47, 0x35, 0xB0, 0xB7, 0x71, 0x70, 0xF0, 0xD2,
-    0x68, 0xED, 0x77, 0xDA, 0x72, 0xFC, 0x4C, 0x43, 0x88, 0xA6, 0x43, 0x0C, 0x7D, 0x18, 0xA1, 0x34,
-    0xBC, 0x72, 0xED, 0xA9, 0x82, 0xFE, 0x02, 0x9A, 0xE4, 0x4B, 0xB9, 0x13, 0xDE, 0x69, 0x18, 0xDA,
-    0x09, 0xC3, 0x28, 0xEA, 0x9A, 0x0F, 0x18, 0x58, 0xE3, 0xF0, 0x9A, 0x3A, 0x94, 0x76, 0x65, 0x12,
-    0x53, 0x35, 0x66, 0x5F, 0xC0, 0xFE, 0xD4, 0x82, 0xB1, 0x66, 0xF4, 0x13, 0xBB, 0x06, 0x4C, 0xE0,
-    0xDF, 0x0D, 0xDE, 0x88, 0xC4, 0x47, 0xB4, 0xDD, 0x99, 0x22, 0x2E, 0x5A, 0xDE, 0x3C, 0x67, 0xE6,
-    0xE3, 0x78, 0x4C, 0x24, 0x71, 0x38, 0xA8, 0xCF, 0xA6, 0xC7, 0xDB, 0x3F, 0xA0, 0x71, 0x7E, 0x81,
-    0xC6, 0xBD, 0x89, 0x41, 0x2F, 0x72, 0xE4, 0x9E, 0x83, 0x29, 0x4B, 0x97, 0xD0, 0x8B, 0x50, 0x05,
-    0x10, 0x64, 0x72, 0xE5, 0xDA, 0x67, 0xEF, 0xC0, 0x28, 0x6D, 0x2B, 0xE7, 0xAE, 0x6D, 0x3E, 0xD7,
-    0x99, 0xDB, 0x08, 0xCA, 0xC6, 0x22, 0x30, 0x44, 0x2D, 0x46, 0x09, 0xDA, 0x99, 0x84, 0x38, 0xFA,
-    0x3B, 0x23, 0xB9, 0x0A, 0xA9, 0x9E, 0x81, 0x77, 0x98, 0xFA, 0x90, 0xDA, 0x82, 0x59, 0xEC, 0x1F,
-    0x23, 0x95, 0x70, 0xDB, 0xBE, 0x95, 0xA4, 0xC6, 0xF0, 0x74, 0x04, 0x55, 0x34, 0x4E, 0x39, 0x8B,
-    0x6B, 0x7B, 0xEA, 0xE7, 0x48, 0x92, 0xA7, 0x1A, 0x0C, 0x97, 0x6B, 0x12, 0x1A, 0x3C, 0x87, 0xC9,
-    0x7C, 0x58, 0x8C, 0xCE, 0x6F, 0xE4, 0x06, 0x5C, 0xFA, 0xA8, 0xF6, 0x9A, 0xBB, 0xF0, 0xAB, 0x2F,
-    0x4A, 0x38, 0x3D, 0x94, 0x28, 0x0F, 0x53, 0x18, 0x21, 0xEB, 0x63, 0x3C, 0x1E, 0x1B, 0xE6, 0xC8,
-    0x36, 0xF4, 0x5A, 0x10, 0x07, 0x18, 0xDB, 0xFB, 0x75, 0xA3, 0xC3, 0xC9, 0x03, 0xE8, 0x0B, 0x84,
-    0x0F, 0xDA, 0xB6, 0xBA, 0xB2, 0xF3, 0x72, 0xB9, 0x8E, 0x44, 0xFF, 0x30, 0x9E, 0x3B, 0xAB, 0x0E,
-    0xA4, 0x9B, 0x91, 0xDF, 0xD2, 0xC5, 0x8F, 0xDB, 0xC5, 0xCC, 0x89, 0x5B, 0xCE, 0xD2, 0xAD, 0xB0,
-    0xBB, 0x65, 0x62, 0x1D, 0xC2, 0x47, 0xCF, 0xD7, 0x90, 0x75, 0x84, 0x10, 0xDC, 0xC0, 0x10, 0x7D,
-    0x3C, 0xBB, 0x01, 0x47, 0x8D, 0xAC, 0x06, 0x57, 0x5A, 0x48, 0x1E, 0xC1, 0x25, 0x01, 0xEC, 0x51,
-    0x4F, 0x53, 0x3F, 0x0B, 0xF2, 0x48, 0xDC, 0x72, 0x1B, 0x23, 0x8E, 0x34, 0xFE, 0xED, 0x12, 0x91,
-    0x5C, 0x42, 0x5A, 0xDC, 0x49, 0x62, 0x9B, 0xEE, 0x7C, 0xB0, 0x1B, 0x3B, 0x40, 0x7C, 0x4E, 0x77,
-    0x33, 0xA7, 0x72, 0x99, 0xE5, 0xA5, 0x9F, 0xD9, 0x65, 0x10, 0xDB, 0x65, 0x88, 0x3E, 0x91, 0x1E,
-    0x0E, 0x7E, 0x7B, 0x65, 0x90, 0x86, 0x85, 0x77, 0xD0, 0xE6, 0x56, 0xFB, 0x89, 0xCE, 0x4A, 0x5D,
-    0x90, 0x23, 0x1E, 0x86, 0x08, 0xDF, 0x12, 0x02, 0xCD, 0x02, 0x23, 0x86, 0x15, 0x2B, 0x74, 0x36,
-    0x56, 0xC3, 0xB8, 0x3E, 0xFE, 0x01, 0x62, 0xA4, 0xF8, 0xE3, 0xCF, 0x47, 0xB4, 0x7F, 0xB2, 0xA4,
-    0xE7, 0xDB, 0x3E, 0x2B, 0xA9, 0xF8, 0x25, 0xBF, 0x34, 0x4D, 0x41, 0xC7, 0x03, 0xE5, 0xD6, 0x97,
-    0x0B, 0x07, 0xCC, 0x15, 0x66, 0x1A, 0x8F, 0x88, 0x67, 0x3D, 0x15, 0x46, 0x2C, 0x86, 0xB7, 0x86,
-    0x69, 0x98, 0x6B, 0x5C, 0xE3, 0x07, 0x02, 0xC5, 0x61, 0xD0, 0x3F, 0x61, 0x30, 0xAC, 0xCD, 0x2F,
-    0xED, 0xEC, 0xA4, 0xCB, 0xD3, 0x9D, 0xBB, 0xD6, 0x81, 0x21, 0xCE, 0x67, 0x45, 0x41, 0x5C, 0x7B,
-    0x69, 0xF7, 0x08, 0x3F, 0x5C, 0xFE, 0x48, 0x62, 0x13, 0x6C, 0xB8, 0xC0, 0x1B, 0x78, 0xC0, 0x36,
-    0xD3, 0xEB, 0xF3, 0x67, 0x97, 0x4A, 0x9A, 0xFF, 0x6B, 0x66, 0x7A, 0x84, 0xEB, 0x11, 0x52, 0x3A,
-    0x44, 0x8C, 0x84, 0x5D, 0x9C, 0x8F, 0x4D, 0xC2, 0x71, 0x98, 0x89, 0x26, 0xB7, 0xA6, 0x3E, 0x31,
-    0xD1, 0x8D, 0x97, 0x8D, 0x65, 0xA6, 0xD5, 0xE3, 0xC8, 0x28, 0xD3, 0x5B, 0x5A, 0xBD, 0xEF, 0x12,
-    0x82, 0xDD, 0x4A, 0x07, 0x21, 0xEA, 0x54, 0x26, 0x37, 0x7B, 0x84, 0xA9, 0x27, 0x01, 0x9A, 0x4E,
-    0x81, 0xBC, 0xF5, 0x01, 0x22, 0x91, 0x55, 0x79, 0xAC, 0xED, 0x56, 0xE9, 0xC5, 0x81, 0x55, 0xDB,
-    0xA5, 0x1B, 0x5F, 0xB1, 0x4B, 0x9E, 0x36, 0x9C, 0x12, 0x4F, 0xC9, 0x06, 0x30, 0x34, 0xF7, 0xA4,
-    0xE7, 0xE6, 0x2E, 0x4A, 0x36, 0x4E, 0x5E, 0x76, 0x81, 0xC9, 0xEB, 0x83, 0xAD, 0xE0, 0x91, 0x2B,
-    0xF9, 0x6D, 0xF8, 0xA8, 0x2D, 0x89, 0x60, 0xF2, 0x48, 0x7A, 0x29, 0x66, 0x1D, 0xEB, 0xEA, 0x0F,
-    0x3F, 0xCC, 0x72, 0x86, 0x13, 0xAC, 0xF0, 0x25, 0x5A, 0xEC, 0xB5, 0x4F, 0x2B, 0xAA, 0xCC, 0x91,
-    0xAF, 0xFB, 0x98, 0x3E, 0x91, 0x1A, 0x3C, 0xD1, 0xB6, 0x65, 0x77, 0xFB, 0x0F, 0x6C, 0x9D, 0x9F,
-    0xB0, 0xF5, 0xA8, 0x8A, 0x5C, 0x64, 0x0E, 0x40, 0x0A, 0x66, 0xFB, 0x16, 0xC7, 0xD6, 0xE0, 0x82,
-    0xAB, 0x15, 0x76, 0xEF, 0x7C, 0xB2, 0xD4, 0x4C, 0xAB, 0x58, 0x17, 0x08, 0xC8, 0x3D, 0xB5, 0xE4,
-    0x6D, 0xC5, 0xB8, 0x92, 0x2D, 0xBB, 0x34, 0xB2, 0x5A, 0xC9, 0xCA, 0x61, 0xCC, 0x2C, 0xC6, 0x34,
-    0x51, 0xBB, 0x2F, 0xB2, 0x7A, 0x00, 0x2A, 0x04, 0x85, 0xC1, 0xC2, 0x4A, 0x84, 0x26, 0xC6, 0x6F,
-    0x68, 0xBB, 0x86, 0xD1, 0xCC, 0x86, 0x34, 0x22, 0xF5, 0x40, 0xBA, 0xEE, 0x42, 0xF0, 0x90, 0xD2,
-    0x47, 0xC2, 0x88, 0x16, 0x5C, 0x1B, 0x20, 0x9D, 0x84, 0xF9, 0x04, 0xCF, 0xE1, 0x57, 0xC3, 0x6B,
-    0xEC, 0x83, 0xA9, 0xA3, 0xF4, 0xFC, 0xFE, 0xA7, 0x66, 0x32, 0x6D, 0xDB, 0x5B, 0x73, 0x55, 0x37,
-    0xD1, 0xD7, 0xDD, 0xDF, 0x04, 0x7A, 0xA6, 0x5E, 0x09, 0x07, 0x3B, 0x25, 0x02, 0xC5, 0xA1, 0xFC,
-    0x16, 0x31, 0x55, 0x38, 0xAC, 0x89, 0x2C, 0x92, 0xCF, 0xCE, 0xB7, 0xC9, 0xA2, 0x19, 0x2C, 0x9A,
-    0x64, 0x01, 0x8E, 0x78, 0xF8, 0x7D, 0xE2, 0x17, 0xD0, 0xD3, 0x39, 0xDC, 0x85, 0x9A, 0x09, 0xEB,
-    0x95, 0x46, 0x72, 0xD4, 0x1E, 0xC4, 0x54, 0x6E, 0x57, 0x11, 0x84, 0x21, 0xAF, 0xD8, 0x4D, 0xFD,
-    0xD0, 0x09, 0x0A, 0x1A, 0xC6, 0x72, 0xE2, 0x8B, 0x80, 0x31, 0x34, 0xC6, 0xA7, 0x86, 0x46, 0x4F,
-    0x3E, 0x3F, 0x50, 0x91, 0xB6, 0x75, 0xEA, 0xB1, 0xBA, 0xB4, 0xD1, 0x28, 0x87, 0xC6, 0x25, 0x0D,
-    0x1D, 0x65, 0x72, 0x7E, 0xFF, 0x8B, 0xB8, 0xDC, 0xE9, 0x8B, 0x74, 0x99, 0x49, 0x70, 0xB0, 0x33,
-    0xE3, 0xAC, 0x3D, 0xD3, 0x60, 0xE6, 0x75, 0x4E, 0x7C, 0x56, 0x71, 0x62, 0xA9, 0x09, 0xEE, 0x7E,
-    0x47, 0x14, 0xD4, 0x8F, 0x00, 0xDF, 0xE8, 0xA9, 0x35, 0x6A, 0x6C, 0x0A, 0x95, 0x45, 0x6F, 0x38,
-    0xB4, 0xAC, 0x07, 0xCB, 0x5E, 0x4B, 0xE2, 0x29, 0xAB, 0x85, 0x99, 0x68, 0xF5, 0x1D, 0x4C, 0x44,
-    0xBB, 0x30, 0x1D, 0xBA, 0x89, 0x9E, 0x7B, 0xF2, 0xB4, 0x89, 0xBA, 0x46, 0x0B, 0xDF, 0x79, 0x22,
-    0xC5, 0x54, 0x59, 0x68, 0xE7, 0x42, 0x68, 0xE7, 0x1E, 0x6C, 0xD6, 0x40, 0x17, 0x87, 0x45, 0x5B,
-    0x1A, 0x5A, 0xA1, 0x66, 0x08, 0xC6, 0xF7, 0x71, 0xA1, 0xB5, 0xF3, 0x12, 0x9A, 0x69, 0x3D, 0xE0,
-    0x03, 0x6C, 0xD2, 0x84, 0x48, 0xA9, 0x5C, 0x31, 0x24, 0x8D, 0x83, 0x0B, 0xFB, 0x70, 0xE1, 0x53,
-    0x64, 0xA2, 0xED, 0xAB, 0x0B, 0x17, 0x66, 0x21, 0xE6, 0x5E, 0x3D, 0x8C, 0xF1, 0xA5, 0x6A, 0x9C,
-    0x8B, 0x27, 0xC3, 0x31, 0x38, 0x29, 0xB4, 0xE4, 0x09, 0x2A, 0x32, 0x2F, 0x70, 0xEA, 0x78, 0x87,
-    0x96, 0x91, 0xBB, 0x3B, 0xBB, 0x04, 0x64, 0xD8, 0x29, 0x53, 0x49, 0x02, 0x83, 0x17, 0x44, 0xE8,
-    0xC1, 0x1C, 0xA4, 0xE7, 0xB0, 0x33, 0x30, 0x6A, 0x6F, 0x9B, 0x53, 0x87, 0x43, 0x8D, 0x5A, 0xC0,
-    0xC5, 0xE4, 0xD3, 0x36, 0x8B, 0x58, 0x2A, 0x99, 0x35, 0x9D, 0x30, 0xEF, 0x84, 0xEA, 0xE8, 0x31,
-    0xE8, 0x0C, 0x3C, 0xEE, 0x2C, 0xDB, 0xB1, 0xA6, 0xF3, 0x1A, 0x2D, 0x34, 0x57, 0xC2, 0x36, 0x20,
-    0xFB, 0x50, 0xDE, 0xA1, 0x19, 0xAE, 0xC9, 0xEE, 0x9D, 0x88, 0x13, 0x75, 0x5F, 0xBC, 0x4C, 0x0C,
-    0x4C, 0x91, 0x18, 0x9C, 0xE2, 0x3E, 0xE2, 0x80, 0x5A, 0xCB, 0x0C, 0x7C, 0x34, 0xFA, 0xD1, 0xC0,
-    0x44, 0xDE, 0x73, 0xF4, 0x72, 0x52, 0x18, 0xF8, 0xCF, 0x92, 0x86, 0x1A, 0x86, 0x4A, 0xB4, 0x03,
-    0xD5, 0xF4, 0x06, 0x7B, 0x59, 0x6A, 0x6D, 0x57, 0x75, 0xBC, 0xA8, 0xBD, 0xF7, 0xD8, 0x3E, 0xCB,
-    0x6E, 0xC1, 0xE3, 0x94, 0x36, 0x4C, 0x38, 0x7E, 0xF4, 0xA6, 0xB6, 0xCF, 0x72, 0xFE, 0x81, 0xD5,
-    0xA8, 0xEE, 0x33, 0x15, 0x6F, 0xAA, 0xA2, 0x31, 0x2C, 0x1A, 0x3A, 0x1D, 0x12, 0x22, 0x58, 0x60,
-    0x05, 0xBF, 0xA2, 0x1D, 0x58, 0x2C, 0x68, 0x5D, 0x35, 0xEF, 0xDB, 0xE4, 0xCD, 0x8F, 0x19, 0xE2,
-    0x54, 0x6B, 0xCC, 0x83, 0x39, 0xA6, 0x35, 0x88, 0x61, 0xF6, 0xC9, 0xAC, 0x49, 0x4C, 0xD6, 0xCC,
-    0x4C, 0x25, 0x5A, 0x25, 0x22, 0xB5, 0x4F, 0x80, 0x32, 0x19, 0xCA, 0xE6, 0x40, 0xC6, 0x8B, 0xE4,
-    0x6A, 0x08, 0xCF, 0x8F, 0xE0, 0xEC, 0xC1, 0x3C, 0xDF, 0x67, 0x7C, 0xC1, 0x10, 0x7F, 0xD2, 0x73,
-    0xEA, 0xBC, 0xC2, 0x65, 0xA9, 0x9F, 0xBA, 0x1F, 0x87, 0x4C, 0x17, 0xB0, 0x98, 0xA4, 0x2D, 0xD7,
-    0xFC, 0xEC, 0x02, 0x85, 0xEA, 0x79, 0xD9, 0x3A, 0xCF, 0xEB, 0x5E, 0x3E, 0x64, 0xC6, 0x5D, 0x77,
-    0xF3, 0x02, 0x5D, 0xB1, 0xEE, 0xFD, 0x13, 0x97, 0x82, 0x32, 0x74, 0xFE, 0xA2, 0xCB, 0x82, 0x12,
-    0x13, 0xD2, 0x73, 0x85, 0x33, 0xA3, 0xCC, 0x56, 0x81, 0xC8, 0x1E, 0xB3, 0x6A, 0xD9, 0x25, 0xA9,
-    0x5E, 0xD2, 0x5A, 0x85, 0xCF, 0xAC, 0xC3, 0x62, 0xD6, 0x67, 0xC4, 0xD5, 0x04, 0x6D, 0x65, 0x96,
-    0x8C, 0xBB, 0x43, 0x5D, 0x2D, 0xB8, 0x53, 0x5D, 0x11, 0x78, 0x61, 0xCC, 0x75, 0x83, 0x1F, 0x64,
-    0xCA, 0x92, 0xFD, 0x9C, 0xA7, 0x33, 0x6E, 0xC9, 0xA2, 0x79, 0xC1, 0x29, 0x59, 0x37, 0xD7, 0xEC,
-    0xDA, 0xD3, 0x0A, 0xD8, 0xF8, 0xBA, 0x5C, 0x98, 0xF8, 0x4A, 0x9E, 0x23, 0xBA, 0x71, 0x4B, 0xA2,
-    0xCF, 0x50, 0x30, 0x09, 0xFE, 0xA6, 0xE4, 0x5A, 0x89, 0x6B, 0xA1, 0x15, 0xDD, 0x42, 0x8A, 0xC1,
-    0x06, 0xE7, 0x2B, 0x65, 0xC2, 0x5C, 0xD9, 0x94, 0x47, 0x6B, 0xE4, 0x99, 0x42, 0x39, 0xA0, 0x32,
-    0x55, 0xF0, 0xB7, 0x14, 0x07, 0x1A, 0x7A, 0x6C, 0x42, 0x1C, 0x18, 0x10, 0x07, 0x06, 0xC4, 0x81,
-    0x09, 0x1D, 0x3E, 0xA1, 0xD2, 0x33, 0xC2, 0x76, 0x83, 0xC6, 0x6A, 0x06, 0x24, 0x0F, 0x03, 0x7A,
-    0x18, 0xFF, 0x7A, 0x85, 0x22, 0xAD, 0xAE, 0x1D, 0x61, 0x3C, 0x20, 0xD9, 0x3E, 0x2B, 0xE5, 0x94,
-    0x9C, 0x57, 0x39, 0xD3, 0xBC, 0x4C, 0x65, 0x78, 0xDE, 0x25, 0xE9, 0x81, 0x3C, 0x08, 0xC8, 0xE3,
-    0x65, 0x0A, 0x2E, 0xD6, 0x5A, 0x15, 0xA4, 0x78, 0x24, 0x8C, 0x89, 0xDC, 0xDF, 0x52, 0x7C, 0x7C,
-    0xE1, 0x9D, 0x60, 0x5C, 0xB2, 0x84, 0x71, 0xFF, 0x37, 0xDD, 0xA2, 0xFB, 0xEB, 0xE6, 0x6A, 0x78,
-    0x1F, 0x65, 0xA7, 0x2E, 0x37, 0x54, 0xB6, 0x84, 0xED, 0xCA, 0x37, 0x17, 0x9A, 0xEF, 0x6A, 0x81,
-    0xD6, 0x8C, 0xBC, 0x47, 0x81, 0x56, 0xCD, 0x99, 0xAC, 0x29, 0x17, 0x26, 0x3B, 0x2C, 0xD0, 0x2D,
-    0x37, 0x42, 0x38, 0xEA, 0x80, 0xAE, 0xDB, 0xB6, 0x14, 0xD2, 0x74, 0x0D, 0xAD, 0x9B, 0x40, 0x89,
-    0x96, 0xAC, 0xD8, 0x45, 0x89, 0xC2, 0x8A, 0xA9, 0x70, 0xAB, 0xF9, 0x5A, 0x0C, 0xC8, 0x1B, 0x3E,
-    0x7F, 0xC8, 0x87, 0x23, 0x2E, 0xBE, 0x42, 0x22, 0xC8, 0x05, 0x03, 0x23, 0x6A, 0x2B, 0xCD, 0x64,
-    0xD1, 0x5D, 0x0A, 0xEE, 0xB3, 0x70, 0xC3, 0xC1, 0xEC, 0xB4, 0xA0, 0x9F, 0xE6, 0x69, 0xA7, 0xC8,
-    0x55, 0x86, 0xCC, 0x1E, 0xA1, 0xA7, 0xA1, 0xD0, 0x03, 0xCA, 0x1B, 0xE6, 0x9B, 0x31, 0x92, 0x8D,
-    0xC3, 0x3C, 0x28, 0x06, 0x96, 0x8B, 0x68, 0xE7, 0x70, 0xB7, 0xE8, 0x81, 0x7B, 0xE5, 0x5B, 0x76,
-    0x65, 0xE5, 0x43, 0xB8, 0x96, 0x4E, 0x96, 0xF8, 0x3E, 0xB9, 0xAF, 0x85, 0x2C, 0x3E, 0x25, 0xF7,
-    0xC7, 0x73, 0x21, 0x99, 0x2F, 0xC6, 0x0E, 0x61, 0x9B, 0x23, 0x87, 0x80, 0x2A, 0xB8, 0x44, 0x47,
-    0x9A, 0xFA, 0x31, 0xE7, 0xCE, 0x24, 0x1F, 0x39, 0x27, 0xB2, 0xB5, 0x76, 0x38, 0x5A, 0x3A, 0x1C,
-    0x65, 0x01, 0x48, 0x1D, 0x4C, 0x06, 0x66, 0x0D, 0xA4, 0xF1, 0x74, 0x3A, 0x5F, 0xA7, 0x3A, 0xA3,
-    0xED, 0x05, 0xC5, 0xDE, 0x35, 0x6D, 0x7B, 0x7A, 0xE5, 0x36, 0x9F, 0x21, 0x4C, 0xFA, 0x0C, 0x1E,
-    0xE0, 0x8B, 0x1A, 0x4B, 0x17, 0x14, 0x49, 0x0B, 0x02, 0x2D, 0xC1, 0xBE, 0xAC, 0xEE, 0x93, 0x22,
-    0x81, 0x8A, 0xB1, 0x7E, 0x69, 0xD1, 0xF2, 0x54, 0x57, 0x5F, 0x83, 0xE0, 0xB2, 0xB6, 0xD7, 0x15,
-    0xB3, 0x49, 0xED, 0x2A, 0xA4, 0x20, 0xAC, 0xCF, 0x8C, 0xB6, 0x6A, 0x65, 0xC0, 0xDC, 0x76, 0x82,
-    0x07, 0x2F, 0x6B, 0xDB, 0xD3, 0x76, 0xC8, 0x76, 0xA4, 0xE1, 0x3B, 0xC8, 0x8E, 0x58, 0xA4, 0x21,
-    0xC6, 0x1B, 0x06, 0xD4, 0x53, 0x3B, 0xB5, 0xB0, 0x08, 0xDB, 0x67, 0x59, 0xD9, 0xCC, 0x11, 0x73,
-    0xA8, 0xB7, 0xBE, 0x02, 0x7C, 0x01, 0x45, 0x48, 0x8C, 0x0A, 0x43, 0x1E, 0xBE, 0x52, 0x00, 0x11,
-    0x70, 0x7E, 0xA3, 0x54, 0x0B, 0x59, 0xBF, 0x2C, 0x2D, 0x56, 0x58, 0xFB, 0x95, 0x12, 0x42, 0xD8,
-    0xA5, 0xF3, 0x18, 0x01, 0xC5, 0xAE, 0x3C, 0xAC, 0x88, 0x28, 0xDF, 0x19, 0xBB, 0xBC, 0x40, 0x09,
-    0xD7, 0xEC, 0xAA, 0x47, 0x19, 0xD7, 0xED, 0x6A, 0x8B, 0xE7, 0xA1, 0x55, 0xD1, 0x7F, 0x75, 0x61,
-    0xFD, 0x9B, 0xDE, 0x3B, 0xC8, 0xAC, 0x37, 0x29, 0x1A, 0x02, 0xE5, 0x2D, 0x6A, 0xD1, 0xEA, 0x57,
-    0xF7, 0x13, 0x66, 0x5D, 0x2E, 0x6A, 0xDC, 0x87, 0x8B, 0xEA, 0xF3, 0x2A, 0x33, 0x81, 0xD4, 0x78,
-    0xA6, 0x2A, 0x4C, 0x74, 0x0F, 0x24, 0xE2, 0xB2, 0x46, 0xA2, 0x8F, 0x6B, 0x04, 0xFC, 0x5E, 0xE6,
-    0xCB, 0x6C, 0x13, 0x75, 0x26, 0x93, 0x58, 0x4C, 0x58, 0x15, 0xF5, 0xFA, 0x70, 0xA6, 0x4B, 0xA1,
-    0x09, 0x1F, 0x51, 0xD8, 0xBD, 0xA2, 0xD5, 0xE7, 0x3A, 0xEB, 0x0E, 0xFC, 0x84, 0x6C, 0x01, 0x1B,
-    0xDE, 0xAC, 0x24, 0x39, 0xB4, 0xE0, 0xAB, 0xA4, 0xFD, 0x68, 0x5B, 0x6F, 0xFE, 0x5B, 0x36, 0x5F,
-    0xA5, 0x71, 0x62, 0xB8, 0xE6, 0xA2, 0xA1, 0x53, 0x08, 0x65, 0x72, 0x3C, 0x4E, 0xDE, 0xB8, 0x98,
-    0x7B, 0x4C, 0x1F, 0x0C, 0x68, 0xFC, 0xE8, 0x76, 0xB7, 0x90, 0x32, 0xB4, 0xE7, 0xBE, 0x51, 0xB9,
-    0xD2, 0xCE, 0x03, 0xD2, 0x70, 0xB6, 0x64, 0xE7, 0xE5, 0x06, 0x29, 0xE2, 0x72, 0x70, 0x48, 0x52,
-    0x70, 0x09, 0x10, 0x6B, 0x8D, 0xB4, 0x9B, 0xB9, 0x36, 0xCA, 0xA8, 0x74, 0x69, 0x70, 0xDA, 0xF5,
-    0x43, 0x73, 0xDD, 0xCE, 0x88, 0x8B, 0xCC, 0x7F, 0x2F, 0x8D, 0xEE, 0x5C, 0xDB, 0xEC, 0xCA, 0x9C,
-    0x2E, 0x64, 0x5B, 0xC3, 0xC7, 0xA2, 0x8E, 0x2C, 0x0C, 0x8E, 0x33, 0x11, 0x39, 0x65, 0xFF, 0x86,
-    0xFC, 0xC3, 0xBB, 0x07, 0xA9, 0x99, 0xAF, 0xD4, 0xE6, 0x43, 0x4D, 0x81, 0x52, 0x3B, 0x2F, 0xD1,
-    0xD8, 0xF8, 0x3C, 0xB3, 0x85, 0xCF, 0xD5, 0x75, 0x7E, 0x7A, 0xFC, 0xAC, 0xF1, 0xF3, 0x3E, 0xB3,
-    0xCC, 0xA1, 0xFA, 0xC9, 0x12, 0x2B, 0x9A, 0x6F, 0xF1, 0x8C, 0x8E, 0xB3, 0x22, 0x7B, 0x59, 0x96,
-    0xE2, 0x1E, 0x04, 0x2B, 0x35, 0x76, 0x9E, 0xCB, 0xD1, 0x11, 0xAC, 0x47, 0xE0, 0xEA, 0x4B, 0x14,
-    0x63, 0xA5, 0x5B, 0x52, 0x51, 0xDE, 0x3E, 0x9E, 0xDF, 0xE2, 0x56, 0xCB, 0x10, 0x39, 0xBE, 0xAE,
-    0x9B, 0xCC, 0x6E, 0x7A, 0x11, 0x81, 0xEF, 0x23, 0x87, 0xDD, 0x74, 0x4D, 0xAF, 0x68, 0x4C, 0x09,
-    0x96, 0xBC, 0x2F, 0x80, 0x50, 0x6B, 0x08, 0x3D, 0x89, 0x01, 0xB1, 0xB6, 0x8F, 0x11, 0xF1, 0x00,
-    0xAC, 0xFD, 0x87, 0x25, 0xF9, 0x74, 0x85, 0x24, 0x2C, 0xDD, 0x82, 0xFB, 0x00, 0x0E, 0x0A, 0xBA,
-    0x9B, 0x63, 0xF5, 0x93, 0x13, 0xD1, 0x07, 0x38, 0xC6, 0x98, 0x0C, 0x80, 0x19, 0x8F, 0xA0, 0xDF,
-    0x58, 0xFE, 0x29, 0x03, 0x67, 0x53, 0xA2, 0xEF, 0x85, 0xFF, 0x08, 0x6A, 0x04, 0x63, 0x6C, 0xA9,
-    0xFA, 0x2E, 0xD5, 0x9F, 0x9E, 0x20, 0x84, 0xAA, 0x3A, 0x96, 0xE9, 0x75, 0x5B, 0x5A, 0x6F, 0x3E,
-    0x5B, 0xDB, 0x07, 0x28, 0x32, 0x0D, 0x8E, 0x4A, 0x8B, 0x4D, 0x43, 0xA0, 0xF7, 0x80, 0xEE, 0x2C,
-    0x6B, 0x04, 0x78, 0x70, 0x0E, 0xCC, 0xED, 0x83, 0x48, 0x84, 0x70, 0x7E, 0x23, 0x1F, 0xE9, 0xF6,
-    0x57, 0xC4, 0x83, 0xF2, 0x83, 0x24, 0xE5, 0x53, 0x5C, 0xA3, 0xA2, 0x8D, 0xE7, 0xFC, 0x73, 0xEE,
-    0xED, 0xE5, 0x63, 0x80, 0x4E, 0x11, 0x90, 0x2B, 0xB8, 0x8B, 0x32, 0x4A, 0x52, 0xFB, 0xF0, 0xD1,
-    0x86, 0x8A, 0xE6, 0xDA, 0x91, 0x74, 0xC6, 0x39, 0xEE, 0x7E, 0xFD, 0x3F, 0xDB, 0xC0, 0x83, 0x6F,
-    0x07, 0xD3, 0xD8, 0x2E, 0x51, 0x9F, 0x73, 0xB0, 0xA6, 0x2C, 0x48, 0x43, 0xDD, 0x23, 0x9D, 0xC8,
-    0xC0, 0x25, 0x01, 0x4C, 0x65, 0x1C, 0xFF, 0x57, 0x19, 0x1F, 0x64, 0x72, 0x4D, 0x75, 0x15, 0x30,
-    0x62, 0x8C, 0xDE, 0x60, 0x50, 0x3C, 0xDA, 0x15, 0x05, 0x6D, 0x36, 0xFF, 0x4A, 0x63, 0xCF, 0x8E,
-    0xD1, 0x63, 0xAD, 0xFC, 0x37, 0xA4, 0xD3, 0xC7, 0x40, 0xCD, 0xBD, 0xE8, 0x71, 0x31, 0x6F, 0x4E,
-    0x92, 0xEF, 0x45, 0xC9, 0x59, 0xEC, 0x1C, 0xBE, 0x57, 0xB7, 0x3E, 0x6E, 0x2D, 0x2F, 0xE4, 0x31,
-    0x76, 0xF8, 0xE7, 0x99, 0x58, 0xFB, 0xD3, 0xF7, 0x73, 0x73, 0x81, 0xDD, 0x42, 0xC6, 0x69, 0x28,
-    0xBA, 0xD9, 0xA1, 0xFB, 0xE8, 0x68, 0xF0, 0x58, 0xF0, 0x31, 0x52, 0x4B, 0x72, 0x5D, 0xEF, 0x9B,
-    0xDD, 0xAE, 0x26, 0x77, 0xBD, 0xA1, 0xD9, 0x5F, 0xC5, 0x60, 0x84, 0x35, 0x69, 0x51, 0xE3, 0x53,
-    0x60, 0x60, 0x48, 0xC9, 0x37, 0xBA, 0x86, 0xBB, 0x76, 0x04, 0xAE, 0xD7, 0xB0, 0x86, 0xB6, 0xA6,
-    0xFB, 0xDD, 0x06, 0xC2, 0x61, 0xB7, 0xA3, 0x33, 0x3A, 0xCA, 0x68, 0x6E, 0x7A, 0x58, 0x55, 0x98,
-    0xDA, 0xFF, 0x6A, 0x4B, 0xE7, 0x8D, 0x9B, 0xA5, 0xF3, 0x77, 0xBB, 0x74, 0x6B, 0xBB, 0xF4, 0x4A,
-    0xA7, 0xF4, 0x72, 0xEE, 0x60, 0xC0, 0x09, 0x70, 0x44, 0x10, 0x7B, 0x08, 0x27, 0x1F, 0xD2, 0xFA,
-    0x69, 0xBF, 0x3B, 0xB6, 0xC5, 0x7F, 0x7D, 0x64, 0xB6, 0x74, 0x62, 0x1D, 0x75, 0x86, 0x51, 0x75,
-    0xFB, 0xE6, 0xD2, 0x0B, 0x61, 0xC9, 0x9D, 0x11, 0x13, 0x64, 0xF8, 0x4B, 0x83, 0x58, 0x83, 0x91,
-    0x7F, 0xDF, 0xF5, 0x4B, 0xEB, 0x68, 0xFF, 0x5D, 0x21, 0x8A, 0xC6, 0xB3, 0x96, 0x36, 0xA5, 0x76,
-    0x58, 0x14, 0xEF, 0x91, 0xFE, 0xA3, 0xD3, 0xA1, 0xC8, 0x39, 0x09, 0x45, 0x5D, 0xFA, 0x77, 0x8B,
-    0x37, 0xBA, 0x61, 0xE1, 0x05, 0x25, 0x23, 0xA6, 0xA0, 0x1C, 0xF7, 0xB3, 0x28, 0x7F, 0xA9, 0x1E,
-    0xDA, 0x41, 0xF8, 0x79, 0x87, 0xA4, 0x52, 0x2C, 0xC1, 0x28, 0xBC, 0x6E, 0x7E, 0x99, 0x43, 0xD3,
-    0x1B, 0xAF, 0x70, 0xF0, 0x6F, 0xB3, 0xE1, 0x8B, 0xA1, 0xE0, 0x97, 0x24, 0x0E, 0xC4, 0x23, 0x7D,
-    0xBD, 0xD2, 0x67, 0x52, 0xE8, 0x4B, 0x97, 0x6D, 0x6E, 0xAB, 0x8D, 0xC4, 0xAB, 0xE6, 0x4A, 0x45,
-    0xB5, 0x03, 0xD2, 0xCE, 0x21, 0x17, 0x76, 0x59, 0x58, 0xA5, 0x8F, 0xC7, 0x47, 0xBA, 0x97, 0x8A,
-    0xA5, 0xF2, 0x30, 0xCA, 0x1E, 0xA0, 0x05, 0xD3, 0x55, 0x50, 0x21, 0xB8, 0x65, 0x0A, 0x3A, 0xF7,
-    0xC6, 0xCD, 0x7F, 0xFD, 0x1C, 0x04, 0xE9, 0xEF, 0xF6, 0x9B, 0xCC, 0xB2, 0xDA, 0x6E, 0x74, 0x3F,
-    0xC1, 0xA9, 0x21, 0x35, 0x37, 0x1D, 0x61, 0x0C, 0x38, 0xAA, 0xD0, 0x77, 0x2D, 0x6E, 0xAE, 0xCB,
-    0x31, 0x0F, 0xB9, 0x27, 0xF4, 0x18, 0x4E, 0x91, 0x5E, 0x16, 0xFA, 0xCC, 0xE3, 0x09, 0x77, 0x73,
-    0x0A, 0x28, 0xEE, 0x5B, 0xC8, 0xC3, 0x50, 0x9C, 0x99, 0x11, 0xF1, 0xAC, 0x4E, 0x1B, 0xFE, 0xAF,
-    0xA1, 0xE0, 0x21, 0xDE, 0x26, 0xBB, 0xC0, 0x22, 0xB7, 0xD0, 0x1D, 0x51, 0xE0, 0x0D, 0x96, 0x1E,
-    0x55, 0x04, 0xC8, 0x36, 0x6F, 0x14, 0x9C, 0xD2, 0x1C, 0x6E, 0x31, 0xC6, 0x38, 0xDB, 0x40, 0x04,
-    0x06, 0x46, 0xF0, 0x8D, 0x66, 0x91, 0xC1, 0xF6, 0xCE, 0x4A, 0x8D, 0x10, 0x08, 0xE1, 0xA8, 0xFE,
-    0x56, 0x44, 0x80, 0x06, 0x4E, 0x25, 0x31, 0xB0, 0x7A, 0x4A, 0xC0, 0x9E, 0xB1, 0x69, 0x58, 0x66,
-    0x6A, 0x06, 0x3A, 0x5F, 0x05, 0xD8, 0xDD, 0xF6, 0x52, 0x63, 0x58, 0x3F, 0x6C, 0x0C, 0xEA, 0x54,
-    0x91, 0x90, 0x31, 0xC7, 0xFD, 0x1F, 0xC6, 0xCB, 0xD9, 0x69, 0xEA, 0xAF, 0xCC, 0x33, 0x33, 0x52,
-    0x27, 0xB9, 0xFB, 0xD7, 0xEF, 0x01, 0x5E, 0xC5, 0xFD, 0xC1, 0x2B, 0x01, 0x78, 0xC1, 0x00, 0xF5,
-    0x36, 0x16, 0x20, 0xF7, 0x8A, 0x50, 0xEE, 0x26, 0xB5, 0xE9, 0xD3, 0xB7, 0x06, 0xB2, 0xF9, 0xC7,
-    0x36, 0x75, 0x7E, 0x83, 0x51, 0x7F, 0xE7, 0xC5, 0xE4, 0xD1, 0x5E, 0xB9, 0x54, 0xAF, 0x4E, 0xD4,
-    0xAA, 0xFE, 0x89, 0xB8, 0xE7, 0xBA, 0x4E, 0x66, 0x53, 0x68, 0x05, 0x07, 0x64, 0x1E, 0x8E, 0x15,
-    0xAD, 0x77, 0xEA, 0x38, 0xC2, 0x43, 0x58, 0x75, 0x55, 0x7F, 0x2C, 0x1F, 0xD4, 0xB7, 0x70, 0x1B,
-    0x38, 0x6E, 0x48, 0xF4, 0xD1, 0x4A, 0xF7, 0xBE, 0xE7, 0x9B, 0xAA, 0x43, 0x25, 0xB2, 0x85, 0x04,
-    0x07, 0x69, 0xDB, 0xA6, 0xDC, 0xFD, 0x48, 0x39, 0xAF, 0xA2, 0x0F, 0x27, 0xEE, 0xEB, 0x94, 0xCB,
-    0xEF, 0xD2, 0xA6, 0xDF, 0xA5, 0x75, 0x2C, 0xA6, 0xB4, 0xBC, 0x14, 0x96, 0x5A, 0x6F, 0x6A, 0xA7,
-    0xB0, 0x2A, 0x37, 0xE7, 0x3B, 0x23, 0x47, 0x0F, 0x9A, 0xCA, 0x44, 0x06, 0x6B, 0x4E, 0x80, 0xC8,
-    0x88, 0x70, 0x7C, 0x3B, 0x8D, 0xEC, 0xAF, 0xA7, 0xE1, 0x3F, 0xFD, 0xD7, 0xFD, 0xDA, 0x44, 0xC6,
-    0xA5, 0xD4, 0x7A, 0x61, 0x33, 0x77, 0x6A, 0xF4, 0xC5, 0x18, 0xB2, 0x47, 0x0A, 0x8B, 0xE3, 0x36,
-    0x49, 0x2C, 0x0E, 0x8C, 0x0A, 0x6E, 0x5D, 0x3B, 0xB1, 0x92, 0xD7, 0x06, 0x8C, 0x79, 0x04, 0x8E,
-    0x38, 0x86, 0x9E, 0x49, 0xD6, 0x6D, 0xE5, 0x89, 0x3C, 0x9D, 0xCA, 0x13, 0x56, 0x31, 0xC5, 0xAC,
-    0x3A, 0x6F, 0x29, 0x95, 0x97, 0xC1, 0x94, 0x43, 0x2F, 0x3B, 0x03, 0x82, 0xE4, 0x65, 0x97, 0x2B,
-    0x29, 0xBC, 0xEC, 0x6A, 0x65, 0x65, 0x5E, 0x36, 0xAC, 0x9C, 0xD4, 0xCB, 0xF2, 0xCA, 0x15, 0xEF,
-    0x47, 0x59, 0x75, 0x06, 0xB9, 0x1B, 0xD7, 0x6B, 0xE2, 0xFD, 0x84, 0xAF, 0x81, 0xBD, 0x9F, 0x82,
-    0x74, 0x8A, 0xD7, 0xC8, 0x5B, 0x19, 0x93, 0xB4, 0xE5, 0x0A, 0x4C, 0x66, 0x0B, 0x08, 0xFA, 0x8E,
-    0x3C, 0x92, 0x5A, 0x53, 0x52, 0xA7, 0x30, 0xDE, 0x63, 0xFC, 0x14, 0x5D, 0xEA, 0xBB, 0xAF, 0x4B,
-    0x67, 0x77, 0xB3, 0x71, 0xD2, 0xCC, 0xFF, 0xF5, 0xE9, 0x30, 0xBE, 0x30, 0x94, 0x3D, 0x98, 0xD4,
-    0x82, 0x70, 0xB2, 0x9A, 0x61, 0xCC, 0x24, 0xE6, 0x1B, 0xD4, 0x4B, 0xB7, 0x00, 0xDC, 0x21, 0x77,
-    0x17, 0x75, 0xA5, 0xA8, 0xAF, 0x88, 0x30, 0xC0, 0x06, 0x8D, 0xDC, 0xA3, 0xDB, 0xAE, 0xB3, 0x94,
-    0x0D, 0xE9, 0x85, 0xB2, 0xE3, 0xAF, 0xC1, 0x63, 0x7C, 0x31, 0xF3, 0x35, 0x0E, 0x4D, 0x0A, 0xEB,
-    0x35, 0x66, 0xB7, 0x7A, 0x5E, 0x7E, 0xB4, 0xDE, 0x2C, 0x98, 0x3B, 0x65, 0xC1, 0x64, 0xF2, 0x65,
-    0x65, 0x4F, 0x1A, 0xCF, 0x4F, 0xEF, 0xBC, 0x28, 0xDC, 0xE6, 0xC5, 0x4A, 0xD8, 0x02, 0xDA, 0x58,
-    0x71, 0x14, 0x2F, 0xF6, 0xAB, 0xBA, 0xAD, 0xB0, 0xF9, 0x0E, 0x17, 0x84, 0xF8, 0x1C, 0x2E, 0xE5,
-    0x7E, 0x6E, 0x67, 0xE1, 0xDD, 0xDD, 0x2C, 0xD2, 0x8D, 0x30, 0x2D, 0x34, 0x58, 0xE3, 0xD4, 0x1D,
-    0xB9, 0x3A, 0x49, 0xAC, 0x96, 0x38, 0xDA, 0xB6, 0xD9, 0xE3, 0x27, 0xD3, 0x5C, 0x2D, 0x0C, 0x37,
-    0x7B, 0xDB, 0xFB, 0xBE, 0x25, 0x8E, 0xE6, 0x75, 0xAF, 0x9B, 0x1C, 0x56, 0xA6, 0x9D, 0x8E, 0x13,
-    0x9E, 0xFA, 0x91, 0x05, 0x5D, 0x6F, 0xBA, 0x9C, 0xB8, 0x0F, 0x1D, 0xE4, 0xA1, 0x9E, 0x89, 0x40,
-    0xDD, 0xB1, 0xB4, 0xEB, 0x76, 0xFB, 0x4E, 0xA3, 0x83, 0x73, 0x86, 0xFB, 0xA1, 0x4A, 0x43, 0x8B,
-    0x36, 0x2C, 0x82, 0x99, 0x95, 0xF7, 0x82, 0x8F, 0x65, 0xEB, 0xCE, 0xEB, 0xD9, 0x96, 0x72, 0x31,
-    0x91, 0xFF, 0x00, 0xCD, 0x5A, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0x1F, 0x69, 0x89, 0x8D, 0xD9,
-    0x88, 0x1E, 0xEC, 0xDA, 0x89, 0x63, 0x31, 0x83, 0x07, 0xC3, 0x90, 0xCC, 0x0C, 0x19, 0x8C, 0xE2,
-    0x4E, 0xA4, 0xEB, 0xA1, 0x40, 0x33, 0xD8, 0x83, 0x9D, 0x0E, 0x46, 0xE0, 0x0E, 0x5D, 0xEA, 0x02,
-    0x55, 0x06, 0x01, 0x55, 0x03, 0xE9, 0x8E, 0x71, 0x47, 0x0F, 0x55, 0x8B, 0x64, 0xB6, 0x87, 0x0E,
-    0xA9, 0x12, 0xD4, 0x06, 0xEA, 0x41, 0x83, 0x4E, 0x47, 0x23, 0x83, 0x87, 0x0C, 0x25, 0x52, 0xA4,
-    0xDD, 0x1A, 0x36, 0x48, 0xFF, 0x20, 0x6E, 0x6B, 0x16, 0xA5, 0xD1, 0x93, 0x7D, 0x3A, 0xF6, 0xF7,
-    0x7B, 0xE4, 0x9D, 0xCE, 0x4E, 0xD3, 0x02, 0xE9, 0xC5, 0xF1, 0x49, 0x7C, 0x3C, 0xDD, 0x91, 0xDF,
-    0x7B, 0xDF, 0xFB, 0xF3, 0x7B, 0xBF, 0xEF, 0xA3, 0xA4, 0x21, 0x03, 0xFC, 0x74, 0x84, 0xAF, 0xEF,
-    0x48, 0x26, 0x99, 0x49, 0xAD, 0xC4, 0xC6, 0x8F, 0x9B, 0x78, 0xB1, 0x17, 0xFB, 0x51, 0x20, 0x21,
-    0x7E, 0xDA, 0x7A, 0xC1, 0x0B, 0x38, 0x5E, 0x15, 0x99, 0xDE, 0x16, 0x09, 0xCB, 0xD8, 0xF4, 0xEE,
-    0xA6, 0x76, 0x76, 0x3B, 0xF5, 0x6E, 0xBD, 0x1B, 0xFB, 0x97, 0x13, 0x09, 0x4F, 0xC7, 0x12, 0xDA,
-    0x91, 0xB4, 0x1C, 0xD1, 0xA3, 0xE3, 0xE2, 0x3C, 0x83, 0xE3, 0x69, 0x5C, 0xFE, 0xDC, 0x57, 0xC5,
-    0xDF, 0xD9, 0x10, 0xA7, 0xCC, 0x44, 0x7E, 0x84, 0x61, 0x5E, 0xAC, 0x86, 0xAA, 0x5F, 0xC1, 0x40,
-    0xC4, 0x6C, 0x2F, 0x26, 0xE2, 0xA4, 0x6E, 0x2A, 0x5E, 0xEC, 0x24, 0xE2, 0x8B, 0x1D, 0x4B, 0xA0,
-    0x5F, 0x8E, 0x84, 0x8F, 0xC3, 0x2C, 0x9E, 0x8F, 0xC4, 0x2E, 0xCB, 0x44, 0x70, 0x9D, 0x3C, 0x24,
-    0xA2, 0xFA, 0x12, 0x69, 0x50, 0xDC, 0xC4, 0x61, 0x97, 0x1F, 0xCF, 0x8A, 0x5F, 0x96, 0x3D, 0x39,
-    0x66, 0xCA, 0x14, 0x1F, 0xEC, 0x11, 0xD9, 0x27, 0x46, 0x36, 0x7E, 0x70, 0x26, 0x0A, 0xCB, 0x01,
-    0x6E, 0x59, 0x91, 0x79, 0xFC, 0x34, 0x64, 0x46, 0x4E, 0xE2, 0xE0, 0x79, 0x4E, 0x8E, 0x88, 0x27,
-    0x2B, 0x12, 0x3E, 0x18, 0xC8, 0x46, 0xF7, 0x4C, 0xF4, 0xBC, 0x58, 0x12, 0xEE, 0xD8, 0x65, 0x1C,
-    0x14, 0x06, 0x77, 0xA4, 0x52, 0xC0, 0x4A, 0x78, 0xCA, 0xCE, 0xAC, 0x44, 0xEC, 0xDC, 0x89, 0xC4,
-    0xCA, 0x31, 0x4B, 0x53, 0x50, 0x6B, 0x6F, 0x09, 0xA2, 0x8F, 0x39, 0xCA, 0x56, 0x42, 0x27, 0x95,
-    0x22, 0x07, 0xBA, 0xE7, 0xF1, 0xE7, 0x2A, 0x8E, 0x4B, 0x83, 0xB7, 0x44, 0xBA, 0x65, 0x9F, 0x97,
-    0xD0, 0xC2, 0x1E, 0xA7, 0x53, 0x40, 0x1C, 0xDC, 0x81, 0xD0, 0x29, 0xC9, 0x8D, 0xDD, 0xD7, 0x77,
-    0xAA, 0xA0, 0x8C, 0x7D, 0xA2, 0x1F, 0x58, 0x70, 0xA1, 0xF7, 0xB3, 0xBE, 0x34, 0x65, 0x13, 0x56,
-    0xAE, 0xC8, 0x86, 0x1C, 0xC5, 0x3B, 0xB8, 0x19, 0x47, 0x88, 0x39, 0x62, 0xB2, 0xF6, 0xBB, 0x65,
-    0xE4, 0xC4, 0xED, 0xD4, 0x49, 0xDC, 0xDC, 0x49, 0xAD, 0xDC, 0xEE, 0x49, 0x6E, 0x95, 0x51, 0x26,
-    0xDD, 0x8F, 0x12, 0xF1, 0xCA, 0x48, 0x30, 0x11, 0x5C, 0x4C, 0x9F, 0xE1, 0x66, 0x4F, 0x96, 0x75,
-    0xC2, 0xF3, 0x12, 0x9E, 0x2A, 0xF0, 0x35, 0xC6, 0x38, 0x27, 0xF2, 0x8C, 0x15, 0x87, 0x6E, 0x8A,
-    0xDF, 0x43, 0x56, 0x54, 0x47, 0xC9, 0x2A, 0xB7, 0x19, 0x89, 0x3F, 0x5E, 0x4F, 0x69, 0xBB, 0x81,
-    0x1E, 0xBC, 0x39, 0x21, 0x6E, 0xB4, 0xD8, 0x73, 0xA3, 0x59, 0xAB, 0x68, 0xDB, 0xC9, 0x9C, 0x93,
-    0x78, 0x26, 0x3D, 0xE9, 0x45, 0x7B, 0x24, 0x7B, 0x91, 0xB1, 0xC8, 0x97, 0x28, 0x6F, 0x2C, 0x05,
-    0x2A, 0xF5, 0x7D, 0xF5, 0xF9, 0x49, 0x86, 0x2B, 0x6B, 0xB8, 0x89, 0x65, 0xD2, 0x59, 0xBB, 0xF0,
-    0xED, 0xC4, 0x93, 0x2E, 0xC6, 0xB1, 0x13, 0x06, 0x91, 0x6E, 0xC1, 0xA4, 0xC2, 0x37, 0x17, 0xE1,
-    0xCB, 0xE9, 0x92, 0xE6, 0xCA, 0x14, 0x45, 0xFB, 0x0D, 0xFB, 0x0F, 0x85, 0x17, 0xE7, 0xBE, 0xC9,
-    0x17, 0xEC, 0xAC, 0x69, 0xA7, 0x4D, 0x37, 0x69, 0x1E, 0x4E, 0xC2, 0x5F, 0xFD, 0xC5, 0xBB, 0x9C,
-    0xE1, 0x92, 0x48, 0x8E, 0x38, 0xB1, 0x6C, 0xF8, 0x08, 0xCA, 0x8A, 0xB8, 0xB7, 0x0A, 0x09, 0x5F,
-    0xCA, 0x24, 0xF4, 0x12, 0x09, 0x10, 0x34, 0xEF, 0x72, 0x2E, 0x4E, 0x92, 0x8B, 0x95, 0x2C, 0x8B,
-    0xAC, 0x1D, 0x93, 0x03, 0xE7, 0xCF, 0x23, 0x0D, 0xCA, 0xF4, 0xC0, 0xF9, 0x97, 0x31, 0x13, 0xF3,
-    0x1F, 0x0E, 0xE1, 0xDC, 0xC3, 0x32, 0x6A, 0x97, 0xB2, 0xFB, 0xFA, 0x2C, 0x3F, 0x7C, 0x6B, 0x7D,
-    0x0D, 0x7E, 0x70, 0xEE, 0x6F, 0xC2, 0x0F, 0x26, 0x0F, 0xE0, 0x07, 0x93, 0xFB, 0xF0, 0x03, 0x65,
-    0xBE, 0x64, 0xF2, 0x13, 0xF0, 0x80, 0x79, 0x50, 0x50, 0xFE, 0x2B, 0x83, 0x1F, 0x4C, 0x5E, 0xC0,
-    0x0F, 0x26, 0xDF, 0x84, 0x1F, 0x30, 0x1D, 0xF8, 0xC1, 0xCA, 0xFD, 0xD3, 0x89, 0xE7, 0x0F, 0xDC,
-    0x3B, 0xFF, 0xC3, 0x0F, 0x41, 0x59, 0xF6, 0x43, 0xE6, 0xB5, 0x88, 0xB3, 0x23, 0xC1, 0xF5, 0xB8,
-    0x61, 0x27, 0xCB, 0x56, 0xBA, 0x6C, 0xD2, 0x15, 0x2B, 0x5D, 0x40, 0xED, 0x96, 0x62, 0x7E, 0x2E,
-    0xB2, 0x17, 0xDF, 0xBB, 0x0F, 0x1F, 0x07, 0x2E, 0xD6, 0x73, 0xC6, 0xF9, 0xD1, 0xEF, 0xF4, 0xA8,
-    0x5F, 0xC7, 0xD7, 0xD7, 0xD7, 0x78, 0x1D, 0xDF, 0x77, 0x33, 0x3B, 0xEF, 0xD9, 0xC9, 0xA6, 0x15,
-    0x6F, 0xEA, 0x8C, 0x73, 0x81, 0x75, 0x9E, 0xA0, 0x64, 0x4C, 0xF6, 0xBC, 0x1B, 0xBD, 0x1A, 0x94,
-    0xF9, 0xF1, 0xF5, 0x35, 0x66, 0x73, 0x99, 0x3A, 0xEF, 0x23, 0x3C, 0x3D, 0x0B, 0x55, 0x62, 0xE7,
-    0x72, 0x31, 0x36, 0x03, 0x68, 0x49, 0x51, 0x2C, 0x2F, 0xD8, 0xD9, 0x4D, 0x27, 0x6D, 0x2D, 0xC6,
-    0x3E, 0x9C, 0x77, 0xD6, 0xCE, 0xDD, 0xC4, 0x47, 0xDE, 0xE1, 0xF5, 0xAC, 0x4C, 0xB3, 0xD0, 0x11,
-    0xA2, 0x90, 0x75, 0xBC, 0xC0, 0x3A, 0x5E, 0x15, 0x3F, 0xC2, 0xBC, 0x03, 0x16, 0x4A, 0x48, 0xB1,
-    0x40, 0xBD, 0xAB, 0x74, 0xC7, 0x26, 0x22, 0x8B, 0x0F, 0xEC, 0x4A, 0x58, 0x3D, 0x71, 0x0A, 0xB7,
-    0x27, 0xEE, 0x60, 0x73, 0x90, 0x78, 0x61, 0xD6, 0x8D, 0x3D, 0x83, 0x22, 0x9F, 0xE5, 0xC0, 0x27,
-    0xA4, 0x4E, 0x72, 0x09, 0x93, 0xA1, 0xF0, 0x87, 0xB9, 0x2C, 0x6E, 0x89, 0xE2, 0x0C, 0xCA, 0xDF,
-    0xE6, 0x08, 0xEF, 0xE5, 0x54, 0xDA, 0x14, 0xDD, 0x91, 0x68, 0x8F, 0x84, 0x7E, 0xEB, 0x53, 0x58,
-    0xD7, 0x21, 0xC4, 0xFE, 0x3F, 0x84, 0x8B, 0xFC, 0x93, 0xF2, 0x72, 0x9D, 0x4B, 0x7B, 0x60, 0x5C,
-    0x17, 0xC8, 0x7A, 0x08, 0x59, 0x66, 0xC5, 0x76, 0x86, 0x44, 0xDA, 0x94, 0xDE, 0xDB, 0x79, 0x37,
-    0x66, 0x1C, 0xBA, 0xE2, 0x75, 0x65, 0x0A, 0xF3, 0x6E, 0x0A, 0x6A, 0x93, 0x49, 0xD0, 0x57, 0xDF,
-    0x17, 0x74, 0xFF, 0xC1, 0x7B, 0x72, 0x69, 0x5D, 0x64, 0x31, 0xB6, 0xFF, 0x54, 0xB8, 0x71, 0xCF,
-    0x97, 0x7E, 0x28, 0xFD, 0x05, 0xE9, 0x2D, 0x68, 0x55, 0xF8, 0x17, 0x63, 0x6B, 0x5B, 0x4C, 0xB4,
-    0x0F, 0x89, 0xBE, 0x84, 0xCB, 0x01, 0x4C, 0x05, 0x9C, 0xB1, 0x89, 0xC9, 0xB3, 0x12, 0x5A, 0x38,
-    0x7A, 0x21, 0x42, 0xB2, 0x29, 0xEE, 0xEB, 0xB9, 0x1C, 0x01, 0xCE, 0x1E, 0xAD, 0x13, 0x65, 0x96,
-    0x7A, 0x81, 0x82, 0x50, 0x0D, 0xFC, 0x84, 0x76, 0x93, 0xD1, 0x00, 0xE6, 0xE2, 0x0A, 0x03, 0x0E,
-    0x33, 0xE6, 0x15, 0xBD, 0x14, 0xEB, 0x04, 0x41, 0x34, 0x85, 0x95, 0xFA, 0x89, 0xC9, 0x01, 0x37,
-    0xF1, 0xC1, 0x7B, 0x9E, 0xF9, 0x30, 0xBA, 0xB4, 0x3E, 0x6F, 0x5F, 0xC4, 0xD7, 0xCB, 0x4F, 0x07,
-    0x5A, 0xE7, 0x88, 0x80, 0x9D, 0xDC, 0x6B, 0x9D, 0x15, 0xF7, 0x54, 0x59, 0xE6, 0x54, 0xB1, 0xA2,
-    0x08, 0xBD, 0xA9, 0x2A, 0x76, 0xA8, 0x62, 0xEF, 0xBA, 0xA6, 0xE2, 0x9C, 0x6A, 0x5F, 0x56, 0xED,
-    0x39, 0xB5, 0x53, 0x6F, 0x13, 0xF8, 0xC2, 0x5B, 0x66, 0x55, 0x7B, 0x43, 0xB5, 0x13, 0xDA, 0x7B,
-    0xE6, 0x23, 0xB4, 0xA0, 0xC2, 0xFE, 0xF5, 0xBB, 0x99, 0xC9, 0xBD, 0x33, 0x56, 0x7E, 0xF0, 0xDE,
-    0xEC, 0x5E, 0x2B, 0xBF, 0xB4, 0xBE, 0x82, 0x99, 0xF1, 0x7E, 0xF4, 0x10, 0x2B, 0xA5, 0xD1, 0xC0,
-    0x83, 0x06, 0x91, 0x0E, 0x98, 0x0D, 0xEB, 0x9D, 0x28, 0x86, 0x8A, 0x79, 0x93, 0xE0, 0x92, 0x6E,
-    0x19, 0x43, 0xC5, 0xFA, 0xFA, 0x30, 0x29, 0xBA, 0x19, 0x3C, 0x66, 0x17, 0x7D, 0x21, 0x0C, 0x51,
-    0xA5, 0x89, 0x37, 0xEB, 0xA9, 0x42, 0xE5, 0xE1, 0x94, 0xDE, 0xE8, 0xF2, 0x16, 0x64, 0x9E, 0xA7,
-    0xE0, 0x3D, 0x6F, 0xE5, 0xC7, 0x80, 0xFC, 0x4E, 0xDE, 0xB0, 0xF2, 0xDC, 0xCF, 0xC2, 0x0B, 0xEF,
-    0xA7, 0x3F, 0x4C, 0xDD, 0x81, 0x13, 0xFF, 0x8E, 0xFD, 0xC9, 0x7E, 0x09, 0x72, 0x7E, 0x06, 0xFE,
-    0x96, 0xE5, 0xE6, 0xC5, 0x37, 0x60, 0x55, 0x1B, 0xE8, 0x6F, 0xB3, 0xB9, 0x71, 0x56, 0x01, 0x1D,
-    0x6E, 0xDA, 0x11, 0x54, 0x58, 0x2C, 0x1F, 0x94, 0x03, 0xDC, 0xD1, 0xAF, 0x1A, 0x83, 0xBE, 0xD6,
-    0x08, 0x42, 0x6C, 0x33, 0xC0, 0xAF, 0x18, 0xB9, 0x8E, 0xEE, 0x13, 0x6A, 0x2F, 0xE9, 0x6B, 0x10,
-    0xD0, 0x04, 0x36, 0x65, 0xB5, 0x6D, 0xFA, 0x7E, 0x99, 0x99, 0xEF, 0xF1, 0x86, 0xB3, 0x32, 0x6C,
-    0x2C, 0xEA, 0xE6, 0x61, 0x15, 0xD4, 0x85, 0x6D, 0xC6, 0x40, 0x4C, 0xBB, 0xA5, 0x84, 0xB1, 0x82,
-    0xAA, 0x4A, 0xED, 0x3F, 0xD6, 0x87, 0x94, 0xF6, 0x7B, 0x94, 0xAE, 0xCB, 0xEA, 0x9F, 0x75, 0x28,
-    0x1B, 0x0E, 0x9B, 0xDA, 0x12, 0x5D, 0x2B, 0x39, 0x8A, 0x0F, 0xBE, 0xA5, 0xB4, 0x3F, 0xF8, 0x36,
-    0xA4, 0x57, 0x96, 0x85, 0xCE, 0xA5, 0x60, 0x64, 0x91, 0xC7, 0x74, 0x57, 0x9F, 0x41, 0x60, 0x91,
-    0x66, 0x94, 0x87, 0x0B, 0x99, 0x1E, 0x44, 0xDD, 0x01, 0xEA, 0x89, 0x43, 0xCB, 0x01, 0x35, 0xA2,
-    0xB5, 0x6B, 0xAE, 0xAD, 0x48, 0xE3, 0x46, 0x55, 0x65, 0x3C, 0x29, 0x76, 0x1A, 0xD5, 0xEE, 0x65,
-    0x6A, 0x43, 0xAE, 0xC6, 0x6E, 0x50, 0x7B, 0x3A, 0xA7, 0xEE, 0xDC, 0xF3, 0xA4, 0xD8, 0xB9, 0x5F,
-    0xC3, 0x5B, 0x9E, 0x62, 0x6A, 0x5E, 0x7F, 0x00, 0xF5, 0xAE, 0xA5, 0xBD, 0x02, 0x6C, 0xE7, 0x09,
-    0xB1, 0xF0, 0xDA, 0x33, 0xD4, 0x55, 0x10, 0x8F, 0xAD, 0x7C, 0x41, 0x93, 0xFB, 0x90, 0x3C, 0xF2,
-    0xFA, 0x72, 0x2D, 0x7C, 0x56, 0xB5, 0x97, 0x8C, 0xB2, 0x49, 0xC9, 0xE3, 0x4C, 0x72, 0x72, 0xF4,
-    0x9E, 0xD8, 0xF0, 0x25, 0xDA, 0x06, 0x0E, 0xAB, 0x86, 0x7D, 0xAD, 0xFC, 0xE4, 0x3A, 0xCF, 0xF6,
-    0xD5, 0xD8, 0xE2, 0xD0, 0x6E, 0x10, 0x29, 0x4D, 0x39, 0x12, 0x56, 0x74, 0xA5, 0x11, 0x56, 0x94,
-    0xA5, 0xF2, 0x30, 0x94, 0x56, 0x15, 0xE6, 0xC4, 0x15, 0xC3, 0xF7, 0x64, 0xB0, 0x7E, 0x4D, 0x88,
-    0xB4, 0xD5, 0x70, 0x4B, 0xA6, 0x82, 0x8A, 0x7B, 0x2F, 0x17, 0x5A, 0x83, 0x6A, 0x17, 0xAB, 0xD0,
-    0xD6, 0x5C, 0x9F, 0x95, 0xEA, 0xDC, 0x10, 0xCC, 0x66, 0x86, 0xF6, 0x61, 0x86, 0x47, 0x04, 0x9A,
-    0x01, 0x69, 0x0D, 0xDA, 0xB8, 0xF8, 0xC1, 0xCB, 0x7D, 0xE9, 0x0E, 0x70, 0x63, 0x39, 0x02, 0xAD,
-    0x45, 0x64, 0x9E, 0xB3, 0xBD, 0x98, 0x02, 0xB2, 0xDC, 0x5C, 0xB6, 0xAA, 0x2E, 0x6D, 0x73, 0xFA,
-    0x86, 0x00, 0x86, 0xC9, 0x70, 0x46, 0x01, 0x7D, 0x18, 0x46, 0xC3, 0x16, 0xDD, 0x1E, 0x89, 0xD6,
-    0x48, 0xB4, 0x47, 0x0D, 0x1C, 0x17, 0x1F, 0x62, 0x15, 0xDE, 0x14, 0x7B, 0xC0, 0xF9, 0xB7, 0x4B,
-    0xDC, 0x6D, 0x93, 0x71, 0xA8, 0x9B, 0x95, 0x44, 0x57, 0x30, 0xC2, 0x77, 0x6F, 0xD3, 0xE8, 0x32,
-    0x1E, 0x71, 0x46, 0x9F, 0x6F, 0x1D, 0x8D, 0x96, 0x06, 0xF1, 0xC6, 0x78, 0x61, 0x80, 0xE3, 0xEC,
-    0x88, 0x7F, 0x7F, 0x7D, 0x87, 0x73, 0x6D, 0x54, 0x02, 0x83, 0x9E, 0xE4, 0x54, 0xF7, 0x71, 0x9E,
-    0x32, 0x26, 0xFC, 0x4F, 0x7E, 0x41, 0xEE, 0xB5, 0x33, 0xE4, 0x15, 0x23, 0x53, 0x49, 0xEF, 0xAB,
-    0x55, 0x54, 0x1F, 0x69, 0xC3, 0x28, 0x26, 0x70, 0xAD, 0x1B, 0x1F, 0xDC, 0x3E, 0xDF, 0x8E, 0xBA,
-    0xA4, 0x1A, 0x43, 0x30, 0xD1, 0x71, 0xF4, 0x46, 0x92, 0x76, 0x93, 0x8D, 0xE7, 0xFF, 0x63, 0xB4,
-    0x45, 0x01, 0xA3, 0xD4, 0x98, 0x33, 0xE0, 0x57, 0xE0, 0xA2, 0x79, 0x34, 0x1A, 0xA8, 0x89, 0x1E,
-    0xB7, 0x2D, 0x87, 0x2C, 0x28, 0x07, 0x67, 0xAD, 0xC5, 0xFE, 0xD1, 0x7A, 0xE3, 0xB1, 0x9A, 0x31,
-    0x05, 0xAD, 0x54, 0x5F, 0x55, 0xAC, 0x90, 0xDC, 0x8E, 0x1A, 0x11, 0x6B, 0xF0, 0x30, 0x88, 0xAC,
-    0x56, 0x70, 0x5E, 0x25, 0x1D, 0x6B, 0x9D, 0x4A, 0x87, 0x07, 0x93, 0x2C, 0x88, 0x2A, 0xA5, 0x61,
-    0xAD, 0x77, 0xB5, 0xD6, 0x5A, 0xAF, 0xF8, 0x58, 0x6C, 0x5C, 0xEA, 0x75, 0xAB, 0xD6, 0x72, 0xB6,
-    0x1A, 0x84, 0x94, 0xB4, 0x59, 0xEB, 0x8C, 0xBE, 0x40, 0x7D, 0xFB, 0xAB, 0x80, 0x63, 0x1D, 0x28,
-    0xEE, 0xED, 0x44, 0x4E, 0x58, 0xE9, 0x28, 0xD8, 0x5F, 0x84, 0xBE, 0xBD, 0x66, 0x4D, 0x82, 0xD3,
-    0xB9, 0x04, 0x70, 0xE8, 0x53, 0x26, 0x1E, 0x0B, 0xE8, 0xE4, 0x75, 0x85, 0xE5, 0x7D, 0x5C, 0x7D,
-    0xF8, 0xFE, 0xF5, 0x82, 0x63, 0x9A, 0x1D, 0x1D, 0x39, 0xD4, 0xB1, 0x81, 0x1C, 0xDC, 0x51, 0x48,
-    0x3E, 0xFD, 0x6B, 0x75, 0x3F, 0x59, 0xF3, 0x12, 0x07, 0xCB, 0x6E, 0x5D, 0x7A, 0x10, 0x95, 0x42,
-    0x45, 0x9A, 0x96, 0xE2, 0xD2, 0xAA, 0xE2, 0x4F, 0x87, 0x94, 0x0C, 0xFA, 0x80, 0x60, 0x90, 0x80,
-    0x33, 0xE8, 0xC5, 0x42, 0xE2, 0xE0, 0xF6, 0xF7, 0x55, 0x77, 0xB9, 0x26, 0xA3, 0x62, 0x22, 0xE4,
-    0x10, 0xDD, 0xEC, 0xBB, 0x0F, 0xE8, 0x6E, 0xC7, 0xAA, 0x69, 0xFE, 0x58, 0x07, 0x06, 0x83, 0xF0,
-    0x38, 0xFD, 0x1E, 0xB1, 0x5D, 0xEC, 0x0A, 0xF1, 0xED, 0x81, 0x32, 0x53, 0xA7, 0xAB, 0x08, 0x0E,
-    0x40, 0x67, 0x19, 0x7A, 0x7E, 0x42, 0x9A, 0xE9, 0x79, 0x29, 0x4F, 0x33, 0x4E, 0x0E, 0x92, 0x0E,
-    0xA6, 0xCE, 0xDD, 0x06, 0x99, 0xB3, 0x7A, 0xAE, 0x82, 0x72, 0xDF, 0xD3, 0x34, 0xDD, 0xE2, 0x69,
-    0x59, 0x42, 0x32, 0xE4, 0x25, 0x09, 0x5F, 0x51, 0x84, 0xF3, 0xFF, 0xAA, 0x29, 0xE5, 0xD1, 0x5D,
-    0x99, 0x38, 0x3D, 0x85, 0x1A, 0x1B, 0xFE, 0x39, 0x58, 0xA0, 0x0B, 0x13, 0x41, 0xAB, 0x8C, 0xD3,
-    0xBC, 0xAF, 0xAA, 0x47, 0x33, 0xBF, 0xFA, 0x70, 0xF9, 0xA1, 0xB6, 0xDC, 0xDE, 0x51, 0x40, 0x27,
-    0x07, 0x85, 0x5F, 0x3B, 0xA0, 0xA8, 0xEA, 0x0E, 0x46, 0x6F, 0x8B, 0x80, 0xDE, 0x22, 0xA0, 0xB7,
-    0x08, 0xE8, 0x5B, 0x04, 0xF4, 0x2D, 0x86, 0x6C, 0x87, 0xE0, 0xDD, 0x87, 0x30, 0x7D, 0xF8, 0xD3,
-    0xEA, 0xB5, 0x18, 0x13, 0xFC, 0xE9, 0x66, 0xEA, 0x6A, 0x44, 0x37, 0xA4, 0x56, 0x94, 0xF5, 0xF6,
-    0x85, 0x9C, 0xAE, 0x8C, 0x86, 0x64, 0xAB, 0xB2, 0x88, 0xE1, 0xAF, 0xCA, 0x96, 0x88, 0x6E, 0x27,
-    0x0F, 0xB1, 0xD7, 0xC7, 0x6C, 0xD0, 0x39, 0x76, 0x0E, 0x3A, 0xD2, 0xE5, 0x3E, 0x8D, 0xCF, 0xED,
-    0x8B, 0x65, 0x06, 0x22, 0xFA, 0x92, 0x0C, 0xD2, 0xA6, 0x16, 0x66, 0x2F, 0x88, 0x3C, 0x18, 0x64,
-    0xC0, 0xB3, 0x6E, 0x32, 0xCE, 0x99, 0x1F, 0xAF, 0x2D, 0xC7, 0x08, 0xDE, 0x2D, 0x02, 0x67, 0xEB,
-    0xD3, 0xE0, 0xFD, 0xB8, 0x03, 0x05, 0x7E, 0xE0, 0x01, 0x4B, 0x9B, 0x20, 0x92, 0x85, 0xD8, 0xBF,
-    0xE1, 0x66, 0x58, 0x54, 0xA1, 0x07, 0xCE, 0xFC, 0x9B, 0x9F, 0xF3, 0x7B, 0x5E, 0xB7, 0x6F, 0xDC,
-    0xD0, 0x39, 0xDA, 0xBA, 0x44, 0x5B, 0xB3, 0xA1, 0xAD, 0x0E, 0x6D, 0x9D, 0xA1, 0xAD, 0x0D, 0xDA,
-    0x7A, 0x03, 0xB6, 0x9A, 0x14, 0xB6, 0xDA, 0x31, 0x6C, 0xF5, 0x68, 0xEB, 0x1C, 0x6D, 0x5D, 0xA2,
-    0xAD, 0x19, 0x6C, 0xB5, 0x12, 0xD8, 0xEA, 0x80, 0x39, 0xB5, 0x67, 0x68, 0x6B, 0x83, 0xB6, 0x12,
-    0x85, 0x70, 0xEF, 0x0E, 0x06, 0x86, 0xAD, 0x1E, 0x6D, 0x9D, 0x33, 0xBB, 0x1E, 0x3A, 0x37, 0xB6,
-    0x08, 0x0A, 0x64, 0x77, 0xFD, 0xA3, 0xE9, 0x3E, 0x96, 0x5F, 0x41, 0x99, 0x02, 0x37, 0x80, 0x9A,
-    0x80, 0x0D, 0x3A, 0x30, 0xE7, 0x1E, 0x08, 0x24, 0xFD, 0x98, 0x51, 0x02, 0x39, 0x1C, 0xAE, 0x5D,
-    0x75, 0xAB, 0x45, 0xF1, 0x0D, 0x78, 0x01, 0x89, 0x2C, 0xF5, 0x62, 0x0E, 0xEA, 0xEB, 0x9E, 0x02,
-    0x7C, 0xE7, 0x29, 0xA2, 0xCE, 0xA8, 0x3C, 0x22, 0xDC, 0x57, 0x99, 0x53, 0xD9, 0xD0, 0x4F, 0x6E,
-    0xF2, 0x1A, 0x43, 0x86, 0xCA, 0xA0, 0xA1, 0x57, 0xEC, 0x8C, 0xF2, 0x6D, 0x74, 0xD6, 0xAE, 0x5A,
-    0x6D, 0x60, 0x5A, 0x79, 0x45, 0x2E, 0x1F, 0x66, 0xF1, 0x4F, 0x88, 0xB5, 0xBA, 0x14, 0xB6, 0x95,
-    0x14, 0x2A, 0x0A, 0xCA, 0xC2, 0xBC, 0xC2, 0x89, 0xA7, 0xAE, 0x35, 0x4F, 0x96, 0xB5, 0xD7, 0x9E,
-    0x22, 0xC0, 0xF5, 0x42, 0x25, 0xB3, 0xEA, 0xE1, 0xB3, 0x5F, 0x79, 0x22, 0xBD, 0x7A, 0x4E, 0xAA,
-    0xDE, 0x5B, 0x75, 0x0B, 0xDD, 0x77, 0x9F, 0x1F, 0xEF, 0x72, 0xED, 0xF2, 0x54, 0xD9, 0x5B, 0xBC,
-    0x27, 0x8B, 0x1F, 0x83, 0xAE, 0x7B, 0x11, 0x2C, 0x9A, 0xAD, 0x48, 0x1B, 0x9A, 0x0E, 0xBB, 0x27,
-    0x58, 0x87, 0xF4, 0x99, 0x31, 0x1D, 0xC6, 0xA1, 0xC5, 0xCD, 0x95, 0x90, 0xDB, 0x39, 0xC1, 0x68,
-    0x61, 0xE0, 0x8F, 0xE0, 0xFF, 0x11, 0x12, 0xC7, 0xEE, 0x3F, 0xCD, 0x82, 0x0E, 0x75, 0xED, 0x12,
-    0x72, 0x6F, 0x92, 0x4C, 0xA2, 0x5A, 0xA4, 0xA8, 0x70, 0x68, 0xAC, 0x9B, 0xB6, 0x39, 0x71, 0x8F,
-    0x6D, 0xDF, 0x41, 0xD5, 0xB1, 0x9C, 0x7D, 0x8A, 0x20, 0x52, 0x5A, 0xE0, 0x50, 0xC0, 0x49, 0x2D,
-    0xEA, 0x5B, 0xE5, 0x96, 0x53, 0x97, 0xCB, 0x9E, 0xC1, 0x9B, 0x75, 0x5A, 0xEB, 0xF4, 0x74, 0x4B,
-    0xBE, 0x5D, 0x6D, 0x7F, 0xD6, 0xF0, 0xD2, 0xE5, 0x8A, 0xDA, 0x2E, 0x48, 0x4E, 0x30, 0x30, 0x69,
-    0x4A, 0xC4, 0x4D, 0x8B, 0x50, 0xB7, 0x2E, 0x16, 0x28, 0xA7, 0x3B, 0x82, 0x65, 0xCF, 0xDE, 0xBE,
-    0x7B, 0x1F, 0xD7, 0xF4, 0xB5, 0xA2, 0xFB, 0x4D, 0x5D, 0x9A, 0x34, 0x47, 0x81, 0xB5, 0xF2, 0xA0,
-    0xDA, 0x3F, 0x22, 0x57, 0xC9, 0xB8, 0x4A, 0x87, 0x8F, 0x00, 0x6F, 0x58, 0x35, 0x62, 0xE6, 0xEE,
-    0xAD, 0x08, 0x3E, 0xF5, 0x6E, 0x27, 0x58, 0x0A, 0x7B, 0x57, 0x12, 0xB4, 0x1A, 0xFF, 0x74, 0x86,
-    0xD9, 0x07, 0x86, 0x26, 0x06, 0x1A, 0x86, 0x6A, 0x69, 0xA7, 0xBD, 0x51, 0xD7, 0x10, 0x55, 0x8B,
-    0x94, 0x0B, 0xDA, 0xBE, 0xCB, 0x68, 0x54, 0xAA, 0x34, 0x94, 0x98, 0xAC, 0x8B, 0x9E, 0x1B, 0xBB,
-    0x31, 0x72, 0xB6, 0xF7, 0x4B, 0xFB, 0x42, 0x61, 0x0A, 0xD0, 0x89, 0x0C, 0x86, 0x24, 0x76, 0xE6,
-    0x47, 0x4E, 0x4A, 0x9F, 0x10, 0x59, 0x5B, 0x38, 0x3A, 0xB8, 0xB9, 0x03, 0x16, 0xB4, 0x29, 0xED,
-    0xA8, 0x23, 0x77, 0xA5, 0x65, 0x2F, 0x4A, 0xF8, 0xCB, 0xE0, 0xEF, 0x7E, 0x0F, 0x66, 0x6B, 0xED,
-    0x90, 0xBD, 0x92, 0xBA, 0x31, 0x03, 0x4E, 0xD4, 0x4F, 0x5B, 0xA2, 0x09, 0x8E, 0x5F, 0xB3, 0x55,
-    0xAE, 0x4E, 0xB8, 0x38, 0xE1, 0xDA, 0x64, 0xC8, 0x56, 0x27, 0x31, 0x3E, 0x23, 0x1A, 0xE4, 0xC7,
-    0xE4, 0xB5, 0xC1, 0x0D, 0x49, 0xDB, 0xE9, 0x28, 0xBF, 0x27, 0x31, 0x36, 0xD7, 0x33, 0x0B, 0xC8,
-    0x2F, 0xAE, 0x66, 0xC6, 0xFB, 0xE1, 0x44, 0xFC, 0xF2, 0x16, 0xC6, 0xB9, 0x8B, 0xDC, 0x40, 0x85,
-    0xCF, 0xC0, 0x27, 0x3C, 0x3B, 0x8C, 0xF9, 0x77, 0x27, 0xA7, 0xC3, 0xDD, 0x36, 0xDD, 0x48, 0xB6,
-    0x2E, 0x5E, 0xBD, 0x9A, 0x59, 0x85, 0xB5, 0x63, 0xE7, 0x6E, 0x6A, 0x7A, 0x3A, 0x56, 0x6E, 0xE7,
-    0x01, 0x4A, 0xDA, 0xC9, 0x38, 0x9E, 0xCF, 0xD1, 0x6E, 0xF1, 0xD9, 0xA1, 0x57, 0x66, 0x90, 0x7E,
-    0xCA, 0x12, 0x65, 0x2F, 0xEF, 0xE8, 0x36, 0x09, 0x6A, 0x81, 0xD4, 0xDC, 0xBC, 0x97, 0x39, 0x51,
-    0x70, 0xE7, 0xF4, 0x60, 0x8B, 0xF4, 0xA9, 0xDB, 0x63, 0x9A, 0x98, 0x9A, 0x4B, 0xB5, 0xDA, 0xB1,
-    0x55, 0xA0, 0x96, 0x52, 0x17, 0x1C, 0x1C, 0x57, 0x45, 0xBB, 0x74, 0xBF, 0xF3, 0xC8, 0xD1, 0xD2,
-    0xED, 0xF2, 0x39, 0x2C, 0xF1, 0x0A, 0x4C, 0x38, 0x25, 0xD3, 0x55, 0x6A, 0xAE, 0x7D, 0xD3, 0xAB,
-    0x1E, 0xFC, 0x3D, 0xBB, 0x85, 0x53, 0x51, 0x67, 0x3F, 0x29, 0x2D, 0x77, 0x62, 0x88, 0x64, 0xE3,
-    0xD9, 0xEF, 0xC2, 0x82, 0x56, 0x37, 0xB2, 0x72, 0x3F, 0x76, 0x52, 0xA0, 0x44, 0xE2, 0xC7, 0x41,
-    0x14, 0x46, 0xA1, 0x6C, 0x49, 0xCB, 0x29, 0xB8, 0x25, 0x2C, 0x9D, 0xE8, 0xBF, 0xE8, 0xAD, 0x76,
-    0xDA, 0x3E, 0x7B, 0xED, 0x36, 0x91, 0xF1, 0x81, 0xB2, 0xBA, 0x8A, 0x41, 0xF6, 0x7B, 0x67, 0x22,
-    0x69, 0xD8, 0xBB, 0xD9, 0x3F, 0x89, 0xF1, 0x9F, 0x41, 0x86, 0x86, 0x75, 0x86, 0x1E, 0x1A, 0xCB,
-    0xD0, 0x09, 0x8C, 0x3D, 0x15, 0x31, 0xE7, 0xE0, 0x74, 0xDD, 0x34, 0x3B, 0x7E, 0x2D, 0x40, 0xCE,
-    0xD8, 0x59, 0x15, 0x61, 0xFC, 0xE8, 0x03, 0xE5, 0xEA, 0x91, 0x72, 0xF8, 0x8E, 0x97, 0x1B, 0x75,
-    0xA5, 0xAB, 0xD0, 0xD7, 0x54, 0x37, 0x46, 0xD5, 0x6D, 0x28, 0x4E, 0x22, 0x3A, 0x9A, 0x0C, 0x62,
-    0xE8, 0x8E, 0x16, 0x6D, 0x31, 0x2F, 0x0C, 0x34, 0xE8, 0x61, 0xF5, 0xFB, 0x8E, 0x78, 0xB9, 0xE6,
-    0xD3, 0x39, 0x52, 0x74, 0x24, 0x15, 0xE8, 0x39, 0xC8, 0x79, 0x35, 0xA7, 0xCF, 0x31, 0xCE, 0xB1,
-    0xE9, 0x68, 0xD5, 0x4B, 0xF0, 0xBB, 0xDF, 0x1A, 0x3E, 0x08, 0xFB, 0x1C, 0xC6, 0x54, 0x1B, 0xEF,
-    0x47, 0xC5, 0xFF, 0x08, 0x7F, 0xA3, 0x3C, 0x09, 0xF3, 0x3E, 0x02, 0x79, 0xB4, 0xDE, 0x61, 0x98,
-    0xFE, 0x33, 0x1F, 0x3E, 0xE4, 0x76, 0xE1, 0x16, 0x6E, 0xCA, 0x96, 0xC2, 0x8D, 0xD1, 0xEA, 0x68,
-    0x41, 0x55, 0x47, 0x0F, 0x27, 0xEB, 0x40, 0x1B, 0xCA, 0x2B, 0xA6, 0xBB, 0x82, 0xD7, 0xFB, 0xD5,
-    0xD3, 0xF3, 0xFD, 0x75, 0x43, 0xF2, 0x8B, 0xE7, 0xE4, 0xEB, 0xE5, 0x86, 0x5C, 0x0B, 0xB2, 0xE1,
-    0xDA, 0x08, 0xEE, 0x8E, 0x83, 0x7F, 0x60, 0xDC, 0x7F, 0xFE, 0x38, 0xB7, 0xFF, 0x66, 0xE5, 0x4E,
-    0xCF, 0xCA, 0xDD, 0x9C, 0x05, 0x6C, 0x67, 0x2C, 0x33, 0x0F, 0x61, 0xF5, 0x23, 0x37, 0xE1, 0xD3,
-    0x36, 0x3E, 0x6C, 0x5B, 0xA8, 0x8F, 0x55, 0xF1, 0xEE, 0x6C, 0xEA, 0x22, 0x11, 0xFE, 0xE7, 0xF2,
-    0x8B, 0xC5, 0x63, 0x0F, 0x8B, 0x67, 0x69, 0x97, 0x84, 0xB8, 0xDB, 0x20, 0xE9, 0xD7, 0x13, 0xAB,
-    0x70, 0x32, 0x8C, 0x99, 0x7B, 0xB0, 0x1B, 0xEB, 0xD5, 0xDA, 0x6E, 0xAB, 0xE8, 0x3C, 0x64, 0x3B,
-    0xDC, 0x08, 0xA8, 0xA1, 0xED, 0xFE, 0x4F, 0xFB, 0x8F, 0x14, 0xCF, 0xB0, 0x75, 0x34, 0x1F, 0x6E,
-    0x1D, 0x13, 0x19, 0x9F, 0x62, 0x50, 0x17, 0xCF, 0x15, 0xE4, 0xD5, 0x78, 0xF1, 0x4C, 0x60, 0x7C,
-    0x6D, 0x1D, 0xC5, 0x1C, 0x5A, 0xC7, 0x4D, 0xC9, 0xF8, 0xC0, 0xDD, 0x4C, 0xCE, 0x76, 0x2D, 0x4C,
-    0x24, 0x19, 0x8F, 0x43, 0x63, 0x0B, 0x85, 0x49, 0x8C, 0x3D, 0x5D, 0xF3, 0x35, 0xD2, 0x82, 0xE9,
-    0xDD, 0x90, 0xEE, 0x3E, 0x03, 0x3F, 0xBF, 0xAB, 0x6F, 0x6A, 0xEC, 0xDA, 0xBD, 0xBB, 0xD7, 0xF2,
-    0x7F, 0x1D, 0x06, 0xAF, 0x60, 0xFA, 0x6F, 0x23, 0x55, 0x3A, 0xE0, 0x49, 0xE8, 0x0F, 0xDC, 0xB0,
-    0x76, 0x76, 0x50, 0xC3, 0x47, 0xA8, 0xF9, 0x24, 0xBB, 0x0B, 0xEC, 0x08, 0xBE, 0x91, 0xF4, 0x25,
-    0xF8, 0x66, 0x04, 0xF1, 0x0A, 0xAE, 0x0B, 0x96, 0xC9, 0xC1, 0xD0, 0x92, 0xC8, 0xCB, 0xC0, 0x50,
-    0x3F, 0x06, 0xE1, 0x99, 0x25, 0xA3, 0x39, 0x39, 0x35, 0x7A, 0x68, 0x35, 0xA4, 0x2C, 0xCE, 0xA7,
-    0x29, 0x0B, 0x4A, 0xF0, 0x2D, 0xD4, 0x20, 0xD7, 0x62, 0x3D, 0x80, 0x4B, 0xC1, 0xFF, 0x69, 0x70,
-    0x13, 0x5B, 0x0F, 0xC2, 0x4D, 0x95, 0xD7, 0x1E, 0xF2, 0xDA, 0x47, 0x5E, 0x87, 0x38, 0xAE, 0xC6,
-    0xA1, 0xF5, 0x93, 0x38, 0xB8, 0xEB, 0xDD, 0xF1, 0x7A, 0x75, 0x5E, 0x6B, 0xDE, 0x91, 0x25, 0x32,
-    0xB9, 0x4F, 0xD4, 0x79, 0x1D, 0x4D, 0x70, 0x7C, 0x3E, 0xD2, 0xEA, 0xF2, 0x29, 0x4C, 0x2C, 0xCE,
-    0xED, 0x44, 0x66, 0x4D, 0x36, 0xEC, 0x39, 0x13, 0x19, 0x7F, 0xAF, 0x5C, 0xD3, 0x7F, 0x60, 0xF0,
-    0x71, 0x4C, 0xC9, 0x9A, 0xC8, 0x04, 0xC7, 0xAE, 0x89, 0x3D, 0xF7, 0x87, 0xB4, 0x69, 0x6A, 0x47,
-    0xAD, 0xFE, 0x8D, 0x66, 0x48, 0xEC, 0x8F, 0xAF, 0xC9, 0x06, 0x80, 0xD0, 0xE8, 0x46, 0x6C, 0x87,
-    0x74, 0xBE, 0x49, 0xA6, 0xDC, 0xAC, 0x9F, 0x06, 0x77, 0xB8, 0x67, 0xD4, 0x62, 0xCC, 0x42, 0xC2,
-    0x78, 0x48, 0x9E, 0xEF, 0x9F, 0x26, 0x55, 0xBE, 0xC2, 0xE1, 0x7E, 0xCF, 0x24, 0x26, 0xB9, 0x76,
-    0x8A, 0xE1, 0xDA, 0x41, 0x17, 0xB9, 0xAA, 0xA7, 0x39, 0xDC, 0xBD, 0x77, 0xF1, 0xF9, 0x6B, 0x64,
-    0x33, 0xED, 0x62, 0x38, 0x3D, 0xA3, 0x7B, 0x97, 0x41, 0x32, 0x5C, 0x6C, 0x54, 0xAB, 0x83, 0xD1,
-    0x82, 0x39, 0xE4, 0x2D, 0x0B, 0x21, 0x46, 0x5E, 0xCD, 0xD0, 0xFD, 0xB7, 0x90, 0xF6, 0xA0, 0x8D,
-    0x21, 0xA9, 0x41, 0x58, 0xFD, 0xF3, 0x80, 0x29, 0x20, 0xB0, 0x54, 0x6A, 0x55, 0x76, 0x43, 0x35,
-    0x6A, 0x02, 0x7E, 0xC2, 0x3C, 0xF1, 0x81, 0x9B, 0x10, 0xCF, 0xB9, 0xB3, 0xE0, 0xF1, 0x01, 0x86,
-    0x7F, 0x6A, 0x34, 0xF0, 0x48, 0x28, 0xDD, 0x6E, 0x53, 0x6D, 0x57, 0x97, 0xBB, 0xBA, 0xB3, 0xA9,
-    0x5B, 0x9B, 0x95, 0x98, 0x32, 0xE3, 0xEB, 0xDF, 0xC7, 0xEF, 0xA6, 0x7F, 0x03, 0xCD, 0x5B, 0x31,
-    0x8C, 0x1C, 0x67, 0x15, 0x7E, 0xFF, 0x8C, 0x7D, 0x13, 0x31, 0xCA, 0x8D, 0x8B, 0x18, 0x23, 0x1C,
-    0xDF, 0x50, 0x50, 0x20, 0xEB, 0x9C, 0x69, 0x52, 0x58, 0x68, 0xEF, 0x66, 0x42, 0x0A, 0x0A, 0x0A,
-    0xAE, 0xC8, 0x41, 0x61, 0x21, 0x5C, 0x50, 0xA0, 0x50, 0x9C, 0x0B, 0x17, 0x11, 0xE4, 0x76, 0x87,
-    0xD0, 0x91, 0x02, 0x23, 0x21, 0xDA, 0x5C, 0x81, 0x84, 0x73, 0x44, 0xF8, 0x0A, 0x17, 0x29, 0x6E,
-    0x6F, 0x87, 0xA4, 0xA0, 0x40, 0x48, 0x23, 0x50, 0x44, 0x83, 0x60, 0x40, 0x01, 0x09, 0x1B, 0xF0,
-    0x98, 0x4C, 0xC4, 0xDC, 0x65, 0x76, 0x87, 0xF7, 0xBD, 0xFF, 0x9F, 0xD9, 0xD9, 0xB3, 0xE3, 0x18,
-    0xFB, 0xBC, 0xF6, 0xFA, 0xF6, 0xDF, 0xF3, 0xDE, 0xEC, 0xFC, 0xEF, 0x7D, 0xFF, 0xFB, 0xDF, 0xFB,
-    0xDE, 0x7B, 0xFF, 0x12, 0xD1, 0xFA, 0x3A, 0x11, 0x59, 0xF5, 0x84, 0x47, 0xB5, 0xFE, 0x12, 0xB5,
-    0x0F, 0x2F, 0xC2, 0x18, 0xC6, 0x18, 0x07, 0x32, 0xD6, 0x09, 0xAE, 0xFC, 0x33, 0x46, 0xFB, 0x37,
-    0x18, 0x5D, 0x37, 0xE5, 0x71, 0xC9, 0xC1, 0xD8, 0x73, 0x32, 0x1E, 0x2F, 0xDB, 0x18, 0x73, 0x3B,
-    0xE7, 0x0B, 0x53, 0x8C, 0xF6, 0x7B, 0x5F, 0xE7, 0xD1, 0xAB, 0xEB, 0x82, 0x2F, 0x24, 0xC5, 0x63,
-    0x8F, 0x54, 0x49, 0x74, 0x9D, 0xA8, 0xE2, 0x0B, 0x31, 0xE2, 0x23, 0x15, 0x9D, 0x2E, 0x68, 0x61,
-    0x12, 0x8D, 0x26, 0x14, 0xF2, 0x34, 0xC7, 0xD7, 0xD7, 0x28, 0xA8, 0x73, 0x3A, 0xB9, 0x2E, 0x42,
-    0x90, 0xB3, 0xFF, 0x0C, 0x0D, 0x2E, 0x14, 0xAA, 0xB0, 0x73, 0x27, 0xB3, 0x73, 0x2F, 0xB1, 0x33,
-    0x3F, 0x72, 0xD2, 0x90, 0x5C, 0x7E, 0x7A, 0x49, 0x9F, 0x9F, 0x43, 0xF2, 0xE3, 0x21, 0x85, 0xD1,
-    0x2E, 0x0D, 0xA2, 0x21, 0xDD, 0xA2, 0xBE, 0xBD, 0x41, 0xE1, 0x2F, 0x83, 0x7F, 0xFB, 0xA5, 0x57,
-    0x50, 0xA4, 0x70, 0x97, 0x78, 0x01, 0x63, 0xB6, 0x88, 0x71, 0x52, 0x89, 0x76, 0x39, 0x46, 0x45,
-    0x4F, 0x86, 0xD6, 0x9F, 0xA1, 0x8B, 0x74, 0x46, 0xA5, 0xE4, 0xDD, 0x4A, 0xC8, 0xC1, 0x7A, 0xAC,
-    0xD1, 0x11, 0x6A, 0xFF, 0x38, 0x35, 0xE3, 0xC7, 0x2B, 0x18, 0x6C, 0xDC, 0x99, 0xDC, 0x78, 0x2A,
-    0x8F, 0xA7, 0x7F, 0xAF, 0x31, 0x5A, 0xE3, 0x23, 0xD0, 0x75, 0x89, 0x6F, 0xCB, 0x52, 0x59, 0x2C,
-    0x04, 0x04, 0x11, 0xC9, 0x21, 0xC1, 0x08, 0x13, 0x29, 0x20, 0xEA, 0x42, 0x25, 0x1F, 0xFF, 0x5D,
-    0xC1, 0xAC, 0x62, 0x02, 0x51, 0xB3, 0xFE, 0x1B, 0x13, 0xC8, 0xB0, 0x91, 0x52, 0x10, 0xBB, 0x39,
-    0xED, 0xF1, 0xE7, 0xAD, 0x92, 0xC5, 0xE6, 0xDB, 0x28, 0xF2, 0x20, 0xBD, 0x0F, 0x6D, 0x02, 0x7C,
-    0x3A, 0xC4, 0x87, 0x42, 0x81, 0xB3, 0x1D, 0xFA, 0xED, 0x20, 0xFF, 0x95, 0xBF, 0xF2, 0xC5, 0x9F,
-    0x21, 0x2F, 0x63, 0x88, 0xEC, 0xC9, 0x35, 0x9E, 0x6D, 0x50, 0xC7, 0xCD, 0xDA, 0x42, 0x1E, 0xE0,
-    0x0C, 0x14, 0x9E, 0x23, 0x41, 0xB1, 0x11, 0xC5, 0x65, 0x30, 0xFA, 0x83, 0xD8, 0x2A, 0xBC, 0xC4,
-    0x49, 0xDD, 0x84, 0xC7, 0x28, 0x88, 0xF4, 0x1D, 0x71, 0xFF, 0xE1, 0xA1, 0x67, 0x9F, 0x8E, 0xF1,
-    0xDF, 0x96, 0xC9, 0xBF, 0x51, 0x90, 0x53, 0xB3, 0xA0, 0xCF, 0xC8, 0x5D, 0xB0, 0x9F, 0xD5, 0x18,
-    0xC8, 0x03, 0x61, 0xEF, 0xAB, 0x7C, 0x87, 0x9E, 0xCD, 0x1A, 0x9C, 0x68, 0x35, 0x9E, 0xAF, 0xC2,
-    0x27, 0xF9, 0x39, 0xC2, 0x8A, 0x44, 0xE4, 0xFC, 0x3A, 0xA1, 0x25, 0x95, 0xB1, 0x28, 0x47, 0xA9,
-    0xB0, 0x3C, 0x76, 0x31, 0x40, 0x6B, 0x92, 0x5D, 0x7E, 0x82, 0xBA, 0x8F, 0xF9, 0x2A, 0x8C, 0xC7,
-    0x26, 0x3F, 0xF7, 0x8C, 0xD8, 0x1D, 0x29, 0x8F, 0x48, 0x61, 0x6C, 0x6E, 0x95, 0x9E, 0xC3, 0xAF,
-    0x45, 0x29, 0x72, 0x65, 0xD3, 0x8D, 0x7E, 0x7C, 0x56, 0x6F, 0xAD, 0xB8, 0xD6, 0x5C, 0x54, 0x27,
-    0xD1, 0x9D, 0x44, 0x79, 0xAD, 0xBD, 0x56, 0x5F, 0xEB, 0xAF, 0x01, 0xD0, 0x3A, 0x6A, 0x75, 0xCD,
-    0xD8, 0xEF, 0x8C, 0xFA, 0x1D, 0x7D, 0x8D, 0x00, 0xA1, 0x91, 0x30, 0x50, 0x18, 0x2C, 0x0C, 0x18,
-    0xF0, 0x44, 0x2A, 0x5B, 0x6A, 0x44, 0x15, 0x49, 0xC3, 0xA4, 0x2B, 0x27, 0x40, 0x01, 0x2A, 0x04,
-    0x58, 0x08, 0xB8, 0x10, 0x80, 0xA1, 0xA0, 0x5D, 0x0A, 0x99, 0x75, 0x78, 0x97, 0x01, 0x00, 0x09,
-    0x42, 0x02, 0x91, 0xC6, 0xA8, 0x01, 0x49, 0xBB, 0x40, 0x99, 0x99, 0xDE, 0x7E, 0x7B, 0xEA, 0xFA,
-    0x83, 0x64, 0x16, 0xA5, 0xB0, 0x3E, 0xE0, 0x89, 0x4E, 0x1F, 0x5C, 0x2B, 0xE0, 0x3A, 0xB0, 0x73,
-    0x18, 0x9A, 0x50, 0x36, 0x29, 0xEB, 0xC6, 0xEE, 0xD1, 0x4B, 0xEE, 0xF2, 0xC3, 0xCE, 0x84, 0x47,
-    0x16, 0x91, 0xC7, 0x50, 0x10, 0x0C, 0x05, 0x8B, 0xBE, 0x20, 0xB8, 0x29, 0x18, 0x0D, 0xC5, 0x22,
-    0x2B, 0x00, 0xCE, 0x23, 0xE3, 0xCF, 0x5E, 0x93, 0x55, 0x3F, 0xB5, 0xFF, 0x1D, 0x7E, 0x7B, 0x54,
-    0xD7, 0x57, 0x3A, 0x86, 0x51, 0x8B, 0x6F, 0xDC, 0x7B, 0x4E, 0x8C, 0xA7, 0x27, 0x16, 0x7D, 0x49,
-    0xC6, 0xB5, 0xC6, 0xA6, 0x9D, 0x7D, 0xC1, 0xEF, 0x02, 0x8B, 0x09, 0x57, 0x09, 0x01, 0x31, 0xC2,
-    0x5D, 0xF2, 0xFC, 0x11, 0x3C, 0x38, 0x5C, 0x26, 0x46, 0x96, 0x89, 0xFA, 0x32, 0x0E, 0xC5, 0xEB,
-    0x0D, 0x65, 0x55, 0xE1, 0x3C, 0xF1, 0xFB, 0x2D, 0x00, 0xC7, 0x0E, 0x94, 0xC4, 0x85, 0xF2, 0x67,
-    0xE1, 0x44, 0x1B, 0xBC, 0x1E, 0x08, 0x0D, 0x6B, 0x74, 0xE3, 0x0A, 0x2F, 0x59, 0x5D, 0x27, 0x47,
-    0x82, 0x86, 0x2B, 0xA1, 0x61, 0xCF, 0xEC, 0x23, 0xB5, 0x3D, 0xD9, 0x22, 0x6B, 0x7B, 0x82, 0xBF,
-    0x03, 0x81, 0x35, 0x1E, 0x02, 0xC4, 0xA2, 0xB1, 0x93, 0xB3, 0x70, 0x2C, 0x9E, 0x0B, 0x08, 0xFC,
-    0x98, 0x11, 0x10, 0x00, 0x44, 0x7F, 0x51, 0x5F, 0xB4, 0xAF, 0x20, 0x42, 0x05, 0xDD, 0x45, 0x75,
-    0xD1, 0x5C, 0x14, 0x17, 0xBD, 0x95, 0x56, 0x5B, 0x58, 0x47, 0x08, 0xF3, 0x69, 0xF8, 0x07, 0xFF,
-    0xAF, 0x1E, 0x93, 0x7F, 0xB0, 0x3D, 0x06, 0x02, 0x3D, 0x3D, 0x30, 0x0A, 0xE7, 0x31, 0xC5, 0x09,
-    0x01, 0xB7, 0x33, 0xF8, 0x37, 0xDE, 0x84, 0x54, 0x63, 0x63, 0xB0, 0x53, 0xAB, 0xDD, 0x6C, 0x6D,
-    0xB5, 0x22, 0x95, 0x20, 0x54, 0x26, 0xAC, 0xB7, 0x1B, 0x9F, 0xDA, 0x5F, 0x1F, 0x44, 0xAC, 0x75,
-    0x8D, 0x19, 0xD7, 0x78, 0xB2, 0xAC, 0x9D, 0xD9, 0x65, 0x05, 0xFB, 0xA3, 0xC8, 0xCA, 0xA1, 0x92,
-    0xC7, 0x90, 0xFA, 0x71, 0x10, 0x85, 0x51, 0xC8, 0x88, 0xF4, 0x9D, 0x82, 0xA1, 0x8A, 0x69, 0x18,
-    0x7D, 0x92, 0x93, 0xF8, 0x3C, 0xF1, 0xBA, 0xF7, 0x2C, 0x96, 0xCD, 0xBF, 0x16, 0x99, 0x3D, 0xD6,
-    0xBA, 0xA7, 0xB9, 0xA9, 0xF6, 0x79, 0xBA, 0x42, 0xCB, 0x2C, 0x84, 0x7F, 0x8B, 0x6D, 0xA7, 0x43,
-    0x6F, 0x8E, 0x44, 0x45, 0xFD, 0x80, 0xE9, 0xC2, 0xA4, 0xD8, 0x7B, 0x3C, 0x16, 0x15, 0xC9, 0xEC,
-    0x4F, 0x55, 0x99, 0x7D, 0xBA, 0xD6, 0xD9, 0xD5, 0x47, 0xA0, 0xE6, 0xFC, 0x14, 0xB1, 0x24, 0x12,
-    0x52, 0x43, 0x92, 0x5E, 0x6D, 0x3F, 0x17, 0x02, 0x5E, 0x2F, 0x7F, 0x78, 0x7D, 0x02, 0xB8, 0x62,
-    0x9E, 0x28, 0xBF, 0x2B, 0x51, 0x83, 0x2F, 0xB7, 0x12, 0xF8, 0xBE, 0xDB, 0x70, 0xD4, 0xE2, 0xCB,
-    0xE1, 0xB1, 0x84, 0x41, 0xCC, 0x77, 0x4D, 0xC5, 0x29, 0x48, 0xE8, 0x90, 0xC8, 0x21, 0x81, 0x23,
-    0x98, 0x0D, 0x5A, 0xC0, 0x84, 0xB1, 0x20, 0x80, 0x41, 0x40, 0x83, 0x00, 0x07, 0x01, 0x0F, 0x02,
-    0x20, 0x82, 0x88, 0x40, 0x22, 0x98, 0xDC, 0x67, 0xD0, 0xBA, 0x0F, 0xF2, 0xC6, 0x8E, 0xD2, 0x39,
-    0xD8, 0x28, 0x59, 0x1E, 0xBB, 0xC2, 0x3C, 0x15, 0xAC, 0xBF, 0x04, 0x96, 0xD1, 0x3D, 0xB8, 0x8C,
-    0xDA, 0xBE, 0xCA, 0xC3, 0xA8, 0xEC, 0xE3, 0x02, 0x0C, 0x31, 0xBB, 0x64, 0x16, 0x16, 0x17, 0xF0,
-    0xC5, 0x21, 0x22, 0xF8, 0x2A, 0x07, 0xF0, 0xAF, 0x8D, 0x11, 0xBF, 0xDF, 0xEF, 0xB2, 0x55, 0x82,
-    0x22, 0xE4, 0xC1, 0xB6, 0x57, 0x60, 0x19, 0xB9, 0xD7, 0x46, 0x0B, 0xD0, 0xAE, 0xE0, 0xEF, 0x63,
-    0x52, 0xFB, 0xA3, 0x67, 0xC9, 0x49, 0x42, 0xD0, 0xDA, 0x00, 0xEB, 0x1C, 0xE0, 0xBE, 0x72, 0xF3,
-    0x55, 0x0C, 0x7C, 0x99, 0xFF, 0xA5, 0x02, 0x9E, 0x9D, 0x85, 0x73, 0x7F, 0x82, 0x5C, 0x83, 0xB4,
-    0x2D, 0x30, 0x44, 0xFF, 0x90, 0xA5, 0xE5, 0x78, 0xB0, 0x57, 0x73, 0x5C, 0x88, 0x79, 0x23, 0x05,
-    0xB0, 0xBE, 0x15, 0x33, 0xEC, 0xF2, 0xE7, 0x55, 0x4E, 0xDE, 0xDF, 0x98, 0xC6, 0xA8, 0xD1, 0xFE,
-    0xD4, 0xB9, 0xD9, 0x77, 0x77, 0x6E, 0x73, 0x46, 0xE8, 0xA2, 0xC5, 0xF7, 0xB8, 0xEC, 0x20, 0x7C,
-    0x20, 0x62, 0xF9, 0xB0, 0x0B, 0x15, 0x3D, 0x46, 0x70, 0xEE, 0x87, 0x0F, 0xCF, 0x15, 0x21, 0x79,
-    0x60, 0xCF, 0x93, 0x0D, 0x43, 0xB2, 0x67, 0xB3, 0xAF, 0xC7, 0x0A, 0xD3, 0xFC, 0x81, 0x90, 0xE4,
-    0x17, 0x1B, 0x88, 0x84, 0xBE, 0x3F, 0xDF, 0x59, 0x9C, 0x63, 0x18, 0x9E, 0x6D, 0x13, 0x67, 0xC0,
-    0x84, 0x94, 0xF6, 0x31, 0x5B, 0x93, 0xD2, 0xA2, 0x8B, 0x0F, 0x30, 0x5E, 0xC0, 0xF8, 0x01, 0xE3,
-    0x09, 0x5A, 0x5F, 0x60, 0x7C, 0x74, 0x12, 0x30, 0x97, 0x39, 0x3D, 0x89, 0xF8, 0xC7, 0x64, 0x1B,
-    0xF2, 0x22, 0x84, 0x55, 0x16, 0xDF, 0x95, 0xE4, 0x03, 0x5E, 0x5A, 0xF2, 0xE0, 0x44, 0x48, 0xAB,
-    0xA6, 0x92, 0xEC, 0x11, 0xB7, 0xAF, 0x25, 0xF0, 0xDB, 0x35, 0xC4, 0x0F, 0x75, 0xD2, 0x0E, 0x2E,
-    0x19, 0x89, 0xF7, 0x0E, 0xB5, 0xFF, 0x0E, 0xB5, 0x2B, 0xED, 0x6B, 0xEB, 0xDE, 0xD4, 0x2F, 0xFC,
-    0x86, 0x12, 0x6A, 0x49, 0xA7, 0xC6, 0xE4, 0xF0, 0xE4, 0xA3, 0x3A, 0x11, 0x46, 0x47, 0xC7, 0x23,
-    0xBD, 0x90, 0x9C, 0x7B, 0xA8, 0x22, 0x27, 0x27, 0x3E, 0xAF, 0x83, 0x0D, 0xCF, 0x3A, 0x31, 0xEE,
-    0x76, 0xD7, 0x6C, 0x94, 0x52, 0x33, 0x0A, 0x55, 0x04, 0xB1, 0x75, 0xBB, 0xCE, 0xED, 0x0F, 0x7E,
-    0x90, 0xDB, 0xFF, 0xB2, 0x72, 0xA7, 0xB4, 0x72, 0x97, 0xA9, 0xA6, 0x9B, 0xDA, 0x19, 0x52, 0x37,
-    0x8F, 0xE3, 0x9F, 0x1F, 0xB9, 0x49, 0xC0, 0x42, 0xF3, 0x6A, 0xC7, 0xAB, 0xE6, 0xB9, 0x49, 0xDE,
-    0xCD, 0x5D, 0x72, 0x4A, 0x31, 0xF0, 0x4F, 0x86, 0x42, 0xD5, 0x78, 0xC4, 0xF4, 0xCD, 0xBF, 0xAD,
-    0x5F, 0xF8, 0x70, 0x2E, 0x50, 0xCC, 0xAA, 0xFC, 0xD9, 0xC9, 0xB6, 0x3C, 0x71, 0xB1, 0x2A, 0x8E,
-    0xB3, 0x64, 0xA3, 0xD4, 0xFE, 0xCF, 0xCD, 0xDC, 0xBE, 0x69, 0xE7, 0xCE, 0x3F, 0x8D, 0xCA, 0x19,
-    0x54, 0xE6, 0xE7, 0xFD, 0xA8, 0x0C, 0x53, 0xF5, 0x8B, 0x67, 0xE9, 0x8B, 0xF5, 0x75, 0xDA, 0x0A,
-    0xB2, 0xB6, 0xCE, 0x86, 0x82, 0x90, 0x01, 0x81, 0x74, 0xEA, 0x42, 0x8D, 0xAA, 0xED, 0x13, 0xEA,
-    0x35, 0xC9, 0x70, 0x93, 0x10, 0x6F, 0x9A, 0x98, 0x69, 0xB8, 0x15, 0xE4, 0x3C, 0x25, 0xD9, 0x42,
-    0x82, 0xA9, 0xBC, 0xF2, 0xE9, 0xD5, 0x7A, 0xF7, 0x52, 0x90, 0xEB, 0x69, 0x3E, 0x75, 0x95, 0xDC,
-    0x4A, 0xAE, 0x2B, 0x51, 0xA5, 0xB2, 0x90, 0x1D, 0xC8, 0x4F, 0xC6, 0xF1, 0x99, 0x93, 0x04, 0x72,
-    0xDB, 0x8C, 0xE5, 0x26, 0xF1, 0x76, 0x87, 0x0F, 0x3A, 0xCC, 0xBD, 0x1F, 0x81, 0xA0, 0x7C, 0x6B,
-    0xC6, 0x5E, 0x4F, 0x70, 0x76, 0x8B, 0x82, 0x59, 0x99, 0x8C, 0x40, 0x31, 0x67, 0x70, 0x24, 0xDB,
-    0x59, 0x6F, 0x65, 0x0A, 0xDF, 0x02, 0xE3, 0x82, 0x5E, 0xDD, 0x12, 0xA1, 0xDD, 0xE1, 0xD0, 0x8F,
-    0x40, 0x54, 0x8E, 0xAB, 0x9C, 0x32, 0x70, 0x4C, 0x45, 0x44, 0x95, 0x69, 0x1E, 0x44, 0xE0, 0x47,
-    0x20, 0x18, 0xDC, 0x17, 0xC2, 0x3D, 0x92, 0x64, 0xDF, 0x94, 0xF2, 0x60, 0xC8, 0xD6, 0x58, 0x63,
-    0x11, 0x88, 0x7F, 0x0E, 0x8D, 0x0F, 0x7D, 0x00, 0x5B, 0x70, 0x62, 0xED, 0xFF, 0x48, 0x6F, 0x9B,
-    0x51, 0x4E, 0x41, 0xD6, 0x29, 0xE5, 0x4C, 0xEE, 0x2C, 0xE5, 0x3C, 0x02, 0x2D, 0xCF, 0x6E, 0x05,
-    0xBC, 0xE1, 0xEC, 0x4C, 0x97, 0x86, 0xF8, 0x5F, 0xEC, 0x47, 0xF0, 0xEF, 0x70, 0xEF, 0xE1, 0x5B,
-    0x5E, 0xAE, 0x30, 0xEB, 0x3B, 0xF5, 0x84, 0xE7, 0x7D, 0x61, 0x50, 0x60, 0x56, 0x9E, 0x80, 0x47,
-    0x9E, 0x82, 0x67, 0x0F, 0x49, 0x27, 0xBF, 0x98, 0x79, 0x95, 0x74, 0x0E, 0xAC, 0x93, 0x60, 0x9D,
-    0x05, 0xE3, 0xB2, 0x0A, 0x72, 0x60, 0xCA, 0x50, 0xEA, 0xB8, 0x7D, 0xF1, 0x45, 0x9B, 0x22, 0xFF,
-    0x50, 0xC6, 0x4A, 0xF4, 0xA8, 0x70, 0x27, 0xBE, 0x8C, 0x3F, 0xCD, 0xB2, 0xF1, 0xC8, 0xD2, 0xE9,
-    0xAA, 0xAD, 0xD4, 0x50, 0x75, 0x65, 0xC6, 0xD4, 0x7F, 0x36, 0x9B, 0x04, 0x88, 0xD4, 0x05, 0x09,
-    0x59, 0x75, 0x34, 0x0D, 0xEC, 0x01, 0x38, 0x48, 0x88, 0x3F, 0x87, 0x08, 0x73, 0xC7, 0x3A, 0x1C,
-    0xE4, 0xEC, 0x16, 0xAF, 0x51, 0x90, 0xF3, 0x2A, 0xF1, 0xBC, 0x52, 0x41, 0x2E, 0x79, 0x69, 0x58,
-    0x2A, 0x37, 0x61, 0xA1, 0xD8, 0xE3, 0xE4, 0xBA, 0xB4, 0x01, 0xBF, 0xA3, 0xCB, 0x1B, 0x01, 0x16,
-    0x2D, 0xD0, 0x05, 0x17, 0x0F, 0x51, 0x96, 0x2D, 0x30, 0x7C, 0x2B, 0x40, 0x6A, 0x12, 0xC2, 0xD3,
-    0x88, 0x3C, 0xAB, 0x6D, 0xEA, 0x22, 0x22, 0x21, 0x6A, 0x5D, 0x80, 0xE3, 0x9B, 0x68, 0xA9, 0x64,
-    0x01, 0x25, 0xD9, 0xC1, 0xE0, 0xBE, 0xCE, 0xEA, 0x9C, 0xB3, 0x66, 0xF8, 0xF5, 0x00, 0xE6, 0xE6,
-    0xE3, 0x72, 0x21, 0x2A, 0x52, 0x12, 0x97, 0xEA, 0xB8, 0x7B, 0x28, 0xBF, 0x88, 0x1B, 0x20, 0xA6,
-    0xF9, 0xC5, 0xEA, 0x6C, 0xB1, 0xAA, 0x6A, 0xC5, 0x28, 0x1B, 0x59, 0x34, 0x0D, 0x6A, 0x07, 0xB9,
-    0xFB, 0xF4, 0xC6, 0xC8, 0x8F, 0x4E, 0x8E, 0xDB, 0x7A, 0x9E, 0x04, 0x2E, 0xA4, 0x1D, 0xA3, 0x94,
-    0xAC, 0xDB, 0x08, 0x5C, 0x97, 0x5B, 0x08, 0xAD, 0x6D, 0xA3, 0x43, 0x68, 0xE6, 0xDD, 0x34, 0x51,
-    0xAC, 0x13, 0xC9, 0x30, 0xA3, 0x65, 0xCC, 0xD3, 0x36, 0x39, 0x17, 0x54, 0x71, 0x1B, 0x13, 0x8D,
-    0x51, 0x38, 0x6A, 0x43, 0xC9, 0xA7, 0x61, 0x17, 0x57, 0xB4, 0x69, 0x0F, 0x2A, 0x18, 0x77, 0xA0,
-    0x8D, 0x4C, 0x8C, 0xFC, 0x55, 0x48, 0xAB, 0x24, 0x7C, 0x3B, 0xF2, 0xF9, 0x25, 0x91, 0x1A, 0xBC,
-    0xC2, 0x7B, 0x4D, 0xCA, 0xEB, 0x5F, 0x01, 0x4A, 0xC1, 0x00, 0x7A, 0x85, 0xFF, 0x95, 0xF1, 0x35,
-    0x49, 0x92, 0x24, 0x33, 0xDE, 0x14, 0x32, 0x3A, 0x44, 0x25, 0x58, 0x57, 0x64, 0x78, 0x64, 0xAA,
-    0xC4, 0xC8, 0xF8, 0xDA, 0xC8, 0x90, 0x3E, 0x26, 0xCD, 0x7E, 0x9E, 0xC9, 0xEE, 0x41, 0x49, 0x48,
-    0xEF, 0x7F, 0x1E, 0xA3, 0xD9, 0xF6, 0x0D, 0xBC, 0x80, 0x21, 0xBA, 0xBB, 0x2D, 0xE6, 0x65, 0xF3,
-    0x51, 0x55, 0x7C, 0x6A, 0x9B, 0xD3, 0x55, 0x77, 0x82, 0x42, 0x11, 0x87, 0xDC, 0xCC, 0xE5, 0xAD,
-    0x82, 0xC2, 0xA9, 0x9B, 0x80, 0x22, 0xBD, 0x0B, 0x45, 0xDE, 0xC0, 0x30, 0x42, 0x0D, 0xED, 0xF7,
-    0x3C, 0x4F, 0xA0, 0x77, 0x47, 0x05, 0x50, 0xF7, 0x30, 0x84, 0x90, 0x9D, 0x17, 0x61, 0x97, 0xDC,
-    0xA2, 0x2B, 0x59, 0xD9, 0x08, 0x66, 0x25, 0x8D, 0x58, 0xCA, 0xD8, 0xF5, 0x36, 0xEC, 0xFA, 0xA8,
-    0xA7, 0x7C, 0xA6, 0xD1, 0x4E, 0x0C, 0x47, 0x6C, 0x66, 0x69, 0x06, 0x2A, 0x69, 0xBA, 0x9C, 0x6E,
-    0x0D, 0xB7, 0x63, 0x5F, 0xE9, 0x8C, 0xE1, 0x7E, 0xAC, 0xF5, 0x36, 0xD9, 0x31, 0x0A, 0x65, 0x94,
-    0xA2, 0x52, 0x77, 0x38, 0x3B, 0x1E, 0xE8, 0xEC, 0xF8, 0x25, 0xD4, 0x5A, 0xD8, 0x90, 0xD8, 0x1B,
-    0xF7, 0x0C, 0x7B, 0x0D, 0x4B, 0x90, 0x7B, 0xAB, 0xF1, 0xB1, 0x33, 0xD1, 0x62, 0x36, 0x54, 0xAC,
-    0xCA, 0x1C, 0xBB, 0xF2, 0xA3, 0x3D, 0xF4, 0xDE, 0x0E, 0xEA, 0x80, 0xC7, 0xE6, 0xAA, 0x42, 0xFB,
-    0x90, 0xF6, 0x94, 0xD3, 0x92, 0xF2, 0x67, 0xA9, 0xE3, 0xE5, 0x99, 0x17, 0x78, 0x1D, 0x2D, 0x5A,
-    0x45, 0xEE, 0xD4, 0xA2, 0x09, 0x32, 0x6D, 0x9C, 0xB1, 0x0E, 0x12, 0xB8, 0x99, 0x13, 0x86, 0xF2,
-    0x7B, 0x42, 0xF7, 0xCF, 0xEB, 0x37, 0xC2, 0xFA, 0x57, 0x39, 0x6B, 0xF9, 0x25, 0x50, 0x40, 0x36,
-    0x6A, 0xA6, 0x58, 0xD0, 0xF2, 0xE9, 0x47, 0xA1, 0x65, 0x58, 0xAE, 0xD8, 0xC5, 0x2B, 0x56, 0x9E,
-    0xDB, 0xB7, 0x13, 0xFB, 0x2F, 0xD1, 0x23, 0x5F, 0x16, 0x17, 0x85, 0x71, 0xC6, 0x2C, 0x88, 0xC4,
-    0x4B, 0xAB, 0x07, 0x10, 0xF8, 0x9E, 0x76, 0xF4, 0x62, 0x1E, 0xD8, 0xF8, 0x09, 0x29, 0x7A, 0x68,
-    0x81, 0xD9, 0xD3, 0x79, 0x68, 0x81, 0xFA, 0x70, 0x1E, 0x41, 0xAA, 0xBB, 0x54, 0xE4, 0x40, 0x8C,
-    0xA7, 0xEF, 0x5F, 0x60, 0x9B, 0xE9, 0x7B, 0xD8, 0xB1, 0x8A, 0x56, 0x2C, 0x58, 0xC5, 0x9A, 0xFA,
-    0x28, 0xB1, 0x26, 0xE4, 0xE4, 0xA8, 0x20, 0xFD, 0xFC, 0x0E, 0xEA, 0xE1, 0xB6, 0x34, 0x74, 0x5A,
-    0xE4, 0xD2, 0x0E, 0x50, 0x15, 0x53, 0xE3, 0x34, 0x96, 0x49, 0x33, 0xD1, 0x93, 0xEF, 0xE7, 0x81,
-    0x80, 0x94, 0xE8, 0xB8, 0xCA, 0x5D, 0xE0, 0xDF, 0xD9, 0x17, 0xC2, 0xC5, 0x8F, 0x48, 0xC1, 0xCB,
-    0x07, 0x11, 0x5C, 0x93, 0xE7, 0x27, 0xC2, 0x9C, 0xBC, 0x14, 0x2F, 0x8B, 0x4E, 0x6E, 0xB3, 0x45,
-    0x9D, 0x61, 0x7E, 0xCF, 0xD3, 0x2E, 0x5B, 0xA5, 0x2B, 0x09, 0x62, 0x85, 0x29, 0xCE, 0xD3, 0x9E,
-    0x27, 0xC9, 0x67, 0x08, 0xC7, 0x72, 0x99, 0xC2, 0x6F, 0xF0, 0xCB, 0x0E, 0xF9, 0xFF, 0x94, 0x64,
-    0x54, 0x32, 0xBF, 0x4C, 0x88, 0xBE, 0xCA, 0x24, 0x93, 0x3F, 0x55, 0x48, 0xCD, 0x75, 0x50, 0x9B,
-    0x86, 0x2A, 0x8A, 0x57, 0x78, 0x03, 0x21, 0x06, 0x44, 0xAD, 0xD7, 0xA6, 0xB6, 0x4C, 0x6C, 0xE2,
-    0xE0, 0xA1, 0xD3, 0xA9, 0x27, 0x51, 0xE5, 0x99, 0x87, 0x4E, 0x8A, 0x75, 0xF6, 0xDE, 0x5C, 0xA0,
-    0x12, 0xD3, 0x8D, 0x3A, 0x32, 0x1C, 0x1A, 0x82, 0x53, 0x88, 0x70, 0x12, 0x7E, 0x4C, 0x38, 0x34,
-    0x24, 0x66, 0x59, 0x47, 0x4A, 0xCF, 0x8F, 0xDA, 0xEE, 0x5A, 0x9B, 0xBF, 0xAB, 0xB5, 0x27, 0xDB,
-    0x86, 0x3A, 0x85, 0xD7, 0xDD, 0xBB, 0x16, 0x5E, 0x01, 0x21, 0x01, 0x43, 0x02, 0x88, 0x04, 0x14,
-    0x09, 0x30, 0x92, 0x2B, 0x9D, 0xA0, 0x14, 0x8C, 0x31, 0x41, 0x6C, 0xD2, 0xB4, 0x71, 0x86, 0x31,
-    0xAE, 0xB6, 0x03, 0x00, 0x25, 0x83, 0x28, 0x83, 0xE6, 0x46, 0xD3, 0xC6, 0x60, 0xA0, 0xCF, 0x2B,
-    0xA4, 0x1D, 0xCA, 0xF1, 0xC3, 0xAB, 0x6E, 0x46, 0x4B, 0x6E, 0x15, 0x56, 0x0C, 0x7A, 0x95, 0x41,
-    0x89, 0x8F, 0x22, 0x16, 0x4F, 0x4D, 0xB0, 0xD1, 0xAD, 0x0A, 0x7B, 0x9D, 0xB5, 0x90, 0xEC, 0x1E,
-    0xB1, 0xDC, 0xCE, 0x94, 0x6C, 0x03, 0x70, 0x2F, 0x37, 0x99, 0x36, 0xE9, 0xCC, 0x18, 0xEB, 0x86,
-    0x9D, 0x7D, 0x00, 0xD9, 0xD4, 0xC4, 0x2C, 0xDD, 0x43, 0x2C, 0x47, 0x76, 0x8F, 0xE5, 0x18, 0x2E,
-    0xEA, 0xE5, 0x58, 0x7C, 0x40, 0xFB, 0x36, 0x2F, 0x9A, 0x8F, 0x5A, 0xDA, 0x1F, 0x69, 0x58, 0xCC,
-    0x69, 0x8E, 0x93, 0x43, 0x9D, 0x81, 0x65, 0x9F, 0x68, 0xDF, 0x77, 0xAB, 0x21, 0xF8, 0xEC, 0xC7,
-    0x03, 0xB0, 0x1D, 0xA9, 0x3D, 0xCD, 0x32, 0xD9, 0x52, 0xB3, 0x57, 0xA6, 0xEF, 0x1A, 0x24, 0x49,
-    0xA1, 0x85, 0x9E, 0xB7, 0x3D, 0x3A, 0x1A, 0xC8, 0xF9, 0x91, 0x0D, 0x46, 0x32, 0x66, 0x9C, 0x87,
-    0xA4, 0xA4, 0x80, 0x57, 0x01, 0xF3, 0x3D, 0x14, 0xF0, 0xFA, 0xA8, 0xFB, 0xF4, 0x51, 0xC0, 0xDB,
-    0x03, 0xE7, 0xDC, 0xC3, 0x1C, 0x63, 0xB4, 0xAF, 0xAB, 0x01, 0x5A, 0x36, 0x7D, 0xF4, 0x8E, 0xFA,
-    0x58, 0xB7, 0x01, 0x0E, 0x89, 0x48, 0xEB, 0x32, 0x88, 0x74, 0x07, 0x71, 0x4C, 0xF6, 0x3E, 0x32,
-    0x9A, 0x11, 0x12, 0x1A, 0xA9, 0xC1, 0xE9, 0x23, 0x4A, 0x9D, 0x46, 0xDD, 0x3E, 0xDF, 0xF1, 0x5A,
-    0x62, 0x15, 0x4E, 0xC6, 0x1A, 0xE6, 0x5E, 0x6C, 0x15, 0xBC, 0x40, 0x45, 0xC8, 0x18, 0x72, 0x66,
-    0x55, 0x20, 0xA3, 0xD2, 0x4F, 0x27, 0x1B, 0xF2, 0x1D, 0x37, 0x39, 0x36, 0x22, 0x95, 0xF3, 0x7F,
-    0x5C, 0x1D, 0x6E, 0xD4, 0x2D, 0x7F, 0x4C, 0xA3, 0x6E, 0xBE, 0xFA, 0x3D, 0x45, 0x17, 0x69, 0x91,
-    0x97, 0x5A, 0x2A, 0x0D, 0xF5, 0xB4, 0x30, 0x79, 0x24, 0x7A, 0xD2, 0x4B, 0xB2, 0x85, 0xAB, 0x50,
-    0x02, 0x32, 0xD6, 0xD7, 0xFD, 0x3E, 0x8C, 0xEB, 0x0C, 0x8C, 0x97, 0x4E, 0x74, 0x4A, 0x88, 0xD0,
-    0x59, 0x2B, 0xAD, 0xB5, 0x16, 0xB5, 0x4D, 0xDB, 0x58, 0x14, 0x97, 0x53, 0x0B, 0x7D, 0x29, 0xE9,
-    0xF5, 0xA5, 0x38, 0xBB, 0x27, 0x09, 0xC5, 0x9E, 0x58, 0xD0, 0x58, 0x4E, 0x27, 0x54, 0x24, 0xFA,
-    0x93, 0x00, 0x40, 0x82, 0x00, 0x09, 0x04, 0xA6, 0x3D, 0x2D, 0x20, 0x68, 0x14, 0x0C, 0x0C, 0x1A,
-    0x87, 0xA6, 0xD8, 0x0A, 0x61, 0x15, 0x64, 0xB5, 0xB3, 0x5D, 0x23, 0xE9, 0x19, 0xB0, 0xC4, 0xA9,
-    0x9C, 0x00, 0x05, 0xA8, 0x10, 0x60, 0x81, 0xE3, 0xE1, 0xFD, 0xC4, 0xC0, 0x10, 0x90, 0x21, 0x40,
-    0x83, 0xEC, 0xBA, 0xD0, 0x69, 0xB5, 0x19, 0xF8, 0x3A, 0xE0, 0x43, 0x00, 0x48, 0xD7, 0x6C, 0x01,
-    0xD1, 0x6C, 0x03, 0xA8, 0x49, 0x42, 0xD1, 0xEA, 0x62, 0x0C, 0x0E, 0xB6, 0x2B, 0x0D, 0x42, 0x0F,
-    0x37, 0xC9, 0xA8, 0x67, 0x21, 0x4B, 0xA6, 0xF3, 0xE2, 0xEB, 0xE8, 0x84, 0x97, 0xEA, 0x3A, 0x83,
-    0xAE, 0x18, 0x32, 0x14, 0x52, 0x23, 0x64, 0x3A, 0x72, 0xE3, 0x4D, 0x29, 0x15, 0xD6, 0x82, 0x43,
-    0xA8, 0x8F, 0x6C, 0x98, 0x0A, 0x44, 0x5F, 0xBF, 0x0C, 0xF5, 0x9B, 0x95, 0x26, 0x95, 0x60, 0x38,
-    0x8C, 0x09, 0xB3, 0xAF, 0xC4, 0xD3, 0x2C, 0x87, 0x51, 0xD9, 0x5F, 0x1F, 0xA1, 0x74, 0x28, 0x4C,
-    0xC7, 0x04, 0x0E, 0xD6, 0x9A, 0x77, 0xFA, 0x68, 0xF4, 0xCE, 0x41, 0xC5, 0x7A, 0xDF, 0x4A, 0xF6,
-    0x58, 0xF1, 0x9A, 0xFA, 0xAC, 0xF9, 0x84, 0x86, 0xAC, 0x7A, 0x85, 0x05, 0xB6, 0x2A, 0x1B, 0x86,
-    0x51, 0x6E, 0xA4, 0x2C, 0x33, 0xEB, 0xC1, 0xE3, 0x87, 0x98, 0xD0, 0x91, 0xB5, 0xF4, 0xA4, 0xE4,
-    0xE0, 0x17, 0x74, 0x82, 0x21, 0xA8, 0x68, 0xCB, 0xFF, 0x7E, 0x35, 0xFA, 0x45, 0xC2, 0x20, 0xF8,
-    0xB5, 0xA0, 0x30, 0xED, 0x3B, 0xC9, 0xA9, 0x2D, 0xAF, 0x3D, 0xB5, 0x75, 0xBD, 0xDB, 0x37, 0x08,
-    0xEB, 0x7D, 0x39, 0xA6, 0x20, 0x24, 0xBA, 0xD0, 0x35, 0x04, 0xC6, 0x57, 0x2A, 0x17, 0x15, 0xD0,
-    0xC0, 0x20, 0x25, 0x0C, 0x29, 0x93, 0x80, 0x93, 0x6E, 0x4F, 0x74, 0xF1, 0x9B, 0x42, 0x58, 0x51,
-    0x1F, 0x8E, 0x6E, 0x53, 0x49, 0xB5, 0x54, 0xF8, 0xE3, 0x50, 0x5B, 0x0D, 0x4E, 0x25, 0x44, 0xCE,
-    0x98, 0xFC, 0x74, 0x50, 0x67, 0x88, 0x9A, 0x27, 0x0D, 0xED, 0xAE, 0x74, 0x39, 0x1E, 0x56, 0x60,
-    0x98, 0xD8, 0xCB, 0x57, 0xFA, 0xB4, 0xF1, 0xD7, 0x3A, 0xB6, 0xFF, 0xC0, 0xB3, 0xFC, 0xD1, 0x8D,
-    0x70, 0xB5, 0x9B, 0x77, 0xCA, 0x40, 0x26, 0xBF, 0x0E, 0x3A, 0x69, 0x7A, 0xD7, 0xC1, 0xCD, 0x51,
-    0x89, 0x4F, 0xCC, 0x5B, 0x17, 0xDE, 0x74, 0xB2, 0x85, 0x49, 0x50, 0xD2, 0xCA, 0xA5, 0x8A, 0x56,
-    0x92, 0xEB, 0xD2, 0x79, 0x1D, 0x75, 0x6A, 0x55, 0x87, 0xEB, 0x09, 0xD9, 0x6C, 0x3D, 0xA1, 0x79,
-    0xF8, 0xA6, 0xB3, 0xC1, 0xB9, 0x0E, 0x5D, 0x6A, 0xD7, 0x4B, 0x61, 0x0E, 0x2B, 0xC1, 0x1F, 0x6E,
-    0x43, 0x9A, 0x51, 0xDA, 0x1C, 0x57, 0x3A, 0x39, 0xEF, 0xF5, 0x3C, 0x86, 0x56, 0x31, 0x03, 0xE0,
-    0xBC, 0xAE, 0x9D, 0x9C, 0x35, 0xED, 0xD9, 0x3F, 0xF4, 0x7A, 0x1A, 0x75, 0x06, 0x0D, 0xCE, 0xD2,
-    0xBE, 0x11, 0x72, 0xD1, 0x72, 0xF7, 0x05, 0xB4, 0x83, 0x82, 0x9F, 0x4E, 0xE4, 0x50, 0x0E, 0xAE,
-    0x0A, 0x00, 0xEB, 0x19, 0xCD, 0xF8, 0xA5, 0x4E, 0xA4, 0x53, 0x00, 0x71, 0x46, 0x42, 0x7F, 0xA4,
-    0xC2, 0xA1, 0xE4, 0x48, 0x95, 0x04, 0x59, 0xD7, 0x74, 0xD2, 0x9E, 0x87, 0x7B, 0x79, 0x1B, 0x0B,
-    0x22, 0x6E, 0xB1, 0x0F, 0x31, 0x83, 0x74, 0x23, 0x62, 0x7F, 0x52, 0xB6, 0x84, 0xA9, 0x7B, 0xDA,
-    0x70, 0x75, 0xF6, 0xB4, 0x21, 0x13, 0x0D, 0x1A, 0x8F, 0x48, 0xA2, 0x72, 0xE2, 0xF2, 0x73, 0x41,
-    0xAE, 0xB4, 0xC7, 0xE6, 0x98, 0x68, 0x50, 0x18, 0x70, 0x86, 0xF4, 0x05, 0xFE, 0x6C, 0x8F, 0x37,
-    0x61, 0x8F, 0x89, 0x67, 0xF8, 0x42, 0x41, 0x2E, 0x3C, 0x96, 0x04, 0x07, 0x71, 0x97, 0x9E, 0xB0,
-    0xB4, 0xDC, 0x74, 0xCB, 0xAD, 0x74, 0x99, 0x9A, 0xFE, 0xCA, 0xFC, 0x15, 0x7E, 0x49, 0x77, 0x37,
-    0x70, 0x96, 0xD6, 0xFB, 0xAA, 0x6E, 0x12, 0x37, 0xB5, 0xBD, 0x23, 0x51, 0x78, 0xAE, 0x2A, 0x9D,
-    0x6B, 0x53, 0x7E, 0xC9, 0x59, 0x9D, 0x66, 0x58, 0x00, 0x53, 0x70, 0xF6, 0x8F, 0x42, 0xA9, 0xEB,
-    0xD4, 0xC6, 0x00, 0x5D, 0x59, 0x27, 0xFA, 0x2C, 0x2A, 0xC6, 0xEF, 0xEB, 0x8C, 0x93, 0x75, 0x5E,
-    0x54, 0xA8, 0x6C, 0xF3, 0x6E, 0xD1, 0x9C, 0x40, 0x6E, 0xD6, 0x12, 0x94, 0xF9, 0xAE, 0xEE, 0x3D,
-    0xF6, 0xEE, 0x51, 0xAC, 0x2E, 0x5A, 0x6D, 0x59, 0xB8, 0x3D, 0xB9, 0x96, 0xF5, 0x54, 0x69, 0xA5,
-    0x97, 0xAD, 0x42, 0xA5, 0x3B, 0x76, 0x6E, 0xA1, 0x46, 0x43, 0xD1, 0x3D, 0xEA, 0x1E, 0x50, 0x46,
-    0xB2, 0xAD, 0xBB, 0x15, 0x6A, 0x86, 0x0D, 0x08, 0xA0, 0xF5, 0xDA, 0x61, 0x09, 0x9D, 0xD6, 0xE8,
-    0x6C, 0xB6, 0x75, 0x63, 0xC4, 0xB8, 0xB3, 0xB2, 0x14, 0x4D, 0xE7, 0x81, 0x89, 0xFC, 0x22, 0xFE,
-    0xA8, 0xEA, 0xAB, 0x1E, 0x83, 0x70, 0x67, 0x9D, 0xE9, 0xCE, 0x8A, 0xC2, 0x41, 0x62, 0xD7, 0x11,
-    0xD3, 0x74, 0x7D, 0x20, 0x1B, 0x79, 0xE2, 0x2E, 0x7D, 0xA7, 0xD0, 0x07, 0x6C, 0x24, 0xB7, 0xDA,
-    0x81, 0x3B, 0xEA, 0x61, 0xD6, 0x40, 0x4E, 0x75, 0x34, 0xFD, 0x51, 0xE1, 0xF0, 0x73, 0xD3, 0xDF,
-    0x28, 0xDD, 0x43, 0x32, 0xB2, 0x93, 0x52, 0x86, 0xCA, 0x94, 0x7F, 0x10, 0xD7, 0x75, 0x7C, 0x3F,
-    0x95, 0xA9, 0xD1, 0x5B, 0x14, 0x16, 0x88, 0x28, 0xFF, 0xBF, 0xC0, 0x61, 0x8D, 0xAF, 0x18, 0x6C,
-    0xBC, 0xB7, 0xF6, 0xFF, 0x0B, 0xBC, 0x2C, 0x41, 0x8D, 0xE9, 0xD7, 0x64, 0x2B, 0xAC, 0xB3, 0x2E,
-    0xFC, 0xCC, 0x1C, 0x37, 0x6E, 0xDC, 0xA5, 0x25, 0x16, 0xDC, 0x24, 0x6F, 0xAC, 0xFD, 0xAD, 0x76,
-    0x4E, 0xA3, 0x74, 0x87, 0xD7, 0xFD, 0xE6, 0x01, 0x4B, 0x63, 0xC7, 0xBA, 0x4F, 0xD2, 0x06, 0x86,
-    0xA0, 0x4E, 0x39, 0xFD, 0x3B, 0x3D, 0x89, 0x78, 0x56, 0x70, 0x5D, 0xDD, 0x27, 0x96, 0x75, 0x26,
-    0xDD, 0x2C, 0x4E, 0xA1, 0x8B, 0x25, 0x3D, 0x62, 0x5B, 0x56, 0xDB, 0x96, 0x33, 0xA8, 0x9C, 0xF5,
-    0xF1, 0xD4, 0xBC, 0xAC, 0xCC, 0xFD, 0x5C, 0xD1, 0xC8, 0x93, 0xD9, 0x17, 0x65, 0x3C, 0x23, 0x00,
-    0x2E, 0x37, 0x70, 0x87, 0xB2, 0xE3, 0x83, 0x08, 0x0C, 0xC0, 0x13, 0x8A, 0x6D, 0xD5, 0xE3, 0xE9,
-    0x79, 0xD8, 0x69, 0xFF, 0xF6, 0x6D, 0xDA, 0x99, 0xF6, 0x6F, 0xCF, 0x6E, 0xD1, 0x55, 0xF6, 0xEF,
-    0x48, 0x3B, 0x4A, 0x24, 0xB7, 0x48, 0x6D, 0x91, 0xD8, 0xE2, 0x39, 0xCD, 0xEB, 0x3C, 0xCE, 0xEB,
-    0x7C, 0xCE, 0xEB, 0x42, 0x7E, 0xBE, 0x11, 0x87, 0xD6, 0x8F, 0xE2, 0xE0, 0x96, 0x77, 0xD3, 0x2B,
-    0x9B, 0xBA, 0x85, 0x7C, 0xEB, 0x44, 0xE9, 0xB2, 0x99, 0xFC, 0xFE, 0xE4, 0xE8, 0x8D, 0xCC, 0xCE,
-    0xE7, 0x85, 0xC6, 0xEB, 0x91, 0xE9, 0x7B, 0xC5, 0x22, 0xD9, 0x70, 0x62, 0x58, 0x62, 0x54, 0x41,
-    0x41, 0xD3, 0x14, 0xE3, 0x49, 0xD1, 0xFD, 0x29, 0xFA, 0x1C, 0x7F, 0x8E, 0xF3, 0x09, 0xC9, 0xFA,
-    0xA2, 0x69, 0xCD, 0xEE, 0x28, 0x30, 0x58, 0xD8, 0x12, 0x3D, 0x85, 0x1D, 0x9D, 0x97, 0x6F, 0xE1,
-    0x3C, 0xEF, 0x4D, 0x7F, 0xF7, 0x25, 0x96, 0x58, 0x57, 0x9E, 0x28, 0x3C, 0xE8, 0x4D, 0xDE, 0x9D,
-    0x38, 0xAF, 0xCA, 0xD3, 0x78, 0x2A, 0x91, 0x57, 0xC1, 0xE5, 0xDB, 0x47, 0x88, 0x8B, 0x5A, 0xC3,
-    0x49, 0x3F, 0xEF, 0x77, 0xF8, 0x6F, 0xF0, 0x65, 0xB8, 0xA8, 0x9E, 0x94, 0x53, 0x72, 0xC9, 0x74,
-    0xA2, 0x13, 0x4F, 0x16, 0x22, 0x27, 0x11, 0x21, 0xC6, 0x01, 0x0E, 0x3B, 0x6E, 0x82, 0x81, 0xB0,
-    0x19, 0x7B, 0x28, 0x02, 0x1D, 0x53, 0x6D, 0x55, 0x8E, 0xD0, 0xCC, 0xD5, 0xA1, 0xBB, 0xD4, 0x05,
-    0x30, 0xA9, 0x7F, 0x49, 0xF9, 0xCB, 0x3D, 0xDC, 0xCC, 0xC5, 0xC9, 0x79, 0x7D, 0x48, 0x3C, 0xC4,
-    0xF0, 0x06, 0x67, 0xC3, 0x8C, 0x10, 0x01, 0x22, 0x32, 0x18, 0x31, 0x48, 0x8F, 0x59, 0x77, 0xFD,
-    0x95, 0xA5, 0x73, 0xD3, 0xD3, 0x74, 0xBA, 0xAD, 0xA8, 0x3B, 0x8C, 0x38, 0x21, 0x30, 0xAD, 0x7A,
-    0x3D, 0xAC, 0x45, 0x20, 0xA7, 0x5C, 0x99, 0x9E, 0x3E, 0x92, 0xD7, 0x3A, 0x6B, 0x6A, 0x91, 0xE6,
-    0x0B, 0x7A, 0x9A, 0x78, 0xB5, 0x05, 0x5D, 0xF2, 0x7D, 0x53, 0x6E, 0x76, 0x22, 0x3A, 0x74, 0xA2,
-    0x0E, 0x51, 0x2B, 0xB6, 0x62, 0x55, 0x97, 0xFE, 0x3E, 0x62, 0xD4, 0x46, 0xCA, 0xA9, 0xB7, 0xC7,
-    0xF0, 0x4B, 0x3B, 0x37, 0x63, 0x08, 0x70, 0xA8, 0x3F, 0xD3, 0x67, 0x68, 0xBF, 0x97, 0xD1, 0x65,
-    0xBC, 0x7E, 0x90, 0x0B, 0xB6, 0xEA, 0xF7, 0xB9, 0xC2, 0x01, 0x2D, 0xEB, 0x5D, 0x34, 0xA7, 0xAC,
-    0xDC, 0x7E, 0x11, 0x75, 0x45, 0xAB, 0x70, 0x6D, 0x9C, 0xF6, 0xB2, 0x8A, 0x45, 0x2B, 0x3F, 0x83,
-    0x54, 0x70, 0xD9, 0x2A, 0x7A, 0x20, 0x31, 0xE7, 0xAD, 0xE2, 0x32, 0x5E, 0x77, 0x70, 0xB4, 0x8A,
-    0x45, 0xCF, 0xD4, 0x87, 0x90, 0xFA, 0x20, 0x51, 0xFF, 0x05, 0x37, 0x60, 0xA2, 0xF7, 0x51, 0xA4,
-    0x7B, 0xEE, 0xE2, 0xF8, 0x27, 0xD3, 0x53, 0x89, 0x55, 0xA7, 0xB1, 0xA9, 0xFF, 0x28, 0x0D, 0x6D,
-    0xDD, 0x95, 0xD7, 0x6D, 0xF9, 0x4E, 0x5F, 0xFE, 0xE5, 0x98, 0xD6, 0x54, 0x36, 0x4A, 0x70, 0xE2,
-    0x5F, 0x92, 0xC0, 0xC2, 0x4D, 0x98, 0x3B, 0xEE, 0xB8, 0xC9, 0x62, 0x41, 0x8C, 0xF5, 0xB9, 0x82,
-    0x32, 0x37, 0x79, 0xBE, 0x50, 0x89, 0x9B, 0xEC, 0x14, 0x76, 0xEC, 0x26, 0x69, 0xE1, 0x90, 0xFB,
-    0x4E, 0x52, 0x2C, 0x92, 0xFB, 0x6E, 0x54, 0x2E, 0x93, 0xFB, 0x1B, 0x2A, 0x2F, 0x91, 0xFB, 0x5B,
-    0x96, 0x11, 0x87, 0x43, 0x3E, 0x4A, 0xD0, 0x5E, 0xAD, 0xA5, 0xCC, 0xD0, 0x69, 0x3B, 0x8B, 0xC9,
-    0xCB, 0x17, 0x54, 0xC0, 0x1A, 0xAD, 0xBF, 0x82, 0xFC, 0x46, 0x3B, 0x86, 0x0B, 0xEB, 0xDA, 0xCC,
-    0x0B, 0x75, 0xB9, 0xF1, 0x21, 0x6D, 0xBC, 0x0F, 0x44, 0x23, 0xB6, 0xC0, 0x25, 0x7D, 0x14, 0x99,
-    0xF9, 0x2B, 0xBE, 0xD4, 0x80, 0x22, 0x69, 0x85, 0x15, 0x1D, 0xC2, 0xD3, 0xF5, 0xD1, 0x05, 0x09,
-    0xAF, 0x37, 0x85, 0x65, 0x39, 0x4F, 0x78, 0x4F, 0xE6, 0xB1, 0x50, 0x77, 0x48, 0x87, 0xA4, 0x93,
-    0xA3, 0xE6, 0x54, 0x05, 0xBE, 0x3E, 0x45, 0x4B, 0xAA, 0x9B, 0x8A, 0x9C, 0xBD, 0xC2, 0x9C, 0x39,
-    0xC0, 0xF7, 0x34, 0xA4, 0xC2, 0xC4, 0x22, 0xAC, 0x80, 0x58, 0xAE, 0x00, 0xDD, 0x1E, 0x6E, 0xF8,
-    0x0A, 0x6E, 0xBD, 0x83, 0x49, 0x90, 0x28, 0x43, 0x36, 0xFF, 0x45, 0x1C, 0x9E, 0x79, 0x1D, 0xEE,
-    0xE7, 0x4F, 0x40, 0xBB, 0x6A, 0xBA, 0x03, 0xF2, 0xBD, 0x3F, 0xA9, 0xED, 0x7A, 0x6D, 0x37, 0xA3,
-    0x34, 0x65, 0x98, 0xEF, 0x62, 0xFE, 0x81, 0x84, 0x2F, 0x2B, 0xFE, 0x16, 0x08, 0x55, 0x85, 0xBC,
-    0x1F, 0x25, 0xDA, 0xE8, 0xE2, 0x4C, 0xE1, 0x6A, 0x7E, 0xE0, 0x1C, 0x6F, 0xAF, 0xDC, 0x6C, 0xFA,
-    0xFD, 0x22, 0xBD, 0xA2, 0xEE, 0x79, 0xF1, 0xC1, 0xF6, 0x2F, 0x2A, 0xC6, 0xC8, 0xC1, 0xFC, 0xCC,
-    0x76, 0x33, 0x94, 0x1D, 0x22, 0x8D, 0xA9, 0x68, 0x9E, 0x37, 0x2C, 0x58, 0xCA, 0x11, 0x1F, 0xF7,
-    0xFE, 0x44, 0xBF, 0x6F, 0x25, 0xF8, 0xCE, 0x09, 0xAA, 0x0F, 0x6E, 0x1C, 0xBE, 0xB7, 0xBE, 0xD1,
-    0xB4, 0x01, 0x91, 0x66, 0x9B, 0x33, 0x8D, 0xF2, 0xA5, 0xBE, 0x57, 0xA6, 0xFB, 0xF1, 0xE5, 0xED,
-    0x9F, 0x11, 0xBE, 0x3A, 0x99, 0x3B, 0xB9, 0x42, 0x6D, 0x0D, 0xE7, 0xC3, 0x9B, 0x03, 0x7A, 0xCD,
-    0x47, 0xCC, 0x91, 0x3E, 0x5E, 0xB3, 0x8B, 0xFC, 0x56, 0xEA, 0xA5, 0x56, 0x12, 0xDC, 0xB8, 0x96,
-    0x84, 0x75, 0xDD, 0x54, 0x56, 0x64, 0x6D, 0x9C, 0x96, 0xCF, 0xAA, 0x43, 0x9B, 0x7D, 0x5E, 0x7A,
-    0x36, 0x76, 0x31, 0x32, 0x8B, 0xD2, 0x29, 0x5A, 0x3E, 0xB4, 0x9E, 0xC7, 0xC0, 0x85, 0x5D, 0xF9,
-    0x1A, 0xD9, 0xAF, 0xD3, 0xE6, 0x1C, 0xD1, 0xA4, 0xE3, 0x00, 0xE7, 0xA8, 0xA7, 0xB8, 0x9D, 0xF3,
-    0xB0, 0xD3, 0xE7, 0x82, 0xE6, 0xD4, 0xAB, 0x24, 0xAA, 0x2D, 0xF0, 0x50, 0x57, 0xF4, 0x85, 0xC2,
-    0x04, 0x8D, 0x49, 0xAB, 0x2C, 0x76, 0x2A, 0xB9, 0x9D, 0xA4, 0x1F, 0xFA, 0x5C, 0x4F, 0xD4, 0x18,
-    0x31, 0x6B, 0x8E, 0xF7, 0x53, 0x82, 0xEE, 0x04, 0xE5, 0xA9, 0x59, 0x65, 0x31, 0xE7, 0x91, 0x34,
-    0x3D, 0x76, 0x51, 0x57, 0x7B, 0x15, 0x1F, 0xFE, 0x5C, 0x37, 0xBB, 0xD2, 0x5B, 0x63, 0xF6, 0xB4,
-    0xD1, 0x66, 0x1B, 0x9E, 0x66, 0x8F, 0xBF, 0x1C, 0x3E, 0x6D, 0x94, 0xB5, 0x46, 0x74, 0xE8, 0x2C,
-    0x53, 0x7B, 0xF7, 0xB0, 0xB9, 0x1D, 0xCE, 0x01, 0xE9, 0x83, 0x40, 0xFF, 0x03, 0xE5, 0x5B, 0x3D,
-    0x8C, 0x1C, 0x57, 0x72, 0xAE, 0xEE, 0xE6, 0x6E, 0x1B, 0x6C, 0x78, 0x7B, 0x03, 0xF2, 0x74, 0x38,
-    0x8A, 0xDB, 0x89, 0x03, 0x83, 0x58, 0xBA, 0x13, 0x05, 0x7B, 0xC0, 0x70, 0xBB, 0x45, 0x01, 0x56,
-    0xA0, 0xE0, 0x18, 0x90, 0x72, 0x40, 0x1C, 0xE4, 0xF4, 0xCE, 0xC1, 0x5E, 0xC0, 0x80, 0xC1, 0xEE,
-    0xCC, 0x9C, 0x14, 0x3A, 0x38, 0xDA, 0x30, 0xEC, 0x90, 0x0C, 0x14, 0xF0, 0x56, 0x07, 0x93, 0x01,
-    0x03, 0x06, 0xBB, 0x3B, 0x2D, 0x29, 0x54, 0x32, 0xB6, 0x71, 0x76, 0x62, 0xC0, 0x8D, 0x83, 0xE4,
-    0x83, 0x29, 0xDB, 0x1A, 0xD9, 0x23, 0xDC, 0x2C, 0xD1, 0x33, 0xED, 0xEF, 0xAB, 0x7A, 0xDD, 0x33,
-    0x43, 0xF1, 0xE4, 0xE0, 0x96, 0xD4, 0x1A, 0x5E, 0xED, 0xBC, 0x6E, 0xCE, 0xF6, 0x4F, 0xD5, 0xF7,
-    0xEA, 0x55, 0x7D, 0x55, 0xF5, 0x24, 0x82, 0x9F, 0x73, 0x1C, 0xE4, 0x50, 0xA4, 0x37, 0x95, 0x23,
-    0x09, 0x8F, 0x77, 0x8A, 0x2B, 0x92, 0xF6, 0x83, 0x51, 0x07, 0xDF, 0x79, 0xD3, 0xD2, 0x9F, 0x88,
-    0xCC, 0x24, 0x18, 0xF1, 0x92, 0x78, 0x28, 0xD2, 0x95, 0xA4, 0xE0, 0x98, 0xF6, 0x05, 0x97, 0x67,
-    0xB9, 0x8E, 0x78, 0xC0, 0x54, 0x7A, 0x18, 0x2B, 0x8E, 0x5E, 0x85, 0xBF, 0x0B, 0x6E, 0xC4, 0x88,
-    0x1B, 0xF1, 0x4D, 0x54, 0xF2, 0x1A, 0xDC, 0x98, 0xE6, 0x3C, 0x89, 0x0B, 0x5C, 0x2E, 0xC1, 0xF1,
-    0x4D, 0x3C, 0x55, 0x06, 0x35, 0x9E, 0x21, 0x5E, 0x2E, 0xF6, 0xC3, 0xA3, 0x3F, 0xC6, 0x10, 0x8C,
-    0x25, 0x3A, 0xF6, 0xC6, 0x72, 0xF4, 0xA0, 0x18, 0xF9, 0xE3, 0xF0, 0xD7, 0xFD, 0x68, 0x18, 0x4C,
-    0x25, 0xEE, 0xE3, 0x8F, 0x69, 0x8E, 0x21, 0xE3, 0x65, 0x5D, 0x0E, 0x87, 0x7C, 0x8B, 0x1B, 0xC2,
-    0x92, 0x72, 0x16, 0xB2, 0x27, 0x49, 0x1F, 0x97, 0xF0, 0xAD, 0x7F, 0x51, 0x89, 0x84, 0xF5, 0xB0,
-    0x55, 0x15, 0x3F, 0xEB, 0x3A, 0x56, 0x69, 0x3D, 0x8C, 0xC7, 0xD5, 0x85, 0x59, 0xBE, 0x3A, 0x3A,
-    0xA0, 0x9E, 0xA3, 0x47, 0x3E, 0x24, 0xFA, 0xD5, 0x90, 0xDA, 0xAA, 0xCE, 0xDE, 0x90, 0x0F, 0xF4,
-    0x0B, 0x89, 0x86, 0x12, 0x14, 0x7C, 0x6E, 0xD0, 0xE7, 0x18, 0xE6, 0x10, 0x44, 0xA2, 0x9C, 0x2F,
-    0x89, 0x84, 0x5A, 0xC5, 0xC2, 0x77, 0xAD, 0xE9, 0x78, 0x51, 0x64, 0x5B, 0x64, 0x53, 0xC7, 0x8E,
-    0x7E, 0xF3, 0x88, 0xD7, 0x78, 0x78, 0x6A, 0x0C, 0x78, 0xA1, 0x5F, 0x3D, 0xE5, 0xFB, 0x57, 0x1A,
-    0x71, 0xCE, 0x70, 0x20, 0x88, 0xD2, 0xBB, 0x74, 0x4F, 0xEE, 0x67, 0xE9, 0x48, 0xAA, 0xCB, 0x78,
-    0xFD, 0xE4, 0x51, 0x50, 0x7A, 0x75, 0x3F, 0x1C, 0x42, 0xC9, 0xA8, 0xC0, 0x17, 0x3A, 0xC4, 0x45,
-    0x50, 0xE2, 0xF5, 0xE1, 0x50, 0x92, 0x1C, 0xB2, 0xA4, 0xC4, 0x15, 0x9A, 0x72, 0xB8, 0x0B, 0x9D,
-    0xFD, 0x9F, 0xF5, 0x25, 0xFD, 0x22, 0xFE, 0x5C, 0xE2, 0x49, 0x38, 0x69, 0x10, 0x75, 0xD8, 0x7A,
-    0xED, 0x69, 0xB9, 0xD1, 0x9E, 0x3E, 0x7E, 0xDC, 0x9E, 0x66, 0xA3, 0xF6, 0x34, 0x2D, 0xDA, 0xD3,
-    0x56, 0x4E, 0x77, 0x51, 0xFD, 0x14, 0xFA, 0xD6, 0x35, 0xE6, 0xED, 0xC2, 0xD3, 0x07, 0x63, 0x89,
-    0x9F, 0xEC, 0xD7, 0x9C, 0x68, 0x6F, 0x2A, 0x1B, 0xA2, 0x13, 0x3B, 0x82, 0x28, 0x9B, 0x12, 0xE0,
-    0xED, 0x40, 0x2F, 0xED, 0x6F, 0x49, 0x84, 0xE7, 0x02, 0xC2, 0xB8, 0x58, 0xD7, 0xE7, 0xC6, 0x0A,
-    0xA5, 0x1A, 0x8C, 0x3B, 0x9D, 0xB6, 0xA7, 0xBC, 0x8B, 0xB0, 0xF2, 0x5F, 0xA5, 0x18, 0xB6, 0x85,
-    0x49, 0x63, 0x26, 0xD4, 0x73, 0x60, 0xC1, 0x00, 0x15, 0x45, 0x18, 0x59, 0x96, 0xEB, 0x5D, 0x98,
-    0x74, 0xFC, 0x55, 0xEF, 0xA2, 0x3D, 0x4F, 0x9D, 0x0E, 0x15, 0x4D, 0x11, 0x77, 0xFD, 0x84, 0xA7,
-    0x11, 0xC5, 0x14, 0xCC, 0xEC, 0x04, 0x88, 0xC1, 0xC4, 0xBC, 0x52, 0x5E, 0x39, 0xFE, 0x33, 0xD8,
-    0xD5, 0x57, 0x37, 0x6E, 0x0E, 0x61, 0x8B, 0xF5, 0x1D, 0x55, 0x6D, 0xAE, 0xBC, 0xB3, 0x15, 0xCC,
-    0xAA, 0x3F, 0x34, 0xD5, 0x25, 0x8E, 0x9D, 0xE6, 0x12, 0xCD, 0x9C, 0xE2, 0x2A, 0xB6, 0xEA, 0x2D,
-    0xDE, 0x35, 0xA7, 0xB6, 0xDE, 0xA5, 0x5A, 0x9F, 0xDD, 0xDF, 0x77, 0xEA, 0xA5, 0xF5, 0xCC, 0x9D,
-    0x75, 0x20, 0x8C, 0x9D, 0xBD, 0x46, 0x73, 0x53, 0x8D, 0xD7, 0x71, 0xB5, 0x53, 0x18, 0xFF, 0x76,
-    0xFA, 0x66, 0xAD, 0xBA, 0x55, 0xA3, 0xAD, 0xAE, 0x0F, 0x55, 0x36, 0x2A, 0x1B, 0x5D, 0x79, 0x83,
-    0xA9, 0x9A, 0xC9, 0x77, 0x4D, 0x53, 0x0C, 0x5B, 0xA6, 0x28, 0x6E, 0xB8, 0x65, 0x7A, 0x86, 0x4F,
-    0x3F, 0x18, 0xB5, 0x6A, 0xBA, 0xD9, 0xF6, 0xF0, 0x9F, 0x44, 0xB5, 0xF8, 0xC3, 0xCB, 0xC2, 0xE5,
-    0x2C, 0x5F, 0xBA, 0xE7, 0x0F, 0xB8, 0x68, 0x0E, 0xF0, 0xC6, 0xBE, 0x1D, 0xCF, 0x1B, 0x9C, 0xFC,
-    0x09, 0x8F, 0x27, 0xDE, 0xFE, 0xFE, 0x1D, 0xE9, 0xDD, 0x1C, 0x07, 0x75, 0x3D, 0xF4, 0xC6, 0xC1,
-    0x28, 0xE8, 0x27, 0xFD, 0xB0, 0x0C, 0x46, 0x21, 0x24, 0xA0, 0x8D, 0xAE, 0xE0, 0xD2, 0x24, 0x87,
-    0x99, 0xEA, 0x62, 0x8D, 0x74, 0x29, 0x65, 0x6E, 0x96, 0xBB, 0x1C, 0x32, 0x8A, 0x9E, 0xE8, 0x34,
-    0x1E, 0x3A, 0xAD, 0x0E, 0xA4, 0x97, 0x87, 0xA5, 0x9F, 0x1F, 0xCA, 0x17, 0x7C, 0x46, 0xDE, 0x0D,
-    0x76, 0x78, 0xAF, 0x64, 0x7F, 0x9B, 0xFE, 0xE7, 0x60, 0x7F, 0x20, 0xC9, 0x24, 0x1E, 0xD7, 0xC4,
-    0xB0, 0x31, 0xE5, 0x0C, 0x53, 0x15, 0xD4, 0x95, 0x60, 0x11, 0x8B, 0x37, 0xF8, 0x54, 0x1D, 0x15,
-    0x1F, 0xDC, 0x1C, 0xC3, 0xD2, 0x40, 0x23, 0xB2, 0x04, 0x8A, 0xC6, 0x46, 0x55, 0xF4, 0x58, 0xCD,
-    0x8F, 0x84, 0x0F, 0x50, 0x11, 0x7D, 0x75, 0x3F, 0x44, 0x9D, 0xCF, 0x68, 0x8E, 0x5D, 0x1E, 0x4B,
-    0x45, 0x85, 0x2A, 0xF1, 0x51, 0x43, 0x3E, 0x13, 0x88, 0x17, 0x7C, 0x46, 0x05, 0xFF, 0x80, 0x23,
-    0x1E, 0x11, 0x01, 0x06, 0x60, 0x7D, 0xA3, 0x97, 0xE3, 0x59, 0x3D, 0xD8, 0x12, 0x56, 0xA8, 0x93,
-    0xD5, 0x1D, 0xB7, 0xDD, 0x71, 0xCF, 0x1D, 0x0D, 0x51, 0xF3, 0x7A, 0x38, 0xDC, 0x1C, 0xEA, 0x31,
-    0x98, 0xC9, 0x33, 0x3F, 0xBB, 0xAA, 0x2D, 0xE0, 0xA2, 0xB2, 0x38, 0xA8, 0x8E, 0xEB, 0x76, 0x70,
-    0x9A, 0x9A, 0xA2, 0x97, 0xDE, 0x57, 0xBD, 0xD2, 0xB1, 0x1E, 0xD4, 0x65, 0xE8, 0x81, 0x4A, 0x42,
-    0x09, 0xEA, 0x08, 0x1D, 0x28, 0x4E, 0x64, 0xF6, 0xA5, 0x33, 0x22, 0xE6, 0x37, 0x25, 0x87, 0x6B,
-    0xA3, 0x7A, 0x49, 0xAE, 0xDA, 0xA5, 0xA6, 0x5C, 0x66, 0xBA, 0x6D, 0x9B, 0x6A, 0xDB, 0xA6, 0x99,
-    0xD3, 0xE0, 0x60, 0x49, 0x8F, 0x89, 0xA9, 0x61, 0x52, 0x05, 0x2A, 0x95, 0xB7, 0xA3, 0xAB, 0xC1,
-    0x9F, 0x3A, 0x20, 0x26, 0x72, 0x80, 0xB5, 0x57, 0xE1, 0x9A, 0x0A, 0x62, 0xAD, 0xF3, 0x22, 0x7E,
-    0xC2, 0xE1, 0xA5, 0x7B, 0x51, 0x91, 0x8E, 0x30, 0xF3, 0xA3, 0xB8, 0x1F, 0x94, 0xB4, 0x9E, 0x14,
-    0x32, 0xA6, 0x90, 0x0C, 0x96, 0x83, 0x97, 0x27, 0x39, 0x1C, 0x7B, 0x7E, 0x00, 0x48, 0x0F, 0x20,
-    0x78, 0x05, 0x28, 0x2B, 0x08, 0x71, 0xF4, 0x10, 0xFF, 0x2A, 0x2A, 0xF8, 0xD1, 0xCA, 0xDE, 0x4F,
-    0x57, 0x4B, 0x58, 0xA0, 0xA5, 0xB7, 0x93, 0x23, 0xD2, 0x98, 0x6F, 0x8B, 0xEB, 0x8F, 0xE1, 0x79,
-    0x2F, 0x4C, 0x64, 0x75, 0xF6, 0x3A, 0x6D, 0xA5, 0xA2, 0x27, 0x40, 0x08, 0x23, 0xD4, 0x1A, 0xA1,
-    0xC2, 0x01, 0x5D, 0x3E, 0xE6, 0x27, 0x42, 0x88, 0x51, 0x4C, 0xE2, 0xA4, 0x80, 0xE3, 0xA7, 0xE1,
-    0xC4, 0x43, 0x9C, 0xE0, 0x8E, 0xB5, 0x10, 0x96, 0xCE, 0x93, 0x8B, 0x30, 0xF5, 0x9C, 0x36, 0xB3,
-    0xE9, 0x4F, 0x22, 0x41, 0xA4, 0x82, 0xB3, 0xAF, 0x62, 0x55, 0x7C, 0x4B, 0x8E, 0x62, 0x15, 0xE0,
-    0xB6, 0x64, 0x1B, 0x7A, 0x72, 0x4B, 0xB2, 0x1F, 0xEA, 0x14, 0x3D, 0x94, 0xE4, 0xDF, 0x75, 0x92,
-    0x20, 0x4E, 0xA5, 0x13, 0x53, 0x0A, 0xFC, 0x34, 0x6D, 0xA7, 0x64, 0xCC, 0x03, 0xF8, 0xAF, 0x8C,
-    0x69, 0x0B, 0x98, 0xAC, 0x5E, 0xCD, 0xCB, 0xD2, 0xFC, 0x19, 0xFB, 0x99, 0x9F, 0x34, 0x16, 0xD4,
-    0x40, 0xAF, 0x52, 0x98, 0x11, 0x99, 0x35, 0x40, 0xB5, 0xFC, 0x59, 0x33, 0xC2, 0x5D, 0x8A, 0x45,
-    0x31, 0x33, 0x28, 0xB0, 0xD8, 0x0C, 0x89, 0x73, 0x0E, 0x88, 0x06, 0x07, 0x07, 0xC3, 0xF7, 0xDE,
-    0x37, 0x14, 0x2E, 0x8C, 0x0D, 0x04, 0xA8, 0xA3, 0x18, 0xE0, 0xA8, 0x10, 0x60, 0xE6, 0x14, 0x01,
-    0x1C, 0x15, 0x00, 0x80, 0xAE, 0xFA, 0xC3, 0xB6, 0x54, 0x7D, 0xA8, 0xA6, 0xDA, 0x43, 0x33, 0x55,
-    0x1E, 0x76, 0xA5, 0xBA, 0xA7, 0x4E, 0xF5, 0xD4, 0x69, 0x9E, 0x39, 0xC5, 0xB7, 0x9D, 0xDE, 0x8D,
-    0x72, 0x07, 0xCF, 0xE8, 0x38, 0x71, 0xAA, 0x3A, 0xEF, 0x65, 0x16, 0x26, 0xDE, 0x3B, 0xE6, 0xB3,
-    0x1B, 0x1B, 0x6B, 0x7E, 0xE2, 0xFE, 0x62, 0x38, 0x4B, 0xFA, 0xCF, 0x8B, 0x68, 0x72, 0xE9, 0x5E,
-    0xDA, 0x5F, 0xFD, 0xB9, 0xA4, 0x5F, 0xD6, 0xA3, 0x55, 0x04, 0xFE, 0xFF, 0x7E, 0x4F, 0xF9, 0xC4,
-    0x7F, 0x60, 0x2A, 0x0F, 0x20, 0x21, 0xCD, 0x14, 0xEE, 0x94, 0x01, 0x19, 0x33, 0x87, 0xF7, 0x71,
-    0xBA, 0x42, 0xF8, 0x3C, 0x8D, 0xC2, 0xF8, 0x6B, 0x92, 0x6B, 0x60, 0x4E, 0x2D, 0x34, 0x67, 0x16,
-    0x9C, 0xB7, 0x71, 0x00, 0x04, 0xEE, 0xB0, 0x27, 0xF1, 0xE7, 0x00, 0x82, 0x8F, 0x33, 0x89, 0xF2,
-    0xC4, 0x26, 0x26, 0x5D, 0x9A, 0xD2, 0xBD, 0x45, 0x55, 0x5F, 0x31, 0x0D, 0x7B, 0x7D, 0x47, 0x12,
-    0x18, 0x89, 0xD6, 0x54, 0xED, 0xE8, 0xCF, 0xA9, 0x4E, 0x50, 0xAB, 0xC2, 0x76, 0xF1, 0xB5, 0x05,
-    0x95, 0xF5, 0xC9, 0xEA, 0xB4, 0xDD, 0xCD, 0x1A, 0xCF, 0xFC, 0x7F, 0xD1, 0x9B, 0x3E, 0xE1, 0x18,
-    0xA9, 0x3F, 0xDC, 0xA0, 0x27, 0x93, 0x8E, 0x7A, 0x8E, 0x5B, 0x8A, 0x23, 0x95, 0x44, 0x1C, 0xE0,
-    0x18, 0xFC, 0xF2, 0x4F, 0x48, 0x58, 0xEA, 0x1A, 0x26, 0xB5, 0xE1, 0xCC, 0x9B, 0xD6, 0xFE, 0x48,
-    0xC5, 0x1B, 0xA9, 0x57, 0x28, 0x39, 0xC2, 0x2E, 0x60, 0x44, 0x83, 0x99, 0x79, 0x27, 0x75, 0xCC,
-    0x65, 0x42, 0x5E, 0x71, 0xD0, 0x30, 0x0A, 0x05, 0xBF, 0xC5, 0x3C, 0x3C, 0x06, 0x0F, 0x43, 0xDC,
-    0x10, 0x06, 0x0D, 0x61, 0xC4, 0x30, 0xDC, 0x34, 0x56, 0x68, 0xA0, 0xC8, 0xDA, 0x10, 0xA1, 0xF1,
-    0x81, 0xC1, 0x41, 0x23, 0x83, 0x30, 0x2C, 0x08, 0x63, 0x82, 0x06, 0x04, 0x8D, 0x06, 0x4D, 0x28,
-    0xF8, 0xDF, 0xDF, 0xAB, 0xE2, 0xA9, 0xEB, 0x54, 0x8F, 0xA9, 0x83, 0xAA, 0xAE, 0x58, 0x68, 0x20,
-    0x98, 0x0F, 0x6A, 0x28, 0xBA, 0xF2, 0xB2, 0x76, 0x7A, 0xBA, 0xED, 0x0C, 0x1D, 0xB6, 0x93, 0xC4,
-    0x81, 0xA8, 0xC8, 0x2B, 0x53, 0xE5, 0xB2, 0x85, 0x13, 0x85, 0xFC, 0x8A, 0xC4, 0x8A, 0x72, 0x80,
-    0x9A, 0x35, 0x52, 0x80, 0xDE, 0x49, 0xEA, 0x9C, 0x93, 0x79, 0x3C, 0xF5, 0xC1, 0xFA, 0x4E, 0xFD,
-    0xE0, 0xB5, 0x34, 0x8C, 0xD4, 0x59, 0x46, 0xD6, 0x7C, 0x7E, 0x81, 0xBF, 0x8D, 0x18, 0xAA, 0x2D,
-    0x60, 0x83, 0x31, 0x06, 0xC5, 0x2E, 0xCE, 0xFE, 0x6B, 0xD4, 0x4C, 0x6F, 0x4F, 0x16, 0x19, 0x2E,
-    0xC8, 0xBC, 0x72, 0x79, 0xA5, 0xF2, 0x64, 0xF2, 0x15, 0x09, 0x2E, 0xBD, 0x2D, 0x96, 0x26, 0x69,
-    0xBC, 0xB2, 0x78, 0x25, 0xF1, 0xCA, 0xE1, 0x95, 0xC2, 0x2B, 0x83, 0x57, 0x02, 0xAF, 0xFC, 0x5D,
-    0xE9, 0xBB, 0xB2, 0x77, 0x65, 0x22, 0xCA, 0xDD, 0x95, 0xBA, 0x1B, 0x73, 0x57, 0xE2, 0x6E, 0xBC,
-    0xDD, 0xC0, 0xDF, 0xF8, 0x06, 0xF0, 0x23, 0xBA, 0x60, 0x50, 0x79, 0x2C, 0x70, 0x60, 0x1E, 0xD1,
-    0xC2, 0x4E, 0x84, 0xCA, 0x93, 0x3A, 0x87, 0xF9, 0x23, 0xCE, 0xE7, 0xC7, 0xFC, 0x1E, 0x74, 0x99,
-    0x5F, 0x5B, 0xEC, 0xBC, 0xDE, 0x92, 0x59, 0x10, 0xFD, 0xBA, 0x20, 0xD1, 0x9F, 0xE5, 0x4A, 0xF4,
-    0xD5, 0x4B, 0x8F, 0x74, 0x1A, 0xCA, 0x97, 0x46, 0xF4, 0x15, 0xA5, 0x87, 0x31, 0x97, 0xDC, 0xAE,
-    0x68, 0x78, 0x86, 0x4A, 0x14, 0x7A, 0x25, 0x6F, 0xAD, 0xE3, 0x3E, 0xCD, 0xA3, 0x12, 0xF5, 0x35,
-    0x20, 0xFF, 0x63, 0x51, 0x07, 0x73, 0x12, 0xE4, 0xDF, 0x6C, 0xF3, 0xC7, 0xFB, 0xF3, 0x6F, 0x1E,
-    0xC5, 0x96, 0x05, 0xF1, 0x9B, 0x89, 0xFA, 0xA1, 0xF5, 0x33, 0xA7, 0x0A, 0x31, 0xEF, 0xC6, 0x75,
-    0xF0, 0xD2, 0x4A, 0x56, 0x6E, 0x98, 0x77, 0x8B, 0x5F, 0x87, 0xAF, 0x85, 0x6F, 0x8E, 0xAF, 0x8E,
-    0xE6, 0x9E, 0x5B, 0xEE, 0xA7, 0x46, 0x23, 0x26, 0xC4, 0x8B, 0x70, 0x11, 0x28, 0x7E, 0x88, 0x15,
-    0xA1, 0x22, 0x52, 0x04, 0x8A, 0x38, 0x11, 0x26, 0xA2, 0x44, 0x90, 0x1C, 0x46, 0x73, 0x40, 0x74,
-    0xE5, 0x3B, 0x57, 0xAC, 0x51, 0xC7, 0xD3, 0xD8, 0xF2, 0x07, 0x67, 0x15, 0x27, 0x75, 0xD8, 0x36,
-    0xFE, 0xE9, 0xD9, 0xD3, 0x65, 0x59, 0xB4, 0x74, 0x44, 0x50, 0x75, 0x27, 0x9C, 0xD4, 0x2D, 0x91,
-    0xB3, 0x90, 0x3D, 0x79, 0x63, 0xA4, 0x9F, 0x15, 0xD3, 0xF1, 0x24, 0xB1, 0xEA, 0xF8, 0xEA, 0x2A,
-    0x13, 0x5D, 0xDB, 0xEA, 0x09, 0x8D, 0x86, 0x9E, 0x7A, 0xAC, 0xE8, 0x3B, 0x83, 0xE2, 0xB1, 0x78,
-    0xBF, 0xC1, 0xDC, 0xD2, 0x59, 0xFC, 0x08, 0x0A, 0xE0, 0xF5, 0xB4, 0xAB, 0xE4, 0xEA, 0x0B, 0xC1,
-    0xCA, 0x0C, 0xCA, 0xE2, 0x7D, 0xA8, 0x26, 0xA6, 0xE4, 0xEA, 0xF4, 0x63, 0x45, 0xBF, 0xC4, 0x28,
-    0xA5, 0x9C, 0xE3, 0x36, 0x3E, 0xAF, 0x02, 0xAB, 0x1C, 0xFE, 0xE7, 0x23, 0x50, 0x9F, 0x77, 0x89,
-    0xD5, 0xB5, 0x13, 0xC3, 0x6A, 0xA7, 0xD4, 0x77, 0x87, 0xFD, 0x9E, 0xFC, 0x9E, 0x46, 0xDF, 0x78,
-    0x1E, 0x16, 0x2F, 0xD4, 0x85, 0x37, 0x7B, 0x50, 0x44, 0x65, 0xDA, 0x4F, 0x73, 0x46, 0x82, 0x6D,
-    0x44, 0x8B, 0x03, 0xE9, 0xC2, 0x3D, 0x66, 0x6F, 0xC2, 0x13, 0xCE, 0x96, 0x56, 0x31, 0xA6, 0x55,
-    0x4B, 0x4A, 0x4C, 0xBA, 0x9B, 0x9F, 0xD1, 0x65, 0x4D, 0xB0, 0x32, 0x4D, 0x4C, 0x34, 0xFF, 0xCA,
-    0xCF, 0x9C, 0x0E, 0xC2, 0x44, 0xDF, 0x16, 0xE3, 0x96, 0xC6, 0xC7, 0x25, 0x3E, 0x12, 0x34, 0xAE,
-    0x5B, 0xC7, 0x6B, 0x1B, 0xC6, 0x04, 0xC2, 0x44, 0xBE, 0x44, 0xBA, 0x44, 0x4C, 0x49, 0x96, 0xC8,
-    0x95, 0x18, 0x91, 0xC9, 0x94, 0x48, 0x94, 0xC8, 0x93, 0x48, 0x93, 0xC8, 0x92, 0x34, 0x71, 0x06,
-    0x47, 0x52, 0x8A, 0xB4, 0x50, 0xF7, 0x79, 0x4E, 0x18, 0xF0, 0xF3, 0xB9, 0xEF, 0xB3, 0x71, 0x35,
-    0x3F, 0x2D, 0xD8, 0x5C, 0xC7, 0x3D, 0x93, 0x16, 0x1B, 0xE4, 0x11, 0xC6, 0xB8, 0xAA, 0x79, 0x5D,
-    0xE6, 0x84, 0xB0, 0x61, 0xA8, 0x51, 0x5F, 0x56, 0x1B, 0x9D, 0x6E, 0x5F, 0x69, 0x3F, 0x49, 0x6D,
-    0xD5, 0x92, 0xEF, 0xD4, 0x4F, 0x1E, 0x28, 0x79, 0xBC, 0xDB, 0xF7, 0x4B, 0x4B, 0x90, 0x74, 0x2D,
-    0x5F, 0xCC, 0x6C, 0x4D, 0x77, 0x32, 0xB3, 0x44, 0xB3, 0x31, 0x28, 0xDF, 0x35, 0x21, 0xFB, 0x87,
-    0x06, 0xA6, 0xCC, 0xF6, 0xC1, 0x00, 0xB1, 0x00, 0xED, 0x71, 0xB7, 0x3C, 0x4B, 0x66, 0xBE, 0x7A,
-    0x5B, 0xF3, 0xB6, 0x40, 0xF1, 0xE1, 0x1A, 0x33, 0x67, 0xBA, 0xE1, 0x9C, 0x6A, 0x87, 0x4B, 0x7D,
-    0x8D, 0x38, 0x01, 0xE9, 0x8B, 0x82, 0x37, 0x63, 0x9E, 0x3A, 0xC4, 0x6A, 0xE7, 0x97, 0x6F, 0x57,
-    0x32, 0x98, 0xE1, 0xC6, 0x7A, 0xD2, 0x4A, 0x9D, 0xD5, 0x14, 0xED, 0xFC, 0x8D, 0x7C, 0x4E, 0xBE,
-    0xBC, 0x41, 0x2E, 0x47, 0xEF, 0xDC, 0xBD, 0x5B, 0xFA, 0x63, 0x7F, 0x8A, 0x95, 0x39, 0xF4, 0x26,
-    0x8A, 0x15, 0xA6, 0x28, 0xCD, 0xC3, 0x32, 0x2C, 0x89, 0x57, 0x42, 0xB4, 0x3E, 0x9C, 0x91, 0x75,
-    0xD5, 0xE4, 0x5E, 0x89, 0xD6, 0x39, 0xC8, 0x11, 0x0F, 0xD5, 0x00, 0x0E, 0x85, 0x1E, 0x22, 0xF3,
-    0x3E, 0x29, 0xC3, 0x3C, 0xFD, 0xFC, 0x8D, 0xD9, 0x91, 0x44, 0x53, 0x19, 0x4C, 0xA8, 0xF1, 0xDC,
-    0xC0, 0x76, 0xEA, 0x3B, 0x12, 0x3E, 0xDD, 0x41, 0x5A, 0x57, 0x20, 0xAB, 0x3C, 0xC2, 0x5C, 0xD1,
-    0x7D, 0x4D, 0xA8, 0x48, 0x4E, 0xE2, 0xA9, 0xE5, 0x63, 0xAB, 0x8E, 0x65, 0x2D, 0xBD, 0xEE, 0x89,
-    0xB7, 0x7F, 0x1F, 0xC3, 0x80, 0x9C, 0x93, 0x62, 0x60, 0xC6, 0x7A, 0x98, 0x0B, 0x2C, 0xD8, 0xB3,
-    0x03, 0xE4, 0x66, 0x24, 0x9E, 0x25, 0x56, 0x7D, 0x30, 0x7B, 0x1B, 0xEE, 0xA9, 0x57, 0x7F, 0xBA,
-    0x9C, 0xF0, 0x30, 0x58, 0xA7, 0xFF, 0x3A, 0x15, 0xEF, 0x78, 0xF0, 0x2A, 0x3C, 0x2C, 0x2B, 0xCC,
-    0xFD, 0x94, 0x04, 0x3A, 0x15, 0x23, 0x8E, 0xF4, 0x18, 0x18, 0x70, 0x59, 0x72, 0x95, 0x65, 0x3B,
-    0x9A, 0x70, 0xF4, 0x57, 0x8A, 0x2C, 0x39, 0xAB, 0xAE, 0x8B, 0x7F, 0x53, 0xE4, 0xE0, 0x58, 0x8F,
-    0x60, 0x02, 0x51, 0xDF, 0xD3, 0x04, 0xF5, 0x50, 0xAE, 0x60, 0xAA, 0x86, 0x57, 0x44, 0xEB, 0x0D,
-    0xF0, 0x83, 0xF1, 0x67, 0x3B, 0x43, 0xC8, 0x79, 0xBC, 0x50, 0x4F, 0xB5, 0x52, 0xAA, 0x55, 0x51,
-    0xAD, 0x80, 0x6A, 0xC9, 0xE6, 0x42, 0x92, 0x49, 0x50, 0x0C, 0x15, 0x83, 0x45, 0x71, 0x11, 0x05,
-    0x46, 0xA7, 0x38, 0xD7, 0xD2, 0xBA, 0xC3, 0xC6, 0x95, 0x0E, 0xB3, 0x7C, 0x1E, 0x3B, 0x14, 0x1F,
-    0x51, 0x80, 0x44, 0x11, 0xD2, 0xB1, 0x4F, 0xCE, 0x6F, 0x15, 0x75, 0x2B, 0x10, 0x52, 0x71, 0xC2,
-    0xE4, 0x70, 0x72, 0x40, 0x39, 0xA4, 0x2C, 0x69, 0xE8, 0xC3, 0x8D, 0xFB, 0x7F, 0x5F, 0x36, 0xCB,
-    0xB8, 0x9E, 0x27, 0x0D, 0x2F, 0x0C, 0xC3, 0x5D, 0x60, 0x68, 0xC3, 0xF3, 0x30, 0x5C, 0xD7, 0xF5,
-    0xD2, 0xD1, 0xB8, 0xB8, 0xA1, 0x24, 0x34, 0xD6, 0x15, 0x18, 0x29, 0x92, 0x5E, 0xBE, 0x90, 0xBD,
-    0xF5, 0xB4, 0xCC, 0x07, 0xDA, 0xCC, 0x52, 0x56, 0xCE, 0x71, 0x97, 0x19, 0x9C, 0xA7, 0xC5, 0xE5,
-    0x50, 0x43, 0xC5, 0x86, 0xFA, 0x30, 0x0A, 0x13, 0xBF, 0x4B, 0x25, 0x93, 0xB7, 0x88, 0x6B, 0xDA,
-    0xD3, 0x6A, 0xE0, 0x6F, 0x74, 0x7C, 0x97, 0x0B, 0xA5, 0xEB, 0x55, 0x9A, 0xCB, 0x4D, 0x35, 0x99,
-    0x1B, 0xA8, 0x4B, 0x21, 0xE0, 0x15, 0x61, 0xC4, 0xA2, 0x04, 0xC2, 0x48, 0xE8, 0xE0, 0x1E, 0xE0,
-    0x2E, 0xB5, 0xA2, 0xA0, 0x62, 0x76, 0x10, 0x68, 0x25, 0x49, 0x1A, 0x19, 0x43, 0x2E, 0x56, 0xCF,
-    0xD9, 0x61, 0xAC, 0x29, 0xC7, 0xB4, 0xA5, 0x8E, 0x55, 0x5B, 0xAA, 0xD0, 0xAB, 0xC6, 0x67, 0xF7,
-    0x73, 0x44, 0x45, 0x76, 0x15, 0xE0, 0xE8, 0x82, 0x12, 0x01, 0x3A, 0x64, 0xB9, 0x35, 0x2A, 0x88,
-    0xE5, 0xC7, 0x14, 0xFE, 0x2E, 0x87, 0x01, 0xA4, 0x4E, 0xFE, 0x01, 0x82, 0xA6, 0x74, 0x0D, 0x2C,
-    0x71, 0x01, 0xF6, 0x23, 0x0E, 0x19, 0xE5, 0x4D, 0x59, 0x42, 0x88, 0xC6, 0x4B, 0xC5, 0x8B, 0x97,
-    0x95, 0xEA, 0xA9, 0x4F, 0xD7, 0x94, 0xE1, 0x4A, 0x3B, 0x6C, 0xBB, 0x72, 0x9E, 0x98, 0x50, 0xCC,
-    0xF2, 0x90, 0xE4, 0x31, 0xC7, 0x63, 0x8A, 0xC7, 0x0C, 0x8F, 0x09, 0x1E, 0xF3, 0x3B, 0xA6, 0x77,
-    0x4C, 0xEC, 0xEC, 0x13, 0x96, 0x4C, 0xED, 0x98, 0xD9, 0xD1, 0xB6, 0x98, 0xD7, 0x69, 0x5A, 0x87,
-    0x89, 0x0B, 0x9A, 0x8C, 0xD8, 0x51, 0x80, 0x08, 0x26, 0xEA, 0x2B, 0xB6, 0x37, 0xE8, 0xD0, 0x6A,
-    0x52, 0xB6, 0x1B, 0x37, 0x4E, 0xA1, 0xEE, 0xE7, 0xE1, 0x7B, 0xE9, 0x79, 0x1B, 0xBF, 0xFB, 0x42,
-    0xB1, 0xD0, 0x62, 0x50, 0x4C, 0xCB, 0x0F, 0x59, 0x0A, 0xD2, 0x4A, 0x90, 0x15, 0x82, 0xAE, 0xB5,
-    0x04, 0xB2, 0x66, 0xBF, 0x02, 0xAB, 0xB4, 0xBB, 0x3F, 0x60, 0xD9, 0x11, 0x0B, 0xFF, 0x9A, 0xC5,
-    0x2C, 0xCA, 0x77, 0xB9, 0xB1, 0xCC, 0x40, 0x79, 0x3C, 0xD7, 0xE2, 0x59, 0x4D, 0xAC, 0xCD, 0xA8,
-    0xDB, 0xDA, 0x06, 0x60, 0xD0, 0x6E, 0xC2, 0x2E, 0x87, 0x43, 0xBA, 0xAC, 0x01, 0x97, 0x66, 0xF6,
-    0x59, 0x0F, 0x54, 0x53, 0xB9, 0xA2, 0x25, 0xAF, 0x0B, 0x02, 0x7D, 0xD2, 0x08, 0xE4, 0x2D, 0x09,
-    0x74, 0x76, 0x7F, 0xBF, 0xCF, 0x38, 0x8A, 0x04, 0x95, 0x02, 0x75, 0xE8, 0x37, 0x5E, 0x93, 0x51,
-    0x2B, 0x82, 0x34, 0xAE, 0x84, 0x32, 0x06, 0x74, 0x5C, 0xA1, 0xD2, 0xB8, 0xA4, 0x6C, 0x92, 0x0B,
-    0x0B, 0x96, 0xD5, 0xD2, 0xEA, 0x02, 0x95, 0xD8, 0x24, 0x35, 0xDE, 0x63, 0x88, 0xEC, 0x69, 0x8B,
-    0xF1, 0x33, 0x2C, 0x97, 0xD5, 0xBA, 0x6C, 0xBB, 0x37, 0x17, 0xA9, 0x75, 0xFC, 0x03, 0x60, 0x18,
-    0x12, 0xBB, 0x60, 0x49, 0x2A, 0x9F, 0x24, 0xD1, 0xAF, 0x5B, 0x57, 0xBB, 0xDD, 0xD6, 0x78, 0x0E,
-    0xBE, 0xBE, 0x94, 0xB5, 0xBA, 0xEA, 0xB7, 0xC5, 0x23, 0x1B, 0xB4, 0x5E, 0x3A, 0xB4, 0x5A, 0x7A,
-    0x53, 0x41, 0xEA, 0x37, 0x7C, 0x3F, 0x6B, 0x1E, 0xF7, 0x1D, 0xDE, 0x9F, 0xDD, 0xF9, 0x7F, 0xD4,
-    0x3F, 0xB3, 0x5E, 0x19, 0x7E, 0xAC, 0x55, 0x26, 0x4D, 0xA7, 0x4C, 0x9A, 0x46, 0x99, 0x2C, 0xF4,
-    0xC9, 0xDA, 0x36, 0x59, 0xDB, 0x25, 0x6B, 0x9B, 0x64, 0x6D, 0x8F, 0xAC, 0x6D, 0x91, 0xB5, 0x1D,
-    0xB2, 0xB6, 0x41, 0xD6, 0xF6, 0xC7, 0xDA, 0xF6, 0x58, 0xDB, 0x1D, 0x6B, 0x9B, 0x63, 0x6D, 0x6F,
-    0xAC, 0x69, 0x8D, 0xB5, 0x9D, 0xB1, 0xB6, 0x31, 0xF6, 0x4C, 0x5F, 0xCC, 0xF8, 0xA0, 0x3B, 0x39,
-    0x7A, 0xA6, 0xE4, 0x7E, 0xF0, 0xDC, 0xEA, 0xF4, 0x69, 0x69, 0x8B, 0xB9, 0x65, 0xA9, 0x55, 0xCC,
-    0xED, 0xC6, 0x7C, 0x7D, 0x2D, 0x90, 0xBD, 0x08, 0xA6, 0x26, 0x4C, 0xCB, 0x70, 0xC1, 0x37, 0x31,
-    0xB5, 0xF3, 0xED, 0x1A, 0x23, 0x54, 0xEA, 0x89, 0xC2, 0x7E, 0xD3, 0xFC, 0xFE, 0x96, 0xE8, 0x07,
-    0x48, 0x45, 0xAA, 0x9E, 0x02, 0xBC, 0x42, 0x2B, 0xC3, 0x34, 0x4D, 0x7F, 0xE2, 0x6C, 0xD4, 0x5A,
-    0x58, 0x61, 0xE9, 0x58, 0x38, 0x13, 0xED, 0x91, 0x4B, 0x92, 0xAC, 0xD9, 0x16, 0x17, 0x56, 0x3B,
-    0x6E, 0x56, 0x21, 0x64, 0x7B, 0xB2, 0xFF, 0xA0, 0x60, 0xE2, 0x09, 0xF7, 0x5B, 0xFF, 0x14, 0x69,
-    0x8C, 0xDA, 0x68, 0x9F, 0x70, 0xD2, 0x46, 0x59, 0xB2, 0x53, 0x1B, 0xD5, 0x99, 0xD9, 0xD3, 0x93,
-    0x5C, 0x6D, 0xB4, 0xAB, 0xC5, 0xE6, 0x4A, 0x9B, 0x33, 0x06, 0xD1, 0x21, 0x15, 0xA6, 0xCB, 0xEB,
-    0xF2, 0xEF, 0x2C, 0x2F, 0x67, 0x7F, 0x3C, 0xB1, 0xFC, 0x2D, 0xAE, 0x87, 0x6E, 0x0E, 0xCF, 0xCD,
-    0x2D, 0x35, 0xA8, 0xBD, 0x9A, 0x7A, 0x31, 0x61, 0x92, 0xEC, 0x0A, 0xA3, 0x41, 0x56, 0xB2, 0x10,
-    0xDA, 0x53, 0x9E, 0x38, 0x50, 0x7F, 0x71, 0xA8, 0xA3, 0x2D, 0x14, 0xA5, 0xA1, 0x7C, 0x41, 0x45,
-    0x53, 0xF4, 0xB4, 0xE8, 0xE8, 0x2B, 0xB9, 0x0A, 0x59, 0x96, 0x57, 0x35, 0x75, 0xB1, 0x41, 0x47,
-    0xED, 0x9C, 0xB2, 0xC2, 0x14, 0x17, 0xB4, 0x8A, 0xE4, 0xA7, 0xF4, 0xA4, 0xE9, 0x03, 0xA2, 0x90,
-    0x1D, 0xCF, 0x79, 0xAA, 0x8D, 0x5D, 0x69, 0x6B, 0xE4, 0xB6, 0x2C, 0x56, 0x15, 0xDA, 0xCC, 0x49,
-    0xED, 0x38, 0x9D, 0x6B, 0x5B, 0x36, 0x1D, 0xAB, 0x5D, 0x3B, 0x5C, 0x5E, 0xD8, 0x11, 0x31, 0xDF,
-    0x94, 0x10, 0x43, 0x69, 0xEB, 0x55, 0xB9, 0x56, 0x55, 0xD3, 0xA9, 0x72, 0x8D, 0x2A, 0x6B, 0xD7,
-    0xB9, 0x66, 0x9D, 0x6B, 0xD5, 0xB9, 0x46, 0x9D, 0xF5, 0xA8, 0x5C, 0x93, 0xCE, 0xB5, 0xE8, 0x5C,
-    0x83, 0xCE, 0xB5, 0xE7, 0x5C, 0x73, 0xCE, 0xB5, 0xE6, 0x5C, 0x63, 0xCE, 0xF5, 0xA6, 0x5C, 0x6B,
-    0xCA, 0x75, 0xA6, 0x5C, 0x63, 0xCA, 0x16, 0x17, 0x4D, 0x40, 0x2D, 0x64, 0xEC, 0x8C, 0xF0, 0x4C,
-    0xDB, 0x4A, 0x62, 0x1F, 0x89, 0x4D, 0x24, 0x76, 0x90, 0xD8, 0x3E, 0x62, 0xEF, 0x88, 0x8D, 0x23,
-    0x76, 0x8D, 0xAC, 0x18, 0xB2, 0xD8, 0xD3, 0xB4, 0x0F, 0x1B, 0x44, 0x07, 0x32, 0x2F, 0x1C, 0x59,
-    0xD7, 0x6F, 0x6F, 0xDE, 0xE9, 0xB2, 0x34, 0xFD, 0x7B, 0x3A, 0x0E, 0x34, 0x1C, 0x0E, 0x99, 0x0E,
-    0x7B, 0xC5, 0x56, 0x7B, 0x6E, 0xDF, 0x2F, 0x25, 0xEB, 0x5F, 0xCC, 0xD3, 0xF4, 0xF0, 0x2D, 0x8D,
-    0x4D, 0x1A, 0xAB, 0x36, 0xD5, 0x80, 0x6F, 0x3F, 0x9B, 0xA6, 0x87, 0x4F, 0x3E, 0x68, 0xD3, 0xF4,
-    0xCB, 0x6A, 0x1B, 0xB7, 0xD5, 0x75, 0x68, 0x82, 0xEE, 0xCF, 0x13, 0x74, 0x69, 0xBA, 0x3D, 0x6A,
-    0x80, 0x95, 0x01, 0x41, 0x06, 0xBE, 0x66, 0x13, 0x1F, 0x7C, 0xD1, 0x97, 0xD0, 0xC3, 0xEA, 0x10,
-    0xB8, 0xB7, 0xAB, 0xEC, 0xD0, 0x5B, 0xA1, 0xED, 0x44, 0x8B, 0x19, 0xAE, 0xBA, 0xEF, 0xBB, 0x7E,
-    0xA0, 0xEB, 0x7F, 0xBB, 0x82, 0x85, 0xF3, 0x0B, 0x0B, 0xFB, 0x37, 0xFE, 0x4F, 0x25, 0xF2, 0x2E,
-    0xAD, 0x08, 0x47, 0xF3, 0x16, 0xE6, 0x1F, 0x59, 0xCD, 0x5E, 0x96, 0xAB, 0xFA, 0x2F, 0x2B, 0xB5,
-    0xD7, 0x70, 0xA2, 0x36, 0xB9, 0xB7, 0xC4, 0x1C, 0xDD, 0x64, 0x6C, 0x92, 0x8A, 0xDF, 0x22, 0x15,
-    0x2F, 0x1B, 0x2A, 0x1E, 0x32, 0x9C, 0xAC, 0x91, 0x8A, 0x77, 0x48, 0xC5, 0x1F, 0x82, 0x8A, 0x7B,
-    0x43, 0x50, 0xF1, 0xA0, 0x0F, 0x2A, 0x1E, 0x93, 0x8A, 0x6F, 0x92, 0x8A, 0xDF, 0x22, 0x15, 0x2F,
-    0x41, 0xC5, 0xFD, 0x02, 0x54, 0x3C, 0x04, 0x60, 0xBD, 0x35, 0x52, 0xF1, 0x0E, 0xA9, 0x38, 0x79,
-    0x02, 0xEE, 0x45, 0x74, 0x26, 0x15, 0x8F, 0x49, 0xC5, 0x37, 0xBD, 0x85, 0xE2, 0xD4, 0xF5, 0x86,
-    0x15, 0x1A, 0x3F, 0x6F, 0x89, 0xAD, 0xCD, 0x39, 0x96, 0xBD, 0x3F, 0xC3, 0xC2, 0x4E, 0x3F, 0xC0,
-    0x25, 0x87, 0xB8, 0x0E, 0x08, 0xB1, 0xCE, 0x14, 0x4E, 0x81, 0xC8, 0x45, 0x92, 0xEE, 0x2D, 0x5A,
-    0x1A, 0x28, 0x78, 0x7A, 0xB5, 0x40, 0xAC, 0x78, 0x33, 0xC7, 0xF0, 0x43, 0x5C, 0x97, 0xDE, 0x26,
-    0xDD, 0x18, 0xA9, 0x0F, 0xA4, 0x8F, 0xFF, 0x14, 0x3E, 0x73, 0x83, 0x33, 0xBA, 0xB5, 0x32, 0xA7,
-    0x8E, 0xE7, 0x14, 0x92, 0xCC, 0x08, 0xDF, 0x7B, 0x1A, 0xCE, 0x0A, 0x5D, 0x96, 0x65, 0x67, 0xB9,
-    0x95, 0xF2, 0xAD, 0xD6, 0xD0, 0xBC, 0xFC, 0x3A, 0x6C, 0x0F, 0x51, 0x73, 0x02, 0x43, 0xDE, 0x85,
-    0x20, 0x09, 0xA6, 0xCD, 0x73, 0x06, 0x74, 0x32, 0x4B, 0x71, 0xF5, 0x4E, 0x9B, 0x08, 0xC9, 0x31,
-    0xDD, 0xB8, 0x5F, 0xFC, 0xFE, 0xB3, 0x4E, 0xFC, 0x5B, 0x6D, 0x49, 0xFF, 0x48, 0xD4, 0x01, 0xC5,
-    0x7F, 0x33, 0x94, 0x57, 0xE5, 0x64, 0xAB, 0xAA, 0x2B, 0xAF, 0xC3, 0x1A, 0xA2, 0x8F, 0xC6, 0xB4,
-    0x40, 0x32, 0xC1, 0x31, 0x33, 0xC3, 0x0E, 0x43, 0xCB, 0x19, 0xAF, 0x2D, 0x5C, 0x20, 0x4D, 0x4A,
-    0x9E, 0xEE, 0xEB, 0x7E, 0x9D, 0x8E, 0x0D, 0x50, 0x6F, 0x8B, 0x2E, 0x60, 0xFD, 0x6B, 0x6D, 0xE7,
-    0x27, 0x3F, 0x27, 0x77, 0x98, 0x7E, 0x63, 0xDB, 0xD9, 0x2B, 0x74, 0x47, 0x8E, 0xEE, 0xC7, 0xD1,
-    0xDD, 0x38, 0x03, 0xEE, 0xC5, 0xF1, 0xF2, 0x6B, 0x10, 0x02, 0x7F, 0x1D, 0xE1, 0xDA, 0x83, 0x04,
-    0x2B, 0x01, 0xF4, 0xEA, 0x8C, 0x9B, 0xE9, 0x88, 0x3C, 0x62, 0x90, 0xFB, 0x23, 0x70, 0xD1, 0x21,
-    0x8D, 0x3A, 0x61, 0x25, 0x1D, 0xA4, 0xED, 0x48, 0xBA, 0x21, 0xAB, 0x1C, 0x7D, 0x39, 0x34, 0x22,
-    0xA2, 0x9F, 0x2E, 0x6E, 0xE4, 0xFA, 0x4C, 0x9E, 0x8C, 0x2D, 0x19, 0x35, 0x9E, 0x71, 0x5F, 0x09,
-    0x31, 0xAE, 0x4B, 0x6E, 0x42, 0xD8, 0x2D, 0xC8, 0xE1, 0xCA, 0x37, 0x2F, 0x51, 0x4D, 0x95, 0x82,
-    0x99, 0x21, 0x65, 0xE8, 0xE0, 0x9A, 0xF5, 0x93, 0x53, 0xD1, 0xBB, 0x76, 0x5D, 0xB3, 0x73, 0xA9,
-    0xC0, 0x1B, 0xAF, 0x44, 0x30, 0x19, 0x50, 0xE6, 0x66, 0xB1, 0xD0, 0x94, 0xC8, 0x11, 0x83, 0x66,
-    0x6F, 0x51, 0x69, 0x3B, 0x07, 0x16, 0xFA, 0x14, 0xCA, 0xEA, 0xE8, 0x24, 0x9B, 0xB6, 0x7D, 0xD7,
-    0xA9, 0x74, 0x38, 0xAF, 0x5B, 0xD3, 0x5E, 0x49, 0xE6, 0xC8, 0xE3, 0xCE, 0xAD, 0xD0, 0x7F, 0x24,
-    0x6F, 0x94, 0xE1, 0x87, 0x23, 0xAF, 0xBC, 0xED, 0x7C, 0x06, 0xD2, 0xE4, 0x81, 0xF2, 0x49, 0xF8,
-    0x7D, 0xB0, 0x43, 0x25, 0xC0, 0xFC, 0xDD, 0xD6, 0x67, 0x1D, 0xE8, 0x6F, 0xA5, 0xBF, 0xB3, 0x87,
-    0xEC, 0xFC, 0xF2, 0xA6, 0x4B, 0x4C, 0x62, 0x11, 0x6B, 0xFF, 0x71, 0x84, 0xF0, 0xF2, 0x13, 0xB7,
-    0x57, 0xE4, 0x85, 0xC8, 0x8C, 0x57, 0xF9, 0x75, 0x81, 0x17, 0xE1, 0x3D, 0xF6, 0x9A, 0x4B, 0xF7,
-    0xD8, 0xB3, 0xC6, 0xE3, 0xB1, 0xF6, 0xB0, 0x7A, 0xA3, 0xC2, 0xD1, 0xE1, 0x56, 0xFC, 0x56, 0x83,
-    0xEC, 0x17, 0xDC, 0xC4, 0xE0, 0x69, 0x38, 0xE1, 0x2E, 0xC9, 0xE1, 0x84, 0xCC, 0x81, 0x2E, 0xE3,
-    0x31, 0x2B, 0x7F, 0x97, 0x59, 0x99, 0x68, 0xD7, 0xCD, 0x4B, 0xDD, 0xC2, 0x60, 0x6E, 0x12, 0xAA,
-    0x8E, 0xD5, 0x4D, 0xC2, 0xBD, 0x2C, 0xB8, 0xC9, 0xDF, 0xB5, 0x92, 0xA3, 0x8B, 0xC7, 0x7B, 0x9F,
-    0x76, 0x4F, 0xDA, 0xBC, 0xFD, 0x0E, 0xB9, 0x66, 0x90, 0x2F, 0x66, 0x6B, 0x2F, 0x77, 0xBB, 0xC6,
-    0x6F, 0x5B, 0x41, 0x27, 0xA0, 0xA7, 0x4D, 0xEC, 0xDF, 0x2D, 0x4F, 0x6C, 0x67, 0x69, 0x62, 0xB3,
-    0xFA, 0x58, 0x8B, 0x02, 0xCC, 0xAB, 0x02, 0xCD, 0x37, 0x2A, 0x1A, 0x66, 0x45, 0xCB, 0xD4, 0x74,
-    0x9F, 0x83, 0xC7, 0x3D, 0x56, 0x9A, 0xF4, 0x43, 0xFD, 0x74, 0x7F, 0x66, 0x89, 0x9D, 0x64, 0xBA,
-    0x17, 0x53, 0x13, 0x7C, 0x4F, 0x73, 0xA4, 0xCA, 0xEA, 0x52, 0xBA, 0xF1, 0x9C, 0x09, 0x7D, 0x8E,
-    0xE0, 0x9E, 0x0C, 0x7B, 0x75, 0x19, 0x8E, 0x57, 0xA0, 0x6C, 0xFC, 0x1E, 0x52, 0x99, 0x0F, 0xC7,
-    0x26, 0xCC, 0x23, 0x70, 0xFD, 0x75, 0x93, 0xE2, 0xC7, 0x77, 0xBA, 0xB2, 0xF3, 0xAB, 0xBA, 0x1F,
-    0xFC, 0x13, 0xDE, 0xF2, 0xCF, 0x51, 0xCE, 0xAA, 0x97, 0x2B, 0xB2, 0x7C, 0x6D, 0x1F, 0x4E, 0xE6,
-    0x72, 0xE8, 0x6D, 0xB7, 0x30, 0x2C, 0xE3, 0xD7, 0xF9, 0x8C, 0x97, 0xE7, 0x53, 0x5E, 0xB6, 0x8A,
-    0x1A, 0x7B, 0x33, 0x5C, 0x70, 0xBC, 0x07, 0xDA, 0xBA, 0xD6, 0x12, 0xC3, 0xDF, 0x59, 0xBD, 0xF3,
-    0xC6, 0xF7, 0xDE, 0xD4, 0x9D, 0x51, 0x1F, 0x29, 0x51, 0x1E, 0x6A, 0x8E, 0x3D, 0xDA, 0x3C, 0x7D,
-    0xFB, 0x44, 0x34, 0xF2, 0x61, 0xF1, 0x7A, 0xBA, 0x78, 0x13, 0x92, 0x88, 0x76, 0xF1, 0x9E, 0x4C,
-    0x1F, 0xDF, 0xBF, 0xA7, 0xBA, 0xEA, 0x2B, 0xF7, 0x76, 0xB4, 0x48, 0x19, 0x2E, 0x6F, 0xA8, 0x3F,
-    0x1D, 0xFB, 0x40, 0x94, 0xE9, 0x14, 0xCA, 0x74, 0x2E, 0xE2, 0xB5, 0x67, 0x4E, 0x7A, 0x8F, 0xCC,
-    0x2A, 0xEB, 0x39, 0xE9, 0x5F, 0xCF, 0x34, 0x6D, 0x60, 0x66, 0x98, 0x92, 0x85, 0x5D, 0xB4, 0x24,
-    0xDE, 0x52, 0x20, 0x15, 0x47, 0x0B, 0xB7, 0xDA, 0x0B, 0xD3, 0x15, 0x62, 0x9B, 0xB2, 0xD2, 0xB2,
-    0x69, 0xEB, 0x60, 0x49, 0xBC, 0xC6, 0x7C, 0xFA, 0xB1, 0xF8, 0x6E, 0xB3, 0x53, 0x97, 0xB0, 0xA4,
-    0xC3, 0x9D, 0x1C, 0x9E, 0x64, 0xB2, 0xD4, 0x3B, 0xDB, 0x6D, 0xCB, 0x3B, 0x4A, 0xAE, 0xE7, 0x39,
-    0xC7, 0x05, 0x5C, 0x37, 0x1D, 0x88, 0x8A, 0x5F, 0x44, 0xF8, 0xAC, 0x6A, 0x78, 0x0B, 0xA6, 0x8E,
-    0x5C, 0x72, 0x7B, 0x95, 0x96, 0xC4, 0x0F, 0xE5, 0x0F, 0x01, 0x5F, 0x47, 0xAE, 0xE0, 0xB3, 0x2B,
-    0xD9, 0xEB, 0x63, 0x70, 0x98, 0x61, 0x9B, 0x17, 0xEA, 0x56, 0xE1, 0x21, 0x3B, 0x63, 0xDC, 0x07,
-    0x62, 0xA4, 0x95, 0xC5, 0x9B, 0x32, 0xDB, 0x9F, 0x3D, 0x28, 0x3B, 0xDE, 0xC4, 0x1F, 0xDE, 0xF2,
-    0xC7, 0xDE, 0xF0, 0x61, 0x30, 0xC2, 0xE4, 0x41, 0xD4, 0xFC, 0x1B, 0x76, 0x0E, 0xB6, 0x75, 0xDF,
-    0xE7, 0xED, 0x1C, 0x3C, 0x6C, 0xE0, 0xD1, 0x72, 0x48, 0xB6, 0x58, 0x65, 0x74, 0xDA, 0x69, 0x26,
-    0xAA, 0x69, 0x55, 0xB8, 0xC4, 0x9F, 0x23, 0x35, 0x87, 0x6D, 0xE0, 0x78, 0x9F, 0xD5, 0x9D, 0x8A,
-    0xC8, 0x7B, 0x74, 0x6A, 0xFC, 0x5D, 0x0C, 0xBC, 0x6D, 0xEC, 0x8D, 0x9E, 0x16, 0x01, 0x26, 0x61,
-    0xDD, 0xA5, 0x8F, 0xB1, 0xDA, 0xD0, 0x6B, 0x0B, 0xC9, 0xB0, 0xC7, 0xDA, 0x54, 0xF4, 0x15, 0x23,
-    0x4E, 0x1E, 0x69, 0xC1, 0x6E, 0x04, 0x80, 0x30, 0x7C, 0xD7, 0xD4, 0x9B, 0x6B, 0xD6, 0x73, 0x0D,
-    0x8E, 0x55, 0x82, 0x16, 0xFF, 0xE5, 0xA4, 0x2D, 0x86, 0x66, 0x6D, 0x97, 0x72, 0x3E, 0xF4, 0x9A,
-    0xCD, 0x77, 0x8A, 0xBC, 0x4E, 0x36, 0xE9, 0x3E, 0x92, 0x49, 0xDC, 0x8F, 0x93, 0xDE, 0xA7, 0x6D,
-    0xE2, 0xEE, 0x0D, 0xEE, 0x48, 0xFC, 0xEB, 0x09, 0x5E, 0x7D, 0x88, 0x69, 0xE9, 0x62, 0x72, 0x1A,
-    0x0F, 0x54, 0x19, 0x59, 0xD9, 0xE9, 0x6B, 0xF5, 0x75, 0xED, 0x2D, 0xDB, 0xBC, 0xAE, 0x0B, 0x8A,
-    0x6E, 0xD1, 0x5F, 0x20, 0x33, 0xAE, 0x0C, 0xCE, 0xA2, 0x50, 0x0F, 0x06, 0x04, 0xE1, 0xBE, 0x2F,
-    0x0B, 0xBB, 0x65, 0xA1, 0xB8, 0xD5, 0xF0, 0x34, 0xC3, 0x70, 0x1B, 0x66, 0xC5, 0x55, 0xA1, 0x17,
-    0x3B, 0xC8, 0xAE, 0x10, 0xE8, 0xCA, 0x80, 0xAE, 0x08, 0xE8, 0x4A, 0x80, 0xAE, 0x00, 0xE8, 0xCA,
-    0x7F, 0xAE, 0xF8, 0xE7, 0x4A, 0x7F, 0xAE, 0xF0, 0xA7, 0x65, 0x3F, 0xB3, 0x9B, 0xC2, 0x95, 0xFC,
-    0x5C, 0xC1, 0xCF, 0x95, 0xFB, 0x5C, 0xB1, 0xCF, 0x95, 0xFA, 0x5C, 0xA1, 0xCF, 0x95, 0xF9, 0x5C,
-    0x0D, 0x8E, 0x0C, 0x2B, 0xC4, 0xCB, 0x41, 0xB2, 0x9A, 0x4A, 0xD9, 0xBA, 0xFD, 0x5F, 0x27, 0x12,
-    0xFF, 0x20, 0x6F, 0x9A, 0x17, 0x13, 0xAB, 0x0D, 0xD8, 0xB2, 0xFA, 0xED, 0xDD, 0x46, 0x30, 0x05,
-    0xFF, 0x4B, 0x58, 0x98, 0x6E, 0x65, 0xD6, 0x8D, 0xCC, 0xBA, 0x8D, 0x59, 0x37, 0x31, 0xEB, 0x16,
-    0x66, 0x96, 0xA2, 0x9A, 0x7D, 0x84, 0x51, 0xA1, 0x5B, 0x97, 0x75, 0xE3, 0xB2, 0xEE, 0x57, 0xB6,
-    0x81, 0x15, 0x29, 0x71, 0x25, 0x29, 0x58, 0xFD, 0xFF, 0x00, 0x7D, 0x55, 0x3D, 0x6C, 0xDB, 0x46,
-    0x14, 0xFE, 0x28, 0xCA, 0xA2, 0x63, 0x5A, 0xA2, 0xDA, 0x48, 0x41, 0x1A, 0xCB, 0xA2, 0x07, 0x0F,
-    0xAA, 0x23, 0x4B, 0x1A, 0x34, 0x28, 0x81, 0x2C, 0xDE, 0xD0, 0xA9, 0x93, 0x80, 0xDA, 0x5D, 0x52,
-    0xA0, 0x1A, 0xFB, 0x8B, 0x70, 0xD0, 0x90, 0x04, 0xB6, 0x75, 0xE8, 0xD2, 0xA1, 0x43, 0x55, 0xA0,
-    0xE9, 0xAC, 0xA1, 0x43, 0xAB, 0x36, 0xA8, 0x06, 0xA3, 0x40, 0x00, 0xBB, 0xBA, 0x6E, 0x45, 0xBA,
-    0x70, 0xCF, 0xC2, 0xF4, 0x67, 0xE7, 0xA0, 0x41, 0x2D, 0x6C, 0xB1, 0xDF, 0x51, 0x4E, 0x7F, 0x80,
-    0xA0, 0x67, 0xF1, 0xCC, 0x7B, 0xF7, 0xFE, 0xDF, 0xF7, 0x1E, 0x0B, 0xF0, 0xE0, 0x0A, 0x5B, 0xA6,
-    0x14, 0x84, 0xD1, 0xB5, 0x22, 0x47, 0xD5, 0xD0, 0x87, 0x00, 0x0A, 0x40, 0x8C, 0x54, 0x0C, 0xFB,
-    0x13, 0xB9, 0x9B, 0x0A, 0xF2, 0xFA, 0x16, 0xF6, 0x79, 0xAE, 0x36, 0x3D, 0x6D, 0xBA, 0x11, 0x0C,
-    0x51, 0x3C, 0xE8, 0x7A, 0x71, 0x58, 0x3C, 0xF8, 0xE7, 0x65, 0xCB, 0x90, 0x2D, 0x53, 0xD6, 0xA7,
-    0x70, 0xCE, 0xA1, 0x35, 0x1C, 0x2D, 0xCE, 0x0A, 0x95, 0x8C, 0x38, 0x75, 0xD4, 0xA9, 0x23, 0xB7,
-    0x33, 0xA8, 0x07, 0x7F, 0x46, 0xE2, 0xC4, 0x88, 0x5C, 0x59, 0x45, 0x05, 0x6B, 0xC3, 0xE3, 0x59,
-    0xD4, 0x0E, 0xAB, 0x51, 0xDB, 0x9B, 0x65, 0x04, 0xBA, 0x45, 0x33, 0x3A, 0xB3, 0x7F, 0x9C, 0xB9,
-    0x66, 0xD0, 0x72, 0x90, 0x4F, 0x83, 0x16, 0xDB, 0xA6, 0x72, 0x5D, 0xAD, 0xCD, 0x9A, 0xD1, 0x20,
-    0xD0, 0x6A, 0xF5, 0x27, 0x3D, 0x20, 0x9B, 0x2B, 0x65, 0xAB, 0xA5, 0x76, 0x75, 0x7B, 0x7B, 0x7F,
-    0x05, 0x47, 0xAE, 0xAC, 0xDB, 0xCA, 0xF9, 0x28, 0x34, 0xD5, 0x09, 0x44, 0x1E, 0x43, 0xA4, 0x22,
-    0x98, 0x11, 0xB6, 0x3E, 0x93, 0x4D, 0x4B, 0x7A, 0x89, 0x33, 0x5A, 0xF6, 0x6B, 0x58, 0xB1, 0x70,
-    0xEF, 0xA8, 0xB6, 0xA1, 0xA8, 0x19, 0x43, 0x6B, 0xB8, 0x89, 0x16, 0x0E, 0x31, 0xC5, 0x40, 0x78,
-    0x00, 0x2C, 0xE9, 0x44, 0x4E, 0x44, 0xC1, 0x30, 0xA5, 0x6C, 0xD1, 0x22, 0xA5, 0x8C, 0x81, 0x9C,
-    0x8A, 0x0B, 0x44, 0x98, 0x90, 0xD3, 0x81, 0xF1, 0x02, 0x9E, 0x42, 0x92, 0x3D, 0x4B, 0xA5, 0x02,
-    0xEA, 0xEC, 0x9A, 0x91, 0xAD, 0x5C, 0x68, 0x3A, 0x7C, 0x4C, 0xBC, 0xF0, 0x5A, 0x60, 0x28, 0xBA,
-    0x8B, 0x4D, 0xD4, 0xA3, 0xBD, 0x6E, 0x42, 0xC7, 0xE0, 0xBC, 0x78, 0x48, 0x96, 0xA6, 0xE6, 0x40,
-    0xD7, 0x80, 0xA3, 0x9C, 0xC0, 0x24, 0x9F, 0x95, 0xE8, 0x33, 0x50, 0xC7, 0x7D, 0x5A, 0x8C, 0x70,
-    0x8A, 0x2A, 0xFD, 0x36, 0xA5, 0x29, 0x6F, 0x86, 0x83, 0xA8, 0xD8, 0x9D, 0x46, 0x39, 0x6A, 0x5A,
-    0x87, 0xA1, 0x52, 0xCA, 0x9B, 0xDF, 0xFC, 0xCD, 0x42, 0x86, 0xFC, 0xD3, 0x79, 0xB1, 0xBB, 0xB4,
-    0x46, 0x91, 0xF0, 0x9B, 0x20, 0x96, 0xEF, 0xF2, 0x58, 0xA2, 0x6C, 0x9B, 0x46, 0x3A, 0x23, 0x2F,
-    0x5C, 0x93, 0xE9, 0xCE, 0xE0, 0x18, 0xAC, 0xC3, 0xB1, 0xA3, 0x8E, 0x1C, 0x55, 0x48, 0x61, 0x4D,
-    0xFE, 0x27, 0xF3, 0x60, 0xFA, 0xA0, 0x93, 0x91, 0x67, 0xD5, 0x52, 0x8A, 0xE1, 0x9D, 0x33, 0x2F,
-    0xA7, 0xEF, 0xCF, 0xA6, 0xD2, 0x08, 0x1D, 0x51, 0xC3, 0x1E, 0x3A, 0xA8, 0x9F, 0xDB, 0x33, 0x54,
-    0x5B, 0xCD, 0x7E, 0xCF, 0x8D, 0x63, 0xD4, 0xF9, 0xB4, 0x99, 0xA0, 0x26, 0x5D, 0xDA, 0xC2, 0xAA,
-    0x8E, 0x6B, 0x14, 0x8C, 0x9E, 0x3D, 0x53, 0xD3, 0x81, 0x2C, 0x24, 0xA5, 0x6B, 0x59, 0xB2, 0x56,
-    0xD3, 0xB9, 0xB7, 0xA3, 0x24, 0xFD, 0x44, 0xD3, 0x02, 0x66, 0x0C, 0xE7, 0x53, 0xB1, 0x67, 0xEA,
-    0x0A, 0xF4, 0x0C, 0xD9, 0xB7, 0x04, 0xEB, 0xE3, 0xCE, 0x35, 0x83, 0xF1, 0x25, 0x9C, 0x05, 0x3A,
-    0x6F, 0xC3, 0x37, 0x25, 0xB3, 0x40, 0x8A, 0x3B, 0xAB, 0x3E, 0x58, 0x9C, 0x30, 0x02, 0x1E, 0x09,
-    0xAE, 0x69, 0x2C, 0x0F, 0x0E, 0xB0, 0x33, 0x1E, 0xCB, 0x41, 0x1C, 0x2B, 0x5C, 0x2E, 0x3A, 0x13,
-    0xAD, 0x8D, 0xC7, 0x43, 0xFD, 0xAE, 0xEF, 0x3C, 0xDE, 0x51, 0xD6, 0x99, 0x67, 0x3B, 0xF1, 0xA9,
-    0x5F, 0xA7, 0x6D, 0x7D, 0xE3, 0xC5, 0x17, 0x3B, 0xE3, 0xAF, 0x12, 0x81, 0x69, 0x1C, 0xC7, 0xB3,
-    0x31, 0xD7, 0x28, 0x39, 0x1E, 0x6A, 0x68, 0x79, 0x22, 0x35, 0x47, 0x5D, 0x2E, 0x0B, 0xF7, 0xF7,
-    0xA2, 0x1F, 0x60, 0xD5, 0xB9, 0x36, 0xF5, 0xD6, 0xD6, 0xDB, 0x89, 0x2E, 0x51, 0xA8, 0x2F, 0xB5,
-    0x07, 0xB6, 0x78, 0xCE, 0x51, 0xD5, 0xDB, 0x3D, 0xBD, 0x45, 0x7C, 0x08, 0x86, 0x17, 0x8B, 0x4F,
-    0xFE, 0x4F, 0xFC, 0xDF, 0xD6, 0x77, 0x49, 0xB7, 0x84, 0x8D, 0x63, 0x5A, 0x2C, 0xC1, 0x22, 0x83,
-    0xCD, 0x2A, 0xD4, 0x74, 0x20, 0xD0, 0x91, 0xDC, 0x18, 0x8F, 0x51, 0x1B, 0x7F, 0x47, 0x19, 0x9B,
-    0x35, 0xC8, 0xE1, 0xF6, 0xF8, 0x11, 0xDE, 0x5B, 0x46, 0xE8, 0xFE, 0x1C, 0xDC, 0x7A, 0x3C, 0xF1,
-    0x7D, 0x9F, 0x55, 0x58, 0xCD, 0x97, 0x23, 0x47, 0xD6, 0x55, 0x53, 0x9B, 0x13, 0xB6, 0xAA, 0x25,
-    0x4A, 0x9C, 0xE4, 0xEF, 0x94, 0xA4, 0x95, 0x83, 0x83, 0xAE, 0xCE, 0x20, 0xFF, 0x8B, 0x65, 0x9E,
-    0x62, 0xA5, 0x9F, 0x04, 0xD5, 0x58, 0xCE, 0x04, 0xEC, 0x1B, 0x73, 0x93, 0x30, 0xD8, 0xD5, 0xF0,
-    0x20, 0xD6, 0xEC, 0x0B, 0x1B, 0xE5, 0xE9, 0x23, 0xB4, 0x9C, 0x19, 0x92, 0x2E, 0xDF, 0x1B, 0x94,
-    0x4B, 0xCC, 0xCB, 0x8A, 0x0E, 0x46, 0xE1, 0x15, 0xF7, 0x75, 0x78, 0x75, 0x0F, 0x9D, 0xB6, 0x87,
-    0xEB, 0xAD, 0x2B, 0x49, 0x34, 0x1D, 0x1C, 0xD1, 0xDC, 0x54, 0xBC, 0x0A, 0x87, 0xB8, 0xD1, 0xF8,
-    0xD1, 0xF1, 0xB5, 0xE8, 0xB7, 0xC6, 0x0E, 0x69, 0x91, 0x7E, 0xB0, 0x74, 0x48, 0xD0, 0x81, 0xA0,
-    0x98, 0x38, 0xD4, 0x6A, 0xF7, 0x5B, 0x7E, 0x7F, 0xE2, 0x0F, 0x7B, 0x03, 0x35, 0x50, 0xBA, 0x15,
-    0x52, 0x89, 0xBE, 0x37, 0xA4, 0x1D, 0xDB, 0xE5, 0xE9, 0xB7, 0x4D, 0x6F, 0x86, 0x51, 0xE2, 0x78,
-    0x0E, 0xEC, 0x1B, 0xFE, 0x34, 0x6C, 0x2E, 0x4A, 0xB7, 0xE3, 0x79, 0x6F, 0x23, 0x00, 0x27, 0xC5,
-    0x2C, 0xF9, 0x71, 0x3D, 0x66, 0x2B, 0xC5, 0x4F, 0x45, 0x6E, 0x63, 0xC1, 0xC3, 0x3E, 0x38, 0xCA,
-    0x08, 0xB7, 0x1C, 0x76, 0xA7, 0xE7, 0xC8, 0x67, 0x88, 0xB0, 0x34, 0xCA, 0x77, 0x30, 0x88, 0xA5,
-    0xB7, 0xC0, 0xF5, 0xEB, 0x97, 0xF5, 0x57, 0x6E, 0x68, 0x4B, 0x47, 0xE8, 0x64, 0x0D, 0x94, 0xA7,
-    0xBC, 0x60, 0xB9, 0xFB, 0xFA, 0x92, 0x3B, 0x03, 0x0E, 0x7A, 0x78, 0xD2, 0xE0, 0xC4, 0x59, 0x15,
-    0x2F, 0x93, 0xB6, 0x0E, 0x93, 0x7B, 0x4F, 0x67, 0xA9, 0xC7, 0x7D, 0x34, 0xBC, 0xE4, 0x24, 0x1A,
-    0x1A, 0x81, 0x4F, 0x3F, 0xF3, 0x81, 0xAF, 0x6F, 0x13, 0xCF, 0x08, 0xBF, 0x55, 0xE8, 0x70, 0xD6,
-    0xC5, 0x55, 0x60, 0xCB, 0x78, 0xD2, 0x84, 0x5C, 0xEA, 0x5C, 0x4A, 0x3D, 0x90, 0x3B, 0x72, 0x87,
-    0x16, 0x07, 0x81, 0x17, 0x08, 0xA2, 0xA0, 0x2E, 0xAD, 0xD0, 0x13, 0x3A, 0x98, 0x8C, 0xA8, 0x73,
-    0x54, 0xF8, 0xCC, 0xDF, 0x2E, 0xD2, 0xBA, 0x6F, 0xEC, 0x18, 0xB5, 0x3B, 0xB2, 0x95, 0x52, 0x2F,
-    0x85, 0xC2, 0x4C, 0x66, 0x1F, 0xCB, 0x92, 0x17, 0xF7, 0xC3, 0xBA, 0x72, 0xE5, 0x71, 0xB8, 0x35,
-    0xC4, 0x56, 0x26, 0x9A, 0x8A, 0xA9, 0xD8, 0x08, 0xE1, 0x0F, 0xF1, 0x03, 0xDC, 0xC8, 0x8E, 0x8E,
-    0xC5, 0x88, 0x7E, 0x0E, 0xCF, 0x10, 0xB9, 0xBF, 0xCC, 0xEC, 0x5F, 0xE7, 0xC7, 0xD6, 0x07, 0x23,
-    0x27, 0xB7, 0xCA, 0xB2, 0x5B, 0xC2, 0x14, 0x1A, 0x6D, 0x2C, 0x37, 0x33, 0xEA, 0x71, 0x38, 0xA6,
-    0xF9, 0x56, 0x0C, 0xF6, 0x7E, 0xB2, 0x2F, 0x06, 0xE1, 0xD5, 0x43, 0xEB, 0x35, 0x82, 0xE0, 0xE3,
-    0xA0, 0xB3, 0x38, 0xE9, 0x73, 0x1E, 0x37, 0x5B, 0x7B, 0x67, 0x27, 0xCE, 0xD3, 0xB0, 0x44, 0x7F,
-    0xBC, 0x68, 0x27, 0x44, 0x00, 0x99, 0xA4, 0x2F, 0x9F, 0xC4, 0x11, 0xB6, 0x97, 0xA3, 0x75, 0x08,
-    0xE3, 0x0C, 0x06, 0x7B, 0x8F, 0xE8, 0xDF, 0x88, 0xFF, 0x48, 0x90, 0xC4, 0x5C, 0xF5, 0x75, 0x43,
-    0x10, 0x96, 0xD0, 0x70, 0xFB, 0x1D, 0xD7, 0xCE, 0x93, 0x06, 0x65, 0x37, 0xAF, 0x8C, 0x3F, 0xA7,
-    0xCD, 0x03, 0xE2, 0x93, 0xDD, 0x1E, 0x47, 0xFA, 0x4D, 0xDC, 0xD0, 0x5D, 0xEB, 0xC5, 0x97, 0x50,
-    0xE1, 0xB5, 0xD0, 0xF3, 0x32, 0xA5, 0xF9, 0x73, 0x70, 0x1E, 0xDE, 0x8D, 0xBF, 0xD0, 0x33, 0x13,
-    0x77, 0x69, 0x23, 0x9F, 0x8C, 0x66, 0xCD, 0xB3, 0x0F, 0x6D, 0x90, 0x24, 0x63, 0xF1, 0xF0, 0xCD,
-    0x05, 0x6C, 0xEA, 0xB6, 0xD4, 0x6E, 0xE2, 0x5A, 0x4F, 0xEF, 0x0D, 0xBD, 0x09, 0xAD, 0x5F, 0x25,
-    0xAA, 0xF5, 0xA6, 0xDB, 0x77, 0x89, 0x34, 0x02, 0x25, 0x57, 0xAD, 0x54, 0x1A, 0x4D, 0xF6, 0xD3,
-    0xA4, 0xC3, 0x0E, 0x35, 0x44, 0x69, 0xD4, 0x18, 0x7D, 0x2F, 0x43, 0x16, 0xB0, 0xC3, 0x40, 0xAF,
-    0xA4, 0x0B, 0xD5, 0x4A, 0xB3, 0xD9, 0xB8, 0x45, 0xCE, 0x6C, 0xA5, 0x52, 0x6A, 0x94, 0xFC, 0x4A,
-    0xA3, 0x51, 0xE6, 0x4D, 0x21, 0x5D, 0x2A, 0x95, 0x2A, 0xFA, 0xAE, 0xF1, 0x5C, 0xD2, 0x6F, 0xE4,
-    0x27, 0x08, 0x39, 0x05, 0x6A, 0x32, 0xF9, 0xBC, 0x64, 0x8D, 0xB7, 0xFE, 0xAB, 0xBD, 0xAC, 0x27,
-    0x7C, 0x37, 0xFB, 0xCE, 0xA5, 0x5C, 0xC3, 0x27, 0xAD, 0x90, 0xEF, 0x6E, 0x7E, 0x78, 0xAF, 0x44,
-    0xBE, 0x25, 0xAD, 0x41, 0xE6, 0xE4, 0xCB, 0xD3, 0xDD, 0xF1, 0xAB, 0x4C, 0x7A, 0x83, 0x50, 0xE8,
-    0x11, 0x4B, 0xBB, 0xB8, 0xC5, 0x51, 0xA0, 0x4F, 0x23, 0x7E, 0x41, 0x98, 0x7F, 0x54, 0xAB, 0xA5,
-    0xF5, 0xF5, 0x42, 0x76, 0x2B, 0x2B, 0x6D, 0x9E, 0xD3, 0xE9, 0xDC, 0xB6, 0xD5, 0x35, 0x65, 0x46,
-    0xAD, 0x06, 0x7E, 0xFF, 0x2F, 0xDD, 0x7D, 0x5B, 0x8C, 0x1C, 0xD7, 0x99, 0xDE, 0xA9, 0x2A, 0x72,
-    0x4A, 0x66, 0x45, 0x2C, 0x2E, 0x2C, 0x9B, 0xB4, 0x46, 0x64, 0xE9, 0x41, 0x8B, 0x38, 0x0C, 0xA9,
-    0xF2, 0x03, 0x03, 0x70, 0xB3, 0x33, 0x53, 0x25, 0x0B, 0x58, 0x3D, 0x18, 0x89, 0xF9, 0x20, 0x5A,
-    0x0F, 0x42, 0x56, 0x7A, 0xD8, 0x05, 0x12, 0x7B, 0x37, 0x43, 0x20, 0x4C, 0x42, 0x04, 0x9C, 0xEE,
-    0x92, 0x05, 0x44, 0x40, 0xF4, 0xE0, 0x31, 0xB0, 0xB6, 0x80, 0x18, 0x81, 0xF8, 0xA0, 0x07, 0x69,
-    0xE8, 0x78, 0x88, 0x2C, 0x17, 0xE0, 0x43, 0xF7, 0x74, 0x49, 0x04, 0xE2, 0x07, 0x01, 0x51, 0xF9,
-    0x22, 0xE7, 0x21, 0xC0, 0xAA, 0xE3, 0x95, 0x6C, 0x2C, 0x09, 0x5B, 0x25, 0xBB, 0xB5, 0xAE, 0x19,
-    0x75, 0x77, 0xE5, 0xFF, 0xBE, 0xFF, 0x54, 0x77, 0xCF, 0x70, 0x44, 0xDD, 0x28, 0x4A, 0xCE, 0x90,
-    0x7D, 0x6A, 0x6E, 0x5D, 0x75, 0xCE, 0x7F, 0xFE, 0xCB, 0xF7, 0xDF, 0xCE, 0x18, 0xB3, 0xD7, 0xC8,
-    0x47, 0x98, 0xCB, 0xE0, 0x17, 0x32, 0x38, 0x25, 0xBE, 0x3E, 0x8B, 0xE1, 0x80, 0xD1, 0x8F, 0xA4,
-    0xAE, 0x47, 0x66, 0x1E, 0x83, 0x57, 0x9A, 0x05, 0x0C, 0xC7, 0x8C, 0xDF, 0x97, 0xCF, 0x82, 0x42,
-    0x7E, 0x27, 0xC8, 0x9B, 0xF7, 0x73, 0x88, 0xAE, 0xBD, 0x60, 0x4C, 0x2C, 0xBF, 0x6B, 0x12, 0xBE,
-    0x17, 0xC3, 0x12, 0x86, 0x16, 0x86, 0x2E, 0x86, 0xA1, 0x71, 0x72, 0x19, 0xBC, 0xDC, 0xA9, 0x4C,
-    0x90, 0xF9, 0xE3, 0xB5, 0x5E, 0xDA, 0xAE, 0xEB, 0x5A, 0x7E, 0x72, 0x87, 0x59, 0x95, 0xB7, 0xC8,
-    0x03, 0x74, 0xF8, 0x82, 0xB3, 0x6A, 0xA6, 0x1F, 0xB7, 0x6B, 0x1A, 0x91, 0x0C, 0xA5, 0x3C, 0xAC,
-    0xEE, 0x2F, 0xB8, 0x03, 0xB7, 0x7F, 0xC2, 0x2D, 0x9D, 0xE2, 0x8C, 0x57, 0x3A, 0xF9, 0xE3, 0x32,
-    0x64, 0x78, 0xA4, 0xC1, 0x23, 0xE5, 0x41, 0x2F, 0x3E, 0x2C, 0x43, 0x5D, 0x17, 0x26, 0xDC, 0x5A,
-    0x1E, 0x98, 0x28, 0x73, 0x87, 0x26, 0x4E, 0xCD, 0x18, 0x4F, 0xDB, 0xC0, 0xD0, 0xC2, 0xD3, 0x36,
-    0xF0, 0xB4, 0x91, 0xE9, 0xE0, 0x81, 0xF2, 0xB4, 0xD2, 0x1F, 0xA7, 0xCB, 0x45, 0xBB, 0xEE, 0x8F,
-    0x30, 0x07, 0x27, 0x6D, 0x26, 0xCC, 0x19, 0x76, 0xF0, 0xAD, 0xBE, 0xD9, 0xBE, 0xE8, 0x21, 0x16,
-    0x8D, 0x77, 0x9A, 0xF3, 0x18, 0x4E, 0x62, 0x06, 0x27, 0x30, 0x83, 0x7B, 0x6F, 0x58, 0x74, 0x26,
-    0x43, 0x9C, 0x9A, 0x9B, 0x2E, 0xDA, 0x0E, 0xB2, 0x68, 0xD9, 0x71, 0x4C, 0x42, 0xE6, 0x32, 0x79,
-    0xDC, 0xF2, 0x58, 0xBE, 0xB9, 0xB9, 0x5C, 0xC8, 0xAD, 0x82, 0x52, 0xDE, 0x26, 0x2B, 0x96, 0x27,
-    0x17, 0xD8, 0x0C, 0x13, 0xE0, 0xD7, 0x42, 0x2C, 0x3C, 0xC2, 0xC3, 0xE2, 0x57, 0x4F, 0x73, 0x7A,
-    0xA9, 0x49, 0xB6, 0x3F, 0x71, 0x66, 0x48, 0xF5, 0x97, 0x0F, 0x99, 0xB0, 0x34, 0x97, 0x8D, 0x57,
-    0xAF, 0xCB, 0x2D, 0x7A, 0xF2, 0x0E, 0x5D, 0x37, 0x3E, 0x5C, 0x79, 0x78, 0xF4, 0xB3, 0xA1, 0x4C,
-    0x73, 0x43, 0x56, 0xBF, 0x24, 0x53, 0x5B, 0xE0, 0xF4, 0xF0, 0x1A, 0x63, 0x72, 0xB2, 0xA4, 0x58,
-    0x9E, 0x1E, 0xC8, 0x4C, 0x1D, 0xBC, 0x33, 0x91, 0x67, 0x87, 0x72, 0x1B, 0xBF, 0x3C, 0x24, 0xB3,
-    0x03, 0x45, 0x56, 0x84, 0x20, 0x89, 0x10, 0x20, 0xFE, 0x51, 0xDB, 0xF8, 0xB5, 0x2C, 0x6B, 0x2F,
-    0xE9, 0x96, 0x9B, 0xF9, 0x71, 0x6A, 0xBC, 0x81, 0x01, 0xD1, 0xB8, 0x6B, 0xD8, 0x34, 0x50, 0x2C,
-    0xB4, 0x2F, 0x90, 0x0B, 0xD4, 0x4A, 0xEC, 0x7C, 0x97, 0x2C, 0xA5, 0xBA, 0xF6, 0xF9, 0x43, 0xA5,
-    0x12, 0x88, 0xD4, 0x96, 0xDB, 0x99, 0x39, 0xE1, 0xCE, 0xF0, 0x9B, 0xA5, 0x09, 0x9F, 0x2C, 0xCD,
-    0xBE, 0x19, 0xD6, 0xFC, 0x38, 0x9E, 0x65, 0x28, 0x0F, 0xCB, 0x9B, 0x0D, 0xC9, 0x77, 0xEC, 0x6F,
-    0xBC, 0x9D, 0xD0, 0xBB, 0xEC, 0xAF, 0xA9, 0x9A, 0x4D, 0x76, 0x65, 0x5A, 0x9C, 0x97, 0x0E, 0x53,
-    0xFE, 0xDD, 0xC9, 0x3D, 0x93, 0x6D, 0xC4, 0x9D, 0x3E, 0x8F, 0xB7, 0xB6, 0x75, 0x91, 0xB5, 0x4A,
-    0xA7, 0x59, 0xAE, 0xEB, 0x4D, 0x6A, 0x0B, 0x9D, 0x13, 0xAE, 0x78, 0xA3, 0x39, 0xA2, 0x33, 0x33,
-    0xC7, 0x75, 0x72, 0xB2, 0x85, 0x9C, 0x9F, 0x5C, 0x79, 0x3B, 0x73, 0xCE, 0x24, 0x6B, 0xF8, 0xC1,
-    0x65, 0x59, 0x1B, 0x6E, 0x5B, 0x9A, 0xAE, 0x83, 0xCD, 0xED, 0xCB, 0x4C, 0xE5, 0x37, 0xDC, 0xC2,
-    0x50, 0x70, 0x3C, 0x88, 0x63, 0x2C, 0x12, 0x96, 0xC9, 0xBC, 0xE5, 0x1A, 0xA6, 0x32, 0x75, 0xE1,
-    0xA1, 0x08, 0x13, 0x97, 0xDF, 0x5B, 0xC1, 0x75, 0x6C, 0xFE, 0xE9, 0x50, 0xD6, 0xE0, 0xC9, 0x3B,
-    0x4B, 0x13, 0x6D, 0xF5, 0xFA, 0xC2, 0x11, 0x4E, 0x5D, 0xCB, 0xED, 0xF6, 0xCC, 0xEC, 0x07, 0x69,
-    0x28, 0x7B, 0xF2, 0xD8, 0x48, 0x9E, 0x2B, 0xFB, 0xE2, 0xDB, 0xE5, 0x73, 0xF1, 0x32, 0xE8, 0xFA,
-    0x0B, 0x9D, 0xBF, 0xD0, 0xA1, 0xA1, 0x42, 0x98, 0xE9, 0x95, 0xEB, 0x81, 0x22, 0x80, 0x6C, 0xC4,
-    0x6B, 0x6B, 0xBD, 0x8B, 0x63, 0xD2, 0x26, 0xC1, 0x7C, 0x28, 0xD9, 0xC2, 0xD6, 0x4B, 0xA0, 0x94,
-    0xFC, 0x72, 0x0B, 0x82, 0x2B, 0xD7, 0x2E, 0x28, 0x1F, 0x62, 0x11, 0xBA, 0x8E, 0x21, 0xE8, 0x9F,
-    0x60, 0x70, 0x07, 0xCE, 0x08, 0x7B, 0x3B, 0xBF, 0xB5, 0x3E, 0xC0, 0xFE, 0xCA, 0x7C, 0x53, 0xD5,
-    0x33, 0x86, 0x8A, 0xC6, 0x50, 0xD3, 0x18, 0xAA, 0x1A, 0x43, 0x5D, 0x63, 0x54, 0xD9, 0xE8, 0x84,
-    0x75, 0xBA, 0xAA, 0x6F, 0x54, 0xE1, 0x88, 0xC6, 0x59, 0x2F, 0xC1, 0x10, 0x6E, 0x45, 0x8E, 0x18,
-    0x72, 0x76, 0x93, 0xB1, 0xC5, 0x9D, 0xEF, 0x72, 0xEB, 0x3B, 0xDC, 0x76, 0xEA, 0x0F, 0x51, 0x3D,
-    0xDE, 0x26, 0xE4, 0xDD, 0xAF, 0xB9, 0x4F, 0x0F, 0x9B, 0x86, 0x3D, 0x54, 0xF7, 0x0B, 0xC5, 0x75,
-    0xDB, 0x66, 0xB5, 0x3F, 0xE9, 0xD9, 0x1B, 0x80, 0x9A, 0xED, 0x3E, 0x68, 0xB9, 0x44, 0x4A, 0x5E,
-    0xC1, 0xDC, 0x5C, 0x72, 0x7A, 0x90, 0x81, 0x86, 0xF7, 0x93, 0x72, 0xE7, 0x38, 0x4F, 0x4C, 0x3A,
-    0xBA, 0x4E, 0x2D, 0x41, 0xE5, 0x92, 0x90, 0xFE, 0x89, 0x87, 0xCD, 0x5F, 0x72, 0x86, 0xE4, 0xD8,
-    0x0D, 0x32, 0x1A, 0x54, 0x84, 0x10, 0x2B, 0x27, 0xE9, 0x0A, 0x4C, 0x5B, 0xF4, 0x8E, 0x50, 0xCA,
-    0x1B, 0x51, 0x0E, 0x7A, 0x93, 0x69, 0x5A, 0xAE, 0xB6, 0x0A, 0x0D, 0xBC, 0xC7, 0x0F, 0x3F, 0x33,
-    0x3B, 0x3F, 0x64, 0xBA, 0x91, 0x10, 0x56, 0xE6, 0x7B, 0xB0, 0x3E, 0x45, 0xA1, 0x1C, 0x72, 0xC6,
-    0x94, 0x2F, 0xAE, 0x80, 0x3B, 0x5F, 0x72, 0xE3, 0xDB, 0x25, 0x66, 0xED, 0xFC, 0xB2, 0x8F, 0x4B,
-    0xF0, 0x54, 0x1F, 0x34, 0xBD, 0x1F, 0xE4, 0x8E, 0xD3, 0xCB, 0x60, 0x8A, 0xC4, 0x2B, 0x78, 0x09,
-    0xC9, 0x12, 0x4B, 0x0B, 0x94, 0x12, 0x79, 0x13, 0x18, 0xBD, 0x97, 0x91, 0xBF, 0x95, 0x33, 0x94,
-    0xEC, 0x96, 0xEE, 0x58, 0xC1, 0x9C, 0xD0, 0x58, 0x96, 0x40, 0x02, 0x38, 0x99, 0x0B, 0x12, 0x07,
-    0x32, 0xBC, 0x7D, 0x5E, 0x95, 0x9E, 0x31, 0x9F, 0xB3, 0xF3, 0x6D, 0xD7, 0x59, 0x32, 0x8A, 0x37,
-    0x4D, 0x34, 0xC0, 0xD2, 0x73, 0x21, 0x55, 0x90, 0xCA, 0x74, 0xF7, 0x63, 0x67, 0x16, 0x70, 0xC3,
-    0xB3, 0xB8, 0x39, 0xF6, 0x50, 0x04, 0xC5, 0x74, 0x3D, 0x99, 0x47, 0x2B, 0xC0, 0x3A, 0xEF, 0x04,
-    0x7D, 0xB1, 0x59, 0x11, 0xA8, 0x1B, 0xF6, 0x1B, 0x41, 0x0E, 0xA8, 0x76, 0xF1, 0x04, 0xD8, 0x93,
-    0x04, 0xFB, 0x9B, 0x60, 0x7B, 0xF7, 0x34, 0xE4, 0x49, 0x84, 0x83, 0x84, 0x3C, 0xD4, 0x59, 0x65,
-    0xA3, 0xB6, 0xAC, 0xE6, 0xC2, 0x45, 0xD6, 0x4F, 0x1D, 0x96, 0x93, 0xF1, 0xC2, 0xBC, 0xD1, 0x62,
-    0x56, 0x91, 0x85, 0xAA, 0xCB, 0x22, 0x55, 0x67, 0x56, 0xAB, 0x59, 0xA5, 0x96, 0xA8, 0x36, 0xB2,
-    0xAA, 0xCD, 0x6A, 0xB7, 0x8E, 0x5E, 0xAC, 0x8E, 0x93, 0x8B, 0x18, 0xDB, 0x35, 0x6A, 0x3A, 0xF9,
-    0xC0, 0x8C, 0x7B, 0xB9, 0x99, 0xE8, 0x32, 0x63, 0x16, 0x8D, 0x99, 0xB2, 0xA1, 0xD8, 0x3B, 0x7E,
-    0xDC, 0x6B, 0xA9, 0x15, 0x99, 0x89, 0x65, 0xA1, 0x71, 0x30, 0xE6, 0x4D, 0x8C, 0xEE, 0x2B, 0xB8,
-    0x85, 0xF7, 0x2D, 0xCA, 0x31, 0x15, 0xDB, 0x11, 0x0A, 0xCD, 0x02, 0x19, 0xFB, 0x32, 0xC5, 0xA8,
-    0xC4, 0xDA, 0xDC, 0x9C, 0x0B, 0x7D, 0xF5, 0x91, 0x92, 0xA2, 0x34, 0x80, 0xF6, 0x82, 0x08, 0x90,
-    0xD2, 0xA2, 0xA1, 0x30, 0xAA, 0xBC, 0x14, 0x18, 0xE7, 0x45, 0x77, 0x8C, 0x4D, 0x6F, 0x4C, 0x25,
-    0x2F, 0xB2, 0x5A, 0xC1, 0x18, 0x57, 0xA0, 0xD2, 0x65, 0x0C, 0x67, 0x41, 0xA8, 0x4B, 0xBB, 0x23,
-    0x10, 0xDC, 0x3B, 0xFE, 0x6E, 0x8D, 0x65, 0x09, 0x7F, 0x27, 0x60, 0xEF, 0x04, 0xBF, 0xD9, 0xC2,
-    0xD0, 0xC5, 0x97, 0x56, 0x5B, 0xC4, 0xD0, 0x77, 0xB5, 0x3C, 0x67, 0xBD, 0x02, 0x49, 0x32, 0xEC,
-    0x91, 0xE8, 0xD9, 0x79, 0x08, 0xBA, 0xE0, 0x05, 0x6C, 0x8D, 0x88, 0xB9, 0xDF, 0x17, 0xC1, 0x09,
-    0x0A, 0x48, 0x48, 0x2E, 0x13, 0x0E, 0xB1, 0x8E, 0x30, 0x17, 0x35, 0x14, 0x5D, 0x1F, 0x4F, 0xA0,
-    0x0E, 0x1F, 0x14, 0xE0, 0x41, 0x3E, 0xCC, 0xB7, 0x0C, 0x5D, 0xCC, 0x70, 0x08, 0xE3, 0x8D, 0xA7,
-    0xC9, 0xBB, 0xDB, 0xA9, 0x3F, 0xBE, 0x08, 0xE9, 0xAA, 0x57, 0x6F, 0x27, 0xBC, 0x88, 0xA9, 0xED,
-    0xF0, 0x2C, 0x3C, 0x97, 0x2A, 0xDF, 0x28, 0xF6, 0xC2, 0x85, 0x4A, 0xC8, 0xCF, 0x78, 0x21, 0xF7,
-    0x43, 0xC0, 0x79, 0xD9, 0xAF, 0x2A, 0xF0, 0xB8, 0xEA, 0xC0, 0x05, 0x9D, 0xC9, 0x39, 0xBD, 0x5C,
-    0xD2, 0x4B, 0xC9, 0x99, 0xC9, 0x2D, 0x31, 0x37, 0x2F, 0xE7, 0xC4, 0x02, 0xAA, 0x69, 0x70, 0x4B,
-    0x4B, 0x59, 0x69, 0xC5, 0x98, 0x7D, 0xC2, 0x75, 0xE3, 0x0B, 0xD8, 0x75, 0x4C, 0x25, 0x82, 0x85,
-    0x2E, 0x69, 0xA9, 0xBC, 0x3E, 0x99, 0x4D, 0xEE, 0x00, 0x66, 0x73, 0x73, 0xC2, 0x5F, 0xB9, 0xDC,
-    0x6B, 0x11, 0xDA, 0x6D, 0x03, 0xC0, 0x41, 0xFD, 0x44, 0x5D, 0x7B, 0xC2, 0x69, 0xC2, 0x73, 0xCB,
-    0x9B, 0xC4, 0x3B, 0xB4, 0x2C, 0x15, 0x29, 0x10, 0x66, 0x1E, 0xA1, 0x80, 0x48, 0x1E, 0x45, 0x3C,
-    0x48, 0xE3, 0xF4, 0xB8, 0x21, 0xFD, 0x12, 0xE8, 0x63, 0xAC, 0x20, 0x71, 0x15, 0xCC, 0x95, 0xAD,
-    0x80, 0xC2, 0xE1, 0x6C, 0xD5, 0xEB, 0xAA, 0x28, 0xEB, 0x5A, 0x95, 0x7E, 0x58, 0x0C, 0x89, 0xDF,
-    0x4C, 0x92, 0x0D, 0xD5, 0x8C, 0xD7, 0x4E, 0x45, 0x6C, 0xE7, 0x0E, 0xDD, 0x81, 0x22, 0xBD, 0x92,
-    0x1C, 0x27, 0x6B, 0x29, 0x08, 0x00, 0x65, 0x13, 0x53, 0xA1, 0x11, 0x20, 0xD8, 0x18, 0x9C, 0xD4,
-    0x96, 0x5F, 0xA9, 0x8C, 0x40, 0x5E, 0x51, 0x2B, 0xC9, 0xAA, 0x2B, 0x33, 0x0F, 0x4A, 0x2B, 0x9E,
-    0x01, 0x8C, 0x53, 0xFB, 0x19, 0x59, 0xE1, 0x50, 0x14, 0xA3, 0x5B, 0xCA, 0xEF, 0x3A, 0x34, 0xDE,
-    0x07, 0x66, 0x90, 0xCA, 0xD0, 0x9A, 0x9D, 0xB9, 0x1E, 0x2C, 0xC7, 0x38, 0x6D, 0xC0, 0x25, 0xB7,
-    0xDF, 0xB1, 0x3C, 0xB4, 0xC7, 0x10, 0x0C, 0xCA, 0x97, 0xE7, 0xA1, 0xA2, 0xDA, 0x78, 0x46, 0xF2,
-    0xD3, 0xB6, 0xD0, 0x06, 0xB4, 0x55, 0xB7, 0xE5, 0x53, 0xA8, 0xEA, 0x8D, 0x79, 0xDC, 0x64, 0xF4,
-    0xA3, 0x5C, 0x50, 0xD9, 0x1D, 0x3D, 0xA6, 0x10, 0xAA, 0xE2, 0x65, 0x6F, 0xFA, 0xA9, 0xB6, 0x53,
-    0x9F, 0xB0, 0xA5, 0x87, 0x60, 0x66, 0x84, 0x99, 0x80, 0x6D, 0xA1, 0xA2, 0xB6, 0x50, 0x25, 0xFF,
-    0x88, 0x4A, 0xD7, 0x71, 0xBD, 0x2C, 0x34, 0x17, 0xEA, 0xA4, 0x73, 0xAA, 0x95, 0x2E, 0x2B, 0x8B,
-    0x95, 0x7A, 0xE9, 0x53, 0xEA, 0x44, 0xA6, 0x57, 0x28, 0x21, 0x94, 0x3C, 0x3F, 0x23, 0xEF, 0x85,
-    0x04, 0x4C, 0xA2, 0x1C, 0xA8, 0x7D, 0x56, 0xC8, 0x77, 0x82, 0x2A, 0x41, 0x71, 0x01, 0x95, 0xF3,
-    0x9B, 0xF4, 0x32, 0x30, 0x95, 0x06, 0x52, 0x26, 0x23, 0x18, 0x6D, 0xEC, 0x95, 0xDC, 0x4A, 0xF4,
-    0x97, 0x57, 0xAB, 0x47, 0xE2, 0xC9, 0xAC, 0x8F, 0xC0, 0x9E, 0x89, 0x8C, 0x2D, 0xCA, 0xBD, 0x82,
-    0xE5, 0xD4, 0xFC, 0x7B, 0xEC, 0x9B, 0x4C, 0xEB, 0x37, 0x72, 0x0D, 0x05, 0xA0, 0x5D, 0x95, 0x45,
-    0xEC, 0x17, 0x6D, 0x2D, 0x4E, 0x83, 0x39, 0x2C, 0x7B, 0x07, 0x75, 0x76, 0x2C, 0xCC, 0x0F, 0x63,
-    0x55, 0x0B, 0x41, 0xB1, 0x80, 0x85, 0xC8, 0xF5, 0x2C, 0xAE, 0x27, 0xFD, 0x7E, 0x89, 0xEB, 0x59,
-    0xEF, 0xE7, 0x39, 0x56, 0x76, 0xC9, 0xFB, 0x6D, 0x86, 0xA5, 0x95, 0xF2, 0x40, 0x2C, 0xAA, 0xEF,
-    0x8E, 0x70, 0x75, 0xFA, 0xE2, 0x69, 0x8A, 0x10, 0xFA, 0x03, 0x67, 0x00, 0x25, 0xD1, 0x1E, 0x39,
-    0xFD, 0x10, 0xDA, 0x35, 0xD1, 0x7D, 0x6C, 0x6C, 0xFB, 0xC0, 0x40, 0x8A, 0x65, 0x0B, 0xB1, 0xC0,
-    0xA9, 0x6D, 0xF7, 0x94, 0xA5, 0x7C, 0xF2, 0x52, 0x63, 0xE2, 0xA1, 0xC5, 0xA2, 0x6B, 0x6B, 0xEB,
-    0xB9, 0xAA, 0xEA, 0x9C, 0xCC, 0x82, 0x39, 0x58, 0x13, 0x3F, 0xB5, 0xED, 0x89, 0xAA, 0xB1, 0x29,
-    0x2F, 0xE1, 0xD2, 0x9D, 0xDA, 0xF6, 0x11, 0x70, 0x26, 0xF6, 0x14, 0x30, 0xA3, 0xC1, 0x38, 0x23,
-    0xFA, 0x95, 0xB9, 0xD8, 0x3A, 0x79, 0xFA, 0x86, 0xFC, 0x2E, 0x78, 0x63, 0x88, 0x99, 0x74, 0x21,
-    0xFA, 0x1B, 0xD0, 0x44, 0x1B, 0xD0, 0x4B, 0x1B, 0x02, 0x9C, 0xCD, 0x06, 0x98, 0x65, 0x44, 0x8E,
-    0xC1, 0x72, 0x31, 0xB8, 0x55, 0x82, 0xA5, 0x24, 0x50, 0x15, 0x32, 0x9F, 0x10, 0xF4, 0xA1, 0xA9,
-    0x1B, 0x19, 0x77, 0x73, 0xBE, 0x84, 0x9D, 0x69, 0xFC, 0x4A, 0x40, 0x6A, 0x20, 0x9C, 0x9A, 0x30,
-    0xDB, 0x2E, 0xFF, 0x43, 0x21, 0x9C, 0xEC, 0x3D, 0x11, 0xCE, 0xCA, 0xBB, 0x21, 0x9C, 0x51, 0xE3,
-    0xCB, 0xD1, 0x15, 0x69, 0x0C, 0x7A, 0x2E, 0x4F, 0x0F, 0xB6, 0x1B, 0x74, 0x18, 0xE7, 0xBC, 0x31,
-    0xCE, 0xC2, 0x27, 0x08, 0x24, 0xF8, 0x10, 0x5C, 0xD8, 0x72, 0x98, 0xF6, 0xA4, 0xBE, 0xF0, 0xEE,
-    0x6E, 0xDE, 0x47, 0x77, 0xE3, 0xB3, 0x06, 0x4E, 0xED, 0xEA, 0xC1, 0xBF, 0xB7, 0x1B, 0x3F, 0x13,
-    0x2E, 0x31, 0x95, 0xDB, 0x3F, 0x21, 0x2C, 0x59, 0x9C, 0x11, 0x87, 0xC7, 0x86, 0x4B, 0xDE, 0xC3,
-    0xE7, 0xBC, 0x29, 0xA4, 0xC0, 0xB2, 0xE6, 0xE8, 0xF4, 0xD7, 0xE5, 0x6D, 0xC7, 0xC9, 0xC6, 0x39,
-    0x7D, 0x8A, 0x76, 0x93, 0x64, 0x85, 0x0E, 0x33, 0x9F, 0x83, 0xA9, 0xF2, 0x81, 0x03, 0x4C, 0xFB,
-    0xDB, 0xD5, 0x72, 0xEE, 0x0E, 0x9D, 0x81, 0x2F, 0x00, 0x4D, 0x9C, 0xB7, 0x2A, 0xA4, 0xA9, 0x8C,
-    0x81, 0xCA, 0x86, 0x09, 0xAC, 0xA5, 0x8C, 0x82, 0x3D, 0x85, 0x75, 0x83, 0x1C, 0x0C, 0x2C, 0x3B,
-    0x5B, 0x25, 0x69, 0x28, 0xD3, 0x8E, 0xB2, 0x28, 0x0B, 0xFB, 0x61, 0x11, 0xA5, 0x49, 0xE6, 0x6D,
-    0xC6, 0x7F, 0xA2, 0x40, 0x18, 0x0F, 0x6E, 0x9F, 0x9A, 0x2C, 0x9D, 0x76, 0xD4, 0xEC, 0x3D, 0x4D,
-    0x67, 0x5F, 0x98, 0x68, 0x08, 0xA1, 0x8E, 0x5F, 0x87, 0x39, 0x84, 0x93, 0x36, 0x22, 0x48, 0xDE,
-    0x90, 0xDD, 0x90, 0x39, 0x33, 0x62, 0x94, 0x3C, 0x44, 0x97, 0xF5, 0x15, 0x9A, 0x78, 0xB2, 0x87,
-    0xDA, 0x64, 0xEA, 0x50, 0x13, 0xD2, 0xC9, 0x5B, 0xE4, 0xF7, 0xCB, 0x11, 0x15, 0xE2, 0x06, 0x29,
-    0x90, 0x50, 0xA7, 0x62, 0x87, 0xAF, 0x60, 0x8B, 0xC5, 0x56, 0x0B, 0x6B, 0x08, 0xE8, 0x15, 0xE3,
-    0xDE, 0x1E, 0x3B, 0x44, 0x31, 0x9F, 0x12, 0x7F, 0x61, 0xBC, 0xAA, 0xFE, 0x82, 0xEA, 0x14, 0x85,
-    0x30, 0xCA, 0x4E, 0x13, 0x2F, 0xD0, 0x57, 0xEB, 0xEA, 0xDB, 0xD0, 0x12, 0x98, 0x34, 0x13, 0xD4,
-    0xB3, 0xBC, 0x89, 0x40, 0x8A, 0xF0, 0x7D, 0xD0, 0xB7, 0x3E, 0xFF, 0xF4, 0x7F, 0x86, 0x09, 0x46,
-    0x9C, 0x5C, 0xCC, 0xFF, 0x3A, 0xC3, 0x84, 0x4F, 0x68, 0xC1, 0xCF, 0xBE, 0x08, 0x3D, 0x5F, 0x8F,
-    0x41, 0xBA, 0xCF, 0xA5, 0xC3, 0xA9, 0x27, 0x4A, 0xC9, 0xB3, 0xDE, 0x33, 0x99, 0xDC, 0x8E, 0xD1,
-    0xA6, 0x86, 0x4C, 0xC8, 0xB6, 0x2F, 0xD6, 0x43, 0x55, 0xC8, 0x0F, 0xF4, 0x5E, 0xB7, 0xE4, 0x4B,
-    0x52, 0xAB, 0x94, 0x93, 0x46, 0x2D, 0x27, 0x0D, 0x11, 0x5B, 0x8D, 0x6A, 0xEE, 0x36, 0xCA, 0xB9,
-    0x43, 0xC7, 0x9C, 0x5E, 0x02, 0x48, 0x1B, 0x65, 0xEA, 0x33, 0xC8, 0x14, 0xA9, 0x2C, 0x8C, 0xDE,
-    0x44, 0xF5, 0x94, 0x57, 0x5A, 0x45, 0xAD, 0xD1, 0x12, 0xDC, 0xAD, 0x6F, 0x95, 0xB5, 0xDF, 0xB7,
-    0xEA, 0x9A, 0x0F, 0xB1, 0x61, 0x0A, 0x55, 0xD9, 0x1A, 0xAF, 0x10, 0x02, 0xAF, 0x5F, 0x5B, 0xA3,
-    0xDA, 0xAE, 0x2D, 0x91, 0x7F, 0xEF, 0x26, 0xBF, 0xDA, 0x4C, 0xBE, 0xD1, 0x83, 0x61, 0x63, 0x7E,
-    0xBC, 0xFC, 0xDD, 0x3F, 0x69, 0xE2, 0x07, 0x2E, 0x35, 0x19, 0x7C, 0x3C, 0x59, 0xE9, 0x02, 0x96,
-    0x72, 0x02, 0xCB, 0x38, 0x83, 0x25, 0x3C, 0x1E, 0x14, 0x3B, 0x20, 0xFE, 0xAA, 0x85, 0xF8, 0xB1,
-    0x20, 0x63, 0x99, 0x5D, 0x64, 0xFD, 0xBB, 0x16, 0x86, 0x59, 0xD7, 0x2E, 0x02, 0x76, 0x07, 0xD1,
-    0x04, 0x38, 0x33, 0xF8, 0xD3, 0xC3, 0xED, 0xE9, 0x4C, 0xB6, 0x6D, 0xD4, 0xD0, 0x52, 0x76, 0xDB,
-    0x0B, 0x4F, 0x9E, 0x44, 0x11, 0x77, 0x44, 0x12, 0xF9, 0x92, 0x09, 0x80, 0x6E, 0x91, 0xCC, 0x01,
-    0x62, 0x15, 0xA7, 0xED, 0x4C, 0xE5, 0x2A, 0xCC, 0x35, 0xC2, 0x18, 0x14, 0x2A, 0x60, 0x41, 0xBF,
-    0x45, 0x6A, 0x06, 0x45, 0x97, 0xC4, 0x0C, 0x8B, 0x8E, 0x25, 0xA1, 0x46, 0x1D, 0xC5, 0x09, 0x20,
-    0x25, 0x6B, 0xEC, 0x2B, 0x3C, 0xD0, 0x79, 0x55, 0x47, 0x59, 0x4F, 0xCD, 0x96, 0x86, 0xD1, 0xDE,
-    0x33, 0x7E, 0x08, 0x82, 0x44, 0x24, 0x88, 0xCC, 0x84, 0xD3, 0x50, 0xE3, 0x8C, 0x09, 0xDC, 0xE8,
-    0xF0, 0x26, 0x37, 0x38, 0xBC, 0x33, 0xBE, 0xC3, 0x77, 0xE9, 0x3B, 0xB4, 0xE1, 0x3B, 0x08, 0xA3,
-    0x94, 0x20, 0xE1, 0x01, 0xFB, 0x94, 0x62, 0x66, 0xD8, 0xB7, 0xB6, 0x5E, 0xC0, 0x95, 0xDB, 0x6E,
-    0x4A, 0xAC, 0x21, 0xDB, 0x03, 0xDD, 0xB8, 0x80, 0xF5, 0xD1, 0x77, 0xE0, 0xB6, 0x24, 0x3F, 0xEA,
-    0xA5, 0xF2, 0x08, 0xC8, 0xEB, 0x5D, 0x3B, 0xC2, 0x45, 0x8C, 0xC7, 0x40, 0xBF, 0xFE, 0x62, 0xC4,
-    0x68, 0xE1, 0x08, 0xF7, 0xF1, 0x4A, 0x0F, 0x5E, 0xB6, 0xAC, 0x57, 0xD5, 0x46, 0x50, 0x44, 0xC4,
-    0x4C, 0x41, 0x2E, 0x3F, 0xF4, 0xE1, 0x7B, 0xB7, 0x8D, 0x5E, 0x37, 0x78, 0x8D, 0xAE, 0x8D, 0xD4,
-    0xA1, 0x14, 0x67, 0x1A, 0xAB, 0x4E, 0x80, 0x70, 0xF0, 0x5C, 0x5E, 0x73, 0x45, 0xC3, 0x62, 0xD3,
-    0x5B, 0xB8, 0xCA, 0x2D, 0xBA, 0x60, 0xDD, 0xB6, 0x66, 0x05, 0xF4, 0x3F, 0xE3, 0x75, 0x0C, 0x19,
-    0xCA, 0xDB, 0xC5, 0xA6, 0x87, 0xAF, 0xB6, 0x89, 0xA3, 0x5C, 0xEB, 0x3C, 0xA8, 0xCF, 0x23, 0x5E,
-    0x13, 0x16, 0x41, 0xFF, 0x5D, 0xE0, 0xE0, 0x88, 0x0F, 0xD7, 0x47, 0x55, 0x46, 0x51, 0x84, 0x8C,
-    0x90, 0x4E, 0x86, 0x08, 0xEC, 0x28, 0x66, 0x4A, 0xD6, 0xE8, 0x8E, 0x1F, 0x2D, 0xA8, 0x9C, 0x72,
-    0xA0, 0x2A, 0x90, 0xCD, 0x1B, 0x90, 0x9F, 0xFA, 0x8C, 0x4F, 0xE7, 0xE0, 0xA1, 0x36, 0xA5, 0x8D,
-    0x38, 0x53, 0x50, 0x7C, 0x1B, 0x56, 0x13, 0x18, 0xB3, 0x97, 0xC1, 0x59, 0x91, 0x3B, 0xDC, 0x21,
-    0xBF, 0xF8, 0x3D, 0x2A, 0x69, 0xC4, 0x35, 0x0D, 0x71, 0x0C, 0x08, 0x25, 0xFB, 0x15, 0x66, 0x14,
-    0x63, 0x4A, 0xAE, 0xCF, 0x68, 0x47, 0xDE, 0xF0, 0x02, 0x03, 0x13, 0xCB, 0xC2, 0x1A, 0x0F, 0xBC,
-    0x92, 0x9B, 0xE8, 0xCD, 0xAF, 0x5E, 0x37, 0xC1, 0xD0, 0x97, 0xBB, 0xA4, 0x86, 0x3A, 0xDB, 0x69,
-    0x42, 0x3B, 0xEB, 0x35, 0xC2, 0x32, 0xA0, 0x8C, 0xC8, 0xB3, 0x43, 0x4B, 0x55, 0x34, 0xA6, 0x7A,
-    0x7F, 0x24, 0xB0, 0xE6, 0x70, 0xF7, 0xB1, 0xC2, 0xDC, 0xDF, 0x87, 0x9A, 0xC8, 0x19, 0x1E, 0x46,
-    0x48, 0x03, 0x54, 0xEB, 0x61, 0xD8, 0xC0, 0x94, 0xBA, 0x60, 0x54, 0x3B, 0xF8, 0xC0, 0xFF, 0x3A,
-    0x03, 0x79, 0xC0, 0xB7, 0xA9, 0xCB, 0xFB, 0x0D, 0x0B, 0x00, 0xC2, 0x6F, 0xB4, 0x73, 0x4F, 0x8C,
-    0x71, 0x90, 0xCB, 0xFE, 0xA6, 0x90, 0x9E, 0x28, 0x6B, 0xC9, 0x73, 0x7B, 0xC2, 0x8B, 0xE3, 0x47,
-    0x2A, 0x21, 0xEC, 0x06, 0x83, 0xD4, 0x08, 0x50, 0x77, 0xE4, 0xB5, 0x84, 0x3B, 0x3D, 0x31, 0x54,
-    0x58, 0x80, 0x9B, 0x2C, 0xBF, 0x2E, 0x9E, 0xC1, 0x58, 0xF4, 0x88, 0xCC, 0x84, 0x60, 0xCA, 0xDA,
-    0x37, 0xEE, 0x76, 0x41, 0x00, 0x0E, 0xDA, 0x36, 0xB1, 0xFE, 0xAE, 0xF0, 0x66, 0xCF, 0x1C, 0x33,
-    0xC9, 0xB5, 0x81, 0xF2, 0x3B, 0xEE, 0xB1, 0x57, 0xEC, 0x7E, 0x4F, 0xD6, 0x76, 0x00, 0xEF, 0x87,
-    0x68, 0x35, 0x7A, 0x00, 0xBB, 0x88, 0x58, 0xF8, 0x56, 0xE5, 0x8C, 0x96, 0x2B, 0xBF, 0xF0, 0xAA,
-    0x30, 0x03, 0x10, 0x76, 0xAA, 0x96, 0xFC, 0x4C, 0xF8, 0xA5, 0x44, 0xE0, 0x46, 0x5E, 0x7D, 0x68,
-    0x47, 0x48, 0x57, 0x47, 0xF4, 0x41, 0x4B, 0xC0, 0x41, 0xFC, 0x84, 0xF8, 0x57, 0xD8, 0x66, 0xDC,
-    0x5F, 0x9C, 0x75, 0xB3, 0xD1, 0x13, 0xB0, 0x14, 0xE5, 0x41, 0x2E, 0xC8, 0x39, 0x8D, 0x32, 0x59,
-    0x45, 0x8A, 0xF4, 0x54, 0xF7, 0xA0, 0x48, 0xA2, 0x70, 0xD2, 0xE8, 0xD4, 0x24, 0x0F, 0xC1, 0x39,
-    0x26, 0x32, 0xC7, 0x58, 0xE6, 0xE8, 0x37, 0x73, 0x5C, 0x4E, 0xE7, 0x32, 0xBF, 0x42, 0xE8, 0x52,
-    0x1C, 0xC0, 0xB6, 0xF1, 0x1F, 0x14, 0x47, 0xE5, 0x8A, 0x78, 0x50, 0x4E, 0x15, 0x3E, 0x51, 0x1E,
-    0x41, 0xBE, 0x21, 0x7A, 0xB0, 0x0F, 0xE4, 0x34, 0x8C, 0xB8, 0x63, 0xA6, 0x8A, 0xD5, 0x38, 0xDB,
-    0x10, 0x9F, 0x19, 0xD7, 0xEB, 0xEA, 0x17, 0xAF, 0x30, 0xC8, 0xEE, 0x96, 0x1D, 0x5E, 0x65, 0xEA,
-    0xB8, 0x2E, 0xF8, 0x79, 0x15, 0xE6, 0x07, 0xCC, 0xF9, 0x30, 0x15, 0x8E, 0x3C, 0x63, 0x56, 0xEE,
-    0x77, 0x4A, 0x7F, 0x4B, 0x78, 0x68, 0xE0, 0x92, 0xFD, 0x26, 0x09, 0x23, 0x01, 0x26, 0xDE, 0x66,
-    0x4F, 0x38, 0x4B, 0x76, 0x2B, 0x15, 0x6A, 0x28, 0xBA, 0xA0, 0x1B, 0x67, 0xC4, 0x6B, 0x35, 0xDF,
-    0x18, 0xE8, 0xE7, 0x36, 0xD3, 0x72, 0x4E, 0x5E, 0x1D, 0x59, 0xD1, 0x86, 0x6C, 0x44, 0x8C, 0xB5,
-    0xC8, 0x3A, 0x8F, 0x5E, 0x30, 0xCF, 0x2F, 0x97, 0xA6, 0x02, 0xE3, 0x8A, 0x67, 0x5B, 0xFA, 0x85,
-    0x5B, 0x06, 0x22, 0x25, 0x21, 0x38, 0x21, 0xF3, 0x85, 0x0F, 0x82, 0x3C, 0x46, 0x42, 0xC9, 0x80,
-    0x4E, 0x49, 0xB6, 0x64, 0x5E, 0x4B, 0x13, 0xEF, 0xAB, 0x69, 0xF2, 0xEB, 0xF0, 0xD7, 0x61, 0x15,
-    0xA8, 0x30, 0xEE, 0x33, 0xF7, 0xCA, 0x63, 0x2F, 0x99, 0xF8, 0x19, 0x41, 0x11, 0xB2, 0x77, 0x0E,
-    0xB1, 0xDB, 0x2D, 0xB9, 0xF7, 0xD1, 0x0B, 0xFB, 0xD6, 0x4C, 0x5C, 0xCA, 0x5D, 0x45, 0x07, 0x89,
-    0xBB, 0xD6, 0x17, 0xC4, 0xE7, 0x17, 0xC7, 0xA1, 0x70, 0x05, 0xEF, 0x05, 0x2F, 0xC1, 0xA8, 0x82,
-    0xA6, 0xE1, 0x9B, 0xB0, 0xAA, 0x0F, 0x0A, 0x9F, 0xC4, 0x60, 0x14, 0x30, 0xA9, 0x28, 0xDC, 0x2E,
-    0x06, 0x66, 0x4B, 0x84, 0xFD, 0x3A, 0x26, 0x40, 0x9C, 0x65, 0x6D, 0x6D, 0x55, 0x80, 0x34, 0x58,
-    0xF6, 0x1C, 0xEC, 0xD9, 0x19, 0xEC, 0xCC, 0x25, 0x08, 0xBE, 0xCC, 0xC9, 0x38, 0x32, 0x29, 0xE3,
-    0x42, 0xF6, 0xBD, 0x2C, 0x06, 0x88, 0x4A, 0xE0, 0x74, 0x2F, 0xC1, 0xE5, 0x5E, 0x81, 0x8B, 0xBD,
-    0x62, 0xFE, 0xA0, 0x92, 0x41, 0x3C, 0xE3, 0xF6, 0x65, 0xF1, 0x8B, 0x13, 0xEC, 0xB2, 0x68, 0xA2,
-    0xB9, 0x17, 0x8C, 0xB9, 0x3B, 0x95, 0xDB, 0x52, 0x8B, 0xE1, 0x55, 0xF3, 0xE2, 0xE2, 0xD2, 0x4B,
-    0xFD, 0x0D, 0x86, 0x66, 0x43, 0xB9, 0x85, 0xF3, 0x4A, 0x76, 0x4C, 0xAC, 0x8E, 0xFB, 0x72, 0x7E,
-    0x02, 0x11, 0x8E, 0xA7, 0xF3, 0x12, 0xB6, 0xE6, 0xA1, 0x97, 0x72, 0x68, 0x2A, 0xFF, 0x27, 0x4F,
-    0x20, 0x06, 0xEB, 0xBD, 0x26, 0xFA, 0x43, 0xEC, 0xEE, 0x50, 0x2E, 0x7F, 0x50, 0x79, 0x15, 0xE4,
-    0xBB, 0x74, 0x4B, 0x77, 0x2B, 0x4F, 0x72, 0x47, 0x9C, 0xF1, 0x74, 0x8F, 0xE6, 0x24, 0x40, 0xDF,
-    0x58, 0xE8, 0x2B, 0x60, 0x7B, 0xE0, 0x81, 0xC6, 0x96, 0xBE, 0x01, 0xE8, 0x2B, 0xB8, 0x25, 0xBC,
-    0xB6, 0x0E, 0xCE, 0x20, 0x8D, 0x45, 0xF5, 0x08, 0x7D, 0x23, 0x91, 0xD9, 0x28, 0x13, 0x25, 0xF0,
-    0xEB, 0x0E, 0x05, 0x41, 0x14, 0x4E, 0x20, 0x10, 0x6D, 0x63, 0x59, 0xDE, 0x25, 0xEF, 0x11, 0xBD,
-    0x15, 0xA5, 0xCE, 0x40, 0x65, 0xCA, 0xA9, 0xA0, 0x83, 0x87, 0x7C, 0x41, 0xAE, 0x7C, 0xC8, 0x95,
-    0xC8, 0x54, 0x98, 0xB5, 0x26, 0x72, 0xAF, 0xF2, 0x70, 0xF4, 0x42, 0x9C, 0xC5, 0x6F, 0xD5, 0xA5,
-    0xF7, 0xDB, 0x27, 0x4B, 0xEF, 0x57, 0xB2, 0xCF, 0x95, 0xCC, 0xA3, 0x94, 0x79, 0x14, 0xB8, 0xA7,
-    0x5F, 0xCC, 0xEE, 0xB5, 0xCE, 0x83, 0x73, 0xD9, 0x36, 0x0F, 0x77, 0x6D, 0x0E, 0x02, 0x15, 0x0B,
-    0xF7, 0x2C, 0x9D, 0x15, 0xA2, 0x2F, 0x61, 0x0F, 0xDA, 0x22, 0x9C, 0xA2, 0x73, 0x08, 0x96, 0x38,
-    0xC8, 0xF7, 0x98, 0x45, 0x1A, 0x00, 0x2E, 0x95, 0x9A, 0x04, 0x83, 0xC4, 0xCB, 0x37, 0xBC, 0xBE,
-    0x28, 0x75, 0x7F, 0x20, 0x5A, 0x23, 0x80, 0xED, 0x0D, 0x5F, 0x44, 0xD4, 0x24, 0x6B, 0x52, 0x79,
-    0xD1, 0x34, 0x51, 0xB8, 0xDA, 0xF8, 0x37, 0xAA, 0xF2, 0x7A, 0x19, 0x18, 0x52, 0x54, 0x9E, 0x90,
-    0x8A, 0xDB, 0xBD, 0x33, 0x15, 0xB9, 0x4D, 0x15, 0xB4, 0x77, 0xA8, 0x02, 0x2C, 0x7D, 0xBE, 0x30,
-    0x58, 0x7D, 0x4F, 0xE6, 0xF0, 0xDB, 0x27, 0xDF, 0xFA, 0x91, 0xCC, 0xE7, 0x57, 0xEE, 0xEF, 0xE4,
-    0x1D, 0x42, 0x06, 0xD8, 0x33, 0xA1, 0x44, 0x25, 0xB3, 0x0E, 0xE0, 0x13, 0xC1, 0x36, 0x40, 0x12,
-    0x0C, 0x48, 0x22, 0x73, 0x07, 0x55, 0xC4, 0x42, 0x80, 0x30, 0x34, 0x14, 0xF8, 0xB6, 0x01, 0x79,
-    0x02, 0x64, 0xD4, 0xE4, 0xA7, 0xD0, 0xD8, 0xB1, 0xF1, 0xDF, 0x81, 0xBE, 0x45, 0x74, 0x88, 0x1F,
-    0xC2, 0xA1, 0xCF, 0x8B, 0x15, 0x10, 0x83, 0x27, 0x56, 0xB8, 0xAD, 0x86, 0xC5, 0xCF, 0x85, 0x38,
-    0x3E, 0x92, 0x75, 0x82, 0xFF, 0x65, 0x3D, 0x10, 0x90, 0xFD, 0xC8, 0xB3, 0x1C, 0x86, 0x5A, 0x39,
-    0x09, 0x15, 0x7A, 0x06, 0x8A, 0x06, 0x09, 0x98, 0x7F, 0x60, 0x4E, 0x15, 0x14, 0x61, 0x4A, 0xE9,
-    0xBC, 0xA6, 0x25, 0x19, 0x2D, 0x62, 0xA8, 0x57, 0x73, 0x5F, 0x7F, 0x08, 0xA6, 0x4D, 0xAA, 0x1D,
-    0x8E, 0xA0, 0x95, 0xED, 0x78, 0xA4, 0x6A, 0x8D, 0x4A, 0xEC, 0xF0, 0x14, 0xF5, 0xF7, 0x27, 0xF9,
-    0xB3, 0xE8, 0xCD, 0xFF, 0xD3, 0x17, 0xA3, 0xD5, 0x7E, 0x07, 0xFB, 0x13, 0xE6, 0x48, 0x0E, 0x8A,
-    0x93, 0x07, 0x57, 0x1E, 0x89, 0x43, 0xFE, 0x6B, 0x71, 0xEC, 0x52, 0x44, 0x87, 0xB2, 0xD0, 0xB6,
-    0x8C, 0x1D, 0xDA, 0x18, 0xFD, 0x57, 0x71, 0x1C, 0xC0, 0x8A, 0xB9, 0x03, 0x20, 0xDF, 0x47, 0x2B,
-    0x38, 0x28, 0xEF, 0x60, 0x7F, 0x9D, 0x07, 0xFB, 0xE9, 0x24, 0x55, 0x47, 0xE5, 0x7A, 0x80, 0xC8,
-    0xE7, 0x0A, 0xD3, 0x76, 0x1D, 0xFA, 0xCD, 0xBA, 0xCB, 0x8E, 0xCE, 0xFB, 0xEB, 0x66, 0xDF, 0x05,
-    0x18, 0xEE, 0x55, 0x99, 0xC8, 0x02, 0x2C, 0x0B, 0x3C, 0xB7, 0xB7, 0x80, 0x03, 0x7E, 0x97, 0x21,
-    0x9D, 0xDE, 0xF8, 0xD8, 0x1C, 0x28, 0xB7, 0xFE, 0x32, 0x96, 0x41, 0x85, 0x8C, 0x5B, 0x0F, 0xE8,
-    0xD9, 0x09, 0x0E, 0x4A, 0x72, 0xD9, 0x88, 0x8F, 0xA8, 0xDB, 0x90, 0xF1, 0xBD, 0x53, 0x83, 0xF1,
-    0x62, 0x48, 0xA0, 0x4F, 0x00, 0x9E, 0xE9, 0xC2, 0xAE, 0x9A, 0xA3, 0xCF, 0x89, 0x5C, 0x0F, 0x20,
-    0xD7, 0x8D, 0x6C, 0xE3, 0xFE, 0x2A, 0xD7, 0x81, 0xC8, 0x93, 0xDF, 0x17, 0x77, 0xBB, 0x7E, 0x33,
-    0x37, 0xA7, 0x89, 0x57, 0x32, 0x65, 0x6F, 0x58, 0xD6, 0xF0, 0xD7, 0xC6, 0xCA, 0x93, 0xCC, 0xEF,
-    0x39, 0xF3, 0x4F, 0x0C, 0xA6, 0x68, 0x56, 0x14, 0x96, 0x74, 0x0C, 0x59, 0x4F, 0x18, 0x13, 0xAC,
-    0x87, 0xD4, 0x89, 0xA7, 0x68, 0xC5, 0x6B, 0x38, 0xD2, 0xB5, 0x1C, 0x59, 0x92, 0x23, 0x7D, 0x30,
-    0x66, 0x9C, 0x31, 0x55, 0x93, 0x64, 0xCC, 0xF1, 0xBE, 0x99, 0x42, 0xE9, 0x79, 0xCF, 0x66, 0x2F,
-    0xCB, 0xE5, 0x07, 0xE1, 0xF5, 0xAF, 0xBC, 0x63, 0xC2, 0xCA, 0x1F, 0x29, 0x63, 0xA6, 0xAA, 0xF2,
-    0x6F, 0xC7, 0x63, 0xAF, 0xA7, 0x7C, 0xEC, 0x3B, 0xFA, 0x58, 0xEB, 0xE3, 0x1E, 0x51, 0xDF, 0x45,
-    0xDD, 0x52, 0x75, 0xF2, 0xE5, 0x06, 0x3B, 0xF2, 0x66, 0xFB, 0xD6, 0xD6, 0x52, 0xD1, 0x8D, 0x19,
-    0xF4, 0xF9, 0x31, 0x79, 0xF0, 0x01, 0x90, 0x0F, 0xDC, 0x22, 0x46, 0xDF, 0x15, 0x47, 0xD5, 0x2B,
-    0x80, 0x0B, 0x02, 0xE8, 0xAD, 0xC9, 0x0B, 0x38, 0xC1, 0x1B, 0x88, 0xEE, 0xE9, 0x55, 0x64, 0xA7,
-    0xAF, 0x5F, 0x10, 0x2B, 0x82, 0x35, 0xCE, 0x8D, 0xE9, 0x01, 0x10, 0x59, 0xC1, 0xBC, 0xE4, 0x36,
-    0x45, 0x01, 0x6C, 0xFF, 0x2A, 0x54, 0x95, 0xB8, 0x01, 0xB2, 0xD4, 0x28, 0x6D, 0x03, 0xC0, 0x9B,
-    0xF8, 0x49, 0xF8, 0x73, 0xD1, 0x93, 0xFD, 0xE9, 0xF8, 0x14, 0x12, 0x35, 0x89, 0xBC, 0x3D, 0x2C,
-    0xBA, 0xDE, 0x3B, 0x99, 0x5B, 0xBF, 0xEE, 0x6A, 0xF6, 0x9E, 0xDA, 0x1D, 0xCF, 0x50, 0xFF, 0xA7,
-    0xD0, 0x17, 0x7D, 0x9F, 0x57, 0x4F, 0x89, 0xC9, 0x83, 0xAF, 0xD3, 0x4E, 0xC1, 0x5D, 0xCA, 0x65,
-    0xCA, 0x69, 0x51, 0x1A, 0xA7, 0x61, 0x21, 0xC0, 0x0F, 0xA8, 0x78, 0x8F, 0x22, 0x32, 0x6F, 0x73,
-    0x03, 0x08, 0x21, 0x13, 0x84, 0x90, 0xBB, 0x53, 0x2F, 0xAA, 0x30, 0xA7, 0x1F, 0xCB, 0x15, 0xFD,
-    0x4E, 0x6A, 0x32, 0x44, 0x0B, 0xAC, 0x10, 0xCB, 0x6E, 0x60, 0x13, 0xA0, 0x21, 0x14, 0x21, 0x2C,
-    0xCB, 0x57, 0xA5, 0xB7, 0x85, 0x94, 0x8F, 0x3C, 0x47, 0x30, 0xAD, 0x6A, 0x2A, 0x80, 0xC9, 0x20,
-    0x07, 0xD2, 0x0A, 0x5E, 0x84, 0xFF, 0x19, 0xD6, 0xD8, 0xD6, 0xF0, 0x3A, 0x73, 0x71, 0x0F, 0x22,
-    0x13, 0x15, 0x73, 0x4F, 0x13, 0xFA, 0xB1, 0x4B, 0x42, 0x83, 0x8E, 0x20, 0xFF, 0x4A, 0x28, 0xB2,
-    0x62, 0xBA, 0x01, 0x0C, 0x32, 0xD4, 0xBD, 0xE5, 0x9C, 0xB9, 0xFA, 0xEF, 0x65, 0xBB, 0x7E, 0xD1,
-    0x43, 0x6C, 0x7E, 0x09, 0x14, 0x5C, 0x02, 0xDA, 0x5B, 0xC1, 0x60, 0xCB, 0x85, 0x44, 0x42, 0x10,
-    0x56, 0xC6, 0xD2, 0xC2, 0x9F, 0x21, 0xE1, 0xFF, 0xCD, 0xA6, 0x36, 0x6A, 0x28, 0x7A, 0xC7, 0x85,
-    0xB8, 0xCC, 0xCB, 0x2C, 0x61, 0x24, 0x6B, 0x25, 0x21, 0x9D, 0x04, 0xAC, 0x4E, 0x14, 0xA3, 0x61,
-    0x32, 0xE8, 0xD2, 0x34, 0x99, 0x7F, 0x2B, 0x80, 0xE0, 0x17, 0xDC, 0xCC, 0x2C, 0xC1, 0xB5, 0x93,
-    0x8D, 0x39, 0xE4, 0x4E, 0xF3, 0x19, 0xB7, 0xE2, 0xDE, 0x98, 0x3A, 0xB0, 0xD4, 0x48, 0x6B, 0xA1,
-    0xEE, 0x1E, 0xAF, 0xF1, 0x65, 0x00, 0x83, 0x07, 0x7B, 0x45, 0x95, 0xF7, 0x0A, 0xEF, 0x37, 0xD7,
-    0x4B, 0xEF, 0xBA, 0x57, 0xFA, 0x43, 0x6B, 0x70, 0xFB, 0x50, 0xB5, 0xDB, 0x15, 0xD0, 0xD4, 0xF0,
-    0xC7, 0xB4, 0x25, 0x9D, 0x49, 0xC9, 0xCD, 0x8A, 0x2D, 0xB2, 0xAA, 0xB4, 0xD0, 0x6D, 0xBE, 0x50,
-    0x1D, 0x44, 0x78, 0xC9, 0xD0, 0x84, 0xDA, 0x86, 0xD9, 0x1A, 0xAC, 0x5B, 0x01, 0xF0, 0x6F, 0x62,
-    0x75, 0x37, 0x4E, 0xA7, 0xE4, 0xC8, 0xF7, 0xB2, 0xBA, 0x9C, 0xC7, 0x16, 0xD8, 0x5A, 0x56, 0x98,
-    0x85, 0xF2, 0xFA, 0x0C, 0x67, 0x0C, 0xB2, 0xBB, 0x70, 0xA1, 0x91, 0x21, 0x82, 0x5E, 0x95, 0x3B,
-    0x9C, 0x91, 0x35, 0x22, 0x9D, 0x5B, 0x99, 0x2B, 0xA6, 0x05, 0x4D, 0x83, 0x9F, 0x9F, 0xB2, 0xA1,
-    0x2B, 0xFC, 0x3B, 0xA0, 0x30, 0x73, 0x59, 0x9C, 0x42, 0xF9, 0x57, 0x60, 0xBF, 0x42, 0x08, 0x12,
-    0x18, 0x97, 0xA6, 0x29, 0xF9, 0xBE, 0x78, 0x7D, 0xDC, 0x8E, 0xA7, 0xF3, 0xE8, 0x95, 0x22, 0xFA,
-    0x56, 0xBE, 0xD7, 0xDA, 0x14, 0xCA, 0x06, 0x0B, 0x69, 0xF0, 0xBF, 0xB0, 0xC5, 0x33, 0x21, 0x83,
-    0x68, 0x31, 0x09, 0x98, 0x34, 0x81, 0xBD, 0xE4, 0xFB, 0x88, 0xB8, 0x36, 0xEF, 0x23, 0x6D, 0x13,
-    0x5B, 0x02, 0xB5, 0x67, 0x4A, 0xDF, 0x7D, 0xCF, 0xCB, 0x22, 0x9A, 0x95, 0x63, 0x5F, 0x06, 0xB0,
-    0xD9, 0xFA, 0xA2, 0x1F, 0xD4, 0x9F, 0xD1, 0x03, 0x56, 0xF7, 0x37, 0xFA, 0x3F, 0x9E, 0xA9, 0xA6,
-    0x6A, 0xB6, 0x56, 0xDE, 0x7E, 0xB0, 0x6F, 0x23, 0x01, 0x04, 0xBE, 0x90, 0x33, 0x75, 0x41, 0xCE,
-    0xA9, 0x47, 0x72, 0x46, 0xAB, 0x96, 0x2E, 0x11, 0x2A, 0x99, 0x3E, 0x71, 0x92, 0x53, 0xC4, 0xDF,
-    0x49, 0x81, 0x04, 0x12, 0x38, 0xDB, 0x9E, 0xB0, 0x0F, 0x42, 0xE8, 0x74, 0xF7, 0x04, 0x0C, 0xAF,
-    0xE0, 0x72, 0x44, 0x2F, 0x0B, 0xBC, 0x08, 0x24, 0x5E, 0x82, 0x31, 0x2F, 0x89, 0x0A, 0x93, 0x9C,
-    0x0E, 0xE1, 0x1E, 0x63, 0x01, 0x92, 0x18, 0x04, 0xD1, 0x1E, 0x0E, 0x03, 0xA5, 0x5C, 0x47, 0x9F,
-    0x3E, 0x78, 0xE1, 0x31, 0x4A, 0xAA, 0x23, 0x63, 0x63, 0x35, 0x2A, 0xAA, 0xC2, 0xEF, 0x3C, 0xF6,
-    0x6A, 0x2F, 0x15, 0xD4, 0x9A, 0x51, 0xAB, 0x65, 0x88, 0xDD, 0x00, 0x07, 0x01, 0x14, 0x85, 0xF9,
-    0x12, 0xF4, 0x4B, 0x0E, 0xC3, 0xD2, 0x96, 0xF5, 0x39, 0x1A, 0x0B, 0xD8, 0x7B, 0xAB, 0x85, 0xE5,
-    0x46, 0x74, 0x6A, 0x93, 0x95, 0xD1, 0xA4, 0x38, 0xF1, 0x0A, 0xC9, 0x34, 0x45, 0x17, 0x1F, 0x83,
-    0xA3, 0xB2, 0xD7, 0xC6, 0x71, 0x76, 0xD1, 0x5D, 0xB7, 0xC4, 0x69, 0x33, 0x17, 0x5C, 0x30, 0x96,
-    0x20, 0x45, 0x77, 0x13, 0x10, 0x70, 0x5B, 0x1D, 0xCE, 0x27, 0x05, 0x30, 0x3F, 0xDA, 0xCA, 0xBE,
-    0x52, 0xA1, 0x98, 0x80, 0x01, 0x4D, 0x6C, 0x55, 0xDB, 0x0A, 0x12, 0x9E, 0x3A, 0x2D, 0x8D, 0xF2,
-    0xE1, 0x3C, 0xF8, 0xFD, 0x18, 0x91, 0x8C, 0xB0, 0xFC, 0xC3, 0x11, 0x82, 0x34, 0x88, 0x93, 0xC4,
-    0xE2, 0xF9, 0xA0, 0x96, 0x2D, 0x63, 0x8E, 0xDE, 0x5E, 0xC4, 0xA9, 0x26, 0x2E, 0xCF, 0xBD, 0x82,
-    0x17, 0x50, 0x01, 0xAB, 0x87, 0x7C, 0x27, 0x79, 0x08, 0xA9, 0xEB, 0xE5, 0xC7, 0x71, 0xB9, 0x9E,
-    0x0B, 0x0D, 0x62, 0xEF, 0xE5, 0x1C, 0x3B, 0xFB, 0x50, 0xF0, 0x22, 0x76, 0xF9, 0x5F, 0x06, 0x57,
-    0x21, 0x9C, 0xE7, 0x83, 0xD7, 0x98, 0x70, 0xA1, 0x64, 0x47, 0x7D, 0x6C, 0xAE, 0xCC, 0x8F, 0xB9,
-    0xA7, 0xC8, 0x20, 0x8D, 0x3C, 0x97, 0xB9, 0xAB, 0x4E, 0x99, 0x08, 0x43, 0x7A, 0x03, 0x38, 0x62,
-    0x66, 0xE0, 0xA0, 0xF8, 0x60, 0x20, 0xD8, 0xB7, 0x94, 0xD9, 0x57, 0x4E, 0xE9, 0x70, 0x74, 0x85,
-    0x37, 0x9C, 0x52, 0x96, 0xD7, 0xF1, 0x06, 0x7E, 0x6A, 0xCE, 0x07, 0x03, 0x99, 0xC1, 0xF9, 0x7B,
-    0x2A, 0x41, 0x91, 0xE7, 0x4F, 0x54, 0xC2, 0x66, 0x8B, 0xFD, 0x4D, 0x88, 0x7B, 0xCE, 0xBA, 0x19,
-    0xE6, 0x69, 0x16, 0xC9, 0xAA, 0xBB, 0xC4, 0x2E, 0xF7, 0x5D, 0xDC, 0x7A, 0x1E, 0x51, 0xDE, 0x21,
-    0x12, 0xB0, 0x27, 0xCD, 0x89, 0x30, 0x3F, 0xD1, 0x38, 0x4C, 0x7F, 0x0F, 0x6D, 0x52, 0x33, 0x45,
-    0x1E, 0x67, 0x4D, 0x30, 0x57, 0xA6, 0xBB, 0x82, 0xA1, 0x6B, 0xCB, 0x67, 0x8A, 0x99, 0x1A, 0x9A,
-    0xCD, 0x47, 0x11, 0x24, 0x12, 0xA3, 0x06, 0x77, 0xC8, 0xD0, 0x1B, 0x32, 0x70, 0x86, 0x30, 0xFE,
-    0xCA, 0xA5, 0x2E, 0xC6, 0x18, 0x94, 0x1A, 0x1E, 0xF7, 0x18, 0x12, 0x47, 0x79, 0xAA, 0x6C, 0xE9,
-    0x35, 0x48, 0x3B, 0x94, 0x6E, 0x4C, 0xD9, 0x4E, 0xE8, 0xFC, 0xA8, 0x9C, 0x73, 0x14, 0x39, 0xF4,
-    0x07, 0x33, 0xD2, 0xEE, 0x6C, 0x0F, 0x57, 0x9A, 0xDE, 0x26, 0x57, 0x16, 0xBC, 0xD1, 0xD3, 0xA0,
-    0x3C, 0xA6, 0x4C, 0xAF, 0x30, 0x44, 0x79, 0x32, 0xEA, 0x82, 0x98, 0xAC, 0xEF, 0x6B, 0x65, 0xB7,
-    0x6A, 0x3B, 0x26, 0x4C, 0x79, 0xD5, 0xDA, 0xA9, 0xE8, 0x5A, 0x6F, 0xED, 0x79, 0x5B, 0x97, 0x33,
-    0x34, 0x0D, 0xE9, 0xA6, 0xD7, 0x96, 0xBD, 0xAE, 0xD8, 0x6B, 0x57, 0xF3, 0x52, 0x5A, 0xB1, 0xA9,
-    0xD7, 0x54, 0x6C, 0x8A, 0x10, 0x23, 0x2A, 0x64, 0x8F, 0x0E, 0x22, 0xEB, 0xBB, 0x9E, 0x19, 0x84,
-    0x8D, 0x7B, 0xD6, 0x67, 0x83, 0x51, 0x15, 0xE6, 0x16, 0xE3, 0x27, 0x1E, 0xFB, 0x46, 0x3B, 0x83,
-    0x2E, 0x04, 0x53, 0xC3, 0xE0, 0x88, 0x87, 0x9C, 0xFB, 0x60, 0xEC, 0x14, 0x42, 0x95, 0x30, 0x86,
-    0xDC, 0x5B, 0xBB, 0x20, 0x23, 0x6B, 0x73, 0xD2, 0x15, 0x1A, 0x0C, 0x8D, 0xE3, 0xAC, 0x50, 0xC3,
-    0x2F, 0x89, 0xB4, 0x2C, 0x11, 0x32, 0x88, 0x96, 0xBA, 0x06, 0x8C, 0xED, 0x69, 0x2E, 0x48, 0x81,
-    0xC3, 0xFD, 0x33, 0x15, 0x64, 0x94, 0x40, 0xE7, 0x4D, 0xAC, 0xD3, 0x7B, 0x05, 0xAB, 0x0E, 0xB8,
-    0xC9, 0xFB, 0x49, 0x89, 0x63, 0x34, 0x02, 0x67, 0x39, 0x6E, 0xAD, 0x17, 0xF0, 0x83, 0xA0, 0x06,
-    0xBC, 0xA7, 0xAF, 0x42, 0x2D, 0x87, 0x48, 0xD7, 0x1F, 0x41, 0x85, 0xAF, 0x78, 0x40, 0x5F, 0x16,
-    0xAE, 0x3D, 0x1B, 0x61, 0x2C, 0x63, 0x54, 0x71, 0xE6, 0x88, 0xE5, 0xFA, 0x39, 0x22, 0xB9, 0x51,
-    0xB1, 0x82, 0xBA, 0xB0, 0xB2, 0x43, 0xDB, 0xEA, 0xAE, 0x36, 0x89, 0xD5, 0x23, 0xE0, 0xB5, 0x7F,
-    0x86, 0xE1, 0x12, 0x58, 0x9E, 0x1E, 0x57, 0x06, 0x08, 0x77, 0x4D, 0x88, 0xBC, 0x1F, 0x59, 0xA4,
-    0x85, 0x8E, 0xAC, 0xE7, 0xCC, 0x15, 0x31, 0x59, 0xFD, 0x81, 0x78, 0xF4, 0xB9, 0x0C, 0xFE, 0x03,
-    0x65, 0x0C, 0x68, 0xD7, 0xCE, 0xDA, 0x57, 0xFB, 0xB2, 0x28, 0xEC, 0xB1, 0x6F, 0xB9, 0x97, 0x41,
-    0xDA, 0x92, 0x50, 0x83, 0xD7, 0x3F, 0xB6, 0xA9, 0x81, 0xBF, 0xD6, 0xF4, 0x80, 0xF3, 0x13, 0x86,
-    0x78, 0x8D, 0xF7, 0x92, 0x5E, 0x03, 0x57, 0xAF, 0xFB, 0x61, 0x7C, 0xA2, 0x6B, 0x6B, 0x1B, 0x6B,
-    0x95, 0xEE, 0x71, 0xAD, 0xC5, 0xA1, 0x6F, 0x0D, 0x78, 0x75, 0x7E, 0x5C, 0x76, 0x98, 0x64, 0xB9,
-    0x5A, 0x32, 0x89, 0x1D, 0x78, 0xFD, 0x15, 0xEC, 0xF1, 0x11, 0xBF, 0x68, 0xB1, 0xEE, 0xC6, 0x2F,
-    0x58, 0x49, 0x7A, 0x16, 0x7B, 0x23, 0x4B, 0x2F, 0xC1, 0xA5, 0x07, 0x47, 0x7E, 0x15, 0x3E, 0xD1,
-    0xCB, 0x7A, 0xF5, 0x6B, 0xA3, 0xE8, 0xA1, 0xBA, 0x2F, 0x7B, 0x3B, 0x97, 0x61, 0x6F, 0xF1, 0xFC,
-    0xD2, 0xFC, 0x31, 0x2C, 0x80, 0xF9, 0x77, 0x44, 0x05, 0x3F, 0x2E, 0x51, 0xA5, 0xF6, 0x22, 0x46,
-    0x1F, 0x39, 0xC5, 0x6B, 0xEB, 0x6B, 0x82, 0x93, 0xAF, 0x6D, 0x8C, 0x85, 0x5D, 0xD2, 0xB3, 0x32,
-    0x87, 0xD8, 0xF4, 0x65, 0x06, 0x89, 0xFC, 0xCA, 0x8A, 0x59, 0xF2, 0xBE, 0x5C, 0xCA, 0xFE, 0x86,
-    0x5E, 0x7F, 0xC9, 0xAC, 0x24, 0x5E, 0xD1, 0x4B, 0x3B, 0xF5, 0x53, 0x2F, 0x41, 0x7C, 0x6D, 0xE1,
-    0xB1, 0xBD, 0x8C, 0xB4, 0x34, 0x70, 0x89, 0x26, 0x0E, 0xB1, 0x01, 0xCD, 0xCA, 0xD0, 0xFB, 0x0D,
-    0x0A, 0xAD, 0x84, 0x2A, 0x2F, 0x53, 0x95, 0xFF, 0x03, 0x39, 0xE3, 0xF3, 0xF5, 0x4F, 0x6D, 0x04,
-    0x12, 0x3F, 0x1A, 0x9C, 0x8F, 0x18, 0x5E, 0xED, 0x68, 0x16, 0x65, 0xA8, 0xA9, 0xA8, 0x8A, 0x89,
-    0x28, 0x87, 0x61, 0xF0, 0x2E, 0x14, 0xAF, 0x00, 0x3B, 0xB9, 0xC8, 0x5A, 0x06, 0xB0, 0x97, 0xA2,
-    0xBB, 0xA2, 0x4A, 0x74, 0x65, 0x2F, 0xAD, 0x6B, 0x58, 0x5A, 0x77, 0x4D, 0x9C, 0x29, 0xE1, 0x3C,
-    0xE4, 0xF7, 0x64, 0xCD, 0xF7, 0x13, 0x70, 0x40, 0xCF, 0x77, 0x68, 0xAF, 0x96, 0x18, 0xA8, 0x0E,
-    0xFF, 0x12, 0xFC, 0xD7, 0x03, 0x67, 0x84, 0xBF, 0xFC, 0x1D, 0x36, 0xEF, 0xC1, 0x42, 0xB6, 0xA1,
-    0xE5, 0x23, 0xE9, 0x32, 0x44, 0x40, 0xC9, 0xA9, 0x60, 0xD2, 0x45, 0xC7, 0x67, 0xA2, 0x7D, 0x8B,
-    0xE5, 0x22, 0x49, 0x93, 0x07, 0xEA, 0x12, 0x69, 0x24, 0x54, 0x70, 0xD4, 0x9A, 0x6F, 0x4D, 0x6A,
-    0x2D, 0x18, 0x00, 0xE2, 0x0C, 0xF9, 0x38, 0x99, 0xE4, 0x62, 0x53, 0xBF, 0x7C, 0xD9, 0xD6, 0x72,
-    0xB8, 0x9A, 0x63, 0x73, 0x07, 0x81, 0xC5, 0xB0, 0xC3, 0xE3, 0xD6, 0x03, 0x58, 0xB9, 0x4C, 0x39,
-    0x5F, 0x5B, 0xEB, 0xBD, 0x6D, 0x05, 0xBD, 0xA9, 0xEB, 0x90, 0xED, 0xEB, 0x93, 0x0D, 0x2A, 0x78,
-    0x2B, 0x4C, 0xDD, 0xD1, 0xA9, 0x10, 0x46, 0x28, 0x96, 0x58, 0x94, 0x21, 0x37, 0x58, 0x74, 0x59,
-    0x07, 0x19, 0xA7, 0x2B, 0xEE, 0x40, 0xE5, 0xBE, 0xA3, 0xF9, 0x89, 0x91, 0x19, 0xCA, 0x08, 0x6E,
-    0x98, 0x1B, 0xA7, 0xD0, 0x82, 0xAF, 0x15, 0x48, 0x51, 0x8B, 0xFF, 0x2D, 0x78, 0x8B, 0x80, 0x00,
-    0x14, 0x87, 0xEF, 0x2E, 0xB3, 0x15, 0xFD, 0xDE, 0x17, 0x7D, 0xEE, 0x17, 0x54, 0xE2, 0xF2, 0xAD,
-    0x4E, 0x48, 0x2C, 0xB7, 0xB8, 0x00, 0x91, 0x5F, 0xEB, 0x6D, 0x51, 0xF2, 0xDF, 0x14, 0x84, 0x10,
-    0xA5, 0x2D, 0x48, 0x5F, 0x6C, 0x86, 0x28, 0xB2, 0x4F, 0xDC, 0x41, 0xF8, 0xC0, 0x40, 0x78, 0xA3,
-    0x8C, 0x04, 0x15, 0x2E, 0x85, 0x45, 0x8C, 0x78, 0x49, 0x9C, 0xF5, 0xD2, 0x0D, 0xD3, 0x19, 0x8B,
-    0xE8, 0x43, 0x73, 0x3C, 0x8E, 0xC5, 0x2F, 0x44, 0xD0, 0xAD, 0xE7, 0x6C, 0xC6, 0x9B, 0x2A, 0x33,
-    0x7C, 0x5B, 0x34, 0x63, 0xA2, 0xFE, 0xB4, 0x50, 0x6B, 0x11, 0x29, 0x92, 0x3B, 0x66, 0x3B, 0x37,
-    0x72, 0x8D, 0x58, 0x3A, 0x8F, 0xD2, 0xBB, 0x82, 0x72, 0x20, 0x74, 0x56, 0x5D, 0xB7, 0xA3, 0xFC,
-    0xA1, 0x6D, 0x6C, 0x2F, 0x02, 0xF2, 0x15, 0x9F, 0xEF, 0xF5, 0xD5, 0x6D, 0x43, 0xF9, 0x60, 0xF3,
-    0x4B, 0x73, 0xAB, 0x26, 0x79, 0xA0, 0x37, 0x80, 0x69, 0x11, 0x6B, 0xFC, 0xE7, 0x44, 0x2D, 0xFA,
-    0xB1, 0x47, 0xA4, 0x5F, 0xDE, 0xFF, 0xF3, 0x37, 0x58, 0x85, 0x35, 0x27, 0x4F, 0x4A, 0xBE, 0x07,
-    0x57, 0x70, 0x28, 0x26, 0xAA, 0x63, 0xEE, 0x6B, 0x30, 0xAF, 0xCC, 0x0C, 0x50, 0x6E, 0x5F, 0xCF,
-    0x56, 0x7C, 0xCF, 0xE6, 0x02, 0x65, 0xC2, 0x7B, 0x7B, 0xE9, 0x5C, 0xFD, 0xBA, 0x89, 0x57, 0x1B,
-    0xA4, 0x7B, 0xB7, 0x49, 0x1E, 0x41, 0xF5, 0xD8, 0x45, 0xE0, 0x24, 0x01, 0xA1, 0xB1, 0x10, 0x44,
-    0xE8, 0x1E, 0x55, 0xFE, 0xA6, 0x01, 0xA4, 0x67, 0xC6, 0x0A, 0x9E, 0x86, 0x21, 0xB4, 0xCF, 0x69,
-    0x05, 0x42, 0x64, 0xE2, 0x01, 0xF3, 0xAD, 0xD3, 0x6C, 0xE3, 0x52, 0x70, 0xC6, 0xA1, 0xDB, 0x91,
-    0xDB, 0x18, 0x1A, 0xA6, 0x3F, 0x40, 0xC1, 0x82, 0x75, 0x39, 0x9E, 0xAD, 0x1A, 0xBC, 0x7B, 0xAC,
-    0x9D, 0x00, 0x0A, 0xA3, 0x1C, 0x0D, 0x34, 0xB8, 0x5A, 0xF4, 0xA7, 0x61, 0x30, 0x96, 0x4D, 0x35,
-    0x89, 0xEF, 0xC9, 0xC7, 0x19, 0x63, 0x41, 0x9C, 0xA1, 0x31, 0x2A, 0x1A, 0x08, 0x29, 0x80, 0x68,
-    0x2E, 0xF3, 0x5E, 0xEA, 0x27, 0xA5, 0xF7, 0xC3, 0xC1, 0x67, 0x4B, 0xFF, 0x89, 0xA1, 0xB0, 0x4B,
-    0xDA, 0x11, 0xC0, 0x63, 0x16, 0x38, 0x08, 0xEC, 0x31, 0x0B, 0x28, 0x35, 0x3B, 0x19, 0x0A, 0xD6,
-    0x38, 0x11, 0x66, 0x8B, 0x02, 0xDB, 0xB3, 0x05, 0x41, 0xEB, 0xD9, 0x79, 0x47, 0x16, 0xD3, 0xF1,
-    0xD3, 0xB0, 0x5F, 0xDD, 0x2F, 0x46, 0x07, 0xBE, 0x31, 0x45, 0xCD, 0x9D, 0xA4, 0x28, 0x19, 0x92,
-    0xF3, 0x8B, 0x6D, 0xBB, 0x1D, 0xE6, 0x66, 0xF7, 0x62, 0xA4, 0x2E, 0x04, 0xBE, 0xB2, 0xC5, 0x48,
-    0xAC, 0x43, 0x6A, 0x01, 0x48, 0xB5, 0xE2, 0xFF, 0xB2, 0x6A, 0x36, 0x92, 0x7A, 0x64, 0xC6, 0x89,
-    0x68, 0xBC, 0x51, 0x5B, 0xDE, 0x32, 0x04, 0xCB, 0x0C, 0x5B, 0x28, 0x46, 0x6A, 0xE1, 0x51, 0xA8,
-    0x83, 0xEC, 0xB3, 0x54, 0x80, 0x25, 0x03, 0xF2, 0x88, 0x91, 0xF1, 0x36, 0x1F, 0x2D, 0x67, 0x9B,
-    0x5C, 0x10, 0x6B, 0xEE, 0xF5, 0x72, 0x04, 0xF3, 0x10, 0x0E, 0x45, 0x66, 0x2E, 0x4E, 0xDD, 0x41,
-    0xF2, 0xB0, 0x3B, 0x68, 0xD7, 0xCF, 0x0C, 0x36, 0xFC, 0x5A, 0x34, 0xF0, 0x67, 0x4B, 0xA4, 0xB9,
-    0x05, 0x66, 0x88, 0x52, 0x20, 0xC8, 0x33, 0xD1, 0x4C, 0xAC, 0x19, 0x95, 0x4D, 0xED, 0x34, 0xDA,
-    0x14, 0xDE, 0xCE, 0x64, 0x53, 0xBC, 0x1F, 0x93, 0x5F, 0x52, 0x8C, 0x47, 0x8C, 0x96, 0xA4, 0x62,
-    0x3C, 0xC7, 0x91, 0x9E, 0x13, 0xFC, 0x57, 0x77, 0x00, 0x4C, 0x28, 0x90, 0x12, 0xA1, 0xBE, 0x8A,
-    0xE5, 0xF2, 0x15, 0xC3, 0x45, 0x43, 0x16, 0x56, 0x0F, 0x09, 0x4E, 0x87, 0xDC, 0xBB, 0x2E, 0x37,
-    0xA7, 0x95, 0x4F, 0x6B, 0xAA, 0x93, 0x69, 0xA9, 0xFD, 0x51, 0xE1, 0xDB, 0xFE, 0x72, 0x21, 0xEC,
-    0x85, 0x5C, 0xDA, 0xE3, 0x94, 0x66, 0x0F, 0x7D, 0x0A, 0x1E, 0x04, 0x5A, 0xE0, 0x6A, 0x2A, 0x43,
-    0x88, 0x27, 0x41, 0xEF, 0x00, 0x97, 0x99, 0x0A, 0xF5, 0xB3, 0x15, 0x6E, 0xDD, 0x2D, 0x9A, 0xEA,
-    0xEE, 0xF6, 0xA4, 0xB4, 0x45, 0x53, 0x99, 0xDA, 0xF9, 0xF4, 0x24, 0x33, 0xCA, 0x2F, 0x0E, 0xC8,
-    0x4D, 0xC4, 0xCC, 0x97, 0x39, 0xC7, 0x03, 0x13, 0xC8, 0xF3, 0xC9, 0x2E, 0xDE, 0x3C, 0x0C, 0xEF,
-    0x60, 0xC8, 0xD2, 0x04, 0x9A, 0x0D, 0xD8, 0x1C, 0x0F, 0x78, 0xD7, 0xA4, 0x36, 0xA6, 0xF2, 0xF1,
-    0xD0, 0x67, 0xF2, 0xE1, 0xF4, 0xAC, 0xEB, 0x12, 0xBE, 0xD1, 0xB3, 0x08, 0x30, 0xB5, 0xBC, 0x3C,
-    0xB4, 0xDD, 0x21, 0x62, 0x9E, 0xBC, 0xA6, 0xD6, 0xC7, 0x1B, 0xAC, 0x69, 0x7B, 0x8E, 0xBB, 0xD9,
-    0x13, 0x50, 0x2C, 0x9C, 0xEC, 0x56, 0x71, 0x2A, 0x0C, 0x9A, 0xC9, 0x27, 0x51, 0xC6, 0xE4, 0xB5,
-    0x37, 0x10, 0xBC, 0x99, 0x25, 0x9A, 0xFC, 0x0D, 0xD2, 0xB6, 0xA1, 0xAE, 0x0E, 0x59, 0x51, 0x28,
-    0x8B, 0x38, 0xC2, 0xBA, 0x17, 0x51, 0xDB, 0xC7, 0xF8, 0x89, 0x78, 0x22, 0x27, 0xF1, 0xA3, 0x38,
-    0x73, 0xCB, 0x4B, 0x5A, 0xB9, 0xE3, 0x88, 0xC7, 0x23, 0x24, 0x11, 0x31, 0xFA, 0x5D, 0xAE, 0x25,
-    0x6B, 0xF0, 0x7C, 0x3C, 0x14, 0x9C, 0x51, 0x83, 0x22, 0x97, 0xA9, 0xBD, 0x6C, 0x5A, 0x96, 0x69,
-    0xFD, 0xAB, 0x26, 0xA8, 0xE2, 0xE7, 0x33, 0x11, 0x81, 0xD9, 0xD6, 0x0E, 0x7F, 0xDD, 0x96, 0x11,
-    0xFB, 0xAC, 0x09, 0x36, 0xF3, 0xD5, 0xDC, 0x73, 0xB2, 0xB3, 0x1B, 0x3D, 0x71, 0x72, 0x46, 0x90,
-    0x9D, 0xA1, 0xD9, 0x10, 0x40, 0xD1, 0xEF, 0x98, 0xC5, 0x28, 0x43, 0xE3, 0xD7, 0x22, 0x0A, 0x47,
-    0x96, 0xCC, 0x42, 0xC2, 0xCA, 0xC0, 0x73, 0x28, 0x78, 0x8F, 0xCD, 0x65, 0xC8, 0x52, 0x64, 0x44,
-    0xA4, 0x82, 0x22, 0xFA, 0x72, 0x01, 0x53, 0x16, 0x3E, 0x99, 0x75, 0xA1, 0xFC, 0x5E, 0x66, 0x38,
-    0x28, 0xF8, 0x5F, 0x04, 0x95, 0xA2, 0xCE, 0xA3, 0x6F, 0x56, 0xEC, 0x0E, 0xAA, 0x09, 0x5D, 0x20,
-    0x6B, 0xB6, 0x30, 0x44, 0x1B, 0x61, 0x9A, 0x5E, 0x13, 0xDD, 0x01, 0x25, 0xF6, 0xD1, 0x1E, 0x79,
-    0x24, 0xB6, 0xBB, 0xF2, 0x38, 0x37, 0x60, 0xA8, 0xDD, 0x51, 0x5A, 0x1D, 0x06, 0x7B, 0x7F, 0xB5,
-    0x3F, 0x24, 0x29, 0x12, 0xC6, 0x66, 0xC5, 0x89, 0x64, 0xB3, 0x0E, 0x4A, 0xCF, 0x22, 0xEC, 0x89,
-    0xE1, 0x86, 0xC8, 0x08, 0x2C, 0x1E, 0x13, 0xFE, 0xC6, 0xB0, 0x13, 0xB2, 0xB7, 0x1C, 0xC9, 0x08,
-    0x3D, 0x8E, 0x4C, 0xC4, 0xBB, 0x44, 0xDD, 0x1E, 0x0B, 0xDD, 0x65, 0x6F, 0xC3, 0x1F, 0x5D, 0x68,
-    0x0B, 0xBD, 0xDF, 0x21, 0x70, 0x6F, 0xD7, 0x04, 0x9F, 0x03, 0xAD, 0xFF, 0x9E, 0x32, 0x4E, 0x8B,
-    0x81, 0x0F, 0x04, 0x86, 0x6A, 0xD4, 0x81, 0x5E, 0x21, 0xB7, 0x2C, 0xD9, 0x5C, 0x78, 0xCA, 0x34,
-    0x84, 0x3E, 0x28, 0xD1, 0x6A, 0xCE, 0x2E, 0xDE, 0xC2, 0x1A, 0x2C, 0xF6, 0x31, 0xB5, 0x40, 0x98,
-    0x64, 0x6F, 0xC0, 0x22, 0x0B, 0x61, 0x61, 0x7A, 0x22, 0x94, 0x8C, 0x2F, 0xD8, 0x46, 0x8C, 0xD7,
-    0xAD, 0x7C, 0xFE, 0x15, 0xD5, 0xFB, 0x3C, 0x09, 0xF2, 0x40, 0x79, 0x6A, 0xC6, 0x32, 0x18, 0xBD,
-    0x38, 0x3A, 0xAB, 0xFD, 0x33, 0x5C, 0xED, 0x8A, 0x30, 0x0B, 0x93, 0x44, 0xDF, 0x2B, 0x93, 0x67,
-    0x73, 0xC4, 0xA8, 0x3A, 0x22, 0x32, 0x95, 0xE9, 0x9F, 0xD3, 0x0A, 0xF4, 0x03, 0x4E, 0x45, 0x6A,
-    0x3B, 0x44, 0x67, 0xD3, 0x0B, 0x8B, 0x15, 0xDD, 0x8A, 0x1E, 0x0C, 0x0B, 0x42, 0xC1, 0xC3, 0x7A,
-    0x29, 0xDB, 0x2A, 0x01, 0xBC, 0x04, 0xFD, 0xB6, 0x16, 0x00, 0xB5, 0xB5, 0x56, 0xCC, 0x96, 0x31,
-    0x26, 0xA9, 0x87, 0x42, 0xE3, 0x38, 0x8F, 0x06, 0x42, 0xD1, 0x70, 0x6B, 0xD4, 0x13, 0x86, 0x73,
-    0xEB, 0x3E, 0x31, 0xFC, 0x1E, 0x1B, 0x22, 0x9B, 0xA3, 0xA5, 0x4B, 0xC8, 0x81, 0x97, 0x97, 0x41,
-    0xE1, 0xE2, 0xDB, 0x97, 0x27, 0x95, 0x5E, 0x76, 0x49, 0xDA, 0x95, 0xB5, 0xB3, 0xF7, 0x28, 0x86,
-    0x9F, 0xEB, 0x6C, 0x55, 0xAD, 0x0D, 0xA1, 0xF5, 0xF9, 0x2A, 0x12, 0x62, 0x9F, 0xB8, 0x14, 0xB2,
-    0x32, 0x27, 0xCC, 0xE8, 0xE3, 0xE4, 0xE0, 0x28, 0xF8, 0x77, 0x18, 0x3B, 0x8C, 0x76, 0x74, 0x58,
-    0x01, 0xC9, 0x0A, 0x44, 0xCA, 0xCC, 0x92, 0x8C, 0xF7, 0xCA, 0x6B, 0x45, 0xFC, 0xDE, 0xCA, 0xC4,
-    0xCF, 0xD4, 0x8F, 0x8A, 0x31, 0xAF, 0x1F, 0xD2, 0x10, 0x9E, 0x06, 0xEE, 0xD6, 0xD6, 0xF0, 0xE4,
-    0xFB, 0xD7, 0xD7, 0x31, 0xC7, 0x43, 0xFF, 0x68, 0x6E, 0xA7, 0xCE, 0xF8, 0x14, 0xBA, 0xFB, 0xC6,
-    0x59, 0x83, 0xBB, 0xE9, 0xA8, 0xB3, 0x99, 0x5F, 0xF8, 0xD2, 0xB6, 0x09, 0x7F, 0xEC, 0xC1, 0x80,
-    0x1D, 0x65, 0xB1, 0x31, 0xCA, 0x62, 0x37, 0xB4, 0x0C, 0x97, 0x65, 0xB1, 0xCE, 0xBB, 0x57, 0xC4,
-    0xB6, 0xCD, 0x36, 0xED, 0xDC, 0x9A, 0x7C, 0xC9, 0x9F, 0xF2, 0x97, 0x59, 0x52, 0xEA, 0x8D, 0xE1,
-    0x4E, 0xB7, 0xD9, 0xDB, 0xB0, 0x5B, 0xDB, 0x25, 0x86, 0x68, 0x40, 0x12, 0xD8, 0x88, 0x70, 0xAB,
-    0x9D, 0x09, 0xC8, 0xCD, 0x35, 0xFE, 0xEA, 0xA7, 0x4D, 0x7B, 0xE8, 0x34, 0x92, 0x3C, 0x7D, 0xB5,
-    0xEC, 0xF3, 0xA2, 0x6B, 0xE2, 0x10, 0xD4, 0x36, 0x77, 0xC1, 0x0C, 0x98, 0xB9, 0x31, 0x0A, 0x3A,
-    0x11, 0x3A, 0xD9, 0xD1, 0x93, 0xE8, 0x1D, 0x78, 0xCC, 0x46, 0x0A, 0xC7, 0x1A, 0xF2, 0x72, 0x7F,
-    0x33, 0x3C, 0xE0, 0x15, 0x27, 0x17, 0x65, 0x5F, 0x92, 0xD7, 0xA0, 0x6C, 0xF1, 0x6D, 0xB9, 0x1F,
-    0xF4, 0xC4, 0x5B, 0xA8, 0x13, 0x3E, 0xC4, 0x2D, 0xF3, 0x27, 0x74, 0x3B, 0x76, 0xF7, 0x5A, 0xB7,
-    0x5D, 0x0F, 0xCF, 0xDB, 0x58, 0x9C, 0x70, 0xC6, 0x30, 0x1E, 0x6F, 0x24, 0xAB, 0x90, 0xE8, 0x2F,
-    0x0E, 0x07, 0x97, 0x8E, 0x8B, 0x4E, 0x10, 0xD6, 0x11, 0x09, 0x47, 0xD2, 0xC9, 0x79, 0x4E, 0x54,
-    0xC6, 0xEA, 0xE2, 0xFC, 0xF8, 0x4B, 0xE6, 0x2F, 0xB7, 0x59, 0xB2, 0x71, 0xC3, 0x9E, 0xB5, 0x35,
-    0x00, 0xFB, 0x9B, 0x38, 0xFB, 0x1D, 0x36, 0x3A, 0xDD, 0x7C, 0xDC, 0x0D, 0xAA, 0x8A, 0xEE, 0x37,
-    0x50, 0xA6, 0xC8, 0x98, 0x38, 0x3F, 0x05, 0x38, 0xF8, 0xA3, 0x79, 0xE3, 0x66, 0xF7, 0xC8, 0x27,
-    0x5F, 0xF2, 0x52, 0xF3, 0x41, 0x3E, 0xF6, 0x29, 0x7A, 0xDD, 0x77, 0x21, 0x51, 0x4B, 0x93, 0x0C,
-    0xFF, 0x46, 0xA7, 0xF6, 0x37, 0x7F, 0x5A, 0xEC, 0xD3, 0xC0, 0x60, 0xF0, 0x81, 0x6E, 0xA8, 0xB1,
-    0x51, 0xE4, 0x85, 0x7B, 0xDC, 0xD7, 0x91, 0x88, 0x3D, 0xF8, 0x6C, 0x69, 0x59, 0xA0, 0xED, 0x31,
-    0x00, 0xDF, 0x1D, 0x33, 0xBC, 0x6B, 0xA2, 0xF8, 0xEC, 0xF7, 0x83, 0xEB, 0x0D, 0x11, 0x4C, 0xBF,
-    0xF1, 0x15, 0x6E, 0xF8, 0x08, 0x9B, 0x4F, 0x8E, 0x34, 0x9F, 0x2C, 0x36, 0x9F, 0x2C, 0xD8, 0x2A,
-    0x14, 0xEA, 0x0C, 0xFE, 0xE6, 0x90, 0xB7, 0x08, 0x50, 0x2E, 0x07, 0x4F, 0x95, 0x20, 0x38, 0xB2,
-    0xC1, 0x74, 0x45, 0x36, 0xDA, 0x46, 0x84, 0xD5, 0xBE, 0xFF, 0x85, 0xFE, 0xB9, 0x5E, 0x4E, 0x98,
-    0xB6, 0x5A, 0xBC, 0xA4, 0x98, 0x6F, 0x68, 0xA8, 0x41, 0x4E, 0xE3, 0xFC, 0x77, 0xF3, 0xC1, 0x3F,
-    0xF6, 0x35, 0xF1, 0xD1, 0x98, 0x4D, 0x32, 0x36, 0xEE, 0x1B, 0x0D, 0x6C, 0x66, 0x9B, 0x55, 0x95,
-    0xD6, 0x24, 0x2F, 0xD9, 0x33, 0x09, 0xB0, 0x76, 0x9D, 0xF8, 0xF9, 0xE6, 0x2E, 0x13, 0xD1, 0x6E,
-    0xDA, 0x8F, 0x66, 0xF8, 0xE8, 0x80, 0x9A, 0xE7, 0x33, 0x34, 0x47, 0x1A, 0xB7, 0x1E, 0xCC, 0x93,
-    0xF8, 0xB5, 0x2E, 0xE0, 0xF3, 0xEF, 0xDE, 0x8B, 0x53, 0x32, 0xBB, 0xB3, 0x6B, 0x2F, 0x4E, 0xB8,
-    0xB3, 0x17, 0xE7, 0x69, 0x96, 0xB6, 0x1E, 0x7F, 0xD7, 0x5E, 0x9C, 0xD6, 0x79, 0x66, 0x8C, 0xDA,
-    0x5A, 0xC5, 0x7A, 0x93, 0x5E, 0x9C, 0x83, 0xE8, 0xC5, 0x39, 0x85, 0x08, 0x5A, 0x52, 0x0F, 0x76,
-    0xB1, 0x9F, 0xDB, 0xA1, 0x49, 0xB4, 0xAD, 0x1B, 0xB6, 0xA9, 0x0F, 0xBC, 0x5B, 0xD8, 0x69, 0x49,
-    0xA4, 0x30, 0xF9, 0x13, 0x01, 0xC9, 0x36, 0x99, 0x69, 0x43, 0xCC, 0x71, 0x49, 0x17, 0xA7, 0xDA,
-    0x51, 0x35, 0x33, 0x13, 0x66, 0x66, 0x88, 0x59, 0x6C, 0x65, 0x22, 0xAF, 0x67, 0xB3, 0xC4, 0xFD,
-    0x56, 0x16, 0xBF, 0x19, 0x5E, 0x0F, 0x2B, 0x2A, 0x88, 0xBF, 0xB0, 0x29, 0xE5, 0x4B, 0x9A, 0x39,
-    0xF3, 0x8A, 0x49, 0xF1, 0xB5, 0x31, 0xDB, 0x3A, 0xCD, 0xA7, 0x6E, 0x18, 0xBC, 0x61, 0xB3, 0xBE,
-    0xF5, 0xDC, 0x0D, 0x6E, 0xD8, 0x6C, 0xC8, 0x75, 0xF4, 0xBE, 0x43, 0xAE, 0xC1, 0x24, 0xE4, 0xAA,
-    0x29, 0x8E, 0x69, 0x8A, 0xA8, 0x27, 0x5B, 0x77, 0x71, 0x6B, 0xF5, 0xC6, 0x34, 0x91, 0x4C, 0x20,
-    0x5A, 0x13, 0x83, 0xCF, 0x65, 0x85, 0x93, 0x97, 0x00, 0xE2, 0x2C, 0x2C, 0x7A, 0xA2, 0x49, 0x27,
-    0xA7, 0x05, 0x20, 0xA2, 0xBA, 0xD5, 0xCB, 0x27, 0xFD, 0x96, 0x83, 0x99, 0xF6, 0x8C, 0x70, 0xDA,
-    0x9E, 0xF1, 0xD2, 0x4B, 0x28, 0x58, 0xFE, 0x25, 0x42, 0x32, 0x6D, 0x01, 0x52, 0xFF, 0x15, 0xDD,
-    0x9D, 0xF5, 0x0F, 0xB0, 0x8B, 0x62, 0x8E, 0x56, 0x8C, 0x9B, 0xEE, 0xD6, 0x9E, 0x71, 0x70, 0xD2,
-    0x9E, 0xF1, 0xEE, 0x15, 0x3F, 0x3D, 0xF0, 0xCA, 0xE8, 0x5D, 0x2B, 0x7E, 0x1E, 0x47, 0x3D, 0xD2,
-    0x7F, 0x40, 0xC5, 0x4F, 0x3C, 0xA9, 0xF8, 0x91, 0xED, 0x0D, 0x5F, 0xFC, 0x32, 0x73, 0x6F, 0xFD,
-    0x9B, 0x54, 0xFC, 0x34, 0xD9, 0xA2, 0x3B, 0xA9, 0xC9, 0x55, 0x7C, 0xB4, 0x91, 0x75, 0x6B, 0xED,
-    0xB9, 0x5D, 0xEB, 0x7A, 0xC3, 0xF7, 0xEE, 0xD1, 0x68, 0x99, 0xC6, 0xD6, 0xDC, 0x74, 0xBD, 0x5A,
-    0x5F, 0xED, 0xB3, 0x99, 0xEB, 0x28, 0x36, 0x62, 0xEB, 0x85, 0x1B, 0x72, 0x7A, 0xB3, 0x1B, 0xB6,
-    0x33, 0xA7, 0x37, 0x9B, 0xD7, 0xB3, 0xBD, 0xAA, 0x5B, 0x6B, 0x3B, 0x7A, 0x55, 0x4F, 0x6A, 0x17,
-    0xE6, 0xF6, 0x49, 0xEF, 0x5D, 0x7E, 0x35, 0xB5, 0xD5, 0xC1, 0x1F, 0x78, 0xD2, 0xFB, 0xD6, 0xD6,
-    0x2E, 0x04, 0xE3, 0x75, 0x61, 0x3F, 0x61, 0xF2, 0xCA, 0xCD, 0x9D, 0x81, 0x93, 0x37, 0x09, 0xC9,
-    0x6F, 0x6C, 0x69, 0x88, 0xFB, 0x66, 0x09, 0xC9, 0x0F, 0x34, 0x51, 0x13, 0x7D, 0x87, 0x62, 0x80,
-    0x82, 0x98, 0xD3, 0xB5, 0xAD, 0x25, 0xB7, 0x62, 0xD0, 0x54, 0xB1, 0x0E, 0x9B, 0xC1, 0x41, 0xE3,
-    0xF1, 0x41, 0x94, 0x24, 0xA0, 0x87, 0x7F, 0x66, 0xBF, 0x5C, 0x9B, 0xA8, 0x6A, 0xCB, 0x1B, 0xD1,
-    0xE9, 0x83, 0x18, 0x84, 0x53, 0x37, 0x31, 0x88, 0x9B, 0x2D, 0xC8, 0xDB, 0xBA, 0x80, 0xEE, 0x06,
-    0x59, 0x90, 0x60, 0x22, 0x26, 0xEE, 0x59, 0xBB, 0x06, 0x8D, 0xD0, 0x8F, 0x52, 0xF9, 0xEE, 0x4C,
-    0xFD, 0xF9, 0x1D, 0xB2, 0xC4, 0x05, 0xBA, 0x4E, 0x02, 0x2C, 0xBF, 0x57, 0x6A, 0xE7, 0x66, 0x54,
-    0xF8, 0x75, 0x25, 0xF6, 0x26, 0x29, 0xF7, 0xD6, 0xAB, 0x61, 0x6D, 0x4E, 0x9E, 0x93, 0x5D, 0xBB,
-    0x3F, 0x32, 0xF7, 0x22, 0x4E, 0x7F, 0xEE, 0x0E, 0x63, 0x0E, 0x33, 0x19, 0x0D, 0x3B, 0x37, 0xA4,
-    0x22, 0x0B, 0x44, 0x05, 0xB1, 0x57, 0x3B, 0xAD, 0xD8, 0xAF, 0xE1, 0xBD, 0x38, 0x50, 0xCF, 0xE0,
-    0xE7, 0x6F, 0x53, 0x9D, 0x47, 0x0A, 0x11, 0xCD, 0xF8, 0xA1, 0xFF, 0xBB, 0x41, 0x2C, 0xC5, 0x50,
-    0x34, 0x04, 0x93, 0xC9, 0x82, 0x90, 0x68, 0x89, 0xDE, 0x54, 0xAE, 0x3D, 0x04, 0x61, 0xC6, 0x0E,
-    0x32, 0x99, 0x9C, 0x4F, 0xBD, 0x1D, 0x43, 0x5D, 0xCF, 0x0F, 0x9C, 0xDE, 0xAA, 0xD8, 0x95, 0xF6,
-    0x6A, 0x20, 0xB4, 0xED, 0x59, 0xBF, 0xC8, 0x76, 0x8D, 0x4C, 0x34, 0x57, 0x73, 0x7A, 0x40, 0x63,
-    0xAC, 0xBD, 0x06, 0xA1, 0xCC, 0xA4, 0xFF, 0x01, 0x4D, 0xC7, 0xA8, 0x2E, 0x11, 0xAD, 0xBE, 0x9E,
-    0x7B, 0x4F, 0x0C, 0xFD, 0x7C, 0xD1, 0x2F, 0xF6, 0x9A, 0x6E, 0x90, 0x57, 0xD0, 0x82, 0x2B, 0xE1,
-    0x13, 0xA5, 0xCB, 0xF8, 0xC0, 0x83, 0xE4, 0xF8, 0xA5, 0xF0, 0x21, 0xDE, 0xBD, 0xB5, 0xBE, 0xAE,
-    0x31, 0x05, 0x9B, 0x7C, 0xEE, 0x2C, 0x69, 0xBE, 0xB9, 0x5A, 0x0C, 0xB5, 0x0E, 0xF6, 0x3C, 0xAE,
-    0x97, 0xBD, 0xFE, 0xF9, 0x30, 0xDF, 0x63, 0x2A, 0x3F, 0xEF, 0x04, 0xC5, 0x3D, 0x66, 0x14, 0x0B,
-    0x79, 0xB6, 0x2A, 0xE4, 0x08, 0x07, 0x8E, 0x98, 0x01, 0x7A, 0xD0, 0x7B, 0xCE, 0xD8, 0xC9, 0x34,
-    0x81, 0x45, 0x8B, 0x18, 0x1A, 0x77, 0xCF, 0x2E, 0xA7, 0xC1, 0x16, 0xCE, 0x0B, 0x13, 0x47, 0x80,
-    0x4D, 0x9D, 0x3F, 0x1B, 0xC1, 0xE0, 0x24, 0xA9, 0x56, 0x14, 0x0E, 0x40, 0x85, 0x7B, 0x77, 0x48,
-    0x35, 0xCC, 0xDD, 0xDE, 0xE5, 0xBE, 0xB1, 0xD5, 0x29, 0x51, 0xBF, 0x41, 0xB1, 0x8D, 0x94, 0xDC,
-    0xA5, 0xC5, 0xF4, 0xAC, 0x56, 0x73, 0x51, 0x71, 0x2D, 0xB4, 0x4E, 0xDE, 0x10, 0x28, 0xCD, 0xCA,
-    0x43, 0xD5, 0x3C, 0xA4, 0xA6, 0xEE, 0x2D, 0x86, 0xEF, 0x4D, 0x32, 0xA2, 0x04, 0x3F, 0xCB, 0x15,
-    0x0A, 0x77, 0x53, 0x24, 0x7E, 0x02, 0x61, 0x35, 0x37, 0x6D, 0x64, 0xA7, 0xA5, 0x79, 0xD8, 0x8B,
-    0xD5, 0x04, 0xE7, 0xDE, 0x27, 0xAF, 0x8A, 0x69, 0xE2, 0x96, 0x69, 0x7F, 0x19, 0x25, 0x45, 0x85,
-    0x1A, 0xFD, 0xE3, 0xD6, 0xF0, 0xC9, 0xCB, 0x6D, 0x59, 0xBF, 0xFB, 0x94, 0x9A, 0xEF, 0x80, 0xD6,
-    0xBB, 0x0D, 0x09, 0x71, 0x06, 0x57, 0x18, 0x7C, 0xB9, 0x17, 0xB5, 0xFB, 0x14, 0x92, 0xFD, 0x94,
-    0x92, 0x63, 0x1C, 0xCF, 0x72, 0x24, 0x38, 0x7A, 0x6A, 0xA6, 0x6F, 0xF5, 0x21, 0xB6, 0x7F, 0x19,
-    0xED, 0x58, 0x1D, 0x52, 0x51, 0x28, 0xF8, 0x6E, 0x4F, 0x92, 0x5E, 0x3C, 0xD4, 0x03, 0x09, 0xAF,
-    0x1C, 0xDA, 0x22, 0x44, 0x33, 0x47, 0xEE, 0xB1, 0x88, 0xCE, 0xE6, 0xC8, 0x14, 0x9C, 0x1D, 0x37,
-    0x13, 0x4D, 0x6B, 0xC7, 0x2F, 0x4E, 0x4B, 0x27, 0xFE, 0xAD, 0x89, 0x4B, 0x71, 0x7E, 0x85, 0x9B,
-    0x9F, 0xCA, 0xBC, 0xFE, 0x61, 0x57, 0x04, 0xEF, 0x24, 0x36, 0x10, 0xD9, 0x9C, 0xAB, 0x4C, 0x95,
-    0x83, 0xC7, 0x31, 0xA5, 0xE8, 0x41, 0x9C, 0x1F, 0xA0, 0x67, 0x7A, 0x74, 0xAD, 0xAB, 0xBE, 0x84,
-    0x5D, 0x5C, 0x41, 0xEC, 0xB9, 0xC3, 0x68, 0xB4, 0x7D, 0xC0, 0xC9, 0xC9, 0x91, 0x4D, 0x93, 0xE8,
-    0x27, 0x79, 0xEE, 0xDF, 0x28, 0x69, 0xFC, 0x8A, 0xCD, 0x0D, 0xEC, 0x5E, 0x5F, 0x59, 0x64, 0x9C,
-    0xEC, 0x10, 0x0A, 0xD4, 0xA0, 0x7C, 0x7F, 0xF2, 0x14, 0x9E, 0x77, 0xF5, 0x5B, 0x20, 0xCA, 0x0F,
-    0xFF, 0x15, 0xC6, 0x97, 0x81, 0xCA, 0xA2, 0x6F, 0xF5, 0x49, 0x1A, 0x12, 0xE5, 0x4F, 0x99, 0x1F,
-    0x3C, 0xCC, 0x46, 0x92, 0x63, 0x20, 0xC4, 0xCA, 0x02, 0x18, 0xA7, 0x7B, 0x12, 0x3C, 0x34, 0x6C,
-    0x8A, 0xBF, 0xD8, 0xD2, 0x2B, 0x5C, 0x71, 0x90, 0x2D, 0xBD, 0xCC, 0x03, 0xA2, 0x22, 0x6F, 0x3E,
-    0x13, 0xE0, 0xD1, 0x13, 0x1F, 0xCB, 0xFD, 0x79, 0xE1, 0xF5, 0xFD, 0x34, 0xF3, 0x7F, 0xF2, 0xDF,
-    0xB0, 0x56, 0x79, 0x4A, 0xF0, 0x43, 0x20, 0xA8, 0x37, 0xB1, 0x6A, 0x3C, 0x28, 0xFA, 0x17, 0x08,
-    0x95, 0xE0, 0x31, 0xC9, 0x31, 0xC6, 0x26, 0xE4, 0xF6, 0x8C, 0x57, 0xAC, 0x20, 0xBA, 0xD1, 0x21,
-    0xA8, 0xBD, 0x71, 0xA3, 0x1F, 0x79, 0x1B, 0x1B, 0x5D, 0xD7, 0x5F, 0xF9, 0x98, 0x37, 0xDA, 0x1D,
-    0x4D, 0x4B, 0x2E, 0x6C, 0xD5, 0x64, 0x87, 0x81, 0xF1, 0xE7, 0xEC, 0xA0, 0x07, 0xEE, 0x0C, 0x64,
-    0x87, 0xDD, 0x5D, 0x76, 0xD8, 0xFF, 0x10, 0x3B, 0xDC, 0x14, 0x2D, 0x88, 0xA9, 0x17, 0x8F, 0x3A,
-    0x5C, 0x1B, 0xA7, 0xC9, 0xF0, 0x4E, 0x99, 0x56, 0x75, 0xFE, 0x90, 0x3B, 0x70, 0x8A, 0xFB, 0xC0,
-    0xE4, 0x19, 0x83, 0x77, 0x34, 0xDF, 0x77, 0x32, 0xE8, 0xBD, 0x60, 0x6C, 0xF9, 0x85, 0x09, 0xFF,
-    0x27, 0x8D, 0x03, 0x5D, 0xA8, 0xE8, 0x3F, 0x0F, 0x29, 0xEE, 0xA3, 0x49, 0x74, 0x29, 0xB1, 0x46,
-    0x16, 0x8E, 0x6E, 0x8B, 0xDA, 0xA0, 0x3B, 0xDD, 0x49, 0x7F, 0x9C, 0xFA, 0x9B, 0x42, 0xEC, 0xC2,
-    0xA9, 0xC5, 0x6E, 0x67, 0xCE, 0x95, 0x64, 0x3D, 0x0F, 0xC6, 0x67, 0xC3, 0xFC, 0xC8, 0x91, 0xC7,
-    0xC3, 0xEC, 0x2C, 0x0C, 0x01, 0xE7, 0x8F, 0xC4, 0x37, 0x7C, 0x94, 0xA4, 0x4B, 0x4E, 0x93, 0x2F,
-    0x57, 0x60, 0x2E, 0x3A, 0x2C, 0x50, 0x63, 0xD6, 0x08, 0xB6, 0x15, 0x19, 0x23, 0x21, 0x4C, 0x3B,
-    0x45, 0x29, 0x52, 0x7F, 0x67, 0x93, 0x72, 0x39, 0x69, 0x52, 0x2E, 0x77, 0x36, 0x29, 0x87, 0x3B,
-    0x9B, 0x94, 0xC3, 0xF7, 0x68, 0x52, 0xB6, 0xDD, 0xC9, 0x2B, 0x93, 0x26, 0x65, 0xDB, 0x9D, 0xBC,
-    0xB2, 0xB3, 0x49, 0xF9, 0xA0, 0x36, 0x29, 0x13, 0x6B, 0xAB, 0x32, 0x8D, 0x2C, 0xC8, 0xDE, 0x86,
-    0xB5, 0x9B, 0x4B, 0xB6, 0xCD, 0x4A, 0x50, 0x90, 0x8F, 0x22, 0xF1, 0xC9, 0x76, 0xB5, 0x15, 0x48,
-    0x1C, 0x7B, 0xDD, 0x6C, 0x27, 0x6F, 0x40, 0xA8, 0x78, 0xED, 0x22, 0x32, 0x9E, 0x17, 0x91, 0xCC,
-    0x66, 0x45, 0xA0, 0x76, 0xC5, 0x20, 0x04, 0xC7, 0x7A, 0x67, 0x96, 0x39, 0xFB, 0xEF, 0x64, 0x48,
-    0x63, 0xE3, 0xF6, 0x9F, 0x4D, 0x1B, 0xBB, 0x13, 0x4E, 0x1C, 0x3E, 0xA8, 0xBC, 0xA8, 0xB2, 0xFE,
-    0xAB, 0x66, 0x06, 0x53, 0xA5, 0xDB, 0xBA, 0xED, 0x6B, 0x0E, 0x2D, 0xE5, 0x02, 0x4B, 0xBA, 0x60,
-    0x42, 0xBB, 0x86, 0x78, 0x0D, 0xF5, 0x1A, 0xF2, 0x35, 0xF4, 0x23, 0x01, 0x33, 0x33, 0xA1, 0x60,
-    0x43, 0xC2, 0x86, 0x86, 0x0D, 0x11, 0x1B, 0x2A, 0x36, 0x64, 0xB4, 0x74, 0x6C, 0x08, 0xD9, 0x50,
-    0x52, 0x49, 0x59, 0x28, 0x69, 0xD6, 0x20, 0xF3, 0xC2, 0x32, 0x20, 0x8E, 0x87, 0x72, 0xA7, 0x8E,
-    0x87, 0x22, 0xEF, 0xA1, 0x9B, 0x92, 0x3E, 0x4A, 0x20, 0xA5, 0x90, 0x92, 0x48, 0x69, 0xA4, 0x44,
-    0x52, 0x2A, 0x29, 0x99, 0x94, 0x4E, 0x4A, 0x28, 0x24, 0xFC, 0xC7, 0x13, 0xCF, 0x2E, 0xB1, 0x67,
-    0x05, 0x08, 0xCC, 0xBA, 0x38, 0x9A, 0x39, 0xDB, 0x49, 0xAE, 0x5C, 0x2D, 0x92, 0x04, 0xF9, 0xCC,
-    0x19, 0x4F, 0x3B, 0xCF, 0x76, 0x0A, 0x73, 0x5D, 0x2D, 0xBA, 0xC8, 0x4F, 0xAB, 0x25, 0x64, 0xE5,
-    0x97, 0x2C, 0xB9, 0xFD, 0x35, 0x9E, 0xD9, 0x82, 0x32, 0xAF, 0x0C, 0x4B, 0xEF, 0xAA, 0x0E, 0xD2,
-    0x43, 0x54, 0xBA, 0x36, 0xEC, 0xCE, 0xB3, 0x9D, 0x08, 0xCB, 0xD4, 0x55, 0xA8, 0x74, 0x06, 0x42,
-    0x8D, 0xF9, 0x4D, 0x79, 0x68, 0x0F, 0x67, 0x3C, 0x65, 0x4D, 0xCE, 0xA9, 0xB9, 0x32, 0x58, 0xE4,
-    0xAB, 0x07, 0x88, 0xE9, 0x74, 0xF5, 0x87, 0x6A, 0x68, 0x03, 0x86, 0xCF, 0x0D, 0x8B, 0x0D, 0x27,
-    0x21, 0x86, 0xA3, 0x6B, 0x6B, 0x02, 0xD2, 0xE3, 0xAD, 0xB5, 0xDE, 0xEB, 0xB6, 0x33, 0xD2, 0xE3,
-    0xB9, 0x06, 0x6C, 0x6B, 0x62, 0x36, 0xD5, 0x28, 0xCF, 0xE1, 0x19, 0xE3, 0xE7, 0xE5, 0xA6, 0x02,
-    0xFB, 0xB2, 0x48, 0x24, 0x2D, 0xE8, 0xC7, 0xC2, 0x17, 0x08, 0x8B, 0xC3, 0x9B, 0x59, 0x62, 0xC3,
-    0x00, 0x68, 0xEA, 0x0C, 0x56, 0x40, 0xFF, 0x41, 0x47, 0x5B, 0xB6, 0xB6, 0x95, 0xB1, 0xBB, 0x0A,
-    0xF4, 0x2C, 0x9A, 0x65, 0xC0, 0xF2, 0x17, 0x8C, 0x67, 0xD5, 0x93, 0xC3, 0xCE, 0x90, 0x8D, 0xF0,
-    0x37, 0xFF, 0xC2, 0xAE, 0xA5, 0xAB, 0x30, 0xA1, 0x97, 0xFB, 0xA5, 0xF7, 0x4E, 0x19, 0x8A, 0x69,
-    0xAF, 0x90, 0x0B, 0x1B, 0xC6, 0x59, 0x82, 0xFE, 0xE7, 0x0D, 0xB4, 0x3F, 0x8F, 0xCC, 0xB0, 0x2D,
-    0x7A, 0x00, 0x83, 0x5B, 0xB5, 0x9C, 0xA1, 0x37, 0xC0, 0x50, 0xCA, 0x97, 0xA8, 0x73, 0x1B, 0x46,
-    0x99, 0x68, 0x25, 0x38, 0x65, 0x6D, 0xE0, 0xD6, 0x36, 0x3B, 0xCB, 0xDF, 0xBE, 0x64, 0x9C, 0x07,
-    0x9A, 0x20, 0xD1, 0x9C, 0x90, 0xA3, 0xBD, 0x4E, 0x25, 0x21, 0xE0, 0x16, 0x2D, 0x5A, 0x03, 0x79,
-    0xC2, 0xF9, 0xC4, 0x2D, 0x17, 0x5B, 0x5E, 0x7F, 0xA9, 0xEB, 0x17, 0x4B, 0x02, 0xC5, 0x56, 0xE4,
-    0x35, 0x04, 0x24, 0x6B, 0xF9, 0x3F, 0x29, 0x13, 0xEF, 0x7A, 0x11, 0xFD, 0xB8, 0x4E, 0xBD, 0xBA,
-    0xFE, 0xBE, 0xD9, 0x33, 0x37, 0xF8, 0x58, 0xC3, 0x7F, 0x87, 0x10, 0xFE, 0xBB, 0x2C, 0xBC, 0xB9,
-    0xDE, 0xE4, 0xFD, 0xA8, 0x43, 0x34, 0xB4, 0x55, 0x36, 0xC3, 0x3F, 0xE6, 0xB1, 0x18, 0x79, 0xE3,
-    0x8C, 0x7D, 0xE0, 0xF0, 0x9F, 0x16, 0xCB, 0x46, 0x4D, 0x41, 0xE8, 0x39, 0x1B, 0x01, 0xBA, 0x5F,
-    0x5F, 0x7B, 0x5B, 0x36, 0x81, 0x9D, 0xAA, 0x5C, 0xF7, 0x93, 0x35, 0xC1, 0xFB, 0x0B, 0x4E, 0xE5,
-    0x16, 0x67, 0x61, 0x2A, 0x2E, 0x79, 0x38, 0x8D, 0x44, 0x16, 0x9A, 0xDE, 0xC4, 0xD7, 0x9B, 0x34,
-    0x8E, 0xEC, 0xE6, 0xEB, 0x75, 0x27, 0xFD, 0xF8, 0xE3, 0xA6, 0x1F, 0x5F, 0x51, 0xA2, 0x57, 0x34,
-    0xF5, 0x6D, 0xD3, 0x61, 0xD2, 0x54, 0xFB, 0xB1, 0xB5, 0x8A, 0x14, 0xDB, 0x5B, 0x45, 0x32, 0xB6,
-    0x8A, 0x58, 0xF8, 0xFB, 0xD9, 0x6D, 0x5D, 0xE0, 0x36, 0x84, 0xA6, 0xE5, 0x41, 0x36, 0x72, 0x14,
-    0x55, 0x4D, 0x54, 0xB0, 0x5D, 0x3F, 0x50, 0x57, 0xCB, 0x6F, 0x9B, 0xE5, 0xD7, 0x43, 0x64, 0x15,
-    0x99, 0x54, 0x64, 0x4E, 0x51, 0xA4, 0x1A, 0xD1, 0x1F, 0x20, 0xEC, 0x21, 0x70, 0x6D, 0x17, 0xF7,
-    0x69, 0x81, 0xE4, 0x09, 0x6C, 0x6B, 0x3C, 0x61, 0x97, 0x9B, 0x52, 0x6C, 0x7A, 0x78, 0xC1, 0xD7,
-    0x53, 0xB7, 0x68, 0x0B, 0xDB, 0x85, 0x8C, 0xB8, 0x38, 0xA5, 0x88, 0xA0, 0x38, 0x34, 0x6E, 0x5F,
-    0xD6, 0x29, 0xB0, 0x08, 0x4A, 0x12, 0x87, 0x19, 0x84, 0x22, 0xB2, 0xF2, 0xEC, 0xF2, 0xB2, 0x71,
-    0xDE, 0xEA, 0x1B, 0xE7, 0x77, 0xB9, 0x36, 0x55, 0xD9, 0x2A, 0x01, 0x86, 0x3D, 0x66, 0x2B, 0x63,
-    0x21, 0x8B, 0x68, 0xBF, 0xFA, 0xC8, 0x8B, 0x60, 0x05, 0x9B, 0xB6, 0xAC, 0x7F, 0x9C, 0x8B, 0xE8,
-    0x89, 0x86, 0xFD, 0xDA, 0xE6, 0xA9, 0x5D, 0x17, 0xF1, 0x9E, 0xA7, 0x1C, 0xD0, 0xD9, 0xB1, 0xA7,
-    0x1C, 0xFC, 0x2D, 0x77, 0xB6, 0xDA, 0xFD, 0x94, 0x83, 0x25, 0x02, 0xE3, 0x4B, 0xEC, 0x69, 0x29,
-    0xA6, 0xA7, 0x1C, 0xDC, 0x4F, 0xA1, 0x3E, 0xB7, 0xDB, 0x29, 0x07, 0xF5, 0xB4, 0x6A, 0xCC, 0x06,
-    0xD4, 0x34, 0xDE, 0x7A, 0x98, 0xE3, 0x3D, 0x33, 0xA3, 0x7C, 0xBC, 0x60, 0xEE, 0xCE, 0x9C, 0x1E,
-    0x6C, 0x43, 0x9C, 0x5E, 0xB1, 0x47, 0xE0, 0x10, 0xD8, 0xF9, 0xD7, 0xC1, 0xFA, 0xA3, 0x26, 0xA0,
-    0xC0, 0xC3, 0x6F, 0xF8, 0x65, 0x88, 0x7B, 0x2E, 0x60, 0x0E, 0x57, 0x84, 0x5B, 0x1C, 0x9C, 0xF0,
-    0x32, 0x8F, 0xDC, 0x48, 0x3B, 0x55, 0x0C, 0x7F, 0xCF, 0x24, 0x9E, 0x7B, 0x72, 0x82, 0xE1, 0xCB,
-    0x26, 0x2F, 0xFC, 0x75, 0xEE, 0xCC, 0x28, 0xAE, 0x8B, 0xE4, 0xE2, 0xD6, 0x48, 0xC8, 0xB3, 0xE0,
-    0xF7, 0x17, 0x44, 0x6F, 0x9D, 0x0D, 0x0A, 0x74, 0xA9, 0x5F, 0x0A, 0xF2, 0x05, 0x0B, 0x95, 0x66,
-    0x10, 0x93, 0x58, 0x35, 0x8D, 0x47, 0xDA, 0x36, 0xFB, 0xE6, 0x62, 0xA1, 0x52, 0xA4, 0x50, 0x89,
-    0x20, 0x7E, 0x12, 0x88, 0xBC, 0x21, 0x1E, 0xE9, 0xF0, 0xF0, 0xC0, 0xE6, 0x60, 0xA2, 0xF9, 0xCD,
-    0xD3, 0x5F, 0x1B, 0xA7, 0x66, 0xA6, 0xC1, 0xDE, 0x22, 0x26, 0x3F, 0x7F, 0x3F, 0x88, 0x09, 0x31,
-    0x88, 0xA3, 0x82, 0x7D, 0xDF, 0x29, 0x97, 0xCC, 0x91, 0x20, 0x2F, 0x57, 0x50, 0x82, 0xD9, 0xEF,
-    0x98, 0x93, 0x61, 0x56, 0x0C, 0x39, 0xA3, 0x21, 0xA3, 0x27, 0xA8, 0x56, 0xE3, 0x93, 0x19, 0xFA,
-    0x52, 0x80, 0x05, 0x07, 0xA0, 0xC4, 0x5C, 0xA0, 0x70, 0x3A, 0xE6, 0x3F, 0xE2, 0x74, 0x0F, 0x07,
-    0xBE, 0x43, 0x7B, 0xDD, 0x13, 0x5C, 0x10, 0x57, 0xA8, 0x7F, 0x77, 0x1A, 0xC1, 0xD7, 0x43, 0x20,
-    0x82, 0x99, 0x6D, 0x5C, 0x99, 0xCA, 0xFC, 0xDC, 0xAA, 0x3D, 0x92, 0x45, 0x08, 0x19, 0x8D, 0x53,
-    0x3D, 0xC6, 0xC2, 0x9B, 0x2D, 0x67, 0x9F, 0x54, 0xB4, 0xCF, 0xFC, 0x47, 0xD6, 0x95, 0x78, 0x41,
-    0xB8, 0x06, 0x49, 0xF2, 0xCD, 0x6F, 0xD4, 0xC8, 0xE3, 0x8C, 0xDB, 0xB4, 0xD2, 0x2D, 0x33, 0x51,
-    0x90, 0xE6, 0xC6, 0xF3, 0x21, 0x38, 0xCE, 0xD3, 0x5F, 0xE8, 0xA9, 0x49, 0x8B, 0x73, 0xD3, 0xA8,
-    0x5B, 0x3B, 0x59, 0x3B, 0x9A, 0xE9, 0xC4, 0xB1, 0xF1, 0xAB, 0xE6, 0x5F, 0x9B, 0x5E, 0xDF, 0x4C,
-    0xCF, 0x88, 0x41, 0xBF, 0x09, 0x74, 0x64, 0xE6, 0x5A, 0x50, 0xC9, 0x88, 0x47, 0xF8, 0x6A, 0x0F,
-    0x09, 0xC2, 0xFF, 0x2D, 0xFE, 0xD7, 0x0B, 0x3B, 0x4E, 0x57, 0xD1, 0xE1, 0xBA, 0xB1, 0x12, 0x66,
-    0xBE, 0x32, 0x49, 0xC3, 0x1E, 0x9E, 0xB0, 0x1C, 0xD3, 0xBA, 0xA5, 0xE6, 0x5C, 0xDE, 0xDF, 0x71,
-    0x19, 0xA7, 0x78, 0x5C, 0x06, 0x0E, 0xE1, 0x89, 0x1F, 0x40, 0x68, 0x26, 0xFE, 0x32, 0xF2, 0xAB,
-    0xD1, 0x4B, 0x39, 0xAA, 0x05, 0xDE, 0xB9, 0x3E, 0x3D, 0x2E, 0x63, 0x1E, 0x67, 0x0B, 0xC8, 0x82,
-    0x78, 0xE4, 0x12, 0xC9, 0xB1, 0x9F, 0x11, 0xE2, 0x3B, 0x77, 0x3F, 0x2E, 0x63, 0xD7, 0x16, 0xB0,
-    0x1F, 0x3D, 0x59, 0x06, 0x57, 0xAF, 0xF6, 0x83, 0xAB, 0x4F, 0x15, 0xFE, 0x2F, 0xD7, 0xB5, 0x05,
-    0xEC, 0x31, 0xCC, 0x44, 0xA6, 0xB2, 0x5F, 0x26, 0xB2, 0x67, 0x7B, 0x0B, 0x98, 0x56, 0xFD, 0x6A,
-    0xD9, 0xEF, 0xB6, 0x53, 0x39, 0xB6, 0x9D, 0xA3, 0x99, 0xCF, 0x8C, 0x4F, 0xD3, 0x13, 0xAB, 0x2F,
-    0x82, 0xFD, 0x56, 0x8D, 0x9E, 0xDA, 0xD6, 0x6A, 0x46, 0xFD, 0xBF, 0xD2, 0x9C, 0x4D, 0x32, 0x9C,
-    0xF9, 0x5F, 0xF1, 0x5C, 0x4F, 0x94, 0xC1, 0x61, 0x77, 0x65, 0x6B, 0xED, 0xEE, 0xCE, 0x96, 0xE4,
-    0x6F, 0x53, 0xDC, 0x83, 0x38, 0x73, 0x3F, 0x70, 0xC3, 0x28, 0x52, 0xC5, 0xE1, 0xF5, 0xCE, 0xC4,
-    0xB8, 0x37, 0x28, 0x6C, 0x44, 0xC0, 0x88, 0x52, 0x84, 0x04, 0x56, 0x10, 0xE6, 0xB4, 0xB4, 0x75,
-    0x20, 0x38, 0x3B, 0xA0, 0x5C, 0x04, 0xEA, 0xEF, 0x77, 0x44, 0xAF, 0x47, 0xB9, 0x00, 0x31, 0x71,
-    0xC5, 0x37, 0xDA, 0xE6, 0x1B, 0x68, 0x81, 0xE6, 0xF9, 0x13, 0x1B, 0xA7, 0xA7, 0x2C, 0x3B, 0x9A,
-    0x61, 0x5F, 0x0D, 0x63, 0xB4, 0x9B, 0x23, 0x16, 0xEF, 0x83, 0x90, 0x43, 0x18, 0xFD, 0x71, 0xAF,
-    0xCF, 0xBA, 0x8E, 0xA6, 0x57, 0x06, 0x42, 0x00, 0x1B, 0xD1, 0x13, 0x7D, 0x86, 0xD2, 0x49, 0x44,
-    0x75, 0x8E, 0x23, 0x20, 0xB7, 0x10, 0x0B, 0x90, 0x39, 0x8F, 0xD4, 0x6B, 0xD2, 0xF6, 0xD1, 0x01,
-    0x03, 0x90, 0xBE, 0x91, 0x36, 0x4F, 0xE8, 0x1A, 0x8B, 0x66, 0xE4, 0xF6, 0xF7, 0x00, 0xFC, 0xB3,
-    0x7B, 0xA5, 0xD8, 0x71, 0x26, 0xC3, 0x27, 0xB3, 0x3C, 0x87, 0xEF, 0x65, 0x13, 0xB9, 0xB5, 0xE8,
-    0x36, 0xC9, 0x32, 0x6B, 0x06, 0x8E, 0xCD, 0xA6, 0xD9, 0x6F, 0x19, 0x09, 0x58, 0xC9, 0x4C, 0xAE,
-    0x61, 0x69, 0xAB, 0xC2, 0xC6, 0x69, 0xC5, 0x5C, 0x7E, 0xC3, 0x49, 0xC3, 0xE5, 0xF6, 0x93, 0x86,
-    0xC3, 0x9B, 0x9C, 0x34, 0xDC, 0xB2, 0x1A, 0x70, 0xC7, 0x49, 0xC3, 0x88, 0x77, 0x5B, 0x96, 0x35,
-    0x77, 0x34, 0xA7, 0x6B, 0x2E, 0x1A, 0x1B, 0x51, 0x4C, 0x1E, 0xB1, 0x10, 0x2E, 0x1E, 0x99, 0x69,
-    0x31, 0xF7, 0xCC, 0xC7, 0xEF, 0xF9, 0x49, 0x85, 0x87, 0x8C, 0x7A, 0x34, 0xE7, 0x2D, 0x6D, 0xDB,
-    0x8F, 0xA6, 0x4D, 0x52, 0x73, 0x97, 0xD5, 0x7E, 0x5A, 0xCE, 0x3E, 0xF8, 0xB0, 0x61, 0xCE, 0xC2,
-    0xD8, 0xE6, 0x06, 0xF1, 0x75, 0x11, 0x0A, 0x4F, 0x48, 0x85, 0x16, 0x8D, 0xD3, 0x4A, 0xE3, 0xD1,
-    0x0F, 0xB7, 0xFD, 0x57, 0xF7, 0x1E, 0x4C, 0x32, 0x04, 0x9B, 0xEC, 0x3C, 0xEC, 0x88, 0x47, 0x9E,
-    0xBA, 0x3C, 0x9C, 0x85, 0xD1, 0x60, 0x59, 0xE2, 0xD7, 0xB4, 0x18, 0xA9, 0x68, 0xB2, 0xB0, 0xEF,
-    0x2B, 0xD8, 0xC9, 0x30, 0x40, 0x2F, 0x53, 0x2C, 0x1F, 0xDB, 0x83, 0x85, 0x4A, 0x4D, 0x7E, 0x2D,
-    0x19, 0x76, 0x4D, 0xBA, 0x88, 0xFD, 0x6D, 0xAB, 0xED, 0x9C, 0x83, 0x31, 0x8C, 0xB4, 0xE7, 0x2C,
-    0xB1, 0x3E, 0xAA, 0x75, 0x51, 0x13, 0xAD, 0xF5, 0x3E, 0x78, 0x6D, 0xFD, 0x6D, 0x3A, 0x23, 0xA1,
-    0x46, 0xA3, 0xE9, 0xF2, 0x7B, 0x74, 0xB1, 0xC4, 0xCC, 0x26, 0x6A, 0x67, 0x13, 0xB5, 0x86, 0x4B,
-    0x2A, 0xDC, 0x2D, 0x95, 0xEE, 0xAE, 0xC2, 0xB0, 0xA1, 0x16, 0xAF, 0xEA, 0x79, 0x59, 0xBA, 0x78,
-    0x6A, 0x0A, 0xB9, 0xA5, 0x4E, 0x25, 0x9B, 0x39, 0xA3, 0xF4, 0xC0, 0x11, 0x0A, 0xE2, 0x1F, 0x75,
-    0xD8, 0x02, 0xD0, 0x16, 0x58, 0xF9, 0x36, 0xF2, 0xE4, 0x6E, 0x53, 0x0A, 0x6B, 0x5D, 0x90, 0xC3,
-    0xDB, 0x8E, 0xB5, 0xD5, 0xD4, 0xB5, 0xCD, 0x6C, 0x7B, 0xB3, 0x67, 0xBE, 0xCF, 0x6D, 0xA5, 0x28,
-    0xEE, 0x91, 0x99, 0x9F, 0x0B, 0x73, 0xDB, 0xA6, 0x36, 0x73, 0x44, 0x43, 0x62, 0x8F, 0x68, 0x08,
-    0x30, 0xF3, 0xFD, 0xD8, 0xBF, 0x7B, 0x60, 0x6B, 0x70, 0x6C, 0xFA, 0x81, 0xB3, 0x32, 0xBC, 0x8D,
-    0xA0, 0x84, 0xB0, 0xDD, 0xF8, 0x52, 0x4F, 0x9B, 0x02, 0xCD, 0xDE, 0xA2, 0x01, 0x66, 0x04, 0x1A,
-    0xE1, 0xC4, 0x1F, 0x5A, 0x98, 0xF2, 0xD5, 0xA7, 0x21, 0x22, 0xA7, 0x2E, 0x82, 0xE5, 0xB5, 0xA6,
-    0xDE, 0x8A, 0x74, 0x3E, 0xC5, 0xC7, 0xE9, 0x61, 0x40, 0x0D, 0xC3, 0x99, 0xF1, 0xA3, 0x95, 0xE6,
-    0x8B, 0x32, 0xED, 0x22, 0xDC, 0x97, 0x05, 0xEC, 0x80, 0x19, 0x02, 0x4D, 0x56, 0x0A, 0x23, 0x2D,
-    0x37, 0xB9, 0x3C, 0x04, 0x6F, 0x6B, 0x6D, 0x84, 0x61, 0x38, 0x09, 0xD5, 0x4D, 0x01, 0xD5, 0x40,
-    0xCF, 0xAE, 0x99, 0x86, 0xEA, 0x9A, 0xFA, 0xE1, 0x5C, 0x14, 0x35, 0xAB, 0xEE, 0x59, 0x32, 0x07,
-    0xD0, 0xFC, 0x5D, 0x3A, 0x2C, 0xD9, 0xA7, 0x87, 0x6C, 0x7E, 0x53, 0x34, 0x50, 0xCE, 0x26, 0x87,
-    0xBC, 0x6D, 0x27, 0xA3, 0xED, 0xE6, 0x05, 0x7F, 0x0C, 0x81, 0xCC, 0xE6, 0x40, 0xBD, 0x19, 0x7C,
-    0x79, 0xB9, 0xE1, 0xF2, 0x86, 0xC7, 0x3F, 0x39, 0xFC, 0xAD, 0xCA, 0x78, 0x34, 0x95, 0x3B, 0xCD,
-    0x9F, 0x31, 0x64, 0x61, 0x5D, 0x15, 0x6F, 0x2A, 0x86, 0xC0, 0xDF, 0x80, 0xDF, 0x40, 0xDF, 0xE0,
-    0x15, 0xB0, 0x0A, 0xA0, 0x37, 0xA8, 0x00, 0xE0, 0x0D, 0xDC, 0x0D, 0xD8, 0xED, 0x3C, 0xBF, 0x2D,
-    0x83, 0x2D, 0x9E, 0x48, 0xBB, 0x90, 0x3D, 0x61, 0xB4, 0x90, 0x5E, 0x6C, 0x68, 0xE9, 0x71, 0xCF,
-    0x0C, 0x7C, 0xD0, 0x03, 0x45, 0xFB, 0x3C, 0x50, 0x14, 0xFB, 0x87, 0x34, 0x12, 0x4E, 0xED, 0xE3,
-    0x81, 0xA2, 0x40, 0x24, 0xB2, 0xB4, 0x7F, 0x8E, 0xA2, 0x13, 0x71, 0x89, 0xFE, 0x07, 0x18, 0x48,
-    0x58, 0xFA, 0xEF, 0x78, 0xCD, 0x3C, 0xF4, 0x29, 0xED, 0x17, 0xB8, 0xF8, 0x50, 0xC1, 0x03, 0x45,
-    0x79, 0xDA, 0x35, 0x0E, 0x14, 0xD5, 0x83, 0x44, 0xF3, 0x93, 0x3C, 0x48, 0x34, 0x28, 0xA8, 0x37,
-    0xCE, 0xF9, 0x05, 0xFB, 0x5B, 0xCF, 0xFA, 0x7F, 0x97, 0x23, 0x37, 0x7D, 0xC9, 0xFB, 0x25, 0x9D,
-    0x61, 0x1C, 0x28, 0x0A, 0xC5, 0xD7, 0x17, 0x07, 0x75, 0x85, 0x07, 0x8A, 0x56, 0x3C, 0x0E, 0x96,
-    0x16, 0xE7, 0x94, 0xEC, 0x11, 0x0E, 0x14, 0x1D, 0x6C, 0x2F, 0xAE, 0x69, 0xB2, 0x8D, 0xCD, 0xD9,
-    0x69, 0xB6, 0x10, 0x65, 0x52, 0xC5, 0xBB, 0x38, 0xAB, 0xC3, 0xF4, 0x70, 0x98, 0x7D, 0xB5, 0x86,
-    0xD2, 0xEC, 0xE1, 0x30, 0xB5, 0x1E, 0x32, 0x51, 0x1B, 0x1C, 0x0E, 0xE3, 0xBE, 0x96, 0x86, 0xC8,
-    0xE1, 0x3D, 0x9B, 0x1D, 0xC3, 0x93, 0xBF, 0x9A, 0x9D, 0x45, 0x2C, 0x53, 0x4C, 0x16, 0x1A, 0xA5,
-    0xC2, 0xAB, 0x38, 0x1C, 0xE6, 0x9E, 0xE0, 0xE5, 0x07, 0x70, 0x34, 0xB7, 0xFF, 0xB7, 0x22, 0xA0,
-    0x07, 0xCE, 0xA2, 0x8B, 0x55, 0xD4, 0x1B, 0x4A, 0x04, 0x45, 0xC1, 0x89, 0x7B, 0x30, 0x46, 0x0D,
-    0x47, 0x6E, 0x2C, 0x8A, 0x39, 0x98, 0xCD, 0x3A, 0x50, 0x47, 0xB6, 0x4D, 0xAA, 0x33, 0xDB, 0xB7,
-    0xF0, 0xB1, 0x21, 0xA9, 0x55, 0x97, 0x7C, 0x0E, 0x33, 0xEC, 0xB1, 0xBF, 0xD4, 0x51, 0x57, 0xF9,
-    0x73, 0xDB, 0x6A, 0xBA, 0xD2, 0xE9, 0x21, 0x0D, 0x5A, 0x6F, 0xCE, 0xF7, 0xBA, 0xAF, 0xD1, 0x54,
-    0xBD, 0xCC, 0xA0, 0xB5, 0x9E, 0x78, 0xEB, 0xEB, 0x01, 0xE6, 0xB8, 0xC5, 0x59, 0x6F, 0x7A, 0x80,
-    0x39, 0x8F, 0xF1, 0xF4, 0xB6, 0x1D, 0x60, 0xEE, 0xCC, 0x1C, 0x60, 0x8E, 0x69, 0xE9, 0x01, 0xE6,
-    0x7D, 0x7B, 0x80, 0xF9, 0xDC, 0x38, 0xD5, 0x03, 0xCC, 0x3F, 0xC3, 0x33, 0x8B, 0x2E, 0x98, 0xE4,
-    0x19, 0x91, 0xA9, 0xE9, 0x99, 0x45, 0x90, 0xA8, 0xBB, 0x04, 0x02, 0xB1, 0xE8, 0x12, 0xFD, 0x83,
-    0x08, 0xB7, 0x21, 0xF9, 0xAF, 0xC7, 0xC8, 0x85, 0xE2, 0xD8, 0xE1, 0x30, 0x93, 0x28, 0xC3, 0x21,
-    0xBE, 0x1D, 0x41, 0x58, 0x5D, 0xF3, 0xA6, 0x69, 0x79, 0xCB, 0x26, 0xF9, 0x41, 0xFC, 0xEB, 0xA8,
-    0x0A, 0x07, 0x26, 0x65, 0xB9, 0xFE, 0x85, 0x2F, 0x50, 0x6D, 0x27, 0x44, 0x38, 0x34, 0xAB, 0xAB,
-    0x87, 0x6E, 0xA8, 0x68, 0xFB, 0xE4, 0x56, 0x6F, 0x0E, 0xCD, 0x9C, 0x5C, 0x70, 0xD7, 0xCC, 0xC9,
-    0x05, 0xB7, 0x66, 0xF5, 0xFA, 0xE7, 0x1C, 0xD0, 0x74, 0x76, 0x8D, 0x65, 0xEC, 0xC2, 0xD8, 0x44,
-    0xB8, 0x41, 0x9C, 0xB2, 0xEE, 0xE1, 0x70, 0xA2, 0x85, 0x5C, 0x08, 0x04, 0xE1, 0xD9, 0x4A, 0x21,
-    0x59, 0x50, 0xCB, 0x2A, 0xEA, 0xAE, 0xD5, 0xD4, 0xE3, 0xB5, 0x0B, 0xD4, 0x14, 0x7A, 0xBB, 0xB3,
-    0xD6, 0x1C, 0xBE, 0xFD, 0x35, 0x05, 0x5F, 0xB5, 0x8A, 0xA5, 0x3D, 0x24, 0x5D, 0x23, 0x7D, 0xD4,
-    0xB5, 0x42, 0xA9, 0xFD, 0x58, 0xBB, 0x2C, 0xF0, 0x30, 0x6A, 0xED, 0x85, 0x83, 0x17, 0x18, 0xE3,
-    0x7A, 0x55, 0x90, 0x59, 0x6F, 0x8C, 0x4E, 0x1E, 0x84, 0xD0, 0x37, 0x1D, 0x71, 0x58, 0x36, 0x1E,
-    0x7B, 0xF6, 0xD9, 0xBE, 0x3B, 0x70, 0x47, 0xF0, 0x3F, 0x9D, 0x8A, 0x6B, 0x16, 0xF2, 0xC6, 0x29,
-    0x9A, 0x87, 0x12, 0x1E, 0x75, 0x27, 0xAB, 0x7E, 0x71, 0x8C, 0xDC, 0x47, 0x8D, 0xA4, 0x07, 0x62,
-    0x3D, 0x5D, 0x86, 0x09, 0xBB, 0xDC, 0xBC, 0xAE, 0x59, 0x66, 0xDB, 0xDC, 0xCB, 0x7D, 0x3F, 0x8D,
-    0xAF, 0x3F, 0x38, 0xDE, 0x40, 0x44, 0x1B, 0xB9, 0x81, 0x94, 0xCD, 0xAA, 0x60, 0x34, 0xD1, 0x2F,
-    0x48, 0xE6, 0x3C, 0x03, 0x41, 0x1A, 0x9B, 0x19, 0x66, 0xD3, 0xE3, 0xD4, 0x23, 0x5A, 0x63, 0x7B,
-    0x9C, 0xFA, 0xC2, 0x4D, 0xEA, 0x63, 0x76, 0x39, 0x4E, 0xFD, 0x86, 0x42, 0x9E, 0xD9, 0xE3, 0xD4,
-    0x0F, 0x6E, 0x9E, 0x6E, 0xA7, 0x3D, 0xE0, 0xC0, 0x43, 0x26, 0x33, 0x1D, 0xD1, 0xEE, 0x1B, 0x8F,
-    0x6A, 0xCF, 0xF5, 0x04, 0x47, 0x23, 0x56, 0x20, 0x7E, 0x9B, 0xE8, 0xF2, 0x0C, 0x5E, 0x1B, 0x5A,
-    0x63, 0xE3, 0x34, 0x49, 0xE1, 0xB2, 0xB5, 0xFC, 0x01, 0xBB, 0x89, 0xBA, 0xE9, 0x4D, 0xA2, 0xEF,
-    0x77, 0x4D, 0xCB, 0xD8, 0x07, 0x34, 0xE0, 0x6C, 0x62, 0xCF, 0x45, 0xB2, 0x82, 0x7E, 0x03, 0x59,
-    0xB4, 0x16, 0xAE, 0x9A, 0x1D, 0x9C, 0x47, 0xF0, 0x7E, 0x79, 0x4B, 0xEF, 0xAF, 0x84, 0xD3, 0x90,
-    0x2C, 0x47, 0x2D, 0x7F, 0x41, 0x2F, 0x36, 0x61, 0x7D, 0xBA, 0x3D, 0x7D, 0x6F, 0xA8, 0x1D, 0x03,
-    0xE1, 0x1B, 0x22, 0x21, 0x2E, 0xFF, 0xE4, 0x0A, 0x93, 0x06, 0xCB, 0x7D, 0xF9, 0x4A, 0xEC, 0x7D,
-    0xD6, 0x16, 0x8F, 0x8D, 0x71, 0x8F, 0xA9, 0xB2, 0x9A, 0x17, 0xDC, 0x34, 0x5E, 0xCF, 0x83, 0x7E,
-    0x8C, 0xA5, 0xF0, 0x14, 0x87, 0x96, 0x68, 0xBD, 0x16, 0x30, 0x90, 0x18, 0x0A, 0xEE, 0x00, 0x97,
-    0xFF, 0x67, 0xFB, 0xE8, 0xA7, 0x20, 0x73, 0x0F, 0xC3, 0x70, 0xEF, 0x5E, 0xB3, 0xAD, 0x2C, 0xFF,
-    0x76, 0xAE, 0xE7, 0x8B, 0x22, 0x8F, 0x2D, 0x91, 0xC5, 0xD6, 0x0E, 0x79, 0xBC, 0x25, 0xEB, 0xB4,
-    0x2B, 0x35, 0xCD, 0x6A, 0xF5, 0x13, 0xFB, 0xA3, 0xED, 0xAB, 0xFE, 0xFF, 0xC6, 0xAB, 0xFD, 0xE2,
-    0x9C, 0xAE, 0xAF, 0x6B, 0x13, 0x8E, 0xCD, 0xF5, 0xBE, 0xB9, 0xDD, 0x16, 0xFB, 0x69, 0xF1, 0x6A,
-    0xDD, 0xEC, 0xCF, 0x0C, 0x4F, 0x2F, 0x14, 0xE4, 0x87, 0x70, 0x50, 0xFA, 0xF8, 0xF6, 0x2D, 0xB9,
-    0x9D, 0x7F, 0x50, 0x00, 0x14, 0x04, 0xD5, 0xB0, 0x92, 0x59, 0xAA, 0xDD, 0x82, 0x53, 0x07, 0x21,
-    0x57, 0x68, 0xED, 0x16, 0xDA, 0xB5, 0xD6, 0x7A, 0x70, 0xA1, 0xCF, 0xC9, 0xF7, 0xD5, 0x44, 0xA4,
-    0x4D, 0xD9, 0xD0, 0xA0, 0xC1, 0x57, 0x21, 0xA4, 0x64, 0x1F, 0xBD, 0x69, 0x7F, 0x76, 0x11, 0x04,
-    0xB0, 0x87, 0x26, 0xC5, 0x58, 0x5D, 0xA6, 0x5F, 0xB9, 0x92, 0x37, 0xA6, 0x2B, 0x49, 0x35, 0xE0,
-    0x9E, 0xC1, 0x26, 0x65, 0x26, 0xC6, 0xD3, 0x16, 0x80, 0xC6, 0x4F, 0x68, 0x6E, 0x21, 0x6F, 0x1C,
-    0x82, 0x85, 0xC6, 0x5D, 0xF0, 0x5E, 0x27, 0x87, 0xA6, 0x93, 0xA4, 0x5E, 0x39, 0x01, 0xD0, 0x3B,
-    0xFE, 0xA0, 0xD4, 0x40, 0xF4, 0x20, 0x6B, 0x52, 0x7D, 0xB0, 0xA1, 0x30, 0x72, 0xFC, 0xC6, 0x06,
-    0x52, 0x44, 0xCA, 0xF5, 0xA7, 0x19, 0x78, 0x6B, 0x12, 0x2A, 0xFA, 0xD5, 0xAE, 0x05, 0xD6, 0x9F,
-    0x86, 0x3F, 0x76, 0xB0, 0xF7, 0xF4, 0x29, 0x83, 0x39, 0xED, 0xE5, 0x39, 0xDF, 0x1F, 0xB5, 0x46,
-    0xBA, 0x09, 0xD0, 0x5E, 0xD8, 0xA7, 0xCE, 0x47, 0x32, 0x73, 0x31, 0xA7, 0x3E, 0x73, 0x83, 0xF4,
-    0x7D, 0x0A, 0x09, 0xB2, 0x4F, 0x14, 0x3E, 0x5A, 0xAF, 0x71, 0xC8, 0xD4, 0x5E, 0xB3, 0x3A, 0xE3,
-    0x23, 0xDE, 0x02, 0xC2, 0x40, 0xD9, 0x53, 0xD3, 0xEB, 0x30, 0xAB, 0xEF, 0xDF, 0x7F, 0x4B, 0x6E,
-    0x66, 0xFF, 0x34, 0xC0, 0x06, 0x8F, 0xA8, 0x65, 0xC1, 0xD6, 0x87, 0x68, 0xC9, 0xC5, 0x09, 0x56,
-    0x38, 0x7F, 0x0C, 0xAF, 0x43, 0x33, 0x91, 0x3E, 0x1E, 0x0B, 0xB9, 0x3E, 0x6D, 0xD5, 0xCD, 0x6C,
-    0xAB, 0xAE, 0xA8, 0x11, 0x3D, 0x6E, 0xD5, 0x2B, 0xF5, 0x85, 0x56, 0xDD, 0x70, 0xDA, 0xAA, 0xFB,
-    0xED, 0xE1, 0x0E, 0x58, 0xF0, 0x81, 0x96, 0x73, 0x6D, 0x6D, 0x6D, 0x8C, 0xB0, 0xD5, 0x87, 0x5E,
-    0xCE, 0x4D, 0xA6, 0xDD, 0x16, 0xEB, 0xDC, 0x5B, 0xBB, 0xF8, 0x3E, 0xA6, 0x7D, 0xEB, 0xB6, 0xE7,
-    0x23, 0xAF, 0xE7, 0x43, 0x6C, 0xCF, 0xFB, 0x5E, 0xE7, 0xFB, 0xB1, 0x35, 0xB7, 0xEB, 0x00, 0xEA,
-    0x77, 0xB5, 0x35, 0x1F, 0xFD, 0xFC, 0x3A, 0xE3, 0x9C, 0x7E, 0x18, 0xBE, 0xC2, 0xC8, 0x7E, 0xA6,
-    0x71, 0x97, 0xDB, 0xFB, 0xE7, 0x13, 0xF6, 0x9E, 0x7E, 0x58, 0x3B, 0x30, 0x1A, 0x05, 0x2B, 0x9A,
-    0x64, 0x55, 0x60, 0x52, 0x5C, 0x3A, 0x23, 0x2D, 0x6D, 0x97, 0x07, 0x2F, 0xE2, 0xC1, 0x8B, 0x6A,
-    0x98, 0xE5, 0x3B, 0xE7, 0xA0, 0x9D, 0x2E, 0x81, 0x80, 0xA5, 0xCD, 0xF8, 0xB3, 0xC6, 0x30, 0x7C,
-    0x1A, 0xCF, 0x44, 0xD2, 0x9F, 0xFD, 0x85, 0x34, 0x88, 0x74, 0x09, 0xA7, 0xA6, 0x6C, 0xB1, 0xB1,
-    0x50, 0xB0, 0xFB, 0xFF, 0x09, 0x64, 0x68, 0xEB, 0x49, 0x98, 0xAB, 0x5F, 0x34, 0xFC, 0x1B, 0x91,
-    0x3A, 0x38, 0xD9, 0x6C, 0x9E, 0xE9, 0x76, 0x93, 0x84, 0x7F, 0x34, 0x32, 0xE6, 0x39, 0x58, 0x18,
-    0xF6, 0x3A, 0xB3, 0x0D, 0xA4, 0x9F, 0x00, 0x71, 0x04, 0x29, 0xC8, 0xCE, 0x44, 0x68, 0xC2, 0x67,
-    0x77, 0x3B, 0xCE, 0x36, 0x75, 0x8B, 0x73, 0x33, 0x07, 0x0E, 0xDD, 0x6E, 0x0A, 0x99, 0xCF, 0x11,
-    0xBC, 0x74, 0xC1, 0xDA, 0xA8, 0x57, 0x43, 0x7D, 0x11, 0x26, 0x1E, 0x32, 0xF8, 0xB4, 0xC7, 0xD9,
-    0x4E, 0x2D, 0x25, 0x97, 0xD2, 0x4B, 0x09, 0x66, 0x29, 0xA6, 0x24, 0x53, 0x9A, 0x29, 0xD1, 0x94,
-    0x6A, 0xB6, 0x8A, 0x84, 0x74, 0x53, 0xC2, 0x29, 0xE5, 0x94, 0x74, 0x4A, 0x3B, 0x1B, 0xA8, 0xD4,
-    0x28, 0x57, 0x38, 0x13, 0x44, 0xD2, 0x72, 0x13, 0xFC, 0x90, 0x24, 0x6C, 0x68, 0x48, 0x0E, 0xA3,
-    0xDE, 0xC1, 0x5B, 0x59, 0x1A, 0x99, 0xDD, 0xB7, 0xDD, 0xD6, 0x7F, 0xC2, 0x7F, 0x86, 0x62, 0x2E,
-    0x15, 0xBB, 0xFE, 0xD2, 0x80, 0xB6, 0x7D, 0x6E, 0xC6, 0xAE, 0xDF, 0x82, 0x23, 0x57, 0x3F, 0x60,
-    0xAF, 0xCB, 0x47, 0xE8, 0x24, 0x62, 0xB5, 0x89, 0x3F, 0x69, 0x2E, 0xF0, 0xB2, 0x26, 0x66, 0x3B,
-    0xA9, 0x31, 0xB9, 0x69, 0x9B, 0xCB, 0xCD, 0x0E, 0x12, 0xFC, 0xA9, 0x4C, 0x6A, 0x68, 0x03, 0xB4,
-    0x27, 0xED, 0xAB, 0xE9, 0x2C, 0xCB, 0x59, 0x81, 0x33, 0x11, 0x5E, 0x63, 0xC5, 0xC5, 0xD8, 0xF3,
-    0xEC, 0xE8, 0x37, 0x64, 0xBB, 0x38, 0x57, 0xBF, 0x2F, 0x7F, 0xE1, 0xC1, 0xFA, 0x8C, 0xEA, 0x29,
-    0xAA, 0xFF, 0xB6, 0xD3, 0x5B, 0xBC, 0x3D, 0x47, 0xBF, 0xDE, 0xB6, 0xF6, 0xAE, 0x99, 0x9C, 0x3A,
-    0xCF, 0x08, 0x79, 0x36, 0xB3, 0x67, 0x1F, 0x9B, 0xE7, 0xCD, 0x47, 0x68, 0xFE, 0x7A, 0xDD, 0x32,
-    0xD1, 0x31, 0xEB, 0x57, 0x09, 0x13, 0x1D, 0x45, 0x19, 0x53, 0x9F, 0x81, 0xF0, 0x4F, 0x41, 0x79,
-    0x5B, 0x38, 0x73, 0x08, 0x03, 0xD3, 0x33, 0xFB, 0x3B, 0xD3, 0xC7, 0xE0, 0xD0, 0x83, 0x5B, 0x5A,
-    0xD8, 0x36, 0x9A, 0x94, 0x4C, 0x1C, 0x6B, 0x3C, 0xCD, 0xA3, 0x3C, 0xB5, 0x0B, 0x2B, 0xD9, 0x97,
-    0x7D, 0x18, 0x7A, 0xE0, 0xB1, 0x47, 0xD7, 0xB7, 0x5E, 0xB0, 0x01, 0xC4, 0x0F, 0x4F, 0x8F, 0xD1,
-    0x7B, 0xAD, 0xF5, 0x91, 0xF1, 0xC3, 0x08, 0xB4, 0x8E, 0xDF, 0x77, 0x11, 0xDF, 0xFF, 0x03, 0xCD,
-    0x9A, 0xBF, 0x8F, 0xDC, 0xD6, 0x11, 0xC7, 0xBF, 0x24, 0x57, 0x47, 0xC7, 0x74, 0x8E, 0x5B, 0x28,
-    0xB0, 0x02, 0x5B, 0xA2, 0xE3, 0xA8, 0x10, 0x0C, 0x49, 0x9B, 0xC2, 0x85, 0x1C, 0xDC, 0x85, 0x54,
-    0x5C, 0xA4, 0x8C, 0x0A, 0x05, 0x2E, 0x5C, 0xC4, 0xA5, 0x90, 0x18, 0x39, 0x15, 0x2A, 0x0E, 0x46,
-    0xB4, 0xCB, 0x20, 0xA5, 0x0A, 0x29, 0xC8, 0x1F, 0xE0, 0x2B, 0xAE, 0xB0, 0x83, 0x20, 0xBE, 0xE2,
-    0x0A, 0x23, 0xB8, 0xBD, 0x65, 0x9F, 0x22, 0xDB, 0xC4, 0x65, 0x4C, 0x18, 0x81, 0x03, 0xE4, 0x00,
-    0x1F, 0x8B, 0x0D, 0xB0, 0x92, 0xB8, 0xCB, 0xCC, 0x77, 0x1E, 0x7F, 0xEC, 0xC9, 0x4E, 0x90, 0x62,
-    0x77, 0xC5, 0xC3, 0x71, 0xA4, 0xE5, 0x71, 0xDF, 0x9B, 0xF9, 0x70, 0xDE, 0xCC, 0xBC, 0x21, 0x01,
-    0xF8, 0x11, 0xE4, 0x27, 0x8C, 0x29, 0x07, 0x2A, 0x8B, 0x44, 0x84, 0xFD, 0x39, 0xA5, 0xF3, 0x17,
-    0x4A, 0xCF, 0x1B, 0x8B, 0xBC, 0xE4, 0x52, 0x6E, 0xB9, 0xA9, 0xC8, 0x7B, 0x0E, 0x65, 0xE6, 0x64,
-    0x72, 0xE1, 0x98, 0xD2, 0xF9, 0xDB, 0x3B, 0x22, 0xFD, 0xA2, 0x98, 0xC8, 0x85, 0xB0, 0x44, 0x6E,
-    0xC1, 0x9A, 0x02, 0x87, 0x40, 0x2E, 0x17, 0x52, 0xF2, 0x2B, 0x39, 0x5E, 0x99, 0x60, 0x63, 0x1E,
-    0x8D, 0xE6, 0x08, 0x75, 0x9A, 0x85, 0x9F, 0x6D, 0x95, 0x23, 0x95, 0x7D, 0x95, 0xE7, 0x29, 0xDC,
-    0xC7, 0xE7, 0x31, 0x78, 0x77, 0x62, 0x4D, 0x9C, 0xCC, 0x4D, 0x9D, 0xCC, 0x4F, 0x9C, 0x34, 0x88,
-    0xDC, 0x71, 0x08, 0x4F, 0x0E, 0x3F, 0xE9, 0xCB, 0x31, 0x44, 0x10, 0x0F, 0x11, 0x46, 0x47, 0x18,
-    0x44, 0x43, 0x9C, 0xA2, 0xEF, 0xEC, 0x20, 0xFC, 0x53, 0xEF, 0xAB, 0x60, 0xEA, 0x4F, 0x10, 0x59,
-    0x66, 0xF8, 0x23, 0x39, 0x66, 0x50, 0x75, 0xD0, 0xD5, 0x33, 0x1B, 0xFB, 0x94, 0x3D, 0x9E, 0xC0,
-    0xE5, 0x6B, 0x8D, 0x0E, 0xEE, 0x84, 0xD2, 0x53, 0x2E, 0xDE, 0x82, 0x82, 0xCF, 0x95, 0xD4, 0x28,
-    0x82, 0x73, 0x92, 0xC0, 0xB2, 0x65, 0x68, 0x37, 0x31, 0x84, 0x0E, 0xE4, 0xD8, 0x33, 0xBA, 0x2D,
-    0x8B, 0xD2, 0x77, 0x55, 0xFE, 0x9A, 0x74, 0x62, 0xD1, 0x05, 0xC1, 0x17, 0x34, 0xFA, 0x3E, 0x89,
-    0xD8, 0xE9, 0x16, 0x25, 0x3A, 0x2D, 0x21, 0x02, 0x9B, 0xB6, 0x93, 0xC5, 0xF0, 0x92, 0x7C, 0x28,
-    0x2E, 0xCB, 0x64, 0x7F, 0x15, 0x85, 0xAE, 0xD9, 0x09, 0xEF, 0x70, 0x84, 0x86, 0x0C, 0xD1, 0x80,
-    0x6C, 0x40, 0x38, 0x20, 0x1D, 0x10, 0x0F, 0xC8, 0x07, 0x04, 0x04, 0x12, 0x02, 0x11, 0x81, 0x8C,
-    0x40, 0x48, 0x20, 0x25, 0xC5, 0xA4, 0x9C, 0xA0, 0xA0, 0x4A, 0x52, 0x97, 0x75, 0xEC, 0x2D, 0x43,
-    0x61, 0x83, 0xA6, 0xDB, 0x01, 0xCD, 0x6A, 0x23, 0x2A, 0x3B, 0xE6, 0xD7, 0x39, 0xD0, 0x10, 0x78,
-    0xBD, 0x30, 0x98, 0x48, 0xA9, 0x82, 0xB4, 0x24, 0xE7, 0x51, 0x95, 0x71, 0x6E, 0x57, 0x3F, 0xDC,
-    0xA0, 0x0B, 0xFD, 0x36, 0x55, 0x17, 0x42, 0x6B, 0x5D, 0x48, 0x7F, 0x06, 0x54, 0xE1, 0x6D, 0xCE,
-    0xED, 0xCA, 0xFF, 0x86, 0xDB, 0x74, 0xA6, 0xEE, 0x3A, 0x9D, 0x49, 0x56, 0x1D, 0x67, 0x1F, 0x7C,
-    0x46, 0x95, 0x3E, 0x93, 0x1B, 0x04, 0x2B, 0xBE, 0xA3, 0x11, 0x4A, 0x81, 0xB4, 0xD6, 0xB1, 0x60,
-    0xED, 0xBD, 0x04, 0x6F, 0xBE, 0x8B, 0x6F, 0xF7, 0x32, 0x74, 0x2C, 0xC2, 0x23, 0xBB, 0x55, 0x39,
-    0x98, 0xA5, 0x83, 0xF9, 0x4A, 0x23, 0x64, 0x70, 0xC2, 0xF4, 0x53, 0x5A, 0x3A, 0xBE, 0xCA, 0x3F,
-    0xB6, 0xCC, 0xA9, 0xFE, 0x67, 0x4E, 0x53, 0x29, 0x9C, 0x1C, 0xB2, 0x7A, 0x10, 0xAF, 0x62, 0x31,
-    0xE2, 0x47, 0xB4, 0xBD, 0x9C, 0xD6, 0x4C, 0x8A, 0xEF, 0xA8, 0xBC, 0xAF, 0x52, 0xF9, 0xFD, 0xF8,
-    0x37, 0x94, 0xE3, 0x4D, 0xCA, 0x27, 0x47, 0x4A, 0x4B, 0x73, 0xDF, 0x46, 0xD4, 0x12, 0x96, 0x96,
-    0x84, 0x78, 0x47, 0x86, 0xF5, 0x81, 0xCE, 0xF9, 0x2E, 0x36, 0xE5, 0x4A, 0xEF, 0x74, 0x2C, 0x3E,
-    0x16, 0x55, 0x49, 0x7C, 0x49, 0xBC, 0x0C, 0xA1, 0xEB, 0x68, 0x72, 0x7E, 0xDB, 0xD9, 0x58, 0x8F,
-    0xCA, 0xBB, 0x28, 0xF1, 0xB6, 0x73, 0x61, 0x95, 0x6C, 0xCC, 0xBA, 0xF3, 0x26, 0x75, 0x5C, 0x87,
-    0xA5, 0xDE, 0xF3, 0xF6, 0xCD, 0x96, 0x7B, 0x0F, 0x8B, 0x99, 0x5F, 0xCA, 0xA4, 0x8E, 0xFC, 0x3F,
-    0x10, 0x4A, 0x57, 0x56, 0x49, 0xA9, 0x8C, 0xE1, 0x5F, 0xD2, 0xA4, 0x2F, 0x19, 0xC3, 0x61, 0x62,
-    0xB8, 0xF9, 0x6B, 0x8B, 0xFD, 0x68, 0xFF, 0x5B, 0x70, 0x8B, 0xF7, 0xB1, 0x19, 0x4C, 0x34, 0x86,
-    0x77, 0xB0, 0x4A, 0x4A, 0xF1, 0x06, 0x65, 0xAA, 0x34, 0xE6, 0x79, 0x13, 0xC9, 0x2D, 0xB4, 0x2A,
-    0x7A, 0x77, 0x17, 0x22, 0xE5, 0x5C, 0xE5, 0xB0, 0x39, 0x7F, 0x01, 0xEF, 0xE1, 0xA2, 0x35, 0x86,
-    0x7F, 0x9A, 0xC0, 0xE5, 0x5F, 0x6F, 0x2D, 0x8F, 0x90, 0x4C, 0x40, 0x25, 0x6D, 0x39, 0xAC, 0x49,
-    0xA9, 0x4C, 0x58, 0x14, 0x33, 0x04, 0x4F, 0xFE, 0x30, 0x83, 0xD8, 0xB5, 0x65, 0x84, 0xD8, 0x7C,
-    0x83, 0xE5, 0x46, 0x97, 0x95, 0x06, 0x16, 0x44, 0xF0, 0xAF, 0x8F, 0x65, 0x4F, 0x23, 0x5F, 0x90,
-    0x4A, 0x04, 0xA5, 0xE8, 0xD7, 0xC6, 0xA8, 0x15, 0x39, 0xAC, 0x84, 0xD6, 0x27, 0x32, 0x93, 0x17,
-    0xBF, 0xFC, 0xF8, 0x67, 0x83, 0x68, 0x54, 0x14, 0x45, 0x39, 0x9B, 0xDE, 0x09, 0x4F, 0xC7, 0x1B,
-    0x57, 0x83, 0x9A, 0x73, 0xA2, 0x53, 0x7F, 0x14, 0xD9, 0x59, 0x10, 0xBB, 0x63, 0x3F, 0xF1, 0x93,
-    0x20, 0xEE, 0x45, 0x61, 0x14, 0xE2, 0x18, 0x7D, 0xD9, 0x32, 0x8D, 0x0A, 0xA9, 0x76, 0x4C, 0x09,
-    0xA0, 0x47, 0x5F, 0x3C, 0x29, 0xC4, 0x55, 0x51, 0x68, 0x22, 0xFE, 0x35, 0xD6, 0x10, 0xCB, 0x71,
-    0x78, 0xE7, 0x38, 0x32, 0xA7, 0x30, 0x77, 0xDD, 0xFA, 0x98, 0xF0, 0x4E, 0xE5, 0xBB, 0xE7, 0x5C,
-    0xDE, 0x6E, 0x2F, 0x2E, 0xA9, 0x5B, 0x54, 0xC0, 0x4A, 0xD6, 0x8D, 0xC1, 0x96, 0x6F, 0x79, 0x9F,
-    0xC8, 0x4A, 0xA0, 0x22, 0x12, 0x37, 0x2C, 0xF9, 0xCC, 0x32, 0xD0, 0x8A, 0x8D, 0x22, 0x4B, 0x00,
-    0x51, 0x06, 0xD5, 0x5E, 0x26, 0xE1, 0xF4, 0xCF, 0x73, 0x71, 0xC6, 0xF1, 0x80, 0xB6, 0x9E, 0x5B,
-    0xB7, 0xA9, 0x9C, 0x30, 0x4C, 0xDF, 0xC4, 0xD3, 0x79, 0x66, 0x25, 0x23, 0x19, 0xAD, 0xB3, 0x44,
-    0x13, 0x61, 0x72, 0x14, 0x74, 0x95, 0xDE, 0xF1, 0xF9, 0xB9, 0xB8, 0xC2, 0xCF, 0x9F, 0xD3, 0xF6,
-    0x4B, 0x8C, 0xCA, 0xB2, 0x8F, 0xAA, 0xC3, 0xA0, 0x1A, 0x6D, 0xAC, 0x36, 0x16, 0x97, 0x52, 0x0D,
-    0x37, 0x96, 0x1B, 0x83, 0xCF, 0x48, 0xB5, 0xDE, 0x98, 0x6F, 0x4C, 0x2F, 0x65, 0x7F, 0x61, 0x05,
-    0x9B, 0xB5, 0xAB, 0x10, 0x94, 0x02, 0x14, 0x03, 0x94, 0x03, 0x6A, 0xD7, 0xB7, 0x1F, 0x95, 0xBE,
-    0x77, 0x74, 0x4D, 0xA6, 0x9E, 0xBF, 0x26, 0x33, 0x3C, 0x64, 0x09, 0xE7, 0x9C, 0xD9, 0x01, 0x90,
-    0x0C, 0xD1, 0x80, 0x6C, 0x40, 0x38, 0x20, 0x1D, 0x10, 0x0F, 0xC8, 0x47, 0x01, 0x29, 0x21, 0x45,
-    0x64, 0x26, 0x1F, 0xA2, 0xA4, 0xA4, 0x98, 0x94, 0x93, 0x01, 0x65, 0x48, 0xD9, 0xBC, 0x90, 0x75,
-    0x8E, 0x04, 0x26, 0x26, 0x8D, 0xEF, 0x15, 0x15, 0x26, 0xA5, 0x54, 0x43, 0x5A, 0x97, 0x5F, 0x30,
-    0x37, 0xE9, 0xED, 0x49, 0x25, 0x61, 0x7D, 0x7F, 0x6E, 0x48, 0x10, 0x44, 0xC5, 0x61, 0x49, 0xFE,
-    0x61, 0x6E, 0xD2, 0x3B, 0xBA, 0xAE, 0x1C, 0xCA, 0x3B, 0xD7, 0xD5, 0x4B, 0xBA, 0xED, 0xF5, 0x92,
-    0xA6, 0xA0, 0xFF, 0x49, 0x54, 0xD6, 0x8A, 0x47, 0x37, 0xE8, 0x2F, 0xDD, 0x35, 0xFA, 0x0B, 0xF0,
-    0xE8, 0x05, 0x39, 0x31, 0x7F, 0x1F, 0xD8, 0xDC, 0x91, 0xE8, 0xF1, 0x82, 0xAD, 0xF0, 0x94, 0xDD,
-    0xF3, 0xF5, 0x1C, 0xD8, 0x7B, 0x17, 0xE0, 0xCF, 0x0F, 0xF1, 0x6A, 0x2F, 0x45, 0x97, 0x41, 0xEE,
-    0x88, 0x70, 0x56, 0xE5, 0x41, 0x2A, 0x69, 0x32, 0x77, 0x52, 0xBA, 0x95, 0x7A, 0x66, 0xC7, 0xDE,
-    0x92, 0xDC, 0x89, 0xDB, 0x26, 0x8D, 0x50, 0x4D, 0xFF, 0xA7, 0x11, 0xB6, 0x96, 0x4B, 0xE2, 0x9B,
-    0xF3, 0xEA, 0x2F, 0xB8, 0x19, 0x4F, 0x60, 0xB3, 0xF7, 0x43, 0x67, 0x60, 0x9F, 0xE3, 0xA0, 0x6C,
-    0x1B, 0x2A, 0x9A, 0x04, 0xAF, 0xCC, 0x23, 0x68, 0xB1, 0x94, 0x99, 0xF6, 0x8D, 0x0E, 0x92, 0x34,
-    0x87, 0x38, 0xAA, 0x78, 0xAA, 0x41, 0x11, 0x96, 0x34, 0xEE, 0x97, 0x8A, 0xE4, 0xE6, 0x60, 0xB9,
-    0xF2, 0xF2, 0x8C, 0x1E, 0xAC, 0x5D, 0x4A, 0xE7, 0x24, 0xB1, 0x24, 0x92, 0xB9, 0x09, 0x5D, 0xFB,
-    0xA0, 0xEC, 0x4F, 0xBE, 0xB1, 0x27, 0xA9, 0x8E, 0x93, 0x48, 0xC5, 0x25, 0xD9, 0xC0, 0xE3, 0x1A,
-    0xD0, 0xDF, 0x18, 0x41, 0x84, 0x1E, 0xF8, 0x1B, 0x9A, 0xDF, 0x3F, 0xC2, 0xCF, 0x54, 0xFF, 0x55,
-    0xA8, 0xA7, 0xF5, 0xB8, 0x49, 0x48, 0x5E, 0x39, 0x5C, 0x55, 0x78, 0x52, 0x03, 0x2E, 0xC8, 0xBA,
-    0x8D, 0xF0, 0xE2, 0x47, 0xF0, 0x72, 0x1D, 0x62, 0xCA, 0x52, 0xCC, 0x36, 0xFA, 0x2F, 0x98, 0xD0,
-    0x58, 0x71, 0x02, 0x27, 0xE7, 0xC0, 0x1D, 0xD5, 0xE0, 0xB8, 0x0A, 0x28, 0x55, 0x7B, 0x69, 0xC6,
-    0xD2, 0x70, 0x27, 0x41, 0x2F, 0x96, 0xAF, 0x0F, 0x61, 0xE5, 0xAC, 0xEE, 0x72, 0xDA, 0x74, 0xCC,
-    0x1B, 0xD6, 0x0F, 0xD8, 0xCE, 0xED, 0x89, 0x29, 0xC7, 0xA2, 0x81, 0x08, 0x36, 0xAA, 0xB9, 0x73,
-    0xCF, 0x45, 0x58, 0x79, 0x9F, 0xD5, 0x60, 0x9F, 0x0C, 0x06, 0xD4, 0x5A, 0xFE, 0x1A, 0x24, 0xBD,
-    0xC8, 0xF4, 0x99, 0xC4, 0xAB, 0x1F, 0xBF, 0x9B, 0xD1, 0xB8, 0xA8, 0xAC, 0x28, 0x2C, 0x9C, 0xF1,
-    0xE8, 0x85, 0xEA, 0xED, 0xB1, 0x0C, 0xFD, 0x49, 0x62, 0x4F, 0xDC, 0xD4, 0x93, 0xFA, 0xD8, 0x8F,
-    0xED, 0x49, 0x2F, 0xB2, 0x27, 0x21, 0xEC, 0x49, 0x5F, 0x8E, 0xA1, 0x8C, 0x6F, 0x0E, 0x37, 0x1D,
-    0xCA, 0xD7, 0xEE, 0x0B, 0xDB, 0x50, 0x26, 0x09, 0x7E, 0x97, 0x37, 0xEB, 0xAD, 0x6B, 0x8A, 0x52,
-    0xAA, 0x6F, 0x4F, 0x0C, 0xCA, 0xBA, 0x7A, 0x8B, 0xBF, 0x5E, 0xBD, 0xA5, 0x8B, 0xD5, 0xDB, 0x7A,
-    0x31, 0xB0, 0x5D, 0x6E, 0x9F, 0x8C, 0xFF, 0x6B, 0xBB, 0x7C, 0x19, 0x34, 0x98, 0xB7, 0xE3, 0x7A,
-    0xBF, 0xB2, 0xCF, 0x56, 0x8F, 0x93, 0xBF, 0xC7, 0xCF, 0xBF, 0xD2, 0x1E, 0xBA, 0xB6, 0x11, 0x6E,
-    0x59, 0xD1, 0x19, 0x47, 0x30, 0x08, 0x0C, 0x03, 0x85, 0xA0, 0x34, 0x73, 0xF5, 0xF0, 0x63, 0x5D,
-    0xBF, 0x7D, 0x28, 0x08, 0x28, 0x09, 0x28, 0x0A, 0xF5, 0xED, 0x99, 0x76, 0x73, 0x72, 0x28, 0x0D,
-    0x28, 0x0E, 0x28, 0x0F, 0x28, 0x10, 0x28, 0x11, 0x28, 0x12, 0xC3, 0xA4, 0x84, 0x62, 0xA8, 0xA0,
-    0xD2, 0xA3, 0xA9, 0x72, 0xD8, 0x34, 0x67, 0x95, 0xE3, 0x3D, 0x8C, 0xBE, 0x9E, 0xB5, 0x84, 0x0F,
-    0x01, 0x81, 0x84, 0x40, 0x44, 0x20, 0x23, 0x10, 0x12, 0x48, 0x09, 0xC4, 0x04, 0x32, 0xAA, 0x84,
-    0x5C, 0x47, 0x54, 0x20, 0x2B, 0x84, 0xAA, 0x8E, 0xD0, 0x5A, 0xCC, 0x5A, 0x2F, 0xA2, 0x72, 0x0F,
-    0x3B, 0xE1, 0xA3, 0x97, 0xDF, 0xE7, 0x15, 0x2C, 0x65, 0xD5, 0xA0, 0x5A, 0xA7, 0xAB, 0x6C, 0x94,
-    0xFD, 0x01, 0x64, 0x92, 0xA8, 0x5E, 0x9F, 0x1B, 0x1C, 0x67, 0x12, 0xD5, 0x72, 0x5C, 0x45, 0xB3,
-    0xC7, 0xCF, 0xAB, 0xF6, 0xD2, 0xFE, 0x2E, 0x9D, 0xE5, 0xD6, 0xF3, 0x37, 0xFF, 0x4C, 0x45, 0x53,
-    0xF7, 0xC0, 0x8F, 0xDE, 0xA2, 0x6F, 0x74, 0xD7, 0xE8, 0x1B, 0xB2, 0xB9, 0x62, 0xC1, 0xFD, 0x58,
-    0xD6, 0xE8, 0x5B, 0x23, 0x39, 0xFB, 0x9A, 0xB6, 0x47, 0xF6, 0x75, 0x4D, 0xB5, 0xC0, 0x4B, 0xB4,
-    0xAC, 0x61, 0xA7, 0xFB, 0x62, 0xD5, 0xE9, 0x3E, 0x22, 0xA1, 0x55, 0x79, 0xCB, 0x6D, 0xCE, 0x48,
-    0xBB, 0x3D, 0x86, 0x8C, 0x20, 0x60, 0x97, 0x8F, 0xF7, 0x25, 0x6A, 0x59, 0x52, 0x51, 0x75, 0xE7,
-    0x65, 0x59, 0xF3, 0x60, 0xF9, 0x24, 0xBE, 0x31, 0xE1, 0xE0, 0x9C, 0xFE, 0xD3, 0x8B, 0x9A, 0xD2,
-    0x5D, 0x3B, 0x25, 0xBA, 0x8A, 0xA9, 0xD7, 0xF9, 0x6A, 0xC1, 0x09, 0xA4, 0x63, 0xA5, 0xB4, 0xAD,
-    0x98, 0xB6, 0xC8, 0x69, 0x96, 0x72, 0xB4, 0x39, 0x4C, 0xFC, 0x5D, 0x7D, 0xC0, 0xB5, 0x6E, 0x55,
-    0x4F, 0xC6, 0xFC, 0xB8, 0x7A, 0x20, 0x70, 0x48, 0x43, 0x22, 0xB5, 0xC8, 0x99, 0x08, 0x28, 0xB1,
-    0x51, 0x48, 0x65, 0x82, 0xEA, 0x9F, 0xB1, 0xB0, 0x9A, 0x2D, 0x63, 0x3D, 0x19, 0x48, 0x66, 0xF7,
-    0xA3, 0xAD, 0xB1, 0xB2, 0xE5, 0x8F, 0xDD, 0xD2, 0x83, 0xDA, 0x44, 0x49, 0x95, 0x55, 0x5D, 0x75,
-    0x13, 0x6C, 0xDA, 0xCB, 0xF7, 0xF4, 0x76, 0xAF, 0x96, 0x92, 0x16, 0x2F, 0xA6, 0x7A, 0x29, 0xCB,
-    0x17, 0x93, 0xA0, 0x4C, 0xD3, 0x4F, 0x2B, 0x18, 0x96, 0x30, 0xAD, 0xF2, 0x28, 0x29, 0x6D, 0xB4,
-    0xB6, 0x31, 0xC5, 0x8D, 0x56, 0x37, 0x66, 0x97, 0x72, 0x40, 0x60, 0x7B, 0x2B, 0x76, 0x2B, 0xB3,
-    0x75, 0x48, 0x7F, 0x20, 0xF2, 0xE9, 0x3C, 0x25, 0x9D, 0x91, 0xFA, 0x58, 0xA7, 0x55, 0x90, 0x9A,
-    0xEE, 0xDA, 0x07, 0xF3, 0x03, 0xED, 0xAE, 0xB1, 0xBB, 0xB8, 0x5A, 0x34, 0x2D, 0x5B, 0x53, 0x26,
-    0x58, 0x6A, 0xEF, 0x4D, 0x37, 0x3B, 0x66, 0xBB, 0xB3, 0xD0, 0x69, 0x5F, 0xF9, 0xEA, 0xEA, 0xA2,
-    0xDC, 0x86, 0x2D, 0x88, 0xAE, 0xB6, 0x61, 0xC6, 0x7E, 0x91, 0xC8, 0xDE, 0x6E, 0x63, 0x1E, 0x11,
-    0x49, 0xC6, 0xCD, 0x15, 0x74, 0x73, 0x85, 0x94, 0xD2, 0x1A, 0x73, 0x74, 0xD9, 0xC7, 0x8B, 0xC6,
-    0x8E, 0x6E, 0xB1, 0x9C, 0x98, 0x52, 0x52, 0xA0, 0x04, 0x51, 0x2F, 0xE2, 0x8C, 0x9E, 0x66, 0x00,
-    0x5F, 0xF7, 0x7D, 0x9B, 0x2A, 0x2F, 0xEA, 0x33, 0xCF, 0xAB, 0x2A, 0xB7, 0xF4, 0xCC, 0x21, 0xAF,
-    0x61, 0x30, 0xF1, 0xB5, 0xE8, 0xB6, 0xB5, 0xFD, 0x53, 0xBA, 0x70, 0x67, 0xA1, 0x0B, 0x34, 0xA8,
-    0x1F, 0x98, 0x96, 0xE7, 0x65, 0xBF, 0xFA, 0x91, 0x24, 0x7A, 0xA6, 0xD3, 0xA9, 0x93, 0x5A, 0x13,
-    0x77, 0x6C, 0x67, 0x5E, 0xE2, 0xE8, 0xC1, 0xB6, 0xBE, 0x2F, 0x3B, 0xF5, 0x20, 0xF2, 0x93, 0x9E,
-    0xDC, 0x07, 0x31, 0x5D, 0x8E, 0x0F, 0xE3, 0xD0, 0x7E, 0x18, 0xF7, 0x4E, 0xFD, 0x13, 0x7F, 0xEA,
-    0x4E, 0x51, 0xEE, 0x06, 0x75, 0xFC, 0x41, 0x39, 0x76, 0xA7, 0x79, 0xE7, 0x28, 0x38, 0xD6, 0xE7,
-    0x08, 0x41, 0xF3, 0xD0, 0xD1, 0x99, 0xD6, 0x3D, 0x30, 0xB8, 0x75, 0x96, 0x6F, 0x05, 0x29, 0x8C,
-    0x62, 0x58, 0x27, 0x29, 0xAC, 0x9B, 0xA9, 0x89, 0xCF, 0x74, 0xD4, 0x7B, 0x72, 0xFE, 0x2E, 0x96,
-    0xC6, 0xAA, 0x0E, 0x2C, 0xA8, 0x3D, 0xC5, 0xD6, 0x24, 0xE0, 0xC6, 0x67, 0x9E, 0xC8, 0xE4, 0x24,
-    0x32, 0xC9, 0x49, 0x24, 0x3B, 0x52, 0x22, 0x87, 0xBC, 0xEE, 0x0B, 0x7D, 0xE2, 0x33, 0x5F, 0x1B,
-    0x11, 0x4D, 0xEA, 0x9C, 0xD2, 0x24, 0xAD, 0xEB, 0x26, 0x5D, 0x75, 0x68, 0x89, 0x5A, 0x30, 0x20,
-    0x94, 0x90, 0x54, 0xAE, 0x11, 0xCB, 0xA1, 0x70, 0x29, 0x04, 0x83, 0xAC, 0x20, 0x52, 0x31, 0x42,
-    0xDF, 0x1B, 0x21, 0x1C, 0x90, 0x0E, 0x88, 0x87, 0xCB, 0x88, 0xE2, 0x43, 0x59, 0x50, 0x42, 0x08,
-    0x44, 0x84, 0x92, 0x91, 0x42, 0xBA, 0xBD, 0xD0, 0xB4, 0xEC, 0xA1, 0x79, 0x4B, 0xCD, 0x94, 0x3E,
-    0x72, 0x49, 0x9B, 0x28, 0x69, 0x52, 0xD7, 0x98, 0x63, 0xEA, 0x8F, 0xCC, 0x3C, 0x3E, 0xEE, 0x40,
-    0x1B, 0x58, 0x2B, 0xA4, 0xF4, 0x7F, 0xAE, 0xB1, 0x56, 0x79, 0x94, 0xAC, 0x31, 0x5D, 0x64, 0x66,
-    0x95, 0x99, 0x32, 0x88, 0xEB, 0xCC, 0xB8, 0xD5, 0xDD, 0xD5, 0x02, 0x33, 0x3A, 0x8C, 0xC6, 0x07,
-    0xD4, 0xE1, 0x09, 0xBB, 0x85, 0xB1, 0x26, 0x12, 0x7D, 0x16, 0xDC, 0x1E, 0x48, 0x9A, 0xD7, 0x82,
-    0xC9, 0xAB, 0xC0, 0x0F, 0x8B, 0x4F, 0xA5, 0xDC, 0xE9, 0xA5, 0x1D, 0xA6, 0xB3, 0x95, 0xA2, 0x69,
-    0x59, 0xE4, 0x31, 0xC9, 0x3B, 0x30, 0x1B, 0xA0, 0xB8, 0xD9, 0x06, 0xD5, 0xEF, 0x3E, 0x75, 0xEA,
-    0x28, 0xBA, 0x22, 0x22, 0x9D, 0x3A, 0x55, 0x8E, 0x9A, 0x58, 0x54, 0xDF, 0x1D, 0x8D, 0x89, 0xA6,
-    0x7C, 0xE7, 0xAB, 0x59, 0xB4, 0xAB, 0x51, 0x6E, 0x50, 0xDC, 0x2C, 0xA6, 0x3B, 0xFF, 0xC6, 0xCE,
-    0x3F, 0x7C, 0x99, 0x35, 0x12, 0x58, 0x97, 0x4C, 0x43, 0x5E, 0x74, 0x12, 0x7C, 0x53, 0x96, 0xB3,
-    0x39, 0x03, 0xFE, 0x90, 0xCF, 0x0A, 0xFB, 0x7C, 0xD3, 0x2D, 0x3C, 0xA4, 0x89, 0x5C, 0x0C, 0x41,
-    0x52, 0x19, 0xAE, 0x16, 0x3F, 0xD3, 0xA0, 0x67, 0x77, 0x65, 0x83, 0x3E, 0x1B, 0x16, 0xD9, 0x33,
-    0x1B, 0x8A, 0x26, 0xF6, 0xEC, 0x2E, 0x76, 0x65, 0xDF, 0x78, 0x24, 0x1A, 0xF6, 0x32, 0x6B, 0x66,
-    0xAA, 0x19, 0x51, 0x61, 0x9B, 0xBD, 0xE2, 0x6D, 0x66, 0x9F, 0x2D, 0x0E, 0xB8, 0xCB, 0xA1, 0x0F,
-    0x38, 0x89, 0x7C, 0x39, 0xA4, 0x6E, 0x01, 0xFB, 0x23, 0xFE, 0x03, 0x8E, 0xFC, 0x77, 0x86, 0xB6,
-    0xBC, 0x7A, 0x57, 0x58, 0xE7, 0xD0, 0x18, 0xEC, 0xD7, 0x2F, 0x7D, 0x4D, 0xCB, 0xB2, 0xEB, 0x03,
-    0x6A, 0xA5, 0x6F, 0x7C, 0xAC, 0xD1, 0xFC, 0xBA, 0xBC, 0xCB, 0x4C, 0x79, 0x57, 0xDE, 0x18, 0xE3,
-    0xD1, 0xAB, 0xB2, 0x9C, 0x9D, 0x22, 0x6E, 0x74, 0xA7, 0x9E, 0x78, 0x57, 0xEA, 0x8E, 0x1B, 0xCB,
-    0x65, 0x4E, 0xCE, 0xFC, 0x94, 0x3A, 0xC4, 0xB5, 0x87, 0xF4, 0x92, 0xEA, 0x0D, 0xDA, 0x37, 0xD7,
-    0xEF, 0x20, 0xFA, 0x62, 0x89, 0x06, 0x5C, 0xDC, 0xCC, 0x2A, 0x43, 0x34, 0xE0, 0xAA, 0x32, 0x77,
-    0x9F, 0x9B, 0x97, 0x98, 0xB7, 0x49, 0xDC, 0x99, 0x24, 0xA8, 0xCD, 0xD1, 0x57, 0xC0, 0x15, 0x6F,
-    0x31, 0x16, 0xAD, 0x91, 0x90, 0xAE, 0x67, 0x7F, 0xFA, 0x92, 0xAC, 0x76, 0x46, 0xDB, 0xBB, 0xBD,
-    0x6C, 0x61, 0xF3, 0xB0, 0x7E, 0x2E, 0xFF, 0x01, 0x9D, 0x58, 0xCD, 0x6F, 0xDC, 0xC6, 0x15, 0x7F,
-    0x24, 0x65, 0x31, 0x15, 0x6D, 0x8F, 0x0F, 0x0E, 0x20, 0x3B, 0x96, 0x79, 0xE9, 0x41, 0x36, 0xB4,
-    0xCB, 0x20, 0x10, 0x8A, 0x3D, 0x70, 0xC5, 0x49, 0x7D, 0x6B, 0x2F, 0x3E, 0xC4, 0x2D, 0x50, 0x14,
-    0xAD, 0x0F, 0x3D, 0x14, 0xEE, 0x47, 0x7C, 0xF0, 0xC1, 0x08, 0xD6, 0x5A, 0xBA, 0xFE, 0x07, 0x74,
-    0xA8, 0x6F, 0x2E, 0xA0, 0x02, 0x3E, 0xD8, 0x32, 0x90, 0x0A, 0xA8, 0x50, 0x08, 0xC1, 0x5A, 0x3B,
-    0x70, 0x0E, 0xBD, 0x4E, 0x0D, 0xB4, 0x87, 0x16, 0x05, 0x58, 0xC0, 0xB9, 0xA4, 0x40, 0xCB, 0x00,
-    0x1B, 0x64, 0x6B, 0x71, 0x39, 0xFD, 0xBD, 0xE1, 0x72, 0x45, 0xC5, 0x8E, 0x23, 0x87, 0xDC, 0x19,
-    0x0E, 0x67, 0x38, 0xF3, 0x3E, 0xE6, 0xBD, 0xDF, 0x7B, 0xB3, 0xB4, 0xF9, 0xD2, 0x8B, 0xE8, 0xED,
-    0xE3, 0xE7, 0x56, 0x7D, 0xED, 0xEB, 0x70, 0xF4, 0x9D, 0x7B, 0x6E, 0xFA, 0xF5, 0x37, 0x91, 0x93,
-    0x52, 0x76, 0x6D, 0xF7, 0xA3, 0xDD, 0xCD, 0xEC, 0xF7, 0xE9, 0x26, 0x7D, 0xFD, 0x4D, 0xE4, 0xCA,
-    0x80, 0xDA, 0x0F, 0xDB, 0x1F, 0x06, 0x0B, 0xEE, 0xF7, 0x68, 0xE1, 0x08, 0x37, 0x51, 0x62, 0x64,
-    0xDF, 0x50, 0x75, 0xCD, 0xDA, 0xD7, 0xB6, 0xB6, 0xEE, 0x0F, 0x8D, 0x19, 0x71, 0xFB, 0xE2, 0xD6,
-    0xD6, 0x56, 0x62, 0x4C, 0x59, 0xB7, 0x71, 0xDD, 0xC7, 0x3B, 0x5F, 0xA3, 0xE9, 0xBC, 0xAF, 0xEC,
-    0x27, 0xCA, 0x57, 0xBE, 0xE9, 0x7D, 0xEC, 0xCA, 0x15, 0x89, 0xF5, 0xF4, 0x9B, 0x78, 0xF2, 0x4A,
-    0x7D, 0x63, 0x52, 0xF0, 0x24, 0x9D, 0x34, 0x48, 0x63, 0xBA, 0x41, 0x63, 0x32, 0xB8, 0xFB, 0x18,
-    0x09, 0xD2, 0x50, 0x87, 0x99, 0x9F, 0xB9, 0xDA, 0x53, 0x21, 0xED, 0xA0, 0x67, 0x41, 0x46, 0x2A,
-    0xD2, 0x01, 0xDE, 0xBD, 0xB4, 0xEA, 0x09, 0xD2, 0x48, 0x25, 0x6A, 0x9D, 0x3A, 0xB8, 0x97, 0xC8,
-    0xB7, 0xDA, 0x5D, 0x0C, 0xD2, 0x71, 0xEC, 0xA5, 0x37, 0x02, 0x1A, 0x0B, 0x69, 0x44, 0x66, 0x44,
-    0xDE, 0xF7, 0x33, 0xFB, 0xF1, 0x4E, 0xF8, 0x74, 0x12, 0xFE, 0x6B, 0xE2, 0x67, 0xB7, 0x5C, 0xBD,
-    0xE2, 0xA9, 0x4E, 0xE8, 0x64, 0x3B, 0x81, 0xB4, 0x2B, 0x6F, 0x46, 0x4F, 0x8A, 0xE8, 0xE9, 0x24,
-    0xD0, 0x03, 0x4F, 0x61, 0xF6, 0x2A, 0x0F, 0x09, 0x59, 0xCD, 0x8A, 0x3E, 0x2E, 0x92, 0x3F, 0x17,
-    0xEB, 0x7E, 0xD6, 0xF1, 0x65, 0xC7, 0x93, 0x4B, 0xAE, 0xF6, 0xD3, 0x9D, 0xA9, 0x26, 0x84, 0x22,
-    0x91, 0x92, 0x20, 0xFE, 0x9D, 0x24, 0x3A, 0x47, 0x1F, 0xFC, 0xEA, 0xD7, 0x43, 0x53, 0x5E, 0xEE,
-    0xCC, 0xD1, 0x80, 0xA8, 0x20, 0xA7, 0x20, 0x77, 0x44, 0x6E, 0x4E, 0x6E, 0x46, 0x9E, 0x26, 0x4F,
-    0xD9, 0x5F, 0x4A, 0x3E, 0xF1, 0x0F, 0x5B, 0x75, 0x82, 0xE8, 0xB8, 0xFD, 0xCD, 0xAE, 0x04, 0xA5,
-    0x8B, 0x12, 0xA3, 0x74, 0x88, 0xE4, 0xEA, 0x1C, 0x19, 0x53, 0x38, 0xFF, 0xFB, 0xD3, 0x2E, 0x14,
-    0x4F, 0xBC, 0x16, 0x79, 0xFC, 0xD4, 0xD6, 0x96, 0x60, 0x1D, 0x78, 0x47, 0xF1, 0xA5, 0xE5, 0x86,
-    0x42, 0x69, 0x99, 0x59, 0xFB, 0xC9, 0x2F, 0xB0, 0xF3, 0x86, 0x4E, 0xAD, 0x1C, 0xAB, 0x96, 0xE2,
-    0x82, 0x15, 0xA0, 0x61, 0x7B, 0xB9, 0x9B, 0x14, 0x4E, 0xF0, 0x05, 0x76, 0x40, 0x56, 0x3F, 0xB4,
-    0xA3, 0x92, 0xE6, 0x9F, 0xD1, 0x55, 0xA2, 0x3D, 0xA2, 0x61, 0x46, 0xC3, 0x92, 0x86, 0x46, 0x73,
-    0x9D, 0x71, 0xCF, 0xA6, 0x9D, 0x38, 0x07, 0x06, 0x87, 0xD8, 0xA1, 0x45, 0xB4, 0xB8, 0x9D, 0xC8,
-    0x21, 0x4A, 0x1F, 0x65, 0x91, 0xCE, 0x50, 0x8B, 0xCE, 0x43, 0x2A, 0x1E, 0x4F, 0xD2, 0xAA, 0x5E,
-    0xC7, 0x37, 0x91, 0xAC, 0x88, 0x2E, 0xE0, 0x1D, 0x37, 0xDB, 0xE2, 0x83, 0x8F, 0x1E, 0x1C, 0xC5,
-    0xFA, 0xF9, 0xBE, 0xF8, 0xF0, 0xE2, 0x87, 0x47, 0xB2, 0x7B, 0x6B, 0xFB, 0xFD, 0xC9, 0xC1, 0x7D,
-    0x34, 0x8F, 0xEC, 0x4F, 0xAE, 0x53, 0x75, 0x1F, 0x7D, 0x06, 0xF6, 0xCD, 0xDE, 0x47, 0x9D, 0x51,
-    0x5F, 0x7D, 0x4D, 0x81, 0x55, 0x7F, 0x96, 0x43, 0x53, 0xB8, 0x7C, 0xB5, 0x6B, 0xB7, 0x86, 0x84,
-    0x1C, 0x90, 0x75, 0xB1, 0x90, 0x06, 0x2E, 0xDB, 0x2B, 0xB5, 0x09, 0xC6, 0x48, 0xD6, 0x1A, 0xC6,
-    0x82, 0xAA, 0xC6, 0xA8, 0x65, 0x1B, 0xB1, 0x93, 0xDF, 0x9C, 0xDF, 0xA0, 0xB3, 0xB2, 0x8B, 0x85,
-    0xD6, 0x07, 0xF4, 0x3C, 0x6F, 0xF9, 0x4F, 0x74, 0xDE, 0xF5, 0xF4, 0xAE, 0x78, 0xDF, 0xBF, 0xA3,
-    0xDB, 0x81, 0xEA, 0xB9, 0xCF, 0x84, 0xAF, 0x22, 0x21, 0x7B, 0x98, 0x07, 0x47, 0x09, 0x09, 0x8D,
-    0x5D, 0x21, 0xD7, 0xDA, 0x68, 0x38, 0xB9, 0x90, 0xDD, 0x35, 0x98, 0xA8, 0xA7, 0x04, 0xF5, 0xB0,
-    0x2C, 0x05, 0x52, 0xD0, 0x6E, 0xD7, 0xC9, 0x41, 0x5E, 0xC8, 0xBC, 0x0D, 0x5B, 0x8D, 0x29, 0xB8,
-    0xA3, 0x45, 0x90, 0x62, 0xD0, 0x35, 0xD2, 0x2F, 0xE9, 0xE5, 0x57, 0x2D, 0x51, 0x53, 0xA8, 0xA6,
-    0x5C, 0x4D, 0xD1, 0x9A, 0xD2, 0x35, 0x05, 0x6C, 0xCA, 0xD8, 0x14, 0xB3, 0x29, 0x29, 0x5D, 0xA4,
-    0x99, 0xB0, 0xEE, 0xBE, 0x9E, 0xC9, 0x1B, 0xDC, 0xCE, 0x67, 0x22, 0x0B, 0x1A, 0xCD, 0xA4, 0x6E,
-    0x33, 0xC9, 0xA9, 0xE0, 0x2C, 0x60, 0x2D, 0x7B, 0x0F, 0xED, 0x5A, 0xFC, 0x1E, 0xE4, 0xAD, 0x35,
-    0x30, 0x80, 0x63, 0xD5, 0x4A, 0xE8, 0x41, 0xFC, 0x5A, 0x0F, 0xBD, 0x40, 0xCD, 0x54, 0xD1, 0x0D,
-    0x69, 0xA6, 0x0D, 0x31, 0x3E, 0xA4, 0x06, 0x91, 0x86, 0x32, 0x02, 0xE7, 0x31, 0x6D, 0x13, 0xCB,
-    0x27, 0x7E, 0x93, 0x87, 0x97, 0xF2, 0xC8, 0xD3, 0x5D, 0x5F, 0xC5, 0x82, 0xB6, 0x4F, 0x52, 0x76,
-    0x8E, 0xAA, 0xFE, 0x35, 0x0C, 0xDC, 0xC2, 0xC8, 0x00, 0x43, 0x79, 0x2C, 0x9C, 0x6C, 0xFB, 0xA4,
-    0xAB, 0xB2, 0x73, 0x5E, 0x5A, 0x79, 0x7F, 0xC4, 0xA4, 0xC1, 0x8A, 0x2F, 0xD9, 0xAD, 0x13, 0x5F,
-    0x47, 0x5E, 0x16, 0x7A, 0x99, 0x70, 0xB3, 0x40, 0xE6, 0xBE, 0xCC, 0x3D, 0xB9, 0x4D, 0xB6, 0xBF,
-    0xC0, 0x40, 0x81, 0x91, 0x1E, 0x86, 0x62, 0x8C, 0xB5, 0x30, 0xB8, 0x84, 0xD1, 0x13, 0x35, 0x4F,
-    0xDB, 0x96, 0xDB, 0x82, 0xBC, 0xDF, 0x51, 0x20, 0xE8, 0x64, 0x20, 0x01, 0x7A, 0xB1, 0xAB, 0xE8,
-    0x18, 0xC0, 0x72, 0xD7, 0xCD, 0x03, 0x95, 0x48, 0x26, 0x27, 0x52, 0x5F, 0xA1, 0x77, 0xC3, 0x91,
-    0xA8, 0x73, 0x4C, 0x19, 0x80, 0x8B, 0x75, 0x1A, 0x7B, 0x59, 0x90, 0x2E, 0xD1, 0xB7, 0xC9, 0x22,
-    0x1B, 0xA0, 0x2D, 0x4A, 0x7D, 0xB0, 0x16, 0x41, 0x50, 0x5F, 0x2D, 0xD0, 0x2D, 0x68, 0x91, 0x1C,
-    0xE8, 0xB5, 0xC7, 0xC0, 0x66, 0x79, 0xE6, 0x5D, 0xE7, 0x3D, 0x77, 0xF2, 0x9C, 0x05, 0xE9, 0x2B,
-    0xA1, 0xD8, 0xF7, 0xB9, 0xE6, 0xF6, 0x9C, 0xF3, 0x59, 0xEE, 0xF0, 0x37, 0x3D, 0x6B, 0x07, 0xD0,
-    0x25, 0xE6, 0xFA, 0xCA, 0xAE, 0x93, 0x93, 0xAF, 0x8F, 0xE1, 0x15, 0x4A, 0x94, 0x21, 0xD8, 0x03,
-    0x2D, 0x49, 0xF6, 0x13, 0x4A, 0xDC, 0x31, 0xF5, 0xBD, 0x11, 0xED, 0x01, 0xF5, 0x1E, 0xA3, 0x14,
-    0x5E, 0x46, 0x85, 0xAF, 0x69, 0x14, 0x28, 0x27, 0xE7, 0x22, 0x52, 0x37, 0x13, 0xD2, 0xD5, 0x82,
-    0x38, 0x52, 0x78, 0x6A, 0x09, 0x00, 0xBB, 0x02, 0x3C, 0x5C, 0x99, 0x6D, 0xCE, 0x02, 0xFD, 0x8C,
-    0x92, 0x77, 0x0B, 0x4A, 0xBE, 0x8B, 0xE2, 0x1C, 0x6C, 0x9C, 0x6B, 0x32, 0x12, 0x7F, 0x2B, 0x18,
-    0xC5, 0xB0, 0x75, 0x11, 0xC5, 0xA7, 0x23, 0x9A, 0x1B, 0x44, 0x00, 0x6E, 0x60, 0xD4, 0xF8, 0x31,
-    0xD1, 0x67, 0x63, 0x72, 0xF6, 0x33, 0x72, 0x4A, 0x36, 0x6E, 0x62, 0xEC, 0xAE, 0x4A, 0xC3, 0xA3,
-    0x6D, 0xB8, 0x4D, 0xA7, 0x65, 0xDA, 0x17, 0x01, 0xB0, 0x01, 0xBE, 0xE3, 0x53, 0xF6, 0xAD, 0xC3,
-    0xD5, 0x75, 0x76, 0x0C, 0x4F, 0x71, 0x24, 0x42, 0x74, 0xAB, 0xC2, 0xE9, 0xBC, 0x79, 0xCE, 0x43,
-    0x6F, 0xBE, 0xC7, 0xFA, 0x30, 0x86, 0xE9, 0xDC, 0xFD, 0xC1, 0x04, 0x21, 0x87, 0xC3, 0x8E, 0x55,
-    0xA4, 0xB6, 0x98, 0x7B, 0xB5, 0xA2, 0x18, 0x54, 0xC8, 0x4E, 0xAD, 0x29, 0x9A, 0x73, 0x0C, 0x9A,
-    0x06, 0x02, 0x66, 0xCA, 0x0E, 0xA3, 0x44, 0x68, 0xAF, 0xA1, 0x6F, 0x07, 0x63, 0xF9, 0x0E, 0x86,
-    0x63, 0x0C, 0xB7, 0xAC, 0x6D, 0xB3, 0x59, 0xB5, 0xF0, 0x16, 0xDB, 0x49, 0x33, 0xD3, 0xB5, 0xF5,
-    0x72, 0xF5, 0x58, 0xAF, 0xAC, 0x27, 0xBC, 0x67, 0x75, 0xEF, 0x94, 0x55, 0xE6, 0x50, 0xDE, 0xE5,
-    0x87, 0x19, 0x5A, 0xB9, 0x37, 0xDF, 0xA9, 0x34, 0xB8, 0x3D, 0xA8, 0x92, 0x81, 0xD3, 0xD5, 0x83,
-    0x2B, 0xB6, 0x84, 0x2E, 0x2D, 0x80, 0x9D, 0xED, 0x98, 0xC2, 0x8F, 0x53, 0xA7, 0xE8, 0x90, 0xFF,
-    0xC5, 0xBC, 0xEA, 0x5F, 0xFF, 0x25, 0xF5, 0x87, 0xCA, 0xDF, 0x2F, 0xCE, 0x0E, 0x3F, 0x79, 0xF7,
-    0x51, 0xF9, 0x5E, 0xF2, 0xDF, 0xCC, 0x2B, 0x4B, 0xBA, 0x70, 0x62, 0xCF, 0xDD, 0xF8, 0x47, 0x46,
-    0x2B, 0x91, 0x74, 0x9F, 0x8E, 0x28, 0x9E, 0x07, 0x73, 0x57, 0x59, 0xB8, 0x19, 0x2E, 0x40, 0x97,
-    0x69, 0x62, 0x52, 0x1B, 0xA2, 0x10, 0x8D, 0x2C, 0x11, 0x1E, 0xB3, 0x71, 0xDB, 0x82, 0x4D, 0x5C,
-    0x53, 0x77, 0xB2, 0x7A, 0xD0, 0x8A, 0x62, 0x21, 0xE4, 0x66, 0x3D, 0x68, 0x05, 0xE6, 0x0C, 0xA1,
-    0x1A, 0xB4, 0x93, 0x76, 0xAC, 0xAD, 0x7E, 0xC5, 0x8A, 0x95, 0x1A, 0x40, 0x30, 0x9A, 0x6E, 0xEC,
-    0x1A, 0x6B, 0x07, 0x05, 0x66, 0x81, 0xC0, 0x5E, 0x15, 0x28, 0x82, 0x5D, 0x00, 0x21, 0xDE, 0xC6,
-    0x64, 0xCF, 0x28, 0xF2, 0x3F, 0x91, 0xB0, 0x65, 0x2C, 0xA7, 0xAA, 0x78, 0x8C, 0xF4, 0x80, 0x42,
-    0x14, 0x8E, 0x81, 0x11, 0x1D, 0x5E, 0x6A, 0xF8, 0x5B, 0xA2, 0xAD, 0x07, 0xF5, 0x36, 0x18, 0x7C,
-    0xD1, 0x97, 0xD5, 0x17, 0xF5, 0x57, 0xB7, 0x50, 0x06, 0x07, 0x04, 0x9D, 0x9A, 0x20, 0x88, 0x19,
-    0x94, 0x1F, 0x42, 0x64, 0x36, 0xA9, 0x40, 0x4F, 0x89, 0xD5, 0x04, 0x65, 0x45, 0xB0, 0x5E, 0x0A,
-    0xC4, 0xCE, 0x4E, 0x90, 0xD1, 0x3D, 0x38, 0x64, 0xFA, 0x08, 0xF7, 0xB0, 0x7E, 0x67, 0xF2, 0x3E,
-    0x1C, 0x34, 0xF1, 0x72, 0x3F, 0xEB, 0xE2, 0xA1, 0xBD, 0x3C, 0xA6, 0xC8, 0x53, 0x6E, 0x3E, 0x07,
-    0x7E, 0xA5, 0x67, 0x5D, 0xD9, 0x4A, 0xF7, 0xD8, 0xD2, 0x61, 0x16, 0xA0, 0x12, 0xA6, 0x38, 0xB1,
-    0x89, 0x42, 0x90, 0x59, 0xDF, 0x58, 0xAB, 0xD4, 0x18, 0x57, 0xB6, 0xDA, 0xA9, 0x12, 0x92, 0x1B,
-    0x5F, 0x8E, 0x16, 0xEC, 0x2D, 0x9B, 0xD6, 0x59, 0xBC, 0xF1, 0xC1, 0xA3, 0x5A, 0xBF, 0x79, 0x31,
-    0x7B, 0x13, 0x76, 0x4D, 0x78, 0x62, 0xE2, 0x14, 0x5D, 0x76, 0x5B, 0xB0, 0xE5, 0x8E, 0xC0, 0x14,
-    0x0B, 0x9F, 0x00, 0x04, 0x80, 0x06, 0xCC, 0x0E, 0xA8, 0x06, 0x1A, 0x30, 0xB2, 0x87, 0xED, 0x05,
-    0x23, 0x81, 0x44, 0x87, 0x60, 0x26, 0x04, 0xB3, 0x70, 0xF2, 0x30, 0xF1, 0x65, 0xA6, 0x59, 0x4E,
-    0xAB, 0x4A, 0xB5, 0xCD, 0xCC, 0x2B, 0x2C, 0xD9, 0x3D, 0xCB, 0x9F, 0x6A, 0xDA, 0x73, 0x73, 0x8B,
-    0x37, 0x19, 0xF6, 0xB6, 0xF0, 0x34, 0x94, 0x5E, 0x90, 0x44, 0xDB, 0xEE, 0x34, 0x1B, 0x8D, 0x9F,
-    0x71, 0x1D, 0x2A, 0x96, 0x7D, 0x8F, 0xCD, 0x2B, 0xE0, 0x58, 0x82, 0x98, 0xC6, 0xF5, 0x8A, 0xD5,
-    0x42, 0x6C, 0x95, 0xD0, 0x79, 0x41, 0x03, 0xF7, 0x41, 0x4A, 0x02, 0x97, 0x51, 0x7B, 0x5C, 0x5B,
-    0xFB, 0x39, 0xB8, 0x86, 0x5B, 0x43, 0x85, 0xBC, 0x58, 0x85, 0x66, 0x5F, 0x55, 0x36, 0x5B, 0x7B,
-    0x7E, 0x5D, 0xCE, 0x37, 0x50, 0x20, 0x9E, 0x5A, 0xF9, 0xCD, 0x03, 0x44, 0xE0, 0xC2, 0xCE, 0x60,
-    0x21, 0x4B, 0x37, 0x9D, 0xC9, 0x26, 0xDC, 0x23, 0xF2, 0xFF, 0x6A, 0x26, 0xE4, 0x2A, 0xA4, 0x87,
-    0xAF, 0xAA, 0x4A, 0xAE, 0x90, 0xBF, 0xAA, 0xE7, 0x1B, 0xA8, 0x78, 0xBD, 0x6F, 0x56, 0xF9, 0x0A,
-    0xE2, 0xF5, 0x95, 0x91, 0xF5, 0xD6, 0x9A, 0x52, 0x98, 0x7F, 0x7F, 0x9E, 0x98, 0x4B, 0xEA, 0x65,
-    0x25, 0x32, 0x97, 0x74, 0x80, 0x6F, 0x9C, 0x6B, 0x5B, 0x0F, 0xF9, 0xA8, 0xF0, 0xD6, 0x73, 0x33,
-    0x76, 0xB5, 0x99, 0x38, 0x1A, 0x7D, 0xDA, 0x98, 0x46, 0x29, 0x3D, 0x6D, 0x0A, 0x80, 0xED, 0x08,
-    0x47, 0x95, 0x6A, 0x75, 0x60, 0xE7, 0x09, 0x68, 0x2B, 0xF9, 0x3E, 0x9A, 0x7F, 0x47, 0x63, 0xCF,
-    0xA4, 0xD7, 0xCC, 0x5D, 0xEA, 0xFF, 0x41, 0xD3, 0x8D, 0x65, 0xD8, 0x6B, 0x07, 0x9B, 0x7E, 0xF3,
-    0x78, 0x95, 0x09, 0x33, 0x2F, 0x69, 0x90, 0x8B, 0x3C, 0xD0, 0x2F, 0x98, 0xA9, 0x4C, 0x54, 0x5F,
-    0xED, 0xC1, 0x7E, 0x57, 0xB1, 0x97, 0x81, 0xAC, 0xFB, 0xDF, 0x32, 0xB0, 0xB8, 0x12, 0x18, 0x0D,
-    0x0F, 0x0F, 0x71, 0x08, 0x81, 0x8A, 0x2D, 0x12, 0x5F, 0x46, 0x75, 0x9A, 0x5E, 0xE7, 0x3A, 0x55,
-    0x47, 0x86, 0x1B, 0x6D, 0x06, 0x21, 0xA0, 0x45, 0xA0, 0xDC, 0xC9, 0x95, 0x3D, 0x06, 0xBC, 0xAC,
-    0xB9, 0x1A, 0x30, 0x63, 0x15, 0x7B, 0xFD, 0x18, 0x26, 0x15, 0xFD, 0xBC, 0x45, 0xEE, 0x7E, 0xE9,
-    0x00, 0x3F, 0x9D, 0x72, 0x28, 0x49, 0xFF, 0x11, 0x8A, 0xCD, 0x71, 0xC8, 0xC8, 0xDE, 0xAE, 0xC0,
-    0xAF, 0x82, 0x32, 0x86, 0xDF, 0xF0, 0x0E, 0xCE, 0x18, 0x5F, 0xC0, 0x2B, 0x80, 0xBA, 0x80, 0x5C,
-    0x09, 0xBC, 0xA5, 0x0B, 0xC7, 0xB1, 0x3A, 0x90, 0x96, 0x61, 0xB6, 0xC6, 0xB8, 0x20, 0xCD, 0xC4,
-    0x5F, 0xB4, 0x78, 0xA2, 0xDC, 0x4B, 0x29, 0x1B, 0x6B, 0x60, 0x83, 0xFD, 0x92, 0x1D, 0x07, 0x77,
-    0xD7, 0xAD, 0x2D, 0xC1, 0xC1, 0xAB, 0x73, 0x8B, 0x1D, 0x17, 0x48, 0x1F, 0xC2, 0x74, 0x25, 0x4A,
-    0x3B, 0x8C, 0x32, 0xE4, 0x8F, 0x28, 0x17, 0x25, 0xE5, 0x2D, 0x71, 0x5B, 0xC7, 0xDE, 0xBE, 0xEA,
-    0xD0, 0x50, 0x36, 0xE4, 0x9C, 0xE7, 0xB8, 0x46, 0xFD, 0x4F, 0x1F, 0xC1, 0x9A, 0x9E, 0x31, 0x2A,
-    0x5A, 0xF8, 0xCD, 0xAD, 0x53, 0xAC, 0x4E, 0xBF, 0x01, 0xB9, 0xB9, 0xD6, 0x1C, 0x9D, 0x5F, 0x6A,
-    0x91, 0xF8, 0x71, 0x8F, 0xDC, 0x7F, 0x66, 0x74, 0x79, 0x78, 0x5B, 0x22, 0x48, 0xAA, 0x87, 0xC3,
-    0x1F, 0xA5, 0xCE, 0x7F, 0xE0, 0x5C, 0xF7, 0x76, 0x29, 0x5A, 0x5A, 0xA3, 0x37, 0x96, 0xDE, 0xE0,
-    0xBC, 0xB1, 0x4E, 0x32, 0xE1, 0x1B, 0x42, 0x4F, 0xCB, 0xCC, 0xC8, 0x97, 0xD9, 0x87, 0x38, 0x5C,
-    0x4D, 0xF1, 0xB3, 0xC1, 0xCC, 0x0B, 0xDF, 0x73, 0x3A, 0x16, 0x28, 0x4E, 0xC8, 0x84, 0xE2, 0x94,
-    0x2C, 0x24, 0x4E, 0xCA, 0xDA, 0xC4, 0x69, 0x19, 0x52, 0x39, 0x24, 0x66, 0x1D, 0xE2, 0xD4, 0xEC,
-    0x7A, 0xBD, 0x84, 0xC3, 0x11, 0x99, 0x41, 0xAB, 0xAA, 0x0E, 0x7B, 0xEE, 0x59, 0x7B, 0xC4, 0x91,
-    0x7C, 0xCA, 0xB1, 0x15, 0xCD, 0x4E, 0x3E, 0xAF, 0x9C, 0xBB, 0xCC, 0xDE, 0x3C, 0x64, 0xE4, 0x31,
-    0x5C, 0xDD, 0x3A, 0x48, 0x24, 0x2A, 0x23, 0xDD, 0xE0, 0x8D, 0xCA, 0xEB, 0xCA, 0xCF, 0x9A, 0x83,
-    0x98, 0x7B, 0xA1, 0x31, 0x77, 0xBD, 0x31, 0x17, 0x59, 0x17, 0xCE, 0x65, 0xED, 0x57, 0x18, 0xE1,
-    0x19, 0xFB, 0x4D, 0x82, 0x73, 0xDC, 0xD4, 0x78, 0xEC, 0xFA, 0xB3, 0xCA, 0xD5, 0x2F, 0x9F, 0x76,
-    0x9A, 0x4F, 0x81, 0x7D, 0xB2, 0x07, 0x41, 0x4B, 0x03, 0xAD, 0x45, 0x5E, 0xED, 0xA5, 0x97, 0x65,
-    0xFF, 0x60, 0xD1, 0x19, 0xD2, 0x2F, 0x3B, 0xE9, 0x19, 0x5A, 0x77, 0x39, 0x39, 0xE4, 0xAA, 0xEB,
-    0xAA, 0x36, 0x03, 0x06, 0x35, 0xAA, 0x6B, 0x8F, 0x3E, 0xDD, 0x42, 0xD0, 0x07, 0x1C, 0x7D, 0x69,
-    0x60, 0xD1, 0x55, 0x8B, 0x2F, 0xCC, 0x85, 0xAB, 0x20, 0xA1, 0x95, 0xE7, 0x67, 0x94, 0xE7, 0xEC,
-    0x7B, 0x22, 0xBF, 0xD5, 0x14, 0x98, 0x7B, 0xAC, 0xC0, 0xEB, 0xE0, 0x7E, 0x68, 0x61, 0x94, 0x85,
-    0xE1, 0xF6, 0xB2, 0x95, 0xAD, 0x6F, 0x8F, 0xAF, 0xA7, 0xAD, 0x6E, 0xB9, 0x77, 0xDD, 0x7E, 0x7D,
-    0x70, 0xD0, 0x7B, 0x8D, 0x63, 0xE5, 0x89, 0xEA, 0x3E, 0xEA, 0x8C, 0xA4, 0x88, 0xC6, 0x22, 0xF7,
-    0x35, 0x82, 0x6F, 0x7A, 0xC4, 0x3F, 0x93, 0x10, 0xEC, 0x7C, 0x2D, 0xF2, 0x68, 0x9C, 0x14, 0x47,
-    0x9B, 0x01, 0xC4, 0xCB, 0x3A, 0x2B, 0x9D, 0x95, 0x20, 0x3B, 0x1A, 0x15, 0xC8, 0x91, 0xBE, 0x9E,
-    0xE4, 0xFF, 0x07, 0x6D, 0x54, 0x31, 0x6C, 0x23, 0x45, 0x14, 0x7D, 0x3B, 0x03, 0x8C, 0xE4, 0xE1,
-    0x3C, 0xD7, 0x80, 0x84, 0x20, 0xDE, 0xE6, 0x8A, 0x53, 0x94, 0xB0, 0x57, 0xA4, 0xB0, 0xD0, 0x6E,
-    0x3C, 0x54, 0x29, 0x52, 0x90, 0x86, 0x2A, 0x85, 0x53, 0x21, 0x94, 0x26, 0x29, 0x22, 0xC5, 0x85,
-    0x7D, 0x9E, 0x50, 0x1C, 0x6D, 0x8A, 0x93, 0x28, 0x28, 0x48, 0x91, 0xE6, 0x5C, 0x5D, 0xE1, 0x22,
-    0x42, 0xC6, 0x19, 0x41, 0x47, 0x35, 0x20, 0x24, 0x44, 0x81, 0x34, 0xC0, 0xE9, 0xAE, 0x64, 0x90,
-    0x16, 0x69, 0x73, 0xB2, 0xB2, 0xFC, 0x59, 0x8B, 0x88, 0xA0, 0xB3, 0x9F, 0x2C, 0xCF, 0x9F, 0xDD,
-    0x79, 0xEF, 0xBF, 0xFF, 0xE7, 0xE3, 0xD2, 0xF0, 0x17, 0x41, 0xE9, 0x32, 0x43, 0x55, 0xA0, 0x1A,
-    0xA2, 0x9A, 0xA1, 0x5C, 0x24, 0x61, 0xC1, 0xC2, 0x8C, 0xBB, 0xA1, 0xB4, 0x9B, 0x07, 0x90, 0x25,
-    0x98, 0xE6, 0x36, 0x01, 0xD0, 0x83, 0xA2, 0x6F, 0x1B, 0x2B, 0x58, 0x43, 0x8E, 0x2E, 0x0A, 0xD3,
-    0x01, 0x58, 0x80, 0x08, 0x48, 0x3D, 0x8E, 0x1D, 0x7E, 0xB6, 0x7C, 0xDB, 0xB6, 0x95, 0x2D, 0xFA,
-    0x8F, 0xC7, 0xF5, 0x02, 0x29, 0x90, 0x21, 0x19, 0x6B, 0x36, 0x31, 0xAC, 0x2E, 0x79, 0x1D, 0x04,
-    0x0E, 0x5B, 0xB8, 0xFB, 0x26, 0xD0, 0xF9, 0x1A, 0x9D, 0xBE, 0x05, 0xF7, 0x84, 0x43, 0xEE, 0x4B,
-    0x61, 0xE7, 0x07, 0xFA, 0xDD, 0x0A, 0x38, 0x70, 0xEC, 0xEF, 0x20, 0x2C, 0x69, 0xD2, 0x19, 0x11,
-    0xD6, 0xBA, 0xB7, 0x6D, 0x47, 0x24, 0x85, 0x20, 0x5C, 0x21, 0x6D, 0x76, 0xA0, 0x45, 0x85, 0xAC,
-    0xF6, 0xBD, 0x3A, 0x6C, 0x24, 0x6E, 0x8F, 0x1B, 0x48, 0x90, 0x20, 0x52, 0x83, 0xA7, 0x48, 0x1C,
-    0xB8, 0x8D, 0x01, 0xD2, 0x75, 0x1F, 0xF1, 0x93, 0xD4, 0x4E, 0xFC, 0x50, 0x2A, 0x53, 0x29, 0x53,
-    0xAA, 0x6F, 0x3D, 0xAF, 0x35, 0xAB, 0x75, 0x96, 0xBA, 0x19, 0xF7, 0x15, 0xF7, 0x94, 0xE4, 0xC3,
-    0xBE, 0x91, 0x57, 0xC0, 0xA5, 0x16, 0x2F, 0xBC, 0x3A, 0x09, 0x29, 0xC8, 0x8B, 0x32, 0x4D, 0x4A,
-    0xF5, 0x79, 0x10, 0x75, 0x00, 0x77, 0x10, 0xB6, 0xAB, 0x74, 0xF1, 0x10, 0xE9, 0x33, 0x60, 0x2F,
-    0xB2, 0x2C, 0xB1, 0xFF, 0xF2, 0x8C, 0x70, 0xB3, 0xA4, 0xAD, 0xFD, 0xC9, 0x19, 0x61, 0x5C, 0x87,
-    0xFD, 0xC9, 0x69, 0x43, 0x8E, 0xB7, 0x3E, 0xDE, 0xA1, 0x25, 0x04, 0x30, 0x8F, 0x3E, 0x49, 0x8B,
-    0x54, 0x93, 0x8B, 0x28, 0x80, 0x21, 0x30, 0x6B, 0xB0, 0xF8, 0xF7, 0x0F, 0x45, 0x36, 0x01, 0xA5,
-    0x41, 0x39, 0x45, 0xE5, 0x06, 0x49, 0x68, 0x36, 0x8A, 0xE8, 0x3C, 0x39, 0x79, 0x0B, 0xF4, 0xE8,
-    0x28, 0xBE, 0x9C, 0x94, 0x10, 0x0E, 0x99, 0xC6, 0x45, 0xC3, 0xD8, 0x4B, 0x8D, 0xFA, 0xC4, 0xA9,
-    0x13, 0xA7, 0x98, 0x5D, 0xE1, 0x76, 0x8D, 0x9B, 0x5C, 0x98, 0xAE, 0xD0, 0x47, 0xE2, 0xF1, 0x1E,
-    0x73, 0x18, 0x1B, 0xF6, 0x3C, 0x48, 0x5B, 0x29, 0xCC, 0x32, 0xCC, 0x36, 0x31, 0x2B, 0xB0, 0x18,
-    0xA1, 0x1A, 0x25, 0xE5, 0x88, 0x85, 0x82, 0xDB, 0xAC, 0x1F, 0xED, 0x85, 0x30, 0x18, 0x6B, 0xF9,
-    0x27, 0x5E, 0xCF, 0x1A, 0xEA, 0x25, 0xD7, 0x52, 0x71, 0x15, 0xF1, 0xF6, 0x15, 0x56, 0x27, 0xBA,
-    0xB1, 0xD7, 0x88, 0x1F, 0x03, 0x79, 0x2B, 0x50, 0x46, 0xB9, 0x64, 0x97, 0xD4, 0x58, 0x8F, 0x86,
-    0x70, 0xBB, 0xD3, 0x86, 0x1B, 0xD7, 0x76, 0x32, 0x69, 0xF2, 0xB9, 0xF4, 0x64, 0xB9, 0xB0, 0x33,
-    0xA6, 0x1B, 0xD1, 0xBB, 0x06, 0xB5, 0x86, 0xF0, 0xE4, 0xCB, 0x3D, 0x16, 0x06, 0x3C, 0x6C, 0xF6,
-    0x6D, 0x2C, 0x04, 0x9D, 0xC3, 0x03, 0x54, 0xC0, 0x07, 0x01, 0x7F, 0x78, 0xF6, 0x9D, 0x93, 0xC2,
-    0xAE, 0xEF, 0xFE, 0xD4, 0xAB, 0xAF, 0xA1, 0x4C, 0xB4, 0x6F, 0x6C, 0x92, 0xC9, 0x59, 0x52, 0x57,
-    0x9C, 0x80, 0x0D, 0x81, 0xBB, 0x2D, 0xA0, 0x3D, 0xD7, 0xED, 0x5D, 0x17, 0x5F, 0x64, 0x61, 0x83,
-    0x85, 0x21, 0xF7, 0xBD, 0xE5, 0x69, 0x63, 0xC3, 0x9F, 0x7B, 0x65, 0x7C, 0x0A, 0x4D, 0x49, 0x8C,
-    0xAF, 0x31, 0xFF, 0xC8, 0xCE, 0xA4, 0x9D, 0x89, 0xF8, 0x3B, 0x54, 0x26, 0xF6, 0x77, 0x85, 0xB4,
-    0x2E, 0xB3, 0x3A, 0x74, 0xE1, 0x1F, 0x30, 0xEA, 0x49, 0x4D, 0x3D, 0x4E, 0x0D, 0x8E, 0x0D, 0x80,
-    0xCE, 0xB3, 0xB1, 0x1C, 0x14, 0x78, 0x67, 0x59, 0xD1, 0x26, 0x0B, 0x7A, 0x35, 0x9E, 0xF1, 0x5B,
-    0xE0, 0xB5, 0x21, 0x07, 0xD2, 0x6D, 0x5F, 0xF0, 0x30, 0x4C, 0xC2, 0x90, 0x85, 0xDE, 0xAE, 0x95,
-    0xD7, 0x60, 0x24, 0xF6, 0x4B, 0xDB, 0xE3, 0xAE, 0xE0, 0x7E, 0xD4, 0xA0, 0xA7, 0x9C, 0xAA, 0x2D,
-    0xA5, 0x70, 0x57, 0xE9, 0xB0, 0x89, 0xAB, 0x0B, 0x64, 0x0E, 0xB8, 0xD7, 0xB0, 0x34, 0x58, 0x9D,
-    0x9F, 0x13, 0x6E, 0x96, 0x31, 0x32, 0x39, 0x27, 0xF4, 0xEA, 0x72, 0x75, 0x72, 0x76, 0xD3, 0x4E,
-    0xB4, 0x44, 0xA2, 0x63, 0xBD, 0x17, 0x31, 0x5D, 0xEA, 0x28, 0x6A, 0x98, 0x65, 0x3B, 0x14, 0xB7,
-    0x41, 0x11, 0xBA, 0x7F, 0xD2, 0xC4, 0x14, 0xA0, 0x1B, 0x84, 0xA6, 0x88, 0x45, 0xD3, 0x3F, 0xE9,
-    0x7F, 0xB0, 0xAC, 0x72, 0xD1, 0xD4, 0xB7, 0x8C, 0x97, 0x32, 0x35, 0xB1, 0xE0, 0xB1, 0xC0, 0x4F,
-    0x76, 0xC4, 0x67, 0xAE, 0xCD, 0x6C, 0xCE, 0xED, 0x80, 0x9B, 0xA9, 0xD0, 0x4F, 0x15, 0xA6, 0x19,
-    0x06, 0x5F, 0xED, 0x64, 0x5B, 0x0E, 0x4F, 0x20, 0xB6, 0xF5, 0x8A, 0xD4, 0xB9, 0xC2, 0x60, 0x88,
-    0xF9, 0x29, 0xA6, 0x88, 0x28, 0xDE, 0x8B, 0x53, 0x83, 0x76, 0xE5, 0x96, 0x5D, 0x61, 0x2E, 0x4F,
-    0xFC, 0x20, 0xF1, 0x53, 0xE6, 0xA6, 0xDC, 0xD2, 0x09, 0x79, 0x27, 0xEE, 0xBE, 0x61, 0x3E, 0xE5,
-    0xD6, 0x27, 0xBF, 0x1B, 0xBC, 0x6C, 0x54, 0x0D, 0x91, 0xFC, 0x0A, 0xAE, 0x70, 0x47, 0xEA, 0x0B,
-    0xEE, 0x92, 0x0B, 0xB4, 0xFA, 0xFA, 0x35, 0xBA, 0xCC, 0x04, 0xB2, 0xF4, 0x0B, 0xBB, 0xDE, 0xB0,
-    0xE4, 0x6B, 0x71, 0xD2, 0xB4, 0x0C, 0x5D, 0xCA, 0x58, 0x17, 0xA1, 0x21, 0x5B, 0x5A, 0x1D, 0xDB,
-    0x57, 0x35, 0xFC, 0x29, 0x0D, 0x96, 0x5B, 0x4F, 0xB2, 0x73, 0xC5, 0x5D, 0x5B, 0xE0, 0xCE, 0x7D,
-    0xAC, 0x04, 0x64, 0x17, 0xC8, 0x69, 0x88, 0x75, 0x70, 0xA4, 0x70, 0xC8, 0x5C, 0xCB, 0x08, 0xCB,
-    0x8D, 0xD0, 0xF2, 0x7F, 0x33, 0x2E, 0xD7, 0x99, 0x5E, 0x6D, 0x7D, 0x78, 0x86, 0xF4, 0xF8, 0xFB,
-    0x21, 0xD4, 0xC9, 0xB3, 0x1C, 0x29, 0xF3, 0x39, 0x88, 0xAB, 0x0B, 0x62, 0x3B, 0x42, 0x4E, 0xA6,
-    0x80, 0x18, 0x03, 0x8E, 0x24, 0xFE, 0xC2, 0xA1, 0x24, 0xEF, 0x56, 0x5B, 0x3A, 0x6D, 0x54, 0xA5,
-    0xAF, 0x54, 0xF5, 0xE8, 0x54, 0xFC, 0x12, 0xB8, 0x1F, 0x08, 0x3B, 0xA0, 0x98, 0xC4, 0x54, 0x21,
-    0xB4, 0x99, 0xEB, 0x08, 0xFD, 0xFE, 0x15, 0xB1, 0xC6, 0x61, 0x36, 0xA0, 0x5E, 0x8B, 0xFE, 0x43,
-    0x6C, 0x19, 0xC5, 0x4C, 0x1C, 0x0B, 0x1E, 0xF8, 0x86, 0x06, 0x04, 0x1E, 0x48, 0x74, 0xDB, 0x8D,
-    0xC3, 0x9A, 0xEB, 0xF4, 0x3C, 0xDD, 0xB9, 0xAD, 0x37, 0x35, 0xFF, 0x00, 0x6D, 0x57, 0x4F, 0x6C,
-    0xDC, 0x68, 0x15, 0x7F, 0xB6, 0xDB, 0x18, 0xE2, 0x26, 0x2E, 0x52, 0xAB, 0x05, 0x25, 0x8D, 0xF7,
-    0xB0, 0x87, 0x52, 0xB2, 0x75, 0x85, 0x06, 0x14, 0xB4, 0xCD, 0xD8, 0x4B, 0xCF, 0x2B, 0x55, 0x88,
-    0x6E, 0x25, 0xF6, 0x50, 0x24, 0x2E, 0x88, 0x4B, 0x22, 0x58, 0x69, 0x39, 0x64, 0x66, 0xDC, 0xF6,
-    0xC6, 0x0A, 0x91, 0xCB, 0x9E, 0xF6, 0x12, 0xC1, 0x4A, 0xB4, 0x53, 0x89, 0xE4, 0x50, 0xA1, 0x22,
-    0xCD, 0xC4, 0xEE, 0xF6, 0xD0, 0xC3, 0x1E, 0x70, 0x59, 0x15, 0x0E, 0x7B, 0xA8, 0xC5, 0xB6, 0x2C,
-    0x6A, 0x40, 0xF1, 0xAA, 0x6E, 0xE5, 0x24, 0xCE, 0x98, 0xDF, 0xEF, 0xFB, 0x66, 0xA6, 0xB3, 0x12,
-    0xA3, 0xF8, 0xBD, 0x8C, 0xE7, 0xF3, 0xF7, 0xBD, 0x3F, 0xBF, 0xF7, 0x7B, 0xCF, 0x22, 0xFC, 0x78,
-    0x03, 0x88, 0x3D, 0x2F, 0x12, 0x2B, 0x73, 0x23, 0x71, 0x93, 0x69, 0x11, 0x9F, 0xF7, 0x03, 0x8A,
-    0x96, 0x71, 0xE9, 0x52, 0xD8, 0xB3, 0xEB, 0x3A, 0xE9, 0x49, 0x65, 0x41, 0x94, 0x14, 0x85, 0x15,
-    0x2D, 0x1B, 0x39, 0xD6, 0x5D, 0x83, 0xC0, 0x8F, 0x85, 0xE0, 0x61, 0xAC, 0xB6, 0x53, 0x8A, 0x04,
-    0xC2, 0xE1, 0x36, 0x6E, 0x34, 0x83, 0x35, 0xD1, 0x9A, 0x48, 0x5D, 0x57, 0xA2, 0x3F, 0xBF, 0x8F,
-    0x44, 0x3E, 0xC5, 0xB5, 0x13, 0x89, 0x53, 0x97, 0xD2, 0xB9, 0xDF, 0x37, 0x5E, 0xFC, 0xA6, 0x69,
-    0x7F, 0xFA, 0xD6, 0x79, 0xF7, 0xDE, 0x31, 0xF1, 0xED, 0x63, 0x12, 0x38, 0xF3, 0xD2, 0x9E, 0x3E,
-    0x2D, 0xFD, 0x99, 0x86, 0xF4, 0x8E, 0x9D, 0x93, 0x6A, 0x7E, 0x55, 0xAA, 0xD3, 0x5B, 0xD2, 0x6B,
-    0x6C, 0x48, 0xAB, 0x91, 0x4A, 0xF3, 0xDC, 0xDD, 0xC4, 0xFB, 0xF2, 0x93, 0x08, 0xE7, 0x62, 0xE3,
-    0xC7, 0x22, 0xF7, 0x42, 0x31, 0xEE, 0x89, 0x98, 0xF7, 0x65, 0xF2, 0x13, 0x1F, 0xC2, 0x8A, 0xBD,
-    0x38, 0x82, 0x1F, 0x5E, 0x22, 0x15, 0x1C, 0xB3, 0x72, 0x71, 0x22, 0x87, 0x26, 0xBA, 0x34, 0xD1,
-    0x0F, 0xE9, 0xA4, 0x5B, 0x0C, 0xA4, 0x3D, 0xF5, 0xAC, 0x16, 0xD8, 0x31, 0x2B, 0x3D, 0xA3, 0x3A,
-    0x22, 0x95, 0x09, 0x7F, 0x2A, 0xAC, 0x86, 0x80, 0x57, 0x3D, 0x7A, 0xD5, 0xA2, 0x57, 0x81, 0x93,
-    0x9C, 0x13, 0xEF, 0xAF, 0x57, 0xB1, 0x4F, 0xBD, 0x9B, 0x88, 0x51, 0x33, 0x72, 0x06, 0xB7, 0xF1,
-    0xE9, 0xE0, 0x2B, 0x83, 0x6E, 0x25, 0x46, 0x21, 0x6B, 0x62, 0xE6, 0xB2, 0x24, 0xD8, 0xA0, 0xC1,
-    0xB0, 0x1C, 0x17, 0x2B, 0x1D, 0xC5, 0xC6, 0x49, 0x46, 0xA7, 0xBB, 0x35, 0xEC, 0x73, 0x3F, 0xF8,
-    0x31, 0xE2, 0x4F, 0x6B, 0x19, 0xF1, 0xA9, 0xB8, 0x3B, 0x14, 0xD2, 0xE2, 0xBD, 0x1E, 0x05, 0xE3,
-    0x36, 0x35, 0xC0, 0x19, 0x41, 0x9D, 0x8F, 0x7D, 0xF3, 0x71, 0xB0, 0xB1, 0xB7, 0x92, 0x60, 0x53,
-    0xF8, 0xE3, 0x46, 0x30, 0xCE, 0x13, 0x2B, 0xD2, 0x79, 0x7B, 0x29, 0xB8, 0xB3, 0x19, 0x77, 0x91,
-    0x59, 0xE4, 0x8F, 0xE9, 0x10, 0x2D, 0x9C, 0xBA, 0xC6, 0x86, 0x6E, 0x38, 0x5C, 0x22, 0xE7, 0x29,
-    0x6E, 0xE3, 0xB2, 0xEA, 0xC7, 0x0B, 0xE2, 0xD5, 0xC8, 0xCB, 0x69, 0xA3, 0xA6, 0xBD, 0x47, 0xF4,
-    0x79, 0x43, 0xB5, 0xA8, 0x55, 0x43, 0xAB, 0x2D, 0x91, 0x33, 0x1B, 0xFE, 0xD5, 0x9D, 0x54, 0xFC,
-    0x2F, 0xEB, 0x67, 0xC0, 0x80, 0xF5, 0xEC, 0xFA, 0xC1, 0x83, 0x4A, 0xAC, 0xFF, 0x9A, 0x35, 0xCC,
-    0xB6, 0x4B, 0xB3, 0x82, 0x72, 0x72, 0xAB, 0x94, 0x52, 0x9C, 0xD4, 0xCA, 0x11, 0x1A, 0x37, 0xB1,
-    0x33, 0x04, 0x07, 0x16, 0xE3, 0xBB, 0x78, 0xA1, 0x93, 0x20, 0x40, 0x3E, 0x73, 0x93, 0x21, 0x4F,
-    0x3E, 0x6E, 0x4B, 0x53, 0x02, 0x26, 0xA9, 0x29, 0x71, 0x08, 0xD5, 0x92, 0x5A, 0xEC, 0x83, 0xB0,
-    0x67, 0xED, 0x8A, 0x85, 0x80, 0xD9, 0x38, 0xF7, 0xB8, 0xC8, 0xAC, 0xB6, 0x60, 0xFE, 0x2B, 0x09,
-    0xEF, 0x64, 0x16, 0x42, 0xE4, 0xE5, 0x46, 0xBC, 0x2E, 0x76, 0x41, 0x63, 0xED, 0x92, 0xAE, 0x39,
-    0x15, 0x92, 0x21, 0x6E, 0x8F, 0x76, 0xCF, 0xB6, 0x64, 0x55, 0xE4, 0x54, 0x00, 0xE3, 0x01, 0x9F,
-    0xBA, 0x8E, 0x8C, 0xD6, 0x95, 0x0F, 0x9E, 0x88, 0x2C, 0xB9, 0x57, 0x53, 0x99, 0xDE, 0xDE, 0xDC,
-    0xD9, 0x97, 0xE9, 0xC1, 0xE6, 0xC1, 0x53, 0x78, 0x67, 0x7D, 0x8E, 0x48, 0xE5, 0xD6, 0x33, 0xC8,
-    0xCC, 0x38, 0x40, 0xAC, 0x52, 0x98, 0x22, 0x46, 0x42, 0x69, 0x26, 0xB2, 0x2D, 0x32, 0xF7, 0x58,
-    0x96, 0x15, 0xCE, 0x18, 0xBF, 0x80, 0x48, 0xC4, 0xBD, 0x41, 0xCC, 0xB0, 0x9A, 0x85, 0xCB, 0xF0,
-    0x59, 0x39, 0x51, 0x44, 0x55, 0x50, 0x65, 0x04, 0x96, 0xD8, 0x5A, 0x31, 0x22, 0x0D, 0x51, 0xB0,
-    0x5C, 0xA5, 0x72, 0x1E, 0x60, 0xA9, 0x17, 0xF9, 0x1F, 0xD6, 0x91, 0x78, 0x3B, 0x87, 0x01, 0x94,
-    0x5F, 0xAF, 0x13, 0x3A, 0x81, 0xAE, 0xA9, 0x40, 0xC3, 0xA7, 0xAD, 0x73, 0xD8, 0xD7, 0x09, 0xEC,
-    0x69, 0x55, 0x29, 0x65, 0x03, 0x27, 0xEE, 0xDF, 0x15, 0x52, 0xEC, 0x81, 0x0E, 0xCA, 0x45, 0x62,
-    0x73, 0x4F, 0x86, 0xA6, 0xD1, 0x26, 0x31, 0x4B, 0x65, 0x14, 0x6C, 0x34, 0x4A, 0x51, 0xD6, 0x19,
-    0x95, 0xD6, 0x52, 0xA9, 0xD8, 0x65, 0x46, 0xE5, 0x7E, 0x51, 0x00, 0x5B, 0x66, 0xE1, 0x33, 0x83,
-    0x30, 0x74, 0x19, 0xA0, 0x76, 0x13, 0x2F, 0x59, 0x96, 0x57, 0xC5, 0x7D, 0x3A, 0x50, 0xDC, 0xE0,
-    0xD5, 0x48, 0x1D, 0x76, 0xF4, 0x2F, 0x20, 0xA1, 0xC8, 0x4D, 0x00, 0x27, 0x4D, 0x58, 0x1D, 0x70,
-    0x5B, 0xFC, 0x10, 0xD0, 0x2A, 0x3B, 0x83, 0xC1, 0x87, 0x46, 0x84, 0xCD, 0xFB, 0xB2, 0x6D, 0x25,
-    0x66, 0x86, 0xBB, 0x81, 0x95, 0x5A, 0x29, 0x40, 0xED, 0xFF, 0xAD, 0xF0, 0x22, 0x58, 0xEB, 0xE4,
-    0x2C, 0x56, 0xD1, 0xC5, 0xE4, 0x62, 0xDB, 0x0D, 0xE9, 0x0C, 0xE0, 0x0C, 0x00, 0x33, 0x57, 0xC0,
-    0x38, 0x20, 0xC8, 0x4A, 0x14, 0xA4, 0xC4, 0x0E, 0x59, 0xCA, 0xA5, 0xB8, 0xF4, 0x79, 0xA1, 0x94,
-    0x53, 0xD4, 0xE7, 0x2B, 0xA6, 0xA0, 0x92, 0x77, 0xF1, 0x47, 0xBD, 0x55, 0x49, 0x2E, 0x27, 0x07,
-    0x97, 0x9E, 0x1C, 0xBE, 0xFD, 0x24, 0xEC, 0xD4, 0xEA, 0x93, 0x48, 0xDF, 0x8A, 0x7A, 0x78, 0x5C,
-    0x5A, 0x8E, 0xF4, 0xF1, 0xB8, 0xB4, 0x67, 0xA5, 0x7F, 0x8A, 0x7A, 0x51, 0x5A, 0xCC, 0x60, 0x73,
-    0x49, 0x5A, 0xEF, 0x52, 0x6F, 0x49, 0x8B, 0x01, 0x0A, 0x32, 0x69, 0x32, 0x60, 0x41, 0xC2, 0x3F,
-    0x68, 0xB8, 0x16, 0x6A, 0x5E, 0xA4, 0xFB, 0x97, 0x2E, 0x5D, 0x94, 0x93, 0xD8, 0x58, 0x82, 0x0A,
-    0x04, 0x03, 0x61, 0x65, 0x14, 0x39, 0x84, 0x09, 0x71, 0x94, 0xC2, 0xBD, 0xF6, 0x7F, 0xC4, 0x55,
-    0x0A, 0xEC, 0x45, 0xD1, 0xA4, 0x68, 0x51, 0x54, 0x95, 0xFB, 0xF0, 0x9D, 0xA2, 0x72, 0x81, 0xC9,
-    0x21, 0x9E, 0xCD, 0x5A, 0xB1, 0x14, 0xBF, 0x7A, 0x38, 0xF7, 0x17, 0xF1, 0x0D, 0x91, 0x6E, 0xFC,
-    0x11, 0x2D, 0xC4, 0x75, 0xA2, 0xC9, 0x3A, 0x66, 0xD8, 0xDF, 0xAC, 0xE8, 0x33, 0x4F, 0x45, 0x9D,
-    0x21, 0x79, 0xAC, 0x32, 0xB3, 0xD0, 0x7C, 0xE7, 0x31, 0xF0, 0x7E, 0x68, 0xB3, 0xBA, 0x5C, 0xA6,
-    0xC4, 0x43, 0xB5, 0x86, 0x6F, 0x80, 0x2E, 0xA2, 0xCF, 0x12, 0x71, 0x77, 0xDE, 0x3F, 0x88, 0xEC,
-    0x01, 0x0B, 0xEB, 0xA2, 0x84, 0xFA, 0xD4, 0x33, 0xDD, 0xEE, 0x86, 0xC4, 0xF5, 0x04, 0xD9, 0x68,
-    0xEC, 0x40, 0xF4, 0x41, 0x38, 0x56, 0x06, 0x0C, 0xA2, 0x8A, 0x13, 0x54, 0xAD, 0x19, 0x2A, 0x4B,
-    0x5E, 0xF2, 0xD4, 0xF4, 0xA0, 0x1B, 0x92, 0x3E, 0x42, 0x19, 0xC2, 0x5E, 0xD5, 0x05, 0xD0, 0x60,
-    0xAB, 0xAF, 0xD9, 0x58, 0x8C, 0x7F, 0x05, 0x54, 0x7E, 0x8A, 0x12, 0xFA, 0x30, 0x25, 0x9C, 0x42,
-    0x8D, 0x57, 0x3C, 0x72, 0x17, 0x18, 0x98, 0x1B, 0xBC, 0x09, 0x30, 0x2A, 0xDC, 0x10, 0xA2, 0x6C,
-    0x34, 0x19, 0xCB, 0xC0, 0x49, 0xCF, 0x2A, 0x0E, 0xBD, 0x43, 0xF9, 0x31, 0xB7, 0x73, 0x7F, 0x87,
-    0x27, 0xA7, 0xE3, 0xBA, 0xFB, 0x11, 0xC0, 0xA3, 0x9A, 0x51, 0xA0, 0x28, 0x36, 0x50, 0x35, 0xD8,
-    0x56, 0x87, 0xB7, 0xD4, 0x71, 0x7D, 0x93, 0x88, 0xAF, 0x14, 0xDE, 0x2B, 0x19, 0xA8, 0xF3, 0x3B,
-    0x22, 0xAF, 0x1C, 0x4A, 0x90, 0xC2, 0xE9, 0xC4, 0x21, 0xB3, 0x03, 0x2B, 0x80, 0xF8, 0x66, 0xE2,
-    0xB2, 0xE1, 0x9D, 0x32, 0x4A, 0x2B, 0x5A, 0x34, 0xD1, 0xF0, 0x68, 0x04, 0x2D, 0x59, 0x27, 0x4D,
-    0xA6, 0xEC, 0x2D, 0x6C, 0x32, 0xFC, 0x07, 0xAD, 0x40, 0x8E, 0xB8, 0x9F, 0x91, 0x61, 0x09, 0xE3,
-    0x0E, 0x32, 0x36, 0x47, 0x67, 0xBE, 0x1D, 0x8C, 0xDB, 0x68, 0x9B, 0xA2, 0x4F, 0x2A, 0xAF, 0x27,
-    0xA8, 0xFC, 0xB8, 0x8C, 0x99, 0x54, 0x25, 0x3C, 0xD1, 0xFA, 0x9D, 0x75, 0xA5, 0xB6, 0xE3, 0x6D,
-    0x5D, 0x12, 0x6B, 0x8E, 0xFE, 0xA1, 0x34, 0x33, 0xA5, 0x0B, 0x29, 0xD4, 0xF2, 0x5C, 0xEE, 0x88,
-    0x0E, 0xE9, 0x9A, 0xD2, 0xA9, 0x26, 0x72, 0x04, 0x69, 0x59, 0x74, 0xAF, 0x51, 0xDA, 0x1D, 0xE9,
-    0x48, 0xB7, 0x15, 0x10, 0xC5, 0x1A, 0x9B, 0x16, 0xA8, 0xBF, 0xE7, 0x55, 0xAA, 0x55, 0x94, 0xBF,
-    0xF6, 0x89, 0x2A, 0xA3, 0xC8, 0xDD, 0xF0, 0x5B, 0xCB, 0x70, 0x32, 0x77, 0xC2, 0x3F, 0xA3, 0xDE,
-    0xEE, 0x42, 0xA7, 0x7D, 0xF1, 0x7E, 0x98, 0xBB, 0xB2, 0xF1, 0xF9, 0x83, 0xBE, 0x55, 0xBE, 0x8E,
-    0x32, 0x88, 0x53, 0xEB, 0x91, 0xB2, 0x40, 0xB7, 0x7A, 0x1E, 0x35, 0xC4, 0xAC, 0x3B, 0x04, 0x91,
-    0x37, 0xEA, 0x53, 0x43, 0xBD, 0x3C, 0x06, 0x92, 0x87, 0x07, 0xFB, 0x30, 0xB7, 0x58, 0x00, 0xB9,
-    0xCE, 0x8A, 0x31, 0xBA, 0x0A, 0x4C, 0x0A, 0x25, 0x28, 0xBB, 0x02, 0x55, 0xF7, 0x50, 0x85, 0xAC,
-    0xC0, 0x20, 0x55, 0x45, 0x77, 0x1C, 0xED, 0x7B, 0x15, 0x57, 0x11, 0x64, 0x66, 0xF5, 0x5E, 0x6E,
-    0xB5, 0xFF, 0x59, 0x38, 0x5E, 0x52, 0x1D, 0x73, 0xC3, 0xEA, 0xF4, 0x94, 0x0A, 0x6A, 0x53, 0x5D,
-    0x96, 0x9C, 0x15, 0x27, 0xC4, 0x95, 0x9C, 0x17, 0x6B, 0x1F, 0xE7, 0x00, 0x3E, 0x9D, 0xFA, 0xDF,
-    0xF8, 0xED, 0xCA, 0x3E, 0xC6, 0x00, 0xC0, 0xC7, 0xC9, 0x28, 0x81, 0x04, 0x8B, 0x8C, 0x10, 0x1A,
-    0x57, 0x1E, 0xBE, 0xCD, 0x26, 0x9C, 0x00, 0x15, 0x53, 0x9B, 0x4F, 0x6F, 0xED, 0xA9, 0xE4, 0x1F,
-    0x72, 0x32, 0xE0, 0x4A, 0xF4, 0x23, 0xB2, 0xEE, 0x4F, 0x08, 0xFD, 0x4E, 0xBD, 0x3E, 0x4C, 0xA0,
-    0x46, 0xFA, 0x57, 0xA4, 0xA6, 0x51, 0x45, 0xEA, 0x32, 0xA7, 0x88, 0xAC, 0x56, 0xCD, 0x73, 0xF4,
-    0x61, 0xD6, 0x56, 0xB0, 0x81, 0xBD, 0xBF, 0x5B, 0x8A, 0x7F, 0xF7, 0x5E, 0x25, 0xDB, 0x66, 0x52,
-    0x81, 0x86, 0x23, 0x30, 0xB1, 0x15, 0x86, 0x6E, 0x8A, 0xB6, 0xE6, 0x25, 0x36, 0x8B, 0xDD, 0xC1,
-    0x89, 0xE1, 0x2C, 0x0F, 0x47, 0x40, 0x3A, 0xB2, 0xD0, 0xBD, 0xD1, 0x91, 0xB3, 0x71, 0xD9, 0x96,
-    0x25, 0x2F, 0x69, 0x4B, 0xC3, 0x8B, 0x3A, 0xD2, 0xF0, 0xC3, 0x40, 0x56, 0xD9, 0x2D, 0xB7, 0x50,
-    0xD4, 0x59, 0x06, 0xCF, 0x07, 0xFF, 0x3A, 0xA4, 0x8D, 0xE8, 0x40, 0x66, 0x3A, 0x01, 0xA4, 0x97,
-    0x29, 0x09, 0x54, 0x82, 0x3A, 0x4A, 0x2A, 0x5A, 0x31, 0x1F, 0x51, 0x5A, 0x9F, 0xA8, 0x59, 0x4D,
-    0xCD, 0x44, 0x0B, 0xE8, 0xBD, 0x06, 0xE3, 0x52, 0x19, 0xDD, 0xFD, 0x5B, 0xFB, 0x37, 0xD8, 0xFC,
-    0x72, 0x6E, 0x08, 0x69, 0x5C, 0x7E, 0x78, 0xF9, 0xF9, 0x45, 0x46, 0x07, 0xC8, 0x5D, 0xE0, 0x8C,
-    0x03, 0xA8, 0xD1, 0xED, 0xDB, 0x2A, 0x04, 0x9C, 0x94, 0x54, 0x65, 0x57, 0xE0, 0x6B, 0x4E, 0x2B,
-    0x31, 0x3A, 0x44, 0x3D, 0x32, 0x22, 0xC6, 0x6A, 0xFB, 0x79, 0xCC, 0x40, 0x7B, 0x91, 0x6A, 0xF6,
-    0xC0, 0x87, 0x3B, 0x1E, 0x84, 0xFC, 0x68, 0xBA, 0xDB, 0xAD, 0x37, 0x58, 0xB9, 0x19, 0x0C, 0xC8,
-    0x87, 0x4C, 0x10, 0x97, 0xAC, 0x13, 0xD4, 0xA2, 0xC3, 0xB8, 0xBA, 0xE3, 0xA9, 0x6D, 0x24, 0x5E,
-    0x13, 0x87, 0x54, 0x67, 0x0D, 0x36, 0x71, 0x6E, 0x3C, 0x1E, 0xC4, 0x86, 0x1F, 0x2E, 0x5F, 0xC1,
-    0x4D, 0xFB, 0x60, 0x17, 0x84, 0x77, 0xFD, 0xFD, 0x1C, 0xBD, 0xE7, 0x42, 0x8E, 0x90, 0x5F, 0x80,
-    0x3B, 0xB6, 0x81, 0xFD, 0x1C, 0x86, 0x7C, 0x96, 0xC7, 0xCF, 0x30, 0xE4, 0xF3, 0x0C, 0xF9, 0x3C,
-    0x43, 0xBE, 0x48, 0xB1, 0xC4, 0x92, 0x6D, 0x50, 0xAC, 0xF2, 0xEB, 0x16, 0x7F, 0xCD, 0xB8, 0x38,
-    0xFD, 0x26, 0x42, 0x9E, 0xDE, 0x06, 0x82, 0x76, 0x73, 0x86, 0x1C, 0x11, 0xB5, 0x08, 0x0D, 0x8B,
-    0x87, 0x1B, 0x6A, 0x62, 0x1E, 0xCF, 0x8C, 0x15, 0xCB, 0xA3, 0x64, 0xF1, 0x16, 0x30, 0xF8, 0x3B,
-    0x83, 0xCD, 0xA7, 0xCA, 0x23, 0x94, 0x97, 0xCF, 0xAA, 0x65, 0x5B, 0x4F, 0x9B, 0x2C, 0xA2, 0x65,
-    0x16, 0x6B, 0x8B, 0x6E, 0xB1, 0x9D, 0x47, 0x15, 0x09, 0x9F, 0x3D, 0x94, 0x71, 0x0E, 0xC8, 0x7C,
-    0x4D, 0x73, 0x24, 0x5A, 0xE6, 0x5E, 0x08, 0xC2, 0x55, 0xF8, 0x3A, 0x2A, 0xE3, 0x4E, 0x81, 0x85,
-    0xDE, 0xC3, 0x01, 0xED, 0x0D, 0x98, 0x05, 0x96, 0x34, 0xF3, 0x44, 0x60, 0xEA, 0xE6, 0xAE, 0x60,
-    0xC9, 0x2A, 0x90, 0x40, 0x0D, 0x1F, 0x2A, 0x60, 0xBA, 0xC1, 0xA8, 0xC1, 0x5D, 0x31, 0x72, 0x21,
-    0x47, 0x4F, 0xFC, 0xA8, 0x90, 0x37, 0xFE, 0xF4, 0xA2, 0x90, 0x3F, 0xFC, 0xF6, 0xFB, 0xB9, 0xFC,
-    0x71, 0xFE, 0x57, 0xE8, 0x1C, 0x8B, 0x78, 0xCE, 0x23, 0x8D, 0xCF, 0xFE, 0x00, 0xC7, 0xCE, 0x7C,
-    0x0F, 0x4F, 0x7D, 0xED, 0xD5, 0x48, 0x0D, 0xFE, 0x75, 0x34, 0xD5, 0xED, 0x76, 0x27, 0x02, 0xCF,
-    0x34, 0x8A, 0x77, 0xF9, 0xF9, 0x8A, 0x2C, 0x5A, 0xA8, 0xEB, 0x25, 0x2B, 0x9B, 0x91, 0x86, 0x9D,
-    0xCE, 0x0C, 0x47, 0xDF, 0x89, 0xF9, 0x77, 0xD4, 0xD7, 0x26, 0x5E, 0x36, 0x9A, 0x63, 0x31, 0xA6,
-    0x4A, 0x9F, 0x80, 0x40, 0xB9, 0x0E, 0xCC, 0x5B, 0x83, 0x9B, 0xBA, 0xDE, 0xDA, 0x6A, 0x39, 0x0E,
-    0x2A, 0xA7, 0x55, 0x3B, 0xEC, 0xEB, 0x3A, 0x84, 0x0B, 0x67, 0x38, 0xED, 0x3F, 0xD6, 0x9B, 0x01,
-    0x6A, 0x0A, 0x35, 0xF4, 0x8C, 0xD3, 0x97, 0x0A, 0x83, 0xA2, 0x67, 0xA4, 0xCB, 0x19, 0xE5, 0xCE,
-    0xDB, 0x93, 0xC9, 0x57, 0x17, 0x27, 0x41, 0xFF, 0x71, 0xEE, 0xA7, 0x43, 0x26, 0xE7, 0x74, 0x63,
-    0xD5, 0x61, 0x28, 0x53, 0x3E, 0x2D, 0x0D, 0x18, 0xCE, 0x38, 0x3C, 0x2D, 0xCE, 0xA1, 0xC4, 0xF2,
-    0xF5, 0x35, 0xB6, 0x8E, 0x9E, 0x9E, 0x44, 0x5C, 0x06, 0x9C, 0x34, 0x26, 0xAF, 0x6B, 0x5E, 0x9E,
-    0xDB, 0x9B, 0x63, 0x47, 0x19, 0x8E, 0x35, 0xA2, 0x40, 0xBC, 0x4C, 0x9A, 0x5E, 0xE5, 0xC8, 0xB1,
-    0x85, 0x78, 0xC8, 0x5F, 0x56, 0x10, 0x53, 0x00, 0x62, 0x20, 0xD3, 0x3D, 0x32, 0xE6, 0x22, 0xD8,
-    0x0B, 0xC0, 0xC3, 0x88, 0xD2, 0xE0, 0x9C, 0xFB, 0xDE, 0x5B, 0x2E, 0x81, 0x0D, 0x38, 0xBE, 0xD8,
-    0xC1, 0x60, 0x95, 0x5D, 0x8F, 0x74, 0x15, 0x30, 0x07, 0xF2, 0x0D, 0x0A, 0x83, 0x83, 0x12, 0xDE,
-    0xC5, 0x58, 0x00, 0x71, 0xA2, 0xDF, 0x0A, 0x64, 0xD8, 0xC7, 0x37, 0x46, 0xC4, 0xA3, 0x4A, 0xC1,
-    0x48, 0x99, 0x6D, 0xC4, 0xD3, 0xFD, 0xE2, 0x11, 0xA6, 0x1A, 0xEB, 0x5A, 0x89, 0xDE, 0x16, 0x56,
-    0x66, 0x6E, 0x4B, 0x0F, 0x1D, 0x1D, 0x23, 0x11, 0x4A, 0xA1, 0xE5, 0x26, 0x33, 0x98, 0x8C, 0xA2,
-    0x79, 0xB4, 0x85, 0x70, 0x51, 0x2A, 0x1F, 0x16, 0x55, 0x01, 0x2C, 0x2A, 0x9B, 0xD2, 0x30, 0x0A,
-    0x4C, 0xCE, 0x66, 0xDE, 0xC3, 0x5C, 0x0C, 0x91, 0x71, 0x5C, 0xE7, 0x58, 0x39, 0xB7, 0xBF, 0x99,
-    0xEA, 0x29, 0xD7, 0xCA, 0x80, 0x36, 0x8B, 0xD3, 0x1D, 0x22, 0x89, 0x79, 0x3F, 0xD1, 0x73, 0x88,
-    0x9E, 0xF5, 0xC1, 0x42, 0x7E, 0x64, 0xC6, 0xBB, 0x87, 0x7C, 0x1D, 0x09, 0x27, 0xB2, 0x3D, 0x5D,
-    0xDF, 0xE4, 0xD8, 0x70, 0x73, 0x72, 0x8A, 0x10, 0x86, 0xD9, 0x56, 0xA9, 0xD2, 0x34, 0xAA, 0xCA,
-    0x6A, 0x8A, 0x6F, 0x1D, 0xD3, 0xE7, 0x86, 0xEF, 0xAB, 0xC6, 0x21, 0x1C, 0x76, 0xFE, 0x73, 0x0B,
-    0x54, 0xF2, 0xF3, 0x7F, 0x24, 0xD2, 0x7C, 0xED, 0x63, 0x54, 0x05, 0x81, 0x59, 0x7E, 0x37, 0x02,
-    0x13, 0xFF, 0x92, 0x13, 0xC8, 0xCF, 0x26, 0x07, 0x8D, 0x97, 0xC2, 0x54, 0x73, 0x47, 0x31, 0x3E,
-    0x4D, 0xE1, 0x0D, 0xED, 0x45, 0x4E, 0x5E, 0x46, 0x69, 0x05, 0xA4, 0xEE, 0x8E, 0x7A, 0x5D, 0x12,
-    0x83, 0xAF, 0x3D, 0x36, 0x5F, 0x7A, 0x9C, 0x45, 0x92, 0xD1, 0x1D, 0xFA, 0x5B, 0x73, 0x1B, 0xCC,
-    0x83, 0x76, 0x06, 0x18, 0x3B, 0x29, 0x45, 0xE2, 0x72, 0x24, 0x52, 0x02, 0xA8, 0xF3, 0x22, 0x00,
-    0xD4, 0xDF, 0x29, 0x86, 0x6D, 0x3E, 0x20, 0xF0, 0x9A, 0x04, 0xAD, 0xAA, 0xCD, 0xBE, 0x2E, 0x50,
-    0x25, 0xDA, 0x2C, 0x50, 0x84, 0xA4, 0x40, 0xFF, 0xB1, 0xF7, 0x56, 0x32, 0x9C, 0xCB, 0x0C, 0xE2,
-    0x75, 0x17, 0x82, 0x33, 0xC1, 0x09, 0xA0, 0xF1, 0x7F, 0x63, 0x60, 0x60, 0xB0, 0xFF, 0xEF, 0x50,
-    0xFF, 0x9F, 0x01, 0x08, 0x00, 0xD5, 0x94, 0x31, 0x92, 0xD3, 0x40, 0x10, 0x45, 0xDB, 0x36, 0xCB,
-    0x14, 0xA5, 0x60, 0x08, 0x28, 0x12, 0x02, 0xA7, 0x44, 0xE8, 0x02, 0xBB, 0x96, 0xF6, 0x06, 0x1B,
-    0xC0, 0x39, 0x1C, 0x41, 0x64, 0x97, 0x75, 0x84, 0x3D, 0xC7, 0x26, 0x24, 0x04, 0x04, 0x5A, 0x76,
-    0x8E, 0xA0, 0x23, 0x28, 0xC5, 0x91, 0x02, 0x05, 0x0A, 0x64, 0x8B, 0xFF, 0xBB, 0x5B, 0xC6, 0x37,
-    0xA0, 0x50, 0x30, 0x6D, 0xB5, 0xE5, 0xEE, 0x7E, 0xE3, 0xA7, 0x11, 0xC1, 0xB5, 0x78, 0xC0, 0x72,
-    0xE8, 0x8B, 0x13, 0x3E, 0xF6, 0xE3, 0x50, 0x88, 0xAC, 0x9A, 0x6F, 0xDD, 0x27, 0x91, 0x2C, 0xAD,
-    0xDA, 0x77, 0x22, 0x31, 0x85, 0x06, 0x4F, 0xC4, 0x2A, 0x4B, 0x08, 0xDB, 0xE3, 0xF7, 0xA3, 0x48,
-    0x98, 0x70, 0xE1, 0xAE, 0x40, 0x1A, 0x61, 0x23, 0xEB, 0x12, 0x61, 0x2F, 0x39, 0x0B, 0xEE, 0x90,
-    0xC6, 0x55, 0x23, 0x8D, 0x6B, 0xB4, 0x30, 0xE0, 0x5B, 0x36, 0x40, 0x5A, 0x64, 0xD9, 0x21, 0x8D,
-    0x3E, 0x1D, 0xD2, 0x08, 0x2D, 0xD2, 0x0C, 0x48, 0xA3, 0x74, 0xA3, 0x01, 0xCD, 0x19, 0x22, 0x66,
-    0xD0, 0xE6, 0x3A, 0xC3, 0xBA, 0xD4, 0x19, 0xBC, 0xAB, 0xB5, 0x7B, 0x3F, 0xDC, 0x3C, 0x33, 0xF7,
-    0xB8, 0xE6, 0x83, 0xEC, 0xF1, 0x99, 0xEB, 0x61, 0x2A, 0xD9, 0x2E, 0x4F, 0xC4, 0x89, 0x89, 0x05,
-    0xDF, 0x68, 0x21, 0xB9, 0xAC, 0xDB, 0xE3, 0x53, 0xA9, 0x24, 0x15, 0x4B, 0x92, 0x60, 0xA3, 0x15,
-    0xF7, 0x3A, 0xFF, 0x4E, 0xE7, 0xAE, 0x75, 0xEC, 0x11, 0x77, 0x44, 0xA8, 0x95, 0x60, 0x54, 0x80,
-    0x41, 0xE7, 0xEF, 0xE7, 0xF1, 0x6D, 0x0D, 0xCD, 0xE2, 0xDC, 0xA2, 0x95, 0xBC, 0x54, 0xC2, 0xA6,
-    0x73, 0x2B, 0xDD, 0x1E, 0xDB, 0x16, 0x2D, 0x88, 0xA9, 0x35, 0xF1, 0x28, 0x3E, 0xF3, 0x83, 0xCD,
-    0xDC, 0xB1, 0xC1, 0xBA, 0xE3, 0xCC, 0x59, 0xCB, 0x99, 0x89, 0x6D, 0x3B, 0x1F, 0x2B, 0x16, 0xDC,
-    0xFE, 0x46, 0xC1, 0x30, 0x9D, 0xE2, 0xBF, 0x9F, 0x19, 0x75, 0xBF, 0xE8, 0xD4, 0x7D, 0x3E, 0x25,
-    0x75, 0x67, 0x8C, 0x3A, 0xF9, 0xD7, 0x2E, 0xB4, 0x66, 0xCF, 0xB2, 0xBC, 0xE8, 0x33, 0xFB, 0xA3,
-    0x02, 0x3D, 0x55, 0x66, 0x10, 0x7F, 0x57, 0x38, 0x19, 0x1D, 0x62, 0xE4, 0xBF, 0xCA, 0x01, 0x76,
-    0xCE, 0x57, 0x3B, 0xE1, 0xE8, 0x8C, 0x14, 0x69, 0xE3, 0x26, 0xDD, 0xB9, 0x4A, 0x7B, 0x77, 0xA9,
-    0x76, 0xA6, 0xDA, 0x6D, 0x1A, 0x49, 0x87, 0x6F, 0x7E, 0xFD, 0x30, 0x9F, 0x8A, 0xC6, 0x84, 0x7A,
-    0x75, 0x31, 0x6A, 0x56, 0x6A, 0x76, 0x6A, 0x76, 0xD8, 0xAD, 0xBA, 0xD2, 0xEA, 0xAF, 0x59, 0xE0,
-    0x1D, 0x8C, 0x37, 0xEB, 0xED, 0x65, 0xA1, 0xAA, 0xCA, 0xDB, 0x19, 0x2F, 0xEF, 0xC9, 0x4B, 0x77,
-    0xC9, 0x8B, 0x56, 0xCA, 0x9B, 0xFD, 0x4F, 0xBC, 0x37, 0xEA, 0xA4, 0x1C, 0xCE, 0x5C, 0x97, 0xBD,
-    0xAA, 0x11, 0x9A, 0x90, 0xEC, 0xE5, 0xB4, 0x23, 0x41, 0xEF, 0x8C, 0x03, 0x61, 0x8B, 0x93, 0x41,
-    0xF2, 0x85, 0x9F, 0x0C, 0xEA, 0x8F, 0xB1, 0x38, 0xCA, 0x7C, 0x24, 0x98, 0xA0, 0xC6, 0xE1, 0x8A,
-    0xBA, 0xA3, 0x2E, 0x29, 0xE8, 0xFC, 0x48, 0xB8, 0x0E, 0x00, 0x38, 0xFF, 0x64, 0x73, 0x39, 0xB4,
-    0xDC, 0x67, 0x62, 0x39, 0x85, 0xCB, 0xEA, 0xB6, 0x5A, 0x5D, 0xF7, 0xF5, 0x4A, 0x58, 0x23, 0x5A,
-    0x4E, 0x4A, 0x14, 0x1B, 0xFD, 0x69, 0x5E, 0xAE, 0xEC, 0x48, 0x51, 0xA2, 0x42, 0x74, 0x97, 0x72,
-    0x36, 0x91, 0x0F, 0x93, 0xE4, 0x20, 0x3A, 0xBD, 0xDC, 0x83, 0x68, 0xD5, 0xC6, 0x84, 0x26, 0x21,
-    0x65, 0x15, 0x88, 0x42, 0x7A, 0xCD, 0x5E, 0xF4, 0x9C, 0xE7, 0xE5, 0x49, 0x14, 0x0C, 0x3A, 0xB3,
-    0x73, 0xEE, 0x87, 0xDC, 0xA8, 0x44, 0xF2, 0x4C, 0xA2, 0x8F, 0x78, 0x00, 0xE1, 0x56, 0xEE, 0x88,
-    0x72, 0x2B, 0x3B, 0x86, 0xE2, 0xBE, 0x27, 0x51, 0x36, 0x35, 0x4A, 0xF4, 0x56, 0x48, 0xF4, 0x07,
-    0x35, 0xCE, 0xB1, 0x11, 0xC2, 0x30, 0x0C, 0x40, 0x51, 0x05, 0x15, 0x29, 0x28, 0xCC, 0x06, 0x19,
-    0x21, 0x0D, 0x7D, 0xE8, 0x59, 0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D, 0x8B, 0x30, 0x84, 0x47, 0x70,
-    0xC3, 0x06, 0x29, 0x52, 0x20, 0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE, 0xC5, 0x3B, 0x9D, 0x25, 0xF2,
-    0x3F, 0xC7, 0x1E, 0xFB, 0xBD, 0xCA, 0x29, 0x92, 0x28, 0x91, 0x85, 0x35, 0xD2, 0x1E, 0x81, 0x5A,
-    0x64, 0x76, 0x4C, 0xF9, 0xB5, 0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F, 0x53, 0xF3, 0x29, 0xCC, 0x27,
-    0x13, 0x7C, 0x94, 0xB2, 0xC0, 0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6, 0x09, 0x76, 0x50, 0x47, 0x38,
-    0x43, 0x1E, 0xE0, 0x4E, 0x13, 0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A, 0x8C, 0x4D, 0xC9, 0x22, 0x83,
-    0x69, 0x8B, 0xFF, 0xAE, 0xBA, 0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41, 0x8E, 0xAD, 0xEF, 0x79, 0xE9,
-    0x39, 0xF8, 0xFD, 0x02,
+static const uint8_t notoserif_14_italicBitmaps[38335] = {
+    0xD5, 0x59, 0x4F, 0x8C, 0xDC, 0xE4, 0x15, 0x7F, 0xB6, 0xC9, 0xBA, 0xC5, 0x52, 0x9C, 0x43, 0x20,
+    0x88, 0x25, 0x31, 0x87, 0x1E, 0xAA, 0x28, 0x89, 0x39, 0x70, 0x58, 0xA1, 0xDD, 0xB1, 0x29, 0x07,
+    0x0E, 0x3D, 0x34, 0x07, 0x42, 0xA5, 0xA2, 0xAA, 0x3D, 0xF4, 0x50, 0xD1, 0xC3, 0x70, 0x48, 0xAB,
+    0xA8, 0xDD, 0x1D, 0x5B, 0x20, 0xF5, 0xD2, 0x43, 0x53, 0x09, 0x72, 0xE8, 0x05, 0x0E, 0x1C, 0x60,
+    0x40, 0xDD, 0x55, 0x95, 0x4A, 0x39, 0xCC, 0xEC, 0xB8, 0x45, 0x3D, 0xA1, 0x4A, 0x2E, 0x28, 0xF4,
+    0x52, 0xB5, 0x6E, 0xA1, 0xAD, 0x58, 0x4A, 0x31, 0xC2, 0x28, 0xDE, 0xC5, 0x33, 0xEE, 0xEF, 0xF7,
+    0x3E, 0xCF, 0xEC, 0x26, 0x24, 0x29, 0x12, 0x95, 0xAA, 0xCE, 0xDA, 0x9F, 0x67, 0x67, 0xEC, 0xF7,
+    0xBD, 0x3F, 0xBF, 0xF7, 0x7B, 0xEF, 0xFB, 0x46, 0x22, 0x91, 0x44, 0x64, 0x5B, 0x64, 0x2C, 0xD2,
+    0xE8, 0x51, 0x89, 0x55, 0xF2, 0xB0, 0x0B, 0xB1, 0x73, 0x71, 0x32, 0x3D, 0x52, 0x71, 0x63, 0x31,
+    0xAF, 0x3B, 0x45, 0xA2, 0x58, 0x0F, 0x59, 0xBC, 0xBE, 0x2B, 0x76, 0x29, 0x7E, 0x2A, 0x3D, 0x4A,
+    0xC0, 0x5B, 0xB7, 0x10, 0x3F, 0xE3, 0x11, 0xEA, 0x6D, 0x38, 0x06, 0x3A, 0xC3, 0x68, 0x3E, 0xC9,
+    0x48, 0x8F, 0x75, 0x91, 0x35, 0xE1, 0x43, 0x81, 0x88, 0x97, 0x72, 0x46, 0x39, 0x2B, 0xF2, 0x05,
+    0x11, 0x3F, 0x16, 0x27, 0xA7, 0x12, 0xD0, 0x46, 0xAE, 0xCC, 0x6F, 0x5F, 0x1C, 0x4D, 0x77, 0x58,
+    0xB5, 0xD8, 0x95, 0x38, 0xF3, 0xF9, 0x82, 0x94, 0x33, 0x8D, 0xC5, 0xAA, 0xC4, 0xCD, 0x25, 0x14,
+    0xF9, 0x0E, 0xB4, 0x8D, 0xC3, 0x2C, 0xCC, 0xBD, 0xDC, 0xC9, 0x9C, 0x34, 0x90, 0xCB, 0x46, 0xDD,
+    0xA8, 0x8D, 0x93, 0xD6, 0xD8, 0x12, 0xC5, 0xF8, 0x9B, 0x9B, 0xE1, 0xCD, 0xA0, 0x68, 0x3F, 0xB3,
+    0x2A, 0xA7, 0x70, 0x0A, 0xBB, 0xF4, 0xF0, 0xCE, 0x4F, 0xAD, 0x2A, 0x80, 0xC4, 0x08, 0x67, 0x0F,
+    0xE7, 0x00, 0x33, 0x8E, 0x61, 0xE2, 0x08, 0xD3, 0x36, 0xE2, 0x14, 0x0D, 0xA6, 0x6A, 0xC4, 0xCB,
+    0x1A, 0x98, 0x3F, 0x82, 0x1D, 0x1B, 0x30, 0xA7, 0x07, 0x1D, 0x83, 0x4B, 0xD0, 0xAA, 0x4D, 0x45,
+    0x8E, 0x52, 0x30, 0x74, 0x91, 0x99, 0xCA, 0xB7, 0xC6, 0x63, 0x71, 0x2A, 0x68, 0x1F, 0xE3, 0x84,
+    0xFE, 0x54, 0x96, 0x1E, 0xA3, 0x15, 0x7A, 0xC2, 0x14, 0xF1, 0x72, 0xA1, 0x3D, 0x8B, 0x13, 0x86,
+    0xD1, 0x93, 0xB4, 0xCE, 0x6A, 0x2F, 0x42, 0xFD, 0x99, 0xD1, 0x77, 0xA9, 0x2D, 0x24, 0xBC, 0xD4,
+    0x20, 0x7C, 0xDB, 0xF0, 0x46, 0x04, 0x67, 0x45, 0x72, 0x3F, 0xFD, 0x09, 0x35, 0x44, 0x28, 0x9C,
+    0x42, 0x29, 0x04, 0xFF, 0xAE, 0xE2, 0xA4, 0xFC, 0x4C, 0xDD, 0x2D, 0x17, 0x84, 0xFE, 0x7E, 0x00,
+    0x6E, 0xDF, 0x3A, 0x73, 0xEE, 0xF1, 0x22, 0x6A, 0xDB, 0x3C, 0xC1, 0x69, 0x04, 0xDB, 0x10, 0x2C,
+    0xE1, 0xD5, 0x86, 0xE0, 0x48, 0xE8, 0xF2, 0xA8, 0x1B, 0xBE, 0x64, 0xA2, 0x4E, 0xF1, 0x0C, 0x81,
+    0x6A, 0xBB, 0xB4, 0x1D, 0xD3, 0x34, 0xE2, 0x23, 0xE0, 0xF3, 0xB4, 0x82, 0x71, 0x31, 0xF6, 0x89,
+    0x5D, 0xCB, 0x7D, 0xFC, 0x77, 0x8D, 0x5F, 0x44, 0xE2, 0x23, 0x32, 0x57, 0x27, 0xB1, 0x78, 0x2D,
+    0xBF, 0xBC, 0xCB, 0xCC, 0x47, 0x79, 0xD6, 0x94, 0xCF, 0x52, 0xA8, 0xCF, 0x61, 0x95, 0x5F, 0xFF,
+    0x8A, 0xCE, 0x79, 0x03, 0x83, 0xFB, 0x0C, 0x84, 0x9E, 0xA0, 0xE4, 0x55, 0x07, 0x53, 0x96, 0x2E,
+    0x91, 0xE9, 0x65, 0xE2, 0xC5, 0xF0, 0xCF, 0x99, 0x73, 0xDF, 0xBA, 0x0A, 0xA7, 0xB4, 0xAD, 0xDC,
+    0x75, 0xAE, 0xFF, 0x5C, 0xE7, 0x6E, 0xA3, 0x28, 0x07, 0xAB, 0xA5, 0xEB, 0x5A, 0x48, 0x09, 0xDA,
+    0xA9, 0x84, 0x38, 0x7B, 0xC3, 0x91, 0x3C, 0x08, 0xAD, 0x9E, 0x42, 0x74, 0x20, 0x4D, 0xA0, 0xB5,
+    0x05, 0xB7, 0xD8, 0xBF, 0x05, 0xEC, 0xF0, 0xB5, 0x7D, 0x31, 0x49, 0x8D, 0xE3, 0x19, 0x08, 0x9A,
+    0x68, 0x82, 0x72, 0x04, 0x9F, 0x5D, 0xD1, 0x38, 0x47, 0x92, 0x3C, 0xDE, 0x40, 0x5C, 0xAE, 0x80,
+    0xD5, 0x97, 0x05, 0x97, 0xF9, 0xF0, 0x18, 0x83, 0xDF, 0xC8, 0x3A, 0x42, 0x7A, 0xBF, 0x3E, 0x35,
+    0x0F, 0xE1, 0x8F, 0x5F, 0x94, 0x70, 0x32, 0x93, 0x28, 0x0F, 0x53, 0x38, 0x21, 0xEB, 0x41, 0x1E,
+    0xCF, 0x35, 0x73, 0x66, 0x6B, 0xFA, 0x59, 0x10, 0x07, 0x90, 0xED, 0xBD, 0xD5, 0xA8, 0x38, 0xB9,
+    0x03, 0xCF, 0xB6, 0x6D, 0x1D, 0xB4, 0x6D, 0x75, 0x66, 0xF8, 0x4A, 0xB9, 0x82, 0xA4, 0x78, 0x00,
+    0xF7, 0x1D, 0xD1, 0x00, 0x32, 0xCC, 0xC8, 0x05, 0xE9, 0xF0, 0xE3, 0x76, 0x98, 0xB9, 0xE1, 0x2B,
+    0xE7, 0xC0, 0x57, 0x61, 0xF7, 0x95, 0xC1, 0x3A, 0x94, 0x8F, 0x2E, 0xD5, 0xD0, 0x75, 0x04, 0x08,
+    0xAE, 0x41, 0x44, 0x0F, 0xF7, 0xAE, 0x21, 0x50, 0x23, 0xAB, 0xC1, 0x27, 0x2D, 0x34, 0x8F, 0x10,
+    0x92, 0x00, 0xFE, 0xA8, 0x27, 0xA9, 0x9F, 0x05, 0x79, 0x24, 0x6E, 0xB9, 0x01, 0x89, 0x23, 0xC5,
+    0xBF, 0x5D, 0x02, 0xC9, 0x25, 0xB4, 0xC5, 0x37, 0x49, 0x6C, 0x33, 0x9C, 0x87, 0x3A, 0xD9, 0x01,
+    0xF0, 0x39, 0xD9, 0xCC, 0x9C, 0xCA, 0x65, 0xE6, 0x95, 0x7E, 0x66, 0x97, 0x41, 0x6C, 0x97, 0x21,
+    0x9E, 0x89, 0xF4, 0x74, 0xF0, 0xDE, 0x2B, 0x83, 0x34, 0x2C, 0xBC, 0xBD, 0x36, 0xB7, 0xDA, 0xAF,
+    0x75, 0x5E, 0xEA, 0x40, 0x0E, 0x3C, 0x6C, 0x01, 0xBE, 0x25, 0x14, 0x9A, 0x06, 0x46, 0x0D, 0x2B,
+    0x56, 0x9A, 0x69, 0xAC, 0x86, 0xB8, 0xBE, 0xFE, 0x85, 0x2C, 0x4E, 0xF1, 0xC7, 0xB7, 0xF7, 0xEA,
+    0xF3, 0xC9, 0x01, 0x3B, 0x3F, 0xF5, 0x5A, 0x4A, 0xC5, 0x2F, 0x79, 0xD0, 0x35, 0x05, 0x03, 0xEF,
+    0xC5, 0xB2, 0xB2, 0xF8, 0x9A, 0xD0, 0xF7, 0xDF, 0x62, 0x36, 0x45, 0x80, 0x6C, 0x84, 0xB4, 0x09,
+    0x11, 0x87, 0xB0, 0xC3, 0xD2, 0xD8, 0x80, 0x9A, 0xB8, 0xD8, 0xD6, 0x04, 0xD2, 0xF4, 0x02, 0x3D,
+    0xEE, 0xF3, 0xA3, 0xA1, 0x48, 0xA8, 0xD4, 0x9D, 0xFB, 0x1F, 0xFB, 0x7A, 0x0B, 0x3F, 0x84, 0x8A,
+    0x3A, 0xB6, 0x19, 0x67, 0xFC, 0x33, 0x47, 0xE7, 0x75, 0x8E, 0x1E, 0x25, 0xCB, 0x09, 0x46, 0x4C,
+    0x56, 0x89, 0x1F, 0x39, 0x4F, 0xBC, 0xAB, 0x2B, 0x40, 0xC7, 0x4A, 0x12, 0x57, 0xBF, 0x5E, 0x2A,
+    0x2E, 0x10, 0xDD, 0x13, 0x4A, 0x1F, 0xAB, 0xAA, 0xD3, 0x65, 0xCD, 0xC8, 0x92, 0x23, 0x1F, 0x69,
+    0x64, 0xB9, 0x92, 0xA5, 0x59, 0x4C, 0xCC, 0x61, 0x9A, 0xA8, 0xDD, 0x15, 0x59, 0xDE, 0x9B, 0x14,
+    0x30, 0xDB, 0xA9, 0x31, 0xC0, 0x91, 0x90, 0xDF, 0xD0, 0x94, 0x86, 0xBE, 0xE7, 0x80, 0xE0, 0xFB,
+    0xA9, 0x57, 0x48, 0xB0, 0x83, 0x00, 0x86, 0x64, 0x99, 0x48, 0xE8, 0x7F, 0xC1, 0x67, 0x03, 0x04,
+    0x5F, 0x18, 0x7D, 0xF8, 0x00, 0xEF, 0x1A, 0x7E, 0xC6, 0x67, 0x30, 0x75, 0x94, 0x1E, 0xDB, 0xFD,
+    0xC6, 0x54, 0x26, 0x2D, 0xB8, 0xA9, 0x7B, 0xF5, 0xF1, 0xAC, 0xBB, 0xDB, 0x47, 0xAE, 0xA7, 0x5E,
+    0x09, 0x57, 0x39, 0x25, 0x68, 0xC0, 0xA1, 0xFE, 0x16, 0x19, 0x40, 0x28, 0x16, 0x53, 0xD0, 0x09,
+    0x51, 0x3C, 0x4F, 0xD6, 0x64, 0x31, 0x0C, 0x16, 0x43, 0xB2, 0x48, 0x65, 0xDC, 0x7C, 0x8F, 0xF8,
+    0x05, 0xEC, 0x74, 0x66, 0x9B, 0x30, 0x33, 0x21, 0xBB, 0x6A, 0xFA, 0x45, 0xED, 0x5E, 0x4C, 0xE3,
+    0x36, 0x15, 0xEF, 0xE4, 0x11, 0x65, 0x1A, 0xDA, 0x87, 0x87, 0x60, 0xA0, 0xA9, 0x45, 0x37, 0x1C,
+    0x20, 0x55, 0x53, 0xA0, 0x7C, 0x5A, 0x68, 0xEC, 0xE4, 0xFD, 0x03, 0x55, 0x69, 0x43, 0xA7, 0x46,
+    0xB8, 0xA7, 0x5A, 0xD2, 0x6A, 0x8E, 0xB0, 0x84, 0xD6, 0x66, 0x72, 0x6C, 0xF7, 0x7B, 0xF8, 0xB8,
+    0xB3, 0x17, 0xC4, 0x33, 0x95, 0x60, 0x6F, 0x38, 0xE5, 0xAC, 0xAB, 0x66, 0xC0, 0xCC, 0x2B, 0x9C,
+    0xF8, 0x88, 0xA2, 0xFA, 0xC0, 0x10, 0xEC, 0xBC, 0x2C, 0x4A, 0x41, 0xFB, 0xF4, 0x64, 0xEC, 0x54,
+    0x46, 0x1D, 0x1B, 0x5A, 0xB5, 0x18, 0x0D, 0x87, 0x9E, 0xF5, 0xE0, 0xD9, 0x73, 0x49, 0x3C, 0x21,
+    0xB7, 0x99, 0x89, 0x96, 0x3F, 0xC3, 0x44, 0xF4, 0x0B, 0x4B, 0x46, 0x37, 0xD1, 0x73, 0x8F, 0xDD,
+    0x6A, 0xA2, 0x6E, 0x50, 0x9A, 0x3E, 0x46, 0xFA, 0x9D, 0x90, 0x75, 0xE6, 0x21, 0x84, 0x75, 0xEE,
+    0x5E, 0xBF, 0x96, 0x30, 0x73, 0x58, 0x62, 0xA4, 0xA1, 0x17, 0x6A, 0x42, 0x30, 0xBE, 0x4D, 0x08,
+    0xAD, 0xE1, 0x4B, 0x18, 0x26, 0xF5, 0x80, 0x37, 0x70, 0x48, 0x13, 0xE6, 0xB5, 0x76, 0x01, 0x21,
+    0x0B, 0x34, 0x42, 0xD8, 0x43, 0x08, 0x1F, 0x9F, 0x32, 0x84, 0xEF, 0x2C, 0x42, 0x98, 0x85, 0x98,
+    0x7B, 0x79, 0x16, 0xE3, 0xA0, 0x69, 0x9C, 0x8B, 0x17, 0x53, 0x11, 0x39, 0x29, 0xAC, 0xE4, 0x05,
+    0x26, 0x32, 0x2F, 0x70, 0xE9, 0xAA, 0xA4, 0x92, 0xDE, 0xCE, 0x70, 0x93, 0xF4, 0x01, 0x3F, 0x65,
+    0xAA, 0x49, 0x60, 0x32, 0x8F, 0x7C, 0x32, 0x98, 0x53, 0xCA, 0x3C, 0x81, 0x07, 0xC6, 0xEC, 0x0D,
+    0x73, 0xE9, 0x32, 0xBA, 0x51, 0x0F, 0xB8, 0x98, 0x7C, 0xD2, 0x66, 0x11, 0x89, 0x9D, 0x59, 0xD3,
+    0x29, 0xF3, 0x59, 0x0A, 0xB3, 0x9E, 0x83, 0xCE, 0xC1, 0xE3, 0xCE, 0xB3, 0x5D, 0x8D, 0x3F, 0xA6,
+    0x68, 0xA1, 0xBB, 0x12, 0x8E, 0x01, 0x6B, 0xA5, 0x56, 0x49, 0xCD, 0x70, 0x4D, 0x76, 0xEF, 0x06,
+    0x9C, 0x68, 0xF8, 0xE2, 0x83, 0x65, 0xCC, 0x50, 0xDA, 0xE0, 0x16, 0xE1, 0x23, 0x0F, 0xA8, 0xB7,
+    0x8C, 0xE0, 0x7D, 0xE9, 0xFB, 0x82, 0xC9, 0x61, 0x77, 0x31, 0xCA, 0x49, 0x61, 0x9A, 0xA0, 0x2C,
+    0x69, 0x68, 0x61, 0xA8, 0x2D, 0x54, 0xA0, 0x96, 0xAE, 0xF3, 0x29, 0x4B, 0xBD, 0xED, 0xAA, 0x8D,
+    0x27, 0xF4, 0xE9, 0x2B, 0x1C, 0x9F, 0xE6, 0x63, 0xC1, 0x57, 0xA9, 0x6D, 0x98, 0x50, 0x7E, 0x74,
+    0x4D, 0xC7, 0xA7, 0x39, 0xFF, 0xC0, 0x6A, 0xD4, 0xF6, 0xA9, 0xAA, 0x37, 0x51, 0xD5, 0x08, 0x8B,
+    0x86, 0x41, 0x87, 0x86, 0x00, 0x0B, 0xBC, 0xE0, 0x57, 0xF4, 0x83, 0x3D, 0x35, 0xDE, 0x55, 0xF7,
+    0x7E, 0x4A, 0xDF, 0xFC, 0x3A, 0x47, 0xDC, 0xD2, 0x1B, 0x73, 0x30, 0xC7, 0xF4, 0x06, 0x39, 0xCC,
+    0xBE, 0x31, 0x6B, 0x12, 0x93, 0x35, 0x53, 0xC3, 0xE9, 0xCB, 0x64, 0xA4, 0xF6, 0x2C, 0x0A, 0xBC,
+    0x69, 0x30, 0x1C, 0xE8, 0x78, 0x82, 0x9D, 0x05, 0xE0, 0xF9, 0x10, 0xAE, 0x1E, 0xDC, 0xF3, 0x4B,
+    0xE2, 0x0B, 0x8E, 0x78, 0x5B, 0xAF, 0xA9, 0xF3, 0x1A, 0x14, 0x3A, 0xEC, 0xA7, 0xEE, 0xA3, 0xD0,
+    0xE9, 0xB8, 0x9F, 0xF9, 0xF4, 0xE5, 0x29, 0x3F, 0x3B, 0x4E, 0xA5, 0x56, 0xBD, 0x6C, 0x85, 0xD7,
+    0x15, 0x2F, 0xDF, 0x62, 0xC6, 0x5D, 0x70, 0xF3, 0x02, 0x8F, 0xCA, 0x79, 0xF7, 0xED, 0x8C, 0x9E,
+    0xDE, 0x72, 0xFE, 0xA1, 0x8D, 0x65, 0x89, 0x09, 0x19, 0xB9, 0xC2, 0x99, 0x52, 0x67, 0xAB, 0x00,
+    0xB2, 0xA1, 0xB1, 0x5B, 0xD9, 0x25, 0x1B, 0x93, 0xA4, 0xB5, 0x0A, 0x9F, 0x59, 0x17, 0xA1, 0x26,
+    0x11, 0x71, 0x35, 0x49, 0x5B, 0xFB, 0x20, 0xE2, 0x6E, 0xC6, 0x12, 0x25, 0xEE, 0x44, 0xAC, 0x9C,
+    0x2A, 0xC6, 0x36, 0x83, 0x12, 0x64, 0xDA, 0xD3, 0xF9, 0x39, 0x2F, 0x87, 0xDD, 0x92, 0xE5, 0xE7,
+    0xB8, 0x53, 0xB2, 0x02, 0x9D, 0xB2, 0x6B, 0x4F, 0x7B, 0xBD, 0x86, 0x2D, 0xDF, 0x8A, 0x6C, 0xFB,
+    0xDA, 0xEA, 0x45, 0x0C, 0xE3, 0x79, 0x89, 0xBE, 0x49, 0xC5, 0x24, 0xF8, 0xA7, 0xB6, 0x82, 0xDA,
+    0x66, 0x15, 0xE2, 0xB2, 0x4F, 0x44, 0x8A, 0xC1, 0x07, 0xC7, 0x2A, 0xED, 0xDB, 0xD8, 0x1B, 0x97,
+    0x0B, 0x1E, 0x48, 0xA6, 0x4A, 0xE5, 0xA0, 0xCA, 0x54, 0xC9, 0xDF, 0x52, 0x1E, 0x68, 0x18, 0xB1,
+    0x6D, 0xF2, 0xC0, 0x80, 0x3C, 0x30, 0x20, 0x0F, 0x6C, 0x33, 0xE0, 0xDB, 0x34, 0x7A, 0x4A, 0xDA,
+    0x6E, 0x30, 0x58, 0xCD, 0x80, 0x1D, 0xE0, 0x80, 0x11, 0xC6, 0xBF, 0x5E, 0xA1, 0x4C, 0xAB, 0xAB,
+    0x02, 0x38, 0x0F, 0x4C, 0xB6, 0xFB, 0x44, 0xC9, 0xDC, 0x88, 0xBB, 0x0A, 0x3F, 0x2F, 0x53, 0x58,
+    0x72, 0x94, 0x2E, 0x4B, 0x34, 0xF4, 0x01, 0x20, 0xAF, 0x2F, 0x53, 0x08, 0xB1, 0xD6, 0xAA, 0x20,
+    0xC5, 0x2D, 0x61, 0x4C, 0xE6, 0xFE, 0xB9, 0xF2, 0xE3, 0x0B, 0x9F, 0x85, 0xE3, 0x92, 0x03, 0x1C,
+    0xF7, 0x5F, 0xB3, 0x2D, 0xBA, 0xBD, 0x6D, 0xAE, 0xC2, 0x7B, 0x3F, 0x3B, 0xB5, 0x39, 0x56, 0xDD,
+    0x12, 0x8E, 0x4B, 0xCF, 0x2E, 0x2C, 0xDF, 0xD4, 0x02, 0xAD, 0x19, 0x79, 0x93, 0x02, 0xAD, 0x96,
+    0x33, 0x59, 0x53, 0xB6, 0xD1, 0x43, 0x16, 0xE8, 0x16, 0x02, 0x23, 0x4A, 0x1D, 0x30, 0x74, 0x1B,
+    0x96, 0x52, 0x9A, 0xAE, 0x8E, 0x74, 0x45, 0x97, 0x68, 0xC9, 0x8A, 0x5D, 0x94, 0x28, 0xF4, 0xF7,
+    0x85, 0x5B, 0xCD, 0x57, 0x0E, 0x60, 0xDE, 0xF0, 0xD2, 0x8C, 0x37, 0x47, 0x5C, 0x2A, 0x84, 0x64,
+    0x90, 0xE3, 0x86, 0x46, 0xD4, 0x57, 0x9A, 0xC9, 0xD2, 0x6A, 0x50, 0xA8, 0xB3, 0x3F, 0xD3, 0x26,
+    0x57, 0x33, 0x51, 0xF3, 0xB4, 0x33, 0xE4, 0x41, 0x42, 0xE6, 0x0A, 0xA9, 0xA7, 0xA1, 0xD2, 0x03,
+    0xEA, 0x1B, 0xE6, 0xFD, 0x18, 0xC9, 0x46, 0x31, 0x87, 0xC4, 0xD0, 0x72, 0x11, 0x0D, 0x67, 0x9B,
+    0xC5, 0xAA, 0x55, 0xDB, 0xF9, 0x79, 0xBB, 0xB2, 0xF2, 0x2D, 0x84, 0x96, 0x41, 0x96, 0xF8, 0x36,
+    0xB9, 0xAF, 0x85, 0x2C, 0xBE, 0x45, 0xEE, 0x8F, 0xE7, 0x4A, 0x32, 0x5F, 0x8C, 0x1F, 0x92, 0x36,
+    0x8E, 0x5A, 0x09, 0x76, 0x65, 0x79, 0x97, 0xED, 0x09, 0xDA, 0x20, 0xD6, 0x0E, 0x2D, 0x18, 0x9E,
+    0xCE, 0xE3, 0x6B, 0x00, 0x4E, 0xEB, 0x78, 0x41, 0xF9, 0x92, 0x6D, 0x55, 0x05, 0xF8, 0xC3, 0x72,
+    0x66, 0x93, 0x55, 0x6B, 0x1F, 0x57, 0xFB, 0x8A, 0x9B, 0xD3, 0x3A, 0xAE, 0xEA, 0xB8, 0xC5, 0x71,
+    0xA4, 0xD0, 0x19, 0x64, 0xFB, 0x1D, 0x9C, 0x69, 0xEF, 0xD6, 0x0C, 0xA1, 0xA6, 0x76, 0x6A, 0xA1,
+    0x5D, 0xDF, 0x25, 0xA5, 0xF7, 0x73, 0xC4, 0x1B, 0xB5, 0xCE, 0x57, 0x72, 0x2D, 0xE0, 0x5B, 0x36,
+    0x25, 0x85, 0x29, 0xDC, 0x3F, 0x2A, 0x90, 0x8D, 0xB8, 0x7E, 0x44, 0x05, 0xD0, 0xB2, 0xBC, 0x59,
+    0x5A, 0xAC, 0x6E, 0xF6, 0x6B, 0x25, 0x94, 0xB0, 0x4B, 0xE7, 0x11, 0x26, 0xB3, 0x5D, 0x79, 0xE8,
+    0x9D, 0xA9, 0xDF, 0x61, 0xBB, 0x3C, 0x4E, 0x0D, 0x4F, 0xD9, 0xD5, 0x2A, 0x75, 0x5C, 0xB1, 0xAB,
+    0xF3, 0xBC, 0x6E, 0x59, 0x15, 0x7D, 0x57, 0x17, 0xD6, 0xC7, 0xF4, 0xDC, 0x5E, 0x66, 0x5D, 0xA3,
+    0x6A, 0x08, 0xD2, 0x27, 0xB4, 0xA2, 0xD5, 0x43, 0x57, 0x9E, 0xD3, 0x2E, 0x0F, 0x14, 0x73, 0xE1,
+    0x82, 0xF9, 0xDF, 0x21, 0x0A, 0xD9, 0x96, 0x4E, 0xD5, 0x84, 0x6D, 0x5D, 0x20, 0x47, 0x36, 0x85,
+    0x45, 0x8F, 0xAA, 0xF7, 0xFF, 0x24, 0xF3, 0x05, 0x99, 0x89, 0xB8, 0x41, 0x31, 0x89, 0x9C, 0x15,
+    0x49, 0x3F, 0xDF, 0xA2, 0x70, 0x3B, 0xDF, 0xE6, 0x2D, 0x4A, 0x79, 0x67, 0x94, 0xF9, 0x2F, 0x90,
+    0xF3, 0x51, 0x4A, 0x80, 0x54, 0x74, 0xA2, 0xFD, 0x4A, 0x92, 0x99, 0x85, 0x7E, 0x24, 0x69, 0x1F,
+    0x6E, 0xEB, 0xFE, 0xC7, 0xD2, 0x7F, 0x87, 0xCE, 0x89, 0x11, 0x9A, 0x13, 0xA6, 0x95, 0x01, 0x8C,
+    0xD8, 0x5F, 0x71, 0xF2, 0xC6, 0xC5, 0xDC, 0x63, 0xC6, 0x60, 0x40, 0xE7, 0x47, 0xD4, 0x2A, 0x5C,
+    0xB4, 0x1C, 0xB7, 0x45, 0xC4, 0x52, 0x3B, 0x07, 0x83, 0xE9, 0x97, 0x92, 0xE1, 0x2B, 0x0D, 0xE0,
+    0xE9, 0x52, 0x38, 0x34, 0x29, 0xD8, 0x7E, 0xC7, 0x5A, 0x9F, 0xEC, 0x66, 0x6E, 0x8D, 0x76, 0x33,
+    0xDA, 0x96, 0xDF, 0xEA, 0xF3, 0x99, 0xF9, 0xDC, 0xCE, 0xC8, 0x49, 0xCC, 0x3D, 0x2F, 0x8D, 0xAE,
+    0x9E, 0xEB, 0x77, 0x25, 0xC6, 0xDD, 0x3D, 0x2A, 0xC9, 0x13, 0x15, 0x10, 0x54, 0xBA, 0x05, 0x97,
+    0x3B, 0x0E, 0x2A, 0x81, 0x8B, 0xE5, 0x92, 0x97, 0x93, 0x0A, 0x06, 0x38, 0xC7, 0x48, 0x59, 0x64,
+    0x5A, 0x3C, 0x92, 0x24, 0x1E, 0xCB, 0x07, 0x32, 0x70, 0xFA, 0x12, 0xFD, 0x22, 0xFC, 0x57, 0x50,
+    0xC3, 0x93, 0xB1, 0xA5, 0x20, 0x72, 0xA9, 0xFA, 0xE4, 0x86, 0x4E, 0x82, 0xCB, 0xB8, 0x26, 0xCC,
+    0xA4, 0x6E, 0x4B, 0xEB, 0xDA, 0xD3, 0xB5, 0xBD, 0x07, 0x76, 0x6A, 0x70, 0x56, 0xCA, 0x52, 0x0D,
+    0x19, 0xC2, 0x03, 0x2D, 0x90, 0x0F, 0xC9, 0x0C, 0x28, 0x56, 0x98, 0xDB, 0x47, 0x05, 0x0A, 0xA1,
+    0x79, 0x23, 0x0F, 0x75, 0xCB, 0x48, 0xF1, 0x10, 0xA4, 0x41, 0x92, 0xF2, 0x2E, 0x2C, 0xCA, 0x32,
+    0x8C, 0xF1, 0xBC, 0x71, 0x19, 0x74, 0xAE, 0x3B, 0x78, 0x0E, 0xF0, 0x50, 0x24, 0xA7, 0xD0, 0x58,
+    0x81, 0x7F, 0xD9, 0x0D, 0x1D, 0xDD, 0x5F, 0x37, 0x2A, 0x50, 0xF6, 0xB5, 0x53, 0x0D, 0xE1, 0x83,
+    0xFA, 0x73, 0xFB, 0xC0, 0x03, 0x61, 0x0C, 0x26, 0x58, 0x28, 0x82, 0xD8, 0x73, 0x94, 0xDB, 0x0C,
+    0x0B, 0x44, 0xDD, 0x9E, 0xD9, 0x96, 0x81, 0xCB, 0xCE, 0x21, 0x95, 0x71, 0xFC, 0x1F, 0x75, 0x3C,
+    0x44, 0x64, 0x4C, 0xB4, 0x7D, 0x1C, 0xB1, 0xB9, 0x5A, 0x27, 0x9B, 0xDC, 0xDF, 0xB1, 0x89, 0x0E,
+    0xFD, 0x77, 0xE9, 0xEC, 0xE9, 0x75, 0x7D, 0x95, 0x96, 0x8C, 0x75, 0xE9, 0xEC, 0x31, 0x79, 0x72,
+    0xB3, 0xBE, 0xAA, 0x98, 0x0F, 0x37, 0x76, 0x6D, 0x0B, 0xAE, 0x5A, 0x6C, 0x90, 0xDC, 0xCD, 0xE7,
+    0xA3, 0x8B, 0x07, 0xD7, 0x9E, 0x90, 0x1D, 0xFE, 0x7D, 0x2A, 0xD6, 0xEE, 0xE4, 0x3E, 0x71, 0xB3,
+    0x88, 0x8F, 0x85, 0x6C, 0xCC, 0x42, 0xD1, 0xF5, 0x26, 0x8E, 0x1E, 0x07, 0xDC, 0x16, 0x7C, 0x85,
+    0x3D, 0x09, 0x9B, 0x24, 0xEF, 0xD9, 0x6E, 0xF3, 0x86, 0x1B, 0x61, 0xB0, 0xEC, 0x5D, 0x31, 0x00,
+    0xB7, 0xB6, 0x5B, 0x14, 0x87, 0x14, 0x09, 0x1C, 0x52, 0xF3, 0xB5, 0x6E, 0xE0, 0xE6, 0x04, 0xB3,
+    0xEE, 0x6F, 0x58, 0x7C, 0x59, 0x93, 0xDD, 0x6E, 0xE5, 0x39, 0xEB, 0xF6, 0x57, 0x46, 0x9D, 0x6D,
+    0xB5, 0xD9, 0x1D, 0xB0, 0xAA, 0x30, 0xB5, 0x3F, 0x6C, 0x4B, 0xE7, 0xA3, 0x67, 0x4A, 0xE7, 0x7D,
+    0xBB, 0x74, 0x6B, 0xBB, 0xF4, 0xB0, 0xD6, 0xC4, 0xAA, 0xBD, 0x20, 0x50, 0x00, 0xA7, 0x3C, 0x88,
+    0x3D, 0xC0, 0xC9, 0x87, 0xB6, 0x7E, 0xDA, 0xEB, 0xCE, 0x0D, 0xF1, 0xDF, 0x1B, 0x69, 0xE7, 0x20,
+    0xB1, 0x4A, 0x9D, 0x42, 0xEA, 0x11, 0xCE, 0x74, 0xF2, 0x85, 0x10, 0xCF, 0x3B, 0x85, 0x01, 0x19,
+    0xFE, 0xD2, 0x20, 0x56, 0x30, 0xF2, 0xEF, 0x55, 0xBF, 0xB4, 0xE6, 0x30, 0xCA, 0x4C, 0x7E, 0xD1,
+    0x79, 0xD6, 0xBE, 0x83, 0xEC, 0x21, 0xBB, 0xB5, 0xCE, 0x8B, 0xBD, 0x4F, 0xA1, 0xCC, 0x6C, 0x6A,
+    0xDD, 0xB0, 0x63, 0xC6, 0x70, 0x30, 0x1A, 0xF3, 0xAD, 0x16, 0x86, 0x22, 0x58, 0x6C, 0x24, 0x68,
+    0x18, 0x16, 0x51, 0xD0, 0x2A, 0x66, 0xD8, 0xF0, 0xFA, 0x38, 0x8B, 0x16, 0xBE, 0xEA, 0xCE, 0x21,
+    0xE0, 0xE7, 0xCD, 0x58, 0x83, 0x59, 0x3F, 0x50, 0x35, 0xDC, 0xFC, 0x34, 0x45, 0x33, 0x1A, 0xAF,
+    0x51, 0xF8, 0xF3, 0x1C, 0xB0, 0x8C, 0x96, 0xE0, 0x4D, 0xCC, 0x1D, 0xB2, 0x56, 0x46, 0x14, 0xD3,
+    0x63, 0x52, 0xF4, 0x38, 0xE9, 0x06, 0x56, 0x4C, 0x90, 0xEE, 0x55, 0x73, 0xA3, 0xA2, 0xDA, 0x41,
+    0xB7, 0x47, 0x91, 0x0B, 0xBF, 0x2C, 0xBC, 0xD2, 0xC3, 0xED, 0x23, 0xDD, 0x32, 0xC2, 0x1A, 0x6B,
+    0x2B, 0xCA, 0xEE, 0xA0, 0x07, 0xD3, 0x65, 0xD4, 0x50, 0x84, 0x65, 0x82, 0x3E, 0xE0, 0xA3, 0x67,
+    0x3E, 0xFC, 0x3D, 0x2A, 0xEB, 0xFB, 0xF6, 0x35, 0x66, 0x59, 0x6D, 0x37, 0xBA, 0x10, 0xC5, 0x12,
+    0x1E, 0x7D, 0x2E, 0xD6, 0xD3, 0x70, 0x06, 0x02, 0x55, 0xE8, 0xF6, 0xAB, 0x9B, 0x6B, 0x1F, 0xEF,
+    0x21, 0xF7, 0x84, 0x11, 0xC3, 0x25, 0xD2, 0x8F, 0x85, 0x31, 0xF3, 0x78, 0xC1, 0xB7, 0x39, 0x15,
+    0x14, 0xF7, 0x13, 0xE4, 0x61, 0x28, 0xCE, 0xD4, 0xA8, 0x78, 0x44, 0xA7, 0x0D, 0x3F, 0x2F, 0x14,
+    0x3C, 0xE0, 0x6D, 0x7B, 0x13, 0x5C, 0xE4, 0x16, 0xBA, 0xF1, 0x03, 0xBE, 0x41, 0xCF, 0x5A, 0x45,
+    0x20, 0x77, 0xB3, 0x71, 0xEA, 0x94, 0xE6, 0x74, 0x8B, 0x31, 0xE4, 0x6C, 0x80, 0x11, 0x08, 0x8C,
+    0xE0, 0x67, 0xCD, 0x22, 0x83, 0xED, 0xE1, 0x52, 0x0D, 0x08, 0x84, 0x08, 0x54, 0xEF, 0x3C, 0xBC,
+    0xD9, 0x63, 0x47, 0x95, 0xC4, 0x58, 0x02, 0x4C, 0xB8, 0x0E, 0x98, 0x72, 0x68, 0x48, 0xFF, 0x35,
+    0x81, 0xCE, 0x1D, 0x4F, 0xBB, 0xDB, 0x97, 0x68, 0x4C, 0xBB, 0x08, 0x1F, 0xA3, 0xEE, 0x57, 0xB8,
+    0xCD, 0x63, 0x8E, 0xFB, 0xBF, 0x8E, 0x0F, 0x66, 0xA7, 0x29, 0x1E, 0x32, 0xCF, 0xCC, 0x48, 0x83,
+    0xE4, 0xEE, 0x5E, 0xB8, 0x09, 0x79, 0x15, 0xB7, 0x27, 0xAF, 0x04, 0xE4, 0x05, 0x07, 0xD4, 0x1B,
+    0xE8, 0x5C, 0x6F, 0x86, 0x50, 0x6E, 0x43, 0xB4, 0xE9, 0x93, 0x17, 0x07, 0xD2, 0xFF, 0x6B, 0x9B,
+    0x3A, 0x7F, 0x80, 0xD4, 0x3F, 0x7A, 0x31, 0x1B, 0x30, 0xAF, 0x3C, 0xB0, 0x92, 0xEC, 0xC0, 0x1A,
+    0x1E, 0xC0, 0xFC, 0x41, 0xDC, 0x73, 0x41, 0x20, 0xD3, 0x09, 0xAC, 0x42, 0x00, 0x32, 0x0F, 0xE7,
+    0x92, 0xF6, 0x4A, 0x1A, 0x38, 0xD2, 0x43, 0x58, 0x75, 0x25, 0x6B, 0x2C, 0x5F, 0xC6, 0x93, 0xAB,
+    0xE0, 0x80, 0x55, 0x30, 0x41, 0xF4, 0x70, 0xA5, 0x5B, 0x7C, 0x26, 0x2B, 0xD9, 0xF5, 0x8B, 0x36,
+    0x44, 0xC1, 0x5E, 0xDA, 0xB6, 0x29, 0x97, 0xCD, 0x29, 0xE7, 0x55, 0xF6, 0xE1, 0xC4, 0x3D, 0x9D,
+    0xF2, 0xE0, 0xF6, 0xFA, 0xE4, 0x55, 0x7A, 0xC7, 0x62, 0x4A, 0xCB, 0x4B, 0x61, 0xA9, 0xF5, 0xA6,
+    0x76, 0x0A, 0xAB, 0x72, 0x73, 0x6E, 0x8D, 0x3B, 0x7A, 0xD2, 0x55, 0x06, 0x19, 0xAC, 0x39, 0x01,
+    0x90, 0x11, 0xE1, 0x7C, 0x3E, 0x8D, 0xEC, 0x9F, 0xA6, 0xE1, 0x07, 0xFE, 0x7B, 0x7E, 0x6D, 0x90,
+    0x71, 0x32, 0xB5, 0x5E, 0xE8, 0xE7, 0x4E, 0x8D, 0x67, 0x21, 0x43, 0xAE, 0xB0, 0xFF, 0xC2, 0x79,
+    0x99, 0x1D, 0x18, 0x4E, 0x48, 0x45, 0x37, 0x58, 0x3B, 0xB1, 0x76, 0x5E, 0xCD, 0x29, 0xA8, 0x81,
+    0x06, 0x67, 0x0C, 0x3B, 0x93, 0xAC, 0xDB, 0x03, 0x12, 0x79, 0x32, 0x95, 0xB3, 0x56, 0x31, 0xC1,
+    0xAC, 0x3A, 0x6F, 0x29, 0x95, 0x97, 0xC1, 0x95, 0x5B, 0x5E, 0x76, 0x18, 0xD5, 0xDD, 0xCB, 0x4E,
+    0x57, 0x52, 0x78, 0xD9, 0x83, 0x95, 0x95, 0x79, 0xD9, 0x56, 0xE5, 0xA4, 0x5E, 0x96, 0x57, 0xAE,
+    0x78, 0xBF, 0xC9, 0xAA, 0xC3, 0xC8, 0xDD, 0xB8, 0x3E, 0x25, 0xDE, 0xEB, 0x52, 0x3F, 0x25, 0xDE,
+    0xEF, 0xD0, 0x31, 0x89, 0xD7, 0xC8, 0x27, 0x19, 0x93, 0xB4, 0x65, 0xEB, 0x2E, 0xD3, 0x05, 0x05,
+    0xBD, 0x2C, 0xF7, 0xA6, 0xD6, 0x84, 0x75, 0x3F, 0x8C, 0xAF, 0x10, 0x3F, 0x45, 0x97, 0xFA, 0xEE,
+    0x7B, 0xD2, 0xF9, 0xDD, 0xAC, 0xB8, 0x9B, 0xF9, 0xBF, 0x3E, 0x03, 0xB6, 0xCA, 0xE8, 0x5D, 0x81,
+    0x4B, 0x2D, 0x28, 0x27, 0xCB, 0x19, 0x64, 0x26, 0xB1, 0x8B, 0x7B, 0x4E, 0x5E, 0x04, 0x71, 0x87,
+    0xDC, 0x96, 0xD2, 0x25, 0x86, 0xEE, 0x84, 0x43, 0xC0, 0x1A, 0x9D, 0xBC, 0xCA, 0xB0, 0x5D, 0x60,
+    0x29, 0xDB, 0x62, 0x14, 0xCA, 0xAE, 0xF9, 0x0A, 0x1E, 0xE1, 0xFE, 0xF3, 0x4F, 0x28, 0x9A, 0xFD,
+    0x97, 0xA7, 0x1D, 0x49, 0xB5, 0x28, 0x3F, 0x5A, 0x6F, 0x16, 0x6D, 0x27, 0x75, 0xC1, 0x64, 0xF2,
+    0x43, 0xB6, 0x0F, 0x89, 0xE2, 0xF9, 0xC9, 0xE1, 0x8B, 0xC2, 0xFD, 0x41, 0x2C, 0xA1, 0x2C, 0xB0,
+    0x8D, 0x15, 0x47, 0xF1, 0x62, 0xA3, 0xA3, 0xDB, 0x43, 0x99, 0x6F, 0x8D, 0x40, 0x89, 0x6F, 0xE3,
+    0xA3, 0xDC, 0xCF, 0xED, 0x2C, 0xDC, 0xD9, 0xCC, 0x22, 0xDD, 0x41, 0xB1, 0xCE, 0x9A, 0x8E, 0x9C,
+    0xE8, 0xE4, 0x24, 0x97, 0x3B, 0xA2, 0xE7, 0x54, 0x9F, 0x3F, 0xC5, 0x4F, 0x0E, 0x87, 0x43, 0xCC,
+    0xA3, 0x54, 0xCC, 0xF7, 0x78, 0xBD, 0xC8, 0xED, 0xFB, 0x56, 0xF7, 0x34, 0xBB, 0x69, 0xD2, 0x20,
+    0x0F, 0x90, 0xC9, 0x36, 0x16, 0xB9, 0xE6, 0x77, 0x1B, 0x2B, 0xBD, 0xC7, 0x4B, 0xEB, 0x55, 0x27,
+    0x3D, 0xEF, 0x01, 0x25, 0x71, 0xEB, 0x17, 0xAD, 0x5F, 0x26, 0x66, 0xDD, 0x90, 0x5E, 0x0E, 0xDE,
+    0x98, 0x06, 0x7F, 0x99, 0xBA, 0xC5, 0x86, 0x9D, 0x9F, 0x72, 0xB2, 0x95, 0xC0, 0x2A, 0x2E, 0x7B,
+    0xD4, 0xF8, 0x34, 0xDA, 0xCB, 0x3B, 0x41, 0x1D, 0xC8, 0xD6, 0xD4, 0x8C, 0x03, 0x6E, 0x44, 0x1D,
+    0xD8, 0xAC, 0x55, 0x63, 0xE1, 0x38, 0xDD, 0x65, 0xAE, 0x9A, 0x1A, 0x71, 0x74, 0xF2, 0x1F, 0x94,
+    0x67, 0xC8, 0xFA, 0x4E, 0x71, 0x94, 0xDE, 0xD2, 0x5A, 0x0F, 0x06, 0xA5, 0xE3, 0xFB, 0x3B, 0x9B,
+    0x3B, 0x6C, 0x1F, 0xB4, 0xF3, 0x53, 0x7E, 0xD5, 0x8C, 0x55, 0x5E, 0xD9, 0x30, 0xCC, 0xB2, 0x6E,
+    0x7A, 0x80, 0x91, 0xE9, 0x2C, 0x1A, 0x73, 0xA9, 0xCD, 0x8F, 0x1C, 0x95, 0x66, 0xB5, 0xAE, 0x96,
+    0x34, 0x16, 0xB5, 0x46, 0xD5, 0x32, 0xC1, 0xD5, 0x3E, 0x83, 0xE9, 0xA5, 0x05, 0x52, 0x1B, 0x0E,
+    0x65, 0x71, 0x31, 0x2C, 0x2E, 0x4A, 0xEE, 0xFB, 0xB3, 0x9A, 0xE9, 0xEE, 0xAE, 0x0F, 0x8D, 0x95,
+    0xCE, 0x82, 0x6E, 0x5D, 0x6B, 0x3D, 0xA6, 0xCB, 0x13, 0x5D, 0x53, 0x57, 0x21, 0xB7, 0xA7, 0x73,
+    0xFD, 0x2D, 0x23, 0xFB, 0xE2, 0xBC, 0x4F, 0xE9, 0xC6, 0xFE, 0xCE, 0x30, 0x56, 0x4B, 0x74, 0xB3,
+    0x8C, 0x16, 0xF4, 0x54, 0xE2, 0x86, 0xEA, 0xBF, 0xDE, 0xFD, 0x8C, 0x60, 0xF6, 0xC9, 0xD6, 0xD5,
+    0x84, 0x91, 0x5A, 0xD0, 0xA8, 0x01, 0x06, 0x4B, 0xD5, 0x5C, 0x7D, 0x33, 0xBA, 0xB9, 0x35, 0x2B,
+    0x58, 0x89, 0x27, 0xA9, 0xE9, 0x8B, 0xBA, 0xA9, 0x82, 0x78, 0x7F, 0xB1, 0xA4, 0xAD, 0x96, 0x36,
+    0x47, 0xFB, 0x75, 0x59, 0x63, 0x00, 0x9D, 0x4B, 0x4E, 0x10, 0xB0, 0xA8, 0xE7, 0x9E, 0xFE, 0x7A,
+    0xA2, 0xBF, 0x5D, 0xA8, 0xE7, 0x7D, 0xB2, 0x16, 0x7A, 0x37, 0x08, 0x44, 0xF3, 0xE6, 0xFF, 0xEF,
+    0x75, 0x86, 0xDC, 0x73, 0xAA, 0x75, 0x15, 0x6A, 0xCE, 0x54, 0x4D, 0xE3, 0xAB, 0xE6, 0xDF, 0x2F,
+    0xCD, 0x2F, 0x3F, 0x08, 0x68, 0xBC, 0x80, 0xCF, 0x1C, 0x3F, 0x0A, 0xA0, 0x61, 0x6A, 0x10, 0x64,
+    0x76, 0x2B, 0x8D, 0x65, 0xC4, 0x10, 0xAF, 0x8C, 0x2A, 0x15, 0x58, 0xEF, 0xEC, 0x1B, 0x75, 0x16,
+    0x36, 0x9D, 0x8D, 0xB5, 0xFE, 0xC6, 0x68, 0x90, 0xB4, 0xD6, 0x41, 0x69, 0xA3, 0xC3, 0xD2, 0xA8,
+    0xB3, 0x69, 0xD4, 0xA1, 0xA9, 0xA1, 0x75, 0xF8, 0x66, 0xFB, 0xB2, 0xC1, 0x53, 0x94, 0x1B, 0x40,
+    0xDD, 0xB1, 0x40, 0xD4, 0x1C, 0x52, 0x73, 0x4C, 0xCD, 0x31, 0xDC, 0xA1, 0xEA, 0x00, 0xAC, 0xF6,
+    0x91, 0x05, 0x7B, 0x6B, 0x63, 0x2F, 0x7B, 0x1C, 0x26, 0x8B, 0xEE, 0xCF, 0x66, 0x06, 0xC0, 0xB4,
+    0x57, 0x49, 0x26, 0xD5, 0x46, 0x44, 0xED, 0xC5, 0x54, 0x6A, 0xAF, 0xF7, 0x7F, 0x63, 0xEF, 0xBF,
+    0x01, 0x7D, 0x54, 0xAF, 0x73, 0x1B, 0x47, 0x14, 0xFE, 0xEE, 0xAE, 0xD5, 0xCE, 0xE4, 0x9A, 0x6C,
+    0x40, 0x32, 0xD3, 0x49, 0x1A, 0x1F, 0x77, 0x65, 0x1F, 0x31, 0x10, 0x38, 0xE9, 0x76, 0x1A, 0x68,
+    0x52, 0x50, 0xA3, 0x82, 0x06, 0x07, 0x34, 0x06, 0x02, 0x01, 0x95, 0x7D, 0x33, 0x86, 0x25, 0x01,
+    0x2D, 0x2F, 0x08, 0xC8, 0x38, 0x33, 0x89, 0x40, 0x80, 0x81, 0x62, 0x5D, 0xFB, 0x0F, 0xE4, 0x40,
+    0x51, 0x41, 0xE7, 0x40, 0x4D, 0x52, 0xB2, 0xE0, 0x80, 0x92, 0x2A, 0xDA, 0x7E, 0x6F, 0xEF, 0x5C,
+    0xCB, 0x9E, 0x69, 0x56, 0xB3, 0x6F, 0x57, 0xB7, 0xEF, 0xC7, 0xF7, 0xDE, 0xF7, 0x76, 0xD3, 0xFB,
+    0x75, 0x1A, 0xD5, 0x23, 0x55, 0x0E, 0x55, 0x99, 0xA9, 0x62, 0x10, 0x63, 0x27, 0x86, 0x8C, 0xA0,
+    0xFA, 0x02, 0x08, 0xCB, 0x0C, 0x88, 0xCA, 0x01, 0x45, 0x31, 0x06, 0x62, 0x4C, 0x01, 0x0D, 0x0B,
+    0xE5, 0x9C, 0x33, 0xBD, 0xD3, 0xE7, 0x6F, 0x81, 0x7E, 0x54, 0x02, 0x59, 0x54, 0x00, 0x63, 0x65,
+    0x80, 0xA9, 0x58, 0xDB, 0x1B, 0xC0, 0xE6, 0xFB, 0x97, 0x4F, 0x71, 0xE8, 0xDC, 0x82, 0xF6, 0x59,
+    0x67, 0xAF, 0xCC, 0x54, 0x9C, 0x58, 0x71, 0x52, 0x03, 0x37, 0x82, 0x0A, 0xDD, 0xA0, 0x01, 0xAE,
+    0x33, 0x9E, 0xAB, 0x91, 0xBC, 0x58, 0x62, 0xD2, 0x9F, 0x60, 0x39, 0x18, 0x62, 0xB1, 0x33, 0xC0,
+    0x62, 0x1F, 0x58, 0xD2, 0x6E, 0x4E, 0xB3, 0x9C, 0x33, 0x5E, 0x11, 0x9C, 0x2B, 0x10, 0xBE, 0xA9,
+    0x3F, 0x89, 0x8E, 0x6C, 0x16, 0xDD, 0xF7, 0x73, 0xA4, 0xA2, 0x2A, 0xDF, 0xD5, 0xA5, 0x76, 0xA7,
+    0x08, 0xE6, 0xF4, 0x4E, 0xF8, 0x7E, 0xF6, 0xB1, 0x3E, 0x0E, 0x2B, 0x02, 0x08, 0x6B, 0x8B, 0x0D,
+    0xA8, 0xF2, 0x04, 0x19, 0xB4, 0x99, 0xA1, 0x41, 0x82, 0x59, 0x58, 0x63, 0x1B, 0x33, 0x66, 0xC3,
+    0xB0, 0x1A, 0x94, 0xCD, 0x16, 0x13, 0x0B, 0xEC, 0xE3, 0xDE, 0x93, 0x21, 0x0D, 0x0E, 0x66, 0x5B,
+    0xEA, 0xB7, 0xCA, 0x0E, 0xF5, 0x23, 0x75, 0x54, 0x6D, 0x87, 0x7F, 0x69, 0x55, 0xA6, 0xD4, 0x8A,
+    0x0B, 0xCA, 0x13, 0x6D, 0x46, 0x08, 0xAC, 0x36, 0x43, 0x26, 0xAB, 0xF1, 0x03, 0x62, 0xA3, 0x71,
+    0x42, 0xA7, 0xDA, 0x58, 0x86, 0x88, 0x8F, 0x2A, 0x86, 0x08, 0x9D, 0xB9, 0x84, 0x44, 0x72, 0x65,
+    0x21, 0xCE, 0x96, 0x94, 0x29, 0x46, 0x94, 0x23, 0xE4, 0x6B, 0x52, 0xBE, 0xE4, 0xF0, 0xA7, 0xBB,
+    0x5E, 0x73, 0x85, 0x3D, 0x83, 0xD4, 0x32, 0xF7, 0xF0, 0x9F, 0x26, 0x6C, 0xA0, 0x7F, 0x5D, 0x12,
+    0x6D, 0x8E, 0xB9, 0x2A, 0xF0, 0x1A, 0xF9, 0x8F, 0x2C, 0x13, 0xF4, 0x9F, 0x22, 0xD5, 0x52, 0x64,
+    0x48, 0x39, 0x43, 0xF0, 0x81, 0x49, 0x93, 0x30, 0xBA, 0x39, 0x3B, 0x4D, 0x7E, 0xE7, 0xAE, 0x89,
+    0x79, 0x70, 0x0B, 0x3E, 0x6C, 0xCE, 0x30, 0x19, 0x7F, 0x03, 0xEC, 0x9F, 0xE3, 0x8A, 0x4B, 0x5C,
+    0x8F, 0x19, 0x68, 0x97, 0xDB, 0x3F, 0xB8, 0x39, 0x75, 0xC5, 0x43, 0xF7, 0x33, 0x0E, 0x5F, 0x56,
+    0xD8, 0xE9, 0xD3, 0x59, 0x46, 0x78, 0x8F, 0x3F, 0xE3, 0xEC, 0xF4, 0xAF, 0x89, 0xCD, 0xE5, 0x79,
+    0xFB, 0xBB, 0x3D, 0x93, 0x3B, 0x57, 0xC9, 0x7A, 0xF5, 0x0C, 0xF1, 0x7F, 0x15, 0x20, 0x99, 0x61,
+    0x25, 0xFD, 0x25, 0x9D, 0x21, 0x3D, 0x01, 0xDC, 0xE3, 0x64, 0xB7, 0x78, 0xE7, 0x3C, 0x96, 0x2E,
+    0x09, 0x4B, 0xE9, 0x9E, 0xD6, 0x4E, 0xDA, 0x64, 0xAB, 0x53, 0x79, 0xD5, 0xAA, 0x04, 0x57, 0x3C,
+    0x6C, 0x74, 0xC7, 0xEC, 0x59, 0x3C, 0xB8, 0x28, 0x36, 0xB5, 0xD2, 0xD2, 0x17, 0x23, 0xA9, 0xDA,
+    0xA5, 0x86, 0x2F, 0x34, 0xFF, 0xFA, 0xFF, 0x48, 0xB9, 0x09, 0x17, 0xB2, 0x61, 0xB0, 0x48, 0x3A,
+    0xF3, 0x6B, 0xB1, 0x94, 0x3C, 0x36, 0x8F, 0x8F, 0x8B, 0x75, 0xEA, 0x6E, 0xEF, 0x75, 0xF9, 0x71,
+    0xBD, 0x09, 0xE9, 0x95, 0xD6, 0xCA, 0x9B, 0xE7, 0xDC, 0x28, 0xD9, 0x1C, 0x12, 0x51, 0x5C, 0xF9,
+    0x0F, 0x72, 0x40, 0x85, 0xB0, 0x0D, 0xEF, 0xF5, 0x6F, 0x7A, 0x4F, 0xBD, 0xF9, 0x13, 0xDF, 0x95,
+    0x6F, 0xC9, 0x0F, 0x54, 0xE3, 0xF5, 0x13, 0x3A, 0x68, 0x80, 0x89, 0x4F, 0x24, 0x68, 0xF0, 0x0D,
+    0x73, 0x8A, 0xEA, 0xD8, 0xB1, 0x2B, 0x55, 0x99, 0x07, 0x4D, 0x2C, 0x3D, 0x1B, 0xD8, 0xD8, 0x24,
+    0xC1, 0x22, 0xB4, 0xCA, 0x6C, 0x87, 0x56, 0x96, 0x61, 0x64, 0xA9, 0x85, 0x61, 0x54, 0x47, 0x55,
+    0x8C, 0x4C, 0x55, 0x8A, 0xAD, 0xC8, 0x25, 0x2E, 0xEF, 0xF1, 0x7E, 0xD6, 0x9A, 0xB7, 0x90, 0x2A,
+    0xDB, 0xD5, 0x2B, 0x52, 0xEE, 0x2C, 0x9B, 0x2F, 0xC5, 0x9D, 0x62, 0xD3, 0xD0, 0xD9, 0x39, 0xED,
+    0x32, 0x22, 0x96, 0xE5, 0x53, 0xAE, 0x44, 0xFA, 0xBD, 0x64, 0x75, 0xF6, 0xAD, 0xF5, 0xBD, 0xBA,
+    0xBA, 0xC8, 0x3E, 0x75, 0x95, 0x76, 0xE5, 0xDD, 0x95, 0xE9, 0xAD, 0x8C, 0x24, 0x66, 0x11, 0x5A,
+    0x91, 0x91, 0x15, 0xBE, 0x28, 0x49, 0x89, 0xAA, 0x85, 0x37, 0x66, 0x43, 0x6A, 0x74, 0x29, 0xFC,
+    0x51, 0x92, 0x22, 0x5D, 0xF0, 0x6E, 0x48, 0x86, 0x64, 0x33, 0x35, 0x42, 0x58, 0xEE, 0x59, 0xCD,
+    0x3D, 0xF5, 0x23, 0x7F, 0x5B, 0x47, 0x9E, 0xC0, 0xDC, 0x33, 0x9C, 0x9A, 0x40, 0x5E, 0x8B, 0x77,
+    0x8F, 0x4A, 0x01, 0x21, 0x34, 0x79, 0x74, 0xED, 0x48, 0x5C, 0x5B, 0xF6, 0xF6, 0xBE, 0x00, 0x07,
+    0x9C, 0xAF, 0x01, 0x7F, 0x67, 0x64, 0x12, 0x1B, 0xCB, 0xE7, 0xD1, 0x45, 0xDD, 0x24, 0x2E, 0xA8,
+    0xAA, 0xCD, 0x56, 0x77, 0x53, 0xEA, 0x4D, 0x2C, 0xAC, 0xC7, 0x65, 0x57, 0xF3, 0x9F, 0x80, 0xE3,
+    0x67, 0xDC, 0x4C, 0x39, 0xF6, 0xC7, 0x1C, 0x3B, 0x03, 0x19, 0x99, 0x8C, 0xBE, 0x8C, 0xCF, 0x3D,
+    0x0C, 0x2D, 0x17, 0x5B, 0xC8, 0xCE, 0xD7, 0x1C, 0x08, 0x7B, 0xB3, 0x0B, 0x2C, 0x01, 0xB1, 0x84,
+    0xEB, 0x58, 0xEA, 0x16, 0x8B, 0xF0, 0x7D, 0x8E, 0x83, 0xB5, 0x41, 0xB2, 0x86, 0x23, 0x6F, 0x71,
+    0xDC, 0x61, 0xD6, 0x9B, 0x02, 0xA3, 0x27, 0xB1, 0x4C, 0x8B, 0x77, 0x44, 0xFD, 0x31, 0xED, 0xED,
+    0x94, 0xD5, 0x1E, 0xF8, 0x27, 0x56, 0x15, 0x1B, 0xAC, 0xA7, 0x66, 0x35, 0x55, 0xD1, 0xF7, 0x5F,
+    0x42, 0xFF, 0xBC, 0xB2, 0x79, 0x7F, 0x99, 0x3B, 0x27, 0x34, 0xB2, 0x95, 0x0E, 0xE8, 0x3E, 0x36,
+    0x64, 0xA5, 0x7B, 0x8C, 0xE6, 0x24, 0x67, 0xD1, 0x61, 0xB9, 0x8A, 0x63, 0x2D, 0xA5, 0x49, 0xDB,
+    0xDC, 0xD2, 0xDB, 0x77, 0xEB, 0x36, 0x95, 0xE0, 0x6A, 0x79, 0xD7, 0x52, 0x12, 0x57, 0xB2, 0x46,
+    0xEF, 0x68, 0x7B, 0xDC, 0x95, 0xF0, 0x7F, 0x47, 0x5B, 0xC5, 0xA6, 0xAB, 0xD6, 0xE4, 0xE3, 0xD5,
+    0x93, 0x19, 0xF8, 0x7B, 0xC6, 0xEB, 0xBC, 0x32, 0x3E, 0xE4, 0x47, 0xAA, 0x77, 0xDE, 0x10, 0x5F,
+    0xD2, 0xFC, 0xA1, 0xBC, 0x22, 0x35, 0xEA, 0xE4, 0x43, 0x50, 0x65, 0xC9, 0x57, 0xE5, 0x20, 0xFA,
+    0xBB, 0x1C, 0x63, 0xEE, 0xC3, 0xFF, 0x0B, 0xCD, 0x5A, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0x1F,
+    0x69, 0x89, 0x8D, 0xD9, 0x88, 0x1E, 0xEC, 0xDA, 0x89, 0x63, 0x31, 0x83, 0x07, 0xC3, 0x90, 0xCC,
+    0x0C, 0x19, 0x8C, 0xE2, 0x24, 0xD2, 0xF5, 0x50, 0xA0, 0x19, 0xEC, 0xC1, 0x4E, 0x07, 0x23, 0x70,
+    0x87, 0x2E, 0x75, 0x81, 0x2A, 0x83, 0x80, 0xAA, 0x81, 0x74, 0xC7, 0xB8, 0xA3, 0x87, 0xAA, 0x45,
+    0x32, 0xDB, 0x43, 0x87, 0x54, 0x09, 0x6A, 0x03, 0xF5, 0xA0, 0x41, 0xA7, 0xA3, 0x91, 0xC1, 0x43,
+    0x86, 0x12, 0x29, 0xD2, 0x6E, 0x0D, 0x1B, 0xA4, 0x7F, 0x10, 0xB7, 0x35, 0x8B, 0xD2, 0xE8, 0xC9,
+    0xBE, 0x3B, 0xF6, 0xF7, 0x7B, 0xE4, 0x9D, 0xCE, 0x4E, 0xD3, 0x02, 0xE9, 0xC5, 0xF1, 0x49, 0x7C,
+    0x3C, 0xDD, 0x91, 0xDF, 0x7B, 0xDF, 0xFB, 0xF3, 0x7B, 0xBF, 0xEF, 0xA3, 0xA4, 0x21, 0x03, 0xFC,
+    0xB4, 0x85, 0xAF, 0xEF, 0x48, 0x26, 0x99, 0x49, 0xAD, 0xC4, 0xC6, 0x8F, 0x9B, 0x78, 0xB1, 0x17,
+    0xFB, 0x51, 0x20, 0x21, 0x7E, 0x5A, 0x7A, 0xC1, 0x0B, 0x38, 0x5E, 0x15, 0x99, 0xDE, 0x11, 0x09,
+    0xCB, 0xD8, 0x74, 0xEF, 0xA6, 0x76, 0x76, 0x3B, 0xF5, 0x6E, 0xBD, 0x1B, 0xFB, 0x97, 0x13, 0x09,
+    0x4F, 0xC7, 0x12, 0xDA, 0x91, 0x34, 0x1D, 0xD1, 0xA3, 0xED, 0xE2, 0x3C, 0x83, 0xE3, 0x69, 0x5C,
+    0xFE, 0xDC, 0x57, 0xC5, 0xEF, 0x6F, 0x8A, 0x53, 0x66, 0x22, 0x3F, 0xC2, 0x30, 0x2F, 0x56, 0x43,
+    0xD5, 0xAF, 0x60, 0x20, 0x62, 0x76, 0x96, 0x12, 0x71, 0x52, 0x37, 0x15, 0x2F, 0x76, 0x12, 0xF1,
+    0xC5, 0x8E, 0x25, 0xD0, 0x2F, 0x47, 0xC2, 0xC7, 0x61, 0x96, 0xCE, 0x47, 0x62, 0x97, 0x65, 0x22,
+    0xB8, 0x4E, 0x1E, 0x12, 0x51, 0x7D, 0x89, 0x34, 0x28, 0x6E, 0xE2, 0xB0, 0xCB, 0x8F, 0x67, 0xC5,
+    0x2F, 0xCB, 0xAE, 0x1C, 0x33, 0x65, 0x8A, 0x0F, 0xF6, 0x88, 0xEC, 0x13, 0x23, 0x9B, 0x3F, 0x38,
+    0x13, 0x85, 0xE5, 0x00, 0xB7, 0xAC, 0xCA, 0x3C, 0x7E, 0x1A, 0x32, 0x23, 0x27, 0x71, 0xF0, 0x3C,
+    0x27, 0x47, 0xC4, 0x93, 0x55, 0x09, 0x1F, 0x0C, 0x64, 0xB3, 0x73, 0x26, 0x7A, 0x5E, 0x2C, 0x09,
+    0xFB, 0x76, 0x19, 0x07, 0x85, 0xC1, 0x1D, 0xA9, 0x14, 0xB0, 0x12, 0x9E, 0xB2, 0x33, 0x2B, 0x11,
+    0x3B, 0x77, 0x22, 0xB1, 0x72, 0xCC, 0xD2, 0x14, 0xD4, 0xDA, 0x5D, 0x86, 0xE8, 0x61, 0x8E, 0xB2,
+    0x9D, 0xD0, 0x49, 0xA5, 0xC8, 0x81, 0xCE, 0x79, 0xFC, 0xB9, 0x86, 0xE3, 0xD2, 0xE0, 0x2D, 0x91,
+    0x4E, 0xD9, 0xE3, 0x25, 0xB4, 0xB0, 0xCB, 0xE9, 0x14, 0x10, 0x07, 0xFB, 0x10, 0x3A, 0x25, 0xB9,
+    0xB1, 0xFB, 0xFA, 0x4E, 0x15, 0x94, 0xB1, 0x4F, 0xF4, 0x03, 0x0B, 0x2E, 0xF4, 0x7E, 0xD6, 0x93,
+    0x05, 0xD9, 0x82, 0x95, 0xAB, 0xB2, 0x29, 0x47, 0xF1, 0x0E, 0x6E, 0xC6, 0x11, 0x62, 0x8E, 0x98,
+    0xAC, 0xFD, 0x6E, 0x19, 0x39, 0x71, 0x2B, 0x75, 0x12, 0x37, 0x77, 0x52, 0x2B, 0xB7, 0xBB, 0x92,
+    0x5B, 0x65, 0x94, 0x49, 0xE7, 0xA3, 0x44, 0xBC, 0x32, 0x12, 0x4C, 0x04, 0x17, 0xD3, 0x67, 0xB8,
+    0xD9, 0x93, 0x15, 0x9D, 0xF0, 0xBC, 0x84, 0xA7, 0x0A, 0x7C, 0x8D, 0x31, 0xCE, 0x89, 0x3C, 0x63,
+    0xC5, 0xA1, 0x9B, 0xE2, 0xF7, 0x90, 0x15, 0xD5, 0x51, 0xB2, 0xCA, 0x1D, 0x46, 0xE2, 0x8F, 0xD7,
+    0x53, 0xDA, 0x6E, 0xA0, 0x07, 0x6F, 0x4E, 0x88, 0x1B, 0x2D, 0x75, 0xDD, 0x68, 0xD6, 0x2A, 0x5A,
+    0x76, 0x32, 0xE7, 0x24, 0x9E, 0x49, 0x4F, 0x7A, 0xD1, 0x1E, 0xC9, 0x5E, 0x64, 0x2C, 0xF2, 0x65,
+    0xCA, 0x1B, 0xCB, 0x81, 0x4A, 0x7D, 0x5F, 0x7D, 0x7E, 0x92, 0xE1, 0xCA, 0x1A, 0x6E, 0x62, 0x99,
+    0x74, 0xD6, 0x2E, 0x7C, 0x3B, 0xF1, 0xA4, 0x83, 0x71, 0xEC, 0x84, 0x41, 0xA4, 0x5B, 0x30, 0xA9,
+    0xF0, 0xCD, 0x25, 0xF8, 0x72, 0xBA, 0xA4, 0xB9, 0x32, 0x45, 0xD1, 0x7A, 0xC3, 0xFE, 0x43, 0xE1,
+    0xC5, 0xB9, 0x6F, 0xF2, 0x45, 0x3B, 0x5B, 0xB0, 0xD3, 0x05, 0x37, 0x59, 0x38, 0x9C, 0x84, 0xBF,
+    0xFA, 0x8B, 0x77, 0x39, 0xC3, 0x25, 0x91, 0x1C, 0x71, 0x62, 0xD9, 0xF4, 0x11, 0x94, 0x55, 0x71,
+    0x6F, 0x15, 0x12, 0xBE, 0x94, 0x49, 0xE8, 0x25, 0x12, 0x20, 0x68, 0xDE, 0xE5, 0x5C, 0x9C, 0x24,
+    0x17, 0x2B, 0x59, 0x11, 0x59, 0x3F, 0x26, 0x07, 0xCE, 0x9F, 0x47, 0x1A, 0x94, 0xE9, 0x81, 0xF3,
+    0x2F, 0x63, 0x26, 0xE6, 0x3F, 0x1C, 0xC2, 0xB9, 0x87, 0x65, 0xD4, 0x2A, 0x65, 0xF7, 0xF5, 0x59,
+    0x7E, 0xF8, 0xD6, 0xC6, 0x3A, 0xFC, 0xE0, 0xDC, 0xDF, 0x82, 0x1F, 0x4C, 0x1E, 0xC0, 0x0F, 0x26,
+    0xF7, 0xE1, 0x07, 0xCA, 0x7C, 0xD9, 0xE4, 0x27, 0xE0, 0x01, 0xF3, 0xA0, 0xA0, 0xFC, 0x57, 0x06,
+    0x3F, 0x98, 0xBC, 0x80, 0x1F, 0x4C, 0xBE, 0x05, 0x3F, 0x60, 0x3A, 0xF0, 0x83, 0x95, 0xFB, 0xA7,
+    0x13, 0xCF, 0x1F, 0xB8, 0x77, 0xFE, 0x87, 0x1F, 0x82, 0xB2, 0xEC, 0x85, 0xCC, 0x6B, 0x11, 0xA7,
+    0x2F, 0xC1, 0xF5, 0xB8, 0x61, 0x27, 0x2B, 0x56, 0xBA, 0x62, 0xD2, 0x55, 0x2B, 0x5D, 0x44, 0xED,
+    0x96, 0x62, 0x7E, 0x2E, 0xB2, 0x17, 0xDF, 0xBB, 0x0F, 0x1F, 0x07, 0x2E, 0xD6, 0x73, 0xC6, 0xF9,
+    0xD1, 0xEF, 0xF4, 0xA8, 0x5F, 0xC7, 0x37, 0x36, 0xD6, 0x79, 0x1D, 0xDF, 0x77, 0x32, 0x3B, 0xEF,
+    0xDA, 0xC9, 0x96, 0x15, 0x6F, 0xE9, 0x8C, 0x73, 0x81, 0x75, 0x9E, 0xA0, 0x64, 0x4C, 0xF6, 0xBC,
+    0x1B, 0xBD, 0x1A, 0x94, 0xF9, 0xF1, 0x8D, 0x75, 0x66, 0x73, 0x99, 0x3A, 0xEF, 0x23, 0x3C, 0x5D,
+    0x0B, 0x55, 0x62, 0xE7, 0x72, 0x31, 0x36, 0x03, 0x68, 0x49, 0x51, 0x2C, 0x2F, 0xD8, 0xD9, 0x4D,
+    0x27, 0x6D, 0x2E, 0xC5, 0x3E, 0x9C, 0x77, 0xD6, 0xCE, 0xDD, 0xC4, 0x47, 0xDE, 0xE1, 0xF5, 0xAC,
+    0x4C, 0xB3, 0xD0, 0x11, 0xA2, 0x90, 0x75, 0xBC, 0xC8, 0x3A, 0x5E, 0x13, 0x3F, 0xC2, 0xBC, 0x03,
+    0x16, 0x4A, 0x48, 0xB1, 0x48, 0xBD, 0x6B, 0x74, 0xC7, 0x16, 0x22, 0x8B, 0x0F, 0xEC, 0x4A, 0x58,
+    0x5D, 0x71, 0x0A, 0xB7, 0x2B, 0xEE, 0x60, 0x6B, 0x90, 0x78, 0x61, 0xD6, 0x89, 0x3D, 0x83, 0x22,
+    0x9F, 0xE5, 0xC0, 0x27, 0xA4, 0x4E, 0x72, 0x09, 0x93, 0xA1, 0xF0, 0x87, 0xB9, 0x2C, 0x6E, 0x89,
+    0xE2, 0x0C, 0xCA, 0xDF, 0xE6, 0x08, 0xEF, 0xE5, 0x54, 0x5A, 0x14, 0x9D, 0x91, 0x68, 0x8D, 0x84,
+    0x7E, 0xEB, 0x53, 0x58, 0xD7, 0x21, 0xC4, 0xFE, 0x3F, 0x84, 0x8B, 0xFC, 0x93, 0xF2, 0x72, 0x9D,
+    0x4B, 0x7B, 0x60, 0x5C, 0x07, 0xC8, 0x7A, 0x08, 0x59, 0x66, 0xC5, 0x76, 0x86, 0x44, 0xDA, 0x92,
+    0xEE, 0xDB, 0x79, 0x27, 0x66, 0x1C, 0x3A, 0xE2, 0x75, 0x64, 0x0A, 0xF3, 0x5E, 0x10, 0xD4, 0x26,
+    0x93, 0xA0, 0xA7, 0xBE, 0x2F, 0xE8, 0xFE, 0x83, 0xF7, 0xE4, 0xD2, 0x86, 0xC8, 0x52, 0x6C, 0xFF,
+    0xA9, 0x70, 0xE3, 0xAE, 0x2F, 0xBD, 0x50, 0x7A, 0x8B, 0xD2, 0x5D, 0xD4, 0xAA, 0xF0, 0x2F, 0xC6,
+    0xD6, 0x8E, 0x98, 0x68, 0x1F, 0x12, 0x7D, 0x19, 0x97, 0x03, 0x98, 0x0A, 0x38, 0x63, 0x0B, 0x93,
+    0x67, 0x25, 0x34, 0x71, 0x74, 0x43, 0x84, 0x64, 0x4B, 0xDC, 0xD7, 0x73, 0x39, 0x02, 0x9C, 0x3D,
+    0x5A, 0x27, 0xCA, 0x2C, 0xF5, 0x02, 0x05, 0xA1, 0x1A, 0xF8, 0x09, 0xED, 0x26, 0xA3, 0x01, 0xCC,
+    0xC5, 0x55, 0x06, 0x1C, 0x66, 0xCC, 0x2B, 0x7A, 0x29, 0xD6, 0x09, 0x82, 0x68, 0x0A, 0x2B, 0xF5,
+    0x13, 0x93, 0x03, 0x6E, 0xE2, 0x83, 0xF7, 0x3C, 0xF3, 0x61, 0x74, 0x69, 0x63, 0xDE, 0xBE, 0x88,
+    0xAF, 0x57, 0x9E, 0x0E, 0xB4, 0xCE, 0x11, 0x01, 0x3B, 0xB9, 0xD7, 0x3C, 0x2B, 0xEE, 0xA9, 0xB2,
+    0xCC, 0xA9, 0x62, 0x55, 0x11, 0x7A, 0x4B, 0x55, 0xF4, 0xA9, 0x62, 0xEF, 0x86, 0xA6, 0xE2, 0x9C,
+    0x6A, 0x5F, 0x51, 0xED, 0x39, 0xB5, 0x53, 0xEF, 0x02, 0xF0, 0x85, 0xB7, 0xCC, 0xAA, 0xF6, 0x86,
+    0x6A, 0x27, 0xB4, 0x77, 0xCD, 0x47, 0x68, 0x41, 0x85, 0xFD, 0xEB, 0x77, 0x33, 0x93, 0x7B, 0x67,
+    0xAC, 0xFC, 0xE0, 0xBD, 0xD9, 0xBD, 0x56, 0x7E, 0x69, 0x63, 0x15, 0x33, 0xE3, 0xFD, 0xE8, 0x21,
+    0x56, 0x4A, 0xA3, 0x81, 0x07, 0x0D, 0x22, 0x1D, 0x30, 0x1B, 0xD6, 0x3B, 0x51, 0x0C, 0x15, 0xF3,
+    0x26, 0xC1, 0x25, 0x9D, 0x32, 0x86, 0x8A, 0x8D, 0x8D, 0x61, 0x52, 0x74, 0x32, 0x78, 0xCC, 0x2E,
+    0x7A, 0x42, 0x18, 0xA2, 0x4A, 0x13, 0x6F, 0xD5, 0x53, 0x85, 0xCA, 0xC3, 0x29, 0xBD, 0xD1, 0xE1,
+    0x2D, 0xC8, 0x3C, 0x4F, 0xC1, 0x7B, 0xDE, 0xCA, 0x8F, 0x01, 0xF9, 0x9D, 0xBC, 0x61, 0xE5, 0xB9,
+    0x9F, 0x85, 0x17, 0xDE, 0x4F, 0x7F, 0x98, 0xBA, 0x03, 0x27, 0xFE, 0x1D, 0xFB, 0x93, 0xFD, 0x12,
+    0xE4, 0xFC, 0x0C, 0xFC, 0x2D, 0x2B, 0x0B, 0x17, 0xDF, 0x80, 0x55, 0x2D, 0xA0, 0xBF, 0xCD, 0xE6,
+    0xC6, 0x59, 0x05, 0x74, 0xB8, 0x69, 0x45, 0x50, 0x61, 0xB1, 0x7C, 0x50, 0x0E, 0x70, 0x47, 0xAF,
+    0x6A, 0x0C, 0xFA, 0x5A, 0x27, 0x08, 0xB1, 0xCD, 0x00, 0xBF, 0x62, 0xE4, 0x3A, 0xBA, 0x4F, 0xA8,
+    0xBD, 0xA4, 0xA7, 0x41, 0x40, 0x13, 0xD8, 0x92, 0xB5, 0x96, 0xE9, 0xF9, 0x65, 0x66, 0xBE, 0xC7,
+    0x1B, 0xCE, 0xCA, 0xB0, 0xB1, 0xA8, 0x9B, 0x87, 0x55, 0x50, 0x17, 0xB6, 0x19, 0x03, 0x31, 0xED,
+    0x96, 0x12, 0xC6, 0x0A, 0xAA, 0x2A, 0xB5, 0xFF, 0x58, 0x1F, 0x52, 0xDA, 0xEF, 0x51, 0xBA, 0x2E,
+    0xAB, 0x7F, 0xD6, 0xA1, 0x6C, 0x38, 0x6C, 0x6A, 0xCB, 0x74, 0xAD, 0xE4, 0x28, 0x3E, 0xF8, 0x96,
+    0xD2, 0xFE, 0xE0, 0xDB, 0x90, 0x5E, 0x59, 0x16, 0x3A, 0x97, 0x82, 0x91, 0x45, 0x1E, 0xD3, 0x5D,
+    0x3D, 0x06, 0x81, 0x45, 0x9A, 0x51, 0x1E, 0x2E, 0x64, 0x7A, 0x10, 0x75, 0x06, 0xA8, 0x27, 0x0E,
+    0x2D, 0x07, 0xD4, 0x88, 0xE6, 0xAE, 0xB9, 0xB6, 0x22, 0x8D, 0x1B, 0x55, 0x95, 0xF1, 0xA4, 0xD8,
+    0x69, 0x54, 0xBB, 0x97, 0xA9, 0x0D, 0xB9, 0x1A, 0xBB, 0x49, 0xED, 0xE9, 0x9C, 0xBA, 0x73, 0xCF,
+    0x93, 0x62, 0xE7, 0x7E, 0x0D, 0x6F, 0x79, 0x8A, 0xA9, 0x79, 0xFD, 0x01, 0xD4, 0xBB, 0x96, 0xF6,
+    0x0A, 0xB0, 0x9D, 0x27, 0xC4, 0xC2, 0x6B, 0xCF, 0x50, 0x57, 0x41, 0x3C, 0xB6, 0xF2, 0x45, 0x4D,
+    0xEE, 0x43, 0xF2, 0xC8, 0xEB, 0xCB, 0xB5, 0xF0, 0x59, 0xD5, 0x5E, 0x32, 0xCA, 0x26, 0x25, 0x8F,
+    0x33, 0xC9, 0xC9, 0xD1, 0x7B, 0x62, 0xC3, 0x97, 0x68, 0x1B, 0x38, 0xAC, 0x1A, 0xF6, 0xB5, 0xF2,
+    0x93, 0xEB, 0x3C, 0xDB, 0x57, 0x63, 0x8B, 0x43, 0xBB, 0x41, 0xA4, 0x34, 0xE5, 0x48, 0x58, 0xD1,
+    0x95, 0x46, 0x58, 0x51, 0x96, 0xCA, 0xC3, 0x50, 0x5A, 0x55, 0x98, 0x13, 0x57, 0x0C, 0xDF, 0x93,
+    0xC1, 0xC6, 0x35, 0x21, 0xD2, 0x56, 0xC3, 0x2D, 0x9B, 0x0A, 0x2A, 0xEE, 0xBD, 0x5C, 0x68, 0x0D,
+    0xAA, 0x5D, 0xAC, 0x42, 0x5B, 0x73, 0x7D, 0x56, 0xAA, 0x73, 0x43, 0x30, 0x9B, 0x19, 0xDA, 0x87,
+    0x19, 0x1E, 0x11, 0x68, 0x06, 0xA4, 0x35, 0x68, 0xE3, 0xD2, 0x07, 0x2F, 0xF7, 0xA4, 0x33, 0xC0,
+    0x8D, 0xE5, 0x08, 0xB4, 0x96, 0x90, 0x79, 0xCE, 0xCE, 0x52, 0x0A, 0xC8, 0x72, 0x73, 0xD9, 0xAE,
+    0xBA, 0xB4, 0xCD, 0xE9, 0x1B, 0x02, 0x18, 0x26, 0xC3, 0x19, 0x05, 0xF4, 0x61, 0x18, 0x0D, 0x5B,
+    0x74, 0x6B, 0x24, 0x9A, 0x23, 0xD1, 0x1A, 0x35, 0x70, 0x5C, 0x7C, 0x88, 0x55, 0x78, 0x53, 0xEC,
+    0x01, 0xE7, 0xDF, 0x2A, 0x71, 0xB7, 0x4D, 0xC6, 0xA1, 0x6E, 0x56, 0x12, 0x5D, 0xC1, 0x08, 0xDF,
+    0xBD, 0x4D, 0xA3, 0xCB, 0x78, 0xC4, 0x19, 0x7D, 0xBE, 0x75, 0x34, 0x5A, 0x1A, 0xC4, 0x1B, 0xE3,
+    0x85, 0x01, 0x8E, 0xD3, 0x17, 0xFF, 0xFE, 0x46, 0x9F, 0x73, 0x6D, 0x54, 0x02, 0x83, 0x9E, 0xE4,
+    0x54, 0xF7, 0x71, 0x9E, 0x32, 0x26, 0xFC, 0x4F, 0x7E, 0x41, 0xEE, 0xD5, 0x1F, 0xF2, 0x8A, 0x91,
+    0xA9, 0xA4, 0xF7, 0xD5, 0x2A, 0xAA, 0x87, 0xB4, 0x61, 0x14, 0x13, 0xB8, 0xD6, 0x8D, 0x0F, 0xEE,
+    0x9C, 0x6F, 0x45, 0x1D, 0x52, 0x8D, 0x21, 0x98, 0xE8, 0x38, 0x7A, 0x23, 0x49, 0xBB, 0xC9, 0xC6,
+    0xF3, 0xFF, 0x31, 0xDA, 0xA2, 0x80, 0x51, 0x6A, 0xCC, 0x19, 0xF0, 0x2B, 0x70, 0xD1, 0x3C, 0x1A,
+    0x0D, 0xD4, 0x44, 0x8F, 0xDB, 0x96, 0x43, 0x16, 0x94, 0x83, 0xB3, 0xD6, 0x62, 0xFF, 0x68, 0xBD,
+    0xF1, 0x58, 0xCD, 0x98, 0x82, 0x56, 0xAA, 0xAF, 0x2A, 0x56, 0x48, 0x6E, 0x47, 0x8D, 0x88, 0x35,
+    0x78, 0x18, 0x44, 0x56, 0x2B, 0x38, 0xAF, 0x92, 0x8E, 0xB5, 0x4E, 0xA5, 0xC3, 0x83, 0x49, 0x16,
+    0x44, 0x95, 0xD2, 0xB0, 0xD6, 0xBB, 0x56, 0x6B, 0xAD, 0x57, 0x7C, 0x2C, 0x36, 0x2E, 0xF5, 0x3A,
+    0x55, 0x6B, 0x39, 0x5B, 0x0D, 0x42, 0x4A, 0xBA, 0x50, 0xEB, 0x8C, 0xBE, 0x40, 0x7D, 0xFB, 0xAB,
+    0x80, 0x63, 0x1D, 0x28, 0xEE, 0xED, 0x44, 0x4E, 0x58, 0xE9, 0x28, 0xD8, 0x5F, 0x84, 0xBE, 0xBD,
+    0x66, 0x5D, 0x82, 0xD3, 0xB9, 0x04, 0x70, 0xE8, 0x53, 0x26, 0x1E, 0x0B, 0xE8, 0xE4, 0x75, 0x85,
+    0xE5, 0x7D, 0x5C, 0x7D, 0xF8, 0xFE, 0xF5, 0x82, 0x63, 0x9A, 0xBE, 0x8E, 0x1C, 0xEA, 0xD8, 0x40,
+    0x0E, 0xEE, 0x28, 0x24, 0x9F, 0xFE, 0xB5, 0x3A, 0x9F, 0xAC, 0x7B, 0x89, 0x83, 0x65, 0xB7, 0x2E,
+    0x3D, 0x88, 0x4A, 0xA1, 0x22, 0x4D, 0x53, 0x71, 0x69, 0x4D, 0xF1, 0xA7, 0x4D, 0x4A, 0x06, 0x7D,
+    0x40, 0x30, 0x48, 0xC0, 0x19, 0xF4, 0x62, 0x21, 0x71, 0x70, 0xE7, 0xFB, 0xAA, 0xBB, 0x5C, 0x97,
+    0x51, 0x31, 0x11, 0x72, 0x88, 0x6E, 0xF6, 0xDD, 0x07, 0x74, 0xB7, 0x63, 0xD5, 0x34, 0x7F, 0xAC,
+    0x03, 0x83, 0x41, 0x78, 0x9C, 0x7E, 0x97, 0xD8, 0x2E, 0x76, 0x85, 0xF8, 0xF6, 0x40, 0x99, 0xA9,
+    0xD3, 0x51, 0x04, 0x07, 0xA0, 0xB3, 0x0C, 0x3D, 0x3F, 0x21, 0xCD, 0xF4, 0xBC, 0x94, 0xA7, 0x19,
+    0x27, 0x07, 0x49, 0x07, 0x53, 0xE7, 0x6E, 0x83, 0xCC, 0x59, 0x5D, 0x57, 0x41, 0xB9, 0xE7, 0x69,
+    0x9A, 0x6E, 0xF3, 0xB4, 0x22, 0x21, 0x19, 0xF2, 0xB2, 0x84, 0xAF, 0x28, 0xC2, 0xF9, 0x7F, 0xD5,
+    0x94, 0xF2, 0xE8, 0xAE, 0x4C, 0x9C, 0xAE, 0x42, 0x8D, 0x0D, 0xFF, 0x1C, 0x2C, 0xD0, 0x85, 0x89,
+    0xA0, 0x55, 0xC6, 0x69, 0xDE, 0x57, 0xD5, 0xA3, 0x99, 0x5F, 0x7D, 0xB8, 0xF2, 0x50, 0x5B, 0x6E,
+    0xF5, 0x15, 0xD0, 0xC9, 0x41, 0xE1, 0xD7, 0x36, 0x28, 0xAA, 0xBA, 0x83, 0xD1, 0xDB, 0x26, 0xA0,
+    0x37, 0x09, 0xE8, 0x4D, 0x02, 0xFA, 0x36, 0x01, 0x7D, 0x9B, 0x21, 0xEB, 0x13, 0xBC, 0x7B, 0x10,
+    0xA6, 0x07, 0x7F, 0x5A, 0xDD, 0x26, 0x63, 0x82, 0x3F, 0xDD, 0x4C, 0x5D, 0x8D, 0xE8, 0x86, 0xD4,
+    0x8A, 0xB2, 0xDE, 0xB9, 0x90, 0xD3, 0x95, 0xD1, 0x90, 0x6C, 0x55, 0x16, 0x31, 0xFC, 0x55, 0xD9,
+    0x12, 0xD1, 0xED, 0xE4, 0x21, 0xF6, 0xFA, 0x98, 0x0D, 0x3A, 0xC7, 0xCE, 0x41, 0x47, 0xBA, 0xDC,
+    0xA7, 0xF1, 0xB9, 0x7D, 0xB1, 0xC2, 0x40, 0x44, 0x5F, 0x92, 0x41, 0xDA, 0xD4, 0xC2, 0xEC, 0x05,
+    0x91, 0x07, 0x83, 0x0C, 0x78, 0xD6, 0x49, 0xC6, 0x39, 0xF3, 0xE3, 0xB5, 0xE5, 0x18, 0xC1, 0xBB,
+    0x49, 0xE0, 0x6C, 0x7E, 0x1A, 0xBC, 0x1F, 0x77, 0xA0, 0xC0, 0x0F, 0x3C, 0x60, 0xE9, 0x02, 0x88,
+    0x64, 0x21, 0xF6, 0x6F, 0xB8, 0x19, 0x16, 0x55, 0xE8, 0x81, 0x33, 0xFF, 0xE6, 0xE7, 0xFC, 0x9E,
+    0xD7, 0xED, 0x1B, 0x37, 0x74, 0x8E, 0xB6, 0x2E, 0xD3, 0xD6, 0x6C, 0x68, 0xAB, 0x43, 0x5B, 0x67,
+    0x68, 0x6B, 0x83, 0xB6, 0xDE, 0x80, 0xAD, 0x26, 0x85, 0xAD, 0x76, 0x0C, 0x5B, 0x3D, 0xDA, 0x3A,
+    0x47, 0x5B, 0x97, 0x69, 0x6B, 0x06, 0x5B, 0xAD, 0x04, 0xB6, 0x3A, 0x60, 0x4E, 0xAD, 0x19, 0xDA,
+    0xDA, 0xA0, 0xAD, 0x44, 0x21, 0xDC, 0xDB, 0xC7, 0xC0, 0xB0, 0xD5, 0xA3, 0xAD, 0x73, 0x66, 0xD7,
+    0x43, 0xE7, 0xC6, 0x16, 0x41, 0x81, 0xEC, 0xAE, 0x7F, 0x34, 0xDD, 0xC7, 0xF2, 0x2B, 0x28, 0x53,
+    0xE0, 0x06, 0x50, 0x13, 0xB0, 0x41, 0x07, 0xE6, 0xDC, 0x03, 0x81, 0xA4, 0x1F, 0x33, 0x4A, 0x20,
+    0x87, 0xC3, 0xB5, 0xAB, 0x6E, 0xB5, 0x28, 0xBE, 0x01, 0x2F, 0x20, 0x91, 0xA5, 0x5E, 0xCC, 0x41,
+    0x7D, 0xDD, 0x53, 0x80, 0xEF, 0x3C, 0x45, 0xD4, 0x19, 0x95, 0x47, 0x84, 0xFB, 0x2A, 0x73, 0x2A,
+    0x1B, 0xFA, 0xC9, 0x4D, 0x5E, 0x63, 0xC8, 0x50, 0x19, 0x34, 0xF4, 0x8A, 0xFE, 0x28, 0xDF, 0x46,
+    0x67, 0xED, 0xAA, 0xD5, 0x06, 0xA6, 0x95, 0x57, 0xE4, 0xF2, 0x61, 0x16, 0xFF, 0x84, 0x58, 0xAB,
+    0x4B, 0x61, 0x5B, 0x49, 0xA1, 0xA2, 0xA0, 0x2C, 0xCE, 0x2B, 0x9C, 0x78, 0xEA, 0x5A, 0xF3, 0x64,
+    0x59, 0x7B, 0xED, 0x29, 0x02, 0x5C, 0x37, 0x54, 0x32, 0xAB, 0x1E, 0x3E, 0xFB, 0x95, 0x27, 0xD2,
+    0xAB, 0xE7, 0xA4, 0xEA, 0xBD, 0x55, 0xB7, 0xD0, 0x7D, 0xF7, 0xF9, 0xF1, 0x2E, 0xD7, 0x2A, 0x4F,
+    0x95, 0xDD, 0xA5, 0x7B, 0xB2, 0xF4, 0x31, 0xE8, 0xBA, 0x17, 0xC1, 0xA2, 0xD9, 0x8A, 0xB4, 0xA1,
+    0xE9, 0xB0, 0x7B, 0x82, 0x75, 0x48, 0x8F, 0x19, 0xD3, 0x66, 0x1C, 0x9A, 0xDC, 0x5C, 0x09, 0xB9,
+    0x9D, 0x13, 0x8C, 0x16, 0x06, 0xFE, 0x08, 0xFE, 0x1F, 0x21, 0x71, 0xEC, 0xFE, 0xD3, 0x2C, 0xE8,
+    0x50, 0xD7, 0x2E, 0x21, 0xF7, 0x26, 0xC9, 0x24, 0xAA, 0x45, 0x8A, 0x0A, 0x87, 0xC6, 0xBA, 0x69,
+    0x8B, 0x13, 0xF7, 0xD8, 0xF6, 0x1D, 0x54, 0x1D, 0xCB, 0xD9, 0xA7, 0x08, 0x22, 0xA5, 0x05, 0x0E,
+    0x05, 0x9C, 0xD4, 0xA4, 0xBE, 0x35, 0x6E, 0x39, 0x75, 0xB8, 0xEC, 0x19, 0xBC, 0x59, 0xA7, 0xB5,
+    0x4E, 0x4F, 0xB7, 0xE4, 0x5B, 0xD5, 0xF6, 0x67, 0x0D, 0x2F, 0x1D, 0xAE, 0xA8, 0xED, 0x82, 0xE4,
+    0x04, 0x03, 0x93, 0xA6, 0x44, 0xDC, 0xB4, 0x08, 0x75, 0xEB, 0x62, 0x91, 0x72, 0xBA, 0x2D, 0x58,
+    0xF6, 0xEC, 0xED, 0xB9, 0xF7, 0x71, 0x4D, 0x4F, 0x2B, 0xBA, 0xB7, 0xA0, 0x4B, 0x93, 0x85, 0x51,
+    0x60, 0xAD, 0x3C, 0xA8, 0xF6, 0x8F, 0xC8, 0x55, 0x32, 0xAE, 0xD2, 0xE1, 0x23, 0xC0, 0x1B, 0x56,
+    0x8D, 0x98, 0xB9, 0x7B, 0x2B, 0x82, 0x4F, 0xBD, 0xDB, 0x09, 0x96, 0xC2, 0xDE, 0x95, 0x04, 0xAD,
+    0xC6, 0x3F, 0x9D, 0x61, 0xF6, 0x81, 0xA1, 0x89, 0x81, 0x86, 0xA1, 0x5A, 0xDA, 0x69, 0x6F, 0xD4,
+    0x35, 0x44, 0xD5, 0x22, 0xE5, 0x82, 0xB6, 0xEF, 0x32, 0x1A, 0x95, 0x2A, 0x0D, 0x25, 0x26, 0xEB,
+    0xA2, 0xE7, 0xC6, 0x6E, 0x8C, 0x9C, 0x9D, 0xFD, 0xD2, 0xBA, 0x50, 0x98, 0x02, 0x74, 0x22, 0x83,
+    0x21, 0x89, 0x9D, 0xF9, 0x91, 0x93, 0xD2, 0x27, 0x44, 0xD6, 0x26, 0x8E, 0x36, 0x6E, 0x6E, 0x83,
+    0x05, 0x6D, 0x49, 0x2B, 0x6A, 0xCB, 0x5D, 0x69, 0xDA, 0x4B, 0x12, 0xFE, 0x32, 0xF8, 0xBB, 0xDF,
+    0x85, 0xD9, 0x5A, 0x3B, 0x64, 0xAF, 0xA4, 0x6E, 0xCC, 0x80, 0x13, 0xF5, 0xD3, 0x96, 0x68, 0x82,
+    0xE3, 0xD7, 0x6C, 0x95, 0xAB, 0x13, 0x2E, 0x4E, 0xB8, 0x36, 0x19, 0xB2, 0xD5, 0x49, 0x8C, 0xCF,
+    0x88, 0x06, 0xF9, 0x31, 0x79, 0x6D, 0x70, 0x43, 0xD2, 0x56, 0x3A, 0xCA, 0xEF, 0x49, 0x8C, 0xCD,
+    0xF5, 0xCC, 0x22, 0xF2, 0x8B, 0xAB, 0x99, 0xF1, 0x7E, 0x38, 0x11, 0xBF, 0xBC, 0x85, 0x71, 0xEE,
+    0x22, 0x37, 0x50, 0xE1, 0x33, 0xF0, 0x09, 0xCF, 0x0E, 0x63, 0xFE, 0xDD, 0xC9, 0xE9, 0x70, 0x77,
+    0x4C, 0x27, 0x92, 0xED, 0x8B, 0x57, 0xAF, 0x66, 0x56, 0x61, 0xF5, 0xED, 0xDC, 0x4D, 0x4D, 0x57,
+    0xC7, 0xCA, 0xED, 0x3C, 0x40, 0x49, 0x3B, 0x19, 0xC7, 0xF3, 0x39, 0xDA, 0x2D, 0x3E, 0x3B, 0xF4,
+    0xCA, 0x0C, 0xD2, 0x4F, 0x59, 0xA2, 0xEC, 0xE5, 0x6D, 0xDD, 0x26, 0x41, 0x2D, 0x90, 0x9A, 0x9B,
+    0xF7, 0x32, 0x27, 0x0A, 0xEE, 0x9C, 0x1E, 0x6C, 0x93, 0x3E, 0x75, 0xBA, 0x4C, 0x13, 0x53, 0x73,
+    0xA9, 0x66, 0x2B, 0xB6, 0x0A, 0xD4, 0x52, 0xEA, 0x82, 0x83, 0xE3, 0xAA, 0x68, 0x97, 0xEE, 0xB7,
+    0x1F, 0x39, 0x9A, 0xBA, 0x5D, 0x3E, 0x87, 0x25, 0x5E, 0x81, 0x09, 0xA7, 0x64, 0xBA, 0x4A, 0xCD,
+    0xB5, 0x6F, 0x7A, 0xD5, 0x83, 0xBF, 0x67, 0xB7, 0x71, 0x2A, 0xEA, 0xEC, 0x27, 0xA5, 0xE5, 0x4E,
+    0x0C, 0x91, 0x6C, 0x3C, 0xFB, 0x5D, 0x58, 0xD0, 0xEC, 0x44, 0x56, 0xEE, 0xC7, 0x4E, 0x0A, 0x94,
+    0x48, 0xFC, 0x38, 0x88, 0xC2, 0x28, 0x94, 0x6D, 0x69, 0x3A, 0x05, 0xB7, 0x84, 0xA5, 0x1D, 0xFD,
+    0x17, 0xBD, 0xD5, 0x4E, 0xDB, 0x67, 0xAF, 0xDD, 0x26, 0x32, 0x3E, 0x50, 0x56, 0x57, 0x31, 0xC8,
+    0x7E, 0xEF, 0x4C, 0x24, 0x0D, 0x7B, 0x37, 0xFB, 0x27, 0x31, 0xFE, 0x33, 0xC8, 0xD0, 0xB0, 0xCE,
+    0xD0, 0x43, 0x63, 0x19, 0x3A, 0x81, 0xB1, 0xA7, 0x22, 0xE6, 0x1C, 0x9C, 0xAE, 0x9B, 0x66, 0xC7,
+    0xAF, 0x05, 0xC8, 0x19, 0x3B, 0xAB, 0x22, 0x8C, 0x1F, 0x7D, 0xA0, 0x5C, 0x3D, 0x52, 0x0E, 0xDF,
+    0xF1, 0x72, 0xA3, 0xAE, 0x74, 0x15, 0xFA, 0x16, 0xD4, 0x8D, 0x51, 0x75, 0x1B, 0x8A, 0x93, 0x88,
+    0x8E, 0x26, 0x83, 0x18, 0xBA, 0xA3, 0x45, 0x5B, 0xCC, 0x0B, 0x03, 0x0D, 0x7A, 0x58, 0xFD, 0xBE,
+    0x23, 0x5E, 0xAE, 0xF9, 0x74, 0x8E, 0x14, 0x1D, 0x49, 0x05, 0x7A, 0x0E, 0x72, 0x5E, 0xCD, 0xE9,
+    0x73, 0x8C, 0x73, 0x6C, 0x3A, 0x5A, 0xF3, 0x12, 0xFC, 0xEE, 0xB7, 0x86, 0x0F, 0xC2, 0x3E, 0x87,
+    0x31, 0xD5, 0xC6, 0xFB, 0x51, 0xF1, 0x3F, 0xC2, 0xDF, 0x28, 0x4F, 0xC2, 0xBC, 0x8F, 0x40, 0x1E,
+    0xAD, 0x77, 0x18, 0xA6, 0xFF, 0xCC, 0x87, 0x0F, 0xB9, 0x5D, 0xB8, 0x85, 0x9B, 0xB2, 0xA5, 0x70,
+    0x63, 0xB4, 0x3A, 0x9A, 0x50, 0xD5, 0xD6, 0xC3, 0xC9, 0xDA, 0xD0, 0x86, 0xF2, 0x8A, 0xE9, 0xAE,
+    0xE0, 0xF5, 0x5E, 0xF5, 0xF4, 0x7C, 0x7F, 0xDD, 0x90, 0xFC, 0xE2, 0x39, 0xF9, 0x7A, 0xB9, 0x29,
+    0xD7, 0x82, 0x6C, 0xB8, 0x36, 0x82, 0xBB, 0xE3, 0xE0, 0x1F, 0x18, 0xF7, 0x9F, 0x3F, 0xCE, 0xED,
+    0xBF, 0x59, 0xB9, 0xD3, 0xB5, 0x72, 0x37, 0x67, 0x01, 0xDB, 0x19, 0xCB, 0xCC, 0x43, 0x58, 0xFD,
+    0xC8, 0x4D, 0xF8, 0xB4, 0x8D, 0x0F, 0xDB, 0x16, 0xEB, 0x63, 0x4D, 0xBC, 0x3B, 0x5B, 0xBA, 0x48,
+    0x84, 0xFF, 0xB9, 0xFC, 0x62, 0xF1, 0xD8, 0xC3, 0xE2, 0x59, 0xDE, 0x25, 0x21, 0xEE, 0x0E, 0x48,
+    0xFA, 0xF5, 0xC4, 0x2A, 0x9C, 0x0C, 0x63, 0xE6, 0x1E, 0xEC, 0xC6, 0x7A, 0xB5, 0xB6, 0xDB, 0x2A,
+    0xDA, 0x0F, 0xD9, 0x0E, 0x37, 0x02, 0x6A, 0x68, 0xBB, 0xFF, 0xD3, 0xDE, 0x58, 0x72, 0x53, 0x0C,
+    0xEA, 0xE4, 0xBE, 0x82, 0xB8, 0x8F, 0x27, 0xF7, 0x04, 0xC6, 0x57, 0x68, 0x2F, 0xE6, 0x00, 0xED,
+    0x37, 0x25, 0xE3, 0x03, 0x71, 0x33, 0x39, 0xDB, 0xB5, 0x70, 0x90, 0x04, 0x3C, 0x0E, 0x8D, 0x11,
+    0xF9, 0x49, 0x8C, 0x3D, 0x5D, 0xF3, 0x29, 0xB6, 0xED, 0xE9, 0x5D, 0x97, 0xEF, 0x3E, 0xA3, 0x3E,
+    0xBF, 0xAB, 0x6F, 0x6A, 0xEC, 0xDA, 0xBD, 0xBB, 0xD7, 0xF2, 0x7F, 0x11, 0x06, 0x58, 0xFF, 0x07,
+    0x6F, 0x23, 0x94, 0x6D, 0xF0, 0x18, 0xE0, 0x37, 0x37, 0x94, 0x9D, 0x3E, 0x6A, 0xEC, 0x08, 0x35,
+    0x9F, 0x24, 0xFA, 0xC3, 0x8E, 0xE0, 0x1B, 0x49, 0x4F, 0x82, 0x6F, 0x46, 0x10, 0xAF, 0xE0, 0xBA,
+    0x60, 0x85, 0x1C, 0x09, 0x2D, 0x83, 0xBC, 0x09, 0x0C, 0xF2, 0x63, 0x10, 0x92, 0x59, 0x32, 0x8E,
+    0x93, 0x53, 0xA3, 0x87, 0x4A, 0x43, 0x4A, 0xE1, 0x7C, 0x9A, 0x52, 0xA0, 0x44, 0xDE, 0x42, 0x8D,
+    0x70, 0xAD, 0xD4, 0x45, 0xF1, 0x17, 0xFC, 0x9F, 0x03, 0x37, 0xB1, 0xF5, 0x20, 0x1C, 0x54, 0x79,
+    0xE7, 0x21, 0xEF, 0x7C, 0xE4, 0x5D, 0x88, 0xE3, 0x6A, 0x1C, 0x5A, 0x3F, 0x89, 0x83, 0xBB, 0xDE,
+    0x1D, 0xAF, 0x5B, 0xE7, 0x9D, 0x82, 0x2A, 0x59, 0x1C, 0x93, 0xEF, 0x44, 0x9D, 0x77, 0xD1, 0x04,
+    0xC7, 0xE7, 0x23, 0xA7, 0x0E, 0x9F, 0x92, 0xC4, 0xE2, 0xDC, 0x4E, 0x64, 0xD6, 0x64, 0xC3, 0x9E,
+    0x30, 0x91, 0xF1, 0xF7, 0xCA, 0x35, 0xFD, 0x07, 0x03, 0x1F, 0xC7, 0x94, 0xAC, 0x8B, 0x4C, 0x70,
+    0xEC, 0x9A, 0x78, 0x73, 0xFF, 0x46, 0x9B, 0x9A, 0x76, 0xBC, 0xEA, 0xDF, 0x5C, 0x86, 0xC4, 0xFB,
+    0xF8, 0xBA, 0x6C, 0x02, 0xA8, 0x8C, 0x6E, 0x94, 0xB6, 0x49, 0xB7, 0x17, 0xC8, 0x64, 0x17, 0xEA,
+    0xA7, 0xB5, 0x6D, 0xEE, 0xE9, 0x34, 0x19, 0xB3, 0x90, 0x30, 0x1B, 0x92, 0x87, 0xFB, 0xA7, 0x49,
+    0x65, 0xAF, 0x70, 0xB8, 0xDF, 0x33, 0x89, 0x49, 0x7E, 0x9D, 0x62, 0xC8, 0xED, 0x75, 0x11, 0xAA,
+    0x7A, 0x16, 0x86, 0xBB, 0xEB, 0x2E, 0x3E, 0x7F, 0x8D, 0x6C, 0xA3, 0x55, 0x0C, 0xA7, 0x67, 0x74,
+    0x6F, 0x31, 0x48, 0x86, 0x8B, 0x81, 0x8A, 0xBD, 0x8F, 0x16, 0xB4, 0x21, 0x6F, 0x59, 0x0C, 0x31,
+    0xF2, 0x5A, 0x86, 0xEE, 0xBC, 0x8D, 0xB4, 0x07, 0xAD, 0x0B, 0xD9, 0xBA, 0xC3, 0xEA, 0xE1, 0xBE,
+    0x29, 0x20, 0xB0, 0x94, 0x69, 0x56, 0x76, 0x43, 0x35, 0x6A, 0x02, 0x7E, 0xC2, 0x3C, 0xF1, 0x81,
+    0x9B, 0x10, 0x6F, 0xB9, 0xF2, 0xF7, 0xF8, 0x80, 0xC1, 0x3F, 0x35, 0x1A, 0x78, 0x24, 0x94, 0x0E,
+    0xB7, 0xA8, 0xB6, 0xA3, 0xCB, 0x51, 0xDD, 0x79, 0xD4, 0xAD, 0xC7, 0x4A, 0x4C, 0x99, 0xF1, 0xF5,
+    0xE9, 0xE3, 0x77, 0xD3, 0xBF, 0x01, 0xCD, 0x5B, 0x31, 0x8C, 0x1C, 0x67, 0x15, 0x7E, 0xFF, 0x8C,
+    0x7D, 0x13, 0x31, 0xCA, 0x8D, 0x8B, 0x18, 0x23, 0x1C, 0xDF, 0x50, 0x50, 0x20, 0xEB, 0x9C, 0x69,
+    0x52, 0x58, 0x68, 0xEF, 0x66, 0x42, 0x0A, 0x0A, 0x0A, 0xAE, 0xC8, 0x41, 0x61, 0x21, 0x5C, 0x50,
+    0xA0, 0x50, 0x9C, 0x0B, 0x17, 0x11, 0xE4, 0x76, 0x87, 0xD0, 0x91, 0x02, 0x23, 0x21, 0xDA, 0x5C,
+    0x81, 0x84, 0x73, 0x44, 0xF8, 0x0A, 0x17, 0x29, 0x6E, 0x6F, 0x87, 0xA4, 0xA0, 0x40, 0x48, 0x23,
+    0x50, 0x44, 0x83, 0x60, 0x40, 0x01, 0x09, 0x1B, 0xF0, 0x98, 0x4C, 0xC4, 0xDC, 0x65, 0x76, 0x87,
+    0xF7, 0xBD, 0xFF, 0x9F, 0xD9, 0xD9, 0xB3, 0xE3, 0x18, 0xFB, 0xBC, 0xF6, 0xFA, 0xF6, 0xDF, 0xF3,
+    0xDE, 0xEC, 0xFC, 0xEF, 0x7D, 0xFF, 0xFB, 0xDF, 0xFB, 0xDE, 0x7B, 0xFF, 0x12, 0xD1, 0xFA, 0x3A,
+    0x11, 0x59, 0xF5, 0x84, 0x47, 0xB5, 0xFE, 0x12, 0xB5, 0x0F, 0x2F, 0xC2, 0x18, 0xC6, 0x18, 0x07,
+    0x32, 0xD6, 0x09, 0xAE, 0xFC, 0x33, 0x46, 0xFB, 0x37, 0x18, 0x5D, 0x37, 0xE5, 0x71, 0xC9, 0xC1,
+    0xD8, 0x73, 0x32, 0x1E, 0x2F, 0xDB, 0x18, 0x73, 0x3B, 0xE7, 0x0B, 0x53, 0x8C, 0xF6, 0x7B, 0x5F,
+    0xE7, 0xD1, 0xAB, 0xEB, 0x82, 0x2F, 0x24, 0xC5, 0x63, 0x8F, 0x54, 0x49, 0x74, 0x9D, 0xA8, 0xE2,
+    0x0B, 0x31, 0xE2, 0x23, 0x15, 0x9D, 0x2E, 0x68, 0x61, 0x12, 0x8D, 0x26, 0x14, 0xF2, 0x34, 0xC7,
+    0xD7, 0xD7, 0x28, 0xA8, 0x73, 0x3A, 0xB9, 0x2E, 0x42, 0x90, 0xB3, 0xFF, 0x0C, 0x0D, 0x2E, 0x14,
+    0xAA, 0xB0, 0x73, 0x27, 0xB3, 0x73, 0x2F, 0xB1, 0x33, 0x3F, 0x72, 0xD2, 0x90, 0x5C, 0x7E, 0x7A,
+    0x49, 0x9F, 0x9F, 0x43, 0xF2, 0xE3, 0x21, 0x85, 0xD1, 0x2E, 0x0D, 0xA2, 0x21, 0xDD, 0xA2, 0xBE,
+    0xBD, 0x41, 0xE1, 0x2F, 0x83, 0x7F, 0xFB, 0xA5, 0x57, 0x50, 0xA4, 0x70, 0x97, 0x78, 0x01, 0x63,
+    0xB6, 0x88, 0x71, 0x52, 0x89, 0x76, 0x39, 0x46, 0x45, 0x4F, 0x86, 0xD6, 0x9F, 0xA1, 0x8B, 0x74,
+    0x46, 0xA5, 0xE4, 0xDD, 0x4A, 0xC8, 0xC1, 0x7A, 0xAC, 0xD1, 0x11, 0x6A, 0xFF, 0x38, 0x35, 0xE3,
+    0xC7, 0x2B, 0x18, 0x6C, 0xDC, 0x99, 0xDC, 0x78, 0x2A, 0x8F, 0xA7, 0x7F, 0xAF, 0x31, 0x5A, 0xE3,
+    0x23, 0xD0, 0x75, 0x89, 0x6F, 0xCB, 0x52, 0x59, 0x2C, 0x04, 0x04, 0x11, 0xC9, 0x21, 0xC1, 0x08,
+    0x13, 0x29, 0x20, 0xEA, 0x42, 0x25, 0x1F, 0xFF, 0x5D, 0xC1, 0xAC, 0x62, 0x02, 0x51, 0xB3, 0xFE,
+    0x1B, 0x13, 0xC8, 0xB0, 0x91, 0x52, 0x10, 0xBB, 0x39, 0xED, 0xF1, 0xE7, 0xAD, 0x92, 0xC5, 0xE6,
+    0xDB, 0x28, 0xF2, 0x20, 0xBD, 0x0F, 0x6D, 0x02, 0x7C, 0x3A, 0xC4, 0x87, 0x42, 0x81, 0xB3, 0x1D,
+    0xFA, 0xED, 0x20, 0xFF, 0x95, 0xBF, 0xF2, 0xC5, 0x9F, 0x21, 0x2F, 0x63, 0x88, 0xEC, 0xC9, 0x35,
+    0x9E, 0x6D, 0x50, 0xC7, 0xCD, 0xDA, 0x42, 0x1E, 0xE0, 0x0C, 0x14, 0x9E, 0x23, 0x41, 0xB1, 0x11,
+    0xC5, 0x65, 0x30, 0xFA, 0x83, 0xD8, 0x2A, 0xBC, 0xC4, 0x49, 0xDD, 0x84, 0xC7, 0x28, 0x88, 0xF4,
+    0x1D, 0x71, 0xFF, 0xE1, 0xA1, 0x67, 0x9F, 0x8E, 0xF1, 0xDF, 0x96, 0xC9, 0xBF, 0x51, 0x90, 0x53,
+    0xB3, 0xA0, 0xCF, 0xC8, 0x5D, 0xB0, 0x9F, 0xD5, 0x18, 0xC8, 0x03, 0x61, 0xEF, 0xAB, 0x7C, 0x87,
+    0x9E, 0xCD, 0x1A, 0x9C, 0x68, 0x35, 0x9E, 0xAF, 0xC2, 0x27, 0xF9, 0x39, 0xC2, 0x8A, 0x44, 0xE4,
+    0xFC, 0x3A, 0xA1, 0x25, 0x95, 0xB1, 0x28, 0x47, 0xA9, 0xB0, 0x3C, 0x76, 0x31, 0x40, 0x6B, 0x92,
+    0x5D, 0x7E, 0x82, 0xBA, 0x8F, 0xF9, 0x2A, 0x8C, 0xC7, 0x26, 0x3F, 0xF7, 0x8C, 0xD8, 0x1D, 0x29,
+    0x8F, 0x48, 0x61, 0x6C, 0x6E, 0x95, 0x9E, 0xC3, 0xAF, 0x45, 0x29, 0x72, 0x65, 0xD3, 0x8D, 0x7E,
+    0x7C, 0x56, 0x6F, 0xAD, 0xB8, 0xD6, 0x5C, 0x54, 0x27, 0xD1, 0x9D, 0x44, 0x79, 0xAD, 0xBD, 0x56,
+    0x5F, 0xEB, 0xAF, 0x01, 0xD0, 0x3A, 0x6A, 0x75, 0xCD, 0xD8, 0xEF, 0x8C, 0xFA, 0x1D, 0x7D, 0x8D,
+    0x00, 0xA1, 0x91, 0x30, 0x50, 0x18, 0x2C, 0x0C, 0x18, 0xF0, 0x44, 0x2A, 0x5B, 0x6A, 0x44, 0x15,
+    0x49, 0xC3, 0xA4, 0x2B, 0x27, 0x40, 0x01, 0x2A, 0x04, 0x58, 0x08, 0xB8, 0x10, 0x80, 0xA1, 0xA0,
+    0x5D, 0x0A, 0x99, 0x75, 0x78, 0x97, 0x01, 0x00, 0x09, 0x42, 0x02, 0x91, 0xC6, 0xA8, 0x01, 0x49,
+    0xBB, 0x40, 0x99, 0x99, 0xDE, 0x7E, 0x7B, 0xEA, 0xFA, 0x83, 0x64, 0x16, 0xA5, 0xB0, 0x3E, 0xE0,
+    0x89, 0x4E, 0x1F, 0x5C, 0x2B, 0xE0, 0x3A, 0xB0, 0x73, 0x18, 0x9A, 0x50, 0x36, 0x29, 0xEB, 0xC6,
+    0xEE, 0xD1, 0x4B, 0xEE, 0xF2, 0xC3, 0xCE, 0x84, 0x47, 0x16, 0x91, 0xC7, 0x50, 0x10, 0x0C, 0x05,
+    0x8B, 0xBE, 0x20, 0xB8, 0x29, 0x18, 0x0D, 0xC5, 0x22, 0x2B, 0x00, 0xCE, 0x23, 0xE3, 0xCF, 0x5E,
+    0x93, 0x55, 0x3F, 0xB5, 0xFF, 0x1D, 0x7E, 0x7B, 0x54, 0xD7, 0x57, 0x3A, 0x86, 0x51, 0x8B, 0x6F,
+    0xDC, 0x7B, 0x4E, 0x8C, 0xA7, 0x27, 0x16, 0x7D, 0x49, 0xC6, 0xB5, 0xC6, 0xA6, 0x9D, 0x7D, 0xC1,
+    0xEF, 0x02, 0x8B, 0x09, 0x57, 0x09, 0x01, 0x31, 0xC2, 0x5D, 0xF2, 0xFC, 0x11, 0x3C, 0x38, 0x5C,
+    0x26, 0x46, 0x96, 0x89, 0xFA, 0x32, 0x0E, 0xC5, 0xEB, 0x0D, 0x65, 0x55, 0xE1, 0x3C, 0xF1, 0xFB,
+    0x2D, 0x00, 0xC7, 0x0E, 0x94, 0xC4, 0x85, 0xF2, 0x67, 0xE1, 0x44, 0x1B, 0xBC, 0x1E, 0x08, 0x0D,
+    0x6B, 0x74, 0xE3, 0x0A, 0x2F, 0x59, 0x5D, 0x27, 0x47, 0x82, 0x86, 0x2B, 0xA1, 0x61, 0xCF, 0xEC,
+    0x23, 0xB5, 0x3D, 0xD9, 0x22, 0x6B, 0x7B, 0x82, 0xBF, 0x03, 0x81, 0x35, 0x1E, 0x02, 0xC4, 0xA2,
+    0xB1, 0x93, 0xB3, 0x70, 0x2C, 0x9E, 0x0B, 0x08, 0xFC, 0x98, 0x11, 0x10, 0x00, 0x44, 0x7F, 0x51,
+    0x5F, 0xB4, 0xAF, 0x20, 0x42, 0x05, 0xDD, 0x45, 0x75, 0xD1, 0x5C, 0x14, 0x17, 0xBD, 0x95, 0x56,
+    0x5B, 0x58, 0x47, 0x08, 0xF3, 0x69, 0xF8, 0x07, 0xFF, 0xAF, 0x1E, 0x93, 0x7F, 0xB0, 0x3D, 0x06,
+    0x02, 0x3D, 0x3D, 0x30, 0x0A, 0xE7, 0x31, 0xC5, 0x09, 0x01, 0xB7, 0x33, 0xF8, 0x37, 0xDE, 0x84,
+    0x54, 0x63, 0x63, 0xB0, 0x53, 0xAB, 0xDD, 0x6C, 0x6D, 0xB5, 0x22, 0x95, 0x20, 0x54, 0x26, 0xAC,
+    0xB7, 0x1B, 0x9F, 0xDA, 0x5F, 0x1F, 0x44, 0xAC, 0x75, 0x8D, 0x19, 0xD7, 0x78, 0xB2, 0xAC, 0x9D,
+    0xD9, 0x65, 0x05, 0xFB, 0xA3, 0xC8, 0xCA, 0xA1, 0x92, 0xC7, 0x90, 0xFA, 0x71, 0x10, 0x85, 0x51,
+    0xC8, 0x88, 0xF4, 0x9D, 0x82, 0xA1, 0x8A, 0x69, 0x18, 0x7D, 0x92, 0x93, 0xF8, 0x3C, 0xF1, 0xBA,
+    0xF7, 0x2C, 0x96, 0xCD, 0xBF, 0x16, 0x99, 0x3D, 0xD6, 0xBA, 0xA7, 0xB9, 0xA9, 0xF6, 0x79, 0xBA,
+    0x42, 0xCB, 0x2C, 0x84, 0x7F, 0x8B, 0x6D, 0xA7, 0x43, 0x6F, 0x8E, 0x44, 0x45, 0xFD, 0x80, 0xE9,
+    0xC2, 0xA4, 0xD8, 0x7B, 0x3C, 0x16, 0x15, 0xC9, 0xEC, 0x4F, 0x55, 0x99, 0x7D, 0xBA, 0xD6, 0xD9,
+    0xD5, 0x47, 0xA0, 0xE6, 0xFC, 0x14, 0xB1, 0x24, 0x12, 0x52, 0x43, 0x92, 0x5E, 0x6D, 0x3F, 0x17,
+    0x02, 0x5E, 0x2F, 0x7F, 0x78, 0x7D, 0x02, 0xB8, 0x62, 0x9E, 0x28, 0xBF, 0x2B, 0x51, 0x83, 0x2F,
+    0xB7, 0x12, 0xF8, 0xBE, 0xDB, 0x70, 0xD4, 0xE2, 0xCB, 0xE1, 0xB1, 0x84, 0x41, 0xCC, 0x77, 0x4D,
+    0xC5, 0x29, 0x48, 0xE8, 0x90, 0xC8, 0x21, 0x81, 0x23, 0x98, 0x0D, 0x5A, 0xC0, 0x84, 0xB1, 0x20,
+    0x80, 0x41, 0x40, 0x83, 0x00, 0x07, 0x01, 0x0F, 0x02, 0x20, 0x82, 0x88, 0x40, 0x22, 0x98, 0xDC,
+    0x67, 0xD0, 0xBA, 0x0F, 0xF2, 0xC6, 0x8E, 0xD2, 0x39, 0xD8, 0x28, 0x59, 0x1E, 0xBB, 0xC2, 0x3C,
+    0x15, 0xAC, 0xBF, 0x04, 0x96, 0xD1, 0x3D, 0xB8, 0x8C, 0xDA, 0xBE, 0xCA, 0xC3, 0xA8, 0xEC, 0xE3,
+    0x02, 0x0C, 0x31, 0xBB, 0x64, 0x16, 0x16, 0x17, 0xF0, 0xC5, 0x21, 0x22, 0xF8, 0x2A, 0x07, 0xF0,
+    0xAF, 0x8D, 0x11, 0xBF, 0xDF, 0xEF, 0xB2, 0x55, 0x82, 0x22, 0xE4, 0xC1, 0xB6, 0x57, 0x60, 0x19,
+    0xB9, 0xD7, 0x46, 0x0B, 0xD0, 0xAE, 0xE0, 0xEF, 0x63, 0x52, 0xFB, 0xA3, 0x67, 0xC9, 0x49, 0x42,
+    0xD0, 0xDA, 0x00, 0xEB, 0x1C, 0xE0, 0xBE, 0x72, 0xF3, 0x55, 0x0C, 0x7C, 0x99, 0xFF, 0xA5, 0x02,
+    0x9E, 0x9D, 0x85, 0x73, 0x7F, 0x82, 0x5C, 0x83, 0xB4, 0x2D, 0x30, 0x44, 0xFF, 0x90, 0xA5, 0xE5,
+    0x78, 0xB0, 0x57, 0x73, 0x5C, 0x88, 0x79, 0x23, 0x05, 0xB0, 0xBE, 0x15, 0x33, 0xEC, 0xF2, 0xE7,
+    0x55, 0x4E, 0xDE, 0xDF, 0x98, 0xC6, 0xA8, 0xD1, 0xFE, 0xD4, 0xB9, 0xD9, 0x77, 0x77, 0x6E, 0x73,
+    0x46, 0xE8, 0xA2, 0xC5, 0xF7, 0xB8, 0xEC, 0x20, 0x7C, 0x20, 0x62, 0xF9, 0xB0, 0x0B, 0x15, 0x3D,
+    0x46, 0x70, 0xEE, 0x87, 0x0F, 0xCF, 0x15, 0x21, 0x79, 0x60, 0xCF, 0x93, 0x0D, 0x43, 0xB2, 0x67,
+    0xB3, 0xAF, 0xC7, 0x0A, 0xD3, 0xFC, 0x81, 0x90, 0xE4, 0x17, 0x1B, 0x88, 0x84, 0xBE, 0x3F, 0xDF,
+    0x59, 0x9C, 0x63, 0x18, 0x9E, 0x6D, 0x13, 0x67, 0xC0, 0x84, 0x94, 0xF6, 0x31, 0x5B, 0x93, 0xD2,
+    0xA2, 0x8B, 0x0F, 0x30, 0x5E, 0xC0, 0xF8, 0x01, 0xE3, 0x09, 0x5A, 0x5F, 0x60, 0x7C, 0x74, 0x12,
+    0x30, 0x97, 0x39, 0x3D, 0x89, 0xF8, 0xC7, 0x64, 0x1B, 0xF2, 0x22, 0x84, 0x55, 0x16, 0xDF, 0x95,
+    0xE4, 0x03, 0x5E, 0x5A, 0xF2, 0xE0, 0x44, 0x48, 0xAB, 0xA6, 0x92, 0xEC, 0x11, 0xB7, 0xAF, 0x25,
+    0xF0, 0xDB, 0x35, 0xC4, 0x0F, 0x75, 0xD2, 0x0E, 0x2E, 0x19, 0x89, 0xF7, 0x0E, 0xB5, 0xFF, 0x0E,
+    0xB5, 0x2B, 0xED, 0x6B, 0xEB, 0xDE, 0xD4, 0x2F, 0xFC, 0x86, 0x12, 0x6A, 0x49, 0xA7, 0xC6, 0xE4,
+    0xF0, 0xE4, 0xA3, 0x3A, 0x11, 0x46, 0x47, 0xC7, 0x23, 0xBD, 0x90, 0x9C, 0x7B, 0xA8, 0x22, 0x27,
+    0x27, 0x3E, 0xAF, 0x83, 0x0D, 0xCF, 0x3A, 0x31, 0xEE, 0x76, 0xD7, 0x6C, 0x94, 0x52, 0x33, 0x0A,
+    0x55, 0x04, 0xB1, 0x75, 0xBB, 0xCE, 0xED, 0x0F, 0x7E, 0x90, 0xDB, 0xFF, 0xB2, 0x72, 0xA7, 0xB4,
+    0x72, 0x97, 0xA9, 0xA6, 0x9B, 0xDA, 0x19, 0x52, 0x37, 0x8F, 0xE3, 0x9F, 0x1F, 0xB9, 0x49, 0xC0,
+    0x42, 0xF3, 0x6A, 0xC7, 0xAB, 0xE6, 0xB9, 0x49, 0xDE, 0xCD, 0x5D, 0x72, 0x4A, 0x31, 0xF0, 0x4F,
+    0x86, 0x42, 0xD5, 0x78, 0xC4, 0xF4, 0xCD, 0xBF, 0xAD, 0x5F, 0xF8, 0x70, 0x2E, 0x50, 0xCC, 0xAA,
+    0xFC, 0xD9, 0xC9, 0xB6, 0x3C, 0x71, 0xB1, 0x2A, 0x8E, 0xB3, 0x64, 0xA3, 0xD4, 0xFE, 0xCF, 0xCD,
+    0xDC, 0xBE, 0x69, 0xE7, 0xCE, 0x3F, 0x8D, 0xCA, 0x19, 0x54, 0xE6, 0xE7, 0xFD, 0xA8, 0x0C, 0x53,
+    0xF5, 0x8B, 0x67, 0xE9, 0x8B, 0xF5, 0x75, 0xDA, 0x0A, 0xB2, 0xB6, 0xCE, 0x86, 0x82, 0x90, 0x01,
+    0x81, 0x74, 0xEA, 0x42, 0x8D, 0xAA, 0xED, 0x13, 0xEA, 0x35, 0xC9, 0x70, 0x93, 0x10, 0x6F, 0x9A,
+    0x98, 0x69, 0xB8, 0x15, 0xE4, 0x3C, 0x25, 0xD9, 0x42, 0x82, 0xA9, 0xBC, 0xF2, 0xE9, 0xD5, 0x7A,
+    0xF7, 0x52, 0x90, 0xEB, 0x69, 0x3E, 0x75, 0x95, 0xDC, 0x4A, 0xAE, 0x2B, 0x51, 0xA5, 0xB2, 0x90,
+    0x1D, 0xC8, 0x4F, 0xC6, 0xF1, 0x99, 0x93, 0x04, 0x72, 0xDB, 0x8C, 0xE5, 0x26, 0xF1, 0x76, 0x87,
+    0x0F, 0x3A, 0xCC, 0xBD, 0x1F, 0x81, 0xA0, 0x7C, 0x6B, 0xC6, 0x5E, 0x4F, 0x70, 0x76, 0x8B, 0x82,
+    0x59, 0x99, 0x8C, 0x40, 0x31, 0x67, 0x70, 0x24, 0xDB, 0x59, 0x6F, 0x65, 0x0A, 0xDF, 0x02, 0xE3,
+    0x82, 0x5E, 0xDD, 0x12, 0xA1, 0xDD, 0xE1, 0xD0, 0x8F, 0x40, 0x54, 0x8E, 0xAB, 0x9C, 0x32, 0x70,
+    0x4C, 0x45, 0x44, 0x95, 0x69, 0x1E, 0x44, 0xE0, 0x47, 0x20, 0x18, 0xDC, 0x17, 0xC2, 0x3D, 0x92,
+    0x64, 0xDF, 0x94, 0xF2, 0x60, 0xC8, 0xD6, 0x58, 0x63, 0x11, 0x88, 0x7F, 0x0E, 0x8D, 0x0F, 0x7D,
+    0x00, 0x5B, 0x70, 0x62, 0xED, 0xFF, 0x48, 0x6F, 0x9B, 0x51, 0x4E, 0x41, 0xD6, 0x29, 0xE5, 0x4C,
+    0xEE, 0x2C, 0xE5, 0x3C, 0x02, 0x2D, 0xCF, 0x6E, 0x05, 0xBC, 0xE1, 0xEC, 0x4C, 0x97, 0x86, 0xF8,
+    0x5F, 0xEC, 0x47, 0xF0, 0xEF, 0x70, 0xEF, 0xE1, 0x5B, 0x5E, 0xAE, 0x30, 0xEB, 0x3B, 0xF5, 0x84,
+    0xE7, 0x7D, 0x61, 0x50, 0x60, 0x56, 0x9E, 0x80, 0x47, 0x9E, 0x82, 0x67, 0x0F, 0x49, 0x27, 0xBF,
+    0x98, 0x79, 0x95, 0x74, 0x0E, 0xAC, 0x93, 0x60, 0x9D, 0x05, 0xE3, 0xB2, 0x0A, 0x72, 0x60, 0xCA,
+    0x50, 0xEA, 0xB8, 0x7D, 0xF1, 0x45, 0x9B, 0x22, 0xFF, 0x50, 0xC6, 0x4A, 0xF4, 0xA8, 0x70, 0x27,
+    0xBE, 0x8C, 0x3F, 0xCD, 0xB2, 0xF1, 0xC8, 0xD2, 0xE9, 0xAA, 0xAD, 0xD4, 0x50, 0x75, 0x65, 0xC6,
+    0xD4, 0x7F, 0x36, 0x9B, 0x04, 0x88, 0xD4, 0x05, 0x09, 0x59, 0x75, 0x34, 0x0D, 0xEC, 0x01, 0x38,
+    0x48, 0x88, 0x3F, 0x87, 0x08, 0x73, 0xC7, 0x3A, 0x1C, 0xE4, 0xEC, 0x16, 0xAF, 0x51, 0x90, 0xF3,
+    0x2A, 0xF1, 0xBC, 0x52, 0x41, 0x2E, 0x79, 0x69, 0x58, 0x2A, 0x37, 0x61, 0xA1, 0xD8, 0xE3, 0xE4,
+    0xBA, 0xB4, 0x01, 0xBF, 0xA3, 0xCB, 0x1B, 0x01, 0x16, 0x2D, 0xD0, 0x05, 0x17, 0x0F, 0x51, 0x96,
+    0x2D, 0x30, 0x7C, 0x2B, 0x40, 0x6A, 0x12, 0xC2, 0xD3, 0x88, 0x3C, 0xAB, 0x6D, 0xEA, 0x22, 0x22,
+    0x21, 0x6A, 0x5D, 0x80, 0xE3, 0x9B, 0x68, 0xA9, 0x64, 0x01, 0x25, 0xD9, 0xC1, 0xE0, 0xBE, 0xCE,
+    0xEA, 0x9C, 0xB3, 0x66, 0xF8, 0xF5, 0x00, 0xE6, 0xE6, 0xE3, 0x72, 0x21, 0x2A, 0x52, 0x12, 0x97,
+    0xEA, 0xB8, 0x7B, 0x28, 0xBF, 0x88, 0x1B, 0x20, 0xA6, 0xF9, 0xC5, 0xEA, 0x6C, 0xB1, 0xAA, 0x6A,
+    0xC5, 0x28, 0x1B, 0x59, 0x34, 0x0D, 0x6A, 0x07, 0xB9, 0xFB, 0xF4, 0xC6, 0xC8, 0x8F, 0x4E, 0x8E,
+    0xDB, 0x7A, 0x9E, 0x04, 0x2E, 0xA4, 0x1D, 0xA3, 0x94, 0xAC, 0xDB, 0x08, 0x5C, 0x97, 0x5B, 0x08,
+    0xAD, 0x6D, 0xA3, 0x43, 0x68, 0xE6, 0xDD, 0x34, 0x51, 0xAC, 0x13, 0xC9, 0x30, 0xA3, 0x65, 0xCC,
+    0xD3, 0x36, 0x39, 0x17, 0x54, 0x71, 0x1B, 0x13, 0x8D, 0x51, 0x38, 0x6A, 0x43, 0xC9, 0xA7, 0x61,
+    0x17, 0x57, 0xB4, 0x69, 0x0F, 0x2A, 0x18, 0x77, 0xA0, 0x8D, 0x4C, 0x8C, 0xFC, 0x55, 0x48, 0xAB,
+    0x24, 0x7C, 0x3B, 0xF2, 0xF9, 0x25, 0x91, 0x1A, 0xBC, 0xC2, 0x7B, 0x4D, 0xCA, 0xEB, 0x5F, 0x01,
+    0x4A, 0xC1, 0x00, 0x7A, 0x85, 0xFF, 0x95, 0xF1, 0x35, 0x49, 0x92, 0x24, 0x33, 0xDE, 0x14, 0x32,
+    0x3A, 0x44, 0x25, 0x58, 0x57, 0x64, 0x78, 0x64, 0xAA, 0xC4, 0xC8, 0xF8, 0xDA, 0xC8, 0x90, 0x3E,
+    0x26, 0xCD, 0x7E, 0x9E, 0xC9, 0xEE, 0x41, 0x49, 0x48, 0xEF, 0x7F, 0x1E, 0xA3, 0xD9, 0xF6, 0x0D,
+    0xBC, 0x80, 0x21, 0xBA, 0xBB, 0x2D, 0xE6, 0x65, 0xF3, 0x51, 0x55, 0x7C, 0x6A, 0x9B, 0xD3, 0x55,
+    0x77, 0x82, 0x42, 0x11, 0x87, 0xDC, 0xCC, 0xE5, 0xAD, 0x82, 0xC2, 0xA9, 0x9B, 0x80, 0x22, 0xBD,
+    0x0B, 0x45, 0xDE, 0xC0, 0x30, 0x42, 0x0D, 0xED, 0xF7, 0x3C, 0x4F, 0xA0, 0x77, 0x47, 0x05, 0x50,
+    0xF7, 0x30, 0x84, 0x90, 0x9D, 0x17, 0x61, 0x97, 0xDC, 0xA2, 0x2B, 0x59, 0xD9, 0x08, 0x66, 0x25,
+    0x8D, 0x58, 0xCA, 0xD8, 0xF5, 0x36, 0xEC, 0xFA, 0xA8, 0xA7, 0x7C, 0xA6, 0xD1, 0x4E, 0x0C, 0x47,
+    0x6C, 0x66, 0x69, 0x06, 0x2A, 0x69, 0xBA, 0x9C, 0x6E, 0x0D, 0xB7, 0x63, 0x5F, 0xE9, 0x8C, 0xE1,
+    0x7E, 0xAC, 0xF5, 0x36, 0xD9, 0x31, 0x0A, 0x65, 0x94, 0xA2, 0x52, 0x77, 0x38, 0x3B, 0x1E, 0xE8,
+    0xEC, 0xF8, 0x25, 0xD4, 0x5A, 0xD8, 0x90, 0xD8, 0x1B, 0xF7, 0x0C, 0x7B, 0x0D, 0x4B, 0x90, 0x7B,
+    0xAB, 0xF1, 0xB1, 0x33, 0xD1, 0x62, 0x36, 0x54, 0xAC, 0xCA, 0x1C, 0xBB, 0xF2, 0xA3, 0x3D, 0xF4,
+    0xDE, 0x0E, 0xEA, 0x80, 0xC7, 0xE6, 0xAA, 0x42, 0xFB, 0x90, 0xF6, 0x94, 0xD3, 0x92, 0xF2, 0x67,
+    0xA9, 0xE3, 0xE5, 0x99, 0x17, 0x78, 0x1D, 0x2D, 0x5A, 0x45, 0xEE, 0xD4, 0xA2, 0x09, 0x32, 0x6D,
+    0x9C, 0xB1, 0x0E, 0x12, 0xB8, 0x99, 0x13, 0x86, 0xF2, 0x7B, 0x42, 0xF7, 0xCF, 0xEB, 0x37, 0xC2,
+    0xFA, 0x57, 0x39, 0x6B, 0xF9, 0x25, 0x50, 0x40, 0x36, 0x6A, 0xA6, 0x58, 0xD0, 0xF2, 0xE9, 0x47,
+    0xA1, 0x65, 0x58, 0xAE, 0xD8, 0xC5, 0x2B, 0x56, 0x9E, 0xDB, 0xB7, 0x13, 0xFB, 0x2F, 0xD1, 0x23,
+    0x5F, 0x16, 0x17, 0x85, 0x71, 0xC6, 0x2C, 0x88, 0xC4, 0x4B, 0xAB, 0x07, 0x10, 0xF8, 0x9E, 0x76,
+    0xF4, 0x62, 0x1E, 0xD8, 0xF8, 0x09, 0x29, 0x7A, 0x68, 0x81, 0xD9, 0xD3, 0x79, 0x68, 0x81, 0xFA,
+    0x70, 0x1E, 0x41, 0xAA, 0xBB, 0x54, 0xE4, 0x40, 0x8C, 0xA7, 0xEF, 0x5F, 0x60, 0x9B, 0xE9, 0x7B,
+    0xD8, 0xB1, 0x8A, 0x56, 0x2C, 0x58, 0xC5, 0x9A, 0xFA, 0x28, 0xB1, 0x26, 0xE4, 0xE4, 0xA8, 0x20,
+    0xFD, 0xFC, 0x0E, 0xEA, 0xE1, 0xB6, 0x34, 0x74, 0x5A, 0xE4, 0xD2, 0x0E, 0x50, 0x15, 0x53, 0xE3,
+    0x34, 0x96, 0x49, 0x33, 0xD1, 0x93, 0xEF, 0xE7, 0x81, 0x80, 0x94, 0xE8, 0xB8, 0xCA, 0x5D, 0xE0,
+    0xDF, 0xD9, 0x17, 0xC2, 0xC5, 0x8F, 0x48, 0xC1, 0xCB, 0x07, 0x11, 0x5C, 0x93, 0xE7, 0x27, 0xC2,
+    0x9C, 0xBC, 0x14, 0x2F, 0x8B, 0x4E, 0x6E, 0xB3, 0x45, 0x9D, 0x61, 0x7E, 0xCF, 0xD3, 0x2E, 0x5B,
+    0xA5, 0x2B, 0x09, 0x62, 0x85, 0x29, 0xCE, 0xD3, 0x9E, 0x27, 0xC9, 0x67, 0x08, 0xC7, 0x72, 0x99,
+    0xC2, 0x6F, 0xF0, 0xCB, 0x0E, 0xF9, 0xFF, 0x94, 0x64, 0x54, 0x32, 0xBF, 0x4C, 0x88, 0xBE, 0xCA,
+    0x24, 0x93, 0x3F, 0x55, 0x48, 0xCD, 0x75, 0x50, 0x9B, 0x86, 0x2A, 0x8A, 0x57, 0x78, 0x03, 0x21,
+    0x06, 0x44, 0xAD, 0xD7, 0xA6, 0xB6, 0x4C, 0x6C, 0xE2, 0xE0, 0xA1, 0xD3, 0xA9, 0x27, 0x51, 0xE5,
+    0x99, 0x87, 0x4E, 0x8A, 0x75, 0xF6, 0xDE, 0x5C, 0xA0, 0x12, 0xD3, 0x8D, 0x3A, 0x32, 0x1C, 0x1A,
+    0x82, 0x53, 0x88, 0x70, 0x12, 0x7E, 0x4C, 0x38, 0x34, 0x24, 0x66, 0x59, 0x47, 0x4A, 0xCF, 0x8F,
+    0xDA, 0xEE, 0x5A, 0x9B, 0xBF, 0xAB, 0xB5, 0x27, 0xDB, 0x86, 0x3A, 0x85, 0xD7, 0xDD, 0xBB, 0x16,
+    0x5E, 0x01, 0x21, 0x01, 0x43, 0x02, 0x88, 0x04, 0x14, 0x09, 0x30, 0x92, 0x2B, 0x9D, 0xA0, 0x14,
+    0x8C, 0x31, 0x41, 0x6C, 0xD2, 0xB4, 0x71, 0x86, 0x31, 0xAE, 0xB6, 0x03, 0x00, 0x25, 0x83, 0x28,
+    0x83, 0xE6, 0x46, 0xD3, 0xC6, 0x60, 0xA0, 0xCF, 0x2B, 0xA4, 0x1D, 0xCA, 0xF1, 0xC3, 0xAB, 0x6E,
+    0x46, 0x4B, 0x6E, 0x15, 0x56, 0x0C, 0x7A, 0x95, 0x41, 0x89, 0x8F, 0x22, 0x16, 0x4F, 0x4D, 0xB0,
+    0xD1, 0xAD, 0x0A, 0x7B, 0x9D, 0xB5, 0x90, 0xEC, 0x1E, 0xB1, 0xDC, 0xCE, 0x94, 0x6C, 0x03, 0x70,
+    0x2F, 0x37, 0x99, 0x36, 0xE9, 0xCC, 0x18, 0xEB, 0x86, 0x9D, 0x7D, 0x00, 0xD9, 0xD4, 0xC4, 0x2C,
+    0xDD, 0x43, 0x2C, 0x47, 0x76, 0x8F, 0xE5, 0x18, 0x2E, 0xEA, 0xE5, 0x58, 0x7C, 0x40, 0xFB, 0x36,
+    0x2F, 0x9A, 0x8F, 0x5A, 0xDA, 0x1F, 0x69, 0x58, 0xCC, 0x69, 0x8E, 0x93, 0x43, 0x9D, 0x81, 0x65,
+    0x9F, 0x68, 0xDF, 0x77, 0xAB, 0x21, 0xF8, 0xEC, 0xC7, 0x03, 0xB0, 0x1D, 0xA9, 0x3D, 0xCD, 0x32,
+    0xD9, 0x52, 0xB3, 0x57, 0xA6, 0xEF, 0x1A, 0x24, 0x49, 0xA1, 0x85, 0x9E, 0xB7, 0x3D, 0x3A, 0x1A,
+    0xC8, 0xF9, 0x91, 0x0D, 0x46, 0x32, 0x66, 0x9C, 0x87, 0xA4, 0xA4, 0x80, 0x57, 0x01, 0xF3, 0x3D,
+    0x14, 0xF0, 0xFA, 0xA8, 0xFB, 0xF4, 0x51, 0xC0, 0xDB, 0x03, 0xE7, 0xDC, 0xC3, 0x1C, 0x63, 0xB4,
+    0xAF, 0xAB, 0x01, 0x5A, 0x36, 0x7D, 0xF4, 0x8E, 0xFA, 0x58, 0xB7, 0x01, 0x0E, 0x89, 0x48, 0xEB,
+    0x32, 0x88, 0x74, 0x07, 0x71, 0x4C, 0xF6, 0x3E, 0x32, 0x9A, 0x11, 0x12, 0x1A, 0xA9, 0xC1, 0xE9,
+    0x23, 0x4A, 0x9D, 0x46, 0xDD, 0x3E, 0xDF, 0xF1, 0x5A, 0x62, 0x15, 0x4E, 0xC6, 0x1A, 0xE6, 0x5E,
+    0x6C, 0x15, 0xBC, 0x40, 0x45, 0xC8, 0x18, 0x72, 0x66, 0x55, 0x20, 0xA3, 0xD2, 0x4F, 0x27, 0x1B,
+    0xF2, 0x1D, 0x37, 0x39, 0x36, 0x22, 0x95, 0xF3, 0x7F, 0x5C, 0x1D, 0x6E, 0xD4, 0x2D, 0x7F, 0x4C,
+    0xA3, 0x6E, 0xBE, 0xFA, 0x3D, 0x45, 0x17, 0x69, 0x91, 0x97, 0x5A, 0x2A, 0x0D, 0xF5, 0xB4, 0x30,
+    0x79, 0x24, 0x7A, 0xD2, 0x4B, 0xB2, 0x85, 0xAB, 0x50, 0x02, 0x32, 0xD6, 0xD7, 0xFD, 0x3E, 0x8C,
+    0xEB, 0x0C, 0x8C, 0x97, 0x4E, 0x74, 0x4A, 0x88, 0xD0, 0x59, 0x2B, 0xAD, 0xB5, 0x16, 0xB5, 0x4D,
+    0xDB, 0x58, 0x14, 0x97, 0x53, 0x0B, 0x7D, 0x29, 0xE9, 0xF5, 0xA5, 0x38, 0xBB, 0x27, 0x09, 0xC5,
+    0x9E, 0x58, 0xD0, 0x58, 0x4E, 0x27, 0x54, 0x24, 0xFA, 0x93, 0x00, 0x40, 0x82, 0x00, 0x09, 0x04,
+    0xA6, 0x3D, 0x2D, 0x20, 0x68, 0x14, 0x0C, 0x0C, 0x1A, 0x87, 0xA6, 0xD8, 0x0A, 0x61, 0x15, 0x64,
+    0xB5, 0xB3, 0x5D, 0x23, 0xE9, 0x19, 0xB0, 0xC4, 0xA9, 0x9C, 0x00, 0x05, 0xA8, 0x10, 0x60, 0x81,
+    0xE3, 0xE1, 0xFD, 0xC4, 0xC0, 0x10, 0x90, 0x21, 0x40, 0x83, 0xEC, 0xBA, 0xD0, 0x69, 0xB5, 0x19,
+    0xF8, 0x3A, 0xE0, 0x43, 0x00, 0x48, 0xD7, 0x6C, 0x01, 0xD1, 0x6C, 0x03, 0xA8, 0x49, 0x42, 0xD1,
+    0xEA, 0x62, 0x0C, 0x0E, 0xB6, 0x2B, 0x0D, 0x42, 0x0F, 0x37, 0xC9, 0xA8, 0x67, 0x21, 0x4B, 0xA6,
+    0xF3, 0xE2, 0xEB, 0xE8, 0x84, 0x97, 0xEA, 0x3A, 0x83, 0xAE, 0x18, 0x32, 0x14, 0x52, 0x23, 0x64,
+    0x3A, 0x72, 0xE3, 0x4D, 0x29, 0x15, 0xD6, 0x82, 0x43, 0xA8, 0x8F, 0x6C, 0x98, 0x0A, 0x44, 0x5F,
+    0xBF, 0x0C, 0xF5, 0x9B, 0x95, 0x26, 0x95, 0x60, 0x38, 0x8C, 0x09, 0xB3, 0xAF, 0xC4, 0xD3, 0x2C,
+    0x87, 0x51, 0xD9, 0x5F, 0x1F, 0xA1, 0x74, 0x28, 0x4C, 0xC7, 0x04, 0x0E, 0xD6, 0x9A, 0x77, 0xFA,
+    0x68, 0xF4, 0xCE, 0x41, 0xC5, 0x7A, 0xDF, 0x4A, 0xF6, 0x58, 0xF1, 0x9A, 0xFA, 0xAC, 0xF9, 0x84,
+    0x86, 0xAC, 0x7A, 0x85, 0x05, 0xB6, 0x2A, 0x1B, 0x86, 0x51, 0x6E, 0xA4, 0x2C, 0x33, 0xEB, 0xC1,
+    0xE3, 0x87, 0x98, 0xD0, 0x91, 0xB5, 0xF4, 0xA4, 0xE4, 0xE0, 0x17, 0x74, 0x82, 0x21, 0xA8, 0x68,
+    0xCB, 0xFF, 0x7E, 0x35, 0xFA, 0x45, 0xC2, 0x20, 0xF8, 0xB5, 0xA0, 0x30, 0xED, 0x3B, 0xC9, 0xA9,
+    0x2D, 0xAF, 0x3D, 0xB5, 0x75, 0xBD, 0xDB, 0x37, 0x08, 0xEB, 0x7D, 0x39, 0xA6, 0x20, 0x24, 0xBA,
+    0xD0, 0x35, 0x04, 0xC6, 0x57, 0x2A, 0x17, 0x15, 0xD0, 0xC0, 0x20, 0x25, 0x0C, 0x29, 0x93, 0x80,
+    0x93, 0x6E, 0x4F, 0x74, 0xF1, 0x9B, 0x42, 0x58, 0x51, 0x1F, 0x8E, 0x6E, 0x53, 0x49, 0xB5, 0x54,
+    0xF8, 0xE3, 0x50, 0x5B, 0x0D, 0x4E, 0x25, 0x44, 0xCE, 0x98, 0xFC, 0x74, 0x50, 0x67, 0x88, 0x9A,
+    0x27, 0x0D, 0xED, 0xAE, 0x74, 0x39, 0x1E, 0x56, 0x60, 0x98, 0xD8, 0xCB, 0x57, 0xFA, 0xB4, 0xF1,
+    0xD7, 0x3A, 0xB6, 0xFF, 0xC0, 0xB3, 0xFC, 0xD1, 0x8D, 0x70, 0xB5, 0x9B, 0x77, 0xCA, 0x40, 0x26,
+    0xBF, 0x0E, 0x3A, 0x69, 0x7A, 0xD7, 0xC1, 0xCD, 0x51, 0x89, 0x4F, 0xCC, 0x5B, 0x17, 0xDE, 0x74,
+    0xB2, 0x85, 0x49, 0x50, 0xD2, 0xCA, 0xA5, 0x8A, 0x56, 0x92, 0xEB, 0xD2, 0x79, 0x1D, 0x75, 0x6A,
+    0x55, 0x87, 0xEB, 0x09, 0xD9, 0x6C, 0x3D, 0xA1, 0x79, 0xF8, 0xA6, 0xB3, 0xC1, 0xB9, 0x0E, 0x5D,
+    0x6A, 0xD7, 0x4B, 0x61, 0x0E, 0x2B, 0xC1, 0x1F, 0x6E, 0x43, 0x9A, 0x51, 0xDA, 0x1C, 0x57, 0x3A,
+    0x39, 0xEF, 0xF5, 0x3C, 0x86, 0x56, 0x31, 0x03, 0xE0, 0xBC, 0xAE, 0x9D, 0x9C, 0x35, 0xED, 0xD9,
+    0x3F, 0xF4, 0x7A, 0x1A, 0x75, 0x06, 0x0D, 0xCE, 0xD2, 0xBE, 0x11, 0x72, 0xD1, 0x72, 0xF7, 0x05,
+    0xB4, 0x83, 0x82, 0x9F, 0x4E, 0xE4, 0x50, 0x0E, 0xAE, 0x0A, 0x00, 0xEB, 0x19, 0xCD, 0xF8, 0xA5,
+    0x4E, 0xA4, 0x53, 0x00, 0x71, 0x46, 0x42, 0x7F, 0xA4, 0xC2, 0xA1, 0xE4, 0x48, 0x95, 0x04, 0x59,
+    0xD7, 0x74, 0xD2, 0x9E, 0x87, 0x7B, 0x79, 0x1B, 0x0B, 0x22, 0x6E, 0xB1, 0x0F, 0x31, 0x83, 0x74,
+    0x23, 0x62, 0x7F, 0x52, 0xB6, 0x84, 0xA9, 0x7B, 0xDA, 0x70, 0x75, 0xF6, 0xB4, 0x21, 0x13, 0x0D,
+    0x1A, 0x8F, 0x48, 0xA2, 0x72, 0xE2, 0xF2, 0x73, 0x41, 0xAE, 0xB4, 0xC7, 0xE6, 0x98, 0x68, 0x50,
+    0x18, 0x70, 0x86, 0xF4, 0x05, 0xFE, 0x6C, 0x8F, 0x37, 0x61, 0x8F, 0x89, 0x67, 0xF8, 0x42, 0x41,
+    0x2E, 0x3C, 0x96, 0x04, 0x07, 0x71, 0x97, 0x9E, 0xB0, 0xB4, 0xDC, 0x74, 0xCB, 0xAD, 0x74, 0x99,
+    0x9A, 0xFE, 0xCA, 0xFC, 0x15, 0x7E, 0x49, 0x77, 0x37, 0x70, 0x96, 0xD6, 0xFB, 0xAA, 0x6E, 0x12,
+    0x37, 0xB5, 0xBD, 0x23, 0x51, 0x78, 0xAE, 0x2A, 0x9D, 0x6B, 0x53, 0x7E, 0xC9, 0x59, 0x9D, 0x66,
+    0x58, 0x00, 0x53, 0x70, 0xF6, 0x8F, 0x42, 0xA9, 0xEB, 0xD4, 0xC6, 0x00, 0x5D, 0x59, 0x27, 0xFA,
+    0x2C, 0x2A, 0xC6, 0xEF, 0xEB, 0x8C, 0x93, 0x75, 0x5E, 0x54, 0xA8, 0x6C, 0xF3, 0x6E, 0xD1, 0x9C,
+    0x40, 0x6E, 0xD6, 0x12, 0x94, 0xF9, 0xAE, 0xEE, 0x3D, 0xF6, 0xEE, 0x51, 0xAC, 0x2E, 0x5A, 0x6D,
+    0x59, 0xB8, 0x3D, 0xB9, 0x96, 0xF5, 0x54, 0x69, 0xA5, 0x97, 0xAD, 0x42, 0xA5, 0x3B, 0x76, 0x6E,
+    0xA1, 0x46, 0x43, 0xD1, 0x3D, 0xEA, 0x1E, 0x50, 0x46, 0xB2, 0xAD, 0xBB, 0x15, 0x6A, 0x86, 0x0D,
+    0x08, 0xA0, 0xF5, 0xDA, 0x61, 0x09, 0x9D, 0xD6, 0xE8, 0x6C, 0xB6, 0x75, 0x63, 0xC4, 0xB8, 0xB3,
+    0xB2, 0x14, 0x4D, 0xE7, 0x81, 0x89, 0xFC, 0x22, 0xFE, 0xA8, 0xEA, 0xAB, 0x1E, 0x83, 0x70, 0x67,
+    0x9D, 0xE9, 0xCE, 0x8A, 0xC2, 0x41, 0x62, 0xD7, 0x11, 0xD3, 0x74, 0x7D, 0x20, 0x1B, 0x79, 0xE2,
+    0x2E, 0x7D, 0xA7, 0xD0, 0x07, 0x6C, 0x24, 0xB7, 0xDA, 0x81, 0x3B, 0xEA, 0x61, 0xD6, 0x40, 0x4E,
+    0x75, 0x34, 0xFD, 0x51, 0xE1, 0xF0, 0x73, 0xD3, 0xDF, 0x28, 0xDD, 0x43, 0x32, 0xB2, 0x93, 0x52,
+    0x86, 0xCA, 0x94, 0x7F, 0x10, 0xD7, 0x75, 0x7C, 0x3F, 0x95, 0xA9, 0xD1, 0x5B, 0x14, 0x16, 0x88,
+    0x28, 0xFF, 0xBF, 0xC0, 0x61, 0x8D, 0xAF, 0x18, 0x6C, 0xBC, 0xB7, 0xF6, 0xFF, 0x0B, 0xBC, 0x2C,
+    0x41, 0x8D, 0xE9, 0xD7, 0x64, 0x2B, 0xAC, 0xB3, 0x2E, 0xFC, 0xCC, 0x1C, 0x37, 0x6E, 0xDC, 0xA5,
+    0x25, 0x16, 0xDC, 0x24, 0x6F, 0xAC, 0xFD, 0xAD, 0x76, 0x4E, 0xA3, 0x74, 0x87, 0xD7, 0xFD, 0xE6,
+    0x01, 0x4B, 0x63, 0xC7, 0xBA, 0x4F, 0xD2, 0x06, 0x86, 0xA0, 0x4E, 0x39, 0xFD, 0x3B, 0x3D, 0x89,
+    0x78, 0x56, 0x70, 0x5D, 0xDD, 0x27, 0x96, 0x75, 0x26, 0xDD, 0x2C, 0x4E, 0xA1, 0x8B, 0x25, 0x3D,
+    0x62, 0x5B, 0x56, 0xDB, 0x96, 0x33, 0xA8, 0x9C, 0xF5, 0xF1, 0xD4, 0xBC, 0xAC, 0xCC, 0xFD, 0x5C,
+    0xD1, 0xC8, 0x93, 0xD9, 0x17, 0x65, 0x3C, 0x23, 0x00, 0x2E, 0x37, 0x70, 0x87, 0xB2, 0xE3, 0x83,
+    0x08, 0x0C, 0xC0, 0x13, 0x8A, 0x6D, 0xD5, 0xE3, 0xE9, 0x79, 0xD8, 0x69, 0xFF, 0xF6, 0x6D, 0xDA,
+    0x99, 0xF6, 0x6F, 0xCF, 0x6E, 0xD1, 0x55, 0xF6, 0xEF, 0x48, 0x3B, 0x4A, 0x24, 0xB7, 0x48, 0x6D,
+    0x91, 0xD8, 0xE2, 0x39, 0xCD, 0xEB, 0x3C, 0xCE, 0xEB, 0x7C, 0xCE, 0xEB, 0x42, 0x7E, 0xBE, 0x11,
+    0x87, 0xD6, 0x8F, 0xE2, 0xE0, 0x96, 0x77, 0xD3, 0x2B, 0x9B, 0xBA, 0x85, 0x7C, 0xEB, 0x44, 0xE9,
+    0xB2, 0x99, 0xFC, 0xFE, 0xE4, 0xE8, 0x8D, 0xCC, 0xCE, 0xE7, 0x85, 0xC6, 0xEB, 0x91, 0xE9, 0x7B,
+    0xC5, 0x22, 0xD9, 0x70, 0x62, 0x58, 0x62, 0x54, 0x41, 0x41, 0xD3, 0x14, 0xE3, 0x49, 0xD1, 0xFD,
+    0x29, 0xFA, 0x1C, 0x7F, 0x8E, 0xF3, 0x09, 0xC9, 0xFA, 0xA2, 0x69, 0xCD, 0xEE, 0x28, 0x30, 0x58,
+    0xD8, 0x12, 0x3D, 0x85, 0x1D, 0x9D, 0x97, 0x6F, 0xE1, 0x3C, 0xEF, 0x4D, 0x7F, 0xF7, 0x25, 0x96,
+    0x58, 0x57, 0x9E, 0x28, 0x3C, 0xE8, 0x4D, 0xDE, 0x9D, 0x38, 0xAF, 0xCA, 0xD3, 0x78, 0x2A, 0x91,
+    0x57, 0xC1, 0xE5, 0xDB, 0x47, 0x88, 0x8B, 0x5A, 0xC3, 0x49, 0x3F, 0xEF, 0x77, 0xF8, 0x6F, 0xF0,
+    0x65, 0xB8, 0xA8, 0x9E, 0x94, 0x53, 0x72, 0xC9, 0x74, 0xA2, 0x13, 0x4F, 0x16, 0x22, 0x27, 0x11,
+    0x21, 0xC6, 0x01, 0x0E, 0x3B, 0x6E, 0x82, 0x81, 0xB0, 0x19, 0x7B, 0x28, 0x02, 0x1D, 0x53, 0x6D,
+    0x55, 0x8E, 0xD0, 0xCC, 0xD5, 0xA1, 0xBB, 0xD4, 0x05, 0x30, 0xA9, 0x7F, 0x49, 0xF9, 0xCB, 0x3D,
+    0xDC, 0xCC, 0xC5, 0xC9, 0x79, 0x7D, 0x48, 0x3C, 0xC4, 0xF0, 0x06, 0x67, 0xC3, 0x8C, 0x10, 0x01,
+    0x22, 0x32, 0x18, 0x31, 0x48, 0x8F, 0x59, 0x77, 0xFD, 0x95, 0xA5, 0x73, 0xD3, 0xD3, 0x74, 0xBA,
+    0xAD, 0xA8, 0x3B, 0x8C, 0x38, 0x21, 0x30, 0xAD, 0x7A, 0x3D, 0xAC, 0x45, 0x20, 0xA7, 0x5C, 0x99,
+    0x9E, 0x3E, 0x92, 0xD7, 0x3A, 0x6B, 0x6A, 0x91, 0xE6, 0x0B, 0x7A, 0x9A, 0x78, 0xB5, 0x05, 0x5D,
+    0xF2, 0x7D, 0x53, 0x6E, 0x76, 0x22, 0x3A, 0x74, 0xA2, 0x0E, 0x51, 0x2B, 0xB6, 0x62, 0x55, 0x97,
+    0xFE, 0x3E, 0x62, 0xD4, 0x46, 0xCA, 0xA9, 0xB7, 0xC7, 0xF0, 0x4B, 0x3B, 0x37, 0x63, 0x08, 0x70,
+    0xA8, 0x3F, 0xD3, 0x67, 0x68, 0xBF, 0x97, 0xD1, 0x65, 0xBC, 0x7E, 0x90, 0x0B, 0xB6, 0xEA, 0xF7,
+    0xB9, 0xC2, 0x01, 0x2D, 0xEB, 0x5D, 0x34, 0xA7, 0xAC, 0xDC, 0x7E, 0x11, 0x75, 0x45, 0xAB, 0x70,
+    0x6D, 0x9C, 0xF6, 0xB2, 0x8A, 0x45, 0x2B, 0x3F, 0x83, 0x54, 0x70, 0xD9, 0x2A, 0x7A, 0x20, 0x31,
+    0xE7, 0xAD, 0xE2, 0x32, 0x5E, 0x77, 0x70, 0xB4, 0x8A, 0x45, 0xCF, 0xD4, 0x87, 0x90, 0xFA, 0x20,
+    0x51, 0xFF, 0x05, 0x37, 0x60, 0xA2, 0xF7, 0x51, 0xA4, 0x7B, 0xEE, 0xE2, 0xF8, 0x27, 0xD3, 0x53,
+    0x89, 0x55, 0xA7, 0xB1, 0xA9, 0xFF, 0x28, 0x0D, 0x6D, 0xDD, 0x95, 0xD7, 0x6D, 0xF9, 0x4E, 0x5F,
+    0xFE, 0xE5, 0x98, 0xD6, 0x54, 0x36, 0x4A, 0x70, 0xE2, 0x5F, 0x92, 0xC0, 0xC2, 0x4D, 0x98, 0x3B,
+    0xEE, 0xB8, 0xC9, 0x62, 0x41, 0x8C, 0xF5, 0xB9, 0x82, 0x32, 0x37, 0x79, 0xBE, 0x50, 0x89, 0x9B,
+    0xEC, 0x14, 0x76, 0xEC, 0x26, 0x69, 0xE1, 0x90, 0xFB, 0x4E, 0x52, 0x2C, 0x92, 0xFB, 0x6E, 0x54,
+    0x2E, 0x93, 0xFB, 0x1B, 0x2A, 0x2F, 0x91, 0xFB, 0x5B, 0x96, 0x11, 0x87, 0x43, 0x3E, 0x4A, 0xD0,
+    0x5E, 0xAD, 0xA5, 0xCC, 0xD0, 0x69, 0x3B, 0x8B, 0xC9, 0xCB, 0x17, 0x54, 0xC0, 0x1A, 0xAD, 0xBF,
+    0x82, 0xFC, 0x46, 0x3B, 0x86, 0x0B, 0xEB, 0xDA, 0xCC, 0x0B, 0x75, 0xB9, 0xF1, 0x21, 0x6D, 0xBC,
+    0x0F, 0x44, 0x23, 0xB6, 0xC0, 0x25, 0x7D, 0x14, 0x99, 0xF9, 0x2B, 0xBE, 0xD4, 0x80, 0x22, 0x69,
+    0x85, 0x15, 0x1D, 0xC2, 0xD3, 0xF5, 0xD1, 0x05, 0x09, 0xAF, 0x37, 0x85, 0x65, 0x39, 0x4F, 0x78,
+    0x4F, 0xE6, 0xB1, 0x50, 0x77, 0x48, 0x87, 0xA4, 0x93, 0xA3, 0xE6, 0x54, 0x05, 0xBE, 0x3E, 0x45,
+    0x4B, 0xAA, 0x9B, 0x8A, 0x9C, 0xBD, 0xC2, 0x9C, 0x39, 0xC0, 0xF7, 0x34, 0xA4, 0xC2, 0xC4, 0x22,
+    0xAC, 0x80, 0x58, 0xAE, 0x00, 0xDD, 0x1E, 0x6E, 0xF8, 0x0A, 0x6E, 0xBD, 0x83, 0x49, 0x90, 0x28,
+    0x43, 0x36, 0xFF, 0x45, 0x1C, 0x9E, 0x79, 0x1D, 0xEE, 0xE7, 0x4F, 0x40, 0xBB, 0x6A, 0xBA, 0x03,
+    0xF2, 0xBD, 0x3F, 0xA9, 0xED, 0x7A, 0x6D, 0x37, 0xA3, 0x34, 0x65, 0x98, 0xEF, 0x62, 0xFE, 0x81,
+    0x84, 0x2F, 0x2B, 0xFE, 0x16, 0x08, 0x55, 0x85, 0xBC, 0x1F, 0x25, 0xDA, 0xE8, 0xE2, 0x4C, 0xE1,
+    0x6A, 0x7E, 0xE0, 0x1C, 0x6F, 0xAF, 0xDC, 0x6C, 0xFA, 0xFD, 0x22, 0xBD, 0xA2, 0xEE, 0x79, 0xF1,
+    0xC1, 0xF6, 0x2F, 0x2A, 0xC6, 0xC8, 0xC1, 0xFC, 0xCC, 0x76, 0x33, 0x94, 0x1D, 0x22, 0x8D, 0xA9,
+    0x68, 0x9E, 0x37, 0x2C, 0x58, 0xCA, 0x11, 0x1F, 0xF7, 0xFE, 0x44, 0xBF, 0x6F, 0x25, 0xF8, 0xCE,
+    0x09, 0xAA, 0x0F, 0x6E, 0x1C, 0xBE, 0xB7, 0xBE, 0xD1, 0xB4, 0x01, 0x91, 0x66, 0x9B, 0x33, 0x8D,
+    0xF2, 0xA5, 0xBE, 0x57, 0xA6, 0xFB, 0xF1, 0xE5, 0xED, 0x9F, 0x11, 0xBE, 0x3A, 0x99, 0x3B, 0xB9,
+    0x42, 0x6D, 0x0D, 0xE7, 0xC3, 0x9B, 0x03, 0x7A, 0xCD, 0x47, 0xCC, 0x91, 0x3E, 0x5E, 0xB3, 0x8B,
+    0xFC, 0x56, 0xEA, 0xA5, 0x56, 0x12, 0xDC, 0xB8, 0x96, 0x84, 0x75, 0xDD, 0x54, 0x56, 0x64, 0x6D,
+    0x9C, 0x96, 0xCF, 0xAA, 0x43, 0x9B, 0x7D, 0x5E, 0x7A, 0x36, 0x76, 0x31, 0x32, 0x8B, 0xD2, 0x29,
+    0x5A, 0x3E, 0xB4, 0x9E, 0xC7, 0xC0, 0x85, 0x5D, 0xF9, 0x1A, 0xD9, 0xAF, 0xD3, 0xE6, 0x1C, 0xD1,
+    0xA4, 0xE3, 0x00, 0xE7, 0xA8, 0xA7, 0xB8, 0x9D, 0xF3, 0xB0, 0xD3, 0xE7, 0x82, 0xE6, 0xD4, 0xAB,
+    0x24, 0xAA, 0x2D, 0xF0, 0x50, 0x57, 0xF4, 0x85, 0xC2, 0x04, 0x8D, 0x49, 0xAB, 0x2C, 0x76, 0x2A,
+    0xB9, 0x9D, 0xA4, 0x1F, 0xFA, 0x5C, 0x4F, 0xD4, 0x18, 0x31, 0x6B, 0x8E, 0xF7, 0x53, 0x82, 0xEE,
+    0x04, 0xE5, 0xA9, 0x59, 0x65, 0x31, 0xE7, 0x91, 0x34, 0x3D, 0x76, 0x51, 0x57, 0x7B, 0x15, 0x1F,
+    0xFE, 0x5C, 0x37, 0xBB, 0xD2, 0x5B, 0x63, 0xF6, 0xB4, 0xD1, 0x66, 0x1B, 0x9E, 0x66, 0x8F, 0xBF,
+    0x1C, 0x3E, 0x6D, 0x94, 0xB5, 0x46, 0x74, 0xE8, 0x2C, 0x53, 0x7B, 0xF7, 0xB0, 0xB9, 0x1D, 0xCE,
+    0x01, 0xE9, 0x83, 0x40, 0xFF, 0x03, 0xE5, 0x5B, 0x3D, 0x8C, 0x1C, 0x57, 0x72, 0xAE, 0xEE, 0xE6,
+    0x6E, 0x1B, 0x6C, 0x78, 0x7B, 0x03, 0xF2, 0x74, 0x38, 0x8A, 0xDB, 0x89, 0x03, 0x83, 0x58, 0xBA,
+    0x13, 0x05, 0x7B, 0xC0, 0x70, 0xBB, 0x45, 0x01, 0x56, 0xA0, 0xE0, 0x18, 0x90, 0x72, 0x40, 0x1C,
+    0xE4, 0xF4, 0xCE, 0xC1, 0x5E, 0xC0, 0x80, 0xC1, 0xEE, 0xCC, 0x9C, 0x14, 0x3A, 0x38, 0xDA, 0x30,
+    0xEC, 0x90, 0x0C, 0x14, 0xF0, 0x56, 0x07, 0x93, 0x01, 0x03, 0x06, 0xBB, 0x3B, 0x2D, 0x29, 0x54,
+    0x32, 0xB6, 0x71, 0x76, 0x62, 0xC0, 0x8D, 0x83, 0xE4, 0x83, 0x29, 0xDB, 0x1A, 0xD9, 0x23, 0xDC,
+    0x2C, 0xD1, 0x33, 0xED, 0xEF, 0xAB, 0x7A, 0xDD, 0x33, 0x43, 0xF1, 0xE4, 0xE0, 0x96, 0xD4, 0x1A,
+    0x5E, 0xED, 0xBC, 0x6E, 0xCE, 0xF6, 0x4F, 0xD5, 0xF7, 0xEA, 0x55, 0x7D, 0x55, 0xF5, 0x24, 0x82,
+    0x9F, 0x73, 0x1C, 0xE4, 0x50, 0xA4, 0x37, 0x95, 0x23, 0x09, 0x8F, 0x77, 0x8A, 0x2B, 0x92, 0xF6,
+    0x83, 0x51, 0x07, 0xDF, 0x79, 0xD3, 0xD2, 0x9F, 0x88, 0xCC, 0x24, 0x18, 0xF1, 0x92, 0x78, 0x28,
+    0xD2, 0x95, 0xA4, 0xE0, 0x98, 0xF6, 0x05, 0x97, 0x67, 0xB9, 0x8E, 0x78, 0xC0, 0x54, 0x7A, 0x18,
+    0x2B, 0x8E, 0x5E, 0x85, 0xBF, 0x0B, 0x6E, 0xC4, 0x88, 0x1B, 0xF1, 0x4D, 0x54, 0xF2, 0x1A, 0xDC,
+    0x98, 0xE6, 0x3C, 0x89, 0x0B, 0x5C, 0x2E, 0xC1, 0xF1, 0x4D, 0x3C, 0x55, 0x06, 0x35, 0x9E, 0x21,
+    0x5E, 0x2E, 0xF6, 0xC3, 0xA3, 0x3F, 0xC6, 0x10, 0x8C, 0x25, 0x3A, 0xF6, 0xC6, 0x72, 0xF4, 0xA0,
+    0x18, 0xF9, 0xE3, 0xF0, 0xD7, 0xFD, 0x68, 0x18, 0x4C, 0x25, 0xEE, 0xE3, 0x8F, 0x69, 0x8E, 0x21,
+    0xE3, 0x65, 0x5D, 0x0E, 0x87, 0x7C, 0x8B, 0x1B, 0xC2, 0x92, 0x72, 0x16, 0xB2, 0x27, 0x49, 0x1F,
+    0x97, 0xF0, 0xAD, 0x7F, 0x51, 0x89, 0x84, 0xF5, 0xB0, 0x55, 0x15, 0x3F, 0xEB, 0x3A, 0x56, 0x69,
+    0x3D, 0x8C, 0xC7, 0xD5, 0x85, 0x59, 0xBE, 0x3A, 0x3A, 0xA0, 0x9E, 0xA3, 0x47, 0x3E, 0x24, 0xFA,
+    0xD5, 0x90, 0xDA, 0xAA, 0xCE, 0xDE, 0x90, 0x0F, 0xF4, 0x0B, 0x89, 0x86, 0x12, 0x14, 0x7C, 0x6E,
+    0xD0, 0xE7, 0x18, 0xE6, 0x10, 0x44, 0xA2, 0x9C, 0x2F, 0x89, 0x84, 0x5A, 0xC5, 0xC2, 0x77, 0xAD,
+    0xE9, 0x78, 0x51, 0x64, 0x5B, 0x64, 0x53, 0xC7, 0x8E, 0x7E, 0xF3, 0x88, 0xD7, 0x78, 0x78, 0x6A,
+    0x0C, 0x78, 0xA1, 0x5F, 0x3D, 0xE5, 0xFB, 0x57, 0x1A, 0x71, 0xCE, 0x70, 0x20, 0x88, 0xD2, 0xBB,
+    0x74, 0x4F, 0xEE, 0x67, 0xE9, 0x48, 0xAA, 0xCB, 0x78, 0xFD, 0xE4, 0x51, 0x50, 0x7A, 0x75, 0x3F,
+    0x1C, 0x42, 0xC9, 0xA8, 0xC0, 0x17, 0x3A, 0xC4, 0x45, 0x50, 0xE2, 0xF5, 0xE1, 0x50, 0x92, 0x1C,
+    0xB2, 0xA4, 0xC4, 0x15, 0x9A, 0x72, 0xB8, 0x0B, 0x9D, 0xFD, 0x9F, 0xF5, 0x25, 0xFD, 0x22, 0xFE,
+    0x5C, 0xE2, 0x49, 0x38, 0x69, 0x10, 0x75, 0xD8, 0x7A, 0xED, 0x69, 0xB9, 0xD1, 0x9E, 0x3E, 0x7E,
+    0xDC, 0x9E, 0x66, 0xA3, 0xF6, 0x34, 0x2D, 0xDA, 0xD3, 0x56, 0x4E, 0x77, 0x51, 0xFD, 0x14, 0xFA,
+    0xD6, 0x35, 0xE6, 0xED, 0xC2, 0xD3, 0x07, 0x63, 0x89, 0x9F, 0xEC, 0xD7, 0x9C, 0x68, 0x6F, 0x2A,
+    0x1B, 0xA2, 0x13, 0x3B, 0x82, 0x28, 0x9B, 0x12, 0xE0, 0xED, 0x40, 0x2F, 0xED, 0x6F, 0x49, 0x84,
+    0xE7, 0x02, 0xC2, 0xB8, 0x58, 0xD7, 0xE7, 0xC6, 0x0A, 0xA5, 0x1A, 0x8C, 0x3B, 0x9D, 0xB6, 0xA7,
+    0xBC, 0x8B, 0xB0, 0xF2, 0x5F, 0xA5, 0x18, 0xB6, 0x85, 0x49, 0x63, 0x26, 0xD4, 0x73, 0x60, 0xC1,
+    0x00, 0x15, 0x45, 0x18, 0x59, 0x96, 0xEB, 0x5D, 0x98, 0x74, 0xFC, 0x55, 0xEF, 0xA2, 0x3D, 0x4F,
+    0x9D, 0x0E, 0x15, 0x4D, 0x11, 0x77, 0xFD, 0x84, 0xA7, 0x11, 0xC5, 0x14, 0xCC, 0xEC, 0x04, 0x88,
+    0xC1, 0xC4, 0xBC, 0x52, 0x5E, 0x39, 0xFE, 0x33, 0xD8, 0xD5, 0x57, 0x37, 0x6E, 0x0E, 0x61, 0x8B,
+    0xF5, 0x1D, 0x55, 0x6D, 0xAE, 0xBC, 0xB3, 0x15, 0xCC, 0xAA, 0x3F, 0x34, 0xD5, 0x25, 0x8E, 0x9D,
+    0xE6, 0x12, 0xCD, 0x9C, 0xE2, 0x2A, 0xB6, 0xEA, 0x2D, 0xDE, 0x35, 0xA7, 0xB6, 0xDE, 0xA5, 0x5A,
+    0x9F, 0xDD, 0xDF, 0x77, 0xEA, 0xA5, 0xF5, 0xCC, 0x9D, 0x75, 0x20, 0x8C, 0x9D, 0xBD, 0x46, 0x73,
+    0x53, 0x8D, 0xD7, 0x71, 0xB5, 0x53, 0x18, 0xFF, 0x76, 0xFA, 0x66, 0xAD, 0xBA, 0x55, 0xA3, 0xAD,
+    0xAE, 0x0F, 0x55, 0x36, 0x2A, 0x1B, 0x5D, 0x79, 0x83, 0xA9, 0x9A, 0xC9, 0x77, 0x4D, 0x53, 0x0C,
+    0x5B, 0xA6, 0x28, 0x6E, 0xB8, 0x65, 0x7A, 0x86, 0x4F, 0x3F, 0x18, 0xB5, 0x6A, 0xBA, 0xD9, 0xF6,
+    0xF0, 0x9F, 0x44, 0xB5, 0xF8, 0xC3, 0xCB, 0xC2, 0xE5, 0x2C, 0x5F, 0xBA, 0xE7, 0x0F, 0xB8, 0x68,
+    0x0E, 0xF0, 0xC6, 0xBE, 0x1D, 0xCF, 0x1B, 0x9C, 0xFC, 0x09, 0x8F, 0x27, 0xDE, 0xFE, 0xFE, 0x1D,
+    0xE9, 0xDD, 0x1C, 0x07, 0x75, 0x3D, 0xF4, 0xC6, 0xC1, 0x28, 0xE8, 0x27, 0xFD, 0xB0, 0x0C, 0x46,
+    0x21, 0x24, 0xA0, 0x8D, 0xAE, 0xE0, 0xD2, 0x24, 0x87, 0x99, 0xEA, 0x62, 0x8D, 0x74, 0x29, 0x65,
+    0x6E, 0x96, 0xBB, 0x1C, 0x32, 0x8A, 0x9E, 0xE8, 0x34, 0x1E, 0x3A, 0xAD, 0x0E, 0xA4, 0x97, 0x87,
+    0xA5, 0x9F, 0x1F, 0xCA, 0x17, 0x7C, 0x46, 0xDE, 0x0D, 0x76, 0x78, 0xAF, 0x64, 0x7F, 0x9B, 0xFE,
+    0xE7, 0x60, 0x7F, 0x20, 0xC9, 0x24, 0x1E, 0xD7, 0xC4, 0xB0, 0x31, 0xE5, 0x0C, 0x53, 0x15, 0xD4,
+    0x95, 0x60, 0x11, 0x8B, 0x37, 0xF8, 0x54, 0x1D, 0x15, 0x1F, 0xDC, 0x1C, 0xC3, 0xD2, 0x40, 0x23,
+    0xB2, 0x04, 0x8A, 0xC6, 0x46, 0x55, 0xF4, 0x58, 0xCD, 0x8F, 0x84, 0x0F, 0x50, 0x11, 0x7D, 0x75,
+    0x3F, 0x44, 0x9D, 0xCF, 0x68, 0x8E, 0x5D, 0x1E, 0x4B, 0x45, 0x85, 0x2A, 0xF1, 0x51, 0x43, 0x3E,
+    0x13, 0x88, 0x17, 0x7C, 0x46, 0x05, 0xFF, 0x80, 0x23, 0x1E, 0x11, 0x01, 0x06, 0x60, 0x7D, 0xA3,
+    0x97, 0xE3, 0x59, 0x3D, 0xD8, 0x12, 0x56, 0xA8, 0x93, 0xD5, 0x1D, 0xB7, 0xDD, 0x71, 0xCF, 0x1D,
+    0x0D, 0x51, 0xF3, 0x7A, 0x38, 0xDC, 0x1C, 0xEA, 0x31, 0x98, 0xC9, 0x33, 0x3F, 0xBB, 0xAA, 0x2D,
+    0xE0, 0xA2, 0xB2, 0x38, 0xA8, 0x8E, 0xEB, 0x76, 0x70, 0x9A, 0x9A, 0xA2, 0x97, 0xDE, 0x57, 0xBD,
+    0xD2, 0xB1, 0x1E, 0xD4, 0x65, 0xE8, 0x81, 0x4A, 0x42, 0x09, 0xEA, 0x08, 0x1D, 0x28, 0x4E, 0x64,
+    0xF6, 0xA5, 0x33, 0x22, 0xE6, 0x37, 0x25, 0x87, 0x6B, 0xA3, 0x7A, 0x49, 0xAE, 0xDA, 0xA5, 0xA6,
+    0x5C, 0x66, 0xBA, 0x6D, 0x9B, 0x6A, 0xDB, 0xA6, 0x99, 0xD3, 0xE0, 0x60, 0x49, 0x8F, 0x89, 0xA9,
+    0x61, 0x52, 0x05, 0x2A, 0x95, 0xB7, 0xA3, 0xAB, 0xC1, 0x9F, 0x3A, 0x20, 0x26, 0x72, 0x80, 0xB5,
+    0x57, 0xE1, 0x9A, 0x0A, 0x62, 0xAD, 0xF3, 0x22, 0x7E, 0xC2, 0xE1, 0xA5, 0x7B, 0x51, 0x91, 0x8E,
+    0x30, 0xF3, 0xA3, 0xB8, 0x1F, 0x94, 0xB4, 0x9E, 0x14, 0x32, 0xA6, 0x90, 0x0C, 0x96, 0x83, 0x97,
+    0x27, 0x39, 0x1C, 0x7B, 0x7E, 0x00, 0x48, 0x0F, 0x20, 0x78, 0x05, 0x28, 0x2B, 0x08, 0x71, 0xF4,
+    0x10, 0xFF, 0x2A, 0x2A, 0xF8, 0xD1, 0xCA, 0xDE, 0x4F, 0x57, 0x4B, 0x58, 0xA0, 0xA5, 0xB7, 0x93,
+    0x23, 0xD2, 0x98, 0x6F, 0x8B, 0xEB, 0x8F, 0xE1, 0x79, 0x2F, 0x4C, 0x64, 0x75, 0xF6, 0x3A, 0x6D,
+    0xA5, 0xA2, 0x27, 0x40, 0x08, 0x23, 0xD4, 0x1A, 0xA1, 0xC2, 0x01, 0x5D, 0x3E, 0xE6, 0x27, 0x42,
+    0x88, 0x51, 0x4C, 0xE2, 0xA4, 0x80, 0xE3, 0xA7, 0xE1, 0xC4, 0x43, 0x9C, 0xE0, 0x8E, 0xB5, 0x10,
+    0x96, 0xCE, 0x93, 0x8B, 0x30, 0xF5, 0x9C, 0x36, 0xB3, 0xE9, 0x4F, 0x22, 0x41, 0xA4, 0x82, 0xB3,
+    0xAF, 0x62, 0x55, 0x7C, 0x4B, 0x8E, 0x62, 0x15, 0xE0, 0xB6, 0x64, 0x1B, 0x7A, 0x72, 0x4B, 0xB2,
+    0x1F, 0xEA, 0x14, 0x3D, 0x94, 0xE4, 0xDF, 0x75, 0x92, 0x20, 0x4E, 0xA5, 0x13, 0x53, 0x0A, 0xFC,
+    0x34, 0x6D, 0xA7, 0x64, 0xCC, 0x03, 0xF8, 0xAF, 0x8C, 0x69, 0x0B, 0x98, 0xAC, 0x5E, 0xCD, 0xCB,
+    0xD2, 0xFC, 0x19, 0xFB, 0x99, 0x9F, 0x34, 0x16, 0xD4, 0x40, 0xAF, 0x52, 0x98, 0x11, 0x99, 0x35,
+    0x40, 0xB5, 0xFC, 0x59, 0x33, 0xC2, 0x5D, 0x8A, 0x45, 0x31, 0x33, 0x28, 0xB0, 0xD8, 0x0C, 0x89,
+    0x73, 0x0E, 0x88, 0x06, 0x07, 0x07, 0xC3, 0xF7, 0xDE, 0x37, 0x14, 0x2E, 0x8C, 0x0D, 0x04, 0xA8,
+    0xA3, 0x18, 0xE0, 0xA8, 0x10, 0x60, 0xE6, 0x14, 0x01, 0x1C, 0x15, 0x00, 0x80, 0xAE, 0xFA, 0xC3,
+    0xB6, 0x54, 0x7D, 0xA8, 0xA6, 0xDA, 0x43, 0x33, 0x55, 0x1E, 0x76, 0xA5, 0xBA, 0xA7, 0x4E, 0xF5,
+    0xD4, 0x69, 0x9E, 0x39, 0xC5, 0xB7, 0x9D, 0xDE, 0x8D, 0x72, 0x07, 0xCF, 0xE8, 0x38, 0x71, 0xAA,
+    0x3A, 0xEF, 0x65, 0x16, 0x26, 0xDE, 0x3B, 0xE6, 0xB3, 0x1B, 0x1B, 0x6B, 0x7E, 0xE2, 0xFE, 0x62,
+    0x38, 0x4B, 0xFA, 0xCF, 0x8B, 0x68, 0x72, 0xE9, 0x5E, 0xDA, 0x5F, 0xFD, 0xB9, 0xA4, 0x5F, 0xD6,
+    0xA3, 0x55, 0x04, 0xFE, 0xFF, 0x7E, 0x4F, 0xF9, 0xC4, 0x7F, 0x60, 0x2A, 0x0F, 0x20, 0x21, 0xCD,
+    0x14, 0xEE, 0x94, 0x01, 0x19, 0x33, 0x87, 0xF7, 0x71, 0xBA, 0x42, 0xF8, 0x3C, 0x8D, 0xC2, 0xF8,
+    0x6B, 0x92, 0x6B, 0x60, 0x4E, 0x2D, 0x34, 0x67, 0x16, 0x9C, 0xB7, 0x71, 0x00, 0x04, 0xEE, 0xB0,
+    0x27, 0xF1, 0xE7, 0x00, 0x82, 0x8F, 0x33, 0x89, 0xF2, 0xC4, 0x26, 0x26, 0x5D, 0x9A, 0xD2, 0xBD,
+    0x45, 0x55, 0x5F, 0x31, 0x0D, 0x7B, 0x7D, 0x47, 0x12, 0x18, 0x89, 0xD6, 0x54, 0xED, 0xE8, 0xCF,
+    0xA9, 0x4E, 0x50, 0xAB, 0xC2, 0x76, 0xF1, 0xB5, 0x05, 0x95, 0xF5, 0xC9, 0xEA, 0xB4, 0xDD, 0xCD,
+    0x1A, 0xCF, 0xFC, 0x7F, 0xD1, 0x9B, 0x3E, 0xE1, 0x18, 0xA9, 0x3F, 0xDC, 0xA0, 0x27, 0x93, 0x8E,
+    0x7A, 0x8E, 0x5B, 0x8A, 0x23, 0x95, 0x44, 0x1C, 0xE0, 0x18, 0xFC, 0xF2, 0x4F, 0x48, 0x58, 0xEA,
+    0x1A, 0x26, 0xB5, 0xE1, 0xCC, 0x9B, 0xD6, 0xFE, 0x48, 0xC5, 0x1B, 0xA9, 0x57, 0x28, 0x39, 0xC2,
+    0x2E, 0x60, 0x44, 0x83, 0x99, 0x79, 0x27, 0x75, 0xCC, 0x65, 0x42, 0x5E, 0x71, 0xD0, 0x30, 0x0A,
+    0x05, 0xBF, 0xC5, 0x3C, 0x3C, 0x06, 0x0F, 0x43, 0xDC, 0x10, 0x06, 0x0D, 0x61, 0xC4, 0x30, 0xDC,
+    0x34, 0x56, 0x68, 0xA0, 0xC8, 0xDA, 0x10, 0xA1, 0xF1, 0x81, 0xC1, 0x41, 0x23, 0x83, 0x30, 0x2C,
+    0x08, 0x63, 0x82, 0x06, 0x04, 0x8D, 0x06, 0x4D, 0x28, 0xF8, 0xDF, 0xDF, 0xAB, 0xE2, 0xA9, 0xEB,
+    0x54, 0x8F, 0xA9, 0x83, 0xAA, 0xAE, 0x58, 0x68, 0x20, 0x98, 0x0F, 0x6A, 0x28, 0xBA, 0xF2, 0xB2,
+    0x76, 0x7A, 0xBA, 0xED, 0x0C, 0x1D, 0xB6, 0x93, 0xC4, 0x81, 0xA8, 0xC8, 0x2B, 0x53, 0xE5, 0xB2,
+    0x85, 0x13, 0x85, 0xFC, 0x8A, 0xC4, 0x8A, 0x72, 0x80, 0x9A, 0x35, 0x52, 0x80, 0xDE, 0x49, 0xEA,
+    0x9C, 0x93, 0x79, 0x3C, 0xF5, 0xC1, 0xFA, 0x4E, 0xFD, 0xE0, 0xB5, 0x34, 0x8C, 0xD4, 0x59, 0x46,
+    0xD6, 0x7C, 0x7E, 0x81, 0xBF, 0x8D, 0x18, 0xAA, 0x2D, 0x60, 0x83, 0x31, 0x06, 0xC5, 0x2E, 0xCE,
+    0xFE, 0x6B, 0xD4, 0x4C, 0x6F, 0x4F, 0x16, 0x19, 0x2E, 0xC8, 0xBC, 0x72, 0x79, 0xA5, 0xF2, 0x64,
+    0xF2, 0x15, 0x09, 0x2E, 0xBD, 0x2D, 0x96, 0x26, 0x69, 0xBC, 0xB2, 0x78, 0x25, 0xF1, 0xCA, 0xE1,
+    0x95, 0xC2, 0x2B, 0x83, 0x57, 0x02, 0xAF, 0xFC, 0x5D, 0xE9, 0xBB, 0xB2, 0x77, 0x65, 0x22, 0xCA,
+    0xDD, 0x95, 0xBA, 0x1B, 0x73, 0x57, 0xE2, 0x6E, 0xBC, 0xDD, 0xC0, 0xDF, 0xF8, 0x06, 0xF0, 0x23,
+    0xBA, 0x60, 0x50, 0x79, 0x2C, 0x70, 0x60, 0x1E, 0xD1, 0xC2, 0x4E, 0x84, 0xCA, 0x93, 0x3A, 0x87,
+    0xF9, 0x23, 0xCE, 0xE7, 0xC7, 0xFC, 0x1E, 0x74, 0x99, 0x5F, 0x5B, 0xEC, 0xBC, 0xDE, 0x92, 0x59,
+    0x10, 0xFD, 0xBA, 0x20, 0xD1, 0x9F, 0xE5, 0x4A, 0xF4, 0xD5, 0x4B, 0x8F, 0x74, 0x1A, 0xCA, 0x97,
+    0x46, 0xF4, 0x15, 0xA5, 0x87, 0x31, 0x97, 0xDC, 0xAE, 0x68, 0x78, 0x86, 0x4A, 0x14, 0x7A, 0x25,
+    0x6F, 0xAD, 0xE3, 0x3E, 0xCD, 0xA3, 0x12, 0xF5, 0x35, 0x20, 0xFF, 0x63, 0x51, 0x07, 0x73, 0x12,
+    0xE4, 0xDF, 0x6C, 0xF3, 0xC7, 0xFB, 0xF3, 0x6F, 0x1E, 0xC5, 0x96, 0x05, 0xF1, 0x9B, 0x89, 0xFA,
+    0xA1, 0xF5, 0x33, 0xA7, 0x0A, 0x31, 0xEF, 0xC6, 0x75, 0xF0, 0xD2, 0x4A, 0x56, 0x6E, 0x98, 0x77,
+    0x8B, 0x5F, 0x87, 0xAF, 0x85, 0x6F, 0x8E, 0xAF, 0x8E, 0xE6, 0x9E, 0x5B, 0xEE, 0xA7, 0x46, 0x23,
+    0x26, 0xC4, 0x8B, 0x70, 0x11, 0x28, 0x7E, 0x88, 0x15, 0xA1, 0x22, 0x52, 0x04, 0x8A, 0x38, 0x11,
+    0x26, 0xA2, 0x44, 0x90, 0x1C, 0x46, 0x73, 0x40, 0x74, 0xE5, 0x3B, 0x57, 0xAC, 0x51, 0xC7, 0xD3,
+    0xD8, 0xF2, 0x07, 0x67, 0x15, 0x27, 0x75, 0xD8, 0x36, 0xFE, 0xE9, 0xD9, 0xD3, 0x65, 0x59, 0xB4,
+    0x74, 0x44, 0x50, 0x75, 0x27, 0x9C, 0xD4, 0x2D, 0x91, 0xB3, 0x90, 0x3D, 0x79, 0x63, 0xA4, 0x9F,
+    0x15, 0xD3, 0xF1, 0x24, 0xB1, 0xEA, 0xF8, 0xEA, 0x2A, 0x13, 0x5D, 0xDB, 0xEA, 0x09, 0x8D, 0x86,
+    0x9E, 0x7A, 0xAC, 0xE8, 0x3B, 0x83, 0xE2, 0xB1, 0x78, 0xBF, 0xC1, 0xDC, 0xD2, 0x59, 0xFC, 0x08,
+    0x0A, 0xE0, 0xF5, 0xB4, 0xAB, 0xE4, 0xEA, 0x0B, 0xC1, 0xCA, 0x0C, 0xCA, 0xE2, 0x7D, 0xA8, 0x26,
+    0xA6, 0xE4, 0xEA, 0xF4, 0x63, 0x45, 0xBF, 0xC4, 0x28, 0xA5, 0x9C, 0xE3, 0x36, 0x3E, 0xAF, 0x02,
+    0xAB, 0x1C, 0xFE, 0xE7, 0x23, 0x50, 0x9F, 0x77, 0x89, 0xD5, 0xB5, 0x13, 0xC3, 0x6A, 0xA7, 0xD4,
+    0x77, 0x87, 0xFD, 0x9E, 0xFC, 0x9E, 0x46, 0xDF, 0x78, 0x1E, 0x16, 0x2F, 0xD4, 0x85, 0x37, 0x7B,
+    0x50, 0x44, 0x65, 0xDA, 0x4F, 0x73, 0x46, 0x82, 0x6D, 0x44, 0x8B, 0x03, 0xE9, 0xC2, 0x3D, 0x66,
+    0x6F, 0xC2, 0x13, 0xCE, 0x96, 0x56, 0x31, 0xA6, 0x55, 0x4B, 0x4A, 0x4C, 0xBA, 0x9B, 0x9F, 0xD1,
+    0x65, 0x4D, 0xB0, 0x32, 0x4D, 0x4C, 0x34, 0xFF, 0xCA, 0xCF, 0x9C, 0x0E, 0xC2, 0x44, 0xDF, 0x16,
+    0xE3, 0x96, 0xC6, 0xC7, 0x25, 0x3E, 0x12, 0x34, 0xAE, 0x5B, 0xC7, 0x6B, 0x1B, 0xC6, 0x04, 0xC2,
+    0x44, 0xBE, 0x44, 0xBA, 0x44, 0x4C, 0x49, 0x96, 0xC8, 0x95, 0x18, 0x91, 0xC9, 0x94, 0x48, 0x94,
+    0xC8, 0x93, 0x48, 0x93, 0xC8, 0x92, 0x34, 0x71, 0x06, 0x47, 0x52, 0x8A, 0xB4, 0x50, 0xF7, 0x79,
+    0x4E, 0x18, 0xF0, 0xF3, 0xB9, 0xEF, 0xB3, 0x71, 0x35, 0x3F, 0x2D, 0xD8, 0x5C, 0xC7, 0x3D, 0x93,
+    0x16, 0x1B, 0xE4, 0x11, 0xC6, 0xB8, 0xAA, 0x79, 0x5D, 0xE6, 0x84, 0xB0, 0x61, 0xA8, 0x51, 0x5F,
+    0x56, 0x1B, 0x9D, 0x6E, 0x5F, 0x69, 0x3F, 0x49, 0x6D, 0xD5, 0x92, 0xEF, 0xD4, 0x4F, 0x1E, 0x28,
+    0x79, 0xBC, 0xDB, 0xF7, 0x4B, 0x4B, 0x90, 0x74, 0x2D, 0x5F, 0xCC, 0x6C, 0x4D, 0x77, 0x32, 0xB3,
+    0x44, 0xB3, 0x31, 0x28, 0xDF, 0x35, 0x21, 0xFB, 0x87, 0x06, 0xA6, 0xCC, 0xF6, 0xC1, 0x00, 0xB1,
+    0x00, 0xED, 0x71, 0xB7, 0x3C, 0x4B, 0x66, 0xBE, 0x7A, 0x5B, 0xF3, 0xB6, 0x40, 0xF1, 0xE1, 0x1A,
+    0x33, 0x67, 0xBA, 0xE1, 0x9C, 0x6A, 0x87, 0x4B, 0x7D, 0x8D, 0x38, 0x01, 0xE9, 0x8B, 0x82, 0x37,
+    0x63, 0x9E, 0x3A, 0xC4, 0x6A, 0xE7, 0x97, 0x6F, 0x57, 0x32, 0x98, 0xE1, 0xC6, 0x7A, 0xD2, 0x4A,
+    0x9D, 0xD5, 0x14, 0xED, 0xFC, 0x8D, 0x7C, 0x4E, 0xBE, 0xBC, 0x41, 0x2E, 0x47, 0xEF, 0xDC, 0xBD,
+    0x5B, 0xFA, 0x63, 0x7F, 0x8A, 0x95, 0x39, 0xF4, 0x26, 0x8A, 0x15, 0xA6, 0x28, 0xCD, 0xC3, 0x32,
+    0x2C, 0x89, 0x57, 0x42, 0xB4, 0x3E, 0x9C, 0x91, 0x75, 0xD5, 0xE4, 0x5E, 0x89, 0xD6, 0x39, 0xC8,
+    0x11, 0x0F, 0xD5, 0x00, 0x0E, 0x85, 0x1E, 0x22, 0xF3, 0x3E, 0x29, 0xC3, 0x3C, 0xFD, 0xFC, 0x8D,
+    0xD9, 0x91, 0x44, 0x53, 0x19, 0x4C, 0xA8, 0xF1, 0xDC, 0xC0, 0x76, 0xEA, 0x3B, 0x12, 0x3E, 0xDD,
+    0x41, 0x5A, 0x57, 0x20, 0xAB, 0x3C, 0xC2, 0x5C, 0xD1, 0x7D, 0x4D, 0xA8, 0x48, 0x4E, 0xE2, 0xA9,
+    0xE5, 0x63, 0xAB, 0x8E, 0x65, 0x2D, 0xBD, 0xEE, 0x89, 0xB7, 0x7F, 0x1F, 0xC3, 0x80, 0x9C, 0x93,
+    0x62, 0x60, 0xC6, 0x7A, 0x98, 0x0B, 0x2C, 0xD8, 0xB3, 0x03, 0xE4, 0x66, 0x24, 0x9E, 0x25, 0x56,
+    0x7D, 0x30, 0x7B, 0x1B, 0xEE, 0xA9, 0x57, 0x7F, 0xBA, 0x9C, 0xF0, 0x30, 0x58, 0xA7, 0xFF, 0x3A,
+    0x15, 0xEF, 0x78, 0xF0, 0x2A, 0x3C, 0x2C, 0x2B, 0xCC, 0xFD, 0x94, 0x04, 0x3A, 0x15, 0x23, 0x8E,
+    0xF4, 0x18, 0x18, 0x70, 0x59, 0x72, 0x95, 0x65, 0x3B, 0x9A, 0x70, 0xF4, 0x57, 0x8A, 0x2C, 0x39,
+    0xAB, 0xAE, 0x8B, 0x7F, 0x53, 0xE4, 0xE0, 0x58, 0x8F, 0x60, 0x02, 0x51, 0xDF, 0xD3, 0x04, 0xF5,
+    0x50, 0xAE, 0x60, 0xAA, 0x86, 0x57, 0x44, 0xEB, 0x0D, 0xF0, 0x83, 0xF1, 0x67, 0x3B, 0x43, 0xC8,
+    0x79, 0xBC, 0x50, 0x4F, 0xB5, 0x52, 0xAA, 0x55, 0x51, 0xAD, 0x80, 0x6A, 0xC9, 0xE6, 0x42, 0x92,
+    0x49, 0x50, 0x0C, 0x15, 0x83, 0x45, 0x71, 0x11, 0x05, 0x46, 0xA7, 0x38, 0xD7, 0xD2, 0xBA, 0xC3,
+    0xC6, 0x95, 0x0E, 0xB3, 0x7C, 0x1E, 0x3B, 0x14, 0x1F, 0x51, 0x80, 0x44, 0x11, 0xD2, 0xB1, 0x4F,
+    0xCE, 0x6F, 0x15, 0x75, 0x2B, 0x10, 0x52, 0x71, 0xC2, 0xE4, 0x70, 0x72, 0x40, 0x39, 0xA4, 0x2C,
+    0x69, 0xE8, 0xC3, 0x8D, 0xFB, 0x7F, 0x5F, 0x36, 0xCB, 0xB8, 0x9E, 0x27, 0x0D, 0x2F, 0x0C, 0xC3,
+    0x5D, 0x60, 0x68, 0xC3, 0xF3, 0x30, 0x5C, 0xD7, 0xF5, 0xD2, 0xD1, 0xB8, 0xB8, 0xA1, 0x24, 0x34,
+    0xD6, 0x15, 0x18, 0x29, 0x92, 0x5E, 0xBE, 0x90, 0xBD, 0xF5, 0xB4, 0xCC, 0x07, 0xDA, 0xCC, 0x52,
+    0x56, 0xCE, 0x71, 0x97, 0x19, 0x9C, 0xA7, 0xC5, 0xE5, 0x50, 0x43, 0xC5, 0x86, 0xFA, 0x30, 0x0A,
+    0x13, 0xBF, 0x4B, 0x25, 0x93, 0xB7, 0x88, 0x6B, 0xDA, 0xD3, 0x6A, 0xE0, 0x6F, 0x74, 0x7C, 0x97,
+    0x0B, 0xA5, 0xEB, 0x55, 0x9A, 0xCB, 0x4D, 0x35, 0x99, 0x1B, 0xA8, 0x4B, 0x21, 0xE0, 0x15, 0x61,
+    0xC4, 0xA2, 0x04, 0xC2, 0x48, 0xE8, 0xE0, 0x1E, 0xE0, 0x2E, 0xB5, 0xA2, 0xA0, 0x62, 0x76, 0x10,
+    0x68, 0x25, 0x49, 0x1A, 0x19, 0x43, 0x2E, 0x56, 0xCF, 0xD9, 0x61, 0xAC, 0x29, 0xC7, 0xB4, 0xA5,
+    0x8E, 0x55, 0x5B, 0xAA, 0xD0, 0xAB, 0xC6, 0x67, 0xF7, 0x73, 0x44, 0x45, 0x76, 0x15, 0xE0, 0xE8,
+    0x82, 0x12, 0x01, 0x3A, 0x64, 0xB9, 0x35, 0x2A, 0x88, 0xE5, 0xC7, 0x14, 0xFE, 0x2E, 0x87, 0x01,
+    0xA4, 0x4E, 0xFE, 0x01, 0x82, 0xA6, 0x74, 0x0D, 0x2C, 0x71, 0x01, 0xF6, 0x23, 0x0E, 0x19, 0xE5,
+    0x4D, 0x59, 0x42, 0x88, 0xC6, 0x4B, 0xC5, 0x8B, 0x97, 0x95, 0xEA, 0xA9, 0x4F, 0xD7, 0x94, 0xE1,
+    0x4A, 0x3B, 0x6C, 0xBB, 0x72, 0x9E, 0x98, 0x50, 0xCC, 0xF2, 0x90, 0xE4, 0x31, 0xC7, 0x63, 0x8A,
+    0xC7, 0x0C, 0x8F, 0x09, 0x1E, 0xF3, 0x3B, 0xA6, 0x77, 0x4C, 0xEC, 0xEC, 0x13, 0x96, 0x4C, 0xED,
+    0x98, 0xD9, 0xD1, 0xB6, 0x98, 0xD7, 0x69, 0x5A, 0x87, 0x89, 0x0B, 0x9A, 0x8C, 0xD8, 0x51, 0x80,
+    0x08, 0x26, 0xEA, 0x2B, 0xB6, 0x37, 0xE8, 0xD0, 0x6A, 0x52, 0xB6, 0x1B, 0x37, 0x4E, 0xA1, 0xEE,
+    0xE7, 0xE1, 0x7B, 0xE9, 0x79, 0x1B, 0xBF, 0xFB, 0x42, 0xB1, 0xD0, 0x62, 0x50, 0x4C, 0xCB, 0x0F,
+    0x59, 0x0A, 0xD2, 0x4A, 0x90, 0x15, 0x82, 0xAE, 0xB5, 0x04, 0xB2, 0x66, 0xBF, 0x02, 0xAB, 0xB4,
+    0xBB, 0x3F, 0x60, 0xD9, 0x11, 0x0B, 0xFF, 0x9A, 0xC5, 0x2C, 0xCA, 0x77, 0xB9, 0xB1, 0xCC, 0x40,
+    0x79, 0x3C, 0xD7, 0xE2, 0x59, 0x4D, 0xAC, 0xCD, 0xA8, 0xDB, 0xDA, 0x06, 0x60, 0xD0, 0x6E, 0xC2,
+    0x2E, 0x87, 0x43, 0xBA, 0xAC, 0x01, 0x97, 0x66, 0xF6, 0x59, 0x0F, 0x54, 0x53, 0xB9, 0xA2, 0x25,
+    0xAF, 0x0B, 0x02, 0x7D, 0xD2, 0x08, 0xE4, 0x2D, 0x09, 0x74, 0x76, 0x7F, 0xBF, 0xCF, 0x38, 0x8A,
+    0x04, 0x95, 0x02, 0x75, 0xE8, 0x37, 0x5E, 0x93, 0x51, 0x2B, 0x82, 0x34, 0xAE, 0x84, 0x32, 0x06,
+    0x74, 0x5C, 0xA1, 0xD2, 0xB8, 0xA4, 0x6C, 0x92, 0x0B, 0x0B, 0x96, 0xD5, 0xD2, 0xEA, 0x02, 0x95,
+    0xD8, 0x24, 0x35, 0xDE, 0x63, 0x88, 0xEC, 0x69, 0x8B, 0xF1, 0x33, 0x2C, 0x97, 0xD5, 0xBA, 0x6C,
+    0xBB, 0x37, 0x17, 0xA9, 0x75, 0xFC, 0x03, 0x60, 0x18, 0x12, 0xBB, 0x60, 0x49, 0x2A, 0x9F, 0x24,
+    0xD1, 0xAF, 0x5B, 0x57, 0xBB, 0xDD, 0xD6, 0x78, 0x0E, 0xBE, 0xBE, 0x94, 0xB5, 0xBA, 0xEA, 0xB7,
+    0xC5, 0x23, 0x1B, 0xB4, 0x5E, 0x3A, 0xB4, 0x5A, 0x7A, 0x53, 0x41, 0xEA, 0x37, 0x7C, 0x3F, 0x6B,
+    0x1E, 0xF7, 0x1D, 0xDE, 0x9F, 0xDD, 0xF9, 0x7F, 0xD4, 0x3F, 0xB3, 0x5E, 0x19, 0x7E, 0xAC, 0x55,
+    0x26, 0x4D, 0xA7, 0x4C, 0x9A, 0x46, 0x99, 0x2C, 0xF4, 0xC9, 0xDA, 0x36, 0x59, 0xDB, 0x25, 0x6B,
+    0x9B, 0x64, 0x6D, 0x8F, 0xAC, 0x6D, 0x91, 0xB5, 0x1D, 0xB2, 0xB6, 0x41, 0xD6, 0xF6, 0xC7, 0xDA,
+    0xF6, 0x58, 0xDB, 0x1D, 0x6B, 0x9B, 0x63, 0x6D, 0x6F, 0xAC, 0x69, 0x8D, 0xB5, 0x9D, 0xB1, 0xB6,
+    0x31, 0xF6, 0x4C, 0x5F, 0xCC, 0xF8, 0xA0, 0x3B, 0x39, 0x7A, 0xA6, 0xE4, 0x7E, 0xF0, 0xDC, 0xEA,
+    0xF4, 0x69, 0x69, 0x8B, 0xB9, 0x65, 0xA9, 0x55, 0xCC, 0xED, 0xC6, 0x7C, 0x7D, 0x2D, 0x90, 0xBD,
+    0x08, 0xA6, 0x26, 0x4C, 0xCB, 0x70, 0xC1, 0x37, 0x31, 0xB5, 0xF3, 0xED, 0x1A, 0x23, 0x54, 0xEA,
+    0x89, 0xC2, 0x7E, 0xD3, 0xFC, 0xFE, 0x96, 0xE8, 0x07, 0x48, 0x45, 0xAA, 0x9E, 0x02, 0xBC, 0x42,
+    0x2B, 0xC3, 0x34, 0x4D, 0x7F, 0xE2, 0x6C, 0xD4, 0x5A, 0x58, 0x61, 0xE9, 0x58, 0x38, 0x13, 0xED,
+    0x91, 0x4B, 0x92, 0xAC, 0xD9, 0x16, 0x17, 0x56, 0x3B, 0x6E, 0x56, 0x21, 0x64, 0x7B, 0xB2, 0xFF,
+    0xA0, 0x60, 0xE2, 0x09, 0xF7, 0x5B, 0xFF, 0x14, 0x69, 0x8C, 0xDA, 0x68, 0x9F, 0x70, 0xD2, 0x46,
+    0x59, 0xB2, 0x53, 0x1B, 0xD5, 0x99, 0xD9, 0xD3, 0x93, 0x5C, 0x6D, 0xB4, 0xAB, 0xC5, 0xE6, 0x4A,
+    0x9B, 0x33, 0x06, 0xD1, 0x21, 0x15, 0xA6, 0xCB, 0xEB, 0xF2, 0xEF, 0x2C, 0x2F, 0x67, 0x7F, 0x3C,
+    0xB1, 0xFC, 0x2D, 0xAE, 0x87, 0x6E, 0x0E, 0xCF, 0xCD, 0x2D, 0x35, 0xA8, 0xBD, 0x9A, 0x7A, 0x31,
+    0x61, 0x92, 0xEC, 0x0A, 0xA3, 0x41, 0x56, 0xB2, 0x10, 0xDA, 0x53, 0x9E, 0x38, 0x50, 0x7F, 0x71,
+    0xA8, 0xA3, 0x2D, 0x14, 0xA5, 0xA1, 0x7C, 0x41, 0x45, 0x53, 0xF4, 0xB4, 0xE8, 0xE8, 0x2B, 0xB9,
+    0x0A, 0x59, 0x96, 0x57, 0x35, 0x75, 0xB1, 0x41, 0x47, 0xED, 0x9C, 0xB2, 0xC2, 0x14, 0x17, 0xB4,
+    0x8A, 0xE4, 0xA7, 0xF4, 0xA4, 0xE9, 0x03, 0xA2, 0x90, 0x1D, 0xCF, 0x79, 0xAA, 0x8D, 0x5D, 0x69,
+    0x6B, 0xE4, 0xB6, 0x2C, 0x56, 0x15, 0xDA, 0xCC, 0x49, 0xED, 0x38, 0x9D, 0x6B, 0x5B, 0x36, 0x1D,
+    0xAB, 0x5D, 0x3B, 0x5C, 0x5E, 0xD8, 0x11, 0x31, 0xDF, 0x94, 0x10, 0x43, 0x69, 0xEB, 0x55, 0xB9,
+    0x56, 0x55, 0xD3, 0xA9, 0x72, 0x8D, 0x2A, 0x6B, 0xD7, 0xB9, 0x66, 0x9D, 0x6B, 0xD5, 0xB9, 0x46,
+    0x9D, 0xF5, 0xA8, 0x5C, 0x93, 0xCE, 0xB5, 0xE8, 0x5C, 0x83, 0xCE, 0xB5, 0xE7, 0x5C, 0x73, 0xCE,
+    0xB5, 0xE6, 0x5C, 0x63, 0xCE, 0xF5, 0xA6, 0x5C, 0x6B, 0xCA, 0x75, 0xA6, 0x5C, 0x63, 0xCA, 0x16,
+    0x17, 0x4D, 0x40, 0x2D, 0x64, 0xEC, 0x8C, 0xF0, 0x4C, 0xDB, 0x4A, 0x62, 0x1F, 0x89, 0x4D, 0x24,
+    0x76, 0x90, 0xD8, 0x3E, 0x62, 0xEF, 0x88, 0x8D, 0x23, 0x76, 0x8D, 0xAC, 0x18, 0xB2, 0xD8, 0xD3,
+    0xB4, 0x0F, 0x1B, 0x44, 0x07, 0x32, 0x2F, 0x1C, 0x59, 0xD7, 0x6F, 0x6F, 0xDE, 0xE9, 0xB2, 0x34,
+    0xFD, 0x7B, 0x3A, 0x0E, 0x34, 0x1C, 0x0E, 0x99, 0x0E, 0x7B, 0xC5, 0x56, 0x7B, 0x6E, 0xDF, 0x2F,
+    0x25, 0xEB, 0x5F, 0xCC, 0xD3, 0xF4, 0xF0, 0x2D, 0x8D, 0x4D, 0x1A, 0xAB, 0x36, 0xD5, 0x80, 0x6F,
+    0x3F, 0x9B, 0xA6, 0x87, 0x4F, 0x3E, 0x68, 0xD3, 0xF4, 0xCB, 0x6A, 0x1B, 0xB7, 0xD5, 0x75, 0x68,
+    0x82, 0xEE, 0xCF, 0x13, 0x74, 0x69, 0xBA, 0x3D, 0x6A, 0x80, 0x95, 0x01, 0x41, 0x06, 0xBE, 0x66,
+    0x13, 0x1F, 0x7C, 0xD1, 0x97, 0xD0, 0xC3, 0xEA, 0x10, 0xB8, 0xB7, 0xAB, 0xEC, 0xD0, 0x5B, 0xA1,
+    0xED, 0x44, 0x8B, 0x19, 0xAE, 0xBA, 0xEF, 0xBB, 0x7E, 0xA0, 0xEB, 0x7F, 0xBB, 0x82, 0x85, 0xF3,
+    0x0B, 0x0B, 0xFB, 0x37, 0xFE, 0x4F, 0x25, 0xF2, 0x2E, 0xAD, 0x08, 0x47, 0xF3, 0x16, 0xE6, 0x1F,
+    0x59, 0xCD, 0x5E, 0x96, 0xAB, 0xFA, 0x2F, 0x2B, 0xB5, 0xD7, 0x70, 0xA2, 0x36, 0xB9, 0xB7, 0xC4,
+    0x1C, 0xDD, 0x64, 0x6C, 0x92, 0x8A, 0xDF, 0x22, 0x15, 0x2F, 0x1B, 0x2A, 0x1E, 0x32, 0x9C, 0xAC,
+    0x91, 0x8A, 0x77, 0x48, 0xC5, 0x1F, 0x82, 0x8A, 0x7B, 0x43, 0x50, 0xF1, 0xA0, 0x0F, 0x2A, 0x1E,
+    0x93, 0x8A, 0x6F, 0x92, 0x8A, 0xDF, 0x22, 0x15, 0x2F, 0x41, 0xC5, 0xFD, 0x02, 0x54, 0x3C, 0x04,
+    0x60, 0xBD, 0x35, 0x52, 0xF1, 0x0E, 0xA9, 0x38, 0x79, 0x02, 0xEE, 0x45, 0x74, 0x26, 0x15, 0x8F,
+    0x49, 0xC5, 0x37, 0xBD, 0x85, 0xE2, 0xD4, 0xF5, 0x86, 0x15, 0x1A, 0x3F, 0x6F, 0x89, 0xAD, 0xCD,
+    0x39, 0x96, 0xBD, 0x3F, 0xC3, 0xC2, 0x4E, 0x3F, 0xC0, 0x25, 0x87, 0xB8, 0x0E, 0x08, 0xB1, 0xCE,
+    0x14, 0x4E, 0x81, 0xC8, 0x45, 0x92, 0xEE, 0x2D, 0x5A, 0x1A, 0x28, 0x78, 0x7A, 0xB5, 0x40, 0xAC,
+    0x78, 0x33, 0xC7, 0xF0, 0x43, 0x5C, 0x97, 0xDE, 0x26, 0xDD, 0x18, 0xA9, 0x0F, 0xA4, 0x8F, 0xFF,
+    0x14, 0x3E, 0x73, 0x83, 0x33, 0xBA, 0xB5, 0x32, 0xA7, 0x8E, 0xE7, 0x14, 0x92, 0xCC, 0x08, 0xDF,
+    0x7B, 0x1A, 0xCE, 0x0A, 0x5D, 0x96, 0x65, 0x67, 0xB9, 0x95, 0xF2, 0xAD, 0xD6, 0xD0, 0xBC, 0xFC,
+    0x3A, 0x6C, 0x0F, 0x51, 0x73, 0x02, 0x43, 0xDE, 0x85, 0x20, 0x09, 0xA6, 0xCD, 0x73, 0x06, 0x74,
+    0x32, 0x4B, 0x71, 0xF5, 0x4E, 0x9B, 0x08, 0xC9, 0x31, 0xDD, 0xB8, 0x5F, 0xFC, 0xFE, 0xB3, 0x4E,
+    0xFC, 0x5B, 0x6D, 0x49, 0xFF, 0x48, 0xD4, 0x01, 0xC5, 0x7F, 0x33, 0x94, 0x57, 0xE5, 0x64, 0xAB,
+    0xAA, 0x2B, 0xAF, 0xC3, 0x1A, 0xA2, 0x8F, 0xC6, 0xB4, 0x40, 0x32, 0xC1, 0x31, 0x33, 0xC3, 0x0E,
+    0x43, 0xCB, 0x19, 0xAF, 0x2D, 0x5C, 0x20, 0x4D, 0x4A, 0x9E, 0xEE, 0xEB, 0x7E, 0x9D, 0x8E, 0x0D,
+    0x50, 0x6F, 0x8B, 0x2E, 0x60, 0xFD, 0x6B, 0x6D, 0xE7, 0x27, 0x3F, 0x27, 0x77, 0x98, 0x7E, 0x63,
+    0xDB, 0xD9, 0x2B, 0x74, 0x47, 0x8E, 0xEE, 0xC7, 0xD1, 0xDD, 0x38, 0x03, 0xEE, 0xC5, 0xF1, 0xF2,
+    0x6B, 0x10, 0x02, 0x7F, 0x1D, 0xE1, 0xDA, 0x83, 0x04, 0x2B, 0x01, 0xF4, 0xEA, 0x8C, 0x9B, 0xE9,
+    0x88, 0x3C, 0x62, 0x90, 0xFB, 0x23, 0x70, 0xD1, 0x21, 0x8D, 0x3A, 0x61, 0x25, 0x1D, 0xA4, 0xED,
+    0x48, 0xBA, 0x21, 0xAB, 0x1C, 0x7D, 0x39, 0x34, 0x22, 0xA2, 0x9F, 0x2E, 0x6E, 0xE4, 0xFA, 0x4C,
+    0x9E, 0x8C, 0x2D, 0x19, 0x35, 0x9E, 0x71, 0x5F, 0x09, 0x31, 0xAE, 0x4B, 0x6E, 0x42, 0xD8, 0x2D,
+    0xC8, 0xE1, 0xCA, 0x37, 0x2F, 0x51, 0x4D, 0x95, 0x82, 0x99, 0x21, 0x65, 0xE8, 0xE0, 0x9A, 0xF5,
+    0x93, 0x53, 0xD1, 0xBB, 0x76, 0x5D, 0xB3, 0x73, 0xA9, 0xC0, 0x1B, 0xAF, 0x44, 0x30, 0x19, 0x50,
+    0xE6, 0x66, 0xB1, 0xD0, 0x94, 0xC8, 0x11, 0x83, 0x66, 0x6F, 0x51, 0x69, 0x3B, 0x07, 0x16, 0xFA,
+    0x14, 0xCA, 0xEA, 0xE8, 0x24, 0x9B, 0xB6, 0x7D, 0xD7, 0xA9, 0x74, 0x38, 0xAF, 0x5B, 0xD3, 0x5E,
+    0x49, 0xE6, 0xC8, 0xE3, 0xCE, 0xAD, 0xD0, 0x7F, 0x24, 0x6F, 0x94, 0xE1, 0x87, 0x23, 0xAF, 0xBC,
+    0xED, 0x7C, 0x06, 0xD2, 0xE4, 0x81, 0xF2, 0x49, 0xF8, 0x7D, 0xB0, 0x43, 0x25, 0xC0, 0xFC, 0xDD,
+    0xD6, 0x67, 0x1D, 0xE8, 0x6F, 0xA5, 0xBF, 0xB3, 0x87, 0xEC, 0xFC, 0xF2, 0xA6, 0x4B, 0x4C, 0x62,
+    0x11, 0x6B, 0xFF, 0x71, 0x84, 0xF0, 0xF2, 0x13, 0xB7, 0x57, 0xE4, 0x85, 0xC8, 0x8C, 0x57, 0xF9,
+    0x75, 0x81, 0x17, 0xE1, 0x3D, 0xF6, 0x9A, 0x4B, 0xF7, 0xD8, 0xB3, 0xC6, 0xE3, 0xB1, 0xF6, 0xB0,
+    0x7A, 0xA3, 0xC2, 0xD1, 0xE1, 0x56, 0xFC, 0x56, 0x83, 0xEC, 0x17, 0xDC, 0xC4, 0xE0, 0x69, 0x38,
+    0xE1, 0x2E, 0xC9, 0xE1, 0x84, 0xCC, 0x81, 0x2E, 0xE3, 0x31, 0x2B, 0x7F, 0x97, 0x59, 0x99, 0x68,
+    0xD7, 0xCD, 0x4B, 0xDD, 0xC2, 0x60, 0x6E, 0x12, 0xAA, 0x8E, 0xD5, 0x4D, 0xC2, 0xBD, 0x2C, 0xB8,
+    0xC9, 0xDF, 0xB5, 0x92, 0xA3, 0x8B, 0xC7, 0x7B, 0x9F, 0x76, 0x4F, 0xDA, 0xBC, 0xFD, 0x0E, 0xB9,
+    0x66, 0x90, 0x2F, 0x66, 0x6B, 0x2F, 0x77, 0xBB, 0xC6, 0x6F, 0x5B, 0x41, 0x27, 0xA0, 0xA7, 0x4D,
+    0xEC, 0xDF, 0x2D, 0x4F, 0x6C, 0x67, 0x69, 0x62, 0xB3, 0xFA, 0x58, 0x8B, 0x02, 0xCC, 0xAB, 0x02,
+    0xCD, 0x37, 0x2A, 0x1A, 0x66, 0x45, 0xCB, 0xD4, 0x74, 0x9F, 0x83, 0xC7, 0x3D, 0x56, 0x9A, 0xF4,
+    0x43, 0xFD, 0x74, 0x7F, 0x66, 0x89, 0x9D, 0x64, 0xBA, 0x17, 0x53, 0x13, 0x7C, 0x4F, 0x73, 0xA4,
+    0xCA, 0xEA, 0x52, 0xBA, 0xF1, 0x9C, 0x09, 0x7D, 0x8E, 0xE0, 0x9E, 0x0C, 0x7B, 0x75, 0x19, 0x8E,
+    0x57, 0xA0, 0x6C, 0xFC, 0x1E, 0x52, 0x99, 0x0F, 0xC7, 0x26, 0xCC, 0x23, 0x70, 0xFD, 0x75, 0x93,
+    0xE2, 0xC7, 0x77, 0xBA, 0xB2, 0xF3, 0xAB, 0xBA, 0x1F, 0xFC, 0x13, 0xDE, 0xF2, 0xCF, 0x51, 0xCE,
+    0xAA, 0x97, 0x2B, 0xB2, 0x7C, 0x6D, 0x1F, 0x4E, 0xE6, 0x72, 0xE8, 0x6D, 0xB7, 0x30, 0x2C, 0xE3,
+    0xD7, 0xF9, 0x8C, 0x97, 0xE7, 0x53, 0x5E, 0xB6, 0x8A, 0x1A, 0x7B, 0x33, 0x5C, 0x70, 0xBC, 0x07,
+    0xDA, 0xBA, 0xD6, 0x12, 0xC3, 0xDF, 0x59, 0xBD, 0xF3, 0xC6, 0xF7, 0xDE, 0xD4, 0x9D, 0x51, 0x1F,
+    0x29, 0x51, 0x1E, 0x6A, 0x8E, 0x3D, 0xDA, 0x3C, 0x7D, 0xFB, 0x44, 0x34, 0xF2, 0x61, 0xF1, 0x7A,
+    0xBA, 0x78, 0x13, 0x92, 0x88, 0x76, 0xF1, 0x9E, 0x4C, 0x1F, 0xDF, 0xBF, 0xA7, 0xBA, 0xEA, 0x2B,
+    0xF7, 0x76, 0xB4, 0x48, 0x19, 0x2E, 0x6F, 0xA8, 0x3F, 0x1D, 0xFB, 0x40, 0x94, 0xE9, 0x14, 0xCA,
+    0x74, 0x2E, 0xE2, 0xB5, 0x67, 0x4E, 0x7A, 0x8F, 0xCC, 0x2A, 0xEB, 0x39, 0xE9, 0x5F, 0xCF, 0x34,
+    0x6D, 0x60, 0x66, 0x98, 0x92, 0x85, 0x5D, 0xB4, 0x24, 0xDE, 0x52, 0x20, 0x15, 0x47, 0x0B, 0xB7,
+    0xDA, 0x0B, 0xD3, 0x15, 0x62, 0x9B, 0xB2, 0xD2, 0xB2, 0x69, 0xEB, 0x60, 0x49, 0xBC, 0xC6, 0x7C,
+    0xFA, 0xB1, 0xF8, 0x6E, 0xB3, 0x53, 0x97, 0xB0, 0xA4, 0xC3, 0x9D, 0x1C, 0x9E, 0x64, 0xB2, 0xD4,
+    0x3B, 0xDB, 0x6D, 0xCB, 0x3B, 0x4A, 0xAE, 0xE7, 0x39, 0xC7, 0x05, 0x5C, 0x37, 0x1D, 0x88, 0x8A,
+    0x5F, 0x44, 0xF8, 0xAC, 0x6A, 0x78, 0x0B, 0xA6, 0x8E, 0x5C, 0x72, 0x7B, 0x95, 0x96, 0xC4, 0x0F,
+    0xE5, 0x0F, 0x01, 0x5F, 0x47, 0xAE, 0xE0, 0xB3, 0x2B, 0xD9, 0xEB, 0x63, 0x70, 0x98, 0x61, 0x9B,
+    0x17, 0xEA, 0x56, 0xE1, 0x21, 0x3B, 0x63, 0xDC, 0x07, 0x62, 0xA4, 0x95, 0xC5, 0x9B, 0x32, 0xDB,
+    0x9F, 0x3D, 0x28, 0x3B, 0xDE, 0xC4, 0x1F, 0xDE, 0xF2, 0xC7, 0xDE, 0xF0, 0x61, 0x30, 0xC2, 0xE4,
+    0x41, 0xD4, 0xFC, 0x1B, 0x76, 0x0E, 0xB6, 0x75, 0xDF, 0xE7, 0xED, 0x1C, 0x3C, 0x6C, 0xE0, 0xD1,
+    0x72, 0x48, 0xB6, 0x58, 0x65, 0x74, 0xDA, 0x69, 0x26, 0xAA, 0x69, 0x55, 0xB8, 0xC4, 0x9F, 0x23,
+    0x35, 0x87, 0x6D, 0xE0, 0x78, 0x9F, 0xD5, 0x9D, 0x8A, 0xC8, 0x7B, 0x74, 0x6A, 0xFC, 0x5D, 0x0C,
+    0xBC, 0x6D, 0xEC, 0x8D, 0x9E, 0x16, 0x01, 0x26, 0x61, 0xDD, 0xA5, 0x8F, 0xB1, 0xDA, 0xD0, 0x6B,
+    0x0B, 0xC9, 0xB0, 0xC7, 0xDA, 0x54, 0xF4, 0x15, 0x23, 0x4E, 0x1E, 0x69, 0xC1, 0x6E, 0x04, 0x80,
+    0x30, 0x7C, 0xD7, 0xD4, 0x9B, 0x6B, 0xD6, 0x73, 0x0D, 0x8E, 0x55, 0x82, 0x16, 0xFF, 0xE5, 0xA4,
+    0x2D, 0x86, 0x66, 0x6D, 0x97, 0x72, 0x3E, 0xF4, 0x9A, 0xCD, 0x77, 0x8A, 0xBC, 0x4E, 0x36, 0xE9,
+    0x3E, 0x92, 0x49, 0xDC, 0x8F, 0x93, 0xDE, 0xA7, 0x6D, 0xE2, 0xEE, 0x0D, 0xEE, 0x48, 0xFC, 0xEB,
+    0x09, 0x5E, 0x7D, 0x88, 0x69, 0xE9, 0x62, 0x72, 0x1A, 0x0F, 0x54, 0x19, 0x59, 0xD9, 0xE9, 0x6B,
+    0xF5, 0x75, 0xED, 0x2D, 0xDB, 0xBC, 0xAE, 0x0B, 0x8A, 0x6E, 0xD1, 0x5F, 0x20, 0x33, 0xAE, 0x0C,
+    0xCE, 0xA2, 0x50, 0x0F, 0x06, 0x04, 0xE1, 0xBE, 0x2F, 0x0B, 0xBB, 0x65, 0xA1, 0xB8, 0xD5, 0xF0,
+    0x34, 0xC3, 0x70, 0x1B, 0x66, 0xC5, 0x55, 0xA1, 0x17, 0x3B, 0xC8, 0xAE, 0x10, 0xE8, 0xCA, 0x80,
+    0xAE, 0x08, 0xE8, 0x4A, 0x80, 0xAE, 0x00, 0xE8, 0xCA, 0x7F, 0xAE, 0xF8, 0xE7, 0x4A, 0x7F, 0xAE,
+    0xF0, 0xA7, 0x65, 0x3F, 0xB3, 0x9B, 0xC2, 0x95, 0xFC, 0x5C, 0xC1, 0xCF, 0x95, 0xFB, 0x5C, 0xB1,
+    0xCF, 0x95, 0xFA, 0x5C, 0xA1, 0xCF, 0x95, 0xF9, 0x5C, 0x0D, 0x8E, 0x0C, 0x2B, 0xC4, 0xCB, 0x41,
+    0xB2, 0x9A, 0x4A, 0xD9, 0xBA, 0xFD, 0x5F, 0x27, 0x12, 0xFF, 0x20, 0x6F, 0x9A, 0x17, 0x13, 0xAB,
+    0x0D, 0xD8, 0xB2, 0xFA, 0xED, 0xDD, 0x46, 0x30, 0x05, 0xFF, 0x4B, 0x58, 0x98, 0x6E, 0x65, 0xD6,
+    0x8D, 0xCC, 0xBA, 0x8D, 0x59, 0x37, 0x31, 0xEB, 0x16, 0x66, 0x96, 0xA2, 0x9A, 0x7D, 0x84, 0x51,
+    0xA1, 0x5B, 0x97, 0x75, 0xE3, 0xB2, 0xEE, 0x57, 0xB6, 0x81, 0x15, 0x29, 0x71, 0x25, 0x29, 0x58,
+    0xFD, 0xFF, 0x00, 0x7D, 0x55, 0x3D, 0x6C, 0xDB, 0x46, 0x14, 0xFE, 0x28, 0xCA, 0xA2, 0x63, 0x5A,
+    0xA2, 0xDA, 0x48, 0x41, 0x1A, 0xCB, 0xA2, 0x07, 0x0F, 0xAA, 0x23, 0x4B, 0x1A, 0x34, 0x28, 0x81,
+    0x2C, 0xDE, 0xD0, 0xA9, 0x93, 0x80, 0xDA, 0x5D, 0x52, 0xA0, 0x1A, 0xFB, 0x8B, 0x70, 0xD0, 0x90,
+    0x04, 0xB6, 0x75, 0xE8, 0xD2, 0xA1, 0x43, 0x55, 0xA0, 0xE9, 0xAC, 0xA1, 0x43, 0xAB, 0x36, 0xA8,
+    0x06, 0xA3, 0x40, 0x00, 0xBB, 0xBA, 0x6E, 0x45, 0xBA, 0x70, 0xCF, 0xC2, 0xF4, 0x67, 0xE7, 0xA0,
+    0x41, 0x2D, 0x6C, 0xB1, 0xDF, 0x51, 0x4E, 0x7F, 0x80, 0xA0, 0x67, 0xF1, 0xCC, 0x7B, 0xF7, 0xFE,
+    0xDF, 0xF7, 0x1E, 0x0B, 0xF0, 0xE0, 0x0A, 0x5B, 0xA6, 0x14, 0x84, 0xD1, 0xB5, 0x22, 0x47, 0xD5,
+    0xD0, 0x87, 0x00, 0x0A, 0x40, 0x8C, 0x54, 0x0C, 0xFB, 0x13, 0xB9, 0x9B, 0x0A, 0xF2, 0xFA, 0x16,
+    0xF6, 0x79, 0xAE, 0x36, 0x3D, 0x6D, 0xBA, 0x11, 0x0C, 0x51, 0x3C, 0xE8, 0x7A, 0x71, 0x58, 0x3C,
+    0xF8, 0xE7, 0x65, 0xCB, 0x90, 0x2D, 0x53, 0xD6, 0xA7, 0x70, 0xCE, 0xA1, 0x35, 0x1C, 0x2D, 0xCE,
+    0x0A, 0x95, 0x8C, 0x38, 0x75, 0xD4, 0xA9, 0x23, 0xB7, 0x33, 0xA8, 0x07, 0x7F, 0x46, 0xE2, 0xC4,
+    0x88, 0x5C, 0x59, 0x45, 0x05, 0x6B, 0xC3, 0xE3, 0x59, 0xD4, 0x0E, 0xAB, 0x51, 0xDB, 0x9B, 0x65,
+    0x04, 0xBA, 0x45, 0x33, 0x3A, 0xB3, 0x7F, 0x9C, 0xB9, 0x66, 0xD0, 0x72, 0x90, 0x4F, 0x83, 0x16,
+    0xDB, 0xA6, 0x72, 0x5D, 0xAD, 0xCD, 0x9A, 0xD1, 0x20, 0xD0, 0x6A, 0xF5, 0x27, 0x3D, 0x20, 0x9B,
+    0x2B, 0x65, 0xAB, 0xA5, 0x76, 0x75, 0x7B, 0x7B, 0x7F, 0x05, 0x47, 0xAE, 0xAC, 0xDB, 0xCA, 0xF9,
+    0x28, 0x34, 0xD5, 0x09, 0x44, 0x1E, 0x43, 0xA4, 0x22, 0x98, 0x11, 0xB6, 0x3E, 0x93, 0x4D, 0x4B,
+    0x7A, 0x89, 0x33, 0x5A, 0xF6, 0x6B, 0x58, 0xB1, 0x70, 0xEF, 0xA8, 0xB6, 0xA1, 0xA8, 0x19, 0x43,
+    0x6B, 0xB8, 0x89, 0x16, 0x0E, 0x31, 0xC5, 0x40, 0x78, 0x00, 0x2C, 0xE9, 0x44, 0x4E, 0x44, 0xC1,
+    0x30, 0xA5, 0x6C, 0xD1, 0x22, 0xA5, 0x8C, 0x81, 0x9C, 0x8A, 0x0B, 0x44, 0x98, 0x90, 0xD3, 0x81,
+    0xF1, 0x02, 0x9E, 0x42, 0x92, 0x3D, 0x4B, 0xA5, 0x02, 0xEA, 0xEC, 0x9A, 0x91, 0xAD, 0x5C, 0x68,
+    0x3A, 0x7C, 0x4C, 0xBC, 0xF0, 0x5A, 0x60, 0x28, 0xBA, 0x8B, 0x4D, 0xD4, 0xA3, 0xBD, 0x6E, 0x42,
+    0xC7, 0xE0, 0xBC, 0x78, 0x48, 0x96, 0xA6, 0xE6, 0x40, 0xD7, 0x80, 0xA3, 0x9C, 0xC0, 0x24, 0x9F,
+    0x95, 0xE8, 0x33, 0x50, 0xC7, 0x7D, 0x5A, 0x8C, 0x70, 0x8A, 0x2A, 0xFD, 0x36, 0xA5, 0x29, 0x6F,
+    0x86, 0x83, 0xA8, 0xD8, 0x9D, 0x46, 0x39, 0x6A, 0x5A, 0x87, 0xA1, 0x52, 0xCA, 0x9B, 0xDF, 0xFC,
+    0xCD, 0x42, 0x86, 0xFC, 0xD3, 0x79, 0xB1, 0xBB, 0xB4, 0x46, 0x91, 0xF0, 0x9B, 0x20, 0x96, 0xEF,
+    0xF2, 0x58, 0xA2, 0x6C, 0x9B, 0x46, 0x3A, 0x23, 0x2F, 0x5C, 0x93, 0xE9, 0xCE, 0xE0, 0x18, 0xAC,
+    0xC3, 0xB1, 0xA3, 0x8E, 0x1C, 0x55, 0x48, 0x61, 0x4D, 0xFE, 0x27, 0xF3, 0x60, 0xFA, 0xA0, 0x93,
+    0x91, 0x67, 0xD5, 0x52, 0x8A, 0xE1, 0x9D, 0x33, 0x2F, 0xA7, 0xEF, 0xCF, 0xA6, 0xD2, 0x08, 0x1D,
+    0x51, 0xC3, 0x1E, 0x3A, 0xA8, 0x9F, 0xDB, 0x33, 0x54, 0x5B, 0xCD, 0x7E, 0xCF, 0x8D, 0x63, 0xD4,
+    0xF9, 0xB4, 0x99, 0xA0, 0x26, 0x5D, 0xDA, 0xC2, 0xAA, 0x8E, 0x6B, 0x14, 0x8C, 0x9E, 0x3D, 0x53,
+    0xD3, 0x81, 0x2C, 0x24, 0xA5, 0x6B, 0x59, 0xB2, 0x56, 0xD3, 0xB9, 0xB7, 0xA3, 0x24, 0xFD, 0x44,
+    0xD3, 0x02, 0x66, 0x0C, 0xE7, 0x53, 0xB1, 0x67, 0xEA, 0x0A, 0xF4, 0x0C, 0xD9, 0xB7, 0x04, 0xEB,
+    0xE3, 0xCE, 0x35, 0x83, 0xF1, 0x25, 0x9C, 0x05, 0x3A, 0x6F, 0xC3, 0x37, 0x25, 0xB3, 0x40, 0x8A,
+    0x3B, 0xAB, 0x3E, 0x58, 0x9C, 0x30, 0x02, 0x1E, 0x09, 0xAE, 0x69, 0x2C, 0x0F, 0x0E, 0xB0, 0x33,
+    0x1E, 0xCB, 0x41, 0x1C, 0x2B, 0x5C, 0x2E, 0x3A, 0x13, 0xAD, 0x8D, 0xC7, 0x43, 0xFD, 0xAE, 0xEF,
+    0x3C, 0xDE, 0x51, 0xD6, 0x99, 0x67, 0x3B, 0xF1, 0xA9, 0x5F, 0xA7, 0x6D, 0x7D, 0xE3, 0xC5, 0x17,
+    0x3B, 0xE3, 0xAF, 0x12, 0x81, 0x69, 0x1C, 0xC7, 0xB3, 0x31, 0xD7, 0x28, 0x39, 0x1E, 0x6A, 0x68,
+    0x79, 0x22, 0x35, 0x47, 0x5D, 0x2E, 0x0B, 0xF7, 0xF7, 0xA2, 0x1F, 0x60, 0xD5, 0xB9, 0x36, 0xF5,
+    0xD6, 0xD6, 0xDB, 0x89, 0x2E, 0x51, 0xA8, 0x2F, 0xB5, 0x07, 0xB6, 0x78, 0xCE, 0x51, 0xD5, 0xDB,
+    0x3D, 0xBD, 0x45, 0x7C, 0x08, 0x86, 0x17, 0x8B, 0x4F, 0xFE, 0x4F, 0xFC, 0xDF, 0xD6, 0x77, 0x49,
+    0xB7, 0x84, 0x8D, 0x63, 0x5A, 0x2C, 0xC1, 0x22, 0x83, 0xCD, 0x2A, 0xD4, 0x74, 0x20, 0xD0, 0x91,
+    0xDC, 0x18, 0x8F, 0x51, 0x1B, 0x7F, 0x47, 0x19, 0x9B, 0x35, 0xC8, 0xE1, 0xF6, 0xF8, 0x11, 0xDE,
+    0x5B, 0x46, 0xE8, 0xFE, 0x1C, 0xDC, 0x7A, 0x3C, 0xF1, 0x7D, 0x9F, 0x55, 0x58, 0xCD, 0x97, 0x23,
+    0x47, 0xD6, 0x55, 0x53, 0x9B, 0x13, 0xB6, 0xAA, 0x25, 0x4A, 0x9C, 0xE4, 0xEF, 0x94, 0xA4, 0x95,
+    0x83, 0x83, 0xAE, 0xCE, 0x20, 0xFF, 0x8B, 0x65, 0x9E, 0x62, 0xA5, 0x9F, 0x04, 0xD5, 0x58, 0xCE,
+    0x04, 0xEC, 0x1B, 0x73, 0x93, 0x30, 0xD8, 0xD5, 0xF0, 0x20, 0xD6, 0xEC, 0x0B, 0x1B, 0xE5, 0xE9,
+    0x23, 0xB4, 0x9C, 0x19, 0x92, 0x2E, 0xDF, 0x1B, 0x94, 0x4B, 0xCC, 0xCB, 0x8A, 0x0E, 0x46, 0xE1,
+    0x15, 0xF7, 0x75, 0x78, 0x75, 0x0F, 0x9D, 0xB6, 0x87, 0xEB, 0xAD, 0x2B, 0x49, 0x34, 0x1D, 0x1C,
+    0xD1, 0xDC, 0x54, 0xBC, 0x0A, 0x87, 0xB8, 0xD1, 0xF8, 0xD1, 0xF1, 0xB5, 0xE8, 0xB7, 0xC6, 0x0E,
+    0x69, 0x91, 0x7E, 0xB0, 0x74, 0x48, 0xD0, 0x81, 0xA0, 0x98, 0x38, 0xD4, 0x6A, 0xF7, 0x5B, 0x7E,
+    0x7F, 0xE2, 0x0F, 0x7B, 0x03, 0x35, 0x50, 0xBA, 0x15, 0x52, 0x89, 0xBE, 0x37, 0xA4, 0x1D, 0xDB,
+    0xE5, 0xE9, 0xB7, 0x4D, 0x6F, 0x86, 0x51, 0xE2, 0x78, 0x0E, 0xEC, 0x1B, 0xFE, 0x34, 0x6C, 0x2E,
+    0x4A, 0xB7, 0xE3, 0x79, 0x6F, 0x23, 0x00, 0x27, 0xC5, 0x2C, 0xF9, 0x71, 0x3D, 0x66, 0x2B, 0xC5,
+    0x4F, 0x45, 0x6E, 0x63, 0xC1, 0xC3, 0x3E, 0x38, 0xCA, 0x08, 0xB7, 0x1C, 0x76, 0xA7, 0xE7, 0xC8,
+    0x67, 0x88, 0xB0, 0x34, 0xCA, 0x77, 0x30, 0x88, 0xA5, 0xB7, 0xC0, 0xF5, 0xEB, 0x97, 0xF5, 0x57,
+    0x6E, 0x68, 0x4B, 0x47, 0xE8, 0x64, 0x0D, 0x94, 0xA7, 0xBC, 0x60, 0xB9, 0xFB, 0xFA, 0x92, 0x3B,
+    0x03, 0x0E, 0x7A, 0x78, 0xD2, 0xE0, 0xC4, 0x59, 0x15, 0x2F, 0x93, 0xB6, 0x0E, 0x93, 0x7B, 0x4F,
+    0x67, 0xA9, 0xC7, 0x7D, 0x34, 0xBC, 0xE4, 0x24, 0x1A, 0x1A, 0x81, 0x4F, 0x3F, 0xF3, 0x81, 0xAF,
+    0x6F, 0x13, 0xCF, 0x08, 0xBF, 0x55, 0xE8, 0x70, 0xD6, 0xC5, 0x55, 0x60, 0xCB, 0x78, 0xD2, 0x84,
+    0x5C, 0xEA, 0x5C, 0x4A, 0x3D, 0x90, 0x3B, 0x72, 0x87, 0x16, 0x07, 0x81, 0x17, 0x08, 0xA2, 0xA0,
+    0x2E, 0xAD, 0xD0, 0x13, 0x3A, 0x98, 0x8C, 0xA8, 0x73, 0x54, 0xF8, 0xCC, 0xDF, 0x2E, 0xD2, 0xBA,
+    0x6F, 0xEC, 0x18, 0xB5, 0x3B, 0xB2, 0x95, 0x52, 0x2F, 0x85, 0xC2, 0x4C, 0x66, 0x1F, 0xCB, 0x92,
+    0x17, 0xF7, 0xC3, 0xBA, 0x72, 0xE5, 0x71, 0xB8, 0x35, 0xC4, 0x56, 0x26, 0x9A, 0x8A, 0xA9, 0xD8,
+    0x08, 0xE1, 0x0F, 0xF1, 0x03, 0xDC, 0xC8, 0x8E, 0x8E, 0xC5, 0x88, 0x7E, 0x0E, 0xCF, 0x10, 0xB9,
+    0xBF, 0xCC, 0xEC, 0x5F, 0xE7, 0xC7, 0xD6, 0x07, 0x23, 0x27, 0xB7, 0xCA, 0xB2, 0x5B, 0xC2, 0x14,
+    0x1A, 0x6D, 0x2C, 0x37, 0x33, 0xEA, 0x71, 0x38, 0xA6, 0xF9, 0x56, 0x0C, 0xF6, 0x7E, 0xB2, 0x2F,
+    0x06, 0xE1, 0xD5, 0x43, 0xEB, 0x35, 0x82, 0xE0, 0xE3, 0xA0, 0xB3, 0x38, 0xE9, 0x73, 0x1E, 0x37,
+    0x5B, 0x7B, 0x67, 0x27, 0xCE, 0xD3, 0xB0, 0x44, 0x7F, 0xBC, 0x68, 0x27, 0x44, 0x00, 0x99, 0xA4,
+    0x2F, 0x9F, 0xC4, 0x11, 0xB6, 0x97, 0xA3, 0x75, 0x08, 0xE3, 0x0C, 0x06, 0x7B, 0x8F, 0xE8, 0xDF,
+    0x88, 0xFF, 0x48, 0x90, 0xC4, 0x5C, 0xF5, 0x75, 0x43, 0x10, 0x96, 0xD0, 0x70, 0xFB, 0x1D, 0xD7,
+    0xCE, 0x93, 0x06, 0x65, 0x37, 0xAF, 0x8C, 0x3F, 0xA7, 0xCD, 0x03, 0xE2, 0x93, 0xDD, 0x1E, 0x47,
+    0xFA, 0x4D, 0xDC, 0xD0, 0x5D, 0xEB, 0xC5, 0x97, 0x50, 0xE1, 0xB5, 0xD0, 0xF3, 0x32, 0xA5, 0xF9,
+    0x73, 0x70, 0x1E, 0xDE, 0x8D, 0xBF, 0xD0, 0x33, 0x13, 0x77, 0x69, 0x23, 0x9F, 0x8C, 0x66, 0xCD,
+    0xB3, 0x0F, 0x6D, 0x90, 0x24, 0x63, 0xF1, 0xF0, 0xCD, 0x05, 0x6C, 0xEA, 0xB6, 0xD4, 0x6E, 0xE2,
+    0x5A, 0x4F, 0xEF, 0x0D, 0xBD, 0x09, 0xAD, 0x5F, 0x25, 0xAA, 0xF5, 0xA6, 0xDB, 0x77, 0x89, 0x34,
+    0x02, 0x25, 0x57, 0xAD, 0x54, 0x1A, 0x4D, 0xF6, 0xD3, 0xA4, 0xC3, 0x0E, 0x35, 0x44, 0x69, 0xD4,
+    0x18, 0x7D, 0x2F, 0x43, 0x16, 0xB0, 0xC3, 0x40, 0xAF, 0xA4, 0x0B, 0xD5, 0x4A, 0xB3, 0xD9, 0xB8,
+    0x45, 0xCE, 0x6C, 0xA5, 0x52, 0x6A, 0x94, 0xFC, 0x4A, 0xA3, 0x51, 0xE6, 0x4D, 0x21, 0x5D, 0x2A,
+    0x95, 0x2A, 0xFA, 0xAE, 0xF1, 0x5C, 0xD2, 0x6F, 0xE4, 0x27, 0x08, 0x39, 0x05, 0x6A, 0x32, 0xF9,
+    0xBC, 0x64, 0x8D, 0xB7, 0xFE, 0xAB, 0xBD, 0xAC, 0x27, 0x7C, 0x37, 0xFB, 0xCE, 0xA5, 0x5C, 0xC3,
+    0x27, 0xAD, 0x90, 0xEF, 0x6E, 0x7E, 0x78, 0xAF, 0x44, 0xBE, 0x25, 0xAD, 0x41, 0xE6, 0xE4, 0xCB,
+    0xD3, 0xDD, 0xF1, 0xAB, 0x4C, 0x7A, 0x83, 0x50, 0xE8, 0x11, 0x4B, 0xBB, 0xB8, 0xC5, 0x51, 0xA0,
+    0x4F, 0x23, 0x7E, 0x41, 0x98, 0x7F, 0x54, 0xAB, 0xA5, 0xF5, 0xF5, 0x42, 0x76, 0x2B, 0x2B, 0x6D,
+    0x9E, 0xD3, 0xE9, 0xDC, 0xB6, 0xD5, 0x35, 0x65, 0x46, 0xAD, 0x06, 0x7E, 0xFF, 0x2F, 0xDD, 0x7D,
+    0x5B, 0x8C, 0x1C, 0xD7, 0x99, 0xDE, 0xA9, 0x2A, 0x72, 0x4A, 0x66, 0x45, 0x2C, 0x2E, 0x2C, 0x9B,
+    0xB4, 0x46, 0x64, 0xE9, 0x41, 0x8B, 0x38, 0x0C, 0xA9, 0xF2, 0x03, 0x03, 0x70, 0xB3, 0x33, 0x53,
+    0x25, 0x0B, 0x58, 0x3D, 0x18, 0x89, 0xF9, 0x20, 0x5A, 0x0F, 0x42, 0x56, 0x7A, 0xD8, 0x05, 0x12,
+    0x7B, 0x37, 0x43, 0x20, 0x4C, 0x42, 0x04, 0x9C, 0xEE, 0x92, 0x05, 0x44, 0x40, 0xF4, 0xE0, 0x31,
+    0xB0, 0xB6, 0x80, 0x18, 0x81, 0xF8, 0xA0, 0x07, 0x69, 0xE8, 0x78, 0x88, 0x2C, 0x17, 0xE0, 0x43,
+    0xF7, 0x74, 0x49, 0x04, 0xE2, 0x07, 0x01, 0x51, 0xF9, 0x22, 0xE7, 0x21, 0xC0, 0xAA, 0xE3, 0x95,
+    0x6C, 0x2C, 0x09, 0x5B, 0x25, 0xBB, 0xB5, 0xAE, 0x19, 0x75, 0x77, 0xE5, 0xFF, 0xBE, 0xFF, 0x54,
+    0x77, 0xCF, 0x70, 0x44, 0xDD, 0x28, 0x4A, 0xCE, 0x90, 0x7D, 0x6A, 0x6E, 0x5D, 0x75, 0xCE, 0x7F,
+    0xFE, 0xCB, 0xF7, 0xDF, 0xCE, 0x18, 0xB3, 0xD7, 0xC8, 0x47, 0x98, 0xCB, 0xE0, 0x17, 0x32, 0x38,
+    0x25, 0xBE, 0x3E, 0x8B, 0xE1, 0x80, 0xD1, 0x8F, 0xA4, 0xAE, 0x47, 0x66, 0x1E, 0x83, 0x57, 0x9A,
+    0x05, 0x0C, 0xC7, 0x8C, 0xDF, 0x97, 0xCF, 0x82, 0x42, 0x7E, 0x27, 0xC8, 0x9B, 0xF7, 0x73, 0x88,
+    0xAE, 0xBD, 0x60, 0x4C, 0x2C, 0xBF, 0x6B, 0x12, 0xBE, 0x17, 0xC3, 0x12, 0x86, 0x16, 0x86, 0x2E,
+    0x86, 0xA1, 0x71, 0x72, 0x19, 0xBC, 0xDC, 0xA9, 0x4C, 0x90, 0xF9, 0xE3, 0xB5, 0x5E, 0xDA, 0xAE,
+    0xEB, 0x5A, 0x7E, 0x72, 0x87, 0x59, 0x95, 0xB7, 0xC8, 0x03, 0x74, 0xF8, 0x82, 0xB3, 0x6A, 0xA6,
+    0x1F, 0xB7, 0x6B, 0x1A, 0x91, 0x0C, 0xA5, 0x3C, 0xAC, 0xEE, 0x2F, 0xB8, 0x03, 0xB7, 0x7F, 0xC2,
+    0x2D, 0x9D, 0xE2, 0x8C, 0x57, 0x3A, 0xF9, 0xE3, 0x32, 0x64, 0x78, 0xA4, 0xC1, 0x23, 0xE5, 0x41,
+    0x2F, 0x3E, 0x2C, 0x43, 0x5D, 0x17, 0x26, 0xDC, 0x5A, 0x1E, 0x98, 0x28, 0x73, 0x87, 0x26, 0x4E,
+    0xCD, 0x18, 0x4F, 0xDB, 0xC0, 0xD0, 0xC2, 0xD3, 0x36, 0xF0, 0xB4, 0x91, 0xE9, 0xE0, 0x81, 0xF2,
+    0xB4, 0xD2, 0x1F, 0xA7, 0xCB, 0x45, 0xBB, 0xEE, 0x8F, 0x30, 0x07, 0x27, 0x6D, 0x26, 0xCC, 0x19,
+    0x76, 0xF0, 0xAD, 0xBE, 0xD9, 0xBE, 0xE8, 0x21, 0x16, 0x8D, 0x77, 0x9A, 0xF3, 0x18, 0x4E, 0x62,
+    0x06, 0x27, 0x30, 0x83, 0x7B, 0x6F, 0x58, 0x74, 0x26, 0x43, 0x9C, 0x9A, 0x9B, 0x2E, 0xDA, 0x0E,
+    0xB2, 0x68, 0xD9, 0x71, 0x4C, 0x42, 0xE6, 0x32, 0x79, 0xDC, 0xF2, 0x58, 0xBE, 0xB9, 0xB9, 0x5C,
+    0xC8, 0xAD, 0x82, 0x52, 0xDE, 0x26, 0x2B, 0x96, 0x27, 0x17, 0xD8, 0x0C, 0x13, 0xE0, 0xD7, 0x42,
+    0x2C, 0x3C, 0xC2, 0xC3, 0xE2, 0x57, 0x4F, 0x73, 0x7A, 0xA9, 0x49, 0xB6, 0x3F, 0x71, 0x66, 0x48,
+    0xF5, 0x97, 0x0F, 0x99, 0xB0, 0x34, 0x97, 0x8D, 0x57, 0xAF, 0xCB, 0x2D, 0x7A, 0xF2, 0x0E, 0x5D,
+    0x37, 0x3E, 0x5C, 0x79, 0x78, 0xF4, 0xB3, 0xA1, 0x4C, 0x73, 0x43, 0x56, 0xBF, 0x24, 0x53, 0x5B,
+    0xE0, 0xF4, 0xF0, 0x1A, 0x63, 0x72, 0xB2, 0xA4, 0x58, 0x9E, 0x1E, 0xC8, 0x4C, 0x1D, 0xBC, 0x33,
+    0x91, 0x67, 0x87, 0x72, 0x1B, 0xBF, 0x3C, 0x24, 0xB3, 0x03, 0x45, 0x56, 0x84, 0x20, 0x89, 0x10,
+    0x20, 0xFE, 0x51, 0xDB, 0xF8, 0xB5, 0x2C, 0x6B, 0x2F, 0xE9, 0x96, 0x9B, 0xF9, 0x71, 0x6A, 0xBC,
+    0x81, 0x01, 0xD1, 0xB8, 0x6B, 0xD8, 0x34, 0x50, 0x2C, 0xB4, 0x2F, 0x90, 0x0B, 0xD4, 0x4A, 0xEC,
+    0x7C, 0x97, 0x2C, 0xA5, 0xBA, 0xF6, 0xF9, 0x43, 0xA5, 0x12, 0x88, 0xD4, 0x96, 0xDB, 0x99, 0x39,
+    0xE1, 0xCE, 0xF0, 0x9B, 0xA5, 0x09, 0x9F, 0x2C, 0xCD, 0xBE, 0x19, 0xD6, 0xFC, 0x38, 0x9E, 0x65,
+    0x28, 0x0F, 0xCB, 0x9B, 0x0D, 0xC9, 0x77, 0xEC, 0x6F, 0xBC, 0x9D, 0xD0, 0xBB, 0xEC, 0xAF, 0xA9,
+    0x9A, 0x4D, 0x76, 0x65, 0x5A, 0x9C, 0x97, 0x0E, 0x53, 0xFE, 0xDD, 0xC9, 0x3D, 0x93, 0x6D, 0xC4,
+    0x9D, 0x3E, 0x8F, 0xB7, 0xB6, 0x75, 0x91, 0xB5, 0x4A, 0xA7, 0x59, 0xAE, 0xEB, 0x4D, 0x6A, 0x0B,
+    0x9D, 0x13, 0xAE, 0x78, 0xA3, 0x39, 0xA2, 0x33, 0x33, 0xC7, 0x75, 0x72, 0xB2, 0x85, 0x9C, 0x9F,
+    0x5C, 0x79, 0x3B, 0x73, 0xCE, 0x24, 0x6B, 0xF8, 0xC1, 0x65, 0x59, 0x1B, 0x6E, 0x5B, 0x9A, 0xAE,
+    0x83, 0xCD, 0xED, 0xCB, 0x4C, 0xE5, 0x37, 0xDC, 0xC2, 0x50, 0x70, 0x3C, 0x88, 0x63, 0x2C, 0x12,
+    0x96, 0xC9, 0xBC, 0xE5, 0x1A, 0xA6, 0x32, 0x75, 0xE1, 0xA1, 0x08, 0x13, 0x97, 0xDF, 0x5B, 0xC1,
+    0x75, 0x6C, 0xFE, 0xE9, 0x50, 0xD6, 0xE0, 0xC9, 0x3B, 0x4B, 0x13, 0x6D, 0xF5, 0xFA, 0xC2, 0x11,
+    0x4E, 0x5D, 0xCB, 0xED, 0xF6, 0xCC, 0xEC, 0x07, 0x69, 0x28, 0x7B, 0xF2, 0xD8, 0x48, 0x9E, 0x2B,
+    0xFB, 0xE2, 0xDB, 0xE5, 0x73, 0xF1, 0x32, 0xE8, 0xFA, 0x0B, 0x9D, 0xBF, 0xD0, 0xA1, 0xA1, 0x42,
+    0x98, 0xE9, 0x95, 0xEB, 0x81, 0x22, 0x80, 0x6C, 0xC4, 0x6B, 0x6B, 0xBD, 0x8B, 0x63, 0xD2, 0x26,
+    0xC1, 0x7C, 0x28, 0xD9, 0xC2, 0xD6, 0x4B, 0xA0, 0x94, 0xFC, 0x72, 0x0B, 0x82, 0x2B, 0xD7, 0x2E,
+    0x28, 0x1F, 0x62, 0x11, 0xBA, 0x8E, 0x21, 0xE8, 0x9F, 0x60, 0x70, 0x07, 0xCE, 0x08, 0x7B, 0x3B,
+    0xBF, 0xB5, 0x3E, 0xC0, 0xFE, 0xCA, 0x7C, 0x53, 0xD5, 0x33, 0x86, 0x8A, 0xC6, 0x50, 0xD3, 0x18,
+    0xAA, 0x1A, 0x43, 0x5D, 0x63, 0x54, 0xD9, 0xE8, 0x84, 0x75, 0xBA, 0xAA, 0x6F, 0x54, 0xE1, 0x88,
+    0xC6, 0x59, 0x2F, 0xC1, 0x10, 0x6E, 0x45, 0x8E, 0x18, 0x72, 0x76, 0x93, 0xB1, 0xC5, 0x9D, 0xEF,
+    0x72, 0xEB, 0x3B, 0xDC, 0x76, 0xEA, 0x0F, 0x51, 0x3D, 0xDE, 0x26, 0xE4, 0xDD, 0xAF, 0xB9, 0x4F,
+    0x0F, 0x9B, 0x86, 0x3D, 0x54, 0xF7, 0x0B, 0xC5, 0x75, 0xDB, 0x66, 0xB5, 0x3F, 0xE9, 0xD9, 0x1B,
+    0x80, 0x9A, 0xED, 0x3E, 0x68, 0xB9, 0x44, 0x4A, 0x5E, 0xC1, 0xDC, 0x5C, 0x72, 0x7A, 0x90, 0x81,
+    0x86, 0xF7, 0x93, 0x72, 0xE7, 0x38, 0x4F, 0x4C, 0x3A, 0xBA, 0x4E, 0x2D, 0x41, 0xE5, 0x92, 0x90,
+    0xFE, 0x89, 0x87, 0xCD, 0x5F, 0x72, 0x86, 0xE4, 0xD8, 0x0D, 0x32, 0x1A, 0x54, 0x84, 0x10, 0x2B,
+    0x27, 0xE9, 0x0A, 0x4C, 0x5B, 0xF4, 0x8E, 0x50, 0xCA, 0x1B, 0x51, 0x0E, 0x7A, 0x93, 0x69, 0x5A,
+    0xAE, 0xB6, 0x0A, 0x0D, 0xBC, 0xC7, 0x0F, 0x3F, 0x33, 0x3B, 0x3F, 0x64, 0xBA, 0x91, 0x10, 0x56,
+    0xE6, 0x7B, 0xB0, 0x3E, 0x45, 0xA1, 0x1C, 0x72, 0xC6, 0x94, 0x2F, 0xAE, 0x80, 0x3B, 0x5F, 0x72,
+    0xE3, 0xDB, 0x25, 0x66, 0xED, 0xFC, 0xB2, 0x8F, 0x4B, 0xF0, 0x54, 0x1F, 0x34, 0xBD, 0x1F, 0xE4,
+    0x8E, 0xD3, 0xCB, 0x60, 0x8A, 0xC4, 0x2B, 0x78, 0x09, 0xC9, 0x12, 0x4B, 0x0B, 0x94, 0x12, 0x79,
+    0x13, 0x18, 0xBD, 0x97, 0x91, 0xBF, 0x95, 0x33, 0x94, 0xEC, 0x96, 0xEE, 0x58, 0xC1, 0x9C, 0xD0,
+    0x58, 0x96, 0x40, 0x02, 0x38, 0x99, 0x0B, 0x12, 0x07, 0x32, 0xBC, 0x7D, 0x5E, 0x95, 0x9E, 0x31,
+    0x9F, 0xB3, 0xF3, 0x6D, 0xD7, 0x59, 0x32, 0x8A, 0x37, 0x4D, 0x34, 0xC0, 0xD2, 0x73, 0x21, 0x55,
+    0x90, 0xCA, 0x74, 0xF7, 0x63, 0x67, 0x16, 0x70, 0xC3, 0xB3, 0xB8, 0x39, 0xF6, 0x50, 0x04, 0xC5,
+    0x74, 0x3D, 0x99, 0x47, 0x2B, 0xC0, 0x3A, 0xEF, 0x04, 0x7D, 0xB1, 0x59, 0x11, 0xA8, 0x1B, 0xF6,
+    0x1B, 0x41, 0x0E, 0xA8, 0x76, 0xF1, 0x04, 0xD8, 0x93, 0x04, 0xFB, 0x9B, 0x60, 0x7B, 0xF7, 0x34,
+    0xE4, 0x49, 0x84, 0x83, 0x84, 0x3C, 0xD4, 0x59, 0x65, 0xA3, 0xB6, 0xAC, 0xE6, 0xC2, 0x45, 0xD6,
+    0x4F, 0x1D, 0x96, 0x93, 0xF1, 0xC2, 0xBC, 0xD1, 0x62, 0x56, 0x91, 0x85, 0xAA, 0xCB, 0x22, 0x55,
+    0x67, 0x56, 0xAB, 0x59, 0xA5, 0x96, 0xA8, 0x36, 0xB2, 0xAA, 0xCD, 0x6A, 0xB7, 0x8E, 0x5E, 0xAC,
+    0x8E, 0x93, 0x8B, 0x18, 0xDB, 0x35, 0x6A, 0x3A, 0xF9, 0xC0, 0x8C, 0x7B, 0xB9, 0x99, 0xE8, 0x32,
+    0x63, 0x16, 0x8D, 0x99, 0xB2, 0xA1, 0xD8, 0x3B, 0x7E, 0xDC, 0x6B, 0xA9, 0x15, 0x99, 0x89, 0x65,
+    0xA1, 0x71, 0x30, 0xE6, 0x4D, 0x8C, 0xEE, 0x2B, 0xB8, 0x85, 0xF7, 0x2D, 0xCA, 0x31, 0x15, 0xDB,
+    0x11, 0x0A, 0xCD, 0x02, 0x19, 0xFB, 0x32, 0xC5, 0xA8, 0xC4, 0xDA, 0xDC, 0x9C, 0x0B, 0x7D, 0xF5,
+    0x91, 0x92, 0xA2, 0x34, 0x80, 0xF6, 0x82, 0x08, 0x90, 0xD2, 0xA2, 0xA1, 0x30, 0xAA, 0xBC, 0x14,
+    0x18, 0xE7, 0x45, 0x77, 0x8C, 0x4D, 0x6F, 0x4C, 0x25, 0x2F, 0xB2, 0x5A, 0xC1, 0x18, 0x57, 0xA0,
+    0xD2, 0x65, 0x0C, 0x67, 0x41, 0xA8, 0x4B, 0xBB, 0x23, 0x10, 0xDC, 0x3B, 0xFE, 0x6E, 0x8D, 0x65,
+    0x09, 0x7F, 0x27, 0x60, 0xEF, 0x04, 0xBF, 0xD9, 0xC2, 0xD0, 0xC5, 0x97, 0x56, 0x5B, 0xC4, 0xD0,
+    0x77, 0xB5, 0x3C, 0x67, 0xBD, 0x02, 0x49, 0x32, 0xEC, 0x91, 0xE8, 0xD9, 0x79, 0x08, 0xBA, 0xE0,
+    0x05, 0x6C, 0x8D, 0x88, 0xB9, 0xDF, 0x17, 0xC1, 0x09, 0x0A, 0x48, 0x48, 0x2E, 0x13, 0x0E, 0xB1,
+    0x8E, 0x30, 0x17, 0x35, 0x14, 0x5D, 0x1F, 0x4F, 0xA0, 0x0E, 0x1F, 0x14, 0xE0, 0x41, 0x3E, 0xCC,
+    0xB7, 0x0C, 0x5D, 0xCC, 0x70, 0x08, 0xE3, 0x8D, 0xA7, 0xC9, 0xBB, 0xDB, 0xA9, 0x3F, 0xBE, 0x08,
+    0xE9, 0xAA, 0x57, 0x6F, 0x27, 0xBC, 0x88, 0xA9, 0xED, 0xF0, 0x2C, 0x3C, 0x97, 0x2A, 0xDF, 0x28,
+    0xF6, 0xC2, 0x85, 0x4A, 0xC8, 0xCF, 0x78, 0x21, 0xF7, 0x43, 0xC0, 0x79, 0xD9, 0xAF, 0x2A, 0xF0,
+    0xB8, 0xEA, 0xC0, 0x05, 0x9D, 0xC9, 0x39, 0xBD, 0x5C, 0xD2, 0x4B, 0xC9, 0x99, 0xC9, 0x2D, 0x31,
+    0x37, 0x2F, 0xE7, 0xC4, 0x02, 0xAA, 0x69, 0x70, 0x4B, 0x4B, 0x59, 0x69, 0xC5, 0x98, 0x7D, 0xC2,
+    0x75, 0xE3, 0x0B, 0xD8, 0x75, 0x4C, 0x25, 0x82, 0x85, 0x2E, 0x69, 0xA9, 0xBC, 0x3E, 0x99, 0x4D,
+    0xEE, 0x00, 0x66, 0x73, 0x73, 0xC2, 0x5F, 0xB9, 0xDC, 0x6B, 0x11, 0xDA, 0x6D, 0x03, 0xC0, 0x41,
+    0xFD, 0x44, 0x5D, 0x7B, 0xC2, 0x69, 0xC2, 0x73, 0xCB, 0x9B, 0xC4, 0x3B, 0xB4, 0x2C, 0x15, 0x29,
+    0x10, 0x66, 0x1E, 0xA1, 0x80, 0x48, 0x1E, 0x45, 0x3C, 0x48, 0xE3, 0xF4, 0xB8, 0x21, 0xFD, 0x12,
+    0xE8, 0x63, 0xAC, 0x20, 0x71, 0x15, 0xCC, 0x95, 0xAD, 0x80, 0xC2, 0xE1, 0x6C, 0xD5, 0xEB, 0xAA,
+    0x28, 0xEB, 0x5A, 0x95, 0x7E, 0x58, 0x0C, 0x89, 0xDF, 0x4C, 0x92, 0x0D, 0xD5, 0x8C, 0xD7, 0x4E,
+    0x45, 0x6C, 0xE7, 0x0E, 0xDD, 0x81, 0x22, 0xBD, 0x92, 0x1C, 0x27, 0x6B, 0x29, 0x08, 0x00, 0x65,
+    0x13, 0x53, 0xA1, 0x11, 0x20, 0xD8, 0x18, 0x9C, 0xD4, 0x96, 0x5F, 0xA9, 0x8C, 0x40, 0x5E, 0x51,
+    0x2B, 0xC9, 0xAA, 0x2B, 0x33, 0x0F, 0x4A, 0x2B, 0x9E, 0x01, 0x8C, 0x53, 0xFB, 0x19, 0x59, 0xE1,
+    0x50, 0x14, 0xA3, 0x5B, 0xCA, 0xEF, 0x3A, 0x34, 0xDE, 0x07, 0x66, 0x90, 0xCA, 0xD0, 0x9A, 0x9D,
+    0xB9, 0x1E, 0x2C, 0xC7, 0x38, 0x6D, 0xC0, 0x25, 0xB7, 0xDF, 0xB1, 0x3C, 0xB4, 0xC7, 0x10, 0x0C,
+    0xCA, 0x97, 0xE7, 0xA1, 0xA2, 0xDA, 0x78, 0x46, 0xF2, 0xD3, 0xB6, 0xD0, 0x06, 0xB4, 0x55, 0xB7,
+    0xE5, 0x53, 0xA8, 0xEA, 0x8D, 0x79, 0xDC, 0x64, 0xF4, 0xA3, 0x5C, 0x50, 0xD9, 0x1D, 0x3D, 0xA6,
+    0x10, 0xAA, 0xE2, 0x65, 0x6F, 0xFA, 0xA9, 0xB6, 0x53, 0x9F, 0xB0, 0xA5, 0x87, 0x60, 0x66, 0x84,
+    0x99, 0x80, 0x6D, 0xA1, 0xA2, 0xB6, 0x50, 0x25, 0xFF, 0x88, 0x4A, 0xD7, 0x71, 0xBD, 0x2C, 0x34,
+    0x17, 0xEA, 0xA4, 0x73, 0xAA, 0x95, 0x2E, 0x2B, 0x8B, 0x95, 0x7A, 0xE9, 0x53, 0xEA, 0x44, 0xA6,
+    0x57, 0x28, 0x21, 0x94, 0x3C, 0x3F, 0x23, 0xEF, 0x85, 0x04, 0x4C, 0xA2, 0x1C, 0xA8, 0x7D, 0x56,
+    0xC8, 0x77, 0x82, 0x2A, 0x41, 0x71, 0x01, 0x95, 0xF3, 0x9B, 0xF4, 0x32, 0x30, 0x95, 0x06, 0x52,
+    0x26, 0x23, 0x18, 0x6D, 0xEC, 0x95, 0xDC, 0x4A, 0xF4, 0x97, 0x57, 0xAB, 0x47, 0xE2, 0xC9, 0xAC,
+    0x8F, 0xC0, 0x9E, 0x89, 0x8C, 0x2D, 0xCA, 0xBD, 0x82, 0xE5, 0xD4, 0xFC, 0x7B, 0xEC, 0x9B, 0x4C,
+    0xEB, 0x37, 0x72, 0x0D, 0x05, 0xA0, 0x5D, 0x95, 0x45, 0xEC, 0x17, 0x6D, 0x2D, 0x4E, 0x83, 0x39,
+    0x2C, 0x7B, 0x07, 0x75, 0x76, 0x2C, 0xCC, 0x0F, 0x63, 0x55, 0x0B, 0x41, 0xB1, 0x80, 0x85, 0xC8,
+    0xF5, 0x2C, 0xAE, 0x27, 0xFD, 0x7E, 0x89, 0xEB, 0x59, 0xEF, 0xE7, 0x39, 0x56, 0x76, 0xC9, 0xFB,
+    0x6D, 0x86, 0xA5, 0x95, 0xF2, 0x40, 0x2C, 0xAA, 0xEF, 0x8E, 0x70, 0x75, 0xFA, 0xE2, 0x69, 0x8A,
+    0x10, 0xFA, 0x03, 0x67, 0x00, 0x25, 0xD1, 0x1E, 0x39, 0xFD, 0x10, 0xDA, 0x35, 0xD1, 0x7D, 0x6C,
+    0x6C, 0xFB, 0xC0, 0x40, 0x8A, 0x65, 0x0B, 0xB1, 0xC0, 0xA9, 0x6D, 0xF7, 0x94, 0xA5, 0x7C, 0xF2,
+    0x52, 0x63, 0xE2, 0xA1, 0xC5, 0xA2, 0x6B, 0x6B, 0xEB, 0xB9, 0xAA, 0xEA, 0x9C, 0xCC, 0x82, 0x39,
+    0x58, 0x13, 0x3F, 0xB5, 0xED, 0x89, 0xAA, 0xB1, 0x29, 0x2F, 0xE1, 0xD2, 0x9D, 0xDA, 0xF6, 0x11,
+    0x70, 0x26, 0xF6, 0x14, 0x30, 0xA3, 0xC1, 0x38, 0x23, 0xFA, 0x95, 0xB9, 0xD8, 0x3A, 0x79, 0xFA,
+    0x86, 0xFC, 0x2E, 0x78, 0x63, 0x88, 0x99, 0x74, 0x21, 0xFA, 0x1B, 0xD0, 0x44, 0x1B, 0xD0, 0x4B,
+    0x1B, 0x02, 0x9C, 0xCD, 0x06, 0x98, 0x65, 0x44, 0x8E, 0xC1, 0x72, 0x31, 0xB8, 0x55, 0x82, 0xA5,
+    0x24, 0x50, 0x15, 0x32, 0x9F, 0x10, 0xF4, 0xA1, 0xA9, 0x1B, 0x19, 0x77, 0x73, 0xBE, 0x84, 0x9D,
+    0x69, 0xFC, 0x4A, 0x40, 0x6A, 0x20, 0x9C, 0x9A, 0x30, 0xDB, 0x2E, 0xFF, 0x43, 0x21, 0x9C, 0xEC,
+    0x3D, 0x11, 0xCE, 0xCA, 0xBB, 0x21, 0x9C, 0x51, 0xE3, 0xCB, 0xD1, 0x15, 0x69, 0x0C, 0x7A, 0x2E,
+    0x4F, 0x0F, 0xB6, 0x1B, 0x74, 0x18, 0xE7, 0xBC, 0x31, 0xCE, 0xC2, 0x27, 0x08, 0x24, 0xF8, 0x10,
+    0x5C, 0xD8, 0x72, 0x98, 0xF6, 0xA4, 0xBE, 0xF0, 0xEE, 0x6E, 0xDE, 0x47, 0x77, 0xE3, 0xB3, 0x06,
+    0x4E, 0xED, 0xEA, 0xC1, 0xBF, 0xB7, 0x1B, 0x3F, 0x13, 0x2E, 0x31, 0x95, 0xDB, 0x3F, 0x21, 0x2C,
+    0x59, 0x9C, 0x11, 0x87, 0xC7, 0x86, 0x4B, 0xDE, 0xC3, 0xE7, 0xBC, 0x29, 0xA4, 0xC0, 0xB2, 0xE6,
+    0xE8, 0xF4, 0xD7, 0xE5, 0x6D, 0xC7, 0xC9, 0xC6, 0x39, 0x7D, 0x8A, 0x76, 0x93, 0x64, 0x85, 0x0E,
+    0x33, 0x9F, 0x83, 0xA9, 0xF2, 0x81, 0x03, 0x4C, 0xFB, 0xDB, 0xD5, 0x72, 0xEE, 0x0E, 0x9D, 0x81,
+    0x2F, 0x00, 0x4D, 0x9C, 0xB7, 0x2A, 0xA4, 0xA9, 0x8C, 0x81, 0xCA, 0x86, 0x09, 0xAC, 0xA5, 0x8C,
+    0x82, 0x3D, 0x85, 0x75, 0x83, 0x1C, 0x0C, 0x2C, 0x3B, 0x5B, 0x25, 0x69, 0x28, 0xD3, 0x8E, 0xB2,
+    0x28, 0x0B, 0xFB, 0x61, 0x11, 0xA5, 0x49, 0xE6, 0x6D, 0xC6, 0x7F, 0xA2, 0x40, 0x18, 0x0F, 0x6E,
+    0x9F, 0x9A, 0x2C, 0x9D, 0x76, 0xD4, 0xEC, 0x3D, 0x4D, 0x67, 0x5F, 0x98, 0x68, 0x08, 0xA1, 0x8E,
+    0x5F, 0x87, 0x39, 0x84, 0x93, 0x36, 0x22, 0x48, 0xDE, 0x90, 0xDD, 0x90, 0x39, 0x33, 0x62, 0x94,
+    0x3C, 0x44, 0x97, 0xF5, 0x15, 0x9A, 0x78, 0xB2, 0x87, 0xDA, 0x64, 0xEA, 0x50, 0x13, 0xD2, 0xC9,
+    0x5B, 0xE4, 0xF7, 0xCB, 0x11, 0x15, 0xE2, 0x06, 0x29, 0x90, 0x50, 0xA7, 0x62, 0x87, 0xAF, 0x60,
+    0x8B, 0xC5, 0x56, 0x0B, 0x6B, 0x08, 0xE8, 0x15, 0xE3, 0xDE, 0x1E, 0x3B, 0x44, 0x31, 0x9F, 0x12,
+    0x7F, 0x61, 0xBC, 0xAA, 0xFE, 0x82, 0xEA, 0x14, 0x85, 0x30, 0xCA, 0x4E, 0x13, 0x2F, 0xD0, 0x57,
+    0xEB, 0xEA, 0xDB, 0xD0, 0x12, 0x98, 0x34, 0x13, 0xD4, 0xB3, 0xBC, 0x89, 0x40, 0x8A, 0xF0, 0x7D,
+    0xD0, 0xB7, 0x3E, 0xFF, 0xF4, 0x7F, 0x86, 0x09, 0x46, 0x9C, 0x5C, 0xCC, 0xFF, 0x3A, 0xC3, 0x84,
+    0x4F, 0x68, 0xC1, 0xCF, 0xBE, 0x08, 0x3D, 0x5F, 0x8F, 0x41, 0xBA, 0xCF, 0xA5, 0xC3, 0xA9, 0x27,
+    0x4A, 0xC9, 0xB3, 0xDE, 0x33, 0x99, 0xDC, 0x8E, 0xD1, 0xA6, 0x86, 0x4C, 0xC8, 0xB6, 0x2F, 0xD6,
+    0x43, 0x55, 0xC8, 0x0F, 0xF4, 0x5E, 0xB7, 0xE4, 0x4B, 0x52, 0xAB, 0x94, 0x93, 0x46, 0x2D, 0x27,
+    0x0D, 0x11, 0x5B, 0x8D, 0x6A, 0xEE, 0x36, 0xCA, 0xB9, 0x43, 0xC7, 0x9C, 0x5E, 0x02, 0x48, 0x1B,
+    0x65, 0xEA, 0x33, 0xC8, 0x14, 0xA9, 0x2C, 0x8C, 0xDE, 0x44, 0xF5, 0x94, 0x57, 0x5A, 0x45, 0xAD,
+    0xD1, 0x12, 0xDC, 0xAD, 0x6F, 0x95, 0xB5, 0xDF, 0xB7, 0xEA, 0x9A, 0x0F, 0xB1, 0x61, 0x0A, 0x55,
+    0xD9, 0x1A, 0xAF, 0x10, 0x02, 0xAF, 0x5F, 0x5B, 0xA3, 0xDA, 0xAE, 0x2D, 0x91, 0x7F, 0xEF, 0x26,
+    0xBF, 0xDA, 0x4C, 0xBE, 0xD1, 0x83, 0x61, 0x63, 0x7E, 0xBC, 0xFC, 0xDD, 0x3F, 0x69, 0xE2, 0x07,
+    0x2E, 0x35, 0x19, 0x7C, 0x3C, 0x59, 0xE9, 0x02, 0x96, 0x72, 0x02, 0xCB, 0x38, 0x83, 0x25, 0x3C,
+    0x1E, 0x14, 0x3B, 0x20, 0xFE, 0xAA, 0x85, 0xF8, 0xB1, 0x20, 0x63, 0x99, 0x5D, 0x64, 0xFD, 0xBB,
+    0x16, 0x86, 0x59, 0xD7, 0x2E, 0x02, 0x76, 0x07, 0xD1, 0x04, 0x38, 0x33, 0xF8, 0xD3, 0xC3, 0xED,
+    0xE9, 0x4C, 0xB6, 0x6D, 0xD4, 0xD0, 0x52, 0x76, 0xDB, 0x0B, 0x4F, 0x9E, 0x44, 0x11, 0x77, 0x44,
+    0x12, 0xF9, 0x92, 0x09, 0x80, 0x6E, 0x91, 0xCC, 0x01, 0x62, 0x15, 0xA7, 0xED, 0x4C, 0xE5, 0x2A,
+    0xCC, 0x35, 0xC2, 0x18, 0x14, 0x2A, 0x60, 0x41, 0xBF, 0x45, 0x6A, 0x06, 0x45, 0x97, 0xC4, 0x0C,
+    0x8B, 0x8E, 0x25, 0xA1, 0x46, 0x1D, 0xC5, 0x09, 0x20, 0x25, 0x6B, 0xEC, 0x2B, 0x3C, 0xD0, 0x79,
+    0x55, 0x47, 0x59, 0x4F, 0xCD, 0x96, 0x86, 0xD1, 0xDE, 0x33, 0x7E, 0x08, 0x82, 0x44, 0x24, 0x88,
+    0xCC, 0x84, 0xD3, 0x50, 0xE3, 0x8C, 0x09, 0xDC, 0xE8, 0xF0, 0x26, 0x37, 0x38, 0xBC, 0x33, 0xBE,
+    0xC3, 0x77, 0xE9, 0x3B, 0xB4, 0xE1, 0x3B, 0x08, 0xA3, 0x94, 0x20, 0xE1, 0x01, 0xFB, 0x94, 0x62,
+    0x66, 0xD8, 0xB7, 0xB6, 0x5E, 0xC0, 0x95, 0xDB, 0x6E, 0x4A, 0xAC, 0x21, 0xDB, 0x03, 0xDD, 0xB8,
+    0x80, 0xF5, 0xD1, 0x77, 0xE0, 0xB6, 0x24, 0x3F, 0xEA, 0xA5, 0xF2, 0x08, 0xC8, 0xEB, 0x5D, 0x3B,
+    0xC2, 0x45, 0x8C, 0xC7, 0x40, 0xBF, 0xFE, 0x62, 0xC4, 0x68, 0xE1, 0x08, 0xF7, 0xF1, 0x4A, 0x0F,
+    0x5E, 0xB6, 0xAC, 0x57, 0xD5, 0x46, 0x50, 0x44, 0xC4, 0x4C, 0x41, 0x2E, 0x3F, 0xF4, 0xE1, 0x7B,
+    0xB7, 0x8D, 0x5E, 0x37, 0x78, 0x8D, 0xAE, 0x8D, 0xD4, 0xA1, 0x14, 0x67, 0x1A, 0xAB, 0x4E, 0x80,
+    0x70, 0xF0, 0x5C, 0x5E, 0x73, 0x45, 0xC3, 0x62, 0xD3, 0x5B, 0xB8, 0xCA, 0x2D, 0xBA, 0x60, 0xDD,
+    0xB6, 0x66, 0x05, 0xF4, 0x3F, 0xE3, 0x75, 0x0C, 0x19, 0xCA, 0xDB, 0xC5, 0xA6, 0x87, 0xAF, 0xB6,
+    0x89, 0xA3, 0x5C, 0xEB, 0x3C, 0xA8, 0xCF, 0x23, 0x5E, 0x13, 0x16, 0x41, 0xFF, 0x5D, 0xE0, 0xE0,
+    0x88, 0x0F, 0xD7, 0x47, 0x55, 0x46, 0x51, 0x84, 0x8C, 0x90, 0x4E, 0x86, 0x08, 0xEC, 0x28, 0x66,
+    0x4A, 0xD6, 0xE8, 0x8E, 0x1F, 0x2D, 0xA8, 0x9C, 0x72, 0xA0, 0x2A, 0x90, 0xCD, 0x1B, 0x90, 0x9F,
+    0xFA, 0x8C, 0x4F, 0xE7, 0xE0, 0xA1, 0x36, 0xA5, 0x8D, 0x38, 0x53, 0x50, 0x7C, 0x1B, 0x56, 0x13,
+    0x18, 0xB3, 0x97, 0xC1, 0x59, 0x91, 0x3B, 0xDC, 0x21, 0xBF, 0xF8, 0x3D, 0x2A, 0x69, 0xC4, 0x35,
+    0x0D, 0x71, 0x0C, 0x08, 0x25, 0xFB, 0x15, 0x66, 0x14, 0x63, 0x4A, 0xAE, 0xCF, 0x68, 0x47, 0xDE,
+    0xF0, 0x02, 0x03, 0x13, 0xCB, 0xC2, 0x1A, 0x0F, 0xBC, 0x92, 0x9B, 0xE8, 0xCD, 0xAF, 0x5E, 0x37,
+    0xC1, 0xD0, 0x97, 0xBB, 0xA4, 0x86, 0x3A, 0xDB, 0x69, 0x42, 0x3B, 0xEB, 0x35, 0xC2, 0x32, 0xA0,
+    0x8C, 0xC8, 0xB3, 0x43, 0x4B, 0x55, 0x34, 0xA6, 0x7A, 0x7F, 0x24, 0xB0, 0xE6, 0x70, 0xF7, 0xB1,
+    0xC2, 0xDC, 0xDF, 0x87, 0x9A, 0xC8, 0x19, 0x1E, 0x46, 0x48, 0x03, 0x54, 0xEB, 0x61, 0xD8, 0xC0,
+    0x94, 0xBA, 0x60, 0x54, 0x3B, 0xF8, 0xC0, 0xFF, 0x3A, 0x03, 0x79, 0xC0, 0xB7, 0xA9, 0xCB, 0xFB,
+    0x0D, 0x0B, 0x00, 0xC2, 0x6F, 0xB4, 0x73, 0x4F, 0x8C, 0x71, 0x90, 0xCB, 0xFE, 0xA6, 0x90, 0x9E,
+    0x28, 0x6B, 0xC9, 0x73, 0x7B, 0xC2, 0x8B, 0xE3, 0x47, 0x2A, 0x21, 0xEC, 0x06, 0x83, 0xD4, 0x08,
+    0x50, 0x77, 0xE4, 0xB5, 0x84, 0x3B, 0x3D, 0x31, 0x54, 0x58, 0x80, 0x9B, 0x2C, 0xBF, 0x2E, 0x9E,
+    0xC1, 0x58, 0xF4, 0x88, 0xCC, 0x84, 0x60, 0xCA, 0xDA, 0x37, 0xEE, 0x76, 0x41, 0x00, 0x0E, 0xDA,
+    0x36, 0xB1, 0xFE, 0xAE, 0xF0, 0x66, 0xCF, 0x1C, 0x33, 0xC9, 0xB5, 0x81, 0xF2, 0x3B, 0xEE, 0xB1,
+    0x57, 0xEC, 0x7E, 0x4F, 0xD6, 0x76, 0x00, 0xEF, 0x87, 0x68, 0x35, 0x7A, 0x00, 0xBB, 0x88, 0x58,
+    0xF8, 0x56, 0xE5, 0x8C, 0x96, 0x2B, 0xBF, 0xF0, 0xAA, 0x30, 0x03, 0x10, 0x76, 0xAA, 0x96, 0xFC,
+    0x4C, 0xF8, 0xA5, 0x44, 0xE0, 0x46, 0x5E, 0x7D, 0x68, 0x47, 0x48, 0x57, 0x47, 0xF4, 0x41, 0x4B,
+    0xC0, 0x41, 0xFC, 0x84, 0xF8, 0x57, 0xD8, 0x66, 0xDC, 0x5F, 0x9C, 0x75, 0xB3, 0xD1, 0x13, 0xB0,
+    0x14, 0xE5, 0x41, 0x2E, 0xC8, 0x39, 0x8D, 0x32, 0x59, 0x45, 0x8A, 0xF4, 0x54, 0xF7, 0xA0, 0x48,
+    0xA2, 0x70, 0xD2, 0xE8, 0xD4, 0x24, 0x0F, 0xC1, 0x39, 0x26, 0x32, 0xC7, 0x58, 0xE6, 0xE8, 0x37,
+    0x73, 0x5C, 0x4E, 0xE7, 0x32, 0xBF, 0x42, 0xE8, 0x52, 0x1C, 0xC0, 0xB6, 0xF1, 0x1F, 0x14, 0x47,
+    0xE5, 0x8A, 0x78, 0x50, 0x4E, 0x15, 0x3E, 0x51, 0x1E, 0x41, 0xBE, 0x21, 0x7A, 0xB0, 0x0F, 0xE4,
+    0x34, 0x8C, 0xB8, 0x63, 0xA6, 0x8A, 0xD5, 0x38, 0xDB, 0x10, 0x9F, 0x19, 0xD7, 0xEB, 0xEA, 0x17,
+    0xAF, 0x30, 0xC8, 0xEE, 0x96, 0x1D, 0x5E, 0x65, 0xEA, 0xB8, 0x2E, 0xF8, 0x79, 0x15, 0xE6, 0x07,
+    0xCC, 0xF9, 0x30, 0x15, 0x8E, 0x3C, 0x63, 0x56, 0xEE, 0x77, 0x4A, 0x7F, 0x4B, 0x78, 0x68, 0xE0,
+    0x92, 0xFD, 0x26, 0x09, 0x23, 0x01, 0x26, 0xDE, 0x66, 0x4F, 0x38, 0x4B, 0x76, 0x2B, 0x15, 0x6A,
+    0x28, 0xBA, 0xA0, 0x1B, 0x67, 0xC4, 0x6B, 0x35, 0xDF, 0x18, 0xE8, 0xE7, 0x36, 0xD3, 0x72, 0x4E,
+    0x5E, 0x1D, 0x59, 0xD1, 0x86, 0x6C, 0x44, 0x8C, 0xB5, 0xC8, 0x3A, 0x8F, 0x5E, 0x30, 0xCF, 0x2F,
+    0x97, 0xA6, 0x02, 0xE3, 0x8A, 0x67, 0x5B, 0xFA, 0x85, 0x5B, 0x06, 0x22, 0x25, 0x21, 0x38, 0x21,
+    0xF3, 0x85, 0x0F, 0x82, 0x3C, 0x46, 0x42, 0xC9, 0x80, 0x4E, 0x49, 0xB6, 0x64, 0x5E, 0x4B, 0x13,
+    0xEF, 0xAB, 0x69, 0xF2, 0xEB, 0xF0, 0xD7, 0x61, 0x15, 0xA8, 0x30, 0xEE, 0x33, 0xF7, 0xCA, 0x63,
+    0x2F, 0x99, 0xF8, 0x19, 0x41, 0x11, 0xB2, 0x77, 0x0E, 0xB1, 0xDB, 0x2D, 0xB9, 0xF7, 0xD1, 0x0B,
+    0xFB, 0xD6, 0x4C, 0x5C, 0xCA, 0x5D, 0x45, 0x07, 0x89, 0xBB, 0xD6, 0x17, 0xC4, 0xE7, 0x17, 0xC7,
+    0xA1, 0x70, 0x05, 0xEF, 0x05, 0x2F, 0xC1, 0xA8, 0x82, 0xA6, 0xE1, 0x9B, 0xB0, 0xAA, 0x0F, 0x0A,
+    0x9F, 0xC4, 0x60, 0x14, 0x30, 0xA9, 0x28, 0xDC, 0x2E, 0x06, 0x66, 0x4B, 0x84, 0xFD, 0x3A, 0x26,
+    0x40, 0x9C, 0x65, 0x6D, 0x6D, 0x55, 0x80, 0x34, 0x58, 0xF6, 0x1C, 0xEC, 0xD9, 0x19, 0xEC, 0xCC,
+    0x25, 0x08, 0xBE, 0xCC, 0xC9, 0x38, 0x32, 0x29, 0xE3, 0x42, 0xF6, 0xBD, 0x2C, 0x06, 0x88, 0x4A,
+    0xE0, 0x74, 0x2F, 0xC1, 0xE5, 0x5E, 0x81, 0x8B, 0xBD, 0x62, 0xFE, 0xA0, 0x92, 0x41, 0x3C, 0xE3,
+    0xF6, 0x65, 0xF1, 0x8B, 0x13, 0xEC, 0xB2, 0x68, 0xA2, 0xB9, 0x17, 0x8C, 0xB9, 0x3B, 0x95, 0xDB,
+    0x52, 0x8B, 0xE1, 0x55, 0xF3, 0xE2, 0xE2, 0xD2, 0x4B, 0xFD, 0x0D, 0x86, 0x66, 0x43, 0xB9, 0x85,
+    0xF3, 0x4A, 0x76, 0x4C, 0xAC, 0x8E, 0xFB, 0x72, 0x7E, 0x02, 0x11, 0x8E, 0xA7, 0xF3, 0x12, 0xB6,
+    0xE6, 0xA1, 0x97, 0x72, 0x68, 0x2A, 0xFF, 0x27, 0x4F, 0x20, 0x06, 0xEB, 0xBD, 0x26, 0xFA, 0x43,
+    0xEC, 0xEE, 0x50, 0x2E, 0x7F, 0x50, 0x79, 0x15, 0xE4, 0xBB, 0x74, 0x4B, 0x77, 0x2B, 0x4F, 0x72,
+    0x47, 0x9C, 0xF1, 0x74, 0x8F, 0xE6, 0x24, 0x40, 0xDF, 0x58, 0xE8, 0x2B, 0x60, 0x7B, 0xE0, 0x81,
+    0xC6, 0x96, 0xBE, 0x01, 0xE8, 0x2B, 0xB8, 0x25, 0xBC, 0xB6, 0x0E, 0xCE, 0x20, 0x8D, 0x45, 0xF5,
+    0x08, 0x7D, 0x23, 0x91, 0xD9, 0x28, 0x13, 0x25, 0xF0, 0xEB, 0x0E, 0x05, 0x41, 0x14, 0x4E, 0x20,
+    0x10, 0x6D, 0x63, 0x59, 0xDE, 0x25, 0xEF, 0x11, 0xBD, 0x15, 0xA5, 0xCE, 0x40, 0x65, 0xCA, 0xA9,
+    0xA0, 0x83, 0x87, 0x7C, 0x41, 0xAE, 0x7C, 0xC8, 0x95, 0xC8, 0x54, 0x98, 0xB5, 0x26, 0x72, 0xAF,
+    0xF2, 0x70, 0xF4, 0x42, 0x9C, 0xC5, 0x6F, 0xD5, 0xA5, 0xF7, 0xDB, 0x27, 0x4B, 0xEF, 0x57, 0xB2,
+    0xCF, 0x95, 0xCC, 0xA3, 0x94, 0x79, 0x14, 0xB8, 0xA7, 0x5F, 0xCC, 0xEE, 0xB5, 0xCE, 0x83, 0x73,
+    0xD9, 0x36, 0x0F, 0x77, 0x6D, 0x0E, 0x02, 0x15, 0x0B, 0xF7, 0x2C, 0x9D, 0x15, 0xA2, 0x2F, 0x61,
+    0x0F, 0xDA, 0x22, 0x9C, 0xA2, 0x73, 0x08, 0x96, 0x38, 0xC8, 0xF7, 0x98, 0x45, 0x1A, 0x00, 0x2E,
+    0x95, 0x9A, 0x04, 0x83, 0xC4, 0xCB, 0x37, 0xBC, 0xBE, 0x28, 0x75, 0x7F, 0x20, 0x5A, 0x23, 0x80,
+    0xED, 0x0D, 0x5F, 0x44, 0xD4, 0x24, 0x6B, 0x52, 0x79, 0xD1, 0x34, 0x51, 0xB8, 0xDA, 0xF8, 0x37,
+    0xAA, 0xF2, 0x7A, 0x19, 0x18, 0x52, 0x54, 0x9E, 0x90, 0x8A, 0xDB, 0xBD, 0x33, 0x15, 0xB9, 0x4D,
+    0x15, 0xB4, 0x77, 0xA8, 0x02, 0x2C, 0x7D, 0xBE, 0x30, 0x58, 0x7D, 0x4F, 0xE6, 0xF0, 0xDB, 0x27,
+    0xDF, 0xFA, 0x91, 0xCC, 0xE7, 0x57, 0xEE, 0xEF, 0xE4, 0x1D, 0x42, 0x06, 0xD8, 0x33, 0xA1, 0x44,
+    0x25, 0xB3, 0x0E, 0xE0, 0x13, 0xC1, 0x36, 0x40, 0x12, 0x0C, 0x48, 0x22, 0x73, 0x07, 0x55, 0xC4,
+    0x42, 0x80, 0x30, 0x34, 0x14, 0xF8, 0xB6, 0x01, 0x79, 0x02, 0x64, 0xD4, 0xE4, 0xA7, 0xD0, 0xD8,
+    0xB1, 0xF1, 0xDF, 0x81, 0xBE, 0x45, 0x74, 0x88, 0x1F, 0xC2, 0xA1, 0xCF, 0x8B, 0x15, 0x10, 0x83,
+    0x27, 0x56, 0xB8, 0xAD, 0x86, 0xC5, 0xCF, 0x85, 0x38, 0x3E, 0x92, 0x75, 0x82, 0xFF, 0x65, 0x3D,
+    0x10, 0x90, 0xFD, 0xC8, 0xB3, 0x1C, 0x86, 0x5A, 0x39, 0x09, 0x15, 0x7A, 0x06, 0x8A, 0x06, 0x09,
+    0x98, 0x7F, 0x60, 0x4E, 0x15, 0x14, 0x61, 0x4A, 0xE9, 0xBC, 0xA6, 0x25, 0x19, 0x2D, 0x62, 0xA8,
+    0x57, 0x73, 0x5F, 0x7F, 0x08, 0xA6, 0x4D, 0xAA, 0x1D, 0x8E, 0xA0, 0x95, 0xED, 0x78, 0xA4, 0x6A,
+    0x8D, 0x4A, 0xEC, 0xF0, 0x14, 0xF5, 0xF7, 0x27, 0xF9, 0xB3, 0xE8, 0xCD, 0xFF, 0xD3, 0x17, 0xA3,
+    0xD5, 0x7E, 0x07, 0xFB, 0x13, 0xE6, 0x48, 0x0E, 0x8A, 0x93, 0x07, 0x57, 0x1E, 0x89, 0x43, 0xFE,
+    0x6B, 0x71, 0xEC, 0x52, 0x44, 0x87, 0xB2, 0xD0, 0xB6, 0x8C, 0x1D, 0xDA, 0x18, 0xFD, 0x57, 0x71,
+    0x1C, 0xC0, 0x8A, 0xB9, 0x03, 0x20, 0xDF, 0x47, 0x2B, 0x38, 0x28, 0xEF, 0x60, 0x7F, 0x9D, 0x07,
+    0xFB, 0xE9, 0x24, 0x55, 0x47, 0xE5, 0x7A, 0x80, 0xC8, 0xE7, 0x0A, 0xD3, 0x76, 0x1D, 0xFA, 0xCD,
+    0xBA, 0xCB, 0x8E, 0xCE, 0xFB, 0xEB, 0x66, 0xDF, 0x05, 0x18, 0xEE, 0x55, 0x99, 0xC8, 0x02, 0x2C,
+    0x0B, 0x3C, 0xB7, 0xB7, 0x80, 0x03, 0x7E, 0x97, 0x21, 0x9D, 0xDE, 0xF8, 0xD8, 0x1C, 0x28, 0xB7,
+    0xFE, 0x32, 0x96, 0x41, 0x85, 0x8C, 0x5B, 0x0F, 0xE8, 0xD9, 0x09, 0x0E, 0x4A, 0x72, 0xD9, 0x88,
+    0x8F, 0xA8, 0xDB, 0x90, 0xF1, 0xBD, 0x53, 0x83, 0xF1, 0x62, 0x48, 0xA0, 0x4F, 0x00, 0x9E, 0xE9,
+    0xC2, 0xAE, 0x9A, 0xA3, 0xCF, 0x89, 0x5C, 0x0F, 0x20, 0xD7, 0x8D, 0x6C, 0xE3, 0xFE, 0x2A, 0xD7,
+    0x81, 0xC8, 0x93, 0xDF, 0x17, 0x77, 0xBB, 0x7E, 0x33, 0x37, 0xA7, 0x89, 0x57, 0x32, 0x65, 0x6F,
+    0x58, 0xD6, 0xF0, 0xD7, 0xC6, 0xCA, 0x93, 0xCC, 0xEF, 0x39, 0xF3, 0x4F, 0x0C, 0xA6, 0x68, 0x56,
+    0x14, 0x96, 0x74, 0x0C, 0x59, 0x4F, 0x18, 0x13, 0xAC, 0x87, 0xD4, 0x89, 0xA7, 0x68, 0xC5, 0x6B,
+    0x38, 0xD2, 0xB5, 0x1C, 0x59, 0x92, 0x23, 0x7D, 0x30, 0x66, 0x9C, 0x31, 0x55, 0x93, 0x64, 0xCC,
+    0xF1, 0xBE, 0x99, 0x42, 0xE9, 0x79, 0xCF, 0x66, 0x2F, 0xCB, 0xE5, 0x07, 0xE1, 0xF5, 0xAF, 0xBC,
+    0x63, 0xC2, 0xCA, 0x1F, 0x29, 0x63, 0xA6, 0xAA, 0xF2, 0x6F, 0xC7, 0x63, 0xAF, 0xA7, 0x7C, 0xEC,
+    0x3B, 0xFA, 0x58, 0xEB, 0xE3, 0x1E, 0x51, 0xDF, 0x45, 0xDD, 0x52, 0x75, 0xF2, 0xE5, 0x06, 0x3B,
+    0xF2, 0x66, 0xFB, 0xD6, 0xD6, 0x52, 0xD1, 0x8D, 0x19, 0xF4, 0xF9, 0x31, 0x79, 0xF0, 0x01, 0x90,
+    0x0F, 0xDC, 0x22, 0x46, 0xDF, 0x15, 0x47, 0xD5, 0x2B, 0x80, 0x0B, 0x02, 0xE8, 0xAD, 0xC9, 0x0B,
+    0x38, 0xC1, 0x1B, 0x88, 0xEE, 0xE9, 0x55, 0x64, 0xA7, 0xAF, 0x5F, 0x10, 0x2B, 0x82, 0x35, 0xCE,
+    0x8D, 0xE9, 0x01, 0x10, 0x59, 0xC1, 0xBC, 0xE4, 0x36, 0x45, 0x01, 0x6C, 0xFF, 0x2A, 0x54, 0x95,
+    0xB8, 0x01, 0xB2, 0xD4, 0x28, 0x6D, 0x03, 0xC0, 0x9B, 0xF8, 0x49, 0xF8, 0x73, 0xD1, 0x93, 0xFD,
+    0xE9, 0xF8, 0x14, 0x12, 0x35, 0x89, 0xBC, 0x3D, 0x2C, 0xBA, 0xDE, 0x3B, 0x99, 0x5B, 0xBF, 0xEE,
+    0x6A, 0xF6, 0x9E, 0xDA, 0x1D, 0xCF, 0x50, 0xFF, 0xA7, 0xD0, 0x17, 0x7D, 0x9F, 0x57, 0x4F, 0x89,
+    0xC9, 0x83, 0xAF, 0xD3, 0x4E, 0xC1, 0x5D, 0xCA, 0x65, 0xCA, 0x69, 0x51, 0x1A, 0xA7, 0x61, 0x21,
+    0xC0, 0x0F, 0xA8, 0x78, 0x8F, 0x22, 0x32, 0x6F, 0x73, 0x03, 0x08, 0x21, 0x13, 0x84, 0x90, 0xBB,
+    0x53, 0x2F, 0xAA, 0x30, 0xA7, 0x1F, 0xCB, 0x15, 0xFD, 0x4E, 0x6A, 0x32, 0x44, 0x0B, 0xAC, 0x10,
+    0xCB, 0x6E, 0x60, 0x13, 0xA0, 0x21, 0x14, 0x21, 0x2C, 0xCB, 0x57, 0xA5, 0xB7, 0x85, 0x94, 0x8F,
+    0x3C, 0x47, 0x30, 0xAD, 0x6A, 0x2A, 0x80, 0xC9, 0x20, 0x07, 0xD2, 0x0A, 0x5E, 0x84, 0xFF, 0x19,
+    0xD6, 0xD8, 0xD6, 0xF0, 0x3A, 0x73, 0x71, 0x0F, 0x22, 0x13, 0x15, 0x73, 0x4F, 0x13, 0xFA, 0xB1,
+    0x4B, 0x42, 0x83, 0x8E, 0x20, 0xFF, 0x4A, 0x28, 0xB2, 0x62, 0xBA, 0x01, 0x0C, 0x32, 0xD4, 0xBD,
+    0xE5, 0x9C, 0xB9, 0xFA, 0xEF, 0x65, 0xBB, 0x7E, 0xD1, 0x43, 0x6C, 0x7E, 0x09, 0x14, 0x5C, 0x02,
+    0xDA, 0x5B, 0xC1, 0x60, 0xCB, 0x85, 0x44, 0x42, 0x10, 0x56, 0xC6, 0xD2, 0xC2, 0x9F, 0x21, 0xE1,
+    0xFF, 0xCD, 0xA6, 0x36, 0x6A, 0x28, 0x7A, 0xC7, 0x85, 0xB8, 0xCC, 0xCB, 0x2C, 0x61, 0x24, 0x6B,
+    0x25, 0x21, 0x9D, 0x04, 0xAC, 0x4E, 0x14, 0xA3, 0x61, 0x32, 0xE8, 0xD2, 0x34, 0x99, 0x7F, 0x2B,
+    0x80, 0xE0, 0x17, 0xDC, 0xCC, 0x2C, 0xC1, 0xB5, 0x93, 0x8D, 0x39, 0xE4, 0x4E, 0xF3, 0x19, 0xB7,
+    0xE2, 0xDE, 0x98, 0x3A, 0xB0, 0xD4, 0x48, 0x6B, 0xA1, 0xEE, 0x1E, 0xAF, 0xF1, 0x65, 0x00, 0x83,
+    0x07, 0x7B, 0x45, 0x95, 0xF7, 0x0A, 0xEF, 0x37, 0xD7, 0x4B, 0xEF, 0xBA, 0x57, 0xFA, 0x43, 0x6B,
+    0x70, 0xFB, 0x50, 0xB5, 0xDB, 0x15, 0xD0, 0xD4, 0xF0, 0xC7, 0xB4, 0x25, 0x9D, 0x49, 0xC9, 0xCD,
+    0x8A, 0x2D, 0xB2, 0xAA, 0xB4, 0xD0, 0x6D, 0xBE, 0x50, 0x1D, 0x44, 0x78, 0xC9, 0xD0, 0x84, 0xDA,
+    0x86, 0xD9, 0x1A, 0xAC, 0x5B, 0x01, 0xF0, 0x6F, 0x62, 0x75, 0x37, 0x4E, 0xA7, 0xE4, 0xC8, 0xF7,
+    0xB2, 0xBA, 0x9C, 0xC7, 0x16, 0xD8, 0x5A, 0x56, 0x98, 0x85, 0xF2, 0xFA, 0x0C, 0x67, 0x0C, 0xB2,
+    0xBB, 0x70, 0xA1, 0x91, 0x21, 0x82, 0x5E, 0x95, 0x3B, 0x9C, 0x91, 0x35, 0x22, 0x9D, 0x5B, 0x99,
+    0x2B, 0xA6, 0x05, 0x4D, 0x83, 0x9F, 0x9F, 0xB2, 0xA1, 0x2B, 0xFC, 0x3B, 0xA0, 0x30, 0x73, 0x59,
+    0x9C, 0x42, 0xF9, 0x57, 0x60, 0xBF, 0x42, 0x08, 0x12, 0x18, 0x97, 0xA6, 0x29, 0xF9, 0xBE, 0x78,
+    0x7D, 0xDC, 0x8E, 0xA7, 0xF3, 0xE8, 0x95, 0x22, 0xFA, 0x56, 0xBE, 0xD7, 0xDA, 0x14, 0xCA, 0x06,
+    0x0B, 0x69, 0xF0, 0xBF, 0xB0, 0xC5, 0x33, 0x21, 0x83, 0x68, 0x31, 0x09, 0x98, 0x34, 0x81, 0xBD,
+    0xE4, 0xFB, 0x88, 0xB8, 0x36, 0xEF, 0x23, 0x6D, 0x13, 0x5B, 0x02, 0xB5, 0x67, 0x4A, 0xDF, 0x7D,
+    0xCF, 0xCB, 0x22, 0x9A, 0x95, 0x63, 0x5F, 0x06, 0xB0, 0xD9, 0xFA, 0xA2, 0x1F, 0xD4, 0x9F, 0xD1,
+    0x03, 0x56, 0xF7, 0x37, 0xFA, 0x3F, 0x9E, 0xA9, 0xA6, 0x6A, 0xB6, 0x56, 0xDE, 0x7E, 0xB0, 0x6F,
+    0x23, 0x01, 0x04, 0xBE, 0x90, 0x33, 0x75, 0x41, 0xCE, 0xA9, 0x47, 0x72, 0x46, 0xAB, 0x96, 0x2E,
+    0x11, 0x2A, 0x99, 0x3E, 0x71, 0x92, 0x53, 0xC4, 0xDF, 0x49, 0x81, 0x04, 0x12, 0x38, 0xDB, 0x9E,
+    0xB0, 0x0F, 0x42, 0xE8, 0x74, 0xF7, 0x04, 0x0C, 0xAF, 0xE0, 0x72, 0x44, 0x2F, 0x0B, 0xBC, 0x08,
+    0x24, 0x5E, 0x82, 0x31, 0x2F, 0x89, 0x0A, 0x93, 0x9C, 0x0E, 0xE1, 0x1E, 0x63, 0x01, 0x92, 0x18,
+    0x04, 0xD1, 0x1E, 0x0E, 0x03, 0xA5, 0x5C, 0x47, 0x9F, 0x3E, 0x78, 0xE1, 0x31, 0x4A, 0xAA, 0x23,
+    0x63, 0x63, 0x35, 0x2A, 0xAA, 0xC2, 0xEF, 0x3C, 0xF6, 0x6A, 0x2F, 0x15, 0xD4, 0x9A, 0x51, 0xAB,
+    0x65, 0x88, 0xDD, 0x00, 0x07, 0x01, 0x14, 0x85, 0xF9, 0x12, 0xF4, 0x4B, 0x0E, 0xC3, 0xD2, 0x96,
+    0xF5, 0x39, 0x1A, 0x0B, 0xD8, 0x7B, 0xAB, 0x85, 0xE5, 0x46, 0x74, 0x6A, 0x93, 0x95, 0xD1, 0xA4,
+    0x38, 0xF1, 0x0A, 0xC9, 0x34, 0x45, 0x17, 0x1F, 0x83, 0xA3, 0xB2, 0xD7, 0xC6, 0x71, 0x76, 0xD1,
+    0x5D, 0xB7, 0xC4, 0x69, 0x33, 0x17, 0x5C, 0x30, 0x96, 0x20, 0x45, 0x77, 0x13, 0x10, 0x70, 0x5B,
+    0x1D, 0xCE, 0x27, 0x05, 0x30, 0x3F, 0xDA, 0xCA, 0xBE, 0x52, 0xA1, 0x98, 0x80, 0x01, 0x4D, 0x6C,
+    0x55, 0xDB, 0x0A, 0x12, 0x9E, 0x3A, 0x2D, 0x8D, 0xF2, 0xE1, 0x3C, 0xF8, 0xFD, 0x18, 0x91, 0x8C,
+    0xB0, 0xFC, 0xC3, 0x11, 0x82, 0x34, 0x88, 0x93, 0xC4, 0xE2, 0xF9, 0xA0, 0x96, 0x2D, 0x63, 0x8E,
+    0xDE, 0x5E, 0xC4, 0xA9, 0x26, 0x2E, 0xCF, 0xBD, 0x82, 0x17, 0x50, 0x01, 0xAB, 0x87, 0x7C, 0x27,
+    0x79, 0x08, 0xA9, 0xEB, 0xE5, 0xC7, 0x71, 0xB9, 0x9E, 0x0B, 0x0D, 0x62, 0xEF, 0xE5, 0x1C, 0x3B,
+    0xFB, 0x50, 0xF0, 0x22, 0x76, 0xF9, 0x5F, 0x06, 0x57, 0x21, 0x9C, 0xE7, 0x83, 0xD7, 0x98, 0x70,
+    0xA1, 0x64, 0x47, 0x7D, 0x6C, 0xAE, 0xCC, 0x8F, 0xB9, 0xA7, 0xC8, 0x20, 0x8D, 0x3C, 0x97, 0xB9,
+    0xAB, 0x4E, 0x99, 0x08, 0x43, 0x7A, 0x03, 0x38, 0x62, 0x66, 0xE0, 0xA0, 0xF8, 0x60, 0x20, 0xD8,
+    0xB7, 0x94, 0xD9, 0x57, 0x4E, 0xE9, 0x70, 0x74, 0x85, 0x37, 0x9C, 0x52, 0x96, 0xD7, 0xF1, 0x06,
+    0x7E, 0x6A, 0xCE, 0x07, 0x03, 0x99, 0xC1, 0xF9, 0x7B, 0x2A, 0x41, 0x91, 0xE7, 0x4F, 0x54, 0xC2,
+    0x66, 0x8B, 0xFD, 0x4D, 0x88, 0x7B, 0xCE, 0xBA, 0x19, 0xE6, 0x69, 0x16, 0xC9, 0xAA, 0xBB, 0xC4,
+    0x2E, 0xF7, 0x5D, 0xDC, 0x7A, 0x1E, 0x51, 0xDE, 0x21, 0x12, 0xB0, 0x27, 0xCD, 0x89, 0x30, 0x3F,
+    0xD1, 0x38, 0x4C, 0x7F, 0x0F, 0x6D, 0x52, 0x33, 0x45, 0x1E, 0x67, 0x4D, 0x30, 0x57, 0xA6, 0xBB,
+    0x82, 0xA1, 0x6B, 0xCB, 0x67, 0x8A, 0x99, 0x1A, 0x9A, 0xCD, 0x47, 0x11, 0x24, 0x12, 0xA3, 0x06,
+    0x77, 0xC8, 0xD0, 0x1B, 0x32, 0x70, 0x86, 0x30, 0xFE, 0xCA, 0xA5, 0x2E, 0xC6, 0x18, 0x94, 0x1A,
+    0x1E, 0xF7, 0x18, 0x12, 0x47, 0x79, 0xAA, 0x6C, 0xE9, 0x35, 0x48, 0x3B, 0x94, 0x6E, 0x4C, 0xD9,
+    0x4E, 0xE8, 0xFC, 0xA8, 0x9C, 0x73, 0x14, 0x39, 0xF4, 0x07, 0x33, 0xD2, 0xEE, 0x6C, 0x0F, 0x57,
+    0x9A, 0xDE, 0x26, 0x57, 0x16, 0xBC, 0xD1, 0xD3, 0xA0, 0x3C, 0xA6, 0x4C, 0xAF, 0x30, 0x44, 0x79,
+    0x32, 0xEA, 0x82, 0x98, 0xAC, 0xEF, 0x6B, 0x65, 0xB7, 0x6A, 0x3B, 0x26, 0x4C, 0x79, 0xD5, 0xDA,
+    0xA9, 0xE8, 0x5A, 0x6F, 0xED, 0x79, 0x5B, 0x97, 0x33, 0x34, 0x0D, 0xE9, 0xA6, 0xD7, 0x96, 0xBD,
+    0xAE, 0xD8, 0x6B, 0x57, 0xF3, 0x52, 0x5A, 0xB1, 0xA9, 0xD7, 0x54, 0x6C, 0x8A, 0x10, 0x23, 0x2A,
+    0x64, 0x8F, 0x0E, 0x22, 0xEB, 0xBB, 0x9E, 0x19, 0x84, 0x8D, 0x7B, 0xD6, 0x67, 0x83, 0x51, 0x15,
+    0xE6, 0x16, 0xE3, 0x27, 0x1E, 0xFB, 0x46, 0x3B, 0x83, 0x2E, 0x04, 0x53, 0xC3, 0xE0, 0x88, 0x87,
+    0x9C, 0xFB, 0x60, 0xEC, 0x14, 0x42, 0x95, 0x30, 0x86, 0xDC, 0x5B, 0xBB, 0x20, 0x23, 0x6B, 0x73,
+    0xD2, 0x15, 0x1A, 0x0C, 0x8D, 0xE3, 0xAC, 0x50, 0xC3, 0x2F, 0x89, 0xB4, 0x2C, 0x11, 0x32, 0x88,
+    0x96, 0xBA, 0x06, 0x8C, 0xED, 0x69, 0x2E, 0x48, 0x81, 0xC3, 0xFD, 0x33, 0x15, 0x64, 0x94, 0x40,
+    0xE7, 0x4D, 0xAC, 0xD3, 0x7B, 0x05, 0xAB, 0x0E, 0xB8, 0xC9, 0xFB, 0x49, 0x89, 0x63, 0x34, 0x02,
+    0x67, 0x39, 0x6E, 0xAD, 0x17, 0xF0, 0x83, 0xA0, 0x06, 0xBC, 0xA7, 0xAF, 0x42, 0x2D, 0x87, 0x48,
+    0xD7, 0x1F, 0x41, 0x85, 0xAF, 0x78, 0x40, 0x5F, 0x16, 0xAE, 0x3D, 0x1B, 0x61, 0x2C, 0x63, 0x54,
+    0x71, 0xE6, 0x88, 0xE5, 0xFA, 0x39, 0x22, 0xB9, 0x51, 0xB1, 0x82, 0xBA, 0xB0, 0xB2, 0x43, 0xDB,
+    0xEA, 0xAE, 0x36, 0x89, 0xD5, 0x23, 0xE0, 0xB5, 0x7F, 0x86, 0xE1, 0x12, 0x58, 0x9E, 0x1E, 0x57,
+    0x06, 0x08, 0x77, 0x4D, 0x88, 0xBC, 0x1F, 0x59, 0xA4, 0x85, 0x8E, 0xAC, 0xE7, 0xCC, 0x15, 0x31,
+    0x59, 0xFD, 0x81, 0x78, 0xF4, 0xB9, 0x0C, 0xFE, 0x03, 0x65, 0x0C, 0x68, 0xD7, 0xCE, 0xDA, 0x57,
+    0xFB, 0xB2, 0x28, 0xEC, 0xB1, 0x6F, 0xB9, 0x97, 0x41, 0xDA, 0x92, 0x50, 0x83, 0xD7, 0x3F, 0xB6,
+    0xA9, 0x81, 0xBF, 0xD6, 0xF4, 0x80, 0xF3, 0x13, 0x86, 0x78, 0x8D, 0xF7, 0x92, 0x5E, 0x03, 0x57,
+    0xAF, 0xFB, 0x61, 0x7C, 0xA2, 0x6B, 0x6B, 0x1B, 0x6B, 0x95, 0xEE, 0x71, 0xAD, 0xC5, 0xA1, 0x6F,
+    0x0D, 0x78, 0x75, 0x7E, 0x5C, 0x76, 0x98, 0x64, 0xB9, 0x5A, 0x32, 0x89, 0x1D, 0x78, 0xFD, 0x15,
+    0xEC, 0xF1, 0x11, 0xBF, 0x68, 0xB1, 0xEE, 0xC6, 0x2F, 0x58, 0x49, 0x7A, 0x16, 0x7B, 0x23, 0x4B,
+    0x2F, 0xC1, 0xA5, 0x07, 0x47, 0x7E, 0x15, 0x3E, 0xD1, 0xCB, 0x7A, 0xF5, 0x6B, 0xA3, 0xE8, 0xA1,
+    0xBA, 0x2F, 0x7B, 0x3B, 0x97, 0x61, 0x6F, 0xF1, 0xFC, 0xD2, 0xFC, 0x31, 0x2C, 0x80, 0xF9, 0x77,
+    0x44, 0x05, 0x3F, 0x2E, 0x51, 0xA5, 0xF6, 0x22, 0x46, 0x1F, 0x39, 0xC5, 0x6B, 0xEB, 0x6B, 0x82,
+    0x93, 0xAF, 0x6D, 0x8C, 0x85, 0x5D, 0xD2, 0xB3, 0x32, 0x87, 0xD8, 0xF4, 0x65, 0x06, 0x89, 0xFC,
+    0xCA, 0x8A, 0x59, 0xF2, 0xBE, 0x5C, 0xCA, 0xFE, 0x86, 0x5E, 0x7F, 0xC9, 0xAC, 0x24, 0x5E, 0xD1,
+    0x4B, 0x3B, 0xF5, 0x53, 0x2F, 0x41, 0x7C, 0x6D, 0xE1, 0xB1, 0xBD, 0x8C, 0xB4, 0x34, 0x70, 0x89,
+    0x26, 0x0E, 0xB1, 0x01, 0xCD, 0xCA, 0xD0, 0xFB, 0x0D, 0x0A, 0xAD, 0x84, 0x2A, 0x2F, 0x53, 0x95,
+    0xFF, 0x03, 0x39, 0xE3, 0xF3, 0xF5, 0x4F, 0x6D, 0x04, 0x12, 0x3F, 0x1A, 0x9C, 0x8F, 0x18, 0x5E,
+    0xED, 0x68, 0x16, 0x65, 0xA8, 0xA9, 0xA8, 0x8A, 0x89, 0x28, 0x87, 0x61, 0xF0, 0x2E, 0x14, 0xAF,
+    0x00, 0x3B, 0xB9, 0xC8, 0x5A, 0x06, 0xB0, 0x97, 0xA2, 0xBB, 0xA2, 0x4A, 0x74, 0x65, 0x2F, 0xAD,
+    0x6B, 0x58, 0x5A, 0x77, 0x4D, 0x9C, 0x29, 0xE1, 0x3C, 0xE4, 0xF7, 0x64, 0xCD, 0xF7, 0x13, 0x70,
+    0x40, 0xCF, 0x77, 0x68, 0xAF, 0x96, 0x18, 0xA8, 0x0E, 0xFF, 0x12, 0xFC, 0xD7, 0x03, 0x67, 0x84,
+    0xBF, 0xFC, 0x1D, 0x36, 0xEF, 0xC1, 0x42, 0xB6, 0xA1, 0xE5, 0x23, 0xE9, 0x32, 0x44, 0x40, 0xC9,
+    0xA9, 0x60, 0xD2, 0x45, 0xC7, 0x67, 0xA2, 0x7D, 0x8B, 0xE5, 0x22, 0x49, 0x93, 0x07, 0xEA, 0x12,
+    0x69, 0x24, 0x54, 0x70, 0xD4, 0x9A, 0x6F, 0x4D, 0x6A, 0x2D, 0x18, 0x00, 0xE2, 0x0C, 0xF9, 0x38,
+    0x99, 0xE4, 0x62, 0x53, 0xBF, 0x7C, 0xD9, 0xD6, 0x72, 0xB8, 0x9A, 0x63, 0x73, 0x07, 0x81, 0xC5,
+    0xB0, 0xC3, 0xE3, 0xD6, 0x03, 0x58, 0xB9, 0x4C, 0x39, 0x5F, 0x5B, 0xEB, 0xBD, 0x6D, 0x05, 0xBD,
+    0xA9, 0xEB, 0x90, 0xED, 0xEB, 0x93, 0x0D, 0x2A, 0x78, 0x2B, 0x4C, 0xDD, 0xD1, 0xA9, 0x10, 0x46,
+    0x28, 0x96, 0x58, 0x94, 0x21, 0x37, 0x58, 0x74, 0x59, 0x07, 0x19, 0xA7, 0x2B, 0xEE, 0x40, 0xE5,
+    0xBE, 0xA3, 0xF9, 0x89, 0x91, 0x19, 0xCA, 0x08, 0x6E, 0x98, 0x1B, 0xA7, 0xD0, 0x82, 0xAF, 0x15,
+    0x48, 0x51, 0x8B, 0xFF, 0x2D, 0x78, 0x8B, 0x80, 0x00, 0x14, 0x87, 0xEF, 0x2E, 0xB3, 0x15, 0xFD,
+    0xDE, 0x17, 0x7D, 0xEE, 0x17, 0x54, 0xE2, 0xF2, 0xAD, 0x4E, 0x48, 0x2C, 0xB7, 0xB8, 0x00, 0x91,
+    0x5F, 0xEB, 0x6D, 0x51, 0xF2, 0xDF, 0x14, 0x84, 0x10, 0xA5, 0x2D, 0x48, 0x5F, 0x6C, 0x86, 0x28,
+    0xB2, 0x4F, 0xDC, 0x41, 0xF8, 0xC0, 0x40, 0x78, 0xA3, 0x8C, 0x04, 0x15, 0x2E, 0x85, 0x45, 0x8C,
+    0x78, 0x49, 0x9C, 0xF5, 0xD2, 0x0D, 0xD3, 0x19, 0x8B, 0xE8, 0x43, 0x73, 0x3C, 0x8E, 0xC5, 0x2F,
+    0x44, 0xD0, 0xAD, 0xE7, 0x6C, 0xC6, 0x9B, 0x2A, 0x33, 0x7C, 0x5B, 0x34, 0x63, 0xA2, 0xFE, 0xB4,
+    0x50, 0x6B, 0x11, 0x29, 0x92, 0x3B, 0x66, 0x3B, 0x37, 0x72, 0x8D, 0x58, 0x3A, 0x8F, 0xD2, 0xBB,
+    0x82, 0x72, 0x20, 0x74, 0x56, 0x5D, 0xB7, 0xA3, 0xFC, 0xA1, 0x6D, 0x6C, 0x2F, 0x02, 0xF2, 0x15,
+    0x9F, 0xEF, 0xF5, 0xD5, 0x6D, 0x43, 0xF9, 0x60, 0xF3, 0x4B, 0x73, 0xAB, 0x26, 0x79, 0xA0, 0x37,
+    0x80, 0x69, 0x11, 0x6B, 0xFC, 0xE7, 0x44, 0x2D, 0xFA, 0xB1, 0x47, 0xA4, 0x5F, 0xDE, 0xFF, 0xF3,
+    0x37, 0x58, 0x85, 0x35, 0x27, 0x4F, 0x4A, 0xBE, 0x07, 0x57, 0x70, 0x28, 0x26, 0xAA, 0x63, 0xEE,
+    0x6B, 0x30, 0xAF, 0xCC, 0x0C, 0x50, 0x6E, 0x5F, 0xCF, 0x56, 0x7C, 0xCF, 0xE6, 0x02, 0x65, 0xC2,
+    0x7B, 0x7B, 0xE9, 0x5C, 0xFD, 0xBA, 0x89, 0x57, 0x1B, 0xA4, 0x7B, 0xB7, 0x49, 0x1E, 0x41, 0xF5,
+    0xD8, 0x45, 0xE0, 0x24, 0x01, 0xA1, 0xB1, 0x10, 0x44, 0xE8, 0x1E, 0x55, 0xFE, 0xA6, 0x01, 0xA4,
+    0x67, 0xC6, 0x0A, 0x9E, 0x86, 0x21, 0xB4, 0xCF, 0x69, 0x05, 0x42, 0x64, 0xE2, 0x01, 0xF3, 0xAD,
+    0xD3, 0x6C, 0xE3, 0x52, 0x70, 0xC6, 0xA1, 0xDB, 0x91, 0xDB, 0x18, 0x1A, 0xA6, 0x3F, 0x40, 0xC1,
+    0x82, 0x75, 0x39, 0x9E, 0xAD, 0x1A, 0xBC, 0x7B, 0xAC, 0x9D, 0x00, 0x0A, 0xA3, 0x1C, 0x0D, 0x34,
+    0xB8, 0x5A, 0xF4, 0xA7, 0x61, 0x30, 0x96, 0x4D, 0x35, 0x89, 0xEF, 0xC9, 0xC7, 0x19, 0x63, 0x41,
+    0x9C, 0xA1, 0x31, 0x2A, 0x1A, 0x08, 0x29, 0x80, 0x68, 0x2E, 0xF3, 0x5E, 0xEA, 0x27, 0xA5, 0xF7,
+    0xC3, 0xC1, 0x67, 0x4B, 0xFF, 0x89, 0xA1, 0xB0, 0x4B, 0xDA, 0x11, 0xC0, 0x63, 0x16, 0x38, 0x08,
+    0xEC, 0x31, 0x0B, 0x28, 0x35, 0x3B, 0x19, 0x0A, 0xD6, 0x38, 0x11, 0x66, 0x8B, 0x02, 0xDB, 0xB3,
+    0x05, 0x41, 0xEB, 0xD9, 0x79, 0x47, 0x16, 0xD3, 0xF1, 0xD3, 0xB0, 0x5F, 0xDD, 0x2F, 0x46, 0x07,
+    0xBE, 0x31, 0x45, 0xCD, 0x9D, 0xA4, 0x28, 0x19, 0x92, 0xF3, 0x8B, 0x6D, 0xBB, 0x1D, 0xE6, 0x66,
+    0xF7, 0x62, 0xA4, 0x2E, 0x04, 0xBE, 0xB2, 0xC5, 0x48, 0xAC, 0x43, 0x6A, 0x01, 0x48, 0xB5, 0xE2,
+    0xFF, 0xB2, 0x6A, 0x36, 0x92, 0x7A, 0x64, 0xC6, 0x89, 0x68, 0xBC, 0x51, 0x5B, 0xDE, 0x32, 0x04,
+    0xCB, 0x0C, 0x5B, 0x28, 0x46, 0x6A, 0xE1, 0x51, 0xA8, 0x83, 0xEC, 0xB3, 0x54, 0x80, 0x25, 0x03,
+    0xF2, 0x88, 0x91, 0xF1, 0x36, 0x1F, 0x2D, 0x67, 0x9B, 0x5C, 0x10, 0x6B, 0xEE, 0xF5, 0x72, 0x04,
+    0xF3, 0x10, 0x0E, 0x45, 0x66, 0x2E, 0x4E, 0xDD, 0x41, 0xF2, 0xB0, 0x3B, 0x68, 0xD7, 0xCF, 0x0C,
+    0x36, 0xFC, 0x5A, 0x34, 0xF0, 0x67, 0x4B, 0xA4, 0xB9, 0x05, 0x66, 0x88, 0x52, 0x20, 0xC8, 0x33,
+    0xD1, 0x4C, 0xAC, 0x19, 0x95, 0x4D, 0xED, 0x34, 0xDA, 0x14, 0xDE, 0xCE, 0x64, 0x53, 0xBC, 0x1F,
+    0x93, 0x5F, 0x52, 0x8C, 0x47, 0x8C, 0x96, 0xA4, 0x62, 0x3C, 0xC7, 0x91, 0x9E, 0x13, 0xFC, 0x57,
+    0x77, 0x00, 0x4C, 0x28, 0x90, 0x12, 0xA1, 0xBE, 0x8A, 0xE5, 0xF2, 0x15, 0xC3, 0x45, 0x43, 0x16,
+    0x56, 0x0F, 0x09, 0x4E, 0x87, 0xDC, 0xBB, 0x2E, 0x37, 0xA7, 0x95, 0x4F, 0x6B, 0xAA, 0x93, 0x69,
+    0xA9, 0xFD, 0x51, 0xE1, 0xDB, 0xFE, 0x72, 0x21, 0xEC, 0x85, 0x5C, 0xDA, 0xE3, 0x94, 0x66, 0x0F,
+    0x7D, 0x0A, 0x1E, 0x04, 0x5A, 0xE0, 0x6A, 0x2A, 0x43, 0x88, 0x27, 0x41, 0xEF, 0x00, 0x97, 0x99,
+    0x0A, 0xF5, 0xB3, 0x15, 0x6E, 0xDD, 0x2D, 0x9A, 0xEA, 0xEE, 0xF6, 0xA4, 0xB4, 0x45, 0x53, 0x99,
+    0xDA, 0xF9, 0xF4, 0x24, 0x33, 0xCA, 0x2F, 0x0E, 0xC8, 0x4D, 0xC4, 0xCC, 0x97, 0x39, 0xC7, 0x03,
+    0x13, 0xC8, 0xF3, 0xC9, 0x2E, 0xDE, 0x3C, 0x0C, 0xEF, 0x60, 0xC8, 0xD2, 0x04, 0x9A, 0x0D, 0xD8,
+    0x1C, 0x0F, 0x78, 0xD7, 0xA4, 0x36, 0xA6, 0xF2, 0xF1, 0xD0, 0x67, 0xF2, 0xE1, 0xF4, 0xAC, 0xEB,
+    0x12, 0xBE, 0xD1, 0xB3, 0x08, 0x30, 0xB5, 0xBC, 0x3C, 0xB4, 0xDD, 0x21, 0x62, 0x9E, 0xBC, 0xA6,
+    0xD6, 0xC7, 0x1B, 0xAC, 0x69, 0x7B, 0x8E, 0xBB, 0xD9, 0x13, 0x50, 0x2C, 0x9C, 0xEC, 0x56, 0x71,
+    0x2A, 0x0C, 0x9A, 0xC9, 0x27, 0x51, 0xC6, 0xE4, 0xB5, 0x37, 0x10, 0xBC, 0x99, 0x25, 0x9A, 0xFC,
+    0x0D, 0xD2, 0xB6, 0xA1, 0xAE, 0x0E, 0x59, 0x51, 0x28, 0x8B, 0x38, 0xC2, 0xBA, 0x17, 0x51, 0xDB,
+    0xC7, 0xF8, 0x89, 0x78, 0x22, 0x27, 0xF1, 0xA3, 0x38, 0x73, 0xCB, 0x4B, 0x5A, 0xB9, 0xE3, 0x88,
+    0xC7, 0x23, 0x24, 0x11, 0x31, 0xFA, 0x5D, 0xAE, 0x25, 0x6B, 0xF0, 0x7C, 0x3C, 0x14, 0x9C, 0x51,
+    0x83, 0x22, 0x97, 0xA9, 0xBD, 0x6C, 0x5A, 0x96, 0x69, 0xFD, 0xAB, 0x26, 0xA8, 0xE2, 0xE7, 0x33,
+    0x11, 0x81, 0xD9, 0xD6, 0x0E, 0x7F, 0xDD, 0x96, 0x11, 0xFB, 0xAC, 0x09, 0x36, 0xF3, 0xD5, 0xDC,
+    0x73, 0xB2, 0xB3, 0x1B, 0x3D, 0x71, 0x72, 0x46, 0x90, 0x9D, 0xA1, 0xD9, 0x10, 0x40, 0xD1, 0xEF,
+    0x98, 0xC5, 0x28, 0x43, 0xE3, 0xD7, 0x22, 0x0A, 0x47, 0x96, 0xCC, 0x42, 0xC2, 0xCA, 0xC0, 0x73,
+    0x28, 0x78, 0x8F, 0xCD, 0x65, 0xC8, 0x52, 0x64, 0x44, 0xA4, 0x82, 0x22, 0xFA, 0x72, 0x01, 0x53,
+    0x16, 0x3E, 0x99, 0x75, 0xA1, 0xFC, 0x5E, 0x66, 0x38, 0x28, 0xF8, 0x5F, 0x04, 0x95, 0xA2, 0xCE,
+    0xA3, 0x6F, 0x56, 0xEC, 0x0E, 0xAA, 0x09, 0x5D, 0x20, 0x6B, 0xB6, 0x30, 0x44, 0x1B, 0x61, 0x9A,
+    0x5E, 0x13, 0xDD, 0x01, 0x25, 0xF6, 0xD1, 0x1E, 0x79, 0x24, 0xB6, 0xBB, 0xF2, 0x38, 0x37, 0x60,
+    0xA8, 0xDD, 0x51, 0x5A, 0x1D, 0x06, 0x7B, 0x7F, 0xB5, 0x3F, 0x24, 0x29, 0x12, 0xC6, 0x66, 0xC5,
+    0x89, 0x64, 0xB3, 0x0E, 0x4A, 0xCF, 0x22, 0xEC, 0x89, 0xE1, 0x86, 0xC8, 0x08, 0x2C, 0x1E, 0x13,
+    0xFE, 0xC6, 0xB0, 0x13, 0xB2, 0xB7, 0x1C, 0xC9, 0x08, 0x3D, 0x8E, 0x4C, 0xC4, 0xBB, 0x44, 0xDD,
+    0x1E, 0x0B, 0xDD, 0x65, 0x6F, 0xC3, 0x1F, 0x5D, 0x68, 0x0B, 0xBD, 0xDF, 0x21, 0x70, 0x6F, 0xD7,
+    0x04, 0x9F, 0x03, 0xAD, 0xFF, 0x9E, 0x32, 0x4E, 0x8B, 0x81, 0x0F, 0x04, 0x86, 0x6A, 0xD4, 0x81,
+    0x5E, 0x21, 0xB7, 0x2C, 0xD9, 0x5C, 0x78, 0xCA, 0x34, 0x84, 0x3E, 0x28, 0xD1, 0x6A, 0xCE, 0x2E,
+    0xDE, 0xC2, 0x1A, 0x2C, 0xF6, 0x31, 0xB5, 0x40, 0x98, 0x64, 0x6F, 0xC0, 0x22, 0x0B, 0x61, 0x61,
+    0x7A, 0x22, 0x94, 0x8C, 0x2F, 0xD8, 0x46, 0x8C, 0xD7, 0xAD, 0x7C, 0xFE, 0x15, 0xD5, 0xFB, 0x3C,
+    0x09, 0xF2, 0x40, 0x79, 0x6A, 0xC6, 0x32, 0x18, 0xBD, 0x38, 0x3A, 0xAB, 0xFD, 0x33, 0x5C, 0xED,
+    0x8A, 0x30, 0x0B, 0x93, 0x44, 0xDF, 0x2B, 0x93, 0x67, 0x73, 0xC4, 0xA8, 0x3A, 0x22, 0x32, 0x95,
+    0xE9, 0x9F, 0xD3, 0x0A, 0xF4, 0x03, 0x4E, 0x45, 0x6A, 0x3B, 0x44, 0x67, 0xD3, 0x0B, 0x8B, 0x15,
+    0xDD, 0x8A, 0x1E, 0x0C, 0x0B, 0x42, 0xC1, 0xC3, 0x7A, 0x29, 0xDB, 0x2A, 0x01, 0xBC, 0x04, 0xFD,
+    0xB6, 0x16, 0x00, 0xB5, 0xB5, 0x56, 0xCC, 0x96, 0x31, 0x26, 0xA9, 0x87, 0x42, 0xE3, 0x38, 0x8F,
+    0x06, 0x42, 0xD1, 0x70, 0x6B, 0xD4, 0x13, 0x86, 0x73, 0xEB, 0x3E, 0x31, 0xFC, 0x1E, 0x1B, 0x22,
+    0x9B, 0xA3, 0xA5, 0x4B, 0xC8, 0x81, 0x97, 0x97, 0x41, 0xE1, 0xE2, 0xDB, 0x97, 0x27, 0x95, 0x5E,
+    0x76, 0x49, 0xDA, 0x95, 0xB5, 0xB3, 0xF7, 0x28, 0x86, 0x9F, 0xEB, 0x6C, 0x55, 0xAD, 0x0D, 0xA1,
+    0xF5, 0xF9, 0x2A, 0x12, 0x62, 0x9F, 0xB8, 0x14, 0xB2, 0x32, 0x27, 0xCC, 0xE8, 0xE3, 0xE4, 0xE0,
+    0x28, 0xF8, 0x77, 0x18, 0x3B, 0x8C, 0x76, 0x74, 0x58, 0x01, 0xC9, 0x0A, 0x44, 0xCA, 0xCC, 0x92,
+    0x8C, 0xF7, 0xCA, 0x6B, 0x45, 0xFC, 0xDE, 0xCA, 0xC4, 0xCF, 0xD4, 0x8F, 0x8A, 0x31, 0xAF, 0x1F,
+    0xD2, 0x10, 0x9E, 0x06, 0xEE, 0xD6, 0xD6, 0xF0, 0xE4, 0xFB, 0xD7, 0xD7, 0x31, 0xC7, 0x43, 0xFF,
+    0x68, 0x6E, 0xA7, 0xCE, 0xF8, 0x14, 0xBA, 0xFB, 0xC6, 0x59, 0x83, 0xBB, 0xE9, 0xA8, 0xB3, 0x99,
+    0x5F, 0xF8, 0xD2, 0xB6, 0x09, 0x7F, 0xEC, 0xC1, 0x80, 0x1D, 0x65, 0xB1, 0x31, 0xCA, 0x62, 0x37,
+    0xB4, 0x0C, 0x97, 0x65, 0xB1, 0xCE, 0xBB, 0x57, 0xC4, 0xB6, 0xCD, 0x36, 0xED, 0xDC, 0x9A, 0x7C,
+    0xC9, 0x9F, 0xF2, 0x97, 0x59, 0x52, 0xEA, 0x8D, 0xE1, 0x4E, 0xB7, 0xD9, 0xDB, 0xB0, 0x5B, 0xDB,
+    0x25, 0x86, 0x68, 0x40, 0x12, 0xD8, 0x88, 0x70, 0xAB, 0x9D, 0x09, 0xC8, 0xCD, 0x35, 0xFE, 0xEA,
+    0xA7, 0x4D, 0x7B, 0xE8, 0x34, 0x92, 0x3C, 0x7D, 0xB5, 0xEC, 0xF3, 0xA2, 0x6B, 0xE2, 0x10, 0xD4,
+    0x36, 0x77, 0xC1, 0x0C, 0x98, 0xB9, 0x31, 0x0A, 0x3A, 0x11, 0x3A, 0xD9, 0xD1, 0x93, 0xE8, 0x1D,
+    0x78, 0xCC, 0x46, 0x0A, 0xC7, 0x1A, 0xF2, 0x72, 0x7F, 0x33, 0x3C, 0xE0, 0x15, 0x27, 0x17, 0x65,
+    0x5F, 0x92, 0xD7, 0xA0, 0x6C, 0xF1, 0x6D, 0xB9, 0x1F, 0xF4, 0xC4, 0x5B, 0xA8, 0x13, 0x3E, 0xC4,
+    0x2D, 0xF3, 0x27, 0x74, 0x3B, 0x76, 0xF7, 0x5A, 0xB7, 0x5D, 0x0F, 0xCF, 0xDB, 0x58, 0x9C, 0x70,
+    0xC6, 0x30, 0x1E, 0x6F, 0x24, 0xAB, 0x90, 0xE8, 0x2F, 0x0E, 0x07, 0x97, 0x8E, 0x8B, 0x4E, 0x10,
+    0xD6, 0x11, 0x09, 0x47, 0xD2, 0xC9, 0x79, 0x4E, 0x54, 0xC6, 0xEA, 0xE2, 0xFC, 0xF8, 0x4B, 0xE6,
+    0x2F, 0xB7, 0x59, 0xB2, 0x71, 0xC3, 0x9E, 0xB5, 0x35, 0x00, 0xFB, 0x9B, 0x38, 0xFB, 0x1D, 0x36,
+    0x3A, 0xDD, 0x7C, 0xDC, 0x0D, 0xAA, 0x8A, 0xEE, 0x37, 0x50, 0xA6, 0xC8, 0x98, 0x38, 0x3F, 0x05,
+    0x38, 0xF8, 0xA3, 0x79, 0xE3, 0x66, 0xF7, 0xC8, 0x27, 0x5F, 0xF2, 0x52, 0xF3, 0x41, 0x3E, 0xF6,
+    0x29, 0x7A, 0xDD, 0x77, 0x21, 0x51, 0x4B, 0x93, 0x0C, 0xFF, 0x46, 0xA7, 0xF6, 0x37, 0x7F, 0x5A,
+    0xEC, 0xD3, 0xC0, 0x60, 0xF0, 0x81, 0x6E, 0xA8, 0xB1, 0x51, 0xE4, 0x85, 0x7B, 0xDC, 0xD7, 0x91,
+    0x88, 0x3D, 0xF8, 0x6C, 0x69, 0x59, 0xA0, 0xED, 0x31, 0x00, 0xDF, 0x1D, 0x33, 0xBC, 0x6B, 0xA2,
+    0xF8, 0xEC, 0xF7, 0x83, 0xEB, 0x0D, 0x11, 0x4C, 0xBF, 0xF1, 0x15, 0x6E, 0xF8, 0x08, 0x9B, 0x4F,
+    0x8E, 0x34, 0x9F, 0x2C, 0x36, 0x9F, 0x2C, 0xD8, 0x2A, 0x14, 0xEA, 0x0C, 0xFE, 0xE6, 0x90, 0xB7,
+    0x08, 0x50, 0x2E, 0x07, 0x4F, 0x95, 0x20, 0x38, 0xB2, 0xC1, 0x74, 0x45, 0x36, 0xDA, 0x46, 0x84,
+    0xD5, 0xBE, 0xFF, 0x85, 0xFE, 0xB9, 0x5E, 0x4E, 0x98, 0xB6, 0x5A, 0xBC, 0xA4, 0x98, 0x6F, 0x68,
+    0xA8, 0x41, 0x4E, 0xE3, 0xFC, 0x77, 0xF3, 0xC1, 0x3F, 0xF6, 0x35, 0xF1, 0xD1, 0x98, 0x4D, 0x32,
+    0x36, 0xEE, 0x1B, 0x0D, 0x6C, 0x66, 0x9B, 0x55, 0x95, 0xD6, 0x24, 0x2F, 0xD9, 0x33, 0x09, 0xB0,
+    0x76, 0x9D, 0xF8, 0xF9, 0xE6, 0x2E, 0x13, 0xD1, 0x6E, 0xDA, 0x8F, 0x66, 0xF8, 0xE8, 0x80, 0x9A,
+    0xE7, 0x33, 0x34, 0x47, 0x1A, 0xB7, 0x1E, 0xCC, 0x93, 0xF8, 0xB5, 0x2E, 0xE0, 0xF3, 0xEF, 0xDE,
+    0x8B, 0x53, 0x32, 0xBB, 0xB3, 0x6B, 0x2F, 0x4E, 0xB8, 0xB3, 0x17, 0xE7, 0x69, 0x96, 0xB6, 0x1E,
+    0x7F, 0xD7, 0x5E, 0x9C, 0xD6, 0x79, 0x66, 0x8C, 0xDA, 0x5A, 0xC5, 0x7A, 0x93, 0x5E, 0x9C, 0x83,
+    0xE8, 0xC5, 0x39, 0x85, 0x08, 0x5A, 0x52, 0x0F, 0x76, 0xB1, 0x9F, 0xDB, 0xA1, 0x49, 0xB4, 0xAD,
+    0x1B, 0xB6, 0xA9, 0x0F, 0xBC, 0x5B, 0xD8, 0x69, 0x49, 0xA4, 0x30, 0xF9, 0x13, 0x01, 0xC9, 0x36,
+    0x99, 0x69, 0x43, 0xCC, 0x71, 0x49, 0x17, 0xA7, 0xDA, 0x51, 0x35, 0x33, 0x13, 0x66, 0x66, 0x88,
+    0x59, 0x6C, 0x65, 0x22, 0xAF, 0x67, 0xB3, 0xC4, 0xFD, 0x56, 0x16, 0xBF, 0x19, 0x5E, 0x0F, 0x2B,
+    0x2A, 0x88, 0xBF, 0xB0, 0x29, 0xE5, 0x4B, 0x9A, 0x39, 0xF3, 0x8A, 0x49, 0xF1, 0xB5, 0x31, 0xDB,
+    0x3A, 0xCD, 0xA7, 0x6E, 0x18, 0xBC, 0x61, 0xB3, 0xBE, 0xF5, 0xDC, 0x0D, 0x6E, 0xD8, 0x6C, 0xC8,
+    0x75, 0xF4, 0xBE, 0x43, 0xAE, 0xC1, 0x24, 0xE4, 0xAA, 0x29, 0x8E, 0x69, 0x8A, 0xA8, 0x27, 0x5B,
+    0x77, 0x71, 0x6B, 0xF5, 0xC6, 0x34, 0x91, 0x4C, 0x20, 0x5A, 0x13, 0x83, 0xCF, 0x65, 0x85, 0x93,
+    0x97, 0x00, 0xE2, 0x2C, 0x2C, 0x7A, 0xA2, 0x49, 0x27, 0xA7, 0x05, 0x20, 0xA2, 0xBA, 0xD5, 0xCB,
+    0x27, 0xFD, 0x96, 0x83, 0x99, 0xF6, 0x8C, 0x70, 0xDA, 0x9E, 0xF1, 0xD2, 0x4B, 0x28, 0x58, 0xFE,
+    0x25, 0x42, 0x32, 0x6D, 0x01, 0x52, 0xFF, 0x15, 0xDD, 0x9D, 0xF5, 0x0F, 0xB0, 0x8B, 0x62, 0x8E,
+    0x56, 0x8C, 0x9B, 0xEE, 0xD6, 0x9E, 0x71, 0x70, 0xD2, 0x9E, 0xF1, 0xEE, 0x15, 0x3F, 0x3D, 0xF0,
+    0xCA, 0xE8, 0x5D, 0x2B, 0x7E, 0x1E, 0x47, 0x3D, 0xD2, 0x7F, 0x40, 0xC5, 0x4F, 0x3C, 0xA9, 0xF8,
+    0x91, 0xED, 0x0D, 0x5F, 0xFC, 0x32, 0x73, 0x6F, 0xFD, 0x9B, 0x54, 0xFC, 0x34, 0xD9, 0xA2, 0x3B,
+    0xA9, 0xC9, 0x55, 0x7C, 0xB4, 0x91, 0x75, 0x6B, 0xED, 0xB9, 0x5D, 0xEB, 0x7A, 0xC3, 0xF7, 0xEE,
+    0xD1, 0x68, 0x99, 0xC6, 0xD6, 0xDC, 0x74, 0xBD, 0x5A, 0x5F, 0xED, 0xB3, 0x99, 0xEB, 0x28, 0x36,
+    0x62, 0xEB, 0x85, 0x1B, 0x72, 0x7A, 0xB3, 0x1B, 0xB6, 0x33, 0xA7, 0x37, 0x9B, 0xD7, 0xB3, 0xBD,
+    0xAA, 0x5B, 0x6B, 0x3B, 0x7A, 0x55, 0x4F, 0x6A, 0x17, 0xE6, 0xF6, 0x49, 0xEF, 0x5D, 0x7E, 0x35,
+    0xB5, 0xD5, 0xC1, 0x1F, 0x78, 0xD2, 0xFB, 0xD6, 0xD6, 0x2E, 0x04, 0xE3, 0x75, 0x61, 0x3F, 0x61,
+    0xF2, 0xCA, 0xCD, 0x9D, 0x81, 0x93, 0x37, 0x09, 0xC9, 0x6F, 0x6C, 0x69, 0x88, 0xFB, 0x66, 0x09,
+    0xC9, 0x0F, 0x34, 0x51, 0x13, 0x7D, 0x87, 0x62, 0x80, 0x82, 0x98, 0xD3, 0xB5, 0xAD, 0x25, 0xB7,
+    0x62, 0xD0, 0x54, 0xB1, 0x0E, 0x9B, 0xC1, 0x41, 0xE3, 0xF1, 0x41, 0x94, 0x24, 0xA0, 0x87, 0x7F,
+    0x66, 0xBF, 0x5C, 0x9B, 0xA8, 0x6A, 0xCB, 0x1B, 0xD1, 0xE9, 0x83, 0x18, 0x84, 0x53, 0x37, 0x31,
+    0x88, 0x9B, 0x2D, 0xC8, 0xDB, 0xBA, 0x80, 0xEE, 0x06, 0x59, 0x90, 0x60, 0x22, 0x26, 0xEE, 0x59,
+    0xBB, 0x06, 0x8D, 0xD0, 0x8F, 0x52, 0xF9, 0xEE, 0x4C, 0xFD, 0xF9, 0x1D, 0xB2, 0xC4, 0x05, 0xBA,
+    0x4E, 0x02, 0x2C, 0xBF, 0x57, 0x6A, 0xE7, 0x66, 0x54, 0xF8, 0x75, 0x25, 0xF6, 0x26, 0x29, 0xF7,
+    0xD6, 0xAB, 0x61, 0x6D, 0x4E, 0x9E, 0x93, 0x5D, 0xBB, 0x3F, 0x32, 0xF7, 0x22, 0x4E, 0x7F, 0xEE,
+    0x0E, 0x63, 0x0E, 0x33, 0x19, 0x0D, 0x3B, 0x37, 0xA4, 0x22, 0x0B, 0x44, 0x05, 0xB1, 0x57, 0x3B,
+    0xAD, 0xD8, 0xAF, 0xE1, 0xBD, 0x38, 0x50, 0xCF, 0xE0, 0xE7, 0x6F, 0x53, 0x9D, 0x47, 0x0A, 0x11,
+    0xCD, 0xF8, 0xA1, 0xFF, 0xBB, 0x41, 0x2C, 0xC5, 0x50, 0x34, 0x04, 0x93, 0xC9, 0x82, 0x90, 0x68,
+    0x89, 0xDE, 0x54, 0xAE, 0x3D, 0x04, 0x61, 0xC6, 0x0E, 0x32, 0x99, 0x9C, 0x4F, 0xBD, 0x1D, 0x43,
+    0x5D, 0xCF, 0x0F, 0x9C, 0xDE, 0xAA, 0xD8, 0x95, 0xF6, 0x6A, 0x20, 0xB4, 0xED, 0x59, 0xBF, 0xC8,
+    0x76, 0x8D, 0x4C, 0x34, 0x57, 0x73, 0x7A, 0x40, 0x63, 0xAC, 0xBD, 0x06, 0xA1, 0xCC, 0xA4, 0xFF,
+    0x01, 0x4D, 0xC7, 0xA8, 0x2E, 0x11, 0xAD, 0xBE, 0x9E, 0x7B, 0x4F, 0x0C, 0xFD, 0x7C, 0xD1, 0x2F,
+    0xF6, 0x9A, 0x6E, 0x90, 0x57, 0xD0, 0x82, 0x2B, 0xE1, 0x13, 0xA5, 0xCB, 0xF8, 0xC0, 0x83, 0xE4,
+    0xF8, 0xA5, 0xF0, 0x21, 0xDE, 0xBD, 0xB5, 0xBE, 0xAE, 0x31, 0x05, 0x9B, 0x7C, 0xEE, 0x2C, 0x69,
+    0xBE, 0xB9, 0x5A, 0x0C, 0xB5, 0x0E, 0xF6, 0x3C, 0xAE, 0x97, 0xBD, 0xFE, 0xF9, 0x30, 0xDF, 0x63,
+    0x2A, 0x3F, 0xEF, 0x04, 0xC5, 0x3D, 0x66, 0x14, 0x0B, 0x79, 0xB6, 0x2A, 0xE4, 0x08, 0x07, 0x8E,
+    0x98, 0x01, 0x7A, 0xD0, 0x7B, 0xCE, 0xD8, 0xC9, 0x34, 0x81, 0x45, 0x8B, 0x18, 0x1A, 0x77, 0xCF,
+    0x2E, 0xA7, 0xC1, 0x16, 0xCE, 0x0B, 0x13, 0x47, 0x80, 0x4D, 0x9D, 0x3F, 0x1B, 0xC1, 0xE0, 0x24,
+    0xA9, 0x56, 0x14, 0x0E, 0x40, 0x85, 0x7B, 0x77, 0x48, 0x35, 0xCC, 0xDD, 0xDE, 0xE5, 0xBE, 0xB1,
+    0xD5, 0x29, 0x51, 0xBF, 0x41, 0xB1, 0x8D, 0x94, 0xDC, 0xA5, 0xC5, 0xF4, 0xAC, 0x56, 0x73, 0x51,
+    0x71, 0x2D, 0xB4, 0x4E, 0xDE, 0x10, 0x28, 0xCD, 0xCA, 0x43, 0xD5, 0x3C, 0xA4, 0xA6, 0xEE, 0x2D,
+    0x86, 0xEF, 0x4D, 0x32, 0xA2, 0x04, 0x3F, 0xCB, 0x15, 0x0A, 0x77, 0x53, 0x24, 0x7E, 0x02, 0x61,
+    0x35, 0x37, 0x6D, 0x64, 0xA7, 0xA5, 0x79, 0xD8, 0x8B, 0xD5, 0x04, 0xE7, 0xDE, 0x27, 0xAF, 0x8A,
+    0x69, 0xE2, 0x96, 0x69, 0x7F, 0x19, 0x25, 0x45, 0x85, 0x1A, 0xFD, 0xE3, 0xD6, 0xF0, 0xC9, 0xCB,
+    0x6D, 0x59, 0xBF, 0xFB, 0x94, 0x9A, 0xEF, 0x80, 0xD6, 0xBB, 0x0D, 0x09, 0x71, 0x06, 0x57, 0x18,
+    0x7C, 0xB9, 0x17, 0xB5, 0xFB, 0x14, 0x92, 0xFD, 0x94, 0x92, 0x63, 0x1C, 0xCF, 0x72, 0x24, 0x38,
+    0x7A, 0x6A, 0xA6, 0x6F, 0xF5, 0x21, 0xB6, 0x7F, 0x19, 0xED, 0x58, 0x1D, 0x52, 0x51, 0x28, 0xF8,
+    0x6E, 0x4F, 0x92, 0x5E, 0x3C, 0xD4, 0x03, 0x09, 0xAF, 0x1C, 0xDA, 0x22, 0x44, 0x33, 0x47, 0xEE,
+    0xB1, 0x88, 0xCE, 0xE6, 0xC8, 0x14, 0x9C, 0x1D, 0x37, 0x13, 0x4D, 0x6B, 0xC7, 0x2F, 0x4E, 0x4B,
+    0x27, 0xFE, 0xAD, 0x89, 0x4B, 0x71, 0x7E, 0x85, 0x9B, 0x9F, 0xCA, 0xBC, 0xFE, 0x61, 0x57, 0x04,
+    0xEF, 0x24, 0x36, 0x10, 0xD9, 0x9C, 0xAB, 0x4C, 0x95, 0x83, 0xC7, 0x31, 0xA5, 0xE8, 0x41, 0x9C,
+    0x1F, 0xA0, 0x67, 0x7A, 0x74, 0xAD, 0xAB, 0xBE, 0x84, 0x5D, 0x5C, 0x41, 0xEC, 0xB9, 0xC3, 0x68,
+    0xB4, 0x7D, 0xC0, 0xC9, 0xC9, 0x91, 0x4D, 0x93, 0xE8, 0x27, 0x79, 0xEE, 0xDF, 0x28, 0x69, 0xFC,
+    0x8A, 0xCD, 0x0D, 0xEC, 0x5E, 0x5F, 0x59, 0x64, 0x9C, 0xEC, 0x10, 0x0A, 0xD4, 0xA0, 0x7C, 0x7F,
+    0xF2, 0x14, 0x9E, 0x77, 0xF5, 0x5B, 0x20, 0xCA, 0x0F, 0xFF, 0x15, 0xC6, 0x97, 0x81, 0xCA, 0xA2,
+    0x6F, 0xF5, 0x49, 0x1A, 0x12, 0xE5, 0x4F, 0x99, 0x1F, 0x3C, 0xCC, 0x46, 0x92, 0x63, 0x20, 0xC4,
+    0xCA, 0x02, 0x18, 0xA7, 0x7B, 0x12, 0x3C, 0x34, 0x6C, 0x8A, 0xBF, 0xD8, 0xD2, 0x2B, 0x5C, 0x71,
+    0x90, 0x2D, 0xBD, 0xCC, 0x03, 0xA2, 0x22, 0x6F, 0x3E, 0x13, 0xE0, 0xD1, 0x13, 0x1F, 0xCB, 0xFD,
+    0x79, 0xE1, 0xF5, 0xFD, 0x34, 0xF3, 0x7F, 0xF2, 0xDF, 0xB0, 0x56, 0x79, 0x4A, 0xF0, 0x43, 0x20,
+    0xA8, 0x37, 0xB1, 0x6A, 0x3C, 0x28, 0xFA, 0x17, 0x08, 0x95, 0xE0, 0x31, 0xC9, 0x31, 0xC6, 0x26,
+    0xE4, 0xF6, 0x8C, 0x57, 0xAC, 0x20, 0xBA, 0xD1, 0x21, 0xA8, 0xBD, 0x71, 0xA3, 0x1F, 0x79, 0x1B,
+    0x1B, 0x5D, 0xD7, 0x5F, 0xF9, 0x98, 0x37, 0xDA, 0x1D, 0x4D, 0x4B, 0x2E, 0x6C, 0xD5, 0x64, 0x87,
+    0x81, 0xF1, 0xE7, 0xEC, 0xA0, 0x07, 0xEE, 0x0C, 0x64, 0x87, 0xDD, 0x5D, 0x76, 0xD8, 0xFF, 0x10,
+    0x3B, 0xDC, 0x14, 0x2D, 0x88, 0xA9, 0x17, 0x8F, 0x3A, 0x5C, 0x1B, 0xA7, 0xC9, 0xF0, 0x4E, 0x99,
+    0x56, 0x75, 0xFE, 0x90, 0x3B, 0x70, 0x8A, 0xFB, 0xC0, 0xE4, 0x19, 0x83, 0x77, 0x34, 0xDF, 0x77,
+    0x32, 0xE8, 0xBD, 0x60, 0x6C, 0xF9, 0x85, 0x09, 0xFF, 0x27, 0x8D, 0x03, 0x5D, 0xA8, 0xE8, 0x3F,
+    0x0F, 0x29, 0xEE, 0xA3, 0x49, 0x74, 0x29, 0xB1, 0x46, 0x16, 0x8E, 0x6E, 0x8B, 0xDA, 0xA0, 0x3B,
+    0xDD, 0x49, 0x7F, 0x9C, 0xFA, 0x9B, 0x42, 0xEC, 0xC2, 0xA9, 0xC5, 0x6E, 0x67, 0xCE, 0x95, 0x64,
+    0x3D, 0x0F, 0xC6, 0x67, 0xC3, 0xFC, 0xC8, 0x91, 0xC7, 0xC3, 0xEC, 0x2C, 0x0C, 0x01, 0xE7, 0x8F,
+    0xC4, 0x37, 0x7C, 0x94, 0xA4, 0x4B, 0x4E, 0x93, 0x2F, 0x57, 0x60, 0x2E, 0x3A, 0x2C, 0x50, 0x63,
+    0xD6, 0x08, 0xB6, 0x15, 0x19, 0x23, 0x21, 0x4C, 0x3B, 0x45, 0x29, 0x52, 0x7F, 0x67, 0x93, 0x72,
+    0x39, 0x69, 0x52, 0x2E, 0x77, 0x36, 0x29, 0x87, 0x3B, 0x9B, 0x94, 0xC3, 0xF7, 0x68, 0x52, 0xB6,
+    0xDD, 0xC9, 0x2B, 0x93, 0x26, 0x65, 0xDB, 0x9D, 0xBC, 0xB2, 0xB3, 0x49, 0xF9, 0xA0, 0x36, 0x29,
+    0x13, 0x6B, 0xAB, 0x32, 0x8D, 0x2C, 0xC8, 0xDE, 0x86, 0xB5, 0x9B, 0x4B, 0xB6, 0xCD, 0x4A, 0x50,
+    0x90, 0x8F, 0x22, 0xF1, 0xC9, 0x76, 0xB5, 0x15, 0x48, 0x1C, 0x7B, 0xDD, 0x6C, 0x27, 0x6F, 0x40,
+    0xA8, 0x78, 0xED, 0x22, 0x32, 0x9E, 0x17, 0x91, 0xCC, 0x66, 0x45, 0xA0, 0x76, 0xC5, 0x20, 0x04,
+    0xC7, 0x7A, 0x67, 0x96, 0x39, 0xFB, 0xEF, 0x64, 0x48, 0x63, 0xE3, 0xF6, 0x9F, 0x4D, 0x1B, 0xBB,
+    0x13, 0x4E, 0x1C, 0x3E, 0xA8, 0xBC, 0xA8, 0xB2, 0xFE, 0xAB, 0x66, 0x06, 0x53, 0xA5, 0xDB, 0xBA,
+    0xED, 0x6B, 0x0E, 0x2D, 0xE5, 0x02, 0x4B, 0xBA, 0x60, 0x42, 0xBB, 0x86, 0x78, 0x0D, 0xF5, 0x1A,
+    0xF2, 0x35, 0xF4, 0x23, 0x01, 0x33, 0x33, 0xA1, 0x60, 0x43, 0xC2, 0x86, 0x86, 0x0D, 0x11, 0x1B,
+    0x2A, 0x36, 0x64, 0xB4, 0x74, 0x6C, 0x08, 0xD9, 0x50, 0x52, 0x49, 0x59, 0x28, 0x69, 0xD6, 0x20,
+    0xF3, 0xC2, 0x32, 0x20, 0x8E, 0x87, 0x72, 0xA7, 0x8E, 0x87, 0x22, 0xEF, 0xA1, 0x9B, 0x92, 0x3E,
+    0x4A, 0x20, 0xA5, 0x90, 0x92, 0x48, 0x69, 0xA4, 0x44, 0x52, 0x2A, 0x29, 0x99, 0x94, 0x4E, 0x4A,
+    0x28, 0x24, 0xFC, 0xC7, 0x13, 0xCF, 0x2E, 0xB1, 0x67, 0x05, 0x08, 0xCC, 0xBA, 0x38, 0x9A, 0x39,
+    0xDB, 0x49, 0xAE, 0x5C, 0x2D, 0x92, 0x04, 0xF9, 0xCC, 0x19, 0x4F, 0x3B, 0xCF, 0x76, 0x0A, 0x73,
+    0x5D, 0x2D, 0xBA, 0xC8, 0x4F, 0xAB, 0x25, 0x64, 0xE5, 0x97, 0x2C, 0xB9, 0xFD, 0x35, 0x9E, 0xD9,
+    0x82, 0x32, 0xAF, 0x0C, 0x4B, 0xEF, 0xAA, 0x0E, 0xD2, 0x43, 0x54, 0xBA, 0x36, 0xEC, 0xCE, 0xB3,
+    0x9D, 0x08, 0xCB, 0xD4, 0x55, 0xA8, 0x74, 0x06, 0x42, 0x8D, 0xF9, 0x4D, 0x79, 0x68, 0x0F, 0x67,
+    0x3C, 0x65, 0x4D, 0xCE, 0xA9, 0xB9, 0x32, 0x58, 0xE4, 0xAB, 0x07, 0x88, 0xE9, 0x74, 0xF5, 0x87,
+    0x6A, 0x68, 0x03, 0x86, 0xCF, 0x0D, 0x8B, 0x0D, 0x27, 0x21, 0x86, 0xA3, 0x6B, 0x6B, 0x02, 0xD2,
+    0xE3, 0xAD, 0xB5, 0xDE, 0xEB, 0xB6, 0x33, 0xD2, 0xE3, 0xB9, 0x06, 0x6C, 0x6B, 0x62, 0x36, 0xD5,
+    0x28, 0xCF, 0xE1, 0x19, 0xE3, 0xE7, 0xE5, 0xA6, 0x02, 0xFB, 0xB2, 0x48, 0x24, 0x2D, 0xE8, 0xC7,
+    0xC2, 0x17, 0x08, 0x8B, 0xC3, 0x9B, 0x59, 0x62, 0xC3, 0x00, 0x68, 0xEA, 0x0C, 0x56, 0x40, 0xFF,
+    0x41, 0x47, 0x5B, 0xB6, 0xB6, 0x95, 0xB1, 0xBB, 0x0A, 0xF4, 0x2C, 0x9A, 0x65, 0xC0, 0xF2, 0x17,
+    0x8C, 0x67, 0xD5, 0x93, 0xC3, 0xCE, 0x90, 0x8D, 0xF0, 0x37, 0xFF, 0xC2, 0xAE, 0xA5, 0xAB, 0x30,
+    0xA1, 0x97, 0xFB, 0xA5, 0xF7, 0x4E, 0x19, 0x8A, 0x69, 0xAF, 0x90, 0x0B, 0x1B, 0xC6, 0x59, 0x82,
+    0xFE, 0xE7, 0x0D, 0xB4, 0x3F, 0x8F, 0xCC, 0xB0, 0x2D, 0x7A, 0x00, 0x83, 0x5B, 0xB5, 0x9C, 0xA1,
+    0x37, 0xC0, 0x50, 0xCA, 0x97, 0xA8, 0x73, 0x1B, 0x46, 0x99, 0x68, 0x25, 0x38, 0x65, 0x6D, 0xE0,
+    0xD6, 0x36, 0x3B, 0xCB, 0xDF, 0xBE, 0x64, 0x9C, 0x07, 0x9A, 0x20, 0xD1, 0x9C, 0x90, 0xA3, 0xBD,
+    0x4E, 0x25, 0x21, 0xE0, 0x16, 0x2D, 0x5A, 0x03, 0x79, 0xC2, 0xF9, 0xC4, 0x2D, 0x17, 0x5B, 0x5E,
+    0x7F, 0xA9, 0xEB, 0x17, 0x4B, 0x02, 0xC5, 0x56, 0xE4, 0x35, 0x04, 0x24, 0x6B, 0xF9, 0x3F, 0x29,
+    0x13, 0xEF, 0x7A, 0x11, 0xFD, 0xB8, 0x4E, 0xBD, 0xBA, 0xFE, 0xBE, 0xD9, 0x33, 0x37, 0xF8, 0x58,
+    0xC3, 0x7F, 0x87, 0x10, 0xFE, 0xBB, 0x2C, 0xBC, 0xB9, 0xDE, 0xE4, 0xFD, 0xA8, 0x43, 0x34, 0xB4,
+    0x55, 0x36, 0xC3, 0x3F, 0xE6, 0xB1, 0x18, 0x79, 0xE3, 0x8C, 0x7D, 0xE0, 0xF0, 0x9F, 0x16, 0xCB,
+    0x46, 0x4D, 0x41, 0xE8, 0x39, 0x1B, 0x01, 0xBA, 0x5F, 0x5F, 0x7B, 0x5B, 0x36, 0x81, 0x9D, 0xAA,
+    0x5C, 0xF7, 0x93, 0x35, 0xC1, 0xFB, 0x0B, 0x4E, 0xE5, 0x16, 0x67, 0x61, 0x2A, 0x2E, 0x79, 0x38,
+    0x8D, 0x44, 0x16, 0x9A, 0xDE, 0xC4, 0xD7, 0x9B, 0x34, 0x8E, 0xEC, 0xE6, 0xEB, 0x75, 0x27, 0xFD,
+    0xF8, 0xE3, 0xA6, 0x1F, 0x5F, 0x51, 0xA2, 0x57, 0x34, 0xF5, 0x6D, 0xD3, 0x61, 0xD2, 0x54, 0xFB,
+    0xB1, 0xB5, 0x8A, 0x14, 0xDB, 0x5B, 0x45, 0x32, 0xB6, 0x8A, 0x58, 0xF8, 0xFB, 0xD9, 0x6D, 0x5D,
+    0xE0, 0x36, 0x84, 0xA6, 0xE5, 0x41, 0x36, 0x72, 0x14, 0x55, 0x4D, 0x54, 0xB0, 0x5D, 0x3F, 0x50,
+    0x57, 0xCB, 0x6F, 0x9B, 0xE5, 0xD7, 0x43, 0x64, 0x15, 0x99, 0x54, 0x64, 0x4E, 0x51, 0xA4, 0x1A,
+    0xD1, 0x1F, 0x20, 0xEC, 0x21, 0x70, 0x6D, 0x17, 0xF7, 0x69, 0x81, 0xE4, 0x09, 0x6C, 0x6B, 0x3C,
+    0x61, 0x97, 0x9B, 0x52, 0x6C, 0x7A, 0x78, 0xC1, 0xD7, 0x53, 0xB7, 0x68, 0x0B, 0xDB, 0x85, 0x8C,
+    0xB8, 0x38, 0xA5, 0x88, 0xA0, 0x38, 0x34, 0x6E, 0x5F, 0xD6, 0x29, 0xB0, 0x08, 0x4A, 0x12, 0x87,
+    0x19, 0x84, 0x22, 0xB2, 0xF2, 0xEC, 0xF2, 0xB2, 0x71, 0xDE, 0xEA, 0x1B, 0xE7, 0x77, 0xB9, 0x36,
+    0x55, 0xD9, 0x2A, 0x01, 0x86, 0x3D, 0x66, 0x2B, 0x63, 0x21, 0x8B, 0x68, 0xBF, 0xFA, 0xC8, 0x8B,
+    0x60, 0x05, 0x9B, 0xB6, 0xAC, 0x7F, 0x9C, 0x8B, 0xE8, 0x89, 0x86, 0xFD, 0xDA, 0xE6, 0xA9, 0x5D,
+    0x17, 0xF1, 0x9E, 0xA7, 0x1C, 0xD0, 0xD9, 0xB1, 0xA7, 0x1C, 0xFC, 0x2D, 0x77, 0xB6, 0xDA, 0xFD,
+    0x94, 0x83, 0x25, 0x02, 0xE3, 0x4B, 0xEC, 0x69, 0x29, 0xA6, 0xA7, 0x1C, 0xDC, 0x4F, 0xA1, 0x3E,
+    0xB7, 0xDB, 0x29, 0x07, 0xF5, 0xB4, 0x6A, 0xCC, 0x06, 0xD4, 0x34, 0xDE, 0x7A, 0x98, 0xE3, 0x3D,
+    0x33, 0xA3, 0x7C, 0xBC, 0x60, 0xEE, 0xCE, 0x9C, 0x1E, 0x6C, 0x43, 0x9C, 0x5E, 0xB1, 0x47, 0xE0,
+    0x10, 0xD8, 0xF9, 0xD7, 0xC1, 0xFA, 0xA3, 0x26, 0xA0, 0xC0, 0xC3, 0x6F, 0xF8, 0x65, 0x88, 0x7B,
+    0x2E, 0x60, 0x0E, 0x57, 0x84, 0x5B, 0x1C, 0x9C, 0xF0, 0x32, 0x8F, 0xDC, 0x48, 0x3B, 0x55, 0x0C,
+    0x7F, 0xCF, 0x24, 0x9E, 0x7B, 0x72, 0x82, 0xE1, 0xCB, 0x26, 0x2F, 0xFC, 0x75, 0xEE, 0xCC, 0x28,
+    0xAE, 0x8B, 0xE4, 0xE2, 0xD6, 0x48, 0xC8, 0xB3, 0xE0, 0xF7, 0x17, 0x44, 0x6F, 0x9D, 0x0D, 0x0A,
+    0x74, 0xA9, 0x5F, 0x0A, 0xF2, 0x05, 0x0B, 0x95, 0x66, 0x10, 0x93, 0x58, 0x35, 0x8D, 0x47, 0xDA,
+    0x36, 0xFB, 0xE6, 0x62, 0xA1, 0x52, 0xA4, 0x50, 0x89, 0x20, 0x7E, 0x12, 0x88, 0xBC, 0x21, 0x1E,
+    0xE9, 0xF0, 0xF0, 0xC0, 0xE6, 0x60, 0xA2, 0xF9, 0xCD, 0xD3, 0x5F, 0x1B, 0xA7, 0x66, 0xA6, 0xC1,
+    0xDE, 0x22, 0x26, 0x3F, 0x7F, 0x3F, 0x88, 0x09, 0x31, 0x88, 0xA3, 0x82, 0x7D, 0xDF, 0x29, 0x97,
+    0xCC, 0x91, 0x20, 0x2F, 0x57, 0x50, 0x82, 0xD9, 0xEF, 0x98, 0x93, 0x61, 0x56, 0x0C, 0x39, 0xA3,
+    0x21, 0xA3, 0x27, 0xA8, 0x56, 0xE3, 0x93, 0x19, 0xFA, 0x52, 0x80, 0x05, 0x07, 0xA0, 0xC4, 0x5C,
+    0xA0, 0x70, 0x3A, 0xE6, 0x3F, 0xE2, 0x74, 0x0F, 0x07, 0xBE, 0x43, 0x7B, 0xDD, 0x13, 0x5C, 0x10,
+    0x57, 0xA8, 0x7F, 0x77, 0x1A, 0xC1, 0xD7, 0x43, 0x20, 0x82, 0x99, 0x6D, 0x5C, 0x99, 0xCA, 0xFC,
+    0xDC, 0xAA, 0x3D, 0x92, 0x45, 0x08, 0x19, 0x8D, 0x53, 0x3D, 0xC6, 0xC2, 0x9B, 0x2D, 0x67, 0x9F,
+    0x54, 0xB4, 0xCF, 0xFC, 0x47, 0xD6, 0x95, 0x78, 0x41, 0xB8, 0x06, 0x49, 0xF2, 0xCD, 0x6F, 0xD4,
+    0xC8, 0xE3, 0x8C, 0xDB, 0xB4, 0xD2, 0x2D, 0x33, 0x51, 0x90, 0xE6, 0xC6, 0xF3, 0x21, 0x38, 0xCE,
+    0xD3, 0x5F, 0xE8, 0xA9, 0x49, 0x8B, 0x73, 0xD3, 0xA8, 0x5B, 0x3B, 0x59, 0x3B, 0x9A, 0xE9, 0xC4,
+    0xB1, 0xF1, 0xAB, 0xE6, 0x5F, 0x9B, 0x5E, 0xDF, 0x4C, 0xCF, 0x88, 0x41, 0xBF, 0x09, 0x74, 0x64,
+    0xE6, 0x5A, 0x50, 0xC9, 0x88, 0x47, 0xF8, 0x6A, 0x0F, 0x09, 0xC2, 0xFF, 0x2D, 0xFE, 0xD7, 0x0B,
+    0x3B, 0x4E, 0x57, 0xD1, 0xE1, 0xBA, 0xB1, 0x12, 0x66, 0xBE, 0x32, 0x49, 0xC3, 0x1E, 0x9E, 0xB0,
+    0x1C, 0xD3, 0xBA, 0xA5, 0xE6, 0x5C, 0xDE, 0xDF, 0x71, 0x19, 0xA7, 0x78, 0x5C, 0x06, 0x0E, 0xE1,
+    0x89, 0x1F, 0x40, 0x68, 0x26, 0xFE, 0x32, 0xF2, 0xAB, 0xD1, 0x4B, 0x39, 0xAA, 0x05, 0xDE, 0xB9,
+    0x3E, 0x3D, 0x2E, 0x63, 0x1E, 0x67, 0x0B, 0xC8, 0x82, 0x78, 0xE4, 0x12, 0xC9, 0xB1, 0x9F, 0x11,
+    0xE2, 0x3B, 0x77, 0x3F, 0x2E, 0x63, 0xD7, 0x16, 0xB0, 0x1F, 0x3D, 0x59, 0x06, 0x57, 0xAF, 0xF6,
+    0x83, 0xAB, 0x4F, 0x15, 0xFE, 0x2F, 0xD7, 0xB5, 0x05, 0xEC, 0x31, 0xCC, 0x44, 0xA6, 0xB2, 0x5F,
+    0x26, 0xB2, 0x67, 0x7B, 0x0B, 0x98, 0x56, 0xFD, 0x6A, 0xD9, 0xEF, 0xB6, 0x53, 0x39, 0xB6, 0x9D,
+    0xA3, 0x99, 0xCF, 0x8C, 0x4F, 0xD3, 0x13, 0xAB, 0x2F, 0x82, 0xFD, 0x56, 0x8D, 0x9E, 0xDA, 0xD6,
+    0x6A, 0x46, 0xFD, 0xBF, 0xD2, 0x9C, 0x4D, 0x32, 0x9C, 0xF9, 0x5F, 0xF1, 0x5C, 0x4F, 0x94, 0xC1,
+    0x61, 0x77, 0x65, 0x6B, 0xED, 0xEE, 0xCE, 0x96, 0xE4, 0x6F, 0x53, 0xDC, 0x83, 0x38, 0x73, 0x3F,
+    0x70, 0xC3, 0x28, 0x52, 0xC5, 0xE1, 0xF5, 0xCE, 0xC4, 0xB8, 0x37, 0x28, 0x6C, 0x44, 0xC0, 0x88,
+    0x52, 0x84, 0x04, 0x56, 0x10, 0xE6, 0xB4, 0xB4, 0x75, 0x20, 0x38, 0x3B, 0xA0, 0x5C, 0x04, 0xEA,
+    0xEF, 0x77, 0x44, 0xAF, 0x47, 0xB9, 0x00, 0x31, 0x71, 0xC5, 0x37, 0xDA, 0xE6, 0x1B, 0x68, 0x81,
+    0xE6, 0xF9, 0x13, 0x1B, 0xA7, 0xA7, 0x2C, 0x3B, 0x9A, 0x61, 0x5F, 0x0D, 0x63, 0xB4, 0x9B, 0x23,
+    0x16, 0xEF, 0x83, 0x90, 0x43, 0x18, 0xFD, 0x71, 0xAF, 0xCF, 0xBA, 0x8E, 0xA6, 0x57, 0x06, 0x42,
+    0x00, 0x1B, 0xD1, 0x13, 0x7D, 0x86, 0xD2, 0x49, 0x44, 0x75, 0x8E, 0x23, 0x20, 0xB7, 0x10, 0x0B,
+    0x90, 0x39, 0x8F, 0xD4, 0x6B, 0xD2, 0xF6, 0xD1, 0x01, 0x03, 0x90, 0xBE, 0x91, 0x36, 0x4F, 0xE8,
+    0x1A, 0x8B, 0x66, 0xE4, 0xF6, 0xF7, 0x00, 0xFC, 0xB3, 0x7B, 0xA5, 0xD8, 0x71, 0x26, 0xC3, 0x27,
+    0xB3, 0x3C, 0x87, 0xEF, 0x65, 0x13, 0xB9, 0xB5, 0xE8, 0x36, 0xC9, 0x32, 0x6B, 0x06, 0x8E, 0xCD,
+    0xA6, 0xD9, 0x6F, 0x19, 0x09, 0x58, 0xC9, 0x4C, 0xAE, 0x61, 0x69, 0xAB, 0xC2, 0xC6, 0x69, 0xC5,
+    0x5C, 0x7E, 0xC3, 0x49, 0xC3, 0xE5, 0xF6, 0x93, 0x86, 0xC3, 0x9B, 0x9C, 0x34, 0xDC, 0xB2, 0x1A,
+    0x70, 0xC7, 0x49, 0xC3, 0x88, 0x77, 0x5B, 0x96, 0x35, 0x77, 0x34, 0xA7, 0x6B, 0x2E, 0x1A, 0x1B,
+    0x51, 0x4C, 0x1E, 0xB1, 0x10, 0x2E, 0x1E, 0x99, 0x69, 0x31, 0xF7, 0xCC, 0xC7, 0xEF, 0xF9, 0x49,
+    0x85, 0x87, 0x8C, 0x7A, 0x34, 0xE7, 0x2D, 0x6D, 0xDB, 0x8F, 0xA6, 0x4D, 0x52, 0x73, 0x97, 0xD5,
+    0x7E, 0x5A, 0xCE, 0x3E, 0xF8, 0xB0, 0x61, 0xCE, 0xC2, 0xD8, 0xE6, 0x06, 0xF1, 0x75, 0x11, 0x0A,
+    0x4F, 0x48, 0x85, 0x16, 0x8D, 0xD3, 0x4A, 0xE3, 0xD1, 0x0F, 0xB7, 0xFD, 0x57, 0xF7, 0x1E, 0x4C,
+    0x32, 0x04, 0x9B, 0xEC, 0x3C, 0xEC, 0x88, 0x47, 0x9E, 0xBA, 0x3C, 0x9C, 0x85, 0xD1, 0x60, 0x59,
+    0xE2, 0xD7, 0xB4, 0x18, 0xA9, 0x68, 0xB2, 0xB0, 0xEF, 0x2B, 0xD8, 0xC9, 0x30, 0x40, 0x2F, 0x53,
+    0x2C, 0x1F, 0xDB, 0x83, 0x85, 0x4A, 0x4D, 0x7E, 0x2D, 0x19, 0x76, 0x4D, 0xBA, 0x88, 0xFD, 0x6D,
+    0xAB, 0xED, 0x9C, 0x83, 0x31, 0x8C, 0xB4, 0xE7, 0x2C, 0xB1, 0x3E, 0xAA, 0x75, 0x51, 0x13, 0xAD,
+    0xF5, 0x3E, 0x78, 0x6D, 0xFD, 0x6D, 0x3A, 0x23, 0xA1, 0x46, 0xA3, 0xE9, 0xF2, 0x7B, 0x74, 0xB1,
+    0xC4, 0xCC, 0x26, 0x6A, 0x67, 0x13, 0xB5, 0x86, 0x4B, 0x2A, 0xDC, 0x2D, 0x95, 0xEE, 0xAE, 0xC2,
+    0xB0, 0xA1, 0x16, 0xAF, 0xEA, 0x79, 0x59, 0xBA, 0x78, 0x6A, 0x0A, 0xB9, 0xA5, 0x4E, 0x25, 0x9B,
+    0x39, 0xA3, 0xF4, 0xC0, 0x11, 0x0A, 0xE2, 0x1F, 0x75, 0xD8, 0x02, 0xD0, 0x16, 0x58, 0xF9, 0x36,
+    0xF2, 0xE4, 0x6E, 0x53, 0x0A, 0x6B, 0x5D, 0x90, 0xC3, 0xDB, 0x8E, 0xB5, 0xD5, 0xD4, 0xB5, 0xCD,
+    0x6C, 0x7B, 0xB3, 0x67, 0xBE, 0xCF, 0x6D, 0xA5, 0x28, 0xEE, 0x91, 0x99, 0x9F, 0x0B, 0x73, 0xDB,
+    0xA6, 0x36, 0x73, 0x44, 0x43, 0x62, 0x8F, 0x68, 0x08, 0x30, 0xF3, 0xFD, 0xD8, 0xBF, 0x7B, 0x60,
+    0x6B, 0x70, 0x6C, 0xFA, 0x81, 0xB3, 0x32, 0xBC, 0x8D, 0xA0, 0x84, 0xB0, 0xDD, 0xF8, 0x52, 0x4F,
+    0x9B, 0x02, 0xCD, 0xDE, 0xA2, 0x01, 0x66, 0x04, 0x1A, 0xE1, 0xC4, 0x1F, 0x5A, 0x98, 0xF2, 0xD5,
+    0xA7, 0x21, 0x22, 0xA7, 0x2E, 0x82, 0xE5, 0xB5, 0xA6, 0xDE, 0x8A, 0x74, 0x3E, 0xC5, 0xC7, 0xE9,
+    0x61, 0x40, 0x0D, 0xC3, 0x99, 0xF1, 0xA3, 0x95, 0xE6, 0x8B, 0x32, 0xED, 0x22, 0xDC, 0x97, 0x05,
+    0xEC, 0x80, 0x19, 0x02, 0x4D, 0x56, 0x0A, 0x23, 0x2D, 0x37, 0xB9, 0x3C, 0x04, 0x6F, 0x6B, 0x6D,
+    0x84, 0x61, 0x38, 0x09, 0xD5, 0x4D, 0x01, 0xD5, 0x40, 0xCF, 0xAE, 0x99, 0x86, 0xEA, 0x9A, 0xFA,
+    0xE1, 0x5C, 0x14, 0x35, 0xAB, 0xEE, 0x59, 0x32, 0x07, 0xD0, 0xFC, 0x5D, 0x3A, 0x2C, 0xD9, 0xA7,
+    0x87, 0x6C, 0x7E, 0x53, 0x34, 0x50, 0xCE, 0x26, 0x87, 0xBC, 0x6D, 0x27, 0xA3, 0xED, 0xE6, 0x05,
+    0x7F, 0x0C, 0x81, 0xCC, 0xE6, 0x40, 0xBD, 0x19, 0x7C, 0x79, 0xB9, 0xE1, 0xF2, 0x86, 0xC7, 0x3F,
+    0x39, 0xFC, 0xAD, 0xCA, 0x78, 0x34, 0x95, 0x3B, 0xCD, 0x9F, 0x31, 0x64, 0x61, 0x5D, 0x15, 0x6F,
+    0x2A, 0x86, 0xC0, 0xDF, 0x80, 0xDF, 0x40, 0xDF, 0xE0, 0x15, 0xB0, 0x0A, 0xA0, 0x37, 0xA8, 0x00,
+    0xE0, 0x0D, 0xDC, 0x0D, 0xD8, 0xED, 0x3C, 0xBF, 0x2D, 0x83, 0x2D, 0x9E, 0x48, 0xBB, 0x90, 0x3D,
+    0x61, 0xB4, 0x90, 0x5E, 0x6C, 0x68, 0xE9, 0x71, 0xCF, 0x0C, 0x7C, 0xD0, 0x03, 0x45, 0xFB, 0x3C,
+    0x50, 0x14, 0xFB, 0x87, 0x34, 0x12, 0x4E, 0xED, 0xE3, 0x81, 0xA2, 0x40, 0x24, 0xB2, 0xB4, 0x7F,
+    0x8E, 0xA2, 0x13, 0x71, 0x89, 0xFE, 0x07, 0x18, 0x48, 0x58, 0xFA, 0xEF, 0x78, 0xCD, 0x3C, 0xF4,
+    0x29, 0xED, 0x17, 0xB8, 0xF8, 0x50, 0xC1, 0x03, 0x45, 0x79, 0xDA, 0x35, 0x0E, 0x14, 0xD5, 0x83,
+    0x44, 0xF3, 0x93, 0x3C, 0x48, 0x34, 0x28, 0xA8, 0x37, 0xCE, 0xF9, 0x05, 0xFB, 0x5B, 0xCF, 0xFA,
+    0x7F, 0x97, 0x23, 0x37, 0x7D, 0xC9, 0xFB, 0x25, 0x9D, 0x61, 0x1C, 0x28, 0x0A, 0xC5, 0xD7, 0x17,
+    0x07, 0x75, 0x85, 0x07, 0x8A, 0x56, 0x3C, 0x0E, 0x96, 0x16, 0xE7, 0x94, 0xEC, 0x11, 0x0E, 0x14,
+    0x1D, 0x6C, 0x2F, 0xAE, 0x69, 0xB2, 0x8D, 0xCD, 0xD9, 0x69, 0xB6, 0x10, 0x65, 0x52, 0xC5, 0xBB,
+    0x38, 0xAB, 0xC3, 0xF4, 0x70, 0x98, 0x7D, 0xB5, 0x86, 0xD2, 0xEC, 0xE1, 0x30, 0xB5, 0x1E, 0x32,
+    0x51, 0x1B, 0x1C, 0x0E, 0xE3, 0xBE, 0x96, 0x86, 0xC8, 0xE1, 0x3D, 0x9B, 0x1D, 0xC3, 0x93, 0xBF,
+    0x9A, 0x9D, 0x45, 0x2C, 0x53, 0x4C, 0x16, 0x1A, 0xA5, 0xC2, 0xAB, 0x38, 0x1C, 0xE6, 0x9E, 0xE0,
+    0xE5, 0x07, 0x70, 0x34, 0xB7, 0xFF, 0xB7, 0x22, 0xA0, 0x07, 0xCE, 0xA2, 0x8B, 0x55, 0xD4, 0x1B,
+    0x4A, 0x04, 0x45, 0xC1, 0x89, 0x7B, 0x30, 0x46, 0x0D, 0x47, 0x6E, 0x2C, 0x8A, 0x39, 0x98, 0xCD,
+    0x3A, 0x50, 0x47, 0xB6, 0x4D, 0xAA, 0x33, 0xDB, 0xB7, 0xF0, 0xB1, 0x21, 0xA9, 0x55, 0x97, 0x7C,
+    0x0E, 0x33, 0xEC, 0xB1, 0xBF, 0xD4, 0x51, 0x57, 0xF9, 0x73, 0xDB, 0x6A, 0xBA, 0xD2, 0xE9, 0x21,
+    0x0D, 0x5A, 0x6F, 0xCE, 0xF7, 0xBA, 0xAF, 0xD1, 0x54, 0xBD, 0xCC, 0xA0, 0xB5, 0x9E, 0x78, 0xEB,
+    0xEB, 0x01, 0xE6, 0xB8, 0xC5, 0x59, 0x6F, 0x7A, 0x80, 0x39, 0x8F, 0xF1, 0xF4, 0xB6, 0x1D, 0x60,
+    0xEE, 0xCC, 0x1C, 0x60, 0x8E, 0x69, 0xE9, 0x01, 0xE6, 0x7D, 0x7B, 0x80, 0xF9, 0xDC, 0x38, 0xD5,
+    0x03, 0xCC, 0x3F, 0xC3, 0x33, 0x8B, 0x2E, 0x98, 0xE4, 0x19, 0x91, 0xA9, 0xE9, 0x99, 0x45, 0x90,
+    0xA8, 0xBB, 0x04, 0x02, 0xB1, 0xE8, 0x12, 0xFD, 0x83, 0x08, 0xB7, 0x21, 0xF9, 0xAF, 0xC7, 0xC8,
+    0x85, 0xE2, 0xD8, 0xE1, 0x30, 0x93, 0x28, 0xC3, 0x21, 0xBE, 0x1D, 0x41, 0x58, 0x5D, 0xF3, 0xA6,
+    0x69, 0x79, 0xCB, 0x26, 0xF9, 0x41, 0xFC, 0xEB, 0xA8, 0x0A, 0x07, 0x26, 0x65, 0xB9, 0xFE, 0x85,
+    0x2F, 0x50, 0x6D, 0x27, 0x44, 0x38, 0x34, 0xAB, 0xAB, 0x87, 0x6E, 0xA8, 0x68, 0xFB, 0xE4, 0x56,
+    0x6F, 0x0E, 0xCD, 0x9C, 0x5C, 0x70, 0xD7, 0xCC, 0xC9, 0x05, 0xB7, 0x66, 0xF5, 0xFA, 0xE7, 0x1C,
+    0xD0, 0x74, 0x76, 0x8D, 0x65, 0xEC, 0xC2, 0xD8, 0x44, 0xB8, 0x41, 0x9C, 0xB2, 0xEE, 0xE1, 0x70,
+    0xA2, 0x85, 0x5C, 0x08, 0x04, 0xE1, 0xD9, 0x4A, 0x21, 0x59, 0x50, 0xCB, 0x2A, 0xEA, 0xAE, 0xD5,
+    0xD4, 0xE3, 0xB5, 0x0B, 0xD4, 0x14, 0x7A, 0xBB, 0xB3, 0xD6, 0x1C, 0xBE, 0xFD, 0x35, 0x05, 0x5F,
+    0xB5, 0x8A, 0xA5, 0x3D, 0x24, 0x5D, 0x23, 0x7D, 0xD4, 0xB5, 0x42, 0xA9, 0xFD, 0x58, 0xBB, 0x2C,
+    0xF0, 0x30, 0x6A, 0xED, 0x85, 0x83, 0x17, 0x18, 0xE3, 0x7A, 0x55, 0x90, 0x59, 0x6F, 0x8C, 0x4E,
+    0x1E, 0x84, 0xD0, 0x37, 0x1D, 0x71, 0x58, 0x36, 0x1E, 0x7B, 0xF6, 0xD9, 0xBE, 0x3B, 0x70, 0x47,
+    0xF0, 0x3F, 0x9D, 0x8A, 0x6B, 0x16, 0xF2, 0xC6, 0x29, 0x9A, 0x87, 0x12, 0x1E, 0x75, 0x27, 0xAB,
+    0x7E, 0x71, 0x8C, 0xDC, 0x47, 0x8D, 0xA4, 0x07, 0x62, 0x3D, 0x5D, 0x86, 0x09, 0xBB, 0xDC, 0xBC,
+    0xAE, 0x59, 0x66, 0xDB, 0xDC, 0xCB, 0x7D, 0x3F, 0x8D, 0xAF, 0x3F, 0x38, 0xDE, 0x40, 0x44, 0x1B,
+    0xB9, 0x81, 0x94, 0xCD, 0xAA, 0x60, 0x34, 0xD1, 0x2F, 0x48, 0xE6, 0x3C, 0x03, 0x41, 0x1A, 0x9B,
+    0x19, 0x66, 0xD3, 0xE3, 0xD4, 0x23, 0x5A, 0x63, 0x7B, 0x9C, 0xFA, 0xC2, 0x4D, 0xEA, 0x63, 0x76,
+    0x39, 0x4E, 0xFD, 0x86, 0x42, 0x9E, 0xD9, 0xE3, 0xD4, 0x0F, 0x6E, 0x9E, 0x6E, 0xA7, 0x3D, 0xE0,
+    0xC0, 0x43, 0x26, 0x33, 0x1D, 0xD1, 0xEE, 0x1B, 0x8F, 0x6A, 0xCF, 0xF5, 0x04, 0x47, 0x23, 0x56,
+    0x20, 0x7E, 0x9B, 0xE8, 0xF2, 0x0C, 0x5E, 0x1B, 0x5A, 0x63, 0xE3, 0x34, 0x49, 0xE1, 0xB2, 0xB5,
+    0xFC, 0x01, 0xBB, 0x89, 0xBA, 0xE9, 0x4D, 0xA2, 0xEF, 0x77, 0x4D, 0xCB, 0xD8, 0x07, 0x34, 0xE0,
+    0x6C, 0x62, 0xCF, 0x45, 0xB2, 0x82, 0x7E, 0x03, 0x59, 0xB4, 0x16, 0xAE, 0x9A, 0x1D, 0x9C, 0x47,
+    0xF0, 0x7E, 0x79, 0x4B, 0xEF, 0xAF, 0x84, 0xD3, 0x90, 0x2C, 0x47, 0x2D, 0x7F, 0x41, 0x2F, 0x36,
+    0x61, 0x7D, 0xBA, 0x3D, 0x7D, 0x6F, 0xA8, 0x1D, 0x03, 0xE1, 0x1B, 0x22, 0x21, 0x2E, 0xFF, 0xE4,
+    0x0A, 0x93, 0x06, 0xCB, 0x7D, 0xF9, 0x4A, 0xEC, 0x7D, 0xD6, 0x16, 0x8F, 0x8D, 0x71, 0x8F, 0xA9,
+    0xB2, 0x9A, 0x17, 0xDC, 0x34, 0x5E, 0xCF, 0x83, 0x7E, 0x8C, 0xA5, 0xF0, 0x14, 0x87, 0x96, 0x68,
+    0xBD, 0x16, 0x30, 0x90, 0x18, 0x0A, 0xEE, 0x00, 0x97, 0xFF, 0x67, 0xFB, 0xE8, 0xA7, 0x20, 0x73,
+    0x0F, 0xC3, 0x70, 0xEF, 0x5E, 0xB3, 0xAD, 0x2C, 0xFF, 0x76, 0xAE, 0xE7, 0x8B, 0x22, 0x8F, 0x2D,
+    0x91, 0xC5, 0xD6, 0x0E, 0x79, 0xBC, 0x25, 0xEB, 0xB4, 0x2B, 0x35, 0xCD, 0x6A, 0xF5, 0x13, 0xFB,
+    0xA3, 0xED, 0xAB, 0xFE, 0xFF, 0xC6, 0xAB, 0xFD, 0xE2, 0x9C, 0xAE, 0xAF, 0x6B, 0x13, 0x8E, 0xCD,
+    0xF5, 0xBE, 0xB9, 0xDD, 0x16, 0xFB, 0x69, 0xF1, 0x6A, 0xDD, 0xEC, 0xCF, 0x0C, 0x4F, 0x2F, 0x14,
+    0xE4, 0x87, 0x70, 0x50, 0xFA, 0xF8, 0xF6, 0x2D, 0xB9, 0x9D, 0x7F, 0x50, 0x00, 0x14, 0x04, 0xD5,
+    0xB0, 0x92, 0x59, 0xAA, 0xDD, 0x82, 0x53, 0x07, 0x21, 0x57, 0x68, 0xED, 0x16, 0xDA, 0xB5, 0xD6,
+    0x7A, 0x70, 0xA1, 0xCF, 0xC9, 0xF7, 0xD5, 0x44, 0xA4, 0x4D, 0xD9, 0xD0, 0xA0, 0xC1, 0x57, 0x21,
+    0xA4, 0x64, 0x1F, 0xBD, 0x69, 0x7F, 0x76, 0x11, 0x04, 0xB0, 0x87, 0x26, 0xC5, 0x58, 0x5D, 0xA6,
+    0x5F, 0xB9, 0x92, 0x37, 0xA6, 0x2B, 0x49, 0x35, 0xE0, 0x9E, 0xC1, 0x26, 0x65, 0x26, 0xC6, 0xD3,
+    0x16, 0x80, 0xC6, 0x4F, 0x68, 0x6E, 0x21, 0x6F, 0x1C, 0x82, 0x85, 0xC6, 0x5D, 0xF0, 0x5E, 0x27,
+    0x87, 0xA6, 0x93, 0xA4, 0x5E, 0x39, 0x01, 0xD0, 0x3B, 0xFE, 0xA0, 0xD4, 0x40, 0xF4, 0x20, 0x6B,
+    0x52, 0x7D, 0xB0, 0xA1, 0x30, 0x72, 0xFC, 0xC6, 0x06, 0x52, 0x44, 0xCA, 0xF5, 0xA7, 0x19, 0x78,
+    0x6B, 0x12, 0x2A, 0xFA, 0xD5, 0xAE, 0x05, 0xD6, 0x9F, 0x86, 0x3F, 0x76, 0xB0, 0xF7, 0xF4, 0x29,
+    0x83, 0x39, 0xED, 0xE5, 0x39, 0xDF, 0x1F, 0xB5, 0x46, 0xBA, 0x09, 0xD0, 0x5E, 0xD8, 0xA7, 0xCE,
+    0x47, 0x32, 0x73, 0x31, 0xA7, 0x3E, 0x73, 0x83, 0xF4, 0x7D, 0x0A, 0x09, 0xB2, 0x4F, 0x14, 0x3E,
+    0x5A, 0xAF, 0x71, 0xC8, 0xD4, 0x5E, 0xB3, 0x3A, 0xE3, 0x23, 0xDE, 0x02, 0xC2, 0x40, 0xD9, 0x53,
+    0xD3, 0xEB, 0x30, 0xAB, 0xEF, 0xDF, 0x7F, 0x4B, 0x6E, 0x66, 0xFF, 0x34, 0xC0, 0x06, 0x8F, 0xA8,
+    0x65, 0xC1, 0xD6, 0x87, 0x68, 0xC9, 0xC5, 0x09, 0x56, 0x38, 0x7F, 0x0C, 0xAF, 0x43, 0x33, 0x91,
+    0x3E, 0x1E, 0x0B, 0xB9, 0x3E, 0x6D, 0xD5, 0xCD, 0x6C, 0xAB, 0xAE, 0xA8, 0x11, 0x3D, 0x6E, 0xD5,
+    0x2B, 0xF5, 0x85, 0x56, 0xDD, 0x70, 0xDA, 0xAA, 0xFB, 0xED, 0xE1, 0x0E, 0x58, 0xF0, 0x81, 0x96,
+    0x73, 0x6D, 0x6D, 0x6D, 0x8C, 0xB0, 0xD5, 0x87, 0x5E, 0xCE, 0x4D, 0xA6, 0xDD, 0x16, 0xEB, 0xDC,
+    0x5B, 0xBB, 0xF8, 0x3E, 0xA6, 0x7D, 0xEB, 0xB6, 0xE7, 0x23, 0xAF, 0xE7, 0x43, 0x6C, 0xCF, 0xFB,
+    0x5E, 0xE7, 0xFB, 0xB1, 0x35, 0xB7, 0xEB, 0x00, 0xEA, 0x77, 0xB5, 0x35, 0x1F, 0xFD, 0xFC, 0x3A,
+    0xE3, 0x9C, 0x7E, 0x18, 0xBE, 0xC2, 0xC8, 0x7E, 0xA6, 0x71, 0x97, 0xDB, 0xFB, 0xE7, 0x13, 0xF6,
+    0x9E, 0x7E, 0x58, 0x3B, 0x30, 0x1A, 0x05, 0x2B, 0x9A, 0x64, 0x55, 0x60, 0x52, 0x5C, 0x3A, 0x23,
+    0x2D, 0x6D, 0x97, 0x07, 0x2F, 0xE2, 0xC1, 0x8B, 0x6A, 0x98, 0xE5, 0x3B, 0xE7, 0xA0, 0x9D, 0x2E,
+    0x81, 0x80, 0xA5, 0xCD, 0xF8, 0xB3, 0xC6, 0x30, 0x7C, 0x1A, 0xCF, 0x44, 0xD2, 0x9F, 0xFD, 0x85,
+    0x34, 0x88, 0x74, 0x09, 0xA7, 0xA6, 0x6C, 0xB1, 0xB1, 0x50, 0xB0, 0xFB, 0xFF, 0x09, 0x64, 0x68,
+    0xEB, 0x49, 0x98, 0xAB, 0x5F, 0x34, 0xFC, 0x1B, 0x91, 0x3A, 0x38, 0xD9, 0x6C, 0x9E, 0xE9, 0x76,
+    0x93, 0x84, 0x7F, 0x34, 0x32, 0xE6, 0x39, 0x58, 0x18, 0xF6, 0x3A, 0xB3, 0x0D, 0xA4, 0x9F, 0x00,
+    0x71, 0x04, 0x29, 0xC8, 0xCE, 0x44, 0x68, 0xC2, 0x67, 0x77, 0x3B, 0xCE, 0x36, 0x75, 0x8B, 0x73,
+    0x33, 0x07, 0x0E, 0xDD, 0x6E, 0x0A, 0x99, 0xCF, 0x11, 0xBC, 0x74, 0xC1, 0xDA, 0xA8, 0x57, 0x43,
+    0x7D, 0x11, 0x26, 0x1E, 0x32, 0xF8, 0xB4, 0xC7, 0xD9, 0x4E, 0x2D, 0x25, 0x97, 0xD2, 0x4B, 0x09,
+    0x66, 0x29, 0xA6, 0x24, 0x53, 0x9A, 0x29, 0xD1, 0x94, 0x6A, 0xB6, 0x8A, 0x84, 0x74, 0x53, 0xC2,
+    0x29, 0xE5, 0x94, 0x74, 0x4A, 0x3B, 0x1B, 0xA8, 0xD4, 0x28, 0x57, 0x38, 0x13, 0x44, 0xD2, 0x72,
+    0x13, 0xFC, 0x90, 0x24, 0x6C, 0x68, 0x48, 0x0E, 0xA3, 0xDE, 0xC1, 0x5B, 0x59, 0x1A, 0x99, 0xDD,
+    0xB7, 0xDD, 0xD6, 0x7F, 0xC2, 0x7F, 0x86, 0x62, 0x2E, 0x15, 0xBB, 0xFE, 0xD2, 0x80, 0xB6, 0x7D,
+    0x6E, 0xC6, 0xAE, 0xDF, 0x82, 0x23, 0x57, 0x3F, 0x60, 0xAF, 0xCB, 0x47, 0xE8, 0x24, 0x62, 0xB5,
+    0x89, 0x3F, 0x69, 0x2E, 0xF0, 0xB2, 0x26, 0x66, 0x3B, 0xA9, 0x31, 0xB9, 0x69, 0x9B, 0xCB, 0xCD,
+    0x0E, 0x12, 0xFC, 0xA9, 0x4C, 0x6A, 0x68, 0x03, 0xB4, 0x27, 0xED, 0xAB, 0xE9, 0x2C, 0xCB, 0x59,
+    0x81, 0x33, 0x11, 0x5E, 0x63, 0xC5, 0xC5, 0xD8, 0xF3, 0xEC, 0xE8, 0x37, 0x64, 0xBB, 0x38, 0x57,
+    0xBF, 0x2F, 0x7F, 0xE1, 0xC1, 0xFA, 0x8C, 0xEA, 0x29, 0xAA, 0xFF, 0xB6, 0xD3, 0x5B, 0xBC, 0x3D,
+    0x47, 0xBF, 0xDE, 0xB6, 0xF6, 0xAE, 0x99, 0x9C, 0x3A, 0xCF, 0x08, 0x79, 0x36, 0xB3, 0x67, 0x1F,
+    0x9B, 0xE7, 0xCD, 0x47, 0x68, 0xFE, 0x7A, 0xDD, 0x32, 0xD1, 0x31, 0xEB, 0x57, 0x09, 0x13, 0x1D,
+    0x45, 0x19, 0x53, 0x9F, 0x81, 0xF0, 0x4F, 0x41, 0x79, 0x5B, 0x38, 0x73, 0x08, 0x03, 0xD3, 0x33,
+    0xFB, 0x3B, 0xD3, 0xC7, 0xE0, 0xD0, 0x83, 0x5B, 0x5A, 0xD8, 0x36, 0x9A, 0x94, 0x4C, 0x1C, 0x6B,
+    0x3C, 0xCD, 0xA3, 0x3C, 0xB5, 0x0B, 0x2B, 0xD9, 0x97, 0x7D, 0x18, 0x7A, 0xE0, 0xB1, 0x47, 0xD7,
+    0xB7, 0x5E, 0xB0, 0x01, 0xC4, 0x0F, 0x4F, 0x8F, 0xD1, 0x7B, 0xAD, 0xF5, 0x91, 0xF1, 0xC3, 0x08,
+    0xB4, 0x8E, 0xDF, 0x77, 0x11, 0xDF, 0xFF, 0x03, 0xCD, 0x9A, 0xBF, 0x8F, 0xDC, 0xD6, 0x11, 0xC7,
+    0xBF, 0x24, 0x57, 0x47, 0xC7, 0x74, 0x8E, 0x5B, 0x28, 0xB0, 0x02, 0x5B, 0xA2, 0xE3, 0xA8, 0x10,
+    0x0C, 0x49, 0x9B, 0xC2, 0x85, 0x1C, 0xDC, 0x85, 0x54, 0x5C, 0xA4, 0x8C, 0x0A, 0x05, 0x2E, 0x5C,
+    0xC4, 0xA5, 0x90, 0x18, 0x39, 0x15, 0x2A, 0x0E, 0x46, 0xB4, 0xCB, 0x20, 0xA5, 0x0A, 0x29, 0xC8,
+    0x1F, 0xE0, 0x2B, 0xAE, 0xB0, 0x83, 0x20, 0xBE, 0xE2, 0x0A, 0x23, 0xB8, 0xBD, 0x65, 0x9F, 0x22,
+    0xDB, 0xC4, 0x65, 0x4C, 0x18, 0x81, 0x03, 0xE4, 0x00, 0x1F, 0x8B, 0x0D, 0xB0, 0x92, 0xB8, 0xCB,
+    0xCC, 0x77, 0x1E, 0x7F, 0xEC, 0xC9, 0x4E, 0x90, 0x62, 0x77, 0xC5, 0xC3, 0x71, 0xA4, 0xE5, 0x71,
+    0xDF, 0x9B, 0xF9, 0x70, 0xDE, 0xCC, 0xBC, 0x21, 0x01, 0xF8, 0x11, 0xE4, 0x27, 0x8C, 0x29, 0x07,
+    0x2A, 0x8B, 0x44, 0x84, 0xFD, 0x39, 0xA5, 0xF3, 0x17, 0x4A, 0xCF, 0x1B, 0x8B, 0xBC, 0xE4, 0x52,
+    0x6E, 0xB9, 0xA9, 0xC8, 0x7B, 0x0E, 0x65, 0xE6, 0x64, 0x72, 0xE1, 0x98, 0xD2, 0xF9, 0xDB, 0x3B,
+    0x22, 0xFD, 0xA2, 0x98, 0xC8, 0x85, 0xB0, 0x44, 0x6E, 0xC1, 0x9A, 0x02, 0x87, 0x40, 0x2E, 0x17,
+    0x52, 0xF2, 0x2B, 0x39, 0x5E, 0x99, 0x60, 0x63, 0x1E, 0x8D, 0xE6, 0x08, 0x75, 0x9A, 0x85, 0x9F,
+    0x6D, 0x95, 0x23, 0x95, 0x7D, 0x95, 0xE7, 0x29, 0xDC, 0xC7, 0xE7, 0x31, 0x78, 0x77, 0x62, 0x4D,
+    0x9C, 0xCC, 0x4D, 0x9D, 0xCC, 0x4F, 0x9C, 0x34, 0x88, 0xDC, 0x71, 0x08, 0x4F, 0x0E, 0x3F, 0xE9,
+    0xCB, 0x31, 0x44, 0x10, 0x0F, 0x11, 0x46, 0x47, 0x18, 0x44, 0x43, 0x9C, 0xA2, 0xEF, 0xEC, 0x20,
+    0xFC, 0x53, 0xEF, 0xAB, 0x60, 0xEA, 0x4F, 0x10, 0x59, 0x66, 0xF8, 0x23, 0x39, 0x66, 0x50, 0x75,
+    0xD0, 0xD5, 0x33, 0x1B, 0xFB, 0x94, 0x3D, 0x9E, 0xC0, 0xE5, 0x6B, 0x8D, 0x0E, 0xEE, 0x84, 0xD2,
+    0x53, 0x2E, 0xDE, 0x82, 0x82, 0xCF, 0x95, 0xD4, 0x28, 0x82, 0x73, 0x92, 0xC0, 0xB2, 0x65, 0x68,
+    0x37, 0x31, 0x84, 0x0E, 0xE4, 0xD8, 0x33, 0xBA, 0x2D, 0x8B, 0xD2, 0x77, 0x55, 0xFE, 0x9A, 0x74,
+    0x62, 0xD1, 0x05, 0xC1, 0x17, 0x34, 0xFA, 0x3E, 0x89, 0xD8, 0xE9, 0x16, 0x25, 0x3A, 0x2D, 0x21,
+    0x02, 0x9B, 0xB6, 0x93, 0xC5, 0xF0, 0x92, 0x7C, 0x28, 0x2E, 0xCB, 0x64, 0x7F, 0x15, 0x85, 0xAE,
+    0xD9, 0x09, 0xEF, 0x70, 0x84, 0x86, 0x0C, 0xD1, 0x80, 0x6C, 0x40, 0x38, 0x20, 0x1D, 0x10, 0x0F,
+    0xC8, 0x07, 0x04, 0x04, 0x12, 0x02, 0x11, 0x81, 0x8C, 0x40, 0x48, 0x20, 0x25, 0xC5, 0xA4, 0x9C,
+    0xA0, 0xA0, 0x4A, 0x52, 0x97, 0x75, 0xEC, 0x2D, 0x43, 0x61, 0x83, 0xA6, 0xDB, 0x01, 0xCD, 0x6A,
+    0x23, 0x2A, 0x3B, 0xE6, 0xD7, 0x39, 0xD0, 0x10, 0x78, 0xBD, 0x30, 0x98, 0x48, 0xA9, 0x82, 0xB4,
+    0x24, 0xE7, 0x51, 0x95, 0x71, 0x6E, 0x57, 0x3F, 0xDC, 0xA0, 0x0B, 0xFD, 0x36, 0x55, 0x17, 0x42,
+    0x6B, 0x5D, 0x48, 0x7F, 0x06, 0x54, 0xE1, 0x6D, 0xCE, 0xED, 0xCA, 0xFF, 0x86, 0xDB, 0x74, 0xA6,
+    0xEE, 0x3A, 0x9D, 0x49, 0x56, 0x1D, 0x67, 0x1F, 0x7C, 0x46, 0x95, 0x3E, 0x93, 0x1B, 0x04, 0x2B,
+    0xBE, 0xA3, 0x11, 0x4A, 0x81, 0xB4, 0xD6, 0xB1, 0x60, 0xED, 0xBD, 0x04, 0x6F, 0xBE, 0x8B, 0x6F,
+    0xF7, 0x32, 0x74, 0x2C, 0xC2, 0x23, 0xBB, 0x55, 0x39, 0x98, 0xA5, 0x83, 0xF9, 0x4A, 0x23, 0x64,
+    0x70, 0xC2, 0xF4, 0x53, 0x5A, 0x3A, 0xBE, 0xCA, 0x3F, 0xB6, 0xCC, 0xA9, 0xFE, 0x67, 0x4E, 0x53,
+    0x29, 0x9C, 0x1C, 0xB2, 0x7A, 0x10, 0xAF, 0x62, 0x31, 0xE2, 0x47, 0xB4, 0xBD, 0x9C, 0xD6, 0x4C,
+    0x8A, 0xEF, 0xA8, 0xBC, 0xAF, 0x52, 0xF9, 0xFD, 0xF8, 0x37, 0x94, 0xE3, 0x4D, 0xCA, 0x27, 0x47,
+    0x4A, 0x4B, 0x73, 0xDF, 0x46, 0xD4, 0x12, 0x96, 0x96, 0x84, 0x78, 0x47, 0x86, 0xF5, 0x81, 0xCE,
+    0xF9, 0x2E, 0x36, 0xE5, 0x4A, 0xEF, 0x74, 0x2C, 0x3E, 0x16, 0x55, 0x49, 0x7C, 0x49, 0xBC, 0x0C,
+    0xA1, 0xEB, 0x68, 0x72, 0x7E, 0xDB, 0xD9, 0x58, 0x8F, 0xCA, 0xBB, 0x28, 0xF1, 0xB6, 0x73, 0x61,
+    0x95, 0x6C, 0xCC, 0xBA, 0xF3, 0x26, 0x75, 0x5C, 0x87, 0xA5, 0xDE, 0xF3, 0xF6, 0xCD, 0x96, 0x7B,
+    0x0F, 0x8B, 0x99, 0x5F, 0xCA, 0xA4, 0x8E, 0xFC, 0x3F, 0x10, 0x4A, 0x57, 0x56, 0x49, 0xA9, 0x8C,
+    0xE1, 0x5F, 0xD2, 0xA4, 0x2F, 0x19, 0xC3, 0x61, 0x62, 0xB8, 0xF9, 0x6B, 0x8B, 0xFD, 0x68, 0xFF,
+    0x5B, 0x70, 0x8B, 0xF7, 0xB1, 0x19, 0x4C, 0x34, 0x86, 0x77, 0xB0, 0x4A, 0x4A, 0xF1, 0x06, 0x65,
+    0xAA, 0x34, 0xE6, 0x79, 0x13, 0xC9, 0x2D, 0xB4, 0x2A, 0x7A, 0x77, 0x17, 0x22, 0xE5, 0x5C, 0xE5,
+    0xB0, 0x39, 0x7F, 0x01, 0xEF, 0xE1, 0xA2, 0x35, 0x86, 0x7F, 0x9A, 0xC0, 0xE5, 0x5F, 0x6F, 0x2D,
+    0x8F, 0x90, 0x4C, 0x40, 0x25, 0x6D, 0x39, 0xAC, 0x49, 0xA9, 0x4C, 0x58, 0x14, 0x33, 0x04, 0x4F,
+    0xFE, 0x30, 0x83, 0xD8, 0xB5, 0x65, 0x84, 0xD8, 0x7C, 0x83, 0xE5, 0x46, 0x97, 0x95, 0x06, 0x16,
+    0x44, 0xF0, 0xAF, 0x8F, 0x65, 0x4F, 0x23, 0x5F, 0x90, 0x4A, 0x04, 0xA5, 0xE8, 0xD7, 0xC6, 0xA8,
+    0x15, 0x39, 0xAC, 0x84, 0xD6, 0x27, 0x32, 0x93, 0x17, 0xBF, 0xFC, 0xF8, 0x67, 0x83, 0x68, 0x54,
+    0x14, 0x45, 0x39, 0x9B, 0xDE, 0x09, 0x4F, 0xC7, 0x1B, 0x57, 0x83, 0x9A, 0x73, 0xA2, 0x53, 0x7F,
+    0x14, 0xD9, 0x59, 0x10, 0xBB, 0x63, 0x3F, 0xF1, 0x93, 0x20, 0xEE, 0x45, 0x61, 0x14, 0xE2, 0x18,
+    0x7D, 0xD9, 0x32, 0x8D, 0x0A, 0xA9, 0x76, 0x4C, 0x09, 0xA0, 0x47, 0x5F, 0x3C, 0x29, 0xC4, 0x55,
+    0x51, 0x68, 0x22, 0xFE, 0x35, 0xD6, 0x10, 0xCB, 0x71, 0x78, 0xE7, 0x38, 0x32, 0xA7, 0x30, 0x77,
+    0xDD, 0xFA, 0x98, 0xF0, 0x4E, 0xE5, 0xBB, 0xE7, 0x5C, 0xDE, 0x6E, 0x2F, 0x2E, 0xA9, 0x5B, 0x54,
+    0xC0, 0x4A, 0xD6, 0x8D, 0xC1, 0x96, 0x6F, 0x79, 0x9F, 0xC8, 0x4A, 0xA0, 0x22, 0x12, 0x37, 0x2C,
+    0xF9, 0xCC, 0x32, 0xD0, 0x8A, 0x8D, 0x22, 0x4B, 0x00, 0x51, 0x06, 0xD5, 0x5E, 0x26, 0xE1, 0xF4,
+    0xCF, 0x73, 0x71, 0xC6, 0xF1, 0x80, 0xB6, 0x9E, 0x5B, 0xB7, 0xA9, 0x9C, 0x30, 0x4C, 0xDF, 0xC4,
+    0xD3, 0x79, 0x66, 0x25, 0x23, 0x19, 0xAD, 0xB3, 0x44, 0x13, 0x61, 0x72, 0x14, 0x74, 0x95, 0xDE,
+    0xF1, 0xF9, 0xB9, 0xB8, 0xC2, 0xCF, 0x9F, 0xD3, 0xF6, 0x4B, 0x8C, 0xCA, 0xB2, 0x8F, 0xAA, 0xC3,
+    0xA0, 0x1A, 0x6D, 0xAC, 0x36, 0x16, 0x97, 0x52, 0x0D, 0x37, 0x96, 0x1B, 0x83, 0xCF, 0x48, 0xB5,
+    0xDE, 0x98, 0x6F, 0x4C, 0x2F, 0x65, 0x7F, 0x61, 0x05, 0x9B, 0xB5, 0xAB, 0x10, 0x94, 0x02, 0x14,
+    0x03, 0x94, 0x03, 0x6A, 0xD7, 0xB7, 0x1F, 0x95, 0xBE, 0x77, 0x74, 0x4D, 0xA6, 0x9E, 0xBF, 0x26,
+    0x33, 0x3C, 0x64, 0x09, 0xE7, 0x9C, 0xD9, 0x01, 0x90, 0x0C, 0xD1, 0x80, 0x6C, 0x40, 0x38, 0x20,
+    0x1D, 0x10, 0x0F, 0xC8, 0x47, 0x01, 0x29, 0x21, 0x45, 0x64, 0x26, 0x1F, 0xA2, 0xA4, 0xA4, 0x98,
+    0x94, 0x93, 0x01, 0x65, 0x48, 0xD9, 0xBC, 0x90, 0x75, 0x8E, 0x04, 0x26, 0x26, 0x8D, 0xEF, 0x15,
+    0x15, 0x26, 0xA5, 0x54, 0x43, 0x5A, 0x97, 0x5F, 0x30, 0x37, 0xE9, 0xED, 0x49, 0x25, 0x61, 0x7D,
+    0x7F, 0x6E, 0x48, 0x10, 0x44, 0xC5, 0x61, 0x49, 0xFE, 0x61, 0x6E, 0xD2, 0x3B, 0xBA, 0xAE, 0x1C,
+    0xCA, 0x3B, 0xD7, 0xD5, 0x4B, 0xBA, 0xED, 0xF5, 0x92, 0xA6, 0xA0, 0xFF, 0x49, 0x54, 0xD6, 0x8A,
+    0x47, 0x37, 0xE8, 0x2F, 0xDD, 0x35, 0xFA, 0x0B, 0xF0, 0xE8, 0x05, 0x39, 0x31, 0x7F, 0x1F, 0xD8,
+    0xDC, 0x91, 0xE8, 0xF1, 0x82, 0xAD, 0xF0, 0x94, 0xDD, 0xF3, 0xF5, 0x1C, 0xD8, 0x7B, 0x17, 0xE0,
+    0xCF, 0x0F, 0xF1, 0x6A, 0x2F, 0x45, 0x97, 0x41, 0xEE, 0x88, 0x70, 0x56, 0xE5, 0x41, 0x2A, 0x69,
+    0x32, 0x77, 0x52, 0xBA, 0x95, 0x7A, 0x66, 0xC7, 0xDE, 0x92, 0xDC, 0x89, 0xDB, 0x26, 0x8D, 0x50,
+    0x4D, 0xFF, 0xA7, 0x11, 0xB6, 0x96, 0x4B, 0xE2, 0x9B, 0xF3, 0xEA, 0x2F, 0xB8, 0x19, 0x4F, 0x60,
+    0xB3, 0xF7, 0x43, 0x67, 0x60, 0x9F, 0xE3, 0xA0, 0x6C, 0x1B, 0x2A, 0x9A, 0x04, 0xAF, 0xCC, 0x23,
+    0x68, 0xB1, 0x94, 0x99, 0xF6, 0x8D, 0x0E, 0x92, 0x34, 0x87, 0x38, 0xAA, 0x78, 0xAA, 0x41, 0x11,
+    0x96, 0x34, 0xEE, 0x97, 0x8A, 0xE4, 0xE6, 0x60, 0xB9, 0xF2, 0xF2, 0x8C, 0x1E, 0xAC, 0x5D, 0x4A,
+    0xE7, 0x24, 0xB1, 0x24, 0x92, 0xB9, 0x09, 0x5D, 0xFB, 0xA0, 0xEC, 0x4F, 0xBE, 0xB1, 0x27, 0xA9,
+    0x8E, 0x93, 0x48, 0xC5, 0x25, 0xD9, 0xC0, 0xE3, 0x1A, 0xD0, 0xDF, 0x18, 0x41, 0x84, 0x1E, 0xF8,
+    0x1B, 0x9A, 0xDF, 0x3F, 0xC2, 0xCF, 0x54, 0xFF, 0x55, 0xA8, 0xA7, 0xF5, 0xB8, 0x49, 0x48, 0x5E,
+    0x39, 0x5C, 0x55, 0x78, 0x52, 0x03, 0x2E, 0xC8, 0xBA, 0x8D, 0xF0, 0xE2, 0x47, 0xF0, 0x72, 0x1D,
+    0x62, 0xCA, 0x52, 0xCC, 0x36, 0xFA, 0x2F, 0x98, 0xD0, 0x58, 0x71, 0x02, 0x27, 0xE7, 0xC0, 0x1D,
+    0xD5, 0xE0, 0xB8, 0x0A, 0x28, 0x55, 0x7B, 0x69, 0xC6, 0xD2, 0x70, 0x27, 0x41, 0x2F, 0x96, 0xAF,
+    0x0F, 0x61, 0xE5, 0xAC, 0xEE, 0x72, 0xDA, 0x74, 0xCC, 0x1B, 0xD6, 0x0F, 0xD8, 0xCE, 0xED, 0x89,
+    0x29, 0xC7, 0xA2, 0x81, 0x08, 0x36, 0xAA, 0xB9, 0x73, 0xCF, 0x45, 0x58, 0x79, 0x9F, 0xD5, 0x60,
+    0x9F, 0x0C, 0x06, 0xD4, 0x5A, 0xFE, 0x1A, 0x24, 0xBD, 0xC8, 0xF4, 0x99, 0xC4, 0xAB, 0x1F, 0xBF,
+    0x9B, 0xD1, 0xB8, 0xA8, 0xAC, 0x28, 0x2C, 0x9C, 0xF1, 0xE8, 0x85, 0xEA, 0xED, 0xB1, 0x0C, 0xFD,
+    0x49, 0x62, 0x4F, 0xDC, 0xD4, 0x93, 0xFA, 0xD8, 0x8F, 0xED, 0x49, 0x2F, 0xB2, 0x27, 0x21, 0xEC,
+    0x49, 0x5F, 0x8E, 0xA1, 0x8C, 0x6F, 0x0E, 0x37, 0x1D, 0xCA, 0xD7, 0xEE, 0x0B, 0xDB, 0x50, 0x26,
+    0x09, 0x7E, 0x97, 0x37, 0xEB, 0xAD, 0x6B, 0x8A, 0x52, 0xAA, 0x6F, 0x4F, 0x0C, 0xCA, 0xBA, 0x7A,
+    0x8B, 0xBF, 0x5E, 0xBD, 0xA5, 0x8B, 0xD5, 0xDB, 0x7A, 0x31, 0xB0, 0x5D, 0x6E, 0x9F, 0x8C, 0xFF,
+    0x6B, 0xBB, 0x7C, 0x19, 0x34, 0x98, 0xB7, 0xE3, 0x7A, 0xBF, 0xB2, 0xCF, 0x56, 0x8F, 0x93, 0xBF,
+    0xC7, 0xCF, 0xBF, 0xD2, 0x1E, 0xBA, 0xB6, 0x11, 0x6E, 0x59, 0xD1, 0x19, 0x47, 0x30, 0x08, 0x0C,
+    0x03, 0x85, 0xA0, 0x34, 0x73, 0xF5, 0xF0, 0x63, 0x5D, 0xBF, 0x7D, 0x28, 0x08, 0x28, 0x09, 0x28,
+    0x0A, 0xF5, 0xED, 0x99, 0x76, 0x73, 0x72, 0x28, 0x0D, 0x28, 0x0E, 0x28, 0x0F, 0x28, 0x10, 0x28,
+    0x11, 0x28, 0x12, 0xC3, 0xA4, 0x84, 0x62, 0xA8, 0xA0, 0xD2, 0xA3, 0xA9, 0x72, 0xD8, 0x34, 0x67,
+    0x95, 0xE3, 0x3D, 0x8C, 0xBE, 0x9E, 0xB5, 0x84, 0x0F, 0x01, 0x81, 0x84, 0x40, 0x44, 0x20, 0x23,
+    0x10, 0x12, 0x48, 0x09, 0xC4, 0x04, 0x32, 0xAA, 0x84, 0x5C, 0x47, 0x54, 0x20, 0x2B, 0x84, 0xAA,
+    0x8E, 0xD0, 0x5A, 0xCC, 0x5A, 0x2F, 0xA2, 0x72, 0x0F, 0x3B, 0xE1, 0xA3, 0x97, 0xDF, 0xE7, 0x15,
+    0x2C, 0x65, 0xD5, 0xA0, 0x5A, 0xA7, 0xAB, 0x6C, 0x94, 0xFD, 0x01, 0x64, 0x92, 0xA8, 0x5E, 0x9F,
+    0x1B, 0x1C, 0x67, 0x12, 0xD5, 0x72, 0x5C, 0x45, 0xB3, 0xC7, 0xCF, 0xAB, 0xF6, 0xD2, 0xFE, 0x2E,
+    0x9D, 0xE5, 0xD6, 0xF3, 0x37, 0xFF, 0x4C, 0x45, 0x53, 0xF7, 0xC0, 0x8F, 0xDE, 0xA2, 0x6F, 0x74,
+    0xD7, 0xE8, 0x1B, 0xB2, 0xB9, 0x62, 0xC1, 0xFD, 0x58, 0xD6, 0xE8, 0x5B, 0x23, 0x39, 0xFB, 0x9A,
+    0xB6, 0x47, 0xF6, 0x75, 0x4D, 0xB5, 0xC0, 0x4B, 0xB4, 0xAC, 0x61, 0xA7, 0xFB, 0x62, 0xD5, 0xE9,
+    0x3E, 0x22, 0xA1, 0x55, 0x79, 0xCB, 0x6D, 0xCE, 0x48, 0xBB, 0x3D, 0x86, 0x8C, 0x20, 0x60, 0x97,
+    0x8F, 0xF7, 0x25, 0x6A, 0x59, 0x52, 0x51, 0x75, 0xE7, 0x65, 0x59, 0xF3, 0x60, 0xF9, 0x24, 0xBE,
+    0x31, 0xE1, 0xE0, 0x9C, 0xFE, 0xD3, 0x8B, 0x9A, 0xD2, 0x5D, 0x3B, 0x25, 0xBA, 0x8A, 0xA9, 0xD7,
+    0xF9, 0x6A, 0xC1, 0x09, 0xA4, 0x63, 0xA5, 0xB4, 0xAD, 0x98, 0xB6, 0xC8, 0x69, 0x96, 0x72, 0xB4,
+    0x39, 0x4C, 0xFC, 0x5D, 0x7D, 0xC0, 0xB5, 0x6E, 0x55, 0x4F, 0xC6, 0xFC, 0xB8, 0x7A, 0x20, 0x70,
+    0x48, 0x43, 0x22, 0xB5, 0xC8, 0x99, 0x08, 0x28, 0xB1, 0x51, 0x48, 0x65, 0x82, 0xEA, 0x9F, 0xB1,
+    0xB0, 0x9A, 0x2D, 0x63, 0x3D, 0x19, 0x48, 0x66, 0xF7, 0xA3, 0xAD, 0xB1, 0xB2, 0xE5, 0x8F, 0xDD,
+    0xD2, 0x83, 0xDA, 0x44, 0x49, 0x95, 0x55, 0x5D, 0x75, 0x13, 0x6C, 0xDA, 0xCB, 0xF7, 0xF4, 0x76,
+    0xAF, 0x96, 0x92, 0x16, 0x2F, 0xA6, 0x7A, 0x29, 0xCB, 0x17, 0x93, 0xA0, 0x4C, 0xD3, 0x4F, 0x2B,
+    0x18, 0x96, 0x30, 0xAD, 0xF2, 0x28, 0x29, 0x6D, 0xB4, 0xB6, 0x31, 0xC5, 0x8D, 0x56, 0x37, 0x66,
+    0x97, 0x72, 0x40, 0x60, 0x7B, 0x2B, 0x76, 0x2B, 0xB3, 0x75, 0x48, 0x7F, 0x20, 0xF2, 0xE9, 0x3C,
+    0x25, 0x9D, 0x91, 0xFA, 0x58, 0xA7, 0x55, 0x90, 0x9A, 0xEE, 0xDA, 0x07, 0xF3, 0x03, 0xED, 0xAE,
+    0xB1, 0xBB, 0xB8, 0x5A, 0x34, 0x2D, 0x5B, 0x53, 0x26, 0x58, 0x6A, 0xEF, 0x4D, 0x37, 0x3B, 0x66,
+    0xBB, 0xB3, 0xD0, 0x69, 0x5F, 0xF9, 0xEA, 0xEA, 0xA2, 0xDC, 0x86, 0x2D, 0x88, 0xAE, 0xB6, 0x61,
+    0xC6, 0x7E, 0x91, 0xC8, 0xDE, 0x6E, 0x63, 0x1E, 0x11, 0x49, 0xC6, 0xCD, 0x15, 0x74, 0x73, 0x85,
+    0x94, 0xD2, 0x1A, 0x73, 0x74, 0xD9, 0xC7, 0x8B, 0xC6, 0x8E, 0x6E, 0xB1, 0x9C, 0x98, 0x52, 0x52,
+    0xA0, 0x04, 0x51, 0x2F, 0xE2, 0x8C, 0x9E, 0x66, 0x00, 0x5F, 0xF7, 0x7D, 0x9B, 0x2A, 0x2F, 0xEA,
+    0x33, 0xCF, 0xAB, 0x2A, 0xB7, 0xF4, 0xCC, 0x21, 0xAF, 0x61, 0x30, 0xF1, 0xB5, 0xE8, 0xB6, 0xB5,
+    0xFD, 0x53, 0xBA, 0x70, 0x67, 0xA1, 0x0B, 0x34, 0xA8, 0x1F, 0x98, 0x96, 0xE7, 0x65, 0xBF, 0xFA,
+    0x91, 0x24, 0x7A, 0xA6, 0xD3, 0xA9, 0x93, 0x5A, 0x13, 0x77, 0x6C, 0x67, 0x5E, 0xE2, 0xE8, 0xC1,
+    0xB6, 0xBE, 0x2F, 0x3B, 0xF5, 0x20, 0xF2, 0x93, 0x9E, 0xDC, 0x07, 0x31, 0x5D, 0x8E, 0x0F, 0xE3,
+    0xD0, 0x7E, 0x18, 0xF7, 0x4E, 0xFD, 0x13, 0x7F, 0xEA, 0x4E, 0x51, 0xEE, 0x06, 0x75, 0xFC, 0x41,
+    0x39, 0x76, 0xA7, 0x79, 0xE7, 0x28, 0x38, 0xD6, 0xE7, 0x08, 0x41, 0xF3, 0xD0, 0xD1, 0x99, 0xD6,
+    0x3D, 0x30, 0xB8, 0x75, 0x96, 0x6F, 0x05, 0x29, 0x8C, 0x62, 0x58, 0x27, 0x29, 0xAC, 0x9B, 0xA9,
+    0x89, 0xCF, 0x74, 0xD4, 0x7B, 0x72, 0xFE, 0x2E, 0x96, 0xC6, 0xAA, 0x0E, 0x2C, 0xA8, 0x3D, 0xC5,
+    0xD6, 0x24, 0xE0, 0xC6, 0x67, 0x9E, 0xC8, 0xE4, 0x24, 0x32, 0xC9, 0x49, 0x24, 0x3B, 0x52, 0x22,
+    0x87, 0xBC, 0xEE, 0x0B, 0x7D, 0xE2, 0x33, 0x5F, 0x1B, 0x11, 0x4D, 0xEA, 0x9C, 0xD2, 0x24, 0xAD,
+    0xEB, 0x26, 0x5D, 0x75, 0x68, 0x89, 0x5A, 0x30, 0x20, 0x94, 0x90, 0x54, 0xAE, 0x11, 0xCB, 0xA1,
+    0x70, 0x29, 0x04, 0x83, 0xAC, 0x20, 0x52, 0x31, 0x42, 0xDF, 0x1B, 0x21, 0x1C, 0x90, 0x0E, 0x88,
+    0x87, 0xCB, 0x88, 0xE2, 0x43, 0x59, 0x50, 0x42, 0x08, 0x44, 0x84, 0x92, 0x91, 0x42, 0xBA, 0xBD,
+    0xD0, 0xB4, 0xEC, 0xA1, 0x79, 0x4B, 0xCD, 0x94, 0x3E, 0x72, 0x49, 0x9B, 0x28, 0x69, 0x52, 0xD7,
+    0x98, 0x63, 0xEA, 0x8F, 0xCC, 0x3C, 0x3E, 0xEE, 0x40, 0x1B, 0x58, 0x2B, 0xA4, 0xF4, 0x7F, 0xAE,
+    0xB1, 0x56, 0x79, 0x94, 0xAC, 0x31, 0x5D, 0x64, 0x66, 0x95, 0x99, 0x32, 0x88, 0xEB, 0xCC, 0xB8,
+    0xD5, 0xDD, 0xD5, 0x02, 0x33, 0x3A, 0x8C, 0xC6, 0x07, 0xD4, 0xE1, 0x09, 0xBB, 0x85, 0xB1, 0x26,
+    0x12, 0x7D, 0x16, 0xDC, 0x1E, 0x48, 0x9A, 0xD7, 0x82, 0xC9, 0xAB, 0xC0, 0x0F, 0x8B, 0x4F, 0xA5,
+    0xDC, 0xE9, 0xA5, 0x1D, 0xA6, 0xB3, 0x95, 0xA2, 0x69, 0x59, 0xE4, 0x31, 0xC9, 0x3B, 0x30, 0x1B,
+    0xA0, 0xB8, 0xD9, 0x06, 0xD5, 0xEF, 0x3E, 0x75, 0xEA, 0x28, 0xBA, 0x22, 0x22, 0x9D, 0x3A, 0x55,
+    0x8E, 0x9A, 0x58, 0x54, 0xDF, 0x1D, 0x8D, 0x89, 0xA6, 0x7C, 0xE7, 0xAB, 0x59, 0xB4, 0xAB, 0x51,
+    0x6E, 0x50, 0xDC, 0x2C, 0xA6, 0x3B, 0xFF, 0xC6, 0xCE, 0x3F, 0x7C, 0x99, 0x35, 0x12, 0x58, 0x97,
+    0x4C, 0x43, 0x5E, 0x74, 0x12, 0x7C, 0x53, 0x96, 0xB3, 0x39, 0x03, 0xFE, 0x90, 0xCF, 0x0A, 0xFB,
+    0x7C, 0xD3, 0x2D, 0x3C, 0xA4, 0x89, 0x5C, 0x0C, 0x41, 0x52, 0x19, 0xAE, 0x16, 0x3F, 0xD3, 0xA0,
+    0x67, 0x77, 0x65, 0x83, 0x3E, 0x1B, 0x16, 0xD9, 0x33, 0x1B, 0x8A, 0x26, 0xF6, 0xEC, 0x2E, 0x76,
+    0x65, 0xDF, 0x78, 0x24, 0x1A, 0xF6, 0x32, 0x6B, 0x66, 0xAA, 0x19, 0x51, 0x61, 0x9B, 0xBD, 0xE2,
+    0x6D, 0x66, 0x9F, 0x2D, 0x0E, 0xB8, 0xCB, 0xA1, 0x0F, 0x38, 0x89, 0x7C, 0x39, 0xA4, 0x6E, 0x01,
+    0xFB, 0x23, 0xFE, 0x03, 0x8E, 0xFC, 0x77, 0x86, 0xB6, 0xBC, 0x7A, 0x57, 0x58, 0xE7, 0xD0, 0x18,
+    0xEC, 0xD7, 0x2F, 0x7D, 0x4D, 0xCB, 0xB2, 0xEB, 0x03, 0x6A, 0xA5, 0x6F, 0x7C, 0xAC, 0xD1, 0xFC,
+    0xBA, 0xBC, 0xCB, 0x4C, 0x79, 0x57, 0xDE, 0x18, 0xE3, 0xD1, 0xAB, 0xB2, 0x9C, 0x9D, 0x22, 0x6E,
+    0x74, 0xA7, 0x9E, 0x78, 0x57, 0xEA, 0x8E, 0x1B, 0xCB, 0x65, 0x4E, 0xCE, 0xFC, 0x94, 0x3A, 0xC4,
+    0xB5, 0x87, 0xF4, 0x92, 0xEA, 0x0D, 0xDA, 0x37, 0xD7, 0xEF, 0x20, 0xFA, 0x62, 0x89, 0x06, 0x5C,
+    0xDC, 0xCC, 0x2A, 0x43, 0x34, 0xE0, 0xAA, 0x32, 0x77, 0x9F, 0x9B, 0x97, 0x98, 0xB7, 0x49, 0xDC,
+    0x99, 0x24, 0xA8, 0xCD, 0xD1, 0x57, 0xC0, 0x15, 0x6F, 0x31, 0x16, 0xAD, 0x91, 0x90, 0xAE, 0x67,
+    0x7F, 0xFA, 0x92, 0xAC, 0x76, 0x46, 0xDB, 0xBB, 0xBD, 0x6C, 0x61, 0xF3, 0xB0, 0x7E, 0x2E, 0xFF,
+    0x01, 0x9D, 0x58, 0xCD, 0x6F, 0xDC, 0xC6, 0x15, 0x7F, 0x24, 0x65, 0x31, 0x15, 0x2D, 0x8D, 0x0F,
+    0x0A, 0x20, 0x3B, 0x96, 0x79, 0xE9, 0x41, 0x36, 0x76, 0x97, 0x41, 0x21, 0x14, 0x7B, 0xE0, 0x8A,
+    0x93, 0xFA, 0xD6, 0x5E, 0x7C, 0x88, 0x5B, 0xA0, 0x28, 0x5A, 0x1F, 0x7A, 0x28, 0x9C, 0xB6, 0xD1,
+    0xC1, 0x07, 0x23, 0x58, 0x6B, 0xE9, 0xFA, 0x1F, 0xD0, 0xA1, 0xBE, 0xB9, 0x80, 0x0A, 0xF8, 0x60,
+    0xCB, 0x40, 0x2A, 0xA0, 0x42, 0x21, 0x04, 0x6B, 0xED, 0xC0, 0x39, 0xF4, 0x3A, 0x0D, 0xD0, 0x1E,
+    0x5A, 0x14, 0xE0, 0xC1, 0xB9, 0xA4, 0x40, 0xCB, 0x00, 0x5B, 0x64, 0x6B, 0x71, 0xC9, 0xFC, 0xDE,
+    0x70, 0xB9, 0xA2, 0x62, 0x35, 0x5E, 0x67, 0xA8, 0x19, 0xCE, 0x72, 0x3E, 0xDE, 0xC7, 0xBC, 0xF7,
+    0x7B, 0x6F, 0x44, 0x3B, 0xA7, 0x16, 0xA2, 0xB7, 0xCF, 0x5E, 0x5C, 0x77, 0xB5, 0xAB, 0xFD, 0xE1,
+    0x77, 0x1F, 0xD8, 0xF1, 0xAB, 0x1F, 0x22, 0x2B, 0xA6, 0xE4, 0xE6, 0xC1, 0x47, 0x07, 0x3B, 0xC9,
+    0xEF, 0xE3, 0x1D, 0x7A, 0xF5, 0x43, 0x64, 0x4B, 0x8F, 0x5A, 0x8F, 0x5B, 0x1F, 0x7A, 0x0B, 0xF6,
+    0xF7, 0x69, 0x61, 0x86, 0x87, 0x28, 0x2A, 0x64, 0xAF, 0xA0, 0xB2, 0x4C, 0xFB, 0x37, 0x77, 0x77,
+    0x1F, 0x0E, 0x8A, 0x62, 0xC8, 0xFD, 0x2B, 0xBB, 0xA6, 0x3C, 0x8C, 0x0A, 0x53, 0x86, 0x34, 0x2D,
+    0x69, 0xE3, 0x9B, 0x3E, 0x67, 0xAE, 0x5F, 0x97, 0xD8, 0x4F, 0xBF, 0x89, 0x37, 0xEF, 0xD4, 0x2B,
+    0x8A, 0x18, 0xF4, 0xA4, 0x15, 0x7B, 0x71, 0x48, 0xB7, 0x68, 0x44, 0x05, 0x9E, 0x1E, 0x46, 0x16,
+    0x64, 0xA0, 0x02, 0xED, 0x69, 0x47, 0x39, 0xB1, 0x4F, 0xFB, 0xF8, 0xE2, 0xC5, 0x81, 0x8A, 0xD4,
+    0x16, 0xB5, 0xF1, 0xAC, 0x92, 0x1B, 0xF3, 0x9C, 0x9D, 0xE0, 0x59, 0x16, 0x7C, 0x32, 0xF6, 0x74,
+    0xDF, 0x51, 0xA1, 0x13, 0xAF, 0xFB, 0x56, 0xB2, 0x2F, 0xA4, 0x99, 0xBC, 0x1F, 0x7C, 0x9C, 0x45,
+    0x7F, 0xCE, 0xB6, 0xDC, 0xA4, 0xED, 0xCA, 0xB6, 0x23, 0x57, 0x6D, 0xED, 0xC6, 0xFB, 0x13, 0x09,
+    0x84, 0x22, 0x11, 0x93, 0x20, 0xFE, 0x5B, 0x22, 0xBA, 0x48, 0x1F, 0xFC, 0xEA, 0xD7, 0x83, 0x22,
+    0xBF, 0xD6, 0x9E, 0xA3, 0x3E, 0x51, 0x46, 0x56, 0x46, 0xF6, 0x90, 0xEC, 0x94, 0xEC, 0x84, 0x1C,
+    0x4D, 0x8E, 0x32, 0x7F, 0x31, 0xB9, 0xC4, 0x7F, 0x50, 0xDF, 0x22, 0xD1, 0x59, 0xF3, 0x37, 0x2D,
+    0x11, 0x6A, 0x07, 0x35, 0x44, 0x6D, 0x13, 0xC9, 0xF5, 0x39, 0x2A, 0x8A, 0xCC, 0xFA, 0xDF, 0x9F,
+    0x0E, 0xA0, 0x30, 0xE2, 0xBD, 0xC8, 0xE1, 0xB7, 0x36, 0xE7, 0x8B, 0x13, 0xC3, 0x6F, 0x54, 0x57,
+    0x1A, 0x6E, 0xC8, 0x97, 0x86, 0x99, 0x8D, 0x9F, 0xBE, 0x87, 0xD3, 0x28, 0xE8, 0x5C, 0xE3, 0x4C,
+    0xB9, 0x15, 0x57, 0xEC, 0x00, 0xCD, 0x98, 0x62, 0xEF, 0x90, 0x3F, 0xC6, 0x0C, 0x68, 0x4E, 0x96,
+    0x7F, 0xE8, 0x07, 0x39, 0xCD, 0x3F, 0xA7, 0x1B, 0x44, 0x87, 0x44, 0x83, 0x84, 0x06, 0x39, 0x0D,
+    0x0A, 0xCD, 0x6D, 0xC2, 0x5F, 0x76, 0xCC, 0xC2, 0x39, 0x30, 0x38, 0x80, 0x66, 0x57, 0xD0, 0xE3,
+    0x7E, 0x24, 0x07, 0xA8, 0x3D, 0xD4, 0x15, 0x3A, 0x0F, 0x89, 0xA2, 0x18, 0x0F, 0x5B, 0xC0, 0xA3,
+    0x8F, 0x1E, 0xCD, 0x62, 0x73, 0xFC, 0x5C, 0x79, 0x7C, 0xE5, 0xC3, 0x99, 0xAC, 0xCD, 0x58, 0x5C,
+    0x6F, 0x7C, 0xFC, 0xCC, 0xE6, 0x07, 0xBD, 0xF1, 0x26, 0x95, 0xCF, 0xEC, 0x2B, 0x70, 0x32, 0xE6,
+    0x99, 0x75, 0x45, 0x55, 0x7A, 0x9A, 0x3C, 0xA3, 0xE0, 0x24, 0xA5, 0x4B, 0xDC, 0x71, 0xD5, 0x81,
+    0x51, 0x3E, 0x09, 0xD9, 0x27, 0x63, 0xFC, 0x3E, 0xF5, 0x61, 0x0E, 0x28, 0x2D, 0x82, 0xB9, 0x91,
+    0x39, 0xEF, 0x91, 0xA0, 0xB2, 0x33, 0x6C, 0x9A, 0x4E, 0x68, 0xA5, 0xB7, 0xE7, 0xB7, 0xE9, 0x82,
+    0xEC, 0x60, 0xA3, 0xAD, 0x3E, 0xBD, 0x48, 0x9B, 0xEE, 0x33, 0x9D, 0x76, 0x1C, 0x7D, 0x20, 0xDE,
+    0x77, 0xEF, 0xE9, 0x96, 0xA7, 0xBA, 0xF6, 0x73, 0xE1, 0xAA, 0x40, 0xC8, 0x2E, 0xD6, 0xC1, 0xA8,
+    0x7D, 0x42, 0xE7, 0x40, 0xC8, 0x8D, 0x16, 0x3A, 0x56, 0x2A, 0x64, 0x67, 0x03, 0x46, 0xE8, 0x28,
+    0x41, 0x5D, 0x6C, 0x4B, 0x9E, 0x14, 0x74, 0xD0, 0xB1, 0x52, 0x90, 0x17, 0x32, 0x6D, 0xC1, 0x1A,
+    0x43, 0xF2, 0xEE, 0x69, 0xE1, 0xC5, 0x18, 0xB4, 0x0B, 0xE9, 0xE6, 0x74, 0x7A, 0xA9, 0x24, 0xAA,
+    0x0B, 0x55, 0x97, 0xAB, 0x2E, 0x5A, 0x5D, 0xBA, 0xBA, 0x80, 0x75, 0x19, 0xEB, 0x62, 0xD6, 0x25,
+    0xA5, 0x2B, 0x34, 0x15, 0xD6, 0x3E, 0xD2, 0x53, 0x79, 0xBD, 0xBB, 0xE9, 0x54, 0x64, 0x41, 0xC3,
+    0xA9, 0xD4, 0x2D, 0x26, 0x39, 0x11, 0x9C, 0x05, 0xAC, 0x64, 0xEF, 0xA2, 0x5F, 0x89, 0xDF, 0x85,
+    0xBC, 0x95, 0x06, 0xFA, 0x70, 0x9D, 0x4A, 0x09, 0x5D, 0x88, 0x5F, 0xE9, 0xA1, 0xEB, 0xA9, 0xA9,
+    0x2A, 0x3A, 0x3E, 0x4D, 0xB5, 0x21, 0x46, 0x27, 0xD4, 0x20, 0x62, 0x5F, 0x06, 0xE0, 0x3C, 0xA4,
+    0x3D, 0x62, 0xF9, 0xC4, 0x6F, 0x52, 0xFF, 0x6A, 0x1A, 0x38, 0xBA, 0xE3, 0xAA, 0x50, 0xD0, 0xDE,
+    0x12, 0x25, 0x17, 0xA9, 0xFC, 0xBE, 0x81, 0x81, 0x3B, 0x18, 0xE9, 0x63, 0x28, 0x0D, 0x85, 0x95,
+    0xEC, 0x2D, 0xD9, 0x2A, 0xB9, 0xE8, 0xC4, 0xA5, 0x7F, 0x07, 0x4C, 0x1A, 0xAC, 0xB8, 0x92, 0x1D,
+    0x37, 0x72, 0x75, 0xE0, 0x24, 0xBE, 0x93, 0x08, 0x3B, 0xF1, 0x64, 0xEA, 0xCA, 0xD4, 0x91, 0x7B,
+    0x64, 0xBE, 0x67, 0x18, 0xC8, 0x30, 0xD2, 0xC5, 0x50, 0x88, 0xB1, 0x26, 0x06, 0x57, 0x31, 0xBA,
+    0x58, 0xF1, 0xB4, 0x67, 0xB8, 0xCD, 0xC8, 0xF9, 0x1D, 0x79, 0x82, 0x96, 0x3C, 0xD9, 0x00, 0x7C,
+    0xD9, 0x8A, 0xCE, 0x00, 0xD8, 0x0E, 0xEC, 0xD4, 0x53, 0x91, 0x64, 0x72, 0x22, 0x76, 0x15, 0xBE,
+    0x6E, 0x5B, 0x12, 0x6D, 0x8A, 0x25, 0x7D, 0x70, 0xB1, 0x45, 0x23, 0x27, 0xF1, 0xE2, 0x55, 0xFA,
+    0x36, 0x19, 0xEC, 0x02, 0x78, 0x05, 0xB1, 0x0B, 0xD6, 0x02, 0x08, 0xEA, 0xAA, 0x05, 0xBA, 0x03,
+    0x2D, 0x92, 0x05, 0xBD, 0x76, 0x19, 0xBA, 0x0C, 0xCF, 0x7C, 0xEA, 0x7C, 0xE6, 0x56, 0x9A, 0xB2,
+    0x20, 0x3D, 0x25, 0x14, 0xF6, 0x97, 0xDC, 0x72, 0x7F, 0xCE, 0xFA, 0x3C, 0xB5, 0x78, 0x4E, 0xD7,
+    0xD8, 0x01, 0x74, 0x89, 0xB5, 0xAE, 0x32, 0xFB, 0xA4, 0xE4, 0xEA, 0x33, 0xF8, 0x09, 0x25, 0x4A,
+    0x1F, 0xEC, 0x81, 0x96, 0x24, 0x33, 0x85, 0x22, 0x7B, 0x44, 0x3D, 0x67, 0x48, 0x87, 0xC0, 0xB5,
+    0xA7, 0xA8, 0x99, 0x93, 0x50, 0xE6, 0x6A, 0x1A, 0x7A, 0xCA, 0x4A, 0xB9, 0x8A, 0xD8, 0x4E, 0x84,
+    0xB4, 0xB5, 0xC0, 0x59, 0xFA, 0xA8, 0xAB, 0x80, 0xD0, 0x06, 0x10, 0xAF, 0x31, 0x3D, 0x9C, 0x05,
+    0xFA, 0x39, 0x45, 0xEF, 0x64, 0x14, 0x7D, 0x0F, 0xD5, 0x3A, 0x3E, 0x38, 0xBB, 0x48, 0x48, 0xFC,
+    0x2D, 0x63, 0x9C, 0xC2, 0xD1, 0x05, 0x14, 0x2E, 0x07, 0x34, 0xD7, 0x0F, 0x00, 0xCD, 0xC0, 0xA8,
+    0xD1, 0x53, 0xA2, 0xCF, 0x47, 0x64, 0x1D, 0x25, 0x64, 0xE5, 0x6C, 0xDC, 0xC4, 0xE8, 0x5C, 0xD6,
+    0x9A, 0x47, 0x9B, 0x20, 0x17, 0x4F, 0xEA, 0xE4, 0x5B, 0x00, 0x48, 0x06, 0xBC, 0x8E, 0xCE, 0x99,
+    0x5F, 0x6D, 0x6E, 0x36, 0xD9, 0x31, 0x1C, 0xE5, 0x62, 0x17, 0xC4, 0x9D, 0x32, 0xD0, 0xCD, 0x17,
+    0x2F, 0x78, 0xE8, 0xCD, 0x77, 0x59, 0x1F, 0x45, 0xC1, 0x74, 0xEE, 0xFF, 0x70, 0x8C, 0xA0, 0xC2,
+    0x81, 0xC5, 0x28, 0x52, 0x1B, 0x54, 0xBD, 0x51, 0x52, 0xF4, 0x4A, 0xEC, 0xA6, 0xE6, 0x04, 0xAF,
+    0x39, 0xCA, 0x4C, 0xA0, 0x9E, 0x99, 0x32, 0xC3, 0xA8, 0x01, 0xFA, 0x1B, 0xF8, 0xB6, 0x8F, 0xB1,
+    0x74, 0x1F, 0xC3, 0x21, 0x86, 0x9B, 0xC6, 0xB6, 0xD9, 0xAC, 0x9A, 0xF8, 0x15, 0x9A, 0x45, 0x53,
+    0xD3, 0x35, 0xED, 0x5A, 0xF9, 0xDA, 0x2A, 0xAD, 0xC7, 0x7F, 0x60, 0x74, 0x6F, 0xE5, 0x65, 0xBC,
+    0xCE, 0xEF, 0xF3, 0xAB, 0x18, 0x18, 0xB9, 0x77, 0xBE, 0x53, 0x6A, 0x70, 0xAF, 0x5F, 0x86, 0xE9,
+    0xE5, 0xF2, 0xC5, 0x0D, 0x5B, 0x42, 0x87, 0x16, 0xC0, 0xCE, 0x5E, 0x48, 0xFE, 0xC7, 0xB1, 0x95,
+    0xB5, 0xC9, 0xFD, 0x62, 0x5E, 0xF5, 0x36, 0x7F, 0x49, 0xBD, 0x81, 0x72, 0x8F, 0xB2, 0x0B, 0x83,
+    0x4F, 0xDF, 0x79, 0x92, 0xBF, 0x1B, 0xFD, 0x27, 0x71, 0xF2, 0x9C, 0x2E, 0x2F, 0x1E, 0xDA, 0xDB,
+    0xFF, 0x48, 0xA8, 0x11, 0x48, 0xFB, 0x93, 0x21, 0x85, 0xF3, 0x60, 0xEE, 0x06, 0x0B, 0x37, 0xC5,
+    0x05, 0xE8, 0x32, 0x8E, 0x8A, 0xD8, 0x04, 0x21, 0xC4, 0x1B, 0x43, 0x84, 0xC7, 0x58, 0xDA, 0x12,
+    0x6C, 0xC2, 0x8A, 0xBA, 0x95, 0x54, 0x83, 0x46, 0x14, 0x03, 0x21, 0xB7, 0xAB, 0x41, 0x23, 0x30,
+    0x47, 0xF3, 0x72, 0xD0, 0x2C, 0xDA, 0x37, 0xB6, 0xFA, 0x7F, 0x76, 0x2C, 0xD5, 0x00, 0x82, 0xC1,
+    0xE4, 0x60, 0x37, 0x58, 0x3B, 0xA8, 0x30, 0x0B, 0x84, 0xEE, 0xB2, 0x42, 0x11, 0xEC, 0x02, 0x08,
+    0xE2, 0x26, 0xEA, 0x3A, 0x85, 0x22, 0xF7, 0x53, 0x09, 0x5B, 0xC6, 0x76, 0xAA, 0x8C, 0xB8, 0x48,
+    0x00, 0xC8, 0x47, 0x0D, 0xF8, 0x68, 0xE8, 0xE4, 0x56, 0x83, 0xDF, 0x12, 0xED, 0x3E, 0xAA, 0x8E,
+    0xA1, 0xC0, 0x8C, 0x9E, 0x2C, 0x67, 0x54, 0xB3, 0xEE, 0xA0, 0xF6, 0x8F, 0x09, 0x5A, 0x15, 0x41,
+    0x10, 0x2B, 0x50, 0x7F, 0x04, 0x91, 0xD9, 0xA4, 0x3C, 0x3D, 0x21, 0x56, 0x11, 0x94, 0x25, 0xC1,
+    0x6A, 0x2B, 0x10, 0xBB, 0x30, 0x46, 0xAE, 0xF5, 0xE8, 0x84, 0xE9, 0x23, 0xA0, 0xC3, 0xFA, 0xAD,
+    0xF1, 0xFB, 0x70, 0xD0, 0xC8, 0x49, 0xDD, 0xA4, 0x83, 0x97, 0x76, 0xD2, 0x90, 0x02, 0x47, 0xD9,
+    0xE9, 0x1C, 0xF8, 0x95, 0x8E, 0x71, 0x65, 0x23, 0xDD, 0x53, 0x43, 0x87, 0x59, 0x80, 0x4A, 0x98,
+    0xE2, 0xD8, 0xA4, 0x02, 0x5E, 0x62, 0x7C, 0x63, 0xA3, 0x54, 0x63, 0x58, 0xDA, 0x6A, 0xBB, 0x4C,
+    0x39, 0x6E, 0x7D, 0x35, 0x5A, 0xB0, 0xB7, 0xEC, 0x18, 0x67, 0x71, 0x46, 0xC7, 0xAF, 0x72, 0xFF,
+    0x7A, 0x61, 0xF6, 0xC6, 0xEC, 0x9A, 0xF0, 0xC4, 0xC8, 0xCA, 0x3A, 0xEC, 0xB6, 0x60, 0xCB, 0x1E,
+    0x82, 0x29, 0x16, 0x3E, 0x02, 0x08, 0x00, 0x0D, 0x98, 0x1D, 0x50, 0xF5, 0x34, 0x60, 0xE4, 0x10,
+    0xC7, 0x0B, 0x46, 0x3C, 0x89, 0x0F, 0x82, 0x99, 0x10, 0xCC, 0xC2, 0xD2, 0x49, 0xE2, 0x6B, 0x4C,
+    0x33, 0x9F, 0x34, 0xA5, 0x6A, 0xEB, 0xB9, 0x95, 0x9F, 0xB3, 0x7B, 0xE6, 0x3F, 0xD3, 0x74, 0x68,
+    0xA7, 0x06, 0x6F, 0x12, 0x9C, 0x6D, 0xE6, 0x68, 0x28, 0x3D, 0x23, 0x89, 0xBE, 0x39, 0x69, 0x36,
+    0x1A, 0x37, 0xE1, 0xD6, 0x57, 0x2C, 0xFB, 0x21, 0x9B, 0x97, 0xC7, 0xB1, 0x04, 0x31, 0x8D, 0xDB,
+    0x86, 0xD1, 0x42, 0x68, 0x94, 0xD0, 0x7E, 0x49, 0x03, 0x0F, 0x41, 0x4A, 0x02, 0x97, 0xD1, 0x3A,
+    0xDC, 0x1A, 0xFB, 0x39, 0x2E, 0x83, 0xDD, 0x81, 0x42, 0xC6, 0xAA, 0xFC, 0xE2, 0x48, 0x95, 0x36,
+    0x5B, 0x79, 0x7E, 0x55, 0x2F, 0xD5, 0x50, 0x20, 0x9C, 0x58, 0xF9, 0xED, 0x63, 0x44, 0xE0, 0xCA,
+    0xCE, 0x60, 0x20, 0x4B, 0xD7, 0x9D, 0xC9, 0xA4, 0xC2, 0x43, 0x72, 0xFF, 0x5A, 0x8C, 0xC9, 0x56,
+    0x48, 0x00, 0xBF, 0xAE, 0xC9, 0xB9, 0x41, 0x86, 0xAA, 0x5E, 0x6C, 0xA3, 0xE1, 0xFD, 0xBE, 0x59,
+    0xE3, 0x2A, 0x88, 0xD7, 0x53, 0x85, 0xAC, 0x8E, 0xB6, 0xC8, 0x45, 0xF1, 0xAF, 0xFF, 0x46, 0xC5,
+    0x55, 0x75, 0x5A, 0x0D, 0x8A, 0xAB, 0xDA, 0xC3, 0x1C, 0xEB, 0xE6, 0xEE, 0x63, 0x4E, 0xE2, 0xDF,
+    0x7A, 0x51, 0x8C, 0x6C, 0x5D, 0x8C, 0x2D, 0x8D, 0x6F, 0xBA, 0x28, 0x6A, 0x35, 0x77, 0x74, 0x91,
+    0x01, 0x6C, 0x87, 0xB8, 0x44, 0x94, 0xBB, 0x03, 0x3B, 0x17, 0xA1, 0xAD, 0xE8, 0x07, 0xE8, 0xFE,
+    0x1D, 0x9D, 0xC3, 0x22, 0xBE, 0x59, 0xDC, 0xA7, 0xDE, 0x1F, 0x34, 0xDD, 0x5A, 0x83, 0xBD, 0xB6,
+    0x71, 0xE8, 0xB7, 0xCF, 0x96, 0xB9, 0x2E, 0xF3, 0x12, 0x7B, 0xA9, 0x48, 0x3D, 0xFD, 0x92, 0x99,
+    0xCA, 0x48, 0xF5, 0xD4, 0x21, 0xEC, 0x77, 0x1D, 0x67, 0xE9, 0xC9, 0xEA, 0xFB, 0x5B, 0x05, 0x2C,
+    0x2E, 0x07, 0x46, 0xC3, 0xC3, 0x7D, 0x5C, 0x18, 0xA0, 0x62, 0x83, 0xC4, 0xD7, 0xD0, 0x2C, 0xD3,
+    0xEB, 0x94, 0x73, 0x55, 0x64, 0xB8, 0xD5, 0x62, 0x10, 0x02, 0x5A, 0x78, 0xCA, 0x1E, 0x5F, 0x3F,
+    0x64, 0xC0, 0x4B, 0xEA, 0xBB, 0x01, 0x33, 0xD6, 0x71, 0xD6, 0x4F, 0x61, 0x52, 0xC1, 0x2F, 0x9A,
+    0x64, 0x1F, 0xE5, 0x16, 0xF0, 0xD3, 0xCA, 0x07, 0x92, 0xF4, 0x1F, 0xA1, 0xD8, 0x14, 0xD7, 0x88,
+    0xE4, 0xED, 0x12, 0xFC, 0x4A, 0x28, 0x63, 0xF8, 0xF5, 0xEF, 0xE1, 0x16, 0xF1, 0x05, 0xBC, 0x02,
+    0xA8, 0x0B, 0xC8, 0x95, 0xC0, 0x5B, 0xBA, 0x7C, 0x16, 0xBB, 0x03, 0x69, 0x19, 0x66, 0x2B, 0x8C,
+    0xF3, 0xE2, 0x44, 0xFC, 0x45, 0x8B, 0x67, 0xCA, 0xBE, 0x1A, 0xB3, 0xB1, 0x7A, 0x26, 0xD8, 0xAF,
+    0x9A, 0x71, 0x70, 0xB7, 0x69, 0x6C, 0x09, 0x0E, 0x5E, 0xDE, 0x4C, 0xCC, 0xB8, 0x40, 0xFA, 0xE0,
+    0xC7, 0x8D, 0x20, 0x6E, 0x33, 0xCA, 0x90, 0x3B, 0xA4, 0x54, 0xE4, 0x94, 0x36, 0xC5, 0x5D, 0x1D,
+    0x3A, 0x47, 0xAA, 0x4D, 0x03, 0x59, 0x93, 0x73, 0x9E, 0xE3, 0x1A, 0xF5, 0x3E, 0x7B, 0x02, 0x6B,
+    0x7A, 0xCE, 0xA8, 0x68, 0xE0, 0x37, 0x35, 0x4E, 0xB1, 0x3E, 0x99, 0x03, 0x72, 0x73, 0xCD, 0x39,
+    0xBA, 0xB4, 0xDA, 0x24, 0xF1, 0x93, 0x2E, 0xD9, 0xFF, 0x4C, 0xE8, 0xDA, 0xE0, 0xAE, 0x44, 0x90,
+    0x54, 0x8F, 0x07, 0x3F, 0x8E, 0xAD, 0x7F, 0xC3, 0xB9, 0x1E, 0x1C, 0x50, 0xB0, 0xBA, 0x41, 0x6F,
+    0xAC, 0xBE, 0xC1, 0x79, 0x63, 0x95, 0x64, 0xC2, 0x37, 0x84, 0x9E, 0xD4, 0xA9, 0x91, 0xAF, 0xB1,
+    0x0F, 0x71, 0xB8, 0x9A, 0xE0, 0x67, 0x8D, 0x99, 0x97, 0xE6, 0x73, 0x3A, 0xE6, 0x29, 0x4E, 0xC8,
+    0x84, 0xE2, 0x94, 0xCC, 0x27, 0x4E, 0xCA, 0x5A, 0xC4, 0x69, 0x19, 0x52, 0x39, 0x24, 0x66, 0x6D,
+    0xE2, 0xD4, 0x6C, 0xB3, 0xDA, 0xC2, 0xE2, 0x88, 0xCC, 0xA0, 0x55, 0x36, 0x27, 0x3D, 0xF7, 0x02,
+    0xBB, 0x77, 0x24, 0xF9, 0x96, 0x63, 0x9A, 0x12, 0x84, 0xE9, 0x55, 0x6B, 0xD7, 0xD8, 0x9B, 0x07,
+    0x8C, 0x3C, 0x05, 0x37, 0x77, 0x8E, 0x13, 0x89, 0xD2, 0x48, 0xB7, 0xF9, 0xA0, 0xD2, 0xAA, 0x71,
+    0x93, 0xFA, 0x20, 0xD6, 0x5E, 0xAE, 0xAD, 0xDD, 0xAA, 0xAD, 0x45, 0xD6, 0x85, 0x9B, 0x57, 0xEB,
+    0x6B, 0x8C, 0xF0, 0xBC, 0x99, 0x13, 0xE1, 0xA6, 0x36, 0x31, 0x1E, 0xB3, 0xFF, 0xB4, 0xB1, 0xF5,
+    0xE9, 0xCB, 0x96, 0xF9, 0x9E, 0xD7, 0x23, 0x73, 0xD5, 0x33, 0x34, 0xD0, 0x5B, 0xE1, 0xDD, 0x4E,
+    0x2D, 0x86, 0xFD, 0xE3, 0x4D, 0xA7, 0x48, 0xBF, 0x66, 0xC5, 0xE7, 0x69, 0xCB, 0xE6, 0xE4, 0x90,
+    0x9B, 0x8E, 0xAD, 0x5A, 0x0C, 0x18, 0x54, 0x6B, 0x6E, 0x3E, 0xF9, 0x6C, 0x17, 0x41, 0x1F, 0x70,
+    0xF4, 0x95, 0x81, 0x15, 0x5B, 0xAD, 0xBC, 0xB4, 0x16, 0xAE, 0x82, 0x84, 0x56, 0x5E, 0x9A, 0x52,
+    0x9E, 0x33, 0xBF, 0x23, 0xF9, 0xAD, 0xBA, 0xC0, 0xFC, 0xC5, 0x08, 0xBC, 0x05, 0xEE, 0x07, 0x06,
+    0x46, 0x59, 0x18, 0xEE, 0xAF, 0x19, 0xD9, 0x7A, 0xE6, 0x02, 0xBB, 0x6C, 0x74, 0xCB, 0x5F, 0xB7,
+    0xCC, 0xEC, 0xE3, 0x8B, 0xDE, 0x6B, 0x5C, 0x2B, 0x17, 0xCB, 0x67, 0xD6, 0x15, 0x51, 0x16, 0x8C,
+    0x44, 0xEA, 0x6A, 0x04, 0xDF, 0x78, 0xC6, 0x7F, 0xE1, 0x20, 0xD8, 0xB9, 0x5A, 0xA4, 0xC1, 0x28,
+    0xCA, 0x66, 0x5B, 0x01, 0xC4, 0x4B, 0xDA, 0x8D, 0x76, 0xC3, 0x4B, 0x66, 0xA3, 0x02, 0x39, 0xE2,
+    0xD7, 0x93, 0xFC, 0x4B, 0x6D, 0x54, 0x31, 0x6C, 0x23, 0x45, 0x14, 0x7D, 0x3B, 0x03, 0x8C, 0xE4,
+    0xE1, 0x3C, 0xD7, 0x80, 0x84, 0x20, 0xDE, 0xE6, 0x8A, 0x53, 0x94, 0xB0, 0x57, 0xA4, 0xB0, 0xD0,
+    0x6E, 0x3C, 0x54, 0x29, 0x52, 0x90, 0x86, 0x2A, 0x85, 0x53, 0x21, 0x94, 0x26, 0x29, 0x22, 0xC5,
+    0x85, 0x7D, 0x9E, 0x50, 0x1C, 0x6D, 0x8A, 0x93, 0x28, 0x28, 0x48, 0x91, 0xE6, 0x5C, 0x5D, 0xE1,
+    0x22, 0x42, 0xC6, 0x19, 0x41, 0x47, 0x35, 0x20, 0x24, 0x44, 0x81, 0x34, 0xC0, 0xE9, 0xAE, 0x64,
+    0x90, 0x16, 0x69, 0x73, 0xB2, 0xB2, 0xFC, 0x59, 0x8B, 0x88, 0xA0, 0xB3, 0x9F, 0x2C, 0xCF, 0x9F,
+    0xDD, 0x79, 0xEF, 0xBF, 0xFF, 0xE7, 0xE3, 0xD2, 0xF0, 0x17, 0x41, 0xE9, 0x32, 0x43, 0x55, 0xA0,
+    0x1A, 0xA2, 0x9A, 0xA1, 0x5C, 0x24, 0x61, 0xC1, 0xC2, 0x8C, 0xBB, 0xA1, 0xB4, 0x9B, 0x07, 0x90,
+    0x25, 0x98, 0xE6, 0x36, 0x01, 0xD0, 0x83, 0xA2, 0x6F, 0x1B, 0x2B, 0x58, 0x43, 0x8E, 0x2E, 0x0A,
+    0xD3, 0x01, 0x58, 0x80, 0x08, 0x48, 0x3D, 0x8E, 0x1D, 0x7E, 0xB6, 0x7C, 0xDB, 0xB6, 0x95, 0x2D,
+    0xFA, 0x8F, 0xC7, 0xF5, 0x02, 0x29, 0x90, 0x21, 0x19, 0x6B, 0x36, 0x31, 0xAC, 0x2E, 0x79, 0x1D,
+    0x04, 0x0E, 0x5B, 0xB8, 0xFB, 0x26, 0xD0, 0xF9, 0x1A, 0x9D, 0xBE, 0x05, 0xF7, 0x84, 0x43, 0xEE,
+    0x4B, 0x61, 0xE7, 0x07, 0xFA, 0xDD, 0x0A, 0x38, 0x70, 0xEC, 0xEF, 0x20, 0x2C, 0x69, 0xD2, 0x19,
+    0x11, 0xD6, 0xBA, 0xB7, 0x6D, 0x47, 0x24, 0x85, 0x20, 0x5C, 0x21, 0x6D, 0x76, 0xA0, 0x45, 0x85,
+    0xAC, 0xF6, 0xBD, 0x3A, 0x6C, 0x24, 0x6E, 0x8F, 0x1B, 0x48, 0x90, 0x20, 0x52, 0x83, 0xA7, 0x48,
+    0x1C, 0xB8, 0x8D, 0x01, 0xD2, 0x75, 0x1F, 0xF1, 0x93, 0xD4, 0x4E, 0xFC, 0x50, 0x2A, 0x53, 0x29,
+    0x53, 0xAA, 0x6F, 0x3D, 0xAF, 0x35, 0xAB, 0x75, 0x96, 0xBA, 0x19, 0xF7, 0x15, 0xF7, 0x94, 0xE4,
+    0xC3, 0xBE, 0x91, 0x57, 0xC0, 0xA5, 0x16, 0x2F, 0xBC, 0x3A, 0x09, 0x29, 0xC8, 0x8B, 0x32, 0x4D,
+    0x4A, 0xF5, 0x79, 0x10, 0x75, 0x00, 0x77, 0x10, 0xB6, 0xAB, 0x74, 0xF1, 0x10, 0xE9, 0x33, 0x60,
+    0x2F, 0xB2, 0x2C, 0xB1, 0xFF, 0xF2, 0x8C, 0x70, 0xB3, 0xA4, 0xAD, 0xFD, 0xC9, 0x19, 0x61, 0x5C,
+    0x87, 0xFD, 0xC9, 0x69, 0x43, 0x8E, 0xB7, 0x3E, 0xDE, 0xA1, 0x25, 0x04, 0x30, 0x8F, 0x3E, 0x49,
+    0x8B, 0x54, 0x93, 0x8B, 0x28, 0x80, 0x21, 0x30, 0x6B, 0xB0, 0xF8, 0xF7, 0x0F, 0x45, 0x36, 0x01,
+    0xA5, 0x41, 0x39, 0x45, 0xE5, 0x06, 0x49, 0x68, 0x36, 0x8A, 0xE8, 0x3C, 0x39, 0x79, 0x0B, 0xF4,
+    0xE8, 0x28, 0xBE, 0x9C, 0x94, 0x10, 0x0E, 0x99, 0xC6, 0x45, 0xC3, 0xD8, 0x4B, 0x8D, 0xFA, 0xC4,
+    0xA9, 0x13, 0xA7, 0x98, 0x5D, 0xE1, 0x76, 0x8D, 0x9B, 0x5C, 0x98, 0xAE, 0xD0, 0x47, 0xE2, 0xF1,
+    0x1E, 0x73, 0x18, 0x1B, 0xF6, 0x3C, 0x48, 0x5B, 0x29, 0xCC, 0x32, 0xCC, 0x36, 0x31, 0x2B, 0xB0,
+    0x18, 0xA1, 0x1A, 0x25, 0xE5, 0x88, 0x85, 0x82, 0xDB, 0xAC, 0x1F, 0xED, 0x85, 0x30, 0x18, 0x6B,
+    0xF9, 0x27, 0x5E, 0xCF, 0x1A, 0xEA, 0x25, 0xD7, 0x52, 0x71, 0x15, 0xF1, 0xF6, 0x15, 0x56, 0x27,
+    0xBA, 0xB1, 0xD7, 0x88, 0x1F, 0x03, 0x79, 0x2B, 0x50, 0x46, 0xB9, 0x64, 0x97, 0xD4, 0x58, 0x8F,
+    0x86, 0x70, 0xBB, 0xD3, 0x86, 0x1B, 0xD7, 0x76, 0x32, 0x69, 0xF2, 0xB9, 0xF4, 0x64, 0xB9, 0xB0,
+    0x33, 0xA6, 0x1B, 0xD1, 0xBB, 0x06, 0xB5, 0x86, 0xF0, 0xE4, 0xCB, 0x3D, 0x16, 0x06, 0x3C, 0x6C,
+    0xF6, 0x6D, 0x2C, 0x04, 0x9D, 0xC3, 0x03, 0x54, 0xC0, 0x07, 0x01, 0x7F, 0x78, 0xF6, 0x9D, 0x93,
+    0xC2, 0xAE, 0xEF, 0xFE, 0xD4, 0xAB, 0xAF, 0xA1, 0x4C, 0xB4, 0x6F, 0x6C, 0x92, 0xC9, 0x59, 0x52,
+    0x57, 0x9C, 0x80, 0x0D, 0x81, 0xBB, 0x2D, 0xA0, 0x3D, 0xD7, 0xED, 0x5D, 0x17, 0x5F, 0x64, 0x61,
+    0x83, 0x85, 0x21, 0xF7, 0xBD, 0xE5, 0x69, 0x63, 0xC3, 0x9F, 0x7B, 0x65, 0x7C, 0x0A, 0x4D, 0x49,
+    0x8C, 0xAF, 0x31, 0xFF, 0xC8, 0xCE, 0xA4, 0x9D, 0x89, 0xF8, 0x3B, 0x54, 0x26, 0xF6, 0x77, 0x85,
+    0xB4, 0x2E, 0xB3, 0x3A, 0x74, 0xE1, 0x1F, 0x30, 0xEA, 0x49, 0x4D, 0x3D, 0x4E, 0x0D, 0x8E, 0x0D,
+    0x80, 0xCE, 0xB3, 0xB1, 0x1C, 0x14, 0x78, 0x67, 0x59, 0xD1, 0x26, 0x0B, 0x7A, 0x35, 0x9E, 0xF1,
+    0x5B, 0xE0, 0xB5, 0x21, 0x07, 0xD2, 0x6D, 0x5F, 0xF0, 0x30, 0x4C, 0xC2, 0x90, 0x85, 0xDE, 0xAE,
+    0x95, 0xD7, 0x60, 0x24, 0xF6, 0x4B, 0xDB, 0xE3, 0xAE, 0xE0, 0x7E, 0xD4, 0xA0, 0xA7, 0x9C, 0xAA,
+    0x2D, 0xA5, 0x70, 0x57, 0xE9, 0xB0, 0x89, 0xAB, 0x0B, 0x64, 0x0E, 0xB8, 0xD7, 0xB0, 0x34, 0x58,
+    0x9D, 0x9F, 0x13, 0x6E, 0x96, 0x31, 0x32, 0x39, 0x27, 0xF4, 0xEA, 0x72, 0x75, 0x72, 0x76, 0xD3,
+    0x4E, 0xB4, 0x44, 0xA2, 0x63, 0xBD, 0x17, 0x31, 0x5D, 0xEA, 0x28, 0x6A, 0x98, 0x65, 0x3B, 0x14,
+    0xB7, 0x41, 0x11, 0xBA, 0x7F, 0xD2, 0xC4, 0x14, 0xA0, 0x1B, 0x84, 0xA6, 0x88, 0x45, 0xD3, 0x3F,
+    0xE9, 0x7F, 0xB0, 0xAC, 0x72, 0xD1, 0xD4, 0xB7, 0x8C, 0x97, 0x32, 0x35, 0xB1, 0xE0, 0xB1, 0xC0,
+    0x4F, 0x76, 0xC4, 0x67, 0xAE, 0xCD, 0x6C, 0xCE, 0xED, 0x80, 0x9B, 0xA9, 0xD0, 0x4F, 0x15, 0xA6,
+    0x19, 0x06, 0x5F, 0xED, 0x64, 0x5B, 0x0E, 0x4F, 0x20, 0xB6, 0xF5, 0x8A, 0xD4, 0xB9, 0xC2, 0x60,
+    0x88, 0xF9, 0x29, 0xA6, 0x88, 0x28, 0xDE, 0x8B, 0x53, 0x83, 0x76, 0xE5, 0x96, 0x5D, 0x61, 0x2E,
+    0x4F, 0xFC, 0x20, 0xF1, 0x53, 0xE6, 0xA6, 0xDC, 0xD2, 0x09, 0x79, 0x27, 0xEE, 0xBE, 0x61, 0x3E,
+    0xE5, 0xD6, 0x27, 0xBF, 0x1B, 0xBC, 0x6C, 0x54, 0x0D, 0x91, 0xFC, 0x0A, 0xAE, 0x70, 0x47, 0xEA,
+    0x0B, 0xEE, 0x92, 0x0B, 0xB4, 0xFA, 0xFA, 0x35, 0xBA, 0xCC, 0x04, 0xB2, 0xF4, 0x0B, 0xBB, 0xDE,
+    0xB0, 0xE4, 0x6B, 0x71, 0xD2, 0xB4, 0x0C, 0x5D, 0xCA, 0x58, 0x17, 0xA1, 0x21, 0x5B, 0x5A, 0x1D,
+    0xDB, 0x57, 0x35, 0xFC, 0x29, 0x0D, 0x96, 0x5B, 0x4F, 0xB2, 0x73, 0xC5, 0x5D, 0x5B, 0xE0, 0xCE,
+    0x7D, 0xAC, 0x04, 0x64, 0x17, 0xC8, 0x69, 0x88, 0x75, 0x70, 0xA4, 0x70, 0xC8, 0x5C, 0xCB, 0x08,
+    0xCB, 0x8D, 0xD0, 0xF2, 0x7F, 0x33, 0x2E, 0xD7, 0x99, 0x5E, 0x6D, 0x7D, 0x78, 0x86, 0xF4, 0xF8,
+    0xFB, 0x21, 0xD4, 0xC9, 0xB3, 0x1C, 0x29, 0xF3, 0x39, 0x88, 0xAB, 0x0B, 0x62, 0x3B, 0x42, 0x4E,
+    0xA6, 0x80, 0x18, 0x03, 0x8E, 0x24, 0xFE, 0xC2, 0xA1, 0x24, 0xEF, 0x56, 0x5B, 0x3A, 0x6D, 0x54,
+    0xA5, 0xAF, 0x54, 0xF5, 0xE8, 0x54, 0xFC, 0x12, 0xB8, 0x1F, 0x08, 0x3B, 0xA0, 0x98, 0xC4, 0x54,
+    0x21, 0xB4, 0x99, 0xEB, 0x08, 0xFD, 0xFE, 0x15, 0xB1, 0xC6, 0x61, 0x36, 0xA0, 0x5E, 0x8B, 0xFE,
+    0x43, 0x6C, 0x19, 0xC5, 0x4C, 0x1C, 0x0B, 0x1E, 0xF8, 0x86, 0x06, 0x04, 0x1E, 0x48, 0x74, 0xDB,
+    0x8D, 0xC3, 0x9A, 0xEB, 0xF4, 0x3C, 0xDD, 0xB9, 0xAD, 0x37, 0x35, 0xFF, 0x00, 0x6D, 0x57, 0x4F,
+    0x6C, 0xDC, 0x68, 0x15, 0x7F, 0xB6, 0xDB, 0x18, 0xE2, 0x26, 0x2E, 0x52, 0xAB, 0x05, 0x25, 0x8D,
+    0xF7, 0xB0, 0x87, 0x52, 0xB2, 0x75, 0x85, 0x06, 0x14, 0xB4, 0xCD, 0xD8, 0x4B, 0xCF, 0x2B, 0x55,
+    0x88, 0x6E, 0x25, 0xF6, 0x50, 0x24, 0x2E, 0x88, 0x4B, 0x22, 0x58, 0x69, 0x39, 0x64, 0x66, 0xDC,
+    0xF6, 0xC6, 0x0A, 0x91, 0xCB, 0x9E, 0xF6, 0x12, 0xC1, 0x4A, 0xB4, 0x53, 0x89, 0xE4, 0x50, 0xA1,
+    0x22, 0xCD, 0xC4, 0xEE, 0xF6, 0xD0, 0xC3, 0x1E, 0x70, 0x59, 0x15, 0x0E, 0x7B, 0xA8, 0xC5, 0xB6,
+    0x2C, 0x6A, 0x40, 0xF1, 0xAA, 0x6E, 0xE5, 0x24, 0xCE, 0x98, 0xDF, 0xEF, 0xFB, 0x66, 0xA6, 0xB3,
+    0x12, 0xA3, 0xF8, 0xBD, 0x8C, 0xE7, 0xF3, 0xF7, 0xBD, 0x3F, 0xBF, 0xF7, 0x7B, 0xCF, 0x22, 0xFC,
+    0x78, 0x03, 0x88, 0x3D, 0x2F, 0x12, 0x2B, 0x73, 0x23, 0x71, 0x93, 0x69, 0x11, 0x9F, 0xF7, 0x03,
+    0x8A, 0x96, 0x71, 0xE9, 0x52, 0xD8, 0xB3, 0xEB, 0x3A, 0xE9, 0x49, 0x65, 0x41, 0x94, 0x14, 0x85,
+    0x15, 0x2D, 0x1B, 0x39, 0xD6, 0x5D, 0x83, 0xC0, 0x8F, 0x85, 0xE0, 0x61, 0xAC, 0xB6, 0x53, 0x8A,
+    0x04, 0xC2, 0xE1, 0x36, 0x6E, 0x34, 0x83, 0x35, 0xD1, 0x9A, 0x48, 0x5D, 0x57, 0xA2, 0x3F, 0xBF,
+    0x8F, 0x44, 0x3E, 0xC5, 0xB5, 0x13, 0x89, 0x53, 0x97, 0xD2, 0xB9, 0xDF, 0x37, 0x5E, 0xFC, 0xA6,
+    0x69, 0x7F, 0xFA, 0xD6, 0x79, 0xF7, 0xDE, 0x31, 0xF1, 0xED, 0x63, 0x12, 0x38, 0xF3, 0xD2, 0x9E,
+    0x3E, 0x2D, 0xFD, 0x99, 0x86, 0xF4, 0x8E, 0x9D, 0x93, 0x6A, 0x7E, 0x55, 0xAA, 0xD3, 0x5B, 0xD2,
+    0x6B, 0x6C, 0x48, 0xAB, 0x91, 0x4A, 0xF3, 0xDC, 0xDD, 0xC4, 0xFB, 0xF2, 0x93, 0x08, 0xE7, 0x62,
+    0xE3, 0xC7, 0x22, 0xF7, 0x42, 0x31, 0xEE, 0x89, 0x98, 0xF7, 0x65, 0xF2, 0x13, 0x1F, 0xC2, 0x8A,
+    0xBD, 0x38, 0x82, 0x1F, 0x5E, 0x22, 0x15, 0x1C, 0xB3, 0x72, 0x71, 0x22, 0x87, 0x26, 0xBA, 0x34,
+    0xD1, 0x0F, 0xE9, 0xA4, 0x5B, 0x0C, 0xA4, 0x3D, 0xF5, 0xAC, 0x16, 0xD8, 0x31, 0x2B, 0x3D, 0xA3,
+    0x3A, 0x22, 0x95, 0x09, 0x7F, 0x2A, 0xAC, 0x86, 0x80, 0x57, 0x3D, 0x7A, 0xD5, 0xA2, 0x57, 0x81,
+    0x93, 0x9C, 0x13, 0xEF, 0xAF, 0x57, 0xB1, 0x4F, 0xBD, 0x9B, 0x88, 0x51, 0x33, 0x72, 0x06, 0xB7,
+    0xF1, 0xE9, 0xE0, 0x2B, 0x83, 0x6E, 0x25, 0x46, 0x21, 0x6B, 0x62, 0xE6, 0xB2, 0x24, 0xD8, 0xA0,
+    0xC1, 0xB0, 0x1C, 0x17, 0x2B, 0x1D, 0xC5, 0xC6, 0x49, 0x46, 0xA7, 0xBB, 0x35, 0xEC, 0x73, 0x3F,
+    0xF8, 0x31, 0xE2, 0x4F, 0x6B, 0x19, 0xF1, 0xA9, 0xB8, 0x3B, 0x14, 0xD2, 0xE2, 0xBD, 0x1E, 0x05,
+    0xE3, 0x36, 0x35, 0xC0, 0x19, 0x41, 0x9D, 0x8F, 0x7D, 0xF3, 0x71, 0xB0, 0xB1, 0xB7, 0x92, 0x60,
+    0x53, 0xF8, 0xE3, 0x46, 0x30, 0xCE, 0x13, 0x2B, 0xD2, 0x79, 0x7B, 0x29, 0xB8, 0xB3, 0x19, 0x77,
+    0x91, 0x59, 0xE4, 0x8F, 0xE9, 0x10, 0x2D, 0x9C, 0xBA, 0xC6, 0x86, 0x6E, 0x38, 0x5C, 0x22, 0xE7,
+    0x29, 0x6E, 0xE3, 0xB2, 0xEA, 0xC7, 0x0B, 0xE2, 0xD5, 0xC8, 0xCB, 0x69, 0xA3, 0xA6, 0xBD, 0x47,
+    0xF4, 0x79, 0x43, 0xB5, 0xA8, 0x55, 0x43, 0xAB, 0x2D, 0x91, 0x33, 0x1B, 0xFE, 0xD5, 0x9D, 0x54,
+    0xFC, 0x2F, 0xEB, 0x67, 0xC0, 0x80, 0xF5, 0xEC, 0xFA, 0xC1, 0x83, 0x4A, 0xAC, 0xFF, 0x9A, 0x35,
+    0xCC, 0xB6, 0x4B, 0xB3, 0x82, 0x72, 0x72, 0xAB, 0x94, 0x52, 0x9C, 0xD4, 0xCA, 0x11, 0x1A, 0x37,
+    0xB1, 0x33, 0x04, 0x07, 0x16, 0xE3, 0xBB, 0x78, 0xA1, 0x93, 0x20, 0x40, 0x3E, 0x73, 0x93, 0x21,
+    0x4F, 0x3E, 0x6E, 0x4B, 0x53, 0x02, 0x26, 0xA9, 0x29, 0x71, 0x08, 0xD5, 0x92, 0x5A, 0xEC, 0x83,
+    0xB0, 0x67, 0xED, 0x8A, 0x85, 0x80, 0xD9, 0x38, 0xF7, 0xB8, 0xC8, 0xAC, 0xB6, 0x60, 0xFE, 0x2B,
+    0x09, 0xEF, 0x64, 0x16, 0x42, 0xE4, 0xE5, 0x46, 0xBC, 0x2E, 0x76, 0x41, 0x63, 0xED, 0x92, 0xAE,
+    0x39, 0x15, 0x92, 0x21, 0x6E, 0x8F, 0x76, 0xCF, 0xB6, 0x64, 0x55, 0xE4, 0x54, 0x00, 0xE3, 0x01,
+    0x9F, 0xBA, 0x8E, 0x8C, 0xD6, 0x95, 0x0F, 0x9E, 0x88, 0x2C, 0xB9, 0x57, 0x53, 0x99, 0xDE, 0xDE,
+    0xDC, 0xD9, 0x97, 0xE9, 0xC1, 0xE6, 0xC1, 0x53, 0x78, 0x67, 0x7D, 0x8E, 0x48, 0xE5, 0xD6, 0x33,
+    0xC8, 0xCC, 0x38, 0x40, 0xAC, 0x52, 0x98, 0x22, 0x46, 0x42, 0x69, 0x26, 0xB2, 0x2D, 0x32, 0xF7,
+    0x58, 0x96, 0x15, 0xCE, 0x18, 0xBF, 0x80, 0x48, 0xC4, 0xBD, 0x41, 0xCC, 0xB0, 0x9A, 0x85, 0xCB,
+    0xF0, 0x59, 0x39, 0x51, 0x44, 0x55, 0x50, 0x65, 0x04, 0x96, 0xD8, 0x5A, 0x31, 0x22, 0x0D, 0x51,
+    0xB0, 0x5C, 0xA5, 0x72, 0x1E, 0x60, 0xA9, 0x17, 0xF9, 0x1F, 0xD6, 0x91, 0x78, 0x3B, 0x87, 0x01,
+    0x94, 0x5F, 0xAF, 0x13, 0x3A, 0x81, 0xAE, 0xA9, 0x40, 0xC3, 0xA7, 0xAD, 0x73, 0xD8, 0xD7, 0x09,
+    0xEC, 0x69, 0x55, 0x29, 0x65, 0x03, 0x27, 0xEE, 0xDF, 0x15, 0x52, 0xEC, 0x81, 0x0E, 0xCA, 0x45,
+    0x62, 0x73, 0x4F, 0x86, 0xA6, 0xD1, 0x26, 0x31, 0x4B, 0x65, 0x14, 0x6C, 0x34, 0x4A, 0x51, 0xD6,
+    0x19, 0x95, 0xD6, 0x52, 0xA9, 0xD8, 0x65, 0x46, 0xE5, 0x7E, 0x51, 0x00, 0x5B, 0x66, 0xE1, 0x33,
+    0x83, 0x30, 0x74, 0x19, 0xA0, 0x76, 0x13, 0x2F, 0x59, 0x96, 0x57, 0xC5, 0x7D, 0x3A, 0x50, 0xDC,
+    0xE0, 0xD5, 0x48, 0x1D, 0x76, 0xF4, 0x2F, 0x20, 0xA1, 0xC8, 0x4D, 0x00, 0x27, 0x4D, 0x58, 0x1D,
+    0x70, 0x5B, 0xFC, 0x10, 0xD0, 0x2A, 0x3B, 0x83, 0xC1, 0x87, 0x46, 0x84, 0xCD, 0xFB, 0xB2, 0x6D,
+    0x25, 0x66, 0x86, 0xBB, 0x81, 0x95, 0x5A, 0x29, 0x40, 0xED, 0xFF, 0xAD, 0xF0, 0x22, 0x58, 0xEB,
+    0xE4, 0x2C, 0x56, 0xD1, 0xC5, 0xE4, 0x62, 0xDB, 0x0D, 0xE9, 0x0C, 0xE0, 0x0C, 0x00, 0x33, 0x57,
+    0xC0, 0x38, 0x20, 0xC8, 0x4A, 0x14, 0xA4, 0xC4, 0x0E, 0x59, 0xCA, 0xA5, 0xB8, 0xF4, 0x79, 0xA1,
+    0x94, 0x53, 0xD4, 0xE7, 0x2B, 0xA6, 0xA0, 0x92, 0x77, 0xF1, 0x47, 0xBD, 0x55, 0x49, 0x2E, 0x27,
+    0x07, 0x97, 0x9E, 0x1C, 0xBE, 0xFD, 0x24, 0xEC, 0xD4, 0xEA, 0x93, 0x48, 0xDF, 0x8A, 0x7A, 0x78,
+    0x5C, 0x5A, 0x8E, 0xF4, 0xF1, 0xB8, 0xB4, 0x67, 0xA5, 0x7F, 0x8A, 0x7A, 0x51, 0x5A, 0xCC, 0x60,
+    0x73, 0x49, 0x5A, 0xEF, 0x52, 0x6F, 0x49, 0x8B, 0x01, 0x0A, 0x32, 0x69, 0x32, 0x60, 0x41, 0xC2,
+    0x3F, 0x68, 0xB8, 0x16, 0x6A, 0x5E, 0xA4, 0xFB, 0x97, 0x2E, 0x5D, 0x94, 0x93, 0xD8, 0x58, 0x82,
+    0x0A, 0x04, 0x03, 0x61, 0x65, 0x14, 0x39, 0x84, 0x09, 0x71, 0x94, 0xC2, 0xBD, 0xF6, 0x7F, 0xC4,
+    0x55, 0x0A, 0xEC, 0x45, 0xD1, 0xA4, 0x68, 0x51, 0x54, 0x95, 0xFB, 0xF0, 0x9D, 0xA2, 0x72, 0x81,
+    0xC9, 0x21, 0x9E, 0xCD, 0x5A, 0xB1, 0x14, 0xBF, 0x7A, 0x38, 0xF7, 0x17, 0xF1, 0x0D, 0x91, 0x6E,
+    0xFC, 0x11, 0x2D, 0xC4, 0x75, 0xA2, 0xC9, 0x3A, 0x66, 0xD8, 0xDF, 0xAC, 0xE8, 0x33, 0x4F, 0x45,
+    0x9D, 0x21, 0x79, 0xAC, 0x32, 0xB3, 0xD0, 0x7C, 0xE7, 0x31, 0xF0, 0x7E, 0x68, 0xB3, 0xBA, 0x5C,
+    0xA6, 0xC4, 0x43, 0xB5, 0x86, 0x6F, 0x80, 0x2E, 0xA2, 0xCF, 0x12, 0x71, 0x77, 0xDE, 0x3F, 0x88,
+    0xEC, 0x01, 0x0B, 0xEB, 0xA2, 0x84, 0xFA, 0xD4, 0x33, 0xDD, 0xEE, 0x86, 0xC4, 0xF5, 0x04, 0xD9,
+    0x68, 0xEC, 0x40, 0xF4, 0x41, 0x38, 0x56, 0x06, 0x0C, 0xA2, 0x8A, 0x13, 0x54, 0xAD, 0x19, 0x2A,
+    0x4B, 0x5E, 0xF2, 0xD4, 0xF4, 0xA0, 0x1B, 0x92, 0x3E, 0x42, 0x19, 0xC2, 0x5E, 0xD5, 0x05, 0xD0,
+    0x60, 0xAB, 0xAF, 0xD9, 0x58, 0x8C, 0x7F, 0x05, 0x54, 0x7E, 0x8A, 0x12, 0xFA, 0x30, 0x25, 0x9C,
+    0x42, 0x8D, 0x57, 0x3C, 0x72, 0x17, 0x18, 0x98, 0x1B, 0xBC, 0x09, 0x30, 0x2A, 0xDC, 0x10, 0xA2,
+    0x6C, 0x34, 0x19, 0xCB, 0xC0, 0x49, 0xCF, 0x2A, 0x0E, 0xBD, 0x43, 0xF9, 0x31, 0xB7, 0x73, 0x7F,
+    0x87, 0x27, 0xA7, 0xE3, 0xBA, 0xFB, 0x11, 0xC0, 0xA3, 0x9A, 0x51, 0xA0, 0x28, 0x36, 0x50, 0x35,
+    0xD8, 0x56, 0x87, 0xB7, 0xD4, 0x71, 0x7D, 0x93, 0x88, 0xAF, 0x14, 0xDE, 0x2B, 0x19, 0xA8, 0xF3,
+    0x3B, 0x22, 0xAF, 0x1C, 0x4A, 0x90, 0xC2, 0xE9, 0xC4, 0x21, 0xB3, 0x03, 0x2B, 0x80, 0xF8, 0x66,
+    0xE2, 0xB2, 0xE1, 0x9D, 0x32, 0x4A, 0x2B, 0x5A, 0x34, 0xD1, 0xF0, 0x68, 0x04, 0x2D, 0x59, 0x27,
+    0x4D, 0xA6, 0xEC, 0x2D, 0x6C, 0x32, 0xFC, 0x07, 0xAD, 0x40, 0x8E, 0xB8, 0x9F, 0x91, 0x61, 0x09,
+    0xE3, 0x0E, 0x32, 0x36, 0x47, 0x67, 0xBE, 0x1D, 0x8C, 0xDB, 0x68, 0x9B, 0xA2, 0x4F, 0x2A, 0xAF,
+    0x27, 0xA8, 0xFC, 0xB8, 0x8C, 0x99, 0x54, 0x25, 0x3C, 0xD1, 0xFA, 0x9D, 0x75, 0xA5, 0xB6, 0xE3,
+    0x6D, 0x5D, 0x12, 0x6B, 0x8E, 0xFE, 0xA1, 0x34, 0x33, 0xA5, 0x0B, 0x29, 0xD4, 0xF2, 0x5C, 0xEE,
+    0x88, 0x0E, 0xE9, 0x9A, 0xD2, 0xA9, 0x26, 0x72, 0x04, 0x69, 0x59, 0x74, 0xAF, 0x51, 0xDA, 0x1D,
+    0xE9, 0x48, 0xB7, 0x15, 0x10, 0xC5, 0x1A, 0x9B, 0x16, 0xA8, 0xBF, 0xE7, 0x55, 0xAA, 0x55, 0x94,
+    0xBF, 0xF6, 0x89, 0x2A, 0xA3, 0xC8, 0xDD, 0xF0, 0x5B, 0xCB, 0x70, 0x32, 0x77, 0xC2, 0x3F, 0xA3,
+    0xDE, 0xEE, 0x42, 0xA7, 0x7D, 0xF1, 0x7E, 0x98, 0xBB, 0xB2, 0xF1, 0xF9, 0x83, 0xBE, 0x55, 0xBE,
+    0x8E, 0x32, 0x88, 0x53, 0xEB, 0x91, 0xB2, 0x40, 0xB7, 0x7A, 0x1E, 0x35, 0xC4, 0xAC, 0x3B, 0x04,
+    0x91, 0x37, 0xEA, 0x53, 0x43, 0xBD, 0x3C, 0x06, 0x92, 0x87, 0x07, 0xFB, 0x30, 0xB7, 0x58, 0x00,
+    0xB9, 0xCE, 0x8A, 0x31, 0xBA, 0x0A, 0x4C, 0x0A, 0x25, 0x28, 0xBB, 0x02, 0x55, 0xF7, 0x50, 0x85,
+    0xAC, 0xC0, 0x20, 0x55, 0x45, 0x77, 0x1C, 0xED, 0x7B, 0x15, 0x57, 0x11, 0x64, 0x66, 0xF5, 0x5E,
+    0x6E, 0xB5, 0xFF, 0x59, 0x38, 0x5E, 0x52, 0x1D, 0x73, 0xC3, 0xEA, 0xF4, 0x94, 0x0A, 0x6A, 0x53,
+    0x5D, 0x96, 0x9C, 0x15, 0x27, 0xC4, 0x95, 0x9C, 0x17, 0x6B, 0x1F, 0xE7, 0x00, 0x3E, 0x9D, 0xFA,
+    0xDF, 0xF8, 0xED, 0xCA, 0x3E, 0xC6, 0x00, 0xC0, 0xC7, 0xC9, 0x28, 0x81, 0x04, 0x8B, 0x8C, 0x10,
+    0x1A, 0x57, 0x1E, 0xBE, 0xCD, 0x26, 0x9C, 0x00, 0x15, 0x53, 0x9B, 0x4F, 0x6F, 0xED, 0xA9, 0xE4,
+    0x1F, 0x72, 0x32, 0xE0, 0x4A, 0xF4, 0x23, 0xB2, 0xEE, 0x4F, 0x08, 0xFD, 0x4E, 0xBD, 0x3E, 0x4C,
+    0xA0, 0x46, 0xFA, 0x57, 0xA4, 0xA6, 0x51, 0x45, 0xEA, 0x32, 0xA7, 0x88, 0xAC, 0x56, 0xCD, 0x73,
+    0xF4, 0x61, 0xD6, 0x56, 0xB0, 0x81, 0xBD, 0xBF, 0x5B, 0x8A, 0x7F, 0xF7, 0x5E, 0x25, 0xDB, 0x66,
+    0x52, 0x81, 0x86, 0x23, 0x30, 0xB1, 0x15, 0x86, 0x6E, 0x8A, 0xB6, 0xE6, 0x25, 0x36, 0x8B, 0xDD,
+    0xC1, 0x89, 0xE1, 0x2C, 0x0F, 0x47, 0x40, 0x3A, 0xB2, 0xD0, 0xBD, 0xD1, 0x91, 0xB3, 0x71, 0xD9,
+    0x96, 0x25, 0x2F, 0x69, 0x4B, 0xC3, 0x8B, 0x3A, 0xD2, 0xF0, 0xC3, 0x40, 0x56, 0xD9, 0x2D, 0xB7,
+    0x50, 0xD4, 0x59, 0x06, 0xCF, 0x07, 0xFF, 0x3A, 0xA4, 0x8D, 0xE8, 0x40, 0x66, 0x3A, 0x01, 0xA4,
+    0x97, 0x29, 0x09, 0x54, 0x82, 0x3A, 0x4A, 0x2A, 0x5A, 0x31, 0x1F, 0x51, 0x5A, 0x9F, 0xA8, 0x59,
+    0x4D, 0xCD, 0x44, 0x0B, 0xE8, 0xBD, 0x06, 0xE3, 0x52, 0x19, 0xDD, 0xFD, 0x5B, 0xFB, 0x37, 0xD8,
+    0xFC, 0x72, 0x6E, 0x08, 0x69, 0x5C, 0x7E, 0x78, 0xF9, 0xF9, 0x45, 0x46, 0x07, 0xC8, 0x5D, 0xE0,
+    0x8C, 0x03, 0xA8, 0xD1, 0xED, 0xDB, 0x2A, 0x04, 0x9C, 0x94, 0x54, 0x65, 0x57, 0xE0, 0x6B, 0x4E,
+    0x2B, 0x31, 0x3A, 0x44, 0x3D, 0x32, 0x22, 0xC6, 0x6A, 0xFB, 0x79, 0xCC, 0x40, 0x7B, 0x91, 0x6A,
+    0xF6, 0xC0, 0x87, 0x3B, 0x1E, 0x84, 0xFC, 0x68, 0xBA, 0xDB, 0xAD, 0x37, 0x58, 0xB9, 0x19, 0x0C,
+    0xC8, 0x87, 0x4C, 0x10, 0x97, 0xAC, 0x13, 0xD4, 0xA2, 0xC3, 0xB8, 0xBA, 0xE3, 0xA9, 0x6D, 0x24,
+    0x5E, 0x13, 0x87, 0x54, 0x67, 0x0D, 0x36, 0x71, 0x6E, 0x3C, 0x1E, 0xC4, 0x86, 0x1F, 0x2E, 0x5F,
+    0xC1, 0x4D, 0xFB, 0x60, 0x17, 0x84, 0x77, 0xFD, 0xFD, 0x1C, 0xBD, 0xE7, 0x42, 0x8E, 0x90, 0x5F,
+    0x80, 0x3B, 0xB6, 0x81, 0xFD, 0x1C, 0x86, 0x7C, 0x96, 0xC7, 0xCF, 0x30, 0xE4, 0xF3, 0x0C, 0xF9,
+    0x3C, 0x43, 0xBE, 0x48, 0xB1, 0xC4, 0x92, 0x6D, 0x50, 0xAC, 0xF2, 0xEB, 0x16, 0x7F, 0xCD, 0xB8,
+    0x38, 0xFD, 0x26, 0x42, 0x9E, 0xDE, 0x06, 0x82, 0x76, 0x73, 0x86, 0x1C, 0x11, 0xB5, 0x08, 0x0D,
+    0x8B, 0x87, 0x1B, 0x6A, 0x62, 0x1E, 0xCF, 0x8C, 0x15, 0xCB, 0xA3, 0x64, 0xF1, 0x16, 0x30, 0xF8,
+    0x3B, 0x83, 0xCD, 0xA7, 0xCA, 0x23, 0x94, 0x97, 0xCF, 0xAA, 0x65, 0x5B, 0x4F, 0x9B, 0x2C, 0xA2,
+    0x65, 0x16, 0x6B, 0x8B, 0x6E, 0xB1, 0x9D, 0x47, 0x15, 0x09, 0x9F, 0x3D, 0x94, 0x71, 0x0E, 0xC8,
+    0x7C, 0x4D, 0x73, 0x24, 0x5A, 0xE6, 0x5E, 0x08, 0xC2, 0x55, 0xF8, 0x3A, 0x2A, 0xE3, 0x4E, 0x81,
+    0x85, 0xDE, 0xC3, 0x01, 0xED, 0x0D, 0x98, 0x05, 0x96, 0x34, 0xF3, 0x44, 0x60, 0xEA, 0xE6, 0xAE,
+    0x60, 0xC9, 0x2A, 0x90, 0x40, 0x0D, 0x1F, 0x2A, 0x60, 0xBA, 0xC1, 0xA8, 0xC1, 0x5D, 0x31, 0x72,
+    0x21, 0x47, 0x4F, 0xFC, 0xA8, 0x90, 0x37, 0xFE, 0xF4, 0xA2, 0x90, 0x3F, 0xFC, 0xF6, 0xFB, 0xB9,
+    0xFC, 0x71, 0xFE, 0x57, 0xE8, 0x1C, 0x8B, 0x78, 0xCE, 0x23, 0x8D, 0xCF, 0xFE, 0x00, 0xC7, 0xCE,
+    0x7C, 0x0F, 0x4F, 0x7D, 0xED, 0xD5, 0x48, 0x0D, 0xFE, 0x75, 0x34, 0xD5, 0xED, 0x76, 0x27, 0x02,
+    0xCF, 0x34, 0x8A, 0x77, 0xF9, 0xF9, 0x8A, 0x2C, 0x5A, 0xA8, 0xEB, 0x25, 0x2B, 0x9B, 0x91, 0x86,
+    0x9D, 0xCE, 0x0C, 0x47, 0xDF, 0x89, 0xF9, 0x77, 0xD4, 0xD7, 0x26, 0x5E, 0x36, 0x9A, 0x63, 0x31,
+    0xA6, 0x4A, 0x9F, 0x80, 0x40, 0xB9, 0x0E, 0xCC, 0x5B, 0x83, 0x9B, 0xBA, 0xDE, 0xDA, 0x6A, 0x39,
+    0x0E, 0x2A, 0xA7, 0x55, 0x3B, 0xEC, 0xEB, 0x3A, 0x84, 0x0B, 0x67, 0x38, 0xED, 0x3F, 0xD6, 0x9B,
+    0x01, 0x6A, 0x0A, 0x35, 0xF4, 0x8C, 0xD3, 0x97, 0x0A, 0x83, 0xA2, 0x67, 0xA4, 0xCB, 0x19, 0xE5,
+    0xCE, 0xDB, 0x93, 0xC9, 0x57, 0x17, 0x27, 0x41, 0xFF, 0x71, 0xEE, 0xA7, 0x43, 0x26, 0xE7, 0x74,
+    0x63, 0xD5, 0x61, 0x28, 0x53, 0x3E, 0x2D, 0x0D, 0x18, 0xCE, 0x38, 0x3C, 0x2D, 0xCE, 0xA1, 0xC4,
+    0xF2, 0xF5, 0x35, 0xB6, 0x8E, 0x9E, 0x9E, 0x44, 0x5C, 0x06, 0x9C, 0x34, 0x26, 0xAF, 0x6B, 0x5E,
+    0x9E, 0xDB, 0x9B, 0x63, 0x47, 0x19, 0x8E, 0x35, 0xA2, 0x40, 0xBC, 0x4C, 0x9A, 0x5E, 0xE5, 0xC8,
+    0xB1, 0x85, 0x78, 0xC8, 0x5F, 0x56, 0x10, 0x53, 0x00, 0x62, 0x20, 0xD3, 0x3D, 0x32, 0xE6, 0x22,
+    0xD8, 0x0B, 0xC0, 0xC3, 0x88, 0xD2, 0xE0, 0x9C, 0xFB, 0xDE, 0x5B, 0x2E, 0x81, 0x0D, 0x38, 0xBE,
+    0xD8, 0xC1, 0x60, 0x95, 0x5D, 0x8F, 0x74, 0x15, 0x30, 0x07, 0xF2, 0x0D, 0x0A, 0x83, 0x83, 0x12,
+    0xDE, 0xC5, 0x58, 0x00, 0x71, 0xA2, 0xDF, 0x0A, 0x64, 0xD8, 0xC7, 0x37, 0x46, 0xC4, 0xA3, 0x4A,
+    0xC1, 0x48, 0x99, 0x6D, 0xC4, 0xD3, 0xFD, 0xE2, 0x11, 0xA6, 0x1A, 0xEB, 0x5A, 0x89, 0xDE, 0x16,
+    0x56, 0x66, 0x6E, 0x4B, 0x0F, 0x1D, 0x1D, 0x23, 0x11, 0x4A, 0xA1, 0xE5, 0x26, 0x33, 0x98, 0x8C,
+    0xA2, 0x79, 0xB4, 0x85, 0x70, 0x51, 0x2A, 0x1F, 0x16, 0x55, 0x01, 0x2C, 0x2A, 0x9B, 0xD2, 0x30,
+    0x0A, 0x4C, 0xCE, 0x66, 0xDE, 0xC3, 0x5C, 0x0C, 0x91, 0x71, 0x5C, 0xE7, 0x58, 0x39, 0xB7, 0xBF,
+    0x99, 0xEA, 0x29, 0xD7, 0xCA, 0x80, 0x36, 0x8B, 0xD3, 0x1D, 0x22, 0x89, 0x79, 0x3F, 0xD1, 0x73,
+    0x88, 0x9E, 0xF5, 0xC1, 0x42, 0x7E, 0x64, 0xC6, 0xBB, 0x87, 0x7C, 0x1D, 0x09, 0x27, 0xB2, 0x3D,
+    0x5D, 0xDF, 0xE4, 0xD8, 0x70, 0x73, 0x72, 0x8A, 0x10, 0x86, 0xD9, 0x56, 0xA9, 0xD2, 0x34, 0xAA,
+    0xCA, 0x6A, 0x8A, 0x6F, 0x1D, 0xD3, 0xE7, 0x86, 0xEF, 0xAB, 0xC6, 0x21, 0x1C, 0x76, 0xFE, 0x73,
+    0x0B, 0x54, 0xF2, 0xF3, 0x7F, 0x24, 0xD2, 0x7C, 0xED, 0x63, 0x54, 0x05, 0x81, 0x59, 0x7E, 0x37,
+    0x02, 0x13, 0xFF, 0x92, 0x13, 0xC8, 0xCF, 0x26, 0x07, 0x8D, 0x97, 0xC2, 0x54, 0x73, 0x47, 0x31,
+    0x3E, 0x4D, 0xE1, 0x0D, 0xED, 0x45, 0x4E, 0x5E, 0x46, 0x69, 0x05, 0xA4, 0xEE, 0x8E, 0x7A, 0x5D,
+    0x12, 0x83, 0xAF, 0x3D, 0x36, 0x5F, 0x7A, 0x9C, 0x45, 0x92, 0xD1, 0x1D, 0xFA, 0x5B, 0x73, 0x1B,
+    0xCC, 0x83, 0x76, 0x06, 0x18, 0x3B, 0x29, 0x45, 0xE2, 0x72, 0x24, 0x52, 0x02, 0xA8, 0xF3, 0x22,
+    0x00, 0xD4, 0xDF, 0x29, 0x86, 0x6D, 0x3E, 0x20, 0xF0, 0x9A, 0x04, 0xAD, 0xAA, 0xCD, 0xBE, 0x2E,
+    0x50, 0x25, 0xDA, 0x2C, 0x50, 0x84, 0xA4, 0x40, 0xFF, 0xB1, 0xF7, 0x56, 0x32, 0x9C, 0xCB, 0x0C,
+    0xE2, 0x75, 0x17, 0x82, 0x33, 0xC1, 0x09, 0xA0, 0xF1, 0x7F, 0x63, 0x60, 0x60, 0xB0, 0xFF, 0xEF,
+    0x50, 0xFF, 0x9F, 0x01, 0x08, 0x00, 0x4D, 0x8F, 0x21, 0x12, 0xC2, 0x30, 0x10, 0x45, 0x7F, 0x1B,
+    0x20, 0xA2, 0x22, 0x28, 0x0C, 0x02, 0x8B, 0xCB, 0x05, 0x80, 0xD2, 0x1B, 0x70, 0x13, 0x2E, 0x40,
+    0xA7, 0x1C, 0x81, 0xE3, 0x20, 0x60, 0xC8, 0x11, 0x72, 0x84, 0x6A, 0x14, 0xA2, 0x02, 0x01, 0x84,
+    0xBF, 0x1B, 0x04, 0x2B, 0xFA, 0xE6, 0x67, 0xBA, 0xF9, 0x79, 0x00, 0xC6, 0x3B, 0xC8, 0x74, 0x1F,
+    0xF9, 0x96, 0x83, 0x0B, 0x84, 0x8D, 0x56, 0x50, 0x05, 0x13, 0x09, 0x77, 0xD4, 0xB4, 0xD8, 0xBA,
+    0x8C, 0xFD, 0x9D, 0xF0, 0x45, 0x4A, 0x44, 0xCD, 0x4C, 0x6C, 0xE0, 0x65, 0xBD, 0x65, 0xE6, 0x5C,
+    0x98, 0x15, 0xAD, 0xE0, 0x95, 0xF1, 0x64, 0x06, 0x8A, 0x81, 0x99, 0x3D, 0x0F, 0x66, 0xC0, 0x3C,
+    0x98, 0x89, 0xFE, 0x1F, 0x36, 0xE2, 0x73, 0x96, 0x72, 0x74, 0x3D, 0xCB, 0x03, 0x46, 0xFA, 0x06,
+    0x7D, 0xA5, 0x96, 0x21, 0xB7, 0x20, 0xDF, 0x8B, 0xD9, 0x33, 0x9F, 0x9D, 0xF0, 0x9B, 0x6C, 0x54,
+    0x26, 0x35, 0x72, 0x51, 0x57, 0xFD, 0xD6, 0x04, 0x5D, 0x54, 0xA3, 0x5A, 0x4A, 0x78, 0x28, 0x25,
+    0x98, 0x27, 0x78, 0x1A, 0xBD, 0x6F, 0x0D, 0x8D, 0x4C, 0xEF, 0x02, 0x4B, 0x6C, 0xA8, 0x8E, 0x34,
+    0xB2, 0x61, 0x22, 0x5D, 0xB6, 0xD7, 0x4A, 0xF3, 0x86, 0x8A, 0xA5, 0xA0, 0xCD, 0x7E, 0x50, 0xA3,
+    0xF2, 0xA5, 0x46, 0xB8, 0x8A, 0xD1, 0x92, 0x3F, 0x10, 0x2B, 0xAC, 0x45, 0x65, 0x85, 0x83, 0xA0,
+    0x6E, 0x06, 0x31, 0xAA, 0x52, 0x54, 0xA3, 0x29, 0xC4, 0xE8, 0x0B, 0x35, 0xCE, 0xB1, 0x11, 0xC2,
+    0x30, 0x0C, 0x40, 0x51, 0x05, 0x15, 0x29, 0x28, 0xCC, 0x06, 0x19, 0x21, 0x0D, 0x7D, 0xE8, 0x59,
+    0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D, 0x8B, 0x30, 0x84, 0x47, 0x70, 0xC3, 0x06, 0x29, 0x52, 0x20,
+    0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE, 0xC5, 0x3B, 0x9D, 0x25, 0xF2, 0x3F, 0xC7, 0x1E, 0xFB, 0xBD,
+    0xCA, 0x29, 0x92, 0x28, 0x91, 0x85, 0x35, 0xD2, 0x1E, 0x81, 0x5A, 0x64, 0x76, 0x4C, 0xF9, 0xB5,
+    0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F, 0x53, 0xF3, 0x29, 0xCC, 0x27, 0x13, 0x7C, 0x94, 0xB2, 0xC0,
+    0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6, 0x09, 0x76, 0x50, 0x47, 0x38, 0x43, 0x1E, 0xE0, 0x4E, 0x13,
+    0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A, 0x8C, 0x4D, 0xC9, 0x22, 0x83, 0x69, 0x8B, 0xFF, 0xAE, 0xBA,
+    0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41, 0x8E, 0xAD, 0xEF, 0x79, 0xE9, 0x39, 0xF8, 0xFD, 0x02,
 };
 
 static const EpdGlyph notoserif_14_italicGlyphs[] = {
@@ -2405,99 +2412,99 @@ static const EpdGlyph notoserif_14_italicGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 9, 22, 155, 1, 21, 50, 0 }, // !
-    { 10, 8, 190, 3, 21, 20, 50 }, // "
-    { 17, 21, 261, 0, 21, 90, 70 }, // #
-    { 16, 26, 261, 0, 23, 104, 160 }, // $
-    { 24, 23, 418, 1, 22, 138, 264 }, // %
-    { 21, 23, 346, 1, 22, 121, 402 }, // &
-    { 5, 8, 103, 3, 21, 10, 523 }, // '
-    { 11, 27, 161, 1, 23, 75, 533 }, // (
-    { 12, 26, 161, -2, 22, 78, 608 }, // )
-    { 13, 13, 233, 3, 23, 43, 686 }, // *
-    { 14, 13, 261, 1, 17, 46, 729 }, // +
-    { 6, 9, 117, -1, 4, 14, 775 }, // ,
-    { 9, 4, 145, 0, 10, 9, 789 }, // -
-    { 5, 5, 117, 0, 4, 7, 798 }, // .
-    { 15, 27, 134, -3, 23, 102, 805 }, // /
-    { 15, 23, 261, 1, 22, 87, 907 }, // 0
-    { 13, 21, 214, -1, 21, 69, 994 }, // 1
-    { 16, 22, 261, -1, 22, 88, 1063 }, // 2
-    { 17, 23, 261, -1, 22, 98, 1151 }, // 3
-    { 17, 21, 261, -1, 21, 90, 1249 }, // 4
-    { 16, 22, 261, 0, 21, 88, 1339 }, // 5
-    { 16, 23, 261, 1, 22, 92, 1427 }, // 6
-    { 15, 21, 261, 2, 21, 79, 1519 }, // 7
-    { 16, 23, 261, 0, 22, 92, 1598 }, // 8
-    { 15, 23, 261, 1, 22, 87, 1690 }, // 9
-    { 8, 17, 133, 0, 16, 34, 1777 }, // :
-    { 9, 21, 133, -1, 16, 48, 1811 }, // ;
-    { 14, 15, 261, 1, 18, 53, 1859 }, // <
-    { 14, 9, 261, 1, 15, 32, 1912 }, // =
-    { 14, 15, 261, 1, 18, 53, 1944 }, // >
-    { 13, 23, 233, 3, 22, 75, 1997 }, // ?
-    { 25, 26, 430, 1, 21, 163, 2072 }, // @
-    { 22, 21, 329, -2, 21, 116, 2235 }, // A
-    { 20, 21, 305, -1, 21, 105, 2351 }, // B
-    { 18, 23, 293, 1, 22, 104, 2456 }, // C
-    { 22, 21, 338, -1, 21, 116, 2560 }, // D
-    { 20, 21, 291, -1, 21, 105, 2676 }, // E
-    { 20, 21, 275, -1, 21, 105, 2781 }, // F
-    { 20, 23, 333, 1, 22, 115, 2886 }, // G
-    { 26, 21, 370, -1, 21, 137, 3001 }, // H
-    { 14, 21, 171, -1, 21, 74, 3138 }, // I
-    { 18, 28, 167, -5, 21, 126, 3212 }, // J
-    { 24, 21, 327, -1, 21, 126, 3338 }, // K
-    { 18, 21, 291, -1, 21, 95, 3464 }, // L
-    { 30, 21, 438, -1, 21, 158, 3559 }, // M
-    { 26, 21, 356, -1, 21, 137, 3717 }, // N
-    { 20, 23, 346, 1, 22, 115, 3854 }, // O
-    { 19, 21, 289, -1, 21, 100, 3969 }, // P
-    { 20, 29, 346, 1, 22, 145, 4069 }, // Q
-    { 20, 21, 310, -1, 21, 105, 4214 }, // R
-    { 17, 23, 254, 0, 22, 98, 4319 }, // S
-    { 18, 21, 286, 2, 21, 95, 4417 }, // T
-    { 22, 22, 341, 2, 21, 121, 4512 }, // U
-    { 21, 21, 315, 2, 21, 111, 4633 }, // V
-    { 31, 21, 488, 2, 21, 163, 4744 }, // W
-    { 24, 21, 308, -2, 21, 126, 4907 }, // X
-    { 19, 21, 292, 2, 21, 100, 5033 }, // Y
-    { 20, 21, 282, -1, 21, 105, 5133 }, // Z
-    { 13, 27, 168, 0, 23, 88, 5238 }, // [
-    { 4, 27, 134, 3, 23, 27, 5326 }, // <backslash>
-    { 13, 27, 168, -2, 23, 88, 5353 }, // ]
-    { 14, 14, 261, 1, 21, 49, 5441 }, // ^
-    { 15, 3, 214, -3, -2, 12, 5490 }, // _
-    { 6, 6, 130, 4, 23, 9, 5502 }, // `
-    { 16, 17, 270, 1, 16, 68, 5511 }, // a
-    { 16, 24, 262, 0, 23, 96, 5579 }, // b
-    { 14, 17, 227, 1, 16, 60, 5675 }, // c
-    { 16, 24, 270, 1, 23, 96, 5735 }, // d
-    { 13, 17, 230, 1, 16, 56, 5831 }, // e
-    { 20, 30, 148, -5, 23, 150, 5887 }, // f
-    { 20, 25, 260, -2, 18, 125, 6037 }, // g
-    { 16, 24, 280, 1, 23, 96, 6162 }, // h
-    { 8, 24, 142, 1, 23, 48, 6258 }, // i
-    { 14, 30, 136, -5, 23, 105, 6306 }, // j
-    { 17, 24, 266, 1, 23, 102, 6411 }, // k
-    { 7, 24, 142, 2, 23, 42, 6513 }, // l
-    { 25, 17, 418, 1, 16, 107, 6555 }, // m
-    { 16, 17, 280, 1, 16, 68, 6662 }, // n
-    { 15, 17, 268, 1, 16, 64, 6730 }, // o
-    { 17, 23, 269, -1, 16, 98, 6794 }, // p
-    { 15, 23, 261, 1, 16, 87, 6892 }, // q
-    { 13, 16, 218, 1, 16, 52, 6979 }, // r
-    { 13, 17, 217, 0, 16, 56, 7031 }, // s
-    { 9, 21, 172, 2, 20, 48, 7087 }, // t
-    { 16, 17, 280, 1, 16, 68, 7135 }, // u
-    { 15, 17, 251, 0, 16, 64, 7203 }, // v
-    { 23, 17, 382, 1, 16, 98, 7267 }, // w
-    { 18, 16, 255, -1, 16, 72, 7365 }, // x
-    { 20, 23, 246, -5, 16, 115, 7437 }, // y
-    { 15, 16, 239, -1, 16, 60, 7552 }, // z
-    { 14, 27, 200, 1, 23, 95, 7612 }, // {
-    { 3, 30, 261, 7, 23, 23, 7707 }, // |
-    { 13, 27, 200, -2, 23, 88, 7730 }, // }
-    { 14, 6, 261, 1, 13, 21, 7818 }, // ~
+    { 10, 8, 190, 3, 21, 20, 0 }, // "
+    { 17, 21, 261, 0, 21, 90, 20 }, // #
+    { 16, 26, 261, 0, 23, 104, 110 }, // $
+    { 24, 23, 418, 1, 22, 138, 214 }, // %
+    { 21, 23, 346, 1, 22, 121, 352 }, // &
+    { 5, 8, 103, 3, 21, 10, 473 }, // '
+    { 11, 27, 161, 1, 23, 75, 50 }, // (
+    { 12, 26, 161, -2, 22, 78, 125 }, // )
+    { 13, 13, 233, 3, 23, 43, 483 }, // *
+    { 14, 13, 261, 1, 17, 46, 526 }, // +
+    { 6, 9, 117, -1, 4, 14, 203 }, // ,
+    { 9, 4, 145, 0, 10, 9, 217 }, // -
+    { 5, 5, 117, 0, 4, 7, 226 }, // .
+    { 15, 27, 134, -3, 23, 102, 572 }, // /
+    { 15, 23, 261, 1, 22, 87, 233 }, // 0
+    { 13, 21, 214, -1, 21, 69, 320 }, // 1
+    { 16, 22, 261, -1, 22, 88, 389 }, // 2
+    { 17, 23, 261, -1, 22, 98, 477 }, // 3
+    { 17, 21, 261, -1, 21, 90, 575 }, // 4
+    { 16, 22, 261, 0, 21, 88, 665 }, // 5
+    { 16, 23, 261, 1, 22, 92, 753 }, // 6
+    { 15, 21, 261, 2, 21, 79, 845 }, // 7
+    { 16, 23, 261, 0, 22, 92, 924 }, // 8
+    { 15, 23, 261, 1, 22, 87, 1016 }, // 9
+    { 8, 17, 133, 0, 16, 34, 1103 }, // :
+    { 9, 21, 133, -1, 16, 48, 1137 }, // ;
+    { 14, 15, 261, 1, 18, 53, 674 }, // <
+    { 14, 9, 261, 1, 15, 32, 727 }, // =
+    { 14, 15, 261, 1, 18, 53, 759 }, // >
+    { 13, 23, 233, 3, 22, 75, 1185 }, // ?
+    { 25, 26, 430, 1, 21, 163, 812 }, // @
+    { 22, 21, 329, -2, 21, 116, 1260 }, // A
+    { 20, 21, 305, -1, 21, 105, 1376 }, // B
+    { 18, 23, 293, 1, 22, 104, 1481 }, // C
+    { 22, 21, 338, -1, 21, 116, 1585 }, // D
+    { 20, 21, 291, -1, 21, 105, 1701 }, // E
+    { 20, 21, 275, -1, 21, 105, 1806 }, // F
+    { 20, 23, 333, 1, 22, 115, 1911 }, // G
+    { 26, 21, 370, -1, 21, 137, 2026 }, // H
+    { 14, 21, 171, -1, 21, 74, 2163 }, // I
+    { 18, 28, 167, -5, 21, 126, 2237 }, // J
+    { 24, 21, 327, -1, 21, 126, 2363 }, // K
+    { 18, 21, 291, -1, 21, 95, 2489 }, // L
+    { 30, 21, 438, -1, 21, 158, 2584 }, // M
+    { 26, 21, 356, -1, 21, 137, 2742 }, // N
+    { 20, 23, 346, 1, 22, 115, 2879 }, // O
+    { 19, 21, 289, -1, 21, 100, 2994 }, // P
+    { 20, 29, 346, 1, 22, 145, 3094 }, // Q
+    { 20, 21, 310, -1, 21, 105, 3239 }, // R
+    { 17, 23, 254, 0, 22, 98, 3344 }, // S
+    { 18, 21, 286, 2, 21, 95, 3442 }, // T
+    { 22, 22, 341, 2, 21, 121, 975 }, // U
+    { 21, 21, 315, 2, 21, 111, 3537 }, // V
+    { 31, 21, 488, 2, 21, 163, 3648 }, // W
+    { 24, 21, 308, -2, 21, 126, 3811 }, // X
+    { 19, 21, 292, 2, 21, 100, 3937 }, // Y
+    { 20, 21, 282, -1, 21, 105, 4037 }, // Z
+    { 13, 27, 168, 0, 23, 88, 1096 }, // [
+    { 4, 27, 134, 3, 23, 27, 1184 }, // <backslash>
+    { 13, 27, 168, -2, 23, 88, 1211 }, // ]
+    { 14, 14, 261, 1, 21, 49, 1299 }, // ^
+    { 15, 3, 214, -3, -2, 12, 1348 }, // _
+    { 6, 6, 130, 4, 23, 9, 1360 }, // `
+    { 16, 17, 270, 1, 16, 68, 4142 }, // a
+    { 16, 24, 262, 0, 23, 96, 4210 }, // b
+    { 14, 17, 227, 1, 16, 60, 4306 }, // c
+    { 16, 24, 270, 1, 23, 96, 4366 }, // d
+    { 13, 17, 230, 1, 16, 56, 4462 }, // e
+    { 20, 30, 148, -5, 23, 150, 4518 }, // f
+    { 20, 25, 260, -2, 18, 125, 4668 }, // g
+    { 16, 24, 280, 1, 23, 96, 4793 }, // h
+    { 8, 24, 142, 1, 23, 48, 4889 }, // i
+    { 14, 30, 136, -5, 23, 105, 4937 }, // j
+    { 17, 24, 266, 1, 23, 102, 5042 }, // k
+    { 7, 24, 142, 2, 23, 42, 5144 }, // l
+    { 25, 17, 418, 1, 16, 107, 5186 }, // m
+    { 16, 17, 280, 1, 16, 68, 5293 }, // n
+    { 15, 17, 268, 1, 16, 64, 5361 }, // o
+    { 17, 23, 269, -1, 16, 98, 5425 }, // p
+    { 15, 23, 261, 1, 16, 87, 5523 }, // q
+    { 13, 16, 218, 1, 16, 52, 5610 }, // r
+    { 13, 17, 217, 0, 16, 56, 5662 }, // s
+    { 9, 21, 172, 2, 20, 48, 5718 }, // t
+    { 16, 17, 280, 1, 16, 68, 5766 }, // u
+    { 15, 17, 251, 0, 16, 64, 5834 }, // v
+    { 23, 17, 382, 1, 16, 98, 5898 }, // w
+    { 18, 16, 255, -1, 16, 72, 5996 }, // x
+    { 20, 23, 246, -5, 16, 115, 6068 }, // y
+    { 15, 16, 239, -1, 16, 60, 6183 }, // z
+    { 14, 27, 200, 1, 23, 95, 1369 }, // {
+    { 3, 30, 261, 7, 23, 23, 1464 }, // |
+    { 13, 27, 200, -2, 23, 88, 1487 }, // }
+    { 14, 6, 261, 1, 13, 21, 1575 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 8, 22, 155, 0, 16, 44, 0 }, // U+00A1
     { 14, 21, 261, 2, 21, 74, 44 }, // U+00A2
@@ -2581,19 +2588,19 @@ static const EpdGlyph notoserif_14_italicGlyphs[] = {
     { 15, 24, 268, 1, 23, 90, 7481 }, // U+00F0
     { 16, 23, 280, 1, 22, 92, 7571 }, // U+00F1
     { 15, 24, 268, 1, 23, 90, 7663 }, // U+00F2
-    { 15, 24, 268, 1, 23, 90, 7753 }, // U+00F3
-    { 15, 24, 268, 1, 23, 90, 7843 }, // U+00F4
-    { 16, 23, 268, 1, 22, 92, 7933 }, // U+00F5
-    { 15, 23, 268, 1, 22, 87, 8025 }, // U+00F6
-    { 14, 15, 261, 1, 18, 53, 8112 }, // U+00F7
-    { 17, 20, 268, 0, 18, 85, 8165 }, // U+00F8
-    { 16, 24, 280, 1, 23, 96, 8250 }, // U+00F9
-    { 16, 24, 280, 1, 23, 96, 8346 }, // U+00FA
-    { 16, 24, 280, 1, 23, 96, 8442 }, // U+00FB
-    { 16, 23, 280, 1, 22, 92, 8538 }, // U+00FC
-    { 20, 30, 246, -5, 23, 150, 8630 }, // U+00FD
-    { 17, 30, 262, -1, 23, 128, 8780 }, // U+00FE
-    { 20, 29, 246, -5, 22, 145, 8908 }, // U+00FF
+    { 15, 24, 268, 1, 23, 90, 6243 }, // U+00F3
+    { 15, 24, 268, 1, 23, 90, 7753 }, // U+00F4
+    { 16, 23, 268, 1, 22, 92, 7843 }, // U+00F5
+    { 15, 23, 268, 1, 22, 87, 7935 }, // U+00F6
+    { 14, 15, 261, 1, 18, 53, 8022 }, // U+00F7
+    { 17, 20, 268, 0, 18, 85, 8075 }, // U+00F8
+    { 16, 24, 280, 1, 23, 96, 8160 }, // U+00F9
+    { 16, 24, 280, 1, 23, 96, 8256 }, // U+00FA
+    { 16, 24, 280, 1, 23, 96, 8352 }, // U+00FB
+    { 16, 23, 280, 1, 22, 92, 8448 }, // U+00FC
+    { 20, 30, 246, -5, 23, 150, 8540 }, // U+00FD
+    { 17, 30, 262, -1, 23, 128, 8690 }, // U+00FE
+    { 20, 29, 246, -5, 22, 145, 8818 }, // U+00FF
     { 22, 25, 329, -2, 25, 138, 0 }, // U+0100
     { 16, 21, 270, 1, 20, 84, 138 }, // U+0101
     { 22, 27, 329, -2, 27, 149, 222 }, // U+0102
@@ -3295,98 +3302,98 @@ static const EpdGlyph notoserif_14_italicGlyphs[] = {
     { 9, 4, 145, 0, 10, 9, 162 }, // U+2010
     { 9, 4, 145, 0, 10, 9, 171 }, // U+2011
     { 15, 3, 261, 1, 12, 12, 180 }, // U+2012
-    { 16, 3, 233, -1, 9, 12, 192 }, // U+2013
-    { 31, 3, 467, -1, 9, 24, 204 }, // U+2014
-    { 31, 3, 467, -1, 9, 24, 228 }, // U+2015
-    { 8, 30, 261, 5, 23, 60, 252 }, // U+2016
-    { 14, 6, 192, -3, 0, 21, 312 }, // U+2017
-    { 6, 9, 117, 3, 21, 14, 333 }, // U+2018
-    { 6, 9, 117, 2, 21, 14, 347 }, // U+2019
-    { 6, 9, 117, -1, 4, 14, 361 }, // U+201A
-    { 6, 9, 117, 3, 21, 14, 375 }, // U+201B
-    { 12, 9, 210, 3, 21, 27, 389 }, // U+201C
-    { 12, 9, 210, 2, 21, 27, 416 }, // U+201D
-    { 12, 9, 210, -1, 4, 27, 443 }, // U+201E
-    { 11, 9, 210, 3, 21, 25, 470 }, // U+201F
-    { 12, 27, 209, 2, 23, 81, 495 }, // U+2020
-    { 16, 27, 209, -1, 23, 108, 576 }, // U+2021
-    { 9, 9, 169, 1, 15, 21, 684 }, // U+2022
-    { 10, 10, 233, 4, 15, 25, 705 }, // U+2023
-    { 5, 5, 133, 2, 13, 7, 730 }, // U+2024
-    { 13, 5, 250, 2, 13, 17, 737 }, // U+2025
-    { 21, 5, 400, 1, 4, 27, 754 }, // U+2026
-    { 5, 5, 117, 1, 10, 7, 781 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 788 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 788 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 788 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 832 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 876 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 926 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 976 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 1026 }, // U+202F
-    { 36, 23, 599, 1, 22, 207, 1026 }, // U+2030
-    { 47, 23, 780, 1, 22, 271, 1233 }, // U+2031
-    { 5, 8, 103, 3, 21, 10, 1504 }, // U+2032
-    { 11, 8, 190, 3, 21, 22, 1514 }, // U+2033
-    { 16, 8, 278, 3, 21, 32, 1536 }, // U+2034
-    { 5, 8, 103, 3, 21, 10, 1568 }, // U+2035
-    { 10, 8, 190, 3, 21, 20, 1578 }, // U+2036
-    { 16, 8, 278, 3, 21, 32, 1598 }, // U+2037
-    { 10, 9, 187, -1, 2, 23, 1630 }, // U+2038
-    { 8, 12, 155, 1, 14, 24, 1653 }, // U+2039
-    { 8, 12, 155, 0, 14, 24, 1677 }, // U+203A
-    { 22, 21, 382, 1, 21, 116, 1701 }, // U+203B
-    { 15, 22, 261, 1, 21, 83, 1817 }, // U+203C
-    { 13, 23, 233, 3, 22, 75, 1900 }, // U+203D
-    { 15, 2, 214, 2, 24, 8, 1975 }, // U+203E
-    { 23, 6, 0, -22, 0, 35, 1983 }, // U+203F
-    { 23, 6, 0, -17, 25, 35, 2018 }, // U+2040
-    { 14, 21, 210, -2, 21, 74, 2053 }, // U+2041
-    { 28, 24, 467, 0, 23, 168, 2127 }, // U+2042
-    { 9, 5, 169, 1, 13, 12, 2295 }, // U+2043
-    { 18, 21, 29, -8, 21, 95, 2307 }, // U+2044
-    { 13, 27, 168, 0, 23, 88, 2402 }, // U+2045
-    { 13, 27, 168, -2, 23, 88, 2490 }, // U+2046
-    { 27, 23, 456, 3, 22, 156, 2578 }, // U+2047
-    { 20, 23, 367, 3, 22, 115, 2734 }, // U+2048
-    { 23, 23, 364, 1, 22, 133, 2849 }, // U+2049
-    { 14, 23, 261, 1, 17, 81, 2982 }, // U+204A
-    { 17, 27, 288, 2, 23, 115, 3063 }, // U+204B
-    { 16, 11, 279, 1, 16, 44, 3178 }, // U+204C
-    { 16, 11, 279, 1, 16, 44, 3222 }, // U+204D
-    { 13, 13, 233, 1, 17, 43, 3266 }, // U+204E
-    { 6, 21, 133, 1, 16, 32, 3309 }, // U+204F
-    { 19, 23, 341, 2, 22, 110, 3341 }, // U+2050
-    { 16, 25, 233, 0, 23, 100, 3451 }, // U+2051
-    { 10, 22, 154, 0, 21, 55, 3551 }, // U+2052
-    { 14, 6, 261, 1, 13, 21, 3606 }, // U+2053
-    { 23, 7, 0, -6, 0, 41, 3627 }, // U+2054
-    { 13, 14, 252, 2, 17, 46, 3668 }, // U+2055
-    { 14, 17, 287, 1, 16, 60, 3714 }, // U+2056
-    { 22, 8, 366, 3, 21, 44, 3774 }, // U+2057
-    { 17, 17, 331, 1, 16, 73, 3818 }, // U+2058
-    { 17, 17, 331, 1, 16, 73, 3891 }, // U+2059
-    { 5, 23, 134, 2, 22, 29, 3964 }, // U+205A
-    { 17, 23, 331, 2, 22, 98, 3993 }, // U+205B
-    { 17, 16, 325, 1, 16, 68, 4091 }, // U+205C
-    { 5, 23, 134, 2, 22, 29, 4159 }, // U+205D
-    { 5, 23, 134, 2, 22, 29, 4188 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 4217 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2064
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2066
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2067
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2068
-    { 0, 0, 280, 0, 0, 0, 4217 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 4217 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4267 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4317 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4367 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4417 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 4467 }, // U+206F
+    { 16, 3, 233, -1, 9, 12, 6333 }, // U+2013
+    { 31, 3, 467, -1, 9, 24, 6345 }, // U+2014
+    { 31, 3, 467, -1, 9, 24, 192 }, // U+2015
+    { 8, 30, 261, 5, 23, 60, 216 }, // U+2016
+    { 14, 6, 192, -3, 0, 21, 276 }, // U+2017
+    { 6, 9, 117, 3, 21, 14, 297 }, // U+2018
+    { 6, 9, 117, 2, 21, 14, 6369 }, // U+2019
+    { 6, 9, 117, -1, 4, 14, 311 }, // U+201A
+    { 6, 9, 117, 3, 21, 14, 325 }, // U+201B
+    { 12, 9, 210, 3, 21, 27, 6383 }, // U+201C
+    { 12, 9, 210, 2, 21, 27, 6410 }, // U+201D
+    { 12, 9, 210, -1, 4, 27, 339 }, // U+201E
+    { 11, 9, 210, 3, 21, 25, 366 }, // U+201F
+    { 12, 27, 209, 2, 23, 81, 391 }, // U+2020
+    { 16, 27, 209, -1, 23, 108, 472 }, // U+2021
+    { 9, 9, 169, 1, 15, 21, 580 }, // U+2022
+    { 10, 10, 233, 4, 15, 25, 601 }, // U+2023
+    { 5, 5, 133, 2, 13, 7, 626 }, // U+2024
+    { 13, 5, 250, 2, 13, 17, 633 }, // U+2025
+    { 21, 5, 400, 1, 4, 27, 6437 }, // U+2026
+    { 5, 5, 117, 1, 10, 7, 650 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 657 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 657 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 657 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 701 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 745 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 795 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 845 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 895 }, // U+202F
+    { 36, 23, 599, 1, 22, 207, 895 }, // U+2030
+    { 47, 23, 780, 1, 22, 271, 1102 }, // U+2031
+    { 5, 8, 103, 3, 21, 10, 1373 }, // U+2032
+    { 11, 8, 190, 3, 21, 22, 1383 }, // U+2033
+    { 16, 8, 278, 3, 21, 32, 1405 }, // U+2034
+    { 5, 8, 103, 3, 21, 10, 1437 }, // U+2035
+    { 10, 8, 190, 3, 21, 20, 1447 }, // U+2036
+    { 16, 8, 278, 3, 21, 32, 1467 }, // U+2037
+    { 10, 9, 187, -1, 2, 23, 1499 }, // U+2038
+    { 8, 12, 155, 1, 14, 24, 1522 }, // U+2039
+    { 8, 12, 155, 0, 14, 24, 1546 }, // U+203A
+    { 22, 21, 382, 1, 21, 116, 1570 }, // U+203B
+    { 15, 22, 261, 1, 21, 83, 1686 }, // U+203C
+    { 13, 23, 233, 3, 22, 75, 1769 }, // U+203D
+    { 15, 2, 214, 2, 24, 8, 1844 }, // U+203E
+    { 23, 6, 0, -22, 0, 35, 1852 }, // U+203F
+    { 23, 6, 0, -17, 25, 35, 1887 }, // U+2040
+    { 14, 21, 210, -2, 21, 74, 1922 }, // U+2041
+    { 28, 24, 467, 0, 23, 168, 1996 }, // U+2042
+    { 9, 5, 169, 1, 13, 12, 2164 }, // U+2043
+    { 18, 21, 29, -8, 21, 95, 2176 }, // U+2044
+    { 13, 27, 168, 0, 23, 88, 2271 }, // U+2045
+    { 13, 27, 168, -2, 23, 88, 2359 }, // U+2046
+    { 27, 23, 456, 3, 22, 156, 2447 }, // U+2047
+    { 20, 23, 367, 3, 22, 115, 2603 }, // U+2048
+    { 23, 23, 364, 1, 22, 133, 2718 }, // U+2049
+    { 14, 23, 261, 1, 17, 81, 2851 }, // U+204A
+    { 17, 27, 288, 2, 23, 115, 2932 }, // U+204B
+    { 16, 11, 279, 1, 16, 44, 3047 }, // U+204C
+    { 16, 11, 279, 1, 16, 44, 3091 }, // U+204D
+    { 13, 13, 233, 1, 17, 43, 3135 }, // U+204E
+    { 6, 21, 133, 1, 16, 32, 3178 }, // U+204F
+    { 19, 23, 341, 2, 22, 110, 3210 }, // U+2050
+    { 16, 25, 233, 0, 23, 100, 3320 }, // U+2051
+    { 10, 22, 154, 0, 21, 55, 3420 }, // U+2052
+    { 14, 6, 261, 1, 13, 21, 3475 }, // U+2053
+    { 23, 7, 0, -6, 0, 41, 3496 }, // U+2054
+    { 13, 14, 252, 2, 17, 46, 3537 }, // U+2055
+    { 14, 17, 287, 1, 16, 60, 3583 }, // U+2056
+    { 22, 8, 366, 3, 21, 44, 3643 }, // U+2057
+    { 17, 17, 331, 1, 16, 73, 3687 }, // U+2058
+    { 17, 17, 331, 1, 16, 73, 3760 }, // U+2059
+    { 5, 23, 134, 2, 22, 29, 3833 }, // U+205A
+    { 17, 23, 331, 2, 22, 98, 3862 }, // U+205B
+    { 17, 16, 325, 1, 16, 68, 3960 }, // U+205C
+    { 5, 23, 134, 2, 22, 29, 4028 }, // U+205D
+    { 5, 23, 134, 2, 22, 29, 4057 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 4086 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2064
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2066
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2067
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2068
+    { 0, 0, 280, 0, 0, 0, 4086 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 4086 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 4136 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 4186 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4236 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4286 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4336 }, // U+206F
     { 11, 13, 187, 2, 24, 36, 0 }, // U+2070
     { 6, 14, 92, 2, 22, 21, 36 }, // U+2071
     { 12, 13, 187, 1, 24, 39, 57 }, // U+2074
@@ -3462,13 +3469,13 @@ static const EpdGlyph notoserif_14_italicGlyphs[] = {
     { 18, 24, 261, 0, 24, 108, 3487 }, // U+20BE
     { 18, 27, 261, -2, 24, 122, 3595 }, // U+20BF
     { 9, 4, 145, 0, 10, 9, 0 }, // U+2212
-    { 28, 30, 288, -5, 23, 210, 0 }, // U+FB00
-    { 22, 30, 277, -5, 23, 165, 210 }, // U+FB01
-    { 23, 30, 277, -5, 23, 173, 375 }, // U+FB02
-    { 31, 30, 416, -5, 23, 233, 548 }, // U+FB03
-    { 31, 30, 415, -5, 23, 233, 781 }, // U+FB04
-    { 25, 30, 307, -5, 23, 188, 1014 }, // U+FB05
-    { 25, 24, 388, 0, 23, 150, 1202 }, // U+FB06
+    { 28, 30, 288, -5, 23, 210, 6464 }, // U+FB00
+    { 22, 30, 277, -5, 23, 165, 6674 }, // U+FB01
+    { 23, 30, 277, -5, 23, 173, 6839 }, // U+FB02
+    { 31, 30, 416, -5, 23, 233, 7012 }, // U+FB03
+    { 31, 30, 415, -5, 23, 233, 7245 }, // U+FB04
+    { 25, 30, 307, -5, 23, 188, 0 }, // U+FB05
+    { 25, 24, 388, 0, 23, 150, 188 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -3476,8 +3483,7 @@ static const EpdUnicodeInterval notoserif_14_italicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3485,8 +3491,7 @@ static const EpdUnicodeInterval notoserif_14_italicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3496,19 +3501,57 @@ static const EpdUnicodeInterval notoserif_14_italicIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_14_italicGroups[] = {
-    { 0, 4083, 8477, 97, 0 },
-    { 4083, 3466, 9667, 96, 97 },
-    { 7549, 4512, 15915, 128, 193 },
-    { 12061, 4557, 13869, 96, 321 },
-    { 16618, 1339, 2038, 112, 417 },
-    { 17957, 11642, 32070, 256, 529 },
-    { 29599, 2425, 12458, 90, 785 },
-    { 32024, 2219, 4908, 111, 875 },
-    { 34243, 969, 1495, 42, 986 },
-    { 35212, 2317, 4004, 32, 1028 },
-    { 37529, 12, 12, 1, 1060 },
-    { 37541, 539, 1428, 7, 1061 },
-    { 38080, 132, 196, 1, 1068 },
+    { 0, 3665, 7961, 83, 2 },
+    { 3665, 950, 1800, 26, 0 },
+    { 4615, 3455, 9571, 95, 97 },
+    { 8070, 4512, 15915, 128, 193 },
+    { 12582, 4557, 13869, 96, 321 },
+    { 17139, 1339, 2038, 112, 417 },
+    { 18478, 11642, 32070, 256, 529 },
+    { 30120, 2425, 12458, 90, 785 },
+    { 32545, 2147, 4770, 105, 875 },
+    { 34692, 969, 1495, 42, 986 },
+    { 35661, 2317, 4004, 32, 1028 },
+    { 37978, 12, 12, 1, 1060 },
+    { 37990, 213, 378, 2, 1066 },
+    { 38203, 132, 196, 1, 1068 },
+};
+
+static const uint16_t notoserif_14_italicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_14_italicKernLeftClasses[] = {
@@ -4739,18 +4782,81 @@ static const EpdLigaturePair notoserif_14_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_14_italicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 0 }, { 0x0004, 1, 1 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 2 }, { 0x0009, 1, 1 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 3 }, { 0x000C, 4, 4 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 10 }, { 0x0024, 8, 11 }, { 0x0025, 9, 12 }, { 0x0026, 10, 11 }, { 0x0027, 11, 11 }, { 0x0028, 12, 11 }, { 0x0029, 13, 12 }, // U+0040
+    { 0x002A, 0, 11 }, { 0x002B, 0, 11 }, { 0x002C, 14, 11 }, { 0x002D, 15, 11 }, { 0x002E, 16, 11 }, { 0x002F, 0, 11 }, { 0x0030, 17, 11 }, { 0x0031, 10, 12 }, // U+0048
+    { 0x0032, 18, 11 }, { 0x0033, 10, 12 }, { 0x0034, 19, 11 }, { 0x0035, 20, 13 }, { 0x0036, 21, 14 }, { 0x0037, 22, 15 }, { 0x0038, 23, 16 }, { 0x0039, 24, 17 }, // U+0050
+    { 0x003A, 25, 18 }, { 0x003B, 26, 19 }, { 0x003C, 0, 20 }, { 0x003D, 3, 0 }, { 0x003E, 0, 21 }, { 0x003F, 0, 3 }, { 0x0040, 0, 0 }, { 0x0041, 27, 22 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 28, 23 }, { 0x0044, 29, 24 }, { 0x0045, 30, 25 }, { 0x0046, 0, 25 }, { 0x0047, 30, 25 }, { 0x0048, 31, 0 }, { 0x0049, 0, 26 }, // U+0060
+    { 0x004A, 28, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 32, 24 }, { 0x004E, 0, 28 }, { 0x004F, 28, 29 }, { 0x0050, 28, 29 }, { 0x0051, 29, 25 }, // U+0068
+    { 0x0052, 29, 29 }, { 0x0053, 33, 25 }, { 0x0054, 34, 29 }, { 0x0055, 35, 30 }, { 0x0056, 0, 31 }, { 0x0057, 0, 32 }, { 0x0058, 36, 33 }, { 0x0059, 37, 34 }, // U+0070
+    { 0x005A, 0, 35 }, { 0x005B, 38, 36 }, { 0x005C, 39, 37 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 3 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 40, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 38 }, { 0x006B, 0, 0 }, { 0x006C, 41, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 38 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 39 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 42, 0 }, // U+00B8
+    { 0x0081, 43, 10 }, { 0x0082, 43, 10 }, { 0x0083, 43, 10 }, { 0x0084, 43, 10 }, { 0x0085, 43, 10 }, { 0x0086, 43, 10 }, { 0x0087, 11, 40 }, { 0x0088, 9, 12 }, // U+00C0
+    { 0x0089, 11, 11 }, { 0x008A, 11, 11 }, { 0x008B, 11, 11 }, { 0x008C, 11, 11 }, { 0x008D, 0, 11 }, { 0x008E, 0, 11 }, { 0x008F, 0, 11 }, { 0x0090, 0, 11 }, // U+00C8
+    { 0x0091, 10, 11 }, { 0x0092, 17, 11 }, { 0x0093, 10, 12 }, { 0x0094, 10, 12 }, { 0x0095, 10, 12 }, { 0x0096, 10, 12 }, { 0x0097, 10, 12 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 12 }, { 0x009A, 22, 15 }, { 0x009B, 22, 15 }, { 0x009C, 22, 15 }, { 0x009D, 22, 15 }, { 0x009E, 26, 19 }, { 0x009F, 10, 11 }, { 0x00A0, 35, 0 }, // U+00D8
+    { 0x00A1, 28, 23 }, { 0x00A2, 28, 23 }, { 0x00A3, 28, 23 }, { 0x00A4, 28, 23 }, { 0x00A5, 28, 23 }, { 0x00A6, 28, 23 }, { 0x00A7, 30, 23 }, { 0x00A8, 30, 25 }, // U+00E0
+    { 0x00A9, 30, 25 }, { 0x00AA, 30, 25 }, { 0x00AB, 30, 25 }, { 0x00AC, 30, 25 }, { 0x00AD, 0, 27 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 27 }, { 0x00B0, 0, 27 }, // U+00E8
+    { 0x00B1, 29, 25 }, { 0x00B2, 28, 29 }, { 0x00B3, 29, 25 }, { 0x00B4, 29, 25 }, { 0x00B5, 29, 25 }, { 0x00B6, 29, 25 }, { 0x00B7, 29, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 29, 25 }, { 0x00BA, 28, 32 }, { 0x00BB, 28, 32 }, { 0x00BC, 28, 32 }, { 0x00BD, 28, 32 }, { 0x00BE, 38, 36 }, { 0x00BF, 29, 24 }, { 0x00C0, 38, 36 }, // U+00F8
+    { 0x00C1, 7, 10 }, { 0x00C2, 28, 23 }, { 0x00C3, 43, 10 }, { 0x00C4, 28, 23 }, { 0x00C5, 43, 10 }, { 0x00C6, 28, 23 }, { 0x00C7, 9, 12 }, { 0x00C8, 30, 25 }, // U+0100
+    { 0x00C9, 9, 12 }, { 0x00CA, 30, 25 }, { 0x00CB, 9, 12 }, { 0x00CC, 30, 25 }, { 0x00CD, 9, 12 }, { 0x00CE, 30, 25 }, { 0x00CF, 10, 11 }, { 0x00D0, 44, 25 }, // U+0108
+    { 0x00D1, 10, 11 }, { 0x00D2, 0, 25 }, { 0x00D3, 11, 11 }, { 0x00D4, 30, 25 }, { 0x00D5, 11, 11 }, { 0x00D6, 30, 25 }, { 0x00D7, 11, 11 }, { 0x00D8, 30, 25 }, // U+0110
+    { 0x00D9, 11, 11 }, { 0x00DA, 30, 25 }, { 0x00DB, 11, 11 }, { 0x00DC, 30, 25 }, { 0x00DD, 13, 12 }, { 0x00DE, 0, 25 }, { 0x00DF, 13, 12 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 13, 12 }, { 0x00E2, 0, 25 }, { 0x00E3, 13, 12 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 11 }, { 0x00E6, 28, 24 }, { 0x00E7, 0, 11 }, { 0x00E8, 28, 24 }, // U+0120
+    { 0x00E9, 0, 11 }, { 0x00EA, 0, 27 }, { 0x00EB, 0, 11 }, { 0x00EC, 0, 27 }, { 0x00ED, 0, 11 }, { 0x00EE, 0, 27 }, { 0x00EF, 0, 11 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 11 }, { 0x00F2, 0, 0 }, { 0x00F3, 14, 11 }, { 0x00F4, 0, 27 }, { 0x00F5, 14, 11 }, { 0x00F6, 0, 0 }, { 0x00F7, 15, 11 }, { 0x00F8, 32, 24 }, // U+0130
+    { 0x00F9, 32, 29 }, { 0x00FA, 16, 11 }, { 0x00FB, 0, 28 }, { 0x00FC, 16, 11 }, { 0x00FD, 0, 28 }, { 0x00FE, 45, 11 }, { 0x00FF, 44, 28 }, { 0x0100, 0, 11 }, // U+0138
+    { 0x0101, 0, 28 }, { 0x0102, 16, 11 }, { 0x0103, 0, 28 }, { 0x0104, 17, 11 }, { 0x0105, 28, 29 }, { 0x0106, 17, 11 }, { 0x0107, 28, 29 }, { 0x0108, 17, 11 }, // U+0140
+    { 0x0109, 28, 29 }, { 0x010A, 28, 41 }, { 0x010B, 14, 11 }, { 0x010C, 28, 29 }, { 0x010D, 10, 12 }, { 0x010E, 29, 25 }, { 0x010F, 10, 12 }, { 0x0110, 29, 25 }, // U+0148
+    { 0x0111, 10, 12 }, { 0x0112, 29, 25 }, { 0x0113, 11, 12 }, { 0x0114, 30, 25 }, { 0x0115, 19, 11 }, { 0x0116, 34, 29 }, { 0x0117, 19, 11 }, { 0x0118, 34, 29 }, // U+0150
+    { 0x0119, 19, 11 }, { 0x011A, 34, 29 }, { 0x011B, 20, 13 }, { 0x011C, 35, 30 }, { 0x011D, 20, 13 }, { 0x011E, 35, 30 }, { 0x011F, 20, 13 }, { 0x0120, 35, 30 }, // U+0158
+    { 0x0121, 20, 13 }, { 0x0122, 35, 30 }, { 0x0123, 21, 0 }, { 0x0124, 0, 31 }, { 0x0125, 21, 0 }, { 0x0126, 0, 31 }, { 0x0127, 21, 0 }, { 0x0128, 0, 31 }, // U+0160
+    { 0x0129, 22, 15 }, { 0x012A, 28, 32 }, { 0x012B, 22, 15 }, { 0x012C, 28, 32 }, { 0x012D, 22, 15 }, { 0x012E, 28, 32 }, { 0x012F, 22, 15 }, { 0x0130, 28, 32 }, // U+0168
+    { 0x0131, 22, 15 }, { 0x0132, 28, 32 }, { 0x0133, 22, 15 }, { 0x0134, 28, 32 }, { 0x0135, 24, 17 }, { 0x0136, 37, 34 }, { 0x0137, 26, 19 }, { 0x0138, 38, 36 }, // U+0170
+    { 0x0139, 26, 19 }, { 0x013A, 0, 20 }, { 0x013B, 39, 37 }, { 0x013C, 0, 20 }, { 0x013D, 39, 37 }, { 0x013E, 0, 20 }, { 0x013F, 39, 37 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 50, 42 }, { 0x0212, 50, 42 }, { 0x0213, 51, 43 }, { 0x0214, 52, 42 }, { 0x0215, 53, 44 }, { 0x0216, 54, 45 }, { 0x0217, 55, 42 }, { 0x0218, 55, 42 }, // U+0400
+    { 0x0219, 56, 46 }, { 0x021A, 57, 47 }, { 0x021B, 57, 42 }, { 0x021C, 58, 43 }, { 0x021D, 59, 42 }, { 0x021E, 55, 42 }, { 0x021F, 60, 48 }, { 0x0220, 55, 42 }, // U+0408
+    { 0x0221, 61, 49 }, { 0x0222, 62, 42 }, { 0x0223, 63, 42 }, { 0x0224, 52, 42 }, { 0x0225, 64, 50 }, { 0x0226, 50, 42 }, { 0x0227, 59, 51 }, { 0x0228, 63, 52 }, // U+0410
+    { 0x0229, 55, 42 }, { 0x022A, 55, 42 }, { 0x022B, 59, 42 }, { 0x022C, 55, 47 }, { 0x022D, 55, 42 }, { 0x022E, 55, 42 }, { 0x022F, 65, 44 }, { 0x0230, 55, 42 }, // U+0418
+    { 0x0231, 66, 42 }, { 0x0232, 53, 44 }, { 0x0233, 52, 43 }, { 0x0234, 60, 48 }, { 0x0235, 67, 53 }, { 0x0236, 68, 54 }, { 0x0237, 64, 42 }, { 0x0238, 55, 55 }, // U+0420
+    { 0x0239, 55, 42 }, { 0x023A, 64, 42 }, { 0x023B, 57, 43 }, { 0x023C, 55, 42 }, { 0x023D, 57, 42 }, { 0x023E, 65, 52 }, { 0x023F, 65, 42 }, { 0x0240, 55, 56 }, // U+0428
+    { 0x0241, 69, 57 }, { 0x0242, 70, 58 }, { 0x0243, 71, 57 }, { 0x0244, 72, 59 }, { 0x0245, 73, 60 }, { 0x0246, 74, 57 }, { 0x0247, 75, 61 }, { 0x0248, 71, 62 }, // U+0430
+    { 0x0249, 69, 63 }, { 0x024A, 69, 63 }, { 0x024B, 76, 64 }, { 0x024C, 69, 65 }, { 0x024D, 69, 65 }, { 0x024E, 69, 64 }, { 0x024F, 77, 57 }, { 0x0250, 78, 64 }, // U+0438
+    { 0x0251, 77, 66 }, { 0x0252, 79, 57 }, { 0x0253, 78, 64 }, { 0x0254, 80, 67 }, { 0x0255, 77, 57 }, { 0x0256, 76, 68 }, { 0x0257, 81, 63 }, { 0x0258, 69, 69 }, // U+0440
+    { 0x0259, 69, 63 }, { 0x025A, 81, 63 }, { 0x025B, 82, 70 }, { 0x025C, 69, 63 }, { 0x025D, 82, 63 }, { 0x025E, 77, 61 }, { 0x025F, 77, 64 }, { 0x0260, 69, 71 }, // U+0448
+    { 0x0261, 74, 57 }, { 0x0262, 74, 57 }, { 0x0263, 83, 72 }, { 0x0264, 72, 59 }, { 0x0265, 79, 57 }, { 0x0266, 84, 73 }, { 0x0267, 69, 74 }, { 0x0268, 85, 75 }, // U+0450
+    { 0x0269, 86, 76 }, { 0x026A, 82, 65 }, { 0x026B, 82, 64 }, { 0x026C, 78, 72 }, { 0x026D, 76, 64 }, { 0x026E, 69, 63 }, { 0x026F, 80, 67 }, { 0x0270, 69, 63 }, // U+0458
+};
+
 static const EpdFontData notoserif_14_italic = {
     notoserif_14_italicBitmaps,
     notoserif_14_italicGlyphs,
     notoserif_14_italicIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notoserif_14_italicGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_14_italicGlyphToGroup,
     notoserif_14_italicKernLeftClasses,
     notoserif_14_italicKernRightClasses,
     notoserif_14_italicKernMatrix,
@@ -4760,4 +4866,8 @@ static const EpdFontData notoserif_14_italic = {
     90,
     notoserif_14_italicLigaturePairs,
     5,
+    notoserif_14_italicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2069 +3,2074 @@
  * name: notoserif_14_regular
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_14_regular 14 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_14_regular 14 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_14_regularBitmaps[32902] = {
-    0xAD, 0x59, 0x3D, 0x8C, 0xE4, 0xF4, 0x15, 0x7F, 0xB6, 0x8F, 0xB5, 0x58, 0x4B, 0xE7, 0x2B, 0x40,
-    0x44, 0xF7, 0xB1, 0x4E, 0x41, 0x93, 0x63, 0x38, 0x37, 0x14, 0x87, 0x34, 0x3B, 0x36, 0xA1, 0x48,
-    0x91, 0x82, 0x14, 0xB7, 0xA4, 0x80, 0x88, 0x26, 0x91, 0x22, 0x84, 0xB2, 0x17, 0x69, 0x8B, 0x2B,
-    0x76, 0xC7, 0x0E, 0x14, 0x14, 0x29, 0xB8, 0x8A, 0x86, 0x82, 0x2B, 0x0E, 0xE9, 0x18, 0xA4, 0xEC,
-    0x16, 0x57, 0x50, 0xCC, 0x9C, 0x8D, 0xAE, 0xA0, 0xA0, 0x88, 0x01, 0xA1, 0x94, 0x58, 0xE1, 0x4E,
-    0x28, 0x5C, 0xC2, 0x19, 0xCE, 0x97, 0xF3, 0x0E, 0x33, 0xE3, 0xFC, 0x7E, 0xCF, 0x9E, 0xFD, 0xB8,
-    0xDC, 0x27, 0x62, 0xD6, 0xFF, 0xE7, 0x19, 0xFB, 0xFF, 0xF1, 0xFE, 0xEF, 0xE3, 0xF7, 0xDE, 0xFB,
-    0xEF, 0x68, 0x3A, 0x1A, 0x8D, 0x86, 0xEB, 0xF8, 0x74, 0xBB, 0xDD, 0x93, 0x27, 0x45, 0xFE, 0x38,
-    0x9B, 0x8D, 0xA4, 0xE7, 0xA4, 0xB8, 0x96, 0x71, 0xD9, 0x69, 0xD7, 0x8E, 0x3B, 0x16, 0xAE, 0x50,
-    0xF0, 0x71, 0x24, 0x97, 0x83, 0x6C, 0x46, 0x26, 0xC7, 0xCC, 0x54, 0x3A, 0x56, 0x2A, 0x5D, 0x2B,
-    0xF5, 0xEA, 0x7A, 0xB6, 0x78, 0x69, 0xF3, 0x5F, 0xB2, 0xE6, 0x88, 0x6C, 0xB1, 0xB9, 0x22, 0xC5,
-    0x41, 0x91, 0xFC, 0x98, 0x1C, 0x1F, 0x27, 0xE7, 0xA3, 0xBA, 0xAE, 0xCC, 0xB4, 0x2B, 0x56, 0x7A,
-    0x52, 0xAC, 0x98, 0x6D, 0x4D, 0xEC, 0x70, 0x0B, 0xD3, 0x15, 0x22, 0xCD, 0xBC, 0x4D, 0x8B, 0x2A,
-    0xB1, 0xEA, 0x44, 0xDC, 0xBF, 0x7A, 0xB1, 0xE7, 0xB8, 0xB1, 0xEF, 0x38, 0xA1, 0x8F, 0xE7, 0xDE,
-    0x27, 0x78, 0x5D, 0x8B, 0x98, 0x75, 0x8C, 0x3E, 0x25, 0x7E, 0xCC, 0xD0, 0xA2, 0x58, 0x1C, 0x37,
-    0xED, 0x38, 0x4E, 0xBA, 0xEE, 0xD8, 0xE9, 0x06, 0xEE, 0x81, 0x83, 0x71, 0xD7, 0x2F, 0x89, 0x91,
-    0x9C, 0xDD, 0x9D, 0x93, 0xCD, 0x90, 0xF6, 0x63, 0x63, 0x60, 0x21, 0xDE, 0x0B, 0xB1, 0x91, 0xCB,
-    0xB2, 0x95, 0x82, 0xFD, 0x75, 0x2B, 0xB7, 0x63, 0x19, 0x5A, 0x39, 0x58, 0x1E, 0x5A, 0xC5, 0x92,
-    0xD2, 0xAE, 0xD2, 0x33, 0xC2, 0xB7, 0xC5, 0xE1, 0xB0, 0x6B, 0x7D, 0x9A, 0x8F, 0x8B, 0x9E, 0x7D,
-    0xF9, 0x72, 0xBE, 0xEE, 0xBE, 0xFB, 0xAB, 0x37, 0xD3, 0x65, 0xB3, 0x72, 0x21, 0x23, 0x91, 0x25,
-    0x2C, 0x2A, 0xD2, 0x55, 0x7A, 0x46, 0x69, 0xC1, 0xE7, 0x46, 0x6E, 0x83, 0x62, 0xFE, 0xAC, 0x2B,
-    0x76, 0x6C, 0x16, 0x1F, 0x0A, 0x66, 0x4F, 0x72, 0x72, 0xF0, 0xC8, 0x9C, 0x15, 0xEC, 0x15, 0x3B,
-    0xDA, 0x5E, 0x85, 0x60, 0xB1, 0x78, 0x0A, 0xDE, 0x32, 0x1B, 0xD4, 0x49, 0x6D, 0xFD, 0xEE, 0x80,
-    0x5A, 0x85, 0x87, 0xB7, 0x66, 0xB5, 0xC1, 0xFE, 0x75, 0x6E, 0x9C, 0x02, 0x8D, 0xDD, 0xA9, 0x38,
-    0xD7, 0x33, 0x0C, 0xF0, 0x9F, 0x2F, 0xDD, 0x50, 0xFA, 0xC6, 0x14, 0x73, 0x4F, 0x24, 0x3A, 0x48,
-    0xEA, 0xFD, 0x87, 0xD4, 0x9E, 0x90, 0x1A, 0xA0, 0x23, 0x8C, 0x10, 0x09, 0xC4, 0xBA, 0x9E, 0x8A,
-    0x77, 0x75, 0xD5, 0x29, 0x21, 0xC3, 0xCA, 0xAC, 0xC3, 0x86, 0x8D, 0x5E, 0x6F, 0x79, 0xB9, 0xDB,
-    0xE9, 0x34, 0x92, 0xC1, 0x4F, 0x91, 0x12, 0xBC, 0x80, 0x05, 0x71, 0x63, 0xC1, 0xD2, 0x81, 0xEC,
-    0x5E, 0xFD, 0x3D, 0xD7, 0xCE, 0x43, 0x5F, 0xD8, 0x0D, 0xBC, 0xD8, 0x99, 0x98, 0xD0, 0xE5, 0x10,
-    0xBF, 0x5B, 0x69, 0x3F, 0xA3, 0x6F, 0xB1, 0x17, 0x3E, 0xAF, 0xF4, 0x55, 0x6F, 0xCF, 0x30, 0x3F,
-    0xBC, 0xFD, 0x6A, 0x5E, 0xA1, 0xCF, 0x86, 0x76, 0x56, 0x4E, 0xC0, 0xC6, 0xB2, 0xC8, 0xA1, 0x56,
-    0x62, 0xF8, 0x2A, 0xD0, 0xCC, 0xC9, 0xCE, 0x92, 0x24, 0x2F, 0x27, 0x72, 0xA4, 0x86, 0x25, 0x24,
-    0x18, 0x7B, 0x7D, 0x5B, 0x2E, 0x1D, 0x8D, 0xE4, 0x99, 0xCE, 0xA3, 0xFA, 0x5E, 0xFB, 0x2D, 0xCA,
-    0x7E, 0x0B, 0x40, 0x7B, 0xFC, 0x95, 0x95, 0x30, 0xA8, 0xEB, 0x8C, 0xF7, 0xDB, 0xDF, 0xB1, 0x2D,
-    0x86, 0x5E, 0xE6, 0xE5, 0x76, 0x6E, 0x64, 0x66, 0x6A, 0x87, 0xCB, 0xCD, 0xB2, 0x51, 0x1D, 0xE2,
-    0xC2, 0x97, 0xC3, 0x12, 0x84, 0xF8, 0x9B, 0xDB, 0x91, 0x8E, 0x80, 0xC8, 0x8F, 0x89, 0x74, 0x1A,
-    0xAE, 0x44, 0xD6, 0x60, 0xF8, 0x34, 0x2F, 0x38, 0x08, 0xFC, 0x03, 0xEE, 0x01, 0xF3, 0xB2, 0x62,
-    0x58, 0x3A, 0xFB, 0xBA, 0x77, 0xE9, 0xFE, 0x9B, 0xB9, 0x39, 0x40, 0x35, 0xDB, 0x97, 0xC4, 0xC9,
-    0xBC, 0xD0, 0x8D, 0x9D, 0xD4, 0x0F, 0xED, 0x0C, 0x6A, 0xCB, 0xD1, 0x0A, 0xB6, 0x7E, 0xD3, 0xCA,
-    0x3D, 0xAD, 0x08, 0x76, 0x5B, 0xCE, 0xFE, 0x1C, 0xE7, 0xA4, 0x6E, 0x68, 0xDD, 0x84, 0x8E, 0x92,
-    0xAA, 0x51, 0x84, 0x03, 0x97, 0x09, 0x52, 0x31, 0x6A, 0x18, 0xC0, 0xDF, 0x53, 0x89, 0xA0, 0xAC,
-    0xC7, 0x68, 0x6D, 0x0F, 0xDB, 0x3C, 0xB4, 0xE8, 0x8A, 0xF8, 0x35, 0x7D, 0x10, 0x53, 0xD7, 0x57,
-    0xC4, 0xBD, 0x3A, 0x83, 0xE2, 0x28, 0x14, 0x2F, 0xF6, 0xD1, 0xE9, 0xD1, 0xA6, 0x73, 0xAC, 0x46,
-    0x40, 0x4D, 0xCA, 0xBA, 0x50, 0x91, 0x62, 0x65, 0x0D, 0x1F, 0x4B, 0xED, 0x23, 0x88, 0x08, 0xA2,
-    0xA1, 0xC7, 0xE5, 0xBD, 0x95, 0xDF, 0x66, 0x54, 0x0A, 0x5B, 0x33, 0x6F, 0x29, 0xCE, 0xD5, 0x04,
-    0x33, 0x36, 0x73, 0xB2, 0x2D, 0xEC, 0xCC, 0x0B, 0xC3, 0xA1, 0x79, 0x3C, 0x95, 0xB7, 0xEE, 0x03,
-    0xED, 0x8B, 0x8B, 0x71, 0x76, 0x4E, 0x67, 0x61, 0xFB, 0x19, 0xBE, 0x77, 0x21, 0xC5, 0x1E, 0x18,
-    0xF6, 0xBF, 0x48, 0xC4, 0xA6, 0x91, 0x3C, 0xC6, 0x99, 0x39, 0x36, 0x12, 0xF5, 0x07, 0xEB, 0x3A,
-    0x86, 0xAC, 0x42, 0x21, 0x78, 0xD6, 0x41, 0x5B, 0x43, 0x2B, 0x7C, 0x68, 0xCC, 0x87, 0xB2, 0xB0,
-    0x22, 0xFA, 0x76, 0xD0, 0x36, 0x56, 0xA2, 0x95, 0xA4, 0xAE, 0xEB, 0xC7, 0x57, 0xA2, 0x53, 0xCD,
-    0x78, 0xB6, 0x20, 0x04, 0xBE, 0x64, 0xE2, 0xD6, 0x13, 0xB7, 0x9E, 0x09, 0xDB, 0xD2, 0xE0, 0x6F,
-    0x72, 0x14, 0x3A, 0x3E, 0x0A, 0xAF, 0xA2, 0x33, 0xCD, 0xDB, 0xF2, 0x1F, 0xD0, 0xBB, 0x2E, 0xE4,
-    0x49, 0x73, 0xDA, 0xAE, 0x0D, 0x33, 0xC7, 0xCE, 0xE6, 0xED, 0x10, 0xDA, 0x16, 0x8C, 0xBE, 0x92,
-    0x4B, 0x12, 0xBD, 0x03, 0xE7, 0xA5, 0x08, 0x4E, 0xB5, 0xF6, 0xE0, 0x63, 0xCC, 0xF6, 0x6A, 0x6C,
-    0xE5, 0xD4, 0xA9, 0x0D, 0xAD, 0x9A, 0xCD, 0xEA, 0x6D, 0xEB, 0x2F, 0x9E, 0x95, 0x7E, 0x32, 0x93,
-    0x28, 0xF5, 0xE3, 0x3E, 0xE4, 0xD3, 0xD7, 0x3D, 0xDB, 0xB0, 0x97, 0xA6, 0x61, 0x27, 0x73, 0x7B,
-    0x88, 0xAD, 0xED, 0x68, 0xC7, 0x1E, 0xB0, 0x9F, 0x0C, 0x2D, 0x1D, 0x0F, 0x36, 0x53, 0xF8, 0x57,
-    0x98, 0x41, 0x57, 0xA1, 0xCE, 0xBC, 0xDC, 0x2A, 0xA7, 0x6A, 0x74, 0x46, 0xB7, 0x85, 0x07, 0x4A,
-    0x83, 0x49, 0xBB, 0x6A, 0xBD, 0x43, 0x57, 0xD5, 0x5B, 0x42, 0xBD, 0x5D, 0x02, 0x1C, 0x78, 0xB0,
-    0x07, 0x17, 0xE8, 0x47, 0x34, 0x64, 0x73, 0x53, 0x0F, 0xDC, 0x3B, 0xE5, 0x06, 0xA0, 0x07, 0xF3,
-    0xA1, 0x9F, 0xFD, 0x75, 0x8D, 0x7E, 0x11, 0xFA, 0xB8, 0xF9, 0x08, 0x3A, 0x1B, 0xB6, 0x6D, 0x43,
-    0xED, 0x1D, 0x1C, 0x67, 0x7E, 0x08, 0x98, 0xDA, 0xC1, 0x4A, 0x03, 0x72, 0x71, 0xBE, 0x81, 0x7C,
-    0xE2, 0x1E, 0xF6, 0xEE, 0x87, 0xD8, 0x6F, 0xBC, 0x81, 0x79, 0x47, 0xE8, 0x8B, 0x96, 0x71, 0xEF,
-    0x58, 0x27, 0x0B, 0xE2, 0x20, 0x73, 0xEB, 0x1F, 0x32, 0xA3, 0xFE, 0x75, 0xB6, 0xC7, 0x78, 0x5B,
-    0xC6, 0x03, 0xE8, 0x64, 0x28, 0xFE, 0x8B, 0xE0, 0x93, 0x26, 0x0C, 0x39, 0xFF, 0x42, 0x12, 0xFC,
-    0xF5, 0xE5, 0xF6, 0xCF, 0xEE, 0xF3, 0xC5, 0xD0, 0x4F, 0xFD, 0xD4, 0x8B, 0x6F, 0xEF, 0xB1, 0x08,
-    0x97, 0x0A, 0x52, 0x17, 0xF1, 0xC3, 0x8A, 0x5D, 0xF9, 0x70, 0xE7, 0xB9, 0x89, 0x75, 0x7D, 0x38,
-    0x1B, 0x74, 0xE7, 0x65, 0xCD, 0x2D, 0x6F, 0xF4, 0x85, 0x9F, 0xFA, 0x5B, 0xFC, 0x8C, 0x88, 0xCE,
-    0x2F, 0x71, 0xE3, 0x18, 0x0D, 0x02, 0xD0, 0xFE, 0x8F, 0x0F, 0x06, 0xFB, 0x56, 0x7A, 0x7C, 0xA5,
-    0x05, 0x2C, 0xDC, 0x0F, 0xB5, 0x62, 0xE7, 0x28, 0x1D, 0x1E, 0xE0, 0x8B, 0xCD, 0x2F, 0x11, 0x6C,
-    0xCA, 0xC9, 0xF4, 0x01, 0x5F, 0xA0, 0x83, 0xD9, 0x2C, 0xAF, 0xFD, 0xE7, 0xD8, 0xB9, 0x00, 0xD9,
-    0x7B, 0x5F, 0x0C, 0x29, 0x3F, 0x78, 0xA6, 0x17, 0x1E, 0x53, 0xB9, 0xB8, 0xAD, 0x2D, 0xC2, 0xA6,
-    0xB9, 0x5F, 0x46, 0x0C, 0x32, 0x7C, 0x62, 0x8F, 0x11, 0x77, 0xF6, 0x09, 0x06, 0xFA, 0x6B, 0xDB,
-    0x8E, 0xD8, 0x16, 0x18, 0x6C, 0xC1, 0xC6, 0x37, 0x35, 0x71, 0xB1, 0x54, 0x5E, 0x38, 0x67, 0xA9,
-    0xAE, 0x0A, 0xAC, 0x33, 0x4A, 0x08, 0x7B, 0x09, 0xBA, 0x75, 0xEA, 0xCA, 0x85, 0x3D, 0x05, 0x46,
-    0xE9, 0xC0, 0xF2, 0x86, 0x46, 0xE1, 0x84, 0x9E, 0x51, 0x9A, 0x85, 0x1D, 0x9E, 0x30, 0x0B, 0xDE,
-    0x96, 0xAD, 0x1C, 0xBD, 0x84, 0xB7, 0xCC, 0x91, 0x2E, 0x03, 0xA2, 0xCB, 0x9B, 0x93, 0x1E, 0x43,
-    0x9A, 0x81, 0x20, 0xD9, 0xC5, 0xBB, 0xE2, 0x44, 0x76, 0x11, 0x5B, 0xA8, 0x0B, 0x58, 0x85, 0x2F,
-    0x87, 0xE3, 0xE3, 0x8A, 0xAD, 0x9A, 0x45, 0xA4, 0x7A, 0xA3, 0xD5, 0xD2, 0x72, 0x20, 0x85, 0x3F,
-    0x51, 0x62, 0x57, 0x5F, 0x62, 0x96, 0x61, 0xC2, 0x51, 0xF7, 0x7C, 0x4E, 0x34, 0xA0, 0xAB, 0x34,
-    0xD1, 0xDC, 0xE6, 0x3A, 0x65, 0x6F, 0x7C, 0xC9, 0x39, 0xAC, 0x8F, 0xA9, 0x17, 0xEB, 0x0D, 0x8E,
-    0x73, 0x9E, 0x27, 0x75, 0x0D, 0x8A, 0xFA, 0x20, 0xA2, 0x2A, 0x25, 0x32, 0xD2, 0x7D, 0x51, 0x02,
-    0x80, 0x08, 0x51, 0xA7, 0x0A, 0x89, 0xFA, 0xD8, 0x36, 0x80, 0xDF, 0x55, 0xE0, 0x87, 0x18, 0x80,
-    0xFD, 0x00, 0x25, 0x47, 0x29, 0xF4, 0xE1, 0x4C, 0xA5, 0x46, 0x9C, 0xAE, 0xE3, 0xA4, 0xDE, 0x16,
-    0x59, 0x1D, 0x23, 0x1F, 0xB0, 0x0B, 0xA8, 0x0C, 0x6F, 0x27, 0x24, 0x53, 0x92, 0xD1, 0xCE, 0x37,
-    0x3E, 0x33, 0x11, 0x05, 0xC7, 0x09, 0x26, 0xA8, 0xEB, 0xB3, 0xF8, 0x69, 0x68, 0x67, 0x42, 0x3F,
-    0x43, 0xFA, 0x9C, 0x84, 0xFB, 0x7E, 0x4E, 0xC5, 0xBB, 0xF9, 0x52, 0x25, 0x75, 0x8B, 0xD3, 0x4C,
-    0x9C, 0x72, 0x89, 0xDE, 0x9E, 0x62, 0xAA, 0x04, 0x30, 0x19, 0x80, 0xBB, 0xA7, 0xE7, 0x2A, 0x9F,
-    0x83, 0x49, 0xB4, 0xA7, 0xCD, 0x9F, 0xF1, 0x3D, 0x8D, 0x8D, 0x2E, 0xE4, 0x14, 0xB2, 0x60, 0x4D,
-    0x20, 0xB3, 0xFA, 0x1A, 0x51, 0x2A, 0x27, 0xA2, 0x26, 0xF5, 0x38, 0xC4, 0x26, 0x36, 0xE1, 0xCE,
-    0x85, 0x31, 0xD3, 0xE5, 0x63, 0x10, 0xF8, 0x04, 0xB6, 0x9C, 0x83, 0x58, 0x05, 0x49, 0x39, 0x27,
-    0x66, 0xB5, 0x8F, 0xEC, 0xBE, 0xD0, 0x7E, 0x3A, 0xC2, 0xCD, 0x40, 0x7C, 0xCE, 0x02, 0xFC, 0xBF,
-    0xB9, 0xDA, 0x6E, 0x02, 0xC2, 0xAD, 0x56, 0xC7, 0x83, 0x89, 0x5D, 0x20, 0x1B, 0x2B, 0x60, 0x07,
-    0x05, 0xD2, 0xCE, 0x42, 0x0E, 0x34, 0x78, 0xDF, 0xB6, 0xF1, 0x20, 0x86, 0x8C, 0xE2, 0x7D, 0xCF,
-    0x76, 0x9B, 0xC3, 0xC9, 0xA9, 0x04, 0xEF, 0xA6, 0x02, 0x7A, 0xFD, 0x40, 0x73, 0xB2, 0x01, 0x29,
-    0xAD, 0x9B, 0x2B, 0xE1, 0x5D, 0xE6, 0xD5, 0xE6, 0x41, 0x99, 0xE8, 0xB6, 0xE3, 0x67, 0xF8, 0x19,
-    0xBD, 0x97, 0xC4, 0xD0, 0x95, 0x97, 0xDA, 0x4C, 0xA6, 0x98, 0x1E, 0xC5, 0x8A, 0x21, 0x94, 0xA9,
-    0x0A, 0xB7, 0x21, 0xD1, 0x5E, 0x32, 0xB8, 0x10, 0x10, 0xA4, 0x03, 0x06, 0xB4, 0x80, 0x39, 0x15,
-    0x84, 0xEF, 0x72, 0xAC, 0x9B, 0x3A, 0x00, 0xEA, 0x14, 0x86, 0x82, 0x1F, 0xC9, 0x7B, 0xAB, 0x30,
-    0x2D, 0x35, 0xE5, 0x47, 0x68, 0x77, 0x48, 0x4E, 0xD2, 0xD5, 0xA9, 0x1C, 0x99, 0x85, 0x36, 0xC5,
-    0x49, 0x86, 0xCC, 0xFB, 0xD2, 0xF1, 0xE0, 0x83, 0x92, 0x5B, 0xAB, 0x1F, 0xB0, 0xFF, 0x9C, 0x62,
-    0x7E, 0x6C, 0xF6, 0x08, 0xCC, 0xB8, 0x8E, 0xB1, 0x2E, 0x56, 0xC7, 0xD2, 0x5C, 0xF7, 0x21, 0x2F,
-    0x4C, 0x82, 0x19, 0x9C, 0xBA, 0x5C, 0x80, 0x0B, 0x47, 0xB2, 0x2F, 0xCD, 0x7C, 0xD8, 0xAB, 0xAF,
-    0x39, 0xEE, 0x44, 0x8E, 0xC0, 0x2F, 0x42, 0x0A, 0xA4, 0x2E, 0xC1, 0x54, 0x94, 0x83, 0x2D, 0x9F,
-    0x6B, 0x75, 0x49, 0xC8, 0x3D, 0xA0, 0xD9, 0x02, 0xE0, 0x88, 0xA6, 0xF8, 0x9A, 0xDB, 0x5B, 0xDF,
-    0xC1, 0x9B, 0xAD, 0x1B, 0x33, 0xAA, 0x19, 0x10, 0x60, 0x4D, 0x90, 0x26, 0x59, 0x85, 0x9B, 0x83,
-    0xD8, 0x3A, 0x42, 0xBD, 0xB2, 0x26, 0x89, 0x68, 0x59, 0x7E, 0x06, 0xC6, 0x9D, 0x0A, 0xAC, 0x1B,
-    0x30, 0x20, 0x18, 0x3F, 0x00, 0xC6, 0xBE, 0x87, 0x61, 0xDC, 0xA5, 0x19, 0x7B, 0x0C, 0x72, 0xBF,
-    0x51, 0x82, 0x1D, 0x1B, 0xEA, 0x9C, 0xB0, 0xBE, 0x09, 0x59, 0xA9, 0xB8, 0xF0, 0x77, 0x60, 0xED,
-    0x12, 0xB8, 0xD9, 0x0C, 0x65, 0x19, 0xB7, 0xB7, 0x62, 0x79, 0x96, 0xB7, 0x54, 0xFE, 0x8C, 0xDB,
-    0x9B, 0x99, 0x7C, 0x57, 0x2A, 0x4E, 0x7D, 0xAA, 0x37, 0xF3, 0x23, 0xDC, 0xFE, 0x52, 0x59, 0xBC,
-    0xC5, 0x13, 0xFB, 0x39, 0xDE, 0x86, 0x8E, 0xC1, 0x5B, 0xFF, 0xA0, 0xDE, 0x82, 0x63, 0x7A, 0xF3,
-    0x5F, 0xD3, 0x9B, 0x5B, 0x35, 0xB7, 0x52, 0x6F, 0x36, 0xF1, 0xC5, 0xCB, 0x50, 0x0F, 0x11, 0xA8,
-    0xAC, 0xD4, 0x47, 0xA6, 0x90, 0x23, 0xE1, 0x0B, 0x57, 0x4B, 0x39, 0xB2, 0xCD, 0xA2, 0xC2, 0x80,
-    0xFA, 0x66, 0x04, 0x3A, 0x0B, 0xDB, 0x07, 0x7D, 0x37, 0x25, 0x7D, 0x2B, 0x27, 0x05, 0x13, 0xA0,
-    0xAF, 0x4F, 0x48, 0xE3, 0xA9, 0xD2, 0x40, 0xA9, 0x9F, 0x92, 0xBA, 0x59, 0xAE, 0x4B, 0x90, 0x9A,
-    0x15, 0xA9, 0x4C, 0x95, 0x46, 0x4A, 0xFD, 0x9C, 0x98, 0x09, 0xD9, 0x7B, 0x57, 0x98, 0xCC, 0xD5,
-    0x53, 0x31, 0xF3, 0xD6, 0xA3, 0x8E, 0x68, 0xD6, 0xF0, 0xF6, 0x94, 0xE6, 0xE7, 0x87, 0x4E, 0xD6,
-    0x78, 0x05, 0x32, 0x5E, 0xE2, 0x2A, 0x3C, 0xC5, 0x2C, 0x61, 0x06, 0x06, 0x1D, 0xC7, 0x98, 0x44,
-    0x77, 0x20, 0xF3, 0xB7, 0x66, 0xE5, 0x53, 0xFB, 0x1C, 0x5B, 0x60, 0x16, 0x27, 0xD5, 0xF9, 0x64,
-    0xB6, 0xC2, 0x68, 0xC9, 0x35, 0x98, 0x26, 0x12, 0x9A, 0x81, 0xCC, 0x99, 0x5D, 0x28, 0x36, 0x4D,
-    0x08, 0xA8, 0x44, 0xE5, 0x3D, 0x8D, 0xCF, 0x2A, 0x82, 0x96, 0x75, 0x73, 0x33, 0xB5, 0xD0, 0xFF,
-    0xC1, 0x80, 0xE1, 0x27, 0xDB, 0x46, 0x79, 0xBF, 0x6D, 0x24, 0x3B, 0xB0, 0xA2, 0x28, 0x43, 0x10,
-    0xA7, 0x64, 0x31, 0x74, 0xA6, 0x85, 0x4C, 0xD8, 0xC6, 0x9F, 0xCD, 0x8C, 0xF1, 0xA7, 0xBC, 0x43,
-    0xFC, 0x19, 0xED, 0x3C, 0xAB, 0x5A, 0x18, 0x1F, 0x6F, 0x32, 0x08, 0x4D, 0xB9, 0xB1, 0x88, 0x44,
-    0xB9, 0x76, 0xD5, 0xA5, 0x14, 0xC1, 0xD9, 0xCF, 0xD0, 0x11, 0x09, 0xF7, 0x1D, 0x64, 0x74, 0xF0,
-    0x72, 0x37, 0x31, 0x4C, 0xE0, 0x8D, 0x7E, 0x88, 0x84, 0x2F, 0x5E, 0x46, 0xB4, 0xEE, 0xCF, 0x63,
-    0x0C, 0xD3, 0x8F, 0x92, 0x56, 0x1F, 0x6A, 0xE2, 0x2F, 0xDE, 0x8C, 0xD9, 0x5E, 0xA8, 0x49, 0x14,
-    0x70, 0xF0, 0x49, 0x24, 0xB1, 0x67, 0xD0, 0x86, 0xD8, 0x26, 0x93, 0xBE, 0x20, 0x46, 0x81, 0xD4,
-    0x26, 0xF4, 0x48, 0x8C, 0xEA, 0x34, 0xFA, 0x60, 0xB6, 0x99, 0xAE, 0x9B, 0xA5, 0x95, 0xAE, 0x99,
-    0xA5, 0x91, 0x9E, 0x06, 0xC9, 0x0E, 0x61, 0x4B, 0x14, 0x27, 0x37, 0xFC, 0x23, 0x09, 0x63, 0xFD,
-    0x13, 0x53, 0x0D, 0xEC, 0x00, 0xA8, 0x1A, 0x9E, 0x10, 0x7A, 0xB3, 0xF0, 0x89, 0x6D, 0xEA, 0x4E,
-    0x14, 0xC2, 0x68, 0xD9, 0x3F, 0x11, 0xC5, 0x92, 0x06, 0x0A, 0xC6, 0x4A, 0x93, 0xC7, 0x99, 0x26,
-    0x31, 0xC1, 0xD5, 0x44, 0x03, 0x77, 0xA5, 0x59, 0x20, 0x6B, 0x96, 0x5A, 0xA2, 0xD9, 0x2A, 0xB0,
-    0x77, 0x1B, 0xB1, 0xC0, 0xCA, 0x6C, 0x7A, 0x0B, 0xD5, 0x12, 0x63, 0xB0, 0x13, 0x62, 0xAC, 0x1E,
-    0x01, 0x2C, 0x11, 0x0B, 0x3B, 0xC4, 0xC4, 0x2E, 0xE5, 0x7B, 0x86, 0xF5, 0xC6, 0x16, 0x23, 0x38,
-    0xD6, 0x71, 0x3F, 0x62, 0x0D, 0xF6, 0x19, 0x0F, 0x15, 0xBE, 0x22, 0xB9, 0x05, 0x21, 0x1B, 0x3F,
-    0x70, 0x7E, 0x4D, 0x8B, 0xB8, 0x59, 0xA6, 0xF4, 0x49, 0x2D, 0x66, 0x6C, 0xD6, 0x05, 0xD6, 0x72,
-    0x52, 0x23, 0x82, 0x1F, 0xB0, 0xBE, 0xF2, 0xC8, 0x2A, 0x4C, 0x68, 0x49, 0x43, 0x40, 0x21, 0x4F,
-    0x53, 0x44, 0x27, 0x4A, 0x2E, 0x33, 0x91, 0x67, 0x2B, 0x16, 0xB3, 0x13, 0x59, 0x9B, 0xB0, 0xA2,
-    0x1D, 0xC9, 0xD6, 0x90, 0x65, 0x6D, 0x5F, 0x90, 0xCE, 0x17, 0x64, 0x23, 0xEF, 0x19, 0xCC, 0x81,
-    0x9F, 0xCB, 0x02, 0x6E, 0xD0, 0x7B, 0x3D, 0xF5, 0x9F, 0xA7, 0x72, 0x2F, 0xA7, 0xEE, 0x1B, 0x4C,
-    0x2F, 0x2E, 0xC7, 0xEE, 0xC7, 0xCC, 0x60, 0xFF, 0x21, 0xCE, 0x27, 0x4C, 0x20, 0xAF, 0x89, 0xFD,
-    0x25, 0x93, 0x2F, 0xA4, 0x14, 0xDF, 0x52, 0x17, 0xB0, 0x4A, 0x32, 0x67, 0x34, 0xE7, 0x19, 0x5C,
-    0x88, 0x65, 0x47, 0x44, 0xA0, 0x87, 0xB5, 0x44, 0x19, 0xF2, 0x12, 0x8F, 0x4F, 0xBB, 0x34, 0xFC,
-    0x35, 0xC6, 0x58, 0xBA, 0xDE, 0x65, 0x66, 0x2D, 0x5F, 0x87, 0x3A, 0x8F, 0xB4, 0x23, 0x75, 0xA3,
-    0x4C, 0x52, 0x2D, 0xA6, 0x7A, 0xCE, 0x0B, 0xE0, 0x66, 0x89, 0xF8, 0xDD, 0xA5, 0xBE, 0x2F, 0xF2,
-    0xC0, 0x04, 0x89, 0x12, 0x61, 0x28, 0x88, 0x81, 0x42, 0x51, 0x0E, 0x0C, 0xAC, 0x27, 0x01, 0xD2,
-    0xB5, 0xA9, 0x37, 0x0D, 0x5F, 0xA9, 0x68, 0xE3, 0x19, 0x66, 0xB2, 0x81, 0x5C, 0x94, 0x77, 0x40,
-    0x79, 0xFB, 0x61, 0x97, 0x02, 0x5E, 0x63, 0x09, 0x4A, 0xB7, 0xFF, 0x3E, 0xA5, 0x58, 0xE3, 0x76,
-    0xA1, 0x26, 0x49, 0xBE, 0x2B, 0x89, 0xB4, 0xB6, 0x39, 0x4B, 0xBF, 0xAD, 0x68, 0xCF, 0x65, 0x84,
-    0xC0, 0xBC, 0x8E, 0x6C, 0x6B, 0x0D, 0x42, 0x3F, 0x0D, 0xC7, 0x3D, 0xA4, 0x5D, 0xB0, 0x7D, 0x93,
-    0x91, 0x8A, 0xE7, 0x5E, 0x79, 0x53, 0x88, 0x33, 0x91, 0x48, 0xDA, 0x57, 0x55, 0x13, 0x85, 0xA0,
-    0xA6, 0x0E, 0xBC, 0xA6, 0xC3, 0xE3, 0xA8, 0x7A, 0xE5, 0xC5, 0x09, 0xDC, 0x03, 0x83, 0x82, 0x29,
-    0xCB, 0xF3, 0x87, 0xF8, 0xBB, 0x72, 0xFC, 0xFD, 0xA6, 0x40, 0xDF, 0xD2, 0x03, 0x8A, 0x93, 0x7A,
-    0x58, 0xD1, 0xD1, 0x83, 0x8B, 0x83, 0x7A, 0xE6, 0x61, 0x83, 0x93, 0x90, 0x90, 0x6D, 0xA6, 0x4C,
-    0x76, 0x61, 0xC0, 0x77, 0xED, 0xED, 0xEA, 0x00, 0x93, 0xC2, 0x80, 0xF4, 0x8C, 0x87, 0xF8, 0x7B,
-    0xA9, 0x1A, 0x9C, 0x97, 0x05, 0xE2, 0x56, 0x5B, 0x30, 0xF7, 0xB0, 0xE9, 0x35, 0x2E, 0xB5, 0x85,
-    0x45, 0x4F, 0x42, 0x49, 0x3C, 0x57, 0x5B, 0xC2, 0x0A, 0x2E, 0x16, 0xB2, 0xE3, 0x8E, 0x3E, 0x31,
-    0xF5, 0x04, 0x01, 0x55, 0xD4, 0x79, 0x08, 0x53, 0x7D, 0xE7, 0x14, 0x04, 0xED, 0x85, 0x76, 0x0A,
-    0xCD, 0x1E, 0x32, 0x10, 0xCC, 0xDC, 0x31, 0xAB, 0x48, 0xD4, 0x8A, 0xA8, 0xF2, 0x17, 0xB4, 0x2A,
-    0xE4, 0x01, 0x9B, 0x1F, 0x1A, 0x88, 0xE7, 0xDE, 0x15, 0x9F, 0x27, 0x19, 0xE1, 0x06, 0xDA, 0x08,
-    0xCF, 0x36, 0x20, 0xE5, 0x3E, 0x6A, 0x83, 0xE0, 0xDA, 0x5B, 0x99, 0x33, 0x73, 0x8B, 0xDD, 0x93,
-    0x1A, 0x16, 0x04, 0x14, 0xB9, 0x3A, 0xF0, 0xFF, 0x13, 0xE6, 0xEB, 0x37, 0x98, 0x5B, 0xCD, 0x88,
-    0x88, 0x15, 0xF3, 0xF5, 0xB2, 0xC9, 0xCD, 0xFD, 0x5D, 0x12, 0xEE, 0x27, 0x6D, 0x97, 0x0A, 0x85,
-    0x0D, 0xCC, 0x1D, 0x09, 0xDD, 0xB5, 0x6B, 0x95, 0x44, 0x9F, 0xEA, 0x99, 0xC8, 0x01, 0xAE, 0x09,
-    0x8F, 0x1F, 0xCF, 0x60, 0x69, 0xAC, 0xDF, 0x7C, 0x74, 0x3D, 0xA6, 0xE7, 0x2B, 0x1B, 0xB7, 0xB5,
-    0x5E, 0x0B, 0xAC, 0xD8, 0x11, 0xFA, 0xDA, 0x62, 0xCF, 0x12, 0x58, 0x58, 0xB5, 0xE7, 0xD4, 0x51,
-    0x12, 0x2D, 0x6A, 0xEE, 0xC2, 0x7D, 0x82, 0x28, 0x6E, 0xD7, 0x37, 0xE8, 0xF4, 0x3E, 0x59, 0x73,
-    0x59, 0x54, 0x60, 0xAB, 0xBD, 0x9D, 0xBA, 0x63, 0x63, 0x3F, 0xE9, 0x35, 0x75, 0x87, 0x4D, 0x82,
-    0x49, 0xBD, 0x18, 0xE8, 0xE0, 0x8C, 0xFF, 0xBB, 0x8D, 0x72, 0xEB, 0x33, 0xE0, 0xF8, 0x01, 0x99,
-    0xF3, 0x3E, 0x69, 0x79, 0x57, 0xE9, 0xB3, 0xF2, 0x27, 0xA0, 0xA7, 0x11, 0x30, 0xBC, 0x8F, 0xEA,
-    0xB6, 0xBF, 0x8F, 0x77, 0x7A, 0x94, 0x1D, 0xDA, 0xE3, 0x64, 0xF7, 0x14, 0x8B, 0x47, 0x9F, 0x40,
-    0x61, 0x19, 0x22, 0xEE, 0x55, 0x40, 0x3C, 0xF8, 0xC2, 0xBC, 0x3D, 0x35, 0x3E, 0x2F, 0x4F, 0xCD,
-    0xCE, 0xCB, 0xDE, 0x67, 0xF7, 0x6B, 0x84, 0x79, 0x64, 0x39, 0x7A, 0x3A, 0x83, 0xCF, 0xEF, 0x65,
-    0xF5, 0x9F, 0x13, 0x73, 0x9C, 0x0C, 0xED, 0xCC, 0x3F, 0x80, 0xB8, 0x1C, 0xA2, 0xC5, 0xFA, 0x97,
-    0xF2, 0x0C, 0xC5, 0x0B, 0x79, 0x2E, 0x01, 0x23, 0x16, 0xE3, 0xAA, 0x9A, 0x3E, 0x31, 0x00, 0xE1,
-    0x70, 0x0C, 0xD9, 0xD6, 0x99, 0x5D, 0xD7, 0x85, 0x8F, 0x59, 0x61, 0xF9, 0x70, 0x5E, 0x6D, 0x05,
-    0xC4, 0x92, 0x7B, 0x57, 0x37, 0x63, 0xB3, 0x31, 0xC3, 0x07, 0xB3, 0x99, 0x5B, 0x35, 0xD3, 0x2B,
-    0x53, 0x6D, 0x66, 0xB2, 0x13, 0x86, 0x37, 0x1E, 0x98, 0x20, 0x47, 0x8B, 0x78, 0x58, 0x19, 0x69,
-    0xAC, 0x9F, 0x97, 0x03, 0x12, 0xB6, 0x8A, 0x3F, 0x7E, 0x4E, 0x7C, 0x8D, 0x5D, 0xE6, 0xBD, 0xAF,
-    0x92, 0xA1, 0x2F, 0xD2, 0xBC, 0x85, 0x7C, 0x4C, 0x9A, 0x23, 0x84, 0xC5, 0x0B, 0xCE, 0x44, 0xEE,
-    0xF7, 0x57, 0xB1, 0x9A, 0xF7, 0xB2, 0xFE, 0x83, 0xED, 0xF9, 0xF0, 0x80, 0xE9, 0x03, 0x4B, 0x47,
-    0x8B, 0xB1, 0x50, 0xEB, 0x64, 0xCD, 0xCD, 0xD7, 0x49, 0x88, 0xA6, 0x37, 0x78, 0x76, 0x48, 0x18,
-    0xB3, 0xAA, 0x3D, 0x59, 0x07, 0x33, 0x1F, 0xBB, 0xCD, 0x3A, 0xB0, 0xE7, 0x19, 0xF7, 0xCC, 0x7C,
-    0x81, 0xA6, 0xFD, 0x23, 0xAA, 0x91, 0xE6, 0xC2, 0x44, 0x49, 0x1D, 0x1F, 0x3F, 0x9B, 0xC4, 0x48,
-    0x45, 0xFD, 0x1B, 0x75, 0x81, 0x65, 0xAD, 0xB1, 0x09, 0xF4, 0x27, 0xF8, 0xD6, 0xB0, 0x4C, 0x08,
-    0x86, 0xC7, 0x5B, 0xB8, 0x11, 0x21, 0xCC, 0xE2, 0x61, 0x6F, 0x3A, 0x2E, 0x86, 0xD5, 0x45, 0xA1,
-    0x97, 0x21, 0xAC, 0x44, 0xB9, 0x37, 0xE1, 0x7A, 0x5C, 0x8D, 0x45, 0x19, 0xC0, 0x02, 0x2B, 0x8D,
-    0xB8, 0x4E, 0xAF, 0x25, 0xC5, 0xFD, 0x09, 0x61, 0x03, 0xFA, 0x0A, 0x62, 0xCC, 0x18, 0x14, 0xB2,
-    0x7A, 0xA5, 0xC5, 0x09, 0x37, 0xE6, 0x09, 0x20, 0x4F, 0x86, 0x7B, 0x7A, 0x72, 0x6C, 0x22, 0x1C,
-    0xEF, 0xB6, 0x5E, 0x7B, 0x72, 0xEC, 0xF3, 0x5F, 0x0F, 0xB0, 0x72, 0xFB, 0x4A, 0x14, 0xD2, 0xBE,
-    0xE9, 0x6B, 0xAF, 0x92, 0xA7, 0xD5, 0xAF, 0xC8, 0xD3, 0xB7, 0x04, 0xB0, 0xC9, 0x8F, 0x02, 0x30,
-    0xEB, 0x07, 0x00, 0x98, 0xF5, 0x5D, 0xCD, 0x14, 0xF1, 0xC0, 0x9D, 0x2D, 0x00, 0x22, 0xD7, 0x40,
-    0x4E, 0xCD, 0xC5, 0x83, 0xD0, 0xAE, 0xBF, 0x9F, 0x3D, 0x30, 0xEE, 0xF4, 0xEF, 0x88, 0x3B, 0xB7,
-    0x60, 0xBE, 0xF5, 0xE7, 0x98, 0xFB, 0x80, 0x75, 0x37, 0xB3, 0x63, 0x52, 0x0E, 0xAF, 0x0D, 0x21,
-    0xF9, 0xD0, 0xFF, 0x0A, 0xD5, 0xFD, 0x2D, 0x37, 0x33, 0x27, 0x36, 0xCB, 0x6B, 0x45, 0x05, 0xB3,
-    0x3D, 0xFA, 0xBC, 0x63, 0x2B, 0x9B, 0xB4, 0x30, 0xC0, 0xAE, 0x4C, 0x04, 0x8C, 0x77, 0x8A, 0xAE,
-    0x01, 0x63, 0xC5, 0x45, 0x00, 0x0B, 0x10, 0x5E, 0x66, 0x7A, 0x56, 0x89, 0x94, 0xD6, 0xA8, 0x7E,
-    0x2E, 0xC3, 0x8B, 0x32, 0xFC, 0x50, 0xAA, 0xFE, 0x42, 0xE1, 0xD5, 0x71, 0x1B, 0x3D, 0x72, 0x26,
-    0x19, 0x30, 0x77, 0x6F, 0x8C, 0x0A, 0x5A, 0xF3, 0xB8, 0x7B, 0x5F, 0xD8, 0xD0, 0x36, 0x34, 0x93,
-    0x03, 0xC0, 0x8F, 0x9F, 0x5B, 0xBC, 0x00, 0x0F, 0x76, 0xA6, 0x0F, 0x0D, 0x0D, 0x23, 0x72, 0x3F,
-    0x05, 0x4F, 0x3C, 0x18, 0xAC, 0x37, 0x91, 0x3C, 0x04, 0x13, 0xD8, 0x8A, 0x01, 0xC9, 0x0F, 0xDE,
-    0x5F, 0x18, 0xC4, 0x49, 0xB5, 0x50, 0x87, 0xC8, 0x1F, 0xD6, 0x79, 0x68, 0xB5, 0xC6, 0x75, 0xB7,
-    0x38, 0x0C, 0xBC, 0x22, 0xA7, 0x46, 0x6E, 0x65, 0x29, 0x41, 0xEF, 0x0D, 0xFE, 0xA7, 0x24, 0x38,
-    0x48, 0x90, 0x3E, 0x46, 0x59, 0xBE, 0x26, 0x5A, 0xA3, 0xEE, 0x89, 0x27, 0x83, 0x0B, 0x72, 0xCE,
-    0xE4, 0x8C, 0x46, 0x01, 0xDF, 0xD1, 0x53, 0x8B, 0x2E, 0x6B, 0x94, 0x09, 0x72, 0x03, 0x3B, 0xB3,
-    0x47, 0x3A, 0xBD, 0xD3, 0xD3, 0x05, 0x0E, 0xFA, 0x9A, 0xFD, 0x1E, 0xF5, 0x42, 0x44, 0xB9, 0xAA,
-    0xE3, 0xBE, 0xCE, 0x65, 0x4E, 0x3A, 0x4C, 0xDD, 0x86, 0xA7, 0xED, 0xCF, 0xB9, 0xDE, 0x96, 0xF5,
-    0x35, 0x23, 0x43, 0x6E, 0x32, 0x53, 0xF5, 0x53, 0x83, 0x29, 0x1C, 0xF2, 0x9F, 0x49, 0x93, 0x19,
-    0x0C, 0x19, 0xEC, 0x81, 0x22, 0xFE, 0xEC, 0xC8, 0x8C, 0x67, 0x49, 0x39, 0xD9, 0x04, 0x32, 0xF7,
-    0xC9, 0xA6, 0xFF, 0x32, 0x3B, 0x95, 0x3B, 0xCA, 0xE7, 0x37, 0x77, 0xC8, 0xE3, 0x3B, 0x06, 0x99,
-    0x35, 0x9E, 0x7C, 0xE6, 0x3C, 0xA3, 0xCB, 0x98, 0xD2, 0x36, 0x25, 0x2F, 0x5C, 0x68, 0x70, 0x61,
-    0x61, 0x10, 0xCE, 0xE5, 0x31, 0xA4, 0x3C, 0x2E, 0x52, 0x1E, 0x44, 0x46, 0x4D, 0xD2, 0xCD, 0xB9,
-    0x3C, 0x36, 0x6C, 0xF0, 0xD7, 0xD3, 0x85, 0x78, 0xFA, 0xE8, 0xFE, 0x8E, 0xE4, 0xDF, 0xD2, 0x9E,
-    0xC9, 0xEA, 0x6A, 0xA6, 0x1E, 0x3B, 0x12, 0x8C, 0x39, 0x40, 0x0F, 0xD2, 0x35, 0x9F, 0xD1, 0x48,
-    0xF7, 0x04, 0xF7, 0x10, 0x9C, 0x6D, 0xF2, 0x15, 0x26, 0x7F, 0x10, 0xD0, 0x48, 0x4E, 0xC3, 0xE1,
-    0x0E, 0x91, 0x5F, 0x3D, 0x44, 0x4D, 0x9B, 0x80, 0x38, 0x6A, 0x12, 0x58, 0x7D, 0x9C, 0x9B, 0x1A,
-    0xD7, 0x61, 0xF4, 0x92, 0x0C, 0x12, 0x1E, 0x90, 0xA9, 0x59, 0x79, 0xF4, 0x08, 0x99, 0xDC, 0xE9,
-    0xAA, 0x58, 0x5A, 0xC0, 0x4F, 0xE0, 0xE0, 0x5E, 0xA6, 0x26, 0x5C, 0xDD, 0xA5, 0x27, 0x84, 0x13,
-    0x9C, 0x93, 0xC5, 0x73, 0xB2, 0x75, 0xAF, 0x0F, 0xBD, 0x35, 0xE5, 0x84, 0xAC, 0x5B, 0xAA, 0x3B,
-    0x5C, 0x9C, 0xAA, 0xAF, 0x26, 0x81, 0xED, 0xCD, 0x19, 0xB8, 0xFD, 0x2A, 0x29, 0x9D, 0xD5, 0x5C,
-    0x5E, 0x0D, 0x99, 0xD3, 0xE6, 0xDE, 0xD4, 0xC8, 0xBA, 0xDE, 0x2F, 0xD3, 0x93, 0xD6, 0x35, 0xE4,
-    0xD2, 0x5A, 0xC0, 0xCA, 0xFF, 0x00, 0xCD, 0x5A, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0x24, 0x2D,
-    0xB1, 0x31, 0x61, 0xD1, 0x01, 0xEC, 0xB8, 0x8D, 0x61, 0x33, 0x83, 0x07, 0xD7, 0x95, 0xCC, 0xC5,
-    0x83, 0xD0, 0x9E, 0xC5, 0x2F, 0xF1, 0xD6, 0x0C, 0xF5, 0x10, 0xB5, 0x43, 0x50, 0xC4, 0x43, 0x87,
-    0x22, 0x1D, 0x6E, 0x51, 0x01, 0x23, 0xF0, 0xE9, 0xD8, 0x64, 0xE8, 0x10, 0xA0, 0x11, 0x50, 0x24,
-    0x1D, 0x3A, 0xD4, 0x43, 0x86, 0x44, 0x41, 0x21, 0x03, 0x15, 0x10, 0x03, 0x3D, 0xF9, 0xBE, 0x24,
-    0x43, 0x86, 0x2C, 0x6C, 0xD3, 0xAD, 0x28, 0xC2, 0x02, 0x4E, 0x0B, 0xD8, 0x05, 0xCC, 0xB4, 0x17,
-    0xF4, 0x24, 0xDF, 0x1D, 0xFB, 0xFB, 0x3D, 0xDE, 0xE9, 0x4E, 0xAE, 0xF3, 0xC7, 0xED, 0x39, 0xF6,
-    0x89, 0xEF, 0xF1, 0xF8, 0x91, 0x7C, 0xEF, 0x7D, 0xEF, 0x7B, 0x7F, 0xBF, 0xD3, 0x8F, 0x07, 0x83,
-    0x2D, 0x91, 0x13, 0x8B, 0xB5, 0x5A, 0xED, 0x12, 0x3F, 0xAD, 0xAD, 0xAD, 0xAD, 0xFE, 0x21, 0xD9,
-    0x2F, 0x22, 0x01, 0xA0, 0xBE, 0x26, 0x5E, 0xD9, 0x97, 0xF0, 0x83, 0xC4, 0xC4, 0x41, 0x64, 0x96,
-    0x82, 0x50, 0x1A, 0x18, 0x6F, 0xDD, 0x01, 0x5B, 0x80, 0x55, 0x40, 0x02, 0x88, 0x5F, 0xF6, 0x4C,
-    0x78, 0xAB, 0x2E, 0x2E, 0xDE, 0x93, 0xE8, 0x7C, 0x45, 0x87, 0xC0, 0x4F, 0xB3, 0x2F, 0xEE, 0x76,
-    0x33, 0xF5, 0xB3, 0xD0, 0x86, 0xD6, 0xB7, 0x61, 0x8A, 0x67, 0x53, 0x11, 0x42, 0x60, 0x45, 0x7C,
-    0x42, 0x2E, 0xD2, 0x2E, 0xBB, 0xE2, 0x74, 0xF0, 0x3C, 0xE1, 0xEA, 0x10, 0x36, 0x01, 0x85, 0x88,
-    0x9B, 0xE1, 0xD9, 0x72, 0x6D, 0x25, 0x29, 0xCB, 0xE2, 0x8C, 0x5B, 0xE2, 0x8D, 0x7D, 0xF8, 0x13,
-    0x73, 0x36, 0x7E, 0xC9, 0x86, 0x65, 0x69, 0x7C, 0x7B, 0x5A, 0x42, 0x30, 0x9C, 0x13, 0xDF, 0x1C,
-    0x10, 0xCF, 0xF0, 0xCC, 0x6B, 0x1D, 0x1F, 0x94, 0x78, 0xEE, 0x97, 0xF6, 0x10, 0x9E, 0x6F, 0xF7,
-    0x82, 0x52, 0x9A, 0x9D, 0x59, 0xCC, 0x2E, 0x03, 0x1F, 0xB0, 0x2D, 0xC4, 0x2B, 0x9C, 0x0C, 0x8C,
-    0x3D, 0x10, 0xED, 0xF9, 0x46, 0xA4, 0x11, 0x82, 0xE7, 0xD2, 0x31, 0xA0, 0x68, 0x1E, 0x28, 0x84,
-    0x08, 0x7E, 0x59, 0xE6, 0xE2, 0x3C, 0xFB, 0x29, 0x26, 0xE6, 0x41, 0x52, 0xF7, 0xAD, 0x1D, 0xAA,
-    0x08, 0x63, 0x7A, 0x59, 0x21, 0xBF, 0xE0, 0x1B, 0xDB, 0x40, 0x65, 0x89, 0x99, 0x5D, 0x19, 0x7F,
-    0x2E, 0xA8, 0x16, 0x2E, 0x4C, 0x8C, 0xF0, 0xDA, 0x2D, 0x33, 0x09, 0x5F, 0xEB, 0xCA, 0x69, 0x69,
-    0x49, 0x4D, 0xFF, 0xCE, 0xC8, 0x59, 0x8C, 0xC7, 0x10, 0x21, 0x84, 0x0A, 0x92, 0xD2, 0xC8, 0x4A,
-    0xBB, 0x90, 0x2B, 0x41, 0x0F, 0x5A, 0x28, 0x65, 0x0B, 0x77, 0x12, 0x1B, 0x9A, 0xA8, 0x1B, 0x82,
-    0xF7, 0x2B, 0x50, 0x6B, 0x0F, 0x4C, 0x01, 0xB8, 0x23, 0xB2, 0x20, 0xF3, 0x72, 0x1C, 0x34, 0x8E,
-    0x81, 0xC6, 0xBC, 0xC4, 0x3F, 0xDB, 0x84, 0xBA, 0xA0, 0x33, 0xCC, 0xF9, 0x47, 0xFB, 0xA5, 0x17,
-    0xA5, 0xBD, 0x30, 0x3D, 0x31, 0x3B, 0x5C, 0x0F, 0xB0, 0xA6, 0x98, 0xF1, 0xC7, 0x1B, 0x78, 0x02,
-    0x3A, 0xEF, 0x8A, 0x87, 0x2F, 0xA7, 0x25, 0x30, 0xF5, 0x6E, 0x60, 0x8E, 0xBB, 0x9D, 0xA6, 0x67,
-    0xE7, 0xB1, 0x4E, 0x4E, 0xB6, 0x18, 0x9A, 0x7D, 0x92, 0x9F, 0x89, 0xB8, 0x08, 0x2B, 0xC4, 0x57,
-    0x56, 0x62, 0xC5, 0xFA, 0xBD, 0x1A, 0xC7, 0x33, 0x22, 0x79, 0x2D, 0xB0, 0xAE, 0x93, 0x1D, 0xF7,
-    0x3A, 0x91, 0x67, 0x43, 0x69, 0x83, 0x0E, 0xF5, 0x19, 0xE9, 0x82, 0xB6, 0x30, 0x99, 0x57, 0xEB,
-    0xD0, 0xD1, 0x6C, 0x39, 0x20, 0xFB, 0x19, 0xC0, 0xD1, 0xAE, 0x2C, 0xC5, 0x52, 0xC3, 0xBB, 0xA1,
-    0x39, 0x5A, 0x9A, 0x56, 0x68, 0xBA, 0x38, 0x22, 0x73, 0xAD, 0x9D, 0xC6, 0x2F, 0xAE, 0xC9, 0x21,
-    0x47, 0x64, 0x65, 0x4E, 0x9C, 0xA2, 0x06, 0xD9, 0xBA, 0x12, 0xBE, 0x54, 0xC0, 0xCC, 0x32, 0x49,
-    0xB0, 0x6A, 0x11, 0xBE, 0xFB, 0xB6, 0x23, 0x6E, 0x7E, 0x09, 0x32, 0x60, 0x99, 0x30, 0xAF, 0xC3,
-    0xCB, 0xCB, 0x06, 0xA6, 0x91, 0x1D, 0x5E, 0xFE, 0x3E, 0x66, 0xE2, 0xDC, 0x05, 0xC4, 0xD0, 0x10,
-    0x4B, 0x83, 0x43, 0xE4, 0x8B, 0xF4, 0xF0, 0xDD, 0xF5, 0x35, 0xE8, 0xC1, 0xDF, 0x69, 0x41, 0x0F,
-    0x4E, 0x11, 0x43, 0x0F, 0x4E, 0x11, 0x41, 0x0F, 0xC4, 0xC5, 0x8A, 0x53, 0x9C, 0x86, 0x06, 0x9C,
-    0xDB, 0x1D, 0xE2, 0x7F, 0xE7, 0xD0, 0x83, 0x53, 0x74, 0xA0, 0x07, 0xA7, 0x68, 0x41, 0x0F, 0x4E,
-    0xB1, 0x04, 0x3D, 0xB8, 0x45, 0x74, 0xCE, 0x86, 0xD1, 0x20, 0xB8, 0xF9, 0x05, 0x7A, 0x80, 0xD4,
-    0x1D, 0x02, 0xDD, 0xA5, 0x2F, 0xF1, 0x86, 0xB9, 0xE4, 0xD9, 0x4D, 0x97, 0xC7, 0x45, 0xCF, 0x9E,
-    0x0D, 0xD2, 0xA8, 0x14, 0xE7, 0x75, 0xD9, 0x75, 0xCD, 0x09, 0x38, 0xFC, 0xDC, 0x70, 0xCE, 0x38,
-    0xDF, 0x79, 0x6F, 0xD7, 0xF5, 0xF0, 0x39, 0xB5, 0xBE, 0xBE, 0xC6, 0xE7, 0x68, 0x9D, 0x7D, 0x69,
-    0x44, 0xE6, 0x6A, 0x68, 0x4F, 0x84, 0x96, 0xEE, 0x17, 0xD2, 0x6E, 0x64, 0x85, 0xDE, 0x15, 0x88,
-    0x5D, 0x70, 0x6C, 0xBB, 0xB4, 0xEB, 0xEB, 0x69, 0x65, 0xC7, 0x8D, 0x18, 0x4F, 0xA6, 0x27, 0xF0,
-    0x18, 0xA4, 0xBF, 0x2A, 0xFE, 0xB6, 0x7A, 0x6C, 0x60, 0x2F, 0xF8, 0xB6, 0x08, 0xED, 0x56, 0x13,
-    0x86, 0x28, 0xCE, 0xF9, 0x20, 0x8B, 0xCC, 0x59, 0xD8, 0xA7, 0x91, 0x6F, 0xCA, 0xFE, 0x74, 0x49,
-    0x42, 0xFB, 0x65, 0x21, 0x91, 0xD8, 0x36, 0x4D, 0xD3, 0x36, 0x6F, 0xFC, 0x3D, 0x7F, 0xA1, 0x7C,
-    0xB1, 0x7B, 0x11, 0xB6, 0x7A, 0x11, 0xAC, 0xB1, 0xAA, 0xD2, 0xE0, 0x62, 0x41, 0x8E, 0x24, 0xA5,
-    0xEE, 0xAA, 0x4F, 0x50, 0x96, 0x65, 0x52, 0xFE, 0x2A, 0x6F, 0x96, 0xE7, 0x20, 0xE7, 0x39, 0x5B,
-    0x0E, 0xA1, 0x3D, 0x84, 0x04, 0x10, 0x01, 0x66, 0x37, 0xCE, 0x59, 0xF1, 0xEF, 0x11, 0xC2, 0x73,
-    0xB9, 0x94, 0xE7, 0x4A, 0xF2, 0xD9, 0x27, 0x89, 0x24, 0x26, 0x31, 0x8F, 0x88, 0x23, 0xBE, 0x04,
-    0x39, 0xCC, 0xA2, 0x25, 0x57, 0x4F, 0x75, 0x92, 0x4C, 0xAE, 0xD0, 0xC9, 0xAF, 0x15, 0xF2, 0x68,
-    0x01, 0xCB, 0xBC, 0xCB, 0xF1, 0xD8, 0x36, 0xB4, 0x9D, 0x06, 0xDB, 0xB2, 0xF4, 0x9C, 0x69, 0xF9,
-    0xB6, 0x0B, 0xD3, 0xF5, 0x72, 0x3D, 0x32, 0x5C, 0x62, 0x10, 0x4A, 0x3C, 0x88, 0x55, 0x9F, 0x47,
-    0x98, 0x09, 0x61, 0x6B, 0xC1, 0x3B, 0x8C, 0x3E, 0x2D, 0x58, 0x5E, 0xA2, 0xE0, 0x15, 0x5B, 0x6A,
-    0xDA, 0xE1, 0x53, 0xB9, 0x1C, 0xF3, 0x52, 0x51, 0x8F, 0x45, 0xF8, 0x01, 0xDF, 0x0E, 0xC3, 0xE0,
-    0xB5, 0x0E, 0x97, 0xEA, 0xD1, 0x8E, 0xC0, 0xA6, 0x60, 0x50, 0x81, 0x21, 0xC6, 0x22, 0x02, 0x2F,
-    0x28, 0xAE, 0x29, 0xDE, 0x0C, 0x2C, 0x70, 0x11, 0x01, 0xBB, 0x59, 0x62, 0x1F, 0xDB, 0xF6, 0xEC,
-    0xEF, 0xED, 0xA9, 0xF5, 0x97, 0x9F, 0xFC, 0x00, 0xA6, 0x18, 0x7A, 0x2F, 0x03, 0x2F, 0x04, 0x8C,
-    0xBC, 0xB5, 0x63, 0xCF, 0xFE, 0x09, 0x0C, 0xE2, 0xB2, 0x24, 0x75, 0x8C, 0xD0, 0x10, 0x2C, 0xA9,
-    0x47, 0x39, 0xA9, 0x3F, 0xFF, 0x06, 0xB9, 0xE7, 0xE4, 0xEE, 0x5A, 0x72, 0x87, 0x4C, 0xE0, 0x1E,
-    0x28, 0x97, 0x39, 0xC5, 0xF3, 0x8A, 0x17, 0x15, 0x5F, 0x51, 0x9C, 0xB7, 0x33, 0xF0, 0x7D, 0xEF,
-    0xAF, 0x5D, 0x84, 0xD4, 0x9F, 0xDB, 0xD6, 0x63, 0xDB, 0x81, 0x93, 0xB6, 0x4E, 0xAD, 0xFF, 0x42,
-    0xED, 0x7F, 0x5E, 0xA3, 0xFB, 0xA2, 0x38, 0xB9, 0xCE, 0x2A, 0x25, 0xF5, 0xE3, 0x42, 0xEA, 0x2B,
-    0x8F, 0x80, 0xBA, 0x9B, 0x1D, 0x60, 0xD0, 0x46, 0x12, 0x99, 0x93, 0xD9, 0xF5, 0x37, 0xAB, 0x85,
-    0x67, 0x4C, 0xCD, 0x69, 0x8E, 0x90, 0x0E, 0x16, 0x09, 0xE9, 0x60, 0x94, 0x90, 0x0E, 0x96, 0xC1,
-    0xB9, 0x5F, 0xE5, 0xDC, 0xA1, 0xD8, 0x1A, 0x63, 0x75, 0xCA, 0x7C, 0x11, 0xD8, 0x22, 0x96, 0x0B,
-    0xFE, 0xBB, 0x59, 0x53, 0x8A, 0xF0, 0x3D, 0x8B, 0xD0, 0xD9, 0x7C, 0xFA, 0xA9, 0x5B, 0x82, 0xC0,
-    0xE9, 0x33, 0x7A, 0x2D, 0xCC, 0x11, 0xD7, 0xE6, 0x89, 0x37, 0x7F, 0x5A, 0x47, 0x4C, 0x2F, 0xDA,
-    0x65, 0x8F, 0x73, 0xC7, 0x08, 0xA8, 0x03, 0x83, 0x7A, 0x93, 0xEE, 0xE1, 0xAC, 0x5F, 0x96, 0xC7,
-    0x61, 0x86, 0x46, 0x8F, 0x91, 0x47, 0x7D, 0x4D, 0x10, 0x66, 0x87, 0x47, 0x5F, 0x82, 0x42, 0xE2,
-    0x94, 0x37, 0x11, 0x86, 0x7B, 0x3C, 0x0E, 0xF5, 0xE4, 0x74, 0x43, 0x92, 0x44, 0xAE, 0x05, 0xC8,
-    0x68, 0xCF, 0x1B, 0x99, 0xD1, 0x90, 0x13, 0xD0, 0x03, 0xB1, 0xC4, 0x4A, 0xA2, 0xAB, 0x78, 0x5E,
-    0x2A, 0x83, 0x1B, 0x7F, 0x4E, 0x57, 0x09, 0x53, 0x71, 0x5B, 0x5F, 0xBB, 0x45, 0x77, 0x74, 0x3E,
-    0xB2, 0x7C, 0xF7, 0x7D, 0x92, 0xF0, 0x5E, 0x22, 0x89, 0xE0, 0x1C, 0x71, 0xE8, 0x90, 0xD0, 0x1C,
-    0xF9, 0x82, 0x18, 0xF3, 0x40, 0x4D, 0x56, 0xE9, 0x3F, 0xCB, 0x24, 0xD1, 0x2E, 0x19, 0xEC, 0x72,
-    0x89, 0x52, 0x86, 0xC0, 0x50, 0x17, 0x16, 0x52, 0x60, 0x11, 0x21, 0x45, 0xA0, 0x38, 0xCA, 0x18,
-    0x76, 0x30, 0xFB, 0x26, 0x73, 0x96, 0x3C, 0xA3, 0x22, 0x32, 0x18, 0x89, 0xAF, 0xE2, 0x86, 0x2A,
-    0xC3, 0x82, 0xCA, 0x73, 0xF0, 0xA1, 0x91, 0xF3, 0x70, 0xC5, 0x57, 0x71, 0xA9, 0x1C, 0x3F, 0x64,
-    0x06, 0x0E, 0xCC, 0xA6, 0xAA, 0xF3, 0xE0, 0x43, 0x22, 0xA7, 0xA3, 0x0C, 0xC3, 0xEE, 0x01, 0x0A,
-    0xD2, 0x86, 0xF5, 0xCB, 0x62, 0xA8, 0xBA, 0x15, 0xF3, 0x90, 0x48, 0x38, 0x6B, 0x2E, 0x93, 0xE6,
-    0x3B, 0x9D, 0x5D, 0xEC, 0xCA, 0x79, 0xB9, 0xE3, 0xF3, 0x60, 0xD7, 0xFA, 0x79, 0x4D, 0xD4, 0xB7,
-    0x95, 0x57, 0xAA, 0xC5, 0x96, 0x29, 0x76, 0xBF, 0x3B, 0xBA, 0xFA, 0x9F, 0x25, 0x9B, 0x3B, 0x21,
-    0x9B, 0x7F, 0x2F, 0xB2, 0xD9, 0x2F, 0x29, 0x1B, 0x02, 0x27, 0xF3, 0xEA, 0x91, 0xF2, 0x06, 0x2B,
-    0x08, 0x6F, 0xC3, 0x68, 0x99, 0x1A, 0x1B, 0x16, 0x1C, 0x73, 0xA8, 0xE3, 0x20, 0xE2, 0x3C, 0x4E,
-    0x20, 0xBA, 0x18, 0xAB, 0x70, 0x57, 0xAA, 0x53, 0xAE, 0x27, 0xD7, 0xC6, 0x37, 0xDE, 0xE4, 0x4C,
-    0x62, 0x16, 0xCD, 0xA1, 0x16, 0x7E, 0x12, 0x2D, 0xD7, 0x4D, 0x55, 0x16, 0xF0, 0x74, 0xB1, 0x1A,
-    0x2C, 0xF4, 0x04, 0xAA, 0x38, 0x9D, 0x61, 0x84, 0x42, 0x65, 0x08, 0x79, 0x70, 0xDA, 0x8C, 0x33,
-    0x69, 0xBE, 0xFA, 0x83, 0x4E, 0xD9, 0x43, 0x89, 0x5A, 0x76, 0x86, 0x89, 0x32, 0x97, 0xE6, 0x6B,
-    0x7D, 0xB7, 0x23, 0x6D, 0xD4, 0xB7, 0x09, 0xE6, 0xB1, 0x10, 0xA5, 0x1A, 0xC4, 0x34, 0x84, 0x25,
-    0x43, 0x85, 0x8D, 0x60, 0x34, 0xC6, 0xFB, 0x31, 0xCB, 0x72, 0xA8, 0x0E, 0x31, 0x6D, 0xD6, 0x43,
-    0x18, 0x93, 0xF2, 0x66, 0x4F, 0x22, 0xD6, 0xB9, 0x24, 0xDD, 0x67, 0xB1, 0x34, 0x0C, 0x0A, 0x80,
-    0x59, 0x38, 0xA0, 0xDF, 0xAD, 0x82, 0xC6, 0xD6, 0xF0, 0x16, 0xA4, 0xD2, 0x5A, 0x7D, 0x68, 0xE1,
-    0xD0, 0x68, 0xB7, 0xBE, 0xB3, 0xDE, 0x43, 0xDA, 0xBC, 0x04, 0xED, 0xD5, 0x00, 0xF3, 0x80, 0x7D,
-    0x8C, 0x82, 0xBB, 0xB0, 0xB3, 0x9E, 0xA2, 0x96, 0x4E, 0xF7, 0x8C, 0x8D, 0x21, 0x00, 0x84, 0xD4,
-    0x7C, 0xF4, 0xE9, 0x32, 0xC8, 0x31, 0x55, 0x1D, 0x1E, 0x4A, 0x0C, 0x8F, 0x72, 0x0A, 0x0D, 0xD9,
-    0x48, 0xD5, 0xF7, 0x8F, 0x9F, 0x73, 0x5E, 0x15, 0x22, 0x21, 0xAC, 0xE6, 0xEC, 0x12, 0x72, 0x06,
-    0xB2, 0x83, 0x71, 0xEE, 0x1F, 0x3F, 0x14, 0xEC, 0xD2, 0xC3, 0xDA, 0xF6, 0x22, 0x23, 0x17, 0x66,
-    0x76, 0xDD, 0xF0, 0x7E, 0xF0, 0xC2, 0xD2, 0x5D, 0xD3, 0x85, 0x0B, 0x6C, 0x55, 0x25, 0x57, 0x8C,
-    0x4C, 0xBD, 0xCF, 0x4A, 0xC7, 0xBB, 0xC7, 0x03, 0x89, 0x9A, 0xAD, 0xCF, 0x8C, 0xAE, 0x4E, 0x8B,
-    0x66, 0xCB, 0x3A, 0x65, 0x1A, 0x34, 0xB1, 0x04, 0x58, 0x01, 0x2C, 0x00, 0xF4, 0x0F, 0xF5, 0x57,
-    0xDA, 0xFF, 0x3F, 0x69, 0x6A, 0x5F, 0x64, 0x70, 0x3C, 0x31, 0x33, 0x9D, 0x89, 0xB7, 0xCB, 0x1D,
-    0x23, 0xF5, 0x9D, 0x0D, 0xB4, 0x95, 0x85, 0x33, 0xE0, 0x78, 0xC2, 0x85, 0x08, 0x2D, 0x35, 0x9F,
-    0xEB, 0x93, 0x44, 0x1D, 0x45, 0x6F, 0xED, 0xBC, 0xEE, 0x76, 0xD1, 0xF1, 0xBA, 0x5D, 0x5C, 0x2A,
-    0x1A, 0xDE, 0x18, 0x3D, 0xA7, 0x6F, 0x84, 0x99, 0xC7, 0xEA, 0x02, 0xA8, 0x2D, 0xD1, 0xA7, 0xF5,
-    0x2E, 0xD8, 0x30, 0xEE, 0x54, 0x89, 0x25, 0xE8, 0xA1, 0x04, 0x93, 0xE3, 0xED, 0xDF, 0x32, 0x98,
-    0x05, 0xDD, 0xBD, 0x89, 0xA5, 0x9D, 0x23, 0x3A, 0x99, 0x7A, 0x47, 0x8E, 0x6E, 0xB3, 0x49, 0x84,
-    0x9F, 0x78, 0x03, 0xC6, 0x36, 0xAF, 0x64, 0x58, 0xF2, 0x7E, 0x63, 0x89, 0x5F, 0xC9, 0x89, 0x11,
-    0x1F, 0x81, 0x5F, 0xEC, 0x11, 0xA7, 0x7D, 0xC5, 0x89, 0xE2, 0xD8, 0x12, 0x87, 0x19, 0xB1, 0x5F,
-    0x10, 0xBB, 0x5D, 0x62, 0xE9, 0x2B, 0x6E, 0x2A, 0x8E, 0x73, 0xAE, 0x72, 0x88, 0xA8, 0x79, 0x9D,
-    0xED, 0x34, 0x42, 0x99, 0x8B, 0x70, 0xA1, 0x25, 0x4F, 0x68, 0x47, 0xBD, 0xB1, 0x86, 0x0F, 0xAD,
-    0xD0, 0xC6, 0xD5, 0xCE, 0x51, 0x86, 0x95, 0xF6, 0x6B, 0x7D, 0xD6, 0x1B, 0xB1, 0x09, 0x18, 0x70,
-    0x19, 0x72, 0xF3, 0x98, 0x81, 0x16, 0xC1, 0xC8, 0xED, 0xC0, 0x8A, 0x58, 0x15, 0x8B, 0xD3, 0x6B,
-    0xDE, 0x05, 0x8D, 0xEE, 0xBA, 0x5D, 0xF8, 0x8A, 0x57, 0xF0, 0xDD, 0x22, 0x60, 0xFD, 0xAA, 0xF4,
-    0x64, 0xB0, 0xCC, 0x9D, 0x08, 0xF2, 0x60, 0x13, 0x2C, 0xEA, 0xC5, 0x55, 0x0D, 0xC6, 0x7D, 0x07,
-    0x59, 0xE2, 0xD8, 0xCA, 0x9E, 0x3C, 0xF7, 0x15, 0x0B, 0xA4, 0x68, 0xA0, 0x5D, 0x28, 0x94, 0xE5,
-    0xBF, 0xCF, 0xDA, 0x9C, 0xE1, 0x6C, 0x5C, 0xBF, 0x7C, 0xB5, 0x02, 0xA9, 0x51, 0xC5, 0xC5, 0x49,
-    0x91, 0x6F, 0x0F, 0xD8, 0x73, 0xC4, 0x9A, 0x60, 0x1F, 0x8C, 0x72, 0xF6, 0x3B, 0x6B, 0xB8, 0x64,
-    0xCA, 0x56, 0x34, 0x23, 0xE9, 0x03, 0x5C, 0x28, 0xB6, 0x60, 0xA1, 0x9C, 0xC5, 0x5F, 0x68, 0xD0,
-    0x02, 0x7D, 0x08, 0x1B, 0xE2, 0x8A, 0xB1, 0x6E, 0xC0, 0x99, 0xD7, 0x1C, 0xE7, 0x7D, 0x3E, 0x37,
-    0x59, 0x25, 0xC3, 0x31, 0x8E, 0x96, 0x7F, 0xA6, 0xAC, 0x03, 0xCA, 0x9A, 0x50, 0xD6, 0x84, 0xB2,
-    0xBE, 0x4D, 0x59, 0x3F, 0x84, 0xAC, 0xDE, 0xBB, 0x90, 0xD5, 0x7F, 0x12, 0xD2, 0x84, 0x14, 0xEE,
-    0x18, 0xD1, 0x22, 0xD1, 0x15, 0xA2, 0x1C, 0xB2, 0xBA, 0x16, 0xB2, 0xD2, 0xF3, 0xE2, 0xA7, 0x29,
-    0xEB, 0x5F, 0x28, 0x6B, 0x6F, 0x8F, 0xAC, 0xEE, 0x47, 0x25, 0x3D, 0xF1, 0xD0, 0x88, 0x6B, 0x15,
-    0x1D, 0xF6, 0x34, 0x1A, 0xEA, 0x79, 0xEC, 0x96, 0x26, 0x97, 0x14, 0x35, 0x8C, 0x45, 0x8C, 0x88,
-    0x06, 0xE6, 0xC8, 0xB6, 0x16, 0xFD, 0x1A, 0xCB, 0xE8, 0xF9, 0x53, 0xC2, 0xA8, 0x40, 0xD0, 0xE7,
-    0xA1, 0xE4, 0x62, 0x45, 0x30, 0xD0, 0xBD, 0xBE, 0xE4, 0xE3, 0xB6, 0x56, 0x28, 0x2A, 0x56, 0x55,
-    0xC6, 0x57, 0x4D, 0x87, 0xAB, 0x11, 0xA2, 0x0A, 0x16, 0xEA, 0xA0, 0x6C, 0xAE, 0xF6, 0x7C, 0x1E,
-    0x0E, 0x69, 0xAB, 0x5C, 0x91, 0x54, 0x65, 0xA7, 0x4A, 0x5B, 0x68, 0x39, 0x6A, 0x6B, 0xAA, 0xDA,
-    0x7D, 0x0F, 0x95, 0xB4, 0x4E, 0x7A, 0x52, 0x95, 0xBA, 0xA5, 0xB8, 0xA5, 0x23, 0x27, 0x1E, 0x46,
-    0xAD, 0xAA, 0x0D, 0x68, 0xDF, 0xA9, 0x6D, 0xA7, 0x76, 0x9D, 0x0B, 0x93, 0x3D, 0x67, 0x82, 0xF4,
-    0xDA, 0x8F, 0xFA, 0xE6, 0xB9, 0xAE, 0xC7, 0x5D, 0x3A, 0xA7, 0xC7, 0xBD, 0x83, 0x3E, 0x2D, 0x3A,
-    0xE1, 0xFE, 0x41, 0x6C, 0x6A, 0x4C, 0x37, 0x2B, 0xDC, 0x48, 0x66, 0xA9, 0xF3, 0x4F, 0x96, 0x84,
-    0xB7, 0x69, 0x46, 0xBA, 0xA5, 0xB3, 0xFA, 0xB9, 0xA8, 0xA9, 0x8D, 0x04, 0x03, 0x0E, 0x44, 0x6A,
-    0x23, 0xBF, 0xD6, 0xFB, 0x46, 0x77, 0x73, 0xAB, 0x8A, 0xEA, 0x75, 0xEE, 0xF4, 0x22, 0x0F, 0xFB,
-    0x4C, 0xCD, 0x3D, 0x40, 0x1F, 0xB0, 0x35, 0x84, 0x7E, 0x35, 0xE6, 0x20, 0x81, 0xFB, 0x85, 0x56,
-    0x5E, 0x3B, 0xE7, 0x77, 0x2B, 0x2E, 0x6E, 0x5C, 0x94, 0xDA, 0xA1, 0x1C, 0xD4, 0x09, 0x63, 0x6A,
-    0xAB, 0xDC, 0x07, 0xEC, 0xC9, 0x25, 0x6E, 0x94, 0x2C, 0x89, 0x8B, 0x12, 0x81, 0x28, 0x96, 0x6F,
-    0x15, 0x4E, 0x1B, 0x28, 0xBA, 0x81, 0x4B, 0xA4, 0x26, 0xB7, 0xB8, 0xB4, 0x8B, 0x56, 0x89, 0x92,
-    0x0C, 0x08, 0xF5, 0x8F, 0x5B, 0x20, 0x5B, 0xF0, 0x0D, 0x0B, 0x14, 0x64, 0x6E, 0xF1, 0x84, 0x97,
-    0xBB, 0x45, 0x41, 0xD4, 0xF1, 0xB2, 0x23, 0xC5, 0x56, 0x64, 0x9B, 0x45, 0x3C, 0xA8, 0x4A, 0x01,
-    0xA6, 0x3C, 0xF5, 0xAB, 0xDE, 0x30, 0xE1, 0x05, 0x63, 0xF7, 0x77, 0x50, 0x20, 0x84, 0x3B, 0x28,
-    0xEE, 0x91, 0xEB, 0x43, 0x13, 0xCB, 0xAC, 0xEE, 0xB3, 0x45, 0xEC, 0x01, 0x8C, 0x83, 0x42, 0x28,
-    0xBA, 0x1E, 0x9B, 0x04, 0xD7, 0x0D, 0x00, 0x77, 0x9E, 0x1B, 0x88, 0x5E, 0xAB, 0x68, 0xB1, 0x92,
-    0x9B, 0xAF, 0x64, 0xC1, 0x20, 0x2C, 0xAA, 0x36, 0xF1, 0x99, 0x8A, 0x38, 0x64, 0xD1, 0x5D, 0xFC,
-    0x70, 0x9C, 0xDF, 0xA7, 0x42, 0x7F, 0x66, 0xE8, 0x6A, 0x74, 0xB4, 0x4F, 0x0A, 0x75, 0xB2, 0x91,
-    0x8B, 0x4D, 0x85, 0x3E, 0xB7, 0xF3, 0x07, 0x9E, 0x04, 0x1B, 0xB7, 0xE4, 0x80, 0xDF, 0xDF, 0x35,
-    0xB7, 0x69, 0xD0, 0x76, 0xE1, 0x68, 0x7E, 0x0E, 0x33, 0x85, 0xDB, 0x39, 0x66, 0xEC, 0x74, 0x53,
-    0x91, 0xFB, 0x71, 0x58, 0xF6, 0x35, 0xBA, 0xD7, 0x22, 0xAA, 0xF6, 0x45, 0x9C, 0x2F, 0x22, 0xC7,
-    0xE0, 0xFA, 0x71, 0x33, 0x35, 0x1E, 0xA0, 0x11, 0x75, 0x40, 0xA5, 0x3F, 0x68, 0x93, 0x0E, 0x92,
-    0x24, 0x28, 0x59, 0x3F, 0x03, 0x2D, 0xAB, 0xB6, 0xAD, 0x3D, 0x06, 0x4B, 0x53, 0x87, 0x9D, 0x44,
-    0x01, 0x9A, 0xAF, 0x2E, 0x9F, 0x4F, 0x94, 0x4B, 0x83, 0xDD, 0x3D, 0x7F, 0xAF, 0xB0, 0xFC, 0xCE,
-    0x05, 0x5C, 0x95, 0xB7, 0x0B, 0x27, 0x4B, 0x6E, 0xFE, 0x61, 0xB0, 0x61, 0x83, 0xD2, 0x34, 0x07,
-    0xAA, 0x7B, 0xA3, 0x2B, 0xEB, 0xED, 0x0C, 0xAA, 0xDD, 0x60, 0xFC, 0x25, 0x88, 0xFA, 0x4B, 0xC3,
-    0xFD, 0xDF, 0x49, 0x58, 0x1A, 0x76, 0x7C, 0x90, 0x1F, 0xCF, 0xFA, 0xE2, 0x43, 0x2A, 0x87, 0x01,
-    0x84, 0x15, 0x70, 0x98, 0x55, 0x16, 0xA8, 0x45, 0x26, 0xCE, 0x6F, 0x01, 0xDA, 0x69, 0x65, 0xFD,
-    0xDD, 0xAA, 0x4D, 0xD4, 0xDE, 0xD4, 0x9F, 0xD8, 0x75, 0x51, 0xBE, 0xBD, 0x21, 0x5F, 0xD5, 0x93,
-    0xEE, 0x49, 0xAF, 0x02, 0x9A, 0x70, 0xD9, 0xD5, 0xE5, 0x65, 0xB3, 0xBA, 0x87, 0x2F, 0xC3, 0x8B,
-    0x6F, 0xFC, 0x1D, 0x84, 0xAE, 0x76, 0x77, 0xE8, 0x45, 0x9F, 0x6D, 0xFD, 0x53, 0xA1, 0x3F, 0xB2,
-    0xFE, 0x76, 0x26, 0xCE, 0x1D, 0xD6, 0x3F, 0x0D, 0xFA, 0x6E, 0xFA, 0xA3, 0xCA, 0x42, 0xB3, 0xDE,
-    0x1E, 0x0B, 0x9D, 0x06, 0xED, 0xC3, 0x7A, 0x0B, 0x79, 0x9C, 0xBD, 0x79, 0x31, 0xF4, 0xAB, 0x53,
-    0x97, 0x51, 0x5E, 0x32, 0x30, 0xBA, 0x9F, 0x7F, 0x74, 0xE4, 0x48, 0x9F, 0x79, 0x89, 0x4D, 0x04,
-    0x0C, 0x69, 0x89, 0x3F, 0x04, 0x3A, 0xF9, 0xE8, 0xD7, 0x8C, 0x7B, 0x24, 0x02, 0x2B, 0xF0, 0x3B,
-    0xEC, 0x1C, 0x4F, 0xC7, 0x72, 0x91, 0xFB, 0xCD, 0xE6, 0x7F, 0x20, 0x72, 0x62, 0x56, 0x5A, 0x61,
-    0xDA, 0x9A, 0xF8, 0x09, 0xED, 0x9E, 0xE7, 0xC2, 0x12, 0x27, 0xF7, 0xC5, 0x19, 0xC0, 0x12, 0xE1,
-    0x58, 0x0A, 0x57, 0x61, 0x99, 0x6B, 0x71, 0x55, 0xF0, 0xFC, 0xE4, 0xD7, 0x96, 0x69, 0x26, 0xB4,
-    0x51, 0x1E, 0x23, 0xF9, 0xF0, 0xB7, 0x80, 0x25, 0x40, 0x03, 0x54, 0x46, 0xB0, 0xAA, 0xB9, 0xC1,
-    0xE3, 0xBD, 0x2C, 0x4A, 0x03, 0xEB, 0x5F, 0xAF, 0x57, 0x4E, 0x30, 0x32, 0x96, 0xAA, 0x7A, 0x7F,
-    0xE1, 0xBF, 0xAB, 0xF7, 0x53, 0x6B, 0xF0, 0x87, 0xF8, 0x5F, 0x25, 0xAA, 0xD7, 0x1D, 0xA4, 0x4E,
-    0xB7, 0x07, 0xE7, 0x74, 0x35, 0x01, 0x0D, 0xB3, 0xD0, 0x17, 0x22, 0x14, 0xAF, 0x9C, 0x49, 0x92,
-    0x22, 0x11, 0x27, 0x05, 0x5D, 0xCB, 0xE9, 0x0D, 0x7D, 0x93, 0xB1, 0x85, 0x8A, 0x1D, 0xF5, 0x9E,
-    0xF5, 0xEB, 0x43, 0x97, 0x0E, 0x53, 0xCC, 0x24, 0x83, 0xB4, 0x39, 0xA5, 0x5E, 0x9D, 0x98, 0x49,
-    0x63, 0x3C, 0x93, 0x22, 0xC6, 0xFD, 0x30, 0x85, 0x01, 0x5D, 0x6F, 0x1A, 0x19, 0xCD, 0x46, 0xCB,
-    0x82, 0x6B, 0x55, 0xF9, 0xCA, 0x76, 0x72, 0xD2, 0x75, 0xA7, 0x41, 0x9F, 0xED, 0x29, 0xA3, 0x53,
-    0x02, 0xDB, 0xEC, 0xB0, 0x36, 0x59, 0x18, 0xBB, 0xD6, 0x34, 0xE8, 0x57, 0x89, 0xC5, 0x30, 0xB1,
-    0xCC, 0x79, 0xE3, 0xC4, 0x32, 0x0D, 0xDA, 0xCE, 0xDA, 0x49, 0xB5, 0x0B, 0x82, 0x8C, 0x8B, 0xFE,
-    0xE9, 0xC8, 0x3D, 0x3B, 0xAC, 0xBE, 0x19, 0xBF, 0x67, 0xC7, 0xA4, 0xC7, 0x3F, 0xAF, 0x2E, 0x8F,
-    0x17, 0x62, 0x66, 0xE2, 0xD9, 0xFD, 0x3A, 0x92, 0x4B, 0xFD, 0x6F, 0xD6, 0xDB, 0x29, 0x4D, 0x25,
-    0x43, 0x04, 0x19, 0xBE, 0x03, 0x19, 0x7E, 0x57, 0xAC, 0x3A, 0x7F, 0x2C, 0x1A, 0xDE, 0xBB, 0x45,
-    0x23, 0x80, 0x0C, 0x73, 0x90, 0xA1, 0x06, 0x19, 0x56, 0x20, 0x43, 0x0E, 0x19, 0xD0, 0x0F, 0x05,
-    0x90, 0x21, 0x84, 0x0C, 0xF3, 0x23, 0x83, 0xD5, 0x69, 0x25, 0xBB, 0xBD, 0x80, 0xA7, 0xFE, 0x53,
-    0x4C, 0x16, 0x84, 0xA7, 0x2E, 0xEF, 0x7F, 0x03, 0xF6, 0x1E, 0xF4, 0xE9, 0x84, 0x5B, 0x44, 0x8D,
-    0x2F, 0x89, 0xB6, 0x68, 0xD2, 0x7D, 0x94, 0xA4, 0x2E, 0x16, 0xA6, 0xDC, 0xE0, 0x0F, 0x3B, 0x3D,
-    0xD8, 0x41, 0xD5, 0x35, 0x8D, 0xF7, 0x2D, 0xE8, 0x97, 0xFA, 0x5B, 0x64, 0xC5, 0xD7, 0xDC, 0x5F,
-    0xBE, 0xCC, 0xEA, 0x2E, 0x3D, 0xCA, 0x67, 0xED, 0x16, 0x7E, 0x0F, 0x83, 0x67, 0x39, 0xEB, 0x83,
-    0x23, 0xC6, 0xF7, 0x87, 0xEF, 0x37, 0x5C, 0x6E, 0x0C, 0xB3, 0xE6, 0x56, 0xF4, 0x75, 0x67, 0xC2,
-    0xCF, 0xEE, 0xAB, 0x8A, 0x75, 0x5B, 0xBB, 0x31, 0xDA, 0x19, 0xD2, 0xAD, 0xC7, 0xDD, 0xBE, 0x74,
-    0xFD, 0x8D, 0xD9, 0x75, 0xD3, 0xEE, 0xCE, 0xC2, 0x8E, 0x32, 0x24, 0x6F, 0xF4, 0xCC, 0x9B, 0x6C,
-    0x0C, 0x19, 0x50, 0xB5, 0x95, 0x70, 0xF9, 0x8F, 0x1A, 0x54, 0x4E, 0x83, 0x61, 0x61, 0x89, 0x45,
-    0x6D, 0xCC, 0xDC, 0x1B, 0xFE, 0x90, 0xE8, 0x1F, 0x52, 0xED, 0x4A, 0x57, 0xED, 0x84, 0xD6, 0x05,
-    0x6E, 0x3E, 0xB2, 0x21, 0xA6, 0xE9, 0xAA, 0xBB, 0x60, 0xF6, 0x3A, 0x42, 0x85, 0x27, 0x6B, 0xBB,
-    0x79, 0xAF, 0x18, 0xFD, 0x17, 0x87, 0x77, 0x57, 0x84, 0x18, 0xEA, 0x69, 0x0C, 0x1D, 0x20, 0xF6,
-    0x79, 0x3D, 0x14, 0x35, 0xEC, 0xE9, 0x79, 0x37, 0x1E, 0x23, 0xB3, 0x17, 0x0D, 0x1F, 0xE9, 0x82,
-    0x1F, 0xE2, 0x00, 0x34, 0x79, 0xFB, 0x26, 0xFA, 0x97, 0x4F, 0xD0, 0x0A, 0x78, 0xC5, 0xBE, 0xBB,
-    0x33, 0x3A, 0xBA, 0x5D, 0xFD, 0xA7, 0x02, 0xF0, 0xC9, 0x59, 0xFD, 0x77, 0x14, 0x3B, 0x44, 0x87,
-    0xDC, 0xC9, 0xCE, 0xED, 0x01, 0xA8, 0xE9, 0x3F, 0xCD, 0x5B, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0x3E,
-    0x00, 0x76, 0x09, 0x9B, 0x98, 0x31, 0x58, 0x98, 0x23, 0x8F, 0x28, 0x12, 0x2E, 0x54, 0x31, 0x2B,
-    0x21, 0x85, 0x0B, 0x7A, 0x66, 0xB5, 0x40, 0x46, 0x7F, 0x80, 0xB7, 0xD0, 0xDA, 0x85, 0x27, 0x13,
-    0x17, 0x49, 0x93, 0x14, 0xAB, 0x62, 0x0B, 0x4E, 0x86, 0xFB, 0x1E, 0x22, 0x95, 0x29, 0xAC, 0x4A,
-    0x8D, 0x0B, 0xB3, 0x90, 0x67, 0xE8, 0xC7, 0x82, 0x2C, 0x58, 0x70, 0xE2, 0x5D, 0x02, 0x1E, 0x15,
-    0x2A, 0xD4, 0x60, 0xA2, 0xC9, 0xA4, 0x34, 0x62, 0x4B, 0x93, 0x49, 0x94, 0x89, 0x41, 0x0B, 0x8A,
-    0xB1, 0x8F, 0x78, 0x0F, 0xF9, 0xBE, 0x73, 0x81, 0xB7, 0x58, 0x51, 0x22, 0xB5, 0xDC, 0x7D, 0x2B,
-    0x3E, 0xBE, 0x7B, 0xDE, 0x12, 0xB8, 0x38, 0xF7, 0x9C, 0x73, 0xCF, 0x3D, 0xBF, 0xEE, 0x85, 0x9C,
-    0x9F, 0xBC, 0x27, 0x22, 0x7E, 0x5B, 0xC9, 0x17, 0x3E, 0xAF, 0x2A, 0x1C, 0x2B, 0x4C, 0x63, 0xC2,
-    0x3F, 0x26, 0x00, 0xD6, 0xEF, 0x32, 0x40, 0xE7, 0x83, 0x9C, 0xF0, 0xED, 0x12, 0xD0, 0x7B, 0x9D,
-    0xD0, 0xB7, 0x6A, 0xC0, 0xEF, 0x48, 0x03, 0xB8, 0x26, 0xFB, 0x80, 0xEB, 0x32, 0x02, 0xDC, 0xDD,
-    0x22, 0x8A, 0xB4, 0x6D, 0x81, 0xA2, 0x90, 0x20, 0x11, 0x2B, 0x17, 0x3F, 0x13, 0x27, 0x13, 0x2F,
-    0x17, 0x27, 0x11, 0xA7, 0x14, 0x4F, 0x61, 0x90, 0x8B, 0x37, 0x93, 0xB6, 0x91, 0x71, 0x9B, 0xD8,
-    0x93, 0x5B, 0xE2, 0xB6, 0xCD, 0x82, 0x16, 0x2B, 0x2D, 0xC4, 0x9F, 0x36, 0x78, 0x3C, 0x12, 0x3F,
-    0x0E, 0xE5, 0x9C, 0x04, 0xB8, 0x1A, 0x00, 0x65, 0x18, 0x5B, 0x69, 0x1B, 0x07, 0x1F, 0x87, 0x71,
-    0x84, 0xFF, 0xEF, 0xA2, 0xED, 0xE3, 0xDA, 0xAE, 0x44, 0xF1, 0x08, 0x54, 0x47, 0x9F, 0xFE, 0x3C,
-    0xF7, 0xE6, 0x7E, 0x29, 0x9B, 0xE8, 0xFE, 0x6D, 0xF9, 0x3E, 0xA9, 0x95, 0xBB, 0x80, 0xEE, 0xA3,
-    0x82, 0x68, 0x5B, 0xF2, 0x22, 0xDF, 0x7D, 0x5E, 0xB8, 0x8E, 0xBF, 0x85, 0x1E, 0xEB, 0x62, 0x4D,
-    0x81, 0x14, 0x1C, 0xCB, 0xEA, 0x29, 0x72, 0xFF, 0x8D, 0x72, 0xC6, 0x71, 0x28, 0x70, 0x71, 0xF9,
-    0xA7, 0xF8, 0x4A, 0x44, 0x60, 0xA0, 0x92, 0xE2, 0xB7, 0x84, 0xF6, 0xFC, 0x14, 0x78, 0xBD, 0x86,
-    0xB1, 0xC0, 0x80, 0x03, 0x86, 0x40, 0x94, 0x38, 0x18, 0xD7, 0xE1, 0x3C, 0xA7, 0x18, 0xDA, 0x82,
-    0x24, 0x3C, 0x5C, 0xF0, 0x13, 0x23, 0x8F, 0xEB, 0x87, 0x13, 0xEF, 0xB5, 0x85, 0x8C, 0xDF, 0x9D,
-    0xD9, 0x95, 0xA4, 0x6E, 0x21, 0x11, 0x58, 0x7A, 0x05, 0xCC, 0x01, 0x3B, 0x9A, 0x98, 0x36, 0x1E,
-    0xB4, 0xFE, 0x1A, 0xEF, 0x87, 0xE8, 0x87, 0xFE, 0xE2, 0x95, 0x72, 0xCE, 0x69, 0x80, 0xB8, 0xFD,
-    0x14, 0x0C, 0x00, 0x9F, 0x6A, 0xD6, 0x1B, 0x18, 0x16, 0x42, 0x84, 0x44, 0xC4, 0xCD, 0x28, 0x51,
-    0x91, 0x95, 0x6E, 0xCC, 0x71, 0x21, 0xCE, 0x74, 0x8E, 0x67, 0x23, 0x09, 0xF1, 0x2F, 0x92, 0xCB,
-    0xB2, 0x41, 0x11, 0x7F, 0xA1, 0x6D, 0x74, 0x63, 0x41, 0x02, 0xE8, 0xEB, 0x8A, 0x3B, 0x4F, 0xA1,
-    0xBA, 0x75, 0xA7, 0x1F, 0x1C, 0x63, 0x0E, 0xD9, 0x61, 0x42, 0xDC, 0x0F, 0x32, 0xCC, 0x5B, 0x09,
-    0xFC, 0x17, 0x96, 0xCA, 0xD3, 0x2A, 0x3B, 0x64, 0x4A, 0xBF, 0x54, 0x95, 0xD8, 0xF9, 0x9A, 0x58,
-    0x3D, 0x53, 0xA7, 0xC2, 0x93, 0x74, 0xBD, 0x1E, 0xA0, 0xED, 0x1F, 0x5D, 0xA1, 0x4B, 0x9B, 0x27,
-    0x31, 0x6A, 0x11, 0x64, 0xA6, 0xD3, 0xEA, 0xC0, 0x28, 0x9C, 0x06, 0x4F, 0x17, 0xF0, 0xEF, 0x8A,
-    0x8D, 0x35, 0xF1, 0xCF, 0x58, 0x1D, 0xD0, 0x76, 0x6B, 0x66, 0x74, 0x63, 0x89, 0x3C, 0x71, 0x4E,
-    0xEC, 0x7C, 0x5D, 0xE7, 0x48, 0xE7, 0x2A, 0x1C, 0xF0, 0x75, 0x3A, 0x3C, 0x81, 0x82, 0xEB, 0x5C,
-    0xD3, 0x61, 0x48, 0xF1, 0xD1, 0x56, 0x38, 0x34, 0x1B, 0xD6, 0x66, 0x37, 0x4A, 0xDA, 0x4E, 0x63,
-    0xD9, 0x9E, 0xDE, 0xA9, 0xC4, 0x2D, 0xAD, 0x39, 0x17, 0x41, 0x94, 0x00, 0xF8, 0x19, 0xCD, 0x44,
-    0x01, 0xE0, 0x94, 0x04, 0x55, 0x0F, 0xEC, 0xFA, 0x08, 0x38, 0xBC, 0xA1, 0xFD, 0xF4, 0x09, 0x3F,
-    0x07, 0x08, 0x89, 0x25, 0x95, 0xE0, 0xF3, 0xED, 0x5A, 0xDA, 0x56, 0x0D, 0x8C, 0x19, 0xAF, 0xAC,
-    0x29, 0x0B, 0xAE, 0xFF, 0x87, 0x5C, 0xF8, 0x0F, 0x69, 0x01, 0x1E, 0xC6, 0x66, 0xF9, 0xA5, 0x30,
-    0x6F, 0x6E, 0xFB, 0x19, 0x51, 0x84, 0x40, 0x11, 0xC3, 0x5A, 0x44, 0xA0, 0x0B, 0x3C, 0xE2, 0xEE,
-    0x88, 0x60, 0xF7, 0x28, 0xD0, 0x1B, 0xDA, 0x25, 0xA2, 0x80, 0x83, 0x24, 0x00, 0x0D, 0xD3, 0xFF,
-    0x3B, 0xC0, 0x62, 0xFB, 0x57, 0x2C, 0xB7, 0x95, 0xE3, 0x32, 0x78, 0x7B, 0xFA, 0x9E, 0x5D, 0xA7,
-    0x6D, 0x7D, 0x22, 0x06, 0x45, 0x27, 0xDB, 0x70, 0x74, 0xFE, 0x36, 0x46, 0x57, 0xA0, 0xFF, 0xBD,
-    0x48, 0xB4, 0xED, 0x47, 0x40, 0x31, 0xFD, 0x4D, 0x47, 0xAE, 0x12, 0xBE, 0x41, 0x16, 0xBE, 0x8C,
-    0xC1, 0x91, 0xE1, 0xF2, 0x08, 0x83, 0xFE, 0x51, 0x06, 0x65, 0x32, 0x89, 0x65, 0x48, 0x40, 0xDB,
-    0xD6, 0xDB, 0xD3, 0x49, 0x83, 0x67, 0x6E, 0xE0, 0xE1, 0x75, 0xB4, 0x35, 0xB4, 0x15, 0x8E, 0xBF,
-    0x68, 0xD3, 0x49, 0xE2, 0xE0, 0x99, 0x23, 0xD7, 0x0E, 0x9B, 0x47, 0x26, 0xE9, 0x21, 0x82, 0xCF,
-    0xB7, 0x80, 0xAE, 0x6D, 0xBF, 0xE8, 0xEE, 0x8D, 0x72, 0x36, 0x9D, 0x72, 0xAA, 0x2B, 0xC8, 0x36,
-    0xD0, 0x46, 0x68, 0xE3, 0xB6, 0xCD, 0x46, 0x5B, 0x5B, 0xF1, 0xE8, 0x88, 0x72, 0x72, 0x11, 0xB8,
-    0xB1, 0x3B, 0x4D, 0x41, 0x20, 0x34, 0xC0, 0xC2, 0xC5, 0x77, 0x6C, 0x91, 0xD2, 0x13, 0x19, 0xC1,
-    0x88, 0x84, 0xBC, 0x16, 0x2F, 0x8F, 0x7E, 0x75, 0xDC, 0x6B, 0x8F, 0x39, 0xEE, 0x53, 0xE1, 0x83,
-    0x1F, 0x75, 0x62, 0x1D, 0x01, 0xB2, 0x3C, 0x3E, 0x16, 0x0E, 0x99, 0x56, 0x85, 0x16, 0xE8, 0x31,
-    0x23, 0x78, 0x32, 0x5E, 0x96, 0x43, 0x33, 0x8C, 0xAA, 0x46, 0x14, 0xAF, 0x0E, 0x46, 0x0F, 0x60,
-    0x5D, 0xDD, 0xE6, 0xC4, 0x34, 0xBB, 0x40, 0xED, 0xC5, 0x06, 0x3D, 0xE3, 0x10, 0xFF, 0xDF, 0x68,
-    0xAC, 0xF1, 0xC7, 0xDF, 0x61, 0x1A, 0xC0, 0x50, 0x89, 0x1B, 0xAF, 0xC1, 0xC0, 0x06, 0xE8, 0x0B,
-    0x6B, 0xB2, 0x4C, 0x1D, 0xA3, 0x31, 0x67, 0x70, 0x28, 0x0F, 0xD1, 0x61, 0x0C, 0xBA, 0xA2, 0xEC,
-    0x94, 0xF5, 0xEC, 0xA2, 0x62, 0x22, 0x07, 0x0C, 0x97, 0xEC, 0xDF, 0x43, 0xE7, 0xDC, 0xF8, 0x1E,
-    0xA3, 0x95, 0x3E, 0x5E, 0x39, 0xD7, 0x1E, 0xA0, 0xC7, 0xAF, 0xD2, 0x04, 0xB1, 0x61, 0x90, 0xC1,
-    0x55, 0x79, 0x19, 0x7C, 0x8F, 0x9B, 0x50, 0x55, 0xD4, 0x1B, 0x29, 0x76, 0x03, 0xC6, 0x43, 0x30,
-    0xB9, 0x15, 0x71, 0x20, 0x00, 0x3F, 0x47, 0x3F, 0x3F, 0x83, 0x82, 0xF9, 0x7C, 0xD6, 0xCF, 0x10,
-    0x8E, 0xF9, 0x99, 0x5D, 0xD3, 0x89, 0xA5, 0xBF, 0xDA, 0x46, 0x14, 0xD9, 0x22, 0x98, 0x51, 0xC6,
-    0x18, 0x65, 0x04, 0x64, 0x14, 0x0C, 0xDF, 0xDF, 0x43, 0x00, 0x79, 0x45, 0x3A, 0x4A, 0xFF, 0x56,
-    0xB6, 0x7F, 0xDF, 0xD8, 0xD3, 0x74, 0xCF, 0xCD, 0xC3, 0x15, 0xE0, 0x89, 0xD1, 0x12, 0xFD, 0x87,
-    0x5F, 0x2F, 0x0B, 0x62, 0xA7, 0xC0, 0x50, 0xF0, 0x52, 0xD6, 0x27, 0x31, 0x63, 0x52, 0x0D, 0x3B,
-    0x9D, 0x76, 0x0A, 0xCF, 0xD5, 0xE6, 0x6E, 0xDB, 0x96, 0xA1, 0x58, 0x15, 0xFD, 0xE2, 0x0D, 0xD3,
-    0x4A, 0x18, 0xFA, 0x22, 0xF8, 0xE4, 0x4E, 0x62, 0xD3, 0xB3, 0x9D, 0x93, 0x97, 0xC9, 0xF9, 0x0E,
-    0x1E, 0x79, 0xC4, 0xF5, 0xD6, 0xE6, 0x83, 0x90, 0xED, 0x6C, 0x65, 0x60, 0x25, 0xDF, 0x46, 0x7C,
-    0x7D, 0x19, 0x01, 0x1E, 0x8C, 0xE3, 0xB8, 0xEC, 0x0D, 0xC2, 0x72, 0xF9, 0x37, 0x9F, 0x50, 0x7A,
-    0x7E, 0xA8, 0x2D, 0x47, 0x2C, 0xC1, 0x59, 0x2B, 0x82, 0x86, 0x66, 0xD9, 0x61, 0xB3, 0x16, 0x74,
-    0x9C, 0x81, 0x20, 0xCE, 0x9E, 0xD5, 0x0E, 0xD9, 0x6B, 0x04, 0x37, 0x08, 0x76, 0x08, 0x34, 0xA2,
-    0x62, 0x58, 0x8F, 0x65, 0x69, 0x17, 0x26, 0xBF, 0xF1, 0x32, 0xB3, 0x4A, 0x96, 0x2E, 0x88, 0x8B,
-    0xB2, 0xB0, 0x0D, 0x6A, 0x1C, 0x60, 0x1D, 0x4A, 0xCD, 0xE6, 0x4C, 0x02, 0xB5, 0x72, 0x18, 0x1C,
-    0xC4, 0xE3, 0x36, 0xDB, 0x9E, 0xC9, 0xA5, 0x79, 0xEC, 0x32, 0xB0, 0xA1, 0x29, 0xB3, 0x9F, 0x0A,
-    0xA7, 0x93, 0xDB, 0x80, 0x30, 0x72, 0x5F, 0xB3, 0x7F, 0x0F, 0x81, 0x3F, 0x38, 0x90, 0x4B, 0x33,
-    0xC6, 0x27, 0x63, 0xD2, 0x45, 0x21, 0x39, 0x8C, 0x23, 0x5C, 0x0A, 0xD4, 0xFF, 0x11, 0x08, 0x5E,
-    0x67, 0x12, 0x78, 0xA1, 0x73, 0x9A, 0xBA, 0x86, 0x18, 0xEE, 0x74, 0xAE, 0xF4, 0x31, 0x80, 0x24,
-    0xD1, 0xF9, 0x73, 0x0B, 0xCC, 0x73, 0xBB, 0x61, 0x28, 0xDB, 0xF0, 0xC6, 0xFE, 0x97, 0x44, 0x4E,
-    0x4F, 0x00, 0x97, 0x0E, 0x20, 0xA9, 0x31, 0x24, 0x51, 0x3C, 0x59, 0x1C, 0xB4, 0xEA, 0x6D, 0xF6,
-    0xD3, 0xCF, 0xB7, 0x7E, 0x72, 0x10, 0x2F, 0x47, 0x1C, 0x8F, 0x33, 0xFC, 0x0F, 0xD3, 0x5B, 0x1D,
-    0xE8, 0x18, 0x46, 0xE6, 0xE3, 0xFC, 0x09, 0x16, 0xCE, 0x79, 0xC4, 0x31, 0x1B, 0x32, 0x5C, 0xC9,
-    0xDE, 0xB3, 0x32, 0x0C, 0x15, 0x8E, 0x8A, 0x1F, 0xFC, 0xCB, 0xBC, 0x2C, 0xA2, 0xDC, 0x2C, 0xD3,
-    0xB0, 0xCD, 0x2F, 0xB5, 0x31, 0x13, 0xE0, 0x63, 0x7E, 0xDD, 0x79, 0x1C, 0xB5, 0x44, 0x18, 0x96,
-    0xD7, 0xFE, 0x71, 0x7E, 0xEF, 0x6E, 0x58, 0x18, 0x84, 0xE7, 0x6F, 0x89, 0x67, 0xFA, 0xEC, 0x3D,
-    0xF1, 0xBB, 0x2F, 0xAB, 0x6D, 0x1C, 0xB4, 0x25, 0xC2, 0xD7, 0x45, 0xF4, 0x8A, 0xF9, 0xC0, 0x64,
-    0x70, 0x26, 0x8E, 0xF9, 0x85, 0x58, 0x81, 0x44, 0x51, 0x75, 0x8A, 0x74, 0xF5, 0x26, 0x08, 0x53,
-    0xD1, 0x3F, 0xF9, 0x5B, 0xC9, 0x0B, 0x33, 0xC1, 0x64, 0x6C, 0xDA, 0xF1, 0x5D, 0x2F, 0x8E, 0x10,
-    0xD1, 0x37, 0x5D, 0x94, 0x70, 0x42, 0x62, 0x7E, 0x66, 0xC7, 0x3B, 0x6E, 0x87, 0xD0, 0x68, 0xF7,
-    0x71, 0x49, 0x3A, 0x21, 0x01, 0x56, 0xC1, 0xD0, 0xC8, 0x57, 0x4F, 0x81, 0x98, 0xD1, 0x9F, 0x8B,
-    0x3D, 0xD3, 0x22, 0x4E, 0xAF, 0xE8, 0xFD, 0x9A, 0x3B, 0x36, 0x61, 0x72, 0x57, 0xCB, 0x49, 0xC0,
-    0x19, 0x33, 0x25, 0x47, 0xC0, 0x65, 0xB5, 0x5D, 0x14, 0x6C, 0xA8, 0x5D, 0x60, 0x3E, 0x21, 0x0B,
-    0xC7, 0x97, 0xD8, 0x8F, 0xDA, 0x6A, 0x7B, 0x76, 0x0E, 0x26, 0xB3, 0x84, 0x89, 0xEF, 0x33, 0xC4,
-    0xD3, 0x02, 0x20, 0x6A, 0x83, 0x64, 0x31, 0x4C, 0xD3, 0x58, 0x4D, 0x0B, 0x6E, 0x9A, 0x86, 0x53,
-    0xA3, 0x45, 0x2B, 0x72, 0x97, 0xB8, 0x6E, 0x47, 0x46, 0x00, 0xA0, 0x6D, 0x0F, 0xB2, 0x9E, 0xE1,
-    0xE9, 0x06, 0x32, 0x59, 0x54, 0x49, 0xAE, 0xDE, 0x3C, 0x7F, 0x2B, 0x2C, 0xBD, 0x86, 0xD7, 0xD9,
-    0xE7, 0x6B, 0x35, 0x2C, 0x7B, 0x70, 0xB9, 0x07, 0x36, 0xF7, 0xBA, 0xF1, 0xFA, 0x06, 0x05, 0xB3,
-    0x2A, 0x8C, 0x0C, 0xAF, 0xB3, 0x11, 0xD3, 0x17, 0xA4, 0xF4, 0x02, 0xCE, 0x47, 0x85, 0x17, 0xDF,
-    0x33, 0xA5, 0x26, 0xAF, 0xAD, 0x20, 0x14, 0x7A, 0xBD, 0xE8, 0x04, 0xDF, 0x91, 0x16, 0x7B, 0x1A,
-    0xB2, 0x48, 0x06, 0x37, 0x69, 0x8F, 0xBC, 0x19, 0x42, 0x60, 0x1A, 0x71, 0x63, 0xC2, 0x0F, 0x57,
-    0xFF, 0xB1, 0xBE, 0x35, 0x19, 0xB0, 0xB5, 0x26, 0x39, 0x52, 0xAD, 0xE1, 0x34, 0x22, 0x6A, 0xC6,
-    0x34, 0x86, 0x94, 0xFD, 0x3A, 0x01, 0x95, 0x16, 0xB9, 0x84, 0x53, 0x42, 0xF3, 0x9C, 0xF2, 0x0A,
-    0xAD, 0xE3, 0x75, 0x56, 0x0F, 0x58, 0xBC, 0xFB, 0x6C, 0x4E, 0x77, 0x99, 0xE2, 0x46, 0x83, 0xB8,
-    0xDB, 0x29, 0x7D, 0x04, 0xDC, 0xA5, 0xAB, 0x4F, 0xA8, 0x8B, 0x68, 0x09, 0xC6, 0x0C, 0xE6, 0xC3,
-    0x1C, 0xD3, 0xE8, 0xD5, 0x5C, 0x20, 0xED, 0x30, 0x64, 0xA2, 0x20, 0xE5, 0x3E, 0x01, 0x27, 0x50,
-    0xB4, 0x1A, 0xDA, 0xAB, 0xF1, 0xD3, 0xBC, 0xD2, 0x8B, 0x13, 0x52, 0xC5, 0xEA, 0x82, 0xC3, 0x71,
-    0xB5, 0xBE, 0xAA, 0xF4, 0xDD, 0x20, 0x60, 0xC2, 0xF0, 0x59, 0x45, 0xFA, 0x48, 0x69, 0x3D, 0xE6,
-    0xB5, 0x90, 0x5D, 0x58, 0x96, 0x2D, 0x75, 0x71, 0xC0, 0x93, 0xC1, 0x48, 0xCF, 0x69, 0xA4, 0xC3,
-    0x6C, 0x48, 0x95, 0x16, 0x6B, 0x38, 0x88, 0xAD, 0xF5, 0xDF, 0xAC, 0x8B, 0xB0, 0xFF, 0xFE, 0x26,
-    0x86, 0xDC, 0x3E, 0xC5, 0x21, 0x57, 0xBB, 0xA4, 0x72, 0xC3, 0x08, 0xC1, 0xCA, 0x0F, 0x49, 0xC0,
-    0x6C, 0xC8, 0xF6, 0xCC, 0xF0, 0xEF, 0x1C, 0xAF, 0x59, 0x83, 0x44, 0xE9, 0x68, 0x52, 0xB8, 0xAA,
-    0xB1, 0x19, 0x56, 0x0E, 0xAB, 0x93, 0x5D, 0xC0, 0x98, 0x96, 0xCF, 0x62, 0x29, 0xCC, 0x17, 0xAC,
-    0xA4, 0x6D, 0xB2, 0x14, 0x52, 0xFB, 0x8F, 0x33, 0x28, 0x5A, 0xBB, 0x71, 0x1F, 0x0E, 0x9E, 0x9C,
-    0xE8, 0x05, 0x76, 0x20, 0x77, 0x61, 0x56, 0x15, 0x33, 0x38, 0xB9, 0x0F, 0x4E, 0x30, 0x55, 0x56,
-    0xE1, 0x94, 0x56, 0x06, 0x3D, 0x8E, 0x4F, 0x81, 0x93, 0xB4, 0xBC, 0xEF, 0x96, 0xA5, 0x53, 0x16,
-    0xCE, 0xC3, 0xCC, 0x79, 0x18, 0x2F, 0x47, 0xC4, 0x35, 0x08, 0x86, 0x69, 0xB3, 0x58, 0x3F, 0xDB,
-    0xFC, 0xDA, 0x84, 0x3D, 0x55, 0x8C, 0xBB, 0x4E, 0xF9, 0xC0, 0x29, 0xF7, 0x11, 0x12, 0x3D, 0x03,
-    0x61, 0x3F, 0x40, 0x14, 0x85, 0xCE, 0x90, 0xB6, 0x53, 0x9B, 0xFA, 0x1C, 0x0B, 0x75, 0x7F, 0x78,
-    0x3A, 0x61, 0x51, 0x45, 0x6F, 0x69, 0x7D, 0xF9, 0x37, 0xB1, 0x1E, 0x65, 0x2C, 0x2A, 0x56, 0x12,
-    0x56, 0xF2, 0xC3, 0xA3, 0x77, 0x61, 0xAF, 0xDD, 0x99, 0x44, 0x1A, 0xE6, 0x69, 0x6E, 0xE0, 0xE8,
-    0x0E, 0x9E, 0xAB, 0x2B, 0xCB, 0x57, 0xCB, 0xF2, 0x8A, 0xF4, 0x39, 0x43, 0xB7, 0xD2, 0x0A, 0x84,
-    0x63, 0xF1, 0x76, 0x45, 0x8E, 0xDC, 0x86, 0xEB, 0xDE, 0x99, 0xD3, 0x12, 0x39, 0x60, 0x0D, 0xF0,
-    0x97, 0x19, 0xE1, 0xCF, 0x0B, 0xC2, 0xB7, 0x4B, 0xC2, 0xB7, 0x1A, 0xC2, 0x64, 0xA6, 0x30, 0x52,
-    0x18, 0x66, 0x84, 0x7E, 0x4E, 0xE8, 0x96, 0x84, 0x76, 0x4D, 0x28, 0x33, 0x85, 0x63, 0x85, 0x88,
-    0xD5, 0xA0, 0xC5, 0xB0, 0x91, 0xC1, 0xC7, 0x82, 0x8C, 0xA9, 0x9D, 0x69, 0xC6, 0x62, 0xAA, 0xC2,
-    0x7E, 0xDE, 0x6F, 0xFA, 0x68, 0x82, 0x73, 0x6F, 0x68, 0x07, 0xAF, 0xBE, 0x83, 0xF8, 0x3B, 0xFC,
-    0x8C, 0x71, 0xEF, 0x14, 0x21, 0x23, 0x4C, 0xEB, 0x3E, 0xF9, 0xDC, 0xE8, 0x40, 0xF9, 0x74, 0x50,
-    0xC1, 0x8F, 0xC0, 0x8B, 0x45, 0x49, 0xD4, 0x26, 0x51, 0xF9, 0x4D, 0x33, 0x3C, 0xFC, 0x68, 0x3E,
-    0x6D, 0xBC, 0x3A, 0xDC, 0xCD, 0x22, 0xAD, 0xD3, 0xE9, 0x39, 0x6D, 0xBE, 0x1F, 0xF3, 0x3B, 0x75,
-    0xEF, 0x77, 0x8C, 0xE1, 0x8D, 0xD5, 0xCC, 0xAF, 0xA8, 0xC5, 0x67, 0x06, 0x67, 0x3D, 0xD4, 0x47,
-    0x52, 0xBD, 0x19, 0xA9, 0xC5, 0x58, 0x7D, 0x5E, 0xB4, 0x46, 0x03, 0x8C, 0x2B, 0xDC, 0x3D, 0xF4,
-    0x3E, 0x64, 0x31, 0x5F, 0x0D, 0xA6, 0x06, 0x9A, 0x6F, 0x2C, 0x49, 0x6B, 0xBA, 0x8D, 0x52, 0x15,
-    0x43, 0xA4, 0xDE, 0x52, 0x73, 0x7D, 0x35, 0xCA, 0x80, 0x3A, 0xDC, 0x65, 0x1D, 0xAF, 0xD2, 0x01,
-    0x63, 0x1D, 0x91, 0x58, 0x46, 0x62, 0x10, 0x1E, 0x1B, 0x22, 0x67, 0x83, 0xBB, 0x1A, 0x1F, 0x57,
-    0x67, 0x2B, 0xC2, 0x7F, 0x32, 0xE2, 0x9E, 0x1B, 0x71, 0xC7, 0x84, 0x81, 0x11, 0x77, 0x41, 0xE8,
-    0x54, 0x84, 0x56, 0xA3, 0x22, 0x9E, 0x2B, 0x8C, 0x14, 0x06, 0x03, 0x71, 0x3B, 0x2A, 0x6E, 0xB3,
-    0x45, 0x2B, 0x03, 0x68, 0xAE, 0x18, 0xA5, 0x71, 0x06, 0xA2, 0xD8, 0x35, 0x52, 0xA7, 0x10, 0x28,
-    0x02, 0x0A, 0x80, 0xC2, 0xD6, 0x56, 0x3E, 0xA1, 0xE1, 0x3E, 0xE4, 0xBC, 0x11, 0x99, 0x18, 0x77,
-    0xD8, 0x76, 0x4D, 0x9C, 0x49, 0xEB, 0x8A, 0x90, 0xFF, 0xC5, 0xC9, 0x4D, 0x0C, 0xD5, 0x1E, 0x51,
-    0xE4, 0x4B, 0xDC, 0xD4, 0x4A, 0xDF, 0x9D, 0xA9, 0x39, 0x8C, 0xBD, 0xDC, 0x14, 0x53, 0x9C, 0x42,
-    0xE3, 0x0E, 0x48, 0xCF, 0xAE, 0x22, 0x86, 0xC8, 0x04, 0xCD, 0xF8, 0x4B, 0x40, 0x7F, 0xD7, 0xAE,
-    0xC3, 0xB8, 0x8F, 0x54, 0x80, 0xC5, 0xCB, 0x14, 0x9F, 0xCC, 0xB7, 0x66, 0x62, 0x36, 0xCE, 0x18,
-    0x47, 0xDB, 0x93, 0x5F, 0x43, 0xE2, 0xF3, 0xC3, 0xD1, 0xB7, 0x3F, 0xEE, 0xB6, 0xCB, 0xFC, 0x24,
-    0x84, 0x91, 0x8D, 0x30, 0x30, 0xA3, 0xF6, 0x11, 0x26, 0x70, 0x77, 0xD0, 0x78, 0x2D, 0x62, 0x30,
-    0x84, 0xFB, 0x2C, 0xBE, 0xB8, 0x1F, 0x8F, 0x63, 0x96, 0x5D, 0x34, 0x04, 0xF9, 0x96, 0xFC, 0x8C,
-    0xFB, 0xBF, 0x54, 0xE5, 0x3F, 0xE6, 0xDC, 0xB1, 0x4D, 0x86, 0x5B, 0x9B, 0x67, 0xCA, 0xDF, 0x63,
-    0x85, 0xC5, 0xD5, 0x53, 0xE4, 0x53, 0xDE, 0xB8, 0x48, 0x32, 0x18, 0x15, 0x16, 0x40, 0xEF, 0xBF,
-    0x05, 0xFC, 0x57, 0xA8, 0x3E, 0x2B, 0xD6, 0x37, 0xC2, 0xAC, 0xAC, 0xC2, 0xF3, 0x44, 0xB8, 0xBD,
-    0x0F, 0xED, 0xAD, 0xB0, 0xDE, 0xF3, 0xFB, 0xA0, 0x73, 0xF3, 0x14, 0x19, 0xEE, 0x99, 0xD2, 0x9D,
-    0xBA, 0xF4, 0xDD, 0x76, 0x92, 0x62, 0xDD, 0xC1, 0x1C, 0x78, 0x89, 0xC7, 0x8C, 0x03, 0x6B, 0x31,
-    0xD3, 0x1F, 0xB0, 0x37, 0x32, 0x65, 0xC3, 0x91, 0xF4, 0x29, 0x4F, 0xFF, 0x03, 0xBE, 0xC6, 0x93,
-    0xF7, 0xF4, 0x07, 0x78, 0xC7, 0x8B, 0x8B, 0x8F, 0xF7, 0x0C, 0xCD, 0xE3, 0x8A, 0x53, 0x0A, 0x1D,
-    0x41, 0x0A, 0x1D, 0x0F, 0x06, 0x73, 0xBE, 0x95, 0x6E, 0xFD, 0x14, 0x8B, 0x9A, 0xB4, 0x2C, 0x76,
-    0xB6, 0xB7, 0x0B, 0x6B, 0x1E, 0x83, 0x4D, 0xFF, 0x53, 0x88, 0xCA, 0x7F, 0x20, 0x4D, 0x48, 0xDB,
-    0xB2, 0x1F, 0x31, 0x5A, 0xD9, 0xD8, 0xE0, 0x24, 0x44, 0x23, 0x35, 0x83, 0x60, 0x15, 0xCF, 0x01,
-    0x1E, 0x6C, 0x6D, 0xED, 0xF2, 0x8A, 0xE8, 0x5D, 0xD1, 0x9E, 0xCC, 0x95, 0x1A, 0x59, 0x01, 0xFB,
-    0xAD, 0x5C, 0x86, 0x00, 0x82, 0xFF, 0x6E, 0x20, 0x02, 0xA7, 0xD5, 0xCA, 0xCC, 0x77, 0xFB, 0x32,
-    0xE1, 0xA8, 0x77, 0x38, 0xEA, 0x02, 0x9D, 0x44, 0x06, 0x32, 0x4A, 0x59, 0x4C, 0xDD, 0x9E, 0xDE,
-    0x41, 0x24, 0x5A, 0x9A, 0x9A, 0x95, 0x66, 0x4F, 0xB3, 0x45, 0x95, 0x6D, 0x7F, 0x71, 0xAD, 0xEE,
-    0x76, 0x4E, 0xA7, 0x77, 0xB8, 0x5F, 0x3E, 0x63, 0x20, 0x35, 0x48, 0x33, 0x34, 0x4D, 0xEB, 0xD2,
-    0x0C, 0x86, 0x83, 0x62, 0x76, 0x4B, 0x0F, 0x24, 0xCA, 0x31, 0x05, 0x5E, 0xA5, 0xDE, 0xC1, 0xAE,
-    0xCD, 0xCE, 0x19, 0x92, 0x17, 0xB9, 0x7C, 0x38, 0x4D, 0xB0, 0x5C, 0x71, 0xF8, 0x07, 0x24, 0xB0,
-    0x7F, 0xF6, 0x73, 0xBB, 0x71, 0x59, 0x88, 0x55, 0x4E, 0xB5, 0x95, 0x5F, 0xD1, 0x70, 0x0F, 0x96,
-    0x0B, 0xF1, 0x56, 0x7E, 0x96, 0x4C, 0x2C, 0x3E, 0x76, 0xD9, 0xED, 0x02, 0x1A, 0x33, 0xEC, 0xC6,
-    0x9D, 0x54, 0x4F, 0xCA, 0xCB, 0x10, 0xBF, 0x6E, 0x32, 0x76, 0xC9, 0x87, 0xCE, 0x18, 0x77, 0xB8,
-    0x74, 0x8B, 0x4B, 0x6E, 0xB0, 0x0E, 0x1D, 0x92, 0x20, 0x5F, 0x03, 0xB9, 0xF8, 0xAC, 0xE7, 0x93,
-    0x7B, 0x50, 0x6E, 0x72, 0xCF, 0xEC, 0x4A, 0x31, 0xE6, 0x65, 0x2D, 0xFA, 0xE2, 0xE9, 0xCC, 0xA7,
-    0x39, 0xA2, 0x33, 0xD0, 0x95, 0x2B, 0x32, 0x38, 0x78, 0x56, 0x89, 0xF7, 0x49, 0xCA, 0x23, 0x12,
-    0xF1, 0x06, 0x3C, 0xD3, 0x6B, 0xE2, 0xF7, 0x2B, 0x51, 0x03, 0xA5, 0x00, 0x78, 0x5C, 0x78, 0x66,
-    0x8B, 0xE7, 0xE7, 0x82, 0x39, 0x8F, 0x94, 0x75, 0x67, 0x63, 0xFC, 0xFC, 0x65, 0x98, 0x93, 0xEB,
-    0x68, 0x7B, 0x30, 0x4B, 0x23, 0x3C, 0x1B, 0x25, 0x0F, 0x58, 0x28, 0x31, 0x4B, 0x05, 0x16, 0x89,
-    0x56, 0x2F, 0xA1, 0xF3, 0xDB, 0xE9, 0x22, 0x60, 0xBB, 0x8D, 0x83, 0x5F, 0x94, 0xEB, 0x16, 0x72,
-    0x6C, 0x7C, 0xB9, 0x63, 0x07, 0x4F, 0xED, 0xCF, 0x81, 0x33, 0xE7, 0x40, 0x56, 0xFD, 0x7D, 0xD9,
-    0xBB, 0x27, 0x7B, 0xF7, 0xA5, 0x1E, 0x9D, 0x2B, 0x03, 0x58, 0x9A, 0x4D, 0x63, 0xB7, 0x07, 0x47,
-    0x71, 0xF4, 0xF8, 0x58, 0x57, 0x8F, 0x5F, 0x1A, 0xED, 0x68, 0x2D, 0x89, 0x75, 0x3F, 0xC8, 0x7C,
-    0x29, 0x4D, 0x05, 0xE8, 0x59, 0x68, 0x5F, 0x16, 0x8D, 0x6B, 0x62, 0x8A, 0x0D, 0x6E, 0xB7, 0x55,
-    0x82, 0x66, 0x41, 0x45, 0x05, 0x8F, 0x1E, 0x9B, 0xCC, 0x52, 0x83, 0xCD, 0x50, 0x53, 0x2A, 0x3F,
-    0x3E, 0x97, 0x8A, 0x5B, 0xCB, 0x62, 0x2B, 0xB6, 0x2A, 0x8D, 0xE0, 0x07, 0x5B, 0xB1, 0xCB, 0x12,
-    0x3A, 0xA4, 0x8C, 0x20, 0xD8, 0xFD, 0x30, 0x63, 0x00, 0x3C, 0xEF, 0x82, 0xDF, 0x67, 0x10, 0x7A,
-    0xC4, 0x3D, 0x87, 0xF1, 0xED, 0xF9, 0x9D, 0xEC, 0x86, 0x5D, 0x39, 0xD9, 0x8E, 0x5D, 0x59, 0xD9,
-    0x9B, 0x00, 0xF9, 0x05, 0x2C, 0x89, 0x58, 0xD7, 0xC5, 0x33, 0x03, 0x1A, 0x7D, 0x2E, 0x2A, 0x98,
-    0x05, 0xAE, 0x2A, 0xB5, 0x2E, 0xCD, 0x62, 0x3F, 0xCB, 0xEF, 0xCF, 0xFC, 0x9D, 0xE7, 0xA9, 0x2E,
-    0xAF, 0xDB, 0x5F, 0x2B, 0x18, 0x63, 0x62, 0xE1, 0x05, 0xD3, 0x64, 0xDC, 0xE6, 0xAE, 0xFE, 0xFD,
-    0xA4, 0x6F, 0x09, 0xD7, 0x04, 0xC7, 0x5B, 0x30, 0x7B, 0x84, 0x1B, 0xF5, 0x32, 0x96, 0x35, 0x9C,
-    0xDC, 0xBE, 0x93, 0xD9, 0xF3, 0x6E, 0x9F, 0x47, 0x77, 0x7C, 0x02, 0x8E, 0xE4, 0xCD, 0xFA, 0x03,
-    0x49, 0xBD, 0xB7, 0x3F, 0x4B, 0xFE, 0x4D, 0xF2, 0x55, 0x31, 0xF1, 0xFA, 0x8F, 0xCC, 0x2A, 0xE2,
-    0x67, 0xE1, 0x72, 0xF5, 0x19, 0x08, 0x76, 0x5B, 0xC6, 0xF2, 0x3F, 0x39, 0x78, 0xE3, 0xF8, 0x04,
-    0x7F, 0xF5, 0x6C, 0x44, 0x6D, 0xF6, 0x17, 0xD3, 0xE4, 0x09, 0x74, 0x76, 0x22, 0x76, 0x67, 0x2E,
-    0x8F, 0x8D, 0xA6, 0xFF, 0x0B, 0xF8, 0x92, 0x67, 0x8E, 0xF4, 0x6C, 0x2E, 0x8E, 0x90, 0xB4, 0x19,
-    0x72, 0x9B, 0x60, 0x1E, 0xBF, 0x70, 0xA0, 0x51, 0x85, 0x29, 0xE6, 0x17, 0xA7, 0x06, 0xC1, 0x15,
-    0xE8, 0x87, 0x29, 0x67, 0x35, 0x73, 0xAE, 0xDB, 0xA3, 0x11, 0xD6, 0x22, 0xEB, 0xD3, 0xF5, 0xE2,
-    0x84, 0x83, 0x2E, 0xD4, 0xA8, 0xF8, 0x4B, 0x91, 0x47, 0x73, 0x3C, 0x95, 0x8F, 0xB3, 0x41, 0xBA,
-    0xCB, 0xCA, 0xB9, 0x84, 0xA5, 0x37, 0x3B, 0xF6, 0xBE, 0xDF, 0x3E, 0xFD, 0x0A, 0xE4, 0x5E, 0x73,
-    0x17, 0xA4, 0xBD, 0x03, 0xDD, 0x8C, 0x1A, 0x64, 0xE2, 0xEA, 0x2A, 0x79, 0xBE, 0xA9, 0x2B, 0x96,
-    0x0E, 0x3F, 0xCF, 0x85, 0x38, 0xAE, 0x4E, 0x12, 0xA5, 0x64, 0x40, 0xD7, 0x92, 0x84, 0x20, 0xDF,
-    0xD3, 0x78, 0xF0, 0x1A, 0xFF, 0x7E, 0x54, 0x75, 0xA5, 0x85, 0x23, 0xA5, 0x86, 0xE7, 0x42, 0x20,
-    0x2F, 0x4B, 0xD2, 0xDB, 0x10, 0x84, 0x2A, 0xE2, 0xCD, 0x87, 0x2A, 0xBC, 0x1C, 0xD1, 0xC8, 0x55,
-    0x85, 0x7A, 0x26, 0xDD, 0xCE, 0xEE, 0x2A, 0xDC, 0xD1, 0xA2, 0xFC, 0x5D, 0xDD, 0x71, 0x57, 0x31,
-    0xBD, 0x18, 0x3F, 0x57, 0x62, 0xB2, 0xF5, 0xB5, 0x01, 0x9A, 0xF2, 0x97, 0xB8, 0xE2, 0xD7, 0x1C,
-    0x90, 0x77, 0xD9, 0xE3, 0x35, 0x0A, 0xCC, 0x7A, 0x6F, 0xB9, 0x02, 0xBB, 0xA8, 0xC7, 0x1E, 0x46,
-    0x3C, 0x0D, 0xC2, 0x64, 0x46, 0x34, 0x4B, 0x63, 0xF8, 0xAA, 0x45, 0x2E, 0x79, 0xBE, 0x44, 0x65,
-    0x6D, 0x72, 0x97, 0xBD, 0x04, 0x1B, 0xDE, 0x6F, 0xE9, 0xF5, 0x5F, 0x47, 0xDF, 0x75, 0x1E, 0x2B,
-    0xBB, 0xB0, 0xB2, 0x4C, 0x29, 0x29, 0xEF, 0x09, 0x8F, 0x1E, 0xCC, 0x62, 0x9A, 0x7A, 0xDD, 0xC8,
-    0x3C, 0x45, 0x68, 0x29, 0x4E, 0x78, 0x78, 0x56, 0x89, 0x1E, 0xE8, 0xE1, 0xF6, 0xE8, 0xBF, 0xF8,
-    0x66, 0x81, 0x6B, 0x78, 0x37, 0x27, 0xFB, 0x4D, 0xAD, 0xB3, 0x1A, 0xC0, 0xFA, 0xF0, 0x20, 0xAB,
-    0x04, 0xE5, 0x52, 0x98, 0xE7, 0x82, 0x21, 0x3D, 0xA6, 0x10, 0xEE, 0xF7, 0x67, 0xBB, 0xCD, 0x6B,
-    0x06, 0xB6, 0xAE, 0xE8, 0x3E, 0x87, 0xF1, 0xBB, 0x42, 0x6D, 0xD8, 0xA5, 0x5B, 0x9A, 0xEA, 0xD0,
-    0x15, 0x76, 0x59, 0x40, 0x3C, 0x48, 0xF0, 0xE1, 0x27, 0xC5, 0x4E, 0xEC, 0xB6, 0xDC, 0x3E, 0xC0,
-    0x54, 0x5B, 0x63, 0x6E, 0x03, 0x23, 0x75, 0x09, 0x48, 0x0B, 0xF0, 0x5C, 0xD1, 0x13, 0x18, 0xA5,
-    0xBC, 0x42, 0xCF, 0xFA, 0x6A, 0x45, 0xD6, 0x1B, 0xF9, 0x61, 0x2D, 0xD7, 0xF8, 0xBB, 0xD3, 0x30,
-    0xCE, 0xDF, 0x97, 0xBB, 0x7B, 0x7C, 0x01, 0x65, 0x24, 0xD0, 0xD7, 0x92, 0x91, 0x51, 0xB1, 0x41,
-    0xF1, 0x45, 0x7F, 0x95, 0x47, 0x54, 0xA1, 0xE0, 0xAD, 0x2C, 0x7C, 0x9D, 0xC1, 0xE0, 0xFB, 0x99,
-    0xFF, 0x36, 0x8F, 0x76, 0xBF, 0x9F, 0xF8, 0x1F, 0x80, 0x52, 0xEF, 0xDF, 0xC5, 0xFB, 0x90, 0x4C,
-    0x7D, 0x2A, 0xEE, 0xEF, 0xA8, 0xE8, 0x73, 0x71, 0xE8, 0x62, 0xC1, 0xB8, 0x43, 0x07, 0x8E, 0x8C,
-    0xC9, 0x6A, 0xBA, 0x78, 0xAB, 0x1E, 0x38, 0x5D, 0xC7, 0xB8, 0x1C, 0x0D, 0x84, 0x80, 0xCD, 0xBC,
-    0x72, 0xB1, 0x6E, 0x4A, 0x79, 0x17, 0x0E, 0x97, 0x89, 0xC0, 0x41, 0xDD, 0xB4, 0x27, 0x49, 0x5A,
-    0x5B, 0xA5, 0xDD, 0x26, 0x7A, 0x38, 0x69, 0x9D, 0xD5, 0x94, 0x06, 0xC4, 0xBB, 0xB9, 0xBB, 0x0F,
-    0xDA, 0x9D, 0xC2, 0xDB, 0xE0, 0xCE, 0x7C, 0xF9, 0x9D, 0x50, 0x15, 0xFF, 0xA5, 0x20, 0x06, 0xC1,
-    0xF5, 0x9A, 0xFF, 0x16, 0xB0, 0x35, 0xD7, 0xBC, 0xF7, 0xF1, 0xB3, 0xF7, 0xA6, 0xFB, 0x11, 0x90,
-    0xEE, 0xDE, 0x75, 0xFE, 0x93, 0x75, 0xBD, 0xC2, 0x7E, 0xA4, 0xE9, 0x89, 0x45, 0x89, 0x07, 0x99,
-    0x06, 0x83, 0x98, 0x91, 0xBD, 0xC5, 0x4B, 0x37, 0xA9, 0xBE, 0x84, 0xC3, 0xA3, 0x48, 0x1F, 0xF1,
-    0x10, 0x67, 0x5C, 0xCA, 0xE2, 0xDD, 0x05, 0x44, 0x1C, 0x49, 0x3A, 0x0B, 0x66, 0xF1, 0xDF, 0xD4,
-    0xCC, 0x09, 0x73, 0xB0, 0xE7, 0x26, 0x98, 0x6C, 0x9F, 0x42, 0xBB, 0xC2, 0x22, 0xC8, 0x3A, 0x4B,
-    0x20, 0x3B, 0x0C, 0xF3, 0x99, 0xBC, 0xFE, 0x89, 0x07, 0xC3, 0x1E, 0x71, 0x92, 0xDB, 0x45, 0x15,
-    0xE2, 0x2B, 0xC1, 0x58, 0xC7, 0x7D, 0x87, 0x35, 0xA2, 0xBA, 0xDB, 0x97, 0xD0, 0xED, 0x13, 0x3D,
-    0xC1, 0xFE, 0x2A, 0xED, 0xC9, 0x75, 0xF3, 0xA6, 0x4A, 0xDC, 0x8B, 0xE7, 0xDC, 0x24, 0x4E, 0xEB,
-    0x73, 0x6D, 0x8C, 0xE9, 0xDE, 0x63, 0xE6, 0x76, 0x8F, 0xF1, 0x0F, 0x4F, 0x07, 0xE8, 0xF2, 0xB7,
-    0x29, 0x02, 0x4A, 0x75, 0x97, 0xC9, 0xF3, 0x06, 0xCD, 0x60, 0x48, 0xAD, 0xF3, 0xFF, 0x9A, 0xE0,
-    0x7F, 0x38, 0x71, 0x75, 0x3F, 0x86, 0xA6, 0xF2, 0xF6, 0x61, 0x2A, 0xBF, 0x50, 0x53, 0x96, 0x41,
-    0x5F, 0x20, 0x01, 0xD1, 0x3B, 0x7A, 0xF0, 0x2C, 0xBE, 0x89, 0x1B, 0xBF, 0xAD, 0x3B, 0x60, 0xC7,
-    0x9B, 0x03, 0x45, 0x3C, 0x3B, 0xE1, 0xE8, 0x44, 0xCD, 0xCC, 0x09, 0x00, 0xA7, 0x3B, 0x0E, 0xBB,
-    0xB2, 0x88, 0xA5, 0xAB, 0xF1, 0xE4, 0x76, 0x75, 0x43, 0xBC, 0x72, 0x07, 0x0B, 0xE1, 0x4D, 0x64,
-    0x5D, 0x17, 0xF4, 0x71, 0xF4, 0xB7, 0x1B, 0xC3, 0x2F, 0x5F, 0xB7, 0xE1, 0x3B, 0x15, 0x3C, 0x2A,
-    0x97, 0x76, 0xB7, 0xEA, 0xAE, 0xD0, 0x9B, 0xCB, 0x1A, 0x32, 0x9F, 0x35, 0xA4, 0x07, 0xEB, 0xED,
-    0xD6, 0x8F, 0x1B, 0x44, 0xBA, 0x8D, 0x66, 0x36, 0x7C, 0xCE, 0xCD, 0x8D, 0x58, 0x5E, 0x39, 0xDC,
-    0xC2, 0xBA, 0x3A, 0x99, 0x70, 0x4C, 0xA8, 0xE4, 0xBE, 0xBC, 0x09, 0x96, 0x2F, 0xD0, 0x06, 0x7B,
-    0x79, 0x87, 0xDF, 0xBC, 0x2A, 0xD2, 0xBF, 0x6A, 0xE3, 0x15, 0xB6, 0xBE, 0xAF, 0x10, 0x89, 0x27,
-    0xE9, 0x24, 0x95, 0xC5, 0x4E, 0xAB, 0x1E, 0xE9, 0x2D, 0x4C, 0x72, 0x68, 0xC5, 0x03, 0x81, 0x2E,
-    0x83, 0x97, 0x6E, 0xDF, 0x47, 0x5F, 0xD4, 0x88, 0x8F, 0x1C, 0xA2, 0x3C, 0x31, 0x2F, 0x7A, 0xFC,
-    0x38, 0x30, 0xF6, 0x8A, 0xB6, 0xCB, 0x3F, 0xE4, 0x67, 0x19, 0xBC, 0x98, 0x9C, 0xF7, 0xBA, 0xD9,
-    0x2A, 0xE2, 0x46, 0x51, 0x74, 0x78, 0x3C, 0xFC, 0xC4, 0xBC, 0x70, 0x01, 0x46, 0xF8, 0xAD, 0xC3,
-    0xD8, 0x2A, 0x7D, 0x53, 0x8C, 0x3A, 0x61, 0xBB, 0x74, 0x60, 0xB2, 0x9A, 0xFF, 0x07, 0xDD, 0x5B,
-    0xBF, 0x8F, 0xE4, 0xF4, 0x15, 0x7F, 0xB6, 0xF7, 0xD6, 0x01, 0x8B, 0xF3, 0x16, 0x77, 0x22, 0xBA,
-    0x4D, 0x18, 0x0A, 0x8A, 0x04, 0x1D, 0xB8, 0xA1, 0x38, 0x29, 0xCB, 0xD9, 0x09, 0x65, 0x0A, 0xAE,
-    0x60, 0x95, 0x22, 0x45, 0x9A, 0x54, 0x29, 0xB2, 0x14, 0x14, 0x57, 0xEC, 0xEC, 0x38, 0xF0, 0x07,
-    0x70, 0x8A, 0x04, 0x29, 0x28, 0x72, 0x05, 0x91, 0x60, 0xAE, 0xD8, 0x93, 0x72, 0x12, 0x8B, 0x34,
-    0xCB, 0x38, 0xA4, 0xA0, 0x48, 0xE3, 0xFC, 0x20, 0x4D, 0x14, 0xC5, 0x22, 0x7B, 0x51, 0x04, 0x45,
-    0x9C, 0x60, 0xC2, 0xEC, 0x6A, 0x66, 0x9C, 0xCF, 0xE7, 0x3D, 0x7B, 0x66, 0x96, 0xEC, 0xC1, 0x9D,
-    0xD8, 0xBB, 0xDB, 0x64, 0x58, 0x7F, 0xBF, 0xBE, 0xEF, 0x78, 0xEC, 0xF7, 0xDE, 0xF7, 0xFD, 0xF8,
-    0xBC, 0xF7, 0x8C, 0x88, 0x88, 0x93, 0x60, 0x90, 0x30, 0x93, 0xD5, 0x3A, 0x0F, 0x73, 0x19, 0xBE,
-    0x3A, 0xF1, 0x72, 0xAF, 0x92, 0xE8, 0x99, 0x2C, 0xC8, 0x25, 0xFC, 0x13, 0xBF, 0xF1, 0x46, 0x12,
-    0xA5, 0xE2, 0x95, 0x12, 0x27, 0xE2, 0x56, 0x12, 0xE3, 0x47, 0x23, 0x1D, 0xC7, 0xD2, 0xBB, 0xC5,
-    0x38, 0xBB, 0xC6, 0xC5, 0x6F, 0x13, 0xFE, 0x96, 0xF7, 0x29, 0x05, 0xF7, 0x0C, 0x70, 0x52, 0x71,
-    0x51, 0xA6, 0xEB, 0x13, 0x3C, 0xBA, 0x53, 0x17, 0xA4, 0xE0, 0x8C, 0xE8, 0xC7, 0x69, 0xA8, 0xC1,
-    0x7A, 0x26, 0x1B, 0x7B, 0x41, 0xE6, 0x1D, 0x4C, 0xBD, 0x34, 0xCC, 0xC2, 0x97, 0x25, 0x12, 0x9F,
-    0x0F, 0xF7, 0x0A, 0xB9, 0xC8, 0x5B, 0x6D, 0x89, 0x5B, 0x4A, 0xF7, 0xF0, 0xA0, 0x5F, 0xC4, 0x1C,
-    0x22, 0x5E, 0x17, 0xE2, 0x87, 0xE2, 0xEF, 0xF5, 0xF0, 0xAC, 0x7A, 0xD4, 0xDE, 0x9C, 0x9F, 0x4B,
-    0x1C, 0xBC, 0xB2, 0x57, 0x67, 0xD1, 0x5F, 0xAB, 0xCE, 0x34, 0x79, 0xB8, 0xA8, 0x40, 0x93, 0x14,
-    0x25, 0x7E, 0x29, 0x1F, 0xE4, 0x1C, 0xA7, 0xBC, 0x8B, 0x14, 0x5F, 0x6A, 0x84, 0xB0, 0x9C, 0x82,
-    0x82, 0x70, 0x73, 0xDE, 0x10, 0x9C, 0x4B, 0x7C, 0x73, 0x88, 0x47, 0x07, 0x4A, 0x8E, 0x9C, 0x6D,
-    0xC8, 0x59, 0xD2, 0x31, 0xD6, 0xB1, 0x27, 0x8F, 0x5F, 0x7D, 0xF0, 0x8D, 0x48, 0xA2, 0x32, 0x98,
-    0x9C, 0xE6, 0x7D, 0x76, 0xD7, 0x38, 0xF6, 0x0A, 0xE3, 0x99, 0x63, 0xF7, 0x36, 0xC6, 0x5D, 0xA1,
-    0x3C, 0x26, 0xDC, 0x06, 0x97, 0x52, 0xAE, 0xB7, 0xB1, 0x79, 0x12, 0x8F, 0xE3, 0xB2, 0xDD, 0x72,
-    0xFD, 0xAC, 0x48, 0x7B, 0xBE, 0xE6, 0x65, 0xCD, 0x59, 0xF8, 0x6C, 0xBB, 0xE6, 0x4F, 0xDB, 0xEB,
-    0xBC, 0xB1, 0x1C, 0x92, 0x5D, 0xFB, 0x19, 0xD6, 0x07, 0x89, 0x84, 0x75, 0x3D, 0x95, 0x8D, 0x83,
-    0xED, 0x4A, 0xC2, 0x0F, 0xFB, 0x53, 0xF1, 0x4B, 0x67, 0x2A, 0x21, 0xB5, 0x80, 0x9B, 0x91, 0x9E,
-    0xA6, 0xFE, 0xA8, 0x02, 0x3C, 0x24, 0x41, 0xA9, 0x4A, 0x50, 0x2C, 0x09, 0x54, 0xCD, 0xD3, 0x7F,
-    0x34, 0xAA, 0x45, 0xF1, 0xF7, 0xA4, 0x3D, 0x9B, 0xE8, 0x19, 0x74, 0xC7, 0x1D, 0xB7, 0x67, 0x5C,
-    0xB6, 0xB3, 0xA0, 0x68, 0xAF, 0x83, 0x8A, 0x34, 0x67, 0x64, 0xCE, 0xEE, 0x37, 0xD4, 0x9D, 0xE5,
-    0x45, 0x13, 0x3B, 0x0B, 0x73, 0xFC, 0xC6, 0x57, 0x9D, 0x48, 0xFD, 0xD2, 0xCE, 0x86, 0x7C, 0x7E,
-    0x28, 0x9D, 0x4F, 0x36, 0xA0, 0x9E, 0xEF, 0xAF, 0xF7, 0xA4, 0xAE, 0xEB, 0x54, 0x62, 0x8C, 0x0D,
-    0x5F, 0x49, 0xAB, 0x2A, 0x65, 0x68, 0x3C, 0xCA, 0xDA, 0x9A, 0xB1, 0x28, 0x9D, 0x91, 0x71, 0x28,
-    0x61, 0x69, 0x0C, 0x52, 0x9E, 0xA6, 0xE0, 0xED, 0xA3, 0x1F, 0xEC, 0xF7, 0x53, 0xA5, 0x06, 0x92,
-    0xC9, 0x94, 0x40, 0x3C, 0x4B, 0x57, 0xAA, 0x87, 0x4C, 0x3D, 0xDD, 0xD1, 0x57, 0xB0, 0x45, 0xC6,
-    0x8F, 0x33, 0x6A, 0x59, 0x2C, 0x1B, 0x6E, 0x82, 0xBC, 0x65, 0x30, 0x6D, 0x16, 0xE3, 0x96, 0xA9,
-    0xDD, 0x86, 0x27, 0xFC, 0xE8, 0x8A, 0xB2, 0x84, 0x21, 0x57, 0x8E, 0x82, 0xDC, 0xC9, 0x95, 0xA1,
-    0xCE, 0x87, 0xD7, 0x72, 0xE5, 0x27, 0xAA, 0xEB, 0x7C, 0xBE, 0xCB, 0xC3, 0x52, 0x2E, 0xF8, 0xA9,
-    0x70, 0x0F, 0x3A, 0x9D, 0x86, 0xD2, 0xB1, 0xCD, 0xDE, 0xC8, 0x66, 0xE7, 0x92, 0xCD, 0xBA, 0xB3,
-    0x2F, 0x95, 0x6E, 0xBF, 0x7F, 0xD5, 0xAF, 0x3F, 0x2E, 0xFD, 0xBA, 0x2E, 0xC3, 0x3C, 0x2A, 0xFD,
-    0x34, 0xC8, 0xA3, 0x24, 0x2C, 0x7D, 0xD0, 0x15, 0x53, 0x08, 0x20, 0x4B, 0x2D, 0x0E, 0x54, 0x6D,
-    0xE9, 0xEF, 0x47, 0xD0, 0x3E, 0x23, 0xB8, 0xDB, 0x58, 0xBB, 0xCE, 0x60, 0xA3, 0xB1, 0x4C, 0xE1,
-    0xEF, 0x70, 0xF9, 0xA3, 0x31, 0xE8, 0xC0, 0xE5, 0xCF, 0x77, 0xD2, 0x0E, 0x8D, 0xEE, 0x7A, 0x70,
-    0xF0, 0xEF, 0xFD, 0xE0, 0xE0, 0x5A, 0xE9, 0xD6, 0xBF, 0xAB, 0x9F, 0xC5, 0xF3, 0x1A, 0x9B, 0x80,
-    0xF0, 0x13, 0x5A, 0xCB, 0x06, 0x36, 0xF3, 0x54, 0xFD, 0x07, 0xBF, 0x54, 0x3B, 0xF1, 0x8E, 0x79,
-    0x72, 0x6C, 0x0A, 0x6C, 0x0A, 0x0F, 0x4D, 0x1D, 0x4C, 0x9D, 0x4F, 0xD6, 0x87, 0x98, 0x6A, 0xEA,
-    0x87, 0x59, 0xE9, 0xD1, 0x53, 0xD7, 0x26, 0xB3, 0x95, 0x55, 0x93, 0x63, 0x9C, 0x2C, 0xDA, 0xCB,
-    0x98, 0xFC, 0xC8, 0x98, 0xEC, 0xC8, 0x58, 0xB9, 0x59, 0x31, 0x79, 0xCF, 0xC7, 0x07, 0xDF, 0xE0,
-    0x18, 0x8C, 0x75, 0xC5, 0xC6, 0xC1, 0x17, 0x8E, 0x8E, 0x8E, 0x81, 0x8E, 0xE1, 0xC2, 0xD8, 0x91,
-    0x81, 0x12, 0x3F, 0x50, 0xDA, 0x07, 0x4A, 0xC3, 0xE2, 0x68, 0xA4, 0xAA, 0x33, 0x72, 0x95, 0x82,
-    0x55, 0xD5, 0x98, 0x8B, 0x4A, 0x34, 0x34, 0x86, 0x34, 0x92, 0x06, 0x1E, 0x4A, 0xA9, 0x1D, 0xA4,
-    0x31, 0x68, 0xD7, 0x6F, 0xFB, 0x58, 0xDD, 0x27, 0xFF, 0xE9, 0xB8, 0x79, 0x6E, 0x7B, 0x8C, 0xEC,
-    0xD9, 0x1D, 0x3C, 0x79, 0x4B, 0x86, 0x05, 0xD4, 0xF6, 0xBB, 0xD8, 0xF0, 0x4A, 0x56, 0xF7, 0x9D,
-    0x7A, 0xCF, 0x1F, 0x8B, 0xC3, 0xC0, 0xE3, 0x4D, 0xE9, 0x50, 0xB1, 0x23, 0x90, 0x9F, 0xCE, 0x3F,
-    0xCF, 0x6C, 0x7E, 0xB9, 0xB0, 0xF9, 0xA5, 0xD2, 0xE6, 0x17, 0xC7, 0x36, 0xA7, 0x93, 0x66, 0x8E,
-    0x9B, 0x39, 0xCA, 0x6C, 0x0E, 0x73, 0x9B, 0xFD, 0xD2, 0x66, 0x77, 0x64, 0xB3, 0x4C, 0x9A, 0xB9,
-    0xD7, 0xCC, 0x91, 0xCE, 0x99, 0x84, 0x9C, 0x3B, 0x7B, 0xE2, 0x73, 0xAE, 0x27, 0xE2, 0x16, 0xED,
-    0x7E, 0xDF, 0x72, 0xDE, 0x92, 0x45, 0x4D, 0x90, 0xD5, 0xAA, 0xF9, 0x3A, 0x95, 0x43, 0x9F, 0x81,
-    0x72, 0x9B, 0x4C, 0x94, 0x59, 0xC8, 0x5A, 0x79, 0x5D, 0x31, 0x56, 0x1B, 0x4E, 0x8D, 0x51, 0xC8,
-    0x9B, 0x7C, 0x42, 0xE4, 0xCA, 0xE6, 0xD8, 0xB8, 0x1C, 0x18, 0x93, 0x03, 0xE3, 0x71, 0x60, 0x2C,
-    0x0E, 0x8C, 0xC3, 0x81, 0x31, 0x38, 0x30, 0xFE, 0x06, 0xC6, 0xDE, 0xC0, 0xB8, 0x1B, 0x18, 0x73,
-    0x03, 0xE3, 0x6D, 0x60, 0xAC, 0x0D, 0x8C, 0xB3, 0x81, 0x2C, 0x68, 0xC7, 0x67, 0xA6, 0x91, 0x45,
-    0x68, 0x63, 0x66, 0x55, 0xA3, 0x76, 0xA3, 0x29, 0xED, 0x27, 0x34, 0x06, 0x3B, 0x16, 0x4A, 0x3A,
-    0xF6, 0xAF, 0x53, 0x87, 0x99, 0x96, 0xC7, 0xAF, 0x0C, 0x53, 0xA7, 0x9F, 0x44, 0x1F, 0xD7, 0x95,
-    0x33, 0x4C, 0xBD, 0x03, 0x04, 0x8A, 0x4E, 0x0A, 0x47, 0xBF, 0x8B, 0x9F, 0x23, 0x62, 0x5E, 0x5C,
-    0x98, 0xCA, 0x3B, 0x9D, 0x08, 0x10, 0xC2, 0xF4, 0xE1, 0x09, 0x44, 0x1D, 0xA6, 0x71, 0x9D, 0xC6,
-    0x65, 0x43, 0xD2, 0x91, 0x53, 0x27, 0x59, 0xD8, 0x35, 0xC7, 0x36, 0x2B, 0x28, 0xDA, 0x88, 0xEC,
-    0xA7, 0x97, 0x69, 0x16, 0x1F, 0xA8, 0x5D, 0xD4, 0xD9, 0xDC, 0x98, 0xCF, 0x2E, 0x30, 0xF3, 0x64,
-    0x13, 0xB4, 0xD5, 0x5E, 0xF4, 0xDB, 0x7F, 0xF0, 0xDE, 0xCE, 0x5F, 0x78, 0xBD, 0xF7, 0x1E, 0xAD,
-    0x89, 0x7B, 0x86, 0xFB, 0x3E, 0xC3, 0x31, 0x74, 0x28, 0xC4, 0xD3, 0xAA, 0x18, 0xE7, 0xE9, 0xCC,
-    0x65, 0x4D, 0x95, 0xA5, 0xBB, 0xDE, 0x53, 0x67, 0x47, 0xEF, 0x50, 0x50, 0x70, 0x4E, 0xAE, 0x88,
-    0x29, 0xD3, 0x58, 0xA0, 0x51, 0x20, 0xD0, 0x11, 0x56, 0x12, 0x4C, 0xA4, 0x06, 0xCE, 0xAA, 0x53,
-    0x07, 0x64, 0x7A, 0xD9, 0x9A, 0x48, 0xC5, 0xE0, 0x09, 0xBA, 0xE3, 0x6C, 0x26, 0x6D, 0x07, 0xAA,
-    0x15, 0x1E, 0x8C, 0xD5, 0x53, 0x87, 0x49, 0x24, 0xCB, 0xD2, 0x69, 0x18, 0x8E, 0x12, 0x07, 0x4E,
-    0xA8, 0xB3, 0x17, 0x25, 0xD0, 0xEA, 0xA4, 0x8B, 0x63, 0x17, 0x6B, 0x5D, 0xF0, 0x06, 0xEB, 0x4B,
-    0xE2, 0x8F, 0x5E, 0xCE, 0x83, 0x29, 0x42, 0xDB, 0x25, 0x0D, 0x82, 0x37, 0x82, 0xE4, 0x22, 0x04,
-    0x3B, 0xA6, 0xD7, 0xD6, 0xE8, 0x40, 0x87, 0x0C, 0xEF, 0xE5, 0x97, 0x6D, 0xB4, 0xBA, 0xED, 0xBF,
-    0xCE, 0x3E, 0x1C, 0x68, 0x8A, 0x50, 0x74, 0xD9, 0x4F, 0x3B, 0x11, 0xEF, 0x89, 0xB0, 0x63, 0xF7,
-    0x7C, 0xFC, 0x2A, 0xE0, 0x8E, 0x06, 0xC1, 0xCF, 0xFF, 0xAB, 0x04, 0x3B, 0x0B, 0xD0, 0x06, 0xBE,
-    0x57, 0x28, 0x4B, 0xB0, 0xEC, 0xBF, 0x07, 0x9E, 0x5D, 0x8A, 0x4D, 0xA6, 0x0B, 0x30, 0x12, 0xFA,
-    0x49, 0x58, 0x09, 0x34, 0x6B, 0x60, 0x93, 0x58, 0x36, 0xA3, 0x40, 0x0B, 0x85, 0x1B, 0x0A, 0x64,
-    0x15, 0xA3, 0x2A, 0x8C, 0xED, 0x1D, 0x31, 0xB4, 0xDF, 0xBA, 0x23, 0xC5, 0xAF, 0x0A, 0x5F, 0x15,
-    0xBD, 0x1A, 0x78, 0x55, 0xEC, 0x6A, 0xD0, 0xF5, 0x8C, 0x01, 0x4B, 0x37, 0x7F, 0x42, 0x64, 0x67,
-    0x07, 0xBB, 0xD0, 0x38, 0xB3, 0x53, 0x8D, 0x69, 0x6C, 0xEC, 0x09, 0x40, 0x2C, 0x9F, 0x9F, 0x02,
-    0xC2, 0xE6, 0x44, 0xB0, 0x8C, 0x86, 0xC4, 0xAF, 0xDD, 0x85, 0x83, 0x6B, 0x8C, 0x38, 0x44, 0xAE,
-    0x04, 0xAE, 0x8A, 0x5B, 0x89, 0x13, 0x1D, 0x45, 0xAE, 0xD4, 0x48, 0xDD, 0x6C, 0xDB, 0x6E, 0xDB,
-    0x70, 0xDB, 0xF2, 0x45, 0x13, 0x23, 0xA4, 0xC5, 0xEE, 0x02, 0xD2, 0xEE, 0x2B, 0x64, 0x2A, 0x8F,
-    0x01, 0xC6, 0xDE, 0x31, 0xA4, 0x55, 0xBC, 0xA1, 0x80, 0x32, 0xA4, 0xD6, 0x05, 0x93, 0x19, 0x82,
-    0x6C, 0xC1, 0x23, 0x31, 0xAE, 0x42, 0x5C, 0xC3, 0xAA, 0x2D, 0x60, 0xB8, 0x8D, 0x61, 0xD7, 0x70,
-    0xAD, 0xC1, 0x5A, 0x45, 0xB5, 0x0A, 0x6A, 0x17, 0x30, 0xAD, 0x57, 0xF3, 0x79, 0x6E, 0xFF, 0x8D,
-    0xD9, 0x8A, 0x9B, 0x6F, 0x72, 0xBD, 0xD8, 0xD5, 0x71, 0x53, 0x01, 0xDE, 0xCA, 0x89, 0x92, 0xD8,
-    0xD9, 0xF5, 0x44, 0x29, 0x69, 0xCE, 0xF4, 0xF3, 0xB4, 0x8F, 0x7F, 0x6E, 0xF1, 0x7A, 0x3D, 0x9B,
-    0xFB, 0xCF, 0xBB, 0x28, 0xBB, 0x26, 0x64, 0x19, 0x16, 0xB0, 0x8C, 0x20, 0x50, 0x77, 0x92, 0x3E,
-    0xA6, 0xB2, 0x1B, 0xCC, 0x46, 0x5B, 0x39, 0x39, 0x12, 0x34, 0x73, 0x53, 0x10, 0x1E, 0xF1, 0x9F,
-    0xBA, 0xCB, 0x34, 0x91, 0xF3, 0x04, 0xBD, 0x2A, 0xC6, 0x8B, 0x1C, 0xCE, 0x38, 0xF7, 0x42, 0x05,
-    0xCD, 0x50, 0x3F, 0x31, 0x43, 0x55, 0x48, 0x15, 0xA5, 0xFF, 0x13, 0x62, 0x54, 0xD3, 0x55, 0x7D,
-    0x0B, 0xB7, 0x5B, 0xAB, 0x75, 0x5E, 0xBF, 0x5F, 0x62, 0x2C, 0x17, 0x70, 0xC7, 0x9A, 0x45, 0xEE,
-    0x45, 0x6D, 0xDC, 0x9D, 0x8D, 0x27, 0x4D, 0x8C, 0x67, 0x67, 0xB8, 0x42, 0xA1, 0x86, 0xA7, 0x2A,
-    0x70, 0x9D, 0x62, 0xF4, 0xEE, 0xA1, 0x18, 0x1D, 0x24, 0x81, 0x21, 0xA8, 0x7A, 0x1A, 0xDF, 0x3F,
-    0xAA, 0xE4, 0x10, 0x00, 0x90, 0x22, 0xDA, 0x49, 0x98, 0x01, 0x6F, 0x64, 0xEF, 0xF4, 0xB7, 0xB3,
-    0x2E, 0xCE, 0xB7, 0xB0, 0x4E, 0x40, 0x40, 0x58, 0x10, 0xBE, 0x3F, 0x46, 0x4C, 0x2D, 0xDA, 0xC2,
-    0x84, 0xB2, 0xA1, 0xCC, 0x2D, 0xF7, 0x5F, 0x9F, 0xAD, 0xF8, 0x69, 0xA5, 0x06, 0xC7, 0xF5, 0x20,
-    0xB3, 0xF2, 0xCA, 0xCA, 0x09, 0x01, 0x46, 0xEB, 0xCF, 0x89, 0x8F, 0x53, 0xCE, 0xAA, 0x47, 0xF9,
-    0x00, 0x10, 0x77, 0xAC, 0x73, 0xFB, 0x39, 0x0E, 0x80, 0x24, 0x0F, 0xAA, 0x3C, 0x4C, 0x36, 0x47,
-    0xD4, 0x72, 0x6C, 0x7C, 0x42, 0x4E, 0xA6, 0x54, 0xD4, 0x96, 0x58, 0x87, 0xEB, 0xC8, 0xF1, 0x4A,
-    0xA5, 0x8D, 0xBD, 0x16, 0x88, 0x3F, 0xF3, 0x89, 0x6A, 0xAD, 0x4A, 0x3C, 0x5C, 0x7F, 0xB8, 0x8D,
-    0xC9, 0xDB, 0x4E, 0x68, 0x46, 0x01, 0xEE, 0x8E, 0xE9, 0x74, 0xA4, 0x29, 0xCF, 0x79, 0x4C, 0x78,
-    0xE2, 0x85, 0x48, 0x05, 0x74, 0xDD, 0xA6, 0x42, 0x27, 0x37, 0x8B, 0x3E, 0x7C, 0x53, 0x98, 0xCD,
-    0xF1, 0xDE, 0xA1, 0x92, 0x2F, 0x9D, 0xF5, 0x0D, 0x4E, 0xB1, 0x8A, 0x43, 0x2E, 0xDB, 0x62, 0xA9,
-    0x13, 0xEE, 0x8A, 0xE9, 0x29, 0x08, 0x06, 0xD3, 0x0B, 0x90, 0x09, 0xA6, 0x1B, 0x51, 0x2E, 0xBD,
-    0x57, 0xBE, 0x57, 0xD5, 0x63, 0x1F, 0xB4, 0x54, 0xA0, 0xF6, 0xCD, 0xA3, 0x88, 0x85, 0x28, 0x3A,
-    0x15, 0x84, 0x31, 0x99, 0x0E, 0x29, 0x0E, 0x20, 0x40, 0x08, 0x24, 0xF3, 0x73, 0x88, 0x84, 0x35,
-    0x1D, 0x2B, 0xE8, 0x68, 0x01, 0x06, 0x82, 0xA9, 0xEB, 0x12, 0xA2, 0x79, 0x65, 0xFD, 0x52, 0xAC,
-    0xC2, 0xEA, 0x6A, 0xEE, 0x03, 0x01, 0x65, 0x3C, 0x27, 0x46, 0xDB, 0x92, 0xB7, 0x4A, 0x27, 0x8F,
-    0x3F, 0xFA, 0xED, 0x74, 0x3B, 0x0B, 0xEA, 0xA4, 0x37, 0x55, 0x2C, 0xD4, 0xBA, 0xBA, 0xE5, 0x7A,
-    0x1F, 0x5A, 0xF1, 0x0B, 0xE4, 0x45, 0x23, 0xDC, 0x1D, 0xD9, 0x58, 0x40, 0xB0, 0x0A, 0x9C, 0x9C,
-    0xB6, 0x49, 0x47, 0x3C, 0xD3, 0xA7, 0xDE, 0xE2, 0xD0, 0x7F, 0x03, 0x6B, 0x43, 0xE2, 0xD4, 0x30,
-    0xC7, 0x75, 0x61, 0x16, 0xA5, 0x41, 0x3D, 0x09, 0xB3, 0xE5, 0xED, 0xBF, 0x23, 0x91, 0x09, 0x33,
-    0x77, 0x44, 0xBD, 0x18, 0xFE, 0x62, 0x03, 0x9A, 0x51, 0x4F, 0x67, 0x48, 0xF1, 0x87, 0x40, 0xA5,
-    0x1F, 0xC0, 0xC6, 0x0F, 0x86, 0x30, 0x8C, 0x3C, 0x5A, 0x22, 0x38, 0x4D, 0x14, 0xA1, 0xB2, 0x66,
-    0x9A, 0xDA, 0x59, 0x90, 0x81, 0x15, 0xAF, 0xE0, 0x43, 0x15, 0x86, 0xDE, 0x64, 0x8D, 0x2D, 0x55,
-    0xCB, 0x57, 0x79, 0x1D, 0xD0, 0xC1, 0x60, 0x2F, 0x59, 0x1E, 0x42, 0xCC, 0x45, 0x5E, 0xB8, 0x46,
-    0x5F, 0xBD, 0xE9, 0xD5, 0x35, 0xA2, 0xAF, 0xA3, 0xD5, 0x58, 0x28, 0xE7, 0xCD, 0xED, 0x14, 0xCE,
-    0x64, 0xA4, 0xA6, 0xB1, 0xD4, 0x64, 0x55, 0xEE, 0x07, 0x45, 0x9B, 0x53, 0xB1, 0x38, 0x3B, 0xCF,
-    0xA8, 0x8E, 0x53, 0x10, 0x86, 0xF8, 0xC3, 0xEC, 0x96, 0x82, 0x70, 0xF8, 0x5F, 0xF1, 0xC8, 0x51,
-    0xA8, 0xFD, 0x87, 0x94, 0x0F, 0xC5, 0x43, 0xE9, 0x50, 0x38, 0x94, 0x88, 0xFE, 0x87, 0x99, 0x82,
-    0x51, 0xB9, 0x80, 0x2B, 0x4A, 0x85, 0x42, 0xA1, 0x4C, 0x28, 0x12, 0x4A, 0x84, 0x02, 0xA1, 0x3C,
-    0x98, 0x99, 0x6D, 0xDA, 0x41, 0x74, 0x5F, 0x50, 0x14, 0x2A, 0x09, 0x4B, 0x5F, 0x84, 0xA5, 0x94,
-    0xDF, 0xE7, 0xE6, 0xA6, 0x45, 0x0B, 0x97, 0xB3, 0xF4, 0x05, 0xA6, 0x56, 0x57, 0xC8, 0xB3, 0x7A,
-    0x85, 0xAF, 0xB5, 0xEC, 0x52, 0xB4, 0x0A, 0x5C, 0x61, 0x70, 0x59, 0x1C, 0x0C, 0x98, 0x93, 0x3C,
-    0xC2, 0x08, 0x09, 0x69, 0x7A, 0xFF, 0x64, 0x95, 0xF4, 0xE3, 0x29, 0x29, 0x80, 0x53, 0xF1, 0xC6,
-    0x31, 0x93, 0x95, 0x90, 0x01, 0xCB, 0xD7, 0x5F, 0x68, 0x25, 0xB6, 0xD6, 0x32, 0x32, 0x95, 0x36,
-    0xCA, 0x91, 0x8B, 0x05, 0x23, 0x64, 0x63, 0x4E, 0x2D, 0x6A, 0x6A, 0x97, 0x71, 0x3F, 0x79, 0x92,
-    0xCE, 0x29, 0xA4, 0xAB, 0xF1, 0xE9, 0xD9, 0x9D, 0x16, 0xAB, 0xF7, 0xE8, 0x89, 0xB4, 0x56, 0xE5,
-    0x1D, 0x39, 0x9C, 0xEB, 0x93, 0x20, 0xD6, 0xCB, 0x3D, 0x3E, 0x52, 0x1D, 0x8F, 0x92, 0xB6, 0xC9,
-    0x81, 0x4C, 0x7E, 0xCC, 0xDA, 0x6D, 0x4D, 0x22, 0x47, 0x5A, 0xE3, 0xD5, 0x1C, 0x4C, 0x33, 0x2A,
-    0xCD, 0x23, 0x91, 0x07, 0xAE, 0xEE, 0xCB, 0x34, 0xE9, 0xD5, 0x49, 0x94, 0xDD, 0xEB, 0xEC, 0x6D,
-    0x87, 0xAC, 0x16, 0x2D, 0xDA, 0x55, 0xA0, 0xED, 0xAB, 0x1B, 0x56, 0xED, 0x1C, 0xA6, 0x5F, 0x3E,
-    0x7F, 0x0B, 0x13, 0x03, 0x2F, 0x55, 0x73, 0x8C, 0xAC, 0xB4, 0xC6, 0x94, 0x57, 0xCE, 0xF5, 0xAF,
-    0x92, 0x90, 0x72, 0xD1, 0xF1, 0x9C, 0x20, 0xDE, 0xE9, 0x1A, 0xBD, 0x7A, 0x3A, 0xA7, 0xED, 0xB8,
-    0x64, 0xB1, 0xD3, 0xC8, 0x82, 0xDA, 0x36, 0x64, 0x51, 0xBD, 0xB4, 0x9A, 0x3B, 0xAD, 0x71, 0x73,
-    0xD3, 0xAC, 0x11, 0x0A, 0xDC, 0xE6, 0xD0, 0x21, 0xFD, 0x6B, 0x5D, 0x17, 0x9D, 0xFE, 0xB5, 0xEC,
-    0x6B, 0xB0, 0x9C, 0xAF, 0xEA, 0x4D, 0x4A, 0x23, 0x3C, 0x6C, 0x62, 0xEC, 0x70, 0x4F, 0xE4, 0x1A,
-    0x43, 0x40, 0x87, 0x65, 0xB3, 0x4A, 0x7B, 0x4F, 0x10, 0xC7, 0x12, 0x8E, 0x4D, 0x9C, 0x0F, 0xB0,
-    0x36, 0x94, 0xA0, 0x8C, 0xDF, 0xEF, 0xC1, 0x03, 0x4F, 0xD4, 0xE9, 0x30, 0xAD, 0xA6, 0x43, 0x72,
-    0xFE, 0x55, 0x9A, 0x3B, 0x62, 0x85, 0xAE, 0x71, 0x46, 0xE7, 0xFA, 0xFD, 0x04, 0x21, 0x25, 0x8D,
-    0xFB, 0x43, 0x3C, 0x6D, 0x4D, 0x2E, 0xC8, 0x0D, 0x61, 0x85, 0x4C, 0x4D, 0x3D, 0x6C, 0x00, 0xE9,
-    0xA4, 0x69, 0x2D, 0x39, 0x75, 0x03, 0xF1, 0x09, 0xAC, 0x82, 0x7C, 0xE1, 0xC8, 0x1E, 0xC3, 0xDA,
-    0x0E, 0xA2, 0x02, 0x9B, 0x62, 0xBD, 0x57, 0x47, 0x70, 0x3F, 0x57, 0x88, 0xB2, 0x91, 0x1E, 0x87,
-    0xCF, 0x26, 0xFE, 0x54, 0x5B, 0x1C, 0x6A, 0x6A, 0x00, 0x80, 0x2C, 0xC8, 0xDF, 0xE9, 0xDF, 0x88,
-    0x9E, 0xD7, 0xD5, 0x50, 0xBF, 0xF5, 0xFF, 0xD8, 0x90, 0xB1, 0xF6, 0x0B, 0x75, 0x4F, 0xDB, 0x2F,
-    0xEA, 0x8B, 0x9C, 0x69, 0x9B, 0x1F, 0x58, 0x49, 0xF5, 0x64, 0xB7, 0x5F, 0xA4, 0x29, 0xA6, 0x5B,
-    0x7D, 0xB1, 0x3C, 0x94, 0xDB, 0xDC, 0x6A, 0x3E, 0x21, 0xED, 0x97, 0xA6, 0x64, 0xA3, 0x44, 0x51,
-    0x9D, 0xD5, 0x80, 0x01, 0x45, 0x35, 0x53, 0xBC, 0x1F, 0x31, 0xDB, 0xCC, 0x73, 0xD7, 0xCA, 0xD0,
-    0x4C, 0xAB, 0xFC, 0xA4, 0xC5, 0xDC, 0x77, 0x35, 0x66, 0x23, 0x20, 0x6B, 0x79, 0x06, 0x31, 0x79,
-    0x75, 0x9A, 0x68, 0x3C, 0xA4, 0x01, 0xA8, 0xEA, 0xDC, 0xD1, 0x7C, 0xD0, 0xBF, 0x56, 0x9D, 0xEB,
-    0x5F, 0xF1, 0x08, 0x3D, 0xA3, 0x3A, 0xD7, 0x75, 0xB3, 0x4C, 0x7C, 0x7F, 0x9B, 0xB3, 0xA9, 0x2C,
-    0x32, 0xBE, 0x8A, 0x55, 0x55, 0x79, 0x07, 0x32, 0x37, 0x85, 0x4B, 0x0F, 0xB7, 0x68, 0x7B, 0x45,
-    0x04, 0x72, 0xFF, 0x49, 0x2B, 0xF8, 0x14, 0x1B, 0xED, 0x22, 0x46, 0x57, 0x30, 0x60, 0x77, 0x44,
-    0xB5, 0x1F, 0x93, 0x9E, 0xD9, 0xE0, 0xCC, 0x06, 0x97, 0xB7, 0x05, 0x68, 0xA8, 0xC0, 0x23, 0x06,
-    0x58, 0x2B, 0x0D, 0x41, 0x2B, 0xEB, 0x4A, 0x81, 0x5B, 0xF9, 0xA4, 0x01, 0x7B, 0xE5, 0x22, 0x51,
-    0x00, 0xB4, 0xC3, 0x43, 0x95, 0xB5, 0xCF, 0x0C, 0x2A, 0x9E, 0xD5, 0x89, 0x34, 0x75, 0xAD, 0xC6,
-    0x95, 0xFB, 0xC5, 0xBC, 0xBE, 0xD4, 0xF4, 0x15, 0xBE, 0x3E, 0x6F, 0xFC, 0x9B, 0xEA, 0x6B, 0x53,
-    0xC4, 0x7A, 0x22, 0xD6, 0x12, 0xB1, 0x8E, 0x88, 0x35, 0x44, 0xAC, 0xF1, 0x63, 0x6D, 0x1F, 0xEB,
-    0x86, 0x58, 0x33, 0xC4, 0x7A, 0x21, 0xD6, 0x0A, 0xB1, 0x4E, 0x88, 0x35, 0x42, 0xAC, 0x0F, 0x62,
-    0x6D, 0x10, 0xEB, 0x82, 0x58, 0x13, 0xC4, 0x7A, 0x20, 0xD6, 0x02, 0xB1, 0x0E, 0x88, 0x35, 0x40,
-    0x16, 0xEA, 0x48, 0x66, 0x8A, 0xEA, 0x73, 0xCE, 0xCF, 0x53, 0x3B, 0x6B, 0x60, 0x08, 0xDB, 0x17,
-    0xA2, 0xCD, 0x0B, 0x6D, 0x5D, 0x68, 0xC7, 0xC2, 0x86, 0xF2, 0x8B, 0x07, 0x0A, 0x53, 0x9B, 0x14,
-    0xDA, 0xA2, 0x68, 0x04, 0x66, 0xB1, 0xD7, 0x2A, 0x1C, 0xF2, 0x0D, 0x1D, 0xBF, 0xA9, 0x92, 0x51,
-    0xF1, 0x79, 0xA9, 0x06, 0xEA, 0xA4, 0x9C, 0x9D, 0xBB, 0xD6, 0x93, 0x18, 0x2E, 0x24, 0x93, 0x9A,
-    0x46, 0xBA, 0xBF, 0xD1, 0xEB, 0x7F, 0xCD, 0x6B, 0xFC, 0x26, 0x8D, 0xAC, 0x8E, 0x4C, 0x23, 0x7B,
-    0xDA, 0xEF, 0x3E, 0xE8, 0x83, 0x1D, 0x87, 0x06, 0x87, 0xF4, 0xAA, 0x49, 0x20, 0xFD, 0xA3, 0x12,
-    0x48, 0x0D, 0x37, 0xDC, 0x3A, 0x1A, 0xCE, 0x03, 0x8D, 0x3D, 0xB2, 0x0C, 0x5D, 0xDE, 0x40, 0xA2,
-    0x75, 0x41, 0x0F, 0xD9, 0x67, 0x04, 0xC9, 0x8F, 0x31, 0x99, 0x9C, 0x81, 0x80, 0xC8, 0xB4, 0xFB,
-    0xA2, 0x2D, 0xEE, 0xD8, 0x23, 0xF2, 0xFF, 0x85, 0x0C, 0xB3, 0xC5, 0xF5, 0xFF, 0x55, 0x5B, 0x0D,
-    0x65, 0x51, 0xAF, 0xEE, 0x5D, 0xCE, 0xA9, 0xD8, 0xDE, 0xFC, 0x79, 0xDA, 0x8A, 0xF4, 0x05, 0x59,
-    0x28, 0x5F, 0x02, 0x84, 0xFE, 0x89, 0x20, 0x74, 0x6A, 0xB1, 0x1C, 0x97, 0xC6, 0x74, 0xCC, 0x6F,
-    0x11, 0x84, 0xFE, 0x1E, 0x20, 0xD4, 0x7B, 0x17, 0x20, 0xD4, 0xFF, 0x36, 0x7C, 0x77, 0x48, 0xD4,
-    0xF9, 0x75, 0x0E, 0x17, 0x38, 0x5C, 0xE7, 0x50, 0x00, 0x84, 0xBA, 0x19, 0x40, 0x28, 0xCD, 0x2E,
-    0xFA, 0x2E, 0x23, 0xF1, 0x9F, 0x09, 0x42, 0xC7, 0x87, 0x40, 0xA8, 0xFB, 0x97, 0x9A, 0x66, 0x38,
-    0xEB, 0xD8, 0xC8, 0x73, 0x32, 0xD7, 0xB0, 0x06, 0xD7, 0x99, 0x68, 0x0A, 0xD9, 0xF8, 0x5B, 0xE6,
-    0x1D, 0xD4, 0x89, 0xE1, 0xCE, 0x0E, 0x70, 0xE7, 0xB7, 0x80, 0x3B, 0x7F, 0x59, 0x6E, 0x39, 0xBF,
-    0x2B, 0xBB, 0xDE, 0xBB, 0x65, 0x37, 0x00, 0xEE, 0x3C, 0x0D, 0xDC, 0xB9, 0x06, 0xDC, 0xF9, 0x02,
-    0x70, 0x67, 0x01, 0xDC, 0x09, 0x82, 0x03, 0xE0, 0x4E, 0x56, 0x67, 0xCE, 0xB7, 0xDE, 0xE5, 0x92,
-    0x3E, 0x6D, 0xAC, 0xB1, 0xA8, 0xAB, 0xBC, 0x77, 0x0C, 0xF6, 0xFE, 0xA4, 0x3C, 0xDC, 0x15, 0xB8,
-    0xBF, 0xA5, 0x9A, 0xE7, 0x60, 0x59, 0x5B, 0x20, 0x2F, 0x02, 0x71, 0xC1, 0x8B, 0x70, 0xB7, 0xF9,
-    0x8D, 0x19, 0x71, 0xC7, 0x63, 0x55, 0x3F, 0x52, 0x55, 0x54, 0x80, 0xE2, 0xFF, 0x51, 0xB9, 0x90,
-    0xA7, 0xE4, 0x50, 0x58, 0xBF, 0xBF, 0x12, 0x90, 0x73, 0x44, 0xD6, 0x70, 0xFD, 0x37, 0x77, 0x70,
-    0xCD, 0xF9, 0xA6, 0x01, 0x76, 0x3C, 0xDC, 0x9F, 0x72, 0x00, 0x36, 0x40, 0xB8, 0xFF, 0x2B, 0x02,
-    0x67, 0x44, 0xFA, 0x1B, 0xC8, 0x3A, 0x56, 0x9C, 0x26, 0xF1, 0xAE, 0x47, 0x1B, 0x07, 0x7D, 0xBE,
-    0xF7, 0xB0, 0xC9, 0xAC, 0x1B, 0xC7, 0x79, 0x1C, 0x4B, 0xF3, 0x77, 0x1F, 0x34, 0x86, 0xA7, 0x88,
-    0xDF, 0xE9, 0xA1, 0xB5, 0xF9, 0x11, 0x10, 0x21, 0x92, 0x1D, 0xBE, 0x79, 0xC1, 0xF7, 0x2E, 0x9E,
-    0x03, 0x64, 0xD9, 0x05, 0xDF, 0x51, 0x80, 0x68, 0xF3, 0x1D, 0x06, 0x9D, 0xF9, 0x6E, 0x6A, 0x28,
-    0x02, 0x3F, 0x61, 0x16, 0x23, 0xCF, 0x57, 0xAE, 0xB2, 0x8B, 0x56, 0x8E, 0xCD, 0xE0, 0x9E, 0xB3,
-    0xAD, 0xF5, 0xF5, 0x64, 0xAB, 0x31, 0xD1, 0xB8, 0xA9, 0xD7, 0x21, 0x9F, 0x4A, 0xFC, 0x83, 0x21,
-    0xB1, 0x93, 0xC5, 0xCD, 0xE5, 0x2B, 0x7C, 0xB5, 0x4B, 0xE4, 0xED, 0x0D, 0x48, 0x38, 0x98, 0xBD,
-    0xBD, 0x74, 0x37, 0x78, 0x69, 0xF7, 0xC5, 0xBD, 0x39, 0x38, 0xB4, 0x2F, 0xC7, 0xC1, 0xC7, 0x99,
-    0x53, 0x49, 0x0C, 0xAB, 0x7D, 0xA6, 0xF0, 0xB3, 0xD2, 0x29, 0x36, 0x65, 0x65, 0x49, 0x75, 0x74,
-    0xE2, 0x0C, 0x35, 0xB3, 0x08, 0xEF, 0xF0, 0xAF, 0xB7, 0x87, 0xD4, 0xF5, 0xEC, 0xA9, 0x24, 0x0A,
-    0xF2, 0xF0, 0xDD, 0xD2, 0xCB, 0x2B, 0x29, 0xD7, 0xEC, 0x9E, 0xD2, 0x4F, 0x65, 0xA8, 0xD7, 0x04,
-    0x9F, 0xFF, 0x97, 0xCB, 0x0F, 0x2A, 0xA0, 0xC3, 0xE5, 0xAB, 0x02, 0x20, 0xD5, 0xDD, 0x90, 0xEB,
-    0x40, 0x9B, 0xCE, 0x31, 0x74, 0xC1, 0xE7, 0x37, 0xF4, 0x9A, 0x1B, 0xDE, 0x71, 0x0B, 0x5C, 0x3D,
-    0x19, 0xB1, 0xB3, 0x6C, 0xAA, 0xF6, 0xD3, 0x8D, 0x05, 0xDF, 0x2E, 0x16, 0xAB, 0xF0, 0xF7, 0xB4,
-    0x05, 0x0E, 0x41, 0x43, 0xC1, 0x73, 0x35, 0x2C, 0xCA, 0x9A, 0xC2, 0x6E, 0xA4, 0x7D, 0x3C, 0x2D,
-    0x70, 0x79, 0xB3, 0xAD, 0x4C, 0x84, 0x3F, 0xC3, 0x33, 0x1F, 0x62, 0xFA, 0xBF, 0x74, 0x7F, 0x78,
-    0x95, 0x73, 0xA9, 0x96, 0x2D, 0x9C, 0x4F, 0x06, 0xC0, 0x0B, 0x0F, 0xCD, 0x43, 0xF8, 0x31, 0xF0,
-    0x79, 0x86, 0x68, 0x27, 0xD6, 0xFE, 0xCC, 0x33, 0x2C, 0x36, 0x64, 0x7C, 0x61, 0xB3, 0x60, 0xAD,
-    0xA1, 0x15, 0x26, 0x94, 0x6F, 0x5F, 0xB3, 0xE1, 0xDC, 0x10, 0x3A, 0x5F, 0xAD, 0xE2, 0x30, 0x6F,
-    0x1D, 0xED, 0xCE, 0xD6, 0x98, 0x28, 0x50, 0xF1, 0x0E, 0xB6, 0x53, 0xAB, 0x70, 0x7B, 0xE5, 0x42,
-    0x05, 0x4E, 0x2B, 0x89, 0x4D, 0x05, 0x0E, 0x90, 0x62, 0x6C, 0x99, 0x38, 0x54, 0x34, 0x46, 0x06,
-    0x9B, 0x06, 0x15, 0x69, 0x89, 0xE9, 0xB4, 0x5E, 0x2A, 0x40, 0x08, 0xF8, 0x5D, 0xD8, 0x53, 0x80,
-    0xE0, 0x24, 0xFA, 0x2B, 0x33, 0x0B, 0x64, 0x08, 0x63, 0x9F, 0xC9, 0x9A, 0xC2, 0x58, 0x3D, 0xCA,
-    0x5B, 0x1C, 0xF8, 0x0E, 0xEA, 0x0B, 0x1C, 0x95, 0x9B, 0xD3, 0x52, 0xAF, 0x25, 0x6F, 0xFF, 0x58,
-    0xCC, 0x6F, 0xCD, 0x5F, 0xBB, 0xBC, 0x67, 0x2C, 0x1E, 0xF6, 0x67, 0x5F, 0x9B, 0xF9, 0xB3, 0x2F,
-    0xCD, 0x9E, 0xEE, 0xA3, 0x6D, 0xA4, 0xED, 0xA4, 0x6D, 0xA5, 0x38, 0xF6, 0xFE, 0xC1, 0x6C, 0x33,
-    0x4F, 0x44, 0xBF, 0xD2, 0x49, 0x2E, 0x31, 0x35, 0xD3, 0x37, 0xF1, 0x48, 0xDE, 0x0E, 0x5B, 0xE8,
-    0x4F, 0xB0, 0x28, 0xBC, 0x74, 0x97, 0xFB, 0xBC, 0xE7, 0x74, 0xD4, 0x02, 0xA8, 0x7B, 0x73, 0x47,
-    0x73, 0x9B, 0xF3, 0xB3, 0xF7, 0x5D, 0x4E, 0x4E, 0x3F, 0xD7, 0xB1, 0x3E, 0x1F, 0x41, 0xD1, 0xF7,
-    0x61, 0xFB, 0x17, 0x90, 0x28, 0xCD, 0xDF, 0x9D, 0xBE, 0x6B, 0x2D, 0x70, 0x06, 0xBE, 0x00, 0xB4,
-    0x44, 0x70, 0x41, 0x7C, 0xBD, 0xED, 0x69, 0x60, 0xE2, 0xAD, 0x26, 0x80, 0xB2, 0xF0, 0x85, 0x5C,
-    0x41, 0x7C, 0xC0, 0x2A, 0x87, 0x39, 0x46, 0x67, 0xCA, 0x54, 0x91, 0xA1, 0x80, 0xBE, 0x23, 0x7F,
-    0x0C, 0xFE, 0xE7, 0x32, 0x8E, 0x01, 0x38, 0xD2, 0xDE, 0x6E, 0xFA, 0x0E, 0x38, 0xAA, 0xE6, 0x2D,
-    0x06, 0x8D, 0x1A, 0x7C, 0xCD, 0x04, 0xC7, 0x05, 0x03, 0x7E, 0x2E, 0xE4, 0xFC, 0x5A, 0xB9, 0xE6,
-    0x40, 0x07, 0xF0, 0xC7, 0x78, 0x1D, 0x03, 0x6D, 0x4D, 0x71, 0xDB, 0x9C, 0xCF, 0x72, 0x46, 0x8F,
-    0xCA, 0xE0, 0x86, 0x0C, 0x76, 0x64, 0xB4, 0xB5, 0x5C, 0x76, 0x00, 0xD2, 0x2E, 0xB5, 0x69, 0x8D,
-    0xEE, 0x0B, 0x70, 0x1D, 0x28, 0x67, 0xD1, 0x2E, 0xEB, 0x5D, 0x43, 0xCE, 0xB1, 0xE9, 0x56, 0x5E,
-    0xF6, 0x82, 0x5B, 0x39, 0xD9, 0xF3, 0x18, 0xF2, 0x15, 0x48, 0x3A, 0x39, 0xB2, 0x54, 0x70, 0xDB,
-    0x03, 0x37, 0x84, 0x16, 0x06, 0xFF, 0x70, 0x28, 0xF1, 0xD3, 0x9C, 0xCA, 0x9B, 0x55, 0xB2, 0xB5,
-    0x4B, 0xD5, 0x2A, 0x6E, 0xC1, 0xED, 0x65, 0x23, 0xEA, 0x20, 0xED, 0xD5, 0xB9, 0xAF, 0xE7, 0x9F,
-    0xF7, 0x07, 0x5F, 0xB0, 0x0F, 0x6F, 0x5C, 0x34, 0xAD, 0xB2, 0xAE, 0x96, 0x29, 0x6E, 0x68, 0xB5,
-    0xD9, 0xB6, 0xC5, 0x81, 0x93, 0x09, 0x6F, 0x6E, 0x64, 0x71, 0xE2, 0xD3, 0x8B, 0x57, 0xCC, 0xE7,
-    0x1F, 0x50, 0x02, 0xA9, 0x50, 0x2C, 0x70, 0x00, 0xEB, 0x71, 0x43, 0x87, 0xF0, 0x61, 0xAF, 0x73,
-    0x37, 0xD8, 0x3C, 0xA1, 0xEA, 0xF2, 0x15, 0xC3, 0xF6, 0x20, 0x2F, 0x5C, 0x0B, 0x9A, 0xBE, 0x13,
-    0x00, 0x76, 0x30, 0x92, 0x65, 0x56, 0x3D, 0xF7, 0x6C, 0x93, 0x96, 0xB1, 0x99, 0xD1, 0x6B, 0xD4,
-    0x94, 0x31, 0x48, 0xD8, 0x45, 0xDA, 0xD9, 0x6D, 0xDE, 0x31, 0x1E, 0x5B, 0xF9, 0x0B, 0xF1, 0x89,
-    0xD5, 0x17, 0xEF, 0xA7, 0x95, 0x95, 0xC4, 0x4C, 0x2F, 0x16, 0x8E, 0x8B, 0xB6, 0xCE, 0x47, 0x85,
-    0x10, 0xC3, 0x50, 0x03, 0x94, 0xBC, 0x2D, 0x6D, 0x2F, 0x6E, 0xF6, 0x8A, 0x63, 0x31, 0x7F, 0xC5,
-    0xB1, 0xF7, 0x99, 0x57, 0x1C, 0xAD, 0xF0, 0x65, 0x65, 0x2F, 0x2B, 0x7A, 0x59, 0x29, 0xEA, 0x0B,
-    0x46, 0x96, 0xB9, 0x44, 0x8B, 0x5C, 0xB7, 0x77, 0x7D, 0x3B, 0x7A, 0x5A, 0xD2, 0x5A, 0x9D, 0x10,
-    0x25, 0x11, 0xE6, 0xA8, 0x91, 0x3D, 0x41, 0x73, 0xD3, 0xFF, 0x2D, 0x81, 0x95, 0x20, 0xAD, 0x41,
-    0x2F, 0x14, 0xB9, 0xBE, 0xA0, 0x3D, 0x35, 0x84, 0x84, 0x3E, 0x65, 0x26, 0x31, 0x75, 0xF5, 0x95,
-    0xC3, 0xF1, 0x1D, 0x5B, 0x69, 0x97, 0x95, 0xA8, 0x1E, 0xDB, 0x53, 0xBD, 0xE2, 0x3F, 0x8D, 0x54,
-    0xBF, 0x6F, 0xDB, 0x46, 0x14, 0xFE, 0xA8, 0x1F, 0xA1, 0x6B, 0x3A, 0xA2, 0xD0, 0xCA, 0x45, 0x9B,
-    0xC8, 0xA2, 0x87, 0xA2, 0x30, 0x04, 0x59, 0xD4, 0x20, 0x14, 0x4E, 0x60, 0x8B, 0xF7, 0x1F, 0x54,
-    0x43, 0x8C, 0x0E, 0x19, 0xA2, 0xA1, 0x43, 0x11, 0x14, 0x8D, 0x0A, 0x38, 0x80, 0x60, 0x48, 0x22,
-    0x81, 0xFE, 0x03, 0x9C, 0x3A, 0x15, 0x2D, 0x0B, 0x64, 0x28, 0x8C, 0x16, 0xE1, 0x90, 0x02, 0x1E,
-    0x6C, 0xEB, 0xD0, 0x31, 0x13, 0xB7, 0xAE, 0x44, 0x9B, 0xA9, 0x13, 0x07, 0x15, 0x50, 0x0C, 0xD9,
-    0xEC, 0x77, 0x94, 0x1D, 0xDB, 0x41, 0x0B, 0xF4, 0xDE, 0xF1, 0xF8, 0xEE, 0xC7, 0x7B, 0xEF, 0xBB,
-    0x77, 0xEF, 0xBD, 0x0A, 0x1C, 0x98, 0x5E, 0x5E, 0x22, 0x41, 0x59, 0xEB, 0x1A, 0x91, 0x25, 0x76,
-    0xB0, 0x07, 0x01, 0xAD, 0x0B, 0x7D, 0x0A, 0x73, 0x8E, 0x66, 0x13, 0x03, 0xDD, 0x03, 0x84, 0x26,
-    0x60, 0x4F, 0x1B, 0xF7, 0xCF, 0x0F, 0xFB, 0x76, 0x02, 0x4D, 0xD4, 0x0F, 0x3C, 0x27, 0x95, 0x00,
-    0xD2, 0xAC, 0xAD, 0xC3, 0xDB, 0xCE, 0x4B, 0xEB, 0xB9, 0x67, 0x9C, 0x03, 0x5D, 0x60, 0x74, 0x32,
-    0xAE, 0x6C, 0xE4, 0xBC, 0x8E, 0x21, 0xD9, 0x3F, 0xC8, 0x09, 0x3B, 0x3A, 0x9D, 0x8A, 0x01, 0xA6,
-    0x66, 0x64, 0x62, 0x19, 0xB7, 0x7C, 0x67, 0xBE, 0xB7, 0xD6, 0xBF, 0xBD, 0xB7, 0x66, 0xCF, 0x6E,
-    0xF9, 0x5A, 0xB7, 0xA2, 0x27, 0x73, 0xF3, 0xB7, 0xA9, 0x95, 0x8F, 0xB6, 0x4D, 0x51, 0x2E, 0xD0,
-    0xBE, 0x18, 0x18, 0x82, 0xA6, 0x09, 0x80, 0x30, 0x08, 0x06, 0x09, 0x1B, 0x7F, 0x71, 0xB8, 0x20,
-    0xBF, 0xB7, 0x5A, 0x14, 0xB6, 0x11, 0x99, 0xDF, 0x24, 0xF9, 0x68, 0x8A, 0x64, 0x1B, 0x14, 0x03,
-    0xB4, 0xA9, 0xEA, 0xE5, 0x44, 0x6C, 0xE5, 0x64, 0xF3, 0xA1, 0x67, 0xA6, 0xD0, 0x9E, 0xA9, 0x4E,
-    0x86, 0x53, 0x2E, 0x96, 0xA9, 0xDB, 0xD7, 0xBD, 0x35, 0x6C, 0x61, 0x1B, 0xAE, 0x70, 0x3D, 0xC7,
-    0x2B, 0xC2, 0x10, 0xB6, 0xB4, 0x23, 0x23, 0xCA, 0xC9, 0xBC, 0x67, 0x60, 0x40, 0x3D, 0x35, 0x38,
-    0x9E, 0xEB, 0x8D, 0x79, 0xAA, 0x01, 0x13, 0xB9, 0x08, 0xFF, 0x72, 0xE6, 0x01, 0xC6, 0xB0, 0x84,
-    0x2E, 0xB5, 0xF8, 0xCA, 0x75, 0x2F, 0x94, 0xEB, 0xA4, 0x26, 0x1D, 0xF9, 0x3E, 0x47, 0xA0, 0x4D,
-    0x72, 0xE4, 0x3D, 0xD1, 0x86, 0x6A, 0x93, 0xF9, 0xEA, 0x97, 0xA8, 0x5E, 0xD0, 0x52, 0x11, 0x96,
-    0xB4, 0xA4, 0x2E, 0x75, 0xCF, 0xA2, 0x1C, 0x9B, 0xBD, 0x17, 0x86, 0xA3, 0x5A, 0x91, 0x06, 0x4D,
-    0x3C, 0xF1, 0xD3, 0x64, 0xB7, 0x9B, 0x26, 0x8A, 0x5F, 0x26, 0x99, 0x98, 0xC4, 0xCF, 0x03, 0xC5,
-    0x03, 0xCE, 0x7C, 0xF5, 0x01, 0x7F, 0x61, 0x46, 0xC9, 0xC7, 0x89, 0x13, 0xDD, 0x11, 0xF4, 0x4C,
-    0x46, 0x09, 0x5E, 0x7B, 0xAE, 0xE4, 0xBC, 0xE3, 0x76, 0x0A, 0xD7, 0x1F, 0xC0, 0x88, 0x3B, 0x47,
-    0xED, 0x6A, 0xBB, 0xBA, 0x73, 0x64, 0xC4, 0xE8, 0x0C, 0x0F, 0x13, 0x8A, 0xE4, 0x85, 0x1E, 0x63,
-    0x8E, 0x21, 0x86, 0xF5, 0x99, 0xC3, 0x9B, 0x99, 0xD8, 0x21, 0x75, 0x60, 0xCF, 0x8D, 0x79, 0x48,
-    0x7F, 0x07, 0x4E, 0x3A, 0x77, 0xD3, 0xB3, 0x01, 0x36, 0xFB, 0xB8, 0xBD, 0x8E, 0x25, 0x1A, 0x0D,
-    0xE2, 0xE0, 0xEB, 0x24, 0x72, 0x26, 0xB2, 0x50, 0x54, 0x90, 0xD5, 0x9B, 0x9B, 0x82, 0x6F, 0x9E,
-    0x9F, 0x67, 0xCF, 0xDE, 0x55, 0x8C, 0x7E, 0x06, 0xF3, 0x91, 0xDA, 0x52, 0xCE, 0xA6, 0x0F, 0x34,
-    0xB9, 0xA3, 0x4B, 0x2B, 0x15, 0x5C, 0x67, 0xE3, 0x48, 0x9E, 0x2B, 0x5C, 0x67, 0x4C, 0x99, 0xD3,
-    0x6A, 0x27, 0x1D, 0xB6, 0xAD, 0xE9, 0xF5, 0x98, 0xAA, 0x1F, 0x28, 0x2E, 0x63, 0xA1, 0xFE, 0x97,
-    0xFC, 0xEA, 0xEE, 0xAE, 0x50, 0xBC, 0xFA, 0x53, 0xD6, 0x52, 0xB2, 0x47, 0x6D, 0x4B, 0xC5, 0x63,
-    0x76, 0x72, 0x5E, 0x3F, 0xF8, 0x09, 0x17, 0x42, 0x6A, 0x72, 0xA0, 0xA6, 0x02, 0xB9, 0x18, 0x96,
-    0xA7, 0x9D, 0x81, 0x37, 0x1F, 0x83, 0xE1, 0xFD, 0xA6, 0x35, 0x78, 0x83, 0x6C, 0x81, 0x1A, 0x62,
-    0xE4, 0x24, 0x98, 0x08, 0x3A, 0x31, 0xA9, 0x00, 0xF8, 0x9F, 0x9B, 0xE1, 0x42, 0xD3, 0x6C, 0xAD,
-    0x54, 0x1A, 0xBD, 0x68, 0x61, 0x65, 0x0F, 0x6B, 0x23, 0x8C, 0xE8, 0x35, 0x42, 0x61, 0xDF, 0x3F,
-    0xF8, 0x85, 0xBE, 0x63, 0x27, 0xB3, 0x00, 0x67, 0xFF, 0x20, 0x9F, 0xFE, 0x1D, 0x05, 0x61, 0x80,
-    0x32, 0xCA, 0xE2, 0xD7, 0xD8, 0x96, 0x96, 0x18, 0x47, 0xEB, 0x7E, 0xA1, 0x93, 0x24, 0xC3, 0xA6,
-    0x59, 0x3B, 0xBA, 0x71, 0xCB, 0xEB, 0x1E, 0xA8, 0xC0, 0xBD, 0x0A, 0x38, 0x61, 0x5E, 0x05, 0xDC,
-    0xDB, 0x9E, 0xB0, 0x61, 0x0B, 0x43, 0x18, 0x0A, 0x24, 0x50, 0xA1, 0x02, 0x7C, 0x3E, 0xDA, 0x98,
-    0x0F, 0x8F, 0xE7, 0x7B, 0xC7, 0x1F, 0x85, 0x9C, 0xF3, 0x89, 0x3B, 0x5C, 0x74, 0xE4, 0xB2, 0x78,
-    0xEB, 0x85, 0xFF, 0xCB, 0xD9, 0xD7, 0x13, 0xCF, 0x91, 0x4E, 0xA4, 0x91, 0xE0, 0xA9, 0x84, 0xFB,
-    0x14, 0xD6, 0x59, 0x66, 0xDB, 0x4D, 0xF0, 0x63, 0x06, 0x77, 0x83, 0xD9, 0xAF, 0xBC, 0xA3, 0x89,
-    0x82, 0x35, 0xAB, 0xEE, 0x4C, 0x66, 0x2D, 0xFA, 0xBD, 0x72, 0xB1, 0xA8, 0x44, 0x6E, 0xC2, 0x7D,
-    0x7B, 0x5A, 0x40, 0xE9, 0x21, 0xAF, 0xAC, 0x02, 0xA6, 0x58, 0x5C, 0x38, 0xD7, 0x24, 0x54, 0x4B,
-    0x98, 0x59, 0x62, 0xB8, 0x52, 0xD9, 0x5F, 0x8C, 0x7D, 0xB5, 0xC9, 0x91, 0xC7, 0xA2, 0x1E, 0x5E,
-    0xB6, 0xE0, 0x63, 0x49, 0xBC, 0xCB, 0xB5, 0x15, 0xE4, 0x39, 0xF6, 0x54, 0x3C, 0xF6, 0x38, 0x06,
-    0xFE, 0xC5, 0x49, 0xE6, 0x71, 0x2B, 0xEA, 0x13, 0x65, 0x39, 0xEA, 0xAB, 0xDD, 0x48, 0x9D, 0x09,
-    0xC0, 0xC8, 0xCE, 0x29, 0x29, 0xF1, 0x1E, 0xB0, 0xAE, 0xBD, 0x6C, 0xC3, 0x5B, 0xE8, 0x5C, 0x48,
-    0xED, 0x7B, 0x75, 0xAF, 0x4E, 0x8B, 0x6E, 0xE4, 0x44, 0x02, 0x87, 0xB0, 0x7C, 0x3D, 0xB6, 0x85,
-    0xCA, 0xD8, 0x77, 0x76, 0xC2, 0x70, 0xD0, 0xBC, 0xA8, 0x2F, 0xF6, 0xA3, 0xAC, 0xBE, 0x24, 0x62,
-    0x51, 0x83, 0xD8, 0x2E, 0x5F, 0xD7, 0x8D, 0xD6, 0x3D, 0x94, 0x73, 0xF1, 0x13, 0x71, 0xCC, 0x94,
-    0xE7, 0xEB, 0xE1, 0xA6, 0x1A, 0x1F, 0xFE, 0xB1, 0x96, 0x58, 0x7F, 0x24, 0xC6, 0x9F, 0xB3, 0x13,
-    0xBD, 0x11, 0x94, 0x4A, 0xBD, 0x61, 0xA9, 0xB4, 0x79, 0x08, 0x1C, 0x9D, 0x1D, 0xD3, 0x71, 0x79,
-    0x79, 0xFF, 0xE7, 0xBB, 0xAF, 0xEC, 0xD9, 0x27, 0xDF, 0xE5, 0xA5, 0xF1, 0x6D, 0xDC, 0x3C, 0x39,
-    0xDC, 0xDA, 0x6E, 0xB0, 0x6F, 0x9E, 0x0C, 0x8C, 0xDF, 0xE3, 0x2D, 0x96, 0x18, 0x37, 0x7E, 0x1C,
-    0x31, 0x9B, 0xBC, 0x85, 0xBB, 0xB2, 0x90, 0x8C, 0x37, 0x55, 0xAE, 0x79, 0x06, 0xAF, 0x3C, 0x86,
-    0x96, 0x9E, 0xA6, 0x84, 0xB4, 0x9C, 0x9E, 0x5E, 0x46, 0xBE, 0xAF, 0x86, 0x9E, 0x4A, 0x05, 0x4D,
-    0x32, 0x9C, 0x59, 0xDE, 0xF4, 0xD7, 0xB8, 0xC5, 0x04, 0x75, 0xD3, 0x94, 0x22, 0xDA, 0xC1, 0xB3,
-    0x2C, 0x00, 0x76, 0xC5, 0x84, 0x99, 0x14, 0x67, 0xDC, 0x63, 0xA6, 0x93, 0x9F, 0x4D, 0x33, 0x0D,
-    0xDA, 0x84, 0x47, 0xAA, 0x46, 0x9A, 0xBE, 0xC2, 0x60, 0x13, 0x77, 0xD3, 0x34, 0x61, 0x91, 0xBB,
-    0x73, 0x2E, 0x2E, 0x0C, 0xDC, 0x4D, 0xC9, 0x6A, 0xE9, 0x5F, 0x93, 0x29, 0x16, 0x18, 0x1A, 0x19,
-    0x9E, 0x05, 0xB6, 0x37, 0x09, 0xA8, 0x29, 0x23, 0x9F, 0x65, 0x46, 0x22, 0x5A, 0xCE, 0x02, 0x2F,
-    0xBF, 0xD8, 0x2A, 0xA2, 0x1D, 0x95, 0x83, 0x0F, 0xE3, 0x20, 0x08, 0xE2, 0x7D, 0xBE, 0x44, 0x51,
-    0x6C, 0x05, 0xFD, 0xD6, 0x7E, 0xD8, 0x47, 0x0B, 0x35, 0xC2, 0xAF, 0xA2, 0xC0, 0xA8, 0x6A, 0xBC,
-    0xA9, 0xA7, 0x5F, 0xF1, 0x44, 0x3B, 0x08, 0x5A, 0x7E, 0x3B, 0x68, 0xF7, 0x5B, 0x75, 0xDA, 0xAC,
-    0x70, 0x9B, 0x3B, 0x2B, 0x97, 0xBD, 0x0A, 0xE3, 0xFB, 0x45, 0x00, 0x6E, 0x84, 0xAD, 0x72, 0x8B,
-    0x7A, 0xDA, 0x30, 0x89, 0x45, 0x4B, 0xD0, 0x2F, 0xF6, 0x9F, 0x26, 0x51, 0xC8, 0x08, 0xE9, 0x07,
-    0x61, 0x87, 0xD5, 0x7D, 0xA0, 0x0C, 0xA0, 0xDA, 0x45, 0xED, 0x8B, 0x6B, 0x1A, 0x56, 0x30, 0x2A,
-    0xA1, 0xDC, 0xED, 0xA2, 0x39, 0x66, 0x21, 0xCF, 0x56, 0xAE, 0xBE, 0x71, 0x49, 0xED, 0xD5, 0xFA,
-    0x97, 0x80, 0x9A, 0x04, 0x78, 0x8F, 0xD4, 0xCE, 0x68, 0x43, 0x55, 0x0D, 0xAC, 0x16, 0xD1, 0xB8,
-    0x8D, 0x95, 0x25, 0x94, 0x2A, 0xD0, 0xD7, 0x91, 0xF7, 0xE9, 0x7E, 0xAC, 0x56, 0x50, 0xDB, 0x80,
-    0xDE, 0x53, 0x35, 0x26, 0x17, 0x60, 0x69, 0x0B, 0x9B, 0x1D, 0xFC, 0x03, 0xD5, 0x7D, 0x5D, 0x8C,
-    0x1C, 0xD7, 0x95, 0xDE, 0xAD, 0x2A, 0x72, 0xCA, 0x66, 0x45, 0x53, 0x44, 0x20, 0xAD, 0xB4, 0xA2,
-    0xC8, 0xD2, 0x83, 0x1E, 0x14, 0x9A, 0x62, 0xEF, 0x03, 0x11, 0x8C, 0x81, 0x61, 0x57, 0x51, 0x42,
-    0x62, 0x20, 0x06, 0x22, 0x26, 0x10, 0x2D, 0x24, 0xCA, 0x2E, 0xFD, 0xB0, 0x8B, 0x00, 0xF2, 0xC6,
-    0xC3, 0x00, 0x7C, 0x20, 0x10, 0x4E, 0x57, 0xC9, 0x7A, 0xF0, 0x43, 0x10, 0x78, 0x12, 0xC0, 0xCA,
-    0x83, 0x13, 0x84, 0x0F, 0x0A, 0x40, 0x35, 0xB1, 0x99, 0x79, 0xA0, 0x11, 0x21, 0x98, 0x99, 0x2A,
-    0x49, 0xD8, 0xF8, 0xC1, 0x08, 0x5C, 0xB2, 0x64, 0xEB, 0xC1, 0x01, 0x54, 0xF6, 0x92, 0x0E, 0x22,
-    0x6E, 0xC2, 0xA2, 0xD5, 0x8C, 0x6B, 0x86, 0xD5, 0x5D, 0xF9, 0xBE, 0x73, 0xAB, 0x6A, 0xBA, 0x87,
-    0x33, 0xC3, 0x1F, 0x0D, 0x49, 0xED, 0x70, 0xEE, 0xB9, 0x3D, 0xDD, 0xD5, 0x55, 0xF7, 0xE7, 0xDC,
-    0x73, 0xBE, 0xF3, 0x73, 0x2F, 0x95, 0xC2, 0xCF, 0x0A, 0x8A, 0x8F, 0xE2, 0x46, 0x4A, 0x99, 0x09,
-    0x5E, 0x9C, 0xE4, 0xBB, 0x2A, 0xAE, 0xAA, 0xE2, 0x74, 0x55, 0x95, 0x56, 0xAE, 0xCE, 0xA3, 0xCC,
-    0xA2, 0x1C, 0x41, 0xD9, 0x83, 0xA2, 0xDA, 0xB2, 0xDE, 0x8F, 0xAC, 0xAA, 0x4A, 0x26, 0xDE, 0xDB,
-    0x28, 0x0E, 0x8A, 0x8B, 0xE2, 0x79, 0xEB, 0x7D, 0xDC, 0xAE, 0xAA, 0xD4, 0xC9, 0xBD, 0x4A, 0x15,
-    0x78, 0x50, 0xE9, 0x26, 0xEA, 0xC2, 0xBE, 0x40, 0xD5, 0x3F, 0x0F, 0xE2, 0x59, 0x3E, 0x4A, 0xAA,
-    0x34, 0x9D, 0x35, 0x73, 0x2B, 0x55, 0x33, 0x66, 0x6E, 0xA4, 0xEA, 0x98, 0x99, 0xAB, 0x54, 0x3D,
-    0x0B, 0xBA, 0x80, 0xFE, 0xE6, 0x7C, 0x7C, 0x43, 0x9F, 0x40, 0x83, 0xCC, 0xF5, 0x6A, 0x08, 0x5A,
-    0xBD, 0x55, 0x05, 0xCA, 0x1C, 0x28, 0x2F, 0xE1, 0xA7, 0x4E, 0x46, 0x6A, 0xE7, 0xB7, 0x51, 0x79,
-    0xDF, 0x49, 0x95, 0x35, 0x50, 0xE8, 0xD1, 0x81, 0xA1, 0x11, 0x2B, 0x55, 0x55, 0x1F, 0x0D, 0x70,
-    0xBB, 0x27, 0x50, 0x7A, 0x28, 0xA5, 0xBE, 0xBF, 0x85, 0xD1, 0x35, 0xDA, 0xDE, 0x0E, 0xD0, 0xDB,
-    0x02, 0xAD, 0x7D, 0x17, 0x65, 0xA6, 0x2E, 0xCF, 0x6D, 0xD3, 0xB3, 0x1D, 0x8B, 0xB7, 0xC6, 0x07,
-    0x26, 0xFA, 0xC6, 0x4E, 0x95, 0xA9, 0xF8, 0x47, 0x25, 0x9A, 0xBD, 0x6A, 0xA3, 0xEB, 0x68, 0xD1,
-    0x0B, 0x9D, 0x40, 0x4F, 0x2E, 0x4B, 0xC8, 0x72, 0xEA, 0x94, 0x0A, 0x31, 0x11, 0x61, 0xFD, 0xB7,
-    0x7C, 0x86, 0x6B, 0x3A, 0x68, 0x1E, 0xAE, 0x67, 0x4F, 0xA7, 0xAC, 0x42, 0x1D, 0x55, 0xD5, 0xB5,
-    0x52, 0x79, 0xB8, 0x9F, 0x7A, 0x45, 0x6E, 0x6D, 0x54, 0x85, 0x72, 0xAE, 0xC6, 0xAA, 0x13, 0x78,
-    0x51, 0x17, 0xAC, 0xD2, 0x55, 0x4E, 0xD0, 0x6D, 0xBE, 0x8F, 0xEF, 0x7A, 0xE8, 0xB2, 0x5D, 0xE1,
-    0x45, 0x5C, 0xB0, 0x1D, 0xEC, 0x25, 0xEE, 0xE6, 0xA5, 0xBC, 0xE3, 0x73, 0x18, 0xA7, 0x73, 0xCA,
-    0xCA, 0x96, 0x95, 0x9D, 0xF6, 0xF0, 0x94, 0xCE, 0xBF, 0x0D, 0x71, 0x2D, 0xAE, 0xDB, 0xCB, 0xB1,
-    0x88, 0x4E, 0x0F, 0x03, 0xF4, 0xE4, 0x5E, 0x7F, 0xD1, 0xF1, 0xAA, 0x8A, 0x1E, 0xDF, 0xAB, 0x96,
-    0xBD, 0x08, 0xBF, 0xCF, 0xEF, 0x6B, 0x59, 0xE9, 0x0B, 0xDD, 0xD0, 0xA9, 0x8A, 0xBD, 0xD5, 0xC7,
-    0xEC, 0xD6, 0x17, 0xF9, 0xED, 0xC9, 0xAA, 0x2A, 0xD5, 0x81, 0x5C, 0xF5, 0xC0, 0x46, 0xE0, 0xC1,
-    0x11, 0x86, 0x10, 0xE3, 0x7E, 0x93, 0xEB, 0x4C, 0x06, 0x7A, 0x53, 0x35, 0xBD, 0x4D, 0xF5, 0xD9,
-    0xDB, 0x4A, 0x1D, 0x52, 0x6E, 0x05, 0x6E, 0x3C, 0x88, 0x37, 0xBD, 0x4C, 0x2A, 0xB0, 0xDB, 0x11,
-    0x54, 0x46, 0xA1, 0x66, 0x59, 0x95, 0x52, 0xE1, 0x79, 0xE7, 0xF4, 0x5F, 0x97, 0xE5, 0x33, 0x23,
-    0x97, 0x2B, 0x17, 0x59, 0x39, 0x19, 0x78, 0x24, 0xFC, 0x2C, 0x8E, 0xC2, 0x00, 0x6B, 0xA8, 0x50,
-    0x7B, 0xDA, 0xC1, 0xE2, 0x9D, 0xE7, 0x86, 0xC1, 0x1C, 0xF8, 0x08, 0x3C, 0xED, 0x68, 0xB6, 0x02,
-    0x5F, 0xDF, 0x55, 0x55, 0x49, 0xCF, 0xB0, 0x32, 0x2F, 0xAD, 0xC7, 0x99, 0xBC, 0x69, 0x0D, 0xF4,
-    0x67, 0xA5, 0xAE, 0x86, 0xBA, 0x5A, 0x9D, 0xA8, 0x86, 0xE3, 0x97, 0x58, 0x05, 0x06, 0xDE, 0x5B,
-    0x5F, 0xCC, 0x2A, 0xB6, 0x65, 0xA4, 0xBE, 0xE0, 0xB2, 0xED, 0x83, 0xF5, 0xC0, 0xFF, 0x1D, 0x59,
-    0xB6, 0xEE, 0x18, 0x75, 0xB6, 0xA2, 0x18, 0x47, 0x2C, 0xDE, 0x03, 0x43, 0xE5, 0x0C, 0x30, 0xF9,
-    0x29, 0xF9, 0xD6, 0xA0, 0xF4, 0xB3, 0x79, 0x67, 0x99, 0x02, 0x8F, 0x8F, 0x98, 0x21, 0xD9, 0xBF,
-    0xC1, 0x60, 0x10, 0x56, 0xC3, 0x20, 0x64, 0x87, 0x3B, 0xE4, 0xB4, 0x59, 0x8E, 0xC7, 0x00, 0xC4,
-    0x84, 0x20, 0xC8, 0x9D, 0x08, 0xE4, 0x10, 0xC7, 0xE8, 0x1C, 0x85, 0x56, 0xC1, 0x61, 0x1A, 0xF2,
-    0xCF, 0x98, 0xC4, 0xC7, 0x43, 0x73, 0x37, 0x03, 0xB1, 0xE5, 0x1B, 0x25, 0xBF, 0x5B, 0x91, 0x84,
-    0x11, 0xEF, 0x97, 0x62, 0x34, 0x9C, 0x02, 0x63, 0x61, 0x54, 0xF5, 0xF3, 0xB0, 0x22, 0xDB, 0xBE,
-    0xAA, 0x77, 0x85, 0xBE, 0x20, 0x74, 0xAF, 0xDA, 0x10, 0x9F, 0x91, 0x5F, 0xA5, 0x68, 0xD3, 0x81,
-    0x11, 0xDB, 0xA3, 0x6F, 0x0A, 0xE6, 0x20, 0x63, 0x0B, 0x75, 0x84, 0x1E, 0x15, 0xFA, 0x63, 0x52,
-    0xE3, 0xD7, 0xA4, 0xF6, 0x1B, 0xA4, 0xAE, 0x5C, 0x39, 0x2B, 0x34, 0x27, 0xFD, 0x9C, 0x8C, 0x65,
-    0xDD, 0x0A, 0x48, 0x87, 0x72, 0x9F, 0x41, 0x7D, 0xB7, 0x96, 0xA2, 0x95, 0xF6, 0x28, 0xA8, 0xE4,
-    0xB9, 0x6A, 0x9F, 0x7A, 0x0E, 0x02, 0x44, 0x1D, 0xA7, 0x14, 0x19, 0x72, 0xF5, 0x53, 0xFC, 0x9D,
-    0xAA, 0xDB, 0x06, 0x59, 0x13, 0x97, 0xE0, 0xAE, 0xD3, 0x03, 0x17, 0xD3, 0x9D, 0x60, 0x64, 0xED,
-    0x00, 0x8D, 0x72, 0x15, 0xF8, 0x74, 0x5A, 0xA9, 0x21, 0x18, 0x19, 0x82, 0x68, 0x86, 0x52, 0xE8,
-    0x2C, 0x86, 0x3B, 0x41, 0x3F, 0xDD, 0x14, 0x62, 0xC3, 0xFE, 0x1D, 0x86, 0xDF, 0xFA, 0x9C, 0x52,
-    0x53, 0x46, 0xA2, 0x6A, 0x54, 0x15, 0x86, 0x1B, 0x3F, 0x18, 0x5B, 0xF5, 0x2D, 0x8E, 0x09, 0x9E,
-    0x0F, 0x42, 0x4D, 0xB2, 0x47, 0x8F, 0x84, 0x16, 0x00, 0xF7, 0x27, 0x03, 0xEE, 0x47, 0x6C, 0x80,
-    0xF9, 0x87, 0x8A, 0x0B, 0x81, 0x52, 0x58, 0x4B, 0x62, 0x5F, 0x6D, 0xD0, 0xA3, 0x42, 0x0F, 0x0A,
-    0xFD, 0x8A, 0xD0, 0xAE, 0xD0, 0x50, 0xCF, 0x9C, 0xA8, 0xC0, 0xEB, 0x11, 0x25, 0xEC, 0xA7, 0xFC,
-    0xAE, 0xF5, 0x13, 0xF6, 0xC7, 0x7A, 0x93, 0x5D, 0x73, 0x5E, 0x12, 0x36, 0xC4, 0x70, 0x53, 0x06,
-    0x40, 0x8F, 0x60, 0xAC, 0x56, 0x64, 0x00, 0xA8, 0x57, 0xE6, 0x4F, 0x85, 0x32, 0xBC, 0xEC, 0x7B,
-    0xA6, 0xBC, 0x48, 0x81, 0xFB, 0xC0, 0xB2, 0x56, 0x42, 0x96, 0xB6, 0x23, 0x99, 0x76, 0xA1, 0x10,
-    0xC2, 0x0E, 0x5A, 0x58, 0x42, 0xEE, 0x47, 0xB5, 0xEA, 0x19, 0x6C, 0x52, 0x3D, 0xFB, 0x27, 0xD4,
-    0x0A, 0x6E, 0x69, 0xDD, 0x9C, 0xC3, 0x35, 0x06, 0x97, 0x28, 0x17, 0x6D, 0x38, 0x56, 0x7A, 0x28,
-    0x43, 0x72, 0x2E, 0x16, 0x6D, 0x8E, 0x15, 0x1B, 0xC4, 0x15, 0x64, 0x07, 0x6E, 0x4A, 0xA6, 0x36,
-    0x85, 0x41, 0x84, 0xFF, 0x56, 0x5A, 0x32, 0x6C, 0xDE, 0x03, 0x13, 0x5B, 0xEB, 0x71, 0xC4, 0x27,
-    0xF0, 0x62, 0x43, 0xAE, 0xEB, 0x91, 0xF8, 0x42, 0x82, 0x49, 0xA2, 0xBF, 0xEB, 0xAD, 0x5F, 0x2A,
-    0xD8, 0xCD, 0xE8, 0x81, 0xE8, 0x4D, 0xA3, 0x92, 0x11, 0x9C, 0xAB, 0xD8, 0x09, 0x57, 0x3E, 0x72,
-    0xA0, 0xAA, 0x26, 0xA9, 0x3B, 0x46, 0xA7, 0xC7, 0xE8, 0x63, 0x42, 0x9F, 0x11, 0x7A, 0x44, 0xE8,
-    0xAC, 0xD0, 0x19, 0xA1, 0x97, 0x85, 0xE6, 0xA4, 0x46, 0x46, 0x8A, 0xA9, 0x01, 0xFD, 0xCE, 0x67,
-    0x90, 0x96, 0x81, 0x40, 0x94, 0x88, 0xD3, 0x1F, 0x46, 0xCB, 0x02, 0xBE, 0xB8, 0xB4, 0xED, 0x68,
-    0x89, 0xB3, 0x5F, 0x53, 0x4A, 0x22, 0x23, 0x78, 0x10, 0xD8, 0xC8, 0xAB, 0x20, 0x93, 0xA0, 0xAE,
-    0x1D, 0x00, 0x96, 0x81, 0x39, 0x0A, 0x30, 0x3B, 0x5E, 0x62, 0x60, 0xD9, 0x1E, 0x47, 0x43, 0x20,
-    0x72, 0xA9, 0x95, 0x22, 0x70, 0x0F, 0x1A, 0xE4, 0x46, 0x87, 0x28, 0x7E, 0x52, 0x37, 0x92, 0x75,
-    0x97, 0xBB, 0xD1, 0x65, 0x59, 0x84, 0xEE, 0x1B, 0x22, 0x97, 0xFC, 0xC5, 0x6B, 0x59, 0x8D, 0x69,
-    0x44, 0x42, 0x95, 0xEE, 0xF7, 0xC8, 0xA8, 0x16, 0x40, 0xDE, 0x90, 0x2C, 0x8C, 0xEB, 0xC9, 0xA6,
-    0x2E, 0xBE, 0x0F, 0xD1, 0x07, 0xA8, 0xE0, 0x46, 0x6E, 0x4A, 0xEE, 0xC7, 0xFD, 0x73, 0x2E, 0x7F,
-    0x3C, 0x0F, 0x3C, 0x23, 0xCF, 0x1F, 0x29, 0x0F, 0x2C, 0x76, 0x45, 0x41, 0x4B, 0xA1, 0x37, 0x23,
-    0x6A, 0x4F, 0x3E, 0x1A, 0x33, 0xE3, 0x5D, 0x8D, 0x23, 0x1F, 0x37, 0x99, 0x87, 0x64, 0xA6, 0xB4,
-    0xDD, 0x23, 0x3D, 0xA3, 0x0A, 0xA2, 0x90, 0x06, 0xC6, 0x39, 0x8C, 0x35, 0x12, 0x42, 0xC7, 0x52,
-    0xF0, 0x8B, 0xF4, 0x86, 0xC8, 0x52, 0x66, 0xB1, 0x07, 0xE5, 0x3C, 0xF4, 0xC1, 0xB2, 0x88, 0x5F,
-    0x27, 0xF3, 0x3F, 0x9E, 0x8B, 0x6C, 0x4A, 0xE3, 0xBD, 0x8F, 0x5C, 0x68, 0x4E, 0xA9, 0xA7, 0xA8,
-    0x5E, 0x02, 0x41, 0xDE, 0x09, 0xC7, 0xC8, 0xAE, 0x38, 0x72, 0xEA, 0x89, 0xE0, 0xCB, 0x21, 0xD6,
-    0x1F, 0x9A, 0x9E, 0x33, 0xC5, 0x32, 0x20, 0x3A, 0x92, 0x25, 0xE8, 0xC8, 0x52, 0x73, 0xD2, 0x86,
-    0x4E, 0x6F, 0x43, 0x0F, 0x09, 0x3D, 0x38, 0x46, 0x8F, 0x08, 0x9D, 0x1D, 0xA3, 0xE7, 0x84, 0x5E,
-    0x26, 0x35, 0x04, 0xA7, 0x2F, 0x0A, 0x96, 0xC7, 0xBA, 0x07, 0x5E, 0x0D, 0x03, 0x2C, 0xFE, 0x1A,
-    0x09, 0xC5, 0x25, 0x9B, 0x9F, 0x9D, 0x1E, 0x71, 0x1A, 0x4E, 0x5A, 0x50, 0x36, 0x2E, 0x5A, 0x8C,
-    0x6A, 0x1A, 0xD5, 0xA7, 0x91, 0x7A, 0x06, 0xD5, 0xCF, 0x12, 0x35, 0xCB, 0x0A, 0x58, 0x04, 0xD5,
-    0x4F, 0x32, 0xB5, 0x84, 0xEA, 0x83, 0x5C, 0xE5, 0xA8, 0xDE, 0x1F, 0x18, 0x29, 0xAA, 0xF7, 0x4A,
-    0x33, 0x41, 0x95, 0x94, 0x56, 0xC4, 0x6A, 0xD5, 0x0E, 0x58, 0xF9, 0xAE, 0x92, 0xEA, 0x1F, 0x4A,
-    0xE5, 0xFD, 0x07, 0xA9, 0x70, 0x7F, 0x56, 0x00, 0x1E, 0xAC, 0x6C, 0x0A, 0x48, 0x0F, 0x23, 0x3D,
-    0x85, 0xE1, 0x2F, 0xCD, 0x14, 0xC8, 0x1B, 0xE3, 0x1F, 0x56, 0x49, 0x3B, 0xFB, 0x16, 0x87, 0x91,
-    0xD0, 0xE6, 0x0E, 0x14, 0xEA, 0x68, 0x20, 0xC0, 0xEC, 0x2E, 0xAF, 0x6F, 0x28, 0xEE, 0x8F, 0x29,
-    0x39, 0x40, 0x55, 0xC6, 0xE7, 0x6A, 0x0E, 0x3C, 0x40, 0x03, 0x20, 0x7E, 0x6B, 0xC8, 0x4F, 0x3B,
-    0x11, 0xC6, 0x0F, 0xEB, 0x38, 0xC1, 0xFA, 0xC2, 0x8A, 0xC3, 0x14, 0x73, 0x85, 0x81, 0x18, 0x05,
-    0xB8, 0xD7, 0x28, 0xB7, 0x22, 0xF2, 0xA9, 0x5C, 0x27, 0xDF, 0xF0, 0x84, 0x29, 0xA0, 0x8E, 0x52,
-    0xB2, 0x40, 0xA4, 0x46, 0x7F, 0x0F, 0xE3, 0x2D, 0x46, 0x86, 0x7A, 0x5C, 0x44, 0x08, 0x9E, 0x0D,
-    0x51, 0x57, 0x3D, 0x34, 0xDD, 0xDD, 0x74, 0x38, 0xAE, 0x12, 0x6A, 0x31, 0x3C, 0x1B, 0x2D, 0x13,
-    0x08, 0x4B, 0x71, 0xBB, 0x52, 0x6B, 0xBF, 0xA6, 0x0C, 0xF5, 0xFB, 0xF6, 0x00, 0x4A, 0x2C, 0xB5,
-    0x70, 0xFD, 0xDD, 0x1B, 0x65, 0x6F, 0xED, 0x6C, 0x94, 0x6D, 0x2A, 0x77, 0x63, 0x94, 0x09, 0x42,
-    0x16, 0x82, 0x25, 0x6E, 0xA5, 0x33, 0xC0, 0xFB, 0xE9, 0x31, 0x2C, 0xE1, 0xF4, 0x59, 0x90, 0x05,
-    0x25, 0xA0, 0xE1, 0x3E, 0x89, 0x49, 0x62, 0x0F, 0xA9, 0x9B, 0xF0, 0xAC, 0x87, 0x0B, 0xE0, 0x00,
-    0x1C, 0x5F, 0x11, 0xA1, 0x4F, 0x61, 0x2E, 0xF6, 0x23, 0xB0, 0xC5, 0xC7, 0x14, 0xEC, 0xC4, 0x0C,
-    0xE6, 0xE8, 0xE5, 0xBF, 0x1C, 0x61, 0x38, 0x60, 0x43, 0x26, 0x5E, 0x42, 0xB3, 0xC6, 0xA7, 0x8D,
-    0x93, 0x87, 0x62, 0xE9, 0x90, 0x9A, 0xC5, 0xAA, 0xD0, 0xB0, 0xA5, 0xD6, 0x40, 0x5F, 0x23, 0xD7,
-    0xA7, 0xF2, 0xDD, 0x48, 0xDF, 0x47, 0xDF, 0xB3, 0xBE, 0xBF, 0xA2, 0x5A, 0xAA, 0x9F, 0x6B, 0xC0,
-    0x48, 0x46, 0xDF, 0x83, 0x6A, 0xE0, 0x8D, 0x54, 0x98, 0x52, 0x3B, 0xB1, 0xA3, 0x68, 0x77, 0xCC,
-    0x76, 0xFB, 0x01, 0xE7, 0xF8, 0x7D, 0x4E, 0xCC, 0xFF, 0x0A, 0x94, 0x88, 0x09, 0x0E, 0x06, 0x7E,
-    0x46, 0x4D, 0x47, 0xAD, 0xEB, 0xFC, 0xF4, 0x65, 0x8A, 0x29, 0x6A, 0xA3, 0x59, 0x0E, 0xE9, 0x65,
-    0xDC, 0x02, 0x40, 0x20, 0x54, 0x50, 0xB0, 0x7E, 0xE4, 0x5D, 0x81, 0xAA, 0x8B, 0x4B, 0xAB, 0x2A,
-    0x1F, 0x0D, 0x66, 0x5D, 0x8F, 0x1A, 0xCC, 0xAA, 0x95, 0xA6, 0xA2, 0x3D, 0xC4, 0x96, 0x8F, 0x51,
-    0xF1, 0x06, 0x29, 0x83, 0xF2, 0x00, 0xBF, 0x90, 0x43, 0x1E, 0x44, 0xD1, 0x80, 0xC2, 0xE0, 0x6E,
-    0x24, 0x8A, 0xD6, 0x2A, 0x1A, 0xFD, 0xA9, 0xF8, 0xB7, 0x71, 0xCE, 0x01, 0xBF, 0x95, 0x73, 0x78,
-    0x2D, 0xD1, 0xEC, 0x3B, 0xD3, 0x03, 0x43, 0xAD, 0x03, 0xB1, 0x32, 0xDF, 0xAC, 0x06, 0x22, 0x0A,
-    0x4F, 0x54, 0xA9, 0x16, 0x86, 0x7E, 0xA0, 0x81, 0xA6, 0x5F, 0x3F, 0xEA, 0x91, 0xD4, 0x04, 0x53,
-    0x2D, 0xF6, 0xAF, 0xBE, 0xEC, 0xED, 0xAC, 0xE7, 0xBB, 0x92, 0xE5, 0xD6, 0x2E, 0x2D, 0x2C, 0xD3,
-    0xBA, 0xB6, 0xEA, 0xDA, 0xAC, 0x6B, 0xA3, 0xAE, 0x15, 0xB0, 0x00, 0x56, 0xA7, 0x4F, 0xDD, 0x4E,
-    0xEC, 0x29, 0x90, 0x5B, 0x1D, 0x23, 0x79, 0x56, 0x26, 0x6A, 0x8C, 0xAC, 0xFF, 0x67, 0xB1, 0x1E,
-    0xD2, 0x46, 0xEB, 0x8F, 0x19, 0x02, 0x82, 0xF2, 0xC3, 0xF6, 0xD5, 0xAA, 0xFE, 0xD4, 0xA6, 0xC1,
-    0x40, 0xE3, 0x5F, 0xD1, 0xF4, 0xC7, 0x2A, 0x40, 0xCD, 0x65, 0xA0, 0xE6, 0x34, 0xD7, 0xD8, 0x79,
-    0x23, 0x53, 0x77, 0xAC, 0xD6, 0xDF, 0x91, 0x4A, 0xA4, 0x37, 0x9F, 0x5D, 0xE8, 0xCF, 0x4A, 0x5D,
-    0xAD, 0xEA, 0x2A, 0xD4, 0x95, 0x3F, 0xF1, 0x57, 0x4F, 0x57, 0x43, 0xA9, 0xCC, 0xC2, 0xCE, 0xA5,
-    0x35, 0xE2, 0x0A, 0x1A, 0x69, 0xC5, 0x10, 0x29, 0xB6, 0x67, 0x5B, 0x53, 0x82, 0x8F, 0x96, 0xE7,
-    0xCA, 0x43, 0xC7, 0xED, 0x25, 0x7F, 0x93, 0xBD, 0x54, 0x68, 0x27, 0xC7, 0x48, 0x8F, 0x72, 0x55,
-    0x10, 0xD4, 0x06, 0x1A, 0xD4, 0x02, 0xA6, 0x09, 0x58, 0x15, 0x1B, 0x6F, 0x58, 0x97, 0x55, 0x75,
-    0xB8, 0x0F, 0xE9, 0x23, 0x5F, 0x58, 0xAD, 0x0B, 0xDF, 0x2F, 0x79, 0xDD, 0x06, 0xA8, 0x75, 0x13,
-    0xFF, 0x43, 0x40, 0xDB, 0xDA, 0x9D, 0xB6, 0x81, 0x1C, 0x6D, 0x88, 0x36, 0xB4, 0xDC, 0x7F, 0x6B,
-    0xA4, 0x87, 0xDA, 0x03, 0xEC, 0x22, 0x64, 0x64, 0x53, 0x09, 0xCB, 0xA0, 0x88, 0x13, 0xDC, 0x44,
-    0x2A, 0x28, 0x10, 0xEA, 0x66, 0x9A, 0x7B, 0xB0, 0x23, 0xD1, 0x0B, 0x1A, 0x69, 0xA8, 0x68, 0x74,
-    0xB1, 0x4F, 0x9D, 0x89, 0xAA, 0xBE, 0xB2, 0xFE, 0x5E, 0x7D, 0x17, 0x47, 0xDF, 0x93, 0x2E, 0x9D,
-    0x54, 0x2C, 0x3B, 0x2F, 0xC2, 0x28, 0x86, 0xFF, 0x68, 0x55, 0x3B, 0xD5, 0x06, 0xD2, 0xAC, 0xC7,
-    0xC9, 0x57, 0x8B, 0x15, 0x75, 0x58, 0x05, 0xF1, 0x17, 0x40, 0x0F, 0x0E, 0x89, 0xDE, 0x4B, 0x10,
-    0xA3, 0x25, 0xF2, 0xA7, 0xFE, 0x20, 0x24, 0xF1, 0xAE, 0x86, 0xE2, 0x43, 0xC3, 0x2C, 0x0C, 0xF0,
-    0xA7, 0x93, 0x81, 0x40, 0x88, 0x83, 0x27, 0xA3, 0xE6, 0x12, 0x5E, 0x0C, 0x29, 0xED, 0x07, 0x07,
-    0x72, 0x23, 0x4E, 0x7D, 0x74, 0xBE, 0x34, 0xE2, 0x4C, 0xB9, 0xBF, 0x65, 0x3B, 0x7C, 0x48, 0xEF,
-    0x0E, 0xF0, 0xB6, 0x27, 0x78, 0x9B, 0xE6, 0x82, 0x11, 0x57, 0x81, 0x77, 0x75, 0x0E, 0xA3, 0xEF,
-    0x05, 0x2B, 0x28, 0xCB, 0x78, 0x6F, 0x05, 0xDF, 0xEE, 0xC1, 0x1E, 0xF7, 0xAF, 0xFD, 0x2C, 0x75,
-    0x47, 0x50, 0x75, 0xDA, 0x0B, 0xBE, 0x5F, 0x11, 0x39, 0x4E, 0x51, 0x87, 0xC3, 0xBC, 0x42, 0xAB,
-    0x09, 0x4F, 0x3D, 0x31, 0xC5, 0xB1, 0x14, 0xC2, 0xA1, 0xFA, 0xBB, 0x57, 0xE7, 0xA2, 0x7F, 0x15,
-    0xD9, 0x19, 0x79, 0x7B, 0x15, 0x43, 0xB1, 0x8A, 0x51, 0x59, 0x41, 0x99, 0xAF, 0x4B, 0x57, 0x10,
-    0x90, 0x39, 0xE8, 0x10, 0xFA, 0xE0, 0x3A, 0xFB, 0x0A, 0x86, 0x31, 0x1E, 0xD2, 0xB2, 0x53, 0xFD,
-    0xFE, 0xDB, 0x44, 0x3D, 0x98, 0x14, 0x2F, 0xB1, 0x53, 0x27, 0xAD, 0x0B, 0x5E, 0x7B, 0x11, 0x1D,
-    0xA4, 0xF6, 0x7A, 0x15, 0xE8, 0xF7, 0x30, 0x69, 0x6D, 0xB1, 0x33, 0xEF, 0xEA, 0x62, 0x02, 0x94,
-    0x84, 0xEF, 0xF7, 0xEB, 0xEF, 0xBB, 0x18, 0x76, 0x07, 0xC5, 0x46, 0x31, 0x65, 0x4D, 0xEF, 0x54,
-    0xE8, 0xAC, 0xE5, 0xDC, 0x4E, 0xE1, 0x06, 0xD1, 0x94, 0xD8, 0xD6, 0xB4, 0x13, 0xD4, 0x0C, 0x4D,
-    0xC0, 0x0D, 0x72, 0xAC, 0x25, 0x67, 0x48, 0x96, 0x48, 0x72, 0x92, 0x0C, 0xC4, 0xA4, 0xBD, 0x68,
-    0x91, 0xBC, 0xF6, 0xC3, 0x6F, 0xAD, 0x89, 0x3D, 0x9B, 0xAC, 0x52, 0xFF, 0xC3, 0x9A, 0xB5, 0x93,
-    0xCB, 0x54, 0x21, 0x4B, 0xD4, 0x20, 0x4B, 0x8D, 0x1A, 0x01, 0x57, 0x66, 0xE8, 0x11, 0x2D, 0xBE,
-    0x0E, 0xE6, 0xC3, 0x4D, 0xBA, 0x28, 0xF3, 0x68, 0xFB, 0x0A, 0x0A, 0xBE, 0x9E, 0xAE, 0x9E, 0x3A,
-    0x15, 0x10, 0x1F, 0xCC, 0xD7, 0x3E, 0x12, 0xA0, 0xA0, 0xC0, 0x4B, 0x80, 0x8D, 0xD7, 0x17, 0x81,
-    0xD4, 0x87, 0xE2, 0x3E, 0xEF, 0x5F, 0xE8, 0x5F, 0x3C, 0x7C, 0x31, 0xCE, 0xE3, 0xA2, 0x53, 0x38,
-    0x50, 0xE8, 0x6E, 0x64, 0x40, 0xA1, 0xC3, 0x0A, 0x59, 0x72, 0x93, 0x59, 0x5A, 0xA5, 0x7C, 0xDE,
-    0xB4, 0xFB, 0x1E, 0xAD, 0x07, 0x11, 0x75, 0x9D, 0xC5, 0x6B, 0x58, 0xA6, 0xA1, 0xFB, 0x7E, 0x41,
-    0xDB, 0x14, 0xE0, 0xDC, 0x28, 0x68, 0x6D, 0x91, 0x6F, 0xFD, 0x00, 0xE3, 0x06, 0x18, 0x31, 0x97,
-    0x74, 0xAE, 0x38, 0x03, 0x2C, 0xF7, 0xD2, 0x18, 0x3A, 0xA3, 0xC0, 0xFF, 0x51, 0x5E, 0x1A, 0xE5,
-    0x65, 0x55, 0x3E, 0xCB, 0xE5, 0x58, 0x2A, 0x33, 0x37, 0xAB, 0xC0, 0x84, 0x88, 0xE2, 0x9F, 0xF3,
-    0xFB, 0x55, 0x77, 0x49, 0xF5, 0x0A, 0xB5, 0xB2, 0x0A, 0x4C, 0x8B, 0x07, 0xBC, 0xA2, 0xFA, 0xEF,
-    0x4C, 0xF5, 0x17, 0xE2, 0x35, 0xBB, 0x5A, 0x00, 0x6B, 0x0C, 0x39, 0xBE, 0xF4, 0x73, 0x83, 0x93,
-    0x31, 0x1B, 0x24, 0x87, 0xF8, 0xE7, 0xBB, 0x20, 0x3F, 0x4F, 0x41, 0x7E, 0x05, 0x66, 0xB3, 0x87,
-    0xBC, 0x64, 0x20, 0xD7, 0x69, 0x02, 0x36, 0x1D, 0x18, 0xC0, 0x1B, 0x43, 0x17, 0x8C, 0xF6, 0xA7,
-    0x26, 0xD6, 0x59, 0x41, 0xDF, 0xC1, 0x90, 0x16, 0x6E, 0x87, 0x8B, 0xB0, 0xE6, 0x46, 0xB5, 0xEB,
-    0x4F, 0xEB, 0xBF, 0xF3, 0xF4, 0x3B, 0x2A, 0x5E, 0xF3, 0x86, 0x60, 0x6C, 0x7C, 0x04, 0x2E, 0x0A,
-    0x40, 0x0E, 0x92, 0x4F, 0xCE, 0x91, 0x50, 0x08, 0x13, 0x24, 0xD9, 0xB7, 0xE8, 0xE0, 0x87, 0x8D,
-    0x03, 0x12, 0x93, 0xF8, 0xBC, 0x8E, 0xC6, 0x40, 0x4A, 0xA1, 0x39, 0x30, 0xA1, 0x07, 0x87, 0x58,
-    0x3E, 0x64, 0xA9, 0xC0, 0xA4, 0x5B, 0x48, 0x83, 0x9E, 0x59, 0x93, 0xDC, 0x44, 0xEF, 0xE5, 0x26,
-    0x42, 0x7F, 0xAE, 0x3A, 0x4B, 0xB2, 0x44, 0x42, 0xDF, 0x90, 0x91, 0x81, 0xBC, 0x96, 0xE2, 0x1B,
-    0x55, 0x82, 0x56, 0xC7, 0xEC, 0xBA, 0x60, 0xC2, 0xFE, 0x05, 0x96, 0xB8, 0x00, 0x92, 0xCC, 0x1C,
-    0xCC, 0xC8, 0x88, 0x9D, 0x82, 0x0D, 0x6B, 0x87, 0xCA, 0x99, 0x57, 0xF6, 0x5C, 0x30, 0x0D, 0x7A,
-    0x3A, 0x39, 0x08, 0xFA, 0x72, 0x32, 0x0B, 0xFA, 0x8D, 0xEC, 0x2C, 0xE8, 0x4B, 0xF9, 0x12, 0xE8,
-    0x8B, 0x45, 0x06, 0x1A, 0x8C, 0x12, 0xD2, 0x38, 0x22, 0x0D, 0xA1, 0x84, 0xBC, 0xD4, 0xE7, 0x18,
-    0x14, 0x07, 0x9D, 0x2A, 0xEF, 0xBF, 0xB3, 0xAF, 0x1F, 0xC5, 0x6B, 0x0E, 0x24, 0x55, 0x46, 0xAD,
-    0x94, 0x6E, 0x41, 0x2A, 0x88, 0x2D, 0x7B, 0xBD, 0xBF, 0xCD, 0xA7, 0x7A, 0x50, 0xCD, 0x91, 0x0C,
-    0x6A, 0xAA, 0xE6, 0xAE, 0x28, 0x6B, 0x0D, 0xB2, 0x39, 0x82, 0x9C, 0x52, 0x56, 0xD6, 0x05, 0xBF,
-    0xCD, 0x43, 0x06, 0x40, 0x2E, 0xB0, 0x14, 0x75, 0x19, 0xF0, 0xBD, 0x9E, 0x58, 0x52, 0x56, 0xE6,
-    0x05, 0x4E, 0x42, 0xD1, 0xC6, 0x40, 0x8B, 0x70, 0x3A, 0xD7, 0x26, 0x57, 0x15, 0xCD, 0x2E, 0x79,
-    0x42, 0x71, 0x1F, 0xC4, 0x1B, 0xD8, 0xBA, 0x4D, 0x49, 0xFF, 0x0D, 0xC8, 0xF4, 0xF8, 0xA7, 0x90,
-    0xC4, 0xCE, 0xFF, 0x81, 0x35, 0xEE, 0x50, 0x07, 0xA3, 0xB7, 0x3E, 0xAD, 0xE2, 0x4D, 0xA4, 0x33,
-    0xFE, 0xA7, 0x5C, 0x42, 0xAD, 0xED, 0x14, 0xE0, 0x32, 0xE7, 0xD3, 0x45, 0xDC, 0xE0, 0x03, 0x74,
-    0xD1, 0x49, 0x20, 0xCD, 0x69, 0x5D, 0x6F, 0x26, 0x14, 0x2E, 0x4A, 0xAB, 0xB9, 0xF8, 0x8A, 0xB2,
-    0xD7, 0x46, 0x10, 0xC1, 0x1D, 0x11, 0xB5, 0x5D, 0xD8, 0x0B, 0xF3, 0xB5, 0x11, 0xB0, 0xB9, 0xF4,
-    0x6A, 0xB3, 0x07, 0x0B, 0x3E, 0x70, 0xD6, 0x63, 0x89, 0x37, 0x51, 0xA1, 0x1D, 0x86, 0x8C, 0x04,
-    0x00, 0x29, 0x66, 0x9D, 0xE4, 0xDC, 0x31, 0x27, 0x99, 0x61, 0x79, 0x96, 0xCF, 0x26, 0x5A, 0xDD,
-    0xAE, 0xD0, 0x66, 0x9A, 0x1B, 0xE0, 0x1E, 0x23, 0xD5, 0xBF, 0x68, 0xF6, 0x83, 0xB8, 0xC0, 0x12,
-    0x06, 0xBE, 0x3F, 0xCF, 0x16, 0x9E, 0xA5, 0x3E, 0x5C, 0xA2, 0x43, 0x3D, 0x53, 0x34, 0x9A, 0xA8,
-    0xD3, 0x70, 0xFD, 0x3C, 0x03, 0x74, 0xBE, 0x43, 0x34, 0xEC, 0xD2, 0x1A, 0xF8, 0x8F, 0x24, 0x7F,
-    0x4D, 0x80, 0x24, 0xFE, 0x2C, 0x76, 0xCA, 0x10, 0x5C, 0x9A, 0x35, 0x20, 0x49, 0x30, 0x32, 0x96,
-    0x8B, 0xDA, 0x23, 0x1E, 0x2E, 0x71, 0x77, 0x89, 0x9E, 0x6B, 0x1D, 0x38, 0xAA, 0x53, 0xB6, 0xA6,
-    0xC1, 0x16, 0xE4, 0x40, 0xB5, 0x00, 0x5E, 0x1E, 0xC1, 0xA0, 0x49, 0x4B, 0x0F, 0x0A, 0xAD, 0xB4,
-    0x61, 0xCE, 0x40, 0xB3, 0xF6, 0x54, 0x49, 0x3E, 0x29, 0xC9, 0x24, 0xA5, 0x2A, 0x5B, 0x52, 0xF0,
-    0x03, 0x28, 0x13, 0xD8, 0x92, 0xB8, 0x98, 0x22, 0x0C, 0x12, 0xCD, 0x5A, 0x1B, 0xC6, 0x34, 0x56,
-    0x06, 0x5B, 0x3F, 0x43, 0xC8, 0xD4, 0x88, 0x6A, 0x4F, 0x6C, 0x1D, 0xC5, 0x21, 0x7D, 0xBA, 0xAF,
-    0x3A, 0xA3, 0x03, 0x00, 0x06, 0x03, 0x4A, 0x99, 0x92, 0x3D, 0xEF, 0x49, 0xCF, 0xFF, 0x19, 0x3B,
-    0x32, 0x68, 0xF1, 0x1C, 0xED, 0x40, 0x97, 0xB3, 0x73, 0x84, 0x53, 0x73, 0x96, 0x01, 0xE2, 0x8C,
-    0xC1, 0x4E, 0xC2, 0x2C, 0x2F, 0xB3, 0xE9, 0x54, 0xF6, 0xAB, 0x68, 0x7C, 0xF5, 0x18, 0xF7, 0xCF,
-    0xA9, 0x57, 0xBF, 0x35, 0x0C, 0x1A, 0x8B, 0x44, 0x42, 0x2F, 0x32, 0xBE, 0xA2, 0x3B, 0x8C, 0x96,
-    0xA8, 0xE0, 0xF5, 0x3E, 0x9E, 0x36, 0x37, 0xC2, 0xD3, 0xC4, 0x67, 0x62, 0x65, 0x5B, 0x10, 0x7E,
-    0x60, 0x0E, 0xA7, 0x4A, 0x02, 0x21, 0x90, 0xA9, 0x93, 0xDB, 0x8D, 0x89, 0x57, 0xA5, 0x10, 0x80,
-    0x7D, 0x69, 0xBF, 0x37, 0x92, 0x1E, 0x58, 0x03, 0x59, 0x6D, 0x66, 0xBE, 0x6B, 0x95, 0x77, 0xF5,
-    0xD5, 0xB5, 0x53, 0xA3, 0xA0, 0x46, 0xDF, 0x0F, 0xE9, 0x79, 0xC3, 0x60, 0x1C, 0xED, 0x3B, 0xE9,
-    0x38, 0xC6, 0xAF, 0x21, 0x7E, 0x83, 0xF0, 0x1B, 0xA0, 0x7F, 0xB8, 0x7F, 0x11, 0x2B, 0x80, 0xEB,
-    0x6E, 0x96, 0xE3, 0x7F, 0xAC, 0x25, 0xCF, 0xEA, 0x40, 0xE5, 0x2F, 0x48, 0xA8, 0x87, 0xA1, 0x40,
-    0x23, 0x10, 0xBC, 0x4B, 0x8B, 0xBA, 0x25, 0x89, 0x7E, 0x6F, 0xEE, 0x17, 0x31, 0x1D, 0x6B, 0x05,
-    0x24, 0x98, 0xDA, 0x07, 0x5D, 0x05, 0xF6, 0xAE, 0x52, 0xA2, 0xA6, 0x55, 0xC1, 0x1E, 0xF3, 0x93,
-    0xF4, 0x6A, 0x40, 0x8A, 0x85, 0x0A, 0x9A, 0x75, 0x28, 0xA3, 0x81, 0x6F, 0xE6, 0x05, 0x44, 0x6E,
-    0xA6, 0x4E, 0xB6, 0x42, 0xCC, 0xFC, 0x1E, 0xA4, 0x76, 0xB5, 0xE6, 0x42, 0x6A, 0xF7, 0x31, 0xBF,
-    0x23, 0x1D, 0x20, 0x9B, 0x40, 0x38, 0xB8, 0x27, 0xEF, 0xC8, 0xFB, 0xF1, 0x6E, 0x93, 0xE8, 0xC9,
-    0x01, 0x7A, 0x8A, 0x13, 0xFA, 0x1A, 0xA1, 0xEB, 0x15, 0x94, 0xBD, 0x5A, 0x06, 0xF4, 0xB9, 0x0C,
-    0x21, 0xF4, 0xAC, 0x6A, 0x03, 0xDA, 0x30, 0x51, 0x43, 0xE2, 0xFA, 0xF6, 0x6F, 0xA8, 0x7D, 0xC8,
-    0x8C, 0x79, 0xF0, 0x69, 0xA1, 0x56, 0xC1, 0x78, 0xA2, 0x94, 0x4F, 0x52, 0x1D, 0x13, 0xD5, 0x40,
-    0x1F, 0x7F, 0x46, 0x05, 0xEA, 0x01, 0xD1, 0x42, 0x33, 0x62, 0x1C, 0xEC, 0x94, 0xC8, 0xC6, 0xA6,
-    0x0E, 0xCE, 0xA8, 0x35, 0xAD, 0x8C, 0xDE, 0x5D, 0x3C, 0x7F, 0x5D, 0xA8, 0x7E, 0xA7, 0xFE, 0x74,
-    0x85, 0x7D, 0x4E, 0xBB, 0xF2, 0xAD, 0x0E, 0xC4, 0xA4, 0x37, 0x70, 0xD3, 0x1E, 0xB4, 0xA9, 0xA9,
-    0x51, 0x33, 0x51, 0xFD, 0xD3, 0xFD, 0x77, 0xA0, 0x53, 0xD7, 0xE8, 0xBC, 0x90, 0x7F, 0x51, 0x5D,
-    0xE3, 0x9F, 0x3D, 0x70, 0x13, 0x83, 0xAB, 0x26, 0x3C, 0x9D, 0x10, 0xE1, 0x98, 0x05, 0x9D, 0x1D,
-    0xF8, 0x24, 0xA5, 0xA3, 0xA3, 0x33, 0xA0, 0x5E, 0x66, 0x4C, 0x53, 0x3C, 0x3B, 0x8C, 0x34, 0x74,
-    0x28, 0xD3, 0x36, 0x44, 0xD4, 0x6E, 0xA0, 0x32, 0x33, 0x62, 0x88, 0x1F, 0x0C, 0x98, 0x2D, 0x03,
-    0xD6, 0x3E, 0xB7, 0xAB, 0xF7, 0x96, 0x20, 0x03, 0xB1, 0xC7, 0x40, 0x02, 0xBB, 0xEA, 0x6B, 0xA3,
-    0x8B, 0x52, 0x4C, 0xF9, 0x7B, 0xAF, 0x32, 0x6F, 0x54, 0x99, 0xF9, 0xFB, 0x4B, 0x25, 0x00, 0xC8,
-    0x10, 0x7A, 0xAD, 0x87, 0xF7, 0xBB, 0x77, 0x2A, 0x90, 0x5C, 0x5D, 0x08, 0xAE, 0x6E, 0xFD, 0xD8,
-    0xA6, 0xCC, 0x6B, 0xD1, 0xC0, 0x27, 0x41, 0xD4, 0x71, 0xD0, 0xE8, 0xBB, 0x21, 0xF3, 0x7B, 0x75,
-    0x10, 0xB8, 0x8E, 0x01, 0x7F, 0x51, 0xDC, 0xBD, 0x93, 0x62, 0x5C, 0x3D, 0x15, 0xD0, 0xD4, 0xB8,
-    0xA3, 0x62, 0x04, 0xD6, 0xE8, 0x5C, 0xCA, 0xCF, 0x2B, 0x98, 0x81, 0xF9, 0xB2, 0x3A, 0x89, 0xCB,
-    0x7C, 0x18, 0x3C, 0x23, 0x7C, 0x9E, 0xF2, 0x39, 0x06, 0xE0, 0xEB, 0xF9, 0x25, 0x75, 0xBE, 0x50,
-    0xEF, 0xF6, 0xA6, 0x72, 0x0F, 0x0F, 0x15, 0x04, 0x49, 0xE0, 0x5E, 0x08, 0x2F, 0x34, 0x80, 0xF2,
-    0xF0, 0xDB, 0xAA, 0x23, 0xFE, 0x1C, 0x63, 0xE7, 0xDF, 0x82, 0x98, 0xCB, 0x17, 0xE9, 0x7C, 0xD4,
-    0x49, 0x7C, 0x97, 0xBF, 0x7B, 0x8C, 0xFB, 0xBE, 0x89, 0x31, 0x30, 0x0B, 0xFC, 0x79, 0x52, 0x7F,
-    0xBB, 0x33, 0x30, 0x07, 0xC6, 0x8E, 0xFF, 0xCC, 0x9C, 0x76, 0xEB, 0x5C, 0x32, 0x14, 0xA3, 0x85,
-    0x06, 0xB4, 0x40, 0x0C, 0xF1, 0x48, 0x80, 0x52, 0xB5, 0xCD, 0x4C, 0xD0, 0x9B, 0x01, 0x29, 0xAD,
-    0xC6, 0x63, 0x30, 0x59, 0xA1, 0xF6, 0x2D, 0xC6, 0x31, 0x96, 0x2C, 0x62, 0xCC, 0x1C, 0x74, 0x60,
-    0x64, 0x7C, 0xE7, 0xB5, 0x14, 0x0B, 0x31, 0xAF, 0x12, 0xEF, 0xE6, 0x5C, 0x12, 0x63, 0xE0, 0x47,
-    0xB5, 0x17, 0xB2, 0x7F, 0x11, 0x42, 0x5A, 0xC5, 0x05, 0x64, 0x34, 0x16, 0x36, 0x91, 0x2C, 0x50,
-    0xF6, 0x60, 0x4B, 0x2A, 0x6E, 0x6B, 0xFB, 0xEA, 0xB7, 0xD6, 0x5E, 0xCB, 0xF9, 0x8E, 0x51, 0xC8,
-    0xFB, 0xE5, 0x66, 0x6A, 0x14, 0x00, 0x63, 0x6B, 0xDF, 0xC9, 0xAB, 0xA1, 0x27, 0x31, 0xDB, 0x9A,
-    0xAF, 0x85, 0xDD, 0x84, 0x9B, 0x85, 0xAD, 0x35, 0x31, 0x04, 0x6E, 0x80, 0xBB, 0x95, 0x71, 0x13,
-    0x6A, 0xDB, 0xF8, 0xFD, 0x35, 0x18, 0x2E, 0x43, 0xFA, 0x0F, 0xC1, 0xE1, 0xFC, 0xB4, 0x4B, 0xE2,
-    0xDF, 0x81, 0x98, 0x24, 0x1C, 0xF0, 0x05, 0x0C, 0xB9, 0x9F, 0xEB, 0x94, 0x24, 0x1D, 0x96, 0x5E,
-    0x96, 0x58, 0x5E, 0xA3, 0x64, 0x9B, 0x69, 0x54, 0xBB, 0x6D, 0x0D, 0x88, 0xC5, 0xAF, 0x43, 0xDD,
-    0xB4, 0xBC, 0x61, 0x18, 0xF2, 0x69, 0xD9, 0x78, 0x3A, 0xC5, 0xAE, 0x9B, 0x4F, 0xDF, 0xA6, 0xF9,
-    0x34, 0xA0, 0xAA, 0x2B, 0xA9, 0xF6, 0x42, 0x8E, 0xB5, 0xD1, 0x9A, 0x4F, 0x8F, 0x08, 0x0E, 0xEE,
-    0x1A, 0x46, 0x1A, 0xD5, 0x18, 0xC9, 0x2E, 0x1A, 0x94, 0x26, 0xC3, 0xA9, 0xC7, 0x34, 0x9D, 0x44,
-    0x9F, 0x6E, 0xC6, 0x40, 0xFA, 0xC0, 0x2F, 0x54, 0x27, 0x71, 0xCA, 0x7F, 0x3C, 0xD4, 0x39, 0x42,
-    0x23, 0xBE, 0x3F, 0x8F, 0x49, 0x01, 0xAA, 0x3F, 0xAE, 0x23, 0xED, 0xC7, 0x55, 0x27, 0x42, 0x97,
-    0x66, 0x21, 0x64, 0xCC, 0xB1, 0x94, 0x22, 0x87, 0x9E, 0xEF, 0x73, 0xD4, 0x51, 0x43, 0x8C, 0x10,
-    0x94, 0x4A, 0x8F, 0xD1, 0xEC, 0xFC, 0x31, 0x1F, 0xA3, 0x64, 0x0E, 0x8E, 0xF8, 0x26, 0x3D, 0x40,
-    0xC7, 0x3A, 0x2F, 0xD1, 0x2D, 0xB4, 0xE4, 0xFD, 0x6B, 0x4A, 0xCF, 0xD4, 0xFD, 0x1F, 0x92, 0xFA,
-    0xE5, 0x72, 0x94, 0xC2, 0x48, 0x06, 0xC0, 0xD7, 0xE9, 0x34, 0x5D, 0xCE, 0xFE, 0xD3, 0xF8, 0x67,
-    0xA5, 0x58, 0x6E, 0x81, 0x9D, 0x43, 0x7A, 0x46, 0x5C, 0xD6, 0x00, 0x0E, 0xB9, 0x39, 0x40, 0x07,
-    0x73, 0xB1, 0x7A, 0xA1, 0x90, 0xCD, 0x1C, 0xFD, 0x99, 0xC7, 0xA2, 0x4F, 0x20, 0xAF, 0x0B, 0x0C,
-    0x6C, 0xC7, 0x2A, 0xA1, 0xB2, 0xBC, 0x6F, 0x9E, 0xC7, 0x5C, 0xB8, 0xFF, 0xA6, 0x0B, 0x86, 0x74,
-    0xFF, 0xA7, 0x3F, 0xC3, 0xB5, 0xD3, 0x11, 0x47, 0x1C, 0x65, 0xB4, 0x95, 0xB9, 0x81, 0x0E, 0x41,
-    0x1A, 0x10, 0xAF, 0x14, 0x98, 0x24, 0x68, 0xDB, 0xE1, 0xC5, 0xCF, 0x2E, 0x30, 0xE7, 0x2D, 0x57,
-    0x67, 0xBD, 0x28, 0x57, 0x67, 0xBC, 0xE8, 0x8C, 0xFE, 0x40, 0x79, 0xFF, 0x5B, 0x30, 0x20, 0x83,
-    0x50, 0x51, 0x27, 0x01, 0x71, 0x32, 0xF1, 0x93, 0xB5, 0x64, 0x30, 0xF1, 0x27, 0x58, 0x26, 0x04,
-    0xB8, 0x91, 0x04, 0x2A, 0xE1, 0x6B, 0xED, 0xA1, 0x94, 0xDC, 0x9C, 0xCD, 0x85, 0x80, 0xFC, 0x6B,
-    0xEB, 0x17, 0x6E, 0xFF, 0x6C, 0x1D, 0xE6, 0xF1, 0xFA, 0x22, 0xE4, 0x19, 0xD4, 0x15, 0xCC, 0x2A,
-    0x94, 0x6E, 0x5D, 0xAF, 0x3C, 0x79, 0xF3, 0xD5, 0x41, 0x28, 0xFA, 0xA1, 0x76, 0xE2, 0x89, 0x31,
-    0x38, 0x87, 0x79, 0xBB, 0x5A, 0xF1, 0x41, 0x3D, 0x1D, 0x86, 0x2D, 0x19, 0x33, 0xC7, 0x88, 0x49,
-    0xBA, 0x42, 0xED, 0x7D, 0xB5, 0x75, 0x25, 0xB9, 0x42, 0xA8, 0x84, 0x1F, 0xD7, 0x17, 0xF1, 0x2C,
-    0x9D, 0xA3, 0x15, 0xE8, 0xB8, 0xDB, 0xF8, 0x25, 0xD9, 0xF8, 0xF7, 0xEA, 0xBB, 0x98, 0x35, 0x53,
-    0x0D, 0x95, 0xC9, 0x07, 0xC5, 0x81, 0x13, 0x78, 0x6B, 0xAA, 0xB3, 0x5E, 0x51, 0x6B, 0xD9, 0xB5,
-    0x13, 0x4F, 0x8C, 0xB2, 0xC0, 0x19, 0xC1, 0x84, 0x08, 0xC2, 0xC5, 0x14, 0x63, 0x54, 0x30, 0xB3,
-    0x83, 0x37, 0x31, 0x29, 0x58, 0x01, 0x42, 0xA9, 0xEB, 0x4C, 0x69, 0x85, 0xC9, 0x46, 0x90, 0x62,
-    0x90, 0xEB, 0x77, 0xEA, 0x4F, 0x29, 0xA6, 0xF9, 0x2D, 0xB5, 0x1F, 0xA2, 0xB8, 0x54, 0x4B, 0x4F,
-    0x42, 0x5E, 0x5C, 0xCA, 0xC2, 0x2A, 0xF2, 0xF4, 0x00, 0x70, 0xC5, 0x1E, 0x1F, 0xCB, 0x94, 0xD1,
-    0xE9, 0x50, 0x92, 0x29, 0x63, 0xFE, 0x4C, 0xCC, 0x83, 0x9F, 0xB2, 0x43, 0xF6, 0x4B, 0xEC, 0x88,
-    0x23, 0x1D, 0x98, 0x16, 0xB1, 0xE9, 0xF5, 0xC9, 0x7B, 0xBE, 0x04, 0xD3, 0x67, 0x4A, 0xAA, 0xCF,
-    0x25, 0xC6, 0x21, 0x55, 0x5E, 0x76, 0x02, 0x60, 0xDE, 0x52, 0x72, 0x64, 0x84, 0x46, 0x30, 0xB8,
-    0xB0, 0x62, 0xE9, 0xB4, 0x75, 0x41, 0x07, 0x2A, 0x4C, 0x4B, 0x1A, 0x35, 0xB8, 0x92, 0x89, 0x60,
-    0x17, 0x9A, 0x85, 0xEE, 0xF0, 0x56, 0x2E, 0x15, 0xF4, 0x41, 0xC2, 0x84, 0x59, 0x22, 0xA8, 0x63,
-    0x34, 0x86, 0xFE, 0xDB, 0x22, 0x1A, 0x72, 0xEB, 0x3A, 0x56, 0xC3, 0x4F, 0x3E, 0xC0, 0xCA, 0xF8,
-    0xFE, 0xFB, 0xB9, 0xB2, 0xBF, 0x91, 0x14, 0xCA, 0xB5, 0x93, 0x52, 0x1D, 0xB2, 0x93, 0x15, 0x15,
-    0xDA, 0x09, 0xE4, 0xD2, 0xF7, 0xDF, 0x67, 0x74, 0x20, 0x60, 0x3E, 0x0E, 0xA7, 0x53, 0x20, 0x05,
-    0x47, 0xDE, 0xD3, 0xA9, 0x74, 0xCA, 0xAF, 0xBD, 0xC9, 0x5F, 0x1F, 0xE8, 0x7A, 0xA9, 0xD0, 0x75,
-    0x5E, 0x4A, 0x6D, 0x00, 0x4C, 0x4A, 0x58, 0x25, 0xF1, 0x25, 0xD5, 0xE3, 0xD2, 0x67, 0x71, 0x3D,
-    0xAF, 0x95, 0x24, 0xF8, 0xB8, 0xDE, 0xCB, 0x0C, 0xAC, 0xAA, 0x69, 0xEF, 0x9B, 0x74, 0xBD, 0xAB,
-    0x23, 0xDE, 0x4B, 0xE2, 0xD5, 0x9E, 0xAD, 0xEB, 0x73, 0xDE, 0x09, 0x89, 0x42, 0x2C, 0x79, 0x81,
-    0x18, 0x47, 0x39, 0xBD, 0x9E, 0x98, 0x2D, 0xE0, 0xD5, 0x50, 0x79, 0x6B, 0xCE, 0xC0, 0x3B, 0xC1,
-    0xDC, 0xBB, 0xC5, 0xA1, 0xF7, 0x8D, 0x2A, 0xC3, 0xDC, 0x4E, 0xA1, 0x99, 0x98, 0x5C, 0x37, 0x93,
-    0xFE, 0x7B, 0x9A, 0x73, 0x8F, 0x0F, 0xA4, 0x3A, 0xAB, 0xD3, 0x59, 0x97, 0x96, 0xA5, 0xCA, 0xBA,
-    0x9C, 0xE2, 0x4B, 0x80, 0x25, 0xAC, 0xAE, 0x2F, 0x06, 0x9C, 0x5E, 0xF7, 0x65, 0xA6, 0xD7, 0x4D,
-    0xBB, 0x68, 0x8C, 0x99, 0x1F, 0x74, 0x5F, 0x62, 0x8E, 0xEC, 0x11, 0xF7, 0x25, 0x26, 0xCC, 0xCE,
-    0xB8, 0x2F, 0x16, 0xEA, 0xC9, 0x1B, 0xA5, 0xFB, 0xD2, 0x50, 0x85, 0x9F, 0x8F, 0xDC, 0x6F, 0x56,
-    0x75, 0x72, 0x64, 0x9D, 0x22, 0x89, 0x9B, 0x9F, 0x17, 0xC8, 0xC3, 0x58, 0x51, 0x40, 0xB1, 0x0A,
-    0x80, 0x1B, 0xC9, 0x0A, 0x97, 0xE0, 0xA4, 0x44, 0x0E, 0x57, 0x98, 0x80, 0x62, 0xC4, 0x6B, 0x4D,
-    0x50, 0x50, 0x85, 0xEE, 0x07, 0x03, 0x7A, 0xF7, 0xDE, 0x2B, 0xC7, 0x7C, 0x7C, 0xE8, 0x21, 0x90,
-    0x71, 0x4F, 0x7B, 0xFA, 0x20, 0xC3, 0xE8, 0x31, 0x76, 0x6B, 0x7F, 0xDF, 0xDC, 0x15, 0xF7, 0xCA,
-    0x08, 0x00, 0xD3, 0x2C, 0x4D, 0x80, 0x89, 0x05, 0x19, 0xCB, 0x54, 0xD0, 0x09, 0x25, 0xBF, 0xE2,
-    0xB3, 0x3A, 0xC1, 0xAC, 0x84, 0xC4, 0xC8, 0x57, 0xE6, 0xE7, 0x89, 0x58, 0xEB, 0x5C, 0x1D, 0xA3,
-    0x5E, 0x18, 0xD0, 0xAB, 0x4B, 0xFE, 0xC9, 0xBB, 0x34, 0x86, 0xB3, 0x2E, 0x58, 0xD9, 0x49, 0xBB,
-    0x9C, 0x88, 0xA4, 0x8B, 0x9B, 0xF8, 0x41, 0x1C, 0x0C, 0xD5, 0xC8, 0xAA, 0xA0, 0x15, 0x31, 0xEB,
-    0xA1, 0x4C, 0x13, 0xA6, 0x3D, 0xD4, 0x82, 0x9B, 0x51, 0x21, 0x3E, 0x42, 0xAE, 0x67, 0x2A, 0x9F,
-    0xCE, 0x86, 0x3C, 0xA7, 0xA7, 0x78, 0x60, 0xD4, 0xBC, 0x20, 0x5A, 0x48, 0x98, 0xC3, 0x0D, 0xEA,
-    0xA8, 0xF2, 0x7F, 0x91, 0x55, 0xDD, 0xEF, 0x2F, 0x8E, 0x82, 0x3A, 0xF7, 0xB2, 0xD2, 0x8C, 0xE2,
-    0xBE, 0x9F, 0xAF, 0xCA, 0x8B, 0xCE, 0x8B, 0x8C, 0xCA, 0x33, 0xF8, 0x60, 0xEA, 0x18, 0xBD, 0x0A,
-    0x4D, 0xBA, 0xF4, 0x19, 0x85, 0x31, 0x73, 0x69, 0xB3, 0x2A, 0x4D, 0x8A, 0x02, 0xFD, 0xC2, 0xD1,
-    0x39, 0x5B, 0x22, 0x00, 0xC0, 0x08, 0xF9, 0x81, 0x21, 0x35, 0x77, 0x15, 0x03, 0x30, 0x44, 0x31,
-    0x96, 0xF9, 0x3F, 0xA0, 0x37, 0xAF, 0x33, 0x7A, 0x99, 0x22, 0x44, 0x9C, 0x05, 0x1E, 0x26, 0xD1,
-    0xA0, 0xA6, 0xA0, 0xBC, 0x52, 0x92, 0x03, 0xDD, 0xB1, 0x52, 0xC9, 0xB2, 0xFC, 0x69, 0x40, 0xE1,
-    0xB6, 0x48, 0x9F, 0xC6, 0xFA, 0xA5, 0xD1, 0x88, 0x8E, 0x53, 0x3B, 0xA3, 0xEB, 0x1B, 0xCF, 0x2D,
-    0x30, 0x99, 0xB9, 0x1B, 0x15, 0x14, 0xF8, 0x9D, 0x00, 0xB3, 0x63, 0xA2, 0x9D, 0x85, 0x9D, 0x3D,
-    0x99, 0xAF, 0x9A, 0x43, 0x6B, 0x10, 0x7E, 0x5E, 0xB8, 0x55, 0xB0, 0x62, 0x30, 0xE5, 0x68, 0xE0,
-    0x27, 0xEA, 0xF8, 0x92, 0xC4, 0xA7, 0x98, 0xF9, 0xE3, 0x5E, 0x0D, 0xE9, 0xA8, 0x15, 0x17, 0xDA,
-    0x71, 0x94, 0xAF, 0xB4, 0xA1, 0x17, 0x0A, 0x13, 0x74, 0xED, 0xF5, 0xA2, 0xF6, 0x36, 0x75, 0xD2,
-    0x5A, 0x1A, 0x17, 0xDA, 0xE5, 0xC2, 0xC2, 0xD7, 0x5C, 0xC2, 0xE8, 0xE7, 0x3F, 0x65, 0x18, 0xE2,
-    0x8A, 0x5C, 0xA5, 0x4D, 0xBA, 0xA9, 0x0B, 0x7E, 0x14, 0x97, 0x2E, 0xFD, 0x7A, 0x7F, 0xA6, 0x33,
-    0x3C, 0x19, 0x81, 0xB6, 0x92, 0x10, 0x8A, 0xFD, 0xA6, 0xA4, 0x2F, 0x1B, 0x71, 0xAA, 0x43, 0x08,
-    0x81, 0x0E, 0x21, 0xEC, 0x15, 0xDB, 0xC9, 0x17, 0xF8, 0x64, 0x90, 0xF1, 0xFA, 0x45, 0x03, 0xCE,
-    0x23, 0x9D, 0x3E, 0xCF, 0x1A, 0x7F, 0xEF, 0x1D, 0x0A, 0x4C, 0xEA, 0x2C, 0x68, 0x11, 0x76, 0x5C,
-    0x3D, 0x1D, 0xF8, 0x7F, 0x9F, 0xE9, 0xA5, 0x97, 0x28, 0xB2, 0x82, 0x30, 0xF3, 0x87, 0xF6, 0xA8,
-    0x93, 0x11, 0x0F, 0x42, 0xB9, 0xE2, 0x1F, 0x90, 0xE8, 0xD6, 0x34, 0xB7, 0xC4, 0x7C, 0xB5, 0x32,
-    0xA7, 0xA6, 0x26, 0x66, 0x81, 0xC9, 0xBD, 0x56, 0x86, 0x67, 0xAD, 0x5A, 0x59, 0x48, 0x05, 0x26,
-    0x2E, 0xC3, 0xEF, 0xAC, 0x51, 0xF3, 0x0B, 0xFA, 0x9D, 0xA0, 0xB6, 0x50, 0xA6, 0x24, 0xD0, 0xF8,
-    0x68, 0xD1, 0x81, 0xBB, 0x03, 0x79, 0xFD, 0x82, 0x6B, 0x46, 0x73, 0xB9, 0x6B, 0x33, 0x4A, 0x44,
-    0x21, 0xED, 0x2A, 0x06, 0x8A, 0xD4, 0x39, 0x92, 0x99, 0x2D, 0xC8, 0x31, 0x92, 0x33, 0x98, 0x62,
-    0x95, 0x63, 0xED, 0x01, 0x1E, 0x0C, 0x5D, 0x68, 0xF5, 0xF0, 0x7A, 0xDC, 0x64, 0x83, 0x7A, 0x77,
-    0x7A, 0xE4, 0x16, 0xF9, 0x26, 0x81, 0xB8, 0x15, 0x08, 0x2A, 0xB3, 0x36, 0xDF, 0x64, 0xA0, 0x33,
-    0x4A, 0x9E, 0x8E, 0x8C, 0x32, 0xAC, 0xD6, 0xCC, 0x32, 0x3C, 0x11, 0x57, 0x25, 0xA0, 0xCC, 0xCD,
-    0x2D, 0xF3, 0x4D, 0x84, 0xE1, 0x1D, 0xFA, 0x2A, 0xE5, 0x7E, 0x6A, 0x74, 0x6A, 0x38, 0x96, 0x6F,
-    0x22, 0x5E, 0xDA, 0xF5, 0x11, 0x9F, 0x01, 0xFB, 0x94, 0x76, 0xBB, 0xF6, 0xD4, 0xF6, 0x5E, 0x31,
-    0xF3, 0xB0, 0xFA, 0xF7, 0x79, 0xCF, 0xAE, 0xF2, 0x79, 0xF5, 0xB7, 0xF3, 0xAE, 0x22, 0xB7, 0x5A,
-    0x39, 0x3D, 0xB9, 0xB4, 0xBC, 0xED, 0x2B, 0x10, 0x01, 0xB5, 0x97, 0x96, 0x2E, 0x82, 0x9E, 0x9A,
-    0x5B, 0x03, 0xAF, 0x06, 0x5C, 0x4C, 0x9F, 0x28, 0x51, 0x29, 0xB2, 0x28, 0x05, 0xD5, 0x1F, 0x12,
-    0xCB, 0xFB, 0x05, 0xB1, 0x2C, 0x67, 0xC5, 0xA4, 0x9B, 0x11, 0xA3, 0xEE, 0xAC, 0x70, 0xCE, 0x92,
-    0x48, 0x1A, 0x9D, 0x6C, 0x4C, 0xD6, 0x70, 0xDF, 0x17, 0x10, 0xF9, 0x91, 0xE8, 0xB7, 0xBF, 0xA2,
-    0xAE, 0xB3, 0x7E, 0x2F, 0x66, 0xDB, 0x2D, 0xD5, 0xA6, 0x17, 0x48, 0x10, 0x50, 0xE4, 0x24, 0xBD,
-    0x0F, 0x4E, 0x14, 0x43, 0xE2, 0xA4, 0x58, 0xD1, 0x37, 0xE9, 0x86, 0x61, 0x9E, 0xA1, 0xC9, 0x5E,
-    0x43, 0x7A, 0x18, 0x03, 0x62, 0x58, 0x02, 0x27, 0x20, 0x61, 0x9A, 0xB7, 0xD3, 0x7C, 0x26, 0x33,
-    0x51, 0x3B, 0x0C, 0x5E, 0x79, 0xCC, 0xC0, 0x70, 0x2F, 0x4B, 0x92, 0x5E, 0x83, 0x25, 0x5F, 0x11,
-    0x0B, 0x61, 0x45, 0xB0, 0xBA, 0x2F, 0xF9, 0x00, 0xAE, 0xE8, 0x57, 0x4B, 0xE4, 0xA0, 0x0A, 0x1A,
-    0xD0, 0xFE, 0x88, 0xFB, 0xBD, 0xF7, 0x04, 0xD0, 0x81, 0xF3, 0xA1, 0x08, 0x3F, 0x5A, 0x32, 0x03,
-    0x26, 0xD9, 0xCE, 0x0A, 0xF6, 0x36, 0x5A, 0xB3, 0x62, 0x97, 0x87, 0xA6, 0xFD, 0xF1, 0x1A, 0x80,
-    0x36, 0x7A, 0x4D, 0x03, 0x22, 0x09, 0x71, 0xD7, 0x5E, 0x36, 0x9D, 0xF3, 0xEB, 0x26, 0x1A, 0x5F,
-    0x92, 0xE7, 0xDC, 0xFF, 0xDE, 0x5F, 0x38, 0x7C, 0x11, 0xEF, 0xBB, 0xBF, 0xAC, 0xD2, 0x0E, 0x99,
-    0xD3, 0xC9, 0x62, 0x28, 0x9A, 0x90, 0x2F, 0x7C, 0x91, 0x37, 0x4C, 0xA8, 0x92, 0xA8, 0x04, 0x5E,
-    0x00, 0x65, 0x2A, 0x79, 0xE1, 0x26, 0xD3, 0xF2, 0x02, 0xEB, 0xFF, 0x05, 0x25, 0xDF, 0x62, 0x94,
-    0x98, 0x2F, 0x00, 0xB0, 0x66, 0xE4, 0xCE, 0x89, 0x2A, 0x96, 0xF8, 0x20, 0xFC, 0x96, 0xA2, 0x4C,
-    0xF0, 0xE9, 0x7C, 0x5A, 0xB7, 0x87, 0xD9, 0x96, 0xA3, 0x57, 0x07, 0x1A, 0x07, 0x8B, 0xBB, 0x8A,
-    0x7A, 0x44, 0x60, 0x55, 0xBB, 0xDC, 0x0E, 0x35, 0x2F, 0x66, 0x9B, 0x17, 0xEF, 0xD6, 0xB5, 0xD9,
-    0x74, 0x79, 0xAE, 0x49, 0x07, 0x90, 0x39, 0x98, 0xBB, 0x72, 0xB8, 0x6F, 0xF4, 0x17, 0xB0, 0x6A,
-    0x3A, 0xD0, 0x9F, 0xD0, 0xA6, 0xEE, 0x9B, 0xB4, 0x45, 0xD1, 0xFA, 0x9F, 0x0F, 0x14, 0x9B, 0x69,
-    0x65, 0xB4, 0x1F, 0xB8, 0x8A, 0x68, 0x39, 0xF4, 0x70, 0x9F, 0x79, 0xF1, 0x9B, 0x71, 0x05, 0xE5,
-    0x52, 0x77, 0x4E, 0xA4, 0x52, 0xBB, 0xDF, 0x4B, 0xE4, 0x3A, 0xE7, 0x83, 0x48, 0x32, 0x7D, 0xAD,
-    0x4F, 0x02, 0xC5, 0x15, 0x66, 0x5D, 0x53, 0x12, 0x37, 0xE1, 0x03, 0x65, 0xA5, 0x71, 0xDA, 0xB9,
-    0xDA, 0x96, 0x6B, 0x43, 0xB5, 0x69, 0x62, 0xDD, 0x42, 0x23, 0x9B, 0xCC, 0x5F, 0xD0, 0x03, 0xAF,
-    0xA6, 0xEA, 0xF4, 0x79, 0xF7, 0x8A, 0x54, 0x7F, 0xA8, 0x91, 0xA4, 0xD8, 0xA0, 0x15, 0xDF, 0x0A,
-    0x29, 0x0A, 0x4D, 0xE8, 0xF1, 0x54, 0x49, 0x38, 0x5C, 0x30, 0x59, 0x29, 0xDF, 0x1E, 0x4A, 0xEE,
-    0x55, 0xAF, 0xCE, 0xCE, 0xD2, 0xCA, 0x22, 0xBC, 0x8D, 0xFA, 0x2D, 0x0D, 0xEB, 0xEB, 0x19, 0x1E,
-    0x5F, 0xA9, 0xEF, 0xC3, 0x8D, 0x41, 0x74, 0xB5, 0x1C, 0xA5, 0x96, 0x8A, 0x2B, 0xE6, 0xF9, 0x3A,
-    0xDA, 0x6A, 0xD0, 0x19, 0xDF, 0x47, 0x9B, 0x01, 0x27, 0x6F, 0x75, 0xB8, 0x8C, 0x30, 0x9A, 0x1F,
-    0xFD, 0x66, 0x80, 0x95, 0x47, 0x21, 0x36, 0x0F, 0x5C, 0xD5, 0xA5, 0x4B, 0x67, 0x7E, 0xAC, 0xE0,
-    0x3D, 0x9F, 0x7B, 0x4B, 0xA0, 0x84, 0x96, 0xDD, 0xF7, 0x4E, 0x14, 0xD6, 0xAD, 0x5B, 0x8C, 0x4A,
-    0x07, 0xA2, 0xF5, 0x8C, 0xA8, 0xB5, 0x37, 0x81, 0x7D, 0xA5, 0xD3, 0xC7, 0x1C, 0x59, 0x31, 0xFB,
-    0xCF, 0x8B, 0x11, 0x5E, 0xF3, 0xA8, 0x7A, 0x46, 0x57, 0x33, 0x93, 0xBE, 0x5F, 0x61, 0xD6, 0x82,
-    0x4A, 0xCD, 0x58, 0x8B, 0xAD, 0x35, 0x76, 0xA0, 0xA3, 0x3D, 0x99, 0xAE, 0x95, 0x78, 0x91, 0xC7,
-    0x38, 0x9C, 0xC4, 0xDC, 0xC9, 0x7F, 0xBE, 0xDE, 0x96, 0xE0, 0x6B, 0xED, 0xA2, 0xAB, 0x3C, 0xDC,
-    0xAA, 0xF2, 0x27, 0xAB, 0x40, 0x7F, 0x2F, 0x90, 0x6C, 0x2B, 0xF0, 0xE5, 0x7E, 0xDE, 0x3F, 0x55,
-    0x97, 0x99, 0x5B, 0x38, 0xB0, 0x46, 0x2A, 0xC6, 0x38, 0xC4, 0x9F, 0x5E, 0x43, 0xB3, 0xC3, 0xA1,
-    0xC9, 0x7C, 0x62, 0x23, 0x10, 0xF7, 0xA7, 0xF9, 0xB6, 0x4C, 0x25, 0xA0, 0x85, 0x52, 0x2F, 0x78,
-    0xE4, 0xC4, 0xE7, 0xFE, 0xCE, 0x77, 0x37, 0x52, 0xE9, 0x35, 0x1B, 0xFF, 0x2D, 0xA1, 0x97, 0xD5,
-    0xE4, 0x8F, 0xB1, 0x1A, 0x80, 0x85, 0x9D, 0x6B, 0xBF, 0x59, 0x87, 0xF9, 0x6C, 0x7C, 0x9E, 0xC2,
-    0xE2, 0x55, 0xBF, 0x49, 0x3A, 0xF2, 0x4D, 0x4F, 0x9C, 0x6E, 0x5E, 0x20, 0x34, 0xD2, 0x74, 0x65,
-    0xEC, 0xB5, 0xFE, 0xB4, 0x2B, 0x3E, 0x53, 0x5F, 0x7D, 0x45, 0xD1, 0x55, 0x77, 0x08, 0xDF, 0x71,
-    0xAE, 0xC6, 0xBF, 0x04, 0xBC, 0xA9, 0x7E, 0x4D, 0x4D, 0xB2, 0x47, 0x3B, 0x8C, 0x0E, 0x03, 0x28,
-    0x69, 0x40, 0xCA, 0xEA, 0x99, 0xAF, 0x5A, 0x9B, 0xDA, 0xF1, 0x65, 0x34, 0xC6, 0xE9, 0x4A, 0xBB,
-    0x20, 0x0E, 0x2C, 0x42, 0xAA, 0x13, 0x49, 0x3A, 0xD1, 0xE0, 0x07, 0x6D, 0xAA, 0xB7, 0xC9, 0x91,
-    0xE1, 0x5B, 0x43, 0xAC, 0x95, 0x18, 0x4B, 0x46, 0x92, 0x23, 0x05, 0x43, 0x6D, 0x93, 0x20, 0xE9,
-    0x6F, 0x95, 0x1C, 0xC9, 0xDB, 0xB2, 0x87, 0xD5, 0xB5, 0x48, 0x0B, 0xE7, 0x06, 0x8D, 0x35, 0x85,
-    0x09, 0x2B, 0x21, 0x74, 0x3D, 0x60, 0x62, 0x98, 0xD5, 0x2A, 0xDF, 0x57, 0x1D, 0x99, 0xD5, 0x83,
-    0xAD, 0xE7, 0x77, 0xBC, 0x34, 0x81, 0x00, 0x32, 0xBC, 0x18, 0x6B, 0xA3, 0xCB, 0x40, 0x7C, 0x18,
-    0xBF, 0xA9, 0x81, 0x76, 0xCE, 0x6D, 0x55, 0xDA, 0xA0, 0x0A, 0xF7, 0x2C, 0x11, 0xFE, 0x9C, 0x56,
-    0x74, 0xC8, 0x6A, 0xD1, 0xC9, 0xE4, 0xC5, 0xDF, 0x95, 0xFB, 0xAD, 0x74, 0xE6, 0x38, 0x40, 0xAE,
-    0xFF, 0x29, 0xEF, 0xC9, 0xB7, 0xD1, 0x3C, 0xDC, 0xD7, 0xBC, 0x01, 0xC3, 0x2C, 0x7D, 0x4A, 0x0C,
-    0x44, 0xBB, 0x9D, 0x81, 0xD9, 0xA7, 0xFB, 0x2B, 0xB0, 0x63, 0x8F, 0xD7, 0x89, 0x33, 0x81, 0x9A,
-    0x1B, 0x74, 0x46, 0xCB, 0xE1, 0xC2, 0x63, 0xF8, 0xEB, 0xF9, 0x95, 0x77, 0xCF, 0x1E, 0x52, 0xCF,
-    0xF7, 0x0E, 0x1D, 0xBC, 0xAC, 0xA6, 0x16, 0x68, 0xAE, 0xCD, 0xCC, 0x0D, 0xFF, 0xC8, 0xF8, 0x8B,
-    0x09, 0xDE, 0x1F, 0xD5, 0x2F, 0xEC, 0x26, 0x17, 0x75, 0xBA, 0x91, 0x96, 0x5F, 0x69, 0xFD, 0xBF,
-    0xF5, 0x64, 0x53, 0x7C, 0x4C, 0x61, 0x99, 0x49, 0x16, 0x7F, 0x67, 0xA4, 0x8C, 0x8F, 0xA9, 0x68,
-    0xBF, 0x7E, 0x40, 0x99, 0x11, 0x25, 0xC6, 0x1F, 0x59, 0x81, 0xBA, 0x97, 0x9F, 0x7D, 0x0B, 0xBA,
-    0xBA, 0xE0, 0x97, 0x5A, 0x24, 0x95, 0x3F, 0xFE, 0x17, 0xF2, 0xE2, 0xC7, 0x7F, 0x92, 0xEA, 0x9D,
-    0x7A, 0x17, 0x9C, 0x7B, 0xBA, 0xA1, 0xDA, 0xCB, 0x06, 0xD0, 0x8F, 0xC7, 0x3C, 0x42, 0xE5, 0x0D,
-    0x95, 0xB1, 0x4E, 0x4D, 0xD0, 0x9D, 0x83, 0x59, 0x4C, 0x9D, 0x7D, 0x66, 0x53, 0x0B, 0x1F, 0x6F,
-    0x34, 0x59, 0x03, 0x79, 0x9D, 0x6B, 0xCD, 0x20, 0xA8, 0xAC, 0x41, 0xFB, 0xB7, 0xFD, 0xDC, 0xAE,
-    0x1A, 0x8F, 0x4F, 0xEA, 0xC8, 0x7D, 0xB5, 0xEF, 0x94, 0x57, 0x96, 0x72, 0x0B, 0x87, 0x72, 0xCC,
-    0x18, 0xD6, 0x70, 0xDB, 0x1B, 0xD4, 0xCA, 0x33, 0xE4, 0x88, 0x16, 0xCD, 0x66, 0xAD, 0x0B, 0x77,
-    0xDF, 0xD1, 0x3F, 0xD3, 0xD5, 0x31, 0x15, 0x6A, 0x2F, 0x93, 0x9F, 0x1E, 0x68, 0xC6, 0x50, 0xC0,
-    0x0F, 0x46, 0xE1, 0x2F, 0xD4, 0xBD, 0xFF, 0xEC, 0x6B, 0x92, 0x6E, 0x69, 0xC3, 0x98, 0xC3, 0x5A,
-    0x53, 0x4A, 0xB0, 0x9E, 0x40, 0x0F, 0xAA, 0xD1, 0x97, 0x1E, 0x3C, 0x4E, 0xEE, 0xD7, 0xAE, 0x4D,
-    0xF6, 0xFD, 0x42, 0x0B, 0xBA, 0x26, 0xF0, 0x81, 0x6A, 0x21, 0x91, 0xE6, 0x23, 0x53, 0xC6, 0xDB,
-    0x15, 0x61, 0x49, 0xAB, 0x5B, 0xE9, 0x0D, 0x9E, 0x4A, 0xFD, 0x93, 0x2F, 0xC7, 0x6E, 0x86, 0x7C,
-    0xAC, 0xD1, 0xD9, 0x46, 0x0C, 0x54, 0xA7, 0xB9, 0x8A, 0x57, 0x5A, 0x24, 0x85, 0xFC, 0x3C, 0xD4,
-    0xFC, 0x9B, 0x46, 0x09, 0x9B, 0x6D, 0xC4, 0x9B, 0xFE, 0x0E, 0x8D, 0xD5, 0xDC, 0x8D, 0xD9, 0xDB,
-    0x9C, 0x77, 0x18, 0x63, 0x74, 0x2F, 0xAD, 0xBF, 0xBD, 0x45, 0x3E, 0xE2, 0x2B, 0xF4, 0x0C, 0x44,
-    0xF4, 0xEC, 0xD5, 0xFB, 0xB7, 0x9A, 0x4C, 0xF6, 0x95, 0x8D, 0x0C, 0x76, 0xB3, 0xF0, 0x6E, 0xCE,
-    0x49, 0x2E, 0xA2, 0xB1, 0x8B, 0x6E, 0x4B, 0x66, 0xD0, 0xCF, 0xAD, 0xC7, 0xA9, 0xBD, 0x91, 0x41,
-    0x3F, 0x1C, 0x7B, 0x36, 0xCA, 0x12, 0xDE, 0xFB, 0x3A, 0x73, 0x0D, 0x73, 0xEB, 0x66, 0x9C, 0x58,
-    0xD5, 0x2D, 0x6E, 0x58, 0x62, 0x58, 0xE6, 0xE4, 0x76, 0x19, 0xF4, 0xAF, 0x2F, 0xC4, 0x91, 0x9A,
-    0xFB, 0x2B, 0x6E, 0x66, 0xF8, 0xBF, 0xDC, 0x2E, 0xC6, 0xF0, 0x87, 0x35, 0xD0, 0x5B, 0xC3, 0x3A,
-    0x1B, 0x24, 0x98, 0x24, 0xB8, 0xE4, 0x08, 0x2E, 0x29, 0xA6, 0x01, 0x30, 0x87, 0x40, 0x41, 0xD6,
-    0xAD, 0x6B, 0xE0, 0x89, 0x1B, 0x15, 0x15, 0xE6, 0x1E, 0x71, 0xF8, 0x1F, 0x51, 0x9B, 0x72, 0x57,
-    0x0F, 0xAC, 0xA9, 0x3A, 0x56, 0x50, 0xC7, 0x26, 0x96, 0x74, 0x31, 0x72, 0xEE, 0x6C, 0x9A, 0x5B,
-    0xEF, 0x5F, 0xB0, 0xEF, 0x63, 0x97, 0xD9, 0xF6, 0x1B, 0x03, 0xEC, 0xBA, 0xB8, 0x40, 0x0E, 0x31,
-    0x04, 0x6E, 0x5F, 0x3E, 0x37, 0xEF, 0xB6, 0x60, 0xD9, 0x3E, 0x49, 0x98, 0x54, 0xA5, 0x84, 0x1C,
-    0xA3, 0x03, 0xA3, 0xFE, 0x08, 0xC3, 0xC3, 0x4D, 0x82, 0xD3, 0xF4, 0x0F, 0x4B, 0x86, 0xC3, 0x58,
-    0xF9, 0x83, 0xE1, 0x2B, 0xB8, 0x76, 0xA8, 0x36, 0xBF, 0xBF, 0xB9, 0xD8, 0x0C, 0x89, 0x63, 0x98,
-    0x80, 0x66, 0xA2, 0xCE, 0x68, 0x11, 0xD3, 0x63, 0x27, 0xD0, 0xFB, 0x28, 0x66, 0xD2, 0x3C, 0xFB,
-    0x6B, 0xEB, 0x0B, 0xF2, 0xDC, 0x9D, 0xDA, 0xC4, 0x3D, 0x6B, 0xE0, 0x85, 0x4B, 0x05, 0xD1, 0xC6,
-    0x39, 0x76, 0x6D, 0x46, 0x35, 0x1B, 0x88, 0xD4, 0x6D, 0xE4, 0xE6, 0x49, 0x71, 0x67, 0x45, 0x8A,
-    0xBB, 0x0E, 0xDB, 0xCD, 0x42, 0x61, 0x3B, 0xB3, 0x0C, 0x68, 0x8F, 0x11, 0x27, 0xE1, 0xDE, 0xA1,
-    0x04, 0xE3, 0xE8, 0xB6, 0xB9, 0x22, 0x20, 0x29, 0xD0, 0x99, 0x95, 0x35, 0xBB, 0x06, 0x4D, 0xB1,
-    0xCE, 0xC2, 0x66, 0xED, 0xEE, 0xD4, 0x21, 0x13, 0xEB, 0x08, 0xF8, 0x3B, 0xA2, 0x3B, 0x0C, 0xEF,
-    0x93, 0xC7, 0x4B, 0x29, 0x58, 0xB3, 0xE8, 0xD0, 0x0A, 0x3A, 0xB4, 0x52, 0x87, 0xCC, 0x96, 0x15,
-    0x93, 0x02, 0xB9, 0x09, 0x8A, 0xD9, 0xBE, 0xA3, 0xD3, 0x09, 0x15, 0x51, 0x27, 0xB2, 0xAB, 0x1C,
-    0x0A, 0xC0, 0xCF, 0x0D, 0x48, 0x85, 0x4A, 0xCD, 0x9E, 0x47, 0x23, 0x0E, 0x79, 0x6A, 0xFF, 0x34,
-    0x24, 0xE9, 0xCC, 0x1E, 0xCE, 0x73, 0x57, 0xE9, 0x1D, 0x7D, 0x5D, 0x59, 0xEB, 0x46, 0xD2, 0xD5,
-    0x29, 0x91, 0x59, 0x57, 0x2B, 0xAD, 0x33, 0x5D, 0xAD, 0x0C, 0x5F, 0xE8, 0x1E, 0xD1, 0x7B, 0xED,
-    0x75, 0x10, 0xC0, 0xBE, 0xD9, 0x93, 0x2D, 0x70, 0x6E, 0xDA, 0x15, 0x3F, 0x34, 0x77, 0xDE, 0x8B,
-    0x6F, 0x1B, 0xF7, 0xD3, 0x19, 0xC1, 0x5D, 0x41, 0x29, 0x25, 0x4D, 0xB0, 0x88, 0xCE, 0x2E, 0x06,
-    0xD8, 0xC5, 0xC3, 0x48, 0x54, 0x34, 0x97, 0xA2, 0x3D, 0x90, 0x8D, 0xA3, 0xC0, 0xC1, 0x94, 0xC6,
-    0x9B, 0xF2, 0xBE, 0xAD, 0xCD, 0x79, 0xDE, 0xDB, 0xD5, 0x78, 0xEC, 0xD3, 0x7D, 0x75, 0x34, 0x08,
-    0x73, 0x0F, 0x36, 0x5F, 0x72, 0xEE, 0xBC, 0x39, 0xB0, 0x3E, 0x49, 0x9E, 0x3D, 0x68, 0x40, 0x26,
-    0x07, 0xCA, 0x31, 0x72, 0x9A, 0xCD, 0xD6, 0x7B, 0xB9, 0x58, 0x14, 0xBF, 0xCE, 0xC5, 0x61, 0x5A,
-    0x69, 0xA7, 0xCF, 0x6F, 0xE9, 0x18, 0x56, 0xBE, 0x21, 0x59, 0xC5, 0x2B, 0x86, 0x84, 0x20, 0x4A,
-    0x83, 0x41, 0x07, 0x6B, 0x60, 0x40, 0x4A, 0x30, 0xFF, 0x9B, 0xB9, 0xC2, 0x9D, 0x94, 0xE9, 0x7E,
-    0x0B, 0x55, 0xD0, 0xC1, 0x6F, 0x3E, 0x61, 0x80, 0xD6, 0xD5, 0xD2, 0x44, 0x75, 0x66, 0xA2, 0x52,
-    0xCD, 0x2E, 0xC1, 0x3B, 0xFB, 0x0A, 0xC1, 0x9E, 0xD5, 0xDA, 0x6D, 0xBE, 0xC2, 0x3D, 0x28, 0xE7,
-    0xF1, 0x7A, 0x19, 0xCD, 0x8A, 0x31, 0x72, 0xFE, 0x2F, 0xC2, 0x44, 0x76, 0x09, 0xD2, 0xA3, 0x40,
-    0x99, 0x2C, 0xEA, 0x10, 0xE5, 0x0F, 0x72, 0xFD, 0xD5, 0xBD, 0xB4, 0x2F, 0x23, 0xFF, 0x47, 0x30,
-    0x6E, 0xF1, 0xC5, 0xE5, 0xC7, 0xC9, 0x1B, 0xE2, 0xEF, 0x04, 0x13, 0x5D, 0xD2, 0x89, 0xA2, 0xBD,
-    0xE7, 0x54, 0xF7, 0xB2, 0xEA, 0x95, 0x6A, 0x39, 0x7C, 0xB1, 0xF0, 0xB0, 0x24, 0xCE, 0x09, 0xA6,
-    0x70, 0x45, 0xB4, 0x9F, 0x16, 0x68, 0xB6, 0x9F, 0xC6, 0x9B, 0x93, 0xCD, 0x91, 0x73, 0xD0, 0x98,
-    0x01, 0x03, 0x28, 0xC9, 0x7E, 0x58, 0xC2, 0x74, 0xA3, 0x38, 0x6C, 0xF8, 0x63, 0x24, 0x47, 0x48,
-    0x8E, 0x81, 0xDC, 0xC8, 0x9A, 0x2D, 0x76, 0x37, 0xC2, 0xF1, 0xDD, 0x54, 0xE2, 0xBD, 0x9D, 0xD8,
-    0x7A, 0xBB, 0xAA, 0x77, 0xD3, 0x72, 0x63, 0xFD, 0x15, 0x46, 0x6E, 0x04, 0x07, 0xAE, 0xB6, 0x76,
-    0xE7, 0x74, 0x4B, 0xF6, 0xB5, 0x44, 0xBD, 0xDE, 0x0F, 0x8E, 0x06, 0x73, 0x50, 0x97, 0x09, 0xA4,
-    0xF7, 0x47, 0x58, 0x1C, 0x4E, 0x10, 0x98, 0xDC, 0xDF, 0x67, 0xE6, 0xB3, 0x24, 0x4B, 0x3A, 0x69,
-    0x9D, 0x1B, 0xED, 0xF9, 0x27, 0xF9, 0x4D, 0x72, 0xBF, 0x73, 0x87, 0x5E, 0x60, 0xD9, 0x12, 0x82,
-    0x99, 0xC4, 0x7A, 0xA9, 0x4E, 0x62, 0xD5, 0x75, 0x36, 0xFC, 0x26, 0x79, 0x3B, 0x71, 0x4B, 0xED,
-    0xA4, 0x9D, 0x69, 0x02, 0x5C, 0x56, 0x81, 0xEE, 0x7B, 0x25, 0xBA, 0x7F, 0x9C, 0xA1, 0xFC, 0xA5,
-    0xC7, 0x2D, 0xEE, 0xF5, 0xB7, 0x6E, 0x7C, 0x80, 0xBE, 0xDD, 0xF8, 0x04, 0xBD, 0xBC, 0xF1, 0x29,
-    0xFB, 0xFB, 0xD7, 0x20, 0xBF, 0x93, 0x1D, 0x86, 0x15, 0x5F, 0x5D, 0x97, 0x4F, 0xD1, 0xE9, 0x1B,
-    0x1F, 0x41, 0x5E, 0xDC, 0xF8, 0x10, 0x9D, 0xBE, 0x91, 0x0C, 0x5B, 0xA1, 0xE1, 0x4B, 0xB8, 0x2E,
-    0xD9, 0xD8, 0x61, 0x88, 0xBE, 0x1D, 0x58, 0x40, 0xDF, 0x42, 0xB6, 0xF3, 0x26, 0x78, 0xEE, 0xC5,
-    0xE4, 0xA4, 0xC9, 0xDB, 0x9B, 0xBC, 0x3D, 0xC1, 0xB7, 0xDE, 0xF8, 0x83, 0xBE, 0xA1, 0x47, 0x37,
-    0x7E, 0x05, 0xAC, 0x7E, 0xE3, 0x23, 0x74, 0xEB, 0xC6, 0xCF, 0x0B, 0x25, 0x29, 0x55, 0xB4, 0x4F,
-    0xD8, 0x37, 0x3F, 0x45, 0xDF, 0x9C, 0x62, 0xD3, 0xBC, 0xBD, 0x7A, 0x13, 0xF3, 0x56, 0x55, 0x6F,
-    0xEE, 0xF6, 0xBC, 0x4D, 0xD5, 0xB8, 0x2F, 0x6F, 0x4E, 0x24, 0x90, 0x45, 0x41, 0xF5, 0xAC, 0xBE,
-    0x36, 0xBA, 0x50, 0xFF, 0x09, 0x72, 0x14, 0x13, 0xA5, 0x2A, 0xCA, 0xB5, 0x2F, 0x34, 0x6F, 0x01,
-    0xE7, 0x2D, 0xE3, 0xE1, 0x20, 0x5E, 0xD2, 0x5B, 0x5C, 0x53, 0x71, 0x76, 0xD6, 0x49, 0x8D, 0x5F,
-    0x67, 0xDF, 0x86, 0xE9, 0x19, 0x45, 0x58, 0x43, 0x8E, 0x58, 0xFF, 0x8F, 0x09, 0x3D, 0x22, 0xF4,
-    0x98, 0x50, 0xCE, 0xAB, 0xF3, 0x73, 0xF1, 0xE0, 0x09, 0xE8, 0x73, 0x3E, 0x1C, 0x69, 0x3F, 0x01,
-    0xBD, 0x1E, 0xB4, 0xF3, 0x99, 0x28, 0xC3, 0x93, 0x40, 0x52, 0xBD, 0x16, 0xB9, 0xEA, 0x24, 0xA9,
-    0x95, 0x34, 0x96, 0x54, 0x4D, 0x3F, 0xE5, 0x5E, 0x4C, 0x67, 0x70, 0xB8, 0x7F, 0xD1, 0x78, 0x57,
-    0xF5, 0x16, 0x0B, 0xBB, 0x52, 0x67, 0xDD, 0xC4, 0x3D, 0xAD, 0xCE, 0xB8, 0xC9, 0xEC, 0x5E, 0x0A,
-    0xF8, 0x25, 0x11, 0xF3, 0x04, 0x4C, 0xEE, 0x07, 0x51, 0xEB, 0x0E, 0x70, 0x7F, 0x25, 0x49, 0x8A,
-    0xC9, 0xB0, 0xDD, 0x46, 0xCB, 0xC4, 0x6E, 0x52, 0x4F, 0x12, 0x41, 0x19, 0xC4, 0x9A, 0xBB, 0x02,
-    0x29, 0x68, 0x49, 0x42, 0x82, 0xC4, 0x63, 0x12, 0x4C, 0x1D, 0x40, 0xA8, 0xFD, 0x48, 0x36, 0x55,
-    0x7A, 0x63, 0x90, 0xB3, 0xDE, 0x5F, 0xA5, 0xED, 0x92, 0x71, 0x0A, 0x7D, 0x75, 0xA2, 0xFF, 0x4E,
-    0x67, 0x74, 0x22, 0x2E, 0x78, 0x0B, 0xAA, 0x2A, 0x1A, 0xE0, 0x93, 0x64, 0xBD, 0xBF, 0x58, 0x93,
-    0xAD, 0x3E, 0x1D, 0x80, 0x60, 0x56, 0xC3, 0x2B, 0x61, 0xF5, 0xBD, 0x6A, 0xD8, 0x3A, 0x80, 0x8E,
-    0xB7, 0xA7, 0x11, 0x3C, 0x36, 0x49, 0x94, 0x0E, 0x55, 0x31, 0x50, 0x75, 0x00, 0x62, 0x5B, 0x06,
-    0xC7, 0xD5, 0x3D, 0x71, 0x26, 0x2A, 0xB5, 0x4D, 0x25, 0x63, 0x54, 0x0F, 0xD2, 0xCE, 0x57, 0x6E,
-    0x53, 0x51, 0xC7, 0xE9, 0xD1, 0x6A, 0x86, 0x8B, 0xA3, 0xD0, 0xBF, 0xC0, 0x61, 0xB8, 0x96, 0x4B,
-    0x2C, 0x7E, 0x49, 0xFA, 0x76, 0x46, 0xE8, 0xB3, 0x42, 0x55, 0x4D, 0x39, 0x0E, 0x0D, 0x1D, 0x7F,
-    0x7F, 0x9C, 0x72, 0x48, 0x94, 0x8C, 0x89, 0xD2, 0x83, 0xA2, 0xCF, 0x24, 0x02, 0x83, 0xE0, 0x7B,
-    0x6B, 0x7A, 0x91, 0xD5, 0x71, 0x71, 0x9D, 0x31, 0x79, 0x2F, 0xF5, 0xD5, 0x93, 0xBA, 0xD6, 0xC1,
-    0x76, 0xFC, 0x1D, 0x66, 0xFA, 0xF3, 0xDA, 0xB8, 0x49, 0xF5, 0x46, 0x38, 0xF1, 0x11, 0xEB, 0x5A,
-    0xB0, 0x0D, 0x6A, 0xC9, 0x2E, 0x60, 0xAC, 0xA3, 0xA9, 0x29, 0xB9, 0xE6, 0x78, 0xA0, 0x50, 0x55,
-    0xBD, 0x81, 0xF6, 0x35, 0x86, 0x49, 0xED, 0xD9, 0x14, 0xA7, 0x04, 0x59, 0xC7, 0xAF, 0x19, 0xA9,
-    0xA7, 0xFD, 0x70, 0x3A, 0xCD, 0xD8, 0x1A, 0xBE, 0x96, 0x37, 0xD3, 0xA9, 0xF5, 0x7B, 0x20, 0xE8,
-    0x87, 0xB9, 0x9D, 0x40, 0x99, 0xCC, 0x8C, 0x10, 0x58, 0x25, 0x82, 0xA3, 0xA3, 0x76, 0xA8, 0xFA,
-    0x81, 0x54, 0xF4, 0x4E, 0xF0, 0xCD, 0x55, 0x5D, 0xF9, 0xBA, 0x12, 0x2E, 0x63, 0x4A, 0x9F, 0xE4,
-    0x18, 0xB9, 0xC9, 0x93, 0x43, 0x23, 0x4E, 0x9D, 0x24, 0xAC, 0xDE, 0xAC, 0x4A, 0xBD, 0x8F, 0xB0,
-    0xDE, 0x4E, 0xA8, 0xE1, 0xD9, 0x5E, 0xDD, 0x09, 0x57, 0x67, 0x01, 0x69, 0x9F, 0x9A, 0x72, 0x7F,
-    0x5B, 0x68, 0xCD, 0xBD, 0xD0, 0x46, 0x7F, 0x98, 0x1A, 0xF7, 0x56, 0x52, 0x47, 0xDD, 0x25, 0x30,
-    0x90, 0x98, 0x23, 0x60, 0x1B, 0xF7, 0x3A, 0x84, 0x89, 0xCF, 0x10, 0x90, 0xCF, 0x10, 0xD0, 0x2A,
-    0xB7, 0x1C, 0xAF, 0x70, 0x8F, 0xF1, 0x70, 0x9C, 0xF8, 0x9A, 0x70, 0x67, 0x46, 0x10, 0x9A, 0x03,
-    0x08, 0x82, 0x97, 0x72, 0xC8, 0x9F, 0x9F, 0xA6, 0xE0, 0xE4, 0xEB, 0x91, 0x1A, 0xBD, 0x2A, 0xD1,
-    0x9F, 0xEA, 0x35, 0x18, 0xB9, 0xDE, 0xB0, 0x76, 0x6F, 0xD3, 0x5C, 0x1F, 0xBD, 0x5B, 0xEF, 0xFE,
-    0xF4, 0x82, 0xBD, 0x44, 0x57, 0x71, 0xC6, 0x34, 0xC1, 0x42, 0xF5, 0x78, 0x64, 0xD1, 0x3C, 0xD3,
-    0x51, 0xE7, 0x79, 0x70, 0x91, 0x90, 0x2E, 0xFF, 0xF4, 0x19, 0x76, 0xE8, 0x98, 0x39, 0x90, 0x76,
-    0x32, 0xC2, 0x42, 0xBF, 0x19, 0x8B, 0x97, 0xF7, 0x5A, 0xA0, 0x8C, 0x13, 0xAB, 0xBB, 0xE9, 0xD8,
-    0x9A, 0x82, 0xC1, 0x33, 0xB6, 0xEB, 0xF7, 0x72, 0xED, 0x86, 0x38, 0xA4, 0x23, 0x6A, 0x46, 0xAF,
-    0xF6, 0x7C, 0x81, 0xF5, 0xEE, 0xD9, 0xB1, 0x65, 0x30, 0xB4, 0x0E, 0xC0, 0x5F, 0x67, 0x14, 0xBA,
-    0x35, 0xD4, 0x31, 0x33, 0x0D, 0x77, 0x9E, 0xCC, 0x74, 0x08, 0x81, 0x03, 0xC2, 0xB8, 0x75, 0x78,
-    0x09, 0xE8, 0x99, 0xD0, 0x2F, 0x39, 0x0B, 0x85, 0x91, 0x9C, 0x01, 0x49, 0xF7, 0xA3, 0x77, 0x81,
-    0x4E, 0x5D, 0xFB, 0x22, 0x84, 0x46, 0x03, 0x46, 0x2F, 0x6D, 0xC0, 0xA9, 0x20, 0x53, 0x0D, 0x4B,
-    0x37, 0x11, 0xE1, 0xE4, 0x8B, 0xE1, 0xE2, 0x7A, 0x79, 0xCE, 0x4E, 0x5F, 0x38, 0x6B, 0xA7, 0x07,
-    0xCF, 0xD8, 0xD0, 0x47, 0x77, 0x4A, 0xBB, 0x94, 0xD4, 0xCB, 0xB5, 0x3A, 0xFA, 0x29, 0x2E, 0xBD,
-    0x40, 0xA7, 0xC0, 0x5A, 0x63, 0x85, 0xFD, 0x8C, 0xE2, 0xA1, 0x37, 0x0C, 0x4E, 0x17, 0x5C, 0xB2,
-    0x62, 0xD3, 0x47, 0x3C, 0xA0, 0x82, 0x23, 0x76, 0xA8, 0xCE, 0x08, 0x70, 0x93, 0xB3, 0x5C, 0x6B,
-    0x84, 0x95, 0xDC, 0xDE, 0x6C, 0xDC, 0x8A, 0x9A, 0xD4, 0x94, 0xDE, 0x8E, 0x24, 0x14, 0x58, 0xBF,
-    0x40, 0xFE, 0x2B, 0xC4, 0x87, 0x10, 0xC5, 0xC5, 0xD4, 0x44, 0x12, 0x5A, 0x26, 0x5E, 0x5D, 0xC5,
-    0xB8, 0x01, 0x15, 0x82, 0x84, 0xFF, 0x4B, 0x36, 0x6C, 0x9E, 0x6A, 0xD7, 0x27, 0x5C, 0xEB, 0x50,
-    0x50, 0x7B, 0x7F, 0xCE, 0x65, 0x51, 0x4C, 0xC4, 0xA6, 0xC4, 0xF3, 0xB4, 0x99, 0xE4, 0x4D, 0xD4,
-    0x57, 0x6F, 0xDF, 0xDC, 0x95, 0xBE, 0xE9, 0xDD, 0x88, 0x0F, 0xB3, 0x6F, 0xB2, 0x9D, 0xD4, 0x78,
-    0x95, 0xD9, 0x9C, 0xDB, 0xF5, 0x6D, 0xF3, 0x46, 0xED, 0x52, 0x6F, 0xD4, 0x3E, 0xDB, 0x6C, 0xD4,
-    0xFE, 0xA0, 0xDD, 0xA8, 0x3D, 0xDA, 0x6A, 0xA3, 0x76, 0xB4, 0xC5, 0x46, 0xED, 0xB2, 0xDE, 0xA8,
-    0x9D, 0x34, 0x1B, 0xB5, 0xAB, 0x52, 0x67, 0x83, 0xF3, 0x7C, 0x37, 0xED, 0x42, 0x1B, 0x8B, 0x5C,
-    0x3B, 0x2D, 0xB9, 0x87, 0xBD, 0x15, 0x7C, 0xE5, 0x2E, 0x6F, 0xB5, 0xB7, 0x62, 0xC0, 0xBD, 0x15,
-    0x3C, 0x06, 0xC2, 0xDF, 0x79, 0x2F, 0x44, 0x8D, 0x1B, 0xB8, 0x3B, 0x86, 0x1B, 0xB4, 0xB1, 0x2A,
-    0xBC, 0x51, 0x70, 0xDE, 0x49, 0x67, 0x71, 0x87, 0xB3, 0xAC, 0x72, 0x75, 0x06, 0x40, 0x8D, 0x29,
-    0x56, 0x4E, 0xBA, 0xA7, 0x36, 0x83, 0x1E, 0x48, 0x45, 0xC5, 0x7D, 0xF5, 0x14, 0xC4, 0xAB, 0xB1,
-    0xB1, 0xA7, 0xBC, 0xDE, 0x54, 0x5E, 0x23, 0x9D, 0xDA, 0xD3, 0xD6, 0xB4, 0xB9, 0xAE, 0x1A, 0xB4,
-    0xC3, 0x65, 0xFD, 0xEF, 0xB0, 0xB0, 0xE3, 0xEB, 0xBF, 0xA9, 0x8A, 0x73, 0xDE, 0x89, 0xAC, 0x13,
-    0x9D, 0xF5, 0x82, 0xCC, 0x0B, 0xCE, 0x08, 0x55, 0xF7, 0xF7, 0x1B, 0xFE, 0xF0, 0xD4, 0xDC, 0xC7,
-    0x72, 0xB8, 0x88, 0xC6, 0xD1, 0xE5, 0x98, 0x1B, 0xF7, 0xC8, 0x18, 0x7D, 0x66, 0x3C, 0x2E, 0xF6,
-    0x85, 0xB6, 0xBA, 0xCB, 0x81, 0x6F, 0x2A, 0xEE, 0x57, 0xB2, 0xD5, 0xFD, 0x23, 0x06, 0xB0, 0x5E,
-    0xB9, 0xC3, 0x56, 0xF7, 0xC1, 0xC4, 0x56, 0xF7, 0xCD, 0x00, 0xD1, 0x1A, 0x03, 0x88, 0x13, 0x30,
-    0x51, 0x71, 0x1B, 0xCC, 0x05, 0x6E, 0x83, 0xA1, 0x5F, 0x6A, 0xC8, 0x65, 0xB1, 0x7C, 0x1B, 0xC9,
-    0x49, 0xD6, 0x5E, 0x43, 0xBF, 0xAB, 0x21, 0x38, 0xED, 0xE9, 0x60, 0xB9, 0x4D, 0xFD, 0x5D, 0x6E,
-    0x00, 0xA1, 0x51, 0x9D, 0xE4, 0xC2, 0xDD, 0x64, 0xAE, 0x6D, 0x65, 0xB3, 0xDD, 0xE5, 0xD0, 0xEC,
-    0x15, 0x3A, 0xDD, 0x52, 0xA3, 0x98, 0x96, 0x53, 0x00, 0x84, 0xC6, 0xD7, 0xC7, 0x4E, 0x01, 0xF8,
-    0xAE, 0x4E, 0xDA, 0xDB, 0x86, 0x6E, 0x3E, 0x05, 0x60, 0x87, 0x7D, 0x3F, 0x0B, 0x24, 0x3C, 0x85,
-    0x25, 0xCF, 0xB9, 0xEF, 0xE7, 0xFF, 0xB5, 0xFB, 0x7E, 0x98, 0x3F, 0xA7, 0x36, 0xC8, 0xC9, 0xF1,
-    0x7D, 0x3F, 0x1A, 0x1F, 0xCD, 0x0D, 0x55, 0x63, 0x5C, 0xA9, 0x3B, 0x1D, 0x4A, 0xC0, 0x4D, 0xBB,
-    0xD6, 0xAD, 0x75, 0xFA, 0xA9, 0x86, 0x4A, 0x8C, 0x38, 0x25, 0xF9, 0x53, 0x75, 0x00, 0xF9, 0x0E,
-    0x54, 0x4E, 0x1B, 0xD1, 0x67, 0x0C, 0x36, 0x59, 0x38, 0x61, 0x6B, 0xD8, 0x6D, 0xE9, 0x16, 0xCB,
-    0x79, 0x52, 0xD6, 0xEF, 0xE9, 0xB4, 0x1C, 0xD1, 0x23, 0x56, 0x8C, 0xED, 0xA6, 0x9F, 0xBF, 0x6B,
-    0x72, 0x60, 0x4D, 0x85, 0xC0, 0xF5, 0x41, 0x98, 0x35, 0x9E, 0x12, 0x47, 0x9C, 0xCE, 0xE1, 0x5B,
-    0x3A, 0x45, 0x4A, 0xA7, 0x8B, 0x79, 0x91, 0x06, 0x9E, 0xFC, 0x85, 0xE4, 0xF0, 0x98, 0x73, 0xB3,
-    0x0C, 0x1C, 0x62, 0xE7, 0xCB, 0x3E, 0xE1, 0x6C, 0x88, 0xB5, 0xF4, 0x5A, 0xEE, 0x71, 0x2D, 0x49,
-    0xFA, 0x5A, 0x8D, 0x54, 0x34, 0x56, 0x69, 0x58, 0xD6, 0x4D, 0xEA, 0x38, 0x67, 0xDD, 0xAB, 0x88,
-    0x61, 0x06, 0x89, 0x2D, 0x7C, 0x56, 0xB5, 0xB6, 0x61, 0x9D, 0x11, 0x4E, 0x93, 0x78, 0x5D, 0x32,
-    0x21, 0x7D, 0x80, 0xB1, 0xC0, 0x8B, 0xCE, 0x13, 0x45, 0x2E, 0xD3, 0x7F, 0xB5, 0x22, 0x47, 0x44,
-    0x52, 0x8C, 0x18, 0xDC, 0x1F, 0xA2, 0x75, 0x4C, 0xB7, 0xCD, 0x5C, 0x17, 0xF4, 0x2B, 0x59, 0x81,
-    0xB6, 0x78, 0x97, 0xE2, 0x62, 0x3C, 0x81, 0xFD, 0x51, 0x77, 0xCF, 0xD0, 0x53, 0xDB, 0x1B, 0x0B,
-    0x1D, 0x1D, 0xB9, 0x8D, 0xAA, 0x5D, 0x1E, 0x02, 0x79, 0xB2, 0x88, 0x5B, 0x09, 0x1B, 0x88, 0x26,
-    0xB2, 0x27, 0x89, 0x36, 0x08, 0xC0, 0xED, 0xF6, 0xFD, 0x1E, 0x8C, 0xC9, 0x5D, 0x3E, 0x5F, 0xAD,
-    0x81, 0xBD, 0xA7, 0xC6, 0x42, 0xFF, 0xE8, 0x73, 0x39, 0x16, 0xA2, 0xDB, 0x48, 0x93, 0xF9, 0x1B,
-    0x72, 0xC4, 0x98, 0x11, 0xED, 0x13, 0xD0, 0xA9, 0xD3, 0x2C, 0x65, 0x6C, 0xB5, 0xBD, 0xBC, 0xD1,
-    0x9D, 0x07, 0xBD, 0xEB, 0xFC, 0x1E, 0xFD, 0x80, 0xDA, 0xCC, 0x86, 0x58, 0xB9, 0xF9, 0x9A, 0x88,
-    0x84, 0x58, 0x66, 0x29, 0xA9, 0x4F, 0x77, 0x68, 0xFC, 0x4A, 0x0D, 0x31, 0x73, 0x4C, 0xA0, 0x99,
-    0x4B, 0x50, 0x68, 0x4C, 0xC0, 0x1C, 0xD3, 0x5B, 0x0A, 0x24, 0x0B, 0x01, 0xCC, 0xCE, 0xA4, 0xBB,
-    0x8D, 0xD4, 0xB8, 0xD7, 0xFB, 0xC1, 0x77, 0xD5, 0xDC, 0xE8, 0x84, 0x38, 0x03, 0x3F, 0x49, 0x4C,
-    0xBA, 0x7A, 0x4D, 0xB6, 0x80, 0xA9, 0x47, 0x20, 0x99, 0xF8, 0x78, 0xB1, 0x02, 0x46, 0x97, 0xC4,
-    0x3C, 0x1C, 0x92, 0x88, 0x69, 0xE8, 0x89, 0xFB, 0x81, 0x66, 0x21, 0x8D, 0x42, 0x45, 0x93, 0x30,
-    0x72, 0xC6, 0xDD, 0xF4, 0x7B, 0x68, 0x0A, 0x1E, 0x27, 0x84, 0xF2, 0x69, 0x91, 0x74, 0x7E, 0x39,
-    0x10, 0x67, 0xAA, 0x7A, 0x34, 0xA7, 0x80, 0xDD, 0xD4, 0xA7, 0x80, 0xC9, 0x36, 0x73, 0x6D, 0x05,
-    0x38, 0x63, 0x71, 0xE0, 0x43, 0x63, 0xCB, 0xB8, 0x49, 0x91, 0xDA, 0xE5, 0x0D, 0xEE, 0xC9, 0x1E,
-    0x7D, 0x34, 0xB0, 0xDE, 0x92, 0xB7, 0x81, 0x29, 0x8F, 0x8E, 0xC5, 0x9E, 0x1F, 0xB2, 0xD3, 0xCA,
-    0x14, 0xA7, 0x15, 0x5D, 0x8A, 0x35, 0xCB, 0x4C, 0xE8, 0x41, 0x5B, 0x86, 0x52, 0x67, 0x39, 0x71,
-    0xB1, 0x08, 0xE3, 0xC8, 0x56, 0xE6, 0xDD, 0x73, 0x5A, 0x61, 0x41, 0x57, 0x91, 0xF6, 0x18, 0xB4,
-    0xC1, 0x50, 0x00, 0xBA, 0x59, 0x72, 0x4D, 0x57, 0x73, 0x4D, 0x41, 0xAE, 0x59, 0x50, 0x8F, 0xC8,
-    0x9F, 0x17, 0x88, 0x83, 0x6A, 0xBB, 0x70, 0xB2, 0x28, 0x0D, 0x27, 0x18, 0xCF, 0x27, 0xD8, 0xE5,
-    0x13, 0x06, 0xB2, 0xC6, 0x42, 0xD6, 0x61, 0xE3, 0xA8, 0x79, 0x9E, 0x3C, 0xCE, 0x7B, 0xE4, 0x48,
-    0x56, 0x9B, 0x00, 0x23, 0x19, 0x81, 0x62, 0x2C, 0x8C, 0x33, 0x36, 0x60, 0xAA, 0xC5, 0x23, 0xBB,
-    0x85, 0x64, 0xA7, 0xAA, 0xA0, 0x46, 0xB2, 0x7A, 0x6F, 0x4F, 0xBB, 0x80, 0x0F, 0xB6, 0xE4, 0x99,
-    0x46, 0x15, 0x96, 0x92, 0x13, 0x33, 0x47, 0x0F, 0x34, 0xF8, 0x66, 0x24, 0x46, 0xA7, 0x05, 0x55,
-    0x7A, 0x08, 0x63, 0xB0, 0x18, 0x70, 0xAF, 0x83, 0xF5, 0x83, 0x88, 0xDB, 0x31, 0xAC, 0x1F, 0x24,
-    0xEA, 0x5F, 0xA2, 0xFA, 0x7E, 0xAA, 0x20, 0x76, 0x79, 0x2C, 0xEB, 0x87, 0x52, 0x99, 0xEF, 0xA1,
-    0x7A, 0xA3, 0xB0, 0x58, 0x45, 0xA5, 0x7D, 0x82, 0xD5, 0xB2, 0xC3, 0x13, 0x51, 0xA2, 0xDE, 0xB4,
-    0x54, 0xFE, 0x41, 0xA9, 0x3A, 0x7F, 0x2E, 0x95, 0x5B, 0xE8, 0x6A, 0x20, 0x95, 0xCD, 0x0C, 0x06,
-    0x8F, 0x3B, 0x0F, 0xC1, 0x49, 0xB0, 0x86, 0x9B, 0xAD, 0xF9, 0x75, 0x2C, 0xCE, 0x9C, 0x30, 0x99,
-    0x34, 0x3B, 0xA9, 0x3A, 0x63, 0xCA, 0xDB, 0xD0, 0x49, 0x0F, 0xE8, 0x4C, 0x8C, 0x93, 0xFA, 0x4C,
-    0x8C, 0x8D, 0x09, 0xD3, 0x39, 0x43, 0x66, 0xB2, 0x99, 0xC3, 0x9B, 0x1C, 0xAE, 0x2F, 0x0A, 0x2C,
-    0xE4, 0xF8, 0x60, 0x2C, 0xED, 0xF3, 0xE2, 0xE3, 0x2C, 0x25, 0x77, 0x44, 0x1E, 0xFC, 0xC4, 0x18,
-    0x9C, 0x38, 0x7A, 0x3F, 0x87, 0xE6, 0x4E, 0x6F, 0x73, 0x68, 0x6E, 0xBC, 0x71, 0x68, 0xAE, 0x31,
-    0x76, 0x68, 0xAE, 0xB5, 0xCD, 0xA1, 0xB9, 0x66, 0xF0, 0x14, 0x04, 0x11, 0x8F, 0x6A, 0xEA, 0xE9,
-    0x58, 0x4A, 0x7D, 0xD0, 0x92, 0x1C, 0x31, 0xB4, 0xAE, 0x8F, 0x18, 0x72, 0x83, 0x2D, 0x8E, 0x18,
-    0xBA, 0xA2, 0xB7, 0xF7, 0xCE, 0xCB, 0x31, 0x43, 0x1D, 0xD4, 0xCD, 0x11, 0x43, 0x3F, 0x48, 0x9D,
-    0xE6, 0x88, 0xA1, 0xA9, 0x80, 0x29, 0x36, 0xEE, 0x7B, 0x83, 0x96, 0x9A, 0x9B, 0x72, 0xB3, 0x1E,
-    0x75, 0xEF, 0xB7, 0xD9, 0xDC, 0xBD, 0x2B, 0xBD, 0x67, 0xF6, 0x02, 0x01, 0xD3, 0x93, 0xD5, 0x67,
-    0x8B, 0xCC, 0x9C, 0x5B, 0x94, 0x4D, 0x3F, 0x0E, 0xEE, 0x40, 0x0D, 0x0F, 0xFD, 0xC2, 0x93, 0x75,
-    0x51, 0x71, 0x33, 0xAF, 0x40, 0x33, 0xB5, 0xA4, 0xAB, 0xAC, 0xF6, 0x82, 0x77, 0x3E, 0x7B, 0x87,
-    0x02, 0xB0, 0x23, 0xE7, 0x12, 0x68, 0x64, 0xEC, 0x9D, 0x9A, 0x0B, 0xB4, 0x5F, 0x24, 0x90, 0x94,
-    0x27, 0x79, 0x53, 0xFB, 0xBC, 0x0D, 0x7A, 0xDD, 0xD5, 0x31, 0xA6, 0x29, 0x06, 0xEA, 0x2C, 0xFA,
-    0x8A, 0xEA, 0x72, 0x27, 0x55, 0xE1, 0x0F, 0x5F, 0x1D, 0x54, 0x25, 0x77, 0xF2, 0x0E, 0xD0, 0x2D,
-    0x0F, 0x6A, 0x68, 0x7D, 0x38, 0x8A, 0xD9, 0x35, 0xEE, 0xA4, 0x0F, 0x78, 0x8E, 0xC0, 0x94, 0x46,
-    0x58, 0xDA, 0x5B, 0xCF, 0x14, 0xCD, 0xDC, 0x60, 0xF8, 0x20, 0x47, 0x37, 0x7F, 0x78, 0xEA, 0xA4,
-    0x2F, 0x1D, 0x9F, 0x17, 0xD1, 0xB3, 0x22, 0x58, 0x7C, 0x5E, 0xDC, 0xA7, 0x3D, 0xF5, 0x5F, 0x73,
-    0x23, 0xF5, 0xAF, 0x7D, 0x38, 0x5A, 0x4C, 0x1C, 0xE8, 0xAA, 0x91, 0x38, 0x6B, 0x71, 0xE9, 0xC2,
-    0x14, 0xC1, 0x1D, 0x70, 0x12, 0x8C, 0x0B, 0x1E, 0x62, 0x60, 0x04, 0xED, 0x7F, 0x84, 0x30, 0x07,
-    0x1D, 0x60, 0xDF, 0xF9, 0xB0, 0xDF, 0xE8, 0x8E, 0x87, 0xFD, 0xDE, 0x3C, 0x25, 0x01, 0x0E, 0x61,
-    0xDF, 0x84, 0x87, 0xBA, 0x84, 0x13, 0xEC, 0xAB, 0x7D, 0xC6, 0x65, 0xED, 0x33, 0x96, 0x69, 0x94,
-    0x1D, 0xFA, 0x34, 0x3E, 0x00, 0xC3, 0x92, 0x1E, 0x4C, 0x8F, 0xDE, 0x6D, 0xC9, 0x90, 0x76, 0x20,
-    0x46, 0x47, 0x5C, 0x8C, 0x59, 0x5D, 0xF1, 0x88, 0x27, 0x2E, 0x40, 0x88, 0xB9, 0x91, 0x5D, 0xF2,
-    0x94, 0xEB, 0xD5, 0x0D, 0x5B, 0x25, 0x1A, 0xC3, 0x7E, 0x04, 0xE9, 0x4F, 0x9C, 0x3A, 0x75, 0x3A,
-    0xE5, 0x56, 0xA8, 0x34, 0xE4, 0xAB, 0x1E, 0xDF, 0xF3, 0xB5, 0x15, 0xA4, 0x49, 0x87, 0xA7, 0x7A,
-    0xF9, 0x81, 0xCB, 0xC0, 0x86, 0x44, 0x35, 0x4C, 0x09, 0x69, 0xE8, 0xDC, 0x1C, 0x1E, 0x64, 0x00,
-    0x91, 0xE1, 0xA2, 0x1B, 0xC7, 0xA1, 0x2C, 0x9E, 0xD5, 0xBB, 0x6F, 0x82, 0x3A, 0xD7, 0x53, 0x22,
-    0x7E, 0x31, 0x0F, 0xA2, 0xEA, 0x2F, 0x42, 0xB4, 0x49, 0x57, 0x78, 0xFC, 0x57, 0x40, 0x4E, 0x74,
-    0x7F, 0xC1, 0x9C, 0xDD, 0x4C, 0xA7, 0xFD, 0x3D, 0x3F, 0xC5, 0xE9, 0xE2, 0x17, 0x84, 0x3C, 0x6E,
-    0x4E, 0x2C, 0xB7, 0x87, 0xDA, 0x1F, 0x33, 0xFA, 0x53, 0x1E, 0x00, 0x23, 0xC5, 0x0C, 0xBE, 0xBD,
-    0xB1, 0xBE, 0x76, 0xA3, 0x9F, 0xCA, 0x58, 0x78, 0xBE, 0x4E, 0x20, 0x9B, 0x9F, 0xA8, 0x55, 0xF4,
-    0xF8, 0x16, 0x49, 0x82, 0x7F, 0x73, 0xCE, 0x85, 0xBE, 0xF0, 0x87, 0xAA, 0xDE, 0x0E, 0x54, 0x53,
-    0x75, 0xF2, 0xA9, 0xC9, 0xBE, 0x3C, 0x68, 0xA3, 0x4D, 0x61, 0x64, 0x4D, 0xD9, 0x1C, 0x84, 0x05,
-    0xB2, 0xF0, 0xD4, 0x44, 0x26, 0xCA, 0x83, 0x38, 0xAF, 0x7A, 0x9F, 0xB1, 0xE0, 0xBD, 0x94, 0xE3,
-    0x77, 0xAF, 0xAA, 0x03, 0x66, 0xF7, 0x71, 0x58, 0x99, 0x4B, 0x89, 0x05, 0xCE, 0xF6, 0xFA, 0x97,
-    0x92, 0x67, 0x30, 0x9B, 0x4F, 0x89, 0x5D, 0x93, 0x6B, 0xC5, 0xEE, 0xD6, 0xD9, 0xAA, 0x0C, 0x12,
-    0x5E, 0x12, 0x34, 0x95, 0x35, 0x0D, 0xDB, 0x2E, 0x4D, 0xC6, 0x61, 0xE3, 0x9E, 0xE0, 0x01, 0x25,
-    0xFD, 0xC0, 0x67, 0xA6, 0x65, 0x3F, 0xC6, 0x1D, 0x67, 0xD5, 0x0C, 0x63, 0x55, 0x8C, 0x25, 0x11,
-    0x2A, 0xB8, 0xB5, 0xF9, 0xC4, 0x13, 0x65, 0x65, 0xDF, 0x54, 0xA5, 0xC6, 0xA2, 0x5C, 0xE9, 0x58,
-    0x49, 0x9E, 0xC3, 0x7B, 0xEF, 0x2A, 0xEE, 0x53, 0xF5, 0x55, 0xF8, 0x56, 0xA1, 0x1C, 0xDA, 0x15,
-    0x53, 0x0C, 0x5E, 0x36, 0xC7, 0x63, 0xAB, 0x2F, 0xCB, 0xFF, 0x7A, 0x70, 0xB8, 0x1F, 0x09, 0xC8,
-    0x1E, 0x67, 0xB9, 0xDD, 0x4E, 0x0E, 0xA5, 0x6C, 0xA8, 0x0F, 0x5A, 0xA8, 0xE9, 0xC4, 0xF1, 0x2A,
-    0x5F, 0x82, 0x51, 0x10, 0x41, 0xDA, 0x1B, 0x13, 0xA4, 0xC1, 0x83, 0x1C, 0x0F, 0xAC, 0x01, 0x70,
-    0x25, 0x31, 0x8E, 0x90, 0xBD, 0x2A, 0x1A, 0x1F, 0x8A, 0xAD, 0x77, 0x0F, 0x5A, 0x59, 0x87, 0x98,
-    0xC6, 0x0F, 0xDA, 0xDD, 0x83, 0x77, 0x79, 0x5A, 0xF5, 0xCE, 0xBB, 0x07, 0x29, 0x58, 0x29, 0x4C,
-    0x45, 0xA0, 0x8E, 0x0B, 0xD3, 0xED, 0x76, 0x15, 0xCA, 0x5E, 0xA8, 0x8D, 0xD2, 0xD5, 0xE7, 0xBE,
-    0x6D, 0xB9, 0xAB, 0xF0, 0xDE, 0x36, 0x43, 0x4A, 0xFB, 0xFB, 0xFD, 0x7E, 0x49, 0x2D, 0xC4, 0x9E,
-    0xA8, 0x5D, 0xDC, 0x0C, 0xC9, 0xA6, 0xF2, 0xEC, 0x84, 0xB0, 0x7F, 0xA9, 0x6E, 0xF6, 0xF6, 0x9B,
-    0x21, 0x6F, 0x9F, 0x9E, 0x85, 0x3B, 0x4F, 0xCF, 0x03, 0xEA, 0x8F, 0x9E, 0x1E, 0x6E, 0xFF, 0x9E,
-    0x94, 0xCE, 0xBB, 0xD2, 0x4F, 0xB9, 0xF7, 0x56, 0x92, 0xFF, 0xC1, 0x1C, 0xEA, 0xCA, 0x61, 0xED,
-    0x60, 0x40, 0x59, 0xBE, 0x6A, 0x6C, 0xB0, 0xFC, 0x6E, 0x1C, 0x60, 0x05, 0xC9, 0x7D, 0x81, 0x28,
-    0x7C, 0x7C, 0x8B, 0xE3, 0x43, 0x3E, 0xF1, 0xFB, 0xF5, 0x2D, 0x04, 0xE9, 0xC5, 0x29, 0x1E, 0xD3,
-    0xA2, 0xA3, 0xC8, 0xCB, 0xD4, 0x0D, 0xF2, 0x9F, 0x69, 0xD0, 0x99, 0x69, 0xF0, 0x98, 0x16, 0xB3,
-    0x89, 0x22, 0xCF, 0xD3, 0x6D, 0xD6, 0xDD, 0x38, 0xA6, 0xE5, 0x8F, 0xDB, 0x63, 0x5A, 0x8A, 0xC6,
-    0x27, 0xA1, 0xB3, 0xE4, 0xB2, 0x36, 0xBD, 0xBE, 0xF5, 0x93, 0x73, 0xB0, 0x9E, 0x94, 0x7C, 0x5A,
-    0x61, 0xD3, 0x1D, 0x65, 0xCB, 0x43, 0x1E, 0x92, 0xDB, 0xE0, 0x69, 0xF0, 0x88, 0x07, 0x47, 0x76,
-    0x06, 0xF3, 0x3C, 0x75, 0x3C, 0x89, 0x5E, 0x93, 0xF7, 0xF0, 0xBD, 0x43, 0xFC, 0x4A, 0xBB, 0xE1,
-    0xF6, 0x21, 0x8F, 0x90, 0x71, 0xF2, 0x71, 0x25, 0xBB, 0x4C, 0x95, 0xFB, 0x3E, 0xC3, 0xCF, 0x04,
-    0xA7, 0xB2, 0x03, 0x78, 0xFF, 0x9E, 0x47, 0x38, 0x4C, 0x66, 0xF4, 0xBC, 0xE4, 0x28, 0x2C, 0xB7,
-    0xD4, 0x88, 0x36, 0xE9, 0xEB, 0x47, 0x7B, 0x96, 0xBA, 0x7A, 0x9E, 0xAC, 0xD4, 0xA3, 0x47, 0xBE,
-    0x4B, 0xF2, 0xD4, 0x04, 0x67, 0xED, 0xF6, 0xD9, 0x8A, 0xDA, 0x9A, 0xBD, 0x34, 0x6E, 0xCD, 0xCE,
-    0x7E, 0xE1, 0xAD, 0x13, 0x8C, 0xC6, 0x71, 0x02, 0x38, 0x7F, 0x46, 0x5D, 0xEA, 0xA8, 0xF8, 0x8E,
-    0x59, 0xFE, 0x3B, 0x6E, 0xA5, 0x08, 0x64, 0xDB, 0x82, 0x80, 0x50, 0x72, 0x12, 0x9D, 0x10, 0x46,
-    0x5D, 0xDA, 0x44, 0x78, 0x59, 0x94, 0xE0, 0x4D, 0x1D, 0x08, 0xAC, 0xAB, 0xE7, 0xA6, 0x6E, 0x33,
-    0xA2, 0xBE, 0x84, 0xC7, 0x98, 0x83, 0x0D, 0xEF, 0xC8, 0x98, 0x0F, 0xFA, 0xB8, 0xC6, 0xDD, 0xDD,
-    0xA7, 0x72, 0x52, 0xF9, 0xB2, 0xC7, 0xE0, 0x4C, 0x5D, 0x60, 0xCB, 0x1D, 0xCE, 0xE5, 0x0C, 0x3C,
-    0xF5, 0x74, 0xF0, 0x05, 0xF6, 0xAF, 0x04, 0xF2, 0x7F, 0x5E, 0x68, 0xF7, 0x74, 0x5D, 0xFE, 0x79,
-    0xAA, 0xFF, 0x33, 0xC3, 0xC3, 0xEA, 0xA1, 0xA5, 0x1A, 0x95, 0xAD, 0xB7, 0xFA, 0x99, 0x26, 0x6C,
-    0xBC, 0x6F, 0xB9, 0xC9, 0x1F, 0x9A, 0x5A, 0xD8, 0xB5, 0x2C, 0x23, 0x7D, 0x82, 0x6B, 0x9B, 0x60,
-    0x64, 0x35, 0xD1, 0x04, 0xE3, 0x3F, 0xB5, 0xF2, 0xF8, 0xE2, 0xBD, 0x75, 0x7A, 0xEA, 0xD2, 0xA8,
-    0x1F, 0xD9, 0xF5, 0x7F, 0x86, 0x76, 0xD7, 0x9D, 0xCE, 0xA4, 0xD3, 0x3B, 0x77, 0xCB, 0x38, 0xBD,
-    0x76, 0x52, 0xC9, 0x71, 0x2D, 0xF5, 0xC1, 0xB4, 0x77, 0xEA, 0x56, 0xF4, 0xFF, 0x01, 0xD5, 0x5A,
-    0x4F, 0x8C, 0xDC, 0x66, 0x15, 0x7F, 0xB6, 0x27, 0xEB, 0xA4, 0x86, 0xF5, 0x56, 0x5A, 0x94, 0x94,
-    0xD2, 0x75, 0x0F, 0x20, 0x25, 0x55, 0x12, 0x73, 0xE0, 0x80, 0x60, 0xB3, 0xFE, 0x68, 0x0E, 0x45,
-    0xEA, 0xA1, 0x7B, 0x60, 0xC5, 0x09, 0xF5, 0x1A, 0xF5, 0xB2, 0x3D, 0xF4, 0xD0, 0x43, 0x76, 0x6C,
-    0x29, 0x87, 0x1E, 0xB3, 0x1C, 0xE0, 0x82, 0x84, 0x72, 0xC8, 0x21, 0x44, 0xAA, 0xD2, 0xC3, 0x1E,
-    0x10, 0xCA, 0x32, 0x46, 0x02, 0xF5, 0x6A, 0x89, 0x03, 0x87, 0x1E, 0x30, 0x6D, 0xE0, 0x40, 0x10,
-    0x31, 0x68, 0x2A, 0xBC, 0x93, 0x99, 0x31, 0xBF, 0xF7, 0xBE, 0xCF, 0x9E, 0xC9, 0x1F, 0x42, 0x0B,
-    0xE3, 0x59, 0x77, 0xB4, 0xDF, 0x9B, 0x59, 0xDB, 0xF3, 0xF9, 0xBD, 0xDF, 0xF7, 0xFE, 0xFC, 0xDE,
-    0xE7, 0x21, 0xBA, 0x48, 0xFC, 0x8A, 0x45, 0x0E, 0x14, 0xCB, 0x07, 0x09, 0x84, 0xF5, 0xC7, 0x14,
-    0xD2, 0xF9, 0x30, 0x63, 0x79, 0xAD, 0x80, 0xF4, 0x2E, 0xB3, 0xF4, 0xAD, 0x12, 0x72, 0x95, 0xC6,
-    0x90, 0xE7, 0xE9, 0x10, 0x72, 0x93, 0xFA, 0x90, 0x7B, 0x3B, 0x3C, 0xC5, 0xA0, 0xAA, 0x30, 0x45,
-    0x4E, 0x41, 0x42, 0x56, 0x46, 0x7E, 0x4A, 0x4E, 0x4A, 0x5E, 0x46, 0x4E, 0x42, 0x4E, 0x41, 0x9E,
-    0xC8, 0x20, 0x23, 0x6F, 0x42, 0xD5, 0x98, 0xE2, 0x2A, 0xA1, 0x47, 0x5E, 0x5B, 0x73, 0x9A, 0xE8,
-    0xCF, 0x3D, 0x56, 0x64, 0x90, 0x93, 0x3F, 0x1A, 0x63, 0xCA, 0x88, 0x7C, 0x15, 0xD2, 0x0A, 0x05,
-    0x38, 0x1A, 0xE0, 0x36, 0xA1, 0xB2, 0x06, 0x95, 0x0A, 0xEE, 0x85, 0x2A, 0xC2, 0xFF, 0x7B, 0x18,
-    0x87, 0x38, 0xB6, 0x47, 0x91, 0xEA, 0xC3, 0x92, 0xE8, 0xFE, 0xF5, 0xCC, 0x9B, 0xFA, 0x05, 0x6D,
-    0x9B, 0xE9, 0x43, 0x8C, 0x48, 0xBE, 0xA6, 0x27, 0xA6, 0xB7, 0x58, 0xD8, 0x15, 0x5B, 0x68, 0x7D,
-    0x2F, 0x97, 0x7F, 0x44, 0x86, 0xA2, 0xD7, 0xA6, 0x7C, 0xE9, 0xFC, 0x9C, 0x7E, 0xC7, 0x8A, 0x54,
-    0x8C, 0x5B, 0x8D, 0x30, 0xAD, 0xC2, 0xB0, 0x30, 0xF0, 0x0D, 0xFA, 0x32, 0xE9, 0xB1, 0x38, 0x94,
-    0xAC, 0x7D, 0x96, 0x0E, 0x9B, 0x72, 0xCE, 0x63, 0x13, 0xAB, 0xEF, 0x33, 0x2C, 0xFF, 0x62, 0x0B,
-    0xDD, 0x84, 0xAD, 0x3A, 0x45, 0xEB, 0x1D, 0x41, 0x84, 0xE8, 0x26, 0x54, 0xC3, 0xC1, 0xCB, 0x09,
-    0x45, 0xBF, 0x23, 0xFA, 0xB4, 0xC0, 0x37, 0x36, 0xC9, 0xD2, 0x8B, 0xBB, 0x10, 0x44, 0xEC, 0x64,
-    0xE6, 0x15, 0x74, 0x70, 0x8E, 0xE5, 0x19, 0x56, 0xB2, 0x9B, 0x88, 0x5C, 0x31, 0x71, 0xE3, 0xB9,
-    0x19, 0x59, 0x6F, 0x60, 0xFA, 0x4B, 0x57, 0x89, 0x0A, 0x1F, 0x3E, 0x63, 0x69, 0xE5, 0x76, 0x4B,
-    0x72, 0xA6, 0x03, 0x72, 0x73, 0x3F, 0x75, 0x32, 0x2F, 0xB5, 0x12, 0x17, 0x5A, 0xE1, 0x62, 0x9E,
-    0x74, 0xB7, 0xCA, 0xDC, 0x23, 0x2F, 0xF3, 0x53, 0x37, 0x0B, 0x94, 0x9B, 0x85, 0xCA, 0xC3, 0xBB,
-    0x9F, 0x05, 0x49, 0x98, 0xF9, 0xA3, 0x4F, 0x86, 0x76, 0x75, 0x6D, 0x6C, 0xEC, 0xEC, 0x8B, 0xFC,
-    0xA1, 0x40, 0xE3, 0xB0, 0x3C, 0xB7, 0x41, 0x5D, 0xF7, 0x14, 0x0E, 0x7D, 0xBC, 0x3F, 0x8F, 0xFB,
-    0xE0, 0x1B, 0xC1, 0xEB, 0x8A, 0xA2, 0xB4, 0x15, 0x8F, 0x41, 0x04, 0x9D, 0x61, 0x04, 0x26, 0xEF,
-    0xB2, 0xFE, 0xBB, 0x43, 0xC8, 0x93, 0x96, 0x68, 0x20, 0xDE, 0x43, 0xDD, 0xF5, 0x1E, 0xBA, 0x79,
-    0x8A, 0x9C, 0xEA, 0x7D, 0x72, 0x5F, 0x1F, 0x03, 0x91, 0x6D, 0x6D, 0x78, 0x5B, 0x28, 0xD1, 0x57,
-    0xB4, 0x8D, 0x1A, 0x13, 0xB1, 0xEE, 0xF7, 0x1C, 0x65, 0x9E, 0x3A, 0x90, 0xB4, 0xBF, 0xD6, 0x25,
-    0xCF, 0x79, 0x76, 0x7D, 0xA2, 0x13, 0xA4, 0x71, 0x8A, 0x61, 0xC0, 0x3F, 0xDA, 0xC0, 0xEA, 0x69,
-    0xB5, 0xCB, 0x92, 0x33, 0x1C, 0xBF, 0x30, 0x59, 0x2E, 0x39, 0xC3, 0x98, 0x79, 0xF4, 0x36, 0x1F,
-    0xFE, 0x6B, 0x21, 0x95, 0x4D, 0xCE, 0xBE, 0xD0, 0x95, 0x0A, 0x46, 0x37, 0x74, 0x2A, 0x75, 0x71,
-    0xFD, 0xA9, 0x9E, 0xC6, 0x69, 0x84, 0x00, 0x01, 0x46, 0x82, 0xE1, 0xC2, 0x22, 0x50, 0xCD, 0x27,
-    0xED, 0x2F, 0x04, 0x36, 0x16, 0xA0, 0xA1, 0x52, 0xD3, 0x0D, 0xEB, 0x44, 0x8B, 0xD8, 0x98, 0x64,
-    0x53, 0x89, 0x74, 0xC4, 0x4A, 0x4F, 0xF3, 0x9C, 0xAE, 0x7B, 0xCF, 0x57, 0xF1, 0x9D, 0xEF, 0xE2,
-    0x46, 0x16, 0x86, 0xD7, 0xB6, 0x07, 0xED, 0x9F, 0x94, 0x1C, 0x7E, 0x95, 0xAD, 0x30, 0x39, 0x5C,
-    0x88, 0x11, 0x75, 0x1D, 0xA5, 0x9B, 0xCF, 0x49, 0x0E, 0x77, 0x5E, 0xD3, 0x39, 0x9C, 0xF3, 0x50,
-    0x6B, 0x28, 0x9D, 0xA2, 0x97, 0x05, 0x8D, 0x0F, 0x18, 0x8D, 0x87, 0x1C, 0x6E, 0x96, 0x46, 0x63,
-    0x9D, 0xBE, 0x38, 0xD9, 0xDB, 0x56, 0x27, 0x0D, 0x42, 0x65, 0x0B, 0xD1, 0xF6, 0x64, 0xE6, 0x86,
-    0x09, 0xE5, 0xEE, 0xE8, 0xF6, 0xD8, 0x2D, 0xE8, 0x2A, 0xD4, 0xDD, 0xC4, 0x38, 0x8F, 0xD1, 0xC3,
-    0xA0, 0x66, 0x8C, 0x6E, 0x27, 0x4E, 0x55, 0x25, 0x8F, 0x1C, 0x9B, 0x0D, 0x0F, 0xC3, 0x67, 0x53,
-    0x83, 0x4F, 0x77, 0x30, 0x5D, 0x55, 0x35, 0x26, 0x0A, 0x95, 0xCB, 0xF5, 0x3B, 0x29, 0xA9, 0x48,
-    0x0E, 0x6C, 0xF0, 0xD3, 0x08, 0x6A, 0x88, 0x25, 0xE9, 0x16, 0x46, 0x1F, 0x23, 0xAE, 0xAA, 0xB4,
-    0xBF, 0xB3, 0xA3, 0xFA, 0x06, 0x8D, 0x88, 0xB4, 0x8A, 0xE0, 0x7F, 0xCA, 0x1D, 0xA1, 0x2E, 0x0F,
-    0x80, 0x87, 0x55, 0xDB, 0xA0, 0x34, 0x7D, 0xAA, 0xAB, 0xCF, 0x0A, 0x88, 0x77, 0x88, 0xC5, 0x59,
-    0xDF, 0xD0, 0x2B, 0x6C, 0x63, 0xB9, 0xEC, 0x54, 0x0F, 0x6A, 0xC9, 0xC6, 0xA6, 0xFF, 0x39, 0x30,
-    0xFD, 0x4F, 0xC6, 0x7E, 0xD2, 0xF4, 0x3F, 0x0B, 0xB1, 0x95, 0x1D, 0xB7, 0x4A, 0x32, 0xEB, 0xFE,
-    0x28, 0xB5, 0x93, 0x41, 0x62, 0x4A, 0x6D, 0x3B, 0xF6, 0x6C, 0x73, 0x82, 0x71, 0xC9, 0x1F, 0x3C,
-    0xA0, 0x2F, 0xB9, 0xEC, 0xEE, 0xDB, 0x8B, 0xB3, 0x43, 0x27, 0xA4, 0x4B, 0x64, 0xEF, 0x0F, 0xC9,
-    0x1F, 0x26, 0x14, 0x22, 0x91, 0xBD, 0x0B, 0x96, 0xB0, 0xAF, 0x4B, 0x63, 0x4B, 0x3E, 0x78, 0x53,
-    0x8A, 0x6E, 0xF8, 0x1A, 0x7A, 0xD5, 0xBA, 0x1B, 0xBB, 0xDA, 0x30, 0xA1, 0x45, 0xD8, 0x75, 0xD6,
-    0xE4, 0x13, 0xEF, 0xD5, 0x7D, 0xB2, 0xAE, 0x23, 0xA3, 0x2D, 0xC1, 0xAE, 0x2B, 0x02, 0x24, 0x74,
-    0x41, 0x9E, 0xB1, 0xDE, 0xAC, 0x7B, 0xAA, 0x60, 0xD6, 0x53, 0x05, 0xD0, 0x0D, 0x3D, 0x95, 0x53,
-    0xF8, 0xA9, 0x97, 0x4A, 0x67, 0x55, 0xF8, 0x98, 0x3D, 0xE0, 0x51, 0x55, 0x45, 0xF0, 0x93, 0x9D,
-    0x6D, 0xA4, 0x2B, 0xF2, 0x13, 0xDD, 0xB2, 0x63, 0x1A, 0x5C, 0x6B, 0x65, 0xD6, 0xF4, 0x4E, 0x4A,
-    0xE1, 0x54, 0xC7, 0x29, 0x3A, 0x32, 0x24, 0x1E, 0xEE, 0x18, 0xBE, 0x4D, 0xF6, 0x8F, 0xF3, 0x25,
-    0xAE, 0xD9, 0x7C, 0x5F, 0x04, 0x7D, 0xDE, 0x50, 0x14, 0xFF, 0xB6, 0x95, 0xB5, 0xA3, 0x17, 0xD0,
-    0x05, 0xC5, 0x7F, 0x48, 0xE8, 0x2F, 0xB8, 0x6D, 0x82, 0x16, 0xC9, 0x46, 0x41, 0xF5, 0x97, 0xB3,
-    0x86, 0xB3, 0xCE, 0xA6, 0xD4, 0x9D, 0x0D, 0x2B, 0x18, 0xA7, 0xED, 0xD8, 0xC9, 0xC4, 0xDC, 0xE3,
-    0xFC, 0x84, 0x98, 0xBE, 0x84, 0x2B, 0x0F, 0x3C, 0x55, 0xFB, 0xCA, 0x52, 0x73, 0x7F, 0xDD, 0x95,
-    0x0C, 0xE0, 0xB7, 0x8F, 0x75, 0x25, 0x6D, 0xD5, 0x85, 0x95, 0x1B, 0x14, 0x4E, 0xA4, 0x28, 0x5C,
-    0xE4, 0x92, 0x80, 0x6A, 0xA0, 0x0B, 0x02, 0xCA, 0xE5, 0xEE, 0x84, 0x60, 0xB5, 0xF3, 0x39, 0xFF,
-    0x82, 0x23, 0x02, 0x14, 0x5E, 0x49, 0x1B, 0x03, 0xEA, 0xF9, 0x5C, 0x4B, 0x41, 0x0F, 0x50, 0xF9,
-    0x49, 0xA6, 0x7D, 0x05, 0xB7, 0x93, 0xCB, 0xEC, 0x67, 0xFF, 0x0D, 0xE9, 0xF4, 0x04, 0x74, 0x20,
-    0xFD, 0x3F, 0xD5, 0x20, 0xC1, 0xD5, 0xC9, 0xCD, 0x0C, 0xA4, 0xBB, 0x0C, 0x7C, 0x1E, 0xCE, 0xFE,
-    0xFD, 0x1F, 0xB4, 0x32, 0xD3, 0x3E, 0x31, 0xCF, 0x8B, 0x15, 0x16, 0x73, 0xF0, 0xD3, 0x09, 0x1F,
-    0xE7, 0xCD, 0x18, 0xAC, 0x00, 0x13, 0x9E, 0x3C, 0x64, 0x9A, 0x03, 0x42, 0x61, 0x0F, 0xB1, 0x34,
-    0x56, 0xC9, 0x62, 0x1C, 0x3F, 0x45, 0xD4, 0x67, 0xED, 0x32, 0x54, 0x92, 0x9D, 0x20, 0x30, 0x8B,
-    0x97, 0xCA, 0x7C, 0x34, 0xDD, 0x99, 0x20, 0x77, 0xF1, 0x3D, 0xE6, 0xE8, 0xDA, 0x5D, 0x16, 0x13,
-    0x16, 0x87, 0x35, 0xD9, 0xDD, 0xBD, 0x07, 0x57, 0x99, 0xF2, 0xCD, 0x93, 0x10, 0xBE, 0x15, 0x41,
-    0x83, 0x2D, 0xCC, 0xD4, 0x87, 0x0D, 0x7B, 0x73, 0x83, 0x8F, 0xE1, 0x5C, 0x11, 0xE2, 0xBC, 0x9F,
-    0xC0, 0x59, 0xEE, 0xC5, 0x8A, 0xAA, 0x3A, 0x24, 0x48, 0xE7, 0xBE, 0x20, 0xD5, 0xEF, 0x72, 0xEC,
-    0x17, 0xCC, 0xFC, 0x1E, 0x30, 0x69, 0x70, 0x84, 0x0A, 0xA6, 0x86, 0x27, 0x21, 0x05, 0xE2, 0xF5,
-    0x2D, 0x3A, 0x16, 0x18, 0x42, 0xF8, 0xD6, 0xAF, 0xA0, 0xB5, 0x62, 0xE6, 0xFF, 0x4B, 0x1D, 0x50,
-    0xDC, 0x1F, 0xAD, 0x18, 0x6D, 0x16, 0x81, 0x86, 0x4E, 0x7D, 0xD0, 0x80, 0xE8, 0x8A, 0xCF, 0x9C,
-    0x19, 0x65, 0xCD, 0xF9, 0x88, 0xCB, 0x83, 0x95, 0xB3, 0x16, 0x2F, 0x1F, 0x93, 0x03, 0x70, 0xA5,
-    0x43, 0x72, 0xB9, 0x96, 0x52, 0xF4, 0x31, 0x8C, 0x1F, 0x92, 0x9D, 0x9D, 0x9F, 0xA5, 0x8C, 0x05,
-    0x58, 0xBE, 0xA2, 0x9A, 0x1D, 0x8B, 0x82, 0x6F, 0xF6, 0x0D, 0x4E, 0x5E, 0x33, 0xCB, 0x7B, 0xC7,
-    0x63, 0xF9, 0x59, 0xC3, 0xD1, 0xDD, 0xCB, 0x39, 0x48, 0x05, 0x34, 0xBD, 0x78, 0xC9, 0x24, 0xED,
-    0x5A, 0x9B, 0x23, 0x2E, 0xF0, 0x48, 0xC8, 0x4E, 0xEE, 0xA5, 0xD6, 0x10, 0xB3, 0x95, 0x28, 0xE6,
-    0x63, 0x14, 0xF5, 0xBB, 0x68, 0x07, 0x9A, 0xC1, 0xC7, 0x70, 0x6E, 0x8C, 0x75, 0x2D, 0x9D, 0x1C,
-    0x25, 0xFE, 0x08, 0xAD, 0x48, 0x54, 0x17, 0x78, 0x1D, 0x50, 0x3F, 0x93, 0x44, 0xCD, 0x58, 0x5F,
-    0xE0, 0x85, 0x5F, 0xEF, 0xC6, 0xC2, 0x33, 0x00, 0x58, 0x95, 0x35, 0x3E, 0x02, 0xEE, 0xF1, 0x9E,
-    0xA2, 0xE8, 0x4F, 0xAD, 0x38, 0x00, 0x59, 0xEA, 0xEB, 0xB0, 0xF6, 0x08, 0x0C, 0xFE, 0xA5, 0x18,
-    0xA9, 0x6E, 0x5D, 0x3C, 0xE2, 0x8A, 0x34, 0x8E, 0xD4, 0x05, 0x2C, 0x6E, 0xAD, 0xA0, 0xA1, 0xFF,
-    0x39, 0x39, 0xEF, 0x99, 0x1D, 0x50, 0x26, 0x6D, 0x51, 0xDE, 0x0E, 0x16, 0x1A, 0xFC, 0xA9, 0xEC,
-    0x21, 0x00, 0x06, 0xF7, 0x43, 0x4E, 0x8E, 0xDC, 0xD8, 0xCC, 0x36, 0x3F, 0x3B, 0x52, 0x02, 0x4E,
-    0x28, 0xED, 0x20, 0x11, 0x94, 0x1B, 0x96, 0x40, 0xE2, 0xC2, 0x82, 0xBD, 0xE2, 0x29, 0xE5, 0xC1,
-    0xEC, 0x6F, 0x32, 0x5B, 0xD6, 0xCB, 0x50, 0xF7, 0xEC, 0xEF, 0x18, 0x3D, 0x35, 0x5B, 0xC4, 0xE5,
-    0x2F, 0x56, 0x19, 0x5A, 0x41, 0xA0, 0xE4, 0x64, 0x6C, 0xD6, 0xE5, 0x94, 0x71, 0xFA, 0x48, 0x36,
-    0x07, 0x4A, 0x12, 0xA4, 0x48, 0xA0, 0x22, 0x41, 0x43, 0xE4, 0x98, 0xE2, 0xFF, 0x20, 0x9B, 0x6B,
-    0xEC, 0x92, 0x04, 0x33, 0x99, 0xA7, 0x20, 0x41, 0x4D, 0x2F, 0x03, 0x69, 0xDC, 0x0C, 0x70, 0x06,
-    0x39, 0xD9, 0xCD, 0xFE, 0x35, 0x99, 0x4D, 0x3C, 0xD9, 0x7A, 0x74, 0x35, 0xE9, 0x63, 0x83, 0xD8,
-    0xB2, 0xDD, 0x7B, 0x80, 0x7D, 0x34, 0x75, 0x60, 0xBC, 0x7F, 0x1D, 0x09, 0xC7, 0x65, 0x85, 0x40,
-    0x26, 0x18, 0x19, 0x62, 0xB8, 0x68, 0xEF, 0x51, 0x21, 0x27, 0x18, 0x33, 0x62, 0xD0, 0x88, 0x51,
-    0x23, 0x81, 0x4D, 0x70, 0xD3, 0x20, 0x9D, 0x50, 0xCD, 0x2D, 0xF8, 0x1A, 0x7E, 0x0D, 0x69, 0xF6,
-    0xEC, 0xB2, 0xD7, 0x29, 0x94, 0x64, 0x45, 0x2D, 0xEE, 0x74, 0x61, 0x20, 0x9F, 0x92, 0x64, 0x98,
-    0xB0, 0x21, 0xAA, 0x55, 0x94, 0x84, 0x6A, 0x68, 0xAE, 0x61, 0xC8, 0x86, 0x66, 0x1B, 0x9A, 0x6E,
-    0x68, 0xBE, 0x01, 0xC2, 0xD1, 0x29, 0x8F, 0x62, 0x22, 0x22, 0x4C, 0x44, 0x53, 0x11, 0xE6, 0x22,
-    0x42, 0x46, 0xC0, 0x46, 0xB8, 0x92, 0xB6, 0xEB, 0x56, 0x1A, 0x89, 0xB0, 0xE0, 0xD2, 0xF8, 0x9D,
-    0x29, 0xEF, 0xA0, 0x7F, 0x10, 0x8A, 0x6A, 0x56, 0xB7, 0x40, 0x62, 0x87, 0x72, 0xA6, 0x8E, 0x22,
-    0xEF, 0xCE, 0x03, 0xA2, 0x55, 0x67, 0xC2, 0xDA, 0xAF, 0xB5, 0x0A, 0x4D, 0xE7, 0x32, 0xCF, 0x5C,
-    0xD6, 0xD6, 0x69, 0x5B, 0xE7, 0xED, 0xBA, 0x86, 0xB4, 0x9F, 0x83, 0x1E, 0xB9, 0x83, 0xF9, 0xC4,
-    0xC7, 0xD0, 0xDA, 0x84, 0x95, 0x0A, 0xA6, 0xEA, 0xF4, 0x11, 0xAB, 0x4F, 0xBA, 0x69, 0xCA, 0x17,
-    0x26, 0x81, 0x2B, 0xA8, 0x82, 0xC5, 0xF5, 0x88, 0xCB, 0x28, 0xD3, 0xE9, 0xE8, 0xCF, 0xFC, 0x3C,
-    0xD1, 0x13, 0xDD, 0xCC, 0x03, 0x46, 0x5D, 0xA6, 0xA2, 0x27, 0x64, 0x4F, 0x3A, 0xB5, 0xE7, 0x6E,
-    0xC1, 0xCB, 0xBD, 0x09, 0xCF, 0x78, 0xC8, 0x62, 0xEF, 0x33, 0x8A, 0x43, 0x06, 0x67, 0x82, 0x9B,
-    0xDB, 0x80, 0xBC, 0xBA, 0x83, 0x55, 0x8E, 0xC6, 0xA8, 0x8E, 0x96, 0x6A, 0x16, 0xA4, 0x6C, 0x72,
-    0x5D, 0xD9, 0xAC, 0xC6, 0x2B, 0x52, 0xC6, 0x2A, 0xDE, 0xE6, 0xA6, 0xE4, 0x60, 0x96, 0xAD, 0xFD,
-    0x7C, 0xF6, 0x10, 0x6F, 0xB5, 0x99, 0xA1, 0x13, 0xF8, 0xB1, 0x7D, 0x88, 0x2E, 0x6E, 0xEF, 0x5D,
-    0xD6, 0xDE, 0x57, 0x86, 0xB3, 0x90, 0x58, 0x71, 0xA3, 0xE9, 0x79, 0xDB, 0x41, 0xF2, 0x07, 0xA2,
-    0xC3, 0x70, 0x56, 0xDE, 0x34, 0x13, 0x78, 0xA9, 0xC6, 0x48, 0x38, 0x82, 0x53, 0x30, 0x54, 0x9F,
-    0x0C, 0x19, 0xAA, 0x7C, 0xC8, 0x50, 0xE5, 0x05, 0x9B, 0xF8, 0x71, 0xC6, 0x72, 0xBA, 0x34, 0x57,
-    0x9B, 0x2F, 0xC6, 0xA1, 0x1C, 0x91, 0xCC, 0x0D, 0xA4, 0x7A, 0xD2, 0x04, 0x44, 0xE6, 0xF9, 0x03,
-    0x83, 0x15, 0x0A, 0x5A, 0xAB, 0x82, 0xC0, 0x26, 0xCB, 0x38, 0xD7, 0x31, 0xA8, 0x81, 0xF9, 0xEF,
-    0xF2, 0x90, 0x34, 0x70, 0x06, 0x39, 0x0D, 0x9D, 0xC6, 0xCE, 0x80, 0xA7, 0xA5, 0x53, 0x34, 0xEE,
-    0x58, 0xB3, 0x02, 0xBF, 0x4E, 0x0C, 0x5D, 0x42, 0x6F, 0x7D, 0x2E, 0x36, 0xF5, 0x22, 0xEB, 0x12,
-    0x6D, 0xD0, 0x5B, 0x5B, 0x36, 0x7A, 0x9F, 0x35, 0x58, 0xBB, 0x84, 0xA1, 0x98, 0xA2, 0xA3, 0xD5,
-    0x84, 0xAB, 0x8E, 0x57, 0x1D, 0xB0, 0x06, 0xC9, 0x1B, 0x4B, 0x47, 0x52, 0xFF, 0x50, 0x61, 0xC2,
-    0x6D, 0xEF, 0xEA, 0xE0, 0xEF, 0x90, 0x5F, 0xF3, 0xC6, 0xE6, 0x44, 0x97, 0xD0, 0xD3, 0xCF, 0xFD,
-    0xA2, 0xFC, 0x9B, 0x90, 0x0F, 0xA7, 0xBC, 0xEE, 0x59, 0x9C, 0xF6, 0xE4, 0xC4, 0xB2, 0x11, 0xEB,
-    0x5A, 0x66, 0x7B, 0x56, 0x11, 0x7D, 0xFC, 0xFC, 0x52, 0x51, 0xAA, 0x33, 0x9B, 0xAE, 0xB4, 0x26,
-    0xCB, 0xAD, 0x35, 0xC9, 0x58, 0xBA, 0x47, 0xBB, 0xA8, 0xF9, 0x33, 0x5D, 0x98, 0x7F, 0x1C, 0x1C,
-    0x55, 0xC9, 0x60, 0x12, 0x4C, 0xD4, 0x9B, 0x25, 0xD8, 0x9A, 0x93, 0x61, 0x0A, 0x84, 0xCC, 0x84,
-    0x23, 0x3B, 0xA2, 0x0D, 0xDE, 0xD2, 0xDE, 0xE4, 0x64, 0xFE, 0x0E, 0x3F, 0x9B, 0xE1, 0xAD, 0xF7,
-    0x7F, 0x72, 0x63, 0xFA, 0x30, 0xA9, 0x7F, 0x3B, 0xD1, 0x7F, 0xA6, 0x88, 0x65, 0x4B, 0x63, 0x9F,
-    0xA9, 0x5A, 0x69, 0xAA, 0x58, 0xBF, 0x29, 0x0B, 0x9E, 0x30, 0xA4, 0x6C, 0x8E, 0xA4, 0xD1, 0xED,
-    0x5B, 0x2B, 0xB7, 0xD5, 0xA0, 0x5C, 0xA9, 0x14, 0x08, 0xE5, 0x5D, 0xD6, 0xFB, 0x80, 0x0B, 0x1E,
-    0x6F, 0x14, 0xCB, 0xF2, 0xF0, 0x36, 0xFA, 0x98, 0x13, 0xE2, 0x9E, 0x0B, 0xBB, 0xB6, 0x78, 0x47,
-    0x32, 0xE4, 0x14, 0xE4, 0xFF, 0x88, 0xC5, 0xDF, 0x38, 0xBE, 0xD8, 0x76, 0xF6, 0x10, 0x6D, 0xAF,
-    0x74, 0xA0, 0x92, 0x41, 0x65, 0xBF, 0x4D, 0xD2, 0x00, 0xF7, 0xCF, 0xA7, 0x19, 0xA8, 0x68, 0x7F,
-    0xA9, 0xE6, 0x3F, 0xFE, 0x08, 0x3E, 0x6E, 0xAE, 0xEB, 0xB5, 0x6B, 0xF9, 0x6F, 0x70, 0xC6, 0x7F,
-    0x15, 0x16, 0x6F, 0xC1, 0xC1, 0x61, 0xF9, 0x9A, 0xB6, 0x1C, 0x37, 0xE5, 0x4B, 0x78, 0xE7, 0xDD,
-    0xD6, 0x57, 0x67, 0xF5, 0x6F, 0x7E, 0x37, 0x67, 0xFD, 0xE0, 0x32, 0x11, 0xF2, 0xD8, 0x84, 0x0D,
-    0xDE, 0x3E, 0xE8, 0xF9, 0xF5, 0x6F, 0x26, 0x6C, 0xD9, 0x48, 0x10, 0x57, 0x49, 0x8F, 0xCF, 0x4B,
-    0x74, 0xAC, 0x79, 0x63, 0x54, 0xBA, 0x8D, 0xC1, 0xFB, 0x44, 0x67, 0x45, 0xD5, 0x7A, 0x6B, 0x74,
-    0x79, 0x08, 0x49, 0x72, 0x8E, 0xB3, 0xB7, 0x89, 0xEE, 0x4F, 0x61, 0x6A, 0xCA, 0x0F, 0xEF, 0xEA,
-    0x5F, 0x6A, 0x1C, 0x07, 0x2E, 0xFF, 0x06, 0x9D, 0x18, 0x4B, 0x6C, 0xDC, 0xC6, 0xF5, 0x91, 0x94,
-    0x34, 0xB1, 0x58, 0x99, 0x3E, 0xA8, 0x45, 0xEA, 0x48, 0xE2, 0x25, 0x07, 0x5B, 0x58, 0x89, 0x09,
-    0x20, 0x14, 0x7B, 0xD8, 0x15, 0xC7, 0xF5, 0xA1, 0x40, 0x83, 0xB6, 0x39, 0xD4, 0xBD, 0xA4, 0x40,
-    0xAF, 0x8E, 0x51, 0x20, 0x3A, 0xA8, 0x80, 0x0A, 0xAC, 0xC5, 0x71, 0x7D, 0xF0, 0xA1, 0x28, 0xB0,
-    0xA7, 0x9E, 0x0A, 0x54, 0x05, 0x72, 0xB0, 0xB7, 0x45, 0xA2, 0x83, 0x80, 0x0A, 0xE9, 0x4A, 0x1C,
-    0xC5, 0x87, 0xDC, 0x02, 0xA6, 0x40, 0x7A, 0x66, 0x0B, 0x9F, 0x62, 0xA0, 0x99, 0x16, 0x7B, 0xA0,
-    0x1C, 0xEE, 0x4E, 0xDF, 0x1B, 0x92, 0xBB, 0x54, 0x2C, 0xC7, 0xAB, 0xCE, 0x8F, 0xC3, 0x79, 0x9F,
-    0x99, 0xF7, 0xE6, 0x7D, 0xB8, 0x0B, 0x7B, 0xE7, 0x16, 0x80, 0x37, 0xBE, 0xB5, 0xB4, 0xC1, 0x12,
-    0x96, 0xF8, 0x83, 0xEF, 0xFD, 0xC1, 0x16, 0x2F, 0xAF, 0x00, 0x96, 0x80, 0xF4, 0xCE, 0xE1, 0x47,
-    0x87, 0x7B, 0xE9, 0x9F, 0xC4, 0x1E, 0xBC, 0xBC, 0x02, 0xD8, 0xDC, 0x85, 0xF5, 0x47, 0xEB, 0x1F,
-    0xB8, 0xF3, 0xF6, 0x0F, 0x61, 0x7E, 0x8A, 0x0A, 0x10, 0x69, 0x8E, 0x0D, 0x4C, 0x19, 0xCF, 0xEF,
-    0xF4, 0x7A, 0x7B, 0x5A, 0x6B, 0x45, 0x8B, 0xAB, 0xBD, 0x5E, 0x2F, 0xD4, 0x7A, 0x54, 0xCD, 0xB1,
-    0xEC, 0xE1, 0x3B, 0x95, 0x01, 0x94, 0xE5, 0x45, 0xEB, 0x00, 0x6A, 0xFF, 0xFF, 0xAD, 0xDF, 0xBE,
-    0x75, 0x8B, 0x23, 0x3F, 0x49, 0x4F, 0xE2, 0x44, 0x73, 0xEA, 0xD0, 0x65, 0x62, 0x19, 0x9A, 0xD0,
-    0x82, 0x88, 0x47, 0x32, 0x14, 0xB3, 0xE0, 0x0A, 0x3F, 0xF1, 0x53, 0x96, 0x5A, 0x89, 0x2D, 0x5D,
-    0xDE, 0x42, 0xDC, 0x79, 0x3E, 0x59, 0x61, 0xBC, 0x0D, 0x57, 0x60, 0x05, 0x42, 0x11, 0x89, 0x5D,
-    0xA4, 0x6B, 0x80, 0x07, 0x76, 0x82, 0x48, 0xDD, 0x57, 0x98, 0x38, 0x5C, 0xB6, 0x64, 0xD3, 0x11,
-    0x2D, 0x26, 0xA2, 0xB7, 0x54, 0xF4, 0x49, 0x16, 0xDE, 0x1F, 0xCC, 0x02, 0x77, 0xC5, 0x81, 0xFF,
-    0xF7, 0xDC, 0xFF, 0xD7, 0x90, 0xA5, 0x47, 0x56, 0xD2, 0xB0, 0x65, 0xCB, 0xE5, 0xFB, 0x88, 0x63,
-    0x38, 0xBF, 0x7F, 0x16, 0xD4, 0x60, 0x7C, 0xBF, 0xED, 0xC8, 0x2B, 0x00, 0x2B, 0x56, 0x1A, 0x3E,
-    0xC8, 0xA2, 0xDF, 0x0E, 0x76, 0x59, 0xD2, 0x64, 0xA2, 0xE1, 0x08, 0x0F, 0x52, 0x3B, 0x69, 0x94,
-    0x9A, 0xC8, 0x01, 0xFA, 0x00, 0x87, 0x00, 0x3B, 0x00, 0xDB, 0x00, 0x1B, 0x70, 0xFA, 0xAB, 0xBE,
-    0xD6, 0xF9, 0xDB, 0xDB, 0x8B, 0xB4, 0x98, 0xD7, 0x5A, 0x1D, 0x6D, 0xBB, 0x44, 0x86, 0x37, 0x6A,
-    0x6D, 0xCC, 0xB0, 0x42, 0xE3, 0x1B, 0x33, 0xC8, 0xEA, 0xF4, 0xD7, 0x7D, 0x7A, 0x2D, 0x98, 0x6C,
-    0xD7, 0xF0, 0xB7, 0xAB, 0xC5, 0x1D, 0xDC, 0xF4, 0x2F, 0xB4, 0xE9, 0xC6, 0x22, 0x2D, 0xEE, 0x18,
-    0x0E, 0x7D, 0x62, 0x36, 0xD7, 0x85, 0x20, 0x47, 0x1D, 0xA3, 0x0D, 0x40, 0x6C, 0x1A, 0x4E, 0xC2,
-    0x21, 0xB8, 0x4F, 0xA0, 0x0B, 0x30, 0x04, 0xD0, 0x09, 0xE8, 0x21, 0x68, 0x2D, 0x68, 0x4C, 0x68,
-    0x25, 0x31, 0xA7, 0x98, 0x81, 0x10, 0x42, 0x1E, 0xF2, 0x4B, 0x38, 0x9B, 0xC5, 0x59, 0x20, 0xF0,
-    0x4D, 0xD2, 0xF3, 0x12, 0xDA, 0xD7, 0x75, 0xB8, 0x8A, 0x35, 0x26, 0x0C, 0x11, 0xE3, 0x85, 0x85,
-    0x78, 0x05, 0x21, 0x04, 0xA5, 0xBD, 0x5D, 0x35, 0x94, 0x21, 0x19, 0xDC, 0xC3, 0x8F, 0x1E, 0x4E,
-    0x63, 0xE2, 0x54, 0x57, 0x1F, 0xAD, 0x7E, 0x30, 0x95, 0x71, 0x1B, 0x03, 0x8F, 0x86, 0x93, 0x3A,
-    0x9D, 0xDB, 0x45, 0xC3, 0x2D, 0x28, 0xEA, 0xF4, 0x14, 0xB0, 0x50, 0xD4, 0x69, 0x29, 0xCA, 0xC2,
-    0xD0, 0xAB, 0x8C, 0x93, 0xF9, 0x3F, 0x11, 0x56, 0x4A, 0x13, 0x34, 0x25, 0x47, 0xD2, 0xA4, 0xE3,
-    0xA4, 0xC6, 0xE0, 0xA0, 0xEF, 0xA4, 0x1E, 0x14, 0x13, 0xB5, 0x52, 0x4D, 0x5A, 0xD5, 0x64, 0x07,
-    0x4A, 0x64, 0x75, 0x95, 0xC3, 0x2A, 0x6F, 0x39, 0x9F, 0xA5, 0xCF, 0x94, 0xFD, 0x55, 0xBA, 0xC9,
-    0x1E, 0x3F, 0x4E, 0x3B, 0x4C, 0x0E, 0xBC, 0x3F, 0xFE, 0xE0, 0x81, 0x6C, 0xBB, 0xA2, 0x6F, 0x67,
-    0x9E, 0x2B, 0x37, 0x3D, 0xD1, 0x41, 0x4B, 0x75, 0x65, 0xE8, 0xF1, 0xBB, 0x00, 0xAD, 0x6A, 0xB2,
-    0x53, 0x4D, 0x14, 0xE1, 0xF0, 0x0E, 0x58, 0x29, 0x23, 0xE4, 0x3E, 0xE0, 0x79, 0x92, 0x8E, 0x2B,
-    0x0F, 0x81, 0x09, 0x5B, 0x1D, 0x3A, 0x9F, 0x29, 0x74, 0x1F, 0x88, 0x53, 0xB2, 0x01, 0x2C, 0xB3,
-    0x64, 0x00, 0xF5, 0x32, 0x96, 0xA8, 0x2E, 0x54, 0x5D, 0xAE, 0xBA, 0x68, 0x75, 0xE9, 0xEA, 0x02,
-    0xD6, 0x65, 0xAC, 0x8B, 0x59, 0x97, 0x14, 0xDE, 0x85, 0xB1, 0xB0, 0xCE, 0x53, 0x39, 0x91, 0xF7,
-    0x9E, 0x1A, 0x8B, 0xEC, 0xF1, 0xC1, 0x58, 0x6A, 0x1F, 0xB2, 0xB1, 0xE0, 0x01, 0xF9, 0x42, 0xAB,
-    0x36, 0xDF, 0xA9, 0xCD, 0x4B, 0x0D, 0x04, 0x88, 0x4F, 0x4A, 0x68, 0xA3, 0x12, 0x88, 0xB6, 0xD2,
-    0x83, 0xC7, 0xD5, 0x58, 0x15, 0xEE, 0xC7, 0xE9, 0x58, 0x1B, 0xB6, 0x16, 0x13, 0x85, 0x2C, 0x82,
-    0x27, 0x7C, 0x1E, 0x40, 0x1B, 0xA3, 0x54, 0x13, 0x0D, 0x09, 0xC0, 0xFB, 0x8D, 0xF2, 0x6F, 0xAA,
-    0xC0, 0x49, 0xDA, 0x4C, 0x62, 0x24, 0x69, 0xBA, 0xB0, 0x75, 0x19, 0x8A, 0xF5, 0x4D, 0x04, 0xDC,
-    0x45, 0x48, 0x1F, 0x41, 0x03, 0x84, 0x29, 0x04, 0xA6, 0x5B, 0x97, 0x2D, 0xA3, 0xAE, 0x4D, 0x74,
-    0x17, 0x1F, 0x3C, 0xEE, 0x72, 0x47, 0xD8, 0xB8, 0xB2, 0x89, 0x27, 0xC5, 0x1C, 0x82, 0x5A, 0xBB,
-    0xA1, 0x5C, 0xAE, 0x1C, 0xB1, 0x6F, 0xCB, 0x0D, 0x30, 0xEB, 0x19, 0x02, 0x72, 0x84, 0x74, 0x10,
-    0x84, 0x01, 0x4B, 0xAD, 0x21, 0xF0, 0x32, 0x42, 0xDD, 0x4A, 0x77, 0x29, 0x58, 0x0A, 0x9C, 0x0C,
-    0xD8, 0x2F, 0xC1, 0xBB, 0x0C, 0xCB, 0x1E, 0xE0, 0x66, 0x3B, 0x78, 0x2B, 0x18, 0x0B, 0x2C, 0xE5,
-    0x24, 0x9E, 0x08, 0x69, 0x33, 0xC1, 0xA4, 0x9D, 0xC2, 0x3E, 0xBC, 0x7E, 0xC5, 0x84, 0x4A, 0x57,
-    0x3A, 0xCA, 0xCA, 0xAC, 0xDC, 0x51, 0x4C, 0x7A, 0x7C, 0x19, 0x5E, 0x47, 0x46, 0x74, 0xF2, 0x25,
-    0x08, 0x04, 0xC3, 0xA3, 0x05, 0x28, 0x28, 0x93, 0xF3, 0x70, 0x97, 0x98, 0x5B, 0x18, 0xF9, 0x3B,
-    0xE0, 0xA0, 0x69, 0xF8, 0xA4, 0x18, 0x40, 0x59, 0x71, 0xB4, 0x14, 0x5A, 0x44, 0x08, 0x91, 0xF4,
-    0x24, 0xF9, 0x3E, 0x8D, 0x34, 0x9F, 0xB1, 0xFE, 0xA3, 0x2C, 0xC2, 0xE9, 0x90, 0xAD, 0x60, 0x25,
-    0x5A, 0x26, 0x0D, 0x1F, 0xD4, 0x71, 0x32, 0x8B, 0xAF, 0xA8, 0x44, 0xEE, 0xC3, 0x32, 0xED, 0xC5,
-    0xC1, 0xA0, 0x1C, 0x39, 0x6A, 0xE8, 0xA8, 0xA3, 0xAA, 0xA1, 0x6D, 0x74, 0xA8, 0xA5, 0x1D, 0x9B,
-    0x5A, 0x8B, 0x5A, 0xD2, 0xB2, 0x92, 0xA6, 0x69, 0x85, 0xDC, 0xB7, 0xED, 0xEE, 0x88, 0xA9, 0x11,
-    0x1B, 0x20, 0x7E, 0x65, 0xA6, 0x3A, 0x85, 0xF0, 0xF3, 0x21, 0x1C, 0xE3, 0x79, 0xFA, 0xE0, 0xC9,
-    0x4E, 0xE8, 0x49, 0x08, 0xDD, 0x04, 0x36, 0xF1, 0x69, 0x3A, 0xC6, 0xA8, 0xF5, 0x23, 0x80, 0x00,
-    0x29, 0x28, 0x5C, 0xAD, 0x21, 0x51, 0xC3, 0x88, 0x3D, 0x29, 0xD7, 0x29, 0x65, 0x96, 0x3D, 0x2C,
-    0x96, 0x30, 0x41, 0x0D, 0xC2, 0x71, 0x02, 0xDC, 0x37, 0x5A, 0x27, 0x52, 0x26, 0x90, 0x37, 0xEC,
-    0x82, 0xA5, 0x9F, 0x11, 0x70, 0x5E, 0x3F, 0x83, 0xB3, 0xE5, 0x35, 0x3D, 0xE2, 0x08, 0xFD, 0x22,
-    0x1E, 0x40, 0x81, 0xD9, 0x30, 0x54, 0x05, 0x87, 0x0A, 0x89, 0x6E, 0x92, 0xD4, 0x4A, 0x1C, 0x49,
-    0xB1, 0x07, 0x60, 0x9C, 0x8D, 0xB2, 0x19, 0x39, 0x97, 0xCB, 0x0B, 0x70, 0x40, 0x07, 0xC1, 0xF9,
-    0x5F, 0x71, 0xED, 0xBF, 0x09, 0x82, 0xF1, 0xD6, 0xE5, 0x01, 0x50, 0x6A, 0xF4, 0x90, 0x76, 0x0D,
-    0xC7, 0x16, 0xBE, 0x1D, 0xC0, 0xD8, 0x23, 0xA1, 0xCC, 0x02, 0x26, 0x25, 0x10, 0xD3, 0x0D, 0x93,
-    0xB5, 0x46, 0x6F, 0x0E, 0xE9, 0x11, 0xE8, 0x27, 0xF4, 0xB0, 0xCC, 0x27, 0x00, 0xBC, 0xF7, 0x37,
-    0x23, 0xDD, 0x70, 0xC3, 0xC0, 0xF6, 0xB6, 0x97, 0x6A, 0x74, 0x05, 0x17, 0xDC, 0x1F, 0x2D, 0x08,
-    0x53, 0x2E, 0x3A, 0x10, 0x34, 0x16, 0x5C, 0xE7, 0x5E, 0xB2, 0x1F, 0xFE, 0x2E, 0xBA, 0x39, 0xF8,
-    0x64, 0xE0, 0xEA, 0x53, 0x2B, 0xD6, 0x5D, 0x88, 0x04, 0xB0, 0x0C, 0x5E, 0x1B, 0x0D, 0xAD, 0xE3,
-    0x2F, 0xBB, 0xE1, 0x8F, 0x42, 0x82, 0x5D, 0x5B, 0x60, 0xF6, 0xBD, 0x64, 0xAB, 0xA4, 0x33, 0x5C,
-    0xD4, 0x24, 0x1D, 0x15, 0x0D, 0x05, 0x15, 0x13, 0x41, 0x5F, 0xA2, 0x87, 0x29, 0xC1, 0xA8, 0xAC,
-    0x21, 0x65, 0xA1, 0x73, 0x6A, 0x1E, 0xFE, 0xF4, 0xDC, 0xF5, 0x27, 0xAB, 0x8F, 0x30, 0x23, 0x66,
-    0x4E, 0x66, 0x9D, 0x53, 0xE3, 0xEC, 0x3B, 0xE7, 0xAE, 0xBF, 0x93, 0xF5, 0xDE, 0x2F, 0x95, 0x3D,
-    0x87, 0xE6, 0x17, 0x8C, 0xC0, 0xFF, 0xBC, 0x6F, 0x0D, 0xDF, 0x49, 0xD0, 0x29, 0x1C, 0x65, 0xAB,
-    0x4D, 0xF0, 0x6F, 0xA6, 0x30, 0x58, 0x06, 0xEF, 0x5E, 0x42, 0xC1, 0xCA, 0x43, 0x49, 0xF1, 0xE1,
-    0x0B, 0xB0, 0x32, 0x73, 0xA1, 0xF6, 0x80, 0x0C, 0x03, 0x18, 0xFA, 0x31, 0xC6, 0x29, 0x5F, 0x82,
-    0x9F, 0x9A, 0x4B, 0x59, 0x2F, 0xF4, 0x8D, 0x57, 0x46, 0x11, 0xE2, 0xEC, 0xE3, 0x6C, 0x41, 0x8B,
-    0xB5, 0x31, 0x9D, 0xC7, 0xA8, 0x04, 0x35, 0x7E, 0x14, 0x2C, 0xEB, 0x85, 0x8E, 0x97, 0xE3, 0xE1,
-    0x20, 0xC7, 0xA3, 0x41, 0x8E, 0x07, 0xE3, 0x39, 0x1E, 0x4B, 0xE4, 0x50, 0x0C, 0x3E, 0xE6, 0x05,
-    0x3C, 0x50, 0x9F, 0x68, 0x0F, 0xE9, 0x30, 0x87, 0x74, 0x94, 0x43, 0x3A, 0xC8, 0x0E, 0x6D, 0x6C,
-    0x86, 0xED, 0x62, 0x38, 0xB3, 0xF9, 0x6D, 0xDA, 0x73, 0x88, 0x83, 0x35, 0xA4, 0x6D, 0xF3, 0x09,
-    0xF0, 0x08, 0xE2, 0x0C, 0x86, 0xCE, 0xE9, 0x7B, 0xFC, 0xC8, 0xC5, 0x8F, 0xE4, 0x23, 0x0A, 0x3B,
-    0x47, 0x8E, 0x40, 0x07, 0xC7, 0x4B, 0x53, 0x9D, 0x72, 0x60, 0x29, 0x0E, 0x1E, 0x05, 0x8C, 0x08,
-    0xAF, 0xCE, 0xCE, 0x71, 0x60, 0x09, 0x0D, 0x1C, 0xC3, 0xAC, 0x53, 0x0E, 0x93, 0x72, 0x1B, 0xE6,
-    0x04, 0x8C, 0xC0, 0x4B, 0x70, 0xF0, 0x13, 0xDC, 0xC3, 0xAB, 0x69, 0x24, 0xEE, 0xC5, 0x32, 0xC2,
-    0xEF, 0x49, 0x5F, 0x7F, 0x25, 0xC9, 0xD5, 0x26, 0x86, 0x51, 0xF5, 0x95, 0x9A, 0x91, 0xB4, 0x4A,
-    0x1B, 0xDF, 0x99, 0xD8, 0x13, 0x75, 0x32, 0x54, 0xD2, 0xBD, 0x53, 0xDA, 0x56, 0x59, 0xE8, 0xDB,
-    0xD9, 0xFD, 0x87, 0xCE, 0x9D, 0x13, 0x3D, 0xC4, 0x3E, 0xC2, 0xAE, 0xCB, 0x3E, 0x2A, 0x3B, 0xC1,
-    0x06, 0xCE, 0xC9, 0xB3, 0xAE, 0x73, 0x92, 0xC0, 0x45, 0xBA, 0x7B, 0xA2, 0x40, 0x9F, 0xE8, 0x32,
-    0x8C, 0xE9, 0x3C, 0xD0, 0x1F, 0x3E, 0x89, 0x34, 0x13, 0xB1, 0x66, 0x5C, 0xD7, 0x3A, 0xBD, 0x87,
-    0x9A, 0xA1, 0x7C, 0x3A, 0xB3, 0x7A, 0xBD, 0x87, 0x31, 0x7E, 0xBB, 0xFD, 0xE2, 0xA9, 0x56, 0xE5,
-    0xDE, 0xCF, 0x75, 0x76, 0xA2, 0x33, 0xC4, 0x51, 0x77, 0x7A, 0x8F, 0x0A, 0x1D, 0xB6, 0x0B, 0xB1,
-    0x9B, 0x8D, 0x15, 0x88, 0x7F, 0x1E, 0x63, 0x84, 0x42, 0xF3, 0x8B, 0x39, 0x04, 0x5F, 0x9E, 0xC2,
-    0xF1, 0x52, 0x04, 0x1B, 0x8D, 0x4B, 0x85, 0x5A, 0xDA, 0x74, 0xB5, 0x31, 0xD6, 0x5D, 0x78, 0xDE,
-    0xDE, 0x62, 0xAE, 0xF1, 0xC2, 0x0F, 0xF0, 0x0B, 0x76, 0x99, 0x62, 0x3B, 0xAF, 0xA2, 0x5D, 0x82,
-    0x96, 0xFB, 0xB3, 0x21, 0xDD, 0x1E, 0x66, 0x4A, 0xD2, 0xA1, 0x71, 0x54, 0xFC, 0x8A, 0xC6, 0x6C,
-    0x74, 0x91, 0x42, 0x14, 0x78, 0xED, 0x68, 0x69, 0xEB, 0x94, 0x68, 0x5C, 0x89, 0x09, 0xCB, 0x3E,
-    0xBD, 0x75, 0x4C, 0x51, 0x2B, 0xAD, 0x71, 0xBB, 0x80, 0x30, 0x17, 0xC5, 0xF7, 0x6E, 0xC8, 0xE0,
-    0xBE, 0xF4, 0xEF, 0xF3, 0x39, 0xD7, 0xD8, 0xCD, 0xB2, 0x71, 0xBE, 0xA6, 0x31, 0xFE, 0x7D, 0x93,
-    0x75, 0x13, 0x72, 0x45, 0x0C, 0x5C, 0x68, 0xA6, 0x9E, 0xC9, 0x9E, 0x4B, 0x33, 0xD0, 0x0A, 0xA1,
-    0x19, 0xC2, 0xBE, 0xC9, 0x1B, 0x6E, 0x0A, 0xA9, 0x3F, 0xB4, 0x92, 0x96, 0xFF, 0x7D, 0xFC, 0x35,
-    0xF2, 0x54, 0x6E, 0x93, 0x9B, 0x7C, 0x2D, 0x37, 0xD8, 0xBA, 0xF7, 0x61, 0x66, 0x62, 0x42, 0x60,
-    0xE4, 0xB5, 0xE5, 0x9E, 0x89, 0xBF, 0x25, 0x0E, 0xF2, 0xB5, 0xBC, 0x19, 0xCC, 0xEB, 0x3E, 0xB8,
-    0x9F, 0x6E, 0x82, 0xF5, 0xEF, 0x01, 0xBC, 0x1D, 0x9D, 0xA0, 0x11, 0xE8, 0xE4, 0xDD, 0xE8, 0xF7,
-    0x5D, 0x18, 0xA5, 0xC0, 0x3E, 0xED, 0x80, 0xF7, 0xE3, 0x00, 0xE6, 0xBC, 0x57, 0x0A, 0xFB, 0x2E,
-    0x7C, 0x1D, 0x39, 0xA2, 0x83, 0x80, 0x87, 0xDA, 0x72, 0x65, 0x3D, 0xB5, 0xC5, 0x65, 0x3F, 0x7B,
-    0xAD, 0xCF, 0xE3, 0x7B, 0x0F, 0xFE, 0x39, 0xB8, 0xEB, 0xBF, 0xF5, 0xB1, 0xEA, 0x07, 0xEE, 0xE3,
-    0x34, 0x6B, 0x7B, 0x37, 0x13, 0xD5, 0xF2, 0x9C, 0x93, 0xB4, 0xB9, 0xC0, 0x6E, 0x24, 0x5B, 0x4B,
-    0x6E, 0x15, 0x87, 0xCC, 0xAF, 0x2E, 0xA6, 0xAA, 0x61, 0x9C, 0x8C, 0xAB, 0x1D, 0xBF, 0x4B, 0xDB,
-    0x85, 0x1C, 0x87, 0x88, 0xEF, 0x8E, 0x53, 0x6A, 0x49, 0xDB, 0x3D, 0x9F, 0xF6, 0x3A, 0x85, 0xBF,
-    0x8B, 0x93, 0x55, 0xB4, 0x57, 0x5F, 0x40, 0xBB, 0x6B, 0x0C, 0x7A, 0xED, 0x1B, 0x0C, 0xEF, 0x5A,
-    0x69, 0xF2, 0xD5, 0xE7, 0xAF, 0xA3, 0xCE, 0xEC, 0x64, 0x27, 0xE7, 0x93, 0x2D, 0xD2, 0xF7, 0x61,
-    0x44, 0x3B, 0x99, 0x3D, 0xCD, 0xEC, 0x55, 0x12, 0xFD, 0xDC, 0xF2, 0xA2, 0xE3, 0x5F, 0xB3, 0xC4,
-    0xAB, 0xC7, 0xB6, 0x0C, 0xB1, 0x47, 0x2D, 0x5B, 0xAE, 0x99, 0x50, 0x5F, 0xF6, 0x3B, 0x7F, 0xFE,
-    0xA2, 0x87, 0xD7, 0xAE, 0xEB, 0x6B, 0x8B, 0xB6, 0x1C, 0xE3, 0xB7, 0x6D, 0xB9, 0xF9, 0xBC, 0x80,
-    0x8B, 0x78, 0x28, 0xFC, 0x81, 0x46, 0x67, 0x39, 0x47, 0xC0, 0x09, 0xF6, 0x8C, 0xC1, 0x8B, 0x11,
-    0x3A, 0xA1, 0x59, 0xFC, 0x1A, 0xF6, 0xE4, 0x47, 0xD0, 0x05, 0x7E, 0x72, 0x2D, 0x14, 0x75, 0x5A,
-    0x8A, 0x30, 0x0F, 0x32, 0x4F, 0xB1, 0xC4, 0x91, 0xD3, 0xE0, 0x9B, 0x7F, 0x53, 0xB8, 0x23, 0x59,
-    0xE2, 0xA9, 0x20, 0x0B, 0xF3, 0xE9, 0x28, 0x6C, 0xE1, 0xA6, 0xCD, 0x46, 0xB3, 0xE1, 0xA6, 0xD3,
-    0xED, 0x82, 0x72, 0x88, 0x8B, 0x49, 0xFE, 0x3F, 0xED, 0x94, 0xBF, 0x4F, 0x14, 0x41, 0x14, 0xC7,
-    0xBF, 0xBB, 0x13, 0x6E, 0x12, 0x56, 0x79, 0xB1, 0xD0, 0x98, 0x08, 0x37, 0x16, 0x34, 0x12, 0x60,
-    0x29, 0x28, 0xC0, 0xDC, 0x8F, 0x89, 0x96, 0x16, 0x52, 0x68, 0x65, 0x01, 0xED, 0x11, 0x93, 0xB3,
-    0xA0, 0xC0, 0x84, 0xE3, 0x26, 0x31, 0xB1, 0x95, 0xD8, 0x58, 0x7A, 0xC5, 0xC5, 0x18, 0x2C, 0xBC,
-    0xE2, 0x0A, 0x8A, 0xE3, 0x6E, 0xFE, 0x84, 0xB1, 0x32, 0x56, 0x6E, 0x0C, 0xB1, 0x23, 0xD9, 0xE2,
-    0x8A, 0x3B, 0x3D, 0x58, 0xDF, 0xDE, 0x29, 0x82, 0x12, 0x63, 0x65, 0xE5, 0xBE, 0x4F, 0x66, 0x77,
-    0x66, 0xDE, 0xFC, 0xFA, 0xBE, 0x37, 0x0B, 0x40, 0x0E, 0x10, 0xAE, 0xEA, 0x5C, 0x60, 0x5B, 0xD2,
-    0x0E, 0x84, 0xEB, 0x89, 0x68, 0x04, 0x7F, 0x73, 0x4B, 0x3E, 0xB0, 0x6A, 0x15, 0x99, 0x1E, 0x32,
-    0x20, 0x8C, 0x01, 0xA8, 0xF2, 0xFB, 0x8C, 0xE9, 0xF5, 0x1A, 0x14, 0x50, 0xD4, 0xE8, 0x68, 0xEF,
-    0xA3, 0x16, 0xAB, 0x7A, 0x5C, 0xE9, 0x49, 0xA5, 0x97, 0xCB, 0xF7, 0x3A, 0xC9, 0x00, 0x4A, 0xA7,
-    0x94, 0x77, 0xBC, 0xDD, 0x5A, 0x98, 0xE8, 0x62, 0x62, 0x16, 0x7D, 0xB3, 0x08, 0x2C, 0x00, 0x37,
-    0xFB, 0x58, 0x2E, 0x1B, 0x04, 0x16, 0xD2, 0x5D, 0x97, 0xAE, 0x19, 0xD8, 0x76, 0x59, 0xAB, 0x1E,
-    0xAF, 0x01, 0x3F, 0xD1, 0x74, 0xC7, 0xCE, 0x0B, 0x9B, 0xF7, 0xB0, 0x05, 0xB4, 0x8F, 0xB1, 0x4F,
-    0xB6, 0x25, 0xDC, 0x96, 0x70, 0x39, 0xE1, 0x0A, 0xD2, 0xD2, 0x4B, 0xE3, 0xF7, 0x51, 0x4D, 0x2C,
-    0xD3, 0xF0, 0xED, 0x9A, 0xD0, 0x08, 0x80, 0x09, 0x60, 0x12, 0xC8, 0x01, 0x1B, 0x40, 0x0C, 0x44,
-    0xF0, 0x2D, 0x7C, 0x93, 0x4E, 0x18, 0x1C, 0xA3, 0x40, 0x66, 0x4B, 0x5A, 0xA6, 0x48, 0x5A, 0x1D,
-    0x41, 0x1E, 0x63, 0x3E, 0xE4, 0x33, 0xA7, 0x07, 0xE6, 0x99, 0x0B, 0x0F, 0x4C, 0x70, 0x34, 0xF4,
-    0xEC, 0xA1, 0x10, 0xA2, 0x45, 0xA6, 0x17, 0xD8, 0x9E, 0x4C, 0x45, 0x29, 0x28, 0x17, 0x7C, 0xE5,
-    0x4D, 0x5A, 0x04, 0xE6, 0x11, 0xE1, 0x71, 0x05, 0x2A, 0x02, 0xA6, 0x81, 0xC5, 0xEF, 0xCC, 0xB4,
-    0xEB, 0xCC, 0x49, 0x35, 0x6D, 0xD9, 0xAD, 0x33, 0xC5, 0xA4, 0xCB, 0x25, 0x86, 0xCF, 0xE5, 0xFB,
-    0x2B, 0x5C, 0xC5, 0x55, 0xAF, 0x2B, 0x1D, 0x19, 0x85, 0x22, 0x0A, 0xA7, 0x2C, 0x64, 0x8D, 0xC8,
-    0x8A, 0x18, 0x9B, 0xC0, 0x1A, 0x2A, 0x20, 0x23, 0x9D, 0x88, 0xFC, 0xD8, 0x3B, 0x31, 0x3F, 0x16,
-    0x91, 0x70, 0x81, 0x0D, 0xD1, 0xE4, 0xD9, 0xB6, 0x43, 0x43, 0xCF, 0x63, 0xD2, 0x31, 0xA1, 0x71,
-    0x1A, 0xA5, 0xF7, 0xD6, 0x77, 0x4A, 0xF8, 0xEB, 0xA0, 0xA2, 0x01, 0x19, 0xA3, 0x1D, 0xE3, 0x52,
-    0x0C, 0xEF, 0x3C, 0xAE, 0xF4, 0xF9, 0x2C, 0xA9, 0x82, 0xAC, 0x58, 0x85, 0x67, 0x27, 0x3B, 0x4D,
-    0x96, 0xB7, 0xC7, 0x81, 0xC7, 0x5C, 0xAA, 0xB3, 0xEF, 0x58, 0x78, 0x3B, 0xE7, 0xD9, 0x4E, 0x62,
-    0x77, 0x47, 0x9E, 0x7D, 0x54, 0x42, 0xF6, 0x34, 0xD3, 0xEC, 0xA6, 0xE0, 0xED, 0x41, 0xF6, 0x91,
-    0x0E, 0x09, 0xEC, 0x9A, 0xB4, 0x31, 0xD9, 0xFD, 0xEA, 0x30, 0xCA, 0xFF, 0x73, 0xE6, 0xDF, 0xE6,
-    0x8C, 0xFF, 0x1A, 0x14, 0xE0, 0xA2, 0x30, 0x10, 0xC6, 0x7B, 0x63, 0xB2, 0xC2, 0xE4, 0x18, 0x69,
-    0xF2, 0xD7, 0x6C, 0xF0, 0x29, 0xCA, 0x44, 0xC8, 0xCF, 0x61, 0x83, 0xC0, 0x29, 0xF5, 0xE5, 0x6D,
-    0xAA, 0x04, 0xC3, 0xC3, 0xF2, 0xE3, 0xE9, 0xE9, 0x32, 0x07, 0xC8, 0x67, 0xB1, 0x21, 0x75, 0x2C,
-    0x4C, 0x2C, 0xEC, 0x88, 0x86, 0x34, 0x39, 0x4A, 0x7B, 0xD7, 0x9F, 0xD6, 0xD4, 0x6D, 0x27, 0x9F,
-    0xC0, 0xFF, 0x00, 0xEC, 0x01, 0x2D, 0x78, 0xCF, 0x20, 0xA5, 0x99, 0x12, 0xAE, 0x73, 0xB7, 0xC7,
-    0x63, 0xA7, 0xCA, 0x9C, 0x91, 0xBC, 0xAE, 0x65, 0x8A, 0x89, 0xCD, 0x09, 0xC6, 0x64, 0x03, 0xC8,
-    0x1E, 0x4A, 0xC3, 0x44, 0xA0, 0x11, 0xF3, 0x9A, 0xDE, 0xBB, 0xE1, 0x16, 0x7E, 0xA5, 0xEA, 0xF6,
-    0xCF, 0x78, 0x66, 0xEA, 0x24, 0x1C, 0x49, 0xD0, 0x24, 0x68, 0x13, 0x74, 0x08, 0xE2, 0x3F, 0x11,
-    0x87, 0xD8, 0x8F, 0xAA, 0xEE, 0x61, 0x89, 0x1D, 0xE9, 0x5C, 0xEB, 0xB8, 0x1B, 0x33, 0xB7, 0x0E,
-    0xA0, 0x5E, 0x1C, 0xB2, 0x5E, 0xBA, 0x9B, 0x36, 0xC5, 0x7F, 0x28, 0x78, 0xD5, 0x80, 0x47, 0x68,
-    0xF5, 0x2A, 0xFA, 0xFD, 0xAE, 0x11, 0x9A, 0x55, 0xB7, 0x5D, 0x9A, 0xD7, 0xD9, 0xCF, 0xDC, 0xCB,
-    0x55, 0x16, 0x6F, 0x73, 0x08, 0x7F, 0x34, 0xE9, 0x5D, 0x4C, 0x45, 0x43, 0x3F, 0x36, 0x5C, 0x75,
-    0xC8, 0xD4, 0x67, 0x67, 0x97, 0x2E, 0xE4, 0xA1, 0x9C, 0x37, 0x40, 0x76, 0x61, 0x62, 0x69, 0x4A,
-    0x75, 0xC7, 0x30, 0x8E, 0xB0, 0x56, 0x5E, 0x99, 0xC0, 0x4F, 0x23, 0xBE, 0x92, 0xDF, 0x00, 0x8D,
-    0x57, 0x4F, 0x6C, 0xDD, 0x48, 0x19, 0xFF, 0xEC, 0x69, 0x63, 0xA8, 0x95, 0x4C, 0x0E, 0x29, 0x0B,
-    0xCA, 0x4B, 0xCD, 0x61, 0x0F, 0xA8, 0xB4, 0x78, 0x25, 0x1E, 0x52, 0x60, 0x93, 0x67, 0xB3, 0x2B,
-    0x81, 0x10, 0xCA, 0x2A, 0x48, 0xFB, 0xE8, 0xA1, 0x87, 0xEC, 0x79, 0xF7, 0x90, 0x27, 0xD1, 0xC3,
-    0x1E, 0xFA, 0x62, 0x97, 0xCB, 0x5E, 0x50, 0x95, 0x0B, 0x7B, 0x43, 0xE4, 0xC0, 0x21, 0xA4, 0x40,
-    0x0A, 0xAA, 0x60, 0x81, 0xA4, 0x1E, 0xE8, 0x91, 0x43, 0x0D, 0x55, 0xC5, 0x11, 0x2F, 0x4A, 0x01,
-    0x95, 0x95, 0xE2, 0xDD, 0x75, 0x77, 0x9D, 0x57, 0xDB, 0xC3, 0xEF, 0x1B, 0xBF, 0xA4, 0xE9, 0x12,
-    0x55, 0xEB, 0xE4, 0xFB, 0xCD, 0xF3, 0x78, 0xFC, 0xCD, 0xCC, 0xF7, 0xE7, 0x37, 0x9F, 0x89, 0xF8,
-    0x4A, 0x0A, 0x22, 0x27, 0xDD, 0x25, 0xF2, 0x68, 0x91, 0xA8, 0x47, 0xCF, 0x13, 0x0D, 0xB9, 0x7F,
-    0xC7, 0xC0, 0xE9, 0x7E, 0x9F, 0x76, 0xA4, 0xD6, 0xE1, 0x8E, 0x95, 0x3B, 0xF1, 0xD0, 0xCA, 0x45,
-    0xDC, 0xB3, 0x72, 0x8B, 0x7C, 0x2B, 0x27, 0x72, 0xFF, 0x0A, 0xB0, 0xB4, 0xAE, 0x80, 0xD0, 0x42,
-    0xDC, 0x77, 0x04, 0x31, 0xC0, 0x52, 0x64, 0x3F, 0xBA, 0xA4, 0xC8, 0xD3, 0x5A, 0x99, 0xC9, 0x68,
-    0x90, 0x12, 0xFD, 0x5A, 0x91, 0xF5, 0x58, 0x51, 0xA4, 0x4B, 0xBB, 0xBE, 0xD7, 0x38, 0xEF, 0xDE,
-    0x49, 0xE4, 0x9F, 0xEF, 0xF4, 0xFC, 0x97, 0xDE, 0x9A, 0x09, 0xC4, 0x77, 0x29, 0x10, 0xAF, 0x50,
-    0xE4, 0x4C, 0xB6, 0x72, 0xA6, 0x43, 0xC1, 0xD4, 0x05, 0x0A, 0x96, 0xBE, 0x44, 0xFE, 0x8F, 0xE6,
-    0xC9, 0x7B, 0xAF, 0x6B, 0xB9, 0xD5, 0xC0, 0x15, 0xCD, 0xCD, 0xDB, 0x94, 0xE8, 0x92, 0xBE, 0xD1,
-    0x84, 0x46, 0xE5, 0x4D, 0xA8, 0xFF, 0x5E, 0xDC, 0x4E, 0xE1, 0xEA, 0x8C, 0xA2, 0xB7, 0x6B, 0xBB,
-    0xA0, 0xC4, 0xC9, 0x28, 0x90, 0x8A, 0x2E, 0x7A, 0x78, 0x14, 0x84, 0x10, 0x3C, 0x0E, 0xE4, 0x07,
-    0x75, 0x34, 0xF1, 0x71, 0x12, 0x51, 0xB5, 0x18, 0x51, 0x89, 0x3E, 0x96, 0x02, 0xCF, 0x0B, 0xF2,
-    0xE3, 0x82, 0xA4, 0x2A, 0xC8, 0xCD, 0x8B, 0x09, 0x51, 0x17, 0xE7, 0x88, 0xF7, 0xE6, 0x41, 0x1F,
-    0xCD, 0x60, 0x3A, 0x9D, 0xAF, 0x8C, 0x6E, 0xE4, 0x22, 0x23, 0x96, 0x9B, 0x90, 0x01, 0x64, 0x1A,
-    0x42, 0x4F, 0x09, 0x8C, 0x25, 0x1E, 0xF5, 0x8F, 0xEE, 0xDF, 0x18, 0x6D, 0x18, 0x39, 0x7A, 0x0E,
-    0xFB, 0xCC, 0x1E, 0xC0, 0xEE, 0x87, 0x26, 0x89, 0x6A, 0xB2, 0x0F, 0xA2, 0xD8, 0x49, 0xA5, 0x92,
-    0xCA, 0x51, 0x32, 0x16, 0xA1, 0xC4, 0x7A, 0x59, 0x5C, 0x0C, 0x11, 0x29, 0xEB, 0xF8, 0x19, 0x9B,
-    0x8B, 0x88, 0xAD, 0x5C, 0x92, 0xD9, 0x3A, 0xBD, 0x83, 0xDF, 0xB7, 0x20, 0xD0, 0x67, 0x2B, 0xDE,
-    0xF6, 0xFA, 0x95, 0x00, 0x6B, 0xEC, 0xDA, 0xAC, 0xF8, 0x94, 0x51, 0x3D, 0xD3, 0xCE, 0xD0, 0x6D,
-    0x9B, 0x9B, 0x6D, 0x83, 0x35, 0x9C, 0x5F, 0x4F, 0xAE, 0xED, 0x67, 0xE4, 0x7F, 0xA8, 0x3F, 0xC4,
-    0x06, 0xC5, 0xC8, 0xD6, 0x71, 0x42, 0x76, 0x45, 0x1A, 0x96, 0x80, 0xDD, 0x6E, 0x93, 0x17, 0xA2,
-    0x19, 0x72, 0x93, 0x7F, 0xA2, 0xA9, 0x8F, 0x37, 0x76, 0xDB, 0x88, 0xB6, 0x71, 0x76, 0xCD, 0x7B,
-    0x53, 0x18, 0x19, 0x3B, 0xF5, 0x5C, 0x14, 0x7A, 0x69, 0xA0, 0x7F, 0x11, 0x65, 0x5E, 0x75, 0xC2,
-    0x12, 0x8E, 0x2E, 0x3F, 0xB7, 0x74, 0x3E, 0x5B, 0x52, 0x94, 0x62, 0x01, 0x92, 0xAC, 0x86, 0x41,
-    0x33, 0xEC, 0xC7, 0x80, 0xBB, 0x0A, 0xF0, 0xF7, 0x4C, 0xB2, 0xFD, 0x75, 0xF5, 0xB9, 0xFB, 0xF5,
-    0xCA, 0xAB, 0x96, 0xAA, 0x25, 0x4C, 0xA2, 0xB7, 0x37, 0xDF, 0x18, 0x25, 0xFB, 0x9B, 0x96, 0xF2,
-    0xEE, 0x92, 0xA5, 0xE4, 0x3F, 0x00, 0x8E, 0x06, 0x08, 0x06, 0xA8, 0xB0, 0x53, 0x4A, 0xC8, 0x81,
-    0x67, 0x29, 0x68, 0xC8, 0xA7, 0x40, 0xC3, 0xEA, 0x34, 0xDB, 0x24, 0x30, 0x8F, 0x5D, 0x3A, 0x1C,
-    0xBA, 0xA5, 0x55, 0x32, 0x52, 0x75, 0x0C, 0xEB, 0x53, 0xE6, 0xF7, 0xA4, 0xC1, 0x39, 0x33, 0x66,
-    0x11, 0xE8, 0xBC, 0xAF, 0x0B, 0xEB, 0x20, 0x79, 0x0B, 0xA8, 0xFF, 0x43, 0xDC, 0x43, 0xCF, 0x40,
-    0xDB, 0xA0, 0x53, 0x23, 0xDC, 0x5E, 0x0D, 0x74, 0x4E, 0xB2, 0x34, 0x7B, 0x0D, 0x13, 0xBC, 0x8B,
-    0x6B, 0x65, 0x94, 0x70, 0xB0, 0x8A, 0x9C, 0x57, 0x81, 0xC6, 0x2E, 0x4C, 0xC3, 0xEF, 0x72, 0x7C,
-    0x54, 0x56, 0xB2, 0xCE, 0x8D, 0xFB, 0xAF, 0x82, 0x3B, 0x3D, 0xDA, 0xC1, 0x90, 0xBC, 0x47, 0x6F,
-    0xE2, 0x85, 0xB4, 0x87, 0x90, 0x1B, 0xDD, 0x26, 0x3F, 0x44, 0xA4, 0xC1, 0x60, 0x05, 0x5E, 0xA8,
-    0xC9, 0x41, 0xCC, 0xE5, 0x11, 0x02, 0x23, 0x17, 0x39, 0x02, 0xDD, 0xA9, 0x44, 0xEE, 0x61, 0x9B,
-    0xBB, 0x22, 0x97, 0xE9, 0xE7, 0x69, 0x91, 0x27, 0x5A, 0xE0, 0x46, 0x60, 0x2F, 0x0B, 0x88, 0xBE,
-    0xC6, 0xFF, 0x66, 0xA9, 0x75, 0xEC, 0xFF, 0x45, 0xA7, 0xE3, 0x40, 0xF1, 0x11, 0x35, 0x1B, 0x94,
-    0x54, 0xB3, 0x0D, 0xBB, 0x77, 0xA5, 0xB0, 0x10, 0x17, 0x05, 0x39, 0x0A, 0x56, 0x11, 0x25, 0x39,
-    0x31, 0x3C, 0xEE, 0x54, 0xE4, 0x86, 0x08, 0x0E, 0x77, 0x07, 0xDE, 0x81, 0x55, 0xE1, 0xE8, 0x29,
-    0x6E, 0x27, 0x03, 0x9A, 0x83, 0x1F, 0xC3, 0x8E, 0x4F, 0x17, 0xE8, 0xEC, 0xEA, 0xFD, 0xE1, 0xEA,
-    0x8F, 0x87, 0xD8, 0xB5, 0xB9, 0xE0, 0x4D, 0xD5, 0x95, 0xEA, 0x16, 0x73, 0xCC, 0xC0, 0x55, 0x39,
-    0xEF, 0x2F, 0x17, 0xA9, 0xC9, 0x83, 0x4C, 0xBC, 0x8B, 0xD9, 0xED, 0x47, 0xCA, 0xFE, 0x00, 0x6B,
-    0xB5, 0x46, 0xCA, 0xFA, 0x98, 0x53, 0x42, 0xC7, 0xF4, 0x98, 0xAD, 0x93, 0x84, 0xA4, 0x43, 0xCE,
-    0x0F, 0xF3, 0x6F, 0x92, 0xB7, 0x47, 0xD4, 0xEF, 0x2F, 0xD3, 0x59, 0x28, 0xA6, 0x00, 0x99, 0xA9,
-    0x00, 0x22, 0x63, 0xC8, 0x01, 0x36, 0xE0, 0x34, 0x83, 0xFC, 0xE1, 0x09, 0x70, 0x8D, 0x21, 0x26,
-    0x03, 0x3D, 0x86, 0x21, 0x43, 0x55, 0xC9, 0xFB, 0x97, 0x8B, 0x0A, 0x0C, 0x37, 0x66, 0x0F, 0x98,
-    0x90, 0x39, 0xA4, 0xF5, 0x0B, 0xD1, 0x99, 0x1B, 0xA3, 0xB0, 0x05, 0x73, 0x7B, 0x16, 0x60, 0xEB,
-    0x7B, 0x70, 0xE8, 0xE8, 0x8F, 0x39, 0xC2, 0xDC, 0xCB, 0xB1, 0x2C, 0x0C, 0xEE, 0x11, 0x3C, 0xB9,
-    0xC6, 0x43, 0x86, 0x4F, 0x83, 0xE9, 0x33, 0x4F, 0xCD, 0x38, 0xF3, 0x86, 0x1C, 0x7D, 0x74, 0x00,
-    0x2D, 0x7F, 0xC3, 0xEE, 0x4E, 0x1D, 0x66, 0xC1, 0x99, 0xAD, 0xAD, 0x4D, 0xA6, 0xC9, 0xFA, 0x58,
-    0x66, 0x38, 0x58, 0x53, 0x70, 0x19, 0x71, 0x60, 0x17, 0xE0, 0x53, 0x84, 0x02, 0xAD, 0x33, 0x81,
-    0x38, 0x69, 0x4B, 0x0C, 0xAB, 0x0F, 0x37, 0x91, 0x14, 0x08, 0x01, 0xFC, 0x66, 0x41, 0xEE, 0x93,
-    0x9B, 0xB6, 0xCF, 0x0F, 0x89, 0xC6, 0x44, 0x54, 0x4D, 0x2F, 0x50, 0xF0, 0x36, 0x1E, 0x32, 0x31,
-    0xB0, 0xA7, 0xD3, 0xA0, 0xA6, 0x59, 0x1D, 0x7A, 0x25, 0xC1, 0xCB, 0xAC, 0x8A, 0x13, 0x8F, 0x71,
-    0xD1, 0x20, 0x93, 0x4A, 0x65, 0x73, 0x60, 0x54, 0x0E, 0x5B, 0xA5, 0x3A, 0x07, 0x78, 0xBD, 0x49,
-    0xB6, 0x62, 0x93, 0x84, 0x3C, 0xD5, 0x3E, 0x3F, 0xD5, 0x92, 0xAD, 0x54, 0x09, 0x9E, 0xA3, 0xB2,
-    0x6A, 0xF3, 0x6E, 0x62, 0x30, 0x30, 0x3A, 0xBD, 0x8C, 0xD1, 0x45, 0x14, 0x21, 0xA6, 0x1A, 0xE4,
-    0x1F, 0x78, 0x59, 0x71, 0x5C, 0xA8, 0xE8, 0x46, 0xB3, 0xAD, 0xAE, 0xDA, 0x85, 0x50, 0x57, 0xB0,
-    0x37, 0x35, 0x00, 0xA4, 0xD3, 0x48, 0x82, 0x10, 0xEC, 0x33, 0x8D, 0x90, 0xF8, 0x08, 0xF9, 0x60,
-    0xB3, 0x47, 0x1C, 0xD6, 0x1D, 0xE1, 0x4E, 0xFC, 0xB3, 0xB8, 0xC5, 0x7D, 0x1C, 0x30, 0x3C, 0x93,
-    0x5F, 0x8C, 0x87, 0x59, 0x2F, 0x71, 0xEE, 0x98, 0x04, 0xE2, 0xA4, 0xA3, 0xE7, 0xF8, 0x69, 0xD2,
-    0x86, 0xF5, 0xA1, 0x75, 0xC7, 0xE4, 0x63, 0x8D, 0x69, 0xE7, 0x52, 0x1B, 0xF3, 0xD1, 0x76, 0x62,
-    0xDA, 0xB8, 0x27, 0xDA, 0x8E, 0xAB, 0x4C, 0xA5, 0x66, 0xFD, 0xEF, 0x98, 0xB6, 0xA4, 0x05, 0x6A,
-    0xCF, 0x32, 0xB6, 0x4B, 0xEB, 0x48, 0x32, 0xB6, 0xF5, 0x4D, 0x9B, 0xB6, 0x2D, 0x72, 0xC4, 0xB4,
-    0x30, 0x24, 0x9F, 0x2F, 0x4C, 0xDC, 0x3D, 0x5A, 0x36, 0xED, 0xA2, 0xC4, 0x6A, 0x64, 0x48, 0x3B,
-    0x0B, 0x00, 0x0F, 0x9A, 0xAF, 0x38, 0xEA, 0xCC, 0x2A, 0x0E, 0xCB, 0x5C, 0xA8, 0xAF, 0xEF, 0x42,
-    0x53, 0xEE, 0xA8, 0xD7, 0x7A, 0x24, 0xFF, 0x54, 0xB8, 0xF1, 0xE0, 0x37, 0x7B, 0x6B, 0x76, 0xED,
-    0xE1, 0x0C, 0x5A, 0xDD, 0x13, 0xFF, 0x6D, 0xF9, 0x62, 0xBC, 0x30, 0x9E, 0x82, 0xC6, 0x53, 0xD0,
-    0x78, 0x8A, 0xB6, 0x0D, 0xDB, 0xD6, 0x3B, 0xC6, 0xA6, 0xC8, 0x7A, 0x1C, 0xDD, 0xF9, 0x45, 0xAC,
-    0x7B, 0x12, 0x29, 0x31, 0x05, 0x99, 0x83, 0x74, 0x30, 0xEB, 0x05, 0xEC, 0x69, 0x1E, 0xAB, 0x00,
-    0x0B, 0xEF, 0xC2, 0x16, 0x11, 0xB4, 0x05, 0xD0, 0xE4, 0xC7, 0xB4, 0xE1, 0x2B, 0xCA, 0x83, 0x54,
-    0x54, 0xBF, 0xCB, 0x9D, 0xDE, 0xBD, 0x7C, 0xCA, 0xBF, 0x56, 0x76, 0x24, 0x55, 0xDD, 0x09, 0x53,
-    0x06, 0x70, 0x3D, 0x00, 0x36, 0x83, 0x48, 0x96, 0xF8, 0x2A, 0x39, 0xA3, 0x82, 0xAC, 0x24, 0xF6,
-    0xF5, 0x88, 0x19, 0x75, 0x3B, 0x43, 0x20, 0xB1, 0xF5, 0x2B, 0xC4, 0x1A, 0x87, 0x48, 0xFA, 0xFD,
-    0xBA, 0x8F, 0xF4, 0xAD, 0x90, 0xB8, 0xAF, 0x37, 0x5B, 0x49, 0x6C, 0xFA, 0x70, 0x5B, 0x71, 0x60,
-    0xC1, 0x55, 0xF5, 0x36, 0x36, 0x66, 0xE8, 0xB8, 0xA2, 0x67, 0x00, 0xE2, 0x06, 0x2B, 0xD4, 0xC6,
-    0x2B, 0x9D, 0x43, 0x98, 0xE0, 0xF7, 0xA2, 0x5F, 0x25, 0xB1, 0x55, 0x76, 0x3C, 0xE5, 0x64, 0x1D,
-    0x17, 0xC7, 0x66, 0xC7, 0x89, 0xBD, 0xB8, 0xC3, 0x87, 0x3C, 0x03, 0x1D, 0x42, 0x74, 0x1C, 0xB6,
-    0x36, 0xD1, 0x97, 0x94, 0x00, 0x99, 0x62, 0x9C, 0x54, 0x7E, 0xDC, 0xE1, 0x23, 0x17, 0xE0, 0x66,
-    0x00, 0x1B, 0x5B, 0x56, 0x94, 0xFC, 0x72, 0x55, 0x21, 0x53, 0x1A, 0xCC, 0x74, 0xF1, 0x68, 0x5E,
-    0x13, 0x48, 0x26, 0x08, 0x40, 0x7F, 0x7C, 0x69, 0x83, 0xFB, 0x6C, 0x7E, 0xFB, 0xAE, 0xA1, 0xF2,
-    0xBB, 0xEC, 0x1A, 0xE7, 0xDB, 0xEC, 0x30, 0x97, 0x33, 0x8F, 0x24, 0xE8, 0xD3, 0x18, 0x03, 0x69,
-    0xBE, 0x60, 0xB6, 0x33, 0xCF, 0xD8, 0xFF, 0x7D, 0xFF, 0x76, 0xFF, 0xB0, 0x3F, 0xE3, 0x88, 0x41,
-    0xA6, 0xA1, 0x3E, 0x11, 0x8A, 0x93, 0x58, 0xC4, 0x24, 0x53, 0x72, 0x63, 0x72, 0x33, 0xF2, 0xD0,
-    0x5F, 0x10, 0x12, 0x5C, 0xEB, 0x31, 0x33, 0x95, 0x24, 0x0E, 0x56, 0x43, 0x37, 0x75, 0x52, 0x57,
-    0x81, 0xCB, 0x63, 0x9B, 0x8F, 0x7E, 0x43, 0xA9, 0xFD, 0xFE, 0xE5, 0x22, 0x61, 0xB6, 0xC5, 0x41,
-    0x40, 0x51, 0xC5, 0xFA, 0xEB, 0xD5, 0xD1, 0xD6, 0xCF, 0xA1, 0x8C, 0xDD, 0xCB, 0xA7, 0xC5, 0x3A,
-    0x82, 0xA4, 0x40, 0xC0, 0x14, 0xAE, 0xC2, 0x89, 0x5D, 0xCC, 0x22, 0x19, 0x99, 0x5E, 0x97, 0xC7,
-    0xF9, 0x31, 0x3F, 0x2E, 0x9C, 0xFE, 0x80, 0xC2, 0xA9, 0x8B, 0xC2, 0xA9, 0x8B, 0xC2, 0xA9, 0x8B,
-    0xC2, 0xA9, 0x0B, 0x9B, 0x42, 0xA8, 0x95, 0xE8, 0x98, 0x1C, 0xF6, 0xF1, 0x73, 0x1F, 0xE3, 0x30,
-    0x1E, 0x14, 0xD7, 0x9D, 0x10, 0x55, 0xF7, 0x2B, 0x4F, 0x0A, 0xA7, 0xF9, 0xB1, 0xFE, 0x69, 0xC4,
-    0x23, 0x66, 0xB7, 0x0A, 0xC4, 0xEE, 0x27, 0xE0, 0xCB, 0xA3, 0xED, 0x87, 0xC4, 0xBC, 0x10, 0x9E,
-    0xF4, 0xF4, 0xD3, 0x01, 0x4A, 0xCA, 0xC2, 0x7D, 0x00, 0x05, 0xC2, 0x10, 0xF9, 0xCC, 0xB1, 0xD2,
-    0x6A, 0x55, 0xB9, 0x08, 0x13, 0x19, 0x8A, 0x0C, 0xD5, 0x89, 0xF2, 0xC2, 0x36, 0x7D, 0x24, 0x33,
-    0x69, 0xCD, 0xE5, 0x2B, 0x4C, 0x04, 0x3E, 0x44, 0x5C, 0xB1, 0x9D, 0xB8, 0x97, 0xAD, 0x5A, 0x9C,
-    0x9E, 0x59, 0x2E, 0x5F, 0xDC, 0xBF, 0x55, 0xFC, 0xE0, 0xFA, 0xD7, 0xF2, 0xAF, 0x5E, 0x7F, 0x31,
-    0xF3, 0xAF, 0x07, 0xB1, 0x03, 0x7A, 0x16, 0xD7, 0xBB, 0x46, 0xEC, 0xEF, 0x3C, 0xCF, 0x6B, 0xAE,
-    0xCE, 0x33, 0x71, 0x8F, 0x2F, 0xDC, 0xD7, 0xBD, 0x4B, 0x0F, 0x86, 0xF3, 0x22, 0x9B, 0xEB, 0x8A,
-    0x6C, 0x92, 0x85, 0xFE, 0xAF, 0x3E, 0x3C, 0x41, 0x50, 0xA7, 0xB2, 0xAF, 0x61, 0xB5, 0x18, 0x3A,
-    0x8A, 0xF3, 0x09, 0xEA, 0x3D, 0x0E, 0x1F, 0xAB, 0x6A, 0xE9, 0x94, 0xFB, 0xB6, 0x9A, 0x0D, 0x1A,
-    0x97, 0x28, 0xBC, 0xC4, 0xF3, 0x28, 0x63, 0x82, 0x3D, 0xAC, 0x98, 0xD9, 0x3F, 0x6D, 0x57, 0xCD,
-    0x4C, 0x6C, 0x5E, 0x61, 0x62, 0xE3, 0x7A, 0xD7, 0xC7, 0x00, 0x9C, 0xDA, 0x3E, 0x1C, 0xF1, 0x9C,
-    0x5E, 0x6E, 0x93, 0xCA, 0x08, 0x02, 0xBA, 0x42, 0x66, 0x63, 0xEF, 0x13, 0xB8, 0x5F, 0xAB, 0xBE,
-    0x40, 0xAF, 0x35, 0x78, 0x19, 0x01, 0xE1, 0x56, 0xD6, 0xC6, 0xB0, 0x12, 0x55, 0xC8, 0x8C, 0x5E,
-    0x81, 0xC9, 0x2A, 0x3A, 0x07, 0x99, 0x83, 0x5C, 0x80, 0xBC, 0x39, 0xD1, 0x7C, 0x2B, 0xF3, 0x75,
-    0xD3, 0x12, 0x8F, 0x64, 0xDA, 0x5D, 0xBC, 0xCA, 0x2E, 0x9E, 0x62, 0xE0, 0x53, 0x64, 0x71, 0x05,
-    0x56, 0xC2, 0x49, 0xA6, 0xE3, 0x89, 0x6D, 0x26, 0x2E, 0x97, 0x79, 0xD7, 0xE5, 0x9A, 0xAF, 0x85,
-    0xAE, 0x02, 0x68, 0x9C, 0xF8, 0xEE, 0x4F, 0x23, 0x90, 0xE2, 0x67, 0x2F, 0x8E, 0x8F, 0xF7, 0x7F,
-    0x33, 0xBC, 0x6C, 0x72, 0x49, 0xE1, 0xBB, 0x01, 0x9F, 0x1B, 0xD8, 0x59, 0xC2, 0xC5, 0x9A, 0xDF,
-    0x98, 0xDA, 0x09, 0xF2, 0x45, 0xF3, 0x09, 0x71, 0x04, 0x57, 0x98, 0xF0, 0xB0, 0x37, 0xAB, 0xFE,
-    0x2D, 0xAA, 0x93, 0x6C, 0x10, 0x84, 0x52, 0x0D, 0x24, 0x5C, 0x3C, 0x70, 0x52, 0x9F, 0xAB, 0xF3,
-    0x00, 0x80, 0xBA, 0x69, 0x60, 0x1F, 0x83, 0xE1, 0x33, 0x21, 0x01, 0xBB, 0xA0, 0x3A, 0x53, 0x22,
-    0x43, 0x82, 0x65, 0x56, 0x09, 0xEF, 0x54, 0x4F, 0x0B, 0x42, 0x2C, 0x73, 0x32, 0x94, 0x9F, 0x21,
-    0x57, 0xE5, 0x9F, 0xBA, 0xCA, 0x27, 0xB1, 0x74, 0x08, 0xCE, 0x4F, 0x38, 0x34, 0xB1, 0x6E, 0xFB,
-    0xF1, 0x2B, 0x38, 0x1F, 0xEF, 0x2C, 0x05, 0xE4, 0xBD, 0xBC, 0x24, 0xE3, 0x40, 0x2C, 0xB9, 0xAA,
-    0x27, 0x96, 0x1C, 0x35, 0x14, 0x4B, 0x42, 0x0D, 0xED, 0xCF, 0xD8, 0xB4, 0x4B, 0x63, 0xFE, 0x6D,
-    0xCF, 0x1E, 0x73, 0xC0, 0xF8, 0x47, 0x47, 0x40, 0x7B, 0x3E, 0xB0, 0x13, 0xCE, 0xAE, 0xF5, 0x5B,
-    0x56, 0x69, 0x81, 0x5E, 0x50, 0xE6, 0x5B, 0x2B, 0xD1, 0x7B, 0xA8, 0x13, 0xB8, 0x08, 0xF3, 0x63,
-    0xE6, 0xBA, 0xF1, 0x5F, 0xFA, 0xE4, 0xB7, 0x1F, 0xCA, 0x87, 0x25, 0x49, 0xF8, 0x0C, 0x86, 0xC3,
-    0x18, 0x17, 0xCF, 0x9C, 0x5C, 0x82, 0x5F, 0x9E, 0x08, 0xB2, 0x07, 0xEF, 0x78, 0x0F, 0x92, 0x50,
-    0xF3, 0x87, 0x07, 0x7F, 0x70, 0xB1, 0x4C, 0xC3, 0x25, 0xC9, 0x1E, 0x39, 0x07, 0x0D, 0x08, 0xCC,
-    0x0F, 0xB1, 0x8B, 0xB0, 0x87, 0x8A, 0x90, 0x57, 0xBB, 0x7B, 0x82, 0xAC, 0x8D, 0xD7, 0xEF, 0x29,
-    0x11, 0xBA, 0xA3, 0x04, 0x99, 0x07, 0x5D, 0xA7, 0x5B, 0xE3, 0x20, 0x8B, 0x60, 0x91, 0x96, 0xE7,
-    0xFE, 0x07, 0xD3, 0x5A, 0xB5, 0x6A, 0x81, 0xFD, 0xFF, 0xFF, 0x1F, 0xB4, 0x80, 0x34, 0x00, 0xC5,
-    0x92, 0xBF, 0x4E, 0x83, 0x50, 0x14, 0x87, 0x7F, 0x80, 0x2D, 0x03, 0x03, 0x93, 0x53, 0x87, 0xEB,
-    0x68, 0xC2, 0xC0, 0x0B, 0x68, 0x21, 0x7D, 0x82, 0x0E, 0xF5, 0x25, 0x7C, 0x06, 0x53, 0x49, 0x1C,
-    0x1D, 0x7C, 0x00, 0x17, 0x87, 0x9A, 0x18, 0xBA, 0x3A, 0x74, 0x68, 0x72, 0x31, 0x0E, 0xAE, 0x3C,
-    0x02, 0x73, 0xA7, 0x3B, 0x30, 0xD0, 0x86, 0x72, 0x3C, 0xF7, 0x42, 0x13, 0x74, 0xF2, 0x5F, 0xE2,
-    0xF2, 0x5D, 0x72, 0xE1, 0xDC, 0xDF, 0x77, 0xCF, 0x01, 0x00, 0x8E, 0x63, 0x78, 0x64, 0x53, 0x89,
-    0xB1, 0xB8, 0x7D, 0xA9, 0xB0, 0xF2, 0xEF, 0xE2, 0x12, 0xE5, 0x40, 0xC4, 0xB0, 0x4A, 0x84, 0xE8,
-    0x18, 0xEC, 0x96, 0x94, 0x22, 0x68, 0x96, 0xB4, 0xF9, 0xB0, 0xFF, 0x33, 0xDA, 0xCC, 0x18, 0xEE,
-    0xDE, 0xBA, 0xCE, 0x11, 0xD1, 0x1B, 0x35, 0xEC, 0x71, 0x39, 0x05, 0x7C, 0xDA, 0x03, 0x63, 0x48,
-    0xA0, 0x46, 0x04, 0x54, 0x38, 0xD5, 0x05, 0x68, 0x11, 0xEC, 0x52, 0x6D, 0x90, 0xCA, 0xF6, 0x90,
-    0xEF, 0xC3, 0xA4, 0xBA, 0x7B, 0x5C, 0xE7, 0x11, 0xBD, 0x52, 0x0D, 0x5C, 0xC4, 0xE0, 0xBB, 0x53,
-    0x17, 0xB9, 0x6E, 0x23, 0xFB, 0x15, 0xC1, 0x6E, 0xC1, 0x68, 0x9E, 0xC2, 0x5F, 0x46, 0x5A, 0xF2,
-    0x10, 0x09, 0x0C, 0x1F, 0xA1, 0x53, 0x41, 0x94, 0x71, 0xB0, 0xB8, 0x29, 0x3C, 0x05, 0xDD, 0xF5,
-    0xCC, 0x29, 0xC0, 0x7D, 0xF7, 0x63, 0x3B, 0xD1, 0xB5, 0xDC, 0xFF, 0x43, 0xB7, 0xCC, 0xD5, 0x65,
-    0x9A, 0x3E, 0x98, 0xDB, 0x6F, 0x96, 0xAA, 0x3B, 0xFB, 0xEF, 0x57, 0xA3, 0xEB, 0xA8, 0x76, 0x32,
-    0xA3, 0xBD, 0x99, 0x4D, 0x1D, 0x69, 0x51, 0x60, 0x30, 0x6B, 0xBD, 0x25, 0xB1, 0xEF, 0x79, 0xDF,
-    0x5B, 0x75, 0xDE, 0xAA, 0xF5, 0xEE, 0x9D, 0x67, 0xBC, 0x27, 0xAA, 0xF5, 0x9E, 0xFC, 0x83, 0xB7,
-    0xA5, 0xA5, 0x43, 0x4A, 0x78, 0xBA, 0xB6, 0xD6, 0xE4, 0xF9, 0xF2, 0x5A, 0xC1, 0xE9, 0xC1, 0x6D,
-    0x16, 0x8E, 0xF2, 0xA9, 0x72, 0x3E, 0xBF, 0xF8, 0x0A, 0xEA, 0x16, 0xA3, 0x2D, 0xE4, 0x4C, 0x52,
-    0x1E, 0xEA, 0x11, 0x5B, 0x3C, 0xBA, 0xE1, 0x54, 0x3F, 0xE8, 0xDF, 0x19, 0x4E, 0x21, 0x38, 0xDF,
-    0xCB, 0x3C, 0x6E, 0xA3, 0x9F, 0xB8, 0xF9, 0x81, 0xBC, 0x93, 0xC3, 0xA6, 0x5C, 0x6C, 0x12, 0x71,
-    0xAF, 0x24, 0x65, 0x67, 0x56, 0xC9, 0xFB, 0x57, 0x50, 0x86, 0x31, 0x73, 0x0E, 0x30, 0xA3, 0x42,
-    0xD3, 0x6F, 0x34, 0x2D, 0xCA, 0x75, 0xAD, 0xD0, 0x5F, 0xC2, 0xAA, 0x98, 0x27, 0x58, 0x33, 0x9F,
-    0x0D, 0x57, 0xA8, 0xDC, 0x02, 0xF3, 0xA1, 0x72, 0xB6, 0xB1, 0xA0, 0x84, 0x3F, 0x06, 0x7B, 0x1C,
-    0xE1, 0x1D, 0x35, 0xCE, 0xB1, 0x11, 0xC2, 0x30, 0x0C, 0x40, 0x51, 0x05, 0x15, 0x29, 0x28, 0xCC,
-    0x06, 0x19, 0x21, 0x0D, 0x7D, 0xE8, 0x59, 0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D, 0x8B, 0x30, 0x84,
-    0x47, 0x70, 0xC3, 0x06, 0x29, 0x52, 0x20, 0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE, 0xC5, 0x3B, 0x9D,
-    0x25, 0xF2, 0x3F, 0xC7, 0x1E, 0xFB, 0xBD, 0xCA, 0x29, 0x92, 0x28, 0x91, 0x85, 0x35, 0xD2, 0x1E,
-    0x81, 0x5A, 0x64, 0x76, 0x4C, 0xF9, 0xB5, 0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F, 0x53, 0xF3, 0x29,
-    0xCC, 0x27, 0x13, 0x7C, 0x94, 0xB2, 0xC0, 0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6, 0x09, 0x76, 0x50,
-    0x47, 0x38, 0x43, 0x1E, 0xE0, 0x4E, 0x13, 0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A, 0x8C, 0x4D, 0xC9,
-    0x22, 0x83, 0x69, 0x8B, 0xFF, 0xAE, 0xBA, 0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41, 0x8E, 0xAD, 0xEF,
-    0x79, 0xE9, 0x39, 0xF8, 0xFD, 0x02,
+static const uint8_t notoserif_14_regularBitmaps[32978] = {
+    0xBD, 0x59, 0x3D, 0x8C, 0xDC, 0xD6, 0x11, 0x1E, 0x92, 0xD2, 0x31, 0x11, 0x01, 0x51, 0x85, 0x0D,
+    0x07, 0x3E, 0xEB, 0x98, 0xC2, 0x45, 0x2C, 0x9D, 0xCD, 0x26, 0x85, 0x0C, 0xEC, 0x2D, 0x9F, 0xED,
+    0xD2, 0x45, 0x52, 0xF8, 0x9C, 0x22, 0x09, 0xD2, 0x24, 0x40, 0x60, 0x18, 0x38, 0x05, 0xB8, 0xC2,
+    0xC5, 0xDD, 0x92, 0xB1, 0x8A, 0x14, 0x29, 0xA4, 0xCA, 0x8D, 0x8B, 0xA8, 0xB0, 0x01, 0x65, 0x05,
+    0xE4, 0xAE, 0x50, 0xA1, 0x62, 0x57, 0xA4, 0xA1, 0x42, 0x45, 0x8A, 0xD0, 0x36, 0x8C, 0x94, 0x26,
+    0x6C, 0x09, 0x06, 0xAC, 0xC0, 0xA6, 0x2D, 0x2A, 0xE2, 0xAD, 0xB8, 0xCB, 0x7C, 0xDF, 0x23, 0xF7,
+    0xE7, 0x14, 0xC9, 0x3A, 0x29, 0x46, 0x76, 0x77, 0x86, 0xB7, 0xDC, 0xC7, 0x79, 0xF3, 0xE6, 0xE7,
+    0x9B, 0x79, 0xEF, 0x86, 0xE3, 0xE1, 0x70, 0x38, 0xD8, 0xC2, 0xAB, 0xD3, 0xE9, 0x9C, 0x3A, 0x25,
+    0xF2, 0xFB, 0xC9, 0x64, 0x28, 0x7C, 0xD9, 0x22, 0x5D, 0x91, 0x42, 0xAC, 0x4C, 0x9C, 0x44, 0xDC,
+    0x48, 0x3C, 0x25, 0x81, 0xCC, 0x3F, 0xBD, 0x85, 0xCF, 0xEC, 0xA6, 0x2F, 0x1C, 0xE6, 0x26, 0x62,
+    0xA7, 0x62, 0xE6, 0x22, 0x03, 0x7C, 0x17, 0x31, 0x28, 0xEF, 0xA7, 0xFA, 0x57, 0x3B, 0xD1, 0xF7,
+    0x4B, 0xFD, 0x53, 0x77, 0xE1, 0x31, 0x5F, 0xDD, 0xFB, 0x69, 0x7E, 0xC2, 0x98, 0x6D, 0x3D, 0x58,
+    0x6B, 0x02, 0x35, 0xD6, 0x44, 0x8E, 0x89, 0x1C, 0x51, 0x5E, 0xEA, 0x65, 0x76, 0x66, 0xA4, 0x66,
+    0x62, 0xAB, 0x35, 0xDE, 0x12, 0x09, 0x6B, 0x85, 0x0F, 0xFE, 0x78, 0x5A, 0x02, 0x85, 0xB7, 0xB4,
+    0xAF, 0xB0, 0x10, 0x73, 0xEF, 0x8A, 0x38, 0xA9, 0xA7, 0xDC, 0xC8, 0x49, 0x7C, 0x65, 0xA7, 0x01,
+    0xA4, 0x81, 0x72, 0x52, 0xAF, 0xA1, 0x62, 0x81, 0xF2, 0x60, 0x4E, 0x19, 0xC7, 0xF3, 0x39, 0x27,
+    0x71, 0x95, 0x75, 0x1B, 0xCB, 0x8D, 0xCB, 0x66, 0x4D, 0x4E, 0x04, 0x15, 0x13, 0x31, 0xEA, 0x44,
+    0xBC, 0x7F, 0x24, 0x12, 0x62, 0xDD, 0x4F, 0x80, 0xE4, 0x51, 0xC9, 0x03, 0x85, 0xD7, 0xC5, 0xAF,
+    0xEB, 0x88, 0xEA, 0x1A, 0xF5, 0x75, 0x71, 0x6F, 0x4C, 0x60, 0x03, 0xAE, 0xC1, 0x8B, 0x7C, 0x0C,
+    0xFA, 0x61, 0x33, 0x38, 0xD2, 0xF6, 0xA4, 0x51, 0x64, 0x4B, 0x68, 0x13, 0xB1, 0xD2, 0x46, 0x8F,
+    0x95, 0xF6, 0x16, 0x8C, 0x6B, 0x25, 0x92, 0xB9, 0x22, 0x59, 0x77, 0xFD, 0x17, 0x69, 0x50, 0xD7,
+    0x9A, 0x1A, 0xB9, 0x85, 0x38, 0x37, 0x62, 0x48, 0x6C, 0x64, 0x92, 0x96, 0x66, 0x72, 0xE1, 0x03,
+    0x5A, 0xFA, 0x64, 0x06, 0x5D, 0xB0, 0x3E, 0x89, 0x61, 0x48, 0x17, 0xCF, 0xD9, 0xB8, 0x61, 0x51,
+    0x6A, 0xFE, 0x23, 0xFC, 0xDD, 0x81, 0x15, 0xBB, 0x50, 0xD8, 0xFF, 0x24, 0x16, 0x1B, 0xF2, 0xE4,
+    0x09, 0x4A, 0xE6, 0xB3, 0x21, 0xA8, 0xC6, 0xB0, 0xAF, 0xF1, 0xC8, 0x86, 0xC8, 0x51, 0xDC, 0x5B,
+    0x05, 0x6D, 0x82, 0x72, 0x5F, 0x4C, 0xCC, 0x66, 0x2B, 0xCC, 0x88, 0xB1, 0xAB, 0xA0, 0xED, 0xF5,
+    0x70, 0x3D, 0xAE, 0xEB, 0xFA, 0xC9, 0xF5, 0xF0, 0xB5, 0xE6, 0x79, 0x52, 0xA0, 0xC4, 0x88, 0x53,
+    0x71, 0xEB, 0xCA, 0xAD, 0x27, 0x42, 0x5A, 0xE9, 0xFF, 0x4D, 0x9E, 0x11, 0x07, 0x74, 0x18, 0xCF,
+    0xC9, 0x8C, 0xD6, 0x7E, 0x87, 0xD1, 0x75, 0x2E, 0xCF, 0x9A, 0xE3, 0x76, 0x6E, 0x44, 0x0C, 0x56,
+    0x36, 0xA5, 0x63, 0xA0, 0x5D, 0xC4, 0x4F, 0x29, 0x57, 0x24, 0x7C, 0xB7, 0x12, 0x8F, 0x26, 0x78,
+    0xAD, 0x8D, 0x07, 0x1F, 0xCF, 0xEC, 0x6D, 0x44, 0x56, 0x46, 0x9F, 0xDA, 0xF0, 0xAA, 0xD9, 0xCC,
+    0xDE, 0x52, 0xEF, 0xC8, 0x39, 0xE9, 0xC5, 0x13, 0x09, 0x13, 0x3F, 0xEA, 0xC1, 0x3E, 0x3D, 0xBD,
+    0x66, 0x1B, 0xF1, 0xD2, 0x10, 0x56, 0x32, 0x8D, 0x87, 0xC8, 0xDA, 0x0B, 0x67, 0xF1, 0x80, 0xF5,
+    0xA4, 0xA0, 0x64, 0xD4, 0xDF, 0x49, 0x10, 0xAA, 0x2A, 0x85, 0xAF, 0x94, 0x96, 0xBC, 0xD6, 0x3A,
+    0xA7, 0x6C, 0x7C, 0xC6, 0x0C, 0x40, 0x30, 0x33, 0x19, 0x98, 0x5B, 0x33, 0xB7, 0xDE, 0x67, 0xA8,
+    0xF6, 0x5B, 0x4C, 0xBF, 0x5D, 0x41, 0x66, 0x79, 0x88, 0x07, 0x37, 0xE9, 0xE2, 0xA1, 0x40, 0x93,
+    0x9B, 0x78, 0xD0, 0xDE, 0x29, 0xB6, 0xC5, 0xAC, 0x21, 0x0F, 0xE3, 0xEC, 0x2F, 0x6A, 0x8C, 0x0B,
+    0x31, 0xC6, 0xCD, 0x86, 0xF0, 0xD9, 0xA0, 0xA5, 0x6D, 0x1D, 0xEF, 0xD0, 0x38, 0xF5, 0x95, 0x59,
+    0x43, 0xF8, 0xE1, 0x56, 0x36, 0xEC, 0xE2, 0x7C, 0x09, 0xFB, 0x44, 0x5D, 0xAC, 0xDD, 0x57, 0x58,
+    0x6F, 0xB4, 0x0D, 0xB9, 0x43, 0x8C, 0x05, 0xA5, 0x5C, 0x3B, 0xE6, 0x49, 0x83, 0x28, 0x48, 0xDD,
+    0xFA, 0x6E, 0x6A, 0xD4, 0xAF, 0xA6, 0x0B, 0xC1, 0xDB, 0x2A, 0x1E, 0xC0, 0x27, 0x03, 0xF1, 0x5F,
+    0x87, 0x9E, 0x0C, 0x61, 0xD8, 0xF9, 0x39, 0x89, 0xF1, 0xEE, 0xC9, 0xBD, 0xAF, 0xF9, 0xFD, 0x23,
+    0xCA, 0x4F, 0xFC, 0xC4, 0x8B, 0xEE, 0x1D, 0x71, 0x04, 0x29, 0x15, 0x24, 0x6E, 0x62, 0x25, 0x56,
+    0xE4, 0xCA, 0xE5, 0xF6, 0xEE, 0x12, 0xD6, 0xE7, 0x7D, 0x32, 0xA0, 0x8E, 0x88, 0x7E, 0x4F, 0x1D,
+    0xD7, 0x73, 0xBB, 0xAD, 0xBF, 0x11, 0x37, 0x94, 0x69, 0x54, 0xF8, 0x0A, 0x3B, 0xBC, 0xB0, 0x10,
+    0x28, 0xAB, 0xFB, 0x26, 0x87, 0x8D, 0x5A, 0x9A, 0xA9, 0xF6, 0x42, 0x03, 0x11, 0x9A, 0x33, 0xE6,
+    0x45, 0xBE, 0xA6, 0x4E, 0xC6, 0xA7, 0x58, 0x9F, 0x58, 0xD7, 0x98, 0x39, 0xD6, 0x99, 0x9C, 0xD9,
+    0xFE, 0x0A, 0xB9, 0x6B, 0xD0, 0x33, 0x47, 0xA5, 0xD2, 0xB2, 0x09, 0x95, 0x1D, 0x2D, 0x0B, 0x01,
+    0x2D, 0x3A, 0x04, 0x20, 0x22, 0xA3, 0x52, 0x46, 0x4A, 0x13, 0x21, 0x17, 0x9D, 0x54, 0xAC, 0x88,
+    0x29, 0xE4, 0x68, 0xEE, 0xC1, 0xE0, 0x63, 0xA9, 0x2B, 0xA0, 0x55, 0x14, 0xD7, 0x7B, 0x22, 0x1B,
+    0xA3, 0x38, 0x13, 0x3B, 0x37, 0x4B, 0xFE, 0x5A, 0x91, 0x8D, 0xC9, 0x86, 0xB3, 0xBF, 0x78, 0xCF,
+    0x04, 0xFC, 0x8D, 0x62, 0x08, 0xA8, 0xEB, 0x73, 0xF8, 0x6A, 0xE8, 0xC1, 0x04, 0x2A, 0x09, 0xE6,
+    0x4C, 0xED, 0xFB, 0x3A, 0x16, 0xEF, 0xF6, 0x2F, 0x4B, 0xA9, 0x5B, 0x54, 0xC1, 0x02, 0x60, 0xC3,
+    0xF0, 0x9D, 0x31, 0x44, 0xC5, 0x48, 0xEA, 0x00, 0xDA, 0x3D, 0x3F, 0x35, 0xDE, 0x34, 0xF4, 0xC3,
+    0x05, 0x9A, 0xDE, 0xE3, 0xEF, 0x7E, 0xD4, 0x38, 0xDC, 0xC9, 0x65, 0xC9, 0xAA, 0x60, 0xB3, 0xFA,
+    0x26, 0x73, 0x2A, 0x63, 0xFE, 0xC7, 0xF5, 0x48, 0x61, 0x11, 0x3B, 0x08, 0xBE, 0xDC, 0x98, 0xE8,
+    0xE9, 0x23, 0x30, 0x78, 0x10, 0x4B, 0xCE, 0xC0, 0xAC, 0x9C, 0xAC, 0x98, 0x32, 0xB3, 0xDC, 0xC7,
+    0xE6, 0x3F, 0xE8, 0x71, 0xFA, 0x09, 0x37, 0x05, 0xF3, 0x29, 0x05, 0x68, 0x75, 0x7B, 0xA3, 0x5D,
+    0x04, 0x8C, 0x5B, 0x6E, 0x8C, 0xFA, 0x95, 0x9D, 0xCB, 0x16, 0x7E, 0xEA, 0x80, 0x56, 0x41, 0x87,
+    0x1A, 0x74, 0x6A, 0x69, 0xD4, 0x8F, 0x60, 0xA3, 0x68, 0xDF, 0xBD, 0x39, 0x39, 0x14, 0x4E, 0x27,
+    0x78, 0xB7, 0x35, 0xFC, 0xD4, 0x07, 0x92, 0x49, 0x42, 0x5E, 0x5B, 0xB7, 0xD7, 0xD5, 0x03, 0xE4,
+    0x6A, 0xF2, 0xE0, 0x4C, 0x0C, 0x9B, 0x45, 0x2C, 0xBE, 0x86, 0xEF, 0xC7, 0x11, 0x7C, 0xE5, 0x25,
+    0x36, 0xAB, 0x28, 0xEB, 0x62, 0xA4, 0x23, 0x9E, 0x36, 0xD5, 0xC6, 0x6D, 0x58, 0xB8, 0xC8, 0xFA,
+    0x17, 0x02, 0x42, 0x4A, 0x40, 0xF8, 0x0D, 0x58, 0x4C, 0x61, 0x7C, 0x97, 0xCF, 0xBA, 0x89, 0x03,
+    0x58, 0x49, 0x10, 0x28, 0xF8, 0x12, 0xBF, 0xBF, 0x81, 0xD0, 0x02, 0x42, 0xEA, 0x54, 0x8E, 0x59,
+    0xF9, 0x92, 0x8D, 0xB1, 0x2C, 0x4F, 0x94, 0x4D, 0x73, 0x52, 0x21, 0xF3, 0xA1, 0x7C, 0xD4, 0xBF,
+    0x58, 0x70, 0x69, 0xF5, 0x01, 0xC7, 0x4F, 0x39, 0xE4, 0x63, 0xB1, 0xCB, 0x08, 0xE3, 0x3A, 0xC2,
+    0xBC, 0x98, 0x1D, 0x53, 0x73, 0xDE, 0x47, 0xFC, 0x40, 0x08, 0x24, 0x38, 0x75, 0xB1, 0x04, 0x18,
+    0x0A, 0x65, 0x5F, 0x7F, 0xF1, 0xA8, 0x1F, 0x24, 0x21, 0xB2, 0xB1, 0x92, 0x65, 0xE4, 0x85, 0xA2,
+    0x41, 0xEA, 0x02, 0x4A, 0x85, 0x19, 0xD4, 0xF2, 0x39, 0x57, 0x87, 0x8C, 0xDA, 0x9B, 0xC8, 0xC7,
+    0xDC, 0x51, 0x60, 0x2B, 0xF4, 0xDB, 0x5B, 0x60, 0xDF, 0x20, 0x9B, 0xAD, 0x5B, 0x13, 0xBA, 0x19,
+    0x10, 0x60, 0x55, 0x28, 0xEA, 0x56, 0xEE, 0x66, 0x60, 0xB6, 0x7E, 0x42, 0x67, 0x65, 0x4D, 0x16,
+    0x32, 0xB2, 0xFC, 0x14, 0x8A, 0x3B, 0x25, 0x54, 0x37, 0x10, 0x40, 0x08, 0x7E, 0xD4, 0x13, 0xFB,
+    0x3B, 0x02, 0xE3, 0x01, 0x64, 0x2C, 0x04, 0xE4, 0xFE, 0xA0, 0x84, 0x3A, 0x36, 0xDC, 0x89, 0x8B,
+    0x03, 0x7F, 0x42, 0x2F, 0x17, 0xF9, 0x0E, 0xD4, 0x5A, 0x81, 0x36, 0x3B, 0x4A, 0xD6, 0x70, 0x39,
+    0x1B, 0xC9, 0x8B, 0xBC, 0x24, 0xF2, 0x07, 0x5C, 0xFE, 0x94, 0xCA, 0x37, 0x85, 0xC6, 0xA9, 0x0F,
+    0xF5, 0xC5, 0xFC, 0x00, 0x97, 0x3F, 0x96, 0x16, 0x2F, 0x51, 0x65, 0xBF, 0xC4, 0xCB, 0xC0, 0x31,
+    0x78, 0xE9, 0x1D, 0xD5, 0x97, 0xE0, 0xB8, 0xBE, 0xF8, 0x6F, 0xEA, 0x8B, 0x5B, 0x36, 0x97, 0x42,
+    0x5F, 0x6C, 0xE2, 0x8B, 0x97, 0x5A, 0x99, 0x4D, 0xA0, 0xB2, 0x12, 0x1F, 0x75, 0x2D, 0x43, 0x7B,
+    0xA2, 0x36, 0x0A, 0x59, 0xDE, 0x13, 0xBB, 0x12, 0x03, 0xEE, 0x9B, 0x10, 0xE8, 0x2C, 0x2C, 0x1F,
+    0xFC, 0x2F, 0x09, 0xF9, 0xD9, 0x8C, 0x1C, 0x4A, 0x80, 0xBF, 0x5D, 0x91, 0x47, 0x63, 0xCD, 0x03,
+    0xCD, 0xFD, 0x84, 0xDC, 0x4D, 0x33, 0x3D, 0x05, 0xB9, 0x59, 0x92, 0xCB, 0x58, 0xF3, 0x50, 0x73,
+    0x3F, 0x23, 0x66, 0xC2, 0xF6, 0xDE, 0x75, 0xB6, 0x1E, 0xF5, 0x58, 0xCC, 0xAC, 0xCD, 0xA8, 0x65,
+    0x5D, 0xE3, 0xDE, 0x19, 0x33, 0xFC, 0x7C, 0xE5, 0xA4, 0x4D, 0x56, 0xA0, 0x3F, 0x23, 0xAE, 0x22,
+    0x53, 0xCC, 0x02, 0x61, 0x60, 0x30, 0x71, 0x8C, 0x2A, 0xBC, 0x0F, 0x9B, 0xFE, 0x6A, 0x96, 0x3E,
+    0xBD, 0xCF, 0x67, 0x73, 0x48, 0x71, 0x12, 0x2D, 0x4F, 0x26, 0xEB, 0x70, 0xA3, 0xC6, 0x34, 0x36,
+    0x35, 0x84, 0x66, 0x20, 0x73, 0x6A, 0xE7, 0x1A, 0x9B, 0x2A, 0x02, 0x2A, 0x51, 0x79, 0x81, 0x78,
+    0xAF, 0x24, 0x68, 0x59, 0xB7, 0x77, 0x12, 0x0B, 0xE3, 0x0F, 0x06, 0x0C, 0xDF, 0xDB, 0x32, 0x8A,
+    0x87, 0x2D, 0x23, 0x9E, 0xC1, 0x8A, 0x46, 0x19, 0x82, 0x38, 0x2D, 0x8B, 0x47, 0x27, 0xBA, 0x4B,
+    0x56, 0x6D, 0xFD, 0xD9, 0x49, 0x59, 0x7F, 0x8A, 0xFB, 0xD4, 0x9F, 0xE1, 0xEC, 0x5E, 0xD9, 0xC2,
+    0xF8, 0x68, 0x87, 0x45, 0x68, 0xCC, 0x85, 0x85, 0x64, 0x5A, 0x6B, 0x57, 0xA7, 0x94, 0x46, 0x70,
+    0x8E, 0x33, 0xF4, 0x13, 0x31, 0xD7, 0x1D, 0xA4, 0x4C, 0xF0, 0x62, 0xDE, 0xC6, 0xC4, 0xC8, 0x46,
+    0x5F, 0xA1, 0x3D, 0x89, 0xD6, 0xD0, 0x0C, 0xF6, 0xA6, 0x35, 0x86, 0x85, 0xBC, 0x60, 0xD4, 0x2B,
+    0xDD, 0xA6, 0x8A, 0x37, 0x61, 0x6F, 0xC2, 0xCA, 0xC3, 0x36, 0x23, 0x7D, 0x16, 0x2D, 0xD7, 0x5B,
+    0xA0, 0x01, 0x96, 0xC9, 0x16, 0x25, 0x88, 0xD0, 0xCE, 0xB7, 0xED, 0x27, 0xDA, 0xDB, 0x3A, 0x09,
+    0x2F, 0x4E, 0x76, 0x92, 0x2D, 0xB3, 0xB0, 0x92, 0x4D, 0xB3, 0x30, 0x92, 0xD3, 0x60, 0xE9, 0x31,
+    0x2C, 0x89, 0xE6, 0xE4, 0x82, 0x1F, 0x93, 0xB1, 0xD6, 0x3F, 0x35, 0xD6, 0x85, 0x3D, 0x85, 0x0B,
+    0x25, 0x9C, 0x6C, 0x00, 0xF7, 0xF6, 0x80, 0xC3, 0x56, 0x6A, 0x33, 0x52, 0x69, 0x92, 0x08, 0x63,
+    0x1D, 0x85, 0x94, 0x71, 0x89, 0x3F, 0x2B, 0xC4, 0xA1, 0x55, 0xE2, 0x51, 0x87, 0x6B, 0x7B, 0x8B,
+    0x9D, 0xE9, 0x2E, 0xAB, 0x27, 0x02, 0xC1, 0xFD, 0x80, 0xDD, 0xFA, 0x47, 0x58, 0x92, 0xF5, 0x39,
+    0xD9, 0x1D, 0x2C, 0xD0, 0xB8, 0x4B, 0xE3, 0x10, 0xC7, 0x85, 0x13, 0xB1, 0xF9, 0x8B, 0x6B, 0x31,
+    0x23, 0xB3, 0xCE, 0x31, 0x97, 0x93, 0x18, 0x21, 0x62, 0x90, 0x9D, 0xB8, 0x47, 0xA3, 0xC2, 0x7D,
+    0x2B, 0x1A, 0x7E, 0x73, 0x79, 0x9E, 0xEA, 0xBD, 0x50, 0x70, 0x9A, 0x4A, 0x5E, 0x2C, 0xE5, 0x14,
+    0xAF, 0x9B, 0xF8, 0x50, 0x81, 0xDD, 0x81, 0xEC, 0x52, 0x07, 0x34, 0x7E, 0x39, 0xD5, 0xC8, 0xBA,
+    0x06, 0x1C, 0x1F, 0xBC, 0x94, 0x06, 0x80, 0x3F, 0xF1, 0xDE, 0x4E, 0xFC, 0x57, 0x68, 0xD8, 0xAB,
+    0x89, 0x7B, 0x86, 0xA5, 0xFD, 0x6A, 0xE4, 0x5E, 0x83, 0x2E, 0xCE, 0x3F, 0xC5, 0xF9, 0x3B, 0xF7,
+    0x7E, 0x37, 0xC5, 0xFE, 0x94, 0x8D, 0x0F, 0xCA, 0xF9, 0x57, 0xB4, 0x03, 0x22, 0x82, 0xCA, 0xC1,
+    0xB1, 0xEC, 0xB1, 0x38, 0x11, 0x1B, 0xD4, 0x90, 0x20, 0x0B, 0x4F, 0x85, 0x29, 0x7A, 0x02, 0x8F,
+    0x77, 0x3B, 0x0C, 0xBA, 0x4D, 0xD6, 0x37, 0x86, 0xFD, 0x55, 0x76, 0x0C, 0x5F, 0x28, 0x2D, 0x47,
+    0xDA, 0x27, 0xF5, 0x42, 0x6B, 0xCA, 0x66, 0x9B, 0xE5, 0xFC, 0x0C, 0xDA, 0xAC, 0x10, 0x3B, 0x3B,
+    0xB4, 0xF5, 0x25, 0x88, 0x80, 0x9E, 0x21, 0x21, 0x20, 0x88, 0x80, 0x00, 0x61, 0x06, 0xFC, 0xA9,
+    0xAB, 0x00, 0xAD, 0xD2, 0xD8, 0x1B, 0xAB, 0xDF, 0x94, 0x8C, 0xAF, 0x14, 0x92, 0x6C, 0xA0, 0x06,
+    0xED, 0x1D, 0xD0, 0xDE, 0xBE, 0xEA, 0xD0, 0xC0, 0x9B, 0xDC, 0xAC, 0x30, 0xE5, 0xBE, 0x4D, 0x68,
+    0xD6, 0xA8, 0x9D, 0xA8, 0x69, 0xF5, 0x1E, 0xC8, 0x42, 0xDD, 0x05, 0x9F, 0x63, 0xCE, 0x94, 0x8C,
+    0xA5, 0x22, 0x44, 0x51, 0xDC, 0x42, 0xA7, 0xB3, 0x09, 0xA3, 0x9F, 0x46, 0xD2, 0x1C, 0xD3, 0x43,
+    0xB0, 0x7C, 0x93, 0x55, 0x02, 0x61, 0x01, 0xEF, 0xEB, 0x2D, 0x1B, 0x8B, 0x78, 0xDC, 0xFE, 0x54,
+    0x36, 0x15, 0x00, 0x6E, 0x5A, 0x45, 0xC4, 0xAE, 0x22, 0xA6, 0x3B, 0xF5, 0xFA, 0xEB, 0x15, 0x42,
+    0xB3, 0x32, 0x80, 0x9D, 0xEE, 0x88, 0x2D, 0x36, 0x1A, 0x69, 0x6C, 0x81, 0x96, 0x74, 0xCB, 0xEC,
+    0x31, 0xB6, 0x95, 0x81, 0xF2, 0xE1, 0x5D, 0xF7, 0xB9, 0xCD, 0x53, 0xDB, 0xA0, 0x21, 0xEE, 0x6D,
+    0x43, 0x70, 0x0F, 0xAD, 0x68, 0x70, 0xF3, 0x6C, 0xEA, 0x4C, 0xDC, 0x5C, 0x7E, 0x3E, 0xDD, 0xC6,
+    0xB2, 0xFF, 0xE4, 0x2C, 0x1A, 0x54, 0xFE, 0x9B, 0xB1, 0x3D, 0xBC, 0xC5, 0x52, 0x3E, 0x61, 0x02,
+    0x96, 0x6C, 0x0F, 0x8B, 0xA6, 0x15, 0xF4, 0xE7, 0x4C, 0xED, 0x67, 0xED, 0x90, 0x12, 0x4D, 0x35,
+    0x3C, 0x8C, 0xFE, 0xE1, 0xE6, 0xCD, 0x52, 0xC2, 0x0F, 0xF5, 0x86, 0xF1, 0x10, 0xE7, 0x44, 0x90,
+    0x8F, 0xB0, 0x15, 0x4B, 0xD8, 0x78, 0xFB, 0x18, 0x7A, 0x5C, 0x6F, 0x3E, 0xB7, 0xEF, 0xA1, 0x6E,
+    0x9B, 0xC7, 0x58, 0x11, 0xC6, 0xDA, 0x62, 0x4F, 0x62, 0x18, 0x75, 0xBE, 0xCD, 0x60, 0x06, 0xE9,
+    0x1E, 0xFA, 0x01, 0xDA, 0xC7, 0x28, 0x1A, 0x76, 0x7D, 0x8B, 0x71, 0xEE, 0x53, 0x35, 0x97, 0x3D,
+    0x2C, 0x96, 0xDA, 0x9D, 0xB5, 0xB9, 0xDB, 0xFB, 0x59, 0xB7, 0x69, 0x73, 0x6D, 0x32, 0x08, 0xC5,
+    0x96, 0x16, 0xB5, 0x74, 0xF4, 0xEF, 0x3D, 0x6C, 0x84, 0x3E, 0x02, 0x6C, 0x1C, 0x92, 0xA9, 0xEE,
+    0x55, 0xAB, 0xBB, 0xB6, 0x3E, 0xB7, 0x45, 0xC4, 0x8F, 0x24, 0x04, 0x64, 0xF4, 0xD6, 0xD7, 0x55,
+    0x6F, 0x9F, 0xEE, 0x0C, 0x22, 0x5B, 0xD9, 0xA3, 0x78, 0xBE, 0xC5, 0x37, 0xB8, 0x3B, 0x85, 0xC0,
+    0x01, 0x60, 0xB6, 0x44, 0x92, 0xC3, 0xFD, 0x53, 0x3A, 0x39, 0x7A, 0x4F, 0x4E, 0x4E, 0xDE, 0x93,
+    0xC5, 0x7B, 0x0F, 0x23, 0xA2, 0x0A, 0x8A, 0xAA, 0xDE, 0xBA, 0xE2, 0xF5, 0x5B, 0xD9, 0xF8, 0xAC,
+    0x32, 0x47, 0xF1, 0xC0, 0x4E, 0xFD, 0x43, 0x28, 0x03, 0x0A, 0x14, 0xE9, 0x77, 0xC2, 0x0D, 0xA6,
+    0xA7, 0xB8, 0x69, 0x13, 0xD8, 0xD1, 0xB8, 0xA1, 0x58, 0x1C, 0x19, 0xF6, 0x40, 0xDF, 0x11, 0x6C,
+    0x5B, 0xA7, 0x76, 0x5D, 0x63, 0x63, 0x6D, 0x14, 0x88, 0x7D, 0xC4, 0xAB, 0xA6, 0x1C, 0x66, 0xC9,
+    0xBC, 0x1B, 0x3B, 0x91, 0xDE, 0xE2, 0x1D, 0x34, 0x66, 0xEE, 0xD4, 0xAC, 0xE6, 0xA6, 0x8E, 0x99,
+    0x6A, 0x86, 0xFA, 0xDB, 0x07, 0x66, 0x68, 0x09, 0x42, 0x1E, 0xBC, 0x84, 0xBA, 0xB4, 0x4C, 0xBB,
+    0x4F, 0x51, 0xAD, 0xE3, 0x4F, 0x9C, 0x17, 0x5F, 0x77, 0x7B, 0xE6, 0x77, 0x7F, 0x0A, 0x22, 0x6D,
+    0xA8, 0xCB, 0x24, 0xF5, 0xA8, 0x9A, 0x33, 0x9D, 0x23, 0x17, 0x9C, 0x4A, 0x1E, 0xF6, 0x46, 0xF7,
+    0x62, 0xE6, 0x5E, 0xDA, 0x3B, 0xD8, 0x9A, 0x9F, 0xEE, 0xB3, 0x5A, 0x71, 0xA7, 0x62, 0xB1, 0xC5,
+    0xD3, 0xDB, 0x32, 0xDD, 0x0A, 0x6E, 0x91, 0x11, 0x40, 0x6E, 0xF1, 0x60, 0xA5, 0x66, 0xBA, 0x97,
+    0x0B, 0x45, 0x8E, 0x85, 0xD6, 0x6E, 0x8B, 0x1C, 0xD6, 0x3C, 0xE1, 0x9A, 0x59, 0x9E, 0x18, 0xDA,
+    0x8F, 0xD1, 0xFC, 0x36, 0x1F, 0x08, 0x8A, 0xEB, 0xE8, 0xC4, 0xB9, 0x38, 0x42, 0xE7, 0xE3, 0xDF,
+    0xAA, 0x73, 0x4C, 0x6B, 0x8D, 0x4C, 0x00, 0x1E, 0xF1, 0xA6, 0x46, 0x64, 0xC2, 0x30, 0xDC, 0xFB,
+    0xE3, 0x42, 0x84, 0x30, 0xF3, 0x47, 0xBD, 0xE8, 0xE7, 0x22, 0x44, 0x5D, 0xA8, 0xBC, 0x14, 0x48,
+    0x1A, 0x66, 0x5E, 0xC5, 0xF9, 0x38, 0x1B, 0xF7, 0x00, 0x00, 0x0B, 0xCC, 0x34, 0xE4, 0x3C, 0xDD,
+    0x96, 0xE5, 0x0F, 0x67, 0x84, 0x0D, 0xF8, 0x2B, 0x88, 0x20, 0x31, 0xC8, 0x65, 0xE3, 0x7A, 0x8B,
+    0x13, 0x6E, 0xC4, 0xE3, 0x11, 0x1E, 0x9B, 0x75, 0xF5, 0xB1, 0x9A, 0x89, 0x0A, 0x34, 0xA7, 0x6E,
+    0x7B, 0xAC, 0x06, 0xDC, 0xC9, 0x18, 0xE5, 0xF6, 0xF5, 0x50, 0x31, 0xBE, 0x99, 0x6B, 0x6F, 0x50,
+    0xA7, 0x8D, 0xCF, 0xA9, 0xD3, 0x57, 0x04, 0xB0, 0xEA, 0xB1, 0x00, 0xCC, 0xBA, 0x0B, 0x00, 0xB3,
+    0xBE, 0xA9, 0xD9, 0x91, 0x1C, 0xBA, 0x7F, 0x04, 0xC0, 0xE4, 0xBA, 0x76, 0xD1, 0x73, 0x51, 0x5F,
+    0xD9, 0xF5, 0xB7, 0x93, 0x03, 0xE3, 0x4E, 0xEF, 0xBE, 0xB8, 0x73, 0x07, 0xE1, 0x5B, 0x7F, 0x0C,
+    0xD9, 0x87, 0xAC, 0x07, 0x85, 0x1D, 0x7B, 0x40, 0x64, 0xAD, 0x82, 0xE5, 0x95, 0xFF, 0x39, 0x36,
+    0x93, 0x77, 0xDC, 0xD4, 0xAC, 0x6C, 0xEE, 0xE6, 0x34, 0x2A, 0x98, 0xED, 0xB9, 0xD0, 0x7D, 0xA9,
+    0x68, 0xBA, 0x90, 0x00, 0xAB, 0x32, 0x51, 0x30, 0xDE, 0xCD, 0x3B, 0x06, 0x82, 0x15, 0x1F, 0x02,
+    0x58, 0x80, 0xF2, 0x32, 0xD1, 0x07, 0x39, 0xE8, 0xA0, 0x8C, 0xF2, 0xC7, 0x32, 0xB8, 0x24, 0x83,
+    0xCB, 0x52, 0xF6, 0x96, 0x72, 0x0F, 0xBB, 0xE6, 0xA6, 0x7A, 0x64, 0xAC, 0xAB, 0x08, 0x77, 0x6F,
+    0x84, 0x0D, 0x9B, 0x6E, 0x5D, 0xBE, 0xFB, 0x83, 0x05, 0xED, 0xC1, 0x33, 0x19, 0x00, 0xFC, 0xC4,
+    0xF9, 0x23, 0x17, 0x90, 0xC1, 0xCE, 0xF8, 0x91, 0xA1, 0x61, 0x48, 0xED, 0xC7, 0xD0, 0x89, 0x87,
+    0x74, 0xF5, 0x0E, 0xEA, 0x65, 0x50, 0x21, 0x56, 0x0C, 0x58, 0xBE, 0xFF, 0xD7, 0xA5, 0x7E, 0x14,
+    0x97, 0x4B, 0xB5, 0x42, 0xC9, 0xDC, 0xE2, 0x19, 0xC9, 0x26, 0xE7, 0xDD, 0xE5, 0x63, 0xD0, 0x15,
+    0x2D, 0x1C, 0xDA, 0x09, 0x4B, 0x33, 0x8C, 0xDE, 0x76, 0x88, 0xD1, 0x47, 0x09, 0xD2, 0xC7, 0x69,
+    0xCB, 0x37, 0x45, 0x6F, 0x89, 0x16, 0xEA, 0x49, 0xFF, 0x82, 0x9C, 0x37, 0x29, 0xD1, 0xC8, 0x91,
+    0x3B, 0x7A, 0x93, 0xDC, 0x61, 0x4B, 0x5C, 0xA1, 0x2D, 0xB2, 0x53, 0x7B, 0xA8, 0xC5, 0x3B, 0x5D,
+    0x3D, 0xC1, 0x51, 0x1F, 0x53, 0x98, 0xC5, 0x33, 0x9E, 0x42, 0x95, 0x2B, 0x57, 0xDD, 0xB7, 0x39,
+    0xCD, 0x29, 0x87, 0xDD, 0xCA, 0xE0, 0xB4, 0xFD, 0x31, 0xE7, 0xDB, 0xB5, 0xBE, 0x60, 0x65, 0xC8,
+    0x4C, 0x36, 0x67, 0x7E, 0x62, 0xB0, 0x6B, 0x41, 0xC9, 0x67, 0x07, 0xE3, 0x2A, 0x9E, 0x46, 0x9F,
+    0xE8, 0x03, 0x45, 0xFC, 0xC9, 0xF2, 0x84, 0x47, 0x17, 0x19, 0xD5, 0x04, 0x32, 0xF7, 0xA8, 0xA6,
+    0xFF, 0x2B, 0x0E, 0x2A, 0x66, 0xCE, 0xE7, 0x5F, 0xEE, 0x80, 0xA7, 0x45, 0x2C, 0x32, 0x9B, 0x3C,
+    0xB2, 0xCA, 0x78, 0x24, 0x94, 0xB2, 0x8B, 0x6B, 0x76, 0x58, 0x48, 0xA1, 0xFE, 0x85, 0xA5, 0xBE,
+    0x9A, 0xDA, 0x63, 0x40, 0x7B, 0x5C, 0xA2, 0x3D, 0x88, 0x8C, 0x70, 0x1C, 0x2C, 0x38, 0xB5, 0xC7,
+    0xB6, 0x0D, 0xFD, 0xBA, 0x7A, 0x22, 0x97, 0x92, 0x7F, 0x4D, 0xF6, 0x2F, 0x02, 0x5E, 0x39, 0x9D,
+    0x8D, 0x21, 0xD3, 0xEC, 0x9A, 0xF8, 0x80, 0x3E, 0x65, 0xA4, 0xD6, 0x4D, 0xA5, 0x7B, 0x8A, 0x6B,
+    0x08, 0xCE, 0x11, 0x97, 0xFB, 0x7D, 0xF6, 0x3B, 0x30, 0xD0, 0x50, 0x4E, 0x23, 0xE1, 0x8E, 0x51,
+    0x5F, 0x27, 0x6D, 0x7B, 0x1B, 0xD1, 0xDB, 0x69, 0xF6, 0x6C, 0xFA, 0x76, 0x66, 0xEA, 0xBA, 0x8E,
+    0xA0, 0x97, 0xB8, 0x1F, 0xF3, 0x3C, 0x06, 0x03, 0x9E, 0x04, 0x5D, 0x69, 0xCE, 0x2A, 0x39, 0x9D,
+    0xAD, 0xE6, 0x47, 0x6D, 0xDF, 0x03, 0x1E, 0x40, 0xBF, 0x3E, 0xF4, 0xD3, 0x0D, 0x23, 0xFF, 0xC6,
+    0xEB, 0x3C, 0x7B, 0x7D, 0x7D, 0x5C, 0xD1, 0xBE, 0x9C, 0x68, 0xFE, 0x6F, 0x00, 0x87, 0x5D, 0xA0,
+    0xC8, 0xB9, 0x1F, 0xD8, 0xD1, 0xE5, 0xE3, 0x46, 0x72, 0xCA, 0x8A, 0x3A, 0x76, 0x14, 0xBE, 0x9A,
+    0x87, 0xD7, 0xCA, 0xE0, 0x4C, 0x71, 0x58, 0x94, 0x13, 0x5D, 0xF2, 0x3E, 0xAA, 0xBC, 0xCF, 0xC6,
+    0x76, 0x36, 0x34, 0xD2, 0x55, 0x33, 0xE9, 0x38, 0x6A, 0xB7, 0xC3, 0x92, 0x2A, 0xCF, 0xC9, 0xD3,
+    0x78, 0xC7, 0xFC, 0xB7, 0x01, 0x80, 0x37, 0x04, 0xEF, 0xE9, 0xE3, 0xD0, 0xF9, 0x82, 0x9E, 0x54,
+    0xD8, 0x70, 0x98, 0x98, 0xB9, 0xEB, 0xFD, 0xF9, 0x83, 0x52, 0x2E, 0xBB, 0x67, 0x55, 0x21, 0xC5,
+    0x61, 0xB4, 0x71, 0xA8, 0xEB, 0xBE, 0xB4, 0xFC, 0xE4, 0xE8, 0x62, 0xDD, 0x47, 0x57, 0x70, 0xB1,
+    0xFE, 0x72, 0xDF, 0xFD, 0xC7, 0xE3, 0xA6, 0xDE, 0xD0, 0xD9, 0x63, 0x6C, 0x01, 0xE0, 0xA9, 0x6B,
+    0xDA, 0x14, 0x6F, 0x20, 0x9F, 0x5D, 0xEE, 0xBF, 0xBA, 0xEC, 0x3D, 0x2B, 0x3A, 0xAA, 0x94, 0x9F,
+    0xE8, 0xE6, 0xA2, 0x61, 0x27, 0x47, 0x7D, 0x6A, 0x00, 0x27, 0x69, 0x21, 0x8F, 0xCE, 0xF4, 0xAC,
+    0x2C, 0x17, 0x28, 0x16, 0x57, 0x59, 0x04, 0xD7, 0xB9, 0x33, 0xA0, 0xC3, 0xF5, 0x94, 0x83, 0x66,
+    0xCA, 0xC5, 0x27, 0xD0, 0x09, 0x81, 0x4D, 0x2E, 0xF8, 0xFF, 0xE3, 0x94, 0x46, 0x3C, 0x9D, 0x52,
+    0x64, 0xE9, 0x7D, 0x7D, 0x62, 0xD9, 0xEC, 0x9B, 0xBB, 0xDE, 0x99, 0x8C, 0xA9, 0x0E, 0xAB, 0x27,
+    0xCC, 0xB6, 0xE2, 0xB0, 0xAB, 0xCC, 0x88, 0xCF, 0xB2, 0x8D, 0x6E, 0xAD, 0xA5, 0x97, 0x1E, 0x23,
+    0x48, 0xF4, 0xEA, 0xBF, 0xBC, 0x98, 0xB7, 0xB2, 0xBF, 0xFF, 0xAB, 0x56, 0x17, 0x69, 0xA1, 0x3D,
+    0xB3, 0x3C, 0xD6, 0xBE, 0x41, 0x12, 0xEB, 0x0D, 0xFE, 0xE1, 0xD7, 0x1A, 0xBD, 0x63, 0x76, 0x78,
+    0x6B, 0x8B, 0x7A, 0xE7, 0xAD, 0xDE, 0x79, 0xA3, 0xF7, 0x82, 0x3C, 0xAD, 0xF7, 0xCB, 0x79, 0xA3,
+    0xF7, 0xCB, 0xFF, 0x7F, 0xBD, 0xFF, 0x03, 0xAD, 0x54, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x7D, 0xE4,
+    0x22, 0x26, 0xA2, 0x05, 0x44, 0x37, 0x46, 0x00, 0x27, 0x3A, 0xF6, 0x02, 0xE1, 0x6B, 0x52, 0xA8,
+    0xE0, 0x1D, 0x89, 0xA4, 0x48, 0x99, 0x14, 0x72, 0x65, 0x03, 0xE9, 0x53, 0x44, 0xCD, 0x15, 0x2E,
+    0x24, 0x1F, 0xBB, 0x14, 0x69, 0xFC, 0x0F, 0xE2, 0x42, 0x4D, 0xD4, 0xE4, 0x8A, 0x14, 0x29, 0x14,
+    0x71, 0x01, 0x97, 0x69, 0x98, 0x7F, 0xC0, 0x22, 0x2A, 0x62, 0xC3, 0xD0, 0x16, 0x2C, 0x28, 0x43,
+    0x77, 0x9B, 0x37, 0x43, 0x39, 0x4E, 0x0C, 0x39, 0x80, 0x81, 0x90, 0x3B, 0xB3, 0x5F, 0x33, 0xB3,
+    0xF3, 0xF1, 0x76, 0xE7, 0xD6, 0xCD, 0xAD, 0x9B, 0xB1, 0x25, 0xAE, 0x48, 0xEA, 0xDC, 0xB0, 0x55,
+    0xE0, 0x67, 0xD1, 0x61, 0x5B, 0x28, 0x6A, 0xB1, 0x13, 0x3B, 0xE4, 0xC6, 0xA1, 0x30, 0x2E, 0x0B,
+    0x61, 0xB3, 0x75, 0xF6, 0xD3, 0x9F, 0x58, 0x58, 0x60, 0x25, 0x94, 0x02, 0x7E, 0x1B, 0xE8, 0x76,
+    0xB0, 0xFB, 0xAA, 0x39, 0x5E, 0x86, 0x30, 0xC4, 0xAE, 0x80, 0x71, 0x7B, 0x30, 0xB5, 0xD0, 0x02,
+    0x49, 0xB5, 0xA2, 0x39, 0x0F, 0x8C, 0x76, 0x47, 0x5A, 0x0E, 0x30, 0xA1, 0x41, 0xFA, 0x7D, 0x56,
+    0x67, 0x36, 0xAD, 0xA7, 0xD6, 0x56, 0x53, 0xAE, 0x67, 0xBF, 0x71, 0x3B, 0x00, 0x71, 0xA8, 0x29,
+    0xD3, 0x73, 0xB2, 0x21, 0x2D, 0x6B, 0xD8, 0xD4, 0xE5, 0xD6, 0xBA, 0x43, 0x9B, 0xB8, 0x23, 0xF6,
+    0xA5, 0xA5, 0xDE, 0xC5, 0x19, 0xA2, 0xE6, 0xC9, 0x1B, 0x9B, 0x42, 0x11, 0xAE, 0xBF, 0x84, 0x8A,
+    0x1E, 0xD9, 0x97, 0x75, 0xD4, 0x61, 0x66, 0x1C, 0xDD, 0x3F, 0x34, 0x5D, 0x52, 0xE3, 0xD4, 0x74,
+    0x74, 0xF9, 0xD4, 0xF8, 0x89, 0xF2, 0x42, 0xF9, 0x23, 0xC8, 0xAE, 0xBF, 0x5B, 0x15, 0xE6, 0xF7,
+    0xEE, 0x95, 0x9F, 0x27, 0xCF, 0x9E, 0x75, 0x87, 0xE9, 0x0F, 0x5F, 0x7C, 0xE7, 0x66, 0xF1, 0x90,
+    0x32, 0x47, 0xC0, 0x84, 0x87, 0x02, 0x85, 0xF2, 0x47, 0xCA, 0xBD, 0xAC, 0x47, 0x5D, 0x42, 0x4E,
+    0xFB, 0x6D, 0x81, 0xA4, 0x8E, 0xFD, 0x2F, 0xA0, 0xF5, 0xA6, 0x13, 0x0F, 0x3E, 0x78, 0xED, 0x0A,
+    0x63, 0x65, 0x44, 0x97, 0x07, 0x4C, 0x2C, 0x0F, 0x77, 0xF4, 0xAD, 0x4D, 0xC8, 0xAD, 0x4B, 0x74,
+    0x6C, 0xC9, 0x8D, 0xCF, 0xB8, 0x1B, 0x0F, 0x47, 0x22, 0x1F, 0xBA, 0x68, 0x9F, 0xBC, 0x4E, 0xD7,
+    0xB0, 0x17, 0x2D, 0x15, 0xA6, 0x9F, 0xF7, 0x69, 0x85, 0xC7, 0xD1, 0x9A, 0xB6, 0xAF, 0xB0, 0xDC,
+    0x16, 0x9E, 0xBD, 0x14, 0x9E, 0x5C, 0x09, 0x8F, 0xC8, 0x7F, 0xA5, 0x06, 0x50, 0xC2, 0x5C, 0x38,
+    0x64, 0xE7, 0x07, 0xB6, 0x67, 0x0E, 0x87, 0x38, 0x54, 0xA3, 0x1B, 0xF3, 0xF9, 0x6C, 0x56, 0xE4,
+    0xF9, 0xE8, 0xCF, 0x8C, 0xC4, 0xB8, 0xF7, 0xF2, 0x09, 0x9A, 0x87, 0x0D, 0x3E, 0x0E, 0xCC, 0x73,
+    0x53, 0x61, 0x7A, 0x71, 0x89, 0xB3, 0x4F, 0x96, 0xF8, 0x34, 0xFF, 0x50, 0xF7, 0x55, 0x6E, 0x0B,
+    0xFF, 0xCE, 0x2F, 0xE9, 0xCE, 0xD7, 0xF7, 0xAB, 0x32, 0x84, 0x56, 0xFA, 0xB7, 0xF7, 0x94, 0x24,
+    0xFB, 0x3A, 0xA2, 0xA3, 0x3B, 0x40, 0x3E, 0x9E, 0x06, 0x2C, 0x08, 0x17, 0x29, 0x0A, 0x61, 0x45,
+    0x54, 0x11, 0x54, 0x2C, 0x8A, 0xA9, 0x89, 0x0F, 0x91, 0x4D, 0xDF, 0x21, 0xFE, 0xD5, 0xEB, 0x2C,
+    0xC6, 0x2D, 0x30, 0x75, 0x88, 0xD6, 0x44, 0x49, 0x3B, 0x76, 0x9D, 0x04, 0xAC, 0x53, 0x9D, 0x63,
+    0xDA, 0x4A, 0x0E, 0x65, 0x40, 0xF4, 0x18, 0x4E, 0x46, 0x6D, 0x71, 0x76, 0xF7, 0xE4, 0xA4, 0xC6,
+    0x3F, 0xBE, 0x3B, 0xF7, 0xAF, 0x83, 0x60, 0x7F, 0xFB, 0x3A, 0x56, 0xD1, 0x52, 0xF5, 0x92, 0x83,
+    0x44, 0x06, 0x4B, 0x16, 0xC5, 0xB6, 0xBA, 0x20, 0x1B, 0x14, 0x88, 0xC7, 0xE3, 0x55, 0xFE, 0xB6,
+    0x5A, 0xBA, 0x25, 0x10, 0xA4, 0xE8, 0xF3, 0x20, 0x71, 0xF7, 0x2A, 0x9F, 0xD1, 0x00, 0x93, 0x7A,
+    0xA4, 0x89, 0x8E, 0x7A, 0xEC, 0x63, 0xC2, 0xD2, 0xDB, 0x30, 0xA4, 0x48, 0x5C, 0x19, 0xF5, 0x16,
+    0x69, 0x75, 0x1A, 0x79, 0x5B, 0x65, 0x51, 0x1F, 0xFB, 0xA4, 0xBA, 0x17, 0x7B, 0xE9, 0x66, 0xA6,
+    0xA3, 0x14, 0xA4, 0x6B, 0x2D, 0x0A, 0x81, 0x49, 0x2A, 0x9D, 0x75, 0x3B, 0xBC, 0x7C, 0x84, 0x4E,
+    0xC1, 0x3D, 0x7F, 0xAF, 0xFD, 0x19, 0x73, 0x04, 0x1F, 0x5A, 0x4C, 0x71, 0xB7, 0xDE, 0xD5, 0xDC,
+    0xE9, 0xDD, 0x72, 0xDA, 0x99, 0x6E, 0xC4, 0x1E, 0x3D, 0xFD, 0x56, 0xA2, 0x3A, 0x7F, 0x20, 0x77,
+    0x2F, 0x0E, 0x9B, 0x37, 0xD1, 0x2F, 0x83, 0x9B, 0x86, 0x2A, 0xDB, 0x54, 0x1F, 0x5D, 0xC2, 0xF4,
+    0x52, 0x13, 0xA3, 0x65, 0xF9, 0xBF, 0x78, 0xDC, 0xF3, 0x62, 0x20, 0x1A, 0xB4, 0x68, 0x1B, 0x75,
+    0xAC, 0x3C, 0x6F, 0xC4, 0xC5, 0x30, 0x68, 0xF6, 0xD5, 0x8B, 0x72, 0x5D, 0x56, 0x25, 0xDE, 0xE3,
+    0xFF, 0x63, 0xF7, 0x47, 0x28, 0x80, 0x56, 0x8A, 0x8E, 0x3D, 0x45, 0x4A, 0xAE, 0xA8, 0xD9, 0x56,
+    0xC0, 0x11, 0x76, 0x7C, 0xBE, 0x88, 0x29, 0x82, 0x8B, 0x10, 0xA3, 0x27, 0xEF, 0x94, 0x4E, 0x55,
+    0x21, 0x96, 0xEB, 0x36, 0x98, 0x21, 0x7A, 0x8F, 0xFF, 0xC1, 0x70, 0x72, 0x8C, 0x5B, 0x54, 0xE4,
+    0x9D, 0xD4, 0x4A, 0xCF, 0x19, 0xDE, 0x42, 0x8E, 0x5A, 0xF1, 0x50, 0xBE, 0x79, 0x4E, 0x9E, 0x82,
+    0x09, 0x4F, 0x48, 0x79, 0x10, 0x1F, 0x55, 0x5D, 0x91, 0x4C, 0x00, 0x84, 0xE1, 0x31, 0x61, 0xA7,
+    0x49, 0xD8, 0xC7, 0x63, 0x64, 0x55, 0xE2, 0x98, 0x29, 0x45, 0x52, 0xE6, 0xB9, 0x80, 0xAB, 0x9B,
+    0xDA, 0x20, 0xB9, 0x4C, 0xBC, 0xE0, 0x91, 0xE0, 0x63, 0x76, 0xB9, 0x72, 0xB3, 0xE4, 0x29, 0xD3,
+    0xFA, 0x14, 0x5B, 0x4F, 0xB1, 0xFA, 0xAF, 0x8F, 0xA7, 0x35, 0x4E, 0x0C, 0x4A, 0xA1, 0x86, 0x1B,
+    0x9A, 0x98, 0xA2, 0x33, 0xD6, 0xA3, 0x7C, 0xF2, 0xB7, 0x03, 0x6F, 0x37, 0x3E, 0x31, 0x1E, 0x07,
+    0x1D, 0xBE, 0xE1, 0x05, 0xEE, 0xD0, 0x65, 0xEB, 0xA8, 0x2D, 0xB2, 0xCF, 0xDC, 0x9E, 0x79, 0xE1,
+    0x16, 0x68, 0xB4, 0xC4, 0x7F, 0x01, 0xCD, 0x5A, 0x3F, 0x6C, 0xDC, 0xE6, 0x15, 0x7F, 0x24, 0xAD,
+    0x63, 0x63, 0xC2, 0xA2, 0x03, 0xD8, 0x71, 0x1B, 0xC3, 0x66, 0x06, 0x0F, 0xAE, 0x2B, 0x99, 0x8B,
+    0x07, 0xA1, 0x3D, 0x89, 0x5F, 0xE2, 0xAD, 0x19, 0xEA, 0x21, 0x6A, 0x87, 0xA0, 0x88, 0x87, 0x0E,
+    0x45, 0x3A, 0xDC, 0xA2, 0x02, 0x46, 0xE0, 0xD3, 0xB1, 0xC9, 0xD0, 0x21, 0x40, 0x23, 0xA0, 0x48,
+    0x3A, 0x74, 0xA8, 0x87, 0x0C, 0x89, 0x82, 0x42, 0x02, 0x2A, 0x20, 0x06, 0x7A, 0xF2, 0x7D, 0x49,
+    0x86, 0x0C, 0x59, 0xD8, 0xA6, 0x5B, 0x51, 0x84, 0x05, 0x9C, 0x16, 0xB0, 0x0B, 0x98, 0x69, 0x2F,
+    0xE8, 0x49, 0xBE, 0x3B, 0xF6, 0xF7, 0x7B, 0xBC, 0xD3, 0x49, 0xAE, 0xF3, 0xC7, 0xAD, 0x1C, 0xFB,
+    0xC4, 0xF7, 0x78, 0xFC, 0x48, 0xBE, 0xF7, 0xBE, 0xF7, 0xBD, 0xBF, 0xDF, 0xE9, 0xC7, 0xC3, 0xE1,
+    0xA6, 0xC8, 0xA9, 0xB9, 0x7A, 0xBD, 0x7E, 0x99, 0x9F, 0xF6, 0xE6, 0xE6, 0xE6, 0xE0, 0x88, 0x1C,
+    0x14, 0x91, 0x00, 0xD0, 0x58, 0x11, 0xAF, 0x1C, 0x48, 0xF8, 0x41, 0x62, 0xE2, 0x20, 0x32, 0x0B,
+    0x41, 0x28, 0x4D, 0x8C, 0xB7, 0xEF, 0x80, 0x4D, 0xC0, 0x32, 0x20, 0x01, 0xC4, 0x2F, 0x7B, 0x26,
+    0xBC, 0xD5, 0x10, 0x17, 0xEF, 0x49, 0x74, 0xA1, 0xA2, 0x43, 0xE0, 0xA7, 0x35, 0x10, 0x77, 0xAB,
+    0x95, 0xFA, 0x59, 0x68, 0x43, 0xEB, 0xDB, 0x30, 0xC5, 0xB3, 0xA9, 0x08, 0x21, 0xB0, 0x22, 0x3E,
+    0x21, 0x17, 0xE9, 0x94, 0x3D, 0x71, 0xBA, 0x78, 0x9E, 0x70, 0x75, 0x04, 0x1B, 0x80, 0x42, 0xC4,
+    0xCD, 0xF0, 0x6C, 0xB9, 0xB2, 0x94, 0x94, 0x65, 0x71, 0xCE, 0x2D, 0xF1, 0xC6, 0x01, 0xFC, 0x89,
+    0x99, 0x8F, 0x5F, 0xB2, 0x61, 0x59, 0x1A, 0xDF, 0x9E, 0x95, 0x10, 0x0C, 0xA7, 0xC5, 0x37, 0x87,
+    0xC4, 0x33, 0x3C, 0xF3, 0x5A, 0xC7, 0x87, 0x25, 0x9E, 0xFB, 0xA5, 0x3D, 0x82, 0xE7, 0x3B, 0xFD,
+    0xA0, 0x94, 0x56, 0xB7, 0x86, 0xD9, 0x65, 0xE0, 0x03, 0xB6, 0x85, 0x78, 0x85, 0x93, 0x81, 0xB1,
+    0x07, 0xA2, 0x7D, 0xDF, 0x88, 0x34, 0x43, 0xF0, 0x5C, 0x38, 0x01, 0x14, 0xCD, 0x00, 0x85, 0x10,
+    0xC1, 0x2F, 0xCB, 0x5C, 0x9C, 0x67, 0x3F, 0xC5, 0xC4, 0x3C, 0x48, 0xEA, 0xBE, 0xB5, 0x4D, 0x15,
+    0x61, 0x4C, 0x2F, 0x2B, 0xE4, 0x17, 0x7C, 0x63, 0x0B, 0xA8, 0x2C, 0x31, 0xB3, 0xF5, 0xC9, 0xE7,
+    0xA2, 0x6A, 0xE1, 0xE2, 0xAE, 0x11, 0x5E, 0xBB, 0x65, 0x26, 0xE1, 0x6B, 0x3D, 0x39, 0x2B, 0x6D,
+    0xA9, 0xEB, 0xDF, 0x39, 0x99, 0xC7, 0x78, 0x0C, 0x11, 0x42, 0xA8, 0x20, 0x29, 0x8D, 0x2C, 0x75,
+    0x0A, 0x59, 0x0F, 0xFA, 0xD0, 0x42, 0x29, 0x9B, 0xB8, 0x93, 0xD8, 0xD0, 0x44, 0xBD, 0x10, 0xBC,
+    0x5F, 0x81, 0x5A, 0xFB, 0x60, 0x0A, 0xC0, 0x1D, 0x91, 0x59, 0x99, 0x91, 0x93, 0xA0, 0x71, 0x02,
+    0x34, 0x66, 0x24, 0xFE, 0xD9, 0x06, 0xD4, 0x05, 0x9D, 0x61, 0xCE, 0x3F, 0x3A, 0x28, 0xFD, 0x28,
+    0xED, 0x87, 0xE9, 0xA9, 0xDA, 0x68, 0x3D, 0xC0, 0x9A, 0x62, 0xC6, 0x1F, 0xAF, 0xE1, 0x09, 0xE8,
+    0xBC, 0x27, 0x1E, 0xBE, 0x9C, 0x95, 0xC0, 0x34, 0x7A, 0x81, 0x39, 0xE9, 0x76, 0x5B, 0x9E, 0x9D,
+    0xC1, 0x3A, 0x39, 0xD9, 0x5C, 0x68, 0x0E, 0x48, 0x7E, 0x2E, 0xE2, 0x22, 0x2C, 0x11, 0xAF, 0x2F,
+    0xC5, 0x8A, 0xF5, 0x7B, 0x35, 0x8E, 0x67, 0x44, 0xF2, 0x7A, 0x60, 0x5D, 0x27, 0x3B, 0xE9, 0x75,
+    0x23, 0xCF, 0x86, 0xD2, 0x01, 0x1D, 0xEA, 0x33, 0xD2, 0x05, 0x6D, 0x63, 0x32, 0xAF, 0x36, 0xA0,
+    0xA3, 0x5A, 0x39, 0x24, 0xFB, 0x29, 0xC0, 0xF1, 0x9E, 0x2C, 0xC4, 0x52, 0xC7, 0xBB, 0xA1, 0x39,
+    0x5E, 0x9A, 0x76, 0x68, 0x7A, 0x38, 0x22, 0x73, 0xAD, 0x93, 0xC6, 0x2F, 0xAE, 0xC8, 0x11, 0x47,
+    0x64, 0x69, 0x5A, 0x9C, 0xA2, 0x0E, 0xD9, 0x7A, 0x12, 0xBE, 0x54, 0xC0, 0xCC, 0x32, 0x49, 0xB0,
+    0x6A, 0x11, 0xBE, 0xFB, 0xB6, 0x2B, 0x6E, 0x7E, 0x19, 0x32, 0x60, 0x99, 0x30, 0xAF, 0xA3, 0x8B,
+    0x8B, 0x06, 0xA6, 0x91, 0x1D, 0x5D, 0xFC, 0x3E, 0x66, 0xE2, 0xDC, 0x05, 0xC4, 0xD0, 0x10, 0x4B,
+    0x83, 0x43, 0xE4, 0x8B, 0xF4, 0xF0, 0xDD, 0xD5, 0x15, 0xE8, 0xC1, 0xDF, 0x6E, 0x43, 0x0F, 0x4E,
+    0x11, 0x43, 0x0F, 0x4E, 0x11, 0x41, 0x0F, 0xC4, 0xC5, 0x92, 0x53, 0x9C, 0x85, 0x06, 0x9C, 0xDB,
+    0x5D, 0xE2, 0x7F, 0xE7, 0xD0, 0x83, 0x53, 0x74, 0xA1, 0x07, 0xA7, 0x68, 0x43, 0x0F, 0x4E, 0xB1,
+    0x00, 0x3D, 0xB8, 0x45, 0x74, 0xDE, 0x86, 0xD1, 0x30, 0xB8, 0xF9, 0x05, 0x7A, 0x80, 0xD4, 0x5D,
+    0x02, 0xDD, 0x65, 0x20, 0xF1, 0x9A, 0xB9, 0xEC, 0xD9, 0x0D, 0x97, 0xC7, 0x25, 0xCF, 0xCE, 0x07,
+    0x69, 0x54, 0x8A, 0xF3, 0xBA, 0xEC, 0xB8, 0xE6, 0x2E, 0x38, 0xFA, 0xDC, 0x68, 0xCE, 0x38, 0xDF,
+    0x79, 0x6F, 0xC7, 0xF5, 0xF0, 0x39, 0xB3, 0xBA, 0xBA, 0xC2, 0xE7, 0x68, 0x9D, 0x03, 0x69, 0x46,
+    0xE6, 0x6A, 0x68, 0x4F, 0x85, 0x96, 0xEE, 0x17, 0xD2, 0x6E, 0x64, 0x89, 0xDE, 0x15, 0x88, 0x9D,
+    0x75, 0x6C, 0xA7, 0xB4, 0xAB, 0xAB, 0x69, 0x65, 0xC7, 0xCD, 0x18, 0x4F, 0xA6, 0xA7, 0xF0, 0x18,
+    0xA4, 0xBF, 0x2A, 0xFE, 0x96, 0x7A, 0x6C, 0x60, 0x2F, 0xFA, 0xB6, 0x08, 0xED, 0x66, 0x0B, 0x86,
+    0x28, 0xCE, 0x85, 0x20, 0x8B, 0xCC, 0x3C, 0xEC, 0xD3, 0xC8, 0x37, 0xE5, 0x60, 0xBA, 0x20, 0xA1,
+    0xFD, 0xB2, 0x90, 0x48, 0x6C, 0x5B, 0xA6, 0x65, 0x5B, 0x37, 0xFE, 0x9E, 0xBF, 0x50, 0xBE, 0xD8,
+    0xBB, 0x04, 0x5B, 0xBD, 0x04, 0xD6, 0x58, 0x55, 0x69, 0x72, 0xB1, 0x20, 0x47, 0x92, 0x52, 0x77,
+    0xD5, 0x27, 0x28, 0xCB, 0x32, 0x29, 0x7F, 0x95, 0xB7, 0xCA, 0xF3, 0x90, 0xF3, 0xBC, 0x2D, 0x47,
+    0xD0, 0x19, 0x41, 0x02, 0x88, 0x00, 0xB5, 0xB5, 0xF3, 0x56, 0xFC, 0x7B, 0x84, 0xF0, 0x7C, 0x2E,
+    0xE5, 0xF9, 0x92, 0x7C, 0x0E, 0x48, 0x22, 0x89, 0x49, 0xCC, 0x23, 0xE2, 0x88, 0x2F, 0x41, 0x0E,
+    0xB3, 0x68, 0xCB, 0xD5, 0x33, 0xDD, 0x24, 0x93, 0x75, 0x3A, 0xF9, 0xB5, 0x42, 0x1E, 0x2D, 0x60,
+    0x99, 0x77, 0x39, 0x1E, 0xDB, 0x82, 0xB6, 0xD3, 0x60, 0x4B, 0x16, 0x9E, 0x33, 0x6D, 0xDF, 0xF6,
+    0x60, 0xBA, 0x5E, 0xAE, 0x47, 0x86, 0x4B, 0x0C, 0x42, 0x89, 0x87, 0xB1, 0xEA, 0x33, 0x08, 0x33,
+    0x21, 0x6C, 0x2D, 0x78, 0x87, 0xD1, 0xA7, 0x0D, 0xCB, 0x4B, 0x14, 0xBC, 0x62, 0x53, 0x4D, 0x3B,
+    0x7C, 0x2A, 0x97, 0x13, 0x5E, 0x2A, 0xEA, 0xB1, 0x08, 0x3F, 0xE0, 0xDB, 0x65, 0x18, 0xBC, 0xD6,
+    0xE5, 0x52, 0x3D, 0xDA, 0x15, 0xD8, 0x14, 0x0C, 0x2A, 0x30, 0xC4, 0x58, 0x44, 0xE0, 0x59, 0xC5,
+    0x75, 0xC5, 0x1B, 0x81, 0x05, 0x2E, 0x22, 0x60, 0x37, 0x4B, 0xEC, 0x63, 0x5B, 0x9E, 0xFD, 0xBD,
+    0x3D, 0xB3, 0xFA, 0xF2, 0x93, 0x1F, 0xC0, 0x14, 0x43, 0xEF, 0x65, 0xE0, 0xD9, 0x80, 0x91, 0xB7,
+    0x7E, 0xE2, 0xD9, 0x3F, 0x81, 0x41, 0x5C, 0x96, 0xA4, 0x8E, 0x11, 0x1A, 0x82, 0x25, 0xF5, 0x28,
+    0x27, 0xF5, 0xE7, 0xDF, 0x20, 0xF7, 0x9C, 0xDC, 0x5D, 0x4B, 0xEE, 0x90, 0x09, 0xDC, 0x03, 0xE5,
+    0x32, 0xAD, 0x78, 0x46, 0xF1, 0x9C, 0xE2, 0x75, 0xC5, 0x79, 0x27, 0x03, 0xDF, 0xF7, 0xFE, 0xDA,
+    0x43, 0x48, 0xFD, 0xB9, 0x6D, 0x3F, 0xB6, 0x15, 0x38, 0x69, 0xFB, 0xCC, 0xEA, 0x2F, 0xD4, 0xFE,
+    0x67, 0x34, 0xBA, 0xCF, 0x89, 0x93, 0xEB, 0xAC, 0x52, 0x52, 0x3F, 0x29, 0xA4, 0xBE, 0xF4, 0x08,
+    0xA8, 0xBB, 0xD9, 0x21, 0x06, 0x6D, 0x24, 0x91, 0x69, 0xA9, 0xAD, 0xBE, 0x59, 0x2D, 0x3C, 0x63,
+    0x6A, 0x4E, 0x73, 0x84, 0x74, 0xB0, 0x48, 0x48, 0x07, 0xA3, 0x84, 0x74, 0xB0, 0x0C, 0xCE, 0xFD,
+    0x2A, 0xE7, 0x0E, 0xC5, 0xD6, 0x19, 0xAB, 0x53, 0xE6, 0x8B, 0xC0, 0x16, 0xB1, 0x5C, 0xF4, 0xDF,
+    0xCD, 0x5A, 0x52, 0x84, 0xEF, 0x59, 0x84, 0xCE, 0xD6, 0xD3, 0x4F, 0xDD, 0x12, 0x04, 0x4E, 0x9F,
+    0xD1, 0x6B, 0x76, 0x9A, 0xB8, 0x3E, 0x43, 0xBC, 0xF1, 0xD3, 0x06, 0x62, 0x7A, 0xD1, 0x29, 0xFB,
+    0x9C, 0x3B, 0x46, 0x40, 0x1D, 0x18, 0xD4, 0x5B, 0x74, 0x0F, 0x67, 0xF5, 0x8A, 0x3C, 0x0E, 0x33,
+    0x34, 0x7A, 0x8C, 0x3D, 0xEA, 0x6B, 0x82, 0x30, 0x3B, 0x3A, 0x06, 0x12, 0x14, 0x12, 0xA7, 0xBC,
+    0x89, 0x30, 0xDC, 0xE7, 0x71, 0xA4, 0x2F, 0x67, 0x9B, 0x92, 0x24, 0x72, 0x2D, 0x40, 0x46, 0x7B,
+    0xDE, 0xC8, 0x94, 0x86, 0x9C, 0x80, 0x1E, 0x88, 0x25, 0x56, 0x12, 0x3D, 0xC5, 0x33, 0x52, 0x19,
+    0xDC, 0xE4, 0x73, 0xB6, 0x4A, 0x98, 0x8A, 0x3B, 0xFA, 0xDA, 0x2D, 0xBA, 0xA3, 0xF3, 0x91, 0xE5,
+    0xBB, 0xEF, 0x93, 0x84, 0xF7, 0x12, 0x49, 0x04, 0xE7, 0x89, 0x43, 0x87, 0x84, 0xA6, 0xC9, 0x17,
+    0xC4, 0x98, 0x07, 0xEA, 0xB2, 0x4C, 0xFF, 0x59, 0x24, 0x89, 0x4E, 0xC9, 0x60, 0x97, 0x4B, 0x94,
+    0x32, 0x04, 0x86, 0xBA, 0xB0, 0x90, 0x02, 0x8B, 0x08, 0x29, 0x02, 0xC5, 0x51, 0xC6, 0xB0, 0x83,
+    0xD9, 0xB7, 0x98, 0xB3, 0xE4, 0x19, 0x15, 0x91, 0xC1, 0x48, 0x7C, 0x15, 0x37, 0x54, 0x19, 0x66,
+    0x55, 0x9E, 0xC3, 0x0F, 0x8D, 0x9C, 0x47, 0x2B, 0xBE, 0x8A, 0x4B, 0xE5, 0xF8, 0x21, 0x33, 0x70,
+    0x60, 0x36, 0x54, 0x9D, 0x87, 0x1F, 0x12, 0x39, 0x1D, 0x65, 0x18, 0xF6, 0x0E, 0x51, 0x90, 0x0E,
+    0xAC, 0x5F, 0xE6, 0x42, 0xD5, 0xAD, 0x98, 0x87, 0x44, 0xC2, 0x9A, 0xB9, 0x42, 0x9A, 0xEF, 0x74,
+    0x77, 0xB0, 0x2B, 0x17, 0xE4, 0x8E, 0xCF, 0x83, 0x5D, 0xEB, 0xE7, 0x35, 0x51, 0xDF, 0x56, 0x5E,
+    0xA9, 0x16, 0x5B, 0xA6, 0xD8, 0xF9, 0xEE, 0xE8, 0xEA, 0x7F, 0x96, 0x6C, 0xEE, 0x2E, 0xD9, 0xFC,
+    0x7B, 0x91, 0xCD, 0x7E, 0x49, 0xD9, 0x10, 0x38, 0x99, 0x57, 0x8F, 0x95, 0x37, 0x58, 0x41, 0x78,
+    0x6B, 0x46, 0xCB, 0xD4, 0xD8, 0xB0, 0xE0, 0x98, 0x46, 0x1D, 0x07, 0x11, 0x67, 0x70, 0x02, 0xD1,
+    0xB9, 0x58, 0x85, 0x5B, 0xAF, 0x4E, 0xB9, 0x9E, 0x5C, 0x1B, 0xDF, 0x78, 0x93, 0x33, 0x89, 0x59,
+    0x34, 0x87, 0x5A, 0xF8, 0x49, 0xB4, 0xD8, 0x30, 0x55, 0x59, 0xC0, 0xD3, 0xA5, 0x6A, 0xB0, 0xD0,
+    0x13, 0xA8, 0xE2, 0x74, 0x8E, 0x11, 0x0A, 0x95, 0x21, 0xE4, 0xC1, 0x69, 0x23, 0xCE, 0xA4, 0xF5,
+    0xEA, 0x0F, 0xBA, 0x65, 0x1F, 0x25, 0x6A, 0xD9, 0x1D, 0x25, 0xCA, 0x5C, 0x5A, 0xAF, 0x0D, 0xDC,
+    0xAE, 0x74, 0x50, 0xDF, 0x26, 0x98, 0xC7, 0x6C, 0x94, 0x6A, 0x10, 0xD3, 0x10, 0x96, 0x8C, 0x14,
+    0x36, 0x86, 0xF1, 0x18, 0xEF, 0xC7, 0x2C, 0xCB, 0xA1, 0x3A, 0xC4, 0xB4, 0x9A, 0x87, 0x30, 0x26,
+    0xE5, 0xCD, 0xBE, 0x44, 0xAC, 0x73, 0x49, 0x7A, 0xC0, 0x62, 0x69, 0x14, 0x14, 0x00, 0x35, 0x38,
+    0xA0, 0xDF, 0xAB, 0x82, 0xC6, 0xE6, 0xE8, 0x16, 0xA4, 0xD2, 0x5A, 0x7D, 0x64, 0xE1, 0xD0, 0x68,
+    0xAF, 0xB1, 0xBD, 0xDA, 0x47, 0xDA, 0xBC, 0x0C, 0xED, 0xD5, 0x01, 0x33, 0x80, 0x03, 0x8C, 0x82,
+    0x3B, 0xB0, 0xBD, 0x9A, 0xA2, 0x96, 0x4E, 0xF7, 0x8C, 0x4D, 0x20, 0x00, 0x84, 0xD4, 0x7C, 0xF4,
+    0xE9, 0x22, 0xC8, 0x31, 0x55, 0x1D, 0x1D, 0x49, 0x0C, 0x8F, 0x72, 0x0A, 0x0D, 0xD9, 0x48, 0xD5,
+    0xF7, 0x8F, 0x9F, 0x73, 0x41, 0x15, 0x22, 0x21, 0xAC, 0x66, 0x7E, 0x01, 0x39, 0x03, 0xD9, 0xC1,
+    0x38, 0xF7, 0x8F, 0x1F, 0x0A, 0x76, 0xE9, 0x63, 0x6D, 0xFB, 0x91, 0x91, 0x8B, 0x53, 0x3B, 0x6E,
+    0x78, 0x3F, 0x78, 0x61, 0xE9, 0xAE, 0xE9, 0xC2, 0x05, 0xB6, 0xAA, 0x92, 0x2B, 0x46, 0xA6, 0x31,
+    0x60, 0xA5, 0xE3, 0xDD, 0xE3, 0x81, 0x44, 0xCD, 0xD6, 0x67, 0x4A, 0x57, 0xA7, 0x4D, 0xB3, 0x65,
+    0x9D, 0xB2, 0x1F, 0x34, 0xB1, 0x04, 0x58, 0x01, 0x2C, 0x00, 0xF4, 0x0F, 0xF5, 0x57, 0xDA, 0xFF,
+    0x3F, 0x69, 0x6A, 0x5F, 0x64, 0x70, 0x3C, 0x31, 0xB5, 0x3F, 0x13, 0xEF, 0x94, 0xDB, 0x46, 0x1A,
+    0xDB, 0x6B, 0x68, 0x2B, 0x0B, 0x67, 0xC8, 0xF1, 0x84, 0x0B, 0x11, 0x5A, 0x6A, 0x3E, 0xD7, 0x27,
+    0x89, 0xBA, 0x8A, 0xDE, 0xDA, 0x7E, 0xDD, 0xED, 0xA1, 0xE3, 0x75, 0x7B, 0xB8, 0x54, 0x34, 0xBA,
+    0x31, 0x7E, 0x4E, 0xDF, 0x08, 0x33, 0x8F, 0xD5, 0x05, 0x50, 0x47, 0xA2, 0x4F, 0x1B, 0x3D, 0xB0,
+    0x61, 0xDC, 0xA9, 0x12, 0x4B, 0xD0, 0x47, 0x09, 0x26, 0x27, 0x3B, 0xBF, 0x65, 0x30, 0x0B, 0x7A,
+    0x7B, 0x13, 0x4B, 0x27, 0x47, 0x74, 0x32, 0x8D, 0xAE, 0x1C, 0xDF, 0x62, 0x93, 0x08, 0x3F, 0xF1,
+    0x86, 0x8C, 0x6D, 0x5E, 0xC9, 0xB0, 0xE4, 0xFD, 0xC6, 0x12, 0xBF, 0x92, 0x13, 0x23, 0x3E, 0x02,
+    0xBF, 0xD8, 0x27, 0x4E, 0x07, 0x8A, 0x13, 0xC5, 0xB1, 0x25, 0x0E, 0x33, 0x62, 0xBF, 0x20, 0x76,
+    0x7B, 0xC4, 0x32, 0x50, 0xDC, 0x52, 0x1C, 0xE7, 0x5C, 0xE5, 0x10, 0x51, 0xF3, 0x3A, 0xDB, 0x69,
+    0x84, 0x32, 0x17, 0xE1, 0x42, 0x4B, 0x9E, 0xD0, 0x8E, 0x7B, 0x63, 0x0D, 0x1F, 0x5A, 0xA1, 0x4D,
+    0xAA, 0x9D, 0xE3, 0x0C, 0x2B, 0x9D, 0xD7, 0x06, 0xAC, 0x37, 0x62, 0x13, 0x30, 0xE0, 0x32, 0xE4,
+    0xE6, 0x31, 0x03, 0x2D, 0x82, 0x91, 0xDB, 0x85, 0x15, 0xB1, 0x2A, 0x16, 0xA7, 0xDF, 0xBA, 0x0B,
+    0x1A, 0xDF, 0x75, 0x7B, 0xF0, 0x15, 0xAF, 0xE0, 0xBB, 0x45, 0xC0, 0xFA, 0x55, 0xE9, 0xC9, 0x70,
+    0x91, 0x3B, 0x11, 0xE4, 0xC1, 0x26, 0x58, 0xD4, 0x8B, 0xAB, 0x1A, 0x8C, 0xFB, 0x0E, 0xB2, 0xC0,
+    0xB1, 0xA5, 0x3D, 0x79, 0xEE, 0x2B, 0x16, 0x48, 0xD1, 0x50, 0xBB, 0x50, 0x28, 0xCB, 0x7F, 0x9F,
+    0xB5, 0x39, 0xC3, 0xD9, 0xA4, 0x7E, 0xF9, 0x6A, 0x05, 0x52, 0xA3, 0x8A, 0x8B, 0xD3, 0x22, 0xDF,
+    0x1E, 0xB2, 0xE7, 0x88, 0x35, 0xC1, 0x3E, 0x18, 0xE5, 0x1C, 0x74, 0x56, 0x70, 0xC9, 0x94, 0xAD,
+    0x68, 0x4A, 0xD2, 0x07, 0xB8, 0x50, 0x6C, 0xC1, 0x42, 0x99, 0xC7, 0x5F, 0x68, 0xD0, 0x02, 0x7D,
+    0x08, 0x1B, 0xE2, 0x8A, 0xB1, 0x6E, 0xC0, 0x99, 0xD7, 0x1C, 0xE7, 0x7D, 0x3E, 0xB7, 0xBB, 0x4A,
+    0x86, 0x63, 0x1C, 0x2F, 0xFF, 0x4C, 0x59, 0x87, 0x94, 0x35, 0xA1, 0xAC, 0x09, 0x65, 0x7D, 0x9B,
+    0xB2, 0x7E, 0x08, 0x59, 0xBD, 0x77, 0x21, 0xAB, 0xFF, 0x24, 0xA4, 0x09, 0x29, 0xDC, 0x09, 0xA2,
+    0x39, 0xA2, 0x75, 0xA2, 0x1C, 0xB2, 0xBA, 0x16, 0xB2, 0xD2, 0xF3, 0xE2, 0xA7, 0x29, 0xEB, 0x5F,
+    0x28, 0x6B, 0x7F, 0x8F, 0xAC, 0xEE, 0x47, 0x25, 0x3D, 0xF1, 0xC8, 0x98, 0x6B, 0x15, 0x1D, 0xF6,
+    0x34, 0x1A, 0xEA, 0x79, 0xEC, 0x96, 0x76, 0x2F, 0x29, 0x6A, 0x18, 0x8B, 0x18, 0x11, 0x0D, 0xCD,
+    0xB1, 0x2D, 0x2D, 0xFA, 0x35, 0x96, 0xD1, 0xF3, 0xF7, 0x09, 0xA3, 0x02, 0x41, 0x9F, 0x87, 0x92,
+    0x8B, 0x15, 0xC1, 0x50, 0xF7, 0xFA, 0x92, 0x8F, 0x3B, 0x5A, 0xA1, 0xA8, 0x58, 0x55, 0x19, 0x5F,
+    0x35, 0x1D, 0xAE, 0x46, 0x88, 0x2A, 0x58, 0xA8, 0x83, 0xB2, 0xB9, 0xDA, 0xF3, 0x79, 0x38, 0xA4,
+    0xAD, 0x72, 0x45, 0x52, 0x95, 0x9D, 0x2A, 0x6D, 0xA1, 0xE5, 0xA8, 0xAD, 0xAB, 0x6A, 0x0F, 0x3C,
+    0x54, 0xD2, 0x3A, 0xE9, 0x69, 0x55, 0xEA, 0xA6, 0xE2, 0xB6, 0x8E, 0x9C, 0x7A, 0x18, 0xB5, 0xAA,
+    0x36, 0xA0, 0x7D, 0xA7, 0xB6, 0x9D, 0xDA, 0x75, 0xCE, 0xEE, 0xEE, 0x39, 0x13, 0xA4, 0xD7, 0x41,
+    0x34, 0x30, 0xCF, 0xF5, 0x3C, 0xEE, 0xD2, 0x39, 0x7D, 0xEE, 0x1D, 0x0C, 0x68, 0xD1, 0x09, 0xF7,
+    0x0F, 0x62, 0x53, 0x67, 0xBA, 0x59, 0xE2, 0x46, 0x32, 0x4B, 0x9D, 0x7F, 0xB2, 0x24, 0xBC, 0x4D,
+    0x33, 0xD2, 0x2D, 0x9D, 0xE5, 0xCF, 0x45, 0x2D, 0x6D, 0x24, 0x18, 0x70, 0x20, 0x52, 0x07, 0xF9,
+    0xB5, 0x31, 0x30, 0xBA, 0x9B, 0x5B, 0x55, 0x54, 0xAF, 0x73, 0xA7, 0x17, 0x79, 0xD8, 0x67, 0x6A,
+    0xEE, 0x03, 0x06, 0x80, 0xCD, 0x11, 0x0C, 0xAA, 0x31, 0x07, 0x09, 0xDC, 0x2F, 0xB4, 0xF2, 0xDA,
+    0xBE, 0xB0, 0x53, 0x71, 0x71, 0xE3, 0xA2, 0xD4, 0x0E, 0xE5, 0xB0, 0x4E, 0x18, 0x53, 0x5B, 0xE6,
+    0x3E, 0x60, 0x5F, 0x2E, 0x73, 0xA3, 0x64, 0x41, 0x5C, 0x94, 0x08, 0x44, 0xB1, 0x7C, 0xAB, 0x70,
+    0x3A, 0x40, 0xD1, 0x0D, 0x5C, 0x22, 0x35, 0xB9, 0xC5, 0xE5, 0x1D, 0xB4, 0x4C, 0x94, 0x64, 0x40,
+    0xA8, 0x7F, 0xDC, 0x02, 0xD9, 0x82, 0x6F, 0x58, 0xA0, 0x20, 0x73, 0x8B, 0x27, 0xBC, 0xDC, 0x2D,
+    0x0A, 0xA2, 0xAE, 0x97, 0x1D, 0x2B, 0x36, 0x23, 0xDB, 0x2A, 0xE2, 0x61, 0x55, 0x0A, 0x30, 0xE5,
+    0xA9, 0x5F, 0xF5, 0x47, 0x09, 0x2F, 0x98, 0xB8, 0xBF, 0x83, 0x02, 0x21, 0xDC, 0x46, 0x71, 0x8F,
+    0x5C, 0x1F, 0x9A, 0x58, 0x6A, 0xBA, 0xCF, 0x16, 0xB1, 0x07, 0x30, 0x0E, 0x0A, 0xA1, 0xE8, 0x7A,
+    0x6C, 0x12, 0x5C, 0x37, 0x01, 0xDC, 0x79, 0x6E, 0x22, 0x7A, 0x2D, 0xA3, 0xC5, 0x4A, 0x6E, 0xBE,
+    0x92, 0x05, 0xC3, 0xB0, 0xA8, 0xDA, 0xC4, 0x67, 0x2A, 0xE2, 0x90, 0x45, 0x77, 0xF1, 0xC3, 0x49,
+    0x7E, 0xDF, 0x17, 0xFA, 0x53, 0x23, 0x57, 0xA3, 0xA3, 0x7D, 0x52, 0xA8, 0x93, 0x8D, 0x5D, 0x6C,
+    0x5F, 0xE8, 0x73, 0x3B, 0x7F, 0xE8, 0x49, 0xB0, 0x76, 0x4B, 0x0E, 0xF9, 0x83, 0x1D, 0x73, 0xDB,
+    0x0F, 0xDA, 0x2E, 0x1C, 0xCD, 0xCF, 0x61, 0xA6, 0x70, 0x3B, 0xC7, 0x4C, 0x9C, 0x6E, 0x5F, 0xE4,
+    0x7E, 0x1C, 0x96, 0x7D, 0x8D, 0xEE, 0x35, 0x87, 0xAA, 0x7D, 0x0E, 0xE7, 0x4B, 0xC8, 0x31, 0xB8,
+    0x7E, 0xDC, 0xEC, 0x1B, 0x0F, 0xD0, 0x88, 0xBA, 0xA0, 0x32, 0x18, 0x76, 0x48, 0x07, 0x49, 0x12,
+    0x94, 0xAC, 0x9F, 0x81, 0x96, 0x55, 0xDB, 0xD6, 0x1E, 0x83, 0xA5, 0xA9, 0xC3, 0x4E, 0xA2, 0x00,
+    0xCD, 0x57, 0x17, 0x2F, 0x24, 0xCA, 0xA5, 0xC9, 0xEE, 0x9E, 0xBF, 0x57, 0x58, 0x7E, 0xE7, 0x02,
+    0x2E, 0xCB, 0xDB, 0x85, 0x93, 0x25, 0x37, 0xFF, 0x30, 0x5C, 0xB3, 0x41, 0x69, 0x5A, 0x43, 0xD5,
+    0xBD, 0xD1, 0x95, 0xF5, 0xB6, 0x87, 0xD5, 0x6E, 0x30, 0xFE, 0x12, 0x44, 0xFD, 0x85, 0xD1, 0xFE,
+    0xEF, 0x6E, 0x58, 0x18, 0x75, 0x7C, 0x90, 0x1F, 0xCF, 0xFA, 0xE2, 0x43, 0x2A, 0x87, 0x01, 0x84,
+    0x15, 0x70, 0x98, 0x55, 0x16, 0xA8, 0x45, 0x26, 0xCE, 0x6F, 0x01, 0x3A, 0x69, 0x65, 0xFD, 0xBD,
+    0xAA, 0x4D, 0xD4, 0xDE, 0xD4, 0xDF, 0xB5, 0xEB, 0xA2, 0x7C, 0xFB, 0x23, 0xBE, 0xAA, 0x27, 0xDD,
+    0x93, 0x5E, 0x06, 0xB4, 0xE0, 0xB2, 0xCB, 0x8B, 0x8B, 0x66, 0x79, 0x0F, 0x5F, 0x86, 0x17, 0xDF,
+    0xF8, 0xDB, 0x08, 0x5D, 0x9D, 0xDE, 0xC8, 0x8B, 0x3E, 0xDB, 0xFA, 0xF7, 0x85, 0xFE, 0xD8, 0xFA,
+    0x3B, 0x99, 0x38, 0x77, 0x58, 0xFF, 0x7E, 0xD0, 0x77, 0xD3, 0x1F, 0x55, 0x16, 0x9A, 0xF5, 0xF7,
+    0x58, 0xE8, 0x7E, 0xD0, 0x3E, 0xAA, 0xB7, 0x90, 0xC7, 0xD9, 0x9B, 0x17, 0x23, 0xBF, 0x3A, 0x73,
+    0x05, 0xE5, 0x25, 0x03, 0xA3, 0xFB, 0xF9, 0x47, 0x57, 0x8E, 0x0D, 0x98, 0x97, 0xD8, 0x44, 0xC0,
+    0x90, 0x16, 0xF8, 0x43, 0xA0, 0x93, 0x8F, 0x7F, 0xCD, 0xB8, 0x47, 0x22, 0xB0, 0x02, 0xBF, 0xCB,
+    0xCE, 0xF1, 0x6C, 0x2C, 0x97, 0xB8, 0xDF, 0x6C, 0xFE, 0x07, 0x22, 0xA7, 0x6A, 0xD2, 0x0E, 0xD3,
+    0xF6, 0xAE, 0x9F, 0xD0, 0xEE, 0x79, 0x2E, 0x2C, 0x71, 0x72, 0x5F, 0x9C, 0x21, 0x2C, 0x11, 0x8E,
+    0xA5, 0x70, 0x15, 0x96, 0xB9, 0x12, 0x57, 0x05, 0xCF, 0x4F, 0x7E, 0x6D, 0x99, 0x66, 0x42, 0x1B,
+    0xE5, 0x31, 0x92, 0x0F, 0x7F, 0x0B, 0x58, 0x00, 0x34, 0x41, 0x65, 0x0C, 0xCB, 0x9A, 0x1B, 0x3C,
+    0xDE, 0xCB, 0xA2, 0x34, 0xB0, 0xFE, 0xF5, 0x46, 0xE5, 0x04, 0x63, 0x63, 0xA9, 0xAA, 0xF7, 0x17,
+    0xFE, 0xBB, 0x7A, 0x3F, 0xB3, 0x02, 0x7F, 0x88, 0xFF, 0x55, 0xA2, 0x7A, 0xDD, 0x46, 0xEA, 0x74,
+    0xFB, 0x70, 0x4E, 0x57, 0x13, 0xD0, 0x28, 0x0B, 0x7D, 0x21, 0x42, 0xF1, 0xCA, 0x99, 0x24, 0x29,
+    0x12, 0x71, 0x52, 0xD0, 0xB5, 0x9C, 0xFE, 0xC8, 0x37, 0x19, 0x5B, 0xA8, 0xD8, 0x71, 0xEF, 0xD9,
+    0xB8, 0x3E, 0x72, 0xE9, 0x30, 0xC5, 0x4C, 0x32, 0x48, 0x9B, 0x53, 0xEA, 0xE5, 0x5D, 0x33, 0x69,
+    0x4E, 0x66, 0x52, 0xC4, 0xB8, 0x1F, 0xA6, 0x30, 0xA0, 0xEB, 0x2D, 0x23, 0x3B, 0xB3, 0x61, 0xAC,
+    0x62, 0xA9, 0x00, 0xDB, 0xE9, 0xB2, 0x76, 0x98, 0x9D, 0x98, 0xFE, 0x7E, 0xD0, 0xAF, 0x02, 0xBF,
+    0x61, 0xE0, 0x9F, 0xF6, 0x26, 0x81, 0x7F, 0x3F, 0x68, 0x3B, 0x2B, 0xA7, 0x75, 0xDD, 0x08, 0x32,
+    0x29, 0xCA, 0xF7, 0x47, 0xEE, 0xDA, 0xA8, 0x3A, 0x66, 0x7C, 0xAD, 0x4D, 0x48, 0x4F, 0x7E, 0xFE,
+    0x5C, 0x9C, 0xC4, 0xB8, 0xA9, 0x5D, 0xCF, 0x1E, 0xD4, 0x91, 0x5C, 0x1A, 0x7F, 0xB3, 0xDE, 0x76,
+    0x69, 0x2A, 0x19, 0x22, 0xC8, 0xF0, 0x1D, 0xC8, 0xF0, 0xBB, 0x62, 0xD9, 0xF9, 0x63, 0xD1, 0xF4,
+    0xDE, 0x2D, 0x9A, 0x01, 0x64, 0x98, 0x86, 0x0C, 0x75, 0xC8, 0xB0, 0x04, 0x19, 0x72, 0xC8, 0x80,
+    0x7E, 0x25, 0x80, 0x0C, 0x21, 0x64, 0x98, 0x19, 0x1B, 0x94, 0x4E, 0x2B, 0xD9, 0xA9, 0xD5, 0x3D,
+    0xB5, 0xEF, 0x62, 0x77, 0xC1, 0x76, 0xE6, 0xCA, 0xC1, 0x37, 0x60, 0x8F, 0xC1, 0x80, 0x4E, 0xB2,
+    0x49, 0xD4, 0xFC, 0x92, 0x68, 0x93, 0x26, 0x37, 0x40, 0xC9, 0xE8, 0x62, 0x61, 0xCA, 0x35, 0xFE,
+    0xF0, 0xD2, 0x87, 0x1D, 0x54, 0x5D, 0xCD, 0x64, 0x5F, 0x81, 0x7E, 0xA3, 0xBF, 0x15, 0x56, 0x7C,
+    0xCD, 0xFD, 0xE5, 0xCB, 0xAC, 0xEB, 0xD2, 0xE2, 0x7D, 0xD6, 0x56, 0xE1, 0xF7, 0x30, 0x38, 0xCF,
+    0x59, 0x1F, 0x1E, 0x33, 0xBE, 0x3F, 0x7C, 0xBF, 0xE1, 0x72, 0xE3, 0x96, 0x35, 0xB1, 0xA2, 0xAF,
+    0x3B, 0xBB, 0x52, 0xD8, 0x7D, 0x55, 0xB1, 0x6E, 0x3B, 0x37, 0xC7, 0x3B, 0x37, 0xBA, 0x35, 0xB8,
+    0xD3, 0x37, 0xAE, 0xBE, 0x51, 0x5B, 0x35, 0x9D, 0x5E, 0x0D, 0x76, 0x94, 0x21, 0xB9, 0xA2, 0xA7,
+    0xDD, 0x60, 0xE3, 0xC6, 0x80, 0xA7, 0xA5, 0xBE, 0xCB, 0x7F, 0xA4, 0xA0, 0x72, 0x9A, 0xCC, 0xB8,
+    0x0B, 0x2C, 0x3A, 0x63, 0xE6, 0xC6, 0xF0, 0x87, 0x44, 0xFF, 0x90, 0x6A, 0xD7, 0xB8, 0x2A, 0xF7,
+    0x35, 0x6F, 0xBB, 0xF9, 0xD8, 0x86, 0x98, 0x46, 0xAB, 0xEA, 0x9F, 0xD9, 0xE5, 0x18, 0x15, 0x9E,
+    0xAC, 0xEC, 0xE4, 0xA5, 0x62, 0xFC, 0x5F, 0x16, 0xDE, 0x5D, 0x11, 0x62, 0x9C, 0xA7, 0x31, 0x6E,
+    0x88, 0xD8, 0xE4, 0xF5, 0x51, 0x74, 0xB0, 0xE7, 0xE6, 0xDD, 0x78, 0x82, 0xCC, 0x5E, 0x34, 0x7A,
+    0xA4, 0x07, 0x7E, 0x88, 0x03, 0xD0, 0xE4, 0xED, 0x9B, 0xE8, 0x2F, 0x3E, 0x41, 0xA9, 0xEE, 0x15,
+    0x07, 0xEE, 0xCE, 0xE8, 0xF8, 0x56, 0xF5, 0x9F, 0x04, 0xC0, 0xA7, 0x6B, 0xFA, 0xEF, 0x22, 0x76,
+    0x84, 0x8E, 0xB8, 0xBB, 0x3B, 0xAB, 0x07, 0xA0, 0xA6, 0xFF, 0x00, 0xCD, 0x5B, 0xBF, 0x93, 0xDD,
+    0xD6, 0x75, 0x3E, 0x00, 0x76, 0x09, 0x9B, 0x98, 0x31, 0x58, 0x98, 0x23, 0x8F, 0x28, 0x12, 0x2E,
+    0x54, 0x31, 0x2B, 0x21, 0x85, 0x0B, 0x7A, 0x66, 0xB5, 0x40, 0x46, 0x7F, 0x80, 0xB7, 0xD0, 0xDA,
+    0x85, 0x27, 0x13, 0x17, 0x49, 0x93, 0x14, 0xAB, 0x62, 0x0B, 0x4E, 0x86, 0xFB, 0x1E, 0x22, 0x95,
+    0x29, 0xAC, 0x4A, 0x8D, 0x0B, 0xB3, 0x90, 0x67, 0xE8, 0xC7, 0x82, 0x2C, 0x58, 0x70, 0xE2, 0x5D,
+    0x02, 0x1E, 0x15, 0x2A, 0xD4, 0x60, 0xA2, 0xC9, 0xA4, 0x34, 0x62, 0x4B, 0x93, 0x49, 0x94, 0x89,
+    0x41, 0x0B, 0x8A, 0xB1, 0x8F, 0x78, 0x0F, 0xF9, 0xBE, 0x73, 0x81, 0xB7, 0x58, 0x51, 0x22, 0xB5,
+    0xDC, 0x7D, 0x2B, 0x3E, 0xBE, 0x7B, 0xDE, 0x12, 0xB8, 0x38, 0xF7, 0x9C, 0x73, 0xCF, 0x3D, 0xBF,
+    0xEE, 0x85, 0x9C, 0x9F, 0xBC, 0x27, 0x22, 0x7E, 0x5B, 0xC9, 0x17, 0x3E, 0xAF, 0x2A, 0x1C, 0x2B,
+    0x4C, 0x63, 0xC2, 0x3F, 0x26, 0x00, 0xD6, 0xEF, 0x32, 0x40, 0xE7, 0x83, 0x9C, 0xF0, 0xED, 0x12,
+    0xD0, 0x7B, 0x9D, 0xD0, 0xB7, 0x6A, 0xC0, 0xEF, 0x48, 0x03, 0xB8, 0x26, 0xFB, 0x80, 0xEB, 0x32,
+    0x02, 0xDC, 0xDD, 0x22, 0x8A, 0xB4, 0x6D, 0x81, 0xA2, 0x90, 0x20, 0x11, 0x2B, 0x17, 0x3F, 0x13,
+    0x27, 0x13, 0x2F, 0x17, 0x27, 0x11, 0xA7, 0x14, 0x4F, 0x61, 0x90, 0x8B, 0x37, 0x93, 0xB6, 0x91,
+    0x71, 0x9B, 0xD8, 0x93, 0x5B, 0xE2, 0xB6, 0xCD, 0x82, 0x16, 0x2B, 0x2D, 0xC4, 0x9F, 0x36, 0x78,
+    0x3C, 0x12, 0x3F, 0x0E, 0xE5, 0x9C, 0x04, 0xB8, 0x1A, 0x00, 0x65, 0x18, 0x5B, 0x69, 0x1B, 0x07,
+    0x1F, 0x87, 0x71, 0x84, 0xFF, 0xEF, 0xA2, 0xED, 0xE3, 0xDA, 0xAE, 0x44, 0xF1, 0x08, 0x54, 0x47,
+    0x9F, 0xFE, 0x3C, 0xF7, 0xE6, 0x7E, 0x29, 0x9B, 0xE8, 0xFE, 0x6D, 0xF9, 0x3E, 0xA9, 0x95, 0xBB,
+    0x80, 0xEE, 0xA3, 0x82, 0x68, 0x5B, 0xF2, 0x22, 0xDF, 0x7D, 0x5E, 0xB8, 0x8E, 0xBF, 0x85, 0x1E,
+    0xEB, 0x62, 0x4D, 0x81, 0x14, 0x1C, 0xCB, 0xEA, 0x29, 0x72, 0xFF, 0x8D, 0x72, 0xC6, 0x71, 0x28,
+    0x70, 0x71, 0xF9, 0xA7, 0xF8, 0x4A, 0x44, 0x60, 0xA0, 0x92, 0xE2, 0xB7, 0x84, 0xF6, 0xFC, 0x14,
+    0x78, 0xBD, 0x86, 0xB1, 0xC0, 0x80, 0x03, 0x86, 0x40, 0x94, 0x38, 0x18, 0xD7, 0xE1, 0x3C, 0xA7,
+    0x18, 0xDA, 0x82, 0x24, 0x3C, 0x5C, 0xF0, 0x13, 0x23, 0x8F, 0xEB, 0x87, 0x13, 0xEF, 0xB5, 0x85,
+    0x8C, 0xDF, 0x9D, 0xD9, 0x95, 0xA4, 0x6E, 0x21, 0x11, 0x58, 0x7A, 0x05, 0xCC, 0x01, 0x3B, 0x9A,
+    0x98, 0x36, 0x1E, 0xB4, 0xFE, 0x1A, 0xEF, 0x87, 0xE8, 0x87, 0xFE, 0xE2, 0x95, 0x72, 0xCE, 0x69,
+    0x80, 0xB8, 0xFD, 0x14, 0x0C, 0x00, 0x9F, 0x6A, 0xD6, 0x1B, 0x18, 0x16, 0x42, 0x84, 0x44, 0xC4,
+    0xCD, 0x28, 0x51, 0x91, 0x95, 0x6E, 0xCC, 0x71, 0x21, 0xCE, 0x74, 0x8E, 0x67, 0x23, 0x09, 0xF1,
+    0x2F, 0x92, 0xCB, 0xB2, 0x41, 0x11, 0x7F, 0xA1, 0x6D, 0x74, 0x63, 0x41, 0x02, 0xE8, 0xEB, 0x8A,
+    0x3B, 0x4F, 0xA1, 0xBA, 0x75, 0xA7, 0x1F, 0x1C, 0x63, 0x0E, 0xD9, 0x61, 0x42, 0xDC, 0x0F, 0x32,
+    0xCC, 0x5B, 0x09, 0xFC, 0x17, 0x96, 0xCA, 0xD3, 0x2A, 0x3B, 0x64, 0x4A, 0xBF, 0x54, 0x95, 0xD8,
+    0xF9, 0x9A, 0x58, 0x3D, 0x53, 0xA7, 0xC2, 0x93, 0x74, 0xBD, 0x1E, 0xA0, 0xED, 0x1F, 0x5D, 0xA1,
+    0x4B, 0x9B, 0x27, 0x31, 0x6A, 0x11, 0x64, 0xA6, 0xD3, 0xEA, 0xC0, 0x28, 0x9C, 0x06, 0x4F, 0x17,
+    0xF0, 0xEF, 0x8A, 0x8D, 0x35, 0xF1, 0xCF, 0x58, 0x1D, 0xD0, 0x76, 0x6B, 0x66, 0x74, 0x63, 0x89,
+    0x3C, 0x71, 0x4E, 0xEC, 0x7C, 0x5D, 0xE7, 0x48, 0xE7, 0x2A, 0x1C, 0xF0, 0x75, 0x3A, 0x3C, 0x81,
+    0x82, 0xEB, 0x5C, 0xD3, 0x61, 0x48, 0xF1, 0xD1, 0x56, 0x38, 0x34, 0x1B, 0xD6, 0x66, 0x37, 0x4A,
+    0xDA, 0x4E, 0x63, 0xD9, 0x9E, 0xDE, 0xA9, 0xC4, 0x2D, 0xAD, 0x39, 0x17, 0x41, 0x94, 0x00, 0xF8,
+    0x19, 0xCD, 0x44, 0x01, 0xE0, 0x94, 0x04, 0x55, 0x0F, 0xEC, 0xFA, 0x08, 0x38, 0xBC, 0xA1, 0xFD,
+    0xF4, 0x09, 0x3F, 0x07, 0x08, 0x89, 0x25, 0x95, 0xE0, 0xF3, 0xED, 0x5A, 0xDA, 0x56, 0x0D, 0x8C,
+    0x19, 0xAF, 0xAC, 0x29, 0x0B, 0xAE, 0xFF, 0x87, 0x5C, 0xF8, 0x0F, 0x69, 0x01, 0x1E, 0xC6, 0x66,
+    0xF9, 0xA5, 0x30, 0x6F, 0x6E, 0xFB, 0x19, 0x51, 0x84, 0x40, 0x11, 0xC3, 0x5A, 0x44, 0xA0, 0x0B,
+    0x3C, 0xE2, 0xEE, 0x88, 0x60, 0xF7, 0x28, 0xD0, 0x1B, 0xDA, 0x25, 0xA2, 0x80, 0x83, 0x24, 0x00,
+    0x0D, 0xD3, 0xFF, 0x3B, 0xC0, 0x62, 0xFB, 0x57, 0x2C, 0xB7, 0x95, 0xE3, 0x32, 0x78, 0x7B, 0xFA,
+    0x9E, 0x5D, 0xA7, 0x6D, 0x7D, 0x22, 0x06, 0x45, 0x27, 0xDB, 0x70, 0x74, 0xFE, 0x36, 0x46, 0x57,
+    0xA0, 0xFF, 0xBD, 0x48, 0xB4, 0xED, 0x47, 0x40, 0x31, 0xFD, 0x4D, 0x47, 0xAE, 0x12, 0xBE, 0x41,
+    0x16, 0xBE, 0x8C, 0xC1, 0x91, 0xE1, 0xF2, 0x08, 0x83, 0xFE, 0x51, 0x06, 0x65, 0x32, 0x89, 0x65,
+    0x48, 0x40, 0xDB, 0xD6, 0xDB, 0xD3, 0x49, 0x83, 0x67, 0x6E, 0xE0, 0xE1, 0x75, 0xB4, 0x35, 0xB4,
+    0x15, 0x8E, 0xBF, 0x68, 0xD3, 0x49, 0xE2, 0xE0, 0x99, 0x23, 0xD7, 0x0E, 0x9B, 0x47, 0x26, 0xE9,
+    0x21, 0x82, 0xCF, 0xB7, 0x80, 0xAE, 0x6D, 0xBF, 0xE8, 0xEE, 0x8D, 0x72, 0x36, 0x9D, 0x72, 0xAA,
+    0x2B, 0xC8, 0x36, 0xD0, 0x46, 0x68, 0xE3, 0xB6, 0xCD, 0x46, 0x5B, 0x5B, 0xF1, 0xE8, 0x88, 0x72,
+    0x72, 0x11, 0xB8, 0xB1, 0x3B, 0x4D, 0x41, 0x20, 0x34, 0xC0, 0xC2, 0xC5, 0x77, 0x6C, 0x91, 0xD2,
+    0x13, 0x19, 0xC1, 0x88, 0x84, 0xBC, 0x16, 0x2F, 0x8F, 0x7E, 0x75, 0xDC, 0x6B, 0x8F, 0x39, 0xEE,
+    0x53, 0xE1, 0x83, 0x1F, 0x75, 0x62, 0x1D, 0x01, 0xB2, 0x3C, 0x3E, 0x16, 0x0E, 0x99, 0x56, 0x85,
+    0x16, 0xE8, 0x31, 0x23, 0x78, 0x32, 0x5E, 0x96, 0x43, 0x33, 0x8C, 0xAA, 0x46, 0x14, 0xAF, 0x0E,
+    0x46, 0x0F, 0x60, 0x5D, 0xDD, 0xE6, 0xC4, 0x34, 0xBB, 0x40, 0xED, 0xC5, 0x06, 0x3D, 0xE3, 0x10,
+    0xFF, 0xDF, 0x68, 0xAC, 0xF1, 0xC7, 0xDF, 0x61, 0x1A, 0xC0, 0x50, 0x89, 0x1B, 0xAF, 0xC1, 0xC0,
+    0x06, 0xE8, 0x0B, 0x6B, 0xB2, 0x4C, 0x1D, 0xA3, 0x31, 0x67, 0x70, 0x28, 0x0F, 0xD1, 0x61, 0x0C,
+    0xBA, 0xA2, 0xEC, 0x94, 0xF5, 0xEC, 0xA2, 0x62, 0x22, 0x07, 0x0C, 0x97, 0xEC, 0xDF, 0x43, 0xE7,
+    0xDC, 0xF8, 0x1E, 0xA3, 0x95, 0x3E, 0x5E, 0x39, 0xD7, 0x1E, 0xA0, 0xC7, 0xAF, 0xD2, 0x04, 0xB1,
+    0x61, 0x90, 0xC1, 0x55, 0x79, 0x19, 0x7C, 0x8F, 0x9B, 0x50, 0x55, 0xD4, 0x1B, 0x29, 0x76, 0x03,
+    0xC6, 0x43, 0x30, 0xB9, 0x15, 0x71, 0x20, 0x00, 0x3F, 0x47, 0x3F, 0x3F, 0x83, 0x82, 0xF9, 0x7C,
+    0xD6, 0xCF, 0x10, 0x8E, 0xF9, 0x99, 0x5D, 0xD3, 0x89, 0xA5, 0xBF, 0xDA, 0x46, 0x14, 0xD9, 0x22,
+    0x98, 0x51, 0xC6, 0x18, 0x65, 0x04, 0x64, 0x14, 0x0C, 0xDF, 0xDF, 0x43, 0x00, 0x79, 0x45, 0x3A,
+    0x4A, 0xFF, 0x56, 0xB6, 0x7F, 0xDF, 0xD8, 0xD3, 0x74, 0xCF, 0xCD, 0xC3, 0x15, 0xE0, 0x89, 0xD1,
+    0x12, 0xFD, 0x87, 0x5F, 0x2F, 0x0B, 0x62, 0xA7, 0xC0, 0x50, 0xF0, 0x52, 0xD6, 0x27, 0x31, 0x63,
+    0x52, 0x0D, 0x3B, 0x9D, 0x76, 0x0A, 0xCF, 0xD5, 0xE6, 0x6E, 0xDB, 0x96, 0xA1, 0x58, 0x15, 0xFD,
+    0xE2, 0x0D, 0xD3, 0x4A, 0x18, 0xFA, 0x22, 0xF8, 0xE4, 0x4E, 0x62, 0xD3, 0xB3, 0x9D, 0x93, 0x97,
+    0xC9, 0xF9, 0x0E, 0x1E, 0x79, 0xC4, 0xF5, 0xD6, 0xE6, 0x83, 0x90, 0xED, 0x6C, 0x65, 0x60, 0x25,
+    0xDF, 0x46, 0x7C, 0x7D, 0x19, 0x01, 0x1E, 0x8C, 0xE3, 0xB8, 0xEC, 0x0D, 0xC2, 0x72, 0xF9, 0x37,
+    0x9F, 0x50, 0x7A, 0x7E, 0xA8, 0x2D, 0x47, 0x2C, 0xC1, 0x59, 0x2B, 0x82, 0x86, 0x66, 0xD9, 0x61,
+    0xB3, 0x16, 0x74, 0x9C, 0x81, 0x20, 0xCE, 0x9E, 0xD5, 0x0E, 0xD9, 0x6B, 0x04, 0x37, 0x08, 0x76,
+    0x08, 0x34, 0xA2, 0x62, 0x58, 0x8F, 0x65, 0x69, 0x17, 0x26, 0xBF, 0xF1, 0x32, 0xB3, 0x4A, 0x96,
+    0x2E, 0x88, 0x8B, 0xB2, 0xB0, 0x0D, 0x6A, 0x1C, 0x60, 0x1D, 0x4A, 0xCD, 0xE6, 0x4C, 0x02, 0xB5,
+    0x72, 0x18, 0x1C, 0xC4, 0xE3, 0x36, 0xDB, 0x9E, 0xC9, 0xA5, 0x79, 0xEC, 0x32, 0xB0, 0xA1, 0x29,
+    0xB3, 0x9F, 0x0A, 0xA7, 0x93, 0xDB, 0x80, 0x30, 0x72, 0x5F, 0xB3, 0x7F, 0x0F, 0x81, 0x3F, 0x38,
+    0x90, 0x4B, 0x33, 0xC6, 0x27, 0x63, 0xD2, 0x45, 0x21, 0x39, 0x8C, 0x23, 0x5C, 0x0A, 0xD4, 0xFF,
+    0x11, 0x08, 0x5E, 0x67, 0x12, 0x78, 0xA1, 0x73, 0x9A, 0xBA, 0x86, 0x18, 0xEE, 0x74, 0xAE, 0xF4,
+    0x31, 0x80, 0x24, 0xD1, 0xF9, 0x73, 0x0B, 0xCC, 0x73, 0xBB, 0x61, 0x28, 0xDB, 0xF0, 0xC6, 0xFE,
+    0x97, 0x44, 0x4E, 0x4F, 0x00, 0x97, 0x0E, 0x20, 0xA9, 0x31, 0x24, 0x51, 0x3C, 0x59, 0x1C, 0xB4,
+    0xEA, 0x6D, 0xF6, 0xD3, 0xCF, 0xB7, 0x7E, 0x72, 0x10, 0x2F, 0x47, 0x1C, 0x8F, 0x33, 0xFC, 0x0F,
+    0xD3, 0x5B, 0x1D, 0xE8, 0x18, 0x46, 0xE6, 0xE3, 0xFC, 0x09, 0x16, 0xCE, 0x79, 0xC4, 0x31, 0x1B,
+    0x32, 0x5C, 0xC9, 0xDE, 0xB3, 0x32, 0x0C, 0x15, 0x8E, 0x8A, 0x1F, 0xFC, 0xCB, 0xBC, 0x2C, 0xA2,
+    0xDC, 0x2C, 0xD3, 0xB0, 0xCD, 0x2F, 0xB5, 0x31, 0x13, 0xE0, 0x63, 0x7E, 0xDD, 0x79, 0x1C, 0xB5,
+    0x44, 0x18, 0x96, 0xD7, 0xFE, 0x71, 0x7E, 0xEF, 0x6E, 0x58, 0x18, 0x84, 0xE7, 0x6F, 0x89, 0x67,
+    0xFA, 0xEC, 0x3D, 0xF1, 0xBB, 0x2F, 0xAB, 0x6D, 0x1C, 0xB4, 0x25, 0xC2, 0xD7, 0x45, 0xF4, 0x8A,
+    0xF9, 0xC0, 0x64, 0x70, 0x26, 0x8E, 0xF9, 0x85, 0x58, 0x81, 0x44, 0x51, 0x75, 0x8A, 0x74, 0xF5,
+    0x26, 0x08, 0x53, 0xD1, 0x3F, 0xF9, 0x5B, 0xC9, 0x0B, 0x33, 0xC1, 0x64, 0x6C, 0xDA, 0xF1, 0x5D,
+    0x2F, 0x8E, 0x10, 0xD1, 0x37, 0x5D, 0x94, 0x70, 0x42, 0x62, 0x7E, 0x66, 0xC7, 0x3B, 0x6E, 0x87,
+    0xD0, 0x68, 0xF7, 0x71, 0x49, 0x3A, 0x21, 0x01, 0x56, 0xC1, 0xD0, 0xC8, 0x57, 0x4F, 0x81, 0x98,
+    0xD1, 0x9F, 0x8B, 0x3D, 0xD3, 0x22, 0x4E, 0xAF, 0xE8, 0xFD, 0x9A, 0x3B, 0x36, 0x61, 0x72, 0x57,
+    0xCB, 0x49, 0xC0, 0x19, 0x33, 0x25, 0x47, 0xC0, 0x65, 0xB5, 0x5D, 0x14, 0x6C, 0xA8, 0x5D, 0x60,
+    0x3E, 0x21, 0x0B, 0xC7, 0x97, 0xD8, 0x8F, 0xDA, 0x6A, 0x7B, 0x76, 0x0E, 0x26, 0xB3, 0x84, 0x89,
+    0xEF, 0x33, 0xC4, 0xD3, 0x02, 0x20, 0x6A, 0x83, 0x64, 0x31, 0x4C, 0xD3, 0x58, 0x4D, 0x0B, 0x6E,
+    0x9A, 0x86, 0x53, 0xA3, 0x45, 0x2B, 0x72, 0x97, 0xB8, 0x6E, 0x47, 0x46, 0x00, 0xA0, 0x6D, 0x0F,
+    0xB2, 0x9E, 0xE1, 0xE9, 0x06, 0x32, 0x59, 0x54, 0x49, 0xAE, 0xDE, 0x3C, 0x7F, 0x2B, 0x2C, 0xBD,
+    0x86, 0xD7, 0xD9, 0xE7, 0x6B, 0x35, 0x2C, 0x7B, 0x70, 0xB9, 0x07, 0x36, 0xF7, 0xBA, 0xF1, 0xFA,
+    0x06, 0x05, 0xB3, 0x2A, 0x8C, 0x0C, 0xAF, 0xB3, 0x11, 0xD3, 0x17, 0xA4, 0xF4, 0x02, 0xCE, 0x47,
+    0x85, 0x17, 0xDF, 0x33, 0xA5, 0x26, 0xAF, 0xAD, 0x20, 0x14, 0x7A, 0xBD, 0xE8, 0x04, 0xDF, 0x91,
+    0x16, 0x7B, 0x1A, 0xB2, 0x48, 0x06, 0x37, 0x69, 0x8F, 0xBC, 0x19, 0x42, 0x60, 0x1A, 0x71, 0x63,
+    0xC2, 0x0F, 0x57, 0xFF, 0xB1, 0xBE, 0x35, 0x19, 0xB0, 0xB5, 0x26, 0x39, 0x52, 0xAD, 0xE1, 0x34,
+    0x22, 0x6A, 0xC6, 0x34, 0x86, 0x94, 0xFD, 0x3A, 0x01, 0x95, 0x16, 0xB9, 0x84, 0x53, 0x42, 0xF3,
+    0x9C, 0xF2, 0x0A, 0xAD, 0xE3, 0x75, 0x56, 0x0F, 0x58, 0xBC, 0xFB, 0x6C, 0x4E, 0x77, 0x99, 0xE2,
+    0x46, 0x83, 0xB8, 0xDB, 0x29, 0x7D, 0x04, 0xDC, 0xA5, 0xAB, 0x4F, 0xA8, 0x8B, 0x68, 0x09, 0xC6,
+    0x0C, 0xE6, 0xC3, 0x1C, 0xD3, 0xE8, 0xD5, 0x5C, 0x20, 0xED, 0x30, 0x64, 0xA2, 0x20, 0xE5, 0x3E,
+    0x01, 0x27, 0x50, 0xB4, 0x1A, 0xDA, 0xAB, 0xF1, 0xD3, 0xBC, 0xD2, 0x8B, 0x13, 0x52, 0xC5, 0xEA,
+    0x82, 0xC3, 0x71, 0xB5, 0xBE, 0xAA, 0xF4, 0xDD, 0x20, 0x60, 0xC2, 0xF0, 0x59, 0x45, 0xFA, 0x48,
+    0x69, 0x3D, 0xE6, 0xB5, 0x90, 0x5D, 0x58, 0x96, 0x2D, 0x75, 0x71, 0xC0, 0x93, 0xC1, 0x48, 0xCF,
+    0x69, 0xA4, 0xC3, 0x6C, 0x48, 0x95, 0x16, 0x6B, 0x38, 0x88, 0xAD, 0xF5, 0xDF, 0xAC, 0x8B, 0xB0,
+    0xFF, 0xFE, 0x26, 0x86, 0xDC, 0x3E, 0xC5, 0x21, 0x57, 0xBB, 0xA4, 0x72, 0xC3, 0x08, 0xC1, 0xCA,
+    0x0F, 0x49, 0xC0, 0x6C, 0xC8, 0xF6, 0xCC, 0xF0, 0xEF, 0x1C, 0xAF, 0x59, 0x83, 0x44, 0xE9, 0x68,
+    0x52, 0xB8, 0xAA, 0xB1, 0x19, 0x56, 0x0E, 0xAB, 0x93, 0x5D, 0xC0, 0x98, 0x96, 0xCF, 0x62, 0x29,
+    0xCC, 0x17, 0xAC, 0xA4, 0x6D, 0xB2, 0x14, 0x52, 0xFB, 0x8F, 0x33, 0x28, 0x5A, 0xBB, 0x71, 0x1F,
+    0x0E, 0x9E, 0x9C, 0xE8, 0x05, 0x76, 0x20, 0x77, 0x61, 0x56, 0x15, 0x33, 0x38, 0xB9, 0x0F, 0x4E,
+    0x30, 0x55, 0x56, 0xE1, 0x94, 0x56, 0x06, 0x3D, 0x8E, 0x4F, 0x81, 0x93, 0xB4, 0xBC, 0xEF, 0x96,
+    0xA5, 0x53, 0x16, 0xCE, 0xC3, 0xCC, 0x79, 0x18, 0x2F, 0x47, 0xC4, 0x35, 0x08, 0x86, 0x69, 0xB3,
+    0x58, 0x3F, 0xDB, 0xFC, 0xDA, 0x84, 0x3D, 0x55, 0x8C, 0xBB, 0x4E, 0xF9, 0xC0, 0x29, 0xF7, 0x11,
+    0x12, 0x3D, 0x03, 0x61, 0x3F, 0x40, 0x14, 0x85, 0xCE, 0x90, 0xB6, 0x53, 0x9B, 0xFA, 0x1C, 0x0B,
+    0x75, 0x7F, 0x78, 0x3A, 0x61, 0x51, 0x45, 0x6F, 0x69, 0x7D, 0xF9, 0x37, 0xB1, 0x1E, 0x65, 0x2C,
+    0x2A, 0x56, 0x12, 0x56, 0xF2, 0xC3, 0xA3, 0x77, 0x61, 0xAF, 0xDD, 0x99, 0x44, 0x1A, 0xE6, 0x69,
+    0x6E, 0xE0, 0xE8, 0x0E, 0x9E, 0xAB, 0x2B, 0xCB, 0x57, 0xCB, 0xF2, 0x8A, 0xF4, 0x39, 0x43, 0xB7,
+    0xD2, 0x0A, 0x84, 0x63, 0xF1, 0x76, 0x45, 0x8E, 0xDC, 0x86, 0xEB, 0xDE, 0x99, 0xD3, 0x12, 0x39,
+    0x60, 0x0D, 0xF0, 0x97, 0x19, 0xE1, 0xCF, 0x0B, 0xC2, 0xB7, 0x4B, 0xC2, 0xB7, 0x1A, 0xC2, 0x64,
+    0xA6, 0x30, 0x52, 0x18, 0x66, 0x84, 0x7E, 0x4E, 0xE8, 0x96, 0x84, 0x76, 0x4D, 0x28, 0x33, 0x85,
+    0x63, 0x85, 0x88, 0xD5, 0xA0, 0xC5, 0xB0, 0x91, 0xC1, 0xC7, 0x82, 0x8C, 0xA9, 0x9D, 0x69, 0xC6,
+    0x62, 0xAA, 0xC2, 0x7E, 0xDE, 0x6F, 0xFA, 0x68, 0x82, 0x73, 0x6F, 0x68, 0x07, 0xAF, 0xBE, 0x83,
+    0xF8, 0x3B, 0xFC, 0x8C, 0x71, 0xEF, 0x14, 0x21, 0x23, 0x4C, 0xEB, 0x3E, 0xF9, 0xDC, 0xE8, 0x40,
+    0xF9, 0x74, 0x50, 0xC1, 0x8F, 0xC0, 0x8B, 0x45, 0x49, 0xD4, 0x26, 0x51, 0xF9, 0x4D, 0x33, 0x3C,
+    0xFC, 0x68, 0x3E, 0x6D, 0xBC, 0x3A, 0xDC, 0xCD, 0x22, 0xAD, 0xD3, 0xE9, 0x39, 0x6D, 0xBE, 0x1F,
+    0xF3, 0x3B, 0x75, 0xEF, 0x77, 0x8C, 0xE1, 0x8D, 0xD5, 0xCC, 0xAF, 0xA8, 0xC5, 0x67, 0x06, 0x67,
+    0x3D, 0xD4, 0x47, 0x52, 0xBD, 0x19, 0xA9, 0xC5, 0x58, 0x7D, 0x5E, 0xB4, 0x46, 0x03, 0x8C, 0x2B,
+    0xDC, 0x3D, 0xF4, 0x3E, 0x64, 0x31, 0x5F, 0x0D, 0xA6, 0x06, 0x9A, 0x6F, 0x2C, 0x49, 0x6B, 0xBA,
+    0x8D, 0x52, 0x15, 0x43, 0xA4, 0xDE, 0x52, 0x73, 0x7D, 0x35, 0xCA, 0x80, 0x3A, 0xDC, 0x65, 0x1D,
+    0xAF, 0xD2, 0x01, 0x63, 0x1D, 0x91, 0x58, 0x46, 0x62, 0x10, 0x1E, 0x1B, 0x22, 0x67, 0x83, 0xBB,
+    0x1A, 0x1F, 0x57, 0x67, 0x2B, 0xC2, 0x7F, 0x32, 0xE2, 0x9E, 0x1B, 0x71, 0xC7, 0x84, 0x81, 0x11,
+    0x77, 0x41, 0xE8, 0x54, 0x84, 0x56, 0xA3, 0x22, 0x9E, 0x2B, 0x8C, 0x14, 0x06, 0x03, 0x71, 0x3B,
+    0x2A, 0x6E, 0xB3, 0x45, 0x2B, 0x03, 0x68, 0xAE, 0x18, 0xA5, 0x71, 0x06, 0xA2, 0xD8, 0x35, 0x52,
+    0xA7, 0x10, 0x28, 0x02, 0x0A, 0x80, 0xC2, 0xD6, 0x56, 0x3E, 0xA1, 0xE1, 0x3E, 0xE4, 0xBC, 0x11,
+    0x99, 0x18, 0x77, 0xD8, 0x76, 0x4D, 0x9C, 0x49, 0xEB, 0x8A, 0x90, 0xFF, 0xC5, 0xC9, 0x4D, 0x0C,
+    0xD5, 0x1E, 0x51, 0xE4, 0x4B, 0xDC, 0xD4, 0x4A, 0xDF, 0x9D, 0xA9, 0x39, 0x8C, 0xBD, 0xDC, 0x14,
+    0x53, 0x9C, 0x42, 0xE3, 0x0E, 0x48, 0xCF, 0xAE, 0x22, 0x86, 0xC8, 0x04, 0xCD, 0xF8, 0x4B, 0x40,
+    0x7F, 0xD7, 0xAE, 0xC3, 0xB8, 0x8F, 0x54, 0x80, 0xC5, 0xCB, 0x14, 0x9F, 0xCC, 0xB7, 0x66, 0x62,
+    0x36, 0xCE, 0x18, 0x47, 0xDB, 0x93, 0x5F, 0x43, 0xE2, 0xF3, 0xC3, 0xD1, 0xB7, 0x3F, 0xEE, 0xB6,
+    0xCB, 0xFC, 0x24, 0x84, 0x91, 0x8D, 0x30, 0x30, 0xA3, 0xF6, 0x11, 0x26, 0x70, 0x77, 0xD0, 0x78,
+    0x2D, 0x62, 0x30, 0x84, 0xFB, 0x2C, 0xBE, 0xB8, 0x1F, 0x8F, 0x63, 0x96, 0x5D, 0x34, 0x04, 0xF9,
+    0x96, 0xFC, 0x8C, 0xFB, 0xBF, 0x54, 0xE5, 0x3F, 0xE6, 0xDC, 0xB1, 0x4D, 0x86, 0x5B, 0x9B, 0x67,
+    0xCA, 0xDF, 0x63, 0x85, 0xC5, 0xD5, 0x53, 0xE4, 0x53, 0xDE, 0xB8, 0x48, 0x32, 0x18, 0x15, 0x16,
+    0x40, 0xEF, 0xBF, 0x05, 0xFC, 0x57, 0xA8, 0x3E, 0x2B, 0xD6, 0x37, 0xC2, 0xAC, 0xAC, 0xC2, 0xF3,
+    0x44, 0xB8, 0xBD, 0x0F, 0xED, 0xAD, 0xB0, 0xDE, 0xF3, 0xFB, 0xA0, 0x73, 0xF3, 0x14, 0x19, 0xEE,
+    0x99, 0xD2, 0x9D, 0xBA, 0xF4, 0xDD, 0x76, 0x92, 0x62, 0xDD, 0xC1, 0x1C, 0x78, 0x89, 0xC7, 0x8C,
+    0x03, 0x6B, 0x31, 0xD3, 0x1F, 0xB0, 0x37, 0x32, 0x65, 0xC3, 0x91, 0xF4, 0x29, 0x4F, 0xFF, 0x03,
+    0xBE, 0xC6, 0x93, 0xF7, 0xF4, 0x07, 0x78, 0xC7, 0x8B, 0x8B, 0x8F, 0xF7, 0x0C, 0xCD, 0xE3, 0x8A,
+    0x53, 0x0A, 0x1D, 0x41, 0x0A, 0x1D, 0x0F, 0x06, 0x73, 0xBE, 0x95, 0x6E, 0xFD, 0x14, 0x8B, 0x9A,
+    0xB4, 0x2C, 0x76, 0xB6, 0xB7, 0x0B, 0x6B, 0x1E, 0x83, 0x4D, 0xFF, 0x53, 0x88, 0xCA, 0x7F, 0x20,
+    0x4D, 0x48, 0xDB, 0xB2, 0x1F, 0x31, 0x5A, 0xD9, 0xD8, 0xE0, 0x24, 0x44, 0x23, 0x35, 0x83, 0x60,
+    0x15, 0xCF, 0x01, 0x1E, 0x6C, 0x6D, 0xED, 0xF2, 0x8A, 0xE8, 0x5D, 0xD1, 0x9E, 0xCC, 0x95, 0x1A,
+    0x59, 0x01, 0xFB, 0xAD, 0x5C, 0x86, 0x00, 0x82, 0xFF, 0x6E, 0x20, 0x02, 0xA7, 0xD5, 0xCA, 0xCC,
+    0x77, 0xFB, 0x32, 0xE1, 0xA8, 0x77, 0x38, 0xEA, 0x02, 0x9D, 0x44, 0x06, 0x32, 0x4A, 0x59, 0x4C,
+    0xDD, 0x9E, 0xDE, 0x41, 0x24, 0x5A, 0x9A, 0x9A, 0x95, 0x66, 0x4F, 0xB3, 0x45, 0x95, 0x6D, 0x7F,
+    0x71, 0xAD, 0xEE, 0x76, 0x4E, 0xA7, 0x77, 0xB8, 0x5F, 0x3E, 0x63, 0x20, 0x35, 0x48, 0x33, 0x34,
+    0x4D, 0xEB, 0xD2, 0x0C, 0x86, 0x83, 0x62, 0x76, 0x4B, 0x0F, 0x24, 0xCA, 0x31, 0x05, 0x5E, 0xA5,
+    0xDE, 0xC1, 0xAE, 0xCD, 0xCE, 0x19, 0x92, 0x17, 0xB9, 0x7C, 0x38, 0x4D, 0xB0, 0x5C, 0x71, 0xF8,
+    0x07, 0x24, 0xB0, 0x7F, 0xF6, 0x73, 0xBB, 0x71, 0x59, 0x88, 0x55, 0x4E, 0xB5, 0x95, 0x5F, 0xD1,
+    0x70, 0x0F, 0x96, 0x0B, 0xF1, 0x56, 0x7E, 0x96, 0x4C, 0x2C, 0x3E, 0x76, 0xD9, 0xED, 0x02, 0x1A,
+    0x33, 0xEC, 0xC6, 0x9D, 0x54, 0x4F, 0xCA, 0xCB, 0x10, 0xBF, 0x6E, 0x32, 0x76, 0xC9, 0x87, 0xCE,
+    0x18, 0x77, 0xB8, 0x74, 0x8B, 0x4B, 0x6E, 0xB0, 0x0E, 0x1D, 0x92, 0x20, 0x5F, 0x03, 0xB9, 0xF8,
+    0xAC, 0xE7, 0x93, 0x7B, 0x50, 0x6E, 0x72, 0xCF, 0xEC, 0x4A, 0x31, 0xE6, 0x65, 0x2D, 0xFA, 0xE2,
+    0xE9, 0xCC, 0xA7, 0x39, 0xA2, 0x33, 0xD0, 0x95, 0x2B, 0x32, 0x38, 0x78, 0x56, 0x89, 0xF7, 0x49,
+    0xCA, 0x23, 0x12, 0xF1, 0x06, 0x3C, 0xD3, 0x6B, 0xE2, 0xF7, 0x2B, 0x51, 0x03, 0xA5, 0x00, 0x78,
+    0x5C, 0x78, 0x66, 0x8B, 0xE7, 0xE7, 0x82, 0x39, 0x8F, 0x94, 0x75, 0x67, 0x63, 0xFC, 0xFC, 0x65,
+    0x98, 0x93, 0xEB, 0x68, 0x7B, 0x30, 0x4B, 0x23, 0x3C, 0x1B, 0x25, 0x0F, 0x58, 0x28, 0x31, 0x4B,
+    0x05, 0x16, 0x89, 0x56, 0x2F, 0xA1, 0xF3, 0xDB, 0xE9, 0x22, 0x60, 0xBB, 0x8D, 0x83, 0x5F, 0x94,
+    0xEB, 0x16, 0x72, 0x6C, 0x7C, 0xB9, 0x63, 0x07, 0x4F, 0xED, 0xCF, 0x81, 0x33, 0xE7, 0x40, 0x56,
+    0xFD, 0x7D, 0xD9, 0xBB, 0x27, 0x7B, 0xF7, 0xA5, 0x1E, 0x9D, 0x2B, 0x03, 0x58, 0x9A, 0x4D, 0x63,
+    0xB7, 0x07, 0x47, 0x71, 0xF4, 0xF8, 0x58, 0x57, 0x8F, 0x5F, 0x1A, 0xED, 0x68, 0x2D, 0x89, 0x75,
+    0x3F, 0xC8, 0x7C, 0x29, 0x4D, 0x05, 0xE8, 0x59, 0x68, 0x5F, 0x16, 0x8D, 0x6B, 0x62, 0x8A, 0x0D,
+    0x6E, 0xB7, 0x55, 0x82, 0x66, 0x41, 0x45, 0x05, 0x8F, 0x1E, 0x9B, 0xCC, 0x52, 0x83, 0xCD, 0x50,
+    0x53, 0x2A, 0x3F, 0x3E, 0x97, 0x8A, 0x5B, 0xCB, 0x62, 0x2B, 0xB6, 0x2A, 0x8D, 0xE0, 0x07, 0x5B,
+    0xB1, 0xCB, 0x12, 0x3A, 0xA4, 0x8C, 0x20, 0xD8, 0xFD, 0x30, 0x63, 0x00, 0x3C, 0xEF, 0x82, 0xDF,
+    0x67, 0x10, 0x7A, 0xC4, 0x3D, 0x87, 0xF1, 0xED, 0xF9, 0x9D, 0xEC, 0x86, 0x5D, 0x39, 0xD9, 0x8E,
+    0x5D, 0x59, 0xD9, 0x9B, 0x00, 0xF9, 0x05, 0x2C, 0x89, 0x58, 0xD7, 0xC5, 0x33, 0x03, 0x1A, 0x7D,
+    0x2E, 0x2A, 0x98, 0x05, 0xAE, 0x2A, 0xB5, 0x2E, 0xCD, 0x62, 0x3F, 0xCB, 0xEF, 0xCF, 0xFC, 0x9D,
+    0xE7, 0xA9, 0x2E, 0xAF, 0xDB, 0x5F, 0x2B, 0x18, 0x63, 0x62, 0xE1, 0x05, 0xD3, 0x64, 0xDC, 0xE6,
+    0xAE, 0xFE, 0xFD, 0xA4, 0x6F, 0x09, 0xD7, 0x04, 0xC7, 0x5B, 0x30, 0x7B, 0x84, 0x1B, 0xF5, 0x32,
+    0x96, 0x35, 0x9C, 0xDC, 0xBE, 0x93, 0xD9, 0xF3, 0x6E, 0x9F, 0x47, 0x77, 0x7C, 0x02, 0x8E, 0xE4,
+    0xCD, 0xFA, 0x03, 0x49, 0xBD, 0xB7, 0x3F, 0x4B, 0xFE, 0x4D, 0xF2, 0x55, 0x31, 0xF1, 0xFA, 0x8F,
+    0xCC, 0x2A, 0xE2, 0x67, 0xE1, 0x72, 0xF5, 0x19, 0x08, 0x76, 0x5B, 0xC6, 0xF2, 0x3F, 0x39, 0x78,
+    0xE3, 0xF8, 0x04, 0x7F, 0xF5, 0x6C, 0x44, 0x6D, 0xF6, 0x17, 0xD3, 0xE4, 0x09, 0x74, 0x76, 0x22,
+    0x76, 0x67, 0x2E, 0x8F, 0x8D, 0xA6, 0xFF, 0x0B, 0xF8, 0x92, 0x67, 0x8E, 0xF4, 0x6C, 0x2E, 0x8E,
+    0x90, 0xB4, 0x19, 0x72, 0x9B, 0x60, 0x1E, 0xBF, 0x70, 0xA0, 0x51, 0x85, 0x29, 0xE6, 0x17, 0xA7,
+    0x06, 0xC1, 0x15, 0xE8, 0x87, 0x29, 0x67, 0x35, 0x73, 0xAE, 0xDB, 0xA3, 0x11, 0xD6, 0x22, 0xEB,
+    0xD3, 0xF5, 0xE2, 0x84, 0x83, 0x2E, 0xD4, 0xA8, 0xF8, 0x4B, 0x91, 0x47, 0x73, 0x3C, 0x95, 0x8F,
+    0xB3, 0x41, 0xBA, 0xCB, 0xCA, 0xB9, 0x84, 0xA5, 0x37, 0x3B, 0xF6, 0xBE, 0xDF, 0x3E, 0xFD, 0x0A,
+    0xE4, 0x5E, 0x73, 0x17, 0xA4, 0xBD, 0x03, 0xDD, 0x8C, 0x1A, 0x64, 0xE2, 0xEA, 0x2A, 0x79, 0xBE,
+    0xA9, 0x2B, 0x96, 0x0E, 0x3F, 0xCF, 0x85, 0x38, 0xAE, 0x4E, 0x12, 0xA5, 0x64, 0x40, 0xD7, 0x92,
+    0x84, 0x20, 0xDF, 0xD3, 0x78, 0xF0, 0x1A, 0xFF, 0x7E, 0x54, 0x75, 0xA5, 0x85, 0x23, 0xA5, 0x86,
+    0xE7, 0x42, 0x20, 0x2F, 0x4B, 0xD2, 0xDB, 0x10, 0x84, 0x2A, 0xE2, 0xCD, 0x87, 0x2A, 0xBC, 0x1C,
+    0xD1, 0xC8, 0x55, 0x85, 0x7A, 0x26, 0xDD, 0xCE, 0xEE, 0x2A, 0xDC, 0xD1, 0xA2, 0xFC, 0x5D, 0xDD,
+    0x71, 0x57, 0x31, 0xBD, 0x18, 0x3F, 0x57, 0x62, 0xB2, 0xF5, 0xB5, 0x01, 0x9A, 0xF2, 0x97, 0xB8,
+    0xE2, 0xD7, 0x1C, 0x90, 0x77, 0xD9, 0xE3, 0x35, 0x0A, 0xCC, 0x7A, 0x6F, 0xB9, 0x02, 0xBB, 0xA8,
+    0xC7, 0x1E, 0x46, 0x3C, 0x0D, 0xC2, 0x64, 0x46, 0x34, 0x4B, 0x63, 0xF8, 0xAA, 0x45, 0x2E, 0x79,
+    0xBE, 0x44, 0x65, 0x6D, 0x72, 0x97, 0xBD, 0x04, 0x1B, 0xDE, 0x6F, 0xE9, 0xF5, 0x5F, 0x47, 0xDF,
+    0x75, 0x1E, 0x2B, 0xBB, 0xB0, 0xB2, 0x4C, 0x29, 0x29, 0xEF, 0x09, 0x8F, 0x1E, 0xCC, 0x62, 0x9A,
+    0x7A, 0xDD, 0xC8, 0x3C, 0x45, 0x68, 0x29, 0x4E, 0x78, 0x78, 0x56, 0x89, 0x1E, 0xE8, 0xE1, 0xF6,
+    0xE8, 0xBF, 0xF8, 0x66, 0x81, 0x6B, 0x78, 0x37, 0x27, 0xFB, 0x4D, 0xAD, 0xB3, 0x1A, 0xC0, 0xFA,
+    0xF0, 0x20, 0xAB, 0x04, 0xE5, 0x52, 0x98, 0xE7, 0x82, 0x21, 0x3D, 0xA6, 0x10, 0xEE, 0xF7, 0x67,
+    0xBB, 0xCD, 0x6B, 0x06, 0xB6, 0xAE, 0xE8, 0x3E, 0x87, 0xF1, 0xBB, 0x42, 0x6D, 0xD8, 0xA5, 0x5B,
+    0x9A, 0xEA, 0xD0, 0x15, 0x76, 0x59, 0x40, 0x3C, 0x48, 0xF0, 0xE1, 0x27, 0xC5, 0x4E, 0xEC, 0xB6,
+    0xDC, 0x3E, 0xC0, 0x54, 0x5B, 0x63, 0x6E, 0x03, 0x23, 0x75, 0x09, 0x48, 0x0B, 0xF0, 0x5C, 0xD1,
+    0x13, 0x18, 0xA5, 0xBC, 0x42, 0xCF, 0xFA, 0x6A, 0x45, 0xD6, 0x1B, 0xF9, 0x61, 0x2D, 0xD7, 0xF8,
+    0xBB, 0xD3, 0x30, 0xCE, 0xDF, 0x97, 0xBB, 0x7B, 0x7C, 0x01, 0x65, 0x24, 0xD0, 0xD7, 0x92, 0x91,
+    0x51, 0xB1, 0x41, 0xF1, 0x45, 0x7F, 0x95, 0x47, 0x54, 0xA1, 0xE0, 0xAD, 0x2C, 0x7C, 0x9D, 0xC1,
+    0xE0, 0xFB, 0x99, 0xFF, 0x36, 0x8F, 0x76, 0xBF, 0x9F, 0xF8, 0x1F, 0x80, 0x52, 0xEF, 0xDF, 0xC5,
+    0xFB, 0x90, 0x4C, 0x7D, 0x2A, 0xEE, 0xEF, 0xA8, 0xE8, 0x73, 0x71, 0xE8, 0x62, 0xC1, 0xB8, 0x43,
+    0x07, 0x8E, 0x8C, 0xC9, 0x6A, 0xBA, 0x78, 0xAB, 0x1E, 0x38, 0x5D, 0xC7, 0xB8, 0x1C, 0x0D, 0x84,
+    0x80, 0xCD, 0xBC, 0x72, 0xB1, 0x6E, 0x4A, 0x79, 0x17, 0x0E, 0x97, 0x89, 0xC0, 0x41, 0xDD, 0xB4,
+    0x27, 0x49, 0x5A, 0x5B, 0xA5, 0xDD, 0x26, 0x7A, 0x38, 0x69, 0x9D, 0xD5, 0x94, 0x06, 0xC4, 0xBB,
+    0xB9, 0xBB, 0x0F, 0xDA, 0x9D, 0xC2, 0xDB, 0xE0, 0xCE, 0x7C, 0xF9, 0x9D, 0x50, 0x15, 0xFF, 0xA5,
+    0x20, 0x06, 0xC1, 0xF5, 0x9A, 0xFF, 0x16, 0xB0, 0x35, 0xD7, 0xBC, 0xF7, 0xF1, 0xB3, 0xF7, 0xA6,
+    0xFB, 0x11, 0x90, 0xEE, 0xDE, 0x75, 0xFE, 0x93, 0x75, 0xBD, 0xC2, 0x7E, 0xA4, 0xE9, 0x89, 0x45,
+    0x89, 0x07, 0x99, 0x06, 0x83, 0x98, 0x91, 0xBD, 0xC5, 0x4B, 0x37, 0xA9, 0xBE, 0x84, 0xC3, 0xA3,
+    0x48, 0x1F, 0xF1, 0x10, 0x67, 0x5C, 0xCA, 0xE2, 0xDD, 0x05, 0x44, 0x1C, 0x49, 0x3A, 0x0B, 0x66,
+    0xF1, 0xDF, 0xD4, 0xCC, 0x09, 0x73, 0xB0, 0xE7, 0x26, 0x98, 0x6C, 0x9F, 0x42, 0xBB, 0xC2, 0x22,
+    0xC8, 0x3A, 0x4B, 0x20, 0x3B, 0x0C, 0xF3, 0x99, 0xBC, 0xFE, 0x89, 0x07, 0xC3, 0x1E, 0x71, 0x92,
+    0xDB, 0x45, 0x15, 0xE2, 0x2B, 0xC1, 0x58, 0xC7, 0x7D, 0x87, 0x35, 0xA2, 0xBA, 0xDB, 0x97, 0xD0,
+    0xED, 0x13, 0x3D, 0xC1, 0xFE, 0x2A, 0xED, 0xC9, 0x75, 0xF3, 0xA6, 0x4A, 0xDC, 0x8B, 0xE7, 0xDC,
+    0x24, 0x4E, 0xEB, 0x73, 0x6D, 0x8C, 0xE9, 0xDE, 0x63, 0xE6, 0x76, 0x8F, 0xF1, 0x0F, 0x4F, 0x07,
+    0xE8, 0xF2, 0xB7, 0x29, 0x02, 0x4A, 0x75, 0x97, 0xC9, 0xF3, 0x06, 0xCD, 0x60, 0x48, 0xAD, 0xF3,
+    0xFF, 0x9A, 0xE0, 0x7F, 0x38, 0x71, 0x75, 0x3F, 0x86, 0xA6, 0xF2, 0xF6, 0x61, 0x2A, 0xBF, 0x50,
+    0x53, 0x96, 0x41, 0x5F, 0x20, 0x01, 0xD1, 0x3B, 0x7A, 0xF0, 0x2C, 0xBE, 0x89, 0x1B, 0xBF, 0xAD,
+    0x3B, 0x60, 0xC7, 0x9B, 0x03, 0x45, 0x3C, 0x3B, 0xE1, 0xE8, 0x44, 0xCD, 0xCC, 0x09, 0x00, 0xA7,
+    0x3B, 0x0E, 0xBB, 0xB2, 0x88, 0xA5, 0xAB, 0xF1, 0xE4, 0x76, 0x75, 0x43, 0xBC, 0x72, 0x07, 0x0B,
+    0xE1, 0x4D, 0x64, 0x5D, 0x17, 0xF4, 0x71, 0xF4, 0xB7, 0x1B, 0xC3, 0x2F, 0x5F, 0xB7, 0xE1, 0x3B,
+    0x15, 0x3C, 0x2A, 0x97, 0x76, 0xB7, 0xEA, 0xAE, 0xD0, 0x9B, 0xCB, 0x1A, 0x32, 0x9F, 0x35, 0xA4,
+    0x07, 0xEB, 0xED, 0xD6, 0x8F, 0x1B, 0x44, 0xBA, 0x8D, 0x66, 0x36, 0x7C, 0xCE, 0xCD, 0x8D, 0x58,
+    0x5E, 0x39, 0xDC, 0xC2, 0xBA, 0x3A, 0x99, 0x70, 0x4C, 0xA8, 0xE4, 0xBE, 0xBC, 0x09, 0x96, 0x2F,
+    0xD0, 0x06, 0x7B, 0x79, 0x87, 0xDF, 0xBC, 0x2A, 0xD2, 0xBF, 0x6A, 0xE3, 0x15, 0xB6, 0xBE, 0xAF,
+    0x10, 0x89, 0x27, 0xE9, 0x24, 0x95, 0xC5, 0x4E, 0xAB, 0x1E, 0xE9, 0x2D, 0x4C, 0x72, 0x68, 0xC5,
+    0x03, 0x81, 0x2E, 0x83, 0x97, 0x6E, 0xDF, 0x47, 0x5F, 0xD4, 0x88, 0x8F, 0x1C, 0xA2, 0x3C, 0x31,
+    0x2F, 0x7A, 0xFC, 0x38, 0x30, 0xF6, 0x8A, 0xB6, 0xCB, 0x3F, 0xE4, 0x67, 0x19, 0xBC, 0x98, 0x9C,
+    0xF7, 0xBA, 0xD9, 0x2A, 0xE2, 0x46, 0x51, 0x74, 0x78, 0x3C, 0xFC, 0xC4, 0xBC, 0x70, 0x01, 0x46,
+    0xF8, 0xAD, 0xC3, 0xD8, 0x2A, 0x7D, 0x53, 0x8C, 0x3A, 0x61, 0xBB, 0x74, 0x60, 0xB2, 0x9A, 0xFF,
+    0x07, 0xDD, 0x5B, 0xBF, 0x8F, 0xE4, 0xF4, 0x15, 0x7F, 0xB6, 0xF7, 0xD6, 0x01, 0x8B, 0xF3, 0x16,
+    0x77, 0x22, 0xBA, 0x4D, 0x18, 0x0A, 0x8A, 0x04, 0x1D, 0xB8, 0xA1, 0x38, 0x29, 0xCB, 0xD9, 0x09,
+    0x65, 0x0A, 0xAE, 0x60, 0x95, 0x22, 0x45, 0x9A, 0x54, 0x29, 0xB2, 0x14, 0x14, 0x57, 0xEC, 0xEC,
+    0x38, 0xF0, 0x07, 0x70, 0x8A, 0x04, 0x29, 0x28, 0x72, 0x05, 0x91, 0x60, 0xAE, 0xD8, 0x93, 0x72,
+    0x12, 0x8B, 0x34, 0xCB, 0x38, 0xA4, 0xA0, 0x48, 0xE3, 0xFC, 0x20, 0x4D, 0x14, 0xC5, 0x22, 0x7B,
+    0x51, 0x04, 0x45, 0x9C, 0x60, 0xC2, 0xEC, 0x6A, 0x66, 0x9C, 0xCF, 0xE7, 0x3D, 0x7B, 0x66, 0x96,
+    0xEC, 0xC1, 0x9D, 0xD8, 0xBB, 0xDB, 0x64, 0x58, 0x7F, 0xBF, 0xBE, 0xEF, 0x78, 0xEC, 0xF7, 0xDE,
+    0xF7, 0xFD, 0xF8, 0xBC, 0xF7, 0x8C, 0x88, 0x88, 0x93, 0x60, 0x90, 0x30, 0x93, 0xD5, 0x3A, 0x0F,
+    0x73, 0x19, 0xBE, 0x3A, 0xF1, 0x72, 0xAF, 0x92, 0xE8, 0x99, 0x2C, 0xC8, 0x25, 0xFC, 0x13, 0xBF,
+    0xF1, 0x46, 0x12, 0xA5, 0xE2, 0x95, 0x12, 0x27, 0xE2, 0x56, 0x12, 0xE3, 0x47, 0x23, 0x1D, 0xC7,
+    0xD2, 0xBB, 0xC5, 0x38, 0xBB, 0xC6, 0xC5, 0x6F, 0x13, 0xFE, 0x96, 0xF7, 0x29, 0x05, 0xF7, 0x0C,
+    0x70, 0x52, 0x71, 0x51, 0xA6, 0xEB, 0x13, 0x3C, 0xBA, 0x53, 0x17, 0xA4, 0xE0, 0x8C, 0xE8, 0xC7,
+    0x69, 0xA8, 0xC1, 0x7A, 0x26, 0x1B, 0x7B, 0x41, 0xE6, 0x1D, 0x4C, 0xBD, 0x34, 0xCC, 0xC2, 0x97,
+    0x25, 0x12, 0x9F, 0x0F, 0xF7, 0x0A, 0xB9, 0xC8, 0x5B, 0x6D, 0x89, 0x5B, 0x4A, 0xF7, 0xF0, 0xA0,
+    0x5F, 0xC4, 0x1C, 0x22, 0x5E, 0x17, 0xE2, 0x87, 0xE2, 0xEF, 0xF5, 0xF0, 0xAC, 0x7A, 0xD4, 0xDE,
+    0x9C, 0x9F, 0x4B, 0x1C, 0xBC, 0xB2, 0x57, 0x67, 0xD1, 0x5F, 0xAB, 0xCE, 0x34, 0x79, 0xB8, 0xA8,
+    0x40, 0x93, 0x14, 0x25, 0x7E, 0x29, 0x1F, 0xE4, 0x1C, 0xA7, 0xBC, 0x8B, 0x14, 0x5F, 0x6A, 0x84,
+    0xB0, 0x9C, 0x82, 0x82, 0x70, 0x73, 0xDE, 0x10, 0x9C, 0x4B, 0x7C, 0x73, 0x88, 0x47, 0x07, 0x4A,
+    0x8E, 0x9C, 0x6D, 0xC8, 0x59, 0xD2, 0x31, 0xD6, 0xB1, 0x27, 0x8F, 0x5F, 0x7D, 0xF0, 0x8D, 0x48,
+    0xA2, 0x32, 0x98, 0x9C, 0xE6, 0x7D, 0x76, 0xD7, 0x38, 0xF6, 0x0A, 0xE3, 0x99, 0x63, 0xF7, 0x36,
+    0xC6, 0x5D, 0xA1, 0x3C, 0x26, 0xDC, 0x06, 0x97, 0x52, 0xAE, 0xB7, 0xB1, 0x79, 0x12, 0x8F, 0xE3,
+    0xB2, 0xDD, 0x72, 0xFD, 0xAC, 0x48, 0x7B, 0xBE, 0xE6, 0x65, 0xCD, 0x59, 0xF8, 0x6C, 0xBB, 0xE6,
+    0x4F, 0xDB, 0xEB, 0xBC, 0xB1, 0x1C, 0x92, 0x5D, 0xFB, 0x19, 0xD6, 0x07, 0x89, 0x84, 0x75, 0x3D,
+    0x95, 0x8D, 0x83, 0xED, 0x4A, 0xC2, 0x0F, 0xFB, 0x53, 0xF1, 0x4B, 0x67, 0x2A, 0x21, 0xB5, 0x80,
+    0x9B, 0x91, 0x9E, 0xA6, 0xFE, 0xA8, 0x02, 0x3C, 0x24, 0x41, 0xA9, 0x4A, 0x50, 0x2C, 0x09, 0x54,
+    0xCD, 0xD3, 0x7F, 0x34, 0xAA, 0x45, 0xF1, 0xF7, 0xA4, 0x3D, 0x9B, 0xE8, 0x19, 0x74, 0xC7, 0x1D,
+    0xB7, 0x67, 0x5C, 0xB6, 0xB3, 0xA0, 0x68, 0xAF, 0x83, 0x8A, 0x34, 0x67, 0x64, 0xCE, 0xEE, 0x37,
+    0xD4, 0x9D, 0xE5, 0x45, 0x13, 0x3B, 0x0B, 0x73, 0xFC, 0xC6, 0x57, 0x9D, 0x48, 0xFD, 0xD2, 0xCE,
+    0x86, 0x7C, 0x7E, 0x28, 0x9D, 0x4F, 0x36, 0xA0, 0x9E, 0xEF, 0xAF, 0xF7, 0xA4, 0xAE, 0xEB, 0x54,
+    0x62, 0x8C, 0x0D, 0x5F, 0x49, 0xAB, 0x2A, 0x65, 0x68, 0x3C, 0xCA, 0xDA, 0x9A, 0xB1, 0x28, 0x9D,
+    0x91, 0x71, 0x28, 0x61, 0x69, 0x0C, 0x52, 0x9E, 0xA6, 0xE0, 0xED, 0xA3, 0x1F, 0xEC, 0xF7, 0x53,
+    0xA5, 0x06, 0x92, 0xC9, 0x94, 0x40, 0x3C, 0x4B, 0x57, 0xAA, 0x87, 0x4C, 0x3D, 0xDD, 0xD1, 0x57,
+    0xB0, 0x45, 0xC6, 0x8F, 0x33, 0x6A, 0x59, 0x2C, 0x1B, 0x6E, 0x82, 0xBC, 0x65, 0x30, 0x6D, 0x16,
+    0xE3, 0x96, 0xA9, 0xDD, 0x86, 0x27, 0xFC, 0xE8, 0x8A, 0xB2, 0x84, 0x21, 0x57, 0x8E, 0x82, 0xDC,
+    0xC9, 0x95, 0xA1, 0xCE, 0x87, 0xD7, 0x72, 0xE5, 0x27, 0xAA, 0xEB, 0x7C, 0xBE, 0xCB, 0xC3, 0x52,
+    0x2E, 0xF8, 0xA9, 0x70, 0x0F, 0x3A, 0x9D, 0x86, 0xD2, 0xB1, 0xCD, 0xDE, 0xC8, 0x66, 0xE7, 0x92,
+    0xCD, 0xBA, 0xB3, 0x2F, 0x95, 0x6E, 0xBF, 0x7F, 0xD5, 0xAF, 0x3F, 0x2E, 0xFD, 0xBA, 0x2E, 0xC3,
+    0x3C, 0x2A, 0xFD, 0x34, 0xC8, 0xA3, 0x24, 0x2C, 0x7D, 0xD0, 0x15, 0x53, 0x08, 0x20, 0x4B, 0x2D,
+    0x0E, 0x54, 0x6D, 0xE9, 0xEF, 0x47, 0xD0, 0x3E, 0x23, 0xB8, 0xDB, 0x58, 0xBB, 0xCE, 0x60, 0xA3,
+    0xB1, 0x4C, 0xE1, 0xEF, 0x70, 0xF9, 0xA3, 0x31, 0xE8, 0xC0, 0xE5, 0xCF, 0x77, 0xD2, 0x0E, 0x8D,
+    0xEE, 0x7A, 0x70, 0xF0, 0xEF, 0xFD, 0xE0, 0xE0, 0x5A, 0xE9, 0xD6, 0xBF, 0xAB, 0x9F, 0xC5, 0xF3,
+    0x1A, 0x9B, 0x80, 0xF0, 0x13, 0x5A, 0xCB, 0x06, 0x36, 0xF3, 0x54, 0xFD, 0x07, 0xBF, 0x54, 0x3B,
+    0xF1, 0x8E, 0x79, 0x72, 0x6C, 0x0A, 0x6C, 0x0A, 0x0F, 0x4D, 0x1D, 0x4C, 0x9D, 0x4F, 0xD6, 0x87,
+    0x98, 0x6A, 0xEA, 0x87, 0x59, 0xE9, 0xD1, 0x53, 0xD7, 0x26, 0xB3, 0x95, 0x55, 0x93, 0x63, 0x9C,
+    0x2C, 0xDA, 0xCB, 0x98, 0xFC, 0xC8, 0x98, 0xEC, 0xC8, 0x58, 0xB9, 0x59, 0x31, 0x79, 0xCF, 0xC7,
+    0x07, 0xDF, 0xE0, 0x18, 0x8C, 0x75, 0xC5, 0xC6, 0xC1, 0x17, 0x8E, 0x8E, 0x8E, 0x81, 0x8E, 0xE1,
+    0xC2, 0xD8, 0x91, 0x81, 0x12, 0x3F, 0x50, 0xDA, 0x07, 0x4A, 0xC3, 0xE2, 0x68, 0xA4, 0xAA, 0x33,
+    0x72, 0x95, 0x82, 0x55, 0xD5, 0x98, 0x8B, 0x4A, 0x34, 0x34, 0x86, 0x34, 0x92, 0x06, 0x1E, 0x4A,
+    0xA9, 0x1D, 0xA4, 0x31, 0x68, 0xD7, 0x6F, 0xFB, 0x58, 0xDD, 0x27, 0xFF, 0xE9, 0xB8, 0x79, 0x6E,
+    0x7B, 0x8C, 0xEC, 0xD9, 0x1D, 0x3C, 0x79, 0x4B, 0x86, 0x05, 0xD4, 0xF6, 0xBB, 0xD8, 0xF0, 0x4A,
+    0x56, 0xF7, 0x9D, 0x7A, 0xCF, 0x1F, 0x8B, 0xC3, 0xC0, 0xE3, 0x4D, 0xE9, 0x50, 0xB1, 0x23, 0x90,
+    0x9F, 0xCE, 0x3F, 0xCF, 0x6C, 0x7E, 0xB9, 0xB0, 0xF9, 0xA5, 0xD2, 0xE6, 0x17, 0xC7, 0x36, 0xA7,
+    0x93, 0x66, 0x8E, 0x9B, 0x39, 0xCA, 0x6C, 0x0E, 0x73, 0x9B, 0xFD, 0xD2, 0x66, 0x77, 0x64, 0xB3,
+    0x4C, 0x9A, 0xB9, 0xD7, 0xCC, 0x91, 0xCE, 0x99, 0x84, 0x9C, 0x3B, 0x7B, 0xE2, 0x73, 0xAE, 0x27,
+    0xE2, 0x16, 0xED, 0x7E, 0xDF, 0x72, 0xDE, 0x92, 0x45, 0x4D, 0x90, 0xD5, 0xAA, 0xF9, 0x3A, 0x95,
+    0x43, 0x9F, 0x81, 0x72, 0x9B, 0x4C, 0x94, 0x59, 0xC8, 0x5A, 0x79, 0x5D, 0x31, 0x56, 0x1B, 0x4E,
+    0x8D, 0x51, 0xC8, 0x9B, 0x7C, 0x42, 0xE4, 0xCA, 0xE6, 0xD8, 0xB8, 0x1C, 0x18, 0x93, 0x03, 0xE3,
+    0x71, 0x60, 0x2C, 0x0E, 0x8C, 0xC3, 0x81, 0x31, 0x38, 0x30, 0xFE, 0x06, 0xC6, 0xDE, 0xC0, 0xB8,
+    0x1B, 0x18, 0x73, 0x03, 0xE3, 0x6D, 0x60, 0xAC, 0x0D, 0x8C, 0xB3, 0x81, 0x2C, 0x68, 0xC7, 0x67,
+    0xA6, 0x91, 0x45, 0x68, 0x63, 0x66, 0x55, 0xA3, 0x76, 0xA3, 0x29, 0xED, 0x27, 0x34, 0x06, 0x3B,
+    0x16, 0x4A, 0x3A, 0xF6, 0xAF, 0x53, 0x87, 0x99, 0x96, 0xC7, 0xAF, 0x0C, 0x53, 0xA7, 0x9F, 0x44,
+    0x1F, 0xD7, 0x95, 0x33, 0x4C, 0xBD, 0x03, 0x04, 0x8A, 0x4E, 0x0A, 0x47, 0xBF, 0x8B, 0x9F, 0x23,
+    0x62, 0x5E, 0x5C, 0x98, 0xCA, 0x3B, 0x9D, 0x08, 0x10, 0xC2, 0xF4, 0xE1, 0x09, 0x44, 0x1D, 0xA6,
+    0x71, 0x9D, 0xC6, 0x65, 0x43, 0xD2, 0x91, 0x53, 0x27, 0x59, 0xD8, 0x35, 0xC7, 0x36, 0x2B, 0x28,
+    0xDA, 0x88, 0xEC, 0xA7, 0x97, 0x69, 0x16, 0x1F, 0xA8, 0x5D, 0xD4, 0xD9, 0xDC, 0x98, 0xCF, 0x2E,
+    0x30, 0xF3, 0x64, 0x13, 0xB4, 0xD5, 0x5E, 0xF4, 0xDB, 0x7F, 0xF0, 0xDE, 0xCE, 0x5F, 0x78, 0xBD,
+    0xF7, 0x1E, 0xAD, 0x89, 0x7B, 0x86, 0xFB, 0x3E, 0xC3, 0x31, 0x74, 0x28, 0xC4, 0xD3, 0xAA, 0x18,
+    0xE7, 0xE9, 0xCC, 0x65, 0x4D, 0x95, 0xA5, 0xBB, 0xDE, 0x53, 0x67, 0x47, 0xEF, 0x50, 0x50, 0x70,
+    0x4E, 0xAE, 0x88, 0x29, 0xD3, 0x58, 0xA0, 0x51, 0x20, 0xD0, 0x11, 0x56, 0x12, 0x4C, 0xA4, 0x06,
+    0xCE, 0xAA, 0x53, 0x07, 0x64, 0x7A, 0xD9, 0x9A, 0x48, 0xC5, 0xE0, 0x09, 0xBA, 0xE3, 0x6C, 0x26,
+    0x6D, 0x07, 0xAA, 0x15, 0x1E, 0x8C, 0xD5, 0x53, 0x87, 0x49, 0x24, 0xCB, 0xD2, 0x69, 0x18, 0x8E,
+    0x12, 0x07, 0x4E, 0xA8, 0xB3, 0x17, 0x25, 0xD0, 0xEA, 0xA4, 0x8B, 0x63, 0x17, 0x6B, 0x5D, 0xF0,
+    0x06, 0xEB, 0x4B, 0xE2, 0x8F, 0x5E, 0xCE, 0x83, 0x29, 0x42, 0xDB, 0x25, 0x0D, 0x82, 0x37, 0x82,
+    0xE4, 0x22, 0x04, 0x3B, 0xA6, 0xD7, 0xD6, 0xE8, 0x40, 0x87, 0x0C, 0xEF, 0xE5, 0x97, 0x6D, 0xB4,
+    0xBA, 0xED, 0xBF, 0xCE, 0x3E, 0x1C, 0x68, 0x8A, 0x50, 0x74, 0xD9, 0x4F, 0x3B, 0x11, 0xEF, 0x89,
+    0xB0, 0x63, 0xF7, 0x7C, 0xFC, 0x2A, 0xE0, 0x8E, 0x06, 0xC1, 0xCF, 0xFF, 0xAB, 0x04, 0x3B, 0x0B,
+    0xD0, 0x06, 0xBE, 0x57, 0x28, 0x4B, 0xB0, 0xEC, 0xBF, 0x07, 0x9E, 0x5D, 0x8A, 0x4D, 0xA6, 0x0B,
+    0x30, 0x12, 0xFA, 0x49, 0x58, 0x09, 0x34, 0x6B, 0x60, 0x93, 0x58, 0x36, 0xA3, 0x40, 0x0B, 0x85,
+    0x1B, 0x0A, 0x64, 0x15, 0xA3, 0x2A, 0x8C, 0xED, 0x1D, 0x31, 0xB4, 0xDF, 0xBA, 0x23, 0xC5, 0xAF,
+    0x0A, 0x5F, 0x15, 0xBD, 0x1A, 0x78, 0x55, 0xEC, 0x6A, 0xD0, 0xF5, 0x8C, 0x01, 0x4B, 0x37, 0x7F,
+    0x42, 0x64, 0x67, 0x07, 0xBB, 0xD0, 0x38, 0xB3, 0x53, 0x8D, 0x69, 0x6C, 0xEC, 0x09, 0x40, 0x2C,
+    0x9F, 0x9F, 0x02, 0xC2, 0xE6, 0x44, 0xB0, 0x8C, 0x86, 0xC4, 0xAF, 0xDD, 0x85, 0x83, 0x6B, 0x8C,
+    0x38, 0x44, 0xAE, 0x04, 0xAE, 0x8A, 0x5B, 0x89, 0x13, 0x1D, 0x45, 0xAE, 0xD4, 0x48, 0xDD, 0x6C,
+    0xDB, 0x6E, 0xDB, 0x70, 0xDB, 0xF2, 0x45, 0x13, 0x23, 0xA4, 0xC5, 0xEE, 0x02, 0xD2, 0xEE, 0x2B,
+    0x64, 0x2A, 0x8F, 0x01, 0xC6, 0xDE, 0x31, 0xA4, 0x55, 0xBC, 0xA1, 0x80, 0x32, 0xA4, 0xD6, 0x05,
+    0x93, 0x19, 0x82, 0x6C, 0xC1, 0x23, 0x31, 0xAE, 0x42, 0x5C, 0xC3, 0xAA, 0x2D, 0x60, 0xB8, 0x8D,
+    0x61, 0xD7, 0x70, 0xAD, 0xC1, 0x5A, 0x45, 0xB5, 0x0A, 0x6A, 0x17, 0x30, 0xAD, 0x57, 0xF3, 0x79,
+    0x6E, 0xFF, 0x8D, 0xD9, 0x8A, 0x9B, 0x6F, 0x72, 0xBD, 0xD8, 0xD5, 0x71, 0x53, 0x01, 0xDE, 0xCA,
+    0x89, 0x92, 0xD8, 0xD9, 0xF5, 0x44, 0x29, 0x69, 0xCE, 0xF4, 0xF3, 0xB4, 0x8F, 0x7F, 0x6E, 0xF1,
+    0x7A, 0x3D, 0x9B, 0xFB, 0xCF, 0xBB, 0x28, 0xBB, 0x26, 0x64, 0x19, 0x16, 0xB0, 0x8C, 0x20, 0x50,
+    0x77, 0x92, 0x3E, 0xA6, 0xB2, 0x1B, 0xCC, 0x46, 0x5B, 0x39, 0x39, 0x12, 0x34, 0x73, 0x53, 0x10,
+    0x1E, 0xF1, 0x9F, 0xBA, 0xCB, 0x34, 0x91, 0xF3, 0x04, 0xBD, 0x2A, 0xC6, 0x8B, 0x1C, 0xCE, 0x38,
+    0xF7, 0x42, 0x05, 0xCD, 0x50, 0x3F, 0x31, 0x43, 0x55, 0x48, 0x15, 0xA5, 0xFF, 0x13, 0x62, 0x54,
+    0xD3, 0x55, 0x7D, 0x0B, 0xB7, 0x5B, 0xAB, 0x75, 0x5E, 0xBF, 0x5F, 0x62, 0x2C, 0x17, 0x70, 0xC7,
+    0x9A, 0x45, 0xEE, 0x45, 0x6D, 0xDC, 0x9D, 0x8D, 0x27, 0x4D, 0x8C, 0x67, 0x67, 0xB8, 0x42, 0xA1,
+    0x86, 0xA7, 0x2A, 0x70, 0x9D, 0x62, 0xF4, 0xEE, 0xA1, 0x18, 0x1D, 0x24, 0x81, 0x21, 0xA8, 0x7A,
+    0x1A, 0xDF, 0x3F, 0xAA, 0xE4, 0x10, 0x00, 0x90, 0x22, 0xDA, 0x49, 0x98, 0x01, 0x6F, 0x64, 0xEF,
+    0xF4, 0xB7, 0xB3, 0x2E, 0xCE, 0xB7, 0xB0, 0x4E, 0x40, 0x40, 0x58, 0x10, 0xBE, 0x3F, 0x46, 0x4C,
+    0x2D, 0xDA, 0xC2, 0x84, 0xB2, 0xA1, 0xCC, 0x2D, 0xF7, 0x5F, 0x9F, 0xAD, 0xF8, 0x69, 0xA5, 0x06,
+    0xC7, 0xF5, 0x20, 0xB3, 0xF2, 0xCA, 0xCA, 0x09, 0x01, 0x46, 0xEB, 0xCF, 0x89, 0x8F, 0x53, 0xCE,
+    0xAA, 0x47, 0xF9, 0x00, 0x10, 0x77, 0xAC, 0x73, 0xFB, 0x39, 0x0E, 0x80, 0x24, 0x0F, 0xAA, 0x3C,
+    0x4C, 0x36, 0x47, 0xD4, 0x72, 0x6C, 0x7C, 0x42, 0x4E, 0xA6, 0x54, 0xD4, 0x96, 0x58, 0x87, 0xEB,
+    0xC8, 0xF1, 0x4A, 0xA5, 0x8D, 0xBD, 0x16, 0x88, 0x3F, 0xF3, 0x89, 0x6A, 0xAD, 0x4A, 0x3C, 0x5C,
+    0x7F, 0xB8, 0x8D, 0xC9, 0xDB, 0x4E, 0x68, 0x46, 0x01, 0xEE, 0x8E, 0xE9, 0x74, 0xA4, 0x29, 0xCF,
+    0x79, 0x4C, 0x78, 0xE2, 0x85, 0x48, 0x05, 0x74, 0xDD, 0xA6, 0x42, 0x27, 0x37, 0x8B, 0x3E, 0x7C,
+    0x53, 0x98, 0xCD, 0xF1, 0xDE, 0xA1, 0x92, 0x2F, 0x9D, 0xF5, 0x0D, 0x4E, 0xB1, 0x8A, 0x43, 0x2E,
+    0xDB, 0x62, 0xA9, 0x13, 0xEE, 0x8A, 0xE9, 0x29, 0x08, 0x06, 0xD3, 0x0B, 0x90, 0x09, 0xA6, 0x1B,
+    0x51, 0x2E, 0xBD, 0x57, 0xBE, 0x57, 0xD5, 0x63, 0x1F, 0xB4, 0x54, 0xA0, 0xF6, 0xCD, 0xA3, 0x88,
+    0x85, 0x28, 0x3A, 0x15, 0x84, 0x31, 0x99, 0x0E, 0x29, 0x0E, 0x20, 0x40, 0x08, 0x24, 0xF3, 0x73,
+    0x88, 0x84, 0x35, 0x1D, 0x2B, 0xE8, 0x68, 0x01, 0x06, 0x82, 0xA9, 0xEB, 0x12, 0xA2, 0x79, 0x65,
+    0xFD, 0x52, 0xAC, 0xC2, 0xEA, 0x6A, 0xEE, 0x03, 0x01, 0x65, 0x3C, 0x27, 0x46, 0xDB, 0x92, 0xB7,
+    0x4A, 0x27, 0x8F, 0x3F, 0xFA, 0xED, 0x74, 0x3B, 0x0B, 0xEA, 0xA4, 0x37, 0x55, 0x2C, 0xD4, 0xBA,
+    0xBA, 0xE5, 0x7A, 0x1F, 0x5A, 0xF1, 0x0B, 0xE4, 0x45, 0x23, 0xDC, 0x1D, 0xD9, 0x58, 0x40, 0xB0,
+    0x0A, 0x9C, 0x9C, 0xB6, 0x49, 0x47, 0x3C, 0xD3, 0xA7, 0xDE, 0xE2, 0xD0, 0x7F, 0x03, 0x6B, 0x43,
+    0xE2, 0xD4, 0x30, 0xC7, 0x75, 0x61, 0x16, 0xA5, 0x41, 0x3D, 0x09, 0xB3, 0xE5, 0xED, 0xBF, 0x23,
+    0x91, 0x09, 0x33, 0x77, 0x44, 0xBD, 0x18, 0xFE, 0x62, 0x03, 0x9A, 0x51, 0x4F, 0x67, 0x48, 0xF1,
+    0x87, 0x40, 0xA5, 0x1F, 0xC0, 0xC6, 0x0F, 0x86, 0x30, 0x8C, 0x3C, 0x5A, 0x22, 0x38, 0x4D, 0x14,
+    0xA1, 0xB2, 0x66, 0x9A, 0xDA, 0x59, 0x90, 0x81, 0x15, 0xAF, 0xE0, 0x43, 0x15, 0x86, 0xDE, 0x64,
+    0x8D, 0x2D, 0x55, 0xCB, 0x57, 0x79, 0x1D, 0xD0, 0xC1, 0x60, 0x2F, 0x59, 0x1E, 0x42, 0xCC, 0x45,
+    0x5E, 0xB8, 0x46, 0x5F, 0xBD, 0xE9, 0xD5, 0x35, 0xA2, 0xAF, 0xA3, 0xD5, 0x58, 0x28, 0xE7, 0xCD,
+    0xED, 0x14, 0xCE, 0x64, 0xA4, 0xA6, 0xB1, 0xD4, 0x64, 0x55, 0xEE, 0x07, 0x45, 0x9B, 0x53, 0xB1,
+    0x38, 0x3B, 0xCF, 0xA8, 0x8E, 0x53, 0x10, 0x86, 0xF8, 0xC3, 0xEC, 0x96, 0x82, 0x70, 0xF8, 0x5F,
+    0xF1, 0xC8, 0x51, 0xA8, 0xFD, 0x87, 0x94, 0x0F, 0xC5, 0x43, 0xE9, 0x50, 0x38, 0x94, 0x88, 0xFE,
+    0x87, 0x99, 0x82, 0x51, 0xB9, 0x80, 0x2B, 0x4A, 0x85, 0x42, 0xA1, 0x4C, 0x28, 0x12, 0x4A, 0x84,
+    0x02, 0xA1, 0x3C, 0x98, 0x99, 0x6D, 0xDA, 0x41, 0x74, 0x5F, 0x50, 0x14, 0x2A, 0x09, 0x4B, 0x5F,
+    0x84, 0xA5, 0x94, 0xDF, 0xE7, 0xE6, 0xA6, 0x45, 0x0B, 0x97, 0xB3, 0xF4, 0x05, 0xA6, 0x56, 0x57,
+    0xC8, 0xB3, 0x7A, 0x85, 0xAF, 0xB5, 0xEC, 0x52, 0xB4, 0x0A, 0x5C, 0x61, 0x70, 0x59, 0x1C, 0x0C,
+    0x98, 0x93, 0x3C, 0xC2, 0x08, 0x09, 0x69, 0x7A, 0xFF, 0x64, 0x95, 0xF4, 0xE3, 0x29, 0x29, 0x80,
+    0x53, 0xF1, 0xC6, 0x31, 0x93, 0x95, 0x90, 0x01, 0xCB, 0xD7, 0x5F, 0x68, 0x25, 0xB6, 0xD6, 0x32,
+    0x32, 0x95, 0x36, 0xCA, 0x91, 0x8B, 0x05, 0x23, 0x64, 0x63, 0x4E, 0x2D, 0x6A, 0x6A, 0x97, 0x71,
+    0x3F, 0x79, 0x92, 0xCE, 0x29, 0xA4, 0xAB, 0xF1, 0xE9, 0xD9, 0x9D, 0x16, 0xAB, 0xF7, 0xE8, 0x89,
+    0xB4, 0x56, 0xE5, 0x1D, 0x39, 0x9C, 0xEB, 0x93, 0x20, 0xD6, 0xCB, 0x3D, 0x3E, 0x52, 0x1D, 0x8F,
+    0x92, 0xB6, 0xC9, 0x81, 0x4C, 0x7E, 0xCC, 0xDA, 0x6D, 0x4D, 0x22, 0x47, 0x5A, 0xE3, 0xD5, 0x1C,
+    0x4C, 0x33, 0x2A, 0xCD, 0x23, 0x91, 0x07, 0xAE, 0xEE, 0xCB, 0x34, 0xE9, 0xD5, 0x49, 0x94, 0xDD,
+    0xEB, 0xEC, 0x6D, 0x87, 0xAC, 0x16, 0x2D, 0xDA, 0x55, 0xA0, 0xED, 0xAB, 0x1B, 0x56, 0xED, 0x1C,
+    0xA6, 0x5F, 0x3E, 0x7F, 0x0B, 0x13, 0x03, 0x2F, 0x55, 0x73, 0x8C, 0xAC, 0xB4, 0xC6, 0x94, 0x57,
+    0xCE, 0xF5, 0xAF, 0x92, 0x90, 0x72, 0xD1, 0xF1, 0x9C, 0x20, 0xDE, 0xE9, 0x1A, 0xBD, 0x7A, 0x3A,
+    0xA7, 0xED, 0xB8, 0x64, 0xB1, 0xD3, 0xC8, 0x82, 0xDA, 0x36, 0x64, 0x51, 0xBD, 0xB4, 0x9A, 0x3B,
+    0xAD, 0x71, 0x73, 0xD3, 0xAC, 0x11, 0x0A, 0xDC, 0xE6, 0xD0, 0x21, 0xFD, 0x6B, 0x5D, 0x17, 0x9D,
+    0xFE, 0xB5, 0xEC, 0x6B, 0xB0, 0x9C, 0xAF, 0xEA, 0x4D, 0x4A, 0x23, 0x3C, 0x6C, 0x62, 0xEC, 0x70,
+    0x4F, 0xE4, 0x1A, 0x43, 0x40, 0x87, 0x65, 0xB3, 0x4A, 0x7B, 0x4F, 0x10, 0xC7, 0x12, 0x8E, 0x4D,
+    0x9C, 0x0F, 0xB0, 0x36, 0x94, 0xA0, 0x8C, 0xDF, 0xEF, 0xC1, 0x03, 0x4F, 0xD4, 0xE9, 0x30, 0xAD,
+    0xA6, 0x43, 0x72, 0xFE, 0x55, 0x9A, 0x3B, 0x62, 0x85, 0xAE, 0x71, 0x46, 0xE7, 0xFA, 0xFD, 0x04,
+    0x21, 0x25, 0x8D, 0xFB, 0x43, 0x3C, 0x6D, 0x4D, 0x2E, 0xC8, 0x0D, 0x61, 0x85, 0x4C, 0x4D, 0x3D,
+    0x6C, 0x00, 0xE9, 0xA4, 0x69, 0x2D, 0x39, 0x75, 0x03, 0xF1, 0x09, 0xAC, 0x82, 0x7C, 0xE1, 0xC8,
+    0x1E, 0xC3, 0xDA, 0x0E, 0xA2, 0x02, 0x9B, 0x62, 0xBD, 0x57, 0x47, 0x70, 0x3F, 0x57, 0x88, 0xB2,
+    0x91, 0x1E, 0x87, 0xCF, 0x26, 0xFE, 0x54, 0x5B, 0x1C, 0x6A, 0x6A, 0x00, 0x80, 0x2C, 0xC8, 0xDF,
+    0xE9, 0xDF, 0x88, 0x9E, 0xD7, 0xD5, 0x50, 0xBF, 0xF5, 0xFF, 0xD8, 0x90, 0xB1, 0xF6, 0x0B, 0x75,
+    0x4F, 0xDB, 0x2F, 0xEA, 0x8B, 0x9C, 0x69, 0x9B, 0x1F, 0x58, 0x49, 0xF5, 0x64, 0xB7, 0x5F, 0xA4,
+    0x29, 0xA6, 0x5B, 0x7D, 0xB1, 0x3C, 0x94, 0xDB, 0xDC, 0x6A, 0x3E, 0x21, 0xED, 0x97, 0xA6, 0x64,
+    0xA3, 0x44, 0x51, 0x9D, 0xD5, 0x80, 0x01, 0x45, 0x35, 0x53, 0xBC, 0x1F, 0x31, 0xDB, 0xCC, 0x73,
+    0xD7, 0xCA, 0xD0, 0x4C, 0xAB, 0xFC, 0xA4, 0xC5, 0xDC, 0x77, 0x35, 0x66, 0x23, 0x20, 0x6B, 0x79,
+    0x06, 0x31, 0x79, 0x75, 0x9A, 0x68, 0x3C, 0xA4, 0x01, 0xA8, 0xEA, 0xDC, 0xD1, 0x7C, 0xD0, 0xBF,
+    0x56, 0x9D, 0xEB, 0x5F, 0xF1, 0x08, 0x3D, 0xA3, 0x3A, 0xD7, 0x75, 0xB3, 0x4C, 0x7C, 0x7F, 0x9B,
+    0xB3, 0xA9, 0x2C, 0x32, 0xBE, 0x8A, 0x55, 0x55, 0x79, 0x07, 0x32, 0x37, 0x85, 0x4B, 0x0F, 0xB7,
+    0x68, 0x7B, 0x45, 0x04, 0x72, 0xFF, 0x49, 0x2B, 0xF8, 0x14, 0x1B, 0xED, 0x22, 0x46, 0x57, 0x30,
+    0x60, 0x77, 0x44, 0xB5, 0x1F, 0x93, 0x9E, 0xD9, 0xE0, 0xCC, 0x06, 0x97, 0xB7, 0x05, 0x68, 0xA8,
+    0xC0, 0x23, 0x06, 0x58, 0x2B, 0x0D, 0x41, 0x2B, 0xEB, 0x4A, 0x81, 0x5B, 0xF9, 0xA4, 0x01, 0x7B,
+    0xE5, 0x22, 0x51, 0x00, 0xB4, 0xC3, 0x43, 0x95, 0xB5, 0xCF, 0x0C, 0x2A, 0x9E, 0xD5, 0x89, 0x34,
+    0x75, 0xAD, 0xC6, 0x95, 0xFB, 0xC5, 0xBC, 0xBE, 0xD4, 0xF4, 0x15, 0xBE, 0x3E, 0x6F, 0xFC, 0x9B,
+    0xEA, 0x6B, 0x53, 0xC4, 0x7A, 0x22, 0xD6, 0x12, 0xB1, 0x8E, 0x88, 0x35, 0x44, 0xAC, 0xF1, 0x63,
+    0x6D, 0x1F, 0xEB, 0x86, 0x58, 0x33, 0xC4, 0x7A, 0x21, 0xD6, 0x0A, 0xB1, 0x4E, 0x88, 0x35, 0x42,
+    0xAC, 0x0F, 0x62, 0x6D, 0x10, 0xEB, 0x82, 0x58, 0x13, 0xC4, 0x7A, 0x20, 0xD6, 0x02, 0xB1, 0x0E,
+    0x88, 0x35, 0x40, 0x16, 0xEA, 0x48, 0x66, 0x8A, 0xEA, 0x73, 0xCE, 0xCF, 0x53, 0x3B, 0x6B, 0x60,
+    0x08, 0xDB, 0x17, 0xA2, 0xCD, 0x0B, 0x6D, 0x5D, 0x68, 0xC7, 0xC2, 0x86, 0xF2, 0x8B, 0x07, 0x0A,
+    0x53, 0x9B, 0x14, 0xDA, 0xA2, 0x68, 0x04, 0x66, 0xB1, 0xD7, 0x2A, 0x1C, 0xF2, 0x0D, 0x1D, 0xBF,
+    0xA9, 0x92, 0x51, 0xF1, 0x79, 0xA9, 0x06, 0xEA, 0xA4, 0x9C, 0x9D, 0xBB, 0xD6, 0x93, 0x18, 0x2E,
+    0x24, 0x93, 0x9A, 0x46, 0xBA, 0xBF, 0xD1, 0xEB, 0x7F, 0xCD, 0x6B, 0xFC, 0x26, 0x8D, 0xAC, 0x8E,
+    0x4C, 0x23, 0x7B, 0xDA, 0xEF, 0x3E, 0xE8, 0x83, 0x1D, 0x87, 0x06, 0x87, 0xF4, 0xAA, 0x49, 0x20,
+    0xFD, 0xA3, 0x12, 0x48, 0x0D, 0x37, 0xDC, 0x3A, 0x1A, 0xCE, 0x03, 0x8D, 0x3D, 0xB2, 0x0C, 0x5D,
+    0xDE, 0x40, 0xA2, 0x75, 0x41, 0x0F, 0xD9, 0x67, 0x04, 0xC9, 0x8F, 0x31, 0x99, 0x9C, 0x81, 0x80,
+    0xC8, 0xB4, 0xFB, 0xA2, 0x2D, 0xEE, 0xD8, 0x23, 0xF2, 0xFF, 0x85, 0x0C, 0xB3, 0xC5, 0xF5, 0xFF,
+    0x55, 0x5B, 0x0D, 0x65, 0x51, 0xAF, 0xEE, 0x5D, 0xCE, 0xA9, 0xD8, 0xDE, 0xFC, 0x79, 0xDA, 0x8A,
+    0xF4, 0x05, 0x59, 0x28, 0x5F, 0x02, 0x84, 0xFE, 0x89, 0x20, 0x74, 0x6A, 0xB1, 0x1C, 0x97, 0xC6,
+    0x74, 0xCC, 0x6F, 0x11, 0x84, 0xFE, 0x1E, 0x20, 0xD4, 0x7B, 0x17, 0x20, 0xD4, 0xFF, 0x36, 0x7C,
+    0x77, 0x48, 0xD4, 0xF9, 0x75, 0x0E, 0x17, 0x38, 0x5C, 0xE7, 0x50, 0x00, 0x84, 0xBA, 0x19, 0x40,
+    0x28, 0xCD, 0x2E, 0xFA, 0x2E, 0x23, 0xF1, 0x9F, 0x09, 0x42, 0xC7, 0x87, 0x40, 0xA8, 0xFB, 0x97,
+    0x9A, 0x66, 0x38, 0xEB, 0xD8, 0xC8, 0x73, 0x32, 0xD7, 0xB0, 0x06, 0xD7, 0x99, 0x68, 0x0A, 0xD9,
+    0xF8, 0x5B, 0xE6, 0x1D, 0xD4, 0x89, 0xE1, 0xCE, 0x0E, 0x70, 0xE7, 0xB7, 0x80, 0x3B, 0x7F, 0x59,
+    0x6E, 0x39, 0xBF, 0x2B, 0xBB, 0xDE, 0xBB, 0x65, 0x37, 0x00, 0xEE, 0x3C, 0x0D, 0xDC, 0xB9, 0x06,
+    0xDC, 0xF9, 0x02, 0x70, 0x67, 0x01, 0xDC, 0x09, 0x82, 0x03, 0xE0, 0x4E, 0x56, 0x67, 0xCE, 0xB7,
+    0xDE, 0xE5, 0x92, 0x3E, 0x6D, 0xAC, 0xB1, 0xA8, 0xAB, 0xBC, 0x77, 0x0C, 0xF6, 0xFE, 0xA4, 0x3C,
+    0xDC, 0x15, 0xB8, 0xBF, 0xA5, 0x9A, 0xE7, 0x60, 0x59, 0x5B, 0x20, 0x2F, 0x02, 0x71, 0xC1, 0x8B,
+    0x70, 0xB7, 0xF9, 0x8D, 0x19, 0x71, 0xC7, 0x63, 0x55, 0x3F, 0x52, 0x55, 0x54, 0x80, 0xE2, 0xFF,
+    0x51, 0xB9, 0x90, 0xA7, 0xE4, 0x50, 0x58, 0xBF, 0xBF, 0x12, 0x90, 0x73, 0x44, 0xD6, 0x70, 0xFD,
+    0x37, 0x77, 0x70, 0xCD, 0xF9, 0xA6, 0x01, 0x76, 0x3C, 0xDC, 0x9F, 0x72, 0x00, 0x36, 0x40, 0xB8,
+    0xFF, 0x2B, 0x02, 0x67, 0x44, 0xFA, 0x1B, 0xC8, 0x3A, 0x56, 0x9C, 0x26, 0xF1, 0xAE, 0x47, 0x1B,
+    0x07, 0x7D, 0xBE, 0xF7, 0xB0, 0xC9, 0xAC, 0x1B, 0xC7, 0x79, 0x1C, 0x4B, 0xF3, 0x77, 0x1F, 0x34,
+    0x86, 0xA7, 0x88, 0xDF, 0xE9, 0xA1, 0xB5, 0xF9, 0x11, 0x10, 0x21, 0x92, 0x1D, 0xBE, 0x79, 0xC1,
+    0xF7, 0x2E, 0x9E, 0x03, 0x64, 0xD9, 0x05, 0xDF, 0x51, 0x80, 0x68, 0xF3, 0x1D, 0x06, 0x9D, 0xF9,
+    0x6E, 0x6A, 0x28, 0x02, 0x3F, 0x61, 0x16, 0x23, 0xCF, 0x57, 0xAE, 0xB2, 0x8B, 0x56, 0x8E, 0xCD,
+    0xE0, 0x9E, 0xB3, 0xAD, 0xF5, 0xF5, 0x64, 0xAB, 0x31, 0xD1, 0xB8, 0xA9, 0xD7, 0x21, 0x9F, 0x4A,
+    0xFC, 0x83, 0x21, 0xB1, 0x93, 0xC5, 0xCD, 0xE5, 0x2B, 0x7C, 0xB5, 0x4B, 0xE4, 0xED, 0x0D, 0x48,
+    0x38, 0x98, 0xBD, 0xBD, 0x74, 0x37, 0x78, 0x69, 0xF7, 0xC5, 0xBD, 0x39, 0x38, 0xB4, 0x2F, 0xC7,
+    0xC1, 0xC7, 0x99, 0x53, 0x49, 0x0C, 0xAB, 0x7D, 0xA6, 0xF0, 0xB3, 0xD2, 0x29, 0x36, 0x65, 0x65,
+    0x49, 0x75, 0x74, 0xE2, 0x0C, 0x35, 0xB3, 0x08, 0xEF, 0xF0, 0xAF, 0xB7, 0x87, 0xD4, 0xF5, 0xEC,
+    0xA9, 0x24, 0x0A, 0xF2, 0xF0, 0xDD, 0xD2, 0xCB, 0x2B, 0x29, 0xD7, 0xEC, 0x9E, 0xD2, 0x4F, 0x65,
+    0xA8, 0xD7, 0x04, 0x9F, 0xFF, 0x97, 0xCB, 0x0F, 0x2A, 0xA0, 0xC3, 0xE5, 0xAB, 0x02, 0x20, 0xD5,
+    0xDD, 0x90, 0xEB, 0x40, 0x9B, 0xCE, 0x31, 0x74, 0xC1, 0xE7, 0x37, 0xF4, 0x9A, 0x1B, 0xDE, 0x71,
+    0x0B, 0x5C, 0x3D, 0x19, 0xB1, 0xB3, 0x6C, 0xAA, 0xF6, 0xD3, 0x8D, 0x05, 0xDF, 0x2E, 0x16, 0xAB,
+    0xF0, 0xF7, 0xB4, 0x05, 0x0E, 0x41, 0x43, 0xC1, 0x73, 0x35, 0x2C, 0xCA, 0x9A, 0xC2, 0x6E, 0xA4,
+    0x7D, 0x3C, 0x2D, 0x70, 0x79, 0xB3, 0xAD, 0x4C, 0x84, 0x3F, 0xC3, 0x33, 0x1F, 0x62, 0xFA, 0xBF,
+    0x74, 0x7F, 0x78, 0x95, 0x73, 0xA9, 0x96, 0x2D, 0x9C, 0x4F, 0x06, 0xC0, 0x0B, 0x0F, 0xCD, 0x43,
+    0xF8, 0x31, 0xF0, 0x79, 0x86, 0x68, 0x27, 0xD6, 0xFE, 0xCC, 0x33, 0x2C, 0x36, 0x64, 0x7C, 0x61,
+    0xB3, 0x60, 0xAD, 0xA1, 0x15, 0x26, 0x94, 0x6F, 0x5F, 0xB3, 0xE1, 0xDC, 0x10, 0x3A, 0x5F, 0xAD,
+    0xE2, 0x30, 0x6F, 0x1D, 0xED, 0xCE, 0xD6, 0x98, 0x28, 0x50, 0xF1, 0x0E, 0xB6, 0x53, 0xAB, 0x70,
+    0x7B, 0xE5, 0x42, 0x05, 0x4E, 0x2B, 0x89, 0x4D, 0x05, 0x0E, 0x90, 0x62, 0x6C, 0x99, 0x38, 0x54,
+    0x34, 0x46, 0x06, 0x9B, 0x06, 0x15, 0x69, 0x89, 0xE9, 0xB4, 0x5E, 0x2A, 0x40, 0x08, 0xF8, 0x5D,
+    0xD8, 0x53, 0x80, 0xE0, 0x24, 0xFA, 0x2B, 0x33, 0x0B, 0x64, 0x08, 0x63, 0x9F, 0xC9, 0x9A, 0xC2,
+    0x58, 0x3D, 0xCA, 0x5B, 0x1C, 0xF8, 0x0E, 0xEA, 0x0B, 0x1C, 0x95, 0x9B, 0xD3, 0x52, 0xAF, 0x25,
+    0x6F, 0xFF, 0x58, 0xCC, 0x6F, 0xCD, 0x5F, 0xBB, 0xBC, 0x67, 0x2C, 0x1E, 0xF6, 0x67, 0x5F, 0x9B,
+    0xF9, 0xB3, 0x2F, 0xCD, 0x9E, 0xEE, 0xA3, 0x6D, 0xA4, 0xED, 0xA4, 0x6D, 0xA5, 0x38, 0xF6, 0xFE,
+    0xC1, 0x6C, 0x33, 0x4F, 0x44, 0xBF, 0xD2, 0x49, 0x2E, 0x31, 0x35, 0xD3, 0x37, 0xF1, 0x48, 0xDE,
+    0x0E, 0x5B, 0xE8, 0x4F, 0xB0, 0x28, 0xBC, 0x74, 0x97, 0xFB, 0xBC, 0xE7, 0x74, 0xD4, 0x02, 0xA8,
+    0x7B, 0x73, 0x47, 0x73, 0x9B, 0xF3, 0xB3, 0xF7, 0x5D, 0x4E, 0x4E, 0x3F, 0xD7, 0xB1, 0x3E, 0x1F,
+    0x41, 0xD1, 0xF7, 0x61, 0xFB, 0x17, 0x90, 0x28, 0xCD, 0xDF, 0x9D, 0xBE, 0x6B, 0x2D, 0x70, 0x06,
+    0xBE, 0x00, 0xB4, 0x44, 0x70, 0x41, 0x7C, 0xBD, 0xED, 0x69, 0x60, 0xE2, 0xAD, 0x26, 0x80, 0xB2,
+    0xF0, 0x85, 0x5C, 0x41, 0x7C, 0xC0, 0x2A, 0x87, 0x39, 0x46, 0x67, 0xCA, 0x54, 0x91, 0xA1, 0x80,
+    0xBE, 0x23, 0x7F, 0x0C, 0xFE, 0xE7, 0x32, 0x8E, 0x01, 0x38, 0xD2, 0xDE, 0x6E, 0xFA, 0x0E, 0x38,
+    0xAA, 0xE6, 0x2D, 0x06, 0x8D, 0x1A, 0x7C, 0xCD, 0x04, 0xC7, 0x05, 0x03, 0x7E, 0x2E, 0xE4, 0xFC,
+    0x5A, 0xB9, 0xE6, 0x40, 0x07, 0xF0, 0xC7, 0x78, 0x1D, 0x03, 0x6D, 0x4D, 0x71, 0xDB, 0x9C, 0xCF,
+    0x72, 0x46, 0x8F, 0xCA, 0xE0, 0x86, 0x0C, 0x76, 0x64, 0xB4, 0xB5, 0x5C, 0x76, 0x00, 0xD2, 0x2E,
+    0xB5, 0x69, 0x8D, 0xEE, 0x0B, 0x70, 0x1D, 0x28, 0x67, 0xD1, 0x2E, 0xEB, 0x5D, 0x43, 0xCE, 0xB1,
+    0xE9, 0x56, 0x5E, 0xF6, 0x82, 0x5B, 0x39, 0xD9, 0xF3, 0x18, 0xF2, 0x15, 0x48, 0x3A, 0x39, 0xB2,
+    0x54, 0x70, 0xDB, 0x03, 0x37, 0x84, 0x16, 0x06, 0xFF, 0x70, 0x28, 0xF1, 0xD3, 0x9C, 0xCA, 0x9B,
+    0x55, 0xB2, 0xB5, 0x4B, 0xD5, 0x2A, 0x6E, 0xC1, 0xED, 0x65, 0x23, 0xEA, 0x20, 0xED, 0xD5, 0xB9,
+    0xAF, 0xE7, 0x9F, 0xF7, 0x07, 0x5F, 0xB0, 0x0F, 0x6F, 0x5C, 0x34, 0xAD, 0xB2, 0xAE, 0x96, 0x29,
+    0x6E, 0x68, 0xB5, 0xD9, 0xB6, 0xC5, 0x81, 0x93, 0x09, 0x6F, 0x6E, 0x64, 0x71, 0xE2, 0xD3, 0x8B,
+    0x57, 0xCC, 0xE7, 0x1F, 0x50, 0x02, 0xA9, 0x50, 0x2C, 0x70, 0x00, 0xEB, 0x71, 0x43, 0x87, 0xF0,
+    0x61, 0xAF, 0x73, 0x37, 0xD8, 0x3C, 0xA1, 0xEA, 0xF2, 0x15, 0xC3, 0xF6, 0x20, 0x2F, 0x5C, 0x0B,
+    0x9A, 0xBE, 0x13, 0x00, 0x76, 0x30, 0x92, 0x65, 0x56, 0x3D, 0xF7, 0x6C, 0x93, 0x96, 0xB1, 0x99,
+    0xD1, 0x6B, 0xD4, 0x94, 0x31, 0x48, 0xD8, 0x45, 0xDA, 0xD9, 0x6D, 0xDE, 0x31, 0x1E, 0x5B, 0xF9,
+    0x0B, 0xF1, 0x89, 0xD5, 0x17, 0xEF, 0xA7, 0x95, 0x95, 0xC4, 0x4C, 0x2F, 0x16, 0x8E, 0x8B, 0xB6,
+    0xCE, 0x47, 0x85, 0x10, 0xC3, 0x50, 0x03, 0x94, 0xBC, 0x2D, 0x6D, 0x2F, 0x6E, 0xF6, 0x8A, 0x63,
+    0x31, 0x7F, 0xC5, 0xB1, 0xF7, 0x99, 0x57, 0x1C, 0xAD, 0xF0, 0x65, 0x65, 0x2F, 0x2B, 0x7A, 0x59,
+    0x29, 0xEA, 0x0B, 0x46, 0x96, 0xB9, 0x44, 0x8B, 0x5C, 0xB7, 0x77, 0x7D, 0x3B, 0x7A, 0x5A, 0xD2,
+    0x5A, 0x9D, 0x10, 0x25, 0x11, 0xE6, 0xA8, 0x91, 0x3D, 0x41, 0x73, 0xD3, 0xFF, 0x2D, 0x81, 0x95,
+    0x20, 0xAD, 0x41, 0x2F, 0x14, 0xB9, 0xBE, 0xA0, 0x3D, 0x35, 0x84, 0x84, 0x3E, 0x65, 0x26, 0x31,
+    0x75, 0xF5, 0x95, 0xC3, 0xF1, 0x1D, 0x5B, 0x69, 0x97, 0x95, 0xA8, 0x1E, 0xDB, 0x53, 0xBD, 0xE2,
+    0x3F, 0x8D, 0x54, 0xBF, 0x6F, 0xDB, 0x46, 0x14, 0xFE, 0xA8, 0x1F, 0xA1, 0x6B, 0x3A, 0xA2, 0xD0,
+    0xCA, 0x45, 0x9B, 0xC8, 0xA2, 0x87, 0xA2, 0x30, 0x04, 0x59, 0xD4, 0x20, 0x14, 0x4E, 0x60, 0x8B,
+    0xF7, 0x1F, 0x54, 0x43, 0x8C, 0x0E, 0x19, 0xA2, 0xA1, 0x43, 0x11, 0x14, 0x8D, 0x0A, 0x38, 0x80,
+    0x60, 0x48, 0x22, 0x81, 0xFE, 0x03, 0x9C, 0x3A, 0x15, 0x2D, 0x0B, 0x64, 0x28, 0x8C, 0x16, 0xE1,
+    0x90, 0x02, 0x1E, 0x6C, 0xEB, 0xD0, 0x31, 0x13, 0xB7, 0xAE, 0x44, 0x9B, 0xA9, 0x13, 0x07, 0x15,
+    0x50, 0x0C, 0xD9, 0xEC, 0x77, 0x94, 0x1D, 0xDB, 0x41, 0x0B, 0xF4, 0xDE, 0xF1, 0xF8, 0xEE, 0xC7,
+    0x7B, 0xEF, 0xBB, 0x77, 0xEF, 0xBD, 0x0A, 0x1C, 0x98, 0x5E, 0x5E, 0x22, 0x41, 0x59, 0xEB, 0x1A,
+    0x91, 0x25, 0x76, 0xB0, 0x07, 0x01, 0xAD, 0x0B, 0x7D, 0x0A, 0x73, 0x8E, 0x66, 0x13, 0x03, 0xDD,
+    0x03, 0x84, 0x26, 0x60, 0x4F, 0x1B, 0xF7, 0xCF, 0x0F, 0xFB, 0x76, 0x02, 0x4D, 0xD4, 0x0F, 0x3C,
+    0x27, 0x95, 0x00, 0xD2, 0xAC, 0xAD, 0xC3, 0xDB, 0xCE, 0x4B, 0xEB, 0xB9, 0x67, 0x9C, 0x03, 0x5D,
+    0x60, 0x74, 0x32, 0xAE, 0x6C, 0xE4, 0xBC, 0x8E, 0x21, 0xD9, 0x3F, 0xC8, 0x09, 0x3B, 0x3A, 0x9D,
+    0x8A, 0x01, 0xA6, 0x66, 0x64, 0x62, 0x19, 0xB7, 0x7C, 0x67, 0xBE, 0xB7, 0xD6, 0xBF, 0xBD, 0xB7,
+    0x66, 0xCF, 0x6E, 0xF9, 0x5A, 0xB7, 0xA2, 0x27, 0x73, 0xF3, 0xB7, 0xA9, 0x95, 0x8F, 0xB6, 0x4D,
+    0x51, 0x2E, 0xD0, 0xBE, 0x18, 0x18, 0x82, 0xA6, 0x09, 0x80, 0x30, 0x08, 0x06, 0x09, 0x1B, 0x7F,
+    0x71, 0xB8, 0x20, 0xBF, 0xB7, 0x5A, 0x14, 0xB6, 0x11, 0x99, 0xDF, 0x24, 0xF9, 0x68, 0x8A, 0x64,
+    0x1B, 0x14, 0x03, 0xB4, 0xA9, 0xEA, 0xE5, 0x44, 0x6C, 0xE5, 0x64, 0xF3, 0xA1, 0x67, 0xA6, 0xD0,
+    0x9E, 0xA9, 0x4E, 0x86, 0x53, 0x2E, 0x96, 0xA9, 0xDB, 0xD7, 0xBD, 0x35, 0x6C, 0x61, 0x1B, 0xAE,
+    0x70, 0x3D, 0xC7, 0x2B, 0xC2, 0x10, 0xB6, 0xB4, 0x23, 0x23, 0xCA, 0xC9, 0xBC, 0x67, 0x60, 0x40,
+    0x3D, 0x35, 0x38, 0x9E, 0xEB, 0x8D, 0x79, 0xAA, 0x01, 0x13, 0xB9, 0x08, 0xFF, 0x72, 0xE6, 0x01,
+    0xC6, 0xB0, 0x84, 0x2E, 0xB5, 0xF8, 0xCA, 0x75, 0x2F, 0x94, 0xEB, 0xA4, 0x26, 0x1D, 0xF9, 0x3E,
+    0x47, 0xA0, 0x4D, 0x72, 0xE4, 0x3D, 0xD1, 0x86, 0x6A, 0x93, 0xF9, 0xEA, 0x97, 0xA8, 0x5E, 0xD0,
+    0x52, 0x11, 0x96, 0xB4, 0xA4, 0x2E, 0x75, 0xCF, 0xA2, 0x1C, 0x9B, 0xBD, 0x17, 0x86, 0xA3, 0x5A,
+    0x91, 0x06, 0x4D, 0x3C, 0xF1, 0xD3, 0x64, 0xB7, 0x9B, 0x26, 0x8A, 0x5F, 0x26, 0x99, 0x98, 0xC4,
+    0xCF, 0x03, 0xC5, 0x03, 0xCE, 0x7C, 0xF5, 0x01, 0x7F, 0x61, 0x46, 0xC9, 0xC7, 0x89, 0x13, 0xDD,
+    0x11, 0xF4, 0x4C, 0x46, 0x09, 0x5E, 0x7B, 0xAE, 0xE4, 0xBC, 0xE3, 0x76, 0x0A, 0xD7, 0x1F, 0xC0,
+    0x88, 0x3B, 0x47, 0xED, 0x6A, 0xBB, 0xBA, 0x73, 0x64, 0xC4, 0xE8, 0x0C, 0x0F, 0x13, 0x8A, 0xE4,
+    0x85, 0x1E, 0x63, 0x8E, 0x21, 0x86, 0xF5, 0x99, 0xC3, 0x9B, 0x99, 0xD8, 0x21, 0x75, 0x60, 0xCF,
+    0x8D, 0x79, 0x48, 0x7F, 0x07, 0x4E, 0x3A, 0x77, 0xD3, 0xB3, 0x01, 0x36, 0xFB, 0xB8, 0xBD, 0x8E,
+    0x25, 0x1A, 0x0D, 0xE2, 0xE0, 0xEB, 0x24, 0x72, 0x26, 0xB2, 0x50, 0x54, 0x90, 0xD5, 0x9B, 0x9B,
+    0x82, 0x6F, 0x9E, 0x9F, 0x67, 0xCF, 0xDE, 0x55, 0x8C, 0x7E, 0x06, 0xF3, 0x91, 0xDA, 0x52, 0xCE,
+    0xA6, 0x0F, 0x34, 0xB9, 0xA3, 0x4B, 0x2B, 0x15, 0x5C, 0x67, 0xE3, 0x48, 0x9E, 0x2B, 0x5C, 0x67,
+    0x4C, 0x99, 0xD3, 0x6A, 0x27, 0x1D, 0xB6, 0xAD, 0xE9, 0xF5, 0x98, 0xAA, 0x1F, 0x28, 0x2E, 0x63,
+    0xA1, 0xFE, 0x97, 0xFC, 0xEA, 0xEE, 0xAE, 0x50, 0xBC, 0xFA, 0x53, 0xD6, 0x52, 0xB2, 0x47, 0x6D,
+    0x4B, 0xC5, 0x63, 0x76, 0x72, 0x5E, 0x3F, 0xF8, 0x09, 0x17, 0x42, 0x6A, 0x72, 0xA0, 0xA6, 0x02,
+    0xB9, 0x18, 0x96, 0xA7, 0x9D, 0x81, 0x37, 0x1F, 0x83, 0xE1, 0xFD, 0xA6, 0x35, 0x78, 0x83, 0x6C,
+    0x81, 0x1A, 0x62, 0xE4, 0x24, 0x98, 0x08, 0x3A, 0x31, 0xA9, 0x00, 0xF8, 0x9F, 0x9B, 0xE1, 0x42,
+    0xD3, 0x6C, 0xAD, 0x54, 0x1A, 0xBD, 0x68, 0x61, 0x65, 0x0F, 0x6B, 0x23, 0x8C, 0xE8, 0x35, 0x42,
+    0x61, 0xDF, 0x3F, 0xF8, 0x85, 0xBE, 0x63, 0x27, 0xB3, 0x00, 0x67, 0xFF, 0x20, 0x9F, 0xFE, 0x1D,
+    0x05, 0x61, 0x80, 0x32, 0xCA, 0xE2, 0xD7, 0xD8, 0x96, 0x96, 0x18, 0x47, 0xEB, 0x7E, 0xA1, 0x93,
+    0x24, 0xC3, 0xA6, 0x59, 0x3B, 0xBA, 0x71, 0xCB, 0xEB, 0x1E, 0xA8, 0xC0, 0xBD, 0x0A, 0x38, 0x61,
+    0x5E, 0x05, 0xDC, 0xDB, 0x9E, 0xB0, 0x61, 0x0B, 0x43, 0x18, 0x0A, 0x24, 0x50, 0xA1, 0x02, 0x7C,
+    0x3E, 0xDA, 0x98, 0x0F, 0x8F, 0xE7, 0x7B, 0xC7, 0x1F, 0x85, 0x9C, 0xF3, 0x89, 0x3B, 0x5C, 0x74,
+    0xE4, 0xB2, 0x78, 0xEB, 0x85, 0xFF, 0xCB, 0xD9, 0xD7, 0x13, 0xCF, 0x91, 0x4E, 0xA4, 0x91, 0xE0,
+    0xA9, 0x84, 0xFB, 0x14, 0xD6, 0x59, 0x66, 0xDB, 0x4D, 0xF0, 0x63, 0x06, 0x77, 0x83, 0xD9, 0xAF,
+    0xBC, 0xA3, 0x89, 0x82, 0x35, 0xAB, 0xEE, 0x4C, 0x66, 0x2D, 0xFA, 0xBD, 0x72, 0xB1, 0xA8, 0x44,
+    0x6E, 0xC2, 0x7D, 0x7B, 0x5A, 0x40, 0xE9, 0x21, 0xAF, 0xAC, 0x02, 0xA6, 0x58, 0x5C, 0x38, 0xD7,
+    0x24, 0x54, 0x4B, 0x98, 0x59, 0x62, 0xB8, 0x52, 0xD9, 0x5F, 0x8C, 0x7D, 0xB5, 0xC9, 0x91, 0xC7,
+    0xA2, 0x1E, 0x5E, 0xB6, 0xE0, 0x63, 0x49, 0xBC, 0xCB, 0xB5, 0x15, 0xE4, 0x39, 0xF6, 0x54, 0x3C,
+    0xF6, 0x38, 0x06, 0xFE, 0xC5, 0x49, 0xE6, 0x71, 0x2B, 0xEA, 0x13, 0x65, 0x39, 0xEA, 0xAB, 0xDD,
+    0x48, 0x9D, 0x09, 0xC0, 0xC8, 0xCE, 0x29, 0x29, 0xF1, 0x1E, 0xB0, 0xAE, 0xBD, 0x6C, 0xC3, 0x5B,
+    0xE8, 0x5C, 0x48, 0xED, 0x7B, 0x75, 0xAF, 0x4E, 0x8B, 0x6E, 0xE4, 0x44, 0x02, 0x87, 0xB0, 0x7C,
+    0x3D, 0xB6, 0x85, 0xCA, 0xD8, 0x77, 0x76, 0xC2, 0x70, 0xD0, 0xBC, 0xA8, 0x2F, 0xF6, 0xA3, 0xAC,
+    0xBE, 0x24, 0x62, 0x51, 0x83, 0xD8, 0x2E, 0x5F, 0xD7, 0x8D, 0xD6, 0x3D, 0x94, 0x73, 0xF1, 0x13,
+    0x71, 0xCC, 0x94, 0xE7, 0xEB, 0xE1, 0xA6, 0x1A, 0x1F, 0xFE, 0xB1, 0x96, 0x58, 0x7F, 0x24, 0xC6,
+    0x9F, 0xB3, 0x13, 0xBD, 0x11, 0x94, 0x4A, 0xBD, 0x61, 0xA9, 0xB4, 0x79, 0x08, 0x1C, 0x9D, 0x1D,
+    0xD3, 0x71, 0x79, 0x79, 0xFF, 0xE7, 0xBB, 0xAF, 0xEC, 0xD9, 0x27, 0xDF, 0xE5, 0xA5, 0xF1, 0x6D,
+    0xDC, 0x3C, 0x39, 0xDC, 0xDA, 0x6E, 0xB0, 0x6F, 0x9E, 0x0C, 0x8C, 0xDF, 0xE3, 0x2D, 0x96, 0x18,
+    0x37, 0x7E, 0x1C, 0x31, 0x9B, 0xBC, 0x85, 0xBB, 0xB2, 0x90, 0x8C, 0x37, 0x55, 0xAE, 0x79, 0x06,
+    0xAF, 0x3C, 0x86, 0x96, 0x9E, 0xA6, 0x84, 0xB4, 0x9C, 0x9E, 0x5E, 0x46, 0xBE, 0xAF, 0x86, 0x9E,
+    0x4A, 0x05, 0x4D, 0x32, 0x9C, 0x59, 0xDE, 0xF4, 0xD7, 0xB8, 0xC5, 0x04, 0x75, 0xD3, 0x94, 0x22,
+    0xDA, 0xC1, 0xB3, 0x2C, 0x00, 0x76, 0xC5, 0x84, 0x99, 0x14, 0x67, 0xDC, 0x63, 0xA6, 0x93, 0x9F,
+    0x4D, 0x33, 0x0D, 0xDA, 0x84, 0x47, 0xAA, 0x46, 0x9A, 0xBE, 0xC2, 0x60, 0x13, 0x77, 0xD3, 0x34,
+    0x61, 0x91, 0xBB, 0x73, 0x2E, 0x2E, 0x0C, 0xDC, 0x4D, 0xC9, 0x6A, 0xE9, 0x5F, 0x93, 0x29, 0x16,
+    0x18, 0x1A, 0x19, 0x9E, 0x05, 0xB6, 0x37, 0x09, 0xA8, 0x29, 0x23, 0x9F, 0x65, 0x46, 0x22, 0x5A,
+    0xCE, 0x02, 0x2F, 0xBF, 0xD8, 0x2A, 0xA2, 0x1D, 0x95, 0x83, 0x0F, 0xE3, 0x20, 0x08, 0xE2, 0x7D,
+    0xBE, 0x44, 0x51, 0x6C, 0x05, 0xFD, 0xD6, 0x7E, 0xD8, 0x47, 0x0B, 0x35, 0xC2, 0xAF, 0xA2, 0xC0,
+    0xA8, 0x6A, 0xBC, 0xA9, 0xA7, 0x5F, 0xF1, 0x44, 0x3B, 0x08, 0x5A, 0x7E, 0x3B, 0x68, 0xF7, 0x5B,
+    0x75, 0xDA, 0xAC, 0x70, 0x9B, 0x3B, 0x2B, 0x97, 0xBD, 0x0A, 0xE3, 0xFB, 0x45, 0x00, 0x6E, 0x84,
+    0xAD, 0x72, 0x8B, 0x7A, 0xDA, 0x30, 0x89, 0x45, 0x4B, 0xD0, 0x2F, 0xF6, 0x9F, 0x26, 0x51, 0xC8,
+    0x08, 0xE9, 0x07, 0x61, 0x87, 0xD5, 0x7D, 0xA0, 0x0C, 0xA0, 0xDA, 0x45, 0xED, 0x8B, 0x6B, 0x1A,
+    0x56, 0x30, 0x2A, 0xA1, 0xDC, 0xED, 0xA2, 0x39, 0x66, 0x21, 0xCF, 0x56, 0xAE, 0xBE, 0x71, 0x49,
+    0xED, 0xD5, 0xFA, 0x97, 0x80, 0x9A, 0x04, 0x78, 0x8F, 0xD4, 0xCE, 0x68, 0x43, 0x55, 0x0D, 0xAC,
+    0x16, 0xD1, 0xB8, 0x8D, 0x95, 0x25, 0x94, 0x2A, 0xD0, 0xD7, 0x91, 0xF7, 0xE9, 0x7E, 0xAC, 0x56,
+    0x50, 0xDB, 0x80, 0xDE, 0x53, 0x35, 0x26, 0x17, 0x60, 0x69, 0x0B, 0x9B, 0x1D, 0xFC, 0x03, 0xD5,
+    0x7D, 0x5D, 0x8C, 0x1C, 0xD7, 0x95, 0xDE, 0xAD, 0x2A, 0x72, 0xCA, 0x66, 0x45, 0x53, 0x44, 0x20,
+    0xAD, 0xB4, 0xA2, 0xC8, 0xD2, 0x83, 0x1E, 0x14, 0x9A, 0x62, 0xEF, 0x03, 0x11, 0x8C, 0x81, 0x61,
+    0x57, 0x51, 0x42, 0x62, 0x20, 0x06, 0x22, 0x26, 0x10, 0x2D, 0x24, 0xCA, 0x2E, 0xFD, 0xB0, 0x8B,
+    0x00, 0xF2, 0xC6, 0xC3, 0x00, 0x7C, 0x20, 0x10, 0x4E, 0x57, 0xC9, 0x7A, 0xF0, 0x43, 0x10, 0x78,
+    0x12, 0xC0, 0xCA, 0x83, 0x13, 0x84, 0x0F, 0x0A, 0x40, 0x35, 0xB1, 0x99, 0x79, 0xA0, 0x11, 0x21,
+    0x98, 0x99, 0x2A, 0x49, 0xD8, 0xF8, 0xC1, 0x08, 0x5C, 0xB2, 0x64, 0xEB, 0xC1, 0x01, 0x54, 0xF6,
+    0x92, 0x0E, 0x22, 0x6E, 0xC2, 0xA2, 0xD5, 0x8C, 0x6B, 0x86, 0xD5, 0x5D, 0xF9, 0xBE, 0x73, 0xAB,
+    0x6A, 0xBA, 0x87, 0x33, 0xC3, 0x1F, 0x0D, 0x49, 0xED, 0x70, 0xEE, 0xB9, 0x3D, 0xDD, 0xD5, 0x55,
+    0xF7, 0xE7, 0xDC, 0x73, 0xBE, 0xF3, 0x73, 0x2F, 0x95, 0xC2, 0xCF, 0x0A, 0x8A, 0x8F, 0xE2, 0x46,
+    0x4A, 0x99, 0x09, 0x5E, 0x9C, 0xE4, 0xBB, 0x2A, 0xAE, 0xAA, 0xE2, 0x74, 0x55, 0x95, 0x56, 0xAE,
+    0xCE, 0xA3, 0xCC, 0xA2, 0x1C, 0x41, 0xD9, 0x83, 0xA2, 0xDA, 0xB2, 0xDE, 0x8F, 0xAC, 0xAA, 0x4A,
+    0x26, 0xDE, 0xDB, 0x28, 0x0E, 0x8A, 0x8B, 0xE2, 0x79, 0xEB, 0x7D, 0xDC, 0xAE, 0xAA, 0xD4, 0xC9,
+    0xBD, 0x4A, 0x15, 0x78, 0x50, 0xE9, 0x26, 0xEA, 0xC2, 0xBE, 0x40, 0xD5, 0x3F, 0x0F, 0xE2, 0x59,
+    0x3E, 0x4A, 0xAA, 0x34, 0x9D, 0x35, 0x73, 0x2B, 0x55, 0x33, 0x66, 0x6E, 0xA4, 0xEA, 0x98, 0x99,
+    0xAB, 0x54, 0x3D, 0x0B, 0xBA, 0x80, 0xFE, 0xE6, 0x7C, 0x7C, 0x43, 0x9F, 0x40, 0x83, 0xCC, 0xF5,
+    0x6A, 0x08, 0x5A, 0xBD, 0x55, 0x05, 0xCA, 0x1C, 0x28, 0x2F, 0xE1, 0xA7, 0x4E, 0x46, 0x6A, 0xE7,
+    0xB7, 0x51, 0x79, 0xDF, 0x49, 0x95, 0x35, 0x50, 0xE8, 0xD1, 0x81, 0xA1, 0x11, 0x2B, 0x55, 0x55,
+    0x1F, 0x0D, 0x70, 0xBB, 0x27, 0x50, 0x7A, 0x28, 0xA5, 0xBE, 0xBF, 0x85, 0xD1, 0x35, 0xDA, 0xDE,
+    0x0E, 0xD0, 0xDB, 0x02, 0xAD, 0x7D, 0x17, 0x65, 0xA6, 0x2E, 0xCF, 0x6D, 0xD3, 0xB3, 0x1D, 0x8B,
+    0xB7, 0xC6, 0x07, 0x26, 0xFA, 0xC6, 0x4E, 0x95, 0xA9, 0xF8, 0x47, 0x25, 0x9A, 0xBD, 0x6A, 0xA3,
+    0xEB, 0x68, 0xD1, 0x0B, 0x9D, 0x40, 0x4F, 0x2E, 0x4B, 0xC8, 0x72, 0xEA, 0x94, 0x0A, 0x31, 0x11,
+    0x61, 0xFD, 0xB7, 0x7C, 0x86, 0x6B, 0x3A, 0x68, 0x1E, 0xAE, 0x67, 0x4F, 0xA7, 0xAC, 0x42, 0x1D,
+    0x55, 0xD5, 0xB5, 0x52, 0x79, 0xB8, 0x9F, 0x7A, 0x45, 0x6E, 0x6D, 0x54, 0x85, 0x72, 0xAE, 0xC6,
+    0xAA, 0x13, 0x78, 0x51, 0x17, 0xAC, 0xD2, 0x55, 0x4E, 0xD0, 0x6D, 0xBE, 0x8F, 0xEF, 0x7A, 0xE8,
+    0xB2, 0x5D, 0xE1, 0x45, 0x5C, 0xB0, 0x1D, 0xEC, 0x25, 0xEE, 0xE6, 0xA5, 0xBC, 0xE3, 0x73, 0x18,
+    0xA7, 0x73, 0xCA, 0xCA, 0x96, 0x95, 0x9D, 0xF6, 0xF0, 0x94, 0xCE, 0xBF, 0x0D, 0x71, 0x2D, 0xAE,
+    0xDB, 0xCB, 0xB1, 0x88, 0x4E, 0x0F, 0x03, 0xF4, 0xE4, 0x5E, 0x7F, 0xD1, 0xF1, 0xAA, 0x8A, 0x1E,
+    0xDF, 0xAB, 0x96, 0xBD, 0x08, 0xBF, 0xCF, 0xEF, 0x6B, 0x59, 0xE9, 0x0B, 0xDD, 0xD0, 0xA9, 0x8A,
+    0xBD, 0xD5, 0xC7, 0xEC, 0xD6, 0x17, 0xF9, 0xED, 0xC9, 0xAA, 0x2A, 0xD5, 0x81, 0x5C, 0xF5, 0xC0,
+    0x46, 0xE0, 0xC1, 0x11, 0x86, 0x10, 0xE3, 0x7E, 0x93, 0xEB, 0x4C, 0x06, 0x7A, 0x53, 0x35, 0xBD,
+    0x4D, 0xF5, 0xD9, 0xDB, 0x4A, 0x1D, 0x52, 0x6E, 0x05, 0x6E, 0x3C, 0x88, 0x37, 0xBD, 0x4C, 0x2A,
+    0xB0, 0xDB, 0x11, 0x54, 0x46, 0xA1, 0x66, 0x59, 0x95, 0x52, 0xE1, 0x79, 0xE7, 0xF4, 0x5F, 0x97,
+    0xE5, 0x33, 0x23, 0x97, 0x2B, 0x17, 0x59, 0x39, 0x19, 0x78, 0x24, 0xFC, 0x2C, 0x8E, 0xC2, 0x00,
+    0x6B, 0xA8, 0x50, 0x7B, 0xDA, 0xC1, 0xE2, 0x9D, 0xE7, 0x86, 0xC1, 0x1C, 0xF8, 0x08, 0x3C, 0xED,
+    0x68, 0xB6, 0x02, 0x5F, 0xDF, 0x55, 0x55, 0x49, 0xCF, 0xB0, 0x32, 0x2F, 0xAD, 0xC7, 0x99, 0xBC,
+    0x69, 0x0D, 0xF4, 0x67, 0xA5, 0xAE, 0x86, 0xBA, 0x5A, 0x9D, 0xA8, 0x86, 0xE3, 0x97, 0x58, 0x05,
+    0x06, 0xDE, 0x5B, 0x5F, 0xCC, 0x2A, 0xB6, 0x65, 0xA4, 0xBE, 0xE0, 0xB2, 0xED, 0x83, 0xF5, 0xC0,
+    0xFF, 0x1D, 0x59, 0xB6, 0xEE, 0x18, 0x75, 0xB6, 0xA2, 0x18, 0x47, 0x2C, 0xDE, 0x03, 0x43, 0xE5,
+    0x0C, 0x30, 0xF9, 0x29, 0xF9, 0xD6, 0xA0, 0xF4, 0xB3, 0x79, 0x67, 0x99, 0x02, 0x8F, 0x8F, 0x98,
+    0x21, 0xD9, 0xBF, 0xC1, 0x60, 0x10, 0x56, 0xC3, 0x20, 0x64, 0x87, 0x3B, 0xE4, 0xB4, 0x59, 0x8E,
+    0xC7, 0x00, 0xC4, 0x84, 0x20, 0xC8, 0x9D, 0x08, 0xE4, 0x10, 0xC7, 0xE8, 0x1C, 0x85, 0x56, 0xC1,
+    0x61, 0x1A, 0xF2, 0xCF, 0x98, 0xC4, 0xC7, 0x43, 0x73, 0x37, 0x03, 0xB1, 0xE5, 0x1B, 0x25, 0xBF,
+    0x5B, 0x91, 0x84, 0x11, 0xEF, 0x97, 0x62, 0x34, 0x9C, 0x02, 0x63, 0x61, 0x54, 0xF5, 0xF3, 0xB0,
+    0x22, 0xDB, 0xBE, 0xAA, 0x77, 0x85, 0xBE, 0x20, 0x74, 0xAF, 0xDA, 0x10, 0x9F, 0x91, 0x5F, 0xA5,
+    0x68, 0xD3, 0x81, 0x11, 0xDB, 0xA3, 0x6F, 0x0A, 0xE6, 0x20, 0x63, 0x0B, 0x75, 0x84, 0x1E, 0x15,
+    0xFA, 0x63, 0x52, 0xE3, 0xD7, 0xA4, 0xF6, 0x1B, 0xA4, 0xAE, 0x5C, 0x39, 0x2B, 0x34, 0x27, 0xFD,
+    0x9C, 0x8C, 0x65, 0xDD, 0x0A, 0x48, 0x87, 0x72, 0x9F, 0x41, 0x7D, 0xB7, 0x96, 0xA2, 0x95, 0xF6,
+    0x28, 0xA8, 0xE4, 0xB9, 0x6A, 0x9F, 0x7A, 0x0E, 0x02, 0x44, 0x1D, 0xA7, 0x14, 0x19, 0x72, 0xF5,
+    0x53, 0xFC, 0x9D, 0xAA, 0xDB, 0x06, 0x59, 0x13, 0x97, 0xE0, 0xAE, 0xD3, 0x03, 0x17, 0xD3, 0x9D,
+    0x60, 0x64, 0xED, 0x00, 0x8D, 0x72, 0x15, 0xF8, 0x74, 0x5A, 0xA9, 0x21, 0x18, 0x19, 0x82, 0x68,
+    0x86, 0x52, 0xE8, 0x2C, 0x86, 0x3B, 0x41, 0x3F, 0xDD, 0x14, 0x62, 0xC3, 0xFE, 0x1D, 0x86, 0xDF,
+    0xFA, 0x9C, 0x52, 0x53, 0x46, 0xA2, 0x6A, 0x54, 0x15, 0x86, 0x1B, 0x3F, 0x18, 0x5B, 0xF5, 0x2D,
+    0x8E, 0x09, 0x9E, 0x0F, 0x42, 0x4D, 0xB2, 0x47, 0x8F, 0x84, 0x16, 0x00, 0xF7, 0x27, 0x03, 0xEE,
+    0x47, 0x6C, 0x80, 0xF9, 0x87, 0x8A, 0x0B, 0x81, 0x52, 0x58, 0x4B, 0x62, 0x5F, 0x6D, 0xD0, 0xA3,
+    0x42, 0x0F, 0x0A, 0xFD, 0x8A, 0xD0, 0xAE, 0xD0, 0x50, 0xCF, 0x9C, 0xA8, 0xC0, 0xEB, 0x11, 0x25,
+    0xEC, 0xA7, 0xFC, 0xAE, 0xF5, 0x13, 0xF6, 0xC7, 0x7A, 0x93, 0x5D, 0x73, 0x5E, 0x12, 0x36, 0xC4,
+    0x70, 0x53, 0x06, 0x40, 0x8F, 0x60, 0xAC, 0x56, 0x64, 0x00, 0xA8, 0x57, 0xE6, 0x4F, 0x85, 0x32,
+    0xBC, 0xEC, 0x7B, 0xA6, 0xBC, 0x48, 0x81, 0xFB, 0xC0, 0xB2, 0x56, 0x42, 0x96, 0xB6, 0x23, 0x99,
+    0x76, 0xA1, 0x10, 0xC2, 0x0E, 0x5A, 0x58, 0x42, 0xEE, 0x47, 0xB5, 0xEA, 0x19, 0x6C, 0x52, 0x3D,
+    0xFB, 0x27, 0xD4, 0x0A, 0x6E, 0x69, 0xDD, 0x9C, 0xC3, 0x35, 0x06, 0x97, 0x28, 0x17, 0x6D, 0x38,
+    0x56, 0x7A, 0x28, 0x43, 0x72, 0x2E, 0x16, 0x6D, 0x8E, 0x15, 0x1B, 0xC4, 0x15, 0x64, 0x07, 0x6E,
+    0x4A, 0xA6, 0x36, 0x85, 0x41, 0x84, 0xFF, 0x56, 0x5A, 0x32, 0x6C, 0xDE, 0x03, 0x13, 0x5B, 0xEB,
+    0x71, 0xC4, 0x27, 0xF0, 0x62, 0x43, 0xAE, 0xEB, 0x91, 0xF8, 0x42, 0x82, 0x49, 0xA2, 0xBF, 0xEB,
+    0xAD, 0x5F, 0x2A, 0xD8, 0xCD, 0xE8, 0x81, 0xE8, 0x4D, 0xA3, 0x92, 0x11, 0x9C, 0xAB, 0xD8, 0x09,
+    0x57, 0x3E, 0x72, 0xA0, 0xAA, 0x26, 0xA9, 0x3B, 0x46, 0xA7, 0xC7, 0xE8, 0x63, 0x42, 0x9F, 0x11,
+    0x7A, 0x44, 0xE8, 0xAC, 0xD0, 0x19, 0xA1, 0x97, 0x85, 0xE6, 0xA4, 0x46, 0x46, 0x8A, 0xA9, 0x01,
+    0xFD, 0xCE, 0x67, 0x90, 0x96, 0x81, 0x40, 0x94, 0x88, 0xD3, 0x1F, 0x46, 0xCB, 0x02, 0xBE, 0xB8,
+    0xB4, 0xED, 0x68, 0x89, 0xB3, 0x5F, 0x53, 0x4A, 0x22, 0x23, 0x78, 0x10, 0xD8, 0xC8, 0xAB, 0x20,
+    0x93, 0xA0, 0xAE, 0x1D, 0x00, 0x96, 0x81, 0x39, 0x0A, 0x30, 0x3B, 0x5E, 0x62, 0x60, 0xD9, 0x1E,
+    0x47, 0x43, 0x20, 0x72, 0xA9, 0x95, 0x22, 0x70, 0x0F, 0x1A, 0xE4, 0x46, 0x87, 0x28, 0x7E, 0x52,
+    0x37, 0x92, 0x75, 0x97, 0xBB, 0xD1, 0x65, 0x59, 0x84, 0xEE, 0x1B, 0x22, 0x97, 0xFC, 0xC5, 0x6B,
+    0x59, 0x8D, 0x69, 0x44, 0x42, 0x95, 0xEE, 0xF7, 0xC8, 0xA8, 0x16, 0x40, 0xDE, 0x90, 0x2C, 0x8C,
+    0xEB, 0xC9, 0xA6, 0x2E, 0xBE, 0x0F, 0xD1, 0x07, 0xA8, 0xE0, 0x46, 0x6E, 0x4A, 0xEE, 0xC7, 0xFD,
+    0x73, 0x2E, 0x7F, 0x3C, 0x0F, 0x3C, 0x23, 0xCF, 0x1F, 0x29, 0x0F, 0x2C, 0x76, 0x45, 0x41, 0x4B,
+    0xA1, 0x37, 0x23, 0x6A, 0x4F, 0x3E, 0x1A, 0x33, 0xE3, 0x5D, 0x8D, 0x23, 0x1F, 0x37, 0x99, 0x87,
+    0x64, 0xA6, 0xB4, 0xDD, 0x23, 0x3D, 0xA3, 0x0A, 0xA2, 0x90, 0x06, 0xC6, 0x39, 0x8C, 0x35, 0x12,
+    0x42, 0xC7, 0x52, 0xF0, 0x8B, 0xF4, 0x86, 0xC8, 0x52, 0x66, 0xB1, 0x07, 0xE5, 0x3C, 0xF4, 0xC1,
+    0xB2, 0x88, 0x5F, 0x27, 0xF3, 0x3F, 0x9E, 0x8B, 0x6C, 0x4A, 0xE3, 0xBD, 0x8F, 0x5C, 0x68, 0x4E,
+    0xA9, 0xA7, 0xA8, 0x5E, 0x02, 0x41, 0xDE, 0x09, 0xC7, 0xC8, 0xAE, 0x38, 0x72, 0xEA, 0x89, 0xE0,
+    0xCB, 0x21, 0xD6, 0x1F, 0x9A, 0x9E, 0x33, 0xC5, 0x32, 0x20, 0x3A, 0x92, 0x25, 0xE8, 0xC8, 0x52,
+    0x73, 0xD2, 0x86, 0x4E, 0x6F, 0x43, 0x0F, 0x09, 0x3D, 0x38, 0x46, 0x8F, 0x08, 0x9D, 0x1D, 0xA3,
+    0xE7, 0x84, 0x5E, 0x26, 0x35, 0x04, 0xA7, 0x2F, 0x0A, 0x96, 0xC7, 0xBA, 0x07, 0x5E, 0x0D, 0x03,
+    0x2C, 0xFE, 0x1A, 0x09, 0xC5, 0x25, 0x9B, 0x9F, 0x9D, 0x1E, 0x71, 0x1A, 0x4E, 0x5A, 0x50, 0x36,
+    0x2E, 0x5A, 0x8C, 0x6A, 0x1A, 0xD5, 0xA7, 0x91, 0x7A, 0x06, 0xD5, 0xCF, 0x12, 0x35, 0xCB, 0x0A,
+    0x58, 0x04, 0xD5, 0x4F, 0x32, 0xB5, 0x84, 0xEA, 0x83, 0x5C, 0xE5, 0xA8, 0xDE, 0x1F, 0x18, 0x29,
+    0xAA, 0xF7, 0x4A, 0x33, 0x41, 0x95, 0x94, 0x56, 0xC4, 0x6A, 0xD5, 0x0E, 0x58, 0xF9, 0xAE, 0x92,
+    0xEA, 0x1F, 0x4A, 0xE5, 0xFD, 0x07, 0xA9, 0x70, 0x7F, 0x56, 0x00, 0x1E, 0xAC, 0x6C, 0x0A, 0x48,
+    0x0F, 0x23, 0x3D, 0x85, 0xE1, 0x2F, 0xCD, 0x14, 0xC8, 0x1B, 0xE3, 0x1F, 0x56, 0x49, 0x3B, 0xFB,
+    0x16, 0x87, 0x91, 0xD0, 0xE6, 0x0E, 0x14, 0xEA, 0x68, 0x20, 0xC0, 0xEC, 0x2E, 0xAF, 0x6F, 0x28,
+    0xEE, 0x8F, 0x29, 0x39, 0x40, 0x55, 0xC6, 0xE7, 0x6A, 0x0E, 0x3C, 0x40, 0x03, 0x20, 0x7E, 0x6B,
+    0xC8, 0x4F, 0x3B, 0x11, 0xC6, 0x0F, 0xEB, 0x38, 0xC1, 0xFA, 0xC2, 0x8A, 0xC3, 0x14, 0x73, 0x85,
+    0x81, 0x18, 0x05, 0xB8, 0xD7, 0x28, 0xB7, 0x22, 0xF2, 0xA9, 0x5C, 0x27, 0xDF, 0xF0, 0x84, 0x29,
+    0xA0, 0x8E, 0x52, 0xB2, 0x40, 0xA4, 0x46, 0x7F, 0x0F, 0xE3, 0x2D, 0x46, 0x86, 0x7A, 0x5C, 0x44,
+    0x08, 0x9E, 0x0D, 0x51, 0x57, 0x3D, 0x34, 0xDD, 0xDD, 0x74, 0x38, 0xAE, 0x12, 0x6A, 0x31, 0x3C,
+    0x1B, 0x2D, 0x13, 0x08, 0x4B, 0x71, 0xBB, 0x52, 0x6B, 0xBF, 0xA6, 0x0C, 0xF5, 0xFB, 0xF6, 0x00,
+    0x4A, 0x2C, 0xB5, 0x70, 0xFD, 0xDD, 0x1B, 0x65, 0x6F, 0xED, 0x6C, 0x94, 0x6D, 0x2A, 0x77, 0x63,
+    0x94, 0x09, 0x42, 0x16, 0x82, 0x25, 0x6E, 0xA5, 0x33, 0xC0, 0xFB, 0xE9, 0x31, 0x2C, 0xE1, 0xF4,
+    0x59, 0x90, 0x05, 0x25, 0xA0, 0xE1, 0x3E, 0x89, 0x49, 0x62, 0x0F, 0xA9, 0x9B, 0xF0, 0xAC, 0x87,
+    0x0B, 0xE0, 0x00, 0x1C, 0x5F, 0x11, 0xA1, 0x4F, 0x61, 0x2E, 0xF6, 0x23, 0xB0, 0xC5, 0xC7, 0x14,
+    0xEC, 0xC4, 0x0C, 0xE6, 0xE8, 0xE5, 0xBF, 0x1C, 0x61, 0x38, 0x60, 0x43, 0x26, 0x5E, 0x42, 0xB3,
+    0xC6, 0xA7, 0x8D, 0x93, 0x87, 0x62, 0xE9, 0x90, 0x9A, 0xC5, 0xAA, 0xD0, 0xB0, 0xA5, 0xD6, 0x40,
+    0x5F, 0x23, 0xD7, 0xA7, 0xF2, 0xDD, 0x48, 0xDF, 0x47, 0xDF, 0xB3, 0xBE, 0xBF, 0xA2, 0x5A, 0xAA,
+    0x9F, 0x6B, 0xC0, 0x48, 0x46, 0xDF, 0x83, 0x6A, 0xE0, 0x8D, 0x54, 0x98, 0x52, 0x3B, 0xB1, 0xA3,
+    0x68, 0x77, 0xCC, 0x76, 0xFB, 0x01, 0xE7, 0xF8, 0x7D, 0x4E, 0xCC, 0xFF, 0x0A, 0x94, 0x88, 0x09,
+    0x0E, 0x06, 0x7E, 0x46, 0x4D, 0x47, 0xAD, 0xEB, 0xFC, 0xF4, 0x65, 0x8A, 0x29, 0x6A, 0xA3, 0x59,
+    0x0E, 0xE9, 0x65, 0xDC, 0x02, 0x40, 0x20, 0x54, 0x50, 0xB0, 0x7E, 0xE4, 0x5D, 0x81, 0xAA, 0x8B,
+    0x4B, 0xAB, 0x2A, 0x1F, 0x0D, 0x66, 0x5D, 0x8F, 0x1A, 0xCC, 0xAA, 0x95, 0xA6, 0xA2, 0x3D, 0xC4,
+    0x96, 0x8F, 0x51, 0xF1, 0x06, 0x29, 0x83, 0xF2, 0x00, 0xBF, 0x90, 0x43, 0x1E, 0x44, 0xD1, 0x80,
+    0xC2, 0xE0, 0x6E, 0x24, 0x8A, 0xD6, 0x2A, 0x1A, 0xFD, 0xA9, 0xF8, 0xB7, 0x71, 0xCE, 0x01, 0xBF,
+    0x95, 0x73, 0x78, 0x2D, 0xD1, 0xEC, 0x3B, 0xD3, 0x03, 0x43, 0xAD, 0x03, 0xB1, 0x32, 0xDF, 0xAC,
+    0x06, 0x22, 0x0A, 0x4F, 0x54, 0xA9, 0x16, 0x86, 0x7E, 0xA0, 0x81, 0xA6, 0x5F, 0x3F, 0xEA, 0x91,
+    0xD4, 0x04, 0x53, 0x2D, 0xF6, 0xAF, 0xBE, 0xEC, 0xED, 0xAC, 0xE7, 0xBB, 0x92, 0xE5, 0xD6, 0x2E,
+    0x2D, 0x2C, 0xD3, 0xBA, 0xB6, 0xEA, 0xDA, 0xAC, 0x6B, 0xA3, 0xAE, 0x15, 0xB0, 0x00, 0x56, 0xA7,
+    0x4F, 0xDD, 0x4E, 0xEC, 0x29, 0x90, 0x5B, 0x1D, 0x23, 0x79, 0x56, 0x26, 0x6A, 0x8C, 0xAC, 0xFF,
+    0x67, 0xB1, 0x1E, 0xD2, 0x46, 0xEB, 0x8F, 0x19, 0x02, 0x82, 0xF2, 0xC3, 0xF6, 0xD5, 0xAA, 0xFE,
+    0xD4, 0xA6, 0xC1, 0x40, 0xE3, 0x5F, 0xD1, 0xF4, 0xC7, 0x2A, 0x40, 0xCD, 0x65, 0xA0, 0xE6, 0x34,
+    0xD7, 0xD8, 0x79, 0x23, 0x53, 0x77, 0xAC, 0xD6, 0xDF, 0x91, 0x4A, 0xA4, 0x37, 0x9F, 0x5D, 0xE8,
+    0xCF, 0x4A, 0x5D, 0xAD, 0xEA, 0x2A, 0xD4, 0x95, 0x3F, 0xF1, 0x57, 0x4F, 0x57, 0x43, 0xA9, 0xCC,
+    0xC2, 0xCE, 0xA5, 0x35, 0xE2, 0x0A, 0x1A, 0x69, 0xC5, 0x10, 0x29, 0xB6, 0x67, 0x5B, 0x53, 0x82,
+    0x8F, 0x96, 0xE7, 0xCA, 0x43, 0xC7, 0xED, 0x25, 0x7F, 0x93, 0xBD, 0x54, 0x68, 0x27, 0xC7, 0x48,
+    0x8F, 0x72, 0x55, 0x10, 0xD4, 0x06, 0x1A, 0xD4, 0x02, 0xA6, 0x09, 0x58, 0x15, 0x1B, 0x6F, 0x58,
+    0x97, 0x55, 0x75, 0xB8, 0x0F, 0xE9, 0x23, 0x5F, 0x58, 0xAD, 0x0B, 0xDF, 0x2F, 0x79, 0xDD, 0x06,
+    0xA8, 0x75, 0x13, 0xFF, 0x43, 0x40, 0xDB, 0xDA, 0x9D, 0xB6, 0x81, 0x1C, 0x6D, 0x88, 0x36, 0xB4,
+    0xDC, 0x7F, 0x6B, 0xA4, 0x87, 0xDA, 0x03, 0xEC, 0x22, 0x64, 0x64, 0x53, 0x09, 0xCB, 0xA0, 0x88,
+    0x13, 0xDC, 0x44, 0x2A, 0x28, 0x10, 0xEA, 0x66, 0x9A, 0x7B, 0xB0, 0x23, 0xD1, 0x0B, 0x1A, 0x69,
+    0xA8, 0x68, 0x74, 0xB1, 0x4F, 0x9D, 0x89, 0xAA, 0xBE, 0xB2, 0xFE, 0x5E, 0x7D, 0x17, 0x47, 0xDF,
+    0x93, 0x2E, 0x9D, 0x54, 0x2C, 0x3B, 0x2F, 0xC2, 0x28, 0x86, 0xFF, 0x68, 0x55, 0x3B, 0xD5, 0x06,
+    0xD2, 0xAC, 0xC7, 0xC9, 0x57, 0x8B, 0x15, 0x75, 0x58, 0x05, 0xF1, 0x17, 0x40, 0x0F, 0x0E, 0x89,
+    0xDE, 0x4B, 0x10, 0xA3, 0x25, 0xF2, 0xA7, 0xFE, 0x20, 0x24, 0xF1, 0xAE, 0x86, 0xE2, 0x43, 0xC3,
+    0x2C, 0x0C, 0xF0, 0xA7, 0x93, 0x81, 0x40, 0x88, 0x83, 0x27, 0xA3, 0xE6, 0x12, 0x5E, 0x0C, 0x29,
+    0xED, 0x07, 0x07, 0x72, 0x23, 0x4E, 0x7D, 0x74, 0xBE, 0x34, 0xE2, 0x4C, 0xB9, 0xBF, 0x65, 0x3B,
+    0x7C, 0x48, 0xEF, 0x0E, 0xF0, 0xB6, 0x27, 0x78, 0x9B, 0xE6, 0x82, 0x11, 0x57, 0x81, 0x77, 0x75,
+    0x0E, 0xA3, 0xEF, 0x05, 0x2B, 0x28, 0xCB, 0x78, 0x6F, 0x05, 0xDF, 0xEE, 0xC1, 0x1E, 0xF7, 0xAF,
+    0xFD, 0x2C, 0x75, 0x47, 0x50, 0x75, 0xDA, 0x0B, 0xBE, 0x5F, 0x11, 0x39, 0x4E, 0x51, 0x87, 0xC3,
+    0xBC, 0x42, 0xAB, 0x09, 0x4F, 0x3D, 0x31, 0xC5, 0xB1, 0x14, 0xC2, 0xA1, 0xFA, 0xBB, 0x57, 0xE7,
+    0xA2, 0x7F, 0x15, 0xD9, 0x19, 0x79, 0x7B, 0x15, 0x43, 0xB1, 0x8A, 0x51, 0x59, 0x41, 0x99, 0xAF,
+    0x4B, 0x57, 0x10, 0x90, 0x39, 0xE8, 0x10, 0xFA, 0xE0, 0x3A, 0xFB, 0x0A, 0x86, 0x31, 0x1E, 0xD2,
+    0xB2, 0x53, 0xFD, 0xFE, 0xDB, 0x44, 0x3D, 0x98, 0x14, 0x2F, 0xB1, 0x53, 0x27, 0xAD, 0x0B, 0x5E,
+    0x7B, 0x11, 0x1D, 0xA4, 0xF6, 0x7A, 0x15, 0xE8, 0xF7, 0x30, 0x69, 0x6D, 0xB1, 0x33, 0xEF, 0xEA,
+    0x62, 0x02, 0x94, 0x84, 0xEF, 0xF7, 0xEB, 0xEF, 0xBB, 0x18, 0x76, 0x07, 0xC5, 0x46, 0x31, 0x65,
+    0x4D, 0xEF, 0x54, 0xE8, 0xAC, 0xE5, 0xDC, 0x4E, 0xE1, 0x06, 0xD1, 0x94, 0xD8, 0xD6, 0xB4, 0x13,
+    0xD4, 0x0C, 0x4D, 0xC0, 0x0D, 0x72, 0xAC, 0x25, 0x67, 0x48, 0x96, 0x48, 0x72, 0x92, 0x0C, 0xC4,
+    0xA4, 0xBD, 0x68, 0x91, 0xBC, 0xF6, 0xC3, 0x6F, 0xAD, 0x89, 0x3D, 0x9B, 0xAC, 0x52, 0xFF, 0xC3,
+    0x9A, 0xB5, 0x93, 0xCB, 0x54, 0x21, 0x4B, 0xD4, 0x20, 0x4B, 0x8D, 0x1A, 0x01, 0x57, 0x66, 0xE8,
+    0x11, 0x2D, 0xBE, 0x0E, 0xE6, 0xC3, 0x4D, 0xBA, 0x28, 0xF3, 0x68, 0xFB, 0x0A, 0x0A, 0xBE, 0x9E,
+    0xAE, 0x9E, 0x3A, 0x15, 0x10, 0x1F, 0xCC, 0xD7, 0x3E, 0x12, 0xA0, 0xA0, 0xC0, 0x4B, 0x80, 0x8D,
+    0xD7, 0x17, 0x81, 0xD4, 0x87, 0xE2, 0x3E, 0xEF, 0x5F, 0xE8, 0x5F, 0x3C, 0x7C, 0x31, 0xCE, 0xE3,
+    0xA2, 0x53, 0x38, 0x50, 0xE8, 0x6E, 0x64, 0x40, 0xA1, 0xC3, 0x0A, 0x59, 0x72, 0x93, 0x59, 0x5A,
+    0xA5, 0x7C, 0xDE, 0xB4, 0xFB, 0x1E, 0xAD, 0x07, 0x11, 0x75, 0x9D, 0xC5, 0x6B, 0x58, 0xA6, 0xA1,
+    0xFB, 0x7E, 0x41, 0xDB, 0x14, 0xE0, 0xDC, 0x28, 0x68, 0x6D, 0x91, 0x6F, 0xFD, 0x00, 0xE3, 0x06,
+    0x18, 0x31, 0x97, 0x74, 0xAE, 0x38, 0x03, 0x2C, 0xF7, 0xD2, 0x18, 0x3A, 0xA3, 0xC0, 0xFF, 0x51,
+    0x5E, 0x1A, 0xE5, 0x65, 0x55, 0x3E, 0xCB, 0xE5, 0x58, 0x2A, 0x33, 0x37, 0xAB, 0xC0, 0x84, 0x88,
+    0xE2, 0x9F, 0xF3, 0xFB, 0x55, 0x77, 0x49, 0xF5, 0x0A, 0xB5, 0xB2, 0x0A, 0x4C, 0x8B, 0x07, 0xBC,
+    0xA2, 0xFA, 0xEF, 0x4C, 0xF5, 0x17, 0xE2, 0x35, 0xBB, 0x5A, 0x00, 0x6B, 0x0C, 0x39, 0xBE, 0xF4,
+    0x73, 0x83, 0x93, 0x31, 0x1B, 0x24, 0x87, 0xF8, 0xE7, 0xBB, 0x20, 0x3F, 0x4F, 0x41, 0x7E, 0x05,
+    0x66, 0xB3, 0x87, 0xBC, 0x64, 0x20, 0xD7, 0x69, 0x02, 0x36, 0x1D, 0x18, 0xC0, 0x1B, 0x43, 0x17,
+    0x8C, 0xF6, 0xA7, 0x26, 0xD6, 0x59, 0x41, 0xDF, 0xC1, 0x90, 0x16, 0x6E, 0x87, 0x8B, 0xB0, 0xE6,
+    0x46, 0xB5, 0xEB, 0x4F, 0xEB, 0xBF, 0xF3, 0xF4, 0x3B, 0x2A, 0x5E, 0xF3, 0x86, 0x60, 0x6C, 0x7C,
+    0x04, 0x2E, 0x0A, 0x40, 0x0E, 0x92, 0x4F, 0xCE, 0x91, 0x50, 0x08, 0x13, 0x24, 0xD9, 0xB7, 0xE8,
+    0xE0, 0x87, 0x8D, 0x03, 0x12, 0x93, 0xF8, 0xBC, 0x8E, 0xC6, 0x40, 0x4A, 0xA1, 0x39, 0x30, 0xA1,
+    0x07, 0x87, 0x58, 0x3E, 0x64, 0xA9, 0xC0, 0xA4, 0x5B, 0x48, 0x83, 0x9E, 0x59, 0x93, 0xDC, 0x44,
+    0xEF, 0xE5, 0x26, 0x42, 0x7F, 0xAE, 0x3A, 0x4B, 0xB2, 0x44, 0x42, 0xDF, 0x90, 0x91, 0x81, 0xBC,
+    0x96, 0xE2, 0x1B, 0x55, 0x82, 0x56, 0xC7, 0xEC, 0xBA, 0x60, 0xC2, 0xFE, 0x05, 0x96, 0xB8, 0x00,
+    0x92, 0xCC, 0x1C, 0xCC, 0xC8, 0x88, 0x9D, 0x82, 0x0D, 0x6B, 0x87, 0xCA, 0x99, 0x57, 0xF6, 0x5C,
+    0x30, 0x0D, 0x7A, 0x3A, 0x39, 0x08, 0xFA, 0x72, 0x32, 0x0B, 0xFA, 0x8D, 0xEC, 0x2C, 0xE8, 0x4B,
+    0xF9, 0x12, 0xE8, 0x8B, 0x45, 0x06, 0x1A, 0x8C, 0x12, 0xD2, 0x38, 0x22, 0x0D, 0xA1, 0x84, 0xBC,
+    0xD4, 0xE7, 0x18, 0x14, 0x07, 0x9D, 0x2A, 0xEF, 0xBF, 0xB3, 0xAF, 0x1F, 0xC5, 0x6B, 0x0E, 0x24,
+    0x55, 0x46, 0xAD, 0x94, 0x6E, 0x41, 0x2A, 0x88, 0x2D, 0x7B, 0xBD, 0xBF, 0xCD, 0xA7, 0x7A, 0x50,
+    0xCD, 0x91, 0x0C, 0x6A, 0xAA, 0xE6, 0xAE, 0x28, 0x6B, 0x0D, 0xB2, 0x39, 0x82, 0x9C, 0x52, 0x56,
+    0xD6, 0x05, 0xBF, 0xCD, 0x43, 0x06, 0x40, 0x2E, 0xB0, 0x14, 0x75, 0x19, 0xF0, 0xBD, 0x9E, 0x58,
+    0x52, 0x56, 0xE6, 0x05, 0x4E, 0x42, 0xD1, 0xC6, 0x40, 0x8B, 0x70, 0x3A, 0xD7, 0x26, 0x57, 0x15,
+    0xCD, 0x2E, 0x79, 0x42, 0x71, 0x1F, 0xC4, 0x1B, 0xD8, 0xBA, 0x4D, 0x49, 0xFF, 0x0D, 0xC8, 0xF4,
+    0xF8, 0xA7, 0x90, 0xC4, 0xCE, 0xFF, 0x81, 0x35, 0xEE, 0x50, 0x07, 0xA3, 0xB7, 0x3E, 0xAD, 0xE2,
+    0x4D, 0xA4, 0x33, 0xFE, 0xA7, 0x5C, 0x42, 0xAD, 0xED, 0x14, 0xE0, 0x32, 0xE7, 0xD3, 0x45, 0xDC,
+    0xE0, 0x03, 0x74, 0xD1, 0x49, 0x20, 0xCD, 0x69, 0x5D, 0x6F, 0x26, 0x14, 0x2E, 0x4A, 0xAB, 0xB9,
+    0xF8, 0x8A, 0xB2, 0xD7, 0x46, 0x10, 0xC1, 0x1D, 0x11, 0xB5, 0x5D, 0xD8, 0x0B, 0xF3, 0xB5, 0x11,
+    0xB0, 0xB9, 0xF4, 0x6A, 0xB3, 0x07, 0x0B, 0x3E, 0x70, 0xD6, 0x63, 0x89, 0x37, 0x51, 0xA1, 0x1D,
+    0x86, 0x8C, 0x04, 0x00, 0x29, 0x66, 0x9D, 0xE4, 0xDC, 0x31, 0x27, 0x99, 0x61, 0x79, 0x96, 0xCF,
+    0x26, 0x5A, 0xDD, 0xAE, 0xD0, 0x66, 0x9A, 0x1B, 0xE0, 0x1E, 0x23, 0xD5, 0xBF, 0x68, 0xF6, 0x83,
+    0xB8, 0xC0, 0x12, 0x06, 0xBE, 0x3F, 0xCF, 0x16, 0x9E, 0xA5, 0x3E, 0x5C, 0xA2, 0x43, 0x3D, 0x53,
+    0x34, 0x9A, 0xA8, 0xD3, 0x70, 0xFD, 0x3C, 0x03, 0x74, 0xBE, 0x43, 0x34, 0xEC, 0xD2, 0x1A, 0xF8,
+    0x8F, 0x24, 0x7F, 0x4D, 0x80, 0x24, 0xFE, 0x2C, 0x76, 0xCA, 0x10, 0x5C, 0x9A, 0x35, 0x20, 0x49,
+    0x30, 0x32, 0x96, 0x8B, 0xDA, 0x23, 0x1E, 0x2E, 0x71, 0x77, 0x89, 0x9E, 0x6B, 0x1D, 0x38, 0xAA,
+    0x53, 0xB6, 0xA6, 0xC1, 0x16, 0xE4, 0x40, 0xB5, 0x00, 0x5E, 0x1E, 0xC1, 0xA0, 0x49, 0x4B, 0x0F,
+    0x0A, 0xAD, 0xB4, 0x61, 0xCE, 0x40, 0xB3, 0xF6, 0x54, 0x49, 0x3E, 0x29, 0xC9, 0x24, 0xA5, 0x2A,
+    0x5B, 0x52, 0xF0, 0x03, 0x28, 0x13, 0xD8, 0x92, 0xB8, 0x98, 0x22, 0x0C, 0x12, 0xCD, 0x5A, 0x1B,
+    0xC6, 0x34, 0x56, 0x06, 0x5B, 0x3F, 0x43, 0xC8, 0xD4, 0x88, 0x6A, 0x4F, 0x6C, 0x1D, 0xC5, 0x21,
+    0x7D, 0xBA, 0xAF, 0x3A, 0xA3, 0x03, 0x00, 0x06, 0x03, 0x4A, 0x99, 0x92, 0x3D, 0xEF, 0x49, 0xCF,
+    0xFF, 0x19, 0x3B, 0x32, 0x68, 0xF1, 0x1C, 0xED, 0x40, 0x97, 0xB3, 0x73, 0x84, 0x53, 0x73, 0x96,
+    0x01, 0xE2, 0x8C, 0xC1, 0x4E, 0xC2, 0x2C, 0x2F, 0xB3, 0xE9, 0x54, 0xF6, 0xAB, 0x68, 0x7C, 0xF5,
+    0x18, 0xF7, 0xCF, 0xA9, 0x57, 0xBF, 0x35, 0x0C, 0x1A, 0x8B, 0x44, 0x42, 0x2F, 0x32, 0xBE, 0xA2,
+    0x3B, 0x8C, 0x96, 0xA8, 0xE0, 0xF5, 0x3E, 0x9E, 0x36, 0x37, 0xC2, 0xD3, 0xC4, 0x67, 0x62, 0x65,
+    0x5B, 0x10, 0x7E, 0x60, 0x0E, 0xA7, 0x4A, 0x02, 0x21, 0x90, 0xA9, 0x93, 0xDB, 0x8D, 0x89, 0x57,
+    0xA5, 0x10, 0x80, 0x7D, 0x69, 0xBF, 0x37, 0x92, 0x1E, 0x58, 0x03, 0x59, 0x6D, 0x66, 0xBE, 0x6B,
+    0x95, 0x77, 0xF5, 0xD5, 0xB5, 0x53, 0xA3, 0xA0, 0x46, 0xDF, 0x0F, 0xE9, 0x79, 0xC3, 0x60, 0x1C,
+    0xED, 0x3B, 0xE9, 0x38, 0xC6, 0xAF, 0x21, 0x7E, 0x83, 0xF0, 0x1B, 0xA0, 0x7F, 0xB8, 0x7F, 0x11,
+    0x2B, 0x80, 0xEB, 0x6E, 0x96, 0xE3, 0x7F, 0xAC, 0x25, 0xCF, 0xEA, 0x40, 0xE5, 0x2F, 0x48, 0xA8,
+    0x87, 0xA1, 0x40, 0x23, 0x10, 0xBC, 0x4B, 0x8B, 0xBA, 0x25, 0x89, 0x7E, 0x6F, 0xEE, 0x17, 0x31,
+    0x1D, 0x6B, 0x05, 0x24, 0x98, 0xDA, 0x07, 0x5D, 0x05, 0xF6, 0xAE, 0x52, 0xA2, 0xA6, 0x55, 0xC1,
+    0x1E, 0xF3, 0x93, 0xF4, 0x6A, 0x40, 0x8A, 0x85, 0x0A, 0x9A, 0x75, 0x28, 0xA3, 0x81, 0x6F, 0xE6,
+    0x05, 0x44, 0x6E, 0xA6, 0x4E, 0xB6, 0x42, 0xCC, 0xFC, 0x1E, 0xA4, 0x76, 0xB5, 0xE6, 0x42, 0x6A,
+    0xF7, 0x31, 0xBF, 0x23, 0x1D, 0x20, 0x9B, 0x40, 0x38, 0xB8, 0x27, 0xEF, 0xC8, 0xFB, 0xF1, 0x6E,
+    0x93, 0xE8, 0xC9, 0x01, 0x7A, 0x8A, 0x13, 0xFA, 0x1A, 0xA1, 0xEB, 0x15, 0x94, 0xBD, 0x5A, 0x06,
+    0xF4, 0xB9, 0x0C, 0x21, 0xF4, 0xAC, 0x6A, 0x03, 0xDA, 0x30, 0x51, 0x43, 0xE2, 0xFA, 0xF6, 0x6F,
+    0xA8, 0x7D, 0xC8, 0x8C, 0x79, 0xF0, 0x69, 0xA1, 0x56, 0xC1, 0x78, 0xA2, 0x94, 0x4F, 0x52, 0x1D,
+    0x13, 0xD5, 0x40, 0x1F, 0x7F, 0x46, 0x05, 0xEA, 0x01, 0xD1, 0x42, 0x33, 0x62, 0x1C, 0xEC, 0x94,
+    0xC8, 0xC6, 0xA6, 0x0E, 0xCE, 0xA8, 0x35, 0xAD, 0x8C, 0xDE, 0x5D, 0x3C, 0x7F, 0x5D, 0xA8, 0x7E,
+    0xA7, 0xFE, 0x74, 0x85, 0x7D, 0x4E, 0xBB, 0xF2, 0xAD, 0x0E, 0xC4, 0xA4, 0x37, 0x70, 0xD3, 0x1E,
+    0xB4, 0xA9, 0xA9, 0x51, 0x33, 0x51, 0xFD, 0xD3, 0xFD, 0x77, 0xA0, 0x53, 0xD7, 0xE8, 0xBC, 0x90,
+    0x7F, 0x51, 0x5D, 0xE3, 0x9F, 0x3D, 0x70, 0x13, 0x83, 0xAB, 0x26, 0x3C, 0x9D, 0x10, 0xE1, 0x98,
+    0x05, 0x9D, 0x1D, 0xF8, 0x24, 0xA5, 0xA3, 0xA3, 0x33, 0xA0, 0x5E, 0x66, 0x4C, 0x53, 0x3C, 0x3B,
+    0x8C, 0x34, 0x74, 0x28, 0xD3, 0x36, 0x44, 0xD4, 0x6E, 0xA0, 0x32, 0x33, 0x62, 0x88, 0x1F, 0x0C,
+    0x98, 0x2D, 0x03, 0xD6, 0x3E, 0xB7, 0xAB, 0xF7, 0x96, 0x20, 0x03, 0xB1, 0xC7, 0x40, 0x02, 0xBB,
+    0xEA, 0x6B, 0xA3, 0x8B, 0x52, 0x4C, 0xF9, 0x7B, 0xAF, 0x32, 0x6F, 0x54, 0x99, 0xF9, 0xFB, 0x4B,
+    0x25, 0x00, 0xC8, 0x10, 0x7A, 0xAD, 0x87, 0xF7, 0xBB, 0x77, 0x2A, 0x90, 0x5C, 0x5D, 0x08, 0xAE,
+    0x6E, 0xFD, 0xD8, 0xA6, 0xCC, 0x6B, 0xD1, 0xC0, 0x27, 0x41, 0xD4, 0x71, 0xD0, 0xE8, 0xBB, 0x21,
+    0xF3, 0x7B, 0x75, 0x10, 0xB8, 0x8E, 0x01, 0x7F, 0x51, 0xDC, 0xBD, 0x93, 0x62, 0x5C, 0x3D, 0x15,
+    0xD0, 0xD4, 0xB8, 0xA3, 0x62, 0x04, 0xD6, 0xE8, 0x5C, 0xCA, 0xCF, 0x2B, 0x98, 0x81, 0xF9, 0xB2,
+    0x3A, 0x89, 0xCB, 0x7C, 0x18, 0x3C, 0x23, 0x7C, 0x9E, 0xF2, 0x39, 0x06, 0xE0, 0xEB, 0xF9, 0x25,
+    0x75, 0xBE, 0x50, 0xEF, 0xF6, 0xA6, 0x72, 0x0F, 0x0F, 0x15, 0x04, 0x49, 0xE0, 0x5E, 0x08, 0x2F,
+    0x34, 0x80, 0xF2, 0xF0, 0xDB, 0xAA, 0x23, 0xFE, 0x1C, 0x63, 0xE7, 0xDF, 0x82, 0x98, 0xCB, 0x17,
+    0xE9, 0x7C, 0xD4, 0x49, 0x7C, 0x97, 0xBF, 0x7B, 0x8C, 0xFB, 0xBE, 0x89, 0x31, 0x30, 0x0B, 0xFC,
+    0x79, 0x52, 0x7F, 0xBB, 0x33, 0x30, 0x07, 0xC6, 0x8E, 0xFF, 0xCC, 0x9C, 0x76, 0xEB, 0x5C, 0x32,
+    0x14, 0xA3, 0x85, 0x06, 0xB4, 0x40, 0x0C, 0xF1, 0x48, 0x80, 0x52, 0xB5, 0xCD, 0x4C, 0xD0, 0x9B,
+    0x01, 0x29, 0xAD, 0xC6, 0x63, 0x30, 0x59, 0xA1, 0xF6, 0x2D, 0xC6, 0x31, 0x96, 0x2C, 0x62, 0xCC,
+    0x1C, 0x74, 0x60, 0x64, 0x7C, 0xE7, 0xB5, 0x14, 0x0B, 0x31, 0xAF, 0x12, 0xEF, 0xE6, 0x5C, 0x12,
+    0x63, 0xE0, 0x47, 0xB5, 0x17, 0xB2, 0x7F, 0x11, 0x42, 0x5A, 0xC5, 0x05, 0x64, 0x34, 0x16, 0x36,
+    0x91, 0x2C, 0x50, 0xF6, 0x60, 0x4B, 0x2A, 0x6E, 0x6B, 0xFB, 0xEA, 0xB7, 0xD6, 0x5E, 0xCB, 0xF9,
+    0x8E, 0x51, 0xC8, 0xFB, 0xE5, 0x66, 0x6A, 0x14, 0x00, 0x63, 0x6B, 0xDF, 0xC9, 0xAB, 0xA1, 0x27,
+    0x31, 0xDB, 0x9A, 0xAF, 0x85, 0xDD, 0x84, 0x9B, 0x85, 0xAD, 0x35, 0x31, 0x04, 0x6E, 0x80, 0xBB,
+    0x95, 0x71, 0x13, 0x6A, 0xDB, 0xF8, 0xFD, 0x35, 0x18, 0x2E, 0x43, 0xFA, 0x0F, 0xC1, 0xE1, 0xFC,
+    0xB4, 0x4B, 0xE2, 0xDF, 0x81, 0x98, 0x24, 0x1C, 0xF0, 0x05, 0x0C, 0xB9, 0x9F, 0xEB, 0x94, 0x24,
+    0x1D, 0x96, 0x5E, 0x96, 0x58, 0x5E, 0xA3, 0x64, 0x9B, 0x69, 0x54, 0xBB, 0x6D, 0x0D, 0x88, 0xC5,
+    0xAF, 0x43, 0xDD, 0xB4, 0xBC, 0x61, 0x18, 0xF2, 0x69, 0xD9, 0x78, 0x3A, 0xC5, 0xAE, 0x9B, 0x4F,
+    0xDF, 0xA6, 0xF9, 0x34, 0xA0, 0xAA, 0x2B, 0xA9, 0xF6, 0x42, 0x8E, 0xB5, 0xD1, 0x9A, 0x4F, 0x8F,
+    0x08, 0x0E, 0xEE, 0x1A, 0x46, 0x1A, 0xD5, 0x18, 0xC9, 0x2E, 0x1A, 0x94, 0x26, 0xC3, 0xA9, 0xC7,
+    0x34, 0x9D, 0x44, 0x9F, 0x6E, 0xC6, 0x40, 0xFA, 0xC0, 0x2F, 0x54, 0x27, 0x71, 0xCA, 0x7F, 0x3C,
+    0xD4, 0x39, 0x42, 0x23, 0xBE, 0x3F, 0x8F, 0x49, 0x01, 0xAA, 0x3F, 0xAE, 0x23, 0xED, 0xC7, 0x55,
+    0x27, 0x42, 0x97, 0x66, 0x21, 0x64, 0xCC, 0xB1, 0x94, 0x22, 0x87, 0x9E, 0xEF, 0x73, 0xD4, 0x51,
+    0x43, 0x8C, 0x10, 0x94, 0x4A, 0x8F, 0xD1, 0xEC, 0xFC, 0x31, 0x1F, 0xA3, 0x64, 0x0E, 0x8E, 0xF8,
+    0x26, 0x3D, 0x40, 0xC7, 0x3A, 0x2F, 0xD1, 0x2D, 0xB4, 0xE4, 0xFD, 0x6B, 0x4A, 0xCF, 0xD4, 0xFD,
+    0x1F, 0x92, 0xFA, 0xE5, 0x72, 0x94, 0xC2, 0x48, 0x06, 0xC0, 0xD7, 0xE9, 0x34, 0x5D, 0xCE, 0xFE,
+    0xD3, 0xF8, 0x67, 0xA5, 0x58, 0x6E, 0x81, 0x9D, 0x43, 0x7A, 0x46, 0x5C, 0xD6, 0x00, 0x0E, 0xB9,
+    0x39, 0x40, 0x07, 0x73, 0xB1, 0x7A, 0xA1, 0x90, 0xCD, 0x1C, 0xFD, 0x99, 0xC7, 0xA2, 0x4F, 0x20,
+    0xAF, 0x0B, 0x0C, 0x6C, 0xC7, 0x2A, 0xA1, 0xB2, 0xBC, 0x6F, 0x9E, 0xC7, 0x5C, 0xB8, 0xFF, 0xA6,
+    0x0B, 0x86, 0x74, 0xFF, 0xA7, 0x3F, 0xC3, 0xB5, 0xD3, 0x11, 0x47, 0x1C, 0x65, 0xB4, 0x95, 0xB9,
+    0x81, 0x0E, 0x41, 0x1A, 0x10, 0xAF, 0x14, 0x98, 0x24, 0x68, 0xDB, 0xE1, 0xC5, 0xCF, 0x2E, 0x30,
+    0xE7, 0x2D, 0x57, 0x67, 0xBD, 0x28, 0x57, 0x67, 0xBC, 0xE8, 0x8C, 0xFE, 0x40, 0x79, 0xFF, 0x5B,
+    0x30, 0x20, 0x83, 0x50, 0x51, 0x27, 0x01, 0x71, 0x32, 0xF1, 0x93, 0xB5, 0x64, 0x30, 0xF1, 0x27,
+    0x58, 0x26, 0x04, 0xB8, 0x91, 0x04, 0x2A, 0xE1, 0x6B, 0xED, 0xA1, 0x94, 0xDC, 0x9C, 0xCD, 0x85,
+    0x80, 0xFC, 0x6B, 0xEB, 0x17, 0x6E, 0xFF, 0x6C, 0x1D, 0xE6, 0xF1, 0xFA, 0x22, 0xE4, 0x19, 0xD4,
+    0x15, 0xCC, 0x2A, 0x94, 0x6E, 0x5D, 0xAF, 0x3C, 0x79, 0xF3, 0xD5, 0x41, 0x28, 0xFA, 0xA1, 0x76,
+    0xE2, 0x89, 0x31, 0x38, 0x87, 0x79, 0xBB, 0x5A, 0xF1, 0x41, 0x3D, 0x1D, 0x86, 0x2D, 0x19, 0x33,
+    0xC7, 0x88, 0x49, 0xBA, 0x42, 0xED, 0x7D, 0xB5, 0x75, 0x25, 0xB9, 0x42, 0xA8, 0x84, 0x1F, 0xD7,
+    0x17, 0xF1, 0x2C, 0x9D, 0xA3, 0x15, 0xE8, 0xB8, 0xDB, 0xF8, 0x25, 0xD9, 0xF8, 0xF7, 0xEA, 0xBB,
+    0x98, 0x35, 0x53, 0x0D, 0x95, 0xC9, 0x07, 0xC5, 0x81, 0x13, 0x78, 0x6B, 0xAA, 0xB3, 0x5E, 0x51,
+    0x6B, 0xD9, 0xB5, 0x13, 0x4F, 0x8C, 0xB2, 0xC0, 0x19, 0xC1, 0x84, 0x08, 0xC2, 0xC5, 0x14, 0x63,
+    0x54, 0x30, 0xB3, 0x83, 0x37, 0x31, 0x29, 0x58, 0x01, 0x42, 0xA9, 0xEB, 0x4C, 0x69, 0x85, 0xC9,
+    0x46, 0x90, 0x62, 0x90, 0xEB, 0x77, 0xEA, 0x4F, 0x29, 0xA6, 0xF9, 0x2D, 0xB5, 0x1F, 0xA2, 0xB8,
+    0x54, 0x4B, 0x4F, 0x42, 0x5E, 0x5C, 0xCA, 0xC2, 0x2A, 0xF2, 0xF4, 0x00, 0x70, 0xC5, 0x1E, 0x1F,
+    0xCB, 0x94, 0xD1, 0xE9, 0x50, 0x92, 0x29, 0x63, 0xFE, 0x4C, 0xCC, 0x83, 0x9F, 0xB2, 0x43, 0xF6,
+    0x4B, 0xEC, 0x88, 0x23, 0x1D, 0x98, 0x16, 0xB1, 0xE9, 0xF5, 0xC9, 0x7B, 0xBE, 0x04, 0xD3, 0x67,
+    0x4A, 0xAA, 0xCF, 0x25, 0xC6, 0x21, 0x55, 0x5E, 0x76, 0x02, 0x60, 0xDE, 0x52, 0x72, 0x64, 0x84,
+    0x46, 0x30, 0xB8, 0xB0, 0x62, 0xE9, 0xB4, 0x75, 0x41, 0x07, 0x2A, 0x4C, 0x4B, 0x1A, 0x35, 0xB8,
+    0x92, 0x89, 0x60, 0x17, 0x9A, 0x85, 0xEE, 0xF0, 0x56, 0x2E, 0x15, 0xF4, 0x41, 0xC2, 0x84, 0x59,
+    0x22, 0xA8, 0x63, 0x34, 0x86, 0xFE, 0xDB, 0x22, 0x1A, 0x72, 0xEB, 0x3A, 0x56, 0xC3, 0x4F, 0x3E,
+    0xC0, 0xCA, 0xF8, 0xFE, 0xFB, 0xB9, 0xB2, 0xBF, 0x91, 0x14, 0xCA, 0xB5, 0x93, 0x52, 0x1D, 0xB2,
+    0x93, 0x15, 0x15, 0xDA, 0x09, 0xE4, 0xD2, 0xF7, 0xDF, 0x67, 0x74, 0x20, 0x60, 0x3E, 0x0E, 0xA7,
+    0x53, 0x20, 0x05, 0x47, 0xDE, 0xD3, 0xA9, 0x74, 0xCA, 0xAF, 0xBD, 0xC9, 0x5F, 0x1F, 0xE8, 0x7A,
+    0xA9, 0xD0, 0x75, 0x5E, 0x4A, 0x6D, 0x00, 0x4C, 0x4A, 0x58, 0x25, 0xF1, 0x25, 0xD5, 0xE3, 0xD2,
+    0x67, 0x71, 0x3D, 0xAF, 0x95, 0x24, 0xF8, 0xB8, 0xDE, 0xCB, 0x0C, 0xAC, 0xAA, 0x69, 0xEF, 0x9B,
+    0x74, 0xBD, 0xAB, 0x23, 0xDE, 0x4B, 0xE2, 0xD5, 0x9E, 0xAD, 0xEB, 0x73, 0xDE, 0x09, 0x89, 0x42,
+    0x2C, 0x79, 0x81, 0x18, 0x47, 0x39, 0xBD, 0x9E, 0x98, 0x2D, 0xE0, 0xD5, 0x50, 0x79, 0x6B, 0xCE,
+    0xC0, 0x3B, 0xC1, 0xDC, 0xBB, 0xC5, 0xA1, 0xF7, 0x8D, 0x2A, 0xC3, 0xDC, 0x4E, 0xA1, 0x99, 0x98,
+    0x5C, 0x37, 0x93, 0xFE, 0x7B, 0x9A, 0x73, 0x8F, 0x0F, 0xA4, 0x3A, 0xAB, 0xD3, 0x59, 0x97, 0x96,
+    0xA5, 0xCA, 0xBA, 0x9C, 0xE2, 0x4B, 0x80, 0x25, 0xAC, 0xAE, 0x2F, 0x06, 0x9C, 0x5E, 0xF7, 0x65,
+    0xA6, 0xD7, 0x4D, 0xBB, 0x68, 0x8C, 0x99, 0x1F, 0x74, 0x5F, 0x62, 0x8E, 0xEC, 0x11, 0xF7, 0x25,
+    0x26, 0xCC, 0xCE, 0xB8, 0x2F, 0x16, 0xEA, 0xC9, 0x1B, 0xA5, 0xFB, 0xD2, 0x50, 0x85, 0x9F, 0x8F,
+    0xDC, 0x6F, 0x56, 0x75, 0x72, 0x64, 0x9D, 0x22, 0x89, 0x9B, 0x9F, 0x17, 0xC8, 0xC3, 0x58, 0x51,
+    0x40, 0xB1, 0x0A, 0x80, 0x1B, 0xC9, 0x0A, 0x97, 0xE0, 0xA4, 0x44, 0x0E, 0x57, 0x98, 0x80, 0x62,
+    0xC4, 0x6B, 0x4D, 0x50, 0x50, 0x85, 0xEE, 0x07, 0x03, 0x7A, 0xF7, 0xDE, 0x2B, 0xC7, 0x7C, 0x7C,
+    0xE8, 0x21, 0x90, 0x71, 0x4F, 0x7B, 0xFA, 0x20, 0xC3, 0xE8, 0x31, 0x76, 0x6B, 0x7F, 0xDF, 0xDC,
+    0x15, 0xF7, 0xCA, 0x08, 0x00, 0xD3, 0x2C, 0x4D, 0x80, 0x89, 0x05, 0x19, 0xCB, 0x54, 0xD0, 0x09,
+    0x25, 0xBF, 0xE2, 0xB3, 0x3A, 0xC1, 0xAC, 0x84, 0xC4, 0xC8, 0x57, 0xE6, 0xE7, 0x89, 0x58, 0xEB,
+    0x5C, 0x1D, 0xA3, 0x5E, 0x18, 0xD0, 0xAB, 0x4B, 0xFE, 0xC9, 0xBB, 0x34, 0x86, 0xB3, 0x2E, 0x58,
+    0xD9, 0x49, 0xBB, 0x9C, 0x88, 0xA4, 0x8B, 0x9B, 0xF8, 0x41, 0x1C, 0x0C, 0xD5, 0xC8, 0xAA, 0xA0,
+    0x15, 0x31, 0xEB, 0xA1, 0x4C, 0x13, 0xA6, 0x3D, 0xD4, 0x82, 0x9B, 0x51, 0x21, 0x3E, 0x42, 0xAE,
+    0x67, 0x2A, 0x9F, 0xCE, 0x86, 0x3C, 0xA7, 0xA7, 0x78, 0x60, 0xD4, 0xBC, 0x20, 0x5A, 0x48, 0x98,
+    0xC3, 0x0D, 0xEA, 0xA8, 0xF2, 0x7F, 0x91, 0x55, 0xDD, 0xEF, 0x2F, 0x8E, 0x82, 0x3A, 0xF7, 0xB2,
+    0xD2, 0x8C, 0xE2, 0xBE, 0x9F, 0xAF, 0xCA, 0x8B, 0xCE, 0x8B, 0x8C, 0xCA, 0x33, 0xF8, 0x60, 0xEA,
+    0x18, 0xBD, 0x0A, 0x4D, 0xBA, 0xF4, 0x19, 0x85, 0x31, 0x73, 0x69, 0xB3, 0x2A, 0x4D, 0x8A, 0x02,
+    0xFD, 0xC2, 0xD1, 0x39, 0x5B, 0x22, 0x00, 0xC0, 0x08, 0xF9, 0x81, 0x21, 0x35, 0x77, 0x15, 0x03,
+    0x30, 0x44, 0x31, 0x96, 0xF9, 0x3F, 0xA0, 0x37, 0xAF, 0x33, 0x7A, 0x99, 0x22, 0x44, 0x9C, 0x05,
+    0x1E, 0x26, 0xD1, 0xA0, 0xA6, 0xA0, 0xBC, 0x52, 0x92, 0x03, 0xDD, 0xB1, 0x52, 0xC9, 0xB2, 0xFC,
+    0x69, 0x40, 0xE1, 0xB6, 0x48, 0x9F, 0xC6, 0xFA, 0xA5, 0xD1, 0x88, 0x8E, 0x53, 0x3B, 0xA3, 0xEB,
+    0x1B, 0xCF, 0x2D, 0x30, 0x99, 0xB9, 0x1B, 0x15, 0x14, 0xF8, 0x9D, 0x00, 0xB3, 0x63, 0xA2, 0x9D,
+    0x85, 0x9D, 0x3D, 0x99, 0xAF, 0x9A, 0x43, 0x6B, 0x10, 0x7E, 0x5E, 0xB8, 0x55, 0xB0, 0x62, 0x30,
+    0xE5, 0x68, 0xE0, 0x27, 0xEA, 0xF8, 0x92, 0xC4, 0xA7, 0x98, 0xF9, 0xE3, 0x5E, 0x0D, 0xE9, 0xA8,
+    0x15, 0x17, 0xDA, 0x71, 0x94, 0xAF, 0xB4, 0xA1, 0x17, 0x0A, 0x13, 0x74, 0xED, 0xF5, 0xA2, 0xF6,
+    0x36, 0x75, 0xD2, 0x5A, 0x1A, 0x17, 0xDA, 0xE5, 0xC2, 0xC2, 0xD7, 0x5C, 0xC2, 0xE8, 0xE7, 0x3F,
+    0x65, 0x18, 0xE2, 0x8A, 0x5C, 0xA5, 0x4D, 0xBA, 0xA9, 0x0B, 0x7E, 0x14, 0x97, 0x2E, 0xFD, 0x7A,
+    0x7F, 0xA6, 0x33, 0x3C, 0x19, 0x81, 0xB6, 0x92, 0x10, 0x8A, 0xFD, 0xA6, 0xA4, 0x2F, 0x1B, 0x71,
+    0xAA, 0x43, 0x08, 0x81, 0x0E, 0x21, 0xEC, 0x15, 0xDB, 0xC9, 0x17, 0xF8, 0x64, 0x90, 0xF1, 0xFA,
+    0x45, 0x03, 0xCE, 0x23, 0x9D, 0x3E, 0xCF, 0x1A, 0x7F, 0xEF, 0x1D, 0x0A, 0x4C, 0xEA, 0x2C, 0x68,
+    0x11, 0x76, 0x5C, 0x3D, 0x1D, 0xF8, 0x7F, 0x9F, 0xE9, 0xA5, 0x97, 0x28, 0xB2, 0x82, 0x30, 0xF3,
+    0x87, 0xF6, 0xA8, 0x93, 0x11, 0x0F, 0x42, 0xB9, 0xE2, 0x1F, 0x90, 0xE8, 0xD6, 0x34, 0xB7, 0xC4,
+    0x7C, 0xB5, 0x32, 0xA7, 0xA6, 0x26, 0x66, 0x81, 0xC9, 0xBD, 0x56, 0x86, 0x67, 0xAD, 0x5A, 0x59,
+    0x48, 0x05, 0x26, 0x2E, 0xC3, 0xEF, 0xAC, 0x51, 0xF3, 0x0B, 0xFA, 0x9D, 0xA0, 0xB6, 0x50, 0xA6,
+    0x24, 0xD0, 0xF8, 0x68, 0xD1, 0x81, 0xBB, 0x03, 0x79, 0xFD, 0x82, 0x6B, 0x46, 0x73, 0xB9, 0x6B,
+    0x33, 0x4A, 0x44, 0x21, 0xED, 0x2A, 0x06, 0x8A, 0xD4, 0x39, 0x92, 0x99, 0x2D, 0xC8, 0x31, 0x92,
+    0x33, 0x98, 0x62, 0x95, 0x63, 0xED, 0x01, 0x1E, 0x0C, 0x5D, 0x68, 0xF5, 0xF0, 0x7A, 0xDC, 0x64,
+    0x83, 0x7A, 0x77, 0x7A, 0xE4, 0x16, 0xF9, 0x26, 0x81, 0xB8, 0x15, 0x08, 0x2A, 0xB3, 0x36, 0xDF,
+    0x64, 0xA0, 0x33, 0x4A, 0x9E, 0x8E, 0x8C, 0x32, 0xAC, 0xD6, 0xCC, 0x32, 0x3C, 0x11, 0x57, 0x25,
+    0xA0, 0xCC, 0xCD, 0x2D, 0xF3, 0x4D, 0x84, 0xE1, 0x1D, 0xFA, 0x2A, 0xE5, 0x7E, 0x6A, 0x74, 0x6A,
+    0x38, 0x96, 0x6F, 0x22, 0x5E, 0xDA, 0xF5, 0x11, 0x9F, 0x01, 0xFB, 0x94, 0x76, 0xBB, 0xF6, 0xD4,
+    0xF6, 0x5E, 0x31, 0xF3, 0xB0, 0xFA, 0xF7, 0x79, 0xCF, 0xAE, 0xF2, 0x79, 0xF5, 0xB7, 0xF3, 0xAE,
+    0x22, 0xB7, 0x5A, 0x39, 0x3D, 0xB9, 0xB4, 0xBC, 0xED, 0x2B, 0x10, 0x01, 0xB5, 0x97, 0x96, 0x2E,
+    0x82, 0x9E, 0x9A, 0x5B, 0x03, 0xAF, 0x06, 0x5C, 0x4C, 0x9F, 0x28, 0x51, 0x29, 0xB2, 0x28, 0x05,
+    0xD5, 0x1F, 0x12, 0xCB, 0xFB, 0x05, 0xB1, 0x2C, 0x67, 0xC5, 0xA4, 0x9B, 0x11, 0xA3, 0xEE, 0xAC,
+    0x70, 0xCE, 0x92, 0x48, 0x1A, 0x9D, 0x6C, 0x4C, 0xD6, 0x70, 0xDF, 0x17, 0x10, 0xF9, 0x91, 0xE8,
+    0xB7, 0xBF, 0xA2, 0xAE, 0xB3, 0x7E, 0x2F, 0x66, 0xDB, 0x2D, 0xD5, 0xA6, 0x17, 0x48, 0x10, 0x50,
+    0xE4, 0x24, 0xBD, 0x0F, 0x4E, 0x14, 0x43, 0xE2, 0xA4, 0x58, 0xD1, 0x37, 0xE9, 0x86, 0x61, 0x9E,
+    0xA1, 0xC9, 0x5E, 0x43, 0x7A, 0x18, 0x03, 0x62, 0x58, 0x02, 0x27, 0x20, 0x61, 0x9A, 0xB7, 0xD3,
+    0x7C, 0x26, 0x33, 0x51, 0x3B, 0x0C, 0x5E, 0x79, 0xCC, 0xC0, 0x70, 0x2F, 0x4B, 0x92, 0x5E, 0x83,
+    0x25, 0x5F, 0x11, 0x0B, 0x61, 0x45, 0xB0, 0xBA, 0x2F, 0xF9, 0x00, 0xAE, 0xE8, 0x57, 0x4B, 0xE4,
+    0xA0, 0x0A, 0x1A, 0xD0, 0xFE, 0x88, 0xFB, 0xBD, 0xF7, 0x04, 0xD0, 0x81, 0xF3, 0xA1, 0x08, 0x3F,
+    0x5A, 0x32, 0x03, 0x26, 0xD9, 0xCE, 0x0A, 0xF6, 0x36, 0x5A, 0xB3, 0x62, 0x97, 0x87, 0xA6, 0xFD,
+    0xF1, 0x1A, 0x80, 0x36, 0x7A, 0x4D, 0x03, 0x22, 0x09, 0x71, 0xD7, 0x5E, 0x36, 0x9D, 0xF3, 0xEB,
+    0x26, 0x1A, 0x5F, 0x92, 0xE7, 0xDC, 0xFF, 0xDE, 0x5F, 0x38, 0x7C, 0x11, 0xEF, 0xBB, 0xBF, 0xAC,
+    0xD2, 0x0E, 0x99, 0xD3, 0xC9, 0x62, 0x28, 0x9A, 0x90, 0x2F, 0x7C, 0x91, 0x37, 0x4C, 0xA8, 0x92,
+    0xA8, 0x04, 0x5E, 0x00, 0x65, 0x2A, 0x79, 0xE1, 0x26, 0xD3, 0xF2, 0x02, 0xEB, 0xFF, 0x05, 0x25,
+    0xDF, 0x62, 0x94, 0x98, 0x2F, 0x00, 0xB0, 0x66, 0xE4, 0xCE, 0x89, 0x2A, 0x96, 0xF8, 0x20, 0xFC,
+    0x96, 0xA2, 0x4C, 0xF0, 0xE9, 0x7C, 0x5A, 0xB7, 0x87, 0xD9, 0x96, 0xA3, 0x57, 0x07, 0x1A, 0x07,
+    0x8B, 0xBB, 0x8A, 0x7A, 0x44, 0x60, 0x55, 0xBB, 0xDC, 0x0E, 0x35, 0x2F, 0x66, 0x9B, 0x17, 0xEF,
+    0xD6, 0xB5, 0xD9, 0x74, 0x79, 0xAE, 0x49, 0x07, 0x90, 0x39, 0x98, 0xBB, 0x72, 0xB8, 0x6F, 0xF4,
+    0x17, 0xB0, 0x6A, 0x3A, 0xD0, 0x9F, 0xD0, 0xA6, 0xEE, 0x9B, 0xB4, 0x45, 0xD1, 0xFA, 0x9F, 0x0F,
+    0x14, 0x9B, 0x69, 0x65, 0xB4, 0x1F, 0xB8, 0x8A, 0x68, 0x39, 0xF4, 0x70, 0x9F, 0x79, 0xF1, 0x9B,
+    0x71, 0x05, 0xE5, 0x52, 0x77, 0x4E, 0xA4, 0x52, 0xBB, 0xDF, 0x4B, 0xE4, 0x3A, 0xE7, 0x83, 0x48,
+    0x32, 0x7D, 0xAD, 0x4F, 0x02, 0xC5, 0x15, 0x66, 0x5D, 0x53, 0x12, 0x37, 0xE1, 0x03, 0x65, 0xA5,
+    0x71, 0xDA, 0xB9, 0xDA, 0x96, 0x6B, 0x43, 0xB5, 0x69, 0x62, 0xDD, 0x42, 0x23, 0x9B, 0xCC, 0x5F,
+    0xD0, 0x03, 0xAF, 0xA6, 0xEA, 0xF4, 0x79, 0xF7, 0x8A, 0x54, 0x7F, 0xA8, 0x91, 0xA4, 0xD8, 0xA0,
+    0x15, 0xDF, 0x0A, 0x29, 0x0A, 0x4D, 0xE8, 0xF1, 0x54, 0x49, 0x38, 0x5C, 0x30, 0x59, 0x29, 0xDF,
+    0x1E, 0x4A, 0xEE, 0x55, 0xAF, 0xCE, 0xCE, 0xD2, 0xCA, 0x22, 0xBC, 0x8D, 0xFA, 0x2D, 0x0D, 0xEB,
+    0xEB, 0x19, 0x1E, 0x5F, 0xA9, 0xEF, 0xC3, 0x8D, 0x41, 0x74, 0xB5, 0x1C, 0xA5, 0x96, 0x8A, 0x2B,
+    0xE6, 0xF9, 0x3A, 0xDA, 0x6A, 0xD0, 0x19, 0xDF, 0x47, 0x9B, 0x01, 0x27, 0x6F, 0x75, 0xB8, 0x8C,
+    0x30, 0x9A, 0x1F, 0xFD, 0x66, 0x80, 0x95, 0x47, 0x21, 0x36, 0x0F, 0x5C, 0xD5, 0xA5, 0x4B, 0x67,
+    0x7E, 0xAC, 0xE0, 0x3D, 0x9F, 0x7B, 0x4B, 0xA0, 0x84, 0x96, 0xDD, 0xF7, 0x4E, 0x14, 0xD6, 0xAD,
+    0x5B, 0x8C, 0x4A, 0x07, 0xA2, 0xF5, 0x8C, 0xA8, 0xB5, 0x37, 0x81, 0x7D, 0xA5, 0xD3, 0xC7, 0x1C,
+    0x59, 0x31, 0xFB, 0xCF, 0x8B, 0x11, 0x5E, 0xF3, 0xA8, 0x7A, 0x46, 0x57, 0x33, 0x93, 0xBE, 0x5F,
+    0x61, 0xD6, 0x82, 0x4A, 0xCD, 0x58, 0x8B, 0xAD, 0x35, 0x76, 0xA0, 0xA3, 0x3D, 0x99, 0xAE, 0x95,
+    0x78, 0x91, 0xC7, 0x38, 0x9C, 0xC4, 0xDC, 0xC9, 0x7F, 0xBE, 0xDE, 0x96, 0xE0, 0x6B, 0xED, 0xA2,
+    0xAB, 0x3C, 0xDC, 0xAA, 0xF2, 0x27, 0xAB, 0x40, 0x7F, 0x2F, 0x90, 0x6C, 0x2B, 0xF0, 0xE5, 0x7E,
+    0xDE, 0x3F, 0x55, 0x97, 0x99, 0x5B, 0x38, 0xB0, 0x46, 0x2A, 0xC6, 0x38, 0xC4, 0x9F, 0x5E, 0x43,
+    0xB3, 0xC3, 0xA1, 0xC9, 0x7C, 0x62, 0x23, 0x10, 0xF7, 0xA7, 0xF9, 0xB6, 0x4C, 0x25, 0xA0, 0x85,
+    0x52, 0x2F, 0x78, 0xE4, 0xC4, 0xE7, 0xFE, 0xCE, 0x77, 0x37, 0x52, 0xE9, 0x35, 0x1B, 0xFF, 0x2D,
+    0xA1, 0x97, 0xD5, 0xE4, 0x8F, 0xB1, 0x1A, 0x80, 0x85, 0x9D, 0x6B, 0xBF, 0x59, 0x87, 0xF9, 0x6C,
+    0x7C, 0x9E, 0xC2, 0xE2, 0x55, 0xBF, 0x49, 0x3A, 0xF2, 0x4D, 0x4F, 0x9C, 0x6E, 0x5E, 0x20, 0x34,
+    0xD2, 0x74, 0x65, 0xEC, 0xB5, 0xFE, 0xB4, 0x2B, 0x3E, 0x53, 0x5F, 0x7D, 0x45, 0xD1, 0x55, 0x77,
+    0x08, 0xDF, 0x71, 0xAE, 0xC6, 0xBF, 0x04, 0xBC, 0xA9, 0x7E, 0x4D, 0x4D, 0xB2, 0x47, 0x3B, 0x8C,
+    0x0E, 0x03, 0x28, 0x69, 0x40, 0xCA, 0xEA, 0x99, 0xAF, 0x5A, 0x9B, 0xDA, 0xF1, 0x65, 0x34, 0xC6,
+    0xE9, 0x4A, 0xBB, 0x20, 0x0E, 0x2C, 0x42, 0xAA, 0x13, 0x49, 0x3A, 0xD1, 0xE0, 0x07, 0x6D, 0xAA,
+    0xB7, 0xC9, 0x91, 0xE1, 0x5B, 0x43, 0xAC, 0x95, 0x18, 0x4B, 0x46, 0x92, 0x23, 0x05, 0x43, 0x6D,
+    0x93, 0x20, 0xE9, 0x6F, 0x95, 0x1C, 0xC9, 0xDB, 0xB2, 0x87, 0xD5, 0xB5, 0x48, 0x0B, 0xE7, 0x06,
+    0x8D, 0x35, 0x85, 0x09, 0x2B, 0x21, 0x74, 0x3D, 0x60, 0x62, 0x98, 0xD5, 0x2A, 0xDF, 0x57, 0x1D,
+    0x99, 0xD5, 0x83, 0xAD, 0xE7, 0x77, 0xBC, 0x34, 0x81, 0x00, 0x32, 0xBC, 0x18, 0x6B, 0xA3, 0xCB,
+    0x40, 0x7C, 0x18, 0xBF, 0xA9, 0x81, 0x76, 0xCE, 0x6D, 0x55, 0xDA, 0xA0, 0x0A, 0xF7, 0x2C, 0x11,
+    0xFE, 0x9C, 0x56, 0x74, 0xC8, 0x6A, 0xD1, 0xC9, 0xE4, 0xC5, 0xDF, 0x95, 0xFB, 0xAD, 0x74, 0xE6,
+    0x38, 0x40, 0xAE, 0xFF, 0x29, 0xEF, 0xC9, 0xB7, 0xD1, 0x3C, 0xDC, 0xD7, 0xBC, 0x01, 0xC3, 0x2C,
+    0x7D, 0x4A, 0x0C, 0x44, 0xBB, 0x9D, 0x81, 0xD9, 0xA7, 0xFB, 0x2B, 0xB0, 0x63, 0x8F, 0xD7, 0x89,
+    0x33, 0x81, 0x9A, 0x1B, 0x74, 0x46, 0xCB, 0xE1, 0xC2, 0x63, 0xF8, 0xEB, 0xF9, 0x95, 0x77, 0xCF,
+    0x1E, 0x52, 0xCF, 0xF7, 0x0E, 0x1D, 0xBC, 0xAC, 0xA6, 0x16, 0x68, 0xAE, 0xCD, 0xCC, 0x0D, 0xFF,
+    0xC8, 0xF8, 0x8B, 0x09, 0xDE, 0x1F, 0xD5, 0x2F, 0xEC, 0x26, 0x17, 0x75, 0xBA, 0x91, 0x96, 0x5F,
+    0x69, 0xFD, 0xBF, 0xF5, 0x64, 0x53, 0x7C, 0x4C, 0x61, 0x99, 0x49, 0x16, 0x7F, 0x67, 0xA4, 0x8C,
+    0x8F, 0xA9, 0x68, 0xBF, 0x7E, 0x40, 0x99, 0x11, 0x25, 0xC6, 0x1F, 0x59, 0x81, 0xBA, 0x97, 0x9F,
+    0x7D, 0x0B, 0xBA, 0xBA, 0xE0, 0x97, 0x5A, 0x24, 0x95, 0x3F, 0xFE, 0x17, 0xF2, 0xE2, 0xC7, 0x7F,
+    0x92, 0xEA, 0x9D, 0x7A, 0x17, 0x9C, 0x7B, 0xBA, 0xA1, 0xDA, 0xCB, 0x06, 0xD0, 0x8F, 0xC7, 0x3C,
+    0x42, 0xE5, 0x0D, 0x95, 0xB1, 0x4E, 0x4D, 0xD0, 0x9D, 0x83, 0x59, 0x4C, 0x9D, 0x7D, 0x66, 0x53,
+    0x0B, 0x1F, 0x6F, 0x34, 0x59, 0x03, 0x79, 0x9D, 0x6B, 0xCD, 0x20, 0xA8, 0xAC, 0x41, 0xFB, 0xB7,
+    0xFD, 0xDC, 0xAE, 0x1A, 0x8F, 0x4F, 0xEA, 0xC8, 0x7D, 0xB5, 0xEF, 0x94, 0x57, 0x96, 0x72, 0x0B,
+    0x87, 0x72, 0xCC, 0x18, 0xD6, 0x70, 0xDB, 0x1B, 0xD4, 0xCA, 0x33, 0xE4, 0x88, 0x16, 0xCD, 0x66,
+    0xAD, 0x0B, 0x77, 0xDF, 0xD1, 0x3F, 0xD3, 0xD5, 0x31, 0x15, 0x6A, 0x2F, 0x93, 0x9F, 0x1E, 0x68,
+    0xC6, 0x50, 0xC0, 0x0F, 0x46, 0xE1, 0x2F, 0xD4, 0xBD, 0xFF, 0xEC, 0x6B, 0x92, 0x6E, 0x69, 0xC3,
+    0x98, 0xC3, 0x5A, 0x53, 0x4A, 0xB0, 0x9E, 0x40, 0x0F, 0xAA, 0xD1, 0x97, 0x1E, 0x3C, 0x4E, 0xEE,
+    0xD7, 0xAE, 0x4D, 0xF6, 0xFD, 0x42, 0x0B, 0xBA, 0x26, 0xF0, 0x81, 0x6A, 0x21, 0x91, 0xE6, 0x23,
+    0x53, 0xC6, 0xDB, 0x15, 0x61, 0x49, 0xAB, 0x5B, 0xE9, 0x0D, 0x9E, 0x4A, 0xFD, 0x93, 0x2F, 0xC7,
+    0x6E, 0x86, 0x7C, 0xAC, 0xD1, 0xD9, 0x46, 0x0C, 0x54, 0xA7, 0xB9, 0x8A, 0x57, 0x5A, 0x24, 0x85,
+    0xFC, 0x3C, 0xD4, 0xFC, 0x9B, 0x46, 0x09, 0x9B, 0x6D, 0xC4, 0x9B, 0xFE, 0x0E, 0x8D, 0xD5, 0xDC,
+    0x8D, 0xD9, 0xDB, 0x9C, 0x77, 0x18, 0x63, 0x74, 0x2F, 0xAD, 0xBF, 0xBD, 0x45, 0x3E, 0xE2, 0x2B,
+    0xF4, 0x0C, 0x44, 0xF4, 0xEC, 0xD5, 0xFB, 0xB7, 0x9A, 0x4C, 0xF6, 0x95, 0x8D, 0x0C, 0x76, 0xB3,
+    0xF0, 0x6E, 0xCE, 0x49, 0x2E, 0xA2, 0xB1, 0x8B, 0x6E, 0x4B, 0x66, 0xD0, 0xCF, 0xAD, 0xC7, 0xA9,
+    0xBD, 0x91, 0x41, 0x3F, 0x1C, 0x7B, 0x36, 0xCA, 0x12, 0xDE, 0xFB, 0x3A, 0x73, 0x0D, 0x73, 0xEB,
+    0x66, 0x9C, 0x58, 0xD5, 0x2D, 0x6E, 0x58, 0x62, 0x58, 0xE6, 0xE4, 0x76, 0x19, 0xF4, 0xAF, 0x2F,
+    0xC4, 0x91, 0x9A, 0xFB, 0x2B, 0x6E, 0x66, 0xF8, 0xBF, 0xDC, 0x2E, 0xC6, 0xF0, 0x87, 0x35, 0xD0,
+    0x5B, 0xC3, 0x3A, 0x1B, 0x24, 0x98, 0x24, 0xB8, 0xE4, 0x08, 0x2E, 0x29, 0xA6, 0x01, 0x30, 0x87,
+    0x40, 0x41, 0xD6, 0xAD, 0x6B, 0xE0, 0x89, 0x1B, 0x15, 0x15, 0xE6, 0x1E, 0x71, 0xF8, 0x1F, 0x51,
+    0x9B, 0x72, 0x57, 0x0F, 0xAC, 0xA9, 0x3A, 0x56, 0x50, 0xC7, 0x26, 0x96, 0x74, 0x31, 0x72, 0xEE,
+    0x6C, 0x9A, 0x5B, 0xEF, 0x5F, 0xB0, 0xEF, 0x63, 0x97, 0xD9, 0xF6, 0x1B, 0x03, 0xEC, 0xBA, 0xB8,
+    0x40, 0x0E, 0x31, 0x04, 0x6E, 0x5F, 0x3E, 0x37, 0xEF, 0xB6, 0x60, 0xD9, 0x3E, 0x49, 0x98, 0x54,
+    0xA5, 0x84, 0x1C, 0xA3, 0x03, 0xA3, 0xFE, 0x08, 0xC3, 0xC3, 0x4D, 0x82, 0xD3, 0xF4, 0x0F, 0x4B,
+    0x86, 0xC3, 0x58, 0xF9, 0x83, 0xE1, 0x2B, 0xB8, 0x76, 0xA8, 0x36, 0xBF, 0xBF, 0xB9, 0xD8, 0x0C,
+    0x89, 0x63, 0x98, 0x80, 0x66, 0xA2, 0xCE, 0x68, 0x11, 0xD3, 0x63, 0x27, 0xD0, 0xFB, 0x28, 0x66,
+    0xD2, 0x3C, 0xFB, 0x6B, 0xEB, 0x0B, 0xF2, 0xDC, 0x9D, 0xDA, 0xC4, 0x3D, 0x6B, 0xE0, 0x85, 0x4B,
+    0x05, 0xD1, 0xC6, 0x39, 0x76, 0x6D, 0x46, 0x35, 0x1B, 0x88, 0xD4, 0x6D, 0xE4, 0xE6, 0x49, 0x71,
+    0x67, 0x45, 0x8A, 0xBB, 0x0E, 0xDB, 0xCD, 0x42, 0x61, 0x3B, 0xB3, 0x0C, 0x68, 0x8F, 0x11, 0x27,
+    0xE1, 0xDE, 0xA1, 0x04, 0xE3, 0xE8, 0xB6, 0xB9, 0x22, 0x20, 0x29, 0xD0, 0x99, 0x95, 0x35, 0xBB,
+    0x06, 0x4D, 0xB1, 0xCE, 0xC2, 0x66, 0xED, 0xEE, 0xD4, 0x21, 0x13, 0xEB, 0x08, 0xF8, 0x3B, 0xA2,
+    0x3B, 0x0C, 0xEF, 0x93, 0xC7, 0x4B, 0x29, 0x58, 0xB3, 0xE8, 0xD0, 0x0A, 0x3A, 0xB4, 0x52, 0x87,
+    0xCC, 0x96, 0x15, 0x93, 0x02, 0xB9, 0x09, 0x8A, 0xD9, 0xBE, 0xA3, 0xD3, 0x09, 0x15, 0x51, 0x27,
+    0xB2, 0xAB, 0x1C, 0x0A, 0xC0, 0xCF, 0x0D, 0x48, 0x85, 0x4A, 0xCD, 0x9E, 0x47, 0x23, 0x0E, 0x79,
+    0x6A, 0xFF, 0x34, 0x24, 0xE9, 0xCC, 0x1E, 0xCE, 0x73, 0x57, 0xE9, 0x1D, 0x7D, 0x5D, 0x59, 0xEB,
+    0x46, 0xD2, 0xD5, 0x29, 0x91, 0x59, 0x57, 0x2B, 0xAD, 0x33, 0x5D, 0xAD, 0x0C, 0x5F, 0xE8, 0x1E,
+    0xD1, 0x7B, 0xED, 0x75, 0x10, 0xC0, 0xBE, 0xD9, 0x93, 0x2D, 0x70, 0x6E, 0xDA, 0x15, 0x3F, 0x34,
+    0x77, 0xDE, 0x8B, 0x6F, 0x1B, 0xF7, 0xD3, 0x19, 0xC1, 0x5D, 0x41, 0x29, 0x25, 0x4D, 0xB0, 0x88,
+    0xCE, 0x2E, 0x06, 0xD8, 0xC5, 0xC3, 0x48, 0x54, 0x34, 0x97, 0xA2, 0x3D, 0x90, 0x8D, 0xA3, 0xC0,
+    0xC1, 0x94, 0xC6, 0x9B, 0xF2, 0xBE, 0xAD, 0xCD, 0x79, 0xDE, 0xDB, 0xD5, 0x78, 0xEC, 0xD3, 0x7D,
+    0x75, 0x34, 0x08, 0x73, 0x0F, 0x36, 0x5F, 0x72, 0xEE, 0xBC, 0x39, 0xB0, 0x3E, 0x49, 0x9E, 0x3D,
+    0x68, 0x40, 0x26, 0x07, 0xCA, 0x31, 0x72, 0x9A, 0xCD, 0xD6, 0x7B, 0xB9, 0x58, 0x14, 0xBF, 0xCE,
+    0xC5, 0x61, 0x5A, 0x69, 0xA7, 0xCF, 0x6F, 0xE9, 0x18, 0x56, 0xBE, 0x21, 0x59, 0xC5, 0x2B, 0x86,
+    0x84, 0x20, 0x4A, 0x83, 0x41, 0x07, 0x6B, 0x60, 0x40, 0x4A, 0x30, 0xFF, 0x9B, 0xB9, 0xC2, 0x9D,
+    0x94, 0xE9, 0x7E, 0x0B, 0x55, 0xD0, 0xC1, 0x6F, 0x3E, 0x61, 0x80, 0xD6, 0xD5, 0xD2, 0x44, 0x75,
+    0x66, 0xA2, 0x52, 0xCD, 0x2E, 0xC1, 0x3B, 0xFB, 0x0A, 0xC1, 0x9E, 0xD5, 0xDA, 0x6D, 0xBE, 0xC2,
+    0x3D, 0x28, 0xE7, 0xF1, 0x7A, 0x19, 0xCD, 0x8A, 0x31, 0x72, 0xFE, 0x2F, 0xC2, 0x44, 0x76, 0x09,
+    0xD2, 0xA3, 0x40, 0x99, 0x2C, 0xEA, 0x10, 0xE5, 0x0F, 0x72, 0xFD, 0xD5, 0xBD, 0xB4, 0x2F, 0x23,
+    0xFF, 0x47, 0x30, 0x6E, 0xF1, 0xC5, 0xE5, 0xC7, 0xC9, 0x1B, 0xE2, 0xEF, 0x04, 0x13, 0x5D, 0xD2,
+    0x89, 0xA2, 0xBD, 0xE7, 0x54, 0xF7, 0xB2, 0xEA, 0x95, 0x6A, 0x39, 0x7C, 0xB1, 0xF0, 0xB0, 0x24,
+    0xCE, 0x09, 0xA6, 0x70, 0x45, 0xB4, 0x9F, 0x16, 0x68, 0xB6, 0x9F, 0xC6, 0x9B, 0x93, 0xCD, 0x91,
+    0x73, 0xD0, 0x98, 0x01, 0x03, 0x28, 0xC9, 0x7E, 0x58, 0xC2, 0x74, 0xA3, 0x38, 0x6C, 0xF8, 0x63,
+    0x24, 0x47, 0x48, 0x8E, 0x81, 0xDC, 0xC8, 0x9A, 0x2D, 0x76, 0x37, 0xC2, 0xF1, 0xDD, 0x54, 0xE2,
+    0xBD, 0x9D, 0xD8, 0x7A, 0xBB, 0xAA, 0x77, 0xD3, 0x72, 0x63, 0xFD, 0x15, 0x46, 0x6E, 0x04, 0x07,
+    0xAE, 0xB6, 0x76, 0xE7, 0x74, 0x4B, 0xF6, 0xB5, 0x44, 0xBD, 0xDE, 0x0F, 0x8E, 0x06, 0x73, 0x50,
+    0x97, 0x09, 0xA4, 0xF7, 0x47, 0x58, 0x1C, 0x4E, 0x10, 0x98, 0xDC, 0xDF, 0x67, 0xE6, 0xB3, 0x24,
+    0x4B, 0x3A, 0x69, 0x9D, 0x1B, 0xED, 0xF9, 0x27, 0xF9, 0x4D, 0x72, 0xBF, 0x73, 0x87, 0x5E, 0x60,
+    0xD9, 0x12, 0x82, 0x99, 0xC4, 0x7A, 0xA9, 0x4E, 0x62, 0xD5, 0x75, 0x36, 0xFC, 0x26, 0x79, 0x3B,
+    0x71, 0x4B, 0xED, 0xA4, 0x9D, 0x69, 0x02, 0x5C, 0x56, 0x81, 0xEE, 0x7B, 0x25, 0xBA, 0x7F, 0x9C,
+    0xA1, 0xFC, 0xA5, 0xC7, 0x2D, 0xEE, 0xF5, 0xB7, 0x6E, 0x7C, 0x80, 0xBE, 0xDD, 0xF8, 0x04, 0xBD,
+    0xBC, 0xF1, 0x29, 0xFB, 0xFB, 0xD7, 0x20, 0xBF, 0x93, 0x1D, 0x86, 0x15, 0x5F, 0x5D, 0x97, 0x4F,
+    0xD1, 0xE9, 0x1B, 0x1F, 0x41, 0x5E, 0xDC, 0xF8, 0x10, 0x9D, 0xBE, 0x91, 0x0C, 0x5B, 0xA1, 0xE1,
+    0x4B, 0xB8, 0x2E, 0xD9, 0xD8, 0x61, 0x88, 0xBE, 0x1D, 0x58, 0x40, 0xDF, 0x42, 0xB6, 0xF3, 0x26,
+    0x78, 0xEE, 0xC5, 0xE4, 0xA4, 0xC9, 0xDB, 0x9B, 0xBC, 0x3D, 0xC1, 0xB7, 0xDE, 0xF8, 0x83, 0xBE,
+    0xA1, 0x47, 0x37, 0x7E, 0x05, 0xAC, 0x7E, 0xE3, 0x23, 0x74, 0xEB, 0xC6, 0xCF, 0x0B, 0x25, 0x29,
+    0x55, 0xB4, 0x4F, 0xD8, 0x37, 0x3F, 0x45, 0xDF, 0x9C, 0x62, 0xD3, 0xBC, 0xBD, 0x7A, 0x13, 0xF3,
+    0x56, 0x55, 0x6F, 0xEE, 0xF6, 0xBC, 0x4D, 0xD5, 0xB8, 0x2F, 0x6F, 0x4E, 0x24, 0x90, 0x45, 0x41,
+    0xF5, 0xAC, 0xBE, 0x36, 0xBA, 0x50, 0xFF, 0x09, 0x72, 0x14, 0x13, 0xA5, 0x2A, 0xCA, 0xB5, 0x2F,
+    0x34, 0x6F, 0x01, 0xE7, 0x2D, 0xE3, 0xE1, 0x20, 0x5E, 0xD2, 0x5B, 0x5C, 0x53, 0x71, 0x76, 0xD6,
+    0x49, 0x8D, 0x5F, 0x67, 0xDF, 0x86, 0xE9, 0x19, 0x45, 0x58, 0x43, 0x8E, 0x58, 0xFF, 0x8F, 0x09,
+    0x3D, 0x22, 0xF4, 0x98, 0x50, 0xCE, 0xAB, 0xF3, 0x73, 0xF1, 0xE0, 0x09, 0xE8, 0x73, 0x3E, 0x1C,
+    0x69, 0x3F, 0x01, 0xBD, 0x1E, 0xB4, 0xF3, 0x99, 0x28, 0xC3, 0x93, 0x40, 0x52, 0xBD, 0x16, 0xB9,
+    0xEA, 0x24, 0xA9, 0x95, 0x34, 0x96, 0x54, 0x4D, 0x3F, 0xE5, 0x5E, 0x4C, 0x67, 0x70, 0xB8, 0x7F,
+    0xD1, 0x78, 0x57, 0xF5, 0x16, 0x0B, 0xBB, 0x52, 0x67, 0xDD, 0xC4, 0x3D, 0xAD, 0xCE, 0xB8, 0xC9,
+    0xEC, 0x5E, 0x0A, 0xF8, 0x25, 0x11, 0xF3, 0x04, 0x4C, 0xEE, 0x07, 0x51, 0xEB, 0x0E, 0x70, 0x7F,
+    0x25, 0x49, 0x8A, 0xC9, 0xB0, 0xDD, 0x46, 0xCB, 0xC4, 0x6E, 0x52, 0x4F, 0x12, 0x41, 0x19, 0xC4,
+    0x9A, 0xBB, 0x02, 0x29, 0x68, 0x49, 0x42, 0x82, 0xC4, 0x63, 0x12, 0x4C, 0x1D, 0x40, 0xA8, 0xFD,
+    0x48, 0x36, 0x55, 0x7A, 0x63, 0x90, 0xB3, 0xDE, 0x5F, 0xA5, 0xED, 0x92, 0x71, 0x0A, 0x7D, 0x75,
+    0xA2, 0xFF, 0x4E, 0x67, 0x74, 0x22, 0x2E, 0x78, 0x0B, 0xAA, 0x2A, 0x1A, 0xE0, 0x93, 0x64, 0xBD,
+    0xBF, 0x58, 0x93, 0xAD, 0x3E, 0x1D, 0x80, 0x60, 0x56, 0xC3, 0x2B, 0x61, 0xF5, 0xBD, 0x6A, 0xD8,
+    0x3A, 0x80, 0x8E, 0xB7, 0xA7, 0x11, 0x3C, 0x36, 0x49, 0x94, 0x0E, 0x55, 0x31, 0x50, 0x75, 0x00,
+    0x62, 0x5B, 0x06, 0xC7, 0xD5, 0x3D, 0x71, 0x26, 0x2A, 0xB5, 0x4D, 0x25, 0x63, 0x54, 0x0F, 0xD2,
+    0xCE, 0x57, 0x6E, 0x53, 0x51, 0xC7, 0xE9, 0xD1, 0x6A, 0x86, 0x8B, 0xA3, 0xD0, 0xBF, 0xC0, 0x61,
+    0xB8, 0x96, 0x4B, 0x2C, 0x7E, 0x49, 0xFA, 0x76, 0x46, 0xE8, 0xB3, 0x42, 0x55, 0x4D, 0x39, 0x0E,
+    0x0D, 0x1D, 0x7F, 0x7F, 0x9C, 0x72, 0x48, 0x94, 0x8C, 0x89, 0xD2, 0x83, 0xA2, 0xCF, 0x24, 0x02,
+    0x83, 0xE0, 0x7B, 0x6B, 0x7A, 0x91, 0xD5, 0x71, 0x71, 0x9D, 0x31, 0x79, 0x2F, 0xF5, 0xD5, 0x93,
+    0xBA, 0xD6, 0xC1, 0x76, 0xFC, 0x1D, 0x66, 0xFA, 0xF3, 0xDA, 0xB8, 0x49, 0xF5, 0x46, 0x38, 0xF1,
+    0x11, 0xEB, 0x5A, 0xB0, 0x0D, 0x6A, 0xC9, 0x2E, 0x60, 0xAC, 0xA3, 0xA9, 0x29, 0xB9, 0xE6, 0x78,
+    0xA0, 0x50, 0x55, 0xBD, 0x81, 0xF6, 0x35, 0x86, 0x49, 0xED, 0xD9, 0x14, 0xA7, 0x04, 0x59, 0xC7,
+    0xAF, 0x19, 0xA9, 0xA7, 0xFD, 0x70, 0x3A, 0xCD, 0xD8, 0x1A, 0xBE, 0x96, 0x37, 0xD3, 0xA9, 0xF5,
+    0x7B, 0x20, 0xE8, 0x87, 0xB9, 0x9D, 0x40, 0x99, 0xCC, 0x8C, 0x10, 0x58, 0x25, 0x82, 0xA3, 0xA3,
+    0x76, 0xA8, 0xFA, 0x81, 0x54, 0xF4, 0x4E, 0xF0, 0xCD, 0x55, 0x5D, 0xF9, 0xBA, 0x12, 0x2E, 0x63,
+    0x4A, 0x9F, 0xE4, 0x18, 0xB9, 0xC9, 0x93, 0x43, 0x23, 0x4E, 0x9D, 0x24, 0xAC, 0xDE, 0xAC, 0x4A,
+    0xBD, 0x8F, 0xB0, 0xDE, 0x4E, 0xA8, 0xE1, 0xD9, 0x5E, 0xDD, 0x09, 0x57, 0x67, 0x01, 0x69, 0x9F,
+    0x9A, 0x72, 0x7F, 0x5B, 0x68, 0xCD, 0xBD, 0xD0, 0x46, 0x7F, 0x98, 0x1A, 0xF7, 0x56, 0x52, 0x47,
+    0xDD, 0x25, 0x30, 0x90, 0x98, 0x23, 0x60, 0x1B, 0xF7, 0x3A, 0x84, 0x89, 0xCF, 0x10, 0x90, 0xCF,
+    0x10, 0xD0, 0x2A, 0xB7, 0x1C, 0xAF, 0x70, 0x8F, 0xF1, 0x70, 0x9C, 0xF8, 0x9A, 0x70, 0x67, 0x46,
+    0x10, 0x9A, 0x03, 0x08, 0x82, 0x97, 0x72, 0xC8, 0x9F, 0x9F, 0xA6, 0xE0, 0xE4, 0xEB, 0x91, 0x1A,
+    0xBD, 0x2A, 0xD1, 0x9F, 0xEA, 0x35, 0x18, 0xB9, 0xDE, 0xB0, 0x76, 0x6F, 0xD3, 0x5C, 0x1F, 0xBD,
+    0x5B, 0xEF, 0xFE, 0xF4, 0x82, 0xBD, 0x44, 0x57, 0x71, 0xC6, 0x34, 0xC1, 0x42, 0xF5, 0x78, 0x64,
+    0xD1, 0x3C, 0xD3, 0x51, 0xE7, 0x79, 0x70, 0x91, 0x90, 0x2E, 0xFF, 0xF4, 0x19, 0x76, 0xE8, 0x98,
+    0x39, 0x90, 0x76, 0x32, 0xC2, 0x42, 0xBF, 0x19, 0x8B, 0x97, 0xF7, 0x5A, 0xA0, 0x8C, 0x13, 0xAB,
+    0xBB, 0xE9, 0xD8, 0x9A, 0x82, 0xC1, 0x33, 0xB6, 0xEB, 0xF7, 0x72, 0xED, 0x86, 0x38, 0xA4, 0x23,
+    0x6A, 0x46, 0xAF, 0xF6, 0x7C, 0x81, 0xF5, 0xEE, 0xD9, 0xB1, 0x65, 0x30, 0xB4, 0x0E, 0xC0, 0x5F,
+    0x67, 0x14, 0xBA, 0x35, 0xD4, 0x31, 0x33, 0x0D, 0x77, 0x9E, 0xCC, 0x74, 0x08, 0x81, 0x03, 0xC2,
+    0xB8, 0x75, 0x78, 0x09, 0xE8, 0x99, 0xD0, 0x2F, 0x39, 0x0B, 0x85, 0x91, 0x9C, 0x01, 0x49, 0xF7,
+    0xA3, 0x77, 0x81, 0x4E, 0x5D, 0xFB, 0x22, 0x84, 0x46, 0x03, 0x46, 0x2F, 0x6D, 0xC0, 0xA9, 0x20,
+    0x53, 0x0D, 0x4B, 0x37, 0x11, 0xE1, 0xE4, 0x8B, 0xE1, 0xE2, 0x7A, 0x79, 0xCE, 0x4E, 0x5F, 0x38,
+    0x6B, 0xA7, 0x07, 0xCF, 0xD8, 0xD0, 0x47, 0x77, 0x4A, 0xBB, 0x94, 0xD4, 0xCB, 0xB5, 0x3A, 0xFA,
+    0x29, 0x2E, 0xBD, 0x40, 0xA7, 0xC0, 0x5A, 0x63, 0x85, 0xFD, 0x8C, 0xE2, 0xA1, 0x37, 0x0C, 0x4E,
+    0x17, 0x5C, 0xB2, 0x62, 0xD3, 0x47, 0x3C, 0xA0, 0x82, 0x23, 0x76, 0xA8, 0xCE, 0x08, 0x70, 0x93,
+    0xB3, 0x5C, 0x6B, 0x84, 0x95, 0xDC, 0xDE, 0x6C, 0xDC, 0x8A, 0x9A, 0xD4, 0x94, 0xDE, 0x8E, 0x24,
+    0x14, 0x58, 0xBF, 0x40, 0xFE, 0x2B, 0xC4, 0x87, 0x10, 0xC5, 0xC5, 0xD4, 0x44, 0x12, 0x5A, 0x26,
+    0x5E, 0x5D, 0xC5, 0xB8, 0x01, 0x15, 0x82, 0x84, 0xFF, 0x4B, 0x36, 0x6C, 0x9E, 0x6A, 0xD7, 0x27,
+    0x5C, 0xEB, 0x50, 0x50, 0x7B, 0x7F, 0xCE, 0x65, 0x51, 0x4C, 0xC4, 0xA6, 0xC4, 0xF3, 0xB4, 0x99,
+    0xE4, 0x4D, 0xD4, 0x57, 0x6F, 0xDF, 0xDC, 0x95, 0xBE, 0xE9, 0xDD, 0x88, 0x0F, 0xB3, 0x6F, 0xB2,
+    0x9D, 0xD4, 0x78, 0x95, 0xD9, 0x9C, 0xDB, 0xF5, 0x6D, 0xF3, 0x46, 0xED, 0x52, 0x6F, 0xD4, 0x3E,
+    0xDB, 0x6C, 0xD4, 0xFE, 0xA0, 0xDD, 0xA8, 0x3D, 0xDA, 0x6A, 0xA3, 0x76, 0xB4, 0xC5, 0x46, 0xED,
+    0xB2, 0xDE, 0xA8, 0x9D, 0x34, 0x1B, 0xB5, 0xAB, 0x52, 0x67, 0x83, 0xF3, 0x7C, 0x37, 0xED, 0x42,
+    0x1B, 0x8B, 0x5C, 0x3B, 0x2D, 0xB9, 0x87, 0xBD, 0x15, 0x7C, 0xE5, 0x2E, 0x6F, 0xB5, 0xB7, 0x62,
+    0xC0, 0xBD, 0x15, 0x3C, 0x06, 0xC2, 0xDF, 0x79, 0x2F, 0x44, 0x8D, 0x1B, 0xB8, 0x3B, 0x86, 0x1B,
+    0xB4, 0xB1, 0x2A, 0xBC, 0x51, 0x70, 0xDE, 0x49, 0x67, 0x71, 0x87, 0xB3, 0xAC, 0x72, 0x75, 0x06,
+    0x40, 0x8D, 0x29, 0x56, 0x4E, 0xBA, 0xA7, 0x36, 0x83, 0x1E, 0x48, 0x45, 0xC5, 0x7D, 0xF5, 0x14,
+    0xC4, 0xAB, 0xB1, 0xB1, 0xA7, 0xBC, 0xDE, 0x54, 0x5E, 0x23, 0x9D, 0xDA, 0xD3, 0xD6, 0xB4, 0xB9,
+    0xAE, 0x1A, 0xB4, 0xC3, 0x65, 0xFD, 0xEF, 0xB0, 0xB0, 0xE3, 0xEB, 0xBF, 0xA9, 0x8A, 0x73, 0xDE,
+    0x89, 0xAC, 0x13, 0x9D, 0xF5, 0x82, 0xCC, 0x0B, 0xCE, 0x08, 0x55, 0xF7, 0xF7, 0x1B, 0xFE, 0xF0,
+    0xD4, 0xDC, 0xC7, 0x72, 0xB8, 0x88, 0xC6, 0xD1, 0xE5, 0x98, 0x1B, 0xF7, 0xC8, 0x18, 0x7D, 0x66,
+    0x3C, 0x2E, 0xF6, 0x85, 0xB6, 0xBA, 0xCB, 0x81, 0x6F, 0x2A, 0xEE, 0x57, 0xB2, 0xD5, 0xFD, 0x23,
+    0x06, 0xB0, 0x5E, 0xB9, 0xC3, 0x56, 0xF7, 0xC1, 0xC4, 0x56, 0xF7, 0xCD, 0x00, 0xD1, 0x1A, 0x03,
+    0x88, 0x13, 0x30, 0x51, 0x71, 0x1B, 0xCC, 0x05, 0x6E, 0x83, 0xA1, 0x5F, 0x6A, 0xC8, 0x65, 0xB1,
+    0x7C, 0x1B, 0xC9, 0x49, 0xD6, 0x5E, 0x43, 0xBF, 0xAB, 0x21, 0x38, 0xED, 0xE9, 0x60, 0xB9, 0x4D,
+    0xFD, 0x5D, 0x6E, 0x00, 0xA1, 0x51, 0x9D, 0xE4, 0xC2, 0xDD, 0x64, 0xAE, 0x6D, 0x65, 0xB3, 0xDD,
+    0xE5, 0xD0, 0xEC, 0x15, 0x3A, 0xDD, 0x52, 0xA3, 0x98, 0x96, 0x53, 0x00, 0x84, 0xC6, 0xD7, 0xC7,
+    0x4E, 0x01, 0xF8, 0xAE, 0x4E, 0xDA, 0xDB, 0x86, 0x6E, 0x3E, 0x05, 0x60, 0x87, 0x7D, 0x3F, 0x0B,
+    0x24, 0x3C, 0x85, 0x25, 0xCF, 0xB9, 0xEF, 0xE7, 0xFF, 0xB5, 0xFB, 0x7E, 0x98, 0x3F, 0xA7, 0x36,
+    0xC8, 0xC9, 0xF1, 0x7D, 0x3F, 0x1A, 0x1F, 0xCD, 0x0D, 0x55, 0x63, 0x5C, 0xA9, 0x3B, 0x1D, 0x4A,
+    0xC0, 0x4D, 0xBB, 0xD6, 0xAD, 0x75, 0xFA, 0xA9, 0x86, 0x4A, 0x8C, 0x38, 0x25, 0xF9, 0x53, 0x75,
+    0x00, 0xF9, 0x0E, 0x54, 0x4E, 0x1B, 0xD1, 0x67, 0x0C, 0x36, 0x59, 0x38, 0x61, 0x6B, 0xD8, 0x6D,
+    0xE9, 0x16, 0xCB, 0x79, 0x52, 0xD6, 0xEF, 0xE9, 0xB4, 0x1C, 0xD1, 0x23, 0x56, 0x8C, 0xED, 0xA6,
+    0x9F, 0xBF, 0x6B, 0x72, 0x60, 0x4D, 0x85, 0xC0, 0xF5, 0x41, 0x98, 0x35, 0x9E, 0x12, 0x47, 0x9C,
+    0xCE, 0xE1, 0x5B, 0x3A, 0x45, 0x4A, 0xA7, 0x8B, 0x79, 0x91, 0x06, 0x9E, 0xFC, 0x85, 0xE4, 0xF0,
+    0x98, 0x73, 0xB3, 0x0C, 0x1C, 0x62, 0xE7, 0xCB, 0x3E, 0xE1, 0x6C, 0x88, 0xB5, 0xF4, 0x5A, 0xEE,
+    0x71, 0x2D, 0x49, 0xFA, 0x5A, 0x8D, 0x54, 0x34, 0x56, 0x69, 0x58, 0xD6, 0x4D, 0xEA, 0x38, 0x67,
+    0xDD, 0xAB, 0x88, 0x61, 0x06, 0x89, 0x2D, 0x7C, 0x56, 0xB5, 0xB6, 0x61, 0x9D, 0x11, 0x4E, 0x93,
+    0x78, 0x5D, 0x32, 0x21, 0x7D, 0x80, 0xB1, 0xC0, 0x8B, 0xCE, 0x13, 0x45, 0x2E, 0xD3, 0x7F, 0xB5,
+    0x22, 0x47, 0x44, 0x52, 0x8C, 0x18, 0xDC, 0x1F, 0xA2, 0x75, 0x4C, 0xB7, 0xCD, 0x5C, 0x17, 0xF4,
+    0x2B, 0x59, 0x81, 0xB6, 0x78, 0x97, 0xE2, 0x62, 0x3C, 0x81, 0xFD, 0x51, 0x77, 0xCF, 0xD0, 0x53,
+    0xDB, 0x1B, 0x0B, 0x1D, 0x1D, 0xB9, 0x8D, 0xAA, 0x5D, 0x1E, 0x02, 0x79, 0xB2, 0x88, 0x5B, 0x09,
+    0x1B, 0x88, 0x26, 0xB2, 0x27, 0x89, 0x36, 0x08, 0xC0, 0xED, 0xF6, 0xFD, 0x1E, 0x8C, 0xC9, 0x5D,
+    0x3E, 0x5F, 0xAD, 0x81, 0xBD, 0xA7, 0xC6, 0x42, 0xFF, 0xE8, 0x73, 0x39, 0x16, 0xA2, 0xDB, 0x48,
+    0x93, 0xF9, 0x1B, 0x72, 0xC4, 0x98, 0x11, 0xED, 0x13, 0xD0, 0xA9, 0xD3, 0x2C, 0x65, 0x6C, 0xB5,
+    0xBD, 0xBC, 0xD1, 0x9D, 0x07, 0xBD, 0xEB, 0xFC, 0x1E, 0xFD, 0x80, 0xDA, 0xCC, 0x86, 0x58, 0xB9,
+    0xF9, 0x9A, 0x88, 0x84, 0x58, 0x66, 0x29, 0xA9, 0x4F, 0x77, 0x68, 0xFC, 0x4A, 0x0D, 0x31, 0x73,
+    0x4C, 0xA0, 0x99, 0x4B, 0x50, 0x68, 0x4C, 0xC0, 0x1C, 0xD3, 0x5B, 0x0A, 0x24, 0x0B, 0x01, 0xCC,
+    0xCE, 0xA4, 0xBB, 0x8D, 0xD4, 0xB8, 0xD7, 0xFB, 0xC1, 0x77, 0xD5, 0xDC, 0xE8, 0x84, 0x38, 0x03,
+    0x3F, 0x49, 0x4C, 0xBA, 0x7A, 0x4D, 0xB6, 0x80, 0xA9, 0x47, 0x20, 0x99, 0xF8, 0x78, 0xB1, 0x02,
+    0x46, 0x97, 0xC4, 0x3C, 0x1C, 0x92, 0x88, 0x69, 0xE8, 0x89, 0xFB, 0x81, 0x66, 0x21, 0x8D, 0x42,
+    0x45, 0x93, 0x30, 0x72, 0xC6, 0xDD, 0xF4, 0x7B, 0x68, 0x0A, 0x1E, 0x27, 0x84, 0xF2, 0x69, 0x91,
+    0x74, 0x7E, 0x39, 0x10, 0x67, 0xAA, 0x7A, 0x34, 0xA7, 0x80, 0xDD, 0xD4, 0xA7, 0x80, 0xC9, 0x36,
+    0x73, 0x6D, 0x05, 0x38, 0x63, 0x71, 0xE0, 0x43, 0x63, 0xCB, 0xB8, 0x49, 0x91, 0xDA, 0xE5, 0x0D,
+    0xEE, 0xC9, 0x1E, 0x7D, 0x34, 0xB0, 0xDE, 0x92, 0xB7, 0x81, 0x29, 0x8F, 0x8E, 0xC5, 0x9E, 0x1F,
+    0xB2, 0xD3, 0xCA, 0x14, 0xA7, 0x15, 0x5D, 0x8A, 0x35, 0xCB, 0x4C, 0xE8, 0x41, 0x5B, 0x86, 0x52,
+    0x67, 0x39, 0x71, 0xB1, 0x08, 0xE3, 0xC8, 0x56, 0xE6, 0xDD, 0x73, 0x5A, 0x61, 0x41, 0x57, 0x91,
+    0xF6, 0x18, 0xB4, 0xC1, 0x50, 0x00, 0xBA, 0x59, 0x72, 0x4D, 0x57, 0x73, 0x4D, 0x41, 0xAE, 0x59,
+    0x50, 0x8F, 0xC8, 0x9F, 0x17, 0x88, 0x83, 0x6A, 0xBB, 0x70, 0xB2, 0x28, 0x0D, 0x27, 0x18, 0xCF,
+    0x27, 0xD8, 0xE5, 0x13, 0x06, 0xB2, 0xC6, 0x42, 0xD6, 0x61, 0xE3, 0xA8, 0x79, 0x9E, 0x3C, 0xCE,
+    0x7B, 0xE4, 0x48, 0x56, 0x9B, 0x00, 0x23, 0x19, 0x81, 0x62, 0x2C, 0x8C, 0x33, 0x36, 0x60, 0xAA,
+    0xC5, 0x23, 0xBB, 0x85, 0x64, 0xA7, 0xAA, 0xA0, 0x46, 0xB2, 0x7A, 0x6F, 0x4F, 0xBB, 0x80, 0x0F,
+    0xB6, 0xE4, 0x99, 0x46, 0x15, 0x96, 0x92, 0x13, 0x33, 0x47, 0x0F, 0x34, 0xF8, 0x66, 0x24, 0x46,
+    0xA7, 0x05, 0x55, 0x7A, 0x08, 0x63, 0xB0, 0x18, 0x70, 0xAF, 0x83, 0xF5, 0x83, 0x88, 0xDB, 0x31,
+    0xAC, 0x1F, 0x24, 0xEA, 0x5F, 0xA2, 0xFA, 0x7E, 0xAA, 0x20, 0x76, 0x79, 0x2C, 0xEB, 0x87, 0x52,
+    0x99, 0xEF, 0xA1, 0x7A, 0xA3, 0xB0, 0x58, 0x45, 0xA5, 0x7D, 0x82, 0xD5, 0xB2, 0xC3, 0x13, 0x51,
+    0xA2, 0xDE, 0xB4, 0x54, 0xFE, 0x41, 0xA9, 0x3A, 0x7F, 0x2E, 0x95, 0x5B, 0xE8, 0x6A, 0x20, 0x95,
+    0xCD, 0x0C, 0x06, 0x8F, 0x3B, 0x0F, 0xC1, 0x49, 0xB0, 0x86, 0x9B, 0xAD, 0xF9, 0x75, 0x2C, 0xCE,
+    0x9C, 0x30, 0x99, 0x34, 0x3B, 0xA9, 0x3A, 0x63, 0xCA, 0xDB, 0xD0, 0x49, 0x0F, 0xE8, 0x4C, 0x8C,
+    0x93, 0xFA, 0x4C, 0x8C, 0x8D, 0x09, 0xD3, 0x39, 0x43, 0x66, 0xB2, 0x99, 0xC3, 0x9B, 0x1C, 0xAE,
+    0x2F, 0x0A, 0x2C, 0xE4, 0xF8, 0x60, 0x2C, 0xED, 0xF3, 0xE2, 0xE3, 0x2C, 0x25, 0x77, 0x44, 0x1E,
+    0xFC, 0xC4, 0x18, 0x9C, 0x38, 0x7A, 0x3F, 0x87, 0xE6, 0x4E, 0x6F, 0x73, 0x68, 0x6E, 0xBC, 0x71,
+    0x68, 0xAE, 0x31, 0x76, 0x68, 0xAE, 0xB5, 0xCD, 0xA1, 0xB9, 0x66, 0xF0, 0x14, 0x04, 0x11, 0x8F,
+    0x6A, 0xEA, 0xE9, 0x58, 0x4A, 0x7D, 0xD0, 0x92, 0x1C, 0x31, 0xB4, 0xAE, 0x8F, 0x18, 0x72, 0x83,
+    0x2D, 0x8E, 0x18, 0xBA, 0xA2, 0xB7, 0xF7, 0xCE, 0xCB, 0x31, 0x43, 0x1D, 0xD4, 0xCD, 0x11, 0x43,
+    0x3F, 0x48, 0x9D, 0xE6, 0x88, 0xA1, 0xA9, 0x80, 0x29, 0x36, 0xEE, 0x7B, 0x83, 0x96, 0x9A, 0x9B,
+    0x72, 0xB3, 0x1E, 0x75, 0xEF, 0xB7, 0xD9, 0xDC, 0xBD, 0x2B, 0xBD, 0x67, 0xF6, 0x02, 0x01, 0xD3,
+    0x93, 0xD5, 0x67, 0x8B, 0xCC, 0x9C, 0x5B, 0x94, 0x4D, 0x3F, 0x0E, 0xEE, 0x40, 0x0D, 0x0F, 0xFD,
+    0xC2, 0x93, 0x75, 0x51, 0x71, 0x33, 0xAF, 0x40, 0x33, 0xB5, 0xA4, 0xAB, 0xAC, 0xF6, 0x82, 0x77,
+    0x3E, 0x7B, 0x87, 0x02, 0xB0, 0x23, 0xE7, 0x12, 0x68, 0x64, 0xEC, 0x9D, 0x9A, 0x0B, 0xB4, 0x5F,
+    0x24, 0x90, 0x94, 0x27, 0x79, 0x53, 0xFB, 0xBC, 0x0D, 0x7A, 0xDD, 0xD5, 0x31, 0xA6, 0x29, 0x06,
+    0xEA, 0x2C, 0xFA, 0x8A, 0xEA, 0x72, 0x27, 0x55, 0xE1, 0x0F, 0x5F, 0x1D, 0x54, 0x25, 0x77, 0xF2,
+    0x0E, 0xD0, 0x2D, 0x0F, 0x6A, 0x68, 0x7D, 0x38, 0x8A, 0xD9, 0x35, 0xEE, 0xA4, 0x0F, 0x78, 0x8E,
+    0xC0, 0x94, 0x46, 0x58, 0xDA, 0x5B, 0xCF, 0x14, 0xCD, 0xDC, 0x60, 0xF8, 0x20, 0x47, 0x37, 0x7F,
+    0x78, 0xEA, 0xA4, 0x2F, 0x1D, 0x9F, 0x17, 0xD1, 0xB3, 0x22, 0x58, 0x7C, 0x5E, 0xDC, 0xA7, 0x3D,
+    0xF5, 0x5F, 0x73, 0x23, 0xF5, 0xAF, 0x7D, 0x38, 0x5A, 0x4C, 0x1C, 0xE8, 0xAA, 0x91, 0x38, 0x6B,
+    0x71, 0xE9, 0xC2, 0x14, 0xC1, 0x1D, 0x70, 0x12, 0x8C, 0x0B, 0x1E, 0x62, 0x60, 0x04, 0xED, 0x7F,
+    0x84, 0x30, 0x07, 0x1D, 0x60, 0xDF, 0xF9, 0xB0, 0xDF, 0xE8, 0x8E, 0x87, 0xFD, 0xDE, 0x3C, 0x25,
+    0x01, 0x0E, 0x61, 0xDF, 0x84, 0x87, 0xBA, 0x84, 0x13, 0xEC, 0xAB, 0x7D, 0xC6, 0x65, 0xED, 0x33,
+    0x96, 0x69, 0x94, 0x1D, 0xFA, 0x34, 0x3E, 0x00, 0xC3, 0x92, 0x1E, 0x4C, 0x8F, 0xDE, 0x6D, 0xC9,
+    0x90, 0x76, 0x20, 0x46, 0x47, 0x5C, 0x8C, 0x59, 0x5D, 0xF1, 0x88, 0x27, 0x2E, 0x40, 0x88, 0xB9,
+    0x91, 0x5D, 0xF2, 0x94, 0xEB, 0xD5, 0x0D, 0x5B, 0x25, 0x1A, 0xC3, 0x7E, 0x04, 0xE9, 0x4F, 0x9C,
+    0x3A, 0x75, 0x3A, 0xE5, 0x56, 0xA8, 0x34, 0xE4, 0xAB, 0x1E, 0xDF, 0xF3, 0xB5, 0x15, 0xA4, 0x49,
+    0x87, 0xA7, 0x7A, 0xF9, 0x81, 0xCB, 0xC0, 0x86, 0x44, 0x35, 0x4C, 0x09, 0x69, 0xE8, 0xDC, 0x1C,
+    0x1E, 0x64, 0x00, 0x91, 0xE1, 0xA2, 0x1B, 0xC7, 0xA1, 0x2C, 0x9E, 0xD5, 0xBB, 0x6F, 0x82, 0x3A,
+    0xD7, 0x53, 0x22, 0x7E, 0x31, 0x0F, 0xA2, 0xEA, 0x2F, 0x42, 0xB4, 0x49, 0x57, 0x78, 0xFC, 0x57,
+    0x40, 0x4E, 0x74, 0x7F, 0xC1, 0x9C, 0xDD, 0x4C, 0xA7, 0xFD, 0x3D, 0x3F, 0xC5, 0xE9, 0xE2, 0x17,
+    0x84, 0x3C, 0x6E, 0x4E, 0x2C, 0xB7, 0x87, 0xDA, 0x1F, 0x33, 0xFA, 0x53, 0x1E, 0x00, 0x23, 0xC5,
+    0x0C, 0xBE, 0xBD, 0xB1, 0xBE, 0x76, 0xA3, 0x9F, 0xCA, 0x58, 0x78, 0xBE, 0x4E, 0x20, 0x9B, 0x9F,
+    0xA8, 0x55, 0xF4, 0xF8, 0x16, 0x49, 0x82, 0x7F, 0x73, 0xCE, 0x85, 0xBE, 0xF0, 0x87, 0xAA, 0xDE,
+    0x0E, 0x54, 0x53, 0x75, 0xF2, 0xA9, 0xC9, 0xBE, 0x3C, 0x68, 0xA3, 0x4D, 0x61, 0x64, 0x4D, 0xD9,
+    0x1C, 0x84, 0x05, 0xB2, 0xF0, 0xD4, 0x44, 0x26, 0xCA, 0x83, 0x38, 0xAF, 0x7A, 0x9F, 0xB1, 0xE0,
+    0xBD, 0x94, 0xE3, 0x77, 0xAF, 0xAA, 0x03, 0x66, 0xF7, 0x71, 0x58, 0x99, 0x4B, 0x89, 0x05, 0xCE,
+    0xF6, 0xFA, 0x97, 0x92, 0x67, 0x30, 0x9B, 0x4F, 0x89, 0x5D, 0x93, 0x6B, 0xC5, 0xEE, 0xD6, 0xD9,
+    0xAA, 0x0C, 0x12, 0x5E, 0x12, 0x34, 0x95, 0x35, 0x0D, 0xDB, 0x2E, 0x4D, 0xC6, 0x61, 0xE3, 0x9E,
+    0xE0, 0x01, 0x25, 0xFD, 0xC0, 0x67, 0xA6, 0x65, 0x3F, 0xC6, 0x1D, 0x67, 0xD5, 0x0C, 0x63, 0x55,
+    0x8C, 0x25, 0x11, 0x2A, 0xB8, 0xB5, 0xF9, 0xC4, 0x13, 0x65, 0x65, 0xDF, 0x54, 0xA5, 0xC6, 0xA2,
+    0x5C, 0xE9, 0x58, 0x49, 0x9E, 0xC3, 0x7B, 0xEF, 0x2A, 0xEE, 0x53, 0xF5, 0x55, 0xF8, 0x56, 0xA1,
+    0x1C, 0xDA, 0x15, 0x53, 0x0C, 0x5E, 0x36, 0xC7, 0x63, 0xAB, 0x2F, 0xCB, 0xFF, 0x7A, 0x70, 0xB8,
+    0x1F, 0x09, 0xC8, 0x1E, 0x67, 0xB9, 0xDD, 0x4E, 0x0E, 0xA5, 0x6C, 0xA8, 0x0F, 0x5A, 0xA8, 0xE9,
+    0xC4, 0xF1, 0x2A, 0x5F, 0x82, 0x51, 0x10, 0x41, 0xDA, 0x1B, 0x13, 0xA4, 0xC1, 0x83, 0x1C, 0x0F,
+    0xAC, 0x01, 0x70, 0x25, 0x31, 0x8E, 0x90, 0xBD, 0x2A, 0x1A, 0x1F, 0x8A, 0xAD, 0x77, 0x0F, 0x5A,
+    0x59, 0x87, 0x98, 0xC6, 0x0F, 0xDA, 0xDD, 0x83, 0x77, 0x79, 0x5A, 0xF5, 0xCE, 0xBB, 0x07, 0x29,
+    0x58, 0x29, 0x4C, 0x45, 0xA0, 0x8E, 0x0B, 0xD3, 0xED, 0x76, 0x15, 0xCA, 0x5E, 0xA8, 0x8D, 0xD2,
+    0xD5, 0xE7, 0xBE, 0x6D, 0xB9, 0xAB, 0xF0, 0xDE, 0x36, 0x43, 0x4A, 0xFB, 0xFB, 0xFD, 0x7E, 0x49,
+    0x2D, 0xC4, 0x9E, 0xA8, 0x5D, 0xDC, 0x0C, 0xC9, 0xA6, 0xF2, 0xEC, 0x84, 0xB0, 0x7F, 0xA9, 0x6E,
+    0xF6, 0xF6, 0x9B, 0x21, 0x6F, 0x9F, 0x9E, 0x85, 0x3B, 0x4F, 0xCF, 0x03, 0xEA, 0x8F, 0x9E, 0x1E,
+    0x6E, 0xFF, 0x9E, 0x94, 0xCE, 0xBB, 0xD2, 0x4F, 0xB9, 0xF7, 0x56, 0x92, 0xFF, 0xC1, 0x1C, 0xEA,
+    0xCA, 0x61, 0xED, 0x60, 0x40, 0x59, 0xBE, 0x6A, 0x6C, 0xB0, 0xFC, 0x6E, 0x1C, 0x60, 0x05, 0xC9,
+    0x7D, 0x81, 0x28, 0x7C, 0x7C, 0x8B, 0xE3, 0x43, 0x3E, 0xF1, 0xFB, 0xF5, 0x2D, 0x04, 0xE9, 0xC5,
+    0x29, 0x1E, 0xD3, 0xA2, 0xA3, 0xC8, 0xCB, 0xD4, 0x0D, 0xF2, 0x9F, 0x69, 0xD0, 0x99, 0x69, 0xF0,
+    0x98, 0x16, 0xB3, 0x89, 0x22, 0xCF, 0xD3, 0x6D, 0xD6, 0xDD, 0x38, 0xA6, 0xE5, 0x8F, 0xDB, 0x63,
+    0x5A, 0x8A, 0xC6, 0x27, 0xA1, 0xB3, 0xE4, 0xB2, 0x36, 0xBD, 0xBE, 0xF5, 0x93, 0x73, 0xB0, 0x9E,
+    0x94, 0x7C, 0x5A, 0x61, 0xD3, 0x1D, 0x65, 0xCB, 0x43, 0x1E, 0x92, 0xDB, 0xE0, 0x69, 0xF0, 0x88,
+    0x07, 0x47, 0x76, 0x06, 0xF3, 0x3C, 0x75, 0x3C, 0x89, 0x5E, 0x93, 0xF7, 0xF0, 0xBD, 0x43, 0xFC,
+    0x4A, 0xBB, 0xE1, 0xF6, 0x21, 0x8F, 0x90, 0x71, 0xF2, 0x71, 0x25, 0xBB, 0x4C, 0x95, 0xFB, 0x3E,
+    0xC3, 0xCF, 0x04, 0xA7, 0xB2, 0x03, 0x78, 0xFF, 0x9E, 0x47, 0x38, 0x4C, 0x66, 0xF4, 0xBC, 0xE4,
+    0x28, 0x2C, 0xB7, 0xD4, 0x88, 0x36, 0xE9, 0xEB, 0x47, 0x7B, 0x96, 0xBA, 0x7A, 0x9E, 0xAC, 0xD4,
+    0xA3, 0x47, 0xBE, 0x4B, 0xF2, 0xD4, 0x04, 0x67, 0xED, 0xF6, 0xD9, 0x8A, 0xDA, 0x9A, 0xBD, 0x34,
+    0x6E, 0xCD, 0xCE, 0x7E, 0xE1, 0xAD, 0x13, 0x8C, 0xC6, 0x71, 0x02, 0x38, 0x7F, 0x46, 0x5D, 0xEA,
+    0xA8, 0xF8, 0x8E, 0x59, 0xFE, 0x3B, 0x6E, 0xA5, 0x08, 0x64, 0xDB, 0x82, 0x80, 0x50, 0x72, 0x12,
+    0x9D, 0x10, 0x46, 0x5D, 0xDA, 0x44, 0x78, 0x59, 0x94, 0xE0, 0x4D, 0x1D, 0x08, 0xAC, 0xAB, 0xE7,
+    0xA6, 0x6E, 0x33, 0xA2, 0xBE, 0x84, 0xC7, 0x98, 0x83, 0x0D, 0xEF, 0xC8, 0x98, 0x0F, 0xFA, 0xB8,
+    0xC6, 0xDD, 0xDD, 0xA7, 0x72, 0x52, 0xF9, 0xB2, 0xC7, 0xE0, 0x4C, 0x5D, 0x60, 0xCB, 0x1D, 0xCE,
+    0xE5, 0x0C, 0x3C, 0xF5, 0x74, 0xF0, 0x05, 0xF6, 0xAF, 0x04, 0xF2, 0x7F, 0x5E, 0x68, 0xF7, 0x74,
+    0x5D, 0xFE, 0x79, 0xAA, 0xFF, 0x33, 0xC3, 0xC3, 0xEA, 0xA1, 0xA5, 0x1A, 0x95, 0xAD, 0xB7, 0xFA,
+    0x99, 0x26, 0x6C, 0xBC, 0x6F, 0xB9, 0xC9, 0x1F, 0x9A, 0x5A, 0xD8, 0xB5, 0x2C, 0x23, 0x7D, 0x82,
+    0x6B, 0x9B, 0x60, 0x64, 0x35, 0xD1, 0x04, 0xE3, 0x3F, 0xB5, 0xF2, 0xF8, 0xE2, 0xBD, 0x75, 0x7A,
+    0xEA, 0xD2, 0xA8, 0x1F, 0xD9, 0xF5, 0x7F, 0x86, 0x76, 0xD7, 0x9D, 0xCE, 0xA4, 0xD3, 0x3B, 0x77,
+    0xCB, 0x38, 0xBD, 0x76, 0x52, 0xC9, 0x71, 0x2D, 0xF5, 0xC1, 0xB4, 0x77, 0xEA, 0x56, 0xF4, 0xFF,
+    0x01, 0xD5, 0x5A, 0x4F, 0x8C, 0xDC, 0x66, 0x15, 0x7F, 0xB6, 0x27, 0xEB, 0xA4, 0x86, 0xF5, 0x56,
+    0x5A, 0x94, 0x94, 0xD2, 0x75, 0x0F, 0x20, 0x25, 0x55, 0x12, 0x73, 0xE0, 0x80, 0x60, 0xB3, 0xFE,
+    0x68, 0x0E, 0x45, 0xEA, 0xA1, 0x7B, 0x60, 0xC5, 0x09, 0xF5, 0x1A, 0xF5, 0xB2, 0x3D, 0xF4, 0xD0,
+    0x43, 0x76, 0x6C, 0x29, 0x87, 0x1E, 0xB3, 0x1C, 0xE0, 0x82, 0x84, 0x72, 0xC8, 0x21, 0x44, 0xAA,
+    0xD2, 0xC3, 0x1E, 0x10, 0xCA, 0x32, 0x46, 0x02, 0xF5, 0x6A, 0x89, 0x03, 0x87, 0x1E, 0x30, 0x6D,
+    0xE0, 0x40, 0x10, 0x31, 0x68, 0x2A, 0xBC, 0x93, 0x99, 0x31, 0xBF, 0xF7, 0xBE, 0xCF, 0x9E, 0xC9,
+    0x1F, 0x42, 0x0B, 0xE3, 0x59, 0x77, 0xB4, 0xDF, 0x9B, 0x59, 0xDB, 0xF3, 0xF9, 0xBD, 0xDF, 0xF7,
+    0xFE, 0xFC, 0xDE, 0xE7, 0x21, 0xBA, 0x48, 0xFC, 0x8A, 0x45, 0x0E, 0x14, 0xCB, 0x07, 0x09, 0x84,
+    0xF5, 0xC7, 0x14, 0xD2, 0xF9, 0x30, 0x63, 0x79, 0xAD, 0x80, 0xF4, 0x2E, 0xB3, 0xF4, 0xAD, 0x12,
+    0x72, 0x95, 0xC6, 0x90, 0xE7, 0xE9, 0x10, 0x72, 0x93, 0xFA, 0x90, 0x7B, 0x3B, 0x3C, 0xC5, 0xA0,
+    0xAA, 0x30, 0x45, 0x4E, 0x41, 0x42, 0x56, 0x46, 0x7E, 0x4A, 0x4E, 0x4A, 0x5E, 0x46, 0x4E, 0x42,
+    0x4E, 0x41, 0x9E, 0xC8, 0x20, 0x23, 0x6F, 0x42, 0xD5, 0x98, 0xE2, 0x2A, 0xA1, 0x47, 0x5E, 0x5B,
+    0x73, 0x9A, 0xE8, 0xCF, 0x3D, 0x56, 0x64, 0x90, 0x93, 0x3F, 0x1A, 0x63, 0xCA, 0x88, 0x7C, 0x15,
+    0xD2, 0x0A, 0x05, 0x38, 0x1A, 0xE0, 0x36, 0xA1, 0xB2, 0x06, 0x95, 0x0A, 0xEE, 0x85, 0x2A, 0xC2,
+    0xFF, 0x7B, 0x18, 0x87, 0x38, 0xB6, 0x47, 0x91, 0xEA, 0xC3, 0x92, 0xE8, 0xFE, 0xF5, 0xCC, 0x9B,
+    0xFA, 0x05, 0x6D, 0x9B, 0xE9, 0x43, 0x8C, 0x48, 0xBE, 0xA6, 0x27, 0xA6, 0xB7, 0x58, 0xD8, 0x15,
+    0x5B, 0x68, 0x7D, 0x2F, 0x97, 0x7F, 0x44, 0x86, 0xA2, 0xD7, 0xA6, 0x7C, 0xE9, 0xFC, 0x9C, 0x7E,
+    0xC7, 0x8A, 0x54, 0x8C, 0x5B, 0x8D, 0x30, 0xAD, 0xC2, 0xB0, 0x30, 0xF0, 0x0D, 0xFA, 0x32, 0xE9,
+    0xB1, 0x38, 0x94, 0xAC, 0x7D, 0x96, 0x0E, 0x9B, 0x72, 0xCE, 0x63, 0x13, 0xAB, 0xEF, 0x33, 0x2C,
+    0xFF, 0x62, 0x0B, 0xDD, 0x84, 0xAD, 0x3A, 0x45, 0xEB, 0x1D, 0x41, 0x84, 0xE8, 0x26, 0x54, 0xC3,
+    0xC1, 0xCB, 0x09, 0x45, 0xBF, 0x23, 0xFA, 0xB4, 0xC0, 0x37, 0x36, 0xC9, 0xD2, 0x8B, 0xBB, 0x10,
+    0x44, 0xEC, 0x64, 0xE6, 0x15, 0x74, 0x70, 0x8E, 0xE5, 0x19, 0x56, 0xB2, 0x9B, 0x88, 0x5C, 0x31,
+    0x71, 0xE3, 0xB9, 0x19, 0x59, 0x6F, 0x60, 0xFA, 0x4B, 0x57, 0x89, 0x0A, 0x1F, 0x3E, 0x63, 0x69,
+    0xE5, 0x76, 0x4B, 0x72, 0xA6, 0x03, 0x72, 0x73, 0x3F, 0x75, 0x32, 0x2F, 0xB5, 0x12, 0x17, 0x5A,
+    0xE1, 0x62, 0x9E, 0x74, 0xB7, 0xCA, 0xDC, 0x23, 0x2F, 0xF3, 0x53, 0x37, 0x0B, 0x94, 0x9B, 0x85,
+    0xCA, 0xC3, 0xBB, 0x9F, 0x05, 0x49, 0x98, 0xF9, 0xA3, 0x4F, 0x86, 0x76, 0x75, 0x6D, 0x6C, 0xEC,
+    0xEC, 0x8B, 0xFC, 0xA1, 0x40, 0xE3, 0xB0, 0x3C, 0xB7, 0x41, 0x5D, 0xF7, 0x14, 0x0E, 0x7D, 0xBC,
+    0x3F, 0x8F, 0xFB, 0xE0, 0x1B, 0xC1, 0xEB, 0x8A, 0xA2, 0xB4, 0x15, 0x8F, 0x41, 0x04, 0x9D, 0x61,
+    0x04, 0x26, 0xEF, 0xB2, 0xFE, 0xBB, 0x43, 0xC8, 0x93, 0x96, 0x68, 0x20, 0xDE, 0x43, 0xDD, 0xF5,
+    0x1E, 0xBA, 0x79, 0x8A, 0x9C, 0xEA, 0x7D, 0x72, 0x5F, 0x1F, 0x03, 0x91, 0x6D, 0x6D, 0x78, 0x5B,
+    0x28, 0xD1, 0x57, 0xB4, 0x8D, 0x1A, 0x13, 0xB1, 0xEE, 0xF7, 0x1C, 0x65, 0x9E, 0x3A, 0x90, 0xB4,
+    0xBF, 0xD6, 0x25, 0xCF, 0x79, 0x76, 0x7D, 0xA2, 0x13, 0xA4, 0x71, 0x8A, 0x61, 0xC0, 0x3F, 0xDA,
+    0xC0, 0xEA, 0x69, 0xB5, 0xCB, 0x92, 0x33, 0x1C, 0xBF, 0x30, 0x59, 0x2E, 0x39, 0xC3, 0x98, 0x79,
+    0xF4, 0x36, 0x1F, 0xFE, 0x6B, 0x21, 0x95, 0x4D, 0xCE, 0xBE, 0xD0, 0x95, 0x0A, 0x46, 0x37, 0x74,
+    0x2A, 0x75, 0x71, 0xFD, 0xA9, 0x9E, 0xC6, 0x69, 0x84, 0x00, 0x01, 0x46, 0x82, 0xE1, 0xC2, 0x22,
+    0x50, 0xCD, 0x27, 0xED, 0x2F, 0x04, 0x36, 0x16, 0xA0, 0xA1, 0x52, 0xD3, 0x0D, 0xEB, 0x44, 0x8B,
+    0xD8, 0x98, 0x64, 0x53, 0x89, 0x74, 0xC4, 0x4A, 0x4F, 0xF3, 0x9C, 0xAE, 0x7B, 0xCF, 0x57, 0xF1,
+    0x9D, 0xEF, 0xE2, 0x46, 0x16, 0x86, 0xD7, 0xB6, 0x07, 0xED, 0x9F, 0x94, 0x1C, 0x7E, 0x95, 0xAD,
+    0x30, 0x39, 0x5C, 0x88, 0x11, 0x75, 0x1D, 0xA5, 0x9B, 0xCF, 0x49, 0x0E, 0x77, 0x5E, 0xD3, 0x39,
+    0x9C, 0xF3, 0x50, 0x6B, 0x28, 0x9D, 0xA2, 0x97, 0x05, 0x8D, 0x0F, 0x18, 0x8D, 0x87, 0x1C, 0x6E,
+    0x96, 0x46, 0x63, 0x9D, 0xBE, 0x38, 0xD9, 0xDB, 0x56, 0x27, 0x0D, 0x42, 0x65, 0x0B, 0xD1, 0xF6,
+    0x64, 0xE6, 0x86, 0x09, 0xE5, 0xEE, 0xE8, 0xF6, 0xD8, 0x2D, 0xE8, 0x2A, 0xD4, 0xDD, 0xC4, 0x38,
+    0x8F, 0xD1, 0xC3, 0xA0, 0x66, 0x8C, 0x6E, 0x27, 0x4E, 0x55, 0x25, 0x8F, 0x1C, 0x9B, 0x0D, 0x0F,
+    0xC3, 0x67, 0x53, 0x83, 0x4F, 0x77, 0x30, 0x5D, 0x55, 0x35, 0x26, 0x0A, 0x95, 0xCB, 0xF5, 0x3B,
+    0x29, 0xA9, 0x48, 0x0E, 0x6C, 0xF0, 0xD3, 0x08, 0x6A, 0x88, 0x25, 0xE9, 0x16, 0x46, 0x1F, 0x23,
+    0xAE, 0xAA, 0xB4, 0xBF, 0xB3, 0xA3, 0xFA, 0x06, 0x8D, 0x88, 0xB4, 0x8A, 0xE0, 0x7F, 0xCA, 0x1D,
+    0xA1, 0x2E, 0x0F, 0x80, 0x87, 0x55, 0xDB, 0xA0, 0x34, 0x7D, 0xAA, 0xAB, 0xCF, 0x0A, 0x88, 0x77,
+    0x88, 0xC5, 0x59, 0xDF, 0xD0, 0x2B, 0x6C, 0x63, 0xB9, 0xEC, 0x54, 0x0F, 0x6A, 0xC9, 0xC6, 0xA6,
+    0xFF, 0x39, 0x30, 0xFD, 0x4F, 0xC6, 0x7E, 0xD2, 0xF4, 0x3F, 0x0B, 0xB1, 0x95, 0x1D, 0xB7, 0x4A,
+    0x32, 0xEB, 0xFE, 0x28, 0xB5, 0x93, 0x41, 0x62, 0x4A, 0x6D, 0x3B, 0xF6, 0x6C, 0x73, 0x82, 0x71,
+    0xC9, 0x1F, 0x3C, 0xA0, 0x2F, 0xB9, 0xEC, 0xEE, 0xDB, 0x8B, 0xB3, 0x43, 0x27, 0xA4, 0x4B, 0x64,
+    0xEF, 0x0F, 0xC9, 0x1F, 0x26, 0x14, 0x22, 0x91, 0xBD, 0x0B, 0x96, 0xB0, 0xAF, 0x4B, 0x63, 0x4B,
+    0x3E, 0x78, 0x53, 0x8A, 0x6E, 0xF8, 0x1A, 0x7A, 0xD5, 0xBA, 0x1B, 0xBB, 0xDA, 0x30, 0xA1, 0x45,
+    0xD8, 0x75, 0xD6, 0xE4, 0x13, 0xEF, 0xD5, 0x7D, 0xB2, 0xAE, 0x23, 0xA3, 0x2D, 0xC1, 0xAE, 0x2B,
+    0x02, 0x24, 0x74, 0x41, 0x9E, 0xB1, 0xDE, 0xAC, 0x7B, 0xAA, 0x60, 0xD6, 0x53, 0x05, 0xD0, 0x0D,
+    0x3D, 0x95, 0x53, 0xF8, 0xA9, 0x97, 0x4A, 0x67, 0x55, 0xF8, 0x98, 0x3D, 0xE0, 0x51, 0x55, 0x45,
+    0xF0, 0x93, 0x9D, 0x6D, 0xA4, 0x2B, 0xF2, 0x13, 0xDD, 0xB2, 0x63, 0x1A, 0x5C, 0x6B, 0x65, 0xD6,
+    0xF4, 0x4E, 0x4A, 0xE1, 0x54, 0xC7, 0x29, 0x3A, 0x32, 0x24, 0x1E, 0xEE, 0x18, 0xBE, 0x4D, 0xF6,
+    0x8F, 0xF3, 0x25, 0xAE, 0xD9, 0x7C, 0x5F, 0x04, 0x7D, 0xDE, 0x50, 0x14, 0xFF, 0xB6, 0x95, 0xB5,
+    0xA3, 0x17, 0xD0, 0x05, 0xC5, 0x7F, 0x48, 0xE8, 0x2F, 0xB8, 0x6D, 0x82, 0x16, 0xC9, 0x46, 0x41,
+    0xF5, 0x97, 0xB3, 0x86, 0xB3, 0xCE, 0xA6, 0xD4, 0x9D, 0x0D, 0x2B, 0x18, 0xA7, 0xED, 0xD8, 0xC9,
+    0xC4, 0xDC, 0xE3, 0xFC, 0x84, 0x98, 0xBE, 0x84, 0x2B, 0x0F, 0x3C, 0x55, 0xFB, 0xCA, 0x52, 0x73,
+    0x7F, 0xDD, 0x95, 0x0C, 0xE0, 0xB7, 0x8F, 0x75, 0x25, 0x6D, 0xD5, 0x85, 0x95, 0x1B, 0x14, 0x4E,
+    0xA4, 0x28, 0x5C, 0xE4, 0x92, 0x80, 0x6A, 0xA0, 0x0B, 0x02, 0xCA, 0xE5, 0xEE, 0x84, 0x60, 0xB5,
+    0xF3, 0x39, 0xFF, 0x82, 0x23, 0x02, 0x14, 0x5E, 0x49, 0x1B, 0x03, 0xEA, 0xF9, 0x5C, 0x4B, 0x41,
+    0x0F, 0x50, 0xF9, 0x49, 0xA6, 0x7D, 0x05, 0xB7, 0x93, 0xCB, 0xEC, 0x67, 0xFF, 0x0D, 0xE9, 0xF4,
+    0x04, 0x74, 0x20, 0xFD, 0x3F, 0xD5, 0x20, 0xC1, 0xD5, 0xC9, 0xCD, 0x0C, 0xA4, 0xBB, 0x0C, 0x7C,
+    0x1E, 0xCE, 0xFE, 0xFD, 0x1F, 0xB4, 0x32, 0xD3, 0x3E, 0x31, 0xCF, 0x8B, 0x15, 0x16, 0x73, 0xF0,
+    0xD3, 0x09, 0x1F, 0xE7, 0xCD, 0x18, 0xAC, 0x00, 0x13, 0x9E, 0x3C, 0x64, 0x9A, 0x03, 0x42, 0x61,
+    0x0F, 0xB1, 0x34, 0x56, 0xC9, 0x62, 0x1C, 0x3F, 0x45, 0xD4, 0x67, 0xED, 0x32, 0x54, 0x92, 0x9D,
+    0x20, 0x30, 0x8B, 0x97, 0xCA, 0x7C, 0x34, 0xDD, 0x99, 0x20, 0x77, 0xF1, 0x3D, 0xE6, 0xE8, 0xDA,
+    0x5D, 0x16, 0x13, 0x16, 0x87, 0x35, 0xD9, 0xDD, 0xBD, 0x07, 0x57, 0x99, 0xF2, 0xCD, 0x93, 0x10,
+    0xBE, 0x15, 0x41, 0x83, 0x2D, 0xCC, 0xD4, 0x87, 0x0D, 0x7B, 0x73, 0x83, 0x8F, 0xE1, 0x5C, 0x11,
+    0xE2, 0xBC, 0x9F, 0xC0, 0x59, 0xEE, 0xC5, 0x8A, 0xAA, 0x3A, 0x24, 0x48, 0xE7, 0xBE, 0x20, 0xD5,
+    0xEF, 0x72, 0xEC, 0x17, 0xCC, 0xFC, 0x1E, 0x30, 0x69, 0x70, 0x84, 0x0A, 0xA6, 0x86, 0x27, 0x21,
+    0x05, 0xE2, 0xF5, 0x2D, 0x3A, 0x16, 0x18, 0x42, 0xF8, 0xD6, 0xAF, 0xA0, 0xB5, 0x62, 0xE6, 0xFF,
+    0x4B, 0x1D, 0x50, 0xDC, 0x1F, 0xAD, 0x18, 0x6D, 0x16, 0x81, 0x86, 0x4E, 0x7D, 0xD0, 0x80, 0xE8,
+    0x8A, 0xCF, 0x9C, 0x19, 0x65, 0xCD, 0xF9, 0x88, 0xCB, 0x83, 0x95, 0xB3, 0x16, 0x2F, 0x1F, 0x93,
+    0x03, 0x70, 0xA5, 0x43, 0x72, 0xB9, 0x96, 0x52, 0xF4, 0x31, 0x8C, 0x1F, 0x92, 0x9D, 0x9D, 0x9F,
+    0xA5, 0x8C, 0x05, 0x58, 0xBE, 0xA2, 0x9A, 0x1D, 0x8B, 0x82, 0x6F, 0xF6, 0x0D, 0x4E, 0x5E, 0x33,
+    0xCB, 0x7B, 0xC7, 0x63, 0xF9, 0x59, 0xC3, 0xD1, 0xDD, 0xCB, 0x39, 0x48, 0x05, 0x34, 0xBD, 0x78,
+    0xC9, 0x24, 0xED, 0x5A, 0x9B, 0x23, 0x2E, 0xF0, 0x48, 0xC8, 0x4E, 0xEE, 0xA5, 0xD6, 0x10, 0xB3,
+    0x95, 0x28, 0xE6, 0x63, 0x14, 0xF5, 0xBB, 0x68, 0x07, 0x9A, 0xC1, 0xC7, 0x70, 0x6E, 0x8C, 0x75,
+    0x2D, 0x9D, 0x1C, 0x25, 0xFE, 0x08, 0xAD, 0x48, 0x54, 0x17, 0x78, 0x1D, 0x50, 0x3F, 0x93, 0x44,
+    0xCD, 0x58, 0x5F, 0xE0, 0x85, 0x5F, 0xEF, 0xC6, 0xC2, 0x33, 0x00, 0x58, 0x95, 0x35, 0x3E, 0x02,
+    0xEE, 0xF1, 0x9E, 0xA2, 0xE8, 0x4F, 0xAD, 0x38, 0x00, 0x59, 0xEA, 0xEB, 0xB0, 0xF6, 0x08, 0x0C,
+    0xFE, 0xA5, 0x18, 0xA9, 0x6E, 0x5D, 0x3C, 0xE2, 0x8A, 0x34, 0x8E, 0xD4, 0x05, 0x2C, 0x6E, 0xAD,
+    0xA0, 0xA1, 0xFF, 0x39, 0x39, 0xEF, 0x99, 0x1D, 0x50, 0x26, 0x6D, 0x51, 0xDE, 0x0E, 0x16, 0x1A,
+    0xFC, 0xA9, 0xEC, 0x21, 0x00, 0x06, 0xF7, 0x43, 0x4E, 0x8E, 0xDC, 0xD8, 0xCC, 0x36, 0x3F, 0x3B,
+    0x52, 0x02, 0x4E, 0x28, 0xED, 0x20, 0x11, 0x94, 0x1B, 0x96, 0x40, 0xE2, 0xC2, 0x82, 0xBD, 0xE2,
+    0x29, 0xE5, 0xC1, 0xEC, 0x6F, 0x32, 0x5B, 0xD6, 0xCB, 0x50, 0xF7, 0xEC, 0xEF, 0x18, 0x3D, 0x35,
+    0x5B, 0xC4, 0xE5, 0x2F, 0x56, 0x19, 0x5A, 0x41, 0xA0, 0xE4, 0x64, 0x6C, 0xD6, 0xE5, 0x94, 0x71,
+    0xFA, 0x48, 0x36, 0x07, 0x4A, 0x12, 0xA4, 0x48, 0xA0, 0x22, 0x41, 0x43, 0xE4, 0x98, 0xE2, 0xFF,
+    0x20, 0x9B, 0x6B, 0xEC, 0x92, 0x04, 0x33, 0x99, 0xA7, 0x20, 0x41, 0x4D, 0x2F, 0x03, 0x69, 0xDC,
+    0x0C, 0x70, 0x06, 0x39, 0xD9, 0xCD, 0xFE, 0x35, 0x99, 0x4D, 0x3C, 0xD9, 0x7A, 0x74, 0x35, 0xE9,
+    0x63, 0x83, 0xD8, 0xB2, 0xDD, 0x7B, 0x80, 0x7D, 0x34, 0x75, 0x60, 0xBC, 0x7F, 0x1D, 0x09, 0xC7,
+    0x65, 0x85, 0x40, 0x26, 0x18, 0x19, 0x62, 0xB8, 0x68, 0xEF, 0x51, 0x21, 0x27, 0x18, 0x33, 0x62,
+    0xD0, 0x88, 0x51, 0x23, 0x81, 0x4D, 0x70, 0xD3, 0x20, 0x9D, 0x50, 0xCD, 0x2D, 0xF8, 0x1A, 0x7E,
+    0x0D, 0x69, 0xF6, 0xEC, 0xB2, 0xD7, 0x29, 0x94, 0x64, 0x45, 0x2D, 0xEE, 0x74, 0x61, 0x20, 0x9F,
+    0x92, 0x64, 0x98, 0xB0, 0x21, 0xAA, 0x55, 0x94, 0x84, 0x6A, 0x68, 0xAE, 0x61, 0xC8, 0x86, 0x66,
+    0x1B, 0x9A, 0x6E, 0x68, 0xBE, 0x01, 0xC2, 0xD1, 0x29, 0x8F, 0x62, 0x22, 0x22, 0x4C, 0x44, 0x53,
+    0x11, 0xE6, 0x22, 0x42, 0x46, 0xC0, 0x46, 0xB8, 0x92, 0xB6, 0xEB, 0x56, 0x1A, 0x89, 0xB0, 0xE0,
+    0xD2, 0xF8, 0x9D, 0x29, 0xEF, 0xA0, 0x7F, 0x10, 0x8A, 0x6A, 0x56, 0xB7, 0x40, 0x62, 0x87, 0x72,
+    0xA6, 0x8E, 0x22, 0xEF, 0xCE, 0x03, 0xA2, 0x55, 0x67, 0xC2, 0xDA, 0xAF, 0xB5, 0x0A, 0x4D, 0xE7,
+    0x32, 0xCF, 0x5C, 0xD6, 0xD6, 0x69, 0x5B, 0xE7, 0xED, 0xBA, 0x86, 0xB4, 0x9F, 0x83, 0x1E, 0xB9,
+    0x83, 0xF9, 0xC4, 0xC7, 0xD0, 0xDA, 0x84, 0x95, 0x0A, 0xA6, 0xEA, 0xF4, 0x11, 0xAB, 0x4F, 0xBA,
+    0x69, 0xCA, 0x17, 0x26, 0x81, 0x2B, 0xA8, 0x82, 0xC5, 0xF5, 0x88, 0xCB, 0x28, 0xD3, 0xE9, 0xE8,
+    0xCF, 0xFC, 0x3C, 0xD1, 0x13, 0xDD, 0xCC, 0x03, 0x46, 0x5D, 0xA6, 0xA2, 0x27, 0x64, 0x4F, 0x3A,
+    0xB5, 0xE7, 0x6E, 0xC1, 0xCB, 0xBD, 0x09, 0xCF, 0x78, 0xC8, 0x62, 0xEF, 0x33, 0x8A, 0x43, 0x06,
+    0x67, 0x82, 0x9B, 0xDB, 0x80, 0xBC, 0xBA, 0x83, 0x55, 0x8E, 0xC6, 0xA8, 0x8E, 0x96, 0x6A, 0x16,
+    0xA4, 0x6C, 0x72, 0x5D, 0xD9, 0xAC, 0xC6, 0x2B, 0x52, 0xC6, 0x2A, 0xDE, 0xE6, 0xA6, 0xE4, 0x60,
+    0x96, 0xAD, 0xFD, 0x7C, 0xF6, 0x10, 0x6F, 0xB5, 0x99, 0xA1, 0x13, 0xF8, 0xB1, 0x7D, 0x88, 0x2E,
+    0x6E, 0xEF, 0x5D, 0xD6, 0xDE, 0x57, 0x86, 0xB3, 0x90, 0x58, 0x71, 0xA3, 0xE9, 0x79, 0xDB, 0x41,
+    0xF2, 0x07, 0xA2, 0xC3, 0x70, 0x56, 0xDE, 0x34, 0x13, 0x78, 0xA9, 0xC6, 0x48, 0x38, 0x82, 0x53,
+    0x30, 0x54, 0x9F, 0x0C, 0x19, 0xAA, 0x7C, 0xC8, 0x50, 0xE5, 0x05, 0x9B, 0xF8, 0x71, 0xC6, 0x72,
+    0xBA, 0x34, 0x57, 0x9B, 0x2F, 0xC6, 0xA1, 0x1C, 0x91, 0xCC, 0x0D, 0xA4, 0x7A, 0xD2, 0x04, 0x44,
+    0xE6, 0xF9, 0x03, 0x83, 0x15, 0x0A, 0x5A, 0xAB, 0x82, 0xC0, 0x26, 0xCB, 0x38, 0xD7, 0x31, 0xA8,
+    0x81, 0xF9, 0xEF, 0xF2, 0x90, 0x34, 0x70, 0x06, 0x39, 0x0D, 0x9D, 0xC6, 0xCE, 0x80, 0xA7, 0xA5,
+    0x53, 0x34, 0xEE, 0x58, 0xB3, 0x02, 0xBF, 0x4E, 0x0C, 0x5D, 0x42, 0x6F, 0x7D, 0x2E, 0x36, 0xF5,
+    0x22, 0xEB, 0x12, 0x6D, 0xD0, 0x5B, 0x5B, 0x36, 0x7A, 0x9F, 0x35, 0x58, 0xBB, 0x84, 0xA1, 0x98,
+    0xA2, 0xA3, 0xD5, 0x84, 0xAB, 0x8E, 0x57, 0x1D, 0xB0, 0x06, 0xC9, 0x1B, 0x4B, 0x47, 0x52, 0xFF,
+    0x50, 0x61, 0xC2, 0x6D, 0xEF, 0xEA, 0xE0, 0xEF, 0x90, 0x5F, 0xF3, 0xC6, 0xE6, 0x44, 0x97, 0xD0,
+    0xD3, 0xCF, 0xFD, 0xA2, 0xFC, 0x9B, 0x90, 0x0F, 0xA7, 0xBC, 0xEE, 0x59, 0x9C, 0xF6, 0xE4, 0xC4,
+    0xB2, 0x11, 0xEB, 0x5A, 0x66, 0x7B, 0x56, 0x11, 0x7D, 0xFC, 0xFC, 0x52, 0x51, 0xAA, 0x33, 0x9B,
+    0xAE, 0xB4, 0x26, 0xCB, 0xAD, 0x35, 0xC9, 0x58, 0xBA, 0x47, 0xBB, 0xA8, 0xF9, 0x33, 0x5D, 0x98,
+    0x7F, 0x1C, 0x1C, 0x55, 0xC9, 0x60, 0x12, 0x4C, 0xD4, 0x9B, 0x25, 0xD8, 0x9A, 0x93, 0x61, 0x0A,
+    0x84, 0xCC, 0x84, 0x23, 0x3B, 0xA2, 0x0D, 0xDE, 0xD2, 0xDE, 0xE4, 0x64, 0xFE, 0x0E, 0x3F, 0x9B,
+    0xE1, 0xAD, 0xF7, 0x7F, 0x72, 0x63, 0xFA, 0x30, 0xA9, 0x7F, 0x3B, 0xD1, 0x7F, 0xA6, 0x88, 0x65,
+    0x4B, 0x63, 0x9F, 0xA9, 0x5A, 0x69, 0xAA, 0x58, 0xBF, 0x29, 0x0B, 0x9E, 0x30, 0xA4, 0x6C, 0x8E,
+    0xA4, 0xD1, 0xED, 0x5B, 0x2B, 0xB7, 0xD5, 0xA0, 0x5C, 0xA9, 0x14, 0x08, 0xE5, 0x5D, 0xD6, 0xFB,
+    0x80, 0x0B, 0x1E, 0x6F, 0x14, 0xCB, 0xF2, 0xF0, 0x36, 0xFA, 0x98, 0x13, 0xE2, 0x9E, 0x0B, 0xBB,
+    0xB6, 0x78, 0x47, 0x32, 0xE4, 0x14, 0xE4, 0xFF, 0x88, 0xC5, 0xDF, 0x38, 0xBE, 0xD8, 0x76, 0xF6,
+    0x10, 0x6D, 0xAF, 0x74, 0xA0, 0x92, 0x41, 0x65, 0xBF, 0x4D, 0xD2, 0x00, 0xF7, 0xCF, 0xA7, 0x19,
+    0xA8, 0x68, 0x7F, 0xA9, 0xE6, 0x3F, 0xFE, 0x08, 0x3E, 0x6E, 0xAE, 0xEB, 0xB5, 0x6B, 0xF9, 0x6F,
+    0x70, 0xC6, 0x7F, 0x15, 0x16, 0x6F, 0xC1, 0xC1, 0x61, 0xF9, 0x9A, 0xB6, 0x1C, 0x37, 0xE5, 0x4B,
+    0x78, 0xE7, 0xDD, 0xD6, 0x57, 0x67, 0xF5, 0x6F, 0x7E, 0x37, 0x67, 0xFD, 0xE0, 0x32, 0x11, 0xF2,
+    0xD8, 0x84, 0x0D, 0xDE, 0x3E, 0xE8, 0xF9, 0xF5, 0x6F, 0x26, 0x6C, 0xD9, 0x48, 0x10, 0x57, 0x49,
+    0x8F, 0xCF, 0x4B, 0x74, 0xAC, 0x79, 0x63, 0x54, 0xBA, 0x8D, 0xC1, 0xFB, 0x44, 0x67, 0x45, 0xD5,
+    0x7A, 0x6B, 0x74, 0x79, 0x08, 0x49, 0x72, 0x8E, 0xB3, 0xB7, 0x89, 0xEE, 0x4F, 0x61, 0x6A, 0xCA,
+    0x0F, 0xEF, 0xEA, 0x5F, 0x6A, 0x1C, 0x07, 0x2E, 0xFF, 0x06, 0x9D, 0x18, 0x3B, 0x6C, 0x1C, 0xC7,
+    0xF5, 0xED, 0x2E, 0xC5, 0x89, 0xB8, 0xA1, 0x56, 0x05, 0x13, 0x28, 0x32, 0xC9, 0x6D, 0x5C, 0xC8,
+    0xC4, 0x91, 0xEB, 0x00, 0x44, 0x70, 0xC5, 0xDD, 0xED, 0x28, 0x2A, 0x02, 0x24, 0x48, 0xE2, 0x22,
+    0x4A, 0xE3, 0x00, 0x69, 0x65, 0x21, 0x80, 0x59, 0x30, 0xC0, 0x19, 0x38, 0x71, 0x57, 0x71, 0xA1,
+    0x22, 0x08, 0x70, 0x55, 0xAA, 0x00, 0x61, 0x00, 0x17, 0xD2, 0x25, 0xB0, 0x59, 0x08, 0x08, 0xE1,
+    0x1C, 0xB9, 0x43, 0xAB, 0x48, 0x67, 0x8C, 0x03, 0x38, 0xF5, 0x26, 0x50, 0x65, 0x03, 0xF1, 0x38,
+    0xB8, 0x62, 0x29, 0xEF, 0xDE, 0xE4, 0xBD, 0xD9, 0xBD, 0xBB, 0xA5, 0x45, 0x5B, 0xC7, 0xCC, 0x6F,
+    0xE7, 0xE6, 0x7D, 0x66, 0xDE, 0x67, 0xDE, 0x1B, 0x12, 0xF6, 0xCF, 0x2D, 0x00, 0xAF, 0x7E, 0x73,
+    0x75, 0x9B, 0x49, 0x26, 0xFD, 0xD1, 0xF7, 0xFE, 0x60, 0xC7, 0x2F, 0xAE, 0x00, 0x56, 0x0C, 0xE9,
+    0xDD, 0xC3, 0xF7, 0x0F, 0xF7, 0xD3, 0x3F, 0xC5, 0xFB, 0xF0, 0xE2, 0x0A, 0x60, 0x73, 0x17, 0xB6,
+    0x1E, 0x6D, 0xBD, 0xEB, 0x2E, 0xD9, 0x3F, 0x84, 0xA5, 0x39, 0x2A, 0x40, 0xA4, 0x39, 0x36, 0x30,
+    0x65, 0x3A, 0xBF, 0x3B, 0x18, 0xEC, 0x6B, 0xAD, 0x15, 0x2D, 0x6E, 0x0C, 0x4C, 0xD9, 0x0F, 0xB5,
+    0x29, 0x23, 0x98, 0x16, 0x75, 0xF0, 0xFF, 0xD6, 0x6F, 0xDD, 0xBE, 0xCD, 0x91, 0x9F, 0xA0, 0x2F,
+    0x71, 0xA2, 0x39, 0x75, 0xE8, 0xB3, 0x78, 0x0D, 0x9A, 0xD0, 0x82, 0x88, 0x47, 0x22, 0x8C, 0x2F,
+    0xC1, 0x12, 0xF7, 0xA5, 0x9F, 0xB2, 0xD4, 0x92, 0xB6, 0x60, 0xBC, 0x0D, 0x57, 0x61, 0x1D, 0xC2,
+    0x38, 0x8A, 0xF7, 0x10, 0xAB, 0x01, 0x1E, 0xD8, 0x12, 0x10, 0xE7, 0x1D, 0xFF, 0x1F, 0xB9, 0xFF,
+    0xEF, 0x82, 0xA5, 0x47, 0x96, 0x6C, 0xD8, 0xA2, 0xC1, 0xF8, 0x41, 0xDB, 0x11, 0x57, 0x01, 0xD6,
+    0xAD, 0x34, 0x7C, 0x90, 0x45, 0xBF, 0x1D, 0xED, 0x31, 0xD9, 0x64, 0x71, 0xC3, 0x89, 0x3D, 0x48,
+    0x6D, 0xD9, 0xA8, 0x24, 0xC8, 0x01, 0x86, 0x00, 0x87, 0x00, 0x5D, 0x80, 0x5D, 0x80, 0x6D, 0x38,
+    0xFD, 0xF5, 0x50, 0xEB, 0xFC, 0xB5, 0xDD, 0x15, 0x5A, 0xCC, 0x6B, 0xAD, 0x8E, 0xB6, 0x5B, 0x21,
+    0xC3, 0xAB, 0xB5, 0x36, 0x65, 0x38, 0x41, 0xE3, 0xDB, 0x0B, 0xC8, 0xEA, 0xF4, 0xAD, 0x21, 0xFD,
+    0x2C, 0x99, 0xEC, 0xD6, 0xF0, 0x77, 0x27, 0x8B, 0x5D, 0xDC, 0xF4, 0x2F, 0xB4, 0xE9, 0xF6, 0x0A,
+    0x2D, 0x76, 0x0D, 0x87, 0x21, 0x31, 0x5B, 0xEC, 0x43, 0x90, 0xA3, 0x6E, 0xD0, 0x2E, 0x90, 0x98,
+    0x86, 0x93, 0xB0, 0x00, 0xF7, 0x29, 0xF4, 0x01, 0x0A, 0x00, 0x2D, 0x41, 0x17, 0xA0, 0x75, 0x4C,
+    0xA3, 0xA4, 0x15, 0x69, 0x4E, 0xB1, 0x00, 0x21, 0x84, 0x3C, 0xE4, 0x97, 0x71, 0x76, 0x09, 0x67,
+    0x41, 0x8C, 0xBF, 0x04, 0x7D, 0x2F, 0xA3, 0xCD, 0xAF, 0x1B, 0x58, 0x48, 0x66, 0x7E, 0xF8, 0xFE,
+    0xC3, 0x79, 0x1C, 0x8B, 0xEA, 0xC6, 0xA3, 0x8D, 0x77, 0xE7, 0x72, 0x29, 0xE3, 0x56, 0x51, 0x31,
+    0xAB, 0xF3, 0x39, 0x7B, 0x54, 0xEC, 0x40, 0x59, 0xE7, 0xA7, 0x80, 0xE5, 0xB2, 0xCE, 0x4B, 0x51,
+    0x15, 0x36, 0x46, 0xDF, 0xA5, 0x89, 0xFF, 0xD3, 0xD8, 0x4A, 0x69, 0x82, 0xCE, 0xE2, 0x08, 0x9A,
+    0xF4, 0x9C, 0x94, 0x19, 0xC4, 0xA1, 0x93, 0x7A, 0x50, 0x4E, 0xD4, 0xFA, 0x64, 0xD2, 0x9A, 0x4C,
+    0xBA, 0x50, 0x21, 0xAB, 0xEB, 0x1C, 0x36, 0x78, 0xCB, 0xF9, 0x28, 0x7D, 0xA6, 0xEC, 0x2F, 0xD2,
+    0x0E, 0x7B, 0xF2, 0x24, 0xED, 0x31, 0x31, 0xF2, 0xFE, 0xF8, 0x83, 0x07, 0xA2, 0xED, 0xC6, 0x43,
+    0x3B, 0xF3, 0x5C, 0xD1, 0xF1, 0xE2, 0x1E, 0xFA, 0xA2, 0x2B, 0x42, 0x8F, 0xDF, 0x03, 0x68, 0x4D,
+    0x26, 0xDD, 0xC9, 0x44, 0x11, 0x0E, 0xEF, 0x81, 0x95, 0x32, 0x42, 0x1E, 0x02, 0x9E, 0x47, 0xF6,
+    0x5C, 0x71, 0x08, 0x2C, 0xB6, 0xD5, 0xA1, 0xF3, 0x91, 0x42, 0x57, 0x87, 0x24, 0x25, 0x2B, 0x63,
+    0xB9, 0x44, 0x26, 0xAE, 0x97, 0xA9, 0x44, 0x75, 0xA1, 0xEA, 0x72, 0xD5, 0x45, 0xAB, 0x4B, 0x57,
+    0x17, 0xB0, 0x2E, 0x63, 0x5D, 0xCC, 0xBA, 0xA4, 0xF0, 0x06, 0x4C, 0x85, 0x75, 0x3E, 0x15, 0x33,
+    0x79, 0xEF, 0xAB, 0xA9, 0xC8, 0x1E, 0x1F, 0x4D, 0xA5, 0xF6, 0x21, 0x9B, 0x0A, 0x1E, 0x90, 0xB7,
+    0xB7, 0x6A, 0xF3, 0x6E, 0x6D, 0x5E, 0x69, 0x20, 0x40, 0x7C, 0x52, 0x42, 0x1B, 0x95, 0x40, 0xB4,
+    0x13, 0x3D, 0x78, 0x5C, 0x4D, 0x55, 0xE1, 0x7E, 0x90, 0x4E, 0xB5, 0x61, 0xEB, 0x78, 0xA6, 0x90,
+    0x15, 0xF0, 0x62, 0x9F, 0x07, 0xD0, 0xC6, 0xF8, 0xD1, 0x44, 0x47, 0x02, 0xF0, 0x7E, 0xA3, 0xFC,
+    0x5B, 0x2A, 0x70, 0x64, 0x9B, 0x89, 0x16, 0x8B, 0x9B, 0x2E, 0xEC, 0x5C, 0x81, 0x72, 0xBD, 0x83,
+    0x80, 0x7B, 0x08, 0x19, 0x22, 0x68, 0x84, 0x30, 0x85, 0xC0, 0x74, 0xE7, 0x8A, 0x65, 0xD4, 0xD5,
+    0xC1, 0x0B, 0xE4, 0x83, 0xC7, 0x5D, 0xEE, 0xC4, 0x36, 0xAE, 0x74, 0xF0, 0xA4, 0x18, 0xB9, 0x51,
+    0x6B, 0x37, 0x95, 0xCB, 0x95, 0x13, 0x1F, 0xD8, 0x62, 0x1B, 0xCC, 0x7A, 0x86, 0x80, 0x1C, 0x21,
+    0x3D, 0x04, 0xB5, 0x10, 0xB6, 0x89, 0xC0, 0x2B, 0x08, 0x75, 0x27, 0xBA, 0x4B, 0xC1, 0x52, 0xE0,
+    0x64, 0xC0, 0x7E, 0x05, 0xDE, 0x15, 0x58, 0xF3, 0x00, 0x37, 0xEB, 0xA2, 0x55, 0xF0, 0xB6, 0x5B,
+    0xCA, 0x91, 0x5E, 0x1C, 0xD2, 0x66, 0x31, 0x13, 0x76, 0x0A, 0x07, 0xF0, 0xF2, 0x55, 0x13, 0xD6,
+    0x5C, 0xE1, 0x28, 0x2B, 0xB3, 0x72, 0x47, 0x31, 0xE1, 0xF1, 0x35, 0x78, 0x19, 0x19, 0xD1, 0xC9,
+    0x57, 0x21, 0x88, 0x19, 0x1E, 0x2D, 0x40, 0x41, 0x99, 0x58, 0x82, 0x7B, 0xC4, 0xDC, 0xC2, 0x98,
+    0xDC, 0x03, 0x07, 0x5D, 0xC3, 0x27, 0xC5, 0x00, 0xCA, 0x8A, 0xA3, 0xA5, 0xD0, 0x23, 0x42, 0x88,
+    0x84, 0x27, 0x42, 0x08, 0x38, 0x8D, 0x34, 0x5F, 0xB0, 0x3E, 0x57, 0x16, 0xE1, 0xF4, 0xC8, 0x57,
+    0xB0, 0x12, 0x2D, 0x13, 0x86, 0x0F, 0xEA, 0x58, 0x5E, 0xC2, 0x9F, 0xA8, 0x44, 0xEE, 0xC3, 0x1A,
+    0xED, 0xC5, 0xC1, 0xA0, 0x1C, 0x39, 0xAA, 0x70, 0xD4, 0xD1, 0xA4, 0xA1, 0x6F, 0xF4, 0xA8, 0xA5,
+    0x3D, 0x9B, 0x5A, 0x8B, 0x9A, 0x6C, 0x59, 0xB2, 0x69, 0x5A, 0x29, 0xF7, 0x1D, 0xBB, 0x3F, 0x66,
+    0x6A, 0xCC, 0x46, 0x88, 0x3F, 0x71, 0x53, 0x9D, 0x42, 0xF8, 0x71, 0x01, 0xC7, 0x78, 0x9E, 0x21,
+    0x78, 0xA2, 0x17, 0x7A, 0x02, 0x42, 0x57, 0x42, 0x07, 0xBF, 0xA6, 0x07, 0x1C, 0xB6, 0x8E, 0x00,
+    0x02, 0xA4, 0xC0, 0x29, 0x6C, 0x22, 0x51, 0xC3, 0x88, 0x3D, 0x2B, 0xAF, 0x50, 0xA2, 0xAA, 0x7A,
+    0x58, 0x2E, 0x61, 0xEA, 0x18, 0x85, 0xD3, 0xD4, 0x74, 0x60, 0xB4, 0x4E, 0xA4, 0x2C, 0x46, 0xDE,
+    0xB0, 0x07, 0x96, 0x7E, 0x46, 0xC0, 0x25, 0xFD, 0x0C, 0xCE, 0x96, 0x97, 0xF4, 0x98, 0x23, 0xF4,
+    0x93, 0x64, 0x04, 0x25, 0x66, 0xC3, 0x50, 0x95, 0x1C, 0x26, 0x48, 0x64, 0x49, 0x52, 0x2B, 0x71,
+    0x24, 0xC5, 0x3E, 0x06, 0x73, 0xD9, 0x28, 0xF3, 0xD0, 0xE5, 0x72, 0x79, 0x09, 0x0E, 0xE8, 0x20,
+    0x38, 0xFF, 0x2B, 0xAE, 0xFD, 0x57, 0x22, 0x18, 0xAD, 0x2E, 0x1E, 0x23, 0xB8, 0x85, 0xE0, 0x4D,
+    0xAC, 0x68, 0x79, 0xFC, 0xF5, 0x18, 0xA6, 0x37, 0x12, 0xAA, 0x38, 0x6F, 0x82, 0x3E, 0x31, 0xDD,
+    0x36, 0x79, 0x69, 0xFC, 0xDD, 0x82, 0x3E, 0x81, 0x7E, 0x4A, 0x1F, 0x6B, 0x6C, 0x60, 0x6F, 0xFE,
+    0xCD, 0x48, 0x57, 0x6C, 0x1B, 0xD8, 0xFE, 0xEE, 0x6A, 0x8D, 0xAE, 0xE4, 0x82, 0xFB, 0xA3, 0x07,
+    0x61, 0x7A, 0xC4, 0x0B, 0x04, 0x8D, 0x65, 0xD7, 0xB9, 0x2F, 0x0F, 0xC2, 0xDF, 0x45, 0xB7, 0x46,
+    0x7F, 0x1F, 0xB9, 0xFA, 0xD4, 0x4A, 0x74, 0x1F, 0xA2, 0x18, 0x58, 0x06, 0x2F, 0x8D, 0x0B, 0xEB,
+    0xF8, 0xB3, 0x7E, 0xF8, 0xE3, 0x90, 0x60, 0x37, 0x96, 0x99, 0x7D, 0x5F, 0xEE, 0x54, 0x74, 0x86,
+    0x8B, 0x9A, 0x25, 0x9C, 0xB2, 0xA1, 0xA0, 0xF1, 0x4C, 0xD0, 0x17, 0xE8, 0x61, 0x4E, 0x30, 0x2A,
+    0xAB, 0xA0, 0x2C, 0x74, 0x4E, 0xCD, 0xC3, 0x9F, 0x9D, 0xBB, 0xFE, 0x74, 0xE3, 0x11, 0xE6, 0xBC,
+    0xCC, 0xC9, 0xAC, 0x73, 0x6A, 0x92, 0x7D, 0xFB, 0xDC, 0xF5, 0xD7, 0xB3, 0xC1, 0x3B, 0x95, 0xB2,
+    0x17, 0xD1, 0xFD, 0x82, 0x31, 0xF8, 0x1F, 0x0F, 0xAD, 0xE2, 0x75, 0x89, 0x97, 0xC2, 0x51, 0xB6,
+    0xEA, 0x80, 0x7F, 0x2B, 0x85, 0xD1, 0x1A, 0x78, 0xF7, 0x25, 0x05, 0x2B, 0x0F, 0x25, 0xC5, 0x8F,
+    0x1F, 0x83, 0x95, 0x19, 0x83, 0xDA, 0x23, 0x72, 0x0C, 0x60, 0x78, 0x8F, 0x31, 0x4E, 0xF9, 0x02,
+    0xFC, 0xD4, 0x18, 0x65, 0xAB, 0xD4, 0x37, 0x9A, 0x8C, 0x22, 0xC4, 0xD9, 0xCF, 0xD9, 0x82, 0x1E,
+    0x6B, 0x63, 0xC2, 0x4E, 0x50, 0x09, 0x6A, 0xFA, 0x29, 0x59, 0xD6, 0x0B, 0x1D, 0x2F, 0xC7, 0xC3,
+    0x41, 0x8E, 0x47, 0x83, 0x1C, 0x0F, 0xC6, 0x73, 0x3C, 0x56, 0x9C, 0x43, 0x39, 0xF8, 0x98, 0x17,
+    0xF0, 0x40, 0x43, 0xA2, 0x3D, 0xA4, 0xC3, 0x1C, 0xD2, 0x51, 0x0E, 0xE9, 0x20, 0x5D, 0xDA, 0xD8,
+    0x0C, 0xBB, 0xE5, 0x70, 0x66, 0xF3, 0x3B, 0xB4, 0x67, 0x81, 0x83, 0x55, 0xD0, 0xB6, 0xF9, 0x0C,
+    0x78, 0x04, 0x49, 0x06, 0x85, 0x73, 0xFA, 0x26, 0x3F, 0x72, 0xF1, 0x69, 0x7A, 0x44, 0x61, 0xE7,
+    0xC8, 0x89, 0xF1, 0x82, 0xA3, 0xD1, 0x54, 0xAF, 0x1A, 0x58, 0x8A, 0x83, 0x47, 0x01, 0x23, 0x42,
+    0xD3, 0xD9, 0x39, 0x0E, 0x4C, 0xD2, 0xC0, 0x31, 0xCC, 0x3A, 0xD5, 0x30, 0x2B, 0x77, 0x60, 0x31,
+    0x86, 0x31, 0x78, 0x12, 0x07, 0x5F, 0xE2, 0x1E, 0x5E, 0x4D, 0x23, 0xC9, 0x20, 0x11, 0x11, 0xBE,
+    0xF4, 0x7C, 0xFD, 0x85, 0xA0, 0xAB, 0x36, 0x73, 0x8C, 0x49, 0x5F, 0xAF, 0x39, 0x49, 0xAB, 0xF2,
+    0xF1, 0xEE, 0xCC, 0x9F, 0xA8, 0x93, 0xA3, 0x92, 0xEE, 0x9D, 0xCA, 0xB7, 0xAA, 0x42, 0x2F, 0x56,
+    0xF7, 0x9F, 0x3A, 0x77, 0x4E, 0x74, 0x81, 0x7D, 0x8C, 0x5D, 0x57, 0x7D, 0x5C, 0x75, 0x82, 0x8D,
+    0x9C, 0x93, 0x67, 0x7D, 0xE7, 0x44, 0xC2, 0x45, 0xBA, 0x7B, 0xA2, 0x40, 0x9F, 0xE8, 0x2A, 0x8C,
+    0xE9, 0x3C, 0xD0, 0xEF, 0x3D, 0x8D, 0x34, 0x8B, 0x13, 0xCD, 0xB8, 0xAE, 0x75, 0xFA, 0x1D, 0x6A,
+    0x86, 0xF2, 0xE9, 0xCC, 0x1A, 0x0C, 0x1E, 0x26, 0xF8, 0x3A, 0xFB, 0xE5, 0xA7, 0x5A, 0x55, 0x7B,
+    0x3F, 0xD7, 0xD9, 0x89, 0xCE, 0x10, 0x47, 0xDD, 0x1D, 0x3C, 0x2A, 0x75, 0xD8, 0x2E, 0xC5, 0x6E,
+    0x36, 0xD6, 0x21, 0xF9, 0x45, 0x82, 0x11, 0x0A, 0xDD, 0x2F, 0xE1, 0x10, 0x7C, 0x76, 0x0A, 0xC7,
+    0xAB, 0x11, 0x6C, 0x37, 0x2E, 0x97, 0x6A, 0x69, 0x93, 0x69, 0x13, 0xAC, 0x7B, 0xF0, 0xBC, 0xBF,
+    0x25, 0x5C, 0xA3, 0xC1, 0x1F, 0xE3, 0x1B, 0x75, 0x8D, 0x62, 0x3B, 0x9F, 0x44, 0x3B, 0x89, 0x9E,
+    0xFB, 0xF3, 0x82, 0xAC, 0x87, 0x99, 0x92, 0x74, 0x68, 0x2E, 0x2A, 0xBE, 0x93, 0x31, 0x1B, 0x5D,
+    0xA4, 0x10, 0x05, 0x9A, 0x1D, 0x3D, 0x6D, 0x8B, 0x12, 0x8D, 0x2B, 0x30, 0x61, 0xD9, 0xA7, 0xB7,
+    0x8F, 0x29, 0x6A, 0xA5, 0x35, 0x6E, 0x17, 0x10, 0xE6, 0xA2, 0xF8, 0xDE, 0x4D, 0x11, 0xBC, 0x2D,
+    0xFC, 0xB7, 0xF9, 0xA2, 0x6B, 0xFC, 0x66, 0xCD, 0x5C, 0xBE, 0xA6, 0x71, 0xFE, 0x03, 0x93, 0x75,
+    0x25, 0x5D, 0x45, 0x0C, 0x5C, 0xE8, 0xA6, 0x9E, 0xC9, 0x9E, 0xAB, 0x0B, 0xD0, 0x0A, 0xA1, 0x19,
+    0xC2, 0x81, 0xC9, 0x1B, 0x6E, 0x0A, 0xA9, 0x5F, 0x58, 0xB2, 0xE5, 0x7F, 0x5F, 0x34, 0xF1, 0x31,
+    0xB3, 0x4B, 0xD7, 0xE4, 0x4B, 0xB9, 0xC1, 0xD6, 0x83, 0xF7, 0x32, 0x13, 0x13, 0x02, 0x23, 0xAF,
+    0x2D, 0xF6, 0x4D, 0xFC, 0xAD, 0x70, 0x90, 0xAF, 0xE5, 0x2D, 0x60, 0x5E, 0xF7, 0xC1, 0xFD, 0xB0,
+    0x03, 0xD6, 0x7F, 0x46, 0xF0, 0x5A, 0x74, 0x82, 0x4E, 0xA0, 0xE5, 0x1B, 0xD1, 0xEF, 0xFB, 0x30,
+    0x4E, 0x81, 0x7D, 0xD8, 0x03, 0xEF, 0x27, 0x01, 0x2C, 0x7A, 0xDF, 0x28, 0xFD, 0xBB, 0xBC, 0xEB,
+    0xC8, 0x11, 0x2F, 0x08, 0x78, 0xA8, 0x2D, 0x57, 0xD4, 0x53, 0x5B, 0x52, 0xF5, 0xB3, 0x66, 0x7D,
+    0x1E, 0xDF, 0x7B, 0xF0, 0xAF, 0xD1, 0x3D, 0xFF, 0x47, 0x1F, 0xA8, 0x61, 0xE0, 0x3E, 0x49, 0xB3,
+    0xB6, 0x77, 0x4B, 0xAA, 0x96, 0xE7, 0x9C, 0xA4, 0xCD, 0x65, 0x76, 0x53, 0xEE, 0xAC, 0xBA, 0x93,
+    0x38, 0x44, 0x01, 0x18, 0x98, 0x9A, 0x0C, 0xD3, 0x64, 0x3C, 0xD9, 0xF1, 0x3B, 0xB4, 0x5D, 0xC8,
+    0x71, 0x88, 0xF8, 0xDE, 0x34, 0xA5, 0x56, 0xB4, 0xFD, 0xF3, 0x69, 0x5F, 0xA1, 0xF0, 0x77, 0x71,
+    0xB2, 0x09, 0xED, 0xF5, 0xAF, 0xA0, 0xDD, 0x33, 0x0E, 0xBD, 0xF9, 0x35, 0x8E, 0x77, 0xA3, 0x72,
+    0xF9, 0xC9, 0xF3, 0xD7, 0x51, 0x67, 0x76, 0xB2, 0xE5, 0xF9, 0x64, 0x2B, 0xF4, 0x3E, 0x8C, 0x68,
+    0x27, 0xB3, 0xA7, 0x99, 0x5D, 0x23, 0xD1, 0xCF, 0x2D, 0x5F, 0x75, 0xFC, 0x1B, 0x56, 0x7C, 0xED,
+    0xD8, 0x16, 0x21, 0xF6, 0xA8, 0x65, 0x8B, 0x4D, 0x13, 0xEA, 0xAB, 0x7E, 0xF7, 0xCF, 0x9F, 0x0C,
+    0xD0, 0xEC, 0xBA, 0xBE, 0xB6, 0x62, 0x8B, 0x29, 0x7E, 0xDB, 0x16, 0x9D, 0xE7, 0x05, 0x5C, 0xC1,
+    0x43, 0x25, 0xD8, 0xAF, 0x9D, 0x2B, 0xE0, 0x0C, 0x7B, 0xC1, 0xE0, 0x25, 0x08, 0x9D, 0xD1, 0xAC,
+    0x7C, 0x09, 0x7B, 0xF6, 0x47, 0xD0, 0x05, 0xFE, 0xE4, 0x5A, 0x2E, 0xEB, 0xBC, 0x14, 0x61, 0x1E,
+    0x64, 0x9E, 0x62, 0xD2, 0x11, 0xF3, 0xE0, 0x9B, 0xFF, 0x61, 0x70, 0x47, 0x30, 0xE9, 0xA9, 0x20,
+    0x0B, 0xF3, 0xF9, 0x28, 0xEC, 0xD8, 0x4D, 0x9B, 0x8D, 0x66, 0xC3, 0x4D, 0xE7, 0xDB, 0x05, 0xE5,
+    0x88, 0x2F, 0x26, 0xF9, 0xFF, 0x00, 0xED, 0x94, 0xBF, 0x4F, 0x14, 0x41, 0x14, 0xC7, 0xBF, 0xBB,
+    0x13, 0x6E, 0x12, 0x56, 0x79, 0xB1, 0xD0, 0x98, 0x08, 0x37, 0x16, 0x34, 0x12, 0x60, 0x29, 0x28,
+    0xC0, 0xDC, 0x8F, 0x89, 0x96, 0x16, 0x52, 0x68, 0x65, 0x01, 0xED, 0x11, 0x93, 0xB3, 0xA0, 0xC0,
+    0x84, 0xE3, 0x26, 0x31, 0xB1, 0x95, 0xD8, 0x58, 0x7A, 0xC5, 0xC5, 0x18, 0x2C, 0xBC, 0xE2, 0x0A,
+    0x8A, 0xE3, 0x6E, 0xFE, 0x84, 0xB1, 0x32, 0x56, 0x6E, 0x0C, 0xB1, 0x23, 0xD9, 0xE2, 0x8A, 0x3B,
+    0x3D, 0x58, 0xDF, 0xDE, 0x29, 0x82, 0x12, 0x63, 0x65, 0xE5, 0xBE, 0x4F, 0x66, 0x77, 0x66, 0xDE,
+    0xFC, 0xFA, 0xBE, 0x37, 0x0B, 0x40, 0x0E, 0x10, 0xAE, 0xEA, 0x5C, 0x60, 0x5B, 0xD2, 0x0E, 0x84,
+    0xEB, 0x89, 0x68, 0x04, 0x7F, 0x73, 0x4B, 0x3E, 0xB0, 0x6A, 0x15, 0x99, 0x1E, 0x32, 0x20, 0x8C,
+    0x01, 0xA8, 0xF2, 0xFB, 0x8C, 0xE9, 0xF5, 0x1A, 0x14, 0x50, 0xD4, 0xE8, 0x68, 0xEF, 0xA3, 0x16,
+    0xAB, 0x7A, 0x5C, 0xE9, 0x49, 0xA5, 0x97, 0xCB, 0xF7, 0x3A, 0xC9, 0x00, 0x4A, 0xA7, 0x94, 0x77,
+    0xBC, 0xDD, 0x5A, 0x98, 0xE8, 0x62, 0x62, 0x16, 0x7D, 0xB3, 0x08, 0x2C, 0x00, 0x37, 0xFB, 0x58,
+    0x2E, 0x1B, 0x04, 0x16, 0xD2, 0x5D, 0x97, 0xAE, 0x19, 0xD8, 0x76, 0x59, 0xAB, 0x1E, 0xAF, 0x01,
+    0x3F, 0xD1, 0x74, 0xC7, 0xCE, 0x0B, 0x9B, 0xF7, 0xB0, 0x05, 0xB4, 0x8F, 0xB1, 0x4F, 0xB6, 0x25,
+    0xDC, 0x96, 0x70, 0x39, 0xE1, 0x0A, 0xD2, 0xD2, 0x4B, 0xE3, 0xF7, 0x51, 0x4D, 0x2C, 0xD3, 0xF0,
+    0xED, 0x9A, 0xD0, 0x08, 0x80, 0x09, 0x60, 0x12, 0xC8, 0x01, 0x1B, 0x40, 0x0C, 0x44, 0xF0, 0x2D,
+    0x7C, 0x93, 0x4E, 0x18, 0x1C, 0xA3, 0x40, 0x66, 0x4B, 0x5A, 0xA6, 0x48, 0x5A, 0x1D, 0x41, 0x1E,
+    0x63, 0x3E, 0xE4, 0x33, 0xA7, 0x07, 0xE6, 0x99, 0x0B, 0x0F, 0x4C, 0x70, 0x34, 0xF4, 0xEC, 0xA1,
+    0x10, 0xA2, 0x45, 0xA6, 0x17, 0xD8, 0x9E, 0x4C, 0x45, 0x29, 0x28, 0x17, 0x7C, 0xE5, 0x4D, 0x5A,
+    0x04, 0xE6, 0x11, 0xE1, 0x71, 0x05, 0x2A, 0x02, 0xA6, 0x81, 0xC5, 0xEF, 0xCC, 0xB4, 0xEB, 0xCC,
+    0x49, 0x35, 0x6D, 0xD9, 0xAD, 0x33, 0xC5, 0xA4, 0xCB, 0x25, 0x86, 0xCF, 0xE5, 0xFB, 0x2B, 0x5C,
+    0xC5, 0x55, 0xAF, 0x2B, 0x1D, 0x19, 0x85, 0x22, 0x0A, 0xA7, 0x2C, 0x64, 0x8D, 0xC8, 0x8A, 0x18,
+    0x9B, 0xC0, 0x1A, 0x2A, 0x20, 0x23, 0x9D, 0x88, 0xFC, 0xD8, 0x3B, 0x31, 0x3F, 0x16, 0x91, 0x70,
+    0x81, 0x0D, 0xD1, 0xE4, 0xD9, 0xB6, 0x43, 0x43, 0xCF, 0x63, 0xD2, 0x31, 0xA1, 0x71, 0x1A, 0xA5,
+    0xF7, 0xD6, 0x77, 0x4A, 0xF8, 0xEB, 0xA0, 0xA2, 0x01, 0x19, 0xA3, 0x1D, 0xE3, 0x52, 0x0C, 0xEF,
+    0x3C, 0xAE, 0xF4, 0xF9, 0x2C, 0xA9, 0x82, 0xAC, 0x58, 0x85, 0x67, 0x27, 0x3B, 0x4D, 0x96, 0xB7,
+    0xC7, 0x81, 0xC7, 0x5C, 0xAA, 0xB3, 0xEF, 0x58, 0x78, 0x3B, 0xE7, 0xD9, 0x4E, 0x62, 0x77, 0x47,
+    0x9E, 0x7D, 0x54, 0x42, 0xF6, 0x34, 0xD3, 0xEC, 0xA6, 0xE0, 0xED, 0x41, 0xF6, 0x91, 0x0E, 0x09,
+    0xEC, 0x9A, 0xB4, 0x31, 0xD9, 0xFD, 0xEA, 0x30, 0xCA, 0xFF, 0x73, 0xE6, 0xDF, 0xE6, 0x8C, 0xFF,
+    0x1A, 0x14, 0xE0, 0xA2, 0x30, 0x10, 0xC6, 0x7B, 0x63, 0xB2, 0xC2, 0xE4, 0x18, 0x69, 0xF2, 0xD7,
+    0x6C, 0xF0, 0x29, 0xCA, 0x44, 0xC8, 0xCF, 0x61, 0x83, 0xC0, 0x29, 0xF5, 0xE5, 0x6D, 0xAA, 0x04,
+    0xC3, 0xC3, 0xF2, 0xE3, 0xE9, 0xE9, 0x32, 0x07, 0xC8, 0x67, 0xB1, 0x21, 0x75, 0x2C, 0x4C, 0x2C,
+    0xEC, 0x88, 0x86, 0x34, 0x39, 0x4A, 0x7B, 0xD7, 0x9F, 0xD6, 0xD4, 0x6D, 0x27, 0x9F, 0xC0, 0xFF,
+    0x00, 0xEC, 0x01, 0x2D, 0x78, 0xCF, 0x20, 0xA5, 0x99, 0x12, 0xAE, 0x73, 0xB7, 0xC7, 0x63, 0xA7,
+    0xCA, 0x9C, 0x91, 0xBC, 0xAE, 0x65, 0x8A, 0x89, 0xCD, 0x09, 0xC6, 0x64, 0x03, 0xC8, 0x1E, 0x4A,
+    0xC3, 0x44, 0xA0, 0x11, 0xF3, 0x9A, 0xDE, 0xBB, 0xE1, 0x16, 0x7E, 0xA5, 0xEA, 0xF6, 0xCF, 0x78,
+    0x66, 0xEA, 0x24, 0x1C, 0x49, 0xD0, 0x24, 0x68, 0x13, 0x74, 0x08, 0xE2, 0x3F, 0x11, 0x87, 0xD8,
+    0x8F, 0xAA, 0xEE, 0x61, 0x89, 0x1D, 0xE9, 0x5C, 0xEB, 0xB8, 0x1B, 0x33, 0xB7, 0x0E, 0xA0, 0x5E,
+    0x1C, 0xB2, 0x5E, 0xBA, 0x9B, 0x36, 0xC5, 0x7F, 0x28, 0x78, 0xD5, 0x80, 0x47, 0x68, 0xF5, 0x2A,
+    0xFA, 0xFD, 0xAE, 0x11, 0x9A, 0x55, 0xB7, 0x5D, 0x9A, 0xD7, 0xD9, 0xCF, 0xDC, 0xCB, 0x55, 0x16,
+    0x6F, 0x73, 0x08, 0x7F, 0x34, 0xE9, 0x5D, 0x4C, 0x45, 0x43, 0x3F, 0x36, 0x5C, 0x75, 0xC8, 0xD4,
+    0x67, 0x67, 0x97, 0x2E, 0xE4, 0xA1, 0x9C, 0x37, 0x40, 0x76, 0x61, 0x62, 0x69, 0x4A, 0x75, 0xC7,
+    0x30, 0x8E, 0xB0, 0x56, 0x5E, 0x99, 0xC0, 0x4F, 0x23, 0xBE, 0x92, 0xDF, 0x00, 0x8D, 0x57, 0x4F,
+    0x6C, 0xDD, 0x48, 0x19, 0xFF, 0xEC, 0x69, 0x63, 0xA8, 0x95, 0x4C, 0x0E, 0x29, 0x0B, 0xCA, 0x4B,
+    0xCD, 0x61, 0x0F, 0xA8, 0xB4, 0x78, 0x25, 0x1E, 0x52, 0x60, 0x93, 0x67, 0xB3, 0x2B, 0x81, 0x10,
+    0xCA, 0x2A, 0x48, 0xFB, 0xE8, 0xA1, 0x87, 0xEC, 0x79, 0xF7, 0x90, 0x27, 0xD1, 0xC3, 0x1E, 0xFA,
+    0x62, 0x97, 0xCB, 0x5E, 0x50, 0x95, 0x0B, 0x7B, 0x43, 0xE4, 0xC0, 0x21, 0xA4, 0x40, 0x0A, 0xAA,
+    0x60, 0x81, 0xA4, 0x1E, 0xE8, 0x91, 0x43, 0x0D, 0x55, 0xC5, 0x11, 0x2F, 0x4A, 0x01, 0x95, 0x95,
+    0xE2, 0xDD, 0x75, 0x77, 0x9D, 0x57, 0xDB, 0xC3, 0xEF, 0x1B, 0xBF, 0xA4, 0xE9, 0x12, 0x55, 0xEB,
+    0xE4, 0xFB, 0xCD, 0xF3, 0x78, 0xFC, 0xCD, 0xCC, 0xF7, 0xE7, 0x37, 0x9F, 0x89, 0xF8, 0x4A, 0x0A,
+    0x22, 0x27, 0xDD, 0x25, 0xF2, 0x68, 0x91, 0xA8, 0x47, 0xCF, 0x13, 0x0D, 0xB9, 0x7F, 0xC7, 0xC0,
+    0xE9, 0x7E, 0x9F, 0x76, 0xA4, 0xD6, 0xE1, 0x8E, 0x95, 0x3B, 0xF1, 0xD0, 0xCA, 0x45, 0xDC, 0xB3,
+    0x72, 0x8B, 0x7C, 0x2B, 0x27, 0x72, 0xFF, 0x0A, 0xB0, 0xB4, 0xAE, 0x80, 0xD0, 0x42, 0xDC, 0x77,
+    0x04, 0x31, 0xC0, 0x52, 0x64, 0x3F, 0xBA, 0xA4, 0xC8, 0xD3, 0x5A, 0x99, 0xC9, 0x68, 0x90, 0x12,
+    0xFD, 0x5A, 0x91, 0xF5, 0x58, 0x51, 0xA4, 0x4B, 0xBB, 0xBE, 0xD7, 0x38, 0xEF, 0xDE, 0x49, 0xE4,
+    0x9F, 0xEF, 0xF4, 0xFC, 0x97, 0xDE, 0x9A, 0x09, 0xC4, 0x77, 0x29, 0x10, 0xAF, 0x50, 0xE4, 0x4C,
+    0xB6, 0x72, 0xA6, 0x43, 0xC1, 0xD4, 0x05, 0x0A, 0x96, 0xBE, 0x44, 0xFE, 0x8F, 0xE6, 0xC9, 0x7B,
+    0xAF, 0x6B, 0xB9, 0xD5, 0xC0, 0x15, 0xCD, 0xCD, 0xDB, 0x94, 0xE8, 0x92, 0xBE, 0xD1, 0x84, 0x46,
+    0xE5, 0x4D, 0xA8, 0xFF, 0x5E, 0xDC, 0x4E, 0xE1, 0xEA, 0x8C, 0xA2, 0xB7, 0x6B, 0xBB, 0xA0, 0xC4,
+    0xC9, 0x28, 0x90, 0x8A, 0x2E, 0x7A, 0x78, 0x14, 0x84, 0x10, 0x3C, 0x0E, 0xE4, 0x07, 0x75, 0x34,
+    0xF1, 0x71, 0x12, 0x51, 0xB5, 0x18, 0x51, 0x89, 0x3E, 0x96, 0x02, 0xCF, 0x0B, 0xF2, 0xE3, 0x82,
+    0xA4, 0x2A, 0xC8, 0xCD, 0x8B, 0x09, 0x51, 0x17, 0xE7, 0x88, 0xF7, 0xE6, 0x41, 0x1F, 0xCD, 0x60,
+    0x3A, 0x9D, 0xAF, 0x8C, 0x6E, 0xE4, 0x22, 0x23, 0x96, 0x9B, 0x90, 0x01, 0x64, 0x1A, 0x42, 0x4F,
+    0x09, 0x8C, 0x25, 0x1E, 0xF5, 0x8F, 0xEE, 0xDF, 0x18, 0x6D, 0x18, 0x39, 0x7A, 0x0E, 0xFB, 0xCC,
+    0x1E, 0xC0, 0xEE, 0x87, 0x26, 0x89, 0x6A, 0xB2, 0x0F, 0xA2, 0xD8, 0x49, 0xA5, 0x92, 0xCA, 0x51,
+    0x32, 0x16, 0xA1, 0xC4, 0x7A, 0x59, 0x5C, 0x0C, 0x11, 0x29, 0xEB, 0xF8, 0x19, 0x9B, 0x8B, 0x88,
+    0xAD, 0x5C, 0x92, 0xD9, 0x3A, 0xBD, 0x83, 0xDF, 0xB7, 0x20, 0xD0, 0x67, 0x2B, 0xDE, 0xF6, 0xFA,
+    0x95, 0x00, 0x6B, 0xEC, 0xDA, 0xAC, 0xF8, 0x94, 0x51, 0x3D, 0xD3, 0xCE, 0xD0, 0x6D, 0x9B, 0x9B,
+    0x6D, 0x83, 0x35, 0x9C, 0x5F, 0x4F, 0xAE, 0xED, 0x67, 0xE4, 0x7F, 0xA8, 0x3F, 0xC4, 0x06, 0xC5,
+    0xC8, 0xD6, 0x71, 0x42, 0x76, 0x45, 0x1A, 0x96, 0x80, 0xDD, 0x6E, 0x93, 0x17, 0xA2, 0x19, 0x72,
+    0x93, 0x7F, 0xA2, 0xA9, 0x8F, 0x37, 0x76, 0xDB, 0x88, 0xB6, 0x71, 0x76, 0xCD, 0x7B, 0x53, 0x18,
+    0x19, 0x3B, 0xF5, 0x5C, 0x14, 0x7A, 0x69, 0xA0, 0x7F, 0x11, 0x65, 0x5E, 0x75, 0xC2, 0x12, 0x8E,
+    0x2E, 0x3F, 0xB7, 0x74, 0x3E, 0x5B, 0x52, 0x94, 0x62, 0x01, 0x92, 0xAC, 0x86, 0x41, 0x33, 0xEC,
+    0xC7, 0x80, 0xBB, 0x0A, 0xF0, 0xF7, 0x4C, 0xB2, 0xFD, 0x75, 0xF5, 0xB9, 0xFB, 0xF5, 0xCA, 0xAB,
+    0x96, 0xAA, 0x25, 0x4C, 0xA2, 0xB7, 0x37, 0xDF, 0x18, 0x25, 0xFB, 0x9B, 0x96, 0xF2, 0xEE, 0x92,
+    0xA5, 0xE4, 0x3F, 0x00, 0x8E, 0x06, 0x08, 0x06, 0xA8, 0xB0, 0x53, 0x4A, 0xC8, 0x81, 0x67, 0x29,
+    0x68, 0xC8, 0xA7, 0x40, 0xC3, 0xEA, 0x34, 0xDB, 0x24, 0x30, 0x8F, 0x5D, 0x3A, 0x1C, 0xBA, 0xA5,
+    0x55, 0x32, 0x52, 0x75, 0x0C, 0xEB, 0x53, 0xE6, 0xF7, 0xA4, 0xC1, 0x39, 0x33, 0x66, 0x11, 0xE8,
+    0xBC, 0xAF, 0x0B, 0xEB, 0x20, 0x79, 0x0B, 0xA8, 0xFF, 0x43, 0xDC, 0x43, 0xCF, 0x40, 0xDB, 0xA0,
+    0x53, 0x23, 0xDC, 0x5E, 0x0D, 0x74, 0x4E, 0xB2, 0x34, 0x7B, 0x0D, 0x13, 0xBC, 0x8B, 0x6B, 0x65,
+    0x94, 0x70, 0xB0, 0x8A, 0x9C, 0x57, 0x81, 0xC6, 0x2E, 0x4C, 0xC3, 0xEF, 0x72, 0x7C, 0x54, 0x56,
+    0xB2, 0xCE, 0x8D, 0xFB, 0xAF, 0x82, 0x3B, 0x3D, 0xDA, 0xC1, 0x90, 0xBC, 0x47, 0x6F, 0xE2, 0x85,
+    0xB4, 0x87, 0x90, 0x1B, 0xDD, 0x26, 0x3F, 0x44, 0xA4, 0xC1, 0x60, 0x05, 0x5E, 0xA8, 0xC9, 0x41,
+    0xCC, 0xE5, 0x11, 0x02, 0x23, 0x17, 0x39, 0x02, 0xDD, 0xA9, 0x44, 0xEE, 0x61, 0x9B, 0xBB, 0x22,
+    0x97, 0xE9, 0xE7, 0x69, 0x91, 0x27, 0x5A, 0xE0, 0x46, 0x60, 0x2F, 0x0B, 0x88, 0xBE, 0xC6, 0xFF,
+    0x66, 0xA9, 0x75, 0xEC, 0xFF, 0x45, 0xA7, 0xE3, 0x40, 0xF1, 0x11, 0x35, 0x1B, 0x94, 0x54, 0xB3,
+    0x0D, 0xBB, 0x77, 0xA5, 0xB0, 0x10, 0x17, 0x05, 0x39, 0x0A, 0x56, 0x11, 0x25, 0x39, 0x31, 0x3C,
+    0xEE, 0x54, 0xE4, 0x86, 0x08, 0x0E, 0x77, 0x07, 0xDE, 0x81, 0x55, 0xE1, 0xE8, 0x29, 0x6E, 0x27,
+    0x03, 0x9A, 0x83, 0x1F, 0xC3, 0x8E, 0x4F, 0x17, 0xE8, 0xEC, 0xEA, 0xFD, 0xE1, 0xEA, 0x8F, 0x87,
+    0xD8, 0xB5, 0xB9, 0xE0, 0x4D, 0xD5, 0x95, 0xEA, 0x16, 0x73, 0xCC, 0xC0, 0x55, 0x39, 0xEF, 0x2F,
+    0x17, 0xA9, 0xC9, 0x83, 0x4C, 0xBC, 0x8B, 0xD9, 0xED, 0x47, 0xCA, 0xFE, 0x00, 0x6B, 0xB5, 0x46,
+    0xCA, 0xFA, 0x98, 0x53, 0x42, 0xC7, 0xF4, 0x98, 0xAD, 0x93, 0x84, 0xA4, 0x43, 0xCE, 0x0F, 0xF3,
+    0x6F, 0x92, 0xB7, 0x47, 0xD4, 0xEF, 0x2F, 0xD3, 0x59, 0x28, 0xA6, 0x00, 0x99, 0xA9, 0x00, 0x22,
+    0x63, 0xC8, 0x01, 0x36, 0xE0, 0x34, 0x83, 0xFC, 0xE1, 0x09, 0x70, 0x8D, 0x21, 0x26, 0x03, 0x3D,
+    0x86, 0x21, 0x43, 0x55, 0xC9, 0xFB, 0x97, 0x8B, 0x0A, 0x0C, 0x37, 0x66, 0x0F, 0x98, 0x90, 0x39,
+    0xA4, 0xF5, 0x0B, 0xD1, 0x99, 0x1B, 0xA3, 0xB0, 0x05, 0x73, 0x7B, 0x16, 0x60, 0xEB, 0x7B, 0x70,
+    0xE8, 0xE8, 0x8F, 0x39, 0xC2, 0xDC, 0xCB, 0xB1, 0x2C, 0x0C, 0xEE, 0x11, 0x3C, 0xB9, 0xC6, 0x43,
+    0x86, 0x4F, 0x83, 0xE9, 0x33, 0x4F, 0xCD, 0x38, 0xF3, 0x86, 0x1C, 0x7D, 0x74, 0x00, 0x2D, 0x7F,
+    0xC3, 0xEE, 0x4E, 0x1D, 0x66, 0xC1, 0x99, 0xAD, 0xAD, 0x4D, 0xA6, 0xC9, 0xFA, 0x58, 0x66, 0x38,
+    0x58, 0x53, 0x70, 0x19, 0x71, 0x60, 0x17, 0xE0, 0x53, 0x84, 0x02, 0xAD, 0x33, 0x81, 0x38, 0x69,
+    0x4B, 0x0C, 0xAB, 0x0F, 0x37, 0x91, 0x14, 0x08, 0x01, 0xFC, 0x66, 0x41, 0xEE, 0x93, 0x9B, 0xB6,
+    0xCF, 0x0F, 0x89, 0xC6, 0x44, 0x54, 0x4D, 0x2F, 0x50, 0xF0, 0x36, 0x1E, 0x32, 0x31, 0xB0, 0xA7,
+    0xD3, 0xA0, 0xA6, 0x59, 0x1D, 0x7A, 0x25, 0xC1, 0xCB, 0xAC, 0x8A, 0x13, 0x8F, 0x71, 0xD1, 0x20,
+    0x93, 0x4A, 0x65, 0x73, 0x60, 0x54, 0x0E, 0x5B, 0xA5, 0x3A, 0x07, 0x78, 0xBD, 0x49, 0xB6, 0x62,
+    0x93, 0x84, 0x3C, 0xD5, 0x3E, 0x3F, 0xD5, 0x92, 0xAD, 0x54, 0x09, 0x9E, 0xA3, 0xB2, 0x6A, 0xF3,
+    0x6E, 0x62, 0x30, 0x30, 0x3A, 0xBD, 0x8C, 0xD1, 0x45, 0x14, 0x21, 0xA6, 0x1A, 0xE4, 0x1F, 0x78,
+    0x59, 0x71, 0x5C, 0xA8, 0xE8, 0x46, 0xB3, 0xAD, 0xAE, 0xDA, 0x85, 0x50, 0x57, 0xB0, 0x37, 0x35,
+    0x00, 0xA4, 0xD3, 0x48, 0x82, 0x10, 0xEC, 0x33, 0x8D, 0x90, 0xF8, 0x08, 0xF9, 0x60, 0xB3, 0x47,
+    0x1C, 0xD6, 0x1D, 0xE1, 0x4E, 0xFC, 0xB3, 0xB8, 0xC5, 0x7D, 0x1C, 0x30, 0x3C, 0x93, 0x5F, 0x8C,
+    0x87, 0x59, 0x2F, 0x71, 0xEE, 0x98, 0x04, 0xE2, 0xA4, 0xA3, 0xE7, 0xF8, 0x69, 0xD2, 0x86, 0xF5,
+    0xA1, 0x75, 0xC7, 0xE4, 0x63, 0x8D, 0x69, 0xE7, 0x52, 0x1B, 0xF3, 0xD1, 0x76, 0x62, 0xDA, 0xB8,
+    0x27, 0xDA, 0x8E, 0xAB, 0x4C, 0xA5, 0x66, 0xFD, 0xEF, 0x98, 0xB6, 0xA4, 0x05, 0x6A, 0xCF, 0x32,
+    0xB6, 0x4B, 0xEB, 0x48, 0x32, 0xB6, 0xF5, 0x4D, 0x9B, 0xB6, 0x2D, 0x72, 0xC4, 0xB4, 0x30, 0x24,
+    0x9F, 0x2F, 0x4C, 0xDC, 0x3D, 0x5A, 0x36, 0xED, 0xA2, 0xC4, 0x6A, 0x64, 0x48, 0x3B, 0x0B, 0x00,
+    0x0F, 0x9A, 0xAF, 0x38, 0xEA, 0xCC, 0x2A, 0x0E, 0xCB, 0x5C, 0xA8, 0xAF, 0xEF, 0x42, 0x53, 0xEE,
+    0xA8, 0xD7, 0x7A, 0x24, 0xFF, 0x54, 0xB8, 0xF1, 0xE0, 0x37, 0x7B, 0x6B, 0x76, 0xED, 0xE1, 0x0C,
+    0x5A, 0xDD, 0x13, 0xFF, 0x6D, 0xF9, 0x62, 0xBC, 0x30, 0x9E, 0x82, 0xC6, 0x53, 0xD0, 0x78, 0x8A,
+    0xB6, 0x0D, 0xDB, 0xD6, 0x3B, 0xC6, 0xA6, 0xC8, 0x7A, 0x1C, 0xDD, 0xF9, 0x45, 0xAC, 0x7B, 0x12,
+    0x29, 0x31, 0x05, 0x99, 0x83, 0x74, 0x30, 0xEB, 0x05, 0xEC, 0x69, 0x1E, 0xAB, 0x00, 0x0B, 0xEF,
+    0xC2, 0x16, 0x11, 0xB4, 0x05, 0xD0, 0xE4, 0xC7, 0xB4, 0xE1, 0x2B, 0xCA, 0x83, 0x54, 0x54, 0xBF,
+    0xCB, 0x9D, 0xDE, 0xBD, 0x7C, 0xCA, 0xBF, 0x56, 0x76, 0x24, 0x55, 0xDD, 0x09, 0x53, 0x06, 0x70,
+    0x3D, 0x00, 0x36, 0x83, 0x48, 0x96, 0xF8, 0x2A, 0x39, 0xA3, 0x82, 0xAC, 0x24, 0xF6, 0xF5, 0x88,
+    0x19, 0x75, 0x3B, 0x43, 0x20, 0xB1, 0xF5, 0x2B, 0xC4, 0x1A, 0x87, 0x48, 0xFA, 0xFD, 0xBA, 0x8F,
+    0xF4, 0xAD, 0x90, 0xB8, 0xAF, 0x37, 0x5B, 0x49, 0x6C, 0xFA, 0x70, 0x5B, 0x71, 0x60, 0xC1, 0x55,
+    0xF5, 0x36, 0x36, 0x66, 0xE8, 0xB8, 0xA2, 0x67, 0x00, 0xE2, 0x06, 0x2B, 0xD4, 0xC6, 0x2B, 0x9D,
+    0x43, 0x98, 0xE0, 0xF7, 0xA2, 0x5F, 0x25, 0xB1, 0x55, 0x76, 0x3C, 0xE5, 0x64, 0x1D, 0x17, 0xC7,
+    0x66, 0xC7, 0x89, 0xBD, 0xB8, 0xC3, 0x87, 0x3C, 0x03, 0x1D, 0x42, 0x74, 0x1C, 0xB6, 0x36, 0xD1,
+    0x97, 0x94, 0x00, 0x99, 0x62, 0x9C, 0x54, 0x7E, 0xDC, 0xE1, 0x23, 0x17, 0xE0, 0x66, 0x00, 0x1B,
+    0x5B, 0x56, 0x94, 0xFC, 0x72, 0x55, 0x21, 0x53, 0x1A, 0xCC, 0x74, 0xF1, 0x68, 0x5E, 0x13, 0x48,
+    0x26, 0x08, 0x40, 0x7F, 0x7C, 0x69, 0x83, 0xFB, 0x6C, 0x7E, 0xFB, 0xAE, 0xA1, 0xF2, 0xBB, 0xEC,
+    0x1A, 0xE7, 0xDB, 0xEC, 0x30, 0x97, 0x33, 0x8F, 0x24, 0xE8, 0xD3, 0x18, 0x03, 0x69, 0xBE, 0x60,
+    0xB6, 0x33, 0xCF, 0xD8, 0xFF, 0x7D, 0xFF, 0x76, 0xFF, 0xB0, 0x3F, 0xE3, 0x88, 0x41, 0xA6, 0xA1,
+    0x3E, 0x11, 0x8A, 0x93, 0x58, 0xC4, 0x24, 0x53, 0x72, 0x63, 0x72, 0x33, 0xF2, 0xD0, 0x5F, 0x10,
+    0x12, 0x5C, 0xEB, 0x31, 0x33, 0x95, 0x24, 0x0E, 0x56, 0x43, 0x37, 0x75, 0x52, 0x57, 0x81, 0xCB,
+    0x63, 0x9B, 0x8F, 0x7E, 0x43, 0xA9, 0xFD, 0xFE, 0xE5, 0x22, 0x61, 0xB6, 0xC5, 0x41, 0x40, 0x51,
+    0xC5, 0xFA, 0xEB, 0xD5, 0xD1, 0xD6, 0xCF, 0xA1, 0x8C, 0xDD, 0xCB, 0xA7, 0xC5, 0x3A, 0x82, 0xA4,
+    0x40, 0xC0, 0x14, 0xAE, 0xC2, 0x89, 0x5D, 0xCC, 0x22, 0x19, 0x99, 0x5E, 0x97, 0xC7, 0xF9, 0x31,
+    0x3F, 0x2E, 0x9C, 0xFE, 0x80, 0xC2, 0xA9, 0x8B, 0xC2, 0xA9, 0x8B, 0xC2, 0xA9, 0x8B, 0xC2, 0xA9,
+    0x0B, 0x9B, 0x42, 0xA8, 0x95, 0xE8, 0x98, 0x1C, 0xF6, 0xF1, 0x73, 0x1F, 0xE3, 0x30, 0x1E, 0x14,
+    0xD7, 0x9D, 0x10, 0x55, 0xF7, 0x2B, 0x4F, 0x0A, 0xA7, 0xF9, 0xB1, 0xFE, 0x69, 0xC4, 0x23, 0x66,
+    0xB7, 0x0A, 0xC4, 0xEE, 0x27, 0xE0, 0xCB, 0xA3, 0xED, 0x87, 0xC4, 0xBC, 0x10, 0x9E, 0xF4, 0xF4,
+    0xD3, 0x01, 0x4A, 0xCA, 0xC2, 0x7D, 0x00, 0x05, 0xC2, 0x10, 0xF9, 0xCC, 0xB1, 0xD2, 0x6A, 0x55,
+    0xB9, 0x08, 0x13, 0x19, 0x8A, 0x0C, 0xD5, 0x89, 0xF2, 0xC2, 0x36, 0x7D, 0x24, 0x33, 0x69, 0xCD,
+    0xE5, 0x2B, 0x4C, 0x04, 0x3E, 0x44, 0x5C, 0xB1, 0x9D, 0xB8, 0x97, 0xAD, 0x5A, 0x9C, 0x9E, 0x59,
+    0x2E, 0x5F, 0xDC, 0xBF, 0x55, 0xFC, 0xE0, 0xFA, 0xD7, 0xF2, 0xAF, 0x5E, 0x7F, 0x31, 0xF3, 0xAF,
+    0x07, 0xB1, 0x03, 0x7A, 0x16, 0xD7, 0xBB, 0x46, 0xEC, 0xEF, 0x3C, 0xCF, 0x6B, 0xAE, 0xCE, 0x33,
+    0x71, 0x8F, 0x2F, 0xDC, 0xD7, 0xBD, 0x4B, 0x0F, 0x86, 0xF3, 0x22, 0x9B, 0xEB, 0x8A, 0x6C, 0x92,
+    0x85, 0xFE, 0xAF, 0x3E, 0x3C, 0x41, 0x50, 0xA7, 0xB2, 0xAF, 0x61, 0xB5, 0x18, 0x3A, 0x8A, 0xF3,
+    0x09, 0xEA, 0x3D, 0x0E, 0x1F, 0xAB, 0x6A, 0xE9, 0x94, 0xFB, 0xB6, 0x9A, 0x0D, 0x1A, 0x97, 0x28,
+    0xBC, 0xC4, 0xF3, 0x28, 0x63, 0x82, 0x3D, 0xAC, 0x98, 0xD9, 0x3F, 0x6D, 0x57, 0xCD, 0x4C, 0x6C,
+    0x5E, 0x61, 0x62, 0xE3, 0x7A, 0xD7, 0xC7, 0x00, 0x9C, 0xDA, 0x3E, 0x1C, 0xF1, 0x9C, 0x5E, 0x6E,
+    0x93, 0xCA, 0x08, 0x02, 0xBA, 0x42, 0x66, 0x63, 0xEF, 0x13, 0xB8, 0x5F, 0xAB, 0xBE, 0x40, 0xAF,
+    0x35, 0x78, 0x19, 0x01, 0xE1, 0x56, 0xD6, 0xC6, 0xB0, 0x12, 0x55, 0xC8, 0x8C, 0x5E, 0x81, 0xC9,
+    0x2A, 0x3A, 0x07, 0x99, 0x83, 0x5C, 0x80, 0xBC, 0x39, 0xD1, 0x7C, 0x2B, 0xF3, 0x75, 0xD3, 0x12,
+    0x8F, 0x64, 0xDA, 0x5D, 0xBC, 0xCA, 0x2E, 0x9E, 0x62, 0xE0, 0x53, 0x64, 0x71, 0x05, 0x56, 0xC2,
+    0x49, 0xA6, 0xE3, 0x89, 0x6D, 0x26, 0x2E, 0x97, 0x79, 0xD7, 0xE5, 0x9A, 0xAF, 0x85, 0xAE, 0x02,
+    0x68, 0x9C, 0xF8, 0xEE, 0x4F, 0x23, 0x90, 0xE2, 0x67, 0x2F, 0x8E, 0x8F, 0xF7, 0x7F, 0x33, 0xBC,
+    0x6C, 0x72, 0x49, 0xE1, 0xBB, 0x01, 0x9F, 0x1B, 0xD8, 0x59, 0xC2, 0xC5, 0x9A, 0xDF, 0x98, 0xDA,
+    0x09, 0xF2, 0x45, 0xF3, 0x09, 0x71, 0x04, 0x57, 0x98, 0xF0, 0xB0, 0x37, 0xAB, 0xFE, 0x2D, 0xAA,
+    0x93, 0x6C, 0x10, 0x84, 0x52, 0x0D, 0x24, 0x5C, 0x3C, 0x70, 0x52, 0x9F, 0xAB, 0xF3, 0x00, 0x80,
+    0xBA, 0x69, 0x60, 0x1F, 0x83, 0xE1, 0x33, 0x21, 0x01, 0xBB, 0xA0, 0x3A, 0x53, 0x22, 0x43, 0x82,
+    0x65, 0x56, 0x09, 0xEF, 0x54, 0x4F, 0x0B, 0x42, 0x2C, 0x73, 0x32, 0x94, 0x9F, 0x21, 0x57, 0xE5,
+    0x9F, 0xBA, 0xCA, 0x27, 0xB1, 0x74, 0x08, 0xCE, 0x4F, 0x38, 0x34, 0xB1, 0x6E, 0xFB, 0xF1, 0x2B,
+    0x38, 0x1F, 0xEF, 0x2C, 0x05, 0xE4, 0xBD, 0xBC, 0x24, 0xE3, 0x40, 0x2C, 0xB9, 0xAA, 0x27, 0x96,
+    0x1C, 0x35, 0x14, 0x4B, 0x42, 0x0D, 0xED, 0xCF, 0xD8, 0xB4, 0x4B, 0x63, 0xFE, 0x6D, 0xCF, 0x1E,
+    0x73, 0xC0, 0xF8, 0x47, 0x47, 0x40, 0x7B, 0x3E, 0xB0, 0x13, 0xCE, 0xAE, 0xF5, 0x5B, 0x56, 0x69,
+    0x81, 0x5E, 0x50, 0xE6, 0x5B, 0x2B, 0xD1, 0x7B, 0xA8, 0x13, 0xB8, 0x08, 0xF3, 0x63, 0xE6, 0xBA,
+    0xF1, 0x5F, 0xFA, 0xE4, 0xB7, 0x1F, 0xCA, 0x87, 0x25, 0x49, 0xF8, 0x0C, 0x86, 0xC3, 0x18, 0x17,
+    0xCF, 0x9C, 0x5C, 0x82, 0x5F, 0x9E, 0x08, 0xB2, 0x07, 0xEF, 0x78, 0x0F, 0x92, 0x50, 0xF3, 0x87,
+    0x07, 0x7F, 0x70, 0xB1, 0x4C, 0xC3, 0x25, 0xC9, 0x1E, 0x39, 0x07, 0x0D, 0x08, 0xCC, 0x0F, 0xB1,
+    0x8B, 0xB0, 0x87, 0x8A, 0x90, 0x57, 0xBB, 0x7B, 0x82, 0xAC, 0x8D, 0xD7, 0xEF, 0x29, 0x11, 0xBA,
+    0xA3, 0x04, 0x99, 0x07, 0x5D, 0xA7, 0x5B, 0xE3, 0x20, 0x8B, 0x60, 0x91, 0x96, 0xE7, 0xFE, 0x07,
+    0xD3, 0x5A, 0xB5, 0x6A, 0x81, 0xFD, 0xFF, 0xFF, 0x1F, 0xB4, 0x80, 0x34, 0x00, 0x8D, 0xCE, 0xBB,
+    0x0D, 0xC2, 0x30, 0x10, 0x06, 0xE0, 0xDF, 0x31, 0x8A, 0x8B, 0x14, 0x19, 0x80, 0xC2, 0x6C, 0x90,
+    0x05, 0x90, 0xC8, 0x08, 0x29, 0x32, 0x0E, 0x8A, 0xBC, 0x07, 0x2D, 0x23, 0x50, 0x50, 0x44, 0xB2,
+    0x47, 0xF0, 0x08, 0xAE, 0xA9, 0x5C, 0xA4, 0x70, 0xA4, 0x90, 0xE3, 0x1C, 0x84, 0x84, 0xA8, 0x68,
+    0xBE, 0x3B, 0xDD, 0x43, 0x77, 0x10, 0x3D, 0x80, 0x86, 0x0C, 0x30, 0x16, 0x11, 0x98, 0x90, 0xC0,
+    0x31, 0x41, 0x7E, 0xA1, 0xD6, 0xAB, 0x8C, 0x35, 0x25, 0xF9, 0xDB, 0xF8, 0x87, 0xE5, 0xCD, 0x7E,
+    0x86, 0xED, 0x2D, 0xF9, 0x66, 0xE1, 0x7B, 0xA2, 0x05, 0xCA, 0x2E, 0x27, 0xF4, 0x64, 0x65, 0xD0,
+    0x7C, 0xBF, 0x72, 0x95, 0x03, 0x6A, 0xA3, 0xFC, 0x47, 0xAE, 0x78, 0x14, 0xE4, 0xF5, 0xC3, 0xE8,
+    0x4B, 0xB4, 0xE4, 0x8E, 0x62, 0xE2, 0xFA, 0x19, 0x71, 0xB3, 0x65, 0x07, 0x80, 0x3D, 0x85, 0x6C,
+    0xBD, 0x66, 0x05, 0xF9, 0xBC, 0xAB, 0xF3, 0x24, 0x44, 0x62, 0x0F, 0x18, 0xD9, 0xDB, 0xE6, 0x1D,
+    0x49, 0x05, 0x0C, 0x65, 0x94, 0x73, 0xAB, 0xC9, 0xF0, 0x30, 0xF8, 0x8F, 0x1D, 0x5E, 0x35, 0xCE,
+    0xB1, 0x11, 0xC2, 0x30, 0x0C, 0x40, 0x51, 0x05, 0x15, 0x29, 0x28, 0xCC, 0x06, 0x19, 0x21, 0x0D,
+    0x7D, 0xE8, 0x59, 0x88, 0x0A, 0xBC, 0x01, 0x3D, 0x0D, 0x8B, 0x30, 0x84, 0x47, 0x70, 0xC3, 0x06,
+    0x29, 0x52, 0x20, 0x7F, 0x24, 0x7C, 0xF8, 0xCE, 0xFE, 0xC5, 0x3B, 0x9D, 0x25, 0xF2, 0x3F, 0xC7,
+    0x1E, 0xFB, 0xBD, 0xCA, 0x29, 0x92, 0x28, 0x91, 0x85, 0x35, 0xD2, 0x1E, 0x81, 0x5A, 0x64, 0x76,
+    0x4C, 0xF9, 0xB5, 0x77, 0x5C, 0xB2, 0xA9, 0x23, 0x6F, 0x53, 0xF3, 0x29, 0xCC, 0x27, 0x13, 0x7C,
+    0x94, 0xB2, 0xC0, 0x9A, 0x58, 0x6F, 0x50, 0x66, 0xB6, 0x09, 0x76, 0x50, 0x47, 0x38, 0x43, 0x1E,
+    0xE0, 0x4E, 0x13, 0x71, 0x64, 0x13, 0x71, 0xA4, 0x8A, 0x8C, 0x4D, 0xC9, 0x22, 0x83, 0x69, 0x8B,
+    0xFF, 0xAE, 0xBA, 0x45, 0xA6, 0x67, 0x8D, 0x8C, 0x41, 0x8E, 0xAD, 0xEF, 0x79, 0xE9, 0x39, 0xF8,
+    0xFD, 0x02,
 };
 
 static const EpdGlyph notoserif_14_regularGlyphs[] = {
@@ -2073,99 +2078,99 @@ static const EpdGlyph notoserif_14_regularGlyphs[] = {
     { 0, 0, 121, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 121, 0, 0, 0, 0 }, // U+0020
     { 4, 22, 155, 3, 21, 22, 0 }, // !
-    { 10, 8, 190, 1, 21, 20, 22 }, // "
-    { 16, 21, 261, 0, 21, 84, 42 }, // #
-    { 14, 26, 261, 1, 23, 91, 126 }, // $
-    { 24, 23, 418, 1, 22, 138, 217 }, // %
-    { 21, 23, 346, 1, 22, 121, 355 }, // &
-    { 4, 8, 103, 1, 21, 8, 476 }, // '
-    { 9, 27, 161, 1, 23, 61, 484 }, // (
-    { 9, 27, 161, 0, 23, 61, 545 }, // )
-    { 13, 12, 233, 1, 23, 39, 606 }, // *
-    { 14, 13, 261, 1, 17, 46, 645 }, // +
-    { 6, 9, 117, 0, 4, 14, 691 }, // ,
-    { 9, 4, 145, 0, 10, 9, 705 }, // -
-    { 5, 5, 117, 1, 4, 7, 714 }, // .
-    { 9, 27, 134, 0, 23, 61, 721 }, // /
-    { 15, 23, 270, 1, 22, 87, 782 }, // 0
-    { 13, 21, 214, 0, 21, 69, 869 }, // 1
-    { 14, 22, 231, 0, 22, 77, 938 }, // 2
-    { 14, 23, 239, 0, 22, 81, 1015 }, // 3
-    { 16, 21, 258, 0, 21, 84, 1096 }, // 4
-    { 13, 22, 239, 1, 21, 72, 1180 }, // 5
-    { 14, 23, 257, 1, 22, 81, 1252 }, // 6
-    { 14, 21, 240, 1, 21, 74, 1333 }, // 7
-    { 14, 23, 260, 1, 22, 81, 1407 }, // 8
-    { 14, 23, 257, 1, 22, 81, 1488 }, // 9
-    { 5, 17, 133, 2, 16, 22, 1569 }, // :
-    { 6, 21, 133, 1, 16, 32, 1591 }, // ;
-    { 14, 15, 261, 1, 18, 53, 1623 }, // <
-    { 14, 9, 261, 1, 15, 32, 1676 }, // =
-    { 14, 15, 261, 1, 18, 53, 1708 }, // >
-    { 13, 23, 221, 0, 22, 75, 1761 }, // ?
-    { 25, 26, 430, 1, 21, 163, 1836 }, // @
-    { 21, 21, 329, 0, 21, 111, 1999 }, // A
-    { 17, 21, 305, 1, 21, 90, 2110 }, // B
-    { 16, 23, 287, 1, 22, 92, 2200 }, // C
-    { 19, 21, 339, 1, 21, 100, 2292 }, // D
-    { 16, 21, 291, 1, 21, 84, 2392 }, // E
-    { 15, 21, 275, 1, 21, 79, 2476 }, // F
-    { 20, 23, 333, 1, 22, 115, 2555 }, // G
-    { 22, 21, 370, 1, 21, 116, 2670 }, // H
-    { 9, 21, 171, 1, 21, 48, 2786 }, // I
-    { 11, 28, 167, -1, 21, 77, 2834 }, // J
-    { 20, 21, 327, 1, 21, 105, 2911 }, // K
-    { 16, 21, 291, 1, 21, 84, 3016 }, // L
-    { 26, 21, 438, 1, 21, 137, 3100 }, // M
-    { 21, 21, 356, 1, 21, 111, 3237 }, // N
-    { 19, 23, 346, 1, 22, 110, 3348 }, // O
-    { 16, 21, 282, 1, 21, 84, 3458 }, // P
-    { 19, 29, 346, 1, 22, 138, 3542 }, // Q
-    { 19, 21, 306, 1, 21, 100, 3680 }, // R
-    { 14, 23, 254, 1, 22, 81, 3780 }, // S
-    { 18, 21, 286, 0, 21, 95, 3861 }, // T
-    { 21, 22, 335, 0, 21, 116, 3956 }, // U
-    { 20, 21, 315, 0, 21, 105, 4072 }, // V
-    { 31, 21, 489, 0, 21, 163, 4177 }, // W
-    { 20, 21, 308, 0, 21, 105, 4340 }, // X
-    { 20, 21, 292, -1, 21, 105, 4445 }, // Y
-    { 16, 21, 276, 1, 21, 84, 4550 }, // Z
-    { 8, 27, 168, 2, 23, 54, 4634 }, // [
-    { 9, 27, 134, 0, 23, 61, 4688 }, // <backslash>
-    { 7, 27, 168, 1, 23, 48, 4749 }, // ]
-    { 14, 14, 261, 1, 21, 49, 4797 }, // ^
-    { 15, 3, 214, -1, -2, 12, 4846 }, // _
-    { 6, 6, 128, 1, 23, 9, 4858 }, // `
-    { 15, 17, 263, 1, 16, 64, 4867 }, // a
-    { 17, 24, 287, 0, 23, 102, 4931 }, // b
-    { 13, 17, 230, 1, 16, 56, 5033 }, // c
-    { 17, 24, 287, 1, 23, 102, 5089 }, // d
-    { 14, 17, 250, 1, 16, 60, 5191 }, // e
-    { 13, 23, 172, 0, 23, 75, 5251 }, // f
-    { 16, 24, 251, 0, 17, 96, 5326 }, // g
-    { 18, 23, 296, 0, 23, 104, 5422 }, // h
-    { 9, 23, 149, 0, 23, 52, 5526 }, // i
-    { 8, 30, 140, -1, 23, 60, 5578 }, // j
-    { 18, 23, 273, 0, 23, 104, 5638 }, // k
-    { 9, 23, 145, 0, 23, 52, 5742 }, // l
-    { 27, 16, 441, 0, 16, 108, 5794 }, // m
-    { 18, 16, 301, 0, 16, 72, 5902 }, // n
-    { 15, 17, 269, 1, 16, 64, 5974 }, // o
-    { 17, 23, 287, 0, 16, 98, 6038 }, // p
-    { 17, 23, 287, 1, 16, 98, 6136 }, // q
-    { 14, 16, 220, 0, 16, 56, 6234 }, // r
-    { 11, 17, 211, 1, 16, 47, 6290 }, // s
-    { 10, 21, 164, 0, 20, 53, 6337 }, // t
-    { 18, 17, 296, 0, 16, 77, 6390 }, // u
-    { 17, 16, 270, 0, 16, 68, 6467 }, // v
-    { 26, 16, 402, 0, 16, 104, 6535 }, // w
-    { 17, 16, 270, 0, 16, 68, 6639 }, // x
-    { 17, 23, 264, 0, 16, 98, 6707 }, // y
-    { 13, 16, 239, 1, 16, 52, 6805 }, // z
-    { 11, 27, 200, 1, 23, 75, 6857 }, // {
-    { 3, 30, 261, 7, 23, 23, 6932 }, // |
-    { 11, 27, 200, 1, 23, 75, 6955 }, // }
-    { 14, 6, 261, 1, 13, 21, 7030 }, // ~
+    { 10, 8, 190, 1, 21, 20, 0 }, // "
+    { 16, 21, 261, 0, 21, 84, 20 }, // #
+    { 14, 26, 261, 1, 23, 91, 104 }, // $
+    { 24, 23, 418, 1, 22, 138, 195 }, // %
+    { 21, 23, 346, 1, 22, 121, 333 }, // &
+    { 4, 8, 103, 1, 21, 8, 454 }, // '
+    { 9, 27, 161, 1, 23, 61, 22 }, // (
+    { 9, 27, 161, 0, 23, 61, 83 }, // )
+    { 13, 12, 233, 1, 23, 39, 462 }, // *
+    { 14, 13, 261, 1, 17, 46, 501 }, // +
+    { 6, 9, 117, 0, 4, 14, 144 }, // ,
+    { 9, 4, 145, 0, 10, 9, 158 }, // -
+    { 5, 5, 117, 1, 4, 7, 167 }, // .
+    { 9, 27, 134, 0, 23, 61, 547 }, // /
+    { 15, 23, 270, 1, 22, 87, 174 }, // 0
+    { 13, 21, 214, 0, 21, 69, 261 }, // 1
+    { 14, 22, 231, 0, 22, 77, 330 }, // 2
+    { 14, 23, 239, 0, 22, 81, 407 }, // 3
+    { 16, 21, 258, 0, 21, 84, 488 }, // 4
+    { 13, 22, 239, 1, 21, 72, 572 }, // 5
+    { 14, 23, 257, 1, 22, 81, 644 }, // 6
+    { 14, 21, 240, 1, 21, 74, 725 }, // 7
+    { 14, 23, 260, 1, 22, 81, 799 }, // 8
+    { 14, 23, 257, 1, 22, 81, 880 }, // 9
+    { 5, 17, 133, 2, 16, 22, 961 }, // :
+    { 6, 21, 133, 1, 16, 32, 983 }, // ;
+    { 14, 15, 261, 1, 18, 53, 608 }, // <
+    { 14, 9, 261, 1, 15, 32, 661 }, // =
+    { 14, 15, 261, 1, 18, 53, 693 }, // >
+    { 13, 23, 221, 0, 22, 75, 1015 }, // ?
+    { 25, 26, 430, 1, 21, 163, 746 }, // @
+    { 21, 21, 329, 0, 21, 111, 1090 }, // A
+    { 17, 21, 305, 1, 21, 90, 1201 }, // B
+    { 16, 23, 287, 1, 22, 92, 1291 }, // C
+    { 19, 21, 339, 1, 21, 100, 1383 }, // D
+    { 16, 21, 291, 1, 21, 84, 1483 }, // E
+    { 15, 21, 275, 1, 21, 79, 1567 }, // F
+    { 20, 23, 333, 1, 22, 115, 1646 }, // G
+    { 22, 21, 370, 1, 21, 116, 1761 }, // H
+    { 9, 21, 171, 1, 21, 48, 1877 }, // I
+    { 11, 28, 167, -1, 21, 77, 1925 }, // J
+    { 20, 21, 327, 1, 21, 105, 2002 }, // K
+    { 16, 21, 291, 1, 21, 84, 2107 }, // L
+    { 26, 21, 438, 1, 21, 137, 2191 }, // M
+    { 21, 21, 356, 1, 21, 111, 2328 }, // N
+    { 19, 23, 346, 1, 22, 110, 2439 }, // O
+    { 16, 21, 282, 1, 21, 84, 2549 }, // P
+    { 19, 29, 346, 1, 22, 138, 2633 }, // Q
+    { 19, 21, 306, 1, 21, 100, 2771 }, // R
+    { 14, 23, 254, 1, 22, 81, 2871 }, // S
+    { 18, 21, 286, 0, 21, 95, 2952 }, // T
+    { 21, 22, 335, 0, 21, 116, 909 }, // U
+    { 20, 21, 315, 0, 21, 105, 3047 }, // V
+    { 31, 21, 489, 0, 21, 163, 3152 }, // W
+    { 20, 21, 308, 0, 21, 105, 3315 }, // X
+    { 20, 21, 292, -1, 21, 105, 3420 }, // Y
+    { 16, 21, 276, 1, 21, 84, 3525 }, // Z
+    { 8, 27, 168, 2, 23, 54, 1025 }, // [
+    { 9, 27, 134, 0, 23, 61, 1079 }, // <backslash>
+    { 7, 27, 168, 1, 23, 48, 1140 }, // ]
+    { 14, 14, 261, 1, 21, 49, 1188 }, // ^
+    { 15, 3, 214, -1, -2, 12, 1237 }, // _
+    { 6, 6, 128, 1, 23, 9, 1249 }, // `
+    { 15, 17, 263, 1, 16, 64, 3609 }, // a
+    { 17, 24, 287, 0, 23, 102, 3673 }, // b
+    { 13, 17, 230, 1, 16, 56, 3775 }, // c
+    { 17, 24, 287, 1, 23, 102, 3831 }, // d
+    { 14, 17, 250, 1, 16, 60, 3933 }, // e
+    { 13, 23, 172, 0, 23, 75, 3993 }, // f
+    { 16, 24, 251, 0, 17, 96, 4068 }, // g
+    { 18, 23, 296, 0, 23, 104, 4164 }, // h
+    { 9, 23, 149, 0, 23, 52, 4268 }, // i
+    { 8, 30, 140, -1, 23, 60, 4320 }, // j
+    { 18, 23, 273, 0, 23, 104, 4380 }, // k
+    { 9, 23, 145, 0, 23, 52, 4484 }, // l
+    { 27, 16, 441, 0, 16, 108, 4536 }, // m
+    { 18, 16, 301, 0, 16, 72, 4644 }, // n
+    { 15, 17, 269, 1, 16, 64, 4716 }, // o
+    { 17, 23, 287, 0, 16, 98, 4780 }, // p
+    { 17, 23, 287, 1, 16, 98, 4878 }, // q
+    { 14, 16, 220, 0, 16, 56, 4976 }, // r
+    { 11, 17, 211, 1, 16, 47, 5032 }, // s
+    { 10, 21, 164, 0, 20, 53, 5079 }, // t
+    { 18, 17, 296, 0, 16, 77, 5132 }, // u
+    { 17, 16, 270, 0, 16, 68, 5209 }, // v
+    { 26, 16, 402, 0, 16, 104, 5277 }, // w
+    { 17, 16, 270, 0, 16, 68, 5381 }, // x
+    { 17, 23, 264, 0, 16, 98, 5449 }, // y
+    { 13, 16, 239, 1, 16, 52, 5547 }, // z
+    { 11, 27, 200, 1, 23, 75, 1258 }, // {
+    { 3, 30, 261, 7, 23, 23, 1333 }, // |
+    { 11, 27, 200, 1, 23, 75, 1356 }, // }
+    { 14, 6, 261, 1, 13, 21, 1431 }, // ~
     { 0, 0, 121, 0, 0, 0, 0 }, // U+00A0
     { 4, 22, 155, 3, 16, 22, 0 }, // U+00A1
     { 13, 21, 261, 2, 21, 69, 22 }, // U+00A2
@@ -2249,19 +2254,19 @@ static const EpdGlyph notoserif_14_regularGlyphs[] = {
     { 15, 24, 269, 1, 23, 90, 6824 }, // U+00F0
     { 18, 22, 301, 0, 22, 99, 6914 }, // U+00F1
     { 15, 24, 269, 1, 23, 90, 7013 }, // U+00F2
-    { 15, 24, 269, 1, 23, 90, 7103 }, // U+00F3
-    { 15, 24, 269, 1, 23, 90, 7193 }, // U+00F4
-    { 15, 23, 269, 1, 22, 87, 7283 }, // U+00F5
-    { 15, 23, 269, 1, 22, 87, 7370 }, // U+00F6
-    { 14, 15, 261, 1, 18, 53, 7457 }, // U+00F7
-    { 15, 19, 269, 1, 17, 72, 7510 }, // U+00F8
-    { 18, 24, 296, 0, 23, 108, 7582 }, // U+00F9
-    { 18, 24, 296, 0, 23, 108, 7690 }, // U+00FA
-    { 18, 24, 296, 0, 23, 108, 7798 }, // U+00FB
-    { 18, 23, 296, 0, 22, 104, 7906 }, // U+00FC
-    { 17, 30, 264, 0, 23, 128, 8010 }, // U+00FD
-    { 17, 30, 287, 0, 23, 128, 8138 }, // U+00FE
-    { 17, 29, 264, 0, 22, 124, 8266 }, // U+00FF
+    { 15, 24, 269, 1, 23, 90, 5599 }, // U+00F3
+    { 15, 24, 269, 1, 23, 90, 7103 }, // U+00F4
+    { 15, 23, 269, 1, 22, 87, 7193 }, // U+00F5
+    { 15, 23, 269, 1, 22, 87, 7280 }, // U+00F6
+    { 14, 15, 261, 1, 18, 53, 7367 }, // U+00F7
+    { 15, 19, 269, 1, 17, 72, 7420 }, // U+00F8
+    { 18, 24, 296, 0, 23, 108, 7492 }, // U+00F9
+    { 18, 24, 296, 0, 23, 108, 7600 }, // U+00FA
+    { 18, 24, 296, 0, 23, 108, 7708 }, // U+00FB
+    { 18, 23, 296, 0, 22, 104, 7816 }, // U+00FC
+    { 17, 30, 264, 0, 23, 128, 7920 }, // U+00FD
+    { 17, 30, 287, 0, 23, 128, 8048 }, // U+00FE
+    { 17, 29, 264, 0, 22, 124, 8176 }, // U+00FF
     { 21, 25, 329, 0, 25, 132, 0 }, // U+0100
     { 15, 21, 263, 1, 20, 79, 132 }, // U+0101
     { 21, 27, 329, 0, 27, 142, 211 }, // U+0102
@@ -2963,98 +2968,98 @@ static const EpdGlyph notoserif_14_regularGlyphs[] = {
     { 9, 4, 145, 0, 10, 9, 162 }, // U+2010
     { 9, 4, 145, 0, 10, 9, 171 }, // U+2011
     { 15, 3, 261, 1, 12, 12, 180 }, // U+2012
-    { 16, 3, 233, -1, 9, 12, 192 }, // U+2013
-    { 31, 3, 467, -1, 9, 24, 204 }, // U+2014
-    { 31, 3, 467, -1, 9, 24, 228 }, // U+2015
-    { 7, 30, 261, 5, 23, 53, 252 }, // U+2016
-    { 14, 6, 192, -1, 0, 21, 305 }, // U+2017
-    { 6, 9, 117, 1, 21, 14, 326 }, // U+2018
-    { 6, 9, 117, 0, 21, 14, 340 }, // U+2019
-    { 6, 9, 117, 0, 4, 14, 354 }, // U+201A
-    { 6, 9, 117, 1, 21, 14, 368 }, // U+201B
-    { 12, 9, 210, 1, 21, 27, 382 }, // U+201C
-    { 12, 9, 210, 0, 21, 27, 409 }, // U+201D
-    { 12, 9, 210, 0, 4, 27, 436 }, // U+201E
-    { 12, 9, 210, 1, 21, 27, 463 }, // U+201F
-    { 12, 27, 209, 1, 23, 81, 490 }, // U+2020
-    { 12, 27, 209, 1, 23, 81, 571 }, // U+2021
-    { 9, 9, 169, 1, 15, 21, 652 }, // U+2022
-    { 10, 10, 233, 3, 15, 25, 673 }, // U+2023
-    { 5, 5, 117, 1, 13, 7, 698 }, // U+2024
-    { 13, 5, 250, 1, 13, 17, 705 }, // U+2025
-    { 21, 5, 400, 2, 4, 27, 722 }, // U+2026
-    { 5, 5, 117, 1, 11, 7, 749 }, // U+2027
-    { 0, 0, 280, 0, 0, 0, 756 }, // U+2028
-    { 0, 0, 280, 0, 0, 0, 756 }, // U+2029
-    { 8, 22, 0, -1, 18, 44, 756 }, // U+202A
-    { 8, 22, 0, -7, 18, 44, 800 }, // U+202B
-    { 8, 25, 0, -4, 21, 50, 844 }, // U+202C
-    { 8, 25, 0, -4, 21, 50, 894 }, // U+202D
-    { 8, 25, 0, -4, 21, 50, 944 }, // U+202E
-    { 0, 0, 77, 0, 0, 0, 994 }, // U+202F
-    { 36, 23, 603, 1, 22, 207, 994 }, // U+2030
-    { 47, 23, 787, 1, 22, 271, 1201 }, // U+2031
-    { 5, 8, 88, 0, 21, 10, 1472 }, // U+2032
-    { 11, 8, 175, 0, 21, 22, 1482 }, // U+2033
-    { 16, 8, 263, 0, 21, 32, 1504 }, // U+2034
-    { 5, 8, 88, 0, 21, 10, 1536 }, // U+2035
-    { 11, 8, 175, 0, 21, 22, 1546 }, // U+2036
-    { 16, 8, 263, 0, 21, 32, 1568 }, // U+2037
-    { 10, 9, 187, 1, 2, 23, 1600 }, // U+2038
-    { 7, 12, 155, 1, 14, 21, 1623 }, // U+2039
-    { 7, 12, 155, 1, 14, 21, 1644 }, // U+203A
-    { 22, 21, 382, 1, 21, 116, 1665 }, // U+203B
-    { 11, 22, 261, 3, 21, 61, 1781 }, // U+203C
-    { 14, 23, 252, 1, 22, 81, 1842 }, // U+203D
-    { 15, 2, 214, -1, 24, 8, 1923 }, // U+203E
-    { 22, 7, 0, -11, 0, 39, 1931 }, // U+203F
-    { 22, 7, 0, -11, 25, 39, 1970 }, // U+2040
-    { 14, 21, 210, 0, 21, 74, 2009 }, // U+2041
-    { 27, 23, 467, 1, 23, 156, 2083 }, // U+2042
-    { 9, 5, 169, 1, 13, 12, 2239 }, // U+2043
-    { 14, 21, 29, -6, 21, 74, 2251 }, // U+2044
-    { 8, 27, 168, 2, 23, 54, 2325 }, // U+2045
-    { 7, 27, 168, 1, 23, 48, 2379 }, // U+2046
-    { 27, 23, 446, 0, 22, 156, 2427 }, // U+2047
-    { 20, 23, 358, 0, 22, 115, 2583 }, // U+2048
-    { 19, 23, 354, 3, 22, 110, 2698 }, // U+2049
-    { 14, 23, 261, 1, 17, 81, 2808 }, // U+204A
-    { 16, 27, 288, 1, 23, 108, 2889 }, // U+204B
-    { 16, 11, 279, 1, 16, 44, 2997 }, // U+204C
-    { 16, 11, 279, 1, 16, 44, 3041 }, // U+204D
-    { 13, 12, 233, 1, 17, 39, 3085 }, // U+204E
-    { 5, 21, 133, 2, 16, 27, 3124 }, // U+204F
-    { 19, 23, 341, 1, 22, 110, 3151 }, // U+2050
-    { 13, 24, 233, 1, 23, 78, 3261 }, // U+2051
-    { 10, 22, 154, 0, 21, 55, 3339 }, // U+2052
-    { 14, 6, 261, 1, 13, 21, 3394 }, // U+2053
-    { 22, 7, 0, -11, 0, 39, 3415 }, // U+2054
-    { 14, 14, 252, 1, 17, 49, 3454 }, // U+2055
-    { 14, 17, 287, 2, 16, 60, 3503 }, // U+2056
-    { 20, 8, 323, 0, 21, 40, 3563 }, // U+2057
-    { 17, 17, 331, 2, 16, 73, 3603 }, // U+2058
-    { 17, 17, 331, 2, 16, 73, 3676 }, // U+2059
-    { 5, 23, 134, 2, 22, 29, 3749 }, // U+205A
-    { 17, 23, 331, 2, 22, 98, 3778 }, // U+205B
-    { 16, 16, 325, 2, 16, 64, 3876 }, // U+205C
-    { 5, 23, 134, 2, 22, 29, 3940 }, // U+205D
-    { 5, 23, 134, 2, 22, 29, 3969 }, // U+205E
-    { 0, 0, 104, 0, 0, 0, 3998 }, // U+205F
-    { 0, 0, 280, 0, 0, 0, 3998 }, // U+2060
-    { 0, 0, 280, 0, 0, 0, 3998 }, // U+2061
-    { 0, 0, 280, 0, 0, 0, 3998 }, // U+2062
-    { 0, 0, 280, 0, 0, 0, 3998 }, // U+2063
-    { 0, 0, 280, 0, 0, 0, 3998 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 3998 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 3998 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 3998 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 3998 }, // U+2069
-    { 8, 25, 0, -4, 21, 50, 3998 }, // U+206A
-    { 8, 25, 0, -4, 21, 50, 4048 }, // U+206B
-    { 8, 25, 0, -4, 21, 50, 4098 }, // U+206C
-    { 8, 25, 0, -4, 21, 50, 4148 }, // U+206D
-    { 8, 25, 0, -4, 21, 50, 4198 }, // U+206E
-    { 8, 25, 0, -4, 21, 50, 4248 }, // U+206F
+    { 16, 3, 233, -1, 9, 12, 5689 }, // U+2013
+    { 31, 3, 467, -1, 9, 24, 5701 }, // U+2014
+    { 31, 3, 467, -1, 9, 24, 192 }, // U+2015
+    { 7, 30, 261, 5, 23, 53, 216 }, // U+2016
+    { 14, 6, 192, -1, 0, 21, 269 }, // U+2017
+    { 6, 9, 117, 1, 21, 14, 290 }, // U+2018
+    { 6, 9, 117, 0, 21, 14, 5725 }, // U+2019
+    { 6, 9, 117, 0, 4, 14, 304 }, // U+201A
+    { 6, 9, 117, 1, 21, 14, 318 }, // U+201B
+    { 12, 9, 210, 1, 21, 27, 5739 }, // U+201C
+    { 12, 9, 210, 0, 21, 27, 5766 }, // U+201D
+    { 12, 9, 210, 0, 4, 27, 332 }, // U+201E
+    { 12, 9, 210, 1, 21, 27, 359 }, // U+201F
+    { 12, 27, 209, 1, 23, 81, 386 }, // U+2020
+    { 12, 27, 209, 1, 23, 81, 467 }, // U+2021
+    { 9, 9, 169, 1, 15, 21, 548 }, // U+2022
+    { 10, 10, 233, 3, 15, 25, 569 }, // U+2023
+    { 5, 5, 117, 1, 13, 7, 594 }, // U+2024
+    { 13, 5, 250, 1, 13, 17, 601 }, // U+2025
+    { 21, 5, 400, 2, 4, 27, 5793 }, // U+2026
+    { 5, 5, 117, 1, 11, 7, 618 }, // U+2027
+    { 0, 0, 280, 0, 0, 0, 625 }, // U+2028
+    { 0, 0, 280, 0, 0, 0, 625 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 625 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 669 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 713 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 763 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 813 }, // U+202E
+    { 0, 0, 77, 0, 0, 0, 863 }, // U+202F
+    { 36, 23, 603, 1, 22, 207, 863 }, // U+2030
+    { 47, 23, 787, 1, 22, 271, 1070 }, // U+2031
+    { 5, 8, 88, 0, 21, 10, 1341 }, // U+2032
+    { 11, 8, 175, 0, 21, 22, 1351 }, // U+2033
+    { 16, 8, 263, 0, 21, 32, 1373 }, // U+2034
+    { 5, 8, 88, 0, 21, 10, 1405 }, // U+2035
+    { 11, 8, 175, 0, 21, 22, 1415 }, // U+2036
+    { 16, 8, 263, 0, 21, 32, 1437 }, // U+2037
+    { 10, 9, 187, 1, 2, 23, 1469 }, // U+2038
+    { 7, 12, 155, 1, 14, 21, 1492 }, // U+2039
+    { 7, 12, 155, 1, 14, 21, 1513 }, // U+203A
+    { 22, 21, 382, 1, 21, 116, 1534 }, // U+203B
+    { 11, 22, 261, 3, 21, 61, 1650 }, // U+203C
+    { 14, 23, 252, 1, 22, 81, 1711 }, // U+203D
+    { 15, 2, 214, -1, 24, 8, 1792 }, // U+203E
+    { 22, 7, 0, -11, 0, 39, 1800 }, // U+203F
+    { 22, 7, 0, -11, 25, 39, 1839 }, // U+2040
+    { 14, 21, 210, 0, 21, 74, 1878 }, // U+2041
+    { 27, 23, 467, 1, 23, 156, 1952 }, // U+2042
+    { 9, 5, 169, 1, 13, 12, 2108 }, // U+2043
+    { 14, 21, 29, -6, 21, 74, 2120 }, // U+2044
+    { 8, 27, 168, 2, 23, 54, 2194 }, // U+2045
+    { 7, 27, 168, 1, 23, 48, 2248 }, // U+2046
+    { 27, 23, 446, 0, 22, 156, 2296 }, // U+2047
+    { 20, 23, 358, 0, 22, 115, 2452 }, // U+2048
+    { 19, 23, 354, 3, 22, 110, 2567 }, // U+2049
+    { 14, 23, 261, 1, 17, 81, 2677 }, // U+204A
+    { 16, 27, 288, 1, 23, 108, 2758 }, // U+204B
+    { 16, 11, 279, 1, 16, 44, 2866 }, // U+204C
+    { 16, 11, 279, 1, 16, 44, 2910 }, // U+204D
+    { 13, 12, 233, 1, 17, 39, 2954 }, // U+204E
+    { 5, 21, 133, 2, 16, 27, 2993 }, // U+204F
+    { 19, 23, 341, 1, 22, 110, 3020 }, // U+2050
+    { 13, 24, 233, 1, 23, 78, 3130 }, // U+2051
+    { 10, 22, 154, 0, 21, 55, 3208 }, // U+2052
+    { 14, 6, 261, 1, 13, 21, 3263 }, // U+2053
+    { 22, 7, 0, -11, 0, 39, 3284 }, // U+2054
+    { 14, 14, 252, 1, 17, 49, 3323 }, // U+2055
+    { 14, 17, 287, 2, 16, 60, 3372 }, // U+2056
+    { 20, 8, 323, 0, 21, 40, 3432 }, // U+2057
+    { 17, 17, 331, 2, 16, 73, 3472 }, // U+2058
+    { 17, 17, 331, 2, 16, 73, 3545 }, // U+2059
+    { 5, 23, 134, 2, 22, 29, 3618 }, // U+205A
+    { 17, 23, 331, 2, 22, 98, 3647 }, // U+205B
+    { 16, 16, 325, 2, 16, 64, 3745 }, // U+205C
+    { 5, 23, 134, 2, 22, 29, 3809 }, // U+205D
+    { 5, 23, 134, 2, 22, 29, 3838 }, // U+205E
+    { 0, 0, 104, 0, 0, 0, 3867 }, // U+205F
+    { 0, 0, 280, 0, 0, 0, 3867 }, // U+2060
+    { 0, 0, 280, 0, 0, 0, 3867 }, // U+2061
+    { 0, 0, 280, 0, 0, 0, 3867 }, // U+2062
+    { 0, 0, 280, 0, 0, 0, 3867 }, // U+2063
+    { 0, 0, 280, 0, 0, 0, 3867 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 3867 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 3867 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 3867 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 3867 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 3867 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 3917 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 3967 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 4017 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 4067 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 4117 }, // U+206F
     { 10, 14, 187, 1, 25, 35, 0 }, // U+2070
     { 6, 14, 97, 0, 22, 21, 35 }, // U+2071
     { 12, 13, 187, 0, 24, 39, 56 }, // U+2074
@@ -3131,13 +3136,13 @@ static const EpdGlyph notoserif_14_regularGlyphs[] = {
     { 14, 26, 261, 1, 23, 91, 3363 }, // U+20BF
     { 13, 21, 230, 1, 16, 69, 3454 }, // U+20C0
     { 14, 3, 270, 1, 12, 11, 0 }, // U+2212
-    { 23, 23, 330, 0, 23, 133, 0 }, // U+FB00
-    { 19, 23, 309, 0, 23, 110, 133 }, // U+FB01
-    { 19, 23, 309, 0, 23, 110, 243 }, // U+FB02
-    { 29, 23, 468, 0, 23, 167, 353 }, // U+FB03
-    { 29, 23, 467, 0, 23, 167, 520 }, // U+FB04
-    { 19, 24, 312, 0, 23, 114, 687 }, // U+FB05
-    { 22, 24, 369, 1, 23, 132, 801 }, // U+FB06
+    { 23, 23, 330, 0, 23, 133, 5820 }, // U+FB00
+    { 19, 23, 309, 0, 23, 110, 5953 }, // U+FB01
+    { 19, 23, 309, 0, 23, 110, 6063 }, // U+FB02
+    { 29, 23, 468, 0, 23, 167, 6173 }, // U+FB03
+    { 29, 23, 467, 0, 23, 167, 6340 }, // U+FB04
+    { 19, 24, 312, 0, 23, 114, 0 }, // U+FB05
+    { 22, 24, 369, 1, 23, 132, 114 }, // U+FB06
     { 27, 28, 467, 1, 23, 189, 0 }, // U+FFFD
 };
 
@@ -3145,8 +3150,7 @@ static const EpdUnicodeInterval notoserif_14_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3154,8 +3158,7 @@ static const EpdUnicodeInterval notoserif_14_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3165,19 +3168,57 @@ static const EpdUnicodeInterval notoserif_14_regularIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_14_regularGroups[] = {
-    { 0, 3574, 7835, 97, 0 },
-    { 3574, 3138, 9272, 96, 97 },
-    { 6712, 3814, 14560, 128, 193 },
-    { 10526, 3824, 13107, 96, 321 },
-    { 14350, 1182, 1945, 112, 417 },
-    { 15532, 9938, 29918, 256, 529 },
-    { 25470, 2233, 12086, 90, 785 },
-    { 27703, 1953, 4653, 111, 875 },
-    { 29656, 663, 1431, 42, 986 },
-    { 30319, 2067, 3735, 33, 1028 },
-    { 32386, 13, 12, 1, 1061 },
-    { 32399, 371, 1000, 7, 1062 },
-    { 32770, 132, 196, 1, 1069 },
+    { 0, 3111, 7173, 83, 2 },
+    { 3111, 831, 1632, 26, 0 },
+    { 3942, 3125, 9176, 95, 97 },
+    { 7067, 3814, 14560, 128, 193 },
+    { 10881, 3824, 13107, 96, 321 },
+    { 14705, 1182, 1945, 112, 417 },
+    { 15887, 9938, 29918, 256, 529 },
+    { 25825, 2233, 12086, 90, 785 },
+    { 28058, 1884, 4515, 105, 875 },
+    { 29942, 663, 1431, 42, 986 },
+    { 30605, 2067, 3735, 33, 1028 },
+    { 32672, 13, 12, 1, 1061 },
+    { 32685, 161, 264, 2, 1067 },
+    { 32846, 132, 196, 1, 1069 },
+};
+
+static const uint16_t notoserif_14_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_14_regularKernLeftClasses[] = {
@@ -4096,18 +4137,81 @@ static const EpdLigaturePair notoserif_14_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_14_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 0 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_14_regular = {
     notoserif_14_regularBitmaps,
     notoserif_14_regularGlyphs,
     notoserif_14_regularIntervals,
-    20,
+    18,
     40,
     32,
     -9,
     true,
     notoserif_14_regularGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_14_regularGlyphToGroup,
     notoserif_14_regularKernLeftClasses,
     notoserif_14_regularKernRightClasses,
     notoserif_14_regularKernMatrix,
@@ -4117,4 +4221,8 @@ static const EpdFontData notoserif_14_regular = {
     65,
     notoserif_14_regularLigaturePairs,
     5,
+    notoserif_14_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
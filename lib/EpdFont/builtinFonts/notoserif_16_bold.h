@@ -3,2541 +3,2545 @@
  * name: notoserif_16_bold
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_16_bold 16 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_16_bold 16 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_16_boldBitmaps[40463] = {
-    0xB5, 0x5A, 0xBF, 0x93, 0xDC, 0x46, 0x76, 0x6E, 0x0C, 0x44, 0xC2, 0x75, 0x08, 0xC0, 0x80, 0x94,
-    0xCB, 0x66, 0x59, 0x48, 0x2E, 0x92, 0x6D, 0x21, 0x75, 0xC0, 0xDD, 0x06, 0x4F, 0x81, 0x02, 0x05,
-    0xDA, 0x80, 0xEB, 0x0B, 0x14, 0x30, 0x71, 0x60, 0xEB, 0x82, 0x4D, 0x2F, 0xA0, 0x08, 0xC8, 0x0E,
-    0x2E, 0x70, 0xB2, 0xE5, 0xAA, 0xFB, 0x0F, 0xEC, 0xAA, 0xF3, 0x2A, 0x60, 0xE2, 0x80, 0x76, 0xAD,
-    0x04, 0xDC, 0x29, 0x50, 0xA0, 0xE0, 0xC0, 0xAB, 0xBA, 0x52, 0xE0, 0x40, 0xD0, 0x1D, 0x69, 0x97,
-    0x8F, 0x01, 0x71, 0x16, 0x78, 0xC2, 0x2E, 0x01, 0xB4, 0xBF, 0xEF, 0x6B, 0xCC, 0xEC, 0x2E, 0x49,
-    0x89, 0x94, 0x4C, 0xCD, 0x2E, 0x5E, 0xCF, 0x0C, 0xBA, 0x1B, 0xAF, 0x5F, 0xBF, 0x1F, 0xDF, 0x7B,
-    0x3D, 0x45, 0x57, 0xE0, 0xCF, 0xF2, 0xAF, 0xB5, 0x6D, 0xD6, 0xF0, 0x2F, 0xAD, 0xD3, 0x3A, 0xE1,
-    0x5F, 0x99, 0x94, 0xE7, 0x0C, 0x5F, 0x69, 0x63, 0xD5, 0x2B, 0x6B, 0x02, 0x53, 0xDD, 0x71, 0x65,
-    0xF5, 0x73, 0x57, 0x16, 0xB5, 0xCB, 0x6D, 0xED, 0x8C, 0x2D, 0x79, 0x55, 0x26, 0xCB, 0x6F, 0x9A,
-    0xCC, 0xDC, 0x34, 0xA9, 0xD9, 0x32, 0xE7, 0xCC, 0x45, 0x63, 0xE2, 0xF2, 0xC7, 0xC6, 0x24, 0xE5,
-    0x00, 0x92, 0xF7, 0x20, 0xA6, 0xC3, 0x44, 0x01, 0x48, 0xB6, 0xEA, 0xCC, 0xA5, 0x9B, 0x3F, 0x7C,
-    0x98, 0x5B, 0xE7, 0x5C, 0x2D, 0x62, 0x6E, 0x44, 0xB5, 0x31, 0x87, 0x24, 0xB7, 0xE3, 0xD2, 0x98,
-    0x3E, 0x11, 0xC9, 0x4D, 0xD0, 0x25, 0xC6, 0xA0, 0xC7, 0xEC, 0xC9, 0x0F, 0xEF, 0xDD, 0xBC, 0x66,
-    0xC2, 0x66, 0xCB, 0x98, 0xB0, 0xBE, 0x62, 0x4C, 0x54, 0xDF, 0xE0, 0x73, 0x0E, 0x4F, 0x3F, 0xC7,
-    0x98, 0x1C, 0x57, 0xD0, 0xAE, 0xC9, 0xE5, 0xE3, 0x9C, 0x33, 0x74, 0x26, 0x7A, 0x78, 0x7F, 0x34,
-    0xC9, 0xE7, 0xBF, 0x1D, 0x4D, 0x7A, 0xE7, 0xF3, 0xD1, 0x64, 0x77, 0x3E, 0x6F, 0x4D, 0xFA, 0x7B,
-    0x74, 0x49, 0x67, 0x90, 0xC4, 0x81, 0x44, 0x6E, 0x32, 0xEC, 0xDC, 0x80, 0x49, 0x87, 0xB9, 0x56,
-    0xFC, 0x1C, 0x38, 0x67, 0xBE, 0x17, 0xFC, 0x06, 0xAB, 0x0C, 0xDA, 0x35, 0x79, 0xAF, 0x9D, 0x8D,
-    0xFD, 0xF9, 0x6F, 0x30, 0xDF, 0xF1, 0xFD, 0xDE, 0x84, 0x5C, 0x81, 0xB9, 0xDC, 0x9F, 0x79, 0xAE,
-    0x88, 0xD9, 0x37, 0x9B, 0xD7, 0xCA, 0x95, 0x86, 0x6B, 0x4B, 0x30, 0x02, 0x2B, 0xC3, 0x24, 0x60,
-    0x02, 0xDF, 0x17, 0xF9, 0x0C, 0x91, 0x19, 0x53, 0x19, 0x67, 0x0E, 0xD5, 0x56, 0x66, 0x20, 0x1B,
-    0xA6, 0x82, 0xA0, 0xD4, 0x86, 0xAD, 0x6F, 0xE3, 0xDA, 0xF7, 0x4B, 0xCA, 0x5D, 0x8C, 0x33, 0x73,
-    0x1A, 0x81, 0x55, 0x9B, 0x4F, 0xDB, 0xE9, 0xA7, 0x83, 0xC9, 0x7E, 0x31, 0xDC, 0xB0, 0x57, 0x47,
-    0x13, 0xBB, 0x76, 0xC0, 0x3D, 0x63, 0x0E, 0x82, 0x8E, 0x73, 0x42, 0x56, 0x60, 0x99, 0x6D, 0x84,
-    0xED, 0xAA, 0x0C, 0x85, 0xE5, 0xDB, 0xD4, 0xF8, 0xEF, 0xAD, 0xF1, 0xFD, 0xDE, 0x35, 0x1A, 0x67,
-    0x46, 0xC3, 0x79, 0x4C, 0xD0, 0x9B, 0xF4, 0x53, 0x2C, 0x2A, 0x84, 0xEC, 0x28, 0x12, 0xBE, 0x2E,
-    0x9E, 0xAC, 0x27, 0x72, 0x77, 0xD9, 0x58, 0xC7, 0x21, 0xA6, 0xAA, 0x2B, 0xCA, 0x1D, 0x3A, 0x51,
-    0x8A, 0x57, 0x5B, 0x9F, 0xFA, 0x54, 0x16, 0xBA, 0x57, 0xF3, 0x21, 0xA6, 0xF8, 0x72, 0x64, 0x93,
-    0x39, 0x09, 0x28, 0x41, 0x57, 0x97, 0x9B, 0xCA, 0x95, 0xF6, 0xD8, 0x44, 0xB3, 0x6B, 0x31, 0x30,
-    0x1D, 0xEC, 0x60, 0x73, 0x63, 0xBB, 0x74, 0xB6, 0xE8, 0xDF, 0x46, 0xEE, 0x43, 0x3C, 0xA0, 0x0D,
-    0xB8, 0x1B, 0x55, 0x63, 0x8A, 0x91, 0x9F, 0x4C, 0x8A, 0x4F, 0x45, 0x87, 0xE5, 0xA2, 0x27, 0x24,
-    0x0A, 0x0E, 0xD3, 0x19, 0xF3, 0xF4, 0x60, 0xCC, 0x8D, 0x16, 0x3B, 0x52, 0xB9, 0x7D, 0x7E, 0x1B,
-    0xEC, 0x88, 0xBF, 0xA6, 0xAA, 0x8B, 0xDA, 0xD6, 0xB6, 0xB4, 0x65, 0x96, 0x67, 0x58, 0x3B, 0x55,
-    0xFB, 0x25, 0x2E, 0x3A, 0x84, 0x46, 0x74, 0xA6, 0xA8, 0xC1, 0x6E, 0xE8, 0x4C, 0x34, 0x99, 0x64,
-    0xE4, 0x7F, 0x06, 0x91, 0xF6, 0x9C, 0xFA, 0xC9, 0x7F, 0xDC, 0x4A, 0x87, 0xA5, 0x1B, 0xFA, 0xAF,
-    0x1C, 0x97, 0xCA, 0x25, 0x27, 0x9D, 0x59, 0x8D, 0x9C, 0xD3, 0xBC, 0x84, 0x85, 0x63, 0x17, 0x21,
-    0x94, 0xAC, 0x35, 0xF1, 0x60, 0xC2, 0x19, 0x8A, 0x44, 0x19, 0x40, 0x52, 0x58, 0x12, 0x39, 0xB7,
-    0xDD, 0xD3, 0x66, 0xD7, 0xF7, 0xB8, 0x8B, 0x15, 0xA2, 0xB3, 0x2B, 0x31, 0x79, 0x08, 0x96, 0xC0,
-    0x4C, 0xC3, 0x87, 0xF4, 0x5E, 0xBF, 0xCF, 0x81, 0xA4, 0x10, 0x71, 0x52, 0x9B, 0x2B, 0xC9, 0x7B,
-    0xAD, 0x7D, 0xF3, 0xCD, 0xAE, 0xBA, 0x5F, 0xF4, 0xE7, 0xDD, 0x9C, 0x9B, 0xA2, 0x37, 0x7B, 0xCE,
-    0xB5, 0xC5, 0x7F, 0xEE, 0x75, 0xDB, 0xC9, 0xEB, 0xDD, 0xF7, 0x93, 0x72, 0x9F, 0xFD, 0xD4, 0x5F,
-    0x22, 0x2F, 0x9F, 0x7A, 0xC1, 0xC0, 0x46, 0x5E, 0xBB, 0xD7, 0x7F, 0xBA, 0xF3, 0xD4, 0x3E, 0xE7,
-    0xD6, 0xAE, 0xC0, 0xF6, 0x59, 0x1F, 0xF7, 0xAB, 0x6E, 0xD5, 0xC6, 0x75, 0x61, 0xFE, 0x4D, 0x4A,
-    0xD0, 0x58, 0x6C, 0x9D, 0x6B, 0x5F, 0x3D, 0x80, 0xC6, 0xC3, 0x1D, 0x34, 0xAE, 0xAD, 0x5A, 0xE9,
-    0x40, 0x90, 0xC3, 0x60, 0x61, 0xAE, 0xD0, 0x3E, 0xAA, 0x3F, 0x34, 0x3F, 0xA1, 0xE6, 0x99, 0xD7,
-    0x0C, 0xB5, 0x1E, 0x46, 0x0C, 0x13, 0xBE, 0x6D, 0xB8, 0xAE, 0x0E, 0xD6, 0x6E, 0x56, 0xED, 0xD9,
-    0xEE, 0x1A, 0x81, 0xEE, 0xB0, 0x94, 0x6D, 0x8D, 0x40, 0xF7, 0x43, 0x89, 0x76, 0xF3, 0xCA, 0x66,
-    0x59, 0x38, 0x06, 0xCE, 0x10, 0x53, 0x3C, 0x52, 0x5C, 0x3D, 0x76, 0x32, 0xEB, 0x20, 0x3B, 0xDB,
-    0x05, 0xD0, 0x42, 0x90, 0x92, 0xA4, 0x16, 0x81, 0x74, 0x9F, 0x4E, 0x36, 0x5D, 0xD4, 0x39, 0xD7,
-    0x04, 0x9A, 0x2A, 0x19, 0x30, 0x69, 0x38, 0x61, 0x1F, 0x03, 0xBA, 0x12, 0x28, 0x2F, 0xF5, 0x9A,
-    0x8A, 0xC5, 0x4D, 0x85, 0x0E, 0x52, 0xAF, 0x41, 0xCE, 0xC3, 0x57, 0x18, 0xFB, 0x05, 0xC9, 0x47,
-    0x20, 0xAF, 0x84, 0x32, 0xBF, 0x17, 0x42, 0x22, 0xC7, 0x0B, 0xF3, 0xC7, 0x20, 0x54, 0x01, 0x43,
-    0x7B, 0x48, 0xE9, 0x41, 0x5B, 0xDB, 0x55, 0x75, 0x3A, 0xB8, 0x32, 0x19, 0xAB, 0x3C, 0x19, 0x2D,
-    0xAE, 0x73, 0x54, 0x4D, 0x93, 0x42, 0xAA, 0x19, 0xD8, 0xB5, 0x0D, 0x8D, 0xD0, 0xAC, 0x60, 0xA9,
-    0x11, 0xFD, 0x64, 0xCB, 0x3D, 0x32, 0xB4, 0xF5, 0x10, 0x6A, 0x9C, 0x34, 0x26, 0xA3, 0xB9, 0x55,
-    0x07, 0xEF, 0xBB, 0x53, 0xAF, 0xD9, 0x4B, 0xB7, 0xC0, 0x40, 0x3C, 0x17, 0x16, 0x36, 0x24, 0x13,
-    0x66, 0x03, 0x1F, 0x59, 0x0B, 0x8E, 0xD2, 0x86, 0xC6, 0xD2, 0x9C, 0x62, 0x90, 0x66, 0x9D, 0xE0,
-    0x89, 0x97, 0xAA, 0xD2, 0xC8, 0xA8, 0xCD, 0x9F, 0xD3, 0x89, 0xD2, 0x2C, 0xD9, 0x25, 0x27, 0xC7,
-    0xF2, 0x0A, 0x75, 0x40, 0x92, 0x91, 0x58, 0x43, 0x61, 0x97, 0xB8, 0x6B, 0x5B, 0xF4, 0x4B, 0x9C,
-    0x1B, 0x60, 0x4E, 0x94, 0xEE, 0x39, 0xAD, 0x91, 0xF3, 0x19, 0xCB, 0xDD, 0x2E, 0xE4, 0x13, 0x41,
-    0x56, 0x0F, 0x40, 0xA2, 0x5F, 0x72, 0x1D, 0x6F, 0x81, 0x64, 0xB0, 0x44, 0x73, 0x85, 0xE4, 0x36,
-    0x48, 0xD0, 0x81, 0x84, 0x0D, 0x48, 0x5C, 0xD3, 0x44, 0x73, 0x90, 0x6D, 0x1A, 0xEB, 0xCD, 0xDD,
-    0xBD, 0xA3, 0x9D, 0x0A, 0xCB, 0xEA, 0x0A, 0xA7, 0x2D, 0xE4, 0x88, 0x53, 0xC4, 0x8E, 0xDC, 0x46,
-    0x28, 0x11, 0x58, 0x68, 0xF1, 0xA6, 0x4F, 0x4E, 0xAE, 0x01, 0xFA, 0xC7, 0xEB, 0xF6, 0x2B, 0xC6,
-    0x5C, 0x80, 0xDE, 0x52, 0x77, 0xCD, 0xD6, 0xA5, 0x1D, 0xF9, 0x3E, 0xFB, 0x80, 0xBE, 0x11, 0x36,
-    0x67, 0x52, 0x4C, 0x01, 0x11, 0x99, 0x78, 0x5E, 0x5F, 0x57, 0x4C, 0x3C, 0xD1, 0x49, 0x60, 0x9F,
-    0x86, 0x2A, 0xAF, 0x3A, 0xC4, 0xBA, 0x3A, 0xA6, 0x17, 0xBB, 0xB4, 0xD6, 0xDD, 0x58, 0x83, 0xDD,
-    0x68, 0x82, 0x19, 0x1E, 0x22, 0x1C, 0x03, 0x2A, 0x1C, 0x36, 0x06, 0x8E, 0x64, 0xD0, 0xD6, 0x19,
-    0xDB, 0xAE, 0x49, 0x71, 0xE7, 0xEF, 0x40, 0x1E, 0x80, 0xC7, 0x62, 0xBE, 0x35, 0xC2, 0x47, 0x44,
-    0xB3, 0x29, 0x1A, 0xA8, 0x68, 0xD1, 0x40, 0x59, 0x0B, 0xBA, 0x07, 0x6C, 0x34, 0xC4, 0x09, 0xCF,
-    0x01, 0xDD, 0xC5, 0x77, 0x69, 0x17, 0x48, 0x77, 0x31, 0xF3, 0x84, 0xED, 0x79, 0x4C, 0x77, 0x19,
-    0x79, 0x4D, 0x71, 0x9A, 0xCC, 0xF0, 0x5C, 0xC1, 0x08, 0x13, 0x83, 0x4B, 0xFC, 0xB1, 0x09, 0x29,
-    0xFB, 0x98, 0x3C, 0x50, 0x61, 0x4C, 0xC6, 0xBD, 0x93, 0x49, 0x7B, 0x6F, 0x4E, 0x0D, 0xE4, 0xCE,
-    0xAE, 0x18, 0x33, 0x43, 0x6E, 0x7E, 0xCC, 0x01, 0x09, 0x07, 0xA4, 0x62, 0x9A, 0x31, 0xA3, 0x50,
-    0xC8, 0x2A, 0x97, 0x01, 0x2B, 0xB7, 0xB1, 0xDA, 0x3D, 0x2A, 0x24, 0xF5, 0x2A, 0x1E, 0xE1, 0x42,
-    0x53, 0x9A, 0x1A, 0x79, 0xA6, 0xF7, 0x5B, 0x48, 0xD6, 0x93, 0xFB, 0x29, 0x64, 0x48, 0xFB, 0xC7,
-    0x7E, 0x51, 0x0B, 0xAA, 0xA3, 0xF7, 0xF2, 0x53, 0xC5, 0x61, 0x29, 0x3A, 0x43, 0x09, 0x4B, 0xBA,
-    0xEF, 0xBA, 0x5A, 0x08, 0x5D, 0x3D, 0x95, 0x8B, 0x22, 0x49, 0x69, 0xBF, 0xB1, 0xBB, 0x45, 0x67,
-    0xEC, 0xE0, 0x9C, 0x7C, 0x38, 0x90, 0x66, 0x4F, 0xC6, 0x87, 0xEE, 0x64, 0x80, 0xA4, 0xB3, 0x0E,
-    0xD6, 0x6D, 0x5B, 0x3C, 0xAD, 0x68, 0x20, 0xB0, 0xAA, 0x06, 0x43, 0x0B, 0x01, 0x1B, 0x95, 0x44,
-    0xDC, 0xAE, 0xE8, 0x4B, 0x22, 0x4C, 0x3A, 0x57, 0x2E, 0x8F, 0xDC, 0x31, 0x94, 0x7A, 0xEF, 0x9F,
-    0x36, 0x0B, 0x13, 0x09, 0x17, 0x71, 0xFC, 0x19, 0x4D, 0x2D, 0xA3, 0x38, 0x32, 0x32, 0x92, 0xD0,
-    0x68, 0x43, 0xEA, 0xEF, 0xB2, 0xF9, 0xB6, 0xAE, 0xDA, 0xAA, 0x5B, 0x9C, 0xE4, 0x99, 0x57, 0x56,
-    0x9E, 0xBE, 0x93, 0x74, 0xD9, 0x90, 0x8D, 0xD9, 0x20, 0xB9, 0x9E, 0x79, 0x25, 0x6D, 0xD6, 0x67,
-    0x43, 0x3A, 0x46, 0x43, 0xD0, 0x07, 0x5D, 0xD4, 0xD8, 0xFC, 0xAF, 0xFC, 0x0D, 0x44, 0x35, 0xBA,
-    0x49, 0x1A, 0x24, 0x82, 0x0F, 0x78, 0x66, 0x20, 0x03, 0xFF, 0xD2, 0x74, 0xCA, 0x8F, 0xB6, 0x98,
-    0x09, 0xDF, 0xE4, 0xEA, 0x82, 0xC0, 0x4B, 0x79, 0xB4, 0x8B, 0x11, 0x13, 0x85, 0xBC, 0x74, 0x70,
-    0x70, 0xF0, 0xCF, 0x4B, 0x48, 0x18, 0x1E, 0x7F, 0x32, 0xEE, 0xFD, 0x8C, 0xF7, 0xD8, 0x52, 0x17,
-    0xB8, 0xEF, 0x9B, 0x19, 0xF4, 0x06, 0x5B, 0x1F, 0x4F, 0x0A, 0xBB, 0x86, 0xD1, 0x4F, 0x17, 0xBE,
-    0xE4, 0xCD, 0x82, 0x8E, 0xDA, 0xFB, 0x25, 0x3E, 0xBE, 0x5F, 0x10, 0x1B, 0x5F, 0xE7, 0xDD, 0x11,
-    0xD4, 0x93, 0xCE, 0x38, 0xEB, 0xAB, 0x06, 0xDE, 0xAC, 0x4E, 0x26, 0x60, 0xD1, 0xC9, 0xDB, 0x15,
-    0x2F, 0xDA, 0x18, 0xA2, 0x24, 0xA3, 0x63, 0xB8, 0x2C, 0x88, 0x61, 0x2D, 0x3D, 0x1D, 0xA2, 0xD6,
-    0x62, 0xAC, 0x3D, 0x43, 0x55, 0xE7, 0xDB, 0x13, 0x41, 0xFF, 0xE8, 0x38, 0xF7, 0xB6, 0xE7, 0x57,
-    0x56, 0xED, 0x07, 0xC4, 0x2E, 0xF4, 0x8C, 0x71, 0xC3, 0x08, 0x07, 0xC1, 0xF4, 0xC4, 0x57, 0x82,
-    0x42, 0xF8, 0x7F, 0x79, 0xFF, 0xC2, 0x16, 0xAC, 0x81, 0xE6, 0xB3, 0x6D, 0xA2, 0x2E, 0xEE, 0x93,
-    0x36, 0x35, 0x49, 0x93, 0x36, 0xB8, 0x10, 0x59, 0x6D, 0x8D, 0x77, 0xDC, 0xB5, 0x3C, 0xAB, 0x13,
-    0xC0, 0x31, 0x68, 0x2E, 0x5B, 0xEA, 0x72, 0x9D, 0x1A, 0x0B, 0xAF, 0x0B, 0xC8, 0xA1, 0xB6, 0xC8,
-    0xB7, 0xD5, 0x56, 0xF9, 0x16, 0xEE, 0x03, 0xD3, 0xE6, 0x87, 0x00, 0x5F, 0x2E, 0x78, 0x70, 0x15,
-    0x51, 0x3F, 0x2F, 0xEE, 0xBF, 0x75, 0x1F, 0xAE, 0xB8, 0x4C, 0x27, 0x68, 0x18, 0xE6, 0x85, 0xA6,
-    0x5E, 0x03, 0x4B, 0xAD, 0x67, 0x5A, 0xD6, 0x48, 0x9B, 0xA3, 0x58, 0x57, 0x94, 0x31, 0xD6, 0xBB,
-    0x47, 0x35, 0x98, 0xF3, 0xB7, 0x07, 0x85, 0x03, 0x19, 0x08, 0xA4, 0x78, 0xE0, 0x51, 0x67, 0x3C,
-    0x7A, 0x35, 0x99, 0x3C, 0x86, 0xF7, 0xA6, 0x67, 0x7D, 0xB3, 0xED, 0xBB, 0x1E, 0xCA, 0x21, 0x9B,
-    0x41, 0xF0, 0x2E, 0xE8, 0x29, 0x26, 0xB3, 0x02, 0xD0, 0x17, 0x68, 0xA4, 0x9C, 0x11, 0x86, 0xE5,
-    0x1E, 0xE3, 0x3A, 0x91, 0x7B, 0x2F, 0x35, 0x5B, 0x2A, 0xFF, 0xE6, 0x1D, 0x88, 0x6F, 0x20, 0xBF,
-    0x0F, 0xA0, 0x4E, 0xB5, 0x24, 0x86, 0x06, 0xD8, 0xD1, 0xC0, 0x51, 0x11, 0xC0, 0x22, 0xB2, 0x86,
-    0x9D, 0x76, 0x8D, 0xBE, 0x04, 0xE0, 0x0D, 0x58, 0x0F, 0xA2, 0xAF, 0xF1, 0x9F, 0x78, 0xFC, 0xFF,
-    0x2F, 0x7E, 0x8E, 0x16, 0x4B, 0xB8, 0x43, 0x70, 0xE7, 0x9A, 0x64, 0x26, 0x65, 0x58, 0x75, 0x4D,
-    0xF4, 0x04, 0xF5, 0xDF, 0x53, 0x15, 0xDC, 0x7F, 0x41, 0x11, 0x8C, 0x5F, 0xB8, 0xFB, 0x5D, 0xD5,
-    0xEB, 0xAE, 0xC6, 0x52, 0x3B, 0x5C, 0x43, 0x8E, 0x5C, 0x13, 0x3C, 0x41, 0xFD, 0xF7, 0xE8, 0x13,
-    0x60, 0x9E, 0x59, 0x4F, 0x1F, 0x48, 0xE7, 0xB5, 0x26, 0x06, 0xF4, 0x15, 0x8A, 0x46, 0x05, 0xE2,
-    0x12, 0x62, 0x54, 0xE8, 0xE0, 0x46, 0x56, 0x0E, 0xCB, 0x0F, 0x46, 0x8A, 0x62, 0x3F, 0x1B, 0xD7,
-    0x91, 0xE9, 0x14, 0xE9, 0x37, 0xE4, 0xEC, 0x0D, 0x75, 0x4E, 0x25, 0xC1, 0x79, 0x89, 0xE5, 0x31,
-    0x79, 0xC8, 0x4C, 0x75, 0xF4, 0xD7, 0x13, 0x75, 0x5E, 0x61, 0xCF, 0xBB, 0x27, 0xF0, 0xF1, 0x3F,
-    0x5E, 0x22, 0x74, 0x7A, 0xCD, 0x9E, 0x56, 0xEB, 0x39, 0xA6, 0x32, 0x13, 0xF2, 0xF7, 0xA4, 0x98,
-    0x94, 0xA0, 0x57, 0x14, 0x7C, 0x91, 0xCE, 0xCF, 0xA6, 0xE9, 0x74, 0x32, 0x16, 0xBC, 0x81, 0x16,
-    0x9A, 0x13, 0xE2, 0xE7, 0x53, 0xCA, 0x13, 0x89, 0xF4, 0x8B, 0x44, 0xF8, 0x7E, 0x5A, 0x28, 0xEE,
-    0x06, 0x92, 0x2F, 0xD1, 0xD8, 0x63, 0xF4, 0xA2, 0xA8, 0x79, 0x8C, 0xDE, 0xDB, 0x15, 0x3A, 0xA3,
-    0x6A, 0xB8, 0xDF, 0x1D, 0x94, 0x4F, 0xED, 0x73, 0x96, 0x02, 0xF6, 0x91, 0xDB, 0x85, 0x06, 0xE4,
-    0xB3, 0xE4, 0xD3, 0xDD, 0x29, 0x3A, 0x89, 0x90, 0x1B, 0x2D, 0xE7, 0xA6, 0xE7, 0x62, 0x4D, 0x2E,
-    0xFA, 0xC9, 0x1E, 0x27, 0xC7, 0x07, 0xA5, 0xE7, 0x44, 0x4C, 0x3D, 0xB5, 0xCB, 0x19, 0x12, 0x30,
-    0x45, 0x61, 0xCC, 0xF6, 0xE4, 0x24, 0x72, 0xDD, 0x35, 0x0B, 0x0A, 0xB3, 0x3D, 0xF6, 0x85, 0x2A,
-    0x55, 0x11, 0x12, 0x21, 0x12, 0x51, 0xF9, 0x6C, 0x49, 0x05, 0xB9, 0xE8, 0xF7, 0xDB, 0xEF, 0xFF,
-    0x59, 0xDA, 0x9F, 0xA2, 0x54, 0xBB, 0x19, 0xF4, 0xB2, 0x3B, 0xB2, 0x44, 0x97, 0x6D, 0x36, 0x6E,
-    0x94, 0x7B, 0x31, 0x83, 0xE8, 0x8C, 0x02, 0x68, 0xCB, 0x52, 0x2D, 0x03, 0x4A, 0x7A, 0x44, 0x5D,
-    0xBD, 0x26, 0x2E, 0x19, 0x4C, 0x97, 0x66, 0x85, 0x38, 0x9F, 0xF9, 0x6D, 0xA2, 0xBD, 0x7E, 0x83,
-    0xE6, 0xDE, 0xEE, 0xF5, 0x49, 0xDB, 0x45, 0x94, 0x82, 0xFD, 0xBA, 0x35, 0x7D, 0x9B, 0x59, 0xD4,
-    0x50, 0x7A, 0x5E, 0x93, 0x4E, 0x71, 0x86, 0x86, 0x69, 0x7F, 0x4E, 0x0E, 0x25, 0xE3, 0x17, 0x70,
-    0xF1, 0x41, 0xEB, 0x79, 0x61, 0xB2, 0x0D, 0x11, 0x9C, 0x92, 0x44, 0x8A, 0xF8, 0x3B, 0xBB, 0xBC,
-    0x67, 0xE3, 0xF3, 0x23, 0x78, 0x9F, 0x8A, 0xA9, 0xE9, 0xBE, 0xF6, 0xE1, 0x0D, 0x6F, 0x2C, 0x6F,
-    0xB8, 0x59, 0x9C, 0x2D, 0x4C, 0x56, 0x5E, 0xA7, 0x46, 0x35, 0xA1, 0xF2, 0xFA, 0x26, 0xF6, 0x8A,
-    0x96, 0x09, 0x4E, 0x35, 0x1F, 0x48, 0xFD, 0x7F, 0x25, 0x15, 0x71, 0x9F, 0x4A, 0x77, 0xDC, 0x03,
-    0xF9, 0x6E, 0xEF, 0x66, 0x8D, 0x7B, 0x24, 0xA7, 0xED, 0x7E, 0xB5, 0x28, 0xA8, 0xF3, 0xB3, 0x78,
-    0x60, 0xDC, 0x58, 0x95, 0x2E, 0xB0, 0x78, 0x3F, 0xB5, 0x3C, 0x22, 0x3C, 0x1C, 0xCD, 0x0E, 0x99,
-    0xB3, 0x6C, 0x39, 0xAF, 0xBC, 0x90, 0x62, 0xDF, 0x88, 0xDB, 0x9C, 0x28, 0xA0, 0x7D, 0x86, 0x45,
-    0x7E, 0x3B, 0x1A, 0xC8, 0xC6, 0xA2, 0xF2, 0xF9, 0x6C, 0x9A, 0x50, 0xDE, 0x0D, 0xD6, 0x71, 0xDF,
-    0xDC, 0xA8, 0xCA, 0x4B, 0x41, 0x1F, 0x3E, 0x13, 0xB7, 0x19, 0xF3, 0x88, 0xD7, 0xCC, 0x36, 0x0F,
-    0xBE, 0x44, 0x7B, 0x84, 0xCC, 0xF8, 0xBF, 0x67, 0x86, 0xAE, 0x3A, 0xFC, 0x54, 0x6D, 0x13, 0x7D,
-    0xCC, 0xB6, 0x68, 0xE3, 0x9F, 0xB0, 0xB5, 0x5D, 0xF2, 0x06, 0xDB, 0xAC, 0x4F, 0x89, 0x3A, 0x80,
-    0x93, 0x5E, 0x53, 0x9B, 0x8C, 0x5B, 0x6A, 0xE3, 0xE9, 0x86, 0xDA, 0xC8, 0xDD, 0x56, 0x1B, 0xBA,
-    0x5E, 0x2D, 0x34, 0x53, 0x2D, 0xF6, 0x4E, 0x2D, 0x0D, 0x50, 0x6D, 0x55, 0xC3, 0x10, 0x81, 0x8E,
-    0x8B, 0x52, 0x35, 0x8B, 0xDA, 0x42, 0x9C, 0xE0, 0x17, 0x79, 0x8C, 0xEA, 0x0D, 0xA5, 0x51, 0x06,
-    0xDC, 0xB0, 0x09, 0xB0, 0x35, 0xC1, 0xE8, 0xD3, 0x15, 0x42, 0xAE, 0xC9, 0x37, 0x4E, 0xCD, 0x23,
-    0xEC, 0x09, 0xBF, 0x87, 0xD4, 0xD9, 0x14, 0x9D, 0x1A, 0x98, 0x3D, 0x1B, 0x58, 0xFC, 0x20, 0xA6,
-    0xF2, 0x41, 0xBC, 0xD4, 0x9A, 0xC1, 0xB5, 0x6A, 0x6C, 0xAF, 0x26, 0x1D, 0xD5, 0x24, 0x7E, 0xF6,
-    0xD0, 0x37, 0xC1, 0xF2, 0xAC, 0xCA, 0x37, 0xF4, 0x25, 0xA3, 0x52, 0x1B, 0xB2, 0x44, 0x64, 0xCB,
-    0xFC, 0x78, 0x03, 0xE4, 0xE0, 0x39, 0x58, 0x40, 0x10, 0x00, 0xAA, 0x5A, 0x38, 0x2D, 0x39, 0xFE,
-    0x92, 0x9E, 0x06, 0xB8, 0x6B, 0xA2, 0x7A, 0x7B, 0xA4, 0x45, 0x6F, 0x94, 0x8D, 0xF4, 0x5B, 0xE9,
-    0x9A, 0xB2, 0x96, 0x37, 0x3D, 0x85, 0x9E, 0xEA, 0xE3, 0x47, 0x69, 0x86, 0xC1, 0xCF, 0xE6, 0x81,
-    0x1F, 0xF1, 0x26, 0xDD, 0x58, 0xCB, 0x07, 0x29, 0xE8, 0x2D, 0xA8, 0x5E, 0xA8, 0xFC, 0x24, 0xEE,
-    0x11, 0x09, 0x34, 0xC5, 0x13, 0x2E, 0xD0, 0xC7, 0x74, 0x80, 0xFD, 0x27, 0x68, 0xBE, 0xE9, 0xE3,
-    0xFD, 0x4F, 0x21, 0x71, 0xCB, 0xF4, 0x38, 0xE7, 0xF3, 0x68, 0xAC, 0x9C, 0xFD, 0xE2, 0xE8, 0xCF,
-    0xB8, 0xFB, 0x33, 0xB2, 0xBA, 0xFB, 0x5D, 0xCA, 0xAA, 0x7F, 0x3E, 0x59, 0xA5, 0xD3, 0x09, 0xAC,
-    0x13, 0x9C, 0x10, 0x9E, 0x60, 0x2E, 0x23, 0x4C, 0xA7, 0x9C, 0x7B, 0xC9, 0xF2, 0x82, 0xAA, 0x7C,
-    0x1C, 0x4D, 0x2C, 0xF2, 0xCC, 0x17, 0xEF, 0xB0, 0x0E, 0x2C, 0x4F, 0x52, 0x2F, 0x55, 0x61, 0xAD,
-    0x7B, 0x7B, 0xC3, 0x06, 0x65, 0x3D, 0x92, 0x4B, 0x69, 0xBC, 0x5B, 0xAB, 0xE4, 0x01, 0xB9, 0x10,
-    0x84, 0xAC, 0x69, 0xED, 0x7F, 0x4E, 0xCD, 0x1F, 0xC8, 0x18, 0x2C, 0xD3, 0xCB, 0xD9, 0xAA, 0x78,
-    0xB1, 0x80, 0x73, 0x60, 0x9D, 0x15, 0x17, 0x95, 0xF4, 0x90, 0x68, 0xC6, 0x2C, 0x16, 0xF8, 0x5C,
-    0x64, 0x62, 0xA2, 0xB0, 0xB3, 0xC0, 0xA8, 0x79, 0x5D, 0x29, 0x4C, 0xE8, 0x08, 0x42, 0xAA, 0x06,
-    0xDC, 0x81, 0xCF, 0xD5, 0x8D, 0xF7, 0x10, 0x78, 0x5B, 0x9F, 0x63, 0x69, 0xC1, 0xAA, 0x0A, 0xC9,
-    0x94, 0x93, 0x05, 0xC5, 0x92, 0xC9, 0x20, 0xE5, 0x48, 0x78, 0x05, 0x64, 0x78, 0x7E, 0x53, 0x55,
-    0x60, 0xB6, 0x8B, 0x34, 0x91, 0xB4, 0xA9, 0x72, 0xD7, 0x5E, 0x6F, 0x0E, 0x29, 0x66, 0xD1, 0xB0,
-    0xB9, 0x2D, 0xFA, 0x37, 0xA0, 0xAB, 0x7D, 0x61, 0x58, 0xF3, 0xC2, 0x69, 0xE7, 0x15, 0xAD, 0x5C,
-    0x14, 0x0D, 0xFC, 0x00, 0xBB, 0xE7, 0x4B, 0x13, 0xA2, 0x53, 0xDC, 0xAA, 0x54, 0x12, 0x35, 0xBE,
-    0xA9, 0xBF, 0xCB, 0xC6, 0xAC, 0x9B, 0x46, 0x45, 0x42, 0xEC, 0x68, 0xCA, 0xC8, 0x30, 0xF9, 0x4A,
-    0xB1, 0xA3, 0xAC, 0x69, 0x02, 0x32, 0x14, 0xE5, 0xCE, 0xD8, 0xB5, 0x90, 0x69, 0xE1, 0x18, 0xBA,
-    0x29, 0x61, 0x0E, 0x56, 0x2B, 0x13, 0xCB, 0xA9, 0x7E, 0x99, 0x72, 0x80, 0x6D, 0x4D, 0xFA, 0xAE,
-    0xE6, 0x3C, 0x54, 0x98, 0xA4, 0x47, 0xEA, 0x02, 0x85, 0x4E, 0xA6, 0x04, 0xE9, 0xC8, 0x8A, 0x76,
-    0x32, 0x46, 0x4A, 0x13, 0x59, 0xD5, 0x8E, 0x1C, 0xD3, 0xB7, 0xD0, 0xA5, 0x4A, 0xA3, 0xF7, 0x64,
-    0x8F, 0x1F, 0x4A, 0x58, 0x0A, 0x84, 0x95, 0x68, 0xE1, 0x21, 0x93, 0x12, 0x61, 0xD5, 0x46, 0x90,
-    0x84, 0x91, 0x9F, 0xD1, 0x7C, 0x0F, 0x43, 0x27, 0xBE, 0xC9, 0x00, 0xD4, 0xE7, 0x84, 0xCE, 0x18,
-    0xE0, 0x5A, 0x6A, 0xC8, 0x7A, 0x32, 0xEB, 0x4B, 0x2A, 0x19, 0xE7, 0x2C, 0xC2, 0x13, 0x1C, 0x69,
-    0xF5, 0x8C, 0x8A, 0x46, 0x39, 0xC1, 0x20, 0x9E, 0x81, 0xE1, 0x46, 0xB2, 0x5D, 0x74, 0xE1, 0x67,
-    0x13, 0x39, 0x87, 0x2D, 0x7E, 0xEC, 0x8C, 0x4C, 0x33, 0xFE, 0xC8, 0x71, 0x15, 0xD9, 0x98, 0xFC,
-    0xBD, 0xBB, 0xAA, 0x62, 0x4F, 0x7A, 0xD5, 0xFD, 0xA2, 0xA3, 0x1D, 0x22, 0x00, 0x7C, 0xD4, 0xB1,
-    0xDC, 0xB3, 0x6D, 0xAA, 0xDF, 0x36, 0x5C, 0xCB, 0x96, 0x29, 0xBE, 0xA8, 0xB9, 0x1C, 0xA4, 0x77,
-    0x5F, 0xEA, 0xCD, 0xE0, 0x0D, 0x92, 0x81, 0x38, 0x51, 0xF5, 0x0E, 0x4C, 0x24, 0x6E, 0xD1, 0x06,
-    0x6F, 0xBE, 0x48, 0x95, 0xC3, 0xD9, 0x57, 0x06, 0x54, 0x44, 0xB0, 0xD4, 0x87, 0xD1, 0xE3, 0x27,
-    0xD6, 0x98, 0x7B, 0x56, 0x80, 0xC5, 0x7C, 0x2E, 0xFF, 0xBE, 0x4D, 0x29, 0x4C, 0x42, 0x14, 0x89,
-    0xD3, 0x49, 0x41, 0xE4, 0x7E, 0xD2, 0x48, 0x7E, 0x9F, 0x79, 0x47, 0xE0, 0x6D, 0xAD, 0xF0, 0x69,
-    0x60, 0x36, 0x9E, 0x4D, 0x03, 0x95, 0xE9, 0xCC, 0xF2, 0x73, 0xAB, 0x4E, 0x2A, 0x19, 0x35, 0x12,
-    0x70, 0x52, 0x5A, 0xA5, 0x36, 0xDE, 0xB7, 0x1C, 0x1A, 0x0A, 0x71, 0xC5, 0x38, 0x53, 0x33, 0x45,
-    0x0E, 0xD1, 0x15, 0x09, 0x1C, 0x1C, 0x92, 0x6A, 0xF6, 0x68, 0x20, 0xF6, 0x48, 0xFA, 0x10, 0xBB,
-    0x31, 0x21, 0x56, 0x6E, 0x08, 0x88, 0xB8, 0x11, 0x78, 0x2F, 0x39, 0x6F, 0x49, 0xAD, 0x0E, 0x05,
-    0x9C, 0x58, 0x91, 0x1C, 0x57, 0x92, 0x5B, 0xC8, 0xDD, 0x77, 0xB1, 0xE4, 0xF3, 0x96, 0x70, 0xC8,
-    0x2D, 0xB1, 0x3D, 0x9D, 0x70, 0x7D, 0x06, 0x2A, 0x7F, 0x05, 0x15, 0xFE, 0x49, 0xE5, 0x19, 0x32,
-    0x16, 0xB8, 0x32, 0xA7, 0x78, 0x4C, 0x42, 0xB8, 0xCC, 0x1D, 0x46, 0xDA, 0x0E, 0xD7, 0xB7, 0x4D,
-    0x0F, 0xB9, 0xE5, 0xC5, 0xAE, 0x9A, 0xA4, 0xD6, 0xC9, 0xA4, 0x51, 0xBE, 0x5F, 0x58, 0x89, 0x8B,
-    0xF5, 0x3D, 0x24, 0x2F, 0x8F, 0xAD, 0x3A, 0xF2, 0xD6, 0x98, 0xD7, 0xA8, 0xE1, 0xDB, 0xBC, 0xB9,
-    0x4D, 0x5F, 0x77, 0xD3, 0xB2, 0x6A, 0x47, 0x37, 0xE2, 0xC9, 0xA5, 0x5D, 0x00, 0x82, 0xB6, 0x3A,
-    0xDA, 0x81, 0xA2, 0x61, 0x2F, 0x5F, 0xC0, 0x3F, 0xE6, 0x99, 0xF7, 0x31, 0x27, 0x66, 0xDE, 0x51,
-    0x54, 0x3F, 0x54, 0x5D, 0x67, 0x4B, 0xA5, 0xF0, 0x4C, 0x55, 0x74, 0x96, 0xD3, 0x4B, 0x64, 0xE7,
-    0x34, 0x61, 0xD6, 0xCD, 0x95, 0x72, 0xF3, 0x90, 0xAD, 0x3F, 0x3B, 0x60, 0x4B, 0x45, 0x4B, 0x0E,
-    0xD0, 0x18, 0xC0, 0x31, 0x0E, 0xD0, 0x18, 0x63, 0x76, 0x77, 0x73, 0x88, 0xEF, 0x6D, 0x82, 0xD5,
-    0x56, 0x4F, 0xFD, 0x7F, 0xFF, 0xBB, 0xF6, 0x47, 0xAE, 0x75, 0xE2, 0xDC, 0xAC, 0x6A, 0x55, 0x13,
-    0x36, 0xB5, 0x44, 0x6D, 0xD7, 0x0D, 0xD6, 0x20, 0x78, 0xEA, 0x75, 0x83, 0x47, 0x60, 0x83, 0x4E,
-    0xFA, 0xB0, 0x8A, 0xB0, 0xE5, 0x22, 0x1A, 0xAC, 0x01, 0x1F, 0x74, 0x4C, 0xA6, 0x33, 0xB2, 0x1B,
-    0x7E, 0xCD, 0x17, 0x37, 0x05, 0x1E, 0x95, 0x1C, 0x5E, 0x3D, 0x38, 0x38, 0xC8, 0xDF, 0xD9, 0xA7,
-    0x43, 0x40, 0xC2, 0xC5, 0x32, 0x64, 0xC1, 0xD3, 0x40, 0x79, 0x29, 0x79, 0xAC, 0x48, 0x01, 0x86,
-    0xE9, 0xBA, 0xA2, 0x4C, 0xA4, 0xC8, 0x7A, 0x21, 0x5A, 0x57, 0xD3, 0x5F, 0x7E, 0x9F, 0x19, 0x3D,
-    0x34, 0x38, 0x9D, 0xDF, 0x40, 0xE4, 0xE9, 0xF1, 0x5D, 0xC1, 0xF2, 0x36, 0x0F, 0x9C, 0x40, 0x62,
-    0x7E, 0x24, 0xD4, 0xEB, 0x0B, 0x74, 0x71, 0x5F, 0x30, 0x12, 0xBF, 0x07, 0x5D, 0xE0, 0x11, 0xD8,
-    0xA5, 0x5D, 0xB3, 0x8E, 0x3E, 0xD0, 0xB7, 0x7C, 0x5D, 0xDF, 0xF6, 0x05, 0xB5, 0xC7, 0xE9, 0x05,
-    0xD2, 0x37, 0x55, 0xEE, 0x2C, 0x30, 0x1E, 0x96, 0x5C, 0x30, 0xDB, 0x6F, 0xC8, 0xB4, 0xAB, 0x3D,
-    0xA0, 0x88, 0xC8, 0x4A, 0xA9, 0x12, 0x43, 0xFE, 0x15, 0xD4, 0xDF, 0xF5, 0x3D, 0xFD, 0x28, 0xCE,
-    0x10, 0x6A, 0xB6, 0x02, 0xF9, 0x70, 0x07, 0x9B, 0x89, 0x3D, 0x04, 0xD8, 0x59, 0x48, 0xC1, 0x58,
-    0xEE, 0x86, 0x78, 0x8C, 0xC7, 0xB4, 0x8F, 0x26, 0xDB, 0x85, 0x23, 0xAE, 0xB6, 0x58, 0x2A, 0x62,
-    0x9B, 0x6B, 0xC9, 0x65, 0xAC, 0x2F, 0xD3, 0xFC, 0x11, 0xC0, 0xC8, 0x5F, 0x26, 0xEE, 0x2A, 0x1C,
-    0x3C, 0x9C, 0x4E, 0x41, 0xD7, 0xBF, 0xA3, 0x35, 0xE7, 0xFE, 0xA4, 0x87, 0x87, 0xAA, 0x5F, 0x07,
-    0xA5, 0x02, 0xD1, 0xAA, 0xD7, 0x0E, 0xCC, 0x15, 0x0B, 0x0F, 0xEC, 0x9F, 0x21, 0x6C, 0x34, 0x3A,
-    0x8F, 0x69, 0x54, 0xDF, 0x5D, 0x17, 0x1E, 0x8A, 0xF6, 0x2B, 0xA8, 0x2F, 0x75, 0x2C, 0x34, 0xD0,
-    0x0C, 0x2B, 0x95, 0x31, 0x2E, 0x57, 0xF4, 0x99, 0xC0, 0x13, 0x44, 0xBD, 0x99, 0xDB, 0x68, 0xC5,
-    0xCE, 0x99, 0xB2, 0xF2, 0x14, 0x8F, 0xAC, 0x7D, 0x6F, 0xCE, 0x81, 0x56, 0xCB, 0x39, 0x50, 0x71,
-    0xFC, 0x3E, 0x08, 0xD1, 0x4C, 0xF1, 0x10, 0x9A, 0x5F, 0x74, 0xEB, 0x98, 0x22, 0x92, 0xF5, 0x46,
-    0x67, 0x27, 0x29, 0x5C, 0xD3, 0x7B, 0x1F, 0x72, 0xAA, 0x91, 0x93, 0x52, 0x7D, 0xAF, 0xF1, 0x19,
-    0xEF, 0xB0, 0x2C, 0x84, 0x04, 0xEF, 0x0F, 0x2C, 0x0C, 0xCF, 0x86, 0x00, 0xDD, 0xF9, 0x58, 0x1A,
-    0xF8, 0x3A, 0x41, 0xC3, 0xEB, 0x65, 0xF7, 0xEB, 0x3C, 0x38, 0xF5, 0xFD, 0xF3, 0x5C, 0x5C, 0x5B,
-    0xE1, 0xC4, 0x5A, 0xE9, 0x8F, 0xB1, 0x83, 0x9D, 0x84, 0xCE, 0xB6, 0xC2, 0x22, 0xAA, 0x87, 0x3D,
-    0x76, 0x71, 0xD8, 0x49, 0x7A, 0x9D, 0x56, 0x22, 0x50, 0x9C, 0x21, 0x3C, 0x20, 0x8C, 0xA0, 0x0C,
-    0xD3, 0xF5, 0x7E, 0x39, 0xBF, 0xFE, 0x8F, 0x7F, 0xD5, 0xC1, 0xED, 0x52, 0x3F, 0x4C, 0x8E, 0x0F,
-    0xF6, 0x09, 0x99, 0x66, 0x42, 0x28, 0xC2, 0x57, 0xE0, 0x8E, 0xEC, 0xF8, 0x00, 0x40, 0x19, 0x91,
-    0xB2, 0x75, 0x2C, 0x7A, 0x12, 0x65, 0x12, 0x38, 0x15, 0x65, 0x71, 0xF7, 0xBC, 0xF3, 0x78, 0x37,
-    0xB8, 0x75, 0x9C, 0x9F, 0xD1, 0xF5, 0xF4, 0x1B, 0xEB, 0xFA, 0xB1, 0x87, 0x9D, 0x96, 0x1A, 0x5F,
-    0xA7, 0xD4, 0xF8, 0x52, 0x7A, 0x9F, 0x7F, 0x0B, 0x0A, 0x0F, 0x0D, 0xD4, 0x5B, 0xB8, 0x21, 0x01,
-    0xE3, 0x0C, 0x36, 0x8D, 0xF9, 0x5B, 0x9E, 0x3D, 0x85, 0xB4, 0x8D, 0x3C, 0x98, 0x4F, 0x6A, 0xBF,
-    0x05, 0xE1, 0x54, 0x1E, 0xB1, 0xCE, 0xF0, 0xEC, 0x7F, 0x4C, 0x8B, 0xD9, 0x78, 0x08, 0xF3, 0xA7,
-    0x66, 0x53, 0x09, 0x53, 0x79, 0x75, 0x79, 0xA5, 0x00, 0xB7, 0x44, 0x09, 0xDF, 0xCA, 0x8B, 0x13,
-    0x67, 0xD4, 0x2B, 0x96, 0x3C, 0x99, 0x9B, 0x55, 0xE5, 0x37, 0x93, 0xA7, 0xE8, 0x55, 0xE7, 0x36,
-    0x34, 0xB7, 0xAA, 0xE8, 0xDB, 0x9C, 0xF4, 0x03, 0xDE, 0xFD, 0x81, 0x32, 0x83, 0x37, 0x5B, 0xD2,
-    0xEB, 0x0A, 0x55, 0x95, 0xCF, 0x15, 0x46, 0x41, 0x01, 0x47, 0xFA, 0xBA, 0x76, 0xE4, 0x07, 0xD2,
-    0xB2, 0x5C, 0xFB, 0x92, 0x17, 0x0A, 0xE9, 0xD9, 0xCC, 0xD3, 0xA7, 0x58, 0x12, 0x08, 0xAA, 0x1A,
-    0xBC, 0x81, 0xB1, 0x94, 0x32, 0x79, 0x2E, 0xD1, 0x3D, 0x43, 0x9E, 0xAC, 0x82, 0x05, 0xAA, 0x33,
-    0xC0, 0x31, 0x15, 0xC2, 0x34, 0xD6, 0xFD, 0xAF, 0x3F, 0x09, 0x39, 0x76, 0xEE, 0xBE, 0xD7, 0x7A,
-    0xD8, 0x31, 0x44, 0x4B, 0xF5, 0x98, 0x18, 0x3B, 0xBC, 0x86, 0xE8, 0x0D, 0x37, 0xBD, 0x78, 0x71,
-    0x6F, 0x16, 0xFD, 0xE9, 0x36, 0x2A, 0x64, 0xBC, 0x16, 0x15, 0xC2, 0x44, 0x17, 0x16, 0x3E, 0xC5,
-    0x64, 0x27, 0x0E, 0xA5, 0xBA, 0xD9, 0x77, 0xA4, 0xBA, 0x8B, 0xBB, 0x6A, 0xFC, 0x56, 0xC5, 0x13,
-    0xCF, 0x54, 0xE1, 0x4C, 0xCA, 0xCC, 0x9F, 0x44, 0x43, 0x77, 0xC8, 0x29, 0x9D, 0x75, 0xD1, 0xE9,
-    0x07, 0x03, 0x9E, 0xF0, 0x23, 0x7F, 0x21, 0xD0, 0xAA, 0x8B, 0x3A, 0x27, 0x1C, 0xA6, 0x09, 0xFC,
-    0xAE, 0x67, 0x27, 0xEE, 0x8A, 0x6E, 0x6D, 0x62, 0xBD, 0x07, 0xDE, 0x12, 0xF1, 0xEB, 0xA8, 0xE8,
-    0x43, 0x86, 0x0D, 0xB1, 0x03, 0xB3, 0x89, 0xE7, 0x90, 0x66, 0xB2, 0x26, 0xE1, 0x59, 0xE2, 0x6F,
-    0xCC, 0xA1, 0x9F, 0xBC, 0xE6, 0xB0, 0xDE, 0xC2, 0x19, 0xC1, 0xB2, 0x81, 0xD4, 0x15, 0x90, 0xAE,
-    0x79, 0xE5, 0x7D, 0x8C, 0xE8, 0x54, 0xB3, 0x22, 0x90, 0x7B, 0xE7, 0xE0, 0x67, 0x1B, 0x33, 0xAA,
-    0x7A, 0xF8, 0x6A, 0xEF, 0xB7, 0x93, 0xF9, 0x3A, 0x7C, 0xF8, 0x8B, 0x88, 0x08, 0xA1, 0x22, 0x42,
-    0xBC, 0x89, 0x35, 0x40, 0xD8, 0x3C, 0x73, 0x3A, 0xF7, 0xF5, 0xC9, 0xFE, 0x4A, 0x49, 0x72, 0x21,
-    0x84, 0xFC, 0xCE, 0xC1, 0x81, 0xDF, 0x7E, 0x8B, 0x69, 0xB0, 0xF9, 0x19, 0x17, 0x56, 0x38, 0x64,
-    0x35, 0x1D, 0xCF, 0xFF, 0x9A, 0x02, 0x3A, 0x5D, 0x7F, 0x5F, 0x3F, 0xDF, 0x59, 0x93, 0xFC, 0x6B,
-    0xC8, 0x22, 0x05, 0x1E, 0x3E, 0x31, 0x65, 0xF5, 0xCF, 0x08, 0xFC, 0x6F, 0x89, 0xD2, 0x47, 0x80,
-    0xCC, 0xB5, 0xAD, 0x8B, 0x3C, 0xA9, 0xAB, 0x3C, 0xC9, 0xC9, 0x69, 0x25, 0xB3, 0xB8, 0x0B, 0x57,
-    0x30, 0x13, 0xB0, 0xD4, 0x0A, 0x36, 0xC8, 0x99, 0xFF, 0x02, 0x71, 0xEB, 0xD0, 0x24, 0xDD, 0x6C,
-    0x92, 0x96, 0x27, 0x4B, 0xF6, 0x11, 0x0B, 0x77, 0x83, 0x3F, 0x3E, 0x54, 0x0A, 0x90, 0xEB, 0x24,
-    0x96, 0xE7, 0x7A, 0x97, 0x7D, 0xFA, 0x58, 0xFE, 0xB1, 0xFB, 0xA9, 0x9E, 0xFF, 0xBC, 0x17, 0x97,
-    0x13, 0xB8, 0x7B, 0xC8, 0xD5, 0x15, 0xBB, 0x4A, 0x7F, 0xFA, 0xE0, 0xB3, 0x8E, 0xAB, 0xA0, 0x70,
-    0xA0, 0x19, 0x75, 0xD7, 0x6B, 0xF0, 0x37, 0xA6, 0xDE, 0x66, 0x32, 0xC1, 0x1C, 0x62, 0x6D, 0x58,
-    0x14, 0x7F, 0xBA, 0xE3, 0x3E, 0xE1, 0xCE, 0xB9, 0x68, 0x6D, 0x03, 0x15, 0xCB, 0xC2, 0x0B, 0x05,
-    0xDE, 0x0A, 0xF9, 0x0B, 0x1E, 0x02, 0x46, 0x7A, 0x76, 0x5A, 0x47, 0x19, 0x2B, 0x4B, 0x65, 0x82,
-    0x08, 0xCA, 0x01, 0x6D, 0xA6, 0x70, 0xBD, 0xAD, 0x1C, 0xE0, 0x8A, 0x8E, 0xF0, 0x79, 0x66, 0x99,
-    0x8C, 0x3A, 0xB1, 0x9E, 0x7C, 0x2E, 0xA4, 0x43, 0xAC, 0x65, 0xB7, 0x55, 0xCD, 0xF1, 0x09, 0xF7,
-    0xB0, 0xE2, 0xAF, 0x82, 0xD0, 0x86, 0x00, 0x77, 0x30, 0x89, 0x32, 0xEA, 0xCC, 0x2C, 0x2B, 0x1D,
-    0x00, 0x97, 0x03, 0xD9, 0xF8, 0xA0, 0xDF, 0x27, 0x8C, 0x04, 0xD1, 0xE0, 0x7C, 0x26, 0x9E, 0xAE,
-    0x9A, 0x9B, 0x6E, 0xC5, 0xE3, 0x80, 0xF6, 0xDF, 0x1D, 0x41, 0xB3, 0xED, 0x3A, 0xF7, 0x3A, 0xA6,
-    0xCD, 0x7E, 0xDF, 0x55, 0x9F, 0x60, 0xE2, 0xF4, 0x0F, 0x6D, 0xF1, 0x4B, 0xE6, 0x0E, 0x8F, 0x6A,
-    0xFB, 0x99, 0x0E, 0x17, 0xEB, 0xCC, 0x03, 0xCD, 0x5C, 0xF5, 0x1A, 0xFE, 0x88, 0x64, 0x3C, 0xD5,
-    0x02, 0xAE, 0x46, 0xCC, 0x87, 0x79, 0x92, 0x91, 0x7B, 0x8A, 0xCC, 0x3F, 0xD6, 0xB1, 0x19, 0xEB,
-    0xC2, 0x96, 0xBF, 0x7E, 0x43, 0x96, 0xB9, 0xAD, 0x39, 0x06, 0xAD, 0xA2, 0x3B, 0x55, 0x43, 0xE8,
-    0xF5, 0x8D, 0x4E, 0xDD, 0x3F, 0x51, 0x42, 0x23, 0xD5, 0x7C, 0x57, 0xEA, 0x3D, 0x32, 0x53, 0xE6,
-    0x41, 0x36, 0x3D, 0xCE, 0x3F, 0xA8, 0xD6, 0xF1, 0x31, 0x40, 0x01, 0xF0, 0x38, 0x93, 0x64, 0x10,
-    0xFE, 0xD2, 0x82, 0x55, 0xBF, 0x84, 0x25, 0xCD, 0x84, 0x76, 0x9C, 0x6A, 0xA7, 0xB8, 0x5C, 0x26,
-    0x6B, 0xCD, 0x0D, 0x02, 0xC3, 0xDB, 0x5C, 0x25, 0x53, 0xDD, 0x87, 0x4C, 0xD7, 0x8E, 0xDB, 0xC5,
-    0xAE, 0xA5, 0xDB, 0xA1, 0xCF, 0x66, 0xCD, 0x72, 0xAE, 0x6F, 0xB8, 0xC4, 0x40, 0xEB, 0x23, 0xAB,
-    0x91, 0x90, 0x14, 0x06, 0xBC, 0x2C, 0x99, 0x33, 0x30, 0xBF, 0xBA, 0xE3, 0xCB, 0x09, 0xCE, 0x93,
-    0xF4, 0xD7, 0xD7, 0x01, 0x5C, 0x78, 0x44, 0xF2, 0x0A, 0x0D, 0xFA, 0x4F, 0xE8, 0xEF, 0xFD, 0xCF,
-    0x43, 0xF4, 0x5B, 0x12, 0x7F, 0xCA, 0x38, 0xAC, 0x41, 0x19, 0x1F, 0x4B, 0xE8, 0x4B, 0x4E, 0x63,
-    0x1E, 0x41, 0x26, 0x65, 0x36, 0xED, 0x16, 0x0B, 0x8A, 0xF3, 0xC7, 0x8F, 0xBB, 0x9C, 0x1E, 0xCE,
-    0xFB, 0xC8, 0x9F, 0xEC, 0xB8, 0xFA, 0x6B, 0x2F, 0x3E, 0x4A, 0x45, 0x81, 0xC9, 0x4B, 0x74, 0x6F,
-    0xF6, 0x6B, 0x0A, 0x9E, 0x31, 0x4E, 0x17, 0x79, 0xB5, 0x33, 0xB2, 0xA8, 0x05, 0x6D, 0x0F, 0xCF,
-    0x7A, 0xED, 0x2E, 0x3F, 0x5D, 0x79, 0xDB, 0x79, 0x27, 0xF1, 0x2C, 0x28, 0xB8, 0x79, 0x0A, 0x73,
-    0x0B, 0x66, 0xD3, 0x7C, 0x1A, 0xD9, 0x7C, 0x26, 0x8C, 0x2C, 0xB5, 0xAA, 0x5B, 0xF3, 0xBA, 0x0C,
-    0xB8, 0xFE, 0xAD, 0x9E, 0x7E, 0x0A, 0x03, 0x55, 0x34, 0x76, 0xAF, 0x4D, 0xCD, 0x56, 0x38, 0x15,
-    0x48, 0xAA, 0x1C, 0x8B, 0x1C, 0x00, 0xBC, 0x17, 0xD8, 0xE5, 0xFF, 0x00, 0xD5, 0x5B, 0xBF, 0x93,
-    0xDF, 0x46, 0x15, 0x7F, 0x92, 0x72, 0x16, 0x13, 0x0D, 0x23, 0x17, 0xB1, 0x61, 0x12, 0x40, 0x0D,
-    0x05, 0x78, 0x88, 0xD5, 0xA6, 0xF0, 0x9D, 0xD6, 0x71, 0xE1, 0x82, 0x22, 0x57, 0xF8, 0x48, 0x41,
-    0x11, 0x4A, 0x26, 0xCC, 0x60, 0x0A, 0x8A, 0x14, 0xBE, 0x93, 0xFC, 0x1F, 0x5C, 0x43, 0x9F, 0x22,
-    0x45, 0x72, 0x9E, 0x21, 0x0D, 0xC5, 0x0D, 0x73, 0x3E, 0x29, 0x69, 0x52, 0xD0, 0x68, 0x18, 0x42,
-    0x43, 0x23, 0x18, 0x18, 0xC0, 0x0D, 0x22, 0x28, 0x89, 0x6C, 0x4B, 0x5A, 0x3E, 0x9F, 0xB7, 0xFA,
-    0x7E, 0xEF, 0xCE, 0xE7, 0x23, 0x0E, 0x24, 0x87, 0x4F, 0xF7, 0xD5, 0x5B, 0x59, 0xDA, 0xDD, 0xF7,
-    0x63, 0xF7, 0xFD, 0xD8, 0xB7, 0x6B, 0x91, 0xB4, 0xCE, 0xDA, 0x1C, 0x7F, 0x69, 0xED, 0x09, 0xAF,
-    0xB8, 0xC0, 0x5F, 0x15, 0x57, 0x09, 0xFE, 0xD2, 0x2A, 0xAD, 0xF1, 0xBD, 0xC1, 0x5F, 0xEB, 0x6A,
-    0xE5, 0xAD, 0xC8, 0xCF, 0x59, 0x6D, 0x77, 0x01, 0x52, 0xDB, 0x89, 0x67, 0xED, 0x24, 0xE1, 0xF4,
-    0x6B, 0x6B, 0xE2, 0x61, 0xD7, 0x9A, 0xA4, 0xDF, 0xB5, 0x92, 0x76, 0xBB, 0xBB, 0x92, 0xB5, 0xA8,
-    0x72, 0x22, 0x40, 0x15, 0x11, 0x54, 0xF6, 0x25, 0x1E, 0x77, 0x63, 0x09, 0xED, 0xFD, 0x92, 0x5D,
-    0x8D, 0xEC, 0xB4, 0x39, 0x8C, 0xC3, 0x01, 0x5E, 0x11, 0xB0, 0x49, 0x6E, 0xAD, 0x88, 0x7D, 0xD9,
-    0x16, 0xFE, 0x24, 0xB6, 0x0A, 0x46, 0x29, 0x0B, 0x80, 0x5C, 0x00, 0xCE, 0x13, 0x88, 0x04, 0x13,
-    0x80, 0x87, 0x5A, 0x72, 0xC9, 0xEE, 0xBC, 0x29, 0x99, 0x45, 0xB3, 0x0B, 0xE5, 0x87, 0xEB, 0x40,
-    0x5C, 0xCB, 0x0C, 0xD2, 0x25, 0xC8, 0x2A, 0x80, 0x9C, 0xDD, 0x8F, 0xEB, 0xF2, 0xA3, 0xC0, 0x4E,
-    0x3F, 0x68, 0x12, 0x6B, 0x6D, 0x93, 0x02, 0xD4, 0x97, 0x25, 0xB1, 0xE6, 0xBC, 0xC8, 0x73, 0x8A,
-    0xFF, 0xEB, 0x22, 0xDB, 0x5B, 0x37, 0xFF, 0xD4, 0xA2, 0xC7, 0x26, 0xFE, 0x38, 0x87, 0xAC, 0xA2,
-    0x2A, 0x91, 0x00, 0xB5, 0xF4, 0x6E, 0x52, 0x94, 0xB1, 0x89, 0xAA, 0xB8, 0x49, 0x0B, 0x34, 0x6F,
-    0xB6, 0xF2, 0x4F, 0xBB, 0xEF, 0x88, 0x10, 0x8B, 0x94, 0xB6, 0xB6, 0x1D, 0xDE, 0xD9, 0x3E, 0xB1,
-    0x92, 0x54, 0xD1, 0x04, 0x59, 0x07, 0x78, 0x12, 0x80, 0xCB, 0xA0, 0xB6, 0xB8, 0x02, 0xAE, 0xAA,
-    0x37, 0x40, 0x4A, 0x0D, 0x29, 0x67, 0xFF, 0x04, 0x48, 0xFE, 0x85, 0x96, 0xF1, 0xC3, 0x4A, 0xBC,
-    0xD7, 0xEC, 0x2F, 0x4C, 0x04, 0x7A, 0x8A, 0x73, 0x77, 0xEC, 0x8E, 0x61, 0x13, 0xF1, 0x5E, 0xB5,
-    0x1B, 0x8F, 0xBE, 0x73, 0x20, 0xB4, 0x05, 0xBA, 0xB2, 0x83, 0x03, 0xEB, 0xFD, 0xE1, 0xCB, 0xC9,
-    0xF1, 0x91, 0x77, 0x2B, 0x06, 0xF8, 0x47, 0x89, 0x1E, 0xD8, 0x02, 0xA3, 0x5E, 0x67, 0x26, 0xE6,
-    0x5D, 0x65, 0xE6, 0x59, 0x43, 0xE1, 0xA4, 0x10, 0x7A, 0x6C, 0x0D, 0x24, 0xD1, 0xC9, 0x66, 0x39,
-    0xC9, 0x5E, 0x64, 0x2B, 0x48, 0xBD, 0x2D, 0x31, 0x7A, 0x79, 0x15, 0x0C, 0x59, 0xEF, 0x0F, 0xB1,
-    0xBD, 0xDD, 0xFB, 0xF6, 0x41, 0x87, 0xD1, 0x69, 0x40, 0x40, 0x45, 0x36, 0xD0, 0xAA, 0xF9, 0x96,
-    0x04, 0x6D, 0x86, 0x1B, 0xC3, 0xD3, 0x64, 0x45, 0x58, 0xA7, 0x4D, 0x52, 0x44, 0x98, 0x2E, 0xF2,
-    0x93, 0x37, 0x49, 0xC8, 0x96, 0xDF, 0xDB, 0x6B, 0x03, 0x7E, 0xA5, 0xDF, 0xCB, 0xA1, 0xEB, 0xA6,
-    0xDD, 0x56, 0x46, 0x58, 0x93, 0xE3, 0x75, 0x13, 0x1D, 0x62, 0x64, 0x83, 0x16, 0x3F, 0xEF, 0x1D,
-    0x19, 0x04, 0x72, 0xB7, 0xCD, 0x9A, 0xC4, 0x66, 0x3F, 0xE8, 0x12, 0x49, 0xFC, 0x4E, 0xBA, 0xB8,
-    0xB8, 0x8C, 0xEF, 0xDB, 0x61, 0xB5, 0x1A, 0x62, 0xFA, 0x04, 0xD5, 0x95, 0xA8, 0x3E, 0x28, 0xEA,
-    0xA3, 0xC5, 0x5C, 0x65, 0x0D, 0x0D, 0x24, 0xAC, 0xD8, 0xFC, 0xDB, 0x51, 0x11, 0x9B, 0x49, 0x7E,
-    0xC5, 0xE1, 0xCB, 0x6C, 0x03, 0x9A, 0x9B, 0x73, 0x0F, 0x64, 0x4F, 0x80, 0x4B, 0xF0, 0x59, 0xB2,
-    0x6D, 0x9D, 0x2D, 0x91, 0x7D, 0x77, 0x72, 0xA3, 0xD9, 0x38, 0x49, 0x72, 0xA6, 0x95, 0x8D, 0xC4,
-    0x0F, 0x46, 0x89, 0xEB, 0x49, 0xCE, 0x15, 0x18, 0x81, 0x8B, 0x16, 0xF5, 0xA0, 0x03, 0xB5, 0xC5,
-    0xE4, 0xC2, 0xFD, 0x1E, 0x9E, 0x1F, 0x96, 0x26, 0x1E, 0xC1, 0x89, 0x41, 0x83, 0xEF, 0xCA, 0x9B,
-    0xB2, 0x17, 0x34, 0x7E, 0x1F, 0x57, 0x51, 0x9B, 0x15, 0x49, 0x53, 0x4A, 0xFE, 0x3E, 0x26, 0xF3,
-    0xB5, 0x41, 0x6F, 0x3E, 0x27, 0x75, 0x29, 0xFC, 0xC6, 0x3A, 0xAC, 0xCB, 0x36, 0x1B, 0x1B, 0x1B,
-    0xEB, 0x18, 0xEF, 0x9E, 0x37, 0x7A, 0x39, 0xE9, 0x5E, 0xCF, 0x6C, 0x4D, 0x0E, 0x6C, 0x73, 0x69,
-    0x67, 0xFB, 0x04, 0x89, 0x6E, 0xAB, 0x44, 0x87, 0x59, 0xA2, 0x78, 0xB3, 0x27, 0xD1, 0x07, 0x98,
-    0x4A, 0x2A, 0xD1, 0x1F, 0xB6, 0x31, 0xA6, 0xE5, 0xA6, 0xDF, 0x45, 0xC5, 0x8B, 0xB2, 0x29, 0x7D,
-    0x58, 0x5D, 0x91, 0x4D, 0xAF, 0x0F, 0x58, 0xF8, 0x2D, 0x8B, 0xAD, 0x1F, 0xD6, 0x10, 0x25, 0xC6,
-    0x9A, 0x12, 0x95, 0xCD, 0xCC, 0x15, 0x49, 0x11, 0x54, 0xAB, 0xB2, 0x19, 0xD5, 0x41, 0xF5, 0x2D,
-    0xD9, 0x0C, 0x5A, 0x48, 0x54, 0xF6, 0xBD, 0x1E, 0x12, 0xFD, 0x00, 0x73, 0x1F, 0xBA, 0xF1, 0xC7,
-    0x0D, 0x73, 0x61, 0x4F, 0x89, 0x54, 0x89, 0x16, 0xE0, 0x12, 0x12, 0x9D, 0xEE, 0x1C, 0x93, 0xE8,
-    0x05, 0xB0, 0x4A, 0xB5, 0xB5, 0xE6, 0xD2, 0xCE, 0xCE, 0x8E, 0x51, 0xC2, 0x0D, 0x06, 0x3C, 0x7B,
-    0xB5, 0xDB, 0x94, 0x61, 0x4F, 0xF6, 0xF0, 0xBB, 0x2B, 0x43, 0x76, 0xBD, 0x4B, 0x6C, 0xCB, 0xE9,
-    0x7E, 0x5E, 0x66, 0xEB, 0xF5, 0xD8, 0x1B, 0x1D, 0x0D, 0xBC, 0x37, 0x5E, 0xFB, 0xC5, 0xFA, 0x63,
-    0xEB, 0xAC, 0xB8, 0xE6, 0xC0, 0x7A, 0x63, 0x51, 0xD7, 0xDB, 0x80, 0x19, 0xAA, 0xF2, 0xA8, 0xDD,
-    0x0A, 0xBB, 0xB5, 0xA0, 0x93, 0xB0, 0x95, 0x08, 0xC3, 0x5C, 0xC9, 0x1A, 0x19, 0x08, 0xEA, 0x67,
-    0x12, 0xF9, 0xC6, 0xD6, 0xCE, 0x9E, 0xD6, 0x1E, 0x38, 0x09, 0x6E, 0x40, 0x3F, 0xAA, 0x4C, 0xEB,
-    0xBF, 0xE8, 0xEA, 0x27, 0x35, 0xD4, 0xD1, 0xBB, 0xD9, 0x48, 0xD0, 0x8B, 0x3F, 0xFC, 0xCC, 0x1F,
-    0xBA, 0xA0, 0x9F, 0x5E, 0x6B, 0x53, 0x6B, 0xBC, 0x75, 0xF1, 0x76, 0x0C, 0xBE, 0x46, 0x83, 0x24,
-    0x2D, 0x25, 0xB1, 0x49, 0xA3, 0x28, 0xB6, 0xC8, 0x5A, 0x0F, 0xBD, 0x7C, 0x7E, 0xD0, 0xF9, 0x04,
-    0x01, 0xC0, 0x00, 0xED, 0xCB, 0xEC, 0x2F, 0x39, 0x07, 0x86, 0x6C, 0x58, 0xCD, 0xDB, 0x68, 0x5C,
-    0x25, 0x7F, 0x5B, 0xB2, 0x30, 0x73, 0x0E, 0xA8, 0xE9, 0x23, 0xE5, 0x29, 0x27, 0x4D, 0xD4, 0xCC,
-    0x02, 0x58, 0xA7, 0x49, 0xE9, 0x53, 0x3B, 0x95, 0xDB, 0x99, 0x6D, 0xD7, 0x30, 0xC6, 0xED, 0x2A,
-    0xC6, 0xE6, 0x38, 0xD0, 0x0F, 0x19, 0x41, 0x42, 0x10, 0x12, 0x88, 0x47, 0x20, 0xFF, 0x03, 0xF0,
-    0x80, 0x12, 0xB2, 0xCB, 0x8C, 0xE4, 0x6D, 0xD6, 0xCB, 0xEB, 0x6F, 0x5E, 0x7A, 0x6B, 0x45, 0xF2,
-    0x0A, 0x66, 0xB3, 0x29, 0xEB, 0xD4, 0x78, 0xB0, 0x73, 0x95, 0x84, 0x10, 0xEF, 0xA4, 0x7C, 0x64,
-    0xE6, 0x3C, 0x74, 0x67, 0x94, 0xEC, 0xCF, 0x6A, 0xA2, 0xE9, 0x86, 0x24, 0xDF, 0x97, 0x97, 0xF6,
-    0x45, 0x4E, 0xF8, 0x5D, 0xB0, 0xD0, 0x0F, 0x72, 0xEC, 0x43, 0x21, 0x12, 0x0C, 0x5D, 0x56, 0x4C,
-    0x52, 0x9A, 0x52, 0xF0, 0x67, 0xAC, 0xE4, 0xB8, 0xDD, 0xBF, 0x72, 0x68, 0x72, 0xFA, 0xFB, 0x01,
-    0x8C, 0x41, 0x34, 0x17, 0x44, 0x7E, 0xEC, 0x6F, 0xCB, 0x1A, 0xE6, 0x6D, 0x6A, 0x06, 0x68, 0xBA,
-    0x6A, 0x27, 0x6C, 0x5F, 0xDA, 0xF8, 0x53, 0xDC, 0xF1, 0xC6, 0x73, 0xCB, 0x77, 0xFC, 0xC6, 0x3A,
-    0xAC, 0xCB, 0x36, 0xB3, 0xEB, 0xF0, 0x06, 0x5A, 0x1A, 0x0E, 0x38, 0x67, 0xDC, 0x5D, 0x14, 0x09,
-    0x7C, 0x29, 0x0A, 0xF0, 0x4B, 0x45, 0xBC, 0xE5, 0x8A, 0x5E, 0x0B, 0xAF, 0xD5, 0x22, 0x68, 0xB4,
-    0x08, 0x2B, 0x2D, 0xE2, 0x62, 0x85, 0x45, 0x42, 0x87, 0x85, 0xEE, 0xA5, 0xAC, 0x2E, 0x4E, 0xEB,
-    0xB7, 0x30, 0xF8, 0x18, 0x89, 0x3E, 0xF8, 0x47, 0x45, 0xE1, 0x45, 0x29, 0x8A, 0xA0, 0xF9, 0x26,
-    0x8B, 0xB0, 0x7A, 0x89, 0x45, 0x5C, 0xB4, 0x2C, 0x12, 0xFF, 0x41, 0xF9, 0x37, 0x60, 0x0B, 0xD4,
-    0xC3, 0x02, 0x1B, 0x5F, 0xF6, 0x5A, 0x00, 0x9B, 0x97, 0xFF, 0x8E, 0xD8, 0x02, 0x9D, 0xCA, 0x7A,
-    0xCD, 0x54, 0xA3, 0x6E, 0x64, 0x24, 0x1A, 0x95, 0xDC, 0xAD, 0x51, 0xC9, 0x7D, 0xC3, 0x75, 0x40,
-    0x83, 0xDC, 0x6B, 0xA1, 0xE4, 0x8E, 0x8E, 0xDC, 0xD1, 0x91, 0x3B, 0xAA, 0x5E, 0xA1, 0x48, 0xA0,
-    0x48, 0x28, 0xD6, 0x12, 0x5B, 0xA3, 0xB8, 0x05, 0x95, 0xBD, 0x68, 0xD7, 0xFB, 0x2C, 0xE8, 0x33,
-    0xFB, 0x71, 0x9B, 0x42, 0x33, 0x14, 0x6F, 0xA7, 0xC2, 0x81, 0xCE, 0xB0, 0x59, 0x5C, 0x29, 0xB6,
-    0x54, 0x14, 0x1B, 0x0C, 0x06, 0xB0, 0xF9, 0xCD, 0x33, 0xC4, 0x16, 0x9B, 0xAF, 0x12, 0xDB, 0xDA,
-    0xCE, 0x1E, 0x9B, 0xE5, 0x56, 0x85, 0x93, 0x2F, 0xA9, 0x86, 0x12, 0xF2, 0x82, 0x22, 0x4A, 0x54,
-    0x08, 0x94, 0x51, 0x12, 0x23, 0x50, 0x48, 0xC9, 0x44, 0xA8, 0x94, 0x9B, 0xB4, 0x24, 0x2D, 0xE5,
-    0x0C, 0xE5, 0xF4, 0x3A, 0xF5, 0x97, 0x34, 0x7F, 0x50, 0xD2, 0x90, 0xFA, 0x10, 0xD0, 0xDA, 0x62,
-    0x6A, 0x0C, 0x89, 0x79, 0x4E, 0xA0, 0xB0, 0x99, 0x58, 0x81, 0xD2, 0x6E, 0xFA, 0x56, 0xA0, 0xB8,
-    0xD0, 0x2C, 0xD8, 0x84, 0xAB, 0x5D, 0x8C, 0x38, 0x65, 0x3D, 0x68, 0xBF, 0x57, 0xB2, 0xB7, 0xFA,
-    0xE7, 0x2C, 0xE2, 0xAA, 0x61, 0x91, 0x5C, 0xAB, 0x58, 0x64, 0xD1, 0x3D, 0x0B, 0xF7, 0xB6, 0x19,
-    0x33, 0xF0, 0x20, 0x36, 0xBC, 0x24, 0xB6, 0x52, 0xED, 0xED, 0x8A, 0x5D, 0x47, 0x33, 0x78, 0xD4,
-    0x76, 0x21, 0x6B, 0xF5, 0x7D, 0x9C, 0xD1, 0x70, 0x1B, 0x6A, 0xEB, 0x48, 0xCA, 0xB8, 0x30, 0x86,
-    0x87, 0xAE, 0x8E, 0x3C, 0xF6, 0x0B, 0xC0, 0xB9, 0x24, 0x25, 0x1D, 0x19, 0x9C, 0x33, 0x82, 0x28,
-    0xEA, 0x32, 0x5F, 0x65, 0xAC, 0x96, 0xB5, 0x0A, 0xFC, 0xB7, 0x08, 0x26, 0xF8, 0x70, 0xB0, 0x1A,
-    0x93, 0x83, 0xC0, 0xBE, 0x3B, 0xCE, 0xD6, 0x56, 0xC5, 0x75, 0xEE, 0x1D, 0xED, 0x5A, 0x91, 0x32,
-    0x6A, 0x2A, 0xB4, 0xD4, 0x18, 0x09, 0x28, 0x1C, 0x8D, 0x24, 0xFE, 0xD8, 0x15, 0x39, 0xA9, 0x2B,
-    0x5E, 0xCA, 0xDC, 0xB5, 0x73, 0xC5, 0x9A, 0xEB, 0x66, 0x8F, 0x81, 0x00, 0xC6, 0xCD, 0xD6, 0xDA,
-    0x49, 0xCE, 0x09, 0xE2, 0xB7, 0x4A, 0x1A, 0xC2, 0x01, 0x76, 0x0A, 0xE7, 0xAB, 0xAC, 0x54, 0xF1,
-    0xE0, 0xA2, 0x4F, 0xF6, 0x96, 0xC0, 0x29, 0x68, 0x5F, 0x8C, 0xF4, 0x9C, 0x1F, 0x10, 0xB9, 0x0B,
-    0x8D, 0x75, 0x3E, 0x0B, 0x05, 0x09, 0x02, 0x07, 0x3E, 0x7A, 0xCA, 0x9D, 0x07, 0x43, 0x6F, 0x24,
-    0x36, 0x1F, 0xC0, 0x1A, 0x22, 0x0C, 0x5B, 0xE1, 0x07, 0xF9, 0x13, 0xFF, 0xF3, 0x6F, 0x39, 0xD2,
-    0x1C, 0x13, 0xA5, 0xE3, 0xCC, 0xD1, 0x19, 0xB8, 0xA8, 0x23, 0xAC, 0xCF, 0x30, 0x7F, 0xE7, 0xDE,
-    0x76, 0x74, 0x4E, 0x33, 0x81, 0x46, 0xB9, 0x4C, 0x75, 0x22, 0xF7, 0xA1, 0xD2, 0x52, 0x4B, 0x77,
-    0x76, 0xF9, 0x9B, 0x2D, 0x91, 0x45, 0xDC, 0xC1, 0xA9, 0x7E, 0x7F, 0x50, 0x3D, 0xA1, 0x66, 0x49,
-    0x7C, 0x55, 0x83, 0x86, 0x15, 0xB9, 0x6C, 0xCE, 0xF0, 0xFC, 0x9C, 0x6D, 0x40, 0xA4, 0x16, 0x68,
-    0x88, 0xDB, 0x83, 0x02, 0x71, 0x75, 0x23, 0x27, 0x5D, 0x67, 0x8B, 0x3F, 0xF5, 0x21, 0xEC, 0xAD,
-    0xD4, 0xE2, 0x4A, 0xA4, 0x04, 0xBE, 0x11, 0x16, 0x87, 0xFE, 0x95, 0xDA, 0x93, 0x39, 0x5A, 0x3D,
-    0xCA, 0x51, 0x59, 0x7D, 0x19, 0x1C, 0xD5, 0x4F, 0xC6, 0x11, 0xA2, 0x68, 0x17, 0x82, 0xEB, 0x83,
-    0x0E, 0xC3, 0x3E, 0x96, 0x61, 0xFA, 0xF0, 0x09, 0xE8, 0xE4, 0x83, 0xFF, 0x11, 0x1E, 0xE8, 0xBB,
-    0x82, 0xDF, 0xCE, 0x0F, 0xD1, 0xFB, 0x78, 0xE0, 0x64, 0x8E, 0x5F, 0x9E, 0x8D, 0x6C, 0xEA, 0xCF,
-    0x0F, 0xAB, 0x8B, 0x87, 0xC1, 0xB7, 0x1F, 0x6E, 0x28, 0x67, 0x3E, 0x57, 0x76, 0x64, 0xCA, 0xB7,
-    0xF7, 0x18, 0x01, 0x87, 0xD5, 0x5C, 0x27, 0xBE, 0x77, 0xC7, 0x3D, 0x24, 0xAE, 0x06, 0x06, 0x7B,
-    0xE3, 0xD5, 0x59, 0x38, 0x32, 0xD7, 0xE9, 0xF5, 0x21, 0x21, 0x37, 0x7C, 0x48, 0xC9, 0x0F, 0x1F,
-    0x32, 0xC1, 0xB4, 0x0A, 0xF0, 0x50, 0x22, 0x26, 0x36, 0x25, 0xA9, 0x3F, 0x78, 0x98, 0x5D, 0x68,
-    0x89, 0xB8, 0x28, 0x26, 0x7B, 0x79, 0x93, 0x4C, 0x70, 0x07, 0x81, 0x85, 0xE7, 0xF0, 0x2D, 0xC4,
-    0xE8, 0x0D, 0x14, 0xE9, 0xB6, 0xF3, 0x31, 0xFD, 0x51, 0xD0, 0x2D, 0xC1, 0xD1, 0x0F, 0x5A, 0x39,
-    0x19, 0x16, 0xF6, 0x89, 0x5E, 0x26, 0xA2, 0xD4, 0x53, 0x29, 0xEF, 0xFF, 0x60, 0xC4, 0x88, 0x5B,
-    0xD2, 0xCA, 0xB5, 0x49, 0xB4, 0xBD, 0x08, 0x43, 0xDD, 0x4C, 0x29, 0x17, 0xE0, 0x2A, 0x1B, 0xDA,
-    0x85, 0xAF, 0xBB, 0xA4, 0xEB, 0x46, 0xED, 0x51, 0xC2, 0xF1, 0x90, 0x29, 0x57, 0x83, 0x77, 0xCC,
-    0x92, 0x73, 0xA8, 0xC7, 0x19, 0x7A, 0xB6, 0xF6, 0x26, 0x1D, 0xE5, 0xB5, 0x63, 0xF0, 0x39, 0x85,
-    0xF2, 0x08, 0xFC, 0xCB, 0x86, 0xE1, 0x22, 0x9A, 0x63, 0x8E, 0x51, 0x28, 0x1E, 0x5B, 0xE7, 0x28,
-    0xC4, 0x44, 0x06, 0x8C, 0x67, 0x08, 0x8C, 0x88, 0x2F, 0x89, 0xDD, 0xCE, 0x10, 0xB5, 0xD8, 0x8F,
-    0x73, 0xD9, 0x33, 0x03, 0xAA, 0xEA, 0x5C, 0x04, 0xE0, 0xDA, 0x94, 0xA7, 0x9D, 0xFE, 0xD7, 0x8B,
-    0x65, 0x83, 0x40, 0x43, 0x98, 0xF8, 0x4F, 0xBA, 0x8A, 0x28, 0xB8, 0xAC, 0x58, 0x65, 0xC0, 0xF5,
-    0x94, 0xCB, 0x5F, 0x45, 0x5E, 0x67, 0x9C, 0x45, 0x6D, 0x5E, 0x10, 0x96, 0x85, 0xBE, 0x79, 0x8C,
-    0x0F, 0x79, 0xEA, 0xE8, 0xE7, 0xF4, 0xE7, 0x82, 0x8D, 0xC6, 0x5F, 0x33, 0x5C, 0x9C, 0x36, 0x51,
-    0x75, 0x98, 0x5E, 0xC3, 0xDB, 0xE7, 0xD0, 0xB0, 0xD7, 0x2F, 0xE0, 0xF6, 0x60, 0xE9, 0x17, 0xFD,
-    0x72, 0xDD, 0xAA, 0x59, 0x26, 0x9A, 0x82, 0x14, 0xFA, 0x98, 0x9B, 0x43, 0xF9, 0xB9, 0x53, 0xC0,
-    0xCF, 0xE9, 0x67, 0xB9, 0x52, 0x81, 0x75, 0xFE, 0x68, 0xD0, 0x69, 0xB7, 0x8A, 0x65, 0xC1, 0xA9,
-    0xE1, 0xE7, 0xB4, 0xA9, 0xF6, 0x11, 0x1F, 0x5B, 0xBD, 0x93, 0xAA, 0x7C, 0x74, 0xBE, 0x7C, 0xA9,
-    0xF8, 0x71, 0xFF, 0xDD, 0xCD, 0xCA, 0x0E, 0x76, 0xB3, 0xBE, 0xC9, 0x54, 0x68, 0x4D, 0x83, 0x8A,
-    0x7A, 0x65, 0x4B, 0x08, 0x2B, 0x0C, 0x08, 0xBB, 0x0B, 0x98, 0x28, 0x84, 0xE9, 0x26, 0x9C, 0x2E,
-    0xD8, 0xBF, 0x98, 0x78, 0x82, 0xC9, 0xAD, 0xE3, 0xE9, 0x79, 0x7B, 0x6F, 0x1B, 0x16, 0x59, 0xDF,
-    0x1F, 0xC0, 0x64, 0x3C, 0x68, 0x0B, 0xF3, 0x0D, 0x98, 0x6B, 0x9F, 0x20, 0x80, 0x58, 0x38, 0x1F,
-    0x93, 0x69, 0xC6, 0x0E, 0x38, 0x19, 0x59, 0xE6, 0x4E, 0xE0, 0x2D, 0x34, 0x4A, 0x9B, 0x98, 0x67,
-    0x08, 0x1E, 0x5A, 0xCD, 0xC3, 0xD6, 0xA5, 0x2E, 0x56, 0x4C, 0xB4, 0x7D, 0x5C, 0xAF, 0xE0, 0x8D,
-    0x98, 0xA4, 0xAA, 0x59, 0x78, 0x90, 0x16, 0x17, 0xC8, 0x74, 0xAA, 0xF8, 0x59, 0xB7, 0xB2, 0xA4,
-    0x4F, 0x42, 0xF1, 0x10, 0xDC, 0xF1, 0x3D, 0x88, 0x60, 0x01, 0x8A, 0x58, 0x80, 0x48, 0x16, 0xA0,
-    0x9B, 0x45, 0x68, 0x0D, 0x0B, 0x08, 0x42, 0x7B, 0xB0, 0x8D, 0x16, 0x59, 0xA7, 0x45, 0x32, 0x68,
-    0x11, 0xBB, 0xDE, 0x03, 0x57, 0x78, 0x33, 0xAE, 0xD2, 0x15, 0xE0, 0x96, 0x04, 0x20, 0x74, 0x20,
-    0x49, 0x11, 0x0B, 0xCD, 0xDB, 0xC8, 0xB3, 0x6F, 0x1F, 0xAC, 0x8E, 0x3C, 0x37, 0xFE, 0x9A, 0x30,
-    0x9E, 0x97, 0x46, 0xC7, 0x56, 0x46, 0xF0, 0x9F, 0x46, 0x7D, 0x33, 0xFB, 0x6E, 0x10, 0x75, 0xA8,
-    0xD8, 0x0A, 0x76, 0x50, 0xD6, 0x8C, 0x45, 0xB2, 0x96, 0xCE, 0x2B, 0xEB, 0xE8, 0x19, 0xD3, 0x81,
-    0x4E, 0x32, 0x59, 0x40, 0xE6, 0x59, 0xC7, 0xC7, 0xC0, 0x43, 0x75, 0x5C, 0x2B, 0xED, 0xA1, 0x77,
-    0xBD, 0x69, 0x26, 0x04, 0x51, 0x82, 0x61, 0x14, 0x63, 0x1B, 0x22, 0x52, 0xAF, 0x4A, 0xB7, 0x4A,
-    0x73, 0xE7, 0xB9, 0x35, 0xA4, 0xF3, 0x9B, 0x1A, 0x2F, 0x89, 0xBE, 0x77, 0x0B, 0x4C, 0xC7, 0x45,
-    0x5C, 0x9C, 0x0D, 0x2E, 0x9E, 0xD5, 0x95, 0x9C, 0x66, 0xAD, 0xA4, 0xD4, 0x24, 0xFF, 0x48, 0xAB,
-    0x1D, 0xB4, 0x31, 0x13, 0x89, 0x85, 0xDF, 0x9C, 0x09, 0x2E, 0x34, 0x49, 0x81, 0x4A, 0xBB, 0x5C,
-    0xC7, 0x7C, 0xC2, 0x6E, 0xFF, 0x41, 0x6B, 0x91, 0xF8, 0xD4, 0xF7, 0x15, 0xF9, 0xE9, 0x19, 0x99,
-    0x51, 0xBA, 0x7E, 0x6E, 0x13, 0x28, 0x43, 0xD4, 0x6B, 0x6A, 0xBC, 0x67, 0xD2, 0xC0, 0xBD, 0x39,
-    0x7E, 0x3D, 0x95, 0x5C, 0x3C, 0x23, 0x52, 0xAC, 0x89, 0xDF, 0x64, 0x45, 0xD4, 0x70, 0xCF, 0x26,
-    0xE8, 0xF7, 0x9D, 0x11, 0xCA, 0x1A, 0xE7, 0xDD, 0x4A, 0x58, 0xD9, 0x7E, 0x44, 0x58, 0x9A, 0x99,
-    0xB4, 0x88, 0xEB, 0x35, 0xB0, 0xF7, 0x15, 0xB4, 0x39, 0x60, 0x2B, 0x51, 0xCE, 0xB6, 0x94, 0xB3,
-    0xE1, 0x80, 0x33, 0x5F, 0x39, 0x0B, 0x2C, 0x39, 0x8B, 0x2C, 0x39, 0x8B, 0x73, 0x72, 0x96, 0x2A,
-    0x67, 0x57, 0x94, 0xEA, 0x5D, 0xE5, 0xAC, 0x25, 0x37, 0x7E, 0x43, 0x18, 0x56, 0x84, 0x5C, 0xB1,
-    0x64, 0x7D, 0xA2, 0x9C, 0xAD, 0x2A, 0x67, 0xB7, 0x94, 0xB3, 0x8E, 0x9C, 0x61, 0x9E, 0x80, 0x33,
-    0xDA, 0xE5, 0x46, 0x8D, 0xFE, 0x82, 0xB3, 0x4C, 0x39, 0x5B, 0x53, 0xCE, 0x76, 0x75, 0x7C, 0xDC,
-    0x18, 0xF9, 0x3B, 0x8B, 0xC5, 0xB3, 0x2C, 0x93, 0xBE, 0x8B, 0x80, 0x13, 0xAB, 0x4B, 0xC7, 0xC3,
-    0xE6, 0xB1, 0xC1, 0xCA, 0xAD, 0xF5, 0xE0, 0x6C, 0xE6, 0x22, 0x80, 0x29, 0x44, 0x60, 0xCE, 0x4E,
-    0xC2, 0xDA, 0x15, 0xD5, 0x97, 0x59, 0xC8, 0xA2, 0xA8, 0x35, 0x15, 0x58, 0x6A, 0x16, 0x4F, 0xB2,
-    0x51, 0x57, 0x03, 0xF1, 0x9C, 0x6E, 0x2F, 0x5D, 0xC8, 0xB4, 0x98, 0x8B, 0xCF, 0x1E, 0xC9, 0xF1,
-    0xE4, 0x4F, 0x96, 0xE3, 0x39, 0x73, 0x6C, 0xFA, 0xEF, 0xCC, 0xDB, 0xA0, 0xCB, 0x34, 0x27, 0x79,
-    0x7E, 0x45, 0xCD, 0xDE, 0xA8, 0x59, 0x44, 0xAF, 0xD5, 0xD4, 0xEC, 0x19, 0x1F, 0x4D, 0x77, 0xED,
-    0xFB, 0x3A, 0x9A, 0x36, 0xD0, 0x79, 0x6A, 0x43, 0xB7, 0xD0, 0x0E, 0xFA, 0x13, 0xF2, 0x21, 0x67,
-    0x8F, 0x4D, 0xE7, 0x93, 0xCB, 0x27, 0xF3, 0xC9, 0xE8, 0x22, 0xD4, 0xCD, 0xA6, 0xC8, 0x0E, 0x31,
-    0x90, 0x65, 0x35, 0x37, 0xBE, 0x60, 0xB3, 0xF8, 0xAC, 0x54, 0xAC, 0x2A, 0xDA, 0x3D, 0xD5, 0x82,
-    0x8E, 0xE6, 0x90, 0xC9, 0x8C, 0x78, 0x0C, 0x74, 0xDB, 0x92, 0x6B, 0x84, 0xC0, 0xBE, 0x62, 0x68,
-    0xFF, 0xDE, 0xD5, 0xFE, 0x14, 0x57, 0x3E, 0x1C, 0xA8, 0xCD, 0x7F, 0x86, 0x79, 0xEF, 0x72, 0x0E,
-    0x8D, 0xDA, 0xD1, 0x56, 0x5C, 0x34, 0x9C, 0xA9, 0xC9, 0xF1, 0x5D, 0x2E, 0x7B, 0xB1, 0xEA, 0x59,
-    0x57, 0x72, 0x75, 0x17, 0xFA, 0x9E, 0x8B, 0x83, 0x69, 0x9E, 0x19, 0x76, 0x12, 0x46, 0x1A, 0xB3,
-    0x86, 0x33, 0x34, 0x87, 0x9E, 0xF5, 0xAB, 0xD6, 0x89, 0xB5, 0x3E, 0x11, 0xDB, 0x87, 0x1A, 0x05,
-    0x2B, 0xB5, 0xF6, 0xCF, 0x4B, 0x2C, 0x9E, 0x26, 0xFE, 0x0E, 0xD3, 0x30, 0xE7, 0x79, 0x43, 0xCB,
-    0xEF, 0xE9, 0xFD, 0x84, 0xF9, 0xF6, 0x9A, 0x53, 0x47, 0x0F, 0x0A, 0x20, 0x74, 0xF3, 0x98, 0xC6,
-    0x00, 0x34, 0x0E, 0xE6, 0xD6, 0xA4, 0x84, 0x57, 0xED, 0x3D, 0xF3, 0x35, 0x7B, 0x6D, 0x24, 0x17,
-    0xD7, 0xB9, 0xD9, 0x6B, 0xBF, 0x7F, 0x08, 0x5E, 0x07, 0x02, 0xDF, 0x5E, 0xD3, 0x68, 0xDB, 0x58,
-    0xDA, 0x76, 0xB4, 0xAA, 0x00, 0x43, 0xAB, 0xBE, 0x25, 0x6F, 0x7D, 0xFB, 0x32, 0x96, 0x90, 0x3E,
-    0x44, 0x1B, 0x13, 0x56, 0x71, 0x0B, 0x31, 0x37, 0x69, 0x53, 0xDA, 0xEB, 0x13, 0x73, 0x46, 0x57,
-    0x75, 0xC7, 0x95, 0x7B, 0xEC, 0x6A, 0x8C, 0x5D, 0x86, 0x46, 0x93, 0xD0, 0x49, 0xBB, 0xB4, 0x4E,
-    0x4B, 0x9D, 0xE5, 0xD4, 0xD0, 0x69, 0x12, 0xD2, 0xA2, 0xC7, 0xCC, 0xB8, 0xC4, 0x1D, 0x64, 0x12,
-    0xAA, 0x3F, 0x3B, 0x1F, 0x2E, 0xF6, 0x07, 0x2E, 0xDE, 0x21, 0x37, 0x88, 0x90, 0x93, 0xE9, 0x3A,
-    0x56, 0x22, 0x1D, 0xDE, 0xE5, 0x2D, 0x41, 0xA3, 0x20, 0xE2, 0x3F, 0x63, 0x7E, 0xC8, 0x51, 0xC5,
-    0xFE, 0x8B, 0x5E, 0xE2, 0x36, 0x86, 0xC2, 0xE5, 0x52, 0x35, 0xA6, 0xE5, 0xAE, 0xBE, 0x33, 0x94,
-    0x94, 0xA1, 0xDB, 0x82, 0xA8, 0x4F, 0x93, 0x0C, 0x35, 0x66, 0xB1, 0xD5, 0xBC, 0x1F, 0x64, 0x92,
-    0xBF, 0x02, 0xEC, 0x43, 0x00, 0x41, 0x37, 0xCB, 0x05, 0xE5, 0x69, 0x90, 0x71, 0xC1, 0xCD, 0xA9,
-    0xCB, 0xE8, 0x60, 0xBC, 0x0B, 0x15, 0xD1, 0x3D, 0x25, 0x7C, 0x5C, 0x31, 0x2F, 0x14, 0xA7, 0x39,
-    0x28, 0x9A, 0xFE, 0x0B, 0x5B, 0xF1, 0xA7, 0x08, 0x32, 0x98, 0xE2, 0xCE, 0xFD, 0xF3, 0x70, 0x08,
-    0x75, 0x5A, 0x64, 0x68, 0x5A, 0x2A, 0xE1, 0xA0, 0xAC, 0xD2, 0xA4, 0x5D, 0x09, 0xAA, 0xF9, 0x49,
-    0xDF, 0xCD, 0x59, 0xB7, 0x53, 0x22, 0x08, 0x38, 0x56, 0x14, 0xCB, 0x6D, 0xA0, 0xE0, 0xDE, 0x34,
-    0x54, 0x3E, 0x46, 0x20, 0x54, 0x23, 0x6A, 0xEC, 0x22, 0x6E, 0x98, 0x03, 0x1B, 0x94, 0xB2, 0x53,
-    0x7C, 0x4C, 0xFD, 0xBA, 0x02, 0x38, 0x77, 0xCA, 0xC1, 0xD7, 0x06, 0x03, 0xF1, 0x6E, 0x6C, 0xDC,
-    0x50, 0xCC, 0xE2, 0x70, 0x8B, 0x62, 0x37, 0xA2, 0xF8, 0x0B, 0xF9, 0x11, 0x29, 0xA8, 0xA5, 0x05,
-    0x0D, 0xE5, 0xFD, 0x17, 0xDA, 0xC4, 0x8E, 0x30, 0x75, 0x95, 0x2A, 0xF9, 0xA4, 0x5B, 0x10, 0x2B,
-    0xC6, 0x05, 0x55, 0x39, 0x17, 0xC2, 0xB6, 0x8F, 0x86, 0x68, 0x48, 0xBA, 0x70, 0xCC, 0xDA, 0x60,
-    0xC0, 0xDD, 0xF0, 0x64, 0x14, 0x17, 0x57, 0xCB, 0xDB, 0xE5, 0x91, 0x75, 0x1B, 0x0E, 0x66, 0xEC,
-    0x2B, 0x88, 0x00, 0x5F, 0x8C, 0xED, 0xD5, 0x21, 0xE0, 0xD2, 0x19, 0x7D, 0x70, 0x4F, 0x46, 0x75,
-    0xDF, 0x5F, 0x24, 0x71, 0xD2, 0x42, 0xCE, 0xE7, 0x46, 0xD3, 0xDD, 0x60, 0xC6, 0xD3, 0x53, 0x0F,
-    0xEA, 0xE0, 0x19, 0x8B, 0x0A, 0xA7, 0xC3, 0x1C, 0xB0, 0x5D, 0x5E, 0x8E, 0xD3, 0xBA, 0x9E, 0xEB,
-    0x28, 0x28, 0xDB, 0x4E, 0xA2, 0x31, 0x82, 0xF8, 0xFB, 0xC0, 0x4A, 0x0A, 0x3B, 0xC4, 0x5D, 0x3F,
-    0x6B, 0x78, 0x36, 0xA0, 0xC8, 0x1F, 0xDC, 0x01, 0xA0, 0x3D, 0xCE, 0x3F, 0xDE, 0xD8, 0x30, 0x79,
-    0x7B, 0xB0, 0x3B, 0xE8, 0xCC, 0xC0, 0x0A, 0x93, 0x39, 0x09, 0x84, 0x7B, 0x7B, 0x9F, 0x5D, 0x0D,
-    0xEC, 0xB4, 0x59, 0xAC, 0x53, 0x9C, 0xAD, 0xE8, 0x8F, 0xD8, 0x8A, 0xC1, 0xED, 0x29, 0x9D, 0x22,
-    0x19, 0xFE, 0xDB, 0x9F, 0x69, 0x2B, 0x4E, 0x45, 0x1A, 0x8F, 0x28, 0x29, 0x80, 0x8C, 0x47, 0x95,
-    0xF4, 0x14, 0xC8, 0x58, 0xE6, 0x00, 0xC7, 0x43, 0x39, 0xC0, 0xF0, 0x60, 0xD5, 0xC5, 0xAD, 0xF6,
-    0x44, 0xF3, 0x46, 0xB5, 0xF3, 0x34, 0x9F, 0xE7, 0x86, 0xDE, 0x25, 0xD4, 0x54, 0x26, 0x5F, 0xCE,
-    0xBD, 0x43, 0x22, 0xD2, 0x56, 0xF2, 0x4A, 0x26, 0x59, 0xAE, 0xAE, 0x73, 0x75, 0x9E, 0xA1, 0x3A,
-    0xD2, 0xCF, 0xFC, 0x05, 0x3C, 0x9F, 0x30, 0x70, 0x8B, 0x7E, 0xC7, 0x28, 0x45, 0x4C, 0x1A, 0x33,
-    0x65, 0x9C, 0x99, 0x7D, 0xAC, 0x3C, 0x92, 0x2F, 0x9E, 0x6A, 0x4D, 0x46, 0xDF, 0xD5, 0x53, 0x57,
-    0x7A, 0x17, 0xE3, 0x91, 0xF1, 0xF9, 0x22, 0xF1, 0x88, 0x37, 0xF1, 0x3C, 0xA4, 0xFD, 0x2B, 0xE6,
-    0xC1, 0x0B, 0xEC, 0x4F, 0x4F, 0xBE, 0x65, 0x8C, 0x79, 0x36, 0x99, 0xA1, 0x3D, 0xCF, 0x93, 0x88,
-    0xDE, 0x55, 0xAB, 0xC1, 0x29, 0x22, 0x35, 0xEE, 0x20, 0x8D, 0x58, 0x15, 0x26, 0x4C, 0x51, 0x61,
-    0xA4, 0x4B, 0x02, 0x3D, 0x56, 0xB9, 0x00, 0xCD, 0xFC, 0xD4, 0x28, 0xE0, 0xD7, 0x9A, 0xF5, 0xB8,
-    0xA7, 0x65, 0x8B, 0x68, 0xF4, 0xED, 0x3C, 0x19, 0x72, 0x8D, 0x82, 0x6E, 0x2C, 0x83, 0x49, 0x17,
-    0xE6, 0x65, 0xF6, 0x0F, 0x95, 0xE2, 0x02, 0xDC, 0x53, 0x75, 0x59, 0xF7, 0x0E, 0x25, 0x67, 0x79,
-    0x4C, 0x2A, 0xB3, 0x91, 0xA6, 0xDE, 0x48, 0x64, 0x60, 0x1F, 0xB8, 0x34, 0x62, 0xCA, 0x4D, 0x98,
-    0x0A, 0x36, 0x0A, 0xD1, 0x49, 0x4C, 0x68, 0xFE, 0x0B, 0x18, 0x90, 0x39, 0x20, 0xA7, 0x71, 0xCE,
-    0x19, 0xA3, 0xD6, 0x4F, 0x12, 0xF0, 0xCC, 0xFA, 0x52, 0x3B, 0xBE, 0xA2, 0x31, 0x50, 0xEB, 0x6D,
-    0x0B, 0xCC, 0x3A, 0x9E, 0x6D, 0x42, 0xC3, 0xA5, 0x38, 0x66, 0xE9, 0x2C, 0x44, 0xC4, 0x5D, 0x3F,
-    0x15, 0x51, 0x59, 0x6B, 0xE5, 0xD8, 0x89, 0x28, 0x58, 0x88, 0x28, 0x3D, 0x50, 0x5B, 0x3D, 0xE3,
-    0xA0, 0xFB, 0x81, 0xAA, 0x5E, 0xB9, 0x3B, 0x9A, 0x22, 0x72, 0x28, 0x61, 0x74, 0x0A, 0x64, 0x68,
-    0xC0, 0xA3, 0x6B, 0x37, 0x5D, 0xB9, 0xE9, 0xBA, 0x6D, 0x74, 0x46, 0x6C, 0xEF, 0x14, 0xC9, 0x58,
-    0x71, 0x8B, 0x8E, 0x45, 0xC0, 0xF3, 0x50, 0x03, 0x9E, 0x12, 0x2E, 0xE7, 0x20, 0xE0, 0x39, 0x95,
-    0x41, 0xD1, 0x45, 0x6B, 0xD0, 0x42, 0x11, 0xA3, 0xDE, 0x01, 0x95, 0xC6, 0x71, 0x5B, 0xFA, 0xA5,
-    0x92, 0xE1, 0xE9, 0xE9, 0x1D, 0xD1, 0xA3, 0x88, 0xCC, 0x5C, 0x9D, 0x33, 0x8F, 0xAC, 0xBA, 0xE6,
-    0xA3, 0x83, 0x1B, 0x1B, 0x07, 0x6B, 0xD3, 0x93, 0xDB, 0xAC, 0xC7, 0x06, 0x04, 0x2B, 0x96, 0x71,
-    0x41, 0xB0, 0x47, 0x82, 0x79, 0x32, 0xAF, 0x8D, 0xA0, 0x18, 0x6D, 0x52, 0x36, 0x79, 0xB3, 0x4A,
-    0x5A, 0xF7, 0x08, 0x78, 0xAA, 0xFA, 0x23, 0xB0, 0x90, 0x7D, 0x5A, 0x81, 0x60, 0x6B, 0x40, 0x30,
-    0x8F, 0x35, 0x63, 0xB2, 0xCE, 0x04, 0x6B, 0x44, 0x1A, 0x70, 0xDD, 0x15, 0x15, 0x37, 0x16, 0xE9,
-    0xF6, 0xD7, 0x35, 0xA1, 0xAE, 0x5E, 0x43, 0x63, 0x1E, 0x9E, 0x18, 0x90, 0xE5, 0xAE, 0xE9, 0xA3,
-    0x9B, 0x70, 0x50, 0x77, 0x8F, 0x27, 0xDD, 0xB0, 0x16, 0xE1, 0x79, 0x36, 0x93, 0xB2, 0x43, 0xA7,
-    0xB2, 0x9F, 0x1B, 0x3A, 0x23, 0x91, 0x12, 0x56, 0x4C, 0xC4, 0xC2, 0x84, 0x30, 0xEF, 0x65, 0x7F,
-    0xC3, 0x8D, 0x03, 0xCB, 0xD4, 0xD4, 0xE2, 0xD0, 0x92, 0xEE, 0x73, 0xFA, 0x4F, 0xBC, 0xCF, 0x79,
-    0xFA, 0x14, 0xCE, 0x3B, 0x99, 0x8D, 0xEE, 0x64, 0x72, 0xE2, 0x45, 0xFF, 0xD4, 0xDD, 0xEA, 0x79,
-    0x27, 0x33, 0x36, 0xFF, 0x7F, 0x19, 0xBA, 0xED, 0xA6, 0x2D, 0x3D, 0xAA, 0x4E, 0x49, 0x3A, 0x98,
-    0x54, 0xB9, 0x3C, 0x76, 0xAF, 0xF2, 0xF4, 0x29, 0x54, 0x13, 0xEF, 0x8E, 0x58, 0x74, 0x8B, 0xAD,
-    0x91, 0xE9, 0xD8, 0xBE, 0x08, 0x8F, 0xBD, 0x8F, 0x0A, 0x92, 0x49, 0x62, 0xE6, 0x48, 0x63, 0xC4,
-    0xD6, 0x8B, 0x03, 0xF0, 0xC4, 0xC4, 0x58, 0x97, 0xF9, 0x8B, 0xFA, 0x16, 0xE3, 0x67, 0xFD, 0x2F,
-    0x02, 0xE8, 0x21, 0xF9, 0x98, 0x19, 0x8C, 0x07, 0x0D, 0xCD, 0x26, 0xE3, 0x65, 0xAB, 0x49, 0x8C,
-    0x62, 0x0E, 0x7B, 0x5C, 0x7E, 0x6F, 0x9C, 0x0F, 0x57, 0x3A, 0xC7, 0xA2, 0xC1, 0x18, 0x33, 0xB7,
-    0x17, 0x59, 0x2D, 0x23, 0x29, 0x97, 0xDC, 0x89, 0x62, 0x17, 0xB8, 0xD0, 0xF6, 0x9A, 0x79, 0xFB,
-    0xFD, 0xF1, 0x20, 0x62, 0xCC, 0x92, 0xDB, 0x26, 0xB0, 0xF7, 0xF3, 0x8E, 0x19, 0xDC, 0x21, 0x70,
-    0x5E, 0xBB, 0x88, 0xA6, 0x80, 0x61, 0xCF, 0x02, 0x04, 0x47, 0x81, 0xFB, 0x30, 0x05, 0x4E, 0x6D,
-    0x2B, 0x36, 0xEB, 0xB2, 0x9E, 0x5D, 0x41, 0xF9, 0x13, 0x7A, 0x7F, 0x73, 0xE3, 0x04, 0x94, 0x8C,
-    0x68, 0x9D, 0x7C, 0x97, 0xC7, 0x2F, 0x53, 0xC3, 0x24, 0xF6, 0x7B, 0x8C, 0x1C, 0x08, 0x1E, 0x0D,
-    0x62, 0x9E, 0x0A, 0x99, 0xFE, 0x1B, 0xD5, 0x5C, 0xBF, 0x93, 0xDD, 0x46, 0x72, 0x1E, 0x00, 0xC5,
-    0x85, 0x4B, 0x08, 0xC0, 0x80, 0x3C, 0x97, 0xC8, 0xB2, 0x91, 0x38, 0x38, 0xCB, 0x36, 0xF1, 0x07,
-    0xD8, 0x5A, 0x80, 0x62, 0x95, 0x19, 0x28, 0x30, 0x03, 0xD1, 0xE5, 0x2A, 0x07, 0x74, 0xA0, 0x40,
-    0x45, 0x57, 0x99, 0x0E, 0x1D, 0xE8, 0x08, 0xDC, 0xF9, 0x1F, 0x78, 0x0E, 0xE4, 0xC4, 0x81, 0x15,
-    0x30, 0xE0, 0xAD, 0x5C, 0xA5, 0x74, 0x7D, 0xB5, 0x22, 0x60, 0x5F, 0x70, 0x81, 0x02, 0xE3, 0xA4,
-    0x72, 0x39, 0x70, 0x20, 0x54, 0x99, 0x74, 0xD9, 0x72, 0x70, 0xB8, 0x12, 0x74, 0x06, 0x97, 0x0F,
-    0x98, 0xEB, 0xEF, 0x6B, 0xE0, 0xFD, 0xD8, 0x5D, 0xF1, 0xE7, 0xFE, 0x78, 0x5C, 0xF2, 0x75, 0xEF,
-    0x7B, 0xFB, 0xDE, 0x4C, 0xCF, 0x37, 0x3D, 0xDD, 0x3D, 0x3D, 0x3D, 0xCF, 0x38, 0xD6, 0x56, 0xC6,
-    0x98, 0x75, 0x76, 0xE0, 0x27, 0x98, 0x93, 0x85, 0x3D, 0x59, 0x64, 0xC9, 0x12, 0x65, 0xDB, 0x36,
-    0x07, 0xDB, 0xB3, 0x25, 0x58, 0xA7, 0xAD, 0xB4, 0x59, 0x2D, 0xCC, 0x6D, 0x92, 0x46, 0x98, 0x57,
-    0x27, 0xAD, 0x30, 0xBF, 0x8C, 0x3A, 0xB4, 0x55, 0x86, 0x68, 0x2D, 0xCC, 0xD9, 0x5A, 0x64, 0x82,
-    0x81, 0x6D, 0x59, 0x3B, 0xB2, 0xD4, 0x98, 0xCF, 0x8C, 0x8B, 0xD6, 0xE4, 0x6D, 0xC2, 0x1C, 0xF9,
-    0xAC, 0xAD, 0xA5, 0x2D, 0x63, 0xB2, 0xC6, 0x78, 0xC2, 0xA4, 0xB5, 0x00, 0xCF, 0xE6, 0xA6, 0xB0,
-    0x79, 0x60, 0x6D, 0x29, 0xFF, 0x43, 0x79, 0xC8, 0x53, 0xE9, 0xD5, 0x5A, 0xF9, 0x1B, 0x7F, 0xE3,
-    0x8F, 0x73, 0x43, 0x1E, 0x85, 0x48, 0xE5, 0x5B, 0xDB, 0x99, 0x70, 0x2E, 0x9D, 0x87, 0xAD, 0xF4,
-    0xE9, 0x37, 0xBE, 0x74, 0x7C, 0xDE, 0x47, 0xB7, 0x20, 0xDF, 0xFB, 0xC4, 0x4A, 0xAF, 0x22, 0x45,
-    0x34, 0x5C, 0xB7, 0xD2, 0x85, 0xBC, 0x96, 0x35, 0x20, 0x35, 0x49, 0x80, 0xA7, 0x21, 0xFE, 0x90,
-    0xC9, 0x5B, 0xEC, 0x37, 0x56, 0x5E, 0xFE, 0xA1, 0xF4, 0x74, 0x61, 0xEC, 0xE3, 0x06, 0x87, 0x0B,
-    0x21, 0x8D, 0xD3, 0x07, 0xEC, 0xBC, 0x50, 0x44, 0x12, 0x8C, 0xC8, 0x98, 0xAD, 0xFF, 0x31, 0xAF,
-    0x2B, 0xAE, 0x4E, 0x2A, 0xC3, 0x73, 0x6B, 0xB7, 0x36, 0xCE, 0xE3, 0xCB, 0x15, 0x10, 0x2E, 0x47,
-    0x29, 0xB7, 0x1E, 0x9A, 0x53, 0x84, 0xF9, 0x75, 0x51, 0x43, 0x74, 0xA2, 0x8B, 0x28, 0xE6, 0xD4,
-    0x9B, 0xBB, 0x8A, 0x91, 0x8A, 0x6D, 0x06, 0x65, 0xF6, 0xEF, 0xC9, 0x32, 0x15, 0x1F, 0xDD, 0x9F,
-    0x34, 0x86, 0x01, 0x84, 0x4A, 0xD0, 0xDB, 0x67, 0x20, 0xF3, 0x85, 0x4C, 0xF6, 0x23, 0xA8, 0x2B,
-    0xE4, 0xBA, 0xCC, 0xE7, 0x6F, 0x7D, 0x0C, 0xC1, 0x00, 0x1D, 0x40, 0x75, 0xF1, 0x9A, 0xDF, 0x12,
-    0xAC, 0x55, 0xE5, 0x15, 0x51, 0x67, 0x26, 0x84, 0xA8, 0x59, 0x1D, 0x0D, 0x8E, 0xCD, 0x3D, 0xEB,
-    0x41, 0x30, 0x01, 0xD4, 0x81, 0xEC, 0x66, 0x16, 0xA3, 0x8B, 0xA4, 0x5B, 0x27, 0xED, 0x82, 0xAC,
-    0xFF, 0x81, 0x6F, 0x8E, 0x38, 0x27, 0xC3, 0x38, 0xD0, 0x00, 0xF8, 0xC7, 0xA6, 0x78, 0xFC, 0xA7,
-    0xBD, 0x89, 0xD1, 0x91, 0x8C, 0x7A, 0xA6, 0x38, 0x99, 0x4B, 0xF7, 0xE4, 0x73, 0x58, 0xE9, 0x32,
-    0x35, 0xF2, 0x56, 0x4F, 0x9A, 0x08, 0x26, 0xF1, 0x6E, 0x00, 0xD6, 0x4A, 0xDE, 0xDC, 0x05, 0xF3,
-    0x60, 0x1E, 0xB5, 0x7E, 0x9F, 0x34, 0xDE, 0x5C, 0x1E, 0x75, 0xD6, 0xE8, 0xC0, 0x16, 0x0F, 0x9D,
-    0x4E, 0xB6, 0x24, 0x42, 0xFD, 0x86, 0xF4, 0xFF, 0x07, 0xA1, 0xBD, 0x3A, 0xF7, 0xAC, 0x6D, 0xD1,
-    0x06, 0xDB, 0x32, 0x97, 0x3E, 0x9E, 0x84, 0xB4, 0x82, 0x85, 0x3B, 0x2F, 0xA4, 0xAF, 0x3A, 0x2A,
-    0x4D, 0x98, 0x7A, 0xD5, 0xA6, 0x00, 0xB2, 0x75, 0x5F, 0x17, 0x06, 0x96, 0xC3, 0x10, 0x97, 0x6E,
-    0xE7, 0x37, 0x5E, 0x05, 0xA5, 0x3D, 0x09, 0x40, 0xB6, 0x66, 0x90, 0x8F, 0x32, 0x2F, 0x46, 0x14,
-    0x36, 0x87, 0xCC, 0xDB, 0x99, 0x02, 0xE2, 0xC8, 0xA4, 0xA1, 0x0F, 0x80, 0x82, 0x87, 0xDF, 0xAD,
-    0x48, 0x76, 0xCC, 0x80, 0xBC, 0x61, 0xDC, 0x99, 0x09, 0xAA, 0xB0, 0x14, 0x3D, 0xCC, 0x52, 0x55,
-    0x13, 0x93, 0x51, 0xE6, 0x66, 0x53, 0x00, 0x71, 0x73, 0x73, 0xCF, 0x6D, 0xC5, 0x70, 0x0D, 0x51,
-    0x45, 0xA7, 0x14, 0x0D, 0x0B, 0x8B, 0x7A, 0xEC, 0x80, 0x6C, 0xA5, 0x80, 0xDF, 0x6B, 0x7C, 0xF9,
-    0x80, 0x33, 0x8F, 0x4B, 0xBA, 0x43, 0x5A, 0x6B, 0x1A, 0x98, 0xB0, 0x5B, 0x57, 0x14, 0x31, 0xB8,
-    0xFF, 0xAB, 0x66, 0xB7, 0x15, 0x81, 0xAB, 0x3B, 0xF2, 0x56, 0x08, 0x53, 0x0A, 0x35, 0x45, 0x03,
-    0x2A, 0x3D, 0x09, 0x95, 0x01, 0x0B, 0x8D, 0x48, 0x05, 0x33, 0xD0, 0xE1, 0xD9, 0x34, 0xEA, 0x97,
-    0x9F, 0x15, 0xDC, 0x84, 0x66, 0x6C, 0x53, 0xCC, 0x39, 0x7A, 0xC9, 0x1D, 0x5B, 0x09, 0x16, 0xDA,
-    0xBB, 0xD0, 0x01, 0x46, 0xFB, 0xE2, 0xCD, 0xF4, 0x22, 0x05, 0xAB, 0x20, 0xF6, 0x65, 0x5B, 0xA9,
-    0xA1, 0xFC, 0x39, 0xF1, 0xB2, 0x5F, 0x70, 0x56, 0xED, 0x97, 0x5C, 0xFD, 0xEA, 0x6A, 0x94, 0x15,
-    0x2D, 0x98, 0x6F, 0x87, 0xA2, 0xC2, 0xA4, 0x5C, 0xC6, 0xB3, 0xB8, 0xF3, 0xC0, 0x92, 0xC6, 0x51,
-    0xC6, 0x77, 0x66, 0x23, 0xAB, 0x9F, 0xC2, 0xF4, 0x2D, 0xC9, 0xC4, 0x1C, 0x6D, 0xCC, 0xB5, 0xDA,
-    0xB4, 0xE0, 0x82, 0x8E, 0xB0, 0xDE, 0x1D, 0xDB, 0xC5, 0x10, 0xF3, 0xDC, 0x2B, 0x83, 0x79, 0xD1,
-    0x3E, 0x4A, 0xC3, 0x41, 0x14, 0xA7, 0x0A, 0x87, 0x4B, 0xF6, 0xEB, 0xD9, 0xB1, 0x81, 0xA9, 0x58,
-    0x2A, 0x94, 0x0B, 0xD0, 0x48, 0x3D, 0xFA, 0x5C, 0x77, 0xC7, 0xEE, 0xAF, 0xBF, 0x4E, 0x28, 0x7D,
-    0xDB, 0x17, 0xE8, 0xF9, 0xCF, 0xD1, 0x27, 0x71, 0x54, 0x1C, 0x14, 0x14, 0xED, 0x59, 0xE1, 0x5A,
-    0xA3, 0x3A, 0xCA, 0x91, 0x3A, 0xFC, 0xAC, 0xCB, 0x11, 0x00, 0x35, 0x05, 0x6D, 0xC4, 0x4C, 0x21,
-    0x0B, 0x2C, 0xD6, 0x4F, 0x48, 0xE7, 0xAF, 0xBF, 0xAF, 0x2B, 0xA7, 0xAC, 0x67, 0xA5, 0xD2, 0x96,
-    0x33, 0x50, 0xBE, 0xED, 0x43, 0xF4, 0xC2, 0xAA, 0xF4, 0x0B, 0xFA, 0x08, 0x63, 0xB7, 0x0C, 0x0B,
-    0xEC, 0xD7, 0x3B, 0xF9, 0x91, 0xEF, 0x59, 0xA7, 0xE2, 0xC6, 0x20, 0xEB, 0x48, 0x39, 0xDA, 0x1C,
-    0xBD, 0xDB, 0x91, 0xCA, 0x4A, 0x62, 0x84, 0xBB, 0x16, 0xE6, 0xD2, 0x2C, 0xDF, 0x91, 0x3F, 0xBA,
-    0x00, 0x3E, 0xE8, 0x65, 0x61, 0x87, 0x82, 0x97, 0xD8, 0x1F, 0x57, 0x22, 0x01, 0x21, 0x29, 0x80,
-    0xC8, 0xB3, 0xFD, 0x4F, 0x84, 0xA0, 0x95, 0xEC, 0xDB, 0x9B, 0x37, 0x53, 0xAC, 0x63, 0x2E, 0x64,
-    0x25, 0x62, 0xD1, 0xCF, 0xC1, 0x66, 0x4A, 0x34, 0x64, 0x7F, 0xF8, 0x00, 0x4D, 0xCD, 0xD1, 0x28,
-    0xFA, 0x78, 0x8F, 0xEA, 0x05, 0xB4, 0xC2, 0x34, 0x94, 0x11, 0x85, 0x55, 0x46, 0x8B, 0x33, 0x70,
-    0xCF, 0xC0, 0xE5, 0x1C, 0xCF, 0x36, 0x1C, 0x37, 0x44, 0xE9, 0x4E, 0xE3, 0xC8, 0x48, 0xFB, 0x80,
-    0xE0, 0x61, 0x3D, 0x21, 0xD0, 0xDB, 0xEA, 0xCC, 0x29, 0xC2, 0x68, 0x2E, 0x31, 0x2A, 0x64, 0x7C,
-    0x65, 0x2C, 0x2D, 0x49, 0x41, 0x9A, 0x94, 0x1B, 0x0E, 0xA0, 0x73, 0x0F, 0xEB, 0xA3, 0x9F, 0xFC,
-    0x0D, 0x89, 0x37, 0x5F, 0x17, 0xFA, 0xE4, 0x01, 0xDC, 0x38, 0x58, 0xA6, 0x70, 0x5F, 0xA3, 0xFD,
-    0xBB, 0x2B, 0xB1, 0xBE, 0x5A, 0x12, 0x86, 0xD7, 0x63, 0xA0, 0xCF, 0x00, 0xFB, 0x38, 0x31, 0xFA,
-    0x6D, 0xC1, 0xE8, 0xEA, 0x3A, 0x46, 0xD9, 0x14, 0xDD, 0x7B, 0xDC, 0xEF, 0x34, 0x13, 0xF1, 0x86,
-    0xF7, 0xC5, 0xD0, 0xDA, 0x76, 0x54, 0xBE, 0x37, 0xC5, 0x4B, 0x4B, 0xF8, 0x90, 0x43, 0xEC, 0xA0,
-    0xE1, 0x5C, 0xDA, 0xF9, 0x52, 0x27, 0xB3, 0x6A, 0xB3, 0xB5, 0x51, 0xE2, 0x99, 0xF7, 0x0D, 0x03,
-    0x1A, 0x46, 0x34, 0x22, 0x99, 0xB4, 0x8A, 0x98, 0x66, 0x19, 0xD4, 0x9C, 0xCE, 0x72, 0x46, 0xE4,
-    0x3D, 0x2E, 0x86, 0x71, 0xB3, 0x5F, 0x20, 0xE0, 0x41, 0x04, 0x2E, 0x90, 0x56, 0xA6, 0x3D, 0x10,
-    0x15, 0xDF, 0xB1, 0x0F, 0xE1, 0x65, 0xB0, 0xC5, 0x4C, 0x5A, 0xF1, 0xCB, 0x0E, 0x32, 0x17, 0xB5,
-    0x48, 0x65, 0x92, 0x0A, 0xDB, 0xC0, 0x24, 0x47, 0x24, 0x78, 0x41, 0x03, 0x3B, 0x0D, 0xF4, 0xD6,
-    0x69, 0xBB, 0x42, 0x3B, 0xE9, 0x72, 0x10, 0x7A, 0xD9, 0x3E, 0x16, 0xEA, 0xD8, 0x1A, 0x31, 0xA1,
-    0xB8, 0x60, 0xD2, 0x90, 0x73, 0xE4, 0xAF, 0x05, 0x00, 0x74, 0xD9, 0x11, 0x67, 0x42, 0xA2, 0xD1,
-    0xC7, 0x30, 0xDF, 0xEF, 0x4D, 0x83, 0x08, 0x87, 0x69, 0x08, 0x18, 0x01, 0x07, 0xB0, 0x90, 0x3F,
-    0x95, 0x18, 0x52, 0x42, 0xFC, 0xC2, 0x16, 0x02, 0x60, 0xF1, 0x6D, 0x2B, 0x61, 0x62, 0x77, 0x23,
-    0x6C, 0x65, 0xF9, 0x47, 0x8D, 0x37, 0xAC, 0x93, 0x5E, 0x50, 0xF6, 0xE7, 0xC6, 0xEB, 0x6F, 0x61,
-    0xD3, 0x8C, 0x19, 0xFD, 0xC9, 0x8F, 0x0D, 0xF7, 0xCC, 0x86, 0xA9, 0x91, 0x70, 0x7F, 0x67, 0x06,
-    0x04, 0x06, 0x3A, 0x7F, 0x99, 0x5B, 0x91, 0x26, 0xDE, 0xDF, 0xB1, 0x55, 0x96, 0x9B, 0xA4, 0x16,
-    0x71, 0x23, 0x44, 0x5D, 0x71, 0x29, 0x92, 0x64, 0x79, 0xF6, 0x70, 0x0B, 0xDB, 0x58, 0xF1, 0x31,
-    0xCE, 0xA7, 0xFB, 0x22, 0x1A, 0xB3, 0x11, 0x63, 0xAE, 0xC5, 0xE9, 0x2F, 0x73, 0x97, 0xCA, 0x4D,
-    0xB7, 0x62, 0x7F, 0x38, 0xCF, 0xB2, 0x89, 0x78, 0x6B, 0x4A, 0xA5, 0x79, 0x4A, 0x4A, 0x65, 0x63,
-    0xF0, 0xE6, 0x46, 0x4A, 0xB7, 0x52, 0x53, 0xEA, 0x45, 0xA9, 0xDF, 0x99, 0x23, 0x7F, 0x36, 0x52,
-    0xBF, 0xDD, 0x8F, 0xA7, 0x31, 0x44, 0xFD, 0x34, 0x82, 0xB5, 0x01, 0x6C, 0x0E, 0xDE, 0x1B, 0x8C,
-    0xE2, 0xF8, 0xC3, 0x64, 0x10, 0x93, 0x5F, 0x08, 0x04, 0x99, 0x8B, 0x63, 0xEA, 0x25, 0xE6, 0x5F,
-    0x35, 0x57, 0xF7, 0xC6, 0xE2, 0x85, 0xBB, 0x93, 0x3F, 0x74, 0xE9, 0x93, 0xBA, 0x8D, 0xD3, 0xEF,
-    0x1D, 0x0A, 0xE4, 0x69, 0x02, 0x31, 0x54, 0x07, 0x14, 0x7F, 0xCE, 0xD1, 0x3D, 0x70, 0x08, 0x6F,
-    0x6B, 0xDE, 0x3E, 0xA8, 0xE5, 0xE2, 0x84, 0xE0, 0x54, 0x46, 0xE6, 0x8A, 0xCF, 0x8C, 0xD5, 0x23,
-    0x42, 0xB5, 0x5E, 0x80, 0x3D, 0xBA, 0x79, 0xAB, 0xA7, 0x67, 0x44, 0xCE, 0x40, 0x5C, 0xE3, 0xA7,
-    0xFD, 0xCB, 0xB4, 0x42, 0x26, 0xF3, 0x6A, 0x74, 0xEF, 0xB5, 0x22, 0x99, 0x26, 0xAF, 0x46, 0x45,
-    0xB0, 0x3A, 0x03, 0x85, 0x19, 0x13, 0x58, 0x12, 0xCC, 0x23, 0x74, 0xB9, 0x78, 0x53, 0x03, 0x94,
-    0x94, 0x59, 0xD5, 0x94, 0x60, 0x80, 0xBA, 0x47, 0xD1, 0xF3, 0xA0, 0xEF, 0xD2, 0xA7, 0x66, 0x32,
-    0x6A, 0xD7, 0xEE, 0xEB, 0x3E, 0x33, 0x41, 0xAE, 0xA1, 0x14, 0x95, 0x92, 0x4D, 0x60, 0x08, 0x9A,
-    0xBE, 0x04, 0xF5, 0x6C, 0x29, 0x03, 0xC9, 0x6C, 0x27, 0xD3, 0x90, 0xD9, 0xB9, 0xD0, 0xE7, 0xC0,
-    0xF9, 0x22, 0x40, 0x1C, 0xDE, 0x83, 0x03, 0x97, 0x69, 0x1D, 0x9F, 0x9D, 0x36, 0xCE, 0x4F, 0xC7,
-    0xB0, 0xB0, 0x88, 0x17, 0xFE, 0x52, 0x76, 0xD4, 0x07, 0xF1, 0x5C, 0x45, 0x72, 0xF8, 0x0E, 0x24,
-    0xF3, 0x57, 0xC4, 0x10, 0xE9, 0xB0, 0x68, 0xEE, 0x95, 0x89, 0xFD, 0xC7, 0x52, 0x24, 0x49, 0xBB,
-    0xC8, 0x9A, 0x1B, 0x6E, 0xBB, 0xAA, 0xCB, 0x29, 0x1E, 0x40, 0x97, 0x01, 0xD8, 0x31, 0x3C, 0x00,
-    0xD2, 0xD4, 0x2E, 0xFA, 0x0F, 0x7B, 0x4F, 0xE6, 0xF2, 0x1F, 0x4A, 0x99, 0xA5, 0x7C, 0x17, 0xFD,
-    0x3B, 0xBB, 0x8B, 0xFE, 0x23, 0x1A, 0x1B, 0x7C, 0x06, 0xFB, 0xFE, 0x17, 0x7C, 0x88, 0xCC, 0x91,
-    0xE5, 0x8A, 0x96, 0xB5, 0xDB, 0x2F, 0x1E, 0xA7, 0x35, 0x36, 0x99, 0x39, 0xD9, 0x8A, 0x67, 0x76,
-    0xCC, 0xF3, 0x65, 0x78, 0x25, 0xF5, 0xD1, 0xDF, 0xB3, 0xFF, 0xCB, 0x4C, 0xC9, 0x04, 0xC9, 0xFF,
-    0x0B, 0x12, 0x61, 0xC6, 0xF2, 0x2F, 0xFA, 0xF9, 0x03, 0x11, 0x1E, 0x53, 0x28, 0x93, 0xF3, 0x57,
-    0xF9, 0xA9, 0x0D, 0xE2, 0x86, 0xB9, 0xB0, 0x67, 0xF6, 0xB2, 0x3F, 0xEE, 0x12, 0xDB, 0x84, 0xE2,
-    0x6B, 0x7E, 0x62, 0x5E, 0x65, 0x34, 0x27, 0x2D, 0x2D, 0x13, 0xFD, 0x77, 0x75, 0x8F, 0x03, 0xFB,
-    0x0C, 0xBF, 0xE2, 0xD8, 0x3F, 0x53, 0xF3, 0x16, 0x8B, 0x7F, 0xF9, 0x40, 0x00, 0x84, 0x3D, 0x97,
-    0x15, 0xE8, 0xAC, 0x24, 0x73, 0x5E, 0x6E, 0x34, 0xE6, 0x8A, 0x71, 0x3A, 0x38, 0x1B, 0x89, 0x86,
-    0xC5, 0xE5, 0xF9, 0xFD, 0x5F, 0x78, 0x32, 0xAE, 0xA2, 0x36, 0x97, 0x0C, 0x0F, 0x86, 0x16, 0x52,
-    0x66, 0xF9, 0x41, 0x07, 0x71, 0xC2, 0x8A, 0xF7, 0x92, 0x73, 0x73, 0x5D, 0x6C, 0x91, 0xB0, 0x77,
-    0xAD, 0x6D, 0x20, 0x5B, 0xA2, 0x76, 0x4D, 0x23, 0x02, 0x13, 0x9D, 0x3E, 0xA3, 0x39, 0x9D, 0x73,
-    0x5C, 0x4B, 0x66, 0xA6, 0xF4, 0xB6, 0xCE, 0xE8, 0x92, 0x25, 0xBA, 0xD0, 0x0A, 0x66, 0x4F, 0x5C,
-    0x3D, 0x6D, 0xCB, 0x74, 0x92, 0x99, 0x51, 0xF9, 0xC0, 0x98, 0xFB, 0x3A, 0xFD, 0xD0, 0x00, 0x1F,
-    0x43, 0x97, 0xFF, 0x46, 0xF4, 0xC0, 0xED, 0x8F, 0x08, 0x56, 0x05, 0xC2, 0xC2, 0x8E, 0x54, 0xDE,
-    0x1C, 0x20, 0x1B, 0x9F, 0x7A, 0xC7, 0x41, 0x05, 0x72, 0x0F, 0x2D, 0xCF, 0x17, 0x94, 0x3E, 0xE1,
-    0x20, 0xF5, 0x87, 0x65, 0x44, 0x7D, 0xA7, 0xE3, 0xCB, 0x18, 0x86, 0xF7, 0x78, 0x3C, 0x77, 0x42,
-    0x34, 0x27, 0xE6, 0xCC, 0x9D, 0x67, 0xC6, 0x17, 0x97, 0x1D, 0xE6, 0xEE, 0x62, 0x5F, 0x1E, 0x22,
-    0x4D, 0x0B, 0xC7, 0x92, 0xCD, 0xD5, 0xC1, 0x9F, 0xD8, 0x63, 0x4C, 0xF9, 0x33, 0x21, 0x9B, 0x9B,
-    0x42, 0x84, 0x2D, 0x90, 0xEC, 0xDB, 0x49, 0x39, 0x03, 0xBE, 0x68, 0x51, 0xF8, 0xA5, 0xC4, 0x98,
-    0xE9, 0x67, 0x66, 0x77, 0x0C, 0x02, 0x5F, 0xD9, 0xAC, 0x1F, 0x69, 0xEA, 0x4B, 0x3E, 0xC4, 0x21,
-    0x4A, 0xB4, 0x67, 0x10, 0xA5, 0x9A, 0x22, 0xE7, 0x4A, 0xBB, 0xAE, 0xA9, 0x89, 0xEB, 0x12, 0x02,
-    0x3A, 0xB6, 0x9E, 0x96, 0x4B, 0xA1, 0x99, 0x84, 0x39, 0x19, 0xC3, 0x45, 0x5B, 0xF1, 0x10, 0xD4,
-    0x56, 0xCC, 0xD5, 0xD8, 0xEA, 0x33, 0x4D, 0xE7, 0x53, 0xB5, 0xEC, 0x7F, 0x68, 0xF6, 0xE3, 0x17,
-    0x9A, 0xEA, 0x67, 0x32, 0xD8, 0xD8, 0x27, 0x0C, 0x0B, 0xED, 0x17, 0x56, 0x3F, 0x67, 0xB5, 0x15,
-    0x9E, 0xED, 0x88, 0xA7, 0xEE, 0xC9, 0x42, 0xAB, 0x4D, 0x5B, 0xE6, 0x35, 0x3C, 0x8A, 0x59, 0x3B,
-    0x9A, 0x00, 0x17, 0xC5, 0xE2, 0x72, 0x0D, 0x6C, 0x7A, 0xE8, 0x78, 0x4C, 0x15, 0xD2, 0x55, 0x35,
-    0xF7, 0xD4, 0x1F, 0x7B, 0x9A, 0xD1, 0xF5, 0x35, 0x17, 0xE8, 0x18, 0xF3, 0x82, 0xE1, 0x19, 0xE9,
-    0x55, 0x6B, 0x17, 0x34, 0x4D, 0x6A, 0x52, 0xCC, 0x95, 0x4C, 0x90, 0xD0, 0x77, 0x3A, 0x06, 0x1E,
-    0x35, 0xE8, 0xAD, 0x06, 0xB4, 0xE0, 0x2B, 0x30, 0x9F, 0xAE, 0xFD, 0x0A, 0xD9, 0x78, 0x7B, 0x8D,
-    0x61, 0xC9, 0x3B, 0x44, 0x3B, 0x65, 0x70, 0x92, 0xCA, 0x98, 0x65, 0x68, 0x12, 0x7D, 0x89, 0x36,
-    0x07, 0xB4, 0x27, 0x4E, 0x71, 0x20, 0x63, 0x19, 0x51, 0xF8, 0x58, 0xEB, 0x1E, 0x38, 0x5E, 0x1E,
-    0x37, 0x9B, 0x0F, 0x49, 0xCF, 0x73, 0x14, 0x90, 0x4A, 0xA9, 0xFF, 0x2C, 0xD9, 0x48, 0x8B, 0x66,
-    0x29, 0xDB, 0x2F, 0x06, 0x0D, 0x99, 0x54, 0xC2, 0x92, 0x63, 0x64, 0x0B, 0x45, 0x0B, 0xD9, 0x12,
-    0x84, 0x3D, 0x12, 0xF0, 0x40, 0x36, 0x9A, 0x06, 0x1E, 0x64, 0x53, 0x75, 0x44, 0x2D, 0x08, 0x1C,
-    0x21, 0xD7, 0xFA, 0x8C, 0x28, 0x3D, 0x1C, 0xD2, 0xA7, 0x13, 0x75, 0x35, 0xB3, 0xFE, 0xCC, 0x2C,
-    0xD5, 0x8B, 0x52, 0xD9, 0xF8, 0x63, 0x15, 0xE5, 0xCF, 0x95, 0x58, 0x74, 0x77, 0xB4, 0x30, 0x20,
-    0xC2, 0x1A, 0xC4, 0x1A, 0xE0, 0x56, 0x84, 0xFA, 0x00, 0x6D, 0x80, 0x2E, 0x40, 0x13, 0xDC, 0x63,
-    0x7C, 0x40, 0x79, 0xE1, 0xF4, 0xF0, 0xD8, 0x38, 0x3C, 0xD6, 0x7E, 0x46, 0x2D, 0xCB, 0x97, 0x5A,
-    0xF6, 0x03, 0xD2, 0x6E, 0x91, 0xF8, 0x13, 0x9C, 0x04, 0xA6, 0x88, 0x2E, 0xC0, 0x7D, 0xD9, 0xFF,
-    0xCB, 0x38, 0x60, 0xAA, 0xDE, 0x90, 0x65, 0xEB, 0x32, 0x20, 0xF0, 0x28, 0x3E, 0xD7, 0x38, 0xE9,
-    0x40, 0x94, 0xE8, 0xD7, 0x58, 0x2D, 0x42, 0x93, 0x23, 0x7B, 0xEA, 0xFC, 0x54, 0x51, 0x92, 0x51,
-    0xCB, 0x56, 0xE8, 0x9D, 0x79, 0x64, 0xAF, 0xC9, 0xCE, 0xFA, 0x9A, 0xF8, 0xF8, 0xEB, 0xB2, 0xAD,
-    0x7F, 0x37, 0xDF, 0x1C, 0xED, 0xB8, 0xA7, 0x56, 0x52, 0x4D, 0xE6, 0x4A, 0xEE, 0xA1, 0x7F, 0xD5,
-    0x71, 0x8F, 0x46, 0x92, 0x36, 0xD2, 0x53, 0xB9, 0x9E, 0x9B, 0xDC, 0xA7, 0x49, 0x11, 0x72, 0x1D,
-    0xD3, 0x7E, 0x0D, 0xE4, 0xEA, 0xF0, 0x8C, 0x8F, 0xD1, 0xD2, 0x53, 0x35, 0x48, 0x5E, 0x08, 0x91,
-    0xBF, 0xE6, 0x01, 0x32, 0xBD, 0x89, 0xBA, 0x16, 0xF5, 0x3A, 0xCB, 0x4F, 0x05, 0xA4, 0x31, 0xE9,
-    0xF7, 0x5F, 0x16, 0x91, 0x67, 0xE9, 0xFF, 0x3F, 0xB9, 0xB0, 0x94, 0xB5, 0x8B, 0x02, 0x26, 0x71,
-    0x53, 0xE9, 0x1F, 0x3E, 0x55, 0xFF, 0x5D, 0xCD, 0x94, 0x04, 0x63, 0xFD, 0x95, 0x3A, 0xAC, 0x44,
-    0xE3, 0x91, 0x07, 0xEA, 0xAF, 0x5A, 0x73, 0x38, 0x51, 0x92, 0xCB, 0xA3, 0xC6, 0xE9, 0x6F, 0x02,
-    0xAF, 0xD8, 0x30, 0x66, 0xC7, 0x91, 0xA1, 0x46, 0x36, 0x64, 0x96, 0xEC, 0x89, 0xE0, 0x89, 0xD7,
-    0x05, 0x05, 0x30, 0x09, 0x39, 0xC0, 0x24, 0x0C, 0x04, 0x0B, 0x07, 0x32, 0x71, 0x1A, 0x60, 0x62,
-    0xDE, 0xD9, 0x82, 0xAD, 0xC9, 0x92, 0x96, 0x2C, 0x9A, 0x93, 0x85, 0xDA, 0xBA, 0xA7, 0xCC, 0x19,
-    0xFB, 0x2A, 0x94, 0x21, 0x01, 0x26, 0x02, 0x44, 0x1D, 0x0F, 0xA4, 0x03, 0xB0, 0x7A, 0xCC, 0x4A,
-    0xDD, 0xCE, 0xE9, 0x28, 0x4A, 0x9E, 0x95, 0x70, 0xA4, 0x7C, 0x39, 0xE2, 0x08, 0xAF, 0xAC, 0x0E,
-    0xEA, 0x3C, 0xC6, 0x15, 0x70, 0x64, 0xB2, 0x65, 0x92, 0x9E, 0xC6, 0x24, 0x48, 0x7C, 0x52, 0x49,
-    0x90, 0xD7, 0x06, 0xC3, 0xF5, 0x08, 0x47, 0x03, 0x73, 0x67, 0x8C, 0x70, 0xF4, 0x0D, 0x5E, 0x73,
-    0x28, 0xC2, 0x39, 0x7D, 0x44, 0x0F, 0xF8, 0x92, 0x6A, 0x79, 0xFE, 0x9A, 0xAC, 0x9C, 0xE2, 0xED,
-    0x2D, 0x7C, 0x89, 0x11, 0xAB, 0xF5, 0xA6, 0xEA, 0x39, 0xB5, 0x3F, 0xFE, 0xDB, 0x56, 0x43, 0xF0,
-    0x5A, 0x43, 0x79, 0x7E, 0xD4, 0xB1, 0xAF, 0xAF, 0xF6, 0xBF, 0x69, 0xB6, 0x44, 0xFB, 0xC3, 0x12,
-    0x99, 0x5C, 0xBF, 0x29, 0x18, 0x46, 0x6A, 0x3C, 0xAC, 0x29, 0xE4, 0xFA, 0xEC, 0xB4, 0x7F, 0xAC,
-    0xEB, 0x1B, 0x77, 0x7E, 0x49, 0xBB, 0xCA, 0xC2, 0x76, 0xA1, 0x53, 0x62, 0x1A, 0xDD, 0x6F, 0x6C,
-    0x23, 0x9B, 0x21, 0xFF, 0x4B, 0xFB, 0x2B, 0x01, 0x35, 0x16, 0x8B, 0xF6, 0x7F, 0x36, 0xDF, 0x35,
-    0x28, 0xB5, 0x2A, 0x59, 0x29, 0x35, 0xB1, 0x6A, 0xC9, 0xBA, 0x97, 0x63, 0xC9, 0x1C, 0xC6, 0xDA,
-    0x43, 0xD9, 0x67, 0xAF, 0x6C, 0x78, 0x85, 0xB9, 0x6E, 0x8F, 0x98, 0x6B, 0x4F, 0xE7, 0xDA, 0x19,
-    0xE7, 0xBA, 0x68, 0x74, 0xAE, 0x3B, 0x9D, 0xE4, 0x9E, 0xCC, 0xD7, 0xD6, 0xDD, 0xA9, 0x93, 0xC5,
-    0x24, 0x83, 0x45, 0x3A, 0xD7, 0x81, 0xCE, 0xB5, 0xA7, 0x73, 0xED, 0x8C, 0xAB, 0x74, 0x9D, 0xB5,
-    0xAB, 0xD6, 0x7B, 0x5C, 0xA0, 0x1A, 0x25, 0x1B, 0x55, 0xED, 0xF1, 0x28, 0xFB, 0xBC, 0x4E, 0x3C,
-    0xE7, 0x9D, 0xD3, 0xCE, 0x59, 0xE7, 0xA4, 0x73, 0xCE, 0x39, 0x85, 0xCF, 0x4B, 0x30, 0xD3, 0x73,
-    0x4C, 0x34, 0xDC, 0x8B, 0x56, 0xE3, 0xAE, 0x13, 0x16, 0xEA, 0x72, 0xDA, 0xB1, 0xDD, 0xE7, 0xF6,
-    0x2A, 0xD0, 0x9D, 0x4A, 0xC9, 0xBA, 0xA1, 0x92, 0xBF, 0xE7, 0x87, 0x8A, 0x0E, 0x19, 0x03, 0x00,
-    0x8B, 0xA2, 0x0E, 0xE0, 0xC3, 0xC5, 0x37, 0xE6, 0x88, 0x31, 0x8A, 0x8A, 0x15, 0x92, 0x4D, 0xC4,
-    0xFD, 0x32, 0xD2, 0x0B, 0xF1, 0x1C, 0x58, 0x45, 0x13, 0x6D, 0xB1, 0x13, 0x3F, 0x82, 0xAE, 0xBC,
-    0x47, 0x3F, 0xC5, 0x16, 0x3A, 0x6D, 0x0D, 0x3B, 0xF8, 0xAC, 0x46, 0x40, 0x80, 0xC3, 0x13, 0xD4,
-    0xE0, 0x6A, 0xE5, 0xDD, 0x24, 0x1B, 0xCB, 0x55, 0x9F, 0x52, 0xB3, 0x53, 0xE9, 0xF6, 0x26, 0xE8,
-    0x25, 0x24, 0x82, 0x72, 0xE5, 0x71, 0x23, 0x2D, 0xC9, 0xB0, 0x8B, 0x4A, 0x6C, 0x40, 0x86, 0x02,
-    0xBC, 0xAC, 0xC9, 0xEA, 0x05, 0xC1, 0xD3, 0x04, 0x7F, 0xE0, 0x5B, 0xF8, 0xE6, 0x10, 0x1F, 0x63,
-    0x03, 0xBA, 0x53, 0x8A, 0x17, 0xA7, 0xD3, 0x4E, 0xEA, 0x20, 0x50, 0x29, 0x61, 0x6D, 0xBD, 0x16,
-    0x29, 0x7F, 0xC7, 0x6A, 0x46, 0x7A, 0x58, 0x99, 0xE3, 0x4D, 0x47, 0x8F, 0xF5, 0xF5, 0x2D, 0xB4,
-    0xB4, 0xC7, 0xA1, 0x7A, 0x86, 0xE1, 0x45, 0xAC, 0x4D, 0x7E, 0x6C, 0x4E, 0x11, 0x4C, 0x73, 0x69,
-    0x86, 0x08, 0x28, 0xF9, 0x02, 0xD8, 0x15, 0xD7, 0xA0, 0xA2, 0x03, 0xCA, 0x5E, 0xDD, 0x0E, 0xC0,
-    0x7A, 0xD5, 0x95, 0xD7, 0x02, 0xCC, 0xAD, 0x7B, 0x6F, 0xE5, 0x62, 0x37, 0x8B, 0x5C, 0xB6, 0xEB,
-    0x38, 0x4E, 0xFC, 0x91, 0x34, 0xF0, 0x00, 0xB0, 0xB6, 0x8B, 0x02, 0xEA, 0x53, 0x01, 0x73, 0x09,
-    0x12, 0x8E, 0x6D, 0x78, 0xDA, 0x08, 0x5E, 0x88, 0xD8, 0xB9, 0x2F, 0x36, 0x25, 0xC7, 0x89, 0x9C,
-    0x78, 0x3C, 0x9E, 0xCC, 0x61, 0x80, 0xE0, 0xBB, 0xD1, 0x9C, 0xFC, 0x42, 0xAC, 0x1C, 0xB6, 0x6E,
-    0x9D, 0x23, 0x13, 0xF0, 0xD1, 0x4D, 0xE5, 0x48, 0x95, 0x82, 0x7F, 0xBD, 0xA3, 0xCF, 0x8F, 0x78,
-    0xFF, 0xD4, 0xCE, 0xD8, 0xAE, 0x19, 0xFB, 0x89, 0xFD, 0x41, 0x39, 0x43, 0x60, 0xB1, 0xEB, 0x84,
-    0x33, 0x97, 0x2D, 0x78, 0x4C, 0x39, 0x07, 0x56, 0xE0, 0x83, 0x2B, 0xA8, 0x8A, 0xD9, 0x58, 0x6E,
-    0x12, 0x8F, 0x15, 0x27, 0x5A, 0x74, 0xE2, 0xD9, 0x5E, 0x22, 0x66, 0xE0, 0xA7, 0xA5, 0x27, 0x06,
-    0x56, 0x33, 0x05, 0x44, 0xAC, 0x3D, 0x01, 0x68, 0x23, 0xDF, 0xFF, 0x44, 0x82, 0x6D, 0x41, 0x12,
-    0xE7, 0x97, 0xE0, 0x63, 0x31, 0xCA, 0x54, 0x8F, 0x32, 0xF1, 0xA2, 0xD5, 0xC2, 0x62, 0x01, 0x6B,
-    0x8B, 0xED, 0xF6, 0x26, 0x64, 0x3F, 0xF6, 0xEF, 0x0A, 0xF4, 0xDB, 0x8D, 0x15, 0x2A, 0xB3, 0x88,
-    0x60, 0xDF, 0x98, 0xF0, 0xDE, 0x79, 0x5A, 0x78, 0xBB, 0x6D, 0x9E, 0x5E, 0x92, 0x3B, 0x1E, 0x12,
-    0xA7, 0x63, 0x82, 0x6B, 0x3A, 0x2A, 0x3E, 0x4C, 0x3D, 0xBE, 0x87, 0x1B, 0xBB, 0x47, 0x77, 0xE8,
-    0xF1, 0x98, 0x16, 0x7B, 0xA2, 0xA9, 0x72, 0xCD, 0xCC, 0x15, 0xDC, 0x18, 0x33, 0xB5, 0x59, 0x45,
-    0xFD, 0x94, 0x42, 0x5B, 0x69, 0xDF, 0xA1, 0xFF, 0x4C, 0x90, 0x2A, 0x1A, 0x40, 0xD1, 0x1C, 0x0F,
-    0x32, 0x89, 0x01, 0x57, 0xFE, 0x30, 0x1D, 0x44, 0x07, 0xF9, 0x6A, 0x64, 0x92, 0x0C, 0xF2, 0xDE,
-    0xC4, 0xC6, 0x50, 0x9F, 0x0C, 0x29, 0xD8, 0xA6, 0x28, 0x45, 0xFE, 0x4C, 0xF6, 0x32, 0xE5, 0xEF,
-    0x30, 0x75, 0x38, 0x91, 0xA7, 0xEF, 0xEC, 0x96, 0xDB, 0x3B, 0xAC, 0x29, 0xB8, 0xED, 0xCD, 0x43,
-    0x64, 0xF5, 0x47, 0xCB, 0xEF, 0x43, 0xCD, 0x6C, 0x95, 0xCB, 0x72, 0xB4, 0xED, 0x95, 0x33, 0xF9,
-    0x13, 0x85, 0x67, 0xE5, 0xA7, 0x98, 0x02, 0x06, 0x06, 0xFE, 0x3C, 0x68, 0x64, 0x5A, 0xD3, 0xA1,
-    0x44, 0xBF, 0xCB, 0xBA, 0xB3, 0x58, 0xEB, 0xCE, 0x6A, 0xAD, 0x3B, 0xEB, 0x9E, 0x5A, 0x77, 0xB6,
-    0x51, 0xB0, 0xBB, 0x33, 0xD4, 0x9D, 0x75, 0x18, 0xD5, 0x83, 0x70, 0xAA, 0x3B, 0x63, 0x06, 0xD8,
-    0xEF, 0x4F, 0x47, 0x11, 0xC5, 0x84, 0xFF, 0x78, 0x0A, 0x91, 0x18, 0x1D, 0xF1, 0xE4, 0x89, 0x15,
-    0x16, 0xEB, 0xEE, 0x3C, 0xB6, 0x33, 0xDA, 0x03, 0xBD, 0x46, 0x14, 0x57, 0x28, 0x7A, 0x13, 0x64,
-    0x40, 0x7A, 0xE0, 0x7C, 0x63, 0xBC, 0x55, 0x30, 0x98, 0xD1, 0x30, 0x87, 0xE8, 0xC3, 0xE3, 0x59,
-    0x75, 0x01, 0x1B, 0x12, 0xB0, 0x3B, 0x26, 0x55, 0x02, 0x5B, 0x9E, 0x83, 0xF1, 0x48, 0x70, 0xE5,
-    0x46, 0x26, 0x38, 0x43, 0x35, 0x45, 0x91, 0x17, 0x68, 0x4F, 0x5C, 0x0E, 0x6E, 0x1B, 0x88, 0x5D,
-    0xDA, 0x22, 0xC6, 0xE7, 0x38, 0xCF, 0xB7, 0x67, 0x63, 0xB6, 0x5E, 0x90, 0x99, 0xAB, 0x6A, 0x4E,
-    0x0E, 0xD2, 0xC1, 0xE8, 0xC4, 0x26, 0x3E, 0x91, 0x50, 0xB2, 0x4C, 0xCA, 0x2C, 0x0D, 0xCB, 0x22,
-    0x0D, 0x53, 0xE6, 0xF9, 0x79, 0x87, 0xE5, 0xA1, 0xB8, 0x83, 0x01, 0xF7, 0xA0, 0x4A, 0x56, 0xDA,
-    0xC9, 0x14, 0xFC, 0xBE, 0x58, 0xBC, 0x3D, 0xD1, 0xF2, 0x41, 0x1A, 0x2A, 0xD2, 0xB8, 0x4C, 0x9E,
-    0x20, 0xA7, 0x2E, 0x13, 0x87, 0x32, 0x7D, 0x97, 0xD5, 0x6B, 0x96, 0xC3, 0x90, 0xFE, 0x33, 0x31,
-    0x69, 0xCE, 0x5C, 0xC2, 0x58, 0xC1, 0x63, 0x77, 0x63, 0x00, 0x79, 0x6B, 0xC6, 0x42, 0x5F, 0x6C,
-    0xC8, 0xBC, 0x56, 0x86, 0x51, 0x26, 0xE9, 0x15, 0x13, 0x94, 0x27, 0x02, 0xC8, 0x99, 0x8E, 0x96,
-    0x3B, 0x7B, 0x1E, 0x67, 0xE8, 0x11, 0x17, 0x77, 0xD4, 0x20, 0xE7, 0x8B, 0xA9, 0x3B, 0x76, 0x7C,
-    0x9C, 0x83, 0x86, 0x66, 0xC5, 0xB9, 0x5E, 0x4A, 0x72, 0xC7, 0x73, 0x61, 0x1F, 0x1B, 0xA3, 0x86,
-    0xAB, 0x6C, 0x6D, 0xD1, 0xD6, 0xDF, 0xB5, 0x68, 0xCF, 0x58, 0x43, 0xB0, 0x05, 0x8F, 0xF2, 0x38,
-    0xF7, 0x9B, 0x07, 0xBA, 0xF9, 0x86, 0x41, 0x9C, 0xCC, 0xE1, 0x31, 0x6B, 0x08, 0x8B, 0x65, 0x4A,
-    0x86, 0x5E, 0x55, 0x91, 0xDA, 0xFA, 0x56, 0xB5, 0x87, 0x08, 0x87, 0xD4, 0xAB, 0x76, 0x49, 0xDF,
-    0x17, 0xEA, 0xCE, 0x16, 0x49, 0xC9, 0xE3, 0xA5, 0x8D, 0x9A, 0x76, 0x3D, 0xBE, 0x83, 0xC2, 0xFC,
-    0x96, 0xE2, 0xAF, 0x85, 0x64, 0xED, 0xF2, 0x60, 0x4C, 0x93, 0x47, 0xAC, 0xD5, 0xE3, 0x51, 0xBA,
-    0x5A, 0x4D, 0x7A, 0x37, 0xE8, 0x54, 0x96, 0xF2, 0x68, 0xE7, 0x32, 0x4F, 0xC4, 0x6D, 0xFE, 0x9B,
-    0xF6, 0x23, 0xDA, 0xCC, 0xE7, 0x7D, 0xA0, 0x31, 0xC7, 0x3E, 0x4A, 0x59, 0x81, 0x09, 0xAD, 0xF0,
-    0x65, 0xC0, 0xC1, 0xC3, 0x31, 0xC9, 0x59, 0x68, 0x35, 0x35, 0xD2, 0x58, 0xC5, 0x5C, 0x77, 0xA1,
-    0x93, 0xF7, 0x4A, 0xE8, 0xBD, 0xFA, 0x67, 0x79, 0xAF, 0xCD, 0xC3, 0x19, 0xC1, 0x20, 0x52, 0xED,
-    0x48, 0xFA, 0x88, 0x89, 0x8C, 0xAF, 0x57, 0x26, 0x79, 0x37, 0x37, 0xBC, 0xB6, 0x46, 0x1C, 0x91,
-    0x3D, 0x06, 0x8E, 0xE9, 0x8B, 0x9D, 0x0E, 0x10, 0xC7, 0x9C, 0x38, 0xC2, 0x08, 0x4B, 0x54, 0xFC,
-    0xEA, 0x63, 0x77, 0x76, 0xEC, 0xFE, 0x3D, 0x46, 0xDA, 0xED, 0xCB, 0x8E, 0x3D, 0x9E, 0x92, 0xF2,
-    0xF9, 0x0B, 0xE9, 0x0C, 0x7C, 0xFD, 0xEF, 0xD9, 0x9D, 0xE7, 0xD3, 0x19, 0xEE, 0x00, 0xCE, 0x8D,
-    0xB1, 0x4F, 0x1D, 0x31, 0xCA, 0x1E, 0x90, 0x41, 0xF4, 0x9E, 0x68, 0xC5, 0x5D, 0x85, 0xEC, 0x9B,
-    0x84, 0x3F, 0xC1, 0xEC, 0x70, 0xFD, 0x81, 0x75, 0x54, 0x0C, 0x30, 0x9C, 0xFD, 0x07, 0x35, 0x63,
-    0x74, 0xBF, 0x52, 0x56, 0x9E, 0x24, 0x33, 0x13, 0xAB, 0xC4, 0x1D, 0xD1, 0x3B, 0xE1, 0x50, 0x34,
-    0xE9, 0xA9, 0xF8, 0x21, 0xB7, 0x11, 0x7A, 0x23, 0x79, 0xDA, 0x3B, 0x8E, 0x14, 0xC5, 0x5C, 0x80,
-    0xF6, 0x3F, 0xAB, 0x49, 0xAD, 0xF6, 0x68, 0x4C, 0xDF, 0x73, 0x76, 0x0F, 0x06, 0x6F, 0x0E, 0x8F,
-    0x8A, 0xAE, 0x0A, 0x95, 0x98, 0x8A, 0x9B, 0x2D, 0x4D, 0xF2, 0xBD, 0x30, 0xD5, 0xB4, 0x62, 0x0C,
-    0x5A, 0xE2, 0xD6, 0xA9, 0xDD, 0x87, 0x78, 0x85, 0xFD, 0x1C, 0xC5, 0x2B, 0xD6, 0x9F, 0xAE, 0xA6,
-    0x02, 0xD2, 0xE6, 0x30, 0x7B, 0x9D, 0x31, 0xD7, 0x72, 0xB6, 0x70, 0xBC, 0xA3, 0xD6, 0x9F, 0x3D,
-    0xC2, 0xFA, 0x75, 0x07, 0x9A, 0x90, 0x19, 0x53, 0x32, 0x63, 0x52, 0x66, 0x4C, 0xCB, 0xAC, 0x25,
-    0x66, 0x5E, 0x57, 0xD8, 0xF5, 0xBA, 0x5B, 0x64, 0x22, 0x33, 0x5D, 0x77, 0x0B, 0x08, 0xBE, 0xDE,
-    0xA0, 0x31, 0x77, 0xF2, 0xB3, 0x9F, 0x88, 0xF5, 0xAF, 0x91, 0x88, 0xB9, 0xEF, 0x32, 0x7F, 0xA4,
-    0x1B, 0xE2, 0x0F, 0xFD, 0x7C, 0xE5, 0xD9, 0xF8, 0xB7, 0x60, 0xFE, 0xDA, 0x4F, 0xCB, 0xB4, 0xC7,
-    0xCC, 0x69, 0x5F, 0x79, 0xB9, 0xA9, 0x84, 0xD5, 0xF1, 0xF3, 0xBF, 0x59, 0xFC, 0xAE, 0xAF, 0x9B,
-    0xA2, 0x3C, 0xFB, 0x29, 0x72, 0xEF, 0x5F, 0x9A, 0x31, 0xD5, 0x92, 0x95, 0xDC, 0xA5, 0x33, 0x22,
-    0x8E, 0xFF, 0x85, 0xAB, 0x38, 0xD3, 0x9A, 0x9F, 0x5D, 0xBF, 0x7C, 0xED, 0x27, 0xE5, 0xF6, 0x3B,
-    0xD8, 0x82, 0x59, 0x1C, 0xC7, 0xB8, 0x3D, 0xCA, 0x80, 0xFC, 0x16, 0xA5, 0x19, 0x61, 0xF5, 0x80,
-    0x95, 0x36, 0xDD, 0x59, 0x4F, 0x04, 0x4E, 0xE5, 0x35, 0xB4, 0x01, 0x43, 0x20, 0xE9, 0x6B, 0x41,
-    0x1B, 0x12, 0x13, 0xA7, 0xC3, 0x2A, 0x06, 0x90, 0xC0, 0x55, 0xB6, 0x10, 0xC0, 0x15, 0xA5, 0x54,
-    0xB4, 0x2A, 0x6A, 0xD3, 0xC7, 0x83, 0x81, 0xB1, 0x2A, 0x6C, 0x3C, 0x84, 0x09, 0x55, 0x35, 0xA2,
-    0x75, 0xF6, 0xED, 0xEA, 0x55, 0x05, 0x47, 0x83, 0xBB, 0x53, 0x45, 0x54, 0x73, 0x4B, 0x34, 0x26,
-    0x5A, 0x47, 0xEE, 0xAD, 0xD2, 0x81, 0x37, 0x6E, 0x34, 0x2C, 0xBE, 0xA3, 0x67, 0x4A, 0xB7, 0x27,
-    0x6B, 0x39, 0x9D, 0x7E, 0x78, 0x76, 0x2C, 0x15, 0x08, 0x7E, 0x39, 0xDA, 0xA4, 0x28, 0xCF, 0xF4,
-    0x97, 0xED, 0xB5, 0x94, 0xDE, 0xF2, 0x07, 0x8A, 0xF7, 0x86, 0x7C, 0xB0, 0xC7, 0x2F, 0x71, 0xEE,
-    0xD9, 0x21, 0x44, 0x66, 0x56, 0xE2, 0x4D, 0xE6, 0x6B, 0xE4, 0x97, 0x08, 0x25, 0xBF, 0x40, 0x39,
-    0x4A, 0x11, 0xA4, 0xE1, 0xB2, 0x00, 0x75, 0x1A, 0xA5, 0x78, 0x2C, 0xCB, 0x11, 0x99, 0x70, 0x4B,
-    0xB1, 0xC6, 0x4D, 0xC7, 0x1F, 0x20, 0x9B, 0xE8, 0x7D, 0xD5, 0xE3, 0x94, 0x37, 0x69, 0xFC, 0x9F,
-    0x59, 0xC3, 0x5C, 0x7C, 0xF0, 0x53, 0x8B, 0x53, 0xB1, 0x78, 0x1E, 0xFE, 0xC8, 0x5E, 0x6D, 0x91,
-    0x18, 0x8E, 0xAE, 0xDA, 0x7F, 0x6D, 0x10, 0xF4, 0xC4, 0xC6, 0xFE, 0xB4, 0x41, 0x49, 0xD6, 0xB6,
-    0x29, 0xFE, 0x8B, 0xF7, 0xFC, 0xDF, 0x36, 0xD9, 0x37, 0x3C, 0x8B, 0xDA, 0x33, 0xC9, 0xFF, 0x97,
-    0xBA, 0x17, 0x60, 0x0A, 0x02, 0xD5, 0x7F, 0x21, 0x0F, 0x5A, 0x50, 0x1C, 0x69, 0xC7, 0x70, 0x94,
-    0x5F, 0xE1, 0x82, 0x7A, 0x34, 0xCD, 0xBF, 0x8A, 0xC4, 0x5A, 0x90, 0x66, 0xDE, 0xB8, 0x67, 0x56,
-    0x4B, 0x5E, 0xA7, 0x6F, 0x85, 0x31, 0xBD, 0xD6, 0x37, 0x79, 0x2D, 0xCB, 0x16, 0x45, 0x79, 0x9C,
-    0xC3, 0xDF, 0xB2, 0x21, 0xB3, 0xDE, 0xB9, 0x33, 0x56, 0x09, 0x74, 0x5E, 0x13, 0x32, 0x4F, 0x2D,
-    0xCA, 0xCD, 0xE2, 0x95, 0xB0, 0x93, 0xD1, 0x39, 0x3C, 0x8D, 0x45, 0x8E, 0xAB, 0x94, 0xF6, 0x51,
-    0x99, 0x54, 0x26, 0x03, 0x1A, 0x2A, 0xAA, 0xBB, 0x16, 0x29, 0xA3, 0xA4, 0xFE, 0x67, 0xEB, 0xF1,
-    0x3B, 0x06, 0x1A, 0x7B, 0x0D, 0x8A, 0xF9, 0xCB, 0xA6, 0xF8, 0x1C, 0x39, 0xF1, 0x5F, 0xD5, 0xD9,
-    0xBF, 0xE1, 0xB2, 0xF7, 0x93, 0x32, 0xF9, 0x8A, 0x9A, 0x5A, 0xC6, 0xFA, 0x25, 0x34, 0x69, 0xA4,
-    0x3B, 0x1F, 0x4D, 0x42, 0x4D, 0x5C, 0xB6, 0x15, 0x7A, 0x35, 0x68, 0xBC, 0x73, 0xA2, 0xFB, 0x22,
-    0xBD, 0xFA, 0xC3, 0xEB, 0xE2, 0xE3, 0x9D, 0x13, 0xAF, 0x3A, 0x38, 0xAF, 0xBE, 0x9D, 0x5B, 0x54,
-    0x15, 0xA2, 0x78, 0xCF, 0x24, 0x15, 0x32, 0xED, 0x98, 0x60, 0xF9, 0x9D, 0xF3, 0xF7, 0x36, 0x8D,
-    0xD0, 0x1E, 0x57, 0x4E, 0x0B, 0x94, 0xDC, 0x66, 0x0A, 0x42, 0x03, 0x1B, 0x10, 0xF7, 0x3F, 0x61,
-    0xC6, 0xEC, 0xD3, 0x45, 0x8F, 0x2C, 0x8A, 0x3D, 0x70, 0x0D, 0xEA, 0x3B, 0x28, 0x8B, 0x39, 0x23,
-    0x6E, 0xE1, 0x63, 0x7E, 0x7B, 0x14, 0x6F, 0x04, 0xF1, 0x34, 0x80, 0x45, 0x38, 0xF1, 0xCF, 0x5A,
-    0x6C, 0x03, 0xE7, 0x38, 0x2D, 0xBD, 0xB2, 0x26, 0x77, 0x0D, 0x5D, 0x14, 0x12, 0x61, 0x8B, 0x1D,
-    0x20, 0xA7, 0x23, 0x33, 0x1C, 0xE6, 0x38, 0x2E, 0xE1, 0x1A, 0x02, 0xD4, 0x90, 0xBD, 0xFA, 0x10,
-    0xE7, 0x32, 0xBB, 0x40, 0x18, 0x1A, 0xF5, 0x2D, 0xA4, 0xDF, 0xAF, 0xC7, 0xE6, 0x3D, 0x3D, 0xCD,
-    0xCC, 0xA7, 0xFA, 0x01, 0x3B, 0xDD, 0x97, 0x72, 0x16, 0xF7, 0xA5, 0x18, 0x61, 0xC5, 0xF2, 0x81,
-    0xEF, 0x71, 0xAD, 0x43, 0x79, 0xDE, 0x5A, 0x71, 0x86, 0x5E, 0x03, 0x5C, 0x83, 0x0E, 0x65, 0x0C,
-    0x41, 0x87, 0x82, 0x1C, 0x7D, 0xE5, 0xA8, 0x15, 0xB4, 0x59, 0x48, 0x6B, 0x49, 0x11, 0xBF, 0x7B,
-    0x89, 0xDF, 0x09, 0xC2, 0x62, 0xA2, 0x62, 0x79, 0x22, 0xBD, 0xC8, 0xCA, 0x58, 0x96, 0xAE, 0x0B,
-    0xC1, 0xE5, 0x34, 0xAC, 0xE5, 0x66, 0x1B, 0xD9, 0xE0, 0x6D, 0x00, 0xF7, 0xB6, 0x2E, 0x30, 0xDE,
-    0xFD, 0xE5, 0xF7, 0xD1, 0xE0, 0x80, 0x04, 0x65, 0xC0, 0x0A, 0x2D, 0x6C, 0xC3, 0x98, 0x1C, 0x9C,
-    0x4F, 0x32, 0x58, 0x16, 0x95, 0x56, 0xE6, 0x0A, 0x70, 0xDF, 0xC6, 0x1F, 0xB7, 0xA1, 0xD1, 0x77,
-    0xE5, 0xE3, 0xCE, 0x80, 0x1D, 0xAB, 0x12, 0x59, 0x98, 0xF7, 0xA7, 0xD2, 0x73, 0x56, 0x40, 0x30,
-    0x2F, 0x3B, 0x5F, 0x96, 0xE9, 0x2E, 0x2B, 0xB1, 0xAD, 0x92, 0xE8, 0xDF, 0x6F, 0x0D, 0x88, 0x19,
-    0x71, 0x31, 0x3B, 0x69, 0xCC, 0x9B, 0xCC, 0x19, 0x38, 0x3A, 0xC3, 0x53, 0x9D, 0xF7, 0xF2, 0x58,
-    0x1B, 0xD3, 0x2F, 0x7A, 0xE2, 0x43, 0x63, 0x02, 0x7C, 0x13, 0x55, 0x98, 0xC7, 0xFD, 0xCD, 0x6C,
-    0xBC, 0x8B, 0xAC, 0xDF, 0x42, 0x75, 0x69, 0x71, 0x08, 0x4F, 0xD3, 0x49, 0x9B, 0x9F, 0x1D, 0xB2,
-    0x8F, 0x67, 0x87, 0xD0, 0xFD, 0x29, 0xCF, 0xE7, 0x6B, 0xAA, 0xDA, 0x98, 0xA3, 0x2A, 0xED, 0x4F,
-    0x10, 0xA1, 0x0F, 0x70, 0xD7, 0x30, 0x81, 0x2B, 0x0D, 0xF1, 0xF5, 0x2C, 0xFE, 0x24, 0xB9, 0x9E,
-    0x13, 0x9D, 0x39, 0x42, 0xCE, 0xCC, 0x7C, 0x5F, 0x5C, 0x25, 0xEA, 0x2E, 0x32, 0x5C, 0x99, 0x8C,
-    0xD1, 0x1E, 0xAB, 0xC1, 0xBD, 0xE1, 0x94, 0x10, 0x72, 0x6E, 0xDF, 0x90, 0x55, 0x37, 0x37, 0xD9,
-    0x7F, 0x0F, 0xA2, 0x49, 0xF8, 0xDE, 0xA1, 0xEE, 0x38, 0xEB, 0x85, 0x0B, 0x06, 0x55, 0x36, 0xFD,
-    0x35, 0xED, 0x5C, 0xBF, 0x93, 0xDC, 0x46, 0x76, 0x6E, 0x00, 0xB5, 0x3B, 0x55, 0x44, 0x00, 0x05,
-    0x94, 0x5D, 0xA6, 0xAA, 0x8C, 0xE4, 0x82, 0x3B, 0x96, 0x4D, 0xFC, 0x03, 0x22, 0x81, 0x93, 0x02,
-    0x05, 0x4A, 0x36, 0xE0, 0x5A, 0x21, 0x2F, 0x60, 0xE0, 0x52, 0xB2, 0xE9, 0xB9, 0x4A, 0x16, 0xC0,
-    0x4B, 0x2E, 0x34, 0x1D, 0xF8, 0x62, 0x06, 0x0A, 0xA4, 0x65, 0xC0, 0xE4, 0x02, 0x96, 0x8B, 0x24,
-    0x70, 0x4C, 0x9D, 0xE0, 0x54, 0xE5, 0x73, 0xE0, 0xE0, 0xA0, 0x2B, 0x32, 0x30, 0x13, 0xA3, 0xCE,
-    0x38, 0x1B, 0x24, 0x31, 0xD3, 0x7E, 0xDF, 0xF7, 0xBA, 0x31, 0x33, 0xCB, 0x95, 0x8A, 0x94, 0xA8,
-    0xD5, 0x2E, 0xED, 0x29, 0x6E, 0xF7, 0xDB, 0x59, 0xA0, 0xD1, 0xFD, 0xBD, 0xD7, 0xAF, 0xDF, 0x2F,
-    0xD0, 0x18, 0xF9, 0x04, 0x37, 0xD1, 0x9A, 0xC5, 0x68, 0x82, 0xDA, 0x16, 0xF1, 0x64, 0x52, 0x6B,
-    0x87, 0xC5, 0x64, 0xEA, 0x2E, 0x5E, 0x05, 0x53, 0x68, 0xAB, 0xC0, 0x56, 0xE3, 0xC2, 0x1A, 0x53,
-    0xFF, 0xB6, 0x4F, 0x96, 0xC6, 0xE4, 0xCF, 0xDB, 0x74, 0x92, 0x6E, 0x65, 0x32, 0xE9, 0xE4, 0x27,
-    0x1F, 0x8D, 0x49, 0xD7, 0xDD, 0x60, 0x8C, 0x5C, 0x76, 0x7C, 0xB7, 0x75, 0xA5, 0xBB, 0x9D, 0x83,
-    0x8D, 0x86, 0x43, 0xF7, 0x06, 0x0F, 0x2A, 0x3B, 0x13, 0xDA, 0xC2, 0xD8, 0xC6, 0x18, 0xDB, 0xE1,
-    0x0B, 0x93, 0x59, 0x2B, 0xF7, 0xC8, 0xB7, 0xB6, 0xE2, 0x94, 0xF7, 0x8C, 0x7E, 0x2E, 0xB1, 0xAD,
-    0xE5, 0xC2, 0x3D, 0xB4, 0x07, 0xB6, 0xCD, 0x1B, 0xB9, 0x68, 0x4A, 0x9A, 0x78, 0x19, 0xD9, 0xA4,
-    0x4A, 0x47, 0x63, 0xEF, 0x98, 0xAC, 0x37, 0x76, 0xC2, 0xE0, 0x75, 0x67, 0xCA, 0x1E, 0xC3, 0xA3,
-    0x9D, 0x89, 0xF9, 0xD7, 0x1E, 0xD7, 0xC8, 0xAF, 0xB8, 0xB2, 0xE5, 0x5D, 0x8D, 0x49, 0x64, 0x84,
-    0xCA, 0x60, 0x34, 0x3E, 0x7E, 0xE2, 0x64, 0x3A, 0x3C, 0xF5, 0xAA, 0xF1, 0x9F, 0xEB, 0xDA, 0x05,
-    0x2B, 0x53, 0x5A, 0x1B, 0xD8, 0x87, 0x56, 0xFB, 0xDF, 0x58, 0xB9, 0xA3, 0x35, 0x71, 0x53, 0x9A,
-    0x40, 0x46, 0x5A, 0x34, 0x57, 0x5C, 0xFF, 0xAE, 0xF6, 0xBF, 0x1B, 0xB4, 0x97, 0xF1, 0xD9, 0x3F,
-    0x32, 0xEE, 0xEF, 0xAF, 0xAF, 0x37, 0x73, 0x8F, 0x79, 0x00, 0xAA, 0xDE, 0xA4, 0x80, 0x30, 0x5F,
-    0x9A, 0x1A, 0x73, 0x4E, 0x74, 0x49, 0x60, 0x7D, 0xA7, 0x8B, 0x58, 0x2F, 0x8B, 0x17, 0xCA, 0xA5,
-    0xAD, 0x76, 0x5D, 0x6E, 0x43, 0x3B, 0x65, 0x7D, 0x6E, 0xDF, 0xB3, 0x53, 0x2C, 0x7C, 0x29, 0xB2,
-    0x29, 0x6A, 0x23, 0x5B, 0x24, 0x53, 0x5C, 0xA1, 0x5B, 0x3E, 0x30, 0xE8, 0x64, 0x20, 0x7E, 0x69,
-    0x5E, 0xB2, 0x03, 0xFF, 0x45, 0xCA, 0x20, 0x0D, 0x32, 0xED, 0x1C, 0xD3, 0xB1, 0xCF, 0x38, 0xAB,
-    0xDA, 0xFE, 0xBB, 0xCC, 0x5B, 0xE4, 0xF1, 0x03, 0x74, 0x66, 0xCF, 0xAC, 0x3F, 0x22, 0xB4, 0x7F,
-    0x3B, 0xFF, 0x32, 0x05, 0xE3, 0x4C, 0x97, 0x71, 0x3F, 0xD3, 0x19, 0x24, 0xC8, 0x7D, 0x12, 0x11,
-    0x28, 0xFF, 0x89, 0x56, 0xE6, 0x6B, 0x3F, 0xB9, 0xB5, 0xFF, 0x81, 0x19, 0xC8, 0xA7, 0x15, 0xDA,
-    0x82, 0x47, 0xF2, 0xE9, 0x84, 0x93, 0x07, 0x56, 0x58, 0x5C, 0x44, 0x32, 0xA8, 0x6D, 0x43, 0xDB,
-    0xC8, 0x43, 0xC1, 0x3A, 0x99, 0x5A, 0xDD, 0x07, 0x83, 0x3C, 0x80, 0x28, 0xE7, 0x43, 0xD0, 0x9B,
-    0x6C, 0x49, 0x3A, 0x9B, 0x84, 0x86, 0xB0, 0x0B, 0x9D, 0x72, 0x5D, 0x3D, 0x69, 0x88, 0x7A, 0x80,
-    0x25, 0x81, 0x5E, 0x01, 0x84, 0x66, 0xA6, 0x63, 0x6B, 0x66, 0x3A, 0x5D, 0xAD, 0x69, 0xC5, 0x45,
-    0xE9, 0x7A, 0x58, 0xD3, 0x64, 0x1B, 0xC6, 0x5F, 0xEA, 0x30, 0xFA, 0x5C, 0x99, 0x59, 0xA1, 0x34,
-    0x76, 0x96, 0x0C, 0x39, 0x80, 0x16, 0x01, 0x97, 0x3F, 0x05, 0xA4, 0xE5, 0xBE, 0x72, 0x54, 0x3A,
-    0xC4, 0x2A, 0x7A, 0x13, 0xF5, 0x32, 0x27, 0x79, 0x24, 0x65, 0xB6, 0xD7, 0xB5, 0x47, 0x58, 0x3B,
-    0xE8, 0x55, 0xE1, 0x68, 0x07, 0xD3, 0x4F, 0xCC, 0xAE, 0xC7, 0x33, 0x2B, 0x72, 0x8F, 0x5A, 0xD2,
-    0x2D, 0x8D, 0xDE, 0x28, 0x57, 0x8F, 0x46, 0x31, 0x93, 0xA5, 0x72, 0xD9, 0x21, 0xA6, 0x57, 0xEB,
-    0x4A, 0x6B, 0x37, 0x0E, 0x01, 0x9B, 0xC9, 0x4C, 0xB4, 0x8D, 0x40, 0xAD, 0x70, 0x85, 0x7C, 0x1A,
-    0xD1, 0x8A, 0x9E, 0xFE, 0x0D, 0x41, 0x97, 0x05, 0x47, 0x5D, 0x04, 0xCD, 0x40, 0xB2, 0x5D, 0x58,
-    0x07, 0x43, 0x58, 0x41, 0x96, 0x3C, 0x52, 0xC3, 0x1A, 0xA8, 0x6E, 0x8D, 0x53, 0xB3, 0x86, 0xA9,
-    0xF0, 0x28, 0xC5, 0xAB, 0x19, 0xA4, 0xD4, 0xE1, 0xAB, 0x4A, 0xA0, 0x77, 0x10, 0xC9, 0x00, 0xBD,
-    0x22, 0x24, 0xA2, 0x19, 0x38, 0x80, 0x22, 0xBB, 0xFF, 0x91, 0xC3, 0x27, 0x5E, 0xC3, 0x93, 0x28,
-    0x3A, 0x6F, 0xEF, 0x17, 0xE6, 0x96, 0xC0, 0x03, 0x49, 0x6A, 0xCD, 0xD2, 0x60, 0xD8, 0x77, 0xF0,
-    0x88, 0x0F, 0x7A, 0xB7, 0xCA, 0x84, 0xC2, 0x0C, 0x6A, 0xA1, 0xDA, 0x4C, 0xA8, 0xD0, 0x7A, 0x0C,
-    0x54, 0xBA, 0x67, 0xAA, 0x1E, 0xAC, 0x2C, 0xD3, 0xDA, 0x66, 0x61, 0x57, 0x75, 0x8B, 0xC7, 0x35,
-    0xC9, 0x4A, 0xC6, 0x8B, 0x1F, 0x7F, 0x24, 0xFB, 0x6F, 0x8C, 0x6C, 0x2B, 0xAA, 0x6E, 0x25, 0x53,
-    0x96, 0xA9, 0x25, 0xD8, 0x4A, 0x39, 0xE6, 0xBB, 0x4B, 0x45, 0xC6, 0x45, 0x70, 0x4D, 0x84, 0x14,
-    0x3A, 0x41, 0xA9, 0x48, 0x75, 0xAC, 0x93, 0x44, 0xA5, 0x32, 0x11, 0x53, 0xBD, 0x43, 0x6E, 0xD5,
-    0x51, 0xE4, 0x5F, 0xD4, 0x70, 0x64, 0x59, 0x7F, 0xD4, 0x64, 0x63, 0x88, 0xB9, 0x88, 0x3E, 0x91,
-    0x19, 0xD4, 0x72, 0x14, 0xEC, 0x5F, 0xC3, 0xAC, 0x72, 0x9B, 0x61, 0x56, 0x81, 0x1D, 0x33, 0x0B,
-    0x50, 0x1A, 0xB3, 0xB3, 0xB1, 0x97, 0x28, 0x36, 0xC3, 0x4C, 0x84, 0x14, 0xD7, 0x6C, 0xE5, 0x96,
-    0x9A, 0x2C, 0x3D, 0x31, 0x9D, 0x14, 0x11, 0x14, 0x8E, 0x58, 0x78, 0x99, 0x89, 0x67, 0xE1, 0xD9,
-    0x22, 0xB0, 0x41, 0x73, 0x10, 0x58, 0x94, 0xDD, 0x22, 0x9C, 0x46, 0x79, 0x81, 0x48, 0x3D, 0x91,
-    0x79, 0x7D, 0x94, 0x3B, 0x39, 0x0F, 0x3C, 0x3F, 0x73, 0xAF, 0x86, 0xF2, 0x47, 0x1E, 0xA5, 0x73,
-    0x95, 0xBF, 0x96, 0x30, 0x99, 0x52, 0xE1, 0x12, 0x39, 0x56, 0xB4, 0xD2, 0x6E, 0x96, 0x86, 0xE3,
-    0xFA, 0x58, 0x77, 0xC9, 0xDC, 0x7B, 0xBE, 0x3B, 0x1E, 0xBE, 0x6A, 0x1F, 0x14, 0xDA, 0x2F, 0x2A,
-    0xED, 0x63, 0xD7, 0x27, 0x1B, 0xBD, 0x42, 0xC3, 0xF9, 0x0A, 0x20, 0xEB, 0x7E, 0x7B, 0xCD, 0x47,
-    0xFB, 0xB2, 0xDF, 0x9A, 0x7C, 0x68, 0xDD, 0xF1, 0xE2, 0x94, 0x71, 0xDE, 0xC9, 0xDE, 0x31, 0xE6,
-    0x73, 0x39, 0x3B, 0x45, 0xC7, 0x8A, 0xD2, 0x2F, 0x16, 0x20, 0x40, 0x8B, 0x31, 0x10, 0x2E, 0x69,
-    0x12, 0x98, 0xA3, 0x6D, 0x6D, 0xD7, 0x6D, 0xCC, 0x36, 0x7A, 0x1D, 0xAD, 0xA8, 0xD2, 0x08, 0xA7,
-    0xF8, 0x34, 0xB7, 0x38, 0x36, 0x5E, 0x68, 0x17, 0x9C, 0x3B, 0xA4, 0xD8, 0x98, 0x83, 0x91, 0x5F,
-    0x83, 0x63, 0xD1, 0x53, 0x30, 0xBA, 0x92, 0x9F, 0x3F, 0x88, 0xDD, 0x02, 0x3D, 0x40, 0x6A, 0x82,
-    0x22, 0x0C, 0x26, 0x1E, 0x45, 0x30, 0x67, 0x46, 0xEA, 0x1F, 0xBB, 0x9C, 0x29, 0xEB, 0xA9, 0xE7,
-    0xB2, 0x8B, 0x94, 0x1A, 0x65, 0x40, 0x47, 0x09, 0x7E, 0x8E, 0x12, 0xCD, 0xE5, 0x28, 0xD1, 0x6C,
-    0x8E, 0x12, 0xB0, 0x1C, 0x25, 0x7A, 0xD6, 0x51, 0xA2, 0xC1, 0x3C, 0x95, 0x0F, 0x9E, 0x4A, 0x27,
-    0x4F, 0x25, 0xD6, 0x53, 0xD1, 0x4C, 0x05, 0x33, 0x65, 0xEA, 0x99, 0xCA, 0x49, 0xC9, 0xCC, 0x4D,
-    0x4A, 0x0A, 0x2B, 0x8A, 0x1D, 0x25, 0x87, 0xBD, 0x5E, 0xA7, 0x9F, 0xE3, 0x28, 0xC5, 0x67, 0x6B,
-    0xA7, 0xAC, 0x77, 0xC8, 0x7C, 0x14, 0x08, 0xC7, 0x2B, 0x4F, 0xCD, 0x7B, 0xC3, 0xEC, 0xDE, 0x9C,
-    0x6F, 0x50, 0x44, 0xBB, 0x7C, 0x52, 0x40, 0xBB, 0x6C, 0xF4, 0x78, 0xF6, 0x0E, 0x4E, 0xE3, 0xD1,
-    0x34, 0x1E, 0x4C, 0xE3, 0xB0, 0xC4, 0x02, 0x09, 0x25, 0x09, 0x22, 0x29, 0x8B, 0x52, 0x20, 0x65,
-    0x4D, 0x8A, 0x23, 0x08, 0xC2, 0x08, 0x82, 0x28, 0x82, 0x20, 0x88, 0x24, 0x80, 0x21, 0x09, 0x40,
-    0x48, 0x02, 0x08, 0x92, 0x88, 0x3C, 0x11, 0x78, 0x02, 0xF0, 0x29, 0x81, 0xC3, 0x65, 0x74, 0xE0,
-    0xA5, 0xA3, 0xC3, 0x0E, 0x04, 0xA1, 0x4B, 0x3D, 0x10, 0x2F, 0x12, 0xD9, 0x70, 0x44, 0x8B, 0xCC,
-    0x5B, 0x28, 0xF0, 0x86, 0x4D, 0x6A, 0x8F, 0x42, 0xE6, 0x01, 0xF3, 0x37, 0xE7, 0xD3, 0x36, 0xE0,
-    0x49, 0x7F, 0x8C, 0xD1, 0xF3, 0x96, 0xAA, 0xA6, 0x58, 0xD4, 0x3C, 0xE4, 0x35, 0xB7, 0xBD, 0xF4,
-    0x91, 0x58, 0x61, 0x83, 0xCC, 0x5E, 0xB4, 0xBE, 0xDC, 0x0C, 0xED, 0xDF, 0x88, 0x82, 0x4B, 0xA5,
-    0x87, 0x0E, 0x44, 0x5F, 0xBC, 0x96, 0x5E, 0xF6, 0x9A, 0x48, 0x48, 0x3A, 0x96, 0x76, 0x94, 0xA3,
-    0x11, 0xFD, 0xC4, 0x7E, 0x1B, 0x0D, 0x3F, 0xFF, 0x79, 0x5D, 0xDB, 0x5A, 0xC5, 0x23, 0xE2, 0x01,
-    0x01, 0x1E, 0x61, 0x65, 0x3E, 0xC3, 0x6E, 0x1C, 0x22, 0x5E, 0xB3, 0x4C, 0x9B, 0x0D, 0x0D, 0x9C,
-    0xAA, 0x78, 0xC6, 0xD3, 0x31, 0x70, 0xB8, 0x2F, 0x9D, 0xDC, 0xBA, 0x21, 0x73, 0xED, 0xAE, 0xA8,
-    0x94, 0xDE, 0xD3, 0xE7, 0x8D, 0x54, 0x66, 0xC1, 0x50, 0x62, 0xDB, 0x87, 0x3D, 0x27, 0x15, 0x75,
-    0x34, 0x69, 0x16, 0x0D, 0xA7, 0x1E, 0x37, 0x14, 0x7A, 0x39, 0x52, 0x30, 0x5A, 0xAA, 0xDB, 0x02,
-    0x0A, 0xD3, 0x75, 0x32, 0x99, 0xFB, 0x86, 0xA6, 0xD1, 0x44, 0x23, 0x25, 0x18, 0x68, 0xD3, 0x85,
-    0x3D, 0x97, 0x86, 0x99, 0xCB, 0x68, 0xB0, 0x69, 0x4B, 0xF1, 0xC8, 0x6C, 0x25, 0x16, 0x40, 0x03,
-    0x1B, 0x40, 0x7E, 0xC2, 0x9B, 0xE2, 0x78, 0x84, 0x63, 0x28, 0x37, 0x3C, 0x48, 0x5A, 0xD5, 0x38,
-    0xB4, 0xF5, 0xCC, 0x62, 0xDE, 0x70, 0x70, 0x94, 0xC4, 0xB4, 0x87, 0xA9, 0x21, 0x82, 0x99, 0x4C,
-    0x32, 0x97, 0x64, 0x90, 0x29, 0x2C, 0x7A, 0xA8, 0xAE, 0xB7, 0xE8, 0x5B, 0xA1, 0xF9, 0xB3, 0xDB,
-    0xD0, 0x7C, 0x32, 0xA9, 0x74, 0xF5, 0x81, 0x95, 0x27, 0xCA, 0x77, 0x65, 0x8F, 0xA6, 0x63, 0x13,
-    0xE3, 0xD7, 0x04, 0x7F, 0x28, 0xA1, 0x99, 0xFF, 0x0B, 0x5E, 0xD9, 0x0D, 0xD9, 0x7C, 0xE7, 0xE5,
-    0xF6, 0x1F, 0x9B, 0x73, 0x05, 0x4C, 0xC0, 0xE4, 0x2B, 0x98, 0x56, 0x30, 0x97, 0x3B, 0x35, 0xF3,
-    0x36, 0x8C, 0x00, 0xFC, 0x84, 0xCE, 0xF8, 0x7D, 0x1D, 0x3F, 0x78, 0x86, 0x1F, 0xF7, 0xBA, 0xB9,
-    0x60, 0x4A, 0xF3, 0xC0, 0xA4, 0x0F, 0x47, 0x9E, 0x81, 0x6A, 0x4C, 0xAF, 0x8D, 0xFD, 0x14, 0x56,
-    0x1F, 0xEF, 0x91, 0x7B, 0xEB, 0x57, 0xFC, 0x91, 0xF1, 0x52, 0xA0, 0x02, 0x76, 0xED, 0x16, 0xC1,
-    0x2D, 0x41, 0xAB, 0x8F, 0x65, 0x7D, 0xC1, 0x94, 0x55, 0x74, 0x50, 0xD6, 0x5B, 0x2C, 0x19, 0x8E,
-    0x48, 0x11, 0xBC, 0x69, 0x3C, 0x1E, 0xBA, 0x09, 0xBE, 0xB4, 0x51, 0x57, 0x9A, 0x9E, 0x74, 0xAB,
-    0xDE, 0x2E, 0x5D, 0xDF, 0x41, 0xFD, 0x60, 0x75, 0x8A, 0x5D, 0x4B, 0x77, 0xF9, 0x98, 0x76, 0xE3,
-    0x1A, 0xBD, 0x4B, 0x9D, 0x67, 0x1D, 0x0D, 0x2C, 0x2D, 0x3B, 0xE7, 0x39, 0xAB, 0xE3, 0xAC, 0x7E,
-    0xB3, 0x73, 0x9B, 0x29, 0x0C, 0xF0, 0x9B, 0xC4, 0xAB, 0x1F, 0x9D, 0xA7, 0x44, 0x17, 0x89, 0x42,
-    0xB3, 0xE1, 0x14, 0xC1, 0xD1, 0x3A, 0xA0, 0x55, 0x2A, 0x6E, 0x18, 0x5D, 0x5F, 0xF8, 0xD1, 0x15,
-    0x1D, 0x62, 0xFA, 0xC6, 0xF4, 0x9A, 0xE9, 0x31, 0xD3, 0x79, 0xD6, 0x06, 0xBF, 0xD2, 0x7F, 0xE6,
-    0x25, 0xBC, 0x98, 0xCE, 0x33, 0x07, 0x50, 0xD7, 0x59, 0x3D, 0x67, 0x78, 0x98, 0x02, 0xE5, 0x8F,
-    0xD5, 0x75, 0x23, 0x78, 0xCE, 0x3A, 0x4E, 0x75, 0x57, 0xC5, 0xCA, 0xBE, 0x63, 0xDC, 0x34, 0xFA,
-    0xD5, 0xB6, 0x70, 0x1D, 0x4E, 0x5B, 0xE1, 0x06, 0x9D, 0xDD, 0xD6, 0xFB, 0xBC, 0xDF, 0x63, 0xE7,
-    0xBD, 0x69, 0x98, 0x41, 0x8D, 0xFA, 0xD2, 0xC5, 0xEC, 0x4A, 0x3B, 0x4F, 0x9A, 0xBB, 0x6D, 0x0E,
-    0x51, 0xC8, 0xE6, 0xC0, 0xEA, 0x44, 0x40, 0xE5, 0x82, 0xDF, 0x4E, 0xDC, 0x6D, 0x03, 0x2D, 0x17,
-    0xF5, 0x01, 0xAA, 0xA3, 0xCE, 0x67, 0x80, 0x40, 0x85, 0xFD, 0xA9, 0xA5, 0x07, 0x27, 0x2C, 0x56,
-    0x37, 0xF9, 0x5B, 0xB4, 0x22, 0x18, 0xEA, 0x54, 0x87, 0xEA, 0x53, 0xAB, 0x4B, 0x5D, 0xDB, 0x7F,
-    0x81, 0xAD, 0x6F, 0x17, 0x78, 0xFE, 0x9E, 0x83, 0x94, 0xD0, 0xD7, 0xDA, 0x7D, 0x7C, 0x78, 0x6B,
-    0x63, 0x3E, 0xF7, 0x23, 0x0A, 0xB5, 0x8D, 0xC6, 0x8D, 0xEE, 0x93, 0xB0, 0x3F, 0xEB, 0x6C, 0xD9,
-    0xD9, 0xBF, 0xCA, 0x3F, 0x2D, 0xE7, 0xD6, 0x99, 0xE2, 0x14, 0xCA, 0xAC, 0xA1, 0x72, 0x66, 0x9B,
-    0x35, 0x18, 0x64, 0x87, 0x9A, 0xEE, 0x07, 0x66, 0x94, 0x0F, 0xCD, 0xB8, 0xD3, 0x29, 0x55, 0x2E,
-    0xE4, 0x2A, 0x42, 0x9F, 0xEA, 0x25, 0xB7, 0xB6, 0xD8, 0xB6, 0x78, 0xC3, 0xD8, 0xE6, 0xF4, 0xBA,
-    0x3A, 0xCB, 0xBA, 0xAA, 0x84, 0x7F, 0xC6, 0x8D, 0xA7, 0x9B, 0x79, 0x7B, 0xDA, 0xDF, 0x57, 0x26,
-    0xE4, 0xFF, 0xD0, 0x6A, 0x4C, 0x8A, 0xCC, 0x5B, 0xD8, 0x4D, 0xF6, 0xBA, 0x4B, 0xB6, 0xF7, 0xDC,
-    0xFD, 0xB3, 0xCF, 0xBC, 0x4B, 0x0C, 0xD6, 0xAA, 0x12, 0x8C, 0x9E, 0xF7, 0x6B, 0xA7, 0xB8, 0xAE,
-    0x66, 0x26, 0x6D, 0x33, 0xCF, 0xCE, 0x4C, 0xFD, 0x81, 0x99, 0x77, 0xD5, 0x99, 0x98, 0x0E, 0x78,
-    0xDD, 0x71, 0xA9, 0xBA, 0xB1, 0x91, 0x63, 0xCC, 0xCF, 0xDE, 0xE8, 0x9D, 0x57, 0xF2, 0x5C, 0xCE,
-    0xB8, 0x8E, 0x98, 0x4B, 0xD4, 0x73, 0xDB, 0x5C, 0x39, 0xED, 0x6A, 0x33, 0x28, 0xA0, 0x30, 0x34,
-    0x3E, 0xD7, 0x99, 0xEC, 0x1F, 0xC5, 0x2D, 0xFB, 0x6B, 0x58, 0xF6, 0xE7, 0xD5, 0x79, 0xA7, 0x1F,
-    0xCF, 0x88, 0xA0, 0xD8, 0x4D, 0x6F, 0xEF, 0x7F, 0x84, 0x58, 0x82, 0x70, 0xA4, 0x7E, 0x76, 0x5B,
-    0x1A, 0xC4, 0x1A, 0x4B, 0x69, 0x4C, 0xDE, 0x45, 0x88, 0xB1, 0x89, 0x5D, 0x9D, 0x8C, 0x29, 0xC2,
-    0xBE, 0xB4, 0x71, 0x71, 0x97, 0xC2, 0x63, 0x35, 0x78, 0xEE, 0xBA, 0xC3, 0xC3, 0x9B, 0x1B, 0x6B,
-    0x9E, 0x16, 0x40, 0x2D, 0x5C, 0x32, 0x2E, 0x1D, 0x68, 0x27, 0x7E, 0x68, 0x77, 0x56, 0xDD, 0x0E,
-    0xB3, 0xBF, 0xBF, 0xE7, 0x96, 0xEA, 0xD6, 0x8B, 0x0C, 0x88, 0xD8, 0x95, 0x5C, 0x9B, 0xAC, 0x53,
-    0x5C, 0x00, 0xAE, 0x79, 0x2F, 0x28, 0x4E, 0xCE, 0x0B, 0xC1, 0x64, 0xDA, 0xAF, 0xE5, 0x41, 0x38,
-    0x6C, 0x01, 0x3C, 0x6D, 0xFE, 0x16, 0xDC, 0x7C, 0x43, 0x78, 0x40, 0x79, 0x5F, 0xE0, 0x89, 0xF1,
-    0xD2, 0xAF, 0x24, 0x1A, 0xCD, 0x49, 0xF2, 0x60, 0x36, 0x23, 0x8F, 0x23, 0x8E, 0x7E, 0x10, 0xD6,
-    0x66, 0x56, 0x8F, 0x04, 0x71, 0x7F, 0x60, 0xAB, 0x5D, 0x12, 0xFF, 0x2D, 0x50, 0x83, 0x08, 0xFF,
-    0x28, 0xC4, 0x3D, 0x2C, 0xE4, 0x4B, 0x47, 0xC4, 0x0F, 0x85, 0xC0, 0xD3, 0x92, 0xF7, 0x9C, 0xF5,
-    0x9C, 0xF9, 0x48, 0xE2, 0x65, 0x4F, 0x4C, 0xA1, 0xFD, 0xD7, 0x7D, 0x32, 0x07, 0x2B, 0xA9, 0xC0,
-    0x97, 0xD0, 0x3E, 0x39, 0x2C, 0xC0, 0x19, 0x77, 0x4D, 0xF2, 0xE4, 0xB6, 0x12, 0xA9, 0x75, 0x39,
-    0xC5, 0x2B, 0xB2, 0xF9, 0x95, 0xBF, 0x3E, 0x34, 0x39, 0x92, 0x48, 0xC1, 0x10, 0x10, 0x19, 0x58,
-    0x02, 0x22, 0x47, 0x10, 0x25, 0x12, 0xA2, 0x36, 0x56, 0xF5, 0x85, 0x5D, 0x13, 0xB3, 0x41, 0xB9,
-    0xDD, 0xCD, 0x4C, 0xD8, 0x21, 0x1B, 0x6E, 0x20, 0xCC, 0x86, 0xEB, 0x45, 0x9D, 0x21, 0xEA, 0x21,
-    0x0E, 0xE1, 0x10, 0x23, 0x84, 0x2A, 0xEC, 0x10, 0xBD, 0x38, 0x90, 0x21, 0x10, 0x22, 0xED, 0x84,
-    0x29, 0x87, 0x35, 0x33, 0x22, 0x02, 0x14, 0x18, 0xB3, 0xBF, 0x7F, 0x95, 0xAC, 0x31, 0xCA, 0x1C,
-    0x43, 0xF6, 0x20, 0x76, 0x2C, 0x0C, 0xAA, 0xCC, 0xCF, 0xC0, 0xA2, 0xD6, 0xF4, 0xC2, 0xA4, 0xFA,
-    0xE9, 0x3B, 0x7D, 0x6A, 0x97, 0x29, 0x33, 0x08, 0x82, 0x82, 0xF0, 0x5A, 0xC0, 0xDB, 0x59, 0xBB,
-    0xC7, 0x07, 0xF6, 0x91, 0xE1, 0x54, 0x0A, 0x06, 0x9C, 0x1B, 0x1C, 0x11, 0x50, 0x7C, 0xC8, 0xFB,
-    0x41, 0x60, 0x19, 0x02, 0x97, 0x7B, 0x34, 0xB6, 0x9D, 0x8F, 0x2F, 0xB4, 0x83, 0x6B, 0x2F, 0x1C,
-    0x7E, 0x21, 0xDF, 0xE4, 0x76, 0x95, 0x03, 0xB7, 0x41, 0xD3, 0x5E, 0x19, 0x03, 0xEA, 0xE9, 0x24,
-    0xA7, 0xDC, 0x2A, 0x59, 0xA1, 0xD5, 0x9C, 0x4D, 0xA8, 0xF9, 0x1C, 0x51, 0xC6, 0xF4, 0xCE, 0x21,
-    0xD2, 0x82, 0xCA, 0xD3, 0x8D, 0xFC, 0x63, 0x21, 0x60, 0x09, 0xCC, 0xB5, 0xAD, 0xC7, 0xC8, 0xD6,
-    0x7F, 0x1A, 0xE2, 0x29, 0x1E, 0xF7, 0x92, 0x21, 0x9A, 0xC4, 0xF0, 0x15, 0x65, 0xBC, 0xD5, 0x40,
-    0x2D, 0x8B, 0xE0, 0x47, 0xCB, 0x6B, 0x83, 0xD3, 0x03, 0x0F, 0xBE, 0x70, 0x27, 0x33, 0x9C, 0x75,
-    0x93, 0x3C, 0x13, 0x6D, 0x20, 0x6B, 0x5C, 0x31, 0x87, 0x55, 0x21, 0xA1, 0xD7, 0x64, 0xCF, 0x0E,
-    0x6D, 0x2B, 0x47, 0x79, 0xDE, 0x59, 0x79, 0xC8, 0x04, 0x0E, 0x4E, 0x82, 0x41, 0x59, 0x95, 0xED,
-    0xAE, 0x55, 0xAF, 0x3D, 0xA8, 0x57, 0x05, 0xF5, 0xC3, 0x75, 0x69, 0x19, 0x67, 0x31, 0x75, 0xD2,
-    0x71, 0xF3, 0x36, 0xC6, 0x79, 0xCD, 0x1B, 0xB1, 0x96, 0xD7, 0x8E, 0xA8, 0x7E, 0xA3, 0x88, 0xBE,
-    0x63, 0x9F, 0xE6, 0x88, 0x2E, 0x76, 0x1E, 0x51, 0xB4, 0xCC, 0x6B, 0xB5, 0x2F, 0x83, 0x28, 0x43,
-    0x61, 0x1A, 0x08, 0x63, 0x18, 0x8C, 0x41, 0x30, 0x86, 0xC0, 0x7C, 0x00, 0xEC, 0xBB, 0xE1, 0xFD,
-    0xCF, 0xAF, 0x84, 0xB7, 0xD8, 0x4E, 0x96, 0xF6, 0x02, 0xF1, 0x7E, 0x34, 0xE3, 0x7D, 0xE7, 0x59,
-    0x31, 0x67, 0x76, 0x1D, 0xE0, 0x0E, 0x71, 0x9F, 0xCA, 0x55, 0xCC, 0x8F, 0x01, 0x1D, 0x0A, 0xF5,
-    0x03, 0xBB, 0xD4, 0x6E, 0xC5, 0x00, 0x91, 0x8B, 0x15, 0xD5, 0x9A, 0x72, 0xD0, 0xF4, 0x1E, 0xE7,
-    0x68, 0xDB, 0xB8, 0x65, 0x97, 0x69, 0x8E, 0xF4, 0x3E, 0xCF, 0x8D, 0x2F, 0xD5, 0x64, 0xFB, 0x37,
-    0xE2, 0x61, 0xFF, 0x73, 0xA9, 0x87, 0x09, 0x9F, 0x67, 0x9F, 0x53, 0x21, 0xD8, 0x2F, 0xAD, 0xDE,
-    0x67, 0x75, 0x94, 0x72, 0x64, 0x97, 0x2F, 0xD9, 0x25, 0x9A, 0xB8, 0xC5, 0xFE, 0xC3, 0x83, 0xB4,
-    0x78, 0x21, 0x40, 0x04, 0x95, 0xBA, 0x81, 0xB1, 0x2A, 0x04, 0x36, 0xFE, 0xC2, 0xEC, 0x56, 0xC8,
-    0xAD, 0x23, 0x80, 0xB4, 0xE8, 0x1F, 0xD0, 0x9F, 0xD1, 0x67, 0x52, 0x4F, 0x96, 0xAD, 0x61, 0x1E,
-    0x04, 0x36, 0x62, 0x41, 0xFD, 0x54, 0x78, 0x0B, 0xE5, 0xF8, 0x0C, 0x08, 0xDB, 0x9F, 0x5A, 0x3B,
-    0xB7, 0x45, 0xCE, 0xF2, 0x89, 0xBC, 0x40, 0x7B, 0x1F, 0x7F, 0x7D, 0x8F, 0x31, 0xA0, 0x0F, 0x3B,
-    0xB4, 0xD7, 0x7A, 0xB4, 0xF5, 0xE8, 0xAB, 0x19, 0x42, 0xFB, 0x7B, 0x56, 0x36, 0xBC, 0x2F, 0xF3,
-    0x96, 0x2B, 0x65, 0xDA, 0x72, 0x97, 0x85, 0xA2, 0x2B, 0x4A, 0xC4, 0xB5, 0x9B, 0x0C, 0x55, 0x0D,
-    0x53, 0x6C, 0x1B, 0x69, 0x83, 0x39, 0xAE, 0x77, 0xEA, 0x82, 0x5B, 0xB1, 0x8A, 0x49, 0xB1, 0x76,
-    0x86, 0x55, 0x46, 0x34, 0x86, 0x64, 0x7F, 0xA5, 0x88, 0xAE, 0x13, 0x13, 0xDF, 0x6F, 0x8C, 0x8B,
-    0xB2, 0x0B, 0xDB, 0x5A, 0x67, 0x94, 0xAF, 0x9B, 0xC7, 0x05, 0x2E, 0x91, 0x19, 0xEF, 0xAA, 0xD1,
-    0xC9, 0xE3, 0x09, 0xBB, 0x75, 0x2E, 0x6E, 0x39, 0xC5, 0x11, 0xC4, 0x57, 0x04, 0x99, 0x47, 0xFF,
-    0xBA, 0x39, 0x89, 0xE0, 0xE2, 0x06, 0xF0, 0xD5, 0x8B, 0xC0, 0xA7, 0x1E, 0x78, 0x0D, 0x3F, 0x32,
-    0xF8, 0x58, 0x7E, 0xD8, 0xBB, 0xC0, 0x23, 0xC3, 0x8E, 0xDB, 0x41, 0xC7, 0xC4, 0xAA, 0xC5, 0xE5,
-    0x1B, 0x51, 0x62, 0x26, 0x29, 0x44, 0x99, 0x24, 0x50, 0x77, 0x89, 0x3E, 0x29, 0x57, 0xAB, 0xC1,
-    0xD0, 0x72, 0x33, 0x31, 0x94, 0x58, 0x82, 0x09, 0xED, 0x1C, 0xD0, 0x43, 0xF0, 0x49, 0x59, 0x00,
-    0xBC, 0x03, 0x6E, 0xE5, 0x68, 0x6A, 0xFC, 0x8A, 0x23, 0xA2, 0xAF, 0x71, 0x3C, 0x94, 0xBD, 0xF0,
-    0x36, 0x85, 0xCA, 0x0C, 0x69, 0xD1, 0xED, 0x1C, 0x8D, 0xD5, 0x76, 0x5B, 0xB1, 0xDA, 0x2D, 0xFD,
-    0xC7, 0xB3, 0x26, 0x61, 0x6E, 0x9A, 0xCD, 0xF6, 0x24, 0xCF, 0x6D, 0x4C, 0xF2, 0xBE, 0xB7, 0x85,
-    0x55, 0x4D, 0x63, 0x66, 0xE7, 0xA8, 0x7C, 0x74, 0x54, 0xA0, 0xA3, 0x89, 0x14, 0x5F, 0x49, 0x82,
-    0x26, 0xC0, 0xAF, 0x19, 0x9A, 0xBC, 0x10, 0xE9, 0xCB, 0x1B, 0x3A, 0x44, 0xB0, 0x1F, 0x31, 0x53,
-    0x39, 0x24, 0x51, 0x00, 0x75, 0x41, 0x1E, 0xF0, 0xA9, 0x49, 0x1F, 0x4E, 0x2E, 0x06, 0xDF, 0x6E,
-    0x05, 0x37, 0xBF, 0x53, 0x0C, 0xFE, 0xD8, 0xB8, 0xBC, 0x3A, 0xB1, 0xB0, 0xC6, 0x50, 0x30, 0x03,
-    0x75, 0x86, 0x30, 0xC2, 0xFF, 0x17, 0xEF, 0x7C, 0x73, 0xF1, 0x8E, 0xC3, 0xC7, 0x9D, 0x97, 0xD6,
-    0x65, 0x2C, 0x5C, 0x99, 0x8E, 0x4B, 0xCE, 0x87, 0x3E, 0xB7, 0xF8, 0xC6, 0x97, 0xE9, 0x78, 0x20,
-    0x5C, 0x31, 0x05, 0xCB, 0x74, 0xCC, 0x76, 0x81, 0xC5, 0x37, 0x53, 0x6F, 0x48, 0x99, 0x8E, 0x7C,
-    0x2E, 0x32, 0x70, 0x5C, 0xD3, 0xA3, 0x55, 0x83, 0x43, 0x73, 0x5A, 0xDD, 0x1C, 0x5D, 0x3D, 0xF5,
-    0x26, 0xAE, 0x5B, 0x44, 0xDD, 0xB9, 0xBC, 0x0A, 0x75, 0x24, 0xA3, 0x2D, 0x49, 0x75, 0xBA, 0x4C,
-    0x5C, 0x81, 0xFF, 0x7D, 0xDD, 0x7C, 0x6B, 0x0A, 0x06, 0xAB, 0x4B, 0x49, 0x3B, 0x7E, 0x7F, 0x57,
-    0xEA, 0xF1, 0xFE, 0xB5, 0xE5, 0x0E, 0xE2, 0x04, 0xD8, 0xF9, 0xCB, 0x98, 0xBB, 0xF4, 0xC9, 0xE1,
-    0x9D, 0x65, 0x50, 0xAE, 0xF6, 0xDC, 0x75, 0xD9, 0xE4, 0xEF, 0xC8, 0xC6, 0x6F, 0x49, 0x51, 0xA8,
-    0x39, 0x7B, 0xE1, 0x7E, 0xAD, 0x59, 0x59, 0x43, 0x97, 0x9A, 0x54, 0x4A, 0xF6, 0xF0, 0xF3, 0xF6,
-    0xDA, 0x54, 0x5F, 0x86, 0x22, 0x3F, 0xF9, 0x2A, 0x05, 0x7A, 0xAB, 0xFC, 0x23, 0x56, 0x1D, 0x90,
-    0xBF, 0xD8, 0xD4, 0x21, 0x65, 0x1B, 0xBC, 0xCE, 0x06, 0xBA, 0xDD, 0x73, 0x5B, 0xB8, 0x36, 0xDF,
-    0x6C, 0x7B, 0xB4, 0x25, 0xDB, 0xBA, 0x55, 0xCB, 0x45, 0x5A, 0x39, 0xA7, 0xE6, 0x72, 0x9E, 0x18,
-    0x31, 0x42, 0xF8, 0xD4, 0x30, 0x6C, 0x71, 0x66, 0x7C, 0xB8, 0x32, 0xEE, 0x94, 0x0D, 0xE9, 0x9C,
-    0x7F, 0x9D, 0x59, 0x1D, 0xB9, 0xB6, 0xA1, 0x55, 0xB3, 0xA4, 0x41, 0xA3, 0xE0, 0x1E, 0x16, 0x9B,
-    0x7A, 0x40, 0xC3, 0xA2, 0xA8, 0xEA, 0xA0, 0x52, 0x70, 0x67, 0x73, 0x76, 0x8C, 0x8B, 0xA2, 0x05,
-    0x2C, 0x5A, 0xBE, 0xE2, 0x8A, 0x57, 0x7C, 0xE9, 0x8A, 0x2B, 0x5C, 0x71, 0x65, 0x2B, 0x5A, 0x00,
-    0xE4, 0xAA, 0x7F, 0x5C, 0xC1, 0x8A, 0x2B, 0x57, 0x71, 0xC5, 0x2A, 0xAE, 0x54, 0xC5, 0x15, 0xAA,
-    0xB8, 0x32, 0x15, 0x57, 0xA4, 0xE2, 0x4A, 0x54, 0x5C, 0x81, 0x8A, 0x2B, 0x4F, 0x71, 0xC5, 0x29,
-    0xAE, 0x34, 0xC5, 0x15, 0xA6, 0xB8, 0xB2, 0x14, 0x57, 0x94, 0xE2, 0x4A, 0x52, 0xCC, 0xB9, 0xCF,
-    0xD6, 0x31, 0x30, 0x57, 0x99, 0x58, 0x57, 0xEB, 0x98, 0x77, 0xD8, 0x6D, 0x97, 0x8E, 0xB0, 0x70,
-    0xC4, 0xB0, 0x6C, 0xC4, 0x68, 0xD1, 0x88, 0x96, 0x8C, 0x68, 0xC1, 0x88, 0x96, 0x8B, 0x68, 0xB1,
-    0xC7, 0xAB, 0xB6, 0x5A, 0x1A, 0xA2, 0x85, 0x21, 0x5A, 0x16, 0xB2, 0xAE, 0x04, 0x29, 0xDB, 0x8D,
-    0xA0, 0xBC, 0x86, 0xDD, 0x8D, 0x8B, 0x38, 0xEE, 0x3E, 0x72, 0xE5, 0xBF, 0x1A, 0x16, 0x4A, 0xF8,
-    0xED, 0xCF, 0x17, 0x5C, 0xC2, 0x27, 0xB1, 0x46, 0x7B, 0x0E, 0xF8, 0x65, 0xA2, 0x5B, 0xCE, 0xED,
-    0x3C, 0x17, 0xE7, 0xBB, 0xBC, 0x1D, 0xE7, 0x53, 0xAD, 0xD8, 0x33, 0xCE, 0x17, 0x69, 0x9C, 0x6F,
-    0xD1, 0x66, 0x2F, 0x06, 0xF8, 0xB2, 0x62, 0x33, 0xC0, 0x57, 0x6A, 0x5C, 0xE9, 0x9E, 0x1A, 0x54,
-    0xBA, 0x59, 0x60, 0x7A, 0xC9, 0x1E, 0x89, 0x54, 0x73, 0x1F, 0x1F, 0xD9, 0x53, 0x9D, 0x99, 0x77,
-    0x2E, 0xD9, 0xC5, 0x00, 0x1E, 0x97, 0x15, 0x7C, 0xEE, 0xED, 0xB4, 0x4B, 0xA8, 0xE4, 0x7E, 0x37,
-    0xF2, 0x4D, 0x76, 0xCD, 0xD7, 0x7D, 0x04, 0xD7, 0xBF, 0x26, 0xD0, 0x37, 0x8A, 0x61, 0xBF, 0x18,
-    0x5E, 0x6B, 0xA0, 0xCF, 0x5C, 0xF8, 0xEC, 0x68, 0x75, 0x92, 0x37, 0x1C, 0x02, 0x6F, 0x42, 0x47,
-    0xBE, 0x24, 0x22, 0xAE, 0xCC, 0xFF, 0xAD, 0x18, 0xA0, 0x09, 0x54, 0x45, 0x68, 0x99, 0xE0, 0xF1,
-    0x29, 0xDB, 0xBB, 0xE6, 0xB4, 0x06, 0x06, 0xD5, 0x1A, 0x28, 0xBB, 0xB9, 0x44, 0x41, 0xFD, 0x0D,
-    0x4D, 0x5D, 0x24, 0x5B, 0xBC, 0x4C, 0x39, 0xEB, 0x4F, 0x89, 0xE1, 0xB4, 0xF6, 0x52, 0x43, 0x7A,
-    0xA9, 0x30, 0x7B, 0x96, 0x70, 0x08, 0x44, 0xA6, 0x93, 0x12, 0x5E, 0x6A, 0x46, 0x2F, 0xF5, 0x5D,
-    0x7A, 0xA0, 0x77, 0xE9, 0xA5, 0xF6, 0xF0, 0x4C, 0xC3, 0x0E, 0xAD, 0x58, 0x2C, 0xD2, 0x62, 0x37,
-    0xE5, 0x63, 0x4A, 0x2F, 0xF5, 0x32, 0xBD, 0xD4, 0x4F, 0xE8, 0xA5, 0xA2, 0x14, 0x2D, 0xE1, 0x09,
-    0xB1, 0xA0, 0xAD, 0x44, 0x6B, 0xC0, 0x7B, 0xA9, 0x39, 0xA5, 0xE8, 0x0A, 0xD9, 0x78, 0x97, 0x39,
-    0x19, 0x97, 0x30, 0xDE, 0xFD, 0xC2, 0x07, 0xFC, 0x29, 0xA6, 0xCC, 0xDD, 0x2D, 0xB7, 0x75, 0xD8,
-    0x9E, 0xE8, 0x87, 0x03, 0x46, 0x4E, 0x44, 0x07, 0x3B, 0x87, 0x34, 0x80, 0x43, 0x1A, 0xC1, 0x21,
-    0x8D, 0x45, 0xF3, 0xF4, 0xA9, 0x38, 0x68, 0xDD, 0x65, 0xF8, 0xA2, 0xF7, 0xD0, 0x88, 0x3B, 0x5A,
-    0xFE, 0x51, 0x5C, 0xB6, 0xFC, 0x7F, 0x1A, 0x71, 0x48, 0x85, 0xEB, 0x6D, 0xB6, 0x82, 0x43, 0x3A,
-    0x79, 0x87, 0x34, 0x02, 0x18, 0x11, 0x8E, 0x98, 0xB8, 0xBA, 0x6A, 0x9C, 0xA5, 0x75, 0xB8, 0xCB,
-    0x1D, 0x53, 0xFF, 0x52, 0x8D, 0xA2, 0xDF, 0x68, 0xED, 0x68, 0x57, 0xEB, 0x4E, 0xA1, 0xBB, 0x6A,
-    0xEE, 0x2E, 0x9A, 0xB3, 0x9A, 0x17, 0xBA, 0xF8, 0x0B, 0x51, 0x50, 0xF9, 0x97, 0x2B, 0x94, 0x18,
-    0xD6, 0xE2, 0x70, 0x8C, 0x19, 0x06, 0x41, 0xA4, 0xED, 0xD2, 0x9C, 0xFF, 0x3C, 0x91, 0x24, 0x84,
-    0xAB, 0x15, 0x70, 0x3A, 0xBD, 0x56, 0x80, 0x56, 0x77, 0x5A, 0x42, 0xC2, 0xBC, 0x5B, 0xD8, 0x06,
-    0x67, 0x37, 0xFD, 0x46, 0xC9, 0x4E, 0xAC, 0x0F, 0x43, 0xDB, 0x3B, 0x32, 0x89, 0x41, 0x6E, 0x0C,
-    0xE0, 0x03, 0x9D, 0x18, 0xCC, 0xBB, 0x9F, 0x5D, 0xA4, 0x8D, 0x9D, 0xF1, 0xA0, 0x62, 0x51, 0x69,
-    0xF9, 0x3E, 0x96, 0x9C, 0x36, 0x58, 0x71, 0xD4, 0x5E, 0x7A, 0x21, 0x3C, 0xAB, 0xD1, 0x59, 0x69,
-    0xC5, 0x53, 0x09, 0xF4, 0x0D, 0x80, 0x2B, 0x2F, 0xB4, 0xE7, 0xBD, 0x55, 0xB5, 0xD5, 0x3E, 0x86,
-    0xB7, 0x46, 0x83, 0x1F, 0x36, 0x6C, 0x75, 0xEC, 0x35, 0xDB, 0x6D, 0x5C, 0x69, 0xB1, 0xBA, 0xB6,
-    0xAE, 0x60, 0x5D, 0xCB, 0xD4, 0xD9, 0x7E, 0xFC, 0xDE, 0x5A, 0x5A, 0x05, 0x89, 0xC5, 0x90, 0x0B,
-    0x13, 0x26, 0x54, 0x93, 0x5C, 0x0E, 0xBB, 0xED, 0x50, 0x15, 0xE2, 0xA2, 0xF0, 0x21, 0x97, 0x31,
-    0x4E, 0x52, 0xD9, 0xDD, 0x99, 0x58, 0x9B, 0x6A, 0x78, 0xC2, 0xEB, 0xAA, 0xCA, 0x67, 0x72, 0x8C,
-    0xF0, 0xB8, 0x2F, 0xFF, 0xB4, 0xBF, 0x5F, 0xB8, 0x48, 0x8F, 0x6F, 0x44, 0x65, 0xEF, 0x40, 0x01,
-    0x89, 0x0C, 0xD8, 0x1B, 0x0F, 0x5C, 0xA8, 0xEA, 0x60, 0xAE, 0x83, 0x53, 0xB3, 0x98, 0x6F, 0xC8,
-    0x08, 0x4B, 0x28, 0x33, 0x4F, 0x56, 0xF4, 0xB9, 0x60, 0x3F, 0xFE, 0xA5, 0x49, 0x4E, 0x37, 0x8C,
-    0xBA, 0xD9, 0x52, 0x35, 0x78, 0x9C, 0x34, 0x06, 0x47, 0xA4, 0xF1, 0x04, 0x60, 0xBC, 0x78, 0xE3,
-    0x0B, 0x93, 0x7D, 0x65, 0x85, 0x97, 0x65, 0x15, 0x4D, 0xA2, 0x78, 0x96, 0xE2, 0xA4, 0x5D, 0x0A,
-    0xD6, 0x89, 0x47, 0xE0, 0x45, 0xF5, 0x2E, 0x93, 0x8C, 0xF8, 0x2E, 0xCA, 0x77, 0xFF, 0x61, 0xFC,
-    0x48, 0xC7, 0xDD, 0x7A, 0xFE, 0x78, 0xCC, 0xF3, 0x11, 0xCB, 0x2F, 0x79, 0x0F, 0xA3, 0xF2, 0xAF,
-    0xF4, 0x03, 0x07, 0x44, 0x8C, 0x5F, 0xFE, 0xBC, 0xAD, 0x9E, 0x22, 0x24, 0x25, 0x79, 0xB2, 0x14,
-    0x34, 0x72, 0x91, 0x91, 0xF4, 0xC4, 0x6A, 0x6D, 0x05, 0x6B, 0x31, 0x23, 0x32, 0xF1, 0x61, 0x6E,
-    0x0F, 0xF7, 0xCC, 0xF8, 0x6B, 0xF3, 0xF3, 0x79, 0x79, 0x25, 0xDF, 0xD7, 0x08, 0x5F, 0xE2, 0x5F,
-    0xC4, 0x54, 0x02, 0x56, 0x73, 0xB8, 0x0B, 0x43, 0xC3, 0xF2, 0x40, 0xCC, 0x1F, 0x2E, 0xE7, 0xE3,
-    0xD0, 0x9D, 0x86, 0x77, 0xE3, 0xE6, 0x0C, 0x54, 0xD4, 0x82, 0xF7, 0x64, 0x3E, 0xB9, 0xEF, 0xCE,
-    0x3D, 0xF0, 0x7F, 0x53, 0x00, 0x4E, 0xA0, 0xA2, 0xD6, 0x9D, 0x7B, 0xB9, 0x4B, 0x5C, 0x21, 0xB9,
-    0xB0, 0x42, 0xBA, 0x26, 0xEA, 0x60, 0x53, 0x44, 0x4D, 0xD8, 0x9E, 0x01, 0x30, 0x75, 0x29, 0x0C,
-    0xC4, 0x33, 0x2E, 0x57, 0xDF, 0x16, 0x08, 0x47, 0x9C, 0x8E, 0xBD, 0xF9, 0xF5, 0xC9, 0x81, 0x19,
-    0x7E, 0x7E, 0x01, 0xA7, 0xDB, 0x8A, 0x06, 0xBB, 0x65, 0xC1, 0x53, 0xFE, 0x0B, 0x2A, 0xE7, 0x96,
-    0x09, 0xBB, 0x2E, 0x3B, 0xEE, 0xA5, 0x51, 0x8D, 0x35, 0x22, 0x9A, 0xEA, 0x82, 0x56, 0x85, 0x4B,
-    0x04, 0xFA, 0xD0, 0xD5, 0x8B, 0xAD, 0x46, 0x49, 0x11, 0x36, 0xB6, 0x8F, 0x0F, 0xE8, 0xFE, 0x33,
-    0x7D, 0xF8, 0x5C, 0xC3, 0xA0, 0xBA, 0x03, 0x6B, 0xEE, 0x65, 0x8D, 0x44, 0xA7, 0x4B, 0x9F, 0x6A,
-    0xDC, 0x18, 0x3F, 0x60, 0x30, 0x41, 0x9E, 0x6E, 0xCA, 0x15, 0xDA, 0xD8, 0xAA, 0x4C, 0xE2, 0x60,
-    0x8B, 0x07, 0x91, 0xC9, 0x70, 0x82, 0xE3, 0xFE, 0x00, 0x45, 0x39, 0x59, 0x30, 0x6C, 0xB8, 0xEE,
-    0xF9, 0x4A, 0x1E, 0x8D, 0xC8, 0x60, 0x15, 0xD9, 0x12, 0xAF, 0x3C, 0xF5, 0xB5, 0x38, 0x47, 0x6D,
-    0x29, 0xDB, 0xB4, 0xF9, 0x91, 0xBA, 0x40, 0xAE, 0x29, 0xBE, 0xA1, 0x89, 0xB4, 0x69, 0xA0, 0x07,
-    0x56, 0xF4, 0x7C, 0x59, 0x63, 0x4B, 0x57, 0xA2, 0xD6, 0xD7, 0xB6, 0x59, 0x6A, 0xF5, 0x4C, 0xCC,
-    0x42, 0x58, 0x46, 0x32, 0x60, 0x5C, 0x2C, 0xAA, 0x53, 0x8D, 0xE0, 0x4B, 0x1D, 0x6C, 0xDF, 0x2F,
-    0x82, 0x17, 0x6F, 0x7C, 0x4E, 0x64, 0xBE, 0xB2, 0xFA, 0xDE, 0x4E, 0xCD, 0x68, 0x14, 0xD5, 0x8B,
-    0x53, 0x30, 0x9B, 0xA6, 0xF5, 0x59, 0x2D, 0x2D, 0x3C, 0x77, 0xEB, 0x63, 0xF8, 0xE4, 0x53, 0x8E,
-    0x0C, 0xE8, 0x32, 0xC5, 0xAA, 0xEA, 0x05, 0x64, 0x34, 0xBB, 0xC1, 0x52, 0xA6, 0xE6, 0xEF, 0x4F,
-    0x41, 0xE5, 0xB5, 0x2B, 0xBC, 0x56, 0x27, 0xC0, 0xBD, 0xFE, 0x5F, 0xDE, 0xEE, 0x35, 0x52, 0xC0,
-    0x70, 0xD4, 0x7C, 0x14, 0x9E, 0xE1, 0xEA, 0x6A, 0xDD, 0xB1, 0x0C, 0x47, 0x47, 0x0C, 0x74, 0xC6,
-    0xCF, 0x58, 0xCF, 0x54, 0xE1, 0xCE, 0x44, 0xF6, 0xEC, 0x0F, 0xCF, 0x08, 0xC2, 0x7F, 0x13, 0xEA,
-    0x7A, 0x54, 0x97, 0x26, 0x6B, 0x61, 0x44, 0x8A, 0x22, 0x40, 0xB3, 0x44, 0x50, 0x70, 0x4F, 0xF3,
-    0x0A, 0x7C, 0xAD, 0x94, 0xAC, 0x4A, 0x2C, 0xB3, 0x74, 0x5A, 0xB2, 0x39, 0x31, 0x6F, 0xE1, 0xAB,
-    0x2B, 0xC4, 0x1C, 0xDC, 0xE1, 0x7F, 0x3A, 0x80, 0x37, 0x96, 0x6A, 0x94, 0xB9, 0x22, 0x8C, 0x5C,
-    0xD5, 0x18, 0x4F, 0x8E, 0xAA, 0xA5, 0x0C, 0x50, 0x0F, 0x66, 0x97, 0x2A, 0x65, 0x5D, 0x33, 0x45,
-    0x6F, 0x87, 0x85, 0xE7, 0x7C, 0xA3, 0x8C, 0x67, 0xC1, 0x65, 0x34, 0xE7, 0x35, 0x29, 0xC4, 0xB0,
-    0x72, 0xFA, 0x1C, 0xA9, 0xD2, 0xBC, 0x29, 0x8B, 0xA4, 0xA9, 0x8B, 0xA4, 0x60, 0xE6, 0x12, 0xE7,
-    0xA0, 0x7D, 0x64, 0x10, 0xF8, 0x5E, 0xC0, 0x0C, 0x87, 0x01, 0x2B, 0x8A, 0xE7, 0xAF, 0x44, 0x57,
-    0xDF, 0x93, 0x61, 0x57, 0xB0, 0x7F, 0x8A, 0xAC, 0xC9, 0x9F, 0xA3, 0x54, 0x64, 0x5C, 0xC7, 0xCC,
-    0xB1, 0x39, 0x4A, 0x79, 0x3E, 0x0E, 0x1F, 0x30, 0x6E, 0xD0, 0x53, 0x10, 0xD6, 0xB2, 0x6D, 0x18,
-    0x73, 0x6A, 0xEB, 0xC2, 0x76, 0xD7, 0xDA, 0x7B, 0x38, 0x58, 0xD9, 0x46, 0xED, 0x5D, 0xB6, 0xD7,
-    0xA5, 0x0D, 0x6F, 0xBA, 0x54, 0xE3, 0xEB, 0x6E, 0x7B, 0xD5, 0xDC, 0x9A, 0x79, 0x3D, 0x1A, 0xB9,
-    0xC8, 0xF5, 0x75, 0x3B, 0xC2, 0x56, 0x1A, 0x9F, 0x23, 0xD7, 0xC9, 0x3B, 0x86, 0xA2, 0x92, 0x00,
-    0x17, 0xC8, 0xDA, 0x90, 0x76, 0x7A, 0x47, 0xB7, 0x4B, 0xF5, 0xE7, 0xF6, 0x9F, 0x5E, 0xC9, 0x12,
-    0x0F, 0xF9, 0x3F, 0x68, 0x3C, 0x46, 0xE2, 0xA1, 0x61, 0x94, 0xDD, 0xBF, 0x2E, 0x80, 0x63, 0x0F,
-    0xFA, 0x12, 0xCF, 0xF8, 0xD4, 0x4D, 0x60, 0x6F, 0x9D, 0xC4, 0xA2, 0x83, 0x8C, 0x54, 0xC6, 0xC2,
-    0xF2, 0xAD, 0xE6, 0x26, 0x47, 0x8E, 0x2D, 0x47, 0x46, 0x2D, 0x6E, 0x5C, 0xFA, 0xBB, 0x71, 0x0A,
-    0x9C, 0xA9, 0xDD, 0x72, 0x70, 0x59, 0xF8, 0x1C, 0x82, 0x74, 0x7E, 0xCE, 0xD3, 0xBA, 0xB7, 0x58,
-    0xE9, 0xB3, 0x94, 0x83, 0x4F, 0x6D, 0xF1, 0x57, 0xFE, 0x41, 0x73, 0x0D, 0x8D, 0x1F, 0x65, 0x82,
-    0xAF, 0x27, 0x4A, 0x40, 0xE5, 0x01, 0xE8, 0xAD, 0x6B, 0x50, 0x03, 0x3D, 0x2E, 0xD3, 0x67, 0xF8,
-    0xAF, 0x4C, 0xF2, 0xBE, 0x2C, 0xD2, 0xB1, 0x14, 0xC7, 0x27, 0x63, 0x10, 0x0B, 0xB1, 0x05, 0xBC,
-    0x00, 0xC9, 0xFF, 0x20, 0xA5, 0x32, 0x07, 0xD8, 0x2B, 0xD2, 0xDF, 0x84, 0x8B, 0x84, 0xBF, 0xC3,
-    0xD0, 0x42, 0xA8, 0x81, 0x3F, 0x4B, 0xFD, 0x0E, 0x86, 0x58, 0xD9, 0xF3, 0xF1, 0xD9, 0x4A, 0x20,
-    0x7E, 0x44, 0x31, 0xFC, 0xBB, 0x42, 0x5F, 0x17, 0xF9, 0x89, 0x96, 0x05, 0x68, 0x48, 0xEA, 0x97,
-    0x83, 0xF1, 0x65, 0x01, 0xC6, 0xFF, 0xE7, 0x04, 0xA1, 0x3D, 0xAE, 0xD4, 0x2A, 0xD4, 0x97, 0xFA,
-    0x43, 0xBE, 0xD2, 0xDF, 0xFB, 0x17, 0xFA, 0xDD, 0xEB, 0xFC, 0x2F, 0xDB, 0x21, 0x43, 0xA5, 0xC9,
-    0xFA, 0xA5, 0xD1, 0xDC, 0xD4, 0xB7, 0x19, 0x85, 0x9D, 0x4B, 0x9F, 0x6D, 0xCF, 0xEC, 0xB5, 0x97,
-    0x5A, 0xBD, 0xC5, 0x32, 0x2A, 0x7A, 0xB2, 0x25, 0x4B, 0xA4, 0x5C, 0xAE, 0x23, 0xFF, 0x7E, 0x72,
-    0x1D, 0xFF, 0x0B, 0x8D, 0x56, 0x41, 0x6C, 0xDC, 0x44, 0x14, 0x7D, 0x5E, 0x77, 0xB3, 0x25, 0xA6,
-    0x9D, 0x1C, 0xB2, 0x6A, 0x95, 0x04, 0xDC, 0x43, 0x91, 0x4A, 0x81, 0x75, 0x0F, 0x3D, 0xE4, 0xB0,
-    0xBB, 0x33, 0x29, 0x20, 0x6E, 0x74, 0x25, 0x12, 0x09, 0xC1, 0xA1, 0x48, 0xDC, 0xCA, 0xA1, 0x3D,
-    0xE6, 0xB0, 0x89, 0xAD, 0xF4, 0xC0, 0x0D, 0x56, 0x48, 0xE5, 0x4A, 0x04, 0x97, 0x6A, 0x11, 0xB4,
-    0xA0, 0x1E, 0x82, 0x94, 0xAC, 0x8D, 0x2A, 0x84, 0x38, 0x61, 0xD1, 0x4A, 0x95, 0xE8, 0xC5, 0x48,
-    0x48, 0x2D, 0xAA, 0x90, 0x7C, 0xF0, 0x61, 0x0B, 0xDE, 0x1D, 0xDE, 0xD8, 0xD9, 0x90, 0xA8, 0x0A,
-    0x62, 0x66, 0x3C, 0xF6, 0xFC, 0xF9, 0x7F, 0xE6, 0xCF, 0xFF, 0xFF, 0xFD, 0xF1, 0xD9, 0x4D, 0x78,
-    0x19, 0x9C, 0x1C, 0x96, 0x06, 0x64, 0x00, 0x27, 0xB2, 0xFA, 0xCA, 0xD6, 0x10, 0x39, 0xBC, 0x04,
-    0x52, 0x61, 0x0B, 0x40, 0x5F, 0xA1, 0xA2, 0x23, 0xD4, 0x74, 0x0A, 0x71, 0x77, 0x48, 0xEA, 0x0E,
-    0xBA, 0x70, 0x81, 0x0E, 0x50, 0x1B, 0x5B, 0xA9, 0xAB, 0x1F, 0x26, 0x32, 0xD4, 0x71, 0xCB, 0xD1,
-    0xC1, 0x2C, 0xBE, 0x43, 0xA8, 0x13, 0xAD, 0x53, 0xF6, 0xF5, 0x95, 0x95, 0x65, 0xCD, 0xD2, 0x67,
-    0x99, 0xC5, 0x6C, 0x13, 0x5D, 0xB9, 0x94, 0xBB, 0x3A, 0x73, 0x74, 0x82, 0x01, 0xE6, 0x54, 0x98,
-    0x90, 0x2D, 0x91, 0x11, 0x4C, 0x91, 0xC8, 0xC3, 0x8D, 0x51, 0xB8, 0x31, 0x26, 0x0F, 0x87, 0xD5,
-    0x8E, 0x9F, 0x3F, 0x09, 0x67, 0x24, 0xFC, 0x4A, 0x5E, 0x8B, 0x6B, 0x91, 0xA5, 0x00, 0x37, 0xF3,
-    0x47, 0x99, 0x9B, 0x8A, 0xCC, 0xF5, 0x47, 0x6E, 0x06, 0x54, 0x6E, 0xCC, 0xF5, 0x6A, 0xB9, 0x8C,
-    0x44, 0x1A, 0x2A, 0x2F, 0x1A, 0x41, 0xDA, 0x19, 0xB6, 0xEC, 0x18, 0x67, 0x30, 0xAD, 0xA4, 0x92,
-    0x10, 0xBF, 0xE5, 0xB0, 0x75, 0xC6, 0xB3, 0x25, 0x40, 0x18, 0x61, 0x76, 0xCD, 0x94, 0xD9, 0xE5,
-    0x7A, 0x2E, 0x27, 0x75, 0xB9, 0x7E, 0xF9, 0xC2, 0x0D, 0xC8, 0x5F, 0xC6, 0x10, 0xA9, 0x46, 0x2D,
-    0x93, 0x91, 0x95, 0x8B, 0x18, 0xAD, 0x4A, 0x82, 0x59, 0x40, 0x53, 0x54, 0xB1, 0x51, 0xDB, 0x2E,
-    0x5A, 0x6D, 0x6C, 0x7B, 0x7A, 0x48, 0xE5, 0xAD, 0x81, 0xE2, 0xAC, 0xAD, 0x23, 0xA1, 0x53, 0xF9,
-    0x38, 0x27, 0xBD, 0x89, 0x26, 0xDE, 0xB3, 0x53, 0x37, 0x68, 0x61, 0x1B, 0x63, 0xE8, 0x48, 0xC7,
-    0x61, 0x2C, 0xA3, 0x2A, 0x0F, 0x29, 0x63, 0x3F, 0xF5, 0x53, 0x2F, 0xAD, 0xA5, 0x76, 0xEC, 0x44,
-    0x3E, 0xA8, 0x37, 0xE6, 0x95, 0x1F, 0x6B, 0x53, 0x03, 0x63, 0xC9, 0x36, 0x44, 0x62, 0xA5, 0x98,
-    0x99, 0x23, 0x75, 0x3F, 0x6F, 0x48, 0x5E, 0x85, 0xB3, 0xF4, 0xD0, 0xF0, 0x80, 0x87, 0xD0, 0x0F,
-    0x2A, 0x3A, 0xB0, 0xA9, 0x72, 0x06, 0x2F, 0xA2, 0x38, 0xD0, 0x43, 0xF2, 0x41, 0x12, 0x26, 0x56,
-    0x02, 0x9E, 0xF4, 0x3D, 0xDC, 0xC2, 0xA0, 0x17, 0x26, 0xB7, 0xF9, 0x06, 0xEA, 0x2B, 0x2A, 0xD4,
-    0x11, 0x9B, 0x91, 0xAC, 0x1D, 0x6C, 0x96, 0xA2, 0x7E, 0x49, 0xB9, 0x63, 0x2D, 0x0E, 0x83, 0xA1,
-    0x71, 0x84, 0x37, 0x48, 0xD3, 0xCC, 0xA7, 0x7B, 0xED, 0xC8, 0x54, 0x63, 0xA6, 0xFA, 0xB2, 0xCC,
-    0x5F, 0x7A, 0x64, 0x46, 0x95, 0xA0, 0x12, 0xD8, 0xD1, 0x89, 0x7B, 0x32, 0x3F, 0x71, 0xCF, 0x8C,
-    0xFC, 0x51, 0x38, 0xA6, 0x2D, 0x5A, 0x65, 0x7D, 0x21, 0xF7, 0x73, 0x99, 0x4E, 0xA9, 0x59, 0x9E,
-    0xAA, 0xAC, 0xF2, 0x6D, 0x39, 0x12, 0xB9, 0xD5, 0xE3, 0xB2, 0x51, 0x98, 0x1A, 0x77, 0xCF, 0xA9,
-    0xD2, 0xD9, 0xFE, 0xC6, 0x78, 0xCF, 0xD9, 0x9C, 0x1D, 0x0E, 0x06, 0xA9, 0x98, 0xB8, 0xD6, 0x8D,
-    0xBD, 0x48, 0xAA, 0x36, 0xE5, 0x67, 0x60, 0xA1, 0xA6, 0x9C, 0xC4, 0x19, 0xD1, 0x07, 0xE1, 0xD2,
-    0x58, 0xE7, 0x61, 0x52, 0x4B, 0x3C, 0xE5, 0xD3, 0xCA, 0x63, 0x84, 0x9F, 0xFA, 0xDA, 0x19, 0x9F,
-    0x29, 0xDD, 0xCA, 0x20, 0x63, 0xAC, 0x8D, 0x57, 0x42, 0x46, 0x69, 0x02, 0xA7, 0x87, 0xA9, 0xAB,
-    0xA7, 0x8F, 0x9D, 0x5B, 0x5C, 0x68, 0x8F, 0xB7, 0xDD, 0x07, 0x69, 0xB1, 0x0B, 0x76, 0xB0, 0xCE,
-    0x1D, 0xC5, 0xE3, 0xB4, 0xA6, 0x63, 0xDA, 0xB0, 0x24, 0x1A, 0x63, 0xEA, 0x98, 0x44, 0xB9, 0x91,
-    0x93, 0xA1, 0x83, 0x2A, 0x89, 0x5D, 0x34, 0xDB, 0xC8, 0xE9, 0x6F, 0xFA, 0x78, 0x3F, 0x27, 0x87,
-    0x24, 0x72, 0x8A, 0x0C, 0x25, 0x11, 0xB5, 0x61, 0x25, 0x76, 0xF5, 0x1B, 0xB1, 0xD4, 0x3A, 0x5A,
-    0x73, 0xB5, 0x5A, 0xAD, 0x8C, 0x0A, 0xFA, 0x1E, 0x0E, 0xA8, 0x56, 0x3A, 0x79, 0xA8, 0xE5, 0xA6,
-    0x79, 0xAF, 0xAC, 0xAC, 0x74, 0x0C, 0xD3, 0xFE, 0xB1, 0x45, 0x8A, 0x18, 0xD9, 0x89, 0xA7, 0x1F,
-    0x14, 0x8B, 0x75, 0x85, 0xC6, 0xB2, 0xB5, 0x85, 0xCB, 0xFD, 0x7E, 0x2F, 0xD4, 0x3A, 0x31, 0x6F,
-    0x83, 0xA5, 0x42, 0xA2, 0x5C, 0x8B, 0xDF, 0x54, 0x8B, 0xEB, 0xB8, 0x44, 0x11, 0xD5, 0x64, 0x9C,
-    0xC0, 0x8F, 0x09, 0x4B, 0xDA, 0x98, 0xA1, 0x40, 0x00, 0xE3, 0x48, 0xA9, 0xBA, 0x51, 0x94, 0x3C,
-    0x0E, 0x8F, 0x22, 0x48, 0xF5, 0x38, 0x6E, 0x15, 0xE7, 0x44, 0x81, 0x71, 0x03, 0x27, 0x1A, 0x89,
-    0xE8, 0x79, 0x8A, 0xAD, 0xBD, 0xCB, 0x36, 0xDC, 0xC7, 0x96, 0x94, 0x6C, 0xE2, 0x10, 0xB6, 0x59,
-    0xB3, 0xE5, 0x70, 0x20, 0x84, 0x3B, 0xCA, 0xE8, 0x08, 0xBA, 0x83, 0x4E, 0xA1, 0x6B, 0xCA, 0x64,
-    0xC0, 0xBC, 0xA0, 0xCC, 0xF9, 0x16, 0x51, 0xD9, 0x7B, 0xCC, 0xF8, 0x6C, 0xBF, 0x1F, 0x38, 0x9F,
-    0xF0, 0xF8, 0xF9, 0xF9, 0xE6, 0xC2, 0xD5, 0x97, 0x8F, 0x15, 0x8A, 0x37, 0x9B, 0xDE, 0xD0, 0x49,
-    0x44, 0xDA, 0xDE, 0x3E, 0x79, 0x9A, 0x7A, 0x45, 0x9E, 0x6A, 0x52, 0x71, 0x8F, 0x5B, 0x9B, 0x78,
-    0xF4, 0x82, 0x17, 0x61, 0x4C, 0x37, 0x31, 0xAD, 0x91, 0xD8, 0x3F, 0xFE, 0x3F, 0xE8, 0x39, 0xCC,
-    0xEC, 0x73, 0x90, 0x91, 0x8C, 0xE7, 0x63, 0x3B, 0x72, 0xD5, 0x62, 0xE9, 0x6A, 0x87, 0xE6, 0x11,
-    0x29, 0xDA, 0xE2, 0x7E, 0xEC, 0x5F, 0xFA, 0x39, 0xF5, 0x2F, 0x5D, 0x4C, 0xA5, 0x47, 0xE2, 0x73,
-    0x30, 0x98, 0x8F, 0x74, 0x10, 0x12, 0xC1, 0x6E, 0xEF, 0xE9, 0x50, 0xFC, 0x2F, 0xB7, 0x1F, 0xCC,
-    0x47, 0xA4, 0x13, 0x27, 0x56, 0x51, 0x41, 0xFC, 0xE3, 0x02, 0x57, 0xD0, 0x11, 0xB5, 0x7B, 0x58,
-    0x68, 0xB7, 0x2A, 0xB5, 0xEA, 0xB4, 0x6E, 0x80, 0x59, 0xAE, 0x2C, 0xD3, 0x06, 0x4F, 0x51, 0xE1,
-    0xF6, 0xE2, 0x5D, 0xB5, 0x3A, 0x53, 0x4F, 0x6C, 0x46, 0xA4, 0x36, 0x46, 0x0D, 0xBA, 0xF3, 0x63,
-    0xAC, 0x12, 0x47, 0xF0, 0x82, 0x92, 0xC7, 0x3C, 0x6E, 0x70, 0xE8, 0xA9, 0x0F, 0xA3, 0xB3, 0x3C,
-    0x6B, 0x43, 0x9A, 0x54, 0x92, 0x34, 0xDE, 0x0D, 0x8E, 0x56, 0xCA, 0xDD, 0x6D, 0x66, 0x5F, 0x37,
-    0x63, 0x86, 0x2E, 0x6A, 0x18, 0x79, 0x43, 0x7B, 0xAC, 0x63, 0x6F, 0x68, 0x2E, 0x0B, 0x14, 0xC6,
-    0x2A, 0xFB, 0xB7, 0x7E, 0x80, 0xE8, 0xE0, 0xDB, 0x8F, 0x08, 0xAE, 0xE3, 0x30, 0x89, 0xE9, 0x19,
-    0x93, 0xA8, 0x70, 0xCA, 0x7C, 0x74, 0xAE, 0x02, 0xC7, 0xAB, 0xBB, 0x9C, 0x4C, 0x15, 0xB6, 0x48,
-    0x4D, 0x18, 0xEE, 0xCA, 0x6E, 0x9A, 0xD9, 0x69, 0xB0, 0x3F, 0x36, 0x91, 0x2A, 0x57, 0xC0, 0x37,
-    0x6F, 0x02, 0x29, 0xDE, 0xFF, 0xE9, 0xDF, 0x5D, 0x4C, 0xAF, 0x8D, 0x0E, 0xBA, 0xD4, 0xE1, 0x14,
-    0xFD, 0xEB, 0x64, 0x56, 0xEE, 0x0C, 0xA5, 0x3A, 0x6F, 0x66, 0xDD, 0xF5, 0xAC, 0x4C, 0x6E, 0x7D,
-    0xC5, 0x44, 0x4E, 0x24, 0x4B, 0x83, 0xE4, 0x16, 0x93, 0xCB, 0x6E, 0xA6, 0xD7, 0x65, 0xF0, 0x1E,
-    0x88, 0xBA, 0xA3, 0xD8, 0x76, 0x13, 0xA9, 0xBC, 0xC4, 0xCA, 0xB1, 0x60, 0x74, 0x3E, 0xB8, 0x68,
-    0x87, 0x12, 0x3B, 0x26, 0x26, 0x93, 0x75, 0xD8, 0xC3, 0x90, 0xD7, 0xD4, 0xDF, 0x6A, 0xBD, 0x72,
-    0x37, 0xDA, 0xB4, 0xBF, 0x8F, 0x91, 0xED, 0xB8, 0x06, 0x04, 0x98, 0x0E, 0x64, 0xEA, 0x67, 0x32,
-    0x73, 0x89, 0x1C, 0x2A, 0xBD, 0xF0, 0x85, 0xF2, 0x6E, 0x06, 0x95, 0x21, 0xD8, 0x9F, 0xFC, 0x5C,
-    0x91, 0x32, 0xBD, 0xB1, 0x29, 0x75, 0x7E, 0xBB, 0xF9, 0xFC, 0xAD, 0xE6, 0x71, 0xB6, 0x75, 0xBD,
-    0xE3, 0xDE, 0xCF, 0xCC, 0x51, 0x17, 0x60, 0x22, 0x03, 0x8B, 0xC6, 0x02, 0xDD, 0xC2, 0xE4, 0xB1,
-    0x57, 0x1C, 0x34, 0x70, 0xCC, 0x5A, 0x46, 0xF3, 0xEB, 0xD5, 0x2B, 0x64, 0xF5, 0x18, 0x50, 0xF4,
-    0xB1, 0x15, 0xEA, 0xDF, 0x31, 0x29, 0xAB, 0x05, 0xF6, 0x27, 0x02, 0xBC, 0xD9, 0x8C, 0x40, 0x65,
-    0xDC, 0xC3, 0x15, 0xC2, 0xD4, 0xA7, 0x00, 0x29, 0x95, 0x50, 0x3F, 0xDA, 0x13, 0x30, 0x10, 0x1D,
-    0x17, 0xE9, 0x65, 0x8F, 0x84, 0x62, 0x58, 0x4C, 0x58, 0xE1, 0x1F, 0x1C, 0xBF, 0xE2, 0x68, 0xFD,
-    0x84, 0xCA, 0x30, 0xC4, 0xF4, 0x5F, 0x5F, 0xD2, 0x84, 0x53, 0x26, 0x94, 0xA9, 0xDB, 0x94, 0x2E,
-    0x33, 0xA5, 0xB5, 0x6C, 0x6E, 0xF0, 0xBE, 0x89, 0x74, 0x33, 0xD5, 0x2B, 0xB7, 0x1A, 0xF1, 0xCA,
-    0xBC, 0x8E, 0x77, 0x78, 0x6D, 0x1A, 0xBD, 0xE7, 0xD3, 0x76, 0xB1, 0x78, 0x5E, 0xE4, 0x8A, 0x32,
-    0x63, 0x14, 0xE5, 0x9C, 0xD9, 0x2D, 0xD7, 0x05, 0x80, 0x58, 0x8A, 0xC8, 0x3B, 0x55, 0xCC, 0xF0,
-    0xCE, 0x6F, 0x36, 0x4D, 0xDA, 0x9A, 0xE7, 0xB5, 0xD9, 0x32, 0xAD, 0x3D, 0x40, 0xB5, 0x4A, 0x67,
-    0x34, 0x1A, 0x4D, 0x57, 0x6A, 0x26, 0x06, 0xCB, 0xFD, 0xCA, 0xEA, 0x38, 0xCA, 0xE4, 0x24, 0xC9,
-    0x7E, 0x52, 0xDD, 0xB8, 0xAE, 0x1C, 0x4A, 0x37, 0xD0, 0x15, 0xD8, 0x2E, 0x5A, 0xD3, 0x45, 0x63,
-    0xCD, 0x44, 0xBB, 0x74, 0x03, 0xB7, 0x16, 0x89, 0xBD, 0xE6, 0x44, 0xE2, 0x71, 0x6C, 0x2D, 0x75,
-    0xDC, 0xA4, 0xBB, 0x9A, 0x9D, 0xCA, 0x98, 0xF2, 0xB6, 0x8E, 0xB4, 0x6F, 0x57, 0xCD, 0x4F, 0x00,
-    0x1A, 0xA6, 0xB9, 0x5F, 0xA3, 0xDB, 0xC6, 0x56, 0x03, 0x59, 0x03, 0xC3, 0x06, 0xB6, 0xDA, 0x68,
-    0xDF, 0x54, 0xD5, 0x2A, 0xEF, 0x24, 0xF3, 0x53, 0x24, 0xD8, 0x7C, 0x88, 0x8F, 0x03, 0xB1, 0x6F,
-    0x51, 0xEF, 0xC3, 0xB8, 0xBE, 0xD4, 0x59, 0x1B, 0x30, 0x88, 0x2E, 0xFD, 0x18, 0x79, 0xE2, 0x5A,
-    0xDC, 0x10, 0xAF, 0xEE, 0x3D, 0xFE, 0xC5, 0x3B, 0xC9, 0xCA, 0xEB, 0x4B, 0x9D, 0x36, 0xFF, 0x04,
-    0x3E, 0x83, 0x78, 0xAD, 0x58, 0xA3, 0x68, 0x5E, 0x0F, 0xF5, 0x0E, 0xAF, 0x40, 0x07, 0x7E, 0xE2,
-    0x62, 0x52, 0xF9, 0xBB, 0xD0, 0x91, 0xF7, 0x13, 0xB1, 0x14, 0x39, 0xD7, 0x94, 0x7D, 0x07, 0xF6,
-    0xAF, 0x60, 0x64, 0x82, 0x6D, 0x06, 0xF2, 0x41, 0xEC, 0xDC, 0x51, 0xF6, 0x9F, 0x26, 0x0F, 0x5B,
-    0x3B, 0x04, 0x91, 0x6A, 0xF0, 0xF0, 0xD5, 0xCE, 0x3F, 0xDD, 0x7D, 0x3D, 0x90, 0xDD, 0xD6, 0x95,
-    0xE6, 0xC5, 0x83, 0xC8, 0xE7, 0x15, 0x6A, 0x17, 0x0A, 0x2C, 0xEF, 0x58, 0xDC, 0x19, 0x38, 0x98,
-    0xC0, 0xE3, 0x59, 0x0B, 0xC9, 0x06, 0x53, 0x35, 0x62, 0x03, 0x32, 0xB7, 0x4A, 0x81, 0x02, 0x73,
-    0x6A, 0xDD, 0x76, 0xA0, 0x40, 0x0E, 0x1C, 0xB8, 0x3C, 0xE5, 0xED, 0xC4, 0x81, 0xB6, 0xAA, 0x29,
-    0x40, 0xF6, 0xD6, 0x2A, 0x98, 0x60, 0xB9, 0x55, 0xD6, 0x6E, 0xD5, 0x4E, 0x20, 0x05, 0xDA, 0x2A,
-    0x4F, 0x3B, 0xA0, 0x03, 0x07, 0x9C, 0xDA, 0x16, 0x01, 0x49, 0x81, 0x03, 0x07, 0x82, 0xED, 0x52,
-    0x4D, 0xD5, 0x3A, 0x18, 0x8C, 0x4D, 0x8D, 0x6B, 0x38, 0x01, 0xE1, 0xF1, 0xA3, 0x0D, 0x52, 0x00,
-    0xEE, 0x9E, 0xEF, 0x3B, 0x17, 0xC0, 0x7B, 0xDD, 0x8F, 0x54, 0x53, 0xA2, 0x28, 0xCA, 0x94, 0xFA,
-    0x9C, 0xDB, 0xAF, 0xF1, 0x80, 0xFB, 0x73, 0xEE, 0xB9, 0xE7, 0x1F, 0xC6, 0xF0, 0x5F, 0xB2, 0x02,
-    0x0C, 0x3B, 0x40, 0x7F, 0xE0, 0x47, 0x45, 0x0A, 0x18, 0x95, 0x80, 0x5E, 0x6A, 0xDC, 0xBF, 0xC4,
-    0x5A, 0xDB, 0x3B, 0xE8, 0xD9, 0x77, 0xBE, 0xDC, 0x1B, 0x63, 0x2B, 0x73, 0x81, 0xF0, 0xEC, 0x1A,
-    0xFC, 0x24, 0xA1, 0x39, 0x02, 0xAF, 0x1D, 0xE4, 0x02, 0xAD, 0x95, 0x9B, 0xDA, 0x5B, 0x6C, 0x1F,
-    0xBF, 0x66, 0x13, 0x86, 0xF9, 0x0C, 0xA3, 0xD4, 0xD8, 0xB7, 0x77, 0xB3, 0x14, 0x4F, 0xB7, 0x0E,
-    0x9E, 0xCE, 0x1F, 0x46, 0xC7, 0x9B, 0x44, 0x6E, 0x19, 0x35, 0x19, 0x21, 0xDA, 0xA7, 0xF3, 0xC7,
-    0xA6, 0x3E, 0x3F, 0x98, 0x3D, 0xCF, 0x00, 0x2B, 0x33, 0xA2, 0x97, 0xEC, 0x3B, 0x7B, 0xE8, 0x8E,
-    0xAD, 0x96, 0x95, 0xD9, 0x17, 0xE4, 0xD7, 0x23, 0xFA, 0xBA, 0x20, 0xEF, 0xE2, 0x74, 0xEF, 0x19,
-    0x9D, 0x22, 0xFA, 0x67, 0xDB, 0x1A, 0xF6, 0xCD, 0xCA, 0x88, 0xED, 0xCD, 0x67, 0xF0, 0x67, 0xF9,
-    0xB1, 0x0D, 0x51, 0xA6, 0x08, 0x0B, 0x7C, 0x3B, 0xE4, 0x2E, 0x29, 0x6A, 0x41, 0xF5, 0x42, 0x86,
-    0x28, 0x1D, 0x0C, 0x2D, 0x67, 0x2C, 0xBC, 0x2A, 0xB7, 0x3E, 0xFD, 0x37, 0x98, 0x62, 0x99, 0x2F,
-    0x13, 0x83, 0x4C, 0x30, 0xBD, 0x06, 0x34, 0xE2, 0xAD, 0xD6, 0xE7, 0x17, 0x1D, 0x68, 0x08, 0x02,
-    0xBB, 0xFB, 0x4C, 0xE3, 0x5B, 0xB3, 0x00, 0xF0, 0x26, 0x60, 0x5E, 0x01, 0x30, 0x1F, 0x18, 0x2C,
-    0xAD, 0x4C, 0x7F, 0x61, 0x07, 0x3E, 0x72, 0x7C, 0xBA, 0x57, 0xC8, 0xA7, 0x91, 0xB5, 0x2B, 0x19,
-    0x46, 0xD4, 0xCB, 0x75, 0xCB, 0x21, 0xE8, 0x8D, 0xDF, 0x0B, 0x49, 0x2F, 0xBA, 0xB8, 0x35, 0xDE,
-    0x45, 0x92, 0x38, 0x01, 0xC6, 0x6B, 0x32, 0xB6, 0xA4, 0xB7, 0x0E, 0x34, 0xE3, 0x1F, 0xF4, 0x3A,
-    0x4C, 0x69, 0xDC, 0x8D, 0x7B, 0x22, 0x90, 0xE7, 0xFC, 0x6B, 0x5F, 0x9E, 0x70, 0x01, 0x13, 0xDC,
-    0x99, 0x18, 0x0F, 0x3A, 0x6D, 0xD1, 0x91, 0x53, 0xE7, 0x5D, 0x0F, 0x62, 0x7B, 0xD1, 0x2C, 0xAC,
-    0xED, 0x4C, 0xB8, 0x5A, 0x5A, 0x13, 0x57, 0x9E, 0xC5, 0x4C, 0x11, 0xF4, 0x26, 0xAB, 0xCC, 0x79,
-    0x77, 0xE7, 0x81, 0xD7, 0xCA, 0x5C, 0x87, 0x58, 0x30, 0x1F, 0x0F, 0x97, 0x2E, 0x74, 0x18, 0x97,
-    0x65, 0x97, 0x72, 0x34, 0x31, 0xC7, 0xB6, 0x8C, 0x65, 0xA0, 0x65, 0x21, 0x1F, 0x96, 0x16, 0xA0,
-    0xC8, 0x65, 0x57, 0x66, 0xF5, 0x62, 0x90, 0x1B, 0x14, 0x2D, 0x9E, 0xE6, 0x3A, 0x20, 0x8F, 0x95,
-    0xFF, 0x03, 0x9B, 0xFB, 0x36, 0x95, 0xB1, 0xDF, 0xED, 0xFF, 0x32, 0xA3, 0x05, 0xEF, 0xF0, 0x69,
-    0xF3, 0x4A, 0x71, 0xAE, 0xB3, 0x4F, 0x75, 0x02, 0xFF, 0xC4, 0x7B, 0x65, 0x5C, 0xD8, 0x7B, 0x73,
-    0x73, 0x19, 0x6F, 0x15, 0x92, 0xD6, 0x5B, 0x9D, 0xE5, 0x0F, 0xE5, 0xA7, 0xD1, 0x1F, 0x21, 0x66,
-    0x4F, 0x26, 0xF1, 0x8C, 0x4C, 0x71, 0x21, 0x94, 0x5B, 0xC8, 0xF6, 0xF1, 0x2C, 0xF7, 0xBE, 0x62,
-    0xAC, 0x42, 0xF0, 0xCE, 0x57, 0x38, 0xCF, 0xCB, 0x0A, 0x4B, 0xAB, 0x38, 0x5D, 0xC7, 0xE5, 0x76,
-    0x1C, 0x08, 0x96, 0xC5, 0x56, 0x2C, 0x9F, 0x00, 0xFF, 0x35, 0xF6, 0x3A, 0xFE, 0x2E, 0x74, 0x45,
-    0x2C, 0xC4, 0x13, 0x62, 0xC6, 0x22, 0x87, 0x65, 0xFF, 0xC4, 0xA9, 0xE2, 0xC4, 0x28, 0xCE, 0x0C,
-    0xFF, 0xBE, 0xC0, 0x34, 0xC9, 0xF5, 0xD2, 0x37, 0xC1, 0xC9, 0x4A, 0x68, 0xC1, 0xB7, 0xFF, 0xD3,
-    0xD6, 0xA0, 0x65, 0x32, 0x8A, 0x0A, 0x84, 0x7E, 0xD5, 0x9C, 0x9A, 0x19, 0xD9, 0xD3, 0x16, 0x04,
-    0x24, 0x8D, 0x2F, 0xB2, 0xE1, 0x09, 0x48, 0x3A, 0xC7, 0x1A, 0x48, 0xBA, 0xE3, 0xEE, 0x3E, 0x79,
-    0xA3, 0x1D, 0xF7, 0x30, 0x89, 0x4A, 0x1B, 0xAD, 0xFB, 0x53, 0x64, 0xDD, 0xC5, 0x98, 0x27, 0x36,
-    0x30, 0xB7, 0xFA, 0x75, 0x70, 0x9A, 0xDB, 0x35, 0xCA, 0x23, 0x17, 0xCB, 0xF0, 0xD8, 0xD5, 0x9B,
-    0x7B, 0x83, 0x1B, 0x85, 0x8C, 0x51, 0x47, 0x31, 0xA4, 0x23, 0x27, 0x9C, 0xB1, 0xB2, 0xC4, 0x91,
-    0x27, 0x8E, 0xDC, 0x70, 0xC2, 0x13, 0x5B, 0x1C, 0x19, 0xE2, 0x1A, 0xD6, 0xB9, 0x72, 0xAC, 0x71,
-    0xE4, 0x8D, 0x64, 0x8E, 0xA5, 0x5E, 0xC7, 0x4B, 0x1D, 0xD3, 0x23, 0x6E, 0xCC, 0xC4, 0x0B, 0xDF,
-    0x1B, 0xD7, 0xC4, 0x09, 0xB9, 0x78, 0xEE, 0x30, 0x6E, 0xFC, 0xF0, 0xF7, 0x94, 0x15, 0xB4, 0xBA,
-    0x50, 0xB5, 0xF6, 0x82, 0x07, 0xD1, 0x82, 0xEB, 0x63, 0xFC, 0xDA, 0x1C, 0xFD, 0x27, 0x5F, 0x7F,
-    0x4A, 0x4F, 0xA6, 0xA7, 0x78, 0x34, 0xD5, 0xC6, 0x71, 0xF0, 0x42, 0x1F, 0xD9, 0x11, 0xF9, 0xDA,
-    0x81, 0x40, 0xFB, 0x1D, 0x73, 0x38, 0xD5, 0x05, 0xDE, 0xFF, 0x27, 0xBA, 0xF4, 0xFF, 0xDC, 0xBB,
-    0xB1, 0x12, 0xBD, 0x4B, 0x92, 0xB6, 0x3F, 0x75, 0x03, 0xB6, 0x3A, 0xCE, 0x62, 0x45, 0x94, 0xE8,
-    0x3D, 0xA3, 0x81, 0x08, 0xBC, 0x1E, 0x73, 0xCC, 0x85, 0xAF, 0x16, 0xF2, 0x48, 0x76, 0x62, 0xE5,
-    0x06, 0x86, 0xF3, 0x2A, 0x0D, 0xEC, 0x74, 0x9C, 0x2E, 0x95, 0xE9, 0x7A, 0x7C, 0x00, 0xD8, 0x12,
-    0x51, 0xD8, 0x10, 0x2D, 0x74, 0xE8, 0x38, 0x45, 0xE7, 0x83, 0xA1, 0x15, 0xD6, 0x56, 0x09, 0x07,
-    0x00, 0x12, 0x3E, 0x62, 0xB2, 0x8E, 0x9C, 0x5C, 0x68, 0xEE, 0x38, 0x2A, 0x88, 0x16, 0xB6, 0x55,
-    0xDE, 0x41, 0x14, 0x65, 0x44, 0x17, 0xF4, 0x92, 0x96, 0xC8, 0xAF, 0x89, 0xC2, 0x9C, 0x28, 0xD3,
-    0xAF, 0x77, 0x8A, 0x1A, 0x45, 0xA5, 0xA2, 0xF4, 0xF8, 0x83, 0x30, 0x54, 0x99, 0x83, 0x62, 0xA3,
-    0x67, 0xAE, 0xBB, 0x8B, 0x66, 0xD1, 0x60, 0x38, 0xBE, 0xCC, 0x91, 0xB0, 0x72, 0x32, 0x66, 0x4E,
-    0x5B, 0x61, 0x2F, 0x9A, 0xCD, 0x03, 0x4F, 0xBE, 0xD6, 0x2B, 0x0C, 0xF1, 0xB0, 0x0A, 0x6C, 0x3B,
-    0xCA, 0xF1, 0xE0, 0x98, 0x53, 0xB8, 0x63, 0x70, 0x0A, 0x5F, 0xE0, 0x23, 0x3B, 0x9C, 0x27, 0x38,
-    0x31, 0xC3, 0x01, 0xF7, 0x0F, 0xAC, 0x5F, 0xE1, 0x3C, 0xFB, 0x2B, 0x99, 0xBD, 0x85, 0x7D, 0x8B,
-    0x6B, 0xC5, 0x79, 0x2D, 0x28, 0x7D, 0xE9, 0x6E, 0x56, 0x3A, 0x0A, 0xB9, 0x47, 0x97, 0x9C, 0x5F,
-    0x2E, 0xFF, 0x4E, 0x51, 0x92, 0x6C, 0xD2, 0xF1, 0x38, 0x31, 0x51, 0x3B, 0x49, 0x69, 0x32, 0xDB,
-    0xC2, 0x64, 0x73, 0xE5, 0xB7, 0x39, 0x66, 0x5B, 0x16, 0x12, 0xC3, 0x16, 0x8A, 0xFD, 0x88, 0xD0,
-    0x52, 0x7A, 0x9A, 0x29, 0x33, 0x63, 0xCF, 0xAC, 0xCA, 0x51, 0x31, 0xE9, 0xD5, 0x04, 0x2A, 0x45,
-    0xF8, 0xCD, 0x06, 0xD2, 0x6D, 0xB2, 0xA8, 0xD6, 0x27, 0x3C, 0x54, 0xDA, 0x8A, 0xF4, 0x7B, 0xF1,
-    0xE0, 0x76, 0x8F, 0x52, 0xA1, 0xD2, 0xE7, 0x2D, 0x25, 0xCA, 0x15, 0xA9, 0xDE, 0x6B, 0xB8, 0xA8,
-    0x7E, 0xCD, 0xCD, 0xED, 0x57, 0x38, 0x17, 0x84, 0x59, 0x93, 0xD5, 0x85, 0x79, 0x84, 0x29, 0x8E,
-    0x52, 0x95, 0x6B, 0x64, 0x55, 0x9C, 0x88, 0xA8, 0x52, 0x01, 0xEE, 0xD6, 0xEF, 0x7E, 0x05, 0x77,
-    0x6B, 0x79, 0x90, 0x2C, 0x54, 0x46, 0x42, 0xF7, 0xE4, 0x6E, 0xCB, 0x9A, 0x03, 0x03, 0xCD, 0x17,
-    0x9D, 0xE1, 0xF6, 0xB0, 0xA5, 0x8C, 0x4D, 0xA6, 0xBC, 0x4C, 0x46, 0xAE, 0x66, 0xF1, 0xCD, 0x77,
-    0x9E, 0x51, 0x26, 0xAA, 0xF0, 0xF2, 0x1A, 0xFC, 0xFA, 0x56, 0xB9, 0x91, 0x07, 0x93, 0x25, 0x57,
-    0xB7, 0x55, 0xC6, 0x6F, 0x85, 0x94, 0x54, 0x03, 0xAB, 0x7B, 0x94, 0xBC, 0x60, 0xAD, 0xAD, 0x30,
-    0x18, 0x78, 0xA5, 0x0C, 0xC9, 0xBE, 0x5D, 0xE8, 0xD3, 0x2B, 0xC0, 0x9B, 0xBC, 0xD9, 0xAB, 0xCA,
-    0x02, 0x73, 0xA1, 0xBA, 0x5D, 0xA5, 0x86, 0x84, 0x3B, 0x30, 0xC2, 0x89, 0x03, 0xC9, 0x6E, 0x86,
-    0xFA, 0x39, 0x61, 0x82, 0x05, 0xFC, 0xDF, 0xF2, 0x2D, 0x9F, 0xBD, 0xF2, 0xED, 0x81, 0x6D, 0xE6,
-    0xBF, 0x06, 0x1B, 0xA7, 0x7C, 0x7A, 0x04, 0x2E, 0xF9, 0x79, 0x88, 0x46, 0x9A, 0x75, 0x5C, 0xFA,
-    0x1A, 0x7D, 0xB8, 0xF9, 0x11, 0xCA, 0x89, 0xEE, 0xD8, 0x27, 0xF9, 0xE1, 0xF0, 0xDF, 0xC5, 0x24,
-    0xCB, 0x2E, 0x04, 0xAD, 0x1C, 0x41, 0xE5, 0x3A, 0x5A, 0x6E, 0xA0, 0xC0, 0xA1, 0x9C, 0x28, 0x74,
-    0x28, 0x25, 0x8A, 0xCC, 0x3A, 0xDA, 0x51, 0x74, 0x56, 0xD1, 0xA1, 0xA2, 0x96, 0xC8, 0x6B, 0x88,
-    0x84, 0x9A, 0x40, 0x5B, 0xBA, 0x31, 0x26, 0x94, 0x83, 0xB7, 0x9A, 0x2B, 0x24, 0x6E, 0x7C, 0x0D,
-    0xE4, 0x49, 0x14, 0x81, 0x72, 0xE4, 0x61, 0xE6, 0x87, 0x8A, 0x1E, 0x50, 0xC5, 0x26, 0xB1, 0xFF,
-    0x20, 0xB4, 0x9F, 0xC8, 0x29, 0x83, 0x46, 0x97, 0xD9, 0x7A, 0x09, 0x52, 0x48, 0x03, 0xC8, 0x61,
-    0xA0, 0x8C, 0x40, 0x46, 0x1F, 0xA7, 0xF8, 0x10, 0x53, 0x57, 0x42, 0x5A, 0xE6, 0xCE, 0x97, 0xC6,
-    0x6B, 0xD8, 0xB6, 0xC2, 0x94, 0x3D, 0x6E, 0xF5, 0x0B, 0x4B, 0xAB, 0xFC, 0x20, 0x59, 0xDA, 0x90,
-    0x1C, 0xA1, 0xB8, 0x6E, 0x2F, 0x35, 0xE3, 0x91, 0x8E, 0x6B, 0x16, 0xF6, 0xBA, 0x2D, 0x3A, 0x2E,
-    0xF9, 0x53, 0x96, 0x9B, 0x38, 0xB0, 0x4B, 0x8B, 0xCD, 0x22, 0x14, 0x2D, 0x5F, 0x27, 0xA3, 0x11,
-    0x0E, 0xBD, 0xA0, 0x44, 0x01, 0xC9, 0x9C, 0x7A, 0x11, 0x9E, 0x25, 0x2C, 0xC9, 0xE3, 0xFE, 0xE1,
-    0x66, 0x40, 0x37, 0x64, 0x3F, 0xA0, 0x9F, 0xEC, 0xAD, 0x1D, 0x44, 0x4E, 0x6C, 0x7D, 0xBB, 0xB2,
-    0x57, 0x3D, 0x48, 0xF5, 0x45, 0x3B, 0xEA, 0x19, 0x15, 0xF4, 0x0C, 0x11, 0x60, 0x56, 0xC2, 0x5C,
-    0x0B, 0x39, 0x2E, 0x21, 0x96, 0xCB, 0x5E, 0x95, 0x99, 0xA8, 0x1F, 0x4E, 0x9D, 0x60, 0x51, 0xBA,
-    0xF3, 0x11, 0xBA, 0xF4, 0xC3, 0x97, 0xC0, 0xF5, 0x71, 0x78, 0x84, 0xDC, 0xDD, 0x0B, 0x3D, 0x92,
-    0xEB, 0x59, 0xE1, 0xF8, 0x34, 0xC0, 0x15, 0x00, 0x32, 0x4C, 0x8B, 0x5B, 0x15, 0xB5, 0xF4, 0x29,
-    0xC6, 0x83, 0x4E, 0xAB, 0x8C, 0x77, 0xFE, 0x63, 0x77, 0x92, 0xE2, 0x28, 0x05, 0x73, 0x0F, 0x1A,
-    0x0A, 0x3F, 0x61, 0x8B, 0x23, 0x15, 0xA7, 0x29, 0xA7, 0xB2, 0xB0, 0xD5, 0x51, 0x49, 0xE8, 0xE3,
-    0x32, 0xBE, 0x8F, 0x8B, 0xC4, 0xE6, 0x29, 0x47, 0xF1, 0x26, 0x96, 0xF7, 0x65, 0xF4, 0x73, 0x59,
-    0x79, 0xE4, 0x67, 0x9B, 0xA8, 0xDC, 0x82, 0x82, 0x6D, 0x28, 0xDC, 0x44, 0xF9, 0x3A, 0x8A, 0x53,
-    0xA2, 0x84, 0x6C, 0x4D, 0xF4, 0x1B, 0x9E, 0x9C, 0x96, 0x88, 0x13, 0x25, 0xA8, 0x23, 0xFD, 0x4B,
-    0x57, 0xE5, 0x94, 0x85, 0x5A, 0x0C, 0x74, 0x6A, 0x64, 0x64, 0x32, 0xC8, 0xC8, 0xF6, 0x09, 0xB4,
-    0xB4, 0xD8, 0xF6, 0x9E, 0xA5, 0x11, 0x22, 0xA7, 0x64, 0x84, 0x03, 0xFE, 0x5D, 0xF9, 0xF9, 0xBF,
-    0xF2, 0x73, 0x4B, 0xEE, 0xF0, 0x3B, 0xC1, 0x37, 0x6D, 0xE9, 0xFD, 0x46, 0x70, 0x6B, 0xEB, 0xC5,
-    0x2F, 0x81, 0x8B, 0xC6, 0xFF, 0x19, 0x70, 0xD6, 0x2C, 0xDF, 0x04, 0x4E, 0xDA, 0xE0, 0x3B, 0xC0,
-    0x71, 0x17, 0x9E, 0x03, 0x8E, 0xBA, 0x08, 0xAB, 0xDC, 0x86, 0xC3, 0x0E, 0x71, 0x60, 0x9F, 0x20,
-    0x5E, 0xDA, 0x43, 0x62, 0x1F, 0x3B, 0x5E, 0xF0, 0xC2, 0x36, 0xC4, 0x66, 0xC2, 0xB5, 0xE2, 0x02,
-    0xAA, 0x9D, 0x27, 0xC4, 0x23, 0xEC, 0x22, 0x07, 0x8B, 0x4B, 0x0B, 0xF4, 0xB7, 0x8A, 0x85, 0x42,
-    0x44, 0x14, 0x6C, 0x55, 0x0E, 0xE8, 0x80, 0x40, 0xBE, 0x85, 0xA3, 0xA3, 0xE6, 0xAE, 0xD0, 0x4B,
-    0xBB, 0x05, 0x10, 0x8E, 0x48, 0x9C, 0xBA, 0x07, 0x45, 0xF3, 0x7E, 0xEE, 0x42, 0x04, 0x0A, 0x91,
-    0x2D, 0x51, 0x4C, 0x3D, 0x0B, 0xC9, 0xE9, 0x9D, 0x00, 0x2F, 0x4A, 0x97, 0x9A, 0x32, 0x54, 0x82,
-    0xC0, 0x01, 0x2C, 0x22, 0x63, 0x3F, 0x8A, 0x12, 0x59, 0x13, 0x53, 0x53, 0x87, 0xC0, 0x94, 0xB4,
-    0x50, 0x15, 0xE3, 0x2E, 0x53, 0x28, 0xA4, 0x1D, 0x6D, 0x83, 0xFC, 0xAB, 0x5E, 0xA9, 0xDF, 0xD2,
-    0x3B, 0xE0, 0x6E, 0x49, 0xC3, 0x03, 0xA0, 0xF2, 0x1D, 0x3D, 0x50, 0x72, 0x49, 0x06, 0x30, 0x03,
-    0xB5, 0xA4, 0x98, 0x53, 0xE9, 0xA4, 0x81, 0x3A, 0x24, 0x12, 0xC2, 0x6E, 0xF1, 0xD1, 0x8B, 0xAF,
-    0xB2, 0x90, 0x10, 0x5F, 0xD7, 0x04, 0x6B, 0x48, 0x79, 0xAF, 0xEA, 0xD1, 0x2B, 0xA7, 0xB9, 0xFD,
-    0x47, 0x9D, 0x43, 0x88, 0x94, 0x32, 0x75, 0xC3, 0x51, 0xE9, 0x0C, 0xB4, 0xB3, 0x4D, 0x5E, 0x8B,
-    0x46, 0x79, 0xCD, 0xA8, 0xC6, 0x4B, 0xF9, 0xE8, 0xBD, 0x0F, 0xE0, 0xF1, 0xF4, 0x48, 0xB8, 0x96,
-    0xC9, 0xBC, 0xA2, 0xEF, 0xC3, 0x0A, 0x76, 0x3B, 0x70, 0xF7, 0x56, 0x30, 0x1E, 0xFE, 0x15, 0x61,
-    0x9D, 0xBC, 0x54, 0xDC, 0x78, 0xB6, 0xDE, 0x91, 0x5B, 0xF9, 0xF5, 0x59, 0xC2, 0x27, 0x08, 0x3F,
-    0x2B, 0x10, 0x2A, 0x3B, 0x1F, 0x71, 0x8F, 0x21, 0xCE, 0x75, 0x74, 0xA9, 0x74, 0xF0, 0xC1, 0x54,
-    0xCF, 0x64, 0xAA, 0x76, 0x77, 0x9D, 0xBD, 0x50, 0x35, 0x97, 0x4F, 0x71, 0xD1, 0xA7, 0x95, 0x3D,
-    0x55, 0x90, 0xB2, 0xD4, 0x0A, 0x02, 0xD9, 0xFB, 0x1D, 0xF9, 0x6F, 0x05, 0x51, 0x5A, 0xE8, 0xA5,
-    0xC7, 0x6A, 0x50, 0x17, 0x90, 0x2E, 0x83, 0xAE, 0x72, 0x19, 0xBB, 0xA5, 0x0C, 0xB2, 0x8E, 0xBD,
-    0x23, 0x58, 0x3E, 0x1F, 0xAF, 0x1B, 0xBF, 0x37, 0xDE, 0x67, 0xBC, 0xEF, 0xF8, 0x1C, 0x95, 0x42,
-    0x65, 0xBC, 0xA7, 0x5D, 0x3F, 0x26, 0xAB, 0xCA, 0x69, 0x7B, 0x63, 0xA3, 0xDF, 0x8F, 0x1D, 0x1C,
-    0x28, 0x0D, 0x7A, 0x38, 0x4C, 0xAD, 0x48, 0x58, 0xBD, 0x4C, 0xD5, 0xCA, 0xC4, 0x15, 0xA7, 0x15,
-    0xE7, 0x9D, 0x3C, 0x6C, 0x47, 0x29, 0x88, 0x34, 0x64, 0x31, 0xB3, 0xB2, 0x9D, 0x5E, 0xAC, 0xCC,
-    0x34, 0xAB, 0x6E, 0x5A, 0x71, 0xD0, 0x9B, 0x91, 0xD8, 0x70, 0x08, 0xB8, 0x03, 0x81, 0x53, 0x36,
-    0x90, 0xC0, 0x17, 0x0D, 0x57, 0x78, 0x59, 0xD1, 0x72, 0x1B, 0xE6, 0xBC, 0x34, 0x51, 0xC5, 0xED,
-    0x90, 0x3A, 0xA6, 0xA7, 0x47, 0xF9, 0x52, 0x0F, 0x76, 0xD9, 0x0A, 0x31, 0xA5, 0x6A, 0xE1, 0xD3,
-    0xF6, 0x81, 0x55, 0x8B, 0x1B, 0x27, 0xF6, 0x97, 0x93, 0x5A, 0x3C, 0x9B, 0x54, 0xD4, 0xF7, 0x02,
-    0x8D, 0x83, 0x14, 0xA6, 0xC8, 0xDF, 0x40, 0x54, 0x70, 0xC0, 0x8F, 0x1C, 0xC2, 0xF8, 0x69, 0x19,
-    0xCE, 0xC1, 0xFD, 0x4F, 0x8E, 0xC0, 0x91, 0x89, 0x2A, 0x5A, 0x4F, 0x6D, 0xEB, 0x59, 0x35, 0x70,
-    0x59, 0x6E, 0x06, 0x4B, 0x0D, 0x7A, 0xF7, 0x7C, 0xA2, 0xDA, 0xF9, 0x09, 0x50, 0xA6, 0x0E, 0x25,
-    0x1D, 0x91, 0x63, 0x98, 0x7B, 0xD6, 0xBE, 0xBC, 0xD1, 0xA2, 0xD0, 0xD2, 0x98, 0x62, 0x35, 0x9A,
-    0xE2, 0x66, 0x4F, 0xC4, 0xC7, 0xA0, 0xE5, 0x89, 0xE6, 0x53, 0xBC, 0xB3, 0x2B, 0xAD, 0xC4, 0xBA,
-    0x7F, 0xE5, 0x46, 0xEB, 0xF7, 0x74, 0xBC, 0x37, 0xD2, 0x6D, 0xE3, 0x1D, 0x8F, 0xA0, 0x6C, 0x6A,
-    0x85, 0x53, 0x2B, 0x98, 0x5A, 0xCB, 0xA9, 0xE5, 0x6F, 0x69, 0x19, 0x38, 0xC5, 0x06, 0xE5, 0x7D,
-    0x02, 0xFF, 0x17, 0xEE, 0x7A, 0x01, 0x14, 0x6A, 0xF6, 0xD7, 0xE0, 0xD7, 0x09, 0xCD, 0x26, 0x04,
-    0xAF, 0x5A, 0xD0, 0x6E, 0xB3, 0xB0, 0xFF, 0x4F, 0xA6, 0x59, 0x3E, 0x4F, 0xB8, 0x0F, 0x22, 0x08,
-    0x9C, 0x79, 0xD8, 0x13, 0x0E, 0xC7, 0x60, 0x3F, 0x5F, 0x43, 0xA1, 0xFF, 0x6D, 0xF9, 0x2E, 0xAD,
-    0xEE, 0x80, 0x57, 0x29, 0x4F, 0x0B, 0x18, 0x88, 0x33, 0xE8, 0x84, 0xB0, 0x19, 0x38, 0x81, 0xDF,
-    0xD9, 0xB5, 0x4F, 0x86, 0xA5, 0x83, 0x8A, 0x2D, 0x05, 0x67, 0x88, 0x0C, 0xFA, 0xF7, 0xA8, 0x53,
-    0x1C, 0x0C, 0xA3, 0x58, 0xB4, 0x89, 0x7D, 0xFB, 0xE4, 0xD6, 0xCF, 0xC7, 0xEB, 0xDD, 0xF7, 0x45,
-    0x8C, 0x58, 0xE8, 0xF1, 0x5B, 0x69, 0x7F, 0x6F, 0x62, 0x1A, 0xD9, 0x6F, 0x1D, 0x05, 0x8F, 0xBC,
-    0x93, 0x8A, 0x17, 0x64, 0xFD, 0xCE, 0x2A, 0xB0, 0x21, 0xDC, 0x04, 0x77, 0x2F, 0xDC, 0xAC, 0x1B,
-    0xA3, 0x46, 0x29, 0xE5, 0x22, 0x78, 0x82, 0x1C, 0x1B, 0x50, 0xC8, 0xE1, 0xDF, 0x28, 0x85, 0x6C,
-    0xB2, 0x3A, 0x01, 0x2F, 0x3A, 0x9D, 0xAE, 0xC9, 0x1D, 0x91, 0x03, 0xA7, 0x76, 0xF7, 0xA0, 0x9B,
-    0xCB, 0x11, 0xF3, 0xF0, 0x01, 0xFC, 0x39, 0x6A, 0x04, 0x8C, 0xA6, 0x4B, 0xE2, 0xEE, 0x14, 0x65,
-    0x54, 0xF0, 0x9F, 0x42, 0xD6, 0xAE, 0x2E, 0x60, 0xA6, 0xC9, 0x44, 0x6A, 0x57, 0x57, 0xD9, 0x69,
-    0x3A, 0x6C, 0x26, 0x5F, 0x9D, 0x33, 0x9B, 0xA4, 0x0B, 0x50, 0x1B, 0x1A, 0x31, 0x74, 0x6C, 0x55,
-    0xE4, 0x74, 0x9C, 0x6A, 0xD8, 0xC2, 0x60, 0x7A, 0x6A, 0xF2, 0xCE, 0xB8, 0x86, 0x09, 0xC7, 0xB1,
-    0x5F, 0xE0, 0x4A, 0x74, 0x93, 0xE7, 0x2A, 0x84, 0x25, 0x36, 0x32, 0xF5, 0x42, 0xD9, 0x6B, 0xE0,
-    0x97, 0x68, 0x90, 0x7F, 0xA2, 0x71, 0x6B, 0x6C, 0x54, 0xD9, 0xD4, 0x70, 0x17, 0xCF, 0x5F, 0x9F,
-    0x6E, 0x38, 0x3D, 0x62, 0x7A, 0xE8, 0xD4, 0x0D, 0xED, 0x98, 0x76, 0x35, 0xE4, 0xC1, 0x8B, 0xED,
-    0x48, 0x1E, 0x94, 0x9E, 0xA6, 0x44, 0x6F, 0x9C, 0x28, 0x6D, 0xCC, 0x33, 0x98, 0xE3, 0x25, 0x0D,
-    0x43, 0xF1, 0x00, 0x5F, 0x57, 0x46, 0x75, 0x46, 0x95, 0x19, 0x4B, 0x55, 0xE6, 0x18, 0x74, 0x2B,
-    0x5A, 0xF0, 0xCA, 0xB8, 0x07, 0x5C, 0x72, 0x3F, 0x78, 0x56, 0xFD, 0x95, 0x50, 0xA8, 0x44, 0x3C,
-    0x12, 0x18, 0x0E, 0xBC, 0xA6, 0x53, 0xC5, 0x79, 0xFA, 0x96, 0xC7, 0x3B, 0x2C, 0x79, 0x18, 0x25,
-    0x38, 0x80, 0xBB, 0xE4, 0x2A, 0xD4, 0xA3, 0x59, 0x42, 0x0D, 0x20, 0x38, 0x46, 0xD0, 0x0A, 0xA2,
-    0x46, 0x76, 0x60, 0x48, 0xCD, 0xE0, 0x7C, 0x40, 0xEB, 0x8D, 0x80, 0x53, 0x7B, 0xD8, 0x9B, 0xB2,
-    0x34, 0xD1, 0xF0, 0xCC, 0x00, 0xBD, 0x61, 0x90, 0xC9, 0x10, 0x40, 0xCA, 0xB2, 0xB5, 0xEC, 0xDC,
-    0xA2, 0x11, 0x45, 0x38, 0xBB, 0x99, 0x61, 0x75, 0x7F, 0x03, 0x39, 0xE6, 0xDB, 0x32, 0x1F, 0xCE,
-    0xE5, 0xE0, 0x81, 0x21, 0xFC, 0x65, 0x89, 0x25, 0x2F, 0xB1, 0x05, 0x4A, 0xB0, 0x05, 0x8C, 0x41,
-    0x84, 0xA8, 0xE1, 0xBB, 0x86, 0xF2, 0x89, 0xC8, 0x0D, 0xF2, 0xEF, 0xEC, 0x52, 0x88, 0x62, 0x3F,
-    0x93, 0x9E, 0x5D, 0xE8, 0xE5, 0x30, 0x2E, 0xE0, 0xB1, 0x92, 0x85, 0x2B, 0x2A, 0x01, 0x59, 0x4D,
-    0xA6, 0x27, 0x20, 0x51, 0x90, 0x39, 0x90, 0x35, 0x89, 0x80, 0x3A, 0xC6, 0x75, 0x11, 0xBE, 0x11,
-    0x74, 0x0B, 0x10, 0xD2, 0xA5, 0x1E, 0x7C, 0x0B, 0x3B, 0xEC, 0x4B, 0x64, 0x60, 0xFF, 0x44, 0x2E,
-    0x26, 0x73, 0xF0, 0x82, 0x6D, 0x16, 0x70, 0xEB, 0x09, 0x88, 0x27, 0x90, 0xC8, 0x67, 0x4F, 0x16,
-    0xE8, 0x5A, 0x4F, 0xB6, 0x95, 0x8F, 0x97, 0x84, 0xDD, 0x11, 0x40, 0x97, 0x22, 0x6E, 0x55, 0x93,
-    0x37, 0x92, 0x35, 0xD2, 0x40, 0x0D, 0xE1, 0x2F, 0xC5, 0x25, 0x9B, 0xE0, 0x94, 0xDC, 0x2F, 0x35,
-    0x27, 0x01, 0x74, 0x7A, 0x66, 0x8E, 0xDF, 0xD2, 0xFD, 0xAC, 0xF3, 0x44, 0xAD, 0x9B, 0x1A, 0xC6,
-    0x8E, 0x8C, 0x71, 0x13, 0x9E, 0x5D, 0x83, 0x4F, 0x10, 0xEE, 0x13, 0x1E, 0x12, 0xB6, 0x84, 0x2B,
-    0x40, 0x0F, 0xF3, 0x03, 0x03, 0xA7, 0xC0, 0x65, 0x05, 0xA8, 0x46, 0x08, 0x07, 0x53, 0x98, 0x02,
-    0x55, 0x80, 0x6B, 0x69, 0xD9, 0xA4, 0x4C, 0x67, 0x9A, 0x09, 0x06, 0x6E, 0x97, 0xEE, 0x91, 0xA3,
-    0xCB, 0x82, 0x84, 0x5D, 0x20, 0x1A, 0x47, 0x43, 0xBB, 0xB4, 0x80, 0xAC, 0x96, 0x31, 0x14, 0x02,
-    0xF2, 0xE2, 0xD6, 0xF7, 0x55, 0x5F, 0x2C, 0xED, 0x3B, 0xBB, 0xBB, 0x29, 0x1D, 0x7A, 0xC5, 0x6C,
-    0x5C, 0x6B, 0xCC, 0x29, 0xB0, 0x92, 0x48, 0xB8, 0xC7, 0x93, 0x57, 0xA0, 0x55, 0x43, 0xB1, 0x25,
-    0x97, 0xE3, 0x3A, 0xFD, 0x77, 0x18, 0x28, 0xD3, 0x11, 0xFB, 0xC2, 0x4B, 0x6B, 0x58, 0xF5, 0x5F,
-    0x93, 0x85, 0x0D, 0x69, 0xC9, 0x10, 0x1A, 0xE6, 0x59, 0x66, 0xCB, 0x43, 0xFA, 0x12, 0xEC, 0xEB,
-    0xE8, 0xAA, 0xDF, 0xDA, 0xBF, 0x6B, 0xA9, 0x12, 0xF1, 0x86, 0xD0, 0xB9, 0x68, 0xDB, 0x4B, 0x56,
-    0x16, 0x86, 0x07, 0x18, 0xF1, 0xDE, 0x20, 0xF3, 0xAC, 0xA4, 0x5B, 0x15, 0x4C, 0x1E, 0x24, 0x2D,
-    0xA1, 0x32, 0x8A, 0xE0, 0xE1, 0xA0, 0xB6, 0x1C, 0x58, 0x0A, 0xE4, 0xFF, 0x4A, 0x1E, 0x6A, 0x3B,
-    0xAF, 0xA8, 0xD4, 0xBD, 0xD6, 0x9B, 0xE4, 0x5D, 0x58, 0x15, 0x8B, 0xA6, 0x00, 0xCD, 0xC9, 0x4D,
-    0x4F, 0xA9, 0x5F, 0x1B, 0x2C, 0x4A, 0x36, 0x28, 0x98, 0x03, 0xD7, 0x0E, 0x76, 0xD4, 0xF6, 0x21,
-    0xE1, 0x80, 0xFB, 0xF2, 0x33, 0x48, 0x1B, 0x84, 0x95, 0x5D, 0xB3, 0xD5, 0x19, 0x74, 0xE6, 0x51,
-    0x9C, 0x58, 0xAB, 0xC2, 0x36, 0x0A, 0x7D, 0x77, 0xE6, 0xA5, 0x3C, 0xF3, 0x60, 0x8D, 0x15, 0x18,
-    0x11, 0x66, 0x80, 0x5F, 0x20, 0x29, 0x3E, 0xFD, 0x73, 0xC0, 0xBD, 0xA7, 0x01, 0x3B, 0x5E, 0xD3,
-    0x10, 0x96, 0xC1, 0xDA, 0xB7, 0xE8, 0x2B, 0xC0, 0xDD, 0xA6, 0xFB, 0x83, 0x03, 0x79, 0xE6, 0x21,
-    0xCC, 0x44, 0x1E, 0xE5, 0x88, 0x11, 0x89, 0xA1, 0x87, 0xD5, 0x90, 0x06, 0x42, 0x3D, 0x7D, 0x2E,
-    0xBD, 0xBA, 0x69, 0xEC, 0xBB, 0x9F, 0x7D, 0x23, 0x34, 0x0A, 0xA1, 0xFC, 0x40, 0x3E, 0x48, 0x63,
-    0x50, 0x56, 0x7A, 0x01, 0xBB, 0xE1, 0xC9, 0x15, 0xE0, 0xB9, 0x1A, 0xF0, 0xD9, 0x86, 0x92, 0x04,
-    0x3F, 0xC1, 0xDA, 0x2E, 0xEC, 0x17, 0x07, 0xC0, 0xA7, 0x2C, 0xAF, 0xA1, 0x45, 0x2B, 0xE5, 0x9A,
-    0xA6, 0x34, 0xCC, 0xE4, 0xA2, 0x0C, 0xCA, 0x9D, 0x23, 0xD9, 0x8E, 0x56, 0x76, 0x70, 0x4E, 0xC3,
-    0x8D, 0x9A, 0x6F, 0x60, 0x10, 0xC3, 0x49, 0x10, 0x91, 0x20, 0x23, 0xEE, 0x0E, 0x85, 0xF1, 0x1A,
-    0x7C, 0xFC, 0x36, 0xBB, 0x8C, 0x7B, 0xCA, 0xEB, 0x00, 0x0B, 0xEE, 0x2C, 0xE9, 0x93, 0x4C, 0xB3,
-    0xAD, 0x03, 0x8C, 0xA5, 0x94, 0x69, 0xE5, 0x84, 0x2B, 0xDB, 0xF1, 0xED, 0x90, 0x59, 0x10, 0x98,
-    0xF0, 0xE4, 0x56, 0xC8, 0x52, 0x74, 0xBD, 0x4E, 0x66, 0xBE, 0x5C, 0x5C, 0xEF, 0xCD, 0xE3, 0x82,
-    0x7E, 0x65, 0xCD, 0x13, 0x82, 0x7E, 0x69, 0xD3, 0xE7, 0x04, 0xFD, 0xC2, 0x96, 0x2B, 0x41, 0x42,
-    0xCC, 0x0D, 0x50, 0xF1, 0x8B, 0x0A, 0x28, 0xFB, 0x5D, 0x09, 0x94, 0xC8, 0x76, 0x12, 0x24, 0x3A,
-    0x18, 0x10, 0x48, 0x55, 0x90, 0x4C, 0xAE, 0x30, 0xB3, 0x06, 0x1B, 0xA4, 0xCA, 0xEC, 0x42, 0x86,
-    0x2B, 0xCF, 0xF3, 0x1A, 0xA1, 0x7B, 0xCE, 0x6A, 0xAD, 0xF3, 0x2C, 0xB3, 0xA1, 0xAB, 0x06, 0x83,
-    0xC3, 0x6D, 0xA1, 0xB5, 0x33, 0xBC, 0xD3, 0x95, 0x3E, 0xE5, 0x33, 0xAE, 0xA3, 0xBB, 0xFF, 0x7A,
-    0xA4, 0xCD, 0xF5, 0xCE, 0x04, 0x1D, 0x4C, 0xBE, 0x32, 0x2B, 0xB9, 0x6C, 0x0F, 0x1C, 0xF7, 0x38,
-    0xF8, 0x1D, 0xDB, 0x96, 0x1D, 0x38, 0x81, 0xF9, 0x33, 0x5E, 0x22, 0x17, 0x17, 0x65, 0x8C, 0xAF,
-    0x85, 0x1A, 0x7C, 0x71, 0x69, 0xE2, 0x09, 0xE7, 0xC7, 0xF0, 0x03, 0x85, 0xBE, 0x93, 0x0D, 0xEF,
-    0x3C, 0x9E, 0x13, 0x41, 0x7A, 0xCD, 0xA0, 0xB4, 0x72, 0x24, 0x72, 0xFF, 0x1B, 0xD6, 0xBA, 0x58,
-    0x80, 0xAC, 0xA7, 0xAD, 0x50, 0x84, 0x36, 0xD0, 0xD3, 0x4D, 0xDA, 0xBC, 0x2B, 0xD2, 0x71, 0x49,
-    0x3F, 0x5A, 0xBE, 0xE9, 0x5C, 0x4B, 0xB7, 0x79, 0xDC, 0xD6, 0x7F, 0xD5, 0x6F, 0xE9, 0x1D, 0x56,
-    0x7B, 0xB8, 0x5B, 0xC6, 0x3B, 0x47, 0xB4, 0x27, 0x80, 0xEF, 0xD1, 0x3F, 0xB6, 0x15, 0xA6, 0xA4,
-    0xA7, 0xDE, 0x38, 0xCF, 0xD9, 0xC8, 0x84, 0x2F, 0xFA, 0x22, 0x45, 0x09, 0x0B, 0xEE, 0xE3, 0x95,
-    0xDF, 0x0B, 0x03, 0xEE, 0x84, 0xFF, 0x5E, 0x05, 0x51, 0x6B, 0xD0, 0x98, 0xFE, 0x8C, 0xBF, 0x67,
-    0x1A, 0x83, 0xF3, 0x90, 0x0C, 0xF6, 0xF3, 0xC2, 0x75, 0x65, 0x91, 0x6C, 0x4B, 0xEF, 0xB9, 0x77,
-    0xDE, 0x8C, 0x27, 0x99, 0x6D, 0x2E, 0x3C, 0x65, 0x97, 0xCD, 0xBE, 0x3C, 0xB7, 0x79, 0x0E, 0xE0,
-    0x5B, 0x00, 0x77, 0xE1, 0xDB, 0x73, 0xF6, 0x28, 0xA3, 0xE6, 0x4B, 0x79, 0x80, 0xDC, 0x32, 0xB1,
-    0x0E, 0x86, 0x32, 0x13, 0x2B, 0x3A, 0x21, 0x6B, 0xCE, 0x0A, 0xEC, 0xE3, 0x25, 0xB4, 0x10, 0xE1,
-    0xEA, 0x38, 0x7A, 0xEA, 0x88, 0x47, 0xC3, 0xE3, 0x0C, 0x69, 0x3B, 0x4B, 0x21, 0x72, 0x9F, 0x56,
-    0x2E, 0x38, 0xD8, 0x96, 0x03, 0xDD, 0xC5, 0xA4, 0xB6, 0x85, 0x93, 0x87, 0xA9, 0xA2, 0x14, 0xB9,
-    0x19, 0x45, 0x07, 0x07, 0xCF, 0x12, 0xEE, 0x53, 0xEC, 0xC0, 0x71, 0x70, 0xFA, 0x92, 0x5A, 0x38,
-    0x6A, 0xDE, 0x80, 0x56, 0x0B, 0xB5, 0x64, 0x3C, 0xA2, 0xA2, 0xC9, 0xEE, 0x97, 0x74, 0x96, 0x3B,
-    0x15, 0x85, 0xD4, 0xD8, 0x11, 0xBE, 0x27, 0x3A, 0x63, 0xA7, 0x10, 0xBF, 0x5C, 0xEE, 0x1E, 0x76,
-    0x09, 0xCE, 0x43, 0xFC, 0x27, 0x83, 0x10, 0x11, 0x41, 0x98, 0x1D, 0x90, 0xC8, 0x5A, 0x35, 0x28,
-    0x3A, 0x2F, 0x44, 0x32, 0x14, 0x69, 0xD1, 0x12, 0x95, 0x0E, 0xB9, 0x0F, 0xDD, 0x25, 0xFA, 0x85,
-    0x34, 0xD1, 0xEF, 0xE1, 0x56, 0xB2, 0xC3, 0x97, 0x43, 0xD8, 0xC5, 0x6A, 0x8D, 0xC4, 0xB8, 0xCF,
-    0x38, 0x91, 0xDD, 0x39, 0xDC, 0xEF, 0xD4, 0x4F, 0xBD, 0x64, 0x61, 0xDD, 0xC8, 0xD5, 0x78, 0xD0,
-    0x27, 0x90, 0x4D, 0x01, 0x45, 0x63, 0x82, 0x9B, 0x5F, 0x60, 0x45, 0x73, 0x70, 0x8E, 0x19, 0xDF,
-    0xE1, 0x12, 0x76, 0xFC, 0x5E, 0x33, 0x19, 0x35, 0xC1, 0xE5, 0xC6, 0x29, 0x0A, 0x7F, 0x8C, 0xD9,
-    0x8B, 0x29, 0xA8, 0xBC, 0x06, 0xD5, 0x44, 0xB8, 0x21, 0x0C, 0x27, 0x02, 0x7B, 0x21, 0xA8, 0x17,
-    0x69, 0xF7, 0xF8, 0x11, 0x77, 0xD3, 0x6A, 0x82, 0xBA, 0xCB, 0x74, 0xC7, 0x7D, 0xF0, 0x9D, 0xAB,
-    0x11, 0x5C, 0xE4, 0x06, 0xB5, 0x42, 0x0E, 0x97, 0x70, 0x59, 0xCF, 0xA1, 0x0A, 0x0B, 0x42, 0x4F,
-    0x77, 0x74, 0x5D, 0xD8, 0x5F, 0xB3, 0x6F, 0xBF, 0xA6, 0x1F, 0x20, 0x55, 0x6F, 0x7B, 0xDC, 0xDE,
-    0x01, 0xA6, 0x31, 0xB4, 0xD5, 0x6B, 0x05, 0xCF, 0x76, 0xAC, 0xF6, 0x99, 0x5B, 0x7B, 0xED, 0x6C,
-    0x64, 0x5C, 0x87, 0x89, 0xBA, 0x3B, 0xE9, 0xA1, 0x16, 0x98, 0xD9, 0xDF, 0xC2, 0xC0, 0xD0, 0x8D,
-    0x18, 0x27, 0x92, 0x08, 0xE3, 0x39, 0x45, 0x4D, 0x1F, 0xA2, 0x29, 0xB1, 0xB9, 0xC7, 0x18, 0x3C,
-    0x07, 0x38, 0xCF, 0xD4, 0x00, 0xD0, 0xCD, 0xF8, 0x23, 0xE9, 0x8F, 0x71, 0xFD, 0x49, 0x8F, 0xF6,
-    0xC7, 0x19, 0x1E, 0x1C, 0x36, 0x23, 0xDE, 0x77, 0xF8, 0x89, 0x23, 0xF8, 0xDF, 0x67, 0x2E, 0x22,
-    0x13, 0xF0, 0xC2, 0xD3, 0x20, 0xC0, 0x7D, 0xA8, 0x27, 0xE6, 0x39, 0xC2, 0x6F, 0x11, 0x1A, 0x07,
-    0x49, 0x0E, 0x01, 0x45, 0xBF, 0xA0, 0x87, 0x9F, 0x80, 0xC7, 0x24, 0x61, 0x05, 0x58, 0x54, 0x73,
-    0x5B, 0x3E, 0x87, 0x47, 0x3A, 0xF7, 0x28, 0x2A, 0x7A, 0x24, 0x25, 0xC4, 0x7D, 0xCA, 0xD7, 0xF3,
-    0x11, 0x93, 0xD2, 0x8B, 0x46, 0xE5, 0xF3, 0xE4, 0x4E, 0x58, 0x48, 0x44, 0x31, 0xCF, 0x3E, 0x91,
-    0x60, 0x6C, 0xAD, 0x7F, 0x4F, 0x1A, 0x87, 0x57, 0x8A, 0xE3, 0xD5, 0xE6, 0xEF, 0xFC, 0x3B, 0x6C,
-    0x0A, 0x75, 0xC6, 0xD0, 0x57, 0xEC, 0x22, 0xCC, 0x59, 0x3B, 0xF6, 0x43, 0x83, 0x51, 0xD9, 0x93,
-    0xED, 0xAA, 0x83, 0x6D, 0x47, 0x95, 0xE5, 0x49, 0x84, 0x0B, 0x53, 0x97, 0x59, 0xD3, 0x6F, 0x12,
-    0xD5, 0x6F, 0xF4, 0x11, 0x96, 0x37, 0xD5, 0x28, 0x3C, 0xFA, 0x68, 0x45, 0xB2, 0x4D, 0x8B, 0x3C,
-    0xAB, 0x54, 0xB2, 0x8D, 0xDA, 0x53, 0xD4, 0xDF, 0x43, 0xFD, 0x81, 0x92, 0x48, 0x45, 0x51, 0x7F,
-    0x7F, 0x48, 0x7E, 0x44, 0xB2, 0x5D, 0x89, 0x3C, 0xDC, 0xC0, 0x4C, 0x20, 0x92, 0x6D, 0x1A, 0xE1,
-    0x5E, 0x8F, 0xAE, 0x0B, 0x91, 0x70, 0x00, 0x53, 0xFE, 0xE2, 0xF4, 0x65, 0x55, 0x82, 0x3E, 0xC9,
-    0xB9, 0xBD, 0x82, 0xD8, 0x48, 0x2D, 0xEA, 0x1C, 0x18, 0x9C, 0xA2, 0x9E, 0x72, 0x5C, 0xD0, 0x53,
-    0x27, 0x0C, 0x86, 0x09, 0x9D, 0x9B, 0x51, 0x3F, 0x7D, 0xC1, 0x7D, 0x9D, 0x37, 0x73, 0xB7, 0xC6,
-    0x83, 0x06, 0x27, 0xE9, 0x29, 0x57, 0x3C, 0xA5, 0xFC, 0x79, 0xE0, 0xB2, 0x2E, 0xED, 0x5F, 0xF0,
-    0xDC, 0x95, 0x63, 0xA6, 0xDB, 0x04, 0x14, 0x9F, 0xEC, 0x4B, 0xCE, 0x02, 0xA4, 0x4E, 0x9B, 0xA2,
-    0xA2, 0x2D, 0x88, 0x6A, 0x37, 0x0F, 0x6D, 0x5C, 0x27, 0xF2, 0x15, 0x06, 0x23, 0x0F, 0x11, 0xB0,
-    0x38, 0x98, 0x02, 0xED, 0x32, 0x1C, 0x44, 0x51, 0x33, 0x85, 0xD8, 0x5D, 0xD8, 0x10, 0xA6, 0x3F,
-    0x5C, 0x35, 0x49, 0x0F, 0xAF, 0x36, 0x90, 0xC3, 0xB4, 0x13, 0xED, 0x88, 0x60, 0xD1, 0x05, 0xC7,
-    0x43, 0x19, 0x3F, 0xDC, 0x6E, 0x3C, 0xBA, 0x6B, 0xD4, 0x1F, 0x2C, 0x13, 0x9E, 0x3B, 0xD3, 0xDF,
-    0xA7, 0xEC, 0x4B, 0x30, 0xD0, 0xC9, 0x5E, 0xFA, 0x53, 0x7B, 0xED, 0xA2, 0x7E, 0x26, 0xE0, 0x93,
-    0x50, 0x17, 0x40, 0xA2, 0x7B, 0xD0, 0xBE, 0x07, 0xDB, 0xCA, 0x41, 0x1E, 0xCB, 0x5A, 0x96, 0x08,
-    0xB7, 0xA5, 0xD8, 0x77, 0x32, 0xE0, 0x63, 0xFD, 0x12, 0xDB, 0x39, 0x30, 0x1E, 0x78, 0x33, 0xA0,
-    0x6B, 0x07, 0xCA, 0x19, 0x4C, 0xE7, 0x86, 0x51, 0x92, 0xA7, 0x11, 0x26, 0xF8, 0xD8, 0xAB, 0xA3,
-    0x2D, 0xBC, 0x60, 0x2C, 0x08, 0x75, 0x46, 0xC3, 0xB8, 0xA1, 0x0D, 0x1D, 0xE8, 0xC3, 0xD2, 0xE6,
-    0x37, 0xE5, 0xB6, 0xA5, 0x93, 0xDB, 0x16, 0x22, 0xB7, 0x79, 0xAF, 0x4C, 0x72, 0x9B, 0xED, 0xF8,
-    0x73, 0x12, 0xB9, 0x4D, 0x8F, 0xF7, 0xDE, 0x80, 0xFA, 0x93, 0x3C, 0x29, 0x8B, 0x34, 0xC4, 0x4F,
-    0x0A, 0x45, 0x05, 0x06, 0xB9, 0xC4, 0x5E, 0x15, 0x25, 0x78, 0x80, 0xFD, 0xA0, 0x94, 0xE7, 0x42,
-    0x53, 0x6D, 0x3E, 0x2B, 0x14, 0x70, 0x68, 0xC2, 0xA6, 0x37, 0x61, 0x2D, 0xC7, 0x5C, 0x89, 0xFD,
-    0x1B, 0x8C, 0xFB, 0xF7, 0xEB, 0x1A, 0x38, 0x86, 0xD0, 0x68, 0x6F, 0x58, 0x9F, 0x11, 0xC4, 0x2F,
-    0xE8, 0x31, 0xF1, 0x9E, 0xFF, 0xF3, 0xF4, 0x11, 0x46, 0xDF, 0x3D, 0xEC, 0xBD, 0x92, 0xFC, 0xA8,
-    0xCB, 0x7E, 0xDC, 0x65, 0x3F, 0xEA, 0xE2, 0xEF, 0xAC, 0x3E, 0xE0, 0xDD, 0xCC, 0x63, 0x6A, 0x74,
-    0xA3, 0x95, 0x37, 0x9B, 0x17, 0x2C, 0x12, 0x9D, 0x5D, 0x43, 0x87, 0x8B, 0xBB, 0xFF, 0x1F, 0x37,
-    0x2C, 0x17, 0x70, 0x3D, 0x51, 0x9B, 0xCB, 0x47, 0x0D, 0xD1, 0x21, 0xD1, 0x14, 0x29, 0x5A, 0x44,
-    0x2A, 0x6B, 0x6E, 0xA2, 0x78, 0x42, 0x10, 0xC8, 0x1E, 0x57, 0x6F, 0xF1, 0x0E, 0x34, 0x9E, 0x15,
-    0x91, 0xB0, 0xD0, 0xB3, 0xCA, 0x69, 0x0E, 0x89, 0x3C, 0xE5, 0x3B, 0xF2, 0x1C, 0xFC, 0x0D, 0x6A,
-    0xA3, 0x5C, 0x09, 0x1B, 0x03, 0x84, 0xA4, 0x32, 0xC2, 0x5D, 0x1E, 0x9A, 0xF8, 0xA7, 0x8B, 0xB9,
-    0x56, 0xAC, 0xC2, 0x93, 0x71, 0xE2, 0x93, 0x71, 0x42, 0xD0, 0x36, 0x7C, 0xAD, 0x18, 0x0E, 0x52,
-    0x1E, 0x04, 0x7A, 0x20, 0xBC, 0xB4, 0xD7, 0xEF, 0xA9, 0x0A, 0xDF, 0xE9, 0x7C, 0x53, 0xDA, 0x74,
-    0xB8, 0x5C, 0xFB, 0x1D, 0x3B, 0x30, 0xE5, 0x73, 0x02, 0xA7, 0x92, 0x5B, 0x08, 0x58, 0xA2, 0x0E,
-    0x09, 0xA5, 0x71, 0x8B, 0xBB, 0x60, 0xCE, 0x33, 0x84, 0xAA, 0x92, 0xFC, 0x5B, 0x6C, 0x73, 0x50,
-    0x76, 0x4D, 0x58, 0x39, 0xA2, 0x07, 0x7C, 0xC4, 0xE8, 0x5E, 0x17, 0x98, 0xD1, 0xF0, 0x7F, 0x4B,
-    0x06, 0xBC, 0xA0, 0x0D, 0x95, 0xFB, 0x9D, 0x66, 0xFE, 0xF7, 0x23, 0xF8, 0xA9, 0xF2, 0xD9, 0x85,
-    0x10, 0x2C, 0x01, 0xE5, 0x71, 0x07, 0xB3, 0xCB, 0x61, 0xD9, 0xCF, 0xCE, 0xDF, 0xB8, 0x9C, 0x95,
-    0x81, 0x0D, 0x03, 0xC7, 0x7D, 0x33, 0x3A, 0x98, 0xCF, 0x31, 0x59, 0x83, 0x6B, 0xE6, 0xBA, 0x66,
-    0x94, 0x0B, 0x68, 0xDF, 0x96, 0xD5, 0x47, 0x67, 0x7C, 0x71, 0x86, 0xA1, 0x38, 0xA5, 0x4B, 0x38,
-    0x47, 0xFA, 0x50, 0x52, 0x41, 0x97, 0x8A, 0x48, 0xF8, 0xC7, 0x0C, 0x43, 0x0F, 0xBE, 0x22, 0x77,
-    0x5F, 0xD4, 0x8D, 0xCA, 0xA9, 0x1B, 0x1E, 0x15, 0x22, 0xCD, 0xBA, 0x32, 0x31, 0x7B, 0x1E, 0xA6,
-    0x73, 0x00, 0x68, 0xB8, 0x3E, 0x75, 0xB2, 0xF2, 0x98, 0x2B, 0xB8, 0x05, 0xC0, 0xF5, 0x02, 0x4C,
-    0x63, 0x49, 0x83, 0x40, 0xFA, 0x9F, 0x18, 0x0E, 0x80, 0xA1, 0x2B, 0x5F, 0x93, 0xFB, 0xC1, 0xD6,
-    0x5D, 0xE3, 0x96, 0xC9, 0x0A, 0xBC, 0x1F, 0x8D, 0x16, 0x6D, 0x69, 0xC4, 0x8C, 0x8F, 0x93, 0x05,
-    0x93, 0x3E, 0xA1, 0xCD, 0xFC, 0xAF, 0x88, 0x8D, 0x60, 0x30, 0x49, 0x0F, 0xF1, 0x03, 0xAE, 0x9B,
-    0x01, 0x91, 0xA9, 0x3E, 0x1E, 0x03, 0x3B, 0xAE, 0xD0, 0xF4, 0xEF, 0xAC, 0xC7, 0xC3, 0xF0, 0x3B,
-    0xFF, 0x42, 0xCA, 0x36, 0xF6, 0xCD, 0x9F, 0xD8, 0x17, 0x19, 0xD0, 0xF6, 0xE3, 0x52, 0x3D, 0xFE,
-    0xC5, 0xF5, 0xD4, 0x5E, 0xD7, 0x59, 0x34, 0x6A, 0x62, 0x48, 0x06, 0xA3, 0xAA, 0x30, 0x88, 0x7A,
-    0xE5, 0x14, 0x1D, 0x4D, 0x9E, 0x10, 0x81, 0x27, 0x99, 0xDD, 0x83, 0x38, 0x6D, 0xB3, 0xD2, 0x5C,
-    0x41, 0x14, 0x46, 0x22, 0x2C, 0xD5, 0xFC, 0xA5, 0x6C, 0xA8, 0xDA, 0x14, 0x70, 0x5D, 0x44, 0x0C,
-    0x39, 0x10, 0xB2, 0x58, 0x01, 0x67, 0x15, 0xE4, 0x0F, 0x90, 0xC6, 0x92, 0x58, 0x44, 0x91, 0x1E,
-    0xB1, 0x08, 0x22, 0x15, 0x0E, 0x58, 0xEC, 0x50, 0x34, 0x12, 0x2C, 0x77, 0x20, 0x4C, 0x28, 0x6D,
-    0xA1, 0x1E, 0x84, 0xF6, 0x05, 0xE9, 0xB8, 0xDF, 0x9F, 0xCD, 0xDE, 0x04, 0x1F, 0x1C, 0x2E, 0x27,
-    0x7F, 0xC7, 0xD8, 0x8F, 0x26, 0xB9, 0x4E, 0x19, 0xAC, 0xD2, 0x70, 0x75, 0x11, 0xCB, 0x34, 0xA5,
-    0xC4, 0x84, 0x4C, 0xBC, 0xC1, 0x66, 0x55, 0x08, 0x5A, 0x1D, 0x2D, 0x13, 0x8F, 0x3E, 0x63, 0x77,
-    0xD5, 0xD6, 0x21, 0x32, 0xF6, 0x25, 0x84, 0xAC, 0x1E, 0x2E, 0x31, 0x31, 0x97, 0x97, 0x30, 0x72,
-    0x3C, 0x22, 0xF0, 0xFC, 0x98, 0x47, 0xB1, 0x24, 0x4F, 0x5F, 0x52, 0x2A, 0xD4, 0xE8, 0xD4, 0xA5,
-    0xD5, 0xC0, 0x43, 0x4C, 0xFC, 0x56, 0x98, 0x28, 0x5C, 0x89, 0xB8, 0xE1, 0xD9, 0x9A, 0xD1, 0x7D,
-    0x0C, 0xF5, 0xBB, 0xAA, 0xEC, 0x93, 0xDC, 0x33, 0x52, 0x99, 0xE0, 0xB6, 0x12, 0x03, 0x43, 0xA3,
-    0x85, 0x12, 0xFE, 0x52, 0xA5, 0xA6, 0xDB, 0x5C, 0x42, 0x8F, 0x2A, 0x00, 0x45, 0xFC, 0xD9, 0x2B,
-    0xD1, 0x8F, 0xAD, 0x68, 0xF6, 0x4F, 0x54, 0xEA, 0xBB, 0x5D, 0x73, 0xAF, 0xC1, 0x52, 0x47, 0x17,
-    0x2A, 0x0F, 0x39, 0x4A, 0x48, 0xD1, 0x4D, 0xA6, 0x10, 0xC1, 0xD9, 0xA7, 0x27, 0x22, 0xDB, 0x7A,
-    0x34, 0x8A, 0x1C, 0xA7, 0x5E, 0x29, 0x63, 0xFE, 0x18, 0x3B, 0xD5, 0xE5, 0x99, 0x40, 0x83, 0x76,
-    0x8D, 0x50, 0xEF, 0x6F, 0xDF, 0x7E, 0xD6, 0xD2, 0x92, 0x62, 0x5D, 0x46, 0x97, 0xB1, 0xD7, 0x2E,
-    0xD9, 0x83, 0xEF, 0x6D, 0x5C, 0x33, 0x37, 0xA6, 0xAF, 0x4F, 0x37, 0xD4, 0x33, 0x85, 0x0D, 0x8D,
-    0x41, 0xA1, 0x4B, 0xD6, 0x63, 0x67, 0x8A, 0x15, 0x03, 0x1D, 0x2B, 0xE9, 0xFB, 0x4B, 0x05, 0x43,
-    0x47, 0x96, 0x8C, 0xF6, 0xD5, 0x18, 0xC4, 0x51, 0xB4, 0x18, 0x85, 0x62, 0x2C, 0x32, 0xD4, 0x0F,
-    0x19, 0x7C, 0xEB, 0x33, 0x7C, 0x35, 0x17, 0x92, 0xE2, 0xCC, 0xAC, 0x96, 0x32, 0x4B, 0x10, 0x7F,
-    0x3B, 0x45, 0x22, 0xFD, 0x52, 0xC2, 0x02, 0x5B, 0x55, 0x6E, 0x8F, 0xFB, 0x2E, 0x74, 0x08, 0xD3,
-    0xDF, 0x46, 0x94, 0x38, 0xB4, 0x32, 0x9F, 0x58, 0x30, 0xE4, 0xFE, 0xF3, 0x60, 0xAC, 0x22, 0x94,
-    0x49, 0x1F, 0xE4, 0x41, 0x2B, 0xF7, 0x58, 0xD7, 0x89, 0x29, 0x69, 0xD7, 0x0D, 0x31, 0xD4, 0x71,
-    0x45, 0xCA, 0xEE, 0x62, 0x75, 0x2C, 0x9C, 0xD5, 0x38, 0xA9, 0x7D, 0x8D, 0xD0, 0xE8, 0x68, 0x4C,
-    0xF0, 0x56, 0x7A, 0xCC, 0x37, 0x4C, 0x83, 0xF0, 0x6F, 0x3C, 0x3B, 0x28, 0x49, 0x32, 0x7E, 0xFA,
-    0x3A, 0xE2, 0x2D, 0x4D, 0xF8, 0xC5, 0x5F, 0x33, 0xA6, 0x2A, 0x6C, 0x18, 0xD4, 0x1E, 0xC2, 0x90,
-    0x6A, 0x2E, 0x84, 0x0D, 0xEE, 0x26, 0x8A, 0x00, 0x9C, 0x97, 0x6D, 0x88, 0x48, 0x41, 0xB9, 0x49,
-    0x03, 0x16, 0x06, 0xD4, 0x9B, 0x00, 0x48, 0x64, 0x9D, 0x3E, 0xE4, 0x31, 0x20, 0xA8, 0x60, 0x78,
-    0x51, 0x35, 0xC5, 0x6A, 0x31, 0xC4, 0xC4, 0xF8, 0xD7, 0xD1, 0x8F, 0xE5, 0x5B, 0xDC, 0x41, 0x2F,
-    0xE2, 0xF1, 0x21, 0x2D, 0x7C, 0x31, 0x09, 0x50, 0x83, 0xDB, 0xF4, 0xC4, 0xBF, 0x31, 0x20, 0x08,
-    0xE1, 0xD7, 0x83, 0x3C, 0xD1, 0xFF, 0x87, 0x01, 0xF6, 0xD4, 0xD7, 0x07, 0x79, 0x5E, 0xF0, 0xFA,
-    0x20, 0x2C, 0x29, 0x12, 0x28, 0x27, 0xE4, 0xAF, 0x87, 0xD8, 0x36, 0x02, 0x13, 0x9C, 0x1E, 0xD6,
-    0xD0, 0x5F, 0xA2, 0x6B, 0xE7, 0x6B, 0x4C, 0x76, 0x35, 0x27, 0x57, 0x42, 0x5C, 0xAF, 0x5D, 0x2B,
-    0xD4, 0xBC, 0x2E, 0x8C, 0x93, 0x39, 0xAE, 0x1C, 0x2A, 0x77, 0x3A, 0x63, 0x10, 0x28, 0xF3, 0x30,
-    0x8A, 0x9F, 0xF3, 0xC4, 0x40, 0x7E, 0x4E, 0xB5, 0x7D, 0x7B, 0xF7, 0xCB, 0x37, 0x9F, 0xB1, 0x53,
-    0xEA, 0x1C, 0x03, 0x72, 0xAF, 0x1D, 0x5C, 0xBA, 0xCE, 0x98, 0x25, 0x98, 0x02, 0x7E, 0xBC, 0x62,
-    0x64, 0x9F, 0x28, 0xFF, 0x7F, 0xB5, 0xA2, 0xD0, 0x5D, 0x9A, 0x38, 0x58, 0x25, 0x9A, 0x00, 0x90,
-    0x48, 0x6B, 0xC5, 0xD6, 0x85, 0x80, 0x2B, 0x21, 0xAD, 0xC3, 0x60, 0xE5, 0xBC, 0xBE, 0x6D, 0xB0,
-    0xA2, 0x2B, 0xBD, 0x5C, 0xAC, 0x02, 0x38, 0xCA, 0xE1, 0x58, 0xC5, 0x67, 0x88, 0x68, 0x1A, 0x32,
-    0x2B, 0xDF, 0x45, 0x98, 0xBD, 0x6B, 0x75, 0xA0, 0x08, 0x46, 0x6D, 0x0A, 0x46, 0x98, 0x30, 0xCC,
-    0x11, 0xB1, 0xD5, 0xDD, 0xBC, 0x43, 0xBD, 0x4C, 0xBA, 0xAF, 0xF1, 0xB8, 0x66, 0x45, 0x51, 0xC2,
-    0x78, 0x58, 0x44, 0x48, 0x63, 0xB5, 0xB3, 0x25, 0x8C, 0xBA, 0xBD, 0xDA, 0xE6, 0x4D, 0x18, 0xFF,
-    0x1C, 0x14, 0x2A, 0x73, 0xF2, 0x33, 0xD8, 0x59, 0xCC, 0xD9, 0xF8, 0xA7, 0x10, 0xE1, 0xCC, 0x61,
-    0x0C, 0x7F, 0x81, 0xB0, 0x7C, 0xC1, 0x72, 0x00, 0x2E, 0x80, 0x65, 0x95, 0xC3, 0x41, 0xAE, 0x13,
-    0x21, 0x2C, 0xB2, 0xC0, 0x08, 0x14, 0xA3, 0xBC, 0x36, 0xE2, 0xA8, 0xDF, 0xDD, 0x7D, 0xB6, 0x54,
-    0x17, 0x6F, 0xE4, 0xB8, 0xD3, 0x8E, 0x3B, 0x94, 0x3B, 0x8D, 0xE3, 0x63, 0x80, 0x98, 0x70, 0x7F,
-    0x15, 0x57, 0xC2, 0x3E, 0xCC, 0xD5, 0x5E, 0xBA, 0x33, 0xE9, 0x1F, 0xEA, 0x42, 0xB6, 0xEA, 0x7B,
-    0x2B, 0xDE, 0xB5, 0x3C, 0xF2, 0x93, 0x9A, 0x81, 0x90, 0x8D, 0xE8, 0xE7, 0x90, 0x65, 0xEB, 0xA4,
-    0x66, 0x0A, 0xA8, 0xE8, 0xEB, 0xB4, 0x66, 0x96, 0x49, 0xAD, 0x07, 0x2C, 0x31, 0x74, 0xD2, 0x7A,
-    0x39, 0xF0, 0x1C, 0xAB, 0x35, 0x9D, 0x25, 0x69, 0xA0, 0x86, 0x23, 0xC2, 0xDB, 0xD8, 0x16, 0xEE,
-    0x64, 0x1A, 0xE5, 0x32, 0x26, 0xF2, 0x8C, 0x28, 0xEE, 0x77, 0x9F, 0xA9, 0xA9, 0xF4, 0x85, 0x34,
-    0xBC, 0xA9, 0xE0, 0x60, 0x4B, 0xED, 0xF9, 0x2F, 0x1A, 0xA7, 0x20, 0x38, 0x9F, 0x20, 0xA8, 0xEE,
-    0x5D, 0x46, 0x4D, 0xD9, 0x37, 0x87, 0x18, 0x89, 0x06, 0xDF, 0x19, 0xD8, 0x07, 0x7F, 0x08, 0xD0,
-    0x05, 0x7F, 0x90, 0x0D, 0x1B, 0xF4, 0x82, 0x60, 0x6A, 0x00, 0x1F, 0xCF, 0xAD, 0x2C, 0xA2, 0xA8,
-    0xFE, 0x58, 0xDC, 0x3A, 0x6A, 0x41, 0xB3, 0xA1, 0x86, 0x00, 0x4F, 0x4D, 0xE6, 0x2B, 0x20, 0x87,
-    0x67, 0xF7, 0x2B, 0x2E, 0x7F, 0x84, 0xC9, 0xA7, 0x4A, 0x8F, 0x88, 0x6D, 0x4C, 0xB5, 0x29, 0x8B,
-    0xBA, 0x33, 0x52, 0x73, 0x6B, 0x46, 0x22, 0x16, 0x7E, 0x3D, 0xD2, 0xB8, 0x6F, 0x97, 0xE5, 0x94,
-    0xA5, 0xF0, 0x72, 0xAA, 0x74, 0xBC, 0xBB, 0xEB, 0x92, 0x24, 0xED, 0x1A, 0x5B, 0x3D, 0xF8, 0xBE,
-    0x15, 0x2E, 0xE0, 0x48, 0x79, 0x88, 0x46, 0x0A, 0x0E, 0xBB, 0x68, 0x24, 0xE1, 0x78, 0x15, 0xAD,
-    0x22, 0xCD, 0x6A, 0x49, 0x9A, 0x68, 0x24, 0xDD, 0xAC, 0x8E, 0x56, 0x0C, 0x24, 0x06, 0x4F, 0x85,
-    0xF5, 0x44, 0x99, 0x2C, 0xAD, 0x32, 0x2E, 0xF4, 0x20, 0x42, 0xFC, 0x8B, 0xC7, 0x20, 0xC4, 0x18,
-    0x01, 0xD6, 0xA0, 0xE4, 0x0E, 0x29, 0xCD, 0x49, 0x8F, 0x66, 0x0D, 0xDB, 0x66, 0xD0, 0x67, 0x5C,
-    0x16, 0x8D, 0xBE, 0x19, 0x5B, 0x4B, 0x10, 0xE1, 0x4B, 0xBB, 0x57, 0x94, 0xB6, 0xB1, 0x51, 0x54,
-    0x3C, 0x13, 0x26, 0xAB, 0x5C, 0x13, 0xF6, 0xEC, 0x52, 0x5B, 0xCB, 0x21, 0x56, 0x35, 0xC1, 0x51,
-    0x8F, 0x52, 0xB7, 0x13, 0xB4, 0xAD, 0x50, 0x10, 0xC5, 0x6C, 0xF9, 0x42, 0xF2, 0x0B, 0xDD, 0x23,
-    0x32, 0xF5, 0xB5, 0xEE, 0x92, 0x58, 0xE8, 0xA9, 0x60, 0x4B, 0xE8, 0xA9, 0xCE, 0x20, 0xBE, 0x93,
-    0xA6, 0x68, 0x3F, 0x63, 0x68, 0x25, 0xC4, 0x11, 0x1B, 0x8A, 0x78, 0xDE, 0x87, 0x50, 0x34, 0x21,
-    0x54, 0x0C, 0xB0, 0xD6, 0xA4, 0x22, 0x26, 0x7A, 0xED, 0x42, 0x9E, 0xF7, 0x3C, 0x4E, 0xA1, 0xF8,
-    0xFA, 0x7F, 0x75, 0xF9, 0xF3, 0x85, 0xEC, 0x03, 0x1E, 0x27, 0x11, 0x2C, 0xA2, 0x74, 0x5A, 0x25,
-    0xD0, 0x0E, 0x01, 0xEA, 0xA0, 0x54, 0xEE, 0x38, 0x65, 0x90, 0x60, 0xD6, 0x1E, 0xDD, 0x5B, 0xB9,
-    0x54, 0x89, 0x6F, 0xAC, 0x25, 0x8F, 0xD0, 0x62, 0x92, 0xCC, 0x71, 0xBA, 0x33, 0x70, 0xE9, 0xA9,
-    0xB4, 0x90, 0xEC, 0x59, 0x88, 0x83, 0xC3, 0x45, 0xB8, 0xC8, 0x9C, 0x22, 0x90, 0x88, 0xA6, 0x90,
-    0xC6, 0x72, 0x12, 0xD6, 0xE1, 0xAD, 0x02, 0x59, 0x30, 0x90, 0x4D, 0x1E, 0x85, 0x5C, 0x3D, 0x47,
-    0x6D, 0x05, 0xB5, 0x0F, 0xAE, 0xD4, 0x5F, 0xF9, 0x2A, 0xA4, 0xB1, 0x85, 0x1D, 0x52, 0x51, 0xFA,
-    0xEB, 0xA4, 0x4A, 0x56, 0x49, 0x19, 0xB7, 0x91, 0x08, 0x40, 0x1E, 0x0B, 0x01, 0xC8, 0xB3, 0xBE,
-    0x81, 0xC3, 0x5C, 0x06, 0x76, 0x80, 0x0E, 0xE2, 0x40, 0xA1, 0xE1, 0xAE, 0xD7, 0x1F, 0xF0, 0xB3,
-    0x62, 0x85, 0x84, 0x99, 0x08, 0xC1, 0x48, 0xDF, 0x35, 0xCC, 0x69, 0xEA, 0x8D, 0x77, 0xF1, 0x0A,
-    0x42, 0xC8, 0xFF, 0xD9, 0xF6, 0x91, 0xBD, 0xD5, 0x7B, 0xFF, 0xC7, 0x3C, 0xA7, 0xD2, 0xA0, 0x74,
-    0xA6, 0xB6, 0xB2, 0xE0, 0xB0, 0xAA, 0xC2, 0x94, 0x06, 0x31, 0xD3, 0x72, 0x87, 0xB6, 0x94, 0x0F,
-    0xE8, 0xE9, 0x3B, 0x29, 0xCE, 0x3D, 0x50, 0x98, 0x41, 0xFF, 0x48, 0x69, 0x29, 0xE9, 0x10, 0x14,
-    0x91, 0x55, 0x38, 0x9A, 0xA5, 0x7B, 0x37, 0xF7, 0x6E, 0xEE, 0x8D, 0x74, 0x00, 0x3E, 0xF3, 0x58,
-    0x31, 0xA8, 0x26, 0x12, 0xB9, 0x53, 0xFE, 0x18, 0x76, 0xB9, 0xAD, 0x1A, 0xFD, 0x6B, 0xC6, 0x4C,
-    0x97, 0x60, 0x74, 0xE4, 0xA9, 0x95, 0xA4, 0x39, 0x19, 0x14, 0xA1, 0xB7, 0x89, 0x08, 0x93, 0x52,
-    0x78, 0x41, 0x13, 0x57, 0x22, 0x99, 0x36, 0x01, 0x92, 0xFB, 0x21, 0x2B, 0x08, 0x5C, 0x34, 0x80,
-    0xDE, 0xED, 0xA0, 0x5E, 0x83, 0x32, 0x03, 0x0D, 0x12, 0xD5, 0xE4, 0xBB, 0xD8, 0x6B, 0x72, 0x4F,
-    0xA1, 0x84, 0x1B, 0x3D, 0xDD, 0xEE, 0x2B, 0xCA, 0xA6, 0xF9, 0x5C, 0xAA, 0xA1, 0x39, 0x31, 0x74,
-    0x8C, 0x96, 0x92, 0x24, 0x03, 0x0E, 0x10, 0x80, 0xB3, 0xC0, 0xB4, 0xE6, 0x38, 0xF8, 0x0A, 0x66,
-    0x25, 0xCA, 0x86, 0x47, 0x60, 0xFF, 0x2A, 0xEE, 0xC6, 0x80, 0x7F, 0xE1, 0xC5, 0xED, 0x97, 0x00,
-    0x2D, 0x3C, 0xC1, 0x88, 0xF9, 0xCA, 0xFA, 0xA4, 0x3F, 0x23, 0xEC, 0x44, 0x28, 0xAA, 0xB8, 0xDE,
-    0xCB, 0x35, 0x0F, 0x45, 0xEE, 0x4A, 0xFD, 0x16, 0xEF, 0xD0, 0xEA, 0xDD, 0x78, 0xE7, 0xDA, 0x6D,
-    0x6A, 0xA6, 0x8D, 0xE1, 0xF0, 0xE0, 0xEE, 0xD6, 0x51, 0x9C, 0x1F, 0xA7, 0x39, 0xA6, 0xA6, 0x2F,
-    0xA4, 0x07, 0x73, 0xAD, 0x12, 0x48, 0x8C, 0xB8, 0x93, 0x04, 0x91, 0x3B, 0x02, 0x92, 0x26, 0x7B,
-    0x57, 0x7E, 0xC9, 0xEC, 0x20, 0x07, 0xD3, 0x4D, 0x44, 0x00, 0x34, 0x8F, 0xD1, 0xF2, 0x4D, 0x90,
-    0xD5, 0xBC, 0x38, 0xC4, 0xD7, 0x70, 0x83, 0x94, 0xB7, 0xD2, 0xAA, 0x0C, 0x10, 0xED, 0x98, 0xBA,
-    0x39, 0x18, 0x8D, 0x9E, 0x2A, 0x21, 0xD7, 0x87, 0x2A, 0x97, 0x26, 0x7F, 0x4D, 0x13, 0xFD, 0x8E,
-    0xC7, 0x7D, 0x78, 0xA8, 0xFB, 0xB4, 0xD5, 0x3D, 0xAB, 0x31, 0xF5, 0x9E, 0x9A, 0x31, 0x7D, 0xDD,
-    0x9B, 0xDC, 0x57, 0x51, 0x4B, 0x6E, 0x2B, 0x6C, 0xBE, 0xA4, 0xE7, 0x80, 0x87, 0xDA, 0x72, 0x08,
-    0xF5, 0x68, 0x8B, 0xF4, 0x64, 0xFB, 0xCF, 0x9A, 0x91, 0xF1, 0x9A, 0x4A, 0xA8, 0x4A, 0x60, 0x2E,
-    0xE5, 0x4C, 0x55, 0xA2, 0x31, 0xB0, 0x36, 0x56, 0x5A, 0x0B, 0xAB, 0x35, 0x7D, 0x79, 0x25, 0x4A,
-    0x12, 0x20, 0x13, 0x83, 0x7C, 0x86, 0xE1, 0xF9, 0x35, 0x7C, 0xC1, 0x41, 0x49, 0xEB, 0x07, 0x84,
-    0x92, 0x32, 0x1A, 0x2B, 0x4A, 0xC8, 0xF0, 0x77, 0x78, 0xBF, 0x27, 0xA8, 0x35, 0xEF, 0xB3, 0x8B,
-    0x97, 0xD9, 0x43, 0x66, 0x6B, 0xF5, 0xAA, 0x35, 0xAB, 0xEA, 0x5B, 0x19, 0x8D, 0x5F, 0xA4, 0xEA,
-    0x23, 0xE0, 0x1B, 0x5F, 0xE0, 0x1E, 0xC9, 0xDE, 0xEC, 0xD5, 0x0F, 0x46, 0x79, 0x33, 0x68, 0x12,
-    0x1A, 0x63, 0x5A, 0x0D, 0xF9, 0xDC, 0xF7, 0xB7, 0x65, 0x76, 0x7D, 0x2C, 0x66, 0xF4, 0xF4, 0xAB,
-    0x9F, 0x4B, 0xA1, 0x0D, 0x26, 0x08, 0xDB, 0x1C, 0x98, 0xD3, 0x5E, 0xF8, 0xE4, 0x9E, 0x39, 0x73,
-    0xD7, 0xCA, 0xB3, 0x47, 0xC7, 0x75, 0x1F, 0xE7, 0x7E, 0xED, 0xDF, 0x62, 0x56, 0xB5, 0xE2, 0x29,
-    0x8E, 0x40, 0xB6, 0x4C, 0xD4, 0x8D, 0x7F, 0x4F, 0x9D, 0x46, 0x20, 0xF3, 0xE2, 0x6C, 0x65, 0xCA,
-    0x95, 0x5D, 0xA4, 0x2E, 0x85, 0xCD, 0x9F, 0x5A, 0xFB, 0x6D, 0xCB, 0xDD, 0x5B, 0xFC, 0x92, 0x4D,
-    0x6C, 0xCC, 0xA2, 0xC9, 0x90, 0xDF, 0xA4, 0xB1, 0x88, 0xC2, 0xD3, 0x63, 0xA3, 0xF1, 0x89, 0xC2,
-    0xDA, 0x77, 0xB4, 0xB9, 0x92, 0xFB, 0x9C, 0x75, 0x4D, 0xB9, 0xFB, 0xBE, 0xBB, 0x00, 0x09, 0x77,
-    0x46, 0xBF, 0x26, 0x0F, 0x5C, 0x99, 0x31, 0x9A, 0xF1, 0xF5, 0x86, 0xB1, 0x9C, 0x72, 0x66, 0x15,
-    0x6F, 0xD6, 0xFA, 0xE0, 0xCA, 0x64, 0x3F, 0x2B, 0xC7, 0xEE, 0x24, 0xEF, 0x96, 0xDA, 0xC9, 0x9C,
-    0x5A, 0xAB, 0x46, 0x31, 0x18, 0x97, 0xE2, 0x86, 0xCB, 0x83, 0x61, 0x1A, 0x26, 0x4D, 0x5B, 0x1A,
-    0xE6, 0xC8, 0x64, 0x42, 0x0D, 0x74, 0x1C, 0x8B, 0x0E, 0xCC, 0xF9, 0xE3, 0x4A, 0x95, 0xF3, 0xA1,
-    0x36, 0x13, 0xE4, 0x6C, 0x4E, 0x58, 0xD8, 0x79, 0x19, 0xBB, 0xB9, 0x79, 0x71, 0x8D, 0x97, 0xD3,
-    0x86, 0x5E, 0xC5, 0xB6, 0x8D, 0xC9, 0x23, 0x3A, 0x6D, 0x89, 0xDC, 0x86, 0xC4, 0x52, 0xE9, 0x00,
-    0x18, 0xCF, 0xB7, 0x45, 0x1A, 0x91, 0x11, 0xE2, 0x2C, 0x47, 0x84, 0x0C, 0xA8, 0xAA, 0xA8, 0x8A,
-    0xCA, 0x67, 0xAD, 0x88, 0x4C, 0xE4, 0x86, 0x65, 0xC9, 0x96, 0x30, 0x1E, 0x21, 0x06, 0x46, 0x10,
-    0x8A, 0x98, 0x94, 0x6A, 0x4B, 0x04, 0x29, 0xA3, 0x7F, 0x0D, 0xE0, 0x0F, 0x27, 0x6F, 0x5A, 0x0E,
-    0x4F, 0x18, 0xBD, 0x8B, 0x6F, 0xF7, 0x8D, 0xDE, 0x99, 0x46, 0x20, 0xF0, 0xAB, 0x9C, 0xBA, 0x13,
-    0x7A, 0xA0, 0x52, 0x80, 0x9A, 0x0B, 0x41, 0xAE, 0xCA, 0xBE, 0x74, 0x78, 0x5F, 0x9A, 0x4C, 0x45,
-    0xB3, 0x89, 0x8B, 0xF4, 0x3F, 0xB1, 0xF6, 0x7E, 0x32, 0x19, 0x8D, 0x43, 0x3F, 0x55, 0x8C, 0xF3,
-    0x15, 0x4E, 0xD4, 0xF6, 0xF0, 0x77, 0xDD, 0x54, 0xAD, 0xD6, 0xAE, 0xF5, 0x34, 0x73, 0x33, 0x52,
-    0x75, 0x5F, 0x24, 0x28, 0x8A, 0x4B, 0x2F, 0xD4, 0x4C, 0x37, 0xE3, 0x29, 0xE9, 0x24, 0x80, 0x88,
-    0xB5, 0x13, 0xB8, 0xF8, 0x6A, 0xD3, 0x60, 0x7D, 0x13, 0xA2, 0x7C, 0x44, 0xAB, 0x0D, 0xD4, 0x1E,
-    0x47, 0x28, 0xA4, 0xE2, 0xB2, 0xCE, 0x71, 0x17, 0x77, 0xEB, 0x25, 0x85, 0x3C, 0x3C, 0xF6, 0x15,
-    0x8A, 0xFA, 0xBF, 0xEA, 0xD1, 0xA7, 0x48, 0x15, 0x57, 0x0F, 0xA6, 0x10, 0x10, 0x40, 0xB7, 0xDE,
-    0x79, 0xF7, 0xEF, 0xEB, 0xB8, 0x40, 0x09, 0xEA, 0xAA, 0x46, 0x99, 0x06, 0xFD, 0xDF, 0x0A, 0x4B,
-    0x82, 0xC5, 0x29, 0x76, 0xE7, 0x03, 0x7D, 0xA6, 0x51, 0x2B, 0xEB, 0x12, 0x75, 0x59, 0x3D, 0x01,
-    0xFC, 0xCA, 0x3F, 0xF0, 0x12, 0x5E, 0xCC, 0xAF, 0x2D, 0xFB, 0xE7, 0xB0, 0x42, 0x6A, 0xF0, 0x58,
-    0xB9, 0xDB, 0xAB, 0x54, 0x33, 0xFF, 0x8B, 0x6F, 0x4E, 0x09, 0x1B, 0xFF, 0x34, 0x15, 0x4C, 0xD2,
-    0xB5, 0x68, 0xCE, 0xB8, 0xC6, 0xC5, 0xCB, 0xDF, 0x70, 0x17, 0x4D, 0xCB, 0xF3, 0xFC, 0xD8, 0xF8,
-    0xC3, 0xB1, 0x71, 0xD9, 0xAC, 0xC5, 0xB9, 0xAE, 0xDB, 0xFE, 0x64, 0x3C, 0xF1, 0xE8, 0x04, 0xD2,
-    0xE2, 0x03, 0xDF, 0xB6, 0xB4, 0x20, 0x0B, 0x27, 0xB0, 0xE7, 0x7A, 0x8F, 0x66, 0xF0, 0xE2, 0x9C,
-    0xF3, 0x49, 0x3E, 0x8F, 0xC8, 0xB2, 0x5A, 0x26, 0xF7, 0x6B, 0xE6, 0x0F, 0x40, 0x9C, 0xAE, 0x64,
-    0xC9, 0xD4, 0x58, 0x25, 0xAB, 0x23, 0x8D, 0xF6, 0x4E, 0x8D, 0xE9, 0x5B, 0x63, 0xC3, 0x65, 0xF2,
-    0x64, 0x14, 0x11, 0x3E, 0x03, 0xB6, 0x82, 0xA5, 0xFB, 0xB3, 0xB1, 0x94, 0x01, 0xB3, 0x41, 0x35,
-    0x2A, 0x80, 0x21, 0xC3, 0x37, 0xF6, 0xAE, 0xBF, 0xB3, 0xA7, 0xC1, 0xD8, 0xE7, 0x28, 0xB8, 0x2C,
-    0x69, 0xE0, 0xC8, 0xD5, 0xC3, 0xEA, 0x1C, 0x50, 0xE7, 0xC7, 0x91, 0xA6, 0xCE, 0x1F, 0xA3, 0xE1,
-    0xCE, 0x89, 0x13, 0xC4, 0xF6, 0x3D, 0xC5, 0x5F, 0x8F, 0x4E, 0xEB, 0x26, 0x1E, 0xB7, 0x80, 0x4B,
-    0xA4, 0x31, 0xBE, 0x8B, 0x8E, 0xFE, 0x23, 0x37, 0x65, 0x7F, 0xBC, 0x39, 0x83, 0xA9, 0x9A, 0x77,
-    0xB1, 0xC3, 0xB5, 0x96, 0x53, 0x25, 0x0A, 0x36, 0x4C, 0x83, 0x75, 0xF1, 0x85, 0xC1, 0x84, 0x2B,
-    0xC1, 0x22, 0x4D, 0xC6, 0x4D, 0x50, 0x31, 0x2C, 0xB4, 0x39, 0x25, 0x5D, 0x2B, 0x4A, 0x35, 0x54,
-    0x16, 0x55, 0xB6, 0x81, 0xB1, 0xF1, 0xD7, 0x31, 0x14, 0x07, 0x87, 0xE1, 0xE3, 0xC4, 0x69, 0xD0,
-    0xC0, 0x76, 0x4B, 0xCA, 0x8B, 0x61, 0xFD, 0x0A, 0xEC, 0x93, 0x76, 0x75, 0x86, 0x16, 0xA1, 0x1B,
-    0x14, 0x7A, 0x62, 0x24, 0x30, 0x39, 0xD7, 0xE7, 0xF9, 0x23, 0xDC, 0x5F, 0xE5, 0x21, 0xE3, 0xDD,
-    0xB8, 0xF0, 0xAC, 0x7E, 0x54, 0xFE, 0xF1, 0x69, 0xB3, 0xED, 0xDF, 0xEF, 0xAF, 0x45, 0xF8, 0xE0,
-    0xE0, 0xC0, 0x25, 0x90, 0xE9, 0x91, 0xF6, 0xC3, 0x3F, 0xF4, 0xF9, 0xFB, 0x67, 0x3E, 0xB1, 0xD8,
-    0x32, 0x0F, 0x0F, 0x9A, 0xE5, 0x78, 0x33, 0x13, 0xA2, 0x85, 0xC2, 0x0C, 0xD5, 0x11, 0x07, 0x8B,
-    0x7C, 0x55, 0xA6, 0xD6, 0xA3, 0xBB, 0xF9, 0xA2, 0x66, 0xB9, 0xB5, 0x9B, 0x60, 0xB5, 0x91, 0xA0,
-    0x39, 0x83, 0x39, 0x65, 0x22, 0x1C, 0x46, 0x63, 0xA0, 0x53, 0x18, 0xFB, 0x2F, 0xA7, 0x60, 0x8F,
-    0xF4, 0xD8, 0x8D, 0x96, 0xE1, 0xED, 0x80, 0xE5, 0x20, 0x7A, 0x07, 0x18, 0x0F, 0x59, 0x21, 0xE6,
-    0x03, 0x66, 0x4D, 0x28, 0x4E, 0x30, 0x68, 0xC2, 0x9A, 0x09, 0x83, 0x19, 0x48, 0x7B, 0xFA, 0x69,
-    0x26, 0x07, 0x32, 0xFB, 0xC6, 0xB0, 0x0E, 0xFB, 0x64, 0xCE, 0x40, 0xA5, 0x82, 0x59, 0xB2, 0xB3,
-    0xA5, 0x62, 0xEB, 0x8F, 0xF0, 0x21, 0xC3, 0xAA, 0x19, 0x0F, 0x81, 0x84, 0x22, 0x4C, 0x6E, 0xFC,
-    0xCB, 0x06, 0xC3, 0xA8, 0xA6, 0xF8, 0x07, 0xCE, 0x06, 0xDC, 0x37, 0x87, 0x51, 0xF5, 0x07, 0xA6,
-    0xF5, 0xF2, 0xE4, 0x1C, 0x82, 0xA0, 0xDF, 0xAD, 0xC6, 0x81, 0xF2, 0xB2, 0x04, 0x13, 0x7E, 0x28,
-    0x97, 0x79, 0xAD, 0x1C, 0xB9, 0x7E, 0xE3, 0x39, 0x07, 0xD8, 0xA2, 0xDC, 0x24, 0x8A, 0xB0, 0x7C,
-    0xEC, 0xE0, 0x12, 0x72, 0x98, 0xCA, 0xE4, 0xA5, 0x5D, 0xB5, 0x45, 0x8D, 0x7C, 0x46, 0xD6, 0xEC,
-    0x4F, 0x35, 0x30, 0xA6, 0xCC, 0x44, 0xE8, 0xFC, 0x13, 0x61, 0xB7, 0x67, 0x87, 0xF6, 0x87, 0x3B,
-    0xA7, 0xF7, 0x8B, 0xF8, 0x8F, 0x0E, 0x2F, 0x9E, 0x7E, 0x55, 0x0F, 0x10, 0x78, 0x24, 0x0F, 0x3D,
-    0xDB, 0x7C, 0xCF, 0x9C, 0xA6, 0x03, 0xCE, 0x9B, 0x37, 0x6A, 0x34, 0xAC, 0xD9, 0xC2, 0x27, 0x5E,
-    0xFD, 0xAD, 0x39, 0xDB, 0xE9, 0xAB, 0x47, 0x39, 0xF8, 0xF8, 0x75, 0x42, 0xFD, 0x3A, 0xA5, 0x20,
-    0x97, 0x4A, 0x8A, 0xF1, 0xFD, 0x90, 0x5F, 0xFF, 0x33, 0xD4, 0xC5, 0x79, 0x85, 0x5F, 0xFF, 0x8C,
-    0xB9, 0x68, 0x3E, 0xF8, 0xBF, 0xC0, 0x9D, 0x37, 0xD8, 0xC9, 0x8E, 0xB9, 0x0A, 0xF7, 0xF9, 0x2F,
-    0x2E, 0x5B, 0xEB, 0xEC, 0xB2, 0xFC, 0x81, 0xA7, 0x12, 0xD4, 0xB7, 0xBC, 0xEA, 0x1E, 0x3C, 0xCE,
-    0xA3, 0x58, 0xE1, 0xBD, 0x3A, 0x55, 0xF1, 0xE1, 0x30, 0x33, 0xBA, 0xE5, 0x92, 0x4B, 0xF2, 0xD0,
-    0x1F, 0xCC, 0xC3, 0x3C, 0x7F, 0xBB, 0x61, 0x2E, 0x5E, 0x5D, 0x73, 0xCC, 0x4F, 0xCD, 0x9D, 0x4B,
-    0xD3, 0xA4, 0xFE, 0x60, 0x9E, 0xEA, 0xF3, 0x66, 0x2E, 0x06, 0xF9, 0x83, 0xA9, 0x17, 0xCD, 0x5C,
-    0xA7, 0x62, 0x12, 0x1F, 0xA7, 0xAD, 0xE9, 0x3C, 0xA6, 0xFE, 0x94, 0xC7, 0x16, 0xE4, 0x63, 0x4B,
-    0xFE, 0xF4, 0xB0, 0xD0, 0xD6, 0xE1, 0x28, 0x6D, 0x82, 0x2A, 0xBD, 0x76, 0xCA, 0x9E, 0xEA, 0x8D,
-    0x0B, 0xF8, 0x60, 0x35, 0x13, 0xF3, 0x2D, 0x80, 0xFF, 0xF0, 0xBE, 0xE7, 0x6A, 0xCC, 0xE8, 0x79,
-    0x8D, 0x61, 0x16, 0x3C, 0x42, 0xAE, 0x9E, 0x71, 0xA4, 0x25, 0xCC, 0xEC, 0xF9, 0x91, 0x91, 0xDC,
-    0x83, 0x65, 0xF9, 0x77, 0x00, 0x9F, 0x9F, 0xA4, 0x0E, 0x8D, 0x05, 0x76, 0x39, 0x39, 0x46, 0x13,
-    0x7A, 0x6B, 0xE3, 0xBD, 0xC2, 0x69, 0xD8, 0xE1, 0xE0, 0xC7, 0x49, 0x6A, 0x5C, 0xFC, 0x23, 0x3F,
-    0x28, 0x8F, 0xE4, 0xFC, 0x85, 0xD3, 0x8A, 0x84, 0xD3, 0x2A, 0x38, 0xAF, 0xA5, 0xF7, 0x03, 0x7E,
-    0xCF, 0x5F, 0x31, 0x36, 0x66, 0xD9, 0x12, 0xF9, 0xC3, 0xDE, 0x4A, 0x05, 0xA5, 0xFC, 0xC8, 0x96,
-    0x7A, 0xE0, 0x0B, 0x84, 0x34, 0xDA, 0xB3, 0x66, 0x9D, 0xAA, 0xFC, 0x7A, 0x9D, 0x9E, 0xC2, 0x8D,
-    0xD4, 0x5E, 0x27, 0xA0, 0x88, 0xF6, 0xFC, 0x00, 0x27, 0x4F, 0xCC, 0x7B, 0x45, 0x87, 0xE2, 0x8C,
-    0xF3, 0xE5, 0x0C, 0x75, 0x18, 0x32, 0x8A, 0xDD, 0xF4, 0x0E, 0x59, 0x85, 0x09, 0xE5, 0xBA, 0xCF,
-    0xD9, 0x5B, 0xAF, 0xBC, 0x77, 0xFE, 0xE1, 0x3B, 0xE7, 0xF5, 0x64, 0xBF, 0x08, 0x23, 0xB4, 0xD6,
-    0x21, 0x8C, 0x86, 0xB9, 0x0C, 0xD6, 0x98, 0xA7, 0x96, 0xAF, 0xC1, 0x39, 0x0B, 0x31, 0x1C, 0x78,
-    0xEA, 0x32, 0x39, 0x0E, 0xE5, 0x06, 0xA9, 0xA8, 0x78, 0xBB, 0xE6, 0xBE, 0xB9, 0x41, 0x59, 0x1A,
-    0xC6, 0x95, 0x87, 0x40, 0xC4, 0x42, 0x55, 0xAC, 0x67, 0x50, 0x1E, 0x2B, 0xDE, 0xB5, 0x9C, 0xFB,
-    0xFE, 0x13, 0xC2, 0x9F, 0x23, 0xF8, 0xC3, 0xFE, 0xEC, 0xEF, 0x71, 0xFD, 0x4F, 0x58, 0xAF, 0xC8,
-    0x4E, 0xC7, 0x32, 0xC6, 0xA7, 0x75, 0x65, 0xB4, 0xF6, 0xCB, 0x5D, 0x94, 0x87, 0x48, 0x7A, 0xC4,
-    0x22, 0x0F, 0x09, 0x2C, 0x6B, 0x37, 0xE5, 0x54, 0x43, 0x60, 0x38, 0x02, 0xDC, 0x44, 0x99, 0xCC,
-    0x83, 0x81, 0x39, 0x7B, 0x23, 0xF0, 0x37, 0x01, 0x3E, 0x3B, 0xF7, 0xA2, 0x5C, 0xF2, 0xE2, 0x8F,
-    0xE5, 0xE2, 0x37, 0x10, 0xD4, 0xBB, 0x82, 0xC3, 0x33, 0x03, 0xF5, 0x45, 0x4C, 0x50, 0x78, 0x96,
-    0xE5, 0x41, 0xB1, 0x0E, 0x5E, 0x35, 0x8B, 0x13, 0x01, 0xFA, 0xC3, 0x90, 0xCE, 0x6F, 0x1C, 0x68,
-    0x6D, 0x44, 0xF3, 0xCA, 0x48, 0x4E, 0xDC, 0x1F, 0xE4, 0xA0, 0xCB, 0x86, 0x99, 0xE6, 0x5C, 0x2E,
-    0xCF, 0xCE, 0x36, 0xF0, 0x0F, 0x01, 0x78, 0xAE, 0x70, 0x66, 0x39, 0x4D, 0xCC, 0x27, 0x5D, 0xE0,
-    0xC7, 0x3E, 0xEB, 0x08, 0x18, 0x83, 0xC0, 0x61, 0xFE, 0x2C, 0x19, 0x53, 0x94, 0xDE, 0xD5, 0x8F,
-    0xCF, 0x9C, 0xC3, 0x9E, 0x3F, 0x18, 0x4E, 0x47, 0x20, 0x63, 0x3A, 0x8D, 0x7A, 0x0B, 0x1A, 0xC4,
-    0x7E, 0x76, 0x02, 0x7F, 0xB2, 0xAD, 0x87, 0xCC, 0xE6, 0xD4, 0x5D, 0xF2, 0xFE, 0xC6, 0x34, 0x05,
-    0x15, 0xB2, 0xF4, 0x2A, 0xFD, 0x5E, 0x8C, 0x3C, 0x22, 0x5B, 0x30, 0x73, 0x50, 0x61, 0xA6, 0x5E,
-    0x15, 0xD7, 0xF3, 0xDB, 0x04, 0x15, 0x96, 0x2E, 0x1D, 0x84, 0x80, 0x83, 0x71, 0x50, 0xC7, 0x84,
-    0xE7, 0x1F, 0x1E, 0xAB, 0x34, 0xF6, 0xE9, 0x3B, 0x65, 0x16, 0xDF, 0xD2, 0x9D, 0xCD, 0xCC, 0xF2,
-    0xB8, 0x37, 0xD3, 0x0E, 0x76, 0xFF, 0xB3, 0x60, 0x85, 0x2B, 0x23, 0xCA, 0x62, 0x15, 0xE0, 0xAE,
-    0x70, 0xC7, 0x77, 0xA0, 0xEA, 0x18, 0x13, 0x5A, 0x2A, 0x54, 0x55, 0xD3, 0xC1, 0x06, 0xDE, 0x2F,
-    0xA4, 0xE2, 0xE7, 0x70, 0xA2, 0x24, 0xF0, 0x35, 0x21, 0xBB, 0x78, 0x18, 0xED, 0xD7, 0xCE, 0x82,
-    0x7C, 0xEA, 0xFC, 0x7A, 0xD0, 0xA5, 0x6C, 0xBC, 0x04, 0xA1, 0x6A, 0xD1, 0x14, 0x6F, 0x79, 0x24,
-    0xD2, 0xF9, 0xE6, 0x94, 0x9C, 0x59, 0x34, 0x63, 0x7C, 0xF3, 0x5A, 0x72, 0xA6, 0xEC, 0x05, 0xBA,
-    0xA8, 0x7A, 0x07, 0x46, 0x49, 0x2A, 0x64, 0x04, 0x2B, 0x74, 0x23, 0x51, 0xEE, 0xB2, 0x1C, 0x96,
-    0x82, 0xAA, 0xA8, 0x46, 0xF9, 0xFB, 0x2A, 0xD2, 0x07, 0xD0, 0xA9, 0xB8, 0xC4, 0xD0, 0x58, 0x6B,
-    0x21, 0x71, 0x25, 0xF3, 0x9A, 0x27, 0x42, 0x18, 0xEE, 0x82, 0xD7, 0xEB, 0x87, 0x96, 0x70, 0x0B,
-    0x44, 0x22, 0xB8, 0xC8, 0xA6, 0xA2, 0xE6, 0x81, 0xEA, 0x78, 0x83, 0xC6, 0x28, 0x5D, 0x96, 0x06,
-    0xCF, 0xC8, 0x27, 0xFC, 0x41, 0x59, 0x73, 0xEC, 0x0F, 0x2A, 0xEE, 0x84, 0xDF, 0x19, 0xF4, 0x98,
-    0x3D, 0xA3, 0xEC, 0x73, 0x2E, 0x95, 0xE6, 0xC3, 0x07, 0xA9, 0x39, 0xB6, 0x3E, 0x33, 0x77, 0x0D,
-    0x52, 0x47, 0xB4, 0x6E, 0xD3, 0x0A, 0x36, 0x82, 0x8A, 0x56, 0xBC, 0xC1, 0x65, 0xFD, 0xFB, 0x48,
-    0x28, 0xA4, 0x96, 0x3E, 0x68, 0x59, 0x40, 0x76, 0x6C, 0x80, 0x6A, 0xA1, 0x91, 0x9B, 0xD6, 0x75,
-    0xBE, 0xC3, 0xC2, 0x21, 0x86, 0xAF, 0x3B, 0x6A, 0x52, 0x9A, 0x82, 0xED, 0xB5, 0x7E, 0xDD, 0x7A,
-    0x98, 0xFD, 0x9D, 0x1A, 0x71, 0x0D, 0x4F, 0x6C, 0x5C, 0x65, 0x1D, 0x3D, 0xB2, 0xCD, 0xF3, 0xCF,
-    0x9B, 0x62, 0xE5, 0xFF, 0xB6, 0xF9, 0x6C, 0x98, 0x26, 0x4D, 0x50, 0xD6, 0x66, 0x09, 0x8F, 0x2E,
-    0xCF, 0xA3, 0x84, 0xE6, 0x54, 0xB3, 0x4A, 0xEA, 0x43, 0x0D, 0x71, 0xF8, 0xAD, 0x46, 0x16, 0x28,
-    0xAB, 0xA4, 0x87, 0x38, 0xA5, 0x6F, 0xA2, 0xE6, 0xD6, 0x82, 0x87, 0x98, 0xC5, 0x81, 0x93, 0x3A,
-    0x81, 0x37, 0x55, 0xEE, 0xA3, 0x79, 0x59, 0x49, 0x23, 0xC3, 0x42, 0x3C, 0x62, 0xC3, 0x81, 0x2D,
-    0x51, 0xD5, 0xA4, 0xB7, 0xDA, 0x8F, 0xFE, 0x88, 0x4D, 0xE6, 0xEC, 0x6D, 0xF0, 0xE7, 0x8F, 0xE0,
-    0x3F, 0x34, 0x53, 0x76, 0xDE, 0x7B, 0xFA, 0xFC, 0x8A, 0x4D, 0x9F, 0x5F, 0x7B, 0x7B, 0x9F, 0xDF,
-    0x29, 0x5A, 0x59, 0x5C, 0xAD, 0x38, 0x01, 0x29, 0x82, 0xE3, 0xE5, 0x2E, 0x35, 0xAC, 0xAE, 0x5A,
-    0x30, 0x4E, 0xD3, 0x70, 0x4E, 0xAF, 0xA6, 0x89, 0x4F, 0x66, 0x20, 0xB3, 0xF1, 0xB0, 0x9D, 0x24,
-    0x7E, 0x10, 0x8A, 0x47, 0x4A, 0x4F, 0xC3, 0xBB, 0xF0, 0xF1, 0x7D, 0x5E, 0x74, 0xFF, 0x2B, 0xF2,
-    0x03, 0xBF, 0x69, 0x21, 0x52, 0x53, 0x72, 0x0B, 0x49, 0x89, 0x22, 0xA9, 0x42, 0xAC, 0xA1, 0x0F,
-    0xB6, 0xD5, 0xC5, 0xF7, 0xE4, 0xE7, 0xCF, 0x5B, 0xAD, 0x84, 0xEB, 0x69, 0x20, 0x46, 0xC0, 0x82,
-    0x00, 0xD8, 0xD4, 0xE0, 0xF4, 0x96, 0xEE, 0x62, 0x0F, 0xE6, 0x70, 0x21, 0xB4, 0xEA, 0x11, 0x86,
-    0xE9, 0xA8, 0x6F, 0x9A, 0x54, 0x6C, 0xCB, 0xC7, 0xD5, 0xCD, 0xFE, 0x84, 0x22, 0x1A, 0xBF, 0xEC,
-    0x1B, 0x9A, 0x28, 0xA4, 0x56, 0xBE, 0xB1, 0x7C, 0xDA, 0x1B, 0x2E, 0xAC, 0xC3, 0xC5, 0x74, 0xB8,
-    0x80, 0x8E, 0x44, 0xDD, 0xDF, 0x51, 0x3F, 0x87, 0x02, 0xB9, 0xF8, 0x1F, 0xB8, 0x0A, 0xCB, 0xB1,
-    0x52, 0x7A, 0x42, 0x96, 0x80, 0x4C, 0x7A, 0x8D, 0x9C, 0x72, 0x91, 0x23, 0x6E, 0xC6, 0x8C, 0x06,
-    0x2C, 0xCC, 0x12, 0xEC, 0x56, 0x04, 0x0F, 0xB5, 0x87, 0xDB, 0xB4, 0x01, 0xEC, 0x2B, 0x65, 0xF4,
-    0x32, 0xCC, 0x3A, 0x3B, 0x3E, 0xF8, 0xCA, 0x21, 0x4D, 0x21, 0xF4, 0x4E, 0x9F, 0xA3, 0xAE, 0xFA,
-    0x72, 0x3E, 0xA6, 0x4B, 0x8D, 0x01, 0x9F, 0x4F, 0xBB, 0x50, 0xCF, 0x9C, 0x22, 0x9B, 0x06, 0x7C,
-    0x32, 0x64, 0x34, 0x43, 0xA1, 0x9A, 0x92, 0x01, 0x9F, 0x6D, 0xE8, 0x22, 0x8D, 0xC8, 0x4B, 0xB3,
-    0x6A, 0xB6, 0x6D, 0xAB, 0x50, 0xE6, 0x6F, 0x81, 0x18, 0xD3, 0x62, 0x70, 0x51, 0x04, 0xA9, 0x46,
-    0x36, 0xD1, 0xC1, 0x76, 0x36, 0x9C, 0x9D, 0x2D, 0x25, 0xB9, 0x88, 0x7D, 0x8B, 0x5F, 0xB2, 0x6F,
-    0xE9, 0x12, 0xBC, 0xA5, 0x4B, 0xF0, 0x96, 0x2E, 0xC1, 0x5B, 0x87, 0x73, 0x81, 0x52, 0x57, 0xAF,
-    0x4A, 0x3E, 0xD4, 0xBA, 0xC9, 0x6F, 0x69, 0x79, 0xBA, 0xB7, 0x34, 0x3A, 0xE6, 0x2D, 0x9D, 0xE6,
-    0xB7, 0x36, 0xA6, 0xB9, 0xD4, 0x34, 0xC1, 0x92, 0xF6, 0x1C, 0xE5, 0xEA, 0xDA, 0x25, 0xE8, 0xDF,
-    0xA3, 0x9B, 0x43, 0xA3, 0x57, 0xB2, 0x32, 0x43, 0xC0, 0x7E, 0x23, 0x73, 0xB8, 0xFC, 0x15, 0xF8,
-    0x6E, 0x98, 0x57, 0x0B, 0xFB, 0xCD, 0x18, 0xF3, 0xF3, 0xCD, 0x7D, 0x42, 0xFA, 0x6D, 0x2F, 0xD5,
-    0x2E, 0x1D, 0x05, 0x39, 0x07, 0x9C, 0xBD, 0x3D, 0xCE, 0xDB, 0x37, 0x39, 0x6F, 0xDF, 0x64, 0x6C,
-    0xCB, 0x7F, 0x64, 0x15, 0x90, 0x94, 0x15, 0x8E, 0x4A, 0x06, 0x1C, 0xA3, 0xA6, 0x23, 0x9E, 0xB2,
-    0xB7, 0x52, 0x72, 0x54, 0x6A, 0x74, 0xC4, 0x48, 0x5A, 0xFC, 0x9C, 0xBD, 0x26, 0xA4, 0x28, 0x9F,
-    0x2F, 0xA7, 0x40, 0x53, 0xA5, 0x43, 0x25, 0x43, 0xA5, 0x42, 0x25, 0x42, 0xA5, 0x41, 0x57, 0x5F,
-    0x54, 0x33, 0xBE, 0x4B, 0x1D, 0x27, 0x99, 0x28, 0xC9, 0x4F, 0xA9, 0x4F, 0x89, 0xCF, 0x95, 0x58,
-    0xE0, 0x9C, 0x90, 0xF2, 0xF8, 0x74, 0xCB, 0x9E, 0xD8, 0xF5, 0xE0, 0xE7, 0x68, 0x2D, 0xF8, 0x59,
-    0xDD, 0x37, 0x05, 0xE5, 0x15, 0x11, 0x54, 0xF3, 0xB5, 0xE0, 0x67, 0x8F, 0xF9, 0x4F, 0x01, 0xC3,
-    0xE7, 0x4E, 0x4C, 0x6F, 0xD7, 0xFB, 0x39, 0xB4, 0xF8, 0x0B, 0x2A, 0xE4, 0x28, 0xBD, 0x15, 0x2E,
-    0x53, 0x88, 0xE1, 0xCA, 0xFD, 0x4C, 0x6F, 0x5E, 0xA1, 0xC1, 0x7D, 0x41, 0xA3, 0x35, 0x08, 0xBA,
-    0xE2, 0x2F, 0x58, 0xCA, 0xEF, 0x35, 0x44, 0x74, 0x37, 0xCF, 0x1D, 0xC2, 0x29, 0x5C, 0x3E, 0x72,
-    0x19, 0x16, 0xE6, 0xD4, 0x7C, 0x15, 0x61, 0x1E, 0x9A, 0xB6, 0x72, 0x56, 0xD1, 0xBE, 0x22, 0xE5,
-    0xCC, 0xDF, 0xA9, 0x66, 0x0B, 0xBD, 0xA7, 0xD4, 0xE4, 0xD9, 0x17, 0x2D, 0x8B, 0x9E, 0xBE, 0xA0,
-    0xD2, 0x4C, 0x5E, 0xD0, 0x60, 0x48, 0xAF, 0x80, 0xA7, 0x01, 0xE9, 0x1E, 0xB5, 0x12, 0xE3, 0xBC,
-    0xCF, 0x9E, 0x66, 0x4A, 0x2D, 0xB4, 0xA2, 0x0E, 0xEC, 0xDD, 0x19, 0x2B, 0x23, 0x38, 0x4D, 0x55,
-    0x13, 0x2B, 0x64, 0x31, 0xD3, 0x82, 0x62, 0x5C, 0x79, 0x45, 0x56, 0x37, 0xFC, 0x79, 0x89, 0x7E,
-    0x26, 0x7E, 0x7A, 0xA8, 0x5D, 0x7A, 0x4E, 0xD0, 0x8A, 0x4F, 0xFF, 0x76, 0x4D, 0xF4, 0x72, 0xAE,
-    0x5D, 0xD2, 0xDF, 0xAE, 0xF7, 0xAE, 0x67, 0xDA, 0x6B, 0x8D, 0x95, 0x19, 0x3B, 0x68, 0x5D, 0x07,
-    0xE9, 0xA1, 0x28, 0x63, 0x8A, 0x46, 0x6D, 0xC0, 0x2A, 0x27, 0x9D, 0x27, 0xA7, 0x0B, 0xAA, 0x61,
-    0x21, 0x9E, 0x87, 0x08, 0xD9, 0x8D, 0xF1, 0xA0, 0xA5, 0x53, 0xFB, 0xBB, 0x42, 0xEF, 0xEC, 0x3E,
-    0xDB, 0xEB, 0xF9, 0xDD, 0x6B, 0x58, 0x59, 0xFF, 0x7E, 0xEE, 0x42, 0x84, 0x89, 0x8A, 0x06, 0xB3,
-    0xD9, 0x33, 0x3D, 0xAD, 0x15, 0x8D, 0x2F, 0x73, 0x70, 0xE8, 0x87, 0x1B, 0xE8, 0x5B, 0x0E, 0x09,
-    0x2D, 0x14, 0xDC, 0x3D, 0x02, 0xD5, 0x8F, 0xBB, 0x80, 0x14, 0x05, 0xAA, 0x51, 0x37, 0xE3, 0x31,
-    0x38, 0xC6, 0x38, 0x0E, 0x77, 0xB8, 0x06, 0x10, 0x7A, 0x08, 0x77, 0xE7, 0x74, 0xFF, 0xB9, 0x36,
-    0x34, 0x1D, 0xB0, 0x63, 0x07, 0xB7, 0x40, 0x1D, 0xCD, 0x38, 0x2A, 0xB2, 0x0E, 0x39, 0xB5, 0x4F,
-    0xB7, 0x6E, 0xE8, 0x47, 0xF1, 0x65, 0x87, 0xBF, 0x36, 0xCE, 0xD0, 0x71, 0xAC, 0x13, 0x6F, 0xD6,
-    0xE2, 0xA0, 0x2E, 0x6D, 0xBD, 0xEE, 0xEE, 0xB0, 0x5B, 0x83, 0x71, 0x11, 0x26, 0xCC, 0xF1, 0xDA,
-    0x56, 0x11, 0xE8, 0x35, 0x1C, 0xBC, 0x4E, 0xA7, 0xC5, 0xA1, 0x43, 0x45, 0xCF, 0x29, 0x32, 0x13,
-    0xE2, 0xFE, 0x99, 0xD0, 0xE6, 0xDF, 0xB6, 0x20, 0x9D, 0x64, 0x37, 0xCB, 0x23, 0xD2, 0x12, 0x4E,
-    0x8D, 0x2B, 0x24, 0x6C, 0x5D, 0x68, 0x66, 0x35, 0x66, 0xFD, 0xA2, 0xD5, 0xDD, 0xE3, 0x96, 0x0A,
-    0xA6, 0x63, 0x21, 0x5D, 0xF7, 0xD7, 0xA5, 0x3B, 0x8D, 0xA3, 0x6E, 0x2C, 0x3B, 0x15, 0xD1, 0xD3,
-    0xE0, 0x5A, 0x8E, 0x94, 0xA3, 0xCE, 0xA8, 0x02, 0x8D, 0xD6, 0x72, 0x6A, 0xA9, 0xFA, 0xEF, 0x5A,
-    0x1E, 0x15, 0x05, 0x3A, 0x1B, 0x51, 0xA1, 0x95, 0x35, 0x3C, 0xE7, 0xD6, 0x66, 0x15, 0xFB, 0xB9,
-    0x25, 0xEA, 0xA8, 0x33, 0x83, 0x2E, 0x9B, 0x31, 0xAD, 0x19, 0xAE, 0x80, 0xD5, 0xE8, 0x45, 0xD7,
-    0xD0, 0x55, 0x57, 0x65, 0x6A, 0xB4, 0xC2, 0x98, 0xB5, 0x80, 0xE0, 0x31, 0x3F, 0x78, 0xC4, 0x4B,
-    0x48, 0x55, 0x77, 0x4C, 0xA2, 0x39, 0x8E, 0xAD, 0x9E, 0xF9, 0xA1, 0x06, 0x05, 0xCB, 0xE7, 0x4B,
-    0x97, 0x4C, 0x63, 0x5C, 0x12, 0x8D, 0x06, 0xC8, 0x84, 0x9D, 0x7A, 0xD9, 0x99, 0x01, 0x2E, 0xCB,
-    0x8A, 0xAD, 0x2D, 0xCC, 0xB9, 0x45, 0xED, 0x45, 0xC1, 0x88, 0x78, 0x71, 0xD1, 0x0D, 0x66, 0x13,
-    0x5F, 0xA6, 0xB1, 0x1E, 0x6F, 0x23, 0xE0, 0x70, 0x16, 0x9D, 0x71, 0xD9, 0x0D, 0x5A, 0x00, 0x00,
-    0x76, 0x2C, 0xA3, 0xDA, 0xC3, 0x9A, 0x71, 0xBA, 0x18, 0xE3, 0x1A, 0x59, 0x1E, 0xB2, 0x35, 0x5F,
-    0x9D, 0xE2, 0x12, 0xF0, 0xAD, 0x5D, 0xBA, 0x1B, 0x10, 0x4B, 0xCB, 0x7A, 0x44, 0x5C, 0x34, 0xFB,
-    0x26, 0x1C, 0xBE, 0x60, 0x98, 0x4C, 0xFE, 0x45, 0xD5, 0x13, 0x04, 0x01, 0xA2, 0xD6, 0xD1, 0x72,
-    0x46, 0xF5, 0x88, 0x5A, 0xFD, 0xB0, 0xE5, 0x25, 0x28, 0x28, 0xF4, 0xA4, 0x66, 0xEA, 0xBD, 0xC0,
-    0x24, 0x1C, 0x39, 0x58, 0xC1, 0x64, 0x8A, 0x9F, 0x31, 0x48, 0x80, 0x55, 0x62, 0x8B, 0x3A, 0x62,
-    0x48, 0x29, 0x9C, 0x3F, 0x8F, 0x68, 0x81, 0x5B, 0xB0, 0xE4, 0x2F, 0x9D, 0x71, 0xB1, 0x10, 0x8F,
-    0xCE, 0x8B, 0x4B, 0xF1, 0x1A, 0x7F, 0xD5, 0xB5, 0xD7, 0x95, 0x8D, 0x64, 0xF2, 0x50, 0xD0, 0x27,
-    0x7A, 0xB7, 0x43, 0x74, 0xDF, 0x4F, 0x91, 0x5E, 0x5A, 0xBC, 0x0E, 0x68, 0x5F, 0xC7, 0x1B, 0x37,
-    0xE4, 0x14, 0xCF, 0xD9, 0xCE, 0x93, 0x5A, 0x3E, 0x47, 0x59, 0x95, 0xD7, 0x19, 0x11, 0xF8, 0x0B,
-    0xC8, 0xBC, 0xD1, 0x6F, 0x20, 0x4E, 0x04, 0xAC, 0x3C, 0xF0, 0xAE, 0xAD, 0x1F, 0xA1, 0xAE, 0x25,
-    0x4F, 0x78, 0xD4, 0x95, 0x70, 0xB9, 0x1F, 0x8E, 0x9D, 0x60, 0xC1, 0x3A, 0x96, 0xC5, 0xCD, 0x2F,
-    0xF7, 0x1A, 0x24, 0xB5, 0xE0, 0xAE, 0x0A, 0xAB, 0xD1, 0x4E, 0x47, 0xB7, 0x37, 0xCD, 0xD2, 0x04,
-    0x7F, 0xBE, 0x9A, 0xDF, 0x48, 0x61, 0x3E, 0x80, 0x63, 0xE7, 0x13, 0xD1, 0x9C, 0x1D, 0xB8, 0x62,
-    0x08, 0x3A, 0xD9, 0x73, 0xEB, 0xCC, 0xDD, 0xCF, 0xAB, 0xCD, 0xF8, 0xDF, 0xF4, 0x53, 0xB9, 0x7E,
-    0xEE, 0x86, 0x92, 0x55, 0x0E, 0xAB, 0x42, 0x44, 0xDA, 0x67, 0xAB, 0x43, 0xC4, 0x76, 0x11, 0xFA,
-    0xD5, 0x65, 0xC2, 0xAF, 0xE1, 0xC5, 0x43, 0x17, 0xA7, 0x0A, 0x00, 0xF7, 0x16, 0x3A, 0xD6, 0x96,
-    0xCF, 0xB6, 0xB0, 0x6C, 0xCD, 0x76, 0xA9, 0x76, 0xEA, 0xE5, 0x1A, 0xF4, 0x47, 0x38, 0x19, 0xA5,
-    0x9A, 0x44, 0x96, 0xAF, 0xB9, 0xE0, 0x5B, 0x4F, 0x0B, 0x56, 0xEC, 0xDF, 0x55, 0xAD, 0x0A, 0x5F,
-    0x6B, 0x55, 0xA4, 0x6E, 0x73, 0x69, 0xB2, 0x08, 0x75, 0x64, 0x7D, 0x27, 0xC8, 0x0C, 0x0E, 0xD7,
-    0x00, 0x4F, 0x02, 0x7D, 0xF1, 0x4E, 0x37, 0x96, 0x2F, 0xCD, 0x4D, 0xCC, 0xF2, 0xA5, 0x5A, 0x5F,
-    0xF9, 0x2C, 0x53, 0xC5, 0x0F, 0xB9, 0x2A, 0xAC, 0xB8, 0xCB, 0xF7, 0x56, 0xF4, 0x3E, 0xF3, 0x50,
-    0x03, 0xEA, 0x92, 0x5F, 0xA4, 0x19, 0xE3, 0x12, 0xA7, 0xA1, 0x9F, 0xCB, 0x6C, 0xAA, 0xDB, 0xFE,
-    0xCE, 0x30, 0x6B, 0x35, 0xC6, 0x43, 0x03, 0xB8, 0x1B, 0xC3, 0xF3, 0xD5, 0x41, 0x44, 0x3A, 0xCD,
-    0x59, 0x59, 0xD0, 0x34, 0x70, 0xC0, 0xD0, 0xC5, 0xA7, 0xF1, 0x4E, 0xCC, 0xCD, 0xAA, 0xE6, 0xDC,
-    0xAC, 0xA4, 0x61, 0x6E, 0x16, 0xE3, 0x9D, 0xC2, 0xB5, 0x78, 0xA7, 0xE5, 0x5A, 0xBC, 0xD3, 0x62,
-    0x23, 0xDE, 0x69, 0x3B, 0xF4, 0x1C, 0xB3, 0x52, 0x73, 0xF2, 0x30, 0xC2, 0x0F, 0x73, 0xAE, 0xE8,
-    0x7E, 0xD6, 0x3A, 0x02, 0xDF, 0x28, 0x6E, 0x7D, 0xEF, 0x41, 0x9A, 0xAB, 0x85, 0xE6, 0x41, 0xB2,
-    0x04, 0xF1, 0x01, 0xF5, 0x82, 0x13, 0xCC, 0xD5, 0x89, 0x0A, 0xB6, 0xF6, 0x5B, 0x0B, 0xB6, 0xFE,
-    0xFD, 0x07, 0x2B, 0xD8, 0x9A, 0x1C, 0x2B, 0xD8, 0xBA, 0xD8, 0x52, 0xB0, 0x35, 0xD5, 0x82, 0xAD,
-    0x7A, 0xC2, 0x66, 0x77, 0x50, 0xBE, 0x83, 0x0D, 0xB4, 0x44, 0xA5, 0x11, 0x6A, 0xF0, 0x7D, 0xB6,
-    0x5E, 0x6F, 0xA4, 0x64, 0xBD, 0x91, 0x74, 0xAC, 0x37, 0xB2, 0x74, 0x2F, 0x0D, 0x38, 0x5A, 0x6F,
-    0x64, 0xC1, 0x4D, 0x19, 0xB0, 0xDE, 0x48, 0x44, 0x9B, 0x3F, 0x0D, 0xB4, 0x86, 0xE1, 0x07, 0x3E,
-    0xEB, 0x8D, 0x64, 0xA2, 0x04, 0x08, 0x07, 0x63, 0xBD, 0x11, 0x8E, 0xFC, 0x44, 0xDA, 0x37, 0xB8,
-    0x5F, 0x17, 0xCB, 0xC4, 0x17, 0xCE, 0x1A, 0x6C, 0x8A, 0x73, 0xF6, 0xBF, 0x75, 0xD0, 0xE0, 0x51,
-    0x72, 0xFC, 0x10, 0xAB, 0x84, 0xC6, 0x3E, 0x1A, 0x97, 0xC7, 0xC6, 0xD7, 0xA4, 0xF1, 0x59, 0x4F,
-    0xED, 0x41, 0xA9, 0x79, 0x00, 0x1A, 0x2E, 0x29, 0x60, 0xAD, 0xE1, 0x4A, 0x88, 0x4F, 0x0E, 0xA9,
-    0x63, 0xC1, 0x66, 0xD1, 0xB1, 0x46, 0x38, 0x37, 0xC0, 0x55, 0x03, 0xAA, 0xBE, 0x0E, 0x87, 0x1D,
-    0x4B, 0xCE, 0x5D, 0x40, 0x40, 0x9C, 0x3C, 0x70, 0x3F, 0xEC, 0xC2, 0x75, 0x6C, 0x5C, 0x5E, 0xC1,
-    0x07, 0xC6, 0x14, 0x28, 0xEB, 0x31, 0x0D, 0x40, 0xB3, 0xAF, 0x27, 0x79, 0x6E, 0xC4, 0xCE, 0xE6,
-    0xC3, 0x2D, 0xB1, 0x46, 0x7F, 0x93, 0xA1, 0x67, 0xC6, 0x19, 0x42, 0xFF, 0x51, 0x83, 0xA5, 0xD7,
-    0xEA, 0xBB, 0x95, 0xE1, 0x49, 0xCC, 0x88, 0x3F, 0x90, 0xD1, 0x7B, 0xA2, 0x52, 0x2B, 0xAB, 0x96,
-    0xA3, 0xCC, 0x4B, 0xB4, 0xF2, 0x5C, 0x09, 0x12, 0xA0, 0xC8, 0xC9, 0x36, 0x07, 0xDF, 0xCD, 0x5C,
-    0x69, 0xDD, 0xF7, 0x46, 0xC5, 0xD1, 0xEA, 0xBB, 0x6B, 0xA9, 0xC0, 0x93, 0x17, 0x7B, 0x5B, 0x3D,
-    0x61, 0x87, 0x16, 0xE5, 0x5A, 0xDD, 0xB4, 0x26, 0x40, 0x2D, 0x8A, 0xF9, 0x1D, 0x31, 0xC1, 0x76,
-    0x98, 0xC6, 0x60, 0x27, 0xEF, 0x6A, 0xE8, 0xC8, 0x8F, 0x11, 0x4E, 0xDD, 0x6E, 0xD4, 0x4A, 0x59,
-    0x83, 0xA1, 0x06, 0xA6, 0x58, 0x46, 0xFD, 0xA9, 0xC0, 0x19, 0xB4, 0xF3, 0xDB, 0xA3, 0xD4, 0x97,
-    0x6E, 0xB6, 0xC0, 0xF7, 0x53, 0xEC, 0x38, 0x25, 0x7A, 0xA1, 0x9E, 0x91, 0x67, 0x5F, 0x57, 0xF4,
-    0x13, 0xE6, 0x09, 0xD9, 0x9B, 0xBF, 0xDE, 0x52, 0xEC, 0xF8, 0xCB, 0x2A, 0x40, 0x7B, 0xF5, 0xED,
-    0x91, 0x49, 0x6F, 0x57, 0xEC, 0xF8, 0x64, 0xF5, 0x7F, 0xA2, 0x35, 0xF8, 0x2C, 0xD3, 0xD5, 0xED,
-    0x5A, 0xFD, 0x1F, 0xCB, 0xFA, 0x3F, 0x51, 0x3C, 0xC3, 0x7F, 0xB5, 0xB5, 0xFE, 0x8F, 0x63, 0x96,
-    0x0E, 0xB9, 0x22, 0xAF, 0xC7, 0x5E, 0x15, 0xB9, 0x15, 0x8D, 0xEF, 0x8F, 0x1C, 0x75, 0x5D, 0x6C,
-    0xF4, 0xE1, 0x2B, 0xFA, 0xEE, 0x21, 0xBE, 0x11, 0x6D, 0xED, 0x55, 0x91, 0xFA, 0x02, 0xA3, 0xF8,
-    0x84, 0xA8, 0x76, 0xF6, 0xBD, 0xA7, 0xB5, 0x24, 0xFC, 0x17, 0x05, 0xDD, 0xD9, 0xBA, 0x75, 0x04,
-    0x6E, 0x24, 0xF5, 0x37, 0x73, 0x52, 0x7F, 0xF2, 0xC1, 0x92, 0xFA, 0xC7, 0x24, 0xEB, 0x32, 0x9C,
-    0xAD, 0x5B, 0x2E, 0xB5, 0x7F, 0x2E, 0x99, 0xA1, 0xB3, 0xAB, 0xC5, 0x3D, 0xA8, 0x1B, 0x66, 0xF5,
-    0x18, 0xBB, 0xC4, 0xB4, 0x39, 0xEC, 0xDC, 0x87, 0x18, 0x0B, 0xD0, 0x24, 0x7C, 0x87, 0xC1, 0xEA,
-    0x4A, 0x40, 0x54, 0x10, 0xB5, 0xD9, 0xCB, 0x44, 0xB1, 0xE6, 0xD3, 0x2D, 0x0A, 0xF5, 0xBF, 0xB8,
-    0x74, 0x54, 0x97, 0x8C, 0xEA, 0x90, 0x53, 0x3D, 0x9D, 0x56, 0xBA, 0x70, 0xFB, 0x14, 0x0B, 0xF0,
-    0x55, 0x4A, 0x15, 0x38, 0x7F, 0x91, 0x87, 0x5A, 0x69, 0x52, 0x66, 0xEE, 0x0C, 0xA4, 0x73, 0x06,
-    0xEA, 0x27, 0xF5, 0x66, 0xFA, 0x2E, 0x4B, 0xAA, 0xD2, 0xB9, 0xCD, 0x1F, 0x47, 0x25, 0xB0, 0xF2,
-    0x79, 0x51, 0x59, 0xB3, 0xFA, 0x4A, 0x80, 0xEA, 0x39, 0x05, 0xF5, 0xC4, 0xE4, 0xBA, 0x3D, 0x28,
-    0x1A, 0x97, 0x55, 0xF6, 0xEC, 0xB0, 0xBB, 0x7B, 0xDE, 0x69, 0x43, 0x61, 0x6F, 0xA6, 0x30, 0x0F,
-    0x74, 0x09, 0xC5, 0x29, 0x72, 0x04, 0xDF, 0xD8, 0xAB, 0x51, 0xE9, 0x1C, 0x85, 0xF2, 0x94, 0x9B,
-    0x1B, 0x9A, 0x95, 0xCE, 0x56, 0x6E, 0xA6, 0x3D, 0x1C, 0xB5, 0x81, 0xCE, 0x16, 0xCF, 0x4F, 0x4D,
-    0xED, 0x85, 0x1B, 0xAE, 0xA8, 0x39, 0x5B, 0xD9, 0x49, 0x66, 0xEB, 0xF4, 0xFB, 0x9B, 0xAD, 0xCF,
-    0x4C, 0xB3, 0x15, 0xD9, 0x97, 0x2E, 0xB9, 0xD9, 0x4A, 0x67, 0x0D, 0xDD, 0x45, 0x34, 0x8F, 0x21,
-    0xF1, 0xDD, 0x06, 0xBA, 0xBC, 0x05, 0x7D, 0x98, 0xF3, 0x0A, 0x52, 0xBA, 0xFA, 0x6C, 0x39, 0x6E,
-    0xD9, 0xC0, 0xF6, 0xF3, 0xBE, 0xCD, 0xD6, 0x2A, 0x13, 0xC4, 0x6B, 0xA7, 0xE7, 0x04, 0x5D, 0xBD,
-    0xDF, 0x74, 0xE1, 0x5E, 0xEF, 0x7A, 0x2F, 0x7E, 0x3C, 0x0D, 0x92, 0x48, 0x1D, 0x0B, 0x79, 0xC4,
-    0x05, 0x4B, 0x79, 0xAD, 0x63, 0xC4, 0x7E, 0x37, 0xBE, 0xBC, 0xB0, 0x1F, 0x5D, 0x7B, 0x53, 0x2D,
-    0xC6, 0xC7, 0x6E, 0xA5, 0x5B, 0x63, 0x89, 0x7E, 0x7F, 0x5F, 0x02, 0xE5, 0xB9, 0x42, 0xC3, 0x89,
-    0x5B, 0xA6, 0x2C, 0x4D, 0x72, 0x55, 0x2A, 0xF5, 0x8D, 0xC9, 0xB1, 0x4B, 0xCD, 0xF0, 0x8A, 0x6D,
-    0x91, 0x79, 0x0F, 0x5A, 0xC5, 0xD9, 0xDB, 0xF9, 0x40, 0x9C, 0x3B, 0x4E, 0xBD, 0x71, 0xDB, 0x7C,
-    0x20, 0x74, 0x1B, 0xBD, 0x41, 0xEF, 0x8F, 0xBE, 0xB5, 0x44, 0xDF, 0x59, 0x57, 0xEE, 0xF5, 0x9A,
-    0x6A, 0x9F, 0xBA, 0xAC, 0x7A, 0xCB, 0xA8, 0x62, 0x15, 0x70, 0x34, 0x8C, 0x6A, 0x82, 0xB1, 0x73,
-    0xEC, 0xE3, 0xE9, 0x0A, 0x9D, 0x33, 0x7F, 0x75, 0xB7, 0x2E, 0xFD, 0x23, 0xFE, 0xB7, 0x25, 0xDC,
-    0x04, 0x65, 0xF4, 0x32, 0x1C, 0xF7, 0x3B, 0x4B, 0xB3, 0xD5, 0x1F, 0x52, 0xCD, 0xF5, 0xE2, 0xAF,
-    0x59, 0xAD, 0x94, 0xC6, 0xF3, 0x81, 0x69, 0x6E, 0xA9, 0xD6, 0x95, 0xD3, 0xFF, 0x69, 0xBD, 0xC1,
-    0x58, 0x78, 0x7F, 0x07, 0xA7, 0xBA, 0x5C, 0x38, 0xB2, 0x02, 0x66, 0xAC, 0x24, 0xB4, 0xB1, 0x26,
-    0x25, 0x5F, 0x76, 0x43, 0x33, 0x4A, 0xC8, 0x1E, 0x7A, 0xA4, 0x9A, 0x07, 0xFC, 0x55, 0x4C, 0xB9,
-    0xBE, 0x8A, 0x29, 0x3D, 0xB5, 0x26, 0xA8, 0xC7, 0x2E, 0xA4, 0x52, 0xD1, 0x85, 0x75, 0xA6, 0xE9,
-    0x39, 0x86, 0xD0, 0x9A, 0xFB, 0x52, 0xEE, 0x36, 0x65, 0xB9, 0xDB, 0xF4, 0xA1, 0x89, 0x13, 0x26,
-    0x6B, 0x3D, 0x7B, 0x6D, 0xEE, 0x97, 0x76, 0x4B, 0x7A, 0xF5, 0x80, 0x7A, 0x60, 0xC2, 0x5E, 0x9D,
-    0x9E, 0xDD, 0x88, 0xD6, 0x4B, 0x68, 0x0A, 0x3A, 0x9D, 0xD2, 0xDE, 0x1C, 0xF2, 0x65, 0x1C, 0x26,
-    0xAA, 0x74, 0x0A, 0x59, 0xE0, 0xC7, 0x95, 0x19, 0x1C, 0x1D, 0x54, 0x1A, 0x16, 0x99, 0xD1, 0x6B,
-    0xA0, 0xFF, 0x2F, 0x29, 0x6A, 0x4E, 0xB4, 0x7B, 0x0C, 0xE6, 0xF4, 0xD3, 0x60, 0x99, 0x46, 0x78,
-    0xBB, 0x2B, 0x5D, 0x15, 0x59, 0x9F, 0xC5, 0x8B, 0x7C, 0xE7, 0x33, 0x9D, 0x8B, 0xC4, 0xBA, 0xBA,
-    0x25, 0x28, 0x31, 0x80, 0xE0, 0x41, 0xE9, 0x2D, 0xB3, 0x7E, 0x1B, 0xA4, 0xC9, 0x06, 0xEE, 0x7D,
-    0xC4, 0x3C, 0x48, 0x4E, 0xA5, 0xC6, 0x3C, 0xE8, 0xAE, 0xB0, 0xD6, 0xA1, 0x75, 0xE7, 0x97, 0xB7,
-    0xED, 0x55, 0xA4, 0xC1, 0x46, 0xFC, 0x66, 0x5C, 0xDE, 0x97, 0xB2, 0xC7, 0x6B, 0x11, 0x98, 0x8B,
-    0xB5, 0x08, 0xCC, 0x60, 0x2D, 0x02, 0x53, 0x23, 0x49, 0x13, 0x17, 0x81, 0x79, 0x7F, 0xF4, 0x51,
-    0xFA, 0x67, 0x0F, 0x2E, 0xDE, 0xAD, 0x3E, 0x1A, 0xA9, 0x82, 0x14, 0x3B, 0x54, 0xAF, 0x87, 0xC0,
-    0xC6, 0x66, 0x0B, 0x7A, 0x7C, 0x46, 0xF7, 0x42, 0x1F, 0xBD, 0xB9, 0x45, 0x13, 0xDD, 0xD0, 0x47,
-    0x9B, 0xB1, 0x76, 0xAD, 0xDF, 0xCF, 0x7E, 0x47, 0x7F, 0x6D, 0xE2, 0x37, 0x20, 0x63, 0xF5, 0x98,
-    0xA7, 0xD3, 0xD2, 0x27, 0x21, 0x60, 0xA1, 0xA1, 0x72, 0x29, 0xD3, 0x58, 0x10, 0x92, 0x80, 0x02,
-    0x15, 0x28, 0x31, 0xF0, 0xAE, 0x1C, 0x23, 0xBF, 0x13, 0x7C, 0x53, 0xE4, 0xBF, 0x5F, 0x09, 0x6E,
-    0x65, 0x71, 0xFE, 0x8E, 0xB8, 0x5A, 0xFE, 0x08, 0x38, 0xAB, 0x03, 0x14, 0x3F, 0x69, 0x93, 0x26,
-    0x7C, 0x0A, 0x38, 0x5E, 0x45, 0xD8, 0x61, 0x6D, 0xD4, 0x3D, 0x4E, 0x1C, 0x76, 0x67, 0x89, 0x83,
-    0x7E, 0x9F, 0x78, 0x69, 0x2F, 0x13, 0x8B, 0x6C, 0x42, 0x8C, 0x70, 0x09, 0x60, 0x21, 0x6E, 0x62,
-    0x04, 0x94, 0x12, 0x17, 0x90, 0x69, 0x50, 0x37, 0x37, 0x0F, 0x61, 0x6E, 0x29, 0xDD, 0x1B, 0xEB,
-    0xCA, 0xD8, 0x85, 0x93, 0xAE, 0xD7, 0x42, 0x1D, 0xA3, 0xB4, 0xDA, 0x8D, 0xAC, 0xBF, 0x29, 0xA7,
-    0x72, 0xE9, 0x70, 0x58, 0xBB, 0x8A, 0xE3, 0xC6, 0x95, 0x1C, 0x37, 0xAE, 0xE6, 0xB8, 0x71, 0x45,
-    0xC7, 0x8D, 0xAB, 0x3A, 0x6E, 0x5C, 0xD9, 0x71, 0xE3, 0xEA, 0x8E, 0x1B, 0x57, 0x78, 0xDC, 0xB8,
-    0xCA, 0xE3, 0xC6, 0x95, 0x1E, 0x37, 0xAE, 0xF6, 0xB8, 0x71, 0xC5, 0xC7, 0x8D, 0xAB, 0x3E, 0x6E,
-    0x5C, 0xF9, 0x71, 0xE3, 0xEA, 0x8F, 0x1B, 0x57, 0x80, 0xDC, 0x68, 0x05, 0x72, 0x70, 0x26, 0x96,
-    0x20, 0x37, 0x1B, 0x07, 0xD5, 0x54, 0x1A, 0xF3, 0x70, 0x33, 0x0A, 0x6D, 0xCC, 0x12, 0xF5, 0x57,
-    0xD3, 0x70, 0x3E, 0x7C, 0x69, 0xFA, 0x11, 0xBE, 0xF5, 0xCB, 0xD7, 0xF4, 0xE5, 0xA5, 0xC6, 0xB9,
-    0xFB, 0x5D, 0xB0, 0x5A, 0xE3, 0xE4, 0x67, 0x6E, 0x6D, 0xCB, 0xC8, 0xE8, 0xCC, 0x4C, 0x9F, 0xB3,
-    0x79, 0x55, 0xC7, 0xA9, 0xDA, 0xCC, 0xA1, 0x2A, 0x40, 0xAD, 0xDA, 0xCD, 0x57, 0xEA, 0xD7, 0x53,
-    0xAB, 0x85, 0x5F, 0x53, 0x86, 0x5A, 0x96, 0x4C, 0x39, 0x0A, 0x4A, 0xAD, 0x57, 0x99, 0xF3, 0x6E,
-    0x91, 0x2A, 0x24, 0xEE, 0x5D, 0xC7, 0x89, 0x2A, 0x4A, 0xAF, 0xA9, 0x3A, 0xA5, 0x46, 0x32, 0x6F,
-    0xA5, 0x36, 0x32, 0x75, 0xFC, 0xF8, 0xEA, 0xF7, 0x81, 0xBC, 0xCE, 0x37, 0xF9, 0xE6, 0xFA, 0x26,
-    0xC1, 0x92, 0xE6, 0x0E, 0xE8, 0x0A, 0x8B, 0x95, 0x10, 0x8A, 0x8F, 0x97, 0x7B, 0xFA, 0x7D, 0x80,
-    0x88, 0x41, 0x4C, 0xE6, 0xAC, 0x17, 0xE0, 0xA0, 0x62, 0xCA, 0xE8, 0x92, 0x8A, 0x1D, 0xBC, 0x5F,
-    0x21, 0xEA, 0xDA, 0x2C, 0x49, 0xB0, 0x8F, 0x2C, 0xC7, 0x72, 0xDE, 0x9F, 0xFA, 0xBE, 0x9E, 0x4C,
-    0xC2, 0x9B, 0x9F, 0xB2, 0xEE, 0xCD, 0x30, 0x94, 0xD0, 0x6B, 0x02, 0x06, 0xE7, 0x81, 0x84, 0x57,
-    0x19, 0x62, 0xB4, 0x7E, 0x03, 0x85, 0xE2, 0x05, 0x79, 0xD2, 0x27, 0xD7, 0x53, 0x42, 0x5A, 0x72,
-    0x46, 0xD6, 0x27, 0x9D, 0xD0, 0xA2, 0x0B, 0xEB, 0xDB, 0x27, 0xBE, 0x7C, 0x3C, 0xA6, 0x59, 0xC9,
-    0x58, 0x08, 0x76, 0x31, 0x08, 0xE9, 0x2C, 0x06, 0x94, 0x1D, 0xEC, 0x96, 0xCD, 0xD1, 0xD4, 0xA1,
-    0x0F, 0x7D, 0x9A, 0x97, 0xA3, 0xC6, 0xB5, 0x9C, 0x4A, 0x2B, 0x5F, 0xB1, 0xF9, 0x69, 0x36, 0x7E,
-    0x2B, 0xD3, 0x45, 0xA7, 0xD6, 0xBF, 0x48, 0x83, 0x9A, 0xCB, 0x4F, 0x5D, 0x23, 0x78, 0x43, 0x1A,
-    0xB8, 0x41, 0xF8, 0x05, 0xE7, 0x55, 0xD6, 0xE2, 0x4E, 0x88, 0x9D, 0x1C, 0x1B, 0xC2, 0x3A, 0xDF,
-    0xDE, 0xE5, 0x04, 0xBB, 0xE4, 0x46, 0xD4, 0xCB, 0xBA, 0x76, 0x80, 0x64, 0xFC, 0xD2, 0x5D, 0x13,
-    0x5E, 0xFB, 0xFE, 0x58, 0xD6, 0xCA, 0xA5, 0x3F, 0xEE, 0xE8, 0x1B, 0xBA, 0xB1, 0xD3, 0xDD, 0x35,
-    0x6A, 0x0D, 0x8C, 0x30, 0xA9, 0x68, 0xC4, 0x4C, 0x4D, 0x81, 0xDE, 0x80, 0x77, 0x75, 0x23, 0x66,
-    0xA8, 0x30, 0x74, 0x31, 0xE8, 0xAB, 0x48, 0x5C, 0x03, 0x73, 0x77, 0x8A, 0xB3, 0xF7, 0x02, 0xF9,
-    0x18, 0x2D, 0xC2, 0x21, 0xAC, 0x43, 0x45, 0x15, 0xB2, 0xDC, 0x52, 0x23, 0xB3, 0x88, 0xF0, 0x5F,
-    0xCE, 0x23, 0x16, 0x5B, 0x91, 0xCC, 0xE5, 0x41, 0xD1, 0xB9, 0x82, 0x49, 0x98, 0xCF, 0xDD, 0xDD,
-    0x2F, 0x71, 0x46, 0x8D, 0xCE, 0xA9, 0xE1, 0xAC, 0x42, 0x39, 0xAB, 0x91, 0xAB, 0xF2, 0x55, 0xCC,
-    0x6C, 0x65, 0x1A, 0x99, 0xDB, 0xE2, 0xE6, 0x19, 0x61, 0x5C, 0x3D, 0x4E, 0xC4, 0x25, 0x8A, 0x28,
-    0x0F, 0x34, 0x39, 0x40, 0x60, 0xBA, 0xCB, 0x62, 0x89, 0x9B, 0x2F, 0x7F, 0xAE, 0x3C, 0x15, 0xAE,
-    0x76, 0x8E, 0xC1, 0xED, 0x2F, 0x7F, 0x7E, 0x07, 0x09, 0x1B, 0xCE, 0xF0, 0x77, 0xED, 0x44, 0x2F,
-    0x7F, 0x0E, 0xF2, 0xF5, 0x57, 0x40, 0xF3, 0x7D, 0x71, 0x39, 0xE3, 0x46, 0x1C, 0x3C, 0x09, 0x47,
-    0x60, 0x36, 0xEB, 0x1E, 0x8D, 0x7B, 0x22, 0xE3, 0x07, 0xBD, 0x6C, 0x42, 0x66, 0x55, 0xC6, 0x0D,
-    0x0B, 0x9F, 0xB1, 0x7C, 0xB4, 0x28, 0x57, 0x19, 0x4A, 0x05, 0x6B, 0x05, 0xE9, 0x1B, 0xBB, 0xBB,
-    0xE9, 0x58, 0x20, 0xD8, 0x01, 0x59, 0x8C, 0x53, 0x1A, 0x68, 0x1D, 0xD8, 0x17, 0xAE, 0xB8, 0x28,
-    0xCA, 0xBD, 0xB1, 0x82, 0xC7, 0x54, 0x1B, 0x61, 0x35, 0x66, 0xCB, 0x86, 0xC3, 0xF7, 0xA5, 0x17,
-    0x21, 0x33, 0x86, 0x3E, 0xE1, 0xFC, 0xE8, 0x4E, 0x94, 0xF5, 0x9D, 0x22, 0x37, 0x7B, 0xCD, 0x46,
-    0x2F, 0x64, 0xB5, 0xF6, 0x52, 0xCB, 0x8A, 0x11, 0xC3, 0x95, 0x8B, 0x1B, 0x56, 0x48, 0xD9, 0x2A,
-    0x1E, 0xDF, 0x33, 0xA6, 0x12, 0xC9, 0x72, 0x60, 0x9E, 0xBA, 0xBE, 0x52, 0xAC, 0x19, 0xE3, 0xF6,
-    0xD6, 0xAD, 0x67, 0x1E, 0x3D, 0x8D, 0x03, 0x6A, 0x60, 0x20, 0x52, 0xE5, 0x7F, 0x88, 0xBA, 0x73,
-    0x16, 0xDF, 0xFC, 0x24, 0x85, 0xEA, 0xD1, 0x69, 0xAC, 0x61, 0xE8, 0x8F, 0x0A, 0x89, 0x93, 0x4C,
-    0x53, 0x54, 0x4E, 0x4E, 0xF1, 0x56, 0xE8, 0x94, 0xAF, 0xB5, 0x4A, 0x6A, 0x1F, 0x31, 0x1F, 0xCB,
-    0x5E, 0xE6, 0x2E, 0x42, 0x1A, 0x12, 0xDF, 0xC0, 0xC0, 0x64, 0xA1, 0x39, 0x61, 0x2A, 0x49, 0xB1,
-    0x23, 0xB3, 0x37, 0x86, 0x09, 0xEA, 0x27, 0xC7, 0xFF, 0x3D, 0x98, 0x33, 0xA5, 0xC7, 0xB5, 0x08,
-    0xBA, 0xCB, 0x4E, 0xC4, 0x45, 0x02, 0xFE, 0xBA, 0xCE, 0xF7, 0xEE, 0xDB, 0x64, 0xAA, 0xB2, 0x39,
-    0x4A, 0x0F, 0xD6, 0x99, 0xC2, 0xBC, 0xB1, 0x61, 0x06, 0x7F, 0x75, 0xE7, 0xFC, 0xBA, 0xDF, 0xEB,
-    0x17, 0xA3, 0xBB, 0xB4, 0x36, 0xCD, 0x47, 0x4C, 0x2A, 0x3B, 0xE2, 0x54, 0x3F, 0xBF, 0x53, 0x7E,
-    0xE2, 0x83, 0xF8, 0x16, 0x26, 0x5D, 0x69, 0x59, 0xDC, 0xD6, 0xAD, 0xF0, 0x96, 0xD5, 0xFD, 0x48,
-    0xDF, 0x05, 0x4F, 0xE9, 0xA5, 0x8E, 0xD3, 0xB0, 0x49, 0xCA, 0xB0, 0xC9, 0xCA, 0xA0, 0x4E, 0xF2,
-    0xCD, 0x72, 0x10, 0xF7, 0xEE, 0x35, 0x52, 0x30, 0x6D, 0x97, 0x6B, 0xE0, 0xD6, 0x81, 0x85, 0x0F,
-    0x54, 0xD8, 0x36, 0xCE, 0xD7, 0x50, 0x35, 0xD1, 0x64, 0x14, 0xB9, 0xA9, 0xA9, 0x06, 0xE0, 0xF6,
-    0x21, 0x56, 0xE5, 0xD4, 0x9E, 0xBE, 0x7C, 0xB0, 0x9A, 0x8B, 0xBC, 0xCF, 0x39, 0x0C, 0x05, 0x7E,
-    0xA5, 0x2B, 0xA5, 0x18, 0x73, 0x18, 0xF2, 0x68, 0xCE, 0x61, 0x80, 0x6D, 0x8F, 0xE5, 0xF4, 0xF0,
-    0xDC, 0x5C, 0xC1, 0xE6, 0xC3, 0x1F, 0x5E, 0x7B, 0xF8, 0x6B, 0xA3, 0xCE, 0xC2, 0xCA, 0xF4, 0x74,
-    0xEB, 0x3C, 0xEC, 0x2A, 0xB3, 0x8E, 0xBC, 0xCB, 0x9B, 0x6A, 0x3F, 0x8E, 0xE9, 0x53, 0x9E, 0xAB,
-    0xCC, 0x03, 0xCD, 0x08, 0x21, 0xBD, 0x25, 0xD9, 0x01, 0xA4, 0x27, 0x16, 0xDF, 0x2D, 0x5C, 0xB8,
-    0xBB, 0x4B, 0x5E, 0xAA, 0xD7, 0x7E, 0x3B, 0x52, 0xDF, 0xE8, 0x63, 0xF1, 0xE6, 0x7A, 0xB0, 0x36,
-    0xDD, 0x30, 0x2A, 0xC4, 0x7D, 0xB4, 0x59, 0xA5, 0x6A, 0xB2, 0x5B, 0x32, 0x05, 0xB8, 0x57, 0x99,
-    0xBD, 0x67, 0x45, 0x6D, 0xAF, 0x0B, 0x9A, 0xDB, 0x30, 0x8B, 0x8F, 0xCD, 0x4C, 0xBB, 0x2D, 0x5A,
-    0x21, 0x98, 0x00, 0x1B, 0x74, 0x82, 0x75, 0x92, 0x6E, 0x65, 0x82, 0xF7, 0x7D, 0xEE, 0xFD, 0x06,
-    0xC6, 0xA3, 0xA0, 0x45, 0x24, 0x4B, 0xD0, 0xA2, 0x86, 0x90, 0x7E, 0xB2, 0x25, 0x61, 0xFF, 0xFD,
-    0x55, 0x82, 0x23, 0x04, 0xC3, 0xEB, 0xB7, 0xC0, 0xB5, 0x6B, 0xB6, 0x54, 0x82, 0x1B, 0xD4, 0x91,
-    0x78, 0xE7, 0x4A, 0x70, 0xCC, 0xCA, 0xF2, 0x61, 0xAF, 0xA2, 0x94, 0x89, 0x18, 0x82, 0xFE, 0x08,
-    0x9B, 0x56, 0x51, 0xB3, 0x52, 0xF9, 0x90, 0x65, 0x93, 0x50, 0xB3, 0x29, 0x67, 0x51, 0x25, 0xD6,
-    0x58, 0xD2, 0x22, 0x4D, 0x8D, 0xBE, 0x1B, 0x6C, 0x04, 0x5A, 0xAE, 0x49, 0x4B, 0xC9, 0x15, 0x15,
-    0x2F, 0x66, 0xF1, 0x25, 0xDE, 0x40, 0x45, 0xCD, 0xF8, 0x88, 0xA8, 0xF9, 0x41, 0xA6, 0xE8, 0xE6,
-    0xEE, 0xEE, 0x5E, 0x4F, 0xD1, 0xA9, 0x4F, 0x86, 0x83, 0x83, 0x4B, 0xF7, 0x70, 0x8A, 0x4E, 0x38,
-    0xFE, 0x1B, 0xBB, 0x45, 0x43, 0xFB, 0x9E, 0x82, 0xF7, 0x31, 0xFE, 0xFB, 0x43, 0x4C, 0x1F, 0xE2,
-    0x4C, 0xDD, 0x3B, 0x62, 0xFA, 0xC0, 0x93, 0xF9, 0x1E, 0xDD, 0x30, 0x0F, 0xC0, 0x2B, 0x74, 0xC3,
-    0x2A, 0x31, 0x51, 0x5D, 0xE4, 0x51, 0x53, 0xE4, 0x61, 0x95, 0x1D, 0xA9, 0x44, 0x75, 0x0F, 0xDF,
-    0xF3, 0xE3, 0xAB, 0x35, 0xC0, 0xBA, 0x3C, 0xFC, 0xFC, 0xC8, 0x61, 0x20, 0xBC, 0xB6, 0x57, 0x38,
-    0x06, 0x7E, 0x96, 0x26, 0x62, 0xE0, 0x67, 0x4C, 0x4B, 0xDC, 0x0E, 0x63, 0x1B, 0x2F, 0x90, 0x4F,
-    0x93, 0x30, 0x60, 0x75, 0x09, 0x87, 0x05, 0x23, 0x7D, 0x7C, 0xBE, 0xF1, 0xE2, 0xAF, 0xCA, 0xE9,
-    0x6D, 0xF4, 0x7A, 0x20, 0xEA, 0x99, 0xAF, 0x55, 0x3E, 0x35, 0xE4, 0x46, 0x5F, 0xF3, 0xA0, 0x06,
-    0x17, 0x9A, 0x98, 0x76, 0x8A, 0x72, 0x2E, 0xCC, 0x32, 0xCC, 0xC5, 0x41, 0x3D, 0xE7, 0x02, 0x6E,
-    0x69, 0x0E, 0x76, 0xAD, 0xB5, 0xEE, 0xD6, 0xE8, 0xAD, 0x00, 0x91, 0x3A, 0x43, 0x90, 0x3E, 0x85,
-    0xFC, 0x10, 0xF9, 0xF3, 0xC8, 0xCC, 0xCE, 0x29, 0x87, 0x20, 0x56, 0xB5, 0xDA, 0x07, 0xC9, 0x5E,
-    0xC6, 0x5A, 0xA0, 0x96, 0xCE, 0x0D, 0x38, 0x13, 0x6F, 0xD5, 0x2E, 0x9F, 0xDE, 0xD7, 0xD0, 0x9F,
-    0x7C, 0x8C, 0xBF, 0xB3, 0x63, 0x76, 0x2A, 0xDD, 0x5F, 0x5A, 0x4A, 0xA3, 0x71, 0x16, 0xF6, 0x4F,
-    0x31, 0xEE, 0x19, 0x3D, 0xFC, 0xDC, 0x9A, 0x26, 0xB3, 0xB9, 0x59, 0x01, 0xFD, 0xD5, 0xD6, 0xCD,
-    0xFA, 0x80, 0x4E, 0xB0, 0x9E, 0x98, 0xD0, 0x85, 0xEC, 0x39, 0x18, 0xD3, 0xCE, 0xC1, 0xEC, 0xBE,
-    0xE8, 0x8E, 0xF7, 0xFE, 0xA3, 0x9F, 0xEF, 0xCF, 0xBD, 0xF0, 0x37, 0x53, 0xBD, 0x4C, 0x0B, 0xBB,
-    0xEF, 0xA2, 0x0B, 0xC9, 0x1C, 0x21, 0x05, 0x2C, 0xF3, 0xB3, 0x1F, 0x8B, 0xF9, 0xF6, 0xFE, 0xE6,
-    0xB1, 0x8B, 0x5A, 0x15, 0x53, 0x64, 0x18, 0xA4, 0xF9, 0xC2, 0xD1, 0xFD, 0x85, 0xF6, 0x68, 0xA9,
-    0xCF, 0x07, 0x86, 0xBE, 0x8F, 0x4B, 0x95, 0xCD, 0x9D, 0xA5, 0xCA, 0xF7, 0x13, 0x58, 0x78, 0x1C,
-    0x79, 0x2C, 0x82, 0x4D, 0x5D, 0x87, 0x81, 0x85, 0xAD, 0xB7, 0x25, 0xB0, 0x70, 0xF7, 0xBC, 0x8B,
-    0x1A, 0x3C, 0x01, 0xCA, 0xB6, 0xC6, 0x71, 0x8E, 0x7A, 0xB6, 0x6A, 0xD9, 0xAA, 0x63, 0xDF, 0x46,
-    0xC3, 0xBE, 0x9F, 0x2F, 0x22, 0xDC, 0x52, 0xEF, 0xE2, 0x70, 0xB3, 0xDE, 0xC5, 0xA7, 0xEF, 0x55,
-    0x21, 0x8F, 0xDA, 0x05, 0x4F, 0x69, 0x5A, 0x87, 0xBE, 0xCF, 0x85, 0xEA, 0x2F, 0xCA, 0xE7, 0x68,
-    0xC1, 0x21, 0x82, 0xC0, 0x81, 0x3B, 0x95, 0x7C, 0x08, 0x4F, 0xFC, 0x8A, 0xAD, 0x6D, 0x25, 0x31,
-    0x9C, 0xAB, 0xB0, 0x9F, 0x02, 0x11, 0x2E, 0x4C, 0x25, 0x01, 0xCE, 0xAE, 0x17, 0x07, 0x98, 0x4D,
-    0xF8, 0x50, 0x52, 0x07, 0xDD, 0x7F, 0x23, 0xF6, 0x8E, 0xD8, 0xF2, 0x8F, 0x99, 0x78, 0x31, 0xD2,
-    0x21, 0xD1, 0x7A, 0x1D, 0x03, 0x43, 0xC5, 0x7C, 0xAD, 0xD9, 0xA7, 0x81, 0x1C, 0x27, 0xC5, 0xF6,
-    0x55, 0x87, 0x5D, 0x68, 0xCE, 0x3F, 0xC2, 0xB3, 0x5B, 0xB2, 0x32, 0x8D, 0xE2, 0x60, 0x50, 0xBC,
-    0xB4, 0x9B, 0x98, 0x09, 0x59, 0x5B, 0x3E, 0x1F, 0xAF, 0x77, 0xDF, 0x7F, 0xBB, 0x58, 0x2D, 0xD4,
-    0x06, 0x58, 0x69, 0x7F, 0x6F, 0xAE, 0xBD, 0x8C, 0x6C, 0x52, 0x86, 0x46, 0x45, 0x68, 0x0D, 0x6F,
-    0x57, 0x89, 0x26, 0xCD, 0xE8, 0xC1, 0x7A, 0x49, 0xE2, 0x47, 0x53, 0xD7, 0xA5, 0x1A, 0xA3, 0xB3,
-    0x09, 0x10, 0x95, 0xB5, 0xC0, 0x89, 0xBD, 0x54, 0xE9, 0x08, 0x44, 0x74, 0xD9, 0x7C, 0x08, 0xA5,
-    0x5F, 0xEC, 0xF4, 0x3E, 0xB9, 0x70, 0x03, 0x7C, 0x22, 0x1B, 0x93, 0xD1, 0x34, 0x75, 0xB1, 0xFE,
-    0x98, 0x65, 0x96, 0x1C, 0xA9, 0xE0, 0x40, 0xF8, 0x50, 0x6C, 0xA6, 0x68, 0x80, 0x29, 0x2C, 0x67,
-    0x51, 0xDF, 0xF1, 0x4D, 0xB6, 0xEF, 0x23, 0xB3, 0xE4, 0xC2, 0x7B, 0x65, 0x96, 0x1C, 0xCB, 0x23,
-    0xF1, 0x9E, 0xE6, 0xC2, 0xDB, 0x72, 0x8E, 0x7E, 0xFD, 0xDB, 0x7B, 0x35, 0xDD, 0xBB, 0xC5, 0xB0,
-    0x6B, 0xC6, 0x77, 0x0B, 0x9B, 0xDD, 0x3D, 0xBB, 0x9B, 0xDE, 0xFD, 0x74, 0x7B, 0x5B, 0xA6, 0xDB,
-    0xE8, 0x74, 0xDF, 0xC5, 0xEC, 0x2D, 0xBE, 0x6F, 0x87, 0xEF, 0xD1, 0xB5, 0xD8, 0xDD, 0xED, 0xEC,
-    0xB9, 0xF7, 0x00, 0xFF, 0x7F, 0xDD, 0x5B, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x9E, 0x21, 0x75, 0x47,
-    0x43, 0x1B, 0x84, 0x29, 0x24, 0x23, 0xD1, 0x01, 0x66, 0x93, 0x22, 0x39, 0x20, 0xC7, 0x36, 0x85,
-    0x74, 0xA4, 0xD5, 0x38, 0xDD, 0x6D, 0xA1, 0x03, 0x02, 0xA4, 0x70, 0x93, 0x22, 0x71, 0x11, 0xA5,
-    0x48, 0x91, 0x42, 0x16, 0x29, 0xB8, 0x70, 0xE9, 0x53, 0x9D, 0x22, 0x02, 0xA2, 0x42, 0x3E, 0x17,
-    0x4E, 0xE1, 0x00, 0x57, 0x9C, 0x45, 0x3A, 0x6D, 0x1A, 0x3A, 0x01, 0x92, 0x42, 0x0D, 0x61, 0x38,
-    0x40, 0x90, 0xC6, 0x0C, 0xB2, 0x36, 0xD6, 0x3A, 0x72, 0x27, 0xEF, 0x7B, 0x6F, 0xC8, 0xE5, 0xDE,
-    0x9D, 0x74, 0x8A, 0x71, 0xDA, 0x9F, 0x5B, 0xDC, 0xCD, 0x70, 0x97, 0xE4, 0xF0, 0xCD, 0xF7, 0xBD,
-    0x79, 0xEF, 0xCD, 0x9B, 0xA1, 0x52, 0x83, 0x5A, 0xE1, 0xE3, 0x37, 0x5C, 0x05, 0x86, 0xAB, 0x48,
-    0xAA, 0x6D, 0x93, 0xA2, 0x3A, 0x34, 0x39, 0xAA, 0xB1, 0x29, 0xA8, 0xD4, 0xA3, 0xA4, 0xA4, 0xCA,
-    0xA9, 0xA2, 0x8A, 0x2A, 0xB7, 0x8C, 0x46, 0x54, 0x79, 0x79, 0x30, 0xA6, 0x6A, 0x90, 0xFB, 0x68,
-    0xCD, 0x4F, 0xB9, 0xB5, 0x40, 0x0D, 0x26, 0xDC, 0x96, 0x31, 0xB6, 0x8A, 0x95, 0xFA, 0x58, 0x39,
-    0x68, 0x8D, 0x2E, 0xA3, 0x4A, 0xD3, 0xBD, 0xA6, 0xA4, 0xB6, 0x94, 0x4A, 0x2A, 0xE5, 0x52, 0x45,
-    0xAD, 0x0D, 0xF0, 0xAD, 0x56, 0x99, 0x49, 0x07, 0xC6, 0xE4, 0xF4, 0xE7, 0x1B, 0x79, 0x7E, 0xFF,
-    0x83, 0x8B, 0xE8, 0x13, 0xD6, 0xFD, 0x8A, 0x65, 0x50, 0x6A, 0xFD, 0x01, 0x4A, 0x3D, 0xA4, 0xFF,
-    0x8C, 0x44, 0xF6, 0x8C, 0x19, 0x2B, 0xBF, 0x26, 0xC9, 0xFC, 0x11, 0x09, 0xE4, 0x55, 0x1E, 0x49,
-    0xF5, 0x1D, 0x0F, 0x32, 0xA1, 0x78, 0xF5, 0x03, 0x43, 0x22, 0x91, 0x88, 0xC1, 0xE4, 0x0D, 0x43,
-    0xCF, 0xA7, 0xDF, 0x92, 0x0A, 0x45, 0xC9, 0xC5, 0x00, 0x5F, 0x7D, 0x9C, 0x48, 0xE8, 0x12, 0xF3,
-    0x5F, 0x43, 0x3F, 0xDF, 0x33, 0x95, 0xBA, 0xD2, 0x89, 0xE2, 0x01, 0x00, 0xEE, 0x77, 0xD0, 0xB4,
-    0x47, 0x4E, 0xC9, 0x42, 0x36, 0x16, 0xCC, 0x18, 0xD5, 0x8F, 0x83, 0x54, 0x90, 0x96, 0x2A, 0xE2,
-    0x1F, 0x1D, 0xB9, 0xC4, 0x91, 0xEE, 0xE8, 0x72, 0xA6, 0x8F, 0xAB, 0xC1, 0x0C, 0x80, 0x56, 0x21,
-    0xDA, 0xBB, 0x91, 0x50, 0x33, 0x57, 0xB8, 0x9B, 0x21, 0x1D, 0xE9, 0xC7, 0x6D, 0xCF, 0x04, 0x8E,
-    0x78, 0x7E, 0xAC, 0x38, 0x7B, 0x82, 0x20, 0x60, 0x59, 0xBB, 0x15, 0xE0, 0xC9, 0xFE, 0xE4, 0x3A,
-    0xE3, 0x97, 0x31, 0xEE, 0x8D, 0x8F, 0x53, 0x6E, 0xE5, 0x00, 0x23, 0x1D, 0xAB, 0xE1, 0xEA, 0xE1,
-    0x6E, 0x3F, 0xB8, 0x06, 0x1D, 0xF5, 0x26, 0x01, 0x3D, 0xC7, 0xFC, 0x94, 0xEE, 0x78, 0x93, 0x4E,
-    0x36, 0xF4, 0x3B, 0xC1, 0x7E, 0x60, 0xAF, 0x9A, 0x03, 0xEE, 0xFA, 0xA1, 0x3C, 0x4A, 0xD0, 0x53,
-    0xDB, 0xFA, 0x16, 0x83, 0xB9, 0x33, 0x51, 0x27, 0x71, 0x1F, 0xAD, 0x38, 0xEE, 0x3C, 0x78, 0x7D,
-    0x1C, 0xBB, 0x9F, 0x42, 0xB2, 0x3F, 0x40, 0x20, 0xFF, 0x1F, 0x23, 0x9C, 0xA1, 0x06, 0x0F, 0xD4,
-    0x56, 0xDB, 0x29, 0x80, 0x70, 0xDB, 0x8C, 0x94, 0x36, 0x66, 0xA2, 0x5C, 0xE3, 0x1A, 0xE5, 0x36,
-    0x8E, 0x49, 0x75, 0xAD, 0xE9, 0xBE, 0x4B, 0x1A, 0xED, 0xA1, 0x58, 0xDB, 0xA7, 0x22, 0xA3, 0xE6,
-    0x3D, 0x73, 0x9F, 0x9E, 0xD3, 0xD0, 0x6F, 0x41, 0x8D, 0x62, 0xCC, 0x85, 0x83, 0xAF, 0x2E, 0x4E,
-    0x04, 0xB8, 0xA4, 0x36, 0xF4, 0x73, 0x49, 0xA2, 0xAD, 0xCD, 0x5A, 0x45, 0xC1, 0x4A, 0x3F, 0x11,
-    0x0B, 0xE3, 0xE5, 0x17, 0x5A, 0xFB, 0xBF, 0xC7, 0x3D, 0xC6, 0xD1, 0x3B, 0xB9, 0xF4, 0x76, 0xE1,
-    0x43, 0x40, 0xA9, 0x4B, 0x96, 0x88, 0xE2, 0xB7, 0x00, 0xC3, 0x4C, 0x00, 0x86, 0xFB, 0x57, 0xC3,
-    0x08, 0xC5, 0x9B, 0x0C, 0xFE, 0xDA, 0x2D, 0x01, 0xF8, 0xB4, 0x71, 0x71, 0x3E, 0x8C, 0x54, 0x0B,
-    0x61, 0x24, 0x4C, 0x7F, 0x40, 0xD7, 0x8E, 0xEF, 0x28, 0xE7, 0x88, 0xF0, 0x75, 0x73, 0x16, 0x42,
-    0xE3, 0xD1, 0x78, 0x86, 0x8F, 0xA6, 0x99, 0x96, 0x7A, 0x01, 0xB4, 0xAC, 0x3F, 0x9A, 0xC1, 0x5C,
-    0x1C, 0x72, 0x16, 0x02, 0x34, 0x67, 0xEC, 0x31, 0x4C, 0x85, 0x1A, 0xA9, 0x13, 0x9F, 0xD5, 0x0C,
-    0x8E, 0x82, 0x42, 0xE4, 0x94, 0x0E, 0x25, 0x52, 0x45, 0x12, 0x62, 0x0C, 0x58, 0x68, 0xE7, 0x7D,
-    0xA6, 0x04, 0x8E, 0x1A, 0xBD, 0x48, 0x76, 0x0A, 0xF0, 0x32, 0x9A, 0x3B, 0x2F, 0xCF, 0x8F, 0x9F,
-    0xD4, 0xB5, 0x58, 0x44, 0x97, 0x0B, 0x0F, 0xA5, 0xE2, 0x53, 0xBA, 0x92, 0x4B, 0x9A, 0x9F, 0x71,
-    0x5F, 0x13, 0xE1, 0x22, 0x10, 0x7E, 0x55, 0xBC, 0xB2, 0x1C, 0xB2, 0x63, 0x79, 0x1B, 0x47, 0x74,
-    0xA7, 0xBE, 0x7F, 0x6F, 0x8F, 0x9A, 0xF0, 0x48, 0x2A, 0xBE, 0x22, 0xC1, 0x63, 0x2E, 0x7F, 0xAE,
-    0xE6, 0xC9, 0xD0, 0x0F, 0x55, 0x9F, 0x82, 0x81, 0xC8, 0xE9, 0x14, 0x17, 0x98, 0x83, 0x84, 0x45,
-    0x8C, 0xAD, 0x03, 0xD5, 0x7B, 0xF7, 0x17, 0xCE, 0x81, 0x27, 0x8F, 0xFB, 0xB6, 0x0C, 0x80, 0x4B,
-    0x37, 0xFA, 0xC3, 0x41, 0xDB, 0xE1, 0x70, 0xF3, 0x82, 0x51, 0xA1, 0x39, 0x6A, 0xC1, 0x43, 0xBE,
-    0xC5, 0x91, 0xCB, 0x1D, 0x16, 0x05, 0x63, 0xE2, 0x93, 0x85, 0xF3, 0x61, 0x3F, 0x49, 0xCE, 0x26,
-    0xD5, 0xB0, 0x77, 0xD7, 0xFF, 0x11, 0xD0, 0x86, 0xD7, 0xFA, 0x97, 0x54, 0x32, 0x52, 0x1A, 0x19,
-    0x37, 0xD1, 0x79, 0xD2, 0xB2, 0x18, 0x27, 0xBF, 0xA9, 0x68, 0x66, 0x65, 0x3E, 0x2B, 0x95, 0x3E,
-    0x22, 0x31, 0x9C, 0x32, 0x49, 0xAD, 0xFC, 0x7B, 0x9A, 0x8E, 0x46, 0x2E, 0xB5, 0x99, 0x65, 0xA9,
-    0x95, 0x7C, 0x7D, 0xAE, 0xB4, 0xD0, 0x33, 0x86, 0x8C, 0x08, 0x4F, 0x39, 0x75, 0x33, 0xE0, 0x11,
-    0x91, 0x99, 0xBC, 0xE7, 0xF2, 0xD7, 0xFF, 0xA5, 0x2E, 0x8A, 0x93, 0x3F, 0x33, 0x03, 0xC2, 0x51,
-    0xA4, 0x53, 0x92, 0x8D, 0xD6, 0x5F, 0x6F, 0xB4, 0xC3, 0x65, 0x01, 0xBC, 0x3C, 0xD7, 0xC9, 0x03,
-    0x93, 0xC6, 0x96, 0xDA, 0x14, 0x7A, 0x82, 0xD8, 0x59, 0x6D, 0x9F, 0x28, 0xAF, 0x70, 0xA9, 0x8E,
-    0x95, 0xFF, 0xDC, 0x8D, 0xD1, 0x2F, 0x74, 0xCC, 0xFC, 0x7B, 0x3F, 0x3D, 0xF5, 0x9A, 0xD9, 0x92,
-    0xC2, 0x1F, 0x2A, 0x7D, 0x5B, 0xD2, 0x13, 0x55, 0x94, 0xE2, 0xE9, 0xC6, 0x96, 0xB3, 0x18, 0x47,
-    0xFC, 0x3D, 0x63, 0x45, 0x32, 0xD5, 0xF4, 0x58, 0xE2, 0x92, 0x21, 0x4F, 0xED, 0x52, 0x00, 0x43,
-    0x9C, 0x35, 0xA4, 0x46, 0xFE, 0x98, 0xE6, 0x77, 0x61, 0xE5, 0x10, 0x12, 0x54, 0xC4, 0x51, 0x45,
-    0x93, 0xBC, 0xE4, 0xE9, 0x07, 0x54, 0xA0, 0xED, 0xE4, 0xCB, 0xDD, 0xDD, 0x38, 0xA9, 0xDA, 0x58,
-    0x8C, 0x8B, 0x70, 0x44, 0x73, 0x38, 0x42, 0x83, 0x34, 0xC5, 0xDC, 0x7B, 0x8C, 0xA6, 0x6A, 0x34,
-    0x5A, 0xDA, 0x99, 0xA3, 0x78, 0x5B, 0x56, 0x2C, 0xD3, 0x46, 0x6C, 0xAC, 0x52, 0x32, 0xD9, 0x96,
-    0x10, 0x1B, 0xB7, 0x28, 0x5D, 0xD4, 0x53, 0xAF, 0xA0, 0xF9, 0xD8, 0x67, 0x59, 0x7D, 0x96, 0xD5,
-    0x9F, 0xF6, 0x69, 0xD9, 0x10, 0xE7, 0x3C, 0x41, 0x88, 0x9E, 0xDD, 0xB8, 0x4D, 0x0D, 0x5E, 0xE1,
-    0xFC, 0x18, 0x27, 0x91, 0x32, 0x74, 0x7E, 0xD4, 0x39, 0xB9, 0x79, 0x81, 0xCE, 0x09, 0x2D, 0x32,
-    0x07, 0x34, 0x25, 0x20, 0xB9, 0x9E, 0x14, 0x8C, 0x19, 0x75, 0xF8, 0x90, 0xE1, 0xBF, 0xA5, 0x0F,
-    0x8E, 0x29, 0xC9, 0xB2, 0x01, 0x7A, 0x55, 0x2E, 0xDC, 0xA2, 0x8E, 0x35, 0x1F, 0xD3, 0x24, 0x94,
-    0x7A, 0xE7, 0xE5, 0xA4, 0xBE, 0x6B, 0xF1, 0x46, 0xA7, 0xDF, 0xF3, 0xD1, 0xDD, 0x5F, 0x72, 0x89,
-    0x01, 0xBF, 0xFB, 0x3A, 0x7C, 0xB7, 0xF9, 0x1B, 0x75, 0xD3, 0x3D, 0x62, 0x5B, 0xC0, 0xFA, 0x1A,
-    0x71, 0x60, 0x79, 0x65, 0x9A, 0xC7, 0x58, 0x56, 0x7B, 0x20, 0x59, 0x36, 0x9B, 0x62, 0x08, 0xBA,
-    0x14, 0xC3, 0xB1, 0xB9, 0xEC, 0x1C, 0x60, 0x15, 0xD3, 0xC3, 0xA9, 0x27, 0x72, 0x3D, 0xE8, 0xAF,
-    0xFA, 0x13, 0x9F, 0x6B, 0x61, 0x6D, 0x56, 0x06, 0xD6, 0x67, 0x24, 0xD1, 0xAA, 0x93, 0x49, 0x34,
-    0xF8, 0x91, 0x0D, 0xF4, 0x32, 0x23, 0xF9, 0x1D, 0x73, 0xD3, 0x28, 0x77, 0x42, 0xDE, 0x93, 0xE0,
-    0xCD, 0xE0, 0x6F, 0xB3, 0x82, 0x8A, 0xA4, 0x0C, 0x26, 0xFB, 0xA6, 0x0C, 0xA8, 0xF9, 0x32, 0x68,
-    0x76, 0x77, 0x87, 0x41, 0xDD, 0x3A, 0x1A, 0x2E, 0x06, 0xD4, 0xF3, 0x98, 0xB8, 0xF0, 0x72, 0xC7,
-    0x94, 0x64, 0x68, 0x32, 0xF8, 0xE4, 0x0D, 0x03, 0xDB, 0x7A, 0xB5, 0x37, 0x9A, 0xC5, 0x68, 0xFE,
-    0x48, 0xFC, 0xE8, 0xC1, 0x6A, 0x6B, 0xEE, 0x33, 0x32, 0x64, 0x8B, 0x54, 0x5F, 0x6B, 0xC5, 0xFD,
-    0x66, 0xC0, 0x41, 0xE2, 0x17, 0xF4, 0xED, 0x6D, 0x5E, 0x3B, 0xF8, 0xBE, 0xC3, 0x1E, 0x8D, 0x15,
-    0x5A, 0x3A, 0x39, 0x8B, 0x76, 0xF8, 0x22, 0x68, 0xDF, 0x5D, 0x1C, 0xDA, 0x36, 0xFB, 0x75, 0x88,
-    0xEC, 0xD7, 0xA8, 0xCD, 0x7E, 0xA9, 0x33, 0xB3, 0x5F, 0x0C, 0x79, 0x32, 0x03, 0x79, 0x70, 0xEE,
-    0x90, 0xBF, 0x95, 0x4E, 0x41, 0xE5, 0x30, 0xC6, 0xFF, 0x0C, 0xA0, 0x86, 0x29, 0xA6, 0xBA, 0x37,
-    0x64, 0xAE, 0xBB, 0xC4, 0xFE, 0xEC, 0xC5, 0x43, 0x32, 0xE7, 0xD1, 0x99, 0x69, 0xAD, 0xF9, 0x45,
-    0x6D, 0xF5, 0x33, 0xA2, 0xB6, 0xAC, 0x20, 0x16, 0x48, 0x45, 0xEE, 0xC1, 0xC6, 0x8C, 0xB1, 0x18,
-    0x42, 0x0D, 0x22, 0xD4, 0xA0, 0xAF, 0xAF, 0x75, 0x14, 0xC4, 0xF8, 0x77, 0xD0, 0x43, 0x00, 0x75,
-    0x0E, 0xFF, 0x9A, 0xC4, 0x6B, 0xDB, 0xA5, 0x90, 0xCB, 0x37, 0xA9, 0xFF, 0x66, 0xF1, 0x8A, 0x57,
-    0x62, 0xED, 0x88, 0x66, 0x71, 0x24, 0xC8, 0x47, 0x14, 0xF1, 0x4B, 0xF6, 0x20, 0xA6, 0x3F, 0x0F,
-    0x8F, 0x3F, 0xFB, 0xCF, 0x35, 0x79, 0x62, 0x6A, 0xFA, 0x7B, 0xD9, 0x32, 0x4F, 0xA7, 0xDD, 0x56,
-    0xA9, 0x00, 0x37, 0xEA, 0x2D, 0x3A, 0xF5, 0x0B, 0x85, 0x85, 0x15, 0x93, 0xBA, 0xD4, 0xB7, 0x49,
-    0x6F, 0x86, 0xFE, 0x8D, 0x7A, 0x62, 0xA7, 0x46, 0x58, 0xAE, 0x89, 0xA5, 0x4D, 0xF5, 0x7E, 0x37,
-    0x61, 0xCA, 0x20, 0x49, 0x80, 0xD9, 0x12, 0x29, 0x1E, 0x91, 0x8A, 0xB5, 0x1C, 0x93, 0x62, 0x8E,
-    0x44, 0x5E, 0xA8, 0x81, 0x7E, 0xC0, 0xEF, 0x44, 0x23, 0x4C, 0xC8, 0xC2, 0x3A, 0xA2, 0xCB, 0x82,
-    0xB6, 0x1C, 0xC1, 0xEE, 0x9D, 0x52, 0xF6, 0xAE, 0x91, 0xBB, 0xB8, 0x85, 0xB1, 0xB4, 0x06, 0xF3,
-    0x91, 0x94, 0x24, 0x1E, 0x0C, 0x39, 0xE6, 0x55, 0xD0, 0x6D, 0x3C, 0xDD, 0x91, 0xA1, 0xA1, 0x87,
-    0xC7, 0xA7, 0x84, 0x32, 0x15, 0x8C, 0xB8, 0x0C, 0xD9, 0x8F, 0xAD, 0xEF, 0x4D, 0x15, 0xBF, 0x10,
-    0x6D, 0x1D, 0x34, 0x04, 0x18, 0xCD, 0x16, 0x4D, 0x1A, 0x56, 0xD4, 0x32, 0x69, 0x75, 0x56, 0x90,
-    0x92, 0x27, 0x25, 0x0A, 0xA4, 0x16, 0xDA, 0x02, 0x5F, 0x23, 0x9C, 0xE0, 0x4B, 0xF8, 0x62, 0x1F,
-    0xB7, 0x71, 0x03, 0xA2, 0xF8, 0xE1, 0x31, 0xC5, 0x6F, 0xEC, 0xA4, 0x51, 0xB4, 0x9F, 0x8F, 0xF4,
-    0xA3, 0xA9, 0x34, 0x09, 0x13, 0xF4, 0xEB, 0xA8, 0x97, 0x57, 0xBC, 0xCB, 0xD1, 0x0C, 0x9F, 0x75,
-    0xF3, 0x69, 0xB9, 0xC4, 0x88, 0xF3, 0xA4, 0x85, 0xAD, 0x7A, 0x00, 0xAB, 0xFE, 0x0A, 0xAF, 0x34,
-    0x73, 0x2C, 0x83, 0x35, 0x70, 0x35, 0xB6, 0x19, 0x5C, 0x41, 0x7D, 0x4E, 0xD0, 0x5F, 0x96, 0xEC,
-    0x12, 0x95, 0x6B, 0xC3, 0x6D, 0x56, 0x81, 0x8F, 0x60, 0x6E, 0x26, 0x3C, 0x85, 0x0C, 0xE9, 0x67,
-    0xAF, 0xA4, 0xE1, 0x0E, 0x1F, 0x3A, 0x5C, 0x09, 0x75, 0x9E, 0xAE, 0x6C, 0xFB, 0xED, 0xB2, 0xDE,
-    0x7B, 0x05, 0x96, 0xF5, 0xD8, 0xA0, 0x1F, 0xCE, 0x1A, 0xF4, 0x97, 0x09, 0xAE, 0xF3, 0xA0, 0x9B,
-    0x86, 0x2B, 0x75, 0x67, 0x0D, 0x0F, 0x7C, 0x4D, 0xC6, 0x57, 0xC6, 0xCA, 0x5D, 0x4F, 0xC1, 0xD5,
-    0x2B, 0x01, 0x6E, 0xD3, 0x0D, 0xBD, 0xC1, 0xBB, 0x74, 0x8F, 0x7E, 0x8F, 0xC3, 0x93, 0x16, 0x5C,
-    0x3D, 0x57, 0x70, 0xD5, 0x8C, 0xDD, 0x50, 0xEE, 0xEF, 0x55, 0x9B, 0xAF, 0x68, 0xB5, 0xF8, 0x37,
-    0xAB, 0xAA, 0xC5, 0xBD, 0xF8, 0xBB, 0x10, 0xA3, 0x46, 0xF1, 0x77, 0x4C, 0xAA, 0xFC, 0x93, 0x85,
-    0xA9, 0xB2, 0xCC, 0xA5, 0x00, 0x50, 0x05, 0xD3, 0x7C, 0x44, 0xA5, 0xFF, 0x2E, 0x44, 0x5C, 0x53,
-    0xBF, 0xE2, 0xC5, 0xE9, 0xE1, 0xD4, 0x79, 0x30, 0xE6, 0x7A, 0x7C, 0x86, 0x72, 0x8F, 0x96, 0x09,
-    0xF3, 0x30, 0xFD, 0x2E, 0x21, 0xFE, 0x75, 0xBB, 0x06, 0x5D, 0x9C, 0xB6, 0x06, 0xBD, 0xB3, 0x20,
-    0xE0, 0x2F, 0x3F, 0x3C, 0x0E, 0x6D, 0x83, 0x19, 0xB0, 0x5B, 0x61, 0xE9, 0x7F, 0x90, 0x3A, 0xE5,
-    0x6C, 0xA0, 0xBB, 0xBA, 0x91, 0x06, 0x2F, 0x2E, 0xB3, 0xEF, 0x0F, 0x38, 0xE5, 0xBC, 0x53, 0x2E,
-    0x06, 0xF0, 0xE7, 0x07, 0x23, 0x6A, 0xF3, 0x81, 0xEA, 0x72, 0xA8, 0xA4, 0x34, 0xEC, 0x3C, 0xDD,
-    0xA6, 0x9F, 0x5B, 0xF7, 0xBB, 0xB9, 0x87, 0x96, 0xFD, 0x64, 0xDE, 0x98, 0x69, 0xC1, 0x24, 0x8D,
-    0x14, 0xDF, 0xAB, 0x99, 0x18, 0x5D, 0x0B, 0x33, 0x63, 0xA6, 0xE6, 0xD3, 0x8A, 0xD1, 0x3C, 0x2A,
-    0x18, 0xDA, 0x89, 0x12, 0x9C, 0x95, 0x80, 0xDE, 0x55, 0x4C, 0xC7, 0x33, 0xAA, 0x99, 0x2B, 0xED,
-    0xED, 0xC2, 0x93, 0x12, 0xA2, 0xB8, 0x17, 0x24, 0xB6, 0xA5, 0xCA, 0x72, 0x65, 0xC9, 0x6A, 0xD9,
-    0x6A, 0xE9, 0x5A, 0xE7, 0xD0, 0xD5, 0xAF, 0xA7, 0x5B, 0x00, 0x64, 0xC9, 0x86, 0x3B, 0x4A, 0x8C,
-    0x48, 0x8E, 0x25, 0xCB, 0x41, 0x09, 0x95, 0xC4, 0x49, 0x94, 0x03, 0x49, 0x3F, 0x07, 0xA8, 0x7E,
-    0x0A, 0x5A, 0x3E, 0x54, 0x80, 0xBA, 0xC6, 0xFD, 0x19, 0x78, 0x50, 0x89, 0x94, 0xDD, 0x41, 0xF7,
-    0xB5, 0x52, 0x4C, 0x0F, 0x5F, 0x59, 0xF0, 0x5D, 0xB9, 0x62, 0x86, 0x84, 0x63, 0xCB, 0x91, 0x25,
-    0xC9, 0x0E, 0x0B, 0x61, 0xC3, 0xB3, 0x7B, 0x97, 0x6C, 0xA0, 0x1F, 0xE5, 0x7D, 0x22, 0xF4, 0x68,
-    0xD5, 0x89, 0x70, 0xF6, 0xAD, 0xD9, 0x55, 0x32, 0x03, 0xC4, 0xE0, 0xA8, 0xA6, 0x51, 0xAF, 0xBA,
-    0xB3, 0x78, 0x22, 0xEC, 0x10, 0xB6, 0xF1, 0x79, 0x1B, 0xA0, 0xB7, 0x2B, 0xFF, 0x77, 0x55, 0x4F,
-    0x5A, 0x1B, 0x9E, 0x53, 0xB5, 0xB2, 0x03, 0x43, 0x76, 0x27, 0xB2, 0x47, 0x90, 0x10, 0xDE, 0xC6,
-    0xF0, 0x36, 0xB5, 0xCA, 0x51, 0xBC, 0x84, 0xF1, 0x14, 0xC7, 0x6F, 0x29, 0xCB, 0xCA, 0xC2, 0xB8,
-    0x91, 0x92, 0x3A, 0x76, 0xC0, 0xA6, 0xEC, 0x2B, 0x4E, 0x8D, 0x7D, 0xC1, 0x09, 0x90, 0xC0, 0xE1,
-    0x54, 0x8A, 0x75, 0xE0, 0x2B, 0x6D, 0xAD, 0x24, 0xBD, 0x97, 0x95, 0x5B, 0x4A, 0xD6, 0x2E, 0x94,
-    0x7B, 0x04, 0x28, 0xBC, 0x3C, 0x43, 0x0E, 0x36, 0xDE, 0x48, 0x17, 0x3F, 0x48, 0x56, 0xDA, 0x19,
-    0x9C, 0xBA, 0x74, 0x1C, 0xD5, 0xFD, 0xD1, 0x2F, 0xB9, 0x02, 0xFA, 0x2C, 0x05, 0xD4, 0xED, 0xAC,
-    0x40, 0xBC, 0x03, 0xBB, 0x70, 0x7B, 0xCC, 0x4E, 0x3C, 0x31, 0x46, 0x1B, 0xE4, 0x78, 0xB8, 0x72,
-    0xE9, 0xE6, 0x41, 0xC9, 0xDB, 0x69, 0xBD, 0x42, 0xAA, 0xFC, 0x65, 0x56, 0xAA, 0xAD, 0x0A, 0x36,
-    0x1A, 0x59, 0xC5, 0x99, 0xD4, 0xA8, 0xE1, 0x75, 0x4B, 0x5F, 0x3A, 0xC4, 0x8B, 0xEB, 0x27, 0x08,
-    0xF0, 0xC6, 0xFD, 0x1D, 0x07, 0x76, 0x57, 0xA2, 0xFD, 0xC6, 0x79, 0xF0, 0xC8, 0x60, 0x55, 0x37,
-    0x32, 0xAF, 0x63, 0xED, 0xCE, 0xC4, 0xC4, 0x94, 0x6B, 0x62, 0xFF, 0x1B, 0x95, 0xA4, 0x2D, 0xA4,
-    0x92, 0x21, 0xCA, 0x1C, 0x54, 0x9B, 0xA7, 0x10, 0x2C, 0x33, 0x7F, 0x21, 0xC1, 0x42, 0xE3, 0x41,
-    0xBC, 0xBE, 0x6C, 0xA1, 0x6C, 0x20, 0xAA, 0xA6, 0xA5, 0x44, 0x0D, 0xB2, 0x74, 0x38, 0xFB, 0x46,
-    0xC3, 0xF5, 0xFF, 0xEF, 0x8D, 0x86, 0x95, 0x63, 0x6B, 0x97, 0x9D, 0x9C, 0xAC, 0xAE, 0x61, 0x6F,
-    0xB7, 0x72, 0x34, 0x13, 0xC7, 0x6B, 0xD2, 0x6A, 0xA3, 0x9C, 0xBA, 0xC7, 0xAD, 0xFE, 0xE6, 0xDF,
-    0x45, 0xF1, 0x77, 0xD9, 0x6E, 0xC0, 0xB7, 0xFB, 0x3E, 0x55, 0x52, 0xF4, 0x77, 0x85, 0xB7, 0xBE,
-    0x1B, 0x68, 0x77, 0x9F, 0x9F, 0x77, 0xB9, 0x4E, 0x66, 0xE5, 0xCF, 0x46, 0xEA, 0x4F, 0x10, 0x4D,
-    0x17, 0x6A, 0x90, 0x27, 0x16, 0xBD, 0x6D, 0x5B, 0x5F, 0x97, 0xFA, 0xEF, 0x23, 0xA9, 0xB1, 0x7A,
-    0x8F, 0xFA, 0x73, 0xD5, 0xA1, 0x7C, 0x5E, 0xB5, 0xEA, 0xEA, 0x42, 0x76, 0x1D, 0x82, 0x30, 0xE8,
-    0x99, 0x65, 0xAC, 0xA5, 0x0C, 0x9C, 0x89, 0x8E, 0xE9, 0xD6, 0x6A, 0xEC, 0xA7, 0xD6, 0x57, 0x72,
-    0x6F, 0xED, 0x18, 0xAB, 0x7A, 0xAB, 0x07, 0xD8, 0x60, 0x69, 0x55, 0x37, 0xB2, 0x5B, 0x65, 0xCB,
-    0xC8, 0x38, 0xA6, 0x0E, 0xAB, 0xC8, 0xDC, 0x34, 0xF5, 0xA0, 0x64, 0xCE, 0xDC, 0x82, 0x49, 0x18,
-    0x20, 0x03, 0xEC, 0x37, 0x8F, 0x99, 0x12, 0x7A, 0x96, 0x30, 0xF3, 0x82, 0x15, 0x6C, 0xB5, 0xD0,
-    0x87, 0x9E, 0xB1, 0xA9, 0x15, 0x02, 0x89, 0xC1, 0x27, 0xE0, 0x2E, 0x30, 0x6F, 0xB0, 0xCE, 0x09,
-    0x87, 0x12, 0x26, 0x0A, 0x0A, 0x33, 0x1C, 0x5A, 0xF9, 0x65, 0x55, 0x41, 0xB5, 0x7B, 0x44, 0x2F,
-    0x2C, 0x89, 0x6F, 0x89, 0x17, 0x12, 0x03, 0xD4, 0xEE, 0x6A, 0x72, 0x6D, 0xDF, 0x33, 0xBB, 0xCB,
-    0x39, 0x5E, 0x52, 0x12, 0x5B, 0x2B, 0xD9, 0x9A, 0xC9, 0xCE, 0x4E, 0x76, 0x13, 0x4A, 0xB1, 0x94,
-    0xAD, 0xA9, 0x54, 0xDA, 0x92, 0x0B, 0x63, 0x79, 0x11, 0x47, 0xE4, 0xAE, 0x9A, 0x1A, 0x52, 0x6B,
-    0x49, 0x5B, 0x53, 0x6A, 0x6D, 0xA9, 0x0A, 0xCA, 0xFE, 0x64, 0x63, 0x4B, 0xC6, 0xE7, 0xA5, 0xE5,
-    0xA3, 0xB6, 0x5D, 0x80, 0xCE, 0xCA, 0x40, 0xC6, 0xE9, 0x44, 0xD6, 0x2E, 0x8E, 0xA4, 0xEB, 0x6E,
-    0x91, 0x71, 0xB7, 0x74, 0x3C, 0xD8, 0xBB, 0xC8, 0xE3, 0xD3, 0x3A, 0x48, 0xD9, 0x23, 0x65, 0x37,
-    0x49, 0xD9, 0x5D, 0x52, 0x76, 0x9B, 0x14, 0xEF, 0x93, 0x5A, 0xD2, 0xF1, 0x79, 0x61, 0x3D, 0xDF,
-    0x6C, 0x78, 0xD9, 0x46, 0x94, 0x6D, 0x80, 0xD9, 0x7D, 0x77, 0x1E, 0x4E, 0x5F, 0x15, 0x59, 0x5E,
-    0x86, 0xBA, 0x60, 0xB4, 0x75, 0x03, 0xB6, 0xB2, 0x2F, 0xB2, 0x48, 0x40, 0x2A, 0xE9, 0x2D, 0x57,
-    0x42, 0x1C, 0x71, 0x9A, 0x72, 0x93, 0x57, 0x75, 0x3B, 0x78, 0xFA, 0x2F, 0xC8, 0x99, 0x1A, 0x6F,
-    0xCF, 0x51, 0xDF, 0x68, 0x22, 0x43, 0x97, 0x47, 0x85, 0xC7, 0x7B, 0x37, 0x5C, 0x1C, 0x33, 0x03,
-    0x37, 0x18, 0xEF, 0x43, 0x8E, 0xA2, 0xB0, 0x30, 0x5F, 0x23, 0x90, 0x15, 0x3D, 0x1F, 0x18, 0xD0,
-    0xE1, 0x9A, 0x9D, 0x18, 0x9D, 0xF9, 0x90, 0xDB, 0x63, 0x44, 0x93, 0x7A, 0x1A, 0x76, 0x3D, 0xBF,
-    0x4C, 0xC6, 0x9C, 0x15, 0x05, 0x6F, 0x34, 0x43, 0xAB, 0x6C, 0xAC, 0xC2, 0x3B, 0x18, 0x02, 0xDE,
-    0x45, 0xCC, 0x2D, 0x31, 0x5D, 0xC1, 0xAC, 0xDC, 0xA5, 0x69, 0xB8, 0x08, 0x26, 0xCA, 0x47, 0x36,
-    0xD8, 0xCF, 0x69, 0x1E, 0xE4, 0xA7, 0x48, 0x9C, 0x32, 0xB2, 0xE8, 0x3D, 0x64, 0x2F, 0xEE, 0x60,
-    0x3A, 0x78, 0x00, 0x98, 0xA8, 0xC1, 0xE0, 0x4B, 0x48, 0xFF, 0xB4, 0x84, 0xF0, 0x05, 0x64, 0xE7,
-    0x0E, 0xA4, 0x60, 0xA1, 0x8B, 0x0C, 0x9B, 0x76, 0xC3, 0x28, 0x07, 0x88, 0x8C, 0x5B, 0x48, 0x37,
-    0xBC, 0x8A, 0xCB, 0x22, 0x88, 0xB2, 0x39, 0x5C, 0x46, 0xE4, 0x66, 0xDF, 0x78, 0x2A, 0x4F, 0xDC,
-    0x55, 0xB5, 0x6F, 0x3B, 0xCD, 0x09, 0xBB, 0x90, 0x46, 0x6D, 0x45, 0x00, 0x84, 0xA5, 0xA9, 0x08,
-    0xBB, 0xAC, 0x24, 0xEC, 0xAE, 0xC5, 0x9B, 0xA2, 0xD0, 0xE1, 0xA8, 0xCB, 0xFA, 0xAB, 0x3F, 0xF6,
-    0x57, 0xBE, 0x1F, 0xB3, 0xFA, 0x8E, 0x4E, 0x5B, 0xF9, 0x5E, 0x3E, 0xC4, 0x77, 0x79, 0xF6, 0x8D,
-    0xD6, 0x7F, 0x47, 0x5F, 0x1D, 0x5E, 0x9F, 0xE5, 0x82, 0x87, 0x1C, 0xBF, 0x96, 0x72, 0xBD, 0x5B,
-    0x62, 0x5A, 0x0A, 0xAD, 0xB5, 0xA9, 0x04, 0xB2, 0x40, 0xC8, 0xA7, 0x98, 0xAF, 0x2A, 0xEE, 0x11,
-    0x95, 0x21, 0x37, 0x7A, 0x75, 0x9A, 0x33, 0x5B, 0x52, 0xCC, 0xD7, 0x62, 0x3E, 0xE7, 0xC7, 0xCA,
-    0x4C, 0x6E, 0xCB, 0x4B, 0xC4, 0x0E, 0x5E, 0xFC, 0xD5, 0xF1, 0x7A, 0xB9, 0x54, 0xF6, 0xE1, 0x7F,
-    0xB5, 0x58, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0xBD, 0xB7, 0x48, 0x98, 0x68, 0x5C, 0x48,
-    0x81, 0x7D, 0x02, 0xCC, 0xC6, 0x45, 0x2C, 0x28, 0x62, 0xEB, 0xE2, 0x74, 0x33, 0x86, 0x0B, 0x15,
-    0x2E, 0xB2, 0x85, 0x0E, 0x06, 0xA2, 0x22, 0x2E, 0x6D, 0xA7, 0x50, 0x10, 0xA4, 0x70, 0x21, 0x8B,
-    0xB4, 0x53, 0xA8, 0x0A, 0x72, 0x8D, 0xAB, 0x34, 0x57, 0xA4, 0x48, 0xAE, 0xB1, 0x0A, 0x17, 0x2A,
-    0x2E, 0xE2, 0xE0, 0x8C, 0x20, 0xA5, 0x18, 0x05, 0x81, 0x8A, 0x14, 0x66, 0x00, 0xAB, 0x72, 0xE1,
-    0x09, 0xC4, 0x40, 0x7B, 0x31, 0x77, 0x27, 0xDF, 0x7B, 0x43, 0xEE, 0xED, 0xEA, 0xF4, 0x73, 0xD2,
-    0x21, 0xB3, 0x9C, 0xB7, 0xC3, 0x99, 0x37, 0x6F, 0xDE, 0xBC, 0x79, 0x7F, 0xC3, 0x9D, 0x9D, 0x27,
-    0x94, 0xC9, 0x7B, 0xDF, 0x7B, 0xF3, 0xFC, 0xA9, 0x9B, 0x89, 0x55, 0x4D, 0x3E, 0xFD, 0xD5, 0x6F,
-    0xE3, 0xF2, 0x78, 0xBF, 0xC8, 0x90, 0x25, 0x72, 0x44, 0x1B, 0x54, 0x79, 0xBA, 0xB9, 0x41, 0x3B,
-    0x37, 0x69, 0xC7, 0xD2, 0x0E, 0xBD, 0xF8, 0x33, 0x21, 0x02, 0xCD, 0xA4, 0x24, 0x45, 0xA4, 0x7D,
-    0x79, 0x2A, 0x29, 0x93, 0x4F, 0x4B, 0xDA, 0x2F, 0x29, 0x3E, 0xC1, 0x13, 0x19, 0xED, 0x6B, 0xED,
-    0x1B, 0x3C, 0xE7, 0x76, 0xB7, 0x97, 0xDB, 0x67, 0xB6, 0xB6, 0xB6, 0xA8, 0xF0, 0xDE, 0x07, 0x70,
-    0x58, 0x34, 0x5E, 0x9D, 0x00, 0x5A, 0x29, 0xDC, 0xC5, 0x65, 0xBA, 0x68, 0x1C, 0x19, 0x6A, 0x8F,
-    0x0E, 0x4D, 0x46, 0x34, 0x55, 0xE5, 0xFF, 0xFB, 0xE9, 0x99, 0xE8, 0x74, 0xBF, 0x34, 0x36, 0x37,
-    0xE1, 0xF7, 0x73, 0xBB, 0xBB, 0x7F, 0xA4, 0x57, 0xA2, 0x6E, 0x5C, 0x2B, 0xCA, 0x49, 0x97, 0xDA,
-    0xE9, 0x56, 0xB7, 0xCA, 0x45, 0x26, 0x1D, 0xDA, 0x6D, 0xE2, 0x62, 0x37, 0xAE, 0x73, 0x73, 0x4B,
-    0xF8, 0xCD, 0x2C, 0xF7, 0xE7, 0x6D, 0xDA, 0xC6, 0x2E, 0x6E, 0x52, 0x5B, 0xD0, 0x17, 0xE8, 0x1D,
-    0x6F, 0xE7, 0x8C, 0xED, 0x74, 0xAD, 0x41, 0x47, 0x95, 0x49, 0x4B, 0x7B, 0xE8, 0x7E, 0x85, 0xDE,
-    0x03, 0x6D, 0xCC, 0xCE, 0x8C, 0xA2, 0x6B, 0x18, 0xD9, 0xC3, 0x1A, 0x73, 0xD2, 0xCE, 0x5B, 0xDD,
-    0x4A, 0xAD, 0x95, 0x2B, 0x6C, 0x64, 0x46, 0x94, 0x96, 0x17, 0x86, 0xFE, 0x5A, 0xFA, 0xDB, 0xA2,
-    0x4E, 0x9C, 0xB2, 0xB1, 0x4B, 0x2D, 0xCF, 0xCF, 0xCD, 0x8C, 0x6E, 0xC5, 0xCD, 0x42, 0x6E, 0x19,
-    0x56, 0x1E, 0xF0, 0x73, 0xD4, 0xB4, 0xCD, 0x6B, 0xC6, 0x8D, 0x1B, 0x55, 0xA6, 0x36, 0xA7, 0x22,
-    0xEA, 0xE8, 0x8B, 0xB8, 0x16, 0xDC, 0xF1, 0xF6, 0x6B, 0x26, 0x77, 0x55, 0xA0, 0xCD, 0x73, 0x6A,
-    0x6F, 0x34, 0x75, 0xC2, 0x8F, 0x2A, 0x37, 0x29, 0x69, 0x55, 0x4D, 0x7B, 0x71, 0x38, 0xCF, 0x33,
-    0x06, 0xA2, 0xB2, 0xA1, 0xE6, 0x10, 0x5C, 0x66, 0x42, 0x85, 0xD6, 0xFD, 0xE9, 0xA7, 0x3F, 0x6A,
-    0xF8, 0xDC, 0xB9, 0xA2, 0xBD, 0x43, 0x79, 0x8F, 0x5B, 0xD4, 0xA1, 0x0E, 0xF3, 0x74, 0x19, 0xE6,
-    0xE6, 0xFD, 0xDC, 0x8C, 0x64, 0xFE, 0x13, 0xEB, 0xF7, 0x97, 0xD6, 0x1D, 0xD6, 0x7C, 0xD6, 0x7A,
-    0xFC, 0xFF, 0x28, 0x1D, 0x9E, 0x3B, 0x8C, 0xA1, 0x3D, 0x51, 0x34, 0xF1, 0xDF, 0x56, 0x32, 0xDF,
-    0x7F, 0xFE, 0xB9, 0x13, 0x1C, 0xA6, 0xCD, 0x78, 0x8C, 0x73, 0x4E, 0x14, 0x23, 0xF1, 0x46, 0x41,
-    0x88, 0xAC, 0xD4, 0xED, 0xD2, 0xE3, 0x32, 0xDF, 0x8C, 0x7D, 0x49, 0x97, 0x19, 0x07, 0xF6, 0x77,
-    0x9B, 0xA8, 0x6A, 0xA8, 0x9A, 0xC3, 0xA0, 0x9B, 0xCA, 0xB7, 0x95, 0x37, 0x55, 0x4B, 0x95, 0x91,
-    0xF3, 0x27, 0x1A, 0x51, 0x61, 0x7D, 0x83, 0x11, 0x68, 0xCA, 0x88, 0xA2, 0x49, 0x61, 0xD5, 0xD4,
-    0x37, 0x59, 0xC7, 0xB5, 0xAA, 0x55, 0x97, 0x9B, 0xB5, 0xE1, 0xF0, 0xF2, 0x32, 0x86, 0xEC, 0xEB,
-    0x0A, 0xD4, 0x71, 0x84, 0x95, 0x4B, 0x61, 0x62, 0x4E, 0xDE, 0x0A, 0xA7, 0x6D, 0x32, 0xC3, 0xD8,
-    0xA1, 0xE5, 0x94, 0x55, 0x0D, 0xA2, 0x0D, 0x73, 0x8B, 0xC2, 0xBE, 0x84, 0x4E, 0xE4, 0x45, 0x0E,
-    0x7D, 0x89, 0x78, 0x11, 0xF6, 0x27, 0xF1, 0x89, 0x9F, 0xC8, 0xF8, 0x95, 0x72, 0x7C, 0x2F, 0xE9,
-    0xFD, 0xFD, 0xAD, 0x9A, 0xF8, 0xD7, 0xD0, 0xF3, 0xCD, 0xDB, 0xBA, 0x42, 0x63, 0xF9, 0xA5, 0xCF,
-    0x33, 0x6F, 0xC9, 0x5F, 0xC5, 0xD8, 0x7D, 0x2A, 0x0A, 0x40, 0xEA, 0x9B, 0x96, 0x54, 0x18, 0xD3,
-    0x9F, 0xB0, 0x5D, 0x48, 0x29, 0xCC, 0x9C, 0x2E, 0x86, 0x66, 0x45, 0x5E, 0x0C, 0x5A, 0x9A, 0x15,
-    0xF5, 0xEE, 0xCB, 0x53, 0xD5, 0x1B, 0x0D, 0x37, 0x93, 0x66, 0xD1, 0x4C, 0xED, 0x62, 0x9A, 0x2A,
-    0xB7, 0xA0, 0x1C, 0x86, 0x0A, 0x9A, 0x67, 0x63, 0x5F, 0x93, 0xEF, 0x48, 0x9B, 0xD9, 0x66, 0x76,
-    0x6F, 0x9A, 0x1C, 0x54, 0x94, 0xEF, 0x4F, 0xAF, 0xE9, 0xB7, 0xBA, 0xD4, 0xE9, 0x32, 0xF5, 0xCD,
-    0x14, 0x48, 0x08, 0x33, 0x96, 0x76, 0xDF, 0x72, 0x98, 0x9A, 0xD5, 0x19, 0x14, 0x21, 0x69, 0xFC,
-    0xD0, 0x1C, 0x5B, 0xD0, 0x46, 0x13, 0x0B, 0xA9, 0x72, 0xD1, 0xCC, 0x68, 0x81, 0xA0, 0x65, 0x45,
-    0x69, 0x7E, 0x8C, 0x15, 0x67, 0x42, 0x0C, 0x86, 0xDE, 0x2F, 0x41, 0x51, 0x4B, 0xD9, 0xBD, 0x96,
-    0x17, 0xA6, 0xC4, 0x11, 0xB3, 0x53, 0xF5, 0x5B, 0x39, 0x2D, 0x4C, 0xAE, 0x96, 0x25, 0x01, 0xAD,
-    0xCA, 0x68, 0x55, 0x4C, 0xAB, 0x92, 0x5A, 0x15, 0xD6, 0xAA, 0xBC, 0x56, 0x45, 0xB6, 0x2A, 0xB5,
-    0x55, 0xC1, 0x2D, 0xCB, 0x0E, 0xBA, 0x7A, 0x79, 0x21, 0xBE, 0x6A, 0x46, 0x0A, 0x0E, 0x2C, 0x48,
-    0x30, 0x9E, 0x15, 0x46, 0xFF, 0xDE, 0xF5, 0x42, 0x1C, 0xBB, 0xDC, 0x56, 0xC9, 0xB4, 0x97, 0x63,
-    0xEA, 0xB2, 0x7A, 0x0E, 0x3B, 0x0B, 0xA2, 0x54, 0x8D, 0xFA, 0xD7, 0x2C, 0x9A, 0xF5, 0xD2, 0x5C,
-    0xBC, 0x89, 0x40, 0xF1, 0xF6, 0xEF, 0x59, 0x34, 0xEF, 0x65, 0xBA, 0x78, 0x13, 0xB1, 0x2E, 0x30,
-    0x83, 0x64, 0x1B, 0xD5, 0xC8, 0x1B, 0x0B, 0x97, 0x57, 0xB0, 0xBC, 0x42, 0x90, 0x6F, 0x12, 0x56,
-    0xEF, 0x45, 0x1C, 0xCF, 0x2A, 0x02, 0x67, 0x83, 0x94, 0x8B, 0x0E, 0x5A, 0x5A, 0x0E, 0x82, 0x66,
-    0x2D, 0xBC, 0x4C, 0x6A, 0xA6, 0xBA, 0xAC, 0xCD, 0x5D, 0x5E, 0x6B, 0xEC, 0x67, 0x93, 0x25, 0x3C,
-    0xE3, 0x3E, 0xEE, 0x95, 0x7E, 0x8C, 0xC8, 0x18, 0x46, 0x79, 0x7C, 0x33, 0x9C, 0xC2, 0x6C, 0xC0,
-    0x0A, 0x78, 0x3D, 0xA6, 0xE0, 0xF6, 0xD8, 0x82, 0x1F, 0x66, 0x6C, 0x0E, 0xA7, 0xD5, 0xE6, 0x53,
-    0x35, 0x4D, 0xBB, 0xA4, 0x43, 0x54, 0x98, 0xD1, 0x75, 0xEE, 0xE1, 0x3E, 0xEE, 0xE5, 0x7E, 0x1E,
-    0xE1, 0x31, 0x19, 0xE5, 0xF1, 0xEB, 0x61, 0xD6, 0x80, 0x15, 0xF0, 0x02, 0x66, 0xC0, 0x0D, 0xD8,
-    0x3D, 0x7E, 0x98, 0x71, 0xBD, 0x5F, 0xEC, 0x0C, 0x1F, 0x1E, 0xB6, 0xE8, 0x2D, 0x34, 0xA8, 0xA6,
-    0xE4, 0xA1, 0xA3, 0xF4, 0x2E, 0x74, 0xC7, 0x42, 0x63, 0xCC, 0x9F, 0x21, 0x49, 0x8D, 0x09, 0xF0,
-    0xE4, 0x6F, 0x20, 0xE4, 0x4C, 0x21, 0xC4, 0x06, 0x8E, 0xD3, 0x78, 0x53, 0xD8, 0xAC, 0x4E, 0x5D,
-    0x3C, 0x85, 0xEA, 0xBC, 0xF1, 0x3E, 0x38, 0xCF, 0x8D, 0xC2, 0x7B, 0xD2, 0xC5, 0xF3, 0x78, 0x9E,
-    0x40, 0x7D, 0x15, 0x1C, 0xEB, 0x26, 0xBD, 0x0F, 0xE2, 0xAC, 0x93, 0xE7, 0x29, 0x77, 0x74, 0x13,
-    0x42, 0x6E, 0xE3, 0x69, 0x8E, 0x90, 0x9C, 0x3A, 0xA6, 0x94, 0xDB, 0xB8, 0x8B, 0x70, 0x52, 0x78,
-    0xF8, 0x60, 0x72, 0x9B, 0x42, 0xD7, 0x52, 0x9C, 0x0C, 0x8D, 0xE2, 0xAE, 0x8A, 0x26, 0x95, 0xAD,
-    0xC0, 0x3F, 0x7C, 0xBD, 0x53, 0x3D, 0x0C, 0x3D, 0xEB, 0x71, 0xE7, 0xA3, 0x1D, 0x60, 0x4A, 0xE0,
-    0xB0, 0xCA, 0x31, 0x85, 0xA4, 0x13, 0x22, 0x9E, 0x98, 0xB2, 0xB6, 0x61, 0x95, 0x42, 0x56, 0xDC,
-    0x80, 0xDF, 0x66, 0x47, 0xAC, 0x38, 0xEE, 0x21, 0xF0, 0x0F, 0x15, 0x09, 0x40, 0xF8, 0x35, 0xB9,
-    0x54, 0x9C, 0x49, 0x93, 0xC3, 0x48, 0xB9, 0x66, 0x16, 0x86, 0x89, 0xAA, 0x6C, 0xFF, 0x43, 0x98,
-    0xE6, 0x3A, 0xA2, 0x43, 0xAF, 0xC4, 0x56, 0xCC, 0xF3, 0x07, 0x5A, 0x3C, 0x2F, 0xA2, 0x68, 0x30,
-    0x47, 0xA8, 0x50, 0x8E, 0xA4, 0x85, 0x8A, 0x76, 0x8C, 0xE0, 0x03, 0x87, 0x69, 0xAB, 0xBF, 0x5C,
-    0xAE, 0xEA, 0xEC, 0x4E, 0x87, 0x97, 0x54, 0x00, 0x62, 0x0E, 0x03, 0x4B, 0xE3, 0xFF, 0x00, 0x7B,
-    0xFC, 0x70, 0xCE, 0xE1, 0xCD, 0x49, 0x8C, 0x03, 0x68, 0x49, 0x0C, 0xBF, 0x07, 0xD1, 0x64, 0xC5,
-    0xDC, 0x59, 0x56, 0x94, 0xB1, 0xA9, 0xE6, 0x1D, 0xB7, 0x18, 0xA8, 0x76, 0x38, 0x54, 0xCE, 0x06,
-    0x39, 0x7B, 0x33, 0x48, 0x99, 0x76, 0xCD, 0x35, 0x89, 0x9B, 0xB5, 0x78, 0x00, 0x6C, 0x82, 0x6D,
-    0xF8, 0x36, 0x45, 0xFE, 0xB3, 0xD1, 0x55, 0x4C, 0x00, 0x8F, 0xAC, 0xEC, 0x51, 0xE5, 0xBF, 0x5E,
-    0x22, 0x3F, 0xDA, 0xE5, 0xE5, 0xD6, 0x30, 0xB6, 0x4D, 0x92, 0x52, 0xCE, 0xC0, 0xD4, 0x67, 0xF4,
-    0x33, 0x8F, 0xCC, 0x1A, 0x03, 0x67, 0x5D, 0x50, 0xD6, 0xEE, 0xF4, 0x60, 0x26, 0x9C, 0x3D, 0x73,
-    0xC2, 0x93, 0xD8, 0x70, 0xE4, 0x1C, 0xBC, 0x2F, 0x10, 0x67, 0xD4, 0x44, 0xB7, 0x1E, 0x33, 0xCC,
-    0x47, 0x87, 0xF7, 0x0D, 0xF4, 0xDF, 0xC2, 0xB8, 0xDB, 0xC0, 0xF0, 0x05, 0x0C, 0x2B, 0x0C, 0xA7,
-    0xA5, 0x42, 0xEB, 0x02, 0x7A, 0x30, 0xDB, 0xDD, 0x0A, 0x04, 0x06, 0x87, 0xA7, 0xFA, 0x70, 0xAB,
-    0x82, 0xF3, 0xF9, 0x49, 0x6A, 0xC5, 0x27, 0xE9, 0x1B, 0x37, 0xC4, 0x53, 0x15, 0x0F, 0x83, 0x93,
-    0x5C, 0xF3, 0xF3, 0x30, 0xA1, 0x3A, 0x08, 0x61, 0xFC, 0x3B, 0x2F, 0xD2, 0xD1, 0xF7, 0x7E, 0x27,
-    0xFF, 0x17, 0xD2, 0x7D, 0xC1, 0x7F, 0x49, 0xD9, 0xC9, 0x12, 0x3D, 0x39, 0xF3, 0x26, 0xBC, 0x41,
-    0x50, 0x3F, 0x56, 0x65, 0xFD, 0xC3, 0x71, 0xFD, 0x4B, 0x9D, 0x5E, 0x72, 0xF9, 0x6F, 0xF6, 0xDB,
-    0xEA, 0x9F, 0x57, 0x5B, 0xFD, 0xE0, 0xAB, 0xEE, 0x2C, 0xE4, 0x82, 0xFA, 0x35, 0x21, 0xA9, 0xA0,
-    0x62, 0x4A, 0x57, 0xBD, 0x6F, 0xF8, 0x1D, 0xE3, 0x4E, 0x3F, 0xB8, 0xD3, 0x69, 0x75, 0xC9, 0x65,
-    0x6F, 0xEF, 0xB7, 0x98, 0xBF, 0xFD, 0x03, 0xCC, 0x1F, 0xE8, 0x81, 0x3E, 0x68, 0x37, 0x84, 0x8C,
-    0xBD, 0xF0, 0xF5, 0xF2, 0x83, 0xB5, 0xF9, 0x98, 0xC0, 0x7B, 0xC4, 0x0A, 0xD0, 0xB0, 0xBB, 0xE3,
-    0xD3, 0x0A, 0xE9, 0xD8, 0xE6, 0x89, 0x87, 0xCF, 0x6C, 0x19, 0xCE, 0x84, 0x0E, 0x26, 0x9C, 0x15,
-    0xD5, 0x4F, 0x7D, 0xEE, 0x4F, 0x18, 0xF3, 0xBE, 0x79, 0x06, 0x1A, 0x67, 0x57, 0xDB, 0xC0, 0x04,
-    0xE5, 0xAD, 0x2D, 0x84, 0xF8, 0xE6, 0x0A, 0xB4, 0x19, 0x4F, 0xF5, 0xB4, 0x67, 0x0B, 0x59, 0x97,
-    0x67, 0xF8, 0x74, 0x34, 0xD0, 0xF9, 0x85, 0x60, 0x82, 0xF8, 0x42, 0x27, 0xD7, 0xFC, 0x01, 0xE7,
-    0x54, 0x86, 0x55, 0xD6, 0x22, 0x8F, 0x68, 0x61, 0xCD, 0x79, 0x9B, 0xCD, 0xD2, 0x19, 0x49, 0xCE,
-    0x36, 0x4D, 0x10, 0x11, 0xAC, 0x9A, 0x65, 0x2D, 0x62, 0x21, 0x0E, 0x72, 0xB6, 0xE6, 0x38, 0x28,
-    0xC2, 0x0B, 0x87, 0xE8, 0x28, 0x8D, 0x84, 0x1B, 0x6C, 0x2D, 0x89, 0x17, 0xA7, 0x89, 0x63, 0x99,
-    0x93, 0xE4, 0x8A, 0x7D, 0xAF, 0xE9, 0x5F, 0x20, 0xCB, 0x64, 0x4E, 0xE1, 0xC4, 0xC4, 0x00, 0xB3,
-    0xB2, 0x6F, 0xA8, 0xA1, 0x31, 0x3A, 0x6A, 0x96, 0x43, 0xE1, 0x48, 0x9E, 0xB2, 0xA2, 0x15, 0xAC,
-    0x4C, 0x6C, 0x9C, 0x95, 0xEB, 0xAD, 0xB4, 0xE8, 0x97, 0x92, 0x9C, 0x36, 0x6D, 0x8F, 0x4C, 0xE5,
-    0x6D, 0xAA, 0x19, 0xEF, 0x51, 0xCD, 0x79, 0x83, 0x6A, 0xC6, 0xBB, 0x03, 0xC4, 0x8E, 0xD2, 0x2E,
-    0x13, 0xC8, 0x7B, 0x19, 0x2F, 0x60, 0x06, 0x07, 0xCF, 0x7B, 0x41, 0x40, 0x03, 0xEF, 0x80, 0xD8,
-    0x05, 0xBC, 0x07, 0xB6, 0xC0, 0x10, 0x8E, 0xDD, 0x31, 0xF3, 0x80, 0xE0, 0x1C, 0xFA, 0xC1, 0x6C,
-    0x4F, 0x1E, 0xE5, 0x16, 0xB3, 0xC0, 0x18, 0x24, 0x04, 0x3E, 0xD5, 0xBC, 0x6F, 0x83, 0x43, 0xA6,
-    0x7F, 0x58, 0x0A, 0xC7, 0xDC, 0x81, 0x2B, 0x70, 0x87, 0x2C, 0x58, 0xDC, 0x27, 0x6E, 0x3F, 0x1D,
-    0x12, 0x63, 0xF0, 0xA5, 0xD9, 0x6D, 0x02, 0x32, 0x5F, 0x9C, 0x15, 0x07, 0x98, 0x75, 0x0C, 0x75,
-    0xCB, 0x82, 0xAC, 0x80, 0x21, 0x19, 0xBC, 0x65, 0xEE, 0x18, 0x5A, 0x66, 0x0A, 0xDC, 0x29, 0x79,
-    0x46, 0x41, 0xA8, 0x4B, 0x05, 0xD9, 0x11, 0xB8, 0x83, 0x03, 0x07, 0x47, 0x85, 0x63, 0xEE, 0xD0,
-    0xC6, 0x01, 0x81, 0x26, 0xB8, 0x0B, 0xCE, 0xF6, 0x75, 0xF6, 0x0E, 0xEC, 0xA4, 0xCA, 0x05, 0x30,
-    0xE2, 0xFD, 0x32, 0xBE, 0x0B, 0xC7, 0xFE, 0xA0, 0xA0, 0xDE, 0x0A, 0x90, 0x0B, 0xA0, 0x48, 0xBA,
-    0x23, 0xFB, 0x62, 0x57, 0xC1, 0x16, 0x43, 0x92, 0xE6, 0x48, 0x76, 0x93, 0xB0, 0x29, 0xB2, 0xF5,
-    0x90, 0xA4, 0x37, 0x72, 0x1B, 0xE5, 0x5B, 0x48, 0x48, 0xA0, 0xF4, 0x11, 0x4A, 0x7C, 0x39, 0x85,
-    0x56, 0x62, 0xDD, 0x9F, 0xFF, 0x17, 0x0A, 0x9B, 0xB8, 0xC2, 0xE3, 0x0A, 0x5A, 0xF8, 0x96, 0xC1,
-    0x74, 0x15, 0x48, 0x9F, 0x5B, 0x00, 0xCB, 0x00, 0x4B, 0x5F, 0xA3, 0x93, 0x83, 0x31, 0x82, 0x1D,
-    0xA4, 0x53, 0xB4, 0xF4, 0xE1, 0xCE, 0xB9, 0x9D, 0x45, 0x0C, 0xE2, 0x7B, 0x11, 0x7C, 0x95, 0xF6,
-    0xCD, 0x35, 0xB8, 0x71, 0x80, 0x6A, 0x15, 0x48, 0x9F, 0x8C, 0xE6, 0xBE, 0xF9, 0x98, 0xB3, 0x73,
-    0xEF, 0x22, 0xC4, 0x8C, 0x9D, 0xFE, 0x02, 0x03, 0xBF, 0x7F, 0x05, 0x7D, 0xE0, 0x14, 0x48, 0x11,
-    0x80, 0x7B, 0x1C, 0xE0, 0x51, 0x97, 0x00, 0xD4, 0x2C, 0x08, 0xF3, 0xE1, 0xEE, 0xEE, 0x1F, 0x82,
-    0xC3, 0x16, 0x77, 0x67, 0x69, 0x43, 0x7D, 0xD2, 0xE8, 0x77, 0xDE, 0x71, 0xD5, 0x37, 0x45, 0x2B,
-    0x8E, 0x19, 0x6C, 0xB2, 0xCB, 0x2C, 0xE0, 0x2E, 0x37, 0xD5, 0xDB, 0xEE, 0x75, 0xB8, 0x49, 0x71,
-    0x91, 0x8C, 0x8F, 0x73, 0xAD, 0x9A, 0xCA, 0x2D, 0x6E, 0x51, 0xCB, 0xCA, 0x60, 0x75, 0xC3, 0x97,
-    0xAF, 0xAA, 0xBC, 0x8E, 0x43, 0xC8, 0xCC, 0xD8, 0xD1, 0xAF, 0x97, 0x12, 0x60, 0xF6, 0xF8, 0x05,
-    0x7F, 0x33, 0x88, 0xBD, 0x59, 0xF3, 0x86, 0x6D, 0x0B, 0x31, 0x5A, 0xAC, 0x55, 0x1F, 0x46, 0xAB,
-    0xD3, 0x74, 0xE2, 0x22, 0x0A, 0xD0, 0xF1, 0xBD, 0x14, 0x97, 0x71, 0x36, 0xE7, 0x3A, 0x9E, 0x9B,
-    0x08, 0xAE, 0xA3, 0xE0, 0x80, 0xCF, 0x61, 0xB3, 0x1C, 0x22, 0xD6, 0x8B, 0x4A, 0xE1, 0x05, 0xE7,
-    0x65, 0x96, 0x3F, 0x4C, 0x5C, 0x84, 0xA9, 0xE0, 0x58, 0xDD, 0x1E, 0xE9, 0xA6, 0xA5, 0x11, 0x6B,
-    0x78, 0xBC, 0x14, 0x17, 0xD2, 0xA5, 0xD8, 0x90, 0xF7, 0xDB, 0xF9, 0xB8, 0xB7, 0x0B, 0x0E, 0x21,
-    0xED, 0x80, 0x7E, 0x9B, 0xC6, 0x77, 0x7D, 0x99, 0xEE, 0xC3, 0x15, 0x7D, 0x0A, 0x97, 0x6A, 0x96,
-    0x3E, 0x2C, 0x8D, 0x61, 0xBE, 0xB0, 0x2F, 0x93, 0x91, 0xBE, 0xDA, 0x64, 0x74, 0x31, 0x99, 0x15,
-    0x08, 0x41, 0x50, 0x97, 0x3D, 0xCA, 0x5B, 0x7A, 0x79, 0xF8, 0x5E, 0x14, 0x1C, 0x1A, 0x3B, 0x6E,
-    0xC9, 0x22, 0x6A, 0x82, 0xA0, 0xE8, 0xEC, 0x34, 0x44, 0xF1, 0x42, 0x32, 0x04, 0x04, 0xFC, 0x8F,
-    0xE4, 0xFC, 0xAC, 0xE4, 0x56, 0x63, 0x24, 0xA1, 0x97, 0xFE, 0x66, 0xD5, 0x97, 0x5F, 0xBA, 0xF4,
-    0xC1, 0x9D, 0x26, 0xFA, 0xEE, 0x5B, 0x43, 0x7A, 0xC6, 0xAA, 0x38, 0xE7, 0xFA, 0xC1, 0xD5, 0x83,
-    0x0F, 0x70, 0xF7, 0x44, 0xB2, 0xF4, 0x55, 0xAD, 0xFE, 0xFE, 0x57, 0x37, 0xBE, 0x71, 0xB7, 0x8E,
-    0xC6, 0xB5, 0xA1, 0xB5, 0xED, 0xA5, 0xAB, 0x49, 0xEF, 0xF0, 0xC5, 0xD9, 0x4B, 0x8B, 0x7A, 0xD6,
-    0xC5, 0xBB, 0xE8, 0xBA, 0xF7, 0xF8, 0xE2, 0x94, 0xC5, 0x21, 0x8B, 0x77, 0x5F, 0x94, 0xB9, 0x10,
-    0x30, 0x8F, 0x23, 0xD0, 0xA7, 0xF4, 0x7D, 0x52, 0x3F, 0xA4, 0xF5, 0x8B, 0xC4, 0xBE, 0x4F, 0xED,
-    0x17, 0xC9, 0x7D, 0x9F, 0xDE, 0x0F, 0x09, 0xFE, 0xE6, 0x11, 0x55, 0xD2, 0xB2, 0xAE, 0xC4, 0xFF,
-    0x15, 0x58, 0x88, 0xF2, 0xBF, 0xC4, 0x9F, 0x5B, 0xC0, 0xC7, 0xAB, 0xF2, 0xA1, 0x04, 0x19, 0x64,
-    0x83, 0xBC, 0xCD, 0x82, 0x6B, 0xC0, 0xD0, 0xB3, 0x8E, 0xD1, 0x73, 0xCF, 0xA6, 0x56, 0x3E, 0x12,
-    0x9E, 0xF8, 0xD3, 0x8B, 0xE1, 0x8D, 0x0F, 0xD4, 0x2A, 0x69, 0xB3, 0xC9, 0x55, 0x65, 0xD4, 0xAF,
-    0xFC, 0x6A, 0x70, 0x02, 0xF6, 0x51, 0x6A, 0xA1, 0xE7, 0x9C, 0x59, 0xA6, 0x56, 0x99, 0x6A, 0x95,
-    0x5A, 0xD4, 0x53, 0x33, 0xC3, 0x3E, 0x9E, 0x6C, 0xD6, 0xAB, 0x9C, 0x1D, 0xC5, 0x2A, 0x8E, 0xB9,
-    0xAB, 0xE5, 0xB2, 0xFE, 0x1C, 0x52, 0xA3, 0xE3, 0x9F, 0xCA, 0x62, 0xC5, 0xCC, 0x7C, 0x14, 0x83,
-    0xC9, 0xBD, 0xB4, 0x2D, 0xEC, 0x9E, 0x9A, 0x4A, 0xEB, 0x35, 0xDC, 0x91, 0x9A, 0x3E, 0xBC, 0x0C,
-    0x80, 0xB5, 0x7E, 0x5A, 0x84, 0x8F, 0xA8, 0x2B, 0x03, 0xEB, 0x40, 0xDE, 0x7E, 0x84, 0x40, 0x6E,
-    0xF6, 0xD8, 0x46, 0x8F, 0x4A, 0x6A, 0xDD, 0x14, 0x35, 0xF7, 0x15, 0xF5, 0xBA, 0x79, 0xBC, 0xA4,
-    0xB4, 0x2D, 0x1A, 0xFC, 0xC4, 0xDD, 0xAD, 0x1B, 0x5D, 0xF3, 0x9B, 0xB6, 0xA3, 0xA5, 0x91, 0xB3,
-    0x26, 0xD0, 0x09, 0x23, 0xD8, 0x91, 0x7F, 0xF7, 0x1F, 0xE1, 0x43, 0x4B, 0x62, 0x9F, 0xF3, 0x23,
-    0xD0, 0x95, 0x7A, 0xCC, 0xBF, 0xE6, 0xB9, 0x3E, 0xE6, 0x54, 0x73, 0x8D, 0x1C, 0x4D, 0xB9, 0xB4,
-    0x49, 0xEC, 0x71, 0x67, 0x85, 0x8F, 0x40, 0x91, 0x49, 0xEC, 0xB8, 0x56, 0x2E, 0x6B, 0x75, 0x57,
-    0xCD, 0x8F, 0x3F, 0x33, 0xC6, 0x5D, 0xE7, 0xFC, 0x9B, 0x37, 0x4F, 0x6D, 0x6C, 0x28, 0x77, 0xFC,
-    0x35, 0xB1, 0xC3, 0xF2, 0xDD, 0xF2, 0x45, 0x24, 0xF3, 0x3F, 0xED, 0x55, 0xB1, 0x92, 0xDC, 0x44,
-    0x10, 0x7D, 0xD2, 0xD8, 0x6C, 0x81, 0x82, 0x49, 0xD8, 0xC8, 0xB8, 0xC6, 0x01, 0x91, 0xAB, 0x28,
-    0x25, 0x04, 0xA6, 0xCA, 0xB7, 0x23, 0x4C, 0xE0, 0x74, 0x83, 0xDD, 0x72, 0x48, 0xBE, 0xC9, 0x3A,
-    0x20, 0x20, 0xA0, 0x56, 0xC2, 0x5F, 0xE0, 0x3F, 0xC0, 0x01, 0x01, 0x2C, 0x01, 0x64, 0x60, 0x0A,
-    0xAF, 0x84, 0xFD, 0x03, 0xB2, 0x13, 0x42, 0xA6, 0xEA, 0xCE, 0x89, 0x1D, 0xEC, 0x50, 0x0C, 0x94,
-    0x6C, 0x66, 0x35, 0xBC, 0xD1, 0x1D, 0xE7, 0xBB, 0xB3, 0x21, 0x21, 0x04, 0x4D, 0x3F, 0xED, 0x6A,
-    0xD4, 0x3D, 0xD3, 0xDD, 0xAF, 0x7B, 0x84, 0x71, 0x81, 0x34, 0x58, 0xC8, 0x5F, 0x3C, 0x54, 0xD3,
-    0x43, 0x37, 0x35, 0x51, 0x16, 0xBA, 0x3A, 0x03, 0xCE, 0xE5, 0x7C, 0x17, 0x75, 0xB2, 0xDF, 0x3D,
-    0x6D, 0x0C, 0x70, 0x1E, 0xC8, 0x1A, 0x69, 0xB2, 0x06, 0x18, 0x17, 0x65, 0x2B, 0x4F, 0x0F, 0x53,
-    0x76, 0xF3, 0x19, 0x92, 0x29, 0x30, 0xB2, 0x80, 0x24, 0x34, 0xF1, 0xAD, 0x45, 0xB2, 0x6F, 0x21,
-    0x1E, 0x58, 0x64, 0xC2, 0xE2, 0x22, 0x31, 0xF9, 0xEA, 0x79, 0x51, 0x86, 0xD0, 0x60, 0xE4, 0x00,
-    0x3E, 0xE3, 0xC2, 0x33, 0xA0, 0x0C, 0x38, 0xBA, 0xF2, 0x60, 0x29, 0x93, 0xB5, 0xBD, 0x8A, 0x9B,
-    0x57, 0x80, 0xF7, 0xBE, 0x84, 0x0E, 0xE6, 0x6D, 0xE9, 0x20, 0x3C, 0xE5, 0x63, 0xE1, 0xFD, 0xA8,
-    0xAB, 0x97, 0xD4, 0xA9, 0x30, 0x8D, 0x8E, 0x30, 0x1C, 0xF9, 0x63, 0xA7, 0xE0, 0x34, 0x8A, 0x15,
-    0xB0, 0x5A, 0x14, 0xF5, 0x53, 0xBB, 0x49, 0xBB, 0x4D, 0xE2, 0x57, 0x89, 0xD7, 0x51, 0x3A, 0xF9,
-    0xC0, 0x0A, 0x6E, 0xF8, 0x66, 0x5C, 0xBF, 0x0E, 0x3E, 0x04, 0xDF, 0xAF, 0x3B, 0x0B, 0x7B, 0x27,
-    0xA1, 0x6B, 0x2D, 0xA3, 0x82, 0x2C, 0x90, 0xD3, 0x18, 0xF0, 0x48, 0x3A, 0x08, 0x37, 0x04, 0x81,
-    0xB8, 0x3E, 0x44, 0xE8, 0x20, 0x4D, 0x8F, 0xBC, 0x29, 0x07, 0x28, 0xDB, 0x43, 0x06, 0x37, 0xE4,
-    0x24, 0x0D, 0x3B, 0xA8, 0x47, 0x01, 0xCC, 0x59, 0xA5, 0x99, 0x39, 0x8E, 0x42, 0x3D, 0xEE, 0x31,
-    0xA2, 0x0D, 0xC6, 0xB4, 0x9F, 0x21, 0x0B, 0x55, 0x7E, 0xDD, 0x94, 0xA9, 0xDB, 0x24, 0xDD, 0x06,
-    0x9E, 0xA2, 0xAF, 0x79, 0xD5, 0xFB, 0xE4, 0xCE, 0xB0, 0x55, 0xEA, 0xDE, 0x15, 0x76, 0x2F, 0x6B,
-    0x54, 0x3F, 0xE4, 0x2E, 0x5E, 0xEA, 0x34, 0xC6, 0xCB, 0x39, 0x53, 0x10, 0x8A, 0xCB, 0xF5, 0xBA,
-    0x38, 0xFB, 0x2E, 0x72, 0x32, 0x9E, 0x1F, 0xBD, 0x5F, 0xAF, 0x8B, 0xF8, 0x1B, 0x81, 0x13, 0xD7,
-    0xA9, 0xB9, 0x73, 0xF8, 0x24, 0x75, 0xB2, 0xCD, 0xE9, 0x67, 0x89, 0x1A, 0xFD, 0xD1, 0xA8, 0x39,
-    0x4A, 0xD0, 0xF7, 0x26, 0xB3, 0x89, 0xC7, 0x45, 0xA0, 0x40, 0xC7, 0x67, 0xD9, 0x8E, 0xAC, 0xE8,
-    0x52, 0x9F, 0x9C, 0x18, 0xA9, 0x4F, 0x3B, 0x61, 0x33, 0xA3, 0xAA, 0x7B, 0x30, 0x31, 0x45, 0xEF,
-    0xDF, 0x46, 0xF9, 0x33, 0x73, 0xE2, 0x6A, 0xE6, 0x89, 0x36, 0x11, 0xED, 0x19, 0x70, 0xAE, 0xEC,
-    0xB4, 0x19, 0xCF, 0xC6, 0x53, 0xFC, 0xCB, 0x1A, 0x8C, 0x34, 0x32, 0xC3, 0x3D, 0xCA, 0x0D, 0xAE,
-    0x6C, 0x80, 0xBF, 0x91, 0x71, 0x98, 0xEA, 0xC8, 0x02, 0x92, 0x39, 0x6B, 0xAA, 0x29, 0x33, 0xBB,
-    0x1A, 0xB9, 0xC9, 0x21, 0xB3, 0x99, 0x81, 0x6C, 0x30, 0x01, 0x63, 0x14, 0xED, 0x39, 0x85, 0xB7,
-    0x56, 0xEB, 0x1F, 0xC2, 0x50, 0x17, 0x51, 0x7F, 0x06, 0x15, 0x1A, 0x3D, 0xE8, 0xBF, 0x73, 0xA8,
-    0xAF, 0x5A, 0x11, 0x90, 0x2C, 0x0D, 0x04, 0x09, 0xF3, 0x37, 0x53, 0xEF, 0x44, 0xD7, 0x7F, 0xC8,
-    0x1A, 0x2C, 0x22, 0x67, 0xFF, 0xD7, 0xFC, 0x7F, 0xAE, 0xE6, 0x5F, 0x7B, 0x0E, 0xFD, 0x75, 0x3B,
-    0xC9, 0xCC, 0xEB, 0xB1, 0x9A, 0xAC, 0x0A, 0xB6, 0x1E, 0xD9, 0x1D, 0x25, 0xB3, 0xBD, 0xB2, 0xFA,
-    0xD7, 0xDD, 0x79, 0xD6, 0xF8, 0x5D, 0xA8, 0x6D, 0xA3, 0x85, 0xDD, 0x08, 0xD7, 0x0B, 0x17, 0x82,
-    0xDB, 0xC5, 0xC2, 0xE5, 0x9E, 0x97, 0xF4, 0xA7, 0x36, 0x0B, 0x2D, 0x13, 0x95, 0x6E, 0xA0, 0x9E,
-    0x1A, 0x1D, 0x13, 0xE5, 0x77, 0xA0, 0xEC, 0x86, 0xFB, 0xC0, 0xE2, 0x07, 0xEE, 0x50, 0xE7, 0xF2,
-    0x17, 0x8B, 0x2A, 0xEF, 0xCA, 0x8A, 0xD5, 0x88, 0xC4, 0x7F, 0x44, 0x36, 0x5B, 0x06, 0xC8, 0x43,
-    0x58, 0xD3, 0x93, 0x7D, 0xD6, 0x48, 0xB3, 0x23, 0x95, 0x75, 0x51, 0xEF, 0x87, 0x81, 0xBF, 0x37,
-    0x9E, 0x31, 0xFC, 0xEA, 0x1B, 0x69, 0x22, 0x9F, 0xC2, 0xCD, 0x6F, 0x0C, 0x5B, 0x0B, 0x77, 0x4F,
-    0x58, 0x2D, 0x5B, 0xC5, 0xA4, 0xCC, 0x86, 0x25, 0x14, 0x21, 0xFF, 0xC2, 0xA3, 0x03, 0xC8, 0x2D,
-    0x39, 0xB6, 0xE5, 0x8B, 0x1E, 0x7E, 0x19, 0x55, 0xE9, 0xF5, 0xB0, 0xC7, 0x4B, 0xF6, 0x0F, 0xD7,
-    0x95, 0x6C, 0x03, 0xF1, 0x1D, 0xFF, 0xB3, 0xBB, 0x7E, 0x62, 0x79, 0x6D, 0x5B, 0xC8, 0x3F, 0xD8,
-    0xE7, 0xFB, 0x9E, 0x3A, 0x5C, 0xDB, 0x94, 0x45, 0xED, 0x95, 0x39, 0xB4, 0x57, 0x67, 0xBF, 0x1F,
-    0xC7, 0xDF, 0x91, 0x9A, 0x4D, 0xB8, 0xB8, 0xD5, 0x5D, 0xB8, 0x8D, 0x7C, 0x1B, 0xEA, 0x2E, 0xFA,
-    0x74, 0xDF, 0x47, 0xAF, 0x2A, 0xC6, 0xC9, 0xB3, 0xE4, 0x1F, 0xEE, 0x83, 0x4E, 0xF4, 0x91, 0x8D,
-    0x32, 0x5C, 0x8B, 0x5B, 0x07, 0x58, 0x9E, 0x8C, 0xAB, 0x7D, 0xE5, 0xD9, 0x74, 0x1C, 0xD7, 0xE2,
-    0xDA, 0xE7, 0x58, 0xC6, 0xB3, 0xCC, 0xC6, 0xF9, 0x9C, 0xF1, 0xA8, 0xE6, 0x05, 0xF2, 0x66, 0x98,
-    0x73, 0x5C, 0x6B, 0xCB, 0xDD, 0x1E, 0x4E, 0x8F, 0xE3, 0xCF, 0xD9, 0xD6, 0x35, 0xE9, 0x4D, 0xBF,
-    0x87, 0xFA, 0xAC, 0xD9, 0x13, 0x8D, 0x4E, 0xA0, 0x0F, 0x78, 0x8E, 0xB0, 0x55, 0x5B, 0x28, 0x73,
-    0x55, 0x98, 0x3D, 0xD1, 0xC6, 0xF3, 0x82, 0x9C, 0xB7, 0xB1, 0xFF, 0xD4, 0x93, 0xD8, 0xFF, 0xB4,
-    0x7D, 0x85, 0xFC, 0xC6, 0x5E, 0x8A, 0x2C, 0xFD, 0x09, 0x95, 0x58, 0x31, 0x8C, 0xDD, 0xC6, 0x11,
-    0x1D, 0x92, 0x96, 0x98, 0xE4, 0x03, 0xA1, 0x0A, 0x5D, 0x52, 0x28, 0x31, 0x53, 0x0A, 0x8A, 0x24,
-    0xB6, 0x2E, 0xEE, 0xB4, 0x54, 0x9A, 0x14, 0x29, 0x7C, 0x85, 0xBE, 0x54, 0xB8, 0x50, 0x93, 0x4A,
-    0x45, 0xAE, 0x51, 0xE1, 0x42, 0x16, 0x29, 0x04, 0x70, 0x8A, 0x14, 0xB9, 0x22, 0xA9, 0xD2, 0xA8,
-    0x50, 0x93, 0x7F, 0x85, 0x1C, 0xC0, 0x85, 0x81, 0x58, 0x22, 0x4F, 0x87, 0x40, 0x40, 0x02, 0x04,
-    0xB4, 0x00, 0x47, 0x85, 0x0B, 0x51, 0x96, 0x94, 0x20, 0xA7, 0xE2, 0x68, 0x88, 0x8E, 0x79, 0x77,
-    0x24, 0x27, 0x6F, 0x66, 0xC9, 0xFF, 0xEF, 0x24, 0x25, 0xB1, 0x3F, 0xEE, 0xDE, 0xCE, 0xDF, 0x5D,
-    0x2E, 0x67, 0x67, 0xDE, 0xCE, 0xCC, 0x7E, 0x22, 0xFD, 0xAC, 0xF1, 0x3A, 0x91, 0xCB, 0x5C, 0x13,
-    0x05, 0x8D, 0xDF, 0x12, 0x45, 0xA5, 0xD7, 0x10, 0x99, 0xC2, 0x2D, 0x89, 0xB2, 0x5C, 0xA6, 0x58,
-    0xE4, 0xFC, 0xCA, 0x6C, 0x76, 0x8B, 0xF3, 0x8C, 0xB9, 0xC9, 0x72, 0xBF, 0xBF, 0xD8, 0x24, 0xB9,
-    0xD7, 0x51, 0x63, 0x0A, 0xC1, 0xA8, 0x02, 0x52, 0xD0, 0x0A, 0xBA, 0xFC, 0xBC, 0x9F, 0xC5, 0x58,
-    0x99, 0x19, 0x4F, 0x7E, 0xBF, 0x9F, 0xE2, 0x69, 0xE9, 0x3F, 0x80, 0x27, 0x15, 0x57, 0x14, 0xDF,
-    0x13, 0x25, 0x18, 0x23, 0x99, 0xA2, 0x73, 0x3E, 0x46, 0xF7, 0x56, 0x0A, 0xF8, 0x15, 0xE0, 0xC4,
-    0xEF, 0x63, 0xF2, 0x99, 0x4B, 0x4A, 0x38, 0x6B, 0x5D, 0xFE, 0x5B, 0xC0, 0x3E, 0xBF, 0x19, 0x72,
-    0xD0, 0x9E, 0x39, 0xC3, 0x51, 0x7B, 0x7A, 0xB9, 0x35, 0xCD, 0xF2, 0xF2, 0xAA, 0xA9, 0xDF, 0x7A,
-    0x97, 0x92, 0xFA, 0xEA, 0x55, 0x4A, 0xAA, 0x0F, 0x3E, 0x00, 0x54, 0x15, 0xBE, 0x56, 0x25, 0x99,
-    0xFA, 0x71, 0x41, 0x66, 0xF7, 0x41, 0x41, 0x51, 0xBF, 0x95, 0x53, 0xC0, 0x5B, 0xF9, 0xD1, 0x09,
-    0x6F, 0xA5, 0xA1, 0xC7, 0xCF, 0xCF, 0xF7, 0xF2, 0xCA, 0x96, 0x42, 0x59, 0x3E, 0x58, 0xFB, 0x03,
-    0xD1, 0x77, 0xDF, 0x84, 0x7A, 0x3F, 0x3C, 0x03, 0x38, 0x7D, 0x9A, 0x86, 0x8F, 0x93, 0xC1, 0x42,
-    0x98, 0xD2, 0x50, 0x56, 0x06, 0xBD, 0xCB, 0xB1, 0xC7, 0x7E, 0x8F, 0x3D, 0x06, 0x2D, 0x39, 0x6D,
-    0x08, 0x83, 0xAD, 0x47, 0xB0, 0x17, 0x5E, 0xA4, 0x30, 0x3D, 0x7F, 0xCB, 0xD4, 0xFC, 0xD7, 0x3E,
-    0xA9, 0xA3, 0x1D, 0x4E, 0xEA, 0xB0, 0xCE, 0x4C, 0x1D, 0x56, 0xEF, 0x02, 0xA0, 0x4B, 0x03, 0x88,
-    0x04, 0xC2, 0x16, 0x10, 0x74, 0x00, 0x9F, 0xC3, 0x72, 0xE2, 0xF1, 0x4E, 0x19, 0x11, 0xF3, 0x3F,
-    0x3A, 0x8A, 0xE4, 0x45, 0x70, 0x07, 0x76, 0x7E, 0x64, 0x15, 0x5D, 0x90, 0x04, 0x72, 0x9F, 0xE3,
-    0xB5, 0xDC, 0x63, 0x0A, 0x04, 0x26, 0x02, 0xBE, 0x80, 0x03, 0x6D, 0xC4, 0xA2, 0x2F, 0x03, 0x16,
-    0x19, 0xE0, 0xD0, 0x00, 0xB6, 0x1B, 0xCB, 0xA2, 0xE9, 0xAB, 0x4F, 0xC4, 0x32, 0xDA, 0x93, 0x8C,
-    0x8E, 0x3B, 0xF7, 0xB1, 0x00, 0xCC, 0x8E, 0xEF, 0x7C, 0x83, 0x53, 0x97, 0x41, 0x04, 0xB8, 0x4B,
-    0xBD, 0x9E, 0x88, 0xE3, 0x8E, 0x91, 0x87, 0x07, 0xA0, 0xAD, 0x58, 0x49, 0xE0, 0x14, 0xCF, 0x6E,
-    0x92, 0x11, 0x2E, 0x2D, 0x65, 0xCF, 0x56, 0x85, 0x44, 0xE8, 0xCB, 0xF6, 0x86, 0xBE, 0x53, 0xD9,
-    0xF6, 0x4D, 0xF4, 0x09, 0x99, 0x8C, 0x2C, 0xDF, 0xAD, 0xD2, 0x8F, 0xA0, 0xE4, 0xC5, 0x0A, 0xC6,
-    0xE5, 0x0A, 0x1B, 0xE7, 0xE2, 0x2C, 0x0C, 0x9D, 0x1E, 0x23, 0x3A, 0x4E, 0x87, 0x3F, 0xF5, 0xE8,
-    0x8B, 0x6A, 0x10, 0xBC, 0xD2, 0xB6, 0xC7, 0xBD, 0x4D, 0x28, 0x6E, 0x78, 0xC2, 0xBF, 0x16, 0xEE,
-    0x18, 0x36, 0x62, 0xAD, 0x18, 0xFB, 0xD9, 0x63, 0x7E, 0x0E, 0xFA, 0xB9, 0x5C, 0x18, 0x26, 0x2E,
-    0x20, 0xE4, 0x61, 0x07, 0x17, 0x42, 0x48, 0xE1, 0x3A, 0x15, 0x62, 0x08, 0xC9, 0x37, 0x17, 0xC2,
-    0x51, 0x88, 0x46, 0xC1, 0xA8, 0xE0, 0x71, 0x9A, 0xC1, 0x34, 0x60, 0x1E, 0x37, 0xD8, 0x4C, 0xC2,
-    0x10, 0x3A, 0x2B, 0xC0, 0x4A, 0xE5, 0xA8, 0x7A, 0x31, 0x9A, 0x37, 0x1F, 0x84, 0x20, 0x3D, 0xBC,
-    0x5B, 0x83, 0x0D, 0x18, 0x2E, 0x0D, 0xD4, 0x47, 0xE3, 0x70, 0x05, 0xA2, 0xC1, 0x07, 0x70, 0x06,
-    0xFE, 0x64, 0x9B, 0xD2, 0xB0, 0x36, 0xFB, 0x70, 0xA5, 0xF4, 0x63, 0x83, 0xD2, 0x64, 0x15, 0x9A,
-    0x4C, 0x4C, 0xC0, 0xD5, 0xD0, 0x50, 0x03, 0xEA, 0xC8, 0x98, 0xC7, 0xC5, 0x7C, 0x6C, 0xD6, 0xCF,
-    0xB2, 0xBE, 0xBF, 0x89, 0xC9, 0x61, 0xAB, 0xCB, 0x4E, 0xEC, 0xEA, 0x9E, 0x6D, 0x9C, 0xE1, 0x5D,
-    0x99, 0x6D, 0x4C, 0xA3, 0x0A, 0x04, 0x0D, 0xD4, 0x29, 0x68, 0x22, 0x0D, 0x36, 0x2B, 0x0D, 0xDF,
-    0xB2, 0xFA, 0x2A, 0x5F, 0x61, 0x88, 0xCD, 0xAC, 0xB2, 0xA1, 0x22, 0x6C, 0x6C, 0x0B, 0x9B, 0x69,
-    0x3B, 0xE9, 0x0E, 0xB7, 0x7E, 0xE7, 0xC4, 0xF6, 0xBB, 0x9F, 0x6A, 0xDB, 0x06, 0xA9, 0x9D, 0x1F,
-    0x69, 0x1B, 0x55, 0xD9, 0xA7, 0x68, 0x37, 0xB3, 0x87, 0x03, 0x63, 0x7D, 0xDB, 0xDE, 0xA4, 0x44,
-    0xC7, 0xE9, 0xEB, 0xB7, 0x39, 0xB6, 0x53, 0x28, 0x17, 0x0D, 0xAB, 0x61, 0x53, 0x23, 0xEA, 0x06,
-    0x3C, 0x58, 0xFD, 0x82, 0xF4, 0xFF, 0x6B, 0xB4, 0x3C, 0xB3, 0x75, 0x0F, 0xE8, 0x92, 0x34, 0xB6,
-    0x13, 0x5A, 0x75, 0xA3, 0x34, 0xE9, 0x47, 0xC9, 0x87, 0x03, 0xDE, 0x18, 0x25, 0x35, 0x9F, 0x4A,
-    0xE6, 0x39, 0x0F, 0xF3, 0x70, 0x5C, 0x62, 0x7D, 0xD6, 0xE9, 0xC9, 0xC4, 0x6A, 0x13, 0x48, 0xE7,
-    0x30, 0xFA, 0x69, 0x06, 0xA7, 0xC6, 0x64, 0xCF, 0x9A, 0x23, 0x91, 0x97, 0x58, 0x1F, 0x93, 0x50,
-    0xCC, 0x9B, 0x50, 0xCC, 0xB0, 0x38, 0x3C, 0x17, 0x6B, 0xEB, 0xF1, 0xCB, 0x41, 0x2A, 0xF8, 0x2E,
-    0x85, 0x24, 0x71, 0xC6, 0xC7, 0xC6, 0xB0, 0x5E, 0x4B, 0x1F, 0x4A, 0x6C, 0x96, 0x77, 0xB8, 0xB5,
-    0x1C, 0x2C, 0xD1, 0xC0, 0x6B, 0x21, 0x39, 0x8C, 0xE0, 0x70, 0xAF, 0xA7, 0x24, 0x36, 0x38, 0xD3,
-    0x60, 0xE3, 0xF3, 0x4E, 0xF6, 0x46, 0x27, 0xDA, 0x88, 0x9F, 0x8E, 0x34, 0xBB, 0xA0, 0xFB, 0xA5,
-    0xA3, 0xEB, 0x78, 0x71, 0x2C, 0x52, 0x50, 0x41, 0x4A, 0x3D, 0x09, 0x86, 0x35, 0x4D, 0x6A, 0xB5,
-    0x1B, 0x62, 0x9B, 0x87, 0x77, 0xA3, 0x0F, 0x1C, 0xF7, 0x61, 0x1B, 0x78, 0xD8, 0x74, 0x88, 0x40,
-    0x24, 0x44, 0xBF, 0xDE, 0x23, 0x20, 0x69, 0xEC, 0xFB, 0x88, 0x95, 0xC6, 0xA0, 0x4A, 0xCD, 0x14,
-    0x62, 0x73, 0xD0, 0xAE, 0xCA, 0xE2, 0x08, 0x01, 0xE0, 0x76, 0x3F, 0xDB, 0xE3, 0xED, 0x6C, 0x16,
-    0xEB, 0xD9, 0xD4, 0x68, 0xB6, 0xF4, 0x0E, 0x5F, 0x7A, 0x96, 0x3C, 0xBB, 0x3B, 0x95, 0xD8, 0xEE,
-    0xE7, 0x51, 0x79, 0x4D, 0x63, 0xD0, 0x24, 0x0D, 0xAA, 0x8F, 0xD5, 0xF8, 0x6F, 0xC7, 0x41, 0xDD,
-    0x68, 0x58, 0xF9, 0x0D, 0x08, 0xA7, 0xC7, 0x9F, 0x1F, 0x91, 0xDF, 0x59, 0x7A, 0xF5, 0x24, 0x4A,
-    0xE2, 0x93, 0xB4, 0x90, 0xD4, 0x61, 0xD0, 0xCE, 0x65, 0x3D, 0x50, 0xA6, 0xB1, 0x8E, 0x47, 0x26,
-    0xC3, 0x73, 0xD6, 0xCB, 0x81, 0x98, 0x4F, 0x23, 0x1C, 0x1C, 0x65, 0x0A, 0x39, 0x05, 0x31, 0x9A,
-    0xED, 0x0D, 0x44, 0x87, 0x02, 0x26, 0x8C, 0x2A, 0x6D, 0x82, 0xA1, 0xA9, 0x17, 0xCD, 0x3D, 0x0E,
-    0x9A, 0xAF, 0xDB, 0x08, 0xC9, 0xB4, 0x49, 0xF2, 0x83, 0x0D, 0xA2, 0xC2, 0x3D, 0x9E, 0x6D, 0x80,
-    0x0F, 0xF7, 0x58, 0x32, 0x9C, 0x36, 0xA2, 0xF4, 0xD2, 0x34, 0x56, 0xCE, 0x89, 0x7C, 0xC2, 0x6E,
-    0x63, 0x81, 0x9E, 0x06, 0x62, 0x77, 0xC6, 0x7B, 0x87, 0xFB, 0xB3, 0x1A, 0xE8, 0x73, 0x97, 0x15,
-    0x14, 0xF4, 0xEF, 0xA8, 0x87, 0xC4, 0x04, 0xA6, 0x72, 0x14, 0x65, 0x4E, 0x62, 0xB1, 0x7C, 0x05,
-    0xB5, 0xDF, 0x0C, 0x68, 0xBD, 0x8B, 0xF8, 0x88, 0x75, 0x4E, 0xC0, 0xAB, 0x3E, 0xF7, 0x46, 0xE8,
-    0xD8, 0x44, 0x78, 0xEF, 0x91, 0x97, 0x02, 0xB0, 0xF0, 0x10, 0xB1, 0xE4, 0xE8, 0x6C, 0x86, 0x08,
-    0x3F, 0x7C, 0xB2, 0x5D, 0xED, 0x86, 0xF5, 0x4A, 0x89, 0x79, 0x38, 0xB3, 0x84, 0xD8, 0x88, 0x75,
-    0x29, 0x28, 0x90, 0x13, 0xBE, 0x3D, 0x64, 0x96, 0xDE, 0x9E, 0xAB, 0xCA, 0x82, 0x2F, 0x5F, 0xFD,
-    0xA1, 0x2F, 0xB6, 0xB0, 0x48, 0x43, 0x43, 0x2A, 0xD1, 0xB3, 0x91, 0x23, 0xBF, 0x40, 0xEF, 0x8A,
-    0xA2, 0x5D, 0xBF, 0xB4, 0x2F, 0x72, 0x32, 0x79, 0xD0, 0xD1, 0xC7, 0x7E, 0xCA, 0x9D, 0x6D, 0x7A,
-    0x3C, 0xA0, 0xDB, 0x93, 0xFF, 0xCC, 0x5A, 0xA9, 0xD5, 0x46, 0x88, 0x8B, 0x66, 0x52, 0x68, 0x13,
-    0xE9, 0xAA, 0xC5, 0x1D, 0x35, 0xE4, 0x03, 0x21, 0xD7, 0x12, 0x3F, 0xEC, 0xA6, 0x17, 0x6C, 0x4C,
-    0x6C, 0xC7, 0x86, 0x78, 0x5F, 0x39, 0xC3, 0x0F, 0xD8, 0x3E, 0xC7, 0x76, 0x15, 0x8D, 0x06, 0xA0,
-    0x4B, 0xA7, 0x4D, 0xC0, 0x76, 0x69, 0x99, 0x8A, 0x17, 0x09, 0xDF, 0x24, 0x52, 0xD7, 0xBA, 0xA1,
-    0x4C, 0x8F, 0x53, 0x3C, 0xE1, 0x38, 0x51, 0xB6, 0xEB, 0xCA, 0x45, 0x16, 0x73, 0x79, 0xB9, 0xF8,
-    0x18, 0xF3, 0x7C, 0x45, 0xAF, 0xF8, 0x48, 0xF1, 0xE7, 0x40, 0x57, 0x0E, 0x7E, 0x29, 0x96, 0xE5,
-    0x1D, 0x7D, 0x9D, 0x55, 0xA1, 0x56, 0x93, 0x94, 0x5A, 0xA5, 0x3D, 0x46, 0x16, 0xE8, 0xC5, 0x82,
-    0xB4, 0xCE, 0xD6, 0x40, 0xB5, 0xA6, 0x68, 0x19, 0x4D, 0x14, 0x3B, 0xC5, 0x75, 0x7B, 0x32, 0x06,
-    0xAC, 0xAC, 0xA1, 0x53, 0xC5, 0xFC, 0x25, 0x9F, 0x7E, 0x38, 0x0A, 0xEE, 0x98, 0x5F, 0x29, 0x18,
-    0xB3, 0x94, 0x93, 0x0C, 0xB3, 0x8F, 0x32, 0x0F, 0x31, 0xCF, 0xFC, 0xB3, 0x1F, 0x3A, 0xAF, 0xFA,
-    0x6D, 0x30, 0x64, 0x62, 0x5B, 0x33, 0xCA, 0x27, 0xAC, 0xBD, 0x61, 0x62, 0x54, 0xB9, 0x43, 0x0D,
-    0x21, 0x2C, 0x8B, 0x55, 0x12, 0x06, 0xDA, 0x80, 0x0B, 0xE2, 0x0E, 0x92, 0x44, 0xB1, 0x85, 0x64,
-    0x97, 0x96, 0x18, 0xA7, 0x7D, 0x78, 0xD0, 0xB1, 0x92, 0x2B, 0xAC, 0x8C, 0x7F, 0xB1, 0xAE, 0x1C,
-    0x71, 0xD9, 0x13, 0x27, 0x79, 0x12, 0x02, 0x82, 0xC7, 0xAC, 0x05, 0xA4, 0xD7, 0x45, 0x39, 0xC7,
-    0x47, 0x37, 0x5A, 0x9A, 0xB4, 0x26, 0xE7, 0x34, 0xC2, 0x8C, 0xA0, 0x4E, 0x20, 0xAD, 0x48, 0xCE,
-    0x2A, 0x33, 0x8C, 0x5E, 0x0B, 0x50, 0xEC, 0x21, 0xA0, 0x22, 0x42, 0x67, 0x3B, 0x12, 0x13, 0xF7,
-    0x51, 0xF7, 0x75, 0xAE, 0x38, 0x8D, 0x87, 0x3D, 0xBB, 0xF3, 0xC2, 0xC7, 0x5B, 0x48, 0xFD, 0xBC,
-    0x18, 0xEA, 0xE6, 0x47, 0xA1, 0x9D, 0x5B, 0xAB, 0x19, 0xA5, 0xEF, 0xDC, 0x5C, 0x98, 0xD5, 0x15,
-    0xB5, 0x43, 0x31, 0xBD, 0xD9, 0x92, 0x24, 0x7A, 0x5E, 0x48, 0x15, 0xCF, 0x41, 0xBF, 0xDE, 0x10,
-    0xD0, 0xD1, 0x2D, 0xCC, 0x4B, 0x3E, 0x2B, 0xC5, 0x41, 0x12, 0x49, 0xED, 0xB3, 0x44, 0xC7, 0x24,
-    0xE7, 0x2C, 0x4B, 0xBA, 0xB9, 0x23, 0x99, 0x86, 0x03, 0x09, 0xCC, 0x99, 0x04, 0x78, 0x50, 0x29,
-    0xD8, 0xE9, 0x92, 0x2A, 0x7A, 0xBB, 0x31, 0xB5, 0xF1, 0xAA, 0xB0, 0xB9, 0xE3, 0x6A, 0x9E, 0x8D,
-    0x45, 0xB1, 0x63, 0xD0, 0xD3, 0x95, 0x5A, 0xDC, 0xAF, 0x91, 0x09, 0xFC, 0x06, 0xE0, 0x75, 0x81,
-    0xC4, 0x72, 0xA1, 0x73, 0xD4, 0x0F, 0x49, 0xDB, 0xA6, 0x6C, 0x87, 0x3F, 0x91, 0x84, 0x8D, 0xB3,
-    0xD1, 0xD2, 0x15, 0xDE, 0xBE, 0xDD, 0xA7, 0x96, 0xAA, 0x53, 0x7E, 0x76, 0x59, 0xD2, 0x2D, 0xF8,
-    0x4D, 0x56, 0xB6, 0xFD, 0x76, 0x8E, 0xCC, 0x97, 0x18, 0xFB, 0x09, 0x6A, 0x28, 0xD2, 0x6A, 0x8B,
-    0x6C, 0x21, 0xF0, 0x72, 0x08, 0x7B, 0x2D, 0x96, 0x34, 0x72, 0x71, 0x64, 0xA4, 0x53, 0x2E, 0x70,
-    0x4D, 0xD2, 0xD3, 0x44, 0x17, 0x35, 0x5F, 0x7E, 0xCE, 0x48, 0x64, 0x9B, 0x65, 0x56, 0x7A, 0xEC,
-    0x94, 0xA6, 0x98, 0xF4, 0x40, 0xD4, 0x6E, 0x4E, 0x79, 0x1C, 0xD9, 0x45, 0xE6, 0x9B, 0xE6, 0x15,
-    0xAC, 0x0F, 0x60, 0x83, 0x4D, 0xF7, 0xC0, 0x7D, 0xDE, 0x05, 0x3E, 0xE6, 0x32, 0xC2, 0x53, 0x5C,
-    0x84, 0x8A, 0x41, 0x2F, 0xE8, 0xB3, 0x20, 0x0A, 0x97, 0x52, 0x82, 0xC7, 0xAE, 0x60, 0xC8, 0x36,
-    0xD4, 0xF0, 0xAE, 0x68, 0xF5, 0x74, 0xA1, 0x1B, 0xAD, 0x5B, 0x9A, 0x5B, 0x8E, 0x5B, 0xD7, 0x1B,
-    0xCB, 0x85, 0xC4, 0x92, 0xE3, 0x4F, 0x96, 0x2D, 0xFF, 0x56, 0xFA, 0x38, 0x5F, 0x28, 0xF5, 0xDD,
-    0x52, 0x59, 0xEC, 0x15, 0xBA, 0x59, 0x3F, 0x07, 0xFD, 0xE9, 0xCA, 0xED, 0x6D, 0xDE, 0x9B, 0xD9,
-    0xE8, 0xC0, 0xE9, 0xD2, 0xDA, 0x34, 0xD9, 0xC5, 0x1D, 0x29, 0x22, 0xAD, 0x9A, 0xCE, 0x91, 0x38,
-    0xD3, 0x8E, 0x8D, 0x53, 0x10, 0xD0, 0x84, 0x05, 0x4E, 0xAD, 0xD4, 0x74, 0x2B, 0x29, 0x35, 0x25,
-    0x2F, 0x4B, 0xCA, 0x9B, 0x54, 0x1A, 0x23, 0x32, 0xA9, 0x6B, 0xC0, 0x6B, 0x54, 0x08, 0x8B, 0x0A,
-    0x7E, 0xA2, 0xD9, 0x3E, 0xD3, 0x4C, 0xC2, 0x29, 0x4E, 0xAF, 0xDC, 0x20, 0x4A, 0x39, 0x33, 0x81,
-    0x16, 0x95, 0x20, 0x06, 0x6A, 0x6D, 0xBB, 0x25, 0x24, 0xF1, 0xA5, 0xE9, 0x45, 0xEC, 0x5A, 0xD3,
-    0x34, 0x9D, 0xDA, 0x60, 0xDE, 0x26, 0xB9, 0x8F, 0x48, 0xA0, 0xE4, 0x6E, 0x3A, 0xF4, 0x47, 0xD0,
-    0x7C, 0x46, 0x1A, 0xF8, 0x48, 0x38, 0x1A, 0x8B, 0xBA, 0xD0, 0x08, 0x65, 0xA1, 0x12, 0x4E, 0xD0,
-    0x93, 0x93, 0x28, 0x57, 0x02, 0xB1, 0x52, 0xB2, 0x2F, 0x3E, 0xF7, 0x6D, 0xD0, 0x3A, 0xA2, 0xD1,
-    0xC0, 0xCB, 0x07, 0xD0, 0xBB, 0x55, 0x20, 0x49, 0x39, 0x79, 0xF2, 0xA8, 0x77, 0xF8, 0x97, 0x5B,
-    0x38, 0xDE, 0x1E, 0x12, 0x6A, 0xE7, 0x6D, 0xB6, 0xB8, 0x4C, 0xE6, 0xEB, 0x11, 0x00, 0x9E, 0x3C,
-    0x0C, 0xF5, 0x1C, 0x0E, 0x0F, 0xE8, 0xE4, 0x50, 0x20, 0xE8, 0x01, 0x28, 0x86, 0xF2, 0x89, 0x8B,
-    0x1B, 0x5F, 0x44, 0xD9, 0xFE, 0xDF, 0x17, 0x77, 0xAB, 0xF5, 0xA1, 0x08, 0x57, 0x35, 0xDC, 0x14,
-    0xAA, 0xE3, 0xD0, 0x04, 0xED, 0xE4, 0xF5, 0x20, 0xD4, 0x6F, 0x35, 0x37, 0xFC, 0xD7, 0x29, 0xFF,
-    0x0F, 0x74, 0x79, 0x24, 0x3D, 0xEC, 0x88, 0x2F, 0x08, 0x74, 0x72, 0x03, 0x69, 0xE7, 0xF6, 0x18,
-    0x1C, 0x25, 0x7E, 0xF2, 0x10, 0x93, 0x52, 0xD4, 0x5E, 0x28, 0xEA, 0x24, 0xA7, 0x02, 0x4C, 0x8C,
-    0x30, 0x73, 0x5C, 0x6D, 0x6D, 0x8B, 0x56, 0x5F, 0x98, 0xE9, 0xEA, 0x79, 0xCE, 0xA4, 0xEE, 0x0C,
-    0xC5, 0x45, 0x8E, 0x06, 0xF9, 0x89, 0x90, 0x4C, 0xCB, 0x5D, 0x84, 0xBD, 0xF0, 0xD1, 0xF5, 0xB0,
-    0x3C, 0xF7, 0xD5, 0xCE, 0xE5, 0xE2, 0xAD, 0x17, 0xF7, 0x2F, 0xE7, 0xCB, 0x4F, 0xEE, 0xAF, 0xA5,
-    0x67, 0x9F, 0xDC, 0x07, 0x03, 0xF6, 0x77, 0xDA, 0x61, 0x81, 0x17, 0x9F, 0x41, 0x81, 0x27, 0xF7,
-    0x01, 0x9F, 0xDF, 0xD7, 0xB4, 0xCA, 0x95, 0xC2, 0xD2, 0x74, 0x3A, 0x5D, 0x55, 0xCD, 0x4E, 0x49,
-    0xCA, 0xB7, 0x03, 0x0F, 0xF9, 0x72, 0x75, 0x0E, 0xFE, 0xA9, 0x56, 0x70, 0x20, 0xAB, 0x65, 0x70,
-    0xC9, 0x02, 0xBD, 0xFE, 0x0E, 0xFA, 0xBF, 0xC0, 0xB7, 0xF7, 0x4D, 0xBD, 0xC8, 0x34, 0x4A, 0x76,
-    0xB5, 0x33, 0x02, 0x80, 0xDD, 0xA6, 0x4E, 0x01, 0xF1, 0x2E, 0xF1, 0xEF, 0xEC, 0xC0, 0x95, 0x0D,
-    0x61, 0xA3, 0xF4, 0xD9, 0x51, 0xC9, 0xC3, 0xDF, 0x93, 0x14, 0x28, 0x55, 0x31, 0x69, 0x72, 0xD6,
-    0xB3, 0xA8, 0x83, 0x13, 0x59, 0xDD, 0xB3, 0xB6, 0x28, 0xC7, 0x54, 0xA9, 0xC3, 0x91, 0x1D, 0xAE,
-    0x84, 0x7A, 0x5A, 0x91, 0xD8, 0x1A, 0x78, 0x9C, 0x97, 0x2B, 0xE0, 0x02, 0xCA, 0xF7, 0x24, 0x2E,
-    0x4A, 0x27, 0xEB, 0x0F, 0x1A, 0xC5, 0x31, 0xCC, 0x43, 0xDF, 0x1D, 0xDC, 0xD4, 0x69, 0x55, 0x32,
-    0xA2, 0x5A, 0x39, 0xC2, 0x69, 0xCB, 0xEF, 0x4A, 0x79, 0xBE, 0xCA, 0xF9, 0x1A, 0xEA, 0x9F, 0xDC,
-    0x13, 0xD7, 0xB9, 0xD5, 0x08, 0x9E, 0x42, 0x81, 0xC9, 0x21, 0xD2, 0x12, 0x6B, 0xF8, 0x1D, 0x53,
-    0xEC, 0x44, 0x43, 0x88, 0x6A, 0x44, 0x2B, 0x6B, 0x42, 0x84, 0x6B, 0x72, 0x19, 0xA2, 0x6B, 0xDE,
-    0x9F, 0x67, 0xF0, 0xC5, 0x06, 0xDB, 0x72, 0x42, 0x92, 0x19, 0xF7, 0x33, 0x24, 0xC1, 0x4B, 0x60,
-    0x38, 0x94, 0x01, 0xBB, 0xE3, 0x11, 0xFF, 0xF2, 0x83, 0x40, 0xD4, 0x7B, 0x4F, 0x91, 0xAF, 0x63,
-    0xD7, 0x2F, 0x24, 0x3D, 0x06, 0x9B, 0x5B, 0x12, 0x00, 0x73, 0x07, 0xCB, 0xF5, 0x1A, 0x77, 0xFF,
-    0x58, 0xD2, 0xB7, 0xF4, 0xFE, 0x7C, 0x56, 0x2A, 0x05, 0xBA, 0xAB, 0x55, 0x43, 0xAF, 0xEF, 0x6F,
-    0xE7, 0x75, 0x04, 0x2D, 0x69, 0x2E, 0xB3, 0xB9, 0x2D, 0x7E, 0x19, 0xD7, 0x7E, 0xAB, 0xD3, 0xF5,
-    0x92, 0xA2, 0xBF, 0x2D, 0xF4, 0xC1, 0xCF, 0xC0, 0xE9, 0x26, 0xF8, 0x09, 0x2A, 0xFE, 0x2A, 0x88,
-    0x91, 0x78, 0x81, 0x59, 0x6E, 0xCA, 0x20, 0x4E, 0x72, 0x53, 0x04, 0x28, 0xB1, 0x2D, 0x26, 0x82,
-    0x25, 0xD8, 0xFC, 0x8D, 0x10, 0xE1, 0x6C, 0x5D, 0x0D, 0x00, 0x57, 0xDE, 0x90, 0x20, 0x9D, 0x26,
-    0x28, 0x2C, 0x52, 0x53, 0x03, 0xA4, 0x70, 0x4D, 0xA3, 0x76, 0x2E, 0x09, 0x18, 0x19, 0x4D, 0x4A,
-    0x97, 0xDF, 0xD7, 0x18, 0xD8, 0xD3, 0x8F, 0x79, 0x7B, 0xDD, 0x66, 0x63, 0x77, 0xA8, 0x80, 0x52,
-    0x9B, 0x74, 0x16, 0x7D, 0x0A, 0xDE, 0x90, 0x8D, 0xD2, 0x31, 0x25, 0xAD, 0x2A, 0xF5, 0xAB, 0x6A,
-    0x81, 0x5F, 0x56, 0xCA, 0x9B, 0x5E, 0x58, 0xBB, 0x07, 0xFA, 0xB8, 0x5D, 0xF5, 0x15, 0x82, 0x5C,
-    0x5D, 0x7D, 0x21, 0xD7, 0xA6, 0x4A, 0x6E, 0x3A, 0x45, 0x55, 0x19, 0xB0, 0x41, 0x30, 0x11, 0x84,
-    0x0D, 0xAA, 0xF2, 0x0C, 0xD9, 0x92, 0xE9, 0x20, 0x9A, 0x03, 0x18, 0x16, 0xE3, 0xF5, 0x04, 0x6A,
-    0x68, 0x18, 0x76, 0x34, 0xA3, 0x5C, 0x61, 0x1C, 0x3B, 0x5B, 0x92, 0x1E, 0x42, 0x5A, 0x59, 0x26,
-    0x0B, 0xD9, 0xF0, 0x8B, 0x19, 0x2E, 0x6B, 0xED, 0x5A, 0x03, 0x37, 0x20, 0xE2, 0x06, 0x8D, 0x44,
-    0xF6, 0xC6, 0xEB, 0xE7, 0xD0, 0xD9, 0x02, 0x0D, 0xA3, 0x98, 0xA2, 0x77, 0x06, 0x89, 0xC3, 0x41,
-    0x7F, 0xBB, 0x1E, 0x07, 0x24, 0x23, 0xC0, 0x7A, 0x00, 0x14, 0x59, 0x07, 0x41, 0xFB, 0x74, 0xD4,
-    0x06, 0xC1, 0x5A, 0x20, 0x3D, 0xA0, 0x01, 0x9D, 0x3C, 0x49, 0xF3, 0xDF, 0x10, 0x51, 0x9C, 0x34,
-    0x12, 0xED, 0xA2, 0xDA, 0xEB, 0x4C, 0xE5, 0xB5, 0xF0, 0xC3, 0x53, 0xA9, 0x0F, 0xB4, 0x46, 0x18,
-    0xFE, 0xC7, 0xEF, 0x72, 0x99, 0xC5, 0x2D, 0xE4, 0x0D, 0x54, 0x1D, 0x67, 0x02, 0xD4, 0x43, 0xFA,
-    0x4B, 0x95, 0x64, 0x02, 0x67, 0x75, 0x5E, 0x44, 0x21, 0x24, 0xB4, 0xE3, 0xFF, 0x7F, 0x00, 0x63,
-    0x60, 0x60, 0x60, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x0E, 0x0D, 0x0D, 0x0D, 0x01, 0x00, 0xBD,
-    0x94, 0x31, 0x6E, 0xDB, 0x30, 0x14, 0x86, 0x9F, 0x24, 0x14, 0x1A, 0x3C, 0x68, 0x4A, 0x86, 0x2C,
-    0x3A, 0x02, 0x2F, 0x50, 0x40, 0x74, 0xCE, 0x10, 0xB7, 0x45, 0x7B, 0x83, 0x2C, 0x3E, 0x02, 0x85,
-    0x9E, 0x20, 0xBD, 0x43, 0x3B, 0x24, 0x67, 0x08, 0x20, 0xA6, 0xBD, 0x80, 0x33, 0x78, 0xF7, 0xD6,
-    0xD5, 0x83, 0x51, 0x38, 0x89, 0xA8, 0x3F, 0xFF, 0x23, 0x25, 0xA3, 0x6D, 0xC6, 0x18, 0x11, 0x84,
-    0xF7, 0x3F, 0x5B, 0x14, 0xF9, 0xF1, 0xFD, 0x8F, 0x12, 0x79, 0x27, 0x72, 0x79, 0x25, 0x25, 0x76,
-    0x33, 0x04, 0x31, 0x4F, 0xC1, 0xFC, 0x86, 0xB8, 0xFB, 0xE0, 0xEE, 0x20, 0xF0, 0x3D, 0xFC, 0x9E,
-    0x62, 0xD1, 0x0A, 0x25, 0xA3, 0x64, 0x49, 0x1A, 0xE8, 0xE5, 0x47, 0x39, 0xC5, 0xFA, 0x33, 0xD6,
-    0x36, 0xFB, 0x67, 0xC8, 0x71, 0x24, 0xC7, 0xAA, 0x80, 0x17, 0x07, 0x70, 0x2D, 0x4B, 0xE1, 0x4D,
-    0x98, 0xD3, 0x1B, 0x2B, 0x7C, 0x86, 0x5E, 0xA4, 0x7E, 0x58, 0x42, 0xA4, 0xD9, 0xCC, 0x18, 0x3B,
-    0x5F, 0x0C, 0x4A, 0x5A, 0xEC, 0x35, 0x8A, 0x8C, 0x31, 0x62, 0xB6, 0x29, 0x92, 0xF5, 0x03, 0xDA,
-    0x34, 0xFB, 0xEB, 0x63, 0xC2, 0x8B, 0x74, 0x21, 0xC2, 0x05, 0xB2, 0x5D, 0x2F, 0x22, 0x1B, 0x39,
-    0x95, 0xAD, 0x8D, 0x6C, 0xAD, 0xB2, 0x31, 0xC2, 0xE7, 0x31, 0x1E, 0x66, 0x20, 0xD5, 0xDD, 0x14,
-    0xC9, 0x36, 0x3F, 0x3E, 0xDB, 0x60, 0x94, 0x6D, 0x68, 0x94, 0x8D, 0x6E, 0x9F, 0x5D, 0xB3, 0x74,
-    0xF4, 0xBB, 0x88, 0xD5, 0xA3, 0xE3, 0x84, 0x64, 0xD1, 0xE8, 0x79, 0xB3, 0xAA, 0x20, 0xC9, 0xF5,
-    0x32, 0x96, 0x91, 0xBE, 0x17, 0xBB, 0xC9, 0x79, 0x99, 0x2C, 0x19, 0xEB, 0xC9, 0xCB, 0x1E, 0x92,
-    0x58, 0xD5, 0xF5, 0x47, 0xD8, 0x69, 0xE9, 0x37, 0x48, 0xC6, 0x0D, 0x4E, 0xF5, 0x1F, 0x1C, 0xFA,
-    0xD4, 0x1F, 0x4E, 0x37, 0xB6, 0xB0, 0x72, 0xF6, 0x83, 0x46, 0xCC, 0xB0, 0x2F, 0x95, 0x50, 0xCC,
-    0x9F, 0x60, 0x68, 0x87, 0x15, 0xE7, 0x83, 0x5B, 0x95, 0x4C, 0xE0, 0x6F, 0xF5, 0x75, 0x4D, 0x24,
-    0xCE, 0x2C, 0x2F, 0xD6, 0x4A, 0x1B, 0xFC, 0x3A, 0x25, 0x3F, 0xA7, 0x9D, 0x9E, 0xBF, 0xD5, 0x4E,
-    0xF3, 0xFF, 0x77, 0x1A, 0x1A, 0xBD, 0xFB, 0x43, 0xC2, 0xE3, 0xFB, 0x5D, 0x1B, 0x7D, 0x06, 0xAC,
-    0xD4, 0x9A, 0xDD, 0x92, 0x7F, 0xB1, 0xD9, 0x4A, 0x68, 0xF7, 0xB7, 0x05, 0xD4, 0x37, 0xAB, 0x92,
-    0x1F, 0xA4, 0x4C, 0x62, 0x00, 0x95, 0x2E, 0xC9, 0x17, 0x2C, 0xFE, 0x1A, 0x72, 0x3C, 0x89, 0xE0,
-    0x6B, 0x5D, 0x65, 0x4E, 0x1B, 0x10, 0x4F, 0xB1, 0x02, 0x4B, 0x66, 0x35, 0xDC, 0x5C, 0x69, 0x6E,
-    0xD4, 0x21, 0x62, 0x7F, 0xEB, 0xB6, 0x94, 0x41, 0x0C, 0x0F, 0x70, 0x16, 0xA4, 0xA2, 0xE4, 0x49,
-    0xC6, 0x5F, 0x19, 0xF4, 0x19, 0x4F, 0xD7, 0xBC, 0x43, 0x5F, 0x3F, 0xE2, 0x17, 0xBB, 0xB8, 0x69,
-    0x9B, 0xFB, 0x65, 0xB8, 0x70, 0xB6, 0xF6, 0xF5, 0x5E, 0x3A, 0x5B, 0xB5, 0x2A, 0xAC, 0x06, 0xC5,
-    0x85, 0x28, 0x0D, 0x36, 0x2A, 0x35, 0x06, 0x15, 0xBE, 0xAE, 0x23, 0xB9, 0xEA, 0xA6, 0x8E, 0x73,
-    0x6E, 0x29, 0xEF, 0xC5, 0xA8, 0x70, 0x99, 0x6D, 0xDD, 0x13, 0xA1, 0xDA, 0x54, 0xBD, 0xB0, 0x48,
-    0xBE, 0xC2, 0x27, 0xF7, 0x08, 0xCB, 0xEF, 0x23, 0x7B, 0x89, 0xEF, 0xF6, 0x72, 0x22, 0x7A, 0x92,
-    0x9E, 0x01, 0x4D, 0x8F, 0xD1, 0x0D, 0xC3, 0x20, 0x0C, 0x44, 0x51, 0x19, 0xC0, 0x03, 0xF4, 0x83,
-    0x11, 0x18, 0xC1, 0x8C, 0xD0, 0x8D, 0x32, 0x59, 0x05, 0x23, 0x30, 0x42, 0x46, 0xE0, 0x83, 0x4A,
-    0xE9, 0x07, 0xBD, 0x1E, 0x46, 0x89, 0xE2, 0x9F, 0xB3, 0xEC, 0x67, 0xDD, 0xD9, 0xB9, 0xAB, 0x7C,
-    0x5A, 0x2A, 0x75, 0xA9, 0xF6, 0xA5, 0x18, 0x6B, 0x0D, 0x18, 0x20, 0x80, 0x01, 0xFA, 0x7A, 0x1A,
-    0x70, 0x38, 0xF7, 0x9E, 0xEB, 0x26, 0x45, 0x09, 0x48, 0x93, 0x3D, 0x10, 0xD0, 0x23, 0x34, 0x21,
-    0x00, 0x60, 0x97, 0x31, 0xAF, 0x51, 0x05, 0x89, 0xD7, 0x28, 0x11, 0x55, 0xA9, 0x69, 0x43, 0xA7,
-    0x8E, 0x07, 0xD0, 0x39, 0x6F, 0x81, 0x08, 0xB9, 0xB6, 0x4D, 0x27, 0xCE, 0xF2, 0x74, 0x56, 0xFC,
-    0xD8, 0x9A, 0xAD, 0x19, 0x7B, 0x7C, 0xB3, 0x05, 0x41, 0x8D, 0x16, 0x4C, 0x4B, 0xEC, 0x2B, 0x76,
-    0xB4, 0x5C, 0xFE, 0x93, 0xD3, 0x3D, 0xF7, 0xF5, 0xC7, 0xF9, 0xD7, 0xF9, 0xA7, 0xD5, 0x1F,
+static const uint8_t notoserif_16_boldBitmaps[40518] = {
+    0xBD, 0x5A, 0xBF, 0xB3, 0xDD, 0xC4, 0x15, 0x5E, 0x5D, 0x61, 0x2B, 0x13, 0x15, 0xA2, 0x00, 0x27,
+    0xC1, 0x13, 0xD4, 0xA4, 0x22, 0x09, 0x6A, 0x53, 0xE0, 0x27, 0x19, 0x0A, 0x0A, 0x0A, 0x5E, 0xC1,
+    0x23, 0x33, 0x69, 0x9C, 0x22, 0x45, 0x42, 0xE3, 0x36, 0x05, 0xB0, 0x82, 0x14, 0x14, 0x69, 0x3C,
+    0x99, 0xC9, 0x9F, 0xC0, 0x4C, 0x78, 0x14, 0x6E, 0x52, 0x38, 0x99, 0x07, 0x12, 0x50, 0x50, 0x50,
+    0x20, 0x33, 0xC3, 0x50, 0xA2, 0x99, 0x40, 0x98, 0x90, 0x02, 0x25, 0x08, 0x90, 0xDF, 0x93, 0xB4,
+    0xF9, 0xBE, 0x6F, 0x75, 0xEF, 0xBB, 0xCF, 0x36, 0x60, 0x13, 0xC3, 0xF3, 0xD5, 0xD9, 0x7B, 0xA5,
+    0xDD, 0xD5, 0xD9, 0xF3, 0xE3, 0x3B, 0xE7, 0xEC, 0xDA, 0x76, 0x16, 0xFF, 0x72, 0xFE, 0x6B, 0xF3,
+    0x36, 0x6B, 0xF8, 0x2F, 0xAD, 0xD3, 0x3A, 0xE1, 0xBF, 0x32, 0x29, 0x4F, 0x19, 0xFE, 0xA5, 0x4D,
+    0xAE, 0x5E, 0x59, 0x13, 0xE0, 0xD7, 0x5D, 0xC6, 0x3C, 0x63, 0xC2, 0xD1, 0xA4, 0x9D, 0xB1, 0xB5,
+    0x71, 0x45, 0xE8, 0x4C, 0x34, 0x99, 0x64, 0xE4, 0x27, 0x1B, 0x4C, 0xD6, 0x9B, 0xFC, 0x66, 0x1F,
+    0x3C, 0x4A, 0x87, 0xA5, 0x1B, 0xFA, 0xAF, 0x9C, 0xC1, 0x58, 0x93, 0xD7, 0x26, 0xE9, 0xCC, 0x6A,
+    0xE4, 0x9C, 0xE6, 0xAE, 0xD2, 0x98, 0xC1, 0x98, 0xAA, 0x30, 0x59, 0x6B, 0xE2, 0xC1, 0x84, 0xB3,
+    0x09, 0xD8, 0xAD, 0x36, 0x55, 0x6D, 0x6C, 0x6B, 0x6C, 0x67, 0xF2, 0xEE, 0x66, 0xB3, 0xEB, 0x3E,
+    0x9E, 0x56, 0x2D, 0x3B, 0xBB, 0x12, 0x93, 0x87, 0x60, 0x09, 0xCC, 0x34, 0x7C, 0x49, 0x6F, 0x4C,
+    0xB1, 0x5E, 0x47, 0xDE, 0x67, 0x7D, 0xDC, 0xAF, 0xBA, 0x55, 0x1B, 0xD7, 0xD6, 0xFC, 0x15, 0x77,
+    0x73, 0xD7, 0xE4, 0xAE, 0xC5, 0xE7, 0x81, 0xFD, 0x4B, 0xF8, 0x55, 0x56, 0x8D, 0x6B, 0xAB, 0x16,
+    0x8C, 0x2D, 0x7F, 0xD9, 0x8C, 0xC1, 0xCE, 0xB5, 0x60, 0x07, 0x33, 0xC6, 0x23, 0x67, 0xEE, 0xB1,
+    0xE8, 0xAC, 0xC3, 0x6B, 0xF2, 0x2E, 0x70, 0x05, 0x49, 0x49, 0x52, 0x8B, 0x80, 0x91, 0x9B, 0x93,
+    0x4D, 0x17, 0x75, 0x2E, 0x34, 0x81, 0xA6, 0x4A, 0x06, 0x4C, 0x1A, 0x4E, 0x58, 0x72, 0xE0, 0x5C,
+    0x87, 0x57, 0x3A, 0x48, 0xC2, 0xEC, 0xE2, 0xE2, 0xFA, 0x4D, 0x4C, 0x62, 0x41, 0x4E, 0x3B, 0x90,
+    0xFC, 0x53, 0x92, 0x37, 0x40, 0xEE, 0x0F, 0xF9, 0xE0, 0xCE, 0x90, 0xC8, 0xF1, 0xC2, 0xFC, 0x31,
+    0x88, 0xA4, 0x15, 0xB8, 0xC9, 0xA4, 0x0E, 0x0C, 0xB7, 0x79, 0x57, 0xD5, 0xE9, 0xE0, 0xCA, 0x64,
+    0xAC, 0x8A, 0x64, 0xCC, 0x71, 0x9D, 0xA2, 0x16, 0x4D, 0x0A, 0xC1, 0x66, 0x60, 0x37, 0x6F, 0x20,
+    0xA0, 0xD2, 0xAC, 0x66, 0x4C, 0x01, 0xFD, 0x25, 0x2D, 0xC5, 0x68, 0x0C, 0x7E, 0x86, 0xD0, 0x78,
+    0xD2, 0x98, 0x2C, 0x87, 0xA6, 0xAB, 0xFD, 0x97, 0xDD, 0xD6, 0xDF, 0xEC, 0xA5, 0x6B, 0x31, 0x10,
+    0xEF, 0xED, 0x21, 0x83, 0x64, 0xC2, 0x6C, 0xE0, 0x23, 0x6B, 0xC1, 0x51, 0xDA, 0xD0, 0xAE, 0x9A,
+    0x2D, 0x06, 0xF1, 0x42, 0x48, 0xCB, 0x98, 0x7B, 0xAB, 0x92, 0x4A, 0x03, 0x8F, 0x3F, 0xC5, 0x30,
+    0x70, 0x31, 0xAB, 0x4B, 0x41, 0x8E, 0xA9, 0x34, 0x57, 0x07, 0x24, 0x19, 0x49, 0x6E, 0x28, 0xEC,
+    0x12, 0x4F, 0xF3, 0x16, 0xFD, 0x12, 0xE7, 0x06, 0x58, 0x1E, 0xA5, 0x7B, 0x4A, 0x6B, 0xE4, 0x7C,
+    0x26, 0x1F, 0xC8, 0x07, 0x09, 0x9E, 0x9A, 0xD5, 0x27, 0x20, 0xD1, 0xDB, 0x5C, 0xC7, 0xE3, 0x20,
+    0x19, 0x8C, 0xD6, 0x3C, 0x44, 0x72, 0x05, 0x24, 0xE8, 0x40, 0xC2, 0x06, 0x24, 0xAE, 0x69, 0xCD,
+    0x05, 0xC8, 0x0E, 0xED, 0xFA, 0xD9, 0xBD, 0x8B, 0xD7, 0x76, 0x2B, 0x2C, 0xAB, 0xB3, 0x4E, 0x2A,
+    0xE4, 0x88, 0x2D, 0x92, 0x8F, 0x54, 0x23, 0x8C, 0x08, 0x2C, 0xB4, 0xF8, 0xD2, 0x27, 0xC7, 0xD7,
+    0x90, 0xC2, 0xEC, 0x71, 0x5D, 0xB9, 0xDF, 0x98, 0xBB, 0x1F, 0x44, 0x67, 0x5E, 0xE7, 0xEE, 0xDD,
+    0xC5, 0x22, 0x67, 0x93, 0x7F, 0xE2, 0x20, 0x5D, 0x0B, 0x3E, 0x53, 0x4C, 0x01, 0x11, 0x99, 0x78,
+    0x5E, 0x5F, 0x0F, 0x99, 0x78, 0xA2, 0x3F, 0x41, 0x4F, 0x43, 0x55, 0x54, 0x5D, 0x0E, 0x6D, 0xC5,
+    0xD0, 0x9A, 0xB9, 0x77, 0x6D, 0xBB, 0xB1, 0x06, 0xBB, 0xD1, 0x04, 0x33, 0x9C, 0x29, 0x1C, 0x03,
+    0x1A, 0x1C, 0x14, 0x03, 0x9F, 0x1B, 0xA4, 0x3A, 0x93, 0xB7, 0x6B, 0x62, 0xAF, 0xFE, 0x0E, 0xE4,
+    0x13, 0xF0, 0x68, 0xE7, 0xCB, 0x23, 0xDC, 0x29, 0x9A, 0x8D, 0x6D, 0x60, 0xA2, 0xB6, 0x81, 0xB1,
+    0x5A, 0x7A, 0x12, 0x14, 0x0D, 0x71, 0xC2, 0xC9, 0x60, 0xBB, 0xB8, 0x97, 0x76, 0x81, 0x6C, 0x17,
+    0x33, 0x4F, 0x50, 0xCF, 0x75, 0xB6, 0x9B, 0xD3, 0x9A, 0xEC, 0x36, 0x99, 0xE1, 0xE4, 0xC1, 0x68,
+    0x9E, 0x26, 0x7A, 0xFC, 0xDE, 0x84, 0x94, 0x7D, 0x4C, 0x1E, 0x68, 0x30, 0x26, 0xA3, 0xEE, 0xE4,
+    0x75, 0x96, 0xAA, 0xA1, 0xCA, 0x03, 0x6A, 0x76, 0x35, 0x51, 0xBD, 0x54, 0x7E, 0xCC, 0x01, 0x09,
+    0x07, 0xA4, 0x62, 0xBA, 0x61, 0x5F, 0x0E, 0xA0, 0x41, 0x68, 0x00, 0x41, 0x65, 0xF9, 0xBB, 0x48,
+    0x83, 0xA4, 0x5D, 0xC5, 0x23, 0xD0, 0x26, 0xA5, 0xAB, 0x91, 0x67, 0x02, 0xC5, 0x42, 0xB2, 0x9E,
+    0xDC, 0x4F, 0x98, 0x3A, 0x76, 0x7F, 0xEC, 0x17, 0xB3, 0xA0, 0x39, 0x9A, 0x0A, 0xC3, 0xA2, 0xA9,
+    0xE2, 0xB0, 0x14, 0x9D, 0x61, 0x84, 0x25, 0x91, 0xAE, 0xAE, 0x16, 0x52, 0xD5, 0xFA, 0x49, 0x69,
+    0x14, 0x29, 0xFD, 0x37, 0x76, 0x97, 0x89, 0x5B, 0x0E, 0xF8, 0x11, 0xEC, 0xAE, 0x39, 0xB0, 0x13,
+    0xCD, 0x12, 0x26, 0x99, 0x0C, 0x90, 0x74, 0xD6, 0xC1, 0xBB, 0xF3, 0x16, 0x6F, 0xB3, 0x0D, 0x04,
+    0x56, 0xD5, 0x60, 0x68, 0x21, 0x60, 0xA3, 0x92, 0x88, 0xDB, 0x15, 0xB1, 0x24, 0xC2, 0xA4, 0x73,
+    0xE5, 0x8A, 0xC8, 0x1D, 0xC2, 0xA8, 0x2F, 0xFE, 0x69, 0xB3, 0x30, 0x91, 0x70, 0x11, 0xC7, 0x8F,
+    0xE9, 0x6A, 0x19, 0xC5, 0x91, 0x91, 0x91, 0x84, 0x4E, 0x1B, 0xD2, 0x7E, 0x17, 0xE5, 0xE7, 0x75,
+    0xD5, 0x56, 0xDD, 0x36, 0x8E, 0x6D, 0xF0, 0xAC, 0xDC, 0x7E, 0x92, 0x74, 0xD9, 0x90, 0x8D, 0xD9,
+    0x20, 0xB9, 0x9E, 0xF8, 0x4B, 0xDA, 0xAC, 0xCF, 0x86, 0x74, 0x8C, 0x86, 0xA0, 0x0F, 0xBA, 0xA8,
+    0xC9, 0x8B, 0x5F, 0x2C, 0x4F, 0x4E, 0xBB, 0x6B, 0x50, 0x33, 0x41, 0x2D, 0xEB, 0xAB, 0x06, 0xA8,
+    0x50, 0x27, 0x13, 0x62, 0xC6, 0xE4, 0xED, 0x93, 0x17, 0x6D, 0x15, 0xC0, 0x4C, 0x40, 0xA6, 0x67,
+    0xD2, 0x05, 0x52, 0xBC, 0x2E, 0x85, 0x70, 0x13, 0x3A, 0xDF, 0x36, 0x3B, 0xB8, 0x0F, 0x6C, 0x37,
+    0x55, 0xE7, 0xDB, 0x0D, 0xC3, 0xF1, 0xE8, 0xD9, 0x98, 0x7C, 0x0C, 0xF2, 0xAA, 0xCD, 0x7D, 0xB3,
+    0x23, 0x23, 0x33, 0x07, 0x72, 0x78, 0x33, 0xD0, 0xCA, 0x4D, 0xD0, 0x73, 0xB8, 0x59, 0x21, 0x50,
+    0x51, 0x44, 0x2D, 0xDF, 0x6F, 0xA2, 0x5A, 0xEE, 0x17, 0xD7, 0x89, 0xE0, 0xA3, 0xD4, 0x6C, 0xA9,
+    0xFC, 0xC7, 0x1B, 0xA8, 0x6F, 0x60, 0x71, 0xAF, 0x40, 0xBE, 0x98, 0x6D, 0x54, 0xBC, 0x09, 0x30,
+    0x16, 0x8E, 0xB0, 0x22, 0x4F, 0x9D, 0x09, 0x3B, 0xAD, 0x86, 0xB6, 0x6A, 0x47, 0xA8, 0xB9, 0x84,
+    0x03, 0xD7, 0xF8, 0x24, 0x44, 0x47, 0xE7, 0x5E, 0xF4, 0x73, 0xB4, 0x70, 0x80, 0xAB, 0x96, 0xE3,
+    0x9B, 0x64, 0x26, 0x25, 0x6C, 0xBB, 0x26, 0xBA, 0x81, 0xFA, 0xFB, 0x14, 0x91, 0xFB, 0x27, 0x04,
+    0x84, 0xD8, 0xC2, 0xD5, 0xB8, 0x8F, 0xAB, 0x5E, 0x4F, 0x35, 0x96, 0x52, 0x73, 0x0D, 0x39, 0x72,
+    0x4D, 0x70, 0x03, 0xF5, 0xF7, 0xD1, 0x27, 0xC0, 0x3C, 0xB3, 0xDE, 0x3E, 0x90, 0xCE, 0xC5, 0x22,
+    0xBB, 0x80, 0xB6, 0x28, 0xB4, 0xB3, 0xC0, 0x3D, 0x60, 0x60, 0xE8, 0x60, 0xA6, 0x2B, 0x87, 0xE5,
+    0x07, 0x23, 0x45, 0x71, 0x29, 0x1B, 0xD7, 0xC8, 0xB7, 0x45, 0xFA, 0x0D, 0x39, 0xF9, 0x40, 0x9D,
+    0x53, 0x49, 0x70, 0x5E, 0x62, 0x45, 0x4C, 0x1E, 0x32, 0x53, 0x5D, 0x7B, 0x72, 0xA2, 0x2D, 0x08,
+    0x56, 0xBD, 0xF9, 0x83, 0x8F, 0x7F, 0x79, 0x89, 0xD0, 0xA9, 0x9A, 0x8B, 0x5A, 0xAD, 0xE7, 0x98,
+    0x4A, 0x06, 0xC5, 0x2B, 0x40, 0x31, 0x29, 0x68, 0x2A, 0x0A, 0xBE, 0x48, 0xE7, 0xAF, 0xA7, 0xE9,
+    0x74, 0x3C, 0x16, 0xBC, 0x81, 0x5A, 0xCD, 0x09, 0xF1, 0xF3, 0x2D, 0xE5, 0xB1, 0x44, 0xFA, 0x45,
+    0x22, 0xFC, 0x3E, 0x2D, 0x14, 0x4F, 0x03, 0xC9, 0x17, 0xA8, 0x7D, 0x3D, 0xBD, 0x47, 0xD4, 0x5C,
+    0x47, 0x3F, 0xDC, 0x53, 0xF4, 0xA7, 0x69, 0xB8, 0x8F, 0xF7, 0xCB, 0x9B, 0xF6, 0x39, 0x49, 0xE3,
+    0x52, 0xDC, 0x2E, 0x34, 0x20, 0x9F, 0x25, 0xDF, 0xEE, 0xB6, 0xE8, 0x24, 0x42, 0x6E, 0xB4, 0x9C,
+    0x67, 0x3D, 0x17, 0x6B, 0x72, 0x8F, 0x9F, 0xEC, 0x7A, 0x72, 0x88, 0xD7, 0x8B, 0x13, 0x31, 0x75,
+    0xD3, 0x2E, 0x27, 0x48, 0xE0, 0x5A, 0xE9, 0xA1, 0xF6, 0xE4, 0x18, 0x19, 0x3F, 0x30, 0x4B, 0x94,
+    0xCF, 0x7B, 0xE8, 0x85, 0x26, 0x55, 0x31, 0xE4, 0x02, 0xE9, 0x68, 0x7C, 0x79, 0x49, 0x03, 0xB9,
+    0xC7, 0xEB, 0xDB, 0xEB, 0xFF, 0x24, 0xED, 0xB7, 0x28, 0xCD, 0x6E, 0x06, 0x3D, 0xEB, 0xAE, 0xE5,
+    0xCC, 0x5E, 0xDA, 0x6C, 0xDC, 0x18, 0xF7, 0xE2, 0x06, 0xD1, 0x09, 0x03, 0x90, 0xCA, 0x52, 0x2D,
+    0x03, 0x46, 0x7A, 0x8D, 0xB6, 0xFA, 0x84, 0xB8, 0x24, 0x58, 0x2F, 0xCD, 0x0A, 0x71, 0x24, 0xF3,
+    0x6A, 0xA2, 0xBF, 0xDE, 0x46, 0xF3, 0xE1, 0xDE, 0x85, 0x49, 0xEA, 0x62, 0x14, 0x84, 0xBE, 0x2E,
+    0x4F, 0xDF, 0x64, 0x16, 0x35, 0x94, 0x9E, 0xB7, 0xA4, 0x2D, 0xCE, 0xD0, 0x14, 0xBC, 0xC8, 0xA1,
+    0x64, 0x7C, 0x07, 0x2E, 0xBE, 0x68, 0x3D, 0x2F, 0x5C, 0xB6, 0x61, 0x86, 0x40, 0x9C, 0x91, 0x88,
+    0xBF, 0xB5, 0xCB, 0x23, 0x1B, 0xDF, 0x1F, 0x01, 0x7D, 0x10, 0xEB, 0x4C, 0x75, 0x49, 0x7A, 0x78,
+    0xD4, 0x3B, 0xCB, 0xA3, 0x6E, 0x16, 0x67, 0x0B, 0x93, 0x95, 0xB7, 0xA9, 0x51, 0x0D, 0xF1, 0x90,
+    0x48, 0xE5, 0x0D, 0x2D, 0x53, 0xB8, 0x6E, 0x5E, 0x91, 0xF9, 0xBF, 0x23, 0x13, 0x71, 0xEF, 0xC9,
+    0x76, 0xDC, 0x27, 0xC2, 0x6E, 0x0F, 0xB3, 0xC6, 0x1D, 0x09, 0xB4, 0xDD, 0x3B, 0x8B, 0x81, 0x3A,
+    0x3F, 0x8B, 0x4F, 0xBC, 0x9A, 0x7C, 0x52, 0x93, 0x38, 0x3F, 0xB5, 0x10, 0x11, 0x08, 0x47, 0xB7,
+    0x6B, 0x03, 0xEF, 0xCB, 0x45, 0xE5, 0x85, 0x14, 0xFB, 0x46, 0xDC, 0x16, 0x0C, 0x8B, 0xED, 0xD7,
+    0x78, 0xE4, 0x37, 0xA3, 0x81, 0x7C, 0x2C, 0x2A, 0x6F, 0xCD, 0xA7, 0x99, 0x2A, 0xBA, 0x21, 0x77,
+    0xD4, 0x9B, 0x1B, 0x57, 0xB4, 0x3F, 0x4B, 0x0C, 0x9F, 0x99, 0x17, 0x18, 0x73, 0xC4, 0x6B, 0x66,
+    0x5B, 0x04, 0x5F, 0xA0, 0xBD, 0x86, 0x22, 0xE5, 0xA3, 0x99, 0xA1, 0xAB, 0x0E, 0xDF, 0x53, 0xDB,
+    0x44, 0x6F, 0xB2, 0xB5, 0x6D, 0xFC, 0x02, 0xDB, 0xBC, 0x4B, 0x1E, 0x65, 0x9B, 0xF5, 0x69, 0xC4,
+    0x36, 0x1D, 0x1F, 0x54, 0x9B, 0x8C, 0xE7, 0xD4, 0xC6, 0xD3, 0xD3, 0x6A, 0x23, 0x77, 0x45, 0x6D,
+    0xE8, 0x7A, 0xB5, 0xB0, 0x4C, 0xB5, 0xD0, 0x9D, 0x5A, 0x3A, 0xA0, 0xDA, 0xAA, 0x86, 0x23, 0x22,
+    0xFB, 0xB2, 0x25, 0x64, 0x9C, 0x23, 0x70, 0x41, 0x9C, 0xE0, 0x17, 0x79, 0xB2, 0x73, 0x63, 0x0E,
+    0x79, 0xAB, 0x08, 0x6A, 0xD8, 0x04, 0x50, 0x4D, 0x30, 0xFA, 0x74, 0x18, 0x1F, 0xAE, 0x85, 0x8D,
+    0x53, 0x73, 0x04, 0x9D, 0xF0, 0x3E, 0xA4, 0xCE, 0xC6, 0x76, 0x6A, 0xE0, 0xF6, 0x6C, 0xE0, 0xF1,
+    0x83, 0x98, 0x2A, 0x06, 0xF1, 0x52, 0x6B, 0x06, 0xD7, 0xAA, 0xC9, 0x7B, 0x35, 0xE9, 0xA8, 0x26,
+    0xF1, 0xB3, 0x87, 0xBE, 0x09, 0x96, 0x77, 0x55, 0xBE, 0x21, 0x96, 0x8C, 0x4A, 0x9D, 0xC9, 0x12,
+    0x33, 0x27, 0xD6, 0x5F, 0x83, 0x39, 0x0E, 0x6F, 0x05, 0x53, 0x02, 0x0E, 0xAA, 0x5A, 0x80, 0x96,
+    0x80, 0xBF, 0x24, 0xD2, 0x20, 0x1F, 0x99, 0x68, 0xDE, 0x3E, 0x03, 0x21, 0x1A, 0x65, 0x23, 0x71,
+    0x2B, 0x5D, 0xD3, 0x9E, 0x29, 0xC5, 0x4D, 0xE8, 0x56, 0x1F, 0x3F, 0x4A, 0x33, 0x0C, 0x7E, 0x36,
+    0x8A, 0x50, 0xE9, 0x99, 0xEA, 0xCB, 0x96, 0x2F, 0x52, 0xD0, 0x5B, 0xB2, 0x46, 0x65, 0x7D, 0xC7,
+    0x71, 0x8F, 0x99, 0x40, 0x63, 0x6F, 0x80, 0x40, 0x1F, 0xD3, 0x91, 0x4C, 0xDE, 0x40, 0x8B, 0x4D,
+    0x1F, 0x8F, 0x3F, 0x56, 0xE2, 0x96, 0xEB, 0x71, 0xCE, 0x5B, 0xB1, 0x58, 0x81, 0xFD, 0x02, 0xF4,
+    0x27, 0xE0, 0xFE, 0x84, 0xAC, 0x3E, 0xF8, 0x36, 0x65, 0xD5, 0xDF, 0x9A, 0xAC, 0xD2, 0xE9, 0x38,
+    0xAD, 0x53, 0x3A, 0xA1, 0x7C, 0x82, 0xB9, 0xB2, 0x72, 0x3A, 0xD5, 0x74, 0x4B, 0x15, 0x11, 0x54,
+    0xE5, 0xF5, 0xD9, 0xC4, 0x22, 0xCF, 0x62, 0x41, 0x87, 0x75, 0x60, 0xB9, 0x91, 0x7A, 0xA9, 0x2A,
+    0xD7, 0xFA, 0xF0, 0xE2, 0xB0, 0xC9, 0xB2, 0x8E, 0x04, 0x29, 0x8D, 0x87, 0xB5, 0x4A, 0x08, 0xC8,
+    0x85, 0x20, 0x64, 0x4D, 0x6B, 0xFC, 0xD9, 0x9A, 0x3F, 0x90, 0x33, 0xE4, 0x2C, 0x5F, 0xE6, 0x5C,
+    0xC5, 0xF1, 0x92, 0xB4, 0x22, 0xD7, 0x59, 0x71, 0x51, 0x49, 0x0F, 0x89, 0x66, 0xAC, 0x92, 0x90,
+    0xB7, 0x8A, 0x4C, 0x48, 0xF0, 0x51, 0xFE, 0xF8, 0x34, 0x6A, 0x56, 0x5F, 0x68, 0x26, 0x21, 0x10,
+    0x84, 0x34, 0x0D, 0xC0, 0x81, 0xAF, 0x05, 0x8D, 0x47, 0x08, 0x7C, 0xAD, 0x4F, 0xB1, 0x74, 0xCD,
+    0xF1, 0xA8, 0xAE, 0x58, 0xD2, 0xE0, 0x6E, 0x55, 0xB2, 0xD8, 0xA0, 0x1C, 0x99, 0x5E, 0x21, 0x33,
+    0x3C, 0xBD, 0xA9, 0x5A, 0x59, 0x4D, 0xA1, 0x0C, 0x21, 0x6D, 0xAA, 0xC2, 0xB5, 0x17, 0x9A, 0x03,
+    0x8A, 0x59, 0x34, 0x6C, 0xAE, 0x88, 0xFE, 0x06, 0x74, 0x75, 0x49, 0x39, 0xAC, 0xB9, 0xE3, 0xB4,
+    0xF3, 0x86, 0x56, 0x2E, 0x86, 0x06, 0x31, 0x84, 0x6E, 0x04, 0x88, 0x84, 0x6E, 0x4A, 0x98, 0xEC,
+    0xD7, 0x4A, 0xF9, 0x0B, 0xEA, 0x33, 0x53, 0x52, 0xBD, 0xA3, 0x9C, 0xFA, 0x19, 0x59, 0xEA, 0x81,
+    0xE2, 0x0E, 0x5D, 0xBC, 0x0B, 0x14, 0x8B, 0x98, 0x63, 0xA7, 0x63, 0x48, 0x19, 0x8D, 0x11, 0xB4,
+    0x12, 0x4F, 0x71, 0x4D, 0x93, 0x60, 0x9D, 0x10, 0xBA, 0x54, 0x75, 0xCF, 0x45, 0x19, 0xF8, 0xAB,
+    0x7A, 0xBB, 0x22, 0x4B, 0x25, 0x6A, 0x7D, 0x0E, 0xA2, 0xCA, 0x45, 0xC5, 0xAC, 0x49, 0xE4, 0x32,
+    0xA3, 0xF9, 0x3E, 0x86, 0x4E, 0xFC, 0x92, 0x21, 0xF3, 0x9D, 0x13, 0xA2, 0x1B, 0xB2, 0x55, 0xE9,
+    0x15, 0x5F, 0x52, 0x6E, 0x08, 0xB0, 0x36, 0x49, 0x11, 0xC8, 0x4B, 0x2E, 0x28, 0xD3, 0xDE, 0x01,
+    0xC3, 0x8C, 0x51, 0x92, 0x3D, 0x88, 0x67, 0x24, 0x45, 0x23, 0xD9, 0xB6, 0x5D, 0xF8, 0xFE, 0x44,
+    0xCE, 0x61, 0xDC, 0x6F, 0x3A, 0x23, 0x5B, 0x8F, 0xDF, 0x70, 0x5C, 0x45, 0x36, 0x26, 0xCF, 0xBB,
+    0xF3, 0xAA, 0xCE, 0xD3, 0xF3, 0xEE, 0xF5, 0x8E, 0x86, 0x0D, 0x44, 0x7D, 0xA3, 0x63, 0x7D, 0xBE,
+    0x63, 0xAA, 0x7F, 0x34, 0x5C, 0xCB, 0x39, 0x63, 0x3F, 0xAD, 0xB9, 0x9C, 0x03, 0x93, 0x7F, 0xA1,
+    0x2F, 0x83, 0xB7, 0x70, 0x46, 0xB6, 0x44, 0xDB, 0x2D, 0x60, 0x22, 0x71, 0x8B, 0x78, 0xBD, 0x3F,
+    0x54, 0x0D, 0x37, 0xC0, 0x7C, 0x51, 0xCC, 0xAA, 0x0F, 0xC2, 0x0E, 0xC0, 0x8F, 0x32, 0x11, 0xEE,
+    0x9F, 0xF5, 0xDC, 0xDD, 0x12, 0xF3, 0x85, 0x00, 0x73, 0x87, 0x52, 0x98, 0x14, 0xA2, 0x13, 0x47,
+    0xA9, 0x62, 0x9E, 0x17, 0x1A, 0xC9, 0xEF, 0x7D, 0xEF, 0x59, 0xDE, 0x78, 0xAD, 0xAF, 0xAB, 0xB2,
+    0xF1, 0x64, 0x5D, 0xA5, 0xD2, 0x61, 0x16, 0x70, 0xAC, 0x3A, 0xE9, 0x38, 0x6A, 0x24, 0xE0, 0xA4,
+    0xCC, 0x55, 0x2B, 0x78, 0x67, 0x3D, 0x30, 0x14, 0xE2, 0x8A, 0xC0, 0x5D, 0xB3, 0x04, 0x0D, 0xD1,
+    0x15, 0x15, 0x11, 0x3C, 0x9C, 0x0D, 0x7D, 0x04, 0x62, 0x8F, 0x64, 0x0F, 0xB1, 0x1B, 0x13, 0x26,
+    0x9F, 0x0D, 0x33, 0x0C, 0x2A, 0x02, 0xDF, 0x25, 0xE7, 0x73, 0xAA, 0xF6, 0x0E, 0x94, 0x89, 0x70,
+    0x0B, 0x69, 0x5C, 0x49, 0x6E, 0x21, 0xB5, 0xEF, 0x62, 0xC9, 0xE7, 0x71, 0x05, 0xF6, 0xCB, 0x62,
+    0x7B, 0x3A, 0xE6, 0xFA, 0x44, 0xEE, 0xF9, 0x25, 0x54, 0x09, 0x45, 0x2A, 0x57, 0xCB, 0xB8, 0x23,
+    0x01, 0xC2, 0x00, 0x47, 0xC2, 0xFC, 0x93, 0x1A, 0xEE, 0x76, 0x88, 0x25, 0x3B, 0x84, 0x9C, 0x73,
+    0x5E, 0xEC, 0xDA, 0x44, 0xD2, 0x3A, 0x59, 0x85, 0x09, 0x4C, 0x95, 0x7C, 0x70, 0xB1, 0xBE, 0x87,
+    0xE4, 0xE5, 0x93, 0x95, 0x8E, 0xBC, 0x35, 0xE6, 0x41, 0x5A, 0xF8, 0x0E, 0x1F, 0xEE, 0x10, 0x3C,
+    0x9E, 0xCD, 0xB9, 0xCD, 0x42, 0xBF, 0xF4, 0x44, 0x41, 0x01, 0xE8, 0xCB, 0x0C, 0x8B, 0x48, 0xC1,
+    0xBA, 0x4B, 0x70, 0x11, 0x09, 0x22, 0xEF, 0x8E, 0xD6, 0xDB, 0x6E, 0x67, 0x5E, 0x66, 0x69, 0x06,
+    0xC9, 0xA5, 0xF3, 0xA3, 0x80, 0x90, 0x1E, 0xF7, 0x2C, 0xF7, 0xC1, 0x6C, 0x2B, 0x12, 0xF3, 0x27,
+    0x63, 0x76, 0x6F, 0xD1, 0xC5, 0x7D, 0x4A, 0x48, 0x7D, 0x0E, 0x3C, 0xDC, 0xC3, 0x5A, 0x7F, 0xCF,
+    0xAC, 0x61, 0x04, 0xEB, 0x2C, 0xD6, 0x1B, 0x61, 0x66, 0x75, 0x33, 0x7A, 0x37, 0xE9, 0x63, 0xDA,
+    0x17, 0xB1, 0x18, 0x0F, 0x0B, 0xB2, 0x2C, 0xDB, 0x50, 0xC0, 0xD3, 0x4B, 0x7D, 0x64, 0x88, 0xC8,
+    0x4A, 0xA9, 0x5A, 0xB1, 0xF8, 0x12, 0xEA, 0x9F, 0xFA, 0x9E, 0x7E, 0x14, 0x67, 0x08, 0x35, 0x9B,
+    0x45, 0x61, 0xD3, 0x41, 0x57, 0xB1, 0xC7, 0xF2, 0xDD, 0x85, 0x58, 0x82, 0xB2, 0x1B, 0xE2, 0x31,
+    0x1E, 0xD3, 0x3E, 0x9A, 0xF2, 0x2E, 0x1C, 0x71, 0xB5, 0x76, 0x29, 0xF9, 0x37, 0xD7, 0x92, 0x94,
+    0xE6, 0xBE, 0xDE, 0xFE, 0x1E, 0xA2, 0xCA, 0xCF, 0x13, 0x77, 0x1E, 0xC0, 0x02, 0x63, 0xB7, 0x84,
+    0xEC, 0x5D, 0xAD, 0xB9, 0xF0, 0xBB, 0xB6, 0xA0, 0x67, 0xBF, 0x2A, 0x26, 0x06, 0xA2, 0x55, 0x2F,
+    0x0D, 0xCC, 0x15, 0x2B, 0x48, 0xF6, 0xCF, 0x00, 0x57, 0x8D, 0x36, 0x6E, 0x1B, 0x6D, 0x04, 0xAD,
+    0x2B, 0x48, 0xDB, 0x7E, 0x09, 0xF5, 0x35, 0xEB, 0x42, 0x03, 0xCD, 0xB0, 0x52, 0x3D, 0x7A, 0xB6,
+    0xA2, 0xAF, 0x22, 0x30, 0x30, 0x7D, 0xC9, 0xDC, 0x66, 0x5F, 0x63, 0xF7, 0xC4, 0xFE, 0xD3, 0x14,
+    0x8F, 0xDC, 0x24, 0xDB, 0x6C, 0x18, 0xAF, 0x96, 0x0D, 0x63, 0x7B, 0xF8, 0x32, 0x08, 0xC3, 0x92,
+    0xFD, 0x6C, 0x6F, 0xAF, 0xB0, 0xDD, 0x1A, 0xCB, 0x44, 0xB2, 0xDE, 0x68, 0x93, 0x35, 0x85, 0x4B,
+    0x3C, 0xF7, 0x2A, 0xA7, 0x1A, 0x39, 0x29, 0x11, 0xF8, 0x09, 0xBE, 0xE3, 0x29, 0xD6, 0xF7, 0xC8,
+    0xD4, 0x3F, 0xE7, 0x0E, 0x12, 0x2A, 0x63, 0x64, 0x5A, 0x2C, 0xA9, 0x96, 0x0B, 0xE6, 0xDE, 0xF0,
+    0x3A, 0xE3, 0xDE, 0x2D, 0x82, 0xAD, 0xFB, 0xB7, 0x72, 0x71, 0x6D, 0xD6, 0x89, 0x35, 0x29, 0xB1,
+    0x80, 0x21, 0x27, 0x74, 0xF2, 0x0A, 0x8B, 0xA8, 0x3E, 0xEB, 0xA1, 0xC5, 0x61, 0x37, 0xE9, 0x75,
+    0x02, 0x00, 0x80, 0x3A, 0x41, 0xB8, 0xE9, 0x1E, 0xC1, 0x18, 0xA6, 0x0B, 0xDC, 0xCB, 0xA0, 0xF8,
+    0xFF, 0xFE, 0x92, 0xD1, 0xFE, 0x89, 0x89, 0xC9, 0x7A, 0x72, 0xB8, 0x7F, 0x89, 0xB1, 0x6F, 0x66,
+    0x2C, 0x64, 0x1E, 0x82, 0x00, 0x92, 0x1D, 0xEE, 0x23, 0xE3, 0x01, 0x42, 0xB7, 0x8E, 0x5B, 0xF4,
+    0x4C, 0x17, 0x18, 0x01, 0x6D, 0x69, 0x3F, 0x38, 0xED, 0x7C, 0xE2, 0x12, 0x5C, 0x3E, 0x2C, 0x4E,
+    0xD8, 0x7A, 0x7A, 0xDB, 0xB6, 0x7E, 0xE8, 0xF3, 0x87, 0x9C, 0x16, 0x5F, 0xA7, 0xB4, 0xF8, 0x52,
+    0x76, 0x5F, 0x7C, 0x03, 0x0A, 0x64, 0x40, 0xFA, 0x62, 0xDD, 0x90, 0x80, 0x71, 0x82, 0x5C, 0x63,
+    0x7E, 0xCB, 0x4D, 0xEA, 0x90, 0xBE, 0x51, 0x04, 0xF3, 0xF1, 0xE6, 0x16, 0xB8, 0xB5, 0xDC, 0xC9,
+    0x43, 0x9C, 0xF9, 0xFA, 0x0F, 0xA6, 0xC5, 0x6C, 0xDC, 0xAD, 0xBD, 0xCF, 0x6C, 0xB6, 0x34, 0x20,
+    0x87, 0xCD, 0x6C, 0x29, 0xB2, 0x14, 0x46, 0xA7, 0x86, 0xB1, 0xE1, 0x76, 0x3F, 0x8C, 0x6F, 0xF5,
+    0x8A, 0x7B, 0x57, 0x4C, 0xB2, 0xAB, 0xF2, 0xF6, 0xE4, 0x29, 0x7A, 0xDE, 0xB9, 0x0D, 0x2D, 0xF2,
+    0x56, 0xB4, 0x20, 0x7D, 0x85, 0x4F, 0x1F, 0x56, 0x8A, 0xF7, 0x58, 0x4B, 0x7A, 0x41, 0x10, 0x59,
+    0xF9, 0xA4, 0x6F, 0x54, 0x08, 0x72, 0xA4, 0x8F, 0x48, 0x23, 0x0F, 0xCB, 0xCA, 0x0A, 0xE9, 0xA5,
+    0xB0, 0x0A, 0x25, 0x28, 0xF7, 0x2D, 0x23, 0x06, 0x25, 0x10, 0x54, 0x35, 0x78, 0x03, 0x63, 0x29,
+    0x65, 0x72, 0x4B, 0xA2, 0xFB, 0x1A, 0x79, 0x72, 0x3B, 0x23, 0x50, 0xC1, 0x08, 0x60, 0xB2, 0x8A,
+    0xA5, 0xB9, 0xFB, 0xAF, 0xDF, 0x32, 0x3D, 0x74, 0xEE, 0xDF, 0xDE, 0xEA, 0xE1, 0xC7, 0x10, 0x2D,
+    0xCD, 0x63, 0x62, 0x72, 0xE0, 0x2D, 0x44, 0x5F, 0xA8, 0x74, 0x7B, 0xE7, 0xBE, 0x2C, 0xF6, 0xD3,
+    0x6D, 0x4C, 0xC8, 0x78, 0x2B, 0xB2, 0x8A, 0xC5, 0x77, 0x2F, 0x7C, 0x8A, 0xC9, 0x4E, 0x1C, 0xCA,
+    0x74, 0xB3, 0x6F, 0xC9, 0x74, 0x17, 0xB8, 0x6A, 0xBC, 0xAA, 0xE2, 0x89, 0x87, 0x2F, 0x00, 0x93,
+    0x32, 0xF3, 0x47, 0x56, 0xB0, 0x1D, 0x72, 0x4A, 0xB0, 0xB6, 0x9D, 0x0E, 0xE1, 0x3C, 0xE1, 0x4F,
+    0x9E, 0xBA, 0xB5, 0xEA, 0xA2, 0xCE, 0x09, 0x87, 0x69, 0x02, 0xAF, 0xF5, 0xEC, 0x18, 0xAE, 0x08,
+    0x6B, 0x13, 0x0B, 0x77, 0xA0, 0x25, 0xE2, 0xD7, 0x35, 0xDB, 0x87, 0x0C, 0x1B, 0x62, 0x07, 0x6E,
+    0x13, 0xCF, 0x21, 0xDD, 0x64, 0x4D, 0xC2, 0x93, 0xC4, 0x3F, 0x98, 0x43, 0x3F, 0x79, 0xCD, 0x61,
+    0x7D, 0x0E, 0x30, 0x82, 0x67, 0x23, 0x43, 0x54, 0x40, 0x7A, 0xC2, 0x1B, 0xEF, 0x75, 0x44, 0xC7,
+    0x1F, 0x15, 0x13, 0x88, 0xA7, 0xF6, 0xFF, 0xB2, 0x71, 0xA3, 0xAA, 0x07, 0x56, 0x7B, 0xDC, 0x4E,
+    0xE6, 0x0B, 0xC0, 0xF0, 0x3B, 0x11, 0x11, 0x42, 0x45, 0x84, 0x78, 0x13, 0x6B, 0x90, 0xD9, 0x81,
+    0x02, 0xC3, 0xBF, 0xB2, 0x6A, 0x5B, 0xA9, 0xDA, 0xB1, 0xCA, 0xCC, 0x9E, 0xDA, 0xDF, 0xF7, 0xEA,
+    0xCF, 0x31, 0x0D, 0x94, 0x9F, 0x71, 0x61, 0xD6, 0x21, 0x9B, 0xEE, 0x78, 0x50, 0xD0, 0x58, 0xD8,
+    0x74, 0xFD, 0x13, 0x6A, 0xDF, 0xAC, 0x49, 0xF1, 0x15, 0x64, 0x91, 0x02, 0x77, 0xD7, 0x59, 0x7B,
+    0xF8, 0x77, 0x04, 0x7C, 0x38, 0x99, 0xF4, 0x08, 0xA9, 0x5A, 0x9D, 0xD7, 0xB6, 0x48, 0xEA, 0xAA,
+    0x48, 0x0A, 0x72, 0x5A, 0xC9, 0x2D, 0x3E, 0x00, 0x14, 0xCC, 0x4C, 0x58, 0x6A, 0x05, 0x1B, 0x14,
+    0x3F, 0x3F, 0x43, 0xDC, 0x3A, 0x30, 0x49, 0x37, 0x9B, 0xA4, 0xAD, 0x8A, 0xAC, 0xCE, 0x8F, 0xB8,
+    0x03, 0x33, 0xF8, 0x73, 0x06, 0xA5, 0x9E, 0x85, 0x8E, 0x6C, 0x02, 0xBC, 0xEF, 0xAC, 0x23, 0xDE,
+    0xB9, 0xF2, 0x07, 0xEE, 0xCF, 0x7A, 0xFF, 0xAD, 0x5E, 0x5C, 0x4E, 0xE0, 0x3E, 0x44, 0xD1, 0xA5,
+    0xD8, 0x55, 0xFA, 0x6D, 0x64, 0x9F, 0xED, 0x9E, 0x07, 0x05, 0x80, 0x66, 0xB4, 0x5D, 0x6F, 0xC1,
+    0xB7, 0x4D, 0xBD, 0xCF, 0x64, 0x4A, 0x73, 0x98, 0xE3, 0xC1, 0xA3, 0x46, 0xDA, 0xC5, 0x5B, 0xD4,
+    0x9C, 0x8B, 0xD6, 0x3E, 0x50, 0x71, 0x7F, 0x6F, 0xA1, 0xC8, 0xB7, 0xC2, 0x9E, 0xD9, 0x59, 0xD8,
+    0x0A, 0xD9, 0xE9, 0x1D, 0x25, 0x53, 0x53, 0x98, 0x5F, 0x29, 0xCA, 0x01, 0x6D, 0xA6, 0x70, 0xBD,
+    0xA3, 0xDC, 0xF3, 0x21, 0x9D, 0xF5, 0x1D, 0x30, 0xCA, 0x8D, 0x3A, 0xDA, 0x9A, 0x7C, 0x0E, 0xAE,
+    0xD3, 0x88, 0x45, 0xDB, 0x2A, 0xCB, 0x7D, 0xE5, 0x34, 0xAC, 0x2E, 0x25, 0xC4, 0x9C, 0x21, 0x44,
+    0x72, 0x07, 0x97, 0x28, 0xA3, 0xCE, 0xCC, 0xF2, 0xD2, 0x01, 0xA9, 0x71, 0x20, 0x1F, 0x1F, 0x74,
+    0x90, 0x39, 0x32, 0x49, 0x06, 0xE7, 0x73, 0xD0, 0xB1, 0x2A, 0x78, 0xD6, 0xAD, 0xB8, 0xAF, 0xDB,
+    0xFE, 0xCD, 0x31, 0x61, 0xCE, 0xBB, 0xCE, 0x3D, 0x82, 0x69, 0xB3, 0xFF, 0x74, 0xD5, 0x5B, 0x98,
+    0x38, 0xFD, 0xBC, 0xB5, 0x6F, 0x33, 0x67, 0x3D, 0xAA, 0xF3, 0xF7, 0x75, 0x02, 0x58, 0x67, 0x3E,
+    0xD1, 0x2C, 0x54, 0x78, 0xF3, 0xB4, 0x79, 0xDC, 0x6A, 0x51, 0x5F, 0x46, 0xAC, 0xC3, 0xB8, 0x25,
+    0x5D, 0x78, 0x1A, 0xBA, 0x36, 0xD6, 0xF9, 0x07, 0x37, 0xF8, 0x50, 0xD5, 0x73, 0xFB, 0x60, 0xDC,
+    0xD1, 0x1C, 0x83, 0x56, 0xD1, 0x6D, 0x15, 0x83, 0xBD, 0xEE, 0xE8, 0x78, 0xEE, 0x2D, 0x25, 0xD2,
+    0x32, 0xCD, 0x67, 0x64, 0xDE, 0x23, 0x2B, 0x34, 0x9E, 0x78, 0x11, 0x71, 0xFE, 0xA0, 0xA2, 0xF5,
+    0x4D, 0x24, 0x05, 0x48, 0xCD, 0x59, 0x9C, 0x81, 0xF0, 0x48, 0x96, 0xDB, 0x37, 0x09, 0xF7, 0xA6,
+    0x12, 0xFA, 0x71, 0x2A, 0x4D, 0x71, 0xB9, 0x2C, 0x12, 0x9A, 0xA7, 0x99, 0x18, 0x5E, 0xE1, 0x2A,
+    0x59, 0x62, 0x7D, 0xC6, 0x32, 0xE1, 0xB0, 0x5D, 0xFC, 0x5A, 0xB6, 0x1D, 0xFA, 0x2A, 0xCA, 0x2C,
+    0x07, 0x80, 0x86, 0x4B, 0x0C, 0xB4, 0x3E, 0xB2, 0x1A, 0x29, 0x93, 0xC2, 0x80, 0x33, 0x92, 0x39,
+    0x03, 0xF3, 0x03, 0xBB, 0xAA, 0x8F, 0x9C, 0xF3, 0x24, 0x7D, 0xF7, 0x02, 0x12, 0x17, 0xEE, 0x75,
+    0xDF, 0x4F, 0x87, 0xFE, 0x11, 0xF1, 0xDE, 0x9F, 0x23, 0xEB, 0xD0, 0xD9, 0x1F, 0x17, 0x0D, 0xEB,
+    0xA4, 0x8C, 0xAF, 0x65, 0xEA, 0x4B, 0x4E, 0x63, 0x9E, 0x25, 0x25, 0x65, 0x36, 0xED, 0xD9, 0x25,
+    0x8B, 0xF3, 0xE7, 0x48, 0xA7, 0x5F, 0x92, 0x05, 0xAC, 0x87, 0x28, 0x7C, 0x73, 0x96, 0x55, 0xBB,
+    0x01, 0xA0, 0xEF, 0x0A, 0x70, 0x79, 0x12, 0x9D, 0xFB, 0xE3, 0xE8, 0xED, 0xBF, 0x7C, 0x39, 0x81,
+    0x1F, 0x36, 0x5F, 0x36, 0x8F, 0xE2, 0x92, 0xFF, 0x43, 0x02, 0x3A, 0xEF, 0xC3, 0x6E, 0xD5, 0x45,
+    0x4D, 0x56, 0x5C, 0xE1, 0xED, 0x1F, 0x9A, 0x5F, 0x07, 0x23, 0xCA, 0x96, 0x26, 0x2D, 0x12, 0xF3,
+    0x34, 0xAA, 0x65, 0xD4, 0xB1, 0xE5, 0x8C, 0x05, 0x82, 0xDF, 0x5E, 0x57, 0x93, 0x74, 0xB6, 0x0E,
+    0x8A, 0x53, 0x98, 0xE1, 0xC1, 0xF5, 0xFD, 0x46, 0xF7, 0x7B, 0xDB, 0xC0, 0xC2, 0xEB, 0x55, 0x17,
+    0xD7, 0x1C, 0x9F, 0x15, 0x93, 0xB9, 0xB2, 0x25, 0x0B, 0x1D, 0x48, 0xAE, 0x50, 0xA8, 0x37, 0x15,
+    0xCB, 0x9D, 0xBC, 0xAB, 0x3A, 0x15, 0x3C, 0xFA, 0x85, 0x05, 0xD7, 0xC8, 0x29, 0xB3, 0x66, 0xD3,
+    0xF7, 0x94, 0x32, 0xDF, 0xC8, 0xF5, 0x3C, 0xE7, 0xCE, 0x8E, 0xA6, 0xEC, 0x23, 0xF4, 0xBA, 0x3A,
+    0xD9, 0xD7, 0x10, 0xBB, 0xEB, 0xD1, 0x67, 0xC1, 0x85, 0x36, 0x7A, 0xEA, 0x40, 0xA0, 0xA2, 0xC6,
+    0x2F, 0xB4, 0x5E, 0x1A, 0x24, 0xC5, 0xBF, 0xF2, 0x79, 0xF1, 0x56, 0x97, 0x3B, 0xD3, 0xAC, 0xFC,
+    0xAE, 0x14, 0x4C, 0x21, 0xF7, 0x50, 0xE8, 0x93, 0xE8, 0x33, 0xFB, 0xC5, 0x3A, 0x13, 0x4A, 0xAF,
+    0xF1, 0x40, 0x2C, 0x67, 0x55, 0x87, 0xC4, 0x9D, 0x05, 0x3E, 0x10, 0x5E, 0x7E, 0x2E, 0x1B, 0xAE,
+    0xD7, 0xFA, 0x59, 0x36, 0x96, 0xC1, 0xEB, 0x93, 0xCC, 0x93, 0x39, 0xFB, 0xFF, 0x4F, 0x3D, 0x7B,
+    0xE2, 0x6E, 0x12, 0x73, 0x30, 0xCC, 0x33, 0x2F, 0xED, 0x89, 0x37, 0xF0, 0x49, 0xDE, 0x4A, 0xF1,
+    0x56, 0x92, 0x37, 0x6E, 0x8D, 0xD4, 0xDA, 0x20, 0x39, 0x9E, 0x01, 0x5C, 0xBD, 0xB6, 0xA6, 0xE0,
+    0xED, 0xFC, 0x9D, 0xE7, 0x6D, 0xCE, 0xC8, 0x1B, 0x82, 0xF3, 0x24, 0x6D, 0xDF, 0xF7, 0x52, 0x41,
+    0xE0, 0x41, 0xBA, 0x20, 0x03, 0x3F, 0x9A, 0xC0, 0x24, 0xC3, 0xD9, 0xD5, 0x29, 0xF7, 0x9B, 0x75,
+    0xD4, 0x7A, 0x24, 0x31, 0x42, 0xEF, 0x61, 0xBF, 0xD6, 0xBC, 0x59, 0xAB, 0xE4, 0xD8, 0xDE, 0x8B,
+    0xCD, 0x17, 0x49, 0xF5, 0xDD, 0x5F, 0xBA, 0x62, 0xFD, 0xEA, 0xEF, 0xE0, 0xCB, 0xB2, 0xC0, 0xB5,
+    0xFC, 0x67, 0xA5, 0xA6, 0x4E, 0x1F, 0x2C, 0x0C, 0x35, 0xED, 0x7D, 0x2F, 0xEE, 0x11, 0xD9, 0x86,
+    0x48, 0x38, 0x92, 0x7D, 0x3E, 0x65, 0x50, 0x07, 0xEA, 0xA0, 0x7A, 0xB2, 0x7E, 0x43, 0xB2, 0x3E,
+    0x70, 0xDA, 0x5A, 0x5B, 0xFE, 0x8B, 0x53, 0x61, 0x6E, 0x78, 0x97, 0x5F, 0xE0, 0xF3, 0xEB, 0x2F,
+    0xAF, 0xAF, 0x57, 0xFA, 0xF0, 0x77, 0xB5, 0xD2, 0xD5, 0xF5, 0x2B, 0x9D, 0x14, 0x52, 0xC6, 0xCD,
+    0x97, 0xFF, 0x01, 0xB5, 0x55, 0xBD, 0x92, 0xDC, 0x44, 0x10, 0xFE, 0xB4, 0xF2, 0x59, 0x55, 0x6C,
+    0x20, 0x07, 0x67, 0x12, 0x07, 0x93, 0x10, 0x11, 0xA0, 0x17, 0xF0, 0xEE, 0x8C, 0x8B, 0xD0, 0x01,
+    0x17, 0x78, 0xCB, 0xC1, 0x05, 0xE4, 0x38, 0xD8, 0x94, 0x60, 0x39, 0xC9, 0x6F, 0xB0, 0x09, 0x6F,
+    0x40, 0x40, 0x6D, 0x42, 0xEA, 0x60, 0x8B, 0x91, 0x79, 0x02, 0x5D, 0xE4, 0x80, 0x44, 0x67, 0x20,
+    0xDA, 0x00, 0x51, 0x25, 0x17, 0xF2, 0x95, 0x56, 0xC3, 0xD7, 0xAD, 0xBD, 0xE3, 0x4C, 0x19, 0x2E,
+    0x31, 0x53, 0x9A, 0x69, 0x69, 0xA6, 0xBB, 0xA7, 0x7F, 0xBE, 0x6E, 0xF9, 0xF3, 0x50, 0xF8, 0x97,
+    0xA1, 0xC8, 0xCB, 0xE0, 0x6C, 0x19, 0x60, 0x0B, 0x99, 0x1E, 0x99, 0x3B, 0x43, 0x86, 0x33, 0x18,
+    0xCC, 0x70, 0x84, 0x63, 0x60, 0x5A, 0x7C, 0x0D, 0xA4, 0x45, 0xC7, 0xC5, 0xB5, 0x5C, 0xD0, 0x00,
+    0x26, 0xE2, 0x92, 0x4D, 0x1A, 0xDC, 0x3F, 0x7B, 0xFA, 0xC6, 0xD9, 0x10, 0x42, 0xA9, 0x0B, 0x56,
+    0x49, 0x09, 0x6C, 0x65, 0x79, 0x31, 0x2D, 0x80, 0x36, 0xD5, 0xC5, 0x21, 0x6A, 0x52, 0x80, 0x1C,
+    0xC3, 0xB8, 0x3C, 0xFD, 0xED, 0xEC, 0x09, 0xE2, 0x6A, 0x06, 0xC4, 0xE5, 0x43, 0x20, 0x29, 0x57,
+    0x72, 0xCF, 0xF6, 0xE6, 0x3D, 0x80, 0xE3, 0x8C, 0xEA, 0xAB, 0xE5, 0xC1, 0xA5, 0x13, 0x0D, 0x0D,
+    0x92, 0x37, 0xBB, 0x1E, 0xE9, 0xC5, 0x2F, 0x3D, 0xCC, 0xF9, 0x45, 0x8F, 0xEC, 0xFC, 0xA2, 0x86,
+    0xF9, 0x83, 0x2C, 0x66, 0xE0, 0x92, 0x06, 0x2E, 0x49, 0xD8, 0x43, 0x98, 0x2B, 0x1A, 0x19, 0xA8,
+    0x6B, 0x22, 0xDF, 0x51, 0x08, 0xF8, 0x28, 0x7A, 0x4D, 0x2F, 0xA3, 0xFA, 0x6A, 0x79, 0x5E, 0x0F,
+    0xB0, 0x2F, 0x5F, 0x53, 0xDF, 0xE5, 0xAE, 0x45, 0x2C, 0x1E, 0xE0, 0x41, 0xFB, 0xCE, 0xBD, 0xBA,
+    0x60, 0x8D, 0xEB, 0x31, 0x09, 0x05, 0xC4, 0xB7, 0x94, 0x12, 0xF4, 0x8C, 0x4A, 0x68, 0x04, 0xF7,
+    0x73, 0x37, 0x30, 0x64, 0x80, 0x47, 0xC0, 0x56, 0xA9, 0x47, 0x27, 0x66, 0xC0, 0x33, 0x50, 0x4A,
+    0xE3, 0x7A, 0xA4, 0xD3, 0x72, 0xE4, 0x4B, 0x8B, 0x05, 0xE5, 0x30, 0x98, 0x84, 0xA6, 0x5A, 0xB7,
+    0x9F, 0x9B, 0x57, 0x1D, 0xB2, 0x9F, 0xBA, 0x95, 0x7D, 0xD4, 0x63, 0x1A, 0xEA, 0x8E, 0x67, 0xC0,
+    0x26, 0x6A, 0x44, 0x27, 0x63, 0x45, 0x93, 0x85, 0x26, 0x4C, 0x97, 0x87, 0x04, 0x6B, 0xA4, 0x06,
+    0xE3, 0xBE, 0xC5, 0xC8, 0xF7, 0x0D, 0x54, 0x0E, 0x3D, 0x44, 0x0F, 0xA2, 0x16, 0xE6, 0x15, 0x9D,
+    0x8A, 0x19, 0x3B, 0x09, 0x89, 0x8C, 0xE3, 0xBF, 0xFD, 0x49, 0xC2, 0xAF, 0x42, 0x6C, 0x10, 0x11,
+    0xF8, 0xD2, 0x4B, 0xDC, 0x89, 0x89, 0x42, 0x6D, 0xB5, 0xE5, 0x8D, 0xAF, 0x22, 0xD7, 0xB3, 0x52,
+    0x2E, 0x41, 0xFE, 0x67, 0x2F, 0x24, 0x0B, 0x1A, 0xA0, 0x94, 0xAC, 0xC1, 0xC1, 0x87, 0xC2, 0x5E,
+    0x22, 0x19, 0x42, 0x4D, 0x41, 0xD3, 0xD9, 0xCE, 0x3A, 0xD8, 0xC6, 0x0C, 0x96, 0xFC, 0x75, 0x12,
+    0x7E, 0xE4, 0x05, 0x75, 0x24, 0xD9, 0xF0, 0x15, 0xF2, 0x5E, 0xBE, 0x60, 0xF8, 0x95, 0x37, 0x74,
+    0x97, 0x9C, 0x8C, 0x28, 0x2D, 0x34, 0x03, 0xF5, 0xB4, 0x34, 0x2C, 0xF4, 0x96, 0x19, 0xF1, 0x61,
+    0x2D, 0xBB, 0xD1, 0x89, 0xDA, 0x57, 0xF9, 0x32, 0x2F, 0x6D, 0x69, 0x0B, 0x5B, 0x64, 0x2E, 0xA3,
+    0xEF, 0x47, 0xC0, 0x11, 0xCD, 0x32, 0x34, 0x34, 0x2D, 0xF1, 0x30, 0x7D, 0x5E, 0xDB, 0xC7, 0x8F,
+    0x1B, 0xBF, 0xCB, 0xDB, 0xBB, 0x61, 0x70, 0xC8, 0x5B, 0x2C, 0x43, 0xA8, 0xF3, 0x9F, 0x97, 0xCD,
+    0x3C, 0xFD, 0xBC, 0xF9, 0x24, 0x2D, 0xD6, 0xC2, 0xA7, 0xFC, 0x6A, 0x78, 0xF1, 0xDE, 0x49, 0x98,
+    0xF6, 0x32, 0x17, 0x5F, 0x7E, 0x7B, 0xF2, 0x5E, 0x9E, 0x23, 0xC1, 0x86, 0x23, 0x88, 0x09, 0x61,
+    0x66, 0x44, 0x20, 0x41, 0x34, 0xA4, 0x92, 0x0D, 0x7C, 0x06, 0x41, 0x02, 0x81, 0x4D, 0x58, 0xBF,
+    0x60, 0x01, 0x80, 0x35, 0xC3, 0x8A, 0x99, 0xD4, 0xEF, 0xB2, 0xAB, 0x04, 0xD9, 0x89, 0x9E, 0xB9,
+    0x4A, 0x90, 0x9D, 0xC8, 0xE9, 0xAE, 0x32, 0x73, 0x07, 0xBA, 0x95, 0x30, 0x4E, 0x59, 0x4D, 0xDC,
+    0x39, 0x64, 0x2D, 0x61, 0x4C, 0x99, 0x4E, 0x92, 0x21, 0x79, 0x81, 0x6C, 0xE9, 0x91, 0xB0, 0x30,
+    0xF0, 0x92, 0x98, 0x7A, 0x94, 0x51, 0x14, 0xDE, 0xD9, 0x6C, 0x36, 0xDF, 0x1D, 0x9C, 0xE9, 0xF0,
+    0x8F, 0xC1, 0xB3, 0xEF, 0xE5, 0x4C, 0xA8, 0x64, 0x56, 0x90, 0x7F, 0xAD, 0x41, 0x5F, 0x08, 0x97,
+    0xE9, 0x5E, 0xC3, 0xCE, 0x97, 0x6E, 0x9C, 0xDC, 0x94, 0x43, 0x32, 0xC5, 0x24, 0x59, 0x33, 0xDA,
+    0xD1, 0x1E, 0x2A, 0x96, 0xE3, 0xD9, 0xA5, 0xBE, 0x4C, 0x0F, 0x37, 0xFA, 0x75, 0x24, 0x98, 0x4A,
+    0x44, 0x9C, 0x6A, 0x0C, 0xE7, 0xA4, 0x15, 0xDC, 0x2B, 0x44, 0xF9, 0x7C, 0xBC, 0xBE, 0x37, 0x43,
+    0xDC, 0xB2, 0x40, 0x9B, 0x39, 0x92, 0x66, 0xDA, 0xA6, 0xB5, 0x41, 0x5A, 0x99, 0x8A, 0x93, 0xB9,
+    0xB2, 0x25, 0xDF, 0x90, 0x15, 0xDE, 0x65, 0x65, 0xCA, 0x32, 0x09, 0x50, 0x1A, 0x09, 0x38, 0x0D,
+    0xEC, 0x84, 0x25, 0x5C, 0x64, 0x4A, 0x73, 0x37, 0x57, 0xEA, 0xDD, 0x8C, 0xE7, 0xEC, 0x35, 0x6E,
+    0xCB, 0xA2, 0x08, 0xD1, 0xEF, 0x8F, 0x1A, 0xCA, 0xE5, 0xBB, 0x2F, 0x76, 0x15, 0xF5, 0x98, 0x7D,
+    0x42, 0x83, 0xD3, 0x92, 0x80, 0x7A, 0x42, 0x93, 0xEA, 0xD1, 0xE8, 0xB8, 0x1D, 0x69, 0x24, 0xEE,
+    0x4E, 0xC4, 0x77, 0x06, 0x78, 0x29, 0x00, 0x19, 0xDC, 0xA9, 0xF8, 0x41, 0xF3, 0x24, 0xE6, 0xC0,
+    0xDD, 0x8D, 0x74, 0x83, 0x3C, 0x04, 0xEE, 0xB8, 0x03, 0x89, 0x59, 0x05, 0xD4, 0x14, 0x11, 0xAE,
+    0x49, 0x35, 0x92, 0xF2, 0xFF, 0x24, 0xB8, 0x22, 0x95, 0x82, 0xD9, 0x37, 0x30, 0xD2, 0x8A, 0xF6,
+    0x63, 0x5F, 0x60, 0x4A, 0xC5, 0x60, 0x3F, 0x56, 0xBB, 0x16, 0xCE, 0xFD, 0x85, 0xF3, 0xA1, 0xF6,
+    0x6F, 0x4F, 0x58, 0x71, 0x4C, 0xE6, 0x07, 0x78, 0xA8, 0x67, 0x58, 0x53, 0x27, 0x35, 0x9F, 0x28,
+    0x68, 0xB7, 0x8A, 0xD6, 0x99, 0x82, 0x39, 0xD3, 0x3A, 0x90, 0x82, 0x60, 0xB3, 0x54, 0x53, 0x05,
+    0xF9, 0x04, 0xB1, 0x16, 0x82, 0x80, 0xE5, 0xA6, 0xC0, 0x4C, 0x4B, 0x46, 0x04, 0x54, 0x86, 0xB5,
+    0x21, 0x02, 0x2A, 0x03, 0x2C, 0x16, 0x8E, 0xF5, 0x7B, 0xCA, 0x00, 0xF3, 0xF1, 0x1F, 0xE2, 0x09,
+    0xF5, 0xB3, 0x50, 0x07, 0xB5, 0x1C, 0x93, 0x52, 0x1B, 0xAB, 0xC0, 0x55, 0x9A, 0x74, 0x2A, 0x99,
+    0x36, 0xB4, 0x0A, 0x73, 0xE9, 0xE5, 0x2B, 0x69, 0xEC, 0x9D, 0xFE, 0xBF, 0xE8, 0x45, 0x5C, 0x8B,
+    0x13, 0x15, 0x7D, 0xE0, 0x87, 0x36, 0x7F, 0xED, 0xFC, 0xAB, 0xD1, 0xE7, 0xE3, 0xB1, 0x27, 0x68,
+    0x2B, 0x25, 0x22, 0x3E, 0x65, 0x51, 0xB9, 0xAF, 0xD6, 0xEC, 0x7E, 0x48, 0x7B, 0x4C, 0xF6, 0x0A,
+    0x78, 0xF9, 0x6F, 0x2C, 0x24, 0x41, 0x05, 0xEC, 0x5B, 0x27, 0xD9, 0x93, 0x44, 0xFE, 0xD7, 0x94,
+    0x7C, 0xC7, 0xD2, 0x58, 0xA9, 0x40, 0x3A, 0xED, 0x92, 0x25, 0x17, 0x53, 0x3C, 0xBA, 0x45, 0x4E,
+    0x27, 0x7D, 0x85, 0x65, 0x0F, 0x9C, 0x8E, 0xC0, 0x3D, 0xE9, 0x6E, 0x1B, 0x0B, 0x69, 0xEF, 0x0C,
+    0xC1, 0x69, 0x18, 0x9B, 0x4A, 0x74, 0xB0, 0xE0, 0xDF, 0xE6, 0xF5, 0x2D, 0x19, 0x99, 0x13, 0xF1,
+    0x8A, 0xB7, 0x89, 0x99, 0xB7, 0xC8, 0x45, 0x64, 0x15, 0xAF, 0x7E, 0xA0, 0x37, 0xA1, 0xBD, 0xD1,
+    0x91, 0xD8, 0x24, 0x52, 0x67, 0x82, 0x63, 0x5D, 0x2F, 0xD9, 0x04, 0x66, 0xF1, 0x3E, 0x67, 0x7C,
+    0xF9, 0xC3, 0xD8, 0x4A, 0xA3, 0xBB, 0x27, 0x2C, 0x7F, 0x01, 0xD5, 0x5A, 0xBF, 0x73, 0xDF, 0xC6,
+    0x95, 0x7F, 0x00, 0x4C, 0x21, 0x63, 0xCC, 0x0D, 0x54, 0x58, 0x4A, 0x26, 0x4E, 0x82, 0xE6, 0x8A,
+    0x9C, 0xE6, 0x2C, 0xB4, 0x29, 0x44, 0x62, 0x65, 0x15, 0x2A, 0x52, 0x98, 0x85, 0x18, 0x17, 0x29,
+    0x9C, 0x32, 0xE3, 0x9B, 0x39, 0x5D, 0x91, 0xC2, 0x85, 0x48, 0xC0, 0xFF, 0x01, 0x9B, 0xF4, 0x2E,
+    0x5C, 0x58, 0xD4, 0x4C, 0xDC, 0xA4, 0xE0, 0x64, 0x28, 0x02, 0x49, 0x93, 0x22, 0x0D, 0x26, 0x73,
+    0xB9, 0x26, 0x0D, 0x2E, 0x93, 0xCC, 0x25, 0x6A, 0x82, 0x38, 0x70, 0x02, 0x49, 0x00, 0xF6, 0x3E,
+    0x9F, 0xB7, 0xC0, 0x97, 0xA4, 0x28, 0x26, 0xF2, 0x9D, 0xCD, 0x88, 0xE0, 0x17, 0x6F, 0x41, 0x60,
+    0x77, 0xDF, 0x8F, 0xDD, 0xF7, 0x63, 0xDF, 0xAE, 0x48, 0x5A, 0x67, 0x6D, 0x8E, 0xBF, 0xB4, 0xF6,
+    0x84, 0x57, 0x5C, 0xE0, 0xAF, 0x8A, 0xAB, 0x04, 0x7F, 0x69, 0x95, 0xD6, 0xF8, 0xDE, 0xE0, 0xAF,
+    0x75, 0xB5, 0xF2, 0x56, 0xE4, 0x07, 0xAC, 0xB6, 0xBF, 0x80, 0xD4, 0x76, 0xE2, 0x59, 0x3B, 0x49,
+    0x38, 0xFD, 0xC4, 0x9A, 0x78, 0xD8, 0xB7, 0x26, 0xE9, 0xF7, 0xAD, 0xA4, 0xDD, 0xFE, 0xBE, 0x64,
+    0x2D, 0xAA, 0x9C, 0x09, 0x50, 0x45, 0x04, 0x95, 0x7D, 0x89, 0xC7, 0xFD, 0x58, 0x42, 0xFB, 0xB8,
+    0x64, 0x57, 0x23, 0x3B, 0x6D, 0x8E, 0xE3, 0x70, 0x80, 0x57, 0x04, 0x6C, 0x92, 0x5B, 0x2B, 0x62,
+    0xDF, 0xB4, 0x85, 0x3F, 0x89, 0xAD, 0x82, 0x51, 0xCA, 0x02, 0x20, 0x17, 0x80, 0xCB, 0x04, 0x22,
+    0xC1, 0x04, 0xE0, 0xA1, 0x96, 0x5C, 0xB3, 0x7B, 0x1F, 0x48, 0x66, 0xD1, 0xEC, 0x4A, 0xF9, 0xAB,
+    0x4D, 0x20, 0xAE, 0x65, 0x06, 0xE9, 0x0A, 0x64, 0x15, 0x40, 0xCE, 0xEE, 0xC7, 0x4D, 0xF9, 0x5E,
+    0x60, 0xA7, 0xEF, 0x34, 0x89, 0xB5, 0xB6, 0x49, 0x01, 0xEA, 0xEB, 0x92, 0x58, 0x73, 0x59, 0xE4,
+    0x35, 0xC5, 0xFF, 0x15, 0x91, 0xDD, 0x9D, 0xBB, 0xBF, 0x69, 0xD1, 0x63, 0x13, 0x7F, 0x9A, 0x43,
+    0x56, 0x51, 0x95, 0x48, 0x80, 0x5A, 0x7A, 0x37, 0x29, 0xCA, 0xD8, 0x44, 0x55, 0xDC, 0xA4, 0x05,
+    0x9A, 0x37, 0x3B, 0xF9, 0x5F, 0xBB, 0x6F, 0x8A, 0x10, 0x8B, 0x94, 0xB6, 0xB6, 0x1D, 0xDE, 0xD9,
+    0x3E, 0xB1, 0x92, 0x54, 0xD1, 0x04, 0x59, 0x07, 0x78, 0x12, 0x80, 0xEB, 0xA0, 0xB6, 0xB8, 0x01,
+    0xAE, 0xAA, 0xF7, 0x40, 0x4A, 0x0D, 0x29, 0x67, 0x7F, 0x02, 0x48, 0xFE, 0x8C, 0x96, 0xF1, 0xD3,
+    0x4A, 0xBC, 0x77, 0xEC, 0x0F, 0x4D, 0x04, 0x7A, 0x8A, 0x4B, 0x0F, 0xEC, 0x9E, 0x61, 0x13, 0xF1,
+    0xDE, 0xB6, 0x5B, 0xCF, 0xBE, 0x73, 0x20, 0xB4, 0x05, 0xBA, 0xB2, 0x83, 0x03, 0x9B, 0xFD, 0xF1,
+    0xCB, 0xC9, 0xF1, 0x99, 0x77, 0x6B, 0x06, 0xF8, 0x47, 0x89, 0x9E, 0xD8, 0x02, 0xA3, 0x5E, 0x67,
+    0x26, 0xE6, 0x5D, 0x65, 0xE6, 0x55, 0x43, 0xE1, 0xA4, 0x10, 0x7A, 0x6C, 0x0D, 0x24, 0xD1, 0xC9,
+    0x76, 0x39, 0xC9, 0x41, 0x64, 0x2B, 0x48, 0xBD, 0x2D, 0x31, 0x7A, 0x79, 0x15, 0x0C, 0x59, 0xEF,
+    0x0F, 0xB1, 0x7D, 0xBF, 0xF7, 0xED, 0x93, 0x0E, 0xA3, 0xD3, 0x80, 0x80, 0x8A, 0x6C, 0xA0, 0x55,
+    0xF3, 0x0D, 0x09, 0xDA, 0x0C, 0x37, 0x86, 0xA7, 0xC9, 0x8A, 0xB0, 0x4E, 0x9B, 0xA4, 0x88, 0x30,
+    0x5D, 0xE4, 0xDF, 0x3E, 0x20, 0x21, 0x3B, 0x7E, 0x6F, 0x6F, 0x0D, 0xF8, 0x95, 0x7E, 0x2F, 0xC7,
+    0xAE, 0xBB, 0x76, 0x57, 0x19, 0x61, 0x4D, 0x8E, 0xD7, 0x5D, 0x74, 0x88, 0x91, 0x0D, 0x5A, 0xFC,
+    0xBC, 0xFB, 0x32, 0x08, 0xE4, 0x6E, 0x9B, 0x0D, 0x89, 0xCD, 0x61, 0xD0, 0x25, 0x92, 0xF8, 0x9D,
+    0x74, 0x71, 0x71, 0x1D, 0xDF, 0x77, 0xC3, 0x6A, 0x3D, 0xC4, 0xF4, 0x09, 0xAA, 0x1B, 0x51, 0x7D,
+    0x54, 0xD4, 0x27, 0x8B, 0xB9, 0xCA, 0x06, 0x1A, 0x48, 0x58, 0xB1, 0xF9, 0x3F, 0x47, 0x45, 0x6C,
+    0x26, 0xF9, 0x31, 0x87, 0x2F, 0xB3, 0x0D, 0x68, 0x6E, 0x2E, 0x3D, 0x91, 0x03, 0x01, 0x2E, 0xC1,
+    0x67, 0xC9, 0x76, 0x75, 0xB6, 0x44, 0xF6, 0xE3, 0xC9, 0x8D, 0x66, 0xE3, 0x24, 0xC9, 0x99, 0x56,
+    0x36, 0x12, 0x3F, 0x19, 0x25, 0xAE, 0x27, 0xB9, 0x54, 0x60, 0x04, 0xAE, 0x5A, 0xD4, 0x83, 0x0E,
+    0xD4, 0x16, 0x93, 0x0B, 0xF7, 0x4F, 0xF1, 0xFC, 0xB4, 0x34, 0xF1, 0x08, 0x4E, 0x0C, 0x1A, 0xFC,
+    0x8B, 0x7C, 0x20, 0x07, 0x41, 0xE3, 0xF7, 0x71, 0x15, 0xB5, 0x59, 0x91, 0x34, 0xA5, 0xE4, 0x3F,
+    0xC3, 0x64, 0xBE, 0x35, 0xE8, 0xCD, 0xE7, 0xA4, 0x2E, 0x85, 0xDF, 0x58, 0x87, 0x75, 0xD9, 0x66,
+    0x6B, 0x6B, 0x6B, 0x13, 0xE3, 0xDD, 0xF3, 0x46, 0x2F, 0x67, 0xDD, 0x9B, 0x99, 0xAD, 0xC9, 0x81,
+    0x6D, 0xAE, 0xED, 0xED, 0x9E, 0x21, 0xD1, 0x5D, 0x95, 0xE8, 0x30, 0x4B, 0x14, 0x6F, 0x0E, 0x24,
+    0xFA, 0x39, 0xA6, 0x92, 0x4A, 0xF4, 0xBB, 0x6D, 0x8C, 0x69, 0xB9, 0xED, 0x77, 0x51, 0xF1, 0x86,
+    0x6C, 0x4B, 0x1F, 0x56, 0x37, 0x64, 0xDB, 0xEB, 0x03, 0x16, 0x7E, 0xCB, 0x62, 0xE7, 0xBB, 0x35,
+    0x44, 0x89, 0xB1, 0xA6, 0x44, 0x65, 0x3B, 0x73, 0x45, 0x52, 0x04, 0xD5, 0xBA, 0x6C, 0x47, 0x75,
+    0x50, 0x7D, 0x43, 0xB6, 0x83, 0x16, 0x12, 0x95, 0x43, 0xAF, 0x87, 0x44, 0x7F, 0x8E, 0xB9, 0x0F,
+    0xDD, 0xF8, 0xEF, 0x2D, 0x73, 0xE5, 0x40, 0x89, 0x54, 0x89, 0x16, 0xE0, 0x12, 0x12, 0x9D, 0x1E,
+    0x9C, 0x92, 0xE8, 0x15, 0xB0, 0x4A, 0xB5, 0xB5, 0xE6, 0xDA, 0xDE, 0xDE, 0x9E, 0x51, 0xC2, 0x0D,
+    0x06, 0x3C, 0x7B, 0xBB, 0xDB, 0x96, 0xE1, 0x40, 0x0E, 0xF0, 0x7B, 0x28, 0x43, 0x76, 0xBB, 0x4B,
+    0x6C, 0xCB, 0xE9, 0x7E, 0x59, 0x66, 0xEB, 0xF5, 0xDC, 0x1B, 0x1D, 0x0D, 0xBC, 0xB7, 0xDE, 0xF9,
+    0xE1, 0xE6, 0x73, 0xEB, 0xAC, 0xB9, 0xE6, 0xC0, 0x7A, 0x67, 0xA9, 0xEB, 0x6D, 0xC1, 0x0C, 0x55,
+    0x79, 0xD4, 0xEE, 0x84, 0xDD, 0x46, 0xD0, 0x49, 0xD8, 0x4A, 0x84, 0x61, 0xAE, 0x64, 0x83, 0x0C,
+    0x04, 0xF5, 0x2B, 0x89, 0x7C, 0x6D, 0x67, 0xEF, 0x40, 0x6B, 0x0F, 0x9C, 0x04, 0x77, 0xA0, 0x1F,
+    0x55, 0xA6, 0xF5, 0xDF, 0x70, 0xF5, 0x93, 0x1A, 0xEA, 0xE8, 0xDD, 0x6D, 0x24, 0xE8, 0xC5, 0x1F,
+    0xFE, 0xC3, 0x1F, 0xBA, 0xA0, 0x9F, 0xDE, 0x69, 0x53, 0x6B, 0xBC, 0x4D, 0xF1, 0xF6, 0x0C, 0xBE,
+    0x46, 0x83, 0x24, 0x2D, 0x25, 0xB1, 0x4D, 0xA3, 0x28, 0xB6, 0xC8, 0x5A, 0x0F, 0xBD, 0x7C, 0x76,
+    0xD0, 0xF9, 0x04, 0x01, 0xC0, 0x00, 0xED, 0xCB, 0xEC, 0x8F, 0x38, 0x07, 0x86, 0x6C, 0x58, 0xCF,
+    0xDB, 0x68, 0x5C, 0x27, 0x7F, 0x3B, 0xB2, 0x98, 0x39, 0x07, 0xD4, 0xF4, 0x91, 0xF2, 0x94, 0x93,
+    0x26, 0x6A, 0x66, 0x01, 0x6C, 0xD2, 0xA4, 0xF4, 0xA9, 0x9D, 0xCA, 0xDD, 0xCC, 0xB6, 0x1B, 0x18,
+    0xE3, 0x76, 0x1D, 0x63, 0x73, 0x1A, 0xE8, 0x87, 0x8C, 0x20, 0x21, 0x08, 0x09, 0xC4, 0x23, 0x90,
+    0xFF, 0x07, 0xF0, 0x80, 0x12, 0xB2, 0xCB, 0x8C, 0xE4, 0x6D, 0xD6, 0xCB, 0xBB, 0x1F, 0x5C, 0xFB,
+    0x70, 0x4D, 0xF2, 0x0A, 0x66, 0xB3, 0x29, 0xEB, 0xD4, 0x78, 0xB0, 0x73, 0x95, 0x84, 0x10, 0xEF,
+    0xA4, 0x7C, 0x64, 0xE6, 0x32, 0x74, 0x67, 0x94, 0xEC, 0xB7, 0x6A, 0xA2, 0xE9, 0x86, 0x24, 0x3F,
+    0x94, 0x6F, 0x1D, 0x8A, 0x9C, 0xF1, 0xBB, 0x62, 0xA1, 0x1F, 0xE4, 0xD8, 0x87, 0x42, 0x24, 0x18,
+    0xBA, 0xAC, 0x98, 0xA4, 0x34, 0xA5, 0xE0, 0xCF, 0x58, 0xC9, 0x71, 0xBB, 0xFF, 0x72, 0x68, 0x72,
+    0xFA, 0x5F, 0x03, 0x18, 0x83, 0x68, 0xAE, 0x88, 0x7C, 0xDF, 0xDF, 0x95, 0x0D, 0xCC, 0xDB, 0xD4,
+    0x0C, 0xD0, 0x74, 0xD5, 0x4E, 0xD8, 0xBE, 0xB4, 0xF1, 0xA7, 0xB8, 0xE3, 0x8D, 0xE7, 0x96, 0xEF,
+    0xF8, 0x8D, 0x75, 0x58, 0x97, 0x6D, 0x66, 0xD7, 0xE1, 0x0D, 0xB4, 0x34, 0x1C, 0x70, 0xCE, 0xB8,
+    0x87, 0x28, 0x12, 0xF8, 0x52, 0x14, 0xE0, 0x97, 0x8A, 0x78, 0xCF, 0x15, 0xBD, 0x16, 0x5E, 0xAB,
+    0x45, 0xD0, 0x68, 0x11, 0x56, 0x5A, 0xC4, 0xC5, 0x1A, 0x8B, 0x84, 0x0E, 0x0B, 0xDD, 0x4B, 0x59,
+    0x5D, 0x9D, 0x36, 0xEF, 0x61, 0xF0, 0x31, 0x12, 0x7D, 0xF0, 0xC7, 0x8A, 0xC2, 0x8B, 0x52, 0x14,
+    0x41, 0xF3, 0x75, 0x16, 0x61, 0xF5, 0x2D, 0x16, 0x71, 0xD1, 0xB2, 0x48, 0xFC, 0x27, 0xE5, 0xEF,
+    0x81, 0x2D, 0x50, 0x0F, 0x0B, 0x6C, 0x7C, 0xD9, 0x6B, 0x01, 0x6C, 0x5E, 0xFE, 0x9F, 0xC4, 0x16,
+    0xE8, 0x54, 0xD6, 0x6B, 0xA6, 0x1A, 0x75, 0x23, 0x23, 0xD1, 0xA8, 0xE4, 0xEE, 0x8C, 0x4A, 0xEE,
+    0x7B, 0xAE, 0x03, 0x1A, 0xE4, 0x5E, 0x0B, 0x25, 0x77, 0x74, 0xE4, 0x8E, 0x8E, 0xDC, 0x51, 0xF5,
+    0x0A, 0x45, 0x02, 0x45, 0x42, 0xB1, 0x91, 0xD8, 0x1A, 0xC5, 0x3D, 0xA8, 0xEC, 0x55, 0xBB, 0xD9,
+    0x67, 0x41, 0x9F, 0xD9, 0x4F, 0xDB, 0x14, 0x9A, 0xA1, 0x78, 0x3B, 0x15, 0x0E, 0x74, 0x86, 0xCD,
+    0xE2, 0x4A, 0xB1, 0xA5, 0xA2, 0xD8, 0x60, 0x30, 0x80, 0xCD, 0x6F, 0x5E, 0x21, 0xB6, 0xD8, 0xFC,
+    0x13, 0xB1, 0x6D, 0xEC, 0x1D, 0xB0, 0x59, 0x6E, 0x55, 0x38, 0xF9, 0x8A, 0x6A, 0x28, 0x21, 0x2F,
+    0x28, 0xA2, 0x44, 0x85, 0x40, 0x19, 0x25, 0x31, 0x02, 0x85, 0x94, 0x4C, 0x84, 0x4A, 0xB9, 0x4D,
+    0x4B, 0xD2, 0x52, 0xCE, 0x50, 0x4E, 0xAF, 0x53, 0x7F, 0x49, 0xF3, 0x07, 0x25, 0x0D, 0xA9, 0x0F,
+    0x01, 0xAD, 0x2D, 0xA6, 0xC6, 0x90, 0x98, 0xD7, 0x04, 0x0A, 0x9B, 0x89, 0x15, 0x28, 0xED, 0xB6,
+    0x6F, 0x05, 0x8A, 0x0B, 0xCD, 0x82, 0x4D, 0xB8, 0xD9, 0xC5, 0x88, 0x53, 0x36, 0x83, 0xF6, 0x5F,
+    0x4B, 0xF6, 0x56, 0xFF, 0x80, 0x45, 0x5C, 0x35, 0x2C, 0x92, 0x5B, 0x15, 0x8B, 0x2C, 0x7A, 0x64,
+    0xE1, 0xDE, 0xB6, 0x63, 0x06, 0x1E, 0xC4, 0x86, 0x97, 0xC4, 0x56, 0xAA, 0xBD, 0x5D, 0xB3, 0x9B,
+    0x68, 0x06, 0x8F, 0xDA, 0x2E, 0xB2, 0x56, 0xDF, 0xC7, 0x19, 0x0D, 0xB7, 0xA1, 0xB6, 0x8E, 0xA4,
+    0x8C, 0x8B, 0x31, 0x3C, 0x76, 0x75, 0xE4, 0xB1, 0x5F, 0x00, 0xE7, 0x92, 0x94, 0x74, 0x64, 0x70,
+    0xCE, 0x08, 0xA2, 0xA8, 0xCB, 0x7C, 0x95, 0xB1, 0x5A, 0xD6, 0x2A, 0xF0, 0x3F, 0x24, 0x98, 0xE0,
+    0xC3, 0xC1, 0x6A, 0x4C, 0x0E, 0x02, 0xFB, 0xF1, 0x38, 0x5B, 0x5B, 0x15, 0xD7, 0xA5, 0xFB, 0xDA,
+    0xB5, 0x22, 0x65, 0xD4, 0x54, 0x68, 0xA9, 0x31, 0x12, 0x50, 0x38, 0x1A, 0x49, 0xFC, 0xA9, 0x2B,
+    0x72, 0x52, 0x57, 0xBC, 0x94, 0xB9, 0x6B, 0xE7, 0x8A, 0x0D, 0xD7, 0xCD, 0x01, 0x03, 0x01, 0x8C,
+    0x9B, 0xAD, 0xB5, 0x93, 0x9C, 0x13, 0xC4, 0x6F, 0x95, 0x34, 0x84, 0x03, 0xEC, 0x14, 0xCE, 0x57,
+    0x59, 0xA9, 0xE2, 0xC1, 0x45, 0x9F, 0xEC, 0x2D, 0x81, 0x53, 0xD0, 0xBE, 0x18, 0xE9, 0x39, 0x3F,
+    0x20, 0xF2, 0x10, 0x1A, 0xEB, 0x7C, 0x16, 0x0A, 0x12, 0x04, 0x0E, 0x7C, 0xF4, 0x94, 0x3B, 0x0F,
+    0x86, 0xDE, 0x48, 0x6C, 0x3E, 0x80, 0x35, 0x44, 0x18, 0xB6, 0xC2, 0x0F, 0xF2, 0x27, 0xFE, 0xAF,
+    0x7E, 0xE8, 0x48, 0x73, 0x4C, 0x94, 0x8E, 0x33, 0x47, 0x67, 0xE0, 0xA2, 0x8E, 0xB0, 0xBE, 0xC0,
+    0xFC, 0x5D, 0xFA, 0xC8, 0xD1, 0x39, 0xCD, 0x04, 0x1A, 0xE5, 0x32, 0xD5, 0x89, 0xDC, 0x87, 0x4A,
+    0x4B, 0x2D, 0xDD, 0xC5, 0xE5, 0x6F, 0xB6, 0x44, 0x16, 0x71, 0x07, 0xA7, 0xFA, 0xE3, 0x41, 0xF5,
+    0x84, 0x9A, 0x25, 0xF1, 0x4D, 0x0D, 0x1A, 0xD6, 0xE4, 0xBA, 0xB9, 0xC0, 0xF3, 0x73, 0xB6, 0x01,
+    0x91, 0x5A, 0xA0, 0x21, 0x6E, 0x8F, 0x0A, 0xC4, 0xD5, 0x8D, 0x9C, 0x75, 0x5D, 0x2C, 0xFE, 0xD4,
+    0x87, 0xB0, 0xB7, 0x52, 0x8B, 0x1B, 0x91, 0x12, 0xF8, 0x5E, 0x58, 0x1C, 0xFB, 0x2F, 0xB5, 0x67,
+    0x73, 0xB4, 0x7E, 0x92, 0xA3, 0xB2, 0xFA, 0x22, 0x38, 0xAA, 0x5F, 0x8C, 0x23, 0x44, 0xD1, 0x2E,
+    0x04, 0xD7, 0x07, 0x1D, 0x86, 0x43, 0x2C, 0xC3, 0xF4, 0xE1, 0x2F, 0xA0, 0x93, 0x0F, 0xFE, 0x27,
+    0x78, 0xA0, 0xEF, 0x0A, 0x7E, 0x39, 0x3F, 0x44, 0x3F, 0xC3, 0x03, 0x27, 0x73, 0xFC, 0xE6, 0x6C,
+    0x64, 0x53, 0x7F, 0x7E, 0x58, 0x5F, 0x1E, 0x06, 0xDF, 0xFE, 0x6A, 0x4B, 0x39, 0xF3, 0xB9, 0xB2,
+    0x23, 0x53, 0xBE, 0x7D, 0xC4, 0x08, 0x38, 0xAC, 0xE6, 0x3A, 0xF1, 0xA3, 0x07, 0xEE, 0x21, 0x71,
+    0x35, 0x30, 0xD8, 0x5B, 0x6F, 0xCF, 0xC2, 0x91, 0xB9, 0x4E, 0xAF, 0x0F, 0x09, 0xB9, 0xE1, 0x43,
+    0x4A, 0x7E, 0xF8, 0x90, 0x09, 0xA6, 0x55, 0x80, 0x87, 0x12, 0x31, 0xB1, 0x29, 0x49, 0xFD, 0xD1,
+    0xC3, 0xEC, 0x42, 0x4B, 0xC4, 0x45, 0x31, 0xD9, 0xCB, 0x9B, 0x64, 0x82, 0x3B, 0x08, 0x2C, 0x3C,
+    0x87, 0x6F, 0x21, 0x46, 0x6F, 0xA0, 0x48, 0x77, 0x9D, 0x8F, 0xE9, 0x4F, 0x82, 0x6E, 0x05, 0x4E,
+    0x7E, 0xD0, 0xCA, 0xC9, 0xB0, 0xD8, 0x27, 0x7A, 0x99, 0x88, 0x52, 0x4F, 0xA5, 0x7C, 0xFC, 0x9D,
+    0x11, 0x23, 0x6E, 0x49, 0x2B, 0xD7, 0x26, 0xD1, 0xEE, 0x12, 0x86, 0xBA, 0x99, 0x52, 0x2E, 0xE0,
+    0x26, 0x1B, 0xDA, 0xC5, 0xD7, 0x5D, 0xD3, 0x75, 0xA3, 0xF6, 0x28, 0xE1, 0x78, 0xCC, 0x94, 0xAB,
+    0xC1, 0x3B, 0x65, 0xC9, 0x39, 0xD4, 0xE3, 0x0C, 0x3D, 0x5B, 0x7B, 0x93, 0x8E, 0xF2, 0xC6, 0x29,
+    0xF8, 0x9A, 0x42, 0x79, 0x06, 0xFE, 0x6E, 0xCB, 0x70, 0x11, 0xCD, 0x31, 0xC7, 0x28, 0x14, 0xCF,
+    0xAD, 0x73, 0x12, 0x62, 0x22, 0x03, 0xC6, 0x33, 0x04, 0x46, 0xC4, 0x97, 0xC4, 0x6E, 0x67, 0x88,
+    0x5A, 0xEC, 0xC7, 0xB9, 0xEC, 0x99, 0x01, 0x55, 0x75, 0x2E, 0x02, 0x70, 0x6D, 0xCB, 0xCB, 0x4E,
+    0xFF, 0xBB, 0xC5, 0xAA, 0x41, 0xA0, 0x21, 0x4C, 0xFC, 0x1B, 0x5D, 0x45, 0x14, 0x5C, 0x56, 0xAC,
+    0x33, 0xE0, 0x7A, 0xC9, 0xE5, 0xAF, 0x22, 0xAF, 0x33, 0xCE, 0xA2, 0x36, 0x2F, 0x08, 0xCB, 0x42,
+    0xDF, 0x3C, 0xC7, 0x87, 0xBC, 0x74, 0xF4, 0x73, 0xFA, 0x73, 0xC1, 0x46, 0xE3, 0xAF, 0x19, 0x2E,
+    0x4E, 0x9B, 0xA8, 0x3A, 0x4E, 0xAF, 0xE1, 0xED, 0x73, 0x68, 0xD8, 0xEB, 0xE7, 0x70, 0x7B, 0xB0,
+    0xF4, 0x4B, 0xBF, 0x5C, 0xB7, 0x6A, 0x96, 0x89, 0xA6, 0x20, 0x85, 0x3E, 0xE6, 0xE6, 0x58, 0x7E,
+    0xEE, 0x1C, 0xF0, 0x73, 0xFA, 0x59, 0xAE, 0x54, 0x60, 0x9D, 0x3F, 0x19, 0x74, 0xDA, 0xAD, 0x63,
+    0x59, 0x70, 0x6E, 0xF8, 0x39, 0x6D, 0xAA, 0x43, 0xC4, 0xC7, 0x56, 0xEF, 0xA4, 0x2A, 0x9F, 0x9D,
+    0x2F, 0x5F, 0x28, 0x7E, 0xDC, 0x7F, 0x70, 0xB3, 0xB2, 0x83, 0xDD, 0xAC, 0xEF, 0x32, 0x15, 0x5A,
+    0xD3, 0xA0, 0xA2, 0x5E, 0xD9, 0x12, 0xC2, 0x0A, 0x03, 0xC2, 0xEE, 0x02, 0x26, 0x0A, 0x61, 0xBA,
+    0x09, 0xA7, 0x2B, 0xF6, 0x77, 0x26, 0x9E, 0x60, 0x72, 0xEB, 0x78, 0xFA, 0xAA, 0x7D, 0xB4, 0x0B,
+    0x8B, 0xAC, 0xEF, 0x8F, 0x60, 0x32, 0x1E, 0xB5, 0x85, 0xF9, 0x06, 0xCC, 0xB5, 0x4F, 0x10, 0x40,
+    0x2C, 0x9C, 0x8F, 0xC9, 0x34, 0x63, 0x07, 0x9C, 0x8C, 0xAC, 0x72, 0x27, 0xF0, 0x16, 0x1A, 0xA5,
+    0x4D, 0xCC, 0x33, 0x04, 0x4F, 0xAD, 0xE6, 0x61, 0xEB, 0x52, 0x17, 0x2B, 0x26, 0xDA, 0x3D, 0xAD,
+    0x57, 0xF0, 0x46, 0x4C, 0x52, 0xD5, 0x2C, 0x3C, 0x48, 0x8B, 0x0B, 0x64, 0x3A, 0x55, 0xFC, 0xAC,
+    0x5B, 0x59, 0xD2, 0x27, 0xA1, 0x78, 0x0A, 0xEE, 0xF8, 0x1E, 0x44, 0xB0, 0x00, 0x45, 0x2C, 0x40,
+    0x24, 0x0B, 0xD0, 0xCD, 0x22, 0xB4, 0x86, 0x05, 0x04, 0xA1, 0x3D, 0xD8, 0x46, 0x8B, 0xAC, 0xD3,
+    0x22, 0x19, 0xB4, 0x88, 0x5D, 0xEF, 0x81, 0x2B, 0xBC, 0x19, 0x57, 0xE9, 0x0A, 0x70, 0x4B, 0x02,
+    0x10, 0x3A, 0x90, 0xA4, 0x88, 0x85, 0xE6, 0x6D, 0xE4, 0xD5, 0x8F, 0x8E, 0x56, 0x47, 0x9E, 0x1B,
+    0x7F, 0x4D, 0x18, 0xCF, 0x4B, 0xA3, 0x53, 0x2B, 0x23, 0xF8, 0x4F, 0xA3, 0xBE, 0x99, 0x7D, 0x37,
+    0x88, 0x3A, 0x54, 0x6C, 0x05, 0x3B, 0x28, 0x6B, 0xC6, 0x22, 0x59, 0x4B, 0xE7, 0x95, 0x75, 0xF4,
+    0x8C, 0xE9, 0x40, 0x27, 0x99, 0x2C, 0x90, 0x79, 0xD6, 0xF1, 0x39, 0xF0, 0x58, 0x1D, 0xD7, 0x4A,
+    0x7B, 0xE8, 0x5D, 0x6F, 0x9A, 0x09, 0x41, 0x94, 0x60, 0x18, 0xC5, 0xD8, 0x86, 0x88, 0xD4, 0xAB,
+    0xD2, 0xAD, 0xD2, 0xDC, 0x79, 0x6E, 0x0D, 0xE9, 0xFC, 0xA6, 0xC6, 0x4B, 0xA2, 0xEF, 0xDD, 0x02,
+    0xD3, 0x71, 0x11, 0x17, 0x17, 0x83, 0x8B, 0x57, 0x75, 0x25, 0xA7, 0x59, 0x2B, 0x29, 0x35, 0xC9,
+    0x3F, 0xD2, 0x6A, 0x07, 0x6D, 0xCC, 0x44, 0x62, 0xE1, 0x37, 0x17, 0x82, 0x0B, 0x4D, 0x52, 0xA0,
+    0xD2, 0x3E, 0xD7, 0x31, 0x7F, 0x61, 0xB7, 0x7F, 0xA4, 0xB5, 0x48, 0x7C, 0xEA, 0xFB, 0x9A, 0xFC,
+    0xFB, 0x05, 0x99, 0x51, 0xBA, 0x7E, 0x6E, 0x13, 0x28, 0x43, 0xD4, 0x6B, 0x6A, 0xBC, 0x67, 0xD2,
+    0xC0, 0xBD, 0x39, 0x7D, 0xBD, 0x94, 0x5C, 0xBC, 0x22, 0x52, 0x6C, 0x88, 0xDF, 0x64, 0x45, 0xD4,
+    0x70, 0xCF, 0x26, 0xE8, 0x0F, 0x9D, 0x11, 0xCA, 0x1A, 0xE7, 0xDD, 0x4A, 0x58, 0xD9, 0x7E, 0x44,
+    0x58, 0x9A, 0x99, 0xB4, 0x88, 0xEB, 0x0D, 0xB0, 0xF7, 0x25, 0xB4, 0x39, 0x62, 0x2B, 0x51, 0xCE,
+    0x76, 0x94, 0xB3, 0xE1, 0x88, 0x33, 0x5F, 0x39, 0x0B, 0x2C, 0x39, 0x8B, 0x2C, 0x39, 0x8B, 0x73,
+    0x72, 0x96, 0x2A, 0x67, 0x37, 0x94, 0xEA, 0x7D, 0xE5, 0xAC, 0x25, 0x37, 0x7E, 0x43, 0x18, 0x56,
+    0x84, 0x5C, 0xB1, 0x64, 0x7D, 0xA2, 0x9C, 0xAD, 0x2B, 0x67, 0xF7, 0x94, 0xB3, 0x8E, 0x9C, 0x61,
+    0x9E, 0x80, 0x33, 0xDA, 0xE5, 0x46, 0x8D, 0xFE, 0xC2, 0x59, 0xA6, 0x9C, 0x6D, 0x28, 0x67, 0xFB,
+    0x3A, 0x3E, 0x6E, 0x8C, 0xFC, 0xBD, 0x65, 0xF1, 0x2C, 0xAB, 0xA4, 0xEF, 0x12, 0x70, 0x62, 0x75,
+    0xE9, 0x78, 0xD8, 0x3E, 0x35, 0x58, 0xB9, 0xB5, 0x1E, 0x9C, 0xCD, 0x5C, 0x04, 0x30, 0x85, 0x08,
+    0xCC, 0xD9, 0x49, 0x58, 0xBB, 0xA2, 0xFA, 0x22, 0x0B, 0x59, 0x8A, 0x5A, 0x53, 0x81, 0xA5, 0x66,
+    0xF1, 0x24, 0x1B, 0x75, 0x35, 0x10, 0xCF, 0xE9, 0xF6, 0xD2, 0x85, 0x4C, 0xCB, 0x5C, 0x7C, 0xF5,
+    0x44, 0x8E, 0x27, 0x7F, 0xB1, 0x1C, 0xCF, 0x85, 0x63, 0xD3, 0xBF, 0x3F, 0x6F, 0x83, 0xAE, 0xD2,
+    0x9C, 0xE4, 0xF9, 0x2D, 0x35, 0x7B, 0xA3, 0x66, 0x11, 0xBD, 0x56, 0x53, 0xB3, 0x17, 0x7C, 0x34,
+    0xDD, 0x75, 0xE8, 0xEB, 0x68, 0xDA, 0x40, 0xE7, 0xA9, 0x0D, 0xDD, 0x42, 0x3B, 0xE8, 0xCF, 0xC8,
+    0x87, 0x5C, 0x3C, 0x36, 0x9D, 0x4F, 0x2E, 0x5F, 0xCC, 0x27, 0xA3, 0x8B, 0x50, 0x37, 0x9B, 0x22,
+    0x3B, 0xC4, 0x40, 0x96, 0xD5, 0xDC, 0xF8, 0x82, 0xCD, 0xE2, 0xB3, 0x52, 0xB1, 0xAE, 0x68, 0x0F,
+    0x54, 0x0B, 0x3A, 0x9A, 0x43, 0x26, 0x33, 0xE2, 0x31, 0xD0, 0x6D, 0x4B, 0xAE, 0x11, 0x02, 0xFB,
+    0x96, 0xA1, 0xFD, 0xFB, 0x58, 0xFB, 0x53, 0x5C, 0xF9, 0x70, 0xA4, 0x36, 0x7F, 0x1B, 0xE6, 0xBD,
+    0xCB, 0x39, 0x34, 0x6A, 0x47, 0x5B, 0x71, 0xD1, 0x70, 0xA6, 0x26, 0xC7, 0x77, 0xB9, 0xEC, 0x65,
+    0xD5, 0xB3, 0xA9, 0xE4, 0xEA, 0x2E, 0xF4, 0x23, 0x17, 0x07, 0xD3, 0x3C, 0x33, 0xEC, 0x24, 0x8C,
+    0x34, 0x66, 0x0D, 0x67, 0x68, 0x8E, 0x3D, 0xEB, 0x57, 0xAD, 0x13, 0x6B, 0x7D, 0x22, 0xB6, 0x4F,
+    0x35, 0x0A, 0x56, 0x6A, 0xED, 0x6F, 0x57, 0x58, 0x3C, 0x4D, 0xFC, 0x1D, 0xA7, 0x61, 0xCE, 0xF3,
+    0x86, 0x96, 0xDF, 0xD3, 0xC7, 0x09, 0xF3, 0xED, 0x35, 0xA7, 0x8E, 0x1E, 0x14, 0x40, 0xE8, 0xE6,
+    0x31, 0x8D, 0x01, 0x68, 0x1C, 0xCC, 0xAD, 0x49, 0x09, 0x6F, 0xDA, 0x47, 0xE6, 0xCB, 0xF6, 0xD6,
+    0x48, 0x2E, 0x6E, 0x73, 0xB3, 0xD7, 0x7E, 0xFB, 0x18, 0xBC, 0x0D, 0x04, 0xBE, 0xBD, 0xA5, 0xD1,
+    0xB6, 0xB1, 0xB4, 0xED, 0x68, 0x55, 0x01, 0x86, 0x56, 0x7D, 0x4B, 0xDE, 0xFA, 0xF6, 0x4D, 0x2C,
+    0x21, 0x7D, 0x88, 0x36, 0x26, 0xAC, 0xE2, 0x16, 0x62, 0x6E, 0xD2, 0xA6, 0xB4, 0xB7, 0x27, 0xE6,
+    0x8C, 0x6E, 0xEA, 0x8E, 0x2B, 0xF7, 0xD8, 0xD5, 0x18, 0xBB, 0x0C, 0x8D, 0x26, 0xA1, 0x93, 0x76,
+    0x65, 0x9D, 0x56, 0x3A, 0xCB, 0xA9, 0xA1, 0xD3, 0x24, 0xA4, 0x45, 0x8F, 0x99, 0x71, 0x89, 0x3B,
+    0xC8, 0x24, 0x54, 0x7F, 0x76, 0x39, 0x5C, 0xF6, 0x07, 0xAE, 0x3E, 0x20, 0x37, 0x88, 0x90, 0x93,
+    0xE9, 0x36, 0x56, 0x22, 0x1D, 0xDE, 0xE5, 0x2D, 0x41, 0xA3, 0x20, 0xE2, 0xBF, 0x31, 0x3F, 0xE4,
+    0xA8, 0x62, 0xFF, 0x4C, 0x2F, 0xF1, 0x3E, 0x86, 0xC2, 0xE5, 0x52, 0x35, 0xA6, 0xE5, 0xAE, 0xBE,
+    0x33, 0x94, 0x94, 0xA1, 0xDB, 0x82, 0xA8, 0xCF, 0x93, 0x0C, 0x35, 0x66, 0xB1, 0xD5, 0xBC, 0x1F,
+    0x64, 0x92, 0xBF, 0x05, 0xEC, 0x43, 0x00, 0x41, 0x37, 0xAB, 0x05, 0xE5, 0x79, 0x90, 0x71, 0xC5,
+    0xCD, 0xA9, 0xEB, 0xE8, 0x60, 0x7C, 0x08, 0x15, 0xD1, 0x3D, 0x25, 0x7C, 0x5C, 0x33, 0xAF, 0x17,
+    0xE7, 0x39, 0x28, 0x9A, 0xFE, 0x0B, 0x5B, 0xF1, 0xA7, 0x08, 0x32, 0x98, 0xE2, 0xCE, 0xFD, 0x7B,
+    0x3C, 0x84, 0x3A, 0x2F, 0x32, 0x34, 0x2D, 0x95, 0x70, 0x50, 0xD6, 0x69, 0xD2, 0x6E, 0x04, 0xD5,
+    0xFC, 0xA4, 0xEF, 0xE6, 0xAC, 0xDB, 0x39, 0x11, 0x04, 0x1C, 0x6B, 0x8A, 0xE5, 0x7D, 0xA0, 0xE0,
+    0xDE, 0x34, 0x54, 0x3E, 0x46, 0x20, 0x54, 0x23, 0x6A, 0xEC, 0x22, 0x6E, 0x98, 0x03, 0x1B, 0x94,
+    0xB2, 0x53, 0x7C, 0x4C, 0xFD, 0xBA, 0x02, 0x38, 0xF7, 0xCA, 0xC1, 0xD7, 0x06, 0x03, 0xF1, 0x6E,
+    0x6D, 0xDD, 0x51, 0xCC, 0xE2, 0x70, 0x8B, 0x62, 0x37, 0xA2, 0xF8, 0x0B, 0xF9, 0x1E, 0x29, 0xA8,
+    0xA5, 0x05, 0x0D, 0xE5, 0xE3, 0xD7, 0xDB, 0xC4, 0x8E, 0x30, 0x75, 0x95, 0x2A, 0xF9, 0xA4, 0x5B,
+    0x10, 0x6B, 0xC6, 0x05, 0x55, 0x39, 0x17, 0xC2, 0xB6, 0x8F, 0x86, 0x68, 0x48, 0xBA, 0x70, 0xCC,
+    0xDA, 0x60, 0xC0, 0xDD, 0xF0, 0x64, 0x14, 0x17, 0x57, 0xAB, 0xDB, 0xE5, 0x91, 0x75, 0x1B, 0x0E,
+    0x66, 0xEC, 0x4B, 0x88, 0x00, 0xDF, 0x88, 0xED, 0xCD, 0x21, 0xE0, 0xD2, 0x19, 0x7D, 0x70, 0x4F,
+    0x46, 0x75, 0xDF, 0x5F, 0x92, 0x38, 0x69, 0x21, 0x97, 0x73, 0xA3, 0xE9, 0x6E, 0x30, 0xE3, 0xE9,
+    0xA9, 0x07, 0x75, 0xF0, 0x8C, 0x45, 0x85, 0xD3, 0x61, 0x0E, 0xD8, 0xAE, 0xAF, 0xC6, 0x69, 0x53,
+    0xCF, 0x75, 0x14, 0x94, 0x6D, 0x27, 0xD1, 0x18, 0x41, 0xFC, 0x7D, 0x60, 0x25, 0x85, 0x1D, 0xE2,
+    0xAE, 0x9F, 0x35, 0x3C, 0x1B, 0x50, 0xE4, 0x4F, 0x1E, 0x00, 0xD0, 0x1E, 0xE7, 0x9F, 0x6E, 0x6D,
+    0x99, 0xBC, 0x3D, 0xDA, 0x1D, 0x74, 0x66, 0x60, 0x8D, 0xC9, 0x9C, 0x04, 0xC2, 0x7D, 0xFF, 0x90,
+    0x5D, 0x0D, 0xEC, 0xB4, 0x59, 0xD6, 0x29, 0xCE, 0x56, 0xF4, 0x27, 0x6C, 0xC5, 0xE0, 0xF6, 0x94,
+    0xCE, 0x91, 0x0C, 0xFF, 0xA3, 0xBF, 0x6B, 0x2B, 0xCE, 0x45, 0x1A, 0xCF, 0x28, 0x29, 0x80, 0x8C,
+    0x27, 0x95, 0xF4, 0x1C, 0xC8, 0x58, 0xE5, 0x00, 0xC7, 0x63, 0x39, 0xC0, 0xF0, 0x68, 0xD5, 0xC5,
+    0xAD, 0xF6, 0x44, 0xF3, 0x46, 0xB5, 0xF3, 0x34, 0x9F, 0xE5, 0x86, 0xDE, 0x25, 0xD4, 0x54, 0x26,
+    0x5F, 0x2E, 0xDD, 0x27, 0x11, 0x69, 0x2B, 0x79, 0x25, 0x93, 0xAC, 0x56, 0xD7, 0xB9, 0x3A, 0xCF,
+    0x50, 0x1D, 0xE9, 0xDF, 0xFD, 0x05, 0x3C, 0x9F, 0x30, 0x70, 0x8B, 0x7E, 0xCF, 0x28, 0x45, 0x4C,
+    0x1A, 0x33, 0x65, 0x9C, 0x99, 0x43, 0xAC, 0x3C, 0x92, 0xCF, 0x9F, 0x6A, 0x4D, 0x46, 0x3F, 0xD4,
+    0x53, 0x57, 0x7A, 0x17, 0xE3, 0x89, 0xF1, 0xF9, 0x3C, 0xF1, 0x88, 0x37, 0xF1, 0x3C, 0xA4, 0xFD,
+    0x1F, 0xCC, 0x83, 0xD7, 0xD9, 0x9F, 0x9E, 0x7C, 0xCB, 0x18, 0xF3, 0x6C, 0x33, 0x43, 0x7B, 0x99,
+    0x27, 0x11, 0xBD, 0x9B, 0x56, 0x83, 0x53, 0x44, 0x6A, 0xDC, 0x41, 0x1A, 0xB1, 0x2A, 0x4C, 0x98,
+    0xA2, 0xC2, 0x48, 0x97, 0x04, 0x7A, 0xAC, 0x72, 0x01, 0xCD, 0xFC, 0xD4, 0x28, 0xE0, 0xD7, 0x9A,
+    0xF5, 0xB8, 0xA7, 0x65, 0x8B, 0x68, 0xF4, 0xED, 0x3C, 0x19, 0x72, 0x8D, 0x82, 0xEE, 0xAC, 0x82,
+    0x49, 0x17, 0xE6, 0x65, 0xF6, 0xD7, 0x95, 0xE2, 0x02, 0x3C, 0x50, 0x75, 0xD9, 0xF4, 0x8E, 0x25,
+    0x67, 0x79, 0x4C, 0x2A, 0xB3, 0x91, 0xA6, 0xDE, 0x48, 0x64, 0x60, 0x9F, 0xB8, 0x34, 0x62, 0xCA,
+    0x4D, 0x98, 0x0A, 0x36, 0x0A, 0xD1, 0x49, 0x4C, 0x68, 0xFE, 0x0F, 0x30, 0x20, 0x73, 0x40, 0x4E,
+    0xE3, 0x9C, 0x33, 0x46, 0xAD, 0x5F, 0x24, 0xE0, 0x99, 0xF5, 0xA5, 0x76, 0x7C, 0x45, 0x63, 0xA0,
+    0xD6, 0xDB, 0x16, 0x98, 0x75, 0x3C, 0xDB, 0x84, 0x86, 0x2B, 0x71, 0xCC, 0xD2, 0x59, 0x44, 0xC4,
+    0x5D, 0x3F, 0x15, 0x51, 0x59, 0x6B, 0xE5, 0xD8, 0x89, 0x28, 0x58, 0x44, 0x94, 0x1E, 0x59, 0x8F,
+    0xFB, 0xCB, 0xA2, 0x49, 0x97, 0x4C, 0xBA, 0x60, 0x1A, 0x9D, 0xF5, 0x38, 0x38, 0x47, 0x32, 0xD6,
+    0x5C, 0xB4, 0xBF, 0x44, 0x1A, 0x4F, 0x35, 0xD2, 0x28, 0x61, 0xEB, 0x8F, 0x22, 0x8D, 0xF3, 0x20,
+    0x43, 0xAF, 0x31, 0x68, 0xA1, 0x01, 0x51, 0xEF, 0x80, 0x4A, 0xE3, 0xB4, 0x11, 0xFB, 0x42, 0xC9,
+    0xF0, 0xF4, 0xD8, 0x8C, 0xE8, 0x19, 0x40, 0xA6, 0x8C, 0x2E, 0x99, 0x67, 0x96, 0x3B, 0xF3, 0x99,
+    0xBD, 0xAD, 0xAD, 0xA3, 0x45, 0xE1, 0xD9, 0x6D, 0x36, 0x63, 0x03, 0x82, 0x15, 0xCB, 0xB8, 0x10,
+    0xEC, 0x91, 0x60, 0x1E, 0x89, 0x6B, 0x23, 0xCC, 0xC8, 0x36, 0x29, 0x9B, 0xBC, 0x59, 0x27, 0xAD,
+    0x07, 0x04, 0x3C, 0xCE, 0xFC, 0x09, 0x58, 0xC8, 0xFE, 0x5A, 0x81, 0x60, 0x6B, 0x40, 0x30, 0xCF,
+    0x13, 0x63, 0x22, 0xCF, 0x04, 0x6B, 0x28, 0x18, 0x70, 0xC1, 0x13, 0x15, 0x77, 0x96, 0x3C, 0xF7,
+    0xBB, 0x9A, 0xC9, 0x56, 0x73, 0xAD, 0xC1, 0x06, 0xB7, 0xEA, 0x65, 0xB5, 0x5D, 0xF9, 0xEC, 0xEE,
+    0x17, 0xF4, 0xCC, 0xE3, 0x11, 0x33, 0x2C, 0x02, 0x78, 0x90, 0xCC, 0xA4, 0xEC, 0xD0, 0xE9, 0xCA,
+    0x67, 0x86, 0x4E, 0x3B, 0x53, 0xC2, 0x8A, 0x19, 0x50, 0xE8, 0x2E, 0x13, 0x4E, 0xF6, 0x17, 0xCC,
+    0xD8, 0x5B, 0xE6, 0x84, 0x96, 0xD3, 0x42, 0xBA, 0xC1, 0xE8, 0xBF, 0xF0, 0x06, 0xE3, 0xF9, 0x53,
+    0x38, 0x6F, 0x21, 0x36, 0xBA, 0x85, 0xC8, 0x89, 0x17, 0xFD, 0x49, 0xB7, 0x89, 0xE7, 0x2D, 0xC4,
+    0xD8, 0xFC, 0xE3, 0x65, 0xE8, 0xF6, 0x79, 0x76, 0xF4, 0x8C, 0x38, 0x25, 0xE9, 0x60, 0x52, 0xE5,
+    0xF2, 0xDC, 0x4D, 0xC2, 0xF3, 0xA7, 0x50, 0x6D, 0xAB, 0x3B, 0xDB, 0xD0, 0x2D, 0x7B, 0x12, 0xD3,
+    0xA9, 0x0D, 0x09, 0x9E, 0x37, 0x1F, 0x15, 0x24, 0x93, 0xC4, 0x4C, 0x4E, 0xC6, 0x08, 0x6A, 0x97,
+    0x93, 0xE7, 0xC4, 0xC4, 0x20, 0x93, 0x89, 0x83, 0xFA, 0x1E, 0x03, 0x57, 0x3D, 0x9B, 0x8F, 0x1E,
+    0x92, 0x4F, 0x99, 0x3A, 0x78, 0xD2, 0xD0, 0x6C, 0x32, 0x50, 0xB5, 0x9A, 0x3D, 0x28, 0xE6, 0x78,
+    0xC3, 0x25, 0xD6, 0xC6, 0xF9, 0x54, 0xA3, 0xB3, 0xE8, 0x1A, 0x05, 0x31, 0x65, 0x7A, 0x95, 0xD5,
+    0x32, 0x92, 0x72, 0xCD, 0x1D, 0xE5, 0x75, 0x11, 0x03, 0x6D, 0xAF, 0x99, 0xF7, 0xBD, 0x9F, 0x0F,
+    0x22, 0x06, 0x0B, 0xB9, 0x6D, 0x02, 0xFB, 0x38, 0xEF, 0x98, 0x3A, 0x1D, 0x02, 0xE7, 0x2E, 0x8B,
+    0x68, 0x0A, 0x18, 0x6F, 0x2C, 0x20, 0x38, 0x09, 0xDC, 0x87, 0x29, 0x70, 0x6A, 0x5B, 0xB1, 0x59,
+    0x97, 0xF5, 0xEC, 0x0A, 0xCA, 0x9F, 0xD0, 0xED, 0x9A, 0x3B, 0x67, 0xA0, 0x64, 0x28, 0xE9, 0xE4,
+    0xBB, 0x3A, 0xF7, 0x98, 0x1A, 0x66, 0x8F, 0x7F, 0x4A, 0x97, 0x4D, 0xF0, 0x6C, 0xF4, 0xF0, 0x52,
+    0xC8, 0xF4, 0x7F, 0x01, 0xD5, 0x5C, 0xBF, 0x93, 0xDD, 0x46, 0x72, 0x1E, 0x00, 0xC5, 0x85, 0x4B,
+    0x08, 0xC0, 0x80, 0x3C, 0x97, 0xC8, 0xB2, 0x91, 0x38, 0x38, 0xCB, 0x36, 0xF1, 0x07, 0xD8, 0x5A,
+    0x80, 0x62, 0x95, 0x19, 0x28, 0x30, 0x03, 0xD1, 0xE5, 0x2A, 0x07, 0x74, 0xA0, 0x40, 0x45, 0x57,
+    0x99, 0x0E, 0x1D, 0xE8, 0x08, 0xDC, 0xF9, 0x1F, 0x78, 0x0E, 0xE4, 0xC4, 0x81, 0x15, 0x30, 0xE0,
+    0xAD, 0x5C, 0xA5, 0x74, 0x7D, 0xB5, 0x22, 0x60, 0x5F, 0x70, 0x81, 0x02, 0xE3, 0xA4, 0x72, 0x39,
+    0x70, 0x20, 0x54, 0x99, 0x74, 0xD9, 0x72, 0x70, 0xB8, 0x12, 0x74, 0x06, 0x97, 0x0F, 0x98, 0xEB,
+    0xEF, 0x6B, 0xE0, 0xFD, 0xD8, 0x5D, 0xF1, 0xE7, 0xFE, 0x78, 0x5C, 0xF2, 0x75, 0xEF, 0x7B, 0xFB,
+    0xDE, 0x4C, 0xCF, 0x37, 0x3D, 0xDD, 0x3D, 0x3D, 0x3D, 0xCF, 0x38, 0xD6, 0x56, 0xC6, 0x98, 0x75,
+    0x76, 0xE0, 0x27, 0x98, 0x93, 0x85, 0x3D, 0x59, 0x64, 0xC9, 0x12, 0x65, 0xDB, 0x36, 0x07, 0xDB,
+    0xB3, 0x25, 0x58, 0xA7, 0xAD, 0xB4, 0x59, 0x2D, 0xCC, 0x6D, 0x92, 0x46, 0x98, 0x57, 0x27, 0xAD,
+    0x30, 0xBF, 0x8C, 0x3A, 0xB4, 0x55, 0x86, 0x68, 0x2D, 0xCC, 0xD9, 0x5A, 0x64, 0x82, 0x81, 0x6D,
+    0x59, 0x3B, 0xB2, 0xD4, 0x98, 0xCF, 0x8C, 0x8B, 0xD6, 0xE4, 0x6D, 0xC2, 0x1C, 0xF9, 0xAC, 0xAD,
+    0xA5, 0x2D, 0x63, 0xB2, 0xC6, 0x78, 0xC2, 0xA4, 0xB5, 0x00, 0xCF, 0xE6, 0xA6, 0xB0, 0x79, 0x60,
+    0x6D, 0x29, 0xFF, 0x43, 0x79, 0xC8, 0x53, 0xE9, 0xD5, 0x5A, 0xF9, 0x1B, 0x7F, 0xE3, 0x8F, 0x73,
+    0x43, 0x1E, 0x85, 0x48, 0xE5, 0x5B, 0xDB, 0x99, 0x70, 0x2E, 0x9D, 0x87, 0xAD, 0xF4, 0xE9, 0x37,
+    0xBE, 0x74, 0x7C, 0xDE, 0x47, 0xB7, 0x20, 0xDF, 0xFB, 0xC4, 0x4A, 0xAF, 0x22, 0x45, 0x34, 0x5C,
+    0xB7, 0xD2, 0x85, 0xBC, 0x96, 0x35, 0x20, 0x35, 0x49, 0x80, 0xA7, 0x21, 0xFE, 0x90, 0xC9, 0x5B,
+    0xEC, 0x37, 0x56, 0x5E, 0xFE, 0xA1, 0xF4, 0x74, 0x61, 0xEC, 0xE3, 0x06, 0x87, 0x0B, 0x21, 0x8D,
+    0xD3, 0x07, 0xEC, 0xBC, 0x50, 0x44, 0x12, 0x8C, 0xC8, 0x98, 0xAD, 0xFF, 0x31, 0xAF, 0x2B, 0xAE,
+    0x4E, 0x2A, 0xC3, 0x73, 0x6B, 0xB7, 0x36, 0xCE, 0xE3, 0xCB, 0x15, 0x10, 0x2E, 0x47, 0x29, 0xB7,
+    0x1E, 0x9A, 0x53, 0x84, 0xF9, 0x75, 0x51, 0x43, 0x74, 0xA2, 0x8B, 0x28, 0xE6, 0xD4, 0x9B, 0xBB,
+    0x8A, 0x91, 0x8A, 0x6D, 0x06, 0x65, 0xF6, 0xEF, 0xC9, 0x32, 0x15, 0x1F, 0xDD, 0x9F, 0x34, 0x86,
+    0x01, 0x84, 0x4A, 0xD0, 0xDB, 0x67, 0x20, 0xF3, 0x85, 0x4C, 0xF6, 0x23, 0xA8, 0x2B, 0xE4, 0xBA,
+    0xCC, 0xE7, 0x6F, 0x7D, 0x0C, 0xC1, 0x00, 0x1D, 0x40, 0x75, 0xF1, 0x9A, 0xDF, 0x12, 0xAC, 0x55,
+    0xE5, 0x15, 0x51, 0x67, 0x26, 0x84, 0xA8, 0x59, 0x1D, 0x0D, 0x8E, 0xCD, 0x3D, 0xEB, 0x41, 0x30,
+    0x01, 0xD4, 0x81, 0xEC, 0x66, 0x16, 0xA3, 0x8B, 0xA4, 0x5B, 0x27, 0xED, 0x82, 0xAC, 0xFF, 0x81,
+    0x6F, 0x8E, 0x38, 0x27, 0xC3, 0x38, 0xD0, 0x00, 0xF8, 0xC7, 0xA6, 0x78, 0xFC, 0xA7, 0xBD, 0x89,
+    0xD1, 0x91, 0x8C, 0x7A, 0xA6, 0x38, 0x99, 0x4B, 0xF7, 0xE4, 0x73, 0x58, 0xE9, 0x32, 0x35, 0xF2,
+    0x56, 0x4F, 0x9A, 0x08, 0x26, 0xF1, 0x6E, 0x00, 0xD6, 0x4A, 0xDE, 0xDC, 0x05, 0xF3, 0x60, 0x1E,
+    0xB5, 0x7E, 0x9F, 0x34, 0xDE, 0x5C, 0x1E, 0x75, 0xD6, 0xE8, 0xC0, 0x16, 0x0F, 0x9D, 0x4E, 0xB6,
+    0x24, 0x42, 0xFD, 0x86, 0xF4, 0xFF, 0x07, 0xA1, 0xBD, 0x3A, 0xF7, 0xAC, 0x6D, 0xD1, 0x06, 0xDB,
+    0x32, 0x97, 0x3E, 0x9E, 0x84, 0xB4, 0x82, 0x85, 0x3B, 0x2F, 0xA4, 0xAF, 0x3A, 0x2A, 0x4D, 0x98,
+    0x7A, 0xD5, 0xA6, 0x00, 0xB2, 0x75, 0x5F, 0x17, 0x06, 0x96, 0xC3, 0x10, 0x97, 0x6E, 0xE7, 0x37,
+    0x5E, 0x05, 0xA5, 0x3D, 0x09, 0x40, 0xB6, 0x66, 0x90, 0x8F, 0x32, 0x2F, 0x46, 0x14, 0x36, 0x87,
+    0xCC, 0xDB, 0x99, 0x02, 0xE2, 0xC8, 0xA4, 0xA1, 0x0F, 0x80, 0x82, 0x87, 0xDF, 0xAD, 0x48, 0x76,
+    0xCC, 0x80, 0xBC, 0x61, 0xDC, 0x99, 0x09, 0xAA, 0xB0, 0x14, 0x3D, 0xCC, 0x52, 0x55, 0x13, 0x93,
+    0x51, 0xE6, 0x66, 0x53, 0x00, 0x71, 0x73, 0x73, 0xCF, 0x6D, 0xC5, 0x70, 0x0D, 0x51, 0x45, 0xA7,
+    0x14, 0x0D, 0x0B, 0x8B, 0x7A, 0xEC, 0x80, 0x6C, 0xA5, 0x80, 0xDF, 0x6B, 0x7C, 0xF9, 0x80, 0x33,
+    0x8F, 0x4B, 0xBA, 0x43, 0x5A, 0x6B, 0x1A, 0x98, 0xB0, 0x5B, 0x57, 0x14, 0x31, 0xB8, 0xFF, 0xAB,
+    0x66, 0xB7, 0x15, 0x81, 0xAB, 0x3B, 0xF2, 0x56, 0x08, 0x53, 0x0A, 0x35, 0x45, 0x03, 0x2A, 0x3D,
+    0x09, 0x95, 0x01, 0x0B, 0x8D, 0x48, 0x05, 0x33, 0xD0, 0xE1, 0xD9, 0x34, 0xEA, 0x97, 0x9F, 0x15,
+    0xDC, 0x84, 0x66, 0x6C, 0x53, 0xCC, 0x39, 0x7A, 0xC9, 0x1D, 0x5B, 0x09, 0x16, 0xDA, 0xBB, 0xD0,
+    0x01, 0x46, 0xFB, 0xE2, 0xCD, 0xF4, 0x22, 0x05, 0xAB, 0x20, 0xF6, 0x65, 0x5B, 0xA9, 0xA1, 0xFC,
+    0x39, 0xF1, 0xB2, 0x5F, 0x70, 0x56, 0xED, 0x97, 0x5C, 0xFD, 0xEA, 0x6A, 0x94, 0x15, 0x2D, 0x98,
+    0x6F, 0x87, 0xA2, 0xC2, 0xA4, 0x5C, 0xC6, 0xB3, 0xB8, 0xF3, 0xC0, 0x92, 0xC6, 0x51, 0xC6, 0x77,
+    0x66, 0x23, 0xAB, 0x9F, 0xC2, 0xF4, 0x2D, 0xC9, 0xC4, 0x1C, 0x6D, 0xCC, 0xB5, 0xDA, 0xB4, 0xE0,
+    0x82, 0x8E, 0xB0, 0xDE, 0x1D, 0xDB, 0xC5, 0x10, 0xF3, 0xDC, 0x2B, 0x83, 0x79, 0xD1, 0x3E, 0x4A,
+    0xC3, 0x41, 0x14, 0xA7, 0x0A, 0x87, 0x4B, 0xF6, 0xEB, 0xD9, 0xB1, 0x81, 0xA9, 0x58, 0x2A, 0x94,
+    0x0B, 0xD0, 0x48, 0x3D, 0xFA, 0x5C, 0x77, 0xC7, 0xEE, 0xAF, 0xBF, 0x4E, 0x28, 0x7D, 0xDB, 0x17,
+    0xE8, 0xF9, 0xCF, 0xD1, 0x27, 0x71, 0x54, 0x1C, 0x14, 0x14, 0xED, 0x59, 0xE1, 0x5A, 0xA3, 0x3A,
+    0xCA, 0x91, 0x3A, 0xFC, 0xAC, 0xCB, 0x11, 0x00, 0x35, 0x05, 0x6D, 0xC4, 0x4C, 0x21, 0x0B, 0x2C,
+    0xD6, 0x4F, 0x48, 0xE7, 0xAF, 0xBF, 0xAF, 0x2B, 0xA7, 0xAC, 0x67, 0xA5, 0xD2, 0x96, 0x33, 0x50,
+    0xBE, 0xED, 0x43, 0xF4, 0xC2, 0xAA, 0xF4, 0x0B, 0xFA, 0x08, 0x63, 0xB7, 0x0C, 0x0B, 0xEC, 0xD7,
+    0x3B, 0xF9, 0x91, 0xEF, 0x59, 0xA7, 0xE2, 0xC6, 0x20, 0xEB, 0x48, 0x39, 0xDA, 0x1C, 0xBD, 0xDB,
+    0x91, 0xCA, 0x4A, 0x62, 0x84, 0xBB, 0x16, 0xE6, 0xD2, 0x2C, 0xDF, 0x91, 0x3F, 0xBA, 0x00, 0x3E,
+    0xE8, 0x65, 0x61, 0x87, 0x82, 0x97, 0xD8, 0x1F, 0x57, 0x22, 0x01, 0x21, 0x29, 0x80, 0xC8, 0xB3,
+    0xFD, 0x4F, 0x84, 0xA0, 0x95, 0xEC, 0xDB, 0x9B, 0x37, 0x53, 0xAC, 0x63, 0x2E, 0x64, 0x25, 0x62,
+    0xD1, 0xCF, 0xC1, 0x66, 0x4A, 0x34, 0x64, 0x7F, 0xF8, 0x00, 0x4D, 0xCD, 0xD1, 0x28, 0xFA, 0x78,
+    0x8F, 0xEA, 0x05, 0xB4, 0xC2, 0x34, 0x94, 0x11, 0x85, 0x55, 0x46, 0x8B, 0x33, 0x70, 0xCF, 0xC0,
+    0xE5, 0x1C, 0xCF, 0x36, 0x1C, 0x37, 0x44, 0xE9, 0x4E, 0xE3, 0xC8, 0x48, 0xFB, 0x80, 0xE0, 0x61,
+    0x3D, 0x21, 0xD0, 0xDB, 0xEA, 0xCC, 0x29, 0xC2, 0x68, 0x2E, 0x31, 0x2A, 0x64, 0x7C, 0x65, 0x2C,
+    0x2D, 0x49, 0x41, 0x9A, 0x94, 0x1B, 0x0E, 0xA0, 0x73, 0x0F, 0xEB, 0xA3, 0x9F, 0xFC, 0x0D, 0x89,
+    0x37, 0x5F, 0x17, 0xFA, 0xE4, 0x01, 0xDC, 0x38, 0x58, 0xA6, 0x70, 0x5F, 0xA3, 0xFD, 0xBB, 0x2B,
+    0xB1, 0xBE, 0x5A, 0x12, 0x86, 0xD7, 0x63, 0xA0, 0xCF, 0x00, 0xFB, 0x38, 0x31, 0xFA, 0x6D, 0xC1,
+    0xE8, 0xEA, 0x3A, 0x46, 0xD9, 0x14, 0xDD, 0x7B, 0xDC, 0xEF, 0x34, 0x13, 0xF1, 0x86, 0xF7, 0xC5,
+    0xD0, 0xDA, 0x76, 0x54, 0xBE, 0x37, 0xC5, 0x4B, 0x4B, 0xF8, 0x90, 0x43, 0xEC, 0xA0, 0xE1, 0x5C,
+    0xDA, 0xF9, 0x52, 0x27, 0xB3, 0x6A, 0xB3, 0xB5, 0x51, 0xE2, 0x99, 0xF7, 0x0D, 0x03, 0x1A, 0x46,
+    0x34, 0x22, 0x99, 0xB4, 0x8A, 0x98, 0x66, 0x19, 0xD4, 0x9C, 0xCE, 0x72, 0x46, 0xE4, 0x3D, 0x2E,
+    0x86, 0x71, 0xB3, 0x5F, 0x20, 0xE0, 0x41, 0x04, 0x2E, 0x90, 0x56, 0xA6, 0x3D, 0x10, 0x15, 0xDF,
+    0xB1, 0x0F, 0xE1, 0x65, 0xB0, 0xC5, 0x4C, 0x5A, 0xF1, 0xCB, 0x0E, 0x32, 0x17, 0xB5, 0x48, 0x65,
+    0x92, 0x0A, 0xDB, 0xC0, 0x24, 0x47, 0x24, 0x78, 0x41, 0x03, 0x3B, 0x0D, 0xF4, 0xD6, 0x69, 0xBB,
+    0x42, 0x3B, 0xE9, 0x72, 0x10, 0x7A, 0xD9, 0x3E, 0x16, 0xEA, 0xD8, 0x1A, 0x31, 0xA1, 0xB8, 0x60,
+    0xD2, 0x90, 0x73, 0xE4, 0xAF, 0x05, 0x00, 0x74, 0xD9, 0x11, 0x67, 0x42, 0xA2, 0xD1, 0xC7, 0x30,
+    0xDF, 0xEF, 0x4D, 0x83, 0x08, 0x87, 0x69, 0x08, 0x18, 0x01, 0x07, 0xB0, 0x90, 0x3F, 0x95, 0x18,
+    0x52, 0x42, 0xFC, 0xC2, 0x16, 0x02, 0x60, 0xF1, 0x6D, 0x2B, 0x61, 0x62, 0x77, 0x23, 0x6C, 0x65,
+    0xF9, 0x47, 0x8D, 0x37, 0xAC, 0x93, 0x5E, 0x50, 0xF6, 0xE7, 0xC6, 0xEB, 0x6F, 0x61, 0xD3, 0x8C,
+    0x19, 0xFD, 0xC9, 0x8F, 0x0D, 0xF7, 0xCC, 0x86, 0xA9, 0x91, 0x70, 0x7F, 0x67, 0x06, 0x04, 0x06,
+    0x3A, 0x7F, 0x99, 0x5B, 0x91, 0x26, 0xDE, 0xDF, 0xB1, 0x55, 0x96, 0x9B, 0xA4, 0x16, 0x71, 0x23,
+    0x44, 0x5D, 0x71, 0x29, 0x92, 0x64, 0x79, 0xF6, 0x70, 0x0B, 0xDB, 0x58, 0xF1, 0x31, 0xCE, 0xA7,
+    0xFB, 0x22, 0x1A, 0xB3, 0x11, 0x63, 0xAE, 0xC5, 0xE9, 0x2F, 0x73, 0x97, 0xCA, 0x4D, 0xB7, 0x62,
+    0x7F, 0x38, 0xCF, 0xB2, 0x89, 0x78, 0x6B, 0x4A, 0xA5, 0x79, 0x4A, 0x4A, 0x65, 0x63, 0xF0, 0xE6,
+    0x46, 0x4A, 0xB7, 0x52, 0x53, 0xEA, 0x45, 0xA9, 0xDF, 0x99, 0x23, 0x7F, 0x36, 0x52, 0xBF, 0xDD,
+    0x8F, 0xA7, 0x31, 0x44, 0xFD, 0x34, 0x82, 0xB5, 0x01, 0x6C, 0x0E, 0xDE, 0x1B, 0x8C, 0xE2, 0xF8,
+    0xC3, 0x64, 0x10, 0x93, 0x5F, 0x08, 0x04, 0x99, 0x8B, 0x63, 0xEA, 0x25, 0xE6, 0x5F, 0x35, 0x57,
+    0xF7, 0xC6, 0xE2, 0x85, 0xBB, 0x93, 0x3F, 0x74, 0xE9, 0x93, 0xBA, 0x8D, 0xD3, 0xEF, 0x1D, 0x0A,
+    0xE4, 0x69, 0x02, 0x31, 0x54, 0x07, 0x14, 0x7F, 0xCE, 0xD1, 0x3D, 0x70, 0x08, 0x6F, 0x6B, 0xDE,
+    0x3E, 0xA8, 0xE5, 0xE2, 0x84, 0xE0, 0x54, 0x46, 0xE6, 0x8A, 0xCF, 0x8C, 0xD5, 0x23, 0x42, 0xB5,
+    0x5E, 0x80, 0x3D, 0xBA, 0x79, 0xAB, 0xA7, 0x67, 0x44, 0xCE, 0x40, 0x5C, 0xE3, 0xA7, 0xFD, 0xCB,
+    0xB4, 0x42, 0x26, 0xF3, 0x6A, 0x74, 0xEF, 0xB5, 0x22, 0x99, 0x26, 0xAF, 0x46, 0x45, 0xB0, 0x3A,
+    0x03, 0x85, 0x19, 0x13, 0x58, 0x12, 0xCC, 0x23, 0x74, 0xB9, 0x78, 0x53, 0x03, 0x94, 0x94, 0x59,
+    0xD5, 0x94, 0x60, 0x80, 0xBA, 0x47, 0xD1, 0xF3, 0xA0, 0xEF, 0xD2, 0xA7, 0x66, 0x32, 0x6A, 0xD7,
+    0xEE, 0xEB, 0x3E, 0x33, 0x41, 0xAE, 0xA1, 0x14, 0x95, 0x92, 0x4D, 0x60, 0x08, 0x9A, 0xBE, 0x04,
+    0xF5, 0x6C, 0x29, 0x03, 0xC9, 0x6C, 0x27, 0xD3, 0x90, 0xD9, 0xB9, 0xD0, 0xE7, 0xC0, 0xF9, 0x22,
+    0x40, 0x1C, 0xDE, 0x83, 0x03, 0x97, 0x69, 0x1D, 0x9F, 0x9D, 0x36, 0xCE, 0x4F, 0xC7, 0xB0, 0xB0,
+    0x88, 0x17, 0xFE, 0x52, 0x76, 0xD4, 0x07, 0xF1, 0x5C, 0x45, 0x72, 0xF8, 0x0E, 0x24, 0xF3, 0x57,
+    0xC4, 0x10, 0xE9, 0xB0, 0x68, 0xEE, 0x95, 0x89, 0xFD, 0xC7, 0x52, 0x24, 0x49, 0xBB, 0xC8, 0x9A,
+    0x1B, 0x6E, 0xBB, 0xAA, 0xCB, 0x29, 0x1E, 0x40, 0x97, 0x01, 0xD8, 0x31, 0x3C, 0x00, 0xD2, 0xD4,
+    0x2E, 0xFA, 0x0F, 0x7B, 0x4F, 0xE6, 0xF2, 0x1F, 0x4A, 0x99, 0xA5, 0x7C, 0x17, 0xFD, 0x3B, 0xBB,
+    0x8B, 0xFE, 0x23, 0x1A, 0x1B, 0x7C, 0x06, 0xFB, 0xFE, 0x17, 0x7C, 0x88, 0xCC, 0x91, 0xE5, 0x8A,
+    0x96, 0xB5, 0xDB, 0x2F, 0x1E, 0xA7, 0x35, 0x36, 0x99, 0x39, 0xD9, 0x8A, 0x67, 0x76, 0xCC, 0xF3,
+    0x65, 0x78, 0x25, 0xF5, 0xD1, 0xDF, 0xB3, 0xFF, 0xCB, 0x4C, 0xC9, 0x04, 0xC9, 0xFF, 0x0B, 0x12,
+    0x61, 0xC6, 0xF2, 0x2F, 0xFA, 0xF9, 0x03, 0x11, 0x1E, 0x53, 0x28, 0x93, 0xF3, 0x57, 0xF9, 0xA9,
+    0x0D, 0xE2, 0x86, 0xB9, 0xB0, 0x67, 0xF6, 0xB2, 0x3F, 0xEE, 0x12, 0xDB, 0x84, 0xE2, 0x6B, 0x7E,
+    0x62, 0x5E, 0x65, 0x34, 0x27, 0x2D, 0x2D, 0x13, 0xFD, 0x77, 0x75, 0x8F, 0x03, 0xFB, 0x0C, 0xBF,
+    0xE2, 0xD8, 0x3F, 0x53, 0xF3, 0x16, 0x8B, 0x7F, 0xF9, 0x40, 0x00, 0x84, 0x3D, 0x97, 0x15, 0xE8,
+    0xAC, 0x24, 0x73, 0x5E, 0x6E, 0x34, 0xE6, 0x8A, 0x71, 0x3A, 0x38, 0x1B, 0x89, 0x86, 0xC5, 0xE5,
+    0xF9, 0xFD, 0x5F, 0x78, 0x32, 0xAE, 0xA2, 0x36, 0x97, 0x0C, 0x0F, 0x86, 0x16, 0x52, 0x66, 0xF9,
+    0x41, 0x07, 0x71, 0xC2, 0x8A, 0xF7, 0x92, 0x73, 0x73, 0x5D, 0x6C, 0x91, 0xB0, 0x77, 0xAD, 0x6D,
+    0x20, 0x5B, 0xA2, 0x76, 0x4D, 0x23, 0x02, 0x13, 0x9D, 0x3E, 0xA3, 0x39, 0x9D, 0x73, 0x5C, 0x4B,
+    0x66, 0xA6, 0xF4, 0xB6, 0xCE, 0xE8, 0x92, 0x25, 0xBA, 0xD0, 0x0A, 0x66, 0x4F, 0x5C, 0x3D, 0x6D,
+    0xCB, 0x74, 0x92, 0x99, 0x51, 0xF9, 0xC0, 0x98, 0xFB, 0x3A, 0xFD, 0xD0, 0x00, 0x1F, 0x43, 0x97,
+    0xFF, 0x46, 0xF4, 0xC0, 0xED, 0x8F, 0x08, 0x56, 0x05, 0xC2, 0xC2, 0x8E, 0x54, 0xDE, 0x1C, 0x20,
+    0x1B, 0x9F, 0x7A, 0xC7, 0x41, 0x05, 0x72, 0x0F, 0x2D, 0xCF, 0x17, 0x94, 0x3E, 0xE1, 0x20, 0xF5,
+    0x87, 0x65, 0x44, 0x7D, 0xA7, 0xE3, 0xCB, 0x18, 0x86, 0xF7, 0x78, 0x3C, 0x77, 0x42, 0x34, 0x27,
+    0xE6, 0xCC, 0x9D, 0x67, 0xC6, 0x17, 0x97, 0x1D, 0xE6, 0xEE, 0x62, 0x5F, 0x1E, 0x22, 0x4D, 0x0B,
+    0xC7, 0x92, 0xCD, 0xD5, 0xC1, 0x9F, 0xD8, 0x63, 0x4C, 0xF9, 0x33, 0x21, 0x9B, 0x9B, 0x42, 0x84,
+    0x2D, 0x90, 0xEC, 0xDB, 0x49, 0x39, 0x03, 0xBE, 0x68, 0x51, 0xF8, 0xA5, 0xC4, 0x98, 0xE9, 0x67,
+    0x66, 0x77, 0x0C, 0x02, 0x5F, 0xD9, 0xAC, 0x1F, 0x69, 0xEA, 0x4B, 0x3E, 0xC4, 0x21, 0x4A, 0xB4,
+    0x67, 0x10, 0xA5, 0x9A, 0x22, 0xE7, 0x4A, 0xBB, 0xAE, 0xA9, 0x89, 0xEB, 0x12, 0x02, 0x3A, 0xB6,
+    0x9E, 0x96, 0x4B, 0xA1, 0x99, 0x84, 0x39, 0x19, 0xC3, 0x45, 0x5B, 0xF1, 0x10, 0xD4, 0x56, 0xCC,
+    0xD5, 0xD8, 0xEA, 0x33, 0x4D, 0xE7, 0x53, 0xB5, 0xEC, 0x7F, 0x68, 0xF6, 0xE3, 0x17, 0x9A, 0xEA,
+    0x67, 0x32, 0xD8, 0xD8, 0x27, 0x0C, 0x0B, 0xED, 0x17, 0x56, 0x3F, 0x67, 0xB5, 0x15, 0x9E, 0xED,
+    0x88, 0xA7, 0xEE, 0xC9, 0x42, 0xAB, 0x4D, 0x5B, 0xE6, 0x35, 0x3C, 0x8A, 0x59, 0x3B, 0x9A, 0x00,
+    0x17, 0xC5, 0xE2, 0x72, 0x0D, 0x6C, 0x7A, 0xE8, 0x78, 0x4C, 0x15, 0xD2, 0x55, 0x35, 0xF7, 0xD4,
+    0x1F, 0x7B, 0x9A, 0xD1, 0xF5, 0x35, 0x17, 0xE8, 0x18, 0xF3, 0x82, 0xE1, 0x19, 0xE9, 0x55, 0x6B,
+    0x17, 0x34, 0x4D, 0x6A, 0x52, 0xCC, 0x95, 0x4C, 0x90, 0xD0, 0x77, 0x3A, 0x06, 0x1E, 0x35, 0xE8,
+    0xAD, 0x06, 0xB4, 0xE0, 0x2B, 0x30, 0x9F, 0xAE, 0xFD, 0x0A, 0xD9, 0x78, 0x7B, 0x8D, 0x61, 0xC9,
+    0x3B, 0x44, 0x3B, 0x65, 0x70, 0x92, 0xCA, 0x98, 0x65, 0x68, 0x12, 0x7D, 0x89, 0x36, 0x07, 0xB4,
+    0x27, 0x4E, 0x71, 0x20, 0x63, 0x19, 0x51, 0xF8, 0x58, 0xEB, 0x1E, 0x38, 0x5E, 0x1E, 0x37, 0x9B,
+    0x0F, 0x49, 0xCF, 0x73, 0x14, 0x90, 0x4A, 0xA9, 0xFF, 0x2C, 0xD9, 0x48, 0x8B, 0x66, 0x29, 0xDB,
+    0x2F, 0x06, 0x0D, 0x99, 0x54, 0xC2, 0x92, 0x63, 0x64, 0x0B, 0x45, 0x0B, 0xD9, 0x12, 0x84, 0x3D,
+    0x12, 0xF0, 0x40, 0x36, 0x9A, 0x06, 0x1E, 0x64, 0x53, 0x75, 0x44, 0x2D, 0x08, 0x1C, 0x21, 0xD7,
+    0xFA, 0x8C, 0x28, 0x3D, 0x1C, 0xD2, 0xA7, 0x13, 0x75, 0x35, 0xB3, 0xFE, 0xCC, 0x2C, 0xD5, 0x8B,
+    0x52, 0xD9, 0xF8, 0x63, 0x15, 0xE5, 0xCF, 0x95, 0x58, 0x74, 0x77, 0xB4, 0x30, 0x20, 0xC2, 0x1A,
+    0xC4, 0x1A, 0xE0, 0x56, 0x84, 0xFA, 0x00, 0x6D, 0x80, 0x2E, 0x40, 0x13, 0xDC, 0x63, 0x7C, 0x40,
+    0x79, 0xE1, 0xF4, 0xF0, 0xD8, 0x38, 0x3C, 0xD6, 0x7E, 0x46, 0x2D, 0xCB, 0x97, 0x5A, 0xF6, 0x03,
+    0xD2, 0x6E, 0x91, 0xF8, 0x13, 0x9C, 0x04, 0xA6, 0x88, 0x2E, 0xC0, 0x7D, 0xD9, 0xFF, 0xCB, 0x38,
+    0x60, 0xAA, 0xDE, 0x90, 0x65, 0xEB, 0x32, 0x20, 0xF0, 0x28, 0x3E, 0xD7, 0x38, 0xE9, 0x40, 0x94,
+    0xE8, 0xD7, 0x58, 0x2D, 0x42, 0x93, 0x23, 0x7B, 0xEA, 0xFC, 0x54, 0x51, 0x92, 0x51, 0xCB, 0x56,
+    0xE8, 0x9D, 0x79, 0x64, 0xAF, 0xC9, 0xCE, 0xFA, 0x9A, 0xF8, 0xF8, 0xEB, 0xB2, 0xAD, 0x7F, 0x37,
+    0xDF, 0x1C, 0xED, 0xB8, 0xA7, 0x56, 0x52, 0x4D, 0xE6, 0x4A, 0xEE, 0xA1, 0x7F, 0xD5, 0x71, 0x8F,
+    0x46, 0x92, 0x36, 0xD2, 0x53, 0xB9, 0x9E, 0x9B, 0xDC, 0xA7, 0x49, 0x11, 0x72, 0x1D, 0xD3, 0x7E,
+    0x0D, 0xE4, 0xEA, 0xF0, 0x8C, 0x8F, 0xD1, 0xD2, 0x53, 0x35, 0x48, 0x5E, 0x08, 0x91, 0xBF, 0xE6,
+    0x01, 0x32, 0xBD, 0x89, 0xBA, 0x16, 0xF5, 0x3A, 0xCB, 0x4F, 0x05, 0xA4, 0x31, 0xE9, 0xF7, 0x5F,
+    0x16, 0x91, 0x67, 0xE9, 0xFF, 0x3F, 0xB9, 0xB0, 0x94, 0xB5, 0x8B, 0x02, 0x26, 0x71, 0x53, 0xE9,
+    0x1F, 0x3E, 0x55, 0xFF, 0x5D, 0xCD, 0x94, 0x04, 0x63, 0xFD, 0x95, 0x3A, 0xAC, 0x44, 0xE3, 0x91,
+    0x07, 0xEA, 0xAF, 0x5A, 0x73, 0x38, 0x51, 0x92, 0xCB, 0xA3, 0xC6, 0xE9, 0x6F, 0x02, 0xAF, 0xD8,
+    0x30, 0x66, 0xC7, 0x91, 0xA1, 0x46, 0x36, 0x64, 0x96, 0xEC, 0x89, 0xE0, 0x89, 0xD7, 0x05, 0x05,
+    0x30, 0x09, 0x39, 0xC0, 0x24, 0x0C, 0x04, 0x0B, 0x07, 0x32, 0x71, 0x1A, 0x60, 0x62, 0xDE, 0xD9,
+    0x82, 0xAD, 0xC9, 0x92, 0x96, 0x2C, 0x9A, 0x93, 0x85, 0xDA, 0xBA, 0xA7, 0xCC, 0x19, 0xFB, 0x2A,
+    0x94, 0x21, 0x01, 0x26, 0x02, 0x44, 0x1D, 0x0F, 0xA4, 0x03, 0xB0, 0x7A, 0xCC, 0x4A, 0xDD, 0xCE,
+    0xE9, 0x28, 0x4A, 0x9E, 0x95, 0x70, 0xA4, 0x7C, 0x39, 0xE2, 0x08, 0xAF, 0xAC, 0x0E, 0xEA, 0x3C,
+    0xC6, 0x15, 0x70, 0x64, 0xB2, 0x65, 0x92, 0x9E, 0xC6, 0x24, 0x48, 0x7C, 0x52, 0x49, 0x90, 0xD7,
+    0x06, 0xC3, 0xF5, 0x08, 0x47, 0x03, 0x73, 0x67, 0x8C, 0x70, 0xF4, 0x0D, 0x5E, 0x73, 0x28, 0xC2,
+    0x39, 0x7D, 0x44, 0x0F, 0xF8, 0x92, 0x6A, 0x79, 0xFE, 0x9A, 0xAC, 0x9C, 0xE2, 0xED, 0x2D, 0x7C,
+    0x89, 0x11, 0xAB, 0xF5, 0xA6, 0xEA, 0x39, 0xB5, 0x3F, 0xFE, 0xDB, 0x56, 0x43, 0xF0, 0x5A, 0x43,
+    0x79, 0x7E, 0xD4, 0xB1, 0xAF, 0xAF, 0xF6, 0xBF, 0x69, 0xB6, 0x44, 0xFB, 0xC3, 0x12, 0x99, 0x5C,
+    0xBF, 0x29, 0x18, 0x46, 0x6A, 0x3C, 0xAC, 0x29, 0xE4, 0xFA, 0xEC, 0xB4, 0x7F, 0xAC, 0xEB, 0x1B,
+    0x77, 0x7E, 0x49, 0xBB, 0xCA, 0xC2, 0x76, 0xA1, 0x53, 0x62, 0x1A, 0xDD, 0x6F, 0x6C, 0x23, 0x9B,
+    0x21, 0xFF, 0x4B, 0xFB, 0x2B, 0x01, 0x35, 0x16, 0x8B, 0xF6, 0x7F, 0x36, 0xDF, 0x35, 0x28, 0xB5,
+    0x2A, 0x59, 0x29, 0x35, 0xB1, 0x6A, 0xC9, 0xBA, 0x97, 0x63, 0xC9, 0x1C, 0xC6, 0xDA, 0x43, 0xD9,
+    0x67, 0xAF, 0x6C, 0x78, 0x85, 0xB9, 0x6E, 0x8F, 0x98, 0x6B, 0x4F, 0xE7, 0xDA, 0x19, 0xE7, 0xBA,
+    0x68, 0x74, 0xAE, 0x3B, 0x9D, 0xE4, 0x9E, 0xCC, 0xD7, 0xD6, 0xDD, 0xA9, 0x93, 0xC5, 0x24, 0x83,
+    0x45, 0x3A, 0xD7, 0x81, 0xCE, 0xB5, 0xA7, 0x73, 0xED, 0x8C, 0xAB, 0x74, 0x9D, 0xB5, 0xAB, 0xD6,
+    0x7B, 0x5C, 0xA0, 0x1A, 0x25, 0x1B, 0x55, 0xED, 0xF1, 0x28, 0xFB, 0xBC, 0x4E, 0x3C, 0xE7, 0x9D,
+    0xD3, 0xCE, 0x59, 0xE7, 0xA4, 0x73, 0xCE, 0x39, 0x85, 0xCF, 0x4B, 0x30, 0xD3, 0x73, 0x4C, 0x34,
+    0xDC, 0x8B, 0x56, 0xE3, 0xAE, 0x13, 0x16, 0xEA, 0x72, 0xDA, 0xB1, 0xDD, 0xE7, 0xF6, 0x2A, 0xD0,
+    0x9D, 0x4A, 0xC9, 0xBA, 0xA1, 0x92, 0xBF, 0xE7, 0x87, 0x8A, 0x0E, 0x19, 0x03, 0x00, 0x8B, 0xA2,
+    0x0E, 0xE0, 0xC3, 0xC5, 0x37, 0xE6, 0x88, 0x31, 0x8A, 0x8A, 0x15, 0x92, 0x4D, 0xC4, 0xFD, 0x32,
+    0xD2, 0x0B, 0xF1, 0x1C, 0x58, 0x45, 0x13, 0x6D, 0xB1, 0x13, 0x3F, 0x82, 0xAE, 0xBC, 0x47, 0x3F,
+    0xC5, 0x16, 0x3A, 0x6D, 0x0D, 0x3B, 0xF8, 0xAC, 0x46, 0x40, 0x80, 0xC3, 0x13, 0xD4, 0xE0, 0x6A,
+    0xE5, 0xDD, 0x24, 0x1B, 0xCB, 0x55, 0x9F, 0x52, 0xB3, 0x53, 0xE9, 0xF6, 0x26, 0xE8, 0x25, 0x24,
+    0x82, 0x72, 0xE5, 0x71, 0x23, 0x2D, 0xC9, 0xB0, 0x8B, 0x4A, 0x6C, 0x40, 0x86, 0x02, 0xBC, 0xAC,
+    0xC9, 0xEA, 0x05, 0xC1, 0xD3, 0x04, 0x7F, 0xE0, 0x5B, 0xF8, 0xE6, 0x10, 0x1F, 0x63, 0x03, 0xBA,
+    0x53, 0x8A, 0x17, 0xA7, 0xD3, 0x4E, 0xEA, 0x20, 0x50, 0x29, 0x61, 0x6D, 0xBD, 0x16, 0x29, 0x7F,
+    0xC7, 0x6A, 0x46, 0x7A, 0x58, 0x99, 0xE3, 0x4D, 0x47, 0x8F, 0xF5, 0xF5, 0x2D, 0xB4, 0xB4, 0xC7,
+    0xA1, 0x7A, 0x86, 0xE1, 0x45, 0xAC, 0x4D, 0x7E, 0x6C, 0x4E, 0x11, 0x4C, 0x73, 0x69, 0x86, 0x08,
+    0x28, 0xF9, 0x02, 0xD8, 0x15, 0xD7, 0xA0, 0xA2, 0x03, 0xCA, 0x5E, 0xDD, 0x0E, 0xC0, 0x7A, 0xD5,
+    0x95, 0xD7, 0x02, 0xCC, 0xAD, 0x7B, 0x6F, 0xE5, 0x62, 0x37, 0x8B, 0x5C, 0xB6, 0xEB, 0x38, 0x4E,
+    0xFC, 0x91, 0x34, 0xF0, 0x00, 0xB0, 0xB6, 0x8B, 0x02, 0xEA, 0x53, 0x01, 0x73, 0x09, 0x12, 0x8E,
+    0x6D, 0x78, 0xDA, 0x08, 0x5E, 0x88, 0xD8, 0xB9, 0x2F, 0x36, 0x25, 0xC7, 0x89, 0x9C, 0x78, 0x3C,
+    0x9E, 0xCC, 0x61, 0x80, 0xE0, 0xBB, 0xD1, 0x9C, 0xFC, 0x42, 0xAC, 0x1C, 0xB6, 0x6E, 0x9D, 0x23,
+    0x13, 0xF0, 0xD1, 0x4D, 0xE5, 0x48, 0x95, 0x82, 0x7F, 0xBD, 0xA3, 0xCF, 0x8F, 0x78, 0xFF, 0xD4,
+    0xCE, 0xD8, 0xAE, 0x19, 0xFB, 0x89, 0xFD, 0x41, 0x39, 0x43, 0x60, 0xB1, 0xEB, 0x84, 0x33, 0x97,
+    0x2D, 0x78, 0x4C, 0x39, 0x07, 0x56, 0xE0, 0x83, 0x2B, 0xA8, 0x8A, 0xD9, 0x58, 0x6E, 0x12, 0x8F,
+    0x15, 0x27, 0x5A, 0x74, 0xE2, 0xD9, 0x5E, 0x22, 0x66, 0xE0, 0xA7, 0xA5, 0x27, 0x06, 0x56, 0x33,
+    0x05, 0x44, 0xAC, 0x3D, 0x01, 0x68, 0x23, 0xDF, 0xFF, 0x44, 0x82, 0x6D, 0x41, 0x12, 0xE7, 0x97,
+    0xE0, 0x63, 0x31, 0xCA, 0x54, 0x8F, 0x32, 0xF1, 0xA2, 0xD5, 0xC2, 0x62, 0x01, 0x6B, 0x8B, 0xED,
+    0xF6, 0x26, 0x64, 0x3F, 0xF6, 0xEF, 0x0A, 0xF4, 0xDB, 0x8D, 0x15, 0x2A, 0xB3, 0x88, 0x60, 0xDF,
+    0x98, 0xF0, 0xDE, 0x79, 0x5A, 0x78, 0xBB, 0x6D, 0x9E, 0x5E, 0x92, 0x3B, 0x1E, 0x12, 0xA7, 0x63,
+    0x82, 0x6B, 0x3A, 0x2A, 0x3E, 0x4C, 0x3D, 0xBE, 0x87, 0x1B, 0xBB, 0x47, 0x77, 0xE8, 0xF1, 0x98,
+    0x16, 0x7B, 0xA2, 0xA9, 0x72, 0xCD, 0xCC, 0x15, 0xDC, 0x18, 0x33, 0xB5, 0x59, 0x45, 0xFD, 0x94,
+    0x42, 0x5B, 0x69, 0xDF, 0xA1, 0xFF, 0x4C, 0x90, 0x2A, 0x1A, 0x40, 0xD1, 0x1C, 0x0F, 0x32, 0x89,
+    0x01, 0x57, 0xFE, 0x30, 0x1D, 0x44, 0x07, 0xF9, 0x6A, 0x64, 0x92, 0x0C, 0xF2, 0xDE, 0xC4, 0xC6,
+    0x50, 0x9F, 0x0C, 0x29, 0xD8, 0xA6, 0x28, 0x45, 0xFE, 0x4C, 0xF6, 0x32, 0xE5, 0xEF, 0x30, 0x75,
+    0x38, 0x91, 0xA7, 0xEF, 0xEC, 0x96, 0xDB, 0x3B, 0xAC, 0x29, 0xB8, 0xED, 0xCD, 0x43, 0x64, 0xF5,
+    0x47, 0xCB, 0xEF, 0x43, 0xCD, 0x6C, 0x95, 0xCB, 0x72, 0xB4, 0xED, 0x95, 0x33, 0xF9, 0x13, 0x85,
+    0x67, 0xE5, 0xA7, 0x98, 0x02, 0x06, 0x06, 0xFE, 0x3C, 0x68, 0x64, 0x5A, 0xD3, 0xA1, 0x44, 0xBF,
+    0xCB, 0xBA, 0xB3, 0x58, 0xEB, 0xCE, 0x6A, 0xAD, 0x3B, 0xEB, 0x9E, 0x5A, 0x77, 0xB6, 0x51, 0xB0,
+    0xBB, 0x33, 0xD4, 0x9D, 0x75, 0x18, 0xD5, 0x83, 0x70, 0xAA, 0x3B, 0x63, 0x06, 0xD8, 0xEF, 0x4F,
+    0x47, 0x11, 0xC5, 0x84, 0xFF, 0x78, 0x0A, 0x91, 0x18, 0x1D, 0xF1, 0xE4, 0x89, 0x15, 0x16, 0xEB,
+    0xEE, 0x3C, 0xB6, 0x33, 0xDA, 0x03, 0xBD, 0x46, 0x14, 0x57, 0x28, 0x7A, 0x13, 0x64, 0x40, 0x7A,
+    0xE0, 0x7C, 0x63, 0xBC, 0x55, 0x30, 0x98, 0xD1, 0x30, 0x87, 0xE8, 0xC3, 0xE3, 0x59, 0x75, 0x01,
+    0x1B, 0x12, 0xB0, 0x3B, 0x26, 0x55, 0x02, 0x5B, 0x9E, 0x83, 0xF1, 0x48, 0x70, 0xE5, 0x46, 0x26,
+    0x38, 0x43, 0x35, 0x45, 0x91, 0x17, 0x68, 0x4F, 0x5C, 0x0E, 0x6E, 0x1B, 0x88, 0x5D, 0xDA, 0x22,
+    0xC6, 0xE7, 0x38, 0xCF, 0xB7, 0x67, 0x63, 0xB6, 0x5E, 0x90, 0x99, 0xAB, 0x6A, 0x4E, 0x0E, 0xD2,
+    0xC1, 0xE8, 0xC4, 0x26, 0x3E, 0x91, 0x50, 0xB2, 0x4C, 0xCA, 0x2C, 0x0D, 0xCB, 0x22, 0x0D, 0x53,
+    0xE6, 0xF9, 0x79, 0x87, 0xE5, 0xA1, 0xB8, 0x83, 0x01, 0xF7, 0xA0, 0x4A, 0x56, 0xDA, 0xC9, 0x14,
+    0xFC, 0xBE, 0x58, 0xBC, 0x3D, 0xD1, 0xF2, 0x41, 0x1A, 0x2A, 0xD2, 0xB8, 0x4C, 0x9E, 0x20, 0xA7,
+    0x2E, 0x13, 0x87, 0x32, 0x7D, 0x97, 0xD5, 0x6B, 0x96, 0xC3, 0x90, 0xFE, 0x33, 0x31, 0x69, 0xCE,
+    0x5C, 0xC2, 0x58, 0xC1, 0x63, 0x77, 0x63, 0x00, 0x79, 0x6B, 0xC6, 0x42, 0x5F, 0x6C, 0xC8, 0xBC,
+    0x56, 0x86, 0x51, 0x26, 0xE9, 0x15, 0x13, 0x94, 0x27, 0x02, 0xC8, 0x99, 0x8E, 0x96, 0x3B, 0x7B,
+    0x1E, 0x67, 0xE8, 0x11, 0x17, 0x77, 0xD4, 0x20, 0xE7, 0x8B, 0xA9, 0x3B, 0x76, 0x7C, 0x9C, 0x83,
+    0x86, 0x66, 0xC5, 0xB9, 0x5E, 0x4A, 0x72, 0xC7, 0x73, 0x61, 0x1F, 0x1B, 0xA3, 0x86, 0xAB, 0x6C,
+    0x6D, 0xD1, 0xD6, 0xDF, 0xB5, 0x68, 0xCF, 0x58, 0x43, 0xB0, 0x05, 0x8F, 0xF2, 0x38, 0xF7, 0x9B,
+    0x07, 0xBA, 0xF9, 0x86, 0x41, 0x9C, 0xCC, 0xE1, 0x31, 0x6B, 0x08, 0x8B, 0x65, 0x4A, 0x86, 0x5E,
+    0x55, 0x91, 0xDA, 0xFA, 0x56, 0xB5, 0x87, 0x08, 0x87, 0xD4, 0xAB, 0x76, 0x49, 0xDF, 0x17, 0xEA,
+    0xCE, 0x16, 0x49, 0xC9, 0xE3, 0xA5, 0x8D, 0x9A, 0x76, 0x3D, 0xBE, 0x83, 0xC2, 0xFC, 0x96, 0xE2,
+    0xAF, 0x85, 0x64, 0xED, 0xF2, 0x60, 0x4C, 0x93, 0x47, 0xAC, 0xD5, 0xE3, 0x51, 0xBA, 0x5A, 0x4D,
+    0x7A, 0x37, 0xE8, 0x54, 0x96, 0xF2, 0x68, 0xE7, 0x32, 0x4F, 0xC4, 0x6D, 0xFE, 0x9B, 0xF6, 0x23,
+    0xDA, 0xCC, 0xE7, 0x7D, 0xA0, 0x31, 0xC7, 0x3E, 0x4A, 0x59, 0x81, 0x09, 0xAD, 0xF0, 0x65, 0xC0,
+    0xC1, 0xC3, 0x31, 0xC9, 0x59, 0x68, 0x35, 0x35, 0xD2, 0x58, 0xC5, 0x5C, 0x77, 0xA1, 0x93, 0xF7,
+    0x4A, 0xE8, 0xBD, 0xFA, 0x67, 0x79, 0xAF, 0xCD, 0xC3, 0x19, 0xC1, 0x20, 0x52, 0xED, 0x48, 0xFA,
+    0x88, 0x89, 0x8C, 0xAF, 0x57, 0x26, 0x79, 0x37, 0x37, 0xBC, 0xB6, 0x46, 0x1C, 0x91, 0x3D, 0x06,
+    0x8E, 0xE9, 0x8B, 0x9D, 0x0E, 0x10, 0xC7, 0x9C, 0x38, 0xC2, 0x08, 0x4B, 0x54, 0xFC, 0xEA, 0x63,
+    0x77, 0x76, 0xEC, 0xFE, 0x3D, 0x46, 0xDA, 0xED, 0xCB, 0x8E, 0x3D, 0x9E, 0x92, 0xF2, 0xF9, 0x0B,
+    0xE9, 0x0C, 0x7C, 0xFD, 0xEF, 0xD9, 0x9D, 0xE7, 0xD3, 0x19, 0xEE, 0x00, 0xCE, 0x8D, 0xB1, 0x4F,
+    0x1D, 0x31, 0xCA, 0x1E, 0x90, 0x41, 0xF4, 0x9E, 0x68, 0xC5, 0x5D, 0x85, 0xEC, 0x9B, 0x84, 0x3F,
+    0xC1, 0xEC, 0x70, 0xFD, 0x81, 0x75, 0x54, 0x0C, 0x30, 0x9C, 0xFD, 0x07, 0x35, 0x63, 0x74, 0xBF,
+    0x52, 0x56, 0x9E, 0x24, 0x33, 0x13, 0xAB, 0xC4, 0x1D, 0xD1, 0x3B, 0xE1, 0x50, 0x34, 0xE9, 0xA9,
+    0xF8, 0x21, 0xB7, 0x11, 0x7A, 0x23, 0x79, 0xDA, 0x3B, 0x8E, 0x14, 0xC5, 0x5C, 0x80, 0xF6, 0x3F,
+    0xAB, 0x49, 0xAD, 0xF6, 0x68, 0x4C, 0xDF, 0x73, 0x76, 0x0F, 0x06, 0x6F, 0x0E, 0x8F, 0x8A, 0xAE,
+    0x0A, 0x95, 0x98, 0x8A, 0x9B, 0x2D, 0x4D, 0xF2, 0xBD, 0x30, 0xD5, 0xB4, 0x62, 0x0C, 0x5A, 0xE2,
+    0xD6, 0xA9, 0xDD, 0x87, 0x78, 0x85, 0xFD, 0x1C, 0xC5, 0x2B, 0xD6, 0x9F, 0xAE, 0xA6, 0x02, 0xD2,
+    0xE6, 0x30, 0x7B, 0x9D, 0x31, 0xD7, 0x72, 0xB6, 0x70, 0xBC, 0xA3, 0xD6, 0x9F, 0x3D, 0xC2, 0xFA,
+    0x75, 0x07, 0x9A, 0x90, 0x19, 0x53, 0x32, 0x63, 0x52, 0x66, 0x4C, 0xCB, 0xAC, 0x25, 0x66, 0x5E,
+    0x57, 0xD8, 0xF5, 0xBA, 0x5B, 0x64, 0x22, 0x33, 0x5D, 0x77, 0x0B, 0x08, 0xBE, 0xDE, 0xA0, 0x31,
+    0x77, 0xF2, 0xB3, 0x9F, 0x88, 0xF5, 0xAF, 0x91, 0x88, 0xB9, 0xEF, 0x32, 0x7F, 0xA4, 0x1B, 0xE2,
+    0x0F, 0xFD, 0x7C, 0xE5, 0xD9, 0xF8, 0xB7, 0x60, 0xFE, 0xDA, 0x4F, 0xCB, 0xB4, 0xC7, 0xCC, 0x69,
+    0x5F, 0x79, 0xB9, 0xA9, 0x84, 0xD5, 0xF1, 0xF3, 0xBF, 0x59, 0xFC, 0xAE, 0xAF, 0x9B, 0xA2, 0x3C,
+    0xFB, 0x29, 0x72, 0xEF, 0x5F, 0x9A, 0x31, 0xD5, 0x92, 0x95, 0xDC, 0xA5, 0x33, 0x22, 0x8E, 0xFF,
+    0x85, 0xAB, 0x38, 0xD3, 0x9A, 0x9F, 0x5D, 0xBF, 0x7C, 0xED, 0x27, 0xE5, 0xF6, 0x3B, 0xD8, 0x82,
+    0x59, 0x1C, 0xC7, 0xB8, 0x3D, 0xCA, 0x80, 0xFC, 0x16, 0xA5, 0x19, 0x61, 0xF5, 0x80, 0x95, 0x36,
+    0xDD, 0x59, 0x4F, 0x04, 0x4E, 0xE5, 0x35, 0xB4, 0x01, 0x43, 0x20, 0xE9, 0x6B, 0x41, 0x1B, 0x12,
+    0x13, 0xA7, 0xC3, 0x2A, 0x06, 0x90, 0xC0, 0x55, 0xB6, 0x10, 0xC0, 0x15, 0xA5, 0x54, 0xB4, 0x2A,
+    0x6A, 0xD3, 0xC7, 0x83, 0x81, 0xB1, 0x2A, 0x6C, 0x3C, 0x84, 0x09, 0x55, 0x35, 0xA2, 0x75, 0xF6,
+    0xED, 0xEA, 0x55, 0x05, 0x47, 0x83, 0xBB, 0x53, 0x45, 0x54, 0x73, 0x4B, 0x34, 0x26, 0x5A, 0x47,
+    0xEE, 0xAD, 0xD2, 0x81, 0x37, 0x6E, 0x34, 0x2C, 0xBE, 0xA3, 0x67, 0x4A, 0xB7, 0x27, 0x6B, 0x39,
+    0x9D, 0x7E, 0x78, 0x76, 0x2C, 0x15, 0x08, 0x7E, 0x39, 0xDA, 0xA4, 0x28, 0xCF, 0xF4, 0x97, 0xED,
+    0xB5, 0x94, 0xDE, 0xF2, 0x07, 0x8A, 0xF7, 0x86, 0x7C, 0xB0, 0xC7, 0x2F, 0x71, 0xEE, 0xD9, 0x21,
+    0x44, 0x66, 0x56, 0xE2, 0x4D, 0xE6, 0x6B, 0xE4, 0x97, 0x08, 0x25, 0xBF, 0x40, 0x39, 0x4A, 0x11,
+    0xA4, 0xE1, 0xB2, 0x00, 0x75, 0x1A, 0xA5, 0x78, 0x2C, 0xCB, 0x11, 0x99, 0x70, 0x4B, 0xB1, 0xC6,
+    0x4D, 0xC7, 0x1F, 0x20, 0x9B, 0xE8, 0x7D, 0xD5, 0xE3, 0x94, 0x37, 0x69, 0xFC, 0x9F, 0x59, 0xC3,
+    0x5C, 0x7C, 0xF0, 0x53, 0x8B, 0x53, 0xB1, 0x78, 0x1E, 0xFE, 0xC8, 0x5E, 0x6D, 0x91, 0x18, 0x8E,
+    0xAE, 0xDA, 0x7F, 0x6D, 0x10, 0xF4, 0xC4, 0xC6, 0xFE, 0xB4, 0x41, 0x49, 0xD6, 0xB6, 0x29, 0xFE,
+    0x8B, 0xF7, 0xFC, 0xDF, 0x36, 0xD9, 0x37, 0x3C, 0x8B, 0xDA, 0x33, 0xC9, 0xFF, 0x97, 0xBA, 0x17,
+    0x60, 0x0A, 0x02, 0xD5, 0x7F, 0x21, 0x0F, 0x5A, 0x50, 0x1C, 0x69, 0xC7, 0x70, 0x94, 0x5F, 0xE1,
+    0x82, 0x7A, 0x34, 0xCD, 0xBF, 0x8A, 0xC4, 0x5A, 0x90, 0x66, 0xDE, 0xB8, 0x67, 0x56, 0x4B, 0x5E,
+    0xA7, 0x6F, 0x85, 0x31, 0xBD, 0xD6, 0x37, 0x79, 0x2D, 0xCB, 0x16, 0x45, 0x79, 0x9C, 0xC3, 0xDF,
+    0xB2, 0x21, 0xB3, 0xDE, 0xB9, 0x33, 0x56, 0x09, 0x74, 0x5E, 0x13, 0x32, 0x4F, 0x2D, 0xCA, 0xCD,
+    0xE2, 0x95, 0xB0, 0x93, 0xD1, 0x39, 0x3C, 0x8D, 0x45, 0x8E, 0xAB, 0x94, 0xF6, 0x51, 0x99, 0x54,
+    0x26, 0x03, 0x1A, 0x2A, 0xAA, 0xBB, 0x16, 0x29, 0xA3, 0xA4, 0xFE, 0x67, 0xEB, 0xF1, 0x3B, 0x06,
+    0x1A, 0x7B, 0x0D, 0x8A, 0xF9, 0xCB, 0xA6, 0xF8, 0x1C, 0x39, 0xF1, 0x5F, 0xD5, 0xD9, 0xBF, 0xE1,
+    0xB2, 0xF7, 0x93, 0x32, 0xF9, 0x8A, 0x9A, 0x5A, 0xC6, 0xFA, 0x25, 0x34, 0x69, 0xA4, 0x3B, 0x1F,
+    0x4D, 0x42, 0x4D, 0x5C, 0xB6, 0x15, 0x7A, 0x35, 0x68, 0xBC, 0x73, 0xA2, 0xFB, 0x22, 0xBD, 0xFA,
+    0xC3, 0xEB, 0xE2, 0xE3, 0x9D, 0x13, 0xAF, 0x3A, 0x38, 0xAF, 0xBE, 0x9D, 0x5B, 0x54, 0x15, 0xA2,
+    0x78, 0xCF, 0x24, 0x15, 0x32, 0xED, 0x98, 0x60, 0xF9, 0x9D, 0xF3, 0xF7, 0x36, 0x8D, 0xD0, 0x1E,
+    0x57, 0x4E, 0x0B, 0x94, 0xDC, 0x66, 0x0A, 0x42, 0x03, 0x1B, 0x10, 0xF7, 0x3F, 0x61, 0xC6, 0xEC,
+    0xD3, 0x45, 0x8F, 0x2C, 0x8A, 0x3D, 0x70, 0x0D, 0xEA, 0x3B, 0x28, 0x8B, 0x39, 0x23, 0x6E, 0xE1,
+    0x63, 0x7E, 0x7B, 0x14, 0x6F, 0x04, 0xF1, 0x34, 0x80, 0x45, 0x38, 0xF1, 0xCF, 0x5A, 0x6C, 0x03,
+    0xE7, 0x38, 0x2D, 0xBD, 0xB2, 0x26, 0x77, 0x0D, 0x5D, 0x14, 0x12, 0x61, 0x8B, 0x1D, 0x20, 0xA7,
+    0x23, 0x33, 0x1C, 0xE6, 0x38, 0x2E, 0xE1, 0x1A, 0x02, 0xD4, 0x90, 0xBD, 0xFA, 0x10, 0xE7, 0x32,
+    0xBB, 0x40, 0x18, 0x1A, 0xF5, 0x2D, 0xA4, 0xDF, 0xAF, 0xC7, 0xE6, 0x3D, 0x3D, 0xCD, 0xCC, 0xA7,
+    0xFA, 0x01, 0x3B, 0xDD, 0x97, 0x72, 0x16, 0xF7, 0xA5, 0x18, 0x61, 0xC5, 0xF2, 0x81, 0xEF, 0x71,
+    0xAD, 0x43, 0x79, 0xDE, 0x5A, 0x71, 0x86, 0x5E, 0x03, 0x5C, 0x83, 0x0E, 0x65, 0x0C, 0x41, 0x87,
+    0x82, 0x1C, 0x7D, 0xE5, 0xA8, 0x15, 0xB4, 0x59, 0x48, 0x6B, 0x49, 0x11, 0xBF, 0x7B, 0x89, 0xDF,
+    0x09, 0xC2, 0x62, 0xA2, 0x62, 0x79, 0x22, 0xBD, 0xC8, 0xCA, 0x58, 0x96, 0xAE, 0x0B, 0xC1, 0xE5,
+    0x34, 0xAC, 0xE5, 0x66, 0x1B, 0xD9, 0xE0, 0x6D, 0x00, 0xF7, 0xB6, 0x2E, 0x30, 0xDE, 0xFD, 0xE5,
+    0xF7, 0xD1, 0xE0, 0x80, 0x04, 0x65, 0xC0, 0x0A, 0x2D, 0x6C, 0xC3, 0x98, 0x1C, 0x9C, 0x4F, 0x32,
+    0x58, 0x16, 0x95, 0x56, 0xE6, 0x0A, 0x70, 0xDF, 0xC6, 0x1F, 0xB7, 0xA1, 0xD1, 0x77, 0xE5, 0xE3,
+    0xCE, 0x80, 0x1D, 0xAB, 0x12, 0x59, 0x98, 0xF7, 0xA7, 0xD2, 0x73, 0x56, 0x40, 0x30, 0x2F, 0x3B,
+    0x5F, 0x96, 0xE9, 0x2E, 0x2B, 0xB1, 0xAD, 0x92, 0xE8, 0xDF, 0x6F, 0x0D, 0x88, 0x19, 0x71, 0x31,
+    0x3B, 0x69, 0xCC, 0x9B, 0xCC, 0x19, 0x38, 0x3A, 0xC3, 0x53, 0x9D, 0xF7, 0xF2, 0x58, 0x1B, 0xD3,
+    0x2F, 0x7A, 0xE2, 0x43, 0x63, 0x02, 0x7C, 0x13, 0x55, 0x98, 0xC7, 0xFD, 0xCD, 0x6C, 0xBC, 0x8B,
+    0xAC, 0xDF, 0x42, 0x75, 0x69, 0x71, 0x08, 0x4F, 0xD3, 0x49, 0x9B, 0x9F, 0x1D, 0xB2, 0x8F, 0x67,
+    0x87, 0xD0, 0xFD, 0x29, 0xCF, 0xE7, 0x6B, 0xAA, 0xDA, 0x98, 0xA3, 0x2A, 0xED, 0x4F, 0x10, 0xA1,
+    0x0F, 0x70, 0xD7, 0x30, 0x81, 0x2B, 0x0D, 0xF1, 0xF5, 0x2C, 0xFE, 0x24, 0xB9, 0x9E, 0x13, 0x9D,
+    0x39, 0x42, 0xCE, 0xCC, 0x7C, 0x5F, 0x5C, 0x25, 0xEA, 0x2E, 0x32, 0x5C, 0x99, 0x8C, 0xD1, 0x1E,
+    0xAB, 0xC1, 0xBD, 0xE1, 0x94, 0x10, 0x72, 0x6E, 0xDF, 0x90, 0x55, 0x37, 0x37, 0xD9, 0x7F, 0x0F,
+    0xA2, 0x49, 0xF8, 0xDE, 0xA1, 0xEE, 0x38, 0xEB, 0x85, 0x0B, 0x06, 0x55, 0x36, 0xFD, 0x35, 0xED,
+    0x5C, 0xBF, 0x93, 0xDC, 0x46, 0x76, 0x6E, 0x00, 0xB5, 0x3B, 0x55, 0x44, 0x00, 0x05, 0x94, 0x5D,
+    0xA6, 0xAA, 0x8C, 0xE4, 0x82, 0x3B, 0x96, 0x4D, 0xFC, 0x03, 0x22, 0x81, 0x93, 0x02, 0x05, 0x4A,
+    0x36, 0xE0, 0x5A, 0x21, 0x2F, 0x60, 0xE0, 0x52, 0xB2, 0xE9, 0xB9, 0x4A, 0x16, 0xC0, 0x4B, 0x2E,
+    0x34, 0x1D, 0xF8, 0x62, 0x06, 0x0A, 0xA4, 0x65, 0xC0, 0xE4, 0x02, 0x96, 0x8B, 0x24, 0x70, 0x4C,
+    0x9D, 0xE0, 0x54, 0xE5, 0x73, 0xE0, 0xE0, 0xA0, 0x2B, 0x32, 0x30, 0x13, 0xA3, 0xCE, 0x38, 0x1B,
+    0x24, 0x31, 0xD3, 0x7E, 0xDF, 0xF7, 0xBA, 0x31, 0x33, 0xCB, 0x95, 0x8A, 0x94, 0xA8, 0xD5, 0x2E,
+    0xED, 0x29, 0x6E, 0xF7, 0xDB, 0x59, 0xA0, 0xD1, 0xFD, 0xBD, 0xD7, 0xAF, 0xDF, 0x2F, 0xD0, 0x18,
+    0xF9, 0x04, 0x37, 0xD1, 0x9A, 0xC5, 0x68, 0x82, 0xDA, 0x16, 0xF1, 0x64, 0x52, 0x6B, 0x87, 0xC5,
+    0x64, 0xEA, 0x2E, 0x5E, 0x05, 0x53, 0x68, 0xAB, 0xC0, 0x56, 0xE3, 0xC2, 0x1A, 0x53, 0xFF, 0xB6,
+    0x4F, 0x96, 0xC6, 0xE4, 0xCF, 0xDB, 0x74, 0x92, 0x6E, 0x65, 0x32, 0xE9, 0xE4, 0x27, 0x1F, 0x8D,
+    0x49, 0xD7, 0xDD, 0x60, 0x8C, 0x5C, 0x76, 0x7C, 0xB7, 0x75, 0xA5, 0xBB, 0x9D, 0x83, 0x8D, 0x86,
+    0x43, 0xF7, 0x06, 0x0F, 0x2A, 0x3B, 0x13, 0xDA, 0xC2, 0xD8, 0xC6, 0x18, 0xDB, 0xE1, 0x0B, 0x93,
+    0x59, 0x2B, 0xF7, 0xC8, 0xB7, 0xB6, 0xE2, 0x94, 0xF7, 0x8C, 0x7E, 0x2E, 0xB1, 0xAD, 0xE5, 0xC2,
+    0x3D, 0xB4, 0x07, 0xB6, 0xCD, 0x1B, 0xB9, 0x68, 0x4A, 0x9A, 0x78, 0x19, 0xD9, 0xA4, 0x4A, 0x47,
+    0x63, 0xEF, 0x98, 0xAC, 0x37, 0x76, 0xC2, 0xE0, 0x75, 0x67, 0xCA, 0x1E, 0xC3, 0xA3, 0x9D, 0x89,
+    0xF9, 0xD7, 0x1E, 0xD7, 0xC8, 0xAF, 0xB8, 0xB2, 0xE5, 0x5D, 0x8D, 0x49, 0x64, 0x84, 0xCA, 0x60,
+    0x34, 0x3E, 0x7E, 0xE2, 0x64, 0x3A, 0x3C, 0xF5, 0xAA, 0xF1, 0x9F, 0xEB, 0xDA, 0x05, 0x2B, 0x53,
+    0x5A, 0x1B, 0xD8, 0x87, 0x56, 0xFB, 0xDF, 0x58, 0xB9, 0xA3, 0x35, 0x71, 0x53, 0x9A, 0x40, 0x46,
+    0x5A, 0x34, 0x57, 0x5C, 0xFF, 0xAE, 0xF6, 0xBF, 0x1B, 0xB4, 0x97, 0xF1, 0xD9, 0x3F, 0x32, 0xEE,
+    0xEF, 0xAF, 0xAF, 0x37, 0x73, 0x8F, 0x79, 0x00, 0xAA, 0xDE, 0xA4, 0x80, 0x30, 0x5F, 0x9A, 0x1A,
+    0x73, 0x4E, 0x74, 0x49, 0x60, 0x7D, 0xA7, 0x8B, 0x58, 0x2F, 0x8B, 0x17, 0xCA, 0xA5, 0xAD, 0x76,
+    0x5D, 0x6E, 0x43, 0x3B, 0x65, 0x7D, 0x6E, 0xDF, 0xB3, 0x53, 0x2C, 0x7C, 0x29, 0xB2, 0x29, 0x6A,
+    0x23, 0x5B, 0x24, 0x53, 0x5C, 0xA1, 0x5B, 0x3E, 0x30, 0xE8, 0x64, 0x20, 0x7E, 0x69, 0x5E, 0xB2,
+    0x03, 0xFF, 0x45, 0xCA, 0x20, 0x0D, 0x32, 0xED, 0x1C, 0xD3, 0xB1, 0xCF, 0x38, 0xAB, 0xDA, 0xFE,
+    0xBB, 0xCC, 0x5B, 0xE4, 0xF1, 0x03, 0x74, 0x66, 0xCF, 0xAC, 0x3F, 0x22, 0xB4, 0x7F, 0x3B, 0xFF,
+    0x32, 0x05, 0xE3, 0x4C, 0x97, 0x71, 0x3F, 0xD3, 0x19, 0x24, 0xC8, 0x7D, 0x12, 0x11, 0x28, 0xFF,
+    0x89, 0x56, 0xE6, 0x6B, 0x3F, 0xB9, 0xB5, 0xFF, 0x81, 0x19, 0xC8, 0xA7, 0x15, 0xDA, 0x82, 0x47,
+    0xF2, 0xE9, 0x84, 0x93, 0x07, 0x56, 0x58, 0x5C, 0x44, 0x32, 0xA8, 0x6D, 0x43, 0xDB, 0xC8, 0x43,
+    0xC1, 0x3A, 0x99, 0x5A, 0xDD, 0x07, 0x83, 0x3C, 0x80, 0x28, 0xE7, 0x43, 0xD0, 0x9B, 0x6C, 0x49,
+    0x3A, 0x9B, 0x84, 0x86, 0xB0, 0x0B, 0x9D, 0x72, 0x5D, 0x3D, 0x69, 0x88, 0x7A, 0x80, 0x25, 0x81,
+    0x5E, 0x01, 0x84, 0x66, 0xA6, 0x63, 0x6B, 0x66, 0x3A, 0x5D, 0xAD, 0x69, 0xC5, 0x45, 0xE9, 0x7A,
+    0x58, 0xD3, 0x64, 0x1B, 0xC6, 0x5F, 0xEA, 0x30, 0xFA, 0x5C, 0x99, 0x59, 0xA1, 0x34, 0x76, 0x96,
+    0x0C, 0x39, 0x80, 0x16, 0x01, 0x97, 0x3F, 0x05, 0xA4, 0xE5, 0xBE, 0x72, 0x54, 0x3A, 0xC4, 0x2A,
+    0x7A, 0x13, 0xF5, 0x32, 0x27, 0x79, 0x24, 0x65, 0xB6, 0xD7, 0xB5, 0x47, 0x58, 0x3B, 0xE8, 0x55,
+    0xE1, 0x68, 0x07, 0xD3, 0x4F, 0xCC, 0xAE, 0xC7, 0x33, 0x2B, 0x72, 0x8F, 0x5A, 0xD2, 0x2D, 0x8D,
+    0xDE, 0x28, 0x57, 0x8F, 0x46, 0x31, 0x93, 0xA5, 0x72, 0xD9, 0x21, 0xA6, 0x57, 0xEB, 0x4A, 0x6B,
+    0x37, 0x0E, 0x01, 0x9B, 0xC9, 0x4C, 0xB4, 0x8D, 0x40, 0xAD, 0x70, 0x85, 0x7C, 0x1A, 0xD1, 0x8A,
+    0x9E, 0xFE, 0x0D, 0x41, 0x97, 0x05, 0x47, 0x5D, 0x04, 0xCD, 0x40, 0xB2, 0x5D, 0x58, 0x07, 0x43,
+    0x58, 0x41, 0x96, 0x3C, 0x52, 0xC3, 0x1A, 0xA8, 0x6E, 0x8D, 0x53, 0xB3, 0x86, 0xA9, 0xF0, 0x28,
+    0xC5, 0xAB, 0x19, 0xA4, 0xD4, 0xE1, 0xAB, 0x4A, 0xA0, 0x77, 0x10, 0xC9, 0x00, 0xBD, 0x22, 0x24,
+    0xA2, 0x19, 0x38, 0x80, 0x22, 0xBB, 0xFF, 0x91, 0xC3, 0x27, 0x5E, 0xC3, 0x93, 0x28, 0x3A, 0x6F,
+    0xEF, 0x17, 0xE6, 0x96, 0xC0, 0x03, 0x49, 0x6A, 0xCD, 0xD2, 0x60, 0xD8, 0x77, 0xF0, 0x88, 0x0F,
+    0x7A, 0xB7, 0xCA, 0x84, 0xC2, 0x0C, 0x6A, 0xA1, 0xDA, 0x4C, 0xA8, 0xD0, 0x7A, 0x0C, 0x54, 0xBA,
+    0x67, 0xAA, 0x1E, 0xAC, 0x2C, 0xD3, 0xDA, 0x66, 0x61, 0x57, 0x75, 0x8B, 0xC7, 0x35, 0xC9, 0x4A,
+    0xC6, 0x8B, 0x1F, 0x7F, 0x24, 0xFB, 0x6F, 0x8C, 0x6C, 0x2B, 0xAA, 0x6E, 0x25, 0x53, 0x96, 0xA9,
+    0x25, 0xD8, 0x4A, 0x39, 0xE6, 0xBB, 0x4B, 0x45, 0xC6, 0x45, 0x70, 0x4D, 0x84, 0x14, 0x3A, 0x41,
+    0xA9, 0x48, 0x75, 0xAC, 0x93, 0x44, 0xA5, 0x32, 0x11, 0x53, 0xBD, 0x43, 0x6E, 0xD5, 0x51, 0xE4,
+    0x5F, 0xD4, 0x70, 0x64, 0x59, 0x7F, 0xD4, 0x64, 0x63, 0x88, 0xB9, 0x88, 0x3E, 0x91, 0x19, 0xD4,
+    0x72, 0x14, 0xEC, 0x5F, 0xC3, 0xAC, 0x72, 0x9B, 0x61, 0x56, 0x81, 0x1D, 0x33, 0x0B, 0x50, 0x1A,
+    0xB3, 0xB3, 0xB1, 0x97, 0x28, 0x36, 0xC3, 0x4C, 0x84, 0x14, 0xD7, 0x6C, 0xE5, 0x96, 0x9A, 0x2C,
+    0x3D, 0x31, 0x9D, 0x14, 0x11, 0x14, 0x8E, 0x58, 0x78, 0x99, 0x89, 0x67, 0xE1, 0xD9, 0x22, 0xB0,
+    0x41, 0x73, 0x10, 0x58, 0x94, 0xDD, 0x22, 0x9C, 0x46, 0x79, 0x81, 0x48, 0x3D, 0x91, 0x79, 0x7D,
+    0x94, 0x3B, 0x39, 0x0F, 0x3C, 0x3F, 0x73, 0xAF, 0x86, 0xF2, 0x47, 0x1E, 0xA5, 0x73, 0x95, 0xBF,
+    0x96, 0x30, 0x99, 0x52, 0xE1, 0x12, 0x39, 0x56, 0xB4, 0xD2, 0x6E, 0x96, 0x86, 0xE3, 0xFA, 0x58,
+    0x77, 0xC9, 0xDC, 0x7B, 0xBE, 0x3B, 0x1E, 0xBE, 0x6A, 0x1F, 0x14, 0xDA, 0x2F, 0x2A, 0xED, 0x63,
+    0xD7, 0x27, 0x1B, 0xBD, 0x42, 0xC3, 0xF9, 0x0A, 0x20, 0xEB, 0x7E, 0x7B, 0xCD, 0x47, 0xFB, 0xB2,
+    0xDF, 0x9A, 0x7C, 0x68, 0xDD, 0xF1, 0xE2, 0x94, 0x71, 0xDE, 0xC9, 0xDE, 0x31, 0xE6, 0x73, 0x39,
+    0x3B, 0x45, 0xC7, 0x8A, 0xD2, 0x2F, 0x16, 0x20, 0x40, 0x8B, 0x31, 0x10, 0x2E, 0x69, 0x12, 0x98,
+    0xA3, 0x6D, 0x6D, 0xD7, 0x6D, 0xCC, 0x36, 0x7A, 0x1D, 0xAD, 0xA8, 0xD2, 0x08, 0xA7, 0xF8, 0x34,
+    0xB7, 0x38, 0x36, 0x5E, 0x68, 0x17, 0x9C, 0x3B, 0xA4, 0xD8, 0x98, 0x83, 0x91, 0x5F, 0x83, 0x63,
+    0xD1, 0x53, 0x30, 0xBA, 0x92, 0x9F, 0x3F, 0x88, 0xDD, 0x02, 0x3D, 0x40, 0x6A, 0x82, 0x22, 0x0C,
+    0x26, 0x1E, 0x45, 0x30, 0x67, 0x46, 0xEA, 0x1F, 0xBB, 0x9C, 0x29, 0xEB, 0xA9, 0xE7, 0xB2, 0x8B,
+    0x94, 0x1A, 0x65, 0x40, 0x47, 0x09, 0x7E, 0x8E, 0x12, 0xCD, 0xE5, 0x28, 0xD1, 0x6C, 0x8E, 0x12,
+    0xB0, 0x1C, 0x25, 0x7A, 0xD6, 0x51, 0xA2, 0xC1, 0x3C, 0x95, 0x0F, 0x9E, 0x4A, 0x27, 0x4F, 0x25,
+    0xD6, 0x53, 0xD1, 0x4C, 0x05, 0x33, 0x65, 0xEA, 0x99, 0xCA, 0x49, 0xC9, 0xCC, 0x4D, 0x4A, 0x0A,
+    0x2B, 0x8A, 0x1D, 0x25, 0x87, 0xBD, 0x5E, 0xA7, 0x9F, 0xE3, 0x28, 0xC5, 0x67, 0x6B, 0xA7, 0xAC,
+    0x77, 0xC8, 0x7C, 0x14, 0x08, 0xC7, 0x2B, 0x4F, 0xCD, 0x7B, 0xC3, 0xEC, 0xDE, 0x9C, 0x6F, 0x50,
+    0x44, 0xBB, 0x7C, 0x52, 0x40, 0xBB, 0x6C, 0xF4, 0x78, 0xF6, 0x0E, 0x4E, 0xE3, 0xD1, 0x34, 0x1E,
+    0x4C, 0xE3, 0xB0, 0xC4, 0x02, 0x09, 0x25, 0x09, 0x22, 0x29, 0x8B, 0x52, 0x20, 0x65, 0x4D, 0x8A,
+    0x23, 0x08, 0xC2, 0x08, 0x82, 0x28, 0x82, 0x20, 0x88, 0x24, 0x80, 0x21, 0x09, 0x40, 0x48, 0x02,
+    0x08, 0x92, 0x88, 0x3C, 0x11, 0x78, 0x02, 0xF0, 0x29, 0x81, 0xC3, 0x65, 0x74, 0xE0, 0xA5, 0xA3,
+    0xC3, 0x0E, 0x04, 0xA1, 0x4B, 0x3D, 0x10, 0x2F, 0x12, 0xD9, 0x70, 0x44, 0x8B, 0xCC, 0x5B, 0x28,
+    0xF0, 0x86, 0x4D, 0x6A, 0x8F, 0x42, 0xE6, 0x01, 0xF3, 0x37, 0xE7, 0xD3, 0x36, 0xE0, 0x49, 0x7F,
+    0x8C, 0xD1, 0xF3, 0x96, 0xAA, 0xA6, 0x58, 0xD4, 0x3C, 0xE4, 0x35, 0xB7, 0xBD, 0xF4, 0x91, 0x58,
+    0x61, 0x83, 0xCC, 0x5E, 0xB4, 0xBE, 0xDC, 0x0C, 0xED, 0xDF, 0x88, 0x82, 0x4B, 0xA5, 0x87, 0x0E,
+    0x44, 0x5F, 0xBC, 0x96, 0x5E, 0xF6, 0x9A, 0x48, 0x48, 0x3A, 0x96, 0x76, 0x94, 0xA3, 0x11, 0xFD,
+    0xC4, 0x7E, 0x1B, 0x0D, 0x3F, 0xFF, 0x79, 0x5D, 0xDB, 0x5A, 0xC5, 0x23, 0xE2, 0x01, 0x01, 0x1E,
+    0x61, 0x65, 0x3E, 0xC3, 0x6E, 0x1C, 0x22, 0x5E, 0xB3, 0x4C, 0x9B, 0x0D, 0x0D, 0x9C, 0xAA, 0x78,
+    0xC6, 0xD3, 0x31, 0x70, 0xB8, 0x2F, 0x9D, 0xDC, 0xBA, 0x21, 0x73, 0xED, 0xAE, 0xA8, 0x94, 0xDE,
+    0xD3, 0xE7, 0x8D, 0x54, 0x66, 0xC1, 0x50, 0x62, 0xDB, 0x87, 0x3D, 0x27, 0x15, 0x75, 0x34, 0x69,
+    0x16, 0x0D, 0xA7, 0x1E, 0x37, 0x14, 0x7A, 0x39, 0x52, 0x30, 0x5A, 0xAA, 0xDB, 0x02, 0x0A, 0xD3,
+    0x75, 0x32, 0x99, 0xFB, 0x86, 0xA6, 0xD1, 0x44, 0x23, 0x25, 0x18, 0x68, 0xD3, 0x85, 0x3D, 0x97,
+    0x86, 0x99, 0xCB, 0x68, 0xB0, 0x69, 0x4B, 0xF1, 0xC8, 0x6C, 0x25, 0x16, 0x40, 0x03, 0x1B, 0x40,
+    0x7E, 0xC2, 0x9B, 0xE2, 0x78, 0x84, 0x63, 0x28, 0x37, 0x3C, 0x48, 0x5A, 0xD5, 0x38, 0xB4, 0xF5,
+    0xCC, 0x62, 0xDE, 0x70, 0x70, 0x94, 0xC4, 0xB4, 0x87, 0xA9, 0x21, 0x82, 0x99, 0x4C, 0x32, 0x97,
+    0x64, 0x90, 0x29, 0x2C, 0x7A, 0xA8, 0xAE, 0xB7, 0xE8, 0x5B, 0xA1, 0xF9, 0xB3, 0xDB, 0xD0, 0x7C,
+    0x32, 0xA9, 0x74, 0xF5, 0x81, 0x95, 0x27, 0xCA, 0x77, 0x65, 0x8F, 0xA6, 0x63, 0x13, 0xE3, 0xD7,
+    0x04, 0x7F, 0x28, 0xA1, 0x99, 0xFF, 0x0B, 0x5E, 0xD9, 0x0D, 0xD9, 0x7C, 0xE7, 0xE5, 0xF6, 0x1F,
+    0x9B, 0x73, 0x05, 0x4C, 0xC0, 0xE4, 0x2B, 0x98, 0x56, 0x30, 0x97, 0x3B, 0x35, 0xF3, 0x36, 0x8C,
+    0x00, 0xFC, 0x84, 0xCE, 0xF8, 0x7D, 0x1D, 0x3F, 0x78, 0x86, 0x1F, 0xF7, 0xBA, 0xB9, 0x60, 0x4A,
+    0xF3, 0xC0, 0xA4, 0x0F, 0x47, 0x9E, 0x81, 0x6A, 0x4C, 0xAF, 0x8D, 0xFD, 0x14, 0x56, 0x1F, 0xEF,
+    0x91, 0x7B, 0xEB, 0x57, 0xFC, 0x91, 0xF1, 0x52, 0xA0, 0x02, 0x76, 0xED, 0x16, 0xC1, 0x2D, 0x41,
+    0xAB, 0x8F, 0x65, 0x7D, 0xC1, 0x94, 0x55, 0x74, 0x50, 0xD6, 0x5B, 0x2C, 0x19, 0x8E, 0x48, 0x11,
+    0xBC, 0x69, 0x3C, 0x1E, 0xBA, 0x09, 0xBE, 0xB4, 0x51, 0x57, 0x9A, 0x9E, 0x74, 0xAB, 0xDE, 0x2E,
+    0x5D, 0xDF, 0x41, 0xFD, 0x60, 0x75, 0x8A, 0x5D, 0x4B, 0x77, 0xF9, 0x98, 0x76, 0xE3, 0x1A, 0xBD,
+    0x4B, 0x9D, 0x67, 0x1D, 0x0D, 0x2C, 0x2D, 0x3B, 0xE7, 0x39, 0xAB, 0xE3, 0xAC, 0x7E, 0xB3, 0x73,
+    0x9B, 0x29, 0x0C, 0xF0, 0x9B, 0xC4, 0xAB, 0x1F, 0x9D, 0xA7, 0x44, 0x17, 0x89, 0x42, 0xB3, 0xE1,
+    0x14, 0xC1, 0xD1, 0x3A, 0xA0, 0x55, 0x2A, 0x6E, 0x18, 0x5D, 0x5F, 0xF8, 0xD1, 0x15, 0x1D, 0x62,
+    0xFA, 0xC6, 0xF4, 0x9A, 0xE9, 0x31, 0xD3, 0x79, 0xD6, 0x06, 0xBF, 0xD2, 0x7F, 0xE6, 0x25, 0xBC,
+    0x98, 0xCE, 0x33, 0x07, 0x50, 0xD7, 0x59, 0x3D, 0x67, 0x78, 0x98, 0x02, 0xE5, 0x8F, 0xD5, 0x75,
+    0x23, 0x78, 0xCE, 0x3A, 0x4E, 0x75, 0x57, 0xC5, 0xCA, 0xBE, 0x63, 0xDC, 0x34, 0xFA, 0xD5, 0xB6,
+    0x70, 0x1D, 0x4E, 0x5B, 0xE1, 0x06, 0x9D, 0xDD, 0xD6, 0xFB, 0xBC, 0xDF, 0x63, 0xE7, 0xBD, 0x69,
+    0x98, 0x41, 0x8D, 0xFA, 0xD2, 0xC5, 0xEC, 0x4A, 0x3B, 0x4F, 0x9A, 0xBB, 0x6D, 0x0E, 0x51, 0xC8,
+    0xE6, 0xC0, 0xEA, 0x44, 0x40, 0xE5, 0x82, 0xDF, 0x4E, 0xDC, 0x6D, 0x03, 0x2D, 0x17, 0xF5, 0x01,
+    0xAA, 0xA3, 0xCE, 0x67, 0x80, 0x40, 0x85, 0xFD, 0xA9, 0xA5, 0x07, 0x27, 0x2C, 0x56, 0x37, 0xF9,
+    0x5B, 0xB4, 0x22, 0x18, 0xEA, 0x54, 0x87, 0xEA, 0x53, 0xAB, 0x4B, 0x5D, 0xDB, 0x7F, 0x81, 0xAD,
+    0x6F, 0x17, 0x78, 0xFE, 0x9E, 0x83, 0x94, 0xD0, 0xD7, 0xDA, 0x7D, 0x7C, 0x78, 0x6B, 0x63, 0x3E,
+    0xF7, 0x23, 0x0A, 0xB5, 0x8D, 0xC6, 0x8D, 0xEE, 0x93, 0xB0, 0x3F, 0xEB, 0x6C, 0xD9, 0xD9, 0xBF,
+    0xCA, 0x3F, 0x2D, 0xE7, 0xD6, 0x99, 0xE2, 0x14, 0xCA, 0xAC, 0xA1, 0x72, 0x66, 0x9B, 0x35, 0x18,
+    0x64, 0x87, 0x9A, 0xEE, 0x07, 0x66, 0x94, 0x0F, 0xCD, 0xB8, 0xD3, 0x29, 0x55, 0x2E, 0xE4, 0x2A,
+    0x42, 0x9F, 0xEA, 0x25, 0xB7, 0xB6, 0xD8, 0xB6, 0x78, 0xC3, 0xD8, 0xE6, 0xF4, 0xBA, 0x3A, 0xCB,
+    0xBA, 0xAA, 0x84, 0x7F, 0xC6, 0x8D, 0xA7, 0x9B, 0x79, 0x7B, 0xDA, 0xDF, 0x57, 0x26, 0xE4, 0xFF,
+    0xD0, 0x6A, 0x4C, 0x8A, 0xCC, 0x5B, 0xD8, 0x4D, 0xF6, 0xBA, 0x4B, 0xB6, 0xF7, 0xDC, 0xFD, 0xB3,
+    0xCF, 0xBC, 0x4B, 0x0C, 0xD6, 0xAA, 0x12, 0x8C, 0x9E, 0xF7, 0x6B, 0xA7, 0xB8, 0xAE, 0x66, 0x26,
+    0x6D, 0x33, 0xCF, 0xCE, 0x4C, 0xFD, 0x81, 0x99, 0x77, 0xD5, 0x99, 0x98, 0x0E, 0x78, 0xDD, 0x71,
+    0xA9, 0xBA, 0xB1, 0x91, 0x63, 0xCC, 0xCF, 0xDE, 0xE8, 0x9D, 0x57, 0xF2, 0x5C, 0xCE, 0xB8, 0x8E,
+    0x98, 0x4B, 0xD4, 0x73, 0xDB, 0x5C, 0x39, 0xED, 0x6A, 0x33, 0x28, 0xA0, 0x30, 0x34, 0x3E, 0xD7,
+    0x99, 0xEC, 0x1F, 0xC5, 0x2D, 0xFB, 0x6B, 0x58, 0xF6, 0xE7, 0xD5, 0x79, 0xA7, 0x1F, 0xCF, 0x88,
+    0xA0, 0xD8, 0x4D, 0x6F, 0xEF, 0x7F, 0x84, 0x58, 0x82, 0x70, 0xA4, 0x7E, 0x76, 0x5B, 0x1A, 0xC4,
+    0x1A, 0x4B, 0x69, 0x4C, 0xDE, 0x45, 0x88, 0xB1, 0x89, 0x5D, 0x9D, 0x8C, 0x29, 0xC2, 0xBE, 0xB4,
+    0x71, 0x71, 0x97, 0xC2, 0x63, 0x35, 0x78, 0xEE, 0xBA, 0xC3, 0xC3, 0x9B, 0x1B, 0x6B, 0x9E, 0x16,
+    0x40, 0x2D, 0x5C, 0x32, 0x2E, 0x1D, 0x68, 0x27, 0x7E, 0x68, 0x77, 0x56, 0xDD, 0x0E, 0xB3, 0xBF,
+    0xBF, 0xE7, 0x96, 0xEA, 0xD6, 0x8B, 0x0C, 0x88, 0xD8, 0x95, 0x5C, 0x9B, 0xAC, 0x53, 0x5C, 0x00,
+    0xAE, 0x79, 0x2F, 0x28, 0x4E, 0xCE, 0x0B, 0xC1, 0x64, 0xDA, 0xAF, 0xE5, 0x41, 0x38, 0x6C, 0x01,
+    0x3C, 0x6D, 0xFE, 0x16, 0xDC, 0x7C, 0x43, 0x78, 0x40, 0x79, 0x5F, 0xE0, 0x89, 0xF1, 0xD2, 0xAF,
+    0x24, 0x1A, 0xCD, 0x49, 0xF2, 0x60, 0x36, 0x23, 0x8F, 0x23, 0x8E, 0x7E, 0x10, 0xD6, 0x66, 0x56,
+    0x8F, 0x04, 0x71, 0x7F, 0x60, 0xAB, 0x5D, 0x12, 0xFF, 0x2D, 0x50, 0x83, 0x08, 0xFF, 0x28, 0xC4,
+    0x3D, 0x2C, 0xE4, 0x4B, 0x47, 0xC4, 0x0F, 0x85, 0xC0, 0xD3, 0x92, 0xF7, 0x9C, 0xF5, 0x9C, 0xF9,
+    0x48, 0xE2, 0x65, 0x4F, 0x4C, 0xA1, 0xFD, 0xD7, 0x7D, 0x32, 0x07, 0x2B, 0xA9, 0xC0, 0x97, 0xD0,
+    0x3E, 0x39, 0x2C, 0xC0, 0x19, 0x77, 0x4D, 0xF2, 0xE4, 0xB6, 0x12, 0xA9, 0x75, 0x39, 0xC5, 0x2B,
+    0xB2, 0xF9, 0x95, 0xBF, 0x3E, 0x34, 0x39, 0x92, 0x48, 0xC1, 0x10, 0x10, 0x19, 0x58, 0x02, 0x22,
+    0x47, 0x10, 0x25, 0x12, 0xA2, 0x36, 0x56, 0xF5, 0x85, 0x5D, 0x13, 0xB3, 0x41, 0xB9, 0xDD, 0xCD,
+    0x4C, 0xD8, 0x21, 0x1B, 0x6E, 0x20, 0xCC, 0x86, 0xEB, 0x45, 0x9D, 0x21, 0xEA, 0x21, 0x0E, 0xE1,
+    0x10, 0x23, 0x84, 0x2A, 0xEC, 0x10, 0xBD, 0x38, 0x90, 0x21, 0x10, 0x22, 0xED, 0x84, 0x29, 0x87,
+    0x35, 0x33, 0x22, 0x02, 0x14, 0x18, 0xB3, 0xBF, 0x7F, 0x95, 0xAC, 0x31, 0xCA, 0x1C, 0x43, 0xF6,
+    0x20, 0x76, 0x2C, 0x0C, 0xAA, 0xCC, 0xCF, 0xC0, 0xA2, 0xD6, 0xF4, 0xC2, 0xA4, 0xFA, 0xE9, 0x3B,
+    0x7D, 0x6A, 0x97, 0x29, 0x33, 0x08, 0x82, 0x82, 0xF0, 0x5A, 0xC0, 0xDB, 0x59, 0xBB, 0xC7, 0x07,
+    0xF6, 0x91, 0xE1, 0x54, 0x0A, 0x06, 0x9C, 0x1B, 0x1C, 0x11, 0x50, 0x7C, 0xC8, 0xFB, 0x41, 0x60,
+    0x19, 0x02, 0x97, 0x7B, 0x34, 0xB6, 0x9D, 0x8F, 0x2F, 0xB4, 0x83, 0x6B, 0x2F, 0x1C, 0x7E, 0x21,
+    0xDF, 0xE4, 0x76, 0x95, 0x03, 0xB7, 0x41, 0xD3, 0x5E, 0x19, 0x03, 0xEA, 0xE9, 0x24, 0xA7, 0xDC,
+    0x2A, 0x59, 0xA1, 0xD5, 0x9C, 0x4D, 0xA8, 0xF9, 0x1C, 0x51, 0xC6, 0xF4, 0xCE, 0x21, 0xD2, 0x82,
+    0xCA, 0xD3, 0x8D, 0xFC, 0x63, 0x21, 0x60, 0x09, 0xCC, 0xB5, 0xAD, 0xC7, 0xC8, 0xD6, 0x7F, 0x1A,
+    0xE2, 0x29, 0x1E, 0xF7, 0x92, 0x21, 0x9A, 0xC4, 0xF0, 0x15, 0x65, 0xBC, 0xD5, 0x40, 0x2D, 0x8B,
+    0xE0, 0x47, 0xCB, 0x6B, 0x83, 0xD3, 0x03, 0x0F, 0xBE, 0x70, 0x27, 0x33, 0x9C, 0x75, 0x93, 0x3C,
+    0x13, 0x6D, 0x20, 0x6B, 0x5C, 0x31, 0x87, 0x55, 0x21, 0xA1, 0xD7, 0x64, 0xCF, 0x0E, 0x6D, 0x2B,
+    0x47, 0x79, 0xDE, 0x59, 0x79, 0xC8, 0x04, 0x0E, 0x4E, 0x82, 0x41, 0x59, 0x95, 0xED, 0xAE, 0x55,
+    0xAF, 0x3D, 0xA8, 0x57, 0x05, 0xF5, 0xC3, 0x75, 0x69, 0x19, 0x67, 0x31, 0x75, 0xD2, 0x71, 0xF3,
+    0x36, 0xC6, 0x79, 0xCD, 0x1B, 0xB1, 0x96, 0xD7, 0x8E, 0xA8, 0x7E, 0xA3, 0x88, 0xBE, 0x63, 0x9F,
+    0xE6, 0x88, 0x2E, 0x76, 0x1E, 0x51, 0xB4, 0xCC, 0x6B, 0xB5, 0x2F, 0x83, 0x28, 0x43, 0x61, 0x1A,
+    0x08, 0x63, 0x18, 0x8C, 0x41, 0x30, 0x86, 0xC0, 0x7C, 0x00, 0xEC, 0xBB, 0xE1, 0xFD, 0xCF, 0xAF,
+    0x84, 0xB7, 0xD8, 0x4E, 0x96, 0xF6, 0x02, 0xF1, 0x7E, 0x34, 0xE3, 0x7D, 0xE7, 0x59, 0x31, 0x67,
+    0x76, 0x1D, 0xE0, 0x0E, 0x71, 0x9F, 0xCA, 0x55, 0xCC, 0x8F, 0x01, 0x1D, 0x0A, 0xF5, 0x03, 0xBB,
+    0xD4, 0x6E, 0xC5, 0x00, 0x91, 0x8B, 0x15, 0xD5, 0x9A, 0x72, 0xD0, 0xF4, 0x1E, 0xE7, 0x68, 0xDB,
+    0xB8, 0x65, 0x97, 0x69, 0x8E, 0xF4, 0x3E, 0xCF, 0x8D, 0x2F, 0xD5, 0x64, 0xFB, 0x37, 0xE2, 0x61,
+    0xFF, 0x73, 0xA9, 0x87, 0x09, 0x9F, 0x67, 0x9F, 0x53, 0x21, 0xD8, 0x2F, 0xAD, 0xDE, 0x67, 0x75,
+    0x94, 0x72, 0x64, 0x97, 0x2F, 0xD9, 0x25, 0x9A, 0xB8, 0xC5, 0xFE, 0xC3, 0x83, 0xB4, 0x78, 0x21,
+    0x40, 0x04, 0x95, 0xBA, 0x81, 0xB1, 0x2A, 0x04, 0x36, 0xFE, 0xC2, 0xEC, 0x56, 0xC8, 0xAD, 0x23,
+    0x80, 0xB4, 0xE8, 0x1F, 0xD0, 0x9F, 0xD1, 0x67, 0x52, 0x4F, 0x96, 0xAD, 0x61, 0x1E, 0x04, 0x36,
+    0x62, 0x41, 0xFD, 0x54, 0x78, 0x0B, 0xE5, 0xF8, 0x0C, 0x08, 0xDB, 0x9F, 0x5A, 0x3B, 0xB7, 0x45,
+    0xCE, 0xF2, 0x89, 0xBC, 0x40, 0x7B, 0x1F, 0x7F, 0x7D, 0x8F, 0x31, 0xA0, 0x0F, 0x3B, 0xB4, 0xD7,
+    0x7A, 0xB4, 0xF5, 0xE8, 0xAB, 0x19, 0x42, 0xFB, 0x7B, 0x56, 0x36, 0xBC, 0x2F, 0xF3, 0x96, 0x2B,
+    0x65, 0xDA, 0x72, 0x97, 0x85, 0xA2, 0x2B, 0x4A, 0xC4, 0xB5, 0x9B, 0x0C, 0x55, 0x0D, 0x53, 0x6C,
+    0x1B, 0x69, 0x83, 0x39, 0xAE, 0x77, 0xEA, 0x82, 0x5B, 0xB1, 0x8A, 0x49, 0xB1, 0x76, 0x86, 0x55,
+    0x46, 0x34, 0x86, 0x64, 0x7F, 0xA5, 0x88, 0xAE, 0x13, 0x13, 0xDF, 0x6F, 0x8C, 0x8B, 0xB2, 0x0B,
+    0xDB, 0x5A, 0x67, 0x94, 0xAF, 0x9B, 0xC7, 0x05, 0x2E, 0x91, 0x19, 0xEF, 0xAA, 0xD1, 0xC9, 0xE3,
+    0x09, 0xBB, 0x75, 0x2E, 0x6E, 0x39, 0xC5, 0x11, 0xC4, 0x57, 0x04, 0x99, 0x47, 0xFF, 0xBA, 0x39,
+    0x89, 0xE0, 0xE2, 0x06, 0xF0, 0xD5, 0x8B, 0xC0, 0xA7, 0x1E, 0x78, 0x0D, 0x3F, 0x32, 0xF8, 0x58,
+    0x7E, 0xD8, 0xBB, 0xC0, 0x23, 0xC3, 0x8E, 0xDB, 0x41, 0xC7, 0xC4, 0xAA, 0xC5, 0xE5, 0x1B, 0x51,
+    0x62, 0x26, 0x29, 0x44, 0x99, 0x24, 0x50, 0x77, 0x89, 0x3E, 0x29, 0x57, 0xAB, 0xC1, 0xD0, 0x72,
+    0x33, 0x31, 0x94, 0x58, 0x82, 0x09, 0xED, 0x1C, 0xD0, 0x43, 0xF0, 0x49, 0x59, 0x00, 0xBC, 0x03,
+    0x6E, 0xE5, 0x68, 0x6A, 0xFC, 0x8A, 0x23, 0xA2, 0xAF, 0x71, 0x3C, 0x94, 0xBD, 0xF0, 0x36, 0x85,
+    0xCA, 0x0C, 0x69, 0xD1, 0xED, 0x1C, 0x8D, 0xD5, 0x76, 0x5B, 0xB1, 0xDA, 0x2D, 0xFD, 0xC7, 0xB3,
+    0x26, 0x61, 0x6E, 0x9A, 0xCD, 0xF6, 0x24, 0xCF, 0x6D, 0x4C, 0xF2, 0xBE, 0xB7, 0x85, 0x55, 0x4D,
+    0x63, 0x66, 0xE7, 0xA8, 0x7C, 0x74, 0x54, 0xA0, 0xA3, 0x89, 0x14, 0x5F, 0x49, 0x82, 0x26, 0xC0,
+    0xAF, 0x19, 0x9A, 0xBC, 0x10, 0xE9, 0xCB, 0x1B, 0x3A, 0x44, 0xB0, 0x1F, 0x31, 0x53, 0x39, 0x24,
+    0x51, 0x00, 0x75, 0x41, 0x1E, 0xF0, 0xA9, 0x49, 0x1F, 0x4E, 0x2E, 0x06, 0xDF, 0x6E, 0x05, 0x37,
+    0xBF, 0x53, 0x0C, 0xFE, 0xD8, 0xB8, 0xBC, 0x3A, 0xB1, 0xB0, 0xC6, 0x50, 0x30, 0x03, 0x75, 0x86,
+    0x30, 0xC2, 0xFF, 0x17, 0xEF, 0x7C, 0x73, 0xF1, 0x8E, 0xC3, 0xC7, 0x9D, 0x97, 0xD6, 0x65, 0x2C,
+    0x5C, 0x99, 0x8E, 0x4B, 0xCE, 0x87, 0x3E, 0xB7, 0xF8, 0xC6, 0x97, 0xE9, 0x78, 0x20, 0x5C, 0x31,
+    0x05, 0xCB, 0x74, 0xCC, 0x76, 0x81, 0xC5, 0x37, 0x53, 0x6F, 0x48, 0x99, 0x8E, 0x7C, 0x2E, 0x32,
+    0x70, 0x5C, 0xD3, 0xA3, 0x55, 0x83, 0x43, 0x73, 0x5A, 0xDD, 0x1C, 0x5D, 0x3D, 0xF5, 0x26, 0xAE,
+    0x5B, 0x44, 0xDD, 0xB9, 0xBC, 0x0A, 0x75, 0x24, 0xA3, 0x2D, 0x49, 0x75, 0xBA, 0x4C, 0x5C, 0x81,
+    0xFF, 0x7D, 0xDD, 0x7C, 0x6B, 0x0A, 0x06, 0xAB, 0x4B, 0x49, 0x3B, 0x7E, 0x7F, 0x57, 0xEA, 0xF1,
+    0xFE, 0xB5, 0xE5, 0x0E, 0xE2, 0x04, 0xD8, 0xF9, 0xCB, 0x98, 0xBB, 0xF4, 0xC9, 0xE1, 0x9D, 0x65,
+    0x50, 0xAE, 0xF6, 0xDC, 0x75, 0xD9, 0xE4, 0xEF, 0xC8, 0xC6, 0x6F, 0x49, 0x51, 0xA8, 0x39, 0x7B,
+    0xE1, 0x7E, 0xAD, 0x59, 0x59, 0x43, 0x97, 0x9A, 0x54, 0x4A, 0xF6, 0xF0, 0xF3, 0xF6, 0xDA, 0x54,
+    0x5F, 0x86, 0x22, 0x3F, 0xF9, 0x2A, 0x05, 0x7A, 0xAB, 0xFC, 0x23, 0x56, 0x1D, 0x90, 0xBF, 0xD8,
+    0xD4, 0x21, 0x65, 0x1B, 0xBC, 0xCE, 0x06, 0xBA, 0xDD, 0x73, 0x5B, 0xB8, 0x36, 0xDF, 0x6C, 0x7B,
+    0xB4, 0x25, 0xDB, 0xBA, 0x55, 0xCB, 0x45, 0x5A, 0x39, 0xA7, 0xE6, 0x72, 0x9E, 0x18, 0x31, 0x42,
+    0xF8, 0xD4, 0x30, 0x6C, 0x71, 0x66, 0x7C, 0xB8, 0x32, 0xEE, 0x94, 0x0D, 0xE9, 0x9C, 0x7F, 0x9D,
+    0x59, 0x1D, 0xB9, 0xB6, 0xA1, 0x55, 0xB3, 0xA4, 0x41, 0xA3, 0xE0, 0x1E, 0x16, 0x9B, 0x7A, 0x40,
+    0xC3, 0xA2, 0xA8, 0xEA, 0xA0, 0x52, 0x70, 0x67, 0x73, 0x76, 0x8C, 0x8B, 0xA2, 0x05, 0x2C, 0x5A,
+    0xBE, 0xE2, 0x8A, 0x57, 0x7C, 0xE9, 0x8A, 0x2B, 0x5C, 0x71, 0x65, 0x2B, 0x5A, 0x00, 0xE4, 0xAA,
+    0x7F, 0x5C, 0xC1, 0x8A, 0x2B, 0x57, 0x71, 0xC5, 0x2A, 0xAE, 0x54, 0xC5, 0x15, 0xAA, 0xB8, 0x32,
+    0x15, 0x57, 0xA4, 0xE2, 0x4A, 0x54, 0x5C, 0x81, 0x8A, 0x2B, 0x4F, 0x71, 0xC5, 0x29, 0xAE, 0x34,
+    0xC5, 0x15, 0xA6, 0xB8, 0xB2, 0x14, 0x57, 0x94, 0xE2, 0x4A, 0x52, 0xCC, 0xB9, 0xCF, 0xD6, 0x31,
+    0x30, 0x57, 0x99, 0x58, 0x57, 0xEB, 0x98, 0x77, 0xD8, 0x6D, 0x97, 0x8E, 0xB0, 0x70, 0xC4, 0xB0,
+    0x6C, 0xC4, 0x68, 0xD1, 0x88, 0x96, 0x8C, 0x68, 0xC1, 0x88, 0x96, 0x8B, 0x68, 0xB1, 0xC7, 0xAB,
+    0xB6, 0x5A, 0x1A, 0xA2, 0x85, 0x21, 0x5A, 0x16, 0xB2, 0xAE, 0x04, 0x29, 0xDB, 0x8D, 0xA0, 0xBC,
+    0x86, 0xDD, 0x8D, 0x8B, 0x38, 0xEE, 0x3E, 0x72, 0xE5, 0xBF, 0x1A, 0x16, 0x4A, 0xF8, 0xED, 0xCF,
+    0x17, 0x5C, 0xC2, 0x27, 0xB1, 0x46, 0x7B, 0x0E, 0xF8, 0x65, 0xA2, 0x5B, 0xCE, 0xED, 0x3C, 0x17,
+    0xE7, 0xBB, 0xBC, 0x1D, 0xE7, 0x53, 0xAD, 0xD8, 0x33, 0xCE, 0x17, 0x69, 0x9C, 0x6F, 0xD1, 0x66,
+    0x2F, 0x06, 0xF8, 0xB2, 0x62, 0x33, 0xC0, 0x57, 0x6A, 0x5C, 0xE9, 0x9E, 0x1A, 0x54, 0xBA, 0x59,
+    0x60, 0x7A, 0xC9, 0x1E, 0x89, 0x54, 0x73, 0x1F, 0x1F, 0xD9, 0x53, 0x9D, 0x99, 0x77, 0x2E, 0xD9,
+    0xC5, 0x00, 0x1E, 0x97, 0x15, 0x7C, 0xEE, 0xED, 0xB4, 0x4B, 0xA8, 0xE4, 0x7E, 0x37, 0xF2, 0x4D,
+    0x76, 0xCD, 0xD7, 0x7D, 0x04, 0xD7, 0xBF, 0x26, 0xD0, 0x37, 0x8A, 0x61, 0xBF, 0x18, 0x5E, 0x6B,
+    0xA0, 0xCF, 0x5C, 0xF8, 0xEC, 0x68, 0x75, 0x92, 0x37, 0x1C, 0x02, 0x6F, 0x42, 0x47, 0xBE, 0x24,
+    0x22, 0xAE, 0xCC, 0xFF, 0xAD, 0x18, 0xA0, 0x09, 0x54, 0x45, 0x68, 0x99, 0xE0, 0xF1, 0x29, 0xDB,
+    0xBB, 0xE6, 0xB4, 0x06, 0x06, 0xD5, 0x1A, 0x28, 0xBB, 0xB9, 0x44, 0x41, 0xFD, 0x0D, 0x4D, 0x5D,
+    0x24, 0x5B, 0xBC, 0x4C, 0x39, 0xEB, 0x4F, 0x89, 0xE1, 0xB4, 0xF6, 0x52, 0x43, 0x7A, 0xA9, 0x30,
+    0x7B, 0x96, 0x70, 0x08, 0x44, 0xA6, 0x93, 0x12, 0x5E, 0x6A, 0x46, 0x2F, 0xF5, 0x5D, 0x7A, 0xA0,
+    0x77, 0xE9, 0xA5, 0xF6, 0xF0, 0x4C, 0xC3, 0x0E, 0xAD, 0x58, 0x2C, 0xD2, 0x62, 0x37, 0xE5, 0x63,
+    0x4A, 0x2F, 0xF5, 0x32, 0xBD, 0xD4, 0x4F, 0xE8, 0xA5, 0xA2, 0x14, 0x2D, 0xE1, 0x09, 0xB1, 0xA0,
+    0xAD, 0x44, 0x6B, 0xC0, 0x7B, 0xA9, 0x39, 0xA5, 0xE8, 0x0A, 0xD9, 0x78, 0x97, 0x39, 0x19, 0x97,
+    0x30, 0xDE, 0xFD, 0xC2, 0x07, 0xFC, 0x29, 0xA6, 0xCC, 0xDD, 0x2D, 0xB7, 0x75, 0xD8, 0x9E, 0xE8,
+    0x87, 0x03, 0x46, 0x4E, 0x44, 0x07, 0x3B, 0x87, 0x34, 0x80, 0x43, 0x1A, 0xC1, 0x21, 0x8D, 0x45,
+    0xF3, 0xF4, 0xA9, 0x38, 0x68, 0xDD, 0x65, 0xF8, 0xA2, 0xF7, 0xD0, 0x88, 0x3B, 0x5A, 0xFE, 0x51,
+    0x5C, 0xB6, 0xFC, 0x7F, 0x1A, 0x71, 0x48, 0x85, 0xEB, 0x6D, 0xB6, 0x82, 0x43, 0x3A, 0x79, 0x87,
+    0x34, 0x02, 0x18, 0x11, 0x8E, 0x98, 0xB8, 0xBA, 0x6A, 0x9C, 0xA5, 0x75, 0xB8, 0xCB, 0x1D, 0x53,
+    0xFF, 0x52, 0x8D, 0xA2, 0xDF, 0x68, 0xED, 0x68, 0x57, 0xEB, 0x4E, 0xA1, 0xBB, 0x6A, 0xEE, 0x2E,
+    0x9A, 0xB3, 0x9A, 0x17, 0xBA, 0xF8, 0x0B, 0x51, 0x50, 0xF9, 0x97, 0x2B, 0x94, 0x18, 0xD6, 0xE2,
+    0x70, 0x8C, 0x19, 0x06, 0x41, 0xA4, 0xED, 0xD2, 0x9C, 0xFF, 0x3C, 0x91, 0x24, 0x84, 0xAB, 0x15,
+    0x70, 0x3A, 0xBD, 0x56, 0x80, 0x56, 0x77, 0x5A, 0x42, 0xC2, 0xBC, 0x5B, 0xD8, 0x06, 0x67, 0x37,
+    0xFD, 0x46, 0xC9, 0x4E, 0xAC, 0x0F, 0x43, 0xDB, 0x3B, 0x32, 0x89, 0x41, 0x6E, 0x0C, 0xE0, 0x03,
+    0x9D, 0x18, 0xCC, 0xBB, 0x9F, 0x5D, 0xA4, 0x8D, 0x9D, 0xF1, 0xA0, 0x62, 0x51, 0x69, 0xF9, 0x3E,
+    0x96, 0x9C, 0x36, 0x58, 0x71, 0xD4, 0x5E, 0x7A, 0x21, 0x3C, 0xAB, 0xD1, 0x59, 0x69, 0xC5, 0x53,
+    0x09, 0xF4, 0x0D, 0x80, 0x2B, 0x2F, 0xB4, 0xE7, 0xBD, 0x55, 0xB5, 0xD5, 0x3E, 0x86, 0xB7, 0x46,
+    0x83, 0x1F, 0x36, 0x6C, 0x75, 0xEC, 0x35, 0xDB, 0x6D, 0x5C, 0x69, 0xB1, 0xBA, 0xB6, 0xAE, 0x60,
+    0x5D, 0xCB, 0xD4, 0xD9, 0x7E, 0xFC, 0xDE, 0x5A, 0x5A, 0x05, 0x89, 0xC5, 0x90, 0x0B, 0x13, 0x26,
+    0x54, 0x93, 0x5C, 0x0E, 0xBB, 0xED, 0x50, 0x15, 0xE2, 0xA2, 0xF0, 0x21, 0x97, 0x31, 0x4E, 0x52,
+    0xD9, 0xDD, 0x99, 0x58, 0x9B, 0x6A, 0x78, 0xC2, 0xEB, 0xAA, 0xCA, 0x67, 0x72, 0x8C, 0xF0, 0xB8,
+    0x2F, 0xFF, 0xB4, 0xBF, 0x5F, 0xB8, 0x48, 0x8F, 0x6F, 0x44, 0x65, 0xEF, 0x40, 0x01, 0x89, 0x0C,
+    0xD8, 0x1B, 0x0F, 0x5C, 0xA8, 0xEA, 0x60, 0xAE, 0x83, 0x53, 0xB3, 0x98, 0x6F, 0xC8, 0x08, 0x4B,
+    0x28, 0x33, 0x4F, 0x56, 0xF4, 0xB9, 0x60, 0x3F, 0xFE, 0xA5, 0x49, 0x4E, 0x37, 0x8C, 0xBA, 0xD9,
+    0x52, 0x35, 0x78, 0x9C, 0x34, 0x06, 0x47, 0xA4, 0xF1, 0x04, 0x60, 0xBC, 0x78, 0xE3, 0x0B, 0x93,
+    0x7D, 0x65, 0x85, 0x97, 0x65, 0x15, 0x4D, 0xA2, 0x78, 0x96, 0xE2, 0xA4, 0x5D, 0x0A, 0xD6, 0x89,
+    0x47, 0xE0, 0x45, 0xF5, 0x2E, 0x93, 0x8C, 0xF8, 0x2E, 0xCA, 0x77, 0xFF, 0x61, 0xFC, 0x48, 0xC7,
+    0xDD, 0x7A, 0xFE, 0x78, 0xCC, 0xF3, 0x11, 0xCB, 0x2F, 0x79, 0x0F, 0xA3, 0xF2, 0xAF, 0xF4, 0x03,
+    0x07, 0x44, 0x8C, 0x5F, 0xFE, 0xBC, 0xAD, 0x9E, 0x22, 0x24, 0x25, 0x79, 0xB2, 0x14, 0x34, 0x72,
+    0x91, 0x91, 0xF4, 0xC4, 0x6A, 0x6D, 0x05, 0x6B, 0x31, 0x23, 0x32, 0xF1, 0x61, 0x6E, 0x0F, 0xF7,
+    0xCC, 0xF8, 0x6B, 0xF3, 0xF3, 0x79, 0x79, 0x25, 0xDF, 0xD7, 0x08, 0x5F, 0xE2, 0x5F, 0xC4, 0x54,
+    0x02, 0x56, 0x73, 0xB8, 0x0B, 0x43, 0xC3, 0xF2, 0x40, 0xCC, 0x1F, 0x2E, 0xE7, 0xE3, 0xD0, 0x9D,
+    0x86, 0x77, 0xE3, 0xE6, 0x0C, 0x54, 0xD4, 0x82, 0xF7, 0x64, 0x3E, 0xB9, 0xEF, 0xCE, 0x3D, 0xF0,
+    0x7F, 0x53, 0x00, 0x4E, 0xA0, 0xA2, 0xD6, 0x9D, 0x7B, 0xB9, 0x4B, 0x5C, 0x21, 0xB9, 0xB0, 0x42,
+    0xBA, 0x26, 0xEA, 0x60, 0x53, 0x44, 0x4D, 0xD8, 0x9E, 0x01, 0x30, 0x75, 0x29, 0x0C, 0xC4, 0x33,
+    0x2E, 0x57, 0xDF, 0x16, 0x08, 0x47, 0x9C, 0x8E, 0xBD, 0xF9, 0xF5, 0xC9, 0x81, 0x19, 0x7E, 0x7E,
+    0x01, 0xA7, 0xDB, 0x8A, 0x06, 0xBB, 0x65, 0xC1, 0x53, 0xFE, 0x0B, 0x2A, 0xE7, 0x96, 0x09, 0xBB,
+    0x2E, 0x3B, 0xEE, 0xA5, 0x51, 0x8D, 0x35, 0x22, 0x9A, 0xEA, 0x82, 0x56, 0x85, 0x4B, 0x04, 0xFA,
+    0xD0, 0xD5, 0x8B, 0xAD, 0x46, 0x49, 0x11, 0x36, 0xB6, 0x8F, 0x0F, 0xE8, 0xFE, 0x33, 0x7D, 0xF8,
+    0x5C, 0xC3, 0xA0, 0xBA, 0x03, 0x6B, 0xEE, 0x65, 0x8D, 0x44, 0xA7, 0x4B, 0x9F, 0x6A, 0xDC, 0x18,
+    0x3F, 0x60, 0x30, 0x41, 0x9E, 0x6E, 0xCA, 0x15, 0xDA, 0xD8, 0xAA, 0x4C, 0xE2, 0x60, 0x8B, 0x07,
+    0x91, 0xC9, 0x70, 0x82, 0xE3, 0xFE, 0x00, 0x45, 0x39, 0x59, 0x30, 0x6C, 0xB8, 0xEE, 0xF9, 0x4A,
+    0x1E, 0x8D, 0xC8, 0x60, 0x15, 0xD9, 0x12, 0xAF, 0x3C, 0xF5, 0xB5, 0x38, 0x47, 0x6D, 0x29, 0xDB,
+    0xB4, 0xF9, 0x91, 0xBA, 0x40, 0xAE, 0x29, 0xBE, 0xA1, 0x89, 0xB4, 0x69, 0xA0, 0x07, 0x56, 0xF4,
+    0x7C, 0x59, 0x63, 0x4B, 0x57, 0xA2, 0xD6, 0xD7, 0xB6, 0x59, 0x6A, 0xF5, 0x4C, 0xCC, 0x42, 0x58,
+    0x46, 0x32, 0x60, 0x5C, 0x2C, 0xAA, 0x53, 0x8D, 0xE0, 0x4B, 0x1D, 0x6C, 0xDF, 0x2F, 0x82, 0x17,
+    0x6F, 0x7C, 0x4E, 0x64, 0xBE, 0xB2, 0xFA, 0xDE, 0x4E, 0xCD, 0x68, 0x14, 0xD5, 0x8B, 0x53, 0x30,
+    0x9B, 0xA6, 0xF5, 0x59, 0x2D, 0x2D, 0x3C, 0x77, 0xEB, 0x63, 0xF8, 0xE4, 0x53, 0x8E, 0x0C, 0xE8,
+    0x32, 0xC5, 0xAA, 0xEA, 0x05, 0x64, 0x34, 0xBB, 0xC1, 0x52, 0xA6, 0xE6, 0xEF, 0x4F, 0x41, 0xE5,
+    0xB5, 0x2B, 0xBC, 0x56, 0x27, 0xC0, 0xBD, 0xFE, 0x5F, 0xDE, 0xEE, 0x35, 0x52, 0xC0, 0x70, 0xD4,
+    0x7C, 0x14, 0x9E, 0xE1, 0xEA, 0x6A, 0xDD, 0xB1, 0x0C, 0x47, 0x47, 0x0C, 0x74, 0xC6, 0xCF, 0x58,
+    0xCF, 0x54, 0xE1, 0xCE, 0x44, 0xF6, 0xEC, 0x0F, 0xCF, 0x08, 0xC2, 0x7F, 0x13, 0xEA, 0x7A, 0x54,
+    0x97, 0x26, 0x6B, 0x61, 0x44, 0x8A, 0x22, 0x40, 0xB3, 0x44, 0x50, 0x70, 0x4F, 0xF3, 0x0A, 0x7C,
+    0xAD, 0x94, 0xAC, 0x4A, 0x2C, 0xB3, 0x74, 0x5A, 0xB2, 0x39, 0x31, 0x6F, 0xE1, 0xAB, 0x2B, 0xC4,
+    0x1C, 0xDC, 0xE1, 0x7F, 0x3A, 0x80, 0x37, 0x96, 0x6A, 0x94, 0xB9, 0x22, 0x8C, 0x5C, 0xD5, 0x18,
+    0x4F, 0x8E, 0xAA, 0xA5, 0x0C, 0x50, 0x0F, 0x66, 0x97, 0x2A, 0x65, 0x5D, 0x33, 0x45, 0x6F, 0x87,
+    0x85, 0xE7, 0x7C, 0xA3, 0x8C, 0x67, 0xC1, 0x65, 0x34, 0xE7, 0x35, 0x29, 0xC4, 0xB0, 0x72, 0xFA,
+    0x1C, 0xA9, 0xD2, 0xBC, 0x29, 0x8B, 0xA4, 0xA9, 0x8B, 0xA4, 0x60, 0xE6, 0x12, 0xE7, 0xA0, 0x7D,
+    0x64, 0x10, 0xF8, 0x5E, 0xC0, 0x0C, 0x87, 0x01, 0x2B, 0x8A, 0xE7, 0xAF, 0x44, 0x57, 0xDF, 0x93,
+    0x61, 0x57, 0xB0, 0x7F, 0x8A, 0xAC, 0xC9, 0x9F, 0xA3, 0x54, 0x64, 0x5C, 0xC7, 0xCC, 0xB1, 0x39,
+    0x4A, 0x79, 0x3E, 0x0E, 0x1F, 0x30, 0x6E, 0xD0, 0x53, 0x10, 0xD6, 0xB2, 0x6D, 0x18, 0x73, 0x6A,
+    0xEB, 0xC2, 0x76, 0xD7, 0xDA, 0x7B, 0x38, 0x58, 0xD9, 0x46, 0xED, 0x5D, 0xB6, 0xD7, 0xA5, 0x0D,
+    0x6F, 0xBA, 0x54, 0xE3, 0xEB, 0x6E, 0x7B, 0xD5, 0xDC, 0x9A, 0x79, 0x3D, 0x1A, 0xB9, 0xC8, 0xF5,
+    0x75, 0x3B, 0xC2, 0x56, 0x1A, 0x9F, 0x23, 0xD7, 0xC9, 0x3B, 0x86, 0xA2, 0x92, 0x00, 0x17, 0xC8,
+    0xDA, 0x90, 0x76, 0x7A, 0x47, 0xB7, 0x4B, 0xF5, 0xE7, 0xF6, 0x9F, 0x5E, 0xC9, 0x12, 0x0F, 0xF9,
+    0x3F, 0x68, 0x3C, 0x46, 0xE2, 0xA1, 0x61, 0x94, 0xDD, 0xBF, 0x2E, 0x80, 0x63, 0x0F, 0xFA, 0x12,
+    0xCF, 0xF8, 0xD4, 0x4D, 0x60, 0x6F, 0x9D, 0xC4, 0xA2, 0x83, 0x8C, 0x54, 0xC6, 0xC2, 0xF2, 0xAD,
+    0xE6, 0x26, 0x47, 0x8E, 0x2D, 0x47, 0x46, 0x2D, 0x6E, 0x5C, 0xFA, 0xBB, 0x71, 0x0A, 0x9C, 0xA9,
+    0xDD, 0x72, 0x70, 0x59, 0xF8, 0x1C, 0x82, 0x74, 0x7E, 0xCE, 0xD3, 0xBA, 0xB7, 0x58, 0xE9, 0xB3,
+    0x94, 0x83, 0x4F, 0x6D, 0xF1, 0x57, 0xFE, 0x41, 0x73, 0x0D, 0x8D, 0x1F, 0x65, 0x82, 0xAF, 0x27,
+    0x4A, 0x40, 0xE5, 0x01, 0xE8, 0xAD, 0x6B, 0x50, 0x03, 0x3D, 0x2E, 0xD3, 0x67, 0xF8, 0xAF, 0x4C,
+    0xF2, 0xBE, 0x2C, 0xD2, 0xB1, 0x14, 0xC7, 0x27, 0x63, 0x10, 0x0B, 0xB1, 0x05, 0xBC, 0x00, 0xC9,
+    0xFF, 0x20, 0xA5, 0x32, 0x07, 0xD8, 0x2B, 0xD2, 0xDF, 0x84, 0x8B, 0x84, 0xBF, 0xC3, 0xD0, 0x42,
+    0xA8, 0x81, 0x3F, 0x4B, 0xFD, 0x0E, 0x86, 0x58, 0xD9, 0xF3, 0xF1, 0xD9, 0x4A, 0x20, 0x7E, 0x44,
+    0x31, 0xFC, 0xBB, 0x42, 0x5F, 0x17, 0xF9, 0x89, 0x96, 0x05, 0x68, 0x48, 0xEA, 0x97, 0x83, 0xF1,
+    0x65, 0x01, 0xC6, 0xFF, 0xE7, 0x04, 0xA1, 0x3D, 0xAE, 0xD4, 0x2A, 0xD4, 0x97, 0xFA, 0x43, 0xBE,
+    0xD2, 0xDF, 0xFB, 0x17, 0xFA, 0xDD, 0xEB, 0xFC, 0x2F, 0xDB, 0x21, 0x43, 0xA5, 0xC9, 0xFA, 0xA5,
+    0xD1, 0xDC, 0xD4, 0xB7, 0x19, 0x85, 0x9D, 0x4B, 0x9F, 0x6D, 0xCF, 0xEC, 0xB5, 0x97, 0x5A, 0xBD,
+    0xC5, 0x32, 0x2A, 0x7A, 0xB2, 0x25, 0x4B, 0xA4, 0x5C, 0xAE, 0x23, 0xFF, 0x7E, 0x72, 0x1D, 0xFF,
+    0x0B, 0x8D, 0x56, 0x41, 0x6C, 0xDC, 0x44, 0x14, 0x7D, 0x5E, 0x77, 0xB3, 0x25, 0xA6, 0x9D, 0x1C,
+    0xB2, 0x6A, 0x95, 0x04, 0xDC, 0x43, 0x91, 0x4A, 0x81, 0x75, 0x0F, 0x3D, 0xE4, 0xB0, 0xBB, 0x33,
+    0x29, 0x20, 0x6E, 0x74, 0x25, 0x12, 0x09, 0xC1, 0xA1, 0x48, 0xDC, 0xCA, 0xA1, 0x3D, 0xE6, 0xB0,
+    0x89, 0xAD, 0xF4, 0xC0, 0x0D, 0x56, 0x48, 0xE5, 0x4A, 0x04, 0x97, 0x6A, 0x11, 0xB4, 0xA0, 0x1E,
+    0x82, 0x94, 0xAC, 0x8D, 0x2A, 0x84, 0x38, 0x61, 0xD1, 0x4A, 0x95, 0xE8, 0xC5, 0x48, 0x48, 0x2D,
+    0xAA, 0x90, 0x7C, 0xF0, 0x61, 0x0B, 0xDE, 0x1D, 0xDE, 0xD8, 0xD9, 0x90, 0xA8, 0x0A, 0x62, 0x66,
+    0x3C, 0xF6, 0xFC, 0xF9, 0x7F, 0xE6, 0xCF, 0xFF, 0xFF, 0xFD, 0xF1, 0xD9, 0x4D, 0x78, 0x19, 0x9C,
+    0x1C, 0x96, 0x06, 0x64, 0x00, 0x27, 0xB2, 0xFA, 0xCA, 0xD6, 0x10, 0x39, 0xBC, 0x04, 0x52, 0x61,
+    0x0B, 0x40, 0x5F, 0xA1, 0xA2, 0x23, 0xD4, 0x74, 0x0A, 0x71, 0x77, 0x48, 0xEA, 0x0E, 0xBA, 0x70,
+    0x81, 0x0E, 0x50, 0x1B, 0x5B, 0xA9, 0xAB, 0x1F, 0x26, 0x32, 0xD4, 0x71, 0xCB, 0xD1, 0xC1, 0x2C,
+    0xBE, 0x43, 0xA8, 0x13, 0xAD, 0x53, 0xF6, 0xF5, 0x95, 0x95, 0x65, 0xCD, 0xD2, 0x67, 0x99, 0xC5,
+    0x6C, 0x13, 0x5D, 0xB9, 0x94, 0xBB, 0x3A, 0x73, 0x74, 0x82, 0x01, 0xE6, 0x54, 0x98, 0x90, 0x2D,
+    0x91, 0x11, 0x4C, 0x91, 0xC8, 0xC3, 0x8D, 0x51, 0xB8, 0x31, 0x26, 0x0F, 0x87, 0xD5, 0x8E, 0x9F,
+    0x3F, 0x09, 0x67, 0x24, 0xFC, 0x4A, 0x5E, 0x8B, 0x6B, 0x91, 0xA5, 0x00, 0x37, 0xF3, 0x47, 0x99,
+    0x9B, 0x8A, 0xCC, 0xF5, 0x47, 0x6E, 0x06, 0x54, 0x6E, 0xCC, 0xF5, 0x6A, 0xB9, 0x8C, 0x44, 0x1A,
+    0x2A, 0x2F, 0x1A, 0x41, 0xDA, 0x19, 0xB6, 0xEC, 0x18, 0x67, 0x30, 0xAD, 0xA4, 0x92, 0x10, 0xBF,
+    0xE5, 0xB0, 0x75, 0xC6, 0xB3, 0x25, 0x40, 0x18, 0x61, 0x76, 0xCD, 0x94, 0xD9, 0xE5, 0x7A, 0x2E,
+    0x27, 0x75, 0xB9, 0x7E, 0xF9, 0xC2, 0x0D, 0xC8, 0x5F, 0xC6, 0x10, 0xA9, 0x46, 0x2D, 0x93, 0x91,
+    0x95, 0x8B, 0x18, 0xAD, 0x4A, 0x82, 0x59, 0x40, 0x53, 0x54, 0xB1, 0x51, 0xDB, 0x2E, 0x5A, 0x6D,
+    0x6C, 0x7B, 0x7A, 0x48, 0xE5, 0xAD, 0x81, 0xE2, 0xAC, 0xAD, 0x23, 0xA1, 0x53, 0xF9, 0x38, 0x27,
+    0xBD, 0x89, 0x26, 0xDE, 0xB3, 0x53, 0x37, 0x68, 0x61, 0x1B, 0x63, 0xE8, 0x48, 0xC7, 0x61, 0x2C,
+    0xA3, 0x2A, 0x0F, 0x29, 0x63, 0x3F, 0xF5, 0x53, 0x2F, 0xAD, 0xA5, 0x76, 0xEC, 0x44, 0x3E, 0xA8,
+    0x37, 0xE6, 0x95, 0x1F, 0x6B, 0x53, 0x03, 0x63, 0xC9, 0x36, 0x44, 0x62, 0xA5, 0x98, 0x99, 0x23,
+    0x75, 0x3F, 0x6F, 0x48, 0x5E, 0x85, 0xB3, 0xF4, 0xD0, 0xF0, 0x80, 0x87, 0xD0, 0x0F, 0x2A, 0x3A,
+    0xB0, 0xA9, 0x72, 0x06, 0x2F, 0xA2, 0x38, 0xD0, 0x43, 0xF2, 0x41, 0x12, 0x26, 0x56, 0x02, 0x9E,
+    0xF4, 0x3D, 0xDC, 0xC2, 0xA0, 0x17, 0x26, 0xB7, 0xF9, 0x06, 0xEA, 0x2B, 0x2A, 0xD4, 0x11, 0x9B,
+    0x91, 0xAC, 0x1D, 0x6C, 0x96, 0xA2, 0x7E, 0x49, 0xB9, 0x63, 0x2D, 0x0E, 0x83, 0xA1, 0x71, 0x84,
+    0x37, 0x48, 0xD3, 0xCC, 0xA7, 0x7B, 0xED, 0xC8, 0x54, 0x63, 0xA6, 0xFA, 0xB2, 0xCC, 0x5F, 0x7A,
+    0x64, 0x46, 0x95, 0xA0, 0x12, 0xD8, 0xD1, 0x89, 0x7B, 0x32, 0x3F, 0x71, 0xCF, 0x8C, 0xFC, 0x51,
+    0x38, 0xA6, 0x2D, 0x5A, 0x65, 0x7D, 0x21, 0xF7, 0x73, 0x99, 0x4E, 0xA9, 0x59, 0x9E, 0xAA, 0xAC,
+    0xF2, 0x6D, 0x39, 0x12, 0xB9, 0xD5, 0xE3, 0xB2, 0x51, 0x98, 0x1A, 0x77, 0xCF, 0xA9, 0xD2, 0xD9,
+    0xFE, 0xC6, 0x78, 0xCF, 0xD9, 0x9C, 0x1D, 0x0E, 0x06, 0xA9, 0x98, 0xB8, 0xD6, 0x8D, 0xBD, 0x48,
+    0xAA, 0x36, 0xE5, 0x67, 0x60, 0xA1, 0xA6, 0x9C, 0xC4, 0x19, 0xD1, 0x07, 0xE1, 0xD2, 0x58, 0xE7,
+    0x61, 0x52, 0x4B, 0x3C, 0xE5, 0xD3, 0xCA, 0x63, 0x84, 0x9F, 0xFA, 0xDA, 0x19, 0x9F, 0x29, 0xDD,
+    0xCA, 0x20, 0x63, 0xAC, 0x8D, 0x57, 0x42, 0x46, 0x69, 0x02, 0xA7, 0x87, 0xA9, 0xAB, 0xA7, 0x8F,
+    0x9D, 0x5B, 0x5C, 0x68, 0x8F, 0xB7, 0xDD, 0x07, 0x69, 0xB1, 0x0B, 0x76, 0xB0, 0xCE, 0x1D, 0xC5,
+    0xE3, 0xB4, 0xA6, 0x63, 0xDA, 0xB0, 0x24, 0x1A, 0x63, 0xEA, 0x98, 0x44, 0xB9, 0x91, 0x93, 0xA1,
+    0x83, 0x2A, 0x89, 0x5D, 0x34, 0xDB, 0xC8, 0xE9, 0x6F, 0xFA, 0x78, 0x3F, 0x27, 0x87, 0x24, 0x72,
+    0x8A, 0x0C, 0x25, 0x11, 0xB5, 0x61, 0x25, 0x76, 0xF5, 0x1B, 0xB1, 0xD4, 0x3A, 0x5A, 0x73, 0xB5,
+    0x5A, 0xAD, 0x8C, 0x0A, 0xFA, 0x1E, 0x0E, 0xA8, 0x56, 0x3A, 0x79, 0xA8, 0xE5, 0xA6, 0x79, 0xAF,
+    0xAC, 0xAC, 0x74, 0x0C, 0xD3, 0xFE, 0xB1, 0x45, 0x8A, 0x18, 0xD9, 0x89, 0xA7, 0x1F, 0x14, 0x8B,
+    0x75, 0x85, 0xC6, 0xB2, 0xB5, 0x85, 0xCB, 0xFD, 0x7E, 0x2F, 0xD4, 0x3A, 0x31, 0x6F, 0x83, 0xA5,
+    0x42, 0xA2, 0x5C, 0x8B, 0xDF, 0x54, 0x8B, 0xEB, 0xB8, 0x44, 0x11, 0xD5, 0x64, 0x9C, 0xC0, 0x8F,
+    0x09, 0x4B, 0xDA, 0x98, 0xA1, 0x40, 0x00, 0xE3, 0x48, 0xA9, 0xBA, 0x51, 0x94, 0x3C, 0x0E, 0x8F,
+    0x22, 0x48, 0xF5, 0x38, 0x6E, 0x15, 0xE7, 0x44, 0x81, 0x71, 0x03, 0x27, 0x1A, 0x89, 0xE8, 0x79,
+    0x8A, 0xAD, 0xBD, 0xCB, 0x36, 0xDC, 0xC7, 0x96, 0x94, 0x6C, 0xE2, 0x10, 0xB6, 0x59, 0xB3, 0xE5,
+    0x70, 0x20, 0x84, 0x3B, 0xCA, 0xE8, 0x08, 0xBA, 0x83, 0x4E, 0xA1, 0x6B, 0xCA, 0x64, 0xC0, 0xBC,
+    0xA0, 0xCC, 0xF9, 0x16, 0x51, 0xD9, 0x7B, 0xCC, 0xF8, 0x6C, 0xBF, 0x1F, 0x38, 0x9F, 0xF0, 0xF8,
+    0xF9, 0xF9, 0xE6, 0xC2, 0xD5, 0x97, 0x8F, 0x15, 0x8A, 0x37, 0x9B, 0xDE, 0xD0, 0x49, 0x44, 0xDA,
+    0xDE, 0x3E, 0x79, 0x9A, 0x7A, 0x45, 0x9E, 0x6A, 0x52, 0x71, 0x8F, 0x5B, 0x9B, 0x78, 0xF4, 0x82,
+    0x17, 0x61, 0x4C, 0x37, 0x31, 0xAD, 0x91, 0xD8, 0x3F, 0xFE, 0x3F, 0xE8, 0x39, 0xCC, 0xEC, 0x73,
+    0x90, 0x91, 0x8C, 0xE7, 0x63, 0x3B, 0x72, 0xD5, 0x62, 0xE9, 0x6A, 0x87, 0xE6, 0x11, 0x29, 0xDA,
+    0xE2, 0x7E, 0xEC, 0x5F, 0xFA, 0x39, 0xF5, 0x2F, 0x5D, 0x4C, 0xA5, 0x47, 0xE2, 0x73, 0x30, 0x98,
+    0x8F, 0x74, 0x10, 0x12, 0xC1, 0x6E, 0xEF, 0xE9, 0x50, 0xFC, 0x2F, 0xB7, 0x1F, 0xCC, 0x47, 0xA4,
+    0x13, 0x27, 0x56, 0x51, 0x41, 0xFC, 0xE3, 0x02, 0x57, 0xD0, 0x11, 0xB5, 0x7B, 0x58, 0x68, 0xB7,
+    0x2A, 0xB5, 0xEA, 0xB4, 0x6E, 0x80, 0x59, 0xAE, 0x2C, 0xD3, 0x06, 0x4F, 0x51, 0xE1, 0xF6, 0xE2,
+    0x5D, 0xB5, 0x3A, 0x53, 0x4F, 0x6C, 0x46, 0xA4, 0x36, 0x46, 0x0D, 0xBA, 0xF3, 0x63, 0xAC, 0x12,
+    0x47, 0xF0, 0x82, 0x92, 0xC7, 0x3C, 0x6E, 0x70, 0xE8, 0xA9, 0x0F, 0xA3, 0xB3, 0x3C, 0x6B, 0x43,
+    0x9A, 0x54, 0x92, 0x34, 0xDE, 0x0D, 0x8E, 0x56, 0xCA, 0xDD, 0x6D, 0x66, 0x5F, 0x37, 0x63, 0x86,
+    0x2E, 0x6A, 0x18, 0x79, 0x43, 0x7B, 0xAC, 0x63, 0x6F, 0x68, 0x2E, 0x0B, 0x14, 0xC6, 0x2A, 0xFB,
+    0xB7, 0x7E, 0x80, 0xE8, 0xE0, 0xDB, 0x8F, 0x08, 0xAE, 0xE3, 0x30, 0x89, 0xE9, 0x19, 0x93, 0xA8,
+    0x70, 0xCA, 0x7C, 0x74, 0xAE, 0x02, 0xC7, 0xAB, 0xBB, 0x9C, 0x4C, 0x15, 0xB6, 0x48, 0x4D, 0x18,
+    0xEE, 0xCA, 0x6E, 0x9A, 0xD9, 0x69, 0xB0, 0x3F, 0x36, 0x91, 0x2A, 0x57, 0xC0, 0x37, 0x6F, 0x02,
+    0x29, 0xDE, 0xFF, 0xE9, 0xDF, 0x5D, 0x4C, 0xAF, 0x8D, 0x0E, 0xBA, 0xD4, 0xE1, 0x14, 0xFD, 0xEB,
+    0x64, 0x56, 0xEE, 0x0C, 0xA5, 0x3A, 0x6F, 0x66, 0xDD, 0xF5, 0xAC, 0x4C, 0x6E, 0x7D, 0xC5, 0x44,
+    0x4E, 0x24, 0x4B, 0x83, 0xE4, 0x16, 0x93, 0xCB, 0x6E, 0xA6, 0xD7, 0x65, 0xF0, 0x1E, 0x88, 0xBA,
+    0xA3, 0xD8, 0x76, 0x13, 0xA9, 0xBC, 0xC4, 0xCA, 0xB1, 0x60, 0x74, 0x3E, 0xB8, 0x68, 0x87, 0x12,
+    0x3B, 0x26, 0x26, 0x93, 0x75, 0xD8, 0xC3, 0x90, 0xD7, 0xD4, 0xDF, 0x6A, 0xBD, 0x72, 0x37, 0xDA,
+    0xB4, 0xBF, 0x8F, 0x91, 0xED, 0xB8, 0x06, 0x04, 0x98, 0x0E, 0x64, 0xEA, 0x67, 0x32, 0x73, 0x89,
+    0x1C, 0x2A, 0xBD, 0xF0, 0x85, 0xF2, 0x6E, 0x06, 0x95, 0x21, 0xD8, 0x9F, 0xFC, 0x5C, 0x91, 0x32,
+    0xBD, 0xB1, 0x29, 0x75, 0x7E, 0xBB, 0xF9, 0xFC, 0xAD, 0xE6, 0x71, 0xB6, 0x75, 0xBD, 0xE3, 0xDE,
+    0xCF, 0xCC, 0x51, 0x17, 0x60, 0x22, 0x03, 0x8B, 0xC6, 0x02, 0xDD, 0xC2, 0xE4, 0xB1, 0x57, 0x1C,
+    0x34, 0x70, 0xCC, 0x5A, 0x46, 0xF3, 0xEB, 0xD5, 0x2B, 0x64, 0xF5, 0x18, 0x50, 0xF4, 0xB1, 0x15,
+    0xEA, 0xDF, 0x31, 0x29, 0xAB, 0x05, 0xF6, 0x27, 0x02, 0xBC, 0xD9, 0x8C, 0x40, 0x65, 0xDC, 0xC3,
+    0x15, 0xC2, 0xD4, 0xA7, 0x00, 0x29, 0x95, 0x50, 0x3F, 0xDA, 0x13, 0x30, 0x10, 0x1D, 0x17, 0xE9,
+    0x65, 0x8F, 0x84, 0x62, 0x58, 0x4C, 0x58, 0xE1, 0x1F, 0x1C, 0xBF, 0xE2, 0x68, 0xFD, 0x84, 0xCA,
+    0x30, 0xC4, 0xF4, 0x5F, 0x5F, 0xD2, 0x84, 0x53, 0x26, 0x94, 0xA9, 0xDB, 0x94, 0x2E, 0x33, 0xA5,
+    0xB5, 0x6C, 0x6E, 0xF0, 0xBE, 0x89, 0x74, 0x33, 0xD5, 0x2B, 0xB7, 0x1A, 0xF1, 0xCA, 0xBC, 0x8E,
+    0x77, 0x78, 0x6D, 0x1A, 0xBD, 0xE7, 0xD3, 0x76, 0xB1, 0x78, 0x5E, 0xE4, 0x8A, 0x32, 0x63, 0x14,
+    0xE5, 0x9C, 0xD9, 0x2D, 0xD7, 0x05, 0x80, 0x58, 0x8A, 0xC8, 0x3B, 0x55, 0xCC, 0xF0, 0xCE, 0x6F,
+    0x36, 0x4D, 0xDA, 0x9A, 0xE7, 0xB5, 0xD9, 0x32, 0xAD, 0x3D, 0x40, 0xB5, 0x4A, 0x67, 0x34, 0x1A,
+    0x4D, 0x57, 0x6A, 0x26, 0x06, 0xCB, 0xFD, 0xCA, 0xEA, 0x38, 0xCA, 0xE4, 0x24, 0xC9, 0x7E, 0x52,
+    0xDD, 0xB8, 0xAE, 0x1C, 0x4A, 0x37, 0xD0, 0x15, 0xD8, 0x2E, 0x5A, 0xD3, 0x45, 0x63, 0xCD, 0x44,
+    0xBB, 0x74, 0x03, 0xB7, 0x16, 0x89, 0xBD, 0xE6, 0x44, 0xE2, 0x71, 0x6C, 0x2D, 0x75, 0xDC, 0xA4,
+    0xBB, 0x9A, 0x9D, 0xCA, 0x98, 0xF2, 0xB6, 0x8E, 0xB4, 0x6F, 0x57, 0xCD, 0x4F, 0x00, 0x1A, 0xA6,
+    0xB9, 0x5F, 0xA3, 0xDB, 0xC6, 0x56, 0x03, 0x59, 0x03, 0xC3, 0x06, 0xB6, 0xDA, 0x68, 0xDF, 0x54,
+    0xD5, 0x2A, 0xEF, 0x24, 0xF3, 0x53, 0x24, 0xD8, 0x7C, 0x88, 0x8F, 0x03, 0xB1, 0x6F, 0x51, 0xEF,
+    0xC3, 0xB8, 0xBE, 0xD4, 0x59, 0x1B, 0x30, 0x88, 0x2E, 0xFD, 0x18, 0x79, 0xE2, 0x5A, 0xDC, 0x10,
+    0xAF, 0xEE, 0x3D, 0xFE, 0xC5, 0x3B, 0xC9, 0xCA, 0xEB, 0x4B, 0x9D, 0x36, 0xFF, 0x04, 0x3E, 0x83,
+    0x78, 0xAD, 0x58, 0xA3, 0x68, 0x5E, 0x0F, 0xF5, 0x0E, 0xAF, 0x40, 0x07, 0x7E, 0xE2, 0x62, 0x52,
+    0xF9, 0xBB, 0xD0, 0x91, 0xF7, 0x13, 0xB1, 0x14, 0x39, 0xD7, 0x94, 0x7D, 0x07, 0xF6, 0xAF, 0x60,
+    0x64, 0x82, 0x6D, 0x06, 0xF2, 0x41, 0xEC, 0xDC, 0x51, 0xF6, 0x9F, 0x26, 0x0F, 0x5B, 0x3B, 0x04,
+    0x91, 0x6A, 0xF0, 0xF0, 0xD5, 0xCE, 0x3F, 0xDD, 0x7D, 0x3D, 0x90, 0xDD, 0xD6, 0x95, 0xE6, 0xC5,
+    0x83, 0xC8, 0xE7, 0x15, 0x6A, 0x17, 0x0A, 0x2C, 0xEF, 0x58, 0xDC, 0x19, 0x38, 0x98, 0xC0, 0xE3,
+    0x59, 0x0B, 0xC9, 0x06, 0x53, 0x35, 0x62, 0x03, 0x32, 0xB7, 0x4A, 0x81, 0x02, 0x73, 0x6A, 0xDD,
+    0x76, 0xA0, 0x40, 0x0E, 0x1C, 0xB8, 0x3C, 0xE5, 0xED, 0xC4, 0x81, 0xB6, 0xAA, 0x29, 0x40, 0xF6,
+    0xD6, 0x2A, 0x98, 0x60, 0xB9, 0x55, 0xD6, 0x6E, 0xD5, 0x4E, 0x20, 0x05, 0xDA, 0x2A, 0x4F, 0x3B,
+    0xA0, 0x03, 0x07, 0x9C, 0xDA, 0x16, 0x01, 0x49, 0x81, 0x03, 0x07, 0x82, 0xED, 0x52, 0x4D, 0xD5,
+    0x3A, 0x18, 0x8C, 0x4D, 0x8D, 0x6B, 0x38, 0x01, 0xE1, 0xF1, 0xA3, 0x0D, 0x52, 0x00, 0xEE, 0x9E,
+    0xEF, 0x3B, 0x17, 0xC0, 0x7B, 0xDD, 0x8F, 0x54, 0x53, 0xA2, 0x28, 0xCA, 0x94, 0xFA, 0x9C, 0xDB,
+    0xAF, 0xF1, 0x80, 0xFB, 0x73, 0xEE, 0xB9, 0xE7, 0x1F, 0xC6, 0xF0, 0x5F, 0xB2, 0x02, 0x0C, 0x3B,
+    0x40, 0x7F, 0xE0, 0x47, 0x45, 0x0A, 0x18, 0x95, 0x80, 0x5E, 0x6A, 0xDC, 0xBF, 0xC4, 0x5A, 0xDB,
+    0x3B, 0xE8, 0xD9, 0x77, 0xBE, 0xDC, 0x1B, 0x63, 0x2B, 0x73, 0x81, 0xF0, 0xEC, 0x1A, 0xFC, 0x24,
+    0xA1, 0x39, 0x02, 0xAF, 0x1D, 0xE4, 0x02, 0xAD, 0x95, 0x9B, 0xDA, 0x5B, 0x6C, 0x1F, 0xBF, 0x66,
+    0x13, 0x86, 0xF9, 0x0C, 0xA3, 0xD4, 0xD8, 0xB7, 0x77, 0xB3, 0x14, 0x4F, 0xB7, 0x0E, 0x9E, 0xCE,
+    0x1F, 0x46, 0xC7, 0x9B, 0x44, 0x6E, 0x19, 0x35, 0x19, 0x21, 0xDA, 0xA7, 0xF3, 0xC7, 0xA6, 0x3E,
+    0x3F, 0x98, 0x3D, 0xCF, 0x00, 0x2B, 0x33, 0xA2, 0x97, 0xEC, 0x3B, 0x7B, 0xE8, 0x8E, 0xAD, 0x96,
+    0x95, 0xD9, 0x17, 0xE4, 0xD7, 0x23, 0xFA, 0xBA, 0x20, 0xEF, 0xE2, 0x74, 0xEF, 0x19, 0x9D, 0x22,
+    0xFA, 0x67, 0xDB, 0x1A, 0xF6, 0xCD, 0xCA, 0x88, 0xED, 0xCD, 0x67, 0xF0, 0x67, 0xF9, 0xB1, 0x0D,
+    0x51, 0xA6, 0x08, 0x0B, 0x7C, 0x3B, 0xE4, 0x2E, 0x29, 0x6A, 0x41, 0xF5, 0x42, 0x86, 0x28, 0x1D,
+    0x0C, 0x2D, 0x67, 0x2C, 0xBC, 0x2A, 0xB7, 0x3E, 0xFD, 0x37, 0x98, 0x62, 0x99, 0x2F, 0x13, 0x83,
+    0x4C, 0x30, 0xBD, 0x06, 0x34, 0xE2, 0xAD, 0xD6, 0xE7, 0x17, 0x1D, 0x68, 0x08, 0x02, 0xBB, 0xFB,
+    0x4C, 0xE3, 0x5B, 0xB3, 0x00, 0xF0, 0x26, 0x60, 0x5E, 0x01, 0x30, 0x1F, 0x18, 0x2C, 0xAD, 0x4C,
+    0x7F, 0x61, 0x07, 0x3E, 0x72, 0x7C, 0xBA, 0x57, 0xC8, 0xA7, 0x91, 0xB5, 0x2B, 0x19, 0x46, 0xD4,
+    0xCB, 0x75, 0xCB, 0x21, 0xE8, 0x8D, 0xDF, 0x0B, 0x49, 0x2F, 0xBA, 0xB8, 0x35, 0xDE, 0x45, 0x92,
+    0x38, 0x01, 0xC6, 0x6B, 0x32, 0xB6, 0xA4, 0xB7, 0x0E, 0x34, 0xE3, 0x1F, 0xF4, 0x3A, 0x4C, 0x69,
+    0xDC, 0x8D, 0x7B, 0x22, 0x90, 0xE7, 0xFC, 0x6B, 0x5F, 0x9E, 0x70, 0x01, 0x13, 0xDC, 0x99, 0x18,
+    0x0F, 0x3A, 0x6D, 0xD1, 0x91, 0x53, 0xE7, 0x5D, 0x0F, 0x62, 0x7B, 0xD1, 0x2C, 0xAC, 0xED, 0x4C,
+    0xB8, 0x5A, 0x5A, 0x13, 0x57, 0x9E, 0xC5, 0x4C, 0x11, 0xF4, 0x26, 0xAB, 0xCC, 0x79, 0x77, 0xE7,
+    0x81, 0xD7, 0xCA, 0x5C, 0x87, 0x58, 0x30, 0x1F, 0x0F, 0x97, 0x2E, 0x74, 0x18, 0x97, 0x65, 0x97,
+    0x72, 0x34, 0x31, 0xC7, 0xB6, 0x8C, 0x65, 0xA0, 0x65, 0x21, 0x1F, 0x96, 0x16, 0xA0, 0xC8, 0x65,
+    0x57, 0x66, 0xF5, 0x62, 0x90, 0x1B, 0x14, 0x2D, 0x9E, 0xE6, 0x3A, 0x20, 0x8F, 0x95, 0xFF, 0x03,
+    0x9B, 0xFB, 0x36, 0x95, 0xB1, 0xDF, 0xED, 0xFF, 0x32, 0xA3, 0x05, 0xEF, 0xF0, 0x69, 0xF3, 0x4A,
+    0x71, 0xAE, 0xB3, 0x4F, 0x75, 0x02, 0xFF, 0xC4, 0x7B, 0x65, 0x5C, 0xD8, 0x7B, 0x73, 0x73, 0x19,
+    0x6F, 0x15, 0x92, 0xD6, 0x5B, 0x9D, 0xE5, 0x0F, 0xE5, 0xA7, 0xD1, 0x1F, 0x21, 0x66, 0x4F, 0x26,
+    0xF1, 0x8C, 0x4C, 0x71, 0x21, 0x94, 0x5B, 0xC8, 0xF6, 0xF1, 0x2C, 0xF7, 0xBE, 0x62, 0xAC, 0x42,
+    0xF0, 0xCE, 0x57, 0x38, 0xCF, 0xCB, 0x0A, 0x4B, 0xAB, 0x38, 0x5D, 0xC7, 0xE5, 0x76, 0x1C, 0x08,
+    0x96, 0xC5, 0x56, 0x2C, 0x9F, 0x00, 0xFF, 0x35, 0xF6, 0x3A, 0xFE, 0x2E, 0x74, 0x45, 0x2C, 0xC4,
+    0x13, 0x62, 0xC6, 0x22, 0x87, 0x65, 0xFF, 0xC4, 0xA9, 0xE2, 0xC4, 0x28, 0xCE, 0x0C, 0xFF, 0xBE,
+    0xC0, 0x34, 0xC9, 0xF5, 0xD2, 0x37, 0xC1, 0xC9, 0x4A, 0x68, 0xC1, 0xB7, 0xFF, 0xD3, 0xD6, 0xA0,
+    0x65, 0x32, 0x8A, 0x0A, 0x84, 0x7E, 0xD5, 0x9C, 0x9A, 0x19, 0xD9, 0xD3, 0x16, 0x04, 0x24, 0x8D,
+    0x2F, 0xB2, 0xE1, 0x09, 0x48, 0x3A, 0xC7, 0x1A, 0x48, 0xBA, 0xE3, 0xEE, 0x3E, 0x79, 0xA3, 0x1D,
+    0xF7, 0x30, 0x89, 0x4A, 0x1B, 0xAD, 0xFB, 0x53, 0x64, 0xDD, 0xC5, 0x98, 0x27, 0x36, 0x30, 0xB7,
+    0xFA, 0x75, 0x70, 0x9A, 0xDB, 0x35, 0xCA, 0x23, 0x17, 0xCB, 0xF0, 0xD8, 0xD5, 0x9B, 0x7B, 0x83,
+    0x1B, 0x85, 0x8C, 0x51, 0x47, 0x31, 0xA4, 0x23, 0x27, 0x9C, 0xB1, 0xB2, 0xC4, 0x91, 0x27, 0x8E,
+    0xDC, 0x70, 0xC2, 0x13, 0x5B, 0x1C, 0x19, 0xE2, 0x1A, 0xD6, 0xB9, 0x72, 0xAC, 0x71, 0xE4, 0x8D,
+    0x64, 0x8E, 0xA5, 0x5E, 0xC7, 0x4B, 0x1D, 0xD3, 0x23, 0x6E, 0xCC, 0xC4, 0x0B, 0xDF, 0x1B, 0xD7,
+    0xC4, 0x09, 0xB9, 0x78, 0xEE, 0x30, 0x6E, 0xFC, 0xF0, 0xF7, 0x94, 0x15, 0xB4, 0xBA, 0x50, 0xB5,
+    0xF6, 0x82, 0x07, 0xD1, 0x82, 0xEB, 0x63, 0xFC, 0xDA, 0x1C, 0xFD, 0x27, 0x5F, 0x7F, 0x4A, 0x4F,
+    0xA6, 0xA7, 0x78, 0x34, 0xD5, 0xC6, 0x71, 0xF0, 0x42, 0x1F, 0xD9, 0x11, 0xF9, 0xDA, 0x81, 0x40,
+    0xFB, 0x1D, 0x73, 0x38, 0xD5, 0x05, 0xDE, 0xFF, 0x27, 0xBA, 0xF4, 0xFF, 0xDC, 0xBB, 0xB1, 0x12,
+    0xBD, 0x4B, 0x92, 0xB6, 0x3F, 0x75, 0x03, 0xB6, 0x3A, 0xCE, 0x62, 0x45, 0x94, 0xE8, 0x3D, 0xA3,
+    0x81, 0x08, 0xBC, 0x1E, 0x73, 0xCC, 0x85, 0xAF, 0x16, 0xF2, 0x48, 0x76, 0x62, 0xE5, 0x06, 0x86,
+    0xF3, 0x2A, 0x0D, 0xEC, 0x74, 0x9C, 0x2E, 0x95, 0xE9, 0x7A, 0x7C, 0x00, 0xD8, 0x12, 0x51, 0xD8,
+    0x10, 0x2D, 0x74, 0xE8, 0x38, 0x45, 0xE7, 0x83, 0xA1, 0x15, 0xD6, 0x56, 0x09, 0x07, 0x00, 0x12,
+    0x3E, 0x62, 0xB2, 0x8E, 0x9C, 0x5C, 0x68, 0xEE, 0x38, 0x2A, 0x88, 0x16, 0xB6, 0x55, 0xDE, 0x41,
+    0x14, 0x65, 0x44, 0x17, 0xF4, 0x92, 0x96, 0xC8, 0xAF, 0x89, 0xC2, 0x9C, 0x28, 0xD3, 0xAF, 0x77,
+    0x8A, 0x1A, 0x45, 0xA5, 0xA2, 0xF4, 0xF8, 0x83, 0x30, 0x54, 0x99, 0x83, 0x62, 0xA3, 0x67, 0xAE,
+    0xBB, 0x8B, 0x66, 0xD1, 0x60, 0x38, 0xBE, 0xCC, 0x91, 0xB0, 0x72, 0x32, 0x66, 0x4E, 0x5B, 0x61,
+    0x2F, 0x9A, 0xCD, 0x03, 0x4F, 0xBE, 0xD6, 0x2B, 0x0C, 0xF1, 0xB0, 0x0A, 0x6C, 0x3B, 0xCA, 0xF1,
+    0xE0, 0x98, 0x53, 0xB8, 0x63, 0x70, 0x0A, 0x5F, 0xE0, 0x23, 0x3B, 0x9C, 0x27, 0x38, 0x31, 0xC3,
+    0x01, 0xF7, 0x0F, 0xAC, 0x5F, 0xE1, 0x3C, 0xFB, 0x2B, 0x99, 0xBD, 0x85, 0x7D, 0x8B, 0x6B, 0xC5,
+    0x79, 0x2D, 0x28, 0x7D, 0xE9, 0x6E, 0x56, 0x3A, 0x0A, 0xB9, 0x47, 0x97, 0x9C, 0x5F, 0x2E, 0xFF,
+    0x4E, 0x51, 0x92, 0x6C, 0xD2, 0xF1, 0x38, 0x31, 0x51, 0x3B, 0x49, 0x69, 0x32, 0xDB, 0xC2, 0x64,
+    0x73, 0xE5, 0xB7, 0x39, 0x66, 0x5B, 0x16, 0x12, 0xC3, 0x16, 0x8A, 0xFD, 0x88, 0xD0, 0x52, 0x7A,
+    0x9A, 0x29, 0x33, 0x63, 0xCF, 0xAC, 0xCA, 0x51, 0x31, 0xE9, 0xD5, 0x04, 0x2A, 0x45, 0xF8, 0xCD,
+    0x06, 0xD2, 0x6D, 0xB2, 0xA8, 0xD6, 0x27, 0x3C, 0x54, 0xDA, 0x8A, 0xF4, 0x7B, 0xF1, 0xE0, 0x76,
+    0x8F, 0x52, 0xA1, 0xD2, 0xE7, 0x2D, 0x25, 0xCA, 0x15, 0xA9, 0xDE, 0x6B, 0xB8, 0xA8, 0x7E, 0xCD,
+    0xCD, 0xED, 0x57, 0x38, 0x17, 0x84, 0x59, 0x93, 0xD5, 0x85, 0x79, 0x84, 0x29, 0x8E, 0x52, 0x95,
+    0x6B, 0x64, 0x55, 0x9C, 0x88, 0xA8, 0x52, 0x01, 0xEE, 0xD6, 0xEF, 0x7E, 0x05, 0x77, 0x6B, 0x79,
+    0x90, 0x2C, 0x54, 0x46, 0x42, 0xF7, 0xE4, 0x6E, 0xCB, 0x9A, 0x03, 0x03, 0xCD, 0x17, 0x9D, 0xE1,
+    0xF6, 0xB0, 0xA5, 0x8C, 0x4D, 0xA6, 0xBC, 0x4C, 0x46, 0xAE, 0x66, 0xF1, 0xCD, 0x77, 0x9E, 0x51,
+    0x26, 0xAA, 0xF0, 0xF2, 0x1A, 0xFC, 0xFA, 0x56, 0xB9, 0x91, 0x07, 0x93, 0x25, 0x57, 0xB7, 0x55,
+    0xC6, 0x6F, 0x85, 0x94, 0x54, 0x03, 0xAB, 0x7B, 0x94, 0xBC, 0x60, 0xAD, 0xAD, 0x30, 0x18, 0x78,
+    0xA5, 0x0C, 0xC9, 0xBE, 0x5D, 0xE8, 0xD3, 0x2B, 0xC0, 0x9B, 0xBC, 0xD9, 0xAB, 0xCA, 0x02, 0x73,
+    0xA1, 0xBA, 0x5D, 0xA5, 0x86, 0x84, 0x3B, 0x30, 0xC2, 0x89, 0x03, 0xC9, 0x6E, 0x86, 0xFA, 0x39,
+    0x61, 0x82, 0x05, 0xFC, 0xDF, 0xF2, 0x2D, 0x9F, 0xBD, 0xF2, 0xED, 0x81, 0x6D, 0xE6, 0xBF, 0x06,
+    0x1B, 0xA7, 0x7C, 0x7A, 0x04, 0x2E, 0xF9, 0x79, 0x88, 0x46, 0x9A, 0x75, 0x5C, 0xFA, 0x1A, 0x7D,
+    0xB8, 0xF9, 0x11, 0xCA, 0x89, 0xEE, 0xD8, 0x27, 0xF9, 0xE1, 0xF0, 0xDF, 0xC5, 0x24, 0xCB, 0x2E,
+    0x04, 0xAD, 0x1C, 0x41, 0xE5, 0x3A, 0x5A, 0x6E, 0xA0, 0xC0, 0xA1, 0x9C, 0x28, 0x74, 0x28, 0x25,
+    0x8A, 0xCC, 0x3A, 0xDA, 0x51, 0x74, 0x56, 0xD1, 0xA1, 0xA2, 0x96, 0xC8, 0x6B, 0x88, 0x84, 0x9A,
+    0x40, 0x5B, 0xBA, 0x31, 0x26, 0x94, 0x83, 0xB7, 0x9A, 0x2B, 0x24, 0x6E, 0x7C, 0x0D, 0xE4, 0x49,
+    0x14, 0x81, 0x72, 0xE4, 0x61, 0xE6, 0x87, 0x8A, 0x1E, 0x50, 0xC5, 0x26, 0xB1, 0xFF, 0x20, 0xB4,
+    0x9F, 0xC8, 0x29, 0x83, 0x46, 0x97, 0xD9, 0x7A, 0x09, 0x52, 0x48, 0x03, 0xC8, 0x61, 0xA0, 0x8C,
+    0x40, 0x46, 0x1F, 0xA7, 0xF8, 0x10, 0x53, 0x57, 0x42, 0x5A, 0xE6, 0xCE, 0x97, 0xC6, 0x6B, 0xD8,
+    0xB6, 0xC2, 0x94, 0x3D, 0x6E, 0xF5, 0x0B, 0x4B, 0xAB, 0xFC, 0x20, 0x59, 0xDA, 0x90, 0x1C, 0xA1,
+    0xB8, 0x6E, 0x2F, 0x35, 0xE3, 0x91, 0x8E, 0x6B, 0x16, 0xF6, 0xBA, 0x2D, 0x3A, 0x2E, 0xF9, 0x53,
+    0x96, 0x9B, 0x38, 0xB0, 0x4B, 0x8B, 0xCD, 0x22, 0x14, 0x2D, 0x5F, 0x27, 0xA3, 0x11, 0x0E, 0xBD,
+    0xA0, 0x44, 0x01, 0xC9, 0x9C, 0x7A, 0x11, 0x9E, 0x25, 0x2C, 0xC9, 0xE3, 0xFE, 0xE1, 0x66, 0x40,
+    0x37, 0x64, 0x3F, 0xA0, 0x9F, 0xEC, 0xAD, 0x1D, 0x44, 0x4E, 0x6C, 0x7D, 0xBB, 0xB2, 0x57, 0x3D,
+    0x48, 0xF5, 0x45, 0x3B, 0xEA, 0x19, 0x15, 0xF4, 0x0C, 0x11, 0x60, 0x56, 0xC2, 0x5C, 0x0B, 0x39,
+    0x2E, 0x21, 0x96, 0xCB, 0x5E, 0x95, 0x99, 0xA8, 0x1F, 0x4E, 0x9D, 0x60, 0x51, 0xBA, 0xF3, 0x11,
+    0xBA, 0xF4, 0xC3, 0x97, 0xC0, 0xF5, 0x71, 0x78, 0x84, 0xDC, 0xDD, 0x0B, 0x3D, 0x92, 0xEB, 0x59,
+    0xE1, 0xF8, 0x34, 0xC0, 0x15, 0x00, 0x32, 0x4C, 0x8B, 0x5B, 0x15, 0xB5, 0xF4, 0x29, 0xC6, 0x83,
+    0x4E, 0xAB, 0x8C, 0x77, 0xFE, 0x63, 0x77, 0x92, 0xE2, 0x28, 0x05, 0x73, 0x0F, 0x1A, 0x0A, 0x3F,
+    0x61, 0x8B, 0x23, 0x15, 0xA7, 0x29, 0xA7, 0xB2, 0xB0, 0xD5, 0x51, 0x49, 0xE8, 0xE3, 0x32, 0xBE,
+    0x8F, 0x8B, 0xC4, 0xE6, 0x29, 0x47, 0xF1, 0x26, 0x96, 0xF7, 0x65, 0xF4, 0x73, 0x59, 0x79, 0xE4,
+    0x67, 0x9B, 0xA8, 0xDC, 0x82, 0x82, 0x6D, 0x28, 0xDC, 0x44, 0xF9, 0x3A, 0x8A, 0x53, 0xA2, 0x84,
+    0x6C, 0x4D, 0xF4, 0x1B, 0x9E, 0x9C, 0x96, 0x88, 0x13, 0x25, 0xA8, 0x23, 0xFD, 0x4B, 0x57, 0xE5,
+    0x94, 0x85, 0x5A, 0x0C, 0x74, 0x6A, 0x64, 0x64, 0x32, 0xC8, 0xC8, 0xF6, 0x09, 0xB4, 0xB4, 0xD8,
+    0xF6, 0x9E, 0xA5, 0x11, 0x22, 0xA7, 0x64, 0x84, 0x03, 0xFE, 0x5D, 0xF9, 0xF9, 0xBF, 0xF2, 0x73,
+    0x4B, 0xEE, 0xF0, 0x3B, 0xC1, 0x37, 0x6D, 0xE9, 0xFD, 0x46, 0x70, 0x6B, 0xEB, 0xC5, 0x2F, 0x81,
+    0x8B, 0xC6, 0xFF, 0x19, 0x70, 0xD6, 0x2C, 0xDF, 0x04, 0x4E, 0xDA, 0xE0, 0x3B, 0xC0, 0x71, 0x17,
+    0x9E, 0x03, 0x8E, 0xBA, 0x08, 0xAB, 0xDC, 0x86, 0xC3, 0x0E, 0x71, 0x60, 0x9F, 0x20, 0x5E, 0xDA,
+    0x43, 0x62, 0x1F, 0x3B, 0x5E, 0xF0, 0xC2, 0x36, 0xC4, 0x66, 0xC2, 0xB5, 0xE2, 0x02, 0xAA, 0x9D,
+    0x27, 0xC4, 0x23, 0xEC, 0x22, 0x07, 0x8B, 0x4B, 0x0B, 0xF4, 0xB7, 0x8A, 0x85, 0x42, 0x44, 0x14,
+    0x6C, 0x55, 0x0E, 0xE8, 0x80, 0x40, 0xBE, 0x85, 0xA3, 0xA3, 0xE6, 0xAE, 0xD0, 0x4B, 0xBB, 0x05,
+    0x10, 0x8E, 0x48, 0x9C, 0xBA, 0x07, 0x45, 0xF3, 0x7E, 0xEE, 0x42, 0x04, 0x0A, 0x91, 0x2D, 0x51,
+    0x4C, 0x3D, 0x0B, 0xC9, 0xE9, 0x9D, 0x00, 0x2F, 0x4A, 0x97, 0x9A, 0x32, 0x54, 0x82, 0xC0, 0x01,
+    0x2C, 0x22, 0x63, 0x3F, 0x8A, 0x12, 0x59, 0x13, 0x53, 0x53, 0x87, 0xC0, 0x94, 0xB4, 0x50, 0x15,
+    0xE3, 0x2E, 0x53, 0x28, 0xA4, 0x1D, 0x6D, 0x83, 0xFC, 0xAB, 0x5E, 0xA9, 0xDF, 0xD2, 0x3B, 0xE0,
+    0x6E, 0x49, 0xC3, 0x03, 0xA0, 0xF2, 0x1D, 0x3D, 0x50, 0x72, 0x49, 0x06, 0x30, 0x03, 0xB5, 0xA4,
+    0x98, 0x53, 0xE9, 0xA4, 0x81, 0x3A, 0x24, 0x12, 0xC2, 0x6E, 0xF1, 0xD1, 0x8B, 0xAF, 0xB2, 0x90,
+    0x10, 0x5F, 0xD7, 0x04, 0x6B, 0x48, 0x79, 0xAF, 0xEA, 0xD1, 0x2B, 0xA7, 0xB9, 0xFD, 0x47, 0x9D,
+    0x43, 0x88, 0x94, 0x32, 0x75, 0xC3, 0x51, 0xE9, 0x0C, 0xB4, 0xB3, 0x4D, 0x5E, 0x8B, 0x46, 0x79,
+    0xCD, 0xA8, 0xC6, 0x4B, 0xF9, 0xE8, 0xBD, 0x0F, 0xE0, 0xF1, 0xF4, 0x48, 0xB8, 0x96, 0xC9, 0xBC,
+    0xA2, 0xEF, 0xC3, 0x0A, 0x76, 0x3B, 0x70, 0xF7, 0x56, 0x30, 0x1E, 0xFE, 0x15, 0x61, 0x9D, 0xBC,
+    0x54, 0xDC, 0x78, 0xB6, 0xDE, 0x91, 0x5B, 0xF9, 0xF5, 0x59, 0xC2, 0x27, 0x08, 0x3F, 0x2B, 0x10,
+    0x2A, 0x3B, 0x1F, 0x71, 0x8F, 0x21, 0xCE, 0x75, 0x74, 0xA9, 0x74, 0xF0, 0xC1, 0x54, 0xCF, 0x64,
+    0xAA, 0x76, 0x77, 0x9D, 0xBD, 0x50, 0x35, 0x97, 0x4F, 0x71, 0xD1, 0xA7, 0x95, 0x3D, 0x55, 0x90,
+    0xB2, 0xD4, 0x0A, 0x02, 0xD9, 0xFB, 0x1D, 0xF9, 0x6F, 0x05, 0x51, 0x5A, 0xE8, 0xA5, 0xC7, 0x6A,
+    0x50, 0x17, 0x90, 0x2E, 0x83, 0xAE, 0x72, 0x19, 0xBB, 0xA5, 0x0C, 0xB2, 0x8E, 0xBD, 0x23, 0x58,
+    0x3E, 0x1F, 0xAF, 0x1B, 0xBF, 0x37, 0xDE, 0x67, 0xBC, 0xEF, 0xF8, 0x1C, 0x95, 0x42, 0x65, 0xBC,
+    0xA7, 0x5D, 0x3F, 0x26, 0xAB, 0xCA, 0x69, 0x7B, 0x63, 0xA3, 0xDF, 0x8F, 0x1D, 0x1C, 0x28, 0x0D,
+    0x7A, 0x38, 0x4C, 0xAD, 0x48, 0x58, 0xBD, 0x4C, 0xD5, 0xCA, 0xC4, 0x15, 0xA7, 0x15, 0xE7, 0x9D,
+    0x3C, 0x6C, 0x47, 0x29, 0x88, 0x34, 0x64, 0x31, 0xB3, 0xB2, 0x9D, 0x5E, 0xAC, 0xCC, 0x34, 0xAB,
+    0x6E, 0x5A, 0x71, 0xD0, 0x9B, 0x91, 0xD8, 0x70, 0x08, 0xB8, 0x03, 0x81, 0x53, 0x36, 0x90, 0xC0,
+    0x17, 0x0D, 0x57, 0x78, 0x59, 0xD1, 0x72, 0x1B, 0xE6, 0xBC, 0x34, 0x51, 0xC5, 0xED, 0x90, 0x3A,
+    0xA6, 0xA7, 0x47, 0xF9, 0x52, 0x0F, 0x76, 0xD9, 0x0A, 0x31, 0xA5, 0x6A, 0xE1, 0xD3, 0xF6, 0x81,
+    0x55, 0x8B, 0x1B, 0x27, 0xF6, 0x97, 0x93, 0x5A, 0x3C, 0x9B, 0x54, 0xD4, 0xF7, 0x02, 0x8D, 0x83,
+    0x14, 0xA6, 0xC8, 0xDF, 0x40, 0x54, 0x70, 0xC0, 0x8F, 0x1C, 0xC2, 0xF8, 0x69, 0x19, 0xCE, 0xC1,
+    0xFD, 0x4F, 0x8E, 0xC0, 0x91, 0x89, 0x2A, 0x5A, 0x4F, 0x6D, 0xEB, 0x59, 0x35, 0x70, 0x59, 0x6E,
+    0x06, 0x4B, 0x0D, 0x7A, 0xF7, 0x7C, 0xA2, 0xDA, 0xF9, 0x09, 0x50, 0xA6, 0x0E, 0x25, 0x1D, 0x91,
+    0x63, 0x98, 0x7B, 0xD6, 0xBE, 0xBC, 0xD1, 0xA2, 0xD0, 0xD2, 0x98, 0x62, 0x35, 0x9A, 0xE2, 0x66,
+    0x4F, 0xC4, 0xC7, 0xA0, 0xE5, 0x89, 0xE6, 0x53, 0xBC, 0xB3, 0x2B, 0xAD, 0xC4, 0xBA, 0x7F, 0xE5,
+    0x46, 0xEB, 0xF7, 0x74, 0xBC, 0x37, 0xD2, 0x6D, 0xE3, 0x1D, 0x8F, 0xA0, 0x6C, 0x6A, 0x85, 0x53,
+    0x2B, 0x98, 0x5A, 0xCB, 0xA9, 0xE5, 0x6F, 0x69, 0x19, 0x38, 0xC5, 0x06, 0xE5, 0x7D, 0x02, 0xFF,
+    0x17, 0xEE, 0x7A, 0x01, 0x14, 0x6A, 0xF6, 0xD7, 0xE0, 0xD7, 0x09, 0xCD, 0x26, 0x04, 0xAF, 0x5A,
+    0xD0, 0x6E, 0xB3, 0xB0, 0xFF, 0x4F, 0xA6, 0x59, 0x3E, 0x4F, 0xB8, 0x0F, 0x22, 0x08, 0x9C, 0x79,
+    0xD8, 0x13, 0x0E, 0xC7, 0x60, 0x3F, 0x5F, 0x43, 0xA1, 0xFF, 0x6D, 0xF9, 0x2E, 0xAD, 0xEE, 0x80,
+    0x57, 0x29, 0x4F, 0x0B, 0x18, 0x88, 0x33, 0xE8, 0x84, 0xB0, 0x19, 0x38, 0x81, 0xDF, 0xD9, 0xB5,
+    0x4F, 0x86, 0xA5, 0x83, 0x8A, 0x2D, 0x05, 0x67, 0x88, 0x0C, 0xFA, 0xF7, 0xA8, 0x53, 0x1C, 0x0C,
+    0xA3, 0x58, 0xB4, 0x89, 0x7D, 0xFB, 0xE4, 0xD6, 0xCF, 0xC7, 0xEB, 0xDD, 0xF7, 0x45, 0x8C, 0x58,
+    0xE8, 0xF1, 0x5B, 0x69, 0x7F, 0x6F, 0x62, 0x1A, 0xD9, 0x6F, 0x1D, 0x05, 0x8F, 0xBC, 0x93, 0x8A,
+    0x17, 0x64, 0xFD, 0xCE, 0x2A, 0xB0, 0x21, 0xDC, 0x04, 0x77, 0x2F, 0xDC, 0xAC, 0x1B, 0xA3, 0x46,
+    0x29, 0xE5, 0x22, 0x78, 0x82, 0x1C, 0x1B, 0x50, 0xC8, 0xE1, 0xDF, 0x28, 0x85, 0x6C, 0xB2, 0x3A,
+    0x01, 0x2F, 0x3A, 0x9D, 0xAE, 0xC9, 0x1D, 0x91, 0x03, 0xA7, 0x76, 0xF7, 0xA0, 0x9B, 0xCB, 0x11,
+    0xF3, 0xF0, 0x01, 0xFC, 0x39, 0x6A, 0x04, 0x8C, 0xA6, 0x4B, 0xE2, 0xEE, 0x14, 0x65, 0x54, 0xF0,
+    0x9F, 0x42, 0xD6, 0xAE, 0x2E, 0x60, 0xA6, 0xC9, 0x44, 0x6A, 0x57, 0x57, 0xD9, 0x69, 0x3A, 0x6C,
+    0x26, 0x5F, 0x9D, 0x33, 0x9B, 0xA4, 0x0B, 0x50, 0x1B, 0x1A, 0x31, 0x74, 0x6C, 0x55, 0xE4, 0x74,
+    0x9C, 0x6A, 0xD8, 0xC2, 0x60, 0x7A, 0x6A, 0xF2, 0xCE, 0xB8, 0x86, 0x09, 0xC7, 0xB1, 0x5F, 0xE0,
+    0x4A, 0x74, 0x93, 0xE7, 0x2A, 0x84, 0x25, 0x36, 0x32, 0xF5, 0x42, 0xD9, 0x6B, 0xE0, 0x97, 0x68,
+    0x90, 0x7F, 0xA2, 0x71, 0x6B, 0x6C, 0x54, 0xD9, 0xD4, 0x70, 0x17, 0xCF, 0x5F, 0x9F, 0x6E, 0x38,
+    0x3D, 0x62, 0x7A, 0xE8, 0xD4, 0x0D, 0xED, 0x98, 0x76, 0x35, 0xE4, 0xC1, 0x8B, 0xED, 0x48, 0x1E,
+    0x94, 0x9E, 0xA6, 0x44, 0x6F, 0x9C, 0x28, 0x6D, 0xCC, 0x33, 0x98, 0xE3, 0x25, 0x0D, 0x43, 0xF1,
+    0x00, 0x5F, 0x57, 0x46, 0x75, 0x46, 0x95, 0x19, 0x4B, 0x55, 0xE6, 0x18, 0x74, 0x2B, 0x5A, 0xF0,
+    0xCA, 0xB8, 0x07, 0x5C, 0x72, 0x3F, 0x78, 0x56, 0xFD, 0x95, 0x50, 0xA8, 0x44, 0x3C, 0x12, 0x18,
+    0x0E, 0xBC, 0xA6, 0x53, 0xC5, 0x79, 0xFA, 0x96, 0xC7, 0x3B, 0x2C, 0x79, 0x18, 0x25, 0x38, 0x80,
+    0xBB, 0xE4, 0x2A, 0xD4, 0xA3, 0x59, 0x42, 0x0D, 0x20, 0x38, 0x46, 0xD0, 0x0A, 0xA2, 0x46, 0x76,
+    0x60, 0x48, 0xCD, 0xE0, 0x7C, 0x40, 0xEB, 0x8D, 0x80, 0x53, 0x7B, 0xD8, 0x9B, 0xB2, 0x34, 0xD1,
+    0xF0, 0xCC, 0x00, 0xBD, 0x61, 0x90, 0xC9, 0x10, 0x40, 0xCA, 0xB2, 0xB5, 0xEC, 0xDC, 0xA2, 0x11,
+    0x45, 0x38, 0xBB, 0x99, 0x61, 0x75, 0x7F, 0x03, 0x39, 0xE6, 0xDB, 0x32, 0x1F, 0xCE, 0xE5, 0xE0,
+    0x81, 0x21, 0xFC, 0x65, 0x89, 0x25, 0x2F, 0xB1, 0x05, 0x4A, 0xB0, 0x05, 0x8C, 0x41, 0x84, 0xA8,
+    0xE1, 0xBB, 0x86, 0xF2, 0x89, 0xC8, 0x0D, 0xF2, 0xEF, 0xEC, 0x52, 0x88, 0x62, 0x3F, 0x93, 0x9E,
+    0x5D, 0xE8, 0xE5, 0x30, 0x2E, 0xE0, 0xB1, 0x92, 0x85, 0x2B, 0x2A, 0x01, 0x59, 0x4D, 0xA6, 0x27,
+    0x20, 0x51, 0x90, 0x39, 0x90, 0x35, 0x89, 0x80, 0x3A, 0xC6, 0x75, 0x11, 0xBE, 0x11, 0x74, 0x0B,
+    0x10, 0xD2, 0xA5, 0x1E, 0x7C, 0x0B, 0x3B, 0xEC, 0x4B, 0x64, 0x60, 0xFF, 0x44, 0x2E, 0x26, 0x73,
+    0xF0, 0x82, 0x6D, 0x16, 0x70, 0xEB, 0x09, 0x88, 0x27, 0x90, 0xC8, 0x67, 0x4F, 0x16, 0xE8, 0x5A,
+    0x4F, 0xB6, 0x95, 0x8F, 0x97, 0x84, 0xDD, 0x11, 0x40, 0x97, 0x22, 0x6E, 0x55, 0x93, 0x37, 0x92,
+    0x35, 0xD2, 0x40, 0x0D, 0xE1, 0x2F, 0xC5, 0x25, 0x9B, 0xE0, 0x94, 0xDC, 0x2F, 0x35, 0x27, 0x01,
+    0x74, 0x7A, 0x66, 0x8E, 0xDF, 0xD2, 0xFD, 0xAC, 0xF3, 0x44, 0xAD, 0x9B, 0x1A, 0xC6, 0x8E, 0x8C,
+    0x71, 0x13, 0x9E, 0x5D, 0x83, 0x4F, 0x10, 0xEE, 0x13, 0x1E, 0x12, 0xB6, 0x84, 0x2B, 0x40, 0x0F,
+    0xF3, 0x03, 0x03, 0xA7, 0xC0, 0x65, 0x05, 0xA8, 0x46, 0x08, 0x07, 0x53, 0x98, 0x02, 0x55, 0x80,
+    0x6B, 0x69, 0xD9, 0xA4, 0x4C, 0x67, 0x9A, 0x09, 0x06, 0x6E, 0x97, 0xEE, 0x91, 0xA3, 0xCB, 0x82,
+    0x84, 0x5D, 0x20, 0x1A, 0x47, 0x43, 0xBB, 0xB4, 0x80, 0xAC, 0x96, 0x31, 0x14, 0x02, 0xF2, 0xE2,
+    0xD6, 0xF7, 0x55, 0x5F, 0x2C, 0xED, 0x3B, 0xBB, 0xBB, 0x29, 0x1D, 0x7A, 0xC5, 0x6C, 0x5C, 0x6B,
+    0xCC, 0x29, 0xB0, 0x92, 0x48, 0xB8, 0xC7, 0x93, 0x57, 0xA0, 0x55, 0x43, 0xB1, 0x25, 0x97, 0xE3,
+    0x3A, 0xFD, 0x77, 0x18, 0x28, 0xD3, 0x11, 0xFB, 0xC2, 0x4B, 0x6B, 0x58, 0xF5, 0x5F, 0x93, 0x85,
+    0x0D, 0x69, 0xC9, 0x10, 0x1A, 0xE6, 0x59, 0x66, 0xCB, 0x43, 0xFA, 0x12, 0xEC, 0xEB, 0xE8, 0xAA,
+    0xDF, 0xDA, 0xBF, 0x6B, 0xA9, 0x12, 0xF1, 0x86, 0xD0, 0xB9, 0x68, 0xDB, 0x4B, 0x56, 0x16, 0x86,
+    0x07, 0x18, 0xF1, 0xDE, 0x20, 0xF3, 0xAC, 0xA4, 0x5B, 0x15, 0x4C, 0x1E, 0x24, 0x2D, 0xA1, 0x32,
+    0x8A, 0xE0, 0xE1, 0xA0, 0xB6, 0x1C, 0x58, 0x0A, 0xE4, 0xFF, 0x4A, 0x1E, 0x6A, 0x3B, 0xAF, 0xA8,
+    0xD4, 0xBD, 0xD6, 0x9B, 0xE4, 0x5D, 0x58, 0x15, 0x8B, 0xA6, 0x00, 0xCD, 0xC9, 0x4D, 0x4F, 0xA9,
+    0x5F, 0x1B, 0x2C, 0x4A, 0x36, 0x28, 0x98, 0x03, 0xD7, 0x0E, 0x76, 0xD4, 0xF6, 0x21, 0xE1, 0x80,
+    0xFB, 0xF2, 0x33, 0x48, 0x1B, 0x84, 0x95, 0x5D, 0xB3, 0xD5, 0x19, 0x74, 0xE6, 0x51, 0x9C, 0x58,
+    0xAB, 0xC2, 0x36, 0x0A, 0x7D, 0x77, 0xE6, 0xA5, 0x3C, 0xF3, 0x60, 0x8D, 0x15, 0x18, 0x11, 0x66,
+    0x80, 0x5F, 0x20, 0x29, 0x3E, 0xFD, 0x73, 0xC0, 0xBD, 0xA7, 0x01, 0x3B, 0x5E, 0xD3, 0x10, 0x96,
+    0xC1, 0xDA, 0xB7, 0xE8, 0x2B, 0xC0, 0xDD, 0xA6, 0xFB, 0x83, 0x03, 0x79, 0xE6, 0x21, 0xCC, 0x44,
+    0x1E, 0xE5, 0x88, 0x11, 0x89, 0xA1, 0x87, 0xD5, 0x90, 0x06, 0x42, 0x3D, 0x7D, 0x2E, 0xBD, 0xBA,
+    0x69, 0xEC, 0xBB, 0x9F, 0x7D, 0x23, 0x34, 0x0A, 0xA1, 0xFC, 0x40, 0x3E, 0x48, 0x63, 0x50, 0x56,
+    0x7A, 0x01, 0xBB, 0xE1, 0xC9, 0x15, 0xE0, 0xB9, 0x1A, 0xF0, 0xD9, 0x86, 0x92, 0x04, 0x3F, 0xC1,
+    0xDA, 0x2E, 0xEC, 0x17, 0x07, 0xC0, 0xA7, 0x2C, 0xAF, 0xA1, 0x45, 0x2B, 0xE5, 0x9A, 0xA6, 0x34,
+    0xCC, 0xE4, 0xA2, 0x0C, 0xCA, 0x9D, 0x23, 0xD9, 0x8E, 0x56, 0x76, 0x70, 0x4E, 0xC3, 0x8D, 0x9A,
+    0x6F, 0x60, 0x10, 0xC3, 0x49, 0x10, 0x91, 0x20, 0x23, 0xEE, 0x0E, 0x85, 0xF1, 0x1A, 0x7C, 0xFC,
+    0x36, 0xBB, 0x8C, 0x7B, 0xCA, 0xEB, 0x00, 0x0B, 0xEE, 0x2C, 0xE9, 0x93, 0x4C, 0xB3, 0xAD, 0x03,
+    0x8C, 0xA5, 0x94, 0x69, 0xE5, 0x84, 0x2B, 0xDB, 0xF1, 0xED, 0x90, 0x59, 0x10, 0x98, 0xF0, 0xE4,
+    0x56, 0xC8, 0x52, 0x74, 0xBD, 0x4E, 0x66, 0xBE, 0x5C, 0x5C, 0xEF, 0xCD, 0xE3, 0x82, 0x7E, 0x65,
+    0xCD, 0x13, 0x82, 0x7E, 0x69, 0xD3, 0xE7, 0x04, 0xFD, 0xC2, 0x96, 0x2B, 0x41, 0x42, 0xCC, 0x0D,
+    0x50, 0xF1, 0x8B, 0x0A, 0x28, 0xFB, 0x5D, 0x09, 0x94, 0xC8, 0x76, 0x12, 0x24, 0x3A, 0x18, 0x10,
+    0x48, 0x55, 0x90, 0x4C, 0xAE, 0x30, 0xB3, 0x06, 0x1B, 0xA4, 0xCA, 0xEC, 0x42, 0x86, 0x2B, 0xCF,
+    0xF3, 0x1A, 0xA1, 0x7B, 0xCE, 0x6A, 0xAD, 0xF3, 0x2C, 0xB3, 0xA1, 0xAB, 0x06, 0x83, 0xC3, 0x6D,
+    0xA1, 0xB5, 0x33, 0xBC, 0xD3, 0x95, 0x3E, 0xE5, 0x33, 0xAE, 0xA3, 0xBB, 0xFF, 0x7A, 0xA4, 0xCD,
+    0xF5, 0xCE, 0x04, 0x1D, 0x4C, 0xBE, 0x32, 0x2B, 0xB9, 0x6C, 0x0F, 0x1C, 0xF7, 0x38, 0xF8, 0x1D,
+    0xDB, 0x96, 0x1D, 0x38, 0x81, 0xF9, 0x33, 0x5E, 0x22, 0x17, 0x17, 0x65, 0x8C, 0xAF, 0x85, 0x1A,
+    0x7C, 0x71, 0x69, 0xE2, 0x09, 0xE7, 0xC7, 0xF0, 0x03, 0x85, 0xBE, 0x93, 0x0D, 0xEF, 0x3C, 0x9E,
+    0x13, 0x41, 0x7A, 0xCD, 0xA0, 0xB4, 0x72, 0x24, 0x72, 0xFF, 0x1B, 0xD6, 0xBA, 0x58, 0x80, 0xAC,
+    0xA7, 0xAD, 0x50, 0x84, 0x36, 0xD0, 0xD3, 0x4D, 0xDA, 0xBC, 0x2B, 0xD2, 0x71, 0x49, 0x3F, 0x5A,
+    0xBE, 0xE9, 0x5C, 0x4B, 0xB7, 0x79, 0xDC, 0xD6, 0x7F, 0xD5, 0x6F, 0xE9, 0x1D, 0x56, 0x7B, 0xB8,
+    0x5B, 0xC6, 0x3B, 0x47, 0xB4, 0x27, 0x80, 0xEF, 0xD1, 0x3F, 0xB6, 0x15, 0xA6, 0xA4, 0xA7, 0xDE,
+    0x38, 0xCF, 0xD9, 0xC8, 0x84, 0x2F, 0xFA, 0x22, 0x45, 0x09, 0x0B, 0xEE, 0xE3, 0x95, 0xDF, 0x0B,
+    0x03, 0xEE, 0x84, 0xFF, 0x5E, 0x05, 0x51, 0x6B, 0xD0, 0x98, 0xFE, 0x8C, 0xBF, 0x67, 0x1A, 0x83,
+    0xF3, 0x90, 0x0C, 0xF6, 0xF3, 0xC2, 0x75, 0x65, 0x91, 0x6C, 0x4B, 0xEF, 0xB9, 0x77, 0xDE, 0x8C,
+    0x27, 0x99, 0x6D, 0x2E, 0x3C, 0x65, 0x97, 0xCD, 0xBE, 0x3C, 0xB7, 0x79, 0x0E, 0xE0, 0x5B, 0x00,
+    0x77, 0xE1, 0xDB, 0x73, 0xF6, 0x28, 0xA3, 0xE6, 0x4B, 0x79, 0x80, 0xDC, 0x32, 0xB1, 0x0E, 0x86,
+    0x32, 0x13, 0x2B, 0x3A, 0x21, 0x6B, 0xCE, 0x0A, 0xEC, 0xE3, 0x25, 0xB4, 0x10, 0xE1, 0xEA, 0x38,
+    0x7A, 0xEA, 0x88, 0x47, 0xC3, 0xE3, 0x0C, 0x69, 0x3B, 0x4B, 0x21, 0x72, 0x9F, 0x56, 0x2E, 0x38,
+    0xD8, 0x96, 0x03, 0xDD, 0xC5, 0xA4, 0xB6, 0x85, 0x93, 0x87, 0xA9, 0xA2, 0x14, 0xB9, 0x19, 0x45,
+    0x07, 0x07, 0xCF, 0x12, 0xEE, 0x53, 0xEC, 0xC0, 0x71, 0x70, 0xFA, 0x92, 0x5A, 0x38, 0x6A, 0xDE,
+    0x80, 0x56, 0x0B, 0xB5, 0x64, 0x3C, 0xA2, 0xA2, 0xC9, 0xEE, 0x97, 0x74, 0x96, 0x3B, 0x15, 0x85,
+    0xD4, 0xD8, 0x11, 0xBE, 0x27, 0x3A, 0x63, 0xA7, 0x10, 0xBF, 0x5C, 0xEE, 0x1E, 0x76, 0x09, 0xCE,
+    0x43, 0xFC, 0x27, 0x83, 0x10, 0x11, 0x41, 0x98, 0x1D, 0x90, 0xC8, 0x5A, 0x35, 0x28, 0x3A, 0x2F,
+    0x44, 0x32, 0x14, 0x69, 0xD1, 0x12, 0x95, 0x0E, 0xB9, 0x0F, 0xDD, 0x25, 0xFA, 0x85, 0x34, 0xD1,
+    0xEF, 0xE1, 0x56, 0xB2, 0xC3, 0x97, 0x43, 0xD8, 0xC5, 0x6A, 0x8D, 0xC4, 0xB8, 0xCF, 0x38, 0x91,
+    0xDD, 0x39, 0xDC, 0xEF, 0xD4, 0x4F, 0xBD, 0x64, 0x61, 0xDD, 0xC8, 0xD5, 0x78, 0xD0, 0x27, 0x90,
+    0x4D, 0x01, 0x45, 0x63, 0x82, 0x9B, 0x5F, 0x60, 0x45, 0x73, 0x70, 0x8E, 0x19, 0xDF, 0xE1, 0x12,
+    0x76, 0xFC, 0x5E, 0x33, 0x19, 0x35, 0xC1, 0xE5, 0xC6, 0x29, 0x0A, 0x7F, 0x8C, 0xD9, 0x8B, 0x29,
+    0xA8, 0xBC, 0x06, 0xD5, 0x44, 0xB8, 0x21, 0x0C, 0x27, 0x02, 0x7B, 0x21, 0xA8, 0x17, 0x69, 0xF7,
+    0xF8, 0x11, 0x77, 0xD3, 0x6A, 0x82, 0xBA, 0xCB, 0x74, 0xC7, 0x7D, 0xF0, 0x9D, 0xAB, 0x11, 0x5C,
+    0xE4, 0x06, 0xB5, 0x42, 0x0E, 0x97, 0x70, 0x59, 0xCF, 0xA1, 0x0A, 0x0B, 0x42, 0x4F, 0x77, 0x74,
+    0x5D, 0xD8, 0x5F, 0xB3, 0x6F, 0xBF, 0xA6, 0x1F, 0x20, 0x55, 0x6F, 0x7B, 0xDC, 0xDE, 0x01, 0xA6,
+    0x31, 0xB4, 0xD5, 0x6B, 0x05, 0xCF, 0x76, 0xAC, 0xF6, 0x99, 0x5B, 0x7B, 0xED, 0x6C, 0x64, 0x5C,
+    0x87, 0x89, 0xBA, 0x3B, 0xE9, 0xA1, 0x16, 0x98, 0xD9, 0xDF, 0xC2, 0xC0, 0xD0, 0x8D, 0x18, 0x27,
+    0x92, 0x08, 0xE3, 0x39, 0x45, 0x4D, 0x1F, 0xA2, 0x29, 0xB1, 0xB9, 0xC7, 0x18, 0x3C, 0x07, 0x38,
+    0xCF, 0xD4, 0x00, 0xD0, 0xCD, 0xF8, 0x23, 0xE9, 0x8F, 0x71, 0xFD, 0x49, 0x8F, 0xF6, 0xC7, 0x19,
+    0x1E, 0x1C, 0x36, 0x23, 0xDE, 0x77, 0xF8, 0x89, 0x23, 0xF8, 0xDF, 0x67, 0x2E, 0x22, 0x13, 0xF0,
+    0xC2, 0xD3, 0x20, 0xC0, 0x7D, 0xA8, 0x27, 0xE6, 0x39, 0xC2, 0x6F, 0x11, 0x1A, 0x07, 0x49, 0x0E,
+    0x01, 0x45, 0xBF, 0xA0, 0x87, 0x9F, 0x80, 0xC7, 0x24, 0x61, 0x05, 0x58, 0x54, 0x73, 0x5B, 0x3E,
+    0x87, 0x47, 0x3A, 0xF7, 0x28, 0x2A, 0x7A, 0x24, 0x25, 0xC4, 0x7D, 0xCA, 0xD7, 0xF3, 0x11, 0x93,
+    0xD2, 0x8B, 0x46, 0xE5, 0xF3, 0xE4, 0x4E, 0x58, 0x48, 0x44, 0x31, 0xCF, 0x3E, 0x91, 0x60, 0x6C,
+    0xAD, 0x7F, 0x4F, 0x1A, 0x87, 0x57, 0x8A, 0xE3, 0xD5, 0xE6, 0xEF, 0xFC, 0x3B, 0x6C, 0x0A, 0x75,
+    0xC6, 0xD0, 0x57, 0xEC, 0x22, 0xCC, 0x59, 0x3B, 0xF6, 0x43, 0x83, 0x51, 0xD9, 0x93, 0xED, 0xAA,
+    0x83, 0x6D, 0x47, 0x95, 0xE5, 0x49, 0x84, 0x0B, 0x53, 0x97, 0x59, 0xD3, 0x6F, 0x12, 0xD5, 0x6F,
+    0xF4, 0x11, 0x96, 0x37, 0xD5, 0x28, 0x3C, 0xFA, 0x68, 0x45, 0xB2, 0x4D, 0x8B, 0x3C, 0xAB, 0x54,
+    0xB2, 0x8D, 0xDA, 0x53, 0xD4, 0xDF, 0x43, 0xFD, 0x81, 0x92, 0x48, 0x45, 0x51, 0x7F, 0x7F, 0x48,
+    0x7E, 0x44, 0xB2, 0x5D, 0x89, 0x3C, 0xDC, 0xC0, 0x4C, 0x20, 0x92, 0x6D, 0x1A, 0xE1, 0x5E, 0x8F,
+    0xAE, 0x0B, 0x91, 0x70, 0x00, 0x53, 0xFE, 0xE2, 0xF4, 0x65, 0x55, 0x82, 0x3E, 0xC9, 0xB9, 0xBD,
+    0x82, 0xD8, 0x48, 0x2D, 0xEA, 0x1C, 0x18, 0x9C, 0xA2, 0x9E, 0x72, 0x5C, 0xD0, 0x53, 0x27, 0x0C,
+    0x86, 0x09, 0x9D, 0x9B, 0x51, 0x3F, 0x7D, 0xC1, 0x7D, 0x9D, 0x37, 0x73, 0xB7, 0xC6, 0x83, 0x06,
+    0x27, 0xE9, 0x29, 0x57, 0x3C, 0xA5, 0xFC, 0x79, 0xE0, 0xB2, 0x2E, 0xED, 0x5F, 0xF0, 0xDC, 0x95,
+    0x63, 0xA6, 0xDB, 0x04, 0x14, 0x9F, 0xEC, 0x4B, 0xCE, 0x02, 0xA4, 0x4E, 0x9B, 0xA2, 0xA2, 0x2D,
+    0x88, 0x6A, 0x37, 0x0F, 0x6D, 0x5C, 0x27, 0xF2, 0x15, 0x06, 0x23, 0x0F, 0x11, 0xB0, 0x38, 0x98,
+    0x02, 0xED, 0x32, 0x1C, 0x44, 0x51, 0x33, 0x85, 0xD8, 0x5D, 0xD8, 0x10, 0xA6, 0x3F, 0x5C, 0x35,
+    0x49, 0x0F, 0xAF, 0x36, 0x90, 0xC3, 0xB4, 0x13, 0xED, 0x88, 0x60, 0xD1, 0x05, 0xC7, 0x43, 0x19,
+    0x3F, 0xDC, 0x6E, 0x3C, 0xBA, 0x6B, 0xD4, 0x1F, 0x2C, 0x13, 0x9E, 0x3B, 0xD3, 0xDF, 0xA7, 0xEC,
+    0x4B, 0x30, 0xD0, 0xC9, 0x5E, 0xFA, 0x53, 0x7B, 0xED, 0xA2, 0x7E, 0x26, 0xE0, 0x93, 0x50, 0x17,
+    0x40, 0xA2, 0x7B, 0xD0, 0xBE, 0x07, 0xDB, 0xCA, 0x41, 0x1E, 0xCB, 0x5A, 0x96, 0x08, 0xB7, 0xA5,
+    0xD8, 0x77, 0x32, 0xE0, 0x63, 0xFD, 0x12, 0xDB, 0x39, 0x30, 0x1E, 0x78, 0x33, 0xA0, 0x6B, 0x07,
+    0xCA, 0x19, 0x4C, 0xE7, 0x86, 0x51, 0x92, 0xA7, 0x11, 0x26, 0xF8, 0xD8, 0xAB, 0xA3, 0x2D, 0xBC,
+    0x60, 0x2C, 0x08, 0x75, 0x46, 0xC3, 0xB8, 0xA1, 0x0D, 0x1D, 0xE8, 0xC3, 0xD2, 0xE6, 0x37, 0xE5,
+    0xB6, 0xA5, 0x93, 0xDB, 0x16, 0x22, 0xB7, 0x79, 0xAF, 0x4C, 0x72, 0x9B, 0xED, 0xF8, 0x73, 0x12,
+    0xB9, 0x4D, 0x8F, 0xF7, 0xDE, 0x80, 0xFA, 0x93, 0x3C, 0x29, 0x8B, 0x34, 0xC4, 0x4F, 0x0A, 0x45,
+    0x05, 0x06, 0xB9, 0xC4, 0x5E, 0x15, 0x25, 0x78, 0x80, 0xFD, 0xA0, 0x94, 0xE7, 0x42, 0x53, 0x6D,
+    0x3E, 0x2B, 0x14, 0x70, 0x68, 0xC2, 0xA6, 0x37, 0x61, 0x2D, 0xC7, 0x5C, 0x89, 0xFD, 0x1B, 0x8C,
+    0xFB, 0xF7, 0xEB, 0x1A, 0x38, 0x86, 0xD0, 0x68, 0x6F, 0x58, 0x9F, 0x11, 0xC4, 0x2F, 0xE8, 0x31,
+    0xF1, 0x9E, 0xFF, 0xF3, 0xF4, 0x11, 0x46, 0xDF, 0x3D, 0xEC, 0xBD, 0x92, 0xFC, 0xA8, 0xCB, 0x7E,
+    0xDC, 0x65, 0x3F, 0xEA, 0xE2, 0xEF, 0xAC, 0x3E, 0xE0, 0xDD, 0xCC, 0x63, 0x6A, 0x74, 0xA3, 0x95,
+    0x37, 0x9B, 0x17, 0x2C, 0x12, 0x9D, 0x5D, 0x43, 0x87, 0x8B, 0xBB, 0xFF, 0x1F, 0x37, 0x2C, 0x17,
+    0x70, 0x3D, 0x51, 0x9B, 0xCB, 0x47, 0x0D, 0xD1, 0x21, 0xD1, 0x14, 0x29, 0x5A, 0x44, 0x2A, 0x6B,
+    0x6E, 0xA2, 0x78, 0x42, 0x10, 0xC8, 0x1E, 0x57, 0x6F, 0xF1, 0x0E, 0x34, 0x9E, 0x15, 0x91, 0xB0,
+    0xD0, 0xB3, 0xCA, 0x69, 0x0E, 0x89, 0x3C, 0xE5, 0x3B, 0xF2, 0x1C, 0xFC, 0x0D, 0x6A, 0xA3, 0x5C,
+    0x09, 0x1B, 0x03, 0x84, 0xA4, 0x32, 0xC2, 0x5D, 0x1E, 0x9A, 0xF8, 0xA7, 0x8B, 0xB9, 0x56, 0xAC,
+    0xC2, 0x93, 0x71, 0xE2, 0x93, 0x71, 0x42, 0xD0, 0x36, 0x7C, 0xAD, 0x18, 0x0E, 0x52, 0x1E, 0x04,
+    0x7A, 0x20, 0xBC, 0xB4, 0xD7, 0xEF, 0xA9, 0x0A, 0xDF, 0xE9, 0x7C, 0x53, 0xDA, 0x74, 0xB8, 0x5C,
+    0xFB, 0x1D, 0x3B, 0x30, 0xE5, 0x73, 0x02, 0xA7, 0x92, 0x5B, 0x08, 0x58, 0xA2, 0x0E, 0x09, 0xA5,
+    0x71, 0x8B, 0xBB, 0x60, 0xCE, 0x33, 0x84, 0xAA, 0x92, 0xFC, 0x5B, 0x6C, 0x73, 0x50, 0x76, 0x4D,
+    0x58, 0x39, 0xA2, 0x07, 0x7C, 0xC4, 0xE8, 0x5E, 0x17, 0x98, 0xD1, 0xF0, 0x7F, 0x4B, 0x06, 0xBC,
+    0xA0, 0x0D, 0x95, 0xFB, 0x9D, 0x66, 0xFE, 0xF7, 0x23, 0xF8, 0xA9, 0xF2, 0xD9, 0x85, 0x10, 0x2C,
+    0x01, 0xE5, 0x71, 0x07, 0xB3, 0xCB, 0x61, 0xD9, 0xCF, 0xCE, 0xDF, 0xB8, 0x9C, 0x95, 0x81, 0x0D,
+    0x03, 0xC7, 0x7D, 0x33, 0x3A, 0x98, 0xCF, 0x31, 0x59, 0x83, 0x6B, 0xE6, 0xBA, 0x66, 0x94, 0x0B,
+    0x68, 0xDF, 0x96, 0xD5, 0x47, 0x67, 0x7C, 0x71, 0x86, 0xA1, 0x38, 0xA5, 0x4B, 0x38, 0x47, 0xFA,
+    0x50, 0x52, 0x41, 0x97, 0x8A, 0x48, 0xF8, 0xC7, 0x0C, 0x43, 0x0F, 0xBE, 0x22, 0x77, 0x5F, 0xD4,
+    0x8D, 0xCA, 0xA9, 0x1B, 0x1E, 0x15, 0x22, 0xCD, 0xBA, 0x32, 0x31, 0x7B, 0x1E, 0xA6, 0x73, 0x00,
+    0x68, 0xB8, 0x3E, 0x75, 0xB2, 0xF2, 0x98, 0x2B, 0xB8, 0x05, 0xC0, 0xF5, 0x02, 0x4C, 0x63, 0x49,
+    0x83, 0x40, 0xFA, 0x9F, 0x18, 0x0E, 0x80, 0xA1, 0x2B, 0x5F, 0x93, 0xFB, 0xC1, 0xD6, 0x5D, 0xE3,
+    0x96, 0xC9, 0x0A, 0xBC, 0x1F, 0x8D, 0x16, 0x6D, 0x69, 0xC4, 0x8C, 0x8F, 0x93, 0x05, 0x93, 0x3E,
+    0xA1, 0xCD, 0xFC, 0xAF, 0x88, 0x8D, 0x60, 0x30, 0x49, 0x0F, 0xF1, 0x03, 0xAE, 0x9B, 0x01, 0x91,
+    0xA9, 0x3E, 0x1E, 0x03, 0x3B, 0xAE, 0xD0, 0xF4, 0xEF, 0xAC, 0xC7, 0xC3, 0xF0, 0x3B, 0xFF, 0x42,
+    0xCA, 0x36, 0xF6, 0xCD, 0x9F, 0xD8, 0x17, 0x19, 0xD0, 0xF6, 0xE3, 0x52, 0x3D, 0xFE, 0xC5, 0xF5,
+    0xD4, 0x5E, 0xD7, 0x59, 0x34, 0x6A, 0x62, 0x48, 0x06, 0xA3, 0xAA, 0x30, 0x88, 0x7A, 0xE5, 0x14,
+    0x1D, 0x4D, 0x9E, 0x10, 0x81, 0x27, 0x99, 0xDD, 0x83, 0x38, 0x6D, 0xB3, 0xD2, 0x5C, 0x41, 0x14,
+    0x46, 0x22, 0x2C, 0xD5, 0xFC, 0xA5, 0x6C, 0xA8, 0xDA, 0x14, 0x70, 0x5D, 0x44, 0x0C, 0x39, 0x10,
+    0xB2, 0x58, 0x01, 0x67, 0x15, 0xE4, 0x0F, 0x90, 0xC6, 0x92, 0x58, 0x44, 0x91, 0x1E, 0xB1, 0x08,
+    0x22, 0x15, 0x0E, 0x58, 0xEC, 0x50, 0x34, 0x12, 0x2C, 0x77, 0x20, 0x4C, 0x28, 0x6D, 0xA1, 0x1E,
+    0x84, 0xF6, 0x05, 0xE9, 0xB8, 0xDF, 0x9F, 0xCD, 0xDE, 0x04, 0x1F, 0x1C, 0x2E, 0x27, 0x7F, 0xC7,
+    0xD8, 0x8F, 0x26, 0xB9, 0x4E, 0x19, 0xAC, 0xD2, 0x70, 0x75, 0x11, 0xCB, 0x34, 0xA5, 0xC4, 0x84,
+    0x4C, 0xBC, 0xC1, 0x66, 0x55, 0x08, 0x5A, 0x1D, 0x2D, 0x13, 0x8F, 0x3E, 0x63, 0x77, 0xD5, 0xD6,
+    0x21, 0x32, 0xF6, 0x25, 0x84, 0xAC, 0x1E, 0x2E, 0x31, 0x31, 0x97, 0x97, 0x30, 0x72, 0x3C, 0x22,
+    0xF0, 0xFC, 0x98, 0x47, 0xB1, 0x24, 0x4F, 0x5F, 0x52, 0x2A, 0xD4, 0xE8, 0xD4, 0xA5, 0xD5, 0xC0,
+    0x43, 0x4C, 0xFC, 0x56, 0x98, 0x28, 0x5C, 0x89, 0xB8, 0xE1, 0xD9, 0x9A, 0xD1, 0x7D, 0x0C, 0xF5,
+    0xBB, 0xAA, 0xEC, 0x93, 0xDC, 0x33, 0x52, 0x99, 0xE0, 0xB6, 0x12, 0x03, 0x43, 0xA3, 0x85, 0x12,
+    0xFE, 0x52, 0xA5, 0xA6, 0xDB, 0x5C, 0x42, 0x8F, 0x2A, 0x00, 0x45, 0xFC, 0xD9, 0x2B, 0xD1, 0x8F,
+    0xAD, 0x68, 0xF6, 0x4F, 0x54, 0xEA, 0xBB, 0x5D, 0x73, 0xAF, 0xC1, 0x52, 0x47, 0x17, 0x2A, 0x0F,
+    0x39, 0x4A, 0x48, 0xD1, 0x4D, 0xA6, 0x10, 0xC1, 0xD9, 0xA7, 0x27, 0x22, 0xDB, 0x7A, 0x34, 0x8A,
+    0x1C, 0xA7, 0x5E, 0x29, 0x63, 0xFE, 0x18, 0x3B, 0xD5, 0xE5, 0x99, 0x40, 0x83, 0x76, 0x8D, 0x50,
+    0xEF, 0x6F, 0xDF, 0x7E, 0xD6, 0xD2, 0x92, 0x62, 0x5D, 0x46, 0x97, 0xB1, 0xD7, 0x2E, 0xD9, 0x83,
+    0xEF, 0x6D, 0x5C, 0x33, 0x37, 0xA6, 0xAF, 0x4F, 0x37, 0xD4, 0x33, 0x85, 0x0D, 0x8D, 0x41, 0xA1,
+    0x4B, 0xD6, 0x63, 0x67, 0x8A, 0x15, 0x03, 0x1D, 0x2B, 0xE9, 0xFB, 0x4B, 0x05, 0x43, 0x47, 0x96,
+    0x8C, 0xF6, 0xD5, 0x18, 0xC4, 0x51, 0xB4, 0x18, 0x85, 0x62, 0x2C, 0x32, 0xD4, 0x0F, 0x19, 0x7C,
+    0xEB, 0x33, 0x7C, 0x35, 0x17, 0x92, 0xE2, 0xCC, 0xAC, 0x96, 0x32, 0x4B, 0x10, 0x7F, 0x3B, 0x45,
+    0x22, 0xFD, 0x52, 0xC2, 0x02, 0x5B, 0x55, 0x6E, 0x8F, 0xFB, 0x2E, 0x74, 0x08, 0xD3, 0xDF, 0x46,
+    0x94, 0x38, 0xB4, 0x32, 0x9F, 0x58, 0x30, 0xE4, 0xFE, 0xF3, 0x60, 0xAC, 0x22, 0x94, 0x49, 0x1F,
+    0xE4, 0x41, 0x2B, 0xF7, 0x58, 0xD7, 0x89, 0x29, 0x69, 0xD7, 0x0D, 0x31, 0xD4, 0x71, 0x45, 0xCA,
+    0xEE, 0x62, 0x75, 0x2C, 0x9C, 0xD5, 0x38, 0xA9, 0x7D, 0x8D, 0xD0, 0xE8, 0x68, 0x4C, 0xF0, 0x56,
+    0x7A, 0xCC, 0x37, 0x4C, 0x83, 0xF0, 0x6F, 0x3C, 0x3B, 0x28, 0x49, 0x32, 0x7E, 0xFA, 0x3A, 0xE2,
+    0x2D, 0x4D, 0xF8, 0xC5, 0x5F, 0x33, 0xA6, 0x2A, 0x6C, 0x18, 0xD4, 0x1E, 0xC2, 0x90, 0x6A, 0x2E,
+    0x84, 0x0D, 0xEE, 0x26, 0x8A, 0x00, 0x9C, 0x97, 0x6D, 0x88, 0x48, 0x41, 0xB9, 0x49, 0x03, 0x16,
+    0x06, 0xD4, 0x9B, 0x00, 0x48, 0x64, 0x9D, 0x3E, 0xE4, 0x31, 0x20, 0xA8, 0x60, 0x78, 0x51, 0x35,
+    0xC5, 0x6A, 0x31, 0xC4, 0xC4, 0xF8, 0xD7, 0xD1, 0x8F, 0xE5, 0x5B, 0xDC, 0x41, 0x2F, 0xE2, 0xF1,
+    0x21, 0x2D, 0x7C, 0x31, 0x09, 0x50, 0x83, 0xDB, 0xF4, 0xC4, 0xBF, 0x31, 0x20, 0x08, 0xE1, 0xD7,
+    0x83, 0x3C, 0xD1, 0xFF, 0x87, 0x01, 0xF6, 0xD4, 0xD7, 0x07, 0x79, 0x5E, 0xF0, 0xFA, 0x20, 0x2C,
+    0x29, 0x12, 0x28, 0x27, 0xE4, 0xAF, 0x87, 0xD8, 0x36, 0x02, 0x13, 0x9C, 0x1E, 0xD6, 0xD0, 0x5F,
+    0xA2, 0x6B, 0xE7, 0x6B, 0x4C, 0x76, 0x35, 0x27, 0x57, 0x42, 0x5C, 0xAF, 0x5D, 0x2B, 0xD4, 0xBC,
+    0x2E, 0x8C, 0x93, 0x39, 0xAE, 0x1C, 0x2A, 0x77, 0x3A, 0x63, 0x10, 0x28, 0xF3, 0x30, 0x8A, 0x9F,
+    0xF3, 0xC4, 0x40, 0x7E, 0x4E, 0xB5, 0x7D, 0x7B, 0xF7, 0xCB, 0x37, 0x9F, 0xB1, 0x53, 0xEA, 0x1C,
+    0x03, 0x72, 0xAF, 0x1D, 0x5C, 0xBA, 0xCE, 0x98, 0x25, 0x98, 0x02, 0x7E, 0xBC, 0x62, 0x64, 0x9F,
+    0x28, 0xFF, 0x7F, 0xB5, 0xA2, 0xD0, 0x5D, 0x9A, 0x38, 0x58, 0x25, 0x9A, 0x00, 0x90, 0x48, 0x6B,
+    0xC5, 0xD6, 0x85, 0x80, 0x2B, 0x21, 0xAD, 0xC3, 0x60, 0xE5, 0xBC, 0xBE, 0x6D, 0xB0, 0xA2, 0x2B,
+    0xBD, 0x5C, 0xAC, 0x02, 0x38, 0xCA, 0xE1, 0x58, 0xC5, 0x67, 0x88, 0x68, 0x1A, 0x32, 0x2B, 0xDF,
+    0x45, 0x98, 0xBD, 0x6B, 0x75, 0xA0, 0x08, 0x46, 0x6D, 0x0A, 0x46, 0x98, 0x30, 0xCC, 0x11, 0xB1,
+    0xD5, 0xDD, 0xBC, 0x43, 0xBD, 0x4C, 0xBA, 0xAF, 0xF1, 0xB8, 0x66, 0x45, 0x51, 0xC2, 0x78, 0x58,
+    0x44, 0x48, 0x63, 0xB5, 0xB3, 0x25, 0x8C, 0xBA, 0xBD, 0xDA, 0xE6, 0x4D, 0x18, 0xFF, 0x1C, 0x14,
+    0x2A, 0x73, 0xF2, 0x33, 0xD8, 0x59, 0xCC, 0xD9, 0xF8, 0xA7, 0x10, 0xE1, 0xCC, 0x61, 0x0C, 0x7F,
+    0x81, 0xB0, 0x7C, 0xC1, 0x72, 0x00, 0x2E, 0x80, 0x65, 0x95, 0xC3, 0x41, 0xAE, 0x13, 0x21, 0x2C,
+    0xB2, 0xC0, 0x08, 0x14, 0xA3, 0xBC, 0x36, 0xE2, 0xA8, 0xDF, 0xDD, 0x7D, 0xB6, 0x54, 0x17, 0x6F,
+    0xE4, 0xB8, 0xD3, 0x8E, 0x3B, 0x94, 0x3B, 0x8D, 0xE3, 0x63, 0x80, 0x98, 0x70, 0x7F, 0x15, 0x57,
+    0xC2, 0x3E, 0xCC, 0xD5, 0x5E, 0xBA, 0x33, 0xE9, 0x1F, 0xEA, 0x42, 0xB6, 0xEA, 0x7B, 0x2B, 0xDE,
+    0xB5, 0x3C, 0xF2, 0x93, 0x9A, 0x81, 0x90, 0x8D, 0xE8, 0xE7, 0x90, 0x65, 0xEB, 0xA4, 0x66, 0x0A,
+    0xA8, 0xE8, 0xEB, 0xB4, 0x66, 0x96, 0x49, 0xAD, 0x07, 0x2C, 0x31, 0x74, 0xD2, 0x7A, 0x39, 0xF0,
+    0x1C, 0xAB, 0x35, 0x9D, 0x25, 0x69, 0xA0, 0x86, 0x23, 0xC2, 0xDB, 0xD8, 0x16, 0xEE, 0x64, 0x1A,
+    0xE5, 0x32, 0x26, 0xF2, 0x8C, 0x28, 0xEE, 0x77, 0x9F, 0xA9, 0xA9, 0xF4, 0x85, 0x34, 0xBC, 0xA9,
+    0xE0, 0x60, 0x4B, 0xED, 0xF9, 0x2F, 0x1A, 0xA7, 0x20, 0x38, 0x9F, 0x20, 0xA8, 0xEE, 0x5D, 0x46,
+    0x4D, 0xD9, 0x37, 0x87, 0x18, 0x89, 0x06, 0xDF, 0x19, 0xD8, 0x07, 0x7F, 0x08, 0xD0, 0x05, 0x7F,
+    0x90, 0x0D, 0x1B, 0xF4, 0x82, 0x60, 0x6A, 0x00, 0x1F, 0xCF, 0xAD, 0x2C, 0xA2, 0xA8, 0xFE, 0x58,
+    0xDC, 0x3A, 0x6A, 0x41, 0xB3, 0xA1, 0x86, 0x00, 0x4F, 0x4D, 0xE6, 0x2B, 0x20, 0x87, 0x67, 0xF7,
+    0x2B, 0x2E, 0x7F, 0x84, 0xC9, 0xA7, 0x4A, 0x8F, 0x88, 0x6D, 0x4C, 0xB5, 0x29, 0x8B, 0xBA, 0x33,
+    0x52, 0x73, 0x6B, 0x46, 0x22, 0x16, 0x7E, 0x3D, 0xD2, 0xB8, 0x6F, 0x97, 0xE5, 0x94, 0xA5, 0xF0,
+    0x72, 0xAA, 0x74, 0xBC, 0xBB, 0xEB, 0x92, 0x24, 0xED, 0x1A, 0x5B, 0x3D, 0xF8, 0xBE, 0x15, 0x2E,
+    0xE0, 0x48, 0x79, 0x88, 0x46, 0x0A, 0x0E, 0xBB, 0x68, 0x24, 0xE1, 0x78, 0x15, 0xAD, 0x22, 0xCD,
+    0x6A, 0x49, 0x9A, 0x68, 0x24, 0xDD, 0xAC, 0x8E, 0x56, 0x0C, 0x24, 0x06, 0x4F, 0x85, 0xF5, 0x44,
+    0x99, 0x2C, 0xAD, 0x32, 0x2E, 0xF4, 0x20, 0x42, 0xFC, 0x8B, 0xC7, 0x20, 0xC4, 0x18, 0x01, 0xD6,
+    0xA0, 0xE4, 0x0E, 0x29, 0xCD, 0x49, 0x8F, 0x66, 0x0D, 0xDB, 0x66, 0xD0, 0x67, 0x5C, 0x16, 0x8D,
+    0xBE, 0x19, 0x5B, 0x4B, 0x10, 0xE1, 0x4B, 0xBB, 0x57, 0x94, 0xB6, 0xB1, 0x51, 0x54, 0x3C, 0x13,
+    0x26, 0xAB, 0x5C, 0x13, 0xF6, 0xEC, 0x52, 0x5B, 0xCB, 0x21, 0x56, 0x35, 0xC1, 0x51, 0x8F, 0x52,
+    0xB7, 0x13, 0xB4, 0xAD, 0x50, 0x10, 0xC5, 0x6C, 0xF9, 0x42, 0xF2, 0x0B, 0xDD, 0x23, 0x32, 0xF5,
+    0xB5, 0xEE, 0x92, 0x58, 0xE8, 0xA9, 0x60, 0x4B, 0xE8, 0xA9, 0xCE, 0x20, 0xBE, 0x93, 0xA6, 0x68,
+    0x3F, 0x63, 0x68, 0x25, 0xC4, 0x11, 0x1B, 0x8A, 0x78, 0xDE, 0x87, 0x50, 0x34, 0x21, 0x54, 0x0C,
+    0xB0, 0xD6, 0xA4, 0x22, 0x26, 0x7A, 0xED, 0x42, 0x9E, 0xF7, 0x3C, 0x4E, 0xA1, 0xF8, 0xFA, 0x7F,
+    0x75, 0xF9, 0xF3, 0x85, 0xEC, 0x03, 0x1E, 0x27, 0x11, 0x2C, 0xA2, 0x74, 0x5A, 0x25, 0xD0, 0x0E,
+    0x01, 0xEA, 0xA0, 0x54, 0xEE, 0x38, 0x65, 0x90, 0x60, 0xD6, 0x1E, 0xDD, 0x5B, 0xB9, 0x54, 0x89,
+    0x6F, 0xAC, 0x25, 0x8F, 0xD0, 0x62, 0x92, 0xCC, 0x71, 0xBA, 0x33, 0x70, 0xE9, 0xA9, 0xB4, 0x90,
+    0xEC, 0x59, 0x88, 0x83, 0xC3, 0x45, 0xB8, 0xC8, 0x9C, 0x22, 0x90, 0x88, 0xA6, 0x90, 0xC6, 0x72,
+    0x12, 0xD6, 0xE1, 0xAD, 0x02, 0x59, 0x30, 0x90, 0x4D, 0x1E, 0x85, 0x5C, 0x3D, 0x47, 0x6D, 0x05,
+    0xB5, 0x0F, 0xAE, 0xD4, 0x5F, 0xF9, 0x2A, 0xA4, 0xB1, 0x85, 0x1D, 0x52, 0x51, 0xFA, 0xEB, 0xA4,
+    0x4A, 0x56, 0x49, 0x19, 0xB7, 0x91, 0x08, 0x40, 0x1E, 0x0B, 0x01, 0xC8, 0xB3, 0xBE, 0x81, 0xC3,
+    0x5C, 0x06, 0x76, 0x80, 0x0E, 0xE2, 0x40, 0xA1, 0xE1, 0xAE, 0xD7, 0x1F, 0xF0, 0xB3, 0x62, 0x85,
+    0x84, 0x99, 0x08, 0xC1, 0x48, 0xDF, 0x35, 0xCC, 0x69, 0xEA, 0x8D, 0x77, 0xF1, 0x0A, 0x42, 0xC8,
+    0xFF, 0xD9, 0xF6, 0x91, 0xBD, 0xD5, 0x7B, 0xFF, 0xC7, 0x3C, 0xA7, 0xD2, 0xA0, 0x74, 0xA6, 0xB6,
+    0xB2, 0xE0, 0xB0, 0xAA, 0xC2, 0x94, 0x06, 0x31, 0xD3, 0x72, 0x87, 0xB6, 0x94, 0x0F, 0xE8, 0xE9,
+    0x3B, 0x29, 0xCE, 0x3D, 0x50, 0x98, 0x41, 0xFF, 0x48, 0x69, 0x29, 0xE9, 0x10, 0x14, 0x91, 0x55,
+    0x38, 0x9A, 0xA5, 0x7B, 0x37, 0xF7, 0x6E, 0xEE, 0x8D, 0x74, 0x00, 0x3E, 0xF3, 0x58, 0x31, 0xA8,
+    0x26, 0x12, 0xB9, 0x53, 0xFE, 0x18, 0x76, 0xB9, 0xAD, 0x1A, 0xFD, 0x6B, 0xC6, 0x4C, 0x97, 0x60,
+    0x74, 0xE4, 0xA9, 0x95, 0xA4, 0x39, 0x19, 0x14, 0xA1, 0xB7, 0x89, 0x08, 0x93, 0x52, 0x78, 0x41,
+    0x13, 0x57, 0x22, 0x99, 0x36, 0x01, 0x92, 0xFB, 0x21, 0x2B, 0x08, 0x5C, 0x34, 0x80, 0xDE, 0xED,
+    0xA0, 0x5E, 0x83, 0x32, 0x03, 0x0D, 0x12, 0xD5, 0xE4, 0xBB, 0xD8, 0x6B, 0x72, 0x4F, 0xA1, 0x84,
+    0x1B, 0x3D, 0xDD, 0xEE, 0x2B, 0xCA, 0xA6, 0xF9, 0x5C, 0xAA, 0xA1, 0x39, 0x31, 0x74, 0x8C, 0x96,
+    0x92, 0x24, 0x03, 0x0E, 0x10, 0x80, 0xB3, 0xC0, 0xB4, 0xE6, 0x38, 0xF8, 0x0A, 0x66, 0x25, 0xCA,
+    0x86, 0x47, 0x60, 0xFF, 0x2A, 0xEE, 0xC6, 0x80, 0x7F, 0xE1, 0xC5, 0xED, 0x97, 0x00, 0x2D, 0x3C,
+    0xC1, 0x88, 0xF9, 0xCA, 0xFA, 0xA4, 0x3F, 0x23, 0xEC, 0x44, 0x28, 0xAA, 0xB8, 0xDE, 0xCB, 0x35,
+    0x0F, 0x45, 0xEE, 0x4A, 0xFD, 0x16, 0xEF, 0xD0, 0xEA, 0xDD, 0x78, 0xE7, 0xDA, 0x6D, 0x6A, 0xA6,
+    0x8D, 0xE1, 0xF0, 0xE0, 0xEE, 0xD6, 0x51, 0x9C, 0x1F, 0xA7, 0x39, 0xA6, 0xA6, 0x2F, 0xA4, 0x07,
+    0x73, 0xAD, 0x12, 0x48, 0x8C, 0xB8, 0x93, 0x04, 0x91, 0x3B, 0x02, 0x92, 0x26, 0x7B, 0x57, 0x7E,
+    0xC9, 0xEC, 0x20, 0x07, 0xD3, 0x4D, 0x44, 0x00, 0x34, 0x8F, 0xD1, 0xF2, 0x4D, 0x90, 0xD5, 0xBC,
+    0x38, 0xC4, 0xD7, 0x70, 0x83, 0x94, 0xB7, 0xD2, 0xAA, 0x0C, 0x10, 0xED, 0x98, 0xBA, 0x39, 0x18,
+    0x8D, 0x9E, 0x2A, 0x21, 0xD7, 0x87, 0x2A, 0x97, 0x26, 0x7F, 0x4D, 0x13, 0xFD, 0x8E, 0xC7, 0x7D,
+    0x78, 0xA8, 0xFB, 0xB4, 0xD5, 0x3D, 0xAB, 0x31, 0xF5, 0x9E, 0x9A, 0x31, 0x7D, 0xDD, 0x9B, 0xDC,
+    0x57, 0x51, 0x4B, 0x6E, 0x2B, 0x6C, 0xBE, 0xA4, 0xE7, 0x80, 0x87, 0xDA, 0x72, 0x08, 0xF5, 0x68,
+    0x8B, 0xF4, 0x64, 0xFB, 0xCF, 0x9A, 0x91, 0xF1, 0x9A, 0x4A, 0xA8, 0x4A, 0x60, 0x2E, 0xE5, 0x4C,
+    0x55, 0xA2, 0x31, 0xB0, 0x36, 0x56, 0x5A, 0x0B, 0xAB, 0x35, 0x7D, 0x79, 0x25, 0x4A, 0x12, 0x20,
+    0x13, 0x83, 0x7C, 0x86, 0xE1, 0xF9, 0x35, 0x7C, 0xC1, 0x41, 0x49, 0xEB, 0x07, 0x84, 0x92, 0x32,
+    0x1A, 0x2B, 0x4A, 0xC8, 0xF0, 0x77, 0x78, 0xBF, 0x27, 0xA8, 0x35, 0xEF, 0xB3, 0x8B, 0x97, 0xD9,
+    0x43, 0x66, 0x6B, 0xF5, 0xAA, 0x35, 0xAB, 0xEA, 0x5B, 0x19, 0x8D, 0x5F, 0xA4, 0xEA, 0x23, 0xE0,
+    0x1B, 0x5F, 0xE0, 0x1E, 0xC9, 0xDE, 0xEC, 0xD5, 0x0F, 0x46, 0x79, 0x33, 0x68, 0x12, 0x1A, 0x63,
+    0x5A, 0x0D, 0xF9, 0xDC, 0xF7, 0xB7, 0x65, 0x76, 0x7D, 0x2C, 0x66, 0xF4, 0xF4, 0xAB, 0x9F, 0x4B,
+    0xA1, 0x0D, 0x26, 0x08, 0xDB, 0x1C, 0x98, 0xD3, 0x5E, 0xF8, 0xE4, 0x9E, 0x39, 0x73, 0xD7, 0xCA,
+    0xB3, 0x47, 0xC7, 0x75, 0x1F, 0xE7, 0x7E, 0xED, 0xDF, 0x62, 0x56, 0xB5, 0xE2, 0x29, 0x8E, 0x40,
+    0xB6, 0x4C, 0xD4, 0x8D, 0x7F, 0x4F, 0x9D, 0x46, 0x20, 0xF3, 0xE2, 0x6C, 0x65, 0xCA, 0x95, 0x5D,
+    0xA4, 0x2E, 0x85, 0xCD, 0x9F, 0x5A, 0xFB, 0x6D, 0xCB, 0xDD, 0x5B, 0xFC, 0x92, 0x4D, 0x6C, 0xCC,
+    0xA2, 0xC9, 0x90, 0xDF, 0xA4, 0xB1, 0x88, 0xC2, 0xD3, 0x63, 0xA3, 0xF1, 0x89, 0xC2, 0xDA, 0x77,
+    0xB4, 0xB9, 0x92, 0xFB, 0x9C, 0x75, 0x4D, 0xB9, 0xFB, 0xBE, 0xBB, 0x00, 0x09, 0x77, 0x46, 0xBF,
+    0x26, 0x0F, 0x5C, 0x99, 0x31, 0x9A, 0xF1, 0xF5, 0x86, 0xB1, 0x9C, 0x72, 0x66, 0x15, 0x6F, 0xD6,
+    0xFA, 0xE0, 0xCA, 0x64, 0x3F, 0x2B, 0xC7, 0xEE, 0x24, 0xEF, 0x96, 0xDA, 0xC9, 0x9C, 0x5A, 0xAB,
+    0x46, 0x31, 0x18, 0x97, 0xE2, 0x86, 0xCB, 0x83, 0x61, 0x1A, 0x26, 0x4D, 0x5B, 0x1A, 0xE6, 0xC8,
+    0x64, 0x42, 0x0D, 0x74, 0x1C, 0x8B, 0x0E, 0xCC, 0xF9, 0xE3, 0x4A, 0x95, 0xF3, 0xA1, 0x36, 0x13,
+    0xE4, 0x6C, 0x4E, 0x58, 0xD8, 0x79, 0x19, 0xBB, 0xB9, 0x79, 0x71, 0x8D, 0x97, 0xD3, 0x86, 0x5E,
+    0xC5, 0xB6, 0x8D, 0xC9, 0x23, 0x3A, 0x6D, 0x89, 0xDC, 0x86, 0xC4, 0x52, 0xE9, 0x00, 0x18, 0xCF,
+    0xB7, 0x45, 0x1A, 0x91, 0x11, 0xE2, 0x2C, 0x47, 0x84, 0x0C, 0xA8, 0xAA, 0xA8, 0x8A, 0xCA, 0x67,
+    0xAD, 0x88, 0x4C, 0xE4, 0x86, 0x65, 0xC9, 0x96, 0x30, 0x1E, 0x21, 0x06, 0x46, 0x10, 0x8A, 0x98,
+    0x94, 0x6A, 0x4B, 0x04, 0x29, 0xA3, 0x7F, 0x0D, 0xE0, 0x0F, 0x27, 0x6F, 0x5A, 0x0E, 0x4F, 0x18,
+    0xBD, 0x8B, 0x6F, 0xF7, 0x8D, 0xDE, 0x99, 0x46, 0x20, 0xF0, 0xAB, 0x9C, 0xBA, 0x13, 0x7A, 0xA0,
+    0x52, 0x80, 0x9A, 0x0B, 0x41, 0xAE, 0xCA, 0xBE, 0x74, 0x78, 0x5F, 0x9A, 0x4C, 0x45, 0xB3, 0x89,
+    0x8B, 0xF4, 0x3F, 0xB1, 0xF6, 0x7E, 0x32, 0x19, 0x8D, 0x43, 0x3F, 0x55, 0x8C, 0xF3, 0x15, 0x4E,
+    0xD4, 0xF6, 0xF0, 0x77, 0xDD, 0x54, 0xAD, 0xD6, 0xAE, 0xF5, 0x34, 0x73, 0x33, 0x52, 0x75, 0x5F,
+    0x24, 0x28, 0x8A, 0x4B, 0x2F, 0xD4, 0x4C, 0x37, 0xE3, 0x29, 0xE9, 0x24, 0x80, 0x88, 0xB5, 0x13,
+    0xB8, 0xF8, 0x6A, 0xD3, 0x60, 0x7D, 0x13, 0xA2, 0x7C, 0x44, 0xAB, 0x0D, 0xD4, 0x1E, 0x47, 0x28,
+    0xA4, 0xE2, 0xB2, 0xCE, 0x71, 0x17, 0x77, 0xEB, 0x25, 0x85, 0x3C, 0x3C, 0xF6, 0x15, 0x8A, 0xFA,
+    0xBF, 0xEA, 0xD1, 0xA7, 0x48, 0x15, 0x57, 0x0F, 0xA6, 0x10, 0x10, 0x40, 0xB7, 0xDE, 0x79, 0xF7,
+    0xEF, 0xEB, 0xB8, 0x40, 0x09, 0xEA, 0xAA, 0x46, 0x99, 0x06, 0xFD, 0xDF, 0x0A, 0x4B, 0x82, 0xC5,
+    0x29, 0x76, 0xE7, 0x03, 0x7D, 0xA6, 0x51, 0x2B, 0xEB, 0x12, 0x75, 0x59, 0x3D, 0x01, 0xFC, 0xCA,
+    0x3F, 0xF0, 0x12, 0x5E, 0xCC, 0xAF, 0x2D, 0xFB, 0xE7, 0xB0, 0x42, 0x6A, 0xF0, 0x58, 0xB9, 0xDB,
+    0xAB, 0x54, 0x33, 0xFF, 0x8B, 0x6F, 0x4E, 0x09, 0x1B, 0xFF, 0x34, 0x15, 0x4C, 0xD2, 0xB5, 0x68,
+    0xCE, 0xB8, 0xC6, 0xC5, 0xCB, 0xDF, 0x70, 0x17, 0x4D, 0xCB, 0xF3, 0xFC, 0xD8, 0xF8, 0xC3, 0xB1,
+    0x71, 0xD9, 0xAC, 0xC5, 0xB9, 0xAE, 0xDB, 0xFE, 0x64, 0x3C, 0xF1, 0xE8, 0x04, 0xD2, 0xE2, 0x03,
+    0xDF, 0xB6, 0xB4, 0x20, 0x0B, 0x27, 0xB0, 0xE7, 0x7A, 0x8F, 0x66, 0xF0, 0xE2, 0x9C, 0xF3, 0x49,
+    0x3E, 0x8F, 0xC8, 0xB2, 0x5A, 0x26, 0xF7, 0x6B, 0xE6, 0x0F, 0x40, 0x9C, 0xAE, 0x64, 0xC9, 0xD4,
+    0x58, 0x25, 0xAB, 0x23, 0x8D, 0xF6, 0x4E, 0x8D, 0xE9, 0x5B, 0x63, 0xC3, 0x65, 0xF2, 0x64, 0x14,
+    0x11, 0x3E, 0x03, 0xB6, 0x82, 0xA5, 0xFB, 0xB3, 0xB1, 0x94, 0x01, 0xB3, 0x41, 0x35, 0x2A, 0x80,
+    0x21, 0xC3, 0x37, 0xF6, 0xAE, 0xBF, 0xB3, 0xA7, 0xC1, 0xD8, 0xE7, 0x28, 0xB8, 0x2C, 0x69, 0xE0,
+    0xC8, 0xD5, 0xC3, 0xEA, 0x1C, 0x50, 0xE7, 0xC7, 0x91, 0xA6, 0xCE, 0x1F, 0xA3, 0xE1, 0xCE, 0x89,
+    0x13, 0xC4, 0xF6, 0x3D, 0xC5, 0x5F, 0x8F, 0x4E, 0xEB, 0x26, 0x1E, 0xB7, 0x80, 0x4B, 0xA4, 0x31,
+    0xBE, 0x8B, 0x8E, 0xFE, 0x23, 0x37, 0x65, 0x7F, 0xBC, 0x39, 0x83, 0xA9, 0x9A, 0x77, 0xB1, 0xC3,
+    0xB5, 0x96, 0x53, 0x25, 0x0A, 0x36, 0x4C, 0x83, 0x75, 0xF1, 0x85, 0xC1, 0x84, 0x2B, 0xC1, 0x22,
+    0x4D, 0xC6, 0x4D, 0x50, 0x31, 0x2C, 0xB4, 0x39, 0x25, 0x5D, 0x2B, 0x4A, 0x35, 0x54, 0x16, 0x55,
+    0xB6, 0x81, 0xB1, 0xF1, 0xD7, 0x31, 0x14, 0x07, 0x87, 0xE1, 0xE3, 0xC4, 0x69, 0xD0, 0xC0, 0x76,
+    0x4B, 0xCA, 0x8B, 0x61, 0xFD, 0x0A, 0xEC, 0x93, 0x76, 0x75, 0x86, 0x16, 0xA1, 0x1B, 0x14, 0x7A,
+    0x62, 0x24, 0x30, 0x39, 0xD7, 0xE7, 0xF9, 0x23, 0xDC, 0x5F, 0xE5, 0x21, 0xE3, 0xDD, 0xB8, 0xF0,
+    0xAC, 0x7E, 0x54, 0xFE, 0xF1, 0x69, 0xB3, 0xED, 0xDF, 0xEF, 0xAF, 0x45, 0xF8, 0xE0, 0xE0, 0xC0,
+    0x25, 0x90, 0xE9, 0x91, 0xF6, 0xC3, 0x3F, 0xF4, 0xF9, 0xFB, 0x67, 0x3E, 0xB1, 0xD8, 0x32, 0x0F,
+    0x0F, 0x9A, 0xE5, 0x78, 0x33, 0x13, 0xA2, 0x85, 0xC2, 0x0C, 0xD5, 0x11, 0x07, 0x8B, 0x7C, 0x55,
+    0xA6, 0xD6, 0xA3, 0xBB, 0xF9, 0xA2, 0x66, 0xB9, 0xB5, 0x9B, 0x60, 0xB5, 0x91, 0xA0, 0x39, 0x83,
+    0x39, 0x65, 0x22, 0x1C, 0x46, 0x63, 0xA0, 0x53, 0x18, 0xFB, 0x2F, 0xA7, 0x60, 0x8F, 0xF4, 0xD8,
+    0x8D, 0x96, 0xE1, 0xED, 0x80, 0xE5, 0x20, 0x7A, 0x07, 0x18, 0x0F, 0x59, 0x21, 0xE6, 0x03, 0x66,
+    0x4D, 0x28, 0x4E, 0x30, 0x68, 0xC2, 0x9A, 0x09, 0x83, 0x19, 0x48, 0x7B, 0xFA, 0x69, 0x26, 0x07,
+    0x32, 0xFB, 0xC6, 0xB0, 0x0E, 0xFB, 0x64, 0xCE, 0x40, 0xA5, 0x82, 0x59, 0xB2, 0xB3, 0xA5, 0x62,
+    0xEB, 0x8F, 0xF0, 0x21, 0xC3, 0xAA, 0x19, 0x0F, 0x81, 0x84, 0x22, 0x4C, 0x6E, 0xFC, 0xCB, 0x06,
+    0xC3, 0xA8, 0xA6, 0xF8, 0x07, 0xCE, 0x06, 0xDC, 0x37, 0x87, 0x51, 0xF5, 0x07, 0xA6, 0xF5, 0xF2,
+    0xE4, 0x1C, 0x82, 0xA0, 0xDF, 0xAD, 0xC6, 0x81, 0xF2, 0xB2, 0x04, 0x13, 0x7E, 0x28, 0x97, 0x79,
+    0xAD, 0x1C, 0xB9, 0x7E, 0xE3, 0x39, 0x07, 0xD8, 0xA2, 0xDC, 0x24, 0x8A, 0xB0, 0x7C, 0xEC, 0xE0,
+    0x12, 0x72, 0x98, 0xCA, 0xE4, 0xA5, 0x5D, 0xB5, 0x45, 0x8D, 0x7C, 0x46, 0xD6, 0xEC, 0x4F, 0x35,
+    0x30, 0xA6, 0xCC, 0x44, 0xE8, 0xFC, 0x13, 0x61, 0xB7, 0x67, 0x87, 0xF6, 0x87, 0x3B, 0xA7, 0xF7,
+    0x8B, 0xF8, 0x8F, 0x0E, 0x2F, 0x9E, 0x7E, 0x55, 0x0F, 0x10, 0x78, 0x24, 0x0F, 0x3D, 0xDB, 0x7C,
+    0xCF, 0x9C, 0xA6, 0x03, 0xCE, 0x9B, 0x37, 0x6A, 0x34, 0xAC, 0xD9, 0xC2, 0x27, 0x5E, 0xFD, 0xAD,
+    0x39, 0xDB, 0xE9, 0xAB, 0x47, 0x39, 0xF8, 0xF8, 0x75, 0x42, 0xFD, 0x3A, 0xA5, 0x20, 0x97, 0x4A,
+    0x8A, 0xF1, 0xFD, 0x90, 0x5F, 0xFF, 0x33, 0xD4, 0xC5, 0x79, 0x85, 0x5F, 0xFF, 0x8C, 0xB9, 0x68,
+    0x3E, 0xF8, 0xBF, 0xC0, 0x9D, 0x37, 0xD8, 0xC9, 0x8E, 0xB9, 0x0A, 0xF7, 0xF9, 0x2F, 0x2E, 0x5B,
+    0xEB, 0xEC, 0xB2, 0xFC, 0x81, 0xA7, 0x12, 0xD4, 0xB7, 0xBC, 0xEA, 0x1E, 0x3C, 0xCE, 0xA3, 0x58,
+    0xE1, 0xBD, 0x3A, 0x55, 0xF1, 0xE1, 0x30, 0x33, 0xBA, 0xE5, 0x92, 0x4B, 0xF2, 0xD0, 0x1F, 0xCC,
+    0xC3, 0x3C, 0x7F, 0xBB, 0x61, 0x2E, 0x5E, 0x5D, 0x73, 0xCC, 0x4F, 0xCD, 0x9D, 0x4B, 0xD3, 0xA4,
+    0xFE, 0x60, 0x9E, 0xEA, 0xF3, 0x66, 0x2E, 0x06, 0xF9, 0x83, 0xA9, 0x17, 0xCD, 0x5C, 0xA7, 0x62,
+    0x12, 0x1F, 0xA7, 0xAD, 0xE9, 0x3C, 0xA6, 0xFE, 0x94, 0xC7, 0x16, 0xE4, 0x63, 0x4B, 0xFE, 0xF4,
+    0xB0, 0xD0, 0xD6, 0xE1, 0x28, 0x6D, 0x82, 0x2A, 0xBD, 0x76, 0xCA, 0x9E, 0xEA, 0x8D, 0x0B, 0xF8,
+    0x60, 0x35, 0x13, 0xF3, 0x2D, 0x80, 0xFF, 0xF0, 0xBE, 0xE7, 0x6A, 0xCC, 0xE8, 0x79, 0x8D, 0x61,
+    0x16, 0x3C, 0x42, 0xAE, 0x9E, 0x71, 0xA4, 0x25, 0xCC, 0xEC, 0xF9, 0x91, 0x91, 0xDC, 0x83, 0x65,
+    0xF9, 0x77, 0x00, 0x9F, 0x9F, 0xA4, 0x0E, 0x8D, 0x05, 0x76, 0x39, 0x39, 0x46, 0x13, 0x7A, 0x6B,
+    0xE3, 0xBD, 0xC2, 0x69, 0xD8, 0xE1, 0xE0, 0xC7, 0x49, 0x6A, 0x5C, 0xFC, 0x23, 0x3F, 0x28, 0x8F,
+    0xE4, 0xFC, 0x85, 0xD3, 0x8A, 0x84, 0xD3, 0x2A, 0x38, 0xAF, 0xA5, 0xF7, 0x03, 0x7E, 0xCF, 0x5F,
+    0x31, 0x36, 0x66, 0xD9, 0x12, 0xF9, 0xC3, 0xDE, 0x4A, 0x05, 0xA5, 0xFC, 0xC8, 0x96, 0x7A, 0xE0,
+    0x0B, 0x84, 0x34, 0xDA, 0xB3, 0x66, 0x9D, 0xAA, 0xFC, 0x7A, 0x9D, 0x9E, 0xC2, 0x8D, 0xD4, 0x5E,
+    0x27, 0xA0, 0x88, 0xF6, 0xFC, 0x00, 0x27, 0x4F, 0xCC, 0x7B, 0x45, 0x87, 0xE2, 0x8C, 0xF3, 0xE5,
+    0x0C, 0x75, 0x18, 0x32, 0x8A, 0xDD, 0xF4, 0x0E, 0x59, 0x85, 0x09, 0xE5, 0xBA, 0xCF, 0xD9, 0x5B,
+    0xAF, 0xBC, 0x77, 0xFE, 0xE1, 0x3B, 0xE7, 0xF5, 0x64, 0xBF, 0x08, 0x23, 0xB4, 0xD6, 0x21, 0x8C,
+    0x86, 0xB9, 0x0C, 0xD6, 0x98, 0xA7, 0x96, 0xAF, 0xC1, 0x39, 0x0B, 0x31, 0x1C, 0x78, 0xEA, 0x32,
+    0x39, 0x0E, 0xE5, 0x06, 0xA9, 0xA8, 0x78, 0xBB, 0xE6, 0xBE, 0xB9, 0x41, 0x59, 0x1A, 0xC6, 0x95,
+    0x87, 0x40, 0xC4, 0x42, 0x55, 0xAC, 0x67, 0x50, 0x1E, 0x2B, 0xDE, 0xB5, 0x9C, 0xFB, 0xFE, 0x13,
+    0xC2, 0x9F, 0x23, 0xF8, 0xC3, 0xFE, 0xEC, 0xEF, 0x71, 0xFD, 0x4F, 0x58, 0xAF, 0xC8, 0x4E, 0xC7,
+    0x32, 0xC6, 0xA7, 0x75, 0x65, 0xB4, 0xF6, 0xCB, 0x5D, 0x94, 0x87, 0x48, 0x7A, 0xC4, 0x22, 0x0F,
+    0x09, 0x2C, 0x6B, 0x37, 0xE5, 0x54, 0x43, 0x60, 0x38, 0x02, 0xDC, 0x44, 0x99, 0xCC, 0x83, 0x81,
+    0x39, 0x7B, 0x23, 0xF0, 0x37, 0x01, 0x3E, 0x3B, 0xF7, 0xA2, 0x5C, 0xF2, 0xE2, 0x8F, 0xE5, 0xE2,
+    0x37, 0x10, 0xD4, 0xBB, 0x82, 0xC3, 0x33, 0x03, 0xF5, 0x45, 0x4C, 0x50, 0x78, 0x96, 0xE5, 0x41,
+    0xB1, 0x0E, 0x5E, 0x35, 0x8B, 0x13, 0x01, 0xFA, 0xC3, 0x90, 0xCE, 0x6F, 0x1C, 0x68, 0x6D, 0x44,
+    0xF3, 0xCA, 0x48, 0x4E, 0xDC, 0x1F, 0xE4, 0xA0, 0xCB, 0x86, 0x99, 0xE6, 0x5C, 0x2E, 0xCF, 0xCE,
+    0x36, 0xF0, 0x0F, 0x01, 0x78, 0xAE, 0x70, 0x66, 0x39, 0x4D, 0xCC, 0x27, 0x5D, 0xE0, 0xC7, 0x3E,
+    0xEB, 0x08, 0x18, 0x83, 0xC0, 0x61, 0xFE, 0x2C, 0x19, 0x53, 0x94, 0xDE, 0xD5, 0x8F, 0xCF, 0x9C,
+    0xC3, 0x9E, 0x3F, 0x18, 0x4E, 0x47, 0x20, 0x63, 0x3A, 0x8D, 0x7A, 0x0B, 0x1A, 0xC4, 0x7E, 0x76,
+    0x02, 0x7F, 0xB2, 0xAD, 0x87, 0xCC, 0xE6, 0xD4, 0x5D, 0xF2, 0xFE, 0xC6, 0x34, 0x05, 0x15, 0xB2,
+    0xF4, 0x2A, 0xFD, 0x5E, 0x8C, 0x3C, 0x22, 0x5B, 0x30, 0x73, 0x50, 0x61, 0xA6, 0x5E, 0x15, 0xD7,
+    0xF3, 0xDB, 0x04, 0x15, 0x96, 0x2E, 0x1D, 0x84, 0x80, 0x83, 0x71, 0x50, 0xC7, 0x84, 0xE7, 0x1F,
+    0x1E, 0xAB, 0x34, 0xF6, 0xE9, 0x3B, 0x65, 0x16, 0xDF, 0xD2, 0x9D, 0xCD, 0xCC, 0xF2, 0xB8, 0x37,
+    0xD3, 0x0E, 0x76, 0xFF, 0xB3, 0x60, 0x85, 0x2B, 0x23, 0xCA, 0x62, 0x15, 0xE0, 0xAE, 0x70, 0xC7,
+    0x77, 0xA0, 0xEA, 0x18, 0x13, 0x5A, 0x2A, 0x54, 0x55, 0xD3, 0xC1, 0x06, 0xDE, 0x2F, 0xA4, 0xE2,
+    0xE7, 0x70, 0xA2, 0x24, 0xF0, 0x35, 0x21, 0xBB, 0x78, 0x18, 0xED, 0xD7, 0xCE, 0x82, 0x7C, 0xEA,
+    0xFC, 0x7A, 0xD0, 0xA5, 0x6C, 0xBC, 0x04, 0xA1, 0x6A, 0xD1, 0x14, 0x6F, 0x79, 0x24, 0xD2, 0xF9,
+    0xE6, 0x94, 0x9C, 0x59, 0x34, 0x63, 0x7C, 0xF3, 0x5A, 0x72, 0xA6, 0xEC, 0x05, 0xBA, 0xA8, 0x7A,
+    0x07, 0x46, 0x49, 0x2A, 0x64, 0x04, 0x2B, 0x74, 0x23, 0x51, 0xEE, 0xB2, 0x1C, 0x96, 0x82, 0xAA,
+    0xA8, 0x46, 0xF9, 0xFB, 0x2A, 0xD2, 0x07, 0xD0, 0xA9, 0xB8, 0xC4, 0xD0, 0x58, 0x6B, 0x21, 0x71,
+    0x25, 0xF3, 0x9A, 0x27, 0x42, 0x18, 0xEE, 0x82, 0xD7, 0xEB, 0x87, 0x96, 0x70, 0x0B, 0x44, 0x22,
+    0xB8, 0xC8, 0xA6, 0xA2, 0xE6, 0x81, 0xEA, 0x78, 0x83, 0xC6, 0x28, 0x5D, 0x96, 0x06, 0xCF, 0xC8,
+    0x27, 0xFC, 0x41, 0x59, 0x73, 0xEC, 0x0F, 0x2A, 0xEE, 0x84, 0xDF, 0x19, 0xF4, 0x98, 0x3D, 0xA3,
+    0xEC, 0x73, 0x2E, 0x95, 0xE6, 0xC3, 0x07, 0xA9, 0x39, 0xB6, 0x3E, 0x33, 0x77, 0x0D, 0x52, 0x47,
+    0xB4, 0x6E, 0xD3, 0x0A, 0x36, 0x82, 0x8A, 0x56, 0xBC, 0xC1, 0x65, 0xFD, 0xFB, 0x48, 0x28, 0xA4,
+    0x96, 0x3E, 0x68, 0x59, 0x40, 0x76, 0x6C, 0x80, 0x6A, 0xA1, 0x91, 0x9B, 0xD6, 0x75, 0xBE, 0xC3,
+    0xC2, 0x21, 0x86, 0xAF, 0x3B, 0x6A, 0x52, 0x9A, 0x82, 0xED, 0xB5, 0x7E, 0xDD, 0x7A, 0x98, 0xFD,
+    0x9D, 0x1A, 0x71, 0x0D, 0x4F, 0x6C, 0x5C, 0x65, 0x1D, 0x3D, 0xB2, 0xCD, 0xF3, 0xCF, 0x9B, 0x62,
+    0xE5, 0xFF, 0xB6, 0xF9, 0x6C, 0x98, 0x26, 0x4D, 0x50, 0xD6, 0x66, 0x09, 0x8F, 0x2E, 0xCF, 0xA3,
+    0x84, 0xE6, 0x54, 0xB3, 0x4A, 0xEA, 0x43, 0x0D, 0x71, 0xF8, 0xAD, 0x46, 0x16, 0x28, 0xAB, 0xA4,
+    0x87, 0x38, 0xA5, 0x6F, 0xA2, 0xE6, 0xD6, 0x82, 0x87, 0x98, 0xC5, 0x81, 0x93, 0x3A, 0x81, 0x37,
+    0x55, 0xEE, 0xA3, 0x79, 0x59, 0x49, 0x23, 0xC3, 0x42, 0x3C, 0x62, 0xC3, 0x81, 0x2D, 0x51, 0xD5,
+    0xA4, 0xB7, 0xDA, 0x8F, 0xFE, 0x88, 0x4D, 0xE6, 0xEC, 0x6D, 0xF0, 0xE7, 0x8F, 0xE0, 0x3F, 0x34,
+    0x53, 0x76, 0xDE, 0x7B, 0xFA, 0xFC, 0x8A, 0x4D, 0x9F, 0x5F, 0x7B, 0x7B, 0x9F, 0xDF, 0x29, 0x5A,
+    0x59, 0x5C, 0xAD, 0x38, 0x01, 0x29, 0x82, 0xE3, 0xE5, 0x2E, 0x35, 0xAC, 0xAE, 0x5A, 0x30, 0x4E,
+    0xD3, 0x70, 0x4E, 0xAF, 0xA6, 0x89, 0x4F, 0x66, 0x20, 0xB3, 0xF1, 0xB0, 0x9D, 0x24, 0x7E, 0x10,
+    0x8A, 0x47, 0x4A, 0x4F, 0xC3, 0xBB, 0xF0, 0xF1, 0x7D, 0x5E, 0x74, 0xFF, 0x2B, 0xF2, 0x03, 0xBF,
+    0x69, 0x21, 0x52, 0x53, 0x72, 0x0B, 0x49, 0x89, 0x22, 0xA9, 0x42, 0xAC, 0xA1, 0x0F, 0xB6, 0xD5,
+    0xC5, 0xF7, 0xE4, 0xE7, 0xCF, 0x5B, 0xAD, 0x84, 0xEB, 0x69, 0x20, 0x46, 0xC0, 0x82, 0x00, 0xD8,
+    0xD4, 0xE0, 0xF4, 0x96, 0xEE, 0x62, 0x0F, 0xE6, 0x70, 0x21, 0xB4, 0xEA, 0x11, 0x86, 0xE9, 0xA8,
+    0x6F, 0x9A, 0x54, 0x6C, 0xCB, 0xC7, 0xD5, 0xCD, 0xFE, 0x84, 0x22, 0x1A, 0xBF, 0xEC, 0x1B, 0x9A,
+    0x28, 0xA4, 0x56, 0xBE, 0xB1, 0x7C, 0xDA, 0x1B, 0x2E, 0xAC, 0xC3, 0xC5, 0x74, 0xB8, 0x80, 0x8E,
+    0x44, 0xDD, 0xDF, 0x51, 0x3F, 0x87, 0x02, 0xB9, 0xF8, 0x1F, 0xB8, 0x0A, 0xCB, 0xB1, 0x52, 0x7A,
+    0x42, 0x96, 0x80, 0x4C, 0x7A, 0x8D, 0x9C, 0x72, 0x91, 0x23, 0x6E, 0xC6, 0x8C, 0x06, 0x2C, 0xCC,
+    0x12, 0xEC, 0x56, 0x04, 0x0F, 0xB5, 0x87, 0xDB, 0xB4, 0x01, 0xEC, 0x2B, 0x65, 0xF4, 0x32, 0xCC,
+    0x3A, 0x3B, 0x3E, 0xF8, 0xCA, 0x21, 0x4D, 0x21, 0xF4, 0x4E, 0x9F, 0xA3, 0xAE, 0xFA, 0x72, 0x3E,
+    0xA6, 0x4B, 0x8D, 0x01, 0x9F, 0x4F, 0xBB, 0x50, 0xCF, 0x9C, 0x22, 0x9B, 0x06, 0x7C, 0x32, 0x64,
+    0x34, 0x43, 0xA1, 0x9A, 0x92, 0x01, 0x9F, 0x6D, 0xE8, 0x22, 0x8D, 0xC8, 0x4B, 0xB3, 0x6A, 0xB6,
+    0x6D, 0xAB, 0x50, 0xE6, 0x6F, 0x81, 0x18, 0xD3, 0x62, 0x70, 0x51, 0x04, 0xA9, 0x46, 0x36, 0xD1,
+    0xC1, 0x76, 0x36, 0x9C, 0x9D, 0x2D, 0x25, 0xB9, 0x88, 0x7D, 0x8B, 0x5F, 0xB2, 0x6F, 0xE9, 0x12,
+    0xBC, 0xA5, 0x4B, 0xF0, 0x96, 0x2E, 0xC1, 0x5B, 0x87, 0x73, 0x81, 0x52, 0x57, 0xAF, 0x4A, 0x3E,
+    0xD4, 0xBA, 0xC9, 0x6F, 0x69, 0x79, 0xBA, 0xB7, 0x34, 0x3A, 0xE6, 0x2D, 0x9D, 0xE6, 0xB7, 0x36,
+    0xA6, 0xB9, 0xD4, 0x34, 0xC1, 0x92, 0xF6, 0x1C, 0xE5, 0xEA, 0xDA, 0x25, 0xE8, 0xDF, 0xA3, 0x9B,
+    0x43, 0xA3, 0x57, 0xB2, 0x32, 0x43, 0xC0, 0x7E, 0x23, 0x73, 0xB8, 0xFC, 0x15, 0xF8, 0x6E, 0x98,
+    0x57, 0x0B, 0xFB, 0xCD, 0x18, 0xF3, 0xF3, 0xCD, 0x7D, 0x42, 0xFA, 0x6D, 0x2F, 0xD5, 0x2E, 0x1D,
+    0x05, 0x39, 0x07, 0x9C, 0xBD, 0x3D, 0xCE, 0xDB, 0x37, 0x39, 0x6F, 0xDF, 0x64, 0x6C, 0xCB, 0x7F,
+    0x64, 0x15, 0x90, 0x94, 0x15, 0x8E, 0x4A, 0x06, 0x1C, 0xA3, 0xA6, 0x23, 0x9E, 0xB2, 0xB7, 0x52,
+    0x72, 0x54, 0x6A, 0x74, 0xC4, 0x48, 0x5A, 0xFC, 0x9C, 0xBD, 0x26, 0xA4, 0x28, 0x9F, 0x2F, 0xA7,
+    0x40, 0x53, 0xA5, 0x43, 0x25, 0x43, 0xA5, 0x42, 0x25, 0x42, 0xA5, 0x41, 0x57, 0x5F, 0x54, 0x33,
+    0xBE, 0x4B, 0x1D, 0x27, 0x99, 0x28, 0xC9, 0x4F, 0xA9, 0x4F, 0x89, 0xCF, 0x95, 0x58, 0xE0, 0x9C,
+    0x90, 0xF2, 0xF8, 0x74, 0xCB, 0x9E, 0xD8, 0xF5, 0xE0, 0xE7, 0x68, 0x2D, 0xF8, 0x59, 0xDD, 0x37,
+    0x05, 0xE5, 0x15, 0x11, 0x54, 0xF3, 0xB5, 0xE0, 0x67, 0x8F, 0xF9, 0x4F, 0x01, 0xC3, 0xE7, 0x4E,
+    0x4C, 0x6F, 0xD7, 0xFB, 0x39, 0xB4, 0xF8, 0x0B, 0x2A, 0xE4, 0x28, 0xBD, 0x15, 0x2E, 0x53, 0x88,
+    0xE1, 0xCA, 0xFD, 0x4C, 0x6F, 0x5E, 0xA1, 0xC1, 0x7D, 0x41, 0xA3, 0x35, 0x08, 0xBA, 0xE2, 0x2F,
+    0x58, 0xCA, 0xEF, 0x35, 0x44, 0x74, 0x37, 0xCF, 0x1D, 0xC2, 0x29, 0x5C, 0x3E, 0x72, 0x19, 0x16,
+    0xE6, 0xD4, 0x7C, 0x15, 0x61, 0x1E, 0x9A, 0xB6, 0x72, 0x56, 0xD1, 0xBE, 0x22, 0xE5, 0xCC, 0xDF,
+    0xA9, 0x66, 0x0B, 0xBD, 0xA7, 0xD4, 0xE4, 0xD9, 0x17, 0x2D, 0x8B, 0x9E, 0xBE, 0xA0, 0xD2, 0x4C,
+    0x5E, 0xD0, 0x60, 0x48, 0xAF, 0x80, 0xA7, 0x01, 0xE9, 0x1E, 0xB5, 0x12, 0xE3, 0xBC, 0xCF, 0x9E,
+    0x66, 0x4A, 0x2D, 0xB4, 0xA2, 0x0E, 0xEC, 0xDD, 0x19, 0x2B, 0x23, 0x38, 0x4D, 0x55, 0x13, 0x2B,
+    0x64, 0x31, 0xD3, 0x82, 0x62, 0x5C, 0x79, 0x45, 0x56, 0x37, 0xFC, 0x79, 0x89, 0x7E, 0x26, 0x7E,
+    0x7A, 0xA8, 0x5D, 0x7A, 0x4E, 0xD0, 0x8A, 0x4F, 0xFF, 0x76, 0x4D, 0xF4, 0x72, 0xAE, 0x5D, 0xD2,
+    0xDF, 0xAE, 0xF7, 0xAE, 0x67, 0xDA, 0x6B, 0x8D, 0x95, 0x19, 0x3B, 0x68, 0x5D, 0x07, 0xE9, 0xA1,
+    0x28, 0x63, 0x8A, 0x46, 0x6D, 0xC0, 0x2A, 0x27, 0x9D, 0x27, 0xA7, 0x0B, 0xAA, 0x61, 0x21, 0x9E,
+    0x87, 0x08, 0xD9, 0x8D, 0xF1, 0xA0, 0xA5, 0x53, 0xFB, 0xBB, 0x42, 0xEF, 0xEC, 0x3E, 0xDB, 0xEB,
+    0xF9, 0xDD, 0x6B, 0x58, 0x59, 0xFF, 0x7E, 0xEE, 0x42, 0x84, 0x89, 0x8A, 0x06, 0xB3, 0xD9, 0x33,
+    0x3D, 0xAD, 0x15, 0x8D, 0x2F, 0x73, 0x70, 0xE8, 0x87, 0x1B, 0xE8, 0x5B, 0x0E, 0x09, 0x2D, 0x14,
+    0xDC, 0x3D, 0x02, 0xD5, 0x8F, 0xBB, 0x80, 0x14, 0x05, 0xAA, 0x51, 0x37, 0xE3, 0x31, 0x38, 0xC6,
+    0x38, 0x0E, 0x77, 0xB8, 0x06, 0x10, 0x7A, 0x08, 0x77, 0xE7, 0x74, 0xFF, 0xB9, 0x36, 0x34, 0x1D,
+    0xB0, 0x63, 0x07, 0xB7, 0x40, 0x1D, 0xCD, 0x38, 0x2A, 0xB2, 0x0E, 0x39, 0xB5, 0x4F, 0xB7, 0x6E,
+    0xE8, 0x47, 0xF1, 0x65, 0x87, 0xBF, 0x36, 0xCE, 0xD0, 0x71, 0xAC, 0x13, 0x6F, 0xD6, 0xE2, 0xA0,
+    0x2E, 0x6D, 0xBD, 0xEE, 0xEE, 0xB0, 0x5B, 0x83, 0x71, 0x11, 0x26, 0xCC, 0xF1, 0xDA, 0x56, 0x11,
+    0xE8, 0x35, 0x1C, 0xBC, 0x4E, 0xA7, 0xC5, 0xA1, 0x43, 0x45, 0xCF, 0x29, 0x32, 0x13, 0xE2, 0xFE,
+    0x99, 0xD0, 0xE6, 0xDF, 0xB6, 0x20, 0x9D, 0x64, 0x37, 0xCB, 0x23, 0xD2, 0x12, 0x4E, 0x8D, 0x2B,
+    0x24, 0x6C, 0x5D, 0x68, 0x66, 0x35, 0x66, 0xFD, 0xA2, 0xD5, 0xDD, 0xE3, 0x96, 0x0A, 0xA6, 0x63,
+    0x21, 0x5D, 0xF7, 0xD7, 0xA5, 0x3B, 0x8D, 0xA3, 0x6E, 0x2C, 0x3B, 0x15, 0xD1, 0xD3, 0xE0, 0x5A,
+    0x8E, 0x94, 0xA3, 0xCE, 0xA8, 0x02, 0x8D, 0xD6, 0x72, 0x6A, 0xA9, 0xFA, 0xEF, 0x5A, 0x1E, 0x15,
+    0x05, 0x3A, 0x1B, 0x51, 0xA1, 0x95, 0x35, 0x3C, 0xE7, 0xD6, 0x66, 0x15, 0xFB, 0xB9, 0x25, 0xEA,
+    0xA8, 0x33, 0x83, 0x2E, 0x9B, 0x31, 0xAD, 0x19, 0xAE, 0x80, 0xD5, 0xE8, 0x45, 0xD7, 0xD0, 0x55,
+    0x57, 0x65, 0x6A, 0xB4, 0xC2, 0x98, 0xB5, 0x80, 0xE0, 0x31, 0x3F, 0x78, 0xC4, 0x4B, 0x48, 0x55,
+    0x77, 0x4C, 0xA2, 0x39, 0x8E, 0xAD, 0x9E, 0xF9, 0xA1, 0x06, 0x05, 0xCB, 0xE7, 0x4B, 0x97, 0x4C,
+    0x63, 0x5C, 0x12, 0x8D, 0x06, 0xC8, 0x84, 0x9D, 0x7A, 0xD9, 0x99, 0x01, 0x2E, 0xCB, 0x8A, 0xAD,
+    0x2D, 0xCC, 0xB9, 0x45, 0xED, 0x45, 0xC1, 0x88, 0x78, 0x71, 0xD1, 0x0D, 0x66, 0x13, 0x5F, 0xA6,
+    0xB1, 0x1E, 0x6F, 0x23, 0xE0, 0x70, 0x16, 0x9D, 0x71, 0xD9, 0x0D, 0x5A, 0x00, 0x00, 0x76, 0x2C,
+    0xA3, 0xDA, 0xC3, 0x9A, 0x71, 0xBA, 0x18, 0xE3, 0x1A, 0x59, 0x1E, 0xB2, 0x35, 0x5F, 0x9D, 0xE2,
+    0x12, 0xF0, 0xAD, 0x5D, 0xBA, 0x1B, 0x10, 0x4B, 0xCB, 0x7A, 0x44, 0x5C, 0x34, 0xFB, 0x26, 0x1C,
+    0xBE, 0x60, 0x98, 0x4C, 0xFE, 0x45, 0xD5, 0x13, 0x04, 0x01, 0xA2, 0xD6, 0xD1, 0x72, 0x46, 0xF5,
+    0x88, 0x5A, 0xFD, 0xB0, 0xE5, 0x25, 0x28, 0x28, 0xF4, 0xA4, 0x66, 0xEA, 0xBD, 0xC0, 0x24, 0x1C,
+    0x39, 0x58, 0xC1, 0x64, 0x8A, 0x9F, 0x31, 0x48, 0x80, 0x55, 0x62, 0x8B, 0x3A, 0x62, 0x48, 0x29,
+    0x9C, 0x3F, 0x8F, 0x68, 0x81, 0x5B, 0xB0, 0xE4, 0x2F, 0x9D, 0x71, 0xB1, 0x10, 0x8F, 0xCE, 0x8B,
+    0x4B, 0xF1, 0x1A, 0x7F, 0xD5, 0xB5, 0xD7, 0x95, 0x8D, 0x64, 0xF2, 0x50, 0xD0, 0x27, 0x7A, 0xB7,
+    0x43, 0x74, 0xDF, 0x4F, 0x91, 0x5E, 0x5A, 0xBC, 0x0E, 0x68, 0x5F, 0xC7, 0x1B, 0x37, 0xE4, 0x14,
+    0xCF, 0xD9, 0xCE, 0x93, 0x5A, 0x3E, 0x47, 0x59, 0x95, 0xD7, 0x19, 0x11, 0xF8, 0x0B, 0xC8, 0xBC,
+    0xD1, 0x6F, 0x20, 0x4E, 0x04, 0xAC, 0x3C, 0xF0, 0xAE, 0xAD, 0x1F, 0xA1, 0xAE, 0x25, 0x4F, 0x78,
+    0xD4, 0x95, 0x70, 0xB9, 0x1F, 0x8E, 0x9D, 0x60, 0xC1, 0x3A, 0x96, 0xC5, 0xCD, 0x2F, 0xF7, 0x1A,
+    0x24, 0xB5, 0xE0, 0xAE, 0x0A, 0xAB, 0xD1, 0x4E, 0x47, 0xB7, 0x37, 0xCD, 0xD2, 0x04, 0x7F, 0xBE,
+    0x9A, 0xDF, 0x48, 0x61, 0x3E, 0x80, 0x63, 0xE7, 0x13, 0xD1, 0x9C, 0x1D, 0xB8, 0x62, 0x08, 0x3A,
+    0xD9, 0x73, 0xEB, 0xCC, 0xDD, 0xCF, 0xAB, 0xCD, 0xF8, 0xDF, 0xF4, 0x53, 0xB9, 0x7E, 0xEE, 0x86,
+    0x92, 0x55, 0x0E, 0xAB, 0x42, 0x44, 0xDA, 0x67, 0xAB, 0x43, 0xC4, 0x76, 0x11, 0xFA, 0xD5, 0x65,
+    0xC2, 0xAF, 0xE1, 0xC5, 0x43, 0x17, 0xA7, 0x0A, 0x00, 0xF7, 0x16, 0x3A, 0xD6, 0x96, 0xCF, 0xB6,
+    0xB0, 0x6C, 0xCD, 0x76, 0xA9, 0x76, 0xEA, 0xE5, 0x1A, 0xF4, 0x47, 0x38, 0x19, 0xA5, 0x9A, 0x44,
+    0x96, 0xAF, 0xB9, 0xE0, 0x5B, 0x4F, 0x0B, 0x56, 0xEC, 0xDF, 0x55, 0xAD, 0x0A, 0x5F, 0x6B, 0x55,
+    0xA4, 0x6E, 0x73, 0x69, 0xB2, 0x08, 0x75, 0x64, 0x7D, 0x27, 0xC8, 0x0C, 0x0E, 0xD7, 0x00, 0x4F,
+    0x02, 0x7D, 0xF1, 0x4E, 0x37, 0x96, 0x2F, 0xCD, 0x4D, 0xCC, 0xF2, 0xA5, 0x5A, 0x5F, 0xF9, 0x2C,
+    0x53, 0xC5, 0x0F, 0xB9, 0x2A, 0xAC, 0xB8, 0xCB, 0xF7, 0x56, 0xF4, 0x3E, 0xF3, 0x50, 0x03, 0xEA,
+    0x92, 0x5F, 0xA4, 0x19, 0xE3, 0x12, 0xA7, 0xA1, 0x9F, 0xCB, 0x6C, 0xAA, 0xDB, 0xFE, 0xCE, 0x30,
+    0x6B, 0x35, 0xC6, 0x43, 0x03, 0xB8, 0x1B, 0xC3, 0xF3, 0xD5, 0x41, 0x44, 0x3A, 0xCD, 0x59, 0x59,
+    0xD0, 0x34, 0x70, 0xC0, 0xD0, 0xC5, 0xA7, 0xF1, 0x4E, 0xCC, 0xCD, 0xAA, 0xE6, 0xDC, 0xAC, 0xA4,
+    0x61, 0x6E, 0x16, 0xE3, 0x9D, 0xC2, 0xB5, 0x78, 0xA7, 0xE5, 0x5A, 0xBC, 0xD3, 0x62, 0x23, 0xDE,
+    0x69, 0x3B, 0xF4, 0x1C, 0xB3, 0x52, 0x73, 0xF2, 0x30, 0xC2, 0x0F, 0x73, 0xAE, 0xE8, 0x7E, 0xD6,
+    0x3A, 0x02, 0xDF, 0x28, 0x6E, 0x7D, 0xEF, 0x41, 0x9A, 0xAB, 0x85, 0xE6, 0x41, 0xB2, 0x04, 0xF1,
+    0x01, 0xF5, 0x82, 0x13, 0xCC, 0xD5, 0x89, 0x0A, 0xB6, 0xF6, 0x5B, 0x0B, 0xB6, 0xFE, 0xFD, 0x07,
+    0x2B, 0xD8, 0x9A, 0x1C, 0x2B, 0xD8, 0xBA, 0xD8, 0x52, 0xB0, 0x35, 0xD5, 0x82, 0xAD, 0x7A, 0xC2,
+    0x66, 0x77, 0x50, 0xBE, 0x83, 0x0D, 0xB4, 0x44, 0xA5, 0x11, 0x6A, 0xF0, 0x7D, 0xB6, 0x5E, 0x6F,
+    0xA4, 0x64, 0xBD, 0x91, 0x74, 0xAC, 0x37, 0xB2, 0x74, 0x2F, 0x0D, 0x38, 0x5A, 0x6F, 0x64, 0xC1,
+    0x4D, 0x19, 0xB0, 0xDE, 0x48, 0x44, 0x9B, 0x3F, 0x0D, 0xB4, 0x86, 0xE1, 0x07, 0x3E, 0xEB, 0x8D,
+    0x64, 0xA2, 0x04, 0x08, 0x07, 0x63, 0xBD, 0x11, 0x8E, 0xFC, 0x44, 0xDA, 0x37, 0xB8, 0x5F, 0x17,
+    0xCB, 0xC4, 0x17, 0xCE, 0x1A, 0x6C, 0x8A, 0x73, 0xF6, 0xBF, 0x75, 0xD0, 0xE0, 0x51, 0x72, 0xFC,
+    0x10, 0xAB, 0x84, 0xC6, 0x3E, 0x1A, 0x97, 0xC7, 0xC6, 0xD7, 0xA4, 0xF1, 0x59, 0x4F, 0xED, 0x41,
+    0xA9, 0x79, 0x00, 0x1A, 0x2E, 0x29, 0x60, 0xAD, 0xE1, 0x4A, 0x88, 0x4F, 0x0E, 0xA9, 0x63, 0xC1,
+    0x66, 0xD1, 0xB1, 0x46, 0x38, 0x37, 0xC0, 0x55, 0x03, 0xAA, 0xBE, 0x0E, 0x87, 0x1D, 0x4B, 0xCE,
+    0x5D, 0x40, 0x40, 0x9C, 0x3C, 0x70, 0x3F, 0xEC, 0xC2, 0x75, 0x6C, 0x5C, 0x5E, 0xC1, 0x07, 0xC6,
+    0x14, 0x28, 0xEB, 0x31, 0x0D, 0x40, 0xB3, 0xAF, 0x27, 0x79, 0x6E, 0xC4, 0xCE, 0xE6, 0xC3, 0x2D,
+    0xB1, 0x46, 0x7F, 0x93, 0xA1, 0x67, 0xC6, 0x19, 0x42, 0xFF, 0x51, 0x83, 0xA5, 0xD7, 0xEA, 0xBB,
+    0x95, 0xE1, 0x49, 0xCC, 0x88, 0x3F, 0x90, 0xD1, 0x7B, 0xA2, 0x52, 0x2B, 0xAB, 0x96, 0xA3, 0xCC,
+    0x4B, 0xB4, 0xF2, 0x5C, 0x09, 0x12, 0xA0, 0xC8, 0xC9, 0x36, 0x07, 0xDF, 0xCD, 0x5C, 0x69, 0xDD,
+    0xF7, 0x46, 0xC5, 0xD1, 0xEA, 0xBB, 0x6B, 0xA9, 0xC0, 0x93, 0x17, 0x7B, 0x5B, 0x3D, 0x61, 0x87,
+    0x16, 0xE5, 0x5A, 0xDD, 0xB4, 0x26, 0x40, 0x2D, 0x8A, 0xF9, 0x1D, 0x31, 0xC1, 0x76, 0x98, 0xC6,
+    0x60, 0x27, 0xEF, 0x6A, 0xE8, 0xC8, 0x8F, 0x11, 0x4E, 0xDD, 0x6E, 0xD4, 0x4A, 0x59, 0x83, 0xA1,
+    0x06, 0xA6, 0x58, 0x46, 0xFD, 0xA9, 0xC0, 0x19, 0xB4, 0xF3, 0xDB, 0xA3, 0xD4, 0x97, 0x6E, 0xB6,
+    0xC0, 0xF7, 0x53, 0xEC, 0x38, 0x25, 0x7A, 0xA1, 0x9E, 0x91, 0x67, 0x5F, 0x57, 0xF4, 0x13, 0xE6,
+    0x09, 0xD9, 0x9B, 0xBF, 0xDE, 0x52, 0xEC, 0xF8, 0xCB, 0x2A, 0x40, 0x7B, 0xF5, 0xED, 0x91, 0x49,
+    0x6F, 0x57, 0xEC, 0xF8, 0x64, 0xF5, 0x7F, 0xA2, 0x35, 0xF8, 0x2C, 0xD3, 0xD5, 0xED, 0x5A, 0xFD,
+    0x1F, 0xCB, 0xFA, 0x3F, 0x51, 0x3C, 0xC3, 0x7F, 0xB5, 0xB5, 0xFE, 0x8F, 0x63, 0x96, 0x0E, 0xB9,
+    0x22, 0xAF, 0xC7, 0x5E, 0x15, 0xB9, 0x15, 0x8D, 0xEF, 0x8F, 0x1C, 0x75, 0x5D, 0x6C, 0xF4, 0xE1,
+    0x2B, 0xFA, 0xEE, 0x21, 0xBE, 0x11, 0x6D, 0xED, 0x55, 0x91, 0xFA, 0x02, 0xA3, 0xF8, 0x84, 0xA8,
+    0x76, 0xF6, 0xBD, 0xA7, 0xB5, 0x24, 0xFC, 0x17, 0x05, 0xDD, 0xD9, 0xBA, 0x75, 0x04, 0x6E, 0x24,
+    0xF5, 0x37, 0x73, 0x52, 0x7F, 0xF2, 0xC1, 0x92, 0xFA, 0xC7, 0x24, 0xEB, 0x32, 0x9C, 0xAD, 0x5B,
+    0x2E, 0xB5, 0x7F, 0x2E, 0x99, 0xA1, 0xB3, 0xAB, 0xC5, 0x3D, 0xA8, 0x1B, 0x66, 0xF5, 0x18, 0xBB,
+    0xC4, 0xB4, 0x39, 0xEC, 0xDC, 0x87, 0x18, 0x0B, 0xD0, 0x24, 0x7C, 0x87, 0xC1, 0xEA, 0x4A, 0x40,
+    0x54, 0x10, 0xB5, 0xD9, 0xCB, 0x44, 0xB1, 0xE6, 0xD3, 0x2D, 0x0A, 0xF5, 0xBF, 0xB8, 0x74, 0x54,
+    0x97, 0x8C, 0xEA, 0x90, 0x53, 0x3D, 0x9D, 0x56, 0xBA, 0x70, 0xFB, 0x14, 0x0B, 0xF0, 0x55, 0x4A,
+    0x15, 0x38, 0x7F, 0x91, 0x87, 0x5A, 0x69, 0x52, 0x66, 0xEE, 0x0C, 0xA4, 0x73, 0x06, 0xEA, 0x27,
+    0xF5, 0x66, 0xFA, 0x2E, 0x4B, 0xAA, 0xD2, 0xB9, 0xCD, 0x1F, 0x47, 0x25, 0xB0, 0xF2, 0x79, 0x51,
+    0x59, 0xB3, 0xFA, 0x4A, 0x80, 0xEA, 0x39, 0x05, 0xF5, 0xC4, 0xE4, 0xBA, 0x3D, 0x28, 0x1A, 0x97,
+    0x55, 0xF6, 0xEC, 0xB0, 0xBB, 0x7B, 0xDE, 0x69, 0x43, 0x61, 0x6F, 0xA6, 0x30, 0x0F, 0x74, 0x09,
+    0xC5, 0x29, 0x72, 0x04, 0xDF, 0xD8, 0xAB, 0x51, 0xE9, 0x1C, 0x85, 0xF2, 0x94, 0x9B, 0x1B, 0x9A,
+    0x95, 0xCE, 0x56, 0x6E, 0xA6, 0x3D, 0x1C, 0xB5, 0x81, 0xCE, 0x16, 0xCF, 0x4F, 0x4D, 0xED, 0x85,
+    0x1B, 0xAE, 0xA8, 0x39, 0x5B, 0xD9, 0x49, 0x66, 0xEB, 0xF4, 0xFB, 0x9B, 0xAD, 0xCF, 0x4C, 0xB3,
+    0x15, 0xD9, 0x97, 0x2E, 0xB9, 0xD9, 0x4A, 0x67, 0x0D, 0xDD, 0x45, 0x34, 0x8F, 0x21, 0xF1, 0xDD,
+    0x06, 0xBA, 0xBC, 0x05, 0x7D, 0x98, 0xF3, 0x0A, 0x52, 0xBA, 0xFA, 0x6C, 0x39, 0x6E, 0xD9, 0xC0,
+    0xF6, 0xF3, 0xBE, 0xCD, 0xD6, 0x2A, 0x13, 0xC4, 0x6B, 0xA7, 0xE7, 0x04, 0x5D, 0xBD, 0xDF, 0x74,
+    0xE1, 0x5E, 0xEF, 0x7A, 0x2F, 0x7E, 0x3C, 0x0D, 0x92, 0x48, 0x1D, 0x0B, 0x79, 0xC4, 0x05, 0x4B,
+    0x79, 0xAD, 0x63, 0xC4, 0x7E, 0x37, 0xBE, 0xBC, 0xB0, 0x1F, 0x5D, 0x7B, 0x53, 0x2D, 0xC6, 0xC7,
+    0x6E, 0xA5, 0x5B, 0x63, 0x89, 0x7E, 0x7F, 0x5F, 0x02, 0xE5, 0xB9, 0x42, 0xC3, 0x89, 0x5B, 0xA6,
+    0x2C, 0x4D, 0x72, 0x55, 0x2A, 0xF5, 0x8D, 0xC9, 0xB1, 0x4B, 0xCD, 0xF0, 0x8A, 0x6D, 0x91, 0x79,
+    0x0F, 0x5A, 0xC5, 0xD9, 0xDB, 0xF9, 0x40, 0x9C, 0x3B, 0x4E, 0xBD, 0x71, 0xDB, 0x7C, 0x20, 0x74,
+    0x1B, 0xBD, 0x41, 0xEF, 0x8F, 0xBE, 0xB5, 0x44, 0xDF, 0x59, 0x57, 0xEE, 0xF5, 0x9A, 0x6A, 0x9F,
+    0xBA, 0xAC, 0x7A, 0xCB, 0xA8, 0x62, 0x15, 0x70, 0x34, 0x8C, 0x6A, 0x82, 0xB1, 0x73, 0xEC, 0xE3,
+    0xE9, 0x0A, 0x9D, 0x33, 0x7F, 0x75, 0xB7, 0x2E, 0xFD, 0x23, 0xFE, 0xB7, 0x25, 0xDC, 0x04, 0x65,
+    0xF4, 0x32, 0x1C, 0xF7, 0x3B, 0x4B, 0xB3, 0xD5, 0x1F, 0x52, 0xCD, 0xF5, 0xE2, 0xAF, 0x59, 0xAD,
+    0x94, 0xC6, 0xF3, 0x81, 0x69, 0x6E, 0xA9, 0xD6, 0x95, 0xD3, 0xFF, 0x69, 0xBD, 0xC1, 0x58, 0x78,
+    0x7F, 0x07, 0xA7, 0xBA, 0x5C, 0x38, 0xB2, 0x02, 0x66, 0xAC, 0x24, 0xB4, 0xB1, 0x26, 0x25, 0x5F,
+    0x76, 0x43, 0x33, 0x4A, 0xC8, 0x1E, 0x7A, 0xA4, 0x9A, 0x07, 0xFC, 0x55, 0x4C, 0xB9, 0xBE, 0x8A,
+    0x29, 0x3D, 0xB5, 0x26, 0xA8, 0xC7, 0x2E, 0xA4, 0x52, 0xD1, 0x85, 0x75, 0xA6, 0xE9, 0x39, 0x86,
+    0xD0, 0x9A, 0xFB, 0x52, 0xEE, 0x36, 0x65, 0xB9, 0xDB, 0xF4, 0xA1, 0x89, 0x13, 0x26, 0x6B, 0x3D,
+    0x7B, 0x6D, 0xEE, 0x97, 0x76, 0x4B, 0x7A, 0xF5, 0x80, 0x7A, 0x60, 0xC2, 0x5E, 0x9D, 0x9E, 0xDD,
+    0x88, 0xD6, 0x4B, 0x68, 0x0A, 0x3A, 0x9D, 0xD2, 0xDE, 0x1C, 0xF2, 0x65, 0x1C, 0x26, 0xAA, 0x74,
+    0x0A, 0x59, 0xE0, 0xC7, 0x95, 0x19, 0x1C, 0x1D, 0x54, 0x1A, 0x16, 0x99, 0xD1, 0x6B, 0xA0, 0xFF,
+    0x2F, 0x29, 0x6A, 0x4E, 0xB4, 0x7B, 0x0C, 0xE6, 0xF4, 0xD3, 0x60, 0x99, 0x46, 0x78, 0xBB, 0x2B,
+    0x5D, 0x15, 0x59, 0x9F, 0xC5, 0x8B, 0x7C, 0xE7, 0x33, 0x9D, 0x8B, 0xC4, 0xBA, 0xBA, 0x25, 0x28,
+    0x31, 0x80, 0xE0, 0x41, 0xE9, 0x2D, 0xB3, 0x7E, 0x1B, 0xA4, 0xC9, 0x06, 0xEE, 0x7D, 0xC4, 0x3C,
+    0x48, 0x4E, 0xA5, 0xC6, 0x3C, 0xE8, 0xAE, 0xB0, 0xD6, 0xA1, 0x75, 0xE7, 0x97, 0xB7, 0xED, 0x55,
+    0xA4, 0xC1, 0x46, 0xFC, 0x66, 0x5C, 0xDE, 0x97, 0xB2, 0xC7, 0x6B, 0x11, 0x98, 0x8B, 0xB5, 0x08,
+    0xCC, 0x60, 0x2D, 0x02, 0x53, 0x23, 0x49, 0x13, 0x17, 0x81, 0x79, 0x7F, 0xF4, 0x51, 0xFA, 0x67,
+    0x0F, 0x2E, 0xDE, 0xAD, 0x3E, 0x1A, 0xA9, 0x82, 0x14, 0x3B, 0x54, 0xAF, 0x87, 0xC0, 0xC6, 0x66,
+    0x0B, 0x7A, 0x7C, 0x46, 0xF7, 0x42, 0x1F, 0xBD, 0xB9, 0x45, 0x13, 0xDD, 0xD0, 0x47, 0x9B, 0xB1,
+    0x76, 0xAD, 0xDF, 0xCF, 0x7E, 0x47, 0x7F, 0x6D, 0xE2, 0x37, 0x20, 0x63, 0xF5, 0x98, 0xA7, 0xD3,
+    0xD2, 0x27, 0x21, 0x60, 0xA1, 0xA1, 0x72, 0x29, 0xD3, 0x58, 0x10, 0x92, 0x80, 0x02, 0x15, 0x28,
+    0x31, 0xF0, 0xAE, 0x1C, 0x23, 0xBF, 0x13, 0x7C, 0x53, 0xE4, 0xBF, 0x5F, 0x09, 0x6E, 0x65, 0x71,
+    0xFE, 0x8E, 0xB8, 0x5A, 0xFE, 0x08, 0x38, 0xAB, 0x03, 0x14, 0x3F, 0x69, 0x93, 0x26, 0x7C, 0x0A,
+    0x38, 0x5E, 0x45, 0xD8, 0x61, 0x6D, 0xD4, 0x3D, 0x4E, 0x1C, 0x76, 0x67, 0x89, 0x83, 0x7E, 0x9F,
+    0x78, 0x69, 0x2F, 0x13, 0x8B, 0x6C, 0x42, 0x8C, 0x70, 0x09, 0x60, 0x21, 0x6E, 0x62, 0x04, 0x94,
+    0x12, 0x17, 0x90, 0x69, 0x50, 0x37, 0x37, 0x0F, 0x61, 0x6E, 0x29, 0xDD, 0x1B, 0xEB, 0xCA, 0xD8,
+    0x85, 0x93, 0xAE, 0xD7, 0x42, 0x1D, 0xA3, 0xB4, 0xDA, 0x8D, 0xAC, 0xBF, 0x29, 0xA7, 0x72, 0xE9,
+    0x70, 0x58, 0xBB, 0x8A, 0xE3, 0xC6, 0x95, 0x1C, 0x37, 0xAE, 0xE6, 0xB8, 0x71, 0x45, 0xC7, 0x8D,
+    0xAB, 0x3A, 0x6E, 0x5C, 0xD9, 0x71, 0xE3, 0xEA, 0x8E, 0x1B, 0x57, 0x78, 0xDC, 0xB8, 0xCA, 0xE3,
+    0xC6, 0x95, 0x1E, 0x37, 0xAE, 0xF6, 0xB8, 0x71, 0xC5, 0xC7, 0x8D, 0xAB, 0x3E, 0x6E, 0x5C, 0xF9,
+    0x71, 0xE3, 0xEA, 0x8F, 0x1B, 0x57, 0x80, 0xDC, 0x68, 0x05, 0x72, 0x70, 0x26, 0x96, 0x20, 0x37,
+    0x1B, 0x07, 0xD5, 0x54, 0x1A, 0xF3, 0x70, 0x33, 0x0A, 0x6D, 0xCC, 0x12, 0xF5, 0x57, 0xD3, 0x70,
+    0x3E, 0x7C, 0x69, 0xFA, 0x11, 0xBE, 0xF5, 0xCB, 0xD7, 0xF4, 0xE5, 0xA5, 0xC6, 0xB9, 0xFB, 0x5D,
+    0xB0, 0x5A, 0xE3, 0xE4, 0x67, 0x6E, 0x6D, 0xCB, 0xC8, 0xE8, 0xCC, 0x4C, 0x9F, 0xB3, 0x79, 0x55,
+    0xC7, 0xA9, 0xDA, 0xCC, 0xA1, 0x2A, 0x40, 0xAD, 0xDA, 0xCD, 0x57, 0xEA, 0xD7, 0x53, 0xAB, 0x85,
+    0x5F, 0x53, 0x86, 0x5A, 0x96, 0x4C, 0x39, 0x0A, 0x4A, 0xAD, 0x57, 0x99, 0xF3, 0x6E, 0x91, 0x2A,
+    0x24, 0xEE, 0x5D, 0xC7, 0x89, 0x2A, 0x4A, 0xAF, 0xA9, 0x3A, 0xA5, 0x46, 0x32, 0x6F, 0xA5, 0x36,
+    0x32, 0x75, 0xFC, 0xF8, 0xEA, 0xF7, 0x81, 0xBC, 0xCE, 0x37, 0xF9, 0xE6, 0xFA, 0x26, 0xC1, 0x92,
+    0xE6, 0x0E, 0xE8, 0x0A, 0x8B, 0x95, 0x10, 0x8A, 0x8F, 0x97, 0x7B, 0xFA, 0x7D, 0x80, 0x88, 0x41,
+    0x4C, 0xE6, 0xAC, 0x17, 0xE0, 0xA0, 0x62, 0xCA, 0xE8, 0x92, 0x8A, 0x1D, 0xBC, 0x5F, 0x21, 0xEA,
+    0xDA, 0x2C, 0x49, 0xB0, 0x8F, 0x2C, 0xC7, 0x72, 0xDE, 0x9F, 0xFA, 0xBE, 0x9E, 0x4C, 0xC2, 0x9B,
+    0x9F, 0xB2, 0xEE, 0xCD, 0x30, 0x94, 0xD0, 0x6B, 0x02, 0x06, 0xE7, 0x81, 0x84, 0x57, 0x19, 0x62,
+    0xB4, 0x7E, 0x03, 0x85, 0xE2, 0x05, 0x79, 0xD2, 0x27, 0xD7, 0x53, 0x42, 0x5A, 0x72, 0x46, 0xD6,
+    0x27, 0x9D, 0xD0, 0xA2, 0x0B, 0xEB, 0xDB, 0x27, 0xBE, 0x7C, 0x3C, 0xA6, 0x59, 0xC9, 0x58, 0x08,
+    0x76, 0x31, 0x08, 0xE9, 0x2C, 0x06, 0x94, 0x1D, 0xEC, 0x96, 0xCD, 0xD1, 0xD4, 0xA1, 0x0F, 0x7D,
+    0x9A, 0x97, 0xA3, 0xC6, 0xB5, 0x9C, 0x4A, 0x2B, 0x5F, 0xB1, 0xF9, 0x69, 0x36, 0x7E, 0x2B, 0xD3,
+    0x45, 0xA7, 0xD6, 0xBF, 0x48, 0x83, 0x9A, 0xCB, 0x4F, 0x5D, 0x23, 0x78, 0x43, 0x1A, 0xB8, 0x41,
+    0xF8, 0x05, 0xE7, 0x55, 0xD6, 0xE2, 0x4E, 0x88, 0x9D, 0x1C, 0x1B, 0xC2, 0x3A, 0xDF, 0xDE, 0xE5,
+    0x04, 0xBB, 0xE4, 0x46, 0xD4, 0xCB, 0xBA, 0x76, 0x80, 0x64, 0xFC, 0xD2, 0x5D, 0x13, 0x5E, 0xFB,
+    0xFE, 0x58, 0xD6, 0xCA, 0xA5, 0x3F, 0xEE, 0xE8, 0x1B, 0xBA, 0xB1, 0xD3, 0xDD, 0x35, 0x6A, 0x0D,
+    0x8C, 0x30, 0xA9, 0x68, 0xC4, 0x4C, 0x4D, 0x81, 0xDE, 0x80, 0x77, 0x75, 0x23, 0x66, 0xA8, 0x30,
+    0x74, 0x31, 0xE8, 0xAB, 0x48, 0x5C, 0x03, 0x73, 0x77, 0x8A, 0xB3, 0xF7, 0x02, 0xF9, 0x18, 0x2D,
+    0xC2, 0x21, 0xAC, 0x43, 0x45, 0x15, 0xB2, 0xDC, 0x52, 0x23, 0xB3, 0x88, 0xF0, 0x5F, 0xCE, 0x23,
+    0x16, 0x5B, 0x91, 0xCC, 0xE5, 0x41, 0xD1, 0xB9, 0x82, 0x49, 0x98, 0xCF, 0xDD, 0xDD, 0x2F, 0x71,
+    0x46, 0x8D, 0xCE, 0xA9, 0xE1, 0xAC, 0x42, 0x39, 0xAB, 0x91, 0xAB, 0xF2, 0x55, 0xCC, 0x6C, 0x65,
+    0x1A, 0x99, 0xDB, 0xE2, 0xE6, 0x19, 0x61, 0x5C, 0x3D, 0x4E, 0xC4, 0x25, 0x8A, 0x28, 0x0F, 0x34,
+    0x39, 0x40, 0x60, 0xBA, 0xCB, 0x62, 0x89, 0x9B, 0x2F, 0x7F, 0xAE, 0x3C, 0x15, 0xAE, 0x76, 0x8E,
+    0xC1, 0xED, 0x2F, 0x7F, 0x7E, 0x07, 0x09, 0x1B, 0xCE, 0xF0, 0x77, 0xED, 0x44, 0x2F, 0x7F, 0x0E,
+    0xF2, 0xF5, 0x57, 0x40, 0xF3, 0x7D, 0x71, 0x39, 0xE3, 0x46, 0x1C, 0x3C, 0x09, 0x47, 0x60, 0x36,
+    0xEB, 0x1E, 0x8D, 0x7B, 0x22, 0xE3, 0x07, 0xBD, 0x6C, 0x42, 0x66, 0x55, 0xC6, 0x0D, 0x0B, 0x9F,
+    0xB1, 0x7C, 0xB4, 0x28, 0x57, 0x19, 0x4A, 0x05, 0x6B, 0x05, 0xE9, 0x1B, 0xBB, 0xBB, 0xE9, 0x58,
+    0x20, 0xD8, 0x01, 0x59, 0x8C, 0x53, 0x1A, 0x68, 0x1D, 0xD8, 0x17, 0xAE, 0xB8, 0x28, 0xCA, 0xBD,
+    0xB1, 0x82, 0xC7, 0x54, 0x1B, 0x61, 0x35, 0x66, 0xCB, 0x86, 0xC3, 0xF7, 0xA5, 0x17, 0x21, 0x33,
+    0x86, 0x3E, 0xE1, 0xFC, 0xE8, 0x4E, 0x94, 0xF5, 0x9D, 0x22, 0x37, 0x7B, 0xCD, 0x46, 0x2F, 0x64,
+    0xB5, 0xF6, 0x52, 0xCB, 0x8A, 0x11, 0xC3, 0x95, 0x8B, 0x1B, 0x56, 0x48, 0xD9, 0x2A, 0x1E, 0xDF,
+    0x33, 0xA6, 0x12, 0xC9, 0x72, 0x60, 0x9E, 0xBA, 0xBE, 0x52, 0xAC, 0x19, 0xE3, 0xF6, 0xD6, 0xAD,
+    0x67, 0x1E, 0x3D, 0x8D, 0x03, 0x6A, 0x60, 0x20, 0x52, 0xE5, 0x7F, 0x88, 0xBA, 0x73, 0x16, 0xDF,
+    0xFC, 0x24, 0x85, 0xEA, 0xD1, 0x69, 0xAC, 0x61, 0xE8, 0x8F, 0x0A, 0x89, 0x93, 0x4C, 0x53, 0x54,
+    0x4E, 0x4E, 0xF1, 0x56, 0xE8, 0x94, 0xAF, 0xB5, 0x4A, 0x6A, 0x1F, 0x31, 0x1F, 0xCB, 0x5E, 0xE6,
+    0x2E, 0x42, 0x1A, 0x12, 0xDF, 0xC0, 0xC0, 0x64, 0xA1, 0x39, 0x61, 0x2A, 0x49, 0xB1, 0x23, 0xB3,
+    0x37, 0x86, 0x09, 0xEA, 0x27, 0xC7, 0xFF, 0x3D, 0x98, 0x33, 0xA5, 0xC7, 0xB5, 0x08, 0xBA, 0xCB,
+    0x4E, 0xC4, 0x45, 0x02, 0xFE, 0xBA, 0xCE, 0xF7, 0xEE, 0xDB, 0x64, 0xAA, 0xB2, 0x39, 0x4A, 0x0F,
+    0xD6, 0x99, 0xC2, 0xBC, 0xB1, 0x61, 0x06, 0x7F, 0x75, 0xE7, 0xFC, 0xBA, 0xDF, 0xEB, 0x17, 0xA3,
+    0xBB, 0xB4, 0x36, 0xCD, 0x47, 0x4C, 0x2A, 0x3B, 0xE2, 0x54, 0x3F, 0xBF, 0x53, 0x7E, 0xE2, 0x83,
+    0xF8, 0x16, 0x26, 0x5D, 0x69, 0x59, 0xDC, 0xD6, 0xAD, 0xF0, 0x96, 0xD5, 0xFD, 0x48, 0xDF, 0x05,
+    0x4F, 0xE9, 0xA5, 0x8E, 0xD3, 0xB0, 0x49, 0xCA, 0xB0, 0xC9, 0xCA, 0xA0, 0x4E, 0xF2, 0xCD, 0x72,
+    0x10, 0xF7, 0xEE, 0x35, 0x52, 0x30, 0x6D, 0x97, 0x6B, 0xE0, 0xD6, 0x81, 0x85, 0x0F, 0x54, 0xD8,
+    0x36, 0xCE, 0xD7, 0x50, 0x35, 0xD1, 0x64, 0x14, 0xB9, 0xA9, 0xA9, 0x06, 0xE0, 0xF6, 0x21, 0x56,
+    0xE5, 0xD4, 0x9E, 0xBE, 0x7C, 0xB0, 0x9A, 0x8B, 0xBC, 0xCF, 0x39, 0x0C, 0x05, 0x7E, 0xA5, 0x2B,
+    0xA5, 0x18, 0x73, 0x18, 0xF2, 0x68, 0xCE, 0x61, 0x80, 0x6D, 0x8F, 0xE5, 0xF4, 0xF0, 0xDC, 0x5C,
+    0xC1, 0xE6, 0xC3, 0x1F, 0x5E, 0x7B, 0xF8, 0x6B, 0xA3, 0xCE, 0xC2, 0xCA, 0xF4, 0x74, 0xEB, 0x3C,
+    0xEC, 0x2A, 0xB3, 0x8E, 0xBC, 0xCB, 0x9B, 0x6A, 0x3F, 0x8E, 0xE9, 0x53, 0x9E, 0xAB, 0xCC, 0x03,
+    0xCD, 0x08, 0x21, 0xBD, 0x25, 0xD9, 0x01, 0xA4, 0x27, 0x16, 0xDF, 0x2D, 0x5C, 0xB8, 0xBB, 0x4B,
+    0x5E, 0xAA, 0xD7, 0x7E, 0x3B, 0x52, 0xDF, 0xE8, 0x63, 0xF1, 0xE6, 0x7A, 0xB0, 0x36, 0xDD, 0x30,
+    0x2A, 0xC4, 0x7D, 0xB4, 0x59, 0xA5, 0x6A, 0xB2, 0x5B, 0x32, 0x05, 0xB8, 0x57, 0x99, 0xBD, 0x67,
+    0x45, 0x6D, 0xAF, 0x0B, 0x9A, 0xDB, 0x30, 0x8B, 0x8F, 0xCD, 0x4C, 0xBB, 0x2D, 0x5A, 0x21, 0x98,
+    0x00, 0x1B, 0x74, 0x82, 0x75, 0x92, 0x6E, 0x65, 0x82, 0xF7, 0x7D, 0xEE, 0xFD, 0x06, 0xC6, 0xA3,
+    0xA0, 0x45, 0x24, 0x4B, 0xD0, 0xA2, 0x86, 0x90, 0x7E, 0xB2, 0x25, 0x61, 0xFF, 0xFD, 0x55, 0x82,
+    0x23, 0x04, 0xC3, 0xEB, 0xB7, 0xC0, 0xB5, 0x6B, 0xB6, 0x54, 0x82, 0x1B, 0xD4, 0x91, 0x78, 0xE7,
+    0x4A, 0x70, 0xCC, 0xCA, 0xF2, 0x61, 0xAF, 0xA2, 0x94, 0x89, 0x18, 0x82, 0xFE, 0x08, 0x9B, 0x56,
+    0x51, 0xB3, 0x52, 0xF9, 0x90, 0x65, 0x93, 0x50, 0xB3, 0x29, 0x67, 0x51, 0x25, 0xD6, 0x58, 0xD2,
+    0x22, 0x4D, 0x8D, 0xBE, 0x1B, 0x6C, 0x04, 0x5A, 0xAE, 0x49, 0x4B, 0xC9, 0x15, 0x15, 0x2F, 0x66,
+    0xF1, 0x25, 0xDE, 0x40, 0x45, 0xCD, 0xF8, 0x88, 0xA8, 0xF9, 0x41, 0xA6, 0xE8, 0xE6, 0xEE, 0xEE,
+    0x5E, 0x4F, 0xD1, 0xA9, 0x4F, 0x86, 0x83, 0x83, 0x4B, 0xF7, 0x70, 0x8A, 0x4E, 0x38, 0xFE, 0x1B,
+    0xBB, 0x45, 0x43, 0xFB, 0x9E, 0x82, 0xF7, 0x31, 0xFE, 0xFB, 0x43, 0x4C, 0x1F, 0xE2, 0x4C, 0xDD,
+    0x3B, 0x62, 0xFA, 0xC0, 0x93, 0xF9, 0x1E, 0xDD, 0x30, 0x0F, 0xC0, 0x2B, 0x74, 0xC3, 0x2A, 0x31,
+    0x51, 0x5D, 0xE4, 0x51, 0x53, 0xE4, 0x61, 0x95, 0x1D, 0xA9, 0x44, 0x75, 0x0F, 0xDF, 0xF3, 0xE3,
+    0xAB, 0x35, 0xC0, 0xBA, 0x3C, 0xFC, 0xFC, 0xC8, 0x61, 0x20, 0xBC, 0xB6, 0x57, 0x38, 0x06, 0x7E,
+    0x96, 0x26, 0x62, 0xE0, 0x67, 0x4C, 0x4B, 0xDC, 0x0E, 0x63, 0x1B, 0x2F, 0x90, 0x4F, 0x93, 0x30,
+    0x60, 0x75, 0x09, 0x87, 0x05, 0x23, 0x7D, 0x7C, 0xBE, 0xF1, 0xE2, 0xAF, 0xCA, 0xE9, 0x6D, 0xF4,
+    0x7A, 0x20, 0xEA, 0x99, 0xAF, 0x55, 0x3E, 0x35, 0xE4, 0x46, 0x5F, 0xF3, 0xA0, 0x06, 0x17, 0x9A,
+    0x98, 0x76, 0x8A, 0x72, 0x2E, 0xCC, 0x32, 0xCC, 0xC5, 0x41, 0x3D, 0xE7, 0x02, 0x6E, 0x69, 0x0E,
+    0x76, 0xAD, 0xB5, 0xEE, 0xD6, 0xE8, 0xAD, 0x00, 0x91, 0x3A, 0x43, 0x90, 0x3E, 0x85, 0xFC, 0x10,
+    0xF9, 0xF3, 0xC8, 0xCC, 0xCE, 0x29, 0x87, 0x20, 0x56, 0xB5, 0xDA, 0x07, 0xC9, 0x5E, 0xC6, 0x5A,
+    0xA0, 0x96, 0xCE, 0x0D, 0x38, 0x13, 0x6F, 0xD5, 0x2E, 0x9F, 0xDE, 0xD7, 0xD0, 0x9F, 0x7C, 0x8C,
+    0xBF, 0xB3, 0x63, 0x76, 0x2A, 0xDD, 0x5F, 0x5A, 0x4A, 0xA3, 0x71, 0x16, 0xF6, 0x4F, 0x31, 0xEE,
+    0x19, 0x3D, 0xFC, 0xDC, 0x9A, 0x26, 0xB3, 0xB9, 0x59, 0x01, 0xFD, 0xD5, 0xD6, 0xCD, 0xFA, 0x80,
+    0x4E, 0xB0, 0x9E, 0x98, 0xD0, 0x85, 0xEC, 0x39, 0x18, 0xD3, 0xCE, 0xC1, 0xEC, 0xBE, 0xE8, 0x8E,
+    0xF7, 0xFE, 0xA3, 0x9F, 0xEF, 0xCF, 0xBD, 0xF0, 0x37, 0x53, 0xBD, 0x4C, 0x0B, 0xBB, 0xEF, 0xA2,
+    0x0B, 0xC9, 0x1C, 0x21, 0x05, 0x2C, 0xF3, 0xB3, 0x1F, 0x8B, 0xF9, 0xF6, 0xFE, 0xE6, 0xB1, 0x8B,
+    0x5A, 0x15, 0x53, 0x64, 0x18, 0xA4, 0xF9, 0xC2, 0xD1, 0xFD, 0x85, 0xF6, 0x68, 0xA9, 0xCF, 0x07,
+    0x86, 0xBE, 0x8F, 0x4B, 0x95, 0xCD, 0x9D, 0xA5, 0xCA, 0xF7, 0x13, 0x58, 0x78, 0x1C, 0x79, 0x2C,
+    0x82, 0x4D, 0x5D, 0x87, 0x81, 0x85, 0xAD, 0xB7, 0x25, 0xB0, 0x70, 0xF7, 0xBC, 0x8B, 0x1A, 0x3C,
+    0x01, 0xCA, 0xB6, 0xC6, 0x71, 0x8E, 0x7A, 0xB6, 0x6A, 0xD9, 0xAA, 0x63, 0xDF, 0x46, 0xC3, 0xBE,
+    0x9F, 0x2F, 0x22, 0xDC, 0x52, 0xEF, 0xE2, 0x70, 0xB3, 0xDE, 0xC5, 0xA7, 0xEF, 0x55, 0x21, 0x8F,
+    0xDA, 0x05, 0x4F, 0x69, 0x5A, 0x87, 0xBE, 0xCF, 0x85, 0xEA, 0x2F, 0xCA, 0xE7, 0x68, 0xC1, 0x21,
+    0x82, 0xC0, 0x81, 0x3B, 0x95, 0x7C, 0x08, 0x4F, 0xFC, 0x8A, 0xAD, 0x6D, 0x25, 0x31, 0x9C, 0xAB,
+    0xB0, 0x9F, 0x02, 0x11, 0x2E, 0x4C, 0x25, 0x01, 0xCE, 0xAE, 0x17, 0x07, 0x98, 0x4D, 0xF8, 0x50,
+    0x52, 0x07, 0xDD, 0x7F, 0x23, 0xF6, 0x8E, 0xD8, 0xF2, 0x8F, 0x99, 0x78, 0x31, 0xD2, 0x21, 0xD1,
+    0x7A, 0x1D, 0x03, 0x43, 0xC5, 0x7C, 0xAD, 0xD9, 0xA7, 0x81, 0x1C, 0x27, 0xC5, 0xF6, 0x55, 0x87,
+    0x5D, 0x68, 0xCE, 0x3F, 0xC2, 0xB3, 0x5B, 0xB2, 0x32, 0x8D, 0xE2, 0x60, 0x50, 0xBC, 0xB4, 0x9B,
+    0x98, 0x09, 0x59, 0x5B, 0x3E, 0x1F, 0xAF, 0x77, 0xDF, 0x7F, 0xBB, 0x58, 0x2D, 0xD4, 0x06, 0x58,
+    0x69, 0x7F, 0x6F, 0xAE, 0xBD, 0x8C, 0x6C, 0x52, 0x86, 0x46, 0x45, 0x68, 0x0D, 0x6F, 0x57, 0x89,
+    0x26, 0xCD, 0xE8, 0xC1, 0x7A, 0x49, 0xE2, 0x47, 0x53, 0xD7, 0xA5, 0x1A, 0xA3, 0xB3, 0x09, 0x10,
+    0x95, 0xB5, 0xC0, 0x89, 0xBD, 0x54, 0xE9, 0x08, 0x44, 0x74, 0xD9, 0x7C, 0x08, 0xA5, 0x5F, 0xEC,
+    0xF4, 0x3E, 0xB9, 0x70, 0x03, 0x7C, 0x22, 0x1B, 0x93, 0xD1, 0x34, 0x75, 0xB1, 0xFE, 0x98, 0x65,
+    0x96, 0x1C, 0xA9, 0xE0, 0x40, 0xF8, 0x50, 0x6C, 0xA6, 0x68, 0x80, 0x29, 0x2C, 0x67, 0x51, 0xDF,
+    0xF1, 0x4D, 0xB6, 0xEF, 0x23, 0xB3, 0xE4, 0xC2, 0x7B, 0x65, 0x96, 0x1C, 0xCB, 0x23, 0xF1, 0x9E,
+    0xE6, 0xC2, 0xDB, 0x72, 0x8E, 0x7E, 0xFD, 0xDB, 0x7B, 0x35, 0xDD, 0xBB, 0xC5, 0xB0, 0x6B, 0xC6,
+    0x77, 0x0B, 0x9B, 0xDD, 0x3D, 0xBB, 0x9B, 0xDE, 0xFD, 0x74, 0x7B, 0x5B, 0xA6, 0xDB, 0xE8, 0x74,
+    0xDF, 0xC5, 0xEC, 0x2D, 0xBE, 0x6F, 0x87, 0xEF, 0xD1, 0xB5, 0xD8, 0xDD, 0xED, 0xEC, 0xB9, 0xF7,
+    0x00, 0xFF, 0x7F, 0xDD, 0x5B, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x9E, 0x21, 0x75, 0x47, 0x43, 0x1B,
+    0x84, 0x29, 0x24, 0x23, 0xD1, 0x01, 0x66, 0x93, 0x22, 0x39, 0x20, 0xC7, 0x36, 0x85, 0x74, 0xA4,
+    0xD5, 0x38, 0xDD, 0x6D, 0xA1, 0x03, 0x02, 0xA4, 0x70, 0x93, 0x22, 0x71, 0x11, 0xA5, 0x48, 0x91,
+    0x42, 0x16, 0x29, 0xB8, 0x70, 0xE9, 0x53, 0x9D, 0x22, 0x02, 0xA2, 0x42, 0x3E, 0x17, 0x4E, 0xE1,
+    0x00, 0x57, 0x9C, 0x45, 0x3A, 0x6D, 0x1A, 0x3A, 0x01, 0x92, 0x42, 0x0D, 0x61, 0x38, 0x40, 0x90,
+    0xC6, 0x0C, 0xB2, 0x36, 0xD6, 0x3A, 0x72, 0x27, 0xEF, 0x7B, 0x6F, 0xC8, 0xE5, 0xDE, 0x9D, 0x74,
+    0x8A, 0x71, 0xDA, 0x9F, 0x5B, 0xDC, 0xCD, 0x70, 0x97, 0xE4, 0xF0, 0xCD, 0xF7, 0xBD, 0x79, 0xEF,
+    0xCD, 0x9B, 0xA1, 0x52, 0x83, 0x5A, 0xE1, 0xE3, 0x37, 0x5C, 0x05, 0x86, 0xAB, 0x48, 0xAA, 0x6D,
+    0x93, 0xA2, 0x3A, 0x34, 0x39, 0xAA, 0xB1, 0x29, 0xA8, 0xD4, 0xA3, 0xA4, 0xA4, 0xCA, 0xA9, 0xA2,
+    0x8A, 0x2A, 0xB7, 0x8C, 0x46, 0x54, 0x79, 0x79, 0x30, 0xA6, 0x6A, 0x90, 0xFB, 0x68, 0xCD, 0x4F,
+    0xB9, 0xB5, 0x40, 0x0D, 0x26, 0xDC, 0x96, 0x31, 0xB6, 0x8A, 0x95, 0xFA, 0x58, 0x39, 0x68, 0x8D,
+    0x2E, 0xA3, 0x4A, 0xD3, 0xBD, 0xA6, 0xA4, 0xB6, 0x94, 0x4A, 0x2A, 0xE5, 0x52, 0x45, 0xAD, 0x0D,
+    0xF0, 0xAD, 0x56, 0x99, 0x49, 0x07, 0xC6, 0xE4, 0xF4, 0xE7, 0x1B, 0x79, 0x7E, 0xFF, 0x83, 0x8B,
+    0xE8, 0x13, 0xD6, 0xFD, 0x8A, 0x65, 0x50, 0x6A, 0xFD, 0x01, 0x4A, 0x3D, 0xA4, 0xFF, 0x8C, 0x44,
+    0xF6, 0x8C, 0x19, 0x2B, 0xBF, 0x26, 0xC9, 0xFC, 0x11, 0x09, 0xE4, 0x55, 0x1E, 0x49, 0xF5, 0x1D,
+    0x0F, 0x32, 0xA1, 0x78, 0xF5, 0x03, 0x43, 0x22, 0x91, 0x88, 0xC1, 0xE4, 0x0D, 0x43, 0xCF, 0xA7,
+    0xDF, 0x92, 0x0A, 0x45, 0xC9, 0xC5, 0x00, 0x5F, 0x7D, 0x9C, 0x48, 0xE8, 0x12, 0xF3, 0x5F, 0x43,
+    0x3F, 0xDF, 0x33, 0x95, 0xBA, 0xD2, 0x89, 0xE2, 0x01, 0x00, 0xEE, 0x77, 0xD0, 0xB4, 0x47, 0x4E,
+    0xC9, 0x42, 0x36, 0x16, 0xCC, 0x18, 0xD5, 0x8F, 0x83, 0x54, 0x90, 0x96, 0x2A, 0xE2, 0x1F, 0x1D,
+    0xB9, 0xC4, 0x91, 0xEE, 0xE8, 0x72, 0xA6, 0x8F, 0xAB, 0xC1, 0x0C, 0x80, 0x56, 0x21, 0xDA, 0xBB,
+    0x91, 0x50, 0x33, 0x57, 0xB8, 0x9B, 0x21, 0x1D, 0xE9, 0xC7, 0x6D, 0xCF, 0x04, 0x8E, 0x78, 0x7E,
+    0xAC, 0x38, 0x7B, 0x82, 0x20, 0x60, 0x59, 0xBB, 0x15, 0xE0, 0xC9, 0xFE, 0xE4, 0x3A, 0xE3, 0x97,
+    0x31, 0xEE, 0x8D, 0x8F, 0x53, 0x6E, 0xE5, 0x00, 0x23, 0x1D, 0xAB, 0xE1, 0xEA, 0xE1, 0x6E, 0x3F,
+    0xB8, 0x06, 0x1D, 0xF5, 0x26, 0x01, 0x3D, 0xC7, 0xFC, 0x94, 0xEE, 0x78, 0x93, 0x4E, 0x36, 0xF4,
+    0x3B, 0xC1, 0x7E, 0x60, 0xAF, 0x9A, 0x03, 0xEE, 0xFA, 0xA1, 0x3C, 0x4A, 0xD0, 0x53, 0xDB, 0xFA,
+    0x16, 0x83, 0xB9, 0x33, 0x51, 0x27, 0x71, 0x1F, 0xAD, 0x38, 0xEE, 0x3C, 0x78, 0x7D, 0x1C, 0xBB,
+    0x9F, 0x42, 0xB2, 0x3F, 0x40, 0x20, 0xFF, 0x1F, 0x23, 0x9C, 0xA1, 0x06, 0x0F, 0xD4, 0x56, 0xDB,
+    0x29, 0x80, 0x70, 0xDB, 0x8C, 0x94, 0x36, 0x66, 0xA2, 0x5C, 0xE3, 0x1A, 0xE5, 0x36, 0x8E, 0x49,
+    0x75, 0xAD, 0xE9, 0xBE, 0x4B, 0x1A, 0xED, 0xA1, 0x58, 0xDB, 0xA7, 0x22, 0xA3, 0xE6, 0x3D, 0x73,
+    0x9F, 0x9E, 0xD3, 0xD0, 0x6F, 0x41, 0x8D, 0x62, 0xCC, 0x85, 0x83, 0xAF, 0x2E, 0x4E, 0x04, 0xB8,
+    0xA4, 0x36, 0xF4, 0x73, 0x49, 0xA2, 0xAD, 0xCD, 0x5A, 0x45, 0xC1, 0x4A, 0x3F, 0x11, 0x0B, 0xE3,
+    0xE5, 0x17, 0x5A, 0xFB, 0xBF, 0xC7, 0x3D, 0xC6, 0xD1, 0x3B, 0xB9, 0xF4, 0x76, 0xE1, 0x43, 0x40,
+    0xA9, 0x4B, 0x96, 0x88, 0xE2, 0xB7, 0x00, 0xC3, 0x4C, 0x00, 0x86, 0xFB, 0x57, 0xC3, 0x08, 0xC5,
+    0x9B, 0x0C, 0xFE, 0xDA, 0x2D, 0x01, 0xF8, 0xB4, 0x71, 0x71, 0x3E, 0x8C, 0x54, 0x0B, 0x61, 0x24,
+    0x4C, 0x7F, 0x40, 0xD7, 0x8E, 0xEF, 0x28, 0xE7, 0x88, 0xF0, 0x75, 0x73, 0x16, 0x42, 0xE3, 0xD1,
+    0x78, 0x86, 0x8F, 0xA6, 0x99, 0x96, 0x7A, 0x01, 0xB4, 0xAC, 0x3F, 0x9A, 0xC1, 0x5C, 0x1C, 0x72,
+    0x16, 0x02, 0x34, 0x67, 0xEC, 0x31, 0x4C, 0x85, 0x1A, 0xA9, 0x13, 0x9F, 0xD5, 0x0C, 0x8E, 0x82,
+    0x42, 0xE4, 0x94, 0x0E, 0x25, 0x52, 0x45, 0x12, 0x62, 0x0C, 0x58, 0x68, 0xE7, 0x7D, 0xA6, 0x04,
+    0x8E, 0x1A, 0xBD, 0x48, 0x76, 0x0A, 0xF0, 0x32, 0x9A, 0x3B, 0x2F, 0xCF, 0x8F, 0x9F, 0xD4, 0xB5,
+    0x58, 0x44, 0x97, 0x0B, 0x0F, 0xA5, 0xE2, 0x53, 0xBA, 0x92, 0x4B, 0x9A, 0x9F, 0x71, 0x5F, 0x13,
+    0xE1, 0x22, 0x10, 0x7E, 0x55, 0xBC, 0xB2, 0x1C, 0xB2, 0x63, 0x79, 0x1B, 0x47, 0x74, 0xA7, 0xBE,
+    0x7F, 0x6F, 0x8F, 0x9A, 0xF0, 0x48, 0x2A, 0xBE, 0x22, 0xC1, 0x63, 0x2E, 0x7F, 0xAE, 0xE6, 0xC9,
+    0xD0, 0x0F, 0x55, 0x9F, 0x82, 0x81, 0xC8, 0xE9, 0x14, 0x17, 0x98, 0x83, 0x84, 0x45, 0x8C, 0xAD,
+    0x03, 0xD5, 0x7B, 0xF7, 0x17, 0xCE, 0x81, 0x27, 0x8F, 0xFB, 0xB6, 0x0C, 0x80, 0x4B, 0x37, 0xFA,
+    0xC3, 0x41, 0xDB, 0xE1, 0x70, 0xF3, 0x82, 0x51, 0xA1, 0x39, 0x6A, 0xC1, 0x43, 0xBE, 0xC5, 0x91,
+    0xCB, 0x1D, 0x16, 0x05, 0x63, 0xE2, 0x93, 0x85, 0xF3, 0x61, 0x3F, 0x49, 0xCE, 0x26, 0xD5, 0xB0,
+    0x77, 0xD7, 0xFF, 0x11, 0xD0, 0x86, 0xD7, 0xFA, 0x97, 0x54, 0x32, 0x52, 0x1A, 0x19, 0x37, 0xD1,
+    0x79, 0xD2, 0xB2, 0x18, 0x27, 0xBF, 0xA9, 0x68, 0x66, 0x65, 0x3E, 0x2B, 0x95, 0x3E, 0x22, 0x31,
+    0x9C, 0x32, 0x49, 0xAD, 0xFC, 0x7B, 0x9A, 0x8E, 0x46, 0x2E, 0xB5, 0x99, 0x65, 0xA9, 0x95, 0x7C,
+    0x7D, 0xAE, 0xB4, 0xD0, 0x33, 0x86, 0x8C, 0x08, 0x4F, 0x39, 0x75, 0x33, 0xE0, 0x11, 0x91, 0x99,
+    0xBC, 0xE7, 0xF2, 0xD7, 0xFF, 0xA5, 0x2E, 0x8A, 0x93, 0x3F, 0x33, 0x03, 0xC2, 0x51, 0xA4, 0x53,
+    0x92, 0x8D, 0xD6, 0x5F, 0x6F, 0xB4, 0xC3, 0x65, 0x01, 0xBC, 0x3C, 0xD7, 0xC9, 0x03, 0x93, 0xC6,
+    0x96, 0xDA, 0x14, 0x7A, 0x82, 0xD8, 0x59, 0x6D, 0x9F, 0x28, 0xAF, 0x70, 0xA9, 0x8E, 0x95, 0xFF,
+    0xDC, 0x8D, 0xD1, 0x2F, 0x74, 0xCC, 0xFC, 0x7B, 0x3F, 0x3D, 0xF5, 0x9A, 0xD9, 0x92, 0xC2, 0x1F,
+    0x2A, 0x7D, 0x5B, 0xD2, 0x13, 0x55, 0x94, 0xE2, 0xE9, 0xC6, 0x96, 0xB3, 0x18, 0x47, 0xFC, 0x3D,
+    0x63, 0x45, 0x32, 0xD5, 0xF4, 0x58, 0xE2, 0x92, 0x21, 0x4F, 0xED, 0x52, 0x00, 0x43, 0x9C, 0x35,
+    0xA4, 0x46, 0xFE, 0x98, 0xE6, 0x77, 0x61, 0xE5, 0x10, 0x12, 0x54, 0xC4, 0x51, 0x45, 0x93, 0xBC,
+    0xE4, 0xE9, 0x07, 0x54, 0xA0, 0xED, 0xE4, 0xCB, 0xDD, 0xDD, 0x38, 0xA9, 0xDA, 0x58, 0x8C, 0x8B,
+    0x70, 0x44, 0x73, 0x38, 0x42, 0x83, 0x34, 0xC5, 0xDC, 0x7B, 0x8C, 0xA6, 0x6A, 0x34, 0x5A, 0xDA,
+    0x99, 0xA3, 0x78, 0x5B, 0x56, 0x2C, 0xD3, 0x46, 0x6C, 0xAC, 0x52, 0x32, 0xD9, 0x96, 0x10, 0x1B,
+    0xB7, 0x28, 0x5D, 0xD4, 0x53, 0xAF, 0xA0, 0xF9, 0xD8, 0x67, 0x59, 0x7D, 0x96, 0xD5, 0x9F, 0xF6,
+    0x69, 0xD9, 0x10, 0xE7, 0x3C, 0x41, 0x88, 0x9E, 0xDD, 0xB8, 0x4D, 0x0D, 0x5E, 0xE1, 0xFC, 0x18,
+    0x27, 0x91, 0x32, 0x74, 0x7E, 0xD4, 0x39, 0xB9, 0x79, 0x81, 0xCE, 0x09, 0x2D, 0x32, 0x07, 0x34,
+    0x25, 0x20, 0xB9, 0x9E, 0x14, 0x8C, 0x19, 0x75, 0xF8, 0x90, 0xE1, 0xBF, 0xA5, 0x0F, 0x8E, 0x29,
+    0xC9, 0xB2, 0x01, 0x7A, 0x55, 0x2E, 0xDC, 0xA2, 0x8E, 0x35, 0x1F, 0xD3, 0x24, 0x94, 0x7A, 0xE7,
+    0xE5, 0xA4, 0xBE, 0x6B, 0xF1, 0x46, 0xA7, 0xDF, 0xF3, 0xD1, 0xDD, 0x5F, 0x72, 0x89, 0x01, 0xBF,
+    0xFB, 0x3A, 0x7C, 0xB7, 0xF9, 0x1B, 0x75, 0xD3, 0x3D, 0x62, 0x5B, 0xC0, 0xFA, 0x1A, 0x71, 0x60,
+    0x79, 0x65, 0x9A, 0xC7, 0x58, 0x56, 0x7B, 0x20, 0x59, 0x36, 0x9B, 0x62, 0x08, 0xBA, 0x14, 0xC3,
+    0xB1, 0xB9, 0xEC, 0x1C, 0x60, 0x15, 0xD3, 0xC3, 0xA9, 0x27, 0x72, 0x3D, 0xE8, 0xAF, 0xFA, 0x13,
+    0x9F, 0x6B, 0x61, 0x6D, 0x56, 0x06, 0xD6, 0x67, 0x24, 0xD1, 0xAA, 0x93, 0x49, 0x34, 0xF8, 0x91,
+    0x0D, 0xF4, 0x32, 0x23, 0xF9, 0x1D, 0x73, 0xD3, 0x28, 0x77, 0x42, 0xDE, 0x93, 0xE0, 0xCD, 0xE0,
+    0x6F, 0xB3, 0x82, 0x8A, 0xA4, 0x0C, 0x26, 0xFB, 0xA6, 0x0C, 0xA8, 0xF9, 0x32, 0x68, 0x76, 0x77,
+    0x87, 0x41, 0xDD, 0x3A, 0x1A, 0x2E, 0x06, 0xD4, 0xF3, 0x98, 0xB8, 0xF0, 0x72, 0xC7, 0x94, 0x64,
+    0x68, 0x32, 0xF8, 0xE4, 0x0D, 0x03, 0xDB, 0x7A, 0xB5, 0x37, 0x9A, 0xC5, 0x68, 0xFE, 0x48, 0xFC,
+    0xE8, 0xC1, 0x6A, 0x6B, 0xEE, 0x33, 0x32, 0x64, 0x8B, 0x54, 0x5F, 0x6B, 0xC5, 0xFD, 0x66, 0xC0,
+    0x41, 0xE2, 0x17, 0xF4, 0xED, 0x6D, 0x5E, 0x3B, 0xF8, 0xBE, 0xC3, 0x1E, 0x8D, 0x15, 0x5A, 0x3A,
+    0x39, 0x8B, 0x76, 0xF8, 0x22, 0x68, 0xDF, 0x5D, 0x1C, 0xDA, 0x36, 0xFB, 0x75, 0x88, 0xEC, 0xD7,
+    0xA8, 0xCD, 0x7E, 0xA9, 0x33, 0xB3, 0x5F, 0x0C, 0x79, 0x32, 0x03, 0x79, 0x70, 0xEE, 0x90, 0xBF,
+    0x95, 0x4E, 0x41, 0xE5, 0x30, 0xC6, 0xFF, 0x0C, 0xA0, 0x86, 0x29, 0xA6, 0xBA, 0x37, 0x64, 0xAE,
+    0xBB, 0xC4, 0xFE, 0xEC, 0xC5, 0x43, 0x32, 0xE7, 0xD1, 0x99, 0x69, 0xAD, 0xF9, 0x45, 0x6D, 0xF5,
+    0x33, 0xA2, 0xB6, 0xAC, 0x20, 0x16, 0x48, 0x45, 0xEE, 0xC1, 0xC6, 0x8C, 0xB1, 0x18, 0x42, 0x0D,
+    0x22, 0xD4, 0xA0, 0xAF, 0xAF, 0x75, 0x14, 0xC4, 0xF8, 0x77, 0xD0, 0x43, 0x00, 0x75, 0x0E, 0xFF,
+    0x9A, 0xC4, 0x6B, 0xDB, 0xA5, 0x90, 0xCB, 0x37, 0xA9, 0xFF, 0x66, 0xF1, 0x8A, 0x57, 0x62, 0xED,
+    0x88, 0x66, 0x71, 0x24, 0xC8, 0x47, 0x14, 0xF1, 0x4B, 0xF6, 0x20, 0xA6, 0x3F, 0x0F, 0x8F, 0x3F,
+    0xFB, 0xCF, 0x35, 0x79, 0x62, 0x6A, 0xFA, 0x7B, 0xD9, 0x32, 0x4F, 0xA7, 0xDD, 0x56, 0xA9, 0x00,
+    0x37, 0xEA, 0x2D, 0x3A, 0xF5, 0x0B, 0x85, 0x85, 0x15, 0x93, 0xBA, 0xD4, 0xB7, 0x49, 0x6F, 0x86,
+    0xFE, 0x8D, 0x7A, 0x62, 0xA7, 0x46, 0x58, 0xAE, 0x89, 0xA5, 0x4D, 0xF5, 0x7E, 0x37, 0x61, 0xCA,
+    0x20, 0x49, 0x80, 0xD9, 0x12, 0x29, 0x1E, 0x91, 0x8A, 0xB5, 0x1C, 0x93, 0x62, 0x8E, 0x44, 0x5E,
+    0xA8, 0x81, 0x7E, 0xC0, 0xEF, 0x44, 0x23, 0x4C, 0xC8, 0xC2, 0x3A, 0xA2, 0xCB, 0x82, 0xB6, 0x1C,
+    0xC1, 0xEE, 0x9D, 0x52, 0xF6, 0xAE, 0x91, 0xBB, 0xB8, 0x85, 0xB1, 0xB4, 0x06, 0xF3, 0x91, 0x94,
+    0x24, 0x1E, 0x0C, 0x39, 0xE6, 0x55, 0xD0, 0x6D, 0x3C, 0xDD, 0x91, 0xA1, 0xA1, 0x87, 0xC7, 0xA7,
+    0x84, 0x32, 0x15, 0x8C, 0xB8, 0x0C, 0xD9, 0x8F, 0xAD, 0xEF, 0x4D, 0x15, 0xBF, 0x10, 0x6D, 0x1D,
+    0x34, 0x04, 0x18, 0xCD, 0x16, 0x4D, 0x1A, 0x56, 0xD4, 0x32, 0x69, 0x75, 0x56, 0x90, 0x92, 0x27,
+    0x25, 0x0A, 0xA4, 0x16, 0xDA, 0x02, 0x5F, 0x23, 0x9C, 0xE0, 0x4B, 0xF8, 0x62, 0x1F, 0xB7, 0x71,
+    0x03, 0xA2, 0xF8, 0xE1, 0x31, 0xC5, 0x6F, 0xEC, 0xA4, 0x51, 0xB4, 0x9F, 0x8F, 0xF4, 0xA3, 0xA9,
+    0x34, 0x09, 0x13, 0xF4, 0xEB, 0xA8, 0x97, 0x57, 0xBC, 0xCB, 0xD1, 0x0C, 0x9F, 0x75, 0xF3, 0x69,
+    0xB9, 0xC4, 0x88, 0xF3, 0xA4, 0x85, 0xAD, 0x7A, 0x00, 0xAB, 0xFE, 0x0A, 0xAF, 0x34, 0x73, 0x2C,
+    0x83, 0x35, 0x70, 0x35, 0xB6, 0x19, 0x5C, 0x41, 0x7D, 0x4E, 0xD0, 0x5F, 0x96, 0xEC, 0x12, 0x95,
+    0x6B, 0xC3, 0x6D, 0x56, 0x81, 0x8F, 0x60, 0x6E, 0x26, 0x3C, 0x85, 0x0C, 0xE9, 0x67, 0xAF, 0xA4,
+    0xE1, 0x0E, 0x1F, 0x3A, 0x5C, 0x09, 0x75, 0x9E, 0xAE, 0x6C, 0xFB, 0xED, 0xB2, 0xDE, 0x7B, 0x05,
+    0x96, 0xF5, 0xD8, 0xA0, 0x1F, 0xCE, 0x1A, 0xF4, 0x97, 0x09, 0xAE, 0xF3, 0xA0, 0x9B, 0x86, 0x2B,
+    0x75, 0x67, 0x0D, 0x0F, 0x7C, 0x4D, 0xC6, 0x57, 0xC6, 0xCA, 0x5D, 0x4F, 0xC1, 0xD5, 0x2B, 0x01,
+    0x6E, 0xD3, 0x0D, 0xBD, 0xC1, 0xBB, 0x74, 0x8F, 0x7E, 0x8F, 0xC3, 0x93, 0x16, 0x5C, 0x3D, 0x57,
+    0x70, 0xD5, 0x8C, 0xDD, 0x50, 0xEE, 0xEF, 0x55, 0x9B, 0xAF, 0x68, 0xB5, 0xF8, 0x37, 0xAB, 0xAA,
+    0xC5, 0xBD, 0xF8, 0xBB, 0x10, 0xA3, 0x46, 0xF1, 0x77, 0x4C, 0xAA, 0xFC, 0x93, 0x85, 0xA9, 0xB2,
+    0xCC, 0xA5, 0x00, 0x50, 0x05, 0xD3, 0x7C, 0x44, 0xA5, 0xFF, 0x2E, 0x44, 0x5C, 0x53, 0xBF, 0xE2,
+    0xC5, 0xE9, 0xE1, 0xD4, 0x79, 0x30, 0xE6, 0x7A, 0x7C, 0x86, 0x72, 0x8F, 0x96, 0x09, 0xF3, 0x30,
+    0xFD, 0x2E, 0x21, 0xFE, 0x75, 0xBB, 0x06, 0x5D, 0x9C, 0xB6, 0x06, 0xBD, 0xB3, 0x20, 0xE0, 0x2F,
+    0x3F, 0x3C, 0x0E, 0x6D, 0x83, 0x19, 0xB0, 0x5B, 0x61, 0xE9, 0x7F, 0x90, 0x3A, 0xE5, 0x6C, 0xA0,
+    0xBB, 0xBA, 0x91, 0x06, 0x2F, 0x2E, 0xB3, 0xEF, 0x0F, 0x38, 0xE5, 0xBC, 0x53, 0x2E, 0x06, 0xF0,
+    0xE7, 0x07, 0x23, 0x6A, 0xF3, 0x81, 0xEA, 0x72, 0xA8, 0xA4, 0x34, 0xEC, 0x3C, 0xDD, 0xA6, 0x9F,
+    0x5B, 0xF7, 0xBB, 0xB9, 0x87, 0x96, 0xFD, 0x64, 0xDE, 0x98, 0x69, 0xC1, 0x24, 0x8D, 0x14, 0xDF,
+    0xAB, 0x99, 0x18, 0x5D, 0x0B, 0x33, 0x63, 0xA6, 0xE6, 0xD3, 0x8A, 0xD1, 0x3C, 0x2A, 0x18, 0xDA,
+    0x89, 0x12, 0x9C, 0x95, 0x80, 0xDE, 0x55, 0x4C, 0xC7, 0x33, 0xAA, 0x99, 0x2B, 0xED, 0xED, 0xC2,
+    0x93, 0x12, 0xA2, 0xB8, 0x17, 0x24, 0xB6, 0xA5, 0xCA, 0x72, 0x65, 0xC9, 0x6A, 0xD9, 0x6A, 0xE9,
+    0x5A, 0xE7, 0xD0, 0xD5, 0xAF, 0xA7, 0x5B, 0x00, 0x64, 0xC9, 0x86, 0x3B, 0x4A, 0x8C, 0x48, 0x8E,
+    0x25, 0xCB, 0x41, 0x09, 0x95, 0xC4, 0x49, 0x94, 0x03, 0x49, 0x3F, 0x07, 0xA8, 0x7E, 0x0A, 0x5A,
+    0x3E, 0x54, 0x80, 0xBA, 0xC6, 0xFD, 0x19, 0x78, 0x50, 0x89, 0x94, 0xDD, 0x41, 0xF7, 0xB5, 0x52,
+    0x4C, 0x0F, 0x5F, 0x59, 0xF0, 0x5D, 0xB9, 0x62, 0x86, 0x84, 0x63, 0xCB, 0x91, 0x25, 0xC9, 0x0E,
+    0x0B, 0x61, 0xC3, 0xB3, 0x7B, 0x97, 0x6C, 0xA0, 0x1F, 0xE5, 0x7D, 0x22, 0xF4, 0x68, 0xD5, 0x89,
+    0x70, 0xF6, 0xAD, 0xD9, 0x55, 0x32, 0x03, 0xC4, 0xE0, 0xA8, 0xA6, 0x51, 0xAF, 0xBA, 0xB3, 0x78,
+    0x22, 0xEC, 0x10, 0xB6, 0xF1, 0x79, 0x1B, 0xA0, 0xB7, 0x2B, 0xFF, 0x77, 0x55, 0x4F, 0x5A, 0x1B,
+    0x9E, 0x53, 0xB5, 0xB2, 0x03, 0x43, 0x76, 0x27, 0xB2, 0x47, 0x90, 0x10, 0xDE, 0xC6, 0xF0, 0x36,
+    0xB5, 0xCA, 0x51, 0xBC, 0x84, 0xF1, 0x14, 0xC7, 0x6F, 0x29, 0xCB, 0xCA, 0xC2, 0xB8, 0x91, 0x92,
+    0x3A, 0x76, 0xC0, 0xA6, 0xEC, 0x2B, 0x4E, 0x8D, 0x7D, 0xC1, 0x09, 0x90, 0xC0, 0xE1, 0x54, 0x8A,
+    0x75, 0xE0, 0x2B, 0x6D, 0xAD, 0x24, 0xBD, 0x97, 0x95, 0x5B, 0x4A, 0xD6, 0x2E, 0x94, 0x7B, 0x04,
+    0x28, 0xBC, 0x3C, 0x43, 0x0E, 0x36, 0xDE, 0x48, 0x17, 0x3F, 0x48, 0x56, 0xDA, 0x19, 0x9C, 0xBA,
+    0x74, 0x1C, 0xD5, 0xFD, 0xD1, 0x2F, 0xB9, 0x02, 0xFA, 0x2C, 0x05, 0xD4, 0xED, 0xAC, 0x40, 0xBC,
+    0x03, 0xBB, 0x70, 0x7B, 0xCC, 0x4E, 0x3C, 0x31, 0x46, 0x1B, 0xE4, 0x78, 0xB8, 0x72, 0xE9, 0xE6,
+    0x41, 0xC9, 0xDB, 0x69, 0xBD, 0x42, 0xAA, 0xFC, 0x65, 0x56, 0xAA, 0xAD, 0x0A, 0x36, 0x1A, 0x59,
+    0xC5, 0x99, 0xD4, 0xA8, 0xE1, 0x75, 0x4B, 0x5F, 0x3A, 0xC4, 0x8B, 0xEB, 0x27, 0x08, 0xF0, 0xC6,
+    0xFD, 0x1D, 0x07, 0x76, 0x57, 0xA2, 0xFD, 0xC6, 0x79, 0xF0, 0xC8, 0x60, 0x55, 0x37, 0x32, 0xAF,
+    0x63, 0xED, 0xCE, 0xC4, 0xC4, 0x94, 0x6B, 0x62, 0xFF, 0x1B, 0x95, 0xA4, 0x2D, 0xA4, 0x92, 0x21,
+    0xCA, 0x1C, 0x54, 0x9B, 0xA7, 0x10, 0x2C, 0x33, 0x7F, 0x21, 0xC1, 0x42, 0xE3, 0x41, 0xBC, 0xBE,
+    0x6C, 0xA1, 0x6C, 0x20, 0xAA, 0xA6, 0xA5, 0x44, 0x0D, 0xB2, 0x74, 0x38, 0xFB, 0x46, 0xC3, 0xF5,
+    0xFF, 0xEF, 0x8D, 0x86, 0x95, 0x63, 0x6B, 0x97, 0x9D, 0x9C, 0xAC, 0xAE, 0x61, 0x6F, 0xB7, 0x72,
+    0x34, 0x13, 0xC7, 0x6B, 0xD2, 0x6A, 0xA3, 0x9C, 0xBA, 0xC7, 0xAD, 0xFE, 0xE6, 0xDF, 0x45, 0xF1,
+    0x77, 0xD9, 0x6E, 0xC0, 0xB7, 0xFB, 0x3E, 0x55, 0x52, 0xF4, 0x77, 0x85, 0xB7, 0xBE, 0x1B, 0x68,
+    0x77, 0x9F, 0x9F, 0x77, 0xB9, 0x4E, 0x66, 0xE5, 0xCF, 0x46, 0xEA, 0x4F, 0x10, 0x4D, 0x17, 0x6A,
+    0x90, 0x27, 0x16, 0xBD, 0x6D, 0x5B, 0x5F, 0x97, 0xFA, 0xEF, 0x23, 0xA9, 0xB1, 0x7A, 0x8F, 0xFA,
+    0x73, 0xD5, 0xA1, 0x7C, 0x5E, 0xB5, 0xEA, 0xEA, 0x42, 0x76, 0x1D, 0x82, 0x30, 0xE8, 0x99, 0x65,
+    0xAC, 0xA5, 0x0C, 0x9C, 0x89, 0x8E, 0xE9, 0xD6, 0x6A, 0xEC, 0xA7, 0xD6, 0x57, 0x72, 0x6F, 0xED,
+    0x18, 0xAB, 0x7A, 0xAB, 0x07, 0xD8, 0x60, 0x69, 0x55, 0x37, 0xB2, 0x5B, 0x65, 0xCB, 0xC8, 0x38,
+    0xA6, 0x0E, 0xAB, 0xC8, 0xDC, 0x34, 0xF5, 0xA0, 0x64, 0xCE, 0xDC, 0x82, 0x49, 0x18, 0x20, 0x03,
+    0xEC, 0x37, 0x8F, 0x99, 0x12, 0x7A, 0x96, 0x30, 0xF3, 0x82, 0x15, 0x6C, 0xB5, 0xD0, 0x87, 0x9E,
+    0xB1, 0xA9, 0x15, 0x02, 0x89, 0xC1, 0x27, 0xE0, 0x2E, 0x30, 0x6F, 0xB0, 0xCE, 0x09, 0x87, 0x12,
+    0x26, 0x0A, 0x0A, 0x33, 0x1C, 0x5A, 0xF9, 0x65, 0x55, 0x41, 0xB5, 0x7B, 0x44, 0x2F, 0x2C, 0x89,
+    0x6F, 0x89, 0x17, 0x12, 0x03, 0xD4, 0xEE, 0x6A, 0x72, 0x6D, 0xDF, 0x33, 0xBB, 0xCB, 0x39, 0x5E,
+    0x52, 0x12, 0x5B, 0x2B, 0xD9, 0x9A, 0xC9, 0xCE, 0x4E, 0x76, 0x13, 0x4A, 0xB1, 0x94, 0xAD, 0xA9,
+    0x54, 0xDA, 0x92, 0x0B, 0x63, 0x79, 0x11, 0x47, 0xE4, 0xAE, 0x9A, 0x1A, 0x52, 0x6B, 0x49, 0x5B,
+    0x53, 0x6A, 0x6D, 0xA9, 0x0A, 0xCA, 0xFE, 0x64, 0x63, 0x4B, 0xC6, 0xE7, 0xA5, 0xE5, 0xA3, 0xB6,
+    0x5D, 0x80, 0xCE, 0xCA, 0x40, 0xC6, 0xE9, 0x44, 0xD6, 0x2E, 0x8E, 0xA4, 0xEB, 0x6E, 0x91, 0x71,
+    0xB7, 0x74, 0x3C, 0xD8, 0xBB, 0xC8, 0xE3, 0xD3, 0x3A, 0x48, 0xD9, 0x23, 0x65, 0x37, 0x49, 0xD9,
+    0x5D, 0x52, 0x76, 0x9B, 0x14, 0xEF, 0x93, 0x5A, 0xD2, 0xF1, 0x79, 0x61, 0x3D, 0xDF, 0x6C, 0x78,
+    0xD9, 0x46, 0x94, 0x6D, 0x80, 0xD9, 0x7D, 0x77, 0x1E, 0x4E, 0x5F, 0x15, 0x59, 0x5E, 0x86, 0xBA,
+    0x60, 0xB4, 0x75, 0x03, 0xB6, 0xB2, 0x2F, 0xB2, 0x48, 0x40, 0x2A, 0xE9, 0x2D, 0x57, 0x42, 0x1C,
+    0x71, 0x9A, 0x72, 0x93, 0x57, 0x75, 0x3B, 0x78, 0xFA, 0x2F, 0xC8, 0x99, 0x1A, 0x6F, 0xCF, 0x51,
+    0xDF, 0x68, 0x22, 0x43, 0x97, 0x47, 0x85, 0xC7, 0x7B, 0x37, 0x5C, 0x1C, 0x33, 0x03, 0x37, 0x18,
+    0xEF, 0x43, 0x8E, 0xA2, 0xB0, 0x30, 0x5F, 0x23, 0x90, 0x15, 0x3D, 0x1F, 0x18, 0xD0, 0xE1, 0x9A,
+    0x9D, 0x18, 0x9D, 0xF9, 0x90, 0xDB, 0x63, 0x44, 0x93, 0x7A, 0x1A, 0x76, 0x3D, 0xBF, 0x4C, 0xC6,
+    0x9C, 0x15, 0x05, 0x6F, 0x34, 0x43, 0xAB, 0x6C, 0xAC, 0xC2, 0x3B, 0x18, 0x02, 0xDE, 0x45, 0xCC,
+    0x2D, 0x31, 0x5D, 0xC1, 0xAC, 0xDC, 0xA5, 0x69, 0xB8, 0x08, 0x26, 0xCA, 0x47, 0x36, 0xD8, 0xCF,
+    0x69, 0x1E, 0xE4, 0xA7, 0x48, 0x9C, 0x32, 0xB2, 0xE8, 0x3D, 0x64, 0x2F, 0xEE, 0x60, 0x3A, 0x78,
+    0x00, 0x98, 0xA8, 0xC1, 0xE0, 0x4B, 0x48, 0xFF, 0xB4, 0x84, 0xF0, 0x05, 0x64, 0xE7, 0x0E, 0xA4,
+    0x60, 0xA1, 0x8B, 0x0C, 0x9B, 0x76, 0xC3, 0x28, 0x07, 0x88, 0x8C, 0x5B, 0x48, 0x37, 0xBC, 0x8A,
+    0xCB, 0x22, 0x88, 0xB2, 0x39, 0x5C, 0x46, 0xE4, 0x66, 0xDF, 0x78, 0x2A, 0x4F, 0xDC, 0x55, 0xB5,
+    0x6F, 0x3B, 0xCD, 0x09, 0xBB, 0x90, 0x46, 0x6D, 0x45, 0x00, 0x84, 0xA5, 0xA9, 0x08, 0xBB, 0xAC,
+    0x24, 0xEC, 0xAE, 0xC5, 0x9B, 0xA2, 0xD0, 0xE1, 0xA8, 0xCB, 0xFA, 0xAB, 0x3F, 0xF6, 0x57, 0xBE,
+    0x1F, 0xB3, 0xFA, 0x8E, 0x4E, 0x5B, 0xF9, 0x5E, 0x3E, 0xC4, 0x77, 0x79, 0xF6, 0x8D, 0xD6, 0x7F,
+    0x47, 0x5F, 0x1D, 0x5E, 0x9F, 0xE5, 0x82, 0x87, 0x1C, 0xBF, 0x96, 0x72, 0xBD, 0x5B, 0x62, 0x5A,
+    0x0A, 0xAD, 0xB5, 0xA9, 0x04, 0xB2, 0x40, 0xC8, 0xA7, 0x98, 0xAF, 0x2A, 0xEE, 0x11, 0x95, 0x21,
+    0x37, 0x7A, 0x75, 0x9A, 0x33, 0x5B, 0x52, 0xCC, 0xD7, 0x62, 0x3E, 0xE7, 0xC7, 0xCA, 0x4C, 0x6E,
+    0xCB, 0x4B, 0xC4, 0x0E, 0x5E, 0xFC, 0xD5, 0xF1, 0x7A, 0xB9, 0x54, 0xF6, 0xE1, 0x7F, 0xB5, 0x58,
+    0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0x7D, 0xB7, 0x48, 0x98, 0x68, 0x5C, 0x48, 0x41, 0x7C,
+    0x02, 0xCC, 0xC6, 0x45, 0x7C, 0x50, 0xC4, 0xD6, 0xC5, 0xE9, 0x66, 0x0C, 0x17, 0x2A, 0x5C, 0x64,
+    0x0B, 0x1D, 0x0C, 0x44, 0x45, 0x52, 0xDA, 0x4E, 0xA1, 0x20, 0x48, 0xE1, 0x42, 0x12, 0x69, 0xA7,
+    0x50, 0x15, 0xE4, 0x1A, 0x57, 0x69, 0xAE, 0x48, 0x91, 0x5C, 0x63, 0x15, 0x2E, 0x54, 0x5C, 0xC4,
+    0xC1, 0x19, 0x41, 0x4A, 0x31, 0x0A, 0x02, 0x15, 0x29, 0xCC, 0x00, 0x56, 0xE5, 0xC2, 0x13, 0x88,
+    0x81, 0xF6, 0x62, 0xEE, 0x4E, 0xBE, 0xF7, 0x86, 0xDC, 0xDB, 0xBD, 0xD3, 0xCF, 0x49, 0x87, 0xCC,
+    0x72, 0xDE, 0x0E, 0x67, 0xDE, 0xBC, 0x79, 0xF3, 0xE6, 0xFD, 0x0D, 0x77, 0x76, 0x9E, 0x52, 0xC6,
+    0x3F, 0xFF, 0xCE, 0x5B, 0x17, 0xCE, 0xDC, 0x4E, 0xAC, 0x6A, 0xF2, 0xC9, 0xAF, 0x7E, 0x1B, 0x97,
+    0x27, 0xFB, 0x45, 0x86, 0x2C, 0x91, 0x23, 0xDA, 0xA0, 0xCA, 0xD3, 0xED, 0x0D, 0xDA, 0xB9, 0x4D,
+    0x3B, 0x96, 0x76, 0xE8, 0xE5, 0x9F, 0x31, 0x11, 0x68, 0x26, 0x25, 0x29, 0x22, 0xED, 0xCB, 0x33,
+    0x49, 0x99, 0x7C, 0x52, 0xD2, 0x7E, 0x49, 0xF1, 0x29, 0x9E, 0xC8, 0x68, 0x5F, 0x6B, 0xDF, 0xE0,
+    0x59, 0xDF, 0xDD, 0x5E, 0x6C, 0x9F, 0xDB, 0xDA, 0xDA, 0xA2, 0xC2, 0x7B, 0x1F, 0x80, 0x14, 0xED,
+    0x43, 0x69, 0x87, 0xC6, 0x84, 0x86, 0x32, 0x5E, 0xA1, 0x89, 0x2A, 0xFF, 0xDF, 0x4F, 0xCF, 0x44,
+    0xA7, 0xFB, 0xA5, 0xC1, 0xE4, 0x98, 0xDF, 0xD7, 0x77, 0x77, 0xFF, 0x48, 0x3F, 0x8C, 0xBA, 0x51,
+    0xAD, 0x28, 0x27, 0x5D, 0x6A, 0xA7, 0x5B, 0xDD, 0x2A, 0x87, 0x63, 0xA0, 0xCC, 0xF2, 0x5B, 0xDE,
+    0xA6, 0x6D, 0xEC, 0xE2, 0x26, 0xB5, 0x05, 0x7D, 0x8E, 0x99, 0xA3, 0xED, 0x9C, 0x71, 0x9C, 0xAE,
+    0x35, 0x66, 0xA8, 0x32, 0x69, 0x69, 0x2F, 0xEC, 0x24, 0x03, 0x86, 0x76, 0xDE, 0xEA, 0xD6, 0xD7,
+    0x39, 0x6A, 0xDA, 0xE6, 0x75, 0xEC, 0x52, 0x1B, 0x37, 0xAA, 0x4C, 0x6D, 0x4E, 0x45, 0xD4, 0xD1,
+    0xE7, 0x71, 0x2D, 0xB8, 0xA3, 0xED, 0xD7, 0x4D, 0xEE, 0x2A, 0xC1, 0x95, 0x39, 0xB5, 0x37, 0x9A,
+    0x3A, 0x50, 0xDC, 0x03, 0xCD, 0x4D, 0x4A, 0x5A, 0x55, 0xD3, 0x5E, 0xEC, 0x04, 0xF9, 0x1C, 0x98,
+    0xD1, 0x36, 0xD4, 0x1C, 0x5B, 0xC9, 0x4C, 0xA8, 0x38, 0xCF, 0x3F, 0xFD, 0xE4, 0x07, 0x0D, 0xC4,
+    0xE9, 0xB8, 0xA2, 0xBD, 0x43, 0x79, 0x8F, 0x5B, 0xD4, 0xA1, 0x0E, 0xF3, 0x74, 0x19, 0xE6, 0xE6,
+    0xFD, 0xDC, 0x8C, 0x64, 0xFE, 0x53, 0xEB, 0x77, 0x17, 0xD6, 0x1D, 0xD6, 0x7C, 0xDE, 0x7A, 0xFC,
+    0x7F, 0x94, 0x0E, 0xCF, 0x1D, 0xC6, 0xD0, 0x1E, 0x2B, 0x1A, 0xFB, 0x6F, 0x2A, 0x99, 0xEF, 0x3F,
+    0xFB, 0xCC, 0x09, 0x0E, 0xD3, 0x66, 0x3C, 0xC6, 0x59, 0x97, 0xA3, 0x4A, 0xBC, 0x51, 0x10, 0xA2,
+    0x77, 0x9A, 0x55, 0x66, 0xFE, 0xB8, 0xCC, 0x37, 0x23, 0x5F, 0xD2, 0x15, 0xC6, 0x81, 0x66, 0xDF,
+    0x25, 0xAA, 0x1A, 0xAA, 0x66, 0x30, 0x95, 0xA6, 0xF2, 0x6D, 0xE5, 0x4D, 0xD5, 0x52, 0x65, 0xE4,
+    0x9C, 0x88, 0x56, 0xA8, 0xB0, 0xBE, 0xC1, 0x48, 0x9D, 0x9B, 0x15, 0x8A, 0xC6, 0x85, 0x55, 0x13,
+    0xDF, 0x64, 0x1D, 0xD7, 0xAA, 0x56, 0x5D, 0x6E, 0x56, 0x1B, 0x16, 0x4C, 0x55, 0x03, 0xA7, 0xE1,
+    0xC5, 0x51, 0xD8, 0xE8, 0xE8, 0x54, 0xE6, 0x76, 0x68, 0x74, 0x62, 0x6E, 0x6C, 0x78, 0xF1, 0xA9,
+    0x9F, 0xC8, 0xF8, 0xA5, 0x72, 0x72, 0x77, 0xE2, 0xFD, 0xC3, 0xAD, 0x9A, 0xF8, 0xD7, 0xD0, 0x8B,
+    0xCD, 0xDB, 0xBA, 0x4A, 0x23, 0xF9, 0xA5, 0x2F, 0x32, 0x8F, 0x0E, 0x4B, 0x8C, 0xDD, 0xA7, 0x72,
+    0x9E, 0xA4, 0xBE, 0x6E, 0x49, 0x85, 0x31, 0xFD, 0x31, 0xAB, 0xB9, 0x94, 0xC2, 0xCC, 0xE8, 0x52,
+    0x68, 0x56, 0xE4, 0x07, 0x3B, 0xAA, 0xF0, 0xEB, 0xFD, 0x83, 0xA7, 0xAA, 0xB7, 0x01, 0x6E, 0x26,
+    0xCD, 0xBC, 0x99, 0xDA, 0xF9, 0x34, 0x55, 0x6E, 0xE1, 0xAC, 0x0D, 0x15, 0x34, 0xCB, 0x46, 0xBE,
+    0x26, 0xDF, 0x91, 0x36, 0xD3, 0xCD, 0xEC, 0xC1, 0x24, 0x39, 0xA8, 0x28, 0xDF, 0x9F, 0x5C, 0xD7,
+    0x6F, 0x77, 0xA9, 0xD3, 0x65, 0xEA, 0x9B, 0x09, 0x90, 0xE0, 0x8F, 0x2D, 0xED, 0xBE, 0xED, 0x30,
+    0x35, 0xAB, 0x33, 0xA8, 0x66, 0xD2, 0xF8, 0xA1, 0x39, 0xB2, 0xA0, 0x8D, 0x26, 0x16, 0x52, 0xE5,
+    0xBC, 0x99, 0xD1, 0x1C, 0x41, 0xCB, 0x8A, 0xD2, 0xBC, 0x81, 0x15, 0xA7, 0x42, 0x0C, 0x76, 0xDB,
+    0x2F, 0x41, 0x51, 0x4B, 0xD9, 0x83, 0x96, 0x17, 0xA6, 0xC4, 0x11, 0xB3, 0x53, 0xF5, 0x5B, 0x39,
+    0x2B, 0x4C, 0x2E, 0x97, 0x05, 0x01, 0x2D, 0xCB, 0x68, 0x59, 0x4C, 0xCB, 0x92, 0x5A, 0x16, 0xD6,
+    0xB2, 0xBC, 0x96, 0x45, 0xB6, 0x2C, 0xB5, 0x65, 0xC1, 0x2D, 0xCA, 0x0E, 0xBA, 0x7A, 0x65, 0x2E,
+    0xBE, 0x6A, 0x4A, 0x0A, 0xFE, 0x28, 0x48, 0x30, 0x9E, 0x16, 0x46, 0xFF, 0xDE, 0xF5, 0x42, 0x1C,
+    0xB9, 0xDC, 0x56, 0xC9, 0xA4, 0x97, 0x63, 0xEA, 0xB2, 0x7A, 0x16, 0x77, 0xBD, 0x28, 0x55, 0xA3,
+    0xFE, 0x35, 0x8D, 0xA6, 0xBD, 0x34, 0xE7, 0x6F, 0x22, 0x50, 0xBC, 0xFD, 0x7B, 0x1A, 0xCD, 0x7A,
+    0x99, 0xCE, 0xDF, 0x44, 0xAC, 0x73, 0xCC, 0x20, 0xD9, 0x46, 0x35, 0xF2, 0xC6, 0xC2, 0xE5, 0x15,
+    0x2C, 0xAF, 0x10, 0xE4, 0x9B, 0x84, 0xD5, 0x7B, 0x11, 0xC7, 0xD3, 0x8A, 0xC0, 0xD9, 0x20, 0xE5,
+    0xA2, 0x83, 0x96, 0x96, 0x83, 0xA0, 0x59, 0x0B, 0xAF, 0x90, 0x9A, 0xAA, 0x2E, 0x6B, 0x73, 0x97,
+    0xD7, 0x1A, 0xFB, 0xD9, 0x64, 0x09, 0x4F, 0xB9, 0x8F, 0x7B, 0xA5, 0x1F, 0x23, 0x32, 0x86, 0x51,
+    0x1E, 0xDF, 0x0C, 0xA7, 0x30, 0x1D, 0xB0, 0x02, 0x5E, 0x8F, 0x29, 0xB8, 0x3D, 0xB6, 0xE0, 0x87,
+    0x19, 0x9B, 0xC3, 0x69, 0xB5, 0xF9, 0x44, 0x4D, 0xD2, 0x2E, 0xE9, 0xE0, 0xE4, 0xA7, 0x74, 0x93,
+    0x7B, 0xB8, 0x8F, 0x7B, 0xB9, 0x9F, 0x47, 0x78, 0x4C, 0x46, 0x79, 0xFC, 0x66, 0x98, 0x35, 0x60,
+    0x05, 0xBC, 0x80, 0x19, 0x70, 0x03, 0x76, 0x8F, 0x1F, 0x66, 0xDC, 0xEC, 0x17, 0x3B, 0xC7, 0x87,
+    0x87, 0x2D, 0x7A, 0x0B, 0x0D, 0xAA, 0x29, 0x79, 0xEC, 0x28, 0xBD, 0x0F, 0xDD, 0xB1, 0xD0, 0x18,
+    0xF3, 0x67, 0x48, 0x52, 0x63, 0x02, 0x1C, 0xF3, 0x9B, 0x88, 0x20, 0x13, 0x08, 0xB1, 0x81, 0x1F,
+    0x34, 0xDE, 0x14, 0x36, 0xAB, 0x53, 0x17, 0x4F, 0xA0, 0x3A, 0x6F, 0xBE, 0x0F, 0xCE, 0x73, 0xA3,
+    0xF0, 0x9E, 0x74, 0xF1, 0x2C, 0x9E, 0x25, 0x50, 0x5F, 0x05, 0x3F, 0xB9, 0x49, 0xEF, 0x83, 0x38,
+    0xEB, 0xE4, 0x05, 0xCA, 0x1D, 0xDD, 0x86, 0x90, 0xDB, 0x78, 0x92, 0x23, 0x12, 0xA6, 0x8E, 0x29,
+    0xE5, 0x36, 0xEE, 0x22, 0x9C, 0x14, 0x1E, 0x3E, 0x98, 0xDC, 0xA6, 0xD0, 0xB5, 0x14, 0x27, 0x43,
+    0x2B, 0x71, 0x57, 0x45, 0xE3, 0xCA, 0x56, 0xE0, 0x1F, 0xAE, 0xDB, 0xA9, 0x1E, 0x86, 0x9E, 0xB5,
+    0xB8, 0xF3, 0xD1, 0x0E, 0x30, 0x25, 0x0E, 0x58, 0xE5, 0x98, 0x42, 0xD2, 0x09, 0x11, 0x4F, 0x4C,
+    0x59, 0xDB, 0xB0, 0x4A, 0x21, 0x2B, 0x6E, 0x20, 0x92, 0xB2, 0x23, 0x56, 0x1C, 0xC6, 0x10, 0x6F,
+    0x87, 0x8A, 0xB8, 0x1B, 0x7E, 0x4D, 0x2E, 0x15, 0x67, 0xD2, 0xE4, 0x30, 0x52, 0xAE, 0x99, 0x85,
+    0x61, 0xA2, 0x2A, 0xDB, 0xFF, 0x10, 0x75, 0xB9, 0xAE, 0xD0, 0xA1, 0x57, 0x62, 0x2B, 0xE6, 0xF9,
+    0x03, 0x2D, 0x9E, 0x17, 0x51, 0x34, 0x98, 0x23, 0x54, 0x28, 0x47, 0x56, 0x40, 0x45, 0x3B, 0x42,
+    0x2C, 0x81, 0xC3, 0xB4, 0xD5, 0x5F, 0xAE, 0x54, 0x75, 0x76, 0xAF, 0xC3, 0x4B, 0x2A, 0x00, 0x21,
+    0x84, 0x81, 0xA5, 0xD1, 0x7F, 0x80, 0x3D, 0x7A, 0x3C, 0xE3, 0x68, 0xE5, 0x24, 0x64, 0x01, 0xB4,
+    0x24, 0x86, 0xDF, 0x83, 0x68, 0xBC, 0x64, 0xEE, 0x2C, 0x2B, 0xCA, 0xD8, 0x54, 0xF3, 0x8E, 0x5B,
+    0x0C, 0x54, 0x3B, 0x1C, 0x2A, 0xA7, 0x4D, 0x9C, 0x1E, 0x19, 0xE4, 0x24, 0xBB, 0xE6, 0xBA, 0x84,
+    0xC1, 0x5A, 0x3C, 0x00, 0x36, 0xC1, 0x36, 0x7C, 0x97, 0x22, 0xFF, 0xE9, 0xCA, 0x35, 0x4C, 0x00,
+    0x8F, 0xAC, 0xEC, 0x51, 0xE5, 0xBF, 0x5A, 0x20, 0xBF, 0xB2, 0xCB, 0xCB, 0xAD, 0x62, 0x6C, 0x9B,
+    0x24, 0xF7, 0x9A, 0x82, 0xA9, 0x4F, 0xE9, 0xA7, 0x1E, 0x29, 0x28, 0x06, 0xCE, 0xBB, 0xA0, 0xAC,
+    0xDD, 0xD9, 0xC1, 0x4C, 0x38, 0xCD, 0x8C, 0x31, 0x94, 0xD8, 0x70, 0xE4, 0x1C, 0x8B, 0x2F, 0x12,
+    0xA7, 0x9E, 0x44, 0x77, 0x9E, 0x30, 0xCC, 0x47, 0x87, 0xF7, 0x0D, 0xF4, 0xDF, 0xC1, 0xB8, 0xDB,
+    0xC0, 0xF0, 0x45, 0x0C, 0x2B, 0x0C, 0xA7, 0xA5, 0x42, 0xEB, 0x22, 0x7A, 0x30, 0xDB, 0xDD, 0x09,
+    0x04, 0x06, 0x87, 0xA7, 0xEA, 0xFE, 0x3F, 0x38, 0x9F, 0x1F, 0xA7, 0x56, 0x7C, 0x92, 0xBE, 0x75,
+    0x4B, 0x3C, 0x55, 0xF1, 0x38, 0x38, 0xC9, 0x55, 0x3F, 0x0B, 0x13, 0xAA, 0x03, 0xF9, 0xCB, 0xBF,
+    0xF5, 0x22, 0x1D, 0xFD, 0xE0, 0x77, 0xF2, 0x7F, 0x31, 0xDD, 0x17, 0xFC, 0x57, 0x94, 0x1D, 0x2F,
+    0xD0, 0x93, 0x33, 0x6F, 0xC2, 0x1B, 0x04, 0xF5, 0x23, 0x55, 0xD6, 0xDF, 0x1F, 0xD5, 0xBF, 0xD4,
+    0xE9, 0x65, 0x97, 0xFF, 0x66, 0xBF, 0xAD, 0xFE, 0x79, 0xAD, 0xD5, 0x8F, 0xBE, 0xEC, 0xCE, 0x43,
+    0x2E, 0xA8, 0x5F, 0x11, 0x72, 0x04, 0x2A, 0x26, 0x74, 0xCD, 0xFB, 0x86, 0xDF, 0x31, 0xEE, 0xF4,
+    0xA3, 0x7B, 0x9D, 0x56, 0x97, 0x5D, 0xF6, 0xCE, 0x7E, 0x8B, 0xF9, 0xDB, 0xDF, 0xC3, 0xFC, 0x81,
+    0x1E, 0xE8, 0x83, 0x76, 0x43, 0x48, 0x6D, 0x0B, 0x5F, 0x2F, 0x3E, 0x58, 0x9B, 0x8F, 0x09, 0xBC,
+    0x47, 0xAC, 0x00, 0x0D, 0xBB, 0x3B, 0x3E, 0xAD, 0x90, 0x5D, 0x6D, 0x9E, 0x7A, 0xF8, 0xDC, 0x96,
+    0xE1, 0xC4, 0xE6, 0x60, 0xCC, 0x49, 0x4E, 0xFD, 0xCC, 0xE7, 0xE1, 0x98, 0x31, 0x1F, 0x9A, 0xE7,
+    0xA0, 0x71, 0xB2, 0xB4, 0x0D, 0x4C, 0x50, 0xDE, 0xDA, 0x42, 0x88, 0x6F, 0xAE, 0x42, 0x9B, 0xF1,
+    0x54, 0xCF, 0x7A, 0xB6, 0x90, 0x44, 0x79, 0x86, 0xCF, 0x46, 0x03, 0x9D, 0x5F, 0x08, 0x26, 0x88,
+    0xCF, 0x75, 0x72, 0xD5, 0x1F, 0x70, 0x4E, 0x65, 0x58, 0x65, 0x2D, 0xF2, 0x88, 0x16, 0xD6, 0x9C,
+    0xB7, 0xD9, 0x34, 0x9D, 0x92, 0xA4, 0x60, 0x93, 0x04, 0x11, 0xC1, 0xAA, 0x69, 0xD6, 0x22, 0x16,
+    0xE2, 0x20, 0xA7, 0xAB, 0x8E, 0x83, 0x22, 0xBC, 0x70, 0x88, 0x8E, 0xD2, 0x48, 0xB8, 0xC1, 0xD6,
+    0x92, 0x78, 0x71, 0x9A, 0x38, 0x96, 0x19, 0x49, 0xEA, 0xD7, 0xF7, 0x9A, 0xFE, 0x05, 0xB2, 0x4C,
+    0x66, 0x14, 0x4E, 0x4C, 0x0C, 0x30, 0x2B, 0xFB, 0x86, 0x1A, 0x1A, 0x2B, 0xC7, 0xCD, 0x72, 0x28,
+    0x1C, 0xC9, 0x53, 0x56, 0xB4, 0x82, 0x95, 0x89, 0x8D, 0xB3, 0x72, 0xBD, 0x95, 0x16, 0xFD, 0x52,
+    0x92, 0xA2, 0xA6, 0xED, 0xB1, 0xA9, 0xBC, 0x4D, 0x35, 0xE5, 0x3D, 0xAA, 0x19, 0x6F, 0x50, 0x4D,
+    0x79, 0x77, 0x80, 0xD8, 0x51, 0xDA, 0x65, 0x02, 0x79, 0x2F, 0xA3, 0x39, 0xCC, 0xE0, 0xE0, 0x79,
+    0x2F, 0x08, 0x68, 0xE0, 0x1D, 0x10, 0xBB, 0x80, 0xF7, 0xC0, 0x16, 0x18, 0xC2, 0xB1, 0x3B, 0x66,
+    0x1E, 0x10, 0x9C, 0x43, 0x3F, 0x98, 0xED, 0xF1, 0x51, 0x6E, 0x31, 0x0B, 0x8C, 0x41, 0x42, 0xE0,
+    0x53, 0xCD, 0xFA, 0x36, 0x38, 0x64, 0xFA, 0x87, 0xA5, 0x70, 0xCC, 0x1D, 0xB8, 0x02, 0x77, 0x85,
+    0xAB, 0xC4, 0x7D, 0x7A, 0x70, 0xA7, 0x1D, 0x73, 0xA7, 0xD9, 0x6D, 0x02, 0x32, 0x5F, 0x79, 0x3D,
+    0xC0, 0xAC, 0x63, 0xA8, 0x5B, 0x16, 0x64, 0x05, 0x0C, 0x49, 0xC8, 0x2D, 0x73, 0xC7, 0xD0, 0x32,
+    0x53, 0xE0, 0x4E, 0xC9, 0xB3, 0x12, 0x84, 0xBA, 0x50, 0x90, 0x1D, 0x81, 0x3B, 0x38, 0x70, 0x70,
+    0x54, 0x38, 0xE6, 0x0E, 0x6D, 0x1C, 0x10, 0x68, 0x82, 0xBB, 0xE0, 0x6C, 0xDF, 0x60, 0xEF, 0xC0,
+    0x4E, 0xAA, 0x9C, 0x03, 0x23, 0xDE, 0x2F, 0xE3, 0x4B, 0x63, 0xEC, 0x0F, 0x0A, 0xEA, 0xAD, 0x00,
+    0xB9, 0x00, 0x8A, 0xA4, 0x3B, 0xB2, 0x2F, 0x76, 0x15, 0x6C, 0x31, 0x24, 0x69, 0x8E, 0x64, 0x37,
+    0x09, 0x9B, 0x22, 0x5B, 0x0F, 0x49, 0x7A, 0x23, 0xD7, 0x3D, 0xBE, 0x54, 0x84, 0x04, 0x4A, 0x1F,
+    0xA3, 0xC4, 0xB7, 0x3F, 0x68, 0x25, 0xD6, 0xFD, 0xD9, 0x7F, 0xA1, 0xB0, 0x89, 0x2B, 0xBC, 0x8B,
+    0x01, 0x5A, 0x06, 0x93, 0x65, 0x20, 0x7D, 0x6E, 0x0E, 0x2C, 0x03, 0x2C, 0x7D, 0x9D, 0x4E, 0x0F,
+    0x46, 0x08, 0x76, 0x90, 0x4E, 0xD1, 0xD2, 0x87, 0x3B, 0xEB, 0x3B, 0xF3, 0x18, 0xC4, 0xD7, 0x1C,
+    0xF8, 0x2A, 0xDC, 0xA6, 0xAF, 0xC3, 0x8D, 0x03, 0x54, 0xCB, 0x40, 0xFA, 0x64, 0x34, 0xF7, 0xCD,
+    0x0D, 0xCE, 0xCE, 0xBD, 0x8B, 0x10, 0x33, 0x76, 0xFA, 0x0B, 0x0C, 0xFC, 0xFE, 0x55, 0xF4, 0x81,
+    0x53, 0x20, 0x45, 0x00, 0xEE, 0x49, 0x80, 0x47, 0x5D, 0x02, 0x50, 0xB3, 0x20, 0xCC, 0x87, 0xBB,
+    0xBB, 0x7F, 0x08, 0x0E, 0x5B, 0xDC, 0x9D, 0xA5, 0x0D, 0xF5, 0x71, 0xA3, 0xDF, 0x7D, 0xD7, 0x55,
+    0x5F, 0x17, 0xAD, 0x38, 0x66, 0xB0, 0xC9, 0x2E, 0xB3, 0x80, 0xBB, 0xDC, 0x54, 0xEF, 0xB8, 0x37,
+    0xE0, 0x26, 0xC5, 0x45, 0x32, 0x3E, 0xCE, 0xB5, 0x6A, 0x2A, 0x37, 0xBF, 0x45, 0x2D, 0x2A, 0x83,
+    0xD5, 0x0D, 0xD4, 0xAE, 0xA9, 0xCA, 0x9B, 0x38, 0x84, 0xCC, 0x8C, 0x1C, 0xFD, 0x7A, 0x21, 0x01,
+    0x66, 0x8F, 0x5F, 0xF0, 0xA5, 0x3C, 0xF6, 0x66, 0xD5, 0x1B, 0xB6, 0x2D, 0xC4, 0x68, 0xB1, 0x56,
+    0x7D, 0x18, 0xAD, 0xCE, 0xD2, 0xA9, 0x8B, 0x28, 0x40, 0xC7, 0xD7, 0x4C, 0xDC, 0xAD, 0xD9, 0x9C,
+    0xEB, 0x78, 0x66, 0x22, 0xB8, 0x8E, 0x82, 0x03, 0x3E, 0x87, 0xCD, 0x72, 0x88, 0x58, 0x2F, 0x2B,
+    0x85, 0x97, 0x9C, 0x97, 0x21, 0x6C, 0x6A, 0x77, 0x09, 0xA6, 0x82, 0x63, 0x75, 0x7B, 0xA4, 0x9B,
+    0x96, 0x56, 0x58, 0xC3, 0xE3, 0x85, 0xB8, 0x90, 0x2E, 0xC4, 0x86, 0xBC, 0xDF, 0xCE, 0x8D, 0xDE,
+    0x2E, 0x38, 0x84, 0xB4, 0x03, 0xFA, 0x5D, 0x1A, 0xDD, 0xF7, 0x65, 0xBA, 0x0F, 0x57, 0xF4, 0x09,
+    0x5C, 0xAA, 0xF1, 0x87, 0x22, 0x18, 0xC1, 0x7C, 0x61, 0x5F, 0x26, 0x23, 0x7D, 0xAD, 0xC9, 0xE8,
+    0x52, 0x32, 0x2D, 0x10, 0x82, 0xA0, 0x2E, 0x7B, 0x94, 0xB7, 0xF4, 0xEA, 0xF0, 0x41, 0x26, 0x38,
+    0x34, 0x76, 0xDC, 0x92, 0x45, 0xD4, 0x04, 0x41, 0xD1, 0xF9, 0x49, 0x88, 0xE2, 0x85, 0x64, 0x08,
+    0x08, 0xF8, 0x1F, 0xC9, 0xF9, 0x59, 0xC9, 0xAD, 0x46, 0x48, 0x42, 0x2F, 0xFF, 0xCD, 0xAA, 0x2F,
+    0xBE, 0x70, 0xE9, 0xA3, 0x7B, 0x4D, 0xF4, 0xED, 0x37, 0x86, 0xF4, 0x94, 0x55, 0x71, 0xC6, 0xF5,
+    0x83, 0x6B, 0x07, 0x1F, 0xE0, 0xEE, 0x89, 0x64, 0xE9, 0xCB, 0x5A, 0xFD, 0xFD, 0xAF, 0x6E, 0x74,
+    0xEB, 0x7E, 0x1D, 0x8D, 0x6A, 0x43, 0xAB, 0xDB, 0x0B, 0x57, 0x93, 0xDE, 0xE1, 0x8B, 0xB3, 0x97,
+    0x16, 0xF5, 0xAC, 0x8B, 0x77, 0xD1, 0x75, 0xEF, 0xF1, 0xC5, 0x29, 0x8B, 0x43, 0x16, 0xEF, 0x3E,
+    0x2F, 0x33, 0x21, 0x60, 0x9E, 0x44, 0xA0, 0x4F, 0xE9, 0xFB, 0xA4, 0x7E, 0x48, 0xEB, 0xE7, 0x89,
+    0x7D, 0x9F, 0xDA, 0xCF, 0x93, 0xFB, 0x3E, 0xBD, 0x1F, 0x12, 0xFC, 0xCD, 0x63, 0xAA, 0xA4, 0x65,
+    0x5D, 0x89, 0xFF, 0x4B, 0xB0, 0x10, 0xE5, 0x7F, 0x85, 0xBF, 0x9E, 0x80, 0x8F, 0xD7, 0xE4, 0xBB,
+    0x07, 0x32, 0xC8, 0x06, 0x79, 0x9B, 0x05, 0xD7, 0x80, 0xA1, 0x67, 0x0D, 0xA3, 0xEB, 0xCF, 0xA7,
+    0x56, 0x1E, 0x09, 0x4F, 0xFC, 0x25, 0xC5, 0xF0, 0xC6, 0x07, 0x6A, 0x95, 0xB4, 0xD9, 0xE4, 0xAA,
+    0x32, 0xEA, 0x57, 0x7E, 0x2D, 0x38, 0x01, 0x7B, 0x94, 0x5A, 0xE8, 0x59, 0x37, 0x8B, 0xD4, 0x2A,
+    0x53, 0x2D, 0x53, 0x8B, 0x7A, 0x6A, 0x66, 0xD8, 0xC7, 0xD3, 0xCD, 0x7A, 0x99, 0xB3, 0xE3, 0x58,
+    0xC5, 0x09, 0x77, 0xB5, 0x58, 0xD6, 0x5E, 0x40, 0x6A, 0x74, 0xF2, 0x53, 0x99, 0xAF, 0x98, 0x99,
+    0x8F, 0x62, 0x30, 0xB9, 0x97, 0xB6, 0x85, 0xDD, 0x53, 0x13, 0x69, 0xBD, 0x8E, 0x3B, 0x52, 0xD3,
+    0x87, 0x97, 0x01, 0xB0, 0xD6, 0x4F, 0x8A, 0xF0, 0x95, 0x72, 0x69, 0x60, 0x0D, 0xC8, 0xDB, 0x47,
+    0x08, 0xE4, 0x66, 0x8F, 0x6D, 0xF4, 0xB8, 0xA4, 0xD6, 0x4C, 0x51, 0x73, 0x5F, 0x51, 0xAF, 0x99,
+    0x27, 0x4B, 0x4A, 0xDB, 0xA2, 0xC1, 0x4F, 0xDC, 0xDD, 0x9A, 0xD1, 0x35, 0xBF, 0x69, 0xBB, 0xB2,
+    0x30, 0x72, 0xDE, 0x04, 0x3A, 0x61, 0x04, 0x3B, 0xF2, 0xEF, 0xFD, 0x23, 0x7C, 0x68, 0x49, 0xEC,
+    0x0B, 0x7E, 0x04, 0xBA, 0x5A, 0x8F, 0xF8, 0xD7, 0xBC, 0xD0, 0xC7, 0x9C, 0x6A, 0xA6, 0x91, 0xA3,
+    0x29, 0x97, 0x36, 0x89, 0x3D, 0xE9, 0xAC, 0xF0, 0x11, 0x28, 0x32, 0x89, 0x1D, 0xD5, 0xCA, 0x65,
+    0xAD, 0xEE, 0xAA, 0xD9, 0xC9, 0x67, 0xC6, 0xB8, 0xEB, 0x5C, 0x78, 0xEB, 0xF6, 0x99, 0x8D, 0x0D,
+    0xE5, 0x4E, 0xBE, 0x26, 0x76, 0x58, 0xBE, 0x57, 0xBE, 0x8C, 0x64, 0xFE, 0x07, 0xED, 0x55, 0xB1,
+    0x92, 0xDC, 0x44, 0x10, 0x7D, 0xD2, 0xD8, 0x6C, 0x81, 0x82, 0x49, 0xD8, 0xC8, 0xB8, 0xC6, 0x01,
+    0x91, 0xAB, 0x28, 0x25, 0x04, 0xA6, 0xCA, 0xB7, 0x23, 0x4C, 0xE0, 0x74, 0x83, 0xDD, 0x72, 0x48,
+    0xBE, 0xC9, 0x3A, 0x20, 0x20, 0xA0, 0x56, 0xC2, 0x5F, 0xE0, 0x3F, 0xC0, 0x01, 0x01, 0x2C, 0x01,
+    0x64, 0x60, 0x0A, 0xAF, 0x84, 0xFD, 0x03, 0xB2, 0x13, 0x42, 0xA6, 0xEA, 0xCE, 0x89, 0x1D, 0xEC,
+    0x50, 0x0C, 0x94, 0x6C, 0x66, 0x35, 0xBC, 0xD1, 0x1D, 0xE7, 0xBB, 0xB3, 0x21, 0x21, 0x04, 0x4D,
+    0x3F, 0xED, 0x6A, 0xD4, 0x3D, 0xD3, 0xDD, 0xAF, 0x7B, 0x84, 0x71, 0x81, 0x34, 0x58, 0xC8, 0x5F,
+    0x3C, 0x54, 0xD3, 0x43, 0x37, 0x35, 0x51, 0x16, 0xBA, 0x3A, 0x03, 0xCE, 0xE5, 0x7C, 0x17, 0x75,
+    0xB2, 0xDF, 0x3D, 0x6D, 0x0C, 0x70, 0x1E, 0xC8, 0x1A, 0x69, 0xB2, 0x06, 0x18, 0x17, 0x65, 0x2B,
+    0x4F, 0x0F, 0x53, 0x76, 0xF3, 0x19, 0x92, 0x29, 0x30, 0xB2, 0x80, 0x24, 0x34, 0xF1, 0xAD, 0x45,
+    0xB2, 0x6F, 0x21, 0x1E, 0x58, 0x64, 0xC2, 0xE2, 0x22, 0x31, 0xF9, 0xEA, 0x79, 0x51, 0x86, 0xD0,
+    0x60, 0xE4, 0x00, 0x3E, 0xE3, 0xC2, 0x33, 0xA0, 0x0C, 0x38, 0xBA, 0xF2, 0x60, 0x29, 0x93, 0xB5,
+    0xBD, 0x8A, 0x9B, 0x57, 0x80, 0xF7, 0xBE, 0x84, 0x0E, 0xE6, 0x6D, 0xE9, 0x20, 0x3C, 0xE5, 0x63,
+    0xE1, 0xFD, 0xA8, 0xAB, 0x97, 0xD4, 0xA9, 0x30, 0x8D, 0x8E, 0x30, 0x1C, 0xF9, 0x63, 0xA7, 0xE0,
+    0x34, 0x8A, 0x15, 0xB0, 0x5A, 0x14, 0xF5, 0x53, 0xBB, 0x49, 0xBB, 0x4D, 0xE2, 0x57, 0x89, 0xD7,
+    0x51, 0x3A, 0xF9, 0xC0, 0x0A, 0x6E, 0xF8, 0x66, 0x5C, 0xBF, 0x0E, 0x3E, 0x04, 0xDF, 0xAF, 0x3B,
+    0x0B, 0x7B, 0x27, 0xA1, 0x6B, 0x2D, 0xA3, 0x82, 0x2C, 0x90, 0xD3, 0x18, 0xF0, 0x48, 0x3A, 0x08,
+    0x37, 0x04, 0x81, 0xB8, 0x3E, 0x44, 0xE8, 0x20, 0x4D, 0x8F, 0xBC, 0x29, 0x07, 0x28, 0xDB, 0x43,
+    0x06, 0x37, 0xE4, 0x24, 0x0D, 0x3B, 0xA8, 0x47, 0x01, 0xCC, 0x59, 0xA5, 0x99, 0x39, 0x8E, 0x42,
+    0x3D, 0xEE, 0x31, 0xA2, 0x0D, 0xC6, 0xB4, 0x9F, 0x21, 0x0B, 0x55, 0x7E, 0xDD, 0x94, 0xA9, 0xDB,
+    0x24, 0xDD, 0x06, 0x9E, 0xA2, 0xAF, 0x79, 0xD5, 0xFB, 0xE4, 0xCE, 0xB0, 0x55, 0xEA, 0xDE, 0x15,
+    0x76, 0x2F, 0x6B, 0x54, 0x3F, 0xE4, 0x2E, 0x5E, 0xEA, 0x34, 0xC6, 0xCB, 0x39, 0x53, 0x10, 0x8A,
+    0xCB, 0xF5, 0xBA, 0x38, 0xFB, 0x2E, 0x72, 0x32, 0x9E, 0x1F, 0xBD, 0x5F, 0xAF, 0x8B, 0xF8, 0x1B,
+    0x81, 0x13, 0xD7, 0xA9, 0xB9, 0x73, 0xF8, 0x24, 0x75, 0xB2, 0xCD, 0xE9, 0x67, 0x89, 0x1A, 0xFD,
+    0xD1, 0xA8, 0x39, 0x4A, 0xD0, 0xF7, 0x26, 0xB3, 0x89, 0xC7, 0x45, 0xA0, 0x40, 0xC7, 0x67, 0xD9,
+    0x8E, 0xAC, 0xE8, 0x52, 0x9F, 0x9C, 0x18, 0xA9, 0x4F, 0x3B, 0x61, 0x33, 0xA3, 0xAA, 0x7B, 0x30,
+    0x31, 0x45, 0xEF, 0xDF, 0x46, 0xF9, 0x33, 0x73, 0xE2, 0x6A, 0xE6, 0x89, 0x36, 0x11, 0xED, 0x19,
+    0x70, 0xAE, 0xEC, 0xB4, 0x19, 0xCF, 0xC6, 0x53, 0xFC, 0xCB, 0x1A, 0x8C, 0x34, 0x32, 0xC3, 0x3D,
+    0xCA, 0x0D, 0xAE, 0x6C, 0x80, 0xBF, 0x91, 0x71, 0x98, 0xEA, 0xC8, 0x02, 0x92, 0x39, 0x6B, 0xAA,
+    0x29, 0x33, 0xBB, 0x1A, 0xB9, 0xC9, 0x21, 0xB3, 0x99, 0x81, 0x6C, 0x30, 0x01, 0x63, 0x14, 0xED,
+    0x39, 0x85, 0xB7, 0x56, 0xEB, 0x1F, 0xC2, 0x50, 0x17, 0x51, 0x7F, 0x06, 0x15, 0x1A, 0x3D, 0xE8,
+    0xBF, 0x73, 0xA8, 0xAF, 0x5A, 0x11, 0x90, 0x2C, 0x0D, 0x04, 0x09, 0xF3, 0x37, 0x53, 0xEF, 0x44,
+    0xD7, 0x7F, 0xC8, 0x1A, 0x2C, 0x22, 0x67, 0xFF, 0xD7, 0xFC, 0x7F, 0xAE, 0xE6, 0x5F, 0x7B, 0x0E,
+    0xFD, 0x75, 0x3B, 0xC9, 0xCC, 0xEB, 0xB1, 0x9A, 0xAC, 0x0A, 0xB6, 0x1E, 0xD9, 0x1D, 0x25, 0xB3,
+    0xBD, 0xB2, 0xFA, 0xD7, 0xDD, 0x79, 0xD6, 0xF8, 0x5D, 0xA8, 0x6D, 0xA3, 0x85, 0xDD, 0x08, 0xD7,
+    0x0B, 0x17, 0x82, 0xDB, 0xC5, 0xC2, 0xE5, 0x9E, 0x97, 0xF4, 0xA7, 0x36, 0x0B, 0x2D, 0x13, 0x95,
+    0x6E, 0xA0, 0x9E, 0x1A, 0x1D, 0x13, 0xE5, 0x77, 0xA0, 0xEC, 0x86, 0xFB, 0xC0, 0xE2, 0x07, 0xEE,
+    0x50, 0xE7, 0xF2, 0x17, 0x8B, 0x2A, 0xEF, 0xCA, 0x8A, 0xD5, 0x88, 0xC4, 0x7F, 0x44, 0x36, 0x5B,
+    0x06, 0xC8, 0x43, 0x58, 0xD3, 0x93, 0x7D, 0xD6, 0x48, 0xB3, 0x23, 0x95, 0x75, 0x51, 0xEF, 0x87,
+    0x81, 0xBF, 0x37, 0x9E, 0x31, 0xFC, 0xEA, 0x1B, 0x69, 0x22, 0x9F, 0xC2, 0xCD, 0x6F, 0x0C, 0x5B,
+    0x0B, 0x77, 0x4F, 0x58, 0x2D, 0x5B, 0xC5, 0xA4, 0xCC, 0x86, 0x25, 0x14, 0x21, 0xFF, 0xC2, 0xA3,
+    0x03, 0xC8, 0x2D, 0x39, 0xB6, 0xE5, 0x8B, 0x1E, 0x7E, 0x19, 0x55, 0xE9, 0xF5, 0xB0, 0xC7, 0x4B,
+    0xF6, 0x0F, 0xD7, 0x95, 0x6C, 0x03, 0xF1, 0x1D, 0xFF, 0xB3, 0xBB, 0x7E, 0x62, 0x79, 0x6D, 0x5B,
+    0xC8, 0x3F, 0xD8, 0xE7, 0xFB, 0x9E, 0x3A, 0x5C, 0xDB, 0x94, 0x45, 0xED, 0x95, 0x39, 0xB4, 0x57,
+    0x67, 0xBF, 0x1F, 0xC7, 0xDF, 0x91, 0x9A, 0x4D, 0xB8, 0xB8, 0xD5, 0x5D, 0xB8, 0x8D, 0x7C, 0x1B,
+    0xEA, 0x2E, 0xFA, 0x74, 0xDF, 0x47, 0xAF, 0x2A, 0xC6, 0xC9, 0xB3, 0xE4, 0x1F, 0xEE, 0x83, 0x4E,
+    0xF4, 0x91, 0x8D, 0x32, 0x5C, 0x8B, 0x5B, 0x07, 0x58, 0x9E, 0x8C, 0xAB, 0x7D, 0xE5, 0xD9, 0x74,
+    0x1C, 0xD7, 0xE2, 0xDA, 0xE7, 0x58, 0xC6, 0xB3, 0xCC, 0xC6, 0xF9, 0x9C, 0xF1, 0xA8, 0xE6, 0x05,
+    0xF2, 0x66, 0x98, 0x73, 0x5C, 0x6B, 0xCB, 0xDD, 0x1E, 0x4E, 0x8F, 0xE3, 0xCF, 0xD9, 0xD6, 0x35,
+    0xE9, 0x4D, 0xBF, 0x87, 0xFA, 0xAC, 0xD9, 0x13, 0x8D, 0x4E, 0xA0, 0x0F, 0x78, 0x8E, 0xB0, 0x55,
+    0x5B, 0x28, 0x73, 0x55, 0x98, 0x3D, 0xD1, 0xC6, 0xF3, 0x82, 0x9C, 0xB7, 0xB1, 0xFF, 0xD4, 0x93,
+    0xD8, 0xFF, 0xB4, 0x7D, 0x85, 0xFC, 0xC6, 0x5E, 0x8A, 0x2C, 0xFD, 0x09, 0x95, 0x58, 0x31, 0x8C,
+    0xDD, 0xC6, 0x11, 0x1D, 0x92, 0x96, 0x98, 0xE4, 0x03, 0xA1, 0x0A, 0x5D, 0x52, 0x28, 0x31, 0x53,
+    0x0A, 0x8A, 0x24, 0xB6, 0x2E, 0xEE, 0xB4, 0x54, 0x9A, 0x14, 0x29, 0x7C, 0x85, 0xBE, 0x54, 0xB8,
+    0x50, 0x93, 0x4A, 0x45, 0xAE, 0x51, 0xE1, 0x42, 0x16, 0x29, 0x04, 0x70, 0x8A, 0x14, 0xB9, 0x22,
+    0xA9, 0xD2, 0xA8, 0x50, 0x93, 0x7F, 0x85, 0x1C, 0xC0, 0x85, 0x81, 0x58, 0x22, 0x4F, 0x87, 0x40,
+    0x40, 0x02, 0x04, 0xB4, 0x00, 0x47, 0x85, 0x0B, 0x51, 0x96, 0x94, 0x20, 0xA7, 0xE2, 0x68, 0x88,
+    0x8E, 0x79, 0x77, 0x24, 0x27, 0x6F, 0x66, 0xC9, 0xFF, 0xEF, 0x24, 0x25, 0xB1, 0x3F, 0xEE, 0xDE,
+    0xCE, 0xDF, 0x5D, 0x2E, 0x67, 0x67, 0xDE, 0xCE, 0xCC, 0x7E, 0x22, 0xFD, 0xAC, 0xF1, 0x3A, 0x91,
+    0xCB, 0x5C, 0x13, 0x05, 0x8D, 0xDF, 0x12, 0x45, 0xA5, 0xD7, 0x10, 0x99, 0xC2, 0x2D, 0x89, 0xB2,
+    0x5C, 0xA6, 0x58, 0xE4, 0xFC, 0xCA, 0x6C, 0x76, 0x8B, 0xF3, 0x8C, 0xB9, 0xC9, 0x72, 0xBF, 0xBF,
+    0xD8, 0x24, 0xB9, 0xD7, 0x51, 0x63, 0x0A, 0xC1, 0xA8, 0x02, 0x52, 0xD0, 0x0A, 0xBA, 0xFC, 0xBC,
+    0x9F, 0xC5, 0x58, 0x99, 0x19, 0x4F, 0x7E, 0xBF, 0x9F, 0xE2, 0x69, 0xE9, 0x3F, 0x80, 0x27, 0x15,
+    0x57, 0x14, 0xDF, 0x13, 0x25, 0x18, 0x23, 0x99, 0xA2, 0x73, 0x3E, 0x46, 0xF7, 0x56, 0x0A, 0xF8,
+    0x15, 0xE0, 0xC4, 0xEF, 0x63, 0xF2, 0x99, 0x4B, 0x4A, 0x38, 0x6B, 0x5D, 0xFE, 0x5B, 0xC0, 0x3E,
+    0xBF, 0x19, 0x72, 0xD0, 0x9E, 0x39, 0xC3, 0x51, 0x7B, 0x7A, 0xB9, 0x35, 0xCD, 0xF2, 0xF2, 0xAA,
+    0xA9, 0xDF, 0x7A, 0x97, 0x92, 0xFA, 0xEA, 0x55, 0x4A, 0xAA, 0x0F, 0x3E, 0x00, 0x54, 0x15, 0xBE,
+    0x56, 0x25, 0x99, 0xFA, 0x71, 0x41, 0x66, 0xF7, 0x41, 0x41, 0x51, 0xBF, 0x95, 0x53, 0xC0, 0x5B,
+    0xF9, 0xD1, 0x09, 0x6F, 0xA5, 0xA1, 0xC7, 0xCF, 0xCF, 0xF7, 0xF2, 0xCA, 0x96, 0x42, 0x59, 0x3E,
+    0x58, 0xFB, 0x03, 0xD1, 0x77, 0xDF, 0x84, 0x7A, 0x3F, 0x3C, 0x03, 0x38, 0x7D, 0x9A, 0x86, 0x8F,
+    0x93, 0xC1, 0x42, 0x98, 0xD2, 0x50, 0x56, 0x06, 0xBD, 0xCB, 0xB1, 0xC7, 0x7E, 0x8F, 0x3D, 0x06,
+    0x2D, 0x39, 0x6D, 0x08, 0x83, 0xAD, 0x47, 0xB0, 0x17, 0x5E, 0xA4, 0x30, 0x3D, 0x7F, 0xCB, 0xD4,
+    0xFC, 0xD7, 0x3E, 0xA9, 0xA3, 0x1D, 0x4E, 0xEA, 0xB0, 0xCE, 0x4C, 0x1D, 0x56, 0xEF, 0x02, 0xA0,
+    0x4B, 0x03, 0x88, 0x04, 0xC2, 0x16, 0x10, 0x74, 0x00, 0x9F, 0xC3, 0x72, 0xE2, 0xF1, 0x4E, 0x19,
+    0x11, 0xF3, 0x3F, 0x3A, 0x8A, 0xE4, 0x45, 0x70, 0x07, 0x76, 0x7E, 0x64, 0x15, 0x5D, 0x90, 0x04,
+    0x72, 0x9F, 0xE3, 0xB5, 0xDC, 0x63, 0x0A, 0x04, 0x26, 0x02, 0xBE, 0x80, 0x03, 0x6D, 0xC4, 0xA2,
+    0x2F, 0x03, 0x16, 0x19, 0xE0, 0xD0, 0x00, 0xB6, 0x1B, 0xCB, 0xA2, 0xE9, 0xAB, 0x4F, 0xC4, 0x32,
+    0xDA, 0x93, 0x8C, 0x8E, 0x3B, 0xF7, 0xB1, 0x00, 0xCC, 0x8E, 0xEF, 0x7C, 0x83, 0x53, 0x97, 0x41,
+    0x04, 0xB8, 0x4B, 0xBD, 0x9E, 0x88, 0xE3, 0x8E, 0x91, 0x87, 0x07, 0xA0, 0xAD, 0x58, 0x49, 0xE0,
+    0x14, 0xCF, 0x6E, 0x92, 0x11, 0x2E, 0x2D, 0x65, 0xCF, 0x56, 0x85, 0x44, 0xE8, 0xCB, 0xF6, 0x86,
+    0xBE, 0x53, 0xD9, 0xF6, 0x4D, 0xF4, 0x09, 0x99, 0x8C, 0x2C, 0xDF, 0xAD, 0xD2, 0x8F, 0xA0, 0xE4,
+    0xC5, 0x0A, 0xC6, 0xE5, 0x0A, 0x1B, 0xE7, 0xE2, 0x2C, 0x0C, 0x9D, 0x1E, 0x23, 0x3A, 0x4E, 0x87,
+    0x3F, 0xF5, 0xE8, 0x8B, 0x6A, 0x10, 0xBC, 0xD2, 0xB6, 0xC7, 0xBD, 0x4D, 0x28, 0x6E, 0x78, 0xC2,
+    0xBF, 0x16, 0xEE, 0x18, 0x36, 0x62, 0xAD, 0x18, 0xFB, 0xD9, 0x63, 0x7E, 0x0E, 0xFA, 0xB9, 0x5C,
+    0x18, 0x26, 0x2E, 0x20, 0xE4, 0x61, 0x07, 0x17, 0x42, 0x48, 0xE1, 0x3A, 0x15, 0x62, 0x08, 0xC9,
+    0x37, 0x17, 0xC2, 0x51, 0x88, 0x46, 0xC1, 0xA8, 0xE0, 0x71, 0x9A, 0xC1, 0x34, 0x60, 0x1E, 0x37,
+    0xD8, 0x4C, 0xC2, 0x10, 0x3A, 0x2B, 0xC0, 0x4A, 0xE5, 0xA8, 0x7A, 0x31, 0x9A, 0x37, 0x1F, 0x84,
+    0x20, 0x3D, 0xBC, 0x5B, 0x83, 0x0D, 0x18, 0x2E, 0x0D, 0xD4, 0x47, 0xE3, 0x70, 0x05, 0xA2, 0xC1,
+    0x07, 0x70, 0x06, 0xFE, 0x64, 0x9B, 0xD2, 0xB0, 0x36, 0xFB, 0x70, 0xA5, 0xF4, 0x63, 0x83, 0xD2,
+    0x64, 0x15, 0x9A, 0x4C, 0x4C, 0xC0, 0xD5, 0xD0, 0x50, 0x03, 0xEA, 0xC8, 0x98, 0xC7, 0xC5, 0x7C,
+    0x6C, 0xD6, 0xCF, 0xB2, 0xBE, 0xBF, 0x89, 0xC9, 0x61, 0xAB, 0xCB, 0x4E, 0xEC, 0xEA, 0x9E, 0x6D,
+    0x9C, 0xE1, 0x5D, 0x99, 0x6D, 0x4C, 0xA3, 0x0A, 0x04, 0x0D, 0xD4, 0x29, 0x68, 0x22, 0x0D, 0x36,
+    0x2B, 0x0D, 0xDF, 0xB2, 0xFA, 0x2A, 0x5F, 0x61, 0x88, 0xCD, 0xAC, 0xB2, 0xA1, 0x22, 0x6C, 0x6C,
+    0x0B, 0x9B, 0x69, 0x3B, 0xE9, 0x0E, 0xB7, 0x7E, 0xE7, 0xC4, 0xF6, 0xBB, 0x9F, 0x6A, 0xDB, 0x06,
+    0xA9, 0x9D, 0x1F, 0x69, 0x1B, 0x55, 0xD9, 0xA7, 0x68, 0x37, 0xB3, 0x87, 0x03, 0x63, 0x7D, 0xDB,
+    0xDE, 0xA4, 0x44, 0xC7, 0xE9, 0xEB, 0xB7, 0x39, 0xB6, 0x53, 0x28, 0x17, 0x0D, 0xAB, 0x61, 0x53,
+    0x23, 0xEA, 0x06, 0x3C, 0x58, 0xFD, 0x82, 0xF4, 0xFF, 0x6B, 0xB4, 0x3C, 0xB3, 0x75, 0x0F, 0xE8,
+    0x92, 0x34, 0xB6, 0x13, 0x5A, 0x75, 0xA3, 0x34, 0xE9, 0x47, 0xC9, 0x87, 0x03, 0xDE, 0x18, 0x25,
+    0x35, 0x9F, 0x4A, 0xE6, 0x39, 0x0F, 0xF3, 0x70, 0x5C, 0x62, 0x7D, 0xD6, 0xE9, 0xC9, 0xC4, 0x6A,
+    0x13, 0x48, 0xE7, 0x30, 0xFA, 0x69, 0x06, 0xA7, 0xC6, 0x64, 0xCF, 0x9A, 0x23, 0x91, 0x97, 0x58,
+    0x1F, 0x93, 0x50, 0xCC, 0x9B, 0x50, 0xCC, 0xB0, 0x38, 0x3C, 0x17, 0x6B, 0xEB, 0xF1, 0xCB, 0x41,
+    0x2A, 0xF8, 0x2E, 0x85, 0x24, 0x71, 0xC6, 0xC7, 0xC6, 0xB0, 0x5E, 0x4B, 0x1F, 0x4A, 0x6C, 0x96,
+    0x77, 0xB8, 0xB5, 0x1C, 0x2C, 0xD1, 0xC0, 0x6B, 0x21, 0x39, 0x8C, 0xE0, 0x70, 0xAF, 0xA7, 0x24,
+    0x36, 0x38, 0xD3, 0x60, 0xE3, 0xF3, 0x4E, 0xF6, 0x46, 0x27, 0xDA, 0x88, 0x9F, 0x8E, 0x34, 0xBB,
+    0xA0, 0xFB, 0xA5, 0xA3, 0xEB, 0x78, 0x71, 0x2C, 0x52, 0x50, 0x41, 0x4A, 0x3D, 0x09, 0x86, 0x35,
+    0x4D, 0x6A, 0xB5, 0x1B, 0x62, 0x9B, 0x87, 0x77, 0xA3, 0x0F, 0x1C, 0xF7, 0x61, 0x1B, 0x78, 0xD8,
+    0x74, 0x88, 0x40, 0x24, 0x44, 0xBF, 0xDE, 0x23, 0x20, 0x69, 0xEC, 0xFB, 0x88, 0x95, 0xC6, 0xA0,
+    0x4A, 0xCD, 0x14, 0x62, 0x73, 0xD0, 0xAE, 0xCA, 0xE2, 0x08, 0x01, 0xE0, 0x76, 0x3F, 0xDB, 0xE3,
+    0xED, 0x6C, 0x16, 0xEB, 0xD9, 0xD4, 0x68, 0xB6, 0xF4, 0x0E, 0x5F, 0x7A, 0x96, 0x3C, 0xBB, 0x3B,
+    0x95, 0xD8, 0xEE, 0xE7, 0x51, 0x79, 0x4D, 0x63, 0xD0, 0x24, 0x0D, 0xAA, 0x8F, 0xD5, 0xF8, 0x6F,
+    0xC7, 0x41, 0xDD, 0x68, 0x58, 0xF9, 0x0D, 0x08, 0xA7, 0xC7, 0x9F, 0x1F, 0x91, 0xDF, 0x59, 0x7A,
+    0xF5, 0x24, 0x4A, 0xE2, 0x93, 0xB4, 0x90, 0xD4, 0x61, 0xD0, 0xCE, 0x65, 0x3D, 0x50, 0xA6, 0xB1,
+    0x8E, 0x47, 0x26, 0xC3, 0x73, 0xD6, 0xCB, 0x81, 0x98, 0x4F, 0x23, 0x1C, 0x1C, 0x65, 0x0A, 0x39,
+    0x05, 0x31, 0x9A, 0xED, 0x0D, 0x44, 0x87, 0x02, 0x26, 0x8C, 0x2A, 0x6D, 0x82, 0xA1, 0xA9, 0x17,
+    0xCD, 0x3D, 0x0E, 0x9A, 0xAF, 0xDB, 0x08, 0xC9, 0xB4, 0x49, 0xF2, 0x83, 0x0D, 0xA2, 0xC2, 0x3D,
+    0x9E, 0x6D, 0x80, 0x0F, 0xF7, 0x58, 0x32, 0x9C, 0x36, 0xA2, 0xF4, 0xD2, 0x34, 0x56, 0xCE, 0x89,
+    0x7C, 0xC2, 0x6E, 0x63, 0x81, 0x9E, 0x06, 0x62, 0x77, 0xC6, 0x7B, 0x87, 0xFB, 0xB3, 0x1A, 0xE8,
+    0x73, 0x97, 0x15, 0x14, 0xF4, 0xEF, 0xA8, 0x87, 0xC4, 0x04, 0xA6, 0x72, 0x14, 0x65, 0x4E, 0x62,
+    0xB1, 0x7C, 0x05, 0xB5, 0xDF, 0x0C, 0x68, 0xBD, 0x8B, 0xF8, 0x88, 0x75, 0x4E, 0xC0, 0xAB, 0x3E,
+    0xF7, 0x46, 0xE8, 0xD8, 0x44, 0x78, 0xEF, 0x91, 0x97, 0x02, 0xB0, 0xF0, 0x10, 0xB1, 0xE4, 0xE8,
+    0x6C, 0x86, 0x08, 0x3F, 0x7C, 0xB2, 0x5D, 0xED, 0x86, 0xF5, 0x4A, 0x89, 0x79, 0x38, 0xB3, 0x84,
+    0xD8, 0x88, 0x75, 0x29, 0x28, 0x90, 0x13, 0xBE, 0x3D, 0x64, 0x96, 0xDE, 0x9E, 0xAB, 0xCA, 0x82,
+    0x2F, 0x5F, 0xFD, 0xA1, 0x2F, 0xB6, 0xB0, 0x48, 0x43, 0x43, 0x2A, 0xD1, 0xB3, 0x91, 0x23, 0xBF,
+    0x40, 0xEF, 0x8A, 0xA2, 0x5D, 0xBF, 0xB4, 0x2F, 0x72, 0x32, 0x79, 0xD0, 0xD1, 0xC7, 0x7E, 0xCA,
+    0x9D, 0x6D, 0x7A, 0x3C, 0xA0, 0xDB, 0x93, 0xFF, 0xCC, 0x5A, 0xA9, 0xD5, 0x46, 0x88, 0x8B, 0x66,
+    0x52, 0x68, 0x13, 0xE9, 0xAA, 0xC5, 0x1D, 0x35, 0xE4, 0x03, 0x21, 0xD7, 0x12, 0x3F, 0xEC, 0xA6,
+    0x17, 0x6C, 0x4C, 0x6C, 0xC7, 0x86, 0x78, 0x5F, 0x39, 0xC3, 0x0F, 0xD8, 0x3E, 0xC7, 0x76, 0x15,
+    0x8D, 0x06, 0xA0, 0x4B, 0xA7, 0x4D, 0xC0, 0x76, 0x69, 0x99, 0x8A, 0x17, 0x09, 0xDF, 0x24, 0x52,
+    0xD7, 0xBA, 0xA1, 0x4C, 0x8F, 0x53, 0x3C, 0xE1, 0x38, 0x51, 0xB6, 0xEB, 0xCA, 0x45, 0x16, 0x73,
+    0x79, 0xB9, 0xF8, 0x18, 0xF3, 0x7C, 0x45, 0xAF, 0xF8, 0x48, 0xF1, 0xE7, 0x40, 0x57, 0x0E, 0x7E,
+    0x29, 0x96, 0xE5, 0x1D, 0x7D, 0x9D, 0x55, 0xA1, 0x56, 0x93, 0x94, 0x5A, 0xA5, 0x3D, 0x46, 0x16,
+    0xE8, 0xC5, 0x82, 0xB4, 0xCE, 0xD6, 0x40, 0xB5, 0xA6, 0x68, 0x19, 0x4D, 0x14, 0x3B, 0xC5, 0x75,
+    0x7B, 0x32, 0x06, 0xAC, 0xAC, 0xA1, 0x53, 0xC5, 0xFC, 0x25, 0x9F, 0x7E, 0x38, 0x0A, 0xEE, 0x98,
+    0x5F, 0x29, 0x18, 0xB3, 0x94, 0x93, 0x0C, 0xB3, 0x8F, 0x32, 0x0F, 0x31, 0xCF, 0xFC, 0xB3, 0x1F,
+    0x3A, 0xAF, 0xFA, 0x6D, 0x30, 0x64, 0x62, 0x5B, 0x33, 0xCA, 0x27, 0xAC, 0xBD, 0x61, 0x62, 0x54,
+    0xB9, 0x43, 0x0D, 0x21, 0x2C, 0x8B, 0x55, 0x12, 0x06, 0xDA, 0x80, 0x0B, 0xE2, 0x0E, 0x92, 0x44,
+    0xB1, 0x85, 0x64, 0x97, 0x96, 0x18, 0xA7, 0x7D, 0x78, 0xD0, 0xB1, 0x92, 0x2B, 0xAC, 0x8C, 0x7F,
+    0xB1, 0xAE, 0x1C, 0x71, 0xD9, 0x13, 0x27, 0x79, 0x12, 0x02, 0x82, 0xC7, 0xAC, 0x05, 0xA4, 0xD7,
+    0x45, 0x39, 0xC7, 0x47, 0x37, 0x5A, 0x9A, 0xB4, 0x26, 0xE7, 0x34, 0xC2, 0x8C, 0xA0, 0x4E, 0x20,
+    0xAD, 0x48, 0xCE, 0x2A, 0x33, 0x8C, 0x5E, 0x0B, 0x50, 0xEC, 0x21, 0xA0, 0x22, 0x42, 0x67, 0x3B,
+    0x12, 0x13, 0xF7, 0x51, 0xF7, 0x75, 0xAE, 0x38, 0x8D, 0x87, 0x3D, 0xBB, 0xF3, 0xC2, 0xC7, 0x5B,
+    0x48, 0xFD, 0xBC, 0x18, 0xEA, 0xE6, 0x47, 0xA1, 0x9D, 0x5B, 0xAB, 0x19, 0xA5, 0xEF, 0xDC, 0x5C,
+    0x98, 0xD5, 0x15, 0xB5, 0x43, 0x31, 0xBD, 0xD9, 0x92, 0x24, 0x7A, 0x5E, 0x48, 0x15, 0xCF, 0x41,
+    0xBF, 0xDE, 0x10, 0xD0, 0xD1, 0x2D, 0xCC, 0x4B, 0x3E, 0x2B, 0xC5, 0x41, 0x12, 0x49, 0xED, 0xB3,
+    0x44, 0xC7, 0x24, 0xE7, 0x2C, 0x4B, 0xBA, 0xB9, 0x23, 0x99, 0x86, 0x03, 0x09, 0xCC, 0x99, 0x04,
+    0x78, 0x50, 0x29, 0xD8, 0xE9, 0x92, 0x2A, 0x7A, 0xBB, 0x31, 0xB5, 0xF1, 0xAA, 0xB0, 0xB9, 0xE3,
+    0x6A, 0x9E, 0x8D, 0x45, 0xB1, 0x63, 0xD0, 0xD3, 0x95, 0x5A, 0xDC, 0xAF, 0x91, 0x09, 0xFC, 0x06,
+    0xE0, 0x75, 0x81, 0xC4, 0x72, 0xA1, 0x73, 0xD4, 0x0F, 0x49, 0xDB, 0xA6, 0x6C, 0x87, 0x3F, 0x91,
+    0x84, 0x8D, 0xB3, 0xD1, 0xD2, 0x15, 0xDE, 0xBE, 0xDD, 0xA7, 0x96, 0xAA, 0x53, 0x7E, 0x76, 0x59,
+    0xD2, 0x2D, 0xF8, 0x4D, 0x56, 0xB6, 0xFD, 0x76, 0x8E, 0xCC, 0x97, 0x18, 0xFB, 0x09, 0x6A, 0x28,
+    0xD2, 0x6A, 0x8B, 0x6C, 0x21, 0xF0, 0x72, 0x08, 0x7B, 0x2D, 0x96, 0x34, 0x72, 0x71, 0x64, 0xA4,
+    0x53, 0x2E, 0x70, 0x4D, 0xD2, 0xD3, 0x44, 0x17, 0x35, 0x5F, 0x7E, 0xCE, 0x48, 0x64, 0x9B, 0x65,
+    0x56, 0x7A, 0xEC, 0x94, 0xA6, 0x98, 0xF4, 0x40, 0xD4, 0x6E, 0x4E, 0x79, 0x1C, 0xD9, 0x45, 0xE6,
+    0x9B, 0xE6, 0x15, 0xAC, 0x0F, 0x60, 0x83, 0x4D, 0xF7, 0xC0, 0x7D, 0xDE, 0x05, 0x3E, 0xE6, 0x32,
+    0xC2, 0x53, 0x5C, 0x84, 0x8A, 0x41, 0x2F, 0xE8, 0xB3, 0x20, 0x0A, 0x97, 0x52, 0x82, 0xC7, 0xAE,
+    0x60, 0xC8, 0x36, 0xD4, 0xF0, 0xAE, 0x68, 0xF5, 0x74, 0xA1, 0x1B, 0xAD, 0x5B, 0x9A, 0x5B, 0x8E,
+    0x5B, 0xD7, 0x1B, 0xCB, 0x85, 0xC4, 0x92, 0xE3, 0x4F, 0x96, 0x2D, 0xFF, 0x56, 0xFA, 0x38, 0x5F,
+    0x28, 0xF5, 0xDD, 0x52, 0x59, 0xEC, 0x15, 0xBA, 0x59, 0x3F, 0x07, 0xFD, 0xE9, 0xCA, 0xED, 0x6D,
+    0xDE, 0x9B, 0xD9, 0xE8, 0xC0, 0xE9, 0xD2, 0xDA, 0x34, 0xD9, 0xC5, 0x1D, 0x29, 0x22, 0xAD, 0x9A,
+    0xCE, 0x91, 0x38, 0xD3, 0x8E, 0x8D, 0x53, 0x10, 0xD0, 0x84, 0x05, 0x4E, 0xAD, 0xD4, 0x74, 0x2B,
+    0x29, 0x35, 0x25, 0x2F, 0x4B, 0xCA, 0x9B, 0x54, 0x1A, 0x23, 0x32, 0xA9, 0x6B, 0xC0, 0x6B, 0x54,
+    0x08, 0x8B, 0x0A, 0x7E, 0xA2, 0xD9, 0x3E, 0xD3, 0x4C, 0xC2, 0x29, 0x4E, 0xAF, 0xDC, 0x20, 0x4A,
+    0x39, 0x33, 0x81, 0x16, 0x95, 0x20, 0x06, 0x6A, 0x6D, 0xBB, 0x25, 0x24, 0xF1, 0xA5, 0xE9, 0x45,
+    0xEC, 0x5A, 0xD3, 0x34, 0x9D, 0xDA, 0x60, 0xDE, 0x26, 0xB9, 0x8F, 0x48, 0xA0, 0xE4, 0x6E, 0x3A,
+    0xF4, 0x47, 0xD0, 0x7C, 0x46, 0x1A, 0xF8, 0x48, 0x38, 0x1A, 0x8B, 0xBA, 0xD0, 0x08, 0x65, 0xA1,
+    0x12, 0x4E, 0xD0, 0x93, 0x93, 0x28, 0x57, 0x02, 0xB1, 0x52, 0xB2, 0x2F, 0x3E, 0xF7, 0x6D, 0xD0,
+    0x3A, 0xA2, 0xD1, 0xC0, 0xCB, 0x07, 0xD0, 0xBB, 0x55, 0x20, 0x49, 0x39, 0x79, 0xF2, 0xA8, 0x77,
+    0xF8, 0x97, 0x5B, 0x38, 0xDE, 0x1E, 0x12, 0x6A, 0xE7, 0x6D, 0xB6, 0xB8, 0x4C, 0xE6, 0xEB, 0x11,
+    0x00, 0x9E, 0x3C, 0x0C, 0xF5, 0x1C, 0x0E, 0x0F, 0xE8, 0xE4, 0x50, 0x20, 0xE8, 0x01, 0x28, 0x86,
+    0xF2, 0x89, 0x8B, 0x1B, 0x5F, 0x44, 0xD9, 0xFE, 0xDF, 0x17, 0x77, 0xAB, 0xF5, 0xA1, 0x08, 0x57,
+    0x35, 0xDC, 0x14, 0xAA, 0xE3, 0xD0, 0x04, 0xED, 0xE4, 0xF5, 0x20, 0xD4, 0x6F, 0x35, 0x37, 0xFC,
+    0xD7, 0x29, 0xFF, 0x0F, 0x74, 0x79, 0x24, 0x3D, 0xEC, 0x88, 0x2F, 0x08, 0x74, 0x72, 0x03, 0x69,
+    0xE7, 0xF6, 0x18, 0x1C, 0x25, 0x7E, 0xF2, 0x10, 0x93, 0x52, 0xD4, 0x5E, 0x28, 0xEA, 0x24, 0xA7,
+    0x02, 0x4C, 0x8C, 0x30, 0x73, 0x5C, 0x6D, 0x6D, 0x8B, 0x56, 0x5F, 0x98, 0xE9, 0xEA, 0x79, 0xCE,
+    0xA4, 0xEE, 0x0C, 0xC5, 0x45, 0x8E, 0x06, 0xF9, 0x89, 0x90, 0x4C, 0xCB, 0x5D, 0x84, 0xBD, 0xF0,
+    0xD1, 0xF5, 0xB0, 0x3C, 0xF7, 0xD5, 0xCE, 0xE5, 0xE2, 0xAD, 0x17, 0xF7, 0x2F, 0xE7, 0xCB, 0x4F,
+    0xEE, 0xAF, 0xA5, 0x67, 0x9F, 0xDC, 0x07, 0x03, 0xF6, 0x77, 0xDA, 0x61, 0x81, 0x17, 0x9F, 0x41,
+    0x81, 0x27, 0xF7, 0x01, 0x9F, 0xDF, 0xD7, 0xB4, 0xCA, 0x95, 0xC2, 0xD2, 0x74, 0x3A, 0x5D, 0x55,
+    0xCD, 0x4E, 0x49, 0xCA, 0xB7, 0x03, 0x0F, 0xF9, 0x72, 0x75, 0x0E, 0xFE, 0xA9, 0x56, 0x70, 0x20,
+    0xAB, 0x65, 0x70, 0xC9, 0x02, 0xBD, 0xFE, 0x0E, 0xFA, 0xBF, 0xC0, 0xB7, 0xF7, 0x4D, 0xBD, 0xC8,
+    0x34, 0x4A, 0x76, 0xB5, 0x33, 0x02, 0x80, 0xDD, 0xA6, 0x4E, 0x01, 0xF1, 0x2E, 0xF1, 0xEF, 0xEC,
+    0xC0, 0x95, 0x0D, 0x61, 0xA3, 0xF4, 0xD9, 0x51, 0xC9, 0xC3, 0xDF, 0x93, 0x14, 0x28, 0x55, 0x31,
+    0x69, 0x72, 0xD6, 0xB3, 0xA8, 0x83, 0x13, 0x59, 0xDD, 0xB3, 0xB6, 0x28, 0xC7, 0x54, 0xA9, 0xC3,
+    0x91, 0x1D, 0xAE, 0x84, 0x7A, 0x5A, 0x91, 0xD8, 0x1A, 0x78, 0x9C, 0x97, 0x2B, 0xE0, 0x02, 0xCA,
+    0xF7, 0x24, 0x2E, 0x4A, 0x27, 0xEB, 0x0F, 0x1A, 0xC5, 0x31, 0xCC, 0x43, 0xDF, 0x1D, 0xDC, 0xD4,
+    0x69, 0x55, 0x32, 0xA2, 0x5A, 0x39, 0xC2, 0x69, 0xCB, 0xEF, 0x4A, 0x79, 0xBE, 0xCA, 0xF9, 0x1A,
+    0xEA, 0x9F, 0xDC, 0x13, 0xD7, 0xB9, 0xD5, 0x08, 0x9E, 0x42, 0x81, 0xC9, 0x21, 0xD2, 0x12, 0x6B,
+    0xF8, 0x1D, 0x53, 0xEC, 0x44, 0x43, 0x88, 0x6A, 0x44, 0x2B, 0x6B, 0x42, 0x84, 0x6B, 0x72, 0x19,
+    0xA2, 0x6B, 0xDE, 0x9F, 0x67, 0xF0, 0xC5, 0x06, 0xDB, 0x72, 0x42, 0x92, 0x19, 0xF7, 0x33, 0x24,
+    0xC1, 0x4B, 0x60, 0x38, 0x94, 0x01, 0xBB, 0xE3, 0x11, 0xFF, 0xF2, 0x83, 0x40, 0xD4, 0x7B, 0x4F,
+    0x91, 0xAF, 0x63, 0xD7, 0x2F, 0x24, 0x3D, 0x06, 0x9B, 0x5B, 0x12, 0x00, 0x73, 0x07, 0xCB, 0xF5,
+    0x1A, 0x77, 0xFF, 0x58, 0xD2, 0xB7, 0xF4, 0xFE, 0x7C, 0x56, 0x2A, 0x05, 0xBA, 0xAB, 0x55, 0x43,
+    0xAF, 0xEF, 0x6F, 0xE7, 0x75, 0x04, 0x2D, 0x69, 0x2E, 0xB3, 0xB9, 0x2D, 0x7E, 0x19, 0xD7, 0x7E,
+    0xAB, 0xD3, 0xF5, 0x92, 0xA2, 0xBF, 0x2D, 0xF4, 0xC1, 0xCF, 0xC0, 0xE9, 0x26, 0xF8, 0x09, 0x2A,
+    0xFE, 0x2A, 0x88, 0x91, 0x78, 0x81, 0x59, 0x6E, 0xCA, 0x20, 0x4E, 0x72, 0x53, 0x04, 0x28, 0xB1,
+    0x2D, 0x26, 0x82, 0x25, 0xD8, 0xFC, 0x8D, 0x10, 0xE1, 0x6C, 0x5D, 0x0D, 0x00, 0x57, 0xDE, 0x90,
+    0x20, 0x9D, 0x26, 0x28, 0x2C, 0x52, 0x53, 0x03, 0xA4, 0x70, 0x4D, 0xA3, 0x76, 0x2E, 0x09, 0x18,
+    0x19, 0x4D, 0x4A, 0x97, 0xDF, 0xD7, 0x18, 0xD8, 0xD3, 0x8F, 0x79, 0x7B, 0xDD, 0x66, 0x63, 0x77,
+    0xA8, 0x80, 0x52, 0x9B, 0x74, 0x16, 0x7D, 0x0A, 0xDE, 0x90, 0x8D, 0xD2, 0x31, 0x25, 0xAD, 0x2A,
+    0xF5, 0xAB, 0x6A, 0x81, 0x5F, 0x56, 0xCA, 0x9B, 0x5E, 0x58, 0xBB, 0x07, 0xFA, 0xB8, 0x5D, 0xF5,
+    0x15, 0x82, 0x5C, 0x5D, 0x7D, 0x21, 0xD7, 0xA6, 0x4A, 0x6E, 0x3A, 0x45, 0x55, 0x19, 0xB0, 0x41,
+    0x30, 0x11, 0x84, 0x0D, 0xAA, 0xF2, 0x0C, 0xD9, 0x92, 0xE9, 0x20, 0x9A, 0x03, 0x18, 0x16, 0xE3,
+    0xF5, 0x04, 0x6A, 0x68, 0x18, 0x76, 0x34, 0xA3, 0x5C, 0x61, 0x1C, 0x3B, 0x5B, 0x92, 0x1E, 0x42,
+    0x5A, 0x59, 0x26, 0x0B, 0xD9, 0xF0, 0x8B, 0x19, 0x2E, 0x6B, 0xED, 0x5A, 0x03, 0x37, 0x20, 0xE2,
+    0x06, 0x8D, 0x44, 0xF6, 0xC6, 0xEB, 0xE7, 0xD0, 0xD9, 0x02, 0x0D, 0xA3, 0x98, 0xA2, 0x77, 0x06,
+    0x89, 0xC3, 0x41, 0x7F, 0xBB, 0x1E, 0x07, 0x24, 0x23, 0xC0, 0x7A, 0x00, 0x14, 0x59, 0x07, 0x41,
+    0xFB, 0x74, 0xD4, 0x06, 0xC1, 0x5A, 0x20, 0x3D, 0xA0, 0x01, 0x9D, 0x3C, 0x49, 0xF3, 0xDF, 0x10,
+    0x51, 0x9C, 0x34, 0x12, 0xED, 0xA2, 0xDA, 0xEB, 0x4C, 0xE5, 0xB5, 0xF0, 0xC3, 0x53, 0xA9, 0x0F,
+    0xB4, 0x46, 0x18, 0xFE, 0xC7, 0xEF, 0x72, 0x99, 0xC5, 0x2D, 0xE4, 0x0D, 0x54, 0x1D, 0x67, 0x02,
+    0xD4, 0x43, 0xFA, 0x4B, 0x95, 0x64, 0x02, 0x67, 0x75, 0x5E, 0x44, 0x21, 0x24, 0xB4, 0xE3, 0xFF,
+    0x7F, 0x00, 0x63, 0x60, 0x60, 0x60, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x0E, 0x0D, 0x0D, 0x0D,
+    0x01, 0x00, 0xAD, 0xD0, 0xBD, 0x0D, 0xC2, 0x30, 0x10, 0x05, 0xE0, 0x4B, 0x22, 0x44, 0x91, 0xC2,
+    0x15, 0xB5, 0x47, 0xC8, 0x02, 0x48, 0x31, 0x3B, 0x80, 0x84, 0xC4, 0x06, 0x34, 0x19, 0x21, 0x19,
+    0x01, 0x76, 0xA0, 0x62, 0x09, 0x47, 0x62, 0x01, 0x28, 0xE8, 0x33, 0x42, 0x0A, 0x8A, 0x28, 0x72,
+    0xF2, 0x78, 0x97, 0x20, 0xC4, 0x00, 0x58, 0xB2, 0x3F, 0x5B, 0xFE, 0xB9, 0x27, 0x8B, 0x1C, 0x2F,
+    0xC2, 0x96, 0x02, 0x77, 0x92, 0xBF, 0x8A, 0x40, 0x7C, 0xBD, 0x04, 0x41, 0x95, 0x90, 0x08, 0x4E,
+    0x89, 0xBF, 0x2C, 0x67, 0x32, 0x40, 0xF1, 0x33, 0x07, 0xEC, 0x7E, 0x8E, 0xFC, 0x8F, 0x04, 0x75,
+    0x82, 0xA7, 0x56, 0xD9, 0x00, 0x0E, 0xEC, 0xA5, 0x46, 0x63, 0x2C, 0xA7, 0xC3, 0xF5, 0xA4, 0x73,
+    0x46, 0xD1, 0x95, 0x3F, 0xFB, 0x96, 0x8C, 0x92, 0x75, 0xDC, 0x1A, 0xC4, 0x90, 0x78, 0xE6, 0xB3,
+    0x8A, 0xA0, 0x7B, 0x31, 0x1F, 0xF3, 0x08, 0xB6, 0xC7, 0x0D, 0x08, 0x79, 0x95, 0x3F, 0x8A, 0x61,
+    0x5B, 0x3A, 0x5B, 0xDB, 0x4E, 0xBC, 0x33, 0x95, 0xC2, 0xDF, 0x20, 0xE5, 0x30, 0x91, 0xA3, 0x51,
+    0x2C, 0x46, 0x85, 0xD7, 0xF5, 0x24, 0xAB, 0x36, 0x76, 0x7A, 0xB3, 0x25, 0x6B, 0xC9, 0x14, 0x96,
+    0x69, 0x6D, 0x60, 0x04, 0xD3, 0x98, 0x20, 0xFC, 0xA4, 0xDA, 0x60, 0x5F, 0xF6, 0x70, 0x29, 0x86,
+    0x14, 0x7A, 0x37, 0xC8, 0x8A, 0x19, 0x17, 0xF2, 0x06, 0x4D, 0x8F, 0xD1, 0x0D, 0xC3, 0x20, 0x0C,
+    0x44, 0x51, 0x19, 0xC0, 0x03, 0xF4, 0x83, 0x11, 0x18, 0xC1, 0x8C, 0xD0, 0x8D, 0x32, 0x59, 0x05,
+    0x23, 0x30, 0x42, 0x46, 0xE0, 0x83, 0x4A, 0xE9, 0x07, 0xBD, 0x1E, 0x46, 0x89, 0xE2, 0x9F, 0xB3,
+    0xEC, 0x67, 0xDD, 0xD9, 0xB9, 0xAB, 0x7C, 0x5A, 0x2A, 0x75, 0xA9, 0xF6, 0xA5, 0x18, 0x6B, 0x0D,
+    0x18, 0x20, 0x80, 0x01, 0xFA, 0x7A, 0x1A, 0x70, 0x38, 0xF7, 0x9E, 0xEB, 0x26, 0x45, 0x09, 0x48,
+    0x93, 0x3D, 0x10, 0xD0, 0x23, 0x34, 0x21, 0x00, 0x60, 0x97, 0x31, 0xAF, 0x51, 0x05, 0x89, 0xD7,
+    0x28, 0x11, 0x55, 0xA9, 0x69, 0x43, 0xA7, 0x8E, 0x07, 0xD0, 0x39, 0x6F, 0x81, 0x08, 0xB9, 0xB6,
+    0x4D, 0x27, 0xCE, 0xF2, 0x74, 0x56, 0xFC, 0xD8, 0x9A, 0xAD, 0x19, 0x7B, 0x7C, 0xB3, 0x05, 0x41,
+    0x8D, 0x16, 0x4C, 0x4B, 0xEC, 0x2B, 0x76, 0xB4, 0x5C, 0xFE, 0x93, 0xD3, 0x3D, 0xF7, 0xF5, 0xC7,
+    0xF9, 0xD7, 0xF9, 0xA7, 0xD5, 0x1F,
 };
 
 static const EpdGlyph notoserif_16_boldGlyphs[] = {
@@ -2545,99 +2549,99 @@ static const EpdGlyph notoserif_16_boldGlyphs[] = {
     { 0, 0, 139, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 139, 0, 0, 0, 0 }, // U+0020
     { 7, 25, 204, 3, 24, 44, 0 }, // !
-    { 13, 10, 271, 2, 24, 33, 44 }, // "
-    { 17, 24, 301, 1, 24, 102, 77 }, // #
-    { 17, 29, 301, 1, 26, 124, 179 }, // $
-    { 29, 26, 483, 1, 25, 189, 303 }, // %
-    { 26, 26, 427, 1, 25, 169, 492 }, // &
-    { 6, 10, 155, 2, 24, 15, 661 }, // '
-    { 12, 31, 214, 1, 26, 93, 676 }, // (
-    { 11, 31, 214, 1, 26, 86, 769 }, // )
-    { 15, 14, 268, 1, 26, 53, 855 }, // *
-    { 15, 16, 301, 2, 20, 60, 908 }, // +
-    { 7, 12, 157, 1, 6, 21, 968 }, // ,
-    { 10, 4, 165, 0, 11, 10, 989 }, // -
-    { 6, 7, 157, 2, 6, 11, 999 }, // .
-    { 10, 31, 154, 0, 26, 78, 1010 }, // /
-    { 17, 26, 310, 1, 25, 111, 1088 }, // 0
-    { 17, 24, 270, 0, 24, 102, 1199 }, // 1
-    { 16, 25, 283, 1, 25, 100, 1301 }, // 2
-    { 18, 26, 287, 0, 25, 117, 1401 }, // 3
-    { 19, 24, 296, 0, 24, 114, 1518 }, // 4
-    { 16, 25, 283, 1, 24, 100, 1632 }, // 5
-    { 17, 26, 299, 1, 25, 111, 1732 }, // 6
-    { 17, 24, 289, 1, 24, 102, 1843 }, // 7
-    { 18, 26, 309, 1, 25, 117, 1945 }, // 8
-    { 17, 26, 299, 1, 25, 111, 2062 }, // 9
-    { 6, 20, 162, 2, 19, 30, 2173 }, // :
-    { 7, 25, 162, 1, 19, 44, 2203 }, // ;
-    { 15, 18, 301, 2, 21, 68, 2247 }, // <
-    { 15, 10, 301, 2, 17, 38, 2315 }, // =
-    { 15, 18, 301, 2, 21, 68, 2353 }, // >
-    { 16, 26, 293, 1, 25, 104, 2421 }, // ?
-    { 29, 29, 491, 1, 24, 211, 2525 }, // @
-    { 26, 24, 402, 0, 24, 156, 2736 }, // A
-    { 22, 24, 358, 0, 24, 132, 2892 }, // B
-    { 20, 26, 357, 1, 25, 130, 3024 }, // C
-    { 24, 24, 409, 0, 24, 144, 3154 }, // D
-    { 21, 24, 348, 0, 24, 126, 3298 }, // E
-    { 20, 24, 331, 0, 24, 120, 3424 }, // F
-    { 24, 26, 411, 1, 25, 156, 3544 }, // G
-    { 27, 24, 437, 0, 24, 162, 3700 }, // H
-    { 13, 24, 214, 0, 24, 78, 3862 }, // I
-    { 14, 32, 211, -1, 24, 112, 3940 }, // J
-    { 25, 24, 391, 0, 24, 150, 4052 }, // K
-    { 21, 24, 349, 0, 24, 126, 4202 }, // L
-    { 31, 24, 508, 0, 24, 186, 4328 }, // M
-    { 26, 24, 420, 0, 24, 156, 4514 }, // N
-    { 24, 26, 420, 1, 25, 156, 4670 }, // O
-    { 21, 24, 340, 0, 24, 126, 4826 }, // P
-    { 24, 33, 420, 1, 25, 198, 4952 }, // Q
-    { 24, 24, 380, 0, 24, 144, 5150 }, // R
-    { 18, 26, 309, 1, 25, 117, 5294 }, // S
-    { 22, 24, 348, 0, 24, 132, 5411 }, // T
-    { 25, 25, 398, 0, 24, 157, 5543 }, // U
-    { 24, 24, 372, 0, 24, 144, 5700 }, // V
-    { 36, 24, 569, 0, 24, 216, 5844 }, // W
-    { 25, 24, 391, 0, 24, 150, 6060 }, // X
-    { 24, 24, 370, 0, 24, 144, 6210 }, // Y
-    { 20, 24, 356, 1, 24, 120, 6354 }, // Z
-    { 10, 31, 221, 3, 26, 78, 6474 }, // [
-    { 10, 31, 154, 0, 26, 78, 6552 }, // <backslash>
-    { 10, 31, 221, 1, 26, 78, 6630 }, // ]
-    { 17, 16, 298, 1, 24, 68, 6708 }, // ^
-    { 17, 3, 245, -1, -2, 13, 6776 }, // _
-    { 9, 6, 178, 1, 26, 14, 6789 }, // `
-    { 18, 20, 320, 1, 19, 90, 6803 }, // a
-    { 21, 27, 346, 0, 26, 142, 6893 }, // b
-    { 16, 20, 281, 1, 19, 80, 7035 }, // c
-    { 21, 27, 346, 1, 26, 142, 7115 }, // d
-    { 17, 20, 305, 1, 19, 85, 7257 }, // e
-    { 16, 26, 217, 0, 26, 104, 7342 }, // f
-    { 19, 28, 299, 0, 20, 133, 7446 }, // g
-    { 22, 26, 356, 0, 26, 143, 7579 }, // h
-    { 12, 26, 188, 0, 26, 78, 7722 }, // i
-    { 10, 34, 184, -1, 26, 85, 7800 }, // j
-    { 22, 26, 340, 0, 26, 143, 7885 }, // k
-    { 12, 26, 188, 0, 26, 78, 8028 }, // l
-    { 33, 19, 526, 0, 19, 157, 8106 }, // m
-    { 22, 19, 356, 0, 19, 105, 8263 }, // n
-    { 18, 20, 327, 1, 19, 90, 8368 }, // o
-    { 20, 27, 344, 0, 19, 135, 8458 }, // p
-    { 21, 27, 346, 1, 19, 142, 8593 }, // q
-    { 17, 19, 279, 0, 19, 81, 8735 }, // r
-    { 14, 20, 256, 1, 19, 70, 8816 }, // s
-    { 13, 23, 216, 0, 22, 75, 8886 }, // t
-    { 22, 19, 356, 0, 18, 105, 8961 }, // u
-    { 21, 18, 323, 0, 18, 95, 9066 }, // v
-    { 30, 18, 456, -1, 18, 135, 9161 }, // w
-    { 22, 18, 344, 0, 18, 99, 9296 }, // x
-    { 20, 26, 309, 0, 18, 130, 9395 }, // y
-    { 17, 18, 282, 0, 18, 77, 9525 }, // z
-    { 13, 31, 236, 1, 26, 101, 9602 }, // {
-    { 3, 34, 301, 8, 26, 26, 9703 }, // |
-    { 13, 31, 236, 1, 26, 101, 9729 }, // }
-    { 17, 8, 301, 1, 16, 34, 9830 }, // ~
+    { 13, 10, 271, 2, 24, 33, 0 }, // "
+    { 17, 24, 301, 1, 24, 102, 33 }, // #
+    { 17, 29, 301, 1, 26, 124, 135 }, // $
+    { 29, 26, 483, 1, 25, 189, 259 }, // %
+    { 26, 26, 427, 1, 25, 169, 448 }, // &
+    { 6, 10, 155, 2, 24, 15, 617 }, // '
+    { 12, 31, 214, 1, 26, 93, 44 }, // (
+    { 11, 31, 214, 1, 26, 86, 137 }, // )
+    { 15, 14, 268, 1, 26, 53, 632 }, // *
+    { 15, 16, 301, 2, 20, 60, 685 }, // +
+    { 7, 12, 157, 1, 6, 21, 223 }, // ,
+    { 10, 4, 165, 0, 11, 10, 244 }, // -
+    { 6, 7, 157, 2, 6, 11, 254 }, // .
+    { 10, 31, 154, 0, 26, 78, 745 }, // /
+    { 17, 26, 310, 1, 25, 111, 265 }, // 0
+    { 17, 24, 270, 0, 24, 102, 376 }, // 1
+    { 16, 25, 283, 1, 25, 100, 478 }, // 2
+    { 18, 26, 287, 0, 25, 117, 578 }, // 3
+    { 19, 24, 296, 0, 24, 114, 695 }, // 4
+    { 16, 25, 283, 1, 24, 100, 809 }, // 5
+    { 17, 26, 299, 1, 25, 111, 909 }, // 6
+    { 17, 24, 289, 1, 24, 102, 1020 }, // 7
+    { 18, 26, 309, 1, 25, 117, 1122 }, // 8
+    { 17, 26, 299, 1, 25, 111, 1239 }, // 9
+    { 6, 20, 162, 2, 19, 30, 1350 }, // :
+    { 7, 25, 162, 1, 19, 44, 1380 }, // ;
+    { 15, 18, 301, 2, 21, 68, 823 }, // <
+    { 15, 10, 301, 2, 17, 38, 891 }, // =
+    { 15, 18, 301, 2, 21, 68, 929 }, // >
+    { 16, 26, 293, 1, 25, 104, 1424 }, // ?
+    { 29, 29, 491, 1, 24, 211, 997 }, // @
+    { 26, 24, 402, 0, 24, 156, 1528 }, // A
+    { 22, 24, 358, 0, 24, 132, 1684 }, // B
+    { 20, 26, 357, 1, 25, 130, 1816 }, // C
+    { 24, 24, 409, 0, 24, 144, 1946 }, // D
+    { 21, 24, 348, 0, 24, 126, 2090 }, // E
+    { 20, 24, 331, 0, 24, 120, 2216 }, // F
+    { 24, 26, 411, 1, 25, 156, 2336 }, // G
+    { 27, 24, 437, 0, 24, 162, 2492 }, // H
+    { 13, 24, 214, 0, 24, 78, 2654 }, // I
+    { 14, 32, 211, -1, 24, 112, 2732 }, // J
+    { 25, 24, 391, 0, 24, 150, 2844 }, // K
+    { 21, 24, 349, 0, 24, 126, 2994 }, // L
+    { 31, 24, 508, 0, 24, 186, 3120 }, // M
+    { 26, 24, 420, 0, 24, 156, 3306 }, // N
+    { 24, 26, 420, 1, 25, 156, 3462 }, // O
+    { 21, 24, 340, 0, 24, 126, 3618 }, // P
+    { 24, 33, 420, 1, 25, 198, 3744 }, // Q
+    { 24, 24, 380, 0, 24, 144, 3942 }, // R
+    { 18, 26, 309, 1, 25, 117, 4086 }, // S
+    { 22, 24, 348, 0, 24, 132, 4203 }, // T
+    { 25, 25, 398, 0, 24, 157, 1208 }, // U
+    { 24, 24, 372, 0, 24, 144, 4335 }, // V
+    { 36, 24, 569, 0, 24, 216, 4479 }, // W
+    { 25, 24, 391, 0, 24, 150, 4695 }, // X
+    { 24, 24, 370, 0, 24, 144, 4845 }, // Y
+    { 20, 24, 356, 1, 24, 120, 4989 }, // Z
+    { 10, 31, 221, 3, 26, 78, 1365 }, // [
+    { 10, 31, 154, 0, 26, 78, 1443 }, // <backslash>
+    { 10, 31, 221, 1, 26, 78, 1521 }, // ]
+    { 17, 16, 298, 1, 24, 68, 1599 }, // ^
+    { 17, 3, 245, -1, -2, 13, 1667 }, // _
+    { 9, 6, 178, 1, 26, 14, 1680 }, // `
+    { 18, 20, 320, 1, 19, 90, 5109 }, // a
+    { 21, 27, 346, 0, 26, 142, 5199 }, // b
+    { 16, 20, 281, 1, 19, 80, 5341 }, // c
+    { 21, 27, 346, 1, 26, 142, 5421 }, // d
+    { 17, 20, 305, 1, 19, 85, 5563 }, // e
+    { 16, 26, 217, 0, 26, 104, 5648 }, // f
+    { 19, 28, 299, 0, 20, 133, 5752 }, // g
+    { 22, 26, 356, 0, 26, 143, 5885 }, // h
+    { 12, 26, 188, 0, 26, 78, 6028 }, // i
+    { 10, 34, 184, -1, 26, 85, 6106 }, // j
+    { 22, 26, 340, 0, 26, 143, 6191 }, // k
+    { 12, 26, 188, 0, 26, 78, 6334 }, // l
+    { 33, 19, 526, 0, 19, 157, 6412 }, // m
+    { 22, 19, 356, 0, 19, 105, 6569 }, // n
+    { 18, 20, 327, 1, 19, 90, 6674 }, // o
+    { 20, 27, 344, 0, 19, 135, 6764 }, // p
+    { 21, 27, 346, 1, 19, 142, 6899 }, // q
+    { 17, 19, 279, 0, 19, 81, 7041 }, // r
+    { 14, 20, 256, 1, 19, 70, 7122 }, // s
+    { 13, 23, 216, 0, 22, 75, 7192 }, // t
+    { 22, 19, 356, 0, 18, 105, 7267 }, // u
+    { 21, 18, 323, 0, 18, 95, 7372 }, // v
+    { 30, 18, 456, -1, 18, 135, 7467 }, // w
+    { 22, 18, 344, 0, 18, 99, 7602 }, // x
+    { 20, 26, 309, 0, 18, 130, 7701 }, // y
+    { 17, 18, 282, 0, 18, 77, 7831 }, // z
+    { 13, 31, 236, 1, 26, 101, 1694 }, // {
+    { 3, 34, 301, 8, 26, 26, 1795 }, // |
+    { 13, 31, 236, 1, 26, 101, 1821 }, // }
+    { 17, 8, 301, 1, 16, 34, 1922 }, // ~
     { 0, 0, 139, 0, 0, 0, 0 }, // U+00A0
     { 7, 25, 204, 3, 19, 44, 0 }, // U+00A1
     { 17, 24, 301, 1, 24, 102, 44 }, // U+00A2
@@ -2721,19 +2725,19 @@ static const EpdGlyph notoserif_16_boldGlyphs[] = {
     { 18, 27, 327, 1, 26, 122, 9712 }, // U+00F0
     { 22, 26, 356, 0, 26, 143, 9834 }, // U+00F1
     { 18, 27, 327, 1, 26, 122, 9977 }, // U+00F2
-    { 18, 27, 327, 1, 26, 122, 10099 }, // U+00F3
-    { 18, 27, 327, 1, 26, 122, 10221 }, // U+00F4
-    { 18, 27, 327, 1, 26, 122, 10343 }, // U+00F5
-    { 18, 27, 327, 1, 26, 122, 10465 }, // U+00F6
-    { 15, 18, 301, 2, 21, 68, 10587 }, // U+00F7
-    { 18, 22, 327, 1, 20, 99, 10655 }, // U+00F8
-    { 22, 27, 356, 0, 26, 149, 10754 }, // U+00F9
-    { 22, 27, 356, 0, 26, 149, 10903 }, // U+00FA
-    { 22, 27, 356, 0, 26, 149, 11052 }, // U+00FB
-    { 22, 27, 356, 0, 26, 149, 11201 }, // U+00FC
-    { 20, 34, 309, 0, 26, 170, 11350 }, // U+00FD
-    { 20, 34, 344, 0, 26, 170, 11520 }, // U+00FE
-    { 20, 34, 309, 0, 26, 170, 11690 }, // U+00FF
+    { 18, 27, 327, 1, 26, 122, 7908 }, // U+00F3
+    { 18, 27, 327, 1, 26, 122, 10099 }, // U+00F4
+    { 18, 27, 327, 1, 26, 122, 10221 }, // U+00F5
+    { 18, 27, 327, 1, 26, 122, 10343 }, // U+00F6
+    { 15, 18, 301, 2, 21, 68, 10465 }, // U+00F7
+    { 18, 22, 327, 1, 20, 99, 10533 }, // U+00F8
+    { 22, 27, 356, 0, 26, 149, 10632 }, // U+00F9
+    { 22, 27, 356, 0, 26, 149, 10781 }, // U+00FA
+    { 22, 27, 356, 0, 26, 149, 10930 }, // U+00FB
+    { 22, 27, 356, 0, 26, 149, 11079 }, // U+00FC
+    { 20, 34, 309, 0, 26, 170, 11228 }, // U+00FD
+    { 20, 34, 344, 0, 26, 170, 11398 }, // U+00FE
+    { 20, 34, 309, 0, 26, 170, 11568 }, // U+00FF
     { 26, 29, 402, 0, 29, 189, 0 }, // U+0100
     { 18, 24, 320, 1, 23, 108, 189 }, // U+0101
     { 26, 32, 402, 0, 32, 208, 297 }, // U+0102
@@ -3435,98 +3439,98 @@ static const EpdGlyph notoserif_16_boldGlyphs[] = {
     { 10, 4, 165, 0, 11, 10, 195 }, // U+2010
     { 10, 4, 165, 0, 11, 10, 205 }, // U+2011
     { 17, 4, 301, 1, 14, 17, 215 }, // U+2012
-    { 18, 4, 267, -1, 11, 18, 232 }, // U+2013
-    { 35, 4, 533, -1, 11, 35, 250 }, // U+2014
-    { 35, 3, 533, -1, 10, 27, 285 }, // U+2015
-    { 9, 34, 298, 5, 26, 77, 312 }, // U+2016
-    { 15, 7, 219, -1, 0, 27, 389 }, // U+2017
-    { 7, 11, 149, 1, 24, 20, 416 }, // U+2018
-    { 7, 11, 149, 1, 24, 20, 436 }, // U+2019
-    { 7, 12, 157, 1, 6, 21, 456 }, // U+201A
-    { 7, 11, 149, 1, 24, 20, 477 }, // U+201B
-    { 14, 11, 261, 1, 24, 39, 497 }, // U+201C
-    { 14, 11, 261, 1, 24, 39, 536 }, // U+201D
-    { 14, 12, 261, 1, 6, 42, 575 }, // U+201E
-    { 14, 11, 261, 1, 24, 39, 617 }, // U+201F
-    { 14, 30, 255, 1, 26, 105, 656 }, // U+2020
-    { 14, 30, 255, 1, 26, 105, 761 }, // U+2021
-    { 11, 12, 213, 1, 18, 33, 866 }, // U+2022
-    { 11, 12, 267, 3, 18, 33, 899 }, // U+2023
-    { 6, 6, 157, 2, 15, 9, 932 }, // U+2024
-    { 16, 6, 307, 2, 15, 24, 941 }, // U+2025
-    { 27, 7, 487, 2, 6, 48, 965 }, // U+2026
-    { 6, 7, 157, 2, 14, 11, 1013 }, // U+2027
-    { 0, 0, 320, 0, 0, 0, 1024 }, // U+2028
-    { 0, 0, 320, 0, 0, 0, 1024 }, // U+2029
-    { 9, 26, 0, -1, 21, 59, 1024 }, // U+202A
-    { 9, 26, 0, -8, 21, 59, 1083 }, // U+202B
-    { 8, 28, 0, -4, 23, 56, 1142 }, // U+202C
-    { 8, 28, 0, -4, 23, 56, 1198 }, // U+202D
-    { 8, 28, 0, -4, 23, 56, 1254 }, // U+202E
-    { 0, 0, 89, 0, 0, 0, 1310 }, // U+202F
-    { 42, 26, 699, 1, 25, 273, 1310 }, // U+2030
-    { 56, 26, 923, 1, 25, 364, 1583 }, // U+2031
-    { 8, 9, 134, 0, 24, 18, 1947 }, // U+2032
-    { 16, 9, 262, 0, 24, 36, 1965 }, // U+2033
-    { 24, 9, 390, 0, 24, 54, 2001 }, // U+2034
-    { 8, 9, 134, 0, 24, 18, 2055 }, // U+2035
-    { 16, 9, 262, 0, 24, 36, 2073 }, // U+2036
-    { 24, 9, 390, 0, 24, 54, 2109 }, // U+2037
-    { 13, 10, 235, 1, 2, 33, 2163 }, // U+2038
-    { 8, 14, 188, 2, 16, 28, 2196 }, // U+2039
-    { 8, 14, 188, 2, 16, 28, 2224 }, // U+203A
-    { 24, 24, 437, 2, 24, 144, 2252 }, // U+203B
-    { 15, 25, 335, 3, 24, 94, 2396 }, // U+203C
-    { 18, 26, 328, 1, 25, 117, 2490 }, // U+203D
-    { 17, 3, 245, -1, 28, 13, 2607 }, // U+203E
-    { 26, 7, 0, -13, -1, 46, 2620 }, // U+203F
-    { 28, 7, 0, -14, 28, 49, 2666 }, // U+2040
-    { 15, 24, 240, 0, 24, 90, 2715 }, // U+2041
-    { 32, 26, 533, 1, 26, 208, 2805 }, // U+2042
-    { 10, 6, 193, 1, 15, 15, 3013 }, // U+2043
-    { 16, 24, 33, -7, 24, 96, 3028 }, // U+2044
-    { 10, 31, 221, 3, 26, 78, 3124 }, // U+2045
-    { 10, 31, 221, 1, 26, 78, 3202 }, // U+2046
-    { 33, 26, 568, 1, 25, 215, 3280 }, // U+2047
-    { 24, 26, 450, 1, 25, 156, 3495 }, // U+2048
-    { 24, 26, 453, 3, 25, 156, 3651 }, // U+2049
-    { 17, 25, 325, 1, 19, 107, 3807 }, // U+204A
-    { 19, 30, 334, 1, 26, 143, 3914 }, // U+204B
-    { 19, 13, 329, 1, 19, 62, 4057 }, // U+204C
-    { 19, 13, 329, 1, 19, 62, 4119 }, // U+204D
-    { 15, 14, 268, 1, 19, 53, 4181 }, // U+204E
-    { 7, 25, 162, 2, 19, 44, 4234 }, // U+204F
-    { 24, 26, 411, 1, 25, 156, 4278 }, // U+2050
-    { 15, 28, 268, 1, 26, 105, 4434 }, // U+2051
-    { 13, 25, 215, 0, 24, 82, 4539 }, // U+2052
-    { 17, 8, 298, 1, 16, 34, 4621 }, // U+2053
-    { 26, 7, 0, -13, 0, 46, 4655 }, // U+2054
-    { 16, 16, 288, 1, 20, 64, 4701 }, // U+2055
-    { 17, 20, 336, 2, 19, 85, 4765 }, // U+2056
-    { 32, 9, 517, 0, 24, 72, 4850 }, // U+2057
-    { 22, 20, 408, 2, 19, 110, 4922 }, // U+2058
-    { 22, 20, 408, 2, 19, 110, 5032 }, // U+2059
-    { 6, 26, 162, 2, 25, 39, 5142 }, // U+205A
-    { 22, 26, 408, 2, 25, 143, 5181 }, // U+205B
-    { 19, 18, 372, 2, 18, 86, 5324 }, // U+205C
-    { 6, 26, 162, 2, 25, 39, 5410 }, // U+205D
-    { 6, 26, 162, 2, 25, 39, 5449 }, // U+205E
-    { 0, 0, 118, 0, 0, 0, 5488 }, // U+205F
-    { 0, 0, 320, 0, 0, 0, 5488 }, // U+2060
-    { 0, 0, 320, 0, 0, 0, 5488 }, // U+2061
-    { 0, 0, 320, 0, 0, 0, 5488 }, // U+2062
-    { 0, 0, 320, 0, 0, 0, 5488 }, // U+2063
-    { 0, 0, 320, 0, 0, 0, 5488 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 5488 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 5488 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 5488 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 5488 }, // U+2069
-    { 8, 28, 0, -4, 23, 56, 5488 }, // U+206A
-    { 8, 28, 0, -4, 23, 56, 5544 }, // U+206B
-    { 8, 28, 0, -4, 23, 56, 5600 }, // U+206C
-    { 8, 29, 0, -4, 24, 58, 5656 }, // U+206D
-    { 8, 28, 0, -4, 23, 56, 5714 }, // U+206E
-    { 8, 28, 0, -4, 23, 56, 5770 }, // U+206F
+    { 18, 4, 267, -1, 11, 18, 8030 }, // U+2013
+    { 35, 4, 533, -1, 11, 35, 8048 }, // U+2014
+    { 35, 3, 533, -1, 10, 27, 232 }, // U+2015
+    { 9, 34, 298, 5, 26, 77, 259 }, // U+2016
+    { 15, 7, 219, -1, 0, 27, 336 }, // U+2017
+    { 7, 11, 149, 1, 24, 20, 363 }, // U+2018
+    { 7, 11, 149, 1, 24, 20, 8083 }, // U+2019
+    { 7, 12, 157, 1, 6, 21, 383 }, // U+201A
+    { 7, 11, 149, 1, 24, 20, 404 }, // U+201B
+    { 14, 11, 261, 1, 24, 39, 8103 }, // U+201C
+    { 14, 11, 261, 1, 24, 39, 8142 }, // U+201D
+    { 14, 12, 261, 1, 6, 42, 424 }, // U+201E
+    { 14, 11, 261, 1, 24, 39, 466 }, // U+201F
+    { 14, 30, 255, 1, 26, 105, 505 }, // U+2020
+    { 14, 30, 255, 1, 26, 105, 610 }, // U+2021
+    { 11, 12, 213, 1, 18, 33, 715 }, // U+2022
+    { 11, 12, 267, 3, 18, 33, 748 }, // U+2023
+    { 6, 6, 157, 2, 15, 9, 781 }, // U+2024
+    { 16, 6, 307, 2, 15, 24, 790 }, // U+2025
+    { 27, 7, 487, 2, 6, 48, 8181 }, // U+2026
+    { 6, 7, 157, 2, 14, 11, 814 }, // U+2027
+    { 0, 0, 320, 0, 0, 0, 825 }, // U+2028
+    { 0, 0, 320, 0, 0, 0, 825 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 825 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 884 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 943 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 999 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 1055 }, // U+202E
+    { 0, 0, 89, 0, 0, 0, 1111 }, // U+202F
+    { 42, 26, 699, 1, 25, 273, 1111 }, // U+2030
+    { 56, 26, 923, 1, 25, 364, 1384 }, // U+2031
+    { 8, 9, 134, 0, 24, 18, 1748 }, // U+2032
+    { 16, 9, 262, 0, 24, 36, 1766 }, // U+2033
+    { 24, 9, 390, 0, 24, 54, 1802 }, // U+2034
+    { 8, 9, 134, 0, 24, 18, 1856 }, // U+2035
+    { 16, 9, 262, 0, 24, 36, 1874 }, // U+2036
+    { 24, 9, 390, 0, 24, 54, 1910 }, // U+2037
+    { 13, 10, 235, 1, 2, 33, 1964 }, // U+2038
+    { 8, 14, 188, 2, 16, 28, 1997 }, // U+2039
+    { 8, 14, 188, 2, 16, 28, 2025 }, // U+203A
+    { 24, 24, 437, 2, 24, 144, 2053 }, // U+203B
+    { 15, 25, 335, 3, 24, 94, 2197 }, // U+203C
+    { 18, 26, 328, 1, 25, 117, 2291 }, // U+203D
+    { 17, 3, 245, -1, 28, 13, 2408 }, // U+203E
+    { 26, 7, 0, -13, -1, 46, 2421 }, // U+203F
+    { 28, 7, 0, -14, 28, 49, 2467 }, // U+2040
+    { 15, 24, 240, 0, 24, 90, 2516 }, // U+2041
+    { 32, 26, 533, 1, 26, 208, 2606 }, // U+2042
+    { 10, 6, 193, 1, 15, 15, 2814 }, // U+2043
+    { 16, 24, 33, -7, 24, 96, 2829 }, // U+2044
+    { 10, 31, 221, 3, 26, 78, 2925 }, // U+2045
+    { 10, 31, 221, 1, 26, 78, 3003 }, // U+2046
+    { 33, 26, 568, 1, 25, 215, 3081 }, // U+2047
+    { 24, 26, 450, 1, 25, 156, 3296 }, // U+2048
+    { 24, 26, 453, 3, 25, 156, 3452 }, // U+2049
+    { 17, 25, 325, 1, 19, 107, 3608 }, // U+204A
+    { 19, 30, 334, 1, 26, 143, 3715 }, // U+204B
+    { 19, 13, 329, 1, 19, 62, 3858 }, // U+204C
+    { 19, 13, 329, 1, 19, 62, 3920 }, // U+204D
+    { 15, 14, 268, 1, 19, 53, 3982 }, // U+204E
+    { 7, 25, 162, 2, 19, 44, 4035 }, // U+204F
+    { 24, 26, 411, 1, 25, 156, 4079 }, // U+2050
+    { 15, 28, 268, 1, 26, 105, 4235 }, // U+2051
+    { 13, 25, 215, 0, 24, 82, 4340 }, // U+2052
+    { 17, 8, 298, 1, 16, 34, 4422 }, // U+2053
+    { 26, 7, 0, -13, 0, 46, 4456 }, // U+2054
+    { 16, 16, 288, 1, 20, 64, 4502 }, // U+2055
+    { 17, 20, 336, 2, 19, 85, 4566 }, // U+2056
+    { 32, 9, 517, 0, 24, 72, 4651 }, // U+2057
+    { 22, 20, 408, 2, 19, 110, 4723 }, // U+2058
+    { 22, 20, 408, 2, 19, 110, 4833 }, // U+2059
+    { 6, 26, 162, 2, 25, 39, 4943 }, // U+205A
+    { 22, 26, 408, 2, 25, 143, 4982 }, // U+205B
+    { 19, 18, 372, 2, 18, 86, 5125 }, // U+205C
+    { 6, 26, 162, 2, 25, 39, 5211 }, // U+205D
+    { 6, 26, 162, 2, 25, 39, 5250 }, // U+205E
+    { 0, 0, 118, 0, 0, 0, 5289 }, // U+205F
+    { 0, 0, 320, 0, 0, 0, 5289 }, // U+2060
+    { 0, 0, 320, 0, 0, 0, 5289 }, // U+2061
+    { 0, 0, 320, 0, 0, 0, 5289 }, // U+2062
+    { 0, 0, 320, 0, 0, 0, 5289 }, // U+2063
+    { 0, 0, 320, 0, 0, 0, 5289 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 5289 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 5289 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 5289 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 5289 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 5289 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 5345 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 5401 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 5457 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 5515 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 5571 }, // U+206F
     { 13, 16, 213, 0, 28, 52, 0 }, // U+2070
     { 8, 16, 122, 0, 25, 32, 52 }, // U+2071
     { 13, 16, 213, 0, 28, 52, 84 }, // U+2074
@@ -3603,13 +3607,13 @@ static const EpdGlyph notoserif_16_boldGlyphs[] = {
     { 17, 29, 301, 1, 26, 124, 4690 }, // U+20BF
     { 16, 25, 281, 1, 19, 100, 4814 }, // U+20C0
     { 16, 4, 306, 2, 14, 16, 0 }, // U+2212
-    { 28, 26, 406, 0, 26, 182, 0 }, // U+FB00
-    { 24, 26, 383, 0, 26, 156, 182 }, // U+FB01
-    { 24, 26, 383, 0, 26, 156, 338 }, // U+FB02
-    { 36, 26, 573, 0, 26, 234, 494 }, // U+FB03
-    { 36, 26, 573, 0, 26, 234, 728 }, // U+FB04
-    { 25, 27, 402, 0, 26, 169, 962 }, // U+FB05
-    { 28, 27, 463, 1, 26, 189, 1131 }, // U+FB06
+    { 28, 26, 406, 0, 26, 182, 8229 }, // U+FB00
+    { 24, 26, 383, 0, 26, 156, 8411 }, // U+FB01
+    { 24, 26, 383, 0, 26, 156, 8567 }, // U+FB02
+    { 36, 26, 573, 0, 26, 234, 8723 }, // U+FB03
+    { 36, 26, 573, 0, 26, 234, 8957 }, // U+FB04
+    { 25, 27, 402, 0, 26, 169, 0 }, // U+FB05
+    { 28, 27, 463, 1, 26, 189, 169 }, // U+FB06
     { 31, 32, 533, 1, 26, 248, 0 }, // U+FFFD
 };
 
@@ -3617,8 +3621,7 @@ static const EpdUnicodeInterval notoserif_16_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3626,8 +3629,7 @@ static const EpdUnicodeInterval notoserif_16_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3637,19 +3639,57 @@ static const EpdUnicodeInterval notoserif_16_boldIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_16_boldGroups[] = {
-    { 0, 4460, 10762, 97, 0 },
-    { 4460, 3786, 12862, 96, 97 },
-    { 8246, 4635, 20555, 128, 193 },
-    { 12881, 4626, 18334, 96, 321 },
-    { 17507, 1478, 2537, 112, 417 },
-    { 18985, 12316, 41678, 256, 529 },
-    { 31301, 2763, 16969, 90, 785 },
-    { 34064, 2426, 6295, 111, 875 },
-    { 36490, 815, 1966, 42, 986 },
-    { 37305, 2534, 5290, 33, 1028 },
-    { 39839, 16, 16, 1, 1061 },
-    { 39855, 467, 1340, 7, 1062 },
-    { 40322, 141, 256, 1, 1069 },
+    { 0, 3843, 9841, 83, 2 },
+    { 3843, 1047, 2233, 26, 0 },
+    { 4890, 3770, 12727, 95, 97 },
+    { 8660, 4635, 20555, 128, 193 },
+    { 13295, 4626, 18334, 96, 321 },
+    { 17921, 1478, 2537, 112, 417 },
+    { 19399, 12316, 41678, 256, 529 },
+    { 31715, 2763, 16969, 90, 785 },
+    { 34478, 2335, 6080, 105, 875 },
+    { 36813, 815, 1966, 42, 986 },
+    { 37628, 2534, 5290, 33, 1028 },
+    { 40162, 16, 16, 1, 1061 },
+    { 40178, 199, 378, 2, 1067 },
+    { 40377, 141, 256, 1, 1069 },
+};
+
+static const uint16_t notoserif_16_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_16_boldKernLeftClasses[] = {
@@ -4569,18 +4609,81 @@ static const EpdLigaturePair notoserif_16_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_16_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 51 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_16_bold = {
     notoserif_16_boldBitmaps,
     notoserif_16_boldGlyphs,
     notoserif_16_boldIntervals,
-    20,
+    18,
     45,
     36,
     -10,
     true,
     notoserif_16_boldGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_16_boldGlyphToGroup,
     notoserif_16_boldKernLeftClasses,
     notoserif_16_boldKernRightClasses,
     notoserif_16_boldKernMatrix,
@@ -4590,4 +4693,8 @@ static const EpdFontData notoserif_16_bold = {
     66,
     notoserif_16_boldLigaturePairs,
     5,
+    notoserif_16_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2545 +3,2575 @@
  * name: notoserif_16_italic
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_16_italic 16 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_16_italic 16 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_16_italicBitmaps[45040] = {
-    0xC5, 0x5A, 0x3D, 0x8C, 0xDC, 0xE8, 0x79, 0xFE, 0x48, 0x4A, 0xA2, 0x6D, 0xC2, 0xA2, 0x0A, 0x9F,
-    0x0D, 0x9C, 0x22, 0xB1, 0x49, 0x93, 0xD3, 0x0F, 0x1B, 0x23, 0xB9, 0x62, 0x76, 0xC9, 0xC4, 0x7D,
-    0x6E, 0x8B, 0x5B, 0x04, 0xC8, 0x15, 0x6A, 0xD2, 0x24, 0x06, 0xBC, 0x8D, 0x8A, 0x2D, 0x56, 0x4B,
-    0x26, 0x2E, 0xDD, 0x28, 0x40, 0x90, 0x22, 0x06, 0x02, 0x17, 0xE7, 0xC2, 0x7B, 0x85, 0x14, 0x60,
-    0x0B, 0x15, 0xAB, 0x19, 0x9E, 0xAF, 0xB8, 0xE2, 0x0A, 0xD3, 0x0E, 0x8C, 0x14, 0x57, 0x88, 0x89,
-    0x75, 0x30, 0x2C, 0x05, 0x39, 0x1A, 0x19, 0xC5, 0x94, 0x44, 0x0E, 0xF3, 0x3C, 0xCF, 0x47, 0xCE,
-    0xCC, 0xFE, 0xE8, 0x74, 0x41, 0x02, 0x64, 0x76, 0xE7, 0xE3, 0xCC, 0x90, 0xFC, 0xBE, 0xF7, 0x7D,
-    0xDE, 0xFF, 0xF7, 0xA3, 0xC9, 0x52, 0x33, 0x33, 0xFC, 0x5F, 0x18, 0xD3, 0x19, 0xD3, 0x1A, 0x07,
-    0xFF, 0x8D, 0x71, 0xE7, 0xC6, 0xAB, 0x8D, 0x57, 0x19, 0xAF, 0x34, 0x5E, 0x61, 0xFC, 0xC2, 0x04,
-    0xB9, 0x09, 0x52, 0x13, 0x1A, 0x73, 0xDE, 0xF0, 0x75, 0xCE, 0x98, 0xCC, 0x98, 0x3E, 0x35, 0xBD,
-    0x31, 0x53, 0xFD, 0x92, 0xFC, 0x49, 0x93, 0x78, 0xF3, 0xC4, 0xAB, 0xEF, 0x78, 0xD5, 0x9E, 0x57,
-    0xEE, 0x79, 0xC5, 0xA1, 0x97, 0xDF, 0xF7, 0x53, 0x9D, 0x7C, 0xDB, 0x29, 0x8D, 0x39, 0xC4, 0x4C,
-    0xA6, 0xD6, 0xE0, 0xE7, 0xC6, 0xA9, 0x30, 0x99, 0x5B, 0x62, 0xF0, 0xCA, 0xC8, 0x78, 0x7D, 0xDF,
-    0x37, 0xEE, 0xBD, 0x27, 0xD3, 0xF7, 0xB1, 0xC6, 0xC4, 0x60, 0x38, 0x34, 0xE6, 0xAA, 0xA9, 0x8D,
-    0xD9, 0xE0, 0x30, 0x71, 0x2A, 0x63, 0x76, 0xDD, 0xD2, 0xBC, 0xB5, 0xF8, 0xE0, 0x45, 0x9E, 0xE0,
-    0xE2, 0xDC, 0xA9, 0x41, 0x92, 0xBD, 0xBF, 0xD0, 0x70, 0xD5, 0x18, 0x3F, 0xC7, 0xAD, 0x41, 0xAA,
-    0xFB, 0x77, 0xB5, 0x30, 0x97, 0xE7, 0xDA, 0xC6, 0xC5, 0xB2, 0xE6, 0xBB, 0xBF, 0xC1, 0x35, 0xB8,
-    0xD7, 0x44, 0x1F, 0xBD, 0x53, 0x99, 0xC4, 0xF7, 0x2B, 0xB3, 0x1F, 0x80, 0xCB, 0x87, 0xA1, 0x97,
-    0x9B, 0xE9, 0x45, 0x5C, 0x91, 0x5D, 0x21, 0x2B, 0xFF, 0x8E, 0x21, 0x6A, 0x0D, 0x2F, 0xE6, 0x04,
-    0x7D, 0xC5, 0x33, 0xFC, 0xFE, 0x4F, 0x0B, 0x70, 0x5E, 0xCF, 0xCC, 0x0D, 0x53, 0x65, 0x66, 0xD3,
-    0x94, 0x99, 0x49, 0x9C, 0x72, 0xDF, 0x24, 0x7F, 0x53, 0xB4, 0x26, 0xFA, 0xD5, 0xC7, 0x73, 0xCE,
-    0x8E, 0x85, 0x76, 0x1E, 0xF3, 0x5E, 0xAE, 0x1F, 0x70, 0x08, 0x39, 0x7C, 0xD5, 0xAC, 0x5E, 0x19,
-    0x26, 0x3C, 0x34, 0xEE, 0x33, 0x00, 0x5D, 0x99, 0xA0, 0xD8, 0x23, 0xC0, 0x51, 0xBA, 0x61, 0xC2,
-    0xD4, 0xC4, 0x98, 0xF6, 0xA6, 0xC1, 0xB0, 0x69, 0xF6, 0x8C, 0xB9, 0x63, 0xF6, 0xC9, 0xFE, 0x91,
-    0x01, 0xA8, 0x94, 0xCE, 0x51, 0x50, 0xF0, 0xD0, 0x46, 0xE6, 0x5D, 0x73, 0xE4, 0xCC, 0x37, 0xFC,
-    0xBE, 0x38, 0xF2, 0xAA, 0x07, 0xD1, 0x77, 0xAA, 0x8D, 0xE0, 0xC3, 0x7A, 0xC3, 0xAD, 0xA3, 0xDE,
-    0x2B, 0x71, 0xC2, 0x7D, 0x3F, 0xC8, 0xE7, 0xCE, 0x1C, 0x5C, 0xB8, 0x35, 0x0F, 0x1B, 0x5E, 0xED,
-    0x62, 0x9E, 0xC6, 0xAB, 0x20, 0x56, 0xB7, 0xC6, 0xA1, 0xC2, 0x9A, 0x5E, 0xE5, 0x97, 0x58, 0xD3,
-    0xAB, 0xC2, 0x02, 0xEB, 0xE2, 0x66, 0xC3, 0x35, 0xE7, 0x77, 0xF0, 0x06, 0x8D, 0xB5, 0x48, 0x75,
-    0xD6, 0xC8, 0xDE, 0x59, 0x70, 0x74, 0x17, 0xF7, 0x08, 0x68, 0x50, 0xF9, 0xBC, 0x22, 0x2C, 0x3C,
-    0x1E, 0xA2, 0xC2, 0x9B, 0xDB, 0x83, 0xFD, 0x36, 0x9C, 0x0B, 0x89, 0x7A, 0x58, 0xCD, 0x78, 0x9F,
-    0xFF, 0x92, 0x57, 0x18, 0x6F, 0x61, 0x42, 0x28, 0x4D, 0xB6, 0x30, 0xD1, 0x67, 0xC6, 0x6D, 0xB3,
-    0x34, 0x86, 0x5A, 0x55, 0x71, 0xB1, 0x09, 0xDC, 0xF3, 0xB0, 0x9A, 0x50, 0xB1, 0xFC, 0xF9, 0x03,
-    0xAA, 0x95, 0xDB, 0xD5, 0xD2, 0x4A, 0xE2, 0x8F, 0x43, 0x52, 0x48, 0xD7, 0xA2, 0x52, 0xBA, 0x97,
-    0xD4, 0xFC, 0xC5, 0x79, 0x09, 0xB1, 0x84, 0x2F, 0xEE, 0xFD, 0xBC, 0xBF, 0x6B, 0xDC, 0x7E, 0x61,
-    0x66, 0xF8, 0xF5, 0xBC, 0x74, 0x2E, 0xC1, 0xDF, 0x3E, 0x00, 0xDC, 0x33, 0x0F, 0x80, 0xF5, 0xFD,
-    0x25, 0x13, 0xD0, 0x62, 0xCE, 0x42, 0x72, 0x43, 0xCC, 0x94, 0xD8, 0xAF, 0x50, 0x7B, 0xE3, 0x35,
-    0x20, 0xB2, 0x26, 0xBD, 0xF6, 0x54, 0x5C, 0x90, 0x24, 0x7B, 0x49, 0x62, 0xB4, 0xA8, 0xDE, 0xD3,
-    0x13, 0xEF, 0x7D, 0x43, 0x79, 0xD9, 0x6B, 0x62, 0xF2, 0x8B, 0x7B, 0x00, 0xAC, 0x21, 0xF0, 0xE6,
-    0xDB, 0x6B, 0xF8, 0x5D, 0x20, 0x0A, 0x98, 0x94, 0xA2, 0x30, 0x54, 0xA7, 0x3B, 0xC3, 0x5D, 0xBA,
-    0x33, 0x1D, 0xDE, 0xF9, 0xEA, 0xAD, 0x95, 0xD7, 0x56, 0x27, 0x8E, 0x0B, 0x7B, 0xAF, 0xDB, 0x5A,
-    0x1E, 0x44, 0x70, 0x69, 0x2F, 0xCF, 0xEC, 0x29, 0x8A, 0x20, 0xCA, 0xED, 0xEC, 0xE9, 0xD2, 0x0A,
-    0x1A, 0x28, 0x64, 0x6D, 0xC2, 0x0F, 0x21, 0xF8, 0xDF, 0x96, 0x7F, 0x61, 0xA6, 0x9F, 0x34, 0x26,
-    0xEA, 0xDB, 0xA4, 0xAF, 0x4D, 0xF2, 0xEB, 0x87, 0xE6, 0x0F, 0x7C, 0xC0, 0x1A, 0x62, 0xB2, 0xD0,
-    0x29, 0xC4, 0x84, 0xB3, 0x06, 0xD7, 0x19, 0xEF, 0x59, 0xDF, 0xCF, 0x61, 0x85, 0xF3, 0x57, 0x9D,
-    0xB7, 0xAF, 0xB0, 0x8C, 0xEB, 0xA8, 0xF6, 0x6B, 0xA7, 0x76, 0x4B, 0x3F, 0x7F, 0x68, 0xEE, 0x9A,
-    0x37, 0xB6, 0xD3, 0xA4, 0x2F, 0xB3, 0xBE, 0xD4, 0x12, 0x51, 0x91, 0xF0, 0x2F, 0x5D, 0x69, 0x5A,
-    0xC8, 0xCF, 0x11, 0x3F, 0xDD, 0xE0, 0x30, 0xE1, 0x70, 0xC8, 0x81, 0x90, 0xB9, 0xB4, 0x43, 0xFA,
-    0x0F, 0x7A, 0xA3, 0xC1, 0xAC, 0xAE, 0x2E, 0x2F, 0x93, 0xC1, 0x13, 0x72, 0x87, 0xD7, 0x7A, 0xE5,
-    0x00, 0xB6, 0xA5, 0x26, 0x3C, 0x3E, 0xE5, 0x83, 0xD3, 0x53, 0xFA, 0xC7, 0xA7, 0xDC, 0x30, 0xC7,
-    0x5F, 0x2E, 0x49, 0x8E, 0x9E, 0x36, 0x14, 0xB7, 0x1C, 0x65, 0x42, 0x31, 0x26, 0x30, 0x1E, 0x40,
-    0x1F, 0x94, 0x18, 0x68, 0x44, 0x39, 0x70, 0x8F, 0x73, 0x88, 0x31, 0xCE, 0xC1, 0x55, 0x92, 0x26,
-    0x94, 0x1F, 0x95, 0x95, 0xA2, 0x4B, 0xA8, 0x2D, 0xFB, 0x1C, 0x1E, 0x72, 0x68, 0x39, 0x34, 0x54,
-    0xF3, 0x39, 0x24, 0x87, 0x79, 0x12, 0xB8, 0x02, 0x08, 0x0E, 0x77, 0x07, 0x2F, 0xB0, 0x84, 0xD3,
-    0x93, 0x40, 0xEB, 0x6E, 0xA9, 0x4E, 0x71, 0x89, 0x9F, 0x70, 0xC1, 0xA3, 0xC2, 0x59, 0xC4, 0xB9,
-    0xD3, 0x9C, 0xA5, 0x18, 0x9D, 0xD5, 0x00, 0x6A, 0xB3, 0xDB, 0x58, 0x8D, 0x1E, 0x95, 0x84, 0xEF,
-    0x60, 0xD0, 0xEC, 0x41, 0xBB, 0xDF, 0x98, 0x3D, 0x87, 0x34, 0xE8, 0xB0, 0x84, 0xFF, 0xAC, 0xA3,
-    0x29, 0xCD, 0x72, 0x28, 0x3D, 0x94, 0x21, 0x33, 0x41, 0x0D, 0x42, 0x71, 0xDB, 0x1E, 0x87, 0x6F,
-    0xE8, 0x66, 0xDD, 0x29, 0xE5, 0xD2, 0xD2, 0x74, 0x17, 0x56, 0xCD, 0x7D, 0xFD, 0x9E, 0x8E, 0x3F,
-    0x91, 0x72, 0xBA, 0x2A, 0xBA, 0x32, 0xA2, 0x7D, 0x81, 0xFC, 0x85, 0x94, 0xEE, 0x4D, 0x93, 0x1C,
-    0x1C, 0x74, 0x06, 0xCB, 0xB6, 0x26, 0xE3, 0x30, 0xBC, 0xB8, 0x78, 0xB0, 0x98, 0x01, 0xC3, 0x12,
-    0xF6, 0x97, 0xA4, 0x58, 0x32, 0xA1, 0x26, 0x6F, 0x72, 0xF1, 0x73, 0xC6, 0xFA, 0x13, 0x52, 0x40,
-    0xAB, 0x14, 0xBF, 0xDF, 0xC2, 0xBA, 0x1E, 0x7C, 0xB9, 0x71, 0xEF, 0x49, 0xEA, 0x72, 0x4E, 0xF2,
-    0x34, 0x52, 0xA8, 0x44, 0x44, 0xA6, 0xE7, 0x39, 0xDC, 0x24, 0x4A, 0x09, 0x21, 0x4A, 0x72, 0x60,
-    0x12, 0xBD, 0x98, 0xC1, 0x0A, 0x7A, 0xDE, 0x60, 0x7D, 0x85, 0x09, 0x48, 0x7E, 0xCC, 0x21, 0x2B,
-    0x8C, 0x60, 0x36, 0xDE, 0x23, 0x0C, 0x21, 0xCD, 0x6A, 0x83, 0xF3, 0x35, 0x09, 0x95, 0x25, 0x23,
-    0x5B, 0xF4, 0x41, 0x94, 0xDD, 0x84, 0x70, 0xCF, 0x81, 0xB7, 0x57, 0x02, 0xF0, 0x30, 0x07, 0xE2,
-    0xF1, 0xF6, 0x9F, 0x3D, 0xDF, 0xCA, 0x68, 0x18, 0x6F, 0x6C, 0xBF, 0xF7, 0x6C, 0xCB, 0xA2, 0xBE,
-    0x8E, 0x1C, 0x86, 0xF3, 0xB3, 0xE7, 0x58, 0xAB, 0x47, 0x64, 0x41, 0xB0, 0x00, 0x2A, 0xC3, 0x50,
-    0x9A, 0x2B, 0x0C, 0x52, 0xD7, 0x0D, 0x0C, 0x50, 0x3A, 0x7A, 0x9B, 0xC3, 0xFD, 0x51, 0x51, 0x0D,
-    0xE7, 0x70, 0x78, 0x97, 0x47, 0xEA, 0x31, 0x73, 0x63, 0xAC, 0x17, 0xB0, 0x52, 0x97, 0xF8, 0xED,
-    0xA0, 0xAF, 0x2D, 0x26, 0xC1, 0xD9, 0x23, 0x62, 0x38, 0xE5, 0xBA, 0xD9, 0x13, 0xDC, 0x1B, 0xF5,
-    0xBC, 0xEB, 0x8D, 0x95, 0x5A, 0xCF, 0xF0, 0x3D, 0x78, 0xDE, 0x13, 0x24, 0x70, 0xD9, 0xC1, 0x03,
-    0x81, 0x8B, 0xC8, 0x62, 0x6E, 0x29, 0x26, 0xDC, 0xB1, 0xB0, 0xFC, 0xE3, 0x77, 0x01, 0x4F, 0x8C,
-    0x59, 0x66, 0xCF, 0x76, 0x0A, 0x33, 0x4B, 0xA1, 0x1F, 0x1D, 0xA7, 0xEF, 0xA8, 0x63, 0xED, 0xFA,
-    0x50, 0x63, 0xC0, 0x14, 0x47, 0xE4, 0x7C, 0xD3, 0x28, 0xBA, 0x60, 0xF6, 0xF0, 0xC9, 0x82, 0x76,
-    0x44, 0xE2, 0xBF, 0x41, 0x54, 0x00, 0x53, 0x11, 0x8E, 0x43, 0x7A, 0x95, 0x2A, 0x75, 0x9D, 0xB1,
-    0xEE, 0x6D, 0x9A, 0x85, 0x75, 0x63, 0xC6, 0x17, 0x74, 0xC5, 0xE0, 0x1F, 0xAD, 0xD2, 0x1D, 0x11,
-    0x89, 0x2F, 0xBC, 0xA2, 0x3D, 0x76, 0x45, 0x70, 0xFC, 0x8A, 0x41, 0xDB, 0x89, 0x04, 0x14, 0x81,
-    0x56, 0x8A, 0x73, 0x53, 0xCE, 0x03, 0xCA, 0x2B, 0x67, 0x18, 0xF4, 0x15, 0x27, 0x7A, 0xDE, 0x94,
-    0xC1, 0x77, 0x99, 0xF8, 0x65, 0x45, 0xA2, 0xE9, 0xA2, 0xC1, 0x83, 0xDB, 0x44, 0x0D, 0x10, 0x72,
-    0x3B, 0x72, 0xD6, 0xD3, 0x08, 0x33, 0xEA, 0x44, 0xB2, 0x36, 0x64, 0x0C, 0x0F, 0x49, 0x0E, 0x29,
-    0x84, 0xCF, 0x76, 0x2A, 0xAC, 0xB8, 0x48, 0x97, 0x0A, 0xC7, 0x68, 0x40, 0x8F, 0x12, 0xBF, 0x6C,
-    0x28, 0xB5, 0x8E, 0xA6, 0x9A, 0x18, 0x29, 0xBD, 0xD4, 0x1F, 0x2B, 0x27, 0x69, 0xC4, 0x01, 0xFA,
-    0x9E, 0x18, 0x0D, 0xF8, 0x3A, 0x03, 0x49, 0x6E, 0x6F, 0x82, 0x79, 0xB4, 0x00, 0x92, 0x1D, 0x24,
-    0xBD, 0xF3, 0xB7, 0x64, 0xD6, 0x15, 0xB3, 0x32, 0xC4, 0xDA, 0xEA, 0xDA, 0x25, 0x5A, 0xE9, 0x21,
-    0xE1, 0x68, 0x09, 0xC7, 0xEC, 0xBD, 0x9A, 0x74, 0x53, 0x8E, 0x5B, 0x5C, 0xBC, 0x71, 0x3B, 0xAF,
-    0xF3, 0x5A, 0x78, 0xE4, 0x13, 0xAF, 0x73, 0x20, 0xBB, 0x4F, 0x7B, 0x9B, 0xD4, 0x21, 0x92, 0xC1,
-    0x28, 0x92, 0x92, 0xA1, 0xF7, 0xAB, 0xE6, 0x0B, 0x5E, 0x0C, 0x1C, 0x8D, 0x09, 0x5A, 0x11, 0x32,
-    0xA7, 0xC6, 0x22, 0x57, 0x43, 0x18, 0xF9, 0xFD, 0xE5, 0x15, 0xF8, 0x04, 0x3F, 0x67, 0xE2, 0x4A,
-    0x86, 0x1A, 0x11, 0x0E, 0x68, 0x04, 0x7E, 0x81, 0x04, 0x64, 0xB5, 0xF8, 0xC9, 0xDA, 0x30, 0x2E,
-    0x41, 0xE4, 0x1F, 0xEC, 0x91, 0xF7, 0x58, 0x4B, 0xE0, 0x8B, 0x86, 0xC5, 0xC8, 0x73, 0x72, 0xF9,
-    0xBF, 0x3A, 0x38, 0x78, 0x9F, 0xE7, 0xB6, 0xB7, 0xB7, 0xC5, 0x5D, 0x39, 0x58, 0x01, 0x28, 0x37,
-    0x3E, 0x3F, 0x64, 0xF9, 0x60, 0x30, 0xF0, 0x6E, 0x40, 0x0F, 0x5F, 0xE6, 0xFA, 0x91, 0x27, 0x71,
-    0x11, 0x97, 0xE3, 0x6A, 0x8B, 0xC1, 0xCE, 0x56, 0x4E, 0x7F, 0x0E, 0x1D, 0xE9, 0x69, 0x1C, 0xB0,
-    0xFA, 0xB0, 0x38, 0x02, 0xB2, 0x93, 0xA5, 0x07, 0x8D, 0x86, 0xFC, 0x60, 0x6A, 0x1D, 0x6D, 0x6C,
-    0xE7, 0x61, 0xE0, 0x61, 0x40, 0xF1, 0xB8, 0x64, 0x7A, 0x3C, 0x81, 0xE2, 0xD5, 0x74, 0x30, 0x24,
-    0x27, 0x59, 0xA9, 0xE2, 0xCE, 0x6F, 0x78, 0x88, 0xE9, 0x08, 0x90, 0x5D, 0xA5, 0x17, 0x5A, 0xEB,
-    0xEA, 0xE2, 0x54, 0x9E, 0x0C, 0x41, 0x4C, 0x22, 0xAE, 0x10, 0x6F, 0xDE, 0x4C, 0x91, 0x3B, 0x97,
-    0x48, 0x96, 0xD3, 0xC3, 0xB0, 0x40, 0xF4, 0x34, 0xBB, 0x51, 0xCA, 0x44, 0x67, 0x92, 0x80, 0xDF,
-    0x4D, 0x33, 0xD9, 0x84, 0xE6, 0xEE, 0x9B, 0xC9, 0x1D, 0xC0, 0x76, 0xC7, 0x4C, 0x8E, 0x3C, 0xDA,
-    0xE0, 0xEE, 0x91, 0xEC, 0x71, 0xB7, 0xF5, 0x79, 0x98, 0xB7, 0x5E, 0x0D, 0xD3, 0xA8, 0x71, 0x70,
-    0x1B, 0xB7, 0x3A, 0xF2, 0xE6, 0xFE, 0x91, 0x0F, 0xC6, 0x16, 0xDF, 0xDB, 0xDC, 0x49, 0xEF, 0x98,
-    0xAC, 0x89, 0x38, 0xD1, 0xF9, 0xD4, 0xD9, 0x52, 0x1A, 0x30, 0x5A, 0xCE, 0x60, 0x45, 0x5B, 0xF2,
-    0x38, 0x0C, 0x9A, 0x59, 0xE9, 0x50, 0x72, 0xC1, 0x20, 0x8D, 0x3F, 0xFF, 0xC9, 0xC0, 0x8B, 0xCD,
-    0xF1, 0x1A, 0xDD, 0xA1, 0x31, 0x94, 0x8B, 0xDA, 0xD0, 0xB8, 0xAB, 0xB1, 0xEE, 0xC4, 0x4E, 0xA7,
-    0xC8, 0x3B, 0x55, 0x84, 0x96, 0x02, 0x28, 0x92, 0x6D, 0x08, 0x98, 0x5D, 0x8D, 0x8C, 0xAF, 0xC6,
-    0x7D, 0x71, 0x00, 0xA1, 0xB1, 0x3E, 0xC8, 0x95, 0x1F, 0x17, 0x4C, 0x0F, 0x22, 0xF9, 0x48, 0x50,
-    0xF6, 0x40, 0xA2, 0x50, 0x0E, 0xE4, 0x29, 0x75, 0xBB, 0xF5, 0x1C, 0x81, 0xEC, 0x39, 0x00, 0xA2,
-    0x7F, 0x8F, 0xFB, 0x05, 0x14, 0xFC, 0x5A, 0xDF, 0xDB, 0xD8, 0x38, 0x53, 0xF2, 0x0C, 0x5F, 0x48,
-    0x77, 0x5D, 0x91, 0x95, 0xB0, 0x26, 0xAD, 0xF8, 0x0C, 0xDB, 0xC1, 0x3C, 0x40, 0x08, 0xF3, 0x63,
-    0xA4, 0x9F, 0x7F, 0xF6, 0x1E, 0xE8, 0x0F, 0x15, 0x1E, 0xC3, 0xCF, 0xF8, 0x39, 0x2A, 0xA8, 0x9F,
-    0x31, 0xAD, 0x90, 0x1E, 0x31, 0x93, 0x78, 0xF8, 0x6F, 0xF8, 0x39, 0x33, 0x43, 0x25, 0xD5, 0x53,
-    0x8F, 0xA0, 0x09, 0x4E, 0x47, 0x4D, 0xBB, 0xBC, 0x38, 0x80, 0x9D, 0x43, 0x69, 0x9F, 0xAF, 0xD4,
-    0x20, 0x10, 0x66, 0xB3, 0xA7, 0x0B, 0x29, 0x25, 0x60, 0x04, 0x49, 0xC9, 0x38, 0xE1, 0x82, 0x41,
-    0xD3, 0x13, 0x50, 0xBE, 0xC0, 0x0C, 0xE5, 0xFE, 0x15, 0xFB, 0x6C, 0xF0, 0x53, 0x22, 0x3C, 0x04,
-    0xB8, 0x71, 0x94, 0x57, 0xC9, 0xD2, 0xD5, 0xE7, 0x61, 0xCC, 0xC7, 0xBB, 0x72, 0xF1, 0x5A, 0x50,
-    0xE3, 0xE1, 0x18, 0x1C, 0x0B, 0x49, 0x6C, 0x85, 0xF7, 0xEE, 0xA0, 0x7E, 0xEF, 0x1B, 0x81, 0xA5,
-    0x9A, 0xA7, 0x93, 0x1D, 0xD2, 0x8F, 0xCF, 0x95, 0x4F, 0x38, 0x43, 0xCE, 0xB9, 0xB0, 0xD2, 0x9D,
-    0x59, 0x77, 0x33, 0xB3, 0x0E, 0x67, 0x75, 0xA0, 0x96, 0xCC, 0xAC, 0x79, 0x0C, 0x87, 0xDE, 0x1A,
-    0x8A, 0x45, 0xCE, 0xE9, 0x04, 0x1D, 0x27, 0x02, 0x81, 0x9C, 0x08, 0xE0, 0x21, 0x8E, 0x10, 0xBD,
-    0xC8, 0xDE, 0x9A, 0xE8, 0x62, 0x07, 0xB7, 0xE1, 0xE2, 0xCB, 0xB8, 0xE2, 0x72, 0xFF, 0x01, 0x3D,
-    0x25, 0x20, 0x6C, 0x06, 0x3A, 0x91, 0x18, 0x5D, 0xD3, 0x88, 0x2B, 0x6C, 0x5D, 0x04, 0x8D, 0x04,
-    0x81, 0xF0, 0x39, 0x98, 0x19, 0x41, 0xD4, 0xEA, 0x9F, 0xFC, 0xA1, 0x75, 0x88, 0xC3, 0x18, 0x3C,
-    0xDB, 0x4E, 0x8D, 0x8D, 0xB8, 0x90, 0x29, 0x3F, 0x2B, 0xBC, 0x0D, 0xB0, 0xC6, 0x6B, 0x50, 0x5A,
-    0xEB, 0x04, 0x55, 0x5F, 0x17, 0x51, 0x37, 0xC4, 0xC0, 0x64, 0xA8, 0x91, 0x21, 0xD3, 0x7B, 0x0D,
-    0x09, 0x22, 0x7C, 0xEB, 0xF4, 0x98, 0x2F, 0x41, 0x8F, 0xB7, 0x4E, 0x8F, 0x84, 0x1A, 0xBE, 0x38,
-    0xC8, 0x8D, 0x4D, 0x01, 0x5E, 0x4F, 0xCF, 0x98, 0xE3, 0xD8, 0x50, 0x6F, 0x93, 0x9E, 0xCB, 0xFD,
-    0xDF, 0xF1, 0xE7, 0x55, 0x32, 0xA5, 0xE8, 0xD2, 0x49, 0xC7, 0xA0, 0xBE, 0x7E, 0xCB, 0x62, 0x89,
-    0xF9, 0x7D, 0x4D, 0x15, 0x01, 0xDC, 0x54, 0xBC, 0xFC, 0xB4, 0x8E, 0x31, 0x3B, 0x79, 0x85, 0x8E,
-    0xC5, 0x7D, 0x0D, 0x42, 0x2E, 0xF7, 0x77, 0x31, 0x01, 0x16, 0xC5, 0x67, 0xF0, 0x47, 0xEB, 0x6C,
-    0x79, 0x96, 0x99, 0x4F, 0x21, 0x1B, 0xAA, 0xC9, 0x9F, 0xAF, 0xE8, 0xEF, 0xF4, 0x4F, 0x58, 0x8D,
-    0x45, 0x0A, 0x7B, 0x36, 0xE7, 0x88, 0xFB, 0xD6, 0xA1, 0x41, 0x5D, 0xEB, 0x1F, 0x3B, 0xB3, 0x45,
-    0x2E, 0x26, 0xC2, 0xA1, 0x18, 0xA2, 0xAE, 0x50, 0xC9, 0xE8, 0x6E, 0xDC, 0xC6, 0x22, 0x21, 0xB7,
-    0x9A, 0x5B, 0xE4, 0x48, 0x0A, 0x51, 0x93, 0x4B, 0xB4, 0x1A, 0x43, 0x79, 0x6E, 0x13, 0x0D, 0x26,
-    0x10, 0x44, 0x02, 0x32, 0xDD, 0xEE, 0x86, 0xA4, 0xA5, 0xB3, 0xAC, 0x70, 0xCA, 0x51, 0xE5, 0x46,
-    0x9D, 0x23, 0x9A, 0x12, 0x46, 0x36, 0x88, 0x63, 0xD0, 0x5F, 0x92, 0x43, 0x65, 0x24, 0xAA, 0xB4,
-    0x37, 0xB0, 0xEB, 0x30, 0x59, 0x9B, 0xF5, 0xB5, 0xDF, 0xDB, 0xC0, 0xDF, 0x92, 0xF6, 0x65, 0x11,
-    0xF6, 0x65, 0xF2, 0x6C, 0xD2, 0x42, 0x48, 0xE3, 0xFC, 0xCC, 0x5A, 0x8E, 0x6B, 0x61, 0x1D, 0xAE,
-    0x21, 0xCF, 0x80, 0xAF, 0x5F, 0x93, 0xAF, 0x60, 0x8C, 0xB0, 0x02, 0x9F, 0x9D, 0xCC, 0xEC, 0xEC,
-    0xC2, 0x43, 0xD0, 0x3F, 0x1E, 0xF9, 0x4F, 0xE4, 0x9B, 0xF2, 0xDD, 0x36, 0x85, 0x2B, 0x56, 0x39,
-    0xF1, 0xA8, 0x4F, 0x9A, 0x7D, 0x7A, 0x6C, 0xF6, 0xB5, 0x89, 0x87, 0x44, 0xC2, 0xBC, 0x45, 0x3F,
-    0x9F, 0x0C, 0xB6, 0xD7, 0x7A, 0x52, 0xF6, 0xC7, 0x4A, 0xE3, 0x16, 0x23, 0x10, 0xAE, 0xF5, 0x11,
-    0x81, 0x15, 0x5D, 0x6C, 0xC9, 0x3A, 0x12, 0x61, 0xAE, 0xA5, 0x8A, 0x35, 0x31, 0x0E, 0x9B, 0x56,
-    0xEB, 0xA5, 0x79, 0xE1, 0x3F, 0x8B, 0x9D, 0xF0, 0x51, 0x2F, 0xDD, 0x6B, 0xC5, 0x66, 0x5C, 0x89,
-    0x46, 0x94, 0x4F, 0xA2, 0x37, 0x95, 0x4A, 0x26, 0x56, 0x49, 0x32, 0x45, 0x6E, 0xC0, 0x21, 0x9E,
-    0x17, 0x72, 0x92, 0x8E, 0x75, 0x15, 0x42, 0xB0, 0x14, 0x88, 0x51, 0x6D, 0xE5, 0x64, 0x05, 0x65,
-    0x39, 0x5B, 0x41, 0xD6, 0xBE, 0x1E, 0xB2, 0xF2, 0x18, 0x64, 0xF1, 0x3A, 0x64, 0x17, 0x09, 0xD9,
-    0x15, 0x0A, 0x64, 0xC2, 0x89, 0xF7, 0xE8, 0xCE, 0x5A, 0x79, 0x03, 0xEB, 0x0C, 0x62, 0x06, 0x0B,
-    0x5F, 0x08, 0x31, 0x6A, 0xF4, 0x3F, 0x82, 0xFB, 0xA3, 0xE8, 0xB9, 0x2A, 0xAD, 0x9B, 0x3D, 0x15,
-    0xE7, 0x29, 0x96, 0xFA, 0x1D, 0x3E, 0xB8, 0x9F, 0xC2, 0x49, 0xFC, 0x1A, 0x1F, 0xBC, 0x8F, 0x61,
-    0x35, 0x9F, 0x54, 0xF6, 0x43, 0xF0, 0x0E, 0xF3, 0x87, 0x8F, 0x90, 0x4F, 0x51, 0x76, 0xFE, 0xF7,
-    0xE7, 0xE6, 0x06, 0x89, 0x09, 0xBE, 0x33, 0x47, 0xAC, 0xA7, 0x9B, 0x00, 0xC0, 0x75, 0x6C, 0x3F,
-    0x38, 0x15, 0x09, 0xBB, 0xEA, 0xB4, 0x5E, 0x91, 0xA8, 0xD6, 0x6A, 0x03, 0x16, 0x9B, 0xF0, 0x56,
-    0x6D, 0x28, 0xB9, 0xA2, 0x42, 0xB9, 0x21, 0xB1, 0xE2, 0xC3, 0xAE, 0x50, 0xD8, 0x35, 0xD3, 0x5A,
-    0x1F, 0x0E, 0x4D, 0x56, 0x09, 0x12, 0xF8, 0x84, 0x42, 0x02, 0x57, 0x35, 0x4B, 0x7F, 0xDB, 0x21,
-    0xA5, 0x88, 0x17, 0xAC, 0xF1, 0x8B, 0x0D, 0x0E, 0x60, 0xA0, 0xA3, 0x11, 0xA4, 0x60, 0xCB, 0x98,
-    0x7B, 0x44, 0x94, 0xC5, 0x0B, 0x71, 0xA2, 0x77, 0xC9, 0x99, 0x4C, 0x97, 0x2A, 0xB3, 0xDD, 0x47,
-    0x95, 0x2A, 0x78, 0x32, 0xC2, 0x52, 0xDA, 0xFB, 0xA8, 0xD1, 0xD1, 0xFF, 0x69, 0xAB, 0xAA, 0xDA,
-    0xCF, 0x3B, 0x15, 0xE1, 0x0C, 0xF8, 0x13, 0x95, 0xDB, 0x59, 0x6A, 0x8F, 0x49, 0x31, 0x51, 0xE5,
-    0x1D, 0x15, 0xBB, 0xE2, 0x24, 0xAC, 0x0E, 0xC5, 0x48, 0x50, 0xD7, 0x22, 0xDF, 0x6B, 0xEC, 0xD1,
-    0xED, 0x2A, 0x5B, 0xEA, 0xAB, 0x8C, 0x38, 0xB4, 0xB0, 0x32, 0xFE, 0xAB, 0x6E, 0xAB, 0xAD, 0xDF,
-    0x02, 0x07, 0xAA, 0x51, 0x49, 0x7B, 0xB8, 0x4A, 0xF9, 0xA1, 0x25, 0xBC, 0xA9, 0x7F, 0xDA, 0x29,
-    0xEE, 0xC2, 0xC0, 0x20, 0xE1, 0xB0, 0x54, 0xB0, 0x67, 0x15, 0x03, 0x4D, 0xF0, 0xD4, 0x55, 0xA1,
-    0x4F, 0xF4, 0x1A, 0xEA, 0x1C, 0x46, 0xCA, 0xA5, 0x89, 0xE5, 0x8C, 0x38, 0xB7, 0x3F, 0x97, 0x23,
-    0xD2, 0x18, 0xD0, 0x27, 0x82, 0x54, 0xC6, 0xDD, 0xA8, 0x94, 0x71, 0xAB, 0x99, 0x91, 0xA5, 0x89,
-    0x7C, 0x1B, 0x04, 0xE7, 0x2A, 0xD3, 0xC0, 0xF4, 0xD0, 0x37, 0x7A, 0xA3, 0xFE, 0x1F, 0x6C, 0xDC,
-    0x7D, 0xBC, 0x16, 0x77, 0xE9, 0x08, 0xAF, 0xD9, 0x52, 0xB8, 0x63, 0xB8, 0x64, 0x73, 0x41, 0x8E,
-    0x6B, 0xB8, 0xBF, 0x54, 0x8E, 0x52, 0xAE, 0x72, 0x94, 0x68, 0xCC, 0x54, 0xA0, 0xB5, 0x58, 0x09,
-    0x3F, 0xF6, 0xD4, 0x5B, 0xB8, 0x5D, 0x78, 0x5B, 0x55, 0x15, 0x4F, 0x7E, 0xFC, 0xBF, 0x8D, 0x1F,
-    0xFF, 0xFF, 0x58, 0x99, 0x75, 0xAC, 0x1C, 0xF9, 0x0A, 0xEB, 0x00, 0x2D, 0xE9, 0x42, 0x6A, 0x99,
-    0xF3, 0x94, 0xA9, 0xBC, 0xA7, 0x82, 0xD6, 0x5F, 0x5A, 0x54, 0xD7, 0x33, 0x3F, 0x3A, 0xD3, 0x13,
-    0x99, 0x5F, 0xB5, 0x96, 0xF9, 0x55, 0xF4, 0x76, 0x61, 0xB1, 0x42, 0x95, 0xB9, 0x4B, 0xE5, 0xDB,
-    0xFC, 0x0F, 0xB7, 0x46, 0x4F, 0x7A, 0xF9, 0x83, 0xCC, 0xBA, 0x26, 0x75, 0xE5, 0xC8, 0xA0, 0x6A,
-    0x32, 0x60, 0x62, 0xD3, 0x1D, 0x82, 0xB0, 0x50, 0x00, 0x59, 0x70, 0x6E, 0xA0, 0x8A, 0x64, 0x9E,
-    0xA8, 0xEE, 0x14, 0x63, 0xB5, 0xCD, 0x00, 0xC3, 0xF2, 0x3D, 0xCE, 0x03, 0x26, 0x99, 0x58, 0xFB,
-    0x21, 0xDB, 0x48, 0x48, 0x16, 0xEF, 0xAE, 0x55, 0xF1, 0x74, 0xB8, 0x48, 0xB0, 0xB9, 0x58, 0x23,
-    0xB6, 0xF2, 0xB1, 0x1B, 0x24, 0x4F, 0xE2, 0x2F, 0x96, 0xEC, 0x67, 0xE9, 0x75, 0xD2, 0x72, 0x34,
-    0x0E, 0xB4, 0x7A, 0xD6, 0x9C, 0x54, 0x9E, 0x67, 0xB7, 0x50, 0x85, 0x29, 0x6C, 0x9D, 0xB7, 0x49,
-    0x0F, 0x58, 0x89, 0x38, 0xA6, 0x31, 0x6A, 0x7D, 0xB6, 0x9B, 0x51, 0x66, 0xC2, 0xA4, 0x40, 0x3E,
-    0x2A, 0xAC, 0x99, 0xB9, 0x38, 0x06, 0x83, 0x01, 0x65, 0x69, 0x83, 0x5C, 0xC4, 0xD0, 0x66, 0x78,
-    0x4D, 0x16, 0x63, 0x47, 0xA5, 0x10, 0x36, 0x8B, 0x89, 0xD6, 0xB3, 0x18, 0x8E, 0xDF, 0xEC, 0x3F,
-    0xE3, 0x47, 0xC9, 0x24, 0xEB, 0x6B, 0x14, 0xB0, 0x3B, 0xFD, 0x8F, 0xDC, 0x59, 0x43, 0x4D, 0x8A,
-    0xE4, 0x7B, 0xAE, 0x6A, 0xFA, 0x1B, 0x9A, 0x78, 0x22, 0x28, 0x27, 0x9A, 0xDE, 0x16, 0x5D, 0xBB,
-    0x8A, 0x67, 0x87, 0x9A, 0x58, 0x92, 0xA2, 0xCF, 0xCA, 0x69, 0xF6, 0xCC, 0x47, 0xD8, 0x40, 0x63,
-    0xCA, 0x95, 0xA9, 0xFE, 0x9A, 0x8E, 0x23, 0xFC, 0x53, 0xA7, 0x26, 0xE0, 0x54, 0xED, 0xBD, 0x4C,
-    0xAD, 0x3D, 0x21, 0x64, 0xC2, 0xC5, 0x3D, 0x56, 0x5C, 0x36, 0xE1, 0x55, 0x61, 0x9E, 0x88, 0xAA,
-    0x78, 0x45, 0x15, 0xDB, 0x45, 0x28, 0x38, 0xE8, 0x20, 0x37, 0x04, 0xC3, 0x9E, 0x20, 0xA9, 0x95,
-    0xDE, 0x29, 0xD5, 0xF3, 0x94, 0x6B, 0xB0, 0x21, 0xD9, 0xC9, 0xD7, 0x4D, 0xD5, 0x3A, 0x9C, 0xAA,
-    0x0F, 0x96, 0xA9, 0x1F, 0x99, 0xA9, 0x1D, 0x96, 0xA8, 0xCB, 0x98, 0xA8, 0x73, 0x99, 0xBC, 0x23,
-    0x4C, 0xBE, 0x27, 0x7C, 0xF6, 0x84, 0x95, 0x50, 0x8D, 0xEA, 0x15, 0x86, 0x8A, 0x98, 0x48, 0xBB,
-    0xCC, 0xD7, 0x8C, 0x25, 0x09, 0xEC, 0x39, 0x96, 0xAA, 0x8C, 0xEE, 0x8D, 0xC4, 0xB0, 0xA3, 0x43,
-    0xAA, 0x58, 0x4B, 0x6F, 0x90, 0x24, 0x0F, 0x1F, 0x44, 0xA1, 0x8F, 0x9A, 0x69, 0x2E, 0x6D, 0x8F,
-    0x73, 0x2E, 0xDF, 0x9A, 0x8B, 0x71, 0xCE, 0xD2, 0xB4, 0x33, 0xD7, 0xE3, 0xC2, 0x17, 0xCD, 0x6F,
-    0x47, 0x05, 0xBD, 0x63, 0x67, 0xEE, 0x47, 0x45, 0x24, 0xDD, 0xAB, 0xA2, 0x82, 0xC4, 0x2F, 0xDC,
-    0x32, 0x2C, 0x48, 0xD6, 0xD4, 0x2B, 0xC2, 0x42, 0x31, 0x37, 0x48, 0xC3, 0x0F, 0x95, 0x29, 0x85,
-    0x26, 0xFC, 0x85, 0xFA, 0x64, 0x37, 0x10, 0xC0, 0xC9, 0x51, 0x06, 0xD9, 0x7C, 0x2A, 0x85, 0xBD,
-    0x6D, 0x82, 0x47, 0xE2, 0x0B, 0x51, 0xAC, 0xB3, 0x56, 0xC9, 0x96, 0x80, 0x4D, 0x26, 0x6D, 0x9E,
-    0x09, 0x39, 0x59, 0x9D, 0x09, 0xFB, 0x86, 0x71, 0xF2, 0x72, 0xFF, 0xD8, 0xEF, 0x6D, 0x91, 0xA0,
-    0x32, 0x3D, 0x55, 0xFD, 0x98, 0x14, 0xEA, 0xDE, 0xC6, 0x22, 0x0F, 0x8A, 0xB5, 0x69, 0x53, 0x54,
-    0x35, 0x6D, 0xFD, 0xFF, 0x92, 0x9E, 0x79, 0xD6, 0xD4, 0x5D, 0xEB, 0x04, 0x06, 0x8F, 0x30, 0xB8,
-    0x04, 0x4F, 0xF2, 0x34, 0xA1, 0x4D, 0x61, 0x37, 0x6C, 0x3E, 0x3B, 0x97, 0x7E, 0x7A, 0x55, 0xA0,
-    0x68, 0x9F, 0x8B, 0x9C, 0xA1, 0xCE, 0x3A, 0xB2, 0x45, 0x6D, 0x63, 0x3B, 0x13, 0xDD, 0x90, 0x8E,
-    0xA5, 0x6A, 0x8D, 0xF7, 0x55, 0xD4, 0x57, 0xF1, 0xE2, 0xEE, 0x9B, 0xFD, 0x5D, 0xBA, 0x03, 0xF5,
-    0x69, 0x00, 0xAC, 0x6B, 0xA5, 0xDF, 0x49, 0xFA, 0x0B, 0xC9, 0x7D, 0xA6, 0xC8, 0x96, 0xA4, 0xBB,
-    0xD2, 0x76, 0xED, 0x82, 0x7C, 0xA4, 0xDD, 0x8F, 0x4F, 0xC4, 0xC4, 0x7F, 0x88, 0xF8, 0xF6, 0x94,
-    0xED, 0xD4, 0x5F, 0x64, 0x3B, 0xE2, 0xE0, 0x82, 0xAC, 0x06, 0x65, 0x86, 0x7E, 0x57, 0x9D, 0xC1,
-    0x0D, 0x30, 0x76, 0xD6, 0x78, 0xC1, 0x44, 0x6C, 0xDF, 0x56, 0xEF, 0xE1, 0xBE, 0x6D, 0x72, 0x0C,
-    0x7A, 0x64, 0xF9, 0xD7, 0x6D, 0xEA, 0xA7, 0x8C, 0x27, 0xAB, 0x33, 0x4F, 0x06, 0xF3, 0x33, 0x4E,
-    0x5E, 0xD1, 0xC9, 0xEB, 0x3A, 0x39, 0xD1, 0xC9, 0xC6, 0x24, 0x4F, 0x0E, 0x3E, 0x98, 0xB3, 0x77,
-    0x4B, 0x8F, 0xE4, 0x6C, 0x6F, 0xC1, 0x3F, 0x55, 0xEA, 0xE4, 0x2C, 0xB3, 0xDD, 0xFC, 0xF4, 0xBE,
-    0xC9, 0xF4, 0x78, 0x73, 0x7A, 0x99, 0x38, 0xCF, 0x2D, 0x1C, 0xCB, 0xA4, 0x79, 0x4C, 0x9C, 0x8B,
-    0xB5, 0xA9, 0xD2, 0xD5, 0x26, 0x49, 0xA6, 0xA8, 0x8E, 0x6A, 0x02, 0xA1, 0xF3, 0x92, 0x79, 0x1B,
-    0x34, 0x9D, 0xFC, 0xBB, 0x0E, 0x31, 0xD8, 0xBF, 0x2B, 0xF0, 0x26, 0xF6, 0xEF, 0x22, 0x5B, 0xCF,
-    0xC7, 0xFE, 0x8C, 0xA5, 0x9C, 0x2A, 0x28, 0xAE, 0x5E, 0xBB, 0xEE, 0x69, 0x16, 0xDC, 0x57, 0xB1,
-    0x50, 0x9E, 0x39, 0x15, 0xB3, 0xD4, 0x6C, 0xA0, 0x9C, 0x2D, 0x5E, 0xF5, 0x89, 0xB4, 0x79, 0x83,
-    0xFB, 0xAF, 0x42, 0x88, 0x1B, 0x50, 0x9F, 0x3D, 0x98, 0xE1, 0x61, 0xC8, 0x1E, 0x4F, 0xE1, 0x96,
-    0x5E, 0xE1, 0x15, 0x4E, 0x05, 0x7F, 0x51, 0x83, 0xDE, 0x07, 0x37, 0x21, 0x80, 0xC9, 0xD0, 0x4F,
-    0xB7, 0xBD, 0x24, 0x76, 0x4E, 0xDF, 0x3A, 0x38, 0x38, 0x48, 0xDF, 0xD2, 0xE6, 0x03, 0x0A, 0xCF,
-    0x7A, 0xEC, 0x94, 0xB9, 0xFD, 0x2F, 0x10, 0xB0, 0x7F, 0x89, 0xB8, 0x81, 0x60, 0xC0, 0x8E, 0x6E,
-    0x62, 0x9B, 0x1A, 0xA0, 0x6B, 0x4A, 0xA2, 0x3A, 0x52, 0xA5, 0xFA, 0xAD, 0xC5, 0xAF, 0x0E, 0x07,
-    0xE8, 0xF5, 0x8C, 0xBC, 0xCC, 0x8C, 0x22, 0xD3, 0x65, 0x0E, 0x7F, 0x04, 0x4D, 0xFB, 0xEB, 0x5F,
-    0xD5, 0x97, 0xE2, 0xFE, 0xFB, 0x7D, 0x1D, 0x74, 0x2E, 0xEC, 0x6A, 0x0B, 0xB0, 0x1B, 0x16, 0xCE,
-    0x9E, 0x12, 0xAF, 0xA4, 0x78, 0x75, 0xB2, 0x0C, 0x7E, 0xE9, 0x06, 0xA6, 0x09, 0x6E, 0xEB, 0x0E,
-    0x71, 0xE5, 0xA2, 0x88, 0xD8, 0x4F, 0x0D, 0xD9, 0x46, 0x09, 0x4B, 0x65, 0x36, 0x0C, 0xC1, 0xDC,
-    0x32, 0xD4, 0x86, 0x21, 0xFC, 0x12, 0x5B, 0x9F, 0x00, 0x71, 0xA0, 0x34, 0x64, 0xE7, 0x4B, 0x3B,
-    0x8B, 0x88, 0x97, 0x38, 0xF5, 0x18, 0x8E, 0x6F, 0x83, 0x1D, 0xEB, 0x61, 0x57, 0x44, 0xC6, 0x81,
-    0x60, 0xFA, 0xC3, 0xC6, 0x74, 0x48, 0x82, 0xE7, 0xC8, 0x7F, 0x6B, 0xD3, 0x9C, 0xDC, 0xBA, 0x1B,
-    0x8B, 0xAD, 0xF1, 0x9D, 0xC9, 0x40, 0x9D, 0x3C, 0x2E, 0x83, 0x34, 0x80, 0x55, 0xA9, 0x13, 0x6C,
-    0x27, 0x54, 0xF7, 0x50, 0x81, 0x36, 0x3A, 0x5E, 0x19, 0x04, 0xCB, 0x62, 0x0A, 0x83, 0xDB, 0x7F,
-    0xFE, 0x7F, 0x8F, 0xEE, 0x62, 0x89, 0xEE, 0xD8, 0x1B, 0x8E, 0x7F, 0x88, 0x4C, 0xDD, 0x6B, 0x50,
-    0x42, 0x81, 0x2D, 0x17, 0x6C, 0x79, 0xF3, 0xB8, 0x40, 0x1A, 0x95, 0xC7, 0x45, 0xF2, 0xF7, 0x0B,
-    0x28, 0x13, 0xD2, 0x94, 0xAD, 0x2F, 0xC5, 0xD6, 0x85, 0x9F, 0xD8, 0x44, 0x93, 0xD2, 0xE9, 0xC8,
-    0x85, 0xD3, 0xB0, 0x54, 0xF3, 0x6A, 0xE6, 0xEC, 0x83, 0x37, 0xAA, 0x96, 0xDB, 0x20, 0xCE, 0x8E,
-    0xB6, 0x3F, 0xEC, 0xBE, 0xD0, 0xE0, 0x8D, 0x6C, 0x1B, 0x69, 0x2D, 0x93, 0x5C, 0xCF, 0x27, 0x4F,
-    0x25, 0x0D, 0x43, 0xEA, 0x20, 0x6F, 0xE3, 0xBE, 0x22, 0x69, 0x58, 0x5B, 0x70, 0xE8, 0x30, 0x86,
-    0xEB, 0xE9, 0x82, 0xA6, 0x79, 0xC8, 0xE1, 0xBB, 0x9A, 0x20, 0x5B, 0x36, 0xAA, 0x9D, 0x74, 0x6C,
-    0x58, 0x44, 0x3D, 0xEB, 0xA9, 0xE9, 0xAD, 0xAA, 0x44, 0x01, 0x2A, 0x13, 0xAC, 0xD4, 0x03, 0x2C,
-    0x56, 0x63, 0x94, 0x73, 0x9D, 0x88, 0x1B, 0x74, 0x18, 0x55, 0x3F, 0x95, 0x99, 0x42, 0x84, 0x76,
-    0x4F, 0x9E, 0x2C, 0x77, 0x1B, 0xED, 0x96, 0x8B, 0xD9, 0xB7, 0x2C, 0x2A, 0xE5, 0x8C, 0xE4, 0x71,
-    0xA7, 0x33, 0xC0, 0xC6, 0xFD, 0x3D, 0x6D, 0x8B, 0x82, 0xC6, 0xCD, 0xB5, 0x31, 0xD1, 0x9E, 0x57,
-    0x9C, 0x2B, 0xB7, 0x58, 0x70, 0x1B, 0xCA, 0x99, 0xB1, 0xDB, 0xE1, 0xD0, 0x42, 0x7C, 0x01, 0x98,
-    0x1D, 0x37, 0x09, 0x0D, 0xFB, 0x4B, 0xE6, 0x3A, 0xC6, 0xC7, 0x36, 0x81, 0xB4, 0x5A, 0xE4, 0xC7,
-    0xCE, 0x4B, 0xE4, 0x96, 0x2E, 0xDB, 0xCD, 0x1E, 0xF7, 0x17, 0xC7, 0x2D, 0x81, 0x7D, 0xEA, 0xE0,
-    0x94, 0x44, 0x74, 0xD6, 0x24, 0x60, 0x41, 0xB0, 0x8B, 0x1C, 0x00, 0xC7, 0xDC, 0x74, 0x1A, 0x74,
-    0xD0, 0x6D, 0x2E, 0x25, 0x4C, 0x13, 0x31, 0x3B, 0x1B, 0x9D, 0x7C, 0x44, 0xE3, 0x92, 0x69, 0x9D,
-    0x0E, 0xA9, 0xF3, 0xE1, 0x90, 0x7E, 0xD6, 0x3B, 0x75, 0x50, 0x07, 0x55, 0x50, 0x72, 0x67, 0x3E,
-    0x2A, 0x98, 0xCA, 0x26, 0xDA, 0xA8, 0xE0, 0xAE, 0xE4, 0xF4, 0x5C, 0xD6, 0xC5, 0x95, 0x33, 0xEC,
-    0x17, 0x7B, 0x43, 0x93, 0x9C, 0x6F, 0xB7, 0x3C, 0xB1, 0x15, 0x8A, 0xEA, 0x64, 0x36, 0xB4, 0x35,
-    0x88, 0x69, 0x7C, 0x86, 0xA7, 0x7C, 0x38, 0xA8, 0xC1, 0x19, 0xCE, 0xDE, 0x8A, 0xCA, 0x0A, 0x9F,
-    0x42, 0x0F, 0x47, 0x2F, 0x69, 0x6F, 0xA3, 0xC0, 0x29, 0xEE, 0x2F, 0x0F, 0xA2, 0x83, 0x1C, 0xBB,
-    0x75, 0xFA, 0xC7, 0x32, 0x35, 0xA0, 0xC2, 0xE7, 0x57, 0xF8, 0xE0, 0x4A, 0x0D, 0x57, 0xEA, 0xD5,
-    0x77, 0x30, 0xCB, 0xBF, 0x62, 0xE9, 0xE0, 0x53, 0xD0, 0x11, 0x7C, 0xCE, 0xBC, 0x6F, 0x4E, 0x79,
-    0xB1, 0x66, 0x8E, 0x72, 0xF6, 0xB6, 0x72, 0x6D, 0xB4, 0x84, 0xDA, 0x81, 0xD5, 0xB6, 0x63, 0xC7,
-    0xD9, 0x67, 0xD2, 0x44, 0x73, 0x7E, 0x3B, 0xEE, 0x1D, 0xEE, 0xD0, 0x70, 0x8D, 0xC6, 0x85, 0x3D,
-    0x7A, 0xB5, 0x57, 0xFB, 0x6B, 0x20, 0xC6, 0x67, 0x83, 0x68, 0xED, 0xA4, 0x85, 0x84, 0x81, 0xD5,
-    0x35, 0x08, 0x99, 0xAD, 0x13, 0x17, 0x72, 0xFE, 0x53, 0xC8, 0xD4, 0x7D, 0x91, 0x27, 0xBB, 0x00,
-    0x84, 0xD2, 0xA6, 0xD6, 0x52, 0xE0, 0xD4, 0x58, 0xCA, 0x9C, 0x7B, 0x9F, 0x72, 0x28, 0x10, 0xFB,
-    0x28, 0xF9, 0x70, 0x10, 0xFE, 0x20, 0xFF, 0x41, 0x05, 0x8A, 0x51, 0x0B, 0xAC, 0x22, 0x68, 0xC3,
-    0x00, 0x93, 0xAA, 0x27, 0xED, 0xD1, 0xBD, 0xD8, 0x63, 0xDC, 0x83, 0x36, 0x4F, 0x5B, 0x34, 0x66,
-    0xF9, 0x3C, 0xC0, 0x48, 0x1C, 0x29, 0x13, 0x59, 0x29, 0x69, 0x7A, 0xB5, 0xFA, 0x85, 0xFF, 0x73,
-    0xF5, 0xB3, 0x5B, 0x43, 0x2C, 0x24, 0x93, 0xA7, 0x2D, 0x3D, 0xC4, 0x94, 0x3A, 0x90, 0xA8, 0x6C,
-    0xD5, 0x0E, 0x57, 0xCE, 0x7D, 0x2D, 0x8A, 0x20, 0xD1, 0x76, 0x79, 0xCE, 0x9D, 0x72, 0xEE, 0x05,
-    0x64, 0xB6, 0x95, 0x3E, 0x53, 0xE9, 0x66, 0x3B, 0x8D, 0x64, 0xA3, 0x00, 0x0D, 0xE1, 0x33, 0x54,
-    0x47, 0x6E, 0x7F, 0x2C, 0x08, 0x20, 0x19, 0xEC, 0x73, 0x77, 0xF6, 0x31, 0xF0, 0x8D, 0xFF, 0x11,
-    0x0A, 0x1B, 0x1F, 0x82, 0xF6, 0xB8, 0x22, 0x59, 0x85, 0x1A, 0x94, 0x2E, 0x15, 0xC3, 0x6D, 0xEC,
-    0xFA, 0xC3, 0x76, 0xA5, 0x76, 0x43, 0x02, 0xF6, 0x40, 0x42, 0xF6, 0x3F, 0x90, 0x1D, 0x6B, 0x1B,
-    0xBE, 0x66, 0x16, 0xDD, 0xC1, 0x41, 0xAB, 0xE3, 0x17, 0x94, 0x5B, 0xA7, 0x3B, 0x69, 0xF9, 0x32,
-    0xD2, 0x3D, 0x16, 0x88, 0x6B, 0x86, 0xF1, 0xF4, 0xF5, 0x81, 0xA1, 0x3B, 0x1D, 0x18, 0xFC, 0xB9,
-    0xAD, 0x1E, 0xD7, 0x03, 0xC3, 0xBF, 0x20, 0xAE, 0xF5, 0x3F, 0x40, 0x02, 0xBD, 0xE0, 0xCA, 0x5B,
-    0x76, 0xF9, 0xFC, 0x74, 0x8C, 0xB5, 0x81, 0x96, 0x84, 0xCC, 0xEC, 0xB6, 0x58, 0xD2, 0x44, 0x75,
-    0xDC, 0xCC, 0x1A, 0xF7, 0xD9, 0xCF, 0x1B, 0xF7, 0x77, 0xE9, 0xDC, 0x7D, 0x61, 0xEE, 0x7A, 0x6B,
-    0x4F, 0xB7, 0x04, 0xE3, 0x13, 0x2E, 0x83, 0xE5, 0x45, 0xF9, 0xE9, 0x74, 0x67, 0x7F, 0xD5, 0x05,
-    0x00, 0x2F, 0xEF, 0xD5, 0xCE, 0x5C, 0x0E, 0x96, 0xEF, 0x5A, 0x16, 0xAC, 0xC7, 0x13, 0xB8, 0x99,
-    0xC5, 0xED, 0x63, 0xBA, 0x49, 0x7E, 0x89, 0x8B, 0xAF, 0x60, 0x46, 0x14, 0x6C, 0x28, 0x22, 0x68,
-    0x5D, 0x51, 0x1A, 0xFF, 0x72, 0x0A, 0x1C, 0xE7, 0xB6, 0xFB, 0xFB, 0x7B, 0x72, 0xB2, 0x0F, 0xB8,
-    0x45, 0x14, 0x71, 0x1B, 0xAF, 0xA6, 0x9A, 0x57, 0x52, 0x6E, 0xE9, 0x75, 0xC4, 0xE7, 0x27, 0x86,
-    0xFD, 0x94, 0x44, 0x8E, 0x64, 0x5F, 0xAE, 0x24, 0x73, 0xE0, 0x90, 0x53, 0xE4, 0xE5, 0xF0, 0xFC,
-    0x09, 0x54, 0xB0, 0xBC, 0x26, 0x91, 0x51, 0xFD, 0x25, 0x37, 0x17, 0x02, 0xA7, 0x7A, 0x58, 0x95,
-    0x5F, 0x5A, 0xCE, 0x71, 0x8D, 0xE5, 0xE5, 0x39, 0xD2, 0xEF, 0x38, 0xBF, 0xC8, 0x7B, 0xFE, 0x90,
-    0x0D, 0xEB, 0x7F, 0x6B, 0x2F, 0x45, 0xFD, 0x87, 0x8C, 0xBD, 0xB4, 0xF5, 0xAD, 0x51, 0x63, 0x51,
-    0xBE, 0xC4, 0x26, 0xAE, 0xF1, 0x9B, 0xC7, 0xDE, 0x18, 0xFB, 0x03, 0x5C, 0x28, 0xA0, 0xC2, 0x07,
-    0xAC, 0x1B, 0x43, 0x7A, 0x35, 0x0D, 0x37, 0xA8, 0xA0, 0x13, 0xBA, 0xA1, 0x43, 0x92, 0x0A, 0x54,
-    0xF7, 0x59, 0x10, 0x24, 0x8C, 0xAB, 0x09, 0x1B, 0x5E, 0xC9, 0x9E, 0x9D, 0x70, 0xEC, 0xAA, 0x1F,
-    0x7B, 0x04, 0xEC, 0x4D, 0x20, 0xB5, 0x53, 0x69, 0xC7, 0x97, 0x2D, 0x87, 0xD4, 0xE3, 0x13, 0x55,
-    0x7D, 0xEA, 0xC2, 0x1F, 0x38, 0x9F, 0xA7, 0x48, 0x00, 0x6B, 0xEF, 0x51, 0x8A, 0x2C, 0xB0, 0xF6,
-    0x6F, 0xE5, 0x3E, 0x88, 0x09, 0x11, 0xC7, 0xC0, 0xE3, 0x95, 0x28, 0xBF, 0x88, 0xC3, 0x24, 0xCA,
-    0x27, 0x38, 0xDC, 0x8E, 0xF2, 0xDB, 0x38, 0xD4, 0x21, 0x4A, 0x0E, 0xEF, 0xB7, 0x65, 0xF8, 0xD3,
-    0xC2, 0x78, 0xFF, 0x59, 0x84, 0x1F, 0xC3, 0xF3, 0xBD, 0x34, 0xE1, 0xCF, 0xEC, 0xF3, 0x56, 0x14,
-    0x7F, 0xAB, 0x4C, 0xD3, 0xF6, 0x3C, 0xCC, 0x68, 0x9F, 0x30, 0x1B, 0x6E, 0x8B, 0xF9, 0xEC, 0x2F,
-    0xA1, 0xE0, 0xF4, 0xEB, 0x9B, 0x74, 0xCF, 0x7B, 0xF4, 0xD7, 0xEA, 0x87, 0x97, 0x83, 0x68, 0x6D,
-    0xA4, 0x67, 0xAF, 0x45, 0x62, 0xF7, 0x7E, 0x46, 0xE5, 0x61, 0xA7, 0xF2, 0x26, 0x55, 0xEA, 0x08,
-    0x18, 0x41, 0x45, 0x1A, 0x73, 0xB9, 0x72, 0x16, 0x29, 0xAC, 0x7F, 0x7C, 0xA4, 0x84, 0x75, 0x20,
-    0x40, 0x04, 0xC0, 0xDA, 0xE9, 0x55, 0x01, 0x22, 0x0F, 0x0D, 0x31, 0xB3, 0xD2, 0xB3, 0xB5, 0x29,
-    0xE4, 0x68, 0x37, 0xF0, 0x18, 0x0F, 0x2A, 0x02, 0xE8, 0xF3, 0xD9, 0x3E, 0xFA, 0x6F, 0xA5, 0x0E,
-    0x37, 0x95, 0x46, 0x4C, 0xD4, 0x8D, 0x50, 0x24, 0x53, 0x0F, 0xD0, 0x7A, 0x99, 0xB1, 0xFF, 0x63,
-    0xC6, 0xA7, 0x51, 0xEC, 0x23, 0x40, 0xDA, 0x86, 0x19, 0x53, 0x8A, 0x6C, 0x59, 0x7A, 0x25, 0x6A,
-    0x6A, 0xC5, 0xCF, 0xC7, 0x04, 0x3A, 0x67, 0x19, 0x93, 0x42, 0x27, 0x51, 0xF8, 0xD5, 0x4C, 0xE8,
-    0xCB, 0x71, 0xFB, 0x7C, 0xE8, 0x58, 0xCC, 0xC6, 0x16, 0x88, 0x77, 0xF2, 0xF7, 0x73, 0xFC, 0xFD,
-    0xEB, 0x74, 0x25, 0xD7, 0x89, 0xE8, 0x1E, 0x0B, 0xB4, 0x86, 0x73, 0xEA, 0x59, 0x14, 0xE6, 0x65,
-    0xB5, 0xDD, 0x0E, 0x9E, 0x0F, 0x26, 0xB7, 0x16, 0xEC, 0xA2, 0xD3, 0xDB, 0x01, 0x5C, 0x04, 0xC6,
-    0xCF, 0x8A, 0x5E, 0x05, 0x09, 0x6F, 0x5B, 0xC6, 0xCC, 0xB3, 0x2A, 0x8C, 0x62, 0xED, 0xAD, 0x07,
-    0x61, 0xEC, 0x1E, 0xCB, 0xA5, 0xC3, 0xD7, 0xBD, 0x44, 0x5C, 0xB0, 0x18, 0xA0, 0xD3, 0x93, 0x66,
-    0xAF, 0xD8, 0x9D, 0x18, 0x0B, 0x9E, 0x6E, 0x28, 0xB0, 0x93, 0xBB, 0xB6, 0x4A, 0xA4, 0x03, 0x6E,
-    0x4E, 0x93, 0x13, 0x9D, 0xC1, 0x19, 0xA6, 0xE0, 0x6E, 0x36, 0xF7, 0x81, 0xF8, 0xC8, 0x87, 0xFB,
-    0xD8, 0x5C, 0x0C, 0x7B, 0x73, 0x35, 0xBA, 0x55, 0xDC, 0xD8, 0x70, 0xE7, 0x28, 0x68, 0x66, 0xCD,
-    0x64, 0xA8, 0x39, 0xFF, 0x1B, 0xD5, 0x5A, 0x3D, 0x8C, 0xDD, 0xD6, 0x95, 0x3E, 0x24, 0xA5, 0x21,
-    0xD6, 0x44, 0xCC, 0x29, 0x56, 0x40, 0x60, 0x45, 0x62, 0x0A, 0x15, 0x86, 0xAD, 0x11, 0x9B, 0x20,
-    0x51, 0xF1, 0x46, 0xA4, 0xE3, 0x22, 0x65, 0xA6, 0xD0, 0x54, 0x2A, 0xD4, 0xA4, 0x71, 0x80, 0x40,
-    0x06, 0x56, 0x85, 0x8A, 0x99, 0x21, 0x13, 0x17, 0x29, 0x3D, 0x45, 0x60, 0x04, 0x9B, 0xC6, 0x45,
-    0x1A, 0x4F, 0x0A, 0xB9, 0xD0, 0x02, 0x83, 0x40, 0xF3, 0x48, 0xD9, 0x85, 0x8B, 0x14, 0x61, 0x82,
-    0x18, 0x29, 0x52, 0x84, 0x49, 0xA4, 0x24, 0x80, 0x91, 0x0D, 0x93, 0xA5, 0x76, 0x29, 0x2F, 0xF9,
-    0xB8, 0xDF, 0x77, 0xEE, 0x7D, 0x6F, 0xDE, 0x8C, 0xC6, 0xC9, 0x62, 0x11, 0x09, 0xB3, 0x9C, 0xC7,
-    0x43, 0xCE, 0x7B, 0xE4, 0x3D, 0xBF, 0xF7, 0xFC, 0xDD, 0x2B, 0x22, 0x12, 0xA7, 0x92, 0x94, 0x92,
-    0x95, 0x92, 0xA4, 0x72, 0x56, 0xEC, 0x71, 0x55, 0xE4, 0xB6, 0xC8, 0x3D, 0x91, 0x86, 0x1F, 0xA7,
-    0x11, 0xB7, 0x16, 0xAF, 0x16, 0xBF, 0x92, 0xA0, 0x92, 0xB0, 0xE4, 0x27, 0x2A, 0x25, 0xCE, 0x25,
-    0xC9, 0xF9, 0x5E, 0x96, 0xE2, 0x1D, 0x1F, 0x67, 0x88, 0x33, 0xC2, 0xED, 0xD8, 0x4A, 0x7C, 0xB7,
-    0x97, 0x83, 0xCB, 0x33, 0xB7, 0x9B, 0x1C, 0xF8, 0xCD, 0xD5, 0x3B, 0x61, 0x7D, 0x1B, 0x6F, 0xBD,
-    0x2F, 0x31, 0xCE, 0x24, 0xAF, 0xF1, 0x16, 0xCE, 0xD7, 0x2A, 0x49, 0xBE, 0x0A, 0xCC, 0xAF, 0xE3,
-    0x7C, 0x2B, 0x97, 0xF8, 0xC3, 0xB4, 0x0C, 0xFF, 0x3B, 0x28, 0xBD, 0x71, 0x14, 0x29, 0x3A, 0x91,
-    0x17, 0x31, 0xDC, 0xE7, 0x70, 0x7E, 0x61, 0x4E, 0x17, 0x46, 0xAE, 0x45, 0xB2, 0x1F, 0xF5, 0xE2,
-    0x74, 0x32, 0x13, 0xAF, 0x91, 0x1D, 0x12, 0xB5, 0x4E, 0x82, 0x2E, 0x11, 0xC8, 0x71, 0x00, 0x7A,
-    0xC5, 0x1D, 0xC7, 0x9E, 0x00, 0x23, 0x82, 0x89, 0x65, 0x80, 0x77, 0xF1, 0x88, 0x3E, 0x4C, 0x16,
-    0xD6, 0x89, 0xE2, 0xC7, 0xBB, 0xB2, 0x01, 0x0A, 0xDE, 0xA9, 0xE3, 0x71, 0x1C, 0xD3, 0x97, 0xE5,
-    0x16, 0x5E, 0x13, 0x27, 0x55, 0xF4, 0x97, 0x44, 0xDE, 0xDC, 0x8E, 0x1F, 0xB5, 0xD1, 0x38, 0xD6,
-    0x41, 0x15, 0xE6, 0xA1, 0x78, 0xE5, 0x45, 0x71, 0xAA, 0x0B, 0x22, 0xF5, 0x1A, 0x4E, 0xDC, 0xD7,
-    0xFC, 0x2E, 0x28, 0xC3, 0x3C, 0x9A, 0x8D, 0xD5, 0x4E, 0xF6, 0xB8, 0x85, 0x2C, 0xDF, 0xE4, 0xBB,
-    0xF1, 0x98, 0x67, 0x43, 0x3C, 0x4B, 0x6F, 0x75, 0x7E, 0x0B, 0xDA, 0x3C, 0x80, 0xD4, 0xED, 0x04,
-    0xAF, 0xF4, 0x32, 0x11, 0xE9, 0xE5, 0x7D, 0x91, 0xC1, 0x01, 0x55, 0x53, 0x0F, 0x04, 0x65, 0x14,
-    0x65, 0x72, 0x81, 0x60, 0x4B, 0xE4, 0xEC, 0xAD, 0xC7, 0x1B, 0x18, 0x60, 0x84, 0x3A, 0x22, 0x52,
-    0x4B, 0x70, 0x2E, 0xFB, 0x38, 0x95, 0x62, 0x1C, 0x71, 0x9B, 0x90, 0xBA, 0x4C, 0xE6, 0x60, 0x86,
-    0xF3, 0xFC, 0xF8, 0x3D, 0xC8, 0x90, 0x2C, 0xAF, 0xDE, 0x5B, 0x3E, 0x8C, 0x18, 0x8F, 0x7F, 0xA7,
-    0xEC, 0x15, 0x78, 0xCF, 0x7B, 0x04, 0x4B, 0x08, 0xD3, 0xB0, 0x92, 0x98, 0xA2, 0xBB, 0x26, 0x7E,
-    0x09, 0x40, 0x2A, 0x94, 0x05, 0xC5, 0x4D, 0x79, 0x64, 0x23, 0xDE, 0xF8, 0x0D, 0xE8, 0x71, 0xAB,
-    0xB8, 0x17, 0xAF, 0xF2, 0x67, 0x14, 0x68, 0x21, 0x5E, 0x87, 0x27, 0xDD, 0x19, 0x8D, 0x60, 0x84,
-    0x34, 0x24, 0x19, 0xC0, 0x5A, 0x00, 0x73, 0xC0, 0xF0, 0x94, 0x75, 0xA4, 0x52, 0x07, 0x1B, 0xE2,
-    0x36, 0x72, 0x99, 0x66, 0xB5, 0x85, 0xB7, 0xA9, 0x45, 0x1A, 0x20, 0xDE, 0x0A, 0xA1, 0x2A, 0x71,
-    0x8A, 0x5D, 0x91, 0x8B, 0x4E, 0x9D, 0x78, 0x6D, 0xE6, 0xB5, 0x6B, 0x14, 0x8A, 0x3D, 0x6E, 0x8D,
-    0xBB, 0x6A, 0x05, 0x77, 0xC9, 0x23, 0x8C, 0x8F, 0x14, 0x75, 0x3A, 0x18, 0xD0, 0x6F, 0x62, 0xB0,
-    0xA0, 0x8C, 0xC6, 0xFA, 0x0A, 0x0C, 0xF1, 0xC0, 0x6D, 0x43, 0x8C, 0xD1, 0x4A, 0xEB, 0xE7, 0x6B,
-    0xF8, 0x31, 0xF5, 0xCA, 0x09, 0xD5, 0x6D, 0x2F, 0x6E, 0x39, 0xA1, 0xDE, 0xDD, 0x6A, 0x71, 0xA9,
-    0xF4, 0x62, 0x1F, 0x81, 0x65, 0x51, 0xB5, 0x6E, 0x2B, 0x97, 0x7C, 0x68, 0x79, 0x90, 0x7B, 0x61,
-    0x1A, 0xE4, 0xF1, 0x58, 0x47, 0x20, 0xD7, 0x7D, 0x0F, 0x88, 0x88, 0x16, 0xA3, 0x53, 0xF6, 0x11,
-    0xDE, 0x09, 0x66, 0x7B, 0x24, 0x09, 0x22, 0x37, 0xC4, 0x6E, 0x28, 0xB5, 0xDF, 0xF7, 0x7E, 0xDF,
-    0x87, 0x79, 0x97, 0x48, 0xBB, 0xE3, 0x34, 0xF7, 0xDD, 0xA6, 0xF7, 0xEA, 0x3E, 0xA8, 0xFB, 0xB0,
-    0x9A, 0xFE, 0xCB, 0xA3, 0xE4, 0x83, 0xFE, 0x0C, 0x2D, 0x4B, 0x56, 0xC9, 0xAA, 0x6C, 0xF9, 0xA5,
-    0xD3, 0x44, 0x10, 0xFA, 0x81, 0xC4, 0xDF, 0xE9, 0xA4, 0x08, 0x1A, 0x99, 0x85, 0xB5, 0x64, 0x10,
-    0x56, 0xFC, 0x55, 0xD8, 0x4A, 0xDE, 0x41, 0x46, 0x5B, 0x20, 0x11, 0x76, 0x96, 0x9E, 0xA1, 0xE2,
-    0x5B, 0xD8, 0x27, 0x05, 0x7B, 0xEF, 0x33, 0xCE, 0xDB, 0xE7, 0x36, 0xD3, 0x64, 0xAC, 0xB2, 0xB1,
-    0x92, 0xA5, 0xE3, 0x6F, 0x4A, 0x50, 0x28, 0xC1, 0x8F, 0x60, 0xF6, 0x94, 0xE0, 0xF4, 0x06, 0x6C,
-    0xF9, 0xA2, 0x6C, 0x3B, 0x94, 0xA0, 0x6C, 0x4B, 0x0B, 0xB9, 0x2C, 0x2E, 0x4E, 0x03, 0x09, 0xCA,
-    0xCE, 0x8D, 0x0A, 0x32, 0x83, 0x35, 0x50, 0x74, 0xB2, 0x9D, 0x98, 0x4B, 0x98, 0xEB, 0x23, 0x41,
-    0xC5, 0xC9, 0xB1, 0xED, 0x35, 0x94, 0xE0, 0xB6, 0xD3, 0x41, 0x82, 0xDF, 0x1D, 0xAB, 0x11, 0x12,
-    0xFC, 0xD9, 0x66, 0x7A, 0xEE, 0x7F, 0x25, 0xC1, 0x73, 0x9B, 0x9B, 0x9B, 0x18, 0x1D, 0xFE, 0xE0,
-    0x9B, 0x7B, 0x7B, 0x7B, 0xFC, 0x36, 0x98, 0x61, 0x1E, 0x94, 0xDB, 0x5E, 0xBD, 0x2F, 0x4D, 0xAB,
-    0x9F, 0x7D, 0xA7, 0xD9, 0xF1, 0xEB, 0x68, 0xCC, 0x57, 0x9E, 0x18, 0x0E, 0x83, 0xF4, 0xC4, 0x73,
-    0x21, 0xB1, 0xCF, 0xF8, 0x7D, 0xF9, 0x18, 0xE7, 0xCF, 0x9E, 0xDD, 0xD0, 0x79, 0xE1, 0x74, 0x71,
-    0xEA, 0x36, 0x61, 0x2E, 0x35, 0x4E, 0x89, 0x52, 0x33, 0x1F, 0xC0, 0x02, 0x5C, 0x23, 0x4D, 0x57,
-    0xAE, 0x50, 0xE6, 0x2B, 0x30, 0x99, 0x17, 0x61, 0xC1, 0x83, 0x24, 0xB4, 0x62, 0x1E, 0x7C, 0x1F,
-    0xFF, 0x7B, 0x4D, 0x02, 0xBB, 0x89, 0x53, 0x27, 0xE7, 0x54, 0xC5, 0x24, 0x85, 0xFB, 0x92, 0x02,
-    0x43, 0xDD, 0xA0, 0x02, 0xF9, 0xEC, 0x81, 0xBC, 0x8C, 0x73, 0x0B, 0xF7, 0xC9, 0xD7, 0x5A, 0x01,
-    0x37, 0x46, 0x00, 0x6F, 0x38, 0x83, 0xD7, 0xC2, 0xA6, 0xE9, 0x91, 0xE1, 0xCF, 0x0E, 0x08, 0x7A,
-    0x4E, 0xFF, 0x1E, 0xDE, 0x17, 0x8E, 0x23, 0xA1, 0x0B, 0xC1, 0xD8, 0x2D, 0x01, 0xBD, 0x21, 0xC0,
-    0x54, 0xFC, 0x1A, 0x16, 0x0B, 0x83, 0xEE, 0xF1, 0xB8, 0x63, 0x41, 0x54, 0xF2, 0xC9, 0xDC, 0xEB,
-    0xA5, 0x48, 0xBD, 0xC1, 0xFD, 0x73, 0x1A, 0x8C, 0x63, 0x34, 0x0B, 0x6F, 0xF6, 0x61, 0x17, 0xBE,
-    0x96, 0x3A, 0x9C, 0x7B, 0x98, 0xE0, 0x8B, 0xA9, 0x0E, 0xCB, 0x00, 0xE0, 0x44, 0x4D, 0xA8, 0x8E,
-    0x88, 0xFF, 0x52, 0x1D, 0x1B, 0x3E, 0xE5, 0x12, 0x8D, 0x8F, 0x33, 0xD8, 0x56, 0xB3, 0x26, 0x0A,
-    0xB2, 0xA3, 0xE0, 0xF0, 0x87, 0x98, 0x20, 0x24, 0x70, 0x09, 0x10, 0x4C, 0xFE, 0x11, 0xC0, 0x69,
-    0x20, 0xEE, 0xB8, 0x89, 0x1F, 0xCA, 0x2B, 0xEF, 0xBE, 0xF2, 0x43, 0xDC, 0xE6, 0x49, 0x89, 0xBF,
-    0x1C, 0xE1, 0x6B, 0x55, 0x6A, 0xB7, 0x75, 0x66, 0xE0, 0x21, 0x91, 0x9D, 0xA2, 0xA7, 0xCF, 0x49,
-    0x29, 0x8E, 0xAC, 0x0A, 0xFE, 0x5C, 0xBA, 0x5F, 0x37, 0x91, 0x2B, 0xD7, 0xA0, 0xA7, 0x8C, 0xEE,
-    0xE8, 0xE7, 0x00, 0x9E, 0x97, 0x04, 0xEB, 0xFC, 0xD8, 0xF5, 0xFE, 0xB3, 0x0B, 0xCB, 0x21, 0x96,
-    0xE9, 0x35, 0x99, 0x1E, 0xC8, 0xC1, 0x7D, 0xE9, 0xEF, 0x3B, 0xFD, 0x01, 0x54, 0x08, 0x8F, 0x3F,
-    0xAA, 0x5A, 0x30, 0xFF, 0x60, 0x09, 0x22, 0x2D, 0xA2, 0xC6, 0x7D, 0x7A, 0x48, 0x4C, 0x9D, 0xE4,
-    0x75, 0xA8, 0xED, 0x01, 0x34, 0xF2, 0x56, 0x27, 0xD3, 0xA0, 0x76, 0xBA, 0x28, 0xF7, 0xEA, 0x6B,
-    0xF0, 0xA5, 0xAD, 0xAC, 0xB9, 0x95, 0xAC, 0x3A, 0x1C, 0xDC, 0x58, 0x19, 0xE8, 0x91, 0x3B, 0x30,
-    0x83, 0x8A, 0xC1, 0x15, 0x74, 0xD1, 0x03, 0x92, 0xB6, 0x20, 0x57, 0x25, 0x47, 0x46, 0xDE, 0xEB,
-    0x26, 0x38, 0xEF, 0xAB, 0x46, 0x1C, 0xD5, 0x84, 0x30, 0x32, 0x80, 0xE0, 0x90, 0xAC, 0xEE, 0xE0,
-    0x41, 0x58, 0xD3, 0x01, 0x82, 0xC7, 0x48, 0xFA, 0x5B, 0x77, 0x04, 0x0F, 0x7F, 0xAD, 0x83, 0x1D,
-    0xA2, 0x28, 0x2F, 0x6F, 0x6B, 0x54, 0xBB, 0x7D, 0x1F, 0x97, 0x2B, 0x4E, 0x45, 0x1B, 0xDB, 0xF2,
-    0x73, 0x5E, 0x9A, 0x70, 0x6F, 0xB6, 0x0B, 0x9C, 0x0C, 0x62, 0x0C, 0x7E, 0xF4, 0x75, 0x60, 0x86,
-    0x97, 0x75, 0xE3, 0x9C, 0xF7, 0x4D, 0x30, 0x98, 0x1F, 0x87, 0x54, 0xBF, 0xAF, 0x54, 0xC3, 0x6B,
-    0x93, 0x6A, 0x30, 0xAE, 0x12, 0x4D, 0x95, 0xEA, 0x2B, 0x86, 0xEA, 0x2D, 0x43, 0xB5, 0x25, 0xB7,
-    0xD2, 0x0B, 0xF9, 0x22, 0xB9, 0xCE, 0x75, 0x5E, 0xD6, 0xE3, 0x91, 0x54, 0xEF, 0x1F, 0xE0, 0xA5,
-    0xC1, 0x69, 0xBA, 0xA0, 0x4A, 0xC6, 0xFF, 0x28, 0x6F, 0xD3, 0xFF, 0x62, 0x72, 0xD1, 0x1B, 0xC7,
-    0x7A, 0xC7, 0xA0, 0xC8, 0x41, 0x5B, 0xA5, 0x07, 0x38, 0xF1, 0x21, 0x4E, 0xC5, 0x97, 0xCA, 0xC4,
-    0x4D, 0xF1, 0xB3, 0x53, 0x7B, 0x29, 0x70, 0xFA, 0xCC, 0x18, 0x1A, 0x4C, 0x9B, 0x71, 0x41, 0xF4,
-    0x39, 0xA5, 0xDA, 0xE1, 0x44, 0xBC, 0x0C, 0xDA, 0x77, 0x38, 0x4A, 0x50, 0xAA, 0x24, 0xDD, 0xDC,
-    0x4A, 0xF2, 0x40, 0xF1, 0xC0, 0xC9, 0x53, 0xE4, 0xA0, 0x0A, 0x18, 0xE5, 0x46, 0x43, 0x8C, 0x08,
-    0xCA, 0xAE, 0xBA, 0xA1, 0xDE, 0x2F, 0xCF, 0x22, 0x7E, 0xF7, 0x61, 0x9A, 0xA4, 0xFB, 0x4E, 0x77,
-    0x05, 0xB2, 0x9E, 0x06, 0xCD, 0x16, 0x64, 0x8D, 0x78, 0xDE, 0x40, 0xD6, 0xCE, 0x86, 0x57, 0xA9,
-    0xAC, 0x83, 0x52, 0x65, 0x1D, 0x19, 0x59, 0xAF, 0x1B, 0x59, 0xEF, 0xAB, 0xAC, 0xE1, 0xD8, 0x29,
-    0x6B, 0x88, 0x43, 0x65, 0x9D, 0xEB, 0x25, 0x32, 0xB2, 0x9E, 0x1C, 0x95, 0x35, 0x0F, 0xF5, 0x2F,
-    0xCC, 0x01, 0x6C, 0x68, 0x3F, 0xB3, 0xF4, 0xDB, 0xC4, 0x64, 0x67, 0xB4, 0x1F, 0x3A, 0x79, 0x44,
-    0x09, 0xCC, 0x67, 0x86, 0x5D, 0x41, 0xCC, 0xD6, 0xA7, 0x0B, 0x9B, 0x01, 0x0C, 0xE2, 0xA7, 0xF0,
-    0x02, 0xE5, 0x0C, 0xDA, 0xC9, 0x30, 0x47, 0xE2, 0x47, 0xA3, 0x26, 0x66, 0x72, 0x4E, 0x07, 0x7A,
-    0x45, 0x61, 0xAC, 0xF3, 0x5A, 0x33, 0x25, 0xA3, 0x2D, 0x63, 0x69, 0x9A, 0xFE, 0x1D, 0x3D, 0xE8,
-    0xA9, 0x45, 0x11, 0x01, 0xAB, 0xC2, 0x50, 0x7D, 0xDC, 0xBA, 0xC2, 0x3B, 0x0A, 0x9B, 0x81, 0x81,
-    0xBD, 0x26, 0xF4, 0xCA, 0xA9, 0xBA, 0xE2, 0x42, 0x33, 0xC2, 0x4C, 0x93, 0xAB, 0x44, 0xE9, 0x26,
-    0x6C, 0x48, 0xA9, 0xFB, 0xE9, 0x1E, 0x5C, 0x20, 0x52, 0x2D, 0x38, 0x3B, 0x28, 0x34, 0x56, 0xCB,
-    0x87, 0x6B, 0x9B, 0x28, 0x41, 0xFB, 0xCA, 0x11, 0xC5, 0x55, 0xA9, 0xD0, 0xEA, 0x9B, 0x4F, 0x90,
-    0x17, 0x3C, 0x41, 0x6C, 0xF2, 0x47, 0x95, 0x97, 0xF3, 0x43, 0x99, 0xE7, 0x12, 0x96, 0x01, 0x75,
-    0x5C, 0x3A, 0x61, 0x90, 0x92, 0x9D, 0x7A, 0xFA, 0xDF, 0x30, 0xF6, 0x69, 0xB2, 0x5A, 0x1A, 0x6B,
-    0xF8, 0x36, 0xB9, 0x58, 0x57, 0x35, 0xBC, 0x8B, 0xBF, 0xD3, 0x4D, 0xFF, 0x59, 0xE3, 0x15, 0xE2,
-    0x36, 0xD4, 0xA0, 0x3D, 0xFB, 0x16, 0x2F, 0x55, 0x66, 0x92, 0xE5, 0x60, 0x57, 0xE4, 0x64, 0x05,
-    0x58, 0x0E, 0x2C, 0x0B, 0x96, 0x07, 0xCB, 0x84, 0xE5, 0xC2, 0xB0, 0x61, 0xF9, 0xB0, 0x8C, 0x58,
-    0x4E, 0x2C, 0x2B, 0x96, 0x17, 0xCB, 0x8C, 0xE1, 0xC6, 0xB2, 0x63, 0xF9, 0xB1, 0x0C, 0x59, 0x8E,
-    0x2C, 0x4B, 0x96, 0x27, 0xC3, 0x94, 0x99, 0x8A, 0xB5, 0x18, 0xB6, 0xE4, 0x50, 0x2F, 0x26, 0xDD,
-    0x44, 0xEA, 0xC9, 0x34, 0x57, 0xE1, 0x9A, 0x5B, 0xCB, 0x49, 0xC7, 0xA9, 0x33, 0x29, 0xE3, 0xA7,
-    0x55, 0x6C, 0xF1, 0x5D, 0xEA, 0x67, 0xE2, 0x71, 0x7E, 0x5F, 0x55, 0x67, 0x67, 0xEE, 0x63, 0x35,
-    0xB5, 0x60, 0x38, 0x2D, 0x34, 0xA3, 0x2C, 0xD3, 0xB2, 0x46, 0xDC, 0xC2, 0xDE, 0xC8, 0x64, 0x30,
-    0xA9, 0xA8, 0xFC, 0x1B, 0xAA, 0x36, 0x9D, 0xC7, 0x7F, 0xB1, 0x37, 0xDE, 0x07, 0x1D, 0x12, 0x77,
-    0x12, 0xF4, 0xBA, 0x31, 0x26, 0xB9, 0xE8, 0xD9, 0x9B, 0x89, 0x71, 0x04, 0x08, 0x17, 0x81, 0xB9,
-    0x71, 0xEB, 0xF0, 0xD1, 0xA6, 0xD6, 0xA5, 0x65, 0x38, 0x6A, 0x0A, 0x1C, 0x4A, 0xF8, 0xF1, 0xA6,
-    0x29, 0xF3, 0xB4, 0x88, 0x42, 0xA5, 0xB5, 0x57, 0x94, 0x66, 0x16, 0xAA, 0xCD, 0x90, 0x5D, 0x53,
-    0x4B, 0x31, 0x1F, 0x34, 0xDE, 0x24, 0xD2, 0x74, 0xED, 0x82, 0x9A, 0xD0, 0x94, 0xA1, 0x84, 0xD1,
-    0x61, 0xE0, 0xBF, 0xC8, 0x98, 0x9D, 0x81, 0x49, 0x2C, 0x38, 0x3A, 0x3F, 0xDB, 0xBB, 0xDB, 0xD2,
-    0x86, 0x16, 0x4C, 0x18, 0x23, 0x37, 0x85, 0xCF, 0x27, 0x60, 0xD4, 0xEF, 0xE8, 0xA7, 0x91, 0xE7,
-    0x22, 0xB1, 0x42, 0xB9, 0x0C, 0x2C, 0x33, 0x86, 0x37, 0x4F, 0x05, 0xEE, 0x2B, 0x13, 0xA1, 0x71,
-    0x65, 0xF5, 0xA2, 0xD2, 0xD2, 0x20, 0x60, 0x53, 0xB1, 0x39, 0x54, 0xEA, 0xB4, 0xDE, 0xB6, 0xF7,
-    0x16, 0xE6, 0xF3, 0xB7, 0x72, 0x8E, 0x03, 0x3E, 0x60, 0x06, 0x08, 0xC7, 0xE0, 0x6C, 0xA6, 0x5A,
-    0x57, 0x0C, 0x0A, 0x1C, 0x33, 0xF3, 0x0A, 0x59, 0x24, 0x7C, 0x16, 0x2A, 0xC3, 0x99, 0x5A, 0x46,
-    0x66, 0x0C, 0xDE, 0x55, 0x27, 0x64, 0x45, 0x6C, 0xE6, 0xE6, 0xF6, 0x5C, 0x2A, 0xB6, 0xE2, 0x5F,
-    0x3E, 0x62, 0x65, 0xFE, 0x55, 0x85, 0x8E, 0x51, 0x62, 0xCF, 0xA8, 0xED, 0xA8, 0xFA, 0xDC, 0x9E,
-    0xBA, 0x33, 0xB3, 0xC5, 0x0C, 0x69, 0x54, 0x66, 0x60, 0xF0, 0x98, 0xAA, 0x09, 0x19, 0x26, 0xC5,
-    0x28, 0xCE, 0xE8, 0xC8, 0x08, 0x22, 0x5E, 0x62, 0xDE, 0xE8, 0x25, 0xD3, 0xCE, 0x00, 0x98, 0x58,
-    0xD3, 0x68, 0x37, 0x51, 0xA5, 0xF4, 0xAA, 0x88, 0x8E, 0xA9, 0xBE, 0x61, 0xD8, 0x3A, 0xD9, 0xFE,
-    0x10, 0xA7, 0x16, 0xFB, 0x96, 0xFE, 0xAB, 0xA7, 0x9E, 0xFE, 0x15, 0xF5, 0xA3, 0x91, 0x62, 0xC8,
-    0x34, 0x2D, 0xE9, 0x7A, 0x8D, 0xD4, 0x4C, 0x0E, 0x5F, 0xC0, 0xDF, 0xE9, 0xA6, 0xDF, 0xCF, 0xAF,
-    0x6A, 0x70, 0x9E, 0x2D, 0x60, 0x90, 0x6F, 0x9D, 0xE4, 0x49, 0x4F, 0x1B, 0xE5, 0x34, 0x7C, 0x6F,
-    0x5E, 0x9A, 0x6D, 0x5B, 0x83, 0xF1, 0x97, 0xE9, 0xED, 0x41, 0xED, 0x43, 0x93, 0x68, 0xF5, 0xC6,
-    0xC2, 0xDC, 0xCE, 0xC4, 0x02, 0xBE, 0x47, 0xCA, 0x78, 0x06, 0xB5, 0x89, 0x38, 0x3C, 0x49, 0x15,
-    0x69, 0x22, 0x45, 0x89, 0xAD, 0x20, 0x33, 0x59, 0xE4, 0x6B, 0x28, 0x5A, 0xE4, 0x3C, 0x6A, 0xF3,
-    0xC2, 0xF8, 0x8F, 0x37, 0xCC, 0xA0, 0xF4, 0x99, 0x81, 0xAD, 0x2F, 0xBF, 0xF4, 0x1C, 0xF1, 0xBF,
-    0xC0, 0x87, 0xF0, 0x52, 0x81, 0x6C, 0xF9, 0x31, 0x4A, 0xE6, 0x72, 0x0B, 0x3E, 0xF0, 0x0B, 0xCF,
-    0x0D, 0xBF, 0x9F, 0x5F, 0xC6, 0x3B, 0x53, 0x3D, 0x8F, 0x9B, 0xCC, 0xB3, 0xC6, 0x0D, 0x5B, 0x64,
-    0x66, 0x49, 0x63, 0x4C, 0x35, 0x8D, 0x8E, 0x6B, 0x45, 0x44, 0x27, 0x0D, 0x5C, 0x8A, 0xAE, 0xD7,
-    0xD7, 0x88, 0xB1, 0x30, 0x48, 0x0B, 0x83, 0x73, 0x71, 0x71, 0x6E, 0x3C, 0xBE, 0xCE, 0x76, 0x18,
-    0x3B, 0x8F, 0xF8, 0xEF, 0xE6, 0xA3, 0xEB, 0x2C, 0xD2, 0x48, 0xC6, 0x4C, 0x29, 0x61, 0xE4, 0x00,
-    0x31, 0x1C, 0x28, 0x31, 0xE9, 0x7B, 0x62, 0x92, 0xF9, 0xCC, 0xF4, 0xC8, 0x0A, 0xE3, 0xFC, 0x67,
-    0x9A, 0x20, 0xE2, 0xE1, 0xF3, 0x1D, 0x29, 0xFC, 0x11, 0xE3, 0x58, 0xA1, 0x8D, 0x4C, 0x39, 0x6C,
-    0x4A, 0x4A, 0xD4, 0x19, 0xD3, 0xDC, 0x19, 0x6F, 0x9A, 0xFC, 0x29, 0x31, 0xBE, 0x3A, 0x5D, 0x39,
-    0x29, 0x6F, 0x89, 0x07, 0x8E, 0x91, 0x82, 0x41, 0x11, 0x6D, 0x02, 0xE1, 0x5E, 0xFB, 0xA0, 0x23,
-    0x82, 0x46, 0xCE, 0x60, 0x58, 0x69, 0x3B, 0xC4, 0xFD, 0x75, 0xAD, 0xB5, 0x96, 0xF7, 0x51, 0xA3,
-    0x7D, 0x5D, 0xEF, 0xC3, 0x4E, 0xAF, 0xFE, 0x07, 0xBD, 0x5C, 0xD4, 0xC9, 0x3D, 0x70, 0x0A, 0x69,
-    0x72, 0x30, 0xD1, 0xF0, 0x9A, 0xA5, 0xE6, 0x9A, 0x94, 0xBC, 0x5E, 0x04, 0xBB, 0xAC, 0x52, 0xAE,
-    0x20, 0xA4, 0xB1, 0x1D, 0xB5, 0x06, 0xFE, 0x1A, 0xAD, 0x60, 0xBC, 0xCE, 0x5C, 0xDD, 0xA1, 0x36,
-    0x95, 0x8C, 0x76, 0x7C, 0xF0, 0x8C, 0x86, 0xE9, 0xC6, 0x14, 0x3E, 0xAC, 0x43, 0x28, 0x82, 0xF3,
-    0x43, 0xAA, 0xDD, 0x87, 0x62, 0x34, 0xA5, 0xDF, 0x3C, 0xF1, 0xB7, 0xF1, 0x68, 0x67, 0x29, 0x80,
-    0x69, 0x9D, 0x89, 0xEA, 0xEE, 0x18, 0xC3, 0xE7, 0x75, 0xF8, 0xF1, 0x93, 0x41, 0xA3, 0x70, 0xA6,
-    0x2D, 0x2F, 0x18, 0x45, 0xA6, 0x02, 0xE7, 0x97, 0x0D, 0xA3, 0xB0, 0xD7, 0x52, 0xC1, 0x5E, 0xC7,
-    0x28, 0x0C, 0x58, 0x13, 0xD2, 0x64, 0xBC, 0x8E, 0x54, 0xF8, 0x2D, 0x23, 0xAC, 0x81, 0x41, 0x43,
-    0x13, 0x0A, 0x6B, 0x46, 0xE1, 0xA8, 0x52, 0x73, 0x2A, 0xB5, 0xAD, 0x93, 0xF2, 0xD7, 0x19, 0xB5,
-    0x0C, 0xBD, 0x62, 0x04, 0x0C, 0x0F, 0xDB, 0xA0, 0xB6, 0xC7, 0x7F, 0x35, 0x51, 0xF8, 0x21, 0xE9,
-    0xB9, 0x6E, 0xE9, 0x7A, 0x4F, 0xA9, 0xED, 0x97, 0xAA, 0x18, 0xA5, 0xFC, 0xDA, 0xC9, 0xF5, 0xD7,
-    0x29, 0xE5, 0xE2, 0x05, 0xE3, 0x5F, 0x35, 0x4D, 0x53, 0x0A, 0xBD, 0xBF, 0x34, 0xAA, 0x0A, 0x96,
-    0x61, 0xCB, 0x2E, 0xE3, 0x54, 0x73, 0xB1, 0x61, 0x5A, 0x8B, 0xCC, 0x2D, 0xE3, 0xF1, 0x57, 0x78,
-    0xF3, 0x6A, 0xC4, 0x87, 0x56, 0xDD, 0x87, 0xFF, 0x2F, 0xE8, 0x67, 0x7F, 0x96, 0x8E, 0xAE, 0x50,
-    0x38, 0xD5, 0x6F, 0x26, 0x27, 0x96, 0x2C, 0xA7, 0x91, 0xFE, 0x2F, 0x8A, 0xEC, 0x6E, 0x21, 0x9D,
-    0xE6, 0x8A, 0x43, 0x50, 0xB2, 0xD1, 0x7A, 0x80, 0x5C, 0x1B, 0x04, 0xC4, 0x95, 0xF1, 0xDA, 0x53,
-    0x04, 0xA1, 0xF6, 0x3E, 0x7E, 0x8D, 0x25, 0x4E, 0x83, 0x72, 0x1B, 0xCF, 0x5E, 0xC2, 0x3B, 0x4B,
-    0x6C, 0x35, 0xE4, 0xEC, 0xB7, 0x15, 0x39, 0x43, 0x22, 0xBF, 0xE0, 0x2C, 0x51, 0xCE, 0x0A, 0x72,
-    0xE6, 0xFC, 0x81, 0x9C, 0x79, 0x1F, 0x92, 0xB3, 0x50, 0x39, 0x5B, 0x53, 0xCE, 0xAE, 0x2A, 0x67,
-    0x0D, 0x39, 0x73, 0x2B, 0xF2, 0xE4, 0xE7, 0x84, 0xA1, 0x72, 0x36, 0x51, 0xCE, 0xEE, 0x91, 0xB3,
-    0xD7, 0x6A, 0x72, 0xF6, 0x7A, 0x49, 0xCE, 0xDE, 0x56, 0xCE, 0xFE, 0xA4, 0x9C, 0x75, 0xCA, 0x59,
-    0x47, 0x6C, 0x9E, 0x72, 0xE6, 0xDF, 0x25, 0x67, 0xA1, 0x72, 0x36, 0x6F, 0xDC, 0x98, 0x5E, 0x4B,
-    0xF2, 0x59, 0xBD, 0x96, 0x37, 0x8F, 0xEA, 0x28, 0x1B, 0x1B, 0x77, 0x1C, 0x6E, 0x8D, 0xEF, 0xBA,
-    0x45, 0x47, 0x6D, 0x44, 0x29, 0xE3, 0xC3, 0x45, 0x8D, 0x33, 0x6B, 0xB6, 0x67, 0x14, 0x18, 0x58,
-    0x13, 0x32, 0xC0, 0xDD, 0xD1, 0x71, 0xEF, 0x69, 0x84, 0x69, 0x54, 0x68, 0x0D, 0xF1, 0x39, 0x5A,
-    0xA1, 0xA1, 0xA0, 0x4D, 0xB8, 0xB8, 0x41, 0x61, 0xA0, 0x32, 0x98, 0xCE, 0x21, 0xBC, 0xFD, 0xA0,
-    0xA5, 0xCE, 0x54, 0x1B, 0x80, 0x99, 0xF6, 0xFF, 0x12, 0xB6, 0x95, 0x25, 0x9C, 0xDD, 0xAD, 0xB5,
-    0x38, 0x4B, 0x0F, 0x4B, 0x7D, 0x59, 0xD1, 0x72, 0x20, 0x54, 0xD2, 0xE3, 0xF4, 0xB0, 0x1A, 0x68,
-    0x4E, 0x72, 0xBB, 0xA7, 0x96, 0x8B, 0xA5, 0xBE, 0x8B, 0x67, 0xFA, 0x2E, 0x3F, 0xA5, 0x4A, 0xAE,
-    0x9D, 0xD8, 0x77, 0x39, 0xAD, 0x5C, 0xDC, 0xD1, 0x32, 0x78, 0x20, 0x52, 0x0B, 0xF7, 0xFD, 0xF2,
-    0x84, 0xF9, 0x7E, 0x6A, 0xB5, 0xF0, 0xC2, 0xEE, 0x61, 0x8E, 0x9E, 0x1D, 0xC6, 0x73, 0xD3, 0x69,
-    0xF1, 0x8F, 0xAE, 0xC6, 0x48, 0x32, 0xD6, 0xD1, 0x58, 0xC7, 0xB3, 0xDD, 0x97, 0xC6, 0x5D, 0x4C,
-    0x6E, 0x60, 0x22, 0x17, 0xAD, 0x16, 0x06, 0xB5, 0xFE, 0xAB, 0xB9, 0x52, 0xA8, 0x19, 0xDD, 0x9A,
-    0xE6, 0xFB, 0x77, 0x74, 0xC2, 0xD1, 0x32, 0xA3, 0x0F, 0x75, 0x7D, 0xF7, 0x27, 0xAA, 0xEA, 0x7F,
-    0xD7, 0xE1, 0x4D, 0x3D, 0xB8, 0x5C, 0x43, 0x2C, 0x95, 0xDE, 0xC6, 0xBE, 0x4D, 0x0D, 0x11, 0x1D,
-    0x96, 0xE1, 0x2B, 0xE3, 0x23, 0x53, 0xA8, 0xCC, 0x73, 0x50, 0xA6, 0x88, 0x7F, 0x9C, 0x2F, 0xB7,
-    0x5A, 0xF2, 0x9D, 0xD9, 0x7B, 0xA6, 0xA7, 0xA1, 0x2E, 0xD3, 0x57, 0x57, 0xCA, 0xC4, 0x0F, 0x58,
-    0x32, 0x85, 0x90, 0x20, 0x04, 0x0D, 0x69, 0x86, 0xDA, 0x09, 0x08, 0xB5, 0xDF, 0x00, 0x2C, 0x99,
-    0xCA, 0x82, 0xB9, 0x61, 0x6E, 0x72, 0xC2, 0x88, 0x0B, 0x63, 0x74, 0x66, 0x50, 0xE1, 0xC3, 0x45,
-    0xB9, 0x6E, 0x1A, 0x9F, 0x33, 0xE3, 0xC9, 0x77, 0x75, 0xB1, 0xAC, 0x3D, 0xD2, 0xEF, 0x0E, 0xCC,
-    0xC2, 0x53, 0x92, 0xAB, 0x4C, 0xB5, 0x05, 0xC0, 0x82, 0x9F, 0x0A, 0x05, 0xBF, 0x4B, 0x17, 0xBF,
-    0xE6, 0x05, 0xB9, 0x5E, 0x00, 0x1C, 0xCE, 0xDD, 0x32, 0xDB, 0xA3, 0x1F, 0x7F, 0xA0, 0x99, 0x65,
-    0xF4, 0x81, 0x8A, 0x23, 0x7E, 0x4B, 0x2F, 0x89, 0xE9, 0xB5, 0x24, 0x26, 0x53, 0x49, 0x44, 0xD5,
-    0xB8, 0x63, 0x5A, 0x04, 0x53, 0xD3, 0x3D, 0x1A, 0x90, 0xCA, 0x19, 0x11, 0x4C, 0x4D, 0x3E, 0x9E,
-    0x10, 0xEB, 0x44, 0x2D, 0x05, 0x8E, 0xFB, 0x1A, 0xB1, 0x1E, 0x70, 0x95, 0xC5, 0x6B, 0x92, 0x77,
-    0x3A, 0x0A, 0x22, 0x64, 0xAA, 0x07, 0x49, 0x5C, 0x5F, 0x08, 0xDC, 0x3A, 0x46, 0xBB, 0xD2, 0x64,
-    0x6B, 0x35, 0xD1, 0xDE, 0x9F, 0xBC, 0x6A, 0x12, 0xDE, 0xCC, 0xBA, 0x7C, 0xAD, 0x8A, 0xCD, 0x22,
-    0xB2, 0x92, 0x76, 0x5F, 0xE6, 0x6B, 0xF7, 0x47, 0x0B, 0x62, 0x77, 0xFC, 0x39, 0xC2, 0xC0, 0xC7,
-    0x60, 0x70, 0x3A, 0x5F, 0x28, 0x53, 0x45, 0x00, 0xE1, 0x94, 0x42, 0x1F, 0x98, 0x82, 0x73, 0x0D,
-    0x0D, 0x20, 0x23, 0xDD, 0x19, 0xED, 0xAA, 0xA0, 0xCE, 0x0A, 0x9A, 0x44, 0x26, 0xE7, 0x09, 0xBE,
-    0x02, 0xB5, 0x7D, 0xFB, 0x77, 0xCD, 0x6A, 0x3C, 0xBE, 0x35, 0x36, 0xC1, 0xE0, 0x42, 0x00, 0x1B,
-    0xB2, 0xBA, 0xF0, 0xEB, 0xD3, 0x79, 0x4F, 0x45, 0x9B, 0x56, 0x9A, 0xA2, 0x7E, 0xFE, 0xB9, 0x92,
-    0xA1, 0x29, 0x98, 0x16, 0x29, 0x88, 0x74, 0x10, 0x09, 0x6B, 0x20, 0xD4, 0x6B, 0xF2, 0x22, 0xDB,
-    0x56, 0xCF, 0x8F, 0x8C, 0x8D, 0x79, 0x0A, 0x85, 0x0C, 0x2A, 0x35, 0x09, 0xD4, 0xB1, 0xFC, 0xE9,
-    0x19, 0x53, 0x10, 0x70, 0xD2, 0x47, 0xE5, 0x40, 0x40, 0xB7, 0x93, 0xEE, 0x3F, 0xE5, 0x0E, 0x9F,
-    0xB9, 0x45, 0xA8, 0x99, 0xC2, 0x9E, 0x9D, 0x4F, 0x5B, 0xDD, 0x47, 0xB0, 0x0C, 0xF4, 0x3B, 0xFD,
-    0xF5, 0x39, 0x13, 0x24, 0xFE, 0x58, 0x51, 0x1D, 0xC9, 0x3B, 0x4F, 0x86, 0x8C, 0x63, 0x26, 0x4D,
-    0x58, 0x61, 0x98, 0xA8, 0x0C, 0xAB, 0x80, 0x3E, 0x29, 0xAC, 0x34, 0x07, 0x8C, 0x4A, 0xF5, 0x41,
-    0x49, 0x0E, 0xCF, 0x34, 0x70, 0x11, 0x35, 0x75, 0x86, 0x9B, 0x2D, 0x7E, 0x50, 0xDF, 0x0D, 0xCC,
-    0x4F, 0x74, 0x79, 0x49, 0x1B, 0x31, 0x05, 0xB3, 0x2C, 0xBA, 0x6E, 0x75, 0x00, 0x89, 0x5C, 0xE8,
-    0xE5, 0x9F, 0xE0, 0x28, 0x6F, 0x8F, 0x08, 0x22, 0xF0, 0xD5, 0x09, 0x6A, 0x54, 0x7F, 0x4C, 0x03,
-    0x4E, 0x73, 0xD0, 0xF1, 0xCF, 0x96, 0x90, 0x15, 0x38, 0xC6, 0xF8, 0x07, 0x1D, 0x46, 0xEF, 0xC1,
-    0x41, 0x0F, 0xE4, 0x5D, 0x68, 0x93, 0xBC, 0xC4, 0x96, 0xE6, 0xF3, 0xB2, 0x7C, 0x7E, 0x66, 0xEA,
-    0xCE, 0x9C, 0x3C, 0xAE, 0x02, 0x2E, 0x59, 0xC3, 0x65, 0x75, 0xDA, 0xBA, 0xD1, 0x3A, 0x29, 0x32,
-    0x9E, 0x4C, 0xA7, 0x5E, 0x80, 0x4C, 0x96, 0x2D, 0xE8, 0x27, 0x36, 0x53, 0x61, 0x88, 0xD3, 0x79,
-    0xB9, 0x25, 0xA6, 0x7F, 0x12, 0x1C, 0x8A, 0x7D, 0x05, 0x74, 0xC5, 0x3F, 0x68, 0xA4, 0xF7, 0x3A,
-    0xAF, 0x75, 0x41, 0x87, 0x0B, 0x3A, 0xBC, 0x36, 0x2E, 0x91, 0xF5, 0xE5, 0x71, 0x99, 0xBC, 0x33,
-    0x83, 0xDB, 0xAD, 0xA5, 0xD8, 0xF8, 0x3B, 0x74, 0x98, 0x0D, 0x53, 0xDF, 0x34, 0xBE, 0xD6, 0xB6,
-    0x8C, 0xB4, 0x96, 0xD6, 0x06, 0xE3, 0xCB, 0x47, 0x6C, 0x8F, 0x38, 0x15, 0x29, 0xB1, 0x0A, 0xD1,
-    0x0A, 0xF1, 0xB2, 0x31, 0xCE, 0xC4, 0x98, 0x8A, 0xC8, 0x99, 0xB3, 0x02, 0xB7, 0x22, 0x57, 0xEC,
-    0xC6, 0xEF, 0x17, 0x8B, 0x28, 0x49, 0x0A, 0x84, 0x24, 0x08, 0x69, 0x30, 0x44, 0x58, 0x2A, 0x5E,
-    0xCA, 0x4D, 0xA4, 0xE2, 0x42, 0xE3, 0x5F, 0xE1, 0xE4, 0x51, 0x81, 0xAD, 0xB1, 0x5F, 0xFD, 0x0C,
-    0x58, 0xE6, 0x4C, 0xE3, 0x44, 0xE3, 0x79, 0x7C, 0x9A, 0xFD, 0x03, 0xF1, 0xBC, 0x94, 0x46, 0x65,
-    0xC0, 0x65, 0x83, 0xD6, 0x88, 0xB2, 0x68, 0x6E, 0x35, 0x41, 0x13, 0x70, 0xE7, 0x55, 0x19, 0x96,
-    0xB0, 0xD6, 0x3C, 0x49, 0xB9, 0xD0, 0x9F, 0x21, 0x1C, 0x4D, 0x65, 0x7A, 0x26, 0x1B, 0xE2, 0xDA,
-    0xD1, 0xE6, 0x1D, 0x84, 0x19, 0xE9, 0xC6, 0xA5, 0x56, 0x9C, 0x79, 0x5A, 0x04, 0xE7, 0x78, 0xAB,
-    0xE1, 0x2F, 0x08, 0x3B, 0xC7, 0x77, 0xB1, 0xCD, 0xB7, 0x03, 0x64, 0xDA, 0x50, 0x80, 0x47, 0x9F,
-    0x9E, 0x61, 0x27, 0x1C, 0x4E, 0xD5, 0x31, 0x19, 0xE3, 0x88, 0x5C, 0x31, 0x0F, 0x7F, 0x52, 0x5E,
-    0x73, 0xEB, 0x7B, 0x5C, 0x05, 0xD7, 0xF8, 0xD8, 0xCB, 0xF9, 0x5E, 0x73, 0x90, 0x8E, 0x81, 0x08,
-    0x74, 0xE2, 0xE3, 0xEB, 0xF8, 0xE1, 0xD2, 0xF8, 0xDC, 0x6E, 0x80, 0xCF, 0xB7, 0x31, 0x2D, 0x52,
-    0xAE, 0xB8, 0xA4, 0x27, 0xEF, 0x6C, 0xFA, 0x3F, 0x8F, 0x66, 0x97, 0x1A, 0x76, 0x91, 0x34, 0xF9,
-    0x5D, 0x32, 0x6F, 0x14, 0xB3, 0x22, 0x77, 0xFF, 0x8B, 0x6D, 0xB0, 0xB4, 0x63, 0x21, 0x72, 0x60,
-    0x9B, 0x25, 0xEE, 0x2C, 0xD3, 0x2C, 0x86, 0xEB, 0x0F, 0x63, 0x0A, 0xCB, 0xCB, 0x72, 0x4D, 0x48,
-    0x98, 0x89, 0xA8, 0xF9, 0x71, 0x87, 0x4A, 0x92, 0x66, 0x62, 0x40, 0x46, 0x05, 0x15, 0x04, 0x83,
-    0xF1, 0x3F, 0xBA, 0xD7, 0x24, 0xCE, 0x91, 0x2A, 0x85, 0x8F, 0x8B, 0x14, 0x9E, 0xE1, 0xD0, 0x00,
-    0x19, 0xCB, 0xFD, 0x99, 0x03, 0x62, 0x8B, 0x5F, 0x96, 0x72, 0x99, 0x7B, 0x25, 0x56, 0x9D, 0x65,
-    0xE3, 0x48, 0xFA, 0xA0, 0x97, 0x57, 0xFB, 0x64, 0x04, 0x9B, 0xA8, 0xAE, 0xDC, 0x4F, 0x81, 0x8B,
-    0x9B, 0x16, 0x52, 0x4F, 0xC7, 0xB5, 0xCE, 0x6F, 0x87, 0x2C, 0xB3, 0xF5, 0x07, 0x94, 0xBA, 0xDB,
-    0xC5, 0x6C, 0x5F, 0xC9, 0x31, 0x97, 0x91, 0x1C, 0x75, 0x73, 0x37, 0xE9, 0x76, 0xAB, 0x09, 0x2C,
-    0xA5, 0x01, 0x4F, 0xBA, 0x88, 0x73, 0xC6, 0x2E, 0x57, 0x98, 0x06, 0x71, 0xBF, 0xA8, 0x4E, 0xA2,
-    0xA7, 0x57, 0x2A, 0x74, 0x13, 0x61, 0xF2, 0x49, 0x4F, 0xA6, 0xA6, 0x66, 0xEF, 0x0C, 0x65, 0x90,
-    0x2E, 0xC9, 0x20, 0xB7, 0x82, 0xC8, 0x55, 0x10, 0xC5, 0x49, 0x82, 0x48, 0x3D, 0x26, 0xC7, 0xD4,
-    0xCD, 0x71, 0x41, 0x98, 0xBC, 0x40, 0x57, 0xB7, 0x3A, 0xBB, 0x71, 0xC2, 0xE4, 0x05, 0x2F, 0x3F,
-    0x57, 0x32, 0x34, 0x2F, 0xD0, 0xCE, 0x8C, 0xE6, 0x05, 0x8F, 0x5B, 0xD1, 0x3E, 0xEE, 0xF1, 0xAE,
-    0xCC, 0xB3, 0x26, 0x63, 0xC3, 0x98, 0x05, 0x4C, 0x77, 0xFC, 0x65, 0x2E, 0x57, 0x8D, 0x59, 0x74,
-    0xCF, 0x91, 0x02, 0x5D, 0x85, 0xD0, 0xE5, 0x87, 0x90, 0xC9, 0x41, 0x90, 0xDF, 0x79, 0x2A, 0x2F,
-    0x78, 0xE6, 0x16, 0x61, 0x9A, 0x7B, 0x0C, 0x57, 0x3C, 0x57, 0x8E, 0x62, 0x5F, 0xDA, 0xCB, 0x77,
-    0x78, 0x9C, 0xB5, 0x29, 0x31, 0x9F, 0x0F, 0x0F, 0x6B, 0xEB, 0x4B, 0xA2, 0xAD, 0x52, 0x67, 0x7C,
-    0x02, 0x34, 0x9F, 0x8E, 0xF4, 0x5D, 0x31, 0x4B, 0xAF, 0x84, 0xDB, 0xBB, 0x0A, 0x38, 0x4B, 0xE7,
-    0xD7, 0x75, 0xD0, 0xF8, 0x6F, 0xD7, 0x61, 0x1D, 0xE2, 0x53, 0x4D, 0xC2, 0x3A, 0x2A, 0xEF, 0x85,
-    0x55, 0xFC, 0xA0, 0x82, 0xC3, 0xFC, 0x08, 0xCC, 0xC4, 0x3F, 0x65, 0x79, 0xC1, 0x4C, 0x22, 0x44,
-    0x08, 0x86, 0x43, 0x04, 0xBB, 0xFE, 0x70, 0x8B, 0xD3, 0x96, 0xCB, 0x21, 0x6C, 0x2A, 0x7F, 0xE3,
-    0x58, 0x9A, 0x6D, 0xD4, 0xA5, 0x69, 0xF6, 0xDA, 0x53, 0x69, 0x76, 0x82, 0x69, 0x5A, 0xBD, 0xCA,
-    0x69, 0xEA, 0xDA, 0x5D, 0x66, 0x98, 0xA6, 0xF0, 0x11, 0x94, 0x86, 0x6E, 0x4A, 0xB3, 0x29, 0xCD,
-    0x53, 0xB3, 0x9A, 0x8F, 0xE7, 0x3E, 0x37, 0xB2, 0xBD, 0xC8, 0x77, 0xBE, 0xCC, 0x26, 0xCA, 0x6F,
-    0xFB, 0xD5, 0x68, 0x7C, 0x80, 0x1C, 0x66, 0xC6, 0xED, 0x71, 0x1B, 0xA6, 0x83, 0xF2, 0x4A, 0x6A,
-    0x03, 0x85, 0x2E, 0xE4, 0x79, 0xCD, 0xBC, 0xD5, 0x7B, 0xE1, 0xB9, 0x92, 0xA1, 0xE2, 0xD0, 0xA5,
-    0xB8, 0x44, 0x57, 0x86, 0x58, 0xDC, 0xD5, 0xEB, 0xC7, 0x97, 0xE1, 0x9E, 0x35, 0x19, 0x6E, 0x75,
-    0x51, 0xCB, 0x28, 0x38, 0x7B, 0x02, 0xB7, 0xBA, 0x72, 0xDC, 0x96, 0x9F, 0xBD, 0x3E, 0xE6, 0xCB,
-    0x92, 0x4B, 0x9B, 0x6E, 0x96, 0x8A, 0x77, 0xEF, 0x58, 0xF1, 0x1E, 0x70, 0xFB, 0x23, 0xF7, 0x6D,
-    0x86, 0xED, 0x3C, 0x6D, 0xCC, 0xD4, 0xA2, 0x90, 0x5E, 0xB2, 0xC9, 0x97, 0x3B, 0xBA, 0xAB, 0xD9,
-    0x35, 0x7B, 0x04, 0xB8, 0x60, 0x53, 0xB3, 0x9C, 0xF7, 0x1B, 0xEA, 0xD8, 0x6B, 0x74, 0xE9, 0xA1,
-    0xBD, 0xA2, 0xCE, 0x74, 0xA2, 0x36, 0xA0, 0x7B, 0x98, 0x75, 0xE9, 0xC0, 0x78, 0xFE, 0xF9, 0x72,
-    0xB8, 0x62, 0x33, 0x6B, 0x45, 0x66, 0x63, 0x46, 0x7D, 0x58, 0x56, 0x66, 0x8B, 0xBA, 0x3F, 0xD1,
-    0x0E, 0x68, 0x6C, 0xF6, 0x8A, 0x6E, 0xD2, 0x39, 0xE9, 0x82, 0x97, 0x2A, 0x56, 0x8D, 0x5D, 0xBB,
-    0x29, 0x5A, 0x93, 0x1E, 0xEE, 0x22, 0x8F, 0xBE, 0x83, 0x80, 0x19, 0xBF, 0x8D, 0xD4, 0x26, 0xD9,
-    0x0A, 0x21, 0xC1, 0xF7, 0x59, 0xCA, 0x97, 0x60, 0x2B, 0x4B, 0x35, 0x13, 0x07, 0xD0, 0xDD, 0xE8,
-    0x3D, 0x86, 0x70, 0x16, 0x79, 0x9D, 0xAB, 0xFB, 0xBC, 0xE1, 0x13, 0xF2, 0xB9, 0xD4, 0x07, 0x8C,
-    0xCE, 0x9F, 0x9E, 0x44, 0x98, 0x6E, 0x5C, 0x99, 0x0F, 0x1F, 0xA4, 0xB6, 0xE4, 0xD5, 0x85, 0x4A,
-    0x5D, 0xA7, 0x4C, 0x16, 0x04, 0x67, 0xBF, 0x10, 0xB3, 0x11, 0x9E, 0x7C, 0xD7, 0x5C, 0x94, 0x61,
-    0x22, 0xA5, 0x90, 0x75, 0x7D, 0x1D, 0x9E, 0xD4, 0xE2, 0x3D, 0xC5, 0xF2, 0xFE, 0x1F, 0xDD, 0x5C,
-    0x3F, 0x90, 0xDC, 0xD6, 0x79, 0x7F, 0x00, 0xC8, 0x83, 0x4C, 0x8C, 0x08, 0x16, 0x92, 0xE3, 0x21,
-    0x43, 0x41, 0x45, 0x0A, 0xC5, 0x22, 0x89, 0xC6, 0x93, 0xB0, 0xB8, 0x23, 0x10, 0xA7, 0x70, 0x91,
-    0x86, 0x05, 0x6F, 0x32, 0x19, 0x4D, 0x46, 0x2E, 0x93, 0x49, 0x62, 0xBA, 0x60, 0xC1, 0x82, 0x26,
-    0xA0, 0x49, 0xE9, 0x19, 0xE7, 0x8A, 0x24, 0x45, 0xDC, 0xB0, 0x70, 0x21, 0x53, 0x05, 0x55, 0x68,
-    0x32, 0xCC, 0x0C, 0xB9, 0x80, 0xA4, 0x42, 0x85, 0x8B, 0x6C, 0xAC, 0x51, 0x1A, 0x15, 0x42, 0x6C,
-    0x6A, 0xE2, 0xA1, 0x66, 0x22, 0x78, 0xB2, 0x1C, 0x2F, 0x29, 0x60, 0x91, 0xEF, 0xF7, 0xFB, 0x1E,
-    0x76, 0xB1, 0xBB, 0x47, 0x9A, 0x94, 0x79, 0xD4, 0x5D, 0x96, 0xE4, 0xDB, 0xE3, 0x2E, 0xF0, 0xDE,
-    0xF7, 0xFD, 0xDE, 0xF7, 0xBE, 0xFF, 0x38, 0x63, 0xEC, 0x2B, 0xEB, 0x26, 0x1C, 0x6B, 0xB3, 0xFC,
-    0x72, 0xF0, 0xB1, 0xF1, 0xA6, 0x18, 0x03, 0x8E, 0x61, 0x83, 0x71, 0x8B, 0xE3, 0x65, 0x8E, 0x75,
-    0x2B, 0x83, 0x5B, 0x61, 0xF4, 0xCA, 0x11, 0x2E, 0x4C, 0x0B, 0x19, 0x23, 0x93, 0xE1, 0x42, 0x93,
-    0xE0, 0x42, 0x8E, 0xB5, 0x49, 0x52, 0xE3, 0x3E, 0xB8, 0x5E, 0xE4, 0xC6, 0xEB, 0xBA, 0x2E, 0x37,
-    0x61, 0x6A, 0xE2, 0x52, 0x2E, 0x34, 0x51, 0x69, 0x36, 0x65, 0xEA, 0xD2, 0xDC, 0x94, 0x71, 0x2C,
-    0x17, 0xCA, 0xE8, 0x61, 0xAC, 0x5E, 0xBF, 0x6F, 0x9C, 0xE2, 0x7E, 0xD7, 0xA5, 0x7E, 0x37, 0x53,
-    0x92, 0x82, 0xAE, 0xC3, 0x30, 0x1B, 0x92, 0xE9, 0x76, 0x3F, 0xCF, 0x4D, 0xFC, 0x91, 0x4C, 0x39,
-    0x92, 0x35, 0xDC, 0xA9, 0x2C, 0xE7, 0xD7, 0xB2, 0xBE, 0xCC, 0x35, 0xC2, 0xE4, 0xAD, 0x89, 0x73,
-    0xD3, 0x60, 0xF9, 0x46, 0x3E, 0x75, 0x30, 0x08, 0x4F, 0x85, 0xF1, 0x26, 0x32, 0x04, 0xB8, 0xF2,
-    0x04, 0x86, 0x3F, 0x16, 0x0A, 0xDF, 0xF8, 0x65, 0x7D, 0x2C, 0xEE, 0xFE, 0xBE, 0xAB, 0x83, 0xD6,
-    0xED, 0x52, 0x73, 0xDE, 0x1C, 0xC3, 0x02, 0x7F, 0x60, 0xBE, 0x25, 0xE3, 0x26, 0x28, 0x33, 0xD1,
-    0x5B, 0x15, 0x70, 0x90, 0xC5, 0x04, 0x9F, 0x7F, 0x33, 0xFB, 0x1A, 0x31, 0xDF, 0x1C, 0x31, 0xC6,
-    0x4F, 0x5F, 0x92, 0x85, 0xEE, 0xCA, 0xD2, 0x0E, 0x37, 0xF8, 0x7B, 0xE9, 0x33, 0xC5, 0x6E, 0xDF,
-    0xC9, 0xD0, 0xC6, 0x18, 0xE3, 0x39, 0x72, 0xCF, 0xD5, 0x9D, 0xE9, 0x60, 0x6C, 0xF9, 0x39, 0xCF,
-    0x83, 0x89, 0xAB, 0x3D, 0xC7, 0xC8, 0xC5, 0x12, 0x11, 0x76, 0xE4, 0x07, 0x58, 0xE9, 0xD6, 0x9C,
-    0x28, 0x92, 0x9A, 0xE1, 0xC7, 0x88, 0xB4, 0x98, 0xE3, 0xDC, 0xB6, 0x6C, 0x41, 0xB6, 0xC7, 0xD3,
-    0x1A, 0x40, 0x0E, 0xCD, 0xF3, 0xAB, 0x72, 0x18, 0x90, 0x83, 0xE2, 0x33, 0x99, 0xC6, 0x17, 0x52,
-    0x52, 0x13, 0x8D, 0x4D, 0x92, 0x9B, 0x2C, 0x05, 0x95, 0xF2, 0xE1, 0x19, 0xE3, 0x71, 0x12, 0x9F,
-    0x93, 0x87, 0x9C, 0x2A, 0x24, 0xBB, 0x02, 0xA7, 0xBC, 0x12, 0x1D, 0xF3, 0xC1, 0xA8, 0xEB, 0xA7,
-    0x8B, 0x9F, 0xED, 0x98, 0xF7, 0x77, 0xE5, 0x98, 0xC7, 0x2B, 0x8D, 0xDF, 0x9A, 0x28, 0x17, 0x61,
-    0x23, 0xDC, 0xB1, 0x42, 0x79, 0x41, 0xC9, 0xFA, 0x26, 0x86, 0x51, 0x8F, 0xB6, 0xC7, 0x93, 0x84,
-    0x59, 0xBE, 0xB1, 0x44, 0xFC, 0x46, 0x27, 0x5F, 0xC4, 0x3F, 0x96, 0x4B, 0x5A, 0x01, 0x53, 0x50,
-    0x6C, 0x80, 0xE2, 0x14, 0x78, 0x5B, 0xFA, 0xB8, 0x28, 0xD7, 0x27, 0x20, 0xC5, 0xF2, 0x90, 0x29,
-    0x5D, 0x8E, 0x6C, 0xDA, 0x38, 0x48, 0x55, 0x65, 0x38, 0x1D, 0x56, 0x3C, 0x6C, 0x17, 0xD8, 0xC1,
-    0x18, 0x91, 0xEB, 0xAC, 0x26, 0x39, 0xF8, 0xD6, 0x1F, 0x8B, 0x08, 0x99, 0xA3, 0x38, 0x34, 0x07,
-    0x00, 0x4C, 0x30, 0x01, 0x16, 0x32, 0xF9, 0x6C, 0x2A, 0x30, 0x8D, 0xB7, 0x84, 0xF0, 0x23, 0x4B,
-    0x20, 0x02, 0x43, 0x81, 0x10, 0x08, 0x02, 0x40, 0xE0, 0x87, 0xB9, 0xB1, 0x0A, 0xD6, 0xCB, 0x2C,
-    0x60, 0xFD, 0xBF, 0xCC, 0xC2, 0x06, 0xD4, 0x00, 0x1A, 0x31, 0x53, 0xC8, 0x1C, 0x92, 0x17, 0x54,
-    0xAB, 0x0C, 0xFA, 0xB9, 0xD9, 0xED, 0xB5, 0x3F, 0x11, 0x73, 0x0C, 0x35, 0x04, 0x88, 0xC1, 0xB1,
-    0x15, 0x2D, 0xB3, 0x26, 0x76, 0x4F, 0x0F, 0xB1, 0x17, 0x28, 0xD4, 0x67, 0x0C, 0xD6, 0x0F, 0xBF,
-    0x33, 0x26, 0x28, 0x58, 0xCF, 0xE3, 0xC9, 0x76, 0xA7, 0x07, 0x02, 0xB1, 0x97, 0xC5, 0xF4, 0x99,
-    0x4D, 0x47, 0x56, 0x8B, 0x00, 0x5C, 0xD8, 0x81, 0x52, 0xD0, 0xE1, 0x4D, 0x9E, 0xE9, 0x81, 0x7D,
-    0x41, 0xFE, 0xC8, 0xEB, 0xB4, 0x51, 0xEE, 0xFF, 0x6C, 0x6C, 0xE6, 0x78, 0x5A, 0x40, 0xD7, 0x11,
-    0x05, 0x2B, 0xDD, 0x4F, 0xE4, 0xED, 0x55, 0xB1, 0x14, 0xB8, 0xB2, 0x55, 0x85, 0xDE, 0x10, 0x43,
-    0xA1, 0x53, 0xFE, 0x1A, 0xB7, 0xA1, 0xAA, 0x85, 0x79, 0x2A, 0x94, 0x2B, 0x79, 0x13, 0xE5, 0x3E,
-    0x78, 0x83, 0xD0, 0x17, 0x34, 0x2A, 0xFD, 0x5B, 0xA7, 0xE2, 0x33, 0x23, 0x6F, 0xB0, 0x18, 0xA2,
-    0xFE, 0x31, 0x91, 0xF0, 0x87, 0x89, 0xC4, 0x50, 0x05, 0x35, 0x99, 0x8A, 0xF4, 0xD6, 0x84, 0x17,
-    0x3B, 0x1D, 0xCD, 0xCB, 0x09, 0xB9, 0xE2, 0x44, 0xF7, 0x56, 0x87, 0xE9, 0xBA, 0xCE, 0x12, 0xBD,
-    0x7D, 0x1E, 0xFC, 0x75, 0xF5, 0x6D, 0xAA, 0x25, 0xEA, 0xA2, 0x5F, 0x63, 0x8B, 0x83, 0x5F, 0x00,
-    0xBC, 0xE0, 0xC3, 0xD4, 0x4A, 0xAE, 0x8E, 0x6E, 0xF7, 0xB9, 0xC0, 0x49, 0x83, 0x44, 0x8B, 0x64,
-    0x68, 0x92, 0xD4, 0x26, 0xA9, 0x51, 0x52, 0xAB, 0xA4, 0x66, 0x49, 0xED, 0x92, 0x1A, 0x26, 0xB5,
-    0x4C, 0x6A, 0x9A, 0xD4, 0x36, 0xA9, 0x71, 0x52, 0xEB, 0xA4, 0xE6, 0xC9, 0xD0, 0x3E, 0x99, 0x60,
-    0x06, 0x03, 0x65, 0xAD, 0xF8, 0x53, 0x41, 0xD2, 0x79, 0xED, 0xDE, 0x05, 0x2C, 0xDD, 0x75, 0x0D,
-    0xFE, 0xF7, 0xFA, 0xA7, 0x17, 0xF6, 0x04, 0x49, 0xDA, 0xEF, 0x7A, 0x71, 0x4A, 0xB0, 0xB8, 0x79,
-    0xF1, 0xB5, 0x4F, 0xE9, 0xE1, 0x92, 0x7C, 0x8A, 0xA5, 0xE2, 0xF9, 0x17, 0x22, 0xF8, 0x90, 0xB7,
-    0x14, 0x6B, 0xCA, 0xA9, 0x83, 0x19, 0x27, 0xF5, 0x19, 0x37, 0x7E, 0xC4, 0xCB, 0xD6, 0x90, 0x74,
-    0x07, 0x48, 0xFA, 0xE4, 0x34, 0x24, 0x87, 0x43, 0x24, 0x3F, 0x5C, 0x20, 0xD9, 0x0E, 0x90, 0xB4,
-    0xAF, 0x90, 0x67, 0x2D, 0xEC, 0xDA, 0x35, 0x89, 0x95, 0x1B, 0x5E, 0xE5, 0x28, 0x1C, 0xC2, 0x40,
-    0x36, 0xE2, 0x18, 0x01, 0x60, 0x77, 0x8C, 0x65, 0xDD, 0xD2, 0xBA, 0x52, 0x7A, 0x00, 0xFD, 0x05,
-    0x87, 0x26, 0xB8, 0xB7, 0x9D, 0x62, 0x4A, 0x9C, 0xC5, 0xF0, 0x53, 0xFC, 0x1C, 0x95, 0x0B, 0xFD,
-    0x10, 0x0F, 0x74, 0x42, 0x62, 0xEC, 0xA1, 0x7B, 0x9E, 0xA0, 0x9E, 0xE6, 0x06, 0x6C, 0x62, 0x5B,
-    0x65, 0xB5, 0x13, 0xB3, 0xEB, 0x37, 0xA6, 0x00, 0xB4, 0x9B, 0x2C, 0x48, 0x1D, 0x12, 0xBA, 0x21,
-    0x80, 0xC7, 0x3F, 0xAE, 0x4D, 0xE3, 0x4D, 0xBD, 0x89, 0x2B, 0x6A, 0xD2, 0x15, 0x35, 0xE9, 0x4D,
-    0xE2, 0x32, 0xA8, 0x93, 0x3C, 0x2E, 0x93, 0x7F, 0x9E, 0x09, 0xCE, 0x95, 0x29, 0xCE, 0x3F, 0x8E,
-    0x9A, 0x54, 0x8B, 0x15, 0xA4, 0xA7, 0xC1, 0xC6, 0xDD, 0x29, 0x9D, 0x2D, 0x72, 0xB3, 0xEC, 0xA5,
-    0xEE, 0x3F, 0x64, 0x8E, 0xC8, 0x25, 0xA1, 0x39, 0x45, 0xA2, 0x3D, 0x4C, 0x3C, 0x20, 0xF8, 0xA9,
-    0x22, 0x64, 0x0E, 0x29, 0xFF, 0xE9, 0xAA, 0x7E, 0x7F, 0xC9, 0xEC, 0x73, 0xD9, 0x39, 0x6C, 0x6F,
-    0x4D, 0xAC, 0x01, 0x5D, 0x21, 0xF8, 0x69, 0xA2, 0xB4, 0xFF, 0xCE, 0xCD, 0xDF, 0xD1, 0x26, 0xE9,
-    0x02, 0xAA, 0xB8, 0x39, 0x51, 0xA4, 0xA3, 0x2A, 0x20, 0x2A, 0x23, 0x77, 0xF6, 0x94, 0xF1, 0x48,
-    0x6C, 0x1C, 0x31, 0xB5, 0x5E, 0x76, 0x6B, 0xE3, 0x19, 0x8D, 0x66, 0xCE, 0x9B, 0xEF, 0xCA, 0x78,
-    0x85, 0x71, 0xC7, 0x19, 0x52, 0x13, 0xCD, 0x16, 0x41, 0x99, 0x5F, 0xEF, 0x73, 0x99, 0x1A, 0x38,
-    0x24, 0x41, 0xEF, 0x90, 0xF8, 0xED, 0x2E, 0x0E, 0x09, 0x1C, 0x37, 0x01, 0x13, 0x68, 0x1A, 0xC0,
-    0x69, 0x80, 0x27, 0x62, 0xC2, 0x89, 0x01, 0xA2, 0x06, 0x90, 0x1A, 0x60, 0x4A, 0x50, 0x89, 0xEA,
-    0x1E, 0x46, 0x10, 0x1B, 0xD4, 0x9F, 0xC5, 0x67, 0x9D, 0x38, 0x5B, 0x62, 0x61, 0x6A, 0x48, 0x80,
-    0x98, 0x0C, 0x71, 0xCE, 0x84, 0x14, 0xB8, 0x7C, 0xF9, 0xBA, 0x77, 0xA7, 0x42, 0xB2, 0xAB, 0x77,
-    0x17, 0x77, 0xB5, 0x20, 0x77, 0xA2, 0xDB, 0x91, 0x09, 0x9C, 0x19, 0x50, 0x74, 0x18, 0x7E, 0x0A,
-    0x9B, 0xF2, 0xAD, 0xF0, 0x29, 0x77, 0x09, 0xA3, 0xF0, 0xEE, 0x6A, 0x2C, 0x28, 0x1B, 0xE2, 0x74,
-    0x77, 0x0B, 0xA0, 0xD6, 0xCD, 0x00, 0xF9, 0x8B, 0x4A, 0xD6, 0x5F, 0x6B, 0xB0, 0xCB, 0xFD, 0x63,
-    0x42, 0x23, 0xFC, 0x19, 0x16, 0x3A, 0x47, 0xE9, 0x78, 0xC7, 0xBC, 0x3D, 0x70, 0xFD, 0x43, 0xDE,
-    0x0C, 0x56, 0x47, 0xAF, 0x57, 0xB2, 0xF5, 0x13, 0x84, 0x9F, 0x7E, 0xC5, 0x10, 0xBB, 0x5C, 0x8C,
-    0x51, 0xEE, 0x57, 0x18, 0x03, 0xB8, 0xD8, 0x39, 0xE4, 0x2B, 0x1C, 0x67, 0x9C, 0x9E, 0xBA, 0xFD,
-    0x6E, 0xCA, 0xB0, 0xDE, 0x30, 0x9B, 0x82, 0xD7, 0x55, 0x15, 0x80, 0xEE, 0x0E, 0x3E, 0x07, 0xCA,
-    0x66, 0x54, 0x08, 0x25, 0x72, 0xBB, 0xB0, 0x10, 0xD3, 0xFA, 0x9E, 0x1B, 0x8C, 0x09, 0x83, 0xE5,
-    0x38, 0xA7, 0x61, 0x9E, 0xDD, 0x80, 0xF7, 0x51, 0x90, 0x21, 0x4D, 0x75, 0x68, 0xAE, 0x43, 0x93,
-    0x1D, 0x36, 0xDB, 0xB1, 0x66, 0x48, 0xF6, 0xE9, 0x5E, 0x7C, 0xC3, 0xBC, 0x22, 0xE3, 0x49, 0x41,
-    0x5D, 0xD6, 0x7C, 0x8B, 0xBE, 0x5F, 0x57, 0x0E, 0x52, 0x4C, 0x07, 0x63, 0x17, 0x18, 0x62, 0x19,
-    0xDC, 0x38, 0x0F, 0x4F, 0x1E, 0x19, 0x27, 0xEE, 0xD3, 0x73, 0x71, 0xC8, 0x2C, 0x72, 0x2D, 0xC5,
-    0x60, 0xFC, 0xC3, 0xA5, 0x54, 0xDF, 0xC1, 0xD8, 0x91, 0xFD, 0x8C, 0x33, 0x6D, 0xA4, 0xE6, 0x07,
-    0x55, 0x4A, 0xD4, 0x52, 0x9A, 0x45, 0x4A, 0xEB, 0x50, 0x7F, 0x19, 0x97, 0xF6, 0xF8, 0xBD, 0x86,
-    0xED, 0x8A, 0x96, 0xA6, 0xF1, 0x6E, 0x1D, 0xAC, 0x1D, 0x39, 0x6E, 0xDF, 0xB3, 0x52, 0xC9, 0xEE,
-    0x88, 0xB4, 0xF1, 0x7E, 0xA9, 0xD6, 0x37, 0x4C, 0xD5, 0x96, 0xBD, 0x42, 0x95, 0xB0, 0x1E, 0xD4,
-    0x36, 0x12, 0xA9, 0x97, 0x62, 0x94, 0xEF, 0xC8, 0x8C, 0x39, 0x6D, 0x25, 0x37, 0xAC, 0xD1, 0xC0,
-    0x06, 0xB1, 0x18, 0x83, 0xC4, 0xA9, 0x1A, 0x5C, 0x98, 0x67, 0x18, 0x5B, 0x18, 0x48, 0x6C, 0x20,
-    0x8C, 0x33, 0xCC, 0xAE, 0xAF, 0x81, 0x15, 0xCC, 0xF4, 0x76, 0x41, 0x6F, 0x44, 0xE3, 0x7F, 0x31,
-    0xD5, 0xDB, 0x10, 0x16, 0xDC, 0xDB, 0xAA, 0x00, 0x60, 0xCA, 0x3E, 0x32, 0xEB, 0x43, 0x33, 0x1B,
-    0x26, 0x71, 0x0E, 0x66, 0x22, 0x6D, 0x98, 0x07, 0x72, 0x10, 0xB3, 0x39, 0x33, 0x3D, 0xFA, 0x22,
-    0x24, 0x4E, 0x71, 0x1F, 0x11, 0x5A, 0xED, 0x6B, 0xF4, 0x65, 0xDE, 0x04, 0xAF, 0x98, 0x3A, 0xC4,
-    0x7A, 0x09, 0x40, 0xBE, 0x19, 0xE4, 0xC6, 0x19, 0x3B, 0xA5, 0x03, 0x37, 0xC1, 0xA7, 0xE2, 0xCB,
-    0xE6, 0x19, 0x83, 0x64, 0xEE, 0x23, 0x5C, 0xC5, 0x80, 0x18, 0xD9, 0xB4, 0xC8, 0x42, 0x34, 0x89,
-    0xB8, 0x3C, 0x8D, 0x88, 0xA2, 0xF3, 0x45, 0x9E, 0xA4, 0x6E, 0x27, 0x97, 0x7B, 0x88, 0xDF, 0x3C,
-    0x9B, 0xA1, 0xBD, 0xAA, 0x21, 0x9C, 0x6C, 0x51, 0x0B, 0x48, 0x1A, 0x19, 0x84, 0x95, 0x28, 0x17,
-    0xB7, 0x28, 0xCE, 0x11, 0x33, 0x6B, 0x2E, 0xD7, 0x9D, 0x1E, 0x4B, 0x60, 0x2D, 0x64, 0xF6, 0xA2,
-    0x54, 0x99, 0x7B, 0x5C, 0x90, 0xBF, 0xDE, 0x6E, 0x6F, 0x5F, 0xFC, 0x48, 0x4C, 0x28, 0x5F, 0xC6,
-    0xFC, 0xF9, 0xFD, 0xED, 0xED, 0xEC, 0x9F, 0xBE, 0x72, 0x90, 0x77, 0x83, 0xF1, 0x70, 0x26, 0x1F,
-    0x46, 0xF4, 0xC6, 0x46, 0x0B, 0x18, 0x1D, 0xF1, 0x7B, 0x9A, 0xA8, 0x95, 0xD5, 0x47, 0x9D, 0x71,
-    0xEF, 0x8F, 0x05, 0x8D, 0xDF, 0xA4, 0x09, 0xB6, 0x27, 0x31, 0xC4, 0x52, 0x61, 0xAC, 0xE5, 0x9E,
-    0xF0, 0xC9, 0x61, 0x34, 0xF0, 0xAA, 0x82, 0x99, 0x38, 0x89, 0x51, 0xF7, 0x71, 0x6E, 0xCE, 0x46,
-    0x02, 0xD1, 0x31, 0xF7, 0xCE, 0x8A, 0x38, 0x23, 0xAF, 0x70, 0xA7, 0x4F, 0x79, 0xD3, 0x72, 0x37,
-    0x7D, 0x3E, 0x87, 0x20, 0x10, 0x01, 0xB2, 0xCD, 0x81, 0x49, 0x48, 0x86, 0xF0, 0x1C, 0xE8, 0x54,
-    0x52, 0x4B, 0xC5, 0xCB, 0x12, 0xB3, 0x48, 0x34, 0x61, 0x62, 0x40, 0x05, 0x9C, 0x08, 0x92, 0x52,
-    0x06, 0xC2, 0xE2, 0xEE, 0xE3, 0xF4, 0xAC, 0x78, 0xC0, 0x43, 0xAA, 0x82, 0x0E, 0x0A, 0xD3, 0xDE,
-    0x3C, 0xB2, 0x50, 0x35, 0xFA, 0x8F, 0x99, 0x8E, 0xA9, 0xD2, 0x84, 0x1D, 0xA1, 0x6E, 0xA1, 0x7E,
-    0x51, 0xC2, 0x82, 0x2A, 0x15, 0xE0, 0xC7, 0xEA, 0xD5, 0x1F, 0x33, 0xBB, 0x47, 0xD0, 0xE0, 0x99,
-    0x2C, 0xCF, 0x56, 0x26, 0xB5, 0x13, 0xFB, 0x76, 0x52, 0x4C, 0x08, 0x1E, 0x43, 0x9B, 0xAF, 0x04,
-    0x97, 0xB1, 0xCD, 0x44, 0x26, 0x66, 0x91, 0x8D, 0x9C, 0x29, 0x7B, 0xE0, 0x4E, 0x99, 0x13, 0x35,
-    0x25, 0x67, 0xC3, 0x7A, 0xC4, 0xB1, 0xF8, 0xD0, 0x0D, 0x7D, 0xF5, 0x29, 0x94, 0xAD, 0xA7, 0x4A,
-    0xB9, 0xC6, 0xEC, 0x32, 0xB1, 0x6C, 0xA8, 0xFC, 0x95, 0xD9, 0x45, 0x03, 0xCA, 0xDC, 0xF1, 0x1B,
-    0xB2, 0x55, 0x29, 0xEA, 0x34, 0xA9, 0x06, 0xE7, 0x08, 0xCD, 0x11, 0xE3, 0x32, 0x2C, 0x1F, 0xF8,
-    0x52, 0x7B, 0xCC, 0xC3, 0x77, 0xCD, 0xB5, 0x4B, 0xCE, 0xF8, 0xDC, 0x0D, 0xD9, 0x20, 0xB3, 0xD1,
-    0x6F, 0x8D, 0x18, 0x90, 0x8B, 0x35, 0x84, 0x51, 0x26, 0x0D, 0x06, 0xA4, 0xCB, 0x7C, 0x32, 0x5D,
-    0xC2, 0x09, 0x33, 0x6A, 0x09, 0xD9, 0xB5, 0xD1, 0x21, 0x93, 0x31, 0x4F, 0xE5, 0x3C, 0x03, 0xC4,
-    0x4F, 0x6B, 0xAC, 0xC7, 0x90, 0x24, 0xB7, 0xFF, 0xC6, 0x90, 0xA4, 0x5C, 0x25, 0xC1, 0xA1, 0xBA,
-    0x10, 0x8B, 0x2A, 0x7F, 0x07, 0x59, 0x67, 0x91, 0x34, 0x08, 0x5A, 0x41, 0x82, 0x6F, 0x93, 0x32,
-    0x26, 0xD3, 0x5C, 0xC4, 0x2C, 0x8B, 0x9D, 0x12, 0xE1, 0x02, 0xC7, 0x55, 0x2A, 0x92, 0x25, 0xD3,
-    0x89, 0x77, 0x1E, 0xB1, 0x5E, 0xC4, 0xCB, 0x41, 0x4B, 0xD6, 0x68, 0x95, 0xC8, 0x31, 0x03, 0xB2,
-    0x4B, 0xB3, 0x1A, 0x86, 0xEC, 0x31, 0x0A, 0x45, 0x7D, 0xB1, 0x0E, 0xEA, 0xA0, 0x0A, 0xC6, 0x61,
-    0x19, 0x96, 0x51, 0x19, 0x8B, 0x52, 0x4E, 0xE4, 0x86, 0x4C, 0x76, 0x64, 0x24, 0xFB, 0x91, 0xB5,
-    0x71, 0xE5, 0x90, 0x0A, 0x4B, 0xC8, 0xAB, 0xDD, 0xAF, 0x38, 0x49, 0xA7, 0xE4, 0xB4, 0x8B, 0x5C,
-    0xE2, 0x94, 0x6A, 0x10, 0xA1, 0x9B, 0x92, 0x66, 0xA9, 0xB3, 0xA7, 0xCD, 0xD2, 0x68, 0xC9, 0x0C,
-    0xED, 0x9B, 0x12, 0x1B, 0x2A, 0xBD, 0x91, 0x92, 0x6C, 0xA9, 0xB6, 0x84, 0x5B, 0xDA, 0x2D, 0xF9,
-    0x96, 0x83, 0x91, 0x32, 0xD1, 0x2A, 0x1F, 0x0D, 0xF5, 0x03, 0x15, 0xD0, 0x3C, 0xA5, 0x6C, 0x43,
-    0x4B, 0xAD, 0xB7, 0xF5, 0x21, 0xB2, 0xE6, 0x10, 0x6D, 0x18, 0x7B, 0x5D, 0x63, 0xF8, 0x82, 0x4E,
-    0xCC, 0x31, 0x6C, 0x83, 0x28, 0xC9, 0xB1, 0x04, 0xCC, 0x61, 0x85, 0x61, 0x2C, 0x5E, 0xFD, 0x9A,
-    0x03, 0x5C, 0x88, 0xAA, 0x4E, 0x2F, 0xD6, 0xB2, 0xFF, 0xAC, 0x10, 0x0A, 0x33, 0x19, 0x84, 0x7A,
-    0xA4, 0x09, 0x47, 0xEA, 0xD9, 0x08, 0x43, 0x0C, 0x3D, 0x6B, 0x55, 0xAC, 0x50, 0x92, 0x80, 0x8E,
-    0x4C, 0xD5, 0xB2, 0x6F, 0xAD, 0xDB, 0xE8, 0x90, 0x5C, 0x9E, 0xB5, 0x32, 0xC4, 0x95, 0xDC, 0xE3,
-    0xAC, 0x6A, 0xC2, 0xAB, 0xBD, 0x62, 0x25, 0x43, 0x37, 0x2A, 0x70, 0xAC, 0x42, 0xE8, 0x5E, 0x23,
-    0x2F, 0x64, 0x30, 0x21, 0xD3, 0xB7, 0xAF, 0xB0, 0x14, 0x1B, 0x33, 0x98, 0xF2, 0xD7, 0x8A, 0x14,
-    0x60, 0xF4, 0x48, 0x77, 0xDF, 0xF4, 0x96, 0x65, 0xC9, 0x49, 0x56, 0x14, 0xDA, 0x41, 0x65, 0xB5,
-    0x59, 0xC0, 0xF8, 0xD0, 0x34, 0x41, 0x65, 0x96, 0x53, 0xB2, 0x4B, 0x69, 0x82, 0x64, 0xB7, 0x34,
-    0x81, 0x55, 0xCB, 0x4B, 0x0B, 0x2E, 0x2D, 0x55, 0xCF, 0xA7, 0xFC, 0x66, 0x41, 0x14, 0xA6, 0x83,
-    0xA8, 0x9D, 0x76, 0x9C, 0x9F, 0x34, 0xB7, 0xE0, 0x78, 0x9E, 0x11, 0x8E, 0xD2, 0x60, 0xB9, 0x26,
-    0x5E, 0xC2, 0x5D, 0x9B, 0x1B, 0x16, 0xA6, 0x49, 0xE2, 0x65, 0x57, 0x24, 0x9B, 0x53, 0x71, 0x7B,
-    0xCE, 0xEE, 0x8A, 0xED, 0x9A, 0xF4, 0xA4, 0x70, 0x80, 0x85, 0xD0, 0xC0, 0x88, 0x5C, 0x86, 0x0B,
-    0x8B, 0xD5, 0x4F, 0xF2, 0x37, 0xB8, 0x2B, 0xDB, 0xB1, 0x27, 0xD5, 0x63, 0xE2, 0xE5, 0x8E, 0x0B,
-    0x83, 0x3D, 0xEB, 0x8F, 0xAC, 0xAB, 0xF9, 0xF6, 0x40, 0xFD, 0xBB, 0x58, 0x61, 0xBD, 0xC5, 0xC5,
-    0x5C, 0x35, 0x90, 0x4C, 0x33, 0xF9, 0xF5, 0x39, 0x85, 0x96, 0x64, 0x85, 0x1F, 0x12, 0xA1, 0xF0,
-    0x13, 0x06, 0xFA, 0x51, 0x53, 0x68, 0x6D, 0x9B, 0xD0, 0xCA, 0x19, 0x65, 0x79, 0x26, 0xA5, 0xB7,
-    0x9F, 0x28, 0x38, 0x22, 0x88, 0x2C, 0x46, 0xE9, 0x9E, 0xCD, 0x58, 0x79, 0x72, 0x34, 0xED, 0xCE,
-    0xB3, 0x3E, 0xE6, 0x71, 0x8F, 0xEA, 0x35, 0xDF, 0x54, 0x77, 0xC8, 0x6C, 0xE9, 0xDB, 0x4D, 0x7D,
-    0xD3, 0xCB, 0x9C, 0x72, 0x18, 0x3A, 0x3D, 0xB6, 0x9B, 0xE7, 0x88, 0xA6, 0x10, 0x57, 0xEC, 0x0E,
-    0x8B, 0xEA, 0x72, 0x10, 0x60, 0xC2, 0xBC, 0xB1, 0x20, 0x1A, 0x8A, 0x87, 0x54, 0x8B, 0x0E, 0xF4,
-    0xFF, 0x4B, 0x48, 0x0D, 0x3E, 0x16, 0x0A, 0x83, 0xCF, 0xE1, 0x94, 0x4D, 0x98, 0xB2, 0x87, 0xF7,
-    0x9D, 0x23, 0x50, 0xC9, 0x45, 0x98, 0x92, 0x54, 0x54, 0x44, 0x82, 0x63, 0x46, 0xC7, 0x06, 0xFE,
-    0x49, 0xBE, 0x4A, 0x34, 0xAB, 0xEF, 0x94, 0x12, 0x6C, 0x93, 0x5B, 0xF6, 0xA1, 0x6C, 0x2C, 0x8B,
-    0x4F, 0x5F, 0x05, 0x05, 0x2E, 0x28, 0x70, 0x1F, 0x4D, 0x41, 0xF7, 0x25, 0x28, 0x38, 0xB2, 0xD3,
-    0x8B, 0x59, 0xD6, 0xD3, 0xC0, 0xF4, 0x8B, 0x9F, 0x3E, 0x9E, 0x9B, 0xD4, 0xFC, 0x4E, 0x6E, 0xD2,
-    0x51, 0xAC, 0x7A, 0x12, 0xE7, 0x77, 0x13, 0x13, 0x5F, 0x41, 0x0D, 0xA6, 0x61, 0xCA, 0xCD, 0x66,
-    0xDC, 0x8E, 0xDB, 0xAA, 0x67, 0x63, 0x2D, 0x5C, 0xCE, 0xC8, 0xEC, 0xF0, 0x36, 0x48, 0xB2, 0x5E,
-    0x55, 0x3B, 0x70, 0x8F, 0xA6, 0xBB, 0xB8, 0x47, 0x95, 0xCA, 0x3D, 0x0B, 0x88, 0xA5, 0xE9, 0x55,
-    0x33, 0x0F, 0x54, 0x62, 0x16, 0x16, 0xE5, 0xAA, 0x3D, 0x50, 0x62, 0xB8, 0x61, 0xB9, 0x99, 0xAF,
-    0x74, 0xBE, 0x52, 0xDE, 0x17, 0x2F, 0xAC, 0xE1, 0xF0, 0x28, 0x8F, 0xFB, 0x64, 0x46, 0x30, 0x0F,
-    0x4F, 0x5F, 0xBC, 0x60, 0x8A, 0x06, 0x55, 0xDB, 0x85, 0xCD, 0xAE, 0x96, 0xBD, 0xAB, 0x1C, 0xCC,
-    0xCE, 0xFD, 0x93, 0x65, 0x5B, 0x2F, 0x90, 0xC1, 0xDC, 0x4D, 0x8F, 0x39, 0xB2, 0xA4, 0x88, 0x05,
-    0xA7, 0xF4, 0xF5, 0x56, 0x3A, 0x16, 0x67, 0x8D, 0x2D, 0xC1, 0x35, 0x72, 0xB6, 0x05, 0x86, 0x98,
-    0x38, 0x6C, 0x11, 0x88, 0xCB, 0x44, 0xA2, 0x26, 0x14, 0xF9, 0x63, 0xEA, 0xD8, 0xF1, 0xAA, 0x8E,
-    0x5D, 0x49, 0xC5, 0x1E, 0x35, 0x8A, 0x8B, 0x02, 0x43, 0x64, 0x58, 0x9A, 0x5B, 0x4E, 0xC5, 0x1E,
-    0xDE, 0x76, 0xD2, 0xB8, 0x0B, 0x4A, 0x67, 0x26, 0x54, 0xB5, 0xE2, 0x8F, 0x34, 0x72, 0x6D, 0xF3,
-    0xAD, 0xAF, 0x5C, 0x02, 0x5E, 0xC0, 0x70, 0x1B, 0x1C, 0xCF, 0xC0, 0x2A, 0x87, 0xCB, 0x5F, 0x52,
-    0x02, 0x44, 0xCA, 0x45, 0xC8, 0xAD, 0x77, 0xA0, 0xFB, 0x35, 0x5D, 0xF6, 0xCD, 0xE0, 0x87, 0xBE,
-    0x10, 0x96, 0x57, 0xC3, 0xB2, 0x8B, 0xCA, 0x2E, 0xCE, 0xFF, 0x2A, 0xFE, 0xED, 0x7E, 0xE8, 0xE3,
-    0x31, 0x72, 0x12, 0x03, 0x74, 0xCA, 0x17, 0x00, 0xAE, 0xED, 0x13, 0x69, 0x30, 0x4A, 0x4C, 0x0C,
-    0x1E, 0x7D, 0x22, 0x51, 0xDE, 0x3E, 0x0F, 0xFF, 0x3D, 0x5A, 0x91, 0xC9, 0x81, 0xDB, 0x7C, 0xF5,
-    0x90, 0x19, 0xDD, 0x34, 0x1D, 0x50, 0x43, 0x82, 0x68, 0x6A, 0xFE, 0xF5, 0xE1, 0xFE, 0xA7, 0x8D,
-    0x6B, 0xDC, 0x9F, 0x58, 0xA7, 0xC0, 0xDA, 0x81, 0xC8, 0x6A, 0xF8, 0x73, 0x83, 0x33, 0x03, 0xF6,
-    0xC6, 0xBB, 0x25, 0xFE, 0xE2, 0x16, 0x8E, 0x56, 0x2A, 0x58, 0x88, 0x43, 0x02, 0x28, 0xE4, 0x67,
-    0x1F, 0x57, 0x22, 0x43, 0x95, 0x6B, 0x4E, 0x04, 0x8E, 0xB2, 0xFB, 0x49, 0xC5, 0x0E, 0x21, 0xEF,
-    0x83, 0x9A, 0x79, 0x21, 0xEF, 0xFD, 0x29, 0xDF, 0xFD, 0xF7, 0x1A, 0xD6, 0x93, 0xFC, 0xBC, 0xC5,
-    0x19, 0x61, 0xC3, 0xD8, 0x26, 0x73, 0x47, 0x59, 0xAA, 0xEF, 0x49, 0xB9, 0xC9, 0x22, 0x59, 0x54,
-    0x5E, 0x66, 0x1F, 0x46, 0x58, 0xBD, 0xC3, 0x0E, 0x82, 0xA0, 0xAE, 0x99, 0xD3, 0xF1, 0xA6, 0xFA,
-    0xEE, 0xB6, 0x15, 0xDB, 0xCB, 0xC0, 0x3C, 0x92, 0xDE, 0x86, 0xD9, 0x98, 0x5A, 0xB3, 0x33, 0x38,
-    0xF3, 0x30, 0x90, 0x27, 0xDA, 0x94, 0x5E, 0x40, 0x21, 0xE4, 0x85, 0xAA, 0x98, 0x8F, 0xE4, 0xBD,
-    0x7B, 0x32, 0xEA, 0xBB, 0xDC, 0xA8, 0x1C, 0x96, 0x7C, 0xEE, 0xA4, 0x09, 0xC4, 0xD3, 0x45, 0x9E,
-    0xC2, 0x45, 0x9E, 0xC2, 0x7D, 0xF0, 0xA8, 0x3C, 0xC5, 0x97, 0x08, 0xB0, 0x0F, 0x3E, 0x8C, 0x2B,
-    0xAF, 0xD0, 0x0A, 0x51, 0xFF, 0xED, 0x19, 0xFB, 0xF9, 0xA6, 0x7D, 0xFF, 0xFE, 0xFA, 0x2D, 0x7B,
-    0x8D, 0xB1, 0x0A, 0x77, 0xDA, 0x4B, 0x36, 0xFC, 0x63, 0x66, 0xE9, 0x0D, 0x05, 0xDB, 0xD2, 0xE9,
-    0x1A, 0x57, 0x9B, 0x51, 0x4A, 0xCD, 0x19, 0x3A, 0xB5, 0xCD, 0x49, 0xF6, 0x3D, 0xB5, 0x99, 0x3D,
-    0x06, 0x49, 0xFA, 0xFF, 0xF1, 0x34, 0xBC, 0x8C, 0xFE, 0x9C, 0xAD, 0x41, 0x59, 0x2E, 0xDD, 0xAD,
-    0x2C, 0xB7, 0xC7, 0x3B, 0x65, 0x43, 0x2C, 0xCD, 0x5E, 0xF7, 0x6D, 0x93, 0xC1, 0xC4, 0xEE, 0xC7,
-    0xD0, 0x19, 0x75, 0xDF, 0xEF, 0x4A, 0x31, 0xB5, 0xD1, 0xB7, 0xBB, 0x0F, 0x84, 0xCF, 0x9B, 0x26,
-    0xF9, 0x11, 0xED, 0x64, 0x72, 0x89, 0x9E, 0x7A, 0x52, 0xE9, 0x1B, 0xD3, 0xC4, 0x82, 0x20, 0x3D,
-    0xF7, 0x42, 0x7D, 0xF7, 0x56, 0xED, 0x67, 0xA3, 0x82, 0xCA, 0x10, 0xCD, 0x90, 0x30, 0x26, 0xB2,
-    0x61, 0xD0, 0x3C, 0xF6, 0xA8, 0xF2, 0x4D, 0x2D, 0x52, 0xF2, 0x27, 0xB4, 0x80, 0x70, 0x97, 0x90,
-    0xB4, 0x98, 0xCE, 0x53, 0xD5, 0x4F, 0xB2, 0xEB, 0xC1, 0xFE, 0x3C, 0xBC, 0xA1, 0x59, 0x7E, 0xEF,
-    0x4B, 0xFC, 0x36, 0x02, 0xE8, 0x13, 0xF3, 0x5A, 0x07, 0x37, 0x1B, 0x37, 0xF4, 0x10, 0xF8, 0xB3,
-    0x27, 0x14, 0x89, 0xEC, 0x91, 0x22, 0x31, 0xC1, 0xE5, 0x36, 0x32, 0x5E, 0x48, 0x50, 0xEF, 0x00,
-    0x96, 0x73, 0x07, 0x30, 0x5D, 0x0A, 0xB6, 0x18, 0xE1, 0xE4, 0xBF, 0xB5, 0x23, 0x47, 0x22, 0x1E,
-    0xCC, 0xD5, 0x7D, 0xD6, 0xB2, 0x31, 0x4F, 0xC2, 0x15, 0x71, 0x23, 0x64, 0xE6, 0x8C, 0x86, 0x0F,
-    0x1F, 0xD6, 0x08, 0x8F, 0xBC, 0x09, 0x4A, 0x27, 0xDE, 0x14, 0xC2, 0x27, 0x63, 0x85, 0x31, 0x66,
-    0xF6, 0x1D, 0xD0, 0xF9, 0x13, 0x66, 0xDE, 0x39, 0x06, 0x28, 0x9D, 0xC8, 0x4E, 0xA0, 0x31, 0x2F,
-    0x1A, 0x33, 0x33, 0x51, 0xB2, 0xB5, 0x30, 0x4D, 0x98, 0x67, 0x16, 0x5A, 0xC5, 0x19, 0x90, 0x19,
-    0x64, 0x7A, 0x16, 0xAB, 0x45, 0x0E, 0xFE, 0x45, 0x1B, 0xF3, 0xEE, 0x0C, 0x3A, 0x69, 0x1F, 0xD2,
-    0x0A, 0xEF, 0x83, 0xDA, 0xE4, 0x33, 0x66, 0x53, 0x46, 0x9A, 0x2F, 0x10, 0x2C, 0x24, 0xFE, 0x28,
-    0x6D, 0xC5, 0x1B, 0x31, 0x89, 0x0C, 0x62, 0xF7, 0xF3, 0x8C, 0x3D, 0x4F, 0x70, 0x55, 0x98, 0x0D,
-    0x29, 0x70, 0x4F, 0xA6, 0x95, 0x1C, 0x41, 0x32, 0x2E, 0xE1, 0x2B, 0xDC, 0x93, 0xF8, 0xD9, 0x1D,
-    0x14, 0xBE, 0x7D, 0xB3, 0x41, 0x89, 0x63, 0x99, 0xF5, 0x81, 0x96, 0x59, 0x79, 0xC2, 0xBE, 0x97,
-    0x1F, 0x04, 0xDC, 0x3C, 0x61, 0xC0, 0x78, 0x79, 0x04, 0xE2, 0x6F, 0xF5, 0xB4, 0x9F, 0xC9, 0x9F,
-    0x25, 0x82, 0x66, 0x63, 0xE7, 0xA7, 0x10, 0xC9, 0x77, 0x99, 0xE7, 0xA7, 0x8A, 0x69, 0x58, 0xAF,
-    0x41, 0x22, 0x42, 0xA2, 0xBE, 0x4B, 0x07, 0x42, 0xFE, 0x8E, 0xBF, 0xF1, 0xA6, 0xDC, 0xF8, 0xA7,
-    0xB2, 0xE6, 0x6D, 0x21, 0xC6, 0x99, 0x88, 0x7D, 0xF4, 0xCB, 0x2B, 0xF0, 0x7E, 0xAE, 0x3D, 0x53,
-    0x30, 0xE7, 0x20, 0xC9, 0xAB, 0x05, 0x4C, 0x1D, 0xBA, 0x0B, 0x05, 0xA8, 0x04, 0x0D, 0x7B, 0x58,
-    0x21, 0x15, 0x8B, 0xCD, 0xA9, 0x25, 0x90, 0x6A, 0xE9, 0x97, 0x5F, 0x02, 0x60, 0x85, 0xAD, 0x76,
-    0x8E, 0xAC, 0xC5, 0xE8, 0x3D, 0xEC, 0xC6, 0x56, 0x63, 0xDA, 0xED, 0x0B, 0xD0, 0x7A, 0x2E, 0xA6,
-    0x93, 0xB9, 0xBC, 0xFB, 0xDB, 0xE7, 0xF9, 0x3E, 0xB1, 0xD5, 0x19, 0x35, 0x0D, 0x1A, 0x5F, 0xC9,
-    0xFF, 0xA9, 0x70, 0xE4, 0x9D, 0x4E, 0xBA, 0x5C, 0x27, 0xC4, 0x7A, 0x88, 0xFC, 0x23, 0xA8, 0x72,
-    0xF9, 0x10, 0x99, 0x49, 0x28, 0x29, 0xE4, 0x24, 0x01, 0x68, 0x77, 0xF7, 0x7A, 0xA7, 0xED, 0x35,
-    0x3C, 0xBF, 0x17, 0xCC, 0x0A, 0x6A, 0x48, 0xFB, 0x08, 0x6E, 0x11, 0xDA, 0x91, 0xCD, 0x6C, 0xE4,
-    0xA2, 0x23, 0x39, 0x99, 0x3A, 0x0D, 0xD0, 0xAB, 0x1D, 0x08, 0x4C, 0x52, 0xB9, 0xD8, 0xE1, 0xA4,
-    0xF4, 0x6B, 0x60, 0x58, 0x72, 0x2F, 0x93, 0xFF, 0xEC, 0xC8, 0xAC, 0x6C, 0x15, 0x90, 0xBC, 0x30,
-    0x4F, 0x74, 0x16, 0xB4, 0x2E, 0xC0, 0x53, 0x5B, 0x1D, 0x3D, 0x51, 0xE2, 0xA5, 0x60, 0xFA, 0x79,
-    0xE5, 0x97, 0x82, 0xEA, 0x77, 0x44, 0x95, 0x08, 0xAE, 0x7D, 0x3F, 0xD5, 0xE1, 0x74, 0xD1, 0xAD,
-    0xAF, 0xB9, 0x3D, 0x4D, 0xAF, 0x69, 0x95, 0x56, 0x3B, 0x99, 0x4E, 0xAE, 0xD5, 0x25, 0x67, 0x3B,
-    0xEC, 0x10, 0xD5, 0x94, 0x00, 0xF2, 0x3A, 0x0D, 0xD2, 0xDD, 0x0E, 0x85, 0x49, 0x45, 0x4A, 0xF4,
-    0x39, 0xC6, 0x09, 0xC7, 0x1A, 0xBA, 0xD9, 0xC7, 0xCE, 0x02, 0x3D, 0xB4, 0xD6, 0x56, 0xB2, 0x6F,
-    0x28, 0x91, 0xC9, 0xAD, 0xD1, 0xDD, 0x8E, 0x1B, 0x91, 0x69, 0x8E, 0x8A, 0x34, 0xB3, 0x8F, 0x8C,
-    0xBA, 0x3C, 0xB3, 0xDD, 0xB8, 0xD8, 0xB8, 0x19, 0x03, 0x90, 0x19, 0xE6, 0x3E, 0xD1, 0xFD, 0xA3,
-    0x3B, 0x4B, 0x0B, 0xD9, 0xB1, 0x8B, 0xA5, 0xE6, 0x36, 0xC3, 0x4A, 0xB3, 0x77, 0xF0, 0xDC, 0x64,
-    0xE7, 0xDC, 0xC5, 0x49, 0x4F, 0xA6, 0x51, 0x1D, 0x4F, 0x8B, 0xA9, 0x7B, 0xEF, 0x3F, 0xA6, 0xEE,
-    0x6F, 0xD2, 0x89, 0xFB, 0xC0, 0xEC, 0x78, 0x9A, 0x73, 0xD6, 0xFC, 0x72, 0xAD, 0x77, 0xCF, 0x63,
-    0xD6, 0x7C, 0x39, 0x07, 0x9E, 0xF4, 0x79, 0xAA, 0x7D, 0xC7, 0xF7, 0x7A, 0x42, 0x6E, 0x6B, 0x90,
-    0x8E, 0xAB, 0xD7, 0x92, 0x71, 0xAC, 0x79, 0xBF, 0x81, 0xFD, 0xFF, 0xA1, 0x50, 0x10, 0xFF, 0x25,
-    0x22, 0xC3, 0x4B, 0x78, 0xAE, 0xE6, 0xDA, 0xD7, 0x6C, 0xE1, 0x9F, 0x51, 0xCE, 0x72, 0x39, 0x6D,
-    0x90, 0xF0, 0x9C, 0x3E, 0x2A, 0xE1, 0xB9, 0xE2, 0xD9, 0x47, 0x73, 0x72, 0xCE, 0x62, 0x78, 0x7B,
-    0xE0, 0x41, 0x8B, 0x0F, 0xF9, 0x32, 0x9C, 0x11, 0xFA, 0x0A, 0xB1, 0xE6, 0x48, 0x99, 0xB0, 0x0C,
-    0x1A, 0xB3, 0xD6, 0xDF, 0xB5, 0xFF, 0x60, 0x67, 0x00, 0x40, 0xEF, 0x5F, 0x5D, 0x7F, 0xFA, 0xFD,
-    0x59, 0xB9, 0xEA, 0xF1, 0x43, 0xEC, 0x0C, 0xE4, 0xCE, 0x40, 0xF0, 0x50, 0x6C, 0x9D, 0x18, 0x88,
-    0x9E, 0x76, 0xF7, 0x33, 0x01, 0xA0, 0x19, 0xAC, 0xBA, 0x8F, 0xF8, 0x17, 0xD9, 0x62, 0x4D, 0x43,
-    0x3F, 0x2C, 0x5F, 0xDA, 0x47, 0xE4, 0x7A, 0x67, 0xD9, 0x7F, 0x77, 0x73, 0x3D, 0x04, 0x2F, 0x50,
-    0x3D, 0x7E, 0x50, 0x88, 0x4B, 0x9A, 0xB3, 0xF4, 0x20, 0x00, 0xDD, 0x86, 0x8B, 0xD6, 0x1A, 0x67,
-    0x47, 0x93, 0xE9, 0xDC, 0x61, 0x66, 0xCE, 0x19, 0xB6, 0xC4, 0x53, 0xA3, 0xB5, 0x2C, 0xDB, 0x53,
-    0x15, 0x37, 0x73, 0x27, 0xAE, 0xD3, 0x67, 0x0C, 0x4E, 0x81, 0xA6, 0x5B, 0xFD, 0xC0, 0xB4, 0x07,
-    0xDA, 0xE7, 0x64, 0x47, 0xEE, 0xBD, 0x5E, 0x43, 0x89, 0xA6, 0xCB, 0x4A, 0x65, 0xD6, 0xCB, 0x0C,
-    0xFD, 0x5D, 0x7A, 0x93, 0xAF, 0xAC, 0x28, 0x74, 0xF4, 0xB6, 0xBF, 0x56, 0x8B, 0x69, 0xD1, 0x9A,
-    0x25, 0x87, 0xDA, 0x8A, 0x57, 0x4B, 0xBF, 0x83, 0x52, 0x39, 0xB5, 0x05, 0x5B, 0x21, 0x25, 0x57,
-    0xD5, 0xFD, 0x1C, 0xB8, 0xDF, 0x44, 0x8E, 0x7C, 0x4B, 0x1B, 0x31, 0xD0, 0x87, 0xF1, 0xD1, 0x08,
-    0x6A, 0x75, 0xB2, 0xDC, 0xFA, 0xE6, 0xB2, 0x7B, 0x10, 0x43, 0xF4, 0x0F, 0x72, 0xF3, 0x0F, 0xD0,
-    0x5E, 0x52, 0x99, 0x9D, 0x7D, 0x83, 0x15, 0x73, 0xAF, 0x25, 0xE3, 0x00, 0xF4, 0x86, 0xA0, 0x2F,
-    0x64, 0xD8, 0x13, 0x02, 0x8C, 0x04, 0x22, 0x20, 0x04, 0x80, 0x80, 0x0F, 0x33, 0x6E, 0xAD, 0x05,
-    0x07, 0xD8, 0x10, 0x1A, 0xFC, 0x27, 0x2E, 0x81, 0x0B, 0x60, 0xD9, 0x62, 0x76, 0x3A, 0x4A, 0x81,
-    0x09, 0x21, 0x79, 0xF1, 0xAB, 0xE6, 0x96, 0x15, 0x51, 0x5A, 0x15, 0x0A, 0x2F, 0x73, 0x29, 0x1C,
-    0xA0, 0x0B, 0x3C, 0xC4, 0x22, 0xDE, 0xEC, 0x69, 0x33, 0xBD, 0x65, 0xE3, 0x79, 0x38, 0x49, 0x08,
-    0x59, 0x7D, 0xD5, 0xF3, 0x91, 0xD0, 0x13, 0x31, 0x44, 0x73, 0x53, 0xC4, 0x68, 0xEE, 0x98, 0x91,
-    0xFF, 0x84, 0xD5, 0x88, 0x42, 0xEB, 0x64, 0xE3, 0x45, 0xD2, 0x74, 0x45, 0x52, 0x14, 0x3C, 0x45,
-    0x4F, 0xE1, 0x53, 0xFC, 0x14, 0x40, 0x5B, 0x19, 0xB3, 0xB5, 0xC2, 0x74, 0x91, 0x15, 0x88, 0xF5,
-    0xE1, 0x48, 0x7D, 0xA4, 0x54, 0x13, 0x06, 0x71, 0x33, 0x08, 0x94, 0x3A, 0x63, 0x9F, 0xE4, 0x21,
-    0x98, 0xE6, 0xD6, 0x7C, 0xD4, 0x04, 0xA3, 0x51, 0x40, 0x15, 0x51, 0x0B, 0xA9, 0x95, 0x20, 0xD1,
-    0x4A, 0xC8, 0x49, 0xC4, 0x80, 0xB2, 0xE9, 0xB5, 0x52, 0xB1, 0xA6, 0x95, 0xF6, 0xF8, 0xB8, 0xA1,
-    0xEB, 0xA5, 0xCB, 0x23, 0x8C, 0x69, 0x9C, 0x26, 0x69, 0x94, 0x6E, 0xC1, 0x07, 0x94, 0xBB, 0x44,
-    0xB3, 0x9A, 0x4B, 0xA2, 0x59, 0x8F, 0xCE, 0x4B, 0x7A, 0xEB, 0xD5, 0xC3, 0x66, 0xB5, 0x7A, 0xE8,
-    0xAD, 0x67, 0xB6, 0xAB, 0xD5, 0xCC, 0x76, 0x34, 0xCC, 0x6C, 0x63, 0xFC, 0x7A, 0xF7, 0x29, 0xFB,
-    0x22, 0x66, 0x73, 0xE3, 0xA3, 0x35, 0x1F, 0x5B, 0xC6, 0x5C, 0x3C, 0x5C, 0xD3, 0xEB, 0x59, 0x32,
-    0x19, 0x4F, 0xE6, 0xC5, 0x2B, 0x28, 0x07, 0x54, 0x3F, 0x84, 0x3D, 0x47, 0xF8, 0x60, 0xF0, 0xD5,
-    0x27, 0xAD, 0x9F, 0xA0, 0x41, 0xC4, 0xAF, 0x8F, 0x89, 0x48, 0x4F, 0xB4, 0xE9, 0xEB, 0x8E, 0xB6,
-    0xBF, 0xB1, 0x8A, 0x32, 0x70, 0x2A, 0x0A, 0xF8, 0xA7, 0x64, 0xE6, 0x39, 0xF9, 0x83, 0xE8, 0x1A,
-    0x5A, 0x3C, 0x78, 0xBF, 0xA2, 0xA9, 0x2E, 0x7B, 0xCD, 0x65, 0x01, 0x1A, 0x86, 0xB0, 0xFB, 0x0C,
-    0x67, 0x83, 0xF6, 0x22, 0x72, 0x5E, 0x32, 0x47, 0xF0, 0xFB, 0xA7, 0xC5, 0xC0, 0x9F, 0xA5, 0x51,
-    0xC2, 0xF9, 0x8E, 0x50, 0xF1, 0xE8, 0xEA, 0x05, 0x3E, 0xBB, 0xD4, 0x08, 0x92, 0x87, 0xD4, 0x08,
-    0x32, 0x07, 0xAB, 0xC8, 0x61, 0x6D, 0x35, 0x99, 0xF2, 0xBB, 0xF3, 0x7E, 0xE4, 0xAD, 0xD9, 0x75,
-    0x75, 0xC9, 0x77, 0xAF, 0x9E, 0x3C, 0x21, 0xEF, 0x3E, 0x39, 0x3E, 0x03, 0x31, 0xF3, 0xBB, 0x16,
-    0x0D, 0x65, 0x5A, 0x3E, 0xE0, 0xC9, 0xFA, 0xBD, 0x7B, 0xE7, 0x85, 0xF1, 0x13, 0x9F, 0xA6, 0xEB,
-    0x1D, 0x38, 0x51, 0x99, 0x86, 0xDD, 0xD8, 0xE7, 0x03, 0xD4, 0xFD, 0x31, 0x4E, 0x26, 0x20, 0xFE,
-    0x8B, 0xD9, 0xDF, 0x42, 0x14, 0xA1, 0x85, 0x9C, 0x34, 0x58, 0x32, 0x53, 0x78, 0x76, 0xDF, 0xED,
-    0xDA, 0x8B, 0xDD, 0x35, 0xB7, 0x98, 0xC2, 0x95, 0x88, 0x52, 0xEC, 0xE4, 0x4B, 0xDC, 0xC9, 0xD3,
-    0xE4, 0x63, 0x93, 0xCA, 0x75, 0x93, 0xDC, 0x6C, 0x92, 0x8F, 0xCB, 0x04, 0xFA, 0x1D, 0xF2, 0x41,
-    0xBF, 0x08, 0x8F, 0x57, 0xE7, 0xC8, 0xF7, 0xA0, 0xA1, 0x13, 0x05, 0x4B, 0x34, 0xF9, 0x67, 0x14,
-    0xFD, 0x51, 0x3F, 0xFA, 0x39, 0xE0, 0x13, 0x8D, 0x3D, 0x22, 0x7F, 0x19, 0x35, 0xA9, 0xEA, 0x9F,
-    0x70, 0x86, 0xD6, 0x82, 0x25, 0xFD, 0xC3, 0xC0, 0x46, 0x2C, 0xAC, 0x70, 0x59, 0xFC, 0x77, 0x69,
-    0x4E, 0xE1, 0x91, 0xBD, 0x17, 0x9C, 0x9B, 0x43, 0x87, 0x08, 0x19, 0xB5, 0x57, 0x91, 0xD1, 0x71,
-    0x91, 0x4D, 0x73, 0x6D, 0x46, 0x27, 0x4E, 0x99, 0xCC, 0xE9, 0x33, 0x3A, 0xBB, 0x24, 0x80, 0x70,
-    0x79, 0xEE, 0xA3, 0x3F, 0xE2, 0x28, 0xEE, 0xF9, 0x23, 0x34, 0x9D, 0xFE, 0xA2, 0x39, 0x16, 0x75,
-    0xEF, 0x76, 0x75, 0x30, 0x43, 0x6A, 0xE7, 0xFC, 0xA2, 0x7B, 0xD4, 0x74, 0xD4, 0x7C, 0x5D, 0x37,
-    0x3E, 0x10, 0xA8, 0x69, 0x10, 0xD8, 0xD9, 0x14, 0xCF, 0xB3, 0xC3, 0xEA, 0xFB, 0x7C, 0x38, 0xE4,
-    0xB2, 0xC3, 0x20, 0xF6, 0x06, 0x7D, 0x4E, 0x92, 0xB5, 0xF1, 0x2B, 0x73, 0x10, 0x70, 0xF3, 0x52,
-    0x0F, 0x3E, 0xB8, 0x5C, 0xE8, 0x3E, 0x80, 0x4A, 0x66, 0xA2, 0x60, 0xC9, 0x50, 0x3F, 0x23, 0x69,
-    0x53, 0x77, 0x25, 0x24, 0x82, 0xA7, 0xD9, 0x4C, 0x70, 0x8A, 0x3E, 0xB8, 0xFE, 0xAC, 0x9F, 0x7B,
-    0x33, 0x73, 0x60, 0x64, 0xD1, 0x64, 0xA8, 0xC4, 0x3E, 0x40, 0x69, 0x17, 0x0F, 0xB8, 0x78, 0xE5,
-    0x29, 0xFB, 0x13, 0x3F, 0xE3, 0xB7, 0xCF, 0x0E, 0x62, 0xE7, 0xCD, 0xE3, 0x6C, 0x67, 0x66, 0x1A,
-    0x6B, 0xCC, 0xEE, 0xD9, 0x6F, 0xC3, 0x5E, 0x5D, 0x61, 0xF7, 0xF8, 0xB5, 0x23, 0x07, 0x03, 0xD6,
-    0x23, 0xC8, 0x02, 0xC6, 0xEF, 0xE1, 0x41, 0x52, 0x10, 0x31, 0x15, 0xF7, 0xD7, 0xAB, 0xCE, 0xAD,
-    0x26, 0x00, 0xF7, 0x18, 0xCC, 0x7D, 0x07, 0x8E, 0xE6, 0x0C, 0x62, 0x33, 0x2F, 0xB4, 0xA9, 0x95,
-    0xB6, 0xA3, 0xDA, 0xED, 0x62, 0x3A, 0x2F, 0xEF, 0xEC, 0x29, 0x3C, 0x37, 0xFB, 0xF0, 0x34, 0x5A,
-    0x8E, 0xB6, 0x69, 0xEA, 0xA3, 0xF9, 0x83, 0x67, 0xFD, 0xB3, 0x60, 0xF3, 0xC7, 0xC1, 0x68, 0xAF,
-    0xED, 0x0F, 0x8D, 0x2D, 0x80, 0x78, 0x95, 0xAD, 0x88, 0x1C, 0x59, 0x7B, 0x34, 0xAC, 0x4F, 0x67,
-    0xD4, 0xF2, 0x8D, 0x0B, 0x47, 0xE1, 0x9A, 0x2C, 0xE3, 0xE8, 0x7E, 0x64, 0xA8, 0xB8, 0xC0, 0x39,
-    0x81, 0xA3, 0x03, 0x2F, 0x05, 0xD9, 0xBB, 0x2D, 0x38, 0x2D, 0x5E, 0x87, 0xBC, 0xA6, 0xFC, 0xE0,
-    0x0B, 0xAD, 0x13, 0x66, 0x3D, 0xE2, 0x1C, 0x95, 0x9A, 0x06, 0x9D, 0x01, 0x28, 0x44, 0xB7, 0xE6,
-    0x54, 0x5C, 0xFA, 0xEC, 0x2F, 0x3F, 0x1B, 0x95, 0x08, 0xB1, 0x5B, 0xF3, 0x76, 0xC4, 0xF2, 0xE4,
-    0xCC, 0x54, 0x51, 0x09, 0x82, 0x66, 0xEE, 0x38, 0x44, 0xD6, 0xD6, 0x8C, 0x44, 0x6B, 0x96, 0xAC,
-    0x88, 0x04, 0x69, 0xF8, 0x2E, 0x83, 0x84, 0xD0, 0x84, 0x3F, 0x07, 0xF7, 0xD9, 0x69, 0x13, 0x7E,
-    0xC8, 0xF6, 0x24, 0xD9, 0xFF, 0x8F, 0x19, 0xF9, 0x5D, 0x32, 0xC1, 0x27, 0x64, 0x13, 0xCF, 0x36,
-    0xDB, 0x90, 0x48, 0xB3, 0x34, 0x49, 0x69, 0x1F, 0x21, 0x49, 0xD2, 0xF9, 0xB3, 0x84, 0x1B, 0xD7,
-    0x86, 0x65, 0x39, 0xDB, 0x8A, 0xA7, 0xC0, 0xB0, 0xF9, 0x0E, 0x72, 0x11, 0xAC, 0xE2, 0x21, 0x2A,
-    0xE5, 0xB8, 0x78, 0x8D, 0x17, 0x21, 0x4F, 0x61, 0x85, 0x84, 0x4D, 0xEA, 0x55, 0x32, 0x63, 0x97,
-    0xBA, 0x95, 0x57, 0x3B, 0x9F, 0xA7, 0xEE, 0xD8, 0xAB, 0xBD, 0x4F, 0x52, 0xAF, 0xF4, 0x6A, 0xFF,
-    0xF5, 0xDC, 0xCF, 0xBD, 0x3A, 0x8C, 0xF2, 0x40, 0xF6, 0xFC, 0x64, 0x94, 0x1F, 0x95, 0xB7, 0xCD,
-    0x28, 0xDF, 0x94, 0xB7, 0x4B, 0x51, 0x7E, 0x49, 0xDE, 0xEA, 0x30, 0x97, 0x60, 0xE6, 0xD7, 0xE3,
-    0xF0, 0xBD, 0xD2, 0x78, 0xFF, 0x5B, 0x86, 0x1F, 0x88, 0x9D, 0xF8, 0xC2, 0x84, 0xFF, 0x4E, 0x35,
-    0x8C, 0x47, 0x1F, 0x05, 0xED, 0x90, 0x09, 0x74, 0xEB, 0xE7, 0x59, 0x65, 0xEE, 0xB0, 0xC7, 0xC1,
-    0x27, 0x6F, 0x11, 0x59, 0xBD, 0x4A, 0x19, 0x98, 0x00, 0x4F, 0x37, 0x77, 0x97, 0x83, 0xC0, 0xA4,
-    0xAB, 0xA2, 0xAE, 0x8A, 0x67, 0x3B, 0xC7, 0xBB, 0x1D, 0xE4, 0x96, 0x5A, 0xBA, 0xD3, 0x13, 0xF6,
-    0x5E, 0x57, 0xFC, 0x2F, 0x1F, 0x5F, 0x0F, 0x99, 0x48, 0x3B, 0x4D, 0x94, 0x2E, 0x53, 0xA0, 0xF8,
-    0x7B, 0x85, 0xDE, 0xA7, 0x6D, 0xF8, 0x19, 0x63, 0xE1, 0xFF, 0x59, 0x2C, 0xBB, 0xE4, 0x85, 0xD7,
-    0x8F, 0xF2, 0x44, 0x99, 0xAB, 0xDB, 0xA0, 0x0F, 0x1A, 0xF7, 0x7E, 0x83, 0x36, 0x78, 0xEA, 0xEF,
-    0xDD, 0xD1, 0x98, 0xF2, 0xF6, 0x16, 0xCB, 0xA1, 0x90, 0x03, 0x2F, 0x5F, 0x6E, 0x32, 0xC3, 0x6E,
-    0x7A, 0x78, 0xF2, 0x9F, 0x58, 0x14, 0x48, 0xA3, 0x6B, 0xD7, 0x9D, 0x10, 0x0A, 0x7F, 0x5D, 0x25,
-    0x4C, 0xCE, 0x99, 0xFE, 0x76, 0x1D, 0x78, 0xEB, 0x15, 0x58, 0xF2, 0x6B, 0x04, 0x46, 0xB2, 0x03,
-    0x0C, 0x1D, 0xCE, 0x30, 0xB7, 0xB3, 0x49, 0xE7, 0x9A, 0x75, 0x72, 0x16, 0x17, 0x35, 0xEA, 0xEC,
-    0x7F, 0x1D, 0xC5, 0xE0, 0x80, 0x0F, 0x1E, 0xFF, 0xD1, 0xF0, 0x2B, 0x9B, 0xF3, 0x9E, 0xB0, 0xF4,
-    0x11, 0xDF, 0x57, 0xE2, 0xDE, 0x61, 0x4D, 0x54, 0x6B, 0x25, 0x1C, 0xCD, 0x24, 0xD8, 0xED, 0xA9,
-    0xB2, 0x7D, 0xB8, 0x0B, 0x7C, 0xE4, 0xA5, 0xFF, 0x1D, 0x48, 0xD5, 0xBC, 0x9F, 0xC0, 0x26, 0x66,
-    0xAF, 0xAD, 0x30, 0x10, 0xF1, 0x71, 0xDB, 0xA4, 0xC3, 0xB3, 0x1A, 0xE7, 0x38, 0xE1, 0x26, 0x73,
-    0x00, 0x97, 0x8C, 0xDB, 0x22, 0x67, 0xEA, 0x4F, 0x17, 0xCA, 0x46, 0x1F, 0xCC, 0xE2, 0x32, 0x2E,
-    0xE5, 0xD3, 0x7E, 0x59, 0xED, 0xFA, 0xA5, 0x16, 0xC3, 0x57, 0xBE, 0x3C, 0xC9, 0x2F, 0x4F, 0xF1,
-    0xCB, 0x4D, 0x7E, 0x39, 0x35, 0xC9, 0xDD, 0xEB, 0x6F, 0x4D, 0xF0, 0xEB, 0x12, 0x34, 0x1B, 0xB1,
-    0x9C, 0xB3, 0x5B, 0xFC, 0xDA, 0x9E, 0x57, 0x56, 0x80, 0xEF, 0x72, 0xFD, 0x15, 0x0B, 0x37, 0x71,
-    0x71, 0x0D, 0xC5, 0x35, 0x26, 0x64, 0x44, 0x89, 0x7A, 0xB3, 0xE8, 0x63, 0x2E, 0x6F, 0xF5, 0xF3,
-    0x43, 0xF8, 0xFC, 0x79, 0x98, 0x9E, 0x53, 0xC0, 0xF6, 0x0A, 0xD0, 0x9B, 0x62, 0xCE, 0x89, 0x99,
-    0x3F, 0x4A, 0x71, 0x7B, 0x90, 0x40, 0xD1, 0xF1, 0xF2, 0xAE, 0xDA, 0x74, 0xDF, 0x21, 0xE8, 0xCC,
-    0xC5, 0x3B, 0x9E, 0x37, 0x24, 0x06, 0xE9, 0x2E, 0xA2, 0xBB, 0x67, 0x08, 0x3A, 0x78, 0x98, 0x59,
-    0xA6, 0xE4, 0x91, 0xB9, 0x79, 0x75, 0xD1, 0xF0, 0x9D, 0xD4, 0xC3, 0xE6, 0xAD, 0x7D, 0x8B, 0xE0,
-    0x73, 0xE6, 0x6B, 0x70, 0x1D, 0x44, 0x67, 0xF8, 0xEF, 0xD7, 0x36, 0x0D, 0xA2, 0x59, 0x90, 0xF6,
-    0x59, 0xC9, 0xA0, 0xFB, 0x53, 0xB5, 0xD4, 0xB8, 0x16, 0xCD, 0xF6, 0xA2, 0x19, 0x91, 0xD7, 0xF0,
-    0xEA, 0x20, 0x9D, 0x2B, 0x88, 0x6A, 0xF0, 0xF8, 0xEB, 0x7A, 0x4B, 0x7B, 0x3E, 0xF8, 0x4D, 0x0E,
-    0x66, 0xF7, 0x96, 0xF6, 0x76, 0xD5, 0xEB, 0xD1, 0xDF, 0x4B, 0xE6, 0x3E, 0x24, 0x2F, 0xB3, 0xB4,
-    0xE0, 0x20, 0x87, 0x65, 0xB3, 0x12, 0x8B, 0x53, 0xC3, 0xE6, 0x72, 0xDB, 0x5D, 0xFE, 0x7F, 0xED,
-    0x5C, 0x3F, 0x8C, 0x1C, 0x69, 0x56, 0xFF, 0xAA, 0x6A, 0xED, 0xBA, 0x73, 0x71, 0x2E, 0x0B, 0xF9,
-    0xD0, 0xB2, 0x73, 0xEB, 0x22, 0xB8, 0x60, 0xF1, 0x7A, 0xB6, 0x12, 0x04, 0x16, 0x1A, 0xBB, 0xEA,
-    0x74, 0x01, 0x01, 0x89, 0x83, 0x33, 0x09, 0x81, 0x13, 0x02, 0x4E, 0x48, 0x67, 0x82, 0x0D, 0x1C,
-    0x8C, 0xDD, 0x05, 0x04, 0x84, 0x37, 0x12, 0xE8, 0x90, 0x20, 0x71, 0xE0, 0x60, 0xB1, 0x03, 0x5F,
-    0x60, 0xA4, 0x3D, 0xC9, 0xD3, 0x55, 0xB7, 0x1B, 0x6C, 0x48, 0xDD, 0xA2, 0x25, 0x41, 0x62, 0xEB,
-    0x8E, 0x5D, 0x81, 0xBC, 0x42, 0x5B, 0x48, 0x6D, 0x5D, 0x7B, 0xE8, 0xEE, 0x8F, 0xF7, 0xFB, 0xBD,
-    0xEF, 0xAB, 0xEA, 0x9E, 0xF1, 0x1E, 0x20, 0xE1, 0x61, 0x7C, 0xD0, 0x63, 0x57, 0xD5, 0x74, 0xD7,
-    0x9F, 0xF7, 0xFD, 0xBE, 0xF7, 0xDE, 0xF7, 0x7E, 0xEF, 0xBD, 0x1E, 0x63, 0xF0, 0xBA, 0xCB, 0x6D,
-    0xB8, 0x30, 0x66, 0xCB, 0x76, 0xD8, 0xD9, 0xCF, 0x96, 0x66, 0x61, 0xE2, 0xB9, 0x99, 0x54, 0x33,
-    0x93, 0x37, 0x26, 0xFD, 0xB0, 0x33, 0x13, 0x63, 0x12, 0x5B, 0x9A, 0xA5, 0x31, 0xF1, 0xCC, 0x44,
-    0x72, 0x52, 0x34, 0xC3, 0x91, 0x89, 0xE6, 0x26, 0xED, 0x75, 0xD7, 0x71, 0x27, 0xE7, 0x63, 0x57,
-    0x34, 0x3C, 0xB3, 0xA8, 0x86, 0x5D, 0xD2, 0x9B, 0xA2, 0x34, 0x38, 0x6D, 0x22, 0xBB, 0xAC, 0xE5,
-    0x6F, 0x72, 0x1A, 0x76, 0xF2, 0x0E, 0x4E, 0x59, 0xC9, 0xFB, 0x0D, 0x25, 0x91, 0xB3, 0x92, 0x9E,
-    0x0F, 0xC1, 0xFD, 0x02, 0xFB, 0x97, 0x2B, 0xC8, 0x98, 0xDB, 0x4F, 0x28, 0xEB, 0xB7, 0x8C, 0x7B,
-    0xA5, 0x15, 0xDF, 0x6E, 0xB0, 0x95, 0x2B, 0x63, 0xDB, 0xA5, 0x72, 0xC3, 0xCF, 0x16, 0x29, 0x24,
-    0x9D, 0x6E, 0xE3, 0xFA, 0x42, 0xEE, 0xD4, 0xE1, 0xEE, 0xF8, 0xA4, 0xC2, 0xB9, 0xB2, 0x75, 0xFF,
-    0xF8, 0x54, 0x19, 0x99, 0x1C, 0xD4, 0x06, 0x07, 0xB5, 0xFF, 0xB7, 0xC4, 0xAF, 0x81, 0x08, 0x52,
-    0x98, 0x48, 0xE4, 0xC8, 0xAB, 0xB4, 0x95, 0xA7, 0x3D, 0xAD, 0x45, 0xD6, 0xD0, 0xCE, 0xF1, 0xB8,
-    0x53, 0x5E, 0x06, 0x73, 0xBA, 0x52, 0x59, 0xBA, 0x89, 0xED, 0x43, 0x9B, 0x76, 0x37, 0xED, 0xDD,
-    0xB0, 0x8E, 0x3B, 0x80, 0x94, 0xC5, 0x8D, 0x60, 0x61, 0x2E, 0xA4, 0xA5, 0x48, 0x62, 0xDE, 0x7A,
-    0x6C, 0x62, 0xB9, 0x59, 0xB1, 0xC7, 0xB1, 0xED, 0x18, 0x08, 0x86, 0x1D, 0xEE, 0x7D, 0xCB, 0x40,
-    0x40, 0xF3, 0x88, 0xE3, 0x30, 0xBD, 0x0E, 0x0A, 0x27, 0x57, 0x26, 0xE8, 0x29, 0x61, 0xD0, 0x41,
-    0x1A, 0x13, 0xB6, 0x94, 0x34, 0x92, 0x8F, 0xA7, 0xC3, 0x2E, 0xAE, 0x28, 0x72, 0x52, 0xF2, 0xB7,
-    0xD4, 0xF0, 0x94, 0x2B, 0x06, 0x97, 0x63, 0x10, 0x26, 0x5D, 0x3D, 0xEC, 0x30, 0xC7, 0x56, 0xA6,
-    0x10, 0xB2, 0x97, 0x5E, 0xF6, 0x60, 0x86, 0x2D, 0x44, 0x85, 0x06, 0x14, 0x4B, 0x91, 0x65, 0xFE,
-    0xE6, 0x42, 0x44, 0xE9, 0x65, 0x16, 0xB2, 0xF7, 0xDB, 0x50, 0x26, 0x74, 0x65, 0x42, 0x99, 0x86,
-    0x3D, 0x00, 0x21, 0xCF, 0xD7, 0xAD, 0x8C, 0x63, 0x42, 0xF9, 0xA7, 0x14, 0x7F, 0x49, 0xE9, 0x31,
-    0x6F, 0x0D, 0x66, 0x2F, 0xAB, 0xE2, 0x05, 0x40, 0x3B, 0x3B, 0xC7, 0xF6, 0xD7, 0xB1, 0x6D, 0x7E,
-    0xB2, 0x38, 0x67, 0x32, 0xFB, 0x43, 0xDB, 0x9B, 0x64, 0x65, 0x6A, 0x91, 0xF7, 0x9A, 0x79, 0xC5,
-    0x8C, 0xAF, 0x3D, 0xF9, 0xDD, 0xBF, 0x1E, 0xC5, 0xCD, 0x70, 0x7C, 0x25, 0x1F, 0xCF, 0xC9, 0x97,
-    0xE3, 0x71, 0x36, 0x1B, 0x8F, 0x01, 0xE3, 0x17, 0xBD, 0x72, 0x6B, 0xEF, 0xC9, 0xD9, 0xD6, 0xCA,
-    0x83, 0xDF, 0xB4, 0x18, 0x7F, 0xCE, 0x63, 0x11, 0x39, 0xEF, 0x30, 0x12, 0x28, 0xEA, 0x02, 0x3A,
-    0x2A, 0x13, 0x21, 0xD3, 0x2B, 0x70, 0xC9, 0xBF, 0x5B, 0x26, 0x58, 0xA9, 0x49, 0xAC, 0xCC, 0xF7,
-    0x61, 0x09, 0x50, 0x69, 0xE8, 0x85, 0x2A, 0xFB, 0x4C, 0x8F, 0xA9, 0xE3, 0xBD, 0x1E, 0x43, 0x33,
-    0xDC, 0x71, 0xB8, 0x72, 0x32, 0xC9, 0x31, 0x2E, 0xE5, 0xFC, 0xD6, 0x7A, 0x29, 0x8F, 0xAD, 0x5E,
-    0xCA, 0x99, 0x5E, 0xE9, 0xA5, 0x98, 0xEE, 0x60, 0x69, 0x42, 0x8E, 0x30, 0xAF, 0xF0, 0x68, 0x5E,
-    0x8A, 0x89, 0x77, 0x26, 0xC6, 0xD9, 0x87, 0x11, 0x11, 0x1C, 0x41, 0x3F, 0xEB, 0x70, 0xA7, 0xAF,
-    0xF0, 0xDE, 0x45, 0x83, 0x4B, 0xB7, 0x71, 0xBF, 0xC0, 0xF2, 0xD2, 0x1D, 0xDC, 0x6F, 0x4B, 0x2F,
-    0x7D, 0x2C, 0x96, 0xFD, 0xC0, 0x8A, 0xC5, 0x1D, 0xDC, 0x7F, 0x30, 0x37, 0xB5, 0x85, 0x06, 0x4F,
-    0x04, 0x86, 0x11, 0xC3, 0xF3, 0xE6, 0x55, 0x7F, 0x78, 0xC1, 0xCC, 0x1D, 0x6A, 0x26, 0xFD, 0xD3,
-    0xCE, 0x81, 0x26, 0xA6, 0x55, 0x39, 0xCC, 0x4C, 0x84, 0xF1, 0x11, 0x32, 0x13, 0xC8, 0x8D, 0x14,
-    0xB1, 0xC1, 0x87, 0xAC, 0xF4, 0x50, 0xF1, 0x2A, 0xAC, 0x5C, 0xA6, 0x70, 0xF1, 0x50, 0x11, 0xDA,
-    0x25, 0x32, 0x3C, 0xFC, 0x3E, 0x2E, 0x55, 0xAC, 0x5A, 0x9C, 0xE7, 0xA1, 0xEA, 0x06, 0xA4, 0x04,
-    0x8C, 0x01, 0xA8, 0x01, 0x27, 0x3E, 0x50, 0x61, 0xC2, 0x55, 0x1E, 0xA5, 0x6E, 0x00, 0x89, 0x2E,
-    0x41, 0x31, 0x9A, 0xC0, 0x54, 0x09, 0x91, 0xC8, 0x7F, 0xD6, 0x21, 0x24, 0x57, 0x6D, 0x3B, 0x80,
-    0xE4, 0xE9, 0xBB, 0x0E, 0x1F, 0x51, 0x93, 0x85, 0x83, 0xA7, 0xB0, 0x6A, 0xE6, 0xD7, 0xAF, 0x99,
-    0x50, 0x7E, 0xE4, 0x25, 0x4A, 0x13, 0x35, 0xD4, 0xC6, 0xAC, 0x37, 0x61, 0xCF, 0x21, 0x63, 0x10,
-    0xB6, 0xF7, 0x3A, 0x58, 0x73, 0x66, 0x92, 0x96, 0xF2, 0x18, 0x35, 0x68, 0xE7, 0xA7, 0xDC, 0x51,
-    0x68, 0x3F, 0xAF, 0x12, 0xAA, 0x5F, 0xFE, 0x91, 0xAD, 0x52, 0x6B, 0x3B, 0x18, 0x6C, 0x51, 0x66,
-    0x10, 0x58, 0x6C, 0xAD, 0x30, 0x97, 0x20, 0x35, 0xAD, 0xEB, 0x0D, 0x5A, 0x55, 0x4B, 0x2B, 0x9F,
-    0x13, 0x83, 0x25, 0x87, 0x86, 0x71, 0x2F, 0x14, 0x13, 0x79, 0xCC, 0x42, 0x1F, 0xA6, 0xCE, 0x6A,
-    0xC5, 0x41, 0xCB, 0xD9, 0x21, 0x64, 0xAF, 0xE9, 0xA3, 0x7B, 0x1E, 0xC9, 0x75, 0x72, 0x41, 0x29,
-    0x9F, 0x6E, 0xC1, 0x0D, 0x47, 0x70, 0x7B, 0xBF, 0xD1, 0xCB, 0x05, 0xB1, 0xF8, 0xC0, 0x3F, 0xFA,
-    0xA7, 0xFE, 0x17, 0xC5, 0xDA, 0x61, 0x2C, 0x7F, 0x62, 0x7F, 0x2A, 0xF3, 0x2D, 0xCF, 0x59, 0x85,
-    0xF6, 0xB7, 0xAD, 0xC5, 0x0D, 0xAF, 0x99, 0x73, 0x83, 0x2D, 0xC1, 0xC2, 0xED, 0x52, 0x74, 0xE2,
-    0x13, 0x2C, 0x07, 0x73, 0x37, 0xDB, 0x50, 0x60, 0xC2, 0x51, 0x1B, 0xA7, 0x0A, 0xCE, 0x78, 0xE8,
-    0x94, 0x22, 0xE2, 0xA8, 0x2B, 0x86, 0x7E, 0x4E, 0x99, 0x20, 0x22, 0x0F, 0xF0, 0x36, 0x2D, 0xD8,
-    0xCF, 0x3F, 0xDF, 0xE6, 0x01, 0x46, 0x8B, 0x71, 0xF2, 0x73, 0x4E, 0x29, 0xDE, 0x86, 0x46, 0x10,
-    0x51, 0xA2, 0x4C, 0x1C, 0x8C, 0x4C, 0x2C, 0x3E, 0x17, 0xEC, 0x5E, 0xE7, 0x4A, 0x52, 0xC3, 0x00,
-    0xF0, 0xB9, 0x48, 0xB2, 0x8B, 0xCF, 0x65, 0xAE, 0x45, 0x06, 0xF9, 0x7C, 0x6B, 0x75, 0xFF, 0xE1,
-    0x1C, 0xA0, 0xD6, 0x34, 0x80, 0xC1, 0xA5, 0xF8, 0x03, 0xAF, 0xCB, 0x8A, 0xA1, 0x71, 0x72, 0x19,
-    0x3F, 0xDB, 0xC6, 0x2D, 0x35, 0x7C, 0xFD, 0xA6, 0x75, 0x6F, 0x14, 0x6B, 0xDE, 0xC8, 0xA3, 0xB5,
-    0x50, 0xBC, 0x04, 0x07, 0xC2, 0x35, 0xD8, 0xC6, 0x23, 0x07, 0x96, 0xD9, 0x30, 0x1B, 0x6F, 0x33,
-    0x54, 0x33, 0xDC, 0xED, 0x61, 0xAF, 0xCF, 0x93, 0xA1, 0xEB, 0xBE, 0x55, 0x94, 0x64, 0xE0, 0xC4,
-    0xC6, 0xEF, 0x45, 0x16, 0x8A, 0x93, 0x57, 0x8A, 0x90, 0x0C, 0x9A, 0x00, 0x15, 0x0E, 0x9F, 0xC2,
-    0xC1, 0x73, 0xC7, 0xA1, 0x33, 0x75, 0xE0, 0x2C, 0x1D, 0x36, 0x0B, 0x07, 0xCD, 0x42, 0x91, 0x09,
-    0xE6, 0x0A, 0x4C, 0xE8, 0x46, 0x14, 0xF5, 0x9B, 0xFB, 0xD8, 0xF9, 0x5A, 0x68, 0xF9, 0xBA, 0x66,
-    0xAB, 0xC6, 0x9B, 0x8B, 0x0E, 0x46, 0xF8, 0x89, 0x53, 0xD7, 0x4D, 0x20, 0x18, 0x88, 0x98, 0xE2,
-    0x4C, 0xC5, 0x36, 0xB1, 0xB8, 0xC0, 0x6F, 0x50, 0x7D, 0xE9, 0x3A, 0x14, 0xE3, 0x68, 0x16, 0xDB,
-    0x32, 0xEA, 0x4F, 0x5B, 0x3C, 0x64, 0x82, 0x27, 0x4C, 0x70, 0xFB, 0x29, 0xEE, 0xBD, 0xD4, 0x75,
-    0x25, 0xC3, 0x26, 0xAF, 0xE4, 0x9A, 0xBC, 0xA4, 0x99, 0x60, 0x61, 0x77, 0xA7, 0xF7, 0x32, 0xB4,
-    0x18, 0x0B, 0x11, 0xAE, 0x79, 0x45, 0x4E, 0x9F, 0x2C, 0x65, 0x93, 0x77, 0x72, 0x4D, 0xE0, 0xA0,
-    0x70, 0x38, 0x18, 0x80, 0xA0, 0xE8, 0xF3, 0xC1, 0x58, 0x13, 0x83, 0x55, 0xE9, 0x56, 0x96, 0xDA,
-    0xFE, 0x16, 0x34, 0xFF, 0x4D, 0xF9, 0xFF, 0x70, 0x75, 0xDA, 0x1E, 0x60, 0x2E, 0x4A, 0x13, 0xB7,
-    0xEA, 0x70, 0x6D, 0x03, 0xC1, 0x71, 0xA7, 0x40, 0x1C, 0x85, 0x2C, 0xB4, 0xB8, 0x5F, 0xF8, 0x71,
-    0x67, 0x52, 0x18, 0x95, 0x0C, 0xE2, 0x83, 0x1E, 0xEB, 0x2E, 0x5C, 0x54, 0xF4, 0xFE, 0x1C, 0x87,
-    0x98, 0xEC, 0xF8, 0xBD, 0x85, 0xF8, 0x53, 0xEA, 0x56, 0x5C, 0x2D, 0xE1, 0x9F, 0xF1, 0xF0, 0xA4,
-    0xAC, 0xE1, 0x9E, 0xB9, 0x30, 0x4B, 0xE8, 0xB3, 0xA3, 0xD2, 0xA4, 0xF2, 0xA0, 0x1D, 0xD5, 0x81,
-    0x0B, 0x32, 0xE0, 0x5B, 0xAA, 0x06, 0x6F, 0x09, 0x72, 0x8F, 0x54, 0x03, 0xB6, 0xC5, 0x1E, 0x9C,
-    0x52, 0xE0, 0xBC, 0x5E, 0xF5, 0x41, 0xAE, 0x5E, 0x76, 0xAA, 0x0A, 0x12, 0x43, 0x88, 0x43, 0xE1,
-    0x8C, 0x88, 0x92, 0xC1, 0x9F, 0xE1, 0x50, 0xCE, 0x9F, 0x34, 0x1A, 0x46, 0xF5, 0x1A, 0x70, 0x09,
-    0x26, 0x5B, 0xCB, 0x52, 0x56, 0x69, 0x8E, 0xA7, 0x96, 0xA1, 0xA5, 0x3A, 0x1E, 0xF7, 0x9A, 0x8C,
-    0x87, 0xD3, 0xF1, 0x70, 0x5C, 0x7C, 0x07, 0x13, 0x59, 0xB3, 0x0D, 0x35, 0x56, 0x7D, 0xBD, 0x56,
-    0x57, 0xC3, 0x32, 0xFD, 0x6C, 0x7D, 0x31, 0x3E, 0x3F, 0xDE, 0x56, 0x11, 0x2F, 0xAD, 0xC3, 0x1B,
-    0x9E, 0x5E, 0xD1, 0xFE, 0x7D, 0x8F, 0xF5, 0x80, 0xF4, 0x80, 0xB3, 0x47, 0xB9, 0x98, 0x3B, 0x8C,
-    0xF3, 0x99, 0x43, 0x18, 0x8E, 0x8E, 0xF8, 0x8A, 0x4A, 0x28, 0xBA, 0x71, 0xEF, 0xB0, 0x15, 0xD5,
-    0x50, 0x64, 0x45, 0x3D, 0x14, 0x57, 0x01, 0x48, 0x51, 0x95, 0x03, 0xC5, 0x54, 0x70, 0x52, 0x44,
-    0x45, 0x5D, 0x14, 0xCF, 0xBC, 0x74, 0x68, 0x16, 0x1E, 0xCB, 0xC2, 0x23, 0x39, 0xF1, 0x38, 0x4E,
-    0x3D, 0x8A, 0x4B, 0x8F, 0xE1, 0x80, 0x8B, 0x3F, 0x08, 0xBC, 0x0F, 0xF1, 0xE6, 0x34, 0xD8, 0xD1,
-    0x18, 0xB4, 0x78, 0x67, 0x72, 0xA6, 0xF6, 0x8B, 0xC5, 0x80, 0xA9, 0x0F, 0x90, 0xFC, 0xDC, 0x4C,
-    0xCA, 0xCD, 0xFD, 0xF6, 0x17, 0x86, 0x3D, 0xC5, 0x22, 0x11, 0x83, 0x11, 0xD7, 0xB3, 0x28, 0xAC,
-    0xD9, 0x5A, 0x88, 0x8B, 0xE9, 0x8B, 0x52, 0xFC, 0x4C, 0x78, 0x50, 0x15, 0xB0, 0xA0, 0xD0, 0xCA,
-    0xDC, 0x87, 0x8C, 0xE4, 0x69, 0x47, 0xD1, 0x5C, 0xF7, 0x6A, 0x4D, 0xBD, 0x46, 0x76, 0x49, 0xA7,
-    0xB1, 0x9D, 0x6C, 0x68, 0x85, 0x70, 0x39, 0x4D, 0xC0, 0x7D, 0x06, 0x5B, 0x94, 0xA1, 0xE7, 0x15,
-    0x22, 0x44, 0x28, 0x12, 0xCC, 0x12, 0x5A, 0x14, 0xCE, 0xCF, 0xD1, 0xE5, 0x04, 0xB6, 0x9F, 0xD0,
-    0xE0, 0xEA, 0xE6, 0x8E, 0x1B, 0xCC, 0xFE, 0x21, 0x74, 0x16, 0x9B, 0x8E, 0xD6, 0x43, 0xE3, 0x5C,
-    0xCB, 0x69, 0xA7, 0x45, 0x89, 0x53, 0xA1, 0xA0, 0x0C, 0xA8, 0x14, 0x5D, 0xC2, 0xF7, 0xE7, 0x7A,
-    0xD7, 0x89, 0x5E, 0x5C, 0xF4, 0x1B, 0x58, 0xAE, 0xBF, 0x34, 0xC4, 0x75, 0xCB, 0x90, 0x49, 0x74,
-    0x97, 0xEA, 0xB3, 0xAF, 0xE8, 0xEE, 0x96, 0xEE, 0x7A, 0xAA, 0x78, 0xD8, 0x71, 0x17, 0x35, 0xD4,
-    0x7D, 0x68, 0x13, 0x6E, 0xAC, 0x46, 0x71, 0x45, 0xA7, 0xE2, 0x96, 0xEE, 0x94, 0xD0, 0x84, 0x07,
-    0xF7, 0x21, 0x69, 0x64, 0x11, 0xE0, 0x40, 0x0B, 0x60, 0x6A, 0x99, 0xCA, 0xB2, 0xA3, 0x0E, 0xF2,
-    0x5D, 0x5D, 0xB8, 0x74, 0x59, 0xC3, 0x30, 0xC5, 0x1B, 0xDE, 0x78, 0x66, 0x82, 0xFA, 0x99, 0x91,
-    0xE0, 0x2A, 0xE6, 0x32, 0xFB, 0x75, 0x58, 0xC7, 0x15, 0xA8, 0x56, 0x9A, 0x34, 0x58, 0x66, 0x11,
-    0x74, 0x2D, 0x47, 0xC1, 0xBD, 0x22, 0xD9, 0x0F, 0x2B, 0x06, 0x0F, 0x8C, 0x1B, 0xE8, 0x0B, 0x19,
-    0x2D, 0x30, 0x50, 0x60, 0x8C, 0xC0, 0xF0, 0x80, 0x91, 0x01, 0x83, 0x02, 0xC6, 0x03, 0x0C, 0x05,
-    0x18, 0x05, 0x30, 0x00, 0xE0, 0xDA, 0x8F, 0x65, 0xFF, 0x1C, 0x56, 0xFC, 0x3E, 0x59, 0x86, 0xF2,
-    0x34, 0x5D, 0xE7, 0x7F, 0x45, 0x7E, 0xCC, 0x4E, 0x88, 0x30, 0x23, 0xA5, 0x18, 0xC0, 0x60, 0xB1,
-    0x69, 0xE9, 0x3E, 0x14, 0xE0, 0xBA, 0xA6, 0x8B, 0xDA, 0xC2, 0xBB, 0x05, 0xF5, 0xE8, 0x73, 0x7F,
-    0x01, 0xBD, 0x95, 0x5F, 0xC7, 0xDC, 0xAA, 0xEE, 0x97, 0x2D, 0xB7, 0xA4, 0x1F, 0x72, 0xD1, 0x13,
-    0x17, 0x48, 0xE8, 0x8D, 0x11, 0x86, 0x4B, 0x70, 0xB6, 0x07, 0x67, 0xD1, 0xAB, 0x0E, 0x04, 0x9D,
-    0x60, 0x3C, 0xBF, 0xAD, 0x53, 0x5F, 0x74, 0xEE, 0x06, 0xFA, 0xAA, 0xE5, 0x9C, 0x9B, 0xBD, 0xFA,
-    0x22, 0x3C, 0x10, 0xAA, 0xC4, 0x61, 0x34, 0xFA, 0x44, 0x9C, 0x4A, 0xDA, 0xE9, 0x9E, 0x36, 0x71,
-    0x6B, 0x02, 0xA6, 0x7A, 0x2A, 0xD6, 0x36, 0x59, 0xEA, 0xD2, 0x15, 0xE8, 0xED, 0x08, 0x86, 0xA0,
-    0x01, 0xD1, 0x73, 0x72, 0x4D, 0xE2, 0xA1, 0x80, 0x8C, 0xE1, 0x80, 0x7F, 0x6D, 0x21, 0x9C, 0x23,
-    0x7B, 0x56, 0xF2, 0x4C, 0xEE, 0xDC, 0x92, 0x28, 0xF5, 0x64, 0xCE, 0xBD, 0x12, 0x67, 0xE5, 0xCD,
-    0x4A, 0x9B, 0x95, 0x35, 0x2B, 0x69, 0x56, 0xCE, 0xAC, 0x94, 0x59, 0x19, 0xB3, 0x12, 0x66, 0xE5,
-    0xCB, 0x4A, 0x97, 0x95, 0x2D, 0x2B, 0x59, 0x56, 0xAE, 0xAC, 0x54, 0x59, 0x99, 0xB2, 0x23, 0xCA,
-    0x8E, 0x27, 0x7F, 0xCB, 0x0D, 0xC2, 0x2B, 0x56, 0x96, 0xF8, 0x19, 0x55, 0xC5, 0xDA, 0x98, 0xD1,
-    0x18, 0xC2, 0x0B, 0x75, 0x86, 0xA3, 0x9F, 0xEA, 0xFA, 0x0A, 0xDE, 0x5C, 0x92, 0x36, 0x93, 0x35,
-    0x93, 0x34, 0x93, 0x33, 0x93, 0x32, 0x93, 0x31, 0x93, 0x2D, 0x93, 0x2F, 0x53, 0xD9, 0x24, 0xB2,
-    0x44, 0xEC, 0x0D, 0x87, 0x01, 0xAE, 0xAC, 0x54, 0x59, 0x99, 0x72, 0x58, 0x06, 0x30, 0x96, 0x36,
-    0xC3, 0x4C, 0xCF, 0xE8, 0x0A, 0x6A, 0x0A, 0x50, 0xB4, 0xC6, 0x6C, 0x4C, 0x22, 0xB5, 0x00, 0x54,
-    0x7A, 0x49, 0x26, 0x3D, 0x27, 0x91, 0x2E, 0xC9, 0xA3, 0x29, 0xF3, 0x36, 0x91, 0xDF, 0x71, 0x24,
-    0x5A, 0x39, 0xB4, 0x52, 0x68, 0x65, 0xD0, 0x4A, 0xA0, 0x95, 0x3F, 0x2B, 0x7D, 0x56, 0xF6, 0xAC,
-    0xE4, 0x59, 0xB9, 0xF3, 0xD4, 0x6F, 0xE3, 0xCA, 0x11, 0x67, 0xE5, 0xCD, 0x4A, 0x9B, 0x95, 0x35,
-    0x2B, 0x69, 0x76, 0x9C, 0xD9, 0x51, 0x66, 0xF2, 0xA4, 0x0B, 0x34, 0x68, 0xE1, 0x46, 0xCA, 0x8A,
-    0x22, 0xBB, 0xB9, 0x26, 0xCA, 0xF5, 0xF0, 0x99, 0xA4, 0xD1, 0x60, 0xD1, 0x0D, 0x5D, 0x24, 0x38,
-    0x74, 0x49, 0xF2, 0xCC, 0x0D, 0x8D, 0x96, 0x5E, 0x56, 0x5D, 0xAC, 0xFA, 0x57, 0x9C, 0x0E, 0xEE,
-    0x4C, 0xEA, 0x4C, 0xE6, 0x4C, 0xE2, 0x4C, 0xDE, 0xAC, 0xB4, 0x59, 0x59, 0xF3, 0x57, 0xAF, 0x63,
-    0x6E, 0x0B, 0xC2, 0x7B, 0xF1, 0xFE, 0xBD, 0xE1, 0xC1, 0x6F, 0x04, 0x7B, 0xD0, 0x64, 0x6A, 0xE6,
-    0x8A, 0xDB, 0xDD, 0xA8, 0x7D, 0x19, 0x80, 0x0D, 0xAC, 0xAC, 0xA0, 0x21, 0x36, 0xE3, 0x2B, 0xEA,
-    0x72, 0xD8, 0x8C, 0x3C, 0x43, 0x36, 0x72, 0x4A, 0xF5, 0xE5, 0xE3, 0x84, 0xD8, 0x04, 0xEF, 0x8C,
-    0x01, 0x8E, 0x2E, 0x49, 0x54, 0x5D, 0xF8, 0x74, 0x59, 0xCC, 0xAE, 0xE1, 0xF8, 0x0E, 0x97, 0xAC,
-    0x9A, 0x5B, 0x3D, 0x3E, 0x6F, 0xCA, 0x13, 0xAE, 0xC1, 0xCE, 0x7F, 0x37, 0xDE, 0xD5, 0xD2, 0xB7,
-    0x77, 0x46, 0x93, 0x47, 0x61, 0x7B, 0xC1, 0x28, 0xDA, 0x09, 0x36, 0x51, 0xFB, 0xD6, 0x71, 0x42,
-    0xFE, 0x25, 0x26, 0x21, 0x52, 0x58, 0x97, 0x89, 0x3F, 0x20, 0x25, 0xB4, 0x95, 0x5F, 0x04, 0xE4,
-    0x8C, 0x97, 0x1A, 0xF2, 0x0E, 0x89, 0xBB, 0xC7, 0x50, 0xA1, 0x62, 0xDF, 0xE7, 0xAF, 0xCE, 0xEC,
-    0x8D, 0x90, 0x97, 0xBA, 0x39, 0x66, 0xC8, 0x5F, 0x2B, 0xC7, 0xB0, 0x49, 0x95, 0x3C, 0xD4, 0x55,
-    0xED, 0x11, 0x21, 0x3F, 0xFF, 0x32, 0x43, 0xAE, 0x2E, 0x79, 0x7F, 0x08, 0xA0, 0x95, 0x41, 0x80,
-    0x07, 0x75, 0x67, 0x10, 0x6D, 0x02, 0x6D, 0x6C, 0xC2, 0x2E, 0x3B, 0x56, 0xC7, 0x62, 0x90, 0x52,
-    0x85, 0xC3, 0x8B, 0xDA, 0xAC, 0x8F, 0x08, 0x15, 0xA2, 0x26, 0x64, 0x01, 0x02, 0x4D, 0x18, 0x6C,
-    0x49, 0x74, 0x65, 0xFF, 0x62, 0x1E, 0xCF, 0xA2, 0x59, 0xD6, 0x8A, 0x5A, 0x54, 0x69, 0x57, 0x88,
-    0x2C, 0x13, 0x01, 0xA8, 0x40, 0xDC, 0xF7, 0xF7, 0x33, 0x59, 0xC6, 0x99, 0x42, 0x65, 0x36, 0x97,
-    0x8B, 0x01, 0x23, 0x32, 0x59, 0x0C, 0xDE, 0x19, 0x46, 0xF2, 0xCB, 0x06, 0x8B, 0x41, 0x41, 0x0F,
-    0x36, 0xE1, 0xF6, 0x6A, 0xD8, 0x3F, 0x37, 0x38, 0xD6, 0x10, 0x53, 0x43, 0x63, 0x8D, 0x8C, 0x35,
-    0x30, 0xD6, 0xB8, 0x98, 0x61, 0xB1, 0x46, 0xC5, 0x1A, 0x14, 0x6B, 0x4C, 0xAC, 0x21, 0xB1, 0x46,
-    0xC4, 0x1A, 0x10, 0x73, 0x02, 0x35, 0x1C, 0xD6, 0x68, 0x58, 0x83, 0x61, 0x8D, 0x85, 0x35, 0x14,
-    0xD6, 0x48, 0x98, 0x81, 0xB0, 0xC6, 0xC1, 0x1A, 0x06, 0xBB, 0x28, 0x38, 0x64, 0xBA, 0x90, 0x71,
-    0xF4, 0x18, 0x97, 0xB4, 0x57, 0x11, 0xCB, 0x4D, 0xDC, 0x26, 0x2C, 0x5F, 0x3D, 0xCE, 0x70, 0xD8,
-    0x81, 0x8B, 0xA4, 0x97, 0x18, 0xCB, 0x1A, 0xB8, 0x2E, 0xCD, 0xB3, 0x38, 0xB2, 0x3D, 0x77, 0x82,
-    0xC1, 0x6D, 0x0E, 0x83, 0x6B, 0xCE, 0x0C, 0xB1, 0x17, 0x42, 0x4A, 0x93, 0x99, 0x63, 0x05, 0x77,
-    0x23, 0x2E, 0x99, 0x0D, 0x1E, 0xE5, 0xF9, 0x94, 0x56, 0xE4, 0x67, 0xE6, 0xD4, 0x84, 0xB5, 0x3B,
-    0x30, 0x3B, 0x4B, 0x5D, 0xBA, 0xCC, 0xDF, 0x2C, 0x58, 0x17, 0x31, 0xE6, 0xDF, 0xDC, 0x41, 0xF4,
-    0x9E, 0x70, 0x5C, 0x66, 0x0E, 0xBF, 0xE9, 0xEE, 0x7B, 0xC1, 0x87, 0xBB, 0x3B, 0x3E, 0x6E, 0x9F,
-    0xB9, 0x8C, 0x45, 0xD8, 0xA5, 0x9F, 0x5E, 0x87, 0x6F, 0x88, 0x9B, 0xD4, 0x5A, 0x32, 0x14, 0x93,
-    0x7E, 0xC4, 0x77, 0xAE, 0x78, 0x46, 0x39, 0xBD, 0xAF, 0xC9, 0xDD, 0xC0, 0x3A, 0x00, 0xA3, 0xC6,
-    0xA5, 0xBC, 0x12, 0x9F, 0x3A, 0xC9, 0x5C, 0x82, 0x0D, 0x93, 0x21, 0x13, 0x79, 0x49, 0x1E, 0xC0,
-    0xA4, 0xC9, 0x0E, 0x5C, 0x2A, 0x72, 0x6C, 0x73, 0x70, 0x3E, 0x24, 0xD9, 0x66, 0x60, 0x7D, 0xC3,
-    0x20, 0x5C, 0xB0, 0xA3, 0xEE, 0x2B, 0xB6, 0xF6, 0xC8, 0xC0, 0x63, 0xDB, 0x66, 0xB2, 0x02, 0x16,
-    0xDF, 0x7B, 0xB6, 0x9C, 0x00, 0xF4, 0xA2, 0x97, 0xF9, 0x15, 0xF6, 0x2D, 0x61, 0x36, 0x6B, 0x6A,
-    0x69, 0x4B, 0x92, 0x91, 0x35, 0xA2, 0x0E, 0x2B, 0x8D, 0xD3, 0x97, 0xB2, 0x64, 0x16, 0x65, 0xB0,
-    0xBC, 0x31, 0x93, 0x0F, 0xE8, 0x19, 0x65, 0x6A, 0x9E, 0x95, 0xCC, 0x09, 0x6B, 0x6A, 0x98, 0xD5,
-    0x85, 0x89, 0x2A, 0x64, 0x61, 0x5E, 0x5F, 0x98, 0x2F, 0x0B, 0xB9, 0x78, 0xDB, 0x8A, 0xB4, 0x99,
-    0xED, 0x10, 0x58, 0xC6, 0xB6, 0x4C, 0x00, 0xC6, 0xB9, 0xB5, 0xB4, 0x8D, 0x90, 0x72, 0x1A, 0x42,
-    0xFD, 0x19, 0x52, 0x34, 0x0B, 0xB0, 0xEE, 0xAC, 0x45, 0x85, 0x41, 0x18, 0x4A, 0x82, 0x6C, 0xB2,
-    0xB8, 0x69, 0xAD, 0x25, 0xC5, 0x04, 0x5B, 0xCB, 0x16, 0x59, 0x3B, 0x16, 0xE9, 0xB4, 0x78, 0x41,
-    0x5D, 0x63, 0x35, 0xCE, 0xC2, 0x01, 0x0B, 0xBF, 0x93, 0x1B, 0x50, 0x64, 0x25, 0x11, 0xE6, 0xC1,
-    0x4A, 0x46, 0x01, 0x17, 0x29, 0x57, 0xC9, 0xBC, 0xC9, 0x7D, 0x90, 0x9B, 0x58, 0x40, 0xFD, 0x02,
-    0xFB, 0x04, 0x2C, 0x2F, 0xB3, 0x4C, 0xDC, 0x7D, 0xD5, 0x9B, 0x5A, 0xE9, 0x9F, 0x97, 0xD9, 0x89,
-    0x6C, 0xA7, 0x37, 0xBA, 0xD6, 0x84, 0x33, 0x98, 0x41, 0xDC, 0xD1, 0x18, 0x9A, 0x71, 0x2B, 0x6E,
-    0xBA, 0xC3, 0x16, 0x0B, 0x5E, 0x56, 0x65, 0x60, 0xED, 0x2D, 0x73, 0x78, 0x8C, 0xA7, 0xC3, 0x27,
-    0xE5, 0x60, 0x09, 0x8C, 0xF5, 0xCC, 0x1D, 0xDE, 0xBC, 0x20, 0xA9, 0xCA, 0x38, 0x41, 0xD3, 0x5A,
-    0xB4, 0x40, 0x2E, 0x17, 0xF1, 0x72, 0x9A, 0xDE, 0x55, 0xF9, 0x78, 0x25, 0xDB, 0x8B, 0x0F, 0xFF,
-    0x05, 0xEA, 0x90, 0x31, 0x09, 0x3B, 0xE5, 0xDA, 0x84, 0x32, 0x49, 0xBD, 0x5A, 0xA3, 0x0F, 0xCA,
-    0x1F, 0x94, 0x40, 0x28, 0x83, 0x50, 0x0A, 0xB1, 0xC9, 0x21, 0x8E, 0x11, 0x6D, 0x59, 0x71, 0xE4,
-    0xD3, 0x90, 0xB5, 0xDB, 0xFF, 0x0A, 0xDA, 0x15, 0x17, 0x96, 0x9E, 0x55, 0xBA, 0xDD, 0x5C, 0xD3,
-    0x4D, 0xAE, 0x2E, 0xE2, 0xE9, 0xFD, 0x49, 0x98, 0x91, 0x71, 0xFB, 0x33, 0x66, 0xE4, 0xB4, 0x16,
-    0x77, 0xA2, 0xE6, 0x2D, 0x0D, 0x7E, 0x34, 0xD9, 0xE2, 0x2C, 0x53, 0x6D, 0x7E, 0x3D, 0x1F, 0x3A,
-    0xA6, 0x3F, 0x22, 0x16, 0x14, 0x3F, 0x09, 0x41, 0x9B, 0x57, 0x9A, 0xAC, 0x58, 0x30, 0xCD, 0x27,
-    0x98, 0x82, 0x67, 0x03, 0x4E, 0xF5, 0xFE, 0x8F, 0x49, 0x23, 0x42, 0xCD, 0x84, 0x30, 0x8B, 0x10,
-    0xF7, 0x57, 0x35, 0x05, 0x48, 0xD8, 0xD2, 0xBF, 0x63, 0xC2, 0x29, 0xFD, 0x98, 0x4A, 0x90, 0x2D,
-    0x6A, 0x4D, 0xA0, 0x73, 0xDA, 0xF2, 0xAA, 0xD0, 0xA4, 0x3E, 0xA7, 0xB5, 0xD0, 0x39, 0x96, 0xE0,
-    0x63, 0x66, 0x06, 0x5B, 0x5E, 0xB1, 0x7C, 0x1B, 0xB0, 0xAC, 0xC5, 0x54, 0x49, 0xDD, 0x32, 0x59,
-    0xC2, 0xD9, 0x38, 0x25, 0x03, 0x84, 0x9E, 0x60, 0x74, 0xD1, 0x8F, 0xE7, 0xF4, 0x60, 0xF4, 0x98,
-    0xD6, 0x57, 0x11, 0x03, 0x75, 0x7D, 0xEE, 0xF7, 0x6A, 0xCC, 0xE5, 0x17, 0x6B, 0xA9, 0x47, 0xCD,
-    0xB5, 0x69, 0xFE, 0x6E, 0x19, 0x20, 0xD2, 0x58, 0x04, 0x02, 0x3E, 0x5D, 0x3E, 0x92, 0x9C, 0x08,
-    0x5F, 0x66, 0x60, 0x9A, 0x51, 0x8F, 0x28, 0x2B, 0xEA, 0x6F, 0xE3, 0x9E, 0x3F, 0x86, 0x94, 0xC9,
-    0x3F, 0x30, 0xE5, 0xFD, 0x39, 0xB3, 0xDD, 0xB3, 0x29, 0x4B, 0x06, 0xB8, 0x69, 0x06, 0x3F, 0x25,
-    0xE3, 0xD3, 0x3A, 0x56, 0xCA, 0xE2, 0x36, 0x1C, 0xB2, 0xC4, 0x58, 0x4B, 0xCD, 0x1B, 0x56, 0x27,
-    0x3C, 0xBD, 0xB2, 0x6F, 0x3C, 0x75, 0x72, 0x55, 0x90, 0xAC, 0x1A, 0x59, 0xA2, 0xAE, 0x1B, 0xCC,
-    0xE2, 0x69, 0x41, 0xF8, 0x45, 0x67, 0x59, 0x72, 0x3C, 0x69, 0xEE, 0x25, 0x8A, 0x5B, 0x1F, 0xD0,
-    0x73, 0x91, 0x8B, 0x38, 0xBD, 0xEB, 0x88, 0x66, 0x0C, 0x17, 0x75, 0xFB, 0xF3, 0x06, 0x72, 0x0A,
-    0x8F, 0xA0, 0x21, 0xDB, 0x49, 0x02, 0x5E, 0x13, 0xD8, 0x4C, 0x5F, 0x4A, 0x6C, 0x70, 0x7B, 0xCC,
-    0x5E, 0x17, 0xDD, 0x73, 0x32, 0x60, 0x18, 0xC5, 0x8A, 0xDE, 0x6D, 0xC5, 0x2E, 0x06, 0x96, 0xF4,
-    0x61, 0x62, 0x97, 0x49, 0x64, 0xCE, 0x99, 0x5D, 0xDE, 0x93, 0x8E, 0x4A, 0xFB, 0x25, 0x94, 0x38,
-    0xBE, 0x4B, 0xC0, 0x9E, 0xA9, 0x51, 0xD3, 0xE0, 0x7F, 0x47, 0x43, 0x0A, 0xB5, 0x6D, 0x07, 0x59,
-    0xEB, 0xB6, 0xAF, 0x70, 0x7B, 0x95, 0xEF, 0x6B, 0x8D, 0xBC, 0x66, 0x79, 0x61, 0xD2, 0x80, 0x74,
-    0x67, 0x07, 0x37, 0xE7, 0x46, 0xA3, 0x72, 0x71, 0x25, 0xD7, 0x36, 0xF3, 0x78, 0xE6, 0x50, 0x1E,
-    0x6F, 0xF2, 0xBC, 0x3C, 0x9E, 0x49, 0xAC, 0x16, 0x8D, 0xDD, 0xB6, 0xC7, 0xEA, 0x07, 0x71, 0x2F,
-    0xD1, 0x9F, 0x9F, 0x3F, 0x3A, 0x0A, 0x75, 0xF3, 0xFA, 0xF6, 0x33, 0x8D, 0x8C, 0x08, 0xCF, 0x96,
-    0x6A, 0xEA, 0x6A, 0xCD, 0x23, 0xAB, 0x9F, 0xD2, 0x27, 0xE6, 0xEB, 0x9E, 0xAB, 0x34, 0x5F, 0xE3,
-    0x39, 0xB7, 0x8D, 0x96, 0x3B, 0xB1, 0xB0, 0x4E, 0x2A, 0xD6, 0xCE, 0x0F, 0x30, 0x17, 0xAE, 0x85,
-    0x47, 0x62, 0x9E, 0x53, 0x08, 0xE0, 0xE4, 0xB4, 0xE8, 0x43, 0xB0, 0x30, 0x06, 0x7F, 0xD4, 0xA6,
-    0xE9, 0x66, 0xE4, 0x09, 0xD2, 0x58, 0x0F, 0x19, 0x6B, 0xAA, 0x60, 0x3E, 0x64, 0xAC, 0xC7, 0xB4,
-    0xF5, 0x74, 0xD0, 0xD8, 0xC5, 0x73, 0x92, 0xE2, 0x33, 0x5F, 0xE3, 0xE0, 0x86, 0x85, 0xD4, 0xA4,
-    0xF5, 0x7A, 0x9D, 0x8E, 0xA9, 0x70, 0x7F, 0x93, 0x3F, 0x60, 0x88, 0xB6, 0xF7, 0xFF, 0x5D, 0x2C,
-    0xFF, 0x79, 0x17, 0x8B, 0xEB, 0x57, 0xC1, 0xCB, 0xF5, 0xAB, 0xB8, 0x92, 0x65, 0xDE, 0x0D, 0xB5,
-    0xA6, 0x78, 0x36, 0xA4, 0x05, 0x7E, 0xBE, 0xFB, 0x55, 0xCC, 0x7A, 0x08, 0xE3, 0xA3, 0xB2, 0xF5,
-    0x7A, 0xC5, 0x50, 0x7A, 0xF4, 0x45, 0xFC, 0xB1, 0x53, 0xC5, 0x1D, 0x0C, 0x7D, 0x2A, 0x43, 0x9B,
-    0x8A, 0xEF, 0x52, 0x19, 0x9A, 0x54, 0x86, 0x1E, 0x95, 0xA1, 0x45, 0x65, 0xE8, 0x50, 0x19, 0x1A,
-    0x54, 0x86, 0xFE, 0x94, 0xA1, 0x3D, 0x65, 0xE8, 0x4E, 0x19, 0x9A, 0x53, 0x86, 0xDE, 0x94, 0xA1,
-    0x35, 0x65, 0xE8, 0x4C, 0x19, 0x1A, 0x53, 0x86, 0xBE, 0x94, 0xB1, 0x2D, 0x65, 0x9D, 0x41, 0x7E,
-    0x7B, 0x0C, 0x9E, 0xB5, 0x86, 0x98, 0xAE, 0xF9, 0xC3, 0x5F, 0x33, 0x2F, 0x47, 0x50, 0x1D, 0xDE,
-    0x1D, 0x8B, 0xE8, 0xEA, 0xA4, 0x19, 0x23, 0x72, 0x65, 0x31, 0x41, 0x6B, 0x5E, 0x9E, 0xA0, 0x5A,
-    0x82, 0xE3, 0x40, 0x33, 0xF9, 0x12, 0x1F, 0xCB, 0x7B, 0x95, 0xF3, 0xDB, 0x0A, 0x25, 0xBB, 0x04,
-    0x5B, 0x3F, 0x63, 0x3A, 0x53, 0xE1, 0xDC, 0x8F, 0x39, 0x9A, 0x7B, 0x57, 0x0E, 0x3B, 0x51, 0x90,
-    0xE3, 0xDE, 0x3B, 0x76, 0x1C, 0xA9, 0xEB, 0x4F, 0x9E, 0x5E, 0xBF, 0x5E, 0xFB, 0x65, 0xD2, 0xAE,
-    0xC8, 0x9E, 0x85, 0xC5, 0x5F, 0x97, 0x85, 0xFA, 0xA9, 0xDE, 0x6B, 0xA9, 0x05, 0xBF, 0x06, 0x8F,
-    0xC9, 0x1B, 0x6F, 0x7D, 0x45, 0xE5, 0x8D, 0xCF, 0x95, 0x01, 0x19, 0x09, 0x68, 0x47, 0x25, 0x5B,
-    0x1A, 0x9D, 0xA9, 0x4F, 0x55, 0xE4, 0x98, 0x31, 0x0F, 0xBC, 0xA8, 0x04, 0xF0, 0x0B, 0x0D, 0xAF,
-    0xC3, 0xE5, 0x8D, 0xDE, 0x95, 0x23, 0x27, 0x43, 0x32, 0x25, 0xB8, 0xB6, 0xB1, 0x5E, 0x90, 0xB0,
-    0x87, 0xF5, 0x8F, 0x08, 0x43, 0xFA, 0xC1, 0xA7, 0x98, 0xAB, 0xF4, 0x1F, 0x19, 0xB6, 0x67, 0x73,
-    0x1D, 0x64, 0xC7, 0xB0, 0x5D, 0x94, 0x89, 0xBB, 0x4A, 0x77, 0x0A, 0xC0, 0x44, 0x47, 0x3F, 0xD5,
-    0x01, 0xAF, 0x54, 0x2B, 0xB4, 0x19, 0x0C, 0x98, 0xE5, 0xDA, 0x22, 0x0B, 0x1D, 0xD3, 0x0E, 0x2C,
-    0x39, 0x19, 0x6F, 0xA0, 0xF7, 0xA1, 0xE7, 0x35, 0x18, 0xAF, 0x2A, 0xB3, 0xF8, 0x18, 0x72, 0x85,
-    0xB4, 0x65, 0x0C, 0x92, 0x7E, 0x4E, 0x75, 0xCA, 0x94, 0xFC, 0xA8, 0x3E, 0xFB, 0xD6, 0x1D, 0xB7,
-    0x73, 0x64, 0xC7, 0x35, 0x23, 0x58, 0x17, 0x14, 0xEE, 0x6D, 0xE4, 0x68, 0xCC, 0x3B, 0x87, 0xDA,
-    0x43, 0x8A, 0x8D, 0x7E, 0x5C, 0xCD, 0xB2, 0xF2, 0xD5, 0x3E, 0xB7, 0x27, 0x53, 0x7B, 0x3F, 0x7C,
-    0xEB, 0x87, 0xEF, 0xFC, 0x18, 0x1A, 0x3F, 0x7C, 0xDF, 0x87, 0x6F, 0xFB, 0x70, 0xBD, 0x35, 0xBE,
-    0xB1, 0xC6, 0x77, 0xD5, 0xF8, 0x96, 0x1A, 0xD7, 0xF1, 0xE1, 0x9B, 0x69, 0x7C, 0x27, 0x8D, 0x6F,
-    0xA3, 0xF1, 0x3D, 0x34, 0xBE, 0x81, 0xC6, 0x77, 0xCF, 0xF8, 0xD6, 0x19, 0xDF, 0x37, 0xE3, 0x1B,
-    0x3D, 0x7C, 0x9F, 0x87, 0x6F, 0xF3, 0xF0, 0x5D, 0x1E, 0xBE, 0xC9, 0x43, 0x3E, 0xB8, 0xB7, 0x99,
-    0x5D, 0xCE, 0x87, 0xEC, 0x72, 0x58, 0x1D, 0xEE, 0xC1, 0x60, 0x03, 0x86, 0x76, 0x5F, 0xB0, 0xF5,
-    0x02, 0x7D, 0x17, 0xDA, 0x74, 0xE1, 0xD2, 0x69, 0x77, 0x8E, 0x66, 0x92, 0x83, 0x85, 0xF6, 0x57,
-    0xB0, 0xB9, 0xC2, 0x25, 0xDE, 0xD8, 0x56, 0x11, 0xD8, 0xFE, 0x8E, 0x63, 0xA5, 0xAF, 0x98, 0x23,
-    0x4E, 0xAF, 0xD2, 0x0E, 0x85, 0x21, 0x09, 0xC9, 0x22, 0xAF, 0xC9, 0x1E, 0x42, 0xB0, 0x1D, 0xCE,
-    0xC8, 0xFA, 0x36, 0xBF, 0x81, 0xF7, 0x13, 0x2E, 0x7F, 0xF1, 0xCF, 0x4A, 0x4E, 0x46, 0xED, 0x94,
-    0x58, 0x4F, 0x15, 0xE1, 0x21, 0x2D, 0xB9, 0x7B, 0x38, 0x2D, 0x19, 0x6B, 0x5A, 0x92, 0xE6, 0xB7,
-    0xCD, 0xED, 0x2E, 0x0D, 0x7C, 0xF6, 0x05, 0x09, 0x49, 0x71, 0xC5, 0x77, 0x7D, 0x2C, 0x4A, 0xE5,
-    0xDB, 0xF7, 0xA1, 0x60, 0x54, 0xB9, 0x16, 0x32, 0x73, 0xF0, 0x18, 0xCE, 0x6F, 0x1B, 0x01, 0xE7,
-    0xEB, 0xEE, 0x88, 0xEF, 0x8D, 0x0B, 0xFB, 0xB1, 0x65, 0x2A, 0xC3, 0x7B, 0x87, 0x1B, 0x9D, 0x86,
-    0x6E, 0x93, 0xA1, 0x77, 0xEA, 0x5D, 0xEF, 0x0E, 0x5A, 0xF3, 0x7F, 0x2C, 0x89, 0xF9, 0x5A, 0xB5,
-    0xEE, 0x44, 0x96, 0xEB, 0x9D, 0x37, 0xAE, 0x9B, 0xFB, 0x8C, 0x39, 0xB1, 0x99, 0xCD, 0xBF, 0x1E,
-    0xBB, 0x30, 0xE3, 0x35, 0x5B, 0xD2, 0x05, 0xF8, 0xED, 0x0D, 0x91, 0x7B, 0x78, 0xC3, 0x9F, 0x20,
-    0xD4, 0xFB, 0x0C, 0xF1, 0xA1, 0xA7, 0xC8, 0x05, 0x29, 0x72, 0x8D, 0xE5, 0x22, 0xF8, 0x67, 0x50,
-    0xE4, 0xE8, 0x7D, 0x50, 0xE4, 0x94, 0x14, 0x79, 0x9B, 0x14, 0xF9, 0x32, 0x29, 0x72, 0x0F, 0x8A,
-    0x1C, 0xB6, 0x20, 0xC7, 0x71, 0x85, 0x6D, 0x4A, 0x8A, 0xBC, 0x43, 0x8A, 0xFC, 0x08, 0x14, 0xF9,
-    0x1B, 0x1D, 0x28, 0xF2, 0x37, 0x1B, 0x50, 0xE4, 0xEF, 0x92, 0x22, 0xFF, 0x2B, 0x29, 0xF2, 0x9C,
-    0x14, 0x59, 0xE3, 0x09, 0x52, 0xE4, 0xF8, 0x21, 0x96, 0xEA, 0x94, 0x6D, 0x1E, 0x43, 0x2B, 0xFD,
-    0x99, 0x21, 0x97, 0x3F, 0xF5, 0xFD, 0x67, 0xEC, 0x00, 0x70, 0xE8, 0x7F, 0x5D, 0x6B, 0x7B, 0x81,
-    0x7D, 0x26, 0x41, 0xCF, 0x81, 0x45, 0xE3, 0x56, 0x8E, 0xCA, 0x5A, 0x81, 0xC0, 0xAE, 0x16, 0x2B,
-    0x0D, 0x3E, 0xEE, 0x92, 0x3E, 0xFE, 0x6E, 0x97, 0x76, 0xA9, 0xFC, 0x6B, 0x77, 0xD2, 0x2E, 0x6B,
-    0x1E, 0xA5, 0x6D, 0xFE, 0xC3, 0x56, 0x66, 0xE1, 0x03, 0x61, 0xCA, 0xF9, 0xDF, 0x22, 0x12, 0x84,
-    0x05, 0xA5, 0x33, 0xB1, 0xA6, 0xA4, 0x47, 0x1C, 0xB7, 0xBC, 0x29, 0xB7, 0xAB, 0x45, 0xA6, 0x1D,
-    0x44, 0x28, 0xBF, 0xE7, 0x45, 0x61, 0x0F, 0x79, 0x4B, 0x27, 0x82, 0x72, 0xB2, 0x88, 0x43, 0xDE,
-    0xBE, 0x4B, 0x8D, 0xB8, 0x70, 0xC4, 0x48, 0x4E, 0x54, 0xBD, 0x24, 0xB8, 0x87, 0xDA, 0xE8, 0x02,
-    0xA6, 0x73, 0x07, 0x11, 0x54, 0x8E, 0x04, 0x5E, 0xD2, 0xC8, 0x35, 0x61, 0x73, 0xE9, 0x78, 0x7D,
-    0xCF, 0x7D, 0x25, 0xD2, 0x24, 0x5B, 0x0F, 0xB4, 0xE7, 0x13, 0x5A, 0xFA, 0x87, 0xF2, 0x73, 0x92,
-    0xAB, 0x79, 0x66, 0x0B, 0x51, 0x03, 0x82, 0xCD, 0x08, 0x2E, 0x3B, 0xAE, 0x2E, 0x40, 0x0D, 0xCF,
-    0x1C, 0x23, 0x76, 0xE1, 0xDD, 0x5F, 0x65, 0x24, 0x49, 0xAF, 0xC4, 0xA9, 0x34, 0xB7, 0x19, 0x68,
-    0x64, 0x5C, 0x66, 0xE2, 0xEA, 0xED, 0x23, 0x5F, 0x16, 0x71, 0x04, 0x9B, 0xCE, 0x0E, 0x6E, 0x59,
-    0x5C, 0x71, 0x87, 0x07, 0x8B, 0x43, 0x46, 0xFB, 0x64, 0xE3, 0xD0, 0x55, 0x3F, 0xAC, 0xCE, 0x42,
-    0xB7, 0x12, 0x91, 0x96, 0x8C, 0x46, 0x41, 0x05, 0xE9, 0x8A, 0xD5, 0xEB, 0x6A, 0x90, 0x95, 0x1F,
-    0x49, 0xAC, 0x4E, 0x3C, 0xE9, 0x25, 0xDD, 0x05, 0xA0, 0x6C, 0xC3, 0xD6, 0xF6, 0x74, 0xED, 0x4D,
-    0x0F, 0xEF, 0x5E, 0x94, 0x75, 0x1F, 0x08, 0x20, 0xE8, 0x16, 0x69, 0xD2, 0x6F, 0x88, 0x07, 0xA8,
-    0x2E, 0xAF, 0x51, 0x19, 0x89, 0xCD, 0xFF, 0xAA, 0x37, 0x8B, 0x68, 0x8E, 0xF8, 0x34, 0xE9, 0xC3,
-    0xB9, 0xCC, 0xC4, 0x2C, 0x6F, 0xC4, 0xA5, 0x88, 0xA9, 0x16, 0xDF, 0x5B, 0x49, 0xCC, 0xD6, 0x99,
-    0xFA, 0x9A, 0x63, 0xF7, 0x2E, 0xBC, 0x2B, 0xAA, 0xA0, 0xCA, 0xDB, 0x44, 0xBC, 0xA0, 0x15, 0x4F,
-    0x30, 0xF7, 0x1D, 0x5A, 0x5B, 0x94, 0x91, 0x31, 0x5E, 0x74, 0xA0, 0x7D, 0xCA, 0xDB, 0xF4, 0x1C,
-    0x5F, 0x39, 0xD1, 0x28, 0x19, 0x73, 0xB1, 0x42, 0x64, 0x44, 0xA1, 0xD3, 0xF2, 0x92, 0x5C, 0xF0,
-    0x0B, 0x2F, 0x02, 0x21, 0x3A, 0x04, 0x28, 0xD1, 0x1D, 0x09, 0xD8, 0xE0, 0x0D, 0xE0, 0x0C, 0xC2,
-    0xF6, 0xD2, 0x46, 0x4F, 0x24, 0x5B, 0x22, 0xB5, 0x16, 0xA0, 0xC5, 0x7C, 0x97, 0x74, 0x01, 0x12,
-    0xB1, 0x06, 0xE7, 0xA4, 0xDF, 0xFC, 0x3A, 0x59, 0x6B, 0x3C, 0x47, 0xD9, 0x68, 0x4C, 0x74, 0x2C,
-    0x04, 0xB7, 0x01, 0xF3, 0x60, 0x4A, 0x5F, 0x86, 0xF7, 0xED, 0xD3, 0x7B, 0xA6, 0x90, 0xEB, 0xB3,
-    0x3F, 0x96, 0x95, 0xA0, 0x79, 0x2C, 0x0B, 0xB2, 0x10, 0xDC, 0x47, 0x89, 0x79, 0x31, 0xCD, 0x8F,
-    0x68, 0x4D, 0x31, 0x35, 0x46, 0x71, 0xC0, 0x1E, 0x0C, 0x09, 0xEB, 0x62, 0xF9, 0xF9, 0xDF, 0x6F,
-    0x01, 0x35, 0xDF, 0x29, 0x23, 0xDB, 0xA5, 0x4F, 0xFA, 0x0B, 0xE6, 0xD6, 0x1B, 0xE6, 0x8D, 0x61,
-    0xE8, 0x37, 0xC9, 0x7E, 0xE4, 0x11, 0x49, 0xAB, 0x8D, 0xCA, 0xB8, 0x7F, 0xAE, 0x5F, 0xF2, 0xE3,
-    0x7D, 0xB5, 0x1B, 0x79, 0xCA, 0xB1, 0x4E, 0x98, 0x19, 0x0A, 0x8C, 0x9B, 0x55, 0x91, 0x9B, 0xC2,
-    0x4C, 0x99, 0x10, 0xA1, 0xA7, 0x37, 0x49, 0x45, 0x96, 0xBC, 0xE9, 0xEB, 0x4F, 0x68, 0x93, 0xA7,
-    0x0C, 0xC2, 0x8F, 0x61, 0x9F, 0x6B, 0x15, 0xBC, 0x31, 0x07, 0x70, 0x48, 0xFE, 0x17, 0xDD, 0xE4,
-    0x69, 0x2E, 0x92, 0x05, 0x71, 0x9E, 0xE2, 0x27, 0xFA, 0xAD, 0x06, 0x30, 0xB1, 0xAF, 0x21, 0x21,
-    0xFB, 0x12, 0xF4, 0xCA, 0x5E, 0x24, 0xFB, 0xEC, 0x9D, 0x03, 0x84, 0x33, 0xD9, 0xF0, 0x26, 0x2F,
-    0x1E, 0x41, 0xB8, 0x7C, 0xA3, 0x4E, 0xDF, 0xD0, 0xED, 0xA3, 0x81, 0x87, 0x66, 0x53, 0xCE, 0xA8,
-    0x8E, 0x97, 0x0F, 0xFB, 0xE2, 0xD5, 0x1E, 0x73, 0x9E, 0x2B, 0x46, 0xDD, 0xC8, 0xF1, 0x2F, 0x90,
-    0xAD, 0x0A, 0x38, 0x56, 0x1D, 0xB1, 0x66, 0x1A, 0x91, 0x83, 0xEA, 0x40, 0x15, 0xE5, 0xA6, 0x9A,
-    0x22, 0x10, 0xB9, 0x99, 0xBA, 0x44, 0xC0, 0x9C, 0x92, 0x11, 0x64, 0x4F, 0x2C, 0x4D, 0x72, 0xA2,
-    0x95, 0x47, 0x80, 0x58, 0x16, 0xFC, 0x7E, 0x55, 0xC6, 0x2F, 0x57, 0x69, 0xB6, 0x33, 0x65, 0x52,
-    0x22, 0xE1, 0x56, 0xEE, 0xBD, 0x65, 0xFF, 0x3C, 0x5C, 0x09, 0x13, 0x58, 0x98, 0x9B, 0xCD, 0x99,
-    0xEA, 0x1D, 0xB9, 0xED, 0x52, 0xC3, 0xBD, 0xB9, 0x90, 0x66, 0x84, 0x7A, 0x67, 0x83, 0x81, 0xAB,
-    0x15, 0xF3, 0xAC, 0xCF, 0xE7, 0xF5, 0x3C, 0x7C, 0xFA, 0xA3, 0x79, 0xF8, 0xD3, 0x72, 0x16, 0x1E,
-    0x98, 0x3D, 0xCE, 0xB3, 0xFB, 0x32, 0x58, 0xD2, 0xBB, 0x5C, 0xAA, 0x77, 0x5B, 0xD5, 0x51, 0xB7,
-    0xA5, 0xB5, 0x48, 0x71, 0x03, 0x43, 0x6D, 0x20, 0x79, 0x32, 0x23, 0xDB, 0x07, 0xD7, 0x1F, 0x5C,
-    0xC2, 0x09, 0x45, 0xC8, 0x04, 0x3F, 0xD0, 0x8A, 0x55, 0xF1, 0xB0, 0x31, 0x8F, 0x64, 0xBD, 0xBC,
-    0x3B, 0xE6, 0x48, 0xFE, 0xC7, 0xD0, 0x79, 0x8D, 0xC9, 0xC4, 0xEC, 0xBD, 0x39, 0x73, 0xBC, 0x8B,
-    0x21, 0xFE, 0x36, 0x73, 0x66, 0x29, 0x2E, 0x85, 0xCD, 0x4B, 0xD0, 0x13, 0x1C, 0xC0, 0x14, 0x82,
-    0x05, 0x06, 0xB8, 0x8F, 0x27, 0x16, 0x0C, 0x31, 0xAB, 0xD9, 0x61, 0xA7, 0xF6, 0xC2, 0x1B, 0xF6,
-    0x30, 0x63, 0x46, 0x1B, 0xEE, 0x4C, 0xF1, 0x00, 0xD0, 0xDD, 0xA2, 0x46, 0xDF, 0x75, 0xDF, 0x9C,
-    0x3F, 0xE9, 0x3D, 0xEB, 0x0C, 0xC3, 0x6B, 0x2C, 0x06, 0x07, 0xFB, 0xC8, 0xAD, 0x9C, 0xC5, 0x52,
-    0x7E, 0xE6, 0x98, 0x5B, 0x1E, 0x45, 0x02, 0x24, 0x32, 0x0F, 0x6A, 0x89, 0x9D, 0x2A, 0x46, 0xEE,
-    0x02, 0xCB, 0x3E, 0xB2, 0x0A, 0xC2, 0x98, 0xF7, 0x34, 0x61, 0x30, 0x7C, 0x99, 0x54, 0x6B, 0x89,
-    0x39, 0xD5, 0xD7, 0x7A, 0x97, 0x8C, 0xAF, 0x33, 0x89, 0xE4, 0xAB, 0x21, 0x2D, 0x39, 0x81, 0x7B,
-    0x2E, 0xCA, 0xC7, 0x7E, 0xC3, 0xB5, 0x5D, 0x71, 0xC8, 0x9E, 0xDE, 0xE8, 0x1D, 0x0A, 0x63, 0x43,
-    0x68, 0x36, 0x04, 0x18, 0x3B, 0x43, 0x87, 0x2B, 0x3D, 0x53, 0x39, 0x2E, 0x4A, 0x42, 0x44, 0x7E,
-    0xB7, 0x0F, 0x66, 0x4C, 0xA9, 0xE3, 0x7F, 0x0F, 0xA5, 0x43, 0x43, 0x42, 0x00, 0x39, 0x50, 0xAE,
-    0x4D, 0xF0, 0x6C, 0xFC, 0x92, 0x37, 0x5F, 0x12, 0x08, 0x64, 0x32, 0x9B, 0x2B, 0x6C, 0x69, 0xC8,
-    0xCA, 0xFC, 0xA3, 0xA9, 0xAC, 0x0F, 0xB3, 0xB1, 0x2B, 0x09, 0x02, 0x43, 0x5F, 0x3B, 0xCD, 0x88,
-    0xC6, 0x63, 0x65, 0x57, 0x9C, 0x09, 0xAA, 0x79, 0xB6, 0xCC, 0x4B, 0x61, 0xD3, 0xE5, 0x15, 0xAC,
-    0x20, 0x22, 0x96, 0x38, 0x10, 0xF3, 0xB6, 0x38, 0x90, 0xB3, 0x43, 0x6E, 0x75, 0x39, 0xB6, 0x16,
-    0x06, 0x8B, 0x31, 0x4D, 0xB1, 0x1E, 0x5F, 0x47, 0xEB, 0xF1, 0xB5, 0x56, 0xCA, 0xBB, 0xB1, 0xC8,
-    0x9B, 0x35, 0xE3, 0x36, 0xAF, 0x86, 0xD2, 0xC5, 0x2F, 0xD9, 0x4F, 0x99, 0xEC, 0x5F, 0x1D, 0xCE,
-    0xC9, 0xA8, 0x7B, 0x7D, 0xAC, 0xC9, 0xA5, 0x31, 0x97, 0x15, 0x69, 0x09, 0xDB, 0xF1, 0xCC, 0x46,
-    0x07, 0x84, 0x6F, 0x62, 0x09, 0xAA, 0x81, 0xB5, 0x8C, 0x94, 0x87, 0x88, 0x72, 0xDF, 0x89, 0xBC,
-    0x1E, 0x04, 0xCF, 0x54, 0xD0, 0xC8, 0x05, 0xC1, 0x28, 0x4D, 0x40, 0xD8, 0xB8, 0x3F, 0x27, 0x5E,
-    0x7C, 0xC6, 0x9C, 0xAF, 0x4F, 0xC7, 0xC4, 0x3E, 0x70, 0x75, 0x5F, 0x71, 0xBB, 0xBC, 0xD9, 0x56,
-    0x29, 0x2E, 0xBD, 0x45, 0x7D, 0xF2, 0xC1, 0x82, 0x35, 0x05, 0xCB, 0xD1, 0xC9, 0xBA, 0x9F, 0x97,
-    0x30, 0x9A, 0x8C, 0xFE, 0xF0, 0x94, 0x4F, 0x64, 0x4F, 0x47, 0xE4, 0xB4, 0xA0, 0x33, 0x61, 0xC0,
-    0xF9, 0x8C, 0x8B, 0x07, 0x06, 0x1F, 0xED, 0x29, 0xF7, 0xD0, 0xEA, 0x44, 0xBC, 0xC6, 0xA0, 0x37,
-    0x38, 0xCC, 0x5A, 0x31, 0x28, 0x6F, 0x87, 0x72, 0xBA, 0x76, 0xA6, 0x67, 0xDA, 0x57, 0x83, 0x37,
-    0x6E, 0xB2, 0x23, 0x80, 0xE9, 0xF5, 0x3B, 0xE5, 0x91, 0x6F, 0xA2, 0xC1, 0x08, 0x93, 0x4F, 0x6B,
-    0x88, 0x8A, 0xEA, 0x18, 0x66, 0xE8, 0x0A, 0x36, 0xAF, 0x0E, 0x5F, 0xE9, 0xD5, 0xD9, 0x41, 0xA2,
-    0x0D, 0xA5, 0x40, 0xAD, 0x48, 0x27, 0x7F, 0x36, 0x1B, 0x74, 0x60, 0x3A, 0xC4, 0xC7, 0x93, 0x8D,
-    0xAA, 0x33, 0x47, 0x48, 0x81, 0xB5, 0x43, 0xA8, 0xD2, 0xF4, 0x6F, 0x50, 0xB7, 0xAE, 0xC9, 0xE0,
-    0x07, 0x5E, 0x08, 0x6D, 0xDE, 0x12, 0x3F, 0x93, 0xE8, 0x22, 0xB0, 0x5B, 0xF8, 0x6C, 0xB5, 0x03,
-    0xD7, 0x25, 0x16, 0xD3, 0xF6, 0xB9, 0x7F, 0x4D, 0x41, 0x4B, 0x3B, 0x43, 0x61, 0xC7, 0x97, 0x75,
-    0x5C, 0x51, 0xC7, 0x97, 0x74, 0x7C, 0x41, 0xC7, 0x97, 0x73, 0x7C, 0x31, 0xC7, 0x97, 0x72, 0x7C,
-    0x21, 0xC7, 0x97, 0x71, 0x58, 0xC4, 0x31, 0xC6, 0x95, 0x70, 0x7C, 0x01, 0xC7, 0x97, 0x6F, 0x7C,
-    0xF1, 0xC6, 0x97, 0x6E, 0x7C, 0xE1, 0xC6, 0x97, 0x6D, 0x7C, 0xD1, 0x66, 0xA8, 0x95, 0x60, 0x5A,
-    0x60, 0x03, 0xC2, 0x1A, 0xF0, 0x1D, 0x3B, 0x10, 0x87, 0x58, 0x5D, 0x62, 0x68, 0x42, 0x14, 0x14,
-    0x9A, 0x8C, 0xA9, 0xE6, 0xC7, 0x63, 0xA1, 0x54, 0xBB, 0x17, 0xE0, 0x74, 0xFF, 0xDB, 0xFD, 0x50,
-    0xFC, 0x36, 0x18, 0xD2, 0xFC, 0x22, 0x2B, 0xA2, 0xD0, 0xE0, 0xDF, 0x11, 0x18, 0x30, 0xD3, 0xAF,
-    0xDF, 0xAF, 0xD4, 0x5C, 0xBF, 0x26, 0xFB, 0xDD, 0xDF, 0xCC, 0x48, 0x36, 0xFE, 0x66, 0x46, 0xC0,
-    0xBF, 0x99, 0x11, 0x10, 0x2C, 0x40, 0xC7, 0x54, 0x88, 0x26, 0xFD, 0xF5, 0x9B, 0x94, 0xC6, 0xA7,
-    0xFD, 0xE1, 0x4E, 0xFF, 0x03, 0x9D, 0x56, 0xBF, 0x6F, 0xDB, 0xD8, 0x1D, 0xFF, 0x90, 0xB4, 0xC4,
-    0x9C, 0x19, 0x89, 0x1A, 0xEC, 0x22, 0x6D, 0x64, 0x33, 0x83, 0x87, 0xD4, 0x95, 0xC2, 0x0C, 0x1A,
-    0x98, 0x42, 0x12, 0x1F, 0x3A, 0x74, 0x09, 0x70, 0x55, 0x51, 0x7B, 0xCA, 0x90, 0x00, 0x9D, 0x2E,
-    0xB8, 0x22, 0x1A, 0xD4, 0xC2, 0x05, 0x9C, 0xF0, 0xDD, 0xFD, 0x01, 0x85, 0x3B, 0x74, 0xD7, 0x90,
-    0x21, 0x55, 0x06, 0xAB, 0x85, 0x51, 0xF8, 0x0A, 0x9F, 0xC9, 0xA5, 0x38, 0x14, 0x5D, 0x78, 0x68,
-    0x81, 0x0C, 0x5D, 0x88, 0x22, 0x05, 0x0E, 0x45, 0x0B, 0x70, 0xD0, 0x40, 0xDC, 0x49, 0x7A, 0xFD,
-    0x3C, 0x4A, 0xE7, 0x34, 0x87, 0x4C, 0x7D, 0x24, 0x9F, 0xA9, 0xF7, 0xE3, 0xF3, 0xFD, 0xBE, 0xEF,
-    0xF7, 0xF3, 0xFD, 0xD0, 0xFB, 0xC2, 0x4F, 0x9C, 0xD4, 0xCA, 0x90, 0xA3, 0x83, 0x17, 0x56, 0xE1,
-    0x64, 0x9E, 0xEC, 0x61, 0x0C, 0xEC, 0x03, 0x4A, 0x9A, 0x2A, 0x71, 0x5E, 0xA5, 0xBE, 0x91, 0x8F,
-    0x30, 0xC2, 0x01, 0x60, 0x2B, 0xA4, 0x6E, 0xFC, 0x2A, 0x69, 0xB9, 0x0A, 0x5B, 0xC6, 0x39, 0xD8,
-    0x42, 0x55, 0x84, 0x6A, 0x76, 0xF5, 0x32, 0xC4, 0x30, 0x30, 0xB2, 0xF0, 0x34, 0xF1, 0x94, 0x30,
-    0xBF, 0xC0, 0x06, 0x42, 0xC4, 0xBC, 0xDA, 0xD8, 0xC5, 0x34, 0xFC, 0x41, 0xC1, 0xFB, 0x8E, 0x91,
-    0x1B, 0xC2, 0x9F, 0xF7, 0xA2, 0x86, 0x8F, 0xBE, 0x53, 0xB8, 0xC2, 0xE5, 0x2A, 0x36, 0x7B, 0x01,
-    0xFF, 0x54, 0x74, 0xAD, 0x64, 0x75, 0xF3, 0x9D, 0x23, 0xBA, 0xBD, 0xD8, 0x94, 0x56, 0x11, 0x4A,
-    0x3B, 0xBB, 0x84, 0x2B, 0x0B, 0xF4, 0xAC, 0x14, 0x53, 0x07, 0x38, 0xC1, 0xE0, 0xCC, 0x4E, 0x7B,
-    0xBE, 0xF0, 0x17, 0x70, 0x67, 0x70, 0x32, 0x6C, 0xB4, 0xBB, 0xDD, 0x60, 0x84, 0x0D, 0x03, 0xBB,
-    0xB6, 0xD8, 0x71, 0xD0, 0x72, 0xD1, 0x75, 0x11, 0xEC, 0x6A, 0x90, 0x0F, 0xAA, 0x27, 0x08, 0xAD,
-    0x1C, 0xDE, 0x47, 0x05, 0xEC, 0xF4, 0x02, 0x46, 0xEE, 0x03, 0x23, 0x47, 0xE8, 0xB9, 0x19, 0xCC,
-    0x39, 0xCC, 0x02, 0xC3, 0xF1, 0x78, 0x64, 0x64, 0xFD, 0xD3, 0xC4, 0x57, 0xA8, 0xBE, 0x06, 0x26,
-    0x3C, 0x6F, 0xE2, 0xBD, 0xCC, 0xBA, 0xC8, 0x3B, 0x18, 0xE2, 0x96, 0x95, 0x13, 0x10, 0xC7, 0xB8,
-    0x44, 0x2C, 0xE3, 0x24, 0x94, 0x1B, 0xA8, 0x9E, 0xB8, 0xB9, 0x5B, 0xD8, 0x05, 0x21, 0x72, 0x23,
-    0xBD, 0x29, 0x9F, 0x12, 0xCD, 0x11, 0x61, 0x12, 0x27, 0x4A, 0x14, 0x0C, 0xE9, 0x19, 0x7A, 0xF4,
-    0xD9, 0x10, 0xEF, 0x5A, 0xB7, 0x0F, 0x5F, 0xBA, 0xC9, 0x3A, 0xF2, 0xBF, 0x35, 0xE6, 0x44, 0x4F,
-    0xEE, 0x30, 0xCC, 0x78, 0x84, 0xFC, 0x71, 0x1E, 0x67, 0x46, 0x6A, 0x26, 0xC0, 0x6D, 0x5A, 0xEC,
-    0x8F, 0xA3, 0x7C, 0x8A, 0x29, 0xF7, 0x6C, 0x1F, 0x32, 0xCC, 0x62, 0xFB, 0x21, 0xE0, 0x96, 0x77,
-    0x1D, 0xD8, 0x01, 0x5A, 0xC0, 0x16, 0x4C, 0xE9, 0x66, 0x6E, 0xCE, 0x13, 0x66, 0x66, 0xE2, 0x8B,
-    0x3D, 0xED, 0x48, 0xE2, 0xCB, 0x80, 0x80, 0xC7, 0xCC, 0xC1, 0x26, 0x20, 0x50, 0x42, 0x86, 0x8B,
-    0x70, 0xBE, 0x7D, 0x10, 0xCE, 0xBF, 0xF7, 0xDA, 0x16, 0x0E, 0x1C, 0xEE, 0xB3, 0xE4, 0x83, 0xBF,
-    0xA9, 0xE2, 0xE1, 0xC0, 0xC5, 0x7B, 0x08, 0x97, 0xD1, 0x92, 0xE9, 0x68, 0xD1, 0x6A, 0x17, 0x47,
-    0x98, 0xC5, 0x79, 0x9C, 0x7E, 0xFB, 0x6A, 0x20, 0xD0, 0x58, 0xB3, 0x30, 0xAF, 0x32, 0x6C, 0x3E,
-    0x42, 0xC9, 0x8B, 0x76, 0xDA, 0x46, 0x16, 0x59, 0x33, 0xDE, 0x3D, 0x33, 0xE3, 0x4F, 0xAF, 0xC0,
-    0xB3, 0x4B, 0x9C, 0xB9, 0xC8, 0x1D, 0xDD, 0xF3, 0x9D, 0x23, 0x6C, 0x6E, 0xE2, 0x89, 0x3E, 0x21,
-    0xA6, 0xF4, 0x04, 0x0D, 0xE8, 0xF3, 0x70, 0x3C, 0xD6, 0x48, 0xF0, 0x48, 0x1F, 0x44, 0x0B, 0x44,
-    0x19, 0x8C, 0x4C, 0x2F, 0xBB, 0xC0, 0x9C, 0x61, 0x8E, 0xE6, 0xDE, 0xAC, 0xE2, 0xEE, 0xB6, 0x5B,
-    0x5D, 0x7C, 0x67, 0x32, 0x39, 0xF1, 0x95, 0x4A, 0xC3, 0xC3, 0x87, 0x49, 0x17, 0x56, 0x32, 0x82,
-    0x25, 0x1F, 0xC1, 0x14, 0xE3, 0xBB, 0xCD, 0x6C, 0x1A, 0xFC, 0x71, 0x39, 0x8B, 0xBC, 0x94, 0x46,
-    0xF6, 0xB0, 0xD5, 0x36, 0x72, 0xF7, 0x7E, 0xEA, 0x28, 0x4D, 0x1F, 0x26, 0xB5, 0x24, 0xB2, 0xF8,
-    0x1F, 0x22, 0x0F, 0xD7, 0x14, 0x7D, 0xB9, 0xA6, 0xA8, 0xF1, 0x09, 0x1C, 0x25, 0xFD, 0x97, 0x69,
-    0x80, 0x6C, 0x48, 0xE6, 0xBF, 0x9B, 0xE6, 0xB1, 0xCA, 0x63, 0x95, 0x6D, 0x1F, 0x1E, 0x1E, 0x44,
-    0x4A, 0x15, 0x8F, 0x27, 0x93, 0xE7, 0xAE, 0x52, 0x4B, 0x8F, 0x0F, 0xD6, 0x2D, 0x54, 0x6A, 0xAE,
-    0xE7, 0x30, 0x60, 0xE8, 0x97, 0x06, 0xD1, 0x5F, 0xC9, 0xC0, 0x53, 0x68, 0x98, 0x33, 0xE6, 0xED,
-    0x90, 0x08, 0x0A, 0x93, 0xC9, 0x04, 0x95, 0x43, 0x36, 0xC1, 0xD5, 0x4A, 0x65, 0xFB, 0x1C, 0x98,
-    0x9C, 0xAC, 0xF6, 0x6F, 0xA2, 0x8C, 0x86, 0xC3, 0x5A, 0x8A, 0x05, 0x6C, 0xFE, 0x89, 0x24, 0x70,
-    0x8E, 0x37, 0xAD, 0xA1, 0xBB, 0xE3, 0x15, 0x63, 0xC1, 0x40, 0xB1, 0xB3, 0x92, 0x92, 0x71, 0x28,
-    0x43, 0x08, 0xA6, 0x08, 0xEB, 0x2D, 0xB9, 0x9E, 0xD4, 0x11, 0xB1, 0x25, 0x4A, 0xAA, 0x00, 0x77,
-    0xDE, 0xDA, 0x6E, 0xFE, 0x5F, 0xDB, 0xBB, 0x57, 0x7E, 0xE8, 0x51, 0xD2, 0x37, 0x31, 0x13, 0x3B,
-    0x09, 0xC5, 0x11, 0x6E, 0xB0, 0x22, 0x5B, 0x30, 0x52, 0x9D, 0x9C, 0xF0, 0x37, 0x4F, 0x12, 0x86,
-    0x42, 0x32, 0x4C, 0x82, 0xC7, 0x1D, 0x30, 0x71, 0x2C, 0x22, 0x30, 0xC2, 0x46, 0xD2, 0x81, 0x79,
-    0x35, 0xE7, 0x7C, 0x3E, 0xF3, 0xBF, 0x9A, 0x8F, 0xBA, 0xCD, 0x69, 0xD0, 0x24, 0xE0, 0xB5, 0x5B,
-    0xBB, 0xE7, 0xD4, 0x9F, 0xB4, 0x97, 0x37, 0xE8, 0x92, 0x99, 0xBB, 0xA9, 0x4F, 0x72, 0x78, 0xAC,
-    0x20, 0x27, 0x71, 0xE4, 0x13, 0x7A, 0x46, 0xB0, 0x03, 0x82, 0x2D, 0x18, 0xB7, 0x17, 0x28, 0xEB,
-    0xE1, 0x70, 0x40, 0xB0, 0x19, 0xC1, 0xC6, 0x1F, 0x90, 0x42, 0x1E, 0x57, 0xF2, 0x60, 0x53, 0x3C,
-    0x06, 0x16, 0xB0, 0xA8, 0x0A, 0xA9, 0x3E, 0x59, 0xC0, 0xA5, 0x65, 0x56, 0x58, 0x1A, 0xEA, 0xEF,
-    0x22, 0xF0, 0x96, 0xCC, 0xCA, 0x6B, 0x4D, 0x77, 0x11, 0x0A, 0x2D, 0x40, 0x2D, 0xAC, 0x93, 0xE0,
-    0xF0, 0xB8, 0x6E, 0x8A, 0xB6, 0xFB, 0x99, 0x8C, 0xBC, 0x1F, 0xA5, 0xF1, 0x1D, 0x37, 0xE9, 0xB5,
-    0x38, 0xB8, 0xA7, 0x79, 0x14, 0x91, 0x92, 0x97, 0x22, 0x4E, 0xBE, 0xFB, 0x16, 0x1B, 0x83, 0x37,
-    0x6C, 0xC4, 0x26, 0xD3, 0xA9, 0x39, 0xA1, 0xFD, 0xD4, 0x70, 0xDA, 0x4F, 0xCD, 0x0B, 0xED, 0xE7,
-    0x46, 0x45, 0xAB, 0x51, 0xB7, 0x8E, 0x60, 0x07, 0xA3, 0x36, 0xA6, 0x65, 0x28, 0xB7, 0x07, 0x61,
-    0xBE, 0x9D, 0xEB, 0xCA, 0x34, 0xA4, 0x2E, 0x51, 0xFC, 0x38, 0x25, 0x1B, 0x3F, 0x2E, 0xDD, 0xEC,
-    0x84, 0x74, 0xF3, 0x17, 0xD4, 0xA1, 0xF1, 0x3A, 0xFF, 0x55, 0x9D, 0x27, 0xB9, 0x7A, 0xC8, 0x96,
-    0xEA, 0x73, 0x03, 0xBE, 0xBA, 0x8F, 0x5F, 0xC6, 0x4B, 0x8C, 0x35, 0x6D, 0x74, 0x5E, 0xE6, 0xEB,
-    0xE7, 0x0C, 0x5A, 0x14, 0x60, 0x2A, 0x99, 0x3B, 0x74, 0xB4, 0x66, 0x2B, 0x6E, 0x3A, 0x58, 0x87,
-    0x81, 0xEA, 0xAA, 0x94, 0x18, 0x79, 0x8B, 0x32, 0x2E, 0x86, 0x81, 0x4D, 0x53, 0xFA, 0x2A, 0x8D,
-    0x54, 0xD6, 0x7E, 0x20, 0xAE, 0x55, 0x56, 0xD6, 0x6C, 0xE9, 0xA5, 0x4F, 0x32, 0x57, 0x78, 0xCC,
-    0x41, 0x1F, 0x71, 0xE2, 0x17, 0xD6, 0x52, 0xA5, 0x7E, 0x61, 0xAB, 0xBC, 0xCC, 0xFE, 0xD7, 0xFD,
-    0x4F, 0xFE, 0x04, 0x77, 0x80, 0xDF, 0xFF, 0x0A, 0x15, 0x2D, 0x47, 0xAC, 0xEA, 0xF7, 0xB4, 0x84,
-    0xE1, 0x96, 0x7E, 0x19, 0x0C, 0xA9, 0x51, 0x95, 0xF5, 0x4A, 0x86, 0xD8, 0x72, 0x73, 0x92, 0xCA,
-    0x5E, 0xEF, 0x1D, 0xEB, 0xD9, 0x4D, 0x2A, 0x2B, 0x6A, 0x5F, 0xEF, 0x5A, 0x21, 0xE0, 0x77, 0xEF,
-    0x6B, 0x0A, 0xFE, 0xF4, 0xCF, 0x6F, 0xAC, 0xE8, 0x5E, 0x69, 0x1F, 0xD4, 0xCA, 0x07, 0x49, 0xF1,
-    0xF0, 0x53, 0x2B, 0xF7, 0xB2, 0x4F, 0x91, 0xAE, 0x52, 0x47, 0xB9, 0xD3, 0x9A, 0xD5, 0xA5, 0xBF,
-    0x8E, 0x1E, 0x30, 0x95, 0xDE, 0xD2, 0xFF, 0x61, 0x76, 0x84, 0xBC, 0x91, 0x0F, 0xAC, 0x02, 0xBC,
-    0x0D, 0x1D, 0xCC, 0x6E, 0xE0, 0xCF, 0x9C, 0xD4, 0xCD, 0x7B, 0xE7, 0x7B, 0x7B, 0xB8, 0x86, 0x8B,
-    0x9B, 0xB3, 0x48, 0x86, 0x19, 0x3F, 0x02, 0xCD, 0x06, 0x9E, 0xC2, 0x7F, 0x6D, 0xCD, 0xBD, 0xE2,
-    0x99, 0x78, 0xC4, 0x7C, 0x6C, 0xE1, 0x13, 0x02, 0x86, 0xD9, 0x53, 0x16, 0xA4, 0x82, 0x97, 0x7F,
-    0x25, 0x3E, 0x35, 0xFF, 0x2A, 0xC7, 0xD6, 0xC7, 0xC9, 0x37, 0xF9, 0xAF, 0xBF, 0x74, 0x91, 0x88,
-    0x44, 0x5B, 0x9B, 0xDE, 0x38, 0xC2, 0xEE, 0x5D, 0xD8, 0x2F, 0x93, 0xFD, 0x2F, 0x65, 0xFF, 0x3F,
-    0xC0, 0x5F, 0x84, 0xF9, 0x79, 0x99, 0xC1, 0x5F, 0x3F, 0x67, 0xCA, 0x16, 0x08, 0xFA, 0x2E, 0x46,
-    0x4D, 0x07, 0x47, 0x6D, 0x07, 0xFD, 0xF8, 0x12, 0xCE, 0x3F, 0xB4, 0x44, 0x6A, 0x91, 0x0D, 0x8B,
-    0x68, 0xC6, 0x10, 0xE4, 0x57, 0x45, 0x3F, 0x2A, 0x8F, 0x92, 0xB4, 0xD7, 0x15, 0xC7, 0x2C, 0x1A,
-    0x17, 0x30, 0x97, 0x83, 0xCA, 0x29, 0x0B, 0x38, 0x5A, 0xE9, 0x8F, 0x71, 0xFA, 0xE5, 0x60, 0x4D,
-    0x13, 0x53, 0x1E, 0xAD, 0x56, 0x96, 0xE5, 0x7A, 0x01, 0x87, 0xFC, 0xB9, 0x49, 0x55, 0xD5, 0x72,
-    0x43, 0x7A, 0x91, 0x0B, 0x63, 0xBC, 0xDD, 0x4A, 0x25, 0x92, 0xD1, 0x7A, 0x81, 0x6E, 0xE5, 0xBB,
-    0xD6, 0x2B, 0xF6, 0x64, 0x28, 0x47, 0x6E, 0x98, 0x4A, 0x11, 0xE8, 0xC8, 0xFD, 0xD7, 0xA9, 0xFA,
-    0xE7, 0xB7, 0x72, 0x3A, 0xF3, 0x84, 0x7B, 0x3A, 0x9C, 0x79, 0xFC, 0x05, 0xF4, 0x8F, 0xE7, 0x9A,
-    0x9A, 0x1A, 0x07, 0xC6, 0xF2, 0x04, 0x0F, 0x0A, 0x5D, 0x78, 0xC0, 0x33, 0x94, 0x6E, 0x3B, 0x62,
-    0xB8, 0x3A, 0xC4, 0x37, 0xB5, 0x8C, 0x5F, 0x37, 0x6D, 0x6B, 0x51, 0xDA, 0x5A, 0x42, 0x0B, 0xE3,
-    0x4A, 0xEF, 0x06, 0xEB, 0x55, 0xE6, 0x04, 0xB5, 0x3A, 0x5A, 0x35, 0x74, 0x9A, 0x18, 0xB6, 0x30,
-    0x3C, 0xC2, 0xBD, 0x9F, 0x61, 0x83, 0xDF, 0xDD, 0x69, 0x33, 0xE8, 0x74, 0xFE, 0x90, 0xEA, 0x50,
-    0xDD, 0x3B, 0xA9, 0xB0, 0xF2, 0xEC, 0x52, 0xA1, 0x6A, 0xB8, 0x8E, 0x26, 0x51, 0x03, 0xDC, 0x63,
-    0x42, 0xCC, 0xF3, 0x5A, 0x3D, 0x70, 0x3A, 0xCE, 0xB0, 0x3E, 0x6C, 0x06, 0xA3, 0x8A, 0x68, 0x57,
-    0x71, 0x7D, 0x13, 0xCD, 0x1A, 0x6E, 0x5F, 0x47, 0xA7, 0x85, 0xCE, 0x31, 0xBE, 0x4F, 0xB4, 0x0A,
-    0xAA, 0x67, 0xCD, 0x56, 0x07, 0xD3, 0xF2, 0xBA, 0x37, 0xAE, 0x08, 0xAD, 0x88, 0x16, 0x25, 0x18,
-    0xE6, 0xE9, 0xBB, 0xCD, 0x53, 0x52, 0x9C, 0xB2, 0x04, 0x6B, 0xC7, 0xA8, 0xBF, 0x8F, 0x9D, 0x1A,
-    0x5A, 0xD7, 0x41, 0x09, 0x23, 0xE8, 0xB0, 0x8D, 0x46, 0x05, 0x1F, 0x5E, 0x3C, 0xC5, 0x6E, 0xFD,
-    0x3E, 0x5A, 0x75, 0x96, 0x3B, 0x0D, 0x76, 0x68, 0x71, 0xC8, 0x05, 0xD3, 0xCE, 0x8E, 0x10, 0x7A,
-    0xFE, 0x7C, 0xF7, 0xC6, 0x0E, 0xF3, 0x1D, 0x40, 0xFF, 0x63, 0xD1, 0x80, 0xA1, 0xB5, 0x48, 0x6A,
-    0xCF, 0x3B, 0xB8, 0xCB, 0x91, 0x9F, 0x93, 0x78, 0xB7, 0x6B, 0x4D, 0xA7, 0x56, 0xAD, 0x5D, 0xAB,
-    0xDF, 0x70, 0x6E, 0xD9, 0xD2, 0x80, 0xFD, 0xD1, 0x89, 0xF1, 0x19, 0xF0, 0x6F, 0xE8, 0x82, 0x39,
-    0x87, 0xD5, 0xC2, 0x4E, 0x1D, 0x5B, 0x15, 0xFC, 0x17, 0xE5, 0x7D, 0x4F, 0x8C, 0xDE, 0xE8, 0x79,
-    0xDF, 0x4B, 0x52, 0xD2, 0x67, 0x2F, 0x11, 0x71, 0x0F, 0xBB, 0x6E, 0x6A, 0x45, 0xE2, 0x1E, 0x7C,
-    0x70, 0x76, 0xA5, 0x61, 0x0E, 0x46, 0x22, 0xA0, 0x23, 0x91, 0x6B, 0x1F, 0x72, 0x08, 0x50, 0xCF,
-    0x61, 0xB5, 0x01, 0xB2, 0x87, 0xCD, 0x25, 0x07, 0x27, 0x2D, 0x26, 0x07, 0xA1, 0x9D, 0x36, 0xDA,
-    0x21, 0x37, 0x46, 0xEB, 0x43, 0x0E, 0x56, 0x51, 0xDB, 0x01, 0xBA, 0x40, 0xA3, 0x02, 0x2E, 0xE0,
-    0x68, 0x81, 0x48, 0x6D, 0x55, 0x54, 0x01, 0x46, 0x43, 0xDA, 0x7B, 0xF0, 0xC1, 0x87, 0xD0, 0x69,
-    0x9D, 0x1C, 0x72, 0x08, 0x6D, 0x4B, 0xB1, 0xAB, 0x05, 0xBA, 0xB4, 0xFD, 0x6D, 0x4C, 0xCD, 0xF2,
-    0x23, 0xFB, 0xFC, 0x7E, 0xCF, 0x4B, 0x7E, 0xFC, 0x66, 0x46, 0xDA, 0x3F, 0xD6, 0x7A, 0xB5, 0xC9,
-    0x60, 0x87, 0xE4, 0x6A, 0xBE, 0x8F, 0x7C, 0xDF, 0xE7, 0x7D, 0xDE, 0xE7, 0xF9, 0x3D, 0x7F, 0x69,
-    0x8C, 0x7B, 0xC5, 0xC8, 0x8F, 0xDB, 0xE0, 0x68, 0x5A, 0x1E, 0xCF, 0xF3, 0x18, 0xF0, 0x38, 0x4B,
-    0xCC, 0xCA, 0x4F, 0xD4, 0xF7, 0x7D, 0x6D, 0x9E, 0xE1, 0xD1, 0x2C, 0x8C, 0x57, 0xE3, 0x4B, 0x4E,
-    0x65, 0x1C, 0x39, 0x96, 0xC6, 0x6D, 0x8D, 0x5B, 0x18, 0x8F, 0x37, 0xF3, 0xE6, 0x3C, 0xD6, 0xBC,
-    0x0B, 0x8F, 0xFE, 0x9B, 0x17, 0x36, 0xE4, 0xBE, 0x7D, 0x5F, 0xC9, 0xF1, 0xCE, 0x05, 0xB9, 0x73,
-    0x58, 0xE0, 0xDF, 0xF5, 0x18, 0x65, 0x38, 0xC6, 0x7C, 0x5E, 0xCC, 0x67, 0xA5, 0xC6, 0x1C, 0x37,
-    0x26, 0x37, 0xE6, 0x8C, 0x31, 0x9D, 0x31, 0xEB, 0x78, 0xA0, 0x3C, 0xED, 0x84, 0x3C, 0xBC, 0x31,
-    0xB9, 0x1C, 0xF1, 0x04, 0xC7, 0x1C, 0xC1, 0xAD, 0xCB, 0x48, 0xBE, 0x18, 0x54, 0xF8, 0xBA, 0x5F,
-    0xE2, 0xEB, 0x4E, 0x72, 0xE4, 0x91, 0x1E, 0xB9, 0xDC, 0xAC, 0xEF, 0xB3, 0x50, 0x8F, 0x49, 0x9C,
-    0x84, 0xC9, 0x19, 0xF9, 0x5A, 0x20, 0x9F, 0xCD, 0xE5, 0x78, 0xD6, 0xEC, 0xCA, 0xF1, 0x29, 0xF9,
-    0xDA, 0x47, 0x87, 0x65, 0x71, 0x78, 0x74, 0x79, 0xF4, 0xBA, 0x5E, 0x6E, 0xE8, 0xC9, 0x77, 0x39,
-    0xE6, 0xB4, 0xC2, 0x38, 0xFD, 0xB9, 0xF1, 0x2B, 0xFC, 0x6F, 0x50, 0x1A, 0xAF, 0xB5, 0xC7, 0x90,
-    0x1F, 0x88, 0x0A, 0x4C, 0x4A, 0xC6, 0x29, 0x1F, 0x93, 0x71, 0x06, 0x95, 0x49, 0x13, 0x13, 0x67,
-    0x1F, 0xEB, 0x6F, 0xFB, 0x9D, 0x89, 0xFB, 0x85, 0xFC, 0x03, 0x7E, 0x3E, 0xB7, 0x7C, 0x8E, 0xCE,
-    0xDE, 0xD7, 0x59, 0xF2, 0x8F, 0x9F, 0x32, 0x07, 0xE9, 0x59, 0x91, 0x9E, 0x15, 0xA6, 0xE7, 0x97,
-    0x18, 0xA7, 0x57, 0xE0, 0xFB, 0x72, 0x74, 0x79, 0x94, 0x47, 0xBB, 0xC9, 0x61, 0xF4, 0xE4, 0x51,
-    0x9F, 0x2A, 0xE3, 0x34, 0x0F, 0xA0, 0x67, 0x62, 0xE9, 0x69, 0x48, 0x4F, 0x43, 0x7A, 0x0E, 0xC7,
-    0x13, 0xFD, 0x97, 0xF0, 0xCF, 0x7D, 0xBB, 0x1C, 0x55, 0xD8, 0x5F, 0x36, 0x6E, 0x7F, 0x4D, 0x88,
-    0x50, 0xB9, 0x0B, 0xCC, 0xB2, 0x03, 0xE9, 0x17, 0x58, 0xD8, 0x1B, 0x7C, 0x2A, 0x1F, 0x1A, 0xE1,
-    0x39, 0x31, 0x0E, 0x69, 0xC6, 0x3B, 0xF4, 0x25, 0x0E, 0x85, 0xE9, 0x71, 0x8F, 0xC3, 0x0E, 0x7C,
-    0xB6, 0x7C, 0xD8, 0xC1, 0xD7, 0x02, 0x13, 0xCC, 0xCD, 0x2D, 0xD0, 0xBF, 0xC1, 0x97, 0xE5, 0x16,
-    0xCE, 0xC6, 0x38, 0x82, 0x5C, 0x86, 0x36, 0xDB, 0xCB, 0xE5, 0x53, 0x45, 0x20, 0xD4, 0xC6, 0x8C,
-    0x53, 0xE3, 0x55, 0xB2, 0xA0, 0x6E, 0xA6, 0xB7, 0x19, 0xEE, 0x25, 0x43, 0xC0, 0x60, 0x42, 0x30,
-    0xDD, 0xAC, 0x97, 0x89, 0x3A, 0x20, 0xA5, 0x89, 0xF1, 0xFF, 0x3E, 0xE6, 0xE4, 0x76, 0xFA, 0xFC,
-    0x23, 0xF8, 0xCE, 0x39, 0x1C, 0xB6, 0x8D, 0xDC, 0x27, 0x05, 0xA5, 0xE3, 0x0C, 0x2B, 0x7D, 0x6F,
-    0xB3, 0x92, 0xE9, 0x76, 0xF2, 0xDD, 0xA3, 0x09, 0xD7, 0xA4, 0x95, 0x15, 0xF9, 0xA1, 0x8E, 0x79,
-    0xA1, 0x6B, 0x09, 0x8E, 0xC1, 0xF4, 0xB1, 0x0A, 0x58, 0x03, 0xAC, 0x00, 0x28, 0x01, 0x42, 0x80,
-    0xF6, 0xA0, 0x39, 0x7E, 0x41, 0x75, 0x50, 0x1B, 0xBF, 0xA9, 0x1D, 0x65, 0xA7, 0xBF, 0x27, 0x84,
-    0xA8, 0x39, 0xB6, 0x8D, 0xC1, 0xA6, 0xF2, 0xAA, 0x18, 0x77, 0x90, 0xCF, 0xCC, 0xAA, 0x14, 0x1B,
-    0xED, 0x89, 0x55, 0xB6, 0x90, 0xE7, 0x71, 0x0C, 0x4A, 0xB8, 0xC5, 0xC0, 0x52, 0xE4, 0x5C, 0x6E,
-    0x30, 0xF2, 0x03, 0xD9, 0x81, 0xDC, 0xB0, 0x5C, 0x16, 0xB2, 0x02, 0x79, 0x80, 0x07, 0xF2, 0x01,
-    0x19, 0x80, 0x87, 0x74, 0xA4, 0x5D, 0x37, 0x1C, 0x30, 0x30, 0x3B, 0x32, 0x3D, 0x5D, 0xEB, 0x45,
-    0x9C, 0x79, 0xED, 0xF0, 0x90, 0xC3, 0xEE, 0x1F, 0xEC, 0xBB, 0x7F, 0xB6, 0x72, 0x7F, 0x1E, 0x76,
-    0x87, 0x81, 0x73, 0xE7, 0xBD, 0xCD, 0xE8, 0x0F, 0xB9, 0x31, 0x6F, 0x87, 0x9B, 0xFC, 0x1E, 0xBE,
-    0x90, 0x5F, 0x56, 0x99, 0x20, 0x3B, 0x85, 0xF7, 0xDC, 0xA4, 0x14, 0xC0, 0x4D, 0xB8, 0x0D, 0x71,
-    0x51, 0xEA, 0x23, 0xB1, 0x65, 0x16, 0x2A, 0x76, 0x0B, 0x2B, 0x8B, 0xFD, 0x4C, 0xF7, 0xA3, 0x09,
-    0x12, 0xD7, 0x5E, 0x58, 0x29, 0x25, 0xDB, 0xD2, 0xEB, 0xBE, 0x8A, 0x8B, 0x35, 0x70, 0x22, 0x46,
-    0x70, 0xCE, 0xCC, 0xDE, 0x7C, 0x01, 0x7F, 0x5C, 0x97, 0x49, 0x3B, 0x20, 0xD0, 0x16, 0x26, 0x0E,
-    0x9A, 0xCD, 0x31, 0x46, 0x3C, 0xAD, 0xC6, 0x38, 0x65, 0x80, 0x6E, 0x85, 0xB1, 0xCA, 0xBF, 0xC8,
-    0xC3, 0x85, 0x10, 0x29, 0x37, 0xBB, 0xFC, 0xBB, 0x2C, 0x5A, 0x28, 0xB2, 0x21, 0x71, 0x16, 0x24,
-    0x76, 0x0A, 0x6A, 0xC6, 0x0B, 0x2C, 0x66, 0x54, 0x83, 0x35, 0xFF, 0x09, 0x04, 0x96, 0x89, 0x4B,
-    0x11, 0x1B, 0xFD, 0x6D, 0x61, 0xBB, 0xE9, 0xC2, 0xCB, 0x30, 0x12, 0x2E, 0xFE, 0xB1, 0xDE, 0x72,
-    0xAE, 0x6E, 0x32, 0x4C, 0x8A, 0x74, 0xC6, 0x5C, 0x48, 0x1C, 0xCC, 0x85, 0xA2, 0x12, 0x73, 0x49,
-    0x07, 0xA1, 0x9B, 0x0F, 0x72, 0xA2, 0x1B, 0x44, 0x05, 0xA9, 0xE1, 0xEF, 0x5D, 0x7D, 0xB5, 0xBF,
-    0x9A, 0x18, 0x95, 0x99, 0xA0, 0x9D, 0xCC, 0xC5, 0x6D, 0x8E, 0xF5, 0x24, 0xB7, 0x7C, 0x51, 0x66,
-    0xA1, 0x17, 0xB2, 0xAF, 0x55, 0xC8, 0x45, 0x9C, 0x8B, 0x3F, 0x5E, 0x54, 0xB8, 0x48, 0xF9, 0xC5,
-    0x98, 0xBB, 0x30, 0x28, 0x54, 0x38, 0xE0, 0x8B, 0x1D, 0x1F, 0x18, 0x17, 0x3E, 0x24, 0xF4, 0xE5,
-    0x63, 0x94, 0x68, 0xC2, 0x4D, 0xF2, 0xB4, 0x7B, 0xE6, 0x80, 0x9C, 0x8E, 0xDE, 0x9B, 0x9C, 0xCE,
-    0x38, 0xCE, 0x12, 0x63, 0x93, 0x15, 0x91, 0xF1, 0xC8, 0xD8, 0x64, 0x30, 0xE3, 0x51, 0x86, 0x11,
-    0x70, 0x90, 0x01, 0x97, 0x43, 0xD7, 0x48, 0x17, 0x28, 0x2A, 0x44, 0x4E, 0x9B, 0xF8, 0x8E, 0xC8,
-    0x69, 0x13, 0x93, 0x32, 0x8F, 0x65, 0x4A, 0xF1, 0xC2, 0x2C, 0x85, 0xA3, 0x51, 0xA6, 0xF0, 0xAA,
-    0x43, 0xD5, 0xB6, 0xAE, 0x8F, 0x4F, 0x81, 0xFD, 0xC3, 0x19, 0x76, 0x4D, 0xAF, 0x03, 0x5D, 0xF0,
-    0x1B, 0x72, 0x19, 0x64, 0x1C, 0xF4, 0x79, 0x5D, 0x13, 0x65, 0x74, 0xDE, 0xCC, 0xAB, 0xF1, 0x27,
-    0x19, 0xF8, 0x9A, 0x6A, 0xC2, 0x1D, 0x32, 0xA1, 0xCA, 0xDC, 0xE0, 0xEF, 0x3A, 0x15, 0xDB, 0xBD,
-    0x9E, 0xB8, 0xC8, 0x51, 0xA6, 0xE2, 0x35, 0x09, 0x6A, 0x9E, 0xFC, 0xB9, 0xB1, 0x7C, 0x84, 0x15,
-    0x76, 0x17, 0xBA, 0x77, 0x7B, 0x3D, 0x89, 0x18, 0xC4, 0x26, 0x8E, 0xE7, 0xDC, 0xBF, 0x94, 0x7A,
-    0xE6, 0xE3, 0x76, 0xF0, 0x81, 0xCE, 0x4F, 0xC4, 0x8C, 0x9E, 0xDD, 0xDA, 0x4E, 0xE5, 0xA6, 0x3D,
-    0x7F, 0xD2, 0x1C, 0xF2, 0x03, 0x01, 0x84, 0xED, 0x00, 0x19, 0x44, 0xD9, 0x2C, 0x4F, 0xE2, 0x10,
-    0x16, 0x2A, 0x0A, 0x30, 0x6D, 0x48, 0x03, 0xB2, 0x60, 0xA9, 0x1C, 0x28, 0x92, 0x1F, 0xEB, 0xE3,
-    0xF1, 0x2C, 0x8B, 0xB1, 0x99, 0x91, 0xFD, 0x2E, 0x11, 0x4E, 0xD4, 0x6E, 0x1D, 0x13, 0x5C, 0xF8,
-    0x45, 0xCA, 0xBD, 0xBE, 0x46, 0x46, 0x0D, 0x8B, 0x86, 0xBB, 0x36, 0x7C, 0xAD, 0x24, 0x9B, 0x46,
-    0x5F, 0x4C, 0xC8, 0x00, 0xB2, 0x59, 0x48, 0xD9, 0xB8, 0x56, 0x26, 0x48, 0x2D, 0xAC, 0xC8, 0xAD,
-    0xE8, 0xE8, 0xAC, 0xF4, 0xE8, 0x74, 0x38, 0x32, 0x7B, 0x27, 0x5D, 0x24, 0x98, 0xBE, 0x07, 0x36,
-    0x31, 0xE6, 0x09, 0xF3, 0x11, 0xF2, 0x92, 0xA0, 0x06, 0x67, 0xE1, 0xE0, 0xA3, 0xD0, 0x4C, 0xBC,
-    0xF1, 0xCA, 0x4F, 0x8C, 0x6F, 0x34, 0x51, 0x7F, 0xC5, 0xED, 0x6F, 0x7B, 0xD8, 0x61, 0x7C, 0xDE,
-    0x39, 0x3E, 0xFD, 0x26, 0xA7, 0xCB, 0x9D, 0xE4, 0x96, 0x78, 0xB6, 0x08, 0x14, 0xB2, 0x2D, 0x16,
-    0xE4, 0x14, 0xC5, 0xDE, 0x3A, 0xE7, 0x70, 0x83, 0x33, 0xA2, 0x84, 0xFC, 0x1E, 0x1E, 0xE2, 0xFF,
-    0x80, 0x8B, 0xCD, 0xF5, 0xF4, 0x16, 0xC3, 0x0E, 0x1D, 0x68, 0xEF, 0x95, 0x23, 0x2A, 0x78, 0x9A,
-    0x1F, 0xD1, 0x31, 0x85, 0xFC, 0xA3, 0x33, 0xD2, 0xDF, 0xC5, 0x44, 0x84, 0xFE, 0x6E, 0x0E, 0xCD,
-    0x84, 0x6D, 0x5A, 0xE9, 0xEE, 0x80, 0x74, 0xC4, 0xF0, 0xC0, 0x20, 0x18, 0x2C, 0x24, 0x30, 0xEE,
-    0x0F, 0xFA, 0x82, 0x38, 0xB1, 0xDD, 0xFF, 0xA9, 0xDD, 0xFE, 0xB9, 0x15, 0xB0, 0x9D, 0x95, 0xE0,
-    0x0B, 0x2B, 0x6B, 0x5B, 0x95, 0xB4, 0x8E, 0x3D, 0x13, 0xBD, 0xCA, 0xBD, 0x38, 0xD4, 0xD8, 0x02,
-    0x8E, 0xD8, 0x0A, 0xE8, 0xD4, 0x9E, 0x73, 0x2B, 0xAB, 0x3B, 0x2B, 0xAE, 0x17, 0x7A, 0x06, 0x26,
-    0xC3, 0x3E, 0xCF, 0x29, 0x5B, 0x38, 0x81, 0xC6, 0xB2, 0x5F, 0xB5, 0xCA, 0x86, 0x41, 0x66, 0x26,
-    0xC0, 0x78, 0x79, 0x1E, 0x71, 0xA6, 0x53, 0x2F, 0xD1, 0xA3, 0xCF, 0x9B, 0x50, 0xB5, 0x9B, 0x73,
-    0xE4, 0xEA, 0x2D, 0x1E, 0x6B, 0x2A, 0x93, 0x6A, 0x41, 0x61, 0xCF, 0x69, 0x25, 0x64, 0x22, 0x4E,
-    0x79, 0x9D, 0xC7, 0x9B, 0x24, 0x03, 0x81, 0x9A, 0xB7, 0x77, 0x35, 0x4F, 0x64, 0x35, 0x40, 0xCF,
-    0x20, 0xC1, 0x14, 0xD7, 0x38, 0xE1, 0x75, 0x1E, 0x6F, 0x62, 0x6C, 0x78, 0x68, 0x50, 0x82, 0x68,
-    0x61, 0xF5, 0xE2, 0x3D, 0xE3, 0xE4, 0xF7, 0x44, 0x08, 0xCF, 0x44, 0xFE, 0x02, 0x9F, 0x95, 0xC4,
-    0x67, 0x05, 0xF1, 0x19, 0x8F, 0x33, 0xC5, 0x67, 0x19, 0xA8, 0x2F, 0x32, 0xE2, 0xBE, 0x78, 0x17,
-    0x14, 0x19, 0xF0, 0x6E, 0x89, 0xB9, 0x84, 0x05, 0x14, 0x82, 0x0A, 0x4B, 0x19, 0x46, 0x6F, 0xAC,
-    0xAE, 0x88, 0x29, 0x44, 0x53, 0x92, 0x33, 0xE7, 0x9A, 0x76, 0x66, 0x36, 0xC7, 0xFF, 0x0A, 0x32,
-    0x01, 0x6D, 0xC1, 0xD9, 0x50, 0x14, 0x32, 0x9E, 0xEE, 0x32, 0x94, 0x03, 0x95, 0xE0, 0xC2, 0x81,
-    0xA6, 0x68, 0xA1, 0x1E, 0x1C, 0x82, 0x54, 0xF9, 0x66, 0x58, 0x62, 0x3C, 0xA3, 0x20, 0xF7, 0x48,
-    0x01, 0x19, 0x0F, 0x36, 0xCA, 0x9B, 0x2F, 0xCC, 0x39, 0x9E, 0x0C, 0xF8, 0x7B, 0x73, 0x3E, 0x19,
-    0x4F, 0x6E, 0xAC, 0xFA, 0x92, 0x0F, 0x8F, 0xC7, 0x94, 0xCB, 0x9D, 0x1B, 0x15, 0xED, 0x90, 0x3C,
-    0x0B, 0x13, 0xCE, 0x39, 0x9E, 0x02, 0xE3, 0xB9, 0xF7, 0x28, 0xE2, 0x57, 0x6A, 0x1A, 0xB9, 0xD9,
-    0x63, 0xD4, 0x35, 0xF2, 0x0F, 0x3B, 0xF6, 0x39, 0x5B, 0xF6, 0x49, 0x37, 0xEC, 0xB3, 0x6A, 0x65,
-    0x49, 0xA7, 0xD6, 0xE7, 0xB9, 0x95, 0x6A, 0x02, 0xAF, 0x54, 0x25, 0xEB, 0x15, 0xFA, 0x54, 0x3F,
-    0xD3, 0xE7, 0x06, 0x89, 0x3D, 0x5B, 0x60, 0xB3, 0x66, 0xD5, 0xEA, 0xBA, 0x3D, 0x5F, 0xB2, 0x2A,
-    0x6B, 0xAE, 0xF2, 0x4A, 0x6E, 0xAB, 0x38, 0xA7, 0xD4, 0x89, 0xFB, 0x85, 0x4E, 0x3D, 0xB4, 0x93,
-    0x3F, 0x67, 0xE1, 0x63, 0xAF, 0xC3, 0x0C, 0xED, 0x39, 0xC2, 0x10, 0x61, 0x55, 0x90, 0x02, 0xFC,
-    0x18, 0xBF, 0xB3, 0x6E, 0xCF, 0x17, 0x71, 0x16, 0xC9, 0x73, 0x1D, 0xE7, 0x93, 0xC6, 0x6C, 0x0C,
-    0x5B, 0xE7, 0x51, 0xB3, 0x28, 0x67, 0x7D, 0x1D, 0xF6, 0xED, 0x4C, 0x56, 0x62, 0xD6, 0x57, 0x27,
-    0xAC, 0xB6, 0x8C, 0x47, 0x85, 0x29, 0xD4, 0x54, 0x9D, 0x09, 0xFA, 0xAA, 0xDA, 0x14, 0x8A, 0xCB,
-    0x9F, 0xD6, 0x54, 0x04, 0x88, 0x2C, 0x52, 0xF5, 0x34, 0xF7, 0xE6, 0x56, 0x61, 0x5D, 0xF2, 0xE6,
-    0x6A, 0x48, 0x99, 0x73, 0xB3, 0x3A, 0xB2, 0xC2, 0xFB, 0x05, 0x55, 0xA4, 0x14, 0x3C, 0xBA, 0xFE,
-    0x6E, 0xF7, 0xE2, 0x1D, 0x65, 0x8E, 0x59, 0x13, 0x14, 0xCA, 0x2C, 0x61, 0x6D, 0x95, 0xAA, 0xEC,
-    0x94, 0xA8, 0x50, 0x30, 0xD5, 0xCB, 0x32, 0x87, 0xA5, 0xCA, 0x67, 0xAB, 0x64, 0x45, 0xBF, 0xC5,
-    0x4A, 0x12, 0x59, 0x86, 0x54, 0xC9, 0x25, 0x9A, 0x75, 0x97, 0x2B, 0xEA, 0xF6, 0x83, 0xC2, 0x0D,
-    0x5B, 0x85, 0xF2, 0x95, 0x89, 0x2F, 0x0B, 0x1E, 0xAD, 0xAD, 0xE0, 0xC6, 0xB3, 0xB1, 0x25, 0xA2,
-    0x3D, 0x59, 0xC7, 0x3C, 0x11, 0x61, 0xBD, 0xC0, 0x12, 0xB7, 0xB8, 0xE3, 0x4D, 0xEE, 0xE6, 0x29,
-    0x90, 0x2E, 0x2D, 0x68, 0x7E, 0x9E, 0xC8, 0x46, 0xFE, 0xCF, 0x21, 0xE4, 0x54, 0xEE, 0x56, 0x00,
-    0xB0, 0x44, 0xD8, 0xC5, 0x19, 0x1C, 0xCE, 0xE3, 0x0F, 0xD8, 0x93, 0x49, 0x9C, 0x09, 0x2C, 0x0D,
-    0xEF, 0xC9, 0x0E, 0xA6, 0x8E, 0x58, 0x5A, 0x2D, 0x1F, 0x6A, 0x8D, 0x2D, 0x28, 0xD8, 0xD5, 0x55,
-    0x35, 0xBE, 0x9E, 0x93, 0xF5, 0x41, 0x45, 0x2B, 0x8A, 0xEF, 0xB3, 0x7F, 0x80, 0x48, 0xE5, 0x43,
-    0x83, 0x28, 0x53, 0xAB, 0xDA, 0x61, 0x79, 0xED, 0x29, 0x48, 0x8E, 0x07, 0x89, 0x99, 0xA8, 0xC4,
-    0x4C, 0xAD, 0xD5, 0x95, 0xAB, 0xD1, 0xA5, 0x92, 0x92, 0x7B, 0x5D, 0x25, 0x67, 0xAB, 0x62, 0x4C,
-    0x25, 0xE5, 0x9A, 0x85, 0xF7, 0xE7, 0xAC, 0x60, 0x5A, 0xB7, 0xA2, 0x69, 0xCB, 0x0A, 0xA7, 0xB9,
-    0x15, 0x4F, 0xB5, 0x22, 0x0E, 0x11, 0xD0, 0x14, 0xE0, 0xF2, 0x38, 0xEE, 0x1E, 0x11, 0x06, 0x6A,
-    0xE4, 0x26, 0x7A, 0xCE, 0xAD, 0xF1, 0x6D, 0xAD, 0x24, 0x31, 0xB2, 0x8E, 0x41, 0x63, 0xCA, 0x92,
-    0xD3, 0x98, 0x3E, 0xBA, 0xE4, 0x97, 0x02, 0xE2, 0x69, 0x2E, 0x14, 0x2F, 0x40, 0x30, 0xB9, 0x27,
-    0xF6, 0x5F, 0x88, 0x31, 0xE2, 0x7F, 0xE0, 0x38, 0x70, 0x5E, 0x97, 0x8B, 0xFF, 0x25, 0xA3, 0x71,
-    0x5F, 0x97, 0x21, 0xFC, 0x04, 0x36, 0xFF, 0x5F, 0xD7, 0xFC, 0x35, 0xDE, 0x6B, 0xB5, 0x99, 0xFD,
-    0x11, 0x2F, 0xC4, 0x1A, 0xC4, 0xC8, 0x66, 0x9F, 0x9F, 0x9B, 0x53, 0x18, 0x92, 0xFF, 0xE9, 0xC6,
-    0xAC, 0x43, 0xA9, 0x04, 0x32, 0xB1, 0x1B, 0x18, 0x54, 0x20, 0x33, 0xAD, 0x41, 0xF5, 0xD0, 0x69,
-    0xBD, 0x12, 0xC3, 0x3A, 0x65, 0xDA, 0x59, 0x06, 0x72, 0x9D, 0x31, 0x8B, 0x80, 0xF2, 0x74, 0xDD,
-    0x74, 0x6B, 0x16, 0xB7, 0xEC, 0xAE, 0x93, 0x62, 0x5B, 0x26, 0xBF, 0x41, 0xD5, 0x76, 0xD3, 0xA4,
-    0x35, 0x69, 0x27, 0x82, 0xA9, 0x24, 0xD1, 0xE4, 0x22, 0x03, 0xD5, 0x4E, 0x74, 0xF2, 0xDD, 0x13,
-    0xFD, 0x86, 0xAC, 0x8E, 0xB0, 0x46, 0x8A, 0x71, 0xCB, 0x2C, 0x1D, 0x28, 0x66, 0x61, 0x24, 0x27,
-    0xEF, 0x74, 0x1F, 0x70, 0xA5, 0x2D, 0x44, 0xE3, 0x3E, 0xB0, 0x88, 0x11, 0x63, 0x03, 0xD1, 0xA3,
-    0xC2, 0x22, 0xC6, 0x4C, 0x99, 0x14, 0x03, 0x03, 0xD1, 0x63, 0xD5, 0x0A, 0x17, 0x72, 0xAB, 0x50,
-    0x09, 0xB1, 0xEE, 0x5C, 0xB8, 0xD0, 0x59, 0x91, 0xB4, 0x98, 0x20, 0x47, 0x21, 0xBA, 0xF2, 0x7F,
-    0xA2, 0x08, 0x72, 0x40, 0x8E, 0xA9, 0xE5, 0xFF, 0xDC, 0xCA, 0x3D, 0xCB, 0xFF, 0x44, 0x8E, 0x76,
-    0x1F, 0xE4, 0x44, 0x8C, 0xF5, 0x8C, 0x06, 0xEF, 0xB8, 0x3C, 0x60, 0xF8, 0xFE, 0x1A, 0xD0, 0x49,
-    0x05, 0x74, 0xA2, 0xDA, 0x70, 0x81, 0xC1, 0x7A, 0x84, 0x50, 0xD4, 0x9B, 0x25, 0x1D, 0x2F, 0x15,
-    0x26, 0x10, 0x54, 0xB1, 0x1E, 0x01, 0x6B, 0x2A, 0x58, 0xE7, 0x61, 0x89, 0x81, 0x47, 0x65, 0x4F,
-    0x89, 0xCF, 0x63, 0xD6, 0x53, 0xB1, 0xF6, 0x94, 0xFC, 0x39, 0x6C, 0x02, 0x6E, 0xD0, 0x76, 0x69,
-    0xE0, 0x8A, 0x32, 0x80, 0x95, 0x2F, 0xA3, 0xEF, 0x28, 0x8A, 0x53, 0xEC, 0x46, 0xEB, 0x92, 0x8A,
-    0xAC, 0x7A, 0x86, 0x7E, 0xA5, 0x9F, 0x68, 0x61, 0x71, 0xCB, 0x04, 0x8D, 0x87, 0xF7, 0x43, 0xE3,
-    0xC9, 0x21, 0x68, 0xBC, 0x56, 0x14, 0xF1, 0x20, 0x34, 0xDE, 0x1E, 0x86, 0xC6, 0x13, 0xDD, 0x1B,
-    0x87, 0xA1, 0x71, 0x7B, 0x0E, 0xCB, 0x15, 0xDA, 0xFA, 0xDC, 0xB2, 0x82, 0x1A, 0x33, 0xA2, 0xC6,
-    0x56, 0x51, 0xA3, 0x99, 0xA0, 0x46, 0xA2, 0x83, 0x80, 0xA8, 0x51, 0xEE, 0xE1, 0xD1, 0xC5, 0x01,
-    0x99, 0x58, 0x5A, 0x0F, 0x80, 0x8C, 0x55, 0x84, 0x41, 0x50, 0xE1, 0x5B, 0x41, 0x79, 0x02, 0x33,
-    0x25, 0xC0, 0x0A, 0xEF, 0x7E, 0xF5, 0x03, 0xF1, 0x32, 0x26, 0xC3, 0xDD, 0x7F, 0x16, 0x2F, 0xE3,
-    0x3E, 0x7F, 0x44, 0x06, 0x7F, 0x84, 0x08, 0x46, 0xD9, 0x83, 0x31, 0xFD, 0x11, 0x29, 0xFD, 0x11,
-    0xBB, 0xF4, 0x47, 0xE8, 0x24, 0x16, 0x4B, 0xAF, 0x84, 0xF5, 0x4D, 0x4C, 0xD1, 0xD4, 0x7C, 0x3F,
-    0xAA, 0xF5, 0x27, 0xA8, 0x36, 0x98, 0xA2, 0xA9, 0x62, 0x54, 0xF0, 0xC7, 0xFA, 0x3B, 0x54, 0x6E,
-    0xDD, 0xA3, 0x6B, 0x85, 0x1A, 0x73, 0xE1, 0x39, 0x7E, 0x56, 0x7D, 0x6E, 0xD4, 0x9F, 0xC3, 0xF0,
-    0x9D, 0x9C, 0x3B, 0x21, 0xEA, 0xFA, 0x5C, 0x66, 0xDF, 0x27, 0xA9, 0x2B, 0x36, 0x4B, 0x0B, 0xC7,
-    0x2A, 0x14, 0xCC, 0x42, 0x66, 0x1A, 0xC1, 0xFD, 0x16, 0x42, 0xEC, 0x81, 0xC1, 0xD2, 0x04, 0xDA,
-    0xAC, 0xCA, 0x41, 0xB8, 0x40, 0x36, 0xA8, 0xD0, 0x2C, 0x94, 0x1D, 0xEA, 0x81, 0xC9, 0x72, 0xBA,
-    0xD4, 0x45, 0xDD, 0xFA, 0x70, 0xE6, 0xC5, 0x99, 0x9C, 0xC4, 0xF4, 0x2A, 0x82, 0x52, 0x6E, 0xE8,
-    0xCF, 0x83, 0x42, 0xF0, 0x98, 0xC8, 0xB6, 0x37, 0x20, 0x26, 0x04, 0x65, 0x5E, 0x1E, 0xC7, 0x30,
-    0xF0, 0x9C, 0xCF, 0x20, 0x86, 0x39, 0x76, 0xF5, 0x8A, 0x2A, 0xC1, 0x46, 0xE0, 0xA7, 0x7C, 0xF2,
-    0x36, 0xF0, 0x27, 0x78, 0x62, 0xC1, 0xCD, 0xEF, 0x70, 0x0B, 0x15, 0x9C, 0xB8, 0xDC, 0x3C, 0x23,
-    0x87, 0x51, 0x7B, 0x06, 0x35, 0xB5, 0xE7, 0xEC, 0x4D, 0xA5, 0x0C, 0x1D, 0x05, 0x44, 0x7C, 0x4B,
-    0x26, 0x76, 0xF4, 0xFF, 0x66, 0x2A, 0xAA, 0x42, 0x05, 0x91, 0xEB, 0xBA, 0x9C, 0x73, 0xAB, 0x98,
-    0x94, 0x69, 0x33, 0x62, 0xBD, 0x35, 0x55, 0xAC, 0x3B, 0x0A, 0x1E, 0x1B, 0x03, 0x47, 0xA2, 0xE8,
-    0x98, 0x13, 0xF4, 0x91, 0x27, 0x84, 0x34, 0x1F, 0x26, 0x1B, 0xBF, 0xB0, 0x36, 0xBE, 0x5A, 0xA2,
-    0xD6, 0xC6, 0x1F, 0x36, 0xDC, 0x18, 0xED, 0x5A, 0x9E, 0xCF, 0xD9, 0xF3, 0xFA, 0xBE, 0xF3, 0x13,
-    0x10, 0xAC, 0x73, 0xBF, 0xEF, 0x36, 0xFB, 0xEA, 0xB1, 0xFE, 0x1E, 0x68, 0x94, 0x66, 0xEA, 0xBE,
-    0xC4, 0x58, 0x52, 0x4E, 0x6A, 0xD7, 0x7A, 0x2D, 0x7D, 0x4E, 0x24, 0xA0, 0x15, 0x13, 0x0C, 0x72,
-    0xCA, 0x1D, 0xE4, 0x94, 0x18, 0xD4, 0x27, 0x6A, 0xBA, 0x05, 0x31, 0xFF, 0x1E, 0x9A, 0xFA, 0xE8,
-    0x73, 0xC1, 0xFD, 0xF6, 0x5D, 0xB6, 0x64, 0x1A, 0xBA, 0x8B, 0x8F, 0x59, 0x73, 0xBA, 0xE5, 0x21,
-    0xEC, 0xEB, 0x94, 0x90, 0xE0, 0x87, 0x27, 0xFA, 0x6A, 0x93, 0x98, 0x00, 0x88, 0x88, 0x4B, 0xD8,
-    0xD2, 0x98, 0x6D, 0xB8, 0x1E, 0xF2, 0x70, 0x0C, 0x13, 0x76, 0xED, 0x9C, 0x43, 0xF5, 0xF8, 0x0F,
-    0x18, 0xAE, 0x9E, 0xC0, 0x02, 0x1E, 0x4F, 0x18, 0xC9, 0x8C, 0xD8, 0x85, 0xD8, 0x80, 0x27, 0x62,
-    0x82, 0x0A, 0x03, 0xE3, 0x15, 0xFF, 0x01, 0x23, 0xC3, 0x49, 0xED, 0x4D, 0xB9, 0x92, 0x41, 0xE2,
-    0x2A, 0xCA, 0xAC, 0x19, 0x8E, 0x53, 0xAC, 0x2B, 0x1C, 0x73, 0x91, 0x76, 0xCD, 0x70, 0x5A, 0x98,
-    0xC1, 0x3E, 0x6F, 0x75, 0xBD, 0x16, 0x03, 0x7A, 0xC4, 0x58, 0xDB, 0x61, 0xCD, 0xFA, 0x6E, 0xC3,
-    0xAE, 0x5A, 0x6F, 0x91, 0xC2, 0x3F, 0xF0, 0xF9, 0xD2, 0xF5, 0x3C, 0xCE, 0xD7, 0x6A, 0x9B, 0x72,
-    0xB8, 0xF2, 0xC7, 0xAB, 0x59, 0x71, 0xC8, 0xD5, 0x68, 0x64, 0x2C, 0xDD, 0xBF, 0x0E, 0x35, 0x86,
-    0xAA, 0xBE, 0x1F, 0x02, 0x72, 0x62, 0x70, 0x67, 0xB8, 0xD9, 0xD6, 0x39, 0xA8, 0xB3, 0x1C, 0xC6,
-    0x53, 0xD6, 0x5F, 0x3D, 0xD5, 0x0C, 0x7B, 0x5F, 0xA2, 0xD4, 0x80, 0x20, 0xF2, 0xDF, 0x7C, 0x11,
-    0x5E, 0x77, 0xA2, 0x1A, 0xA1, 0x45, 0x4F, 0x0E, 0xCD, 0x49, 0x83, 0x74, 0xF4, 0xBF, 0xD0, 0xAF,
-    0x3E, 0xF8, 0x83, 0x34, 0x7C, 0x30, 0x6B, 0x30, 0xD7, 0x68, 0xF0, 0x04, 0xA5, 0xFD, 0xC8, 0xBA,
-    0x03, 0xE0, 0x33, 0x23, 0xE2, 0x53, 0xC8, 0xD7, 0x9A, 0x25, 0xE6, 0x1B, 0x41, 0xDF, 0x88, 0xFA,
-    0x54, 0x98, 0xCC, 0xCD, 0x12, 0xF7, 0x29, 0xF0, 0xC3, 0x50, 0x53, 0x4A, 0xD3, 0x5E, 0x9D, 0x1E,
-    0x74, 0x12, 0x11, 0xA7, 0x94, 0x72, 0x03, 0x0B, 0xFA, 0xBA, 0x41, 0xA6, 0xF4, 0x03, 0xFC, 0xCB,
-    0x5D, 0x8B, 0xFF, 0x7A, 0x15, 0x2B, 0x32, 0xDA, 0x01, 0x01, 0x2E, 0x3C, 0x15, 0x28, 0x6E, 0x6B,
-    0x31, 0xA0, 0x3F, 0xF7, 0x15, 0x93, 0xA6, 0x15, 0x18, 0x06, 0x33, 0x7A, 0x56, 0xA1, 0x0A, 0xA4,
-    0x35, 0x84, 0xEB, 0xFE, 0xD0, 0xD7, 0x83, 0x83, 0x47, 0x18, 0x33, 0xC7, 0xCB, 0xB1, 0x72, 0x9C,
-    0x1C, 0x23, 0xC6, 0xC7, 0xB1, 0xA9, 0x87, 0x0D, 0x63, 0x52, 0xFF, 0x1A, 0xDD, 0x6B, 0x18, 0x07,
-    0xC7, 0x40, 0x8A, 0x5A, 0xD7, 0x9A, 0x4A, 0x79, 0x19, 0x4B, 0xA8, 0x16, 0x7C, 0x00, 0x0B, 0x5E,
-    0x1E, 0x45, 0xCE, 0xBA, 0x69, 0x11, 0x40, 0xB7, 0x1F, 0x6F, 0x38, 0x17, 0x2E, 0xF4, 0x10, 0x42,
-    0x9D, 0x5C, 0x3D, 0x8F, 0xBF, 0x62, 0xCD, 0x26, 0x63, 0xA5, 0x32, 0xF0, 0xEB, 0x33, 0x60, 0xC0,
-    0xD1, 0x82, 0x47, 0xDC, 0xB1, 0x85, 0x05, 0x5F, 0x99, 0x19, 0xF5, 0xFF, 0xD1, 0x64, 0xBF, 0x49,
-    0xCB, 0xA0, 0x1C, 0xC8, 0xD0, 0xBF, 0xDA, 0xF0, 0x41, 0x72, 0xA3, 0x9C, 0x94, 0x0B, 0xE9, 0xA1,
-    0x12, 0x92, 0x68, 0xC0, 0x86, 0xD3, 0xA1, 0x48, 0x6C, 0xF0, 0x54, 0x59, 0x7F, 0x31, 0x10, 0x1B,
-    0xE2, 0x10, 0xAF, 0xF6, 0x35, 0x4C, 0x39, 0xAB, 0xC1, 0x16, 0xF2, 0x2B, 0x2C, 0x58, 0xF1, 0x22,
-    0x20, 0x47, 0xE2, 0xE2, 0x4E, 0xAA, 0x9B, 0x34, 0xA4, 0x63, 0x24, 0x2C, 0xED, 0x05, 0x83, 0x40,
-    0xB8, 0xE0, 0xF6, 0xC4, 0x05, 0x80, 0x78, 0x02, 0x7D, 0xD4, 0x63, 0x69, 0x23, 0x55, 0x2A, 0xB9,
-    0x85, 0x8E, 0x20, 0xA9, 0xCA, 0x80, 0x8E, 0xB1, 0x74, 0x35, 0x1F, 0xFB, 0x57, 0x16, 0x1A, 0x52,
-    0x8C, 0xC6, 0x7D, 0xF8, 0x9C, 0x9E, 0x36, 0xE9, 0x50, 0x95, 0xED, 0x04, 0xBE, 0x4D, 0x2F, 0xD3,
-    0x50, 0x5F, 0x90, 0x67, 0x81, 0x43, 0x0B, 0x8A, 0x12, 0xF0, 0xAB, 0x62, 0x73, 0x9C, 0xC0, 0xAB,
-    0x7E, 0x3D, 0x98, 0x28, 0xB1, 0xD2, 0x17, 0x5C, 0x2A, 0x9A, 0x75, 0x57, 0x43, 0x83, 0x9D, 0x7A,
-    0x0B, 0xB8, 0x50, 0xCA, 0x9D, 0xEE, 0x82, 0xA7, 0x59, 0x43, 0xC5, 0x17, 0xD4, 0xE4, 0x9C, 0xA8,
-    0x54, 0xF6, 0xCC, 0xC8, 0x93, 0xBD, 0xCA, 0xB0, 0x96, 0x3B, 0x27, 0x9A, 0x2B, 0x70, 0xCE, 0x26,
-    0x36, 0x89, 0xD3, 0xFF, 0x48, 0x60, 0xE4, 0x9D, 0xBC, 0xD0, 0xE9, 0xCB, 0x02, 0x64, 0x72, 0xB7,
-    0x28, 0x81, 0x6B, 0x15, 0x72, 0x2E, 0x66, 0x50, 0x10, 0xA3, 0xDD, 0x05, 0xC7, 0x2D, 0x0C, 0x01,
-    0x4F, 0x8C, 0x48, 0x63, 0x9C, 0xC8, 0x18, 0xE3, 0xE4, 0xB8, 0x1C, 0xB2, 0x5F, 0x46, 0x02, 0xC1,
-    0x7F, 0x6B, 0x1E, 0x0F, 0xFA, 0x6F, 0xC3, 0xE4, 0x31, 0x72, 0xBF, 0x0D, 0xEB, 0xF5, 0xFE, 0x04,
-    0x9E, 0x32, 0xC7, 0x6E, 0xA8, 0xE1, 0xD1, 0x11, 0x81, 0x09, 0x68, 0x15, 0xDF, 0xB1, 0xB0, 0x93,
-    0x78, 0xCD, 0x2B, 0x44, 0x75, 0xFA, 0xBF, 0x8E, 0x3F, 0xC6, 0x5F, 0x69, 0xCD, 0xA9, 0x16, 0x6B,
-    0x00, 0x72, 0xC4, 0x95, 0x2E, 0x54, 0x04, 0x2B, 0x3F, 0x2A, 0x18, 0xEA, 0x4A, 0x2D, 0xA3, 0xC5,
-    0x09, 0xDD, 0xB8, 0x14, 0x9E, 0x31, 0x31, 0x3F, 0x24, 0xBA, 0x98, 0x50, 0x95, 0x70, 0x02, 0x10,
-    0x32, 0x7D, 0xB8, 0xA3, 0x69, 0x3C, 0x93, 0xBB, 0xC7, 0xAF, 0xB4, 0xF2, 0x39, 0xEC, 0xDB, 0x85,
-    0x4C, 0x6B, 0x11, 0x16, 0x4E, 0x1B, 0x27, 0x7E, 0x1D, 0x3F, 0x9F, 0x67, 0x29, 0xDC, 0x7B, 0x17,
-    0xF2, 0x44, 0x76, 0x57, 0x29, 0x58, 0xAF, 0xDE, 0x15, 0x4E, 0xC3, 0x6F, 0x2A, 0xD7, 0x71, 0x16,
-    0x54, 0xC2, 0x4A, 0x19, 0x5D, 0x60, 0x47, 0x47, 0x3E, 0x4E, 0xE0, 0x9A, 0x71, 0xAB, 0xA0, 0x76,
-    0x92, 0x69, 0xE4, 0x5C, 0xB8, 0xCC, 0x81, 0xE0, 0xBB, 0x4D, 0xB7, 0x03, 0x56, 0x7D, 0x1A, 0x2F,
-    0x97, 0x2D, 0x2A, 0x8B, 0x13, 0xC2, 0x6A, 0xA1, 0xA1, 0x6E, 0x9E, 0x84, 0xBE, 0xFE, 0x53, 0xAE,
-    0xAD, 0x7C, 0xF4, 0x89, 0x59, 0x33, 0x02, 0xF2, 0x7C, 0xF4, 0x4A, 0x6A, 0x84, 0xDB, 0x3A, 0xCE,
-    0xFC, 0xFE, 0x9A, 0x48, 0xD6, 0x57, 0xFA, 0x42, 0x66, 0x9B, 0x63, 0xB6, 0x71, 0x11, 0x80, 0x42,
-    0xB2, 0x3C, 0x42, 0xAB, 0x91, 0x38, 0xBB, 0xF8, 0x2E, 0x05, 0x2D, 0x55, 0x09, 0xD5, 0xCA, 0xAE,
-    0x71, 0xE7, 0x26, 0xD5, 0x14, 0x8F, 0x80, 0xEB, 0x0E, 0x24, 0x38, 0x5F, 0x25, 0x93, 0xEC, 0xC0,
-    0x57, 0x6A, 0xD3, 0x7A, 0x8D, 0x57, 0xBB, 0xAD, 0x2F, 0x42, 0x27, 0x14, 0xDB, 0x34, 0x4E, 0x84,
-    0x0C, 0xC2, 0x5C, 0xE9, 0xF3, 0xB2, 0xB8, 0xF2, 0x8D, 0xFE, 0xB9, 0x31, 0xF4, 0xCF, 0x71, 0x0A,
-    0x00, 0xCD, 0xE2, 0xD2, 0xCF, 0x64, 0xEB, 0xC9, 0x1D, 0x9B, 0x69, 0xD4, 0x37, 0x41, 0xF2, 0xC9,
-    0x4B, 0x26, 0x12, 0x0B, 0xBE, 0x15, 0x63, 0x65, 0xB1, 0xEB, 0x15, 0x0B, 0xB9, 0x7D, 0x1D, 0x7B,
-    0x32, 0x94, 0x76, 0x46, 0xD7, 0x9F, 0xD3, 0x04, 0xD9, 0x27, 0xE5, 0xEC, 0xCE, 0x43, 0x4E, 0x55,
-    0xFE, 0x6A, 0xA6, 0x67, 0xB5, 0xD2, 0x4D, 0x7A, 0x6D, 0x8F, 0xE7, 0x6D, 0xBF, 0xBC, 0x85, 0xF3,
-    0x4E, 0x50, 0x68, 0x0C, 0x9E, 0xE7, 0x5F, 0x74, 0xE6, 0x61, 0xB6, 0x0B, 0x67, 0x6A, 0x1D, 0x66,
-    0xB9, 0xB9, 0xBC, 0x33, 0x2B, 0xA2, 0x24, 0x7E, 0xB6, 0x4C, 0xC5, 0x08, 0x82, 0x67, 0x24, 0x5A,
-    0x80, 0xA7, 0x45, 0x96, 0x25, 0x2B, 0xE2, 0x28, 0x71, 0xBA, 0xCD, 0xCA, 0xAB, 0xE1, 0x81, 0x15,
-    0xE1, 0x52, 0x8C, 0x4B, 0x59, 0xA9, 0xDA, 0x96, 0xB9, 0x3C, 0x3D, 0xB8, 0x06, 0x7C, 0x2A, 0xFF,
-    0xD3, 0xF2, 0xBB, 0x23, 0x0B, 0x7B, 0x0B, 0xCC, 0xF8, 0xE5, 0x5E, 0x36, 0xBA, 0x7C, 0xE5, 0x82,
-    0x8C, 0x52, 0xB6, 0x59, 0x11, 0x41, 0x46, 0x23, 0x48, 0x91, 0x21, 0x46, 0x01, 0xC6, 0x88, 0x19,
-    0xA7, 0xD0, 0x24, 0x0F, 0x1F, 0x49, 0x1E, 0x3E, 0x7C, 0x6C, 0x01, 0xEC, 0x87, 0xA0, 0x70, 0xEC,
-    0xC7, 0x23, 0x00, 0xEB, 0x28, 0x39, 0x2E, 0x1F, 0x4F, 0x7E, 0x55, 0xAE, 0x5E, 0xFE, 0xDE, 0xFC,
-    0xF1, 0xB0, 0xFF, 0x43, 0xB1, 0x71, 0x3B, 0x23, 0x02, 0x3B, 0x19, 0x43, 0x48, 0x6E, 0xE1, 0xC2,
-    0xB0, 0xF1, 0x21, 0xD6, 0xE0, 0x67, 0x07, 0x3E, 0x74, 0x76, 0xA7, 0x33, 0x7A, 0x9F, 0x87, 0x11,
-    0xCB, 0x3A, 0xCE, 0xB1, 0x98, 0x95, 0x4B, 0x86, 0x6A, 0x10, 0x15, 0x98, 0x23, 0x14, 0x50, 0x07,
-    0xB0, 0xE0, 0xCF, 0x60, 0x17, 0xDC, 0xB0, 0x66, 0x4B, 0xF0, 0x16, 0x1D, 0x33, 0x04, 0xD9, 0xD8,
-    0x13, 0xF0, 0x0E, 0xD1, 0x55, 0x17, 0x43, 0x03, 0xC5, 0xEA, 0x95, 0xF6, 0x3A, 0x24, 0xAD, 0x88,
-    0xED, 0xEB, 0x12, 0x7A, 0xBB, 0x39, 0x17, 0xFB, 0x14, 0x05, 0xDF, 0x49, 0x6E, 0x85, 0xD3, 0x54,
-    0x94, 0xEB, 0x14, 0x77, 0x5B, 0x0E, 0x76, 0xC8, 0x75, 0x17, 0x5C, 0x5B, 0x63, 0xA1, 0x9C, 0x0A,
-    0x47, 0xB7, 0x24, 0x6E, 0xC3, 0x7E, 0x30, 0x7E, 0x86, 0x85, 0x0A, 0x29, 0x6A, 0xB7, 0x71, 0x7C,
-    0x9A, 0xE0, 0x3A, 0x45, 0x4A, 0x55, 0x21, 0x66, 0xDE, 0xAC, 0x23, 0x39, 0x37, 0xC0, 0xFC, 0x05,
-    0x79, 0xD8, 0xCD, 0x4B, 0x75, 0x12, 0xC2, 0x33, 0x40, 0x08, 0x20, 0xA2, 0x88, 0x08, 0xA0, 0x36,
-    0x6B, 0xD6, 0x01, 0xFA, 0x6F, 0xF1, 0xDC, 0x7F, 0x5D, 0xD3, 0x63, 0x66, 0xFE, 0x7B, 0xED, 0xFE,
-    0x6F, 0x48, 0xAE, 0x1F, 0xCF, 0x67, 0x9F, 0xC7, 0x18, 0xBE, 0xDB, 0x04, 0x60, 0x18, 0xB7, 0x68,
-    0xCE, 0xE0, 0xD9, 0x5E, 0xD1, 0x9E, 0x25, 0x52, 0x4C, 0xDA, 0x1A, 0xA3, 0x08, 0xCD, 0x6E, 0xA9,
-    0xA3, 0xC9, 0xB3, 0x90, 0xE3, 0xA1, 0x4C, 0x95, 0x11, 0x9D, 0x93, 0x31, 0x25, 0x32, 0xA6, 0x75,
-    0xE3, 0x2F, 0xEC, 0x22, 0x27, 0xE3, 0x12, 0x06, 0x05, 0x54, 0x3E, 0x25, 0x72, 0xE6, 0x62, 0x4D,
-    0xB8, 0x84, 0x5E, 0xAD, 0x7B, 0x78, 0x17, 0xE0, 0x40, 0x96, 0x70, 0xEF, 0x6A, 0x3B, 0x5D, 0xC7,
-    0xE9, 0xC7, 0x49, 0xDE, 0xE6, 0x71, 0x91, 0x8C, 0x7D, 0x2D, 0x34, 0xB6, 0xC1, 0xE3, 0xE5, 0x4E,
-    0x37, 0xF1, 0x1F, 0x13, 0x11, 0xE7, 0x1A, 0x4B, 0x63, 0x66, 0x01, 0x61, 0x2C, 0xC5, 0x6D, 0x6C,
-    0x06, 0x71, 0x4B, 0xD8, 0xD6, 0x59, 0x89, 0x92, 0xAB, 0x44, 0xD9, 0xA5, 0x9A, 0x1E, 0xBF, 0x28,
-    0x02, 0x32, 0xD1, 0xAD, 0xBF, 0xDC, 0xFB, 0x71, 0xEB, 0xB7, 0xE6, 0x99, 0x36, 0x16, 0x99, 0xD0,
-    0xD6, 0x69, 0xE2, 0xEE, 0xC9, 0xFA, 0x8B, 0xE5, 0x29, 0x03, 0x6B, 0x39, 0x30, 0xE5, 0xC7, 0x6D,
-    0xE5, 0xC7, 0x60, 0x1F, 0x3F, 0x66, 0x0E, 0xE7, 0x01, 0x1D, 0x83, 0xC9, 0x08, 0xA7, 0x2D, 0xE7,
-    0x51, 0x2C, 0xE7, 0x21, 0x06, 0x6D, 0x9F, 0xB9, 0xF9, 0x37, 0xA1, 0x88, 0xFF, 0x33, 0xB8, 0xF7,
-    0x06, 0xF8, 0xB8, 0xC2, 0xF7, 0x0A, 0xD7, 0xAA, 0xAA, 0x14, 0x6C, 0xBA, 0x8B, 0x07, 0x5A, 0xD0,
-    0x33, 0x43, 0xEC, 0xC2, 0xAF, 0x1C, 0xA8, 0x63, 0x92, 0x0B, 0xA9, 0x17, 0x32, 0x15, 0x18, 0x07,
-    0xDD, 0x0B, 0x35, 0x30, 0x6D, 0x26, 0x1B, 0x64, 0xE3, 0xF0, 0x84, 0x20, 0xCD, 0x0A, 0xBA, 0xAD,
-    0x7B, 0x6D, 0x45, 0xBD, 0x34, 0xA6, 0x75, 0x45, 0xB4, 0x89, 0x40, 0x2A, 0xCD, 0x5C, 0xBE, 0x90,
-    0x30, 0x5D, 0xCA, 0x1C, 0x48, 0x97, 0x5A, 0xCA, 0x4D, 0x23, 0x72, 0xB3, 0x10, 0xB9, 0xD9, 0x1D,
-    0x90, 0x9B, 0x4A, 0x3D, 0xD1, 0xA4, 0x20, 0xA0, 0x07, 0xED, 0x29, 0x34, 0xFC, 0xE7, 0x32, 0x72,
-    0x90, 0x71, 0xCB, 0x43, 0x7C, 0xC4, 0xC4, 0xE0, 0x7D, 0x10, 0xB3, 0xF0, 0x18, 0x93, 0x83, 0x98,
-    0x1E, 0xB7, 0xF8, 0xB0, 0xCB, 0x07, 0xC2, 0x5A, 0xDA, 0x0E, 0xDB, 0x7D, 0xA0, 0xB0, 0x12, 0x39,
-    0x4A, 0x2C, 0xBF, 0x24, 0x56, 0x52, 0xBC, 0xAC, 0xE7, 0xA8, 0x97, 0xF5, 0x91, 0x73, 0x60, 0x43,
-    0xDE, 0x83, 0xF0, 0xF4, 0x04, 0x1D, 0x36, 0x6E, 0xCF, 0x95, 0xCC, 0xE8, 0x11, 0x11, 0xD9, 0x2E,
-    0x37, 0xBF, 0x84, 0xC7, 0xED, 0xE0, 0xD9, 0x34, 0xA1, 0x80, 0xD3, 0x1C, 0x58, 0xB4, 0x08, 0x9B,
-    0x36, 0x30, 0x3F, 0x5A, 0xF8, 0x76, 0x5A, 0xB8, 0x76, 0x6E, 0xC1, 0x6E, 0xDE, 0xBE, 0x38, 0x24,
-    0xB9, 0x45, 0xD6, 0xE1, 0x6D, 0xB3, 0x09, 0x4F, 0x0F, 0x69, 0x1C, 0x44, 0x08, 0x20, 0xFE, 0x3F,
-    0xA3, 0x9B, 0xB3, 0x1D, 0x3E, 0x3F, 0x52, 0xEA, 0x77, 0x19, 0x60, 0xA3, 0x1A, 0x0B, 0x0A, 0x6E,
-    0xDA, 0x64, 0x3E, 0xC6, 0xF3, 0xB6, 0x79, 0xBC, 0x35, 0xE6, 0xAE, 0xFA, 0xDD, 0x02, 0x00, 0xF8,
-    0x85, 0xFE, 0x8D, 0xDA, 0x15, 0x4C, 0xE9, 0xCD, 0x67, 0xB5, 0x3B, 0x77, 0x1B, 0xC4, 0xC7, 0x1D,
-    0x68, 0x3A, 0x39, 0xC6, 0xD9, 0xAC, 0x22, 0x30, 0x90, 0x63, 0x4A, 0xD8, 0x9D, 0x93, 0x4D, 0x3A,
-    0x39, 0x7A, 0x73, 0x01, 0x08, 0x82, 0xAD, 0xC4, 0x64, 0x11, 0xE0, 0xB0, 0x4B, 0x7C, 0x24, 0x88,
-    0x17, 0x3B, 0x46, 0xEC, 0x26, 0x41, 0x2D, 0xAF, 0xF7, 0xFF, 0x5E, 0x38, 0xAB, 0x23, 0x02, 0xDD,
-    0x68, 0x9F, 0x18, 0x53, 0x66, 0x1D, 0xF5, 0x4E, 0x61, 0x60, 0xA7, 0x89, 0xEE, 0x2F, 0xCD, 0xC0,
-    0x59, 0xDB, 0x21, 0x19, 0x6A, 0x31, 0x21, 0x6D, 0xCA, 0x1C, 0x43, 0x51, 0x49, 0xF7, 0x20, 0x49,
-    0x7D, 0x7A, 0xB1, 0x03, 0xFA, 0xE4, 0xE8, 0x77, 0x68, 0xB7, 0x98, 0x7F, 0x56, 0xDB, 0x8F, 0x8E,
-    0x86, 0xBF, 0x3A, 0x6D, 0x72, 0x86, 0x7B, 0xFF, 0x06, 0xF4, 0x99, 0x7D, 0x93, 0x84, 0x23, 0x1C,
-    0x3C, 0xE7, 0xAA, 0xF1, 0x2B, 0xCF, 0x39, 0x51, 0x1B, 0x41, 0x2E, 0x22, 0x71, 0xD2, 0xF2, 0x61,
-    0xAB, 0x8A, 0xA7, 0x46, 0x55, 0x71, 0x5D, 0x84, 0xD8, 0xE3, 0x0C, 0x6C, 0x94, 0x76, 0x65, 0x5D,
-    0x40, 0xCE, 0x60, 0xF0, 0xDC, 0x20, 0xBC, 0x2B, 0x0A, 0x5B, 0xC6, 0x8B, 0xA7, 0x5D, 0xE3, 0x83,
-    0x20, 0xD0, 0x66, 0x95, 0x7A, 0x46, 0x28, 0xAF, 0xF9, 0x34, 0xBB, 0x43, 0x41, 0x79, 0xD1, 0x78,
-    0x9B, 0xD8, 0x9A, 0x6F, 0xC9, 0xBC, 0xAE, 0xFE, 0x7A, 0x35, 0x18, 0xBB, 0xCB, 0x1D, 0x1A, 0x94,
-    0x08, 0x71, 0x31, 0xEE, 0x45, 0x98, 0xB0, 0xA1, 0x13, 0x34, 0x2D, 0xA7, 0xE8, 0x34, 0x9E, 0x0A,
-    0x46, 0x3B, 0x4D, 0x3B, 0x51, 0x3B, 0x55, 0xCA, 0xA1, 0x59, 0x65, 0xA7, 0x6B, 0x27, 0x6C, 0xA7,
-    0xCC, 0x49, 0x47, 0x05, 0xA7, 0x1D, 0x67, 0x32, 0x71, 0x01, 0x5E, 0x49, 0x94, 0x04, 0x73, 0x18,
-    0x5F, 0xC9, 0xAF, 0xCD, 0x3D, 0x59, 0xF7, 0x97, 0xBF, 0xDF, 0x9C, 0x8A, 0x93, 0xB0, 0x7F, 0xB9,
-    0x6F, 0xE2, 0x4E, 0x48, 0x90, 0x97, 0xB2, 0x63, 0xA0, 0x2F, 0x9D, 0xC4, 0x0E, 0xC2, 0xD8, 0x51,
-    0x18, 0x3B, 0x0C, 0x33, 0x90, 0x7B, 0xA0, 0xF8, 0x40, 0x74, 0x3B, 0x94, 0x91, 0xF4, 0xFE, 0x61,
-    0xFB, 0x17, 0x4E, 0x7D, 0x1D, 0x8F, 0xB1, 0x03, 0x32, 0x76, 0x44, 0xC3, 0x90, 0xEC, 0x98, 0x3E,
-    0x6D, 0x74, 0x50, 0xBD, 0xD1, 0x51, 0xF5, 0x46, 0x87, 0x75, 0xDC, 0xEE, 0x9E, 0xD3, 0x16, 0x57,
-    0x58, 0x49, 0x16, 0xCF, 0xAD, 0xEF, 0x4B, 0xFD, 0x08, 0xCE, 0x3D, 0xFB, 0xE7, 0x72, 0xB9, 0xFD,
-    0x23, 0x61, 0x6E, 0x41, 0x64, 0xE5, 0x39, 0x19, 0xEE, 0x45, 0x99, 0xCF, 0x75, 0x2C, 0x43, 0x44,
-    0x7F, 0x20, 0xA3, 0xC4, 0x70, 0x08, 0x20, 0xB3, 0x15, 0x6B, 0x26, 0x4C, 0xD5, 0x40, 0xBE, 0xC8,
-    0x44, 0x1B, 0x48, 0xD9, 0xA0, 0xF0, 0x6B, 0xFF, 0xDE, 0x66, 0xE1, 0xC0, 0x90, 0x11, 0xC3, 0x10,
-    0xDB, 0x39, 0x6D, 0x90, 0x4F, 0xB3, 0xD9, 0x68, 0x0A, 0xAA, 0xE2, 0x2F, 0xBA, 0x63, 0xB0, 0x28,
-    0x42, 0x08, 0x28, 0x56, 0x59, 0x12, 0xB9, 0x73, 0x50, 0x06, 0x7A, 0x6F, 0xB9, 0x7B, 0x88, 0xF5,
-    0x98, 0x8B, 0xBA, 0xC2, 0x13, 0x12, 0x3C, 0x03, 0xBB, 0x50, 0x90, 0x2A, 0xE8, 0x32, 0xC7, 0xBE,
-    0x14, 0x60, 0x6F, 0x66, 0xF2, 0xAC, 0xB8, 0xC3, 0xD3, 0xC2, 0x06, 0xCF, 0xE3, 0x6A, 0x60, 0x25,
-    0x68, 0xD7, 0x61, 0x3B, 0xAE, 0x24, 0xBD, 0xCA, 0x33, 0x7C, 0x3E, 0xC1, 0xC7, 0xE8, 0x9B, 0xB0,
-    0x00, 0xFA, 0x1D, 0x7E, 0x65, 0xF4, 0x72, 0x4F, 0xDC, 0xD1, 0x00, 0xA1, 0x0C, 0x66, 0x6D, 0x24,
-    0x88, 0xB2, 0xDB, 0x2C, 0x15, 0x41, 0x8A, 0x44, 0xD1, 0xBC, 0xCC, 0xD6, 0xA2, 0xF8, 0xD6, 0x3C,
-    0xFD, 0xAA, 0x88, 0xC8, 0x5E, 0x1D, 0xA5, 0x7C, 0xDA, 0xAC, 0x16, 0x04, 0x59, 0xEE, 0xC8, 0x38,
-    0x6F, 0xC1, 0x7E, 0x79, 0x5E, 0xB6, 0x1E, 0xA8, 0xFD, 0xDC, 0x14, 0xC1, 0xF9, 0xF2, 0x2F, 0x32,
-    0xCA, 0xF4, 0x15, 0xA4, 0x5C, 0x38, 0xD8, 0xB8, 0xAE, 0xE0, 0x71, 0x02, 0x78, 0x1A, 0x64, 0x02,
-    0x71, 0x0B, 0x72, 0x0D, 0xE4, 0x35, 0xB1, 0x39, 0xD0, 0x54, 0x4F, 0xEB, 0x35, 0xD8, 0xD3, 0x13,
-    0x92, 0x87, 0x76, 0xF5, 0x04, 0xBB, 0xAE, 0x83, 0xBE, 0x8E, 0xB2, 0x5D, 0xF2, 0x5B, 0xA2, 0x56,
-    0x80, 0x5C, 0xF0, 0x3E, 0xB4, 0x04, 0xB6, 0xAD, 0x2D, 0xA0, 0x36, 0xC9, 0x10, 0xF5, 0xEF, 0xAF,
-    0xC0, 0x96, 0xAF, 0xD5, 0xA2, 0xCC, 0xC1, 0x97, 0xDD, 0xC8, 0x91, 0x1D, 0x93, 0x24, 0xE9, 0xF1,
-    0xBA, 0xB3, 0x99, 0x19, 0x26, 0x77, 0x7A, 0xF7, 0x90, 0x28, 0x8A, 0x01, 0x85, 0xC5, 0xB6, 0x35,
-    0x44, 0x72, 0x05, 0x0B, 0xBB, 0x47, 0x9E, 0x11, 0x35, 0xDB, 0x8A, 0xF4, 0x8E, 0xEB, 0xA3, 0x14,
-    0xE0, 0xC7, 0x2E, 0x2B, 0xF1, 0x29, 0x1D, 0x77, 0x34, 0xF3, 0xC4, 0x3C, 0xB6, 0x54, 0x81, 0x0F,
-    0xD3, 0x1A, 0xF1, 0x93, 0x2D, 0x19, 0xD2, 0x82, 0xBF, 0x41, 0x72, 0x73, 0x25, 0xCE, 0xFE, 0x10,
-    0x9F, 0xE3, 0x20, 0xC7, 0x64, 0xD6, 0x8F, 0x31, 0x1D, 0x20, 0x80, 0xA3, 0xE9, 0x85, 0x0D, 0xF8,
-    0x03, 0x2A, 0x6B, 0xD4, 0x51, 0x1D, 0x2D, 0x10, 0xAB, 0x69, 0x43, 0xB8, 0xF7, 0x76, 0x45, 0x99,
-    0xDE, 0x2B, 0x05, 0xDD, 0xBC, 0x25, 0x96, 0x0A, 0x72, 0x36, 0xA8, 0xD3, 0x2D, 0x36, 0xAA, 0xF7,
-    0x61, 0x23, 0xB3, 0xC4, 0x46, 0x53, 0x48, 0xB8, 0x84, 0x52, 0x2B, 0x22, 0x71, 0x99, 0xC5, 0x3C,
-    0xA4, 0x2D, 0x7F, 0x9C, 0x5E, 0x32, 0xDD, 0xCF, 0x5F, 0xD3, 0x8D, 0x0F, 0xDE, 0x47, 0xC8, 0x00,
-    0x0E, 0xEE, 0x8B, 0x2B, 0xB6, 0xD1, 0x43, 0x33, 0x71, 0xDF, 0x09, 0x46, 0xBA, 0xFA, 0x55, 0xFA,
-    0x53, 0xDE, 0x31, 0x46, 0x52, 0xDB, 0xAD, 0x84, 0x9C, 0x90, 0x9D, 0x87, 0x5F, 0x08, 0x6E, 0x7A,
-    0xA5, 0x3C, 0xA8, 0x1B, 0x3C, 0x1B, 0xAA, 0xD5, 0xD5, 0x28, 0xE9, 0xE3, 0x42, 0xB7, 0x1B, 0x32,
-    0x4F, 0xD9, 0x6F, 0xC9, 0x0E, 0x78, 0xFF, 0xCB, 0xAD, 0x86, 0xC8, 0x9F, 0xD3, 0x3C, 0xA3, 0x98,
-    0x46, 0x48, 0xCA, 0xD4, 0x9F, 0xC9, 0x56, 0x8C, 0x5A, 0xEB, 0x18, 0x56, 0x2F, 0xB1, 0xBA, 0x81,
-    0x01, 0xAB, 0x0A, 0xEB, 0xFB, 0x05, 0x84, 0x4A, 0x08, 0x9C, 0x5E, 0x06, 0x5C, 0x12, 0xB9, 0xEF,
-    0x40, 0xD0, 0x6C, 0xF8, 0xDF, 0x6B, 0x82, 0x9F, 0xB4, 0xC1, 0xF7, 0x9B, 0xD9, 0xCB, 0xD5, 0xCF,
-    0x7E, 0x43, 0x8D, 0x5B, 0x05, 0xEA, 0xC6, 0xE2, 0xAF, 0xBF, 0x9A, 0xC1, 0x0B, 0xC9, 0xFE, 0x58,
-    0x6F, 0x69, 0xB6, 0x6B, 0xB9, 0xCC, 0x8A, 0x22, 0x67, 0x22, 0x7E, 0x54, 0xB4, 0xAA, 0x81, 0xEB,
-    0xDB, 0x0C, 0xFF, 0xC0, 0x66, 0xF8, 0x03, 0x8D, 0x44, 0x76, 0x39, 0x62, 0x8B, 0x9E, 0x5A, 0xDD,
-    0x9E, 0xBF, 0x57, 0xD9, 0xF8, 0xA4, 0xAB, 0xC6, 0xB8, 0x98, 0x69, 0x0B, 0x4D, 0xD8, 0x6A, 0x35,
-    0x5F, 0x8B, 0xA7, 0xD3, 0x1A, 0x3F, 0x5C, 0xD7, 0x00, 0xE2, 0x96, 0xFA, 0x89, 0xAF, 0x7B, 0xFD,
-    0x1E, 0xF2, 0xCA, 0x3D, 0x44, 0x33, 0x1C, 0x91, 0xE7, 0xA2, 0xAF, 0xB0, 0x54, 0xCC, 0xA3, 0x23,
-    0x6B, 0xCB, 0xE2, 0xE2, 0x14, 0x2A, 0xA3, 0x8B, 0xCD, 0x26, 0x7F, 0x7B, 0x1A, 0x30, 0xDD, 0x9B,
-    0x8B, 0x8D, 0xE4, 0x2D, 0x5E, 0xAC, 0x10, 0x9D, 0xCB, 0x7B, 0x56, 0xEC, 0x38, 0x34, 0x90, 0x38,
-    0xD4, 0x96, 0xBC, 0x4D, 0x98, 0xCF, 0x09, 0xC6, 0x8A, 0xB1, 0x6C, 0x00, 0x69, 0x5B, 0x4F, 0xB7,
-    0x18, 0xFD, 0xBA, 0xD0, 0x5D, 0xA0, 0x37, 0x95, 0x95, 0x35, 0x77, 0x9E, 0x5F, 0x3C, 0xDF, 0x29,
-    0xB2, 0x48, 0xF5, 0x24, 0x82, 0x90, 0xFB, 0x29, 0xA3, 0x2D, 0x10, 0x0B, 0x53, 0xF2, 0x76, 0x31,
-    0xE5, 0x16, 0x59, 0xE3, 0x37, 0x5B, 0xDC, 0x30, 0xB4, 0x8A, 0xF1, 0xB9, 0x9F, 0xC3, 0x4E, 0x7F,
-    0xC7, 0x56, 0xD0, 0xD7, 0x46, 0x87, 0x6C, 0x35, 0x64, 0xA1, 0x12, 0x2B, 0x5E, 0x59, 0x49, 0x06,
-    0x7E, 0xFF, 0x0C, 0x77, 0x88, 0x71, 0x0D, 0xAF, 0x29, 0xCC, 0x65, 0xC0, 0x91, 0xBB, 0xE8, 0x31,
-    0xF3, 0xF3, 0xF3, 0x4C, 0x8C, 0x29, 0xDF, 0xBF, 0x02, 0xA6, 0xBD, 0x2E, 0x02, 0x04, 0x81, 0x8F,
-    0x1C, 0x5B, 0xE2, 0xC4, 0xED, 0xC9, 0x30, 0x1E, 0x11, 0xD3, 0xE5, 0x7D, 0xA2, 0xC6, 0xE3, 0xA0,
-    0xC6, 0xA7, 0x8E, 0x30, 0x19, 0xD4, 0x1A, 0x1C, 0x9A, 0x13, 0x55, 0x0C, 0x11, 0xCC, 0xB3, 0x38,
-    0x3C, 0x35, 0x21, 0x88, 0xCF, 0xBC, 0x88, 0x98, 0x40, 0xB5, 0x12, 0xB6, 0x7A, 0x9D, 0x18, 0x3C,
-    0x2D, 0xAC, 0xDF, 0xBB, 0x34, 0x0C, 0x61, 0x53, 0xD5, 0xEB, 0x99, 0x63, 0x1C, 0xCF, 0xB4, 0x18,
-    0xE7, 0x98, 0x3A, 0x2D, 0xC8, 0xF3, 0xF6, 0xBC, 0x8E, 0xF3, 0x8C, 0xB9, 0x8E, 0xC2, 0x34, 0x0D,
-    0x82, 0xFC, 0x51, 0x12, 0x37, 0x2E, 0xFD, 0x6A, 0xFF, 0xAA, 0xF1, 0x58, 0x50, 0xF4, 0xE3, 0x26,
-    0x00, 0xA2, 0xFC, 0xFC, 0xD7, 0x49, 0xD6, 0xE8, 0x0B, 0xCF, 0xB6, 0xEB, 0x4C, 0x3F, 0x73, 0x5A,
-    0x3A, 0xB3, 0x77, 0x9C, 0x8E, 0xF5, 0x4F, 0x73, 0x87, 0xAE, 0x8B, 0xB0, 0x76, 0x6C, 0xD2, 0x97,
-    0x8A, 0x99, 0x50, 0xC3, 0xDE, 0x83, 0x3A, 0x50, 0x85, 0x28, 0x0A, 0x0B, 0xFB, 0xD8, 0xAF, 0x1D,
-    0x92, 0xB5, 0x36, 0x62, 0x3D, 0xE0, 0x2F, 0x32, 0x39, 0x7C, 0xBC, 0x45, 0x8E, 0x56, 0x03, 0x38,
-    0x8E, 0x82, 0x88, 0x1D, 0x6C, 0x14, 0xB8, 0x25, 0x2F, 0xC9, 0xC9, 0x59, 0xC8, 0xCA, 0x0B, 0x06,
-    0x58, 0xC8, 0xB2, 0x9B, 0x9D, 0x60, 0x1B, 0x43, 0xDC, 0x39, 0x7D, 0x1E, 0x23, 0xBC, 0x75, 0xF1,
-    0x3C, 0xF8, 0x79, 0xBB, 0x8A, 0x6F, 0xD2, 0xEE, 0xE2, 0x32, 0xA6, 0x6A, 0x7A, 0x9D, 0x53, 0xB2,
-    0x32, 0xB6, 0x63, 0x9E, 0x61, 0xB8, 0xC5, 0xE9, 0x96, 0xC5, 0x92, 0x1A, 0xA7, 0x62, 0x5E, 0x71,
-    0xF8, 0x6A, 0x77, 0x2D, 0x33, 0x67, 0xC4, 0xE8, 0xCC, 0xCC, 0x59, 0x51, 0x5B, 0xC9, 0x98, 0x57,
-    0x51, 0xD9, 0xF4, 0xDE, 0x49, 0xF6, 0xB2, 0xAB, 0x11, 0x72, 0xCD, 0xA6, 0xD6, 0xB8, 0x59, 0x6E,
-    0x6C, 0xF0, 0x30, 0x65, 0xA0, 0x22, 0x27, 0xC4, 0xEC, 0x20, 0xFF, 0x64, 0xE8, 0x61, 0x6D, 0x4E,
-    0x74, 0xAF, 0xC2, 0xB8, 0x65, 0x1C, 0x6F, 0xEA, 0x44, 0x30, 0xEA, 0x84, 0x81, 0xA4, 0x64, 0xFA,
-    0x1F, 0x1D, 0x31, 0xD4, 0x8B, 0x0C, 0xB9, 0xB7, 0x43, 0xC4, 0x21, 0xD6, 0x6D, 0xBC, 0xFD, 0x24,
-    0x47, 0x04, 0xC4, 0x23, 0x8B, 0xDF, 0x3D, 0x6F, 0xD9, 0x2F, 0xD7, 0x13, 0x24, 0xA5, 0x03, 0x79,
-    0x14, 0xE9, 0x29, 0x4E, 0xE8, 0x07, 0x8A, 0xD5, 0xCB, 0x8C, 0xA8, 0xE6, 0x1F, 0x5B, 0x49, 0x59,
-    0x4D, 0x83, 0x22, 0xCB, 0xE8, 0xCF, 0x31, 0xE8, 0x70, 0xD0, 0x29, 0x7E, 0x5D, 0x13, 0xF2, 0x64,
-    0xF0, 0x10, 0xA0, 0xAD, 0x8D, 0x84, 0xA8, 0x77, 0x22, 0x62, 0xCA, 0x95, 0x8C, 0xEF, 0x0C, 0x87,
-    0xA6, 0x39, 0x37, 0xDE, 0xDC, 0xB1, 0xD5, 0x4F, 0xB5, 0x35, 0x58, 0x44, 0x45, 0xA8, 0x67, 0xC2,
-    0x7F, 0xF3, 0x85, 0x7B, 0x48, 0xF5, 0xD5, 0xF4, 0x17, 0xB2, 0xFD, 0x9D, 0x17, 0x99, 0xFC, 0x2B,
-    0x77, 0x0B, 0x6A, 0x5B, 0x0E, 0x63, 0x33, 0xF6, 0xA3, 0xCC, 0x5E, 0x50, 0x9C, 0xA9, 0x9F, 0xDD,
-    0x5E, 0xA4, 0x36, 0xC9, 0x05, 0x4C, 0x3F, 0x87, 0xAD, 0xA4, 0xE9, 0xE1, 0x6E, 0xC1, 0x45, 0xED,
-    0x65, 0xF2, 0x8C, 0xFE, 0xA4, 0xC0, 0xDA, 0x4C, 0x1F, 0xEC, 0x07, 0x16, 0x7C, 0x72, 0x45, 0xD2,
-    0x99, 0xBC, 0x11, 0xAA, 0x1B, 0xFF, 0xEF, 0x7A, 0xD5, 0x4F, 0x69, 0x42, 0x1F, 0x14, 0xC4, 0x38,
-    0x53, 0x81, 0xBD, 0xDA, 0x46, 0xFA, 0x34, 0xD6, 0x57, 0x91, 0x05, 0xA8, 0x9F, 0x04, 0x06, 0xDC,
-    0xBD, 0xC6, 0x53, 0x61, 0x31, 0x9C, 0xFA, 0x9F, 0x32, 0x0B, 0xE6, 0x34, 0xBF, 0x36, 0x91, 0x2F,
-    0x3C, 0xC5, 0x9D, 0xE7, 0x40, 0x20, 0x33, 0x5A, 0x2A, 0x54, 0x4F, 0xBB, 0x15, 0x37, 0x8D, 0xC2,
-    0x5C, 0x5B, 0x20, 0xE6, 0xD9, 0x82, 0x31, 0x25, 0xE1, 0x29, 0x75, 0x8A, 0xAC, 0xAB, 0x87, 0x64,
-    0x4B, 0x53, 0x9B, 0xD4, 0xDF, 0xEE, 0x96, 0x5A, 0x79, 0x55, 0x30, 0xF0, 0x10, 0x5C, 0xA0, 0x7A,
-    0x0B, 0x35, 0x93, 0xF5, 0x5C, 0xBE, 0x89, 0x61, 0xDC, 0xD8, 0xE6, 0x68, 0xEA, 0x5B, 0x38, 0x79,
-    0x25, 0xC0, 0x9C, 0x99, 0x65, 0x2D, 0x33, 0xD7, 0x9C, 0x16, 0x93, 0x59, 0x73, 0x1B, 0x30, 0xF7,
-    0x3A, 0x5C, 0x2C, 0xC8, 0x75, 0xAE, 0x67, 0xD4, 0x37, 0xB5, 0x88, 0x84, 0x13, 0x8B, 0x59, 0xB5,
-    0x89, 0xB2, 0x52, 0xBF, 0xEA, 0xC7, 0x38, 0x28, 0xFD, 0xAF, 0x1E, 0x23, 0xB2, 0xD8, 0x4F, 0x27,
-    0x31, 0x84, 0xB3, 0x30, 0x2B, 0xAF, 0x8B, 0x64, 0x75, 0xCA, 0x90, 0xF6, 0x45, 0x61, 0xFC, 0xFC,
-    0x5A, 0x61, 0x4E, 0x45, 0xF2, 0xD8, 0xF5, 0x58, 0x44, 0xE3, 0x8D, 0x58, 0x74, 0x5E, 0x75, 0x5E,
-    0xD8, 0xA0, 0x78, 0xC9, 0x13, 0x08, 0xB8, 0x23, 0x36, 0x61, 0x29, 0xBA, 0x36, 0x2F, 0xC5, 0x0E,
-    0xD7, 0x3D, 0x19, 0x24, 0x76, 0x5B, 0x72, 0xB7, 0x76, 0x83, 0xDF, 0x04, 0xCF, 0xEC, 0x6D, 0x26,
-    0x8A, 0xFB, 0xB7, 0x85, 0x05, 0x48, 0x5F, 0xB4, 0x59, 0xB4, 0x01, 0xDD, 0xB8, 0xB2, 0x42, 0xA7,
-    0x7C, 0x8D, 0xFD, 0x9B, 0xF5, 0x99, 0x45, 0xBF, 0x37, 0xB0, 0x62, 0xC8, 0x20, 0x7C, 0xF3, 0x37,
-    0xC7, 0x2C, 0xF7, 0x39, 0x73, 0x08, 0x5F, 0xF8, 0xDB, 0x1F, 0x30, 0x8B, 0xCF, 0x04, 0xC1, 0x5F,
-    0x6A, 0x06, 0xE2, 0x5A, 0xF0, 0x75, 0x4D, 0x70, 0x59, 0xE7, 0x85, 0xD0, 0xF3, 0x46, 0x98, 0xB1,
-    0xB2, 0xCD, 0xA9, 0xA3, 0x64, 0xC1, 0xA4, 0x90, 0xC2, 0x7A, 0x55, 0xFD, 0x2C, 0xD6, 0x04, 0x80,
-    0x40, 0xFE, 0x35, 0x07, 0xBB, 0xC5, 0xC2, 0x30, 0xB9, 0xB0, 0xDB, 0x7F, 0xE8, 0x2F, 0xDF, 0x3A,
-    0xD6, 0x97, 0x79, 0xFF, 0xD3, 0x5E, 0x28, 0xDD, 0x57, 0x60, 0xAF, 0x6D, 0x6C, 0x6A, 0x8A, 0x01,
-    0x24, 0xC0, 0xBF, 0xC1, 0xE1, 0xCF, 0x36, 0x29, 0xF1, 0x8F, 0x87, 0x4C, 0xA5, 0x3B, 0x2D, 0x40,
-    0x40, 0x4E, 0x17, 0x85, 0x54, 0x42, 0x23, 0xF8, 0xA1, 0x7D, 0xAD, 0x1F, 0x10, 0xF6, 0x7A, 0xE3,
-    0x0D, 0xE0, 0xCD, 0x20, 0xF8, 0x02, 0x12, 0x18, 0x4E, 0x86, 0x9F, 0xA9, 0x85, 0xBD, 0xCE, 0x46,
-    0xF0, 0xF7, 0x65, 0xD7, 0x63, 0x68, 0xA1, 0x67, 0xAB, 0x18, 0xDB, 0xCF, 0x2B, 0xCE, 0x83, 0x7B,
-    0xC3, 0xEA, 0x25, 0xD1, 0xB3, 0xDB, 0x71, 0xBD, 0x13, 0xF6, 0x1A, 0x8F, 0x01, 0xF8, 0xB3, 0xF5,
-    0x8A, 0xF1, 0x97, 0x2F, 0x5C, 0xD0, 0xD9, 0x7A, 0x0A, 0x27, 0x7D, 0xCD, 0x38, 0x5E, 0xD3, 0x68,
-    0xF6, 0x4D, 0x32, 0xA0, 0xCB, 0xDD, 0xB5, 0xF0, 0x35, 0x49, 0x65, 0x6D, 0xDC, 0x25, 0xC6, 0xA2,
-    0x25, 0x93, 0xFF, 0xC9, 0x5F, 0xB3, 0x14, 0x95, 0xA0, 0xC3, 0x13, 0xC3, 0x60, 0x17, 0x66, 0x24,
-    0x03, 0x3A, 0x41, 0x19, 0xC1, 0x8A, 0x84, 0x43, 0x9A, 0xA1, 0xAD, 0x58, 0xAB, 0x37, 0x10, 0xFB,
-    0xB3, 0xE8, 0x4C, 0x56, 0x4C, 0xA8, 0x95, 0x6D, 0xD6, 0xB2, 0x35, 0xA3, 0xAA, 0xCF, 0x62, 0xD1,
-    0x84, 0x73, 0xEC, 0x09, 0xDA, 0xDD, 0x7A, 0x42, 0xEE, 0x07, 0x76, 0xDC, 0x4B, 0x48, 0xE6, 0xC5,
-    0x0A, 0x84, 0x5A, 0xB2, 0x73, 0x89, 0x7B, 0xE2, 0xDB, 0x9A, 0x1D, 0xF5, 0x53, 0xF5, 0xA2, 0x11,
-    0xDA, 0xCE, 0xEE, 0x2D, 0x90, 0x4D, 0x13, 0x08, 0xC9, 0xA9, 0xAB, 0x78, 0x4A, 0x9D, 0x06, 0x9C,
-    0xD1, 0x39, 0x73, 0xE1, 0x0B, 0xB7, 0x75, 0xE1, 0xA3, 0x98, 0xCD, 0xB9, 0x8B, 0xA3, 0x2A, 0xBC,
-    0xC7, 0x5C, 0xBF, 0x94, 0x59, 0x98, 0x9A, 0xB3, 0xAA, 0x95, 0x0B, 0xB7, 0x5D, 0xBD, 0x82, 0xB0,
-    0x5E, 0x5C, 0xB8, 0xF0, 0x42, 0x41, 0xF6, 0x5B, 0x10, 0x2F, 0x80, 0xFF, 0x52, 0x0C, 0x8B, 0x0C,
-    0x18, 0x53, 0xA5, 0x69, 0x32, 0xA8, 0x67, 0x59, 0x30, 0x28, 0x03, 0xAB, 0x29, 0x66, 0xF5, 0x39,
-    0x8B, 0xB4, 0xBC, 0x66, 0x6E, 0xF3, 0x58, 0x9F, 0x27, 0xF9, 0x94, 0x0D, 0xE9, 0x64, 0x13, 0x3E,
-    0x5C, 0xE4, 0x9B, 0x5A, 0xB7, 0x1B, 0x54, 0xBB, 0x10, 0x67, 0x08, 0x78, 0x17, 0xB7, 0xC0, 0xB7,
-    0xCC, 0x44, 0x69, 0x6D, 0x3E, 0x6C, 0x2E, 0xCA, 0x4E, 0xF3, 0xAD, 0x16, 0x4E, 0xA3, 0x29, 0x4A,
-    0x32, 0xA5, 0x46, 0x0B, 0x2D, 0xE1, 0x8A, 0xD1, 0xE0, 0x77, 0x20, 0xB3, 0xD3, 0x2C, 0xAF, 0xA8,
-    0xA0, 0xE0, 0x15, 0x8E, 0xCC, 0x93, 0xCD, 0x85, 0x41, 0x7A, 0xC1, 0x4F, 0xEF, 0xC9, 0x2C, 0x93,
-    0xCD, 0x22, 0x46, 0xA6, 0xBA, 0x58, 0x06, 0xCF, 0x70, 0xD6, 0x54, 0x4A, 0xCC, 0xEF, 0x93, 0x2F,
-    0x6E, 0x23, 0xBF, 0x59, 0xF8, 0x32, 0x02, 0x67, 0x00, 0x31, 0x64, 0x6B, 0x04, 0xE6, 0xB3, 0x72,
-    0x4E, 0xC8, 0xEA, 0xFD, 0xA4, 0xB4, 0xA2, 0x0F, 0xD5, 0x94, 0x77, 0x5F, 0xED, 0xFA, 0x1C, 0xF5,
-    0x8D, 0x41, 0x75, 0x8B, 0x26, 0x51, 0x54, 0x88, 0x41, 0x4E, 0x08, 0xDA, 0xCE, 0x10, 0x0F, 0xCE,
-    0x1D, 0x08, 0x96, 0xF8, 0xD9, 0xD6, 0x99, 0x03, 0x2A, 0x89, 0xC9, 0x4E, 0x5F, 0x5E, 0x58, 0x87,
-    0x0B, 0x07, 0x4C, 0x2A, 0xAB, 0x4F, 0x75, 0x71, 0x84, 0x98, 0x30, 0xE0, 0xF5, 0xEC, 0x35, 0x64,
-    0x75, 0xBB, 0xAF, 0x67, 0x63, 0x9E, 0xC3, 0x26, 0xA4, 0x99, 0xD7, 0x21, 0x17, 0x57, 0xCC, 0xDB,
-    0x7D, 0x95, 0x42, 0x21, 0xED, 0x40, 0x67, 0x48, 0xF8, 0xDC, 0x5D, 0x0A, 0x51, 0xA6, 0x3C, 0xC0,
-    0x77, 0xAA, 0x05, 0x11, 0xC6, 0x7D, 0x55, 0x05, 0xAE, 0xBA, 0x5F, 0x55, 0xCF, 0xE8, 0x67, 0x0E,
-    0x1E, 0xF5, 0xAF, 0x34, 0xBD, 0x89, 0x67, 0x3E, 0x0E, 0x45, 0xE8, 0xD2, 0x36, 0x0A, 0x6F, 0x4F,
-    0x3C, 0xB9, 0x09, 0x50, 0x7D, 0x9C, 0x21, 0xB9, 0x31, 0xBA, 0xCB, 0x48, 0x44, 0xBF, 0xB7, 0x99,
-    0x00, 0xEB, 0x8F, 0x70, 0xDA, 0x29, 0x01, 0xF5, 0xE7, 0x91, 0xDC, 0xF1, 0xDC, 0x4D, 0x2D, 0xEA,
-    0x50, 0xDB, 0x38, 0xBC, 0x43, 0x90, 0x20, 0xD3, 0x78, 0x09, 0x33, 0x3A, 0x3D, 0xAD, 0x39, 0x96,
-    0xAF, 0x3D, 0xDF, 0x5A, 0x0F, 0xE9, 0xB1, 0x57, 0xEB, 0x71, 0x4E, 0xBB, 0x07, 0xCB, 0x9A, 0x11,
-    0x04, 0x3B, 0x9A, 0x57, 0xA2, 0xAB, 0x51, 0xF5, 0x71, 0x7B, 0xF8, 0xFB, 0x36, 0x14, 0x4B, 0x8A,
-    0xCC, 0xED, 0x18, 0x39, 0xA7, 0x7E, 0xB7, 0x61, 0x95, 0x5F, 0x5E, 0x07, 0x7D, 0x19, 0xB7, 0x79,
-    0xED, 0xCB, 0xE6, 0x6B, 0x02, 0x30, 0x49, 0x2A, 0x1A, 0x8A, 0x2A, 0x2F, 0x40, 0x4A, 0x02, 0x30,
-    0x04, 0xE2, 0xEE, 0x46, 0x7D, 0xEC, 0xE4, 0x24, 0xFA, 0xA3, 0xF8, 0xA1, 0x38, 0xE3, 0x87, 0x10,
-    0x95, 0x66, 0x70, 0x3A, 0x84, 0xA2, 0x8E, 0xB3, 0x90, 0xC1, 0xA8, 0x02, 0xCE, 0x75, 0x21, 0x5E,
-    0xFC, 0x69, 0x5B, 0x29, 0x8B, 0x91, 0x7F, 0xBC, 0xFF, 0xD3, 0xE5, 0xD2, 0xD8, 0x80, 0xF9, 0xD0,
-    0x9D, 0xC2, 0x9E, 0x2C, 0x42, 0x78, 0xB1, 0x67, 0x9A, 0xF3, 0x98, 0x2D, 0x75, 0x64, 0xE2, 0xF6,
-    0x5C, 0x9F, 0x1C, 0x09, 0x8B, 0xAD, 0xFB, 0xE3, 0x86, 0x2A, 0x43, 0xDA, 0xD9, 0x62, 0x6A, 0xE5,
-    0x62, 0x08, 0xF4, 0x89, 0xB0, 0x7E, 0x95, 0x0A, 0xA0, 0xF4, 0xCA, 0x20, 0x9B, 0x55, 0x5E, 0xE1,
-    0x17, 0x7E, 0x35, 0x2B, 0x66, 0x32, 0x74, 0xBF, 0xF0, 0x44, 0x39, 0x07, 0x19, 0x8F, 0xC9, 0x4C,
-    0x30, 0x42, 0x98, 0xF8, 0x82, 0x60, 0x22, 0xE1, 0x3E, 0x88, 0xAB, 0x93, 0x72, 0x3C, 0x8F, 0xFC,
-    0x5B, 0x39, 0xDE, 0x90, 0x09, 0xBD, 0x84, 0xD2, 0xEA, 0x7A, 0x27, 0xCA, 0x34, 0x82, 0x07, 0x41,
-    0x55, 0x8E, 0x59, 0xB7, 0xEE, 0xA4, 0x86, 0x69, 0xA5, 0x92, 0xA9, 0xDA, 0x5F, 0x51, 0x66, 0x7F,
-    0x4E, 0x70, 0x66, 0xBD, 0xA0, 0x76, 0x64, 0x53, 0xA5, 0x99, 0xAD, 0x11, 0xA6, 0x1B, 0x0E, 0x84,
-    0x11, 0xDD, 0x08, 0x7F, 0xE7, 0x9C, 0x7E, 0x91, 0x26, 0xA0, 0xF0, 0x08, 0xBE, 0xFB, 0x9C, 0x1C,
-    0xA3, 0x37, 0xC4, 0x0A, 0x6A, 0xE2, 0xBD, 0xFC, 0xDE, 0xE6, 0x3C, 0x2E, 0x66, 0xA2, 0xC6, 0x84,
-    0x03, 0x9F, 0xFE, 0x0D, 0x5B, 0x22, 0xA2, 0xD9, 0xE6, 0xF4, 0xCE, 0x10, 0x08, 0x20, 0x79, 0xD5,
-    0x68, 0xFA, 0x91, 0x4B, 0x4B, 0x01, 0x59, 0x38, 0x2C, 0xC4, 0x73, 0xFA, 0xFF, 0xD4, 0x11, 0xDC,
-    0xDD, 0x5E, 0x05, 0x7C, 0x33, 0xD6, 0x1C, 0xBC, 0xDE, 0x6A, 0xB8, 0x90, 0xC6, 0x8D, 0x6F, 0xC3,
-    0x85, 0x31, 0x8D, 0xC9, 0x2C, 0xFE, 0xB3, 0x04, 0xFB, 0xF5, 0x5E, 0x9E, 0xA5, 0xCF, 0x8A, 0x79,
-    0x9F, 0x9B, 0x23, 0xA9, 0xD6, 0xE5, 0x11, 0xDB, 0x52, 0xBE, 0x6B, 0x18, 0x0A, 0xA8, 0x27, 0x78,
-    0x33, 0x9F, 0x86, 0x18, 0x91, 0x67, 0x2A, 0x1B, 0x37, 0xEA, 0xAF, 0x08, 0x19, 0x09, 0x6E, 0xA2,
-    0x3F, 0xA3, 0xE4, 0x3C, 0xA7, 0xA4, 0x6C, 0xC8, 0x02, 0x8E, 0x96, 0xC9, 0x78, 0x9A, 0x31, 0x36,
-    0x53, 0xCD, 0x0F, 0x79, 0x4A, 0x7F, 0x03, 0x4F, 0xE7, 0x94, 0x91, 0x2E, 0xE9, 0x49, 0x37, 0xB8,
-    0x56, 0x6A, 0xA6, 0x9A, 0x48, 0x1C, 0x6B, 0x06, 0x5D, 0x1C, 0x68, 0x2A, 0xF8, 0x67, 0x75, 0xC7,
-    0xFF, 0x4B, 0x85, 0x92, 0x97, 0x34, 0x03, 0x6F, 0x6E, 0x96, 0x19, 0xC6, 0xC3, 0xFA, 0x04, 0xC5,
-    0x04, 0x12, 0x22, 0x91, 0x33, 0x89, 0x90, 0x04, 0x83, 0x8D, 0x30, 0xFB, 0x6B, 0xD8, 0x48, 0x01,
-    0x47, 0xBA, 0x46, 0xBB, 0x79, 0x9D, 0x03, 0xBC, 0xC1, 0xF1, 0x31, 0xCF, 0x8D, 0x3E, 0xF7, 0x05,
-    0x95, 0xD5, 0x2D, 0xFA, 0x7A, 0x76, 0x59, 0x4F, 0xBA, 0x4D, 0xC3, 0x3A, 0x26, 0xD3, 0xC6, 0x37,
-    0x86, 0x5B, 0x0F, 0xF9, 0xCB, 0xD1, 0xE4, 0x91, 0xC7, 0x2E, 0x7F, 0x4E, 0x99, 0x28, 0xD6, 0x08,
-    0x14, 0x63, 0x4D, 0xE6, 0x25, 0xDB, 0xB2, 0x43, 0x33, 0xA5, 0x67, 0xC9, 0x8D, 0xFD, 0x45, 0x47,
-    0x1F, 0x1A, 0xBA, 0x7E, 0x8E, 0x7E, 0x87, 0x58, 0x6B, 0x0F, 0x5F, 0xA6, 0xFF, 0xA3, 0xDC, 0xA1,
-    0xD9, 0xCD, 0x12, 0xBA, 0x8B, 0xFB, 0x1C, 0x64, 0x1F, 0xC0, 0x0A, 0xAC, 0x58, 0x3E, 0xD9, 0xE0,
-    0x52, 0xBF, 0x66, 0x85, 0xA6, 0xEA, 0x1D, 0x2B, 0xF8, 0x6D, 0x8D, 0x7E, 0x3E, 0x68, 0x81, 0x21,
-    0x41, 0xDA, 0x82, 0x81, 0x6F, 0x42, 0x80, 0x42, 0x95, 0x87, 0x7F, 0x85, 0x74, 0xC9, 0x80, 0xB2,
-    0x09, 0xB6, 0x8A, 0x7A, 0x03, 0x65, 0x93, 0xB0, 0x5E, 0x04, 0xFB, 0xD5, 0xAB, 0x34, 0xC7, 0x2D,
-    0xCA, 0xB4, 0x2C, 0x27, 0x2E, 0xC2, 0x6C, 0x56, 0xE8, 0x95, 0xDC, 0x23, 0x4B, 0xB9, 0x97, 0x45,
-    0x52, 0x31, 0x59, 0x58, 0x70, 0x67, 0x79, 0x8A, 0x76, 0x60, 0x27, 0xBA, 0x18, 0x32, 0x0A, 0x8B,
-    0xEF, 0xD5, 0x5B, 0x18, 0x07, 0xFC, 0x94, 0xF5, 0x50, 0x29, 0xE1, 0xFD, 0x58, 0xF3, 0x5E, 0x4B,
-    0xE3, 0x0A, 0x4C, 0x42, 0xCA, 0x9E, 0x7C, 0xB4, 0xC7, 0xEF, 0x2B, 0x36, 0x63, 0x55, 0x26, 0x59,
-    0x0E, 0xE2, 0x77, 0x43, 0xCB, 0x9C, 0x06, 0x9F, 0xCB, 0xE8, 0x01, 0x5D, 0xEE, 0x89, 0x68, 0xA4,
-    0xCD, 0x62, 0xE2, 0x89, 0x30, 0xB6, 0x15, 0xC6, 0xF0, 0xB1, 0xE8, 0xDE, 0x3E, 0x4F, 0x7D, 0x96,
-    0x22, 0x34, 0x98, 0xBE, 0x3E, 0xDF, 0xAC, 0xDC, 0x85, 0xB3, 0x80, 0xB1, 0xE1, 0x20, 0x27, 0xB3,
-    0x83, 0xC7, 0x0F, 0x55, 0x2E, 0x72, 0x3E, 0x87, 0xE4, 0x0A, 0xF9, 0xB7, 0x4B, 0xE8, 0xE9, 0x20,
-    0xEB, 0xBB, 0x03, 0x02, 0x0B, 0x45, 0xE7, 0x29, 0x41, 0x8F, 0x41, 0x6B, 0x92, 0x4E, 0xD6, 0xB7,
-    0x22, 0xDE, 0xBE, 0xE5, 0xC1, 0xC7, 0x25, 0x46, 0xAB, 0x9F, 0x31, 0x83, 0x32, 0x0E, 0x34, 0x63,
-    0x3B, 0x3E, 0xA3, 0x49, 0x70, 0xC2, 0x8A, 0x4C, 0x8B, 0x08, 0x6B, 0x0D, 0x94, 0x04, 0x95, 0x46,
-    0x4A, 0x30, 0x95, 0xA3, 0x63, 0xF7, 0x9B, 0x65, 0x5E, 0xB8, 0x0D, 0x95, 0x7B, 0xF5, 0xEA, 0x8C,
-    0x73, 0x3B, 0x81, 0x66, 0x98, 0x88, 0x15, 0xDF, 0xC9, 0x04, 0x40, 0xD8, 0xBF, 0xE6, 0xB4, 0xB5,
-    0x66, 0x8B, 0x14, 0x19, 0x8D, 0x51, 0xF9, 0x04, 0x93, 0xC8, 0x13, 0x16, 0xBC, 0xAA, 0x67, 0x9C,
-    0xA6, 0x5C, 0xAF, 0xB8, 0x22, 0x57, 0x60, 0x91, 0x6B, 0x7E, 0x7D, 0xAE, 0x5C, 0xD3, 0xEB, 0x0D,
-    0xFB, 0xC1, 0xE8, 0xC1, 0xC9, 0x61, 0x21, 0x8A, 0xA1, 0x6E, 0x56, 0x7B, 0x3F, 0xD1, 0xC2, 0x50,
-    0x8A, 0x7B, 0x7E, 0x24, 0xD2, 0x6C, 0xE6, 0x94, 0x1D, 0x80, 0xC0, 0x9D, 0x5E, 0x93, 0x72, 0x51,
-    0xB4, 0x48, 0x5C, 0xC0, 0xFA, 0xBD, 0x49, 0xC1, 0x80, 0x59, 0xED, 0x37, 0x70, 0x2C, 0xB1, 0xA9,
-    0xC8, 0x94, 0xD1, 0x11, 0xE6, 0xD0, 0x87, 0x5F, 0x2C, 0x3D, 0x38, 0x72, 0xA9, 0x2B, 0x98, 0x4E,
-    0x09, 0x3B, 0xA1, 0x21, 0x6F, 0x21, 0x47, 0xBF, 0x61, 0x29, 0x15, 0xEB, 0xA8, 0x72, 0xDB, 0x33,
-    0x26, 0x28, 0x53, 0x82, 0x7D, 0x20, 0x8D, 0xF0, 0x9B, 0xDF, 0x46, 0x30, 0x0C, 0x12, 0x89, 0x55,
-    0x04, 0xA1, 0x2D, 0xAB, 0x9D, 0xFE, 0x38, 0xD6, 0x25, 0x3B, 0xB3, 0xD5, 0x13, 0xC7, 0x45, 0x5F,
-    0xE3, 0xFC, 0x11, 0xFF, 0x59, 0x75, 0x80, 0x86, 0x76, 0x01, 0xFC, 0x62, 0x35, 0xF7, 0xF9, 0x94,
-    0xBD, 0xC1, 0x8A, 0x9B, 0xD4, 0xA4, 0x0D, 0x83, 0x06, 0x5E, 0xD7, 0x3B, 0xC0, 0xA1, 0x61, 0x21,
-    0xF6, 0x90, 0xE0, 0x4F, 0xC1, 0x54, 0x5E, 0x45, 0x04, 0x73, 0xD2, 0x2D, 0xBC, 0xB9, 0xCD, 0x86,
-    0x9E, 0xDB, 0x4C, 0xE8, 0x46, 0x75, 0xB4, 0xAA, 0x57, 0x9E, 0x4B, 0x3D, 0xEB, 0xB3, 0xC5, 0x28,
-    0xD5, 0xE5, 0x9D, 0xDB, 0x65, 0xAE, 0x75, 0x93, 0xFB, 0xF6, 0xAC, 0x6D, 0xA9, 0x06, 0x75, 0x6B,
-    0x34, 0xDF, 0x91, 0x72, 0x41, 0xCF, 0x39, 0x56, 0xF3, 0x93, 0x58, 0xFC, 0x10, 0x8D, 0x60, 0x90,
-    0xD0, 0x39, 0x17, 0x06, 0x0A, 0x99, 0xA9, 0xF2, 0x2D, 0x2E, 0x4D, 0xBE, 0x70, 0x86, 0x6C, 0x5B,
-    0x1B, 0x99, 0x7C, 0x5C, 0x9D, 0x9D, 0x97, 0x69, 0x1D, 0xA0, 0xB2, 0xFE, 0x8C, 0x23, 0x88, 0xCE,
-    0x7C, 0xE2, 0xD4, 0xB1, 0xB1, 0xA1, 0x8D, 0x3A, 0x2D, 0x6D, 0x9F, 0x82, 0x7F, 0xC1, 0xE3, 0xE5,
-    0x7D, 0x72, 0x2B, 0xEC, 0xD0, 0x73, 0xA8, 0xDB, 0xFC, 0xF5, 0xBF, 0x6F, 0x64, 0x56, 0x5F, 0x2C,
-    0x76, 0x66, 0x55, 0xF0, 0xD9, 0x44, 0xAC, 0xFF, 0x23, 0x8E, 0xD9, 0xE6, 0xEC, 0x52, 0xED, 0x8D,
-    0x43, 0x25, 0x93, 0x2A, 0x8C, 0xD4, 0xA3, 0xA2, 0x49, 0x1E, 0xDB, 0x5D, 0x8A, 0x34, 0x7A, 0xE4,
-    0xE7, 0xA8, 0x81, 0x15, 0x0A, 0x24, 0x08, 0xA9, 0x87, 0x77, 0xDF, 0xDA, 0xCB, 0x93, 0x99, 0x18,
-    0xB7, 0x0D, 0x00, 0x2E, 0x87, 0x7E, 0xF4, 0x82, 0x56, 0xE6, 0x84, 0xB6, 0xEE, 0x39, 0xF0, 0x0A,
-    0xD6, 0x84, 0x7F, 0xC4, 0x4D, 0x36, 0x0E, 0x0A, 0xD6, 0x0F, 0xBF, 0xF7, 0xF2, 0xEA, 0xD5, 0xAB,
-    0x19, 0x41, 0x20, 0x3F, 0x56, 0x9D, 0xE5, 0x72, 0x64, 0x4F, 0x1D, 0x39, 0xA0, 0x42, 0x3E, 0x58,
-    0x07, 0xE7, 0x40, 0x6F, 0x3A, 0xBC, 0xF2, 0xD7, 0x3B, 0xC2, 0x4D, 0xD1, 0x01, 0x9A, 0xB3, 0xCD,
-    0x0C, 0x6A, 0x28, 0x01, 0x5B, 0x1C, 0xB4, 0x62, 0xF3, 0x28, 0x6A, 0xB5, 0xF5, 0x61, 0xD3, 0xA4,
-    0x95, 0x49, 0x85, 0x5D, 0x9A, 0xEC, 0xAF, 0xB6, 0xD3, 0xBF, 0x46, 0x53, 0xCB, 0x4A, 0x13, 0x65,
-    0x94, 0x50, 0x51, 0x3F, 0xA9, 0xC9, 0x3B, 0x58, 0x99, 0xA7, 0x1F, 0x5D, 0x98, 0xA1, 0x09, 0xD4,
-    0xD0, 0x05, 0x8A, 0xF5, 0x31, 0x22, 0xD4, 0x5F, 0x69, 0xC4, 0xEA, 0x85, 0xFD, 0xDB, 0x0A, 0x9B,
-    0x70, 0xBF, 0x46, 0x85, 0x2D, 0xAF, 0x5D, 0x09, 0x66, 0x0E, 0x41, 0x48, 0xFD, 0x5B, 0x54, 0x2A,
-    0x05, 0x9C, 0xBE, 0x1E, 0x4C, 0x72, 0x1B, 0x4A, 0xB3, 0x61, 0xB4, 0x60, 0xD2, 0x2C, 0x8B, 0x29,
-    0x2E, 0xF4, 0xBA, 0x1F, 0x41, 0x4C, 0x24, 0x4C, 0x20, 0x16, 0xBF, 0x5F, 0xDB, 0xDC, 0x3B, 0x5A,
-    0x91, 0xA8, 0xB8, 0x97, 0x3B, 0x8B, 0xA0, 0x31, 0x3B, 0x61, 0xF9, 0x8B, 0xA6, 0x71, 0xB2, 0xF8,
-    0x33, 0x60, 0xB6, 0xB7, 0x4A, 0x9B, 0x9E, 0xA8, 0x1F, 0x63, 0x01, 0xDB, 0x8E, 0x7C, 0x0C, 0xA9,
-    0xB2, 0x88, 0x4C, 0x00, 0xEC, 0x30, 0x1F, 0x74, 0xB2, 0x32, 0xB2, 0x73, 0x36, 0x91, 0xF1, 0x9F,
-    0x74, 0xB2, 0x81, 0xD4, 0xF5, 0xB7, 0x81, 0x6D, 0x84, 0xEA, 0xC8, 0x2C, 0xBD, 0xED, 0x17, 0xBF,
-    0x63, 0xDC, 0xE4, 0x8C, 0x08, 0x90, 0x46, 0xEC, 0x9C, 0x35, 0x73, 0x4C, 0x24, 0xA0, 0xF0, 0x51,
-    0x36, 0x4B, 0xD6, 0x10, 0x0F, 0xD8, 0xC0, 0xCC, 0x12, 0x84, 0x6D, 0x93, 0xB3, 0xF2, 0xE4, 0xDF,
-    0x36, 0x8F, 0x91, 0xBE, 0x93, 0xC6, 0x65, 0x61, 0x37, 0x01, 0x89, 0xA3, 0x10, 0xBE, 0xE8, 0x8D,
-    0x63, 0xF8, 0x6D, 0xE7, 0x40, 0x15, 0xBB, 0x7E, 0x9D, 0x47, 0xFD, 0x7A, 0xA0, 0x1E, 0x24, 0xE6,
-    0xF9, 0x62, 0x7E, 0x37, 0xF8, 0xF5, 0xB3, 0xC0, 0x5A, 0x57, 0xF8, 0xF5, 0xA7, 0x0E, 0xC8, 0xA0,
-    0xF7, 0xF2, 0x63, 0xBD, 0x9C, 0x86, 0xED, 0xEB, 0x92, 0x01, 0x82, 0xFD, 0x9B, 0xD9, 0xD0, 0x66,
-    0xA1, 0xB8, 0xEE, 0xA8, 0xDA, 0xB8, 0xE8, 0x94, 0x0F, 0xE1, 0x71, 0xCE, 0x97, 0x78, 0xFC, 0xAA,
-    0x26, 0x84, 0x0C, 0xD3, 0x4C, 0x73, 0x8A, 0xDA, 0x6B, 0x05, 0x82, 0xA0, 0xE3, 0x34, 0x37, 0xEE,
-    0x37, 0x4D, 0xF7, 0xAB, 0x93, 0xFA, 0xD1, 0xF1, 0xF2, 0xFC, 0xB5, 0x91, 0xA8, 0xD7, 0x97, 0xA4,
-    0xDE, 0x30, 0x4B, 0x74, 0x7B, 0x7D, 0xB5, 0xBF, 0xCC, 0x4A, 0x27, 0xA4, 0x09, 0xF4, 0x9A, 0xE9,
-    0x44, 0xBD, 0x11, 0x92, 0xF8, 0xD9, 0x70, 0x25, 0x7F, 0x7A, 0x4C, 0x78, 0x6B, 0x67, 0x40, 0x2D,
-    0x61, 0x3B, 0xC4, 0xF2, 0xFA, 0x72, 0x68, 0xD1, 0xD6, 0x8F, 0x01, 0xCD, 0x8B, 0x87, 0x75, 0xFB,
-    0x7B, 0xE7, 0x3F, 0x9D, 0x1D, 0xF9, 0x2D, 0x51, 0x5A, 0x16, 0x1A, 0xDD, 0x3E, 0xD1, 0x8D, 0xBD,
-    0xF1, 0xB6, 0xED, 0x5C, 0xF2, 0x87, 0xB0, 0x2C, 0xBF, 0x34, 0x46, 0x22, 0x79, 0xD7, 0x7E, 0xE8,
-    0xE2, 0xE6, 0xF3, 0x71, 0x0C, 0x75, 0x0B, 0xCE, 0xB9, 0x42, 0x32, 0x9C, 0xB7, 0x4E, 0xA9, 0x01,
-    0xBC, 0xB9, 0xD5, 0x48, 0xB5, 0x62, 0x05, 0x3F, 0x2C, 0x1B, 0xFD, 0xA8, 0x73, 0x79, 0xB5, 0xD9,
-    0x8F, 0xA6, 0xF0, 0x42, 0xCA, 0x18, 0xE5, 0xAC, 0xD8, 0x96, 0x5D, 0xC5, 0xDA, 0x00, 0xC4, 0x44,
-    0x77, 0x9B, 0xD5, 0x96, 0x0F, 0x1B, 0x87, 0xB7, 0x7C, 0xB8, 0xAD, 0x25, 0xBD, 0x9D, 0x85, 0xC5,
-    0xAD, 0xBA, 0x00, 0x58, 0xEA, 0x5E, 0xDA, 0xC2, 0xC9, 0x43, 0x5A, 0x3E, 0xA0, 0xB6, 0x24, 0x9D,
-    0xB6, 0x7C, 0xA8, 0x1C, 0xDA, 0x7F, 0x87, 0xB5, 0x7C, 0x20, 0x64, 0x1F, 0x5A, 0x3E, 0xFC, 0x89,
-    0x6D, 0xF9, 0xD0, 0x2E, 0x5B, 0x3E, 0x34, 0x87, 0xB7, 0x7C, 0x80, 0xC8, 0x73, 0xA6, 0x2D, 0x1F,
-    0xBA, 0xCB, 0xB6, 0xE5, 0x83, 0xDD, 0x49, 0x03, 0x97, 0x0E, 0x06, 0xD8, 0x7E, 0x80, 0x6C, 0xFB,
-    0x9A, 0x38, 0xFB, 0x80, 0x32, 0x7F, 0x7E, 0x05, 0x64, 0x86, 0x7E, 0xF6, 0xE0, 0xC5, 0x88, 0x40,
-    0x26, 0x94, 0xEB, 0xED, 0x4E, 0x05, 0x4B, 0x8C, 0x6A, 0x9A, 0x67, 0x86, 0xFC, 0xE8, 0x62, 0x48,
-    0x78, 0x8E, 0x56, 0x93, 0x61, 0xD2, 0x83, 0x79, 0xC5, 0x4C, 0xA7, 0x9E, 0xC1, 0xED, 0x74, 0x1C,
-    0xDF, 0xF9, 0x55, 0x94, 0xAD, 0x7C, 0xAF, 0x7D, 0x3C, 0xEC, 0xBF, 0xDE, 0xCF, 0x91, 0x1E, 0x57,
-    0xCB, 0x5A, 0x1C, 0x2D, 0x87, 0x19, 0x10, 0x67, 0x86, 0x63, 0xE5, 0xE7, 0xCE, 0x30, 0xE4, 0x27,
-    0x1F, 0xA4, 0x71, 0x9E, 0x5C, 0x20, 0x2D, 0x40, 0x01, 0xFC, 0xC7, 0x16, 0x17, 0xF6, 0x95, 0xCC,
-    0xCD, 0x0E, 0x3A, 0x74, 0xAC, 0xD3, 0xF6, 0xE1, 0x04, 0xFD, 0x9E, 0xB4, 0x2E, 0xB1, 0xC5, 0x32,
-    0xEF, 0x03, 0xCE, 0xEC, 0xDF, 0xEB, 0xBE, 0xB6, 0x92, 0xE8, 0x46, 0x85, 0xF5, 0xDD, 0x0D, 0x46,
-    0x1C, 0xE5, 0xD1, 0x75, 0x58, 0x78, 0x6D, 0x98, 0x39, 0xAD, 0x3C, 0x54, 0x7E, 0xE5, 0x2C, 0x03,
-    0x81, 0x47, 0xCE, 0xBF, 0xB7, 0x59, 0x3A, 0x43, 0xB2, 0xDB, 0x6A, 0xA1, 0xBD, 0x59, 0x29, 0xB4,
-    0x2F, 0x26, 0x85, 0xF6, 0xA5, 0x2D, 0xB4, 0x9F, 0xD9, 0x42, 0xFB, 0x4F, 0xC1, 0x7C, 0xAC, 0xD6,
-    0x45, 0x7B, 0x06, 0x4C, 0x3F, 0x0C, 0x4A, 0xBF, 0x1D, 0xDC, 0xFE, 0xD1, 0xDD, 0xFF, 0xAA, 0x4E,
-    0xE9, 0x2D, 0xCE, 0xF5, 0x93, 0x93, 0x36, 0x3C, 0xAB, 0xC4, 0x75, 0x0E, 0x2F, 0xB4, 0x7F, 0xBB,
-    0xEC, 0xEF, 0x6C, 0x92, 0xFD, 0x3D, 0xDF, 0x9F, 0xFD, 0xDD, 0x7E, 0x04, 0xA9, 0x1F, 0x67, 0x98,
-    0x97, 0x88, 0x94, 0x3A, 0xC1, 0x2D, 0xDE, 0xE2, 0x04, 0x31, 0x75, 0x8D, 0xEC, 0xEF, 0x75, 0xCC,
-    0xE2, 0x24, 0x78, 0xE7, 0xC8, 0xDB, 0x64, 0x7F, 0x5F, 0x1F, 0xFC, 0x85, 0x28, 0x47, 0xB0, 0x42,
-    0x23, 0xEA, 0xB5, 0x80, 0xD1, 0x76, 0xD7, 0x32, 0x87, 0x76, 0xFF, 0x7B, 0x30, 0x6B, 0x94, 0xFB,
-    0xBB, 0x47, 0x45, 0xF7, 0xEF, 0x5A, 0xF4, 0x0E, 0xC8, 0xF5, 0x09, 0x2B, 0xBA, 0x51, 0x2E, 0x51,
-    0xC7, 0x42, 0xFF, 0x67, 0xBA, 0xAB, 0x97, 0x6D, 0x09, 0xB7, 0xE6, 0x42, 0xD6, 0x93, 0x5C, 0xC8,
-    0x49, 0x6A, 0x50, 0x30, 0xA4, 0x06, 0x0D, 0x0D, 0x40, 0x27, 0xE9, 0x41, 0xFB, 0xBB, 0x64, 0xCD,
-    0xB4, 0x4B, 0x56, 0xC9, 0xAA, 0xD5, 0x49, 0x97, 0xAC, 0xFB, 0xCF, 0xD3, 0x67, 0xFB, 0x82, 0x63,
-    0xD7, 0xD8, 0x73, 0xE1, 0x40, 0x27, 0x81, 0x77, 0x3B, 0x4F, 0x61, 0xE9, 0xEE, 0xB1, 0xFE, 0x6A,
-    0xC7, 0x7E, 0xA8, 0xBB, 0x82, 0xE3, 0x6F, 0xC9, 0x6F, 0x2B, 0xA6, 0xC5, 0xB8, 0x1D, 0xE6, 0xE6,
-    0xD5, 0xEE, 0xCA, 0x7D, 0xD3, 0xA0, 0x86, 0xB9, 0xFE, 0xEC, 0xF3, 0x82, 0xD5, 0x35, 0xF6, 0x48,
-    0x0B, 0xD1, 0x3B, 0x52, 0xE6, 0xE5, 0x4C, 0xB7, 0xB6, 0x16, 0x03, 0xC7, 0xD3, 0xE2, 0xD8, 0x8C,
-    0x8D, 0x26, 0xD1, 0x03, 0x49, 0xFE, 0x8A, 0x79, 0xC5, 0x09, 0xE6, 0x35, 0x89, 0x43, 0x80, 0x97,
-    0x36, 0xF8, 0xFC, 0x0A, 0x18, 0x5B, 0xDB, 0x45, 0xAA, 0xE3, 0xD7, 0xEB, 0x5F, 0x65, 0x15, 0x31,
-    0x1D, 0xC2, 0xCE, 0x73, 0xEF, 0x80, 0x1A, 0xAE, 0x0C, 0x51, 0xE4, 0x76, 0x85, 0xE8, 0x2C, 0xFC,
-    0xF2, 0x48, 0xC0, 0x96, 0xC1, 0xA3, 0x3C, 0x0E, 0xC1, 0x97, 0x05, 0x7E, 0xC3, 0x6C, 0x48, 0x23,
-    0xD3, 0x14, 0xB2, 0x35, 0x79, 0xE6, 0x79, 0xA1, 0x13, 0xB2, 0x47, 0x23, 0xB1, 0xB6, 0x8E, 0x01,
-    0x5D, 0x8B, 0x2E, 0x90, 0xC7, 0xA2, 0x1D, 0x6D, 0xD4, 0x9A, 0x6B, 0xFD, 0x65, 0x6C, 0xF4, 0xF3,
-    0xDB, 0x20, 0xD0, 0x79, 0x19, 0xFB, 0xE9, 0x00, 0xB4, 0xBE, 0x71, 0x9C, 0xC6, 0xF7, 0xAC, 0xD2,
-    0x3D, 0x82, 0x62, 0x1D, 0xD5, 0x14, 0x2E, 0xBA, 0x21, 0xA8, 0xD7, 0x0B, 0xD9, 0xBD, 0xCA, 0xAD,
-    0x75, 0x50, 0x9C, 0xD4, 0xAB, 0x1B, 0x61, 0x66, 0x4B, 0xEC, 0xD7, 0xA3, 0x67, 0x6B, 0x0B, 0x0E,
-    0x06, 0x65, 0x13, 0xDA, 0x68, 0x3F, 0x92, 0xB0, 0x52, 0xEB, 0xF2, 0x47, 0xD1, 0xE4, 0xC2, 0xEE,
-    0xB2, 0x5B, 0x4A, 0x35, 0x6E, 0xFC, 0xD4, 0xF6, 0xB0, 0xD0, 0x7C, 0x31, 0x35, 0xC4, 0xB4, 0xBB,
-    0x2B, 0x4B, 0x20, 0xB4, 0xD3, 0x8E, 0x0A, 0x2F, 0x08, 0x57, 0xA1, 0x2E, 0xEB, 0x26, 0x1B, 0xB3,
-    0xD9, 0x25, 0x33, 0x41, 0x2D, 0x79, 0xE9, 0xCA, 0x6E, 0x76, 0x46, 0xDF, 0x94, 0xB5, 0x65, 0x38,
-    0x8C, 0x43, 0x10, 0xC1, 0xD2, 0xFF, 0xE8, 0x9B, 0x83, 0x28, 0xE1, 0xF8, 0x8A, 0xD6, 0x6F, 0x98,
-    0xBF, 0x8B, 0x7C, 0x4B, 0x64, 0x9D, 0x6D, 0x16, 0x6E, 0x99, 0x26, 0xDB, 0xA6, 0x11, 0x0A, 0x21,
-    0x4F, 0x58, 0x64, 0x13, 0x58, 0x54, 0x8C, 0xEF, 0xD2, 0x23, 0x8F, 0xB6, 0x8A, 0xDB, 0x82, 0xA2,
-    0xB1, 0x16, 0xFC, 0xD7, 0x9B, 0x78, 0x6C, 0x11, 0x37, 0x5C, 0xA8, 0x56, 0x0A, 0x3F, 0x5F, 0x2B,
-    0xA2, 0x8A, 0xBD, 0x4A, 0x19, 0x28, 0x9E, 0x95, 0xBB, 0x0C, 0x78, 0xDC, 0xF2, 0x0B, 0xCD, 0xF0,
-    0x6B, 0xB0, 0x9A, 0x1F, 0x41, 0x55, 0x9E, 0x5C, 0x64, 0x5B, 0x26, 0x7F, 0xB1, 0x08, 0x32, 0xD4,
-    0xB5, 0xC5, 0x9D, 0x58, 0x2D, 0x68, 0x38, 0xA1, 0x30, 0xFE, 0x89, 0x11, 0x69, 0x56, 0x63, 0x20,
-    0xCA, 0xAC, 0xEA, 0xFC, 0x25, 0x4A, 0x8A, 0x87, 0x26, 0x9D, 0x83, 0xD5, 0x70, 0x74, 0x84, 0xB7,
-    0x0E, 0x5A, 0x20, 0x07, 0x7B, 0xB9, 0x58, 0x8E, 0xC5, 0x6C, 0xCE, 0xB0, 0xA3, 0xA6, 0x08, 0xBF,
-    0x84, 0xC3, 0x11, 0x5B, 0x13, 0xDD, 0x0C, 0xFB, 0x09, 0x3E, 0x25, 0x78, 0x1A, 0x7D, 0x04, 0x18,
-    0x1E, 0xBB, 0xD6, 0x8C, 0x25, 0xCA, 0xA4, 0x3F, 0x8B, 0xDF, 0xC3, 0xF2, 0x08, 0x0E, 0x68, 0x7B,
-    0x58, 0xBE, 0x84, 0x3F, 0x40, 0x61, 0x66, 0xB1, 0x2C, 0x96, 0x89, 0xF6, 0x36, 0x1B, 0xAD, 0xE8,
-    0x51, 0x70, 0xE7, 0xD4, 0xA3, 0x6B, 0xB2, 0xB1, 0xC5, 0xA9, 0xE6, 0x0F, 0xEA, 0xC1, 0xD0, 0x3A,
-    0x32, 0x71, 0xD8, 0x3A, 0xDD, 0x0B, 0x0C, 0x7D, 0xCE, 0x4A, 0xA7, 0x75, 0x8B, 0x61, 0xCF, 0x08,
-    0x27, 0x3F, 0xB9, 0x59, 0x98, 0x5C, 0x2E, 0x7F, 0x37, 0x1F, 0x2A, 0x03, 0xAB, 0x23, 0x32, 0xD4,
-    0x4B, 0x72, 0x86, 0x1A, 0x44, 0xA0, 0x34, 0xFD, 0x4E, 0xAE, 0xD0, 0x25, 0xB2, 0x3C, 0x01, 0xBA,
-    0xC0, 0xFA, 0x40, 0xB7, 0x3C, 0x19, 0x8B, 0xDB, 0x4D, 0x00, 0x5F, 0x8A, 0x46, 0x19, 0xB7, 0xBD,
-    0x9E, 0x25, 0xC6, 0x01, 0x1A, 0x34, 0xB5, 0x66, 0xCD, 0xA5, 0xAC, 0xB9, 0xA4, 0x94, 0x60, 0x99,
-    0x6C, 0xC3, 0x8D, 0xC3, 0x8C, 0x34, 0xD6, 0x86, 0x24, 0x3C, 0x9D, 0x52, 0x89, 0x73, 0xC9, 0xB6,
-    0x07, 0xB1, 0x8B, 0xAF, 0x4A, 0x83, 0x46, 0x35, 0xBB, 0x95, 0x18, 0xF5, 0x61, 0x8E, 0x29, 0x2F,
-    0xB1, 0xE6, 0xB9, 0xA4, 0x43, 0x5B, 0x0C, 0x8A, 0x32, 0xC2, 0x0A, 0x08, 0x55, 0xC7, 0xF6, 0x74,
-    0x16, 0x01, 0x04, 0xB3, 0x39, 0x6E, 0xA6, 0xEE, 0x59, 0x8B, 0xD7, 0x06, 0x63, 0xA3, 0x9E, 0x72,
-    0x84, 0xE5, 0x07, 0xA7, 0x18, 0x91, 0xDA, 0xAC, 0x11, 0xA4, 0x16, 0xB7, 0x72, 0xE3, 0x3F, 0xBF,
-    0xE4, 0x36, 0x6E, 0xF9, 0x09, 0x17, 0xE9, 0x4F, 0xDE, 0xFC, 0x14, 0x6E, 0x24, 0xEB, 0x35, 0xFB,
-    0x11, 0x33, 0xEF, 0x21, 0x86, 0x99, 0xAD, 0x51, 0xB0, 0xF7, 0x2E, 0x7B, 0xDB, 0xB2, 0x4E, 0x9B,
-    0xCE, 0x1D, 0xED, 0x93, 0xAD, 0x49, 0x87, 0xC9, 0xF6, 0x50, 0xE7, 0x52, 0x0C, 0x7C, 0x47, 0xE1,
-    0xC1, 0x8D, 0x17, 0x0D, 0x46, 0x0A, 0x87, 0x8C, 0x00, 0x01, 0xE8, 0x1B, 0x56, 0xC4, 0xD3, 0x3D,
-    0xC3, 0xD9, 0xDE, 0x5E, 0xC3, 0x64, 0xA3, 0xEC, 0x06, 0xA1, 0x8B, 0xD2, 0x77, 0x9D, 0xF4, 0xBD,
-    0xB1, 0x45, 0xFA, 0x5E, 0xD7, 0xDE, 0xCD, 0x3F, 0x2E, 0x79, 0xFA, 0x29, 0x6E, 0xEE, 0x7F, 0x97,
-    0x14, 0x0D, 0xDE, 0xB2, 0xC6, 0x9D, 0x7A, 0x43, 0x5F, 0xFB, 0x0B, 0xD6, 0xB7, 0xBC, 0xF6, 0x47,
-    0x6C, 0xAC, 0xF7, 0x85, 0x2F, 0x30, 0xD1, 0xEE, 0x37, 0x3E, 0xC3, 0x4E, 0x01, 0x81, 0x76, 0x4C,
-    0x53, 0x5E, 0xCE, 0xC7, 0x94, 0xE6, 0x5C, 0x95, 0xD6, 0x61, 0x5D, 0x6D, 0x6D, 0xC3, 0x35, 0xC4,
-    0xD0, 0x61, 0x3E, 0xCA, 0xF7, 0xD7, 0x5E, 0xC4, 0xD8, 0x6E, 0x7C, 0x54, 0xB4, 0xF3, 0x7F, 0xA9,
-    0x30, 0xB2, 0x9F, 0xB0, 0xA9, 0xC1, 0x1B, 0x18, 0xD7, 0x8F, 0xDA, 0xD1, 0x19, 0xE3, 0xBF, 0xC5,
-    0xEE, 0x08, 0xAF, 0xC1, 0xCE, 0x0C, 0xBE, 0xF9, 0x59, 0x44, 0x04, 0xBE, 0xF5, 0x1B, 0x90, 0x5C,
-    0xFF, 0x4E, 0x9B, 0x34, 0x79, 0x9A, 0x71, 0xB2, 0xD0, 0x2E, 0x85, 0x97, 0xA1, 0xB7, 0xA3, 0xFA,
-    0xC1, 0x9C, 0x97, 0xF6, 0xF5, 0x25, 0x55, 0x25, 0x1F, 0x14, 0xE7, 0x95, 0x5A, 0x5C, 0x5F, 0xDF,
-    0x2F, 0xCF, 0x76, 0x80, 0xCE, 0xF9, 0x24, 0x70, 0x3D, 0x83, 0xDF, 0x2B, 0x46, 0xE6, 0xC1, 0x9F,
-    0x5F, 0x72, 0x96, 0xBC, 0x56, 0xBF, 0x67, 0x5E, 0x33, 0x03, 0xAF, 0xF1, 0x69, 0x0D, 0xCA, 0x37,
-    0xEF, 0x82, 0x5C, 0xE5, 0x19, 0x92, 0xAB, 0x44, 0x4D, 0xEA, 0x79, 0x85, 0x03, 0x5B, 0x8A, 0xE7,
-    0x48, 0xAE, 0x39, 0x23, 0x47, 0x22, 0xB5, 0x95, 0x5C, 0x81, 0xD2, 0xE9, 0x94, 0xBA, 0xC2, 0xB6,
-    0xF4, 0x6E, 0x73, 0xD5, 0x5E, 0xDD, 0x94, 0x5C, 0x99, 0xED, 0x35, 0x3E, 0x90, 0x8B, 0x5E, 0x22,
-    0xF5, 0x9E, 0xE5, 0x43, 0xA7, 0x31, 0x4F, 0xFB, 0xFF, 0x61, 0x4D, 0x65, 0x45, 0x91, 0x35, 0xF5,
-    0x02, 0xC8, 0x25, 0xFF, 0x29, 0xB9, 0x06, 0xA9, 0xD2, 0x20, 0x64, 0xFE, 0xAA, 0xE0, 0x82, 0x66,
-    0xDD, 0x9B, 0x3B, 0xF3, 0xE6, 0x22, 0x86, 0xF3, 0xFB, 0x76, 0x34, 0x88, 0xF4, 0xC0, 0x67, 0x05,
-    0x79, 0x1E, 0x7C, 0x83, 0xE5, 0x02, 0xD4, 0xA7, 0x21, 0x57, 0x31, 0x7A, 0x79, 0xC1, 0xE7, 0x6B,
-    0x9B, 0x12, 0x45, 0x7C, 0xC0, 0x7E, 0x2C, 0xF5, 0x80, 0x49, 0xC5, 0x0E, 0x36, 0x33, 0xD6, 0x94,
-    0x3B, 0xF9, 0xB4, 0x3D, 0xDB, 0x6D, 0x6D, 0xD6, 0xD1, 0x2D, 0x7B, 0x75, 0xAC, 0xB4, 0x67, 0x6B,
-    0x26, 0xED, 0xD9, 0xB2, 0x65, 0x7B, 0xB6, 0xD9, 0xA4, 0x3D, 0x5B, 0x7A, 0x9F, 0xF6, 0x6C, 0x8B,
-    0x49, 0x7B, 0xB6, 0x68, 0xD9, 0x9E, 0x6D, 0x68, 0xCF, 0x31, 0x74, 0xE7, 0x18, 0xDB, 0xB3, 0xD5,
-    0x07, 0xDB, 0xB3, 0x39, 0xB6, 0x95, 0x98, 0xB6, 0x10, 0x4B, 0x6C, 0x7B, 0x36, 0xAB, 0xB8, 0x73,
-    0xAB, 0xAD, 0x62, 0xB3, 0x6A, 0xB3, 0x06, 0xFB, 0xD4, 0xF5, 0xC9, 0xA5, 0x67, 0x41, 0x18, 0xCD,
-    0xAB, 0x9F, 0x69, 0x35, 0x19, 0xD1, 0x47, 0x8A, 0x8C, 0x5F, 0xB9, 0x73, 0xED, 0xB5, 0xCB, 0x6C,
-    0x87, 0xB0, 0x60, 0xC2, 0x0A, 0x52, 0x5B, 0x92, 0xE0, 0xEE, 0xD5, 0x5C, 0xBD, 0xCE, 0x5A, 0x33,
-    0x93, 0x69, 0x47, 0x85, 0x0E, 0x83, 0x5F, 0xB0, 0x87, 0xC7, 0x11, 0x98, 0x79, 0x70, 0x91, 0xD3,
-    0xAE, 0x38, 0xBA, 0x3E, 0x26, 0x25, 0x5C, 0x1C, 0xA4, 0xAC, 0x37, 0xB4, 0xD7, 0xF4, 0xD8, 0xEB,
-    0xEB, 0x73, 0x63, 0x92, 0x51, 0xA2, 0xA4, 0xDF, 0xEB, 0x13, 0xDB, 0x2F, 0x2D, 0x1C, 0x88, 0x1F,
-    0x0C, 0xD4, 0x0F, 0x06, 0xF2, 0x7F, 0x74, 0x49, 0xFF, 0x71, 0x01, 0xC6, 0x15, 0x18, 0x97, 0x60,
-    0x5C, 0x83, 0x71, 0x11, 0xC6, 0x55, 0xE0, 0x32, 0xB4, 0x66, 0xB2, 0x0E, 0xE3, 0x42, 0x8C, 0x2B,
-    0x31, 0x2E, 0xC5, 0xB8, 0x16, 0xE3, 0x62, 0x8C, 0xCD, 0xF2, 0x86, 0xE5, 0x18, 0x5B, 0xBA, 0x2D,
-    0xFB, 0xE5, 0x81, 0xB2, 0x72, 0x01, 0xDA, 0xEE, 0x31, 0x24, 0xE7, 0x0B, 0xD7, 0x92, 0xBE, 0x81,
-    0x21, 0x85, 0x8F, 0x5B, 0x1F, 0x3E, 0xBB, 0xB9, 0x15, 0x44, 0xF1, 0x98, 0x90, 0x6F, 0x53, 0xA0,
-    0x40, 0x6B, 0xA3, 0xD4, 0xD6, 0x46, 0xEE, 0x8A, 0xD0, 0x76, 0x75, 0xA8, 0x9D, 0x0E, 0x74, 0x61,
-    0xFB, 0xB9, 0xD8, 0xD2, 0x0F, 0xCD, 0xA9, 0x8B, 0x55, 0x8D, 0x1D, 0x5D, 0x76, 0xC6, 0x63, 0x52,
-    0xAF, 0x6D, 0x0B, 0xC9, 0x36, 0xF5, 0x85, 0x35, 0xE5, 0x48, 0x2F, 0x67, 0x68, 0x53, 0xEF, 0xB6,
-    0x43, 0x9B, 0xFA, 0xC6, 0x8C, 0x90, 0x73, 0x5F, 0x9B, 0x7A, 0xB9, 0x50, 0x7A, 0xF9, 0x95, 0xBD,
-    0x40, 0xCF, 0x27, 0x86, 0xAD, 0x60, 0x35, 0x6B, 0x17, 0x1E, 0x74, 0x37, 0x46, 0xE3, 0x7A, 0x21,
-    0x2E, 0x9C, 0x18, 0x2C, 0x07, 0xF1, 0x69, 0x4A, 0x6B, 0x9B, 0x7A, 0xE6, 0xDF, 0xDB, 0x9E, 0xF0,
-    0x29, 0x67, 0x07, 0xEC, 0xCD, 0x2F, 0xFA, 0x2C, 0x9E, 0x61, 0xB4, 0x96, 0x06, 0x84, 0x7C, 0xB1,
-    0x62, 0xBF, 0xFA, 0xDB, 0x28, 0x53, 0x45, 0xD7, 0xDA, 0xC5, 0x32, 0xFE, 0x3A, 0xC6, 0xA9, 0xD5,
-    0xCC, 0x7A, 0x62, 0xB0, 0xAE, 0xDA, 0xA5, 0xB5, 0x6A, 0x53, 0x6B, 0x3B, 0xEB, 0x7D, 0x37, 0xF9,
-    0x5D, 0xBB, 0x5B, 0x42, 0x1B, 0xC4, 0x54, 0x87, 0x43, 0xAC, 0x69, 0x85, 0x62, 0x4D, 0xBE, 0xDA,
-    0x65, 0xB6, 0x9F, 0x12, 0xBB, 0x2B, 0xD5, 0x34, 0x2B, 0x61, 0x61, 0xA1, 0x8D, 0x52, 0xC9, 0x13,
-    0x13, 0x45, 0x75, 0xED, 0x64, 0x32, 0x21, 0x87, 0x66, 0x22, 0x51, 0x60, 0x68, 0x62, 0x91, 0xC4,
-    0x99, 0xDD, 0x22, 0xB2, 0x5A, 0x88, 0xBD, 0x32, 0x1D, 0x6B, 0x86, 0xE8, 0x18, 0xFA, 0x66, 0x31,
-    0xC7, 0x78, 0x56, 0xB1, 0xDB, 0x87, 0x5F, 0x6D, 0xF3, 0xB4, 0x92, 0x11, 0x60, 0x4F, 0x60, 0x05,
-    0xA7, 0x1E, 0xCA, 0x40, 0x6E, 0xA9, 0x44, 0x26, 0xD6, 0xEB, 0xAF, 0x95, 0x66, 0x74, 0xD1, 0x0E,
-    0xE9, 0x33, 0x19, 0xD3, 0x67, 0xB4, 0x72, 0x28, 0x19, 0x08, 0x93, 0xD2, 0x80, 0x5A, 0xC0, 0x11,
-    0x2B, 0xA2, 0x56, 0x00, 0xF1, 0x6C, 0x8E, 0xC2, 0x30, 0xB4, 0x59, 0x11, 0x2E, 0xAC, 0xFC, 0xDA,
-    0xAF, 0x91, 0x4E, 0xEC, 0xD7, 0x71, 0x81, 0xB6, 0x8D, 0xC8, 0x67, 0x11, 0x79, 0x2B, 0x88, 0x13,
-    0xB1, 0x3C, 0xB4, 0xDF, 0x45, 0xBA, 0x0C, 0xA2, 0x98, 0x88, 0xE1, 0xE1, 0x88, 0x60, 0x4A, 0x5C,
-    0x20, 0x7D, 0x26, 0xFA, 0x06, 0x42, 0x55, 0xE1, 0xDF, 0x30, 0x24, 0xCA, 0xAE, 0xAE, 0xAF, 0x2C,
-    0x94, 0xDD, 0x5E, 0x91, 0xC7, 0x3F, 0x17, 0xF5, 0x2B, 0x5E, 0x41, 0x57, 0xFD, 0x24, 0xF6, 0x9D,
-    0x07, 0x5C, 0x12, 0x91, 0x35, 0x22, 0x50, 0xCA, 0xF0, 0x0D, 0x74, 0xFC, 0x15, 0x7A, 0x64, 0xBB,
-    0x28, 0x04, 0x14, 0xF4, 0x9E, 0x8A, 0x05, 0x57, 0x23, 0x3F, 0xAE, 0xCA, 0x51, 0xD3, 0x8C, 0x43,
-    0x91, 0x3A, 0x0D, 0x12, 0xA8, 0x5A, 0xB4, 0xB5, 0xD9, 0x15, 0x82, 0xDD, 0x4B, 0x6B, 0xC6, 0x9A,
-    0x4A, 0x73, 0xF4, 0xD9, 0x3C, 0xFB, 0x20, 0xA3, 0x3A, 0x19, 0x1B, 0xFA, 0x14, 0x88, 0xEA, 0x84,
-    0xE8, 0xD7, 0xD2, 0x6B, 0x0A, 0xC1, 0x7C, 0x99, 0x39, 0x70, 0x69, 0xE2, 0x36, 0x3C, 0xBF, 0x3C,
-    0x9E, 0xD2, 0xBD, 0x33, 0x5F, 0xE9, 0xE6, 0xF7, 0xDE, 0xA3, 0x3A, 0x4E, 0x16, 0x95, 0x7E, 0x82,
-    0xEA, 0x49, 0x07, 0x7C, 0xBD, 0x36, 0x01, 0xEC, 0xBE, 0x7A, 0x04, 0x3C, 0x21, 0x94, 0xD7, 0x99,
-    0xD1, 0xC2, 0xB2, 0xED, 0x15, 0x93, 0x88, 0xAF, 0xE5, 0x39, 0x67, 0xDB, 0x2B, 0xA2, 0x6F, 0xE1,
-    0x45, 0xB9, 0xEF, 0xF1, 0xA9, 0xA9, 0xFE, 0x76, 0x6E, 0x9F, 0x07, 0xA7, 0x78, 0x85, 0x87, 0xB7,
-    0x79, 0xFB, 0xD8, 0xA4, 0xBD, 0xA2, 0x0D, 0x8A, 0xD9, 0xA4, 0x37, 0xA5, 0xD8, 0xD6, 0x24, 0x97,
-    0xED, 0xE2, 0x6A, 0x88, 0xE0, 0xF0, 0xC6, 0x02, 0xF1, 0x07, 0xD7, 0x58, 0x60, 0x08, 0x74, 0x7C,
-    0xF6, 0x3E, 0x8A, 0x76, 0x7D, 0xD5, 0x69, 0xEC, 0x0D, 0x05, 0xCA, 0xD6, 0x02, 0xFD, 0x2D, 0xB9,
-    0x6F, 0x5F, 0x85, 0x7D, 0x15, 0x75, 0x97, 0x3F, 0xDE, 0x5F, 0x46, 0xFF, 0x9C, 0x05, 0x09, 0xCC,
-    0x66, 0xE5, 0x2E, 0x7D, 0x37, 0x5E, 0xA1, 0x69, 0xD5, 0x58, 0xF4, 0x33, 0x64, 0xC4, 0x2D, 0x52,
-    0x92, 0xB6, 0xE5, 0x6B, 0xCC, 0xB1, 0xFF, 0x16, 0x33, 0xDD, 0xFF, 0x9F, 0xB1, 0xB9, 0x8F, 0xEF,
-    0xA6, 0x99, 0x3B, 0x59, 0x5F, 0x1B, 0x5E, 0x46, 0x63, 0xEF, 0x40, 0x18, 0x93, 0xDB, 0xE8, 0x70,
-    0xDF, 0x6B, 0xDF, 0x47, 0xF4, 0x1B, 0x85, 0x7B, 0x3A, 0x32, 0xC3, 0xE1, 0xBC, 0x61, 0x98, 0xD9,
-    0x45, 0x86, 0xB4, 0x03, 0xDC, 0xE8, 0x30, 0xBA, 0xDC, 0xC2, 0x46, 0x6C, 0xC1, 0x7F, 0x2D, 0x78,
-    0x7D, 0x67, 0x67, 0xA8, 0xF6, 0x4F, 0x8B, 0x01, 0x9D, 0x6C, 0x8F, 0x88, 0xF7, 0xD6, 0xB8, 0xF0,
-    0xCB, 0x4E, 0x62, 0x50, 0x80, 0xEC, 0xBA, 0xFD, 0xFE, 0x91, 0xE5, 0xE8, 0x0B, 0x6F, 0x6A, 0x9F,
-    0x51, 0x59, 0x8B, 0xA3, 0x2F, 0xDE, 0xD9, 0x78, 0x24, 0xC8, 0xC2, 0x8A, 0x8C, 0xDF, 0xED, 0xAF,
-    0xBE, 0x1D, 0x59, 0xDE, 0x69, 0x0B, 0x4D, 0xCE, 0xBC, 0x3A, 0xA7, 0xE2, 0x8E, 0xC1, 0xD4, 0xD9,
-    0xDF, 0xAB, 0xDF, 0x4A, 0x95, 0xE0, 0x6A, 0x0B, 0x4D, 0xDB, 0x2C, 0xD2, 0xD3, 0x50, 0x63, 0xA0,
-    0x9D, 0x19, 0xCE, 0xAD, 0xB4, 0xD0, 0xAC, 0xC8, 0x46, 0xFE, 0x7D, 0x5A, 0x68, 0xF6, 0xB6, 0x85,
-    0xE6, 0xFF, 0xD1, 0x16, 0x9A, 0xD6, 0xE0, 0xD6, 0x93, 0xA6, 0x84, 0x1E, 0x6E, 0x70, 0x9B, 0xA5,
-    0xC1, 0xDD, 0x67, 0x6E, 0x27, 0xFB, 0x7A, 0x06, 0x1F, 0x7C, 0x90, 0x69, 0xF7, 0x6C, 0x0F, 0x66,
-    0x9C, 0xDB, 0x10, 0x05, 0xE3, 0x93, 0x1C, 0x7B, 0x3A, 0x48, 0x66, 0x26, 0x26, 0x78, 0x7F, 0x01,
-    0x21, 0x07, 0xAB, 0x71, 0x0D, 0xEC, 0xBE, 0x23, 0xF4, 0x77, 0x90, 0xDF, 0x72, 0xA2, 0x72, 0xBA,
-    0x44, 0xC4, 0x44, 0xFF, 0xCE, 0x6C, 0xED, 0x8F, 0x5D, 0xA6, 0x68, 0xAC, 0x45, 0xB3, 0x40, 0x38,
-    0xD6, 0x79, 0x9F, 0x45, 0xC9, 0x42, 0x66, 0x8D, 0xE5, 0x6C, 0x5D, 0x34, 0x10, 0x15, 0x6B, 0xC9,
-    0x45, 0x73, 0xE3, 0x8B, 0x6E, 0x0B, 0x97, 0xDF, 0x90, 0xE7, 0xAE, 0x9B, 0x3A, 0x54, 0x34, 0x47,
-    0x31, 0x37, 0xC0, 0x51, 0x08, 0xC4, 0xD8, 0x72, 0x57, 0x6A, 0xCF, 0x83, 0xCB, 0xA5, 0xB3, 0x5A,
-    0x64, 0x61, 0x45, 0xA3, 0x35, 0x04, 0x34, 0x78, 0x65, 0xBD, 0x47, 0xA9, 0x39, 0x3C, 0x78, 0xB5,
-    0xD0, 0xF3, 0x89, 0xEE, 0xEA, 0xD5, 0x6B, 0x8B, 0xA1, 0xEB, 0xE7, 0x90, 0xA6, 0x55, 0xAC, 0x7A,
-    0xF4, 0x06, 0x7F, 0x5E, 0x70, 0x1F, 0x83, 0xE0, 0x17, 0xC8, 0xDF, 0xAD, 0x5F, 0xC5, 0xD7, 0xF6,
-    0xDA, 0xA0, 0x5C, 0xF7, 0xCB, 0x4B, 0x41, 0xB1, 0x15, 0x14, 0x67, 0x83, 0xE2, 0x7A, 0x50, 0x7C,
-    0x2A, 0x2C, 0x36, 0xC2, 0xE2, 0x71, 0x4A, 0xC3, 0x89, 0xCB, 0x97, 0x43, 0x8B, 0xB9, 0x8B, 0xB7,
-    0x39, 0xAC, 0x5B, 0x1C, 0x94, 0x9A, 0x75, 0xAD, 0x39, 0xCE, 0xE3, 0x59, 0xBC, 0x2B, 0xC3, 0xA9,
-    0xE8, 0xB4, 0xCE, 0x7A, 0xA6, 0x25, 0xA5, 0xAC, 0x05, 0x3E, 0x72, 0xF1, 0xBE, 0x51, 0x87, 0x61,
-    0xFB, 0x69, 0x67, 0x5C, 0xE7, 0xAB, 0x30, 0x04, 0x81, 0xA9, 0xC5, 0x3E, 0x38, 0x26, 0x10, 0x96,
-    0xB0, 0x50, 0x51, 0x7B, 0xAC, 0x98, 0xDD, 0x22, 0x76, 0x8B, 0xD7, 0x2D, 0x5A, 0xDF, 0x55, 0xFA,
-    0x58, 0xA4, 0xAE, 0xCD, 0xE6, 0xF1, 0x1D, 0x5F, 0xFB, 0xC0, 0xCB, 0x20, 0x4F, 0x34, 0x5A, 0x58,
-    0x41, 0x73, 0xAB, 0xFF, 0x8F, 0x1C, 0x44, 0x32, 0xB3, 0xBD, 0xEC, 0x6D, 0xB2, 0x66, 0x75, 0x48,
-    0xCE, 0xA6, 0xCD, 0xC5, 0x52, 0xB8, 0xA0, 0xD2, 0x61, 0xF0, 0x19, 0x8C, 0x2E, 0xB1, 0x5B, 0x2B,
-    0x82, 0x7F, 0xF5, 0xA4, 0x59, 0xDA, 0x08, 0x3E, 0x0B, 0x29, 0xFC, 0x92, 0x7D, 0x11, 0x67, 0x4B,
-    0x73, 0xAB, 0x66, 0x46, 0xF9, 0x68, 0xC9, 0x2B, 0x96, 0x94, 0xBD, 0xE5, 0xBF, 0xB9, 0x09, 0x47,
-    0x77, 0x83, 0x96, 0x7D, 0xD9, 0xAA, 0x64, 0x58, 0x1E, 0xE8, 0x1F, 0x42, 0x4B, 0x12, 0x63, 0x29,
-    0x7C, 0x7D, 0xA0, 0x2F, 0x43, 0xC1, 0x4C, 0x1D, 0x60, 0xC3, 0xBE, 0x5E, 0x49, 0xFB, 0x6E, 0x9A,
-    0xBD, 0x7E, 0x94, 0xCD, 0x5E, 0xCF, 0xB0, 0xD9, 0xEB, 0x69, 0xC6, 0xCA, 0xD6, 0xD9, 0xEC, 0x75,
-    0x9D, 0xCD, 0x5E, 0xB7, 0x0E, 0x34, 0x7B, 0x55, 0x99, 0x51, 0xD1, 0x7A, 0xAE, 0x68, 0x3B, 0x97,
-    0xDC, 0x20, 0x05, 0x0B, 0x9E, 0x93, 0x43, 0x9B, 0xBD, 0xBE, 0x4D, 0x33, 0x95, 0x6F, 0x7C, 0x5D,
-    0x1E, 0xF8, 0xDA, 0x37, 0x70, 0x40, 0x7B, 0xF7, 0x1F, 0x5C, 0x1B, 0x9A, 0xA9, 0x5C, 0x43, 0x33,
-    0x15, 0x16, 0x3C, 0x1D, 0xC7, 0xF3, 0x4E, 0xDD, 0xA7, 0x99, 0xCA, 0x58, 0xE1, 0xF8, 0xC3, 0xA5,
-    0xD8, 0x3B, 0xD8, 0x33, 0xFA, 0x90, 0x88, 0xC8, 0xB5, 0x85, 0x5A, 0x66, 0x82, 0x10, 0xBA, 0x24,
-    0xAC, 0x87, 0xD8, 0xE0, 0xF8, 0x1A, 0x17, 0xBE, 0x77, 0x70, 0x7C, 0x99, 0x0B, 0x5F, 0x1D, 0x47,
-    0xCB, 0x86, 0xEF, 0x25, 0x43, 0x05, 0x22, 0x5D, 0xF5, 0xB4, 0x6C, 0xC4, 0x9A, 0x39, 0xDA, 0xBF,
-    0xC9, 0x57, 0x6F, 0x75, 0x87, 0xF9, 0x85, 0x6C, 0xBF, 0xBC, 0x51, 0x4B, 0x6A, 0xFD, 0x35, 0xDC,
-    0x6B, 0x28, 0x80, 0x74, 0x50, 0xFE, 0xE8, 0xBC, 0xF5, 0xA0, 0x2E, 0x54, 0xFE, 0x03, 0xEA, 0xAF,
-    0x9B, 0xA1, 0xFE, 0xDA, 0x61, 0xFD, 0x35, 0x05, 0xC5, 0x91, 0x95, 0xCC, 0x28, 0xE6, 0xBF, 0x13,
-    0x44, 0x33, 0x22, 0xC3, 0x04, 0x7A, 0xB2, 0x8C, 0xB6, 0xB3, 0xB4, 0x6F, 0x13, 0xD3, 0x2E, 0xF5,
-    0x31, 0xB7, 0x5D, 0xF1, 0x92, 0xCF, 0xB4, 0xE4, 0x5B, 0x02, 0x85, 0xDD, 0x85, 0xD9, 0x96, 0xCF,
-    0x0B, 0x4F, 0xC7, 0xFD, 0x1E, 0x0C, 0xD9, 0x63, 0x3D, 0xF3, 0xF6, 0x86, 0x30, 0xC3, 0xD0, 0x16,
-    0xFA, 0xB0, 0x93, 0xB5, 0xE6, 0xE0, 0x0B, 0x4F, 0x88, 0xCF, 0x21, 0xB0, 0xBD, 0x85, 0x4D, 0x06,
-    0xB5, 0xAF, 0x2D, 0xB2, 0x81, 0x92, 0x49, 0x45, 0x26, 0x8D, 0x8B, 0x10, 0x95, 0x57, 0xDB, 0x0E,
-    0x03, 0xFF, 0x8B, 0xC7, 0x10, 0x27, 0x8D, 0xC5, 0x80, 0x6C, 0xCF, 0x23, 0x02, 0x7C, 0x3E, 0x2C,
-    0xC2, 0x2A, 0xCE, 0xFF, 0xAA, 0x07, 0x3E, 0x86, 0xB7, 0xE0, 0x4B, 0x2B, 0xFD, 0x08, 0x79, 0x90,
-    0x29, 0x01, 0xCA, 0xCF, 0x0A, 0xED, 0x00, 0xA2, 0x59, 0x1D, 0x2B, 0x5D, 0x3F, 0x1F, 0x75, 0xCA,
-    0xC4, 0x4A, 0x99, 0x60, 0x78, 0xB9, 0xCA, 0xD4, 0xCD, 0xED, 0x95, 0xD3, 0xF8, 0x86, 0xA7, 0x37,
-    0xF5, 0x92, 0xF7, 0x99, 0x86, 0xAC, 0x40, 0x8B, 0xC7, 0xC6, 0x1D, 0x67, 0xC6, 0x9A, 0x95, 0xA5,
-    0x5B, 0xE8, 0x53, 0x66, 0x78, 0x9D, 0xE3, 0x6D, 0xDD, 0x8E, 0xD3, 0x46, 0x0F, 0x63, 0xAF, 0x99,
-    0x7D, 0xD1, 0x5C, 0xFB, 0x3A, 0xC7, 0xA8, 0x58, 0x8D, 0xE6, 0x4E, 0xFA, 0x93, 0x39, 0x2B, 0xAF,
-    0x73, 0x5C, 0xF9, 0xB9, 0x62, 0x13, 0x61, 0xE0, 0xD9, 0xCC, 0x06, 0x38, 0x1E, 0x8E, 0xA1, 0xF8,
-    0xC1, 0x27, 0x30, 0xBC, 0xCF, 0xF0, 0x90, 0x9F, 0x7F, 0x94, 0xAF, 0xCE, 0xD1, 0x01, 0x64, 0x9E,
-    0x0D, 0x8F, 0xF9, 0x56, 0x3B, 0xAE, 0xDB, 0xAD, 0x61, 0xA3, 0x29, 0xBB, 0xC9, 0x01, 0x6A, 0x3D,
-    0xBA, 0xAD, 0x33, 0x1F, 0x72, 0xD0, 0xCA, 0x26, 0x29, 0xF7, 0xDA, 0x7D, 0xF9, 0x58, 0xAF, 0xDB,
-    0x36, 0xD5, 0x94, 0x03, 0x1A, 0xF0, 0x4C, 0x48, 0xA7, 0xE3, 0xAB, 0x32, 0xB6, 0xB4, 0x89, 0xBD,
-    0xDC, 0x2D, 0x4A, 0xA9, 0x06, 0x6F, 0x22, 0x96, 0x20, 0xD0, 0xD0, 0x81, 0x85, 0x1A, 0x76, 0xFF,
-    0xC7, 0xC9, 0xE8, 0xE3, 0x6A, 0x87, 0x37, 0x9F, 0xDA, 0xC8, 0x83, 0xE6, 0xCD, 0xAB, 0x6F, 0x6B,
-    0xF0, 0x6C, 0x3D, 0x39, 0x4D, 0x36, 0x7A, 0xFB, 0x10, 0xD6, 0x9C, 0x1A, 0xAE, 0x34, 0xFE, 0xBD,
-    0x4D, 0x34, 0x2B, 0x73, 0xBA, 0xD1, 0xCB, 0x8B, 0x3A, 0x79, 0xB6, 0x87, 0xD3, 0xEE, 0xAC, 0xDA,
-    0xA2, 0x35, 0xD9, 0x9E, 0xAA, 0xAB, 0x6D, 0x1B, 0xBC, 0xC0, 0x8B, 0x3C, 0xB5, 0xD1, 0x59, 0x09,
-    0xF7, 0xDE, 0x1E, 0xEA, 0x2B, 0xF2, 0xDB, 0x83, 0xCF, 0xA1, 0xD5, 0xF7, 0x7E, 0xFD, 0x90, 0xE6,
-    0x7D, 0xAF, 0x96, 0x3D, 0x97, 0xF0, 0xBA, 0xEA, 0xDF, 0x5A, 0x81, 0x4C, 0x45, 0x3D, 0xEC, 0x6A,
-    0x1B, 0x60, 0x6D, 0x67, 0x2A, 0x42, 0x4B, 0xDF, 0xCE, 0x94, 0x68, 0x13, 0x7F, 0xF5, 0x33, 0x9C,
-    0x52, 0x64, 0x76, 0x46, 0x91, 0xD9, 0xBA, 0x92, 0x6B, 0x4B, 0xC9, 0xA5, 0x1D, 0x89, 0x51, 0x58,
-    0x9E, 0xE8, 0xDB, 0xC2, 0xCC, 0xF0, 0xB2, 0xB0, 0xB3, 0x21, 0xE9, 0x8E, 0xDC, 0xEE, 0x9E, 0x2D,
-    0x2D, 0x64, 0x13, 0xC3, 0x69, 0x9A, 0x0E, 0x49, 0x26, 0x17, 0xA7, 0x36, 0xCA, 0x90, 0x42, 0x57,
-    0x4C, 0xB3, 0xE6, 0xEC, 0x26, 0xDD, 0x9E, 0x24, 0x4F, 0xD2, 0xFB, 0x3B, 0xE3, 0x8B, 0x7D, 0x02,
-    0x4E, 0xEA, 0xE4, 0xB4, 0xE3, 0xA7, 0x3B, 0xED, 0xF8, 0x39, 0x47, 0x8C, 0x91, 0xC9, 0x1B, 0x05,
-    0xEB, 0x60, 0x33, 0x76, 0xFC, 0x64, 0xA8, 0x24, 0xE0, 0x54, 0x38, 0xA1, 0xDF, 0xE7, 0x7C, 0xBA,
-    0x39, 0x7B, 0x65, 0xA3, 0xE7, 0x70, 0x26, 0xCC, 0x64, 0xDF, 0x6F, 0xF0, 0xE2, 0xC4, 0xBD, 0xB0,
-    0xBE, 0xAC, 0x92, 0xB7, 0xEF, 0xE6, 0xAB, 0x86, 0x18, 0xF6, 0x87, 0x2F, 0xA8, 0xA1, 0xE6, 0xD1,
-    0x92, 0xF3, 0x47, 0x17, 0xEF, 0x10, 0x89, 0xCF, 0xAD, 0x67, 0x6D, 0x31, 0x75, 0xEF, 0x5A, 0xFE,
-    0x37, 0xE9, 0x5D, 0x25, 0x8F, 0xD5, 0xD5, 0xEF, 0x3A, 0xB8, 0x91, 0x1C, 0x0C, 0x6E, 0x40, 0x84,
-    0xB2, 0x31, 0x33, 0x0F, 0x0E, 0xDA, 0x42, 0xB8, 0xAB, 0x3D, 0xCE, 0x65, 0xF1, 0x2E, 0x29, 0x3C,
-    0xE5, 0xC7, 0x11, 0xB4, 0x7F, 0x1D, 0xFD, 0xBD, 0x29, 0x10, 0x7E, 0x9E, 0x2B, 0xD0, 0xFE, 0x8C,
-    0x2B, 0x30, 0xBC, 0xF5, 0xA7, 0xCB, 0x6C, 0x14, 0x63, 0xA8, 0x35, 0xC9, 0x56, 0xAD, 0xC6, 0x35,
-    0x7B, 0xBE, 0xB4, 0x5A, 0x2B, 0x34, 0xA4, 0xEB, 0xC2, 0x57, 0xFE, 0xFE, 0x86, 0x95, 0x6E, 0x8C,
-    0xC1, 0xA4, 0x72, 0xD8, 0x99, 0xC1, 0x44, 0x12, 0x7D, 0x08, 0xCC, 0x45, 0x1B, 0x33, 0xB5, 0x2D,
-    0xCC, 0xE2, 0x15, 0xF3, 0x70, 0x6B, 0x25, 0x21, 0xFA, 0xFA, 0xC4, 0x51, 0xF2, 0xAE, 0xCC, 0xC5,
-    0x60, 0x69, 0x2E, 0xEE, 0xEE, 0x33, 0x17, 0x95, 0x81, 0x71, 0xB8, 0xD6, 0x25, 0xDA, 0x76, 0x43,
-    0x3B, 0x57, 0xD4, 0x03, 0x48, 0x24, 0x34, 0x62, 0x8D, 0x91, 0x3F, 0xAE, 0xBC, 0x7D, 0x31, 0x57,
-    0x3D, 0xBC, 0x98, 0xEB, 0x8A, 0x26, 0xED, 0x46, 0xAD, 0xCD, 0xB0, 0x4E, 0x6B, 0xFB, 0x62, 0xAE,
-    0x9F, 0xD6, 0xDA, 0xBF, 0xD3, 0xF9, 0x01, 0x84, 0xDB, 0x37, 0xC5, 0x2C, 0xFC, 0x56, 0xA5, 0x17,
-    0x3E, 0x3C, 0x34, 0x78, 0x43, 0x57, 0xC0, 0x16, 0xF2, 0x9F, 0x9F, 0x9B, 0x33, 0xCC, 0x3C, 0xF9,
-    0xCC, 0xDC, 0x6C, 0xC1, 0x57, 0x11, 0x40, 0xE1, 0x46, 0x7A, 0xE1, 0xB0, 0x9E, 0xE8, 0x94, 0xD3,
-    0xA2, 0xB9, 0x04, 0x98, 0xAE, 0xF5, 0xD1, 0x2D, 0x5D, 0x64, 0x63, 0x1B, 0xD0, 0x73, 0xB8, 0x6E,
-    0x16, 0x67, 0x28, 0x06, 0xE4, 0x62, 0x8B, 0x93, 0xDB, 0x82, 0x3B, 0xAD, 0x65, 0xED, 0x73, 0x5A,
-    0x71, 0xA6, 0x08, 0x3E, 0x71, 0xB6, 0xB5, 0xF6, 0x7A, 0x37, 0x27, 0x16, 0x40, 0x03, 0xDD, 0x15,
-    0xE1, 0xF0, 0xE2, 0xDC, 0x04, 0x1F, 0xBA, 0x07, 0x72, 0x80, 0xC6, 0x1C, 0xA8, 0xB1, 0xC6, 0x6F,
-    0x48, 0xFD, 0x1D, 0x4A, 0xB4, 0x35, 0x93, 0xD6, 0xED, 0xD5, 0xA1, 0x83, 0xFE, 0xCB, 0xCC, 0x2F,
-    0x47, 0xAB, 0x7F, 0x3A, 0x76, 0x6A, 0x4D, 0xE0, 0x8F, 0x6B, 0x75, 0xF6, 0xFF, 0x41, 0xAD, 0xEF,
-    0x48, 0xFD, 0x1F, 0xB5, 0x79, 0x13, 0x5F, 0xFC, 0xC9, 0xDC, 0xF9, 0x1E, 0xD2, 0x82, 0xFF, 0x72,
-    0x8E, 0x57, 0x95, 0x19, 0xEF, 0x1B, 0x4D, 0x40, 0x9D, 0xF0, 0x72, 0x4B, 0x1F, 0x96, 0x9F, 0xB4,
-    0x97, 0x08, 0x79, 0x4D, 0x5B, 0xE3, 0x7C, 0x46, 0x88, 0x2C, 0x4B, 0x2C, 0x5A, 0x21, 0xC7, 0x52,
-    0x77, 0x73, 0xF6, 0xF6, 0x4F, 0x7A, 0xA0, 0xAB, 0xA0, 0x2F, 0x52, 0xE4, 0x9F, 0x7A, 0x43, 0x24,
-    0xF8, 0x05, 0xB3, 0x5A, 0x1E, 0xB6, 0x3F, 0x6B, 0x79, 0xBE, 0x9A, 0xB5, 0xCC, 0xEE, 0x97, 0x3F,
-    0x1F, 0x18, 0xCE, 0xD6, 0x56, 0x72, 0x7F, 0x30, 0xF4, 0x82, 0x5B, 0xD7, 0x6E, 0x85, 0xDB, 0x07,
-    0xEB, 0x11, 0xE6, 0x4B, 0x6B, 0x5C, 0xBD, 0x88, 0x81, 0xBE, 0x90, 0x6E, 0xFA, 0xA6, 0x59, 0x36,
-    0xE0, 0xB7, 0x6F, 0x9A, 0xDD, 0x25, 0x40, 0xA0, 0x73, 0x8D, 0xC3, 0x38, 0xC7, 0x01, 0x6D, 0x2D,
-    0xDF, 0x34, 0xEB, 0xEE, 0x5D, 0xCD, 0x33, 0xFB, 0xA6, 0x6A, 0xBC, 0x69, 0xB6, 0x40, 0x88, 0x5C,
-    0xDF, 0x34, 0x1B, 0xE8, 0x9B, 0x66, 0x4B, 0x33, 0xBE, 0x69, 0x36, 0x58, 0x7D, 0xD3, 0x2C, 0x45,
-    0x9B, 0x39, 0x86, 0x12, 0x98, 0x93, 0x98, 0xF5, 0x4D, 0x9B, 0x6F, 0xE0, 0xEE, 0xED, 0x2B, 0x80,
-    0xE8, 0xFF, 0x52, 0xC0, 0xD2, 0x77, 0xFA, 0x4C, 0x3B, 0xE5, 0x34, 0x43, 0x22, 0x77, 0x80, 0xAA,
-    0xB7, 0x10, 0xEF, 0x27, 0x88, 0xF4, 0xFD, 0x03, 0x4C, 0xE6, 0xD3, 0xFE, 0xD3, 0x8D, 0xE6, 0xEC,
-    0xE5, 0xEA, 0x35, 0x38, 0x81, 0xC3, 0xAF, 0x21, 0xCC, 0xF0, 0xFD, 0xFA, 0xF1, 0xA8, 0xFF, 0x7C,
-    0x5F, 0xFB, 0x0B, 0xF8, 0x7E, 0x37, 0xB4, 0x1C, 0xEE, 0x0C, 0xC1, 0x68, 0xAC, 0xE2, 0x9C, 0xC7,
-    0x33, 0x6E, 0x75, 0x78, 0x41, 0xC7, 0x23, 0x45, 0x40, 0x34, 0xAF, 0x64, 0xE7, 0x4A, 0x39, 0xB0,
-    0xA5, 0xCD, 0xCD, 0x03, 0x03, 0x7E, 0xDF, 0x69, 0x37, 0xF4, 0x30, 0x41, 0xEB, 0x3F, 0xBD, 0x30,
-    0xEB, 0xD6, 0x5A, 0x33, 0xFF, 0xB3, 0xB5, 0x52, 0xE0, 0x47, 0xF6, 0x42, 0x76, 0xA4, 0xFA, 0x8C,
-    0x21, 0x9F, 0x74, 0x3B, 0x0D, 0x91, 0x9B, 0x75, 0x2B, 0xF7, 0xCD, 0xDC, 0x1F, 0x50, 0xA2, 0xBE,
-    0x99, 0x55, 0xB4, 0x91, 0xBE, 0xBA, 0x03, 0x48, 0xEE, 0x3B, 0xFC, 0x97, 0x73, 0x83, 0x06, 0xD8,
-    0xBD, 0xAA, 0x7E, 0xD9, 0xA1, 0x4A, 0x6E, 0x7C, 0x87, 0x2D, 0xB2, 0x2C, 0xE3, 0x21, 0x63, 0x23,
-    0x25, 0xAE, 0x5B, 0xA7, 0x46, 0x3A, 0x3D, 0x40, 0x9D, 0x75, 0x68, 0x57, 0x78, 0x57, 0x1B, 0x23,
-    0x34, 0x3D, 0xD1, 0x5D, 0xBD, 0x36, 0x37, 0xFA, 0x66, 0x94, 0xC9, 0xD6, 0x12, 0x93, 0x14, 0xE5,
-    0x49, 0xF1, 0x57, 0xEE, 0x2D, 0x52, 0xD0, 0x2A, 0xAE, 0x65, 0x1D, 0xF0, 0x3A, 0x09, 0xF4, 0x7C,
-    0x65, 0x2A, 0x8E, 0x7D, 0x11, 0x06, 0xB3, 0xF3, 0x59, 0x97, 0x89, 0x6E, 0x23, 0x71, 0xE2, 0x2C,
-    0x5E, 0x64, 0x02, 0x23, 0xDF, 0x5E, 0x63, 0xBC, 0x7B, 0xC9, 0x98, 0xD2, 0xA4, 0x2F, 0xB7, 0xC1,
-    0x0A, 0xA8, 0x4B, 0xFA, 0x64, 0x6B, 0x3E, 0x2A, 0x9A, 0xEC, 0x62, 0x0F, 0xB0, 0xDD, 0x57, 0xF0,
-    0xF1, 0xCF, 0xE0, 0x12, 0x28, 0x59, 0xAA, 0xF9, 0xC4, 0xA4, 0x8C, 0xF6, 0x18, 0xC1, 0xF2, 0x71,
-    0x7A, 0x2D, 0xB6, 0x8C, 0x7D, 0x91, 0xE3, 0x32, 0x63, 0x70, 0x52, 0x2B, 0xB2, 0x7C, 0x31, 0xAE,
-    0xA3, 0x4B, 0xC1, 0xD8, 0x8E, 0xC3, 0x45, 0x38, 0xF8, 0x62, 0xDC, 0xD9, 0xEA, 0x8B, 0x71, 0x93,
-    0xC3, 0x5E, 0x8C, 0xFB, 0x80, 0x14, 0xF3, 0x5F, 0x38, 0xEC, 0xC5, 0xB8, 0x42, 0xCE, 0xF1, 0xC5,
-    0xB8, 0xF2, 0xF3, 0x4F, 0xCD, 0x2F, 0x0A, 0x8A, 0xF8, 0x94, 0x49, 0x9F, 0xAD, 0x58, 0x23, 0xE6,
-    0x37, 0xD3, 0x02, 0x61, 0x74, 0xB5, 0xB5, 0x6D, 0x56, 0x11, 0x4D, 0xAF, 0xD9, 0x78, 0x7B, 0x1E,
-    0xD9, 0xF8, 0x79, 0xFC, 0x95, 0x8E, 0xAF, 0x7B, 0xCC, 0x37, 0xDE, 0x26, 0x42, 0x7B, 0x74, 0xC2,
-    0xF4, 0x36, 0x72, 0x8E, 0x0A, 0x58, 0xF8, 0x16, 0x65, 0xCD, 0xE1, 0x8A, 0xCD, 0x86, 0xD8, 0x6B,
-    0x3F, 0xC9, 0x18, 0x4F, 0xCD, 0x21, 0xF5, 0x82, 0xCE, 0x26, 0x5C, 0x40, 0x9B, 0xFD, 0xD5, 0x9E,
-    0xC1, 0x9B, 0x0E, 0x61, 0x65, 0xA1, 0xA5, 0x20, 0x0E, 0x84, 0xFD, 0x19, 0xF0, 0xD6, 0x97, 0x4D,
-    0xEA, 0xFB, 0x07, 0xBB, 0x21, 0x47, 0x1B, 0xD6, 0x0F, 0x0A, 0x44, 0x4D, 0xF4, 0x7F, 0x73, 0xA4,
-    0x0E, 0x68, 0x37, 0xCC, 0xE5, 0xC8, 0xD0, 0x16, 0x58, 0x86, 0xE5, 0x95, 0x61, 0xED, 0x0D, 0x09,
-    0x11, 0x9A, 0xE3, 0xC6, 0x36, 0x47, 0x22, 0xDB, 0x5B, 0xD3, 0xFF, 0x71, 0x33, 0x9B, 0x7B, 0xF3,
-    0xB0, 0xD4, 0x77, 0x8C, 0xA0, 0x75, 0x71, 0xCA, 0x86, 0x21, 0xB2, 0x83, 0xFF, 0x0A, 0x6F, 0x2B,
-    0xC8, 0x6C, 0x1A, 0xC0, 0x27, 0xB9, 0xA7, 0x76, 0x15, 0x75, 0xF2, 0x78, 0xC9, 0x3B, 0xB4, 0x6A,
-    0xED, 0xD1, 0xA4, 0x87, 0x8F, 0xAE, 0x27, 0x2F, 0xB7, 0xFC, 0x0D, 0xCD, 0x6A, 0xC3, 0x89, 0x87,
-    0x4A, 0x27, 0xE0, 0xED, 0x4F, 0x0E, 0x18, 0xA4, 0xDC, 0x1D, 0xAF, 0x86, 0x9D, 0xE3, 0x67, 0x97,
-    0xDE, 0xBE, 0x66, 0xEC, 0x1F, 0x9F, 0x8F, 0x6A, 0x96, 0x9D, 0xB1, 0x84, 0xCA, 0x57, 0x48, 0x37,
-    0x1B, 0xF2, 0xEE, 0x0F, 0xF9, 0x79, 0x84, 0x5F, 0xEB, 0x72, 0xC5, 0x47, 0xEF, 0x40, 0xC4, 0x17,
-    0x70, 0x70, 0xEA, 0x20, 0x39, 0xB8, 0x4D, 0x3E, 0xC0, 0x97, 0x59, 0x9F, 0x12, 0xBB, 0x24, 0xFE,
-    0x74, 0xC3, 0xDF, 0x35, 0xA7, 0xDE, 0x27, 0xD1, 0x1F, 0xDA, 0xEB, 0x68, 0xB4, 0x02, 0x00, 0x6F,
-    0xA1, 0x82, 0x3C, 0x40, 0x86, 0xB3, 0x88, 0x8C, 0xB3, 0x60, 0xDF, 0xC7, 0x69, 0x7D, 0xF2, 0xC9,
-    0x04, 0x91, 0x6B, 0x83, 0x0F, 0x84, 0xDA, 0x8B, 0x2D, 0x28, 0x9C, 0xE7, 0x7B, 0x33, 0xC4, 0x55,
-    0xC2, 0x62, 0xA0, 0x43, 0x80, 0x24, 0xFB, 0x00, 0xAF, 0xFA, 0x0A, 0xC1, 0x9E, 0x9A, 0x64, 0x9F,
-    0xA4, 0x70, 0x77, 0x85, 0x48, 0xB2, 0xB7, 0x93, 0xDC, 0xD0, 0xA2, 0x9E, 0x56, 0x3D, 0x7A, 0x01,
-    0xB4, 0xD3, 0x29, 0x3C, 0xE9, 0x34, 0x54, 0xF4, 0x13, 0xFB, 0x1E, 0x1E, 0x0E, 0xD6, 0x30, 0x5B,
-    0xCD, 0xD3, 0x9B, 0x68, 0x4E, 0xB4, 0x63, 0x84, 0x29, 0x1D, 0xF5, 0xD0, 0xA4, 0xF8, 0x8A, 0xCC,
-    0x94, 0xFC, 0x12, 0xFE, 0xFA, 0x92, 0x61, 0x8F, 0x3C, 0xC0, 0x99, 0x0C, 0xEF, 0xD3, 0xDA, 0x13,
-    0x88, 0xE5, 0xF6, 0xCD, 0xBE, 0x86, 0x36, 0xAD, 0x3D, 0x37, 0x87, 0x36, 0x66, 0xF9, 0xB0, 0xBF,
-    0x5B, 0x5C, 0x7B, 0x5F, 0x18, 0xED, 0xFF, 0xFE, 0xBE, 0x16, 0x49, 0xA2, 0xDB, 0xAE, 0x10, 0xD8,
-    0xBE, 0xDB, 0xEB, 0xB8, 0x15, 0xE5, 0x10, 0xEB, 0x7C, 0xE2, 0x1F, 0xB6, 0x16, 0x88, 0xCD, 0x1F,
-    0x20, 0x5E, 0x3F, 0xEC, 0xF4, 0x76, 0x4B, 0xBA, 0x7D, 0x19, 0xAC, 0x04, 0xAA, 0x2F, 0xD7, 0xF6,
-    0xCF, 0xF0, 0x7D, 0xA7, 0xBC, 0xCA, 0x6B, 0x95, 0xD6, 0x2A, 0xAB, 0xEF, 0x27, 0xA9, 0xDF, 0x53,
-    0x6F, 0x30, 0x38, 0x1C, 0x1A, 0xBE, 0x3E, 0xBB, 0x81, 0xC2, 0x99, 0xCD, 0xE9, 0x4C, 0x9B, 0xEB,
-    0x4B, 0xEA, 0x1E, 0x42, 0x6F, 0xB0, 0x59, 0x76, 0xD6, 0xE8, 0x7B, 0x09, 0x28, 0xE0, 0xFD, 0x6C,
-    0xEB, 0x10, 0x1D, 0x5C, 0x1D, 0xE8, 0x1C, 0x56, 0x59, 0x17, 0x8D, 0xED, 0x1C, 0x96, 0xE1, 0x90,
-    0x0C, 0xAF, 0x3B, 0x63, 0x7D, 0xEC, 0xFE, 0xCE, 0x61, 0xCC, 0x2C, 0x2A, 0x0E, 0x76, 0x0E, 0x7B,
-    0x08, 0xD4, 0xF9, 0xCE, 0x85, 0x0B, 0xBF, 0xD9, 0x30, 0xF1, 0x75, 0x1E, 0xDF, 0xBD, 0x2A, 0x26,
-    0xC5, 0x43, 0xA3, 0xCE, 0xBB, 0x9A, 0x3F, 0xAC, 0xA1, 0xF4, 0xEA, 0xD5, 0xFC, 0xDD, 0xCE, 0xFF,
-    0xE7, 0xC2, 0x41, 0xEF, 0x1F, 0x8D, 0x1E, 0x22, 0x07, 0xBD, 0x57, 0x0A, 0xBE, 0x3D, 0xC8, 0xF8,
-    0x40, 0xDF, 0xB7, 0xF9, 0x40, 0x90, 0xF1, 0xD0, 0xDF, 0x58, 0x62, 0xD4, 0x94, 0x1E, 0x1B, 0x00,
-    0x8C, 0x8A, 0xF7, 0x11, 0x7D, 0xF3, 0xF7, 0x30, 0xE8, 0xEA, 0x90, 0x41, 0xFB, 0x0B, 0x66, 0xAB,
-    0xD3, 0xF0, 0xB1, 0x36, 0x7C, 0x4A, 0x6F, 0xA5, 0xB6, 0x66, 0x8D, 0x32, 0x50, 0x53, 0xA4, 0xBA,
-    0xBA, 0x6A, 0xE0, 0xCC, 0x63, 0x15, 0xEB, 0xAC, 0xF6, 0x59, 0x9B, 0x15, 0x18, 0xAD, 0x91, 0x05,
-    0xF5, 0xD6, 0xE9, 0x34, 0xA6, 0x92, 0x5C, 0x54, 0xCB, 0xDC, 0xB2, 0x74, 0x62, 0x56, 0xAB, 0x3D,
-    0x32, 0x5F, 0x86, 0x9E, 0x82, 0x62, 0x84, 0x3D, 0xCC, 0xB8, 0x8C, 0x39, 0xC8, 0xA1, 0x0B, 0xDA,
-    0x3B, 0x35, 0x04, 0x1F, 0x55, 0xCA, 0x3B, 0x15, 0xE2, 0xBF, 0xDA, 0x0E, 0x0B, 0x6F, 0xEF, 0x61,
-    0x76, 0xD3, 0x7D, 0xDA, 0xB7, 0x3C, 0xBA, 0xAB, 0x60, 0xBE, 0xF6, 0x58, 0x66, 0xB4, 0x8B, 0x99,
-    0x00, 0xF3, 0x6D, 0x7A, 0x6B, 0x40, 0x89, 0x73, 0xA4, 0xC1, 0x75, 0xFF, 0xC3, 0xB1, 0x16, 0xC6,
-    0xBD, 0xF2, 0xB4, 0xC6, 0x5F, 0x68, 0xCB, 0x68, 0x07, 0x45, 0x73, 0x5E, 0x09, 0x30, 0xA7, 0x3C,
-    0x73, 0xCA, 0x93, 0xF7, 0x59, 0x99, 0x61, 0x69, 0x96, 0x5E, 0x2E, 0x47, 0x5F, 0xBB, 0x4E, 0xBF,
-    0xA9, 0x2E, 0x8F, 0x5D, 0x1F, 0xBB, 0x40, 0x76, 0x85, 0xEC, 0x12, 0xD9, 0x35, 0xB2, 0x8B, 0x64,
-    0x57, 0x69, 0x58, 0x26, 0xBB, 0x4E, 0x43, 0x2A, 0xA6, 0xAE, 0xD4, 0x10, 0xE9, 0xB1, 0x16, 0xFC,
-    0x7C, 0xDA, 0xDC, 0xC6, 0x46, 0x8B, 0xD4, 0x89, 0xA1, 0x89, 0xCA, 0xBA, 0x62, 0xCB, 0x25, 0x3B,
-    0x3D, 0xD9, 0x39, 0xBB, 0x0F, 0xD8, 0x39, 0x8F, 0xDC, 0x1B, 0xDC, 0xA7, 0xAE, 0xDF, 0xC5, 0xA1,
-    0xAE, 0xDF, 0xF7, 0xF9, 0x25, 0x6A, 0x0F, 0xA3, 0x13, 0xC2, 0x43, 0xED, 0x64, 0xE1, 0x4F, 0xFA,
-    0xE4, 0xDA, 0x44, 0x83, 0x7A, 0x92, 0x11, 0x5D, 0x8E, 0x75, 0xC8, 0x6F, 0xDB, 0xFD, 0xE0, 0xB0,
-    0x57, 0xE2, 0x94, 0xCB, 0x10, 0x4D, 0xB0, 0x67, 0x1B, 0x31, 0xF9, 0x36, 0x8E, 0x77, 0xCA, 0x86,
-    0x83, 0x76, 0xF4, 0xF1, 0xA0, 0xC7, 0x6F, 0x59, 0xBD, 0x7F, 0xDD, 0x56, 0xFB, 0xBB, 0xB6, 0xE5,
-    0xDF, 0xF2, 0xC2, 0xA9, 0xFD, 0xE4, 0xC1, 0x1E, 0xA7, 0x7F, 0xA8, 0xAF, 0x3B, 0x57, 0xDE, 0x55,
-    0x8C, 0xA6, 0xDC, 0x2B, 0xFF, 0x72, 0xF3, 0xB0, 0x4D, 0xF7, 0x73, 0x7F, 0x0D, 0xDC, 0xA3, 0xD6,
-    0xB6, 0x64, 0xB5, 0x66, 0x87, 0x4F, 0xD1, 0x56, 0x17, 0x8A, 0x4E, 0x34, 0x9D, 0xE0, 0x97, 0xCD,
-    0xCF, 0xDA, 0xE0, 0x64, 0xCA, 0xD4, 0xC1, 0x2A, 0x53, 0x23, 0x16, 0x1D, 0xCD, 0x6D, 0x17, 0xCF,
-    0x47, 0xB3, 0x46, 0xA2, 0xB3, 0x35, 0x12, 0x5F, 0x9A, 0xD6, 0x48, 0x0C, 0xFE, 0xE4, 0xEB, 0xD3,
-    0xC4, 0xA3, 0x4F, 0x57, 0x8A, 0xC0, 0x6D, 0xCC, 0x48, 0xDD, 0x24, 0x9F, 0x33, 0xEF, 0x5F, 0x8D,
-    0x44, 0xB9, 0x52, 0x23, 0x81, 0x83, 0xE3, 0x67, 0x36, 0x55, 0x9C, 0x05, 0x5A, 0xCE, 0x95, 0x77,
-    0x49, 0xD5, 0xF3, 0x87, 0x51, 0x15, 0x37, 0x3F, 0xFA, 0x7C, 0x7F, 0x61, 0x63, 0x08, 0xFE, 0x98,
-    0x27, 0xF5, 0xFF, 0x46, 0xAA, 0xC6, 0xEF, 0x99, 0xAA, 0x97, 0x95, 0xAA, 0x35, 0x89, 0xB4, 0x78,
-    0x30, 0x91, 0x9C, 0xAB, 0xFD, 0xDD, 0x2B, 0x56, 0xB9, 0xBD, 0x0D, 0x91, 0x9A, 0x49, 0x21, 0xC9,
-    0xFF, 0x07, 0xDD, 0x9B, 0xBF, 0x6F, 0x1C, 0xD7, 0x11, 0xC7, 0x67, 0x77, 0x49, 0xAE, 0xA1, 0x43,
-    0xB4, 0x34, 0xA0, 0x00, 0x86, 0x65, 0xEB, 0x1A, 0x17, 0x86, 0x6D, 0x69, 0x9B, 0x20, 0x51, 0x41,
-    0x79, 0xD7, 0x72, 0xE9, 0x86, 0x85, 0x52, 0xBB, 0x0E, 0x90, 0x58, 0x29, 0x5C, 0x28, 0x80, 0xE3,
-    0x5B, 0xDB, 0x7F, 0x40, 0x58, 0x25, 0x40, 0x52, 0x44, 0x45, 0x8A, 0xC4, 0x29, 0xEC, 0x42, 0x85,
-    0x0C, 0xC8, 0xBC, 0x15, 0x54, 0xA6, 0x39, 0x0B, 0x08, 0x5C, 0xA4, 0x39, 0x39, 0xFE, 0x01, 0x44,
-    0x40, 0xBC, 0x09, 0x4E, 0x08, 0xE5, 0xDC, 0xDD, 0x66, 0xBE, 0xDF, 0x99, 0xBD, 0x5D, 0x52, 0x72,
-    0x82, 0x04, 0x16, 0xEF, 0x2E, 0x0B, 0x72, 0x48, 0x1E, 0xF7, 0xF6, 0xBD, 0xF7, 0xF9, 0xCE, 0x9B,
-    0x37, 0xEF, 0xC7, 0x89, 0x48, 0x30, 0x11, 0xBD, 0xA2, 0x03, 0xD8, 0x1E, 0x6D, 0x32, 0x85, 0xBD,
-    0x40, 0x7B, 0x85, 0xB6, 0x9A, 0xA9, 0x09, 0xC7, 0xB0, 0x51, 0xB9, 0x8F, 0x1B, 0xF3, 0xA1, 0xDA,
-    0xBE, 0x0C, 0x70, 0xA3, 0x64, 0xB8, 0x91, 0xB6, 0x92, 0x2C, 0x97, 0xF0, 0xAB, 0x77, 0x87, 0x85,
-    0x44, 0x75, 0x5D, 0x17, 0x92, 0xE4, 0x92, 0x96, 0x7A, 0xA3, 0xF4, 0x4B, 0xD9, 0xD1, 0x47, 0x97,
-    0x72, 0x5D, 0xED, 0x48, 0x6F, 0x54, 0x1B, 0xC1, 0x8E, 0x5F, 0xBD, 0x2F, 0xC1, 0xF0, 0x7E, 0x5D,
-    0xE7, 0x71, 0x3D, 0x17, 0xBF, 0x02, 0x5A, 0x7D, 0x8F, 0x5E, 0x69, 0xC7, 0x9E, 0xC8, 0x9B, 0x3B,
-    0xC2, 0xFA, 0x76, 0x21, 0xE9, 0x1F, 0xB5, 0x88, 0x7D, 0x2D, 0x33, 0x3C, 0xD0, 0xE2, 0xE3, 0x4A,
-    0xEB, 0xA3, 0xCF, 0xDE, 0xC7, 0x1B, 0x67, 0x92, 0x16, 0x32, 0x45, 0x75, 0xA6, 0xFA, 0x6A, 0x00,
-    0xA3, 0x6D, 0x1C, 0x4A, 0x34, 0x51, 0xD3, 0xC3, 0x9D, 0xA7, 0x61, 0xBE, 0xA7, 0x35, 0x7E, 0xEB,
-    0xCF, 0xD5, 0x76, 0x5A, 0xBF, 0x53, 0x57, 0xBD, 0x59, 0x58, 0xE7, 0xB2, 0x2B, 0xDB, 0x22, 0x1B,
-    0x28, 0x23, 0x43, 0x69, 0x83, 0x02, 0x06, 0xBF, 0x9D, 0xF3, 0xA2, 0xF7, 0xF1, 0x47, 0x54, 0x8F,
-    0x61, 0x2F, 0x56, 0xAC, 0x0C, 0xED, 0xE9, 0x11, 0xFF, 0xCB, 0x7B, 0xF8, 0x82, 0x8C, 0x65, 0x71,
-    0xAD, 0x18, 0xE6, 0x00, 0x6D, 0xC8, 0x50, 0x8F, 0x0F, 0x3E, 0x54, 0x93, 0x5F, 0x40, 0xF9, 0x6F,
-    0xA0, 0x56, 0x13, 0x96, 0xA8, 0xD7, 0xD3, 0x30, 0x1B, 0xC7, 0xC4, 0x9B, 0xD7, 0x6F, 0xAD, 0x24,
-    0x92, 0xBA, 0x14, 0x43, 0xF0, 0xA0, 0x3E, 0x83, 0x3F, 0xE2, 0x9A, 0xBA, 0xF7, 0x5F, 0xA1, 0x13,
-    0x5C, 0x0F, 0xC8, 0x35, 0x97, 0xEE, 0x65, 0x7C, 0x1D, 0xB0, 0x13, 0x76, 0xC4, 0xCE, 0xD8, 0x21,
-    0x1B, 0x65, 0xC7, 0xEC, 0x9C, 0x1D, 0xB4, 0x93, 0x76, 0xD4, 0xCE, 0xDA, 0x60, 0x3B, 0x6D, 0xC7,
-    0xED, 0xBC, 0x1D, 0xB8, 0x13, 0x77, 0xE4, 0xC6, 0x5C, 0x0C, 0xBA, 0x18, 0x75, 0x39, 0xEC, 0xDD,
-    0x70, 0x67, 0xD6, 0xFE, 0xA7, 0x28, 0xF3, 0x26, 0x7C, 0x65, 0xF0, 0x89, 0xBE, 0x10, 0xDC, 0xC7,
-    0xAF, 0xF1, 0x08, 0x3A, 0x9C, 0x34, 0xFE, 0x9D, 0x8B, 0x0A, 0x98, 0x04, 0xD4, 0x40, 0x28, 0x82,
-    0xA9, 0x60, 0x32, 0x98, 0x0E, 0x26, 0x84, 0x29, 0x61, 0x52, 0x98, 0x16, 0x26, 0x86, 0xA9, 0x61,
-    0x72, 0x98, 0x1E, 0x26, 0x88, 0x50, 0x11, 0x31, 0x49, 0x1A, 0x4D, 0x9E, 0x34, 0x8A, 0xB9, 0x91,
-    0xBA, 0x04, 0xCC, 0x77, 0xEA, 0x56, 0x10, 0xD3, 0xC3, 0xE4, 0xC8, 0x65, 0x65, 0x7D, 0x7D, 0xD1,
-    0x41, 0x59, 0xAD, 0x1D, 0x28, 0xF6, 0xD8, 0x60, 0xEC, 0xB8, 0x49, 0xFB, 0x08, 0xEC, 0xE3, 0xF0,
-    0x75, 0xBB, 0x32, 0x3A, 0xB4, 0x3C, 0x6E, 0x81, 0x22, 0x60, 0x00, 0xB9, 0xD4, 0x2F, 0xE8, 0xF9,
-    0x4F, 0xFD, 0x9F, 0x79, 0x7E, 0x78, 0x15, 0xC5, 0xDD, 0xC0, 0xAF, 0x2F, 0x78, 0xB4, 0xE9, 0xDF,
-    0xD2, 0x77, 0x0D, 0xEE, 0x2C, 0x53, 0x8A, 0x70, 0x72, 0x02, 0xB8, 0xEA, 0x1F, 0xA9, 0x3D, 0x3B,
-    0x00, 0xBC, 0x67, 0xB6, 0xF6, 0x28, 0x03, 0xD9, 0xAE, 0x9F, 0xB7, 0x9F, 0x42, 0xE5, 0xEA, 0xB7,
-    0x4A, 0x89, 0xBE, 0xD4, 0xB7, 0xC7, 0xC1, 0x22, 0xEA, 0x70, 0x34, 0x5D, 0xB2, 0xDF, 0xFF, 0xE0,
-    0x28, 0xD4, 0xE4, 0x67, 0xA8, 0xD5, 0x85, 0x08, 0x9E, 0x7F, 0x55, 0xAE, 0x1E, 0x09, 0x79, 0x6B,
-    0x98, 0x9B, 0x9C, 0x40, 0xE7, 0x4D, 0xE1, 0x23, 0xC3, 0x0A, 0xDE, 0xA5, 0x2D, 0x88, 0xCB, 0x63,
-    0x47, 0xCD, 0x3A, 0xA2, 0x67, 0x5A, 0xDD, 0x68, 0x7A, 0xEE, 0xB4, 0xC1, 0x6F, 0x08, 0x75, 0xDC,
-    0x86, 0xF6, 0x1D, 0x33, 0xAF, 0x23, 0xC7, 0x09, 0x2A, 0x76, 0x87, 0x92, 0x0A, 0xF1, 0xFE, 0xED,
-    0x15, 0xD7, 0x83, 0xA1, 0xEA, 0x06, 0x0B, 0xD5, 0xEF, 0x8B, 0x17, 0x51, 0x6E, 0x82, 0xB0, 0x85,
-    0xC4, 0xA6, 0x46, 0x2D, 0xD3, 0xE2, 0x58, 0xBD, 0x7C, 0xAB, 0x68, 0x01, 0x7B, 0x22, 0x78, 0x7E,
-    0x9D, 0x09, 0x23, 0x1D, 0xB1, 0xE4, 0x17, 0x2E, 0xB4, 0x0A, 0x84, 0xE5, 0x35, 0xDA, 0xBB, 0xA5,
-    0x0D, 0x64, 0x4C, 0xBE, 0xF3, 0x96, 0xF3, 0xF6, 0xFA, 0x71, 0xCE, 0x9B, 0xD4, 0x7B, 0x63, 0xA7,
-    0x69, 0x07, 0x1C, 0x28, 0x7C, 0x39, 0x5C, 0x3A, 0xEC, 0x43, 0x23, 0xE4, 0xE5, 0xCE, 0x08, 0x29,
-    0x6B, 0xEA, 0xD4, 0xA7, 0xB4, 0x65, 0x32, 0x2C, 0x47, 0x12, 0x7E, 0xA9, 0x15, 0x8E, 0x5E, 0xAA,
-    0x1B, 0x92, 0xF9, 0xF2, 0x61, 0x3F, 0x23, 0xDF, 0x21, 0x54, 0xE0, 0xEC, 0xFF, 0x7E, 0x4C, 0xA8,
-    0x4C, 0x07, 0x3F, 0x90, 0x75, 0x18, 0x1B, 0x3D, 0xD3, 0x28, 0xDA, 0xDC, 0xD6, 0x6C, 0xBF, 0x4D,
-    0x98, 0x62, 0x51, 0x77, 0x8A, 0x73, 0x9D, 0xD7, 0x45, 0x7F, 0x99, 0x22, 0x19, 0x40, 0x53, 0x5F,
-    0xCB, 0x8F, 0x3B, 0xFF, 0xC6, 0xD4, 0x4B, 0xEA, 0x85, 0xF9, 0xB0, 0x9D, 0x99, 0x69, 0xFB, 0x2B,
-    0x79, 0x9E, 0x36, 0x98, 0xB1, 0x17, 0x4E, 0x31, 0xB4, 0x68, 0x31, 0xA1, 0xBA, 0x8C, 0xDA, 0xD2,
-    0xA9, 0x47, 0x54, 0x20, 0xAE, 0x5A, 0xDB, 0xBB, 0xF7, 0xFD, 0x1C, 0x8A, 0x61, 0x6D, 0x20, 0xF9,
-    0x0C, 0xBF, 0x1F, 0x4A, 0x13, 0x8A, 0xC5, 0xA2, 0x82, 0x0D, 0x5A, 0x90, 0xE1, 0x5B, 0x98, 0x91,
-    0xC9, 0x59, 0x91, 0x39, 0xC7, 0xE1, 0x19, 0x4A, 0x3B, 0x3D, 0x7F, 0xF7, 0x3D, 0x6D, 0x8F, 0x56,
-    0x61, 0x72, 0x64, 0x0A, 0x58, 0xB5, 0x9A, 0xBB, 0xAD, 0x0E, 0xDF, 0xB1, 0x55, 0x8F, 0x24, 0xFD,
-    0x55, 0x25, 0xD3, 0xE8, 0x20, 0x9A, 0x84, 0xD3, 0x5E, 0x15, 0x1E, 0xA8, 0x5E, 0x93, 0xB4, 0xEC,
-    0x55, 0x59, 0x91, 0x96, 0xD9, 0xCF, 0xE7, 0x32, 0xD0, 0xDA, 0x0D, 0x77, 0x59, 0x2C, 0xBF, 0xE1,
-    0x0B, 0x59, 0x11, 0x14, 0xE9, 0xA8, 0x97, 0xF7, 0xEA, 0x5A, 0x15, 0xD1, 0x27, 0x6F, 0xB6, 0x05,
-    0xC6, 0x13, 0xFB, 0x8E, 0xDA, 0xD5, 0x8C, 0x94, 0xFD, 0x9F, 0xFD, 0x43, 0x46, 0xCC, 0xE8, 0x39,
-    0x00, 0xCB, 0xD6, 0xA4, 0x6D, 0xE7, 0x4E, 0x3B, 0xF0, 0xAD, 0x26, 0x57, 0x34, 0x51, 0x1F, 0x18,
-    0x7E, 0x3E, 0xD1, 0x74, 0x49, 0x5F, 0x40, 0x08, 0xCB, 0x46, 0x36, 0xDC, 0xBD, 0xDE, 0x06, 0xB0,
-    0x6F, 0x96, 0xE8, 0x2E, 0x1B, 0x35, 0x0F, 0x30, 0x85, 0xAA, 0x3F, 0xD6, 0x8A, 0x9F, 0x4F, 0xE0,
-    0x7F, 0xDB, 0xC1, 0xC1, 0x61, 0x1D, 0x57, 0x8D, 0x56, 0xB0, 0xCB, 0x00, 0x13, 0x15, 0xF2, 0x62,
-    0xFD, 0x6B, 0x91, 0xF7, 0x53, 0xBD, 0x65, 0x77, 0x6B, 0x7C, 0xD4, 0xF5, 0x48, 0x0A, 0xA8, 0x04,
-    0xAC, 0x04, 0xB0, 0x10, 0x2F, 0x26, 0x02, 0x5C, 0x02, 0x5E, 0x02, 0x60, 0x24, 0x46, 0x64, 0xE4,
-    0x65, 0x86, 0x13, 0x50, 0x60, 0x13, 0x70, 0x13, 0x80, 0x33, 0x72, 0x8D, 0x33, 0x7A, 0x72, 0xAD,
-    0x85, 0xC0, 0x6C, 0xE6, 0x74, 0xB9, 0xF4, 0x0E, 0x2B, 0x31, 0xB0, 0x75, 0xB8, 0x09, 0x5F, 0xEB,
-    0x15, 0x67, 0x0F, 0xAD, 0x5D, 0xB5, 0x40, 0x9D, 0x68, 0x83, 0xD4, 0x98, 0x3A, 0x54, 0xA7, 0xDA,
-    0x4C, 0xA4, 0x8D, 0xAB, 0x23, 0x6D, 0x7E, 0x18, 0x5A, 0x67, 0xEB, 0x70, 0x9D, 0xAE, 0xE3, 0x6D,
-    0x06, 0x0C, 0x03, 0xEC, 0x84, 0x1D, 0xB1, 0x33, 0x76, 0xC8, 0x46, 0xD9, 0x31, 0x3F, 0xD8, 0xDB,
-    0xB3, 0x45, 0xB7, 0x4A, 0xDF, 0xE6, 0x74, 0xE2, 0x36, 0x92, 0xAF, 0x7F, 0x54, 0x6C, 0xDF, 0x35,
-    0x8C, 0xC5, 0x36, 0x8D, 0x3E, 0xAA, 0x80, 0x49, 0x40, 0x0D, 0x4C, 0x04, 0x53, 0xC1, 0x64, 0x30,
-    0x1D, 0x4C, 0x08, 0x53, 0xC2, 0xA4, 0x30, 0x2D, 0x4C, 0x07, 0xB7, 0x03, 0x59, 0xE8, 0x61, 0x82,
-    0x98, 0x22, 0x2E, 0x89, 0x6B, 0x12, 0xD8, 0x8C, 0xCD, 0x2A, 0xBE, 0xB3, 0x89, 0x36, 0x9F, 0x49,
-    0x5B, 0x41, 0x4C, 0x0F, 0x93, 0x63, 0x43, 0x56, 0x39, 0xC4, 0x62, 0x02, 0xCA, 0x1C, 0xE6, 0x8A,
-    0x3E, 0xE2, 0x89, 0xE1, 0x88, 0xA4, 0xC1, 0xB9, 0x4B, 0xF9, 0x1B, 0x0E, 0xAE, 0x76, 0x45, 0x1C,
-    0xA9, 0x03, 0xAE, 0x73, 0x72, 0x8E, 0xB8, 0xF9, 0x12, 0xF3, 0x8E, 0x3B, 0xE5, 0xDA, 0x51, 0x64,
-    0x5A, 0x78, 0xF2, 0xA0, 0x89, 0xFE, 0x81, 0x7A, 0x69, 0xFA, 0x8E, 0xBE, 0x36, 0xFC, 0xC8, 0x3D,
-    0x97, 0x8E, 0x7B, 0xC4, 0x6F, 0x1F, 0x79, 0xD8, 0x38, 0x97, 0xC3, 0x49, 0xEB, 0xCF, 0xB5, 0x98,
-    0xE8, 0x63, 0x24, 0x53, 0xA1, 0x2D, 0x43, 0xD0, 0x5B, 0x65, 0x0D, 0xBD, 0x15, 0x2B, 0x3C, 0x41,
-    0x7D, 0xB1, 0x44, 0xAA, 0xA6, 0x0D, 0x0E, 0x67, 0x8B, 0x9A, 0xE2, 0x79, 0xC3, 0xD1, 0x32, 0x61,
-    0xDB, 0xCC, 0xA0, 0xCF, 0xC6, 0x0F, 0x50, 0xD9, 0xE0, 0x60, 0xCA, 0xEE, 0x85, 0x0D, 0x86, 0x13,
-    0x48, 0xFD, 0x56, 0x79, 0x94, 0xFB, 0x2F, 0x72, 0xAD, 0x27, 0x0B, 0xCB, 0x6D, 0xB5, 0xF8, 0xE8,
-    0xEF, 0x95, 0x24, 0xC5, 0xF5, 0x47, 0x19, 0x2A, 0x1E, 0x9E, 0x87, 0x9D, 0xD6, 0xDF, 0x6A, 0xC5,
-    0xCB, 0x0D, 0x03, 0xFD, 0xDE, 0xD2, 0x37, 0xF4, 0xF7, 0x6C, 0x8C, 0x79, 0xA1, 0x21, 0x3C, 0x55,
-    0xBE, 0x9F, 0xB2, 0xC9, 0x18, 0x6D, 0xB0, 0x1B, 0x80, 0xD1, 0xC0, 0x46, 0x07, 0x63, 0x89, 0xEF,
-    0xDE, 0xD8, 0x96, 0x70, 0xF1, 0x0D, 0x8E, 0xA0, 0x08, 0x86, 0x20, 0x98, 0x79, 0xE5, 0x86, 0x36,
-    0x74, 0x61, 0x45, 0xF1, 0x74, 0xBD, 0xA7, 0xCC, 0x2A, 0xF8, 0x62, 0x58, 0x97, 0xF1, 0x2F, 0xC6,
-    0x81, 0xD6, 0x50, 0x2B, 0xA6, 0xF3, 0x87, 0x09, 0xD7, 0x3C, 0x08, 0x7E, 0x58, 0xC9, 0xE5, 0x0A,
-    0x09, 0xB9, 0x3E, 0xBD, 0x37, 0xC2, 0x24, 0x42, 0xBF, 0xF4, 0xE9, 0xFA, 0x60, 0x7D, 0x6E, 0xC6,
-    0x27, 0xEB, 0x83, 0xDF, 0xE4, 0xA6, 0xD9, 0xFE, 0x86, 0x0C, 0x66, 0xE8, 0x8E, 0xC1, 0x31, 0x54,
-    0xBB, 0x89, 0xBD, 0x0D, 0xD6, 0xAA, 0x83, 0x35, 0xE0, 0x74, 0xA7, 0x3F, 0xC2, 0x57, 0xAF, 0x9D,
-    0x97, 0xF4, 0x6A, 0x15, 0x95, 0x4F, 0xDB, 0xE7, 0x74, 0x61, 0x8A, 0x2F, 0x38, 0x2A, 0xFA, 0x11,
-    0x9E, 0xA4, 0x5F, 0xFA, 0x9C, 0x78, 0xCC, 0xD6, 0x8E, 0x75, 0x56, 0x34, 0x0A, 0xE7, 0x9E, 0x45,
-    0x66, 0xDC, 0x41, 0xD4, 0xB7, 0xBE, 0x78, 0xC8, 0xC5, 0x4E, 0x73, 0xE8, 0xAD, 0xEF, 0xAA, 0x23,
-    0xC6, 0x07, 0xD8, 0x68, 0xD4, 0xEA, 0x6B, 0x4B, 0x06, 0x18, 0xB2, 0xE1, 0x9D, 0x71, 0x85, 0xC1,
-    0x21, 0x9A, 0x50, 0xF5, 0x83, 0xA4, 0xA2, 0x1D, 0xC3, 0xA6, 0xCC, 0x53, 0xE0, 0x7F, 0xF1, 0x24,
-    0x2B, 0x1A, 0xAB, 0xBE, 0x85, 0x2E, 0x31, 0xC6, 0x6E, 0x65, 0x7F, 0x44, 0x06, 0x25, 0xEC, 0x20,
-    0xC7, 0x7F, 0xE7, 0x20, 0xA4, 0x7D, 0x4A, 0x9F, 0xA0, 0x8F, 0x67, 0x7F, 0x57, 0x1F, 0xFB, 0xE5,
-    0x9C, 0xB8, 0x3F, 0x5D, 0x2C, 0x79, 0x3F, 0xE8, 0xFD, 0xF1, 0xE4, 0x61, 0x33, 0x0D, 0x9D, 0xE7,
-    0x6B, 0x55, 0xB2, 0xBB, 0x53, 0x74, 0xA4, 0x7D, 0x3C, 0x2F, 0x43, 0xCB, 0xB3, 0x5C, 0xE1, 0x59,
-    0x10, 0x29, 0xB4, 0x54, 0x35, 0xAA, 0x74, 0x31, 0x80, 0x24, 0x43, 0xE8, 0x31, 0x04, 0xC2, 0x21,
-    0xDE, 0xC3, 0x99, 0x5B, 0x96, 0xEB, 0x73, 0xD3, 0x52, 0x5B, 0x9D, 0xDC, 0x1B, 0xEA, 0x14, 0xF4,
-    0x70, 0xBE, 0x67, 0xB3, 0xB4, 0xF9, 0xC2, 0xDC, 0xE8, 0xC2, 0xA3, 0x5E, 0x43, 0x8E, 0x9E, 0xE3,
-    0x0B, 0xED, 0x42, 0xD5, 0x16, 0xEB, 0xDC, 0x67, 0x1C, 0x62, 0x1A, 0xD8, 0x8D, 0x80, 0xAB, 0x49,
-    0xBC, 0xB3, 0x19, 0xCB, 0x06, 0xBF, 0x78, 0x68, 0x33, 0x36, 0x79, 0x70, 0x33, 0xF6, 0x18, 0xD0,
-    0xDB, 0xD6, 0x9F, 0x55, 0x65, 0x33, 0xA7, 0x07, 0x64, 0xB7, 0x18, 0x5A, 0x89, 0x50, 0xA2, 0x3B,
-    0x13, 0x5B, 0x40, 0xDE, 0xB1, 0x9A, 0x6D, 0x3C, 0xE0, 0xD7, 0x86, 0xD9, 0x39, 0x3B, 0x68, 0x27,
-    0x6D, 0xA8, 0xC5, 0x58, 0x5B, 0x50, 0xD3, 0x31, 0xA8, 0xB2, 0x1F, 0xC4, 0x2D, 0xC6, 0x5B, 0x0C,
-    0xB8, 0x18, 0x71, 0x31, 0xE4, 0x62, 0xCC, 0xC5, 0xA0, 0x5B, 0x5F, 0x2F, 0xC5, 0xB0, 0x8B, 0x71,
-    0x77, 0xF0, 0x4E, 0xDE, 0xD1, 0x37, 0xEC, 0x1B, 0xF8, 0x5D, 0x7F, 0x6F, 0xF7, 0x64, 0x99, 0x71,
-    0xDF, 0x44, 0x03, 0x06, 0xC8, 0xB8, 0x83, 0xAF, 0x98, 0x71, 0x97, 0xD7, 0x29, 0xC2, 0x53, 0x0F,
-    0xEB, 0x03, 0xA6, 0x04, 0xA5, 0x30, 0x2D, 0x4C, 0x0C, 0xA1, 0x1A, 0x42, 0x39, 0x9A, 0x2F, 0xD6,
-    0x8F, 0x8A, 0x08, 0x25, 0x31, 0x4D, 0x4C, 0x14, 0xDF, 0xAB, 0xA5, 0x2C, 0xA6, 0x8B, 0x09, 0xE3,
-    0xCA, 0xB8, 0x34, 0x61, 0xD1, 0x76, 0x4F, 0xB9, 0xC6, 0x1C, 0x66, 0x27, 0x6B, 0x75, 0x31, 0x59,
-    0x4C, 0x95, 0xAE, 0x28, 0x2B, 0x1B, 0x6A, 0x2C, 0xEC, 0xB2, 0x39, 0x6F, 0xA0, 0xA8, 0x27, 0x06,
-    0x23, 0x87, 0x4E, 0xE6, 0x47, 0x90, 0x1F, 0x47, 0xCC, 0x61, 0xB0, 0xA7, 0x73, 0x3F, 0xB6, 0x23,
-    0x4D, 0x2E, 0xBB, 0xF9, 0x72, 0xC5, 0x1E, 0x90, 0xAF, 0x29, 0x68, 0x6E, 0xBE, 0x26, 0xED, 0xE6,
-    0xAB, 0xA2, 0x4D, 0xB9, 0xF9, 0xFA, 0xD1, 0x32, 0x69, 0xEF, 0x63, 0x1D, 0x24, 0xAA, 0xBF, 0x40,
-    0x6B, 0x5F, 0xC1, 0xE4, 0x72, 0xCB, 0xCE, 0x80, 0x58, 0x6A, 0xBE, 0xB6, 0x6E, 0x6D, 0x09, 0xFA,
-    0xDB, 0xCD, 0x16, 0x6C, 0xB8, 0x58, 0x1E, 0x65, 0x6E, 0xBA, 0x5C, 0x07, 0xB7, 0x25, 0x94, 0x6C,
-    0xD4, 0xA2, 0xFD, 0x9B, 0x2D, 0x29, 0x3C, 0x3C, 0xC0, 0xAD, 0x6F, 0x8A, 0xC2, 0x86, 0xB2, 0x9D,
-    0xDC, 0x88, 0xBD, 0x37, 0x01, 0xF0, 0x37, 0x96, 0x12, 0x51, 0xFE, 0x4D, 0x16, 0x23, 0xBF, 0xB3,
-    0xB6, 0x4C, 0xBB, 0xAB, 0x4C, 0x49, 0xD1, 0x8E, 0xBD, 0xB6, 0x16, 0x69, 0xD7, 0xD5, 0xC5, 0xBD,
-    0x2A, 0x0B, 0x7E, 0x40, 0x97, 0xA9, 0x09, 0x43, 0x56, 0xC9, 0xED, 0x31, 0xA5, 0xD1, 0x69, 0xE1,
-    0x8C, 0x50, 0x56, 0x65, 0x84, 0x7D, 0x4E, 0x16, 0xAD, 0x0F, 0x4D, 0xB0, 0xCE, 0xF6, 0xF3, 0xB3,
-    0xDE, 0x60, 0x9B, 0xB9, 0xE9, 0x73, 0x55, 0x13, 0xE0, 0xBF, 0x3B, 0x4D, 0xD0, 0x8E, 0xFD, 0xB3,
-    0x94, 0x85, 0x79, 0xB5, 0x96, 0xFD, 0x3F, 0x8E, 0xAA, 0x74, 0x8E, 0xB4, 0xF8, 0x9A, 0x51, 0xD5,
-    0x37, 0xC5, 0x99, 0xD5, 0xE3, 0x7A, 0x53, 0xDA, 0x85, 0x46, 0x74, 0x8E, 0xCE, 0xD0, 0xBB, 0xCE,
-    0x42, 0x70, 0x14, 0x68, 0x56, 0x36, 0xA7, 0xAD, 0x6F, 0xDA, 0x81, 0x3F, 0x89, 0x57, 0x40, 0x08,
-    0xCF, 0xEB, 0x3D, 0xB1, 0x6F, 0x32, 0x7B, 0x4B, 0xED, 0x3D, 0xB7, 0xF7, 0xE4, 0xDE, 0xB3, 0x7B,
-    0x8C, 0x67, 0x6B, 0xDB, 0x31, 0x02, 0x1B, 0xE8, 0xD8, 0x2C, 0xCB, 0xFD, 0xBD, 0xD7, 0xB3, 0xBD,
-    0x89, 0xA5, 0xD8, 0xBE, 0x32, 0x08, 0x6D, 0x36, 0x96, 0xAB, 0xCD, 0xAE, 0x75, 0x87, 0x79, 0xC8,
-    0x43, 0x25, 0xF5, 0x9F, 0xE0, 0x2D, 0xE7, 0xFB, 0x6C, 0xD8, 0x76, 0xF8, 0xE9, 0xDA, 0x87, 0x29,
-    0x36, 0xAF, 0x37, 0x43, 0xEB, 0xB4, 0x71, 0x79, 0xD3, 0x36, 0x6D, 0xDA, 0x0A, 0xF4, 0x8B, 0xB5,
-    0x8E, 0xFF, 0x76, 0x1D, 0x74, 0xC7, 0x3A, 0xFF, 0x71, 0x74, 0xE3, 0x4B, 0x56, 0x03, 0x75, 0xB3,
-    0x68, 0x98, 0xB7, 0x5B, 0x21, 0x9D, 0xB5, 0x9B, 0x41, 0x5D, 0x85, 0xF5, 0xEC, 0x72, 0x7D, 0x35,
-    0x1C, 0x1E, 0x00, 0x71, 0x3F, 0x47, 0x1A, 0x72, 0x86, 0x91, 0xF5, 0x2C, 0x47, 0xF1, 0x1D, 0x52,
-    0xD9, 0xE1, 0x02, 0xD5, 0x0E, 0x67, 0xBE, 0x57, 0x78, 0x1E, 0xEB, 0x1A, 0x97, 0xA9, 0x2A, 0xB6,
-    0x0F, 0x8B, 0xAD, 0xD8, 0x74, 0xD0, 0xAA, 0x06, 0x63, 0x14, 0x18, 0x32, 0xB1, 0x8A, 0x4A, 0x4E,
-    0x24, 0x69, 0xE3, 0x02, 0xD5, 0xEE, 0xE5, 0xF8, 0x3D, 0x61, 0x45, 0x2E, 0x70, 0x91, 0x10, 0xE0,
-    0xE7, 0xEF, 0xE1, 0x80, 0x48, 0xCD, 0x63, 0x74, 0x9B, 0xF9, 0xD7, 0xD4, 0x3C, 0x3F, 0x52, 0xF3,
-    0x6C, 0xA6, 0x95, 0x79, 0x5E, 0x33, 0xAC, 0x52, 0xF9, 0xF7, 0x4B, 0x1D, 0x8C, 0xD3, 0x22, 0x54,
-    0xED, 0x90, 0xC0, 0x90, 0x8B, 0x6F, 0xB5, 0x6B, 0xBD, 0xF7, 0x51, 0xED, 0x19, 0x6A, 0xDD, 0xDC,
-    0x5E, 0xC4, 0x53, 0xBD, 0xFD, 0x24, 0xDE, 0xF3, 0x5D, 0xF8, 0xCF, 0x27, 0xD3, 0xED, 0x7E, 0x7D,
-    0xB3, 0xAE, 0x7A, 0x73, 0x2C, 0xFC, 0xED, 0x2E, 0xF2, 0x72, 0x4A, 0xD8, 0x1E, 0x3C, 0x4B, 0xDA,
-    0x23, 0x14, 0x81, 0x9D, 0x39, 0xE5, 0x39, 0x91, 0x13, 0x3C, 0xF4, 0xE7, 0xC7, 0x77, 0x2E, 0xF3,
-    0x90, 0xC3, 0xFD, 0xF6, 0x14, 0x6C, 0x50, 0xAE, 0x3A, 0x6C, 0xC6, 0xEE, 0x14, 0x5E, 0xFC, 0x13,
-    0xA4, 0x0B, 0xDB, 0xA9, 0x1D, 0xA0, 0xF5, 0xD3, 0x18, 0x4C, 0x6D, 0x4E, 0x76, 0x57, 0x6D, 0x1E,
-    0x3D, 0xFA, 0x2D, 0x0B, 0x10, 0xC9, 0xA8, 0xB3, 0x9C, 0xE1, 0x03, 0xBC, 0x9F, 0x43, 0x6B, 0x53,
-    0x18, 0x3B, 0xA4, 0x86, 0x4C, 0x1C, 0x78, 0x93, 0x31, 0xF9, 0xC6, 0x63, 0x02, 0x8E, 0x4B, 0x12,
-    0x4E, 0x72, 0x20, 0x3E, 0x77, 0x83, 0x8C, 0xB3, 0x3D, 0x87, 0xEC, 0x94, 0x1D, 0xB3, 0x73, 0x76,
-    0xD0, 0x4E, 0xDA, 0x51, 0x3B, 0x6B, 0x87, 0xED, 0xB4, 0x1D, 0xB7, 0xF3, 0x76, 0xE0, 0x4E, 0xDC,
-    0x91, 0x3B, 0x73, 0x87, 0xDE, 0x50, 0x6F, 0x7D, 0xFC, 0xB9, 0x7C, 0xB1, 0x1F, 0xC1, 0xFB, 0x3C,
-    0xEF, 0xB7, 0x2C, 0xED, 0xE9, 0xE6, 0x60, 0xCC, 0xD4, 0x82, 0x0C, 0xA9, 0x1F, 0x10, 0x7B, 0x05,
-    0x90, 0xB7, 0x46, 0x00, 0x3F, 0xC7, 0xA7, 0x0C, 0xD2, 0x3D, 0xA3, 0xEE, 0xD6, 0x0E, 0xD2, 0x93,
-    0xBE, 0xE1, 0x37, 0xFE, 0x26, 0x80, 0x29, 0x60, 0x12, 0x98, 0x06, 0x26, 0x82, 0x50, 0x05, 0x31,
-    0x19, 0x1A, 0x1D, 0x9E, 0x73, 0xC1, 0x1D, 0x71, 0xB9, 0xD8, 0x61, 0x14, 0xDF, 0x64, 0xD4, 0xEB,
-    0xC7, 0x6B, 0x2F, 0x84, 0x25, 0x93, 0x1E, 0xC6, 0xA7, 0x9D, 0x10, 0x69, 0x09, 0x4B, 0x94, 0x2F,
-    0x5F, 0x08, 0x0B, 0x37, 0x1E, 0x6F, 0x9A, 0x80, 0xE3, 0x11, 0xC7, 0x42, 0x8E, 0xC7, 0x1C, 0x0F,
-    0x3A, 0x88, 0x3A, 0xEB, 0xDB, 0x31, 0x2C, 0x99, 0x64, 0x44, 0xB2, 0x90, 0xE4, 0x31, 0x89, 0x6F,
-    0x6D, 0xCE, 0x88, 0xF1, 0x9E, 0x93, 0xEC, 0x24, 0x1B, 0x4B, 0xD5, 0xC6, 0x6B, 0x9D, 0x4D, 0x18,
-    0x24, 0xFF, 0x39, 0xFF, 0x21, 0xF1, 0x0F, 0xB9, 0x67, 0x98, 0xF7, 0xF6, 0xD6, 0x3E, 0x4C, 0x5D,
-    0xB2, 0xD5, 0x05, 0x41, 0x92, 0x31, 0xFC, 0x42, 0x1F, 0xF5, 0x02, 0xD2, 0x32, 0x39, 0x15, 0x5C,
-    0x5F, 0x7E, 0xBF, 0x58, 0xEF, 0xF8, 0xDF, 0x5D, 0x23, 0x49, 0x0F, 0x9D, 0xBD, 0xE9, 0x17, 0x0F,
-    0x3F, 0x24, 0xB9, 0x5C, 0xD4, 0x87, 0x73, 0xDA, 0xF4, 0xE8, 0x81, 0xC8, 0xE6, 0x73, 0x6F, 0xB3,
-    0x4E, 0xF6, 0x66, 0xFF, 0xE6, 0x47, 0xE0, 0x3A, 0x99, 0x90, 0x0F, 0x2B, 0xF5, 0xB8, 0x5F, 0x8F,
-    0xD3, 0xF9, 0xDE, 0x93, 0xF5, 0x9E, 0xA6, 0xFE, 0xFA, 0x3E, 0xA8, 0x35, 0xE1, 0x76, 0xF9, 0x98,
-    0x7F, 0x96, 0x48, 0xD0, 0x13, 0x8E, 0x91, 0x67, 0xB9, 0x0B, 0x7E, 0x85, 0x50, 0x79, 0xA6, 0x94,
-    0x7B, 0x38, 0xC9, 0x1F, 0x78, 0x8A, 0xE9, 0xAF, 0x2C, 0xA4, 0x33, 0x84, 0xFA, 0xCE, 0x7A, 0x65,
-    0x9E, 0xD1, 0xE6, 0x12, 0xFD, 0xB2, 0xB5, 0x5C, 0x95, 0xDD, 0xAA, 0x3F, 0xB3, 0xED, 0xFB, 0xFF,
-    0xD0, 0x80, 0xE2, 0x61, 0x0D, 0xE8, 0xCD, 0x50, 0x9C, 0x62, 0x4A, 0xF8, 0x71, 0x34, 0xB4, 0x61,
-    0xC0, 0x79, 0x40, 0xC6, 0x21, 0x23, 0x2D, 0xE0, 0x3B, 0x9A, 0x20, 0xD9, 0x59, 0x53, 0xF4, 0x9F,
-    0x31, 0x9A, 0x14, 0x57, 0x18, 0xE1, 0xA3, 0x2A, 0xE1, 0x12, 0xC6, 0x39, 0x2E, 0x25, 0xF1, 0x98,
-    0xC9, 0xF4, 0x1A, 0x4B, 0xB7, 0xFD, 0xC0, 0xB2, 0x4D, 0x7B, 0xB3, 0xCE, 0xCA, 0xC1, 0xA4, 0xF3,
-    0x99, 0x87, 0x72, 0x91, 0xD3, 0xB3, 0xED, 0x19, 0x97, 0x38, 0xD3, 0xFB, 0x2B, 0xCA, 0xB6, 0xBD,
-    0x6E, 0xB4, 0x8B, 0x68, 0x6E, 0x6F, 0x1C, 0xBD, 0x65, 0x99, 0x6C, 0x53, 0xB2, 0x45, 0xD2, 0x33,
-    0x40, 0x00, 0x40, 0xC2, 0x7A, 0x88, 0x6D, 0xB3, 0x7C, 0x93, 0xB2, 0x61, 0xCF, 0xDA, 0x48, 0x94,
-    0xB4, 0xC3, 0x74, 0xCC, 0x29, 0x63, 0x6C, 0x8E, 0xB3, 0xCA, 0xDE, 0x6E, 0xEB, 0x04, 0x3C, 0xB7,
-    0x29, 0x67, 0x5E, 0x85, 0x8B, 0x6F, 0x58, 0x07, 0xA7, 0xD3, 0xDB, 0x71, 0x1C, 0x9F, 0xDB, 0x14,
-    0xED, 0x07, 0x86, 0x56, 0xDC, 0xF3, 0x45, 0xBE, 0x4D, 0x5B, 0x8F, 0xCE, 0xEB, 0xED, 0x5F, 0xDE,
-    0x7F, 0x5F, 0xEF, 0x09, 0x71, 0x5A, 0x68, 0x53, 0xCE, 0xE5, 0xAB, 0x1E, 0x7F, 0x4E, 0xD9, 0xC7,
-    0xCA, 0x8A, 0xD7, 0x51, 0xF5, 0x7B, 0xA0, 0x17, 0x21, 0xE5, 0xDB, 0xF0, 0xCF, 0x89, 0xAC, 0x03,
-    0xFF, 0x7F, 0x01, 0xB5, 0x58, 0x3D, 0x6C, 0xE4, 0xC6, 0x15, 0x7E, 0x24, 0xA5, 0x23, 0x0C, 0x22,
-    0x37, 0x57, 0xE8, 0x52, 0x5C, 0x6C, 0xB3, 0xB9, 0x26, 0x86, 0x74, 0x4C, 0xA9, 0x62, 0x57, 0x1C,
-    0xC3, 0x40, 0x9A, 0x00, 0x81, 0x8A, 0x13, 0x5C, 0xB8, 0xB0, 0x8B, 0x34, 0x71, 0x80, 0x38, 0x08,
-    0x54, 0xA8, 0x90, 0x44, 0x22, 0x57, 0xB8, 0x0A, 0xA2, 0x22, 0x5D, 0x80, 0x44, 0xC5, 0x15, 0x86,
-    0x52, 0x48, 0xC5, 0x15, 0x17, 0x40, 0x12, 0xC7, 0xE7, 0xE2, 0x8A, 0x34, 0x0C, 0x82, 0x20, 0x45,
-    0x8A, 0x10, 0x88, 0x0D, 0x23, 0x97, 0x66, 0x90, 0xF0, 0x60, 0xFA, 0xC2, 0x15, 0xF3, 0xBD, 0x37,
-    0xE4, 0xFE, 0xD8, 0xE7, 0xB3, 0xCE, 0x87, 0xEC, 0xEE, 0xBC, 0x5D, 0x2E, 0x67, 0xDE, 0xBC, 0xF9,
-    0xE6, 0xBD, 0xEF, 0xBD, 0xE1, 0xE1, 0xE1, 0x57, 0xBC, 0x36, 0xDF, 0x79, 0x69, 0x7D, 0xF5, 0xEA,
-    0x49, 0x60, 0x54, 0x95, 0x34, 0x3F, 0xFF, 0xA5, 0x9F, 0x5F, 0xEE, 0xED, 0x69, 0x32, 0x44, 0x96,
-    0x68, 0x44, 0x45, 0x47, 0x27, 0x23, 0x3A, 0x3C, 0xA1, 0x43, 0x43, 0x87, 0xF4, 0xCD, 0x3F, 0x9B,
-    0x44, 0xD0, 0x19, 0xE4, 0xA4, 0x88, 0xD2, 0x2E, 0xBF, 0x1A, 0xE4, 0xC1, 0x2F, 0x72, 0x7A, 0x90,
-    0x93, 0xFF, 0x02, 0x1F, 0x4F, 0x5F, 0xDF, 0xD2, 0x69, 0x57, 0x66, 0x5D, 0x09, 0xF5, 0xF3, 0xBF,
-    0xE5, 0x95, 0x75, 0x5D, 0x97, 0xB3, 0xC0, 0xFF, 0x5D, 0x67, 0xF9, 0x57, 0x25, 0x37, 0xF8, 0x92,
-    0x5F, 0x4D, 0xD6, 0xFF, 0xA8, 0x87, 0x21, 0xCF, 0xBA, 0xB5, 0xE2, 0xE9, 0x51, 0x60, 0xFE, 0xDF,
-    0x1F, 0x99, 0x4A, 0x61, 0x62, 0x8A, 0xBB, 0xEE, 0xC2, 0xCD, 0xBC, 0xBC, 0xB5, 0x75, 0x9B, 0x2D,
-    0x6B, 0xE9, 0xB5, 0xA3, 0xA3, 0x0F, 0x88, 0x6E, 0xFA, 0xB5, 0xD2, 0xAB, 0xD8, 0x9D, 0x7D, 0xCA,
-    0x4C, 0x66, 0x52, 0xE3, 0x91, 0x5F, 0xAA, 0x5A, 0x35, 0x61, 0x43, 0x0D, 0x59, 0xAF, 0x8A, 0xF2,
-    0xB1, 0xD3, 0x53, 0x26, 0x36, 0xB6, 0xA1, 0xF5, 0xAC, 0x5F, 0x86, 0xF9, 0x19, 0x1D, 0x50, 0x94,
-    0xA7, 0x65, 0x66, 0x8A, 0xBC, 0xA5, 0x7B, 0xB4, 0x4D, 0x63, 0x5C, 0x93, 0xA6, 0x9B, 0x5E, 0x0E,
-    0x8D, 0x46, 0xE9, 0x1D, 0x5A, 0xC5, 0xB6, 0x8F, 0xBC, 0x8A, 0xF6, 0xFD, 0x86, 0xB2, 0x8F, 0x2E,
-    0x28, 0x7B, 0xD0, 0x51, 0x6A, 0x26, 0xE4, 0xD1, 0x35, 0xCC, 0xF1, 0x2A, 0xA9, 0x3A, 0x35, 0xAA,
-    0x49, 0xCB, 0xB0, 0x49, 0x4A, 0x6A, 0x42, 0x43, 0x36, 0x30, 0x98, 0x4F, 0x47, 0xF9, 0x1E, 0x8D,
-    0xFD, 0x6A, 0x0A, 0x96, 0x2A, 0x33, 0x4A, 0x6C, 0x97, 0xC7, 0xB6, 0x30, 0xA1, 0x4D, 0x72, 0xCF,
-    0x2A, 0x0D, 0x1B, 0x29, 0xCC, 0xD7, 0xE8, 0xCC, 0xAF, 0xE9, 0xC0, 0xD7, 0x98, 0x7B, 0x2D, 0xFD,
-    0x53, 0x97, 0x7D, 0xD4, 0x15, 0x77, 0x26, 0x6D, 0x50, 0xDD, 0x0B, 0xCC, 0xB6, 0x6F, 0xC6, 0x64,
-    0xD9, 0x7A, 0xBD, 0x24, 0x3E, 0x83, 0x9E, 0x14, 0xC0, 0x11, 0x03, 0x68, 0x0E, 0xB0, 0xB1, 0x8C,
-    0x0F, 0x9C, 0x88, 0x42, 0x4D, 0xE9, 0xEF, 0x8F, 0x2B, 0x60, 0x52, 0xAE, 0x28, 0xB8, 0x6B, 0xC2,
-    0x5B, 0x87, 0x56, 0xF4, 0xED, 0x1C, 0xAD, 0xED, 0x5B, 0x43, 0xE2, 0xCB, 0x1E, 0x37, 0xA8, 0xF1,
-    0xA1, 0xC6, 0x37, 0x33, 0x55, 0x81, 0x86, 0x3A, 0x74, 0x89, 0xD0, 0x5E, 0x12, 0xDB, 0xA1, 0x0F,
-    0x97, 0xEC, 0x46, 0x11, 0x6F, 0x87, 0xCA, 0x59, 0x50, 0x2F, 0xFE, 0xF0, 0xC3, 0x1B, 0x86, 0xB0,
-    0x3D, 0x86, 0xFE, 0xB9, 0xFA, 0x1D, 0xDC, 0x11, 0xA0, 0xCF, 0x58, 0x4C, 0xA8, 0x9F, 0x8C, 0x4E,
-    0x58, 0x1C, 0xB2, 0x38, 0x60, 0xC1, 0x9A, 0x04, 0x9A, 0xC8, 0xB2, 0xA8, 0x7A, 0xC5, 0x2B, 0x61,
-    0xBE, 0xC9, 0xBB, 0x5A, 0x51, 0x7A, 0x7C, 0x5C, 0xF6, 0x53, 0xBC, 0xCA, 0xE2, 0x16, 0x8B, 0x0D,
-    0x16, 0xFB, 0x2C, 0x7E, 0xCC, 0x36, 0x7D, 0x00, 0xA7, 0xC8, 0x93, 0xCE, 0xA4, 0x5D, 0x35, 0xF7,
-    0x29, 0xF1, 0xA7, 0x7F, 0xD1, 0x4F, 0x02, 0x03, 0xE0, 0xFC, 0xDD, 0x04, 0xE6, 0x95, 0x50, 0x0B,
-    0xEF, 0x81, 0x6E, 0xDC, 0x1C, 0x76, 0x25, 0xC9, 0x53, 0xF8, 0x4A, 0x9A, 0x2F, 0xF7, 0x57, 0x81,
-    0x4D, 0x4D, 0xD4, 0xA0, 0xD5, 0x69, 0x1E, 0xDA, 0x65, 0xAC, 0x1B, 0xA0, 0x6B, 0xBA, 0x96, 0x6A,
-    0x18, 0x3A, 0xC9, 0x72, 0x65, 0xBD, 0xAE, 0x60, 0x79, 0x91, 0xB2, 0xD5, 0x13, 0xA7, 0x65, 0x09,
-    0x40, 0x17, 0xBA, 0xD3, 0xE7, 0xEE, 0x92, 0x09, 0x82, 0x5E, 0x88, 0x1A, 0x66, 0x04, 0x21, 0xD4,
-    0xC0, 0x9B, 0xE2, 0xBF, 0xF0, 0xC7, 0xD3, 0xDD, 0xC2, 0xEB, 0xF2, 0xD4, 0xD7, 0x75, 0x9F, 0x6C,
-    0x95, 0xC4, 0xEF, 0x8A, 0x9E, 0x6F, 0xDC, 0xD6, 0x5B, 0x70, 0x24, 0x7E, 0x47, 0xCF, 0x33, 0x8E,
-    0x66, 0xAF, 0x0C, 0x3B, 0x75, 0x8F, 0x7F, 0xF8, 0x8F, 0x1B, 0xE7, 0x31, 0x70, 0x94, 0x5D, 0x0A,
-    0x85, 0x14, 0x62, 0x3D, 0x26, 0x25, 0xBD, 0x13, 0xF8, 0x86, 0xB8, 0x08, 0xBE, 0x37, 0x68, 0x57,
-    0x7E, 0xED, 0xC1, 0x55, 0xAC, 0xFC, 0x3A, 0xA5, 0xBD, 0xC0, 0xED, 0x78, 0x4B, 0xA7, 0x91, 0xE9,
-    0x7F, 0xB5, 0x31, 0xDD, 0x06, 0x45, 0xD2, 0xA9, 0x57, 0x8F, 0xC3, 0xCE, 0x78, 0x5D, 0x75, 0x1A,
-    0x54, 0xF7, 0xE3, 0x37, 0xAA, 0xB0, 0x6C, 0xC6, 0xD1, 0x87, 0x76, 0xEC, 0x23, 0x40, 0x4F, 0xE3,
-    0x2E, 0x28, 0xD1, 0x23, 0xA5, 0x53, 0xFF, 0x6E, 0x94, 0xD7, 0xE8, 0x0B, 0xC5, 0x14, 0xFB, 0xD6,
-    0xAB, 0x4F, 0xD9, 0xC9, 0xC7, 0x81, 0xF5, 0x2D, 0xD4, 0xC2, 0xCF, 0x83, 0x2A, 0xB0, 0x0D, 0x14,
-    0xFB, 0x16, 0xBF, 0x2A, 0xE6, 0x9D, 0xD0, 0x04, 0xAC, 0xCD, 0xAB, 0x61, 0x66, 0x50, 0x29, 0xD3,
-    0x20, 0x70, 0x13, 0xDC, 0x8F, 0x85, 0x27, 0x60, 0x66, 0xBD, 0x47, 0x7B, 0xB1, 0x26, 0x84, 0x74,
-    0x66, 0x29, 0x6E, 0x5D, 0xAC, 0xD1, 0x53, 0x5E, 0x53, 0x1C, 0x16, 0xB1, 0x58, 0xC4, 0x63, 0x11,
-    0x93, 0x45, 0x5C, 0x16, 0xB1, 0x59, 0xC4, 0x67, 0x11, 0xA3, 0x45, 0x9C, 0x16, 0xB1, 0xA2, 0x65,
-    0x3D, 0x87, 0x17, 0x65, 0x0D, 0xCD, 0x30, 0xF3, 0xEC, 0x98, 0x66, 0xB8, 0x85, 0x65, 0x42, 0x33,
-    0xEC, 0x94, 0xC1, 0xB2, 0xA7, 0xF8, 0xC5, 0x9A, 0xC9, 0x69, 0xC0, 0x30, 0x11, 0xAA, 0x1A, 0x70,
-    0x4C, 0xE5, 0x6A, 0xC0, 0x72, 0x83, 0x29, 0x6C, 0x8A, 0xE7, 0x98, 0x19, 0x60, 0x8A, 0xE9, 0x98,
-    0x41, 0x9F, 0xE2, 0x3A, 0x66, 0x9E, 0x99, 0x62, 0xBB, 0xE1, 0x63, 0x65, 0x53, 0x7C, 0xE3, 0x1F,
-    0x80, 0x0A, 0xA6, 0x18, 0x87, 0x7D, 0x0A, 0x99, 0xE1, 0x1C, 0x56, 0xAA, 0x54, 0x86, 0xAD, 0x1A,
-    0x23, 0x83, 0x6C, 0xCB, 0x3F, 0x29, 0xF8, 0x7A, 0x9F, 0x94, 0x39, 0x05, 0xA2, 0x0D, 0x25, 0xA0,
-    0x4A, 0xE6, 0x72, 0xCE, 0x46, 0xDB, 0x4C, 0x91, 0xAE, 0x4F, 0x50, 0xA3, 0x53, 0x60, 0xD1, 0x2B,
-    0x2C, 0xD1, 0x2D, 0x32, 0x09, 0x93, 0x3A, 0x3A, 0xC6, 0xDC, 0x73, 0x8D, 0xBB, 0x8E, 0xFA, 0xFD,
-    0xC3, 0x42, 0x78, 0x69, 0x4A, 0x2B, 0x1D, 0x6A, 0xD6, 0x90, 0x81, 0x6B, 0x82, 0x3A, 0xF5, 0xEB,
-    0xC4, 0x43, 0xEA, 0x6A, 0x94, 0xBE, 0x1F, 0xEA, 0x75, 0xD7, 0x9F, 0x6F, 0x69, 0xDC, 0x04, 0x3B,
-    0xF9, 0x75, 0x9C, 0x73, 0x87, 0x5C, 0xB1, 0x7A, 0xEE, 0x64, 0xB8, 0x9B, 0x41, 0x47, 0xBF, 0xDF,
-    0xA0, 0x6B, 0x44, 0x3B, 0xBC, 0x47, 0xDE, 0x05, 0xF9, 0x7F, 0xA7, 0xE0, 0x61, 0x1E, 0xBD, 0x61,
-    0x94, 0x5F, 0xAD, 0x91, 0x1D, 0xC1, 0x65, 0x3C, 0x21, 0xD0, 0x5D, 0xE6, 0x7A, 0xF0, 0x77, 0x92,
-    0x73, 0x2E, 0xB8, 0x60, 0x7B, 0x28, 0xD1, 0xCC, 0xE3, 0xF0, 0x1C, 0xA6, 0x7F, 0x2D, 0x1F, 0x2B,
-    0x30, 0xED, 0x0A, 0xD3, 0xA6, 0x9A, 0x62, 0x43, 0x69, 0x8E, 0xC4, 0xE1, 0x35, 0x9C, 0x6D, 0xE0,
-    0x55, 0x6B, 0x32, 0x1B, 0x96, 0x0E, 0xFB, 0x6F, 0x02, 0x20, 0xFA, 0xDE, 0x1E, 0xA9, 0x8A, 0x9A,
-    0x58, 0x2B, 0xD9, 0x15, 0xCE, 0x0C, 0x70, 0x76, 0x1E, 0xBE, 0x27, 0xC4, 0x1F, 0x6B, 0x76, 0xAA,
-    0xB0, 0xE4, 0x84, 0xE1, 0xD5, 0xF2, 0xF7, 0x7E, 0x43, 0xF7, 0x91, 0xC9, 0x2B, 0xAF, 0xED, 0xA0,
-    0xC1, 0x6F, 0xCF, 0x68, 0xA3, 0xE6, 0xA4, 0xD4, 0x60, 0x04, 0xA6, 0x41, 0x34, 0x40, 0x09, 0xAB,
-    0xDA, 0xC7, 0x08, 0x9E, 0x1A, 0x63, 0xC2, 0x8A, 0x55, 0xC5, 0x79, 0x64, 0xC2, 0x72, 0x03, 0xA3,
-    0xBC, 0x7A, 0x9D, 0x67, 0xFF, 0x59, 0x9F, 0x8E, 0x32, 0x5D, 0x70, 0x8E, 0xBB, 0x60, 0x01, 0x4A,
-    0xBE, 0xF0, 0xA0, 0x6E, 0xC2, 0xA2, 0x45, 0xCA, 0xF6, 0x5A, 0x9F, 0xD5, 0x20, 0xF2, 0xFC, 0x1A,
-    0x22, 0x80, 0x33, 0x91, 0xD8, 0x1A, 0x94, 0x58, 0x7B, 0x60, 0x22, 0xC6, 0x40, 0x71, 0xEA, 0x45,
-    0xB6, 0x89, 0xB4, 0xE2, 0xAC, 0x03, 0xC4, 0x96, 0xC1, 0xEA, 0x03, 0xBB, 0xCB, 0xFE, 0x81, 0xDC,
-    0xBB, 0xD7, 0x3B, 0x08, 0xE0, 0x8C, 0x8B, 0x76, 0x2E, 0x38, 0xFD, 0xAE, 0xA1, 0xF8, 0x09, 0xAA,
-    0x02, 0x9D, 0xE6, 0xE7, 0xE2, 0x33, 0xAA, 0x1C, 0xBD, 0x0B, 0x03, 0xCF, 0xD1, 0x5A, 0xA0, 0xD8,
-    0x02, 0xC6, 0xA6, 0x20, 0xEF, 0x33, 0x98, 0x83, 0x7C, 0xC4, 0xE9, 0x49, 0xD2, 0x77, 0x9F, 0x73,
-    0x19, 0xCE, 0xF9, 0xA8, 0x4F, 0xD8, 0x3D, 0xF0, 0x7F, 0x96, 0xBB, 0x14, 0x4E, 0x52, 0xCA, 0x6D,
-    0x6D, 0x49, 0xF9, 0x46, 0xEF, 0x1E, 0x1D, 0x1D, 0x0D, 0x3D, 0xD7, 0xC5, 0x91, 0xCD, 0x2B, 0xC2,
-    0x03, 0x5A, 0x12, 0xF4, 0x19, 0xD4, 0x6F, 0x7A, 0xEF, 0x41, 0x7D, 0x82, 0x6A, 0x09, 0x68, 0x7A,
-    0xC7, 0x4F, 0x24, 0xE7, 0xFE, 0xA4, 0xFB, 0x98, 0x7B, 0x41, 0x05, 0xBA, 0x15, 0xBF, 0xA6, 0x6F,
-    0xB7, 0x62, 0x04, 0xC5, 0x2E, 0xCD, 0x06, 0x46, 0x94, 0x51, 0x39, 0xB3, 0xE3, 0xC4, 0x95, 0x08,
-    0x5C, 0x65, 0x30, 0xC1, 0x30, 0xAD, 0xC4, 0xE4, 0xF2, 0x3B, 0xD3, 0x48, 0xFD, 0x85, 0xDB, 0xF8,
-    0x8E, 0x71, 0x3D, 0x66, 0x17, 0xE2, 0xD8, 0x1B, 0xE3, 0x76, 0x8C, 0xDB, 0xF0, 0x78, 0xC3, 0x10,
-    0x07, 0x65, 0x4C, 0x4C, 0x12, 0x54, 0xEF, 0x3A, 0x05, 0xC3, 0x9A, 0x7B, 0xE2, 0x79, 0xB9, 0x2F,
-    0xF5, 0xD2, 0x9E, 0xCD, 0xE2, 0xBF, 0xBE, 0x2E, 0x86, 0xFB, 0xFF, 0x4D, 0xAA, 0xBE, 0x7A, 0x15,
-    0xBE, 0xEA, 0xFA, 0x7A, 0xB6, 0xFB, 0xAD, 0xAB, 0x44, 0xEF, 0xBE, 0x9C, 0x39, 0xC2, 0x1B, 0xC5,
-    0x6E, 0xE0, 0x28, 0xD4, 0x3D, 0xA7, 0x89, 0xF6, 0x83, 0x25, 0x34, 0x5A, 0xC2, 0x2C, 0xDC, 0x6E,
-    0x61, 0x16, 0x6E, 0xE9, 0x9D, 0x5C, 0x5A, 0xF4, 0xE9, 0xF7, 0x2B, 0x6E, 0x54, 0x14, 0x96, 0xDB,
-    0xF5, 0xE2, 0xC9, 0x21, 0x37, 0x9E, 0x85, 0xDB, 0xF9, 0xB7, 0x26, 0xD2, 0x36, 0x5F, 0x49, 0x0D,
-    0x37, 0x70, 0x9C, 0x6B, 0xBB, 0x3E, 0xB9, 0xD6, 0xC3, 0xD1, 0xBF, 0x6E, 0x1C, 0x1D, 0x26, 0x9D,
-    0x4D, 0xF9, 0x53, 0x65, 0x5C, 0x7C, 0x8B, 0x4D, 0xAB, 0x2C, 0xEE, 0x93, 0x43, 0x4C, 0x20, 0xE3,
-    0x3A, 0xD3, 0xE1, 0x49, 0xC2, 0x11, 0xF5, 0x50, 0x12, 0xC9, 0xEA, 0x85, 0xC2, 0x85, 0xB9, 0x45,
-    0xB5, 0x1D, 0x50, 0x72, 0xE5, 0x17, 0xF5, 0xBB, 0xF0, 0x6C, 0x8D, 0xE4, 0x6D, 0x6D, 0x62, 0xBF,
-    0x11, 0xB9, 0x75, 0xBF, 0x3B, 0xC6, 0xF9, 0x56, 0x9A, 0x4B, 0x78, 0x8B, 0x6F, 0x65, 0x7D, 0x69,
-    0x38, 0x71, 0xA5, 0xA1, 0xD7, 0x37, 0x1F, 0x55, 0x7E, 0xD0, 0x57, 0x9A, 0xA1, 0x75, 0x25, 0x9A,
-    0xAA, 0x9C, 0x1A, 0x65, 0xE6, 0x54, 0xF5, 0x6A, 0x44, 0x55, 0x2E, 0xB5, 0x0F, 0x5D, 0xBF, 0xDD,
-    0xCF, 0x1D, 0xF2, 0x7E, 0xC5, 0xCF, 0x1A, 0xF9, 0x65, 0x23, 0x78, 0xF2, 0x8E, 0x0D, 0xE0, 0x86,
-    0xE0, 0xBF, 0xA4, 0x11, 0x5E, 0xC7, 0xEE, 0xD1, 0xCF, 0x3D, 0x0D, 0xCB, 0x5A, 0x1A, 0x87, 0x66,
-    0xFC, 0x48, 0xC2, 0xD3, 0x0C, 0x21, 0x7A, 0x86, 0xC1, 0x1C, 0xA6, 0x68, 0x66, 0x84, 0xEF, 0x5D,
-    0xA7, 0x74, 0x4E, 0x31, 0xB7, 0x01, 0x28, 0xB6, 0x8D, 0x63, 0xB6, 0x71, 0x0D, 0x75, 0x3E, 0x37,
-    0x1F, 0xE6, 0x72, 0x93, 0x2A, 0xBC, 0x9C, 0x85, 0xB3, 0x54, 0xE3, 0xAE, 0x22, 0x47, 0x50, 0x3A,
-    0x37, 0x7F, 0x5A, 0x52, 0x1F, 0xB4, 0x0F, 0xA1, 0x2E, 0xF8, 0xE5, 0x33, 0x44, 0x16, 0x5F, 0xBC,
-    0x12, 0x55, 0xCA, 0x5A, 0x4A, 0x5E, 0x49, 0x62, 0x78, 0x1D, 0x89, 0xAC, 0x22, 0xD5, 0xBC, 0x86,
-    0x54, 0x0E, 0x19, 0x2C, 0x63, 0xB3, 0x2F, 0xFA, 0xF7, 0x04, 0xD7, 0x53, 0xB1, 0xBA, 0x15, 0x9B,
-    0x1B, 0xB1, 0xB8, 0x16, 0x7B, 0x2D, 0x5B, 0x8B, 0xFA, 0x9F, 0xAB, 0xCB, 0x92, 0xAD, 0x45, 0x46,
-    0x61, 0x3B, 0xE7, 0xEA, 0x2F, 0x4F, 0xAC, 0x04, 0x24, 0xB0, 0x11, 0xA3, 0x61, 0x21, 0x02, 0x20,
-    0x75, 0xA8, 0x2F, 0xD6, 0x27, 0xFA, 0x0A, 0x9F, 0x24, 0x0B, 0x4A, 0xFF, 0x35, 0x71, 0x5C, 0x9C,
-    0x31, 0x64, 0x2D, 0x2F, 0x70, 0x02, 0x12, 0xC7, 0x80, 0x16, 0xD3, 0xE2, 0xD4, 0xD3, 0x0A, 0xC1,
-    0x31, 0xAF, 0xE3, 0x1E, 0x1F, 0x66, 0xD0, 0x9B, 0x37, 0xD8, 0x73, 0x74, 0x84, 0x3A, 0x9B, 0x6D,
-    0xC3, 0x4C, 0x30, 0x0E, 0x87, 0x37, 0x0E, 0x07, 0xF6, 0x6B, 0xB4, 0xC8, 0xE1, 0xA9, 0x5C, 0x04,
-    0xF0, 0xD7, 0x32, 0x4D, 0x59, 0xDA, 0x11, 0xF5, 0x92, 0x83, 0x8E, 0xD1, 0xEB, 0x34, 0x75, 0xFC,
-    0x25, 0x1F, 0xDE, 0xC1, 0xC9, 0xAC, 0xE7, 0x4D, 0x1C, 0x35, 0xC0, 0xA5, 0x2D, 0x1F, 0x20, 0x63,
-    0x3E, 0x44, 0x5E, 0x97, 0x48, 0xAA, 0xE7, 0x8E, 0x45, 0xD6, 0x45, 0xE3, 0xB0, 0xAF, 0x1C, 0x94,
-    0x6C, 0x06, 0x27, 0x32, 0x8E, 0x4D, 0xD5, 0x47, 0xDA, 0xAD, 0x3E, 0x12, 0x07, 0x4E, 0xDC, 0xED,
-    0x83, 0xB2, 0x66, 0xC2, 0x96, 0x13, 0x2A, 0x4E, 0x23, 0x8F, 0x33, 0x60, 0x63, 0x13, 0x6C, 0x20,
-    0x44, 0x33, 0x15, 0xED, 0x54, 0x34, 0xD3, 0xBB, 0x96, 0x45, 0xC9, 0x42, 0x93, 0x5D, 0x63, 0x7B,
-    0x5E, 0x50, 0x78, 0x16, 0xF5, 0x54, 0x62, 0x93, 0x8F, 0xE9, 0xB5, 0xC3, 0x1B, 0x77, 0xFB, 0x8A,
-    0x91, 0x0F, 0x6B, 0x69, 0xF7, 0x68, 0xA2, 0xC1, 0x4E, 0x20, 0x3D, 0x16, 0xDD, 0x53, 0x84, 0xDC,
-    0x48, 0x3B, 0x53, 0xF3, 0xC1, 0x1B, 0xEB, 0x40, 0xE2, 0x71, 0xFB, 0xCE, 0x4F, 0x03, 0xE8, 0xED,
-    0x47, 0x48, 0x46, 0x81, 0x29, 0xBA, 0x9C, 0x85, 0x79, 0xA6, 0xD0, 0x05, 0x9F, 0xDC, 0x31, 0xFE,
-    0xAE, 0xF3, 0x2F, 0x94, 0x67, 0x11, 0x5A, 0xFC, 0xA0, 0xA4, 0xE8, 0xDF, 0xE6, 0x1D, 0x2A, 0x7E,
-    0xC3, 0x73, 0x34, 0x8C, 0x53, 0xFA, 0xB7, 0x09, 0xAD, 0x2B, 0xF8, 0x8B, 0x42, 0xB8, 0x27, 0x70,
-    0xC9, 0x0D, 0xB7, 0xD1, 0x3C, 0x28, 0x6C, 0xC2, 0x36, 0xAC, 0xBD, 0x83, 0x2F, 0xC7, 0x92, 0xAA,
-    0x52, 0x9B, 0x56, 0x19, 0xE2, 0x60, 0x1D, 0x5C, 0xAB, 0x72, 0x7F, 0x56, 0xBD, 0x5E, 0xE9, 0x78,
-    0xE7, 0xD3, 0x27, 0x45, 0x45, 0xDE, 0xE7, 0xEC, 0x66, 0x5C, 0x5C, 0x24, 0xB2, 0x7B, 0x91, 0xE1,
-    0x7D, 0xF3, 0x4B, 0x29, 0x6A, 0x34, 0xBD, 0xF0, 0x6B, 0x24, 0x1C, 0x1E, 0x0B, 0x89, 0x33, 0x53,
-    0xC7, 0x9A, 0x0B, 0x10, 0x4C, 0x9F, 0x7D, 0x72, 0xCC, 0x1C, 0x26, 0xF9, 0x98, 0x6B, 0xE8, 0x81,
-    0x11, 0xD8, 0xE3, 0x25, 0xED, 0xA5, 0x4C, 0x18, 0xF1, 0x43, 0x24, 0x3C, 0x97, 0xED, 0x38, 0xD5,
-    0xF1, 0x89, 0xDA, 0x25, 0x39, 0x97, 0xE1, 0x24, 0xBD, 0x8D, 0xC2, 0x21, 0xB1, 0x2D, 0x4D, 0x8D,
-    0xE6, 0x28, 0xD1, 0x96, 0x83, 0x9F, 0x27, 0x79, 0x5C, 0xFE, 0x08, 0xFE, 0xFE, 0xC7, 0x96, 0x9F,
-    0x99, 0x20, 0xFE, 0xF8, 0x71, 0x4D, 0xFA, 0x29, 0x4E, 0x2A, 0xDF, 0x0D, 0xDF, 0x66, 0x7A, 0x63,
-    0x22, 0x55, 0x9E, 0x40, 0xD0, 0x5B, 0x11, 0x94, 0xAB, 0x91, 0x1D, 0x45, 0x76, 0x3B, 0xAC, 0x2C,
-    0x07, 0x00, 0xC8, 0x20, 0x90, 0x07, 0x53, 0x2E, 0xD8, 0x50, 0x0C, 0xAD, 0xC9, 0xD2, 0x76, 0xE4,
-    0x08, 0x62, 0x99, 0x32, 0x7C, 0x23, 0xE1, 0x89, 0x4D, 0x42, 0x7A, 0x8F, 0xEC, 0x9A, 0xB2, 0x23,
-    0xAE, 0xD1, 0xE8, 0x4A, 0x45, 0xAB, 0xC9, 0x84, 0x46, 0xE3, 0x44, 0xEF, 0xEC, 0x84, 0x55, 0x7D,
-    0xCF, 0xEB, 0xAC, 0xFD, 0x22, 0x5B, 0xBC, 0xD7, 0x7D, 0xDE, 0x3B, 0x21, 0x4C, 0x2B, 0x0E, 0x68,
-    0xF9, 0xA2, 0x7F, 0x16, 0x90, 0x47, 0xB2, 0xCD, 0xE5, 0x2A, 0x4D, 0x1F, 0x19, 0x70, 0xC2, 0xF3,
-    0xC3, 0x0F, 0xB5, 0x7A, 0xFF, 0x4E, 0x19, 0xFD, 0xF9, 0x57, 0xC6, 0xFB, 0xCF, 0x4F, 0xB1, 0x9C,
-    0x86, 0xCE, 0x8F, 0x1F, 0xB5, 0xF0, 0xA9, 0xF6, 0x76, 0x62, 0x57, 0xE8, 0x33, 0x54, 0x88, 0xFF,
-    0xF8, 0x5D, 0xAE, 0x1E, 0xBE, 0x5F, 0x85, 0xE1, 0x03, 0x23, 0xC1, 0x7A, 0x65, 0x3A, 0x67, 0x43,
-    0x53, 0xA6, 0x16, 0xF2, 0xD9, 0x9C, 0xF2, 0x2F, 0x39, 0xBE, 0xE5, 0x96, 0xD1, 0x02, 0x95, 0x5C,
-    0xEB, 0xB3, 0xE0, 0xFC, 0x38, 0x57, 0xF0, 0x27, 0xB9, 0x94, 0xFC, 0x29, 0x49, 0xD1, 0xBF, 0x41,
-    0x52, 0xF6, 0xEF, 0x92, 0x14, 0xFE, 0xF7, 0x49, 0x4A, 0x7F, 0x2B, 0xC5, 0x3F, 0x50, 0xDA, 0x9E,
-    0xAB, 0xD2, 0xA7, 0x8C, 0xCA, 0xC4, 0x17, 0xB4, 0x83, 0xF0, 0x45, 0xF3, 0xE6, 0x7C, 0x8F, 0x7D,
-    0x4E, 0x76, 0xE0, 0x2C, 0x25, 0xA2, 0x2E, 0x98, 0x13, 0x57, 0xFA, 0x47, 0x30, 0xBD, 0x6D, 0x6E,
-    0xD8, 0x4C, 0x8B, 0xD7, 0x2E, 0xE4, 0x15, 0xCE, 0x98, 0x85, 0x06, 0x7B, 0x62, 0x65, 0x51, 0x03,
-    0xD7, 0x09, 0x6B, 0x56, 0xB0, 0x30, 0x8B, 0x4C, 0x7E, 0x31, 0x08, 0x6F, 0x32, 0x68, 0x1E, 0x3C,
-    0x4B, 0x67, 0x9C, 0x7B, 0x45, 0x81, 0x88, 0xD4, 0xA5, 0xE1, 0xDE, 0xC2, 0x0E, 0xEF, 0x82, 0x56,
-    0xBE, 0x26, 0x1C, 0x86, 0x7E, 0x53, 0x60, 0xE5, 0xA1, 0x50, 0x37, 0x15, 0x72, 0x10, 0x7B, 0x96,
-    0x12, 0x24, 0x0F, 0x1C, 0x91, 0xE0, 0x6B, 0x6D, 0xC6, 0x02, 0xA9, 0x28, 0x68, 0x96, 0xBE, 0x3A,
-    0x54, 0xAF, 0x4D, 0x95, 0xCE, 0xE6, 0x18, 0x58, 0xFF, 0x16, 0xED, 0xF8, 0x55, 0xAA, 0x77, 0x82,
-    0x3A, 0x83, 0xC0, 0x72, 0x76, 0x78, 0x39, 0x3B, 0x7C, 0x6B, 0x41, 0x64, 0xC3, 0x93, 0xCE, 0xE6,
-    0x69, 0x77, 0x31, 0xCC, 0xB7, 0x4E, 0x01, 0x8B, 0x84, 0x2F, 0xD9, 0x79, 0x0A, 0x5D, 0x00, 0xB0,
-    0xA5, 0xF9, 0x84, 0xF8, 0x35, 0xFF, 0x25, 0x48, 0xE1, 0x59, 0xFF, 0xE4, 0x69, 0x19, 0x49, 0x96,
-    0x9F, 0x59, 0x26, 0xDA, 0x3D, 0xEF, 0x72, 0x77, 0x6E, 0xF4, 0x10, 0xB8, 0xAB, 0x25, 0xD0, 0xC1,
-    0x9B, 0x7F, 0x71, 0x4F, 0x48, 0x02, 0xF3, 0x9C, 0x4F, 0x6F, 0xDE, 0x2A, 0x43, 0x7E, 0x57, 0xCF,
-    0xF5, 0x14, 0xA6, 0xB8, 0x48, 0xDB, 0xA4, 0x51, 0x36, 0xAA, 0x02, 0x73, 0xD9, 0x51, 0xEE, 0xE9,
-    0x8D, 0xA7, 0x03, 0x1C, 0xD4, 0x94, 0x8D, 0xEB, 0xB4, 0x2D, 0x2E, 0x2E, 0x3F, 0xD2, 0xCF, 0xA3,
-    0x6A, 0x75, 0xFD, 0xE4, 0xEA, 0x68, 0xA4, 0xEC, 0xE5, 0xE7, 0xC4, 0x0A, 0xF3, 0x37, 0xF3, 0x6F,
-    0x82, 0xCC, 0xFF, 0x00, 0xC5, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x27, 0xCE, 0x20,
+static const uint8_t notoserif_16_italicBitmaps[45168] = {
+    0xDD, 0x5A, 0x3D, 0xAC, 0xDC, 0x56, 0x7A, 0xBD, 0x24, 0x25, 0x4F, 0xB2, 0xC4, 0x9A, 0x2A, 0xD6,
+    0x09, 0x60, 0xC5, 0x62, 0xB3, 0x45, 0x60, 0xFD, 0xB0, 0x59, 0x24, 0x5B, 0xBC, 0x27, 0xD2, 0x49,
+    0x9F, 0x55, 0xB1, 0x42, 0x0A, 0x17, 0xAE, 0x83, 0x05, 0xA2, 0xC6, 0x85, 0x0A, 0xF9, 0x91, 0xC1,
+    0x96, 0x69, 0x14, 0x60, 0x91, 0x22, 0x0B, 0x24, 0x2E, 0x36, 0x45, 0xB4, 0x85, 0x5D, 0xA8, 0x50,
+    0x21, 0x0D, 0x69, 0xBB, 0x70, 0xE1, 0x62, 0x99, 0x0D, 0x16, 0x29, 0x5C, 0x88, 0x49, 0xB4, 0x08,
+    0x20, 0x01, 0x31, 0x83, 0x8C, 0xB2, 0x94, 0x4C, 0x0E, 0x73, 0xCE, 0xF9, 0x2E, 0xDF, 0xCC, 0x93,
+    0xE4, 0x9F, 0x20, 0x09, 0x82, 0x64, 0xAC, 0xB9, 0x33, 0x6F, 0x66, 0x78, 0xEF, 0xF7, 0x9D, 0xEF,
+    0x7C, 0xBF, 0xB4, 0x2B, 0x0B, 0x57, 0x3B, 0xFE, 0xDB, 0x3A, 0x37, 0x39, 0x37, 0xBA, 0x00, 0xFF,
+    0x06, 0x17, 0x6E, 0x5C, 0xD4, 0xBB, 0xA8, 0x73, 0x51, 0xEB, 0xA2, 0xC6, 0xAD, 0x1A, 0x17, 0x57,
+    0x2E, 0x2E, 0x5C, 0xE2, 0xDC, 0x69, 0xC7, 0xC7, 0x29, 0xE7, 0x4A, 0xE7, 0xE6, 0xC2, 0xCD, 0xCE,
+    0xAD, 0xDD, 0xEE, 0x81, 0xDF, 0xF0, 0xEF, 0x68, 0xE3, 0x5C, 0xD2, 0x3A, 0x97, 0xDB, 0x9F, 0xD8,
+    0xD4, 0x45, 0x83, 0x73, 0xAB, 0x1E, 0x1F, 0x77, 0xF6, 0x55, 0xD6, 0xE0, 0xEB, 0xCA, 0x7E, 0x92,
+    0x3B, 0x6D, 0xA7, 0xE7, 0xFA, 0x99, 0xE7, 0x11, 0x9E, 0x97, 0x9D, 0xFD, 0x26, 0xC3, 0x33, 0xC1,
+    0x35, 0x2B, 0x5C, 0x1F, 0xE0, 0x08, 0xF7, 0x9D, 0xBD, 0xA3, 0x5F, 0xC2, 0x13, 0x82, 0xBA, 0x10,
+    0x87, 0x40, 0x11, 0xE7, 0xDE, 0xF1, 0x57, 0xE9, 0xCA, 0xC2, 0x3F, 0xAB, 0xDD, 0x53, 0x27, 0xEF,
+    0x9D, 0x0E, 0x14, 0x08, 0x03, 0xAF, 0x0D, 0x47, 0xD3, 0x41, 0x02, 0xB7, 0xF6, 0xF3, 0xD2, 0xBE,
+    0x02, 0x2E, 0x2E, 0xAD, 0x6C, 0xF7, 0x42, 0x07, 0x27, 0x6D, 0xD6, 0xA7, 0xFD, 0xAA, 0x0F, 0xFA,
+    0xB0, 0x5D, 0x55, 0xF7, 0xDC, 0x4D, 0xF7, 0xCA, 0xD5, 0x22, 0x9F, 0xDB, 0x72, 0xC6, 0x95, 0x2E,
+    0x70, 0x69, 0x93, 0xF3, 0xBF, 0x62, 0x11, 0x34, 0xE4, 0xE7, 0xE9, 0xA3, 0x81, 0xBA, 0x09, 0xF3,
+    0x9C, 0x32, 0xE7, 0x05, 0xE0, 0xCE, 0xAA, 0xB8, 0xC5, 0x92, 0x34, 0x58, 0x70, 0x48, 0x56, 0x41,
+    0xE6, 0xAC, 0xC2, 0xA5, 0x79, 0x91, 0x53, 0xD8, 0x92, 0xD2, 0xD6, 0x5C, 0xD6, 0xBC, 0x1A, 0xCB,
+    0x3D, 0x2E, 0x23, 0x97, 0x01, 0x0B, 0xEC, 0x56, 0xD2, 0x6C, 0xB9, 0x8B, 0x1B, 0x48, 0x89, 0xAB,
+    0xE3, 0xA7, 0x38, 0x22, 0x98, 0x89, 0x89, 0x59, 0x8E, 0xD8, 0x65, 0x2D, 0x3E, 0xC2, 0x0F, 0xEE,
+    0x37, 0xC1, 0x36, 0xAB, 0x82, 0xE1, 0x45, 0x28, 0x4C, 0xA6, 0x2E, 0x4D, 0x17, 0x0E, 0x66, 0xBE,
+    0x05, 0x11, 0x3E, 0x63, 0x6F, 0x46, 0x6F, 0xCA, 0x57, 0xEA, 0x27, 0x50, 0x19, 0x7B, 0xEA, 0x11,
+    0xD4, 0xB8, 0x3A, 0x79, 0x5A, 0x57, 0xB0, 0x70, 0xDA, 0x62, 0xDB, 0xB8, 0x87, 0xA0, 0xB8, 0xEC,
+    0x06, 0x97, 0x6F, 0xE9, 0x62, 0x5D, 0x29, 0x24, 0x75, 0x34, 0xBE, 0xF2, 0x36, 0x5D, 0xE9, 0xF3,
+    0x62, 0xF9, 0x88, 0x92, 0xC7, 0xDC, 0xF7, 0x12, 0x7F, 0x75, 0x07, 0x66, 0x86, 0x7E, 0x89, 0x4B,
+    0x0A, 0x7C, 0x90, 0xDF, 0xBA, 0x35, 0x39, 0x1C, 0x3B, 0xBA, 0x92, 0x8B, 0x7F, 0xF0, 0xF0, 0x78,
+    0x5B, 0x03, 0xC3, 0x16, 0x64, 0xCB, 0x0B, 0x1C, 0x99, 0xD3, 0x6C, 0x97, 0x79, 0xF8, 0x29, 0x49,
+    0x2F, 0x16, 0x8A, 0x82, 0xD2, 0xF7, 0x37, 0x71, 0x6E, 0x34, 0x43, 0x94, 0xF0, 0x3D, 0x4A, 0x10,
+    0x6C, 0x9D, 0xFF, 0x42, 0xFC, 0x10, 0x4D, 0xF1, 0xEE, 0x34, 0x97, 0x4B, 0x44, 0x29, 0x27, 0x44,
+    0x79, 0x05, 0x4C, 0xD2, 0xA7, 0x75, 0xE7, 0x56, 0x33, 0x2F, 0x38, 0x6D, 0x06, 0x8E, 0x29, 0x7E,
+    0xC6, 0xA5, 0x6C, 0x9C, 0x60, 0x76, 0xD1, 0x7D, 0x2C, 0x09, 0x39, 0x74, 0xC8, 0xFD, 0x06, 0x5C,
+    0x1E, 0x76, 0x25, 0xD5, 0x82, 0xD9, 0x52, 0xDA, 0xEE, 0x80, 0x70, 0x6F, 0x80, 0x77, 0xD4, 0x02,
+    0xF0, 0xA4, 0x02, 0xE2, 0xD9, 0xD5, 0x3F, 0x7C, 0x72, 0x05, 0x6A, 0xCD, 0x9B, 0x57, 0xAE, 0xBE,
+    0xF9, 0xF8, 0x8A, 0xA1, 0xBE, 0x8F, 0x1C, 0x96, 0xD3, 0xF5, 0x13, 0x9C, 0x35, 0xC3, 0x0D, 0x57,
+    0xF3, 0x0C, 0x54, 0xFC, 0xD2, 0xBA, 0xD7, 0x5C, 0xD8, 0xB8, 0x0B, 0x2E, 0x68, 0xB0, 0x33, 0x1E,
+    0x6F, 0x73, 0x79, 0x9F, 0x0B, 0xF7, 0x70, 0xDC, 0x23, 0xE0, 0x55, 0x11, 0xA5, 0xC7, 0xCE, 0x83,
+    0x33, 0xCA, 0x9B, 0xD5, 0x65, 0x7E, 0x5B, 0xF4, 0xE7, 0x88, 0x4D, 0xF0, 0xED, 0x5D, 0x62, 0xB8,
+    0xE6, 0xB9, 0xE5, 0x43, 0x5C, 0x9B, 0xCE, 0xBC, 0xEA, 0x95, 0x9D, 0xFF, 0xD5, 0xF8, 0x3B, 0x7E,
+    0x32, 0x13, 0x24, 0x68, 0x39, 0xC1, 0xDD, 0xA0, 0x45, 0x6A, 0x98, 0x9B, 0xC4, 0x84, 0x3B, 0x13,
+    0x96, 0x6F, 0x7C, 0x1F, 0xF0, 0x64, 0xD8, 0xA5, 0x7E, 0x7C, 0xAD, 0x71, 0x75, 0x01, 0x7E, 0x4C,
+    0xDC, 0x7E, 0x22, 0xC7, 0xC6, 0xFD, 0xA5, 0xC7, 0x82, 0x2D, 0xEE, 0x52, 0xF3, 0xCB, 0x8E, 0x8E,
+    0x41, 0x9B, 0x24, 0x0F, 0xB7, 0xF4, 0x23, 0x0A, 0xFF, 0x2D, 0xA2, 0x02, 0x98, 0x9A, 0x64, 0x59,
+    0x8A, 0x73, 0xA4, 0xD4, 0x05, 0x87, 0x8B, 0xBE, 0x4B, 0xB7, 0x30, 0x9F, 0x75, 0x2B, 0x41, 0xD7,
+    0xF8, 0x60, 0x60, 0xA4, 0xBB, 0x4B, 0x24, 0xBE, 0xF4, 0x17, 0xE3, 0x89, 0x5F, 0xC4, 0x27, 0x7F,
+    0xE1, 0xD9, 0x4E, 0x24, 0x40, 0x04, 0x7A, 0x29, 0xBE, 0x5B, 0x73, 0x1F, 0x48, 0xDE, 0x05, 0x7E,
+    0xD1, 0x9F, 0xF8, 0x62, 0xE6, 0x45, 0x25, 0x02, 0x84, 0xCB, 0x3E, 0xEF, 0x28, 0x34, 0xE3, 0x11,
+    0x74, 0x08, 0x87, 0x74, 0x00, 0x42, 0xE1, 0x44, 0xCD, 0x66, 0x3A, 0x61, 0x49, 0x4E, 0xE4, 0x7B,
+    0x4B, 0xC9, 0x58, 0x98, 0x57, 0xB0, 0x42, 0xF2, 0xF8, 0x5A, 0x87, 0x13, 0xB7, 0xC5, 0x31, 0xE1,
+    0x18, 0xFA, 0x18, 0x51, 0xB2, 0xCF, 0x07, 0x5A, 0x6D, 0xA2, 0xAB, 0xE6, 0x4E, 0xA4, 0x17, 0xFD,
+    0x71, 0x72, 0x5E, 0xA4, 0x5C, 0xC0, 0xF7, 0xDC, 0x69, 0xC1, 0x9F, 0x35, 0x44, 0x0A, 0x67, 0x17,
+    0x6F, 0xD2, 0x2D, 0x90, 0x9C, 0x60, 0xE9, 0x6B, 0x7F, 0x46, 0x65, 0x43, 0x29, 0x2B, 0x47, 0xEC,
+    0x8D, 0x6B, 0x67, 0xE8, 0xA5, 0xB7, 0x09, 0xC7, 0x48, 0x38, 0xEA, 0x37, 0x7B, 0xCA, 0x4D, 0x3B,
+    0x5E, 0xE1, 0xE1, 0x43, 0x38, 0x45, 0x53, 0x34, 0x22, 0xEC, 0x3D, 0xF3, 0x38, 0x05, 0xB1, 0xE7,
+    0x62, 0xB6, 0xFC, 0x80, 0xB0, 0x0D, 0xA7, 0xC8, 0xF1, 0xAF, 0x71, 0xBF, 0xEE, 0xBE, 0xE4, 0x81,
+    0x53, 0x93, 0xC1, 0xC5, 0xA3, 0x04, 0xD9, 0x90, 0xB1, 0x61, 0xCB, 0xC0, 0xFF, 0xED, 0x25, 0x78,
+    0x6E, 0x80, 0xF5, 0x4C, 0x92, 0xC1, 0x7B, 0x92, 0xE6, 0x2E, 0x24, 0x3C, 0x38, 0x8E, 0x44, 0xA9,
+    0x4F, 0x2A, 0x6B, 0x0B, 0x58, 0x38, 0x11, 0xA8, 0x32, 0x89, 0x31, 0x8B, 0xB9, 0x88, 0xA9, 0xA3,
+    0x60, 0x48, 0xDE, 0x3D, 0xF8, 0x6B, 0x3A, 0x6A, 0x59, 0x79, 0x83, 0x7B, 0x9B, 0x12, 0x00, 0xED,
+    0x01, 0x43, 0x69, 0x4D, 0xE4, 0x1F, 0x87, 0x5A, 0xAF, 0x6B, 0xED, 0xE9, 0x1D, 0x61, 0xC7, 0x35,
+    0xA2, 0x27, 0x23, 0xF9, 0x31, 0x66, 0xA4, 0x0A, 0xA3, 0x87, 0xDA, 0xED, 0xBA, 0x56, 0x06, 0x77,
+    0x17, 0x3E, 0xBD, 0x85, 0x78, 0x18, 0x81, 0x9F, 0x15, 0x83, 0x17, 0xCC, 0x90, 0x4A, 0xDE, 0x03,
+    0x11, 0xEA, 0x8E, 0xE4, 0x57, 0xB6, 0x89, 0x94, 0x24, 0xDF, 0x7A, 0x82, 0x28, 0xFA, 0x04, 0x64,
+    0x66, 0x70, 0xC9, 0xE6, 0x2D, 0xD0, 0x3D, 0x3F, 0xCF, 0x16, 0x98, 0x11, 0xDA, 0x60, 0x08, 0x38,
+    0x22, 0x63, 0x45, 0x47, 0xDF, 0x4C, 0x7A, 0xCA, 0x8A, 0xF7, 0x30, 0x1C, 0xF6, 0x01, 0x86, 0xD8,
+    0x1F, 0x2B, 0x83, 0xCC, 0xE3, 0x37, 0x21, 0x7F, 0xA2, 0xD8, 0x9C, 0xFC, 0x92, 0xEF, 0xD3, 0x86,
+    0x01, 0x2E, 0x23, 0x05, 0xE8, 0x8E, 0x25, 0x79, 0xAB, 0x7F, 0x8E, 0xEF, 0x4B, 0xE7, 0x2B, 0x82,
+    0x99, 0x6C, 0x02, 0x7C, 0xC1, 0x04, 0x92, 0xB8, 0xB3, 0xDB, 0x5B, 0x20, 0x59, 0x3D, 0xCF, 0x4F,
+    0xF6, 0x92, 0xFD, 0x4C, 0x94, 0xEA, 0x47, 0x5B, 0x85, 0x10, 0xF0, 0x1F, 0x22, 0xE5, 0xCB, 0x86,
+    0x5B, 0x46, 0xEC, 0x48, 0x40, 0xAD, 0x04, 0x66, 0xA2, 0xD8, 0xA3, 0xC0, 0x6B, 0x91, 0x97, 0x54,
+    0x58, 0xA2, 0xEB, 0xB2, 0x8A, 0xD2, 0x65, 0xB1, 0x7B, 0xEF, 0xD7, 0x6A, 0xB9, 0xAA, 0x92, 0xAE,
+    0x50, 0x6E, 0x22, 0x2B, 0x03, 0x83, 0x24, 0x93, 0x20, 0xEE, 0xFB, 0xFA, 0xD1, 0x3C, 0xFF, 0xC4,
+    0x09, 0x2C, 0xFA, 0x17, 0xE3, 0x50, 0x27, 0x37, 0xA6, 0x10, 0xC1, 0x68, 0xF9, 0x6C, 0x54, 0x78,
+    0xA3, 0x75, 0x6B, 0xE3, 0x7A, 0x6D, 0x6C, 0xDF, 0xBD, 0xD0, 0xD1, 0x6B, 0xE3, 0x94, 0x7F, 0x99,
+    0x8D, 0x5D, 0x86, 0x1C, 0x30, 0x21, 0x74, 0xDC, 0x08, 0x02, 0x72, 0x23, 0x80, 0x87, 0x20, 0x46,
+    0xF4, 0x52, 0xBB, 0x34, 0xD7, 0x8F, 0x03, 0x5C, 0x86, 0x1F, 0x9F, 0xC5, 0x2F, 0xCE, 0xCE, 0x3F,
+    0xA5, 0x9B, 0x02, 0xC2, 0xC1, 0xCB, 0x89, 0xAC, 0x7C, 0x5E, 0x2B, 0x7E, 0x81, 0xA4, 0x06, 0x21,
+    0xC3, 0x8E, 0x02, 0x82, 0xF0, 0xD8, 0x19, 0x11, 0xDC, 0xF8, 0x27, 0x67, 0x34, 0x6F, 0xF4, 0x6B,
+    0xFC, 0xF8, 0x6A, 0xE1, 0x2C, 0xDC, 0xC3, 0xA6, 0x7C, 0xAF, 0xD8, 0xEA, 0x61, 0xCD, 0xF6, 0xA0,
+    0x34, 0x4A, 0x43, 0xAA, 0x6F, 0x4A, 0xA8, 0x8B, 0x52, 0xE0, 0xC0, 0xD7, 0x7A, 0xB0, 0xE9, 0x7B,
+    0x03, 0x05, 0x22, 0x7C, 0xFB, 0xF2, 0xB8, 0xAF, 0x21, 0x4F, 0xB4, 0x2F, 0x8F, 0x8C, 0x9A, 0x3C,
+    0xBD, 0x55, 0x39, 0xCB, 0x3F, 0x5F, 0x2D, 0xCF, 0x92, 0x60, 0x2D, 0xCF, 0x58, 0xC6, 0x3D, 0x3B,
+    0xFF, 0x88, 0x1F, 0xEF, 0x32, 0xB9, 0x42, 0xDB, 0x24, 0x8E, 0x81, 0xBE, 0x2B, 0x54, 0x4A, 0x3D,
+    0x39, 0x06, 0x06, 0x80, 0x22, 0x80, 0x9B, 0xC4, 0xAB, 0x9E, 0xE7, 0x18, 0x53, 0xE3, 0x17, 0x70,
+    0x2C, 0x9B, 0x7B, 0x08, 0x72, 0x76, 0xBE, 0x89, 0x0D, 0x70, 0x28, 0xDE, 0x43, 0x3F, 0x7A, 0xE7,
+    0xC8, 0x6F, 0x99, 0x76, 0x1B, 0xF9, 0x50, 0x4F, 0xFD, 0x56, 0x4A, 0x3D, 0xC1, 0xFC, 0xB0, 0x66,
+    0xCD, 0xA7, 0x98, 0x6B, 0x09, 0x2F, 0x9B, 0xC7, 0x80, 0x0E, 0x75, 0x7E, 0x7E, 0x10, 0xD4, 0xDB,
+    0x4A, 0x4A, 0x24, 0xBE, 0xEC, 0x24, 0x57, 0x48, 0x32, 0x66, 0x89, 0x70, 0x30, 0x24, 0x14, 0x8B,
+    0x2A, 0x43, 0x8E, 0xA2, 0x10, 0x35, 0xE2, 0xB1, 0x32, 0xC6, 0xD0, 0x9E, 0x57, 0x89, 0x06, 0xB3,
+    0x17, 0x91, 0x80, 0x4D, 0xAF, 0x4E, 0x3E, 0x63, 0x4E, 0xA6, 0x0A, 0xB7, 0x5C, 0x28, 0xB7, 0x70,
+    0x8E, 0x68, 0xCA, 0x18, 0xA5, 0x37, 0x87, 0xE7, 0x2F, 0xC5, 0x21, 0x19, 0x89, 0x2A, 0xFD, 0x0D,
+    0xEA, 0x06, 0xAC, 0x14, 0xEA, 0xB9, 0x5F, 0xCD, 0x96, 0x75, 0x46, 0xCA, 0x7E, 0x5C, 0xEE, 0x7E,
+    0x9D, 0x22, 0x8F, 0xB2, 0x10, 0xD2, 0xAC, 0x7A, 0x61, 0xD5, 0xCC, 0xB3, 0x70, 0x0E, 0xCF, 0x50,
+    0x64, 0xC0, 0x9F, 0xDF, 0x50, 0xAC, 0x60, 0x60, 0x35, 0x83, 0xD7, 0xCF, 0x96, 0x15, 0x76, 0xB0,
+    0xCF, 0x38, 0x27, 0xD3, 0xCE, 0x33, 0xC5, 0x8E, 0x52, 0xAE, 0xD5, 0x0F, 0xCD, 0xAE, 0x20, 0x5B,
+    0xF8, 0xA4, 0xDD, 0xD7, 0x27, 0x76, 0xDF, 0xDB, 0xD8, 0x67, 0x31, 0xF7, 0x7A, 0x4D, 0xA9, 0xBD,
+    0xEF, 0x8D, 0x91, 0xC8, 0xFE, 0x40, 0x35, 0xC4, 0x76, 0x01, 0x22, 0xB4, 0x18, 0x11, 0x9B, 0xE9,
+    0x32, 0x13, 0xEB, 0xAE, 0x04, 0x0B, 0x4D, 0x2A, 0x76, 0x1F, 0x78, 0xB9, 0x6C, 0xAC, 0x17, 0xF3,
+    0x92, 0xBF, 0x93, 0x3A, 0xC9, 0xFD, 0x59, 0xDC, 0x1B, 0xA5, 0x66, 0xD6, 0x49, 0x46, 0xD4, 0xEE,
+    0x92, 0xB7, 0x10, 0x25, 0x73, 0x23, 0x49, 0xC9, 0x78, 0x4A, 0x38, 0xA4, 0xF3, 0x56, 0x41, 0x32,
+    0xB0, 0x50, 0x21, 0x04, 0x5B, 0x81, 0x98, 0xF6, 0x66, 0x27, 0x33, 0x94, 0x69, 0xB6, 0x83, 0x6C,
+    0xFC, 0x6A, 0xC8, 0xDA, 0x13, 0x90, 0x65, 0xFB, 0x90, 0xBD, 0x4C, 0xC8, 0x5E, 0xA3, 0x41, 0x0E,
+    0xB8, 0xF1, 0x0D, 0x86, 0xB3, 0x51, 0xD1, 0xC0, 0x82, 0x41, 0xC6, 0x64, 0xB1, 0x12, 0x42, 0xCC,
+    0x1A, 0xF3, 0xBB, 0x08, 0x7F, 0x34, 0x3D, 0x4F, 0xA5, 0x77, 0x97, 0x24, 0xD7, 0x23, 0x1C, 0xF5,
+    0x2B, 0xBC, 0x09, 0x3F, 0x45, 0x90, 0xF8, 0x67, 0xBC, 0x89, 0x3E, 0x86, 0xD7, 0x7C, 0xD2, 0xD9,
+    0x9B, 0xF8, 0x7B, 0x4C, 0xBA, 0x1F, 0x21, 0x99, 0xD3, 0x76, 0xAB, 0x1F, 0x6E, 0xDC, 0x45, 0x0A,
+    0x13, 0xFF, 0xFE, 0xC6, 0x5D, 0x67, 0xD1, 0x9F, 0x00, 0xE0, 0x3E, 0xB3, 0x37, 0x41, 0x47, 0xC1,
+    0xCE, 0x05, 0x63, 0xD4, 0xE4, 0x2A, 0xF4, 0xC7, 0x98, 0x9D, 0x0E, 0xA2, 0xD5, 0x98, 0xC8, 0xAE,
+    0x28, 0x8F, 0x2F, 0xCA, 0xAC, 0x78, 0x73, 0x5D, 0x28, 0x5C, 0x77, 0xEB, 0x5E, 0x6F, 0x6E, 0xBB,
+    0xB2, 0x13, 0x24, 0x88, 0x09, 0x8D, 0x0C, 0xAE, 0x56, 0x8A, 0xF1, 0x76, 0x42, 0xCF, 0x94, 0xC1,
+    0x69, 0xEB, 0xB9, 0x39, 0xE4, 0x02, 0x05, 0x26, 0x3A, 0x41, 0x01, 0xB5, 0x9C, 0x7B, 0x8F, 0x88,
+    0xB2, 0x72, 0x26, 0x4E, 0x8C, 0x2E, 0x15, 0x2B, 0xB9, 0x56, 0x1D, 0x6C, 0x78, 0xBF, 0x63, 0x8E,
+    0x96, 0x22, 0x09, 0x41, 0xFE, 0x68, 0xD0, 0xEB, 0xEA, 0xC3, 0xD1, 0x9D, 0xE3, 0x6B, 0x35, 0x31,
+    0x94, 0x2A, 0xE1, 0xB3, 0xC0, 0x4E, 0x10, 0x8F, 0xEC, 0x35, 0x6F, 0xF8, 0x7A, 0x0E, 0xC0, 0x5F,
+    0x97, 0x26, 0x49, 0x77, 0x5B, 0x8A, 0xC4, 0x7D, 0x2F, 0xF1, 0xA3, 0xC1, 0x5E, 0xC3, 0xA9, 0x93,
+    0x16, 0x4E, 0x35, 0xEC, 0x6D, 0x83, 0x95, 0xF9, 0x5F, 0x4D, 0x43, 0x6F, 0x71, 0x0B, 0x1A, 0xA8,
+    0x41, 0xA2, 0xEC, 0xC9, 0xAE, 0xDE, 0x04, 0x4B, 0x78, 0xD1, 0xFC, 0x68, 0x52, 0xDE, 0x85, 0x83,
+    0xC1, 0xC2, 0x49, 0xAB, 0x64, 0xCF, 0x12, 0x1A, 0x4C, 0x88, 0xD4, 0xBF, 0x32, 0x26, 0x46, 0x03,
+    0x39, 0x87, 0x95, 0x76, 0x19, 0x32, 0x05, 0x23, 0xEE, 0xBD, 0xDA, 0x28, 0x10, 0x69, 0x8D, 0x19,
+    0x13, 0x21, 0x2A, 0xF3, 0x6E, 0xDA, 0xCA, 0xB9, 0xD5, 0xAE, 0x96, 0x45, 0xAE, 0xD8, 0x06, 0xC3,
+    0x85, 0xAA, 0x34, 0xB0, 0x3D, 0xF8, 0xC6, 0x68, 0x34, 0xFF, 0x85, 0xE5, 0xDD, 0x07, 0x7B, 0x79,
+    0x97, 0x81, 0xF0, 0xBC, 0xF5, 0x61, 0x13, 0xD3, 0x25, 0x3B, 0x5B, 0x05, 0x2E, 0x7F, 0x7D, 0xAB,
+    0x1A, 0xA5, 0xDD, 0xD5, 0x28, 0xE9, 0x52, 0xA9, 0x80, 0xB5, 0x38, 0x09, 0x1F, 0xCE, 0xE4, 0x2D,
+    0xC2, 0x2E, 0xA2, 0xAD, 0x4A, 0xDA, 0x87, 0x7F, 0xFD, 0x5F, 0xCD, 0x1F, 0xFF, 0xFB, 0x58, 0xB9,
+    0x7D, 0xAC, 0x02, 0xC5, 0x0A, 0x0B, 0x80, 0x26, 0xBA, 0x90, 0x3A, 0xAE, 0x79, 0xDA, 0x42, 0xD1,
+    0x53, 0x49, 0xEB, 0x8F, 0x0C, 0xD5, 0xFD, 0xCA, 0x8F, 0xC1, 0xF4, 0x99, 0xCA, 0xAF, 0xDB, 0xAB,
+    0xFC, 0x3A, 0x46, 0xBB, 0xA4, 0xD9, 0xA1, 0xCA, 0xDA, 0xA5, 0x5B, 0x59, 0xFD, 0x87, 0x4B, 0xD3,
+    0x87, 0xB3, 0xE2, 0x41, 0x69, 0xA1, 0x49, 0xF3, 0x0F, 0x2A, 0xA8, 0x86, 0x00, 0x98, 0x58, 0xB9,
+    0x43, 0x10, 0xB6, 0x4A, 0x20, 0x5B, 0xEE, 0x0D, 0x54, 0xC3, 0x6D, 0x41, 0x54, 0xAF, 0x35, 0x4B,
+    0xAB, 0xC7, 0x04, 0xC3, 0xDE, 0x31, 0xAB, 0x62, 0x16, 0x99, 0x38, 0xFB, 0x1E, 0x67, 0x18, 0x28,
+    0x16, 0x6F, 0xEE, 0xB5, 0x90, 0x0C, 0xB8, 0xAE, 0x54, 0x3F, 0x3C, 0x48, 0xAD, 0x6A, 0x19, 0x45,
+    0x28, 0x92, 0xAC, 0xB6, 0xC7, 0xEA, 0x97, 0xC5, 0x05, 0xCA, 0x72, 0x77, 0x59, 0xE8, 0xF5, 0x6C,
+    0x78, 0x48, 0x9E, 0xC7, 0x6F, 0xA1, 0x05, 0x50, 0xDA, 0x3A, 0x6D, 0x45, 0x0F, 0x54, 0x49, 0xB9,
+    0x16, 0x19, 0x1A, 0xCD, 0xB4, 0x38, 0x64, 0x8F, 0x03, 0x97, 0x82, 0xF8, 0x68, 0x74, 0x6B, 0x04,
+    0xB7, 0x65, 0x24, 0x65, 0x28, 0x8B, 0x0D, 0x0A, 0x11, 0xBE, 0xC7, 0xFD, 0x8A, 0x2A, 0xC6, 0x56,
+    0x95, 0x10, 0x56, 0xC5, 0xA4, 0xFB, 0x55, 0x0C, 0xD7, 0xDF, 0x98, 0x7F, 0xC9, 0xB7, 0xB2, 0x49,
+    0x3E, 0xF7, 0xE8, 0x9E, 0xB2, 0xF9, 0xDD, 0xB0, 0x1E, 0xC8, 0xA4, 0x94, 0x53, 0x01, 0x94, 0xF6,
+    0x0C, 0x45, 0x87, 0x3A, 0xF0, 0x86, 0x0E, 0xEF, 0x55, 0x48, 0xA9, 0xA8, 0x8A, 0x94, 0xD5, 0xE3,
+    0x8A, 0x6B, 0x22, 0x61, 0x0F, 0xB5, 0xDE, 0x10, 0xB3, 0x95, 0xCF, 0x35, 0xF5, 0xC8, 0x23, 0xE5,
+    0x8E, 0x58, 0x91, 0xFB, 0x7B, 0x3A, 0xFD, 0x8F, 0x25, 0xC9, 0x0D, 0x49, 0x25, 0xF9, 0xD3, 0x7E,
+    0x27, 0xAD, 0x72, 0x13, 0x0A, 0x1C, 0xF7, 0x0D, 0x67, 0x22, 0x01, 0xC7, 0xC0, 0xA4, 0x2A, 0x19,
+    0x48, 0x28, 0x0C, 0x1B, 0x77, 0x4A, 0x15, 0xE0, 0xCD, 0x21, 0x45, 0x8A, 0xF0, 0x46, 0x12, 0xAE,
+    0xD0, 0x9D, 0x6C, 0xC4, 0xAB, 0xAC, 0xE2, 0xF1, 0xA3, 0x7B, 0x39, 0xAB, 0xD8, 0x39, 0x4D, 0xEE,
+    0x42, 0xD6, 0xAC, 0x24, 0xF3, 0x77, 0xD3, 0x86, 0x71, 0x68, 0x72, 0xEF, 0xA7, 0x4D, 0x2A, 0x2B,
+    0x77, 0x69, 0x43, 0xE1, 0xB7, 0x61, 0x9B, 0x34, 0x14, 0x6B, 0x1D, 0x35, 0x49, 0xA3, 0xEC, 0x16,
+    0x17, 0xC9, 0x07, 0xAA, 0x49, 0x12, 0x97, 0xFC, 0x5C, 0xE3, 0x90, 0x8B, 0x48, 0x95, 0xD4, 0xA8,
+    0x44, 0xBF, 0xF6, 0xA9, 0xA8, 0xF1, 0xB6, 0x8B, 0xEF, 0x4B, 0x2F, 0xE4, 0x8B, 0xC9, 0xF8, 0xCF,
+    0xCE, 0xCF, 0xCA, 0x36, 0xAB, 0xE8, 0x40, 0x52, 0xB3, 0x4E, 0x32, 0x0F, 0xCC, 0x48, 0x67, 0xE7,
+    0x07, 0xAB, 0xD9, 0xCA, 0xF1, 0x49, 0xC4, 0x51, 0xA7, 0x96, 0x37, 0x91, 0x68, 0x26, 0xF1, 0x60,
+    0xC2, 0xCB, 0x56, 0x0C, 0xDE, 0x91, 0x71, 0xFF, 0x5D, 0x16, 0x8D, 0xCC, 0xA9, 0x42, 0x73, 0x37,
+    0xEF, 0x7B, 0xDE, 0xF9, 0x22, 0xB5, 0x0A, 0x2E, 0xB1, 0x62, 0xF1, 0xD0, 0x2A, 0xC7, 0x8D, 0x98,
+    0x10, 0x75, 0xB1, 0xF2, 0x6A, 0x25, 0x71, 0x7C, 0x47, 0x73, 0x57, 0x86, 0x85, 0x89, 0x19, 0x77,
+    0xD2, 0xC9, 0x17, 0x3E, 0x05, 0xB8, 0x00, 0x3E, 0x74, 0xE9, 0xDC, 0x65, 0xDB, 0x9B, 0xAF, 0xCE,
+    0x37, 0xE9, 0x78, 0x6A, 0xC7, 0x01, 0x6C, 0x68, 0xD6, 0x9F, 0x64, 0xFD, 0xAD, 0xEC, 0x5E, 0x2B,
+    0x87, 0xE4, 0xC5, 0x75, 0xF1, 0x8A, 0xA7, 0xA4, 0x1F, 0xF1, 0xE4, 0xE4, 0x13, 0x29, 0xF1, 0x2F,
+    0x12, 0x7E, 0x7C, 0x8E, 0xA5, 0xFD, 0x97, 0xB1, 0x54, 0x1A, 0xBC, 0x24, 0x7E, 0xA2, 0xA0, 0xD7,
+    0xE7, 0xAA, 0xE8, 0xF3, 0x99, 0xCD, 0xC2, 0x65, 0xFD, 0xE0, 0x40, 0x6A, 0xBF, 0xAD, 0xD6, 0xF8,
+    0x7D, 0x1B, 0xFE, 0x78, 0x1E, 0x99, 0xFE, 0xBA, 0x2C, 0x94, 0x3D, 0xFC, 0x97, 0xDD, 0x0B, 0xBF,
+    0x8C, 0x37, 0x2F, 0xF8, 0xF2, 0x35, 0x7D, 0x79, 0x41, 0x5F, 0x1E, 0xE8, 0xCB, 0xC1, 0xE5, 0x0F,
+    0x6F, 0xFD, 0x74, 0xC3, 0x11, 0x9D, 0x7C, 0xDF, 0xAC, 0xF0, 0x73, 0x44, 0xE2, 0x5F, 0x20, 0x20,
+    0xC0, 0xCB, 0x39, 0x27, 0xCA, 0xAD, 0x5B, 0x85, 0x42, 0x6B, 0x6A, 0x32, 0xD1, 0xDD, 0x54, 0x98,
+    0x8F, 0xF8, 0x34, 0xE0, 0x02, 0x18, 0x6B, 0x3A, 0x6D, 0xED, 0x14, 0x72, 0xCE, 0x72, 0xF9, 0x5D,
+    0x28, 0xF6, 0x27, 0xFF, 0xD4, 0x9F, 0xC9, 0xE6, 0x1F, 0xCE, 0x7D, 0x3C, 0x85, 0x30, 0xE3, 0x15,
+    0x77, 0xC6, 0x39, 0x76, 0x44, 0x91, 0x32, 0x6A, 0xDE, 0x7C, 0x71, 0x15, 0x04, 0xF6, 0x90, 0x75,
+    0xEB, 0x1C, 0x97, 0x4D, 0xB7, 0xF1, 0xCB, 0x6D, 0x93, 0x72, 0x4A, 0x93, 0xB0, 0x3F, 0x4E, 0x5A,
+    0xA5, 0x2C, 0xC6, 0xD6, 0x06, 0xF0, 0xA7, 0x8D, 0x62, 0xEA, 0x8A, 0x03, 0x15, 0xC4, 0x09, 0x2F,
+    0x29, 0x42, 0x2D, 0xB3, 0x1B, 0xE3, 0x7C, 0xC5, 0x1C, 0xF6, 0x00, 0x7E, 0x76, 0xC8, 0x39, 0x98,
+    0x9F, 0xB5, 0xCA, 0x16, 0x88, 0x92, 0x3F, 0x1E, 0xDC, 0x84, 0xEA, 0x66, 0x83, 0xC2, 0xA6, 0x77,
+    0xC3, 0xB3, 0xD3, 0xEF, 0xA5, 0x8A, 0x5E, 0x9E, 0xA5, 0xF8, 0x10, 0x54, 0x59, 0x1B, 0x17, 0x31,
+    0x8C, 0xA8, 0xF9, 0x92, 0x6D, 0x78, 0x95, 0x13, 0x17, 0xA1, 0x98, 0x9E, 0x2C, 0xF9, 0xE2, 0xE3,
+    0x2A, 0x19, 0x4B, 0x38, 0x7F, 0xF6, 0xDF, 0x8F, 0xEE, 0xF6, 0x18, 0xDD, 0x65, 0xE2, 0x94, 0xFD,
+    0x18, 0x25, 0x58, 0x34, 0xA0, 0x36, 0x86, 0x5A, 0x21, 0xD4, 0x8A, 0x36, 0x59, 0x83, 0xFC, 0x58,
+    0x65, 0x4D, 0xFE, 0xE7, 0x5B, 0xD8, 0x1B, 0xF9, 0xE7, 0xCA, 0xD7, 0x52, 0xEB, 0xA5, 0xBF, 0xB1,
+    0x0A, 0x82, 0xD6, 0x99, 0xA8, 0x45, 0x30, 0xB0, 0x06, 0x8F, 0x7A, 0x16, 0x63, 0x9E, 0xFC, 0xDD,
+    0xF1, 0x70, 0x35, 0xB8, 0xA6, 0xA1, 0xAA, 0x4D, 0x9B, 0x3D, 0xF9, 0x6D, 0x3E, 0xB0, 0x57, 0x22,
+    0xEC, 0x17, 0x0A, 0xCF, 0x65, 0x03, 0x9F, 0x13, 0x44, 0xEE, 0xF0, 0x0B, 0xB2, 0xC1, 0xDE, 0x81,
+    0x06, 0xAC, 0x5F, 0x7D, 0x1E, 0xD0, 0x36, 0xF7, 0xB8, 0xFC, 0x40, 0x1B, 0x94, 0xC7, 0xE3, 0xAF,
+    0xA0, 0x58, 0x3A, 0xD1, 0x74, 0x66, 0xA1, 0xBC, 0x7E, 0xAB, 0x43, 0xFF, 0xBC, 0xE1, 0xDE, 0xAB,
+    0x4E, 0xC3, 0x9D, 0x66, 0xB7, 0xA6, 0x15, 0xCF, 0x49, 0x39, 0xF6, 0xC7, 0xAA, 0xC2, 0xB8, 0x2D,
+    0x15, 0x91, 0x34, 0x93, 0x7D, 0x58, 0x68, 0xA0, 0xE4, 0x54, 0x33, 0xF2, 0x71, 0x64, 0x2A, 0xAA,
+    0x96, 0x48, 0xE5, 0xE0, 0xEB, 0x1A, 0xB0, 0xF1, 0xAE, 0x01, 0x47, 0xA3, 0x94, 0xF1, 0xF2, 0xDE,
+    0x9A, 0x6B, 0x92, 0x9E, 0x91, 0x08, 0x2E, 0xD9, 0x72, 0xB8, 0x8D, 0x7E, 0x95, 0x13, 0x30, 0x7A,
+    0xC8, 0x4A, 0x00, 0x96, 0x27, 0x5D, 0x42, 0xCB, 0xD1, 0xB1, 0x72, 0x13, 0xC3, 0xF1, 0x98, 0xC3,
+    0x5A, 0x23, 0x0A, 0x9F, 0xE0, 0x73, 0x14, 0x0D, 0x21, 0x87, 0x6F, 0x11, 0xEF, 0x5A, 0x2C, 0x83,
+    0xC6, 0x23, 0x72, 0x70, 0x4D, 0x21, 0x26, 0x73, 0x09, 0x78, 0x10, 0xFC, 0xA2, 0x02, 0xC0, 0x19,
+    0x47, 0xD9, 0x9E, 0x83, 0xE1, 0x70, 0x26, 0x67, 0xFE, 0xC7, 0xEE, 0x9C, 0x60, 0xF1, 0x1E, 0xD2,
+    0x19, 0x37, 0x06, 0x13, 0x6A, 0xA2, 0xDB, 0xBE, 0xAE, 0xE8, 0xAF, 0xF5, 0x71, 0x1F, 0x77, 0x31,
+    0xB2, 0x49, 0x02, 0x67, 0x64, 0x8D, 0x92, 0x6B, 0xFC, 0xC9, 0x7B, 0x1D, 0xEB, 0x53, 0xE5, 0x94,
+    0x75, 0x1A, 0xDE, 0x15, 0xBE, 0x4F, 0xF5, 0xCF, 0xB0, 0x3D, 0x31, 0x42, 0x0C, 0xA1, 0x58, 0x50,
+    0xFB, 0x7E, 0x95, 0x98, 0x66, 0xC5, 0xEE, 0x4E, 0xD0, 0x72, 0x8F, 0xE9, 0x9E, 0xA7, 0xC1, 0x7E,
+    0xFB, 0xBB, 0x31, 0x0A, 0x98, 0xA9, 0xCC, 0xF8, 0x34, 0x7A, 0xB2, 0xB4, 0xBD, 0x76, 0x19, 0x0D,
+    0x4E, 0x73, 0x7F, 0x7D, 0x10, 0x03, 0x14, 0x4F, 0x63, 0x30, 0x3F, 0x90, 0xAB, 0x01, 0x15, 0xDE,
+    0x60, 0xE3, 0x9D, 0xB5, 0x1E, 0xE9, 0x2A, 0xEA, 0xDF, 0xC1, 0x2E, 0xFF, 0x80, 0xA3, 0xE3, 0x4F,
+    0x21, 0x47, 0xFC, 0x19, 0x67, 0x07, 0x1B, 0xDA, 0x8B, 0xCD, 0x50, 0x5A, 0x71, 0x68, 0x51, 0x69,
+    0x7C, 0x9B, 0xE8, 0xBE, 0x8E, 0x6E, 0x66, 0x4C, 0xDC, 0xBD, 0x16, 0x13, 0xDD, 0xE9, 0xAB, 0xD9,
+    0x1C, 0x70, 0xEE, 0xCB, 0x33, 0x86, 0x10, 0xFE, 0x18, 0xF5, 0x51, 0xBF, 0xDA, 0x03, 0x31, 0x7B,
+    0x31, 0x88, 0xE6, 0x27, 0x23, 0x2C, 0x0C, 0xAC, 0xCE, 0xC3, 0xC8, 0xEC, 0x89, 0x43, 0xD8, 0xF9,
+    0x0F, 0x60, 0xD3, 0xF0, 0x69, 0x95, 0x5F, 0x07, 0x20, 0xB4, 0x36, 0x59, 0x4B, 0x83, 0x93, 0xB1,
+    0xB4, 0x39, 0xEF, 0xA8, 0x28, 0xA0, 0xC0, 0xEC, 0x8B, 0xE5, 0x13, 0x6F, 0x7C, 0x6F, 0x7F, 0x4F,
+    0x81, 0x66, 0x61, 0x81, 0x11, 0x21, 0xE3, 0x64, 0x10, 0x9B, 0x6A, 0xD8, 0x18, 0x31, 0xBC, 0xD8,
+    0x6B, 0x36, 0x43, 0xB6, 0x48, 0x83, 0x5F, 0x7B, 0x14, 0x7B, 0xC2, 0x51, 0x32, 0x89, 0x55, 0x50,
+    0xA6, 0x2F, 0xA6, 0x5F, 0xF2, 0x9F, 0xA7, 0x9F, 0x0D, 0x9C, 0xD9, 0x21, 0xE4, 0x8F, 0x46, 0x46,
+    0x88, 0x35, 0x39, 0x90, 0xAB, 0x1F, 0xD1, 0xDC, 0xBC, 0xE2, 0xB4, 0x9C, 0x26, 0xC8, 0x75, 0x13,
+    0xAE, 0xE2, 0xFD, 0x37, 0x0E, 0x79, 0x4B, 0x9B, 0x91, 0xD6, 0xAA, 0xC9, 0x6D, 0x84, 0x44, 0x35,
+    0x1A, 0xC8, 0x90, 0x3C, 0x46, 0xD9, 0x1B, 0xCE, 0x27, 0x92, 0x00, 0x6A, 0x8F, 0xB9, 0x0A, 0xEB,
+    0x8F, 0x81, 0x6F, 0xF6, 0x97, 0x20, 0x6C, 0x76, 0x1B, 0xB2, 0x67, 0x1D, 0xC5, 0x6A, 0x34, 0x79,
+    0x0A, 0x49, 0x8C, 0x70, 0xB0, 0xF3, 0xFD, 0x4D, 0x90, 0x15, 0x1B, 0xDC, 0x98, 0xCD, 0x6D, 0xC2,
+    0xC6, 0x16, 0xC5, 0x98, 0x6E, 0xEE, 0xF5, 0x2C, 0xDA, 0x26, 0x04, 0x68, 0x8D, 0x72, 0xE2, 0xF6,
+    0xCA, 0xF3, 0x23, 0x92, 0xEA, 0x38, 0xD3, 0x3D, 0x10, 0x88, 0x7B, 0x8E, 0xF1, 0xE8, 0xAB, 0x13,
+    0xC3, 0xF4, 0x7C, 0x62, 0x58, 0x6D, 0xAC, 0x2D, 0xD8, 0x4F, 0x0C, 0x7F, 0x8F, 0xBC, 0x36, 0xFF,
+    0x29, 0xEA, 0xB5, 0x2D, 0x4F, 0xBE, 0x62, 0xC7, 0x57, 0xCF, 0xE7, 0x58, 0x4B, 0xB4, 0x14, 0xA4,
+    0xDE, 0x98, 0x51, 0x87, 0xB4, 0xCF, 0x86, 0x7A, 0x08, 0x1F, 0xFF, 0xED, 0x10, 0xFE, 0xAA, 0xD8,
+    0x84, 0x4F, 0xDD, 0xCD, 0x68, 0xEF, 0x06, 0x71, 0xBC, 0xDC, 0x24, 0xF6, 0x9E, 0x97, 0x56, 0x27,
+    0x87, 0x4E, 0xF9, 0xE2, 0x5B, 0xD6, 0xDE, 0x41, 0x97, 0x37, 0xFB, 0x60, 0xA3, 0x00, 0xCB, 0x67,
+    0x2F, 0x0F, 0xD6, 0x4D, 0x4F, 0x8E, 0xF6, 0x79, 0x53, 0x8A, 0x61, 0x92, 0x7F, 0x64, 0xCD, 0xAF,
+    0x61, 0xC7, 0x03, 0x17, 0xA3, 0x66, 0xA5, 0x77, 0xA5, 0x45, 0xF6, 0x8B, 0x35, 0x70, 0xDC, 0xD8,
+    0x58, 0xEF, 0xB7, 0x14, 0x64, 0xEF, 0x70, 0xF6, 0x9F, 0xCE, 0x1B, 0x0E, 0xCB, 0x7A, 0x86, 0x01,
+    0x92, 0x5B, 0xBC, 0x4E, 0x79, 0x57, 0xD6, 0x0F, 0xCA, 0x73, 0x05, 0x92, 0x23, 0x85, 0x92, 0x32,
+    0x40, 0x40, 0x2E, 0x50, 0x06, 0x22, 0xF2, 0xE7, 0xA0, 0x60, 0x7B, 0x5E, 0x26, 0x23, 0xFD, 0x65,
+    0xB7, 0x10, 0x06, 0x27, 0x3D, 0x8C, 0xF2, 0xC7, 0x9E, 0x73, 0x92, 0xB1, 0xFC, 0x79, 0x85, 0x6A,
+    0x2F, 0xAB, 0x5E, 0xE6, 0x35, 0xBF, 0xC3, 0x49, 0xE4, 0x3F, 0x8E, 0x67, 0xD2, 0xF9, 0x03, 0xE6,
+    0x5E, 0xFA, 0xFA, 0x95, 0x85, 0xB1, 0xA8, 0x96, 0x33, 0x97, 0xF5, 0xF8, 0x2C, 0xE2, 0xD0, 0x83,
+    0x8D, 0x1F, 0x0F, 0x8A, 0x49, 0xF8, 0x98, 0x2D, 0x53, 0xC2, 0xA8, 0xA6, 0xE5, 0x22, 0x09, 0x7A,
+    0xC0, 0x30, 0x74, 0x9B, 0xA2, 0x02, 0xD5, 0x23, 0xD6, 0x9F, 0x39, 0xF3, 0x6A, 0xCE, 0x49, 0x46,
+    0x7E, 0xC3, 0x36, 0x5C, 0xC6, 0xA5, 0xBB, 0x47, 0xD9, 0xB9, 0x57, 0x81, 0xD4, 0xB5, 0x4E, 0xF7,
+    0x91, 0xD8, 0x4B, 0x16, 0x51, 0x07, 0xD9, 0xE7, 0x22, 0x44, 0x3C, 0x08, 0x3E, 0x2B, 0xC2, 0x16,
+    0x71, 0xE6, 0x7E, 0x11, 0x21, 0x2A, 0xAC, 0xDE, 0xAA, 0x56, 0x10, 0x26, 0x41, 0x1E, 0x83, 0x8E,
+    0xAF, 0xA5, 0xD5, 0xCB, 0x78, 0x39, 0x48, 0xAB, 0x03, 0xBC, 0xBC, 0x9D, 0x56, 0x6F, 0xE3, 0xA5,
+    0x4F, 0x50, 0xE1, 0x46, 0xFF, 0xDA, 0x26, 0x1F, 0x36, 0x2E, 0xFA, 0xB7, 0x26, 0xF9, 0x18, 0x91,
+    0xEF, 0x73, 0x97, 0xFC, 0x0C, 0xB6, 0xDA, 0xEA, 0xDE, 0x0A, 0x28, 0x90, 0xA8, 0x07, 0xF7, 0xB5,
+    0xAD, 0x69, 0x0B, 0xB7, 0xE1, 0xFD, 0x8E, 0x15, 0x07, 0x07, 0xE8, 0x6F, 0x56, 0xFD, 0x25, 0x86,
+    0xE7, 0x1B, 0x8C, 0xD7, 0x1A, 0x74, 0xB6, 0xDE, 0xB4, 0x96, 0xE9, 0xD9, 0x44, 0xCB, 0xEC, 0xD1,
+    0xCF, 0x48, 0x1E, 0x8E, 0xA0, 0x2E, 0x91, 0x52, 0x77, 0x81, 0x11, 0x28, 0x82, 0x5E, 0xB6, 0x0B,
+    0xD0, 0xCA, 0x36, 0x6E, 0xB9, 0x51, 0xCD, 0xB6, 0x03, 0x20, 0x02, 0xE0, 0x44, 0x77, 0x01, 0x58,
+    0xEF, 0x2A, 0x42, 0xC3, 0xCC, 0x6C, 0x2C, 0xAC, 0x15, 0x82, 0x1D, 0xED, 0xCE, 0x0C, 0xF3, 0x41,
+    0x47, 0x00, 0x57, 0x3D, 0xBB, 0x32, 0x68, 0xAC, 0xD2, 0xE1, 0x92, 0xCA, 0x88, 0x03, 0xB5, 0x99,
+    0xCA, 0x64, 0x1A, 0xEE, 0x58, 0x94, 0x59, 0x1A, 0x7B, 0xB7, 0xDC, 0xE3, 0xD6, 0x4D, 0x2D, 0xA7,
+    0xF9, 0xFA, 0x52, 0x52, 0x94, 0xC7, 0x95, 0x7E, 0xAE, 0x69, 0x45, 0x66, 0xF7, 0x58, 0x72, 0xF6,
+    0xEC, 0x25, 0xBD, 0xFC, 0x0E, 0xDB, 0x95, 0x9E, 0x3D, 0x47, 0xBB, 0xDC, 0x94, 0xF3, 0xAD, 0x68,
+    0xBD, 0xF4, 0xB6, 0xD1, 0xB3, 0x9F, 0x9F, 0xE2, 0xE7, 0xDF, 0x64, 0x28, 0xB9, 0x40, 0x44, 0x6F,
+    0xB0, 0x1F, 0x18, 0xB8, 0xA7, 0x8E, 0x7F, 0x7D, 0xE9, 0x81, 0x54, 0xFE, 0xD8, 0x8D, 0x4F, 0x0A,
+    0xFA, 0xDB, 0x27, 0xEF, 0xC5, 0xFD, 0x8F, 0x86, 0x46, 0xF6, 0x24, 0x7D, 0xA9, 0xC6, 0xC4, 0xAB,
+    0xAB, 0xC7, 0x50, 0xFA, 0x37, 0x9B, 0x5D, 0xDC, 0x6A, 0x93, 0x4D, 0x32, 0xAC, 0x98, 0x38, 0xFB,
+    0xA0, 0x8B, 0x2B, 0xB6, 0x9C, 0xEE, 0xDB, 0x01, 0x3C, 0x0B, 0x29, 0x0E, 0xFD, 0xD3, 0x05, 0xB4,
+    0xD7, 0x07, 0x41, 0xE7, 0x8E, 0xA0, 0x4D, 0xF9, 0x11, 0x4A, 0xCF, 0x0F, 0x91, 0x24, 0x1A, 0x38,
+    0x24, 0x0A, 0x8C, 0xB0, 0x3D, 0x07, 0xE3, 0xE6, 0x4D, 0x32, 0xE4, 0xED, 0x6A, 0xC8, 0x5A, 0x37,
+    0xA0, 0x97, 0xED, 0xA3, 0x06, 0xFB, 0x14, 0x71, 0xF5, 0x8E, 0x3B, 0x0C, 0x8F, 0xE9, 0x56, 0xB8,
+    0x33, 0xB9, 0x6E, 0x45, 0x97, 0x55, 0xD2, 0x07, 0x73, 0xCD, 0x75, 0x2B, 0x95, 0xA7, 0x1D, 0x26,
+    0x57, 0xDC, 0xEB, 0x37, 0x55, 0x7C, 0xFD, 0x9E, 0x14, 0x39, 0x4A, 0x3F, 0x69, 0x55, 0x46, 0xC4,
+    0x7F, 0x55, 0xDD, 0x85, 0xA4, 0x9B, 0xD3, 0x39, 0x7D, 0x4D, 0x9E, 0x6E, 0xC8, 0xAE, 0x7D, 0x1D,
+    0x79, 0xCF, 0x4A, 0x57, 0x0D, 0xC8, 0x22, 0x29, 0xAA, 0x80, 0x6D, 0x93, 0x89, 0xB4, 0xB2, 0x3A,
+    0x34, 0x2B, 0x42, 0x6B, 0x7B, 0x7D, 0x2D, 0xBA, 0xBC, 0x96, 0xBE, 0x1E, 0x5D, 0xFB, 0x29, 0xC5,
+    0xE4, 0x7B, 0xBF, 0xD1, 0x53, 0xC8, 0xBF, 0x82, 0xB9, 0x8A, 0xC1, 0x96, 0x6B, 0x9D, 0x99, 0xCC,
+    0xED, 0x89, 0xD3, 0x7B, 0xB2, 0xED, 0xC4, 0x9A, 0x3C, 0x0F, 0x6D, 0x96, 0xED, 0xC5, 0x51, 0xD0,
+    0xDA, 0x3B, 0xFE, 0x9E, 0x15, 0xC2, 0x3F, 0x18, 0x5E, 0x52, 0xD1, 0x51, 0xDE, 0x8C, 0x97, 0x4C,
+    0x1D, 0xDC, 0x2A, 0xAC, 0xCB, 0xD4, 0x07, 0x47, 0x91, 0xB6, 0x1B, 0x34, 0xE6, 0x82, 0xD3, 0x6C,
+    0x8E, 0x8B, 0x6A, 0x2F, 0xBF, 0x2F, 0xA8, 0x89, 0x83, 0x87, 0xC1, 0x50, 0x90, 0xF6, 0x69, 0xA5,
+    0x32, 0x5C, 0xC1, 0xD2, 0x59, 0xA4, 0xD4, 0x4B, 0x67, 0x43, 0xF3, 0x56, 0xFA, 0x4B, 0xCF, 0xC9,
+    0x5E, 0x46, 0x4B, 0x78, 0xA3, 0x94, 0x0E, 0x4C, 0x67, 0x25, 0xFC, 0x63, 0xCD, 0xA9, 0xF8, 0x1B,
+    0xD2, 0x1B, 0x35, 0x06, 0x77, 0x62, 0x89, 0x81, 0x9D, 0x58, 0xA4, 0x1B, 0x72, 0xCB, 0x8B, 0xD5,
+    0xF5, 0xCB, 0x3D, 0x60, 0xD5, 0x6D, 0xBE, 0xB4, 0xDF, 0xAF, 0xED, 0x6F, 0xBD, 0xE1, 0x7B, 0x6A,
+    0x6A, 0x7D, 0x64, 0xC3, 0x84, 0x41, 0x5E, 0x18, 0x1A, 0xB4, 0xFA, 0x7F, 0x24, 0x74, 0xD2, 0x64,
+    0xDA, 0x8E, 0xD6, 0xB0, 0x98, 0xB6, 0x1F, 0xFC, 0x9F, 0xD2, 0x16, 0x5C, 0x7F, 0xF5, 0x27, 0xA6,
+    0xEF, 0x1B, 0x9A, 0x1F, 0x92, 0xED, 0x5D, 0xDE, 0x7A, 0xBA, 0x53, 0x1A, 0xF1, 0x3D, 0x2D, 0x76,
+    0x0C, 0xE3, 0xA9, 0x47, 0x6E, 0x8F, 0xF2, 0xC6, 0x79, 0x5E, 0x1E, 0xCD, 0xFE, 0x8D, 0xB1, 0x9E,
+    0x72, 0x8B, 0xF6, 0xF6, 0xFF, 0x67, 0x79, 0x15, 0xC4, 0xB8, 0x72, 0x79, 0xB3, 0x5E, 0xA8, 0x3F,
+    0x19, 0xF7, 0x05, 0xA7, 0x91, 0x7F, 0xF4, 0xAC, 0x57, 0x17, 0xE7, 0x73, 0xAD, 0xF1, 0x9F, 0xD4,
+    0x95, 0x03, 0xA8, 0x12, 0xD8, 0x78, 0x12, 0x5B, 0x02, 0xDE, 0x9C, 0x31, 0x1F, 0x60, 0xA9, 0x6B,
+    0x4E, 0x60, 0xDD, 0xD3, 0xA4, 0xFF, 0x91, 0x64, 0x71, 0x83, 0x63, 0x3F, 0x38, 0x76, 0x84, 0x63,
+    0x4F, 0x58, 0x5C, 0x41, 0xBE, 0x60, 0x77, 0xAB, 0x77, 0xCE, 0x20, 0xC4, 0xDE, 0x3D, 0xB3, 0x20,
+    0xB6, 0xF1, 0x88, 0x65, 0xBD, 0x47, 0x8C, 0x4D, 0xA1, 0x10, 0xA3, 0x13, 0x4B, 0x20, 0xEE, 0xA5,
+    0x12, 0x96, 0xEE, 0x8C, 0x4F, 0xEF, 0x51, 0x06, 0x8B, 0x12, 0x80, 0xD7, 0xC2, 0x44, 0xB6, 0x20,
+    0x96, 0xFD, 0x7F, 0x43, 0xEC, 0x3F, 0x00, 0x85, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0x3D, 0x7E,
+    0x8F, 0x60, 0x21, 0x4B, 0x6B, 0x0A, 0xD2, 0x04, 0x65, 0xDD, 0xD0, 0xB0, 0x62, 0x33, 0x6D, 0x8A,
+    0x99, 0xB5, 0x05, 0x3F, 0x80, 0x2D, 0xB2, 0x0D, 0x0D, 0x0D, 0x15, 0x48, 0x6C, 0x43, 0xB1, 0xC5,
+    0xCC, 0xDA, 0xE2, 0x17, 0xE4, 0x27, 0x50, 0xA4, 0x61, 0x29, 0x36, 0x48, 0x53, 0x6C, 0x31, 0x99,
+    0x71, 0x44, 0x41, 0x41, 0x63, 0xFE, 0xC1, 0x93, 0x08, 0x42, 0x41, 0x14, 0x46, 0x32, 0x92, 0x95,
+    0xCC, 0x8E, 0x39, 0xE7, 0x79, 0x76, 0x36, 0xD9, 0xDD, 0x28, 0xB6, 0x7C, 0x9F, 0xC7, 0xEF, 0xBE,
+    0xFB, 0x71, 0xEE, 0xB9, 0x77, 0xD2, 0x4F, 0xDB, 0xD4, 0x36, 0xA9, 0xAD, 0x27, 0xD6, 0x8D, 0x6D,
+    0x35, 0xB6, 0xE5, 0xD4, 0x16, 0x8F, 0xC3, 0x0C, 0xBA, 0xEE, 0x07, 0x15, 0x30, 0xB5, 0x25, 0x50,
+    0x7B, 0x11, 0x16, 0x08, 0x5C, 0x0C, 0x98, 0x8A, 0xC2, 0x56, 0x09, 0x6C, 0xD7, 0x75, 0xAD, 0x39,
+    0xFD, 0x7B, 0xFE, 0x08, 0x31, 0x86, 0xA0, 0x98, 0x02, 0xDB, 0xA8, 0x81, 0x91, 0xC4, 0x30, 0x70,
+    0xC0, 0x91, 0xA9, 0xB0, 0xB3, 0xFA, 0xE9, 0x45, 0x91, 0x52, 0xB9, 0x08, 0xEA, 0xA8, 0x58, 0x9F,
+    0x2F, 0xBD, 0xD8, 0x06, 0xC2, 0x82, 0x47, 0xA3, 0xCC, 0x9F, 0x3F, 0xF2, 0x8E, 0xE5, 0x5E, 0xBE,
+    0x61, 0xE8, 0x16, 0xDF, 0x3C, 0xA7, 0x0E, 0xCF, 0x22, 0xF9, 0xE5, 0x73, 0x87, 0x34, 0x0C, 0x1D,
+    0x8E, 0x23, 0xEB, 0xF0, 0x24, 0xB6, 0x05, 0xE6, 0x5B, 0xD4, 0xC8, 0xEF, 0x52, 0xA4, 0xFF, 0x50,
+    0x24, 0x4B, 0x48, 0x59, 0x06, 0x3A, 0xA7, 0x1D, 0xFD, 0xFE, 0x79, 0x85, 0x77, 0x50, 0x2F, 0xB0,
+    0x0B, 0x97, 0x63, 0x0F, 0x55, 0x8E, 0x34, 0xA8, 0x8E, 0x91, 0x7E, 0x5F, 0x2E, 0x91, 0xFC, 0xF1,
+    0x6B, 0x23, 0xEB, 0x74, 0x74, 0xF8, 0x4C, 0x67, 0xE5, 0x3F, 0x92, 0x88, 0x25, 0xDE, 0xC3, 0xE5,
+    0x95, 0xD3, 0xE0, 0x14, 0xE6, 0xBF, 0x16, 0xC6, 0x21, 0x2A, 0xC7, 0x08, 0x4B, 0x24, 0xD9, 0x08,
+    0x71, 0x86, 0x01, 0xCD, 0xDE, 0x03, 0xC5, 0x1E, 0xC6, 0xC0, 0x04, 0xC7, 0x4A, 0x7F, 0x06, 0x82,
+    0x0A, 0x2C, 0x31, 0x8B, 0x4A, 0x2D, 0xCB, 0x04, 0x0F, 0x30, 0x0B, 0x9A, 0x51, 0xD8, 0x95, 0x33,
+    0xEB, 0xCE, 0x92, 0xCF, 0xDC, 0x28, 0x7A, 0x5A, 0x8F, 0x4C, 0x9D, 0x74, 0xB6, 0xE2, 0x86, 0x79,
+    0x14, 0x15, 0x4D, 0xD0, 0x30, 0x0B, 0x53, 0x6B, 0x19, 0xD9, 0xDA, 0xD0, 0x4E, 0x6B, 0x9D, 0xAD,
+    0x61, 0x6A, 0x2E, 0x8E, 0x3E, 0xAD, 0x0B, 0x2B, 0xFA, 0xB4, 0x2E, 0x2E, 0xE9, 0x97, 0x87, 0x21,
+    0x9F, 0xCD, 0x84, 0x0F, 0x63, 0xAC, 0x7D, 0xA8, 0xC1, 0x2B, 0x61, 0x1F, 0xAE, 0x24, 0xCD, 0xEA,
+    0x54, 0x80, 0x46, 0x2E, 0x94, 0x46, 0x5C, 0x5A, 0x2D, 0x49, 0x69, 0x9B, 0x7E, 0xE9, 0x7F, 0xAD,
+    0xF7, 0x62, 0xA1, 0x1E, 0xBB, 0x85, 0xCE, 0x85, 0x2F, 0xA5, 0x01, 0xBB, 0x42, 0xDC, 0xD1, 0xFC,
+    0x0A, 0xC9, 0x9F, 0x30, 0xCB, 0x3C, 0x1B, 0x64, 0xD4, 0x18, 0x94, 0x7B, 0xC4, 0xBD, 0x88, 0x1D,
+    0x6B, 0x97, 0x23, 0x6C, 0xCE, 0x80, 0x39, 0xCC, 0x39, 0xAD, 0x9C, 0xF7, 0xF8, 0x73, 0x49, 0x4B,
+    0x7D, 0x44, 0x52, 0x49, 0x05, 0x69, 0xAD, 0x2F, 0xC1, 0x4B, 0x96, 0x25, 0x7E, 0x71, 0xFA, 0x7B,
+    0xF7, 0x10, 0xA6, 0x5B, 0x61, 0xC1, 0xAF, 0xB7, 0x3C, 0xE7, 0x52, 0xDE, 0xC7, 0x04, 0x70, 0x8C,
+    0x33, 0x62, 0xFD, 0x78, 0xC3, 0x86, 0x96, 0x85, 0xA9, 0x11, 0x3F, 0x25, 0x00, 0xFF, 0x56, 0x5F,
+    0x61, 0xFE, 0x5B, 0x8B, 0xA4, 0x5B, 0xA6, 0x5D, 0x8D, 0xF4, 0xAF, 0x27, 0xF8, 0x38, 0xA4, 0xF9,
+    0x98, 0xD1, 0xC7, 0x81, 0x30, 0xB9, 0xCC, 0x3F, 0xCA, 0x6E, 0x7C, 0x16, 0x5D, 0xD7, 0x90, 0x8D,
+    0xCD, 0x9B, 0xF6, 0xD7, 0x97, 0xB7, 0x12, 0xEB, 0x67, 0xA2, 0xB7, 0x5D, 0x89, 0xA1, 0xC4, 0x54,
+    0x42, 0x58, 0x19, 0x71, 0x4C, 0xBD, 0x01, 0xD2, 0x7A, 0x4D, 0x99, 0xED, 0x8D, 0x9A, 0x27, 0xB3,
+    0xE0, 0x0B, 0xA4, 0x6B, 0x85, 0x7F, 0x58, 0xAE, 0xA3, 0xEA, 0x75, 0x2F, 0x4D, 0x9E, 0x5D, 0x37,
+    0x19, 0xBE, 0x6E, 0x72, 0x84, 0x2B, 0xD7, 0x47, 0x54, 0xA6, 0xF5, 0x81, 0x43, 0xC0, 0x12, 0x27,
+    0x5C, 0xC8, 0xFB, 0x98, 0x5F, 0x16, 0xB4, 0xAF, 0xE2, 0xF1, 0x93, 0xDF, 0x92, 0x0A, 0xCB, 0xA2,
+    0x97, 0xAA, 0x3F, 0x83, 0xEF, 0x2E, 0x8C, 0x08, 0x06, 0xC1, 0x71, 0xD5, 0xF8, 0xD7, 0x27, 0x27,
+    0x8F, 0xB4, 0x77, 0x70, 0x70, 0xB0, 0xAF, 0xDF, 0x0A, 0x5E, 0x16, 0x52, 0xBE, 0x84, 0x7A, 0xC9,
+    0x19, 0x5D, 0xD8, 0xF2, 0x65, 0xC1, 0x97, 0x88, 0xE7, 0xC3, 0xC6, 0x7F, 0xD4, 0x26, 0x95, 0xE4,
+    0x4E, 0xDE, 0xE4, 0xDE, 0x6D, 0xAC, 0x06, 0x87, 0xCF, 0xB5, 0x0C, 0x3A, 0x91, 0xC3, 0xAC, 0xB2,
+    0x77, 0xC5, 0x03, 0xBE, 0x92, 0x4D, 0x69, 0xE6, 0xD1, 0x59, 0x7A, 0x08, 0x48, 0xFB, 0x3B, 0x19,
+    0x07, 0x4E, 0xC5, 0x09, 0x93, 0x4D, 0xE3, 0x32, 0x29, 0x53, 0x1C, 0x25, 0x99, 0xD8, 0x31, 0x4C,
+    0x19, 0xC7, 0x1E, 0x86, 0x7B, 0xC1, 0x92, 0x4C, 0x19, 0x4E, 0x98, 0xCE, 0x04, 0xC3, 0x19, 0x19,
+    0x3C, 0xC3, 0x91, 0x96, 0x25, 0x8E, 0x96, 0xA1, 0x96, 0x66, 0x69, 0xEB, 0xA0, 0x45, 0xCD, 0xC5,
+    0xB4, 0xC6, 0xCD, 0x6C, 0x13, 0xCE, 0xC2, 0x72, 0x86, 0xD5, 0xB7, 0x7B, 0x87, 0xD9, 0x04, 0x79,
+    0x9B, 0xC8, 0xD0, 0xAD, 0x2C, 0xD8, 0xF7, 0x9C, 0xF1, 0xD4, 0xEF, 0x59, 0xA3, 0x80, 0xF7, 0x49,
+    0xF3, 0xBE, 0x1A, 0x79, 0x15, 0x08, 0xD1, 0x68, 0x8D, 0xD2, 0x17, 0x3F, 0x2A, 0xFB, 0xAE, 0x36,
+    0xDD, 0xF9, 0x61, 0xF7, 0x83, 0x59, 0xB4, 0x96, 0x7A, 0x49, 0x66, 0x5B, 0xD5, 0x49, 0xFD, 0xB4,
+    0x0B, 0xF5, 0xD1, 0x10, 0x51, 0x2F, 0x9D, 0x64, 0x5C, 0x89, 0x0E, 0xB2, 0x3F, 0x65, 0x9F, 0xA9,
+    0xD2, 0x03, 0x2F, 0xD3, 0x42, 0xE4, 0x60, 0xEE, 0x1C, 0x95, 0xA9, 0x26, 0xAB, 0x9A, 0x84, 0xD5,
+    0x9F, 0x5F, 0x48, 0x92, 0xE0, 0xDC, 0x33, 0x66, 0xEE, 0xB9, 0x90, 0x7B, 0x1E, 0xA4, 0x45, 0x20,
+    0xE0, 0x56, 0xA7, 0x42, 0xB1, 0xF3, 0xD3, 0xAE, 0x6F, 0x9F, 0x80, 0xC5, 0x8A, 0x88, 0xAD, 0x58,
+    0x20, 0x97, 0x72, 0x35, 0x28, 0x74, 0x00, 0x1E, 0xE0, 0x14, 0xDE, 0x84, 0x8C, 0xF9, 0x6A, 0xD2,
+    0x4A, 0xB0, 0x7E, 0x0C, 0xE3, 0x57, 0xF4, 0x1A, 0x05, 0x8A, 0x5F, 0x71, 0xAB, 0x34, 0x32, 0xA3,
+    0xB8, 0x37, 0xA6, 0xD6, 0x66, 0xD2, 0x35, 0x07, 0x16, 0x1C, 0x0B, 0xB7, 0x1F, 0x00, 0xEF, 0xE3,
+    0x3E, 0xF3, 0xBC, 0x7A, 0x7F, 0x42, 0x34, 0xFA, 0xFB, 0x2E, 0xD1, 0xE9, 0xEF, 0x2D, 0x26, 0xF2,
+    0xFA, 0xBD, 0x8E, 0x3C, 0x64, 0x3B, 0x7B, 0xD2, 0xBE, 0xD5, 0xEF, 0xF5, 0x14, 0xCC, 0x9B, 0x52,
+    0xA8, 0x6E, 0x34, 0x15, 0x68, 0x98, 0xAD, 0x23, 0x07, 0x87, 0x86, 0xEF, 0x4E, 0x9D, 0x11, 0x72,
+    0xDB, 0xEC, 0xC8, 0x11, 0x5B, 0x73, 0xCC, 0xB6, 0x9F, 0xC6, 0xE2, 0x61, 0x69, 0x2A, 0x5B, 0xDA,
+    0x32, 0x70, 0x6C, 0xF3, 0x9A, 0xF1, 0x9E, 0x71, 0xD8, 0x0F, 0xA9, 0x75, 0x6F, 0xC3, 0x6C, 0xFD,
+    0xBB, 0x95, 0x3B, 0x27, 0x27, 0x27, 0xD9, 0x0E, 0x7D, 0x70, 0xBE, 0x3A, 0x56, 0x97, 0x5D, 0x46,
+    0x72, 0x69, 0xBC, 0xA9, 0x1D, 0x14, 0x9A, 0x38, 0x71, 0x11, 0xCE, 0x4D, 0xD9, 0xE5, 0x7D, 0x36,
+    0x1F, 0x52, 0x4D, 0x65, 0x15, 0x18, 0x3A, 0xB6, 0xC9, 0xEC, 0xA6, 0xEC, 0xCA, 0x57, 0x1E, 0xED,
+    0x33, 0x2D, 0xDC, 0x66, 0x41, 0xA6, 0x6F, 0xBB, 0x7C, 0x70, 0x91, 0x3A, 0x34, 0xCF, 0xFA, 0x30,
+    0x06, 0xD7, 0xC3, 0xF1, 0x93, 0xE4, 0x02, 0x6C, 0x3D, 0xD2, 0x4F, 0x1F, 0xF6, 0x3D, 0xCF, 0xBE,
+    0x50, 0x68, 0x57, 0xC3, 0x49, 0x6E, 0xC8, 0x8C, 0x26, 0xD4, 0xED, 0x1A, 0xF5, 0x1F, 0xA8, 0xC7,
+    0x9F, 0x61, 0x8B, 0xFF, 0x28, 0xDB, 0xC9, 0x97, 0xE5, 0xEE, 0xC8, 0x34, 0x04, 0x73, 0xD1, 0x0E,
+    0x7D, 0xBE, 0xC0, 0xFF, 0xD5, 0x5A, 0x3D, 0x8C, 0xDD, 0xD6, 0x95, 0x3E, 0x24, 0xA5, 0x21, 0xD6,
+    0x44, 0xCC, 0x29, 0x56, 0x40, 0x60, 0x45, 0x62, 0x0A, 0x15, 0x86, 0xAD, 0x11, 0x9B, 0x20, 0x51,
+    0xF1, 0x46, 0xA4, 0xE3, 0x22, 0x65, 0xA6, 0xD0, 0x54, 0x2A, 0xD4, 0xA4, 0x71, 0x80, 0x40, 0x06,
+    0x56, 0x85, 0x8A, 0x99, 0x21, 0x13, 0x17, 0x29, 0x3D, 0x45, 0x60, 0x04, 0x9B, 0xC6, 0x45, 0x1A,
+    0x4F, 0x0A, 0xB9, 0xD0, 0x02, 0x83, 0x40, 0xF3, 0x48, 0xD9, 0x85, 0x8B, 0x14, 0x61, 0x82, 0x18,
+    0x29, 0x52, 0x84, 0x49, 0xA4, 0x24, 0x80, 0x91, 0x0D, 0x93, 0xA5, 0x76, 0x29, 0x2F, 0xF9, 0xB8,
+    0xDF, 0x77, 0xEE, 0x7D, 0x6F, 0xDE, 0x8C, 0xC6, 0xC9, 0x62, 0x11, 0x09, 0xB3, 0x9C, 0xC7, 0x43,
+    0xCE, 0x7B, 0xE4, 0x3D, 0xBF, 0xF7, 0xFC, 0xDD, 0x2B, 0x22, 0x12, 0xA7, 0x92, 0x94, 0x92, 0x95,
+    0x92, 0xA4, 0x72, 0x56, 0xEC, 0x71, 0x55, 0xE4, 0xB6, 0xC8, 0x3D, 0x91, 0x86, 0x1F, 0xA7, 0x11,
+    0xB7, 0x16, 0xAF, 0x16, 0xBF, 0x92, 0xA0, 0x92, 0xB0, 0xE4, 0x27, 0x2A, 0x25, 0xCE, 0x25, 0xC9,
+    0xF9, 0x5E, 0x96, 0xE2, 0x1D, 0x1F, 0x67, 0x88, 0x33, 0xC2, 0xED, 0xD8, 0x4A, 0x7C, 0xB7, 0x97,
+    0x83, 0xCB, 0x33, 0xB7, 0x9B, 0x1C, 0xF8, 0xCD, 0xD5, 0x3B, 0x61, 0x7D, 0x1B, 0x6F, 0xBD, 0x2F,
+    0x31, 0xCE, 0x24, 0xAF, 0xF1, 0x16, 0xCE, 0xD7, 0x2A, 0x49, 0xBE, 0x0A, 0xCC, 0xAF, 0xE3, 0x7C,
+    0x2B, 0x97, 0xF8, 0xC3, 0xB4, 0x0C, 0xFF, 0x3B, 0x28, 0xBD, 0x71, 0x14, 0x29, 0x3A, 0x91, 0x17,
+    0x31, 0xDC, 0xE7, 0x70, 0x7E, 0x61, 0x4E, 0x17, 0x46, 0xAE, 0x45, 0xB2, 0x1F, 0xF5, 0xE2, 0x74,
+    0x32, 0x13, 0xAF, 0x91, 0x1D, 0x12, 0xB5, 0x4E, 0x82, 0x2E, 0x11, 0xC8, 0x71, 0x00, 0x7A, 0xC5,
+    0x1D, 0xC7, 0x9E, 0x00, 0x23, 0x82, 0x89, 0x65, 0x80, 0x77, 0xF1, 0x88, 0x3E, 0x4C, 0x16, 0xD6,
+    0x89, 0xE2, 0xC7, 0xBB, 0xB2, 0x01, 0x0A, 0xDE, 0xA9, 0xE3, 0x71, 0x1C, 0xD3, 0x97, 0xE5, 0x16,
+    0x5E, 0x13, 0x27, 0x55, 0xF4, 0x97, 0x44, 0xDE, 0xDC, 0x8E, 0x1F, 0xB5, 0xD1, 0x38, 0xD6, 0x41,
+    0x15, 0xE6, 0xA1, 0x78, 0xE5, 0x45, 0x71, 0xAA, 0x0B, 0x22, 0xF5, 0x1A, 0x4E, 0xDC, 0xD7, 0xFC,
+    0x2E, 0x28, 0xC3, 0x3C, 0x9A, 0x8D, 0xD5, 0x4E, 0xF6, 0xB8, 0x85, 0x2C, 0xDF, 0xE4, 0xBB, 0xF1,
+    0x98, 0x67, 0x43, 0x3C, 0x4B, 0x6F, 0x75, 0x7E, 0x0B, 0xDA, 0x3C, 0x80, 0xD4, 0xED, 0x04, 0xAF,
+    0xF4, 0x32, 0x11, 0xE9, 0xE5, 0x7D, 0x91, 0xC1, 0x01, 0x55, 0x53, 0x0F, 0x04, 0x65, 0x14, 0x65,
+    0x72, 0x81, 0x60, 0x4B, 0xE4, 0xEC, 0xAD, 0xC7, 0x1B, 0x18, 0x60, 0x84, 0x3A, 0x22, 0x52, 0x4B,
+    0x70, 0x2E, 0xFB, 0x38, 0x95, 0x62, 0x1C, 0x71, 0x9B, 0x90, 0xBA, 0x4C, 0xE6, 0x60, 0x86, 0xF3,
+    0xFC, 0xF8, 0x3D, 0xC8, 0x90, 0x2C, 0xAF, 0xDE, 0x5B, 0x3E, 0x8C, 0x18, 0x8F, 0x7F, 0xA7, 0xEC,
+    0x15, 0x78, 0xCF, 0x7B, 0x04, 0x4B, 0x08, 0xD3, 0xB0, 0x92, 0x98, 0xA2, 0xBB, 0x26, 0x7E, 0x09,
+    0x40, 0x2A, 0x94, 0x05, 0xC5, 0x4D, 0x79, 0x64, 0x23, 0xDE, 0xF8, 0x0D, 0xE8, 0x71, 0xAB, 0xB8,
+    0x17, 0xAF, 0xF2, 0x67, 0x14, 0x68, 0x21, 0x5E, 0x87, 0x27, 0xDD, 0x19, 0x8D, 0x60, 0x84, 0x34,
+    0x24, 0x19, 0xC0, 0x5A, 0x00, 0x73, 0xC0, 0xF0, 0x94, 0x75, 0xA4, 0x52, 0x07, 0x1B, 0xE2, 0x36,
+    0x72, 0x99, 0x66, 0xB5, 0x85, 0xB7, 0xA9, 0x45, 0x1A, 0x20, 0xDE, 0x0A, 0xA1, 0x2A, 0x71, 0x8A,
+    0x5D, 0x91, 0x8B, 0x4E, 0x9D, 0x78, 0x6D, 0xE6, 0xB5, 0x6B, 0x14, 0x8A, 0x3D, 0x6E, 0x8D, 0xBB,
+    0x6A, 0x05, 0x77, 0xC9, 0x23, 0x8C, 0x8F, 0x14, 0x75, 0x3A, 0x18, 0xD0, 0x6F, 0x62, 0xB0, 0xA0,
+    0x8C, 0xC6, 0xFA, 0x0A, 0x0C, 0xF1, 0xC0, 0x6D, 0x43, 0x8C, 0xD1, 0x4A, 0xEB, 0xE7, 0x6B, 0xF8,
+    0x31, 0xF5, 0xCA, 0x09, 0xD5, 0x6D, 0x2F, 0x6E, 0x39, 0xA1, 0xDE, 0xDD, 0x6A, 0x71, 0xA9, 0xF4,
+    0x62, 0x1F, 0x81, 0x65, 0x51, 0xB5, 0x6E, 0x2B, 0x97, 0x7C, 0x68, 0x79, 0x90, 0x7B, 0x61, 0x1A,
+    0xE4, 0xF1, 0x58, 0x47, 0x20, 0xD7, 0x7D, 0x0F, 0x88, 0x88, 0x16, 0xA3, 0x53, 0xF6, 0x11, 0xDE,
+    0x09, 0x66, 0x7B, 0x24, 0x09, 0x22, 0x37, 0xC4, 0x6E, 0x28, 0xB5, 0xDF, 0xF7, 0x7E, 0xDF, 0x87,
+    0x79, 0x97, 0x48, 0xBB, 0xE3, 0x34, 0xF7, 0xDD, 0xA6, 0xF7, 0xEA, 0x3E, 0xA8, 0xFB, 0xB0, 0x9A,
+    0xFE, 0xCB, 0xA3, 0xE4, 0x83, 0xFE, 0x0C, 0x2D, 0x4B, 0x56, 0xC9, 0xAA, 0x6C, 0xF9, 0xA5, 0xD3,
+    0x44, 0x10, 0xFA, 0x81, 0xC4, 0xDF, 0xE9, 0xA4, 0x08, 0x1A, 0x99, 0x85, 0xB5, 0x64, 0x10, 0x56,
+    0xFC, 0x55, 0xD8, 0x4A, 0xDE, 0x41, 0x46, 0x5B, 0x20, 0x11, 0x76, 0x96, 0x9E, 0xA1, 0xE2, 0x5B,
+    0xD8, 0x27, 0x05, 0x7B, 0xEF, 0x33, 0xCE, 0xDB, 0xE7, 0x36, 0xD3, 0x64, 0xAC, 0xB2, 0xB1, 0x92,
+    0xA5, 0xE3, 0x6F, 0x4A, 0x50, 0x28, 0xC1, 0x8F, 0x60, 0xF6, 0x94, 0xE0, 0xF4, 0x06, 0x6C, 0xF9,
+    0xA2, 0x6C, 0x3B, 0x94, 0xA0, 0x6C, 0x4B, 0x0B, 0xB9, 0x2C, 0x2E, 0x4E, 0x03, 0x09, 0xCA, 0xCE,
+    0x8D, 0x0A, 0x32, 0x83, 0x35, 0x50, 0x74, 0xB2, 0x9D, 0x98, 0x4B, 0x98, 0xEB, 0x23, 0x41, 0xC5,
+    0xC9, 0xB1, 0xED, 0x35, 0x94, 0xE0, 0xB6, 0xD3, 0x41, 0x82, 0xDF, 0x1D, 0xAB, 0x11, 0x12, 0xFC,
+    0xD9, 0x66, 0x7A, 0xEE, 0x7F, 0x25, 0xC1, 0x73, 0x9B, 0x9B, 0x9B, 0x18, 0x1D, 0xFE, 0xE0, 0x9B,
+    0x7B, 0x7B, 0x7B, 0xFC, 0x36, 0x98, 0x61, 0x1E, 0x94, 0xDB, 0x5E, 0xBD, 0x2F, 0x4D, 0xAB, 0x9F,
+    0x7D, 0xA7, 0xD9, 0xF1, 0xEB, 0x68, 0xCC, 0x57, 0x9E, 0x18, 0x0E, 0x83, 0xF4, 0xC4, 0x73, 0x21,
+    0xB1, 0xCF, 0xF8, 0x7D, 0xF9, 0x18, 0xE7, 0xCF, 0x9E, 0xDD, 0xD0, 0x79, 0xE1, 0x74, 0x71, 0xEA,
+    0x36, 0x61, 0x2E, 0x35, 0x4E, 0x89, 0x52, 0x33, 0x1F, 0xC0, 0x02, 0x5C, 0x23, 0x4D, 0x57, 0xAE,
+    0x50, 0xE6, 0x2B, 0x30, 0x99, 0x17, 0x61, 0xC1, 0x83, 0x24, 0xB4, 0x62, 0x1E, 0x7C, 0x1F, 0xFF,
+    0x7B, 0x4D, 0x02, 0xBB, 0x89, 0x53, 0x27, 0xE7, 0x54, 0xC5, 0x24, 0x85, 0xFB, 0x92, 0x02, 0x43,
+    0xDD, 0xA0, 0x02, 0xF9, 0xEC, 0x81, 0xBC, 0x8C, 0x73, 0x0B, 0xF7, 0xC9, 0xD7, 0x5A, 0x01, 0x37,
+    0x46, 0x00, 0x6F, 0x38, 0x83, 0xD7, 0xC2, 0xA6, 0xE9, 0x91, 0xE1, 0xCF, 0x0E, 0x08, 0x7A, 0x4E,
+    0xFF, 0x1E, 0xDE, 0x17, 0x8E, 0x23, 0xA1, 0x0B, 0xC1, 0xD8, 0x2D, 0x01, 0xBD, 0x21, 0xC0, 0x54,
+    0xFC, 0x1A, 0x16, 0x0B, 0x83, 0xEE, 0xF1, 0xB8, 0x63, 0x41, 0x54, 0xF2, 0xC9, 0xDC, 0xEB, 0xA5,
+    0x48, 0xBD, 0xC1, 0xFD, 0x73, 0x1A, 0x8C, 0x63, 0x34, 0x0B, 0x6F, 0xF6, 0x61, 0x17, 0xBE, 0x96,
+    0x3A, 0x9C, 0x7B, 0x98, 0xE0, 0x8B, 0xA9, 0x0E, 0xCB, 0x00, 0xE0, 0x44, 0x4D, 0xA8, 0x8E, 0x88,
+    0xFF, 0x52, 0x1D, 0x1B, 0x3E, 0xE5, 0x12, 0x8D, 0x8F, 0x33, 0xD8, 0x56, 0xB3, 0x26, 0x0A, 0xB2,
+    0xA3, 0xE0, 0xF0, 0x87, 0x98, 0x20, 0x24, 0x70, 0x09, 0x10, 0x4C, 0xFE, 0x11, 0xC0, 0x69, 0x20,
+    0xEE, 0xB8, 0x89, 0x1F, 0xCA, 0x2B, 0xEF, 0xBE, 0xF2, 0x43, 0xDC, 0xE6, 0x49, 0x89, 0xBF, 0x1C,
+    0xE1, 0x6B, 0x55, 0x6A, 0xB7, 0x75, 0x66, 0xE0, 0x21, 0x91, 0x9D, 0xA2, 0xA7, 0xCF, 0x49, 0x29,
+    0x8E, 0xAC, 0x0A, 0xFE, 0x5C, 0xBA, 0x5F, 0x37, 0x91, 0x2B, 0xD7, 0xA0, 0xA7, 0x8C, 0xEE, 0xE8,
+    0xE7, 0x00, 0x9E, 0x97, 0x04, 0xEB, 0xFC, 0xD8, 0xF5, 0xFE, 0xB3, 0x0B, 0xCB, 0x21, 0x96, 0xE9,
+    0x35, 0x99, 0x1E, 0xC8, 0xC1, 0x7D, 0xE9, 0xEF, 0x3B, 0xFD, 0x01, 0x54, 0x08, 0x8F, 0x3F, 0xAA,
+    0x5A, 0x30, 0xFF, 0x60, 0x09, 0x22, 0x2D, 0xA2, 0xC6, 0x7D, 0x7A, 0x48, 0x4C, 0x9D, 0xE4, 0x75,
+    0xA8, 0xED, 0x01, 0x34, 0xF2, 0x56, 0x27, 0xD3, 0xA0, 0x76, 0xBA, 0x28, 0xF7, 0xEA, 0x6B, 0xF0,
+    0xA5, 0xAD, 0xAC, 0xB9, 0x95, 0xAC, 0x3A, 0x1C, 0xDC, 0x58, 0x19, 0xE8, 0x91, 0x3B, 0x30, 0x83,
+    0x8A, 0xC1, 0x15, 0x74, 0xD1, 0x03, 0x92, 0xB6, 0x20, 0x57, 0x25, 0x47, 0x46, 0xDE, 0xEB, 0x26,
+    0x38, 0xEF, 0xAB, 0x46, 0x1C, 0xD5, 0x84, 0x30, 0x32, 0x80, 0xE0, 0x90, 0xAC, 0xEE, 0xE0, 0x41,
+    0x58, 0xD3, 0x01, 0x82, 0xC7, 0x48, 0xFA, 0x5B, 0x77, 0x04, 0x0F, 0x7F, 0xAD, 0x83, 0x1D, 0xA2,
+    0x28, 0x2F, 0x6F, 0x6B, 0x54, 0xBB, 0x7D, 0x1F, 0x97, 0x2B, 0x4E, 0x45, 0x1B, 0xDB, 0xF2, 0x73,
+    0x5E, 0x9A, 0x70, 0x6F, 0xB6, 0x0B, 0x9C, 0x0C, 0x62, 0x0C, 0x7E, 0xF4, 0x75, 0x60, 0x86, 0x97,
+    0x75, 0xE3, 0x9C, 0xF7, 0x4D, 0x30, 0x98, 0x1F, 0x87, 0x54, 0xBF, 0xAF, 0x54, 0xC3, 0x6B, 0x93,
+    0x6A, 0x30, 0xAE, 0x12, 0x4D, 0x95, 0xEA, 0x2B, 0x86, 0xEA, 0x2D, 0x43, 0xB5, 0x25, 0xB7, 0xD2,
+    0x0B, 0xF9, 0x22, 0xB9, 0xCE, 0x75, 0x5E, 0xD6, 0xE3, 0x91, 0x54, 0xEF, 0x1F, 0xE0, 0xA5, 0xC1,
+    0x69, 0xBA, 0xA0, 0x4A, 0xC6, 0xFF, 0x28, 0x6F, 0xD3, 0xFF, 0x62, 0x72, 0xD1, 0x1B, 0xC7, 0x7A,
+    0xC7, 0xA0, 0xC8, 0x41, 0x5B, 0xA5, 0x07, 0x38, 0xF1, 0x21, 0x4E, 0xC5, 0x97, 0xCA, 0xC4, 0x4D,
+    0xF1, 0xB3, 0x53, 0x7B, 0x29, 0x70, 0xFA, 0xCC, 0x18, 0x1A, 0x4C, 0x9B, 0x71, 0x41, 0xF4, 0x39,
+    0xA5, 0xDA, 0xE1, 0x44, 0xBC, 0x0C, 0xDA, 0x77, 0x38, 0x4A, 0x50, 0xAA, 0x24, 0xDD, 0xDC, 0x4A,
+    0xF2, 0x40, 0xF1, 0xC0, 0xC9, 0x53, 0xE4, 0xA0, 0x0A, 0x18, 0xE5, 0x46, 0x43, 0x8C, 0x08, 0xCA,
+    0xAE, 0xBA, 0xA1, 0xDE, 0x2F, 0xCF, 0x22, 0x7E, 0xF7, 0x61, 0x9A, 0xA4, 0xFB, 0x4E, 0x77, 0x05,
+    0xB2, 0x9E, 0x06, 0xCD, 0x16, 0x64, 0x8D, 0x78, 0xDE, 0x40, 0xD6, 0xCE, 0x86, 0x57, 0xA9, 0xAC,
+    0x83, 0x52, 0x65, 0x1D, 0x19, 0x59, 0xAF, 0x1B, 0x59, 0xEF, 0xAB, 0xAC, 0xE1, 0xD8, 0x29, 0x6B,
+    0x88, 0x43, 0x65, 0x9D, 0xEB, 0x25, 0x32, 0xB2, 0x9E, 0x1C, 0x95, 0x35, 0x0F, 0xF5, 0x2F, 0xCC,
+    0x01, 0x6C, 0x68, 0x3F, 0xB3, 0xF4, 0xDB, 0xC4, 0x64, 0x67, 0xB4, 0x1F, 0x3A, 0x79, 0x44, 0x09,
+    0xCC, 0x67, 0x86, 0x5D, 0x41, 0xCC, 0xD6, 0xA7, 0x0B, 0x9B, 0x01, 0x0C, 0xE2, 0xA7, 0xF0, 0x02,
+    0xE5, 0x0C, 0xDA, 0xC9, 0x30, 0x47, 0xE2, 0x47, 0xA3, 0x26, 0x66, 0x72, 0x4E, 0x07, 0x7A, 0x45,
+    0x61, 0xAC, 0xF3, 0x5A, 0x33, 0x25, 0xA3, 0x2D, 0x63, 0x69, 0x9A, 0xFE, 0x1D, 0x3D, 0xE8, 0xA9,
+    0x45, 0x11, 0x01, 0xAB, 0xC2, 0x50, 0x7D, 0xDC, 0xBA, 0xC2, 0x3B, 0x0A, 0x9B, 0x81, 0x81, 0xBD,
+    0x26, 0xF4, 0xCA, 0xA9, 0xBA, 0xE2, 0x42, 0x33, 0xC2, 0x4C, 0x93, 0xAB, 0x44, 0xE9, 0x26, 0x6C,
+    0x48, 0xA9, 0xFB, 0xE9, 0x1E, 0x5C, 0x20, 0x52, 0x2D, 0x38, 0x3B, 0x28, 0x34, 0x56, 0xCB, 0x87,
+    0x6B, 0x9B, 0x28, 0x41, 0xFB, 0xCA, 0x11, 0xC5, 0x55, 0xA9, 0xD0, 0xEA, 0x9B, 0x4F, 0x90, 0x17,
+    0x3C, 0x41, 0x6C, 0xF2, 0x47, 0x95, 0x97, 0xF3, 0x43, 0x99, 0xE7, 0x12, 0x96, 0x01, 0x75, 0x5C,
+    0x3A, 0x61, 0x90, 0x92, 0x9D, 0x7A, 0xFA, 0xDF, 0x30, 0xF6, 0x69, 0xB2, 0x5A, 0x1A, 0x6B, 0xF8,
+    0x36, 0xB9, 0x58, 0x57, 0x35, 0xBC, 0x8B, 0xBF, 0xD3, 0x4D, 0xFF, 0x59, 0xE3, 0x15, 0xE2, 0x36,
+    0xD4, 0xA0, 0x3D, 0xFB, 0x16, 0x2F, 0x55, 0x66, 0x92, 0xE5, 0x60, 0x57, 0xE4, 0x64, 0x05, 0x58,
+    0x0E, 0x2C, 0x0B, 0x96, 0x07, 0xCB, 0x84, 0xE5, 0xC2, 0xB0, 0x61, 0xF9, 0xB0, 0x8C, 0x58, 0x4E,
+    0x2C, 0x2B, 0x96, 0x17, 0xCB, 0x8C, 0xE1, 0xC6, 0xB2, 0x63, 0xF9, 0xB1, 0x0C, 0x59, 0x8E, 0x2C,
+    0x4B, 0x96, 0x27, 0xC3, 0x94, 0x99, 0x8A, 0xB5, 0x18, 0xB6, 0xE4, 0x50, 0x2F, 0x26, 0xDD, 0x44,
+    0xEA, 0xC9, 0x34, 0x57, 0xE1, 0x9A, 0x5B, 0xCB, 0x49, 0xC7, 0xA9, 0x33, 0x29, 0xE3, 0xA7, 0x55,
+    0x6C, 0xF1, 0x5D, 0xEA, 0x67, 0xE2, 0x71, 0x7E, 0x5F, 0x55, 0x67, 0x67, 0xEE, 0x63, 0x35, 0xB5,
+    0x60, 0x38, 0x2D, 0x34, 0xA3, 0x2C, 0xD3, 0xB2, 0x46, 0xDC, 0xC2, 0xDE, 0xC8, 0x64, 0x30, 0xA9,
+    0xA8, 0xFC, 0x1B, 0xAA, 0x36, 0x9D, 0xC7, 0x7F, 0xB1, 0x37, 0xDE, 0x07, 0x1D, 0x12, 0x77, 0x12,
+    0xF4, 0xBA, 0x31, 0x26, 0xB9, 0xE8, 0xD9, 0x9B, 0x89, 0x71, 0x04, 0x08, 0x17, 0x81, 0xB9, 0x71,
+    0xEB, 0xF0, 0xD1, 0xA6, 0xD6, 0xA5, 0x65, 0x38, 0x6A, 0x0A, 0x1C, 0x4A, 0xF8, 0xF1, 0xA6, 0x29,
+    0xF3, 0xB4, 0x88, 0x42, 0xA5, 0xB5, 0x57, 0x94, 0x66, 0x16, 0xAA, 0xCD, 0x90, 0x5D, 0x53, 0x4B,
+    0x31, 0x1F, 0x34, 0xDE, 0x24, 0xD2, 0x74, 0xED, 0x82, 0x9A, 0xD0, 0x94, 0xA1, 0x84, 0xD1, 0x61,
+    0xE0, 0xBF, 0xC8, 0x98, 0x9D, 0x81, 0x49, 0x2C, 0x38, 0x3A, 0x3F, 0xDB, 0xBB, 0xDB, 0xD2, 0x86,
+    0x16, 0x4C, 0x18, 0x23, 0x37, 0x85, 0xCF, 0x27, 0x60, 0xD4, 0xEF, 0xE8, 0xA7, 0x91, 0xE7, 0x22,
+    0xB1, 0x42, 0xB9, 0x0C, 0x2C, 0x33, 0x86, 0x37, 0x4F, 0x05, 0xEE, 0x2B, 0x13, 0xA1, 0x71, 0x65,
+    0xF5, 0xA2, 0xD2, 0xD2, 0x20, 0x60, 0x53, 0xB1, 0x39, 0x54, 0xEA, 0xB4, 0xDE, 0xB6, 0xF7, 0x16,
+    0xE6, 0xF3, 0xB7, 0x72, 0x8E, 0x03, 0x3E, 0x60, 0x06, 0x08, 0xC7, 0xE0, 0x6C, 0xA6, 0x5A, 0x57,
+    0x0C, 0x0A, 0x1C, 0x33, 0xF3, 0x0A, 0x59, 0x24, 0x7C, 0x16, 0x2A, 0xC3, 0x99, 0x5A, 0x46, 0x66,
+    0x0C, 0xDE, 0x55, 0x27, 0x64, 0x45, 0x6C, 0xE6, 0xE6, 0xF6, 0x5C, 0x2A, 0xB6, 0xE2, 0x5F, 0x3E,
+    0x62, 0x65, 0xFE, 0x55, 0x85, 0x8E, 0x51, 0x62, 0xCF, 0xA8, 0xED, 0xA8, 0xFA, 0xDC, 0x9E, 0xBA,
+    0x33, 0xB3, 0xC5, 0x0C, 0x69, 0x54, 0x66, 0x60, 0xF0, 0x98, 0xAA, 0x09, 0x19, 0x26, 0xC5, 0x28,
+    0xCE, 0xE8, 0xC8, 0x08, 0x22, 0x5E, 0x62, 0xDE, 0xE8, 0x25, 0xD3, 0xCE, 0x00, 0x98, 0x58, 0xD3,
+    0x68, 0x37, 0x51, 0xA5, 0xF4, 0xAA, 0x88, 0x8E, 0xA9, 0xBE, 0x61, 0xD8, 0x3A, 0xD9, 0xFE, 0x10,
+    0xA7, 0x16, 0xFB, 0x96, 0xFE, 0xAB, 0xA7, 0x9E, 0xFE, 0x15, 0xF5, 0xA3, 0x91, 0x62, 0xC8, 0x34,
+    0x2D, 0xE9, 0x7A, 0x8D, 0xD4, 0x4C, 0x0E, 0x5F, 0xC0, 0xDF, 0xE9, 0xA6, 0xDF, 0xCF, 0xAF, 0x6A,
+    0x70, 0x9E, 0x2D, 0x60, 0x90, 0x6F, 0x9D, 0xE4, 0x49, 0x4F, 0x1B, 0xE5, 0x34, 0x7C, 0x6F, 0x5E,
+    0x9A, 0x6D, 0x5B, 0x83, 0xF1, 0x97, 0xE9, 0xED, 0x41, 0xED, 0x43, 0x93, 0x68, 0xF5, 0xC6, 0xC2,
+    0xDC, 0xCE, 0xC4, 0x02, 0xBE, 0x47, 0xCA, 0x78, 0x06, 0xB5, 0x89, 0x38, 0x3C, 0x49, 0x15, 0x69,
+    0x22, 0x45, 0x89, 0xAD, 0x20, 0x33, 0x59, 0xE4, 0x6B, 0x28, 0x5A, 0xE4, 0x3C, 0x6A, 0xF3, 0xC2,
+    0xF8, 0x8F, 0x37, 0xCC, 0xA0, 0xF4, 0x99, 0x81, 0xAD, 0x2F, 0xBF, 0xF4, 0x1C, 0xF1, 0xBF, 0xC0,
+    0x87, 0xF0, 0x52, 0x81, 0x6C, 0xF9, 0x31, 0x4A, 0xE6, 0x72, 0x0B, 0x3E, 0xF0, 0x0B, 0xCF, 0x0D,
+    0xBF, 0x9F, 0x5F, 0xC6, 0x3B, 0x53, 0x3D, 0x8F, 0x9B, 0xCC, 0xB3, 0xC6, 0x0D, 0x5B, 0x64, 0x66,
+    0x49, 0x63, 0x4C, 0x35, 0x8D, 0x8E, 0x6B, 0x45, 0x44, 0x27, 0x0D, 0x5C, 0x8A, 0xAE, 0xD7, 0xD7,
+    0x88, 0xB1, 0x30, 0x48, 0x0B, 0x83, 0x73, 0x71, 0x71, 0x6E, 0x3C, 0xBE, 0xCE, 0x76, 0x18, 0x3B,
+    0x8F, 0xF8, 0xEF, 0xE6, 0xA3, 0xEB, 0x2C, 0xD2, 0x48, 0xC6, 0x4C, 0x29, 0x61, 0xE4, 0x00, 0x31,
+    0x1C, 0x28, 0x31, 0xE9, 0x7B, 0x62, 0x92, 0xF9, 0xCC, 0xF4, 0xC8, 0x0A, 0xE3, 0xFC, 0x67, 0x9A,
+    0x20, 0xE2, 0xE1, 0xF3, 0x1D, 0x29, 0xFC, 0x11, 0xE3, 0x58, 0xA1, 0x8D, 0x4C, 0x39, 0x6C, 0x4A,
+    0x4A, 0xD4, 0x19, 0xD3, 0xDC, 0x19, 0x6F, 0x9A, 0xFC, 0x29, 0x31, 0xBE, 0x3A, 0x5D, 0x39, 0x29,
+    0x6F, 0x89, 0x07, 0x8E, 0x91, 0x82, 0x41, 0x11, 0x6D, 0x02, 0xE1, 0x5E, 0xFB, 0xA0, 0x23, 0x82,
+    0x46, 0xCE, 0x60, 0x58, 0x69, 0x3B, 0xC4, 0xFD, 0x75, 0xAD, 0xB5, 0x96, 0xF7, 0x51, 0xA3, 0x7D,
+    0x5D, 0xEF, 0xC3, 0x4E, 0xAF, 0xFE, 0x07, 0xBD, 0x5C, 0xD4, 0xC9, 0x3D, 0x70, 0x0A, 0x69, 0x72,
+    0x30, 0xD1, 0xF0, 0x9A, 0xA5, 0xE6, 0x9A, 0x94, 0xBC, 0x5E, 0x04, 0xBB, 0xAC, 0x52, 0xAE, 0x20,
+    0xA4, 0xB1, 0x1D, 0xB5, 0x06, 0xFE, 0x1A, 0xAD, 0x60, 0xBC, 0xCE, 0x5C, 0xDD, 0xA1, 0x36, 0x95,
+    0x8C, 0x76, 0x7C, 0xF0, 0x8C, 0x86, 0xE9, 0xC6, 0x14, 0x3E, 0xAC, 0x43, 0x28, 0x82, 0xF3, 0x43,
+    0xAA, 0xDD, 0x87, 0x62, 0x34, 0xA5, 0xDF, 0x3C, 0xF1, 0xB7, 0xF1, 0x68, 0x67, 0x29, 0x80, 0x69,
+    0x9D, 0x89, 0xEA, 0xEE, 0x18, 0xC3, 0xE7, 0x75, 0xF8, 0xF1, 0x93, 0x41, 0xA3, 0x70, 0xA6, 0x2D,
+    0x2F, 0x18, 0x45, 0xA6, 0x02, 0xE7, 0x97, 0x0D, 0xA3, 0xB0, 0xD7, 0x52, 0xC1, 0x5E, 0xC7, 0x28,
+    0x0C, 0x58, 0x13, 0xD2, 0x64, 0xBC, 0x8E, 0x54, 0xF8, 0x2D, 0x23, 0xAC, 0x81, 0x41, 0x43, 0x13,
+    0x0A, 0x6B, 0x46, 0xE1, 0xA8, 0x52, 0x73, 0x2A, 0xB5, 0xAD, 0x93, 0xF2, 0xD7, 0x19, 0xB5, 0x0C,
+    0xBD, 0x62, 0x04, 0x0C, 0x0F, 0xDB, 0xA0, 0xB6, 0xC7, 0x7F, 0x35, 0x51, 0xF8, 0x21, 0xE9, 0xB9,
+    0x6E, 0xE9, 0x7A, 0x4F, 0xA9, 0xED, 0x97, 0xAA, 0x18, 0xA5, 0xFC, 0xDA, 0xC9, 0xF5, 0xD7, 0x29,
+    0xE5, 0xE2, 0x05, 0xE3, 0x5F, 0x35, 0x4D, 0x53, 0x0A, 0xBD, 0xBF, 0x34, 0xAA, 0x0A, 0x96, 0x61,
+    0xCB, 0x2E, 0xE3, 0x54, 0x73, 0xB1, 0x61, 0x5A, 0x8B, 0xCC, 0x2D, 0xE3, 0xF1, 0x57, 0x78, 0xF3,
+    0x6A, 0xC4, 0x87, 0x56, 0xDD, 0x87, 0xFF, 0x2F, 0xE8, 0x67, 0x7F, 0x96, 0x8E, 0xAE, 0x50, 0x38,
+    0xD5, 0x6F, 0x26, 0x27, 0x96, 0x2C, 0xA7, 0x91, 0xFE, 0x2F, 0x8A, 0xEC, 0x6E, 0x21, 0x9D, 0xE6,
+    0x8A, 0x43, 0x50, 0xB2, 0xD1, 0x7A, 0x80, 0x5C, 0x1B, 0x04, 0xC4, 0x95, 0xF1, 0xDA, 0x53, 0x04,
+    0xA1, 0xF6, 0x3E, 0x7E, 0x8D, 0x25, 0x4E, 0x83, 0x72, 0x1B, 0xCF, 0x5E, 0xC2, 0x3B, 0x4B, 0x6C,
+    0x35, 0xE4, 0xEC, 0xB7, 0x15, 0x39, 0x43, 0x22, 0xBF, 0xE0, 0x2C, 0x51, 0xCE, 0x0A, 0x72, 0xE6,
+    0xFC, 0x81, 0x9C, 0x79, 0x1F, 0x92, 0xB3, 0x50, 0x39, 0x5B, 0x53, 0xCE, 0xAE, 0x2A, 0x67, 0x0D,
+    0x39, 0x73, 0x2B, 0xF2, 0xE4, 0xE7, 0x84, 0xA1, 0x72, 0x36, 0x51, 0xCE, 0xEE, 0x91, 0xB3, 0xD7,
+    0x6A, 0x72, 0xF6, 0x7A, 0x49, 0xCE, 0xDE, 0x56, 0xCE, 0xFE, 0xA4, 0x9C, 0x75, 0xCA, 0x59, 0x47,
+    0x6C, 0x9E, 0x72, 0xE6, 0xDF, 0x25, 0x67, 0xA1, 0x72, 0x36, 0x6F, 0xDC, 0x98, 0x5E, 0x4B, 0xF2,
+    0x59, 0xBD, 0x96, 0x37, 0x8F, 0xEA, 0x28, 0x1B, 0x1B, 0x77, 0x1C, 0x6E, 0x8D, 0xEF, 0xBA, 0x45,
+    0x47, 0x6D, 0x44, 0x29, 0xE3, 0xC3, 0x45, 0x8D, 0x33, 0x6B, 0xB6, 0x67, 0x14, 0x18, 0x58, 0x13,
+    0x32, 0xC0, 0xDD, 0xD1, 0x71, 0xEF, 0x69, 0x84, 0x69, 0x54, 0x68, 0x0D, 0xF1, 0x39, 0x5A, 0xA1,
+    0xA1, 0xA0, 0x4D, 0xB8, 0xB8, 0x41, 0x61, 0xA0, 0x32, 0x98, 0xCE, 0x21, 0xBC, 0xFD, 0xA0, 0xA5,
+    0xCE, 0x54, 0x1B, 0x80, 0x99, 0xF6, 0xFF, 0x12, 0xB6, 0x95, 0x25, 0x9C, 0xDD, 0xAD, 0xB5, 0x38,
+    0x4B, 0x0F, 0x4B, 0x7D, 0x59, 0xD1, 0x72, 0x20, 0x54, 0xD2, 0xE3, 0xF4, 0xB0, 0x1A, 0x68, 0x4E,
+    0x72, 0xBB, 0xA7, 0x96, 0x8B, 0xA5, 0xBE, 0x8B, 0x67, 0xFA, 0x2E, 0x3F, 0xA5, 0x4A, 0xAE, 0x9D,
+    0xD8, 0x77, 0x39, 0xAD, 0x5C, 0xDC, 0xD1, 0x32, 0x78, 0x20, 0x52, 0x0B, 0xF7, 0xFD, 0xF2, 0x84,
+    0xF9, 0x7E, 0x6A, 0xB5, 0xF0, 0xC2, 0xEE, 0x61, 0x8E, 0x9E, 0x1D, 0xC6, 0x73, 0xD3, 0x69, 0xF1,
+    0x8F, 0xAE, 0xC6, 0x48, 0x32, 0xD6, 0xD1, 0x58, 0xC7, 0xB3, 0xDD, 0x97, 0xC6, 0x5D, 0x4C, 0x6E,
+    0x60, 0x22, 0x17, 0xAD, 0x16, 0x06, 0xB5, 0xFE, 0xAB, 0xB9, 0x52, 0xA8, 0x19, 0xDD, 0x9A, 0xE6,
+    0xFB, 0x77, 0x74, 0xC2, 0xD1, 0x32, 0xA3, 0x0F, 0x75, 0x7D, 0xF7, 0x27, 0xAA, 0xEA, 0x7F, 0xD7,
+    0xE1, 0x4D, 0x3D, 0xB8, 0x5C, 0x43, 0x2C, 0x95, 0xDE, 0xC6, 0xBE, 0x4D, 0x0D, 0x11, 0x1D, 0x96,
+    0xE1, 0x2B, 0xE3, 0x23, 0x53, 0xA8, 0xCC, 0x73, 0x50, 0xA6, 0x88, 0x7F, 0x9C, 0x2F, 0xB7, 0x5A,
+    0xF2, 0x9D, 0xD9, 0x7B, 0xA6, 0xA7, 0xA1, 0x2E, 0xD3, 0x57, 0x57, 0xCA, 0xC4, 0x0F, 0x58, 0x32,
+    0x85, 0x90, 0x20, 0x04, 0x0D, 0x69, 0x86, 0xDA, 0x09, 0x08, 0xB5, 0xDF, 0x00, 0x2C, 0x99, 0xCA,
+    0x82, 0xB9, 0x61, 0x6E, 0x72, 0xC2, 0x88, 0x0B, 0x63, 0x74, 0x66, 0x50, 0xE1, 0xC3, 0x45, 0xB9,
+    0x6E, 0x1A, 0x9F, 0x33, 0xE3, 0xC9, 0x77, 0x75, 0xB1, 0xAC, 0x3D, 0xD2, 0xEF, 0x0E, 0xCC, 0xC2,
+    0x53, 0x92, 0xAB, 0x4C, 0xB5, 0x05, 0xC0, 0x82, 0x9F, 0x0A, 0x05, 0xBF, 0x4B, 0x17, 0xBF, 0xE6,
+    0x05, 0xB9, 0x5E, 0x00, 0x1C, 0xCE, 0xDD, 0x32, 0xDB, 0xA3, 0x1F, 0x7F, 0xA0, 0x99, 0x65, 0xF4,
+    0x81, 0x8A, 0x23, 0x7E, 0x4B, 0x2F, 0x89, 0xE9, 0xB5, 0x24, 0x26, 0x53, 0x49, 0x44, 0xD5, 0xB8,
+    0x63, 0x5A, 0x04, 0x53, 0xD3, 0x3D, 0x1A, 0x90, 0xCA, 0x19, 0x11, 0x4C, 0x4D, 0x3E, 0x9E, 0x10,
+    0xEB, 0x44, 0x2D, 0x05, 0x8E, 0xFB, 0x1A, 0xB1, 0x1E, 0x70, 0x95, 0xC5, 0x6B, 0x92, 0x77, 0x3A,
+    0x0A, 0x22, 0x64, 0xAA, 0x07, 0x49, 0x5C, 0x5F, 0x08, 0xDC, 0x3A, 0x46, 0xBB, 0xD2, 0x64, 0x6B,
+    0x35, 0xD1, 0xDE, 0x9F, 0xBC, 0x6A, 0x12, 0xDE, 0xCC, 0xBA, 0x7C, 0xAD, 0x8A, 0xCD, 0x22, 0xB2,
+    0x92, 0x76, 0x5F, 0xE6, 0x6B, 0xF7, 0x47, 0x0B, 0x62, 0x77, 0xFC, 0x39, 0xC2, 0xC0, 0xC7, 0x60,
+    0x70, 0x3A, 0x5F, 0x28, 0x53, 0x45, 0x00, 0xE1, 0x94, 0x42, 0x1F, 0x98, 0x82, 0x73, 0x0D, 0x0D,
+    0x20, 0x23, 0xDD, 0x19, 0xED, 0xAA, 0xA0, 0xCE, 0x0A, 0x9A, 0x44, 0x26, 0xE7, 0x09, 0xBE, 0x02,
+    0xB5, 0x7D, 0xFB, 0x77, 0xCD, 0x6A, 0x3C, 0xBE, 0x35, 0x36, 0xC1, 0xE0, 0x42, 0x00, 0x1B, 0xB2,
+    0xBA, 0xF0, 0xEB, 0xD3, 0x79, 0x4F, 0x45, 0x9B, 0x56, 0x9A, 0xA2, 0x7E, 0xFE, 0xB9, 0x92, 0xA1,
+    0x29, 0x98, 0x16, 0x29, 0x88, 0x74, 0x10, 0x09, 0x6B, 0x20, 0xD4, 0x6B, 0xF2, 0x22, 0xDB, 0x56,
+    0xCF, 0x8F, 0x8C, 0x8D, 0x79, 0x0A, 0x85, 0x0C, 0x2A, 0x35, 0x09, 0xD4, 0xB1, 0xFC, 0xE9, 0x19,
+    0x53, 0x10, 0x70, 0xD2, 0x47, 0xE5, 0x40, 0x40, 0xB7, 0x93, 0xEE, 0x3F, 0xE5, 0x0E, 0x9F, 0xB9,
+    0x45, 0xA8, 0x99, 0xC2, 0x9E, 0x9D, 0x4F, 0x5B, 0xDD, 0x47, 0xB0, 0x0C, 0xF4, 0x3B, 0xFD, 0xF5,
+    0x39, 0x13, 0x24, 0xFE, 0x58, 0x51, 0x1D, 0xC9, 0x3B, 0x4F, 0x86, 0x8C, 0x63, 0x26, 0x4D, 0x58,
+    0x61, 0x98, 0xA8, 0x0C, 0xAB, 0x80, 0x3E, 0x29, 0xAC, 0x34, 0x07, 0x8C, 0x4A, 0xF5, 0x41, 0x49,
+    0x0E, 0xCF, 0x34, 0x70, 0x11, 0x35, 0x75, 0x86, 0x9B, 0x2D, 0x7E, 0x50, 0xDF, 0x0D, 0xCC, 0x4F,
+    0x74, 0x79, 0x49, 0x1B, 0x31, 0x05, 0xB3, 0x2C, 0xBA, 0x6E, 0x75, 0x00, 0x89, 0x5C, 0xE8, 0xE5,
+    0x9F, 0xE0, 0x28, 0x6F, 0x8F, 0x08, 0x22, 0xF0, 0xD5, 0x09, 0x6A, 0x54, 0x7F, 0x4C, 0x03, 0x4E,
+    0x73, 0xD0, 0xF1, 0xCF, 0x96, 0x90, 0x15, 0x38, 0xC6, 0xF8, 0x07, 0x1D, 0x46, 0xEF, 0xC1, 0x41,
+    0x0F, 0xE4, 0x5D, 0x68, 0x93, 0xBC, 0xC4, 0x96, 0xE6, 0xF3, 0xB2, 0x7C, 0x7E, 0x66, 0xEA, 0xCE,
+    0x9C, 0x3C, 0xAE, 0x02, 0x2E, 0x59, 0xC3, 0x65, 0x75, 0xDA, 0xBA, 0xD1, 0x3A, 0x29, 0x32, 0x9E,
+    0x4C, 0xA7, 0x5E, 0x80, 0x4C, 0x96, 0x2D, 0xE8, 0x27, 0x36, 0x53, 0x61, 0x88, 0xD3, 0x79, 0xB9,
+    0x25, 0xA6, 0x7F, 0x12, 0x1C, 0x8A, 0x7D, 0x05, 0x74, 0xC5, 0x3F, 0x68, 0xA4, 0xF7, 0x3A, 0xAF,
+    0x75, 0x41, 0x87, 0x0B, 0x3A, 0xBC, 0x36, 0x2E, 0x91, 0xF5, 0xE5, 0x71, 0x99, 0xBC, 0x33, 0x83,
+    0xDB, 0xAD, 0xA5, 0xD8, 0xF8, 0x3B, 0x74, 0x98, 0x0D, 0x53, 0xDF, 0x34, 0xBE, 0xD6, 0xB6, 0x8C,
+    0xB4, 0x96, 0xD6, 0x06, 0xE3, 0xCB, 0x47, 0x6C, 0x8F, 0x38, 0x15, 0x29, 0xB1, 0x0A, 0xD1, 0x0A,
+    0xF1, 0xB2, 0x31, 0xCE, 0xC4, 0x98, 0x8A, 0xC8, 0x99, 0xB3, 0x02, 0xB7, 0x22, 0x57, 0xEC, 0xC6,
+    0xEF, 0x17, 0x8B, 0x28, 0x49, 0x0A, 0x84, 0x24, 0x08, 0x69, 0x30, 0x44, 0x58, 0x2A, 0x5E, 0xCA,
+    0x4D, 0xA4, 0xE2, 0x42, 0xE3, 0x5F, 0xE1, 0xE4, 0x51, 0x81, 0xAD, 0xB1, 0x5F, 0xFD, 0x0C, 0x58,
+    0xE6, 0x4C, 0xE3, 0x44, 0xE3, 0x79, 0x7C, 0x9A, 0xFD, 0x03, 0xF1, 0xBC, 0x94, 0x46, 0x65, 0xC0,
+    0x65, 0x83, 0xD6, 0x88, 0xB2, 0x68, 0x6E, 0x35, 0x41, 0x13, 0x70, 0xE7, 0x55, 0x19, 0x96, 0xB0,
+    0xD6, 0x3C, 0x49, 0xB9, 0xD0, 0x9F, 0x21, 0x1C, 0x4D, 0x65, 0x7A, 0x26, 0x1B, 0xE2, 0xDA, 0xD1,
+    0xE6, 0x1D, 0x84, 0x19, 0xE9, 0xC6, 0xA5, 0x56, 0x9C, 0x79, 0x5A, 0x04, 0xE7, 0x78, 0xAB, 0xE1,
+    0x2F, 0x08, 0x3B, 0xC7, 0x77, 0xB1, 0xCD, 0xB7, 0x03, 0x64, 0xDA, 0x50, 0x80, 0x47, 0x9F, 0x9E,
+    0x61, 0x27, 0x1C, 0x4E, 0xD5, 0x31, 0x19, 0xE3, 0x88, 0x5C, 0x31, 0x0F, 0x7F, 0x52, 0x5E, 0x73,
+    0xEB, 0x7B, 0x5C, 0x05, 0xD7, 0xF8, 0xD8, 0xCB, 0xF9, 0x5E, 0x73, 0x90, 0x8E, 0x81, 0x08, 0x74,
+    0xE2, 0xE3, 0xEB, 0xF8, 0xE1, 0xD2, 0xF8, 0xDC, 0x6E, 0x80, 0xCF, 0xB7, 0x31, 0x2D, 0x52, 0xAE,
+    0xB8, 0xA4, 0x27, 0xEF, 0x6C, 0xFA, 0x3F, 0x8F, 0x66, 0x97, 0x1A, 0x76, 0x91, 0x34, 0xF9, 0x5D,
+    0x32, 0x6F, 0x14, 0xB3, 0x22, 0x77, 0xFF, 0x8B, 0x6D, 0xB0, 0xB4, 0x63, 0x21, 0x72, 0x60, 0x9B,
+    0x25, 0xEE, 0x2C, 0xD3, 0x2C, 0x86, 0xEB, 0x0F, 0x63, 0x0A, 0xCB, 0xCB, 0x72, 0x4D, 0x48, 0x98,
+    0x89, 0xA8, 0xF9, 0x71, 0x87, 0x4A, 0x92, 0x66, 0x62, 0x40, 0x46, 0x05, 0x15, 0x04, 0x83, 0xF1,
+    0x3F, 0xBA, 0xD7, 0x24, 0xCE, 0x91, 0x2A, 0x85, 0x8F, 0x8B, 0x14, 0x9E, 0xE1, 0xD0, 0x00, 0x19,
+    0xCB, 0xFD, 0x99, 0x03, 0x62, 0x8B, 0x5F, 0x96, 0x72, 0x99, 0x7B, 0x25, 0x56, 0x9D, 0x65, 0xE3,
+    0x48, 0xFA, 0xA0, 0x97, 0x57, 0xFB, 0x64, 0x04, 0x9B, 0xA8, 0xAE, 0xDC, 0x4F, 0x81, 0x8B, 0x9B,
+    0x16, 0x52, 0x4F, 0xC7, 0xB5, 0xCE, 0x6F, 0x87, 0x2C, 0xB3, 0xF5, 0x07, 0x94, 0xBA, 0xDB, 0xC5,
+    0x6C, 0x5F, 0xC9, 0x31, 0x97, 0x91, 0x1C, 0x75, 0x73, 0x37, 0xE9, 0x76, 0xAB, 0x09, 0x2C, 0xA5,
+    0x01, 0x4F, 0xBA, 0x88, 0x73, 0xC6, 0x2E, 0x57, 0x98, 0x06, 0x71, 0xBF, 0xA8, 0x4E, 0xA2, 0xA7,
+    0x57, 0x2A, 0x74, 0x13, 0x61, 0xF2, 0x49, 0x4F, 0xA6, 0xA6, 0x66, 0xEF, 0x0C, 0x65, 0x90, 0x2E,
+    0xC9, 0x20, 0xB7, 0x82, 0xC8, 0x55, 0x10, 0xC5, 0x49, 0x82, 0x48, 0x3D, 0x26, 0xC7, 0xD4, 0xCD,
+    0x71, 0x41, 0x68, 0x40, 0xD6, 0x96, 0x88, 0x06, 0xE4, 0xC7, 0xAD, 0x68, 0x03, 0xF5, 0x78, 0x3B,
+    0xE4, 0x59, 0x93, 0xB1, 0x61, 0xF4, 0x01, 0x9B, 0x19, 0x7F, 0x99, 0xCB, 0x55, 0xA3, 0x8F, 0xEE,
+    0x39, 0x52, 0xA0, 0xED, 0x7F, 0xED, 0xFB, 0x87, 0x8C, 0xCA, 0x41, 0x7E, 0xE7, 0xA9, 0x80, 0xFC,
+    0xAC, 0x65, 0x60, 0xBB, 0x6A, 0x8C, 0x13, 0x3C, 0x57, 0x8E, 0x62, 0x5F, 0xDA, 0x44, 0x77, 0x78,
+    0x9C, 0xB5, 0xB9, 0x28, 0x9F, 0x0F, 0x0F, 0x8B, 0xDA, 0x4B, 0xA2, 0x3D, 0x4A, 0x67, 0x7C, 0x02,
+    0x34, 0x9F, 0x8E, 0x74, 0x1A, 0x31, 0x6B, 0x9E, 0x84, 0xFB, 0xAA, 0x0A, 0x78, 0x29, 0xE7, 0xD7,
+    0x75, 0xD0, 0xF8, 0x6F, 0xD7, 0x61, 0x1D, 0xE2, 0x53, 0x4D, 0xC2, 0x3A, 0x2A, 0xEF, 0x85, 0x55,
+    0xFC, 0xA0, 0x82, 0xA7, 0xFA, 0x08, 0xCC, 0xC4, 0x3F, 0x65, 0x5E, 0xCF, 0x10, 0x1E, 0x22, 0xF6,
+    0xC1, 0x13, 0x81, 0x5D, 0x7F, 0xB8, 0xC5, 0xF9, 0xC2, 0x75, 0x08, 0x76, 0x73, 0xBF, 0x71, 0x2C,
+    0xBF, 0x35, 0xEA, 0xD2, 0xFC, 0x76, 0xED, 0xA9, 0xFC, 0x36, 0xC1, 0xFC, 0xA8, 0x5E, 0xE5, 0xFC,
+    0x70, 0xED, 0xF6, 0x2E, 0xCC, 0x0F, 0x4C, 0x4E, 0x4A, 0x43, 0x77, 0x83, 0xD9, 0x5C, 0xE2, 0xA9,
+    0xE9, 0xC4, 0xC7, 0x73, 0x9F, 0x3B, 0xC8, 0x5E, 0xE4, 0x3B, 0x5F, 0x66, 0xF7, 0xE2, 0xB7, 0xFD,
+    0x6A, 0x34, 0x3E, 0x40, 0xF2, 0x30, 0xE3, 0xBE, 0xB4, 0x0D, 0xD3, 0xBA, 0x78, 0x25, 0xB5, 0x1E,
+    0x5A, 0x57, 0xD0, 0xBC, 0x66, 0xDE, 0x63, 0xBD, 0xF0, 0x5C, 0xC9, 0x50, 0x71, 0xE8, 0x1A, 0x58,
+    0xA2, 0x4B, 0x32, 0xAC, 0xAA, 0xEA, 0xF5, 0xE3, 0xEB, 0x5F, 0xCF, 0x9A, 0x0C, 0xB7, 0xBA, 0xA8,
+    0xF5, 0x0B, 0xBC, 0x2C, 0x81, 0x5B, 0x5D, 0x39, 0x6E, 0xCB, 0xCF, 0x5E, 0x1F, 0xF3, 0xF5, 0xC0,
+    0xA5, 0xDD, 0x2E, 0x4B, 0x55, 0xB3, 0x77, 0xAC, 0x6A, 0x0E, 0xB8, 0xEF, 0x90, 0x1B, 0x26, 0xC3,
+    0x76, 0x9E, 0xAF, 0x65, 0x6A, 0x51, 0xC8, 0xEB, 0xD8, 0x5D, 0xCB, 0x1D, 0xDD, 0x4E, 0xEC, 0x9A,
+    0xC5, 0x79, 0xAE, 0x94, 0xD4, 0xAC, 0xA3, 0xFD, 0x86, 0x3A, 0xF6, 0x1A, 0xED, 0xF9, 0xB7, 0xE4,
+    0xD2, 0xED, 0x26, 0x6A, 0x03, 0xBA, 0x79, 0x58, 0x7B, 0xF6, 0xC6, 0xE5, 0xCE, 0xD7, 0xA1, 0x15,
+    0x9B, 0x59, 0xA4, 0x31, 0x3B, 0x22, 0xEA, 0xC3, 0x7A, 0x2E, 0x5B, 0x14, 0xDC, 0x89, 0xB6, 0x1E,
+    0x63, 0xB3, 0x49, 0x73, 0x93, 0xCE, 0x49, 0x57, 0x9A, 0x54, 0xB1, 0x6A, 0xEC, 0xDA, 0xC6, 0xD0,
+    0x62, 0xF0, 0x70, 0xFB, 0x76, 0xF4, 0x1D, 0x44, 0xAA, 0xF8, 0x6D, 0xE4, 0x14, 0xC9, 0x56, 0x08,
+    0x09, 0xBE, 0xCF, 0x1A, 0xBA, 0x04, 0x5B, 0x59, 0xAA, 0x29, 0x30, 0x80, 0x6E, 0x03, 0xEF, 0x31,
+    0x84, 0xB3, 0x48, 0xA8, 0x5C, 0xDD, 0x60, 0x0D, 0x9F, 0x90, 0xCF, 0xA5, 0x3E, 0x60, 0x74, 0xFE,
+    0xF4, 0x24, 0xC2, 0x74, 0xE3, 0x92, 0x78, 0xF8, 0x20, 0xB5, 0xB5, 0xA6, 0xAE, 0x10, 0xEA, 0x02,
+    0x61, 0xB2, 0x20, 0x38, 0xFB, 0x85, 0x98, 0x1D, 0xE8, 0xE4, 0xBB, 0xE6, 0x6A, 0x08, 0x33, 0x18,
+    0x85, 0x2C, 0xA8, 0xEB, 0xF0, 0xA4, 0xDE, 0xEA, 0x29, 0x96, 0xF7, 0xFF, 0x00, 0xDD, 0x5C, 0x3F,
+    0x90, 0xDC, 0xD6, 0x79, 0x7F, 0x00, 0xC8, 0x83, 0x4C, 0x8C, 0x08, 0x16, 0x92, 0xE3, 0x21, 0x43,
+    0x41, 0x45, 0x0A, 0xC5, 0x22, 0x89, 0xC6, 0x93, 0xB0, 0xB8, 0x23, 0x10, 0xA7, 0x70, 0x91, 0x86,
+    0x05, 0x6F, 0x32, 0x19, 0x4D, 0x46, 0x2E, 0x93, 0x49, 0x62, 0xBA, 0x60, 0xC1, 0x82, 0x26, 0xA0,
+    0x49, 0xE9, 0x19, 0xE7, 0x8A, 0x24, 0x45, 0xDC, 0xB0, 0x70, 0x21, 0x53, 0x05, 0x55, 0x68, 0x32,
+    0xCC, 0x0C, 0xB9, 0x80, 0xA4, 0x42, 0x85, 0x8B, 0x6C, 0xAC, 0x51, 0x1A, 0x15, 0x42, 0x6C, 0x6A,
+    0xE2, 0xA1, 0x66, 0x22, 0x78, 0xB2, 0x1C, 0x2F, 0x29, 0x60, 0x91, 0xEF, 0xF7, 0xFB, 0x1E, 0x76,
+    0xB1, 0xBB, 0x47, 0x9A, 0x94, 0x79, 0xD4, 0x5D, 0x96, 0xE4, 0xDB, 0xE3, 0x2E, 0xF0, 0xDE, 0xF7,
+    0xFD, 0xDE, 0xF7, 0xBE, 0xFF, 0x38, 0x63, 0xEC, 0x2B, 0xEB, 0x26, 0x1C, 0x6B, 0xB3, 0xFC, 0x72,
+    0xF0, 0xB1, 0xF1, 0xA6, 0x18, 0x03, 0x8E, 0x61, 0x83, 0x71, 0x8B, 0xE3, 0x65, 0x8E, 0x75, 0x2B,
+    0x83, 0x5B, 0x61, 0xF4, 0xCA, 0x11, 0x2E, 0x4C, 0x0B, 0x19, 0x23, 0x93, 0xE1, 0x42, 0x93, 0xE0,
+    0x42, 0x8E, 0xB5, 0x49, 0x52, 0xE3, 0x3E, 0xB8, 0x5E, 0xE4, 0xC6, 0xEB, 0xBA, 0x2E, 0x37, 0x61,
+    0x6A, 0xE2, 0x52, 0x2E, 0x34, 0x51, 0x69, 0x36, 0x65, 0xEA, 0xD2, 0xDC, 0x94, 0x71, 0x2C, 0x17,
+    0xCA, 0xE8, 0x61, 0xAC, 0x5E, 0xBF, 0x6F, 0x9C, 0xE2, 0x7E, 0xD7, 0xA5, 0x7E, 0x37, 0x53, 0x92,
+    0x82, 0xAE, 0xC3, 0x30, 0x1B, 0x92, 0xE9, 0x76, 0x3F, 0xCF, 0x4D, 0xFC, 0x91, 0x4C, 0x39, 0x92,
+    0x35, 0xDC, 0xA9, 0x2C, 0xE7, 0xD7, 0xB2, 0xBE, 0xCC, 0x35, 0xC2, 0xE4, 0xAD, 0x89, 0x73, 0xD3,
+    0x60, 0xF9, 0x46, 0x3E, 0x75, 0x30, 0x08, 0x4F, 0x85, 0xF1, 0x26, 0x32, 0x04, 0xB8, 0xF2, 0x04,
+    0x86, 0x3F, 0x16, 0x0A, 0xDF, 0xF8, 0x65, 0x7D, 0x2C, 0xEE, 0xFE, 0xBE, 0xAB, 0x83, 0xD6, 0xED,
+    0x52, 0x73, 0xDE, 0x1C, 0xC3, 0x02, 0x7F, 0x60, 0xBE, 0x25, 0xE3, 0x26, 0x28, 0x33, 0xD1, 0x5B,
+    0x15, 0x70, 0x90, 0xC5, 0x04, 0x9F, 0x7F, 0x33, 0xFB, 0x1A, 0x31, 0xDF, 0x1C, 0x31, 0xC6, 0x4F,
+    0x5F, 0x92, 0x85, 0xEE, 0xCA, 0xD2, 0x0E, 0x37, 0xF8, 0x7B, 0xE9, 0x33, 0xC5, 0x6E, 0xDF, 0xC9,
+    0xD0, 0xC6, 0x18, 0xE3, 0x39, 0x72, 0xCF, 0xD5, 0x9D, 0xE9, 0x60, 0x6C, 0xF9, 0x39, 0xCF, 0x83,
+    0x89, 0xAB, 0x3D, 0xC7, 0xC8, 0xC5, 0x12, 0x11, 0x76, 0xE4, 0x07, 0x58, 0xE9, 0xD6, 0x9C, 0x28,
+    0x92, 0x9A, 0xE1, 0xC7, 0x88, 0xB4, 0x98, 0xE3, 0xDC, 0xB6, 0x6C, 0x41, 0xB6, 0xC7, 0xD3, 0x1A,
+    0x40, 0x0E, 0xCD, 0xF3, 0xAB, 0x72, 0x18, 0x90, 0x83, 0xE2, 0x33, 0x99, 0xC6, 0x17, 0x52, 0x52,
+    0x13, 0x8D, 0x4D, 0x92, 0x9B, 0x2C, 0x05, 0x95, 0xF2, 0xE1, 0x19, 0xE3, 0x71, 0x12, 0x9F, 0x93,
+    0x87, 0x9C, 0x2A, 0x24, 0xBB, 0x02, 0xA7, 0xBC, 0x12, 0x1D, 0xF3, 0xC1, 0xA8, 0xEB, 0xA7, 0x8B,
+    0x9F, 0xED, 0x98, 0xF7, 0x77, 0xE5, 0x98, 0xC7, 0x2B, 0x8D, 0xDF, 0x9A, 0x28, 0x17, 0x61, 0x23,
+    0xDC, 0xB1, 0x42, 0x79, 0x41, 0xC9, 0xFA, 0x26, 0x86, 0x51, 0x8F, 0xB6, 0xC7, 0x93, 0x84, 0x59,
+    0xBE, 0xB1, 0x44, 0xFC, 0x46, 0x27, 0x5F, 0xC4, 0x3F, 0x96, 0x4B, 0x5A, 0x01, 0x53, 0x50, 0x6C,
+    0x80, 0xE2, 0x14, 0x78, 0x5B, 0xFA, 0xB8, 0x28, 0xD7, 0x27, 0x20, 0xC5, 0xF2, 0x90, 0x29, 0x5D,
+    0x8E, 0x6C, 0xDA, 0x38, 0x48, 0x55, 0x65, 0x38, 0x1D, 0x56, 0x3C, 0x6C, 0x17, 0xD8, 0xC1, 0x18,
+    0x91, 0xEB, 0xAC, 0x26, 0x39, 0xF8, 0xD6, 0x1F, 0x8B, 0x08, 0x99, 0xA3, 0x38, 0x34, 0x07, 0x00,
+    0x4C, 0x30, 0x01, 0x16, 0x32, 0xF9, 0x6C, 0x2A, 0x30, 0x8D, 0xB7, 0x84, 0xF0, 0x23, 0x4B, 0x20,
+    0x02, 0x43, 0x81, 0x10, 0x08, 0x02, 0x40, 0xE0, 0x87, 0xB9, 0xB1, 0x0A, 0xD6, 0xCB, 0x2C, 0x60,
+    0xFD, 0xBF, 0xCC, 0xC2, 0x06, 0xD4, 0x00, 0x1A, 0x31, 0x53, 0xC8, 0x1C, 0x92, 0x17, 0x54, 0xAB,
+    0x0C, 0xFA, 0xB9, 0xD9, 0xED, 0xB5, 0x3F, 0x11, 0x73, 0x0C, 0x35, 0x04, 0x88, 0xC1, 0xB1, 0x15,
+    0x2D, 0xB3, 0x26, 0x76, 0x4F, 0x0F, 0xB1, 0x17, 0x28, 0xD4, 0x67, 0x0C, 0xD6, 0x0F, 0xBF, 0x33,
+    0x26, 0x28, 0x58, 0xCF, 0xE3, 0xC9, 0x76, 0xA7, 0x07, 0x02, 0xB1, 0x97, 0xC5, 0xF4, 0x99, 0x4D,
+    0x47, 0x56, 0x8B, 0x00, 0x5C, 0xD8, 0x81, 0x52, 0xD0, 0xE1, 0x4D, 0x9E, 0xE9, 0x81, 0x7D, 0x41,
+    0xFE, 0xC8, 0xEB, 0xB4, 0x51, 0xEE, 0xFF, 0x6C, 0x6C, 0xE6, 0x78, 0x5A, 0x40, 0xD7, 0x11, 0x05,
+    0x2B, 0xDD, 0x4F, 0xE4, 0xED, 0x55, 0xB1, 0x14, 0xB8, 0xB2, 0x55, 0x85, 0xDE, 0x10, 0x43, 0xA1,
+    0x53, 0xFE, 0x1A, 0xB7, 0xA1, 0xAA, 0x85, 0x79, 0x2A, 0x94, 0x2B, 0x79, 0x13, 0xE5, 0x3E, 0x78,
+    0x83, 0xD0, 0x17, 0x34, 0x2A, 0xFD, 0x5B, 0xA7, 0xE2, 0x33, 0x23, 0x6F, 0xB0, 0x18, 0xA2, 0xFE,
+    0x31, 0x91, 0xF0, 0x87, 0x89, 0xC4, 0x50, 0x05, 0x35, 0x99, 0x8A, 0xF4, 0xD6, 0x84, 0x17, 0x3B,
+    0x1D, 0xCD, 0xCB, 0x09, 0xB9, 0xE2, 0x44, 0xF7, 0x56, 0x87, 0xE9, 0xBA, 0xCE, 0x12, 0xBD, 0x7D,
+    0x1E, 0xFC, 0x75, 0xF5, 0x6D, 0xAA, 0x25, 0xEA, 0xA2, 0x5F, 0x63, 0x8B, 0x83, 0x5F, 0x00, 0xBC,
+    0xE0, 0xC3, 0xD4, 0x4A, 0xAE, 0x8E, 0x6E, 0xF7, 0xB9, 0xC0, 0x49, 0x83, 0x44, 0x8B, 0x64, 0x68,
+    0x92, 0xD4, 0x26, 0xA9, 0x51, 0x52, 0xAB, 0xA4, 0x66, 0x49, 0xED, 0x92, 0x1A, 0x26, 0xB5, 0x4C,
+    0x6A, 0x9A, 0xD4, 0x36, 0xA9, 0x71, 0x52, 0xEB, 0xA4, 0xE6, 0xC9, 0xD0, 0x3E, 0x99, 0x60, 0x06,
+    0x03, 0x65, 0xAD, 0xF8, 0x53, 0x41, 0xD2, 0x79, 0xED, 0xDE, 0x05, 0x2C, 0xDD, 0x75, 0x0D, 0xFE,
+    0xF7, 0xFA, 0xA7, 0x17, 0xF6, 0x04, 0x49, 0xDA, 0xEF, 0x7A, 0x71, 0x4A, 0xB0, 0xB8, 0x79, 0xF1,
+    0xB5, 0x4F, 0xE9, 0xE1, 0x92, 0x7C, 0x8A, 0xA5, 0xE2, 0xF9, 0x17, 0x22, 0xF8, 0x90, 0xB7, 0x14,
+    0x6B, 0xCA, 0xA9, 0x83, 0x19, 0x27, 0xF5, 0x19, 0x37, 0x7E, 0xC4, 0xCB, 0xD6, 0x90, 0x74, 0x07,
+    0x48, 0xFA, 0xE4, 0x34, 0x24, 0x87, 0x43, 0x24, 0x3F, 0x5C, 0x20, 0xD9, 0x0E, 0x90, 0xB4, 0xAF,
+    0x90, 0x67, 0x2D, 0xEC, 0xDA, 0x35, 0x89, 0x95, 0x1B, 0x5E, 0xE5, 0x28, 0x1C, 0xC2, 0x40, 0x36,
+    0xE2, 0x18, 0x01, 0x60, 0x77, 0x8C, 0x65, 0xDD, 0xD2, 0xBA, 0x52, 0x7A, 0x00, 0xFD, 0x05, 0x87,
+    0x26, 0xB8, 0xB7, 0x9D, 0x62, 0x4A, 0x9C, 0xC5, 0xF0, 0x53, 0xFC, 0x1C, 0x95, 0x0B, 0xFD, 0x10,
+    0x0F, 0x74, 0x42, 0x62, 0xEC, 0xA1, 0x7B, 0x9E, 0xA0, 0x9E, 0xE6, 0x06, 0x6C, 0x62, 0x5B, 0x65,
+    0xB5, 0x13, 0xB3, 0xEB, 0x37, 0xA6, 0x00, 0xB4, 0x9B, 0x2C, 0x48, 0x1D, 0x12, 0xBA, 0x21, 0x80,
+    0xC7, 0x3F, 0xAE, 0x4D, 0xE3, 0x4D, 0xBD, 0x89, 0x2B, 0x6A, 0xD2, 0x15, 0x35, 0xE9, 0x4D, 0xE2,
+    0x32, 0xA8, 0x93, 0x3C, 0x2E, 0x93, 0x7F, 0x9E, 0x09, 0xCE, 0x95, 0x29, 0xCE, 0x3F, 0x8E, 0x9A,
+    0x54, 0x8B, 0x15, 0xA4, 0xA7, 0xC1, 0xC6, 0xDD, 0x29, 0x9D, 0x2D, 0x72, 0xB3, 0xEC, 0xA5, 0xEE,
+    0x3F, 0x64, 0x8E, 0xC8, 0x25, 0xA1, 0x39, 0x45, 0xA2, 0x3D, 0x4C, 0x3C, 0x20, 0xF8, 0xA9, 0x22,
+    0x64, 0x0E, 0x29, 0xFF, 0xE9, 0xAA, 0x7E, 0x7F, 0xC9, 0xEC, 0x73, 0xD9, 0x39, 0x6C, 0x6F, 0x4D,
+    0xAC, 0x01, 0x5D, 0x21, 0xF8, 0x69, 0xA2, 0xB4, 0xFF, 0xCE, 0xCD, 0xDF, 0xD1, 0x26, 0xE9, 0x02,
+    0xAA, 0xB8, 0x39, 0x51, 0xA4, 0xA3, 0x2A, 0x20, 0x2A, 0x23, 0x77, 0xF6, 0x94, 0xF1, 0x48, 0x6C,
+    0x1C, 0x31, 0xB5, 0x5E, 0x76, 0x6B, 0xE3, 0x19, 0x8D, 0x66, 0xCE, 0x9B, 0xEF, 0xCA, 0x78, 0x85,
+    0x71, 0xC7, 0x19, 0x52, 0x13, 0xCD, 0x16, 0x41, 0x99, 0x5F, 0xEF, 0x73, 0x99, 0x1A, 0x38, 0x24,
+    0x41, 0xEF, 0x90, 0xF8, 0xED, 0x2E, 0x0E, 0x09, 0x1C, 0x37, 0x01, 0x13, 0x68, 0x1A, 0xC0, 0x69,
+    0x80, 0x27, 0x62, 0xC2, 0x89, 0x01, 0xA2, 0x06, 0x90, 0x1A, 0x60, 0x4A, 0x50, 0x89, 0xEA, 0x1E,
+    0x46, 0x10, 0x1B, 0xD4, 0x9F, 0xC5, 0x67, 0x9D, 0x38, 0x5B, 0x62, 0x61, 0x6A, 0x48, 0x80, 0x98,
+    0x0C, 0x71, 0xCE, 0x84, 0x14, 0xB8, 0x7C, 0xF9, 0xBA, 0x77, 0xA7, 0x42, 0xB2, 0xAB, 0x77, 0x17,
+    0x77, 0xB5, 0x20, 0x77, 0xA2, 0xDB, 0x91, 0x09, 0x9C, 0x19, 0x50, 0x74, 0x18, 0x7E, 0x0A, 0x9B,
+    0xF2, 0xAD, 0xF0, 0x29, 0x77, 0x09, 0xA3, 0xF0, 0xEE, 0x6A, 0x2C, 0x28, 0x1B, 0xE2, 0x74, 0x77,
+    0x0B, 0xA0, 0xD6, 0xCD, 0x00, 0xF9, 0x8B, 0x4A, 0xD6, 0x5F, 0x6B, 0xB0, 0xCB, 0xFD, 0x63, 0x42,
+    0x23, 0xFC, 0x19, 0x16, 0x3A, 0x47, 0xE9, 0x78, 0xC7, 0xBC, 0x3D, 0x70, 0xFD, 0x43, 0xDE, 0x0C,
+    0x56, 0x47, 0xAF, 0x57, 0xB2, 0xF5, 0x13, 0x84, 0x9F, 0x7E, 0xC5, 0x10, 0xBB, 0x5C, 0x8C, 0x51,
+    0xEE, 0x57, 0x18, 0x03, 0xB8, 0xD8, 0x39, 0xE4, 0x2B, 0x1C, 0x67, 0x9C, 0x9E, 0xBA, 0xFD, 0x6E,
+    0xCA, 0xB0, 0xDE, 0x30, 0x9B, 0x82, 0xD7, 0x55, 0x15, 0x80, 0xEE, 0x0E, 0x3E, 0x07, 0xCA, 0x66,
+    0x54, 0x08, 0x25, 0x72, 0xBB, 0xB0, 0x10, 0xD3, 0xFA, 0x9E, 0x1B, 0x8C, 0x09, 0x83, 0xE5, 0x38,
+    0xA7, 0x61, 0x9E, 0xDD, 0x80, 0xF7, 0x51, 0x90, 0x21, 0x4D, 0x75, 0x68, 0xAE, 0x43, 0x93, 0x1D,
+    0x36, 0xDB, 0xB1, 0x66, 0x48, 0xF6, 0xE9, 0x5E, 0x7C, 0xC3, 0xBC, 0x22, 0xE3, 0x49, 0x41, 0x5D,
+    0xD6, 0x7C, 0x8B, 0xBE, 0x5F, 0x57, 0x0E, 0x52, 0x4C, 0x07, 0x63, 0x17, 0x18, 0x62, 0x19, 0xDC,
+    0x38, 0x0F, 0x4F, 0x1E, 0x19, 0x27, 0xEE, 0xD3, 0x73, 0x71, 0xC8, 0x2C, 0x72, 0x2D, 0xC5, 0x60,
+    0xFC, 0xC3, 0xA5, 0x54, 0xDF, 0xC1, 0xD8, 0x91, 0xFD, 0x8C, 0x33, 0x6D, 0xA4, 0xE6, 0x07, 0x55,
+    0x4A, 0xD4, 0x52, 0x9A, 0x45, 0x4A, 0xEB, 0x50, 0x7F, 0x19, 0x97, 0xF6, 0xF8, 0xBD, 0x86, 0xED,
+    0x8A, 0x96, 0xA6, 0xF1, 0x6E, 0x1D, 0xAC, 0x1D, 0x39, 0x6E, 0xDF, 0xB3, 0x52, 0xC9, 0xEE, 0x88,
+    0xB4, 0xF1, 0x7E, 0xA9, 0xD6, 0x37, 0x4C, 0xD5, 0x96, 0xBD, 0x42, 0x95, 0xB0, 0x1E, 0xD4, 0x36,
+    0x12, 0xA9, 0x97, 0x62, 0x94, 0xEF, 0xC8, 0x8C, 0x39, 0x6D, 0x25, 0x37, 0xAC, 0xD1, 0xC0, 0x06,
+    0xB1, 0x18, 0x83, 0xC4, 0xA9, 0x1A, 0x5C, 0x98, 0x67, 0x18, 0x5B, 0x18, 0x48, 0x6C, 0x20, 0x8C,
+    0x33, 0xCC, 0xAE, 0xAF, 0x81, 0x15, 0xCC, 0xF4, 0x76, 0x41, 0x6F, 0x44, 0xE3, 0x7F, 0x31, 0xD5,
+    0xDB, 0x10, 0x16, 0xDC, 0xDB, 0xAA, 0x00, 0x60, 0xCA, 0x3E, 0x32, 0xEB, 0x43, 0x33, 0x1B, 0x26,
+    0x71, 0x0E, 0x66, 0x22, 0x6D, 0x98, 0x07, 0x72, 0x10, 0xB3, 0x39, 0x33, 0x3D, 0xFA, 0x22, 0x24,
+    0x4E, 0x71, 0x1F, 0x11, 0x5A, 0xED, 0x6B, 0xF4, 0x65, 0xDE, 0x04, 0xAF, 0x98, 0x3A, 0xC4, 0x7A,
+    0x09, 0x40, 0xBE, 0x19, 0xE4, 0xC6, 0x19, 0x3B, 0xA5, 0x03, 0x37, 0xC1, 0xA7, 0xE2, 0xCB, 0xE6,
+    0x19, 0x83, 0x64, 0xEE, 0x23, 0x5C, 0xC5, 0x80, 0x18, 0xD9, 0xB4, 0xC8, 0x42, 0x34, 0x89, 0xB8,
+    0x3C, 0x8D, 0x88, 0xA2, 0xF3, 0x45, 0x9E, 0xA4, 0x6E, 0x27, 0x97, 0x7B, 0x88, 0xDF, 0x3C, 0x9B,
+    0xA1, 0xBD, 0xAA, 0x21, 0x9C, 0x6C, 0x51, 0x0B, 0x48, 0x1A, 0x19, 0x84, 0x95, 0x28, 0x17, 0xB7,
+    0x28, 0xCE, 0x11, 0x33, 0x6B, 0x2E, 0xD7, 0x9D, 0x1E, 0x4B, 0x60, 0x2D, 0x64, 0xF6, 0xA2, 0x54,
+    0x99, 0x7B, 0x5C, 0x90, 0xBF, 0xDE, 0x6E, 0x6F, 0x5F, 0xFC, 0x48, 0x4C, 0x28, 0x5F, 0xC6, 0xFC,
+    0xF9, 0xFD, 0xED, 0xED, 0xEC, 0x9F, 0xBE, 0x72, 0x90, 0x77, 0x83, 0xF1, 0x70, 0x26, 0x1F, 0x46,
+    0xF4, 0xC6, 0x46, 0x0B, 0x18, 0x1D, 0xF1, 0x7B, 0x9A, 0xA8, 0x95, 0xD5, 0x47, 0x9D, 0x71, 0xEF,
+    0x8F, 0x05, 0x8D, 0xDF, 0xA4, 0x09, 0xB6, 0x27, 0x31, 0xC4, 0x52, 0x61, 0xAC, 0xE5, 0x9E, 0xF0,
+    0xC9, 0x61, 0x34, 0xF0, 0xAA, 0x82, 0x99, 0x38, 0x89, 0x51, 0xF7, 0x71, 0x6E, 0xCE, 0x46, 0x02,
+    0xD1, 0x31, 0xF7, 0xCE, 0x8A, 0x38, 0x23, 0xAF, 0x70, 0xA7, 0x4F, 0x79, 0xD3, 0x72, 0x37, 0x7D,
+    0x3E, 0x87, 0x20, 0x10, 0x01, 0xB2, 0xCD, 0x81, 0x49, 0x48, 0x86, 0xF0, 0x1C, 0xE8, 0x54, 0x52,
+    0x4B, 0xC5, 0xCB, 0x12, 0xB3, 0x48, 0x34, 0x61, 0x62, 0x40, 0x05, 0x9C, 0x08, 0x92, 0x52, 0x06,
+    0xC2, 0xE2, 0xEE, 0xE3, 0xF4, 0xAC, 0x78, 0xC0, 0x43, 0xAA, 0x82, 0x0E, 0x0A, 0xD3, 0xDE, 0x3C,
+    0xB2, 0x50, 0x35, 0xFA, 0x8F, 0x99, 0x8E, 0xA9, 0xD2, 0x84, 0x1D, 0xA1, 0x6E, 0xA1, 0x7E, 0x51,
+    0xC2, 0x82, 0x2A, 0x15, 0xE0, 0xC7, 0xEA, 0xD5, 0x1F, 0x33, 0xBB, 0x47, 0xD0, 0xE0, 0x99, 0x2C,
+    0xCF, 0x56, 0x26, 0xB5, 0x13, 0xFB, 0x76, 0x52, 0x4C, 0x08, 0x1E, 0x43, 0x9B, 0xAF, 0x04, 0x97,
+    0xB1, 0xCD, 0x44, 0x26, 0x66, 0x91, 0x8D, 0x9C, 0x29, 0x7B, 0xE0, 0x4E, 0x99, 0x13, 0x35, 0x25,
+    0x67, 0xC3, 0x7A, 0xC4, 0xB1, 0xF8, 0xD0, 0x0D, 0x7D, 0xF5, 0x29, 0x94, 0xAD, 0xA7, 0x4A, 0xB9,
+    0xC6, 0xEC, 0x32, 0xB1, 0x6C, 0xA8, 0xFC, 0x95, 0xD9, 0x45, 0x03, 0xCA, 0xDC, 0xF1, 0x1B, 0xB2,
+    0x55, 0x29, 0xEA, 0x34, 0xA9, 0x06, 0xE7, 0x08, 0xCD, 0x11, 0xE3, 0x32, 0x2C, 0x1F, 0xF8, 0x52,
+    0x7B, 0xCC, 0xC3, 0x77, 0xCD, 0xB5, 0x4B, 0xCE, 0xF8, 0xDC, 0x0D, 0xD9, 0x20, 0xB3, 0xD1, 0x6F,
+    0x8D, 0x18, 0x90, 0x8B, 0x35, 0x84, 0x51, 0x26, 0x0D, 0x06, 0xA4, 0xCB, 0x7C, 0x32, 0x5D, 0xC2,
+    0x09, 0x33, 0x6A, 0x09, 0xD9, 0xB5, 0xD1, 0x21, 0x93, 0x31, 0x4F, 0xE5, 0x3C, 0x03, 0xC4, 0x4F,
+    0x6B, 0xAC, 0xC7, 0x90, 0x24, 0xB7, 0xFF, 0xC6, 0x90, 0xA4, 0x5C, 0x25, 0xC1, 0xA1, 0xBA, 0x10,
+    0x8B, 0x2A, 0x7F, 0x07, 0x59, 0x67, 0x91, 0x34, 0x08, 0x5A, 0x41, 0x82, 0x6F, 0x93, 0x32, 0x26,
+    0xD3, 0x5C, 0xC4, 0x2C, 0x8B, 0x9D, 0x12, 0xE1, 0x02, 0xC7, 0x55, 0x2A, 0x92, 0x25, 0xD3, 0x89,
+    0x77, 0x1E, 0xB1, 0x5E, 0xC4, 0xCB, 0x41, 0x4B, 0xD6, 0x68, 0x95, 0xC8, 0x31, 0x03, 0xB2, 0x4B,
+    0xB3, 0x1A, 0x86, 0xEC, 0x31, 0x0A, 0x45, 0x7D, 0xB1, 0x0E, 0xEA, 0xA0, 0x0A, 0xC6, 0x61, 0x19,
+    0x96, 0x51, 0x19, 0x8B, 0x52, 0x4E, 0xE4, 0x86, 0x4C, 0x76, 0x64, 0x24, 0xFB, 0x91, 0xB5, 0x71,
+    0xE5, 0x90, 0x0A, 0x4B, 0xC8, 0xAB, 0xDD, 0xAF, 0x38, 0x49, 0xA7, 0xE4, 0xB4, 0x8B, 0x5C, 0xE2,
+    0x94, 0x6A, 0x10, 0xA1, 0x9B, 0x92, 0x66, 0xA9, 0xB3, 0xA7, 0xCD, 0xD2, 0x68, 0xC9, 0x0C, 0xED,
+    0x9B, 0x12, 0x1B, 0x2A, 0xBD, 0x91, 0x92, 0x6C, 0xA9, 0xB6, 0x84, 0x5B, 0xDA, 0x2D, 0xF9, 0x96,
+    0x83, 0x91, 0x32, 0xD1, 0x2A, 0x1F, 0x0D, 0xF5, 0x03, 0x15, 0xD0, 0x3C, 0xA5, 0x6C, 0x43, 0x4B,
+    0xAD, 0xB7, 0xF5, 0x21, 0xB2, 0xE6, 0x10, 0x6D, 0x18, 0x7B, 0x5D, 0x63, 0xF8, 0x82, 0x4E, 0xCC,
+    0x31, 0x6C, 0x83, 0x28, 0xC9, 0xB1, 0x04, 0xCC, 0x61, 0x85, 0x61, 0x2C, 0x5E, 0xFD, 0x9A, 0x03,
+    0x5C, 0x88, 0xAA, 0x4E, 0x2F, 0xD6, 0xB2, 0xFF, 0xAC, 0x10, 0x0A, 0x33, 0x19, 0x84, 0x7A, 0xA4,
+    0x09, 0x47, 0xEA, 0xD9, 0x08, 0x43, 0x0C, 0x3D, 0x6B, 0x55, 0xAC, 0x50, 0x92, 0x80, 0x8E, 0x4C,
+    0xD5, 0xB2, 0x6F, 0xAD, 0xDB, 0xE8, 0x90, 0x5C, 0x9E, 0xB5, 0x32, 0xC4, 0x95, 0xDC, 0xE3, 0xAC,
+    0x6A, 0xC2, 0xAB, 0xBD, 0x62, 0x25, 0x43, 0x37, 0x2A, 0x70, 0xAC, 0x42, 0xE8, 0x5E, 0x23, 0x2F,
+    0x64, 0x30, 0x21, 0xD3, 0xB7, 0xAF, 0xB0, 0x14, 0x1B, 0x33, 0x98, 0xF2, 0xD7, 0x8A, 0x14, 0x60,
+    0xF4, 0x48, 0x77, 0xDF, 0xF4, 0x96, 0x65, 0xC9, 0x49, 0x56, 0x14, 0xDA, 0x41, 0x65, 0xB5, 0x59,
+    0xC0, 0xF8, 0xD0, 0x34, 0x41, 0x65, 0x96, 0x53, 0xB2, 0x4B, 0x69, 0x82, 0x64, 0xB7, 0x34, 0x81,
+    0x55, 0xCB, 0x4B, 0x0B, 0x2E, 0x2D, 0x55, 0xCF, 0xA7, 0xFC, 0x66, 0x41, 0x14, 0xA6, 0x83, 0xA8,
+    0x9D, 0x76, 0x9C, 0x9F, 0x34, 0xB7, 0xE0, 0x78, 0x9E, 0x11, 0x8E, 0xD2, 0x60, 0xB9, 0x26, 0x5E,
+    0xC2, 0x5D, 0x9B, 0x1B, 0x16, 0xA6, 0x49, 0xE2, 0x65, 0x57, 0x24, 0x9B, 0x53, 0x71, 0x7B, 0xCE,
+    0xEE, 0x8A, 0xED, 0x9A, 0xF4, 0xA4, 0x70, 0x80, 0x85, 0xD0, 0xC0, 0x88, 0x5C, 0x86, 0x0B, 0x8B,
+    0xD5, 0x4F, 0xF2, 0x37, 0xB8, 0x2B, 0xDB, 0xB1, 0x27, 0xD5, 0x63, 0xE2, 0xE5, 0x8E, 0x0B, 0x83,
+    0x3D, 0xEB, 0x8F, 0xAC, 0xAB, 0xF9, 0xF6, 0x40, 0xFD, 0xBB, 0x58, 0x61, 0xBD, 0xC5, 0xC5, 0x5C,
+    0x35, 0x90, 0x4C, 0x33, 0xF9, 0xF5, 0x39, 0x85, 0x96, 0x64, 0x85, 0x1F, 0x12, 0xA1, 0xF0, 0x13,
+    0x06, 0xFA, 0x51, 0x53, 0x68, 0x6D, 0x9B, 0xD0, 0xCA, 0x19, 0x65, 0x79, 0x26, 0xA5, 0xB7, 0x9F,
+    0x28, 0x38, 0x22, 0x88, 0x2C, 0x46, 0xE9, 0x9E, 0xCD, 0x58, 0x79, 0x72, 0x34, 0xED, 0xCE, 0xB3,
+    0x3E, 0xE6, 0x71, 0x8F, 0xEA, 0x35, 0xDF, 0x54, 0x77, 0xC8, 0x6C, 0xE9, 0xDB, 0x4D, 0x7D, 0xD3,
+    0xCB, 0x9C, 0x72, 0x18, 0x3A, 0x3D, 0xB6, 0x9B, 0xE7, 0x88, 0xA6, 0x10, 0x57, 0xEC, 0x0E, 0x8B,
+    0xEA, 0x72, 0x10, 0x60, 0xC2, 0xBC, 0xB1, 0x20, 0x1A, 0x8A, 0x87, 0x54, 0x8B, 0x0E, 0xF4, 0xFF,
+    0x4B, 0x48, 0x0D, 0x3E, 0x16, 0x0A, 0x83, 0xCF, 0xE1, 0x94, 0x4D, 0x98, 0xB2, 0x87, 0xF7, 0x9D,
+    0x23, 0x50, 0xC9, 0x45, 0x98, 0x92, 0x54, 0x54, 0x44, 0x82, 0x63, 0x46, 0xC7, 0x06, 0xFE, 0x49,
+    0xBE, 0x4A, 0x34, 0xAB, 0xEF, 0x94, 0x12, 0x6C, 0x93, 0x5B, 0xF6, 0xA1, 0x6C, 0x2C, 0x8B, 0x4F,
+    0x5F, 0x05, 0x05, 0x2E, 0x28, 0x70, 0x1F, 0x4D, 0x41, 0xF7, 0x25, 0x28, 0x38, 0xB2, 0xD3, 0x8B,
+    0x59, 0xD6, 0xD3, 0xC0, 0xF4, 0x8B, 0x9F, 0x3E, 0x9E, 0x9B, 0xD4, 0xFC, 0x4E, 0x6E, 0xD2, 0x51,
+    0xAC, 0x7A, 0x12, 0xE7, 0x77, 0x13, 0x13, 0x5F, 0x41, 0x0D, 0xA6, 0x61, 0xCA, 0xCD, 0x66, 0xDC,
+    0x8E, 0xDB, 0xAA, 0x67, 0x63, 0x2D, 0x5C, 0xCE, 0xC8, 0xEC, 0xF0, 0x36, 0x48, 0xB2, 0x5E, 0x55,
+    0x3B, 0x70, 0x8F, 0xA6, 0xBB, 0xB8, 0x47, 0x95, 0xCA, 0x3D, 0x0B, 0x88, 0xA5, 0xE9, 0x55, 0x33,
+    0x0F, 0x54, 0x62, 0x16, 0x16, 0xE5, 0xAA, 0x3D, 0x50, 0x62, 0xB8, 0x61, 0xB9, 0x99, 0xAF, 0x74,
+    0xBE, 0x52, 0xDE, 0x17, 0x2F, 0xAC, 0xE1, 0xF0, 0x28, 0x8F, 0xFB, 0x64, 0x46, 0x30, 0x0F, 0x4F,
+    0x5F, 0xBC, 0x60, 0x8A, 0x06, 0x55, 0xDB, 0x85, 0xCD, 0xAE, 0x96, 0xBD, 0xAB, 0x1C, 0xCC, 0xCE,
+    0xFD, 0x93, 0x65, 0x5B, 0x2F, 0x90, 0xC1, 0xDC, 0x4D, 0x8F, 0x39, 0xB2, 0xA4, 0x88, 0x05, 0xA7,
+    0xF4, 0xF5, 0x56, 0x3A, 0x16, 0x67, 0x8D, 0x2D, 0xC1, 0x35, 0x72, 0xB6, 0x05, 0x86, 0x98, 0x38,
+    0x6C, 0x11, 0x88, 0xCB, 0x44, 0xA2, 0x26, 0x14, 0xF9, 0x63, 0xEA, 0xD8, 0xF1, 0xAA, 0x8E, 0x5D,
+    0x49, 0xC5, 0x1E, 0x35, 0x8A, 0x8B, 0x02, 0x43, 0x64, 0x58, 0x9A, 0x5B, 0x4E, 0xC5, 0x1E, 0xDE,
+    0x76, 0xD2, 0xB8, 0x0B, 0x4A, 0x67, 0x26, 0x54, 0xB5, 0xE2, 0x8F, 0x34, 0x72, 0x6D, 0xF3, 0xAD,
+    0xAF, 0x5C, 0x02, 0x5E, 0xC0, 0x70, 0x1B, 0x1C, 0xCF, 0xC0, 0x2A, 0x87, 0xCB, 0x5F, 0x52, 0x02,
+    0x44, 0xCA, 0x45, 0xC8, 0xAD, 0x77, 0xA0, 0xFB, 0x35, 0x5D, 0xF6, 0xCD, 0xE0, 0x87, 0xBE, 0x10,
+    0x96, 0x57, 0xC3, 0xB2, 0x8B, 0xCA, 0x2E, 0xCE, 0xFF, 0x2A, 0xFE, 0xED, 0x7E, 0xE8, 0xE3, 0x31,
+    0x72, 0x12, 0x03, 0x74, 0xCA, 0x17, 0x00, 0xAE, 0xED, 0x13, 0x69, 0x30, 0x4A, 0x4C, 0x0C, 0x1E,
+    0x7D, 0x22, 0x51, 0xDE, 0x3E, 0x0F, 0xFF, 0x3D, 0x5A, 0x91, 0xC9, 0x81, 0xDB, 0x7C, 0xF5, 0x90,
+    0x19, 0xDD, 0x34, 0x1D, 0x50, 0x43, 0x82, 0x68, 0x6A, 0xFE, 0xF5, 0xE1, 0xFE, 0xA7, 0x8D, 0x6B,
+    0xDC, 0x9F, 0x58, 0xA7, 0xC0, 0xDA, 0x81, 0xC8, 0x6A, 0xF8, 0x73, 0x83, 0x33, 0x03, 0xF6, 0xC6,
+    0xBB, 0x25, 0xFE, 0xE2, 0x16, 0x8E, 0x56, 0x2A, 0x58, 0x88, 0x43, 0x02, 0x28, 0xE4, 0x67, 0x1F,
+    0x57, 0x22, 0x43, 0x95, 0x6B, 0x4E, 0x04, 0x8E, 0xB2, 0xFB, 0x49, 0xC5, 0x0E, 0x21, 0xEF, 0x83,
+    0x9A, 0x79, 0x21, 0xEF, 0xFD, 0x29, 0xDF, 0xFD, 0xF7, 0x1A, 0xD6, 0x93, 0xFC, 0xBC, 0xC5, 0x19,
+    0x61, 0xC3, 0xD8, 0x26, 0x73, 0x47, 0x59, 0xAA, 0xEF, 0x49, 0xB9, 0xC9, 0x22, 0x59, 0x54, 0x5E,
+    0x66, 0x1F, 0x46, 0x58, 0xBD, 0xC3, 0x0E, 0x82, 0xA0, 0xAE, 0x99, 0xD3, 0xF1, 0xA6, 0xFA, 0xEE,
+    0xB6, 0x15, 0xDB, 0xCB, 0xC0, 0x3C, 0x92, 0xDE, 0x86, 0xD9, 0x98, 0x5A, 0xB3, 0x33, 0x38, 0xF3,
+    0x30, 0x90, 0x27, 0xDA, 0x94, 0x5E, 0x40, 0x21, 0xE4, 0x85, 0xAA, 0x98, 0x8F, 0xE4, 0xBD, 0x7B,
+    0x32, 0xEA, 0xBB, 0xDC, 0xA8, 0x1C, 0x96, 0x7C, 0xEE, 0xA4, 0x09, 0xC4, 0xD3, 0x45, 0x9E, 0xC2,
+    0x45, 0x9E, 0xC2, 0x7D, 0xF0, 0xA8, 0x3C, 0xC5, 0x97, 0x08, 0xB0, 0x0F, 0x3E, 0x8C, 0x2B, 0xAF,
+    0xD0, 0x0A, 0x51, 0xFF, 0xED, 0x19, 0xFB, 0xF9, 0xA6, 0x7D, 0xFF, 0xFE, 0xFA, 0x2D, 0x7B, 0x8D,
+    0xB1, 0x0A, 0x77, 0xDA, 0x4B, 0x36, 0xFC, 0x63, 0x66, 0xE9, 0x0D, 0x05, 0xDB, 0xD2, 0xE9, 0x1A,
+    0x57, 0x9B, 0x51, 0x4A, 0xCD, 0x19, 0x3A, 0xB5, 0xCD, 0x49, 0xF6, 0x3D, 0xB5, 0x99, 0x3D, 0x06,
+    0x49, 0xFA, 0xFF, 0xF1, 0x34, 0xBC, 0x8C, 0xFE, 0x9C, 0xAD, 0x41, 0x59, 0x2E, 0xDD, 0xAD, 0x2C,
+    0xB7, 0xC7, 0x3B, 0x65, 0x43, 0x2C, 0xCD, 0x5E, 0xF7, 0x6D, 0x93, 0xC1, 0xC4, 0xEE, 0xC7, 0xD0,
+    0x19, 0x75, 0xDF, 0xEF, 0x4A, 0x31, 0xB5, 0xD1, 0xB7, 0xBB, 0x0F, 0x84, 0xCF, 0x9B, 0x26, 0xF9,
+    0x11, 0xED, 0x64, 0x72, 0x89, 0x9E, 0x7A, 0x52, 0xE9, 0x1B, 0xD3, 0xC4, 0x82, 0x20, 0x3D, 0xF7,
+    0x42, 0x7D, 0xF7, 0x56, 0xED, 0x67, 0xA3, 0x82, 0xCA, 0x10, 0xCD, 0x90, 0x30, 0x26, 0xB2, 0x61,
+    0xD0, 0x3C, 0xF6, 0xA8, 0xF2, 0x4D, 0x2D, 0x52, 0xF2, 0x27, 0xB4, 0x80, 0x70, 0x97, 0x90, 0xB4,
+    0x98, 0xCE, 0x53, 0xD5, 0x4F, 0xB2, 0xEB, 0xC1, 0xFE, 0x3C, 0xBC, 0xA1, 0x59, 0x7E, 0xEF, 0x4B,
+    0xFC, 0x36, 0x02, 0xE8, 0x13, 0xF3, 0x5A, 0x07, 0x37, 0x1B, 0x37, 0xF4, 0x10, 0xF8, 0xB3, 0x27,
+    0x14, 0x89, 0xEC, 0x91, 0x22, 0x31, 0xC1, 0xE5, 0x36, 0x32, 0x5E, 0x48, 0x50, 0xEF, 0x00, 0x96,
+    0x73, 0x07, 0x30, 0x5D, 0x0A, 0xB6, 0x18, 0xE1, 0xE4, 0xBF, 0xB5, 0x23, 0x47, 0x22, 0x1E, 0xCC,
+    0xD5, 0x7D, 0xD6, 0xB2, 0x31, 0x4F, 0xC2, 0x15, 0x71, 0x23, 0x64, 0xE6, 0x8C, 0x86, 0x0F, 0x1F,
+    0xD6, 0x08, 0x8F, 0xBC, 0x09, 0x4A, 0x27, 0xDE, 0x14, 0xC2, 0x27, 0x63, 0x85, 0x31, 0x66, 0xF6,
+    0x1D, 0xD0, 0xF9, 0x13, 0x66, 0xDE, 0x39, 0x06, 0x28, 0x9D, 0xC8, 0x4E, 0xA0, 0x31, 0x2F, 0x1A,
+    0x33, 0x33, 0x51, 0xB2, 0xB5, 0x30, 0x4D, 0x98, 0x67, 0x16, 0x5A, 0xC5, 0x19, 0x90, 0x19, 0x64,
+    0x7A, 0x16, 0xAB, 0x45, 0x0E, 0xFE, 0x45, 0x1B, 0xF3, 0xEE, 0x0C, 0x3A, 0x69, 0x1F, 0xD2, 0x0A,
+    0xEF, 0x83, 0xDA, 0xE4, 0x33, 0x66, 0x53, 0x46, 0x9A, 0x2F, 0x10, 0x2C, 0x24, 0xFE, 0x28, 0x6D,
+    0xC5, 0x1B, 0x31, 0x89, 0x0C, 0x62, 0xF7, 0xF3, 0x8C, 0x3D, 0x4F, 0x70, 0x55, 0x98, 0x0D, 0x29,
+    0x70, 0x4F, 0xA6, 0x95, 0x1C, 0x41, 0x32, 0x2E, 0xE1, 0x2B, 0xDC, 0x93, 0xF8, 0xD9, 0x1D, 0x14,
+    0xBE, 0x7D, 0xB3, 0x41, 0x89, 0x63, 0x99, 0xF5, 0x81, 0x96, 0x59, 0x79, 0xC2, 0xBE, 0x97, 0x1F,
+    0x04, 0xDC, 0x3C, 0x61, 0xC0, 0x78, 0x79, 0x04, 0xE2, 0x6F, 0xF5, 0xB4, 0x9F, 0xC9, 0x9F, 0x25,
+    0x82, 0x66, 0x63, 0xE7, 0xA7, 0x10, 0xC9, 0x77, 0x99, 0xE7, 0xA7, 0x8A, 0x69, 0x58, 0xAF, 0x41,
+    0x22, 0x42, 0xA2, 0xBE, 0x4B, 0x07, 0x42, 0xFE, 0x8E, 0xBF, 0xF1, 0xA6, 0xDC, 0xF8, 0xA7, 0xB2,
+    0xE6, 0x6D, 0x21, 0xC6, 0x99, 0x88, 0x7D, 0xF4, 0xCB, 0x2B, 0xF0, 0x7E, 0xAE, 0x3D, 0x53, 0x30,
+    0xE7, 0x20, 0xC9, 0xAB, 0x05, 0x4C, 0x1D, 0xBA, 0x0B, 0x05, 0xA8, 0x04, 0x0D, 0x7B, 0x58, 0x21,
+    0x15, 0x8B, 0xCD, 0xA9, 0x25, 0x90, 0x6A, 0xE9, 0x97, 0x5F, 0x02, 0x60, 0x85, 0xAD, 0x76, 0x8E,
+    0xAC, 0xC5, 0xE8, 0x3D, 0xEC, 0xC6, 0x56, 0x63, 0xDA, 0xED, 0x0B, 0xD0, 0x7A, 0x2E, 0xA6, 0x93,
+    0xB9, 0xBC, 0xFB, 0xDB, 0xE7, 0xF9, 0x3E, 0xB1, 0xD5, 0x19, 0x35, 0x0D, 0x1A, 0x5F, 0xC9, 0xFF,
+    0xA9, 0x70, 0xE4, 0x9D, 0x4E, 0xBA, 0x5C, 0x27, 0xC4, 0x7A, 0x88, 0xFC, 0x23, 0xA8, 0x72, 0xF9,
+    0x10, 0x99, 0x49, 0x28, 0x29, 0xE4, 0x24, 0x01, 0x68, 0x77, 0xF7, 0x7A, 0xA7, 0xED, 0x35, 0x3C,
+    0xBF, 0x17, 0xCC, 0x0A, 0x6A, 0x48, 0xFB, 0x08, 0x6E, 0x11, 0xDA, 0x91, 0xCD, 0x6C, 0xE4, 0xA2,
+    0x23, 0x39, 0x99, 0x3A, 0x0D, 0xD0, 0xAB, 0x1D, 0x08, 0x4C, 0x52, 0xB9, 0xD8, 0xE1, 0xA4, 0xF4,
+    0x6B, 0x60, 0x58, 0x72, 0x2F, 0x93, 0xFF, 0xEC, 0xC8, 0xAC, 0x6C, 0x15, 0x90, 0xBC, 0x30, 0x4F,
+    0x74, 0x16, 0xB4, 0x2E, 0xC0, 0x53, 0x5B, 0x1D, 0x3D, 0x51, 0xE2, 0xA5, 0x60, 0xFA, 0x79, 0xE5,
+    0x97, 0x82, 0xEA, 0x77, 0x44, 0x95, 0x08, 0xAE, 0x7D, 0x3F, 0xD5, 0xE1, 0x74, 0xD1, 0xAD, 0xAF,
+    0xB9, 0x3D, 0x4D, 0xAF, 0x69, 0x95, 0x56, 0x3B, 0x99, 0x4E, 0xAE, 0xD5, 0x25, 0x67, 0x3B, 0xEC,
+    0x10, 0xD5, 0x94, 0x00, 0xF2, 0x3A, 0x0D, 0xD2, 0xDD, 0x0E, 0x85, 0x49, 0x45, 0x4A, 0xF4, 0x39,
+    0xC6, 0x09, 0xC7, 0x1A, 0xBA, 0xD9, 0xC7, 0xCE, 0x02, 0x3D, 0xB4, 0xD6, 0x56, 0xB2, 0x6F, 0x28,
+    0x91, 0xC9, 0xAD, 0xD1, 0xDD, 0x8E, 0x1B, 0x91, 0x69, 0x8E, 0x8A, 0x34, 0xB3, 0x8F, 0x8C, 0xBA,
+    0x3C, 0xB3, 0xDD, 0xB8, 0xD8, 0xB8, 0x19, 0x03, 0x90, 0x19, 0xE6, 0x3E, 0xD1, 0xFD, 0xA3, 0x3B,
+    0x4B, 0x0B, 0xD9, 0xB1, 0x8B, 0xA5, 0xE6, 0x36, 0xC3, 0x4A, 0xB3, 0x77, 0xF0, 0xDC, 0x64, 0xE7,
+    0xDC, 0xC5, 0x49, 0x4F, 0xA6, 0x51, 0x1D, 0x4F, 0x8B, 0xA9, 0x7B, 0xEF, 0x3F, 0xA6, 0xEE, 0x6F,
+    0xD2, 0x89, 0xFB, 0xC0, 0xEC, 0x78, 0x9A, 0x73, 0xD6, 0xFC, 0x72, 0xAD, 0x77, 0xCF, 0x63, 0xD6,
+    0x7C, 0x39, 0x07, 0x9E, 0xF4, 0x79, 0xAA, 0x7D, 0xC7, 0xF7, 0x7A, 0x42, 0x6E, 0x6B, 0x90, 0x8E,
+    0xAB, 0xD7, 0x92, 0x71, 0xAC, 0x79, 0xBF, 0x81, 0xFD, 0xFF, 0xA1, 0x50, 0x10, 0xFF, 0x25, 0x22,
+    0xC3, 0x4B, 0x78, 0xAE, 0xE6, 0xDA, 0xD7, 0x6C, 0xE1, 0x9F, 0x51, 0xCE, 0x72, 0x39, 0x6D, 0x90,
+    0xF0, 0x9C, 0x3E, 0x2A, 0xE1, 0xB9, 0xE2, 0xD9, 0x47, 0x73, 0x72, 0xCE, 0x62, 0x78, 0x7B, 0xE0,
+    0x41, 0x8B, 0x0F, 0xF9, 0x32, 0x9C, 0x11, 0xFA, 0x0A, 0xB1, 0xE6, 0x48, 0x99, 0xB0, 0x0C, 0x1A,
+    0xB3, 0xD6, 0xDF, 0xB5, 0xFF, 0x60, 0x67, 0x00, 0x40, 0xEF, 0x5F, 0x5D, 0x7F, 0xFA, 0xFD, 0x59,
+    0xB9, 0xEA, 0xF1, 0x43, 0xEC, 0x0C, 0xE4, 0xCE, 0x40, 0xF0, 0x50, 0x6C, 0x9D, 0x18, 0x88, 0x9E,
+    0x76, 0xF7, 0x33, 0x01, 0xA0, 0x19, 0xAC, 0xBA, 0x8F, 0xF8, 0x17, 0xD9, 0x62, 0x4D, 0x43, 0x3F,
+    0x2C, 0x5F, 0xDA, 0x47, 0xE4, 0x7A, 0x67, 0xD9, 0x7F, 0x77, 0x73, 0x3D, 0x04, 0x2F, 0x50, 0x3D,
+    0x7E, 0x50, 0x88, 0x4B, 0x9A, 0xB3, 0xF4, 0x20, 0x00, 0xDD, 0x86, 0x8B, 0xD6, 0x1A, 0x67, 0x47,
+    0x93, 0xE9, 0xDC, 0x61, 0x66, 0xCE, 0x19, 0xB6, 0xC4, 0x53, 0xA3, 0xB5, 0x2C, 0xDB, 0x53, 0x15,
+    0x37, 0x73, 0x27, 0xAE, 0xD3, 0x67, 0x0C, 0x4E, 0x81, 0xA6, 0x5B, 0xFD, 0xC0, 0xB4, 0x07, 0xDA,
+    0xE7, 0x64, 0x47, 0xEE, 0xBD, 0x5E, 0x43, 0x89, 0xA6, 0xCB, 0x4A, 0x65, 0xD6, 0xCB, 0x0C, 0xFD,
+    0x5D, 0x7A, 0x93, 0xAF, 0xAC, 0x28, 0x74, 0xF4, 0xB6, 0xBF, 0x56, 0x8B, 0x69, 0xD1, 0x9A, 0x25,
+    0x87, 0xDA, 0x8A, 0x57, 0x4B, 0xBF, 0x83, 0x52, 0x39, 0xB5, 0x05, 0x5B, 0x21, 0x25, 0x57, 0xD5,
+    0xFD, 0x1C, 0xB8, 0xDF, 0x44, 0x8E, 0x7C, 0x4B, 0x1B, 0x31, 0xD0, 0x87, 0xF1, 0xD1, 0x08, 0x6A,
+    0x75, 0xB2, 0xDC, 0xFA, 0xE6, 0xB2, 0x7B, 0x10, 0x43, 0xF4, 0x0F, 0x72, 0xF3, 0x0F, 0xD0, 0x5E,
+    0x52, 0x99, 0x9D, 0x7D, 0x83, 0x15, 0x73, 0xAF, 0x25, 0xE3, 0x00, 0xF4, 0x86, 0xA0, 0x2F, 0x64,
+    0xD8, 0x13, 0x02, 0x8C, 0x04, 0x22, 0x20, 0x04, 0x80, 0x80, 0x0F, 0x33, 0x6E, 0xAD, 0x05, 0x07,
+    0xD8, 0x10, 0x1A, 0xFC, 0x27, 0x2E, 0x81, 0x0B, 0x60, 0xD9, 0x62, 0x76, 0x3A, 0x4A, 0x81, 0x09,
+    0x21, 0x79, 0xF1, 0xAB, 0xE6, 0x96, 0x15, 0x51, 0x5A, 0x15, 0x0A, 0x2F, 0x73, 0x29, 0x1C, 0xA0,
+    0x0B, 0x3C, 0xC4, 0x22, 0xDE, 0xEC, 0x69, 0x33, 0xBD, 0x65, 0xE3, 0x79, 0x38, 0x49, 0x08, 0x59,
+    0x7D, 0xD5, 0xF3, 0x91, 0xD0, 0x13, 0x31, 0x44, 0x73, 0x53, 0xC4, 0x68, 0xEE, 0x98, 0x91, 0xFF,
+    0x84, 0xD5, 0x88, 0x42, 0xEB, 0x64, 0xE3, 0x45, 0xD2, 0x74, 0x45, 0x52, 0x14, 0x3C, 0x45, 0x4F,
+    0xE1, 0x53, 0xFC, 0x14, 0x40, 0x5B, 0x19, 0xB3, 0xB5, 0xC2, 0x74, 0x91, 0x15, 0x88, 0xF5, 0xE1,
+    0x48, 0x7D, 0xA4, 0x54, 0x13, 0x06, 0x71, 0x33, 0x08, 0x94, 0x3A, 0x63, 0x9F, 0xE4, 0x21, 0x98,
+    0xE6, 0xD6, 0x7C, 0xD4, 0x04, 0xA3, 0x51, 0x40, 0x15, 0x51, 0x0B, 0xA9, 0x95, 0x20, 0xD1, 0x4A,
+    0xC8, 0x49, 0xC4, 0x80, 0xB2, 0xE9, 0xB5, 0x52, 0xB1, 0xA6, 0x95, 0xF6, 0xF8, 0xB8, 0xA1, 0xEB,
+    0xA5, 0xCB, 0x23, 0x8C, 0x69, 0x9C, 0x26, 0x69, 0x94, 0x6E, 0xC1, 0x07, 0x94, 0xBB, 0x44, 0xB3,
+    0x9A, 0x4B, 0xA2, 0x59, 0x8F, 0xCE, 0x4B, 0x7A, 0xEB, 0xD5, 0xC3, 0x66, 0xB5, 0x7A, 0xE8, 0xAD,
+    0x67, 0xB6, 0xAB, 0xD5, 0xCC, 0x76, 0x34, 0xCC, 0x6C, 0x63, 0xFC, 0x7A, 0xF7, 0x29, 0xFB, 0x22,
+    0x66, 0x73, 0xE3, 0xA3, 0x35, 0x1F, 0x5B, 0xC6, 0x5C, 0x3C, 0x5C, 0xD3, 0xEB, 0x59, 0x32, 0x19,
+    0x4F, 0xE6, 0xC5, 0x2B, 0x28, 0x07, 0x54, 0x3F, 0x84, 0x3D, 0x47, 0xF8, 0x60, 0xF0, 0xD5, 0x27,
+    0xAD, 0x9F, 0xA0, 0x41, 0xC4, 0xAF, 0x8F, 0x89, 0x48, 0x4F, 0xB4, 0xE9, 0xEB, 0x8E, 0xB6, 0xBF,
+    0xB1, 0x8A, 0x32, 0x70, 0x2A, 0x0A, 0xF8, 0xA7, 0x64, 0xE6, 0x39, 0xF9, 0x83, 0xE8, 0x1A, 0x5A,
+    0x3C, 0x78, 0xBF, 0xA2, 0xA9, 0x2E, 0x7B, 0xCD, 0x65, 0x01, 0x1A, 0x86, 0xB0, 0xFB, 0x0C, 0x67,
+    0x83, 0xF6, 0x22, 0x72, 0x5E, 0x32, 0x47, 0xF0, 0xFB, 0xA7, 0xC5, 0xC0, 0x9F, 0xA5, 0x51, 0xC2,
+    0xF9, 0x8E, 0x50, 0xF1, 0xE8, 0xEA, 0x05, 0x3E, 0xBB, 0xD4, 0x08, 0x92, 0x87, 0xD4, 0x08, 0x32,
+    0x07, 0xAB, 0xC8, 0x61, 0x6D, 0x35, 0x99, 0xF2, 0xBB, 0xF3, 0x7E, 0xE4, 0xAD, 0xD9, 0x75, 0x75,
+    0xC9, 0x77, 0xAF, 0x9E, 0x3C, 0x21, 0xEF, 0x3E, 0x39, 0x3E, 0x03, 0x31, 0xF3, 0xBB, 0x16, 0x0D,
+    0x65, 0x5A, 0x3E, 0xE0, 0xC9, 0xFA, 0xBD, 0x7B, 0xE7, 0x85, 0xF1, 0x13, 0x9F, 0xA6, 0xEB, 0x1D,
+    0x38, 0x51, 0x99, 0x86, 0xDD, 0xD8, 0xE7, 0x03, 0xD4, 0xFD, 0x31, 0x4E, 0x26, 0x20, 0xFE, 0x8B,
+    0xD9, 0xDF, 0x42, 0x14, 0xA1, 0x85, 0x9C, 0x34, 0x58, 0x32, 0x53, 0x78, 0x76, 0xDF, 0xED, 0xDA,
+    0x8B, 0xDD, 0x35, 0xB7, 0x98, 0xC2, 0x95, 0x88, 0x52, 0xEC, 0xE4, 0x4B, 0xDC, 0xC9, 0xD3, 0xE4,
+    0x63, 0x93, 0xCA, 0x75, 0x93, 0xDC, 0x6C, 0x92, 0x8F, 0xCB, 0x04, 0xFA, 0x1D, 0xF2, 0x41, 0xBF,
+    0x08, 0x8F, 0x57, 0xE7, 0xC8, 0xF7, 0xA0, 0xA1, 0x13, 0x05, 0x4B, 0x34, 0xF9, 0x67, 0x14, 0xFD,
+    0x51, 0x3F, 0xFA, 0x39, 0xE0, 0x13, 0x8D, 0x3D, 0x22, 0x7F, 0x19, 0x35, 0xA9, 0xEA, 0x9F, 0x70,
+    0x86, 0xD6, 0x82, 0x25, 0xFD, 0xC3, 0xC0, 0x46, 0x2C, 0xAC, 0x70, 0x59, 0xFC, 0x77, 0x69, 0x4E,
+    0xE1, 0x91, 0xBD, 0x17, 0x9C, 0x9B, 0x43, 0x87, 0x08, 0x19, 0xB5, 0x57, 0x91, 0xD1, 0x71, 0x91,
+    0x4D, 0x73, 0x6D, 0x46, 0x27, 0x4E, 0x99, 0xCC, 0xE9, 0x33, 0x3A, 0xBB, 0x24, 0x80, 0x70, 0x79,
+    0xEE, 0xA3, 0x3F, 0xE2, 0x28, 0xEE, 0xF9, 0x23, 0x34, 0x9D, 0xFE, 0xA2, 0x39, 0x16, 0x75, 0xEF,
+    0x76, 0x75, 0x30, 0x43, 0x6A, 0xE7, 0xFC, 0xA2, 0x7B, 0xD4, 0x74, 0xD4, 0x7C, 0x5D, 0x37, 0x3E,
+    0x10, 0xA8, 0x69, 0x10, 0xD8, 0xD9, 0x14, 0xCF, 0xB3, 0xC3, 0xEA, 0xFB, 0x7C, 0x38, 0xE4, 0xB2,
+    0xC3, 0x20, 0xF6, 0x06, 0x7D, 0x4E, 0x92, 0xB5, 0xF1, 0x2B, 0x73, 0x10, 0x70, 0xF3, 0x52, 0x0F,
+    0x3E, 0xB8, 0x5C, 0xE8, 0x3E, 0x80, 0x4A, 0x66, 0xA2, 0x60, 0xC9, 0x50, 0x3F, 0x23, 0x69, 0x53,
+    0x77, 0x25, 0x24, 0x82, 0xA7, 0xD9, 0x4C, 0x70, 0x8A, 0x3E, 0xB8, 0xFE, 0xAC, 0x9F, 0x7B, 0x33,
+    0x73, 0x60, 0x64, 0xD1, 0x64, 0xA8, 0xC4, 0x3E, 0x40, 0x69, 0x17, 0x0F, 0xB8, 0x78, 0xE5, 0x29,
+    0xFB, 0x13, 0x3F, 0xE3, 0xB7, 0xCF, 0x0E, 0x62, 0xE7, 0xCD, 0xE3, 0x6C, 0x67, 0x66, 0x1A, 0x6B,
+    0xCC, 0xEE, 0xD9, 0x6F, 0xC3, 0x5E, 0x5D, 0x61, 0xF7, 0xF8, 0xB5, 0x23, 0x07, 0x03, 0xD6, 0x23,
+    0xC8, 0x02, 0xC6, 0xEF, 0xE1, 0x41, 0x52, 0x10, 0x31, 0x15, 0xF7, 0xD7, 0xAB, 0xCE, 0xAD, 0x26,
+    0x00, 0xF7, 0x18, 0xCC, 0x7D, 0x07, 0x8E, 0xE6, 0x0C, 0x62, 0x33, 0x2F, 0xB4, 0xA9, 0x95, 0xB6,
+    0xA3, 0xDA, 0xED, 0x62, 0x3A, 0x2F, 0xEF, 0xEC, 0x29, 0x3C, 0x37, 0xFB, 0xF0, 0x34, 0x5A, 0x8E,
+    0xB6, 0x69, 0xEA, 0xA3, 0xF9, 0x83, 0x67, 0xFD, 0xB3, 0x60, 0xF3, 0xC7, 0xC1, 0x68, 0xAF, 0xED,
+    0x0F, 0x8D, 0x2D, 0x80, 0x78, 0x95, 0xAD, 0x88, 0x1C, 0x59, 0x7B, 0x34, 0xAC, 0x4F, 0x67, 0xD4,
+    0xF2, 0x8D, 0x0B, 0x47, 0xE1, 0x9A, 0x2C, 0xE3, 0xE8, 0x7E, 0x64, 0xA8, 0xB8, 0xC0, 0x39, 0x81,
+    0xA3, 0x03, 0x2F, 0x05, 0xD9, 0xBB, 0x2D, 0x38, 0x2D, 0x5E, 0x87, 0xBC, 0xA6, 0xFC, 0xE0, 0x0B,
+    0xAD, 0x13, 0x66, 0x3D, 0xE2, 0x1C, 0x95, 0x9A, 0x06, 0x9D, 0x01, 0x28, 0x44, 0xB7, 0xE6, 0x54,
+    0x5C, 0xFA, 0xEC, 0x2F, 0x3F, 0x1B, 0x95, 0x08, 0xB1, 0x5B, 0xF3, 0x76, 0xC4, 0xF2, 0xE4, 0xCC,
+    0x54, 0x51, 0x09, 0x82, 0x66, 0xEE, 0x38, 0x44, 0xD6, 0xD6, 0x8C, 0x44, 0x6B, 0x96, 0xAC, 0x88,
+    0x04, 0x69, 0xF8, 0x2E, 0x83, 0x84, 0xD0, 0x84, 0x3F, 0x07, 0xF7, 0xD9, 0x69, 0x13, 0x7E, 0xC8,
+    0xF6, 0x24, 0xD9, 0xFF, 0x8F, 0x19, 0xF9, 0x5D, 0x32, 0xC1, 0x27, 0x64, 0x13, 0xCF, 0x36, 0xDB,
+    0x90, 0x48, 0xB3, 0x34, 0x49, 0x69, 0x1F, 0x21, 0x49, 0xD2, 0xF9, 0xB3, 0x84, 0x1B, 0xD7, 0x86,
+    0x65, 0x39, 0xDB, 0x8A, 0xA7, 0xC0, 0xB0, 0xF9, 0x0E, 0x72, 0x11, 0xAC, 0xE2, 0x21, 0x2A, 0xE5,
+    0xB8, 0x78, 0x8D, 0x17, 0x21, 0x4F, 0x61, 0x85, 0x84, 0x4D, 0xEA, 0x55, 0x32, 0x63, 0x97, 0xBA,
+    0x95, 0x57, 0x3B, 0x9F, 0xA7, 0xEE, 0xD8, 0xAB, 0xBD, 0x4F, 0x52, 0xAF, 0xF4, 0x6A, 0xFF, 0xF5,
+    0xDC, 0xCF, 0xBD, 0x3A, 0x8C, 0xF2, 0x40, 0xF6, 0xFC, 0x64, 0x94, 0x1F, 0x95, 0xB7, 0xCD, 0x28,
+    0xDF, 0x94, 0xB7, 0x4B, 0x51, 0x7E, 0x49, 0xDE, 0xEA, 0x30, 0x97, 0x60, 0xE6, 0xD7, 0xE3, 0xF0,
+    0xBD, 0xD2, 0x78, 0xFF, 0x5B, 0x86, 0x1F, 0x88, 0x9D, 0xF8, 0xC2, 0x84, 0xFF, 0x4E, 0x35, 0x8C,
+    0x47, 0x1F, 0x05, 0xED, 0x90, 0x09, 0x74, 0xEB, 0xE7, 0x59, 0x65, 0xEE, 0xB0, 0xC7, 0xC1, 0x27,
+    0x6F, 0x11, 0x59, 0xBD, 0x4A, 0x19, 0x98, 0x00, 0x4F, 0x37, 0x77, 0x97, 0x83, 0xC0, 0xA4, 0xAB,
+    0xA2, 0xAE, 0x8A, 0x67, 0x3B, 0xC7, 0xBB, 0x1D, 0xE4, 0x96, 0x5A, 0xBA, 0xD3, 0x13, 0xF6, 0x5E,
+    0x57, 0xFC, 0x2F, 0x1F, 0x5F, 0x0F, 0x99, 0x48, 0x3B, 0x4D, 0x94, 0x2E, 0x53, 0xA0, 0xF8, 0x7B,
+    0x85, 0xDE, 0xA7, 0x6D, 0xF8, 0x19, 0x63, 0xE1, 0xFF, 0x59, 0x2C, 0xBB, 0xE4, 0x85, 0xD7, 0x8F,
+    0xF2, 0x44, 0x99, 0xAB, 0xDB, 0xA0, 0x0F, 0x1A, 0xF7, 0x7E, 0x83, 0x36, 0x78, 0xEA, 0xEF, 0xDD,
+    0xD1, 0x98, 0xF2, 0xF6, 0x16, 0xCB, 0xA1, 0x90, 0x03, 0x2F, 0x5F, 0x6E, 0x32, 0xC3, 0x6E, 0x7A,
+    0x78, 0xF2, 0x9F, 0x58, 0x14, 0x48, 0xA3, 0x6B, 0xD7, 0x9D, 0x10, 0x0A, 0x7F, 0x5D, 0x25, 0x4C,
+    0xCE, 0x99, 0xFE, 0x76, 0x1D, 0x78, 0xEB, 0x15, 0x58, 0xF2, 0x6B, 0x04, 0x46, 0xB2, 0x03, 0x0C,
+    0x1D, 0xCE, 0x30, 0xB7, 0xB3, 0x49, 0xE7, 0x9A, 0x75, 0x72, 0x16, 0x17, 0x35, 0xEA, 0xEC, 0x7F,
+    0x1D, 0xC5, 0xE0, 0x80, 0x0F, 0x1E, 0xFF, 0xD1, 0xF0, 0x2B, 0x9B, 0xF3, 0x9E, 0xB0, 0xF4, 0x11,
+    0xDF, 0x57, 0xE2, 0xDE, 0x61, 0x4D, 0x54, 0x6B, 0x25, 0x1C, 0xCD, 0x24, 0xD8, 0xED, 0xA9, 0xB2,
+    0x7D, 0xB8, 0x0B, 0x7C, 0xE4, 0xA5, 0xFF, 0x1D, 0x48, 0xD5, 0xBC, 0x9F, 0xC0, 0x26, 0x66, 0xAF,
+    0xAD, 0x30, 0x10, 0xF1, 0x71, 0xDB, 0xA4, 0xC3, 0xB3, 0x1A, 0xE7, 0x38, 0xE1, 0x26, 0x73, 0x00,
+    0x97, 0x8C, 0xDB, 0x22, 0x67, 0xEA, 0x4F, 0x17, 0xCA, 0x46, 0x1F, 0xCC, 0xE2, 0x32, 0x2E, 0xE5,
+    0xD3, 0x7E, 0x59, 0xED, 0xFA, 0xA5, 0x16, 0xC3, 0x57, 0xBE, 0x3C, 0xC9, 0x2F, 0x4F, 0xF1, 0xCB,
+    0x4D, 0x7E, 0x39, 0x35, 0xC9, 0xDD, 0xEB, 0x6F, 0x4D, 0xF0, 0xEB, 0x12, 0x34, 0x1B, 0xB1, 0x9C,
+    0xB3, 0x5B, 0xFC, 0xDA, 0x9E, 0x57, 0x56, 0x80, 0xEF, 0x72, 0xFD, 0x15, 0x0B, 0x37, 0x71, 0x71,
+    0x0D, 0xC5, 0x35, 0x26, 0x64, 0x44, 0x89, 0x7A, 0xB3, 0xE8, 0x63, 0x2E, 0x6F, 0xF5, 0xF3, 0x43,
+    0xF8, 0xFC, 0x79, 0x98, 0x9E, 0x53, 0xC0, 0xF6, 0x0A, 0xD0, 0x9B, 0x62, 0xCE, 0x89, 0x99, 0x3F,
+    0x4A, 0x71, 0x7B, 0x90, 0x40, 0xD1, 0xF1, 0xF2, 0xAE, 0xDA, 0x74, 0xDF, 0x21, 0xE8, 0xCC, 0xC5,
+    0x3B, 0x9E, 0x37, 0x24, 0x06, 0xE9, 0x2E, 0xA2, 0xBB, 0x67, 0x08, 0x3A, 0x78, 0x98, 0x59, 0xA6,
+    0xE4, 0x91, 0xB9, 0x79, 0x75, 0xD1, 0xF0, 0x9D, 0xD4, 0xC3, 0xE6, 0xAD, 0x7D, 0x8B, 0xE0, 0x73,
+    0xE6, 0x6B, 0x70, 0x1D, 0x44, 0x67, 0xF8, 0xEF, 0xD7, 0x36, 0x0D, 0xA2, 0x59, 0x90, 0xF6, 0x59,
+    0xC9, 0xA0, 0xFB, 0x53, 0xB5, 0xD4, 0xB8, 0x16, 0xCD, 0xF6, 0xA2, 0x19, 0x91, 0xD7, 0xF0, 0xEA,
+    0x20, 0x9D, 0x2B, 0x88, 0x6A, 0xF0, 0xF8, 0xEB, 0x7A, 0x4B, 0x7B, 0x3E, 0xF8, 0x4D, 0x0E, 0x66,
+    0xF7, 0x96, 0xF6, 0x76, 0xD5, 0xEB, 0xD1, 0xDF, 0x4B, 0xE6, 0x3E, 0x24, 0x2F, 0xB3, 0xB4, 0xE0,
+    0x20, 0x87, 0x65, 0xB3, 0x12, 0x8B, 0x53, 0xC3, 0xE6, 0x72, 0xDB, 0x5D, 0xFE, 0x7F, 0xED, 0x5C,
+    0x3F, 0x8C, 0x1C, 0x69, 0x56, 0xFF, 0xAA, 0x6A, 0xED, 0xBA, 0x73, 0x71, 0x2E, 0x0B, 0xF9, 0xD0,
+    0xB2, 0x73, 0xEB, 0x22, 0xB8, 0x60, 0xF1, 0x7A, 0xB6, 0x12, 0x04, 0x16, 0x1A, 0xBB, 0xEA, 0x74,
+    0x01, 0x01, 0x89, 0x83, 0x33, 0x09, 0x81, 0x13, 0x02, 0x4E, 0x48, 0x67, 0x82, 0x0D, 0x1C, 0x8C,
+    0xDD, 0x05, 0x04, 0x84, 0x37, 0x12, 0xE8, 0x90, 0x20, 0x71, 0xE0, 0x60, 0xB1, 0x03, 0x5F, 0x60,
+    0xA4, 0x3D, 0xC9, 0xD3, 0x55, 0xB7, 0x1B, 0x6C, 0x48, 0xDD, 0xA2, 0x25, 0x41, 0x62, 0xEB, 0x8E,
+    0x5D, 0x81, 0xBC, 0x42, 0x5B, 0x48, 0x6D, 0x5D, 0x7B, 0xE8, 0xEE, 0x8F, 0xF7, 0xFB, 0xBD, 0xEF,
+    0xAB, 0xEA, 0x9E, 0xF1, 0x1E, 0x20, 0xE1, 0x61, 0x7C, 0xD0, 0x63, 0x57, 0xD5, 0x74, 0xD7, 0x9F,
+    0xF7, 0xFD, 0xBE, 0xF7, 0xDE, 0xF7, 0x7E, 0xEF, 0xBD, 0x1E, 0x63, 0xF0, 0xBA, 0xCB, 0x6D, 0xB8,
+    0x30, 0x66, 0xCB, 0x76, 0xD8, 0xD9, 0xCF, 0x96, 0x66, 0x61, 0xE2, 0xB9, 0x99, 0x54, 0x33, 0x93,
+    0x37, 0x26, 0xFD, 0xB0, 0x33, 0x13, 0x63, 0x12, 0x5B, 0x9A, 0xA5, 0x31, 0xF1, 0xCC, 0x44, 0x72,
+    0x52, 0x34, 0xC3, 0x91, 0x89, 0xE6, 0x26, 0xED, 0x75, 0xD7, 0x71, 0x27, 0xE7, 0x63, 0x57, 0x34,
+    0x3C, 0xB3, 0xA8, 0x86, 0x5D, 0xD2, 0x9B, 0xA2, 0x34, 0x38, 0x6D, 0x22, 0xBB, 0xAC, 0xE5, 0x6F,
+    0x72, 0x1A, 0x76, 0xF2, 0x0E, 0x4E, 0x59, 0xC9, 0xFB, 0x0D, 0x25, 0x91, 0xB3, 0x92, 0x9E, 0x0F,
+    0xC1, 0xFD, 0x02, 0xFB, 0x97, 0x2B, 0xC8, 0x98, 0xDB, 0x4F, 0x28, 0xEB, 0xB7, 0x8C, 0x7B, 0xA5,
+    0x15, 0xDF, 0x6E, 0xB0, 0x95, 0x2B, 0x63, 0xDB, 0xA5, 0x72, 0xC3, 0xCF, 0x16, 0x29, 0x24, 0x9D,
+    0x6E, 0xE3, 0xFA, 0x42, 0xEE, 0xD4, 0xE1, 0xEE, 0xF8, 0xA4, 0xC2, 0xB9, 0xB2, 0x75, 0xFF, 0xF8,
+    0x54, 0x19, 0x99, 0x1C, 0xD4, 0x06, 0x07, 0xB5, 0xFF, 0xB7, 0xC4, 0xAF, 0x81, 0x08, 0x52, 0x98,
+    0x48, 0xE4, 0xC8, 0xAB, 0xB4, 0x95, 0xA7, 0x3D, 0xAD, 0x45, 0xD6, 0xD0, 0xCE, 0xF1, 0xB8, 0x53,
+    0x5E, 0x06, 0x73, 0xBA, 0x52, 0x59, 0xBA, 0x89, 0xED, 0x43, 0x9B, 0x76, 0x37, 0xED, 0xDD, 0xB0,
+    0x8E, 0x3B, 0x80, 0x94, 0xC5, 0x8D, 0x60, 0x61, 0x2E, 0xA4, 0xA5, 0x48, 0x62, 0xDE, 0x7A, 0x6C,
+    0x62, 0xB9, 0x59, 0xB1, 0xC7, 0xB1, 0xED, 0x18, 0x08, 0x86, 0x1D, 0xEE, 0x7D, 0xCB, 0x40, 0x40,
+    0xF3, 0x88, 0xE3, 0x30, 0xBD, 0x0E, 0x0A, 0x27, 0x57, 0x26, 0xE8, 0x29, 0x61, 0xD0, 0x41, 0x1A,
+    0x13, 0xB6, 0x94, 0x34, 0x92, 0x8F, 0xA7, 0xC3, 0x2E, 0xAE, 0x28, 0x72, 0x52, 0xF2, 0xB7, 0xD4,
+    0xF0, 0x94, 0x2B, 0x06, 0x97, 0x63, 0x10, 0x26, 0x5D, 0x3D, 0xEC, 0x30, 0xC7, 0x56, 0xA6, 0x10,
+    0xB2, 0x97, 0x5E, 0xF6, 0x60, 0x86, 0x2D, 0x44, 0x85, 0x06, 0x14, 0x4B, 0x91, 0x65, 0xFE, 0xE6,
+    0x42, 0x44, 0xE9, 0x65, 0x16, 0xB2, 0xF7, 0xDB, 0x50, 0x26, 0x74, 0x65, 0x42, 0x99, 0x86, 0x3D,
+    0x00, 0x21, 0xCF, 0xD7, 0xAD, 0x8C, 0x63, 0x42, 0xF9, 0xA7, 0x14, 0x7F, 0x49, 0xE9, 0x31, 0x6F,
+    0x0D, 0x66, 0x2F, 0xAB, 0xE2, 0x05, 0x40, 0x3B, 0x3B, 0xC7, 0xF6, 0xD7, 0xB1, 0x6D, 0x7E, 0xB2,
+    0x38, 0x67, 0x32, 0xFB, 0x43, 0xDB, 0x9B, 0x64, 0x65, 0x6A, 0x91, 0xF7, 0x9A, 0x79, 0xC5, 0x8C,
+    0xAF, 0x3D, 0xF9, 0xDD, 0xBF, 0x1E, 0xC5, 0xCD, 0x70, 0x7C, 0x25, 0x1F, 0xCF, 0xC9, 0x97, 0xE3,
+    0x71, 0x36, 0x1B, 0x8F, 0x01, 0xE3, 0x17, 0xBD, 0x72, 0x6B, 0xEF, 0xC9, 0xD9, 0xD6, 0xCA, 0x83,
+    0xDF, 0xB4, 0x18, 0x7F, 0xCE, 0x63, 0x11, 0x39, 0xEF, 0x30, 0x12, 0x28, 0xEA, 0x02, 0x3A, 0x2A,
+    0x13, 0x21, 0xD3, 0x2B, 0x70, 0xC9, 0xBF, 0x5B, 0x26, 0x58, 0xA9, 0x49, 0xAC, 0xCC, 0xF7, 0x61,
+    0x09, 0x50, 0x69, 0xE8, 0x85, 0x2A, 0xFB, 0x4C, 0x8F, 0xA9, 0xE3, 0xBD, 0x1E, 0x43, 0x33, 0xDC,
+    0x71, 0xB8, 0x72, 0x32, 0xC9, 0x31, 0x2E, 0xE5, 0xFC, 0xD6, 0x7A, 0x29, 0x8F, 0xAD, 0x5E, 0xCA,
+    0x99, 0x5E, 0xE9, 0xA5, 0x98, 0xEE, 0x60, 0x69, 0x42, 0x8E, 0x30, 0xAF, 0xF0, 0x68, 0x5E, 0x8A,
+    0x89, 0x77, 0x26, 0xC6, 0xD9, 0x87, 0x11, 0x11, 0x1C, 0x41, 0x3F, 0xEB, 0x70, 0xA7, 0xAF, 0xF0,
+    0xDE, 0x45, 0x83, 0x4B, 0xB7, 0x71, 0xBF, 0xC0, 0xF2, 0xD2, 0x1D, 0xDC, 0x6F, 0x4B, 0x2F, 0x7D,
+    0x2C, 0x96, 0xFD, 0xC0, 0x8A, 0xC5, 0x1D, 0xDC, 0x7F, 0x30, 0x37, 0xB5, 0x85, 0x06, 0x4F, 0x04,
+    0x86, 0x11, 0xC3, 0xF3, 0xE6, 0x55, 0x7F, 0x78, 0xC1, 0xCC, 0x1D, 0x6A, 0x26, 0xFD, 0xD3, 0xCE,
+    0x81, 0x26, 0xA6, 0x55, 0x39, 0xCC, 0x4C, 0x84, 0xF1, 0x11, 0x32, 0x13, 0xC8, 0x8D, 0x14, 0xB1,
+    0xC1, 0x87, 0xAC, 0xF4, 0x50, 0xF1, 0x2A, 0xAC, 0x5C, 0xA6, 0x70, 0xF1, 0x50, 0x11, 0xDA, 0x25,
+    0x32, 0x3C, 0xFC, 0x3E, 0x2E, 0x55, 0xAC, 0x5A, 0x9C, 0xE7, 0xA1, 0xEA, 0x06, 0xA4, 0x04, 0x8C,
+    0x01, 0xA8, 0x01, 0x27, 0x3E, 0x50, 0x61, 0xC2, 0x55, 0x1E, 0xA5, 0x6E, 0x00, 0x89, 0x2E, 0x41,
+    0x31, 0x9A, 0xC0, 0x54, 0x09, 0x91, 0xC8, 0x7F, 0xD6, 0x21, 0x24, 0x57, 0x6D, 0x3B, 0x80, 0xE4,
+    0xE9, 0xBB, 0x0E, 0x1F, 0x51, 0x93, 0x85, 0x83, 0xA7, 0xB0, 0x6A, 0xE6, 0xD7, 0xAF, 0x99, 0x50,
+    0x7E, 0xE4, 0x25, 0x4A, 0x13, 0x35, 0xD4, 0xC6, 0xAC, 0x37, 0x61, 0xCF, 0x21, 0x63, 0x10, 0xB6,
+    0xF7, 0x3A, 0x58, 0x73, 0x66, 0x92, 0x96, 0xF2, 0x18, 0x35, 0x68, 0xE7, 0xA7, 0xDC, 0x51, 0x68,
+    0x3F, 0xAF, 0x12, 0xAA, 0x5F, 0xFE, 0x91, 0xAD, 0x52, 0x6B, 0x3B, 0x18, 0x6C, 0x51, 0x66, 0x10,
+    0x58, 0x6C, 0xAD, 0x30, 0x97, 0x20, 0x35, 0xAD, 0xEB, 0x0D, 0x5A, 0x55, 0x4B, 0x2B, 0x9F, 0x13,
+    0x83, 0x25, 0x87, 0x86, 0x71, 0x2F, 0x14, 0x13, 0x79, 0xCC, 0x42, 0x1F, 0xA6, 0xCE, 0x6A, 0xC5,
+    0x41, 0xCB, 0xD9, 0x21, 0x64, 0xAF, 0xE9, 0xA3, 0x7B, 0x1E, 0xC9, 0x75, 0x72, 0x41, 0x29, 0x9F,
+    0x6E, 0xC1, 0x0D, 0x47, 0x70, 0x7B, 0xBF, 0xD1, 0xCB, 0x05, 0xB1, 0xF8, 0xC0, 0x3F, 0xFA, 0xA7,
+    0xFE, 0x17, 0xC5, 0xDA, 0x61, 0x2C, 0x7F, 0x62, 0x7F, 0x2A, 0xF3, 0x2D, 0xCF, 0x59, 0x85, 0xF6,
+    0xB7, 0xAD, 0xC5, 0x0D, 0xAF, 0x99, 0x73, 0x83, 0x2D, 0xC1, 0xC2, 0xED, 0x52, 0x74, 0xE2, 0x13,
+    0x2C, 0x07, 0x73, 0x37, 0xDB, 0x50, 0x60, 0xC2, 0x51, 0x1B, 0xA7, 0x0A, 0xCE, 0x78, 0xE8, 0x94,
+    0x22, 0xE2, 0xA8, 0x2B, 0x86, 0x7E, 0x4E, 0x99, 0x20, 0x22, 0x0F, 0xF0, 0x36, 0x2D, 0xD8, 0xCF,
+    0x3F, 0xDF, 0xE6, 0x01, 0x46, 0x8B, 0x71, 0xF2, 0x73, 0x4E, 0x29, 0xDE, 0x86, 0x46, 0x10, 0x51,
+    0xA2, 0x4C, 0x1C, 0x8C, 0x4C, 0x2C, 0x3E, 0x17, 0xEC, 0x5E, 0xE7, 0x4A, 0x52, 0xC3, 0x00, 0xF0,
+    0xB9, 0x48, 0xB2, 0x8B, 0xCF, 0x65, 0xAE, 0x45, 0x06, 0xF9, 0x7C, 0x6B, 0x75, 0xFF, 0xE1, 0x1C,
+    0xA0, 0xD6, 0x34, 0x80, 0xC1, 0xA5, 0xF8, 0x03, 0xAF, 0xCB, 0x8A, 0xA1, 0x71, 0x72, 0x19, 0x3F,
+    0xDB, 0xC6, 0x2D, 0x35, 0x7C, 0xFD, 0xA6, 0x75, 0x6F, 0x14, 0x6B, 0xDE, 0xC8, 0xA3, 0xB5, 0x50,
+    0xBC, 0x04, 0x07, 0xC2, 0x35, 0xD8, 0xC6, 0x23, 0x07, 0x96, 0xD9, 0x30, 0x1B, 0x6F, 0x33, 0x54,
+    0x33, 0xDC, 0xED, 0x61, 0xAF, 0xCF, 0x93, 0xA1, 0xEB, 0xBE, 0x55, 0x94, 0x64, 0xE0, 0xC4, 0xC6,
+    0xEF, 0x45, 0x16, 0x8A, 0x93, 0x57, 0x8A, 0x90, 0x0C, 0x9A, 0x00, 0x15, 0x0E, 0x9F, 0xC2, 0xC1,
+    0x73, 0xC7, 0xA1, 0x33, 0x75, 0xE0, 0x2C, 0x1D, 0x36, 0x0B, 0x07, 0xCD, 0x42, 0x91, 0x09, 0xE6,
+    0x0A, 0x4C, 0xE8, 0x46, 0x14, 0xF5, 0x9B, 0xFB, 0xD8, 0xF9, 0x5A, 0x68, 0xF9, 0xBA, 0x66, 0xAB,
+    0xC6, 0x9B, 0x8B, 0x0E, 0x46, 0xF8, 0x89, 0x53, 0xD7, 0x4D, 0x20, 0x18, 0x88, 0x98, 0xE2, 0x4C,
+    0xC5, 0x36, 0xB1, 0xB8, 0xC0, 0x6F, 0x50, 0x7D, 0xE9, 0x3A, 0x14, 0xE3, 0x68, 0x16, 0xDB, 0x32,
+    0xEA, 0x4F, 0x5B, 0x3C, 0x64, 0x82, 0x27, 0x4C, 0x70, 0xFB, 0x29, 0xEE, 0xBD, 0xD4, 0x75, 0x25,
+    0xC3, 0x26, 0xAF, 0xE4, 0x9A, 0xBC, 0xA4, 0x99, 0x60, 0x61, 0x77, 0xA7, 0xF7, 0x32, 0xB4, 0x18,
+    0x0B, 0x11, 0xAE, 0x79, 0x45, 0x4E, 0x9F, 0x2C, 0x65, 0x93, 0x77, 0x72, 0x4D, 0xE0, 0xA0, 0x70,
+    0x38, 0x18, 0x80, 0xA0, 0xE8, 0xF3, 0xC1, 0x58, 0x13, 0x83, 0x55, 0xE9, 0x56, 0x96, 0xDA, 0xFE,
+    0x16, 0x34, 0xFF, 0x4D, 0xF9, 0xFF, 0x70, 0x75, 0xDA, 0x1E, 0x60, 0x2E, 0x4A, 0x13, 0xB7, 0xEA,
+    0x70, 0x6D, 0x03, 0xC1, 0x71, 0xA7, 0x40, 0x1C, 0x85, 0x2C, 0xB4, 0xB8, 0x5F, 0xF8, 0x71, 0x67,
+    0x52, 0x18, 0x95, 0x0C, 0xE2, 0x83, 0x1E, 0xEB, 0x2E, 0x5C, 0x54, 0xF4, 0xFE, 0x1C, 0x87, 0x98,
+    0xEC, 0xF8, 0xBD, 0x85, 0xF8, 0x53, 0xEA, 0x56, 0x5C, 0x2D, 0xE1, 0x9F, 0xF1, 0xF0, 0xA4, 0xAC,
+    0xE1, 0x9E, 0xB9, 0x30, 0x4B, 0xE8, 0xB3, 0xA3, 0xD2, 0xA4, 0xF2, 0xA0, 0x1D, 0xD5, 0x81, 0x0B,
+    0x32, 0xE0, 0x5B, 0xAA, 0x06, 0x6F, 0x09, 0x72, 0x8F, 0x54, 0x03, 0xB6, 0xC5, 0x1E, 0x9C, 0x52,
+    0xE0, 0xBC, 0x5E, 0xF5, 0x41, 0xAE, 0x5E, 0x76, 0xAA, 0x0A, 0x12, 0x43, 0x88, 0x43, 0xE1, 0x8C,
+    0x88, 0x92, 0xC1, 0x9F, 0xE1, 0x50, 0xCE, 0x9F, 0x34, 0x1A, 0x46, 0xF5, 0x1A, 0x70, 0x09, 0x26,
+    0x5B, 0xCB, 0x52, 0x56, 0x69, 0x8E, 0xA7, 0x96, 0xA1, 0xA5, 0x3A, 0x1E, 0xF7, 0x9A, 0x8C, 0x87,
+    0xD3, 0xF1, 0x70, 0x5C, 0x7C, 0x07, 0x13, 0x59, 0xB3, 0x0D, 0x35, 0x56, 0x7D, 0xBD, 0x56, 0x57,
+    0xC3, 0x32, 0xFD, 0x6C, 0x7D, 0x31, 0x3E, 0x3F, 0xDE, 0x56, 0x11, 0x2F, 0xAD, 0xC3, 0x1B, 0x9E,
+    0x5E, 0xD1, 0xFE, 0x7D, 0x8F, 0xF5, 0x80, 0xF4, 0x80, 0xB3, 0x47, 0xB9, 0x98, 0x3B, 0x8C, 0xF3,
+    0x99, 0x43, 0x18, 0x8E, 0x8E, 0xF8, 0x8A, 0x4A, 0x28, 0xBA, 0x71, 0xEF, 0xB0, 0x15, 0xD5, 0x50,
+    0x64, 0x45, 0x3D, 0x14, 0x57, 0x01, 0x48, 0x51, 0x95, 0x03, 0xC5, 0x54, 0x70, 0x52, 0x44, 0x45,
+    0x5D, 0x14, 0xCF, 0xBC, 0x74, 0x68, 0x16, 0x1E, 0xCB, 0xC2, 0x23, 0x39, 0xF1, 0x38, 0x4E, 0x3D,
+    0x8A, 0x4B, 0x8F, 0xE1, 0x80, 0x8B, 0x3F, 0x08, 0xBC, 0x0F, 0xF1, 0xE6, 0x34, 0xD8, 0xD1, 0x18,
+    0xB4, 0x78, 0x67, 0x72, 0xA6, 0xF6, 0x8B, 0xC5, 0x80, 0xA9, 0x0F, 0x90, 0xFC, 0xDC, 0x4C, 0xCA,
+    0xCD, 0xFD, 0xF6, 0x17, 0x86, 0x3D, 0xC5, 0x22, 0x11, 0x83, 0x11, 0xD7, 0xB3, 0x28, 0xAC, 0xD9,
+    0x5A, 0x88, 0x8B, 0xE9, 0x8B, 0x52, 0xFC, 0x4C, 0x78, 0x50, 0x15, 0xB0, 0xA0, 0xD0, 0xCA, 0xDC,
+    0x87, 0x8C, 0xE4, 0x69, 0x47, 0xD1, 0x5C, 0xF7, 0x6A, 0x4D, 0xBD, 0x46, 0x76, 0x49, 0xA7, 0xB1,
+    0x9D, 0x6C, 0x68, 0x85, 0x70, 0x39, 0x4D, 0xC0, 0x7D, 0x06, 0x5B, 0x94, 0xA1, 0xE7, 0x15, 0x22,
+    0x44, 0x28, 0x12, 0xCC, 0x12, 0x5A, 0x14, 0xCE, 0xCF, 0xD1, 0xE5, 0x04, 0xB6, 0x9F, 0xD0, 0xE0,
+    0xEA, 0xE6, 0x8E, 0x1B, 0xCC, 0xFE, 0x21, 0x74, 0x16, 0x9B, 0x8E, 0xD6, 0x43, 0xE3, 0x5C, 0xCB,
+    0x69, 0xA7, 0x45, 0x89, 0x53, 0xA1, 0xA0, 0x0C, 0xA8, 0x14, 0x5D, 0xC2, 0xF7, 0xE7, 0x7A, 0xD7,
+    0x89, 0x5E, 0x5C, 0xF4, 0x1B, 0x58, 0xAE, 0xBF, 0x34, 0xC4, 0x75, 0xCB, 0x90, 0x49, 0x74, 0x97,
+    0xEA, 0xB3, 0xAF, 0xE8, 0xEE, 0x96, 0xEE, 0x7A, 0xAA, 0x78, 0xD8, 0x71, 0x17, 0x35, 0xD4, 0x7D,
+    0x68, 0x13, 0x6E, 0xAC, 0x46, 0x71, 0x45, 0xA7, 0xE2, 0x96, 0xEE, 0x94, 0xD0, 0x84, 0x07, 0xF7,
+    0x21, 0x69, 0x64, 0x11, 0xE0, 0x40, 0x0B, 0x60, 0x6A, 0x99, 0xCA, 0xB2, 0xA3, 0x0E, 0xF2, 0x5D,
+    0x5D, 0xB8, 0x74, 0x59, 0xC3, 0x30, 0xC5, 0x1B, 0xDE, 0x78, 0x66, 0x82, 0xFA, 0x99, 0x91, 0xE0,
+    0x2A, 0xE6, 0x32, 0xFB, 0x75, 0x58, 0xC7, 0x15, 0xA8, 0x56, 0x9A, 0x34, 0x58, 0x66, 0x11, 0x74,
+    0x2D, 0x47, 0xC1, 0xBD, 0x22, 0xD9, 0x0F, 0x2B, 0x06, 0x0F, 0x8C, 0x1B, 0xE8, 0x0B, 0x19, 0x2D,
+    0x30, 0x50, 0x60, 0x8C, 0xC0, 0xF0, 0x80, 0x91, 0x01, 0x83, 0x02, 0xC6, 0x03, 0x0C, 0x05, 0x18,
+    0x05, 0x30, 0x00, 0xE0, 0xDA, 0x8F, 0x65, 0xFF, 0x1C, 0x56, 0xFC, 0x3E, 0x59, 0x86, 0xF2, 0x34,
+    0x5D, 0xE7, 0x7F, 0x45, 0x7E, 0xCC, 0x4E, 0x88, 0x30, 0x23, 0xA5, 0x18, 0xC0, 0x60, 0xB1, 0x69,
+    0xE9, 0x3E, 0x14, 0xE0, 0xBA, 0xA6, 0x8B, 0xDA, 0xC2, 0xBB, 0x05, 0xF5, 0xE8, 0x73, 0x7F, 0x01,
+    0xBD, 0x95, 0x5F, 0xC7, 0xDC, 0xAA, 0xEE, 0x97, 0x2D, 0xB7, 0xA4, 0x1F, 0x72, 0xD1, 0x13, 0x17,
+    0x48, 0xE8, 0x8D, 0x11, 0x86, 0x4B, 0x70, 0xB6, 0x07, 0x67, 0xD1, 0xAB, 0x0E, 0x04, 0x9D, 0x60,
+    0x3C, 0xBF, 0xAD, 0x53, 0x5F, 0x74, 0xEE, 0x06, 0xFA, 0xAA, 0xE5, 0x9C, 0x9B, 0xBD, 0xFA, 0x22,
+    0x3C, 0x10, 0xAA, 0xC4, 0x61, 0x34, 0xFA, 0x44, 0x9C, 0x4A, 0xDA, 0xE9, 0x9E, 0x36, 0x71, 0x6B,
+    0x02, 0xA6, 0x7A, 0x2A, 0xD6, 0x36, 0x59, 0xEA, 0xD2, 0x15, 0xE8, 0xED, 0x08, 0x86, 0xA0, 0x01,
+    0xD1, 0x73, 0x72, 0x4D, 0xE2, 0xA1, 0x80, 0x8C, 0xE1, 0x80, 0x7F, 0x6D, 0x21, 0x9C, 0x23, 0x7B,
+    0x56, 0xF2, 0x4C, 0xEE, 0xDC, 0x92, 0x28, 0xF5, 0x64, 0xCE, 0xBD, 0x12, 0x67, 0xE5, 0xCD, 0x4A,
+    0x9B, 0x95, 0x35, 0x2B, 0x69, 0x56, 0xCE, 0xAC, 0x94, 0x59, 0x19, 0xB3, 0x12, 0x66, 0xE5, 0xCB,
+    0x4A, 0x97, 0x95, 0x2D, 0x2B, 0x59, 0x56, 0xAE, 0xAC, 0x54, 0x59, 0x99, 0xB2, 0x23, 0xCA, 0x8E,
+    0x27, 0x7F, 0xCB, 0x0D, 0xC2, 0x2B, 0x56, 0x96, 0xF8, 0x19, 0x55, 0xC5, 0xDA, 0x98, 0xD1, 0x18,
+    0xC2, 0x0B, 0x75, 0x86, 0xA3, 0x9F, 0xEA, 0xFA, 0x0A, 0xDE, 0x5C, 0x92, 0x36, 0x93, 0x35, 0x93,
+    0x34, 0x93, 0x33, 0x93, 0x32, 0x93, 0x31, 0x93, 0x2D, 0x93, 0x2F, 0x53, 0xD9, 0x24, 0xB2, 0x44,
+    0xEC, 0x0D, 0x87, 0x01, 0xAE, 0xAC, 0x54, 0x59, 0x99, 0x72, 0x58, 0x06, 0x30, 0x96, 0x36, 0xC3,
+    0x4C, 0xCF, 0xE8, 0x0A, 0x6A, 0x0A, 0x50, 0xB4, 0xC6, 0x6C, 0x4C, 0x22, 0xB5, 0x00, 0x54, 0x7A,
+    0x49, 0x26, 0x3D, 0x27, 0x91, 0x2E, 0xC9, 0xA3, 0x29, 0xF3, 0x36, 0x91, 0xDF, 0x71, 0x24, 0x5A,
+    0x39, 0xB4, 0x52, 0x68, 0x65, 0xD0, 0x4A, 0xA0, 0x95, 0x3F, 0x2B, 0x7D, 0x56, 0xF6, 0xAC, 0xE4,
+    0x59, 0xB9, 0xF3, 0xD4, 0x6F, 0xE3, 0xCA, 0x11, 0x67, 0xE5, 0xCD, 0x4A, 0x9B, 0x95, 0x35, 0x2B,
+    0x69, 0x76, 0x9C, 0xD9, 0x51, 0x66, 0xF2, 0xA4, 0x0B, 0x34, 0x68, 0xE1, 0x46, 0xCA, 0x8A, 0x22,
+    0xBB, 0xB9, 0x26, 0xCA, 0xF5, 0xF0, 0x99, 0xA4, 0xD1, 0x60, 0xD1, 0x0D, 0x5D, 0x24, 0x38, 0x74,
+    0x49, 0xF2, 0xCC, 0x0D, 0x8D, 0x96, 0x5E, 0x56, 0x5D, 0xAC, 0xFA, 0x57, 0x9C, 0x0E, 0xEE, 0x4C,
+    0xEA, 0x4C, 0xE6, 0x4C, 0xE2, 0x4C, 0xDE, 0xAC, 0xB4, 0x59, 0x59, 0xF3, 0x57, 0xAF, 0x63, 0x6E,
+    0x0B, 0xC2, 0x7B, 0xF1, 0xFE, 0xBD, 0xE1, 0xC1, 0x6F, 0x04, 0x7B, 0xD0, 0x64, 0x6A, 0xE6, 0x8A,
+    0xDB, 0xDD, 0xA8, 0x7D, 0x19, 0x80, 0x0D, 0xAC, 0xAC, 0xA0, 0x21, 0x36, 0xE3, 0x2B, 0xEA, 0x72,
+    0xD8, 0x8C, 0x3C, 0x43, 0x36, 0x72, 0x4A, 0xF5, 0xE5, 0xE3, 0x84, 0xD8, 0x04, 0xEF, 0x8C, 0x01,
+    0x8E, 0x2E, 0x49, 0x54, 0x5D, 0xF8, 0x74, 0x59, 0xCC, 0xAE, 0xE1, 0xF8, 0x0E, 0x97, 0xAC, 0x9A,
+    0x5B, 0x3D, 0x3E, 0x6F, 0xCA, 0x13, 0xAE, 0xC1, 0xCE, 0x7F, 0x37, 0xDE, 0xD5, 0xD2, 0xB7, 0x77,
+    0x46, 0x93, 0x47, 0x61, 0x7B, 0xC1, 0x28, 0xDA, 0x09, 0x36, 0x51, 0xFB, 0xD6, 0x71, 0x42, 0xFE,
+    0x25, 0x26, 0x21, 0x52, 0x58, 0x97, 0x89, 0x3F, 0x20, 0x25, 0xB4, 0x95, 0x5F, 0x04, 0xE4, 0x8C,
+    0x97, 0x1A, 0xF2, 0x0E, 0x89, 0xBB, 0xC7, 0x50, 0xA1, 0x62, 0xDF, 0xE7, 0xAF, 0xCE, 0xEC, 0x8D,
+    0x90, 0x97, 0xBA, 0x39, 0x66, 0xC8, 0x5F, 0x2B, 0xC7, 0xB0, 0x49, 0x95, 0x3C, 0xD4, 0x55, 0xED,
+    0x11, 0x21, 0x3F, 0xFF, 0x32, 0x43, 0xAE, 0x2E, 0x79, 0x7F, 0x08, 0xA0, 0x95, 0x41, 0x80, 0x07,
+    0x75, 0x67, 0x10, 0x6D, 0x02, 0x6D, 0x6C, 0xC2, 0x2E, 0x3B, 0x56, 0xC7, 0x62, 0x90, 0x52, 0x85,
+    0xC3, 0x8B, 0xDA, 0xAC, 0x8F, 0x08, 0x15, 0xA2, 0x26, 0x64, 0x01, 0x02, 0x4D, 0x18, 0x6C, 0x49,
+    0x74, 0x65, 0xFF, 0x62, 0x1E, 0xCF, 0xA2, 0x59, 0xD6, 0x8A, 0x5A, 0x54, 0x69, 0x57, 0x88, 0x2C,
+    0x13, 0x01, 0xA8, 0x40, 0xDC, 0xF7, 0xF7, 0x33, 0x59, 0xC6, 0x99, 0x42, 0x65, 0x36, 0x97, 0x8B,
+    0x01, 0x23, 0x32, 0x59, 0x0C, 0xDE, 0x19, 0x46, 0xF2, 0xCB, 0x06, 0x8B, 0x41, 0x41, 0x0F, 0x36,
+    0xE1, 0xF6, 0x6A, 0xD8, 0x3F, 0x37, 0x38, 0xD6, 0x10, 0x53, 0x43, 0x63, 0x8D, 0x8C, 0x35, 0x30,
+    0xD6, 0xB8, 0x98, 0x61, 0xB1, 0x46, 0xC5, 0x1A, 0x14, 0x6B, 0x4C, 0xAC, 0x21, 0xB1, 0x46, 0xC4,
+    0x1A, 0x10, 0x73, 0x02, 0x35, 0x1C, 0xD6, 0x68, 0x58, 0x83, 0x61, 0x8D, 0x85, 0x35, 0x14, 0xD6,
+    0x48, 0x98, 0x81, 0xB0, 0xC6, 0xC1, 0x1A, 0x06, 0xBB, 0x28, 0x38, 0x64, 0xBA, 0x90, 0x71, 0xF4,
+    0x18, 0x97, 0xB4, 0x57, 0x11, 0xCB, 0x4D, 0xDC, 0x26, 0x2C, 0x5F, 0x3D, 0xCE, 0x70, 0xD8, 0x81,
+    0x8B, 0xA4, 0x97, 0x18, 0xCB, 0x1A, 0xB8, 0x2E, 0xCD, 0xB3, 0x38, 0xB2, 0x3D, 0x77, 0x82, 0xC1,
+    0x6D, 0x0E, 0x83, 0x6B, 0xCE, 0x0C, 0xB1, 0x17, 0x42, 0x4A, 0x93, 0x99, 0x63, 0x05, 0x77, 0x23,
+    0x2E, 0x99, 0x0D, 0x1E, 0xE5, 0xF9, 0x94, 0x56, 0xE4, 0x67, 0xE6, 0xD4, 0x84, 0xB5, 0x3B, 0x30,
+    0x3B, 0x4B, 0x5D, 0xBA, 0xCC, 0xDF, 0x2C, 0x58, 0x17, 0x31, 0xE6, 0xDF, 0xDC, 0x41, 0xF4, 0x9E,
+    0x70, 0x5C, 0x66, 0x0E, 0xBF, 0xE9, 0xEE, 0x7B, 0xC1, 0x87, 0xBB, 0x3B, 0x3E, 0x6E, 0x9F, 0xB9,
+    0x8C, 0x45, 0xD8, 0xA5, 0x9F, 0x5E, 0x87, 0x6F, 0x88, 0x9B, 0xD4, 0x5A, 0x32, 0x14, 0x93, 0x7E,
+    0xC4, 0x77, 0xAE, 0x78, 0x46, 0x39, 0xBD, 0xAF, 0xC9, 0xDD, 0xC0, 0x3A, 0x00, 0xA3, 0xC6, 0xA5,
+    0xBC, 0x12, 0x9F, 0x3A, 0xC9, 0x5C, 0x82, 0x0D, 0x93, 0x21, 0x13, 0x79, 0x49, 0x1E, 0xC0, 0xA4,
+    0xC9, 0x0E, 0x5C, 0x2A, 0x72, 0x6C, 0x73, 0x70, 0x3E, 0x24, 0xD9, 0x66, 0x60, 0x7D, 0xC3, 0x20,
+    0x5C, 0xB0, 0xA3, 0xEE, 0x2B, 0xB6, 0xF6, 0xC8, 0xC0, 0x63, 0xDB, 0x66, 0xB2, 0x02, 0x16, 0xDF,
+    0x7B, 0xB6, 0x9C, 0x00, 0xF4, 0xA2, 0x97, 0xF9, 0x15, 0xF6, 0x2D, 0x61, 0x36, 0x6B, 0x6A, 0x69,
+    0x4B, 0x92, 0x91, 0x35, 0xA2, 0x0E, 0x2B, 0x8D, 0xD3, 0x97, 0xB2, 0x64, 0x16, 0x65, 0xB0, 0xBC,
+    0x31, 0x93, 0x0F, 0xE8, 0x19, 0x65, 0x6A, 0x9E, 0x95, 0xCC, 0x09, 0x6B, 0x6A, 0x98, 0xD5, 0x85,
+    0x89, 0x2A, 0x64, 0x61, 0x5E, 0x5F, 0x98, 0x2F, 0x0B, 0xB9, 0x78, 0xDB, 0x8A, 0xB4, 0x99, 0xED,
+    0x10, 0x58, 0xC6, 0xB6, 0x4C, 0x00, 0xC6, 0xB9, 0xB5, 0xB4, 0x8D, 0x90, 0x72, 0x1A, 0x42, 0xFD,
+    0x19, 0x52, 0x34, 0x0B, 0xB0, 0xEE, 0xAC, 0x45, 0x85, 0x41, 0x18, 0x4A, 0x82, 0x6C, 0xB2, 0xB8,
+    0x69, 0xAD, 0x25, 0xC5, 0x04, 0x5B, 0xCB, 0x16, 0x59, 0x3B, 0x16, 0xE9, 0xB4, 0x78, 0x41, 0x5D,
+    0x63, 0x35, 0xCE, 0xC2, 0x01, 0x0B, 0xBF, 0x93, 0x1B, 0x50, 0x64, 0x25, 0x11, 0xE6, 0xC1, 0x4A,
+    0x46, 0x01, 0x17, 0x29, 0x57, 0xC9, 0xBC, 0xC9, 0x7D, 0x90, 0x9B, 0x58, 0x40, 0xFD, 0x02, 0xFB,
+    0x04, 0x2C, 0x2F, 0xB3, 0x4C, 0xDC, 0x7D, 0xD5, 0x9B, 0x5A, 0xE9, 0x9F, 0x97, 0xD9, 0x89, 0x6C,
+    0xA7, 0x37, 0xBA, 0xD6, 0x84, 0x33, 0x98, 0x41, 0xDC, 0xD1, 0x18, 0x9A, 0x71, 0x2B, 0x6E, 0xBA,
+    0xC3, 0x16, 0x0B, 0x5E, 0x56, 0x65, 0x60, 0xED, 0x2D, 0x73, 0x78, 0x8C, 0xA7, 0xC3, 0x27, 0xE5,
+    0x60, 0x09, 0x8C, 0xF5, 0xCC, 0x1D, 0xDE, 0xBC, 0x20, 0xA9, 0xCA, 0x38, 0x41, 0xD3, 0x5A, 0xB4,
+    0x40, 0x2E, 0x17, 0xF1, 0x72, 0x9A, 0xDE, 0x55, 0xF9, 0x78, 0x25, 0xDB, 0x8B, 0x0F, 0xFF, 0x05,
+    0xEA, 0x90, 0x31, 0x09, 0x3B, 0xE5, 0xDA, 0x84, 0x32, 0x49, 0xBD, 0x5A, 0xA3, 0x0F, 0xCA, 0x1F,
+    0x94, 0x40, 0x28, 0x83, 0x50, 0x0A, 0xB1, 0xC9, 0x21, 0x8E, 0x11, 0x6D, 0x59, 0x71, 0xE4, 0xD3,
+    0x90, 0xB5, 0xDB, 0xFF, 0x0A, 0xDA, 0x15, 0x17, 0x96, 0x9E, 0x55, 0xBA, 0xDD, 0x5C, 0xD3, 0x4D,
+    0xAE, 0x2E, 0xE2, 0xE9, 0xFD, 0x49, 0x98, 0x91, 0x71, 0xFB, 0x33, 0x66, 0xE4, 0xB4, 0x16, 0x77,
+    0xA2, 0xE6, 0x2D, 0x0D, 0x7E, 0x34, 0xD9, 0xE2, 0x2C, 0x53, 0x6D, 0x7E, 0x3D, 0x1F, 0x3A, 0xA6,
+    0x3F, 0x22, 0x16, 0x14, 0x3F, 0x09, 0x41, 0x9B, 0x57, 0x9A, 0xAC, 0x58, 0x30, 0xCD, 0x27, 0x98,
+    0x82, 0x67, 0x03, 0x4E, 0xF5, 0xFE, 0x8F, 0x49, 0x23, 0x42, 0xCD, 0x84, 0x30, 0x8B, 0x10, 0xF7,
+    0x57, 0x35, 0x05, 0x48, 0xD8, 0xD2, 0xBF, 0x63, 0xC2, 0x29, 0xFD, 0x98, 0x4A, 0x90, 0x2D, 0x6A,
+    0x4D, 0xA0, 0x73, 0xDA, 0xF2, 0xAA, 0xD0, 0xA4, 0x3E, 0xA7, 0xB5, 0xD0, 0x39, 0x96, 0xE0, 0x63,
+    0x66, 0x06, 0x5B, 0x5E, 0xB1, 0x7C, 0x1B, 0xB0, 0xAC, 0xC5, 0x54, 0x49, 0xDD, 0x32, 0x59, 0xC2,
+    0xD9, 0x38, 0x25, 0x03, 0x84, 0x9E, 0x60, 0x74, 0xD1, 0x8F, 0xE7, 0xF4, 0x60, 0xF4, 0x98, 0xD6,
+    0x57, 0x11, 0x03, 0x75, 0x7D, 0xEE, 0xF7, 0x6A, 0xCC, 0xE5, 0x17, 0x6B, 0xA9, 0x47, 0xCD, 0xB5,
+    0x69, 0xFE, 0x6E, 0x19, 0x20, 0xD2, 0x58, 0x04, 0x02, 0x3E, 0x5D, 0x3E, 0x92, 0x9C, 0x08, 0x5F,
+    0x66, 0x60, 0x9A, 0x51, 0x8F, 0x28, 0x2B, 0xEA, 0x6F, 0xE3, 0x9E, 0x3F, 0x86, 0x94, 0xC9, 0x3F,
+    0x30, 0xE5, 0xFD, 0x39, 0xB3, 0xDD, 0xB3, 0x29, 0x4B, 0x06, 0xB8, 0x69, 0x06, 0x3F, 0x25, 0xE3,
+    0xD3, 0x3A, 0x56, 0xCA, 0xE2, 0x36, 0x1C, 0xB2, 0xC4, 0x58, 0x4B, 0xCD, 0x1B, 0x56, 0x27, 0x3C,
+    0xBD, 0xB2, 0x6F, 0x3C, 0x75, 0x72, 0x55, 0x90, 0xAC, 0x1A, 0x59, 0xA2, 0xAE, 0x1B, 0xCC, 0xE2,
+    0x69, 0x41, 0xF8, 0x45, 0x67, 0x59, 0x72, 0x3C, 0x69, 0xEE, 0x25, 0x8A, 0x5B, 0x1F, 0xD0, 0x73,
+    0x91, 0x8B, 0x38, 0xBD, 0xEB, 0x88, 0x66, 0x0C, 0x17, 0x75, 0xFB, 0xF3, 0x06, 0x72, 0x0A, 0x8F,
+    0xA0, 0x21, 0xDB, 0x49, 0x02, 0x5E, 0x13, 0xD8, 0x4C, 0x5F, 0x4A, 0x6C, 0x70, 0x7B, 0xCC, 0x5E,
+    0x17, 0xDD, 0x73, 0x32, 0x60, 0x18, 0xC5, 0x8A, 0xDE, 0x6D, 0xC5, 0x2E, 0x06, 0x96, 0xF4, 0x61,
+    0x62, 0x97, 0x49, 0x64, 0xCE, 0x99, 0x5D, 0xDE, 0x93, 0x8E, 0x4A, 0xFB, 0x25, 0x94, 0x38, 0xBE,
+    0x4B, 0xC0, 0x9E, 0xA9, 0x51, 0xD3, 0xE0, 0x7F, 0x47, 0x43, 0x0A, 0xB5, 0x6D, 0x07, 0x59, 0xEB,
+    0xB6, 0xAF, 0x70, 0x7B, 0x95, 0xEF, 0x6B, 0x8D, 0xBC, 0x66, 0x79, 0x61, 0xD2, 0x80, 0x74, 0x67,
+    0x07, 0x37, 0xE7, 0x46, 0xA3, 0x72, 0x71, 0x25, 0xD7, 0x36, 0xF3, 0x78, 0xE6, 0x50, 0x1E, 0x6F,
+    0xF2, 0xBC, 0x3C, 0x9E, 0x49, 0xAC, 0x16, 0x8D, 0xDD, 0xB6, 0xC7, 0xEA, 0x07, 0x71, 0x2F, 0xD1,
+    0x9F, 0x9F, 0x3F, 0x3A, 0x0A, 0x75, 0xF3, 0xFA, 0xF6, 0x33, 0x8D, 0x8C, 0x08, 0xCF, 0x96, 0x6A,
+    0xEA, 0x6A, 0xCD, 0x23, 0xAB, 0x9F, 0xD2, 0x27, 0xE6, 0xEB, 0x9E, 0xAB, 0x34, 0x5F, 0xE3, 0x39,
+    0xB7, 0x8D, 0x96, 0x3B, 0xB1, 0xB0, 0x4E, 0x2A, 0xD6, 0xCE, 0x0F, 0x30, 0x17, 0xAE, 0x85, 0x47,
+    0x62, 0x9E, 0x53, 0x08, 0xE0, 0xE4, 0xB4, 0xE8, 0x43, 0xB0, 0x30, 0x06, 0x7F, 0xD4, 0xA6, 0xE9,
+    0x66, 0xE4, 0x09, 0xD2, 0x58, 0x0F, 0x19, 0x6B, 0xAA, 0x60, 0x3E, 0x64, 0xAC, 0xC7, 0xB4, 0xF5,
+    0x74, 0xD0, 0xD8, 0xC5, 0x73, 0x92, 0xE2, 0x33, 0x5F, 0xE3, 0xE0, 0x86, 0x85, 0xD4, 0xA4, 0xF5,
+    0x7A, 0x9D, 0x8E, 0xA9, 0x70, 0x7F, 0x93, 0x3F, 0x60, 0x88, 0xB6, 0xF7, 0xFF, 0x5D, 0x2C, 0xFF,
+    0x79, 0x17, 0x8B, 0xEB, 0x57, 0xC1, 0xCB, 0xF5, 0xAB, 0xB8, 0x92, 0x65, 0xDE, 0x0D, 0xB5, 0xA6,
+    0x78, 0x36, 0xA4, 0x05, 0x7E, 0xBE, 0xFB, 0x55, 0xCC, 0x7A, 0x08, 0xE3, 0xA3, 0xB2, 0xF5, 0x7A,
+    0xC5, 0x50, 0x7A, 0xF4, 0x45, 0xFC, 0xB1, 0x53, 0xC5, 0x1D, 0x0C, 0x7D, 0x2A, 0x43, 0x9B, 0x8A,
+    0xEF, 0x52, 0x19, 0x9A, 0x54, 0x86, 0x1E, 0x95, 0xA1, 0x45, 0x65, 0xE8, 0x50, 0x19, 0x1A, 0x54,
+    0x86, 0xFE, 0x94, 0xA1, 0x3D, 0x65, 0xE8, 0x4E, 0x19, 0x9A, 0x53, 0x86, 0xDE, 0x94, 0xA1, 0x35,
+    0x65, 0xE8, 0x4C, 0x19, 0x1A, 0x53, 0x86, 0xBE, 0x94, 0xB1, 0x2D, 0x65, 0x9D, 0x41, 0x7E, 0x7B,
+    0x0C, 0x9E, 0xB5, 0x86, 0x98, 0xAE, 0xF9, 0xC3, 0x5F, 0x33, 0x2F, 0x47, 0x50, 0x1D, 0xDE, 0x1D,
+    0x8B, 0xE8, 0xEA, 0xA4, 0x19, 0x23, 0x72, 0x65, 0x31, 0x41, 0x6B, 0x5E, 0x9E, 0xA0, 0x5A, 0x82,
+    0xE3, 0x40, 0x33, 0xF9, 0x12, 0x1F, 0xCB, 0x7B, 0x95, 0xF3, 0xDB, 0x0A, 0x25, 0xBB, 0x04, 0x5B,
+    0x3F, 0x63, 0x3A, 0x53, 0xE1, 0xDC, 0x8F, 0x39, 0x9A, 0x7B, 0x57, 0x0E, 0x3B, 0x51, 0x90, 0xE3,
+    0xDE, 0x3B, 0x76, 0x1C, 0xA9, 0xEB, 0x4F, 0x9E, 0x5E, 0xBF, 0x5E, 0xFB, 0x65, 0xD2, 0xAE, 0xC8,
+    0x9E, 0x85, 0xC5, 0x5F, 0x97, 0x85, 0xFA, 0xA9, 0xDE, 0x6B, 0xA9, 0x05, 0xBF, 0x06, 0x8F, 0xC9,
+    0x1B, 0x6F, 0x7D, 0x45, 0xE5, 0x8D, 0xCF, 0x95, 0x01, 0x19, 0x09, 0x68, 0x47, 0x25, 0x5B, 0x1A,
+    0x9D, 0xA9, 0x4F, 0x55, 0xE4, 0x98, 0x31, 0x0F, 0xBC, 0xA8, 0x04, 0xF0, 0x0B, 0x0D, 0xAF, 0xC3,
+    0xE5, 0x8D, 0xDE, 0x95, 0x23, 0x27, 0x43, 0x32, 0x25, 0xB8, 0xB6, 0xB1, 0x5E, 0x90, 0xB0, 0x87,
+    0xF5, 0x8F, 0x08, 0x43, 0xFA, 0xC1, 0xA7, 0x98, 0xAB, 0xF4, 0x1F, 0x19, 0xB6, 0x67, 0x73, 0x1D,
+    0x64, 0xC7, 0xB0, 0x5D, 0x94, 0x89, 0xBB, 0x4A, 0x77, 0x0A, 0xC0, 0x44, 0x47, 0x3F, 0xD5, 0x01,
+    0xAF, 0x54, 0x2B, 0xB4, 0x19, 0x0C, 0x98, 0xE5, 0xDA, 0x22, 0x0B, 0x1D, 0xD3, 0x0E, 0x2C, 0x39,
+    0x19, 0x6F, 0xA0, 0xF7, 0xA1, 0xE7, 0x35, 0x18, 0xAF, 0x2A, 0xB3, 0xF8, 0x18, 0x72, 0x85, 0xB4,
+    0x65, 0x0C, 0x92, 0x7E, 0x4E, 0x75, 0xCA, 0x94, 0xFC, 0xA8, 0x3E, 0xFB, 0xD6, 0x1D, 0xB7, 0x73,
+    0x64, 0xC7, 0x35, 0x23, 0x58, 0x17, 0x14, 0xEE, 0x6D, 0xE4, 0x68, 0xCC, 0x3B, 0x87, 0xDA, 0x43,
+    0x8A, 0x8D, 0x7E, 0x5C, 0xCD, 0xB2, 0xF2, 0xD5, 0x3E, 0xB7, 0x27, 0x53, 0x7B, 0x3F, 0x7C, 0xEB,
+    0x87, 0xEF, 0xFC, 0x18, 0x1A, 0x3F, 0x7C, 0xDF, 0x87, 0x6F, 0xFB, 0x70, 0xBD, 0x35, 0xBE, 0xB1,
+    0xC6, 0x77, 0xD5, 0xF8, 0x96, 0x1A, 0xD7, 0xF1, 0xE1, 0x9B, 0x69, 0x7C, 0x27, 0x8D, 0x6F, 0xA3,
+    0xF1, 0x3D, 0x34, 0xBE, 0x81, 0xC6, 0x77, 0xCF, 0xF8, 0xD6, 0x19, 0xDF, 0x37, 0xE3, 0x1B, 0x3D,
+    0x7C, 0x9F, 0x87, 0x6F, 0xF3, 0xF0, 0x5D, 0x1E, 0xBE, 0xC9, 0x43, 0x3E, 0xB8, 0xB7, 0x99, 0x5D,
+    0xCE, 0x87, 0xEC, 0x72, 0x58, 0x1D, 0xEE, 0xC1, 0x60, 0x03, 0x86, 0x76, 0x5F, 0xB0, 0xF5, 0x02,
+    0x7D, 0x17, 0xDA, 0x74, 0xE1, 0xD2, 0x69, 0x77, 0x8E, 0x66, 0x92, 0x83, 0x85, 0xF6, 0x57, 0xB0,
+    0xB9, 0xC2, 0x25, 0xDE, 0xD8, 0x56, 0x11, 0xD8, 0xFE, 0x8E, 0x63, 0xA5, 0xAF, 0x98, 0x23, 0x4E,
+    0xAF, 0xD2, 0x0E, 0x85, 0x21, 0x09, 0xC9, 0x22, 0xAF, 0xC9, 0x1E, 0x42, 0xB0, 0x1D, 0xCE, 0xC8,
+    0xFA, 0x36, 0xBF, 0x81, 0xF7, 0x13, 0x2E, 0x7F, 0xF1, 0xCF, 0x4A, 0x4E, 0x46, 0xED, 0x94, 0x58,
+    0x4F, 0x15, 0xE1, 0x21, 0x2D, 0xB9, 0x7B, 0x38, 0x2D, 0x19, 0x6B, 0x5A, 0x92, 0xE6, 0xB7, 0xCD,
+    0xED, 0x2E, 0x0D, 0x7C, 0xF6, 0x05, 0x09, 0x49, 0x71, 0xC5, 0x77, 0x7D, 0x2C, 0x4A, 0xE5, 0xDB,
+    0xF7, 0xA1, 0x60, 0x54, 0xB9, 0x16, 0x32, 0x73, 0xF0, 0x18, 0xCE, 0x6F, 0x1B, 0x01, 0xE7, 0xEB,
+    0xEE, 0x88, 0xEF, 0x8D, 0x0B, 0xFB, 0xB1, 0x65, 0x2A, 0xC3, 0x7B, 0x87, 0x1B, 0x9D, 0x86, 0x6E,
+    0x93, 0xA1, 0x77, 0xEA, 0x5D, 0xEF, 0x0E, 0x5A, 0xF3, 0x7F, 0x2C, 0x89, 0xF9, 0x5A, 0xB5, 0xEE,
+    0x44, 0x96, 0xEB, 0x9D, 0x37, 0xAE, 0x9B, 0xFB, 0x8C, 0x39, 0xB1, 0x99, 0xCD, 0xBF, 0x1E, 0xBB,
+    0x30, 0xE3, 0x35, 0x5B, 0xD2, 0x05, 0xF8, 0xED, 0x0D, 0x91, 0x7B, 0x78, 0xC3, 0x9F, 0x20, 0xD4,
+    0xFB, 0x0C, 0xF1, 0xA1, 0xA7, 0xC8, 0x05, 0x29, 0x72, 0x8D, 0xE5, 0x22, 0xF8, 0x67, 0x50, 0xE4,
+    0xE8, 0x7D, 0x50, 0xE4, 0x94, 0x14, 0x79, 0x9B, 0x14, 0xF9, 0x32, 0x29, 0x72, 0x0F, 0x8A, 0x1C,
+    0xB6, 0x20, 0xC7, 0x71, 0x85, 0x6D, 0x4A, 0x8A, 0xBC, 0x43, 0x8A, 0xFC, 0x08, 0x14, 0xF9, 0x1B,
+    0x1D, 0x28, 0xF2, 0x37, 0x1B, 0x50, 0xE4, 0xEF, 0x92, 0x22, 0xFF, 0x2B, 0x29, 0xF2, 0x9C, 0x14,
+    0x59, 0xE3, 0x09, 0x52, 0xE4, 0xF8, 0x21, 0x96, 0xEA, 0x94, 0x6D, 0x1E, 0x43, 0x2B, 0xFD, 0x99,
+    0x21, 0x97, 0x3F, 0xF5, 0xFD, 0x67, 0xEC, 0x00, 0x70, 0xE8, 0x7F, 0x5D, 0x6B, 0x7B, 0x81, 0x7D,
+    0x26, 0x41, 0xCF, 0x81, 0x45, 0xE3, 0x56, 0x8E, 0xCA, 0x5A, 0x81, 0xC0, 0xAE, 0x16, 0x2B, 0x0D,
+    0x3E, 0xEE, 0x92, 0x3E, 0xFE, 0x6E, 0x97, 0x76, 0xA9, 0xFC, 0x6B, 0x77, 0xD2, 0x2E, 0x6B, 0x1E,
+    0xA5, 0x6D, 0xFE, 0xC3, 0x56, 0x66, 0xE1, 0x03, 0x61, 0xCA, 0xF9, 0xDF, 0x22, 0x12, 0x84, 0x05,
+    0xA5, 0x33, 0xB1, 0xA6, 0xA4, 0x47, 0x1C, 0xB7, 0xBC, 0x29, 0xB7, 0xAB, 0x45, 0xA6, 0x1D, 0x44,
+    0x28, 0xBF, 0xE7, 0x45, 0x61, 0x0F, 0x79, 0x4B, 0x27, 0x82, 0x72, 0xB2, 0x88, 0x43, 0xDE, 0xBE,
+    0x4B, 0x8D, 0xB8, 0x70, 0xC4, 0x48, 0x4E, 0x54, 0xBD, 0x24, 0xB8, 0x87, 0xDA, 0xE8, 0x02, 0xA6,
+    0x73, 0x07, 0x11, 0x54, 0x8E, 0x04, 0x5E, 0xD2, 0xC8, 0x35, 0x61, 0x73, 0xE9, 0x78, 0x7D, 0xCF,
+    0x7D, 0x25, 0xD2, 0x24, 0x5B, 0x0F, 0xB4, 0xE7, 0x13, 0x5A, 0xFA, 0x87, 0xF2, 0x73, 0x92, 0xAB,
+    0x79, 0x66, 0x0B, 0x51, 0x03, 0x82, 0xCD, 0x08, 0x2E, 0x3B, 0xAE, 0x2E, 0x40, 0x0D, 0xCF, 0x1C,
+    0x23, 0x76, 0xE1, 0xDD, 0x5F, 0x65, 0x24, 0x49, 0xAF, 0xC4, 0xA9, 0x34, 0xB7, 0x19, 0x68, 0x64,
+    0x5C, 0x66, 0xE2, 0xEA, 0xED, 0x23, 0x5F, 0x16, 0x71, 0x04, 0x9B, 0xCE, 0x0E, 0x6E, 0x59, 0x5C,
+    0x71, 0x87, 0x07, 0x8B, 0x43, 0x46, 0xFB, 0x64, 0xE3, 0xD0, 0x55, 0x3F, 0xAC, 0xCE, 0x42, 0xB7,
+    0x12, 0x91, 0x96, 0x8C, 0x46, 0x41, 0x05, 0xE9, 0x8A, 0xD5, 0xEB, 0x6A, 0x90, 0x95, 0x1F, 0x49,
+    0xAC, 0x4E, 0x3C, 0xE9, 0x25, 0xDD, 0x05, 0xA0, 0x6C, 0xC3, 0xD6, 0xF6, 0x74, 0xED, 0x4D, 0x0F,
+    0xEF, 0x5E, 0x94, 0x75, 0x1F, 0x08, 0x20, 0xE8, 0x16, 0x69, 0xD2, 0x6F, 0x88, 0x07, 0xA8, 0x2E,
+    0xAF, 0x51, 0x19, 0x89, 0xCD, 0xFF, 0xAA, 0x37, 0x8B, 0x68, 0x8E, 0xF8, 0x34, 0xE9, 0xC3, 0xB9,
+    0xCC, 0xC4, 0x2C, 0x6F, 0xC4, 0xA5, 0x88, 0xA9, 0x16, 0xDF, 0x5B, 0x49, 0xCC, 0xD6, 0x99, 0xFA,
+    0x9A, 0x63, 0xF7, 0x2E, 0xBC, 0x2B, 0xAA, 0xA0, 0xCA, 0xDB, 0x44, 0xBC, 0xA0, 0x15, 0x4F, 0x30,
+    0xF7, 0x1D, 0x5A, 0x5B, 0x94, 0x91, 0x31, 0x5E, 0x74, 0xA0, 0x7D, 0xCA, 0xDB, 0xF4, 0x1C, 0x5F,
+    0x39, 0xD1, 0x28, 0x19, 0x73, 0xB1, 0x42, 0x64, 0x44, 0xA1, 0xD3, 0xF2, 0x92, 0x5C, 0xF0, 0x0B,
+    0x2F, 0x02, 0x21, 0x3A, 0x04, 0x28, 0xD1, 0x1D, 0x09, 0xD8, 0xE0, 0x0D, 0xE0, 0x0C, 0xC2, 0xF6,
+    0xD2, 0x46, 0x4F, 0x24, 0x5B, 0x22, 0xB5, 0x16, 0xA0, 0xC5, 0x7C, 0x97, 0x74, 0x01, 0x12, 0xB1,
+    0x06, 0xE7, 0xA4, 0xDF, 0xFC, 0x3A, 0x59, 0x6B, 0x3C, 0x47, 0xD9, 0x68, 0x4C, 0x74, 0x2C, 0x04,
+    0xB7, 0x01, 0xF3, 0x60, 0x4A, 0x5F, 0x86, 0xF7, 0xED, 0xD3, 0x7B, 0xA6, 0x90, 0xEB, 0xB3, 0x3F,
+    0x96, 0x95, 0xA0, 0x79, 0x2C, 0x0B, 0xB2, 0x10, 0xDC, 0x47, 0x89, 0x79, 0x31, 0xCD, 0x8F, 0x68,
+    0x4D, 0x31, 0x35, 0x46, 0x71, 0xC0, 0x1E, 0x0C, 0x09, 0xEB, 0x62, 0xF9, 0xF9, 0xDF, 0x6F, 0x01,
+    0x35, 0xDF, 0x29, 0x23, 0xDB, 0xA5, 0x4F, 0xFA, 0x0B, 0xE6, 0xD6, 0x1B, 0xE6, 0x8D, 0x61, 0xE8,
+    0x37, 0xC9, 0x7E, 0xE4, 0x11, 0x49, 0xAB, 0x8D, 0xCA, 0xB8, 0x7F, 0xAE, 0x5F, 0xF2, 0xE3, 0x7D,
+    0xB5, 0x1B, 0x79, 0xCA, 0xB1, 0x4E, 0x98, 0x19, 0x0A, 0x8C, 0x9B, 0x55, 0x91, 0x9B, 0xC2, 0x4C,
+    0x99, 0x10, 0xA1, 0xA7, 0x37, 0x49, 0x45, 0x96, 0xBC, 0xE9, 0xEB, 0x4F, 0x68, 0x93, 0xA7, 0x0C,
+    0xC2, 0x8F, 0x61, 0x9F, 0x6B, 0x15, 0xBC, 0x31, 0x07, 0x70, 0x48, 0xFE, 0x17, 0xDD, 0xE4, 0x69,
+    0x2E, 0x92, 0x05, 0x71, 0x9E, 0xE2, 0x27, 0xFA, 0xAD, 0x06, 0x30, 0xB1, 0xAF, 0x21, 0x21, 0xFB,
+    0x12, 0xF4, 0xCA, 0x5E, 0x24, 0xFB, 0xEC, 0x9D, 0x03, 0x84, 0x33, 0xD9, 0xF0, 0x26, 0x2F, 0x1E,
+    0x41, 0xB8, 0x7C, 0xA3, 0x4E, 0xDF, 0xD0, 0xED, 0xA3, 0x81, 0x87, 0x66, 0x53, 0xCE, 0xA8, 0x8E,
+    0x97, 0x0F, 0xFB, 0xE2, 0xD5, 0x1E, 0x73, 0x9E, 0x2B, 0x46, 0xDD, 0xC8, 0xF1, 0x2F, 0x90, 0xAD,
+    0x0A, 0x38, 0x56, 0x1D, 0xB1, 0x66, 0x1A, 0x91, 0x83, 0xEA, 0x40, 0x15, 0xE5, 0xA6, 0x9A, 0x22,
+    0x10, 0xB9, 0x99, 0xBA, 0x44, 0xC0, 0x9C, 0x92, 0x11, 0x64, 0x4F, 0x2C, 0x4D, 0x72, 0xA2, 0x95,
+    0x47, 0x80, 0x58, 0x16, 0xFC, 0x7E, 0x55, 0xC6, 0x2F, 0x57, 0x69, 0xB6, 0x33, 0x65, 0x52, 0x22,
+    0xE1, 0x56, 0xEE, 0xBD, 0x65, 0xFF, 0x3C, 0x5C, 0x09, 0x13, 0x58, 0x98, 0x9B, 0xCD, 0x99, 0xEA,
+    0x1D, 0xB9, 0xED, 0x52, 0xC3, 0xBD, 0xB9, 0x90, 0x66, 0x84, 0x7A, 0x67, 0x83, 0x81, 0xAB, 0x15,
+    0xF3, 0xAC, 0xCF, 0xE7, 0xF5, 0x3C, 0x7C, 0xFA, 0xA3, 0x79, 0xF8, 0xD3, 0x72, 0x16, 0x1E, 0x98,
+    0x3D, 0xCE, 0xB3, 0xFB, 0x32, 0x58, 0xD2, 0xBB, 0x5C, 0xAA, 0x77, 0x5B, 0xD5, 0x51, 0xB7, 0xA5,
+    0xB5, 0x48, 0x71, 0x03, 0x43, 0x6D, 0x20, 0x79, 0x32, 0x23, 0xDB, 0x07, 0xD7, 0x1F, 0x5C, 0xC2,
+    0x09, 0x45, 0xC8, 0x04, 0x3F, 0xD0, 0x8A, 0x55, 0xF1, 0xB0, 0x31, 0x8F, 0x64, 0xBD, 0xBC, 0x3B,
+    0xE6, 0x48, 0xFE, 0xC7, 0xD0, 0x79, 0x8D, 0xC9, 0xC4, 0xEC, 0xBD, 0x39, 0x73, 0xBC, 0x8B, 0x21,
+    0xFE, 0x36, 0x73, 0x66, 0x29, 0x2E, 0x85, 0xCD, 0x4B, 0xD0, 0x13, 0x1C, 0xC0, 0x14, 0x82, 0x05,
+    0x06, 0xB8, 0x8F, 0x27, 0x16, 0x0C, 0x31, 0xAB, 0xD9, 0x61, 0xA7, 0xF6, 0xC2, 0x1B, 0xF6, 0x30,
+    0x63, 0x46, 0x1B, 0xEE, 0x4C, 0xF1, 0x00, 0xD0, 0xDD, 0xA2, 0x46, 0xDF, 0x75, 0xDF, 0x9C, 0x3F,
+    0xE9, 0x3D, 0xEB, 0x0C, 0xC3, 0x6B, 0x2C, 0x06, 0x07, 0xFB, 0xC8, 0xAD, 0x9C, 0xC5, 0x52, 0x7E,
+    0xE6, 0x98, 0x5B, 0x1E, 0x45, 0x02, 0x24, 0x32, 0x0F, 0x6A, 0x89, 0x9D, 0x2A, 0x46, 0xEE, 0x02,
+    0xCB, 0x3E, 0xB2, 0x0A, 0xC2, 0x98, 0xF7, 0x34, 0x61, 0x30, 0x7C, 0x99, 0x54, 0x6B, 0x89, 0x39,
+    0xD5, 0xD7, 0x7A, 0x97, 0x8C, 0xAF, 0x33, 0x89, 0xE4, 0xAB, 0x21, 0x2D, 0x39, 0x81, 0x7B, 0x2E,
+    0xCA, 0xC7, 0x7E, 0xC3, 0xB5, 0x5D, 0x71, 0xC8, 0x9E, 0xDE, 0xE8, 0x1D, 0x0A, 0x63, 0x43, 0x68,
+    0x36, 0x04, 0x18, 0x3B, 0x43, 0x87, 0x2B, 0x3D, 0x53, 0x39, 0x2E, 0x4A, 0x42, 0x44, 0x7E, 0xB7,
+    0x0F, 0x66, 0x4C, 0xA9, 0xE3, 0x7F, 0x0F, 0xA5, 0x43, 0x43, 0x42, 0x00, 0x39, 0x50, 0xAE, 0x4D,
+    0xF0, 0x6C, 0xFC, 0x92, 0x37, 0x5F, 0x12, 0x08, 0x64, 0x32, 0x9B, 0x2B, 0x6C, 0x69, 0xC8, 0xCA,
+    0xFC, 0xA3, 0xA9, 0xAC, 0x0F, 0xB3, 0xB1, 0x2B, 0x09, 0x02, 0x43, 0x5F, 0x3B, 0xCD, 0x88, 0xC6,
+    0x63, 0x65, 0x57, 0x9C, 0x09, 0xAA, 0x79, 0xB6, 0xCC, 0x4B, 0x61, 0xD3, 0xE5, 0x15, 0xAC, 0x20,
+    0x22, 0x96, 0x38, 0x10, 0xF3, 0xB6, 0x38, 0x90, 0xB3, 0x43, 0x6E, 0x75, 0x39, 0xB6, 0x16, 0x06,
+    0x8B, 0x31, 0x4D, 0xB1, 0x1E, 0x5F, 0x47, 0xEB, 0xF1, 0xB5, 0x56, 0xCA, 0xBB, 0xB1, 0xC8, 0x9B,
+    0x35, 0xE3, 0x36, 0xAF, 0x86, 0xD2, 0xC5, 0x2F, 0xD9, 0x4F, 0x99, 0xEC, 0x5F, 0x1D, 0xCE, 0xC9,
+    0xA8, 0x7B, 0x7D, 0xAC, 0xC9, 0xA5, 0x31, 0x97, 0x15, 0x69, 0x09, 0xDB, 0xF1, 0xCC, 0x46, 0x07,
+    0x84, 0x6F, 0x62, 0x09, 0xAA, 0x81, 0xB5, 0x8C, 0x94, 0x87, 0x88, 0x72, 0xDF, 0x89, 0xBC, 0x1E,
+    0x04, 0xCF, 0x54, 0xD0, 0xC8, 0x05, 0xC1, 0x28, 0x4D, 0x40, 0xD8, 0xB8, 0x3F, 0x27, 0x5E, 0x7C,
+    0xC6, 0x9C, 0xAF, 0x4F, 0xC7, 0xC4, 0x3E, 0x70, 0x75, 0x5F, 0x71, 0xBB, 0xBC, 0xD9, 0x56, 0x29,
+    0x2E, 0xBD, 0x45, 0x7D, 0xF2, 0xC1, 0x82, 0x35, 0x05, 0xCB, 0xD1, 0xC9, 0xBA, 0x9F, 0x97, 0x30,
+    0x9A, 0x8C, 0xFE, 0xF0, 0x94, 0x4F, 0x64, 0x4F, 0x47, 0xE4, 0xB4, 0xA0, 0x33, 0x61, 0xC0, 0xF9,
+    0x8C, 0x8B, 0x07, 0x06, 0x1F, 0xED, 0x29, 0xF7, 0xD0, 0xEA, 0x44, 0xBC, 0xC6, 0xA0, 0x37, 0x38,
+    0xCC, 0x5A, 0x31, 0x28, 0x6F, 0x87, 0x72, 0xBA, 0x76, 0xA6, 0x67, 0xDA, 0x57, 0x83, 0x37, 0x6E,
+    0xB2, 0x23, 0x80, 0xE9, 0xF5, 0x3B, 0xE5, 0x91, 0x6F, 0xA2, 0xC1, 0x08, 0x93, 0x4F, 0x6B, 0x88,
+    0x8A, 0xEA, 0x18, 0x66, 0xE8, 0x0A, 0x36, 0xAF, 0x0E, 0x5F, 0xE9, 0xD5, 0xD9, 0x41, 0xA2, 0x0D,
+    0xA5, 0x40, 0xAD, 0x48, 0x27, 0x7F, 0x36, 0x1B, 0x74, 0x60, 0x3A, 0xC4, 0xC7, 0x93, 0x8D, 0xAA,
+    0x33, 0x47, 0x48, 0x81, 0xB5, 0x43, 0xA8, 0xD2, 0xF4, 0x6F, 0x50, 0xB7, 0xAE, 0xC9, 0xE0, 0x07,
+    0x5E, 0x08, 0x6D, 0xDE, 0x12, 0x3F, 0x93, 0xE8, 0x22, 0xB0, 0x5B, 0xF8, 0x6C, 0xB5, 0x03, 0xD7,
+    0x25, 0x16, 0xD3, 0xF6, 0xB9, 0x7F, 0x4D, 0x41, 0x4B, 0x3B, 0x43, 0x61, 0xC7, 0x97, 0x75, 0x5C,
+    0x51, 0xC7, 0x97, 0x74, 0x7C, 0x41, 0xC7, 0x97, 0x73, 0x7C, 0x31, 0xC7, 0x97, 0x72, 0x7C, 0x21,
+    0xC7, 0x97, 0x71, 0x58, 0xC4, 0x31, 0xC6, 0x95, 0x70, 0x7C, 0x01, 0xC7, 0x97, 0x6F, 0x7C, 0xF1,
+    0xC6, 0x97, 0x6E, 0x7C, 0xE1, 0xC6, 0x97, 0x6D, 0x7C, 0xD1, 0x66, 0xA8, 0x95, 0x60, 0x5A, 0x60,
+    0x03, 0xC2, 0x1A, 0xF0, 0x1D, 0x3B, 0x10, 0x87, 0x58, 0x5D, 0x62, 0x68, 0x42, 0x14, 0x14, 0x9A,
+    0x8C, 0xA9, 0xE6, 0xC7, 0x63, 0xA1, 0x54, 0xBB, 0x17, 0xE0, 0x74, 0xFF, 0xDB, 0xFD, 0x50, 0xFC,
+    0x36, 0x18, 0xD2, 0xFC, 0x22, 0x2B, 0xA2, 0xD0, 0xE0, 0xDF, 0x11, 0x18, 0x30, 0xD3, 0xAF, 0xDF,
+    0xAF, 0xD4, 0x5C, 0xBF, 0x26, 0xFB, 0xDD, 0xDF, 0xCC, 0x48, 0x36, 0xFE, 0x66, 0x46, 0xC0, 0xBF,
+    0x99, 0x11, 0x10, 0x2C, 0x40, 0xC7, 0x54, 0x88, 0x26, 0xFD, 0xF5, 0x9B, 0x94, 0xC6, 0xA7, 0xFD,
+    0xE1, 0x4E, 0xFF, 0x03, 0x9D, 0x56, 0xBF, 0x6F, 0xDB, 0xD8, 0x1D, 0xFF, 0x90, 0xB4, 0xC4, 0x9C,
+    0x19, 0x89, 0x1A, 0xEC, 0x22, 0x6D, 0x64, 0x33, 0x83, 0x87, 0xD4, 0x95, 0xC2, 0x0C, 0x1A, 0x98,
+    0x42, 0x12, 0x1F, 0x3A, 0x74, 0x09, 0x70, 0x55, 0x51, 0x7B, 0xCA, 0x90, 0x00, 0x9D, 0x2E, 0xB8,
+    0x22, 0x1A, 0xD4, 0xC2, 0x05, 0x9C, 0xF0, 0xDD, 0xFD, 0x01, 0x85, 0x3B, 0x74, 0xD7, 0x90, 0x21,
+    0x55, 0x06, 0xAB, 0x85, 0x51, 0xF8, 0x0A, 0x9F, 0xC9, 0xA5, 0x38, 0x14, 0x5D, 0x78, 0x68, 0x81,
+    0x0C, 0x5D, 0x88, 0x22, 0x05, 0x0E, 0x45, 0x0B, 0x70, 0xD0, 0x40, 0xDC, 0x49, 0x7A, 0xFD, 0x3C,
+    0x4A, 0xE7, 0x34, 0x87, 0x4C, 0x7D, 0x24, 0x9F, 0xA9, 0xF7, 0xE3, 0xF3, 0xFD, 0xBE, 0xEF, 0xF7,
+    0xF3, 0xFD, 0xD0, 0xFB, 0xC2, 0x4F, 0x9C, 0xD4, 0xCA, 0x90, 0xA3, 0x83, 0x17, 0x56, 0xE1, 0x64,
+    0x9E, 0xEC, 0x61, 0x0C, 0xEC, 0x03, 0x4A, 0x9A, 0x2A, 0x71, 0x5E, 0xA5, 0xBE, 0x91, 0x8F, 0x30,
+    0xC2, 0x01, 0x60, 0x2B, 0xA4, 0x6E, 0xFC, 0x2A, 0x69, 0xB9, 0x0A, 0x5B, 0xC6, 0x39, 0xD8, 0x42,
+    0x55, 0x84, 0x6A, 0x76, 0xF5, 0x32, 0xC4, 0x30, 0x30, 0xB2, 0xF0, 0x34, 0xF1, 0x94, 0x30, 0xBF,
+    0xC0, 0x06, 0x42, 0xC4, 0xBC, 0xDA, 0xD8, 0xC5, 0x34, 0xFC, 0x41, 0xC1, 0xFB, 0x8E, 0x91, 0x1B,
+    0xC2, 0x9F, 0xF7, 0xA2, 0x86, 0x8F, 0xBE, 0x53, 0xB8, 0xC2, 0xE5, 0x2A, 0x36, 0x7B, 0x01, 0xFF,
+    0x54, 0x74, 0xAD, 0x64, 0x75, 0xF3, 0x9D, 0x23, 0xBA, 0xBD, 0xD8, 0x94, 0x56, 0x11, 0x4A, 0x3B,
+    0xBB, 0x84, 0x2B, 0x0B, 0xF4, 0xAC, 0x14, 0x53, 0x07, 0x38, 0xC1, 0xE0, 0xCC, 0x4E, 0x7B, 0xBE,
+    0xF0, 0x17, 0x70, 0x67, 0x70, 0x32, 0x6C, 0xB4, 0xBB, 0xDD, 0x60, 0x84, 0x0D, 0x03, 0xBB, 0xB6,
+    0xD8, 0x71, 0xD0, 0x72, 0xD1, 0x75, 0x11, 0xEC, 0x6A, 0x90, 0x0F, 0xAA, 0x27, 0x08, 0xAD, 0x1C,
+    0xDE, 0x47, 0x05, 0xEC, 0xF4, 0x02, 0x46, 0xEE, 0x03, 0x23, 0x47, 0xE8, 0xB9, 0x19, 0xCC, 0x39,
+    0xCC, 0x02, 0xC3, 0xF1, 0x78, 0x64, 0x64, 0xFD, 0xD3, 0xC4, 0x57, 0xA8, 0xBE, 0x06, 0x26, 0x3C,
+    0x6F, 0xE2, 0xBD, 0xCC, 0xBA, 0xC8, 0x3B, 0x18, 0xE2, 0x96, 0x95, 0x13, 0x10, 0xC7, 0xB8, 0x44,
+    0x2C, 0xE3, 0x24, 0x94, 0x1B, 0xA8, 0x9E, 0xB8, 0xB9, 0x5B, 0xD8, 0x05, 0x21, 0x72, 0x23, 0xBD,
+    0x29, 0x9F, 0x12, 0xCD, 0x11, 0x61, 0x12, 0x27, 0x4A, 0x14, 0x0C, 0xE9, 0x19, 0x7A, 0xF4, 0xD9,
+    0x10, 0xEF, 0x5A, 0xB7, 0x0F, 0x5F, 0xBA, 0xC9, 0x3A, 0xF2, 0xBF, 0x35, 0xE6, 0x44, 0x4F, 0xEE,
+    0x30, 0xCC, 0x78, 0x84, 0xFC, 0x71, 0x1E, 0x67, 0x46, 0x6A, 0x26, 0xC0, 0x6D, 0x5A, 0xEC, 0x8F,
+    0xA3, 0x7C, 0x8A, 0x29, 0xF7, 0x6C, 0x1F, 0x32, 0xCC, 0x62, 0xFB, 0x21, 0xE0, 0x96, 0x77, 0x1D,
+    0xD8, 0x01, 0x5A, 0xC0, 0x16, 0x4C, 0xE9, 0x66, 0x6E, 0xCE, 0x13, 0x66, 0x66, 0xE2, 0x8B, 0x3D,
+    0xED, 0x48, 0xE2, 0xCB, 0x80, 0x80, 0xC7, 0xCC, 0xC1, 0x26, 0x20, 0x50, 0x42, 0x86, 0x8B, 0x70,
+    0xBE, 0x7D, 0x10, 0xCE, 0xBF, 0xF7, 0xDA, 0x16, 0x0E, 0x1C, 0xEE, 0xB3, 0xE4, 0x83, 0xBF, 0xA9,
+    0xE2, 0xE1, 0xC0, 0xC5, 0x7B, 0x08, 0x97, 0xD1, 0x92, 0xE9, 0x68, 0xD1, 0x6A, 0x17, 0x47, 0x98,
+    0xC5, 0x79, 0x9C, 0x7E, 0xFB, 0x6A, 0x20, 0xD0, 0x58, 0xB3, 0x30, 0xAF, 0x32, 0x6C, 0x3E, 0x42,
+    0xC9, 0x8B, 0x76, 0xDA, 0x46, 0x16, 0x59, 0x33, 0xDE, 0x3D, 0x33, 0xE3, 0x4F, 0xAF, 0xC0, 0xB3,
+    0x4B, 0x9C, 0xB9, 0xC8, 0x1D, 0xDD, 0xF3, 0x9D, 0x23, 0x6C, 0x6E, 0xE2, 0x89, 0x3E, 0x21, 0xA6,
+    0xF4, 0x04, 0x0D, 0xE8, 0xF3, 0x70, 0x3C, 0xD6, 0x48, 0xF0, 0x48, 0x1F, 0x44, 0x0B, 0x44, 0x19,
+    0x8C, 0x4C, 0x2F, 0xBB, 0xC0, 0x9C, 0x61, 0x8E, 0xE6, 0xDE, 0xAC, 0xE2, 0xEE, 0xB6, 0x5B, 0x5D,
+    0x7C, 0x67, 0x32, 0x39, 0xF1, 0x95, 0x4A, 0xC3, 0xC3, 0x87, 0x49, 0x17, 0x56, 0x32, 0x82, 0x25,
+    0x1F, 0xC1, 0x14, 0xE3, 0xBB, 0xCD, 0x6C, 0x1A, 0xFC, 0x71, 0x39, 0x8B, 0xBC, 0x94, 0x46, 0xF6,
+    0xB0, 0xD5, 0x36, 0x72, 0xF7, 0x7E, 0xEA, 0x28, 0x4D, 0x1F, 0x26, 0xB5, 0x24, 0xB2, 0xF8, 0x1F,
+    0x22, 0x0F, 0xD7, 0x14, 0x7D, 0xB9, 0xA6, 0xA8, 0xF1, 0x09, 0x1C, 0x25, 0xFD, 0x97, 0x69, 0x80,
+    0x6C, 0x48, 0xE6, 0xBF, 0x9B, 0xE6, 0xB1, 0xCA, 0x63, 0x95, 0x6D, 0x1F, 0x1E, 0x1E, 0x44, 0x4A,
+    0x15, 0x8F, 0x27, 0x93, 0xE7, 0xAE, 0x52, 0x4B, 0x8F, 0x0F, 0xD6, 0x2D, 0x54, 0x6A, 0xAE, 0xE7,
+    0x30, 0x60, 0xE8, 0x97, 0x06, 0xD1, 0x5F, 0xC9, 0xC0, 0x53, 0x68, 0x98, 0x33, 0xE6, 0xED, 0x90,
+    0x08, 0x0A, 0x93, 0xC9, 0x04, 0x95, 0x43, 0x36, 0xC1, 0xD5, 0x4A, 0x65, 0xFB, 0x1C, 0x98, 0x9C,
+    0xAC, 0xF6, 0x6F, 0xA2, 0x8C, 0x86, 0xC3, 0x5A, 0x8A, 0x05, 0x6C, 0xFE, 0x89, 0x24, 0x70, 0x8E,
+    0x37, 0xAD, 0xA1, 0xBB, 0xE3, 0x15, 0x63, 0xC1, 0x40, 0xB1, 0xB3, 0x92, 0x92, 0x71, 0x28, 0x43,
+    0x08, 0xA6, 0x08, 0xEB, 0x2D, 0xB9, 0x9E, 0xD4, 0x11, 0xB1, 0x25, 0x4A, 0xAA, 0x00, 0x77, 0xDE,
+    0xDA, 0x6E, 0xFE, 0x5F, 0xDB, 0xBB, 0x57, 0x7E, 0xE8, 0x51, 0xD2, 0x37, 0x31, 0x13, 0x3B, 0x09,
+    0xC5, 0x11, 0x6E, 0xB0, 0x22, 0x5B, 0x30, 0x52, 0x9D, 0x9C, 0xF0, 0x37, 0x4F, 0x12, 0x86, 0x42,
+    0x32, 0x4C, 0x82, 0xC7, 0x1D, 0x30, 0x71, 0x2C, 0x22, 0x30, 0xC2, 0x46, 0xD2, 0x81, 0x79, 0x35,
+    0xE7, 0x7C, 0x3E, 0xF3, 0xBF, 0x9A, 0x8F, 0xBA, 0xCD, 0x69, 0xD0, 0x24, 0xE0, 0xB5, 0x5B, 0xBB,
+    0xE7, 0xD4, 0x9F, 0xB4, 0x97, 0x37, 0xE8, 0x92, 0x99, 0xBB, 0xA9, 0x4F, 0x72, 0x78, 0xAC, 0x20,
+    0x27, 0x71, 0xE4, 0x13, 0x7A, 0x46, 0xB0, 0x03, 0x82, 0x2D, 0x18, 0xB7, 0x17, 0x28, 0xEB, 0xE1,
+    0x70, 0x40, 0xB0, 0x19, 0xC1, 0xC6, 0x1F, 0x90, 0x42, 0x1E, 0x57, 0xF2, 0x60, 0x53, 0x3C, 0x06,
+    0x16, 0xB0, 0xA8, 0x0A, 0xA9, 0x3E, 0x59, 0xC0, 0xA5, 0x65, 0x56, 0x58, 0x1A, 0xEA, 0xEF, 0x22,
+    0xF0, 0x96, 0xCC, 0xCA, 0x6B, 0x4D, 0x77, 0x11, 0x0A, 0x2D, 0x40, 0x2D, 0xAC, 0x93, 0xE0, 0xF0,
+    0xB8, 0x6E, 0x8A, 0xB6, 0xFB, 0x99, 0x8C, 0xBC, 0x1F, 0xA5, 0xF1, 0x1D, 0x37, 0xE9, 0xB5, 0x38,
+    0xB8, 0xA7, 0x79, 0x14, 0x91, 0x92, 0x97, 0x22, 0x4E, 0xBE, 0xFB, 0x16, 0x1B, 0x83, 0x37, 0x6C,
+    0xC4, 0x26, 0xD3, 0xA9, 0x39, 0xA1, 0xFD, 0xD4, 0x70, 0xDA, 0x4F, 0xCD, 0x0B, 0xED, 0xE7, 0x46,
+    0x45, 0xAB, 0x51, 0xB7, 0x8E, 0x60, 0x07, 0xA3, 0x36, 0xA6, 0x65, 0x28, 0xB7, 0x07, 0x61, 0xBE,
+    0x9D, 0xEB, 0xCA, 0x34, 0xA4, 0x2E, 0x51, 0xFC, 0x38, 0x25, 0x1B, 0x3F, 0x2E, 0xDD, 0xEC, 0x84,
+    0x74, 0xF3, 0x17, 0xD4, 0xA1, 0xF1, 0x3A, 0xFF, 0x55, 0x9D, 0x27, 0xB9, 0x7A, 0xC8, 0x96, 0xEA,
+    0x73, 0x03, 0xBE, 0xBA, 0x8F, 0x5F, 0xC6, 0x4B, 0x8C, 0x35, 0x6D, 0x74, 0x5E, 0xE6, 0xEB, 0xE7,
+    0x0C, 0x5A, 0x14, 0x60, 0x2A, 0x99, 0x3B, 0x74, 0xB4, 0x66, 0x2B, 0x6E, 0x3A, 0x58, 0x87, 0x81,
+    0xEA, 0xAA, 0x94, 0x18, 0x79, 0x8B, 0x32, 0x2E, 0x86, 0x81, 0x4D, 0x53, 0xFA, 0x2A, 0x8D, 0x54,
+    0xD6, 0x7E, 0x20, 0xAE, 0x55, 0x56, 0xD6, 0x6C, 0xE9, 0xA5, 0x4F, 0x32, 0x57, 0x78, 0xCC, 0x41,
+    0x1F, 0x71, 0xE2, 0x17, 0xD6, 0x52, 0xA5, 0x7E, 0x61, 0xAB, 0xBC, 0xCC, 0xFE, 0xD7, 0xFD, 0x4F,
+    0xFE, 0x04, 0x77, 0x80, 0xDF, 0xFF, 0x0A, 0x15, 0x2D, 0x47, 0xAC, 0xEA, 0xF7, 0xB4, 0x84, 0xE1,
+    0x96, 0x7E, 0x19, 0x0C, 0xA9, 0x51, 0x95, 0xF5, 0x4A, 0x86, 0xD8, 0x72, 0x73, 0x92, 0xCA, 0x5E,
+    0xEF, 0x1D, 0xEB, 0xD9, 0x4D, 0x2A, 0x2B, 0x6A, 0x5F, 0xEF, 0x5A, 0x21, 0xE0, 0x77, 0xEF, 0x6B,
+    0x0A, 0xFE, 0xF4, 0xCF, 0x6F, 0xAC, 0xE8, 0x5E, 0x69, 0x1F, 0xD4, 0xCA, 0x07, 0x49, 0xF1, 0xF0,
+    0x53, 0x2B, 0xF7, 0xB2, 0x4F, 0x91, 0xAE, 0x52, 0x47, 0xB9, 0xD3, 0x9A, 0xD5, 0xA5, 0xBF, 0x8E,
+    0x1E, 0x30, 0x95, 0xDE, 0xD2, 0xFF, 0x61, 0x76, 0x84, 0xBC, 0x91, 0x0F, 0xAC, 0x02, 0xBC, 0x0D,
+    0x1D, 0xCC, 0x6E, 0xE0, 0xCF, 0x9C, 0xD4, 0xCD, 0x7B, 0xE7, 0x7B, 0x7B, 0xB8, 0x86, 0x8B, 0x9B,
+    0xB3, 0x48, 0x86, 0x19, 0x3F, 0x02, 0xCD, 0x06, 0x9E, 0xC2, 0x7F, 0x6D, 0xCD, 0xBD, 0xE2, 0x99,
+    0x78, 0xC4, 0x7C, 0x6C, 0xE1, 0x13, 0x02, 0x86, 0xD9, 0x53, 0x16, 0xA4, 0x82, 0x97, 0x7F, 0x25,
+    0x3E, 0x35, 0xFF, 0x2A, 0xC7, 0xD6, 0xC7, 0xC9, 0x37, 0xF9, 0xAF, 0xBF, 0x74, 0x91, 0x88, 0x44,
+    0x5B, 0x9B, 0xDE, 0x38, 0xC2, 0xEE, 0x5D, 0xD8, 0x2F, 0x93, 0xFD, 0x2F, 0x65, 0xFF, 0x3F, 0xC0,
+    0x5F, 0x84, 0xF9, 0x79, 0x99, 0xC1, 0x5F, 0x3F, 0x67, 0xCA, 0x16, 0x08, 0xFA, 0x2E, 0x46, 0x4D,
+    0x07, 0x47, 0x6D, 0x07, 0xFD, 0xF8, 0x12, 0xCE, 0x3F, 0xB4, 0x44, 0x6A, 0x91, 0x0D, 0x8B, 0x68,
+    0xC6, 0x10, 0xE4, 0x57, 0x45, 0x3F, 0x2A, 0x8F, 0x92, 0xB4, 0xD7, 0x15, 0xC7, 0x2C, 0x1A, 0x17,
+    0x30, 0x97, 0x83, 0xCA, 0x29, 0x0B, 0x38, 0x5A, 0xE9, 0x8F, 0x71, 0xFA, 0xE5, 0x60, 0x4D, 0x13,
+    0x53, 0x1E, 0xAD, 0x56, 0x96, 0xE5, 0x7A, 0x01, 0x87, 0xFC, 0xB9, 0x49, 0x55, 0xD5, 0x72, 0x43,
+    0x7A, 0x91, 0x0B, 0x63, 0xBC, 0xDD, 0x4A, 0x25, 0x92, 0xD1, 0x7A, 0x81, 0x6E, 0xE5, 0xBB, 0xD6,
+    0x2B, 0xF6, 0x64, 0x28, 0x47, 0x6E, 0x98, 0x4A, 0x11, 0xE8, 0xC8, 0xFD, 0xD7, 0xA9, 0xFA, 0xE7,
+    0xB7, 0x72, 0x3A, 0xF3, 0x84, 0x7B, 0x3A, 0x9C, 0x79, 0xFC, 0x05, 0xF4, 0x8F, 0xE7, 0x9A, 0x9A,
+    0x1A, 0x07, 0xC6, 0xF2, 0x04, 0x0F, 0x0A, 0x5D, 0x78, 0xC0, 0x33, 0x94, 0x6E, 0x3B, 0x62, 0xB8,
+    0x3A, 0xC4, 0x37, 0xB5, 0x8C, 0x5F, 0x37, 0x6D, 0x6B, 0x51, 0xDA, 0x5A, 0x42, 0x0B, 0xE3, 0x4A,
+    0xEF, 0x06, 0xEB, 0x55, 0xE6, 0x04, 0xB5, 0x3A, 0x5A, 0x35, 0x74, 0x9A, 0x18, 0xB6, 0x30, 0x3C,
+    0xC2, 0xBD, 0x9F, 0x61, 0x83, 0xDF, 0xDD, 0x69, 0x33, 0xE8, 0x74, 0xFE, 0x90, 0xEA, 0x50, 0xDD,
+    0x3B, 0xA9, 0xB0, 0xF2, 0xEC, 0x52, 0xA1, 0x6A, 0xB8, 0x8E, 0x26, 0x51, 0x03, 0xDC, 0x63, 0x42,
+    0xCC, 0xF3, 0x5A, 0x3D, 0x70, 0x3A, 0xCE, 0xB0, 0x3E, 0x6C, 0x06, 0xA3, 0x8A, 0x68, 0x57, 0x71,
+    0x7D, 0x13, 0xCD, 0x1A, 0x6E, 0x5F, 0x47, 0xA7, 0x85, 0xCE, 0x31, 0xBE, 0x4F, 0xB4, 0x0A, 0xAA,
+    0x67, 0xCD, 0x56, 0x07, 0xD3, 0xF2, 0xBA, 0x37, 0xAE, 0x08, 0xAD, 0x88, 0x16, 0x25, 0x18, 0xE6,
+    0xE9, 0xBB, 0xCD, 0x53, 0x52, 0x9C, 0xB2, 0x04, 0x6B, 0xC7, 0xA8, 0xBF, 0x8F, 0x9D, 0x1A, 0x5A,
+    0xD7, 0x41, 0x09, 0x23, 0xE8, 0xB0, 0x8D, 0x46, 0x05, 0x1F, 0x5E, 0x3C, 0xC5, 0x6E, 0xFD, 0x3E,
+    0x5A, 0x75, 0x96, 0x3B, 0x0D, 0x76, 0x68, 0x71, 0xC8, 0x05, 0xD3, 0xCE, 0x8E, 0x10, 0x7A, 0xFE,
+    0x7C, 0xF7, 0xC6, 0x0E, 0xF3, 0x1D, 0x40, 0xFF, 0x63, 0xD1, 0x80, 0xA1, 0xB5, 0x48, 0x6A, 0xCF,
+    0x3B, 0xB8, 0xCB, 0x91, 0x9F, 0x93, 0x78, 0xB7, 0x6B, 0x4D, 0xA7, 0x56, 0xAD, 0x5D, 0xAB, 0xDF,
+    0x70, 0x6E, 0xD9, 0xD2, 0x80, 0xFD, 0xD1, 0x89, 0xF1, 0x19, 0xF0, 0x6F, 0xE8, 0x82, 0x39, 0x87,
+    0xD5, 0xC2, 0x4E, 0x1D, 0x5B, 0x15, 0xFC, 0x17, 0xE5, 0x7D, 0x4F, 0x8C, 0xDE, 0xE8, 0x79, 0xDF,
+    0x4B, 0x52, 0xD2, 0x67, 0x2F, 0x11, 0x71, 0x0F, 0xBB, 0x6E, 0x6A, 0x45, 0xE2, 0x1E, 0x7C, 0x70,
+    0x76, 0xA5, 0x61, 0x0E, 0x46, 0x22, 0xA0, 0x23, 0x91, 0x6B, 0x1F, 0x72, 0x08, 0x50, 0xCF, 0x61,
+    0xB5, 0x01, 0xB2, 0x87, 0xCD, 0x25, 0x07, 0x27, 0x2D, 0x26, 0x07, 0xA1, 0x9D, 0x36, 0xDA, 0x21,
+    0x37, 0x46, 0xEB, 0x43, 0x0E, 0x56, 0x51, 0xDB, 0x01, 0xBA, 0x40, 0xA3, 0x02, 0x2E, 0xE0, 0x68,
+    0x81, 0x48, 0x6D, 0x55, 0x54, 0x01, 0x46, 0x43, 0xDA, 0x7B, 0xF0, 0xC1, 0x87, 0xD0, 0x69, 0x9D,
+    0x1C, 0x72, 0x08, 0x6D, 0x4B, 0xB1, 0xAB, 0x05, 0xBA, 0xB4, 0xFD, 0x6D, 0x4C, 0xCD, 0xF2, 0x23,
+    0xFB, 0xFC, 0x7E, 0xCF, 0x4B, 0x7E, 0xFC, 0x66, 0x46, 0xDA, 0x3F, 0xD6, 0x7A, 0xB5, 0xC9, 0x60,
+    0x87, 0xE4, 0x6A, 0xBE, 0x8F, 0x7C, 0xDF, 0xE7, 0x7D, 0xDE, 0xE7, 0xF9, 0x3D, 0x7F, 0x69, 0x8C,
+    0x7B, 0xC5, 0xC8, 0x8F, 0xDB, 0xE0, 0x68, 0x5A, 0x1E, 0xCF, 0xF3, 0x18, 0xF0, 0x38, 0x4B, 0xCC,
+    0xCA, 0x4F, 0xD4, 0xF7, 0x7D, 0x6D, 0x9E, 0xE1, 0xD1, 0x2C, 0x8C, 0x57, 0xE3, 0x4B, 0x4E, 0x65,
+    0x1C, 0x39, 0x96, 0xC6, 0x6D, 0x8D, 0x5B, 0x18, 0x8F, 0x37, 0xF3, 0xE6, 0x3C, 0xD6, 0xBC, 0x0B,
+    0x8F, 0xFE, 0x9B, 0x17, 0x36, 0xE4, 0xBE, 0x7D, 0x5F, 0xC9, 0xF1, 0xCE, 0x05, 0xB9, 0x73, 0x58,
+    0xE0, 0xDF, 0xF5, 0x18, 0x65, 0x38, 0xC6, 0x7C, 0x5E, 0xCC, 0x67, 0xA5, 0xC6, 0x1C, 0x37, 0x26,
+    0x37, 0xE6, 0x8C, 0x31, 0x9D, 0x31, 0xEB, 0x78, 0xA0, 0x3C, 0xED, 0x84, 0x3C, 0xBC, 0x31, 0xB9,
+    0x1C, 0xF1, 0x04, 0xC7, 0x1C, 0xC1, 0xAD, 0xCB, 0x48, 0xBE, 0x18, 0x54, 0xF8, 0xBA, 0x5F, 0xE2,
+    0xEB, 0x4E, 0x72, 0xE4, 0x91, 0x1E, 0xB9, 0xDC, 0xAC, 0xEF, 0xB3, 0x50, 0x8F, 0x49, 0x9C, 0x84,
+    0xC9, 0x19, 0xF9, 0x5A, 0x20, 0x9F, 0xCD, 0xE5, 0x78, 0xD6, 0xEC, 0xCA, 0xF1, 0x29, 0xF9, 0xDA,
+    0x47, 0x87, 0x65, 0x71, 0x78, 0x74, 0x79, 0xF4, 0xBA, 0x5E, 0x6E, 0xE8, 0xC9, 0x77, 0x39, 0xE6,
+    0xB4, 0xC2, 0x38, 0xFD, 0xB9, 0xF1, 0x2B, 0xFC, 0x6F, 0x50, 0x1A, 0xAF, 0xB5, 0xC7, 0x90, 0x1F,
+    0x88, 0x0A, 0x4C, 0x4A, 0xC6, 0x29, 0x1F, 0x93, 0x71, 0x06, 0x95, 0x49, 0x13, 0x13, 0x67, 0x1F,
+    0xEB, 0x6F, 0xFB, 0x9D, 0x89, 0xFB, 0x85, 0xFC, 0x03, 0x7E, 0x3E, 0xB7, 0x7C, 0x8E, 0xCE, 0xDE,
+    0xD7, 0x59, 0xF2, 0x8F, 0x9F, 0x32, 0x07, 0xE9, 0x59, 0x91, 0x9E, 0x15, 0xA6, 0xE7, 0x97, 0x18,
+    0xA7, 0x57, 0xE0, 0xFB, 0x72, 0x74, 0x79, 0x94, 0x47, 0xBB, 0xC9, 0x61, 0xF4, 0xE4, 0x51, 0x9F,
+    0x2A, 0xE3, 0x34, 0x0F, 0xA0, 0x67, 0x62, 0xE9, 0x69, 0x48, 0x4F, 0x43, 0x7A, 0x0E, 0xC7, 0x13,
+    0xFD, 0x97, 0xF0, 0xCF, 0x7D, 0xBB, 0x1C, 0x55, 0xD8, 0x5F, 0x36, 0x6E, 0x7F, 0x4D, 0x88, 0x50,
+    0xB9, 0x0B, 0xCC, 0xB2, 0x03, 0xE9, 0x17, 0x58, 0xD8, 0x1B, 0x7C, 0x2A, 0x1F, 0x1A, 0xE1, 0x39,
+    0x31, 0x0E, 0x69, 0xC6, 0x3B, 0xF4, 0x25, 0x0E, 0x85, 0xE9, 0x71, 0x8F, 0xC3, 0x0E, 0x7C, 0xB6,
+    0x7C, 0xD8, 0xC1, 0xD7, 0x02, 0x13, 0xCC, 0xCD, 0x2D, 0xD0, 0xBF, 0xC1, 0x97, 0xE5, 0x16, 0xCE,
+    0xC6, 0x38, 0x82, 0x5C, 0x86, 0x36, 0xDB, 0xCB, 0xE5, 0x53, 0x45, 0x20, 0xD4, 0xC6, 0x8C, 0x53,
+    0xE3, 0x55, 0xB2, 0xA0, 0x6E, 0xA6, 0xB7, 0x19, 0xEE, 0x25, 0x43, 0xC0, 0x60, 0x42, 0x30, 0xDD,
+    0xAC, 0x97, 0x89, 0x3A, 0x20, 0xA5, 0x89, 0xF1, 0xFF, 0x3E, 0xE6, 0xE4, 0x76, 0xFA, 0xFC, 0x23,
+    0xF8, 0xCE, 0x39, 0x1C, 0xB6, 0x8D, 0xDC, 0x27, 0x05, 0xA5, 0xE3, 0x0C, 0x2B, 0x7D, 0x6F, 0xB3,
+    0x92, 0xE9, 0x76, 0xF2, 0xDD, 0xA3, 0x09, 0xD7, 0xA4, 0x95, 0x15, 0xF9, 0xA1, 0x8E, 0x79, 0xA1,
+    0x6B, 0x09, 0x8E, 0xC1, 0xF4, 0xB1, 0x0A, 0x58, 0x03, 0xAC, 0x00, 0x28, 0x01, 0x42, 0x80, 0xF6,
+    0xA0, 0x39, 0x7E, 0x41, 0x75, 0x50, 0x1B, 0xBF, 0xA9, 0x1D, 0x65, 0xA7, 0xBF, 0x27, 0x84, 0xA8,
+    0x39, 0xB6, 0x8D, 0xC1, 0xA6, 0xF2, 0xAA, 0x18, 0x77, 0x90, 0xCF, 0xCC, 0xAA, 0x14, 0x1B, 0xED,
+    0x89, 0x55, 0xB6, 0x90, 0xE7, 0x71, 0x0C, 0x4A, 0xB8, 0xC5, 0xC0, 0x52, 0xE4, 0x5C, 0x6E, 0x30,
+    0xF2, 0x03, 0xD9, 0x81, 0xDC, 0xB0, 0x5C, 0x16, 0xB2, 0x02, 0x79, 0x80, 0x07, 0xF2, 0x01, 0x19,
+    0x80, 0x87, 0x74, 0xA4, 0x5D, 0x37, 0x1C, 0x30, 0x30, 0x3B, 0x32, 0x3D, 0x5D, 0xEB, 0x45, 0x9C,
+    0x79, 0xED, 0xF0, 0x90, 0xC3, 0xEE, 0x1F, 0xEC, 0xBB, 0x7F, 0xB6, 0x72, 0x7F, 0x1E, 0x76, 0x87,
+    0x81, 0x73, 0xE7, 0xBD, 0xCD, 0xE8, 0x0F, 0xB9, 0x31, 0x6F, 0x87, 0x9B, 0xFC, 0x1E, 0xBE, 0x90,
+    0x5F, 0x56, 0x99, 0x20, 0x3B, 0x85, 0xF7, 0xDC, 0xA4, 0x14, 0xC0, 0x4D, 0xB8, 0x0D, 0x71, 0x51,
+    0xEA, 0x23, 0xB1, 0x65, 0x16, 0x2A, 0x76, 0x0B, 0x2B, 0x8B, 0xFD, 0x4C, 0xF7, 0xA3, 0x09, 0x12,
+    0xD7, 0x5E, 0x58, 0x29, 0x25, 0xDB, 0xD2, 0xEB, 0xBE, 0x8A, 0x8B, 0x35, 0x70, 0x22, 0x46, 0x70,
+    0xCE, 0xCC, 0xDE, 0x7C, 0x01, 0x7F, 0x5C, 0x97, 0x49, 0x3B, 0x20, 0xD0, 0x16, 0x26, 0x0E, 0x9A,
+    0xCD, 0x31, 0x46, 0x3C, 0xAD, 0xC6, 0x38, 0x65, 0x80, 0x6E, 0x85, 0xB1, 0xCA, 0xBF, 0xC8, 0xC3,
+    0x85, 0x10, 0x29, 0x37, 0xBB, 0xFC, 0xBB, 0x2C, 0x5A, 0x28, 0xB2, 0x21, 0x71, 0x16, 0x24, 0x76,
+    0x0A, 0x6A, 0xC6, 0x0B, 0x2C, 0x66, 0x54, 0x83, 0x35, 0xFF, 0x09, 0x04, 0x96, 0x89, 0x4B, 0x11,
+    0x1B, 0xFD, 0x6D, 0x61, 0xBB, 0xE9, 0xC2, 0xCB, 0x30, 0x12, 0x2E, 0xFE, 0xB1, 0xDE, 0x72, 0xAE,
+    0x6E, 0x32, 0x4C, 0x8A, 0x74, 0xC6, 0x5C, 0x48, 0x1C, 0xCC, 0x85, 0xA2, 0x12, 0x73, 0x49, 0x07,
+    0xA1, 0x9B, 0x0F, 0x72, 0xA2, 0x1B, 0x44, 0x05, 0xA9, 0xE1, 0xEF, 0x5D, 0x7D, 0xB5, 0xBF, 0x9A,
+    0x18, 0x95, 0x99, 0xA0, 0x9D, 0xCC, 0xC5, 0x6D, 0x8E, 0xF5, 0x24, 0xB7, 0x7C, 0x51, 0x66, 0xA1,
+    0x17, 0xB2, 0xAF, 0x55, 0xC8, 0x45, 0x9C, 0x8B, 0x3F, 0x5E, 0x54, 0xB8, 0x48, 0xF9, 0xC5, 0x98,
+    0xBB, 0x30, 0x28, 0x54, 0x38, 0xE0, 0x8B, 0x1D, 0x1F, 0x18, 0x17, 0x3E, 0x24, 0xF4, 0xE5, 0x63,
+    0x94, 0x68, 0xC2, 0x4D, 0xF2, 0xB4, 0x7B, 0xE6, 0x80, 0x9C, 0x8E, 0xDE, 0x9B, 0x9C, 0xCE, 0x38,
+    0xCE, 0x12, 0x63, 0x93, 0x15, 0x91, 0xF1, 0xC8, 0xD8, 0x64, 0x30, 0xE3, 0x51, 0x86, 0x11, 0x70,
+    0x90, 0x01, 0x97, 0x43, 0xD7, 0x48, 0x17, 0x28, 0x2A, 0x44, 0x4E, 0x9B, 0xF8, 0x8E, 0xC8, 0x69,
+    0x13, 0x93, 0x32, 0x8F, 0x65, 0x4A, 0xF1, 0xC2, 0x2C, 0x85, 0xA3, 0x51, 0xA6, 0xF0, 0xAA, 0x43,
+    0xD5, 0xB6, 0xAE, 0x8F, 0x4F, 0x81, 0xFD, 0xC3, 0x19, 0x76, 0x4D, 0xAF, 0x03, 0x5D, 0xF0, 0x1B,
+    0x72, 0x19, 0x64, 0x1C, 0xF4, 0x79, 0x5D, 0x13, 0x65, 0x74, 0xDE, 0xCC, 0xAB, 0xF1, 0x27, 0x19,
+    0xF8, 0x9A, 0x6A, 0xC2, 0x1D, 0x32, 0xA1, 0xCA, 0xDC, 0xE0, 0xEF, 0x3A, 0x15, 0xDB, 0xBD, 0x9E,
+    0xB8, 0xC8, 0x51, 0xA6, 0xE2, 0x35, 0x09, 0x6A, 0x9E, 0xFC, 0xB9, 0xB1, 0x7C, 0x84, 0x15, 0x76,
+    0x17, 0xBA, 0x77, 0x7B, 0x3D, 0x89, 0x18, 0xC4, 0x26, 0x8E, 0xE7, 0xDC, 0xBF, 0x94, 0x7A, 0xE6,
+    0xE3, 0x76, 0xF0, 0x81, 0xCE, 0x4F, 0xC4, 0x8C, 0x9E, 0xDD, 0xDA, 0x4E, 0xE5, 0xA6, 0x3D, 0x7F,
+    0xD2, 0x1C, 0xF2, 0x03, 0x01, 0x84, 0xED, 0x00, 0x19, 0x44, 0xD9, 0x2C, 0x4F, 0xE2, 0x10, 0x16,
+    0x2A, 0x0A, 0x30, 0x6D, 0x48, 0x03, 0xB2, 0x60, 0xA9, 0x1C, 0x28, 0x92, 0x1F, 0xEB, 0xE3, 0xF1,
+    0x2C, 0x8B, 0xB1, 0x99, 0x91, 0xFD, 0x2E, 0x11, 0x4E, 0xD4, 0x6E, 0x1D, 0x13, 0x5C, 0xF8, 0x45,
+    0xCA, 0xBD, 0xBE, 0x46, 0x46, 0x0D, 0x8B, 0x86, 0xBB, 0x36, 0x7C, 0xAD, 0x24, 0x9B, 0x46, 0x5F,
+    0x4C, 0xC8, 0x00, 0xB2, 0x59, 0x48, 0xD9, 0xB8, 0x56, 0x26, 0x48, 0x2D, 0xAC, 0xC8, 0xAD, 0xE8,
+    0xE8, 0xAC, 0xF4, 0xE8, 0x74, 0x38, 0x32, 0x7B, 0x27, 0x5D, 0x24, 0x98, 0xBE, 0x07, 0x36, 0x31,
+    0xE6, 0x09, 0xF3, 0x11, 0xF2, 0x92, 0xA0, 0x06, 0x67, 0xE1, 0xE0, 0xA3, 0xD0, 0x4C, 0xBC, 0xF1,
+    0xCA, 0x4F, 0x8C, 0x6F, 0x34, 0x51, 0x7F, 0xC5, 0xED, 0x6F, 0x7B, 0xD8, 0x61, 0x7C, 0xDE, 0x39,
+    0x3E, 0xFD, 0x26, 0xA7, 0xCB, 0x9D, 0xE4, 0x96, 0x78, 0xB6, 0x08, 0x14, 0xB2, 0x2D, 0x16, 0xE4,
+    0x14, 0xC5, 0xDE, 0x3A, 0xE7, 0x70, 0x83, 0x33, 0xA2, 0x84, 0xFC, 0x1E, 0x1E, 0xE2, 0xFF, 0x80,
+    0x8B, 0xCD, 0xF5, 0xF4, 0x16, 0xC3, 0x0E, 0x1D, 0x68, 0xEF, 0x95, 0x23, 0x2A, 0x78, 0x9A, 0x1F,
+    0xD1, 0x31, 0x85, 0xFC, 0xA3, 0x33, 0xD2, 0xDF, 0xC5, 0x44, 0x84, 0xFE, 0x6E, 0x0E, 0xCD, 0x84,
+    0x6D, 0x5A, 0xE9, 0xEE, 0x80, 0x74, 0xC4, 0xF0, 0xC0, 0x20, 0x18, 0x2C, 0x24, 0x30, 0xEE, 0x0F,
+    0xFA, 0x82, 0x38, 0xB1, 0xDD, 0xFF, 0xA9, 0xDD, 0xFE, 0xB9, 0x15, 0xB0, 0x9D, 0x95, 0xE0, 0x0B,
+    0x2B, 0x6B, 0x5B, 0x95, 0xB4, 0x8E, 0x3D, 0x13, 0xBD, 0xCA, 0xBD, 0x38, 0xD4, 0xD8, 0x02, 0x8E,
+    0xD8, 0x0A, 0xE8, 0xD4, 0x9E, 0x73, 0x2B, 0xAB, 0x3B, 0x2B, 0xAE, 0x17, 0x7A, 0x06, 0x26, 0xC3,
+    0x3E, 0xCF, 0x29, 0x5B, 0x38, 0x81, 0xC6, 0xB2, 0x5F, 0xB5, 0xCA, 0x86, 0x41, 0x66, 0x26, 0xC0,
+    0x78, 0x79, 0x1E, 0x71, 0xA6, 0x53, 0x2F, 0xD1, 0xA3, 0xCF, 0x9B, 0x50, 0xB5, 0x9B, 0x73, 0xE4,
+    0xEA, 0x2D, 0x1E, 0x6B, 0x2A, 0x93, 0x6A, 0x41, 0x61, 0xCF, 0x69, 0x25, 0x64, 0x22, 0x4E, 0x79,
+    0x9D, 0xC7, 0x9B, 0x24, 0x03, 0x81, 0x9A, 0xB7, 0x77, 0x35, 0x4F, 0x64, 0x35, 0x40, 0xCF, 0x20,
+    0xC1, 0x14, 0xD7, 0x38, 0xE1, 0x75, 0x1E, 0x6F, 0x62, 0x6C, 0x78, 0x68, 0x50, 0x82, 0x68, 0x61,
+    0xF5, 0xE2, 0x3D, 0xE3, 0xE4, 0xF7, 0x44, 0x08, 0xCF, 0x44, 0xFE, 0x02, 0x9F, 0x95, 0xC4, 0x67,
+    0x05, 0xF1, 0x19, 0x8F, 0x33, 0xC5, 0x67, 0x19, 0xA8, 0x2F, 0x32, 0xE2, 0xBE, 0x78, 0x17, 0x14,
+    0x19, 0xF0, 0x6E, 0x89, 0xB9, 0x84, 0x05, 0x14, 0x82, 0x0A, 0x4B, 0x19, 0x46, 0x6F, 0xAC, 0xAE,
+    0x88, 0x29, 0x44, 0x53, 0x92, 0x33, 0xE7, 0x9A, 0x76, 0x66, 0x36, 0xC7, 0xFF, 0x0A, 0x32, 0x01,
+    0x6D, 0xC1, 0xD9, 0x50, 0x14, 0x32, 0x9E, 0xEE, 0x32, 0x94, 0x03, 0x95, 0xE0, 0xC2, 0x81, 0xA6,
+    0x68, 0xA1, 0x1E, 0x1C, 0x82, 0x54, 0xF9, 0x66, 0x58, 0x62, 0x3C, 0xA3, 0x20, 0xF7, 0x48, 0x01,
+    0x19, 0x0F, 0x36, 0xCA, 0x9B, 0x2F, 0xCC, 0x39, 0x9E, 0x0C, 0xF8, 0x7B, 0x73, 0x3E, 0x19, 0x4F,
+    0x6E, 0xAC, 0xFA, 0x92, 0x0F, 0x8F, 0xC7, 0x94, 0xCB, 0x9D, 0x1B, 0x15, 0xED, 0x90, 0x3C, 0x0B,
+    0x13, 0xCE, 0x39, 0x9E, 0x02, 0xE3, 0xB9, 0xF7, 0x28, 0xE2, 0x57, 0x6A, 0x1A, 0xB9, 0xD9, 0x63,
+    0xD4, 0x35, 0xF2, 0x0F, 0x3B, 0xF6, 0x39, 0x5B, 0xF6, 0x49, 0x37, 0xEC, 0xB3, 0x6A, 0x65, 0x49,
+    0xA7, 0xD6, 0xE7, 0xB9, 0x95, 0x6A, 0x02, 0xAF, 0x54, 0x25, 0xEB, 0x15, 0xFA, 0x54, 0x3F, 0xD3,
+    0xE7, 0x06, 0x89, 0x3D, 0x5B, 0x60, 0xB3, 0x66, 0xD5, 0xEA, 0xBA, 0x3D, 0x5F, 0xB2, 0x2A, 0x6B,
+    0xAE, 0xF2, 0x4A, 0x6E, 0xAB, 0x38, 0xA7, 0xD4, 0x89, 0xFB, 0x85, 0x4E, 0x3D, 0xB4, 0x93, 0x3F,
+    0x67, 0xE1, 0x63, 0xAF, 0xC3, 0x0C, 0xED, 0x39, 0xC2, 0x10, 0x61, 0x55, 0x90, 0x02, 0xFC, 0x18,
+    0xBF, 0xB3, 0x6E, 0xCF, 0x17, 0x71, 0x16, 0xC9, 0x73, 0x1D, 0xE7, 0x93, 0xC6, 0x6C, 0x0C, 0x5B,
+    0xE7, 0x51, 0xB3, 0x28, 0x67, 0x7D, 0x1D, 0xF6, 0xED, 0x4C, 0x56, 0x62, 0xD6, 0x57, 0x27, 0xAC,
+    0xB6, 0x8C, 0x47, 0x85, 0x29, 0xD4, 0x54, 0x9D, 0x09, 0xFA, 0xAA, 0xDA, 0x14, 0x8A, 0xCB, 0x9F,
+    0xD6, 0x54, 0x04, 0x88, 0x2C, 0x52, 0xF5, 0x34, 0xF7, 0xE6, 0x56, 0x61, 0x5D, 0xF2, 0xE6, 0x6A,
+    0x48, 0x99, 0x73, 0xB3, 0x3A, 0xB2, 0xC2, 0xFB, 0x05, 0x55, 0xA4, 0x14, 0x3C, 0xBA, 0xFE, 0x6E,
+    0xF7, 0xE2, 0x1D, 0x65, 0x8E, 0x59, 0x13, 0x14, 0xCA, 0x2C, 0x61, 0x6D, 0x95, 0xAA, 0xEC, 0x94,
+    0xA8, 0x50, 0x30, 0xD5, 0xCB, 0x32, 0x87, 0xA5, 0xCA, 0x67, 0xAB, 0x64, 0x45, 0xBF, 0xC5, 0x4A,
+    0x12, 0x59, 0x86, 0x54, 0xC9, 0x25, 0x9A, 0x75, 0x97, 0x2B, 0xEA, 0xF6, 0x83, 0xC2, 0x0D, 0x5B,
+    0x85, 0xF2, 0x95, 0x89, 0x2F, 0x0B, 0x1E, 0xAD, 0xAD, 0xE0, 0xC6, 0xB3, 0xB1, 0x25, 0xA2, 0x3D,
+    0x59, 0xC7, 0x3C, 0x11, 0x61, 0xBD, 0xC0, 0x12, 0xB7, 0xB8, 0xE3, 0x4D, 0xEE, 0xE6, 0x29, 0x90,
+    0x2E, 0x2D, 0x68, 0x7E, 0x9E, 0xC8, 0x46, 0xFE, 0xCF, 0x21, 0xE4, 0x54, 0xEE, 0x56, 0x00, 0xB0,
+    0x44, 0xD8, 0xC5, 0x19, 0x1C, 0xCE, 0xE3, 0x0F, 0xD8, 0x93, 0x49, 0x9C, 0x09, 0x2C, 0x0D, 0xEF,
+    0xC9, 0x0E, 0xA6, 0x8E, 0x58, 0x5A, 0x2D, 0x1F, 0x6A, 0x8D, 0x2D, 0x28, 0xD8, 0xD5, 0x55, 0x35,
+    0xBE, 0x9E, 0x93, 0xF5, 0x41, 0x45, 0x2B, 0x8A, 0xEF, 0xB3, 0x7F, 0x80, 0x48, 0xE5, 0x43, 0x83,
+    0x28, 0x53, 0xAB, 0xDA, 0x61, 0x79, 0xED, 0x29, 0x48, 0x8E, 0x07, 0x89, 0x99, 0xA8, 0xC4, 0x4C,
+    0xAD, 0xD5, 0x95, 0xAB, 0xD1, 0xA5, 0x92, 0x92, 0x7B, 0x5D, 0x25, 0x67, 0xAB, 0x62, 0x4C, 0x25,
+    0xE5, 0x9A, 0x85, 0xF7, 0xE7, 0xAC, 0x60, 0x5A, 0xB7, 0xA2, 0x69, 0xCB, 0x0A, 0xA7, 0xB9, 0x15,
+    0x4F, 0xB5, 0x22, 0x0E, 0x11, 0xD0, 0x14, 0xE0, 0xF2, 0x38, 0xEE, 0x1E, 0x11, 0x06, 0x6A, 0xE4,
+    0x26, 0x7A, 0xCE, 0xAD, 0xF1, 0x6D, 0xAD, 0x24, 0x31, 0xB2, 0x8E, 0x41, 0x63, 0xCA, 0x92, 0xD3,
+    0x98, 0x3E, 0xBA, 0xE4, 0x97, 0x02, 0xE2, 0x69, 0x2E, 0x14, 0x2F, 0x40, 0x30, 0xB9, 0x27, 0xF6,
+    0x5F, 0x88, 0x31, 0xE2, 0x7F, 0xE0, 0x38, 0x70, 0x5E, 0x97, 0x8B, 0xFF, 0x25, 0xA3, 0x71, 0x5F,
+    0x97, 0x21, 0xFC, 0x04, 0x36, 0xFF, 0x5F, 0xD7, 0xFC, 0x35, 0xDE, 0x6B, 0xB5, 0x99, 0xFD, 0x11,
+    0x2F, 0xC4, 0x1A, 0xC4, 0xC8, 0x66, 0x9F, 0x9F, 0x9B, 0x53, 0x18, 0x92, 0xFF, 0xE9, 0xC6, 0xAC,
+    0x43, 0xA9, 0x04, 0x32, 0xB1, 0x1B, 0x18, 0x54, 0x20, 0x33, 0xAD, 0x41, 0xF5, 0xD0, 0x69, 0xBD,
+    0x12, 0xC3, 0x3A, 0x65, 0xDA, 0x59, 0x06, 0x72, 0x9D, 0x31, 0x8B, 0x80, 0xF2, 0x74, 0xDD, 0x74,
+    0x6B, 0x16, 0xB7, 0xEC, 0xAE, 0x93, 0x62, 0x5B, 0x26, 0xBF, 0x41, 0xD5, 0x76, 0xD3, 0xA4, 0x35,
+    0x69, 0x27, 0x82, 0xA9, 0x24, 0xD1, 0xE4, 0x22, 0x03, 0xD5, 0x4E, 0x74, 0xF2, 0xDD, 0x13, 0xFD,
+    0x86, 0xAC, 0x8E, 0xB0, 0x46, 0x8A, 0x71, 0xCB, 0x2C, 0x1D, 0x28, 0x66, 0x61, 0x24, 0x27, 0xEF,
+    0x74, 0x1F, 0x70, 0xA5, 0x2D, 0x44, 0xE3, 0x3E, 0xB0, 0x88, 0x11, 0x63, 0x03, 0xD1, 0xA3, 0xC2,
+    0x22, 0xC6, 0x4C, 0x99, 0x14, 0x03, 0x03, 0xD1, 0x63, 0xD5, 0x0A, 0x17, 0x72, 0xAB, 0x50, 0x09,
+    0xB1, 0xEE, 0x5C, 0xB8, 0xD0, 0x59, 0x91, 0xB4, 0x98, 0x20, 0x47, 0x21, 0xBA, 0xF2, 0x7F, 0xA2,
+    0x08, 0x72, 0x40, 0x8E, 0xA9, 0xE5, 0xFF, 0xDC, 0xCA, 0x3D, 0xCB, 0xFF, 0x44, 0x8E, 0x76, 0x1F,
+    0xE4, 0x44, 0x8C, 0xF5, 0x8C, 0x06, 0xEF, 0xB8, 0x3C, 0x60, 0xF8, 0xFE, 0x1A, 0xD0, 0x49, 0x05,
+    0x74, 0xA2, 0xDA, 0x70, 0x81, 0xC1, 0x7A, 0x84, 0x50, 0xD4, 0x9B, 0x25, 0x1D, 0x2F, 0x15, 0x26,
+    0x10, 0x54, 0xB1, 0x1E, 0x01, 0x6B, 0x2A, 0x58, 0xE7, 0x61, 0x89, 0x81, 0x47, 0x65, 0x4F, 0x89,
+    0xCF, 0x63, 0xD6, 0x53, 0xB1, 0xF6, 0x94, 0xFC, 0x39, 0x6C, 0x02, 0x6E, 0xD0, 0x76, 0x69, 0xE0,
+    0x8A, 0x32, 0x80, 0x95, 0x2F, 0xA3, 0xEF, 0x28, 0x8A, 0x53, 0xEC, 0x46, 0xEB, 0x92, 0x8A, 0xAC,
+    0x7A, 0x86, 0x7E, 0xA5, 0x9F, 0x68, 0x61, 0x71, 0xCB, 0x04, 0x8D, 0x87, 0xF7, 0x43, 0xE3, 0xC9,
+    0x21, 0x68, 0xBC, 0x56, 0x14, 0xF1, 0x20, 0x34, 0xDE, 0x1E, 0x86, 0xC6, 0x13, 0xDD, 0x1B, 0x87,
+    0xA1, 0x71, 0x7B, 0x0E, 0xCB, 0x15, 0xDA, 0xFA, 0xDC, 0xB2, 0x82, 0x1A, 0x33, 0xA2, 0xC6, 0x56,
+    0x51, 0xA3, 0x99, 0xA0, 0x46, 0xA2, 0x83, 0x80, 0xA8, 0x51, 0xEE, 0xE1, 0xD1, 0xC5, 0x01, 0x99,
+    0x58, 0x5A, 0x0F, 0x80, 0x8C, 0x55, 0x84, 0x41, 0x50, 0xE1, 0x5B, 0x41, 0x79, 0x02, 0x33, 0x25,
+    0xC0, 0x0A, 0xEF, 0x7E, 0xF5, 0x03, 0xF1, 0x32, 0x26, 0xC3, 0xDD, 0x7F, 0x16, 0x2F, 0xE3, 0x3E,
+    0x7F, 0x44, 0x06, 0x7F, 0x84, 0x08, 0x46, 0xD9, 0x83, 0x31, 0xFD, 0x11, 0x29, 0xFD, 0x11, 0xBB,
+    0xF4, 0x47, 0xE8, 0x24, 0x16, 0x4B, 0xAF, 0x84, 0xF5, 0x4D, 0x4C, 0xD1, 0xD4, 0x7C, 0x3F, 0xAA,
+    0xF5, 0x27, 0xA8, 0x36, 0x98, 0xA2, 0xA9, 0x62, 0x54, 0xF0, 0xC7, 0xFA, 0x3B, 0x54, 0x6E, 0xDD,
+    0xA3, 0x6B, 0x85, 0x1A, 0x73, 0xE1, 0x39, 0x7E, 0x56, 0x7D, 0x6E, 0xD4, 0x9F, 0xC3, 0xF0, 0x9D,
+    0x9C, 0x3B, 0x21, 0xEA, 0xFA, 0x5C, 0x66, 0xDF, 0x27, 0xA9, 0x2B, 0x36, 0x4B, 0x0B, 0xC7, 0x2A,
+    0x14, 0xCC, 0x42, 0x66, 0x1A, 0xC1, 0xFD, 0x16, 0x42, 0xEC, 0x81, 0xC1, 0xD2, 0x04, 0xDA, 0xAC,
+    0xCA, 0x41, 0xB8, 0x40, 0x36, 0xA8, 0xD0, 0x2C, 0x94, 0x1D, 0xEA, 0x81, 0xC9, 0x72, 0xBA, 0xD4,
+    0x45, 0xDD, 0xFA, 0x70, 0xE6, 0xC5, 0x99, 0x9C, 0xC4, 0xF4, 0x2A, 0x82, 0x52, 0x6E, 0xE8, 0xCF,
+    0x83, 0x42, 0xF0, 0x98, 0xC8, 0xB6, 0x37, 0x20, 0x26, 0x04, 0x65, 0x5E, 0x1E, 0xC7, 0x30, 0xF0,
+    0x9C, 0xCF, 0x20, 0x86, 0x39, 0x76, 0xF5, 0x8A, 0x2A, 0xC1, 0x46, 0xE0, 0xA7, 0x7C, 0xF2, 0x36,
+    0xF0, 0x27, 0x78, 0x62, 0xC1, 0xCD, 0xEF, 0x70, 0x0B, 0x15, 0x9C, 0xB8, 0xDC, 0x3C, 0x23, 0x87,
+    0x51, 0x7B, 0x06, 0x35, 0xB5, 0xE7, 0xEC, 0x4D, 0xA5, 0x0C, 0x1D, 0x05, 0x44, 0x7C, 0x4B, 0x26,
+    0x76, 0xF4, 0xFF, 0x66, 0x2A, 0xAA, 0x42, 0x05, 0x91, 0xEB, 0xBA, 0x9C, 0x73, 0xAB, 0x98, 0x94,
+    0x69, 0x33, 0x62, 0xBD, 0x35, 0x55, 0xAC, 0x3B, 0x0A, 0x1E, 0x1B, 0x03, 0x47, 0xA2, 0xE8, 0x98,
+    0x13, 0xF4, 0x91, 0x27, 0x84, 0x34, 0x1F, 0x26, 0x1B, 0xBF, 0xB0, 0x36, 0xBE, 0x5A, 0xA2, 0xD6,
+    0xC6, 0x1F, 0x36, 0xDC, 0x18, 0xED, 0x5A, 0x9E, 0xCF, 0xD9, 0xF3, 0xFA, 0xBE, 0xF3, 0x13, 0x10,
+    0xAC, 0x73, 0xBF, 0xEF, 0x36, 0xFB, 0xEA, 0xB1, 0xFE, 0x1E, 0x68, 0x94, 0x66, 0xEA, 0xBE, 0xC4,
+    0x58, 0x52, 0x4E, 0x6A, 0xD7, 0x7A, 0x2D, 0x7D, 0x4E, 0x24, 0xA0, 0x15, 0x13, 0x0C, 0x72, 0xCA,
+    0x1D, 0xE4, 0x94, 0x18, 0xD4, 0x27, 0x6A, 0xBA, 0x05, 0x31, 0xFF, 0x1E, 0x9A, 0xFA, 0xE8, 0x73,
+    0xC1, 0xFD, 0xF6, 0x5D, 0xB6, 0x64, 0x1A, 0xBA, 0x8B, 0x8F, 0x59, 0x73, 0xBA, 0xE5, 0x21, 0xEC,
+    0xEB, 0x94, 0x90, 0xE0, 0x87, 0x27, 0xFA, 0x6A, 0x93, 0x98, 0x00, 0x88, 0x88, 0x4B, 0xD8, 0xD2,
+    0x98, 0x6D, 0xB8, 0x1E, 0xF2, 0x70, 0x0C, 0x13, 0x76, 0xED, 0x9C, 0x43, 0xF5, 0xF8, 0x0F, 0x18,
+    0xAE, 0x9E, 0xC0, 0x02, 0x1E, 0x4F, 0x18, 0xC9, 0x8C, 0xD8, 0x85, 0xD8, 0x80, 0x27, 0x62, 0x82,
+    0x0A, 0x03, 0xE3, 0x15, 0xFF, 0x01, 0x23, 0xC3, 0x49, 0xED, 0x4D, 0xB9, 0x92, 0x41, 0xE2, 0x2A,
+    0xCA, 0xAC, 0x19, 0x8E, 0x53, 0xAC, 0x2B, 0x1C, 0x73, 0x91, 0x76, 0xCD, 0x70, 0x5A, 0x98, 0xC1,
+    0x3E, 0x6F, 0x75, 0xBD, 0x16, 0x03, 0x7A, 0xC4, 0x58, 0xDB, 0x61, 0xCD, 0xFA, 0x6E, 0xC3, 0xAE,
+    0x5A, 0x6F, 0x91, 0xC2, 0x3F, 0xF0, 0xF9, 0xD2, 0xF5, 0x3C, 0xCE, 0xD7, 0x6A, 0x9B, 0x72, 0xB8,
+    0xF2, 0xC7, 0xAB, 0x59, 0x71, 0xC8, 0xD5, 0x68, 0x64, 0x2C, 0xDD, 0xBF, 0x0E, 0x35, 0x86, 0xAA,
+    0xBE, 0x1F, 0x02, 0x72, 0x62, 0x70, 0x67, 0xB8, 0xD9, 0xD6, 0x39, 0xA8, 0xB3, 0x1C, 0xC6, 0x53,
+    0xD6, 0x5F, 0x3D, 0xD5, 0x0C, 0x7B, 0x5F, 0xA2, 0xD4, 0x80, 0x20, 0xF2, 0xDF, 0x7C, 0x11, 0x5E,
+    0x77, 0xA2, 0x1A, 0xA1, 0x45, 0x4F, 0x0E, 0xCD, 0x49, 0x83, 0x74, 0xF4, 0xBF, 0xD0, 0xAF, 0x3E,
+    0xF8, 0x83, 0x34, 0x7C, 0x30, 0x6B, 0x30, 0xD7, 0x68, 0xF0, 0x04, 0xA5, 0xFD, 0xC8, 0xBA, 0x03,
+    0xE0, 0x33, 0x23, 0xE2, 0x53, 0xC8, 0xD7, 0x9A, 0x25, 0xE6, 0x1B, 0x41, 0xDF, 0x88, 0xFA, 0x54,
+    0x98, 0xCC, 0xCD, 0x12, 0xF7, 0x29, 0xF0, 0xC3, 0x50, 0x53, 0x4A, 0xD3, 0x5E, 0x9D, 0x1E, 0x74,
+    0x12, 0x11, 0xA7, 0x94, 0x72, 0x03, 0x0B, 0xFA, 0xBA, 0x41, 0xA6, 0xF4, 0x03, 0xFC, 0xCB, 0x5D,
+    0x8B, 0xFF, 0x7A, 0x15, 0x2B, 0x32, 0xDA, 0x01, 0x01, 0x2E, 0x3C, 0x15, 0x28, 0x6E, 0x6B, 0x31,
+    0xA0, 0x3F, 0xF7, 0x15, 0x93, 0xA6, 0x15, 0x18, 0x06, 0x33, 0x7A, 0x56, 0xA1, 0x0A, 0xA4, 0x35,
+    0x84, 0xEB, 0xFE, 0xD0, 0xD7, 0x83, 0x83, 0x47, 0x18, 0x33, 0xC7, 0xCB, 0xB1, 0x72, 0x9C, 0x1C,
+    0x23, 0xC6, 0xC7, 0xB1, 0xA9, 0x87, 0x0D, 0x63, 0x52, 0xFF, 0x1A, 0xDD, 0x6B, 0x18, 0x07, 0xC7,
+    0x40, 0x8A, 0x5A, 0xD7, 0x9A, 0x4A, 0x79, 0x19, 0x4B, 0xA8, 0x16, 0x7C, 0x00, 0x0B, 0x5E, 0x1E,
+    0x45, 0xCE, 0xBA, 0x69, 0x11, 0x40, 0xB7, 0x1F, 0x6F, 0x38, 0x17, 0x2E, 0xF4, 0x10, 0x42, 0x9D,
+    0x5C, 0x3D, 0x8F, 0xBF, 0x62, 0xCD, 0x26, 0x63, 0xA5, 0x32, 0xF0, 0xEB, 0x33, 0x60, 0xC0, 0xD1,
+    0x82, 0x47, 0xDC, 0xB1, 0x85, 0x05, 0x5F, 0x99, 0x19, 0xF5, 0xFF, 0xD1, 0x64, 0xBF, 0x49, 0xCB,
+    0xA0, 0x1C, 0xC8, 0xD0, 0xBF, 0xDA, 0xF0, 0x41, 0x72, 0xA3, 0x9C, 0x94, 0x0B, 0xE9, 0xA1, 0x12,
+    0x92, 0x68, 0xC0, 0x86, 0xD3, 0xA1, 0x48, 0x6C, 0xF0, 0x54, 0x59, 0x7F, 0x31, 0x10, 0x1B, 0xE2,
+    0x10, 0xAF, 0xF6, 0x35, 0x4C, 0x39, 0xAB, 0xC1, 0x16, 0xF2, 0x2B, 0x2C, 0x58, 0xF1, 0x22, 0x20,
+    0x47, 0xE2, 0xE2, 0x4E, 0xAA, 0x9B, 0x34, 0xA4, 0x63, 0x24, 0x2C, 0xED, 0x05, 0x83, 0x40, 0xB8,
+    0xE0, 0xF6, 0xC4, 0x05, 0x80, 0x78, 0x02, 0x7D, 0xD4, 0x63, 0x69, 0x23, 0x55, 0x2A, 0xB9, 0x85,
+    0x8E, 0x20, 0xA9, 0xCA, 0x80, 0x8E, 0xB1, 0x74, 0x35, 0x1F, 0xFB, 0x57, 0x16, 0x1A, 0x52, 0x8C,
+    0xC6, 0x7D, 0xF8, 0x9C, 0x9E, 0x36, 0xE9, 0x50, 0x95, 0xED, 0x04, 0xBE, 0x4D, 0x2F, 0xD3, 0x50,
+    0x5F, 0x90, 0x67, 0x81, 0x43, 0x0B, 0x8A, 0x12, 0xF0, 0xAB, 0x62, 0x73, 0x9C, 0xC0, 0xAB, 0x7E,
+    0x3D, 0x98, 0x28, 0xB1, 0xD2, 0x17, 0x5C, 0x2A, 0x9A, 0x75, 0x57, 0x43, 0x83, 0x9D, 0x7A, 0x0B,
+    0xB8, 0x50, 0xCA, 0x9D, 0xEE, 0x82, 0xA7, 0x59, 0x43, 0xC5, 0x17, 0xD4, 0xE4, 0x9C, 0xA8, 0x54,
+    0xF6, 0xCC, 0xC8, 0x93, 0xBD, 0xCA, 0xB0, 0x96, 0x3B, 0x27, 0x9A, 0x2B, 0x70, 0xCE, 0x26, 0x36,
+    0x89, 0xD3, 0xFF, 0x48, 0x60, 0xE4, 0x9D, 0xBC, 0xD0, 0xE9, 0xCB, 0x02, 0x64, 0x72, 0xB7, 0x28,
+    0x81, 0x6B, 0x15, 0x72, 0x2E, 0x66, 0x50, 0x10, 0xA3, 0xDD, 0x05, 0xC7, 0x2D, 0x0C, 0x01, 0x4F,
+    0x8C, 0x48, 0x63, 0x9C, 0xC8, 0x18, 0xE3, 0xE4, 0xB8, 0x1C, 0xB2, 0x5F, 0x46, 0x02, 0xC1, 0x7F,
+    0x6B, 0x1E, 0x0F, 0xFA, 0x6F, 0xC3, 0xE4, 0x31, 0x72, 0xBF, 0x0D, 0xEB, 0xF5, 0xFE, 0x04, 0x9E,
+    0x32, 0xC7, 0x6E, 0xA8, 0xE1, 0xD1, 0x11, 0x81, 0x09, 0x68, 0x15, 0xDF, 0xB1, 0xB0, 0x93, 0x78,
+    0xCD, 0x2B, 0x44, 0x75, 0xFA, 0xBF, 0x8E, 0x3F, 0xC6, 0x5F, 0x69, 0xCD, 0xA9, 0x16, 0x6B, 0x00,
+    0x72, 0xC4, 0x95, 0x2E, 0x54, 0x04, 0x2B, 0x3F, 0x2A, 0x18, 0xEA, 0x4A, 0x2D, 0xA3, 0xC5, 0x09,
+    0xDD, 0xB8, 0x14, 0x9E, 0x31, 0x31, 0x3F, 0x24, 0xBA, 0x98, 0x50, 0x95, 0x70, 0x02, 0x10, 0x32,
+    0x7D, 0xB8, 0xA3, 0x69, 0x3C, 0x93, 0xBB, 0xC7, 0xAF, 0xB4, 0xF2, 0x39, 0xEC, 0xDB, 0x85, 0x4C,
+    0x6B, 0x11, 0x16, 0x4E, 0x1B, 0x27, 0x7E, 0x1D, 0x3F, 0x9F, 0x67, 0x29, 0xDC, 0x7B, 0x17, 0xF2,
+    0x44, 0x76, 0x57, 0x29, 0x58, 0xAF, 0xDE, 0x15, 0x4E, 0xC3, 0x6F, 0x2A, 0xD7, 0x71, 0x16, 0x54,
+    0xC2, 0x4A, 0x19, 0x5D, 0x60, 0x47, 0x47, 0x3E, 0x4E, 0xE0, 0x9A, 0x71, 0xAB, 0xA0, 0x76, 0x92,
+    0x69, 0xE4, 0x5C, 0xB8, 0xCC, 0x81, 0xE0, 0xBB, 0x4D, 0xB7, 0x03, 0x56, 0x7D, 0x1A, 0x2F, 0x97,
+    0x2D, 0x2A, 0x8B, 0x13, 0xC2, 0x6A, 0xA1, 0xA1, 0x6E, 0x9E, 0x84, 0xBE, 0xFE, 0x53, 0xAE, 0xAD,
+    0x7C, 0xF4, 0x89, 0x59, 0x33, 0x02, 0xF2, 0x7C, 0xF4, 0x4A, 0x6A, 0x84, 0xDB, 0x3A, 0xCE, 0xFC,
+    0xFE, 0x9A, 0x48, 0xD6, 0x57, 0xFA, 0x42, 0x66, 0x9B, 0x63, 0xB6, 0x71, 0x11, 0x80, 0x42, 0xB2,
+    0x3C, 0x42, 0xAB, 0x91, 0x38, 0xBB, 0xF8, 0x2E, 0x05, 0x2D, 0x55, 0x09, 0xD5, 0xCA, 0xAE, 0x71,
+    0xE7, 0x26, 0xD5, 0x14, 0x8F, 0x80, 0xEB, 0x0E, 0x24, 0x38, 0x5F, 0x25, 0x93, 0xEC, 0xC0, 0x57,
+    0x6A, 0xD3, 0x7A, 0x8D, 0x57, 0xBB, 0xAD, 0x2F, 0x42, 0x27, 0x14, 0xDB, 0x34, 0x4E, 0x84, 0x0C,
+    0xC2, 0x5C, 0xE9, 0xF3, 0xB2, 0xB8, 0xF2, 0x8D, 0xFE, 0xB9, 0x31, 0xF4, 0xCF, 0x71, 0x0A, 0x00,
+    0xCD, 0xE2, 0xD2, 0xCF, 0x64, 0xEB, 0xC9, 0x1D, 0x9B, 0x69, 0xD4, 0x37, 0x41, 0xF2, 0xC9, 0x4B,
+    0x26, 0x12, 0x0B, 0xBE, 0x15, 0x63, 0x65, 0xB1, 0xEB, 0x15, 0x0B, 0xB9, 0x7D, 0x1D, 0x7B, 0x32,
+    0x94, 0x76, 0x46, 0xD7, 0x9F, 0xD3, 0x04, 0xD9, 0x27, 0xE5, 0xEC, 0xCE, 0x43, 0x4E, 0x55, 0xFE,
+    0x6A, 0xA6, 0x67, 0xB5, 0xD2, 0x4D, 0x7A, 0x6D, 0x8F, 0xE7, 0x6D, 0xBF, 0xBC, 0x85, 0xF3, 0x4E,
+    0x50, 0x68, 0x0C, 0x9E, 0xE7, 0x5F, 0x74, 0xE6, 0x61, 0xB6, 0x0B, 0x67, 0x6A, 0x1D, 0x66, 0xB9,
+    0xB9, 0xBC, 0x33, 0x2B, 0xA2, 0x24, 0x7E, 0xB6, 0x4C, 0xC5, 0x08, 0x82, 0x67, 0x24, 0x5A, 0x80,
+    0xA7, 0x45, 0x96, 0x25, 0x2B, 0xE2, 0x28, 0x71, 0xBA, 0xCD, 0xCA, 0xAB, 0xE1, 0x81, 0x15, 0xE1,
+    0x52, 0x8C, 0x4B, 0x59, 0xA9, 0xDA, 0x96, 0xB9, 0x3C, 0x3D, 0xB8, 0x06, 0x7C, 0x2A, 0xFF, 0xD3,
+    0xF2, 0xBB, 0x23, 0x0B, 0x7B, 0x0B, 0xCC, 0xF8, 0xE5, 0x5E, 0x36, 0xBA, 0x7C, 0xE5, 0x82, 0x8C,
+    0x52, 0xB6, 0x59, 0x11, 0x41, 0x46, 0x23, 0x48, 0x91, 0x21, 0x46, 0x01, 0xC6, 0x88, 0x19, 0xA7,
+    0xD0, 0x24, 0x0F, 0x1F, 0x49, 0x1E, 0x3E, 0x7C, 0x6C, 0x01, 0xEC, 0x87, 0xA0, 0x70, 0xEC, 0xC7,
+    0x23, 0x00, 0xEB, 0x28, 0x39, 0x2E, 0x1F, 0x4F, 0x7E, 0x55, 0xAE, 0x5E, 0xFE, 0xDE, 0xFC, 0xF1,
+    0xB0, 0xFF, 0x43, 0xB1, 0x71, 0x3B, 0x23, 0x02, 0x3B, 0x19, 0x43, 0x48, 0x6E, 0xE1, 0xC2, 0xB0,
+    0xF1, 0x21, 0xD6, 0xE0, 0x67, 0x07, 0x3E, 0x74, 0x76, 0xA7, 0x33, 0x7A, 0x9F, 0x87, 0x11, 0xCB,
+    0x3A, 0xCE, 0xB1, 0x98, 0x95, 0x4B, 0x86, 0x6A, 0x10, 0x15, 0x98, 0x23, 0x14, 0x50, 0x07, 0xB0,
+    0xE0, 0xCF, 0x60, 0x17, 0xDC, 0xB0, 0x66, 0x4B, 0xF0, 0x16, 0x1D, 0x33, 0x04, 0xD9, 0xD8, 0x13,
+    0xF0, 0x0E, 0xD1, 0x55, 0x17, 0x43, 0x03, 0xC5, 0xEA, 0x95, 0xF6, 0x3A, 0x24, 0xAD, 0x88, 0xED,
+    0xEB, 0x12, 0x7A, 0xBB, 0x39, 0x17, 0xFB, 0x14, 0x05, 0xDF, 0x49, 0x6E, 0x85, 0xD3, 0x54, 0x94,
+    0xEB, 0x14, 0x77, 0x5B, 0x0E, 0x76, 0xC8, 0x75, 0x17, 0x5C, 0x5B, 0x63, 0xA1, 0x9C, 0x0A, 0x47,
+    0xB7, 0x24, 0x6E, 0xC3, 0x7E, 0x30, 0x7E, 0x86, 0x85, 0x0A, 0x29, 0x6A, 0xB7, 0x71, 0x7C, 0x9A,
+    0xE0, 0x3A, 0x45, 0x4A, 0x55, 0x21, 0x66, 0xDE, 0xAC, 0x23, 0x39, 0x37, 0xC0, 0xFC, 0x05, 0x79,
+    0xD8, 0xCD, 0x4B, 0x75, 0x12, 0xC2, 0x33, 0x40, 0x08, 0x20, 0xA2, 0x88, 0x08, 0xA0, 0x36, 0x6B,
+    0xD6, 0x01, 0xFA, 0x6F, 0xF1, 0xDC, 0x7F, 0x5D, 0xD3, 0x63, 0x66, 0xFE, 0x7B, 0xED, 0xFE, 0x6F,
+    0x48, 0xAE, 0x1F, 0xCF, 0x67, 0x9F, 0xC7, 0x18, 0xBE, 0xDB, 0x04, 0x60, 0x18, 0xB7, 0x68, 0xCE,
+    0xE0, 0xD9, 0x5E, 0xD1, 0x9E, 0x25, 0x52, 0x4C, 0xDA, 0x1A, 0xA3, 0x08, 0xCD, 0x6E, 0xA9, 0xA3,
+    0xC9, 0xB3, 0x90, 0xE3, 0xA1, 0x4C, 0x95, 0x11, 0x9D, 0x93, 0x31, 0x25, 0x32, 0xA6, 0x75, 0xE3,
+    0x2F, 0xEC, 0x22, 0x27, 0xE3, 0x12, 0x06, 0x05, 0x54, 0x3E, 0x25, 0x72, 0xE6, 0x62, 0x4D, 0xB8,
+    0x84, 0x5E, 0xAD, 0x7B, 0x78, 0x17, 0xE0, 0x40, 0x96, 0x70, 0xEF, 0x6A, 0x3B, 0x5D, 0xC7, 0xE9,
+    0xC7, 0x49, 0xDE, 0xE6, 0x71, 0x91, 0x8C, 0x7D, 0x2D, 0x34, 0xB6, 0xC1, 0xE3, 0xE5, 0x4E, 0x37,
+    0xF1, 0x1F, 0x13, 0x11, 0xE7, 0x1A, 0x4B, 0x63, 0x66, 0x01, 0x61, 0x2C, 0xC5, 0x6D, 0x6C, 0x06,
+    0x71, 0x4B, 0xD8, 0xD6, 0x59, 0x89, 0x92, 0xAB, 0x44, 0xD9, 0xA5, 0x9A, 0x1E, 0xBF, 0x28, 0x02,
+    0x32, 0xD1, 0xAD, 0xBF, 0xDC, 0xFB, 0x71, 0xEB, 0xB7, 0xE6, 0x99, 0x36, 0x16, 0x99, 0xD0, 0xD6,
+    0x69, 0xE2, 0xEE, 0xC9, 0xFA, 0x8B, 0xE5, 0x29, 0x03, 0x6B, 0x39, 0x30, 0xE5, 0xC7, 0x6D, 0xE5,
+    0xC7, 0x60, 0x1F, 0x3F, 0x66, 0x0E, 0xE7, 0x01, 0x1D, 0x83, 0xC9, 0x08, 0xA7, 0x2D, 0xE7, 0x51,
+    0x2C, 0xE7, 0x21, 0x06, 0x6D, 0x9F, 0xB9, 0xF9, 0x37, 0xA1, 0x88, 0xFF, 0x33, 0xB8, 0xF7, 0x06,
+    0xF8, 0xB8, 0xC2, 0xF7, 0x0A, 0xD7, 0xAA, 0xAA, 0x14, 0x6C, 0xBA, 0x8B, 0x07, 0x5A, 0xD0, 0x33,
+    0x43, 0xEC, 0xC2, 0xAF, 0x1C, 0xA8, 0x63, 0x92, 0x0B, 0xA9, 0x17, 0x32, 0x15, 0x18, 0x07, 0xDD,
+    0x0B, 0x35, 0x30, 0x6D, 0x26, 0x1B, 0x64, 0xE3, 0xF0, 0x84, 0x20, 0xCD, 0x0A, 0xBA, 0xAD, 0x7B,
+    0x6D, 0x45, 0xBD, 0x34, 0xA6, 0x75, 0x45, 0xB4, 0x89, 0x40, 0x2A, 0xCD, 0x5C, 0xBE, 0x90, 0x30,
+    0x5D, 0xCA, 0x1C, 0x48, 0x97, 0x5A, 0xCA, 0x4D, 0x23, 0x72, 0xB3, 0x10, 0xB9, 0xD9, 0x1D, 0x90,
+    0x9B, 0x4A, 0x3D, 0xD1, 0xA4, 0x20, 0xA0, 0x07, 0xED, 0x29, 0x34, 0xFC, 0xE7, 0x32, 0x72, 0x90,
+    0x71, 0xCB, 0x43, 0x7C, 0xC4, 0xC4, 0xE0, 0x7D, 0x10, 0xB3, 0xF0, 0x18, 0x93, 0x83, 0x98, 0x1E,
+    0xB7, 0xF8, 0xB0, 0xCB, 0x07, 0xC2, 0x5A, 0xDA, 0x0E, 0xDB, 0x7D, 0xA0, 0xB0, 0x12, 0x39, 0x4A,
+    0x2C, 0xBF, 0x24, 0x56, 0x52, 0xBC, 0xAC, 0xE7, 0xA8, 0x97, 0xF5, 0x91, 0x73, 0x60, 0x43, 0xDE,
+    0x83, 0xF0, 0xF4, 0x04, 0x1D, 0x36, 0x6E, 0xCF, 0x95, 0xCC, 0xE8, 0x11, 0x11, 0xD9, 0x2E, 0x37,
+    0xBF, 0x84, 0xC7, 0xED, 0xE0, 0xD9, 0x34, 0xA1, 0x80, 0xD3, 0x1C, 0x58, 0xB4, 0x08, 0x9B, 0x36,
+    0x30, 0x3F, 0x5A, 0xF8, 0x76, 0x5A, 0xB8, 0x76, 0x6E, 0xC1, 0x6E, 0xDE, 0xBE, 0x38, 0x24, 0xB9,
+    0x45, 0xD6, 0xE1, 0x6D, 0xB3, 0x09, 0x4F, 0x0F, 0x69, 0x1C, 0x44, 0x08, 0x20, 0xFE, 0x3F, 0xA3,
+    0x9B, 0xB3, 0x1D, 0x3E, 0x3F, 0x52, 0xEA, 0x77, 0x19, 0x60, 0xA3, 0x1A, 0x0B, 0x0A, 0x6E, 0xDA,
+    0x64, 0x3E, 0xC6, 0xF3, 0xB6, 0x79, 0xBC, 0x35, 0xE6, 0xAE, 0xFA, 0xDD, 0x02, 0x00, 0xF8, 0x85,
+    0xFE, 0x8D, 0xDA, 0x15, 0x4C, 0xE9, 0xCD, 0x67, 0xB5, 0x3B, 0x77, 0x1B, 0xC4, 0xC7, 0x1D, 0x68,
+    0x3A, 0x39, 0xC6, 0xD9, 0xAC, 0x22, 0x30, 0x90, 0x63, 0x4A, 0xD8, 0x9D, 0x93, 0x4D, 0x3A, 0x39,
+    0x7A, 0x73, 0x01, 0x08, 0x82, 0xAD, 0xC4, 0x64, 0x11, 0xE0, 0xB0, 0x4B, 0x7C, 0x24, 0x88, 0x17,
+    0x3B, 0x46, 0xEC, 0x26, 0x41, 0x2D, 0xAF, 0xF7, 0xFF, 0x5E, 0x38, 0xAB, 0x23, 0x02, 0xDD, 0x68,
+    0x9F, 0x18, 0x53, 0x66, 0x1D, 0xF5, 0x4E, 0x61, 0x60, 0xA7, 0x89, 0xEE, 0x2F, 0xCD, 0xC0, 0x59,
+    0xDB, 0x21, 0x19, 0x6A, 0x31, 0x21, 0x6D, 0xCA, 0x1C, 0x43, 0x51, 0x49, 0xF7, 0x20, 0x49, 0x7D,
+    0x7A, 0xB1, 0x03, 0xFA, 0xE4, 0xE8, 0x77, 0x68, 0xB7, 0x98, 0x7F, 0x56, 0xDB, 0x8F, 0x8E, 0x86,
+    0xBF, 0x3A, 0x6D, 0x72, 0x86, 0x7B, 0xFF, 0x06, 0xF4, 0x99, 0x7D, 0x93, 0x84, 0x23, 0x1C, 0x3C,
+    0xE7, 0xAA, 0xF1, 0x2B, 0xCF, 0x39, 0x51, 0x1B, 0x41, 0x2E, 0x22, 0x71, 0xD2, 0xF2, 0x61, 0xAB,
+    0x8A, 0xA7, 0x46, 0x55, 0x71, 0x5D, 0x84, 0xD8, 0xE3, 0x0C, 0x6C, 0x94, 0x76, 0x65, 0x5D, 0x40,
+    0xCE, 0x60, 0xF0, 0xDC, 0x20, 0xBC, 0x2B, 0x0A, 0x5B, 0xC6, 0x8B, 0xA7, 0x5D, 0xE3, 0x83, 0x20,
+    0xD0, 0x66, 0x95, 0x7A, 0x46, 0x28, 0xAF, 0xF9, 0x34, 0xBB, 0x43, 0x41, 0x79, 0xD1, 0x78, 0x9B,
+    0xD8, 0x9A, 0x6F, 0xC9, 0xBC, 0xAE, 0xFE, 0x7A, 0x35, 0x18, 0xBB, 0xCB, 0x1D, 0x1A, 0x94, 0x08,
+    0x71, 0x31, 0xEE, 0x45, 0x98, 0xB0, 0xA1, 0x13, 0x34, 0x2D, 0xA7, 0xE8, 0x34, 0x9E, 0x0A, 0x46,
+    0x3B, 0x4D, 0x3B, 0x51, 0x3B, 0x55, 0xCA, 0xA1, 0x59, 0x65, 0xA7, 0x6B, 0x27, 0x6C, 0xA7, 0xCC,
+    0x49, 0x47, 0x05, 0xA7, 0x1D, 0x67, 0x32, 0x71, 0x01, 0x5E, 0x49, 0x94, 0x04, 0x73, 0x18, 0x5F,
+    0xC9, 0xAF, 0xCD, 0x3D, 0x59, 0xF7, 0x97, 0xBF, 0xDF, 0x9C, 0x8A, 0x93, 0xB0, 0x7F, 0xB9, 0x6F,
+    0xE2, 0x4E, 0x48, 0x90, 0x97, 0xB2, 0x63, 0xA0, 0x2F, 0x9D, 0xC4, 0x0E, 0xC2, 0xD8, 0x51, 0x18,
+    0x3B, 0x0C, 0x33, 0x90, 0x7B, 0xA0, 0xF8, 0x40, 0x74, 0x3B, 0x94, 0x91, 0xF4, 0xFE, 0x61, 0xFB,
+    0x17, 0x4E, 0x7D, 0x1D, 0x8F, 0xB1, 0x03, 0x32, 0x76, 0x44, 0xC3, 0x90, 0xEC, 0x98, 0x3E, 0x6D,
+    0x74, 0x50, 0xBD, 0xD1, 0x51, 0xF5, 0x46, 0x87, 0x75, 0xDC, 0xEE, 0x9E, 0xD3, 0x16, 0x57, 0x58,
+    0x49, 0x16, 0xCF, 0xAD, 0xEF, 0x4B, 0xFD, 0x08, 0xCE, 0x3D, 0xFB, 0xE7, 0x72, 0xB9, 0xFD, 0x23,
+    0x61, 0x6E, 0x41, 0x64, 0xE5, 0x39, 0x19, 0xEE, 0x45, 0x99, 0xCF, 0x75, 0x2C, 0x43, 0x44, 0x7F,
+    0x20, 0xA3, 0xC4, 0x70, 0x08, 0x20, 0xB3, 0x15, 0x6B, 0x26, 0x4C, 0xD5, 0x40, 0xBE, 0xC8, 0x44,
+    0x1B, 0x48, 0xD9, 0xA0, 0xF0, 0x6B, 0xFF, 0xDE, 0x66, 0xE1, 0xC0, 0x90, 0x11, 0xC3, 0x10, 0xDB,
+    0x39, 0x6D, 0x90, 0x4F, 0xB3, 0xD9, 0x68, 0x0A, 0xAA, 0xE2, 0x2F, 0xBA, 0x63, 0xB0, 0x28, 0x42,
+    0x08, 0x28, 0x56, 0x59, 0x12, 0xB9, 0x73, 0x50, 0x06, 0x7A, 0x6F, 0xB9, 0x7B, 0x88, 0xF5, 0x98,
+    0x8B, 0xBA, 0xC2, 0x13, 0x12, 0x3C, 0x03, 0xBB, 0x50, 0x90, 0x2A, 0xE8, 0x32, 0xC7, 0xBE, 0x14,
+    0x60, 0x6F, 0x66, 0xF2, 0xAC, 0xB8, 0xC3, 0xD3, 0xC2, 0x06, 0xCF, 0xE3, 0x6A, 0x60, 0x25, 0x68,
+    0xD7, 0x61, 0x3B, 0xAE, 0x24, 0xBD, 0xCA, 0x33, 0x7C, 0x3E, 0xC1, 0xC7, 0xE8, 0x9B, 0xB0, 0x00,
+    0xFA, 0x1D, 0x7E, 0x65, 0xF4, 0x72, 0x4F, 0xDC, 0xD1, 0x00, 0xA1, 0x0C, 0x66, 0x6D, 0x24, 0x88,
+    0xB2, 0xDB, 0x2C, 0x15, 0x41, 0x8A, 0x44, 0xD1, 0xBC, 0xCC, 0xD6, 0xA2, 0xF8, 0xD6, 0x3C, 0xFD,
+    0xAA, 0x88, 0xC8, 0x5E, 0x1D, 0xA5, 0x7C, 0xDA, 0xAC, 0x16, 0x04, 0x59, 0xEE, 0xC8, 0x38, 0x6F,
+    0xC1, 0x7E, 0x79, 0x5E, 0xB6, 0x1E, 0xA8, 0xFD, 0xDC, 0x14, 0xC1, 0xF9, 0xF2, 0x2F, 0x32, 0xCA,
+    0xF4, 0x15, 0xA4, 0x5C, 0x38, 0xD8, 0xB8, 0xAE, 0xE0, 0x71, 0x02, 0x78, 0x1A, 0x64, 0x02, 0x71,
+    0x0B, 0x72, 0x0D, 0xE4, 0x35, 0xB1, 0x39, 0xD0, 0x54, 0x4F, 0xEB, 0x35, 0xD8, 0xD3, 0x13, 0x92,
+    0x87, 0x76, 0xF5, 0x04, 0xBB, 0xAE, 0x83, 0xBE, 0x8E, 0xB2, 0x5D, 0xF2, 0x5B, 0xA2, 0x56, 0x80,
+    0x5C, 0xF0, 0x3E, 0xB4, 0x04, 0xB6, 0xAD, 0x2D, 0xA0, 0x36, 0xC9, 0x10, 0xF5, 0xEF, 0xAF, 0xC0,
+    0x96, 0xAF, 0xD5, 0xA2, 0xCC, 0xC1, 0x97, 0xDD, 0xC8, 0x91, 0x1D, 0x93, 0x24, 0xE9, 0xF1, 0xBA,
+    0xB3, 0x99, 0x19, 0x26, 0x77, 0x7A, 0xF7, 0x90, 0x28, 0x8A, 0x01, 0x85, 0xC5, 0xB6, 0x35, 0x44,
+    0x72, 0x05, 0x0B, 0xBB, 0x47, 0x9E, 0x11, 0x35, 0xDB, 0x8A, 0xF4, 0x8E, 0xEB, 0xA3, 0x14, 0xE0,
+    0xC7, 0x2E, 0x2B, 0xF1, 0x29, 0x1D, 0x77, 0x34, 0xF3, 0xC4, 0x3C, 0xB6, 0x54, 0x81, 0x0F, 0xD3,
+    0x1A, 0xF1, 0x93, 0x2D, 0x19, 0xD2, 0x82, 0xBF, 0x41, 0x72, 0x73, 0x25, 0xCE, 0xFE, 0x10, 0x9F,
+    0xE3, 0x20, 0xC7, 0x64, 0xD6, 0x8F, 0x31, 0x1D, 0x20, 0x80, 0xA3, 0xE9, 0x85, 0x0D, 0xF8, 0x03,
+    0x2A, 0x6B, 0xD4, 0x51, 0x1D, 0x2D, 0x10, 0xAB, 0x69, 0x43, 0xB8, 0xF7, 0x76, 0x45, 0x99, 0xDE,
+    0x2B, 0x05, 0xDD, 0xBC, 0x25, 0x96, 0x0A, 0x72, 0x36, 0xA8, 0xD3, 0x2D, 0x36, 0xAA, 0xF7, 0x61,
+    0x23, 0xB3, 0xC4, 0x46, 0x53, 0x48, 0xB8, 0x84, 0x52, 0x2B, 0x22, 0x71, 0x99, 0xC5, 0x3C, 0xA4,
+    0x2D, 0x7F, 0x9C, 0x5E, 0x32, 0xDD, 0xCF, 0x5F, 0xD3, 0x8D, 0x0F, 0xDE, 0x47, 0xC8, 0x00, 0x0E,
+    0xEE, 0x8B, 0x2B, 0xB6, 0xD1, 0x43, 0x33, 0x71, 0xDF, 0x09, 0x46, 0xBA, 0xFA, 0x55, 0xFA, 0x53,
+    0xDE, 0x31, 0x46, 0x52, 0xDB, 0xAD, 0x84, 0x9C, 0x90, 0x9D, 0x87, 0x5F, 0x08, 0x6E, 0x7A, 0xA5,
+    0x3C, 0xA8, 0x1B, 0x3C, 0x1B, 0xAA, 0xD5, 0xD5, 0x28, 0xE9, 0xE3, 0x42, 0xB7, 0x1B, 0x32, 0x4F,
+    0xD9, 0x6F, 0xC9, 0x0E, 0x78, 0xFF, 0xCB, 0xAD, 0x86, 0xC8, 0x9F, 0xD3, 0x3C, 0xA3, 0x98, 0x46,
+    0x48, 0xCA, 0xD4, 0x9F, 0xC9, 0x56, 0x8C, 0x5A, 0xEB, 0x18, 0x56, 0x2F, 0xB1, 0xBA, 0x81, 0x01,
+    0xAB, 0x0A, 0xEB, 0xFB, 0x05, 0x84, 0x4A, 0x08, 0x9C, 0x5E, 0x06, 0x5C, 0x12, 0xB9, 0xEF, 0x40,
+    0xD0, 0x6C, 0xF8, 0xDF, 0x6B, 0x82, 0x9F, 0xB4, 0xC1, 0xF7, 0x9B, 0xD9, 0xCB, 0xD5, 0xCF, 0x7E,
+    0x43, 0x8D, 0x5B, 0x05, 0xEA, 0xC6, 0xE2, 0xAF, 0xBF, 0x9A, 0xC1, 0x0B, 0xC9, 0xFE, 0x58, 0x6F,
+    0x69, 0xB6, 0x6B, 0xB9, 0xCC, 0x8A, 0x22, 0x67, 0x22, 0x7E, 0x54, 0xB4, 0xAA, 0x81, 0xEB, 0xDB,
+    0x0C, 0xFF, 0xC0, 0x66, 0xF8, 0x03, 0x8D, 0x44, 0x76, 0x39, 0x62, 0x8B, 0x9E, 0x5A, 0xDD, 0x9E,
+    0xBF, 0x57, 0xD9, 0xF8, 0xA4, 0xAB, 0xC6, 0xB8, 0x98, 0x69, 0x0B, 0x4D, 0xD8, 0x6A, 0x35, 0x5F,
+    0x8B, 0xA7, 0xD3, 0x1A, 0x3F, 0x5C, 0xD7, 0x00, 0xE2, 0x96, 0xFA, 0x89, 0xAF, 0x7B, 0xFD, 0x1E,
+    0xF2, 0xCA, 0x3D, 0x44, 0x33, 0x1C, 0x91, 0xE7, 0xA2, 0xAF, 0xB0, 0x54, 0xCC, 0xA3, 0x23, 0x6B,
+    0xCB, 0xE2, 0xE2, 0x14, 0x2A, 0xA3, 0x8B, 0xCD, 0x26, 0x7F, 0x7B, 0x1A, 0x30, 0xDD, 0x9B, 0x8B,
+    0x8D, 0xE4, 0x2D, 0x5E, 0xAC, 0x10, 0x9D, 0xCB, 0x7B, 0x56, 0xEC, 0x38, 0x34, 0x90, 0x38, 0xD4,
+    0x96, 0xBC, 0x4D, 0x98, 0xCF, 0x09, 0xC6, 0x8A, 0xB1, 0x6C, 0x00, 0x69, 0x5B, 0x4F, 0xB7, 0x18,
+    0xFD, 0xBA, 0xD0, 0x5D, 0xA0, 0x37, 0x95, 0x95, 0x35, 0x77, 0x9E, 0x5F, 0x3C, 0xDF, 0x29, 0xB2,
+    0x48, 0xF5, 0x24, 0x82, 0x90, 0xFB, 0x29, 0xA3, 0x2D, 0x10, 0x0B, 0x53, 0xF2, 0x76, 0x31, 0xE5,
+    0x16, 0x59, 0xE3, 0x37, 0x5B, 0xDC, 0x30, 0xB4, 0x8A, 0xF1, 0xB9, 0x9F, 0xC3, 0x4E, 0x7F, 0xC7,
+    0x56, 0xD0, 0xD7, 0x46, 0x87, 0x6C, 0x35, 0x64, 0xA1, 0x12, 0x2B, 0x5E, 0x59, 0x49, 0x06, 0x7E,
+    0xFF, 0x0C, 0x77, 0x88, 0x71, 0x0D, 0xAF, 0x29, 0xCC, 0x65, 0xC0, 0x91, 0xBB, 0xE8, 0x31, 0xF3,
+    0xF3, 0xF3, 0x4C, 0x8C, 0x29, 0xDF, 0xBF, 0x02, 0xA6, 0xBD, 0x2E, 0x02, 0x04, 0x81, 0x8F, 0x1C,
+    0x5B, 0xE2, 0xC4, 0xED, 0xC9, 0x30, 0x1E, 0x11, 0xD3, 0xE5, 0x7D, 0xA2, 0xC6, 0xE3, 0xA0, 0xC6,
+    0xA7, 0x8E, 0x30, 0x19, 0xD4, 0x1A, 0x1C, 0x9A, 0x13, 0x55, 0x0C, 0x11, 0xCC, 0xB3, 0x38, 0x3C,
+    0x35, 0x21, 0x88, 0xCF, 0xBC, 0x88, 0x98, 0x40, 0xB5, 0x12, 0xB6, 0x7A, 0x9D, 0x18, 0x3C, 0x2D,
+    0xAC, 0xDF, 0xBB, 0x34, 0x0C, 0x61, 0x53, 0xD5, 0xEB, 0x99, 0x63, 0x1C, 0xCF, 0xB4, 0x18, 0xE7,
+    0x98, 0x3A, 0x2D, 0xC8, 0xF3, 0xF6, 0xBC, 0x8E, 0xF3, 0x8C, 0xB9, 0x8E, 0xC2, 0x34, 0x0D, 0x82,
+    0xFC, 0x51, 0x12, 0x37, 0x2E, 0xFD, 0x6A, 0xFF, 0xAA, 0xF1, 0x58, 0x50, 0xF4, 0xE3, 0x26, 0x00,
+    0xA2, 0xFC, 0xFC, 0xD7, 0x49, 0xD6, 0xE8, 0x0B, 0xCF, 0xB6, 0xEB, 0x4C, 0x3F, 0x73, 0x5A, 0x3A,
+    0xB3, 0x77, 0x9C, 0x8E, 0xF5, 0x4F, 0x73, 0x87, 0xAE, 0x8B, 0xB0, 0x76, 0x6C, 0xD2, 0x97, 0x8A,
+    0x99, 0x50, 0xC3, 0xDE, 0x83, 0x3A, 0x50, 0x85, 0x28, 0x0A, 0x0B, 0xFB, 0xD8, 0xAF, 0x1D, 0x92,
+    0xB5, 0x36, 0x62, 0x3D, 0xE0, 0x2F, 0x32, 0x39, 0x7C, 0xBC, 0x45, 0x8E, 0x56, 0x03, 0x38, 0x8E,
+    0x82, 0x88, 0x1D, 0x6C, 0x14, 0xB8, 0x25, 0x2F, 0xC9, 0xC9, 0x59, 0xC8, 0xCA, 0x0B, 0x06, 0x58,
+    0xC8, 0xB2, 0x9B, 0x9D, 0x60, 0x1B, 0x43, 0xDC, 0x39, 0x7D, 0x1E, 0x23, 0xBC, 0x75, 0xF1, 0x3C,
+    0xF8, 0x79, 0xBB, 0x8A, 0x6F, 0xD2, 0xEE, 0xE2, 0x32, 0xA6, 0x6A, 0x7A, 0x9D, 0x53, 0xB2, 0x32,
+    0xB6, 0x63, 0x9E, 0x61, 0xB8, 0xC5, 0xE9, 0x96, 0xC5, 0x92, 0x1A, 0xA7, 0x62, 0x5E, 0x71, 0xF8,
+    0x6A, 0x77, 0x2D, 0x33, 0x67, 0xC4, 0xE8, 0xCC, 0xCC, 0x59, 0x51, 0x5B, 0xC9, 0x98, 0x57, 0x51,
+    0xD9, 0xF4, 0xDE, 0x49, 0xF6, 0xB2, 0xAB, 0x11, 0x72, 0xCD, 0xA6, 0xD6, 0xB8, 0x59, 0x6E, 0x6C,
+    0xF0, 0x30, 0x65, 0xA0, 0x22, 0x27, 0xC4, 0xEC, 0x20, 0xFF, 0x64, 0xE8, 0x61, 0x6D, 0x4E, 0x74,
+    0xAF, 0xC2, 0xB8, 0x65, 0x1C, 0x6F, 0xEA, 0x44, 0x30, 0xEA, 0x84, 0x81, 0xA4, 0x64, 0xFA, 0x1F,
+    0x1D, 0x31, 0xD4, 0x8B, 0x0C, 0xB9, 0xB7, 0x43, 0xC4, 0x21, 0xD6, 0x6D, 0xBC, 0xFD, 0x24, 0x47,
+    0x04, 0xC4, 0x23, 0x8B, 0xDF, 0x3D, 0x6F, 0xD9, 0x2F, 0xD7, 0x13, 0x24, 0xA5, 0x03, 0x79, 0x14,
+    0xE9, 0x29, 0x4E, 0xE8, 0x07, 0x8A, 0xD5, 0xCB, 0x8C, 0xA8, 0xE6, 0x1F, 0x5B, 0x49, 0x59, 0x4D,
+    0x83, 0x22, 0xCB, 0xE8, 0xCF, 0x31, 0xE8, 0x70, 0xD0, 0x29, 0x7E, 0x5D, 0x13, 0xF2, 0x64, 0xF0,
+    0x10, 0xA0, 0xAD, 0x8D, 0x84, 0xA8, 0x77, 0x22, 0x62, 0xCA, 0x95, 0x8C, 0xEF, 0x0C, 0x87, 0xA6,
+    0x39, 0x37, 0xDE, 0xDC, 0xB1, 0xD5, 0x4F, 0xB5, 0x35, 0x58, 0x44, 0x45, 0xA8, 0x67, 0xC2, 0x7F,
+    0xF3, 0x85, 0x7B, 0x48, 0xF5, 0xD5, 0xF4, 0x17, 0xB2, 0xFD, 0x9D, 0x17, 0x99, 0xFC, 0x2B, 0x77,
+    0x0B, 0x6A, 0x5B, 0x0E, 0x63, 0x33, 0xF6, 0xA3, 0xCC, 0x5E, 0x50, 0x9C, 0xA9, 0x9F, 0xDD, 0x5E,
+    0xA4, 0x36, 0xC9, 0x05, 0x4C, 0x3F, 0x87, 0xAD, 0xA4, 0xE9, 0xE1, 0x6E, 0xC1, 0x45, 0xED, 0x65,
+    0xF2, 0x8C, 0xFE, 0xA4, 0xC0, 0xDA, 0x4C, 0x1F, 0xEC, 0x07, 0x16, 0x7C, 0x72, 0x45, 0xD2, 0x99,
+    0xBC, 0x11, 0xAA, 0x1B, 0xFF, 0xEF, 0x7A, 0xD5, 0x4F, 0x69, 0x42, 0x1F, 0x14, 0xC4, 0x38, 0x53,
+    0x81, 0xBD, 0xDA, 0x46, 0xFA, 0x34, 0xD6, 0x57, 0x91, 0x05, 0xA8, 0x9F, 0x04, 0x06, 0xDC, 0xBD,
+    0xC6, 0x53, 0x61, 0x31, 0x9C, 0xFA, 0x9F, 0x32, 0x0B, 0xE6, 0x34, 0xBF, 0x36, 0x91, 0x2F, 0x3C,
+    0xC5, 0x9D, 0xE7, 0x40, 0x20, 0x33, 0x5A, 0x2A, 0x54, 0x4F, 0xBB, 0x15, 0x37, 0x8D, 0xC2, 0x5C,
+    0x5B, 0x20, 0xE6, 0xD9, 0x82, 0x31, 0x25, 0xE1, 0x29, 0x75, 0x8A, 0xAC, 0xAB, 0x87, 0x64, 0x4B,
+    0x53, 0x9B, 0xD4, 0xDF, 0xEE, 0x96, 0x5A, 0x79, 0x55, 0x30, 0xF0, 0x10, 0x5C, 0xA0, 0x7A, 0x0B,
+    0x35, 0x93, 0xF5, 0x5C, 0xBE, 0x89, 0x61, 0xDC, 0xD8, 0xE6, 0x68, 0xEA, 0x5B, 0x38, 0x79, 0x25,
+    0xC0, 0x9C, 0x99, 0x65, 0x2D, 0x33, 0xD7, 0x9C, 0x16, 0x93, 0x59, 0x73, 0x1B, 0x30, 0xF7, 0x3A,
+    0x5C, 0x2C, 0xC8, 0x75, 0xAE, 0x67, 0xD4, 0x37, 0xB5, 0x88, 0x84, 0x13, 0x8B, 0x59, 0xB5, 0x89,
+    0xB2, 0x52, 0xBF, 0xEA, 0xC7, 0x38, 0x28, 0xFD, 0xAF, 0x1E, 0x23, 0xB2, 0xD8, 0x4F, 0x27, 0x31,
+    0x84, 0xB3, 0x30, 0x2B, 0xAF, 0x8B, 0x64, 0x75, 0xCA, 0x90, 0xF6, 0x45, 0x61, 0xFC, 0xFC, 0x5A,
+    0x61, 0x4E, 0x45, 0xF2, 0xD8, 0xF5, 0x58, 0x44, 0xE3, 0x8D, 0x58, 0x74, 0x5E, 0x75, 0x5E, 0xD8,
+    0xA0, 0x78, 0xC9, 0x13, 0x08, 0xB8, 0x23, 0x36, 0x61, 0x29, 0xBA, 0x36, 0x2F, 0xC5, 0x0E, 0xD7,
+    0x3D, 0x19, 0x24, 0x76, 0x5B, 0x72, 0xB7, 0x76, 0x83, 0xDF, 0x04, 0xCF, 0xEC, 0x6D, 0x26, 0x8A,
+    0xFB, 0xB7, 0x85, 0x05, 0x48, 0x5F, 0xB4, 0x59, 0xB4, 0x01, 0xDD, 0xB8, 0xB2, 0x42, 0xA7, 0x7C,
+    0x8D, 0xFD, 0x9B, 0xF5, 0x99, 0x45, 0xBF, 0x37, 0xB0, 0x62, 0xC8, 0x20, 0x7C, 0xF3, 0x37, 0xC7,
+    0x2C, 0xF7, 0x39, 0x73, 0x08, 0x5F, 0xF8, 0xDB, 0x1F, 0x30, 0x8B, 0xCF, 0x04, 0xC1, 0x5F, 0x6A,
+    0x06, 0xE2, 0x5A, 0xF0, 0x75, 0x4D, 0x70, 0x59, 0xE7, 0x85, 0xD0, 0xF3, 0x46, 0x98, 0xB1, 0xB2,
+    0xCD, 0xA9, 0xA3, 0x64, 0xC1, 0xA4, 0x90, 0xC2, 0x7A, 0x55, 0xFD, 0x2C, 0xD6, 0x04, 0x80, 0x40,
+    0xFE, 0x35, 0x07, 0xBB, 0xC5, 0xC2, 0x30, 0xB9, 0xB0, 0xDB, 0x7F, 0xE8, 0x2F, 0xDF, 0x3A, 0xD6,
+    0x97, 0x79, 0xFF, 0xD3, 0x5E, 0x28, 0xDD, 0x57, 0x60, 0xAF, 0x6D, 0x6C, 0x6A, 0x8A, 0x01, 0x24,
+    0xC0, 0xBF, 0xC1, 0xE1, 0xCF, 0x36, 0x29, 0xF1, 0x8F, 0x87, 0x4C, 0xA5, 0x3B, 0x2D, 0x40, 0x40,
+    0x4E, 0x17, 0x85, 0x54, 0x42, 0x23, 0xF8, 0xA1, 0x7D, 0xAD, 0x1F, 0x10, 0xF6, 0x7A, 0xE3, 0x0D,
+    0xE0, 0xCD, 0x20, 0xF8, 0x02, 0x12, 0x18, 0x4E, 0x86, 0x9F, 0xA9, 0x85, 0xBD, 0xCE, 0x46, 0xF0,
+    0xF7, 0x65, 0xD7, 0x63, 0x68, 0xA1, 0x67, 0xAB, 0x18, 0xDB, 0xCF, 0x2B, 0xCE, 0x83, 0x7B, 0xC3,
+    0xEA, 0x25, 0xD1, 0xB3, 0xDB, 0x71, 0xBD, 0x13, 0xF6, 0x1A, 0x8F, 0x01, 0xF8, 0xB3, 0xF5, 0x8A,
+    0xF1, 0x97, 0x2F, 0x5C, 0xD0, 0xD9, 0x7A, 0x0A, 0x27, 0x7D, 0xCD, 0x38, 0x5E, 0xD3, 0x68, 0xF6,
+    0x4D, 0x32, 0xA0, 0xCB, 0xDD, 0xB5, 0xF0, 0x35, 0x49, 0x65, 0x6D, 0xDC, 0x25, 0xC6, 0xA2, 0x25,
+    0x93, 0xFF, 0xC9, 0x5F, 0xB3, 0x14, 0x95, 0xA0, 0xC3, 0x13, 0xC3, 0x60, 0x17, 0x66, 0x24, 0x03,
+    0x3A, 0x41, 0x19, 0xC1, 0x8A, 0x84, 0x43, 0x9A, 0xA1, 0xAD, 0x58, 0xAB, 0x37, 0x10, 0xFB, 0xB3,
+    0xE8, 0x4C, 0x56, 0x4C, 0xA8, 0x95, 0x6D, 0xD6, 0xB2, 0x35, 0xA3, 0xAA, 0xCF, 0x62, 0xD1, 0x84,
+    0x73, 0xEC, 0x09, 0xDA, 0xDD, 0x7A, 0x42, 0xEE, 0x07, 0x76, 0xDC, 0x4B, 0x48, 0xE6, 0xC5, 0x0A,
+    0x84, 0x5A, 0xB2, 0x73, 0x89, 0x7B, 0xE2, 0xDB, 0x9A, 0x1D, 0xF5, 0x53, 0xF5, 0xA2, 0x11, 0xDA,
+    0xCE, 0xEE, 0x2D, 0x90, 0x4D, 0x13, 0x08, 0xC9, 0xA9, 0xAB, 0x78, 0x4A, 0x9D, 0x06, 0x9C, 0xD1,
+    0x39, 0x73, 0xE1, 0x0B, 0xB7, 0x75, 0xE1, 0xA3, 0x98, 0xCD, 0xB9, 0x8B, 0xA3, 0x2A, 0xBC, 0xC7,
+    0x5C, 0xBF, 0x94, 0x59, 0x98, 0x9A, 0xB3, 0xAA, 0x95, 0x0B, 0xB7, 0x5D, 0xBD, 0x82, 0xB0, 0x5E,
+    0x5C, 0xB8, 0xF0, 0x42, 0x41, 0xF6, 0x5B, 0x10, 0x2F, 0x80, 0xFF, 0x52, 0x0C, 0x8B, 0x0C, 0x18,
+    0x53, 0xA5, 0x69, 0x32, 0xA8, 0x67, 0x59, 0x30, 0x28, 0x03, 0xAB, 0x29, 0x66, 0xF5, 0x39, 0x8B,
+    0xB4, 0xBC, 0x66, 0x6E, 0xF3, 0x58, 0x9F, 0x27, 0xF9, 0x94, 0x0D, 0xE9, 0x64, 0x13, 0x3E, 0x5C,
+    0xE4, 0x9B, 0x5A, 0xB7, 0x1B, 0x54, 0xBB, 0x10, 0x67, 0x08, 0x78, 0x17, 0xB7, 0xC0, 0xB7, 0xCC,
+    0x44, 0x69, 0x6D, 0x3E, 0x6C, 0x2E, 0xCA, 0x4E, 0xF3, 0xAD, 0x16, 0x4E, 0xA3, 0x29, 0x4A, 0x32,
+    0xA5, 0x46, 0x0B, 0x2D, 0xE1, 0x8A, 0xD1, 0xE0, 0x77, 0x20, 0xB3, 0xD3, 0x2C, 0xAF, 0xA8, 0xA0,
+    0xE0, 0x15, 0x8E, 0xCC, 0x93, 0xCD, 0x85, 0x41, 0x7A, 0xC1, 0x4F, 0xEF, 0xC9, 0x2C, 0x93, 0xCD,
+    0x22, 0x46, 0xA6, 0xBA, 0x58, 0x06, 0xCF, 0x70, 0xD6, 0x54, 0x4A, 0xCC, 0xEF, 0x93, 0x2F, 0x6E,
+    0x23, 0xBF, 0x59, 0xF8, 0x32, 0x02, 0x67, 0x00, 0x31, 0x64, 0x6B, 0x04, 0xE6, 0xB3, 0x72, 0x4E,
+    0xC8, 0xEA, 0xFD, 0xA4, 0xB4, 0xA2, 0x0F, 0xD5, 0x94, 0x77, 0x5F, 0xED, 0xFA, 0x1C, 0xF5, 0x8D,
+    0x41, 0x75, 0x8B, 0x26, 0x51, 0x54, 0x88, 0x41, 0x4E, 0x08, 0xDA, 0xCE, 0x10, 0x0F, 0xCE, 0x1D,
+    0x08, 0x96, 0xF8, 0xD9, 0xD6, 0x99, 0x03, 0x2A, 0x89, 0xC9, 0x4E, 0x5F, 0x5E, 0x58, 0x87, 0x0B,
+    0x07, 0x4C, 0x2A, 0xAB, 0x4F, 0x75, 0x71, 0x84, 0x98, 0x30, 0xE0, 0xF5, 0xEC, 0x35, 0x64, 0x75,
+    0xBB, 0xAF, 0x67, 0x63, 0x9E, 0xC3, 0x26, 0xA4, 0x99, 0xD7, 0x21, 0x17, 0x57, 0xCC, 0xDB, 0x7D,
+    0x95, 0x42, 0x21, 0xED, 0x40, 0x67, 0x48, 0xF8, 0xDC, 0x5D, 0x0A, 0x51, 0xA6, 0x3C, 0xC0, 0x77,
+    0xAA, 0x05, 0x11, 0xC6, 0x7D, 0x55, 0x05, 0xAE, 0xBA, 0x5F, 0x55, 0xCF, 0xE8, 0x67, 0x0E, 0x1E,
+    0xF5, 0xAF, 0x34, 0xBD, 0x89, 0x67, 0x3E, 0x0E, 0x45, 0xE8, 0xD2, 0x36, 0x0A, 0x6F, 0x4F, 0x3C,
+    0xB9, 0x09, 0x50, 0x7D, 0x9C, 0x21, 0xB9, 0x31, 0xBA, 0xCB, 0x48, 0x44, 0xBF, 0xB7, 0x99, 0x00,
+    0xEB, 0x8F, 0x70, 0xDA, 0x29, 0x01, 0xF5, 0xE7, 0x91, 0xDC, 0xF1, 0xDC, 0x4D, 0x2D, 0xEA, 0x50,
+    0xDB, 0x38, 0xBC, 0x43, 0x90, 0x20, 0xD3, 0x78, 0x09, 0x33, 0x3A, 0x3D, 0xAD, 0x39, 0x96, 0xAF,
+    0x3D, 0xDF, 0x5A, 0x0F, 0xE9, 0xB1, 0x57, 0xEB, 0x71, 0x4E, 0xBB, 0x07, 0xCB, 0x9A, 0x11, 0x04,
+    0x3B, 0x9A, 0x57, 0xA2, 0xAB, 0x51, 0xF5, 0x71, 0x7B, 0xF8, 0xFB, 0x36, 0x14, 0x4B, 0x8A, 0xCC,
+    0xED, 0x18, 0x39, 0xA7, 0x7E, 0xB7, 0x61, 0x95, 0x5F, 0x5E, 0x07, 0x7D, 0x19, 0xB7, 0x79, 0xED,
+    0xCB, 0xE6, 0x6B, 0x02, 0x30, 0x49, 0x2A, 0x1A, 0x8A, 0x2A, 0x2F, 0x40, 0x4A, 0x02, 0x30, 0x04,
+    0xE2, 0xEE, 0x46, 0x7D, 0xEC, 0xE4, 0x24, 0xFA, 0xA3, 0xF8, 0xA1, 0x38, 0xE3, 0x87, 0x10, 0x95,
+    0x66, 0x70, 0x3A, 0x84, 0xA2, 0x8E, 0xB3, 0x90, 0xC1, 0xA8, 0x02, 0xCE, 0x75, 0x21, 0x5E, 0xFC,
+    0x69, 0x5B, 0x29, 0x8B, 0x91, 0x7F, 0xBC, 0xFF, 0xD3, 0xE5, 0xD2, 0xD8, 0x80, 0xF9, 0xD0, 0x9D,
+    0xC2, 0x9E, 0x2C, 0x42, 0x78, 0xB1, 0x67, 0x9A, 0xF3, 0x98, 0x2D, 0x75, 0x64, 0xE2, 0xF6, 0x5C,
+    0x9F, 0x1C, 0x09, 0x8B, 0xAD, 0xFB, 0xE3, 0x86, 0x2A, 0x43, 0xDA, 0xD9, 0x62, 0x6A, 0xE5, 0x62,
+    0x08, 0xF4, 0x89, 0xB0, 0x7E, 0x95, 0x0A, 0xA0, 0xF4, 0xCA, 0x20, 0x9B, 0x55, 0x5E, 0xE1, 0x17,
+    0x7E, 0x35, 0x2B, 0x66, 0x32, 0x74, 0xBF, 0xF0, 0x44, 0x39, 0x07, 0x19, 0x8F, 0xC9, 0x4C, 0x30,
+    0x42, 0x98, 0xF8, 0x82, 0x60, 0x22, 0xE1, 0x3E, 0x88, 0xAB, 0x93, 0x72, 0x3C, 0x8F, 0xFC, 0x5B,
+    0x39, 0xDE, 0x90, 0x09, 0xBD, 0x84, 0xD2, 0xEA, 0x7A, 0x27, 0xCA, 0x34, 0x82, 0x07, 0x41, 0x55,
+    0x8E, 0x59, 0xB7, 0xEE, 0xA4, 0x86, 0x69, 0xA5, 0x92, 0xA9, 0xDA, 0x5F, 0x51, 0x66, 0x7F, 0x4E,
+    0x70, 0x66, 0xBD, 0xA0, 0x76, 0x64, 0x53, 0xA5, 0x99, 0xAD, 0x11, 0xA6, 0x1B, 0x0E, 0x84, 0x11,
+    0xDD, 0x08, 0x7F, 0xE7, 0x9C, 0x7E, 0x91, 0x26, 0xA0, 0xF0, 0x08, 0xBE, 0xFB, 0x9C, 0x1C, 0xA3,
+    0x37, 0xC4, 0x0A, 0x6A, 0xE2, 0xBD, 0xFC, 0xDE, 0xE6, 0x3C, 0x2E, 0x66, 0xA2, 0xC6, 0x84, 0x03,
+    0x9F, 0xFE, 0x0D, 0x5B, 0x22, 0xA2, 0xD9, 0xE6, 0xF4, 0xCE, 0x10, 0x08, 0x20, 0x79, 0xD5, 0x68,
+    0xFA, 0x91, 0x4B, 0x4B, 0x01, 0x59, 0x38, 0x2C, 0xC4, 0x73, 0xFA, 0xFF, 0xD4, 0x11, 0xDC, 0xDD,
+    0x5E, 0x05, 0x7C, 0x33, 0xD6, 0x1C, 0xBC, 0xDE, 0x6A, 0xB8, 0x90, 0xC6, 0x8D, 0x6F, 0xC3, 0x85,
+    0x31, 0x8D, 0xC9, 0x2C, 0xFE, 0xB3, 0x04, 0xFB, 0xF5, 0x5E, 0x9E, 0xA5, 0xCF, 0x8A, 0x79, 0x9F,
+    0x9B, 0x23, 0xA9, 0xD6, 0xE5, 0x11, 0xDB, 0x52, 0xBE, 0x6B, 0x18, 0x0A, 0xA8, 0x27, 0x78, 0x33,
+    0x9F, 0x86, 0x18, 0x91, 0x67, 0x2A, 0x1B, 0x37, 0xEA, 0xAF, 0x08, 0x19, 0x09, 0x6E, 0xA2, 0x3F,
+    0xA3, 0xE4, 0x3C, 0xA7, 0xA4, 0x6C, 0xC8, 0x02, 0x8E, 0x96, 0xC9, 0x78, 0x9A, 0x31, 0x36, 0x53,
+    0xCD, 0x0F, 0x79, 0x4A, 0x7F, 0x03, 0x4F, 0xE7, 0x94, 0x91, 0x2E, 0xE9, 0x49, 0x37, 0xB8, 0x56,
+    0x6A, 0xA6, 0x9A, 0x48, 0x1C, 0x6B, 0x06, 0x5D, 0x1C, 0x68, 0x2A, 0xF8, 0x67, 0x75, 0xC7, 0xFF,
+    0x4B, 0x85, 0x92, 0x97, 0x34, 0x03, 0x6F, 0x6E, 0x96, 0x19, 0xC6, 0xC3, 0xFA, 0x04, 0xC5, 0x04,
+    0x12, 0x22, 0x91, 0x33, 0x89, 0x90, 0x04, 0x83, 0x8D, 0x30, 0xFB, 0x6B, 0xD8, 0x48, 0x01, 0x47,
+    0xBA, 0x46, 0xBB, 0x79, 0x9D, 0x03, 0xBC, 0xC1, 0xF1, 0x31, 0xCF, 0x8D, 0x3E, 0xF7, 0x05, 0x95,
+    0xD5, 0x2D, 0xFA, 0x7A, 0x76, 0x59, 0x4F, 0xBA, 0x4D, 0xC3, 0x3A, 0x26, 0xD3, 0xC6, 0x37, 0x86,
+    0x5B, 0x0F, 0xF9, 0xCB, 0xD1, 0xE4, 0x91, 0xC7, 0x2E, 0x7F, 0x4E, 0x99, 0x28, 0xD6, 0x08, 0x14,
+    0x63, 0x4D, 0xE6, 0x25, 0xDB, 0xB2, 0x43, 0x33, 0xA5, 0x67, 0xC9, 0x8D, 0xFD, 0x45, 0x47, 0x1F,
+    0x1A, 0xBA, 0x7E, 0x8E, 0x7E, 0x87, 0x58, 0x6B, 0x0F, 0x5F, 0xA6, 0xFF, 0xA3, 0xDC, 0xA1, 0xD9,
+    0xCD, 0x12, 0xBA, 0x8B, 0xFB, 0x1C, 0x64, 0x1F, 0xC0, 0x0A, 0xAC, 0x58, 0x3E, 0xD9, 0xE0, 0x52,
+    0xBF, 0x66, 0x85, 0xA6, 0xEA, 0x1D, 0x2B, 0xF8, 0x6D, 0x8D, 0x7E, 0x3E, 0x68, 0x81, 0x21, 0x41,
+    0xDA, 0x82, 0x81, 0x6F, 0x42, 0x80, 0x42, 0x95, 0x87, 0x7F, 0x85, 0x74, 0xC9, 0x80, 0xB2, 0x09,
+    0xB6, 0x8A, 0x7A, 0x03, 0x65, 0x93, 0xB0, 0x5E, 0x04, 0xFB, 0xD5, 0xAB, 0x34, 0xC7, 0x2D, 0xCA,
+    0xB4, 0x2C, 0x27, 0x2E, 0xC2, 0x6C, 0x56, 0xE8, 0x95, 0xDC, 0x23, 0x4B, 0xB9, 0x97, 0x45, 0x52,
+    0x31, 0x59, 0x58, 0x70, 0x67, 0x79, 0x8A, 0x76, 0x60, 0x27, 0xBA, 0x18, 0x32, 0x0A, 0x8B, 0xEF,
+    0xD5, 0x5B, 0x18, 0x07, 0xFC, 0x94, 0xF5, 0x50, 0x29, 0xE1, 0xFD, 0x58, 0xF3, 0x5E, 0x4B, 0xE3,
+    0x0A, 0x4C, 0x42, 0xCA, 0x9E, 0x7C, 0xB4, 0xC7, 0xEF, 0x2B, 0x36, 0x63, 0x55, 0x26, 0x59, 0x0E,
+    0xE2, 0x77, 0x43, 0xCB, 0x9C, 0x06, 0x9F, 0xCB, 0xE8, 0x01, 0x5D, 0xEE, 0x89, 0x68, 0xA4, 0xCD,
+    0x62, 0xE2, 0x89, 0x30, 0xB6, 0x15, 0xC6, 0xF0, 0xB1, 0xE8, 0xDE, 0x3E, 0x4F, 0x7D, 0x96, 0x22,
+    0x34, 0x98, 0xBE, 0x3E, 0xDF, 0xAC, 0xDC, 0x85, 0xB3, 0x80, 0xB1, 0xE1, 0x20, 0x27, 0xB3, 0x83,
+    0xC7, 0x0F, 0x55, 0x2E, 0x72, 0x3E, 0x87, 0xE4, 0x0A, 0xF9, 0xB7, 0x4B, 0xE8, 0xE9, 0x20, 0xEB,
+    0xBB, 0x03, 0x02, 0x0B, 0x45, 0xE7, 0x29, 0x41, 0x8F, 0x41, 0x6B, 0x92, 0x4E, 0xD6, 0xB7, 0x22,
+    0xDE, 0xBE, 0xE5, 0xC1, 0xC7, 0x25, 0x46, 0xAB, 0x9F, 0x31, 0x83, 0x32, 0x0E, 0x34, 0x63, 0x3B,
+    0x3E, 0xA3, 0x49, 0x70, 0xC2, 0x8A, 0x4C, 0x8B, 0x08, 0x6B, 0x0D, 0x94, 0x04, 0x95, 0x46, 0x4A,
+    0x30, 0x95, 0xA3, 0x63, 0xF7, 0x9B, 0x65, 0x5E, 0xB8, 0x0D, 0x95, 0x7B, 0xF5, 0xEA, 0x8C, 0x73,
+    0x3B, 0x81, 0x66, 0x98, 0x88, 0x15, 0xDF, 0xC9, 0x04, 0x40, 0xD8, 0xBF, 0xE6, 0xB4, 0xB5, 0x66,
+    0x8B, 0x14, 0x19, 0x8D, 0x51, 0xF9, 0x04, 0x93, 0xC8, 0x13, 0x16, 0xBC, 0xAA, 0x67, 0x9C, 0xA6,
+    0x5C, 0xAF, 0xB8, 0x22, 0x57, 0x60, 0x91, 0x6B, 0x7E, 0x7D, 0xAE, 0x5C, 0xD3, 0xEB, 0x0D, 0xFB,
+    0xC1, 0xE8, 0xC1, 0xC9, 0x61, 0x21, 0x8A, 0xA1, 0x6E, 0x56, 0x7B, 0x3F, 0xD1, 0xC2, 0x50, 0x8A,
+    0x7B, 0x7E, 0x24, 0xD2, 0x6C, 0xE6, 0x94, 0x1D, 0x80, 0xC0, 0x9D, 0x5E, 0x93, 0x72, 0x51, 0xB4,
+    0x48, 0x5C, 0xC0, 0xFA, 0xBD, 0x49, 0xC1, 0x80, 0x59, 0xED, 0x37, 0x70, 0x2C, 0xB1, 0xA9, 0xC8,
+    0x94, 0xD1, 0x11, 0xE6, 0xD0, 0x87, 0x5F, 0x2C, 0x3D, 0x38, 0x72, 0xA9, 0x2B, 0x98, 0x4E, 0x09,
+    0x3B, 0xA1, 0x21, 0x6F, 0x21, 0x47, 0xBF, 0x61, 0x29, 0x15, 0xEB, 0xA8, 0x72, 0xDB, 0x33, 0x26,
+    0x28, 0x53, 0x82, 0x7D, 0x20, 0x8D, 0xF0, 0x9B, 0xDF, 0x46, 0x30, 0x0C, 0x12, 0x89, 0x55, 0x04,
+    0xA1, 0x2D, 0xAB, 0x9D, 0xFE, 0x38, 0xD6, 0x25, 0x3B, 0xB3, 0xD5, 0x13, 0xC7, 0x45, 0x5F, 0xE3,
+    0xFC, 0x11, 0xFF, 0x59, 0x75, 0x80, 0x86, 0x76, 0x01, 0xFC, 0x62, 0x35, 0xF7, 0xF9, 0x94, 0xBD,
+    0xC1, 0x8A, 0x9B, 0xD4, 0xA4, 0x0D, 0x83, 0x06, 0x5E, 0xD7, 0x3B, 0xC0, 0xA1, 0x61, 0x21, 0xF6,
+    0x90, 0xE0, 0x4F, 0xC1, 0x54, 0x5E, 0x45, 0x04, 0x73, 0xD2, 0x2D, 0xBC, 0xB9, 0xCD, 0x86, 0x9E,
+    0xDB, 0x4C, 0xE8, 0x46, 0x75, 0xB4, 0xAA, 0x57, 0x9E, 0x4B, 0x3D, 0xEB, 0xB3, 0xC5, 0x28, 0xD5,
+    0xE5, 0x9D, 0xDB, 0x65, 0xAE, 0x75, 0x93, 0xFB, 0xF6, 0xAC, 0x6D, 0xA9, 0x06, 0x75, 0x6B, 0x34,
+    0xDF, 0x91, 0x72, 0x41, 0xCF, 0x39, 0x56, 0xF3, 0x93, 0x58, 0xFC, 0x10, 0x8D, 0x60, 0x90, 0xD0,
+    0x39, 0x17, 0x06, 0x0A, 0x99, 0xA9, 0xF2, 0x2D, 0x2E, 0x4D, 0xBE, 0x70, 0x86, 0x6C, 0x5B, 0x1B,
+    0x99, 0x7C, 0x5C, 0x9D, 0x9D, 0x97, 0x69, 0x1D, 0xA0, 0xB2, 0xFE, 0x8C, 0x23, 0x88, 0xCE, 0x7C,
+    0xE2, 0xD4, 0xB1, 0xB1, 0xA1, 0x8D, 0x3A, 0x2D, 0x6D, 0x9F, 0x82, 0x7F, 0xC1, 0xE3, 0xE5, 0x7D,
+    0x72, 0x2B, 0xEC, 0xD0, 0x73, 0xA8, 0xDB, 0xFC, 0xF5, 0xBF, 0x6F, 0x64, 0x56, 0x5F, 0x2C, 0x76,
+    0x66, 0x55, 0xF0, 0xD9, 0x44, 0xAC, 0xFF, 0x23, 0x8E, 0xD9, 0xE6, 0xEC, 0x52, 0xED, 0x8D, 0x43,
+    0x25, 0x93, 0x2A, 0x8C, 0xD4, 0xA3, 0xA2, 0x49, 0x1E, 0xDB, 0x5D, 0x8A, 0x34, 0x7A, 0xE4, 0xE7,
+    0xA8, 0x81, 0x15, 0x0A, 0x24, 0x08, 0xA9, 0x87, 0x77, 0xDF, 0xDA, 0xCB, 0x93, 0x99, 0x18, 0xB7,
+    0x0D, 0x00, 0x2E, 0x87, 0x7E, 0xF4, 0x82, 0x56, 0xE6, 0x84, 0xB6, 0xEE, 0x39, 0xF0, 0x0A, 0xD6,
+    0x84, 0x7F, 0xC4, 0x4D, 0x36, 0x0E, 0x0A, 0xD6, 0x0F, 0xBF, 0xF7, 0xF2, 0xEA, 0xD5, 0xAB, 0x19,
+    0x41, 0x20, 0x3F, 0x56, 0x9D, 0xE5, 0x72, 0x64, 0x4F, 0x1D, 0x39, 0xA0, 0x42, 0x3E, 0x58, 0x07,
+    0xE7, 0x40, 0x6F, 0x3A, 0xBC, 0xF2, 0xD7, 0x3B, 0xC2, 0x4D, 0xD1, 0x01, 0x9A, 0xB3, 0xCD, 0x0C,
+    0x6A, 0x28, 0x01, 0x5B, 0x1C, 0xB4, 0x62, 0xF3, 0x28, 0x6A, 0xB5, 0xF5, 0x61, 0xD3, 0xA4, 0x95,
+    0x49, 0x85, 0x5D, 0x9A, 0xEC, 0xAF, 0xB6, 0xD3, 0xBF, 0x46, 0x53, 0xCB, 0x4A, 0x13, 0x65, 0x94,
+    0x50, 0x51, 0x3F, 0xA9, 0xC9, 0x3B, 0x58, 0x99, 0xA7, 0x1F, 0x5D, 0x98, 0xA1, 0x09, 0xD4, 0xD0,
+    0x05, 0x8A, 0xF5, 0x31, 0x22, 0xD4, 0x5F, 0x69, 0xC4, 0xEA, 0x85, 0xFD, 0xDB, 0x0A, 0x9B, 0x70,
+    0xBF, 0x46, 0x85, 0x2D, 0xAF, 0x5D, 0x09, 0x66, 0x0E, 0x41, 0x48, 0xFD, 0x5B, 0x54, 0x2A, 0x05,
+    0x9C, 0xBE, 0x1E, 0x4C, 0x72, 0x1B, 0x4A, 0xB3, 0x61, 0xB4, 0x60, 0xD2, 0x2C, 0x8B, 0x29, 0x2E,
+    0xF4, 0xBA, 0x1F, 0x41, 0x4C, 0x24, 0x4C, 0x20, 0x16, 0xBF, 0x5F, 0xDB, 0xDC, 0x3B, 0x5A, 0x91,
+    0xA8, 0xB8, 0x97, 0x3B, 0x8B, 0xA0, 0x31, 0x3B, 0x61, 0xF9, 0x8B, 0xA6, 0x71, 0xB2, 0xF8, 0x33,
+    0x60, 0xB6, 0xB7, 0x4A, 0x9B, 0x9E, 0xA8, 0x1F, 0x63, 0x01, 0xDB, 0x8E, 0x7C, 0x0C, 0xA9, 0xB2,
+    0x88, 0x4C, 0x00, 0xEC, 0x30, 0x1F, 0x74, 0xB2, 0x32, 0xB2, 0x73, 0x36, 0x91, 0xF1, 0x9F, 0x74,
+    0xB2, 0x81, 0xD4, 0xF5, 0xB7, 0x81, 0x6D, 0x84, 0xEA, 0xC8, 0x2C, 0xBD, 0xED, 0x17, 0xBF, 0x63,
+    0xDC, 0xE4, 0x8C, 0x08, 0x90, 0x46, 0xEC, 0x9C, 0x35, 0x73, 0x4C, 0x24, 0xA0, 0xF0, 0x51, 0x36,
+    0x4B, 0xD6, 0x10, 0x0F, 0xD8, 0xC0, 0xCC, 0x12, 0x84, 0x6D, 0x93, 0xB3, 0xF2, 0xE4, 0xDF, 0x36,
+    0x8F, 0x91, 0xBE, 0x93, 0xC6, 0x65, 0x61, 0x37, 0x01, 0x89, 0xA3, 0x10, 0xBE, 0xE8, 0x8D, 0x63,
+    0xF8, 0x6D, 0xE7, 0x40, 0x15, 0xBB, 0x7E, 0x9D, 0x47, 0xFD, 0x7A, 0xA0, 0x1E, 0x24, 0xE6, 0xF9,
+    0x62, 0x7E, 0x37, 0xF8, 0xF5, 0xB3, 0xC0, 0x5A, 0x57, 0xF8, 0xF5, 0xA7, 0x0E, 0xC8, 0xA0, 0xF7,
+    0xF2, 0x63, 0xBD, 0x9C, 0x86, 0xED, 0xEB, 0x92, 0x01, 0x82, 0xFD, 0x9B, 0xD9, 0xD0, 0x66, 0xA1,
+    0xB8, 0xEE, 0xA8, 0xDA, 0xB8, 0xE8, 0x94, 0x0F, 0xE1, 0x71, 0xCE, 0x97, 0x78, 0xFC, 0xAA, 0x26,
+    0x84, 0x0C, 0xD3, 0x4C, 0x73, 0x8A, 0xDA, 0x6B, 0x05, 0x82, 0xA0, 0xE3, 0x34, 0x37, 0xEE, 0x37,
+    0x4D, 0xF7, 0xAB, 0x93, 0xFA, 0xD1, 0xF1, 0xF2, 0xFC, 0xB5, 0x91, 0xA8, 0xD7, 0x97, 0xA4, 0xDE,
+    0x30, 0x4B, 0x74, 0x7B, 0x7D, 0xB5, 0xBF, 0xCC, 0x4A, 0x27, 0xA4, 0x09, 0xF4, 0x9A, 0xE9, 0x44,
+    0xBD, 0x11, 0x92, 0xF8, 0xD9, 0x70, 0x25, 0x7F, 0x7A, 0x4C, 0x78, 0x6B, 0x67, 0x40, 0x2D, 0x61,
+    0x3B, 0xC4, 0xF2, 0xFA, 0x72, 0x68, 0xD1, 0xD6, 0x8F, 0x01, 0xCD, 0x8B, 0x87, 0x75, 0xFB, 0x7B,
+    0xE7, 0x3F, 0x9D, 0x1D, 0xF9, 0x2D, 0x51, 0x5A, 0x16, 0x1A, 0xDD, 0x3E, 0xD1, 0x8D, 0xBD, 0xF1,
+    0xB6, 0xED, 0x5C, 0xF2, 0x87, 0xB0, 0x2C, 0xBF, 0x34, 0x46, 0x22, 0x79, 0xD7, 0x7E, 0xE8, 0xE2,
+    0xE6, 0xF3, 0x71, 0x0C, 0x75, 0x0B, 0xCE, 0xB9, 0x42, 0x32, 0x9C, 0xB7, 0x4E, 0xA9, 0x01, 0xBC,
+    0xB9, 0xD5, 0x48, 0xB5, 0x62, 0x05, 0x3F, 0x2C, 0x1B, 0xFD, 0xA8, 0x73, 0x79, 0xB5, 0xD9, 0x8F,
+    0xA6, 0xF0, 0x42, 0xCA, 0x18, 0xE5, 0xAC, 0xD8, 0x96, 0x5D, 0xC5, 0xDA, 0x00, 0xC4, 0x44, 0x77,
+    0x9B, 0xD5, 0x96, 0x0F, 0x1B, 0x87, 0xB7, 0x7C, 0xB8, 0xAD, 0x25, 0xBD, 0x9D, 0x85, 0xC5, 0xAD,
+    0xBA, 0x00, 0x58, 0xEA, 0x5E, 0xDA, 0xC2, 0xC9, 0x43, 0x5A, 0x3E, 0xA0, 0xB6, 0x24, 0x9D, 0xB6,
+    0x7C, 0xA8, 0x1C, 0xDA, 0x7F, 0x87, 0xB5, 0x7C, 0x20, 0x64, 0x1F, 0x5A, 0x3E, 0xFC, 0x89, 0x6D,
+    0xF9, 0xD0, 0x2E, 0x5B, 0x3E, 0x34, 0x87, 0xB7, 0x7C, 0x80, 0xC8, 0x73, 0xA6, 0x2D, 0x1F, 0xBA,
+    0xCB, 0xB6, 0xE5, 0x83, 0xDD, 0x49, 0x03, 0x97, 0x0E, 0x06, 0xD8, 0x7E, 0x80, 0x6C, 0xFB, 0x9A,
+    0x38, 0xFB, 0x80, 0x32, 0x7F, 0x7E, 0x05, 0x64, 0x86, 0x7E, 0xF6, 0xE0, 0xC5, 0x88, 0x40, 0x26,
+    0x94, 0xEB, 0xED, 0x4E, 0x05, 0x4B, 0x8C, 0x6A, 0x9A, 0x67, 0x86, 0xFC, 0xE8, 0x62, 0x48, 0x78,
+    0x8E, 0x56, 0x93, 0x61, 0xD2, 0x83, 0x79, 0xC5, 0x4C, 0xA7, 0x9E, 0xC1, 0xED, 0x74, 0x1C, 0xDF,
+    0xF9, 0x55, 0x94, 0xAD, 0x7C, 0xAF, 0x7D, 0x3C, 0xEC, 0xBF, 0xDE, 0xCF, 0x91, 0x1E, 0x57, 0xCB,
+    0x5A, 0x1C, 0x2D, 0x87, 0x19, 0x10, 0x67, 0x86, 0x63, 0xE5, 0xE7, 0xCE, 0x30, 0xE4, 0x27, 0x1F,
+    0xA4, 0x71, 0x9E, 0x5C, 0x20, 0x2D, 0x40, 0x01, 0xFC, 0xC7, 0x16, 0x17, 0xF6, 0x95, 0xCC, 0xCD,
+    0x0E, 0x3A, 0x74, 0xAC, 0xD3, 0xF6, 0xE1, 0x04, 0xFD, 0x9E, 0xB4, 0x2E, 0xB1, 0xC5, 0x32, 0xEF,
+    0x03, 0xCE, 0xEC, 0xDF, 0xEB, 0xBE, 0xB6, 0x92, 0xE8, 0x46, 0x85, 0xF5, 0xDD, 0x0D, 0x46, 0x1C,
+    0xE5, 0xD1, 0x75, 0x58, 0x78, 0x6D, 0x98, 0x39, 0xAD, 0x3C, 0x54, 0x7E, 0xE5, 0x2C, 0x03, 0x81,
+    0x47, 0xCE, 0xBF, 0xB7, 0x59, 0x3A, 0x43, 0xB2, 0xDB, 0x6A, 0xA1, 0xBD, 0x59, 0x29, 0xB4, 0x2F,
+    0x26, 0x85, 0xF6, 0xA5, 0x2D, 0xB4, 0x9F, 0xD9, 0x42, 0xFB, 0x4F, 0xC1, 0x7C, 0xAC, 0xD6, 0x45,
+    0x7B, 0x06, 0x4C, 0x3F, 0x0C, 0x4A, 0xBF, 0x1D, 0xDC, 0xFE, 0xD1, 0xDD, 0xFF, 0xAA, 0x4E, 0xE9,
+    0x2D, 0xCE, 0xF5, 0x93, 0x93, 0x36, 0x3C, 0xAB, 0xC4, 0x75, 0x0E, 0x2F, 0xB4, 0x7F, 0xBB, 0xEC,
+    0xEF, 0x6C, 0x92, 0xFD, 0x3D, 0xDF, 0x9F, 0xFD, 0xDD, 0x7E, 0x04, 0xA9, 0x1F, 0x67, 0x98, 0x97,
+    0x88, 0x94, 0x3A, 0xC1, 0x2D, 0xDE, 0xE2, 0x04, 0x31, 0x75, 0x8D, 0xEC, 0xEF, 0x75, 0xCC, 0xE2,
+    0x24, 0x78, 0xE7, 0xC8, 0xDB, 0x64, 0x7F, 0x5F, 0x1F, 0xFC, 0x85, 0x28, 0x47, 0xB0, 0x42, 0x23,
+    0xEA, 0xB5, 0x80, 0xD1, 0x76, 0xD7, 0x32, 0x87, 0x76, 0xFF, 0x7B, 0x30, 0x6B, 0x94, 0xFB, 0xBB,
+    0x47, 0x45, 0xF7, 0xEF, 0x5A, 0xF4, 0x0E, 0xC8, 0xF5, 0x09, 0x2B, 0xBA, 0x51, 0x2E, 0x51, 0xC7,
+    0x42, 0xFF, 0x67, 0xBA, 0xAB, 0x97, 0x6D, 0x09, 0xB7, 0xE6, 0x42, 0xD6, 0x93, 0x5C, 0xC8, 0x49,
+    0x6A, 0x50, 0x30, 0xA4, 0x06, 0x0D, 0x0D, 0x40, 0x27, 0xE9, 0x41, 0xFB, 0xBB, 0x64, 0xCD, 0xB4,
+    0x4B, 0x56, 0xC9, 0xAA, 0xD5, 0x49, 0x97, 0xAC, 0xFB, 0xCF, 0xD3, 0x67, 0xFB, 0x82, 0x63, 0xD7,
+    0xD8, 0x73, 0xE1, 0x40, 0x27, 0x81, 0x77, 0x3B, 0x4F, 0x61, 0xE9, 0xEE, 0xB1, 0xFE, 0x6A, 0xC7,
+    0x7E, 0xA8, 0xBB, 0x82, 0xE3, 0x6F, 0xC9, 0x6F, 0x2B, 0xA6, 0xC5, 0xB8, 0x1D, 0xE6, 0xE6, 0xD5,
+    0xEE, 0xCA, 0x7D, 0xD3, 0xA0, 0x86, 0xB9, 0xFE, 0xEC, 0xF3, 0x82, 0xD5, 0x35, 0xF6, 0x48, 0x0B,
+    0xD1, 0x3B, 0x52, 0xE6, 0xE5, 0x4C, 0xB7, 0xB6, 0x16, 0x03, 0xC7, 0xD3, 0xE2, 0xD8, 0x8C, 0x8D,
+    0x26, 0xD1, 0x03, 0x49, 0xFE, 0x8A, 0x79, 0xC5, 0x09, 0xE6, 0x35, 0x89, 0x43, 0x80, 0x97, 0x36,
+    0xF8, 0xFC, 0x0A, 0x18, 0x5B, 0xDB, 0x45, 0xAA, 0xE3, 0xD7, 0xEB, 0x5F, 0x65, 0x15, 0x31, 0x1D,
+    0xC2, 0xCE, 0x73, 0xEF, 0x80, 0x1A, 0xAE, 0x0C, 0x51, 0xE4, 0x76, 0x85, 0xE8, 0x2C, 0xFC, 0xF2,
+    0x48, 0xC0, 0x96, 0xC1, 0xA3, 0x3C, 0x0E, 0xC1, 0x97, 0x05, 0x7E, 0xC3, 0x6C, 0x48, 0x23, 0xD3,
+    0x14, 0xB2, 0x35, 0x79, 0xE6, 0x79, 0xA1, 0x13, 0xB2, 0x47, 0x23, 0xB1, 0xB6, 0x8E, 0x01, 0x5D,
+    0x8B, 0x2E, 0x90, 0xC7, 0xA2, 0x1D, 0x6D, 0xD4, 0x9A, 0x6B, 0xFD, 0x65, 0x6C, 0xF4, 0xF3, 0xDB,
+    0x20, 0xD0, 0x79, 0x19, 0xFB, 0xE9, 0x00, 0xB4, 0xBE, 0x71, 0x9C, 0xC6, 0xF7, 0xAC, 0xD2, 0x3D,
+    0x82, 0x62, 0x1D, 0xD5, 0x14, 0x2E, 0xBA, 0x21, 0xA8, 0xD7, 0x0B, 0xD9, 0xBD, 0xCA, 0xAD, 0x75,
+    0x50, 0x9C, 0xD4, 0xAB, 0x1B, 0x61, 0x66, 0x4B, 0xEC, 0xD7, 0xA3, 0x67, 0x6B, 0x0B, 0x0E, 0x06,
+    0x65, 0x13, 0xDA, 0x68, 0x3F, 0x92, 0xB0, 0x52, 0xEB, 0xF2, 0x47, 0xD1, 0xE4, 0xC2, 0xEE, 0xB2,
+    0x5B, 0x4A, 0x35, 0x6E, 0xFC, 0xD4, 0xF6, 0xB0, 0xD0, 0x7C, 0x31, 0x35, 0xC4, 0xB4, 0xBB, 0x2B,
+    0x4B, 0x20, 0xB4, 0xD3, 0x8E, 0x0A, 0x2F, 0x08, 0x57, 0xA1, 0x2E, 0xEB, 0x26, 0x1B, 0xB3, 0xD9,
+    0x25, 0x33, 0x41, 0x2D, 0x79, 0xE9, 0xCA, 0x6E, 0x76, 0x46, 0xDF, 0x94, 0xB5, 0x65, 0x38, 0x8C,
+    0x43, 0x10, 0xC1, 0xD2, 0xFF, 0xE8, 0x9B, 0x83, 0x28, 0xE1, 0xF8, 0x8A, 0xD6, 0x6F, 0x98, 0xBF,
+    0x8B, 0x7C, 0x4B, 0x64, 0x9D, 0x6D, 0x16, 0x6E, 0x99, 0x26, 0xDB, 0xA6, 0x11, 0x0A, 0x21, 0x4F,
+    0x58, 0x64, 0x13, 0x58, 0x54, 0x8C, 0xEF, 0xD2, 0x23, 0x8F, 0xB6, 0x8A, 0xDB, 0x82, 0xA2, 0xB1,
+    0x16, 0xFC, 0xD7, 0x9B, 0x78, 0x6C, 0x11, 0x37, 0x5C, 0xA8, 0x56, 0x0A, 0x3F, 0x5F, 0x2B, 0xA2,
+    0x8A, 0xBD, 0x4A, 0x19, 0x28, 0x9E, 0x95, 0xBB, 0x0C, 0x78, 0xDC, 0xF2, 0x0B, 0xCD, 0xF0, 0x6B,
+    0xB0, 0x9A, 0x1F, 0x41, 0x55, 0x9E, 0x5C, 0x64, 0x5B, 0x26, 0x7F, 0xB1, 0x08, 0x32, 0xD4, 0xB5,
+    0xC5, 0x9D, 0x58, 0x2D, 0x68, 0x38, 0xA1, 0x30, 0xFE, 0x89, 0x11, 0x69, 0x56, 0x63, 0x20, 0xCA,
+    0xAC, 0xEA, 0xFC, 0x25, 0x4A, 0x8A, 0x87, 0x26, 0x9D, 0x83, 0xD5, 0x70, 0x74, 0x84, 0xB7, 0x0E,
+    0x5A, 0x20, 0x07, 0x7B, 0xB9, 0x58, 0x8E, 0xC5, 0x6C, 0xCE, 0xB0, 0xA3, 0xA6, 0x08, 0xBF, 0x84,
+    0xC3, 0x11, 0x5B, 0x13, 0xDD, 0x0C, 0xFB, 0x09, 0x3E, 0x25, 0x78, 0x1A, 0x7D, 0x04, 0x18, 0x1E,
+    0xBB, 0xD6, 0x8C, 0x25, 0xCA, 0xA4, 0x3F, 0x8B, 0xDF, 0xC3, 0xF2, 0x08, 0x0E, 0x68, 0x7B, 0x58,
+    0xBE, 0x84, 0x3F, 0x40, 0x61, 0x66, 0xB1, 0x2C, 0x96, 0x89, 0xF6, 0x36, 0x1B, 0xAD, 0xE8, 0x51,
+    0x70, 0xE7, 0xD4, 0xA3, 0x6B, 0xB2, 0xB1, 0xC5, 0xA9, 0xE6, 0x0F, 0xEA, 0xC1, 0xD0, 0x3A, 0x32,
+    0x71, 0xD8, 0x3A, 0xDD, 0x0B, 0x0C, 0x7D, 0xCE, 0x4A, 0xA7, 0x75, 0x8B, 0x61, 0xCF, 0x08, 0x27,
+    0x3F, 0xB9, 0x59, 0x98, 0x5C, 0x2E, 0x7F, 0x37, 0x1F, 0x2A, 0x03, 0xAB, 0x23, 0x32, 0xD4, 0x4B,
+    0x72, 0x86, 0x1A, 0x44, 0xA0, 0x34, 0xFD, 0x4E, 0xAE, 0xD0, 0x25, 0xB2, 0x3C, 0x01, 0xBA, 0xC0,
+    0xFA, 0x40, 0xB7, 0x3C, 0x19, 0x8B, 0xDB, 0x4D, 0x00, 0x5F, 0x8A, 0x46, 0x19, 0xB7, 0xBD, 0x9E,
+    0x25, 0xC6, 0x01, 0x1A, 0x34, 0xB5, 0x66, 0xCD, 0xA5, 0xAC, 0xB9, 0xA4, 0x94, 0x60, 0x99, 0x6C,
+    0xC3, 0x8D, 0xC3, 0x8C, 0x34, 0xD6, 0x86, 0x24, 0x3C, 0x9D, 0x52, 0x89, 0x73, 0xC9, 0xB6, 0x07,
+    0xB1, 0x8B, 0xAF, 0x4A, 0x83, 0x46, 0x35, 0xBB, 0x95, 0x18, 0xF5, 0x61, 0x8E, 0x29, 0x2F, 0xB1,
+    0xE6, 0xB9, 0xA4, 0x43, 0x5B, 0x0C, 0x8A, 0x32, 0xC2, 0x0A, 0x08, 0x55, 0xC7, 0xF6, 0x74, 0x16,
+    0x01, 0x04, 0xB3, 0x39, 0x6E, 0xA6, 0xEE, 0x59, 0x8B, 0xD7, 0x06, 0x63, 0xA3, 0x9E, 0x72, 0x84,
+    0xE5, 0x07, 0xA7, 0x18, 0x91, 0xDA, 0xAC, 0x11, 0xA4, 0x16, 0xB7, 0x72, 0xE3, 0x3F, 0xBF, 0xE4,
+    0x36, 0x6E, 0xF9, 0x09, 0x17, 0xE9, 0x4F, 0xDE, 0xFC, 0x14, 0x6E, 0x24, 0xEB, 0x35, 0xFB, 0x11,
+    0x33, 0xEF, 0x21, 0x86, 0x99, 0xAD, 0x51, 0xB0, 0xF7, 0x2E, 0x7B, 0xDB, 0xB2, 0x4E, 0x9B, 0xCE,
+    0x1D, 0xED, 0x93, 0xAD, 0x49, 0x87, 0xC9, 0xF6, 0x50, 0xE7, 0x52, 0x0C, 0x7C, 0x47, 0xE1, 0xC1,
+    0x8D, 0x17, 0x0D, 0x46, 0x0A, 0x87, 0x8C, 0x00, 0x01, 0xE8, 0x1B, 0x56, 0xC4, 0xD3, 0x3D, 0xC3,
+    0xD9, 0xDE, 0x5E, 0xC3, 0x64, 0xA3, 0xEC, 0x06, 0xA1, 0x8B, 0xD2, 0x77, 0x9D, 0xF4, 0xBD, 0xB1,
+    0x45, 0xFA, 0x5E, 0xD7, 0xDE, 0xCD, 0x3F, 0x2E, 0x79, 0xFA, 0x29, 0x6E, 0xEE, 0x7F, 0x97, 0x14,
+    0x0D, 0xDE, 0xB2, 0xC6, 0x9D, 0x7A, 0x43, 0x5F, 0xFB, 0x0B, 0xD6, 0xB7, 0xBC, 0xF6, 0x47, 0x6C,
+    0xAC, 0xF7, 0x85, 0x2F, 0x30, 0xD1, 0xEE, 0x37, 0x3E, 0xC3, 0x4E, 0x01, 0x81, 0x76, 0x4C, 0x53,
+    0x5E, 0xCE, 0xC7, 0x94, 0xE6, 0x5C, 0x95, 0xD6, 0x61, 0x5D, 0x6D, 0x6D, 0xC3, 0x35, 0xC4, 0xD0,
+    0x61, 0x3E, 0xCA, 0xF7, 0xD7, 0x5E, 0xC4, 0xD8, 0x6E, 0x7C, 0x54, 0xB4, 0xF3, 0x7F, 0xA9, 0x30,
+    0xB2, 0x9F, 0xB0, 0xA9, 0xC1, 0x1B, 0x18, 0xD7, 0x8F, 0xDA, 0xD1, 0x19, 0xE3, 0xBF, 0xC5, 0xEE,
+    0x08, 0xAF, 0xC1, 0xCE, 0x0C, 0xBE, 0xF9, 0x59, 0x44, 0x04, 0xBE, 0xF5, 0x1B, 0x90, 0x5C, 0xFF,
+    0x4E, 0x9B, 0x34, 0x79, 0x9A, 0x71, 0xB2, 0xD0, 0x2E, 0x85, 0x97, 0xA1, 0xB7, 0xA3, 0xFA, 0xC1,
+    0x9C, 0x97, 0xF6, 0xF5, 0x25, 0x55, 0x25, 0x1F, 0x14, 0xE7, 0x95, 0x5A, 0x5C, 0x5F, 0xDF, 0x2F,
+    0xCF, 0x76, 0x80, 0xCE, 0xF9, 0x24, 0x70, 0x3D, 0x83, 0xDF, 0x2B, 0x46, 0xE6, 0xC1, 0x9F, 0x5F,
+    0x72, 0x96, 0xBC, 0x56, 0xBF, 0x67, 0x5E, 0x33, 0x03, 0xAF, 0xF1, 0x69, 0x0D, 0xCA, 0x37, 0xEF,
+    0x82, 0x5C, 0xE5, 0x19, 0x92, 0xAB, 0x44, 0x4D, 0xEA, 0x79, 0x85, 0x03, 0x5B, 0x8A, 0xE7, 0x48,
+    0xAE, 0x39, 0x23, 0x47, 0x22, 0xB5, 0x95, 0x5C, 0x81, 0xD2, 0xE9, 0x94, 0xBA, 0xC2, 0xB6, 0xF4,
+    0x6E, 0x73, 0xD5, 0x5E, 0xDD, 0x94, 0x5C, 0x99, 0xED, 0x35, 0x3E, 0x90, 0x8B, 0x5E, 0x22, 0xF5,
+    0x9E, 0xE5, 0x43, 0xA7, 0x31, 0x4F, 0xFB, 0xFF, 0x61, 0x4D, 0x65, 0x45, 0x91, 0x35, 0xF5, 0x02,
+    0xC8, 0x25, 0xFF, 0x29, 0xB9, 0x06, 0xA9, 0xD2, 0x20, 0x64, 0xFE, 0xAA, 0xE0, 0x82, 0x66, 0xDD,
+    0x9B, 0x3B, 0xF3, 0xE6, 0x22, 0x86, 0xF3, 0xFB, 0x76, 0x34, 0x88, 0xF4, 0xC0, 0x67, 0x05, 0x79,
+    0x1E, 0x7C, 0x83, 0xE5, 0x02, 0xD4, 0xA7, 0x21, 0x57, 0x31, 0x7A, 0x79, 0xC1, 0xE7, 0x6B, 0x9B,
+    0x12, 0x45, 0x7C, 0xC0, 0x7E, 0x2C, 0xF5, 0x80, 0x49, 0xC5, 0x0E, 0x36, 0x33, 0xD6, 0x94, 0x3B,
+    0xF9, 0xB4, 0x3D, 0xDB, 0x6D, 0x6D, 0xD6, 0xD1, 0x2D, 0x7B, 0x75, 0xAC, 0xB4, 0x67, 0x6B, 0x26,
+    0xED, 0xD9, 0xB2, 0x65, 0x7B, 0xB6, 0xD9, 0xA4, 0x3D, 0x5B, 0x7A, 0x9F, 0xF6, 0x6C, 0x8B, 0x49,
+    0x7B, 0xB6, 0x68, 0xD9, 0x9E, 0x6D, 0x68, 0xCF, 0x31, 0x74, 0xE7, 0x18, 0xDB, 0xB3, 0xD5, 0x07,
+    0xDB, 0xB3, 0x39, 0xB6, 0x95, 0x98, 0xB6, 0x10, 0x4B, 0x6C, 0x7B, 0x36, 0xAB, 0xB8, 0x73, 0xAB,
+    0xAD, 0x62, 0xB3, 0x6A, 0xB3, 0x06, 0xFB, 0xD4, 0xF5, 0xC9, 0xA5, 0x67, 0x41, 0x18, 0xCD, 0xAB,
+    0x9F, 0x69, 0x35, 0x19, 0xD1, 0x47, 0x8A, 0x8C, 0x5F, 0xB9, 0x73, 0xED, 0xB5, 0xCB, 0x6C, 0x87,
+    0xB0, 0x60, 0xC2, 0x0A, 0x52, 0x5B, 0x92, 0xE0, 0xEE, 0xD5, 0x5C, 0xBD, 0xCE, 0x5A, 0x33, 0x93,
+    0x69, 0x47, 0x85, 0x0E, 0x83, 0x5F, 0xB0, 0x87, 0xC7, 0x11, 0x98, 0x79, 0x70, 0x91, 0xD3, 0xAE,
+    0x38, 0xBA, 0x3E, 0x26, 0x25, 0x5C, 0x1C, 0xA4, 0xAC, 0x37, 0xB4, 0xD7, 0xF4, 0xD8, 0xEB, 0xEB,
+    0x73, 0x63, 0x92, 0x51, 0xA2, 0xA4, 0xDF, 0xEB, 0x13, 0xDB, 0x2F, 0x2D, 0x1C, 0x88, 0x1F, 0x0C,
+    0xD4, 0x0F, 0x06, 0xF2, 0x7F, 0x74, 0x49, 0xFF, 0x71, 0x01, 0xC6, 0x15, 0x18, 0x97, 0x60, 0x5C,
+    0x83, 0x71, 0x11, 0xC6, 0x55, 0xE0, 0x32, 0xB4, 0x66, 0xB2, 0x0E, 0xE3, 0x42, 0x8C, 0x2B, 0x31,
+    0x2E, 0xC5, 0xB8, 0x16, 0xE3, 0x62, 0x8C, 0xCD, 0xF2, 0x86, 0xE5, 0x18, 0x5B, 0xBA, 0x2D, 0xFB,
+    0xE5, 0x81, 0xB2, 0x72, 0x01, 0xDA, 0xEE, 0x31, 0x24, 0xE7, 0x0B, 0xD7, 0x92, 0xBE, 0x81, 0x21,
+    0x85, 0x8F, 0x5B, 0x1F, 0x3E, 0xBB, 0xB9, 0x15, 0x44, 0xF1, 0x98, 0x90, 0x6F, 0x53, 0xA0, 0x40,
+    0x6B, 0xA3, 0xD4, 0xD6, 0x46, 0xEE, 0x8A, 0xD0, 0x76, 0x75, 0xA8, 0x9D, 0x0E, 0x74, 0x61, 0xFB,
+    0xB9, 0xD8, 0xD2, 0x0F, 0xCD, 0xA9, 0x8B, 0x55, 0x8D, 0x1D, 0x5D, 0x76, 0xC6, 0x63, 0x52, 0xAF,
+    0x6D, 0x0B, 0xC9, 0x36, 0xF5, 0x85, 0x35, 0xE5, 0x48, 0x2F, 0x67, 0x68, 0x53, 0xEF, 0xB6, 0x43,
+    0x9B, 0xFA, 0xC6, 0x8C, 0x90, 0x73, 0x5F, 0x9B, 0x7A, 0xB9, 0x50, 0x7A, 0xF9, 0x95, 0xBD, 0x40,
+    0xCF, 0x27, 0x86, 0xAD, 0x60, 0x35, 0x6B, 0x17, 0x1E, 0x74, 0x37, 0x46, 0xE3, 0x7A, 0x21, 0x2E,
+    0x9C, 0x18, 0x2C, 0x07, 0xF1, 0x69, 0x4A, 0x6B, 0x9B, 0x7A, 0xE6, 0xDF, 0xDB, 0x9E, 0xF0, 0x29,
+    0x67, 0x07, 0xEC, 0xCD, 0x2F, 0xFA, 0x2C, 0x9E, 0x61, 0xB4, 0x96, 0x06, 0x84, 0x7C, 0xB1, 0x62,
+    0xBF, 0xFA, 0xDB, 0x28, 0x53, 0x45, 0xD7, 0xDA, 0xC5, 0x32, 0xFE, 0x3A, 0xC6, 0xA9, 0xD5, 0xCC,
+    0x7A, 0x62, 0xB0, 0xAE, 0xDA, 0xA5, 0xB5, 0x6A, 0x53, 0x6B, 0x3B, 0xEB, 0x7D, 0x37, 0xF9, 0x5D,
+    0xBB, 0x5B, 0x42, 0x1B, 0xC4, 0x54, 0x87, 0x43, 0xAC, 0x69, 0x85, 0x62, 0x4D, 0xBE, 0xDA, 0x65,
+    0xB6, 0x9F, 0x12, 0xBB, 0x2B, 0xD5, 0x34, 0x2B, 0x61, 0x61, 0xA1, 0x8D, 0x52, 0xC9, 0x13, 0x13,
+    0x45, 0x75, 0xED, 0x64, 0x32, 0x21, 0x87, 0x66, 0x22, 0x51, 0x60, 0x68, 0x62, 0x91, 0xC4, 0x99,
+    0xDD, 0x22, 0xB2, 0x5A, 0x88, 0xBD, 0x32, 0x1D, 0x6B, 0x86, 0xE8, 0x18, 0xFA, 0x66, 0x31, 0xC7,
+    0x78, 0x56, 0xB1, 0xDB, 0x87, 0x5F, 0x6D, 0xF3, 0xB4, 0x92, 0x11, 0x60, 0x4F, 0x60, 0x05, 0xA7,
+    0x1E, 0xCA, 0x40, 0x6E, 0xA9, 0x44, 0x26, 0xD6, 0xEB, 0xAF, 0x95, 0x66, 0x74, 0xD1, 0x0E, 0xE9,
+    0x33, 0x19, 0xD3, 0x67, 0xB4, 0x72, 0x28, 0x19, 0x08, 0x93, 0xD2, 0x80, 0x5A, 0xC0, 0x11, 0x2B,
+    0xA2, 0x56, 0x00, 0xF1, 0x6C, 0x8E, 0xC2, 0x30, 0xB4, 0x59, 0x11, 0x2E, 0xAC, 0xFC, 0xDA, 0xAF,
+    0x91, 0x4E, 0xEC, 0xD7, 0x71, 0x81, 0xB6, 0x8D, 0xC8, 0x67, 0x11, 0x79, 0x2B, 0x88, 0x13, 0xB1,
+    0x3C, 0xB4, 0xDF, 0x45, 0xBA, 0x0C, 0xA2, 0x98, 0x88, 0xE1, 0xE1, 0x88, 0x60, 0x4A, 0x5C, 0x20,
+    0x7D, 0x26, 0xFA, 0x06, 0x42, 0x55, 0xE1, 0xDF, 0x30, 0x24, 0xCA, 0xAE, 0xAE, 0xAF, 0x2C, 0x94,
+    0xDD, 0x5E, 0x91, 0xC7, 0x3F, 0x17, 0xF5, 0x2B, 0x5E, 0x41, 0x57, 0xFD, 0x24, 0xF6, 0x9D, 0x07,
+    0x5C, 0x12, 0x91, 0x35, 0x22, 0x50, 0xCA, 0xF0, 0x0D, 0x74, 0xFC, 0x15, 0x7A, 0x64, 0xBB, 0x28,
+    0x04, 0x14, 0xF4, 0x9E, 0x8A, 0x05, 0x57, 0x23, 0x3F, 0xAE, 0xCA, 0x51, 0xD3, 0x8C, 0x43, 0x91,
+    0x3A, 0x0D, 0x12, 0xA8, 0x5A, 0xB4, 0xB5, 0xD9, 0x15, 0x82, 0xDD, 0x4B, 0x6B, 0xC6, 0x9A, 0x4A,
+    0x73, 0xF4, 0xD9, 0x3C, 0xFB, 0x20, 0xA3, 0x3A, 0x19, 0x1B, 0xFA, 0x14, 0x88, 0xEA, 0x84, 0xE8,
+    0xD7, 0xD2, 0x6B, 0x0A, 0xC1, 0x7C, 0x99, 0x39, 0x70, 0x69, 0xE2, 0x36, 0x3C, 0xBF, 0x3C, 0x9E,
+    0xD2, 0xBD, 0x33, 0x5F, 0xE9, 0xE6, 0xF7, 0xDE, 0xA3, 0x3A, 0x4E, 0x16, 0x95, 0x7E, 0x82, 0xEA,
+    0x49, 0x07, 0x7C, 0xBD, 0x36, 0x01, 0xEC, 0xBE, 0x7A, 0x04, 0x3C, 0x21, 0x94, 0xD7, 0x99, 0xD1,
+    0xC2, 0xB2, 0xED, 0x15, 0x93, 0x88, 0xAF, 0xE5, 0x39, 0x67, 0xDB, 0x2B, 0xA2, 0x6F, 0xE1, 0x45,
+    0xB9, 0xEF, 0xF1, 0xA9, 0xA9, 0xFE, 0x76, 0x6E, 0x9F, 0x07, 0xA7, 0x78, 0x85, 0x87, 0xB7, 0x79,
+    0xFB, 0xD8, 0xA4, 0xBD, 0xA2, 0x0D, 0x8A, 0xD9, 0xA4, 0x37, 0xA5, 0xD8, 0xD6, 0x24, 0x97, 0xED,
+    0xE2, 0x6A, 0x88, 0xE0, 0xF0, 0xC6, 0x02, 0xF1, 0x07, 0xD7, 0x58, 0x60, 0x08, 0x74, 0x7C, 0xF6,
+    0x3E, 0x8A, 0x76, 0x7D, 0xD5, 0x69, 0xEC, 0x0D, 0x05, 0xCA, 0xD6, 0x02, 0xFD, 0x2D, 0xB9, 0x6F,
+    0x5F, 0x85, 0x7D, 0x15, 0x75, 0x97, 0x3F, 0xDE, 0x5F, 0x46, 0xFF, 0x9C, 0x05, 0x09, 0xCC, 0x66,
+    0xE5, 0x2E, 0x7D, 0x37, 0x5E, 0xA1, 0x69, 0xD5, 0x58, 0xF4, 0x33, 0x64, 0xC4, 0x2D, 0x52, 0x92,
+    0xB6, 0xE5, 0x6B, 0xCC, 0xB1, 0xFF, 0x16, 0x33, 0xDD, 0xFF, 0x9F, 0xB1, 0xB9, 0x8F, 0xEF, 0xA6,
+    0x99, 0x3B, 0x59, 0x5F, 0x1B, 0x5E, 0x46, 0x63, 0xEF, 0x40, 0x18, 0x93, 0xDB, 0xE8, 0x70, 0xDF,
+    0x6B, 0xDF, 0x47, 0xF4, 0x1B, 0x85, 0x7B, 0x3A, 0x32, 0xC3, 0xE1, 0xBC, 0x61, 0x98, 0xD9, 0x45,
+    0x86, 0xB4, 0x03, 0xDC, 0xE8, 0x30, 0xBA, 0xDC, 0xC2, 0x46, 0x6C, 0xC1, 0x7F, 0x2D, 0x78, 0x7D,
+    0x67, 0x67, 0xA8, 0xF6, 0x4F, 0x8B, 0x01, 0x9D, 0x6C, 0x8F, 0x88, 0xF7, 0xD6, 0xB8, 0xF0, 0xCB,
+    0x4E, 0x62, 0x50, 0x80, 0xEC, 0xBA, 0xFD, 0xFE, 0x91, 0xE5, 0xE8, 0x0B, 0x6F, 0x6A, 0x9F, 0x51,
+    0x59, 0x8B, 0xA3, 0x2F, 0xDE, 0xD9, 0x78, 0x24, 0xC8, 0xC2, 0x8A, 0x8C, 0xDF, 0xED, 0xAF, 0xBE,
+    0x1D, 0x59, 0xDE, 0x69, 0x0B, 0x4D, 0xCE, 0xBC, 0x3A, 0xA7, 0xE2, 0x8E, 0xC1, 0xD4, 0xD9, 0xDF,
+    0xAB, 0xDF, 0x4A, 0x95, 0xE0, 0x6A, 0x0B, 0x4D, 0xDB, 0x2C, 0xD2, 0xD3, 0x50, 0x63, 0xA0, 0x9D,
+    0x19, 0xCE, 0xAD, 0xB4, 0xD0, 0xAC, 0xC8, 0x46, 0xFE, 0x7D, 0x5A, 0x68, 0xF6, 0xB6, 0x85, 0xE6,
+    0xFF, 0xD1, 0x16, 0x9A, 0xD6, 0xE0, 0xD6, 0x93, 0xA6, 0x84, 0x1E, 0x6E, 0x70, 0x9B, 0xA5, 0xC1,
+    0xDD, 0x67, 0x6E, 0x27, 0xFB, 0x7A, 0x06, 0x1F, 0x7C, 0x90, 0x69, 0xF7, 0x6C, 0x0F, 0x66, 0x9C,
+    0xDB, 0x10, 0x05, 0xE3, 0x93, 0x1C, 0x7B, 0x3A, 0x48, 0x66, 0x26, 0x26, 0x78, 0x7F, 0x01, 0x21,
+    0x07, 0xAB, 0x71, 0x0D, 0xEC, 0xBE, 0x23, 0xF4, 0x77, 0x90, 0xDF, 0x72, 0xA2, 0x72, 0xBA, 0x44,
+    0xC4, 0x44, 0xFF, 0xCE, 0x6C, 0xED, 0x8F, 0x5D, 0xA6, 0x68, 0xAC, 0x45, 0xB3, 0x40, 0x38, 0xD6,
+    0x79, 0x9F, 0x45, 0xC9, 0x42, 0x66, 0x8D, 0xE5, 0x6C, 0x5D, 0x34, 0x10, 0x15, 0x6B, 0xC9, 0x45,
+    0x73, 0xE3, 0x8B, 0x6E, 0x0B, 0x97, 0xDF, 0x90, 0xE7, 0xAE, 0x9B, 0x3A, 0x54, 0x34, 0x47, 0x31,
+    0x37, 0xC0, 0x51, 0x08, 0xC4, 0xD8, 0x72, 0x57, 0x6A, 0xCF, 0x83, 0xCB, 0xA5, 0xB3, 0x5A, 0x64,
+    0x61, 0x45, 0xA3, 0x35, 0x04, 0x34, 0x78, 0x65, 0xBD, 0x47, 0xA9, 0x39, 0x3C, 0x78, 0xB5, 0xD0,
+    0xF3, 0x89, 0xEE, 0xEA, 0xD5, 0x6B, 0x8B, 0xA1, 0xEB, 0xE7, 0x90, 0xA6, 0x55, 0xAC, 0x7A, 0xF4,
+    0x06, 0x7F, 0x5E, 0x70, 0x1F, 0x83, 0xE0, 0x17, 0xC8, 0xDF, 0xAD, 0x5F, 0xC5, 0xD7, 0xF6, 0xDA,
+    0xA0, 0x5C, 0xF7, 0xCB, 0x4B, 0x41, 0xB1, 0x15, 0x14, 0x67, 0x83, 0xE2, 0x7A, 0x50, 0x7C, 0x2A,
+    0x2C, 0x36, 0xC2, 0xE2, 0x71, 0x4A, 0xC3, 0x89, 0xCB, 0x97, 0x43, 0x8B, 0xB9, 0x8B, 0xB7, 0x39,
+    0xAC, 0x5B, 0x1C, 0x94, 0x9A, 0x75, 0xAD, 0x39, 0xCE, 0xE3, 0x59, 0xBC, 0x2B, 0xC3, 0xA9, 0xE8,
+    0xB4, 0xCE, 0x7A, 0xA6, 0x25, 0xA5, 0xAC, 0x05, 0x3E, 0x72, 0xF1, 0xBE, 0x51, 0x87, 0x61, 0xFB,
+    0x69, 0x67, 0x5C, 0xE7, 0xAB, 0x30, 0x04, 0x81, 0xA9, 0xC5, 0x3E, 0x38, 0x26, 0x10, 0x96, 0xB0,
+    0x50, 0x51, 0x7B, 0xAC, 0x98, 0xDD, 0x22, 0x76, 0x8B, 0xD7, 0x2D, 0x5A, 0xDF, 0x55, 0xFA, 0x58,
+    0xA4, 0xAE, 0xCD, 0xE6, 0xF1, 0x1D, 0x5F, 0xFB, 0xC0, 0xCB, 0x20, 0x4F, 0x34, 0x5A, 0x58, 0x41,
+    0x73, 0xAB, 0xFF, 0x8F, 0x1C, 0x44, 0x32, 0xB3, 0xBD, 0xEC, 0x6D, 0xB2, 0x66, 0x75, 0x48, 0xCE,
+    0xA6, 0xCD, 0xC5, 0x52, 0xB8, 0xA0, 0xD2, 0x61, 0xF0, 0x19, 0x8C, 0x2E, 0xB1, 0x5B, 0x2B, 0x82,
+    0x7F, 0xF5, 0xA4, 0x59, 0xDA, 0x08, 0x3E, 0x0B, 0x29, 0xFC, 0x92, 0x7D, 0x11, 0x67, 0x4B, 0x73,
+    0xAB, 0x66, 0x46, 0xF9, 0x68, 0xC9, 0x2B, 0x96, 0x94, 0xBD, 0xE5, 0xBF, 0xB9, 0x09, 0x47, 0x77,
+    0x83, 0x96, 0x7D, 0xD9, 0xAA, 0x64, 0x58, 0x1E, 0xE8, 0x1F, 0x42, 0x4B, 0x12, 0x63, 0x29, 0x7C,
+    0x7D, 0xA0, 0x2F, 0x43, 0xC1, 0x4C, 0x1D, 0x60, 0xC3, 0xBE, 0x5E, 0x49, 0xFB, 0x6E, 0x9A, 0xBD,
+    0x7E, 0x94, 0xCD, 0x5E, 0xCF, 0xB0, 0xD9, 0xEB, 0x69, 0xC6, 0xCA, 0xD6, 0xD9, 0xEC, 0x75, 0x9D,
+    0xCD, 0x5E, 0xB7, 0x0E, 0x34, 0x7B, 0x55, 0x99, 0x51, 0xD1, 0x7A, 0xAE, 0x68, 0x3B, 0x97, 0xDC,
+    0x20, 0x05, 0x0B, 0x9E, 0x93, 0x43, 0x9B, 0xBD, 0xBE, 0x4D, 0x33, 0x95, 0x6F, 0x7C, 0x5D, 0x1E,
+    0xF8, 0xDA, 0x37, 0x70, 0x40, 0x7B, 0xF7, 0x1F, 0x5C, 0x1B, 0x9A, 0xA9, 0x5C, 0x43, 0x33, 0x15,
+    0x16, 0x3C, 0x1D, 0xC7, 0xF3, 0x4E, 0xDD, 0xA7, 0x99, 0xCA, 0x58, 0xE1, 0xF8, 0xC3, 0xA5, 0xD8,
+    0x3B, 0xD8, 0x33, 0xFA, 0x90, 0x88, 0xC8, 0xB5, 0x85, 0x5A, 0x66, 0x82, 0x10, 0xBA, 0x24, 0xAC,
+    0x87, 0xD8, 0xE0, 0xF8, 0x1A, 0x17, 0xBE, 0x77, 0x70, 0x7C, 0x99, 0x0B, 0x5F, 0x1D, 0x47, 0xCB,
+    0x86, 0xEF, 0x25, 0x43, 0x05, 0x22, 0x5D, 0xF5, 0xB4, 0x6C, 0xC4, 0x9A, 0x39, 0xDA, 0xBF, 0xC9,
+    0x57, 0x6F, 0x75, 0x87, 0xF9, 0x85, 0x6C, 0xBF, 0xBC, 0x51, 0x4B, 0x6A, 0xFD, 0x35, 0xDC, 0x6B,
+    0x28, 0x80, 0x74, 0x50, 0xFE, 0xE8, 0xBC, 0xF5, 0xA0, 0x2E, 0x54, 0xFE, 0x03, 0xEA, 0xAF, 0x9B,
+    0xA1, 0xFE, 0xDA, 0x61, 0xFD, 0x35, 0x05, 0xC5, 0x91, 0x95, 0xCC, 0x28, 0xE6, 0xBF, 0x13, 0x44,
+    0x33, 0x22, 0xC3, 0x04, 0x7A, 0xB2, 0x8C, 0xB6, 0xB3, 0xB4, 0x6F, 0x13, 0xD3, 0x2E, 0xF5, 0x31,
+    0xB7, 0x5D, 0xF1, 0x92, 0xCF, 0xB4, 0xE4, 0x5B, 0x02, 0x85, 0xDD, 0x85, 0xD9, 0x96, 0xCF, 0x0B,
+    0x4F, 0xC7, 0xFD, 0x1E, 0x0C, 0xD9, 0x63, 0x3D, 0xF3, 0xF6, 0x86, 0x30, 0xC3, 0xD0, 0x16, 0xFA,
+    0xB0, 0x93, 0xB5, 0xE6, 0xE0, 0x0B, 0x4F, 0x88, 0xCF, 0x21, 0xB0, 0xBD, 0x85, 0x4D, 0x06, 0xB5,
+    0xAF, 0x2D, 0xB2, 0x81, 0x92, 0x49, 0x45, 0x26, 0x8D, 0x8B, 0x10, 0x95, 0x57, 0xDB, 0x0E, 0x03,
+    0xFF, 0x8B, 0xC7, 0x10, 0x27, 0x8D, 0xC5, 0x80, 0x6C, 0xCF, 0x23, 0x02, 0x7C, 0x3E, 0x2C, 0xC2,
+    0x2A, 0xCE, 0xFF, 0xAA, 0x07, 0x3E, 0x86, 0xB7, 0xE0, 0x4B, 0x2B, 0xFD, 0x08, 0x79, 0x90, 0x29,
+    0x01, 0xCA, 0xCF, 0x0A, 0xED, 0x00, 0xA2, 0x59, 0x1D, 0x2B, 0x5D, 0x3F, 0x1F, 0x75, 0xCA, 0xC4,
+    0x4A, 0x99, 0x60, 0x78, 0xB9, 0xCA, 0xD4, 0xCD, 0xED, 0x95, 0xD3, 0xF8, 0x86, 0xA7, 0x37, 0xF5,
+    0x92, 0xF7, 0x99, 0x86, 0xAC, 0x40, 0x8B, 0xC7, 0xC6, 0x1D, 0x67, 0xC6, 0x9A, 0x95, 0xA5, 0x5B,
+    0xE8, 0x53, 0x66, 0x78, 0x9D, 0xE3, 0x6D, 0xDD, 0x8E, 0xD3, 0x46, 0x0F, 0x63, 0xAF, 0x99, 0x7D,
+    0xD1, 0x5C, 0xFB, 0x3A, 0xC7, 0xA8, 0x58, 0x8D, 0xE6, 0x4E, 0xFA, 0x93, 0x39, 0x2B, 0xAF, 0x73,
+    0x5C, 0xF9, 0xB9, 0x62, 0x13, 0x61, 0xE0, 0xD9, 0xCC, 0x06, 0x38, 0x1E, 0x8E, 0xA1, 0xF8, 0xC1,
+    0x27, 0x30, 0xBC, 0xCF, 0xF0, 0x90, 0x9F, 0x7F, 0x94, 0xAF, 0xCE, 0xD1, 0x01, 0x64, 0x9E, 0x0D,
+    0x8F, 0xF9, 0x56, 0x3B, 0xAE, 0xDB, 0xAD, 0x61, 0xA3, 0x29, 0xBB, 0xC9, 0x01, 0x6A, 0x3D, 0xBA,
+    0xAD, 0x33, 0x1F, 0x72, 0xD0, 0xCA, 0x26, 0x29, 0xF7, 0xDA, 0x7D, 0xF9, 0x58, 0xAF, 0xDB, 0x36,
+    0xD5, 0x94, 0x03, 0x1A, 0xF0, 0x4C, 0x48, 0xA7, 0xE3, 0xAB, 0x32, 0xB6, 0xB4, 0x89, 0xBD, 0xDC,
+    0x2D, 0x4A, 0xA9, 0x06, 0x6F, 0x22, 0x96, 0x20, 0xD0, 0xD0, 0x81, 0x85, 0x1A, 0x76, 0xFF, 0xC7,
+    0xC9, 0xE8, 0xE3, 0x6A, 0x87, 0x37, 0x9F, 0xDA, 0xC8, 0x83, 0xE6, 0xCD, 0xAB, 0x6F, 0x6B, 0xF0,
+    0x6C, 0x3D, 0x39, 0x4D, 0x36, 0x7A, 0xFB, 0x10, 0xD6, 0x9C, 0x1A, 0xAE, 0x34, 0xFE, 0xBD, 0x4D,
+    0x34, 0x2B, 0x73, 0xBA, 0xD1, 0xCB, 0x8B, 0x3A, 0x79, 0xB6, 0x87, 0xD3, 0xEE, 0xAC, 0xDA, 0xA2,
+    0x35, 0xD9, 0x9E, 0xAA, 0xAB, 0x6D, 0x1B, 0xBC, 0xC0, 0x8B, 0x3C, 0xB5, 0xD1, 0x59, 0x09, 0xF7,
+    0xDE, 0x1E, 0xEA, 0x2B, 0xF2, 0xDB, 0x83, 0xCF, 0xA1, 0xD5, 0xF7, 0x7E, 0xFD, 0x90, 0xE6, 0x7D,
+    0xAF, 0x96, 0x3D, 0x97, 0xF0, 0xBA, 0xEA, 0xDF, 0x5A, 0x81, 0x4C, 0x45, 0x3D, 0xEC, 0x6A, 0x1B,
+    0x60, 0x6D, 0x67, 0x2A, 0x42, 0x4B, 0xDF, 0xCE, 0x94, 0x68, 0x13, 0x7F, 0xF5, 0x33, 0x9C, 0x52,
+    0x64, 0x76, 0x46, 0x91, 0xD9, 0xBA, 0x92, 0x6B, 0x4B, 0xC9, 0xA5, 0x1D, 0x89, 0x51, 0x58, 0x9E,
+    0xE8, 0xDB, 0xC2, 0xCC, 0xF0, 0xB2, 0xB0, 0xB3, 0x21, 0xE9, 0x8E, 0xDC, 0xEE, 0x9E, 0x2D, 0x2D,
+    0x64, 0x13, 0xC3, 0x69, 0x9A, 0x0E, 0x49, 0x26, 0x17, 0xA7, 0x36, 0xCA, 0x90, 0x42, 0x57, 0x4C,
+    0xB3, 0xE6, 0xEC, 0x26, 0xDD, 0x9E, 0x24, 0x4F, 0xD2, 0xFB, 0x3B, 0xE3, 0x8B, 0x7D, 0x02, 0x4E,
+    0xEA, 0xE4, 0xB4, 0xE3, 0xA7, 0x3B, 0xED, 0xF8, 0x39, 0x47, 0x8C, 0x91, 0xC9, 0x1B, 0x05, 0xEB,
+    0x60, 0x33, 0x76, 0xFC, 0x64, 0xA8, 0x24, 0xE0, 0x54, 0x38, 0xA1, 0xDF, 0xE7, 0x7C, 0xBA, 0x39,
+    0x7B, 0x65, 0xA3, 0xE7, 0x70, 0x26, 0xCC, 0x64, 0xDF, 0x6F, 0xF0, 0xE2, 0xC4, 0xBD, 0xB0, 0xBE,
+    0xAC, 0x92, 0xB7, 0xEF, 0xE6, 0xAB, 0x86, 0x18, 0xF6, 0x87, 0x2F, 0xA8, 0xA1, 0xE6, 0xD1, 0x92,
+    0xF3, 0x47, 0x17, 0xEF, 0x10, 0x89, 0xCF, 0xAD, 0x67, 0x6D, 0x31, 0x75, 0xEF, 0x5A, 0xFE, 0x37,
+    0xE9, 0x5D, 0x25, 0x8F, 0xD5, 0xD5, 0xEF, 0x3A, 0xB8, 0x91, 0x1C, 0x0C, 0x6E, 0x40, 0x84, 0xB2,
+    0x31, 0x33, 0x0F, 0x0E, 0xDA, 0x42, 0xB8, 0xAB, 0x3D, 0xCE, 0x65, 0xF1, 0x2E, 0x29, 0x3C, 0xE5,
+    0xC7, 0x11, 0xB4, 0x7F, 0x1D, 0xFD, 0xBD, 0x29, 0x10, 0x7E, 0x9E, 0x2B, 0xD0, 0xFE, 0x8C, 0x2B,
+    0x30, 0xBC, 0xF5, 0xA7, 0xCB, 0x6C, 0x14, 0x63, 0xA8, 0x35, 0xC9, 0x56, 0xAD, 0xC6, 0x35, 0x7B,
+    0xBE, 0xB4, 0x5A, 0x2B, 0x34, 0xA4, 0xEB, 0xC2, 0x57, 0xFE, 0xFE, 0x86, 0x95, 0x6E, 0x8C, 0xC1,
+    0xA4, 0x72, 0xD8, 0x99, 0xC1, 0x44, 0x12, 0x7D, 0x08, 0xCC, 0x45, 0x1B, 0x33, 0xB5, 0x2D, 0xCC,
+    0xE2, 0x15, 0xF3, 0x70, 0x6B, 0x25, 0x21, 0xFA, 0xFA, 0xC4, 0x51, 0xF2, 0xAE, 0xCC, 0xC5, 0x60,
+    0x69, 0x2E, 0xEE, 0xEE, 0x33, 0x17, 0x95, 0x81, 0x71, 0xB8, 0xD6, 0x25, 0xDA, 0x76, 0x43, 0x3B,
+    0x57, 0xD4, 0x03, 0x48, 0x24, 0x34, 0x62, 0x8D, 0x91, 0x3F, 0xAE, 0xBC, 0x7D, 0x31, 0x57, 0x3D,
+    0xBC, 0x98, 0xEB, 0x8A, 0x26, 0xED, 0x46, 0xAD, 0xCD, 0xB0, 0x4E, 0x6B, 0xFB, 0x62, 0xAE, 0x9F,
+    0xD6, 0xDA, 0xBF, 0xD3, 0xF9, 0x01, 0x84, 0xDB, 0x37, 0xC5, 0x2C, 0xFC, 0x56, 0xA5, 0x17, 0x3E,
+    0x3C, 0x34, 0x78, 0x43, 0x57, 0xC0, 0x16, 0xF2, 0x9F, 0x9F, 0x9B, 0x33, 0xCC, 0x3C, 0xF9, 0xCC,
+    0xDC, 0x6C, 0xC1, 0x57, 0x11, 0x40, 0xE1, 0x46, 0x7A, 0xE1, 0xB0, 0x9E, 0xE8, 0x94, 0xD3, 0xA2,
+    0xB9, 0x04, 0x98, 0xAE, 0xF5, 0xD1, 0x2D, 0x5D, 0x64, 0x63, 0x1B, 0xD0, 0x73, 0xB8, 0x6E, 0x16,
+    0x67, 0x28, 0x06, 0xE4, 0x62, 0x8B, 0x93, 0xDB, 0x82, 0x3B, 0xAD, 0x65, 0xED, 0x73, 0x5A, 0x71,
+    0xA6, 0x08, 0x3E, 0x71, 0xB6, 0xB5, 0xF6, 0x7A, 0x37, 0x27, 0x16, 0x40, 0x03, 0xDD, 0x15, 0xE1,
+    0xF0, 0xE2, 0xDC, 0x04, 0x1F, 0xBA, 0x07, 0x72, 0x80, 0xC6, 0x1C, 0xA8, 0xB1, 0xC6, 0x6F, 0x48,
+    0xFD, 0x1D, 0x4A, 0xB4, 0x35, 0x93, 0xD6, 0xED, 0xD5, 0xA1, 0x83, 0xFE, 0xCB, 0xCC, 0x2F, 0x47,
+    0xAB, 0x7F, 0x3A, 0x76, 0x6A, 0x4D, 0xE0, 0x8F, 0x6B, 0x75, 0xF6, 0xFF, 0x41, 0xAD, 0xEF, 0x48,
+    0xFD, 0x1F, 0xB5, 0x79, 0x13, 0x5F, 0xFC, 0xC9, 0xDC, 0xF9, 0x1E, 0xD2, 0x82, 0xFF, 0x72, 0x8E,
+    0x57, 0x95, 0x19, 0xEF, 0x1B, 0x4D, 0x40, 0x9D, 0xF0, 0x72, 0x4B, 0x1F, 0x96, 0x9F, 0xB4, 0x97,
+    0x08, 0x79, 0x4D, 0x5B, 0xE3, 0x7C, 0x46, 0x88, 0x2C, 0x4B, 0x2C, 0x5A, 0x21, 0xC7, 0x52, 0x77,
+    0x73, 0xF6, 0xF6, 0x4F, 0x7A, 0xA0, 0xAB, 0xA0, 0x2F, 0x52, 0xE4, 0x9F, 0x7A, 0x43, 0x24, 0xF8,
+    0x05, 0xB3, 0x5A, 0x1E, 0xB6, 0x3F, 0x6B, 0x79, 0xBE, 0x9A, 0xB5, 0xCC, 0xEE, 0x97, 0x3F, 0x1F,
+    0x18, 0xCE, 0xD6, 0x56, 0x72, 0x7F, 0x30, 0xF4, 0x82, 0x5B, 0xD7, 0x6E, 0x85, 0xDB, 0x07, 0xEB,
+    0x11, 0xE6, 0x4B, 0x6B, 0x5C, 0xBD, 0x88, 0x81, 0xBE, 0x90, 0x6E, 0xFA, 0xA6, 0x59, 0x36, 0xE0,
+    0xB7, 0x6F, 0x9A, 0xDD, 0x25, 0x40, 0xA0, 0x73, 0x8D, 0xC3, 0x38, 0xC7, 0x01, 0x6D, 0x2D, 0xDF,
+    0x34, 0xEB, 0xEE, 0x5D, 0xCD, 0x33, 0xFB, 0xA6, 0x6A, 0xBC, 0x69, 0xB6, 0x40, 0x88, 0x5C, 0xDF,
+    0x34, 0x1B, 0xE8, 0x9B, 0x66, 0x4B, 0x33, 0xBE, 0x69, 0x36, 0x58, 0x7D, 0xD3, 0x2C, 0x45, 0x9B,
+    0x39, 0x86, 0x12, 0x98, 0x93, 0x98, 0xF5, 0x4D, 0x9B, 0x6F, 0xE0, 0xEE, 0xED, 0x2B, 0x80, 0xE8,
+    0xFF, 0x52, 0xC0, 0xD2, 0x77, 0xFA, 0x4C, 0x3B, 0xE5, 0x34, 0x43, 0x22, 0x77, 0x80, 0xAA, 0xB7,
+    0x10, 0xEF, 0x27, 0x88, 0xF4, 0xFD, 0x03, 0x4C, 0xE6, 0xD3, 0xFE, 0xD3, 0x8D, 0xE6, 0xEC, 0xE5,
+    0xEA, 0x35, 0x38, 0x81, 0xC3, 0xAF, 0x21, 0xCC, 0xF0, 0xFD, 0xFA, 0xF1, 0xA8, 0xFF, 0x7C, 0x5F,
+    0xFB, 0x0B, 0xF8, 0x7E, 0x37, 0xB4, 0x1C, 0xEE, 0x0C, 0xC1, 0x68, 0xAC, 0xE2, 0x9C, 0xC7, 0x33,
+    0x6E, 0x75, 0x78, 0x41, 0xC7, 0x23, 0x45, 0x40, 0x34, 0xAF, 0x64, 0xE7, 0x4A, 0x39, 0xB0, 0xA5,
+    0xCD, 0xCD, 0x03, 0x03, 0x7E, 0xDF, 0x69, 0x37, 0xF4, 0x30, 0x41, 0xEB, 0x3F, 0xBD, 0x30, 0xEB,
+    0xD6, 0x5A, 0x33, 0xFF, 0xB3, 0xB5, 0x52, 0xE0, 0x47, 0xF6, 0x42, 0x76, 0xA4, 0xFA, 0x8C, 0x21,
+    0x9F, 0x74, 0x3B, 0x0D, 0x91, 0x9B, 0x75, 0x2B, 0xF7, 0xCD, 0xDC, 0x1F, 0x50, 0xA2, 0xBE, 0x99,
+    0x55, 0xB4, 0x91, 0xBE, 0xBA, 0x03, 0x48, 0xEE, 0x3B, 0xFC, 0x97, 0x73, 0x83, 0x06, 0xD8, 0xBD,
+    0xAA, 0x7E, 0xD9, 0xA1, 0x4A, 0x6E, 0x7C, 0x87, 0x2D, 0xB2, 0x2C, 0xE3, 0x21, 0x63, 0x23, 0x25,
+    0xAE, 0x5B, 0xA7, 0x46, 0x3A, 0x3D, 0x40, 0x9D, 0x75, 0x68, 0x57, 0x78, 0x57, 0x1B, 0x23, 0x34,
+    0x3D, 0xD1, 0x5D, 0xBD, 0x36, 0x37, 0xFA, 0x66, 0x94, 0xC9, 0xD6, 0x12, 0x93, 0x14, 0xE5, 0x49,
+    0xF1, 0x57, 0xEE, 0x2D, 0x52, 0xD0, 0x2A, 0xAE, 0x65, 0x1D, 0xF0, 0x3A, 0x09, 0xF4, 0x7C, 0x65,
+    0x2A, 0x8E, 0x7D, 0x11, 0x06, 0xB3, 0xF3, 0x59, 0x97, 0x89, 0x6E, 0x23, 0x71, 0xE2, 0x2C, 0x5E,
+    0x64, 0x02, 0x23, 0xDF, 0x5E, 0x63, 0xBC, 0x7B, 0xC9, 0x98, 0xD2, 0xA4, 0x2F, 0xB7, 0xC1, 0x0A,
+    0xA8, 0x4B, 0xFA, 0x64, 0x6B, 0x3E, 0x2A, 0x9A, 0xEC, 0x62, 0x0F, 0xB0, 0xDD, 0x57, 0xF0, 0xF1,
+    0xCF, 0xE0, 0x12, 0x28, 0x59, 0xAA, 0xF9, 0xC4, 0xA4, 0x8C, 0xF6, 0x18, 0xC1, 0xF2, 0x71, 0x7A,
+    0x2D, 0xB6, 0x8C, 0x7D, 0x91, 0xE3, 0x32, 0x63, 0x70, 0x52, 0x2B, 0xB2, 0x7C, 0x31, 0xAE, 0xA3,
+    0x4B, 0xC1, 0xD8, 0x8E, 0xC3, 0x45, 0x38, 0xF8, 0x62, 0xDC, 0xD9, 0xEA, 0x8B, 0x71, 0x93, 0xC3,
+    0x5E, 0x8C, 0xFB, 0x80, 0x14, 0xF3, 0x5F, 0x38, 0xEC, 0xC5, 0xB8, 0x42, 0xCE, 0xF1, 0xC5, 0xB8,
+    0xF2, 0xF3, 0x4F, 0xCD, 0x2F, 0x0A, 0x8A, 0xF8, 0x94, 0x49, 0x9F, 0xAD, 0x58, 0x23, 0xE6, 0x37,
+    0xD3, 0x02, 0x61, 0x74, 0xB5, 0xB5, 0x6D, 0x56, 0x11, 0x4D, 0xAF, 0xD9, 0x78, 0x7B, 0x1E, 0xD9,
+    0xF8, 0x79, 0xFC, 0x95, 0x8E, 0xAF, 0x7B, 0xCC, 0x37, 0xDE, 0x26, 0x42, 0x7B, 0x74, 0xC2, 0xF4,
+    0x36, 0x72, 0x8E, 0x0A, 0x58, 0xF8, 0x16, 0x65, 0xCD, 0xE1, 0x8A, 0xCD, 0x86, 0xD8, 0x6B, 0x3F,
+    0xC9, 0x18, 0x4F, 0xCD, 0x21, 0xF5, 0x82, 0xCE, 0x26, 0x5C, 0x40, 0x9B, 0xFD, 0xD5, 0x9E, 0xC1,
+    0x9B, 0x0E, 0x61, 0x65, 0xA1, 0xA5, 0x20, 0x0E, 0x84, 0xFD, 0x19, 0xF0, 0xD6, 0x97, 0x4D, 0xEA,
+    0xFB, 0x07, 0xBB, 0x21, 0x47, 0x1B, 0xD6, 0x0F, 0x0A, 0x44, 0x4D, 0xF4, 0x7F, 0x73, 0xA4, 0x0E,
+    0x68, 0x37, 0xCC, 0xE5, 0xC8, 0xD0, 0x16, 0x58, 0x86, 0xE5, 0x95, 0x61, 0xED, 0x0D, 0x09, 0x11,
+    0x9A, 0xE3, 0xC6, 0x36, 0x47, 0x22, 0xDB, 0x5B, 0xD3, 0xFF, 0x71, 0x33, 0x9B, 0x7B, 0xF3, 0xB0,
+    0xD4, 0x77, 0x8C, 0xA0, 0x75, 0x71, 0xCA, 0x86, 0x21, 0xB2, 0x83, 0xFF, 0x0A, 0x6F, 0x2B, 0xC8,
+    0x6C, 0x1A, 0xC0, 0x27, 0xB9, 0xA7, 0x76, 0x15, 0x75, 0xF2, 0x78, 0xC9, 0x3B, 0xB4, 0x6A, 0xED,
+    0xD1, 0xA4, 0x87, 0x8F, 0xAE, 0x27, 0x2F, 0xB7, 0xFC, 0x0D, 0xCD, 0x6A, 0xC3, 0x89, 0x87, 0x4A,
+    0x27, 0xE0, 0xED, 0x4F, 0x0E, 0x18, 0xA4, 0xDC, 0x1D, 0xAF, 0x86, 0x9D, 0xE3, 0x67, 0x97, 0xDE,
+    0xBE, 0x66, 0xEC, 0x1F, 0x9F, 0x8F, 0x6A, 0x96, 0x9D, 0xB1, 0x84, 0xCA, 0x57, 0x48, 0x37, 0x1B,
+    0xF2, 0xEE, 0x0F, 0xF9, 0x79, 0x84, 0x5F, 0xEB, 0x72, 0xC5, 0x47, 0xEF, 0x40, 0xC4, 0x17, 0x70,
+    0x70, 0xEA, 0x20, 0x39, 0xB8, 0x4D, 0x3E, 0xC0, 0x97, 0x59, 0x9F, 0x12, 0xBB, 0x24, 0xFE, 0x74,
+    0xC3, 0xDF, 0x35, 0xA7, 0xDE, 0x27, 0xD1, 0x1F, 0xDA, 0xEB, 0x68, 0xB4, 0x02, 0x00, 0x6F, 0xA1,
+    0x82, 0x3C, 0x40, 0x86, 0xB3, 0x88, 0x8C, 0xB3, 0x60, 0xDF, 0xC7, 0x69, 0x7D, 0xF2, 0xC9, 0x04,
+    0x91, 0x6B, 0x83, 0x0F, 0x84, 0xDA, 0x8B, 0x2D, 0x28, 0x9C, 0xE7, 0x7B, 0x33, 0xC4, 0x55, 0xC2,
+    0x62, 0xA0, 0x43, 0x80, 0x24, 0xFB, 0x00, 0xAF, 0xFA, 0x0A, 0xC1, 0x9E, 0x9A, 0x64, 0x9F, 0xA4,
+    0x70, 0x77, 0x85, 0x48, 0xB2, 0xB7, 0x93, 0xDC, 0xD0, 0xA2, 0x9E, 0x56, 0x3D, 0x7A, 0x01, 0xB4,
+    0xD3, 0x29, 0x3C, 0xE9, 0x34, 0x54, 0xF4, 0x13, 0xFB, 0x1E, 0x1E, 0x0E, 0xD6, 0x30, 0x5B, 0xCD,
+    0xD3, 0x9B, 0x68, 0x4E, 0xB4, 0x63, 0x84, 0x29, 0x1D, 0xF5, 0xD0, 0xA4, 0xF8, 0x8A, 0xCC, 0x94,
+    0xFC, 0x12, 0xFE, 0xFA, 0x92, 0x61, 0x8F, 0x3C, 0xC0, 0x99, 0x0C, 0xEF, 0xD3, 0xDA, 0x13, 0x88,
+    0xE5, 0xF6, 0xCD, 0xBE, 0x86, 0x36, 0xAD, 0x3D, 0x37, 0x87, 0x36, 0x66, 0xF9, 0xB0, 0xBF, 0x5B,
+    0x5C, 0x7B, 0x5F, 0x18, 0xED, 0xFF, 0xFE, 0xBE, 0x16, 0x49, 0xA2, 0xDB, 0xAE, 0x10, 0xD8, 0xBE,
+    0xDB, 0xEB, 0xB8, 0x15, 0xE5, 0x10, 0xEB, 0x7C, 0xE2, 0x1F, 0xB6, 0x16, 0x88, 0xCD, 0x1F, 0x20,
+    0x5E, 0x3F, 0xEC, 0xF4, 0x76, 0x4B, 0xBA, 0x7D, 0x19, 0xAC, 0x04, 0xAA, 0x2F, 0xD7, 0xF6, 0xCF,
+    0xF0, 0x7D, 0xA7, 0xBC, 0xCA, 0x6B, 0x95, 0xD6, 0x2A, 0xAB, 0xEF, 0x27, 0xA9, 0xDF, 0x53, 0x6F,
+    0x30, 0x38, 0x1C, 0x1A, 0xBE, 0x3E, 0xBB, 0x81, 0xC2, 0x99, 0xCD, 0xE9, 0x4C, 0x9B, 0xEB, 0x4B,
+    0xEA, 0x1E, 0x42, 0x6F, 0xB0, 0x59, 0x76, 0xD6, 0xE8, 0x7B, 0x09, 0x28, 0xE0, 0xFD, 0x6C, 0xEB,
+    0x10, 0x1D, 0x5C, 0x1D, 0xE8, 0x1C, 0x56, 0x59, 0x17, 0x8D, 0xED, 0x1C, 0x96, 0xE1, 0x90, 0x0C,
+    0xAF, 0x3B, 0x63, 0x7D, 0xEC, 0xFE, 0xCE, 0x61, 0xCC, 0x2C, 0x2A, 0x0E, 0x76, 0x0E, 0x7B, 0x08,
+    0xD4, 0xF9, 0xCE, 0x85, 0x0B, 0xBF, 0xD9, 0x30, 0xF1, 0x75, 0x1E, 0xDF, 0xBD, 0x2A, 0x26, 0xC5,
+    0x43, 0xA3, 0xCE, 0xBB, 0x9A, 0x3F, 0xAC, 0xA1, 0xF4, 0xEA, 0xD5, 0xFC, 0xDD, 0xCE, 0xFF, 0xE7,
+    0xC2, 0x41, 0xEF, 0x1F, 0x8D, 0x1E, 0x22, 0x07, 0xBD, 0x57, 0x0A, 0xBE, 0x3D, 0xC8, 0xF8, 0x40,
+    0xDF, 0xB7, 0xF9, 0x40, 0x90, 0xF1, 0xD0, 0xDF, 0x58, 0x62, 0xD4, 0x94, 0x1E, 0x1B, 0x00, 0x8C,
+    0x8A, 0xF7, 0x11, 0x7D, 0xF3, 0xF7, 0x30, 0xE8, 0xEA, 0x90, 0x41, 0xFB, 0x0B, 0x66, 0xAB, 0xD3,
+    0xF0, 0xB1, 0x36, 0x7C, 0x4A, 0x6F, 0xA5, 0xB6, 0x66, 0x8D, 0x32, 0x50, 0x53, 0xA4, 0xBA, 0xBA,
+    0x6A, 0xE0, 0xCC, 0x63, 0x15, 0xEB, 0xAC, 0xF6, 0x59, 0x9B, 0x15, 0x18, 0xAD, 0x91, 0x05, 0xF5,
+    0xD6, 0xE9, 0x34, 0xA6, 0x92, 0x5C, 0x54, 0xCB, 0xDC, 0xB2, 0x74, 0x62, 0x56, 0xAB, 0x3D, 0x32,
+    0x5F, 0x86, 0x9E, 0x82, 0x62, 0x84, 0x3D, 0xCC, 0xB8, 0x8C, 0x39, 0xC8, 0xA1, 0x0B, 0xDA, 0x3B,
+    0x35, 0x04, 0x1F, 0x55, 0xCA, 0x3B, 0x15, 0xE2, 0xBF, 0xDA, 0x0E, 0x0B, 0x6F, 0xEF, 0x61, 0x76,
+    0xD3, 0x7D, 0xDA, 0xB7, 0x3C, 0xBA, 0xAB, 0x60, 0xBE, 0xF6, 0x58, 0x66, 0xB4, 0x8B, 0x99, 0x00,
+    0xF3, 0x6D, 0x7A, 0x6B, 0x40, 0x89, 0x73, 0xA4, 0xC1, 0x75, 0xFF, 0xC3, 0xB1, 0x16, 0xC6, 0xBD,
+    0xF2, 0xB4, 0xC6, 0x5F, 0x68, 0xCB, 0x68, 0x07, 0x45, 0x73, 0x5E, 0x09, 0x30, 0xA7, 0x3C, 0x73,
+    0xCA, 0x93, 0xF7, 0x59, 0x99, 0x61, 0x69, 0x96, 0x5E, 0x2E, 0x47, 0x5F, 0xBB, 0x4E, 0xBF, 0xA9,
+    0x2E, 0x8F, 0x5D, 0x1F, 0xBB, 0x40, 0x76, 0x85, 0xEC, 0x12, 0xD9, 0x35, 0xB2, 0x8B, 0x64, 0x57,
+    0x69, 0x58, 0x26, 0xBB, 0x4E, 0x43, 0x2A, 0xA6, 0xAE, 0xD4, 0x10, 0xE9, 0xB1, 0x16, 0xFC, 0x7C,
+    0xDA, 0xDC, 0xC6, 0x46, 0x8B, 0xD4, 0x89, 0xA1, 0x89, 0xCA, 0xBA, 0x62, 0xCB, 0x25, 0x3B, 0x3D,
+    0xD9, 0x39, 0xBB, 0x0F, 0xD8, 0x39, 0x8F, 0xDC, 0x1B, 0xDC, 0xA7, 0xAE, 0xDF, 0xC5, 0xA1, 0xAE,
+    0xDF, 0xF7, 0xF9, 0x25, 0x6A, 0x0F, 0xA3, 0x13, 0xC2, 0x43, 0xED, 0x64, 0xE1, 0x4F, 0xFA, 0xE4,
+    0xDA, 0x44, 0x83, 0x7A, 0x92, 0x11, 0x5D, 0x8E, 0x75, 0xC8, 0x6F, 0xDB, 0xFD, 0xE0, 0xB0, 0x57,
+    0xE2, 0x94, 0xCB, 0x10, 0x4D, 0xB0, 0x67, 0x1B, 0x31, 0xF9, 0x36, 0x8E, 0x77, 0xCA, 0x86, 0x83,
+    0x76, 0xF4, 0xF1, 0xA0, 0xC7, 0x6F, 0x59, 0xBD, 0x7F, 0xDD, 0x56, 0xFB, 0xBB, 0xB6, 0xE5, 0xDF,
+    0xF2, 0xC2, 0xA9, 0xFD, 0xE4, 0xC1, 0x1E, 0xA7, 0x7F, 0xA8, 0xAF, 0x3B, 0x57, 0xDE, 0x55, 0x8C,
+    0xA6, 0xDC, 0x2B, 0xFF, 0x72, 0xF3, 0xB0, 0x4D, 0xF7, 0x73, 0x7F, 0x0D, 0xDC, 0xA3, 0xD6, 0xB6,
+    0x64, 0xB5, 0x66, 0x87, 0x4F, 0xD1, 0x56, 0x17, 0x8A, 0x4E, 0x34, 0x9D, 0xE0, 0x97, 0xCD, 0xCF,
+    0xDA, 0xE0, 0x64, 0xCA, 0xD4, 0xC1, 0x2A, 0x53, 0x23, 0x16, 0x1D, 0xCD, 0x6D, 0x17, 0xCF, 0x47,
+    0xB3, 0x46, 0xA2, 0xB3, 0x35, 0x12, 0x5F, 0x9A, 0xD6, 0x48, 0x0C, 0xFE, 0xE4, 0xEB, 0xD3, 0xC4,
+    0xA3, 0x4F, 0x57, 0x8A, 0xC0, 0x6D, 0xCC, 0x48, 0xDD, 0x24, 0x9F, 0x33, 0xEF, 0x5F, 0x8D, 0x44,
+    0xB9, 0x52, 0x23, 0x81, 0x83, 0xE3, 0x67, 0x36, 0x55, 0x9C, 0x05, 0x5A, 0xCE, 0x95, 0x77, 0x49,
+    0xD5, 0xF3, 0x87, 0x51, 0x15, 0x37, 0x3F, 0xFA, 0x7C, 0x7F, 0x61, 0x63, 0x08, 0xFE, 0x98, 0x27,
+    0xF5, 0xFF, 0x46, 0xAA, 0xC6, 0xEF, 0x99, 0xAA, 0x97, 0x95, 0xAA, 0x35, 0x89, 0xB4, 0x78, 0x30,
+    0x91, 0x9C, 0xAB, 0xFD, 0xDD, 0x2B, 0x56, 0xB9, 0xBD, 0x0D, 0x91, 0x9A, 0x49, 0x21, 0xC9, 0xFF,
+    0x07, 0xDD, 0x9B, 0xBF, 0x6F, 0x1C, 0xD7, 0x11, 0xC7, 0x67, 0x77, 0x49, 0xAE, 0xA1, 0x43, 0xB4,
+    0x34, 0xA0, 0x00, 0x86, 0x65, 0xEB, 0x1A, 0x17, 0x86, 0x6D, 0x69, 0x9B, 0x20, 0x51, 0x41, 0x79,
+    0xD7, 0x72, 0xE9, 0x86, 0x85, 0x52, 0xBB, 0x0E, 0x90, 0x58, 0x29, 0x5C, 0x28, 0x80, 0xE3, 0x5B,
+    0xDB, 0x7F, 0x40, 0x58, 0x25, 0x40, 0x52, 0x44, 0x45, 0x8A, 0xC4, 0x29, 0xEC, 0x42, 0x85, 0x0C,
+    0xC8, 0xBC, 0x15, 0x54, 0xA6, 0x39, 0x0B, 0x08, 0x5C, 0xA4, 0x39, 0x39, 0xFE, 0x01, 0x44, 0x40,
+    0xBC, 0x09, 0x4E, 0x08, 0xE5, 0xDC, 0xDD, 0x66, 0xBE, 0xDF, 0x99, 0xBD, 0x5D, 0x52, 0x72, 0x82,
+    0x04, 0x16, 0xEF, 0x2E, 0x0B, 0x72, 0x48, 0x1E, 0xF7, 0xF6, 0xBD, 0xF7, 0xF9, 0xCE, 0x9B, 0x37,
+    0xEF, 0xC7, 0x89, 0x48, 0x30, 0x11, 0xBD, 0xA2, 0x03, 0xD8, 0x1E, 0x6D, 0x32, 0x85, 0xBD, 0x40,
+    0x7B, 0x85, 0xB6, 0x9A, 0xA9, 0x09, 0xC7, 0xB0, 0x51, 0xB9, 0x8F, 0x1B, 0xF3, 0xA1, 0xDA, 0xBE,
+    0x0C, 0x70, 0xA3, 0x64, 0xB8, 0x91, 0xB6, 0x92, 0x2C, 0x97, 0xF0, 0xAB, 0x77, 0x87, 0x85, 0x44,
+    0x75, 0x5D, 0x17, 0x92, 0xE4, 0x92, 0x96, 0x7A, 0xA3, 0xF4, 0x4B, 0xD9, 0xD1, 0x47, 0x97, 0x72,
+    0x5D, 0xED, 0x48, 0x6F, 0x54, 0x1B, 0xC1, 0x8E, 0x5F, 0xBD, 0x2F, 0xC1, 0xF0, 0x7E, 0x5D, 0xE7,
+    0x71, 0x3D, 0x17, 0xBF, 0x02, 0x5A, 0x7D, 0x8F, 0x5E, 0x69, 0xC7, 0x9E, 0xC8, 0x9B, 0x3B, 0xC2,
+    0xFA, 0x76, 0x21, 0xE9, 0x1F, 0xB5, 0x88, 0x7D, 0x2D, 0x33, 0x3C, 0xD0, 0xE2, 0xE3, 0x4A, 0xEB,
+    0xA3, 0xCF, 0xDE, 0xC7, 0x1B, 0x67, 0x92, 0x16, 0x32, 0x45, 0x75, 0xA6, 0xFA, 0x6A, 0x00, 0xA3,
+    0x6D, 0x1C, 0x4A, 0x34, 0x51, 0xD3, 0xC3, 0x9D, 0xA7, 0x61, 0xBE, 0xA7, 0x35, 0x7E, 0xEB, 0xCF,
+    0xD5, 0x76, 0x5A, 0xBF, 0x53, 0x57, 0xBD, 0x59, 0x58, 0xE7, 0xB2, 0x2B, 0xDB, 0x22, 0x1B, 0x28,
+    0x23, 0x43, 0x69, 0x83, 0x02, 0x06, 0xBF, 0x9D, 0xF3, 0xA2, 0xF7, 0xF1, 0x47, 0x54, 0x8F, 0x61,
+    0x2F, 0x56, 0xAC, 0x0C, 0xED, 0xE9, 0x11, 0xFF, 0xCB, 0x7B, 0xF8, 0x82, 0x8C, 0x65, 0x71, 0xAD,
+    0x18, 0xE6, 0x00, 0x6D, 0xC8, 0x50, 0x8F, 0x0F, 0x3E, 0x54, 0x93, 0x5F, 0x40, 0xF9, 0x6F, 0xA0,
+    0x56, 0x13, 0x96, 0xA8, 0xD7, 0xD3, 0x30, 0x1B, 0xC7, 0xC4, 0x9B, 0xD7, 0x6F, 0xAD, 0x24, 0x92,
+    0xBA, 0x14, 0x43, 0xF0, 0xA0, 0x3E, 0x83, 0x3F, 0xE2, 0x9A, 0xBA, 0xF7, 0x5F, 0xA1, 0x13, 0x5C,
+    0x0F, 0xC8, 0x35, 0x97, 0xEE, 0x65, 0x7C, 0x1D, 0xB0, 0x13, 0x76, 0xC4, 0xCE, 0xD8, 0x21, 0x1B,
+    0x65, 0xC7, 0xEC, 0x9C, 0x1D, 0xB4, 0x93, 0x76, 0xD4, 0xCE, 0xDA, 0x60, 0x3B, 0x6D, 0xC7, 0xED,
+    0xBC, 0x1D, 0xB8, 0x13, 0x77, 0xE4, 0xC6, 0x5C, 0x0C, 0xBA, 0x18, 0x75, 0x39, 0xEC, 0xDD, 0x70,
+    0x67, 0xD6, 0xFE, 0xA7, 0x28, 0xF3, 0x26, 0x7C, 0x65, 0xF0, 0x89, 0xBE, 0x10, 0xDC, 0xC7, 0xAF,
+    0xF1, 0x08, 0x3A, 0x9C, 0x34, 0xFE, 0x9D, 0x8B, 0x0A, 0x98, 0x04, 0xD4, 0x40, 0x28, 0x82, 0xA9,
+    0x60, 0x32, 0x98, 0x0E, 0x26, 0x84, 0x29, 0x61, 0x52, 0x98, 0x16, 0x26, 0x86, 0xA9, 0x61, 0x72,
+    0x98, 0x1E, 0x26, 0x88, 0x50, 0x11, 0x31, 0x49, 0x1A, 0x4D, 0x9E, 0x34, 0x8A, 0xB9, 0x91, 0xBA,
+    0x04, 0xCC, 0x77, 0xEA, 0x56, 0x10, 0xD3, 0xC3, 0xE4, 0xC8, 0x65, 0x65, 0x7D, 0x7D, 0xD1, 0x41,
+    0x59, 0xAD, 0x1D, 0x28, 0xF6, 0xD8, 0x60, 0xEC, 0xB8, 0x49, 0xFB, 0x08, 0xEC, 0xE3, 0xF0, 0x75,
+    0xBB, 0x32, 0x3A, 0xB4, 0x3C, 0x6E, 0x81, 0x22, 0x60, 0x00, 0xB9, 0xD4, 0x2F, 0xE8, 0xF9, 0x4F,
+    0xFD, 0x9F, 0x79, 0x7E, 0x78, 0x15, 0xC5, 0xDD, 0xC0, 0xAF, 0x2F, 0x78, 0xB4, 0xE9, 0xDF, 0xD2,
+    0x77, 0x0D, 0xEE, 0x2C, 0x53, 0x8A, 0x70, 0x72, 0x02, 0xB8, 0xEA, 0x1F, 0xA9, 0x3D, 0x3B, 0x00,
+    0xBC, 0x67, 0xB6, 0xF6, 0x28, 0x03, 0xD9, 0xAE, 0x9F, 0xB7, 0x9F, 0x42, 0xE5, 0xEA, 0xB7, 0x4A,
+    0x89, 0xBE, 0xD4, 0xB7, 0xC7, 0xC1, 0x22, 0xEA, 0x70, 0x34, 0x5D, 0xB2, 0xDF, 0xFF, 0xE0, 0x28,
+    0xD4, 0xE4, 0x67, 0xA8, 0xD5, 0x85, 0x08, 0x9E, 0x7F, 0x55, 0xAE, 0x1E, 0x09, 0x79, 0x6B, 0x98,
+    0x9B, 0x9C, 0x40, 0xE7, 0x4D, 0xE1, 0x23, 0xC3, 0x0A, 0xDE, 0xA5, 0x2D, 0x88, 0xCB, 0x63, 0x47,
+    0xCD, 0x3A, 0xA2, 0x67, 0x5A, 0xDD, 0x68, 0x7A, 0xEE, 0xB4, 0xC1, 0x6F, 0x08, 0x75, 0xDC, 0x86,
+    0xF6, 0x1D, 0x33, 0xAF, 0x23, 0xC7, 0x09, 0x2A, 0x76, 0x87, 0x92, 0x0A, 0xF1, 0xFE, 0xED, 0x15,
+    0xD7, 0x83, 0xA1, 0xEA, 0x06, 0x0B, 0xD5, 0xEF, 0x8B, 0x17, 0x51, 0x6E, 0x82, 0xB0, 0x85, 0xC4,
+    0xA6, 0x46, 0x2D, 0xD3, 0xE2, 0x58, 0xBD, 0x7C, 0xAB, 0x68, 0x01, 0x7B, 0x22, 0x78, 0x7E, 0x9D,
+    0x09, 0x23, 0x1D, 0xB1, 0xE4, 0x17, 0x2E, 0xB4, 0x0A, 0x84, 0xE5, 0x35, 0xDA, 0xBB, 0xA5, 0x0D,
+    0x64, 0x4C, 0xBE, 0xF3, 0x96, 0xF3, 0xF6, 0xFA, 0x71, 0xCE, 0x9B, 0xD4, 0x7B, 0x63, 0xA7, 0x69,
+    0x07, 0x1C, 0x28, 0x7C, 0x39, 0x5C, 0x3A, 0xEC, 0x43, 0x23, 0xE4, 0xE5, 0xCE, 0x08, 0x29, 0x6B,
+    0xEA, 0xD4, 0xA7, 0xB4, 0x65, 0x32, 0x2C, 0x47, 0x12, 0x7E, 0xA9, 0x15, 0x8E, 0x5E, 0xAA, 0x1B,
+    0x92, 0xF9, 0xF2, 0x61, 0x3F, 0x23, 0xDF, 0x21, 0x54, 0xE0, 0xEC, 0xFF, 0x7E, 0x4C, 0xA8, 0x4C,
+    0x07, 0x3F, 0x90, 0x75, 0x18, 0x1B, 0x3D, 0xD3, 0x28, 0xDA, 0xDC, 0xD6, 0x6C, 0xBF, 0x4D, 0x98,
+    0x62, 0x51, 0x77, 0x8A, 0x73, 0x9D, 0xD7, 0x45, 0x7F, 0x99, 0x22, 0x19, 0x40, 0x53, 0x5F, 0xCB,
+    0x8F, 0x3B, 0xFF, 0xC6, 0xD4, 0x4B, 0xEA, 0x85, 0xF9, 0xB0, 0x9D, 0x99, 0x69, 0xFB, 0x2B, 0x79,
+    0x9E, 0x36, 0x98, 0xB1, 0x17, 0x4E, 0x31, 0xB4, 0x68, 0x31, 0xA1, 0xBA, 0x8C, 0xDA, 0xD2, 0xA9,
+    0x47, 0x54, 0x20, 0xAE, 0x5A, 0xDB, 0xBB, 0xF7, 0xFD, 0x1C, 0x8A, 0x61, 0x6D, 0x20, 0xF9, 0x0C,
+    0xBF, 0x1F, 0x4A, 0x13, 0x8A, 0xC5, 0xA2, 0x82, 0x0D, 0x5A, 0x90, 0xE1, 0x5B, 0x98, 0x91, 0xC9,
+    0x59, 0x91, 0x39, 0xC7, 0xE1, 0x19, 0x4A, 0x3B, 0x3D, 0x7F, 0xF7, 0x3D, 0x6D, 0x8F, 0x56, 0x61,
+    0x72, 0x64, 0x0A, 0x58, 0xB5, 0x9A, 0xBB, 0xAD, 0x0E, 0xDF, 0xB1, 0x55, 0x8F, 0x24, 0xFD, 0x55,
+    0x25, 0xD3, 0xE8, 0x20, 0x9A, 0x84, 0xD3, 0x5E, 0x15, 0x1E, 0xA8, 0x5E, 0x93, 0xB4, 0xEC, 0x55,
+    0x59, 0x91, 0x96, 0xD9, 0xCF, 0xE7, 0x32, 0xD0, 0xDA, 0x0D, 0x77, 0x59, 0x2C, 0xBF, 0xE1, 0x0B,
+    0x59, 0x11, 0x14, 0xE9, 0xA8, 0x97, 0xF7, 0xEA, 0x5A, 0x15, 0xD1, 0x27, 0x6F, 0xB6, 0x05, 0xC6,
+    0x13, 0xFB, 0x8E, 0xDA, 0xD5, 0x8C, 0x94, 0xFD, 0x9F, 0xFD, 0x43, 0x46, 0xCC, 0xE8, 0x39, 0x00,
+    0xCB, 0xD6, 0xA4, 0x6D, 0xE7, 0x4E, 0x3B, 0xF0, 0xAD, 0x26, 0x57, 0x34, 0x51, 0x1F, 0x18, 0x7E,
+    0x3E, 0xD1, 0x74, 0x49, 0x5F, 0x40, 0x08, 0xCB, 0x46, 0x36, 0xDC, 0xBD, 0xDE, 0x06, 0xB0, 0x6F,
+    0x96, 0xE8, 0x2E, 0x1B, 0x35, 0x0F, 0x30, 0x85, 0xAA, 0x3F, 0xD6, 0x8A, 0x9F, 0x4F, 0xE0, 0x7F,
+    0xDB, 0xC1, 0xC1, 0x61, 0x1D, 0x57, 0x8D, 0x56, 0xB0, 0xCB, 0x00, 0x13, 0x15, 0xF2, 0x62, 0xFD,
+    0x6B, 0x91, 0xF7, 0x53, 0xBD, 0x65, 0x77, 0x6B, 0x7C, 0xD4, 0xF5, 0x48, 0x0A, 0xA8, 0x04, 0xAC,
+    0x04, 0xB0, 0x10, 0x2F, 0x26, 0x02, 0x5C, 0x02, 0x5E, 0x02, 0x60, 0x24, 0x46, 0x64, 0xE4, 0x65,
+    0x86, 0x13, 0x50, 0x60, 0x13, 0x70, 0x13, 0x80, 0x33, 0x72, 0x8D, 0x33, 0x7A, 0x72, 0xAD, 0x85,
+    0xC0, 0x6C, 0xE6, 0x74, 0xB9, 0xF4, 0x0E, 0x2B, 0x31, 0xB0, 0x75, 0xB8, 0x09, 0x5F, 0xEB, 0x15,
+    0x67, 0x0F, 0xAD, 0x5D, 0xB5, 0x40, 0x9D, 0x68, 0x83, 0xD4, 0x98, 0x3A, 0x54, 0xA7, 0xDA, 0x4C,
+    0xA4, 0x8D, 0xAB, 0x23, 0x6D, 0x7E, 0x18, 0x5A, 0x67, 0xEB, 0x70, 0x9D, 0xAE, 0xE3, 0x6D, 0x06,
+    0x0C, 0x03, 0xEC, 0x84, 0x1D, 0xB1, 0x33, 0x76, 0xC8, 0x46, 0xD9, 0x31, 0x3F, 0xD8, 0xDB, 0xB3,
+    0x45, 0xB7, 0x4A, 0xDF, 0xE6, 0x74, 0xE2, 0x36, 0x92, 0xAF, 0x7F, 0x54, 0x6C, 0xDF, 0x35, 0x8C,
+    0xC5, 0x36, 0x8D, 0x3E, 0xAA, 0x80, 0x49, 0x40, 0x0D, 0x4C, 0x04, 0x53, 0xC1, 0x64, 0x30, 0x1D,
+    0x4C, 0x08, 0x53, 0xC2, 0xA4, 0x30, 0x2D, 0x4C, 0x07, 0xB7, 0x03, 0x59, 0xE8, 0x61, 0x82, 0x98,
+    0x22, 0x2E, 0x89, 0x6B, 0x12, 0xD8, 0x8C, 0xCD, 0x2A, 0xBE, 0xB3, 0x89, 0x36, 0x9F, 0x49, 0x5B,
+    0x41, 0x4C, 0x0F, 0x93, 0x63, 0x43, 0x56, 0x39, 0xC4, 0x62, 0x02, 0xCA, 0x1C, 0xE6, 0x8A, 0x3E,
+    0xE2, 0x89, 0xE1, 0x88, 0xA4, 0xC1, 0xB9, 0x4B, 0xF9, 0x1B, 0x0E, 0xAE, 0x76, 0x45, 0x1C, 0xA9,
+    0x03, 0xAE, 0x73, 0x72, 0x8E, 0xB8, 0xF9, 0x12, 0xF3, 0x8E, 0x3B, 0xE5, 0xDA, 0x51, 0x64, 0x5A,
+    0x78, 0xF2, 0xA0, 0x89, 0xFE, 0x81, 0x7A, 0x69, 0xFA, 0x8E, 0xBE, 0x36, 0xFC, 0xC8, 0x3D, 0x97,
+    0x8E, 0x7B, 0xC4, 0x6F, 0x1F, 0x79, 0xD8, 0x38, 0x97, 0xC3, 0x49, 0xEB, 0xCF, 0xB5, 0x98, 0xE8,
+    0x63, 0x24, 0x53, 0xA1, 0x2D, 0x43, 0xD0, 0x5B, 0x65, 0x0D, 0xBD, 0x15, 0x2B, 0x3C, 0x41, 0x7D,
+    0xB1, 0x44, 0xAA, 0xA6, 0x0D, 0x0E, 0x67, 0x8B, 0x9A, 0xE2, 0x79, 0xC3, 0xD1, 0x32, 0x61, 0xDB,
+    0xCC, 0xA0, 0xCF, 0xC6, 0x0F, 0x50, 0xD9, 0xE0, 0x60, 0xCA, 0xEE, 0x85, 0x0D, 0x86, 0x13, 0x48,
+    0xFD, 0x56, 0x79, 0x94, 0xFB, 0x2F, 0x72, 0xAD, 0x27, 0x0B, 0xCB, 0x6D, 0xB5, 0xF8, 0xE8, 0xEF,
+    0x95, 0x24, 0xC5, 0xF5, 0x47, 0x19, 0x2A, 0x1E, 0x9E, 0x87, 0x9D, 0xD6, 0xDF, 0x6A, 0xC5, 0xCB,
+    0x0D, 0x03, 0xFD, 0xDE, 0xD2, 0x37, 0xF4, 0xF7, 0x6C, 0x8C, 0x79, 0xA1, 0x21, 0x3C, 0x55, 0xBE,
+    0x9F, 0xB2, 0xC9, 0x18, 0x6D, 0xB0, 0x1B, 0x80, 0xD1, 0xC0, 0x46, 0x07, 0x63, 0x89, 0xEF, 0xDE,
+    0xD8, 0x96, 0x70, 0xF1, 0x0D, 0x8E, 0xA0, 0x08, 0x86, 0x20, 0x98, 0x79, 0xE5, 0x86, 0x36, 0x74,
+    0x61, 0x45, 0xF1, 0x74, 0xBD, 0xA7, 0xCC, 0x2A, 0xF8, 0x62, 0x58, 0x97, 0xF1, 0x2F, 0xC6, 0x81,
+    0xD6, 0x50, 0x2B, 0xA6, 0xF3, 0x87, 0x09, 0xD7, 0x3C, 0x08, 0x7E, 0x58, 0xC9, 0xE5, 0x0A, 0x09,
+    0xB9, 0x3E, 0xBD, 0x37, 0xC2, 0x24, 0x42, 0xBF, 0xF4, 0xE9, 0xFA, 0x60, 0x7D, 0x6E, 0xC6, 0x27,
+    0xEB, 0x83, 0xDF, 0xE4, 0xA6, 0xD9, 0xFE, 0x86, 0x0C, 0x66, 0xE8, 0x8E, 0xC1, 0x31, 0x54, 0xBB,
+    0x89, 0xBD, 0x0D, 0xD6, 0xAA, 0x83, 0x35, 0xE0, 0x74, 0xA7, 0x3F, 0xC2, 0x57, 0xAF, 0x9D, 0x97,
+    0xF4, 0x6A, 0x15, 0x95, 0x4F, 0xDB, 0xE7, 0x74, 0x61, 0x8A, 0x2F, 0x38, 0x2A, 0xFA, 0x11, 0x9E,
+    0xA4, 0x5F, 0xFA, 0x9C, 0x78, 0xCC, 0xD6, 0x8E, 0x75, 0x56, 0x34, 0x0A, 0xE7, 0x9E, 0x45, 0x66,
+    0xDC, 0x41, 0xD4, 0xB7, 0xBE, 0x78, 0xC8, 0xC5, 0x4E, 0x73, 0xE8, 0xAD, 0xEF, 0xAA, 0x23, 0xC6,
+    0x07, 0xD8, 0x68, 0xD4, 0xEA, 0x6B, 0x4B, 0x06, 0x18, 0xB2, 0xE1, 0x9D, 0x71, 0x85, 0xC1, 0x21,
+    0x9A, 0x50, 0xF5, 0x83, 0xA4, 0xA2, 0x1D, 0xC3, 0xA6, 0xCC, 0x53, 0xE0, 0x7F, 0xF1, 0x24, 0x2B,
+    0x1A, 0xAB, 0xBE, 0x85, 0x2E, 0x31, 0xC6, 0x6E, 0x65, 0x7F, 0x44, 0x06, 0x25, 0xEC, 0x20, 0xC7,
+    0x7F, 0xE7, 0x20, 0xA4, 0x7D, 0x4A, 0x9F, 0xA0, 0x8F, 0x67, 0x7F, 0x57, 0x1F, 0xFB, 0xE5, 0x9C,
+    0xB8, 0x3F, 0x5D, 0x2C, 0x79, 0x3F, 0xE8, 0xFD, 0xF1, 0xE4, 0x61, 0x33, 0x0D, 0x9D, 0xE7, 0x6B,
+    0x55, 0xB2, 0xBB, 0x53, 0x74, 0xA4, 0x7D, 0x3C, 0x2F, 0x43, 0xCB, 0xB3, 0x5C, 0xE1, 0x59, 0x10,
+    0x29, 0xB4, 0x54, 0x35, 0xAA, 0x74, 0x31, 0x80, 0x24, 0x43, 0xE8, 0x31, 0x04, 0xC2, 0x21, 0xDE,
+    0xC3, 0x99, 0x5B, 0x96, 0xEB, 0x73, 0xD3, 0x52, 0x5B, 0x9D, 0xDC, 0x1B, 0xEA, 0x14, 0xF4, 0x70,
+    0xBE, 0x67, 0xB3, 0xB4, 0xF9, 0xC2, 0xDC, 0xE8, 0xC2, 0xA3, 0x5E, 0x43, 0x8E, 0x9E, 0xE3, 0x0B,
+    0xED, 0x42, 0xD5, 0x16, 0xEB, 0xDC, 0x67, 0x1C, 0x62, 0x1A, 0xD8, 0x8D, 0x80, 0xAB, 0x49, 0xBC,
+    0xB3, 0x19, 0xCB, 0x06, 0xBF, 0x78, 0x68, 0x33, 0x36, 0x79, 0x70, 0x33, 0xF6, 0x18, 0xD0, 0xDB,
+    0xD6, 0x9F, 0x55, 0x65, 0x33, 0xA7, 0x07, 0x64, 0xB7, 0x18, 0x5A, 0x89, 0x50, 0xA2, 0x3B, 0x13,
+    0x5B, 0x40, 0xDE, 0xB1, 0x9A, 0x6D, 0x3C, 0xE0, 0xD7, 0x86, 0xD9, 0x39, 0x3B, 0x68, 0x27, 0x6D,
+    0xA8, 0xC5, 0x58, 0x5B, 0x50, 0xD3, 0x31, 0xA8, 0xB2, 0x1F, 0xC4, 0x2D, 0xC6, 0x5B, 0x0C, 0xB8,
+    0x18, 0x71, 0x31, 0xE4, 0x62, 0xCC, 0xC5, 0xA0, 0x5B, 0x5F, 0x2F, 0xC5, 0xB0, 0x8B, 0x71, 0x77,
+    0xF0, 0x4E, 0xDE, 0xD1, 0x37, 0xEC, 0x1B, 0xF8, 0x5D, 0x7F, 0x6F, 0xF7, 0x64, 0x99, 0x71, 0xDF,
+    0x44, 0x03, 0x06, 0xC8, 0xB8, 0x83, 0xAF, 0x98, 0x71, 0x97, 0xD7, 0x29, 0xC2, 0x53, 0x0F, 0xEB,
+    0x03, 0xA6, 0x04, 0xA5, 0x30, 0x2D, 0x4C, 0x0C, 0xA1, 0x1A, 0x42, 0x39, 0x9A, 0x2F, 0xD6, 0x8F,
+    0x8A, 0x08, 0x25, 0x31, 0x4D, 0x4C, 0x14, 0xDF, 0xAB, 0xA5, 0x2C, 0xA6, 0x8B, 0x09, 0xE3, 0xCA,
+    0xB8, 0x34, 0x61, 0xD1, 0x76, 0x4F, 0xB9, 0xC6, 0x1C, 0x66, 0x27, 0x6B, 0x75, 0x31, 0x59, 0x4C,
+    0x95, 0xAE, 0x28, 0x2B, 0x1B, 0x6A, 0x2C, 0xEC, 0xB2, 0x39, 0x6F, 0xA0, 0xA8, 0x27, 0x06, 0x23,
+    0x87, 0x4E, 0xE6, 0x47, 0x90, 0x1F, 0x47, 0xCC, 0x61, 0xB0, 0xA7, 0x73, 0x3F, 0xB6, 0x23, 0x4D,
+    0x2E, 0xBB, 0xF9, 0x72, 0xC5, 0x1E, 0x90, 0xAF, 0x29, 0x68, 0x6E, 0xBE, 0x26, 0xED, 0xE6, 0xAB,
+    0xA2, 0x4D, 0xB9, 0xF9, 0xFA, 0xD1, 0x32, 0x69, 0xEF, 0x63, 0x1D, 0x24, 0xAA, 0xBF, 0x40, 0x6B,
+    0x5F, 0xC1, 0xE4, 0x72, 0xCB, 0xCE, 0x80, 0x58, 0x6A, 0xBE, 0xB6, 0x6E, 0x6D, 0x09, 0xFA, 0xDB,
+    0xCD, 0x16, 0x6C, 0xB8, 0x58, 0x1E, 0x65, 0x6E, 0xBA, 0x5C, 0x07, 0xB7, 0x25, 0x94, 0x6C, 0xD4,
+    0xA2, 0xFD, 0x9B, 0x2D, 0x29, 0x3C, 0x3C, 0xC0, 0xAD, 0x6F, 0x8A, 0xC2, 0x86, 0xB2, 0x9D, 0xDC,
+    0x88, 0xBD, 0x37, 0x01, 0xF0, 0x37, 0x96, 0x12, 0x51, 0xFE, 0x4D, 0x16, 0x23, 0xBF, 0xB3, 0xB6,
+    0x4C, 0xBB, 0xAB, 0x4C, 0x49, 0xD1, 0x8E, 0xBD, 0xB6, 0x16, 0x69, 0xD7, 0xD5, 0xC5, 0xBD, 0x2A,
+    0x0B, 0x7E, 0x40, 0x97, 0xA9, 0x09, 0x43, 0x56, 0xC9, 0xED, 0x31, 0xA5, 0xD1, 0x69, 0xE1, 0x8C,
+    0x50, 0x56, 0x65, 0x84, 0x7D, 0x4E, 0x16, 0xAD, 0x0F, 0x4D, 0xB0, 0xCE, 0xF6, 0xF3, 0xB3, 0xDE,
+    0x60, 0x9B, 0xB9, 0xE9, 0x73, 0x55, 0x13, 0xE0, 0xBF, 0x3B, 0x4D, 0xD0, 0x8E, 0xFD, 0xB3, 0x94,
+    0x85, 0x79, 0xB5, 0x96, 0xFD, 0x3F, 0x8E, 0xAA, 0x74, 0x8E, 0xB4, 0xF8, 0x9A, 0x51, 0xD5, 0x37,
+    0xC5, 0x99, 0xD5, 0xE3, 0x7A, 0x53, 0xDA, 0x85, 0x46, 0x74, 0x8E, 0xCE, 0xD0, 0xBB, 0xCE, 0x42,
+    0x70, 0x14, 0x68, 0x56, 0x36, 0xA7, 0xAD, 0x6F, 0xDA, 0x81, 0x3F, 0x89, 0x57, 0x40, 0x08, 0xCF,
+    0xEB, 0x3D, 0xB1, 0x6F, 0x32, 0x7B, 0x4B, 0xED, 0x3D, 0xB7, 0xF7, 0xE4, 0xDE, 0xB3, 0x7B, 0x8C,
+    0x67, 0x6B, 0xDB, 0x31, 0x02, 0x1B, 0xE8, 0xD8, 0x2C, 0xCB, 0xFD, 0xBD, 0xD7, 0xB3, 0xBD, 0x89,
+    0xA5, 0xD8, 0xBE, 0x32, 0x08, 0x6D, 0x36, 0x96, 0xAB, 0xCD, 0xAE, 0x75, 0x87, 0x79, 0xC8, 0x43,
+    0x25, 0xF5, 0x9F, 0xE0, 0x2D, 0xE7, 0xFB, 0x6C, 0xD8, 0x76, 0xF8, 0xE9, 0xDA, 0x87, 0x29, 0x36,
+    0xAF, 0x37, 0x43, 0xEB, 0xB4, 0x71, 0x79, 0xD3, 0x36, 0x6D, 0xDA, 0x0A, 0xF4, 0x8B, 0xB5, 0x8E,
+    0xFF, 0x76, 0x1D, 0x74, 0xC7, 0x3A, 0xFF, 0x71, 0x74, 0xE3, 0x4B, 0x56, 0x03, 0x75, 0xB3, 0x68,
+    0x98, 0xB7, 0x5B, 0x21, 0x9D, 0xB5, 0x9B, 0x41, 0x5D, 0x85, 0xF5, 0xEC, 0x72, 0x7D, 0x35, 0x1C,
+    0x1E, 0x00, 0x71, 0x3F, 0x47, 0x1A, 0x72, 0x86, 0x91, 0xF5, 0x2C, 0x47, 0xF1, 0x1D, 0x52, 0xD9,
+    0xE1, 0x02, 0xD5, 0x0E, 0x67, 0xBE, 0x57, 0x78, 0x1E, 0xEB, 0x1A, 0x97, 0xA9, 0x2A, 0xB6, 0x0F,
+    0x8B, 0xAD, 0xD8, 0x74, 0xD0, 0xAA, 0x06, 0x63, 0x14, 0x18, 0x32, 0xB1, 0x8A, 0x4A, 0x4E, 0x24,
+    0x69, 0xE3, 0x02, 0xD5, 0xEE, 0xE5, 0xF8, 0x3D, 0x61, 0x45, 0x2E, 0x70, 0x91, 0x10, 0xE0, 0xE7,
+    0xEF, 0xE1, 0x80, 0x48, 0xCD, 0x63, 0x74, 0x9B, 0xF9, 0xD7, 0xD4, 0x3C, 0x3F, 0x52, 0xF3, 0x6C,
+    0xA6, 0x95, 0x79, 0x5E, 0x33, 0xAC, 0x52, 0xF9, 0xF7, 0x4B, 0x1D, 0x8C, 0xD3, 0x22, 0x54, 0xED,
+    0x90, 0xC0, 0x90, 0x8B, 0x6F, 0xB5, 0x6B, 0xBD, 0xF7, 0x51, 0xED, 0x19, 0x6A, 0xDD, 0xDC, 0x5E,
+    0xC4, 0x53, 0xBD, 0xFD, 0x24, 0xDE, 0xF3, 0x5D, 0xF8, 0xCF, 0x27, 0xD3, 0xED, 0x7E, 0x7D, 0xB3,
+    0xAE, 0x7A, 0x73, 0x2C, 0xFC, 0xED, 0x2E, 0xF2, 0x72, 0x4A, 0xD8, 0x1E, 0x3C, 0x4B, 0xDA, 0x23,
+    0x14, 0x81, 0x9D, 0x39, 0xE5, 0x39, 0x91, 0x13, 0x3C, 0xF4, 0xE7, 0xC7, 0x77, 0x2E, 0xF3, 0x90,
+    0xC3, 0xFD, 0xF6, 0x14, 0x6C, 0x50, 0xAE, 0x3A, 0x6C, 0xC6, 0xEE, 0x14, 0x5E, 0xFC, 0x13, 0xA4,
+    0x0B, 0xDB, 0xA9, 0x1D, 0xA0, 0xF5, 0xD3, 0x18, 0x4C, 0x6D, 0x4E, 0x76, 0x57, 0x6D, 0x1E, 0x3D,
+    0xFA, 0x2D, 0x0B, 0x10, 0xC9, 0xA8, 0xB3, 0x9C, 0xE1, 0x03, 0xBC, 0x9F, 0x43, 0x6B, 0x53, 0x18,
+    0x3B, 0xA4, 0x86, 0x4C, 0x1C, 0x78, 0x93, 0x31, 0xF9, 0xC6, 0x63, 0x02, 0x8E, 0x4B, 0x12, 0x4E,
+    0x72, 0x20, 0x3E, 0x77, 0x83, 0x8C, 0xB3, 0x3D, 0x87, 0xEC, 0x94, 0x1D, 0xB3, 0x73, 0x76, 0xD0,
+    0x4E, 0xDA, 0x51, 0x3B, 0x6B, 0x87, 0xED, 0xB4, 0x1D, 0xB7, 0xF3, 0x76, 0xE0, 0x4E, 0xDC, 0x91,
+    0x3B, 0x73, 0x87, 0xDE, 0x50, 0x6F, 0x7D, 0xFC, 0xB9, 0x7C, 0xB1, 0x1F, 0xC1, 0xFB, 0x3C, 0xEF,
+    0xB7, 0x2C, 0xED, 0xE9, 0xE6, 0x60, 0xCC, 0xD4, 0x82, 0x0C, 0xA9, 0x1F, 0x10, 0x7B, 0x05, 0x90,
+    0xB7, 0x46, 0x00, 0x3F, 0xC7, 0xA7, 0x0C, 0xD2, 0x3D, 0xA3, 0xEE, 0xD6, 0x0E, 0xD2, 0x93, 0xBE,
+    0xE1, 0x37, 0xFE, 0x26, 0x80, 0x29, 0x60, 0x12, 0x98, 0x06, 0x26, 0x82, 0x50, 0x05, 0x31, 0x19,
+    0x1A, 0x1D, 0x9E, 0x73, 0xC1, 0x1D, 0x71, 0xB9, 0xD8, 0x61, 0x14, 0xDF, 0x64, 0xD4, 0xEB, 0xC7,
+    0x6B, 0x2F, 0x84, 0x25, 0x93, 0x1E, 0xC6, 0xA7, 0x9D, 0x10, 0x69, 0x09, 0x4B, 0x94, 0x2F, 0x5F,
+    0x08, 0x0B, 0x37, 0x1E, 0x6F, 0x9A, 0x80, 0xE3, 0x11, 0xC7, 0x42, 0x8E, 0xC7, 0x1C, 0x0F, 0x3A,
+    0x88, 0x3A, 0xEB, 0xDB, 0x31, 0x2C, 0x99, 0x64, 0x44, 0xB2, 0x90, 0xE4, 0x31, 0x89, 0x6F, 0x6D,
+    0xCE, 0x88, 0xF1, 0x9E, 0x93, 0xEC, 0x24, 0x1B, 0x4B, 0xD5, 0xC6, 0x6B, 0x9D, 0x4D, 0x18, 0x24,
+    0xFF, 0x39, 0xFF, 0x21, 0xF1, 0x0F, 0xB9, 0x67, 0x98, 0xF7, 0xF6, 0xD6, 0x3E, 0x4C, 0x5D, 0xB2,
+    0xD5, 0x05, 0x41, 0x92, 0x31, 0xFC, 0x42, 0x1F, 0xF5, 0x02, 0xD2, 0x32, 0x39, 0x15, 0x5C, 0x5F,
+    0x7E, 0xBF, 0x58, 0xEF, 0xF8, 0xDF, 0x5D, 0x23, 0x49, 0x0F, 0x9D, 0xBD, 0xE9, 0x17, 0x0F, 0x3F,
+    0x24, 0xB9, 0x5C, 0xD4, 0x87, 0x73, 0xDA, 0xF4, 0xE8, 0x81, 0xC8, 0xE6, 0x73, 0x6F, 0xB3, 0x4E,
+    0xF6, 0x66, 0xFF, 0xE6, 0x47, 0xE0, 0x3A, 0x99, 0x90, 0x0F, 0x2B, 0xF5, 0xB8, 0x5F, 0x8F, 0xD3,
+    0xF9, 0xDE, 0x93, 0xF5, 0x9E, 0xA6, 0xFE, 0xFA, 0x3E, 0xA8, 0x35, 0xE1, 0x76, 0xF9, 0x98, 0x7F,
+    0x96, 0x48, 0xD0, 0x13, 0x8E, 0x91, 0x67, 0xB9, 0x0B, 0x7E, 0x85, 0x50, 0x79, 0xA6, 0x94, 0x7B,
+    0x38, 0xC9, 0x1F, 0x78, 0x8A, 0xE9, 0xAF, 0x2C, 0xA4, 0x33, 0x84, 0xFA, 0xCE, 0x7A, 0x65, 0x9E,
+    0xD1, 0xE6, 0x12, 0xFD, 0xB2, 0xB5, 0x5C, 0x95, 0xDD, 0xAA, 0x3F, 0xB3, 0xED, 0xFB, 0xFF, 0xD0,
+    0x80, 0xE2, 0x61, 0x0D, 0xE8, 0xCD, 0x50, 0x9C, 0x62, 0x4A, 0xF8, 0x71, 0x34, 0xB4, 0x61, 0xC0,
+    0x79, 0x40, 0xC6, 0x21, 0x23, 0x2D, 0xE0, 0x3B, 0x9A, 0x20, 0xD9, 0x59, 0x53, 0xF4, 0x9F, 0x31,
+    0x9A, 0x14, 0x57, 0x18, 0xE1, 0xA3, 0x2A, 0xE1, 0x12, 0xC6, 0x39, 0x2E, 0x25, 0xF1, 0x98, 0xC9,
+    0xF4, 0x1A, 0x4B, 0xB7, 0xFD, 0xC0, 0xB2, 0x4D, 0x7B, 0xB3, 0xCE, 0xCA, 0xC1, 0xA4, 0xF3, 0x99,
+    0x87, 0x72, 0x91, 0xD3, 0xB3, 0xED, 0x19, 0x97, 0x38, 0xD3, 0xFB, 0x2B, 0xCA, 0xB6, 0xBD, 0x6E,
+    0xB4, 0x8B, 0x68, 0x6E, 0x6F, 0x1C, 0xBD, 0x65, 0x99, 0x6C, 0x53, 0xB2, 0x45, 0xD2, 0x33, 0x40,
+    0x00, 0x40, 0xC2, 0x7A, 0x88, 0x6D, 0xB3, 0x7C, 0x93, 0xB2, 0x61, 0xCF, 0xDA, 0x48, 0x94, 0xB4,
+    0xC3, 0x74, 0xCC, 0x29, 0x63, 0x6C, 0x8E, 0xB3, 0xCA, 0xDE, 0x6E, 0xEB, 0x04, 0x3C, 0xB7, 0x29,
+    0x67, 0x5E, 0x85, 0x8B, 0x6F, 0x58, 0x07, 0xA7, 0xD3, 0xDB, 0x71, 0x1C, 0x9F, 0xDB, 0x14, 0xED,
+    0x07, 0x86, 0x56, 0xDC, 0xF3, 0x45, 0xBE, 0x4D, 0x5B, 0x8F, 0xCE, 0xEB, 0xED, 0x5F, 0xDE, 0x7F,
+    0x5F, 0xEF, 0x09, 0x71, 0x5A, 0x68, 0x53, 0xCE, 0xE5, 0xAB, 0x1E, 0x7F, 0x4E, 0xD9, 0xC7, 0xCA,
+    0x8A, 0xD7, 0x51, 0xF5, 0x7B, 0xA0, 0x17, 0x21, 0xE5, 0xDB, 0xF0, 0xCF, 0x89, 0xAC, 0x03, 0xFF,
+    0x7F, 0x01, 0xB5, 0x58, 0x3D, 0x6C, 0xE5, 0xC6, 0x11, 0x1E, 0x92, 0xD2, 0x11, 0x06, 0x91, 0xE3,
+    0x15, 0x3A, 0x17, 0x17, 0x3B, 0x6C, 0xAE, 0x89, 0x21, 0x1D, 0x53, 0xAA, 0x78, 0x4F, 0x5C, 0xC3,
+    0x40, 0x9A, 0x00, 0x81, 0x8A, 0x13, 0x5C, 0xB8, 0xB0, 0x8B, 0x34, 0x71, 0x80, 0x38, 0x08, 0x54,
+    0xA8, 0x90, 0x44, 0x22, 0x57, 0xB8, 0x0A, 0xA2, 0x22, 0x9D, 0x81, 0x44, 0xC5, 0x15, 0x86, 0x52,
+    0x48, 0xC5, 0x15, 0x17, 0x40, 0x12, 0xD7, 0x97, 0xE2, 0x8A, 0x34, 0x0C, 0x82, 0x20, 0x45, 0x8A,
+    0x10, 0x88, 0x0D, 0x23, 0x97, 0x66, 0x91, 0xF0, 0x60, 0xFA, 0xC2, 0x27, 0xE6, 0x9B, 0xD9, 0xE5,
+    0xFB, 0xB1, 0xCF, 0x67, 0x9D, 0x0F, 0xE1, 0x7B, 0x3B, 0xEF, 0x87, 0xBB, 0xB3, 0xB3, 0xDF, 0xCE,
+    0x7C, 0x33, 0xCB, 0xC3, 0xC3, 0xAF, 0xB8, 0x36, 0xDF, 0x79, 0x69, 0x7D, 0xF5, 0xEA, 0x49, 0xA0,
+    0xE3, 0x3A, 0x6D, 0x7F, 0xFE, 0x4B, 0xBF, 0xB8, 0xDC, 0xCB, 0x53, 0xA4, 0x89, 0x0C, 0xD1, 0x88,
+    0xCA, 0x9E, 0x4E, 0x46, 0x74, 0x78, 0x42, 0x87, 0x9A, 0x0E, 0xE9, 0x9B, 0xBF, 0x37, 0x89, 0xA0,
+    0x33, 0x28, 0x28, 0x26, 0xCA, 0xFA, 0xE2, 0x6A, 0x50, 0x04, 0xBF, 0x28, 0xE8, 0x41, 0x41, 0xFE,
+    0x0B, 0xBC, 0x3D, 0x75, 0x7D, 0x4B, 0x65, 0x7D, 0x95, 0xF7, 0x15, 0xD4, 0xCF, 0x7F, 0x97, 0x2B,
+    0xEF, 0xFB, 0xBE, 0x60, 0x81, 0xFF, 0xED, 0xD5, 0xE6, 0xEE, 0x4B, 0x33, 0xF4, 0xA1, 0x15, 0x4F,
+    0x8D, 0x02, 0xFD, 0xFF, 0x7E, 0xCB, 0x54, 0x31, 0x26, 0xA6, 0xA4, 0xEF, 0x2F, 0xEC, 0xCC, 0xCB,
+    0x5B, 0x5B, 0xB7, 0x81, 0x45, 0xDF, 0xD1, 0x6B, 0x47, 0x47, 0x1F, 0x12, 0xDD, 0xF4, 0x9B, 0x58,
+    0xAD, 0x02, 0xF3, 0x7D, 0xCA, 0x75, 0xAE, 0x33, 0xED, 0xF1, 0x98, 0x2A, 0x35, 0x89, 0x09, 0x8D,
+    0x67, 0xFC, 0x2A, 0x2C, 0xCE, 0xE8, 0x80, 0xA2, 0x22, 0xAB, 0x72, 0x5D, 0x16, 0x1D, 0xDD, 0xA3,
+    0x6D, 0x1A, 0xE3, 0x37, 0x29, 0xD1, 0x5E, 0xE5, 0x94, 0x9A, 0xBE, 0x48, 0x4C, 0xA9, 0x43, 0x93,
+    0x16, 0x9E, 0x89, 0x95, 0x5F, 0xC5, 0x14, 0x16, 0x6B, 0x74, 0xE6, 0x37, 0x74, 0xE0, 0x2B, 0xF4,
+    0x5D, 0xCB, 0xFE, 0xD4, 0xE7, 0x7F, 0xE8, 0xCB, 0x3B, 0x93, 0x2E, 0xA8, 0xEF, 0x05, 0x7A, 0xDB,
+    0xD7, 0x63, 0x32, 0x51, 0x31, 0x26, 0xB5, 0x24, 0xBB, 0x84, 0x9E, 0x14, 0x60, 0xEB, 0x83, 0x1A,
+    0x0D, 0x50, 0xB2, 0xED, 0xD8, 0x36, 0x0A, 0x15, 0x65, 0xBF, 0x3B, 0xAE, 0x61, 0x6F, 0xB5, 0x12,
+    0xC3, 0x41, 0x52, 0x4C, 0x99, 0xA1, 0x95, 0xAE, 0x9D, 0xA3, 0x75, 0xAE, 0xB5, 0x24, 0xDE, 0xE3,
+    0x71, 0x83, 0x1A, 0x1F, 0x6A, 0x7C, 0x3D, 0x53, 0x15, 0xC0, 0xDE, 0x10, 0x5D, 0x22, 0xB4, 0x97,
+    0x04, 0x0A, 0x8F, 0x57, 0x10, 0xF1, 0xC6, 0x45, 0x0C, 0x55, 0x5C, 0xB0, 0x20, 0x27, 0x7E, 0xFF,
+    0xC3, 0x1B, 0x9A, 0x00, 0x9D, 0xA6, 0x7F, 0xAE, 0x7E, 0x1B, 0x77, 0xC6, 0x7C, 0xE3, 0x8C, 0xC5,
+    0x84, 0xDC, 0x64, 0x74, 0xC2, 0xE2, 0x90, 0xC5, 0x01, 0x0B, 0xD6, 0xE4, 0xD7, 0xAC, 0xCE, 0xB0,
+    0xA8, 0x9D, 0xE2, 0x95, 0xB0, 0xD8, 0x64, 0xC4, 0x6B, 0xCA, 0x8E, 0x8F, 0x2B, 0x37, 0xC5, 0x77,
+    0x58, 0xDC, 0x62, 0xB1, 0xC1, 0x62, 0x9F, 0xC5, 0x8F, 0xD9, 0xA6, 0x0F, 0xB1, 0x61, 0x45, 0xDA,
+    0xEB, 0xAC, 0xAF, 0xE7, 0xDE, 0x15, 0xFE, 0xF4, 0x2F, 0xDC, 0x24, 0x30, 0x00, 0xEE, 0xD6, 0x4F,
+    0x60, 0x5E, 0x05, 0xB5, 0xD8, 0x59, 0xE8, 0xC6, 0xCD, 0xDA, 0x39, 0x57, 0x5A, 0x64, 0xD8, 0xC7,
+    0xAC, 0x58, 0x76, 0xBF, 0x02, 0x93, 0xE9, 0xA8, 0x45, 0x6B, 0xB2, 0x22, 0x34, 0xCB, 0x58, 0xF7,
+    0x12, 0x40, 0x2C, 0x55, 0xAF, 0xCE, 0xED, 0x00, 0x0E, 0x37, 0x7A, 0xA1, 0x40, 0x9B, 0x85, 0x9B,
+    0x04, 0x1A, 0x03, 0xEE, 0xBF, 0xF0, 0xDB, 0x53, 0xFD, 0xC2, 0x75, 0x79, 0x22, 0xE9, 0xFB, 0x4F,
+    0xB6, 0x2A, 0xE2, 0x57, 0x4D, 0xCF, 0x37, 0x6E, 0xEB, 0x2D, 0x38, 0x09, 0xBF, 0xA2, 0xE7, 0x19,
+    0x47, 0xB3, 0x2B, 0xC7, 0x2E, 0xDC, 0xE3, 0x2F, 0xFE, 0xE3, 0xD6, 0x7A, 0x03, 0x9C, 0x60, 0x97,
+    0x42, 0x09, 0xC6, 0x44, 0x8D, 0x29, 0x96, 0xDE, 0x29, 0xF6, 0x5D, 0xB6, 0x1F, 0x9F, 0x1B, 0xB4,
+    0x2B, 0xDF, 0xF6, 0xE0, 0x06, 0x46, 0xBE, 0x9D, 0xD2, 0x5E, 0x60, 0x77, 0xB3, 0xA3, 0xD3, 0x48,
+    0xBB, 0x6F, 0x5D, 0x42, 0xB7, 0x41, 0x38, 0x74, 0xEA, 0x35, 0xE3, 0xB0, 0xD7, 0x5E, 0x5F, 0x9F,
+    0x06, 0xF5, 0xFD, 0xE4, 0x8D, 0x3A, 0xAC, 0xDA, 0x71, 0xF4, 0x91, 0x19, 0xFB, 0x08, 0xBE, 0xD3,
+    0xA4, 0x0F, 0x2A, 0xF4, 0xC8, 0xE8, 0xD4, 0xBF, 0x1B, 0x15, 0x0D, 0xFA, 0x42, 0x31, 0x25, 0xBE,
+    0xF1, 0x9A, 0x53, 0x76, 0xE0, 0x71, 0x60, 0x7C, 0x03, 0xB5, 0xF0, 0xE1, 0xA0, 0x0E, 0x4C, 0x0B,
+    0xC5, 0xBE, 0xC1, 0xB7, 0xBA, 0x85, 0x53, 0x87, 0x3A, 0x60, 0x6D, 0x5E, 0x03, 0x33, 0x83, 0x3A,
+    0xD6, 0x2D, 0x82, 0x32, 0xC5, 0xFD, 0x84, 0x5A, 0xAC, 0x00, 0x66, 0x36, 0x7B, 0xB4, 0x97, 0x28,
+    0x42, 0xB8, 0xE6, 0x86, 0x92, 0xCE, 0xC6, 0x11, 0x3D, 0xE5, 0x9A, 0xE2, 0xB0, 0x88, 0xC5, 0x22,
+    0x1E, 0x8B, 0x98, 0x2C, 0xE2, 0xB2, 0x88, 0xCD, 0x22, 0x3E, 0x8B, 0x18, 0x2D, 0xE2, 0xB4, 0x88,
+    0x15, 0x2D, 0xAB, 0x39, 0xBC, 0x28, 0x6F, 0x69, 0x86, 0x99, 0x67, 0xC6, 0x34, 0xC3, 0x2D, 0xAC,
+    0x52, 0x9A, 0x61, 0x17, 0x6B, 0x2C, 0x7B, 0x8A, 0x5F, 0xA2, 0x98, 0x78, 0x06, 0x0C, 0x53, 0xA1,
+    0xA1, 0x01, 0xC7, 0x4C, 0x7E, 0x0D, 0x58, 0x6E, 0x30, 0x3D, 0x4D, 0xF1, 0x1C, 0x73, 0x74, 0x4F,
+    0x31, 0x1D, 0x33, 0xE8, 0x53, 0x5C, 0xC7, 0xCC, 0x21, 0x53, 0x6C, 0x37, 0x7C, 0xAC, 0x6C, 0x8A,
+    0x6F, 0xF2, 0x03, 0x84, 0xF9, 0x14, 0xE3, 0xD0, 0x51, 0xF7, 0x0C, 0xE7, 0xB0, 0x8E, 0xAB, 0x58,
+    0xB3, 0x55, 0x63, 0x30, 0xF7, 0xB6, 0xFC, 0x93, 0x81, 0x8B, 0xF7, 0x29, 0xD6, 0xA7, 0x40, 0xB4,
+    0xA5, 0x14, 0x34, 0x38, 0x06, 0xE4, 0x9C, 0x05, 0xB6, 0x99, 0xFE, 0x6C, 0x9F, 0xA0, 0x41, 0xA7,
+    0xC0, 0xA0, 0x57, 0x58, 0xA1, 0x5B, 0xA4, 0x53, 0x26, 0x6C, 0x74, 0x4C, 0xB8, 0xE7, 0x1A, 0x77,
+    0x1D, 0xB9, 0xFD, 0xC3, 0x42, 0x78, 0x69, 0xB1, 0x8A, 0x55, 0xA8, 0x58, 0x43, 0x0E, 0x1E, 0x09,
+    0x9A, 0xCC, 0x6F, 0x52, 0x0F, 0x29, 0xA3, 0x8D, 0xD5, 0xFD, 0x50, 0xAD, 0xDB, 0xFE, 0x7C, 0x4B,
+    0xE1, 0x26, 0x98, 0xC7, 0x6F, 0x92, 0x82, 0x3B, 0x14, 0x31, 0xAB, 0xE7, 0x4E, 0x9A, 0xBB, 0x69,
+    0x74, 0xF4, 0xDD, 0x06, 0x5D, 0x23, 0xDA, 0xE1, 0x3D, 0xF2, 0x2E, 0xC8, 0xFF, 0x3B, 0x05, 0x0F,
+    0x8B, 0xE8, 0x0D, 0x1D, 0xFB, 0xF5, 0x1A, 0x99, 0x11, 0x5C, 0xC6, 0x13, 0x72, 0xDC, 0x65, 0x1E,
+    0x07, 0x37, 0xA7, 0x05, 0xF3, 0xFC, 0x05, 0xDB, 0x43, 0xA9, 0x62, 0x8E, 0x86, 0xE7, 0x30, 0xB5,
+    0x2B, 0x79, 0x1B, 0x81, 0x69, 0x57, 0x58, 0x34, 0x53, 0x94, 0x68, 0xCA, 0x0A, 0x24, 0x05, 0xAF,
+    0xE5, 0x4C, 0x02, 0xAF, 0x5A, 0x93, 0xD9, 0xB0, 0x74, 0xD8, 0x7F, 0x13, 0x00, 0xD1, 0xF7, 0xF6,
+    0x28, 0xAE, 0xA9, 0x4D, 0x54, 0x2C, 0xBB, 0xC2, 0xAC, 0x0F, 0x67, 0xE7, 0xE1, 0x7B, 0x42, 0xEA,
+    0x89, 0x62, 0xA7, 0x0A, 0x2B, 0x4E, 0x06, 0x5E, 0x23, 0x7F, 0xEF, 0xB7, 0x74, 0x1F, 0x19, 0xB4,
+    0xF6, 0xBA, 0x1E, 0x1A, 0xFC, 0xEE, 0x8C, 0x36, 0x1A, 0x4E, 0x38, 0x2D, 0x46, 0x60, 0x1A, 0x44,
+    0x03, 0x94, 0xB0, 0xAA, 0x7D, 0x8C, 0xE0, 0xA9, 0x31, 0x26, 0xAC, 0x59, 0x55, 0x52, 0x44, 0x3A,
+    0xAC, 0x36, 0x30, 0xCA, 0x6B, 0xD6, 0x79, 0xF6, 0x9F, 0xB9, 0x54, 0x93, 0xAB, 0x92, 0xF3, 0xD7,
+    0x05, 0x0B, 0xB0, 0xF9, 0x85, 0x07, 0x75, 0x13, 0x16, 0x9D, 0xDF, 0x92, 0xD7, 0xF9, 0xAC, 0x06,
+    0x91, 0xE7, 0x37, 0x10, 0x01, 0x9C, 0x89, 0xC4, 0xD6, 0xA0, 0xC2, 0xDA, 0x03, 0x1D, 0x31, 0x06,
+    0x31, 0xA7, 0x55, 0x64, 0x92, 0x48, 0xC5, 0x9C, 0x51, 0x80, 0xD8, 0x32, 0x2D, 0x39, 0xEF, 0x58,
+    0xB2, 0xFB, 0x07, 0x72, 0xEF, 0x5F, 0xEF, 0x21, 0x80, 0x33, 0x7E, 0x74, 0x73, 0xC1, 0xE9, 0xF7,
+    0x2D, 0x25, 0x4F, 0x7A, 0x40, 0x96, 0x15, 0xE7, 0xE2, 0x33, 0x71, 0x35, 0x7A, 0x17, 0x06, 0x9E,
+    0xA3, 0x75, 0x40, 0xB1, 0x03, 0x8C, 0x6D, 0x49, 0xDE, 0x67, 0x30, 0x07, 0xB9, 0x86, 0x53, 0x8F,
+    0xA4, 0x66, 0x97, 0x4F, 0x19, 0xCE, 0xF9, 0xA8, 0x4F, 0xD9, 0x3D, 0xF0, 0x7F, 0x5E, 0xD8, 0xF4,
+    0x4C, 0x52, 0x18, 0x6D, 0x6D, 0x49, 0x31, 0x44, 0xEF, 0x1E, 0x1D, 0x1D, 0x0D, 0x3D, 0xD7, 0xC5,
+    0x91, 0xF5, 0xAB, 0xC2, 0x03, 0x4A, 0x92, 0xEF, 0x19, 0xD4, 0x6F, 0x7A, 0xEF, 0x41, 0x7D, 0x8A,
+    0x2A, 0x05, 0x68, 0x7A, 0xC7, 0x4F, 0x24, 0x9F, 0xFE, 0xA4, 0xFF, 0x98, 0x7B, 0x41, 0x05, 0xBA,
+    0x95, 0xBF, 0xA6, 0x97, 0x3B, 0x31, 0x82, 0x12, 0x9B, 0x42, 0x03, 0x2D, 0xCA, 0xA8, 0x9A, 0xD9,
+    0x71, 0x62, 0xD3, 0x3F, 0x57, 0x10, 0x4C, 0x30, 0x4C, 0x2B, 0x09, 0xD9, 0xDC, 0xCD, 0x34, 0xD2,
+    0x7C, 0xE1, 0x36, 0x3E, 0x13, 0xFC, 0x1E, 0xB3, 0x0B, 0x71, 0xEC, 0x8D, 0x71, 0x3B, 0xC1, 0x6D,
+    0x78, 0xBC, 0x66, 0x88, 0x83, 0x2A, 0x21, 0x26, 0x09, 0x6A, 0x76, 0xAD, 0x82, 0x61, 0xCD, 0x8E,
+    0x78, 0x5E, 0x71, 0x25, 0x56, 0xE6, 0xD8, 0x2C, 0xF9, 0xEB, 0xEB, 0x62, 0xB8, 0xFF, 0xDF, 0xB4,
+    0x76, 0xB5, 0xA0, 0xF0, 0x55, 0xEF, 0xAA, 0xC3, 0xFE, 0x37, 0xB6, 0x02, 0xBC, 0xFB, 0x4A, 0x6E,
+    0x09, 0x6F, 0x94, 0xD8, 0x81, 0xA3, 0x50, 0x39, 0x4E, 0x13, 0xED, 0x07, 0x4B, 0x68, 0xB4, 0x84,
+    0x59, 0xB8, 0xDD, 0xC2, 0x2C, 0xDC, 0xB2, 0x3B, 0x85, 0xB4, 0xE8, 0xD3, 0xEF, 0xD7, 0xDC, 0xA8,
+    0x2C, 0x0D, 0xB7, 0xEB, 0xE5, 0x93, 0x43, 0x6E, 0x3C, 0x0B, 0xB7, 0xF3, 0x6F, 0x4D, 0xA4, 0x6D,
+    0xBE, 0x9A, 0x69, 0x6E, 0xE0, 0x38, 0xDB, 0x76, 0x7D, 0xB2, 0xCD, 0xC1, 0xE1, 0xAE, 0x1B, 0x47,
+    0x87, 0x69, 0x6F, 0x32, 0x7E, 0xD7, 0x39, 0x97, 0xB2, 0x62, 0xD3, 0x2A, 0x8B, 0xFB, 0x64, 0x11,
+    0x13, 0xC8, 0xB8, 0xE6, 0xB3, 0x78, 0x92, 0x70, 0x44, 0x33, 0x94, 0x3B, 0xB2, 0x7A, 0xA1, 0x70,
+    0x61, 0x6E, 0x51, 0x6D, 0x06, 0x94, 0x6C, 0x69, 0x45, 0x6E, 0x17, 0x9E, 0xAD, 0x91, 0xBC, 0xAD,
+    0x4D, 0xEC, 0x37, 0x22, 0xB7, 0x71, 0xBB, 0xA3, 0xAD, 0x6F, 0x65, 0x85, 0x84, 0xB7, 0xF8, 0x56,
+    0xEE, 0xCA, 0xBE, 0x89, 0x2D, 0xFB, 0x3C, 0xD7, 0x7C, 0x54, 0xD7, 0x81, 0xAB, 0x22, 0x43, 0x63,
+    0xCB, 0xAF, 0xB8, 0xB6, 0x6A, 0x62, 0x3D, 0xA7, 0xCA, 0xA9, 0x11, 0x55, 0x85, 0xD4, 0x3E, 0x74,
+    0xFD, 0xB6, 0x9B, 0x3B, 0xE4, 0xFD, 0x4A, 0x9E, 0x35, 0xF2, 0xCB, 0x46, 0xF0, 0xE4, 0x3D, 0x1B,
+    0xC0, 0x0D, 0xC1, 0x7F, 0x49, 0x23, 0xBC, 0x9E, 0xDD, 0xC3, 0xCD, 0x3D, 0x0D, 0xCB, 0x46, 0x1A,
+    0x87, 0x66, 0xF2, 0x48, 0xC2, 0x53, 0x0F, 0x21, 0x7A, 0x86, 0xC1, 0x1C, 0xA6, 0x68, 0x7A, 0x84,
+    0xCF, 0x5D, 0xAB, 0x74, 0x4E, 0x31, 0xB7, 0x01, 0x28, 0xB6, 0x8D, 0x63, 0xB6, 0xB5, 0x2D, 0xAD,
+    0xA4, 0xF9, 0x30, 0x97, 0x9B, 0x54, 0xD8, 0xD5, 0x2C, 0x9C, 0xA5, 0xD2, 0xB6, 0xD5, 0x36, 0x82,
+    0xD2, 0xBA, 0xF9, 0xD3, 0x92, 0xFA, 0xA0, 0x7D, 0x08, 0x75, 0xC1, 0xAF, 0x98, 0x21, 0xB2, 0x78,
+    0xF1, 0x4A, 0xE2, 0x4A, 0xD6, 0x52, 0xF1, 0x4A, 0x52, 0xCD, 0xEB, 0x48, 0x65, 0x15, 0x99, 0xE2,
+    0x35, 0x64, 0x72, 0x80, 0x60, 0x99, 0xE8, 0x7D, 0xD1, 0xBF, 0x27, 0xB8, 0x9E, 0x8A, 0xD5, 0x9D,
+    0xD8, 0xDC, 0x8A, 0xC5, 0x8D, 0xD8, 0x6B, 0xD8, 0x5A, 0xD4, 0xF6, 0x5C, 0x5D, 0x56, 0x6C, 0x2D,
+    0x32, 0x0A, 0xDB, 0x39, 0x57, 0x7F, 0x79, 0x62, 0x25, 0x20, 0x81, 0x8D, 0x18, 0x0D, 0x0B, 0x11,
+    0x00, 0x99, 0x45, 0x7D, 0xB1, 0x3E, 0x51, 0x57, 0xE0, 0x68, 0xE0, 0xDF, 0xEC, 0x5F, 0x13, 0xCB,
+    0xC5, 0x39, 0x43, 0xD6, 0xF1, 0x02, 0x27, 0x20, 0x71, 0x0C, 0xE8, 0x30, 0x2D, 0x4E, 0x34, 0x9D,
+    0x10, 0x1C, 0xF3, 0x3A, 0xEE, 0xF1, 0x41, 0x05, 0xBD, 0x79, 0x83, 0x3D, 0x4B, 0x47, 0x28, 0xF6,
+    0xD9, 0x36, 0xCC, 0x04, 0xE3, 0xC2, 0x56, 0xC2, 0x81, 0xFD, 0x1A, 0x2D, 0xB2, 0x78, 0xC6, 0x36,
+    0x02, 0xF8, 0x63, 0x99, 0xA6, 0x2C, 0x6D, 0x89, 0x7A, 0xC9, 0x42, 0xC7, 0xE8, 0xF5, 0x8A, 0x7A,
+    0xFE, 0x90, 0x37, 0xEF, 0xE0, 0x64, 0xD6, 0xF3, 0x26, 0x8E, 0x11, 0xE0, 0xD2, 0x8E, 0x0F, 0x6E,
+    0x09, 0x1F, 0xDE, 0xAE, 0x4B, 0x24, 0x35, 0x73, 0x47, 0x1E, 0x63, 0xA3, 0x71, 0xD8, 0x57, 0x0E,
+    0x4A, 0x36, 0x83, 0x13, 0x19, 0xC7, 0x66, 0xEC, 0x22, 0xED, 0x96, 0x8B, 0xC4, 0x81, 0x13, 0x77,
+    0x5D, 0x50, 0x36, 0x4C, 0xD8, 0x72, 0x32, 0xC4, 0x49, 0xE3, 0x71, 0x0E, 0x6C, 0x4C, 0x8A, 0x0D,
+    0x84, 0x68, 0xA7, 0xA2, 0x9B, 0x8A, 0x76, 0x7A, 0xD7, 0xB0, 0xA8, 0x58, 0x28, 0x32, 0x6B, 0x6C,
+    0xCF, 0x0B, 0x0A, 0xCF, 0xA0, 0x9E, 0x4A, 0x4D, 0xFA, 0x31, 0xBD, 0x76, 0x78, 0xE3, 0xAE, 0xAB,
+    0x18, 0xF9, 0x20, 0x96, 0xF5, 0x8F, 0x26, 0x0A, 0xEC, 0x04, 0xD2, 0x63, 0xD1, 0x3F, 0x45, 0xC8,
+    0x8D, 0xAC, 0xD7, 0x0D, 0x1F, 0x78, 0xB1, 0x0E, 0x24, 0x1E, 0xBB, 0xEF, 0x7C, 0x0A, 0xA7, 0xB7,
+    0x1F, 0x21, 0x19, 0x05, 0xBA, 0xEC, 0x0B, 0x16, 0xFA, 0x99, 0x42, 0x95, 0x7C, 0x62, 0xC6, 0xF8,
+    0xBB, 0xD6, 0xBF, 0x50, 0x9E, 0x45, 0x68, 0xC9, 0x83, 0x8A, 0xA2, 0x7F, 0xEB, 0x77, 0xA8, 0xFC,
+    0x80, 0xE7, 0x68, 0x19, 0xA7, 0xEC, 0x6F, 0x13, 0x5A, 0x8F, 0xE1, 0x2F, 0x31, 0xC2, 0x3D, 0x85,
+    0x4B, 0x6E, 0xD8, 0x8D, 0xE6, 0x41, 0x61, 0x1B, 0x76, 0x61, 0xE3, 0x1D, 0x7C, 0x39, 0x96, 0xE2,
+    0x3A, 0x33, 0x59, 0x9D, 0x23, 0x0E, 0xD6, 0xC1, 0xB5, 0x71, 0xE1, 0xCF, 0xAA, 0xD7, 0x2B, 0x3D,
+    0xEF, 0x7C, 0xF6, 0xA4, 0xAC, 0xC9, 0xFB, 0x9C, 0xDD, 0x8C, 0x8B, 0x8B, 0x54, 0x76, 0x2F, 0xD2,
+    0xBC, 0x6F, 0x7E, 0x25, 0x45, 0x8D, 0xA2, 0x17, 0xBE, 0x46, 0xC2, 0xE1, 0x89, 0x90, 0x38, 0x33,
+    0x75, 0xA2, 0xB8, 0x00, 0xC1, 0xF4, 0xF9, 0x27, 0xC7, 0xCC, 0x61, 0x92, 0x8F, 0xB9, 0x86, 0x1E,
+    0x18, 0x81, 0x3D, 0x5E, 0xD2, 0x5E, 0xC6, 0x84, 0x91, 0x3C, 0x44, 0xC2, 0xB3, 0xD9, 0x8E, 0x53,
+    0x1D, 0x9F, 0x96, 0x6D, 0x92, 0xB3, 0x19, 0x4E, 0xD2, 0xDB, 0x28, 0x1C, 0x12, 0xDB, 0xD2, 0xD4,
+    0x68, 0x8E, 0x12, 0x65, 0x38, 0xF8, 0x79, 0x92, 0xC7, 0xD5, 0x8F, 0xE0, 0xEF, 0x7F, 0xEC, 0xF8,
+    0x59, 0x05, 0xE2, 0x8F, 0x1F, 0x93, 0x64, 0x9F, 0xE2, 0xA4, 0xF2, 0xDD, 0xF0, 0x6D, 0xA6, 0x37,
+    0x26, 0xD2, 0xD8, 0x13, 0x08, 0x9C, 0x15, 0x41, 0xB5, 0x1A, 0x99, 0x51, 0x64, 0xB6, 0xC3, 0xDA,
+    0x70, 0x00, 0x80, 0x0C, 0x02, 0x79, 0xCC, 0x63, 0x83, 0x0D, 0xC5, 0xD0, 0x9A, 0x2C, 0x6D, 0x47,
+    0x8E, 0x20, 0x86, 0x29, 0xC3, 0xD7, 0x12, 0x9E, 0xD8, 0x24, 0xA4, 0xF7, 0xC8, 0xAC, 0xC5, 0x66,
+    0xC4, 0x35, 0x1A, 0x5D, 0xA9, 0x69, 0x35, 0x9D, 0xD0, 0x68, 0x9C, 0xAA, 0x9D, 0x9D, 0xB0, 0x6E,
+    0xEE, 0x79, 0xBD, 0x31, 0x5F, 0x64, 0x8B, 0xF7, 0xFA, 0xCF, 0x9D, 0x13, 0xC2, 0xB4, 0xF2, 0x80,
+    0x96, 0x2F, 0xDC, 0x39, 0xBF, 0x88, 0x64, 0x9B, 0xAB, 0x55, 0x9A, 0x3E, 0x0E, 0xE0, 0x84, 0xE7,
+    0x87, 0x1F, 0xA9, 0xF8, 0xFD, 0x3B, 0x55, 0xF4, 0xE7, 0x5F, 0x69, 0xEF, 0x3F, 0x3F, 0xC5, 0x72,
+    0x5A, 0x3A, 0x3F, 0x7E, 0xD4, 0xC1, 0xA7, 0xBA, 0xDB, 0xA9, 0x59, 0xA1, 0xCF, 0x50, 0x21, 0xFE,
+    0xE3, 0xB7, 0x45, 0xFC, 0xF0, 0xFD, 0x3A, 0x0C, 0x1F, 0x68, 0x09, 0xD6, 0x2B, 0xD3, 0x39, 0x5B,
+    0x9A, 0x32, 0xB5, 0x90, 0xCF, 0xE6, 0x94, 0x7F, 0xC9, 0xF2, 0x2D, 0xB7, 0x9C, 0x16, 0xA8, 0xE4,
+    0x9A, 0xCB, 0x82, 0xF3, 0xE3, 0x6C, 0xC1, 0x9F, 0x16, 0x52, 0xF2, 0x67, 0x24, 0x45, 0xFF, 0x06,
+    0x49, 0xD9, 0xBF, 0x4B, 0x52, 0xF8, 0xDF, 0x27, 0x29, 0xFD, 0x8D, 0x14, 0xFF, 0x40, 0x69, 0x7B,
+    0xAE, 0x4A, 0x9F, 0x32, 0x2A, 0x13, 0x5F, 0xD0, 0x0D, 0xC2, 0x17, 0xCD, 0x9B, 0xF3, 0x3D, 0xF6,
+    0x39, 0xD9, 0x81, 0xB3, 0x62, 0x11, 0x4D, 0xC9, 0x9C, 0xB8, 0xE2, 0x1E, 0xAF, 0x38, 0xDB, 0xEC,
+    0xB0, 0x99, 0x16, 0xAF, 0x5B, 0xC8, 0x2B, 0x9C, 0x31, 0x4B, 0x05, 0xF6, 0xC4, 0xCA, 0xA2, 0x16,
+    0xAE, 0x13, 0x36, 0xAC, 0x60, 0x61, 0x16, 0x99, 0xFC, 0x62, 0x10, 0xDE, 0x64, 0xD0, 0x3C, 0x78,
+    0x96, 0xCA, 0x39, 0xF7, 0x8A, 0x02, 0x11, 0x99, 0x4D, 0xC3, 0xCE, 0xC2, 0x1E, 0xAF, 0x92, 0x56,
+    0xBE, 0x26, 0x1C, 0x86, 0x7E, 0x53, 0x60, 0xE5, 0x81, 0x4F, 0x3F, 0x15, 0x72, 0x10, 0x7B, 0x96,
+    0x12, 0x24, 0x0F, 0x1C, 0x91, 0xE0, 0x6B, 0x5D, 0xCE, 0x02, 0xA9, 0x28, 0x68, 0x97, 0xBE, 0x3A,
+    0x54, 0xAF, 0x4D, 0x95, 0xCE, 0xE6, 0x18, 0x58, 0xFF, 0x16, 0xED, 0xF8, 0x75, 0xA6, 0x76, 0x82,
+    0x26, 0x87, 0xC0, 0x72, 0x76, 0x78, 0x39, 0x3B, 0x7C, 0x6B, 0x41, 0xE4, 0xC3, 0x13, 0xC6, 0xF6,
+    0x69, 0x77, 0x31, 0xCC, 0x37, 0x56, 0x01, 0x8B, 0x94, 0x7F, 0xB2, 0xF3, 0x94, 0xAA, 0x04, 0x60,
+    0x4B, 0xF3, 0x09, 0xF1, 0x6B, 0xFE, 0x4B, 0x91, 0xC2, 0x73, 0xF7, 0x54, 0x69, 0x19, 0x49, 0x96,
+    0x9F, 0x15, 0xA6, 0xCA, 0x3E, 0xCB, 0xB2, 0x77, 0x6E, 0x38, 0x08, 0xEC, 0xAF, 0x25, 0xD0, 0xC1,
+    0x9B, 0x7F, 0xB1, 0x4F, 0x48, 0x02, 0xFD, 0x9C, 0x4F, 0x6F, 0xDE, 0xAA, 0x42, 0x7E, 0xD5, 0xCF,
+    0xF5, 0x14, 0xA6, 0xBC, 0xC8, 0xBA, 0xB4, 0x8D, 0x4D, 0x54, 0x07, 0xFA, 0xB2, 0xA3, 0xEC, 0xD3,
+    0x1B, 0x4F, 0x05, 0x38, 0xA8, 0xC5, 0x26, 0x69, 0xB2, 0xAE, 0xBC, 0xB8, 0xFC, 0x48, 0xBF, 0x88,
+    0xEA, 0xD5, 0xF5, 0x93, 0xAB, 0xA3, 0x51, 0x6C, 0x2E, 0x3F, 0x27, 0x56, 0x58, 0xBC, 0x59, 0x7C,
+    0x13, 0x64, 0xFE, 0x07, 0xC5, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x27, 0xCE, 0x20,
     0xAF, 0xC4, 0xB8, 0x88, 0x1B, 0x04, 0xB7, 0x74, 0x40, 0x84, 0xBD, 0x0D, 0x12, 0x29, 0xD6, 0x9E,
     0x21, 0x42, 0x72, 0x89, 0x8B, 0xB8, 0x42, 0xA2, 0x46, 0x91, 0x12, 0x51, 0x50, 0x5C, 0x71, 0xCE,
     0x2D, 0x20, 0xA5, 0x36, 0xFC, 0x05, 0x2E, 0x68, 0xE2, 0x48, 0x24, 0xC5, 0x15, 0x27, 0x64, 0x9F,
@@ -2778,44 +2808,22 @@ static const uint8_t notoserif_16_italicBitmaps[45040] = {
     0x42, 0x2A, 0x50, 0xA0, 0x3F, 0x42, 0xF4, 0x66, 0xC4, 0x8A, 0x3B, 0xE5, 0x46, 0x1A, 0xD6, 0x5B,
     0x9C, 0xF3, 0x92, 0x13, 0xED, 0x4E, 0x43, 0x85, 0x66, 0x63, 0xB9, 0x44, 0x78, 0x2C, 0xC3, 0xF0,
     0xE7, 0xAD, 0xFF, 0x02, 0x13, 0x0D, 0x75, 0xB0, 0xFF, 0x7F, 0xA1, 0xFE, 0xFF, 0x05, 0x06, 0x06,
-    0x06, 0x00, 0xDD, 0x54, 0x31, 0x92, 0xD3, 0x40, 0x10, 0x1C, 0x59, 0xC5, 0x1D, 0x55, 0x0A, 0xE4,
-    0x00, 0x12, 0x08, 0x94, 0x93, 0xEC, 0x07, 0x00, 0xC9, 0xBC, 0xE0, 0x72, 0x9E, 0x40, 0xC0, 0x0B,
-    0x4E, 0xD2, 0x13, 0xFC, 0x03, 0x08, 0x88, 0x2E, 0xBE, 0x10, 0xEB, 0x44, 0x4C, 0xA2, 0x84, 0xDC,
-    0x4F, 0x50, 0xA0, 0x40, 0x81, 0xE4, 0x65, 0x7A, 0x7A, 0xA5, 0xB3, 0x09, 0x28, 0x8A, 0x0C, 0x9C,
-    0xB4, 0x2D, 0x7B, 0x67, 0xBB, 0xDB, 0xDD, 0x23, 0x22, 0x72, 0x23, 0xAF, 0xF6, 0x0A, 0x99, 0x7F,
-    0xE7, 0x47, 0xC5, 0x32, 0xFB, 0xDE, 0x4D, 0x8A, 0x53, 0xF2, 0xA9, 0xFE, 0x2A, 0xB2, 0x19, 0x9E,
-    0xE4, 0x72, 0x2F, 0x12, 0xF7, 0x92, 0xEB, 0x53, 0xB9, 0x3E, 0x4A, 0x03, 0x4C, 0x3A, 0x39, 0x28,
-    0x44, 0x1F, 0xBD, 0xF7, 0xFA, 0xF3, 0x58, 0xC1, 0x8E, 0x67, 0x6D, 0x84, 0xD3, 0x92, 0xD5, 0x1B,
-    0x7C, 0x14, 0x57, 0x6C, 0x06, 0x60, 0x8E, 0x09, 0x67, 0x58, 0x61, 0x92, 0xBE, 0x1A, 0x49, 0x0C,
-    0x67, 0x49, 0x3B, 0xE0, 0x24, 0x69, 0x7B, 0x86, 0xD1, 0xA8, 0x93, 0x14, 0x75, 0x98, 0x2B, 0x14,
-    0xE3, 0x81, 0x34, 0x56, 0x3A, 0xBD, 0x4E, 0xBA, 0xA4, 0x35, 0x03, 0xF5, 0xF0, 0x44, 0x24, 0x1D,
-    0x57, 0x5F, 0xD2, 0x38, 0xE0, 0x97, 0x22, 0x1F, 0xC6, 0xAB, 0x07, 0x8C, 0xAF, 0xF6, 0x89, 0xB1,
-    0xC5, 0x8D, 0x77, 0x85, 0xF1, 0x37, 0x35, 0x52, 0xC6, 0x36, 0x6E, 0x8C, 0x00, 0x9B, 0x5E, 0x06,
-    0xDE, 0x1D, 0xAE, 0x0C, 0x37, 0x06, 0x1F, 0x82, 0x0D, 0x74, 0xC1, 0xD4, 0x67, 0x75, 0x3C, 0x98,
-    0x07, 0x76, 0x24, 0x07, 0x5B, 0x83, 0xA3, 0x19, 0x60, 0x27, 0x1B, 0xEA, 0x9C, 0x09, 0x93, 0x9E,
-    0x24, 0xD4, 0xA6, 0x1D, 0x9A, 0x75, 0x52, 0x5E, 0xAC, 0xCA, 0x21, 0x7C, 0x67, 0xBA, 0x9D, 0x37,
-    0x0E, 0xE9, 0x68, 0x1C, 0xA2, 0x42, 0x82, 0x73, 0x0B, 0xB8, 0x5A, 0xA8, 0x58, 0x28, 0x58, 0x4C,
-    0xAF, 0x41, 0xB5, 0x97, 0x55, 0xED, 0x8E, 0x6A, 0x3D, 0x54, 0x97, 0x1B, 0x6F, 0x6A, 0xE5, 0x81,
-    0x6A, 0x2B, 0x5E, 0xD8, 0x50, 0xED, 0x4C, 0xB5, 0x93, 0xA9, 0x6D, 0xA9, 0xF6, 0xDB, 0x3F, 0xA5,
-    0x56, 0xB3, 0xFE, 0xE2, 0x0B, 0xF5, 0xEE, 0xBC, 0xAF, 0x99, 0xF6, 0x63, 0xDE, 0x85, 0xB8, 0x83,
-    0x8D, 0xE5, 0x3D, 0x2B, 0x1E, 0x13, 0x86, 0x5B, 0x4B, 0x39, 0x8B, 0x3C, 0x33, 0x8F, 0xE3, 0x16,
-    0x7A, 0x9B, 0x63, 0xA9, 0x07, 0x6F, 0x8B, 0x7D, 0x4E, 0x17, 0x28, 0xC1, 0x12, 0x57, 0x2D, 0x6F,
-    0x9A, 0x25, 0xFA, 0x33, 0xB3, 0x6F, 0x76, 0x32, 0xFC, 0x53, 0x48, 0x7D, 0x34, 0x06, 0x6B, 0x60,
-    0xAA, 0xE5, 0x1F, 0xD1, 0xB5, 0x02, 0xC0, 0x58, 0x1B, 0x6B, 0x6F, 0x40, 0x30, 0x1E, 0xB6, 0xEC,
-    0x40, 0xEC, 0xFB, 0x50, 0x02, 0xE5, 0xC3, 0x16, 0x3C, 0x7B, 0xAC, 0xC1, 0xDA, 0x83, 0xB5, 0x08,
-    0x6B, 0x13, 0x96, 0x2A, 0x58, 0x17, 0x0A, 0xB9, 0x2C, 0x83, 0x39, 0xF6, 0x79, 0xBB, 0x38, 0x36,
-    0x04, 0xC7, 0x5C, 0x1F, 0x1C, 0x4B, 0xFB, 0xE0, 0x18, 0x4A, 0x6C, 0x84, 0x30, 0x4B, 0x09, 0x95,
-    0x56, 0x67, 0x7D, 0x7A, 0x00, 0x07, 0x6E, 0x09, 0xB5, 0x97, 0x6B, 0xC2, 0x2D, 0x8E, 0xB9, 0xFF,
-    0xD0, 0xB1, 0x75, 0x7F, 0xF4, 0x5C, 0x6F, 0x13, 0xB7, 0xD8, 0x2D, 0x97, 0xD7, 0x5B, 0x86, 0xBA,
-    0x64, 0xAE, 0x0E, 0x6B, 0xA3, 0x54, 0x4E, 0x82, 0x05, 0x92, 0xB6, 0x39, 0x20, 0x34, 0xCA, 0xFD,
-    0xD2, 0xA8, 0xF8, 0x8F, 0x1B, 0xE5, 0x7E, 0xD7, 0xA8, 0xA2, 0x80, 0x03, 0x99, 0x6F, 0x31, 0x29,
-    0x39, 0x71, 0x87, 0xDD, 0xFC, 0xE5, 0xFE, 0x30, 0xB5, 0xCE, 0xA2, 0xA1, 0x4B, 0xF2, 0x96, 0x57,
-    0x38, 0xEA, 0x43, 0x8F, 0x92, 0x15, 0x72, 0x3E, 0xD4, 0x7F, 0xF6, 0xA5, 0xEF, 0xAF, 0xFC, 0x49,
-    0x9A, 0xF7, 0x43, 0xEA, 0x4F, 0xD1, 0xA0, 0x0C, 0x67, 0x9C, 0x1A, 0x94, 0xB8, 0x42, 0x4F, 0x00,
-    0x7F, 0x6C, 0x5F, 0x75, 0x3F, 0x42, 0xD9, 0xF4, 0x86, 0x6A, 0xB4, 0x2F, 0x12, 0xCF, 0xDD, 0xE2,
-    0x6B, 0x73, 0xC2, 0xB5, 0xCA, 0xFF, 0xA9, 0xD2, 0x56, 0xE2, 0xAF, 0x25, 0x01, 0xBC, 0xE1, 0x27,
-    0x34, 0x39, 0xED, 0xB6, 0xEE, 0x87, 0xE6, 0xC6, 0xF7, 0xD7, 0x4A, 0x32, 0xD6, 0x49, 0xCF, 0x05,
-    0xFF, 0xF4, 0x4F, 0x4D, 0x8F, 0xD1, 0x0D, 0xC3, 0x20, 0x0C, 0x44, 0x51, 0x19, 0xC0, 0x03, 0xF4,
+    0x06, 0x00, 0x3D, 0x90, 0xB1, 0x51, 0xC4, 0x30, 0x10, 0x45, 0xBF, 0xF0, 0x0C, 0x66, 0x46, 0x81,
+    0x08, 0x20, 0x22, 0x70, 0x09, 0x6A, 0x00, 0x4E, 0x2A, 0x81, 0x9C, 0x12, 0xA8, 0x01, 0xEC, 0x12,
+    0xA8, 0x83, 0x1E, 0xCE, 0xA3, 0x12, 0x9C, 0x90, 0x53, 0x82, 0x02, 0x05, 0x0E, 0xCE, 0xD6, 0xFD,
+    0x5D, 0x79, 0x6E, 0x03, 0xBD, 0x91, 0xE4, 0xBF, 0xFB, 0x64, 0x00, 0xE6, 0x37, 0x82, 0x35, 0xD4,
+    0x2C, 0x98, 0x71, 0xE1, 0x6A, 0x56, 0x7C, 0x11, 0x5D, 0xC1, 0x49, 0x90, 0xF1, 0x4D, 0xF4, 0xFF,
+    0x38, 0x13, 0x76, 0xD1, 0x4F, 0xDC, 0x62, 0x2B, 0xE9, 0x52, 0x10, 0x0C, 0xE9, 0x6E, 0xE5, 0xA1,
+    0x9F, 0x18, 0x21, 0x62, 0x27, 0xCD, 0x02, 0x0E, 0x30, 0x09, 0x8C, 0x92, 0x94, 0x01, 0x2E, 0x11,
+    0x5B, 0xC3, 0x85, 0x49, 0x85, 0x9F, 0x74, 0xAA, 0xA7, 0x0B, 0x3B, 0x85, 0xA8, 0xC3, 0x43, 0x1B,
+    0x1E, 0x62, 0x44, 0x9F, 0x69, 0x98, 0xA4, 0x93, 0xDD, 0xD5, 0x01, 0xEF, 0x68, 0x2D, 0x6E, 0x90,
+    0x16, 0x3A, 0x4E, 0xEB, 0xAC, 0xEB, 0xE7, 0xAA, 0x18, 0x7F, 0x70, 0xD4, 0xF1, 0x5A, 0x5F, 0xC5,
+    0xD3, 0x6C, 0xED, 0x99, 0x19, 0xBE, 0xBD, 0x6F, 0xE0, 0xA5, 0xBD, 0x21, 0xB4, 0xC3, 0x11, 0x78,
+    0xA9, 0xF9, 0xBE, 0xEE, 0x98, 0x3F, 0x8A, 0xAB, 0xBB, 0x29, 0x34, 0xDC, 0x24, 0x55, 0x28, 0x4E,
+    0xE4, 0x06, 0xF1, 0xEF, 0x36, 0xFA, 0x17, 0x98, 0x3A, 0x89, 0x3F, 0xC6, 0x55, 0x2F, 0x6C, 0x15,
+    0x7F, 0xA0, 0x4E, 0xFA, 0x27, 0x7C, 0xA2, 0xFF, 0x03, 0xB5, 0x29, 0xFE, 0x0A, 0x2B, 0x78, 0x6B,
+    0xBB, 0xC0, 0xD1, 0x6E, 0x79, 0xF4, 0x7F, 0x33, 0x33, 0xB9, 0xA7, 0x64, 0xC7, 0x4E, 0xCF, 0xCC,
+    0x3C, 0xE1, 0x0A, 0x4D, 0x8F, 0xD1, 0x0D, 0xC3, 0x20, 0x0C, 0x44, 0x51, 0x19, 0xC0, 0x03, 0xF4,
     0x83, 0x11, 0x18, 0xC1, 0x8C, 0xD0, 0x8D, 0x32, 0x59, 0x05, 0x23, 0x30, 0x42, 0x46, 0xE0, 0x83,
     0x4A, 0xE9, 0x07, 0xBD, 0x1E, 0x46, 0x89, 0xE2, 0x9F, 0xB3, 0xEC, 0x67, 0xDD, 0xD9, 0xB9, 0xAB,
     0x7C, 0x5A, 0x2A, 0x75, 0xA9, 0xF6, 0xA5, 0x18, 0x6B, 0x0D, 0x18, 0x20, 0x80, 0x01, 0xFA, 0x7A,
@@ -2831,99 +2839,99 @@ static const EpdGlyph notoserif_16_italicGlyphs[] = {
     { 0, 0, 139, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 139, 0, 0, 0, 0 }, // U+0020
     { 9, 25, 178, 2, 24, 57, 0 }, // !
-    { 11, 9, 218, 4, 24, 25, 57 }, // "
-    { 19, 24, 298, 0, 24, 114, 82 }, // #
-    { 18, 29, 298, 0, 26, 131, 196 }, // $
-    { 27, 26, 478, 2, 25, 176, 327 }, // %
-    { 25, 26, 396, 1, 25, 163, 503 }, // &
-    { 5, 9, 117, 4, 24, 12, 666 }, // '
-    { 13, 31, 185, 1, 26, 101, 678 }, // (
-    { 13, 31, 185, -2, 26, 101, 779 }, // )
-    { 15, 14, 267, 3, 26, 53, 880 }, // *
-    { 15, 16, 298, 2, 20, 60, 933 }, // +
-    { 7, 10, 133, -1, 5, 18, 993 }, // ,
-    { 10, 4, 165, 0, 11, 10, 1011 }, // -
-    { 6, 6, 133, 0, 5, 9, 1021 }, // .
-    { 17, 31, 154, -4, 26, 132, 1030 }, // /
-    { 17, 26, 298, 1, 25, 111, 1162 }, // 0
-    { 14, 24, 245, -1, 24, 84, 1273 }, // 1
-    { 18, 25, 298, -1, 25, 113, 1357 }, // 2
-    { 19, 26, 298, -1, 25, 124, 1470 }, // 3
-    { 19, 24, 298, -1, 24, 114, 1594 }, // 4
-    { 18, 25, 298, 0, 24, 113, 1708 }, // 5
-    { 17, 26, 298, 2, 25, 111, 1821 }, // 6
-    { 18, 24, 298, 2, 24, 108, 1932 }, // 7
-    { 18, 26, 298, 0, 25, 117, 2040 }, // 8
-    { 17, 26, 298, 1, 25, 111, 2157 }, // 9
-    { 8, 19, 153, 1, 18, 38, 2268 }, // :
-    { 10, 23, 153, -1, 18, 58, 2306 }, // ;
-    { 15, 18, 298, 2, 21, 68, 2364 }, // <
-    { 15, 10, 298, 2, 17, 38, 2432 }, // =
-    { 15, 18, 298, 2, 21, 68, 2470 }, // >
-    { 14, 26, 267, 4, 25, 91, 2538 }, // ?
-    { 27, 29, 491, 2, 24, 196, 2629 }, // @
-    { 24, 24, 376, -2, 24, 144, 2825 }, // A
-    { 22, 24, 349, -1, 24, 132, 2969 }, // B
-    { 21, 26, 334, 1, 25, 137, 3101 }, // C
-    { 25, 24, 387, -1, 24, 150, 3238 }, // D
-    { 23, 24, 332, -1, 24, 138, 3388 }, // E
-    { 23, 24, 315, -1, 24, 138, 3526 }, // F
-    { 23, 26, 381, 1, 25, 150, 3664 }, // G
-    { 30, 24, 423, -1, 24, 180, 3814 }, // H
-    { 16, 24, 196, -1, 24, 96, 3994 }, // I
-    { 20, 32, 190, -6, 24, 160, 4090 }, // J
-    { 27, 24, 373, -1, 24, 162, 4250 }, // K
-    { 20, 24, 332, -1, 24, 120, 4412 }, // L
-    { 35, 24, 500, -1, 24, 210, 4532 }, // M
-    { 29, 24, 407, -1, 24, 174, 4742 }, // N
-    { 23, 26, 396, 1, 25, 150, 4916 }, // O
-    { 22, 24, 331, -1, 24, 132, 5066 }, // P
-    { 23, 33, 396, 1, 25, 190, 5198 }, // Q
-    { 22, 24, 354, -1, 24, 132, 5388 }, // R
-    { 19, 26, 290, 0, 25, 124, 5520 }, // S
-    { 21, 24, 327, 2, 24, 126, 5644 }, // T
-    { 24, 25, 389, 3, 24, 150, 5770 }, // U
-    { 24, 24, 360, 2, 24, 144, 5920 }, // V
-    { 36, 24, 557, 2, 24, 216, 6064 }, // W
-    { 27, 24, 352, -2, 24, 162, 6280 }, // X
-    { 22, 24, 333, 2, 24, 132, 6442 }, // Y
-    { 23, 24, 323, -1, 24, 138, 6574 }, // Z
-    { 14, 31, 192, 0, 26, 109, 6712 }, // [
-    { 5, 31, 154, 3, 26, 39, 6821 }, // <backslash>
-    { 15, 31, 192, -2, 26, 117, 6860 }, // ]
-    { 16, 16, 298, 1, 24, 64, 6977 }, // ^
-    { 17, 3, 245, -4, -2, 13, 7041 }, // _
-    { 7, 6, 149, 4, 26, 11, 7054 }, // `
-    { 19, 20, 309, 1, 19, 95, 7065 }, // a
-    { 18, 27, 300, 0, 26, 122, 7160 }, // b
-    { 16, 20, 260, 1, 19, 80, 7282 }, // c
-    { 19, 27, 309, 1, 26, 129, 7362 }, // d
-    { 15, 20, 263, 1, 19, 75, 7491 }, // e
-    { 22, 34, 170, -5, 26, 187, 7566 }, // f
-    { 22, 28, 296, -2, 20, 154, 7753 }, // g
-    { 19, 27, 319, 1, 26, 129, 7907 }, // h
-    { 8, 27, 162, 2, 26, 54, 8036 }, // i
-    { 15, 34, 155, -5, 26, 128, 8090 }, // j
-    { 19, 27, 303, 1, 26, 129, 8218 }, // k
-    { 8, 27, 162, 2, 26, 54, 8347 }, // l
-    { 29, 20, 478, 1, 19, 145, 8401 }, // m
-    { 19, 20, 319, 1, 19, 95, 8546 }, // n
-    { 17, 20, 306, 1, 19, 85, 8641 }, // o
-    { 19, 27, 308, -1, 19, 129, 8726 }, // p
-    { 17, 27, 299, 1, 19, 115, 8855 }, // q
-    { 15, 19, 250, 1, 19, 72, 8970 }, // r
-    { 15, 20, 247, 0, 19, 75, 9042 }, // s
-    { 11, 23, 196, 2, 22, 64, 9117 }, // t
-    { 19, 19, 319, 1, 18, 91, 9181 }, // u
-    { 17, 20, 287, 0, 19, 85, 9272 }, // v
-    { 26, 20, 437, 1, 19, 130, 9357 }, // w
-    { 20, 18, 291, -1, 18, 90, 9487 }, // x
-    { 23, 27, 282, -6, 19, 156, 9577 }, // y
-    { 17, 18, 272, -1, 18, 77, 9733 }, // z
-    { 15, 31, 228, 2, 26, 117, 9810 }, // {
-    { 3, 34, 298, 8, 26, 26, 9927 }, // |
-    { 15, 31, 228, -2, 26, 117, 9953 }, // }
-    { 16, 7, 298, 1, 15, 28, 10070 }, // ~
+    { 11, 9, 218, 4, 24, 25, 0 }, // "
+    { 19, 24, 298, 0, 24, 114, 25 }, // #
+    { 18, 29, 298, 0, 26, 131, 139 }, // $
+    { 27, 26, 478, 2, 25, 176, 270 }, // %
+    { 25, 26, 396, 1, 25, 163, 446 }, // &
+    { 5, 9, 117, 4, 24, 12, 609 }, // '
+    { 13, 31, 185, 1, 26, 101, 57 }, // (
+    { 13, 31, 185, -2, 26, 101, 158 }, // )
+    { 15, 14, 267, 3, 26, 53, 621 }, // *
+    { 15, 16, 298, 2, 20, 60, 674 }, // +
+    { 7, 10, 133, -1, 5, 18, 259 }, // ,
+    { 10, 4, 165, 0, 11, 10, 277 }, // -
+    { 6, 6, 133, 0, 5, 9, 287 }, // .
+    { 17, 31, 154, -4, 26, 132, 734 }, // /
+    { 17, 26, 298, 1, 25, 111, 296 }, // 0
+    { 14, 24, 245, -1, 24, 84, 407 }, // 1
+    { 18, 25, 298, -1, 25, 113, 491 }, // 2
+    { 19, 26, 298, -1, 25, 124, 604 }, // 3
+    { 19, 24, 298, -1, 24, 114, 728 }, // 4
+    { 18, 25, 298, 0, 24, 113, 842 }, // 5
+    { 17, 26, 298, 2, 25, 111, 955 }, // 6
+    { 18, 24, 298, 2, 24, 108, 1066 }, // 7
+    { 18, 26, 298, 0, 25, 117, 1174 }, // 8
+    { 17, 26, 298, 1, 25, 111, 1291 }, // 9
+    { 8, 19, 153, 1, 18, 38, 1402 }, // :
+    { 10, 23, 153, -1, 18, 58, 1440 }, // ;
+    { 15, 18, 298, 2, 21, 68, 866 }, // <
+    { 15, 10, 298, 2, 17, 38, 934 }, // =
+    { 15, 18, 298, 2, 21, 68, 972 }, // >
+    { 14, 26, 267, 4, 25, 91, 1498 }, // ?
+    { 27, 29, 491, 2, 24, 196, 1040 }, // @
+    { 24, 24, 376, -2, 24, 144, 1589 }, // A
+    { 22, 24, 349, -1, 24, 132, 1733 }, // B
+    { 21, 26, 334, 1, 25, 137, 1865 }, // C
+    { 25, 24, 387, -1, 24, 150, 2002 }, // D
+    { 23, 24, 332, -1, 24, 138, 2152 }, // E
+    { 23, 24, 315, -1, 24, 138, 2290 }, // F
+    { 23, 26, 381, 1, 25, 150, 2428 }, // G
+    { 30, 24, 423, -1, 24, 180, 2578 }, // H
+    { 16, 24, 196, -1, 24, 96, 2758 }, // I
+    { 20, 32, 190, -6, 24, 160, 2854 }, // J
+    { 27, 24, 373, -1, 24, 162, 3014 }, // K
+    { 20, 24, 332, -1, 24, 120, 3176 }, // L
+    { 35, 24, 500, -1, 24, 210, 3296 }, // M
+    { 29, 24, 407, -1, 24, 174, 3506 }, // N
+    { 23, 26, 396, 1, 25, 150, 3680 }, // O
+    { 22, 24, 331, -1, 24, 132, 3830 }, // P
+    { 23, 33, 396, 1, 25, 190, 3962 }, // Q
+    { 22, 24, 354, -1, 24, 132, 4152 }, // R
+    { 19, 26, 290, 0, 25, 124, 4284 }, // S
+    { 21, 24, 327, 2, 24, 126, 4408 }, // T
+    { 24, 25, 389, 3, 24, 150, 1236 }, // U
+    { 24, 24, 360, 2, 24, 144, 4534 }, // V
+    { 36, 24, 557, 2, 24, 216, 4678 }, // W
+    { 27, 24, 352, -2, 24, 162, 4894 }, // X
+    { 22, 24, 333, 2, 24, 132, 5056 }, // Y
+    { 23, 24, 323, -1, 24, 138, 5188 }, // Z
+    { 14, 31, 192, 0, 26, 109, 1386 }, // [
+    { 5, 31, 154, 3, 26, 39, 1495 }, // <backslash>
+    { 15, 31, 192, -2, 26, 117, 1534 }, // ]
+    { 16, 16, 298, 1, 24, 64, 1651 }, // ^
+    { 17, 3, 245, -4, -2, 13, 1715 }, // _
+    { 7, 6, 149, 4, 26, 11, 1728 }, // `
+    { 19, 20, 309, 1, 19, 95, 5326 }, // a
+    { 18, 27, 300, 0, 26, 122, 5421 }, // b
+    { 16, 20, 260, 1, 19, 80, 5543 }, // c
+    { 19, 27, 309, 1, 26, 129, 5623 }, // d
+    { 15, 20, 263, 1, 19, 75, 5752 }, // e
+    { 22, 34, 170, -5, 26, 187, 5827 }, // f
+    { 22, 28, 296, -2, 20, 154, 6014 }, // g
+    { 19, 27, 319, 1, 26, 129, 6168 }, // h
+    { 8, 27, 162, 2, 26, 54, 6297 }, // i
+    { 15, 34, 155, -5, 26, 128, 6351 }, // j
+    { 19, 27, 303, 1, 26, 129, 6479 }, // k
+    { 8, 27, 162, 2, 26, 54, 6608 }, // l
+    { 29, 20, 478, 1, 19, 145, 6662 }, // m
+    { 19, 20, 319, 1, 19, 95, 6807 }, // n
+    { 17, 20, 306, 1, 19, 85, 6902 }, // o
+    { 19, 27, 308, -1, 19, 129, 6987 }, // p
+    { 17, 27, 299, 1, 19, 115, 7116 }, // q
+    { 15, 19, 250, 1, 19, 72, 7231 }, // r
+    { 15, 20, 247, 0, 19, 75, 7303 }, // s
+    { 11, 23, 196, 2, 22, 64, 7378 }, // t
+    { 19, 19, 319, 1, 18, 91, 7442 }, // u
+    { 17, 20, 287, 0, 19, 85, 7533 }, // v
+    { 26, 20, 437, 1, 19, 130, 7618 }, // w
+    { 20, 18, 291, -1, 18, 90, 7748 }, // x
+    { 23, 27, 282, -6, 19, 156, 7838 }, // y
+    { 17, 18, 272, -1, 18, 77, 7994 }, // z
+    { 15, 31, 228, 2, 26, 117, 1739 }, // {
+    { 3, 34, 298, 8, 26, 26, 1856 }, // |
+    { 15, 31, 228, -2, 26, 117, 1882 }, // }
+    { 16, 7, 298, 1, 15, 28, 1999 }, // ~
     { 0, 0, 139, 0, 0, 0, 0 }, // U+00A0
     { 9, 25, 178, 0, 19, 57, 0 }, // U+00A1
     { 16, 24, 298, 2, 24, 96, 57 }, // U+00A2
@@ -3007,19 +3015,19 @@ static const EpdGlyph notoserif_16_italicGlyphs[] = {
     { 17, 27, 306, 1, 26, 115, 9674 }, // U+00F0
     { 19, 26, 319, 1, 25, 124, 9789 }, // U+00F1
     { 17, 27, 306, 1, 26, 115, 9913 }, // U+00F2
-    { 17, 27, 306, 1, 26, 115, 10028 }, // U+00F3
-    { 17, 27, 306, 1, 26, 115, 10143 }, // U+00F4
-    { 18, 26, 306, 1, 25, 117, 10258 }, // U+00F5
-    { 17, 26, 306, 1, 25, 111, 10375 }, // U+00F6
-    { 15, 18, 298, 2, 21, 68, 10486 }, // U+00F7
-    { 20, 22, 306, 0, 20, 110, 10554 }, // U+00F8
-    { 19, 27, 319, 1, 26, 129, 10664 }, // U+00F9
-    { 19, 27, 319, 1, 26, 129, 10793 }, // U+00FA
-    { 19, 27, 319, 1, 26, 129, 10922 }, // U+00FB
-    { 19, 26, 319, 1, 25, 124, 11051 }, // U+00FC
-    { 23, 34, 282, -6, 26, 196, 11175 }, // U+00FD
-    { 19, 34, 300, -1, 26, 162, 11371 }, // U+00FE
-    { 23, 33, 282, -6, 25, 190, 11533 }, // U+00FF
+    { 17, 27, 306, 1, 26, 115, 8071 }, // U+00F3
+    { 17, 27, 306, 1, 26, 115, 10028 }, // U+00F4
+    { 18, 26, 306, 1, 25, 117, 10143 }, // U+00F5
+    { 17, 26, 306, 1, 25, 111, 10260 }, // U+00F6
+    { 15, 18, 298, 2, 21, 68, 10371 }, // U+00F7
+    { 20, 22, 306, 0, 20, 110, 10439 }, // U+00F8
+    { 19, 27, 319, 1, 26, 129, 10549 }, // U+00F9
+    { 19, 27, 319, 1, 26, 129, 10678 }, // U+00FA
+    { 19, 27, 319, 1, 26, 129, 10807 }, // U+00FB
+    { 19, 26, 319, 1, 25, 124, 10936 }, // U+00FC
+    { 23, 34, 282, -6, 26, 196, 11060 }, // U+00FD
+    { 19, 34, 300, -1, 26, 162, 11256 }, // U+00FE
+    { 23, 33, 282, -6, 25, 190, 11418 }, // U+00FF
     { 24, 29, 376, -2, 29, 174, 0 }, // U+0100
     { 19, 24, 309, 1, 23, 114, 174 }, // U+0101
     { 24, 31, 376, -2, 31, 186, 288 }, // U+0102
@@ -3721,98 +3729,98 @@ static const EpdGlyph notoserif_16_italicGlyphs[] = {
     { 10, 4, 165, 0, 11, 10, 195 }, // U+2010
     { 10, 4, 165, 0, 11, 10, 205 }, // U+2011
     { 17, 3, 298, 1, 14, 13, 215 }, // U+2012
-    { 19, 3, 267, -1, 10, 15, 228 }, // U+2013
-    { 35, 3, 533, -1, 10, 27, 243 }, // U+2014
-    { 35, 3, 533, -1, 10, 27, 270 }, // U+2015
-    { 9, 34, 298, 5, 26, 77, 297 }, // U+2016
-    { 17, 7, 219, -4, 0, 30, 374 }, // U+2017
-    { 7, 10, 133, 3, 24, 18, 404 }, // U+2018
-    { 7, 10, 133, 2, 24, 18, 422 }, // U+2019
-    { 7, 10, 133, -1, 5, 18, 440 }, // U+201A
-    { 6, 10, 133, 4, 24, 15, 458 }, // U+201B
-    { 14, 10, 240, 3, 24, 35, 473 }, // U+201C
-    { 14, 10, 240, 2, 24, 35, 508 }, // U+201D
-    { 13, 10, 240, -1, 5, 33, 543 }, // U+201E
-    { 12, 10, 240, 4, 24, 30, 576 }, // U+201F
-    { 14, 30, 239, 2, 26, 105, 606 }, // U+2020
-    { 18, 30, 239, -1, 26, 135, 711 }, // U+2021
-    { 10, 10, 193, 1, 17, 25, 846 }, // U+2022
-    { 11, 12, 267, 5, 18, 33, 871 }, // U+2023
-    { 6, 6, 153, 2, 15, 9, 904 }, // U+2024
-    { 15, 6, 286, 2, 15, 23, 913 }, // U+2025
-    { 24, 6, 458, 1, 5, 36, 936 }, // U+2026
-    { 5, 6, 133, 2, 12, 8, 972 }, // U+2027
-    { 0, 0, 320, 0, 0, 0, 980 }, // U+2028
-    { 0, 0, 320, 0, 0, 0, 980 }, // U+2029
-    { 9, 26, 0, -1, 21, 59, 980 }, // U+202A
-    { 9, 26, 0, -8, 21, 59, 1039 }, // U+202B
-    { 8, 28, 0, -4, 23, 56, 1098 }, // U+202C
-    { 8, 28, 0, -4, 23, 56, 1154 }, // U+202D
-    { 8, 28, 0, -4, 23, 56, 1210 }, // U+202E
-    { 0, 0, 89, 0, 0, 0, 1266 }, // U+202F
-    { 40, 26, 685, 2, 25, 260, 1266 }, // U+2030
-    { 53, 26, 892, 2, 25, 345, 1526 }, // U+2031
-    { 7, 9, 117, 3, 24, 16, 1871 }, // U+2032
-    { 13, 9, 218, 3, 24, 30, 1887 }, // U+2033
-    { 19, 9, 318, 3, 24, 43, 1917 }, // U+2034
-    { 5, 9, 117, 4, 24, 12, 1960 }, // U+2035
-    { 11, 9, 218, 4, 24, 25, 1972 }, // U+2036
-    { 18, 9, 318, 4, 24, 41, 1997 }, // U+2037
-    { 11, 10, 213, -1, 2, 28, 2038 }, // U+2038
-    { 9, 14, 178, 2, 16, 32, 2066 }, // U+2039
-    { 10, 14, 178, 0, 16, 35, 2098 }, // U+203A
-    { 24, 24, 437, 2, 24, 144, 2133 }, // U+203B
-    { 17, 25, 299, 2, 24, 107, 2277 }, // U+203C
-    { 14, 26, 267, 4, 25, 91, 2384 }, // U+203D
-    { 17, 3, 245, 3, 28, 13, 2475 }, // U+203E
-    { 26, 7, 0, -25, 0, 46, 2488 }, // U+203F
-    { 26, 7, 0, -20, 28, 46, 2534 }, // U+2040
-    { 16, 24, 240, -2, 24, 96, 2580 }, // U+2041
-    { 31, 27, 533, 1, 26, 210, 2676 }, // U+2042
-    { 11, 6, 193, 1, 15, 17, 2886 }, // U+2043
-    { 20, 24, 33, -9, 24, 120, 2903 }, // U+2044
-    { 14, 31, 192, 0, 26, 109, 3023 }, // U+2045
-    { 15, 31, 192, -2, 26, 117, 3132 }, // U+2046
-    { 30, 26, 521, 4, 25, 195, 3249 }, // U+2047
-    { 22, 26, 420, 4, 25, 143, 3444 }, // U+2048
-    { 25, 26, 416, 2, 25, 163, 3587 }, // U+2049
-    { 16, 25, 298, 1, 19, 100, 3750 }, // U+204A
-    { 19, 30, 329, 2, 26, 143, 3850 }, // U+204B
-    { 18, 13, 318, 2, 19, 59, 3993 }, // U+204C
-    { 18, 13, 318, 2, 19, 59, 4052 }, // U+204D
-    { 15, 14, 267, 1, 19, 53, 4111 }, // U+204E
-    { 7, 25, 153, 1, 19, 44, 4164 }, // U+204F
-    { 22, 26, 389, 2, 25, 143, 4208 }, // U+2050
-    { 18, 28, 267, 0, 26, 126, 4351 }, // U+2051
-    { 12, 25, 175, 0, 24, 75, 4477 }, // U+2052
-    { 16, 7, 298, 2, 15, 28, 4552 }, // U+2053
-    { 27, 7, 0, -7, 0, 48, 4580 }, // U+2054
-    { 16, 16, 288, 2, 20, 64, 4628 }, // U+2055
-    { 16, 20, 327, 1, 19, 80, 4692 }, // U+2056
-    { 25, 9, 418, 3, 24, 57, 4772 }, // U+2057
-    { 19, 20, 378, 2, 19, 95, 4829 }, // U+2058
-    { 19, 20, 378, 1, 19, 95, 4924 }, // U+2059
-    { 5, 26, 153, 3, 25, 33, 5019 }, // U+205A
-    { 19, 26, 378, 2, 25, 124, 5052 }, // U+205B
-    { 19, 18, 372, 1, 18, 86, 5176 }, // U+205C
-    { 5, 26, 153, 3, 25, 33, 5262 }, // U+205D
-    { 5, 26, 153, 2, 25, 33, 5295 }, // U+205E
-    { 0, 0, 118, 0, 0, 0, 5328 }, // U+205F
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2060
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2061
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2062
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2063
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2064
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2066
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2067
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2068
-    { 0, 0, 320, 0, 0, 0, 5328 }, // U+2069
-    { 8, 28, 0, -4, 23, 56, 5328 }, // U+206A
-    { 8, 28, 0, -4, 23, 56, 5384 }, // U+206B
-    { 8, 28, 0, -4, 23, 56, 5440 }, // U+206C
-    { 8, 29, 0, -4, 24, 58, 5496 }, // U+206D
-    { 8, 28, 0, -4, 23, 56, 5554 }, // U+206E
-    { 8, 28, 0, -4, 23, 56, 5610 }, // U+206F
+    { 19, 3, 267, -1, 10, 15, 8186 }, // U+2013
+    { 35, 3, 533, -1, 10, 27, 8201 }, // U+2014
+    { 35, 3, 533, -1, 10, 27, 228 }, // U+2015
+    { 9, 34, 298, 5, 26, 77, 255 }, // U+2016
+    { 17, 7, 219, -4, 0, 30, 332 }, // U+2017
+    { 7, 10, 133, 3, 24, 18, 362 }, // U+2018
+    { 7, 10, 133, 2, 24, 18, 8228 }, // U+2019
+    { 7, 10, 133, -1, 5, 18, 380 }, // U+201A
+    { 6, 10, 133, 4, 24, 15, 398 }, // U+201B
+    { 14, 10, 240, 3, 24, 35, 8246 }, // U+201C
+    { 14, 10, 240, 2, 24, 35, 8281 }, // U+201D
+    { 13, 10, 240, -1, 5, 33, 413 }, // U+201E
+    { 12, 10, 240, 4, 24, 30, 446 }, // U+201F
+    { 14, 30, 239, 2, 26, 105, 476 }, // U+2020
+    { 18, 30, 239, -1, 26, 135, 581 }, // U+2021
+    { 10, 10, 193, 1, 17, 25, 716 }, // U+2022
+    { 11, 12, 267, 5, 18, 33, 741 }, // U+2023
+    { 6, 6, 153, 2, 15, 9, 774 }, // U+2024
+    { 15, 6, 286, 2, 15, 23, 783 }, // U+2025
+    { 24, 6, 458, 1, 5, 36, 8316 }, // U+2026
+    { 5, 6, 133, 2, 12, 8, 806 }, // U+2027
+    { 0, 0, 320, 0, 0, 0, 814 }, // U+2028
+    { 0, 0, 320, 0, 0, 0, 814 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 814 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 873 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 932 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 988 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 1044 }, // U+202E
+    { 0, 0, 89, 0, 0, 0, 1100 }, // U+202F
+    { 40, 26, 685, 2, 25, 260, 1100 }, // U+2030
+    { 53, 26, 892, 2, 25, 345, 1360 }, // U+2031
+    { 7, 9, 117, 3, 24, 16, 1705 }, // U+2032
+    { 13, 9, 218, 3, 24, 30, 1721 }, // U+2033
+    { 19, 9, 318, 3, 24, 43, 1751 }, // U+2034
+    { 5, 9, 117, 4, 24, 12, 1794 }, // U+2035
+    { 11, 9, 218, 4, 24, 25, 1806 }, // U+2036
+    { 18, 9, 318, 4, 24, 41, 1831 }, // U+2037
+    { 11, 10, 213, -1, 2, 28, 1872 }, // U+2038
+    { 9, 14, 178, 2, 16, 32, 1900 }, // U+2039
+    { 10, 14, 178, 0, 16, 35, 1932 }, // U+203A
+    { 24, 24, 437, 2, 24, 144, 1967 }, // U+203B
+    { 17, 25, 299, 2, 24, 107, 2111 }, // U+203C
+    { 14, 26, 267, 4, 25, 91, 2218 }, // U+203D
+    { 17, 3, 245, 3, 28, 13, 2309 }, // U+203E
+    { 26, 7, 0, -25, 0, 46, 2322 }, // U+203F
+    { 26, 7, 0, -20, 28, 46, 2368 }, // U+2040
+    { 16, 24, 240, -2, 24, 96, 2414 }, // U+2041
+    { 31, 27, 533, 1, 26, 210, 2510 }, // U+2042
+    { 11, 6, 193, 1, 15, 17, 2720 }, // U+2043
+    { 20, 24, 33, -9, 24, 120, 2737 }, // U+2044
+    { 14, 31, 192, 0, 26, 109, 2857 }, // U+2045
+    { 15, 31, 192, -2, 26, 117, 2966 }, // U+2046
+    { 30, 26, 521, 4, 25, 195, 3083 }, // U+2047
+    { 22, 26, 420, 4, 25, 143, 3278 }, // U+2048
+    { 25, 26, 416, 2, 25, 163, 3421 }, // U+2049
+    { 16, 25, 298, 1, 19, 100, 3584 }, // U+204A
+    { 19, 30, 329, 2, 26, 143, 3684 }, // U+204B
+    { 18, 13, 318, 2, 19, 59, 3827 }, // U+204C
+    { 18, 13, 318, 2, 19, 59, 3886 }, // U+204D
+    { 15, 14, 267, 1, 19, 53, 3945 }, // U+204E
+    { 7, 25, 153, 1, 19, 44, 3998 }, // U+204F
+    { 22, 26, 389, 2, 25, 143, 4042 }, // U+2050
+    { 18, 28, 267, 0, 26, 126, 4185 }, // U+2051
+    { 12, 25, 175, 0, 24, 75, 4311 }, // U+2052
+    { 16, 7, 298, 2, 15, 28, 4386 }, // U+2053
+    { 27, 7, 0, -7, 0, 48, 4414 }, // U+2054
+    { 16, 16, 288, 2, 20, 64, 4462 }, // U+2055
+    { 16, 20, 327, 1, 19, 80, 4526 }, // U+2056
+    { 25, 9, 418, 3, 24, 57, 4606 }, // U+2057
+    { 19, 20, 378, 2, 19, 95, 4663 }, // U+2058
+    { 19, 20, 378, 1, 19, 95, 4758 }, // U+2059
+    { 5, 26, 153, 3, 25, 33, 4853 }, // U+205A
+    { 19, 26, 378, 2, 25, 124, 4886 }, // U+205B
+    { 19, 18, 372, 1, 18, 86, 5010 }, // U+205C
+    { 5, 26, 153, 3, 25, 33, 5096 }, // U+205D
+    { 5, 26, 153, 2, 25, 33, 5129 }, // U+205E
+    { 0, 0, 118, 0, 0, 0, 5162 }, // U+205F
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2060
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2061
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2062
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2063
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2064
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2066
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2067
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2068
+    { 0, 0, 320, 0, 0, 0, 5162 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 5162 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 5218 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 5274 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 5330 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 5388 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 5444 }, // U+206F
     { 13, 16, 213, 2, 28, 52, 0 }, // U+2070
     { 6, 16, 106, 3, 25, 24, 52 }, // U+2071
     { 14, 16, 213, 1, 28, 56, 76 }, // U+2074
@@ -3888,13 +3896,13 @@ static const EpdGlyph notoserif_16_italicGlyphs[] = {
     { 20, 27, 298, 0, 27, 135, 4490 }, // U+20BE
     { 20, 30, 298, -2, 27, 150, 4625 }, // U+20BF
     { 10, 4, 165, 0, 11, 10, 0 }, // U+2212
-    { 32, 34, 328, -5, 26, 272, 0 }, // U+FB00
-    { 25, 34, 317, -5, 26, 213, 272 }, // U+FB01
-    { 25, 34, 316, -5, 26, 213, 485 }, // U+FB02
-    { 35, 34, 475, -5, 26, 298, 698 }, // U+FB03
-    { 35, 34, 475, -5, 26, 298, 996 }, // U+FB04
-    { 28, 34, 351, -5, 26, 238, 1294 }, // U+FB05
-    { 28, 27, 444, 0, 26, 189, 1532 }, // U+FB06
+    { 32, 34, 328, -5, 26, 272, 8352 }, // U+FB00
+    { 25, 34, 317, -5, 26, 213, 8624 }, // U+FB01
+    { 25, 34, 316, -5, 26, 213, 8837 }, // U+FB02
+    { 35, 34, 475, -5, 26, 298, 9050 }, // U+FB03
+    { 35, 34, 475, -5, 26, 298, 9348 }, // U+FB04
+    { 28, 34, 351, -5, 26, 238, 0 }, // U+FB05
+    { 28, 27, 444, 0, 26, 189, 238 }, // U+FB06
     { 31, 32, 533, 1, 26, 248, 0 }, // U+FFFD
 };
 
@@ -3902,8 +3910,7 @@ static const EpdUnicodeInterval notoserif_16_italicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3911,8 +3918,7 @@ static const EpdUnicodeInterval notoserif_16_italicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -3922,19 +3928,57 @@ static const EpdUnicodeInterval notoserif_16_italicIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_16_italicGroups[] = {
-    { 0, 4901, 10891, 97, 0 },
-    { 4901, 4137, 12400, 96, 97 },
-    { 9038, 5313, 20472, 128, 193 },
-    { 14351, 5334, 17846, 96, 321 },
-    { 19685, 1572, 2498, 112, 417 },
-    { 21257, 13737, 41037, 256, 529 },
-    { 34994, 2929, 16266, 90, 785 },
-    { 37923, 2593, 6181, 111, 875 },
-    { 40516, 1017, 1984, 42, 986 },
-    { 41533, 2759, 5056, 32, 1028 },
-    { 44292, 14, 12, 1, 1060 },
-    { 44306, 593, 1787, 7, 1061 },
-    { 44899, 141, 256, 1, 1068 },
+    { 0, 4391, 10367, 83, 2 },
+    { 4391, 1101, 2197, 26, 0 },
+    { 5492, 4121, 12265, 95, 97 },
+    { 9613, 5313, 20472, 128, 193 },
+    { 14926, 5334, 17846, 96, 321 },
+    { 20260, 1572, 2498, 112, 417 },
+    { 21832, 13737, 41037, 256, 529 },
+    { 35569, 2929, 16266, 90, 785 },
+    { 38498, 2498, 6003, 105, 875 },
+    { 40996, 1017, 1984, 42, 986 },
+    { 42013, 2759, 5056, 32, 1028 },
+    { 44772, 14, 12, 1, 1060 },
+    { 44786, 241, 427, 2, 1066 },
+    { 45027, 141, 256, 1, 1068 },
+};
+
+static const uint16_t notoserif_16_italicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_16_italicKernLeftClasses[] = {
@@ -5165,18 +5209,81 @@ static const EpdLigaturePair notoserif_16_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_16_italicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 0 }, { 0x0004, 1, 1 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 2 }, { 0x0009, 1, 1 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 3 }, { 0x000C, 4, 4 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 10 }, { 0x0024, 8, 11 }, { 0x0025, 9, 12 }, { 0x0026, 10, 11 }, { 0x0027, 11, 11 }, { 0x0028, 12, 11 }, { 0x0029, 13, 12 }, // U+0040
+    { 0x002A, 0, 11 }, { 0x002B, 0, 11 }, { 0x002C, 14, 11 }, { 0x002D, 15, 11 }, { 0x002E, 16, 11 }, { 0x002F, 0, 11 }, { 0x0030, 17, 11 }, { 0x0031, 10, 12 }, // U+0048
+    { 0x0032, 18, 11 }, { 0x0033, 10, 12 }, { 0x0034, 19, 11 }, { 0x0035, 20, 13 }, { 0x0036, 21, 14 }, { 0x0037, 22, 15 }, { 0x0038, 23, 16 }, { 0x0039, 24, 17 }, // U+0050
+    { 0x003A, 25, 18 }, { 0x003B, 26, 19 }, { 0x003C, 0, 20 }, { 0x003D, 3, 0 }, { 0x003E, 0, 21 }, { 0x003F, 0, 3 }, { 0x0040, 0, 0 }, { 0x0041, 27, 22 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 28, 23 }, { 0x0044, 29, 24 }, { 0x0045, 30, 25 }, { 0x0046, 0, 25 }, { 0x0047, 30, 25 }, { 0x0048, 31, 0 }, { 0x0049, 0, 26 }, // U+0060
+    { 0x004A, 28, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 32, 24 }, { 0x004E, 0, 28 }, { 0x004F, 28, 29 }, { 0x0050, 28, 29 }, { 0x0051, 29, 25 }, // U+0068
+    { 0x0052, 29, 29 }, { 0x0053, 33, 25 }, { 0x0054, 34, 29 }, { 0x0055, 35, 30 }, { 0x0056, 0, 31 }, { 0x0057, 0, 32 }, { 0x0058, 36, 33 }, { 0x0059, 37, 34 }, // U+0070
+    { 0x005A, 0, 35 }, { 0x005B, 38, 36 }, { 0x005C, 39, 37 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 3 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 40, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 38 }, { 0x006B, 0, 0 }, { 0x006C, 41, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 38 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 39 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 42, 0 }, // U+00B8
+    { 0x0081, 43, 10 }, { 0x0082, 43, 10 }, { 0x0083, 43, 10 }, { 0x0084, 43, 10 }, { 0x0085, 43, 10 }, { 0x0086, 43, 10 }, { 0x0087, 11, 40 }, { 0x0088, 9, 12 }, // U+00C0
+    { 0x0089, 11, 11 }, { 0x008A, 11, 11 }, { 0x008B, 11, 11 }, { 0x008C, 11, 11 }, { 0x008D, 0, 11 }, { 0x008E, 0, 11 }, { 0x008F, 0, 11 }, { 0x0090, 0, 11 }, // U+00C8
+    { 0x0091, 10, 11 }, { 0x0092, 17, 11 }, { 0x0093, 10, 12 }, { 0x0094, 10, 12 }, { 0x0095, 10, 12 }, { 0x0096, 10, 12 }, { 0x0097, 10, 12 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 12 }, { 0x009A, 22, 15 }, { 0x009B, 22, 15 }, { 0x009C, 22, 15 }, { 0x009D, 22, 15 }, { 0x009E, 26, 19 }, { 0x009F, 10, 11 }, { 0x00A0, 35, 0 }, // U+00D8
+    { 0x00A1, 28, 23 }, { 0x00A2, 28, 23 }, { 0x00A3, 28, 23 }, { 0x00A4, 28, 23 }, { 0x00A5, 28, 23 }, { 0x00A6, 28, 23 }, { 0x00A7, 30, 23 }, { 0x00A8, 30, 25 }, // U+00E0
+    { 0x00A9, 30, 25 }, { 0x00AA, 30, 25 }, { 0x00AB, 30, 25 }, { 0x00AC, 30, 25 }, { 0x00AD, 0, 27 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 27 }, { 0x00B0, 0, 27 }, // U+00E8
+    { 0x00B1, 29, 25 }, { 0x00B2, 28, 29 }, { 0x00B3, 29, 25 }, { 0x00B4, 29, 25 }, { 0x00B5, 29, 25 }, { 0x00B6, 29, 25 }, { 0x00B7, 29, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 29, 25 }, { 0x00BA, 28, 32 }, { 0x00BB, 28, 32 }, { 0x00BC, 28, 32 }, { 0x00BD, 28, 32 }, { 0x00BE, 38, 36 }, { 0x00BF, 29, 24 }, { 0x00C0, 38, 36 }, // U+00F8
+    { 0x00C1, 7, 10 }, { 0x00C2, 28, 23 }, { 0x00C3, 43, 10 }, { 0x00C4, 28, 23 }, { 0x00C5, 43, 10 }, { 0x00C6, 28, 23 }, { 0x00C7, 9, 12 }, { 0x00C8, 30, 25 }, // U+0100
+    { 0x00C9, 9, 12 }, { 0x00CA, 30, 25 }, { 0x00CB, 9, 12 }, { 0x00CC, 30, 25 }, { 0x00CD, 9, 12 }, { 0x00CE, 30, 25 }, { 0x00CF, 10, 11 }, { 0x00D0, 44, 25 }, // U+0108
+    { 0x00D1, 10, 11 }, { 0x00D2, 0, 25 }, { 0x00D3, 11, 11 }, { 0x00D4, 30, 25 }, { 0x00D5, 11, 11 }, { 0x00D6, 30, 25 }, { 0x00D7, 11, 11 }, { 0x00D8, 30, 25 }, // U+0110
+    { 0x00D9, 11, 11 }, { 0x00DA, 30, 25 }, { 0x00DB, 11, 11 }, { 0x00DC, 30, 25 }, { 0x00DD, 13, 12 }, { 0x00DE, 0, 25 }, { 0x00DF, 13, 12 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 13, 12 }, { 0x00E2, 0, 25 }, { 0x00E3, 13, 12 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 11 }, { 0x00E6, 28, 24 }, { 0x00E7, 0, 11 }, { 0x00E8, 28, 24 }, // U+0120
+    { 0x00E9, 0, 11 }, { 0x00EA, 0, 27 }, { 0x00EB, 0, 11 }, { 0x00EC, 0, 27 }, { 0x00ED, 0, 11 }, { 0x00EE, 0, 27 }, { 0x00EF, 0, 11 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 11 }, { 0x00F2, 0, 0 }, { 0x00F3, 14, 11 }, { 0x00F4, 0, 27 }, { 0x00F5, 14, 11 }, { 0x00F6, 0, 0 }, { 0x00F7, 15, 11 }, { 0x00F8, 32, 24 }, // U+0130
+    { 0x00F9, 32, 29 }, { 0x00FA, 16, 11 }, { 0x00FB, 0, 28 }, { 0x00FC, 16, 11 }, { 0x00FD, 0, 28 }, { 0x00FE, 45, 11 }, { 0x00FF, 44, 28 }, { 0x0100, 0, 11 }, // U+0138
+    { 0x0101, 0, 28 }, { 0x0102, 16, 11 }, { 0x0103, 0, 28 }, { 0x0104, 17, 11 }, { 0x0105, 28, 29 }, { 0x0106, 17, 11 }, { 0x0107, 28, 29 }, { 0x0108, 17, 11 }, // U+0140
+    { 0x0109, 28, 29 }, { 0x010A, 28, 41 }, { 0x010B, 14, 11 }, { 0x010C, 28, 29 }, { 0x010D, 10, 12 }, { 0x010E, 29, 25 }, { 0x010F, 10, 12 }, { 0x0110, 29, 25 }, // U+0148
+    { 0x0111, 10, 12 }, { 0x0112, 29, 25 }, { 0x0113, 11, 12 }, { 0x0114, 30, 25 }, { 0x0115, 19, 11 }, { 0x0116, 34, 29 }, { 0x0117, 19, 11 }, { 0x0118, 34, 29 }, // U+0150
+    { 0x0119, 19, 11 }, { 0x011A, 34, 29 }, { 0x011B, 20, 13 }, { 0x011C, 35, 30 }, { 0x011D, 20, 13 }, { 0x011E, 35, 30 }, { 0x011F, 20, 13 }, { 0x0120, 35, 30 }, // U+0158
+    { 0x0121, 20, 13 }, { 0x0122, 35, 30 }, { 0x0123, 21, 0 }, { 0x0124, 0, 31 }, { 0x0125, 21, 0 }, { 0x0126, 0, 31 }, { 0x0127, 21, 0 }, { 0x0128, 0, 31 }, // U+0160
+    { 0x0129, 22, 15 }, { 0x012A, 28, 32 }, { 0x012B, 22, 15 }, { 0x012C, 28, 32 }, { 0x012D, 22, 15 }, { 0x012E, 28, 32 }, { 0x012F, 22, 15 }, { 0x0130, 28, 32 }, // U+0168
+    { 0x0131, 22, 15 }, { 0x0132, 28, 32 }, { 0x0133, 22, 15 }, { 0x0134, 28, 32 }, { 0x0135, 24, 17 }, { 0x0136, 37, 34 }, { 0x0137, 26, 19 }, { 0x0138, 38, 36 }, // U+0170
+    { 0x0139, 26, 19 }, { 0x013A, 0, 20 }, { 0x013B, 39, 37 }, { 0x013C, 0, 20 }, { 0x013D, 39, 37 }, { 0x013E, 0, 20 }, { 0x013F, 39, 37 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 50, 42 }, { 0x0212, 50, 42 }, { 0x0213, 51, 43 }, { 0x0214, 52, 42 }, { 0x0215, 53, 44 }, { 0x0216, 54, 45 }, { 0x0217, 55, 42 }, { 0x0218, 55, 42 }, // U+0400
+    { 0x0219, 56, 46 }, { 0x021A, 57, 47 }, { 0x021B, 57, 42 }, { 0x021C, 58, 43 }, { 0x021D, 59, 42 }, { 0x021E, 55, 42 }, { 0x021F, 60, 48 }, { 0x0220, 55, 42 }, // U+0408
+    { 0x0221, 61, 49 }, { 0x0222, 62, 42 }, { 0x0223, 63, 42 }, { 0x0224, 52, 42 }, { 0x0225, 64, 50 }, { 0x0226, 50, 42 }, { 0x0227, 59, 51 }, { 0x0228, 63, 52 }, // U+0410
+    { 0x0229, 55, 42 }, { 0x022A, 55, 42 }, { 0x022B, 59, 42 }, { 0x022C, 55, 47 }, { 0x022D, 55, 42 }, { 0x022E, 55, 42 }, { 0x022F, 65, 44 }, { 0x0230, 55, 42 }, // U+0418
+    { 0x0231, 66, 42 }, { 0x0232, 53, 44 }, { 0x0233, 52, 43 }, { 0x0234, 60, 48 }, { 0x0235, 67, 53 }, { 0x0236, 68, 54 }, { 0x0237, 64, 42 }, { 0x0238, 55, 55 }, // U+0420
+    { 0x0239, 55, 42 }, { 0x023A, 64, 42 }, { 0x023B, 57, 43 }, { 0x023C, 55, 42 }, { 0x023D, 57, 42 }, { 0x023E, 65, 52 }, { 0x023F, 65, 42 }, { 0x0240, 55, 56 }, // U+0428
+    { 0x0241, 69, 57 }, { 0x0242, 70, 58 }, { 0x0243, 71, 57 }, { 0x0244, 72, 59 }, { 0x0245, 73, 60 }, { 0x0246, 74, 57 }, { 0x0247, 75, 61 }, { 0x0248, 71, 62 }, // U+0430
+    { 0x0249, 69, 63 }, { 0x024A, 69, 63 }, { 0x024B, 76, 64 }, { 0x024C, 69, 65 }, { 0x024D, 69, 65 }, { 0x024E, 69, 64 }, { 0x024F, 77, 57 }, { 0x0250, 78, 64 }, // U+0438
+    { 0x0251, 77, 66 }, { 0x0252, 79, 57 }, { 0x0253, 78, 64 }, { 0x0254, 80, 67 }, { 0x0255, 77, 57 }, { 0x0256, 76, 68 }, { 0x0257, 81, 63 }, { 0x0258, 69, 69 }, // U+0440
+    { 0x0259, 69, 63 }, { 0x025A, 81, 63 }, { 0x025B, 82, 70 }, { 0x025C, 69, 63 }, { 0x025D, 82, 63 }, { 0x025E, 77, 61 }, { 0x025F, 77, 64 }, { 0x0260, 69, 71 }, // U+0448
+    { 0x0261, 74, 57 }, { 0x0262, 74, 57 }, { 0x0263, 83, 72 }, { 0x0264, 72, 59 }, { 0x0265, 79, 57 }, { 0x0266, 84, 73 }, { 0x0267, 69, 74 }, { 0x0268, 85, 75 }, // U+0450
+    { 0x0269, 86, 76 }, { 0x026A, 82, 65 }, { 0x026B, 82, 64 }, { 0x026C, 78, 72 }, { 0x026D, 76, 64 }, { 0x026E, 69, 63 }, { 0x026F, 80, 67 }, { 0x0270, 69, 63 }, // U+0458
+};
+
 static const EpdFontData notoserif_16_italic = {
     notoserif_16_italicBitmaps,
     notoserif_16_italicGlyphs,
     notoserif_16_italicIntervals,
-    20,
+    18,
     45,
     36,
     -10,
     true,
     notoserif_16_italicGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_16_italicGlyphToGroup,
     notoserif_16_italicKernLeftClasses,
     notoserif_16_italicKernRightClasses,
     notoserif_16_italicKernMatrix,
@@ -5186,4 +5293,8 @@ static const EpdFontData notoserif_16_italic = {
     90,
     notoserif_16_italicLigaturePairs,
     5,
+    notoserif_16_italicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2408 +3,2411 @@
  * name: notoserif_16_regular
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_16_regular 16 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_16_regular 16 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_16_regularBitmaps[38333] = {
-    0xB5, 0x5A, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0x3E, 0x00, 0x48, 0x22, 0x63, 0x64, 0x08, 0x15, 0x62,
-    0x26, 0x93, 0x1D, 0x2E, 0x1A, 0x15, 0x1A, 0x4D, 0x28, 0xB8, 0x70, 0xC1, 0xE2, 0xED, 0x02, 0x51,
-    0xAB, 0x22, 0x2C, 0xB8, 0x49, 0x26, 0x99, 0x0C, 0x7B, 0x7B, 0x92, 0x97, 0x42, 0xC5, 0x4E, 0x42,
-    0x2E, 0x60, 0xBB, 0x48, 0xCB, 0xC2, 0xAE, 0xD2, 0xA8, 0x50, 0x11, 0x2F, 0x33, 0x43, 0x15, 0x5B,
-    0x70, 0xC6, 0xCB, 0x07, 0x50, 0x2E, 0x54, 0xA4, 0x30, 0x62, 0xCD, 0x44, 0x45, 0x0A, 0x63, 0xAC,
-    0x8D, 0x35, 0x96, 0x27, 0xE3, 0x1B, 0x1B, 0x1A, 0x61, 0x49, 0x3C, 0xDC, 0x7C, 0xDF, 0xB9, 0x78,
-    0x6F, 0x9F, 0xAC, 0xA5, 0x44, 0x4A, 0xCA, 0x5B, 0xDC, 0x83, 0xB7, 0xC0, 0xFD, 0x39, 0xF7, 0xFC,
-    0x9F, 0x73, 0x5F, 0x91, 0x17, 0xF8, 0xCB, 0xF2, 0x4C, 0x36, 0xFF, 0x52, 0x79, 0x55, 0xFF, 0xB6,
-    0xE5, 0xAA, 0x5C, 0x10, 0x41, 0xCB, 0xF2, 0xAA, 0xAC, 0xCA, 0x0C, 0xDF, 0xB3, 0xD7, 0x7A, 0x5E,
-    0x7E, 0x97, 0x7A, 0xB8, 0x4C, 0x22, 0x66, 0x5B, 0xCC, 0x65, 0x31, 0x78, 0x25, 0x41, 0x7D, 0x99,
-    0x60, 0x5B, 0x24, 0x2C, 0xAF, 0x89, 0x44, 0xE5, 0x0C, 0x20, 0x07, 0x88, 0x05, 0x20, 0x91, 0x07,
-    0x12, 0x5B, 0x6B, 0xCD, 0x37, 0xAA, 0xC3, 0xF1, 0x4D, 0xB9, 0xC6, 0x31, 0x33, 0x05, 0x5E, 0x0B,
-    0xE0, 0x37, 0x22, 0xFB, 0x04, 0x47, 0x41, 0x2D, 0xAF, 0x8C, 0xF7, 0x3E, 0x2A, 0x33, 0x74, 0x2E,
-    0x3D, 0x13, 0x95, 0xE2, 0xB5, 0x51, 0x2E, 0x7E, 0x13, 0x8B, 0x03, 0xBA, 0xC4, 0xD9, 0x3A, 0x22,
-    0x39, 0x5E, 0xD4, 0xAE, 0x6D, 0x3D, 0x16, 0xCF, 0xDA, 0x36, 0xF8, 0xED, 0x4F, 0xBA, 0xF8, 0x9D,
-    0x47, 0x7D, 0xFC, 0x4E, 0xCD, 0x66, 0xD0, 0x24, 0xFE, 0x45, 0x2D, 0xE1, 0xE3, 0x5A, 0x7C, 0x8B,
-    0x55, 0x8A, 0x25, 0x70, 0xB3, 0x25, 0xFE, 0x31, 0xE2, 0xBF, 0xDB, 0x8B, 0xFF, 0x68, 0xB8, 0xEA,
-    0xD7, 0xCB, 0x5D, 0xB4, 0xCC, 0xAF, 0x87, 0xEC, 0xB5, 0x47, 0x7D, 0xF2, 0xB3, 0x77, 0x4D, 0x08,
-    0x14, 0xE4, 0x3B, 0x27, 0x67, 0xF3, 0xB3, 0x79, 0xA5, 0x4C, 0x1F, 0x1F, 0x6F, 0xC3, 0x52, 0xE2,
-    0xF7, 0x8D, 0xC4, 0xB9, 0x80, 0x24, 0xD8, 0x25, 0x08, 0x38, 0xC8, 0x8E, 0xC8, 0x2E, 0x6E, 0xB7,
-    0x45, 0x0E, 0xE4, 0xA1, 0x74, 0x7A, 0xF3, 0x8C, 0xDE, 0x82, 0x46, 0x6F, 0x61, 0xAD, 0xB7, 0x38,
-    0xDF, 0xE3, 0x80, 0x24, 0xB4, 0x75, 0x26, 0xFD, 0x4E, 0xFC, 0x3D, 0x93, 0xBC, 0x66, 0x6E, 0xE3,
-    0x6B, 0x68, 0x9B, 0x8E, 0x53, 0xFC, 0xC8, 0x33, 0x07, 0xB8, 0x49, 0xD0, 0xDC, 0xC1, 0x4C, 0x12,
-    0xD6, 0x0F, 0x79, 0x8B, 0x73, 0xBD, 0x25, 0xA2, 0x0F, 0x77, 0x44, 0xBB, 0xDC, 0xD6, 0xA5, 0xB1,
-    0x1A, 0x11, 0xC1, 0x6A, 0xF1, 0xF7, 0x0D, 0x86, 0x49, 0x60, 0x1D, 0xBE, 0x2F, 0xAE, 0xB0, 0x4E,
-    0xF4, 0x81, 0xBD, 0x07, 0x7C, 0xFC, 0xC1, 0xEB, 0x31, 0xB7, 0xD1, 0x15, 0x36, 0x61, 0x47, 0xE8,
-    0x0D, 0xB8, 0x8B, 0x8C, 0x31, 0x50, 0x96, 0x62, 0xE4, 0xD8, 0xCC, 0x48, 0xD5, 0x79, 0xB6, 0x93,
-    0xEA, 0x6E, 0xFC, 0x8B, 0xA5, 0x1C, 0x4B, 0x5A, 0x56, 0xF9, 0x03, 0x29, 0x24, 0xAB, 0x3B, 0x59,
-    0x48, 0x6C, 0x8C, 0x8C, 0x12, 0x2C, 0x5B, 0x01, 0x7D, 0x41, 0xE7, 0x05, 0x46, 0xD4, 0x52, 0x01,
-    0x61, 0x03, 0x21, 0x92, 0x74, 0x90, 0xB4, 0x91, 0x87, 0xA3, 0x44, 0xE3, 0xFD, 0xB6, 0x38, 0x01,
-    0xA7, 0xF2, 0x64, 0x29, 0x5E, 0xCE, 0x89, 0x55, 0x0C, 0x53, 0xFC, 0x25, 0x10, 0xBC, 0xCB, 0x13,
-    0xAA, 0x5E, 0x23, 0x71, 0x0D, 0x52, 0x02, 0x1B, 0x20, 0x16, 0xB6, 0x12, 0xEB, 0x83, 0xA4, 0xC6,
-    0xBA, 0x92, 0x95, 0x9C, 0xF3, 0x9C, 0xAB, 0xE4, 0x5B, 0xF4, 0x41, 0x4F, 0xF4, 0x0F, 0x0D, 0xB7,
-    0xC3, 0xFD, 0x40, 0x80, 0xA3, 0x9A, 0x73, 0xEA, 0x07, 0x52, 0x77, 0x07, 0xC4, 0x28, 0x39, 0xAD,
-    0xEF, 0x3A, 0x00, 0x69, 0x60, 0x5C, 0x68, 0xCF, 0xF5, 0x5C, 0x9F, 0xBA, 0xDC, 0x43, 0xED, 0xB3,
-    0xD0, 0xFE, 0x03, 0xC7, 0x62, 0x06, 0xCC, 0xF3, 0x50, 0xE7, 0xE4, 0xE7, 0x22, 0x5A, 0x5C, 0x92,
-    0x4D, 0x72, 0x3D, 0xF2, 0xEA, 0xE2, 0xF5, 0xA8, 0x9D, 0x3F, 0xA9, 0x5A, 0xAF, 0x82, 0x24, 0xA1,
-    0xA5, 0x4F, 0xAA, 0xA6, 0x78, 0x3D, 0x6E, 0xAF, 0xC7, 0xDC, 0x5F, 0xEE, 0xFA, 0x5E, 0xCC, 0xDD,
-    0x58, 0x88, 0xFA, 0x79, 0xAD, 0xB2, 0xB6, 0x83, 0x42, 0x74, 0x4F, 0x7B, 0x2F, 0x4E, 0x51, 0xCB,
-    0xAC, 0xC9, 0x9A, 0xB8, 0x09, 0xEA, 0xA0, 0x8E, 0xB0, 0x3D, 0xE2, 0x73, 0x65, 0x2F, 0xCF, 0x6C,
-    0x8B, 0x4B, 0x7B, 0x54, 0x62, 0xF1, 0x57, 0x88, 0xD3, 0x1B, 0x28, 0x1C, 0xD4, 0x0D, 0x17, 0xA4,
-    0x18, 0x93, 0xC4, 0xD4, 0x55, 0x90, 0x1F, 0xDA, 0x49, 0x95, 0xC5, 0xB5, 0x0F, 0x85, 0x14, 0x6A,
-    0x69, 0x4B, 0xBA, 0xF9, 0xCF, 0xD6, 0x77, 0xFD, 0x49, 0x28, 0x33, 0xB6, 0xC2, 0xA8, 0x4E, 0xD9,
-    0x07, 0x61, 0x03, 0x4F, 0x06, 0xF2, 0x66, 0x41, 0x1E, 0x15, 0xA4, 0x69, 0xE1, 0x48, 0xAA, 0xA4,
-    0xFD, 0x5C, 0xE0, 0x3A, 0xEB, 0x30, 0x9D, 0x40, 0xA7, 0x8A, 0x5A, 0x6F, 0x70, 0xD3, 0xCB, 0x38,
-    0x07, 0x67, 0x53, 0xCB, 0x85, 0x6F, 0x50, 0x39, 0x8D, 0x8A, 0x9D, 0x14, 0x58, 0xF9, 0x13, 0x88,
-    0xDF, 0xBB, 0x68, 0x90, 0x05, 0xF9, 0x2A, 0x2D, 0xEA, 0xE4, 0xE2, 0x7C, 0xBC, 0x91, 0x90, 0x11,
-    0xAA, 0xFF, 0xD0, 0xF8, 0xC7, 0x16, 0xF8, 0xA5, 0x35, 0xF0, 0x69, 0x1E, 0x4A, 0xDC, 0xDE, 0x01,
-    0x4A, 0x17, 0xD0, 0x84, 0xB2, 0x47, 0x1C, 0x25, 0xC9, 0x55, 0xA0, 0xA0, 0x2C, 0x02, 0xC5, 0x94,
-    0xA0, 0x75, 0x0C, 0x7F, 0x75, 0x7A, 0xC4, 0xA9, 0x6B, 0x79, 0x09, 0xC4, 0x7C, 0x03, 0x66, 0xA3,
-    0x1B, 0x0F, 0xEF, 0x29, 0xA3, 0xED, 0x7A, 0x8D, 0x9E, 0x6B, 0xE4, 0x59, 0x99, 0x34, 0x05, 0x36,
-    0x74, 0x00, 0x44, 0x76, 0xD0, 0x2E, 0x38, 0x84, 0x5A, 0xB7, 0x06, 0xE6, 0xBF, 0xD4, 0xAB, 0x70,
-    0xC9, 0x77, 0x2C, 0xD6, 0x4B, 0x5B, 0x45, 0x56, 0x82, 0x9E, 0x4A, 0xCE, 0xF6, 0x02, 0xDA, 0x11,
-    0xFE, 0xEF, 0x31, 0xEE, 0xA1, 0x24, 0x4D, 0xF6, 0x4B, 0x9B, 0x47, 0x98, 0x5B, 0xAE, 0x70, 0x95,
-    0x90, 0xD2, 0x41, 0x6A, 0x51, 0xC3, 0x45, 0xFE, 0x89, 0xE0, 0x77, 0x34, 0x10, 0xEF, 0x12, 0xBD,
-    0x7F, 0x26, 0x29, 0xB9, 0xDC, 0x35, 0x82, 0x7D, 0x02, 0x03, 0xE0, 0x37, 0x00, 0x61, 0x0D, 0x10,
-    0x13, 0x99, 0x57, 0x09, 0x76, 0xF6, 0xFE, 0xE6, 0xE3, 0x1B, 0x15, 0xED, 0xFC, 0x1E, 0xBF, 0x39,
-    0xB2, 0x6D, 0x80, 0x08, 0xC0, 0x9B, 0x8F, 0x39, 0xCC, 0x92, 0xAD, 0x23, 0x6B, 0x1B, 0xF8, 0x84,
-    0x56, 0x1B, 0x64, 0xEC, 0xB2, 0x6B, 0xAA, 0xFE, 0x57, 0xA7, 0x76, 0xED, 0x22, 0x99, 0xDA, 0x4B,
-    0x7A, 0x48, 0xB3, 0x05, 0xF3, 0xA1, 0x53, 0x04, 0xD3, 0xDE, 0xCE, 0xDA, 0xB7, 0xF0, 0xEC, 0x18,
-    0xEF, 0x20, 0x58, 0x75, 0xF6, 0xD1, 0xE6, 0xDE, 0xC4, 0x99, 0xFA, 0xE2, 0x5F, 0x3A, 0x6F, 0x80,
-    0x49, 0x83, 0x81, 0x8B, 0x1A, 0x79, 0xA0, 0x9C, 0x41, 0x83, 0x3C, 0x51, 0xF6, 0x24, 0xFB, 0xB3,
-    0x9B, 0x92, 0xCD, 0x6D, 0x99, 0x9D, 0xDE, 0x32, 0x59, 0xED, 0x0F, 0x78, 0xB6, 0x44, 0x1B, 0xD1,
-    0x16, 0x6C, 0xE8, 0xB7, 0x40, 0xFF, 0x11, 0xE3, 0x96, 0x14, 0x3A, 0xC8, 0x5C, 0x27, 0xE3, 0xFD,
-    0x06, 0xC8, 0xE5, 0x14, 0xB8, 0xC2, 0xDA, 0x65, 0xE5, 0x1A, 0xE8, 0x2C, 0xFD, 0xDB, 0x10, 0xC0,
-    0xB7, 0x69, 0xB5, 0x24, 0x6C, 0xD4, 0xEE, 0x7C, 0x4A, 0x16, 0x60, 0xD2, 0x68, 0x2F, 0x68, 0x74,
-    0xA4, 0x77, 0xB2, 0xAA, 0x5D, 0xDB, 0xA7, 0x77, 0xD5, 0xCF, 0x1C, 0x1A, 0xE5, 0x53, 0xD0, 0xA3,
-    0x16, 0xFD, 0x93, 0x1A, 0x1A, 0x05, 0xC4, 0x60, 0x56, 0x73, 0x82, 0xD2, 0xE9, 0x16, 0xB4, 0xAC,
-    0xC5, 0x8C, 0xE1, 0x12, 0xFB, 0xF4, 0xEC, 0x42, 0x9C, 0xBB, 0x03, 0x86, 0x25, 0x16, 0x81, 0x3A,
-    0xC4, 0x75, 0x38, 0x70, 0xCF, 0x23, 0xED, 0x40, 0xE1, 0xEC, 0xDD, 0x19, 0xC8, 0x68, 0x17, 0x31,
-    0x33, 0x74, 0xEB, 0xE3, 0x2D, 0x23, 0x5E, 0xC5, 0xFD, 0x79, 0x93, 0x75, 0x92, 0xA2, 0x97, 0x60,
-    0x04, 0x75, 0xDB, 0xA4, 0x49, 0xC0, 0xF9, 0x2C, 0x0F, 0xBA, 0x0C, 0x8E, 0x02, 0x23, 0x57, 0x6D,
-    0xC9, 0x46, 0xEA, 0xA5, 0x75, 0xB0, 0x8C, 0xBB, 0x64, 0x19, 0xD8, 0x61, 0x29, 0xF3, 0xBB, 0x4B,
-    0xB7, 0x5D, 0x8F, 0xD2, 0xD8, 0x4F, 0x1C, 0x34, 0x7F, 0x28, 0x51, 0xB3, 0x0D, 0xC4, 0xE3, 0x5F,
-    0x8E, 0x12, 0x52, 0xE0, 0x95, 0x63, 0x69, 0x9E, 0xD5, 0x45, 0x9D, 0x95, 0x17, 0xE5, 0xF7, 0x3F,
-    0x34, 0x71, 0x78, 0x53, 0x67, 0x8A, 0x4F, 0xD4, 0xC4, 0x26, 0x31, 0x71, 0xBB, 0xC6, 0x6E, 0xFD,
-    0xF1, 0x20, 0xE1, 0x29, 0xDE, 0x85, 0xC6, 0x33, 0x1E, 0xCC, 0x61, 0x2A, 0x6F, 0x9C, 0xBD, 0x7C,
-    0x49, 0xD4, 0xE0, 0x43, 0x47, 0x3C, 0x90, 0x33, 0xC1, 0x0D, 0x5B, 0x8C, 0xF1, 0xA4, 0xC2, 0x3C,
-    0x95, 0xE8, 0x23, 0x7D, 0xA5, 0x6A, 0xE4, 0x13, 0x71, 0xCA, 0x1D, 0xC7, 0x9C, 0x4D, 0x43, 0xFD,
-    0xAC, 0x26, 0x1D, 0xDD, 0xFC, 0x7C, 0xFB, 0xF0, 0xF0, 0x2D, 0xBE, 0xDB, 0xDB, 0xDB, 0xA3, 0x15,
-    0x12, 0x7A, 0x1B, 0xCE, 0x90, 0xE1, 0x4B, 0xA8, 0x6C, 0x80, 0xC0, 0x85, 0x20, 0x80, 0x54, 0xA5,
-    0xD3, 0xD1, 0xB0, 0xD3, 0x87, 0x7C, 0x89, 0x4E, 0x5C, 0x8E, 0xAB, 0x8D, 0xB2, 0x76, 0x27, 0xFA,
-    0x09, 0x61, 0xC0, 0xB3, 0x8F, 0x46, 0xE0, 0x97, 0xE6, 0x4B, 0xB0, 0xF0, 0x18, 0xF6, 0xE5, 0xE5,
-    0x33, 0x3B, 0xD3, 0x38, 0x69, 0x86, 0x89, 0xE4, 0x48, 0xCE, 0xCF, 0x05, 0x61, 0x50, 0x68, 0x99,
-    0xD7, 0xED, 0xC2, 0xC6, 0x84, 0xDC, 0xA8, 0x9D, 0xDA, 0x62, 0x4D, 0xB7, 0xF9, 0xAF, 0x94, 0x01,
-    0x96, 0xEE, 0xC2, 0x1F, 0xF3, 0x4B, 0xE0, 0x56, 0xDC, 0x92, 0x23, 0xAA, 0x24, 0x61, 0xAD, 0x12,
-    0xEB, 0x53, 0xBC, 0xFE, 0x24, 0x87, 0x11, 0x68, 0xA0, 0xC6, 0xF9, 0x51, 0x5C, 0x27, 0x08, 0x5F,
-    0xF6, 0x13, 0x0D, 0x24, 0x67, 0x19, 0xF6, 0xBB, 0x2B, 0xB3, 0x5D, 0x70, 0xFA, 0x40, 0x66, 0x77,
-    0x40, 0xB6, 0x3B, 0x32, 0x3B, 0x86, 0xB8, 0x1E, 0xCB, 0xFE, 0xB1, 0xC6, 0x17, 0xFB, 0x43, 0xC8,
-    0xDB, 0x11, 0x94, 0x11, 0x02, 0x6C, 0x70, 0xF3, 0x7B, 0xBF, 0x39, 0x0E, 0xBA, 0xF0, 0x38, 0xC4,
-    0xC6, 0xC6, 0xBF, 0xDF, 0x9D, 0x63, 0x4C, 0xD1, 0x27, 0x03, 0x26, 0xBA, 0x98, 0x7B, 0x37, 0x10,
-    0x16, 0xE8, 0x27, 0x76, 0xA1, 0x0C, 0x77, 0x0D, 0x95, 0x53, 0xC3, 0x86, 0xAF, 0x45, 0xE3, 0x91,
-    0x73, 0xD1, 0xC4, 0x8D, 0xBF, 0xFE, 0x91, 0x23, 0x98, 0xFA, 0xF9, 0x58, 0x69, 0x98, 0xA8, 0x57,
-    0x4A, 0xF5, 0xF5, 0x0E, 0x69, 0x0F, 0x14, 0x08, 0x3B, 0x32, 0x44, 0x4C, 0xA5, 0x7B, 0xCA, 0x34,
-    0x86, 0x25, 0x05, 0xC3, 0x9A, 0xB4, 0x8C, 0x72, 0xA5, 0xAC, 0x4E, 0xB1, 0xAD, 0xD6, 0x2B, 0x83,
-    0x6D, 0x06, 0x84, 0x86, 0x0B, 0xA2, 0x59, 0x4A, 0xB2, 0x21, 0x73, 0x69, 0xC2, 0x2B, 0xFA, 0x52,
-    0x28, 0x50, 0xA0, 0x4C, 0x80, 0xE2, 0x21, 0xF0, 0x99, 0x9F, 0xCA, 0x45, 0x1A, 0x72, 0x60, 0x36,
-    0x56, 0x76, 0xBC, 0x2B, 0x73, 0xD8, 0x07, 0x09, 0x06, 0x70, 0xDB, 0xA7, 0xA2, 0x02, 0x40, 0x51,
-    0x57, 0xC0, 0xAC, 0xBF, 0x35, 0x00, 0x59, 0xE9, 0x2F, 0xFF, 0x62, 0x84, 0xF5, 0xC7, 0x9E, 0xFC,
-    0xE5, 0x5E, 0x95, 0xAF, 0x5E, 0x84, 0xEC, 0x17, 0x74, 0x04, 0x3D, 0xC1, 0xB0, 0xFE, 0xD6, 0xEB,
-    0x5B, 0x4C, 0x9F, 0xB4, 0xB7, 0xC6, 0x7B, 0x36, 0x87, 0x74, 0x9E, 0xAC, 0xD8, 0x6A, 0x29, 0xE8,
-    0x8F, 0xAB, 0x06, 0x22, 0x1E, 0xBB, 0x09, 0xC0, 0x88, 0x00, 0xAA, 0xC3, 0x90, 0x9A, 0x84, 0x4A,
-    0x6B, 0xD1, 0x58, 0xCD, 0x89, 0xD0, 0xE7, 0x80, 0x7A, 0xD5, 0x39, 0x69, 0x56, 0x2E, 0x83, 0x02,
-    0xFC, 0x02, 0xD6, 0x95, 0xB7, 0xC5, 0x96, 0xA0, 0x13, 0x08, 0x84, 0xB0, 0x8B, 0x4B, 0x32, 0xAA,
-    0x01, 0x1A, 0x77, 0x85, 0x5B, 0x87, 0x92, 0xA1, 0xD3, 0xBC, 0x25, 0xDF, 0x20, 0xA0, 0x80, 0xDE,
-    0x52, 0x79, 0x58, 0x29, 0x2C, 0xB8, 0x45, 0xA1, 0xE9, 0xE5, 0x02, 0x67, 0x30, 0x69, 0xCE, 0x87,
-    0x9B, 0x7D, 0xDC, 0xA8, 0x2C, 0x5F, 0xCF, 0x06, 0xED, 0x55, 0xE2, 0xF0, 0x4A, 0x8D, 0x90, 0x1E,
-    0xA5, 0x38, 0x82, 0xD0, 0x39, 0xD5, 0x44, 0xA7, 0xC6, 0xBB, 0x88, 0x03, 0x03, 0x02, 0x7F, 0x0D,
-    0x9C, 0xC7, 0xDC, 0x04, 0x4B, 0xA8, 0xB2, 0x4F, 0xAE, 0xE3, 0xDB, 0x4D, 0x39, 0xB7, 0xCB, 0x0A,
-    0xBC, 0x41, 0x70, 0x44, 0xD0, 0x61, 0x7A, 0xDF, 0xDC, 0x1A, 0x0F, 0xEF, 0x1B, 0xF5, 0x87, 0x5F,
-    0x62, 0x5D, 0x05, 0xE3, 0xE1, 0x5B, 0xD3, 0xE2, 0x9F, 0xB7, 0xEE, 0x06, 0x20, 0x27, 0xE4, 0x96,
-    0xFD, 0x01, 0xB7, 0xDA, 0x6F, 0xE8, 0x3B, 0xD9, 0x10, 0x8F, 0xF7, 0x1D, 0xA9, 0x47, 0x15, 0x5F,
-    0xAB, 0x66, 0xF8, 0x40, 0x5D, 0xEA, 0x75, 0x35, 0x22, 0xCE, 0x8C, 0x4C, 0x2C, 0x76, 0x2C, 0x3F,
-    0x1F, 0xA6, 0xD6, 0x00, 0x22, 0x4D, 0xA1, 0x44, 0x58, 0xED, 0x5F, 0xE9, 0x0C, 0x0B, 0x55, 0x98,
-    0x85, 0x4A, 0xC5, 0x42, 0x31, 0x5A, 0xA8, 0xAD, 0x5B, 0x30, 0x1E, 0xBC, 0x47, 0xFF, 0xE5, 0xE4,
-    0x12, 0x5A, 0x0D, 0x9C, 0x98, 0x62, 0x41, 0x38, 0xDE, 0xBC, 0x04, 0x71, 0x21, 0xE2, 0x30, 0x7D,
-    0xCA, 0xE2, 0xFA, 0x79, 0x6E, 0xCB, 0xBD, 0xBD, 0x39, 0x13, 0x3B, 0x12, 0x77, 0xFD, 0xDF, 0x73,
-    0xCF, 0xE2, 0x6E, 0x8A, 0x44, 0x0D, 0xFA, 0xDD, 0xF5, 0xAA, 0x53, 0x22, 0x08, 0xB3, 0xC2, 0x1B,
-    0x70, 0x0C, 0x94, 0x07, 0x5F, 0xE2, 0xC2, 0x40, 0xCC, 0xE7, 0xE6, 0xBA, 0x64, 0x1F, 0x53, 0x89,
-    0xD2, 0xAF, 0x7E, 0x69, 0x9A, 0x03, 0xAB, 0x4C, 0x7F, 0x4B, 0xDB, 0x56, 0x50, 0xC2, 0x4D, 0x4C,
-    0x21, 0x7B, 0x13, 0x01, 0xCF, 0x1A, 0x5B, 0x68, 0x3A, 0x35, 0x4E, 0x77, 0x98, 0xA8, 0x8C, 0xCC,
-    0x14, 0x76, 0x84, 0x4C, 0x47, 0xFD, 0x81, 0x76, 0xD5, 0x1F, 0x52, 0x95, 0xA0, 0x8A, 0x69, 0xEE,
-    0x52, 0xED, 0xBF, 0xFD, 0x29, 0xFB, 0xD8, 0x40, 0x03, 0x48, 0xCF, 0xEA, 0x28, 0x26, 0xCD, 0x83,
-    0x3A, 0xAA, 0x81, 0x66, 0x15, 0x30, 0x52, 0x5D, 0x0E, 0xD4, 0xB2, 0xC1, 0x93, 0x62, 0xA7, 0x52,
-    0x9C, 0x00, 0x13, 0xBC, 0x20, 0x24, 0x77, 0x27, 0xA1, 0xF4, 0xBF, 0x36, 0x70, 0xA6, 0x66, 0x0A,
-    0xCC, 0x67, 0x74, 0x4D, 0xF3, 0x5C, 0x50, 0x82, 0x41, 0xD4, 0x58, 0x6A, 0x0E, 0x8C, 0xC8, 0xD6,
-    0xFF, 0x0D, 0x36, 0xF7, 0x63, 0xDC, 0x7F, 0x8E, 0x6D, 0x23, 0x29, 0xF0, 0xFF, 0x0B, 0x01, 0xCE,
-    0x87, 0xB8, 0xBF, 0x87, 0xF6, 0x3E, 0xEF, 0x08, 0x6F, 0x10, 0xF2, 0xFA, 0xFF, 0x31, 0x68, 0xD4,
-    0xEB, 0x37, 0xD8, 0x9E, 0x46, 0xBA, 0x0B, 0x0D, 0x80, 0x7D, 0x84, 0xE0, 0x57, 0xF5, 0x9E, 0xE5,
-    0x33, 0xBD, 0xA7, 0xA5, 0xBB, 0x27, 0xF5, 0x91, 0xDE, 0xE3, 0xC6, 0x45, 0xC6, 0x91, 0x69, 0xF5,
-    0x1E, 0xFC, 0xB6, 0x71, 0xF7, 0x27, 0xB5, 0xDE, 0x3D, 0xB5, 0x90, 0xF0, 0x15, 0x36, 0x67, 0x62,
-    0xDA, 0x42, 0x69, 0xA0, 0x7C, 0xB7, 0x4E, 0xA1, 0x84, 0x88, 0x8A, 0x81, 0xF7, 0x0C, 0x91, 0x45,
-    0x5D, 0xC1, 0xE8, 0xDB, 0xE5, 0x1C, 0x9B, 0xAA, 0x4E, 0x03, 0x4B, 0xBF, 0xE7, 0x63, 0x27, 0x51,
-    0xEE, 0x43, 0xBE, 0x01, 0x7F, 0x63, 0x08, 0xDF, 0x67, 0x32, 0xE8, 0xBF, 0x37, 0x10, 0x36, 0xA3,
-    0xC2, 0x22, 0x27, 0xCC, 0x6A, 0xC2, 0xB8, 0x25, 0x8C, 0x3A, 0xC2, 0x60, 0x20, 0x94, 0x51, 0x61,
-    0xF5, 0x3A, 0x61, 0xF6, 0xEF, 0x84, 0xC9, 0xAF, 0x09, 0x23, 0x4B, 0x18, 0x28, 0x04, 0x07, 0x99,
-    0xA1, 0x54, 0xF9, 0xAD, 0x53, 0xFA, 0xFC, 0x0A, 0x94, 0x4B, 0xF2, 0x75, 0xBD, 0x43, 0x63, 0x21,
-    0xFA, 0x11, 0xA8, 0x3C, 0x14, 0x9C, 0xA1, 0xF7, 0x52, 0x5D, 0x63, 0xA1, 0x5A, 0x8F, 0x24, 0x85,
-    0x21, 0x75, 0x4D, 0x6B, 0x90, 0xA8, 0x65, 0x88, 0x1B, 0x5A, 0x8C, 0xB8, 0x55, 0x68, 0x9E, 0x02,
-    0x5B, 0xED, 0xD9, 0xBA, 0x51, 0x89, 0x06, 0xE6, 0x6E, 0x36, 0xDA, 0xA5, 0x6C, 0x5A, 0x85, 0x85,
-    0x05, 0x86, 0x35, 0xBF, 0xE2, 0xEA, 0xCE, 0xBB, 0x68, 0xD2, 0xBC, 0xF2, 0xAC, 0xAA, 0x66, 0xEA,
-    0x27, 0xD5, 0x27, 0xA8, 0xB3, 0xDC, 0xF0, 0xAC, 0xE6, 0x53, 0xDE, 0x56, 0x9D, 0x2F, 0x7C, 0xEC,
-    0xE0, 0xAD, 0x7C, 0xEC, 0x78, 0x98, 0x7F, 0x29, 0xBB, 0xFA, 0x59, 0x9A, 0x0C, 0xFF, 0x3F, 0x34,
-    0x49, 0x37, 0x68, 0x52, 0x9C, 0x47, 0x93, 0x4B, 0x8E, 0x26, 0x2E, 0xE2, 0x51, 0xC7, 0xAC, 0x76,
-    0xDD, 0xF9, 0xE7, 0x09, 0x7D, 0xE0, 0xA8, 0xCC, 0x4C, 0xF5, 0x1F, 0xEF, 0x5F, 0x49, 0xBD, 0x5C,
-    0x5C, 0x60, 0xE2, 0xE8, 0xA7, 0x7A, 0xAD, 0xB6, 0x22, 0x6E, 0x37, 0xA0, 0xF9, 0xCC, 0x13, 0xED,
-    0x93, 0xB1, 0x3F, 0xDC, 0x38, 0x89, 0x48, 0x4B, 0xC2, 0x84, 0x88, 0xF6, 0x44, 0x6B, 0x4B, 0x2E,
-    0xF9, 0x64, 0x40, 0x4B, 0xBB, 0xA1, 0xB0, 0x70, 0xD6, 0xA3, 0x9E, 0xE6, 0x0C, 0xD4, 0x7A, 0xC0,
-    0x62, 0x04, 0x0C, 0x57, 0x8C, 0x54, 0xF5, 0x2A, 0xCB, 0x09, 0x30, 0x53, 0x0C, 0xD5, 0x49, 0x73,
-    0x9F, 0x09, 0x06, 0x9A, 0xDC, 0xCD, 0x26, 0xFF, 0xC3, 0xF0, 0x38, 0xEE, 0x29, 0x04, 0x25, 0xC4,
-    0xB5, 0x67, 0xB8, 0xCA, 0x2F, 0xD8, 0x77, 0xD2, 0x4F, 0xFB, 0x5C, 0xFE, 0x01, 0x1A, 0xCC, 0xDC,
-    0xC3, 0x3B, 0x53, 0x62, 0x92, 0x95, 0x81, 0x49, 0xFE, 0x7B, 0xDE, 0xF8, 0x24, 0x12, 0xC4, 0x86,
-    0xD5, 0xC5, 0x25, 0xC1, 0xB8, 0x0B, 0x15, 0xDC, 0xBD, 0x0D, 0xB0, 0xBD, 0x0F, 0x70, 0xF9, 0x0D,
-    0xBA, 0x31, 0x17, 0x1D, 0x7F, 0x8D, 0xE0, 0x8F, 0xE8, 0xF2, 0x32, 0x10, 0xB9, 0xB0, 0x26, 0x80,
-    0x66, 0xDB, 0xD6, 0xAF, 0x7A, 0x52, 0x26, 0x2E, 0xE9, 0x87, 0xE3, 0x5C, 0xA1, 0x7C, 0xBD, 0x50,
-    0x1C, 0x5C, 0xB2, 0x50, 0x48, 0x2C, 0x76, 0x35, 0x29, 0xA0, 0x9B, 0xB3, 0xF7, 0x8D, 0xB2, 0x8C,
-    0xB2, 0xC0, 0xE4, 0x49, 0x73, 0xF1, 0xAE, 0x1A, 0xCB, 0x4B, 0xF6, 0x24, 0xEA, 0x55, 0xE7, 0x3A,
-    0x56, 0x28, 0xC8, 0xC1, 0x99, 0xCE, 0x76, 0x5B, 0xE7, 0x79, 0xA0, 0xD9, 0x85, 0x0A, 0x20, 0x83,
-    0xDE, 0x8C, 0x06, 0x03, 0x5E, 0x28, 0x50, 0x95, 0x0D, 0x55, 0xB4, 0xB5, 0x1E, 0xC5, 0x6C, 0x1E,
-    0x2A, 0xB0, 0x4D, 0xB1, 0xEB, 0x58, 0xA3, 0xF5, 0x7B, 0xA6, 0x1F, 0xDE, 0xB0, 0x4F, 0x82, 0x2C,
-    0x8F, 0x08, 0x17, 0x2A, 0x9B, 0x99, 0x4A, 0x6B, 0xD6, 0x9C, 0xC5, 0x1C, 0xF4, 0x45, 0x15, 0x84,
-    0xE9, 0x65, 0x26, 0x84, 0x73, 0x38, 0x93, 0x05, 0x24, 0xFB, 0x24, 0xD4, 0x68, 0x65, 0x32, 0x06,
-    0x96, 0xB8, 0xF9, 0xEA, 0x6D, 0x90, 0xE2, 0x30, 0x8A, 0x84, 0x00, 0xCC, 0x54, 0x1B, 0x7E, 0x5E,
-    0x13, 0xD5, 0x4A, 0x82, 0x9F, 0xD6, 0xAC, 0x46, 0x15, 0x12, 0xBE, 0xDE, 0x8A, 0xA2, 0x4A, 0x3B,
-    0xCE, 0x2F, 0x65, 0x8C, 0x74, 0x83, 0x29, 0x4D, 0xBD, 0x8D, 0x28, 0x58, 0x73, 0xA7, 0x6B, 0x7E,
-    0x1F, 0xA8, 0xB6, 0xCD, 0xBC, 0x81, 0xBB, 0x88, 0xCC, 0x0C, 0x49, 0x3E, 0xF3, 0x1D, 0xB3, 0x2F,
-    0x8B, 0x58, 0x77, 0x71, 0x24, 0x45, 0xAC, 0x1B, 0x41, 0x7C, 0xBB, 0xAD, 0x7B, 0xC1, 0x97, 0xBF,
-    0xD3, 0xED, 0x34, 0x92, 0x1E, 0xAB, 0x6A, 0xD5, 0x12, 0xAB, 0x5E, 0x41, 0x8C, 0xE3, 0x7E, 0x8A,
-    0x93, 0x9C, 0x0A, 0x42, 0x4F, 0x34, 0x81, 0xB0, 0x6D, 0x62, 0xCB, 0xD4, 0x36, 0xF0, 0xCF, 0xBE,
-    0xD5, 0x3C, 0xD8, 0xBA, 0x14, 0x46, 0x69, 0x08, 0x15, 0x67, 0x35, 0xB0, 0x7D, 0x55, 0x95, 0x76,
-    0xA6, 0x4A, 0xAB, 0xC3, 0xB5, 0x78, 0x37, 0x69, 0x47, 0xE6, 0xE2, 0x33, 0xA5, 0x58, 0xA1, 0x6F,
-    0x3F, 0xE1, 0x5A, 0xFE, 0xCF, 0x68, 0x87, 0xC2, 0x92, 0x9E, 0x2F, 0xD6, 0x24, 0x73, 0x47, 0x09,
-    0xFA, 0x40, 0x4D, 0x81, 0x51, 0xCB, 0x64, 0xE8, 0xA5, 0x91, 0x95, 0x24, 0x0C, 0x46, 0x20, 0x8A,
-    0x6D, 0xC6, 0x78, 0xA1, 0x4D, 0xED, 0x9B, 0xDF, 0xB0, 0x2D, 0x5E, 0x91, 0xAD, 0x4B, 0x71, 0x04,
-    0x24, 0xAF, 0x81, 0xB5, 0xD1, 0x10, 0x9B, 0x54, 0x6A, 0x89, 0x61, 0x68, 0x48, 0x96, 0xA0, 0x4F,
-    0x94, 0x02, 0x33, 0xE5, 0xE3, 0xBE, 0xAC, 0xCA, 0x46, 0x13, 0x56, 0x71, 0xFD, 0xAC, 0x50, 0x73,
-    0x88, 0x8B, 0xD5, 0xA9, 0xCB, 0xDE, 0x4A, 0xD5, 0x4A, 0x57, 0xF8, 0xDF, 0x25, 0x0E, 0x33, 0xC6,
-    0xF1, 0x33, 0x6A, 0xF4, 0x75, 0x67, 0xC4, 0xD4, 0xAA, 0xA9, 0x98, 0x14, 0xE5, 0x94, 0xBA, 0x12,
-    0x61, 0xA7, 0xF3, 0x4A, 0x69, 0xA6, 0xEE, 0x8E, 0x44, 0x45, 0x3E, 0xF5, 0x50, 0xE3, 0x8D, 0x84,
-    0xC3, 0x6B, 0x62, 0xF5, 0xD4, 0xF0, 0x74, 0x34, 0xC3, 0x61, 0x5D, 0x7D, 0x74, 0x58, 0xD5, 0x1A,
-    0x34, 0x5E, 0xD9, 0xAB, 0x6C, 0x95, 0x2F, 0xE4, 0x79, 0xFF, 0xAA, 0xB2, 0xB2, 0x57, 0x6E, 0xDE,
-    0x50, 0x95, 0x38, 0xD2, 0x0A, 0xA8, 0x2B, 0x85, 0x5E, 0xD5, 0x1A, 0x16, 0xE4, 0x25, 0x22, 0x4B,
-    0xA6, 0x1A, 0x2B, 0x9D, 0x6B, 0xAB, 0x5D, 0x7F, 0xAF, 0xF7, 0x35, 0xAD, 0xA3, 0xBA, 0x82, 0x2A,
-    0xC8, 0xBB, 0x39, 0x40, 0x64, 0xEF, 0xA6, 0x1D, 0x41, 0x85, 0xE7, 0xC6, 0xCD, 0x1F, 0xED, 0x78,
-    0xE5, 0xA6, 0x78, 0x35, 0xCF, 0x0E, 0x5C, 0xF1, 0x8D, 0x25, 0x8E, 0x6D, 0xAC, 0xB7, 0x83, 0x05,
-    0x6F, 0x83, 0x83, 0x47, 0x31, 0x53, 0x78, 0x70, 0x97, 0xE5, 0x62, 0xAF, 0x8D, 0x4A, 0x31, 0xC0,
-    0xE0, 0x01, 0xA4, 0x6F, 0x36, 0x73, 0xF5, 0x49, 0xF7, 0x21, 0x43, 0xF2, 0x57, 0x0E, 0x0F, 0x0F,
-    0xF3, 0x6F, 0x43, 0x24, 0xA0, 0xE8, 0xD4, 0xA8, 0x97, 0x5D, 0x62, 0x59, 0xB1, 0xDA, 0x70, 0x4A,
-    0x81, 0x6F, 0x90, 0x95, 0xC7, 0x35, 0xEB, 0xBC, 0x04, 0xAE, 0x9E, 0xA5, 0xC0, 0xFB, 0x4B, 0xC3,
-    0x43, 0x19, 0x83, 0xF5, 0xF1, 0x2F, 0xAC, 0x85, 0xA1, 0x1A, 0x1B, 0x3A, 0x31, 0x02, 0x26, 0x8C,
-    0x7A, 0x3E, 0x50, 0xBE, 0xD2, 0x41, 0x32, 0xFF, 0x17, 0xBE, 0xD3, 0x7E, 0x17, 0x8A, 0xCD, 0xF3,
-    0x8A, 0x2B, 0x37, 0x5C, 0xC9, 0x69, 0xAA, 0x98, 0x50, 0x5F, 0xC4, 0x3B, 0x17, 0xA4, 0xE0, 0x6F,
-    0x0F, 0x34, 0xBD, 0x27, 0x70, 0xB4, 0x08, 0x55, 0xA3, 0x16, 0x82, 0x11, 0x18, 0x2D, 0x0E, 0xAF,
-    0x80, 0xDF, 0xA3, 0xF3, 0x0A, 0x0C, 0x0E, 0xAC, 0xDE, 0x6A, 0x67, 0x0C, 0x33, 0xFE, 0x93, 0x32,
-    0x6D, 0xB6, 0x3E, 0x86, 0x08, 0x16, 0x46, 0xCB, 0x66, 0xAB, 0xE2, 0x52, 0x31, 0x6A, 0xE5, 0x2D,
-    0x6A, 0x23, 0xC3, 0x6D, 0x62, 0x1F, 0x6D, 0x96, 0x7B, 0x5A, 0xA2, 0x3B, 0xB7, 0xE5, 0x4E, 0x52,
-    0x91, 0x12, 0x7D, 0x33, 0xEA, 0x3C, 0xE3, 0xB3, 0xA4, 0x52, 0x60, 0x5F, 0xCC, 0x7B, 0xE4, 0xE2,
-    0x9E, 0x06, 0xA8, 0x9A, 0x9A, 0xEB, 0xE4, 0xE7, 0x83, 0xAA, 0xCF, 0x58, 0x28, 0xCD, 0x24, 0xEA,
-    0x42, 0xB8, 0x25, 0x6E, 0x0C, 0x31, 0x3F, 0x0B, 0xCE, 0xD0, 0x0E, 0x3D, 0x86, 0x78, 0x3A, 0x60,
-    0x17, 0xED, 0x9C, 0x70, 0x58, 0x6C, 0x30, 0x41, 0x60, 0xC7, 0xEC, 0x84, 0x93, 0x0E, 0x1B, 0x05,
-    0x3D, 0x6E, 0xAB, 0x42, 0x70, 0xAA, 0xDB, 0xEA, 0x92, 0x92, 0xA5, 0x4F, 0x6F, 0xC8, 0xE8, 0x33,
-    0x0F, 0x0F, 0x07, 0x16, 0x3B, 0xB2, 0xBD, 0xBD, 0x9B, 0x9B, 0xDB, 0x4A, 0xDC, 0xB6, 0x5E, 0x0A,
-    0x3B, 0xAF, 0xFB, 0xF4, 0xB6, 0x10, 0x43, 0x45, 0x60, 0x74, 0x06, 0x46, 0x1D, 0x78, 0x9D, 0x3C,
-    0x94, 0x5C, 0xEB, 0x45, 0x53, 0xC3, 0x5C, 0xF2, 0x8A, 0x3D, 0x94, 0xCD, 0x67, 0xCF, 0xDC, 0xC0,
-    0x8A, 0x2D, 0xC4, 0x5E, 0x99, 0x55, 0x0B, 0x0B, 0x59, 0x4D, 0xC7, 0x02, 0x11, 0xED, 0xFC, 0xC3,
-    0x26, 0x30, 0x61, 0x9B, 0x87, 0xAC, 0x87, 0x46, 0x8D, 0xDF, 0x11, 0xF4, 0xD3, 0xB7, 0xD6, 0xA7,
-    0xD1, 0x63, 0xFE, 0xD3, 0xB3, 0x22, 0xA3, 0x95, 0xCC, 0x7F, 0x7C, 0x4B, 0x54, 0x0D, 0xB5, 0x52,
-    0x23, 0xC1, 0x89, 0x86, 0x70, 0x2C, 0x1C, 0x21, 0x12, 0xD2, 0x14, 0x92, 0xE1, 0x6E, 0x96, 0xEF,
-    0xF2, 0x68, 0x68, 0x87, 0x9E, 0x99, 0xDF, 0x72, 0x1E, 0x08, 0x91, 0x9A, 0xC7, 0x12, 0x3D, 0xBE,
-    0xCF, 0xA2, 0x28, 0xA2, 0x26, 0x15, 0x4E, 0x27, 0x9D, 0x4E, 0x3C, 0x9D, 0x7C, 0x3A, 0x89, 0x3C,
-    0x17, 0xB2, 0xAF, 0x77, 0x8A, 0x25, 0xC4, 0x7B, 0x52, 0x16, 0x35, 0xAD, 0x1B, 0xEC, 0xA0, 0xC7,
-    0x60, 0x95, 0x10, 0x0A, 0x34, 0xC1, 0xFE, 0xF9, 0x20, 0x93, 0x30, 0x03, 0xF2, 0xE4, 0xD1, 0x29,
-    0xAD, 0x7A, 0x84, 0x05, 0x5E, 0xD0, 0xA3, 0xA9, 0x41, 0x7D, 0xF7, 0xD1, 0x59, 0x11, 0x00, 0x9C,
-    0xDF, 0x72, 0x0F, 0x9F, 0xE1, 0x82, 0x52, 0x6C, 0xD9, 0xBB, 0xF0, 0x11, 0x72, 0x01, 0x16, 0x85,
-    0xE7, 0x46, 0x2F, 0x4F, 0x65, 0xB8, 0x31, 0xA2, 0x45, 0x3A, 0xF8, 0xC2, 0xBF, 0x05, 0x44, 0x60,
-    0xF0, 0xFB, 0xB4, 0x3D, 0xC8, 0x9F, 0x5D, 0x95, 0x03, 0xDB, 0x79, 0xBD, 0x6F, 0x79, 0x5A, 0x54,
-    0xF0, 0x19, 0x35, 0xDB, 0xE7, 0x56, 0x79, 0x78, 0x47, 0xCF, 0xE3, 0xF5, 0x07, 0x4A, 0x47, 0x2A,
-    0x0F, 0x7C, 0xAE, 0x67, 0x95, 0x7C, 0xA0, 0x00, 0xC6, 0x02, 0xEB, 0x1E, 0x78, 0x63, 0x58, 0xE5,
-    0x22, 0x4D, 0x50, 0x25, 0xEE, 0x41, 0x14, 0x7F, 0x04, 0x06, 0x55, 0xAF, 0x95, 0x27, 0xCE, 0xF8,
-    0xA5, 0x2E, 0x25, 0xE9, 0x96, 0xBD, 0xA1, 0x79, 0xAD, 0xFB, 0xA4, 0x5D, 0x3A, 0xF0, 0x48, 0x79,
-    0x0B, 0xD6, 0x27, 0x46, 0x30, 0xEA, 0x8D, 0x75, 0xF6, 0x3F, 0xBE, 0x46, 0x2B, 0xB0, 0xB7, 0x23,
-    0x05, 0x37, 0xA6, 0x99, 0xD3, 0xB3, 0xAA, 0xF5, 0x3D, 0xFB, 0xCA, 0x77, 0x6C, 0x32, 0xA2, 0xE5,
-    0x04, 0x87, 0xC0, 0xF5, 0x8C, 0xAE, 0x1C, 0x7C, 0xCF, 0xA6, 0xC4, 0x24, 0xEB, 0x52, 0x2A, 0x4C,
-    0x4F, 0xA7, 0x0A, 0x8C, 0x52, 0xAD, 0xD1, 0x30, 0x33, 0x18, 0xD5, 0x13, 0x0C, 0x13, 0x0C, 0x9E,
-    0x1F, 0xAA, 0xA5, 0xE4, 0xAA, 0x88, 0x17, 0x32, 0x06, 0xB3, 0xD3, 0x69, 0x38, 0x53, 0x6D, 0x84,
-    0xFF, 0x2D, 0x0B, 0x94, 0x7A, 0xCC, 0xB7, 0xA4, 0xBE, 0x1C, 0x4C, 0x87, 0x7B, 0xD3, 0xC1, 0x42,
-    0x96, 0x9F, 0x03, 0x5C, 0x17, 0x3D, 0xD7, 0xD3, 0x61, 0x7A, 0xA4, 0xE7, 0x8F, 0xB7, 0x8C, 0x3B,
-    0xB2, 0x70, 0x96, 0x45, 0x55, 0xAD, 0x83, 0x95, 0x9F, 0x77, 0xB0, 0xF2, 0xFE, 0x57, 0xB5, 0xF2,
-    0x48, 0xC3, 0xD3, 0x86, 0xAA, 0x58, 0x42, 0x2B, 0x29, 0x2E, 0xB0, 0x87, 0xE7, 0x49, 0xA3, 0xC6,
-    0x0E, 0x5B, 0xB4, 0x1B, 0x85, 0x5D, 0x57, 0xE3, 0xAB, 0x3E, 0xE9, 0x69, 0x95, 0x4F, 0x90, 0x5C,
-    0x7F, 0x4D, 0x56, 0xD9, 0x99, 0x7A, 0x24, 0x26, 0xC5, 0xD3, 0xBC, 0xC1, 0x46, 0x16, 0xA1, 0x16,
-    0xD0, 0x36, 0xB6, 0x99, 0xBF, 0x67, 0x4D, 0xF8, 0xEB, 0xD0, 0x04, 0x4B, 0x58, 0xB9, 0xC1, 0xCF,
-    0x83, 0xF5, 0xB9, 0xCA, 0xE7, 0x37, 0xC6, 0x52, 0xF3, 0xF1, 0x86, 0xD8, 0x69, 0x4F, 0x3C, 0xC7,
-    0x8C, 0xFF, 0x73, 0xA9, 0x3C, 0xDA, 0x85, 0xE3, 0x3F, 0x90, 0x3F, 0x76, 0xC6, 0x9E, 0xA7, 0x0A,
-    0x4B, 0x77, 0xF6, 0x20, 0xC5, 0xC0, 0x2F, 0x1A, 0x58, 0x5D, 0x80, 0x6D, 0xBC, 0x8E, 0x40, 0xFD,
-    0x36, 0x2C, 0xE3, 0x1D, 0x8E, 0xFA, 0x21, 0xB8, 0xC6, 0x3E, 0x2F, 0xBA, 0x13, 0x92, 0x23, 0xFE,
-    0x0A, 0xC1, 0xA7, 0x37, 0x87, 0xE6, 0xF5, 0xC0, 0xE8, 0x0B, 0x2F, 0x74, 0x56, 0x9D, 0xF9, 0x2B,
-    0x2E, 0xE3, 0xE5, 0x59, 0xEF, 0x41, 0xA5, 0xC0, 0xED, 0xAA, 0xA5, 0xB6, 0xC6, 0xCF, 0x6F, 0x12,
-    0x27, 0xB8, 0x32, 0xAA, 0x14, 0xFD, 0x41, 0x83, 0x43, 0xAB, 0x87, 0x9B, 0x99, 0xFD, 0x80, 0xC9,
-    0x97, 0xFD, 0xBE, 0x3B, 0xBC, 0x53, 0xDF, 0x60, 0x87, 0x62, 0xCC, 0xEF, 0xF7, 0xD0, 0xD6, 0x88,
-    0xB5, 0x9A, 0xA8, 0x04, 0x5E, 0xB1, 0x2E, 0xCF, 0xB1, 0xD7, 0xA8, 0xC9, 0x33, 0xF2, 0xE1, 0x3A,
-    0x65, 0xF6, 0x6D, 0x06, 0xF7, 0x98, 0x28, 0x79, 0xC4, 0xD8, 0xF8, 0x1D, 0x26, 0x0D, 0x1F, 0xF0,
-    0xE4, 0xE0, 0x09, 0xC3, 0x63, 0x8D, 0x3A, 0x35, 0x19, 0xE7, 0x9E, 0x2C, 0xA2, 0x3B, 0x44, 0xFD,
-    0x88, 0x94, 0xD2, 0x3C, 0x1A, 0x73, 0x0D, 0x75, 0x40, 0x1F, 0x2C, 0x01, 0x17, 0xC0, 0x2A, 0xBC,
-    0xFC, 0xB8, 0x91, 0x96, 0x54, 0xF8, 0xB0, 0x45, 0xC8, 0x07, 0x81, 0x7D, 0xCF, 0x04, 0x74, 0x0B,
-    0xFE, 0x3B, 0x5D, 0x80, 0x39, 0x97, 0xC1, 0x77, 0xFB, 0x10, 0xD3, 0x2E, 0xC2, 0x7C, 0x60, 0x0A,
-    0x82, 0x3C, 0xE4, 0x21, 0xEF, 0xD9, 0x65, 0x39, 0xE0, 0x09, 0x69, 0xF6, 0xB7, 0x92, 0xFD, 0x29,
-    0xC3, 0x89, 0x7F, 0x93, 0x94, 0x11, 0x79, 0xFC, 0x40, 0x92, 0x07, 0xA2, 0xE1, 0x5E, 0x3C, 0x1D,
-    0xB9, 0x6A, 0x68, 0x8C, 0xB0, 0x8D, 0xE7, 0x8B, 0x99, 0xFD, 0x89, 0x35, 0xA9, 0xFD, 0x1E, 0x4C,
-    0x22, 0xCF, 0x69, 0x60, 0x11, 0xF6, 0xA9, 0x89, 0xDC, 0x8B, 0x6E, 0xE3, 0x13, 0xEE, 0x40, 0x91,
-    0xD7, 0xC3, 0x11, 0xEE, 0x25, 0x60, 0xD9, 0x2C, 0xFA, 0x73, 0x9E, 0x83, 0x50, 0xBC, 0x66, 0xEE,
-    0xE4, 0x63, 0xA1, 0xF1, 0x5B, 0x39, 0x3F, 0xF5, 0x78, 0xC8, 0x11, 0xD9, 0x01, 0x39, 0x05, 0x18,
-    0x3E, 0x4A, 0xD5, 0xC5, 0x7A, 0xC8, 0xC8, 0x5F, 0xC5, 0x28, 0x0D, 0xD1, 0x7F, 0x5B, 0xDC, 0xCF,
-    0x62, 0x16, 0xA4, 0x61, 0xE6, 0x96, 0xEC, 0x18, 0x4A, 0x30, 0x2E, 0x7D, 0xC4, 0x63, 0xCF, 0x0F,
-    0x18, 0xA9, 0xFE, 0x8E, 0xC5, 0xC7, 0x27, 0xAB, 0xC8, 0x5D, 0x0F, 0xC1, 0xF8, 0x2B, 0x0D, 0xCD,
-    0x49, 0xF4, 0xA4, 0x54, 0xF3, 0x4E, 0x17, 0x5B, 0x46, 0xAB, 0xD3, 0x8A, 0xAD, 0xD5, 0x51, 0x1D,
-    0xCF, 0xAD, 0x0C, 0xA2, 0x0C, 0xB3, 0x83, 0xCC, 0xE2, 0x3A, 0xDE, 0x7D, 0x4B, 0xD5, 0x66, 0xE9,
-    0xCE, 0x88, 0x49, 0x04, 0x16, 0xA8, 0x39, 0xE4, 0xEC, 0xF1, 0x0B, 0x78, 0xFC, 0x0F, 0x78, 0x6C,
-    0xB2, 0xD2, 0x33, 0x85, 0xAB, 0xD3, 0xA3, 0xE3, 0x4D, 0x81, 0x8B, 0x43, 0x3A, 0xE3, 0x7E, 0xEB,
-    0x71, 0xEE, 0xA5, 0x3F, 0x00, 0xD9, 0xEA, 0xC8, 0xC5, 0xB0, 0xDF, 0xF8, 0xF1, 0xC8, 0xB9, 0x17,
-    0x7F, 0xFD, 0xD2, 0x70, 0x4E, 0x79, 0xF1, 0x85, 0xA3, 0x2F, 0xFA, 0x5C, 0xD1, 0xCC, 0xCE, 0x5F,
-    0xFF, 0x22, 0xE5, 0xDC, 0xCB, 0x4D, 0x1A, 0x9F, 0x50, 0xD2, 0x92, 0x93, 0xA9, 0x10, 0xFC, 0xB4,
-    0xCE, 0x08, 0xAA, 0x07, 0x29, 0x5A, 0x2A, 0xA8, 0x7F, 0x22, 0x97, 0x63, 0xC8, 0x64, 0x72, 0xAB,
-    0xBE, 0xB6, 0xE3, 0x77, 0x08, 0xF5, 0x2B, 0x24, 0xE7, 0x9A, 0x37, 0xC9, 0xFF, 0x01, 0xD5, 0x5A,
-    0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x24, 0xA3, 0x10, 0x30, 0x91, 0xD0, 0x83, 0x5D, 0x04, 0x51,
-    0x2D, 0x76, 0xF0, 0x60, 0x18, 0x91, 0x98, 0xC1, 0x83, 0x07, 0xC9, 0x64, 0x92, 0xB1, 0x8B, 0x87,
-    0x28, 0x1E, 0x0C, 0xD4, 0x5D, 0x9B, 0xA1, 0xF2, 0xE0, 0x41, 0x68, 0x25, 0x91, 0x49, 0x86, 0x8C,
-    0xF5, 0xDE, 0x45, 0x43, 0x06, 0x47, 0x1E, 0xEC, 0x41, 0x83, 0x06, 0x5B, 0x64, 0xDC, 0x21, 0x43,
-    0x16, 0xB6, 0x45, 0x91, 0x21, 0x43, 0x89, 0x38, 0x09, 0xD0, 0x64, 0x30, 0xD3, 0xD2, 0xC1, 0x53,
-    0xC2, 0xF7, 0x6E, 0xBF, 0xEF, 0xDC, 0xF7, 0x23, 0xC9, 0x0A, 0x62, 0x18, 0xFE, 0x91, 0xA9, 0xC7,
-    0x73, 0x29, 0xF2, 0xF2, 0xDE, 0x73, 0xCE, 0x3D, 0xFF, 0x97, 0x22, 0x89, 0x64, 0x79, 0x91, 0x67,
-    0xE9, 0x94, 0xF0, 0x38, 0x21, 0x33, 0x32, 0xA7, 0x7F, 0x31, 0x9E, 0xEC, 0xF9, 0x4B, 0x33, 0xFD,
-    0x13, 0xA7, 0x14, 0x71, 0x79, 0x56, 0x22, 0x99, 0xC9, 0xBD, 0x1F, 0xEF, 0x35, 0xE1, 0x97, 0x7F,
-    0x6B, 0xA3, 0x3B, 0x77, 0xDA, 0xE4, 0xCD, 0x4F, 0xEA, 0x04, 0xCF, 0x78, 0x66, 0xFB, 0x4E, 0xBD,
-    0xFF, 0x66, 0x29, 0xF1, 0xFB, 0xA5, 0x84, 0xFF, 0x28, 0x5F, 0x0F, 0x7E, 0xF8, 0xA4, 0x71, 0x8D,
-    0xA9, 0x25, 0x36, 0xA9, 0x8E, 0xE5, 0x0E, 0xC7, 0xD5, 0x63, 0xDA, 0xE4, 0x22, 0xC5, 0x8D, 0x56,
-    0xDC, 0xD6, 0xE9, 0xC4, 0x6B, 0xA4, 0x13, 0xBF, 0x92, 0x5B, 0x12, 0x54, 0xF2, 0x7B, 0x02, 0x11,
-    0xBF, 0x06, 0xF0, 0x14, 0x34, 0x00, 0x6E, 0x2B, 0x44, 0x07, 0x63, 0x29, 0x90, 0x55, 0x8E, 0x72,
-    0x8E, 0x20, 0x19, 0x03, 0xFD, 0x77, 0x9E, 0x60, 0x13, 0xA7, 0xF3, 0x6D, 0x2A, 0x79, 0x60, 0x06,
-    0x17, 0xF3, 0xD8, 0x18, 0x23, 0x67, 0x65, 0xA9, 0xE3, 0xDD, 0x54, 0xE7, 0x7F, 0x5D, 0x64, 0xFD,
-    0x56, 0xF6, 0x65, 0x83, 0x47, 0x55, 0x58, 0x46, 0x69, 0x28, 0x7E, 0x39, 0x0B, 0xF4, 0xE6, 0xC5,
-    0xA9, 0x78, 0xE2, 0xBA, 0x8A, 0xC4, 0x2B, 0xC3, 0x3C, 0x4A, 0xE3, 0x81, 0x29, 0x6F, 0x67, 0xDF,
-    0x34, 0x67, 0x44, 0x6E, 0xF2, 0xDD, 0xC2, 0x38, 0xA6, 0x2D, 0x06, 0x52, 0x7C, 0x15, 0x36, 0x12,
-    0xE5, 0x3E, 0x80, 0x78, 0x3D, 0x99, 0x15, 0x50, 0x82, 0xD9, 0xFB, 0xB2, 0x0C, 0x4C, 0x05, 0x48,
-    0x27, 0x6F, 0x00, 0xFD, 0xE8, 0x03, 0xD0, 0x1C, 0x7E, 0x0A, 0x72, 0xFD, 0x2F, 0x30, 0xFD, 0x05,
-    0xB3, 0x28, 0x9E, 0x31, 0x03, 0x61, 0x6F, 0x1C, 0x00, 0xCE, 0x3B, 0xFD, 0x07, 0xEE, 0x59, 0xE0,
-    0xF4, 0x01, 0x2E, 0x9A, 0xAB, 0x9C, 0xB3, 0x27, 0x47, 0x37, 0x77, 0x1F, 0x96, 0x8F, 0xFB, 0xEE,
-    0x4D, 0x81, 0x3A, 0xD3, 0x17, 0xFF, 0xEB, 0x22, 0x05, 0xE6, 0x65, 0x24, 0x61, 0x19, 0x4B, 0x90,
-    0xC7, 0xE2, 0x48, 0x8C, 0x47, 0x21, 0xF0, 0x09, 0x30, 0x4D, 0x84, 0x65, 0x99, 0xCF, 0xFA, 0xB2,
-    0xE2, 0x9B, 0x7C, 0x45, 0xB2, 0x7A, 0x55, 0x82, 0x26, 0xC9, 0xDD, 0x36, 0x6E, 0xA5, 0x0D, 0x4C,
-    0xDA, 0x82, 0xBE, 0x06, 0xEB, 0x56, 0x89, 0xCB, 0x65, 0x4A, 0x40, 0x00, 0x97, 0xC4, 0xAB, 0x5E,
-    0x06, 0x57, 0x62, 0x3D, 0xBD, 0x32, 0xAA, 0xC2, 0xD4, 0xC7, 0x5C, 0xB2, 0x74, 0x55, 0x66, 0x9D,
-    0x3A, 0xF1, 0x5A, 0xFC, 0xE6, 0x9C, 0x46, 0x46, 0xC7, 0x12, 0xF1, 0x16, 0xDF, 0xDC, 0x18, 0x70,
-    0x7D, 0x72, 0x89, 0x31, 0x4C, 0x0F, 0x0B, 0xD9, 0x70, 0x55, 0x17, 0x65, 0x45, 0x82, 0x12, 0x78,
-    0xCC, 0x49, 0x28, 0xB7, 0xDD, 0x36, 0x94, 0x19, 0x07, 0x93, 0xFB, 0xF9, 0x2C, 0x1E, 0xA6, 0x5E,
-    0x39, 0xEF, 0x73, 0x42, 0xDB, 0x60, 0x55, 0x02, 0x95, 0xC7, 0x71, 0x53, 0x69, 0x33, 0xEC, 0x42,
-    0xF1, 0xF0, 0xCA, 0x19, 0x08, 0xC8, 0x49, 0x3F, 0x0F, 0xC1, 0xFE, 0xCD, 0x30, 0x05, 0xC9, 0xA6,
-    0xC6, 0xAA, 0x54, 0xEE, 0xC7, 0x98, 0x88, 0xD3, 0x62, 0x74, 0x88, 0xB8, 0x44, 0x15, 0x39, 0xB0,
-    0x31, 0xB0, 0xEB, 0x58, 0x2B, 0xA2, 0xE7, 0x45, 0xB9, 0x92, 0x5C, 0x2C, 0x13, 0xAF, 0x9E, 0xC2,
-    0xFC, 0x17, 0xEA, 0xE8, 0xBB, 0x7A, 0xCD, 0xAB, 0x3B, 0xFC, 0xFC, 0x7A, 0x3B, 0x6A, 0xE2, 0xFB,
-    0x9D, 0x83, 0x4E, 0xC7, 0x20, 0x3C, 0x57, 0xFC, 0xDC, 0x69, 0x38, 0xF2, 0x02, 0x78, 0xDB, 0x49,
-    0xF2, 0x56, 0x2B, 0x45, 0xD0, 0xE8, 0xC9, 0x6B, 0xDE, 0xE3, 0x33, 0xF6, 0x61, 0x5F, 0xBE, 0x53,
-    0x18, 0xD3, 0x42, 0x02, 0xDB, 0xA1, 0x5C, 0x1E, 0x74, 0x5E, 0x39, 0xBE, 0x98, 0x26, 0xA6, 0x4E,
-    0x86, 0x18, 0x3D, 0x0C, 0x07, 0x85, 0x1C, 0xFC, 0x14, 0xBA, 0x40, 0x0E, 0x6E, 0x5F, 0xAC, 0xC1,
-    0x41, 0x59, 0x75, 0xC8, 0x41, 0xE8, 0x46, 0x0B, 0xBE, 0x8C, 0x1B, 0xA7, 0xA1, 0x5C, 0xAF, 0x5D,
-    0xAC, 0xC0, 0x33, 0x68, 0x0F, 0x59, 0x27, 0xAB, 0x89, 0x6D, 0xC2, 0x5C, 0xBB, 0x04, 0x15, 0x38,
-    0x28, 0xAB, 0x5E, 0x43, 0x0E, 0xAE, 0x3A, 0x3D, 0x70, 0xF0, 0x43, 0x53, 0x19, 0xD0, 0xF9, 0xF7,
-    0xC5, 0xF4, 0xF8, 0x43, 0x71, 0xF0, 0xF8, 0xE2, 0xE2, 0xA2, 0x24, 0xA0, 0x33, 0x3D, 0xBD, 0xB1,
-    0xB1, 0x41, 0x2D, 0xF3, 0x4C, 0x8A, 0x05, 0x3E, 0xE7, 0x34, 0xF3, 0xB2, 0xB5, 0x22, 0xCB, 0x2B,
-    0xB2, 0x35, 0x2F, 0x30, 0x21, 0x4D, 0x68, 0x2A, 0x67, 0x60, 0x29, 0x0C, 0xD2, 0x03, 0xCF, 0x31,
-    0xC7, 0x7E, 0xE6, 0xF9, 0xEE, 0xC3, 0x0C, 0xFB, 0x3A, 0x6F, 0x43, 0xAC, 0xCB, 0x73, 0x7E, 0xB3,
-    0xE2, 0x35, 0xA7, 0x20, 0x13, 0x9E, 0x72, 0x09, 0x12, 0x13, 0xAA, 0x4D, 0x68, 0xC4, 0xCF, 0x4F,
-    0xCD, 0xC8, 0xD9, 0xCC, 0xF4, 0xA8, 0x4B, 0x20, 0x87, 0xFD, 0xF3, 0xB5, 0x49, 0xFF, 0x1A, 0xBA,
-    0xEC, 0xF5, 0xC5, 0x59, 0xAA, 0xC4, 0x6B, 0xC5, 0xE9, 0x5D, 0x76, 0x7A, 0x9B, 0x6E, 0xBB, 0x3A,
-    0xDD, 0xD0, 0x80, 0x9D, 0x17, 0xE7, 0x23, 0xBF, 0x0D, 0xAB, 0x28, 0x5D, 0x80, 0x81, 0x82, 0x2E,
-    0x75, 0x8F, 0x00, 0x92, 0xD4, 0x19, 0x81, 0xDC, 0x05, 0x28, 0x3D, 0x80, 0x3A, 0xEA, 0x83, 0x6D,
-    0x5D, 0x96, 0x2F, 0x14, 0x4D, 0x5C, 0x2E, 0xD0, 0x4C, 0x2F, 0xEC, 0xB3, 0x6D, 0x39, 0x01, 0x15,
-    0x2B, 0x26, 0xBB, 0x03, 0xB5, 0xA1, 0xE0, 0xF6, 0xF9, 0x00, 0x74, 0x03, 0xBB, 0xFB, 0x19, 0x06,
-    0x68, 0xB8, 0xB4, 0x00, 0xC5, 0x01, 0x40, 0x1F, 0x68, 0x97, 0x88, 0xC0, 0x27, 0x10, 0x2E, 0x0B,
-    0xD8, 0xF2, 0xE8, 0x40, 0x07, 0x70, 0x1B, 0x20, 0xBB, 0xD4, 0x24, 0xB5, 0xBC, 0xBB, 0x7E, 0x7A,
-    0x5D, 0x64, 0x4D, 0x0C, 0xFE, 0x0A, 0x39, 0x06, 0x8B, 0x13, 0x48, 0x58, 0xF9, 0x2D, 0xE8, 0xBE,
-    0x25, 0x1D, 0x0C, 0x66, 0x2E, 0x2F, 0x88, 0xDC, 0x16, 0xBF, 0x2F, 0x6B, 0x7D, 0x39, 0x79, 0x9B,
-    0xD7, 0x07, 0xFF, 0x06, 0xC4, 0x15, 0x93, 0xBC, 0x38, 0x48, 0xA3, 0xBF, 0x42, 0x7E, 0xDA, 0xDB,
-    0xD2, 0x75, 0xA3, 0x1F, 0xC6, 0x5A, 0x95, 0x5E, 0xFC, 0x56, 0x13, 0xC0, 0x34, 0x1D, 0x93, 0xA3,
-    0xD0, 0xCB, 0x65, 0xA8, 0xD9, 0x82, 0x57, 0x49, 0xF4, 0x06, 0xF5, 0x0F, 0xD6, 0xAF, 0x81, 0x70,
-    0x77, 0x71, 0xC9, 0x93, 0xD7, 0xBC, 0xC7, 0x67, 0xEC, 0xC3, 0xBE, 0x7C, 0x87, 0xB8, 0xF0, 0xB8,
-    0x05, 0x31, 0xCD, 0xC5, 0x87, 0xB1, 0x0D, 0x53, 0xD9, 0x46, 0x03, 0xB5, 0x3D, 0xD9, 0xD9, 0x25,
-    0xE8, 0xA8, 0x62, 0xDA, 0xB4, 0xDA, 0xA8, 0x6D, 0xA3, 0x7A, 0x6B, 0xE3, 0x97, 0xDA, 0x84, 0x74,
-    0xAC, 0x1D, 0x5E, 0x4B, 0xD8, 0x2C, 0x80, 0x78, 0x58, 0xA0, 0x15, 0xD7, 0x90, 0x86, 0xD6, 0xCB,
-    0x28, 0x68, 0x4D, 0xC8, 0x65, 0xF4, 0xAA, 0xD7, 0xD8, 0xF8, 0xE5, 0x15, 0x36, 0x61, 0x5A, 0xB3,
-    0x89, 0xDC, 0x6F, 0x8B, 0x6B, 0x98, 0x0D, 0xD6, 0xDF, 0xCE, 0xC6, 0x9B, 0xAD, 0x36, 0x9C, 0x0D,
-    0xEA, 0x86, 0xD9, 0x3C, 0x33, 0x36, 0xAA, 0x13, 0xAC, 0x03, 0x51, 0xAC, 0x81, 0xEE, 0xB6, 0x45,
-    0xF7, 0xE4, 0x43, 0xA2, 0xAB, 0x4D, 0x04, 0xE9, 0x27, 0xBA, 0xD0, 0x18, 0x34, 0x2B, 0x09, 0xE4,
-    0xBF, 0x2F, 0xED, 0x82, 0xDB, 0x26, 0xE6, 0xFB, 0xE6, 0x15, 0xFA, 0x5A, 0xCE, 0xDB, 0x10, 0x5D,
-    0x6D, 0xF0, 0x1A, 0x07, 0x88, 0xF4, 0x8A, 0xB3, 0x2D, 0xA8, 0xFD, 0xA1, 0x93, 0xC3, 0x6C, 0x5E,
-    0xF9, 0x0A, 0x67, 0x83, 0x76, 0xF1, 0x35, 0x68, 0x18, 0x3B, 0x67, 0xAA, 0x65, 0x62, 0x35, 0x8D,
-    0x07, 0xB4, 0x4D, 0xFC, 0x54, 0xA0, 0x71, 0x54, 0x49, 0x68, 0x1D, 0x82, 0x10, 0xA1, 0xE6, 0xCD,
-    0x5B, 0x47, 0xBF, 0xC5, 0x3E, 0x39, 0x87, 0x84, 0x16, 0xBA, 0x90, 0x74, 0x68, 0xA2, 0x47, 0xAC,
-    0xBD, 0x36, 0xA0, 0x06, 0xC0, 0x2A, 0x61, 0xC1, 0xA1, 0x95, 0x73, 0x40, 0x19, 0x9A, 0x39, 0x0F,
-    0xED, 0x81, 0x76, 0x6E, 0x05, 0x1D, 0x43, 0x8C, 0xE6, 0x25, 0x10, 0x7E, 0xDE, 0xAD, 0xE7, 0xE9,
-    0x37, 0xBD, 0xF2, 0x26, 0x9B, 0xE0, 0xBD, 0x8A, 0x4D, 0xE8, 0xE5, 0x6C, 0xE6, 0x82, 0x8D, 0x01,
-    0x24, 0x74, 0x3E, 0x34, 0xE4, 0xE7, 0x96, 0xF5, 0xB0, 0x8D, 0x36, 0x9C, 0xAD, 0xCF, 0xD7, 0x24,
-    0x34, 0xA3, 0x08, 0x45, 0xF5, 0x2C, 0xA2, 0x03, 0x6F, 0xAC, 0xE3, 0x74, 0x77, 0xD9, 0x1D, 0x3F,
-    0xDF, 0x7B, 0xC6, 0xB9, 0xB8, 0x30, 0x69, 0x70, 0x02, 0x6A, 0xA4, 0xB1, 0x6E, 0xC2, 0xA5, 0xDF,
-    0xD6, 0xD3, 0xC1, 0xE9, 0x55, 0x6B, 0x88, 0x68, 0x92, 0x34, 0xAC, 0xC3, 0xAF, 0xB3, 0xD2, 0xA5,
-    0xAF, 0x9F, 0x82, 0xD5, 0x74, 0xD7, 0x39, 0x9A, 0x67, 0x39, 0xD5, 0x97, 0xB1, 0xCA, 0xDB, 0x75,
-    0x9A, 0x84, 0x4B, 0x93, 0x89, 0x2B, 0x7D, 0xAA, 0x66, 0x37, 0x52, 0xB1, 0x88, 0xB9, 0xDA, 0xB2,
-    0xA0, 0x43, 0x2C, 0x6B, 0xE4, 0xD0, 0xEA, 0x40, 0x4D, 0xC1, 0x01, 0x54, 0xCA, 0xBC, 0x92, 0x26,
-    0xC4, 0x2F, 0x23, 0x3A, 0xF2, 0x34, 0xC4, 0x10, 0xA1, 0x0E, 0x31, 0x03, 0x55, 0xC1, 0x84, 0x1B,
-    0xD7, 0x29, 0x71, 0x2A, 0x81, 0x5B, 0x1A, 0x81, 0x34, 0xC4, 0x85, 0xE2, 0x53, 0xD8, 0x20, 0x90,
-    0x8C, 0x81, 0x15, 0xA2, 0xDB, 0x4D, 0xCA, 0xA5, 0x1D, 0x99, 0xA2, 0xC5, 0x95, 0x80, 0x44, 0xC8,
-    0xAB, 0x8A, 0x68, 0x92, 0x8E, 0x09, 0x70, 0x14, 0x1F, 0x95, 0x3A, 0x79, 0x51, 0x0E, 0x3B, 0xFE,
-    0x2F, 0x5E, 0x9D, 0x60, 0x92, 0x28, 0x0E, 0xB7, 0x6E, 0xAB, 0xCE, 0x46, 0x9C, 0x37, 0xF7, 0xF2,
-    0x43, 0x8E, 0xBF, 0xAA, 0x16, 0x1C, 0x2D, 0x03, 0x3B, 0xF3, 0x0D, 0x3A, 0xBC, 0xEC, 0x53, 0x82,
-    0x5F, 0x90, 0x3F, 0x1E, 0x72, 0xCE, 0x3B, 0xF5, 0x11, 0x0D, 0xED, 0xA1, 0x39, 0x50, 0x70, 0x42,
-    0xB7, 0x8E, 0xE4, 0xC0, 0xE3, 0xB0, 0xF1, 0xDC, 0xA6, 0x10, 0x56, 0x5A, 0x7A, 0x9A, 0x87, 0xD4,
-    0x2F, 0x2B, 0x0C, 0x15, 0x87, 0x19, 0xC2, 0xAC, 0x9B, 0x60, 0x7B, 0x18, 0x70, 0xF6, 0x11, 0x2A,
-    0x50, 0x30, 0x5E, 0x2C, 0x6C, 0x2B, 0x7F, 0xEA, 0xD9, 0x40, 0xE2, 0xBF, 0x3D, 0x7D, 0xCB, 0xF9,
-    0xD2, 0xB6, 0xDE, 0x9D, 0x9E, 0x5A, 0x1D, 0xFF, 0x7D, 0x6B, 0x93, 0x42, 0xD7, 0xB6, 0x33, 0xC3,
-    0x76, 0x7E, 0xD8, 0x2E, 0xBB, 0xFD, 0x45, 0x46, 0x7D, 0x4C, 0xF1, 0xD4, 0x80, 0xE2, 0xFF, 0xB7,
-    0x49, 0x81, 0x7D, 0x1E, 0x7C, 0x7B, 0x5D, 0x5B, 0xD8, 0x5A, 0x6D, 0x91, 0x4E, 0xF5, 0x6C, 0x72,
-    0x66, 0xDB, 0x4D, 0x6D, 0x2F, 0x83, 0x02, 0xB6, 0x37, 0x61, 0x2D, 0xD8, 0x36, 0x58, 0x69, 0xD8,
-    0x42, 0xB7, 0x01, 0xEE, 0x97, 0x06, 0x1B, 0x37, 0x1A, 0x60, 0x4F, 0xBC, 0x87, 0xEE, 0xCF, 0x21,
-    0x21, 0xD1, 0x8F, 0x45, 0x25, 0xC8, 0x6E, 0x1A, 0x04, 0x50, 0x5E, 0xAB, 0x71, 0x1E, 0x58, 0xE4,
-    0x56, 0xE4, 0x96, 0xDA, 0x5E, 0x4D, 0x57, 0x86, 0x31, 0xD3, 0xCF, 0x82, 0x72, 0xD4, 0x99, 0xD1,
-    0xAC, 0x84, 0x9C, 0x00, 0x91, 0x8A, 0x1C, 0x85, 0x4B, 0x41, 0x8E, 0x67, 0x98, 0xD3, 0x81, 0xD1,
-    0x15, 0xD8, 0x46, 0x1B, 0x77, 0x82, 0x0B, 0x4E, 0x11, 0x95, 0xE9, 0x71, 0x2A, 0xAA, 0x66, 0x0E,
-    0x91, 0x38, 0x52, 0x24, 0xBA, 0x2A, 0xA6, 0xA4, 0xA7, 0xC7, 0xC1, 0x9A, 0x22, 0xA3, 0x69, 0xAB,
-    0xFA, 0x62, 0x79, 0x6D, 0xB7, 0x38, 0xEB, 0x0A, 0x2C, 0x11, 0x60, 0xB6, 0xA0, 0x24, 0x1D, 0x04,
-    0xEE, 0x18, 0x60, 0xCC, 0x7D, 0x80, 0xBC, 0x56, 0x46, 0x2B, 0x97, 0x0F, 0xEC, 0x32, 0x02, 0x57,
-    0x08, 0x36, 0x09, 0x5A, 0x0C, 0xEF, 0x36, 0xCA, 0xC7, 0xC2, 0x32, 0x51, 0xBD, 0x0D, 0x7D, 0x94,
-    0x44, 0xE5, 0xC8, 0xD3, 0x6C, 0xA9, 0xE4, 0x1E, 0x0E, 0xFC, 0xAE, 0xB1, 0x8F, 0xB1, 0x06, 0x0D,
-    0x4C, 0xFC, 0x0C, 0x48, 0xCE, 0x91, 0xC5, 0x67, 0xE4, 0xCA, 0x61, 0xC0, 0x0F, 0x59, 0x2E, 0x94,
-    0x8C, 0xCB, 0x9A, 0x21, 0x41, 0x90, 0x05, 0xB7, 0xDE, 0x6F, 0xA9, 0x9E, 0x15, 0x6A, 0x7F, 0x00,
-    0x4A, 0x29, 0x17, 0x15, 0x0A, 0x44, 0x7B, 0x70, 0x72, 0x8C, 0x4F, 0xB3, 0x64, 0xD6, 0xD9, 0xF9,
-    0x91, 0x7E, 0x78, 0xF1, 0x92, 0xB9, 0x8A, 0x41, 0xE8, 0x26, 0x21, 0xD3, 0xF0, 0xF2, 0xAB, 0x94,
-    0x68, 0xA7, 0x7C, 0xCC, 0xE3, 0x3B, 0x1F, 0xF1, 0x3A, 0x30, 0x12, 0x5D, 0xCA, 0x11, 0xA5, 0xAF,
-    0xCB, 0xFA, 0xE3, 0x1D, 0xFF, 0x94, 0x5B, 0xF5, 0xFD, 0x66, 0xC0, 0x5C, 0xAF, 0xDA, 0xB5, 0x58,
-    0x8F, 0x67, 0x70, 0xAC, 0xC0, 0x55, 0xE6, 0xEA, 0x2C, 0x4B, 0xE1, 0xE6, 0x52, 0xCD, 0xA7, 0x7E,
-    0x8F, 0xD0, 0xE9, 0xEB, 0xC2, 0x15, 0x0A, 0xB3, 0x94, 0x30, 0x51, 0x31, 0x88, 0x87, 0xF0, 0x57,
-    0xFD, 0x45, 0x98, 0x20, 0x8C, 0x90, 0x46, 0xD5, 0x3B, 0x7A, 0xCD, 0xFB, 0x16, 0xC6, 0xBB, 0x7A,
-    0xDA, 0xB7, 0x92, 0x74, 0x3C, 0x1A, 0x12, 0x68, 0x8B, 0x03, 0x7E, 0x71, 0x03, 0x6B, 0x79, 0x1D,
-    0xD1, 0x35, 0xC6, 0xF9, 0x8A, 0x94, 0x69, 0x50, 0xE0, 0x9A, 0xFC, 0x26, 0xAC, 0xDA, 0xBD, 0xFB,
-    0x0C, 0x0D, 0x5C, 0xDA, 0xFC, 0xA9, 0xFD, 0x41, 0x41, 0xD1, 0xA2, 0x57, 0x7F, 0x09, 0xE4, 0x14,
-    0x3B, 0x1E, 0xF4, 0x2E, 0xCC, 0x5D, 0xD0, 0x10, 0xA4, 0xEC, 0x0D, 0x78, 0xAF, 0x21, 0xFC, 0x9C,
-    0x59, 0xB8, 0xFB, 0xCF, 0x8E, 0xB0, 0x1A, 0x28, 0xCC, 0x52, 0xC2, 0xA4, 0x24, 0x0C, 0x6B, 0xC2,
-    0xA0, 0x25, 0xF4, 0x3A, 0x42, 0x19, 0x28, 0x2C, 0x7E, 0x4B, 0x98, 0x7C, 0x46, 0x18, 0x7D, 0x47,
-    0x18, 0x18, 0x42, 0x4F, 0x21, 0x0C, 0x26, 0x6B, 0x18, 0x45, 0x7A, 0x69, 0x27, 0x05, 0x5D, 0x05,
-    0xB0, 0x8F, 0xD2, 0xBD, 0xE1, 0x70, 0xF7, 0xCB, 0xE1, 0xB0, 0xCB, 0xFA, 0x93, 0xC4, 0x74, 0x09,
-    0x48, 0xBC, 0x60, 0xC1, 0xF9, 0x6A, 0x5F, 0xBD, 0x65, 0xA6, 0x9E, 0x33, 0xC9, 0x69, 0xE9, 0xE2,
-    0x92, 0xB6, 0x3E, 0xAA, 0x68, 0xF6, 0xC3, 0x8A, 0x16, 0x3A, 0xAC, 0x15, 0x36, 0x3F, 0x03, 0x6B,
-    0xED, 0x59, 0xDB, 0xB7, 0x38, 0x42, 0x54, 0xDA, 0xD1, 0x68, 0x3C, 0x93, 0xE1, 0x2C, 0xC8, 0x53,
-    0x79, 0x91, 0xFC, 0x87, 0xB3, 0x5B, 0x47, 0xA1, 0xF5, 0x37, 0x1C, 0xEF, 0x4E, 0xE2, 0x79, 0xEB,
-    0xEF, 0xB4, 0x5E, 0x33, 0xA4, 0xE2, 0x84, 0x3C, 0x1F, 0x54, 0x1C, 0xD1, 0xD8, 0x37, 0x51, 0xCC,
-    0x33, 0xF5, 0x65, 0x3D, 0xCD, 0xAD, 0xEA, 0x39, 0x7A, 0xCB, 0xD4, 0x7F, 0x2E, 0xA8, 0x70, 0xCE,
-    0x6B, 0x38, 0x32, 0xA0, 0xE8, 0x44, 0xC5, 0xE7, 0x18, 0xF0, 0xB5, 0xC0, 0x68, 0x29, 0x6F, 0xEB,
-    0xB9, 0xC0, 0xDF, 0xCD, 0x67, 0x89, 0xBF, 0x86, 0x87, 0x41, 0x63, 0xEB, 0x08, 0x73, 0x07, 0x46,
-    0xC9, 0x87, 0x12, 0xFF, 0xDF, 0x88, 0x5C, 0x5D, 0x81, 0xAB, 0x8A, 0x25, 0xA8, 0x82, 0x32, 0x4E,
-    0xDD, 0x06, 0xD9, 0xD5, 0x36, 0x9C, 0x67, 0x5C, 0xD9, 0x00, 0x6C, 0x1B, 0x11, 0x60, 0xCB, 0xB2,
-    0x7F, 0x2C, 0x71, 0x1A, 0x94, 0xAB, 0xE8, 0x0B, 0xE7, 0x75, 0x75, 0x42, 0xD6, 0x2C, 0x29, 0xDB,
-    0x39, 0xAB, 0x94, 0x35, 0x4A, 0x59, 0x8F, 0x53, 0x79, 0x4A, 0x99, 0x6F, 0x48, 0x59, 0xA8, 0x94,
-    0xCD, 0x2A, 0x65, 0xF3, 0x4A, 0xD9, 0xA6, 0x52, 0xD6, 0x90, 0x32, 0xB7, 0x24, 0x1D, 0x7E, 0x4E,
-    0x18, 0x2A, 0x4D, 0x33, 0x0A, 0xE7, 0x95, 0xB2, 0x2B, 0x4A, 0x59, 0x43, 0xCA, 0xEE, 0x54, 0xA4,
-    0xEC, 0x6E, 0x49, 0xCA, 0x7E, 0x4A, 0x49, 0xD9, 0x60, 0x17, 0x65, 0x99, 0x52, 0xF6, 0x83, 0x86,
-    0xFF, 0x15, 0x29, 0x1B, 0xEE, 0x23, 0x38, 0xD7, 0x1E, 0x4C, 0xDD, 0xF3, 0x49, 0x02, 0x3C, 0x72,
-    0x64, 0xA3, 0x23, 0x33, 0x8D, 0x07, 0x8B, 0x6B, 0x6A, 0xB7, 0xE8, 0xB9, 0x7D, 0xF6, 0x75, 0xB4,
-    0xF4, 0xA4, 0x50, 0x1E, 0x2F, 0x14, 0x0B, 0xFB, 0x5A, 0xB6, 0x29, 0xB4, 0xA0, 0x98, 0x54, 0xBC,
-    0x19, 0x99, 0x1B, 0x1A, 0xB7, 0x9A, 0x74, 0xB2, 0x1F, 0xF2, 0x6A, 0x3E, 0x49, 0xE3, 0xB7, 0xF5,
-    0x4E, 0x6F, 0x42, 0x85, 0x9F, 0x3E, 0x1F, 0x54, 0x58, 0xF7, 0x11, 0xD8, 0xCC, 0x43, 0x97, 0x24,
-    0x89, 0x35, 0xC6, 0xD5, 0x4C, 0xA7, 0x72, 0xAA, 0xE7, 0x82, 0x8A, 0x4D, 0x16, 0x94, 0xA4, 0xD3,
-    0x1C, 0xC2, 0xC2, 0x2D, 0xBF, 0x3C, 0x40, 0xE1, 0x0F, 0xAD, 0x2C, 0x9D, 0xD6, 0x26, 0xDB, 0xE5,
-    0x03, 0x6D, 0x49, 0x48, 0x89, 0x38, 0xB2, 0x8F, 0x8A, 0xC4, 0x34, 0xA1, 0xA9, 0x63, 0xB3, 0x7E,
-    0xC4, 0xD4, 0x50, 0x6A, 0xBC, 0xC6, 0x4D, 0xAF, 0x15, 0x9D, 0x65, 0x4B, 0x25, 0x52, 0x6B, 0x6A,
-    0xCC, 0x6F, 0xC3, 0x9A, 0x43, 0xF8, 0x0D, 0x37, 0x00, 0xBC, 0x1E, 0x8B, 0x05, 0x4E, 0xA7, 0xBB,
-    0x7D, 0xDB, 0xCB, 0x32, 0xAA, 0x90, 0xAB, 0x61, 0x41, 0xD7, 0xF2, 0x61, 0xA1, 0x26, 0x80, 0x53,
-    0xC5, 0x0E, 0x37, 0x16, 0x8C, 0xC6, 0x50, 0x0D, 0x83, 0x39, 0x48, 0x92, 0xB7, 0x2F, 0x02, 0x37,
-    0xB8, 0xE9, 0x0E, 0xAE, 0x6B, 0xE0, 0x95, 0xB1, 0x7E, 0x1F, 0x31, 0x28, 0x0B, 0x6B, 0x82, 0x66,
-    0x2F, 0xD0, 0x7B, 0x0C, 0xE2, 0x34, 0x7A, 0x43, 0xC0, 0x36, 0xB8, 0x81, 0x78, 0xD0, 0x0C, 0xD2,
-    0x5D, 0xE3, 0xE9, 0xF0, 0x97, 0xEC, 0xDE, 0x9E, 0xF2, 0xE7, 0x78, 0xAA, 0x9B, 0x3D, 0x6A, 0xC5,
-    0xAB, 0x25, 0xAD, 0x20, 0x52, 0x6E, 0x6F, 0x6B, 0xF0, 0xA0, 0x7B, 0xA4, 0x13, 0xD8, 0x4A, 0x0C,
-    0x24, 0x5A, 0x39, 0xDD, 0x79, 0xAC, 0x69, 0x8E, 0x84, 0x25, 0xDF, 0x05, 0xB5, 0xDE, 0xAB, 0x99,
-    0x6D, 0xE7, 0xD3, 0x1E, 0x77, 0x0E, 0xF2, 0x59, 0xEE, 0x44, 0xF4, 0x74, 0x84, 0xBE, 0xAE, 0x29,
-    0x98, 0xDC, 0xBD, 0xA0, 0xA5, 0xEB, 0x5F, 0x2B, 0x9C, 0x05, 0x74, 0xBA, 0x18, 0xEB, 0x3B, 0xDD,
-    0x85, 0xFF, 0xEA, 0x24, 0xE9, 0x7C, 0xBB, 0xC5, 0x73, 0x7C, 0x64, 0xEA, 0xFA, 0x63, 0x43, 0xA7,
-    0xF3, 0xD8, 0x45, 0xDD, 0x63, 0xE5, 0x9C, 0x82, 0xF5, 0x86, 0x9D, 0xA2, 0x04, 0x0B, 0x02, 0x58,
-    0xE7, 0x12, 0x38, 0xFB, 0xA5, 0x66, 0xC3, 0x63, 0xE0, 0x5C, 0x68, 0x10, 0x02, 0x82, 0xD5, 0x21,
-    0x53, 0xF8, 0x38, 0x07, 0x48, 0xF8, 0x20, 0xB3, 0x80, 0xE9, 0x37, 0xB3, 0xF2, 0x24, 0x3F, 0xDD,
-    0x42, 0xC4, 0xBE, 0x87, 0xB1, 0x37, 0xEF, 0x41, 0xC4, 0x8E, 0x4D, 0x6C, 0x95, 0xE6, 0xD9, 0xDB,
-    0x23, 0x43, 0xA5, 0xA9, 0x98, 0x97, 0x3E, 0x4D, 0x34, 0xB4, 0x72, 0x18, 0x72, 0xE5, 0x62, 0xAE,
-    0xE4, 0x2A, 0xF7, 0x6B, 0x5A, 0x44, 0x78, 0x6E, 0xBE, 0x27, 0x4C, 0x7D, 0xD2, 0x68, 0x1C, 0xD3,
-    0xC2, 0x48, 0x7E, 0x59, 0xBC, 0x7B, 0xF7, 0x1B, 0x06, 0xFA, 0x15, 0xE2, 0xFC, 0xB9, 0xF4, 0x29,
-    0x62, 0xB0, 0x0E, 0x7D, 0xF4, 0x5A, 0x78, 0x60, 0xE8, 0x64, 0xC9, 0xDD, 0x8E, 0x74, 0xBF, 0xA5,
-    0x7A, 0xE2, 0x12, 0xA1, 0xE2, 0x48, 0x39, 0x38, 0xC7, 0x62, 0xDA, 0x66, 0x00, 0x70, 0x93, 0x4E,
-    0x4B, 0xAF, 0xF4, 0x5E, 0xD8, 0x7B, 0xEA, 0x08, 0x71, 0x16, 0x16, 0x87, 0x30, 0xCF, 0xBF, 0xBF,
-    0xA3, 0x3D, 0x40, 0xE0, 0x99, 0x71, 0xAE, 0x3E, 0x46, 0xF3, 0x59, 0x21, 0x60, 0x34, 0x85, 0xE0,
-    0x82, 0xAA, 0x0A, 0x8D, 0x86, 0x0E, 0x3B, 0x17, 0x7E, 0xDC, 0xB8, 0x51, 0x39, 0xAC, 0x79, 0x99,
-    0x0A, 0xF3, 0xDE, 0x5F, 0x5C, 0x4C, 0x31, 0x73, 0xAB, 0x2A, 0xA7, 0x4D, 0x66, 0xB3, 0xA3, 0x4C,
-    0x37, 0x7F, 0x88, 0x01, 0xCC, 0x51, 0x9A, 0xE4, 0x73, 0x59, 0x1E, 0xE4, 0x91, 0xE9, 0x45, 0x06,
-    0x01, 0x92, 0xA9, 0x5C, 0x56, 0xDD, 0x8E, 0x31, 0xE3, 0x1B, 0xBA, 0x0A, 0xF4, 0x1A, 0x2C, 0x81,
-    0xD4, 0xA0, 0x21, 0xAD, 0x18, 0xB2, 0x4E, 0x52, 0x47, 0xD5, 0xF8, 0xC0, 0x33, 0xB5, 0xC1, 0x19,
-    0x30, 0x7A, 0x3D, 0x68, 0x1D, 0xFB, 0x19, 0x47, 0x66, 0x74, 0x33, 0x4A, 0xBC, 0xAF, 0x86, 0xDF,
-    0x25, 0x8C, 0x7A, 0xD3, 0x17, 0x74, 0x36, 0x51, 0xA0, 0x85, 0x18, 0x0C, 0x07, 0x50, 0xAA, 0x68,
-    0x96, 0x6E, 0xEE, 0x72, 0x59, 0xC4, 0xA3, 0x28, 0x61, 0xC2, 0x89, 0x47, 0x1B, 0xC1, 0x8A, 0x72,
-    0x3B, 0x94, 0x96, 0x27, 0xD9, 0xD8, 0xE8, 0x58, 0xDB, 0x4C, 0x16, 0x17, 0xDF, 0xDE, 0x8D, 0x47,
-    0x64, 0xF1, 0x38, 0xE9, 0xB7, 0x4E, 0x3B, 0xC6, 0x43, 0xA3, 0x7A, 0x9A, 0x01, 0x5A, 0x81, 0x35,
-    0x6B, 0x03, 0x68, 0x02, 0x76, 0x5B, 0x80, 0xC7, 0x39, 0x17, 0x75, 0x9D, 0xA6, 0x94, 0x9A, 0xBE,
-    0xBA, 0xA6, 0x7A, 0x0E, 0x35, 0xCF, 0x9F, 0xC4, 0x5C, 0xAC, 0x8B, 0x7B, 0x6D, 0x5C, 0xF2, 0x7C,
-    0x40, 0x97, 0x1E, 0xE3, 0x3C, 0xA7, 0x95, 0x79, 0xA1, 0xDD, 0xE5, 0x6B, 0x27, 0x25, 0x4A, 0x2C,
-    0xE5, 0x74, 0xA7, 0x5E, 0xFF, 0x21, 0x7E, 0x90, 0x83, 0x69, 0x73, 0x95, 0xBB, 0xB5, 0x08, 0xBD,
-    0x90, 0x0F, 0x60, 0x32, 0xCC, 0xBB, 0x3C, 0x29, 0x28, 0x3E, 0xDA, 0x68, 0xF0, 0x34, 0x50, 0x12,
-    0x96, 0x83, 0xFE, 0x92, 0x2F, 0x78, 0xF5, 0xE5, 0x91, 0x08, 0x3D, 0xDA, 0x68, 0xA7, 0xDC, 0x6A,
-    0xDB, 0x6F, 0xB6, 0xF7, 0x16, 0x7F, 0x1E, 0x91, 0xCC, 0x61, 0x64, 0x7C, 0x19, 0x9E, 0xF3, 0x43,
-    0xEE, 0x8E, 0x32, 0xEC, 0xE1, 0xC6, 0x9F, 0x44, 0x37, 0x20, 0x0D, 0x0B, 0xAC, 0xBC, 0x1F, 0xB5,
-    0x75, 0x5F, 0x48, 0xE4, 0xF4, 0xCE, 0x2D, 0x5A, 0x10, 0x58, 0x86, 0x96, 0x89, 0x4A, 0x89, 0xE4,
-    0x25, 0xCE, 0xA1, 0xBA, 0x09, 0x2B, 0x1E, 0x89, 0x1C, 0x0C, 0xF4, 0x29, 0xFB, 0xAD, 0xF1, 0x0D,
-    0x64, 0x46, 0xB5, 0x83, 0xD0, 0x61, 0x70, 0x89, 0x69, 0x1C, 0x67, 0x53, 0xD1, 0xB7, 0x59, 0x6D,
-    0xD8, 0xE7, 0xF6, 0x54, 0x6C, 0xBE, 0xC0, 0xED, 0xB3, 0x21, 0xB3, 0xDA, 0xA3, 0xFB, 0xB3, 0xDA,
-    0xA4, 0x8D, 0xA1, 0xAA, 0xD3, 0x3D, 0x46, 0x36, 0xCE, 0x40, 0x53, 0x3F, 0x4D, 0x99, 0xA0, 0xA5,
-    0xBE, 0x46, 0x12, 0x7E, 0xF3, 0x40, 0x6C, 0xF1, 0x70, 0x10, 0x3C, 0x01, 0x04, 0x5B, 0x3C, 0x7E,
-    0xBE, 0x80, 0x48, 0x34, 0x97, 0x8F, 0xB5, 0xA6, 0xA4, 0x41, 0x58, 0x3A, 0xFA, 0x4E, 0xC1, 0xD6,
-    0x48, 0x2F, 0xCB, 0xDE, 0xCF, 0x5A, 0x52, 0x46, 0x44, 0xB0, 0x8C, 0x8D, 0xAB, 0xD6, 0xAF, 0x6F,
-    0xE9, 0x55, 0xCA, 0x2D, 0x0F, 0x7E, 0x89, 0x39, 0x99, 0x7D, 0x0D, 0xCC, 0xE9, 0xC6, 0xCC, 0xC9,
-    0x47, 0x7C, 0x51, 0xCF, 0xAC, 0x71, 0x9D, 0xE6, 0x33, 0xAB, 0xA3, 0x32, 0xBC, 0x93, 0x3F, 0x4D,
-    0x34, 0x6C, 0xB1, 0x9D, 0xC6, 0x3A, 0x52, 0x6B, 0x99, 0x0C, 0x13, 0x11, 0x67, 0x5F, 0x1E, 0xF2,
-    0x84, 0xD1, 0x18, 0xC6, 0x07, 0x67, 0x10, 0x1F, 0xEC, 0xC0, 0xC9, 0xBD, 0x01, 0x0B, 0xE0, 0xEC,
-    0x8D, 0x0F, 0x9E, 0x34, 0x06, 0xCC, 0x67, 0x1C, 0x46, 0xA8, 0x0A, 0xC4, 0x6E, 0xE6, 0xCB, 0x53,
-    0x95, 0x88, 0x61, 0xB4, 0x6A, 0xAB, 0x17, 0x0F, 0x6C, 0x4B, 0xEF, 0xFA, 0x3E, 0x6B, 0x72, 0x4C,
-    0x0D, 0x33, 0x04, 0xB5, 0x9F, 0x7B, 0x31, 0x9E, 0x01, 0xC2, 0x83, 0x15, 0x22, 0xDC, 0x8E, 0x10,
-    0xB6, 0x3E, 0x7D, 0x00, 0x6C, 0x42, 0xE2, 0x3A, 0x4B, 0xB0, 0x4C, 0x0C, 0x1B, 0x00, 0xB7, 0x02,
-    0xF0, 0x4A, 0x80, 0x90, 0x08, 0xFF, 0x8E, 0x08, 0xDF, 0x22, 0xC2, 0x2D, 0x11, 0x6E, 0xF8, 0xFD,
-    0x23, 0x11, 0xF6, 0x59, 0x04, 0x0D, 0x89, 0xB0, 0xFD, 0xCA, 0xC3, 0xEE, 0xAC, 0xEB, 0x4E, 0x8D,
-    0xAA, 0xE9, 0x68, 0x6B, 0x5D, 0xBF, 0xF2, 0x10, 0x79, 0x69, 0x7F, 0x22, 0xD5, 0x63, 0x80, 0x8F,
-    0xE8, 0xBE, 0xA8, 0x59, 0x74, 0x84, 0x92, 0xC3, 0x70, 0x04, 0x8F, 0x00, 0xBB, 0x21, 0x0C, 0x35,
-    0xED, 0xE0, 0x17, 0x10, 0x46, 0xFE, 0xCC, 0x5A, 0x8F, 0xB9, 0xCB, 0x2C, 0xD3, 0x7C, 0x40, 0x33,
-    0x34, 0x64, 0xEB, 0xB5, 0x49, 0xBD, 0xD6, 0xA2, 0x68, 0x93, 0x2A, 0x5B, 0xA1, 0x3A, 0x73, 0x08,
-    0x30, 0x3C, 0x6D, 0x57, 0x58, 0xBF, 0x1F, 0x31, 0xBA, 0x2B, 0x77, 0x97, 0x78, 0x06, 0xF9, 0x96,
-    0x56, 0x62, 0x4F, 0x3C, 0x73, 0x0C, 0x83, 0x74, 0x59, 0x57, 0xB9, 0x3F, 0x86, 0x41, 0xBE, 0x7C,
-    0x50, 0x7D, 0xEF, 0x59, 0x70, 0xCF, 0xFD, 0x68, 0xB4, 0xB0, 0xBA, 0xAE, 0x6A, 0xD6, 0xE7, 0x1F,
-    0x48, 0xF8, 0x0A, 0x23, 0xA6, 0x87, 0xD0, 0xA4, 0x68, 0x11, 0x23, 0x85, 0x25, 0xBF, 0xEF, 0x49,
-    0x19, 0xCF, 0x72, 0x92, 0x19, 0xFB, 0x55, 0x14, 0x32, 0xB5, 0x79, 0x6A, 0xEB, 0x32, 0xF5, 0xB6,
-    0x25, 0xA5, 0xFC, 0xA8, 0xE6, 0x13, 0x6E, 0x4D, 0xDC, 0x65, 0x9C, 0xF8, 0x3F, 0x7E, 0xD8, 0xF9,
-    0x13, 0x87, 0xA7, 0x1B, 0xD3, 0x18, 0xD2, 0xDA, 0xED, 0x95, 0x51, 0x86, 0xE7, 0x8C, 0x83, 0xF3,
-    0x60, 0xB4, 0xBF, 0x3B, 0x3D, 0x18, 0x7D, 0x12, 0x77, 0x9C, 0xE8, 0x66, 0xEC, 0xE6, 0xF7, 0x46,
-    0x35, 0x77, 0xE7, 0x40, 0x00, 0xFE, 0x39, 0xF0, 0x86, 0xA9, 0xF3, 0x13, 0x9C, 0xA1, 0x63, 0x68,
-    0x2F, 0xE8, 0xC8, 0xA8, 0x83, 0xED, 0x08, 0xB8, 0x3D, 0xBA, 0xDC, 0x21, 0xE8, 0x2C, 0x18, 0x3D,
-    0xD5, 0xCE, 0x86, 0x5A, 0x6B, 0xF2, 0xB8, 0x72, 0x76, 0xE0, 0x58, 0x9D, 0x5E, 0xD6, 0xC7, 0xA0,
-    0x4E, 0x7A, 0xE0, 0x94, 0x9A, 0xEB, 0x4F, 0x93, 0xA5, 0x99, 0x66, 0xD2, 0x33, 0xE4, 0x5D, 0xF2,
-    0x66, 0x37, 0x04, 0x91, 0xB4, 0x0F, 0x6E, 0x22, 0x3E, 0x6B, 0x76, 0xFE, 0x1F, 0xD5, 0x5C, 0x3D,
-    0x90, 0xDD, 0xD6, 0x75, 0x3E, 0x00, 0xCC, 0x85, 0x42, 0x24, 0x02, 0x0B, 0xFD, 0x0D, 0x37, 0xE6,
-    0x4B, 0x91, 0x42, 0xA3, 0x58, 0x44, 0x0A, 0x17, 0x2C, 0x96, 0x0B, 0x4C, 0x5A, 0x35, 0x5B, 0x70,
-    0x9D, 0x34, 0x09, 0xD3, 0xCA, 0x33, 0x99, 0x65, 0xC1, 0x82, 0x93, 0x90, 0x0B, 0xD8, 0x2E, 0xDD,
-    0x6C, 0xE3, 0x3A, 0x4C, 0xC6, 0x85, 0xF2, 0x98, 0xC9, 0xAA, 0x60, 0xC1, 0x4C, 0xA8, 0x05, 0xE2,
-    0x14, 0x29, 0x52, 0x08, 0x63, 0x4D, 0xE2, 0x32, 0xC8, 0x88, 0x19, 0xC7, 0x56, 0x61, 0x38, 0x01,
-    0xC7, 0x58, 0xEA, 0x3D, 0xDC, 0x7C, 0xDF, 0xB9, 0x78, 0x7F, 0xCB, 0x15, 0xC5, 0x5D, 0x3D, 0x2E,
-    0x9F, 0x96, 0xEF, 0x7D, 0xEF, 0x0F, 0xB8, 0xB8, 0xF7, 0x3B, 0xF7, 0x9E, 0xBF, 0x7B, 0x40, 0x71,
-    0x87, 0xC3, 0x44, 0xC4, 0x33, 0x26, 0x13, 0x71, 0xB6, 0xB7, 0xE5, 0xC8, 0x9F, 0x5F, 0x12, 0xC3,
-    0x8A, 0x38, 0xA8, 0x89, 0x51, 0x43, 0xBC, 0xDA, 0x12, 0x6F, 0x8D, 0x88, 0xCD, 0x98, 0x58, 0xE7,
-    0x00, 0xB7, 0x8A, 0x81, 0x5E, 0x11, 0xA3, 0x35, 0xBF, 0x18, 0x14, 0x22, 0x41, 0x12, 0xA2, 0x89,
-    0x50, 0x9B, 0xB8, 0x24, 0x3E, 0x9A, 0x88, 0x87, 0xF7, 0xD0, 0x44, 0x6C, 0x0C, 0x4E, 0x7E, 0x20,
-    0x0E, 0x10, 0x5F, 0x8E, 0xC5, 0x01, 0xE6, 0xE2, 0xE2, 0xE0, 0x14, 0x0D, 0xE0, 0x80, 0x2C, 0xC0,
-    0xFB, 0xB8, 0xD8, 0x39, 0x94, 0x73, 0xA6, 0x31, 0x46, 0x02, 0xD3, 0x39, 0xEC, 0x2C, 0xFA, 0x5A,
-    0xB0, 0xAB, 0xC9, 0x5C, 0x37, 0x9D, 0xBC, 0xC3, 0x05, 0x0F, 0xF3, 0x42, 0xC2, 0x32, 0xA8, 0x24,
-    0x2C, 0xBC, 0x1A, 0xD7, 0xF7, 0xD8, 0xE1, 0x29, 0x38, 0x7F, 0x5C, 0x8B, 0x63, 0x4C, 0x2D, 0x61,
-    0x83, 0x8F, 0x51, 0x06, 0x88, 0xF9, 0x43, 0x6A, 0xC1, 0xE7, 0xC7, 0x10, 0x90, 0xBD, 0xD3, 0xC8,
-    0xC0, 0xFC, 0x7A, 0x2C, 0xBE, 0xF9, 0x9E, 0x49, 0xE4, 0x35, 0xB6, 0xEF, 0x66, 0x9E, 0x8E, 0x2B,
-    0xE4, 0xB5, 0x9E, 0x70, 0xA4, 0x92, 0xEB, 0xD8, 0xD7, 0xEF, 0xAE, 0x38, 0x63, 0x85, 0x9B, 0x89,
-    0x53, 0xF9, 0x68, 0xBD, 0xDB, 0x07, 0x63, 0x29, 0x78, 0x92, 0xE0, 0x91, 0x9C, 0x21, 0x77, 0x2B,
-    0xC6, 0x08, 0xAF, 0x13, 0xE8, 0xDC, 0xB9, 0xAD, 0xBD, 0xD3, 0xAE, 0x38, 0xDA, 0x2D, 0xD7, 0xBE,
-    0xD7, 0x0E, 0x89, 0x69, 0x67, 0x3D, 0x7D, 0xA1, 0x1C, 0x51, 0x36, 0x72, 0x99, 0x57, 0x79, 0x48,
-    0x68, 0xA7, 0xA0, 0x94, 0xA4, 0xEC, 0xCD, 0xBA, 0x7E, 0xFE, 0x2E, 0x81, 0xFD, 0x77, 0xF8, 0xD1,
-    0x23, 0x9F, 0x01, 0xCF, 0xFD, 0x9D, 0x85, 0xF9, 0xE7, 0x70, 0x88, 0x83, 0x27, 0x79, 0x29, 0x79,
-    0x12, 0xD6, 0xEE, 0x48, 0x3C, 0x76, 0xC7, 0xAB, 0x41, 0x9E, 0x5B, 0x92, 0x47, 0x89, 0xC0, 0x0C,
-    0x48, 0x21, 0x64, 0xCF, 0x84, 0x62, 0x72, 0xF0, 0x80, 0xA7, 0x85, 0x1C, 0xA8, 0x0F, 0x3E, 0x2E,
-    0x78, 0xE8, 0xD3, 0x87, 0x62, 0x32, 0x0E, 0xC9, 0x98, 0x12, 0x03, 0x61, 0xAF, 0xCE, 0x91, 0xD4,
-    0x8B, 0x38, 0x31, 0xC6, 0x9B, 0x03, 0x3B, 0x08, 0x0F, 0x27, 0xFA, 0x73, 0x0B, 0x15, 0xD3, 0xCF,
-    0xED, 0x76, 0x40, 0x61, 0x50, 0x93, 0x43, 0x90, 0x54, 0xC5, 0x89, 0x23, 0x14, 0xF8, 0xB1, 0xCF,
-    0xC4, 0x76, 0x00, 0xDD, 0xFE, 0xC3, 0xA0, 0x71, 0x6A, 0xD7, 0x98, 0x4A, 0x52, 0x90, 0xE6, 0x6C,
-    0xE1, 0xD7, 0xF3, 0xDA, 0x49, 0xD2, 0x90, 0xB2, 0x6B, 0xED, 0x88, 0xA4, 0x5C, 0xE6, 0x05, 0xFD,
-    0x95, 0x21, 0xC4, 0x85, 0x7E, 0x08, 0x40, 0xC4, 0x00, 0x47, 0x6C, 0x62, 0x48, 0x6D, 0x90, 0x39,
-    0xA5, 0x53, 0xBC, 0x18, 0x42, 0x1C, 0x5D, 0x67, 0xD3, 0xFE, 0x29, 0xE8, 0x0C, 0x91, 0x15, 0x9A,
-    0x21, 0x89, 0x5D, 0x2D, 0x3C, 0x8C, 0x2B, 0xD9, 0x2D, 0x17, 0x3B, 0xB7, 0x4C, 0x42, 0xCE, 0xE1,
-    0x1F, 0x96, 0xE9, 0xBB, 0xB8, 0x4A, 0xCD, 0x25, 0x63, 0xD8, 0xBF, 0x54, 0x07, 0x98, 0xAD, 0x0A,
-    0x21, 0x4E, 0x26, 0x99, 0xD4, 0x7E, 0x21, 0x77, 0x22, 0x9C, 0x89, 0x25, 0x1F, 0xB6, 0x96, 0x98,
-    0x17, 0x41, 0xC8, 0x6B, 0xF2, 0x16, 0xBB, 0x06, 0x95, 0x89, 0x89, 0xF1, 0x2F, 0x5C, 0x39, 0x9E,
-    0x29, 0x94, 0x00, 0x5D, 0xA3, 0x07, 0x47, 0x26, 0x4A, 0x6E, 0xCC, 0x9E, 0xC8, 0x8E, 0x31, 0xF8,
-    0x19, 0x03, 0xD8, 0x01, 0x1D, 0x23, 0xF1, 0x5B, 0xA2, 0x33, 0x26, 0x52, 0xD9, 0x02, 0xD3, 0x84,
-    0x18, 0x17, 0xC4, 0x68, 0x0E, 0x07, 0xE5, 0xF1, 0x38, 0x7F, 0x8C, 0x3D, 0x2B, 0x4E, 0xA6, 0xAD,
-    0x39, 0x1D, 0xD1, 0xD3, 0x47, 0x54, 0xCB, 0xF5, 0xEE, 0x1E, 0x5C, 0x13, 0xF4, 0x44, 0x6D, 0xD6,
-    0xB9, 0x6D, 0x07, 0x3D, 0x1D, 0x18, 0x9A, 0x14, 0xC7, 0x04, 0xEC, 0x7B, 0x1A, 0x26, 0x8A, 0xCA,
-    0xD5, 0xEF, 0x2A, 0xCA, 0x04, 0xF3, 0x36, 0x56, 0xDF, 0x06, 0x18, 0x34, 0x7E, 0xCE, 0xC5, 0xE1,
-    0x18, 0x95, 0xBE, 0x51, 0xA6, 0x72, 0xE5, 0x2C, 0xFD, 0x52, 0xD4, 0x23, 0xED, 0x59, 0x03, 0x6D,
-    0x21, 0xAC, 0xD9, 0x9A, 0x67, 0xBA, 0xF8, 0x91, 0x5E, 0x05, 0x9D, 0x67, 0xC7, 0xBE, 0x12, 0x63,
-    0x6F, 0x8C, 0xB7, 0xC1, 0x0F, 0x5A, 0x48, 0x06, 0xE5, 0x77, 0xF4, 0xFD, 0x72, 0x18, 0xA3, 0xC4,
-    0x8D, 0x0A, 0xB9, 0xA7, 0xC5, 0xD9, 0xCE, 0xAF, 0x91, 0x95, 0xD1, 0x84, 0x2B, 0xC0, 0xDA, 0x56,
-    0x8C, 0x03, 0x46, 0xB1, 0xF8, 0x5D, 0x9E, 0xC2, 0xD0, 0x7A, 0x06, 0x23, 0xC5, 0x78, 0x75, 0xD0,
-    0x3A, 0x7E, 0xA5, 0xE2, 0x58, 0xE0, 0xAF, 0x7A, 0x9C, 0x72, 0xA3, 0xD4, 0x58, 0x66, 0x94, 0x18,
-    0xE5, 0xE5, 0x9D, 0xE1, 0x5D, 0x9A, 0x6B, 0xAC, 0x84, 0xD7, 0xB7, 0xB7, 0x16, 0x67, 0x98, 0x29,
-    0x48, 0x57, 0x81, 0xBE, 0x07, 0x1C, 0x98, 0x47, 0x70, 0xA7, 0x20, 0x72, 0x14, 0xC6, 0x68, 0xC0,
-    0x65, 0xE7, 0xF1, 0xEE, 0x9A, 0x1C, 0x7B, 0xC8, 0x04, 0x6E, 0x12, 0xEE, 0x13, 0x1A, 0x34, 0xEF,
-    0xD6, 0xD7, 0xBB, 0xE1, 0x7E, 0xCD, 0x4B, 0xD6, 0x74, 0x24, 0xD1, 0x48, 0xB1, 0xE0, 0x46, 0xEA,
-    0x4A, 0xCB, 0x0B, 0xBF, 0xD6, 0x95, 0xD6, 0x0C, 0x32, 0x77, 0x84, 0x95, 0x06, 0x4E, 0x64, 0x14,
-    0x0F, 0x87, 0x23, 0x7A, 0x1B, 0xF1, 0xF6, 0xF6, 0xB5, 0xF9, 0x95, 0x36, 0xB0, 0x2B, 0xED, 0xF7,
-    0xFD, 0xC6, 0x69, 0x16, 0x56, 0xDA, 0xB7, 0xE5, 0x86, 0xC8, 0x06, 0xBD, 0x92, 0xE8, 0x1E, 0xD6,
-    0x59, 0xC8, 0x65, 0xE6, 0xFC, 0xA3, 0xAC, 0xC2, 0xD0, 0xE1, 0x11, 0xAA, 0x43, 0x48, 0x7F, 0x30,
-    0x86, 0x16, 0x3A, 0xFF, 0x48, 0x5E, 0x08, 0x05, 0x72, 0x61, 0xEA, 0xC4, 0x74, 0x53, 0xB8, 0xB5,
-    0x0A, 0x14, 0xA8, 0x11, 0xA2, 0x8E, 0x0D, 0xFA, 0xE7, 0xB1, 0x46, 0x68, 0x39, 0x34, 0xBC, 0xBC,
-    0x31, 0xCA, 0xBB, 0xEA, 0x52, 0x4F, 0x5C, 0x45, 0xF5, 0xC2, 0x2D, 0x34, 0xAA, 0xF8, 0xF9, 0x65,
-    0x5E, 0x2E, 0x77, 0xBC, 0x0F, 0xAC, 0x2B, 0xAD, 0x6E, 0x1F, 0x9F, 0xB8, 0x86, 0xD7, 0xDD, 0x85,
-    0x66, 0xC1, 0x97, 0xAF, 0x27, 0xF2, 0xE7, 0xF8, 0x27, 0x1B, 0x2E, 0x3E, 0x0C, 0xDE, 0xA3, 0x5F,
-    0x4F, 0xB3, 0xE3, 0x75, 0x33, 0x9F, 0xFB, 0x65, 0x2F, 0x8D, 0xC4, 0xC9, 0x9C, 0x1A, 0x1E, 0xD3,
-    0x43, 0x8C, 0x92, 0x3A, 0x3D, 0x6C, 0xEC, 0x18, 0x5E, 0xC8, 0xF2, 0x58, 0xDB, 0x53, 0x77, 0x4D,
-    0x03, 0x8C, 0x48, 0xC7, 0x7F, 0x67, 0x57, 0x03, 0x12, 0x1A, 0x34, 0x37, 0x73, 0x8B, 0xA7, 0xAC,
-    0x31, 0x4E, 0x08, 0xBB, 0x7D, 0x6B, 0x3E, 0x3A, 0xE5, 0xCC, 0xC0, 0x55, 0x11, 0xD9, 0xD5, 0x49,
-    0x7C, 0x45, 0xD4, 0x55, 0xD1, 0x2B, 0xF6, 0x4E, 0x88, 0x75, 0x4A, 0x8E, 0xC7, 0xC8, 0xD4, 0x40,
-    0xDF, 0x94, 0xF4, 0x59, 0x8C, 0x1E, 0x9F, 0x6B, 0x0B, 0x07, 0x1A, 0x67, 0x1D, 0xE8, 0x34, 0x39,
-    0x50, 0xC6, 0xE0, 0x17, 0xE4, 0x19, 0x71, 0xD0, 0xDD, 0x83, 0xB4, 0x5C, 0x6B, 0x5A, 0x74, 0x10,
-    0xF4, 0x6F, 0xC5, 0x67, 0xEF, 0x43, 0xAE, 0xF4, 0x38, 0x62, 0x18, 0x43, 0xBB, 0x5C, 0x39, 0xB3,
-    0x35, 0x05, 0x46, 0xA3, 0x0E, 0x7E, 0x57, 0xB7, 0xF3, 0xF3, 0xD2, 0xAB, 0xFD, 0x2A, 0xF1, 0x2B,
-    0xF8, 0x57, 0x41, 0x89, 0x78, 0x0B, 0xD0, 0xF6, 0xEF, 0x2A, 0x80, 0x57, 0xE3, 0x07, 0xB7, 0x65,
-    0xD4, 0x96, 0x73, 0x72, 0xFC, 0xE5, 0x8F, 0x71, 0x1D, 0xF5, 0x53, 0x38, 0x1C, 0x8F, 0x97, 0xC5,
-    0xD5, 0x1B, 0xFE, 0xDA, 0xF1, 0x1D, 0x6C, 0x0E, 0x94, 0x58, 0xB2, 0x89, 0xAE, 0x65, 0x57, 0xD1,
-    0x07, 0x7D, 0x97, 0x50, 0x7A, 0xB4, 0x48, 0x0F, 0x25, 0x78, 0xB2, 0x5F, 0x33, 0x78, 0x43, 0x53,
-    0x1A, 0x09, 0xF7, 0xA1, 0x30, 0x74, 0x5F, 0x2F, 0xCE, 0xA7, 0xA2, 0xE1, 0x95, 0x65, 0x5A, 0xA3,
-    0x86, 0x9A, 0x3C, 0x1C, 0xEC, 0x33, 0xC8, 0xA2, 0x35, 0x5F, 0x9B, 0xEB, 0xFA, 0x4A, 0x90, 0xAC,
-    0x9A, 0xB5, 0x8F, 0x89, 0xAD, 0x9E, 0xE9, 0x7D, 0xD9, 0xA3, 0x1A, 0x76, 0xA5, 0xA9, 0xD6, 0x41,
-    0x78, 0x13, 0xDF, 0xDD, 0x82, 0x5B, 0x1D, 0xE9, 0xF9, 0x8A, 0xF0, 0xBD, 0xC2, 0x2C, 0xF6, 0xF9,
-    0x30, 0x95, 0x7F, 0x50, 0x4E, 0x63, 0x53, 0x51, 0x87, 0x5D, 0x5E, 0xD5, 0x5F, 0xBF, 0xA1, 0xF8,
-    0x0A, 0x61, 0x63, 0x9A, 0x93, 0x69, 0x27, 0xB9, 0x18, 0xB7, 0x5E, 0x35, 0xBE, 0xAD, 0xD2, 0xEE,
-    0xB5, 0x76, 0xAF, 0xB6, 0x65, 0x77, 0x53, 0xA6, 0x8A, 0x9B, 0x06, 0xAA, 0x78, 0x7A, 0x96, 0xD7,
-    0x3E, 0x2E, 0xB3, 0x63, 0xEE, 0xAE, 0xE1, 0x92, 0x8C, 0x05, 0xA3, 0x52, 0xE9, 0x83, 0x40, 0x4E,
-    0xF0, 0x32, 0xDE, 0xDE, 0xDE, 0x29, 0xB4, 0xC7, 0x66, 0xF6, 0xE9, 0xC4, 0xAD, 0xD8, 0x17, 0xED,
-    0x44, 0x21, 0xD7, 0xCD, 0x9E, 0x93, 0x1F, 0xB2, 0x83, 0x81, 0xA1, 0x46, 0x79, 0xC7, 0xE6, 0xBE,
-    0x12, 0x8D, 0x17, 0x94, 0xAE, 0x4F, 0x6B, 0x15, 0x19, 0x65, 0xF2, 0x4D, 0xF9, 0x16, 0xCC, 0xB8,
-    0xCA, 0x36, 0xD5, 0x8C, 0x94, 0xAF, 0xE8, 0x2A, 0x3A, 0x5F, 0x88, 0x3C, 0xD6, 0x39, 0x64, 0xF3,
-    0xCE, 0xE7, 0x59, 0x5A, 0x30, 0x5E, 0xC1, 0x44, 0xC0, 0x1C, 0xC5, 0x94, 0x02, 0x06, 0xD5, 0x04,
-    0xDB, 0x93, 0x21, 0x46, 0x82, 0xC9, 0xBD, 0x6E, 0x92, 0xE0, 0x10, 0x56, 0xB5, 0x0A, 0xCC, 0xF3,
-    0xF0, 0xFC, 0x06, 0x69, 0xFB, 0x77, 0x75, 0x31, 0x70, 0xE4, 0x77, 0xEC, 0xA7, 0xB3, 0xE6, 0xF9,
-    0x8B, 0x38, 0x64, 0x08, 0x88, 0xEF, 0x19, 0x3D, 0x5A, 0x7F, 0x65, 0xCA, 0xE1, 0xDA, 0x16, 0x31,
-    0x1F, 0x33, 0xFD, 0xFC, 0x84, 0x1E, 0x84, 0x49, 0xD0, 0x2A, 0x62, 0xCA, 0x9E, 0xC3, 0xD3, 0x32,
-    0xF9, 0x34, 0x87, 0x4C, 0xD2, 0x44, 0x6D, 0x20, 0xBB, 0xE6, 0xCF, 0xE4, 0x43, 0x4C, 0xF0, 0xAD,
-    0xB5, 0x99, 0xE6, 0x8B, 0xE0, 0x60, 0xAD, 0x9B, 0xFF, 0xA1, 0x52, 0xA0, 0x4A, 0x58, 0xCE, 0x13,
-    0x6D, 0xBD, 0x09, 0xAD, 0xC1, 0xB6, 0x9F, 0x75, 0xED, 0x10, 0xC7, 0xAD, 0x99, 0x3E, 0x64, 0x8D,
-    0x4F, 0xF8, 0x4C, 0x13, 0x9C, 0xFB, 0x08, 0x6D, 0x8C, 0xE4, 0xBB, 0xC3, 0x3D, 0x48, 0x61, 0x7B,
-    0x12, 0x86, 0xE2, 0x3D, 0xA6, 0x0B, 0x1D, 0xC1, 0x53, 0x3D, 0x70, 0x22, 0x44, 0x8B, 0x46, 0x86,
-    0xC3, 0x3D, 0x78, 0x77, 0xD3, 0x66, 0xE1, 0x3D, 0xAE, 0x8F, 0x54, 0x0F, 0x3F, 0xC7, 0x03, 0x62,
-    0x5C, 0x37, 0x7B, 0xB1, 0xA9, 0x6F, 0xC8, 0xDD, 0x5B, 0x4E, 0x15, 0xDF, 0x2B, 0x06, 0x26, 0x73,
-    0x0F, 0x65, 0xB9, 0x3D, 0xEC, 0x1B, 0xDF, 0x47, 0xE3, 0xC9, 0xB4, 0xF1, 0xD3, 0xF5, 0x73, 0x59,
-    0x5D, 0x92, 0x07, 0x0C, 0x15, 0xE0, 0x2E, 0x86, 0x99, 0x3E, 0xF0, 0x1E, 0x31, 0xB9, 0xC9, 0x18,
-    0x3A, 0xEA, 0x91, 0xEC, 0xD8, 0xFD, 0x99, 0x1E, 0x3D, 0x5D, 0x6F, 0x61, 0x54, 0x1C, 0xA6, 0xEB,
-    0xF5, 0x42, 0x05, 0x67, 0xBD, 0x67, 0x4A, 0x9A, 0xAD, 0x0B, 0x5C, 0x76, 0x76, 0x14, 0xF2, 0xE3,
-    0x05, 0x6D, 0xBD, 0x94, 0xD1, 0x9D, 0x96, 0xDB, 0x5F, 0x6B, 0xF4, 0xF3, 0x37, 0xB9, 0xC9, 0x18,
-    0xFE, 0x34, 0x9A, 0x42, 0xAA, 0xCF, 0x08, 0x3D, 0x45, 0xF4, 0x1F, 0x48, 0x6D, 0x5A, 0xCF, 0x4C,
-    0xF8, 0x3C, 0x06, 0xBA, 0x2E, 0xAD, 0x53, 0xA1, 0x6E, 0xC3, 0xF9, 0x6E, 0xBA, 0xC7, 0x73, 0x81,
-    0x79, 0x68, 0x2A, 0x77, 0xB4, 0x18, 0x56, 0x56, 0xCD, 0xDF, 0x17, 0xFF, 0x68, 0x1E, 0x3A, 0x1E,
-    0x39, 0xA6, 0x5C, 0x1F, 0x39, 0x79, 0x69, 0x0F, 0xE9, 0x21, 0x38, 0x05, 0x80, 0xBB, 0xA0, 0x04,
-    0x7B, 0x41, 0x09, 0xFE, 0xD4, 0xD3, 0x50, 0x08, 0x67, 0xA0, 0x19, 0xD9, 0xAC, 0x57, 0x06, 0x6B,
-    0xE3, 0x7E, 0x04, 0x17, 0x13, 0x26, 0x6C, 0xF3, 0xDA, 0x79, 0xDC, 0x7A, 0xE5, 0xD5, 0xF3, 0x72,
-    0xBE, 0xF7, 0x34, 0x8C, 0x59, 0x33, 0x4F, 0xF8, 0x53, 0xF4, 0xD5, 0x1F, 0x19, 0x1F, 0x08, 0x04,
-    0x53, 0xA6, 0x42, 0xA2, 0x46, 0x52, 0xF4, 0xE2, 0x03, 0x44, 0x91, 0x70, 0xAF, 0x92, 0xF0, 0xE3,
-    0xE2, 0xB2, 0x5B, 0xDF, 0x94, 0x9B, 0xBD, 0x86, 0xEB, 0x24, 0xE8, 0xD4, 0xA5, 0xDA, 0x3D, 0xF9,
-    0x03, 0x67, 0x7D, 0xA4, 0x8B, 0xA6, 0x95, 0xA8, 0x92, 0xDD, 0x84, 0xD2, 0x0B, 0x39, 0x8F, 0xEE,
-    0x06, 0x3A, 0x8F, 0xFA, 0xB9, 0x69, 0xE5, 0xAC, 0xD6, 0x69, 0xA0, 0x36, 0x66, 0x43, 0xB1, 0x21,
-    0x32, 0x6A, 0x77, 0x47, 0x58, 0x87, 0xC0, 0x48, 0x83, 0xE5, 0xBC, 0x60, 0x68, 0xCD, 0x4C, 0x81,
-    0x6B, 0x3E, 0xE6, 0x31, 0x86, 0xE6, 0xCC, 0x1D, 0x31, 0x95, 0x88, 0xB3, 0xB0, 0x50, 0x81, 0xB1,
-    0x9A, 0xD8, 0x81, 0xB6, 0x1C, 0x68, 0xAA, 0xD3, 0x1B, 0x73, 0x1E, 0xC1, 0x44, 0x61, 0x1E, 0x49,
-    0xFA, 0x88, 0x0B, 0x3D, 0x68, 0x17, 0xA5, 0x6F, 0x3D, 0x41, 0x15, 0x89, 0x44, 0xFA, 0x8D, 0xEE,
-    0x80, 0x59, 0x27, 0x50, 0x33, 0x47, 0x6A, 0x23, 0xD5, 0x44, 0xAA, 0x85, 0x54, 0x03, 0xE9, 0x1C,
-    0x0B, 0x9E, 0x69, 0x9C, 0xD6, 0x35, 0x15, 0x3E, 0xA6, 0xFC, 0xAE, 0x05, 0xB8, 0x34, 0x70, 0x58,
-    0xEF, 0x4E, 0x3B, 0xE0, 0x21, 0xBB, 0xEA, 0x81, 0xD0, 0xA7, 0xE1, 0xDE, 0xB1, 0x51, 0xA3, 0x09,
-    0xBB, 0x87, 0x73, 0xD1, 0xCF, 0x16, 0xF3, 0x07, 0xA7, 0x69, 0x2E, 0x35, 0x2E, 0x60, 0x0B, 0xC3,
-    0x16, 0xA6, 0xD0, 0xED, 0x16, 0x66, 0x2B, 0x61, 0x73, 0xEA, 0xA1, 0x3E, 0x98, 0xA4, 0x56, 0x18,
-    0x2A, 0xA4, 0xEC, 0x41, 0xC4, 0x1E, 0xB8, 0xCB, 0xEE, 0x81, 0x86, 0xD7, 0x41, 0x3D, 0x21, 0x2C,
-    0x9E, 0x76, 0xA0, 0x3A, 0xEA, 0x5F, 0x32, 0xEB, 0x8C, 0x83, 0xBD, 0x67, 0x65, 0x3E, 0x4E, 0x0E,
-    0xB3, 0x5C, 0x89, 0x42, 0x7D, 0x34, 0xC9, 0xB4, 0x76, 0x97, 0x0B, 0x0C, 0x33, 0x7C, 0x93, 0x1B,
-    0xA9, 0x08, 0xF9, 0x21, 0xB5, 0xBC, 0xD5, 0x8C, 0x37, 0x39, 0x38, 0xD5, 0x43, 0x27, 0xEA, 0xBA,
-    0xD9, 0xCA, 0xD5, 0xCE, 0xBC, 0x9C, 0x71, 0xCD, 0xFD, 0xE9, 0xA6, 0xC8, 0x68, 0xBA, 0x29, 0xCB,
-    0xDF, 0x34, 0x98, 0xA0, 0xE4, 0x97, 0x3B, 0xDA, 0x7E, 0x33, 0xAA, 0x15, 0x8D, 0x61, 0x18, 0xAD,
-    0x40, 0x69, 0x3A, 0x2A, 0xDD, 0x30, 0x03, 0x0B, 0x21, 0xD7, 0xF1, 0x80, 0xC7, 0xBF, 0x6B, 0x57,
-    0x2E, 0xE0, 0xF7, 0x5E, 0x20, 0x0B, 0xAF, 0x6F, 0x9D, 0xC3, 0xF0, 0x22, 0x8C, 0x6F, 0x13, 0x03,
-    0xDC, 0x40, 0xCF, 0xAE, 0xE0, 0x79, 0x43, 0x97, 0xDD, 0x57, 0x7A, 0x8E, 0xEC, 0xE5, 0x31, 0x6A,
-    0x9D, 0xB9, 0x27, 0x90, 0xB2, 0xA3, 0xAA, 0x86, 0x29, 0xC0, 0x68, 0x0A, 0x41, 0x72, 0xEA, 0xF1,
-    0x71, 0xEF, 0xC6, 0xEA, 0x17, 0xF7, 0xB9, 0xFA, 0xEE, 0x70, 0x35, 0x17, 0x4E, 0x1B, 0x15, 0xF6,
-    0x35, 0x48, 0x96, 0x3B, 0x3E, 0x9F, 0x00, 0x4B, 0xE1, 0x76, 0xEC, 0x92, 0xC9, 0xFA, 0x1F, 0xC2,
-    0xD1, 0xA4, 0xDE, 0xE4, 0x6F, 0x4F, 0x34, 0xBE, 0x6B, 0x74, 0x98, 0xDC, 0x67, 0x7B, 0x1E, 0xE3,
-    0xFB, 0x02, 0xFD, 0x6E, 0x12, 0xEE, 0x1D, 0x8D, 0xE4, 0xED, 0xA3, 0xBF, 0xF2, 0xA1, 0x7E, 0x49,
-    0xD3, 0x6F, 0xEE, 0xDB, 0xAC, 0xE6, 0x64, 0xAF, 0x50, 0x97, 0x84, 0xA7, 0x6E, 0xC0, 0xFC, 0x36,
-    0xBF, 0xEA, 0x24, 0x38, 0x2E, 0x66, 0xBC, 0x83, 0x0E, 0xE4, 0x87, 0x1E, 0xB7, 0xCC, 0x32, 0x17,
-    0x71, 0x0B, 0x84, 0x05, 0xFD, 0x07, 0xFC, 0x55, 0x4D, 0xFC, 0x59, 0x43, 0xFC, 0x44, 0x85, 0x58,
-    0x76, 0x8A, 0x69, 0x42, 0x8C, 0x0B, 0x62, 0x58, 0x11, 0x83, 0x86, 0xE8, 0x8D, 0x88, 0xD2, 0x29,
-    0xE6, 0xEF, 0x11, 0xE3, 0x7F, 0x23, 0x0E, 0x3E, 0x23, 0x06, 0x86, 0xE8, 0x29, 0xC2, 0xF2, 0x30,
-    0xE5, 0x9D, 0x27, 0xD7, 0x0F, 0x19, 0xD8, 0xC3, 0x91, 0x62, 0x84, 0x2F, 0xF2, 0x77, 0xB3, 0xF2,
-    0x0E, 0xAF, 0x99, 0xAB, 0x4C, 0xD1, 0xFE, 0xBE, 0x7D, 0xD4, 0x3F, 0x69, 0xB8, 0x1B, 0xBB, 0xDE,
-    0xB2, 0x32, 0xCA, 0xE9, 0x8A, 0x48, 0x53, 0x21, 0x74, 0x70, 0x3A, 0xF5, 0x81, 0x46, 0x3D, 0x7A,
-    0x27, 0x47, 0x28, 0x7B, 0x8F, 0x31, 0xD7, 0x1E, 0xEC, 0x24, 0x1C, 0x16, 0xCF, 0x64, 0x2B, 0xC8,
-    0xD5, 0xDC, 0x5F, 0x9F, 0xCD, 0x53, 0xA5, 0xA7, 0x5B, 0xAE, 0x7D, 0x51, 0x41, 0x38, 0x97, 0xC1,
-    0x39, 0x6B, 0xC6, 0x16, 0x7B, 0xD8, 0xE7, 0xB5, 0x92, 0xA9, 0xA5, 0x96, 0xAB, 0x8A, 0x57, 0xA6,
-    0xDE, 0x84, 0x08, 0xF7, 0xD9, 0x61, 0xA4, 0x7C, 0x1E, 0x7A, 0x55, 0x5D, 0x8E, 0x81, 0xEE, 0x4D,
-    0x85, 0xA3, 0xD9, 0x18, 0x57, 0x78, 0xF6, 0x6A, 0x2D, 0x83, 0x2D, 0x66, 0xE8, 0xAB, 0x19, 0x6C,
-    0x39, 0x83, 0xAD, 0x67, 0x38, 0x52, 0xD0, 0x70, 0xB6, 0xB2, 0xB8, 0xD4, 0x5F, 0xD2, 0xA6, 0xBD,
-    0x62, 0x9B, 0xE9, 0x8D, 0xCA, 0xB9, 0xDA, 0x2F, 0x9B, 0x79, 0xC3, 0xA7, 0xBF, 0x1E, 0x0D, 0x58,
-    0x6A, 0x11, 0x8C, 0x52, 0xF0, 0xD8, 0x4A, 0x57, 0x0D, 0x2A, 0xD8, 0xD1, 0x3C, 0xD3, 0xA8, 0x22,
-    0xB7, 0xAB, 0xF2, 0x60, 0xF2, 0xE2, 0x7E, 0x95, 0x17, 0xA3, 0x2A, 0xDD, 0x37, 0x7B, 0x6E, 0x97,
-    0x48, 0x64, 0x1A, 0x08, 0x0E, 0xBA, 0xFE, 0x29, 0x99, 0x66, 0x4F, 0xC9, 0xB4, 0x25, 0xFE, 0xD4,
-    0xCA, 0xD4, 0x58, 0x99, 0x66, 0xC4, 0xC8, 0xCA, 0xB4, 0x26, 0xFA, 0x2D, 0xD1, 0xB5, 0x32, 0x35,
-    0x8A, 0xE9, 0x0F, 0x89, 0x91, 0xCA, 0x34, 0xFC, 0x9C, 0xE8, 0xAB, 0x34, 0x5D, 0x45, 0xB1, 0x32,
-    0x4D, 0x55, 0xA6, 0x91, 0xCA, 0xD4, 0x66, 0x41, 0x83, 0x39, 0xB4, 0xEB, 0xC9, 0xE2, 0x40, 0xA6,
-    0x0E, 0xE7, 0xDA, 0x68, 0x16, 0x71, 0xF5, 0x82, 0x55, 0xB9, 0x5A, 0xB1, 0xAA, 0x54, 0x55, 0xA8,
-    0x23, 0x0B, 0xDE, 0x73, 0x83, 0x4A, 0x92, 0x82, 0xAC, 0x29, 0xC7, 0x69, 0x2D, 0x9B, 0x3F, 0x05,
-    0xBD, 0xA6, 0x06, 0x50, 0x5C, 0x60, 0x5A, 0x3F, 0x40, 0xD1, 0xAC, 0x0D, 0x87, 0x36, 0x4A, 0xD2,
-    0xF2, 0x82, 0xA3, 0x25, 0xA3, 0xA0, 0x98, 0xE2, 0x67, 0x35, 0x0D, 0x3A, 0xE7, 0xC3, 0x95, 0x69,
-    0x69, 0x44, 0xD8, 0x60, 0xAA, 0x33, 0x30, 0xCE, 0xD8, 0x5A, 0xA4, 0x73, 0x72, 0xA0, 0x29, 0xE6,
-    0xB0, 0x64, 0x0C, 0x19, 0x56, 0x8A, 0xF5, 0x17, 0x60, 0xA5, 0x47, 0x56, 0xF6, 0x2C, 0xB6, 0x30,
-    0x28, 0x6C, 0x6B, 0x74, 0x8F, 0xE3, 0xFE, 0x2A, 0x60, 0x82, 0x6F, 0xE2, 0x5F, 0xF0, 0xEA, 0xB6,
-    0xC6, 0xC6, 0x56, 0x1D, 0x0D, 0x87, 0x19, 0x5D, 0x6F, 0x7C, 0xBB, 0x58, 0x38, 0x0A, 0xBB, 0x9C,
-    0xC0, 0xDC, 0xEE, 0x57, 0xE8, 0x20, 0x26, 0x0C, 0xBC, 0xEC, 0x31, 0xD7, 0xD2, 0x2E, 0xAD, 0x5C,
-    0x2C, 0x9A, 0x03, 0x26, 0x24, 0xC7, 0x80, 0x3D, 0x04, 0x07, 0xA7, 0xF6, 0xB4, 0x80, 0xB1, 0xAE,
-    0xDB, 0x5D, 0xE7, 0x40, 0xB5, 0x9A, 0x96, 0x01, 0x8C, 0xA7, 0xB5, 0x68, 0xB6, 0x70, 0xD4, 0x7B,
-    0xF2, 0xD1, 0xAC, 0xB0, 0xF0, 0x0F, 0xF6, 0xBE, 0x16, 0xBC, 0x7D, 0xD9, 0xAE, 0xD3, 0x8B, 0x67,
-    0x50, 0xDE, 0xF9, 0x23, 0xE6, 0x66, 0x52, 0x9D, 0x91, 0x63, 0xCE, 0x46, 0xB7, 0xA1, 0xA6, 0x47,
-    0xC4, 0xAE, 0x2B, 0xE7, 0xFE, 0xD7, 0x82, 0xC7, 0xB5, 0xBD, 0xF7, 0x79, 0x1D, 0x1C, 0x11, 0x7D,
-    0x1F, 0x07, 0xEC, 0xD2, 0x9A, 0xB6, 0x21, 0x4B, 0x73, 0x2F, 0x9D, 0x29, 0x99, 0x53, 0x92, 0x34,
-    0xFD, 0x4D, 0x9A, 0xB4, 0x56, 0xC9, 0x90, 0x9F, 0x28, 0x41, 0xDF, 0xF1, 0x1A, 0x26, 0x00, 0x3E,
-    0x92, 0xB0, 0xB2, 0xAF, 0x18, 0xAE, 0xD2, 0x1F, 0xF5, 0xAF, 0xF1, 0xE4, 0x35, 0x9B, 0xBD, 0x3E,
-    0xDE, 0xDE, 0xD2, 0x57, 0x86, 0x4F, 0xF3, 0x9F, 0x17, 0x8E, 0x3B, 0xD2, 0xCE, 0xA4, 0x5D, 0x7B,
-    0x1D, 0x29, 0x03, 0xBD, 0xAE, 0x53, 0xD9, 0x7E, 0xD0, 0x5E, 0xEA, 0xF5, 0x61, 0x2B, 0x7F, 0xB1,
-    0xFF, 0x64, 0x98, 0x53, 0xA7, 0xF2, 0xAF, 0xEC, 0x49, 0x9D, 0xB1, 0xD6, 0x49, 0xC4, 0xAD, 0xF9,
-    0xFD, 0xD2, 0xE4, 0x25, 0x98, 0xFB, 0x4D, 0xE3, 0xD7, 0x20, 0xC1, 0x94, 0x6E, 0x4B, 0x42, 0x0A,
-    0x19, 0x91, 0x9C, 0x4C, 0xC6, 0xB1, 0x4C, 0x5F, 0x86, 0x43, 0x7D, 0x31, 0xA6, 0xE3, 0xCB, 0x8F,
-    0x74, 0xD7, 0x9E, 0xAE, 0xAD, 0x3D, 0x44, 0xD9, 0x2C, 0xD4, 0xAE, 0xA6, 0x85, 0x46, 0xDF, 0xF0,
-    0x92, 0xDF, 0x0A, 0x2A, 0xF7, 0xF3, 0x56, 0x1E, 0x80, 0xD5, 0x8A, 0xC3, 0x4C, 0x4D, 0x12, 0xD1,
-    0xBE, 0x82, 0x59, 0xDD, 0xD0, 0xBF, 0x3B, 0x4B, 0x8A, 0x59, 0x7B, 0xBC, 0x39, 0x57, 0x61, 0x5C,
-    0x3E, 0xB5, 0x27, 0xC4, 0x0D, 0xA5, 0x1D, 0xC3, 0xE9, 0x0A, 0xE7, 0x3B, 0x4F, 0x6C, 0x68, 0x23,
-    0x9A, 0x35, 0x9B, 0xC3, 0xFA, 0xA9, 0x6F, 0xF4, 0x98, 0x98, 0xC7, 0x43, 0x83, 0x53, 0x94, 0x5C,
-    0x13, 0x18, 0xBB, 0x66, 0x6F, 0x6A, 0xCD, 0xE4, 0x30, 0x7C, 0x18, 0xB9, 0x63, 0x9B, 0xA5, 0x51,
-    0x4C, 0x6D, 0xAE, 0xA6, 0xE8, 0xDB, 0xF4, 0x34, 0x57, 0x73, 0x1D, 0xCA, 0xDF, 0x24, 0x1A, 0xA3,
-    0x14, 0xEA, 0x1E, 0x33, 0x58, 0xA0, 0x11, 0xA0, 0x9B, 0x37, 0x58, 0x74, 0x8A, 0x4D, 0x69, 0xCA,
-    0x9D, 0x4F, 0x4C, 0xED, 0x7F, 0xE6, 0xD7, 0xDE, 0xD8, 0x43, 0xB0, 0xE1, 0x72, 0xBE, 0xA8, 0x45,
-    0xE0, 0x29, 0xCF, 0x7A, 0x72, 0xBF, 0x70, 0xA7, 0xDB, 0x12, 0xD6, 0x3F, 0xAC, 0xDE, 0xB8, 0x17,
-    0x2A, 0x7F, 0x14, 0x55, 0x4F, 0xDB, 0xA0, 0xDF, 0x4A, 0xAF, 0xCF, 0xB7, 0x24, 0x4B, 0xE6, 0x62,
-    0xDE, 0xC3, 0xA6, 0x46, 0x20, 0xED, 0xCC, 0xBF, 0x85, 0x13, 0xBF, 0x7A, 0x8B, 0x05, 0x33, 0x72,
-    0x5B, 0x37, 0x9F, 0x23, 0x4D, 0x01, 0x85, 0x5A, 0xC5, 0xE7, 0x8D, 0x67, 0x9B, 0x43, 0x2B, 0x3C,
-    0xA7, 0xDE, 0x92, 0x57, 0xA0, 0x4D, 0x6E, 0x8B, 0xFF, 0x53, 0x5C, 0x91, 0x4D, 0x52, 0x11, 0xA5,
-    0xCB, 0x9F, 0x53, 0x9A, 0xCA, 0xE5, 0x26, 0x0F, 0x55, 0xB0, 0xD3, 0xD8, 0x90, 0x74, 0x6D, 0x51,
-    0x41, 0x78, 0x18, 0x4D, 0x08, 0xE5, 0x10, 0x25, 0x6E, 0x13, 0xE3, 0x20, 0xAC, 0xF3, 0xBD, 0xB8,
-    0x4F, 0x5F, 0xD3, 0x59, 0xD5, 0xBA, 0x5B, 0xAE, 0x66, 0xDA, 0x67, 0x5D, 0xD6, 0x6C, 0x78, 0xD0,
-    0xF6, 0x51, 0xFB, 0xF8, 0x15, 0x3C, 0x37, 0x30, 0x35, 0xEE, 0x60, 0x62, 0xA4, 0x2C, 0xF8, 0xC9,
-    0xBC, 0x7A, 0xF0, 0xDF, 0x3B, 0xA5, 0x4B, 0x2D, 0xAF, 0xEA, 0xE8, 0x83, 0xD9, 0xFA, 0x09, 0xFB,
-    0xF5, 0x73, 0x65, 0x5E, 0xE5, 0x36, 0x12, 0xFE, 0xC7, 0x58, 0x35, 0xF8, 0xA6, 0x5C, 0x86, 0x4E,
-    0x7F, 0xCB, 0x6E, 0x4F, 0x95, 0x36, 0x12, 0xF1, 0x79, 0x39, 0x56, 0xFB, 0xFB, 0xBA, 0xC9, 0x95,
-    0x7C, 0x43, 0x06, 0xD9, 0x15, 0xCC, 0x86, 0xDB, 0xF0, 0xFE, 0xEF, 0xF0, 0xAC, 0x1F, 0x41, 0xA7,
-    0xF3, 0x98, 0xD7, 0xFA, 0xB2, 0x1B, 0xEE, 0x41, 0x47, 0x7D, 0x59, 0x79, 0x13, 0x66, 0x4E, 0x39,
-    0xB7, 0xEF, 0x7C, 0x16, 0xE3, 0x25, 0xE5, 0x5A, 0x20, 0x80, 0x19, 0xF4, 0xB8, 0x41, 0x68, 0x72,
-    0x5B, 0xA6, 0x29, 0xF4, 0x65, 0x8F, 0xF7, 0x2C, 0xC6, 0x44, 0x27, 0x9C, 0x1E, 0xAF, 0xFA, 0xDB,
-    0xBC, 0x15, 0xE3, 0x8E, 0xD5, 0x01, 0x4C, 0x11, 0xD9, 0x20, 0x6B, 0x79, 0x63, 0x62, 0x9A, 0x7B,
-    0x33, 0xB1, 0x55, 0xE2, 0x0C, 0x0C, 0x7A, 0x05, 0xC0, 0x6A, 0x6C, 0xD6, 0xC3, 0x4D, 0x0B, 0xD1,
-    0x6E, 0x47, 0x7D, 0x21, 0x5A, 0xBB, 0x58, 0x88, 0x76, 0x06, 0xF2, 0x7D, 0x45, 0x7E, 0x0B, 0x6B,
-    0x77, 0x43, 0xBC, 0xFF, 0x6A, 0xEC, 0xA9, 0x54, 0x95, 0x71, 0xF2, 0x42, 0xE4, 0x0B, 0x2B, 0x6C,
-    0xC6, 0x84, 0x6E, 0x13, 0x51, 0xE0, 0xE6, 0x6D, 0xC0, 0xA5, 0x5B, 0x80, 0x57, 0x6F, 0xB2, 0xF0,
-    0xC4, 0x6E, 0x13, 0x2F, 0x11, 0xDE, 0x60, 0x91, 0x4A, 0xAC, 0x7E, 0xA2, 0xEE, 0x37, 0x50, 0x12,
-    0xB6, 0x60, 0x7F, 0xEE, 0x8E, 0x9E, 0xAA, 0x2F, 0x8E, 0xD7, 0xFA, 0xC4, 0x9B, 0xBA, 0x0D, 0xD9,
-    0x30, 0xB4, 0x1C, 0x98, 0x36, 0x35, 0x2D, 0x34, 0xD4, 0x97, 0x3E, 0x5C, 0xDD, 0xBA, 0x13, 0xF3,
-    0x27, 0xA4, 0x01, 0xE1, 0x5E, 0xB8, 0xA7, 0x4A, 0xAB, 0x15, 0xDD, 0x1F, 0x60, 0xF8, 0x0E, 0xA9,
-    0x68, 0x49, 0xBE, 0x56, 0xE4, 0xFB, 0x3F, 0xA9, 0x27, 0xF5, 0xF8, 0x9A, 0xDF, 0xD8, 0x5D, 0x88,
-    0xE7, 0x5F, 0x1A, 0x43, 0x4C, 0x3B, 0x30, 0x23, 0x14, 0xD9, 0xAC, 0xCA, 0x4D, 0xA8, 0xB4, 0xFB,
-    0x37, 0xD4, 0x2C, 0x32, 0xCE, 0x06, 0x1B, 0x70, 0x83, 0x5A, 0xAB, 0xB1, 0x4F, 0xF0, 0x74, 0x9B,
-    0x3E, 0x8F, 0x09, 0x76, 0x74, 0x96, 0x38, 0xC9, 0x69, 0xC7, 0xE8, 0x0E, 0xCD, 0x10, 0x26, 0x47,
-    0xED, 0xC0, 0xE9, 0xC6, 0xF8, 0x4C, 0xE9, 0xBE, 0xF9, 0x78, 0x2B, 0x36, 0xCD, 0x9B, 0x87, 0x5B,
-    0xCF, 0x92, 0x2E, 0x8B, 0xDC, 0x5F, 0xB3, 0xB7, 0x92, 0x64, 0x20, 0xC7, 0xFB, 0xD5, 0x63, 0x2E,
-    0x68, 0x35, 0x79, 0xE7, 0xE4, 0xF2, 0x62, 0x3E, 0x2D, 0x65, 0xD2, 0x64, 0xBC, 0x63, 0x2A, 0x37,
-    0x6F, 0x69, 0x4E, 0xA1, 0xBA, 0xB9, 0xC2, 0x13, 0x45, 0x59, 0x2E, 0x8A, 0xC5, 0xB1, 0x5A, 0xA3,
-    0x5C, 0x1D, 0xD2, 0x98, 0x7B, 0xA6, 0x18, 0xE7, 0x7E, 0xAD, 0x76, 0x5E, 0x2B, 0x7D, 0xA6, 0x00,
-    0xFD, 0xC0, 0x78, 0x75, 0xD3, 0x5C, 0x07, 0xDE, 0x60, 0x0A, 0x49, 0xB6, 0xDC, 0x23, 0xF5, 0x91,
-    0x71, 0xEB, 0x60, 0x5C, 0x51, 0x2B, 0x79, 0xC5, 0x1C, 0x4B, 0x78, 0xF2, 0xC2, 0x9D, 0x1E, 0x27,
-    0x05, 0x2B, 0x0C, 0xA3, 0xE0, 0xA6, 0x54, 0x8C, 0xD7, 0xFE, 0x8A, 0xC1, 0x94, 0xF9, 0x94, 0xB4,
-    0x98, 0x1F, 0xB0, 0x73, 0x36, 0x6A, 0x61, 0xF8, 0xDE, 0xC7, 0xEF, 0x47, 0x03, 0xF8, 0x55, 0xE5,
-    0xF3, 0xE2, 0xF0, 0x83, 0xBE, 0x62, 0x86, 0x37, 0x3D, 0x5C, 0x7B, 0xF9, 0x1C, 0xDA, 0xDB, 0xCE,
-    0x34, 0x96, 0xB7, 0xF7, 0x82, 0x6A, 0xF5, 0xFF, 0x62, 0xFD, 0xFF, 0x0A, 0xF3, 0xF9, 0xDB, 0x1A,
-    0x8C, 0x84, 0xAA, 0xB1, 0xC3, 0x5F, 0xCE, 0x4A, 0xD8, 0xE5, 0x1F, 0x92, 0x97, 0xCF, 0x6D, 0xBF,
-    0xA9, 0xAD, 0xFE, 0xF8, 0xA6, 0x6A, 0x98, 0xFB, 0x01, 0xF1, 0x43, 0xDD, 0x15, 0xB1, 0xEF, 0xED,
-    0xF7, 0x61, 0xFB, 0xB5, 0x60, 0x7B, 0x72, 0x63, 0x1C, 0xDF, 0xFB, 0x9F, 0x69, 0x1E, 0x50, 0xB7,
-    0x3E, 0x43, 0xF9, 0x70, 0xFA, 0xDE, 0x7E, 0xDF, 0xDF, 0x3B, 0xF6, 0x72, 0xF9, 0xD7, 0xF4, 0x8A,
-    0xCD, 0xAF, 0x48, 0xFC, 0x03, 0x52, 0xAC, 0x19, 0x16, 0x4D, 0xB1, 0x20, 0xF4, 0xFE, 0xE6, 0xD7,
-    0x83, 0xF3, 0xF7, 0xB5, 0xBA, 0xD4, 0xE6, 0xB8, 0x98, 0xB8, 0x80, 0xCB, 0x47, 0x27, 0x20, 0xCC,
-    0xB4, 0xF8, 0xF2, 0x68, 0x06, 0xE1, 0xEC, 0x79, 0x8E, 0x99, 0x46, 0xEF, 0x22, 0xF3, 0xC8, 0xC9,
-    0x0F, 0x9D, 0x4E, 0x6C, 0x9E, 0x89, 0x9B, 0x41, 0xCB, 0xC7, 0xA4, 0xC7, 0x03, 0x65, 0x0F, 0x91,
-    0x5D, 0xA4, 0xBC, 0x3D, 0x64, 0x7F, 0xF6, 0x1B, 0xB5, 0x05, 0xD9, 0xB4, 0x2A, 0xDB, 0x6E, 0x47,
-    0x0D, 0x66, 0x85, 0x1A, 0x13, 0xB4, 0xDF, 0x6B, 0xC4, 0xCC, 0x72, 0x8E, 0x33, 0x66, 0xCC, 0x76,
-    0xE8, 0xE1, 0xDC, 0xFD, 0xE5, 0xF5, 0x6C, 0xAB, 0xC9, 0x16, 0x7C, 0x8A, 0xB1, 0xB7, 0x7F, 0x58,
-    0xD7, 0xFE, 0xFD, 0x69, 0x5C, 0x3C, 0xF5, 0xB1, 0xFB, 0x90, 0xCE, 0xFF, 0x59, 0xEF, 0xFC, 0x87,
-    0x89, 0xCD, 0x47, 0x40, 0x19, 0xBE, 0xFD, 0x05, 0x05, 0xF5, 0x25, 0x7E, 0xF1, 0x4D, 0xB3, 0x63,
-    0xF6, 0xC0, 0xDE, 0x9A, 0x79, 0xE4, 0x6B, 0x31, 0x78, 0x9F, 0xA2, 0x34, 0x2C, 0xB4, 0x71, 0xB5,
-    0x38, 0x07, 0xDE, 0x1C, 0xEF, 0x49, 0x04, 0x8F, 0x1B, 0x9A, 0xB7, 0xFC, 0xCF, 0x82, 0xA5, 0x25,
-    0xB9, 0x78, 0x1F, 0x17, 0x74, 0x87, 0x52, 0xF1, 0xDF, 0xAB, 0xB8, 0xCE, 0xE3, 0x24, 0xF0, 0x6B,
-    0x7D, 0x93, 0x85, 0x5E, 0x4D, 0xC6, 0xA3, 0xE2, 0x92, 0xD7, 0x30, 0xC4, 0x0E, 0xCB, 0x77, 0xDD,
-    0xD6, 0xD3, 0xBC, 0xE8, 0x86, 0x33, 0xE2, 0xD6, 0x5A, 0x50, 0x6F, 0xC8, 0x38, 0xD0, 0xDB, 0xAB,
-    0x6E, 0xC9, 0x81, 0x66, 0xBD, 0x9B, 0xFB, 0xF6, 0xEE, 0x4C, 0xB7, 0xAD, 0x25, 0xBE, 0xA4, 0x3B,
-    0xB0, 0x78, 0xF3, 0x17, 0x7A, 0x73, 0x18, 0xA4, 0xA1, 0xFC, 0x60, 0x9C, 0x76, 0x1F, 0x8E, 0x77,
-    0xD8, 0xB7, 0xBD, 0xEC, 0xB4, 0xEE, 0x85, 0x21, 0x47, 0x7F, 0x3B, 0xEC, 0xC5, 0x5E, 0xD1, 0xA4,
-    0x3D, 0x29, 0x7D, 0x02, 0xC5, 0xFD, 0x5F, 0x4B, 0x09, 0x03, 0x50, 0x5B, 0x58, 0x7E, 0xFE, 0x18,
-    0x5E, 0x8C, 0x91, 0x4B, 0x98, 0x0A, 0x59, 0xDE, 0x49, 0x94, 0x04, 0x5D, 0xA2, 0x77, 0xE2, 0xC3,
-    0xE7, 0x43, 0xDB, 0x68, 0x8F, 0x77, 0xFB, 0xCA, 0x3F, 0x95, 0x52, 0xD1, 0xB3, 0xFB, 0x79, 0xC5,
-    0x7D, 0x9B, 0xD6, 0xF9, 0x84, 0xB6, 0xD2, 0x19, 0xB9, 0x3F, 0x69, 0x3C, 0x4C, 0xA4, 0xB1, 0xF7,
-    0xBD, 0x96, 0xDA, 0xFC, 0xC0, 0x4F, 0x46, 0xA1, 0xBD, 0xE3, 0xF4, 0x23, 0xBE, 0xC6, 0xAF, 0xCA,
-    0x2E, 0xF5, 0x4B, 0xFC, 0xA7, 0x12, 0x7F, 0x8B, 0xD3, 0xED, 0xEF, 0x25, 0x52, 0x1B, 0xF5, 0x40,
-    0x06, 0x0F, 0x6C, 0xA9, 0xB8, 0xDE, 0x06, 0x8C, 0xD1, 0xE8, 0x80, 0xA0, 0x97, 0x6C, 0x24, 0x77,
-    0x3E, 0x9B, 0x89, 0x3E, 0xD5, 0x21, 0xB4, 0xBA, 0xB1, 0xCF, 0x5B, 0xD8, 0x79, 0x0F, 0xFB, 0xA2,
-    0x5A, 0x8D, 0x59, 0xCE, 0x55, 0x45, 0xE6, 0xEE, 0x79, 0x53, 0x31, 0xFB, 0x93, 0x52, 0x78, 0x56,
-    0x60, 0x0C, 0x1E, 0xC0, 0x52, 0xAD, 0x37, 0x88, 0x52, 0x2A, 0x15, 0x45, 0xE2, 0xD7, 0x14, 0x83,
-    0xC7, 0xEA, 0x23, 0x0C, 0x42, 0xE3, 0x9C, 0x03, 0xBD, 0xFB, 0x2E, 0xAE, 0x67, 0xFB, 0x73, 0x7D,
-    0x41, 0xFE, 0x73, 0xA0, 0x86, 0x47, 0xE7, 0xF2, 0xC3, 0x44, 0x77, 0x7E, 0xB2, 0x7E, 0xB6, 0xDA,
-    0x3D, 0x21, 0x7E, 0x0C, 0xFE, 0x95, 0x71, 0x9F, 0xA3, 0x37, 0x1B, 0xBC, 0xBD, 0x30, 0x1F, 0x05,
-    0x2E, 0x75, 0x27, 0x79, 0x03, 0x16, 0xC2, 0x42, 0xD3, 0xCB, 0xE0, 0x58, 0xD5, 0xE3, 0x25, 0xAE,
-    0x9E, 0xAB, 0xDC, 0xB2, 0xDB, 0xE0, 0xFC, 0xBC, 0xC5, 0x61, 0x30, 0xA6, 0x28, 0x98, 0x41, 0xF9,
-    0x67, 0xE6, 0xC3, 0x3E, 0x65, 0x00, 0xF6, 0x7F, 0xAC, 0x42, 0xFB, 0x3C, 0x99, 0xAC, 0x0B, 0x75,
-    0x5A, 0xEE, 0x2C, 0xDC, 0x2C, 0xE0, 0x4C, 0xC3, 0xB6, 0x60, 0x72, 0x8F, 0xF6, 0x7A, 0x37, 0x25,
-    0xD7, 0x29, 0x2F, 0xEA, 0xCF, 0xB1, 0xDE, 0x7A, 0xCE, 0x1F, 0xDD, 0x6A, 0x70, 0xDC, 0xDA, 0x59,
-    0x3D, 0x8E, 0xCF, 0xEF, 0x4D, 0x6F, 0x3E, 0x9F, 0xE8, 0x12, 0x1D, 0xAB, 0x9B, 0x1D, 0x0D, 0x0E,
-    0x33, 0x85, 0x4D, 0xF6, 0x75, 0x83, 0x15, 0xF6, 0x1B, 0x0C, 0xF3, 0xAF, 0xD8, 0x7B, 0x57, 0xC2,
-    0x7A, 0xD2, 0x0A, 0xAB, 0x0F, 0x95, 0x45, 0x0E, 0xCC, 0x26, 0x02, 0x74, 0x52, 0x52, 0x85, 0xD9,
-    0x0D, 0xDC, 0x74, 0xC2, 0xB3, 0x46, 0x67, 0x3E, 0x22, 0xD5, 0x92, 0xE9, 0xC2, 0x12, 0x7D, 0xF3,
-    0xB8, 0x59, 0xE2, 0x17, 0xF9, 0x2F, 0x87, 0x79, 0x61, 0x6B, 0xE3, 0xF5, 0x76, 0x81, 0xDC, 0xA6,
-    0x49, 0x34, 0x85, 0x51, 0x4C, 0xEE, 0xEB, 0xE8, 0xCB, 0xC5, 0x4D, 0x8D, 0x6E, 0xD5, 0x57, 0x31,
-    0xB2, 0x2B, 0x90, 0xCA, 0xB7, 0xF5, 0x58, 0xE6, 0x26, 0x5B, 0x7B, 0x5D, 0x5A, 0x3A, 0xCA, 0x63,
-    0xF6, 0xF5, 0x05, 0x7C, 0x7D, 0x03, 0x5F, 0x43, 0x4C, 0x4E, 0x9D, 0x1A, 0x96, 0x80, 0x71, 0x9B,
-    0xFB, 0xC2, 0xA4, 0x70, 0x43, 0x7B, 0x65, 0x4B, 0x38, 0xEE, 0x1F, 0x23, 0xBF, 0x97, 0xC4, 0x83,
-    0xD3, 0x97, 0x9C, 0xD2, 0x1E, 0xF0, 0xB9, 0xB6, 0xB8, 0x1B, 0xBF, 0x34, 0x1E, 0x34, 0x1D, 0xAC,
-    0xD9, 0x60, 0x4D, 0x06, 0x6B, 0x2E, 0x58, 0x53, 0xC1, 0x6E, 0xBB, 0x0A, 0x3C, 0xB8, 0x89, 0x93,
-    0xB8, 0x55, 0x98, 0xC8, 0xC3, 0x4D, 0x9B, 0xB6, 0xE2, 0xFF, 0xF6, 0x12, 0x54, 0xCB, 0xE7, 0xC1,
-    0x19, 0x26, 0xD0, 0xE5, 0x15, 0x9C, 0xBC, 0x5A, 0x46, 0xB0, 0xAA, 0x23, 0x47, 0x7D, 0xB7, 0xE5,
-    0x15, 0xA6, 0x5D, 0x83, 0xDE, 0x6A, 0xE5, 0xFF, 0x01, 0xED, 0x5B, 0x31, 0x90, 0xDC, 0xD8, 0x71,
-    0x6D, 0x00, 0xE4, 0x42, 0xE6, 0x94, 0x0F, 0x0C, 0xEE, 0x54, 0xA7, 0x5B, 0x9B, 0x70, 0x70, 0x81,
-    0xEA, 0x44, 0x12, 0x89, 0x02, 0x06, 0xCB, 0x05, 0x64, 0x85, 0x4A, 0xE8, 0x2A, 0x6D, 0xC9, 0x91,
-    0xA9, 0x40, 0x81, 0xEF, 0x92, 0x51, 0xB0, 0xC1, 0x5A, 0x5E, 0x12, 0x38, 0x39, 0x70, 0xBA, 0x81,
-    0x9D, 0x33, 0xB8, 0xE0, 0x6A, 0x58, 0xA5, 0x65, 0xB0, 0x81, 0xAE, 0x6A, 0xB9, 0x80, 0x2E, 0x55,
-    0x60, 0x94, 0x55, 0x65, 0x87, 0x86, 0x2C, 0xAA, 0x5C, 0xBE, 0x0B, 0x0C, 0xBB, 0x20, 0x17, 0x76,
-    0x85, 0xC1, 0x57, 0xBF, 0xEE, 0x0F, 0xCC, 0xEC, 0x90, 0xBC, 0xBB, 0xA5, 0xA9, 0xBD, 0xA5, 0xCA,
-    0x53, 0x3B, 0xFD, 0x7B, 0x67, 0x06, 0x1F, 0xFF, 0xF7, 0xEF, 0xDF, 0xDD, 0xAF, 0xFB, 0x83, 0x88,
-    0x5F, 0x5F, 0x23, 0x79, 0xC5, 0x09, 0xB9, 0x66, 0x4E, 0x71, 0x46, 0xD1, 0x49, 0x5E, 0x86, 0x09,
-    0x19, 0xF2, 0x9B, 0x80, 0xBC, 0x96, 0x68, 0x7E, 0x8D, 0xFC, 0x9A, 0x28, 0x6D, 0x28, 0xA8, 0xF8,
-    0x87, 0x05, 0x85, 0x05, 0x51, 0x54, 0xE0, 0x8F, 0xC2, 0x12, 0x1F, 0xE0, 0x0B, 0xBE, 0x72, 0x6C,
-    0xEA, 0xCF, 0x68, 0xAA, 0xE1, 0x02, 0x7B, 0x39, 0x3A, 0xE3, 0xB7, 0x74, 0x9D, 0xD1, 0x84, 0x6F,
-    0x14, 0x93, 0xDE, 0x96, 0x47, 0xD5, 0x0B, 0x47, 0xF1, 0x7F, 0xE6, 0x25, 0x37, 0xBE, 0xE9, 0x65,
-    0xAC, 0x97, 0x13, 0x1D, 0x33, 0xFD, 0x94, 0xDF, 0x8E, 0x7C, 0xD6, 0xD3, 0xD4, 0x24, 0xB7, 0xDD,
-    0x7E, 0xBF, 0xDA, 0xF0, 0x6B, 0xB7, 0x3D, 0x08, 0x0A, 0x32, 0x45, 0x94, 0x51, 0x8A, 0x89, 0xC5,
-    0xE8, 0x52, 0x49, 0xF2, 0x0C, 0xA2, 0x3F, 0x91, 0x1F, 0xF3, 0x65, 0x73, 0x9A, 0x54, 0x4E, 0x47,
-    0x6E, 0x7F, 0x17, 0x73, 0x36, 0x3C, 0x64, 0xE7, 0x8E, 0xBD, 0xDD, 0x9A, 0xDE, 0x37, 0x28, 0x53,
-    0x53, 0x7B, 0x26, 0xA8, 0xA6, 0xA6, 0x72, 0x73, 0xBF, 0x74, 0x79, 0xA4, 0x81, 0x57, 0xF0, 0x45,
-    0x14, 0xF8, 0x99, 0x34, 0x3F, 0x21, 0x69, 0x9E, 0x68, 0x43, 0x2F, 0xB7, 0x21, 0xDB, 0xF0, 0x6D,
-    0x43, 0x6E, 0x72, 0xA2, 0x4D, 0xC8, 0xA8, 0xC4, 0xE7, 0x14, 0x9A, 0x7D, 0x1E, 0x37, 0xAF, 0xA5,
-    0x91, 0xC1, 0x3A, 0x83, 0xA8, 0x9C, 0x06, 0xD4, 0xEB, 0x94, 0xC6, 0xAD, 0x63, 0xCA, 0x2E, 0x6A,
-    0x29, 0xAF, 0x0E, 0xDC, 0x96, 0x82, 0x5F, 0xD6, 0x4E, 0x4B, 0x13, 0x93, 0x81, 0x36, 0x04, 0x5A,
-    0x7D, 0x31, 0xDA, 0x59, 0x8A, 0xE5, 0xEB, 0x28, 0x64, 0x6A, 0xE8, 0x6F, 0xB1, 0x86, 0xE6, 0x57,
-    0x90, 0x8A, 0xF9, 0x3B, 0x0C, 0x63, 0x90, 0x1F, 0xBF, 0xBE, 0x4F, 0x7F, 0x36, 0xB0, 0x1B, 0x4E,
-    0x3D, 0xB0, 0xE1, 0x77, 0x8A, 0x81, 0x9D, 0x98, 0x61, 0xC4, 0xE4, 0xF5, 0xE3, 0x65, 0x4E, 0x47,
-    0xCF, 0x79, 0xE5, 0xC6, 0xEC, 0xB1, 0x36, 0x1A, 0x63, 0x8A, 0xA9, 0xC1, 0xA4, 0x63, 0xB0, 0x3C,
-    0xCF, 0x69, 0x85, 0x05, 0x4F, 0x13, 0xB7, 0x23, 0xBF, 0xA5, 0xDB, 0x18, 0x18, 0xB3, 0xCE, 0x9C,
-    0x36, 0x88, 0x17, 0x8C, 0x59, 0x16, 0xDC, 0x06, 0xD4, 0x0B, 0x6C, 0x9A, 0x88, 0x82, 0x82, 0x8D,
-    0x55, 0x2D, 0xC1, 0x42, 0x43, 0xF9, 0xDF, 0x81, 0x65, 0x41, 0x83, 0xE5, 0x2F, 0xA1, 0x73, 0x96,
-    0x85, 0x44, 0x2D, 0xEB, 0x37, 0x23, 0xCB, 0x7D, 0x0D, 0x97, 0xE1, 0x4A, 0xCB, 0xA6, 0x19, 0x0D,
-    0xB7, 0x30, 0x64, 0xD9, 0xC4, 0x99, 0x5B, 0x36, 0x97, 0xBE, 0x4A, 0x0C, 0xB2, 0xC7, 0x3E, 0x70,
-    0x2A, 0x66, 0x3D, 0x11, 0xAA, 0x5B, 0x72, 0x1B, 0xD5, 0xB8, 0xD0, 0x2B, 0xEF, 0xF6, 0x0F, 0x59,
-    0x2B, 0xD3, 0x4F, 0x66, 0xFB, 0x25, 0x4F, 0xFE, 0x89, 0x88, 0xC0, 0x94, 0x56, 0x4E, 0x89, 0x93,
-    0x59, 0xAE, 0x9E, 0x64, 0x2A, 0x1B, 0x3A, 0x8C, 0x49, 0x45, 0x43, 0xB1, 0x74, 0xC8, 0x92, 0xA1,
-    0xA0, 0x21, 0x15, 0x0C, 0xD6, 0x4F, 0xE5, 0x42, 0xE3, 0x38, 0x06, 0x2E, 0x4D, 0x58, 0xAE, 0xB5,
-    0x8E, 0x78, 0xE0, 0xA2, 0xE2, 0x26, 0x2F, 0xB6, 0x72, 0x1B, 0xFC, 0xD6, 0x09, 0xDF, 0xE2, 0xBD,
-    0x63, 0xA7, 0xCE, 0x5B, 0xD1, 0x72, 0xDC, 0x0C, 0x92, 0xA9, 0x07, 0x11, 0x04, 0xD5, 0x92, 0x5C,
-    0xAC, 0x2C, 0xD2, 0x41, 0x14, 0xD4, 0x0F, 0x23, 0x60, 0x7A, 0x55, 0x05, 0xC1, 0x97, 0x7E, 0x53,
-    0xE5, 0xC0, 0x97, 0x1E, 0xA8, 0x18, 0xF8, 0xD2, 0x46, 0xA5, 0xC0, 0x8B, 0xDD, 0xA8, 0x10, 0x52,
-    0xE6, 0xD8, 0x32, 0x6C, 0x11, 0x0B, 0x20, 0xC3, 0x36, 0x20, 0x6A, 0x7C, 0x16, 0xBD, 0xC3, 0xCC,
-    0xBD, 0x08, 0x33, 0xE2, 0xDB, 0x44, 0x73, 0xCB, 0x04, 0xAD, 0x65, 0xFC, 0xDA, 0x32, 0xFA, 0xB2,
-    0x4C, 0xDE, 0xC6, 0xDC, 0x83, 0x69, 0x3C, 0x63, 0x94, 0x99, 0x34, 0x7E, 0x4E, 0x11, 0x2F, 0x6B,
-    0x50, 0x70, 0x87, 0xD7, 0xD9, 0x60, 0xB1, 0xB9, 0x00, 0xC3, 0x16, 0x24, 0x11, 0x89, 0x19, 0xD1,
-    0x36, 0xD1, 0x54, 0x65, 0xBC, 0xC6, 0x32, 0xBC, 0x94, 0xCA, 0xB0, 0x95, 0x53, 0x46, 0xEC, 0x0D,
-    0x98, 0x5C, 0xF8, 0x1C, 0x17, 0xBD, 0x2E, 0x1D, 0xF2, 0x45, 0xB7, 0x42, 0xDC, 0x82, 0x2F, 0xDA,
-    0x09, 0x6A, 0xBE, 0x29, 0x5F, 0xD4, 0x7A, 0xA6, 0x8F, 0x9F, 0xF0, 0x54, 0x5B, 0x0C, 0xAC, 0xC3,
-    0x9C, 0xC7, 0x7D, 0x9D, 0x1B, 0xD9, 0x6C, 0xED, 0xD4, 0x3C, 0x20, 0xFA, 0x86, 0x79, 0xA2, 0x1B,
-    0x5C, 0x54, 0x9D, 0x86, 0xA5, 0x38, 0xAF, 0x76, 0xDB, 0xB6, 0x07, 0x2B, 0x6D, 0x0D, 0x33, 0xCE,
-    0xBA, 0x80, 0xF6, 0x6E, 0x3F, 0xDB, 0x47, 0x0B, 0x9D, 0x45, 0xAB, 0xAF, 0xD5, 0x76, 0x6E, 0x5B,
-    0xBB, 0xEB, 0xDD, 0x56, 0x5B, 0x5D, 0x2C, 0x72, 0x72, 0xD5, 0x76, 0xF7, 0x78, 0x58, 0x36, 0x15,
-    0x86, 0xD7, 0x88, 0x34, 0x3C, 0x15, 0x86, 0xD7, 0x8A, 0x2C, 0x64, 0x17, 0x0D, 0x0A, 0xBD, 0xD2,
-    0xA4, 0x8D, 0x34, 0xD3, 0x56, 0x1A, 0x4F, 0x1B, 0xF7, 0xC5, 0x9A, 0x6D, 0x6D, 0x0E, 0x4E, 0x35,
-    0xEC, 0x89, 0x64, 0xE2, 0x6E, 0x2B, 0xF3, 0x76, 0x5B, 0x99, 0xB6, 0x9D, 0x8E, 0xDB, 0x2C, 0x37,
-    0x9E, 0x6D, 0xEA, 0xE5, 0x99, 0x06, 0xA5, 0xCE, 0x37, 0xB1, 0x52, 0x78, 0xE3, 0x0E, 0x39, 0xAC,
-    0x03, 0xEC, 0xA6, 0x78, 0xE7, 0xF2, 0xDE, 0x6B, 0x59, 0x3D, 0x60, 0x88, 0x13, 0x07, 0x5D, 0x2E,
-    0x13, 0xCF, 0xF0, 0x17, 0x6E, 0x8E, 0x6F, 0xE5, 0x27, 0xC1, 0x8B, 0x10, 0xDE, 0x73, 0xD8, 0xDF,
-    0x41, 0xB1, 0x6E, 0xEE, 0x04, 0x05, 0x0B, 0x37, 0x80, 0x99, 0x5E, 0x21, 0x21, 0x0C, 0x4E, 0x94,
-    0xD8, 0xCD, 0x33, 0xE9, 0x74, 0xD8, 0x79, 0x83, 0x70, 0x22, 0x34, 0xF3, 0x29, 0xCF, 0x3F, 0x3F,
-    0x9E, 0x18, 0x1E, 0x11, 0x7F, 0x91, 0x51, 0x9E, 0xB9, 0x6C, 0x89, 0x26, 0xBC, 0x03, 0x12, 0xD7,
-    0x14, 0xC2, 0x90, 0xFB, 0x5F, 0xB5, 0x65, 0xFE, 0xB5, 0xB1, 0xCC, 0x2F, 0x3A, 0xCB, 0x94, 0xFD,
-    0xC0, 0xA4, 0x89, 0x65, 0xE2, 0xC2, 0x32, 0x41, 0x65, 0x99, 0x49, 0x63, 0x19, 0xAF, 0xB3, 0x0C,
-    0xF5, 0x03, 0x93, 0x7F, 0xC7, 0x32, 0xF1, 0xCF, 0x2D, 0x13, 0x7E, 0x6A, 0x19, 0xF8, 0x1A, 0x61,
-    0xBC, 0x81, 0x71, 0x84, 0xF1, 0xD8, 0x40, 0xE6, 0x60, 0xEE, 0x1E, 0x27, 0xBA, 0x59, 0x73, 0xB6,
-    0x35, 0xA1, 0xEC, 0x5A, 0x1B, 0x2D, 0x3D, 0xC5, 0x8C, 0x26, 0x24, 0xA7, 0x15, 0x25, 0x76, 0x07,
-    0xDF, 0xB5, 0x5F, 0x0D, 0x6A, 0x3E, 0xBA, 0xB8, 0xAB, 0x83, 0xA2, 0xAB, 0xBC, 0x1C, 0x2B, 0x2E,
-    0xA7, 0xB3, 0xD2, 0x3A, 0xB0, 0xC2, 0x22, 0x2B, 0xAB, 0x41, 0x54, 0x56, 0x52, 0x51, 0xA7, 0x82,
-    0x5A, 0xEF, 0x54, 0x4E, 0x4E, 0x67, 0xC5, 0xD4, 0x59, 0x29, 0x75, 0x56, 0x48, 0x9D, 0x95, 0x51,
-    0x67, 0x45, 0xD4, 0x59, 0x09, 0x75, 0x56, 0x40, 0x9D, 0x95, 0x4F, 0x67, 0xC5, 0xD3, 0x59, 0xE9,
-    0x74, 0x56, 0x38, 0x9D, 0x95, 0x4D, 0x67, 0x45, 0xD3, 0x59, 0xC9, 0x74, 0x56, 0x30, 0xDD, 0xE9,
-    0x0D, 0xBB, 0xDA, 0x0E, 0xEE, 0xDB, 0xEA, 0xFA, 0xA0, 0xDE, 0x94, 0x17, 0xA7, 0x45, 0x75, 0x69,
-    0x45, 0xAA, 0x69, 0x72, 0xBA, 0xBD, 0xF9, 0xBC, 0x28, 0x80, 0xE2, 0x86, 0x6D, 0xFB, 0xC4, 0xD0,
-    0x7A, 0x6B, 0x4C, 0xB6, 0x66, 0xD8, 0x73, 0x14, 0x91, 0x98, 0x5B, 0x23, 0x11, 0x27, 0x4C, 0x8B,
-    0x2F, 0x76, 0xB8, 0x1B, 0x5B, 0xEF, 0x65, 0xB4, 0xEC, 0x37, 0xA5, 0x5D, 0x37, 0x7B, 0xDE, 0x1C,
-    0xA1, 0x24, 0x22, 0xC3, 0x2C, 0x5E, 0x99, 0xC7, 0xF3, 0xDA, 0xA3, 0xD3, 0xE2, 0xF9, 0x86, 0x15,
-    0x0F, 0xE2, 0x64, 0xF5, 0xE4, 0xF0, 0xE2, 0xEA, 0xC1, 0x49, 0xBC, 0x37, 0x89, 0xE7, 0x26, 0xF1,
-    0xDA, 0x2B, 0x2F, 0x5F, 0x6C, 0x45, 0x20, 0x9F, 0x87, 0x22, 0xDF, 0x48, 0x7E, 0x79, 0x5B, 0xAC,
-    0xCD, 0x8E, 0x5C, 0xDB, 0x88, 0xA0, 0x6B, 0xA8, 0xA8, 0x5B, 0xA1, 0x4F, 0xAF, 0xC0, 0xBD, 0xFC,
-    0x02, 0x41, 0xF8, 0x24, 0x81, 0xB9, 0x09, 0xA4, 0x0B, 0x8D, 0xF8, 0xE3, 0xD9, 0xC3, 0x06, 0xDE,
-    0xC5, 0x74, 0x08, 0xB5, 0x1D, 0x31, 0xE5, 0xBC, 0x56, 0x88, 0xDB, 0x72, 0xEC, 0x16, 0x56, 0x7A,
-    0x0F, 0x21, 0x52, 0x36, 0x29, 0xE1, 0xC8, 0xA7, 0xC7, 0x74, 0xD9, 0x34, 0x86, 0x9D, 0x97, 0xE9,
-    0x75, 0xF8, 0x32, 0xFA, 0x5D, 0x78, 0xDF, 0x48, 0xEC, 0x42, 0xBB, 0xB4, 0xF6, 0x76, 0xEA, 0x39,
-    0xDB, 0x7C, 0xFF, 0x98, 0x15, 0x21, 0x28, 0x79, 0x4E, 0x41, 0xC1, 0xD2, 0xF4, 0x0B, 0xB1, 0x82,
-    0x23, 0x71, 0xBE, 0xC7, 0xC1, 0x10, 0xDC, 0x45, 0xD0, 0xF0, 0xBF, 0x51, 0x26, 0x02, 0x67, 0x92,
-    0x2A, 0x91, 0xF5, 0x14, 0x74, 0xF1, 0x4E, 0xC3, 0xCE, 0xFA, 0xBF, 0xE7, 0x8C, 0x13, 0xDE, 0x67,
-    0x5D, 0x7D, 0x9D, 0x10, 0x79, 0x7E, 0x7F, 0xD7, 0xAD, 0xA2, 0xA0, 0x08, 0xD8, 0xB7, 0xCE, 0x47,
-    0x47, 0x02, 0xB7, 0xC9, 0x4E, 0xC2, 0xEB, 0x6C, 0x8C, 0x72, 0xD6, 0x3F, 0xBE, 0xF0, 0xAE, 0xD9,
-    0xE3, 0x4E, 0x38, 0x9C, 0xE5, 0x30, 0x96, 0xC3, 0x57, 0xDE, 0x2C, 0x1C, 0xAE, 0x8E, 0x61, 0x2A,
-    0x2F, 0xD5, 0x7A, 0x27, 0xFF, 0x7E, 0x81, 0x3F, 0xD6, 0x21, 0x56, 0x1F, 0xD6, 0x1C, 0x5A, 0x23,
-    0x57, 0x16, 0x25, 0x94, 0x80, 0xFD, 0x50, 0x46, 0x2A, 0x8B, 0x18, 0xEB, 0xB2, 0x16, 0x2B, 0x6B,
-    0x0E, 0xC4, 0x46, 0x02, 0xD8, 0x48, 0xF0, 0x9A, 0xC5, 0x4D, 0x82, 0xD6, 0x2C, 0xA2, 0x52, 0xAC,
-    0xA6, 0x58, 0x4B, 0x80, 0x57, 0xA9, 0x28, 0x4C, 0x21, 0xD9, 0x73, 0x68, 0xA5, 0x10, 0x4D, 0xAF,
-    0x52, 0x80, 0xA6, 0xBD, 0x29, 0x3C, 0xB3, 0xE8, 0x4C, 0xC1, 0x99, 0x62, 0x33, 0x0B, 0xCD, 0x04,
-    0x99, 0x65, 0xB4, 0x67, 0x83, 0xAF, 0x4D, 0x36, 0x0D, 0x14, 0xF6, 0x83, 0x5F, 0xB0, 0x3E, 0x6E,
-    0x78, 0x31, 0x62, 0x23, 0x20, 0x36, 0x02, 0x62, 0x53, 0xE8, 0xC5, 0x41, 0xD0, 0xFD, 0x97, 0x86,
-    0xD8, 0x64, 0x1C, 0x3A, 0x10, 0x1D, 0x89, 0x0E, 0x45, 0xC7, 0xB2, 0x3A, 0x18, 0x12, 0x4C, 0x37,
-    0x17, 0x48, 0xD7, 0x0A, 0xA2, 0x53, 0x24, 0x97, 0x28, 0xE8, 0x7A, 0xB9, 0xD4, 0x22, 0x38, 0x05,
-    0x70, 0x8A, 0xDF, 0x14, 0xBE, 0x29, 0x7A, 0xB3, 0xE0, 0x4D, 0x62, 0xBC, 0xD7, 0xE9, 0x4D, 0xEC,
-    0x1C, 0x81, 0xBA, 0xFE, 0x3F, 0x2B, 0xB4, 0x13, 0x35, 0x30, 0xD9, 0x29, 0xB7, 0x33, 0x28, 0x1E,
-    0x80, 0x1D, 0x09, 0xB0, 0x83, 0xB6, 0x07, 0xD5, 0x59, 0xC0, 0xDC, 0x0B, 0x02, 0xBB, 0xAD, 0x2D,
-    0x0C, 0x54, 0x31, 0xC8, 0x6C, 0xB6, 0x37, 0x8E, 0xE5, 0x07, 0x2E, 0x3E, 0xEF, 0x24, 0x88, 0x51,
-    0xDA, 0x4E, 0x8A, 0x57, 0x41, 0xE6, 0x21, 0x0C, 0x1E, 0x63, 0xCA, 0x55, 0xD0, 0x19, 0x26, 0xF2,
-    0x79, 0xB6, 0xA0, 0x57, 0xE8, 0x07, 0x5F, 0xBE, 0xFC, 0xE9, 0xCA, 0xDE, 0xC2, 0x3A, 0xA8, 0x6B,
-    0xD9, 0x15, 0x2A, 0x96, 0xF6, 0xEA, 0xB7, 0xC4, 0x11, 0x43, 0xF2, 0xCE, 0xF2, 0x5A, 0x5C, 0x1D,
-    0x53, 0x03, 0x17, 0x74, 0x15, 0x4E, 0x85, 0x4F, 0x1A, 0x17, 0x4F, 0xD4, 0xC7, 0xC9, 0xB7, 0xD7,
-    0x65, 0xE6, 0x0C, 0x32, 0xC6, 0x15, 0x79, 0xBF, 0x1B, 0x77, 0xCA, 0x97, 0xBC, 0x22, 0x6A, 0x79,
-    0x5A, 0xB1, 0x3C, 0xB1, 0xC4, 0xC6, 0x81, 0x78, 0x5E, 0x5F, 0xFC, 0xCF, 0x55, 0x47, 0x57, 0xA4,
-    0x5C, 0xAC, 0xC8, 0xE4, 0x15, 0x5A, 0x91, 0x9B, 0xB4, 0x81, 0x09, 0x7D, 0x0C, 0xFB, 0xE9, 0x69,
-    0xE2, 0x41, 0x6D, 0xD1, 0x7B, 0x4F, 0xAD, 0x88, 0xD0, 0x20, 0xB9, 0x00, 0x2B, 0xF2, 0xE1, 0x52,
-    0xBC, 0xA5, 0x5B, 0x44, 0xC0, 0x8B, 0x44, 0x31, 0x2C, 0xF9, 0xBF, 0x18, 0x57, 0x84, 0x77, 0x47,
-    0xF5, 0xAA, 0xAD, 0x88, 0xEE, 0x7C, 0x0D, 0x09, 0xDD, 0x7A, 0xCC, 0x8C, 0x3E, 0x6B, 0x8F, 0x14,
-    0x17, 0x66, 0x45, 0x90, 0x9A, 0x41, 0xCE, 0xD1, 0x24, 0x61, 0x12, 0x15, 0x5F, 0x97, 0xCC, 0x2F,
-    0x7C, 0x32, 0x62, 0x34, 0xC8, 0x41, 0xDF, 0x29, 0x07, 0x9F, 0xE9, 0xEC, 0x61, 0x97, 0x32, 0xCF,
-    0x08, 0xAD, 0x8D, 0x13, 0xAF, 0x41, 0x04, 0x18, 0x94, 0x41, 0xC9, 0x61, 0x23, 0xE3, 0xC9, 0xB9,
-    0x46, 0x1D, 0xCE, 0xD6, 0x96, 0xE8, 0x23, 0x54, 0xD1, 0x9D, 0xCD, 0x16, 0xC2, 0xD9, 0xBB, 0x22,
-    0xCE, 0x9E, 0x83, 0x05, 0x50, 0x24, 0xE3, 0xEA, 0x30, 0xB9, 0xD0, 0xB1, 0xB3, 0x8B, 0x49, 0xF0,
-    0x4C, 0x96, 0x7D, 0xA5, 0x53, 0x33, 0x1A, 0xF4, 0x5A, 0xBE, 0x97, 0xDB, 0xE0, 0x86, 0x7B, 0x6B,
-    0xE7, 0x18, 0x45, 0x5B, 0xB1, 0x2A, 0x3D, 0x2D, 0xB8, 0x62, 0x21, 0x38, 0xAB, 0x7F, 0xD9, 0xAB,
-    0x24, 0x56, 0xF2, 0xCA, 0x61, 0xE4, 0x42, 0xDC, 0xEC, 0x3C, 0xC5, 0xCA, 0x26, 0x73, 0xF6, 0x60,
-    0x91, 0xC6, 0x93, 0x50, 0xEA, 0xCE, 0xB3, 0xD0, 0xAD, 0x6F, 0x8C, 0x8C, 0x7B, 0x2D, 0xD7, 0x96,
-    0x7E, 0xC4, 0x3B, 0x07, 0xED, 0xFF, 0xB4, 0x32, 0x5D, 0xE7, 0xDF, 0xB5, 0xF5, 0x3E, 0x6E, 0xC9,
-    0xE5, 0xD6, 0xFF, 0xB1, 0x02, 0x9D, 0xC0, 0x02, 0x9E, 0x6B, 0xB6, 0xDD, 0xB0, 0xED, 0x8E, 0x3B,
-    0x97, 0x1B, 0xD5, 0xAE, 0x08, 0xD2, 0xAD, 0xF8, 0xFF, 0xEF, 0x42, 0xF4, 0xFA, 0xFD, 0xE4, 0x93,
-    0x87, 0xD2, 0x06, 0x48, 0x39, 0xF2, 0xEB, 0x86, 0x05, 0x4E, 0x1B, 0xB6, 0x3D, 0x90, 0xF6, 0x87,
-    0x2C, 0x7A, 0xB4, 0x8F, 0x58, 0x86, 0x68, 0x6B, 0x5E, 0x6E, 0xA4, 0xD3, 0x6B, 0x16, 0xBA, 0xA4,
-    0xBB, 0x58, 0xEC, 0x46, 0xD2, 0x7C, 0x3C, 0x4D, 0x89, 0x50, 0x8C, 0xCE, 0xF2, 0x19, 0x93, 0x64,
-    0x49, 0xBB, 0xA6, 0x82, 0xAC, 0xFF, 0xED, 0xD3, 0x0E, 0xD2, 0x36, 0x12, 0xDA, 0x7B, 0x40, 0x04,
-    0x3E, 0xB2, 0xF9, 0xD0, 0x06, 0x4F, 0x40, 0x02, 0x8C, 0x04, 0x6B, 0x85, 0xF3, 0xBD, 0x93, 0xD9,
-    0x7E, 0xE9, 0xE0, 0x06, 0xA6, 0x64, 0xD9, 0xFF, 0x86, 0xA3, 0x50, 0x96, 0x7E, 0x23, 0xF6, 0x5D,
-    0x9A, 0x54, 0x6B, 0x47, 0xBC, 0x06, 0x9D, 0x7C, 0x18, 0xF4, 0xE4, 0x26, 0x71, 0x76, 0x33, 0xCD,
-    0x26, 0x59, 0x68, 0xDA, 0x90, 0x87, 0xE7, 0x9B, 0xD2, 0xC5, 0x14, 0x79, 0x35, 0x2E, 0x2F, 0x97,
-    0x14, 0x78, 0xB4, 0x41, 0xBF, 0x2F, 0x19, 0x70, 0x57, 0x51, 0x9D, 0xA4, 0x66, 0x19, 0x9B, 0xC0,
-    0x4A, 0xDD, 0xB2, 0x79, 0x39, 0x35, 0xBB, 0x51, 0x31, 0x40, 0xF6, 0xE7, 0xD0, 0xC8, 0x00, 0x54,
-    0xF1, 0xAD, 0x00, 0xAA, 0x8C, 0xAD, 0x24, 0x70, 0x0F, 0x33, 0xF3, 0x80, 0xF5, 0xDA, 0x98, 0x06,
-    0x75, 0x83, 0x23, 0x89, 0x73, 0xD8, 0x3F, 0xB1, 0x49, 0x3B, 0x02, 0x50, 0x79, 0xD8, 0x8B, 0xA5,
-    0x7F, 0x42, 0x63, 0xFD, 0x89, 0xB1, 0x74, 0xD4, 0xA7, 0x25, 0xF5, 0xD3, 0xFF, 0x28, 0xBD, 0xDA,
-    0xAF, 0x12, 0xBF, 0x62, 0x15, 0x9B, 0x94, 0x6E, 0x03, 0xD2, 0x5A, 0xAE, 0x62, 0xE2, 0xD5, 0x1E,
-    0x96, 0x06, 0x5B, 0x20, 0x87, 0xC1, 0xFD, 0xD1, 0x07, 0xC8, 0x83, 0xCA, 0xDE, 0x02, 0x79, 0xA2,
-    0xF5, 0xA1, 0x06, 0xDF, 0xCE, 0xC1, 0x19, 0xC9, 0x6D, 0x25, 0x9B, 0x48, 0xE6, 0xDD, 0xC6, 0x88,
-    0x36, 0xE9, 0xBD, 0xFC, 0x81, 0x00, 0x2D, 0x36, 0x9B, 0x6C, 0xD3, 0x4F, 0xD8, 0xEF, 0xF0, 0x12,
-    0x25, 0x63, 0x81, 0x41, 0xD3, 0x12, 0x82, 0xEC, 0x15, 0xDA, 0xDB, 0x8C, 0xFA, 0x69, 0x70, 0x7F,
-    0x8E, 0xC2, 0x64, 0xA1, 0xC1, 0x48, 0x1C, 0xD1, 0x17, 0x12, 0xA6, 0x22, 0x54, 0xEF, 0xB3, 0x11,
-    0xEA, 0xEF, 0x45, 0xDE, 0xFD, 0xD3, 0xF2, 0x66, 0x77, 0x0C, 0x2E, 0x19, 0xE4, 0x7D, 0xB8, 0x2C,
-    0x6F, 0x37, 0x01, 0x88, 0x72, 0x2B, 0xD4, 0xFB, 0xA8, 0xBD, 0x27, 0xA1, 0x88, 0x48, 0x3A, 0xAA,
-    0x17, 0x09, 0xE2, 0x65, 0x69, 0xD7, 0x01, 0x0A, 0x61, 0x0F, 0x26, 0x26, 0x1B, 0xB3, 0x1B, 0x9E,
-    0x54, 0x5F, 0x7C, 0xA9, 0xB7, 0x84, 0x12, 0x50, 0x6F, 0x08, 0x95, 0x72, 0x15, 0x0C, 0xA0, 0xDB,
-    0x05, 0x52, 0x99, 0x8A, 0x24, 0xDC, 0x46, 0x52, 0xCE, 0x9D, 0xF3, 0x6E, 0xE4, 0xA1, 0xFE, 0x13,
-    0x7E, 0x63, 0xB4, 0xC6, 0x85, 0x4A, 0x0A, 0x5F, 0xC5, 0x46, 0x94, 0x69, 0x2C, 0xE5, 0x9D, 0x50,
-    0x7A, 0x9E, 0x48, 0x0D, 0x8D, 0xF7, 0x2A, 0xFF, 0xCE, 0x31, 0xC9, 0x5D, 0x5E, 0xF1, 0xF4, 0x09,
-    0x2C, 0x1A, 0x7F, 0xF1, 0x36, 0xF6, 0xD6, 0x4D, 0x18, 0xE9, 0xE0, 0xEF, 0x4B, 0xB8, 0x10, 0xDC,
-    0xC8, 0xD8, 0x9C, 0xDF, 0x1B, 0x77, 0x86, 0xE9, 0x48, 0x60, 0xEC, 0xAE, 0x26, 0xB1, 0x97, 0xD3,
-    0xD9, 0x8D, 0xD3, 0xB2, 0x85, 0xE0, 0x7F, 0x53, 0x7C, 0xD6, 0x32, 0x71, 0x11, 0x75, 0xB0, 0x15,
-    0x74, 0xDA, 0x10, 0x3F, 0xB9, 0xCF, 0xE4, 0xD8, 0x20, 0xAA, 0x60, 0x0B, 0xE9, 0x18, 0x98, 0x88,
-    0x0E, 0x55, 0x34, 0x64, 0xE0, 0x9D, 0xD6, 0x99, 0xE3, 0x32, 0x29, 0x2C, 0xC5, 0xC5, 0xBA, 0x49,
-    0x82, 0x36, 0xE5, 0x58, 0xAE, 0xBF, 0xA8, 0x79, 0x14, 0x8D, 0x50, 0x6E, 0xCB, 0xE0, 0xD4, 0x64,
-    0x8B, 0x62, 0x3A, 0xED, 0x52, 0xBA, 0x34, 0x97, 0x7D, 0x17, 0xB6, 0xBF, 0xFF, 0x74, 0x8A, 0x38,
-    0x49, 0x41, 0x5D, 0x9B, 0xE3, 0xB0, 0xEE, 0xD9, 0x43, 0x03, 0xC0, 0xC9, 0x58, 0x40, 0x8C, 0x69,
-    0x6D, 0x36, 0x93, 0x0A, 0x2E, 0x3E, 0xB8, 0x2C, 0xF1, 0xD8, 0x85, 0x4E, 0x56, 0x9D, 0x51, 0xC8,
-    0xB3, 0x59, 0x06, 0xE5, 0x2A, 0x87, 0x84, 0xC7, 0x39, 0xE4, 0xB1, 0x90, 0x6D, 0x57, 0xC1, 0x8B,
-    0xA5, 0xDD, 0x1C, 0xC9, 0x92, 0xE0, 0x31, 0x95, 0x3D, 0xC4, 0xD4, 0x3B, 0x58, 0xA6, 0x08, 0x3B,
-    0x39, 0x18, 0x57, 0x64, 0x4C, 0x78, 0xDA, 0xDA, 0x3A, 0x2F, 0x4D, 0x60, 0x49, 0x07, 0x8C, 0xD1,
-    0xD0, 0x1F, 0x63, 0x75, 0x2F, 0xE9, 0x4D, 0x6E, 0x0F, 0x92, 0x70, 0x2B, 0xB5, 0x7F, 0xDC, 0xDF,
-    0x07, 0xB8, 0x1B, 0x26, 0xFD, 0xC6, 0x5D, 0x29, 0xA7, 0xC9, 0xDE, 0x45, 0x21, 0x5B, 0x0A, 0xE5,
-    0x6A, 0xB0, 0xA3, 0xE2, 0x36, 0xC8, 0x7D, 0x7C, 0x96, 0xC2, 0xCE, 0xC7, 0x85, 0xD3, 0x53, 0x78,
-    0x32, 0x6D, 0x49, 0x82, 0x2E, 0xBA, 0x7C, 0x07, 0x96, 0xCC, 0x49, 0xD8, 0x8E, 0x25, 0x62, 0xC5,
-    0x90, 0xCA, 0x86, 0x05, 0x5B, 0xB2, 0x5F, 0x28, 0xB3, 0xF2, 0x1B, 0x7E, 0xB9, 0xBE, 0xC9, 0xD6,
-    0xEA, 0x3A, 0x8F, 0xE9, 0x92, 0x0C, 0xE9, 0xA7, 0x8A, 0x6A, 0x10, 0x6B, 0xC2, 0x0C, 0xC6, 0xDC,
-    0x59, 0xDA, 0xDB, 0x32, 0xE0, 0xC4, 0x16, 0xDA, 0xA5, 0xD2, 0x30, 0x5F, 0x7A, 0x77, 0x97, 0xF8,
-    0xBD, 0xCB, 0x8B, 0xF9, 0x98, 0xED, 0x5F, 0x0E, 0x7D, 0x3A, 0x31, 0xC9, 0x1A, 0xBB, 0x80, 0xB7,
-    0xE9, 0xED, 0x1B, 0x54, 0xB3, 0x35, 0xF2, 0x4D, 0x06, 0x4B, 0x34, 0xD4, 0x1E, 0x38, 0x3C, 0x98,
-    0xF4, 0xE2, 0x35, 0xEE, 0x9F, 0xFD, 0x8F, 0xAF, 0x7A, 0x8C, 0x31, 0xB0, 0xBC, 0xA3, 0x8A, 0xEE,
-    0x27, 0xFF, 0x7F, 0x2C, 0xC1, 0x1E, 0x4B, 0xB0, 0x47, 0x10, 0x64, 0x97, 0xD8, 0x23, 0x29, 0xC3,
-    0x11, 0x04, 0xED, 0xDF, 0x6F, 0x07, 0xEE, 0x0F, 0xE7, 0x08, 0xC2, 0xA0, 0xD0, 0x23, 0xCE, 0x7D,
-    0xAA, 0x48, 0xF8, 0xF9, 0xCC, 0xAB, 0x73, 0x04, 0x81, 0x5F, 0x6F, 0x25, 0x8B, 0x2A, 0xDD, 0x7C,
-    0xE9, 0xB4, 0x91, 0xEC, 0xEE, 0x35, 0x7A, 0x25, 0x62, 0x42, 0xCD, 0xA2, 0xCA, 0xCD, 0x24, 0x41,
-    0x74, 0x28, 0xA8, 0x7B, 0x05, 0x13, 0x5E, 0x84, 0x98, 0x90, 0x23, 0x2B, 0x5F, 0x5C, 0x2C, 0x87,
-    0x79, 0x6B, 0xE2, 0xC9, 0xB0, 0x41, 0xA3, 0xD2, 0xEE, 0x18, 0x11, 0xDA, 0x0B, 0x32, 0xF3, 0xAD,
-    0xAD, 0x69, 0xA1, 0x23, 0x63, 0x6B, 0xC5, 0x37, 0xD2, 0x4F, 0xD6, 0xFB, 0x44, 0x7F, 0xE3, 0xD9,
-    0xED, 0x54, 0xB8, 0x67, 0x62, 0xD4, 0x98, 0x05, 0x25, 0xAF, 0x30, 0x86, 0x1A, 0x54, 0xBC, 0xA3,
-    0x10, 0x25, 0x7A, 0xC7, 0xD3, 0x52, 0xA1, 0x6F, 0x3E, 0xEE, 0x95, 0x11, 0x1A, 0xA6, 0x8D, 0x2F,
-    0x39, 0xA9, 0xD8, 0xA0, 0x9F, 0x63, 0xD4, 0x74, 0xF9, 0x7F, 0xB6, 0x55, 0x2C, 0xCD, 0x48, 0x2C,
-    0x15, 0xEF, 0xEA, 0xB9, 0xA4, 0x17, 0xBA, 0xE7, 0xD3, 0x50, 0x12, 0x67, 0xFC, 0xFB, 0x4E, 0x54,
-    0xA5, 0x13, 0x9D, 0xEF, 0xE4, 0xA4, 0xC9, 0x50, 0x9F, 0x83, 0xDE, 0x75, 0xA2, 0x2F, 0x9D, 0xF8,
-    0xD5, 0x4E, 0x0C, 0x51, 0x87, 0xE4, 0x15, 0xF5, 0x62, 0xB2, 0x44, 0x49, 0xAC, 0xA3, 0xE8, 0x56,
-    0xA9, 0xD6, 0xFC, 0x5C, 0xF9, 0x76, 0x5D, 0x8C, 0x5D, 0x6A, 0x34, 0x8E, 0xF8, 0x60, 0xA9, 0xB6,
-    0x9B, 0xD2, 0x22, 0xE2, 0xD0, 0xA4, 0x09, 0xAD, 0x86, 0xEE, 0x72, 0x02, 0x40, 0xEB, 0xFF, 0x5A,
-    0xFD, 0xD7, 0xDA, 0xBF, 0x56, 0xFE, 0xB5, 0xEE, 0xAF, 0x55, 0x7F, 0xAD, 0xF9, 0x6B, 0xC5, 0x5F,
-    0xEB, 0xFD, 0x5A, 0xED, 0xD7, 0x5A, 0xBF, 0x56, 0xFA, 0xB5, 0xCE, 0xAF, 0x55, 0x7E, 0xAD, 0xF1,
-    0x6B, 0x85, 0x5F, 0xEB, 0xFB, 0x5A, 0xDD, 0xD7, 0xDA, 0xBE, 0x56, 0xF6, 0xB5, 0xAE, 0xAF, 0x55,
-    0x7D, 0x5B, 0xD3, 0x5F, 0x93, 0xD4, 0x84, 0xD7, 0x2E, 0x4D, 0x78, 0x93, 0x16, 0xF9, 0x77, 0x37,
-    0x7B, 0x46, 0x05, 0x5E, 0xEB, 0xEF, 0xB6, 0xFA, 0xAE, 0xB5, 0x77, 0xAD, 0xBC, 0x6B, 0xDD, 0x5D,
-    0xAB, 0xE6, 0x67, 0xA5, 0x5A, 0x63, 0xB7, 0x15, 0x76, 0xA9, 0xAF, 0x8F, 0xBB, 0xFF, 0x68, 0xC9,
-    0xD8, 0x88, 0x54, 0x1D, 0x95, 0xB3, 0xB8, 0x97, 0x23, 0x29, 0xA0, 0xD6, 0xD7, 0x40, 0x15, 0x40,
-    0xD5, 0xAF, 0x81, 0x7E, 0xF4, 0x78, 0x91, 0x8A, 0x0A, 0x96, 0xD3, 0x52, 0x32, 0xC9, 0x6D, 0xA1,
-    0xF5, 0x91, 0x9C, 0x1D, 0x4A, 0xC5, 0x8A, 0x41, 0x2B, 0x3C, 0x99, 0xD1, 0x24, 0x09, 0x8A, 0x95,
-    0x84, 0x94, 0x6C, 0xE2, 0x54, 0xF2, 0x28, 0x07, 0xA2, 0x24, 0xB5, 0xF8, 0x9F, 0x4A, 0x12, 0x10,
-    0x48, 0x42, 0x65, 0xBE, 0xA6, 0xA2, 0x7E, 0xB3, 0x48, 0x45, 0x59, 0x3B, 0x93, 0x0E, 0xF1, 0x96,
-    0x18, 0x4A, 0x19, 0xBA, 0x08, 0x5D, 0x8E, 0xA9, 0xED, 0x60, 0xC4, 0x8F, 0x70, 0xD6, 0x43, 0xC8,
-    0x6E, 0x38, 0x7C, 0xE1, 0xEC, 0x9D, 0x5B, 0x7A, 0x8A, 0xE8, 0xDD, 0xD3, 0x87, 0x59, 0xC6, 0x03,
-    0x1C, 0x56, 0x79, 0x03, 0xEB, 0x03, 0xFE, 0x84, 0xFE, 0x10, 0xD3, 0x56, 0xB4, 0xB6, 0xB7, 0x74,
-    0x0C, 0x4B, 0x0F, 0x39, 0x59, 0xE4, 0x63, 0xB1, 0x02, 0x39, 0x05, 0x5D, 0xD4, 0x5C, 0xD6, 0x7B,
-    0x8B, 0x85, 0xD3, 0xF9, 0x0B, 0x9A, 0xB0, 0x4B, 0xF6, 0xA7, 0xA7, 0x86, 0x7C, 0x03, 0x26, 0xFF,
-    0xF8, 0x96, 0xA0, 0xB3, 0x5A, 0xD0, 0x59, 0x8B, 0x1B, 0x7A, 0x82, 0xCE, 0x7C, 0xD9, 0xC6, 0x81,
-    0xA0, 0xB3, 0x1B, 0x82, 0xCE, 0x36, 0x04, 0x9D, 0x1D, 0x08, 0x3A, 0xAB, 0x81, 0xCE, 0xDC, 0x02,
-    0x58, 0xCC, 0xCF, 0x40, 0x03, 0xC1, 0x65, 0xD7, 0x84, 0x6E, 0x08, 0x3A, 0xDB, 0x16, 0x74, 0x56,
-    0x03, 0x9D, 0x7D, 0x8C, 0xF3, 0xDE, 0xC1, 0xAF, 0x0A, 0xA0, 0xB3, 0xDF, 0xCA, 0x51, 0xAB, 0x7E,
-    0x09, 0x9D, 0xA5, 0x82, 0xCE, 0xFE, 0x17, 0xFB, 0xC3, 0x29, 0x25, 0xA9, 0x6F, 0xD5, 0xEB, 0xAD,
-    0x71, 0xC7, 0x1F, 0x9D, 0x82, 0x28, 0xDE, 0x12, 0x0E, 0xE3, 0x6D, 0x3E, 0xED, 0x77, 0x01, 0xC4,
-    0x9A, 0x01, 0x88, 0xA9, 0xC8, 0x7B, 0x36, 0x69, 0x01, 0x30, 0xD8, 0x0D, 0x90, 0x1D, 0x20, 0xAF,
-    0x9A, 0x09, 0xDB, 0xCC, 0x24, 0xF6, 0x0A, 0x26, 0x01, 0x80, 0xD8, 0x5F, 0xC1, 0xD1, 0x1E, 0x62,
-    0xA5, 0x1A, 0x00, 0xB1, 0x9A, 0xED, 0xB6, 0x07, 0x20, 0xE6, 0xC3, 0x1A, 0x06, 0x70, 0x4B, 0x7A,
-    0x38, 0xE9, 0xAF, 0xAF, 0x60, 0x18, 0x29, 0xC2, 0x14, 0x8A, 0xBE, 0xDD, 0x48, 0x21, 0x49, 0x32,
-    0x47, 0x95, 0xA0, 0xA7, 0x47, 0x93, 0x8B, 0x7D, 0x2E, 0xE7, 0x5D, 0xA8, 0x74, 0x0C, 0xCB, 0x10,
-    0xBE, 0x8F, 0xC3, 0xBF, 0xE5, 0x21, 0xC0, 0x15, 0xD0, 0xE5, 0xF6, 0xE4, 0x5C, 0x53, 0xDF, 0x57,
-    0xC4, 0xBB, 0xA4, 0x32, 0xF1, 0x5E, 0x26, 0x5E, 0xCA, 0xB9, 0xB6, 0xCC, 0xBB, 0xD8, 0xC5, 0x19,
-    0x1D, 0xB8, 0x8C, 0x1B, 0xC3, 0x76, 0x2A, 0x9F, 0xDD, 0x5D, 0xE1, 0x65, 0xE7, 0x27, 0xBB, 0x2B,
-    0xD9, 0x87, 0x30, 0x49, 0x73, 0x74, 0x84, 0xA9, 0xB6, 0x38, 0x81, 0xB9, 0x8B, 0xA0, 0xE2, 0x35,
-    0xA7, 0x3A, 0x7D, 0x32, 0x5E, 0xC1, 0x27, 0x6C, 0xCE, 0x04, 0xE1, 0x98, 0x27, 0x31, 0xD9, 0x48,
-    0x2C, 0x72, 0x5E, 0x22, 0x30, 0xAF, 0x62, 0x5B, 0xC5, 0xB0, 0x3E, 0xF3, 0x27, 0x03, 0xD9, 0xD6,
-    0x63, 0xAE, 0x1D, 0xF2, 0xA8, 0x38, 0xE2, 0x2A, 0xA6, 0x53, 0x8E, 0xB7, 0x42, 0xC5, 0x52, 0x9E,
-    0x40, 0xF4, 0x63, 0x0E, 0x56, 0x8A, 0x43, 0x5E, 0x90, 0xCD, 0xD3, 0xFB, 0x82, 0xC1, 0xBB, 0xDB,
-    0xE7, 0x85, 0x5F, 0x4F, 0x18, 0xCB, 0x78, 0x4D, 0x98, 0xB9, 0x1D, 0xE3, 0xCD, 0x0E, 0x87, 0xEA,
-    0xE2, 0xD9, 0x0C, 0xE0, 0xA2, 0x8B, 0xB7, 0xB6, 0xBE, 0x1B, 0xDB, 0x48, 0x1C, 0xDE, 0x37, 0x94,
-    0x64, 0x10, 0xBD, 0xED, 0x37, 0x4E, 0xC3, 0x03, 0xAC, 0xD8, 0xE1, 0x26, 0x12, 0x2B, 0x3A, 0x1F,
-    0x89, 0xC1, 0x67, 0x09, 0x44, 0x0F, 0x4B, 0x98, 0x7A, 0x96, 0xED, 0x37, 0xE9, 0xD1, 0x05, 0x10,
-    0x03, 0x5D, 0xE1, 0xA8, 0x31, 0x66, 0x4D, 0xE8, 0xF7, 0x13, 0x62, 0x2D, 0x71, 0x8A, 0xA5, 0x88,
-    0xE9, 0x25, 0x8A, 0x00, 0xE2, 0xC6, 0x86, 0x0E, 0x7F, 0xD6, 0xF2, 0x56, 0x39, 0x64, 0x25, 0x8E,
-    0xB0, 0x99, 0x93, 0x45, 0xDA, 0xCD, 0x14, 0xAC, 0x91, 0x99, 0x84, 0x3A, 0x93, 0x97, 0xF4, 0xE6,
-    0xBE, 0x9C, 0x94, 0x51, 0x01, 0xF7, 0xFD, 0x8E, 0xCB, 0xF7, 0x67, 0x43, 0x08, 0x33, 0xE8, 0x57,
-    0xF7, 0xF8, 0xFE, 0x1C, 0xA9, 0xEC, 0xF8, 0x8B, 0x5D, 0x0C, 0x4F, 0x3A, 0xAD, 0xB5, 0x36, 0xE0,
-    0x9D, 0xF1, 0x0D, 0xE4, 0x36, 0x65, 0xCC, 0xC3, 0xF7, 0x71, 0x3F, 0xE4, 0x8D, 0x90, 0xC4, 0xFB,
-    0xC5, 0x8E, 0x53, 0xFD, 0x90, 0x1E, 0xBC, 0xDC, 0x73, 0x7C, 0x8B, 0xCE, 0xDD, 0xF2, 0x11, 0x55,
-    0xFF, 0xA7, 0x43, 0x7C, 0x1F, 0x5A, 0x0F, 0x51, 0x89, 0x87, 0xA8, 0x3F, 0xD7, 0x43, 0x5C, 0xC8,
-    0x43, 0x7C, 0x6F, 0xFD, 0x39, 0x4B, 0x38, 0xFC, 0x59, 0x07, 0x17, 0xF1, 0x78, 0xB4, 0x34, 0x48,
-    0x2E, 0x5E, 0x77, 0x8B, 0xF3, 0x3C, 0xC4, 0xB7, 0xAE, 0x95, 0x43, 0x71, 0xF9, 0x27, 0x8F, 0xC5,
-    0xB2, 0x07, 0xE2, 0xF9, 0x5F, 0x09, 0x31, 0xD2, 0xDA, 0x13, 0xC9, 0x9F, 0x22, 0x72, 0xD9, 0xC7,
-    0x81, 0x58, 0xB8, 0x95, 0xD2, 0x39, 0x47, 0x09, 0xBE, 0xE3, 0x0A, 0xA2, 0x90, 0xC8, 0xDA, 0xEA,
-    0x61, 0x2D, 0x30, 0xAE, 0x91, 0x40, 0xF0, 0xBA, 0x97, 0xAD, 0xE6, 0x66, 0x50, 0x76, 0x62, 0x7B,
-    0x39, 0x97, 0xBC, 0x42, 0x9E, 0x48, 0x9D, 0x47, 0x12, 0x65, 0x9A, 0x38, 0xB3, 0xB4, 0x7E, 0xEA,
-    0x13, 0xF9, 0x0D, 0x1E, 0x23, 0x14, 0x00, 0xED, 0x4A, 0xA6, 0x9C, 0xE7, 0xA5, 0xF5, 0x25, 0x49,
-    0x3C, 0x42, 0x44, 0x6E, 0x07, 0xA8, 0x8C, 0x3A, 0x92, 0xD0, 0x54, 0xAB, 0x49, 0x85, 0xED, 0xD3,
-    0x93, 0x6A, 0x12, 0xEF, 0x49, 0x06, 0xA6, 0x48, 0x0C, 0xE4, 0x05, 0xC6, 0x8F, 0xD1, 0x63, 0xEC,
-    0x1E, 0x3C, 0x49, 0xC3, 0xE6, 0xE5, 0xD6, 0x62, 0xD4, 0x71, 0x13, 0x37, 0xEB, 0x8D, 0xE9, 0x9C,
-    0x13, 0x56, 0x56, 0x93, 0xA0, 0xDF, 0x3D, 0x79, 0x8E, 0x64, 0x6E, 0x51, 0xEB, 0x67, 0xBC, 0x31,
-    0xCE, 0x75, 0xF3, 0x0F, 0x78, 0x7E, 0x86, 0x07, 0xF3, 0x11, 0x0D, 0xAE, 0x84, 0x62, 0xF8, 0x12,
-    0xDA, 0x10, 0x77, 0x3A, 0xDA, 0x9A, 0x8B, 0x2A, 0x21, 0x7A, 0x67, 0x4F, 0x8E, 0xD2, 0x78, 0x27,
-    0xAC, 0xED, 0x1C, 0x78, 0xFB, 0x74, 0x65, 0x61, 0x7B, 0x4B, 0x53, 0x4E, 0x7F, 0x61, 0x6A, 0xFF,
-    0x53, 0xBF, 0xF6, 0xE6, 0x5E, 0xED, 0x75, 0x6E, 0x82, 0x7B, 0x00, 0x54, 0x7C, 0x31, 0xDB, 0x7B,
-    0x87, 0xE0, 0x6B, 0xE8, 0xAD, 0x6F, 0x21, 0x9B, 0x11, 0xC0, 0x20, 0xB0, 0x95, 0x3F, 0xA2, 0x21,
-    0x6A, 0xA4, 0x43, 0x29, 0x13, 0xAC, 0x18, 0x85, 0x0B, 0x7A, 0x5C, 0xCA, 0x7D, 0xF0, 0xAE, 0xD4,
-    0x78, 0xA5, 0x7A, 0xD2, 0x49, 0xCA, 0xEB, 0x9E, 0x44, 0x97, 0xA1, 0x24, 0xFA, 0xFC, 0x64, 0xFB,
-    0xCB, 0x3F, 0x16, 0x25, 0x06, 0x43, 0x2D, 0x86, 0x9A, 0x0C, 0xB5, 0x19, 0xAB, 0x46, 0xE3, 0xC2,
-    0x1E, 0x48, 0xFB, 0x49, 0x22, 0xE7, 0x85, 0xA4, 0x70, 0xF5, 0x09, 0xE2, 0xF4, 0xD7, 0x68, 0x47,
-    0x12, 0x04, 0x5F, 0xBF, 0x08, 0x47, 0xCE, 0x58, 0xA1, 0x19, 0xD6, 0xED, 0xE3, 0xF0, 0x58, 0x1D,
-    0x25, 0x6E, 0x13, 0x93, 0xC3, 0x6F, 0xDA, 0x8B, 0x2D, 0xBE, 0x44, 0x16, 0x15, 0x27, 0x19, 0x7C,
-    0x24, 0xB1, 0x60, 0x15, 0x22, 0x61, 0x2A, 0x2D, 0x01, 0xCA, 0x03, 0x65, 0xF3, 0xAF, 0xF0, 0x7B,
-    0x83, 0xE8, 0xF1, 0x3D, 0xBE, 0x1F, 0x92, 0x89, 0x31, 0x07, 0xEF, 0xE1, 0xAF, 0xA7, 0x8C, 0xBE,
-    0xFB, 0xC5, 0xA3, 0xC9, 0x7E, 0xA5, 0xA7, 0x55, 0x03, 0x5B, 0xB4, 0xBA, 0xB6, 0x78, 0xBA, 0xC5,
-    0x35, 0x1C, 0x2C, 0xFD, 0x8B, 0x3C, 0x2C, 0xC2, 0x92, 0xBC, 0xC9, 0x96, 0xFE, 0x4D, 0x0D, 0xF2,
-    0xF8, 0xE7, 0xE1, 0x1C, 0xF7, 0x46, 0xEE, 0xA8, 0x03, 0x23, 0x49, 0xF5, 0x4B, 0x14, 0x66, 0xB7,
-    0x78, 0x7D, 0x77, 0x29, 0x4C, 0xEE, 0xE1, 0xAA, 0x7F, 0xC4, 0x93, 0x2E, 0x15, 0x8D, 0x49, 0x9A,
-    0xD8, 0x66, 0xE6, 0x76, 0xED, 0xB9, 0xBF, 0x5A, 0x9F, 0x88, 0x43, 0xC5, 0x69, 0x0E, 0xD2, 0x6F,
-    0xF2, 0xA2, 0x6D, 0xEE, 0x32, 0xB9, 0xB6, 0xC3, 0xE4, 0xB5, 0x6D, 0xA4, 0xC7, 0x6D, 0x91, 0xE5,
-    0xE5, 0x91, 0xAF, 0x22, 0x4B, 0x1A, 0x9B, 0xF9, 0xA9, 0x55, 0x16, 0xB8, 0xFE, 0x78, 0x2C, 0xB0,
-    0xD6, 0x64, 0x93, 0xE0, 0xF2, 0xC4, 0xDE, 0xB6, 0x64, 0xCC, 0x1A, 0x24, 0x95, 0x42, 0xD3, 0xA6,
-    0xA6, 0x45, 0x7E, 0xF8, 0xF3, 0xFE, 0x5C, 0x79, 0x70, 0x95, 0xCC, 0x5F, 0x42, 0x44, 0xAA, 0x72,
-    0xEC, 0x00, 0x63, 0x91, 0x00, 0xAF, 0xCA, 0xCE, 0xF8, 0x4C, 0x95, 0x0B, 0x33, 0x1D, 0x9E, 0xB0,
-    0x7A, 0xA5, 0x38, 0x0A, 0x71, 0x04, 0x6B, 0x2F, 0x8E, 0xFA, 0x10, 0xE4, 0x75, 0xFB, 0xB0, 0xE1,
-    0x50, 0xE5, 0x92, 0xA8, 0x56, 0x2A, 0x61, 0xEB, 0x9D, 0x40, 0x3B, 0xE6, 0xB2, 0x49, 0x33, 0x9E,
-    0x3F, 0xEE, 0x9F, 0x37, 0x75, 0xAC, 0x91, 0x24, 0x8C, 0x45, 0x39, 0x24, 0x9D, 0x98, 0x16, 0x5A,
-    0x96, 0x75, 0xF8, 0xDE, 0x50, 0x38, 0x16, 0x43, 0x72, 0x3A, 0x52, 0xE1, 0x09, 0xFF, 0xBA, 0xC7,
-    0x52, 0x66, 0xF7, 0xD8, 0x73, 0x6C, 0xB0, 0x96, 0xBC, 0xA9, 0x9A, 0x52, 0xC8, 0x6C, 0xE4, 0xC1,
-    0xD4, 0x56, 0x52, 0xC2, 0x4E, 0x73, 0x44, 0x63, 0xEC, 0x2F, 0xC1, 0xCC, 0xF2, 0x1B, 0x3A, 0x8F,
-    0xEF, 0xD8, 0xA0, 0xA1, 0xF6, 0x87, 0x47, 0xB7, 0x51, 0x91, 0xE2, 0x61, 0xFF, 0xCD, 0xF2, 0xD3,
-    0xC0, 0x7A, 0x5A, 0xC7, 0x1E, 0xD7, 0xB1, 0xE7, 0x75, 0xEC, 0x81, 0x9D, 0x67, 0x9C, 0xD8, 0x19,
-    0x0A, 0x0C, 0xB6, 0xBC, 0x60, 0x8B, 0x0B, 0xB6, 0x48, 0x70, 0x86, 0x46, 0x8B, 0x09, 0x5A, 0x4A,
-    0x18, 0xFF, 0x3B, 0x73, 0x2F, 0xDA, 0x78, 0x9A, 0xC4, 0x67, 0xB7, 0xE7, 0xE4, 0xC7, 0x18, 0xA0,
-    0x1C, 0x32, 0xF8, 0x0A, 0xFD, 0x91, 0x24, 0xB4, 0xA0, 0xF8, 0xDE, 0x2F, 0x1B, 0x29, 0xB5, 0x55,
-    0x8B, 0xE7, 0xCA, 0x60, 0xE6, 0xE5, 0x88, 0x89, 0x3D, 0x32, 0xA3, 0xA5, 0x46, 0xCD, 0x85, 0x39,
-    0xCF, 0xA5, 0xF8, 0xAD, 0x73, 0x8C, 0xEE, 0x9D, 0xDF, 0x66, 0xBC, 0x94, 0x2C, 0x58, 0x5E, 0x16,
-    0x47, 0x2A, 0x04, 0xA3, 0xB1, 0x79, 0x01, 0x43, 0x85, 0x83, 0x32, 0xC8, 0x62, 0x27, 0x93, 0x63,
-    0x36, 0xDE, 0xD5, 0xC4, 0xD0, 0xEF, 0x00, 0xA5, 0x56, 0x3D, 0x8C, 0x1B, 0x45, 0x14, 0xFE, 0x76,
-    0x37, 0xBE, 0xBD, 0xF3, 0xC4, 0x5E, 0x17, 0x58, 0x39, 0x88, 0xE3, 0xBD, 0x22, 0xC5, 0x71, 0x9C,
-    0x6F, 0x53, 0xB8, 0x70, 0xE1, 0xF3, 0x4E, 0x84, 0xA8, 0x90, 0xC8, 0x4A, 0xC4, 0x55, 0x9A, 0x93,
-    0xA0, 0xE0, 0x27, 0x04, 0x17, 0x29, 0x12, 0x29, 0x67, 0xAF, 0x42, 0x0F, 0x16, 0x2D, 0x05, 0x16,
-    0x50, 0x9C, 0x0E, 0xA1, 0x18, 0x74, 0x48, 0x57, 0x9C, 0x6F, 0x87, 0x02, 0x21, 0xBA, 0x95, 0x88,
-    0x44, 0x81, 0x90, 0xA6, 0xA0, 0x08, 0x54, 0x5B, 0x58, 0xC8, 0xC0, 0xDA, 0xC3, 0x9B, 0x75, 0x2E,
-    0xF7, 0x13, 0xA0, 0x61, 0xFE, 0x3C, 0x6F, 0x76, 0xE6, 0xFD, 0x7E, 0xEF, 0xDD, 0xAD, 0xC1, 0x17,
-    0x4E, 0x6C, 0x25, 0xD8, 0xC7, 0x3A, 0x76, 0xCC, 0xD4, 0x4A, 0x1C, 0xE1, 0xA2, 0x01, 0xEC, 0xC0,
-    0x9A, 0xC1, 0x56, 0x70, 0x3E, 0x10, 0x2D, 0x4B, 0xDE, 0x46, 0xC7, 0xE0, 0x80, 0x3B, 0xB1, 0x79,
-    0x4B, 0x7D, 0x8C, 0xDB, 0xDE, 0x14, 0x25, 0xF3, 0x17, 0xBC, 0xB5, 0xDB, 0x57, 0x2A, 0x69, 0xB7,
-    0x83, 0x72, 0xBB, 0xCD, 0x15, 0x6D, 0x77, 0x77, 0x77, 0x07, 0x5B, 0xE8, 0xDF, 0x36, 0x62, 0xFF,
-    0x81, 0x70, 0x15, 0x37, 0x27, 0x28, 0x1D, 0x2A, 0xB5, 0xFA, 0x86, 0xD9, 0x9F, 0xDA, 0x09, 0x8D,
-    0x7B, 0x56, 0x6C, 0x70, 0x7F, 0x72, 0xB7, 0x5B, 0xF2, 0xD0, 0xB2, 0x52, 0x4B, 0x58, 0xA1, 0x01,
-    0x62, 0x3C, 0xEE, 0x8E, 0x12, 0x47, 0xF7, 0xEE, 0xC8, 0x1D, 0x03, 0xE6, 0x60, 0x0D, 0x2C, 0x89,
-    0xE0, 0x88, 0x14, 0x3E, 0x69, 0x77, 0xCF, 0x16, 0x18, 0x32, 0x20, 0xC0, 0x56, 0xD3, 0x94, 0xEE,
-    0xCB, 0x82, 0x29, 0x4E, 0xFA, 0x19, 0x29, 0x82, 0x44, 0x37, 0x94, 0xCE, 0xDD, 0xA9, 0x1D, 0x75,
-    0x60, 0xCD, 0x1C, 0xC0, 0x7F, 0x71, 0x9C, 0x3D, 0xB7, 0x64, 0x17, 0x46, 0xE2, 0x02, 0x0D, 0x3B,
-    0xC4, 0x00, 0xA4, 0x11, 0x8D, 0x60, 0x1C, 0x0C, 0x21, 0xB7, 0xED, 0xD8, 0x53, 0x21, 0x9B, 0x91,
-    0x02, 0x30, 0x77, 0x40, 0xFA, 0x92, 0xD6, 0x77, 0xCC, 0x98, 0x3E, 0x61, 0xCB, 0x96, 0x55, 0x34,
-    0x71, 0x07, 0x23, 0x44, 0x61, 0x24, 0x7C, 0x91, 0x07, 0xE3, 0x7E, 0xEC, 0x4B, 0x57, 0x5A, 0xD2,
-    0x8C, 0x2D, 0xF2, 0xD2, 0x3E, 0x38, 0xAA, 0xE8, 0x89, 0x48, 0x44, 0xFC, 0x80, 0x6E, 0x36, 0xE1,
-    0x70, 0x53, 0xA2, 0xF4, 0x4F, 0xF7, 0xD6, 0xB8, 0x27, 0x58, 0x6C, 0x6A, 0x3F, 0x57, 0xB0, 0x63,
-    0x4D, 0x6C, 0xE9, 0x84, 0x1B, 0xA8, 0x03, 0x7D, 0xC8, 0xB7, 0x65, 0x24, 0x0D, 0x49, 0x32, 0xB1,
-    0x85, 0x21, 0x0E, 0xFB, 0x91, 0xDC, 0xA3, 0x5F, 0xA0, 0xDC, 0x46, 0xA4, 0x78, 0xFB, 0x06, 0x27,
-    0xC9, 0xA7, 0x86, 0x01, 0xB3, 0xCF, 0x12, 0x36, 0x36, 0x13, 0x23, 0x31, 0x63, 0x8F, 0x13, 0x1B,
-    0x6F, 0x44, 0x5E, 0xE8, 0x92, 0x95, 0xE4, 0x51, 0xEA, 0x7E, 0xEA, 0xA7, 0xE5, 0xEB, 0x7E, 0xFA,
-    0xC2, 0x23, 0x4D, 0x99, 0xA1, 0x19, 0x5A, 0xE2, 0xC2, 0x43, 0x3F, 0xBD, 0xF0, 0x50, 0x53, 0xBD,
-    0x69, 0x34, 0x23, 0x57, 0x26, 0xF3, 0x7E, 0x35, 0x51, 0x52, 0x89, 0x67, 0x8F, 0x0F, 0x30, 0x2E,
-    0x45, 0x89, 0x9F, 0x2C, 0x70, 0x6C, 0x2B, 0xB5, 0x8D, 0x93, 0xB1, 0x5B, 0xE8, 0xFB, 0xE9, 0xFE,
-    0xC6, 0xB0, 0xB8, 0x57, 0x6D, 0x1D, 0x30, 0xE9, 0x0A, 0x37, 0xF4, 0xB0, 0x49, 0x86, 0x97, 0x48,
-    0x27, 0x8B, 0xDB, 0xD2, 0x4C, 0xB1, 0x4D, 0x07, 0xA3, 0x5E, 0xDA, 0x23, 0xE3, 0x5D, 0xDA, 0xDE,
-    0x23, 0x07, 0xF6, 0xE0, 0xCF, 0xD8, 0x74, 0xA0, 0x03, 0x35, 0x20, 0x84, 0x10, 0x50, 0x66, 0xED,
-    0x28, 0x81, 0x23, 0xC1, 0xFA, 0x58, 0xE8, 0x5C, 0x2E, 0x5C, 0x69, 0x54, 0x5A, 0xB3, 0x03, 0xF7,
-    0xA7, 0x84, 0xAC, 0x1E, 0x1B, 0xC9, 0xA6, 0x2D, 0xDC, 0x07, 0x9C, 0xE2, 0x62, 0xA5, 0x3A, 0xE4,
-    0xB4, 0xDA, 0x53, 0x38, 0x0A, 0x2D, 0x47, 0xEC, 0x9B, 0x92, 0xA3, 0x34, 0x87, 0x58, 0xEB, 0xF3,
-    0x0C, 0x62, 0x7F, 0x3C, 0x15, 0x3B, 0xC2, 0x93, 0x5C, 0xF0, 0xA7, 0xC5, 0x61, 0x34, 0x95, 0x8C,
-    0xD0, 0x04, 0x42, 0x28, 0x81, 0x93, 0xD0, 0xDA, 0xCE, 0x76, 0x73, 0x9C, 0xEA, 0xA9, 0x32, 0xF8,
-    0xB6, 0x03, 0x8D, 0x80, 0x93, 0x74, 0x8E, 0xC3, 0x1B, 0xB3, 0x9E, 0xBA, 0x95, 0xF8, 0x69, 0xB0,
-    0x20, 0xCB, 0xED, 0xEB, 0xF4, 0x85, 0x2E, 0x10, 0xCE, 0x09, 0xE9, 0x3D, 0x22, 0x54, 0xBC, 0x46,
-    0xF4, 0x6E, 0xA8, 0x5F, 0x52, 0xEA, 0x18, 0x53, 0x6D, 0x4E, 0xC4, 0xED, 0x09, 0xFC, 0x90, 0xCC,
-    0x9E, 0x37, 0x0D, 0x6D, 0x4B, 0x40, 0xC7, 0x0C, 0x0E, 0xED, 0xAB, 0x34, 0xF5, 0xB7, 0x26, 0xCD,
-    0x3D, 0x9A, 0x64, 0x2F, 0x05, 0x1E, 0x56, 0xFC, 0xBF, 0xAF, 0xED, 0xD3, 0x2C, 0x69, 0x91, 0x93,
-    0xAE, 0xE3, 0x38, 0xA3, 0x31, 0xF9, 0x95, 0xBC, 0x4B, 0x3E, 0x26, 0x4F, 0x3F, 0x51, 0x9D, 0xFB,
-    0x4A, 0x89, 0x06, 0xCC, 0x27, 0x53, 0xD3, 0x64, 0x46, 0xC8, 0x3E, 0x94, 0x9E, 0x4A, 0xEB, 0xCD,
-    0x4A, 0x67, 0xBD, 0x90, 0x29, 0xDE, 0x6C, 0x7A, 0x13, 0x26, 0x9D, 0xA4, 0x75, 0xB0, 0x7C, 0x99,
-    0x04, 0x0A, 0x8F, 0x37, 0x49, 0x94, 0x07, 0x27, 0xD4, 0x78, 0xF2, 0xC2, 0xE7, 0x71, 0xD2, 0x93,
-    0xC8, 0x5C, 0x7C, 0x4C, 0xFF, 0x1B, 0xD8, 0xCF, 0x78, 0x75, 0x09, 0x3E, 0xF7, 0x43, 0x16, 0x32,
-    0x5E, 0xC5, 0x0A, 0x99, 0xA4, 0x0B, 0x8C, 0xC0, 0xAA, 0xFB, 0x5D, 0xD8, 0x73, 0xAF, 0x89, 0xC8,
-    0x75, 0xC4, 0x66, 0x8D, 0x85, 0x58, 0x06, 0xDE, 0x24, 0x10, 0x8D, 0x70, 0xC8, 0x7B, 0xE2, 0x39,
-    0x3C, 0x0D, 0xA0, 0xFF, 0x0A, 0xE4, 0xE9, 0xBA, 0xD0, 0x0E, 0x22, 0x59, 0xD6, 0x99, 0x26, 0x29,
-    0xEF, 0x0C, 0xE4, 0xAE, 0xC1, 0x9B, 0x65, 0xFA, 0xF4, 0xD2, 0xE0, 0x77, 0x7D, 0x86, 0x55, 0x10,
-    0x80, 0xF5, 0x58, 0x25, 0xD6, 0x79, 0xC2, 0xD0, 0xD7, 0x51, 0x2A, 0x2F, 0x8E, 0xF1, 0x4C, 0x76,
-    0x78, 0xA8, 0x9D, 0x7D, 0xC6, 0x8A, 0x33, 0x24, 0xC9, 0x3F, 0x6F, 0xC1, 0x57, 0x22, 0x52, 0x72,
-    0xE3, 0x46, 0xB8, 0x68, 0xCE, 0x91, 0x60, 0x09, 0x27, 0x71, 0xC7, 0x76, 0x3C, 0xEF, 0x91, 0xF0,
-    0x26, 0xD6, 0x4C, 0xC5, 0xDE, 0xC4, 0x56, 0x1A, 0xF3, 0x70, 0x8E, 0xD6, 0x57, 0xBF, 0x85, 0x13,
-    0xE0, 0xAB, 0xF7, 0x91, 0x43, 0x11, 0xBA, 0x0A, 0x2C, 0xE9, 0xAA, 0xA0, 0xDD, 0xB3, 0x84, 0xA0,
-    0x03, 0x14, 0x73, 0x8F, 0x6F, 0x92, 0xAE, 0x96, 0x93, 0x10, 0x22, 0xEC, 0xC7, 0x6F, 0x07, 0xFA,
-    0x6B, 0x1E, 0xB4, 0x16, 0x8E, 0x5E, 0xCD, 0x39, 0xE0, 0xCB, 0x57, 0x34, 0x84, 0x5E, 0xFB, 0xFE,
-    0x58, 0x8A, 0x5E, 0x95, 0xD6, 0x41, 0xCD, 0x75, 0x58, 0x41, 0x0B, 0x6C, 0x6C, 0xA4, 0x6C, 0xE2,
-    0xEB, 0x62, 0x42, 0x71, 0xD8, 0x1E, 0x26, 0x7B, 0xAD, 0x3C, 0xED, 0x28, 0x0B, 0xA9, 0x46, 0x52,
-    0xA5, 0xDC, 0x33, 0x64, 0x90, 0x04, 0xF3, 0xF2, 0x89, 0xC1, 0x59, 0x8C, 0x2C, 0xE2, 0xC0, 0x95,
-    0x3E, 0xF7, 0x24, 0x95, 0xE4, 0x8A, 0xD6, 0xF7, 0x34, 0xC3, 0x80, 0x1C, 0x38, 0xD2, 0x08, 0xA2,
-    0x62, 0x6C, 0x4D, 0x22, 0xAA, 0xF7, 0x7F, 0xF1, 0xAE, 0xF9, 0x83, 0x18, 0x58, 0xDF, 0xC4, 0x98,
-    0x6C, 0x17, 0x9D, 0x6A, 0x3A, 0x38, 0x07, 0x1F, 0x3D, 0xDE, 0xE3, 0x1B, 0x5A, 0xDB, 0xCA, 0xA7,
-    0xDC, 0x7B, 0x10, 0x92, 0x28, 0x5A, 0x97, 0x3F, 0xE1, 0x74, 0x92, 0xBF, 0x3F, 0xF0, 0x55, 0xBA,
-    0xD7, 0xAC, 0x0E, 0x9B, 0x45, 0x1A, 0x5D, 0x35, 0x72, 0x7F, 0x1C, 0x6B, 0x1B, 0x2B, 0xD0, 0xD5,
-    0x8E, 0xFE, 0x66, 0x75, 0x70, 0xD4, 0x32, 0x1B, 0x0C, 0xA1, 0x13, 0x84, 0xB2, 0x85, 0x91, 0x97,
-    0x28, 0x7A, 0xC6, 0x2C, 0xC0, 0x0D, 0x7A, 0xE1, 0x11, 0x36, 0x74, 0xDA, 0xBE, 0xAB, 0xC8, 0x87,
-    0xD9, 0x1B, 0x23, 0xAE, 0xE9, 0x1F, 0x3B, 0x74, 0xF4, 0xF9, 0x06, 0xA8, 0xA4, 0x60, 0x81, 0xAC,
-    0xD4, 0x79, 0x4E, 0x6F, 0xCD, 0x48, 0x3D, 0xC2, 0xA9, 0xA6, 0xF3, 0x5F, 0xE9, 0xBC, 0x9A, 0x9D,
-    0x21, 0x0D, 0xF5, 0x2B, 0xD1, 0xD2, 0x51, 0xEA, 0x0F, 0x4A, 0xD7, 0x4D, 0x5C, 0x54, 0xB3, 0x28,
-    0xA4, 0x18, 0x5C, 0x54, 0x53, 0x68, 0x6C, 0x12, 0x58, 0x74, 0x5D, 0xD7, 0x2B, 0x9B, 0xBF, 0x8E,
-    0x7E, 0xDB, 0x8D, 0x24, 0x2C, 0xD2, 0x8B, 0x3C, 0xA7, 0x53, 0x00, 0x6E, 0x96, 0xD0, 0x84, 0x98,
-    0x95, 0x8C, 0x79, 0xF8, 0x44, 0xEA, 0x15, 0x2D, 0x26, 0x55, 0x19, 0xFA, 0xA9, 0xE9, 0x94, 0xC7,
-    0xFC, 0x4E, 0x7E, 0x50, 0x59, 0xC7, 0x7A, 0xFE, 0xA0, 0xB1, 0x5E, 0x5F, 0xDF, 0xFC, 0x22, 0x97,
-    0xAB, 0xC6, 0x9D, 0xCE, 0xA0, 0xF1, 0xE7, 0xBE, 0xA4, 0xF8, 0x6F, 0x76, 0x72, 0x7C, 0x59, 0xC7,
-    0x04, 0x37, 0x69, 0x3D, 0xEA, 0x35, 0xB4, 0xC1, 0x3E, 0x5B, 0x2F, 0xD4, 0x8B, 0x75, 0x56, 0x67,
-    0x8D, 0xE2, 0xA5, 0x9B, 0x46, 0x50, 0x63, 0xBC, 0x68, 0x1D, 0x8F, 0x3C, 0x15, 0xF4, 0x8F, 0x42,
-    0x04, 0x41, 0x5E, 0xD6, 0xEB, 0x1D, 0xE2, 0xD4, 0xA1, 0x5E, 0x7B, 0x9D, 0xFE, 0x0F, 0x78, 0x27,
-    0xC3, 0x58, 0x01, 0xEC, 0x67, 0x34, 0x6A, 0xE8, 0x14, 0x1E, 0x8F, 0xFA, 0x25, 0xD4, 0x6E, 0x21,
-    0xF7, 0x12, 0x31, 0xD7, 0xD0, 0xD3, 0x63, 0x04, 0xC7, 0x3E, 0xC5, 0xD4, 0xB5, 0xC2, 0xF2, 0x55,
-    0x5E, 0x1B, 0x75, 0xE1, 0xB0, 0xF7, 0xC2, 0x82, 0x6D, 0x8A, 0x93, 0xB3, 0x6A, 0xDF, 0x8F, 0xCB,
-    0x06, 0x0F, 0xEE, 0x8E, 0xAB, 0xF5, 0x63, 0x4D, 0xCB, 0x38, 0x47, 0xE9, 0x78, 0xC8, 0x1B, 0x38,
-    0xEA, 0x35, 0x4A, 0x8F, 0x91, 0xCB, 0x9B, 0x4B, 0xA8, 0x9C, 0x47, 0x61, 0x11, 0x6C, 0x05, 0xD6,
-    0x56, 0x56, 0x1F, 0x39, 0xBA, 0x1B, 0x28, 0x2C, 0xC3, 0xDE, 0xA2, 0xF2, 0x06, 0x73, 0x88, 0xC5,
-    0x06, 0x6E, 0x6E, 0xE0, 0x7A, 0x19, 0x7F, 0x03, 0xDD, 0x7D, 0x4D, 0xB0, 0xDC, 0xD6, 0x95, 0xDE,
-    0x45, 0x37, 0xF9, 0x90, 0x11, 0x62, 0x41, 0x0B, 0xC9, 0x56, 0xCC, 0x11, 0x7B, 0x16, 0x5A, 0xD8,
-    0x92, 0x48, 0x64, 0xE1, 0x05, 0x33, 0x79, 0x24, 0x20, 0x7B, 0xE9, 0xC5, 0x30, 0x55, 0x7A, 0xD2,
-    0x42, 0x0B, 0xCE, 0x32, 0x9E, 0x54, 0xFC, 0x66, 0xC1, 0xAA, 0x30, 0x2E, 0x52, 0x80, 0xAC, 0x4A,
-    0xBC, 0x48, 0xD5, 0xF8, 0xA5, 0x6A, 0x3C, 0x9B, 0x59, 0x98, 0x0B, 0xB9, 0xCA, 0x7E, 0x5C, 0x3C,
-    0x2D, 0x98, 0x1A, 0x26, 0x21, 0x1F, 0x20, 0x6B, 0xE1, 0x45, 0xAA, 0x32, 0x2D, 0x4F, 0x64, 0x2F,
-    0xB2, 0x18, 0xD8, 0xA6, 0xFF, 0xA4, 0xA4, 0x04, 0xD9, 0xAD, 0x08, 0x8F, 0x02, 0x70, 0x73, 0xBE,
-    0xEF, 0x5C, 0xA0, 0xBB, 0xDF, 0x0F, 0x49, 0x89, 0xA4, 0x48, 0x99, 0x52, 0x9F, 0x83, 0xD7, 0x8D,
-    0x9F, 0x7B, 0xCF, 0xBD, 0xF7, 0xDC, 0xF3, 0x0F, 0x63, 0xF0, 0x2F, 0xCE, 0x04, 0x4C, 0x0A, 0x01,
-    0x7E, 0x29, 0xC0, 0xAB, 0xF0, 0xE5, 0x79, 0x80, 0x43, 0x46, 0xFF, 0xE5, 0xD6, 0xDA, 0x62, 0x1D,
-    0x60, 0xDC, 0x98, 0xA0, 0x18, 0x35, 0x66, 0x0C, 0x30, 0x9A, 0xF6, 0xC0, 0x98, 0xDD, 0xA0, 0x5D,
-    0x7B, 0xCE, 0x8C, 0xAC, 0x6D, 0xDC, 0xD1, 0x7E, 0xA7, 0xF4, 0xE0, 0x2C, 0xC0, 0x65, 0x80, 0x19,
-    0xEE, 0x37, 0x7B, 0x51, 0x1E, 0x34, 0xC3, 0x23, 0x2B, 0x6D, 0xC0, 0x4B, 0x5E, 0x2D, 0x4D, 0xC0,
-    0xEF, 0xE9, 0x48, 0x8E, 0x1E, 0x35, 0xA7, 0xCD, 0xFC, 0xDF, 0xFD, 0x6A, 0x5A, 0x2C, 0xA0, 0x13,
-    0xDA, 0x09, 0xB2, 0xC6, 0x9C, 0x32, 0xDB, 0x26, 0x36, 0x66, 0x55, 0xD0, 0x44, 0x51, 0x68, 0xCC,
-    0x09, 0x45, 0x4F, 0x0A, 0x3A, 0x8C, 0xA6, 0x6E, 0x6B, 0x8B, 0x77, 0xA1, 0xC8, 0x4E, 0xB5, 0x1B,
-    0x78, 0x66, 0xBE, 0x31, 0xB2, 0xFA, 0x5B, 0x9E, 0x10, 0x61, 0x6C, 0x04, 0x45, 0xC5, 0xC1, 0xC8,
-    0x9D, 0x92, 0xCA, 0x75, 0x72, 0xAD, 0xB4, 0xE9, 0x73, 0xF6, 0x7F, 0x4D, 0x6A, 0x34, 0xAD, 0x89,
-    0x30, 0xB2, 0x2B, 0x17, 0x05, 0x84, 0x18, 0x59, 0xFE, 0x79, 0x0A, 0x4F, 0xAD, 0x31, 0xCE, 0x53,
-    0xB3, 0x8B, 0x8E, 0x59, 0x4F, 0xC7, 0xC9, 0x40, 0xC7, 0x39, 0xF0, 0x92, 0x9B, 0x52, 0xEA, 0xB6,
-    0xC1, 0x18, 0xE0, 0x45, 0xFB, 0xD7, 0x78, 0x64, 0xDD, 0x3F, 0xDD, 0x03, 0x2D, 0x27, 0x37, 0x84,
-    0x14, 0x79, 0x12, 0x56, 0x78, 0x64, 0xE5, 0x57, 0x02, 0xA4, 0xD9, 0xA3, 0x82, 0x53, 0x13, 0x9D,
-    0xD5, 0x99, 0xBA, 0x00, 0x30, 0x45, 0x04, 0x94, 0x8B, 0xDF, 0x0D, 0x27, 0x4F, 0xA6, 0x7D, 0xBF,
-    0x83, 0x99, 0x31, 0x8F, 0xE0, 0xB9, 0xAF, 0x19, 0x9B, 0xF9, 0xBC, 0xA4, 0x30, 0x3E, 0x1E, 0x69,
-    0x0E, 0x27, 0xDA, 0x80, 0xB4, 0x4B, 0xC6, 0x5D, 0x5E, 0x86, 0xD3, 0xF1, 0x2C, 0xCA, 0xBC, 0x3A,
-    0x4E, 0x4C, 0x2D, 0xE3, 0x79, 0x51, 0x30, 0x6F, 0x1B, 0xC9, 0x6D, 0xC2, 0x56, 0x1A, 0x8F, 0xC1,
-    0xCA, 0xE5, 0x60, 0x22, 0x77, 0x30, 0xB9, 0xAC, 0x94, 0xB0, 0xC1, 0x8C, 0x92, 0x3B, 0x74, 0xFF,
-    0x44, 0x86, 0x61, 0x55, 0x3E, 0x17, 0x8C, 0xB9, 0x26, 0x83, 0xD1, 0xC4, 0xD9, 0xA8, 0x0E, 0x77,
-    0xD6, 0xCB, 0x91, 0xED, 0x12, 0x3C, 0x27, 0xB7, 0xD5, 0xBA, 0xBD, 0x28, 0xCD, 0x18, 0x7D, 0xAC,
-    0xFF, 0xE5, 0xC2, 0x17, 0xED, 0x86, 0xDC, 0xC4, 0x98, 0xE4, 0xA5, 0x71, 0x99, 0xFB, 0xD5, 0x4B,
-    0x7E, 0xF5, 0xA8, 0x97, 0xF4, 0xC3, 0x77, 0x77, 0x6E, 0x1E, 0xC8, 0x6C, 0x5E, 0xB1, 0x37, 0x94,
-    0x8E, 0xD1, 0xBD, 0xFC, 0x08, 0x55, 0x41, 0x5D, 0x4C, 0x5B, 0x21, 0x5F, 0x24, 0x43, 0x94, 0x66,
-    0x98, 0x08, 0x58, 0x61, 0xF2, 0xDD, 0x96, 0xE0, 0xEB, 0x60, 0x49, 0x05, 0xA6, 0xB4, 0x50, 0xBE,
-    0xC0, 0x69, 0xB7, 0xC6, 0x7E, 0x36, 0xE0, 0xEE, 0x7B, 0x09, 0xB1, 0xB5, 0xAD, 0xFE, 0xBD, 0x96,
-    0x67, 0x26, 0x48, 0xE4, 0xF7, 0x49, 0xA9, 0x58, 0xE6, 0x42, 0x08, 0x3C, 0xAE, 0xB1, 0x50, 0x89,
-    0x27, 0xC4, 0x8D, 0x89, 0x1C, 0x3E, 0xE5, 0xBE, 0xBF, 0x4A, 0x0C, 0x2E, 0x20, 0x38, 0xAC, 0xA4,
-    0x8D, 0x5E, 0x2B, 0x44, 0x92, 0x29, 0x70, 0x04, 0x1C, 0x20, 0x2D, 0x30, 0xAB, 0xAE, 0x2F, 0x70,
-    0xCC, 0x2A, 0xC4, 0x63, 0x65, 0x50, 0x02, 0x4C, 0x73, 0xCC, 0x3E, 0x79, 0x3A, 0x97, 0x00, 0xBA,
-    0x4D, 0x6C, 0x3E, 0x02, 0xEE, 0x36, 0x37, 0xED, 0xDB, 0xAF, 0x82, 0x6F, 0xE1, 0x5F, 0xA6, 0xF7,
-    0x59, 0xAF, 0xF4, 0xF7, 0x71, 0xAD, 0xD8, 0x6B, 0xDC, 0xF9, 0xAD, 0xC3, 0xDD, 0x2E, 0xDC, 0x2E,
-    0x9F, 0x37, 0x6E, 0xD0, 0xAE, 0x54, 0xFA, 0x23, 0xA3, 0xBF, 0x82, 0xC5, 0x2F, 0xED, 0x9E, 0x58,
-    0xBB, 0x63, 0xEE, 0x3E, 0x7B, 0xAB, 0xC9, 0xDE, 0xFC, 0x56, 0x7F, 0x73, 0x5C, 0x2E, 0x55, 0x14,
-    0xDF, 0x06, 0x4A, 0x78, 0x91, 0x20, 0x61, 0x6F, 0x26, 0xBE, 0x0E, 0xF6, 0x66, 0x62, 0xDC, 0xED,
-    0x29, 0x25, 0x38, 0x61, 0xC3, 0xA9, 0xC0, 0x0D, 0xCC, 0x07, 0x0F, 0x30, 0x0F, 0x9B, 0xE5, 0x7F,
-    0x1C, 0x97, 0x29, 0x47, 0x25, 0x93, 0xBE, 0x7B, 0x3A, 0xFB, 0x2B, 0x40, 0xB9, 0x40, 0xE0, 0x84,
-    0x34, 0x3F, 0x49, 0x38, 0x03, 0x1C, 0x4F, 0x01, 0x03, 0x8C, 0x5D, 0xBB, 0x8E, 0x91, 0x10, 0xEA,
-    0xE3, 0x38, 0xE5, 0xF7, 0x61, 0x05, 0xE8, 0x83, 0x09, 0x34, 0xA3, 0x8E, 0x57, 0xD9, 0x04, 0x30,
-    0xD6, 0xBB, 0xF1, 0xCE, 0x41, 0xCD, 0xA7, 0x70, 0x3E, 0xC9, 0xCF, 0x42, 0x6B, 0x93, 0x5E, 0xC7,
-    0x4A, 0x0E, 0x9A, 0xBE, 0x5D, 0x23, 0x77, 0xD4, 0x29, 0x8A, 0x15, 0x85, 0x99, 0xFE, 0xE8, 0x38,
-    0x75, 0xB2, 0xD4, 0x8F, 0xB1, 0xB5, 0x89, 0x74, 0x04, 0xEC, 0x05, 0xF7, 0xD5, 0x47, 0x99, 0x70,
-    0xBA, 0x88, 0x62, 0x45, 0x39, 0xD1, 0xE8, 0x5D, 0xA2, 0xE0, 0xDB, 0x44, 0x13, 0x3D, 0xE5, 0xBC,
-    0xA2, 0x8A, 0x68, 0x5C, 0x10, 0x85, 0x09, 0xD1, 0x49, 0xBD, 0xCB, 0x15, 0xA2, 0xAE, 0x24, 0x92,
-    0xBE, 0x13, 0xED, 0x7E, 0x90, 0x20, 0x34, 0x42, 0xD8, 0xAD, 0xF4, 0xCE, 0xCB, 0x77, 0x5C, 0x03,
-    0x33, 0xD9, 0x36, 0xC0, 0xA2, 0xC2, 0x02, 0xA2, 0x45, 0x38, 0x0D, 0x04, 0x06, 0x3B, 0x20, 0x1D,
-    0x39, 0xFE, 0xE2, 0x3F, 0x6B, 0xA7, 0xA1, 0x2D, 0x73, 0x9B, 0x3D, 0x64, 0x4B, 0xD0, 0xE5, 0x25,
-    0xDE, 0xF0, 0x3C, 0xEF, 0x7E, 0x85, 0x84, 0xA9, 0x30, 0xCA, 0x5E, 0x09, 0x8E, 0x0C, 0x8A, 0x44,
-    0x85, 0xAC, 0x79, 0xE1, 0xF2, 0x3E, 0xEE, 0x5F, 0x85, 0x18, 0xF2, 0xD9, 0x51, 0x6E, 0x30, 0xCF,
-    0x60, 0x47, 0x69, 0x57, 0x79, 0xD7, 0xB3, 0xE4, 0xEE, 0x9C, 0x11, 0x31, 0xF6, 0x02, 0x15, 0x74,
-    0x1C, 0x65, 0x43, 0x52, 0x34, 0x02, 0xD8, 0xE4, 0x00, 0xE4, 0xF5, 0xFC, 0xC4, 0xC3, 0x8E, 0xCE,
-    0x81, 0xED, 0x84, 0xCC, 0xC2, 0x14, 0xD1, 0x9E, 0x18, 0x5B, 0xA1, 0x3C, 0x9A, 0x30, 0xBB, 0xC7,
-    0x10, 0x5B, 0xB1, 0x40, 0x08, 0x1D, 0xF6, 0xFD, 0xDC, 0xEA, 0x5A, 0x8C, 0xD8, 0xD0, 0x50, 0xE7,
-    0x38, 0x1B, 0x3A, 0x9E, 0x3A, 0x06, 0x38, 0x40, 0x9D, 0x29, 0x01, 0xBF, 0x0F, 0xB5, 0xD7, 0x3C,
-    0x1F, 0x5C, 0x56, 0x56, 0x33, 0x3B, 0x79, 0x8E, 0xF7, 0x99, 0x91, 0x59, 0x56, 0x58, 0x3D, 0xA3,
-    0x32, 0xE6, 0x0D, 0xB0, 0xDF, 0xF9, 0xDC, 0x74, 0x03, 0xCC, 0x03, 0x59, 0xE3, 0xB8, 0xC5, 0x51,
-    0x30, 0x4B, 0x13, 0x6F, 0x5E, 0x9A, 0x91, 0x2B, 0x70, 0x50, 0x64, 0xF5, 0x60, 0x50, 0x5A, 0x8A,
-    0x8C, 0x39, 0xA7, 0x69, 0xCA, 0x16, 0xC4, 0x19, 0x9E, 0x1D, 0x17, 0xEB, 0x3B, 0xE6, 0xB0, 0x9D,
-    0x49, 0xAB, 0x85, 0x86, 0x83, 0x80, 0x81, 0x75, 0x37, 0x41, 0x07, 0xFD, 0x6C, 0x49, 0xC0, 0xD8,
-    0x2B, 0x2E, 0x58, 0x59, 0x28, 0x23, 0xF0, 0x21, 0xF9, 0x33, 0xC7, 0x29, 0x61, 0x89, 0xF9, 0x0B,
-    0xA6, 0xE7, 0x13, 0xCC, 0x06, 0x50, 0xF5, 0x3F, 0xF0, 0x94, 0x14, 0x34, 0xEB, 0xC0, 0x75, 0x4A,
-    0x01, 0xDD, 0x86, 0xB0, 0x61, 0xF9, 0x53, 0x9E, 0x9B, 0xE3, 0x91, 0x93, 0x69, 0x7F, 0x1E, 0x45,
-    0x8D, 0x70, 0xB8, 0x2C, 0xC4, 0x0F, 0x32, 0xB9, 0xDA, 0xE7, 0x5B, 0x3C, 0x57, 0x56, 0x6D, 0xFB,
-    0x3C, 0xAF, 0xE0, 0xAF, 0x7C, 0x06, 0x39, 0xED, 0xB8, 0x59, 0x06, 0x35, 0x7F, 0x45, 0xB7, 0x4A,
-    0x8C, 0x55, 0x96, 0x63, 0x27, 0xB8, 0x6F, 0x02, 0x15, 0xA6, 0x49, 0xCB, 0xFD, 0xB3, 0xC6, 0xD4,
-    0x90, 0xE1, 0x04, 0x4C, 0x30, 0x3C, 0x31, 0x27, 0xC8, 0xCD, 0x60, 0x06, 0xE8, 0x2B, 0x4C, 0x00,
-    0x03, 0x32, 0xA3, 0x70, 0x01, 0x1E, 0x35, 0xBA, 0x17, 0xCC, 0xE1, 0x15, 0x42, 0x4C, 0x0F, 0x99,
-    0x44, 0x80, 0x29, 0xDB, 0xC0, 0x19, 0xDB, 0x71, 0xD7, 0xEB, 0xB8, 0x1D, 0x6C, 0x5F, 0xE5, 0xF4,
-    0xBB, 0x02, 0x78, 0xFC, 0x32, 0xE0, 0xD1, 0xD7, 0xC8, 0xA4, 0x1F, 0xA1, 0xB2, 0x71, 0xBF, 0x44,
-    0xF9, 0xD0, 0x16, 0x29, 0xB6, 0xBD, 0x2C, 0xC0, 0x80, 0x95, 0x47, 0x84, 0x81, 0x77, 0xE4, 0xD6,
-    0x33, 0xF0, 0x06, 0x8F, 0x3B, 0x83, 0x30, 0x0C, 0x39, 0x00, 0xBF, 0x18, 0x4F, 0xE5, 0xE0, 0x38,
-    0xF5, 0x24, 0x39, 0xA0, 0x9A, 0x74, 0x45, 0x0E, 0xB8, 0xBE, 0x4E, 0x7A, 0x8D, 0x2E, 0xC6, 0xD0,
-    0xE3, 0x8E, 0x21, 0xE4, 0xFB, 0x49, 0x7B, 0x86, 0x8B, 0x31, 0x44, 0xBF, 0xC8, 0x5C, 0x7E, 0xD2,
-    0xAE, 0x73, 0x49, 0xA6, 0xCF, 0x36, 0xBA, 0x8A, 0xAD, 0xC7, 0x6D, 0x58, 0x06, 0x52, 0xF6, 0x65,
-    0xAC, 0x47, 0xBF, 0x96, 0x1B, 0x5A, 0xAE, 0x72, 0x0F, 0x93, 0x59, 0x9A, 0x81, 0x87, 0x46, 0x58,
-    0x5F, 0x6C, 0x46, 0x85, 0xBD, 0x10, 0x0D, 0xE3, 0xAE, 0x02, 0x42, 0x75, 0x26, 0xAA, 0x45, 0x12,
-    0xD9, 0x30, 0x76, 0x9A, 0x6E, 0x80, 0x6B, 0x99, 0xA8, 0x52, 0xC9, 0x3A, 0x97, 0xEE, 0x84, 0xDD,
-    0xD6, 0x4C, 0x2E, 0x97, 0x9B, 0xCB, 0x3C, 0xB0, 0x18, 0xAC, 0x1C, 0xC3, 0x98, 0x0E, 0x1B, 0x27,
-    0x01, 0x1E, 0x8D, 0x3E, 0x1F, 0x5E, 0xC7, 0x13, 0x45, 0x68, 0x35, 0x87, 0xB7, 0x66, 0xC6, 0x89,
-    0xB7, 0x7A, 0xCA, 0x5C, 0xC4, 0x8E, 0x8B, 0x93, 0xF8, 0xF3, 0x25, 0x80, 0x14, 0xB7, 0x8A, 0x0B,
-    0xAF, 0x33, 0x93, 0x9D, 0xF5, 0xDA, 0xED, 0x90, 0x87, 0x4F, 0x7F, 0x8A, 0x76, 0x29, 0x73, 0x9A,
-    0x82, 0xF4, 0xB8, 0x1C, 0x81, 0x6A, 0xB2, 0x96, 0xD1, 0xEF, 0x71, 0xB7, 0x5E, 0xE9, 0x1E, 0x90,
-    0x99, 0xBD, 0x62, 0xC4, 0xA7, 0xA2, 0x63, 0x0F, 0x9A, 0xB8, 0x43, 0xF1, 0xBE, 0x21, 0x73, 0xFA,
-    0x0D, 0x5A, 0x90, 0x26, 0x60, 0x3C, 0xA9, 0x39, 0x10, 0x0A, 0x2B, 0xDA, 0x17, 0x8A, 0xF8, 0x3E,
-    0xC0, 0x50, 0x21, 0xE7, 0xF3, 0x84, 0x30, 0x22, 0x3C, 0x45, 0x78, 0x15, 0x90, 0xC6, 0x03, 0x03,
-    0xC5, 0x22, 0x87, 0xD6, 0xF6, 0x59, 0x7B, 0x5D, 0x56, 0x55, 0x64, 0x9B, 0x43, 0x6E, 0x34, 0x21,
-    0x42, 0x80, 0x4E, 0x50, 0xF5, 0xEC, 0xC6, 0x18, 0x2B, 0x35, 0xAE, 0x39, 0x62, 0xE6, 0x5F, 0xCE,
-    0x04, 0xCB, 0x82, 0xFD, 0x3B, 0xC1, 0xBF, 0x96, 0xEE, 0xFF, 0x5E, 0xF0, 0x2F, 0x44, 0xFA, 0x97,
-    0xCF, 0xE8, 0xE7, 0x42, 0xCF, 0x37, 0x04, 0xFF, 0x4C, 0xBA, 0x0B, 0x5C, 0x76, 0xC6, 0x7F, 0x05,
-    0x38, 0x37, 0xE1, 0x18, 0x38, 0x4E, 0x1C, 0xCE, 0x8E, 0x11, 0x47, 0xC5, 0x2A, 0x71, 0x38, 0x3D,
-    0xA1, 0xB8, 0xBA, 0x4C, 0xEC, 0x57, 0x15, 0xF1, 0xF8, 0xFD, 0x92, 0x78, 0xD4, 0x15, 0xC4, 0x9E,
-    0x55, 0x2C, 0x7A, 0x2B, 0x70, 0x25, 0xCD, 0x17, 0x5D, 0xE4, 0x45, 0x91, 0xCF, 0xB1, 0x40, 0x73,
-    0x2B, 0x23, 0x97, 0x43, 0x68, 0xAA, 0x7C, 0xD9, 0x64, 0x29, 0xA5, 0x70, 0x9B, 0x03, 0xAB, 0x40,
-    0x97, 0x27, 0xC5, 0x47, 0x41, 0xED, 0xDA, 0x9A, 0xAC, 0x7C, 0x6A, 0x18, 0xF3, 0xBF, 0x3E, 0xF2,
-    0x5D, 0x14, 0xB9, 0x46, 0xCC, 0x67, 0x23, 0x1A, 0xD8, 0xCB, 0xBA, 0x50, 0x8C, 0x4C, 0x74, 0x43,
-    0x96, 0x85, 0x30, 0x5A, 0xBF, 0x46, 0x97, 0x70, 0x50, 0x51, 0x15, 0x81, 0xE0, 0x90, 0x4D, 0xA8,
-    0x25, 0x46, 0x94, 0xEF, 0xC0, 0x6E, 0xC2, 0x12, 0x9C, 0xC7, 0xC1, 0xEA, 0x00, 0x58, 0xEA, 0x99,
-    0x7A, 0x15, 0xEE, 0x30, 0x29, 0xF4, 0x6E, 0x41, 0xA5, 0x4A, 0x12, 0xA5, 0xC8, 0x8E, 0x07, 0xF1,
-    0x2F, 0xC1, 0x84, 0xD5, 0x06, 0x40, 0x23, 0x80, 0x6E, 0x56, 0xD8, 0x7D, 0x54, 0xD0, 0x8B, 0x3E,
-    0x49, 0x41, 0x2F, 0x53, 0xD1, 0x52, 0xA8, 0x75, 0x18, 0x82, 0x9E, 0xAC, 0x59, 0xDB, 0x8B, 0x2D,
-    0x90, 0x31, 0xBC, 0x1C, 0xA2, 0x42, 0x54, 0x2C, 0x89, 0x2D, 0xC1, 0x32, 0x58, 0x10, 0x60, 0xE4,
-    0x3C, 0xCF, 0x3A, 0x01, 0xA6, 0xDB, 0x4C, 0xEE, 0xC0, 0x1E, 0x23, 0x23, 0x94, 0xE3, 0x69, 0xF5,
-    0x41, 0xF6, 0x98, 0xFD, 0x8C, 0x32, 0xBB, 0xC0, 0x47, 0xB6, 0xC7, 0x50, 0xF5, 0xA4, 0xE2, 0x79,
-    0x0A, 0xDB, 0xCA, 0xAA, 0x80, 0x09, 0x40, 0x78, 0x02, 0xE0, 0x49, 0x01, 0x87, 0xDD, 0xD6, 0x75,
-    0xC7, 0x00, 0x46, 0xB6, 0xCF, 0xC2, 0xCC, 0x10, 0xCB, 0xC3, 0x1F, 0x4C, 0x05, 0xC4, 0x98, 0xC7,
-    0xD6, 0x68, 0xEF, 0x4C, 0x2D, 0xEF, 0x31, 0x56, 0xB5, 0xC9, 0x6B, 0xDC, 0xE6, 0xBE, 0x83, 0xEB,
-    0x6D, 0x27, 0x82, 0xAE, 0xD7, 0x79, 0xE0, 0xCC, 0xFE, 0x4C, 0x7E, 0x93, 0x51, 0x2B, 0x3D, 0x4C,
-    0x85, 0xA8, 0xF0, 0x20, 0xF0, 0xC6, 0x14, 0x1B, 0x84, 0x1D, 0x51, 0x7A, 0x48, 0x97, 0x90, 0xFB,
-    0xD2, 0x9D, 0xE2, 0x2E, 0xD0, 0xCB, 0x33, 0x77, 0x33, 0x77, 0x6B, 0x90, 0x49, 0x1E, 0xD4, 0x3F,
-    0xD6, 0x35, 0x02, 0x9C, 0x7E, 0xA1, 0x81, 0x7F, 0xB1, 0x79, 0x11, 0x27, 0x96, 0x22, 0x55, 0x89,
-    0xEE, 0x2F, 0xFB, 0x8E, 0xEC, 0x56, 0x30, 0xE0, 0x5A, 0xCA, 0x86, 0x69, 0x36, 0xE6, 0xD2, 0x0E,
-    0x49, 0xB3, 0xA3, 0xA4, 0xD9, 0x2A, 0x69, 0x46, 0xD5, 0xC4, 0xB2, 0xE3, 0xB9, 0x0A, 0x4A, 0x84,
-    0x51, 0x39, 0xA7, 0xDF, 0x07, 0x9C, 0xB4, 0x6F, 0x52, 0x44, 0x2A, 0x28, 0x1F, 0x71, 0x8E, 0x9D,
-    0xA4, 0x64, 0x74, 0x9E, 0x62, 0xD1, 0x8C, 0xFC, 0xA4, 0x42, 0x9B, 0x44, 0xF9, 0x38, 0x02, 0x9B,
-    0x56, 0x12, 0xDB, 0x4A, 0xD5, 0x38, 0xE5, 0x90, 0x37, 0x8C, 0xAE, 0x36, 0xA3, 0x0B, 0x5C, 0x51,
-    0xF6, 0x89, 0xA3, 0xB1, 0xA2, 0x17, 0x55, 0xAD, 0xEB, 0xB5, 0x3B, 0xAE, 0xBD, 0x25, 0x1B, 0xC0,
-    0xC4, 0x99, 0x02, 0x96, 0x50, 0xE0, 0x96, 0xA9, 0x10, 0x7D, 0x26, 0x1D, 0x8B, 0x6C, 0x29, 0xFD,
-    0xC2, 0x86, 0x2C, 0xDD, 0xD2, 0x5E, 0xE9, 0xDD, 0x0F, 0x82, 0xED, 0x02, 0xB4, 0x84, 0xB2, 0xBF,
-    0x8B, 0xA4, 0x1E, 0x41, 0x69, 0xC1, 0x52, 0x5C, 0x17, 0xBA, 0x3E, 0x96, 0xD0, 0x60, 0x6C, 0x6E,
-    0x0E, 0x39, 0x4C, 0xC2, 0xB6, 0x54, 0xC6, 0x15, 0x42, 0xA7, 0xB6, 0xB0, 0x94, 0x39, 0xD6, 0x21,
-    0x7F, 0x6C, 0x8C, 0x69, 0x5D, 0xF4, 0x55, 0x26, 0xA8, 0x21, 0x60, 0x3E, 0xE8, 0x07, 0xB5, 0x1B,
-    0x14, 0x8B, 0x1D, 0x56, 0xFF, 0x4D, 0xFF, 0x10, 0xFA, 0x35, 0xEB, 0xFB, 0x85, 0xEE, 0xE8, 0xBF,
-    0xD2, 0xF1, 0xFB, 0xA8, 0x3F, 0xF0, 0xFB, 0x83, 0x71, 0x7F, 0x30, 0xEA, 0x0F, 0xBC, 0xFE, 0xC0,
-    0x0C, 0x07, 0x09, 0x2D, 0xF0, 0x6A, 0x82, 0x17, 0x71, 0x0B, 0xAC, 0x69, 0x95, 0x36, 0x38, 0x85,
-    0x27, 0x08, 0x9F, 0x54, 0xAB, 0xDC, 0x12, 0xA4, 0x69, 0x56, 0x0D, 0xB3, 0xA6, 0x5D, 0x83, 0xD8,
-    0xD5, 0x70, 0x7F, 0xC0, 0x66, 0x06, 0xE8, 0xCF, 0x00, 0xB1, 0x51, 0xEF, 0x82, 0xFC, 0x5E, 0xB6,
-    0x0C, 0xF2, 0x2A, 0xA3, 0xDA, 0xD1, 0x11, 0x9A, 0x2A, 0x53, 0x55, 0xF6, 0x2B, 0xE3, 0x44, 0x21,
-    0x43, 0x59, 0x88, 0x92, 0x86, 0x0A, 0x43, 0xBD, 0x74, 0x72, 0x5B, 0xB8, 0xFB, 0x9E, 0x62, 0x6C,
-    0xA2, 0x94, 0x8D, 0x9E, 0xB7, 0x89, 0xFE, 0x1E, 0x15, 0x8A, 0xC3, 0x52, 0x71, 0x50, 0x29, 0xF6,
-    0x7B, 0x3C, 0xDB, 0x85, 0xAB, 0xE5, 0xF3, 0xC2, 0xA9, 0xE2, 0x34, 0x93, 0x55, 0x0A, 0x33, 0x85,
-    0x0A, 0x48, 0x76, 0x23, 0x20, 0x1B, 0xA8, 0x68, 0x33, 0x76, 0x4C, 0xF5, 0x16, 0xDA, 0x3F, 0x1A,
-    0xD9, 0xDB, 0x29, 0xEC, 0xB2, 0x88, 0x70, 0x0B, 0x23, 0xC9, 0x94, 0x0D, 0xE8, 0x8D, 0x24, 0x1B,
-    0x6E, 0x80, 0xF3, 0x0E, 0xAA, 0xA2, 0xC8, 0xC7, 0xB4, 0x3C, 0xF5, 0xAA, 0x62, 0x9C, 0x1D, 0xDD,
-    0xB3, 0x83, 0x53, 0x71, 0x15, 0x70, 0x78, 0xED, 0x4C, 0x05, 0xA6, 0xE1, 0x8E, 0x0C, 0x87, 0xCF,
-    0xFD, 0x5A, 0xF6, 0x60, 0x02, 0x55, 0x31, 0x2A, 0xA0, 0x2A, 0x26, 0x29, 0x36, 0x52, 0x1A, 0xD1,
-    0x44, 0x55, 0x14, 0x61, 0xC2, 0x52, 0xCD, 0x5C, 0x36, 0x6C, 0xCA, 0x0D, 0x33, 0x43, 0xD5, 0x6A,
-    0xAB, 0xC6, 0x1A, 0x93, 0x9B, 0xE4, 0xD4, 0x31, 0x32, 0x95, 0x97, 0x20, 0xEC, 0xA3, 0x03, 0xB0,
-    0xEA, 0x4B, 0x6F, 0xB0, 0x0B, 0xC1, 0x30, 0x0F, 0x9A, 0xC0, 0x14, 0x03, 0xC6, 0x0A, 0xBB, 0x0C,
-    0x66, 0x8C, 0x7C, 0xDB, 0xBE, 0xA0, 0x98, 0x16, 0x68, 0xFC, 0xFD, 0xA2, 0xE2, 0xFE, 0xF7, 0x39,
-    0x56, 0xAD, 0x66, 0xB8, 0x4F, 0x7F, 0xDF, 0xFE, 0x39, 0xD0, 0x80, 0x55, 0xC0, 0x4A, 0xA4, 0x4B,
-    0x68, 0xD7, 0x54, 0x9A, 0x22, 0x32, 0xDB, 0xB8, 0x7B, 0xB1, 0x61, 0xBB, 0x53, 0xEB, 0x0C, 0xB5,
-    0xDC, 0xB0, 0x3F, 0x2F, 0xEB, 0x0C, 0x93, 0x51, 0xC8, 0x3B, 0x99, 0x71, 0xCB, 0x81, 0x0C, 0x0F,
-    0x09, 0x7E, 0x46, 0x29, 0x74, 0x17, 0xB4, 0x66, 0xFE, 0xAB, 0x9E, 0x29, 0x57, 0xCD, 0x38, 0xC0,
-    0x33, 0xD2, 0x45, 0xA0, 0xD7, 0xE1, 0x9B, 0x71, 0x03, 0xE8, 0xF3, 0xD7, 0x90, 0xAA, 0x6A, 0x04,
-    0x2D, 0x01, 0x7B, 0x6B, 0x7F, 0x9F, 0x91, 0xFA, 0x32, 0x6A, 0xB3, 0xDE, 0x25, 0xA2, 0x84, 0xF6,
-    0x0B, 0x9D, 0x62, 0x5D, 0xB0, 0x23, 0x72, 0x3D, 0x4D, 0xB1, 0x61, 0x21, 0x3B, 0xA5, 0x5F, 0xD0,
-    0x5E, 0x3E, 0x00, 0xEF, 0x85, 0x0A, 0x5E, 0x98, 0xCA, 0x84, 0x3B, 0xF2, 0xA7, 0xB4, 0xA4, 0x82,
-    0x51, 0x6F, 0x00, 0x7E, 0x45, 0x7F, 0x81, 0xFC, 0x70, 0x7C, 0x66, 0x26, 0xF6, 0xBD, 0x56, 0xBA,
-    0xF8, 0xBA, 0xE8, 0x4F, 0x8F, 0x3A, 0x6E, 0x01, 0xB0, 0x4E, 0x11, 0x01, 0x72, 0x49, 0x4B, 0xBB,
-    0xAE, 0x08, 0x2D, 0x32, 0xC2, 0x41, 0xD9, 0x0B, 0x3C, 0x47, 0x41, 0xA0, 0x67, 0x26, 0xF2, 0xC3,
-    0x2A, 0x46, 0xE3, 0x4F, 0x4B, 0x03, 0x57, 0x8A, 0xDC, 0x37, 0xCD, 0x30, 0x45, 0x12, 0x19, 0x66,
-    0x28, 0x71, 0x05, 0xF4, 0x39, 0x05, 0xB1, 0x03, 0x51, 0x11, 0xE3, 0xD7, 0x09, 0xCE, 0x0B, 0x71,
-    0x85, 0x8F, 0x6B, 0xBD, 0xF6, 0x45, 0x10, 0x81, 0x6A, 0x3A, 0xAD, 0x0E, 0xF2, 0xB8, 0x75, 0x74,
-    0x81, 0xC3, 0x27, 0xE4, 0x68, 0x97, 0x01, 0xBE, 0x83, 0x38, 0x2B, 0x1A, 0xBC, 0x19, 0xDF, 0xD8,
-    0x9A, 0xC9, 0x9F, 0x1E, 0x7F, 0x48, 0x01, 0xE2, 0x01, 0xA4, 0x7A, 0xC5, 0x7A, 0x27, 0xF3, 0x90,
-    0xCB, 0x44, 0x40, 0x85, 0x1B, 0xCB, 0x7D, 0x41, 0xF7, 0xFE, 0xF3, 0x1A, 0x47, 0xE5, 0x56, 0x1F,
-    0x99, 0x66, 0xEB, 0xDD, 0x69, 0x4E, 0x94, 0x31, 0xB4, 0xE0, 0x11, 0x9D, 0x22, 0x13, 0x6C, 0xA3,
-    0x0F, 0x9B, 0x28, 0x59, 0x00, 0x4F, 0x0C, 0xE0, 0x19, 0x80, 0xD5, 0x01, 0x9C, 0x00, 0xB8, 0x0C,
-    0x20, 0x8B, 0x24, 0xF1, 0x00, 0x44, 0x5F, 0x8F, 0x92, 0xF5, 0xB7, 0x37, 0xF3, 0xDF, 0xE6, 0xB4,
-    0xB9, 0x25, 0x42, 0x8D, 0x6B, 0x42, 0x87, 0x0B, 0xB0, 0xB5, 0x9D, 0x84, 0xA9, 0xED, 0x18, 0x2C,
-    0x6D, 0x4F, 0xC0, 0xD0, 0xF6, 0x84, 0x73, 0x75, 0x42, 0xB5, 0x2F, 0x82, 0x29, 0x38, 0xD3, 0xA8,
-    0x86, 0xF8, 0x07, 0xCF, 0x50, 0x8A, 0xCF, 0xDA, 0x5A, 0x2B, 0x7C, 0xB4, 0x13, 0xFC, 0x5C, 0xEA,
-    0x84, 0xE4, 0xDE, 0x05, 0x2A, 0x5C, 0xEB, 0x71, 0x11, 0xDC, 0xAF, 0x8C, 0x2C, 0x67, 0x7A, 0x66,
-    0x3C, 0xE9, 0x4B, 0x13, 0xD9, 0x1F, 0xCA, 0xCE, 0x58, 0x1F, 0xB1, 0x2F, 0xDB, 0x92, 0x8B, 0x44,
-    0x56, 0x39, 0x8C, 0x56, 0xF2, 0xE0, 0xF3, 0x5E, 0x83, 0x2D, 0xE3, 0xB8, 0xD7, 0x40, 0xE4, 0x0B,
-    0x9F, 0x6D, 0x20, 0xB4, 0x8C, 0x5F, 0x6F, 0x28, 0xF4, 0xA9, 0xB0, 0x13, 0x7E, 0x48, 0xF3, 0x60,
-    0xF4, 0x7A, 0x03, 0xA1, 0x38, 0x56, 0x83, 0x58, 0xEE, 0x61, 0x7E, 0x7B, 0x8D, 0xA7, 0xB6, 0x55,
-    0xB9, 0x59, 0xA7, 0x5C, 0x2B, 0x4F, 0xD2, 0xE9, 0x11, 0x11, 0xE7, 0xAE, 0x77, 0x89, 0x48, 0x96,
-    0x3E, 0x25, 0xE5, 0x40, 0x96, 0x45, 0xFC, 0xAB, 0x0E, 0xFE, 0xA9, 0xE4, 0xAA, 0x4C, 0x8F, 0x55,
-    0x8A, 0xD7, 0x74, 0x2E, 0x1A, 0xE8, 0xFE, 0x1E, 0x66, 0xFE, 0xA5, 0xD6, 0xF5, 0x23, 0x44, 0x43,
-    0xA6, 0x27, 0xE4, 0x73, 0x55, 0x3E, 0x2D, 0xA6, 0xD8, 0x77, 0x72, 0x99, 0xC5, 0x72, 0xAB, 0xC7,
-    0x68, 0xE7, 0xC1, 0xD6, 0x21, 0xBB, 0x3E, 0x75, 0x44, 0x61, 0x3B, 0xD2, 0x0E, 0x58, 0x56, 0x7A,
-    0x18, 0x03, 0x7A, 0x98, 0xCF, 0x33, 0xFF, 0xEF, 0x01, 0x27, 0xFC, 0xFE, 0x2A, 0xE0, 0xFF, 0x83,
-    0x09, 0x67, 0x6C, 0x33, 0xC0, 0x8E, 0xE7, 0xD7, 0x0B, 0xD7, 0xF2, 0x6E, 0x72, 0xE7, 0x74, 0xC7,
-    0x3D, 0x45, 0xC6, 0xE2, 0x04, 0x9D, 0xF1, 0x31, 0x25, 0x3D, 0x98, 0x47, 0xA3, 0x77, 0xC0, 0xD4,
-    0xBD, 0xED, 0x8D, 0xDD, 0xA6, 0xA6, 0x4F, 0xAE, 0x55, 0xB9, 0x7D, 0x45, 0x26, 0x78, 0xF7, 0x65,
-    0x5B, 0xCA, 0x6F, 0xDB, 0x38, 0x0D, 0x6B, 0x63, 0x84, 0x47, 0xFA, 0x19, 0xEE, 0x8C, 0xA9, 0xBC,
-    0x0A, 0x37, 0x38, 0x7C, 0xE1, 0x9D, 0xC5, 0x9F, 0xB2, 0x70, 0xE5, 0x07, 0xDC, 0x33, 0xC0, 0x82,
-    0x83, 0x58, 0x34, 0xF3, 0xD8, 0xD4, 0x3C, 0x91, 0x7B, 0x47, 0xD7, 0xE5, 0xD6, 0x7E, 0xBD, 0x34,
-    0xE3, 0x63, 0xCC, 0xF8, 0x38, 0x59, 0x00, 0x47, 0x07, 0xF0, 0x04, 0xC0, 0x31, 0x80, 0x67, 0x00,
-    0x56, 0x07, 0x70, 0x45, 0x80, 0x27, 0xBD, 0x4D, 0xB6, 0xC0, 0x7C, 0xEC, 0xD4, 0xB3, 0xD7, 0xD3,
-    0xCC, 0x77, 0x26, 0x1C, 0xB8, 0xE4, 0x7D, 0x18, 0x8F, 0x21, 0x84, 0x66, 0x63, 0x41, 0xC2, 0xFB,
-    0xA4, 0xDF, 0x26, 0x96, 0x0E, 0xBC, 0x5B, 0xC0, 0x88, 0x33, 0x16, 0xDA, 0xFC, 0x9D, 0xA0, 0xFF,
-    0x51, 0xC1, 0x84, 0x33, 0x7E, 0x63, 0x36, 0xFA, 0x07, 0xA0, 0x06, 0x86, 0x1B, 0x99, 0x95, 0xB0,
-    0xDB, 0x8C, 0x8B, 0x0E, 0xE6, 0x9A, 0x71, 0x91, 0x1E, 0x25, 0x8A, 0xFF, 0x2D, 0x51, 0xD4, 0x10,
-    0x85, 0x60, 0xB8, 0xE3, 0xA9, 0x70, 0x5C, 0x61, 0xAB, 0x3B, 0x7E, 0x39, 0xC1, 0x90, 0xC8, 0xB9,
-    0x70, 0x9A, 0xBE, 0x6C, 0x2D, 0x46, 0xE8, 0x06, 0xC9, 0x0B, 0xEA, 0x16, 0xFB, 0x02, 0xDA, 0xB6,
-    0xBB, 0xCD, 0xAD, 0xE2, 0xE0, 0x53, 0x70, 0x03, 0x0E, 0x09, 0x6F, 0xEA, 0xA4, 0x33, 0xD8, 0xD8,
-    0x3A, 0xD9, 0x5F, 0x03, 0x68, 0x65, 0x32, 0xC1, 0xB7, 0xC1, 0x02, 0x62, 0x6E, 0xCE, 0xD8, 0x51,
-    0x69, 0x81, 0x9D, 0xF3, 0xCC, 0x68, 0xF8, 0x33, 0xCE, 0x78, 0x4A, 0x8C, 0x93, 0x79, 0x19, 0xD5,
-    0xBA, 0x71, 0xFB, 0x22, 0x4C, 0x2D, 0x60, 0x97, 0xDE, 0x69, 0xB5, 0x7C, 0xD0, 0xF0, 0xB1, 0x23,
-    0x2D, 0x98, 0x14, 0x77, 0x04, 0x6A, 0x69, 0xC1, 0x7A, 0xF7, 0x6C, 0x2E, 0xAD, 0xFF, 0xA6, 0x73,
-    0xF0, 0xE5, 0xA5, 0x4C, 0xAF, 0xF5, 0xDF, 0x09, 0xAF, 0xF5, 0x3F, 0x90, 0xBD, 0x08, 0xFB, 0x26,
-    0x28, 0x48, 0x1B, 0xEB, 0x98, 0x24, 0xAD, 0xA1, 0xAF, 0x01, 0x8C, 0x06, 0x20, 0x7F, 0xCE, 0x1C,
-    0xC0, 0x8C, 0xA2, 0x73, 0x45, 0x2E, 0xB3, 0x89, 0xEC, 0x74, 0xBF, 0x97, 0x5B, 0x8D, 0x2B, 0x19,
-    0xF1, 0x71, 0xE5, 0x25, 0x66, 0x79, 0xF3, 0x72, 0x00, 0x1B, 0xE6, 0x3A, 0xF6, 0x1C, 0x67, 0x73,
-    0x77, 0x01, 0x1E, 0xED, 0x7A, 0x19, 0x96, 0x90, 0xCB, 0x64, 0xD6, 0x26, 0xA3, 0x2A, 0x76, 0x1C,
-    0x6E, 0xBF, 0xCF, 0x02, 0xD7, 0xFB, 0x93, 0x70, 0x66, 0x2E, 0x8F, 0x95, 0xEB, 0x25, 0xA0, 0x18,
-    0x6C, 0x13, 0x19, 0xC1, 0xC9, 0xD1, 0x2C, 0xC8, 0x56, 0x47, 0xB3, 0x71, 0x76, 0x42, 0x40, 0xF1,
-    0x25, 0x00, 0x33, 0xA2, 0xCD, 0xFC, 0xD6, 0x40, 0x6D, 0xCC, 0x75, 0xDF, 0xD4, 0x1C, 0xC1, 0x2F,
-    0xD6, 0xD8, 0x46, 0xF8, 0x73, 0x5A, 0x0B, 0x23, 0x0C, 0x0A, 0xD9, 0xA3, 0x02, 0xEC, 0xE9, 0x21,
-    0xC5, 0x5D, 0x48, 0xBE, 0xC7, 0xE0, 0x0B, 0xA7, 0xD3, 0xE5, 0x1C, 0xDA, 0x78, 0x19, 0x0D, 0x44,
-    0x10, 0xCA, 0x9B, 0xF0, 0xAB, 0xFE, 0x5C, 0xA4, 0x8F, 0xF1, 0xEF, 0x0B, 0x43, 0x33, 0xB1, 0xBA,
-    0xD8, 0x15, 0x5C, 0x30, 0x14, 0xC9, 0xE1, 0xF4, 0xA3, 0xCF, 0xAF, 0x0F, 0xF2, 0xF2, 0xE5, 0x82,
-    0x15, 0x28, 0xDB, 0x81, 0x1D, 0xD4, 0x78, 0x8A, 0x2E, 0xDE, 0x9A, 0xF2, 0x56, 0x2A, 0x78, 0xE9,
-    0xAD, 0x95, 0xC0, 0x23, 0x14, 0xE3, 0xEC, 0xD6, 0xBB, 0x18, 0xAF, 0xC9, 0xCB, 0x2D, 0x84, 0x5C,
-    0x99, 0x7F, 0xD8, 0xA8, 0xA3, 0x2C, 0x4E, 0x26, 0x19, 0xB6, 0xF1, 0x89, 0x70, 0x21, 0xC2, 0xF2,
-    0x00, 0x38, 0xC5, 0x99, 0x61, 0x21, 0x02, 0xB6, 0x88, 0xC6, 0xB8, 0x43, 0x0C, 0x21, 0x3A, 0x93,
-    0xFD, 0xDD, 0x6E, 0xFD, 0x2D, 0xE4, 0x21, 0xEC, 0xD7, 0xB7, 0x52, 0x47, 0x29, 0xA8, 0x1E, 0xCE,
-    0xDF, 0x67, 0xFB, 0x07, 0x93, 0x63, 0x6C, 0xDF, 0xB0, 0x55, 0x24, 0x73, 0xB2, 0x14, 0xC9, 0xE8,
-    0x14, 0x88, 0x48, 0xFA, 0x09, 0x11, 0x26, 0x3F, 0x44, 0xFF, 0x3F, 0x48, 0x7A, 0xCB, 0x4A, 0xDB,
-    0x53, 0x0D, 0x6C, 0xC3, 0x04, 0x7F, 0x06, 0xD7, 0x27, 0x46, 0x6A, 0x55, 0x9D, 0x9D, 0xDB, 0x94,
-    0x82, 0xB2, 0xF5, 0x1D, 0x0F, 0x7E, 0xCD, 0xC0, 0x36, 0x9C, 0xE8, 0x9C, 0xF2, 0x9C, 0xFC, 0x77,
-    0xBC, 0x84, 0xD6, 0xBB, 0xCD, 0xFC, 0xED, 0xBC, 0x37, 0x06, 0xD8, 0xC1, 0x10, 0x10, 0x0D, 0xDA,
-    0xBF, 0x82, 0x54, 0x36, 0x5E, 0xD1, 0xFB, 0x5F, 0xE6, 0x73, 0x65, 0x1F, 0x9F, 0x29, 0x08, 0x17,
-    0x81, 0xF0, 0x12, 0x58, 0x73, 0x64, 0xD7, 0xB3, 0x89, 0xC8, 0x7C, 0x29, 0x56, 0xC3, 0xCA, 0x0F,
-    0xCE, 0x80, 0x42, 0xE1, 0x00, 0x26, 0x3D, 0x80, 0x1E, 0x22, 0x3C, 0xB3, 0xCB, 0xED, 0xB7, 0x6C,
-    0x1D, 0x0B, 0x33, 0x95, 0x7D, 0xE0, 0xBA, 0x08, 0x55, 0x72, 0xFF, 0x38, 0x53, 0xFD, 0x31, 0x4E,
-    0xB8, 0x22, 0x81, 0xAB, 0xBB, 0x8C, 0x67, 0x03, 0x26, 0x05, 0x2E, 0x0D, 0xBA, 0x77, 0x71, 0x7F,
-    0xDA, 0x33, 0xC7, 0xAE, 0x3D, 0x59, 0xDF, 0x1E, 0xC7, 0x93, 0x1D, 0x0E, 0x1C, 0x1E, 0xEF, 0xC2,
-    0x23, 0x87, 0xBD, 0x82, 0xD6, 0xCD, 0x18, 0x2B, 0xE4, 0x24, 0x27, 0x12, 0x58, 0xD4, 0x09, 0x80,
-    0x2F, 0x2D, 0x70, 0xAC, 0x1B, 0x3F, 0x00, 0xED, 0x21, 0x1A, 0x56, 0x3E, 0x3D, 0x34, 0x60, 0x6F,
-    0x6E, 0xB6, 0x01, 0xE4, 0x00, 0x9D, 0xEA, 0x21, 0xEB, 0x10, 0x59, 0xD5, 0xCF, 0x5C, 0x08, 0xCB,
-    0x28, 0xE0, 0xB6, 0x58, 0xEF, 0x40, 0x12, 0x1A, 0xBF, 0x66, 0xBC, 0xE7, 0xFE, 0x48, 0x1E, 0x33,
-    0xA6, 0xF8, 0x39, 0x1B, 0xAB, 0x74, 0xAC, 0xBF, 0x75, 0x8A, 0xD2, 0xFD, 0x50, 0x4E, 0xE4, 0xB5,
-    0x1C, 0x99, 0xAD, 0x7A, 0x9D, 0x03, 0x93, 0x71, 0x5C, 0x0A, 0xE8, 0xAA, 0x99, 0x63, 0x62, 0xE3,
-    0xD9, 0x3E, 0xC0, 0x75, 0x6B, 0x36, 0x48, 0xE2, 0xDD, 0x20, 0x57, 0xCF, 0x41, 0xAE, 0xF2, 0x77,
-    0x2F, 0x66, 0xAB, 0xB3, 0x2D, 0x40, 0x54, 0xDF, 0x4F, 0x5A, 0x27, 0xD8, 0x4D, 0x44, 0xB0, 0x83,
-    0x2D, 0x9F, 0xF1, 0x23, 0x15, 0xF4, 0x31, 0xB3, 0x29, 0x72, 0x00, 0xAD, 0x0F, 0xF0, 0x1B, 0xE0,
-    0xBB, 0xA0, 0x54, 0xC1, 0x6E, 0x52, 0xB4, 0x70, 0x41, 0x7F, 0xA7, 0x15, 0x86, 0x21, 0xA7, 0x3F,
-    0xB7, 0x28, 0x49, 0x4D, 0x48, 0xAA, 0xA4, 0x7B, 0xD1, 0xED, 0x2E, 0x90, 0xFA, 0x45, 0x85, 0x40,
-    0x33, 0xC2, 0x29, 0xA7, 0x93, 0xAC, 0x89, 0x48, 0x78, 0xAE, 0x2C, 0x08, 0x2C, 0xC8, 0x88, 0x08,
-    0x6D, 0x12, 0x04, 0x59, 0x75, 0xFE, 0x65, 0x7F, 0xCA, 0x44, 0x2F, 0x70, 0x97, 0x4B, 0x03, 0xE3,
-    0xFE, 0xD6, 0x78, 0xD0, 0x0B, 0x33, 0x3C, 0x36, 0x72, 0x9D, 0x3A, 0x4D, 0x5E, 0x69, 0x4B, 0xB8,
-    0xC1, 0x36, 0x28, 0xDA, 0x06, 0x10, 0x96, 0xC3, 0xE9, 0x00, 0xB0, 0x3F, 0xFB, 0xF8, 0x6E, 0xD4,
-    0x3D, 0x0F, 0x9F, 0x15, 0x02, 0x2D, 0xA2, 0x9F, 0x34, 0xF4, 0x16, 0x8B, 0xA6, 0x48, 0x07, 0x9E,
-    0xE7, 0xC4, 0x62, 0xBA, 0x01, 0xD2, 0xE2, 0x88, 0xDD, 0xE8, 0x60, 0x70, 0x35, 0xDF, 0x77, 0x0C,
-    0xA3, 0x97, 0x74, 0x69, 0xB9, 0x79, 0x6D, 0x2E, 0x49, 0xDE, 0x45, 0xC1, 0xDF, 0x2B, 0x1F, 0x4A,
-    0xC6, 0x33, 0x25, 0x86, 0x57, 0x85, 0xC9, 0x92, 0xC4, 0x7A, 0x17, 0x9F, 0x43, 0xD3, 0xB7, 0x1D,
-    0x0C, 0x0B, 0x5C, 0x2B, 0x2F, 0xBC, 0xBF, 0xC6, 0x20, 0x87, 0x7E, 0x8E, 0xE9, 0x0F, 0x9F, 0x15,
-    0x51, 0xE0, 0x3D, 0x44, 0x3C, 0x7C, 0xF0, 0x8E, 0x05, 0x2B, 0x4F, 0xE1, 0x95, 0xC5, 0xC0, 0x60,
-    0x90, 0x2A, 0x55, 0x75, 0x6F, 0x0B, 0xF8, 0x60, 0x9D, 0x32, 0x74, 0x61, 0x21, 0x73, 0x3C, 0xDC,
-    0x8F, 0x57, 0x62, 0x2C, 0xA3, 0xC4, 0xB5, 0x7E, 0x05, 0x42, 0x3B, 0x55, 0xDB, 0xAF, 0xE9, 0xEE,
-    0x41, 0xDD, 0x7C, 0xAA, 0x9A, 0xEE, 0x1F, 0x2F, 0xC5, 0xD7, 0xDE, 0x15, 0xD5, 0xF1, 0xB6, 0x84,
-    0x99, 0xCD, 0x57, 0x85, 0x80, 0xF5, 0x6D, 0x09, 0x33, 0xEA, 0x90, 0x13, 0x2A, 0xFD, 0xAA, 0xA5,
-    0x44, 0x79, 0x41, 0x76, 0x9A, 0x0B, 0x22, 0x85, 0xF3, 0x3A, 0xE9, 0xC6, 0x84, 0x92, 0x35, 0x22,
-    0x0F, 0x1A, 0x1C, 0x38, 0x79, 0x60, 0x92, 0x9D, 0x33, 0x61, 0x26, 0x4A, 0x54, 0x76, 0x4D, 0xCE,
-    0x8F, 0x65, 0xAD, 0x41, 0x11, 0x83, 0x12, 0x65, 0x12, 0x43, 0xD1, 0x0D, 0xFF, 0xCF, 0x2D, 0x86,
-    0xD2, 0x7F, 0x61, 0x1F, 0xE4, 0xD5, 0xB7, 0xF5, 0x3F, 0x0D, 0x17, 0xD6, 0x4E, 0x1F, 0xF1, 0xCC,
-    0xB5, 0x50, 0xA4, 0xF2, 0x69, 0x1B, 0x16, 0x5F, 0xF0, 0xB3, 0x3B, 0xBC, 0x9B, 0x79, 0x44, 0x06,
-    0xA8, 0x93, 0xFF, 0xCE, 0x39, 0x1E, 0xDE, 0x1E, 0x69, 0xCD, 0xED, 0xFC, 0xD7, 0x98, 0xC6, 0x13,
-    0xB1, 0x74, 0x7D, 0xDA, 0x51, 0x75, 0x87, 0x55, 0x26, 0xD7, 0xF0, 0xD4, 0x89, 0x3A, 0x92, 0x1E,
-    0x86, 0xDE, 0xBB, 0x1B, 0x1D, 0xED, 0x51, 0xBA, 0x79, 0x1A, 0x0A, 0x5F, 0x0A, 0x89, 0xF8, 0x98,
-    0x7C, 0x29, 0x14, 0x7C, 0x46, 0x90, 0x0C, 0xC7, 0xAA, 0x20, 0xE1, 0x1C, 0x0E, 0x5D, 0x21, 0x12,
-    0x25, 0x47, 0x50, 0xB1, 0x05, 0xF6, 0x1F, 0x17, 0x76, 0xBA, 0x62, 0x2F, 0x59, 0xB9, 0x64, 0xB2,
-    0x10, 0x5E, 0x9A, 0xDB, 0x2F, 0x33, 0xB8, 0xB4, 0x7B, 0x16, 0x8E, 0x18, 0x6C, 0x88, 0x05, 0x67,
-    0x0A, 0x44, 0xA0, 0xFD, 0xD1, 0xCE, 0xDA, 0xFA, 0x5B, 0x09, 0x1B, 0x0F, 0xE9, 0x19, 0x7F, 0xAD,
-    0x4F, 0xF9, 0x5B, 0x50, 0x11, 0x51, 0x12, 0xDF, 0x83, 0x20, 0xA8, 0x47, 0x59, 0x28, 0x2A, 0xA1,
-    0x97, 0xBF, 0x0D, 0x8E, 0xFF, 0x0A, 0x62, 0x43, 0xEF, 0x7C, 0x51, 0xD6, 0x2A, 0xED, 0xDC, 0xFE,
-    0xA2, 0x1C, 0xF7, 0x8B, 0x72, 0x07, 0x8B, 0x12, 0x81, 0x07, 0x17, 0xFB, 0xC7, 0x73, 0x4D, 0xC6,
-    0x83, 0x70, 0x5B, 0x2E, 0xEB, 0xCE, 0xF7, 0x4A, 0x9F, 0x35, 0x4F, 0x25, 0x73, 0x5F, 0x1E, 0x97,
-    0xBF, 0x0A, 0xF5, 0x2E, 0x71, 0xC2, 0x99, 0x5A, 0xEE, 0x8F, 0x16, 0x2F, 0x93, 0xEB, 0x1C, 0x6C,
-    0x1F, 0xD7, 0x20, 0xE7, 0x4A, 0xC7, 0xE2, 0x77, 0x84, 0x7F, 0xAC, 0x6C, 0x67, 0x4B, 0xCD, 0x79,
-    0x20, 0x14, 0x8D, 0x7B, 0x21, 0x3C, 0xEF, 0x50, 0x9F, 0x15, 0x9D, 0x21, 0xE9, 0xA3, 0x90, 0xE7,
-    0xAD, 0x9A, 0x03, 0x27, 0xBC, 0x91, 0x4D, 0x85, 0x55, 0xCC, 0xA8, 0x89, 0x49, 0xFD, 0x0D, 0x8B,
-    0xA8, 0x6E, 0x1F, 0x71, 0x82, 0xE8, 0x10, 0xC3, 0x5A, 0x72, 0x90, 0x32, 0x9A, 0x22, 0x54, 0xE5,
-    0x3C, 0x28, 0x2D, 0x5F, 0xD1, 0xD5, 0x18, 0x01, 0xCB, 0x14, 0x91, 0xA9, 0x72, 0x9E, 0x43, 0x51,
-    0xCA, 0xFA, 0x45, 0x37, 0x2A, 0x43, 0x8F, 0x4B, 0x5C, 0x19, 0xBA, 0x29, 0xFE, 0xDD, 0xCC, 0x63,
-    0x8C, 0xE4, 0xEF, 0x6B, 0xF8, 0x8C, 0x3B, 0xEF, 0xC7, 0x34, 0x87, 0xE5, 0x30, 0x39, 0x08, 0xF1,
-    0x52, 0x3F, 0x69, 0x21, 0xD0, 0xC7, 0x5F, 0x35, 0x1D, 0x0C, 0x63, 0xF1, 0x5F, 0x99, 0x1C, 0x0D,
-    0x8C, 0xFE, 0x8F, 0x49, 0xE1, 0x39, 0x9E, 0xD4, 0xEA, 0xFB, 0x84, 0xC5, 0xD5, 0x59, 0xDF, 0xE9,
-    0x70, 0x13, 0xB1, 0x33, 0x1A, 0xBA, 0x11, 0x65, 0x22, 0xC3, 0x44, 0x99, 0xCC, 0x72, 0x39, 0xAB,
-    0x08, 0x2A, 0x27, 0xFD, 0x43, 0x94, 0x98, 0x82, 0x77, 0x69, 0x70, 0xFC, 0x35, 0x06, 0xDC, 0xC0,
-    0x66, 0x5A, 0x90, 0xD3, 0x07, 0x89, 0xEC, 0x62, 0x71, 0x12, 0xD2, 0xB4, 0x0A, 0x1B, 0x7F, 0x58,
-    0xE4, 0xC5, 0x31, 0x84, 0x8D, 0xBE, 0x33, 0x95, 0x26, 0xF8, 0x3F, 0xFB, 0x51, 0xF9, 0x1A, 0xC6,
-    0xF9, 0x95, 0xF7, 0x64, 0xCC, 0xC7, 0x1F, 0x7E, 0xE5, 0x03, 0xE8, 0x08, 0x96, 0xF9, 0x29, 0x64,
-    0x8A, 0x74, 0xE6, 0xA8, 0x81, 0x9A, 0xDA, 0x43, 0x97, 0x0D, 0x71, 0xA9, 0xC1, 0x1C, 0xC6, 0x64,
-    0x0A, 0xE9, 0xD6, 0x0D, 0xA1, 0xE3, 0xB9, 0x00, 0x5E, 0xF2, 0xB3, 0x41, 0x15, 0x2C, 0x9F, 0x03,
-    0x4D, 0x4D, 0x2E, 0x0E, 0xDE, 0x5F, 0xAF, 0xF1, 0x8D, 0xD7, 0xF1, 0xFB, 0x94, 0x50, 0xF6, 0x2D,
-    0xC0, 0x02, 0x30, 0x2A, 0xE6, 0xC7, 0xFA, 0x7D, 0xEA, 0xCE, 0xF7, 0x28, 0x13, 0x23, 0x56, 0x34,
-    0x31, 0x8F, 0x41, 0xE2, 0x8B, 0x87, 0xD0, 0x06, 0x73, 0x53, 0x10, 0xA3, 0x75, 0x4F, 0x75, 0x9B,
-    0x37, 0x3B, 0x8F, 0x9C, 0xBE, 0xDB, 0xB4, 0x99, 0x3A, 0xA9, 0xE8, 0xA3, 0xA2, 0x13, 0xCA, 0x01,
-    0x67, 0x95, 0x39, 0x22, 0xA7, 0xC0, 0x21, 0x56, 0x2F, 0xF9, 0x32, 0x20, 0xC7, 0xC2, 0xA1, 0x93,
-    0x5F, 0x62, 0x3C, 0x94, 0x4C, 0x10, 0xAB, 0x5E, 0x20, 0x04, 0x4B, 0xD2, 0x98, 0x43, 0x2C, 0x5B,
-    0xF4, 0x17, 0x8C, 0xFA, 0x36, 0xE8, 0xDD, 0xC9, 0x1D, 0xEE, 0x96, 0x70, 0xBB, 0xD6, 0xAD, 0x3D,
-    0x67, 0x34, 0x44, 0x07, 0x4C, 0xB0, 0x7D, 0xBE, 0x5B, 0x5B, 0xDB, 0xE7, 0x3C, 0x8D, 0x1E, 0x5C,
-    0xBC, 0x4F, 0x9A, 0x28, 0x66, 0x4C, 0x06, 0x3D, 0x45, 0xC6, 0x63, 0x3B, 0xA4, 0x85, 0xF4, 0x63,
-    0xB6, 0xF2, 0xE8, 0x33, 0x76, 0xC3, 0x43, 0xC4, 0x89, 0xFA, 0x60, 0x1C, 0x27, 0x9D, 0xCB, 0xCF,
-    0xB1, 0xAD, 0xBC, 0xBC, 0x36, 0x4F, 0xDB, 0x8D, 0x60, 0x27, 0x4F, 0x64, 0xA1, 0x44, 0x19, 0x1D,
-    0xCD, 0x31, 0x84, 0xA3, 0x06, 0xD6, 0x25, 0x50, 0xC8, 0x4D, 0x0C, 0x87, 0x1C, 0x01, 0x49, 0x15,
-    0xA1, 0x8F, 0x9D, 0x0D, 0x5F, 0xEE, 0x3E, 0x33, 0x57, 0x24, 0x84, 0x28, 0x70, 0xEB, 0xA9, 0x0F,
-    0xC1, 0x36, 0xA0, 0xA5, 0xA5, 0xF2, 0xAC, 0x86, 0x18, 0xD0, 0x51, 0xA4, 0x1A, 0x57, 0x48, 0x57,
-    0xCB, 0x84, 0x8D, 0x8C, 0x39, 0x89, 0xBE, 0x41, 0xFE, 0xFB, 0x5F, 0x78, 0xF3, 0xAA, 0xA5, 0xC3,
-    0x72, 0x9B, 0x0A, 0x59, 0xAA, 0x61, 0xCD, 0x70, 0x41, 0x7C, 0x07, 0xA1, 0x8D, 0x21, 0x27, 0xEC,
-    0x24, 0xFD, 0xAE, 0x5C, 0x7C, 0x2C, 0xFA, 0x96, 0x5C, 0xBC, 0x1A, 0xBD, 0x22, 0x17, 0x9F, 0x8B,
-    0xBE, 0x89, 0xE8, 0xD0, 0xE8, 0x65, 0x68, 0xFA, 0x51, 0xD6, 0x21, 0x5E, 0x2B, 0xCB, 0x61, 0x00,
-    0xCC, 0xE2, 0xC4, 0x07, 0x84, 0x75, 0x22, 0x8B, 0x8B, 0xF4, 0x7A, 0xF4, 0x72, 0x3E, 0xB3, 0x4D,
-    0xF4, 0x0A, 0xC4, 0xF3, 0x6B, 0x3D, 0xFB, 0x1B, 0x81, 0xE5, 0x8C, 0xFF, 0x5E, 0xEE, 0xED, 0x7F,
-    0x1B, 0x8F, 0xF1, 0x69, 0x3B, 0x90, 0xDB, 0x3F, 0x33, 0x62, 0xD0, 0xB4, 0x9C, 0xFB, 0xDF, 0x3A,
-    0x69, 0xD8, 0x7B, 0xF5, 0xB6, 0xF1, 0xDE, 0xAC, 0x45, 0x4F, 0x78, 0xBD, 0x96, 0xA5, 0xFB, 0x72,
-    0x3D, 0x29, 0x82, 0x67, 0xEB, 0x70, 0x1A, 0x7A, 0xC2, 0x8D, 0x53, 0xF9, 0xAE, 0xB1, 0xAF, 0xD7,
-    0x71, 0x47, 0x69, 0x0F, 0x81, 0xA6, 0xF4, 0x07, 0xC6, 0xFD, 0x7C, 0xEE, 0xB3, 0x48, 0x0C, 0x3A,
-    0x81, 0x03, 0xEF, 0x9D, 0xA9, 0x1E, 0x8C, 0x7E, 0x54, 0xE9, 0xC1, 0xF8, 0x0D, 0x77, 0xE0, 0x7F,
-    0xB9, 0xD6, 0x83, 0xD0, 0x6B, 0xF4, 0x60, 0x02, 0x72, 0x23, 0xB6, 0xEB, 0xEB, 0x6B, 0x9D, 0xE9,
-    0xB3, 0x49, 0xF4, 0x9B, 0xFF, 0xDA, 0xA5, 0x1A, 0x9C, 0x30, 0xBB, 0xE6, 0xA2, 0x22, 0xAA, 0x6B,
-    0x1A, 0x5E, 0x38, 0x2A, 0xAF, 0x21, 0xF0, 0x07, 0x7C, 0xE4, 0x9A, 0xEF, 0x82, 0x07, 0xAF, 0xA9,
-    0x5F, 0x39, 0x48, 0xAE, 0x69, 0x06, 0x51, 0x68, 0xAE, 0x69, 0x74, 0xE1, 0x44, 0x08, 0x42, 0x76,
-    0x1A, 0xCB, 0x81, 0x95, 0x39, 0xF5, 0x9F, 0xED, 0xC6, 0xB5, 0x15, 0xB8, 0x9C, 0x7F, 0x6F, 0xE5,
-    0x3E, 0xC8, 0x9C, 0x83, 0x64, 0x83, 0x69, 0x04, 0xAA, 0x79, 0xAD, 0xB2, 0xEA, 0x46, 0x29, 0x27,
-    0xB7, 0xFE, 0x36, 0xFD, 0xC0, 0xA4, 0x5E, 0x63, 0x1E, 0x1E, 0xD3, 0x1F, 0x7C, 0x0C, 0x89, 0x7F,
-    0x1A, 0x3B, 0x28, 0xD3, 0xE8, 0x06, 0xA8, 0xD8, 0x98, 0xAA, 0x46, 0x9A, 0x95, 0x57, 0x22, 0x53,
-    0x4B, 0x98, 0x6A, 0x8D, 0xE8, 0x86, 0x71, 0x56, 0x63, 0x32, 0x06, 0x49, 0x0D, 0x7D, 0x2A, 0x14,
-    0x54, 0x1D, 0x69, 0x52, 0xF9, 0xAD, 0x8D, 0x1B, 0x3B, 0x15, 0xAA, 0x1A, 0x97, 0x60, 0xE4, 0x50,
-    0xBE, 0xB6, 0xF6, 0x42, 0x45, 0x09, 0xD9, 0x67, 0xC0, 0x18, 0xC5, 0x76, 0x59, 0xDF, 0xA7, 0xD4,
-    0x36, 0xC7, 0x80, 0xE5, 0x56, 0x33, 0x22, 0x53, 0x0D, 0xED, 0x8D, 0xFE, 0x5E, 0x23, 0x77, 0xB8,
-    0xC2, 0x7C, 0x75, 0x61, 0x8B, 0xF0, 0x8C, 0x61, 0x89, 0x31, 0x94, 0x72, 0xA2, 0x8C, 0x63, 0x09,
-    0x3F, 0x46, 0x0D, 0xEE, 0xD6, 0x79, 0x35, 0xFD, 0xD5, 0x5E, 0x4D, 0x8A, 0x79, 0xB5, 0x7A, 0x35,
-    0xC0, 0x9D, 0x65, 0xC3, 0xAF, 0x65, 0x3C, 0xE8, 0xDC, 0x10, 0xE1, 0x00, 0xCE, 0x8D, 0x74, 0x2A,
-    0x1B, 0xB9, 0x2D, 0x8F, 0x54, 0x8C, 0x94, 0xD4, 0x74, 0x28, 0x6E, 0x63, 0x17, 0xD8, 0x48, 0x78,
-    0xFC, 0x0A, 0xB4, 0x63, 0x5C, 0x21, 0x80, 0xC8, 0x6B, 0x8E, 0x0F, 0x71, 0xD5, 0x81, 0xA5, 0x94,
-    0xFE, 0xDD, 0x9F, 0x0A, 0xA5, 0x44, 0x5A, 0x16, 0xB2, 0x36, 0x61, 0xB1, 0x6D, 0x46, 0x42, 0x0F,
-    0x38, 0xB3, 0x04, 0x26, 0xC2, 0x7E, 0x8B, 0xA8, 0x08, 0x4B, 0x99, 0x6A, 0xD3, 0xB4, 0x58, 0x9F,
-    0x05, 0xB5, 0x90, 0xA3, 0x1D, 0xB5, 0x1A, 0x9E, 0x87, 0x55, 0x21, 0x53, 0xCD, 0x1D, 0x81, 0x57,
-    0xED, 0xAC, 0xAD, 0x9D, 0xE1, 0x94, 0xC0, 0xEC, 0x89, 0x74, 0x02, 0x6D, 0x53, 0xC2, 0x71, 0x69,
-    0x4C, 0x33, 0x37, 0xBB, 0x0A, 0x44, 0x0B, 0x70, 0xC2, 0x55, 0x81, 0x9B, 0x95, 0xA3, 0x7A, 0xD2,
-    0xFB, 0xA9, 0x19, 0x08, 0x85, 0x19, 0xB6, 0x96, 0xD6, 0x66, 0x98, 0x74, 0xA5, 0x7E, 0x67, 0xBF,
-    0xFB, 0x6B, 0x9D, 0x9A, 0x5E, 0x1B, 0x4E, 0x73, 0xA3, 0xF9, 0x68, 0x30, 0x14, 0x72, 0xBE, 0x89,
-    0x5A, 0x1D, 0x67, 0xEA, 0x45, 0x0F, 0xA7, 0x91, 0xF3, 0xA3, 0xF7, 0x1E, 0x74, 0xED, 0x88, 0x72,
-    0x53, 0xF9, 0xAF, 0x52, 0xBE, 0x16, 0x4E, 0xE1, 0xDA, 0x03, 0xA7, 0x0B, 0x21, 0xF5, 0x61, 0xFE,
-    0x79, 0xE9, 0xCE, 0x08, 0x66, 0x8B, 0x0F, 0xEA, 0x11, 0x53, 0xB5, 0x62, 0xFB, 0x1E, 0xE9, 0xFA,
-    0xB4, 0xFC, 0x46, 0x2A, 0xB7, 0x8E, 0xC2, 0x8D, 0xEB, 0x54, 0xE3, 0xBA, 0x04, 0x4B, 0x4C, 0xC0,
-    0xE0, 0x04, 0xAF, 0x8E, 0x74, 0x3B, 0xD8, 0x3E, 0xEF, 0x18, 0x1A, 0x76, 0x2C, 0xE1, 0x68, 0xEF,
-    0xBE, 0xC3, 0xF3, 0xBB, 0xA0, 0x68, 0xC8, 0xDA, 0x02, 0xA1, 0xB9, 0x69, 0x46, 0x75, 0x50, 0x70,
-    0x56, 0xCE, 0x02, 0xE4, 0x53, 0x34, 0xA0, 0xCB, 0xA4, 0x90, 0x11, 0x41, 0x93, 0x4B, 0xCC, 0xC8,
-    0xF5, 0xDA, 0xAF, 0xE3, 0x06, 0xF4, 0xF7, 0x5A, 0x6A, 0x4D, 0xA3, 0x12, 0xB3, 0xE5, 0x4A, 0x8C,
-    0xB5, 0x7E, 0xC5, 0x65, 0x6C, 0x8C, 0xC0, 0xE5, 0xA3, 0x1B, 0x79, 0x29, 0xFC, 0x5B, 0x64, 0x4E,
-    0x26, 0x42, 0x30, 0x01, 0x8D, 0xD9, 0x68, 0x8F, 0xAA, 0xB5, 0x92, 0x51, 0x58, 0x34, 0xC1, 0x50,
-    0x0E, 0x05, 0xA7, 0xE7, 0xA4, 0xDC, 0x44, 0x7C, 0x25, 0x44, 0x1C, 0x2E, 0xB2, 0x5E, 0x44, 0xCB,
-    0x97, 0x81, 0xED, 0xE3, 0xBB, 0x8F, 0x88, 0xBA, 0xB6, 0x2E, 0x33, 0x68, 0x62, 0x7F, 0x23, 0xF7,
-    0xD8, 0xE8, 0x7F, 0x97, 0xE7, 0x3F, 0x22, 0x47, 0x47, 0xAC, 0x89, 0xDF, 0x16, 0xCD, 0x21, 0xB0,
-    0x3B, 0xEB, 0xF0, 0xF5, 0x3E, 0xEC, 0x82, 0x91, 0x44, 0x96, 0x9F, 0xE6, 0x99, 0xF7, 0x7E, 0xC9,
-    0xA0, 0x2D, 0x5F, 0x56, 0x54, 0xF4, 0x4B, 0x8B, 0xA8, 0xBD, 0x0C, 0xEA, 0xCD, 0x31, 0xCA, 0xC7,
-    0x13, 0x75, 0xC6, 0xAD, 0xC9, 0xFE, 0x27, 0x2B, 0xDF, 0xDB, 0xEC, 0x9C, 0xAD, 0x96, 0xB9, 0x25,
-    0xFD, 0x87, 0x49, 0x23, 0xE6, 0xB3, 0x9D, 0x3C, 0xFF, 0xBA, 0x49, 0x4F, 0xEB, 0xCE, 0x8B, 0x1C,
-    0x09, 0xD9, 0x18, 0xAA, 0x74, 0xCB, 0xCE, 0x82, 0xEE, 0x5F, 0x61, 0x15, 0x26, 0xE9, 0x4C, 0x76,
-    0xD4, 0xA8, 0x59, 0xAF, 0x03, 0xBB, 0x11, 0xD5, 0x63, 0x10, 0x25, 0x2A, 0x28, 0xDD, 0x53, 0xAF,
-    0xB8, 0x39, 0x42, 0x4A, 0x26, 0x2D, 0x4A, 0xA3, 0x86, 0xC8, 0x6B, 0x34, 0xB1, 0x0D, 0xE3, 0x9F,
-    0xA3, 0xC7, 0x2A, 0x2F, 0x4F, 0xB7, 0xE1, 0x5C, 0x0C, 0x2C, 0x57, 0x94, 0xF9, 0x0B, 0xFB, 0x3D,
-    0x73, 0x70, 0x7E, 0x9B, 0x4B, 0x5E, 0x22, 0xFC, 0x1C, 0xA2, 0x28, 0xC1, 0xE9, 0xEB, 0x79, 0x12,
-    0x8E, 0xEA, 0xC0, 0xB7, 0x86, 0x69, 0xED, 0x95, 0xA7, 0x4C, 0x24, 0x30, 0x4D, 0x44, 0x74, 0x43,
-    0x1C, 0x9E, 0xC0, 0x90, 0xD0, 0x27, 0x1C, 0x2B, 0x9C, 0x02, 0x8E, 0x16, 0x61, 0xFF, 0x6B, 0xD3,
-    0x43, 0x11, 0x2C, 0x05, 0x86, 0xC8, 0x2C, 0x28, 0x85, 0x41, 0xA4, 0x6F, 0xFE, 0xAC, 0xA1, 0xF5,
-    0x9C, 0x33, 0x8A, 0x72, 0xF1, 0x4A, 0xF9, 0x51, 0xDA, 0xB6, 0x4F, 0xDC, 0xAE, 0x45, 0x88, 0x0E,
-    0x26, 0x5D, 0xDB, 0xC7, 0xED, 0x96, 0xFB, 0xC6, 0xED, 0x4E, 0xE3, 0x97, 0x4F, 0x23, 0xF0, 0x50,
-    0xD4, 0x1E, 0x11, 0xB3, 0x6F, 0xE4, 0xEF, 0xA7, 0x55, 0x9C, 0x05, 0xC8, 0x9F, 0xCE, 0xCC, 0xD7,
-    0xF6, 0xC6, 0xED, 0x86, 0x7D, 0xDC, 0x6E, 0xD9, 0xC7, 0xED, 0xA6, 0xEE, 0x29, 0x7D, 0xDC, 0xEE,
-    0x6F, 0xF1, 0xF4, 0x85, 0xB8, 0x5D, 0xFD, 0xB7, 0x4E, 0x0F, 0xD9, 0x56, 0x09, 0x03, 0x29, 0xAC,
-    0xDE, 0x06, 0xC2, 0x89, 0xA8, 0xD1, 0x71, 0xEF, 0x26, 0x33, 0xF1, 0xD7, 0x45, 0xD6, 0x8D, 0xAD,
-    0x08, 0x2E, 0xF1, 0xB3, 0x42, 0x83, 0xD8, 0x1C, 0x96, 0x3F, 0xF9, 0x03, 0x4E, 0x41, 0x00, 0x9C,
-    0x5E, 0x16, 0x20, 0x7A, 0x86, 0xCE, 0xB6, 0xB9, 0x87, 0x8C, 0xF1, 0xD0, 0x35, 0x04, 0xDC, 0xB0,
-    0xC1, 0x7A, 0x8A, 0xAF, 0x42, 0xC9, 0x3D, 0xCF, 0x06, 0xED, 0xCA, 0x82, 0xEA, 0x16, 0xB3, 0xA0,
-    0x12, 0xC6, 0x3A, 0x66, 0x3E, 0x4D, 0x2F, 0x21, 0x85, 0x96, 0x90, 0xCB, 0x94, 0x2E, 0xF0, 0xEA,
-    0x98, 0x71, 0xEA, 0xA7, 0xDC, 0xFC, 0x04, 0x17, 0x32, 0x63, 0x45, 0x5B, 0x9A, 0xEC, 0xB6, 0x17,
-    0x22, 0x46, 0x5D, 0x24, 0xE4, 0x42, 0xDC, 0xA8, 0x06, 0xAD, 0x7B, 0x6D, 0xDA, 0x25, 0xBE, 0x15,
-    0xCE, 0x17, 0xFE, 0x95, 0x8C, 0xC2, 0x51, 0xA8, 0x21, 0xAB, 0x72, 0x33, 0xA8, 0x38, 0x0D, 0x54,
-    0xB0, 0xD6, 0x5C, 0xC6, 0xAC, 0xC6, 0x06, 0xC7, 0xB0, 0xD5, 0x6F, 0xC2, 0xA0, 0xF3, 0x06, 0xE8,
-    0xFC, 0x06, 0xE4, 0xED, 0x9F, 0x22, 0x3F, 0xF6, 0x43, 0xB4, 0x62, 0x60, 0x03, 0x5C, 0x77, 0x5F,
-    0x5C, 0xC1, 0xFA, 0x8F, 0xBF, 0x42, 0xC5, 0xE3, 0xF5, 0x86, 0x0A, 0xDC, 0x05, 0xEA, 0x72, 0x0C,
-    0x46, 0x3C, 0xEB, 0x27, 0xBB, 0x32, 0xF7, 0x1E, 0x2C, 0xF2, 0xAC, 0x6C, 0x7C, 0x0D, 0x1B, 0xA4,
-    0x6C, 0x21, 0x1E, 0x64, 0x02, 0x73, 0x15, 0x7B, 0x52, 0x04, 0x6B, 0x68, 0x90, 0xBC, 0xB6, 0xA4,
-    0x04, 0xDF, 0x33, 0x0A, 0x2E, 0xFC, 0x5B, 0xB1, 0xB3, 0x41, 0x80, 0xBE, 0x61, 0x7B, 0xCA, 0x75,
-    0x1A, 0x4C, 0xA5, 0x9C, 0x7B, 0xEC, 0xCC, 0x7A, 0x41, 0x35, 0xE4, 0x81, 0x82, 0x29, 0xB6, 0x2E,
-    0x00, 0x54, 0x9E, 0xD6, 0x45, 0x76, 0x1A, 0x5B, 0xF6, 0x31, 0x3F, 0x62, 0xB3, 0xA8, 0x63, 0xA7,
-    0xD3, 0x11, 0xBD, 0x04, 0x58, 0x44, 0x69, 0xD2, 0xC2, 0xDE, 0x1B, 0x33, 0xAB, 0x7A, 0xDB, 0xE5,
-    0x7D, 0xD1, 0x3B, 0x8C, 0xC4, 0xAE, 0x4C, 0xBD, 0xC0, 0xB2, 0x95, 0xE9, 0x21, 0xC9, 0xAD, 0x97,
-    0x85, 0xC5, 0x44, 0x29, 0x98, 0x0A, 0xE1, 0x8F, 0x29, 0x19, 0xE1, 0x6C, 0x58, 0x75, 0x0F, 0x36,
-    0xA3, 0xD9, 0xB9, 0xBE, 0x39, 0x5E, 0x73, 0x99, 0x8D, 0xC4, 0x90, 0x36, 0x95, 0x71, 0xE6, 0x35,
-    0xF3, 0x52, 0xC9, 0x1D, 0x86, 0x6B, 0x16, 0x9D, 0x8A, 0x7F, 0x85, 0xB8, 0x6A, 0x8E, 0x07, 0x73,
-    0x9F, 0xDD, 0x9C, 0x7D, 0x6C, 0x21, 0x7E, 0x75, 0xF0, 0x68, 0xE9, 0xBF, 0x93, 0xF3, 0xC3, 0xAB,
-    0xC3, 0x91, 0x37, 0x9B, 0xEB, 0xE9, 0xD5, 0x9C, 0x9A, 0x83, 0x19, 0x23, 0xD8, 0x59, 0x26, 0xF4,
-    0xBA, 0xFD, 0x8A, 0x6D, 0xC6, 0xB6, 0x14, 0x3E, 0xF0, 0x73, 0x2B, 0x3B, 0xFD, 0x14, 0xBC, 0x20,
-    0x2E, 0x54, 0x3D, 0x69, 0xA5, 0x33, 0x27, 0xC9, 0x13, 0x68, 0x6E, 0xC3, 0xA2, 0x97, 0xDD, 0xF2,
-    0x1C, 0x79, 0xC3, 0x18, 0x1A, 0x3B, 0x0E, 0x44, 0x5A, 0xAE, 0x78, 0xF0, 0x6C, 0x03, 0x5A, 0x82,
-    0x52, 0xAD, 0xE6, 0xC5, 0x09, 0x21, 0xDD, 0x81, 0x5C, 0x97, 0x38, 0x9E, 0xF1, 0x67, 0xC6, 0xF1,
-    0x8D, 0xFF, 0x69, 0x1C, 0xEF, 0xF8, 0xBF, 0x46, 0x95, 0x41, 0x26, 0xC8, 0x80, 0x87, 0x70, 0x5B,
-    0xA6, 0x2D, 0x9B, 0xB6, 0x10, 0xE1, 0x25, 0xA3, 0x6A, 0x77, 0x80, 0xA5, 0xDF, 0xBB, 0xA8, 0x87,
-    0xA5, 0x3D, 0x50, 0xA6, 0x4F, 0x91, 0x5D, 0xEF, 0x75, 0x4A, 0xD7, 0xFB, 0x95, 0xE9, 0x90, 0x03,
-    0xCA, 0xA0, 0x3D, 0x30, 0x77, 0x08, 0xB3, 0xDF, 0x7E, 0x0F, 0x22, 0x82, 0x97, 0x20, 0x70, 0x9B,
-    0xCB, 0x89, 0xEE, 0x12, 0x0C, 0x1E, 0xBD, 0x16, 0xD2, 0x1C, 0x1A, 0x0A, 0x9B, 0x98, 0x3A, 0xC4,
-    0x2D, 0x20, 0xCF, 0xD4, 0xAB, 0xF4, 0x0E, 0x7A, 0x37, 0xB0, 0x7B, 0x86, 0xC1, 0x61, 0x02, 0xE5,
-    0x5F, 0xAD, 0x20, 0xA1, 0x68, 0x6C, 0x9D, 0xBA, 0x6E, 0xC2, 0xD9, 0xDC, 0x24, 0xA6, 0xFF, 0xFE,
-    0x35, 0x9A, 0x89, 0xAE, 0xC0, 0x1F, 0xE3, 0x41, 0x62, 0xF6, 0x67, 0x4D, 0x8C, 0x24, 0xA7, 0x10,
-    0xB1, 0x94, 0x41, 0x19, 0xC3, 0x8D, 0x8F, 0xEC, 0x43, 0x82, 0xD9, 0x3E, 0xA0, 0xE2, 0x29, 0x22,
-    0x49, 0xF8, 0xB2, 0x25, 0x1A, 0x88, 0x78, 0x57, 0xE2, 0xCC, 0xA3, 0x12, 0x1C, 0x41, 0x3B, 0xE7,
-    0xED, 0xCD, 0x95, 0xC5, 0xE9, 0x30, 0x72, 0x61, 0x8D, 0x3E, 0x12, 0x29, 0x98, 0x92, 0x97, 0x93,
-    0xF4, 0x7F, 0xE4, 0xFF, 0xC7, 0x8B, 0x66, 0x9E, 0x18, 0x3B, 0x0F, 0x70, 0xF5, 0x7A, 0x8F, 0x9E,
-    0x5B, 0xA3, 0x8F, 0x2F, 0xCD, 0xAE, 0x00, 0xC2, 0x0F, 0x56, 0x4C, 0x3E, 0x8D, 0x45, 0xE4, 0x83,
-    0x50, 0x1F, 0x53, 0x3E, 0x1C, 0x57, 0xA7, 0xB8, 0x76, 0xBC, 0x29, 0x02, 0x56, 0x54, 0x2D, 0x8D,
-    0x34, 0x47, 0x42, 0x56, 0x90, 0xE3, 0x4A, 0x53, 0xE5, 0x51, 0x9A, 0xC0, 0xB2, 0x0F, 0xAE, 0x0E,
-    0xC0, 0x65, 0x7F, 0x5D, 0x7F, 0x9F, 0xC8, 0xDD, 0x57, 0xB9, 0x47, 0x5C, 0xC8, 0x1C, 0xF0, 0x31,
-    0x12, 0x3E, 0xC3, 0x54, 0x69, 0x64, 0xCD, 0x67, 0xF0, 0x64, 0xCB, 0x90, 0x70, 0x54, 0x26, 0x76,
-    0x63, 0x42, 0x31, 0xE6, 0xB4, 0x53, 0xE5, 0x1F, 0x99, 0x13, 0x27, 0x20, 0x69, 0x42, 0xD6, 0xB1,
-    0xF8, 0x23, 0xFF, 0x3F, 0x5C, 0x1C, 0xD4, 0x6A, 0x4D, 0x38, 0x57, 0x82, 0x28, 0x39, 0x1E, 0xDF,
-    0x93, 0x01, 0x57, 0x09, 0x45, 0xC6, 0x37, 0x9A, 0xF8, 0x6F, 0x65, 0x44, 0x4E, 0x9E, 0x1C, 0xCD,
-    0x26, 0xD9, 0xC9, 0x55, 0x23, 0xC3, 0xFA, 0xC8, 0x21, 0xD3, 0xD0, 0x1C, 0xDB, 0x12, 0x6E, 0x2B,
-    0x4C, 0x17, 0xE0, 0xC2, 0xF7, 0xD7, 0xF4, 0x4C, 0x7A, 0x53, 0x1A, 0x11, 0x90, 0x45, 0x94, 0x91,
-    0xC1, 0x2D, 0x85, 0xAA, 0x5D, 0xDE, 0x6D, 0x4D, 0x19, 0x60, 0xC6, 0xE2, 0x19, 0xA7, 0x97, 0x86,
-    0x42, 0xB7, 0xFF, 0xF1, 0x5B, 0xEF, 0xD3, 0xD8, 0x3A, 0x4A, 0x2E, 0xEE, 0x69, 0xDE, 0x1F, 0x80,
-    0x6D, 0xCF, 0xDB, 0xDC, 0xDC, 0x4C, 0x54, 0x5D, 0x02, 0x79, 0xCA, 0x55, 0xF2, 0xCE, 0xE4, 0xD1,
-    0xC3, 0xBB, 0x7B, 0x7A, 0x7F, 0xCD, 0x7F, 0x7B, 0x12, 0x86, 0x5C, 0x01, 0x17, 0x7A, 0x98, 0x99,
-    0x30, 0x34, 0xE5, 0xA4, 0xFA, 0xB8, 0x09, 0x43, 0xB4, 0x1F, 0xCF, 0x06, 0x6B, 0x9E, 0xCD, 0x0E,
-    0x39, 0x09, 0xDB, 0xE7, 0xDE, 0xC2, 0x30, 0xC0, 0xD1, 0x3E, 0x80, 0xA7, 0xAF, 0x63, 0x9E, 0x5B,
-    0xE7, 0x36, 0x83, 0x5F, 0xB2, 0x5B, 0x9F, 0x06, 0x25, 0xF4, 0xE0, 0x71, 0x25, 0x3A, 0x01, 0x12,
-    0x62, 0x5C, 0x04, 0xDE, 0x3E, 0x1F, 0xB7, 0x89, 0xD1, 0xEF, 0x3C, 0xF3, 0x30, 0x10, 0xE0, 0xE5,
-    0xD2, 0xD7, 0xF4, 0xA0, 0x2B, 0x7A, 0x4F, 0x04, 0xA7, 0xE3, 0x29, 0xD4, 0x4F, 0x92, 0xED, 0x6C,
-    0x92, 0x48, 0x73, 0xA2, 0x5F, 0x54, 0xCE, 0x8F, 0x86, 0x4C, 0x0B, 0xF9, 0x92, 0xC6, 0x47, 0x18,
-    0x0D, 0xAE, 0x4E, 0xA6, 0x8F, 0x9B, 0xDA, 0xCB, 0x28, 0x6E, 0x45, 0x1F, 0xC2, 0x96, 0xC3, 0x18,
-    0x03, 0x9E, 0xC6, 0x02, 0x17, 0x57, 0xE5, 0x34, 0x59, 0x17, 0x19, 0x02, 0x9E, 0xD4, 0x96, 0x3E,
-    0x44, 0x17, 0xA8, 0x7F, 0xE9, 0xB1, 0xB5, 0x94, 0xBE, 0x17, 0x18, 0x03, 0xAF, 0xF4, 0x8E, 0xE6,
-    0x23, 0x9D, 0xE8, 0xB7, 0x36, 0x8B, 0x77, 0x46, 0xC5, 0x17, 0x8D, 0x97, 0x9D, 0xEC, 0xEA, 0xCB,
-    0xA7, 0x56, 0xCE, 0xE7, 0xD1, 0xD1, 0xAB, 0x1B, 0xD0, 0x4C, 0x02, 0xD9, 0x36, 0x22, 0x7B, 0x23,
-    0x59, 0x5D, 0xB1, 0xC5, 0x93, 0xE6, 0xF3, 0x64, 0x37, 0xDE, 0x7C, 0x95, 0x4D, 0xBA, 0x05, 0xB3,
-    0xDF, 0xB0, 0xE5, 0x9E, 0x1D, 0x0F, 0xCF, 0xFD, 0x73, 0x6F, 0x4F, 0x52, 0xAC, 0x5E, 0x4E, 0xA8,
-    0x97, 0xD3, 0x46, 0x12, 0x73, 0xF6, 0xC6, 0xE8, 0xD3, 0x65, 0x5E, 0x7E, 0x02, 0x6B, 0xE5, 0x22,
-    0x2F, 0xFF, 0x13, 0xB3, 0x61, 0xEE, 0xFC, 0x5F, 0xE0, 0x04, 0xA5, 0xA0, 0x73, 0x0F, 0x63, 0x2C,
-    0xF0, 0xBF, 0x77, 0xFB, 0xEA, 0x49, 0xBF, 0x78, 0xCD, 0x95, 0x3A, 0x3A, 0xBB, 0x5C, 0xF2, 0xE8,
-    0x63, 0xFE, 0xF3, 0xA8, 0xE4, 0x79, 0xAF, 0xE2, 0x31, 0xF3, 0x6E, 0xA6, 0x39, 0x27, 0xEF, 0x96,
-    0x3C, 0xF4, 0xB5, 0x79, 0x37, 0x4F, 0x1F, 0xD4, 0xCD, 0xD1, 0xAB, 0x73, 0x52, 0x0F, 0x51, 0x4A,
-    0xE6, 0xD4, 0xD6, 0x40, 0xD4, 0xD7, 0xE6, 0xA4, 0x3E, 0xBD, 0x50, 0xF8, 0x63, 0x90, 0x5F, 0xBD,
-    0x41, 0x24, 0x1A, 0x24, 0x8A, 0xB9, 0x48, 0xA1, 0x93, 0x44, 0xBE, 0x70, 0x7E, 0x6B, 0xA1, 0x4D,
-    0xD6, 0x1F, 0xC9, 0x4F, 0x0F, 0xC9, 0x7C, 0xBA, 0xDA, 0xD7, 0x49, 0xC1, 0x4C, 0xF4, 0x28, 0x5F,
-    0x70, 0x76, 0xB6, 0x43, 0x06, 0x12, 0xED, 0x9A, 0x14, 0xB9, 0xBF, 0xF4, 0xB1, 0x69, 0xD5, 0xB9,
-    0x96, 0x5F, 0x63, 0x84, 0x26, 0xF7, 0x8D, 0xEB, 0x47, 0xDC, 0xD4, 0x12, 0x95, 0xF0, 0xA5, 0x3E,
-    0xF1, 0xE0, 0x2E, 0x0C, 0x0B, 0x7D, 0xED, 0xC7, 0x58, 0x2F, 0x8C, 0x9D, 0xE9, 0x1D, 0xF4, 0x01,
-    0x1F, 0x87, 0x1D, 0x46, 0xB4, 0x05, 0xEF, 0x22, 0xC9, 0x70, 0x8A, 0x9D, 0xEF, 0x89, 0x54, 0xF5,
-    0x22, 0x00, 0xBE, 0x28, 0x96, 0xA2, 0x7A, 0x16, 0x84, 0x32, 0x33, 0x8F, 0x72, 0xE8, 0x85, 0xD8,
-    0xC4, 0x25, 0x8D, 0x93, 0xEE, 0x90, 0x04, 0xE8, 0xDC, 0x52, 0x9B, 0xB4, 0x4B, 0x1A, 0x5F, 0x58,
-    0x52, 0x0F, 0x7C, 0xD2, 0x78, 0xA2, 0x0D, 0x9C, 0x2E, 0xC6, 0x31, 0x8D, 0x87, 0xE9, 0xB3, 0x40,
-    0x82, 0xC9, 0x52, 0x82, 0xDA, 0xC9, 0x07, 0x2C, 0x98, 0xF9, 0x86, 0x3E, 0x25, 0x99, 0xE7, 0xC9,
-    0xE9, 0x78, 0xD1, 0x54, 0xEA, 0xBC, 0x7F, 0xEA, 0xA4, 0x55, 0xA9, 0x7A, 0xA6, 0x82, 0xD1, 0x7E,
-    0x19, 0x36, 0xCF, 0xB7, 0x6B, 0x8C, 0xDC, 0x48, 0xCC, 0x67, 0xDB, 0xB5, 0x9B, 0x65, 0xE2, 0xC0,
-    0x9C, 0x39, 0x6A, 0x5F, 0xEC, 0x34, 0xB1, 0x67, 0xE4, 0x0A, 0x7E, 0xEC, 0x5B, 0x63, 0xA4, 0xE4,
-    0xAF, 0x63, 0xB8, 0x64, 0xCE, 0x74, 0x97, 0x5A, 0x97, 0x7F, 0xF3, 0xDC, 0x27, 0xE9, 0x9F, 0x5A,
-    0xCC, 0x2D, 0x36, 0x0B, 0xB9, 0xC5, 0x07, 0xD4, 0x45, 0xF9, 0x0C, 0x7E, 0x08, 0xD1, 0xA3, 0x31,
-    0x0A, 0x4F, 0x8D, 0xBA, 0x21, 0xB7, 0x98, 0xC9, 0xB1, 0x47, 0x01, 0x1E, 0x3A, 0x38, 0xB7, 0xF8,
-    0xCC, 0x72, 0x6E, 0x71, 0x3A, 0x8B, 0x6A, 0xB3, 0x3E, 0x13, 0xA2, 0x8E, 0x3E, 0x44, 0x7A, 0xAA,
-    0x45, 0xFB, 0x18, 0xCC, 0x4B, 0x83, 0xB8, 0x03, 0x22, 0xBE, 0xD4, 0x03, 0x68, 0x14, 0xE0, 0x87,
-    0x31, 0x43, 0xD1, 0xDE, 0xA8, 0x3C, 0xEB, 0xBD, 0x23, 0x00, 0x71, 0xE0, 0x3B, 0xB2, 0xCB, 0x79,
-    0x75, 0x8A, 0x2C, 0x53, 0xEF, 0xAB, 0x89, 0x5C, 0x01, 0x43, 0x99, 0x31, 0x19, 0x99, 0x1A, 0x01,
-    0xDB, 0x82, 0xB2, 0x1E, 0xB2, 0x7D, 0x97, 0xF3, 0xFC, 0xC9, 0x60, 0x98, 0x1B, 0x11, 0x83, 0xA0,
-    0x41, 0x12, 0xAB, 0x6D, 0x1E, 0xDD, 0x33, 0xB0, 0x97, 0x24, 0x7F, 0x6E, 0x68, 0x20, 0xC1, 0x67,
-    0x84, 0xB2, 0x82, 0xD5, 0xD3, 0xDD, 0xE6, 0x45, 0xAF, 0x31, 0xBD, 0x0D, 0xF4, 0xB6, 0x3F, 0xB0,
-    0xF2, 0xA2, 0x04, 0x08, 0xA4, 0x23, 0x24, 0x72, 0x96, 0x47, 0x58, 0x43, 0xD1, 0x6A, 0xFC, 0xA0,
-    0xD9, 0x05, 0xCC, 0x7E, 0x80, 0xB1, 0x8A, 0x4F, 0xD9, 0xCD, 0xCC, 0x1C, 0x78, 0xCA, 0x7E, 0x16,
-    0xE4, 0xCF, 0xD9, 0x5F, 0x32, 0x0B, 0x99, 0x37, 0xA8, 0x9F, 0xEE, 0x2E, 0x61, 0xB8, 0x6A, 0x5A,
-    0x50, 0x1A, 0x66, 0x01, 0x3E, 0xDA, 0xB7, 0x11, 0x5E, 0xB0, 0xA7, 0xED, 0xF7, 0x6F, 0xD9, 0xFE,
-    0xA5, 0xEA, 0x39, 0xE1, 0x3E, 0xD5, 0x73, 0x0E, 0x5C, 0x88, 0x2C, 0x19, 0x84, 0xA2, 0x28, 0x1E,
-    0xAB, 0xA4, 0x45, 0x65, 0x9F, 0xFE, 0xA6, 0x99, 0x5D, 0xAC, 0x80, 0xC6, 0x72, 0x68, 0xDB, 0xE4,
-    0xB2, 0x2C, 0xCC, 0x86, 0xF1, 0xC8, 0x31, 0x1E, 0xDB, 0x83, 0x4D, 0xB7, 0x85, 0xA2, 0x04, 0x01,
-    0x97, 0x93, 0xD0, 0xAF, 0xA4, 0x71, 0xB2, 0xB6, 0xF2, 0xB7, 0x65, 0x16, 0x31, 0x5F, 0x04, 0xE6,
-    0x0C, 0x2E, 0x26, 0xF4, 0xD6, 0xB0, 0xBB, 0x6A, 0x31, 0x42, 0x87, 0xD9, 0xE3, 0xA5, 0x15, 0x9A,
-    0x01, 0xC0, 0x53, 0x00, 0x4D, 0x95, 0x6E, 0x86, 0x46, 0xB3, 0x74, 0xE9, 0x3A, 0x0D, 0xA7, 0xB0,
-    0x9F, 0x4C, 0xA5, 0xF3, 0xA2, 0x29, 0x5A, 0xAA, 0xDB, 0xAA, 0x89, 0xF5, 0xA1, 0x67, 0xAB, 0xB0,
-    0xA2, 0x5F, 0x05, 0x7F, 0xDD, 0x66, 0x31, 0xB4, 0x77, 0x28, 0xFF, 0x66, 0x68, 0x92, 0x16, 0x83,
-    0x8B, 0x65, 0x21, 0x77, 0x49, 0xD8, 0x99, 0x53, 0x2F, 0xD1, 0x7D, 0x95, 0x9B, 0x13, 0x41, 0x22,
-    0xAB, 0xFF, 0xF2, 0x67, 0xC0, 0xC3, 0x65, 0x71, 0xB1, 0xB2, 0xE7, 0x54, 0x36, 0x29, 0x32, 0x74,
-    0xD9, 0xAB, 0xD4, 0x88, 0x77, 0x76, 0x5C, 0x29, 0x77, 0x5C, 0x1D, 0x57, 0x1A, 0xB3, 0xF2, 0x30,
-    0x6D, 0x3F, 0x58, 0x1E, 0x5F, 0xA9, 0x58, 0xA3, 0x07, 0x11, 0x8B, 0xB3, 0xA1, 0x46, 0x24, 0xFD,
-    0xC8, 0xAD, 0x48, 0xCF, 0x05, 0x6D, 0x57, 0x72, 0xB9, 0x06, 0x02, 0xC9, 0x0D, 0x67, 0x94, 0xD9,
-    0xC7, 0x15, 0xA7, 0x78, 0x8C, 0x87, 0xB6, 0xF4, 0x47, 0xE8, 0xF4, 0xD3, 0x79, 0x08, 0x6F, 0x0E,
-    0x8D, 0x56, 0x72, 0xBD, 0x4F, 0xFE, 0x24, 0xD7, 0xAF, 0x23, 0xC8, 0x36, 0xF1, 0xBB, 0xC4, 0xA2,
-    0x58, 0x5F, 0xE6, 0xF5, 0x69, 0x74, 0xCC, 0xEB, 0x5E, 0x94, 0x67, 0xE6, 0xA5, 0xD0, 0x16, 0xAA,
-    0x57, 0xDE, 0xE4, 0x20, 0x2A, 0x45, 0x49, 0x10, 0x8A, 0xC7, 0xCD, 0xC8, 0x5E, 0x17, 0xF5, 0xFD,
-    0xC2, 0xD7, 0x61, 0xFC, 0x3A, 0x93, 0x3D, 0x19, 0x24, 0xB1, 0xF4, 0x98, 0x6E, 0x61, 0x18, 0xF8,
-    0x8C, 0x57, 0xC6, 0x6A, 0xE8, 0xBE, 0x1C, 0x2B, 0x81, 0x8E, 0xC7, 0x67, 0x54, 0xAD, 0xD1, 0xD4,
-    0xB9, 0x60, 0x27, 0x7D, 0x91, 0xA9, 0xA1, 0xD3, 0x98, 0x46, 0x19, 0x24, 0x56, 0x68, 0x74, 0x5D,
-    0x4C, 0x85, 0xA5, 0x43, 0x82, 0x05, 0x77, 0xD5, 0x18, 0x1D, 0x12, 0xA5, 0x24, 0x86, 0xC3, 0x66,
-    0x5D, 0x58, 0xD4, 0x75, 0xD1, 0xB5, 0x6D, 0x06, 0x65, 0x25, 0x75, 0x82, 0x9A, 0x5F, 0x2D, 0x0B,
-    0x6E, 0x83, 0x28, 0x77, 0x0B, 0x0C, 0x91, 0x22, 0x40, 0x90, 0xEC, 0x64, 0x8A, 0x3E, 0x65, 0x42,
-    0x55, 0x9A, 0xA6, 0x22, 0x80, 0xC3, 0xAA, 0xB0, 0x68, 0x00, 0x41, 0xD7, 0xAF, 0x07, 0xC8, 0x22,
-    0x31, 0x56, 0xE8, 0x53, 0x5A, 0xC9, 0x87, 0xB2, 0x10, 0x63, 0x01, 0xE6, 0x6A, 0x56, 0x34, 0x4F,
-    0xCF, 0x64, 0x25, 0x9F, 0x44, 0x2B, 0xF9, 0xDC, 0x18, 0x2A, 0xF9, 0xA8, 0xB3, 0xE0, 0xF2, 0xB0,
-    0x7B, 0x9E, 0xEA, 0xC1, 0x43, 0x6D, 0xEF, 0x60, 0xEA, 0x25, 0xD4, 0xDE, 0x03, 0x14, 0xDF, 0xA6,
-    0x07, 0xE8, 0x90, 0x7C, 0xCE, 0x6B, 0x3A, 0x56, 0xB1, 0x8D, 0xEC, 0xBE, 0xB7, 0x72, 0xB5, 0x19,
-    0x1E, 0x77, 0x42, 0x07, 0x7D, 0x9D, 0xA5, 0x7E, 0xB6, 0xA6, 0x1A, 0x7C, 0x78, 0x48, 0x23, 0x2B,
-    0x72, 0x48, 0x52, 0x63, 0x65, 0x10, 0xEF, 0x82, 0x25, 0x1C, 0x1F, 0x63, 0x25, 0xAC, 0xB2, 0xEB,
-    0xAF, 0x11, 0xD2, 0x2B, 0x39, 0xA2, 0x47, 0x72, 0x4C, 0xA3, 0x56, 0x40, 0xC2, 0x3C, 0x61, 0x9C,
-    0x6B, 0x4D, 0x37, 0x6E, 0x7C, 0x3F, 0x33, 0x8E, 0x3F, 0x68, 0x0C, 0x85, 0x46, 0x4E, 0x68, 0xBC,
-    0x84, 0x46, 0x4B, 0x70, 0x2F, 0xD4, 0xBC, 0x5E, 0xA3, 0xA9, 0xDF, 0x8C, 0x96, 0xF8, 0x6B, 0xE6,
-    0x7D, 0x92, 0x04, 0x9A, 0x90, 0xE6, 0x84, 0x0A, 0x8D, 0x30, 0x3C, 0x71, 0x00, 0x44, 0xAD, 0x04,
-    0x1F, 0x8C, 0x70, 0x43, 0x34, 0x08, 0x59, 0x25, 0x17, 0x8E, 0xD3, 0x9F, 0xFD, 0x4F, 0xE1, 0x39,
-    0xC4, 0xE4, 0xA5, 0xF9, 0xC0, 0x34, 0x5C, 0x99, 0xCD, 0xF9, 0x81, 0x83, 0x18, 0xAD, 0x1C, 0xD5,
-    0x70, 0xA5, 0xB1, 0xB5, 0x46, 0x23, 0x3E, 0x34, 0x7A, 0x82, 0xAD, 0x45, 0xEC, 0x44, 0x09, 0x36,
-    0x1A, 0xC2, 0x91, 0x5C, 0x69, 0x84, 0x96, 0x71, 0xE6, 0xA4, 0xCC, 0x55, 0xC6, 0x34, 0xAC, 0xF4,
-    0xB5, 0x07, 0x32, 0xEE, 0x03, 0x19, 0xEE, 0xC6, 0x62, 0x11, 0x8F, 0x3F, 0x64, 0xC2, 0x70, 0x46,
-    0x89, 0x80, 0xD4, 0x78, 0x06, 0xF0, 0xDC, 0x09, 0x42, 0x52, 0xF8, 0x1C, 0xA9, 0xF7, 0x0D, 0x52,
-    0x18, 0xD3, 0x6A, 0xD4, 0xB1, 0x5A, 0x90, 0xCB, 0xB5, 0x7D, 0xA9, 0xE5, 0x39, 0xA4, 0xE4, 0x39,
-    0x52, 0xF2, 0x1C, 0x29, 0x79, 0x4E, 0x29, 0xA9, 0xE6, 0x6E, 0xAD, 0x59, 0xEA, 0xB9, 0x6A, 0x41,
-    0xA0, 0xEA, 0xAE, 0xE2, 0x88, 0x29, 0xE2, 0x3F, 0x18, 0x75, 0x22, 0xAC, 0x41, 0xB8, 0xF0, 0x57,
-    0x21, 0xE7, 0x60, 0xF1, 0x36, 0x27, 0x30, 0x27, 0x9B, 0x13, 0xA4, 0xC9, 0x9F, 0x62, 0x2A, 0xB3,
-    0x0D, 0x2E, 0xDB, 0xB5, 0xE5, 0xA8, 0x34, 0xFF, 0xA2, 0xE5, 0x39, 0xA4, 0xCF, 0x09, 0x90, 0xA1,
-    0x79, 0x34, 0x62, 0x9C, 0x01, 0xD2, 0xC7, 0x5B, 0x94, 0x22, 0x39, 0x82, 0x0C, 0x5E, 0xD0, 0xCA,
-    0xE4, 0xC5, 0x41, 0xF3, 0x4A, 0xBE, 0x5F, 0xC5, 0xAC, 0x2B, 0xEF, 0xC9, 0xBC, 0xAA, 0xF6, 0xCE,
-    0xAB, 0x0D, 0x2D, 0xE1, 0xC5, 0x58, 0x26, 0x0D, 0x66, 0x72, 0xF6, 0x0F, 0xDD, 0x50, 0x1E, 0x6B,
-    0x19, 0xE4, 0x44, 0x87, 0x9C, 0x3A, 0x77, 0x87, 0xF4, 0x7A, 0x9F, 0x7E, 0xE8, 0x88, 0xDB, 0xCC,
-    0x3D, 0x99, 0x57, 0xAD, 0xE1, 0xBC, 0xD2, 0xAC, 0x7F, 0x61, 0x41, 0x97, 0x58, 0x30, 0xE9, 0x3C,
-    0x3A, 0xB2, 0x55, 0x9C, 0x1D, 0xD5, 0xE6, 0xD8, 0x38, 0x81, 0x09, 0xE6, 0x9C, 0x5A, 0x62, 0x2A,
-    0x22, 0xB2, 0xEB, 0x51, 0x4D, 0xE6, 0x3A, 0xAA, 0xB9, 0xF7, 0x8C, 0x6A, 0xB6, 0x63, 0x54, 0x1F,
-    0x9B, 0x3B, 0x17, 0x41, 0x38, 0x3D, 0x33, 0xD0, 0xEB, 0x54, 0x1A, 0xAB, 0xD9, 0x47, 0xB9, 0x59,
-    0xAE, 0x88, 0x15, 0x54, 0x6B, 0xB2, 0xAF, 0x11, 0xE5, 0x7E, 0x20, 0x5C, 0xA1, 0x14, 0x14, 0x12,
-    0x9E, 0xF6, 0x10, 0x5E, 0x22, 0x34, 0x5C, 0x2F, 0x7B, 0x2B, 0x86, 0x2D, 0x26, 0x55, 0x7A, 0xA9,
-    0xCB, 0xD2, 0xFA, 0x1C, 0x02, 0x41, 0xAF, 0xCA, 0xD6, 0x37, 0x9E, 0x7E, 0x09, 0x1E, 0xFE, 0x84,
-    0xF1, 0x14, 0xD4, 0xE1, 0x58, 0x8B, 0xE4, 0x7D, 0x2A, 0x72, 0x1C, 0xC8, 0xF1, 0xFB, 0x08, 0x5B,
-    0x1C, 0x57, 0x13, 0xC6, 0x5C, 0xF0, 0x11, 0x08, 0x8A, 0x15, 0xC8, 0x40, 0x1B, 0x48, 0x57, 0x4C,
-    0x61, 0x60, 0x5A, 0x41, 0x2C, 0x9A, 0x8B, 0x2D, 0xFC, 0xF6, 0xC1, 0xAD, 0xC7, 0x74, 0x66, 0xA8,
-    0xC7, 0x14, 0x38, 0x0D, 0xC9, 0xCB, 0x9D, 0xC5, 0x24, 0x59, 0xD4, 0xF0, 0x9C, 0x0D, 0xDC, 0x39,
-    0xFA, 0xC6, 0x3D, 0x8A, 0x19, 0xBD, 0x23, 0x4B, 0xF1, 0x69, 0x7B, 0x11, 0x81, 0x3B, 0x0C, 0xC3,
-    0xB9, 0xD9, 0xFF, 0x7D, 0xC4, 0xCE, 0x66, 0x73, 0x8B, 0x33, 0xF5, 0x6E, 0x32, 0xBD, 0x8E, 0xD8,
-    0x8B, 0xFA, 0x94, 0xF9, 0x4E, 0xE9, 0xF6, 0xC7, 0x45, 0xF8, 0xDA, 0x22, 0x54, 0x72, 0xB7, 0x24,
-    0xF7, 0xDB, 0xAD, 0x16, 0x6F, 0x3A, 0xA5, 0xFD, 0x3E, 0xBA, 0x84, 0x1E, 0xFE, 0x64, 0xC9, 0x5D,
-    0x2C, 0x93, 0xDB, 0xB0, 0x5F, 0xB6, 0x00, 0xF9, 0xBA, 0x2D, 0x48, 0x7C, 0x1E, 0x56, 0x25, 0xBA,
-    0xEF, 0x2D, 0x21, 0x63, 0x76, 0x21, 0xA5, 0xA2, 0x23, 0xE3, 0xFE, 0xA7, 0x2C, 0x21, 0xDE, 0xDA,
-    0x28, 0x35, 0x37, 0x8C, 0x23, 0x67, 0xEE, 0xC2, 0xA7, 0xA8, 0xE5, 0xD8, 0xDE, 0x42, 0xDA, 0xC7,
-    0x05, 0x0E, 0x81, 0x87, 0x77, 0x7C, 0x00, 0x65, 0x54, 0x0F, 0x6C, 0xE6, 0x7E, 0x4A, 0x2B, 0x77,
-    0xE0, 0x37, 0xEE, 0xC0, 0xEB, 0xFA, 0xAB, 0xF2, 0xFE, 0x80, 0x41, 0x19, 0x2C, 0xDE, 0x96, 0xB9,
-    0x03, 0xEA, 0xD0, 0x7A, 0x40, 0x29, 0x1D, 0x07, 0x67, 0x50, 0xA7, 0xF8, 0xBA, 0x1C, 0xE4, 0xC8,
-    0xE7, 0x6B, 0x5C, 0x00, 0xF6, 0x42, 0x3E, 0x96, 0xDB, 0xEA, 0x7A, 0x71, 0xC8, 0x15, 0x81, 0x53,
-    0x6B, 0x45, 0xEB, 0x4E, 0x70, 0x3B, 0x35, 0x03, 0x6B, 0x9C, 0x8B, 0xC8, 0x5D, 0x8C, 0x88, 0x02,
-    0x96, 0x9E, 0x92, 0xE5, 0x2E, 0x6A, 0xD8, 0x25, 0xA8, 0xE6, 0x9E, 0x16, 0x1F, 0xE9, 0xCB, 0x8F,
-    0xDC, 0x16, 0xB6, 0x9D, 0xC3, 0x56, 0xA3, 0x88, 0x58, 0xFF, 0xC1, 0x25, 0x40, 0x29, 0x4E, 0x1D,
-    0xA6, 0x26, 0xC0, 0x68, 0x7B, 0x8F, 0x35, 0x1B, 0xA2, 0x4C, 0xC6, 0x0C, 0x71, 0xE6, 0x19, 0xCB,
-    0x16, 0x95, 0x51, 0xD6, 0x1B, 0xF9, 0x97, 0xB1, 0xF6, 0xAE, 0x52, 0x23, 0x8C, 0x37, 0x53, 0x6B,
-    0x9D, 0xD7, 0xB8, 0x92, 0x4C, 0xF9, 0x96, 0xF6, 0xEC, 0x48, 0x97, 0xCC, 0xFD, 0x61, 0x35, 0xFB,
-    0xCC, 0x09, 0x05, 0x19, 0x4A, 0xF7, 0x13, 0x59, 0x62, 0xD2, 0x69, 0x94, 0xD8, 0xA0, 0xD1, 0xA2,
-    0xCD, 0x85, 0x92, 0x7E, 0x25, 0xF2, 0x6D, 0x81, 0x02, 0x27, 0x71, 0x86, 0xD0, 0x2A, 0xC4, 0x75,
-    0xC0, 0x55, 0x15, 0xF5, 0xB0, 0x5A, 0x82, 0x05, 0xCA, 0x45, 0x21, 0xF0, 0x0A, 0xD1, 0x1B, 0xB8,
-    0x2A, 0x2C, 0x83, 0x0A, 0x77, 0x41, 0x66, 0x0A, 0x2A, 0x69, 0xB0, 0xEA, 0x9A, 0xD5, 0xE8, 0x8D,
-    0x12, 0x3E, 0x5C, 0xBB, 0x73, 0x55, 0x68, 0xFD, 0xAC, 0xAA, 0x15, 0x7D, 0x14, 0x47, 0x04, 0xD3,
-    0xBA, 0xBD, 0xE4, 0x56, 0xBD, 0xE6, 0xDB, 0x64, 0x01, 0x4A, 0x56, 0xC6, 0xB9, 0x88, 0xDB, 0xDB,
-    0xD2, 0x0E, 0xD9, 0xA2, 0x4A, 0x80, 0x2A, 0xF6, 0x06, 0xC0, 0x3F, 0x93, 0x36, 0x28, 0x27, 0x99,
-    0x9C, 0x12, 0x16, 0xF1, 0x44, 0x9E, 0x2C, 0xF7, 0xF2, 0xBA, 0x33, 0x2D, 0x5D, 0x93, 0xD2, 0xCD,
-    0xE7, 0x26, 0xB3, 0x4F, 0xCA, 0x4D, 0xB1, 0xAB, 0xAE, 0xD9, 0xD4, 0x4D, 0x2E, 0xB2, 0x57, 0x5A,
-    0xD1, 0x18, 0x45, 0xA8, 0x16, 0x43, 0x80, 0xAD, 0x69, 0x9F, 0x62, 0x7B, 0x68, 0x21, 0x7D, 0xEA,
-    0xE3, 0xB9, 0x29, 0xFE, 0x79, 0x30, 0xF3, 0x2A, 0x8A, 0x1E, 0x48, 0xEE, 0xE1, 0x83, 0x2A, 0x67,
-    0xEC, 0x5A, 0xD5, 0x38, 0xF8, 0x87, 0x9B, 0xDE, 0x41, 0xCB, 0x69, 0xDE, 0xB2, 0xD6, 0xDA, 0x29,
-    0x59, 0x5A, 0xA7, 0xCE, 0xA3, 0x24, 0xE8, 0x39, 0x01, 0x0F, 0x9F, 0x45, 0xF5, 0xB0, 0xDB, 0xD7,
-    0xFF, 0x6F, 0x13, 0xB8, 0x32, 0x6B, 0xED, 0x10, 0x26, 0x71, 0x6D, 0x70, 0xFC, 0x1F, 0x1B, 0x12,
-    0x26, 0x3E, 0xA3, 0x00, 0xAD, 0x9A, 0xC6, 0x97, 0x84, 0x49, 0xAE, 0x7A, 0xF5, 0x78, 0x7A, 0xCE,
-    0x13, 0xF1, 0xE1, 0xAC, 0x68, 0xE1, 0xE5, 0x23, 0x02, 0x4E, 0x9B, 0xB9, 0x61, 0xE7, 0x36, 0x80,
-    0xB3, 0xFD, 0x5C, 0x34, 0x2E, 0x7B, 0x8A, 0x93, 0x4B, 0x77, 0x94, 0x6A, 0xD8, 0x43, 0xE6, 0xE0,
-    0x2F, 0xC1, 0x2E, 0x43, 0x59, 0x76, 0xF6, 0xE2, 0x43, 0xB6, 0x44, 0xA6, 0x42, 0xCA, 0x6D, 0xEE,
-    0x3C, 0x7B, 0x71, 0x85, 0xE4, 0xAE, 0x58, 0x17, 0x10, 0x51, 0x6B, 0x25, 0xE4, 0x19, 0x5F, 0x05,
-    0x08, 0xC6, 0x3B, 0x7A, 0x0D, 0x35, 0xA4, 0xED, 0x73, 0xF3, 0xB0, 0x64, 0xD5, 0x61, 0xD5, 0xF8,
-    0x7E, 0x3B, 0x90, 0xD3, 0xE9, 0x70, 0xBE, 0x93, 0xB8, 0xB0, 0xF8, 0xDC, 0x26, 0x48, 0xD5, 0x48,
-    0xB6, 0x76, 0xA7, 0x6A, 0x8C, 0xEA, 0x21, 0x55, 0xA3, 0xC5, 0xF8, 0xE6, 0x50, 0x2E, 0x62, 0x74,
-    0x23, 0xCE, 0x90, 0xD8, 0xFC, 0x3A, 0x5A, 0xC8, 0xEC, 0xE6, 0x5F, 0xA0, 0xA2, 0x33, 0x53, 0x9C,
-    0xED, 0xA0, 0x04, 0xDE, 0x34, 0x2A, 0x9E, 0xE2, 0x16, 0xF6, 0x0E, 0x50, 0xE3, 0x5E, 0x52, 0xE4,
-    0xF0, 0x99, 0xB7, 0x12, 0xF7, 0x1E, 0x07, 0xF3, 0xD8, 0xFA, 0x5B, 0xA7, 0xEF, 0x33, 0x45, 0x18,
-    0x9C, 0x60, 0x36, 0xBB, 0xEF, 0xDF, 0x92, 0x22, 0xE5, 0x04, 0x59, 0x9D, 0xAE, 0xBC, 0xDD, 0x68,
-    0xFF, 0xF2, 0x76, 0x88, 0xBD, 0x1B, 0xCA, 0xDB, 0x55, 0x07, 0x94, 0xB7, 0x9B, 0x2E, 0x94, 0xB7,
-    0xE3, 0x7C, 0xFD, 0x31, 0xCB, 0xDB, 0x65, 0x5A, 0xDE, 0x2E, 0xD5, 0xF2, 0x76, 0x05, 0x08, 0x0D,
-    0x16, 0x53, 0x51, 0x4D, 0xE8, 0xCB, 0xDB, 0x4D, 0xA0, 0x26, 0x30, 0xD3, 0x6F, 0xD0, 0xC3, 0xBD,
-    0x5B, 0x28, 0xA1, 0xBB, 0x13, 0xE1, 0xBB, 0xBB, 0x90, 0x08, 0xBF, 0x83, 0x44, 0xF8, 0x6E, 0x88,
-    0x57, 0x39, 0x35, 0x18, 0xDB, 0x8F, 0x0E, 0x15, 0xF8, 0x15, 0x60, 0x5D, 0xBF, 0x61, 0x69, 0x84,
-    0x46, 0xF6, 0x7A, 0x22, 0x42, 0x5A, 0x50, 0x4C, 0x4A, 0x73, 0xDE, 0x79, 0x31, 0xCE, 0x39, 0x7C,
-    0x16, 0xCA, 0x55, 0xE8, 0xA2, 0xDA, 0xEF, 0x07, 0x76, 0x6E, 0x11, 0x73, 0x46, 0x44, 0xAE, 0xAD,
-    0x9D, 0xC4, 0x55, 0xE7, 0x73, 0x3B, 0x6F, 0xEE, 0xF0, 0xC4, 0x61, 0xE7, 0x1B, 0x71, 0x5A, 0xF4,
-    0x7E, 0x58, 0xFA, 0xDB, 0x46, 0x76, 0x16, 0x6F, 0xDD, 0x68, 0x85, 0x13, 0xAD, 0xFA, 0xE5, 0x49,
-    0xD0, 0xDD, 0x2F, 0x8F, 0x0A, 0x91, 0xCF, 0xFA, 0xE5, 0xC3, 0x32, 0xC3, 0x1E, 0xF1, 0xCB, 0xC3,
-    0x98, 0x68, 0x1A, 0xF5, 0xFE, 0xF1, 0x50, 0xAB, 0x61, 0x37, 0x32, 0x08, 0xEB, 0x37, 0x36, 0x37,
-    0x45, 0x42, 0xB7, 0xFD, 0xCB, 0x34, 0x9C, 0x07, 0xDD, 0xA5, 0x64, 0xCD, 0xD1, 0x65, 0xE7, 0xD6,
-    0x5D, 0x46, 0x31, 0x6B, 0x0A, 0x1A, 0x2D, 0x2A, 0x68, 0x5C, 0x55, 0x41, 0x16, 0x0B, 0xA4, 0xE2,
-    0x7C, 0xBB, 0xC8, 0x5D, 0x60, 0x5D, 0x78, 0x59, 0xE6, 0xC3, 0x05, 0x2C, 0xFB, 0x31, 0x5C, 0xA4,
-    0xBE, 0x65, 0x3C, 0x92, 0xEC, 0x79, 0x4E, 0x6E, 0xBB, 0x0D, 0xA4, 0x0B, 0x46, 0x2B, 0x0D, 0x22,
-    0x87, 0x63, 0xBF, 0x62, 0x89, 0xFB, 0x56, 0x49, 0xF4, 0x7B, 0x94, 0xDA, 0x37, 0xE9, 0x7F, 0x7B,
-    0x39, 0xA7, 0xFB, 0x0D, 0x9B, 0x3E, 0x7D, 0x47, 0x02, 0x83, 0x7D, 0x21, 0xFD, 0x29, 0x5E, 0xF7,
-    0x3C, 0xDF, 0xFA, 0x62, 0xFF, 0xD3, 0x14, 0x61, 0xD2, 0x5A, 0x55, 0x7F, 0x2F, 0x64, 0x38, 0x91,
-    0x97, 0xDE, 0x20, 0x53, 0xD9, 0x6B, 0x75, 0x09, 0x0E, 0xB4, 0xBD, 0x7C, 0x94, 0x12, 0x8E, 0x5E,
-    0x06, 0x38, 0x9A, 0xA2, 0x78, 0xE3, 0x02, 0xB4, 0x84, 0xE9, 0x8F, 0xA7, 0xBB, 0x4B, 0x38, 0x7E,
-    0x0E, 0xDF, 0x9B, 0xD1, 0x01, 0x90, 0x77, 0xDB, 0x53, 0xC2, 0xF1, 0x56, 0x95, 0x25, 0x9E, 0x41,
-    0x70, 0xC9, 0x33, 0xA8, 0x2C, 0xF1, 0x0C, 0x2A, 0x4B, 0x5C, 0x18, 0x2A, 0x4B, 0x6C, 0xA3, 0xB2,
-    0x04, 0xBE, 0x73, 0x60, 0x9F, 0xCA, 0x12, 0x55, 0x9F, 0xCE, 0xE2, 0xA4, 0xCF, 0xD1, 0x6D, 0xC1,
-    0x40, 0xE8, 0x3F, 0x6A, 0xE9, 0x73, 0xB2, 0xD7, 0x57, 0x3A, 0x0A, 0x10, 0xB9, 0x7B, 0x35, 0x8A,
-    0x66, 0x22, 0xDC, 0x0E, 0xA4, 0xBA, 0x93, 0xA9, 0x02, 0xC1, 0x1A, 0xBB, 0xDD, 0x63, 0x5A, 0x58,
-    0x75, 0xC1, 0x7A, 0x37, 0x5A, 0x60, 0xA2, 0xFB, 0x41, 0x9C, 0x0B, 0x87, 0x93, 0xC0, 0x0F, 0xB3,
-    0xB4, 0x80, 0x1E, 0x23, 0x5D, 0x65, 0xF6, 0x3E, 0x60, 0x50, 0xF6, 0xB0, 0xFE, 0x68, 0x50, 0xAD,
-    0x61, 0x47, 0x6C, 0x12, 0xEC, 0xC0, 0x47, 0x15, 0xD8, 0x45, 0x9F, 0x69, 0xA7, 0xC1, 0x0D, 0x54,
-    0x56, 0xE2, 0x82, 0x0D, 0xCD, 0xB9, 0xBC, 0x3C, 0xD5, 0x8A, 0x18, 0x17, 0xAD, 0x4B, 0x3C, 0xCE,
-    0x4E, 0xC1, 0x46, 0x11, 0x65, 0xD7, 0x42, 0xEE, 0xC9, 0xC8, 0xDB, 0x41, 0x51, 0x20, 0x70, 0xEF,
-    0x49, 0x11, 0x6B, 0x01, 0x8B, 0x15, 0x57, 0xC7, 0xC2, 0x05, 0xC0, 0xF5, 0xA8, 0x5A, 0x0C, 0xB5,
-    0x74, 0xFC, 0x42, 0x15, 0x1F, 0x27, 0xB1, 0x71, 0x2D, 0x07, 0x0C, 0xBB, 0xF5, 0xB6, 0x75, 0xAE,
-    0xD4, 0x6A, 0x23, 0xDF, 0xD8, 0xE5, 0xEA, 0x66, 0x5C, 0x84, 0xDD, 0x9A, 0xB2, 0xC0, 0xCF, 0x21,
-    0xF8, 0x1F, 0x2F, 0xC0, 0xCF, 0x71, 0x55, 0x26, 0x43, 0x7B, 0x4D, 0xE6, 0x5C, 0x97, 0xE6, 0x6F,
-    0x6F, 0x76, 0x13, 0x66, 0xB1, 0xA5, 0xDF, 0x59, 0x7B, 0x4E, 0xB5, 0x1A, 0x82, 0xC9, 0x90, 0x6C,
-    0x2F, 0x2D, 0x79, 0xDC, 0xE5, 0xE0, 0x50, 0x3E, 0x18, 0xEA, 0xBB, 0x7D, 0xEA, 0x28, 0xA3, 0xAF,
-    0xEC, 0xE8, 0xEF, 0xE3, 0x4A, 0x6C, 0x6A, 0x36, 0x51, 0x1F, 0xC9, 0xB3, 0x8C, 0xEE, 0x0D, 0x0D,
-    0xFB, 0x1A, 0x79, 0x7E, 0x33, 0x64, 0x2B, 0xCF, 0xE5, 0xE0, 0x72, 0x01, 0xDC, 0xF9, 0xCB, 0xA4,
-    0xCE, 0xB8, 0x37, 0x55, 0xC9, 0x9E, 0xA2, 0xC1, 0x96, 0xF4, 0x06, 0xAA, 0x85, 0xB2, 0x0F, 0x71,
-    0x4E, 0xDF, 0x75, 0x7E, 0x8D, 0x95, 0x2E, 0xD9, 0x37, 0xA2, 0xE3, 0x0F, 0xF7, 0xBD, 0x0C, 0x8E,
-    0x2A, 0x8E, 0x26, 0x8E, 0x22, 0x8E, 0x1E, 0xFB, 0x50, 0xE3, 0xFE, 0x96, 0xD9, 0xBB, 0x1B, 0xBE,
-    0x16, 0x1A, 0x85, 0xAC, 0xB3, 0x08, 0xA9, 0x39, 0x48, 0x6D, 0x41, 0xCE, 0x10, 0x94, 0x2F, 0xF2,
-    0xF1, 0x6C, 0x5E, 0x79, 0x5D, 0x2D, 0x3F, 0x34, 0xFB, 0xA8, 0xCD, 0xC7, 0x09, 0x03, 0x51, 0xBF,
-    0xBF, 0x1E, 0xE6, 0x02, 0x3F, 0xC5, 0xD5, 0x9E, 0x72, 0xE9, 0xAB, 0x79, 0x47, 0xB3, 0x54, 0x76,
-    0xE7, 0x89, 0x80, 0xB5, 0xD6, 0x4F, 0xDB, 0x8D, 0x18, 0x49, 0x57, 0xD7, 0x2E, 0xC8, 0x7E, 0x5A,
-    0x3D, 0x6E, 0x48, 0xB7, 0x06, 0x1A, 0x0B, 0x69, 0xD6, 0x5E, 0xA0, 0xC5, 0x0D, 0xF9, 0xAA, 0x7F,
-    0xA3, 0x21, 0x15, 0xA5, 0x5A, 0x68, 0x1A, 0x97, 0x7D, 0xA5, 0x29, 0x58, 0x50, 0x08, 0xB6, 0x31,
-    0xB0, 0xDB, 0xA9, 0xE6, 0x33, 0x3A, 0x8D, 0xD6, 0x05, 0x46, 0x06, 0x08, 0x44, 0x08, 0x33, 0x16,
-    0x2F, 0x10, 0xF9, 0x20, 0xB8, 0x81, 0xC2, 0x8C, 0xF9, 0x75, 0xF3, 0xC0, 0xBC, 0x00, 0xE1, 0xB7,
-    0x7C, 0x01, 0x42, 0x77, 0x68, 0x5E, 0xAC, 0x60, 0x31, 0x32, 0xE6, 0xCA, 0x5C, 0x4A, 0x54, 0x5D,
-    0x79, 0x5C, 0xDD, 0x8B, 0x0A, 0x7E, 0xBF, 0x81, 0x54, 0xD8, 0x1E, 0x5A, 0x2A, 0x1A, 0x70, 0xB9,
-    0x67, 0x49, 0x7C, 0xB0, 0x1A, 0x4A, 0xA6, 0x0F, 0xA8, 0x45, 0x7D, 0x42, 0x13, 0x2F, 0x10, 0xA6,
-    0xA6, 0xB3, 0x45, 0x3A, 0x0B, 0x5D, 0x9C, 0x0D, 0x82, 0xE9, 0x1F, 0xAB, 0x09, 0xE4, 0x94, 0x0B,
-    0xE9, 0x61, 0x70, 0xBE, 0x9B, 0xA1, 0xD2, 0x98, 0x1D, 0x4D, 0xAD, 0xBE, 0x77, 0x86, 0x75, 0x81,
-    0x98, 0xA8, 0x0D, 0x55, 0xD7, 0x3D, 0xB5, 0x98, 0x21, 0xDA, 0xAC, 0x70, 0x3B, 0x98, 0x30, 0x22,
-    0x70, 0x82, 0xF9, 0xAA, 0x13, 0xD6, 0x20, 0xDD, 0xDB, 0x3C, 0xA8, 0xDE, 0x0C, 0x67, 0x5E, 0xBF,
-    0x91, 0xA8, 0x79, 0x7D, 0x29, 0x5E, 0xCD, 0x95, 0x8A, 0x09, 0x97, 0x4A, 0xA8, 0x1F, 0x5F, 0x4A,
-    0x36, 0xB9, 0x6A, 0xB4, 0xC2, 0x22, 0xEB, 0x36, 0x2E, 0x84, 0x92, 0x15, 0x07, 0x43, 0x4D, 0x8C,
-    0x45, 0xFD, 0xC6, 0x5B, 0x9D, 0xC9, 0xBB, 0xF5, 0xC1, 0x68, 0x7D, 0x1D, 0xC7, 0xD0, 0x0C, 0x4A,
-    0xB1, 0xDA, 0xBC, 0xDC, 0x92, 0xBB, 0x3A, 0x57, 0xD9, 0xB1, 0x3C, 0xF6, 0xAA, 0x03, 0xED, 0xA0,
-    0x0E, 0xDC, 0x0A, 0xEA, 0x99, 0xAA, 0x72, 0xA9, 0xC6, 0xA5, 0x0A, 0x97, 0xD3, 0xB7, 0x7A, 0x75,
-    0xEB, 0xE6, 0x70, 0x59, 0x1D, 0x18, 0x52, 0x3A, 0x9C, 0x49, 0x26, 0x99, 0x77, 0xE5, 0xE1, 0x65,
-    0xF8, 0x09, 0xA8, 0x57, 0x50, 0x24, 0x9C, 0x7A, 0xA5, 0x02, 0x98, 0x86, 0xBC, 0xEE, 0x7D, 0x03,
-    0xDA, 0x1C, 0xA2, 0x10, 0x31, 0x5E, 0xD7, 0x89, 0x14, 0x41, 0x13, 0x77, 0x19, 0xAA, 0x82, 0xC2,
-    0x10, 0x35, 0x82, 0x59, 0xE3, 0xBF, 0x0B, 0xFE, 0x47, 0xB9, 0xF8, 0x03, 0xC1, 0xFF, 0xBB, 0x32,
-    0xDE, 0xAF, 0x05, 0xFF, 0x83, 0x7C, 0x7E, 0x0A, 0x5C, 0x9B, 0xF1, 0x8F, 0x04, 0xBF, 0x29, 0x7B,
-    0xD5, 0xB7, 0x04, 0x4F, 0x85, 0xAB, 0x23, 0xFB, 0x7D, 0xBA, 0x6D, 0x42, 0xE2, 0xD4, 0x3C, 0x41,
-    0x1C, 0x27, 0xAB, 0xC4, 0x51, 0xA6, 0x78, 0x52, 0x5C, 0x26, 0x0E, 0xA7, 0x15, 0x71, 0x50, 0x95,
-    0xC4, 0xE3, 0xDF, 0x4D, 0x15, 0x7F, 0x58, 0x10, 0x7B, 0x34, 0x12, 0x8F, 0xA6, 0xC6, 0x22, 0x52,
-    0x67, 0x0C, 0x67, 0xAA, 0xC8, 0x6B, 0x67, 0x76, 0x64, 0x73, 0x5F, 0x47, 0xB9, 0x39, 0x99, 0x1E,
-    0x7D, 0x34, 0xE6, 0x20, 0x18, 0xF6, 0x51, 0xC1, 0xBD, 0xD1, 0xA1, 0x0F, 0x4A, 0x9D, 0xEC, 0x4A,
-    0x1D, 0x3A, 0x75, 0x9F, 0x4A, 0xA2, 0x66, 0x5A, 0x12, 0xF5, 0x66, 0x31, 0xA4, 0x4B, 0x0D, 0x3E,
-    0xD5, 0xAF, 0xC9, 0xBB, 0x26, 0x73, 0x8E, 0x0A, 0x78, 0x2D, 0x03, 0xE5, 0x62, 0xC8, 0x16, 0x32,
-    0x2C, 0xDC, 0x66, 0xCC, 0xBF, 0xF9, 0xCD, 0x6E, 0xB9, 0xCA, 0x3F, 0xE0, 0x05, 0x79, 0x27, 0xEF,
-    0xCB, 0x0B, 0xF2, 0x46, 0x85, 0xC8, 0x4D, 0xFE, 0xD4, 0x47, 0x12, 0x2B, 0x54, 0xC2, 0x0E, 0x76,
-    0xC2, 0xA7, 0x7F, 0xBB, 0x14, 0x7A, 0x0E, 0x8D, 0xC7, 0xDF, 0xC9, 0x6F, 0xAF, 0x7E, 0x37, 0x5C,
-    0x1B, 0x28, 0xE2, 0x84, 0x8A, 0x74, 0x8B, 0xF5, 0xBB, 0x63, 0xAD, 0xDF, 0xFD, 0xD4, 0x50, 0xBF,
-    0xFB, 0xE5, 0xBE, 0x7E, 0xB7, 0x57, 0x3E, 0xC4, 0xBB, 0x68, 0xE5, 0x28, 0x1A, 0x0A, 0xCA, 0xC9,
-    0xFE, 0xE1, 0xD6, 0x0F, 0x16, 0xED, 0xCC, 0xC5, 0x00, 0x75, 0xC7, 0xB0, 0x35, 0xA0, 0x04, 0xC3,
-    0x9E, 0x92, 0x74, 0x9F, 0x00, 0xED, 0x8C, 0x2B, 0x9C, 0x60, 0x56, 0x72, 0xA7, 0x52, 0x7C, 0xA3,
-    0xD6, 0x38, 0xF2, 0xDF, 0xD5, 0x6C, 0xB7, 0xF7, 0x73, 0xC5, 0xE3, 0x1F, 0xD6, 0x5C, 0xCE, 0xFE,
-    0x37, 0x55, 0x85, 0x0C, 0xD5, 0xE8, 0x60, 0x8E, 0x3A, 0xBC, 0xEA, 0xF0, 0x39, 0xD9, 0x24, 0xA1,
-    0xED, 0x56, 0x7C, 0xC1, 0x1D, 0x5E, 0x0A, 0x85, 0x77, 0xDC, 0x21, 0xFA, 0x51, 0xED, 0xBD, 0x6F,
-    0x5F, 0xAA, 0xCD, 0x5C, 0xD7, 0x94, 0x1D, 0x45, 0xBF, 0x5F, 0x75, 0xF8, 0x32, 0xF1, 0x5F, 0x9A,
-    0x8A, 0xF8, 0x35, 0x61, 0x91, 0xC0, 0x95, 0xCF, 0x50, 0xE9, 0x51, 0x25, 0xD4, 0x3B, 0x23, 0x3B,
-    0x59, 0x25, 0xF4, 0xB3, 0xB6, 0xCF, 0x90, 0x21, 0x95, 0x46, 0xB6, 0x04, 0x9D, 0xFE, 0xF1, 0x1D,
-    0x58, 0x35, 0x02, 0xCB, 0xC4, 0xE8, 0x31, 0xF2, 0xA9, 0x7D, 0x7D, 0x93, 0x21, 0x59, 0x6F, 0xA8,
-    0x05, 0xC7, 0x60, 0xF6, 0x78, 0xE1, 0xC6, 0xE6, 0xD6, 0x54, 0x6D, 0x8D, 0x53, 0xA1, 0xDB, 0xFB,
-    0x6B, 0x6B, 0x09, 0xEB, 0xEE, 0x19, 0x2D, 0xA2, 0xDE, 0xA7, 0x70, 0xAB, 0xFB, 0x17, 0x5F, 0x86,
-    0x22, 0xF3, 0x27, 0x71, 0x76, 0x3C, 0xCD, 0x82, 0x6C, 0x62, 0x6B, 0x51, 0x61, 0x91, 0x19, 0x43,
-    0xFF, 0xE4, 0xA3, 0xFA, 0xD6, 0x1B, 0xEA, 0x47, 0xD4, 0x8E, 0xA8, 0x1B, 0x51, 0x33, 0x5A, 0xD6,
-    0x8B, 0x0E, 0x7A, 0x57, 0xE0, 0x00, 0xF6, 0x7B, 0x57, 0xE0, 0xE9, 0x8F, 0xF1, 0xAE, 0x40, 0x70,
-    0xA4, 0x8A, 0x94, 0xE2, 0xBB, 0x02, 0xBD, 0xE9, 0x38, 0xF3, 0xCB, 0x71, 0x89, 0x25, 0xCA, 0x15,
-    0xBA, 0xB8, 0x40, 0xE9, 0xB9, 0xCB, 0x85, 0xB9, 0xD3, 0x73, 0x37, 0xC3, 0x4B, 0x2E, 0x5D, 0xF1,
-    0xC3, 0x26, 0x16, 0x49, 0x0D, 0x33, 0x3B, 0x5E, 0x5B, 0x7B, 0x6E, 0xD1, 0x73, 0x37, 0x51, 0xCF,
-    0xDD, 0x93, 0xFE, 0xCC, 0x9B, 0x0D, 0x9E, 0xBB, 0xB9, 0x25, 0x85, 0x55, 0x78, 0xF8, 0x0A, 0x4C,
-    0xBC, 0xD7, 0x47, 0x66, 0x95, 0x4C, 0x73, 0xCD, 0x2F, 0x50, 0x33, 0x84, 0x5A, 0xD1, 0x5C, 0x04,
-    0x50, 0xB7, 0x50, 0x8A, 0x20, 0x77, 0x50, 0x5F, 0xE0, 0xEB, 0x60, 0xC2, 0x6F, 0x50, 0x1F, 0x82,
-    0xD2, 0xA9, 0xC2, 0x8E, 0xB5, 0x80, 0x5A, 0x27, 0x56, 0x69, 0x44, 0xBE, 0x86, 0x65, 0xEA, 0x6B,
-    0xDD, 0x4C, 0xFE, 0x37, 0x9A, 0xBB, 0x89, 0x72, 0x77, 0x7D, 0x99, 0x7F, 0x59, 0x25, 0x35, 0x9C,
-    0x31, 0xC9, 0x24, 0x89, 0x8A, 0x2F, 0x68, 0xE8, 0xCD, 0x4C, 0xCD, 0x67, 0x58, 0xB7, 0xFA, 0x49,
-    0xA5, 0xBF, 0xE9, 0xE6, 0xA5, 0x26, 0x35, 0xA0, 0x01, 0x0A, 0x41, 0x82, 0xA7, 0x8C, 0x2B, 0x38,
-    0x8A, 0x65, 0x82, 0x65, 0xDC, 0xA2, 0xA0, 0x9B, 0x3D, 0x44, 0xA1, 0x9F, 0x75, 0x77, 0x1C, 0x9C,
-    0xCC, 0x33, 0xCB, 0x96, 0x53, 0xDD, 0x1E, 0x44, 0x7A, 0x78, 0xD3, 0xCF, 0x33, 0x43, 0x55, 0x3E,
-    0xD9, 0x6E, 0x7E, 0x79, 0x57, 0xE9, 0x64, 0xCC, 0x17, 0xFB, 0xB0, 0xD7, 0xB4, 0xCF, 0x19, 0x1F,
-    0x0E, 0x4E, 0x8E, 0xCA, 0x9B, 0x27, 0xC8, 0xFC, 0xE1, 0x9A, 0x53, 0x1C, 0x55, 0x1C, 0x29, 0x1C,
-    0x3A, 0x98, 0x1E, 0xF7, 0xF9, 0xAD, 0x05, 0x67, 0xA1, 0x9C, 0x34, 0xD8, 0xFC, 0x08, 0xAE, 0xF8,
-    0xC5, 0xDE, 0xAD, 0xEA, 0x3E, 0xBE, 0xB3, 0xD3, 0xCF, 0xBE, 0xC0, 0x60, 0xDC, 0x50, 0xE4, 0xDC,
-    0x20, 0x3B, 0xBF, 0x2B, 0x09, 0xFA, 0xEE, 0xBD, 0x6D, 0x01, 0xE5, 0x55, 0x38, 0x5D, 0x00, 0x18,
-    0x60, 0x3A, 0x33, 0x9F, 0x81, 0x24, 0x7F, 0x48, 0x85, 0xDA, 0x93, 0xBD, 0x52, 0xC4, 0x71, 0xE4,
-    0x34, 0x8B, 0x5E, 0xA5, 0xAA, 0x2C, 0x44, 0x7B, 0xEC, 0x4C, 0x33, 0x38, 0x7F, 0xD2, 0xEC, 0xA0,
-    0x70, 0xE6, 0x62, 0xDF, 0x70, 0x66, 0x74, 0x12, 0xF9, 0xF2, 0xF2, 0xC1, 0xDE, 0x53, 0x1D, 0x97,
-    0x89, 0xFF, 0x8C, 0x3C, 0xF3, 0x10, 0x1F, 0x79, 0x45, 0xE3, 0xB2, 0xB9, 0x16, 0x70, 0xDF, 0xD3,
-    0x64, 0xEB, 0x32, 0x24, 0x53, 0xB5, 0x00, 0x8F, 0xFA, 0x84, 0x85, 0x76, 0xE1, 0x83, 0x97, 0x10,
-    0x34, 0xE7, 0x45, 0x95, 0xBE, 0x26, 0x8C, 0x20, 0x47, 0x94, 0xF8, 0x0D, 0x9B, 0xAC, 0x90, 0x43,
-    0x6C, 0x22, 0x97, 0x02, 0x42, 0x05, 0xA7, 0xA8, 0xEC, 0x8D, 0x7B, 0x66, 0xE3, 0xA7, 0xE5, 0x1D,
-    0xA9, 0x9F, 0xDF, 0xFC, 0x3E, 0x39, 0x30, 0x3A, 0xFF, 0xD8, 0xDA, 0x73, 0xF7, 0xB1, 0xBE, 0xA5,
-    0xB9, 0x4C, 0xFD, 0xDE, 0xE3, 0xFA, 0xE9, 0x91, 0x99, 0x05, 0xD9, 0x41, 0x0B, 0xFE, 0xD3, 0x42,
-    0x62, 0xB7, 0x11, 0x66, 0xDC, 0x08, 0x51, 0x50, 0x4A, 0xA6, 0xE5, 0x95, 0xFD, 0x7B, 0xF4, 0x09,
-    0x92, 0x7B, 0x94, 0x1D, 0x63, 0x45, 0x87, 0x98, 0x0E, 0x05, 0xCA, 0xF1, 0xD3, 0xE3, 0xFB, 0x12,
-    0xFA, 0xE3, 0x55, 0x08, 0xCA, 0x3E, 0xD6, 0x9B, 0x3D, 0xCB, 0xE5, 0x37, 0x7B, 0xDE, 0xA4, 0x42,
-    0x10, 0x66, 0x0B, 0x27, 0x89, 0xCE, 0x94, 0xFD, 0xE6, 0xC9, 0x6D, 0xD4, 0x0F, 0x62, 0x09, 0x95,
-    0xBD, 0x60, 0x6F, 0xFD, 0x20, 0x6F, 0x4F, 0xFD, 0xA0, 0xBB, 0x40, 0x9D, 0xEF, 0xAC, 0xAD, 0x9D,
-    0xA9, 0x28, 0xB6, 0x54, 0xEE, 0x78, 0x5F, 0xEA, 0xDC, 0xC3, 0xFA, 0x49, 0xEC, 0x30, 0x12, 0x80,
-    0x44, 0x94, 0xCD, 0x6F, 0xD6, 0xFF, 0xBD, 0xF5, 0x93, 0x44, 0x79, 0xD3, 0x92, 0x3E, 0xF1, 0x00,
-    0xEF, 0xC5, 0x0C, 0xBA, 0x77, 0x34, 0xBA, 0x7C, 0xCB, 0x2D, 0xFB, 0x5E, 0x53, 0xF0, 0xF2, 0x6D,
-    0x08, 0x0D, 0xF7, 0xF1, 0xED, 0x6D, 0x41, 0x72, 0xCE, 0xA0, 0xE6, 0x20, 0x6A, 0xEF, 0xEF, 0x15,
-    0x1A, 0xEE, 0x62, 0x25, 0xFF, 0x95, 0xCD, 0x1F, 0x0C, 0x66, 0xC9, 0xC3, 0x6B, 0x6B, 0x66, 0x57,
-    0x21, 0xAA, 0x07, 0xF2, 0x0D, 0xAE, 0x9F, 0xDF, 0x7C, 0xD5, 0x95, 0xFF, 0x5C, 0xDE, 0x36, 0x51,
-    0x84, 0xB9, 0x4E, 0x51, 0xB0, 0x25, 0x64, 0xE1, 0x79, 0x01, 0x49, 0x5F, 0x84, 0xF9, 0x28, 0x84,
-    0x8C, 0x93, 0xCB, 0x45, 0x98, 0x67, 0x7D, 0x11, 0xE6, 0xD7, 0x41, 0xBB, 0x5F, 0x14, 0x7D, 0x11,
-    0xE6, 0x0F, 0x93, 0x5E, 0xCD, 0xE9, 0x86, 0x72, 0xC7, 0xE7, 0x7B, 0xE9, 0xC9, 0x1B, 0x0C, 0x1C,
-    0x41, 0x1F, 0xD4, 0xCA, 0x04, 0x7C, 0x7D, 0xE3, 0x63, 0xCF, 0xDA, 0xD3, 0x01, 0xFA, 0xC5, 0xC9,
-    0xFD, 0xD6, 0xE5, 0x03, 0x4A, 0x5A, 0x6E, 0x98, 0x54, 0x19, 0xE3, 0x97, 0x9B, 0x7D, 0xD5, 0xC6,
-    0x07, 0x80, 0xC8, 0xE6, 0xA9, 0x2F, 0x43, 0x70, 0xCD, 0xB9, 0xBA, 0xB8, 0x7C, 0x47, 0x33, 0xC4,
-    0x03, 0x6B, 0x51, 0xB5, 0x60, 0xF1, 0x15, 0x0D, 0x0F, 0x30, 0xA9, 0xCD, 0xD7, 0x56, 0x36, 0xE4,
-    0x66, 0xAC, 0x8C, 0x8E, 0x72, 0xA9, 0xE5, 0x4B, 0xB8, 0x58, 0x4E, 0x7B, 0x62, 0xA9, 0xAA, 0xC6,
-    0x83, 0x40, 0xEF, 0xCB, 0x2E, 0xCD, 0x69, 0x3A, 0xC0, 0xFD, 0x38, 0xB6, 0x79, 0xE0, 0x5E, 0x9E,
-    0xBB, 0x30, 0x9D, 0x09, 0x42, 0x73, 0x65, 0x6F, 0x93, 0xEF, 0xDD, 0x6B, 0x7F, 0x16, 0x2C, 0x6A,
-    0x1F, 0x21, 0xE3, 0xFA, 0x8E, 0x33, 0xE0, 0x83, 0x21, 0x56, 0x5B, 0xBB, 0x7B, 0x6E, 0x08, 0x57,
-    0xED, 0xC1, 0xAD, 0x92, 0xCA, 0x6F, 0x9D, 0x14, 0xFF, 0xAA, 0x96, 0x0C, 0xA2, 0x1D, 0xB2, 0x76,
-    0x0F, 0x3A, 0xE7, 0x9E, 0xD0, 0x7F, 0xB0, 0x87, 0xA9, 0x9F, 0xAB, 0x75, 0x75, 0xF7, 0x5A, 0xE7,
-    0xB7, 0x38, 0x7F, 0x13, 0xAB, 0xCA, 0xA7, 0xFD, 0x8D, 0xB3, 0xB0, 0x33, 0x73, 0x2A, 0x36, 0x5A,
-    0xB2, 0xAD, 0x55, 0xB4, 0xFF, 0x82, 0xD1, 0x0E, 0xDF, 0xCF, 0x97, 0x0E, 0x7D, 0xD2, 0x75, 0x0D,
-    0x7E, 0xCB, 0x90, 0xD5, 0xE5, 0x38, 0x66, 0xF0, 0xD6, 0x43, 0x27, 0xFB, 0x22, 0x4E, 0x21, 0x6D,
-    0x14, 0x1B, 0x77, 0xA3, 0xF4, 0xC1, 0xAB, 0x2A, 0x25, 0xD0, 0x2D, 0xEC, 0x3E, 0x8F, 0xC8, 0xDC,
-    0x8B, 0x6B, 0x8D, 0x9C, 0x5F, 0x49, 0x1E, 0xB4, 0xC0, 0xF3, 0xBD, 0x89, 0x79, 0x84, 0x5F, 0x2E,
-    0x87, 0x72, 0x42, 0x46, 0xAD, 0x81, 0xFF, 0xCC, 0xDC, 0x8B, 0xC0, 0xF3, 0x1A, 0x81, 0xE7, 0x3C,
-    0xFD, 0x99, 0x01, 0xAC, 0xF6, 0x1B, 0x45, 0xCC, 0x74, 0x27, 0xB4, 0x67, 0x25, 0xB9, 0x13, 0xB2,
-    0x79, 0x6B, 0xF6, 0xAD, 0xE7, 0x68, 0xFA, 0xEB, 0xE4, 0x38, 0xFD, 0xE5, 0x73, 0x77, 0x4E, 0xB6,
-    0xF2, 0x36, 0x88, 0xB1, 0x72, 0x49, 0x66, 0xAB, 0xAF, 0xD6, 0xD4, 0x8F, 0xF0, 0x3A, 0xBA, 0xFF,
-    0x0F, 0xDD, 0x5B, 0x3D, 0x70, 0x1C, 0x49, 0x15, 0x7E, 0x3D, 0x23, 0x69, 0x40, 0x03, 0x37, 0x0A,
-    0x4C, 0xC0, 0xA9, 0xEE, 0x26, 0x21, 0x80, 0x2B, 0x9F, 0x37, 0x71, 0x40, 0x51, 0x5E, 0xCF, 0x98,
-    0x94, 0x44, 0x81, 0x54, 0x64, 0xE8, 0x42, 0xA0, 0x0A, 0x74, 0x81, 0x03, 0x51, 0x58, 0x9A, 0xB1,
-    0x09, 0x9C, 0xAA, 0x8A, 0x80, 0xE0, 0x02, 0x14, 0x10, 0x18, 0x5D, 0x15, 0x72, 0xA0, 0x40, 0x54,
-    0x59, 0x9A, 0x31, 0x09, 0x01, 0xC9, 0x16, 0x14, 0x10, 0x32, 0x70, 0x2E, 0x28, 0x20, 0xF0, 0x5C,
-    0xB1, 0x57, 0xB5, 0xBA, 0xDB, 0xDD, 0xE6, 0x7D, 0xAF, 0x7B, 0x66, 0x76, 0x17, 0x9F, 0x31, 0x2E,
-    0x79, 0x7F, 0x98, 0xF3, 0xBD, 0xDD, 0x99, 0x9D, 0x99, 0x7E, 0xFD, 0xBD, 0xD7, 0xEF, 0x7D, 0xFD,
-    0xBA, 0x45, 0xE4, 0x75, 0x88, 0x8F, 0xA0, 0x80, 0x0C, 0x4B, 0xC8, 0x56, 0x17, 0xB2, 0xDD, 0x83,
-    0xDC, 0xED, 0x43, 0x76, 0x07, 0x90, 0x65, 0xC6, 0xC2, 0x29, 0x22, 0x96, 0x6E, 0x1E, 0xA5, 0x44,
-    0x5E, 0x1E, 0xE6, 0x44, 0x7E, 0x1C, 0xF0, 0x2B, 0x02, 0x79, 0xC5, 0x9B, 0xE4, 0xF1, 0x2B, 0xA2,
-    0xA3, 0xF7, 0xF9, 0x15, 0x91, 0xD6, 0xFC, 0xF0, 0x29, 0x29, 0x96, 0x7C, 0x71, 0x40, 0x8A, 0x65,
-    0x46, 0x0E, 0xDF, 0x9C, 0xF0, 0x0B, 0xF8, 0x86, 0xD4, 0xE7, 0xEF, 0x51, 0xBE, 0x73, 0x41, 0xCB,
-    0xBA, 0xAB, 0x35, 0xF9, 0x7A, 0x48, 0x63, 0x87, 0x9F, 0x37, 0xBA, 0x19, 0x69, 0xAE, 0xD4, 0x87,
-    0xCA, 0xF8, 0x09, 0xEF, 0x22, 0xCB, 0x29, 0xE8, 0xF8, 0x05, 0x05, 0xB9, 0x5B, 0xB2, 0x56, 0x2E,
-    0xBA, 0x51, 0x0B, 0xF5, 0xCD, 0x92, 0x94, 0xD6, 0x25, 0x05, 0x5D, 0x3E, 0x6D, 0xA5, 0x2C, 0x22,
-    0xFC, 0x90, 0x18, 0xE1, 0xE1, 0x34, 0x60, 0x91, 0xBE, 0xD5, 0xA5, 0x50, 0x7F, 0x38, 0x20, 0x4F,
-    0xDF, 0xD5, 0x31, 0x5D, 0xA9, 0x1B, 0x11, 0x84, 0x82, 0xB2, 0x12, 0x06, 0x30, 0x39, 0xD6, 0x45,
-    0xA7, 0x4C, 0x30, 0x3A, 0xBC, 0x29, 0x97, 0x44, 0x2A, 0xB9, 0xE2, 0xCB, 0xAF, 0x5E, 0xDC, 0xC8,
-    0x91, 0xF7, 0xCD, 0x0F, 0xE2, 0x0A, 0xAA, 0x45, 0x68, 0xFB, 0x97, 0xFB, 0x2C, 0xD6, 0x5A, 0x55,
-    0x37, 0x5C, 0x68, 0xE2, 0x01, 0x70, 0x37, 0x45, 0xA7, 0xA6, 0x08, 0xFA, 0xEB, 0x02, 0x17, 0xFA,
-    0xBD, 0x1C, 0x3F, 0x02, 0x4C, 0x1F, 0x16, 0x95, 0x92, 0xD4, 0x6B, 0xA3, 0x8D, 0x8E, 0x1F, 0x43,
-    0x25, 0x35, 0xB7, 0xB0, 0xDA, 0x23, 0x4C, 0x0D, 0x9A, 0x7E, 0x79, 0xCA, 0x27, 0xBD, 0x03, 0x3E,
-    0xD9, 0x83, 0x22, 0x41, 0x4C, 0x4E, 0xEA, 0xA4, 0xD3, 0xF3, 0x65, 0xE7, 0x50, 0x1A, 0x11, 0x48,
-    0xE8, 0xCE, 0x32, 0x00, 0x0E, 0x0D, 0x4C, 0x0B, 0x07, 0xEB, 0xBE, 0x68, 0x21, 0xCA, 0xFD, 0x0A,
-    0xED, 0xDF, 0xC7, 0xE5, 0xE0, 0xA7, 0xAC, 0x79, 0xDB, 0xE5, 0x27, 0x0E, 0xE9, 0xE1, 0x68, 0x8C,
-    0xD8, 0xD1, 0x29, 0xA9, 0xE1, 0x4E, 0x49, 0x6E, 0xD7, 0xE9, 0x01, 0xA7, 0x3E, 0x5A, 0x12, 0xBD,
-    0x6B, 0xB1, 0xC5, 0x22, 0x61, 0x75, 0xDC, 0x01, 0x9F, 0x32, 0xF8, 0x7D, 0x86, 0x9F, 0x45, 0x68,
-    0x84, 0xC2, 0x29, 0x8F, 0x86, 0xA0, 0x58, 0x3D, 0x63, 0x44, 0xFB, 0x49, 0xAC, 0x74, 0x91, 0x74,
-    0x68, 0x79, 0xB4, 0x99, 0x40, 0x50, 0xF9, 0xCC, 0x0D, 0x39, 0xB9, 0x0A, 0xCF, 0xBD, 0xD5, 0x15,
-    0xCF, 0xCD, 0x17, 0x0E, 0x62, 0x71, 0x15, 0x1F, 0xE3, 0x8E, 0xDF, 0xC6, 0xC7, 0xDB, 0x70, 0xDF,
-    0x12, 0xEE, 0x1B, 0xCF, 0xCC, 0x7D, 0x89, 0xCE, 0x1C, 0x56, 0xD8, 0xD1, 0xFF, 0x64, 0xE9, 0xDE,
-    0xE7, 0xAB, 0xE4, 0xD0, 0x77, 0x48, 0x22, 0x44, 0x83, 0xDB, 0x42, 0xE1, 0x7C, 0x85, 0x58, 0x41,
-    0x7D, 0xB7, 0xC3, 0x9D, 0xD2, 0x39, 0xDF, 0x96, 0xD5, 0x69, 0x0F, 0xBA, 0x85, 0x50, 0x6A, 0x66,
-    0x60, 0xAF, 0x1C, 0x4C, 0x82, 0xFA, 0xE8, 0x0C, 0xED, 0x96, 0xA1, 0xA4, 0x03, 0x37, 0x1D, 0x4F,
-    0xD4, 0x8B, 0xCB, 0x22, 0xA4, 0xA3, 0x32, 0x76, 0x5B, 0x50, 0x72, 0xEF, 0x66, 0x03, 0x78, 0x3E,
-    0x3F, 0x44, 0xC3, 0x78, 0xBA, 0x89, 0x57, 0x4A, 0xE0, 0x15, 0x0B, 0xB8, 0x39, 0x78, 0x85, 0x53,
-    0xC0, 0x28, 0x64, 0xBA, 0x6D, 0x8C, 0xA5, 0xE6, 0xDD, 0x34, 0x91, 0xB8, 0x14, 0x34, 0xE5, 0x97,
-    0xAA, 0x7B, 0xB7, 0x62, 0xFE, 0xE2, 0x71, 0x8B, 0xC3, 0x63, 0xEE, 0x50, 0x82, 0xBB, 0xFC, 0x27,
-    0x53, 0x25, 0x7A, 0x3F, 0xA3, 0x4A, 0x23, 0x9B, 0x5A, 0x0C, 0x65, 0x5B, 0x58, 0x84, 0xCF, 0xEA,
-    0x8E, 0xF8, 0xDC, 0x8C, 0xBA, 0x7B, 0x77, 0xE6, 0x08, 0xAF, 0x4B, 0xCC, 0xF8, 0x9A, 0xE0, 0x43,
-    0xB7, 0x1B, 0x4F, 0xF6, 0xC4, 0x93, 0x1F, 0x2F, 0x1E, 0xCE, 0xAA, 0xD6, 0x63, 0x69, 0x17, 0x5F,
-    0xBF, 0x2A, 0x6D, 0xC2, 0x9D, 0x67, 0x0F, 0xF6, 0x99, 0x92, 0x64, 0xF9, 0x37, 0x24, 0xCB, 0x5F,
-    0x8F, 0x24, 0x4B, 0x39, 0x16, 0xD1, 0xA9, 0xEB, 0x64, 0xA9, 0x6C, 0xB2, 0xB4, 0x13, 0x2A, 0x95,
-    0xAA, 0x59, 0x83, 0xED, 0xA4, 0xAE, 0x74, 0x3D, 0x40, 0x5B, 0x1F, 0x67, 0xCD, 0x94, 0x70, 0xFD,
-    0x90, 0xFE, 0x4F, 0xD2, 0xA4, 0xCA, 0x99, 0x7E, 0xCC, 0xD8, 0xA5, 0x9F, 0x97, 0x21, 0x33, 0xCD,
-    0x5E, 0xB1, 0x03, 0xC1, 0x34, 0xDD, 0xCF, 0x1D, 0x66, 0xF2, 0x10, 0x4E, 0x2D, 0x18, 0xCB, 0x09,
-    0x31, 0xD8, 0xDA, 0x00, 0xF1, 0xEA, 0xE3, 0xDB, 0x26, 0x3D, 0xF3, 0x96, 0x4A, 0xDC, 0x86, 0x38,
-    0x81, 0xE8, 0xF2, 0xEB, 0x9D, 0x72, 0x7B, 0x78, 0x74, 0x5C, 0xA2, 0xC9, 0x72, 0x14, 0x80, 0xDE,
-    0xD8, 0x73, 0x72, 0x5A, 0x1F, 0x8C, 0x97, 0x33, 0xCC, 0x72, 0xAF, 0xF4, 0x4B, 0x06, 0xA6, 0x1B,
-    0xA6, 0x4E, 0x3F, 0x8A, 0x55, 0x9F, 0xAD, 0xDB, 0x8F, 0x8E, 0x8E, 0xFA, 0xB0, 0x5E, 0xB4, 0xB5,
-    0xB5, 0x19, 0xD9, 0xCC, 0x18, 0x31, 0xC4, 0xB0, 0x36, 0xDB, 0xFA, 0x4B, 0x5E, 0x57, 0x75, 0x59,
-    0xCF, 0x82, 0xE7, 0x27, 0xEC, 0xE8, 0x1B, 0x0D, 0x0E, 0x40, 0x00, 0xFF, 0x57, 0x20, 0xA8, 0x73,
-    0xD8, 0x84, 0x07, 0x07, 0xAD, 0xBA, 0x85, 0x10, 0x60, 0x32, 0x6F, 0xA1, 0xF3, 0x3A, 0xE2, 0xDE,
-    0x9E, 0x35, 0x5E, 0x28, 0x36, 0x44, 0xFC, 0xC3, 0x0F, 0x12, 0xA2, 0xB5, 0xD0, 0x74, 0x17, 0x75,
-    0x06, 0x28, 0x0B, 0x37, 0x55, 0xF1, 0xE5, 0x03, 0x26, 0x13, 0x84, 0xA8, 0xFB, 0x1A, 0x77, 0x7B,
-    0xF8, 0x3D, 0xA2, 0x22, 0xE1, 0xF6, 0xE2, 0x95, 0x62, 0xC4, 0x3C, 0x33, 0x83, 0x63, 0x13, 0x41,
-    0x3A, 0x7D, 0xE8, 0x3D, 0xFD, 0xA8, 0xF0, 0x1D, 0x9D, 0x2F, 0xD3, 0xF7, 0x5F, 0x95, 0xCF, 0x28,
-    0xC4, 0x22, 0xF8, 0xC5, 0x26, 0xF3, 0x01, 0x67, 0xC8, 0xF3, 0x3A, 0x0F, 0x69, 0x21, 0xB8, 0xCF,
-    0xC0, 0xB7, 0x11, 0x32, 0xD6, 0xF8, 0xBF, 0xB9, 0x18, 0x4B, 0x75, 0xC5, 0xA4, 0xA8, 0x2A, 0x26,
-    0xFB, 0x32, 0x0B, 0x0A, 0x69, 0x72, 0x16, 0x24, 0x61, 0x08, 0x18, 0x11, 0x40, 0x42, 0xC8, 0xE1,
-    0xB0, 0xC1, 0x30, 0x11, 0x70, 0x02, 0x28, 0x2C, 0x18, 0x29, 0x13, 0x1C, 0x81, 0x95, 0xA1, 0x9D,
-    0x46, 0xC4, 0xD5, 0xE8, 0x00, 0x60, 0x04, 0xC4, 0x48, 0x20, 0x13, 0xCC, 0x04, 0xB4, 0xAF, 0x48,
-    0x7C, 0x8E, 0x25, 0x10, 0xB2, 0xA1, 0xD4, 0x5F, 0x10, 0xF4, 0xE6, 0x12, 0xB5, 0x11, 0xB2, 0x77,
-    0x8F, 0xE3, 0x8E, 0x92, 0x82, 0x48, 0x88, 0x40, 0xDD, 0x46, 0xFD, 0xEE, 0x90, 0xC6, 0x12, 0x51,
-    0xA8, 0x19, 0xC4, 0xEC, 0x98, 0x07, 0x63, 0x1F, 0x6A, 0x96, 0x9C, 0x2D, 0xBC, 0x82, 0x93, 0x05,
-    0x03, 0x91, 0xA0, 0xEE, 0xC1, 0x31, 0xF8, 0x1F, 0x47, 0x7C, 0xCA, 0xAF, 0xA7, 0xE0, 0xF7, 0x5B,
-    0x5B, 0xB8, 0x46, 0x56, 0x20, 0xA6, 0x78, 0x12, 0xCE, 0xBB, 0xF4, 0x59, 0x52, 0x03, 0xDA, 0x43,
-    0xD7, 0x7B, 0x78, 0x29, 0x7E, 0xDA, 0x6C, 0x5A, 0x01, 0x4E, 0x74, 0x5F, 0xAA, 0x87, 0x2C, 0x36,
-    0x43, 0x9E, 0x52, 0x0D, 0xAF, 0xCE, 0x23, 0x7E, 0xA8, 0x76, 0x48, 0xB1, 0xE3, 0x0D, 0x29, 0xDC,
-    0xF8, 0x45, 0x21, 0x85, 0x0E, 0x38, 0x1D, 0xFB, 0xDC, 0x98, 0xCB, 0x5D, 0xE6, 0x90, 0xF4, 0x0F,
-    0x18, 0x8D, 0x68, 0xC0, 0x3E, 0xBE, 0x9B, 0xB0, 0x16, 0xEF, 0xAC, 0xA4, 0x16, 0x3F, 0x67, 0x2E,
-    0xDD, 0x0C, 0xFC, 0x4B, 0xDF, 0xCB, 0x51, 0xAA, 0x70, 0x53, 0x5B, 0xA9, 0x40, 0x81, 0x1B, 0x65,
-    0x8A, 0x57, 0x0D, 0x15, 0x3D, 0x80, 0x7E, 0x1A, 0xAE, 0x24, 0xB0, 0xFC, 0x86, 0x6F, 0xBC, 0xE6,
-    0x30, 0x2C, 0xD7, 0xEB, 0x84, 0x36, 0xEF, 0x24, 0x00, 0x65, 0x06, 0x24, 0x6B, 0x14, 0x19, 0xF6,
-    0xF6, 0xA5, 0xC4, 0xF0, 0xEA, 0xE0, 0x7A, 0x36, 0x41, 0x58, 0xB9, 0xC0, 0xC8, 0xFF, 0x1C, 0x93,
-    0x3A, 0xFE, 0xB7, 0x13, 0xD3, 0x85, 0x30, 0x45, 0xB3, 0x82, 0xA1, 0xCB, 0x1D, 0x7D, 0x88, 0x6E,
-    0xBD, 0xD4, 0x3F, 0x7E, 0x70, 0x5B, 0x1F, 0xF0, 0x4B, 0x68, 0x83, 0x09, 0x48, 0x1C, 0x6C, 0xE7,
-    0x4B, 0xAE, 0xB4, 0xC2, 0x24, 0xBD, 0x2B, 0xAD, 0x88, 0x56, 0x9C, 0xF7, 0xD7, 0xFB, 0xC2, 0x50,
-    0x5F, 0xE0, 0x1F, 0x87, 0x96, 0x75, 0x7D, 0x10, 0xE9, 0xF2, 0xD2, 0x74, 0x23, 0x5B, 0xFF, 0x36,
-    0x17, 0x6D, 0x21, 0x7C, 0x0D, 0x6D, 0x39, 0x46, 0xAB, 0x93, 0xC6, 0x8C, 0x2F, 0xA7, 0x6A, 0xED,
-    0x03, 0xA6, 0xE9, 0x31, 0x0A, 0xE8, 0x68, 0xD0, 0xFA, 0xD6, 0xC7, 0x19, 0x1B, 0x43, 0x73, 0xBA,
-    0x21, 0xB7, 0x07, 0x9A, 0x8E, 0x58, 0x9A, 0x08, 0xDD, 0x8E, 0x52, 0x18, 0xB4, 0x95, 0xB7, 0x58,
-    0x86, 0x9D, 0x48, 0x8C, 0x0B, 0xDE, 0x1F, 0x14, 0x22, 0xCB, 0x4F, 0x91, 0x85, 0xDC, 0x59, 0x98,
-    0xA7, 0xF0, 0x86, 0x30, 0x37, 0x6F, 0x43, 0x11, 0x31, 0xB2, 0xAD, 0xD0, 0x50, 0xBE, 0x44, 0x7F,
-    0x47, 0xEB, 0x9E, 0x21, 0xFE, 0xCB, 0x23, 0x2B, 0x52, 0x81, 0x38, 0xA2, 0x64, 0x43, 0x2B, 0x83,
-    0x89, 0x02, 0xDF, 0x8E, 0x46, 0xFC, 0x3E, 0x2E, 0x58, 0x61, 0xA7, 0x87, 0x5C, 0x30, 0x60, 0xFA,
-    0x4E, 0xFB, 0x70, 0xC4, 0x08, 0x1E, 0x69, 0x44, 0xFC, 0x0C, 0x61, 0x6E, 0xE1, 0x9B, 0x13, 0xF3,
-    0x98, 0x5F, 0x30, 0xAC, 0xCE, 0x70, 0x1B, 0x1D, 0x47, 0x22, 0xAA, 0x3C, 0x96, 0x21, 0xB2, 0x79,
-    0x85, 0x00, 0x8F, 0x9D, 0x35, 0x98, 0xA3, 0x25, 0xD5, 0x48, 0x2D, 0x43, 0xAA, 0x73, 0x47, 0x2E,
-    0x49, 0x9D, 0x5D, 0x09, 0xC2, 0x81, 0x99, 0x54, 0x99, 0x90, 0x34, 0xF7, 0x88, 0xA3, 0xBB, 0x21,
-    0xCE, 0xDB, 0x3C, 0x06, 0x69, 0x2D, 0x10, 0x1E, 0x02, 0xC6, 0x31, 0xB4, 0xE5, 0x03, 0x99, 0xB4,
-    0x11, 0xC5, 0xD3, 0x83, 0xFE, 0xAD, 0x7A, 0x55, 0x65, 0x39, 0x96, 0x4A, 0xE8, 0x6F, 0xA1, 0x41,
-    0xD6, 0x95, 0xF1, 0xF2, 0x48, 0x16, 0x01, 0x43, 0x1A, 0xAF, 0xA5, 0xCF, 0xB7, 0x3B, 0xC3, 0x85,
-    0x43, 0xB8, 0x11, 0x7B, 0x49, 0xD0, 0x7F, 0x87, 0x6F, 0x45, 0xE7, 0x4E, 0x99, 0xF9, 0xAA, 0x8E,
-    0xEA, 0x4C, 0xCF, 0xAF, 0x9D, 0x83, 0xDA, 0xAF, 0xB9, 0x79, 0x51, 0xF1, 0xED, 0x96, 0xB4, 0x9F,
-    0x34, 0xE0, 0xBA, 0x0B, 0x04, 0x6E, 0x54, 0xC7, 0x06, 0xF7, 0x31, 0x74, 0xFC, 0x31, 0x92, 0x72,
-    0xF0, 0x27, 0xC9, 0xC7, 0x05, 0xA6, 0x97, 0xA3, 0xF9, 0x98, 0xA3, 0x22, 0xBF, 0x22, 0x7B, 0xBF,
-    0x87, 0x40, 0x7A, 0x8E, 0xF1, 0x1C, 0xC5, 0x4C, 0x19, 0xC2, 0x94, 0x07, 0x6C, 0x90, 0x33, 0x68,
-    0x46, 0x74, 0x9E, 0x21, 0x72, 0xB9, 0x05, 0x37, 0xE7, 0xF2, 0x18, 0xDB, 0x86, 0x27, 0x8C, 0xD9,
-    0x4F, 0xFA, 0x20, 0x9A, 0xC5, 0x38, 0xD1, 0x34, 0xA5, 0x00, 0x5B, 0x83, 0x93, 0x22, 0xDC, 0xF2,
-    0xD7, 0x71, 0xA5, 0xF5, 0xBB, 0x74, 0x41, 0xBD, 0x58, 0xA1, 0x18, 0xED, 0x9E, 0xD7, 0x51, 0x0D,
-    0x93, 0xB5, 0xEE, 0x09, 0x5C, 0x79, 0x63, 0x66, 0xAE, 0xCC, 0xB1, 0x16, 0x4B, 0x0E, 0xAE, 0x7E,
-    0x8F, 0x55, 0xF4, 0xBF, 0x01, 0xBB, 0xAF, 0xD2, 0xB7, 0x1B, 0x9D, 0x8D, 0x5B, 0x2F, 0x20, 0xDA,
-    0x4B, 0x88, 0xC8, 0x59, 0x87, 0x1F, 0xF8, 0x84, 0xDD, 0xD5, 0xC9, 0x93, 0x2A, 0xF3, 0x49, 0x12,
-    0x0A, 0x90, 0x73, 0x66, 0x05, 0x39, 0xAD, 0x8A, 0x2E, 0x91, 0x70, 0xB4, 0x44, 0xBC, 0xBC, 0xD7,
-    0x97, 0x69, 0xFC, 0x35, 0x59, 0x9F, 0xF0, 0x26, 0xAA, 0x8B, 0x8B, 0xCB, 0x31, 0xCC, 0x8A, 0x33,
-    0xB2, 0x79, 0x88, 0x2E, 0x44, 0x91, 0x00, 0x9E, 0x4F, 0x1D, 0xF0, 0xE7, 0xD3, 0x10, 0xFA, 0xAE,
-    0xF9, 0x18, 0x98, 0xFB, 0x0C, 0xBD, 0x73, 0x4D, 0x21, 0x29, 0x30, 0x5D, 0x7D, 0xA3, 0xBE, 0xF7,
-    0x8B, 0x36, 0x62, 0xC6, 0x62, 0x16, 0xC6, 0x11, 0x76, 0xE1, 0x44, 0x0F, 0xC3, 0x04, 0x06, 0x33,
-    0x53, 0xC0, 0xE5, 0x54, 0x20, 0x68, 0xE6, 0x64, 0x8C, 0x43, 0x06, 0x67, 0x32, 0xA0, 0x93, 0xB1,
-    0x80, 0xF9, 0x28, 0x9F, 0xF3, 0x51, 0x54, 0x0F, 0xD8, 0xC7, 0x8D, 0x9D, 0xAC, 0xD9, 0xC9, 0x58,
-    0xAA, 0x32, 0x95, 0xB5, 0x95, 0x35, 0x56, 0x65, 0xAD, 0xCA, 0x5C, 0xB2, 0x24, 0x1A, 0x76, 0xAA,
-    0x22, 0xC9, 0x9E, 0x14, 0xA5, 0xA5, 0xD4, 0x4E, 0xA7, 0x64, 0x89, 0x0A, 0xBF, 0x81, 0x6D, 0xD1,
-    0x86, 0x2D, 0x6E, 0xC0, 0x16, 0x27, 0x0C, 0xAA, 0xCE, 0x05, 0xDE, 0x4B, 0xB2, 0x85, 0xD9, 0xAF,
-    0x62, 0xF4, 0xAC, 0x96, 0x3E, 0x6D, 0x02, 0xAA, 0xD1, 0x6E, 0x96, 0x68, 0x17, 0x16, 0xED, 0x9F,
-    0x4B, 0xD8, 0x1C, 0xA9, 0x34, 0x55, 0x2C, 0x90, 0xDE, 0x9D, 0x26, 0xDA, 0x96, 0x62, 0x5B, 0x8E,
-    0x5D, 0x91, 0x6C, 0xC3, 0xB2, 0x2D, 0xCD, 0xB6, 0x3C, 0xDB, 0x12, 0x6D, 0x30, 0xED, 0xC5, 0x75,
-    0xF1, 0x17, 0x22, 0xE1, 0x0C, 0x7F, 0x3C, 0x25, 0xF8, 0x6D, 0xF4, 0xF1, 0x87, 0xE2, 0xD1, 0x61,
-    0xF6, 0x47, 0x84, 0xC6, 0xAB, 0x3E, 0xB2, 0x2C, 0x5D, 0x51, 0xA7, 0x0B, 0xEF, 0xE5, 0x58, 0xC1,
-    0x51, 0x3A, 0xBD, 0x4E, 0xEE, 0xD3, 0x8B, 0x92, 0xBC, 0x5B, 0xCC, 0xE1, 0x14, 0x5D, 0x8B, 0xA7,
-    0xE9, 0xE0, 0x0B, 0x1D, 0x92, 0xC7, 0x72, 0xA8, 0x4D, 0x9F, 0xD5, 0xC7, 0xE4, 0x54, 0x7D, 0xCA,
-    0xA0, 0x7E, 0x6A, 0xBE, 0x4C, 0x74, 0xE9, 0xEA, 0xC1, 0x8E, 0x2E, 0x9C, 0xAC, 0xE7, 0x0C, 0xA0,
-    0x27, 0xEA, 0x29, 0x41, 0x2C, 0x92, 0x2E, 0x57, 0x92, 0x91, 0x03, 0x99, 0xF6, 0x65, 0xB2, 0x7C,
-    0x10, 0x75, 0x48, 0x66, 0x0B, 0xC7, 0x28, 0xF1, 0x6A, 0xA9, 0x46, 0xAB, 0xFF, 0xDC, 0x84, 0x5B,
-    0x36, 0xB2, 0xD9, 0x6E, 0x13, 0xF5, 0x14, 0x53, 0xC1, 0x56, 0x8F, 0xB2, 0x02, 0x59, 0x9E, 0xED,
-    0xC5, 0x11, 0xD0, 0x7F, 0x09, 0xD9, 0xB7, 0x12, 0x16, 0xEF, 0x53, 0x58, 0x80, 0x96, 0xFD, 0x10,
-    0x66, 0xD7, 0x1F, 0x00, 0x10, 0xFD, 0x23, 0xA8, 0xB5, 0x31, 0x62, 0x3B, 0xB3, 0xF3, 0x24, 0x89,
-    0x1B, 0x19, 0x8D, 0xFC, 0xBA, 0x2A, 0x71, 0x38, 0x92, 0xA8, 0xF0, 0x65, 0x93, 0x02, 0x8D, 0x4C,
-    0x1A, 0x3E, 0x62, 0x8A, 0x07, 0xAA, 0x4E, 0x8C, 0xF3, 0x6A, 0x85, 0x2F, 0x88, 0x9A, 0xB2, 0x68,
-    0xE0, 0xFE, 0x41, 0xD8, 0x85, 0x70, 0x0C, 0xBB, 0x27, 0xC4, 0xCC, 0x26, 0xAE, 0xD5, 0x7B, 0x29,
-    0x41, 0xD3, 0x67, 0x6A, 0x9D, 0xD7, 0x53, 0xAA, 0x57, 0x8D, 0xEC, 0x82, 0x6A, 0x55, 0xDF, 0x73,
-    0x3B, 0x34, 0xBE, 0xC3, 0x7B, 0x25, 0xB6, 0xE9, 0x52, 0xB0, 0x0F, 0x0A, 0x01, 0xDF, 0xEB, 0x08,
-    0xFA, 0x6E, 0x2E, 0x50, 0x79, 0xC6, 0x0A, 0xBF, 0x30, 0xC0, 0x3D, 0xA9, 0xF0, 0xBB, 0xD4, 0x0F,
-    0x6B, 0x0D, 0x6B, 0x0E, 0x6B, 0x0F, 0x6B, 0x10, 0x6B, 0x91, 0xCA, 0x24, 0xF5, 0xC8, 0x78, 0xD0,
-    0x50, 0x2E, 0xAF, 0xAC, 0x4B, 0x29, 0xD6, 0x10, 0xD7, 0x6D, 0xD1, 0x54, 0xF6, 0x85, 0xB3, 0x14,
-    0x43, 0xF4, 0xC5, 0x10, 0x27, 0x30, 0xC4, 0x9F, 0x4B, 0x00, 0xAB, 0x53, 0xC8, 0xEE, 0xAB, 0x31,
-    0x84, 0x7A, 0x30, 0xCA, 0xC0, 0x6B, 0x36, 0x98, 0x8E, 0x1A, 0xA2, 0x59, 0xEC, 0x5A, 0x58, 0x43,
-    0x98, 0xED, 0xEF, 0x26, 0xBE, 0x1B, 0x3B, 0x54, 0xFB, 0xB6, 0x45, 0x7E, 0x7E, 0xF6, 0x86, 0xB0,
-    0xB1, 0xC8, 0x06, 0xA3, 0x2A, 0x1A, 0x55, 0xBC, 0x3C, 0x19, 0x9D, 0x20, 0x99, 0x88, 0x84, 0x90,
-    0xB4, 0xB8, 0x03, 0xE3, 0x7F, 0x89, 0x56, 0xB0, 0xCD, 0xD2, 0x4C, 0x6D, 0x63, 0xF6, 0xCB, 0x30,
-    0xDF, 0x7A, 0x17, 0x2A, 0x3C, 0xFD, 0x48, 0xB6, 0xCA, 0x38, 0xA2, 0xFD, 0x32, 0xB3, 0xAE, 0x45,
-    0x1F, 0x1D, 0x46, 0x86, 0x3D, 0x94, 0x3F, 0x6E, 0xEA, 0x6D, 0x4C, 0x95, 0x5A, 0x08, 0x08, 0x1B,
-    0xCE, 0x93, 0xD9, 0x8F, 0x8B, 0xC5, 0x8E, 0xFF, 0xA3, 0xDC, 0xC8, 0xD2, 0xA2, 0xEA, 0xC3, 0xEB,
-    0x8C, 0xD3, 0xCC, 0xB9, 0x80, 0xFA, 0xBF, 0x51, 0x26, 0x53, 0x44, 0xB0, 0x35, 0x84, 0xC1, 0x48,
-    0xCE, 0x30, 0x81, 0xCA, 0x19, 0xFF, 0x6B, 0x32, 0x6E, 0xA4, 0x0C, 0x74, 0xD1, 0xD2, 0x87, 0xAB,
-    0xBA, 0x70, 0x07, 0x88, 0x63, 0x6A, 0x20, 0x41, 0x37, 0x13, 0x5A, 0xCD, 0xD9, 0x1F, 0x4B, 0xB8,
-    0x39, 0x22, 0x5A, 0x50, 0x60, 0x5B, 0x83, 0x57, 0xE2, 0x8F, 0x0C, 0xDC, 0x9E, 0x94, 0x3A, 0xFB,
-    0x32, 0x5B, 0x3E, 0x97, 0x3A, 0x74, 0x34, 0x12, 0x18, 0x4C, 0x0E, 0x7D, 0x11, 0x29, 0x45, 0x97,
-    0xE5, 0xEC, 0x02, 0x25, 0x56, 0x0D, 0x96, 0x2D, 0x2B, 0x33, 0xAD, 0x7A, 0xE7, 0x85, 0xE1, 0xD6,
-    0xA7, 0x0D, 0x2B, 0xAA, 0x57, 0xBE, 0x49, 0xF7, 0x92, 0x21, 0x65, 0xDD, 0x00, 0xDB, 0x60, 0x38,
-    0x65, 0x04, 0x31, 0x33, 0x72, 0xE1, 0x65, 0x6F, 0x02, 0xC7, 0x36, 0x38, 0xCB, 0x0D, 0x74, 0x7E,
-    0x17, 0xDD, 0xE8, 0x22, 0xB9, 0x60, 0x75, 0xF8, 0x31, 0xE3, 0xEB, 0x7F, 0x80, 0x4D, 0xA2, 0xFF,
-    0xC2, 0x7E, 0xD1, 0x4F, 0x80, 0x8A, 0x36, 0x53, 0x87, 0xAA, 0xF2, 0x73, 0xA7, 0x62, 0x3A, 0xAA,
-    0xDE, 0xCA, 0x27, 0x45, 0x0A, 0xCC, 0x70, 0xD6, 0x71, 0x5B, 0xAB, 0x98, 0x47, 0xE4, 0xC6, 0x8E,
-    0x91, 0x7B, 0xAC, 0x0C, 0xF2, 0x29, 0x63, 0xC7, 0xD3, 0x4C, 0xB7, 0x8C, 0xB0, 0x2A, 0xCE, 0x22,
-    0x4A, 0xC3, 0xB8, 0xC1, 0x6E, 0x62, 0x7D, 0xB3, 0x2D, 0x97, 0xDA, 0x93, 0x7F, 0x47, 0xE8, 0x4F,
-    0xAC, 0x6F, 0xCE, 0x1F, 0xE2, 0x57, 0x64, 0xDE, 0xCA, 0xDF, 0xFC, 0xF7, 0xF8, 0xB7, 0x25, 0x29,
-    0x8C, 0x4A, 0xD4, 0x90, 0x92, 0xFA, 0x6E, 0xBD, 0xFF, 0x70, 0x6D, 0x6E, 0xBC, 0xD6, 0xAE, 0x23,
-    0xB9, 0x3A, 0xC6, 0x1B, 0xF5, 0x5F, 0x59, 0xD9, 0xD7, 0x3C, 0xEC, 0xA0, 0x5C, 0x1A, 0xDD, 0x88,
-    0x37, 0x97, 0x68, 0x4B, 0x61, 0xA0, 0xD5, 0x65, 0x7F, 0xD8, 0xD7, 0xDF, 0x22, 0x7A, 0x88, 0x8D,
-    0x25, 0x1B, 0x13, 0x9B, 0x1A, 0x67, 0x0D, 0xEF, 0xBF, 0x01, 0xA5, 0x58, 0xBD, 0x6F, 0xDC, 0xC8,
-    0x15, 0x7F, 0x24, 0x57, 0xE6, 0x25, 0x0C, 0x34, 0x2A, 0x64, 0x04, 0xB8, 0x58, 0x62, 0x0A, 0x17,
-    0x07, 0x43, 0x12, 0x53, 0xB8, 0x70, 0xB1, 0xAB, 0xE1, 0xD9, 0xC5, 0x15, 0x2E, 0xA2, 0xC2, 0xC2,
-    0x01, 0x31, 0x02, 0xA7, 0x48, 0x75, 0x8D, 0x83, 0xC0, 0x85, 0x0B, 0xC9, 0x9C, 0xB3, 0xEB, 0x20,
-    0xFA, 0x0F, 0xA2, 0x22, 0x01, 0xCE, 0x2A, 0xEE, 0x54, 0xB8, 0x10, 0x02, 0xDB, 0x1C, 0xDB, 0x45,
-    0x8A, 0x14, 0xE1, 0xE5, 0x10, 0xA4, 0x0C, 0x03, 0xFB, 0x1A, 0x57, 0x04, 0x42, 0x24, 0x7B, 0xCE,
-    0xEE, 0x4E, 0x7E, 0x6F, 0x86, 0xDC, 0x0F, 0x7D, 0x38, 0x96, 0x45, 0xF2, 0xBD, 0x1D, 0x72, 0xDE,
-    0x7B, 0xF3, 0xE6, 0xCD, 0xFB, 0x98, 0xD9, 0xDD, 0xDD, 0x13, 0xAE, 0x8D, 0x5F, 0x7C, 0xEF, 0xCA,
-    0xCA, 0xFC, 0x7E, 0xA0, 0x45, 0x99, 0xF4, 0x7F, 0xFD, 0x1B, 0x5F, 0xBD, 0xDB, 0xED, 0xA5, 0xA4,
-    0x89, 0x2A, 0xA2, 0x2E, 0xE5, 0x86, 0xF6, 0xBB, 0xB4, 0xBB, 0x4F, 0xBB, 0x9A, 0x76, 0xE9, 0xFD,
-    0x9F, 0x0D, 0x22, 0xC8, 0x0C, 0x14, 0x09, 0x22, 0x69, 0xD4, 0x7C, 0xA0, 0x82, 0xFB, 0x8A, 0x9E,
-    0x2B, 0xF2, 0xCF, 0xF0, 0x78, 0xE9, 0xF9, 0xCD, 0x54, 0x9A, 0x12, 0x0F, 0xC4, 0x4F, 0xB7, 0xED,
-    0x95, 0x1B, 0x63, 0x52, 0x46, 0x18, 0xD1, 0x98, 0xCA, 0x22, 0xDB, 0xC1, 0x2D, 0xBE, 0xEA, 0xB6,
-    0xD1, 0x6F, 0x59, 0xDE, 0xD6, 0xB5, 0x38, 0xD7, 0x15, 0x67, 0xBD, 0x9B, 0x21, 0x06, 0xB2, 0x11,
-    0x7C, 0x7E, 0x73, 0x73, 0x83, 0xDF, 0x2F, 0xED, 0xED, 0x7D, 0x41, 0x17, 0xFD, 0x2A, 0x4A, 0x97,
-    0x60, 0xF4, 0x75, 0x92, 0x5A, 0x96, 0x49, 0x71, 0x2E, 0x5D, 0xE6, 0x56, 0x91, 0x14, 0x61, 0x11,
-    0xE8, 0x50, 0xC5, 0xD4, 0xA7, 0x94, 0x3A, 0x24, 0x95, 0x2C, 0x64, 0x21, 0xF0, 0x2D, 0xD0, 0x11,
-    0x6D, 0x13, 0xCF, 0x38, 0x52, 0x49, 0x21, 0x4B, 0xA9, 0xD7, 0x69, 0x85, 0xE6, 0x29, 0x54, 0x5E,
-    0x4D, 0x0B, 0x74, 0xD1, 0x53, 0x7E, 0x25, 0x54, 0x94, 0x76, 0x69, 0x89, 0xF6, 0x21, 0xB9, 0xA2,
-    0x75, 0x74, 0xC8, 0x67, 0x30, 0xC9, 0x3F, 0x0D, 0x25, 0x85, 0xA1, 0x73, 0xE9, 0x47, 0xB4, 0x4C,
-    0x07, 0xF8, 0x36, 0x22, 0xF9, 0x57, 0xF7, 0x2D, 0x2C, 0x12, 0x0A, 0x34, 0x4B, 0x59, 0xA1, 0x98,
-    0x1E, 0x51, 0x3F, 0x2C, 0x28, 0xF5, 0x08, 0x23, 0x2F, 0x60, 0xEC, 0xA1, 0xA5, 0x93, 0x5F, 0x1B,
-    0x12, 0x45, 0x06, 0xBA, 0x18, 0xB0, 0x44, 0x11, 0xA4, 0x6F, 0xFB, 0x15, 0x95, 0x61, 0x6A, 0xAD,
-    0x15, 0xA9, 0x55, 0x2B, 0x8B, 0xC7, 0x61, 0xD9, 0x3C, 0xEE, 0x0A, 0xC6, 0x9F, 0x87, 0xBC, 0x50,
-    0xF5, 0xC8, 0xAB, 0x23, 0x0D, 0x71, 0x29, 0x9D, 0x67, 0x93, 0x4C, 0xC1, 0x5A, 0x03, 0x4B, 0x0E,
-    0x46, 0x5F, 0xE6, 0x1A, 0xCB, 0xA0, 0x37, 0x96, 0xE0, 0x95, 0x2D, 0x4D, 0x96, 0x3A, 0x98, 0xE6,
-    0x5B, 0x9F, 0xE2, 0x5D, 0x9D, 0xF0, 0x8F, 0xE1, 0xC2, 0x14, 0x7C, 0xC0, 0xA6, 0x3F, 0x7E, 0xCC,
-    0x87, 0x3F, 0xFF, 0x99, 0xE2, 0xF1, 0x1E, 0x2E, 0x7D, 0xA8, 0xEC, 0xB7, 0x76, 0x3C, 0xD9, 0xC8,
-    0xF9, 0x41, 0x03, 0x17, 0x1A, 0x9E, 0x29, 0x1D, 0x36, 0x56, 0xBD, 0x94, 0x79, 0x0D, 0x74, 0xB6,
-    0xB4, 0xAB, 0x87, 0x68, 0x2E, 0x11, 0x79, 0x5F, 0x50, 0x6C, 0xE0, 0xA8, 0x5A, 0x9A, 0x22, 0x6B,
-    0x1F, 0xBC, 0xE2, 0x63, 0x38, 0x64, 0xC3, 0x21, 0x58, 0x9E, 0xC2, 0x77, 0x4B, 0xCA, 0x47, 0xF0,
-    0xE0, 0x32, 0x37, 0x75, 0x0E, 0x2F, 0xAE, 0x29, 0x4F, 0x61, 0x39, 0x77, 0xDD, 0x23, 0x83, 0x3B,
-    0xA7, 0xC5, 0xE6, 0x4D, 0xC0, 0xCE, 0x71, 0x09, 0xA8, 0x72, 0xB4, 0x17, 0x11, 0x17, 0x1D, 0x82,
-    0x65, 0x17, 0x64, 0x1A, 0x56, 0x34, 0xCA, 0xB4, 0xA8, 0xC9, 0x64, 0x3A, 0x02, 0xB6, 0x5F, 0x86,
-    0x4E, 0x4A, 0x07, 0x12, 0x58, 0x4E, 0xD6, 0x46, 0x0B, 0x3C, 0xE4, 0x4C, 0x31, 0x3E, 0x89, 0x74,
-    0x1B, 0xE3, 0x1C, 0xED, 0xFE, 0x99, 0x1F, 0x6B, 0xD1, 0xA9, 0xEB, 0xDD, 0x73, 0x98, 0x31, 0xDF,
-    0x6E, 0x16, 0xC4, 0x77, 0x49, 0xA7, 0xE3, 0xDB, 0xBC, 0x49, 0xA1, 0xBD, 0xA3, 0xD3, 0xF0, 0xD1,
-    0xE4, 0xF2, 0x31, 0xFB, 0x50, 0xD9, 0xA6, 0xF8, 0x7B, 0x45, 0xC2, 0xF5, 0x25, 0x08, 0x81, 0xB8,
-    0x49, 0x33, 0x34, 0xA0, 0x9E, 0x6B, 0xAE, 0xA3, 0xB9, 0xD5, 0xAE, 0xEB, 0x13, 0xAA, 0xC7, 0x4D,
-    0xAF, 0x1A, 0x37, 0x83, 0x62, 0xDC, 0x0C, 0x75, 0xDB, 0x7C, 0x2C, 0xD2, 0x4D, 0xB8, 0x31, 0x47,
-    0xC5, 0x20, 0x0E, 0x8D, 0x26, 0x83, 0xC8, 0xA6, 0x7E, 0x4F, 0xDC, 0xAF, 0x82, 0xF2, 0x31, 0xC5,
-    0x57, 0xAB, 0x2D, 0xBC, 0x46, 0xC8, 0x08, 0xA1, 0x29, 0x6A, 0x0C, 0x23, 0x34, 0x7C, 0xF0, 0xA1,
-    0x57, 0xDD, 0x43, 0x53, 0x25, 0xD0, 0x29, 0x28, 0xB6, 0xE9, 0x49, 0x6C, 0x9B, 0xA1, 0x7E, 0x62,
-    0x9B, 0x50, 0x5A, 0xA4, 0xE3, 0x66, 0x4C, 0x63, 0x82, 0x1E, 0x31, 0x9B, 0xE6, 0xE6, 0x16, 0x8F,
-    0x68, 0x85, 0x41, 0xDB, 0x84, 0x03, 0x19, 0xB1, 0x07, 0x6D, 0xC5, 0x83, 0x2A, 0xA8, 0x1E, 0xB3,
-    0x58, 0x0A, 0x60, 0x80, 0x26, 0xD9, 0xB2, 0x97, 0xCE, 0xD1, 0xA1, 0x6B, 0xCA, 0x40, 0xB3, 0x36,
-    0x9A, 0x35, 0xD3, 0xAC, 0xA5, 0x66, 0x8D, 0x35, 0x6B, 0xAF, 0x59, 0x93, 0xCD, 0x5A, 0x6D, 0xD6,
-    0x70, 0xB3, 0xB6, 0xF3, 0x36, 0x58, 0xE6, 0xD8, 0x7C, 0xC3, 0x69, 0x0B, 0x0E, 0xE2, 0x74, 0x62,
-    0x44, 0xAF, 0x16, 0x7A, 0x62, 0xC7, 0xA0, 0x42, 0xF6, 0x1A, 0x9B, 0xF2, 0x5A, 0x85, 0x04, 0x39,
-    0xB6, 0x26, 0xDE, 0xCA, 0x89, 0x41, 0x1F, 0xD8, 0xB7, 0xD6, 0xA6, 0xEE, 0xAD, 0x35, 0xAB, 0xA3,
-    0x74, 0x96, 0x6D, 0xA5, 0xB4, 0xC6, 0xF5, 0x79, 0x84, 0xB1, 0x7D, 0x79, 0xF4, 0x29, 0x13, 0x0F,
-    0x92, 0x69, 0x2B, 0x27, 0x83, 0x69, 0x43, 0xC3, 0x11, 0x45, 0x21, 0x34, 0xC4, 0x23, 0xF5, 0xF4,
-    0x90, 0x95, 0x2F, 0xB3, 0x85, 0x8B, 0xA7, 0x42, 0x0F, 0x63, 0x35, 0x80, 0xB8, 0x35, 0xAF, 0xEA,
-    0xF9, 0x65, 0x37, 0xD0, 0x97, 0x03, 0xE5, 0xBA, 0xC2, 0x12, 0x9D, 0x51, 0x89, 0x6E, 0x2C, 0x30,
-    0x86, 0x52, 0x20, 0x11, 0x29, 0x88, 0x62, 0x02, 0xD9, 0x2A, 0x81, 0x70, 0xA5, 0x5D, 0x0D, 0x99,
-    0xC6, 0x0A, 0x96, 0x40, 0xE5, 0xF1, 0x39, 0xB0, 0x48, 0xFA, 0xB5, 0xBC, 0xDA, 0xB7, 0xAC, 0x8F,
-    0x43, 0x0D, 0xF2, 0x9E, 0x5F, 0x2C, 0x53, 0xC9, 0x95, 0x0E, 0x5D, 0xB1, 0x42, 0x27, 0x2B, 0x83,
-    0x6E, 0x26, 0x28, 0x98, 0xA4, 0x60, 0xA2, 0x92, 0xC9, 0x2A, 0x26, 0xDC, 0x77, 0xA2, 0x17, 0x88,
-    0xEE, 0x12, 0x96, 0xD7, 0x1B, 0x91, 0xFF, 0x0F, 0x0A, 0xFE, 0xA4, 0xA2, 0x6B, 0x5A, 0xF8, 0xE5,
-    0x2A, 0x55, 0x5D, 0x24, 0xBE, 0x45, 0xBA, 0xE3, 0x55, 0x01, 0xE6, 0x25, 0xD3, 0x1C, 0x79, 0x4B,
-    0xA6, 0x42, 0x07, 0x05, 0x0C, 0x72, 0x87, 0x16, 0x17, 0xC0, 0xD7, 0xA3, 0x38, 0x45, 0x3D, 0xAC,
-    0xFC, 0x81, 0x3F, 0x08, 0x2A, 0x51, 0xC4, 0x69, 0x0F, 0x5F, 0x21, 0xD2, 0x7A, 0xD9, 0x45, 0x4C,
-    0x92, 0x7E, 0xB2, 0x4D, 0xA2, 0xA4, 0x7E, 0xCC, 0x9C, 0x25, 0x5B, 0x5A, 0x70, 0x8D, 0xE4, 0xB2,
-    0xB1, 0x4D, 0xA8, 0xAB, 0x10, 0x10, 0xF0, 0xB2, 0x15, 0x02, 0x0C, 0x5E, 0x6D, 0x3F, 0xDF, 0xEB,
-    0xD3, 0x01, 0x67, 0x56, 0x6F, 0xC0, 0xB5, 0xCE, 0x1F, 0x3C, 0xA1, 0xF5, 0x1A, 0x1A, 0x52, 0x1F,
-    0x1C, 0x14, 0x94, 0x71, 0xCA, 0x42, 0x58, 0xD4, 0x3D, 0x70, 0x90, 0xD7, 0x67, 0x1E, 0xBB, 0xBE,
-    0xB0, 0x51, 0xA4, 0xC3, 0x62, 0x1D, 0x5C, 0x5E, 0x7D, 0x85, 0x47, 0xFF, 0x15, 0x2A, 0xA2, 0xE6,
-    0x42, 0x92, 0x03, 0x8C, 0xFD, 0xE5, 0x99, 0x48, 0x9E, 0x0B, 0xF2, 0xBD, 0x84, 0x88, 0x09, 0x6C,
-    0x03, 0x7A, 0x94, 0x00, 0xD6, 0x2C, 0x74, 0x2D, 0x2C, 0x13, 0x57, 0xF1, 0x2E, 0xF2, 0x76, 0xA7,
-    0xC9, 0xDF, 0x64, 0x65, 0xE4, 0xCA, 0x58, 0x60, 0x39, 0x93, 0xF8, 0xFA, 0x8E, 0xE2, 0x37, 0xB9,
-    0x96, 0x2A, 0x44, 0x4D, 0xF0, 0xFB, 0xDB, 0x73, 0x1F, 0x0F, 0x56, 0xB1, 0xC8, 0x64, 0xE1, 0xD9,
-    0x80, 0xC4, 0x73, 0xC0, 0x8B, 0x9A, 0xC4, 0x6F, 0x4B, 0x12, 0x06, 0x2E, 0xD3, 0xE7, 0x92, 0x0D,
-    0x48, 0x27, 0xE0, 0x35, 0xC2, 0xF8, 0x37, 0x86, 0xF2, 0x49, 0xE1, 0x40, 0xB8, 0x48, 0xC2, 0xDE,
-    0x65, 0xD3, 0xEE, 0x97, 0x52, 0xEC, 0x5E, 0xF6, 0xDA, 0xF0, 0xBD, 0x6C, 0x39, 0xF4, 0xB2, 0xDD,
-    0x03, 0xA4, 0x11, 0x87, 0xE0, 0x36, 0xD6, 0x74, 0x83, 0x6E, 0xC2, 0xD8, 0x09, 0xA8, 0xD9, 0xE7,
-    0x6E, 0x9B, 0x1D, 0x27, 0x81, 0xB9, 0x90, 0x64, 0x47, 0x5C, 0x7F, 0x5E, 0xEF, 0xA1, 0xE8, 0x05,
-    0xA0, 0xF2, 0x06, 0x2E, 0x1B, 0xC0, 0xFB, 0x98, 0x2A, 0xD0, 0x3F, 0xB6, 0x92, 0x99, 0x11, 0xF1,
-    0xED, 0x97, 0xFC, 0xC9, 0x69, 0x2B, 0x9A, 0xFA, 0xCA, 0x74, 0x07, 0xC7, 0x74, 0xB3, 0xD2, 0x78,
-    0xEF, 0xE2, 0xFB, 0x01, 0xFA, 0xE1, 0x49, 0x7E, 0xB9, 0x86, 0x6E, 0x81, 0xEE, 0x48, 0x09, 0xB4,
-    0xD6, 0xF0, 0x05, 0xDC, 0xD5, 0x81, 0x13, 0xD0, 0x66, 0xF1, 0xA8, 0x49, 0x16, 0x4D, 0xD2, 0x58,
-    0x0A, 0xD5, 0xAE, 0x75, 0xFF, 0x07, 0x9F, 0xD8, 0x0C, 0x93, 0xFC, 0x27, 0x77, 0xBB, 0xCC, 0xEC,
-    0x3B, 0x47, 0x77, 0xDB, 0x6D, 0x13, 0x93, 0xFF, 0xBA, 0xEF, 0xF2, 0xC1, 0xF5, 0x6A, 0x9A, 0xAF,
-    0x95, 0xD3, 0xC8, 0x3D, 0xA7, 0xE6, 0xD2, 0xEF, 0x2B, 0xF7, 0x06, 0xE8, 0x84, 0x7A, 0xA1, 0x03,
-    0x3F, 0x5D, 0x0B, 0x3E, 0xAF, 0xD6, 0xC2, 0xCF, 0x2B, 0xF9, 0xCD, 0x4F, 0x6B, 0xF9, 0xCD, 0xAD,
-    0x3A, 0x34, 0x66, 0x87, 0x01, 0x1E, 0x48, 0x0C, 0x9E, 0x19, 0xA5, 0x3E, 0x40, 0xBE, 0xBC, 0x55,
-    0xCB, 0x97, 0xB7, 0xEB, 0xE4, 0xDA, 0xFD, 0x2A, 0xF9, 0xE4, 0x6A, 0xF5, 0x41, 0xA8, 0x36, 0x18,
-    0x5A, 0x79, 0x2D, 0x5C, 0xDA, 0xDB, 0xC9, 0xA6, 0x36, 0x19, 0x78, 0x30, 0x76, 0x69, 0x33, 0x87,
-    0x55, 0x88, 0x8D, 0xCC, 0x89, 0x96, 0xD3, 0xEB, 0x96, 0x4D, 0xE6, 0x9C, 0x62, 0xCE, 0xD0, 0x8D,
-    0x05, 0xCD, 0x4D, 0x9E, 0x3E, 0xA5, 0xE3, 0xEF, 0x7C, 0x78, 0x62, 0x8F, 0xCA, 0xCD, 0xF9, 0x1B,
-    0x9B, 0x37, 0xCC, 0x08, 0xD1, 0x7F, 0x02, 0x51, 0x76, 0x62, 0x8F, 0x3F, 0x32, 0xA3, 0xF3, 0x37,
-    0x5A, 0xD7, 0x0F, 0x71, 0x00, 0x60, 0x90, 0xAF, 0x47, 0x16, 0x72, 0x4A, 0x10, 0x24, 0x89, 0x6A,
-    0x7C, 0x5F, 0x3F, 0x46, 0x38, 0x32, 0x7C, 0x44, 0x51, 0xC9, 0xC0, 0x19, 0x90, 0x38, 0x35, 0xB8,
-    0xDF, 0xC2, 0xF9, 0x3A, 0x83, 0x54, 0x0E, 0xD8, 0x3B, 0x0D, 0x04, 0xF7, 0x1D, 0xC8, 0xC2, 0x41,
-    0xAF, 0x99, 0x7C, 0xF7, 0x18, 0x58, 0x69, 0xE2, 0xB3, 0x73, 0xA8, 0xEE, 0xF1, 0x7B, 0xDE, 0x80,
-    0x39, 0x04, 0x4F, 0x9B, 0xEF, 0x33, 0x17, 0xCF, 0x24, 0xD1, 0x76, 0x2E, 0x9A, 0x67, 0x92, 0xD8,
-    0x39, 0x24, 0x76, 0x16, 0x89, 0x62, 0xFD, 0x6D, 0xC9, 0x2E, 0xE2, 0x31, 0x8E, 0x35, 0xE7, 0x25,
-    0xA9, 0x18, 0x8F, 0x90, 0x8A, 0x58, 0x67, 0xAC, 0x15, 0x34, 0x06, 0xEE, 0xD9, 0x98, 0xE9, 0x1E,
-    0xC1, 0x9D, 0x23, 0x35, 0x1A, 0x9A, 0x24, 0x9A, 0xF5, 0x92, 0x2D, 0x86, 0x7E, 0x89, 0x9A, 0x26,
-    0xC9, 0xD2, 0x08, 0x2E, 0x95, 0xA5, 0xD9, 0xEB, 0x01, 0x30, 0x97, 0x4E, 0xF9, 0xF1, 0x00, 0x34,
-    0x12, 0xBE, 0x10, 0x63, 0x7B, 0xF0, 0x4B, 0x72, 0x9B, 0x84, 0xD8, 0xE2, 0xC4, 0x62, 0x1C, 0x5D,
-    0xAC, 0x70, 0x60, 0x6F, 0x88, 0x14, 0x47, 0xD8, 0x95, 0x22, 0x82, 0x33, 0xBB, 0xD7, 0xDE, 0xB2,
-    0xD1, 0x8C, 0x2A, 0xB0, 0x6C, 0xF1, 0x92, 0xC5, 0x1D, 0x5B, 0x1A, 0xC6, 0xE6, 0x5B, 0xE0, 0xA4,
-    0xC7, 0x5B, 0xD8, 0x5C, 0xC1, 0x57, 0x1A, 0x0C, 0x69, 0xC3, 0x96, 0xE6, 0x22, 0x0A, 0x61, 0xE6,
-    0x8E, 0x58, 0x83, 0x18, 0x80, 0x8D, 0xFE, 0x41, 0xE3, 0x9E, 0x95, 0xF3, 0x60, 0xAF, 0x4D, 0x13,
-    0x85, 0x4B, 0x15, 0x61, 0x9B, 0x2E, 0x94, 0xF3, 0x6A, 0x41, 0xCE, 0xB3, 0xD7, 0x68, 0xB2, 0xC8,
-    0x5B, 0x0D, 0x38, 0x51, 0x7C, 0x6C, 0x73, 0xC7, 0xCB, 0xF0, 0xDB, 0xDC, 0x68, 0xBF, 0xCC, 0x4C,
-    0xE9, 0x01, 0x55, 0x6F, 0x45, 0x05, 0x23, 0x0D, 0x34, 0x22, 0xAF, 0x84, 0xB0, 0xB3, 0x20, 0x9F,
-    0x51, 0xC0, 0x28, 0x2B, 0xB3, 0x92, 0x3E, 0xDB, 0xB9, 0xB4, 0xDB, 0x3A, 0x8C, 0x31, 0x65, 0x6C,
-    0x5E, 0x8F, 0xF8, 0x8C, 0x71, 0x40, 0x18, 0xF0, 0x11, 0x34, 0x3D, 0x8A, 0x6C, 0x07, 0x48, 0xE0,
-    0x48, 0xE0, 0xD8, 0xF1, 0x90, 0xC2, 0x77, 0xDA, 0x53, 0xF3, 0x90, 0x7E, 0xF4, 0x06, 0x87, 0x0E,
-    0xBF, 0x51, 0xD7, 0x29, 0x6E, 0x51, 0x39, 0x46, 0x85, 0xED, 0x0D, 0x18, 0xDD, 0xE6, 0x23, 0xF6,
-    0x67, 0x7B, 0x7B, 0xBF, 0x77, 0x4E, 0xD4, 0x98, 0xF1, 0x4A, 0xE4, 0xE9, 0xEC, 0x7A, 0x54, 0xDE,
-    0x46, 0x4E, 0xF4, 0xF2, 0x57, 0x10, 0xFC, 0x8A, 0xF3, 0x63, 0x91, 0x5D, 0x17, 0xE5, 0x15, 0xE1,
-    0x15, 0xCE, 0xD4, 0xA0, 0x9D, 0xE3, 0x9C, 0x9B, 0xA4, 0x52, 0x67, 0x28, 0x57, 0x47, 0x76, 0x8A,
-    0xD6, 0x73, 0x32, 0xBE, 0xE1, 0xAA, 0x5D, 0x3E, 0xDA, 0x16, 0xED, 0x8E, 0x81, 0x33, 0xA9, 0xE1,
-    0x04, 0x9C, 0xBD, 0xC9, 0x0B, 0x14, 0x39, 0xF2, 0x07, 0xC4, 0x05, 0x47, 0xDA, 0xD5, 0x8B, 0x14,
-    0x07, 0x62, 0x50, 0x58, 0xE7, 0x49, 0xE9, 0xCC, 0x17, 0x4B, 0xF3, 0x71, 0x30, 0xE6, 0xD4, 0x6A,
-    0x0B, 0x0B, 0xD7, 0x2A, 0x94, 0x2A, 0xCA, 0xFF, 0xF0, 0x55, 0xC9, 0x55, 0x8C, 0xD3, 0x84, 0x9B,
-    0xCC, 0xFB, 0x5A, 0xE1, 0x3D, 0xF9, 0x22, 0x75, 0x27, 0x2E, 0x2A, 0x3C, 0xE2, 0x59, 0xC1, 0x0E,
-    0x8D, 0x07, 0xE5, 0x1B, 0x5E, 0x3C, 0x6F, 0x4F, 0xA0, 0x5D, 0x1B, 0x46, 0x8F, 0xD8, 0xFD, 0xBD,
-    0x12, 0x53, 0xE0, 0x7E, 0x54, 0x9B, 0xC8, 0x3A, 0xFA, 0x32, 0xCC, 0x14, 0x17, 0x78, 0xEE, 0xD8,
-    0xAA, 0xEE, 0xBF, 0xA2, 0x79, 0x61, 0x68, 0x39, 0xBE, 0xA5, 0x57, 0x7B, 0x7E, 0xDD, 0xED, 0x52,
-    0xDE, 0xEF, 0xDA, 0xFA, 0x33, 0xB9, 0xBC, 0xDC, 0xBC, 0x62, 0xA3, 0xF3, 0x49, 0x97, 0x7C, 0xC4,
-    0xDD, 0x0F, 0xFB, 0x36, 0x7C, 0x10, 0x2F, 0xAB, 0xD6, 0x03, 0xD5, 0x1D, 0x4B, 0xE6, 0x76, 0xDF,
-    0x18, 0xCC, 0x0F, 0xB4, 0x8A, 0x5E, 0xBC, 0x28, 0xC3, 0x97, 0x7F, 0x2E, 0xE8, 0xDF, 0xBF, 0x83,
-    0xE9, 0xFA, 0x94, 0x7D, 0xF5, 0x66, 0x08, 0x09, 0xC3, 0xC5, 0xB8, 0x5E, 0xA4, 0x3F, 0x7E, 0x49,
-    0xC1, 0xBF, 0xFE, 0xA2, 0xC5, 0x8B, 0x17, 0x55, 0x70, 0xED, 0x99, 0x9D, 0x00, 0x1F, 0xFD, 0x9A,
-    0x0B, 0x27, 0x0A, 0x8E, 0x71, 0x8F, 0x73, 0xE4, 0xC8, 0x6D, 0x73, 0x9B, 0xCD, 0x68, 0x6A, 0xF3,
-    0x12, 0x65, 0x4D, 0xAE, 0x9E, 0xF2, 0x1D, 0x5E, 0xF4, 0xA1, 0xE3, 0x61, 0x5E, 0x97, 0x1D, 0xC4,
-    0xD7, 0x03, 0x6C, 0xB2, 0xC5, 0xF3, 0xBE, 0x0C, 0xAB, 0xF8, 0x41, 0x25, 0xA3, 0x22, 0x09, 0xAA,
-    0xED, 0x48, 0xAF, 0x05, 0xC5, 0x96, 0x50, 0xBD, 0x50, 0x1F, 0x08, 0xEA, 0x86, 0x69, 0xB5, 0x4C,
-    0x97, 0x23, 0x2A, 0x2F, 0xCC, 0x2E, 0xFF, 0x13, 0x6A, 0xD2, 0xB4, 0x43, 0x23, 0x9A, 0xD6, 0xC4,
-    0x7A, 0x69, 0x4A, 0xD8, 0x0A, 0x43, 0xF9, 0x41, 0xC6, 0x08, 0x0A, 0x05, 0x7D, 0xD6, 0x68, 0x63,
-    0x4A, 0x25, 0xC7, 0x36, 0x91, 0x32, 0x3C, 0x8D, 0x80, 0xFF, 0xAB, 0x06, 0x17, 0x97, 0xD4, 0xB2,
-    0x39, 0x01, 0x16, 0xA5, 0x78, 0x1D, 0x0F, 0x70, 0x72, 0x8C, 0x4D, 0x5F, 0xB2, 0xA1, 0xEB, 0xBC,
-    0xF3, 0xDC, 0x8F, 0x08, 0x40, 0x6C, 0x1C, 0x9A, 0x49, 0xE7, 0xE4, 0x28, 0x7C, 0x9B, 0x65, 0xD6,
-    0xE8, 0xAE, 0x5F, 0xCA, 0xF4, 0x6E, 0x50, 0x67, 0x40, 0x7D, 0x49, 0x77, 0x83, 0xCA, 0xFA, 0xF3,
-    0x21, 0xC4, 0xDE, 0xD8, 0xCF, 0xDC, 0xFF, 0x75, 0x47, 0x7B, 0xC1, 0xE6, 0x57, 0x4E, 0x00, 0xA3,
-    0x84, 0x5F, 0x8F, 0xB7, 0x87, 0x7C, 0xCB, 0xB7, 0xCE, 0x21, 0x1B, 0xCE, 0xC1, 0xEB, 0xD0, 0xB6,
-    0x67, 0x62, 0xAE, 0x59, 0xAE, 0xE7, 0xC3, 0x43, 0x3C, 0xC6, 0x7C, 0xFA, 0x37, 0xF7, 0x17, 0x41,
-    0xA0, 0x4F, 0xF9, 0xF7, 0xC5, 0xCD, 0x22, 0xE4, 0xBB, 0x3C, 0xD5, 0xDF, 0x10, 0xF9, 0x48, 0x0E,
-    0x92, 0xBE, 0xA8, 0xA2, 0x12, 0x47, 0x34, 0x75, 0x9A, 0xBF, 0x2F, 0xBC, 0x34, 0xC0, 0xA1, 0x45,
-    0x54, 0x71, 0x2D, 0x07, 0xF9, 0xE8, 0xDD, 0x39, 0x7D, 0x15, 0x95, 0x2B, 0x57, 0xF6, 0xE7, 0xBB,
-    0x5D, 0x51, 0xBD, 0xFB, 0x98, 0x98, 0xA1, 0xFA, 0x54, 0xBD, 0x8F, 0x65, 0xFE, 0x07, 0xED, 0x54,
-    0x31, 0x8F, 0x1C, 0x35, 0x18, 0x7D, 0x1E, 0x87, 0xB3, 0x84, 0x8B, 0xA1, 0xC8, 0x55, 0x91, 0xCE,
-    0x4D, 0x8A, 0x53, 0x94, 0x64, 0x28, 0x52, 0x04, 0x69, 0x33, 0xE3, 0xE4, 0x94, 0x86, 0x02, 0x5D,
-    0xB1, 0x2B, 0x0A, 0x8A, 0xF4, 0x69, 0xF6, 0x8A, 0x14, 0x51, 0x74, 0xB7, 0x6B, 0xD1, 0x50, 0xD0,
-    0xE4, 0x27, 0x80, 0x04, 0xD2, 0xE6, 0x0A, 0xD2, 0x6C, 0x71, 0x90, 0xBD, 0x9C, 0x11, 0x05, 0x05,
-    0xCD, 0xF0, 0x0B, 0x98, 0x22, 0x05, 0x52, 0x0A, 0x2C, 0x98, 0x62, 0x42, 0xE6, 0xCE, 0xBC, 0x99,
-    0xBD, 0xE3, 0x08, 0x6C, 0x43, 0x8B, 0x18, 0x7F, 0x6F, 0xF4, 0x8D, 0xFD, 0xD9, 0xF3, 0xFC, 0x7D,
-    0xCF, 0xC6, 0x10, 0x2A, 0x3A, 0xB3, 0x55, 0x15, 0xA2, 0x9E, 0xA0, 0x39, 0x44, 0x4B, 0x6B, 0x7B,
-    0x5B, 0xFA, 0xEC, 0x2C, 0x92, 0x60, 0x3E, 0xA9, 0x18, 0x86, 0x8B, 0x58, 0xB3, 0xDA, 0xAD, 0x59,
-    0x60, 0x1D, 0x99, 0xD3, 0x4E, 0xBD, 0xD1, 0xCC, 0x8B, 0xF5, 0x21, 0x04, 0x07, 0xD3, 0x12, 0x30,
-    0x44, 0x41, 0xBC, 0x2E, 0x21, 0x7E, 0x28, 0x21, 0x3F, 0x2D, 0x91, 0xEA, 0x12, 0x57, 0x89, 0xFC,
-    0xE9, 0xEF, 0x76, 0x1A, 0xB9, 0x1C, 0xFD, 0x1E, 0x69, 0x05, 0xC4, 0x13, 0x9C, 0x3E, 0x26, 0x86,
-    0x2C, 0x86, 0xAB, 0xD8, 0xD9, 0xC4, 0x3B, 0x37, 0x81, 0xF7, 0x46, 0x28, 0x62, 0x79, 0x51, 0xD6,
-    0x10, 0x2D, 0xD0, 0x5E, 0x46, 0xBB, 0x10, 0xCD, 0x44, 0x31, 0xC6, 0x61, 0x9B, 0x44, 0x6C, 0x12,
-    0x83, 0xFE, 0xB6, 0x36, 0xA8, 0x0B, 0xD8, 0x1C, 0x98, 0x3C, 0xB7, 0xD3, 0x97, 0x61, 0xC2, 0x18,
-    0xB4, 0x39, 0xDA, 0x02, 0x6D, 0x86, 0x26, 0xFD, 0x2E, 0x24, 0xD1, 0x93, 0x3F, 0x9F, 0x69, 0x6C,
-    0x68, 0x3B, 0x78, 0xB0, 0x83, 0x00, 0x41, 0x6A, 0x1E, 0x8A, 0x5C, 0x48, 0x03, 0xB8, 0x06, 0x0C,
-    0x80, 0x03, 0x74, 0x23, 0x55, 0xCF, 0x66, 0x04, 0x1D, 0xCB, 0x2C, 0x09, 0xB9, 0xA8, 0x99, 0xA2,
-    0xE2, 0x4E, 0x30, 0xAF, 0xBD, 0x8A, 0x56, 0xC5, 0xAA, 0x50, 0xCB, 0x74, 0x2D, 0xF8, 0x2E, 0xEE,
-    0xD4, 0x0C, 0xC3, 0x10, 0xB4, 0x34, 0xDA, 0x42, 0x97, 0x7B, 0x32, 0x2C, 0x92, 0x9A, 0x54, 0x0F,
-    0x45, 0x93, 0x8B, 0x26, 0xFB, 0xA5, 0x49, 0xBE, 0x6C, 0x20, 0x6A, 0x24, 0xE1, 0x5D, 0x59, 0x0D,
-    0x8C, 0xCF, 0x4E, 0xFA, 0x5C, 0xDD, 0x00, 0x1E, 0x9C, 0x5B, 0x8C, 0xED, 0xE8, 0xEB, 0xE1, 0x5F,
-    0x7B, 0x96, 0x4F, 0xD7, 0x3F, 0x1A, 0xEE, 0xEF, 0xCF, 0xE8, 0x9C, 0xE5, 0x09, 0xA7, 0x9F, 0x17,
-    0x70, 0x20, 0x43, 0xEA, 0x33, 0xE4, 0xD8, 0x03, 0xE9, 0xA0, 0xED, 0xDB, 0x82, 0xFE, 0x04, 0x05,
-    0x32, 0x9B, 0x96, 0x49, 0x8D, 0x4D, 0xC0, 0x72, 0x63, 0x99, 0xD5, 0xA5, 0x0C, 0x49, 0x2D, 0x9A,
-    0xD3, 0xB0, 0x65, 0x6B, 0x44, 0x2D, 0x83, 0xAA, 0x52, 0x37, 0xC1, 0x67, 0x5C, 0x79, 0xFD, 0x2D,
-    0x8B, 0x6C, 0xDC, 0xB0, 0x38, 0xB7, 0xA0, 0xFC, 0x75, 0xE6, 0x67, 0x63, 0x25, 0x4C, 0x65, 0xDC,
-    0xFA, 0x36, 0x83, 0xFF, 0xA5, 0x8A, 0xC8, 0x99, 0xEC, 0xD4, 0x31, 0x26, 0xC7, 0xB8, 0x7C, 0xD8,
-    0xF9, 0xAB, 0xED, 0x84, 0xA5, 0x0F, 0xE4, 0x23, 0x86, 0x54, 0x85, 0xCF, 0x55, 0xD8, 0x95, 0x61,
-    0x53, 0x06, 0x74, 0x56, 0x41, 0xFB, 0xAE, 0x64, 0x83, 0xAE, 0x58, 0xCA, 0x6D, 0x6E, 0xE0, 0x26,
-    0xCB, 0x7A, 0x14, 0x9B, 0xB3, 0x78, 0x37, 0x39, 0x8F, 0xAF, 0x60, 0x9C, 0x3C, 0x86, 0x18, 0xB3,
-    0xDC, 0x14, 0x52, 0xB3, 0x23, 0x9A, 0x79, 0x52, 0xEF, 0x5D, 0xA2, 0x8A, 0x6C, 0xA7, 0xA2, 0xFF,
-    0x55, 0xFB, 0x1F, 0x50, 0xED, 0xDA, 0x0C, 0xF9, 0x3D, 0x3B, 0x50, 0xEE, 0x02, 0x93, 0x23, 0xFD,
-    0xA5, 0xE8, 0x77, 0xA5, 0xAF, 0xA5, 0x0F, 0xCA, 0x1F, 0x68, 0x5F, 0xFC, 0x16, 0x28, 0xD4, 0x64,
-    0x06, 0xC3, 0x18, 0xE9, 0x1F, 0xCA, 0x72, 0x9E, 0x94, 0x31, 0x96, 0x35, 0x30, 0x07, 0x76, 0x81,
-    0x5C, 0x78, 0x1D, 0x3B, 0x29, 0x27, 0x4F, 0x60, 0x3E, 0x72, 0x03, 0x51, 0x1D, 0x20, 0xCC, 0x11,
-    0x6A, 0xD4, 0x34, 0x3A, 0x0F, 0x11, 0x06, 0x49, 0x99, 0x3E, 0xED, 0x62, 0xEE, 0x7F, 0xFE, 0x04,
-    0xD9, 0x8F, 0xAF, 0x78, 0x3A, 0x2A, 0x88, 0x5F, 0x1D, 0xF0, 0x8C, 0x04, 0x6E, 0x11, 0x05, 0xF1,
-    0x3D, 0x7F, 0x7F, 0x9B, 0xFA, 0x44, 0x83, 0xA3, 0x8F, 0xB9, 0x64, 0xC7, 0xED, 0x0B, 0xE4, 0x47,
-    0xD8, 0xD6, 0xAE, 0x2B, 0x9C, 0x2C, 0x47, 0x1F, 0xF6, 0xBF, 0x96, 0x7E, 0x2E, 0xFD, 0x40, 0x5B,
-    0xF3, 0x1C, 0x62, 0x1B, 0xD3, 0x4E, 0x84, 0x84, 0x3E, 0xC3, 0xFB, 0x8F, 0xA1, 0xBF, 0xE1, 0x29,
-    0xF4, 0x03, 0x68, 0x77, 0x8D, 0x7D, 0xFF, 0x44, 0x6A, 0xAF, 0x63, 0x5A, 0x65, 0xAE, 0x97, 0xC8,
-    0xDF, 0xE7, 0xDF, 0xDE, 0x27, 0x8E, 0xE9, 0x93, 0xCB, 0x16, 0xC5, 0xF2, 0x01, 0xFB, 0xA6, 0xC4,
-    0x4F, 0xF4, 0xB7, 0x4A, 0x8E, 0x05, 0xC6, 0x2F, 0xBA, 0xF9, 0x3D, 0xC7, 0x23, 0x9B, 0x5A, 0xBD,
-    0xB2, 0xA5, 0x76, 0xFA, 0x02, 0xB8, 0xF2, 0xF6, 0xE3, 0x2B, 0xD6, 0x3C, 0x7A, 0xF5, 0xB2, 0x54,
-    0xBE, 0x10, 0xA1, 0xBB, 0x18, 0x82, 0x22, 0xAF, 0x95, 0x2F, 0xED, 0x38, 0x3A, 0xAE, 0x33, 0xB7,
-    0x3C, 0x21, 0x9C, 0x0B, 0xF3, 0xA8, 0x65, 0xBE, 0xBA, 0x1B, 0x65, 0xF5, 0x6D, 0xA2, 0x89, 0x71,
-    0x6D, 0xFA, 0xBD, 0xDC, 0x3F, 0x8D, 0xD7, 0xFC, 0x89, 0x76, 0x86, 0x7B, 0x48, 0xCF, 0xE1, 0x08,
-    0x6F, 0xFA, 0xDB, 0x49, 0x4F, 0x6B, 0xE8, 0xBB, 0xF6, 0xCF, 0x3D, 0xA7, 0x9C, 0x3D, 0xE5, 0x95,
-    0x21, 0x66, 0xD8, 0xB8, 0x87, 0x81, 0xB2, 0x3C, 0x18, 0xDC, 0x9D, 0xE2, 0xAD, 0xD0, 0xED, 0xDC,
-    0xDD, 0x60, 0xBE, 0xA5, 0x33, 0x5F, 0x75, 0xF9, 0x96, 0x50, 0x30, 0xB3, 0xF1, 0x2C, 0xC5, 0x1B,
-    0xCD, 0xAA, 0x9F, 0x31, 0xFC, 0x03, 0x9D, 0x58, 0x4D, 0x8C, 0xD5, 0xD6, 0x15, 0x3E, 0xB6, 0x01,
-    0x47, 0xB1, 0x82, 0x59, 0x74, 0xA0, 0xD2, 0x90, 0xB8, 0x8B, 0x2C, 0x2A, 0x4A, 0xB0, 0x2A, 0xA1,
-    0x6A, 0x2A, 0x0D, 0x63, 0x57, 0x59, 0x74, 0x91, 0x45, 0x67, 0xC1, 0x6B, 0x16, 0x2C, 0xA0, 0x5B,
-    0xBA, 0x18, 0x16, 0x91, 0x4A, 0x55, 0x78, 0x76, 0x60, 0xD1, 0x05, 0x52, 0x83, 0xD4, 0xEE, 0x9B,
-    0x45, 0x17, 0xE4, 0xB1, 0x18, 0x5A, 0xA1, 0x2A, 0x95, 0x60, 0xAE, 0x03, 0x8A, 0xB2, 0x60, 0xD1,
-    0x97, 0xA2, 0xA8, 0xCB, 0xBA, 0x53, 0x50, 0x2B, 0xB2, 0xC0, 0x15, 0x1E, 0xF1, 0x66, 0x6A, 0xFB,
-    0xF6, 0xFB, 0x8E, 0xDF, 0x9B, 0x19, 0x28, 0xA9, 0x50, 0x2C, 0xCD, 0x77, 0xEF, 0xF8, 0x5E, 0xDF,
-    0x7B, 0xEE, 0x39, 0xDF, 0xF9, 0xB9, 0x4F, 0x84, 0xCF, 0x4A, 0x27, 0xE2, 0x6E, 0xAE, 0x14, 0x12,
-    0x14, 0x41, 0x21, 0x51, 0xEA, 0x17, 0x92, 0xF0, 0xBD, 0xC2, 0x50, 0xC1, 0x19, 0x0C, 0x4E, 0x0E,
-    0x7D, 0x6B, 0x9B, 0xA1, 0x64, 0x72, 0x21, 0x93, 0x25, 0x39, 0x9A, 0x00, 0x0E, 0xC7, 0xE9, 0x92,
-    0x48, 0x58, 0x00, 0xBC, 0xCD, 0x6C, 0x90, 0x4A, 0x66, 0xED, 0x58, 0x30, 0x05, 0xCF, 0xD2, 0xF3,
-    0x10, 0x10, 0x42, 0x71, 0xCC, 0x20, 0x13, 0x2C, 0x65, 0x45, 0xF6, 0xEC, 0xC1, 0xC0, 0xFE, 0xD7,
-    0x00, 0xAF, 0x1D, 0x06, 0x1C, 0xBB, 0x20, 0x12, 0x58, 0x8B, 0x55, 0xDA, 0xAC, 0x74, 0xDA, 0x85,
-    0xA4, 0xF2, 0xEA, 0xE3, 0x3F, 0xAB, 0xC3, 0xF2, 0xDC, 0x1F, 0xAA, 0xA8, 0xB8, 0xF1, 0xFB, 0x34,
-    0x2E, 0x6E, 0x94, 0x92, 0x14, 0xE5, 0x58, 0x92, 0xFC, 0x73, 0xC0, 0xFB, 0x9F, 0x43, 0xD2, 0xF7,
-    0xEF, 0x00, 0x2E, 0xDD, 0xCD, 0x25, 0xB9, 0x7B, 0x39, 0x97, 0xF8, 0xEE, 0x2F, 0x53, 0x89, 0xEE,
-    0xFF, 0x10, 0x52, 0x3D, 0xC5, 0x86, 0xBE, 0x0D, 0xE5, 0x9C, 0x6B, 0xF7, 0x3B, 0x95, 0x18, 0xBB,
-    0x5A, 0x4A, 0xC4, 0xE5, 0x5F, 0x1F, 0x5E, 0x15, 0x39, 0xBA, 0x88, 0x1D, 0x17, 0x17, 0x00, 0x0B,
-    0xC7, 0x65, 0xFA, 0x38, 0x16, 0x9A, 0x88, 0xB6, 0xCC, 0x58, 0x4C, 0x1A, 0x56, 0x6E, 0x23, 0x5E,
-    0xED, 0x55, 0xE2, 0x55, 0x61, 0x29, 0xEE, 0x38, 0xC4, 0xC1, 0x24, 0x2E, 0xA8, 0x17, 0x85, 0xCB,
-    0x6D, 0x34, 0x4E, 0x2E, 0x75, 0xA6, 0x4A, 0xF2, 0xE4, 0x2E, 0xE1, 0xD2, 0x18, 0x90, 0x42, 0xB4,
-    0x84, 0x53, 0x12, 0x4E, 0x06, 0x60, 0x12, 0x64, 0xA9, 0x00, 0x7E, 0x9D, 0xC8, 0x01, 0xAF, 0x49,
-    0xE4, 0x86, 0x58, 0xE3, 0x57, 0x92, 0x50, 0x57, 0x3E, 0xB7, 0x94, 0xBD, 0xAA, 0x39, 0x2B, 0x2B,
-    0x80, 0xD4, 0x9D, 0x48, 0x9C, 0x3A, 0x13, 0x09, 0x09, 0xFE, 0x36, 0x40, 0xBC, 0x17, 0x41, 0x37,
-    0xFA, 0x10, 0x72, 0xDB, 0xFA, 0xF9, 0x81, 0x9F, 0x76, 0x1F, 0xC1, 0x10, 0xB6, 0xFD, 0x9F, 0x2F,
-    0x70, 0x2C, 0x91, 0x79, 0xBB, 0x2C, 0xD0, 0xC8, 0x64, 0x76, 0xF2, 0x79, 0x0B, 0x95, 0x98, 0xD5,
-    0x5A, 0xDC, 0xDA, 0xC1, 0xB1, 0x2B, 0x69, 0xC4, 0x1F, 0xCB, 0x2D, 0x09, 0xC6, 0x72, 0x86, 0x00,
-    0xE9, 0x4B, 0x00, 0x06, 0xA6, 0x70, 0x70, 0x73, 0xC0, 0xE5, 0xA1, 0xCD, 0xB9, 0xDB, 0xE8, 0xC9,
-    0x45, 0xFC, 0xCD, 0x65, 0xB3, 0x77, 0x3D, 0x75, 0xD4, 0xEE, 0x54, 0xB3, 0xDC, 0xE4, 0xE6, 0x8F,
-    0x52, 0xC9, 0x03, 0xDB, 0x9D, 0xCA, 0x63, 0x1E, 0x75, 0x41, 0x56, 0x28, 0x88, 0x93, 0xCA, 0xEE,
-    0xC7, 0x2D, 0xFA, 0xD6, 0xCB, 0xFB, 0x36, 0x98, 0x0E, 0x87, 0xD4, 0x7D, 0x1D, 0x37, 0x11, 0x54,
-    0x36, 0x3F, 0xB1, 0x36, 0x81, 0xE8, 0x4E, 0x57, 0x24, 0x2D, 0x4F, 0x63, 0x25, 0xAC, 0x05, 0x6A,
-    0x6C, 0xA1, 0x67, 0x72, 0xAF, 0x91, 0xA0, 0xDC, 0x6E, 0x93, 0x17, 0xB5, 0xE1, 0xB4, 0x8D, 0xA7,
-    0x6D, 0x32, 0x6D, 0xB3, 0x69, 0xFB, 0x9F, 0x69, 0xFB, 0x25, 0x5B, 0xA7, 0x75, 0xEF, 0xC1, 0x5A,
-    0xD0, 0xD1, 0xAF, 0xEF, 0x6D, 0x62, 0x6A, 0x62, 0x9F, 0xBE, 0x63, 0x25, 0x99, 0xF4, 0x52, 0xF1,
-    0xD9, 0x3F, 0x6D, 0x8F, 0x4E, 0xDB, 0x6F, 0x2B, 0xC6, 0x58, 0xDF, 0xE6, 0xF3, 0x1D, 0x3E, 0xCC,
-    0x1D, 0xB0, 0xBD, 0x86, 0xA4, 0xB9, 0x40, 0x79, 0xB6, 0x50, 0x2C, 0x89, 0x4F, 0x2B, 0xE2, 0x93,
-    0x09, 0xF1, 0xDF, 0x8D, 0x90, 0xA6, 0x78, 0xCA, 0xB3, 0x5B, 0x66, 0xB4, 0x75, 0x55, 0x40, 0x2B,
-    0xBC, 0x07, 0xF9, 0xA7, 0xEF, 0xAB, 0xB3, 0x5B, 0xD7, 0xB7, 0xF8, 0xDE, 0x9B, 0xF0, 0xBD, 0xD3,
-    0x10, 0xA5, 0x53, 0xCC, 0x14, 0x13, 0xC5, 0x48, 0x11, 0xDA, 0x98, 0xEF, 0x52, 0x30, 0x2D, 0xB6,
-    0x85, 0x47, 0xBE, 0x6D, 0x51, 0x9B, 0xDF, 0xB1, 0x6A, 0x76, 0xA7, 0xA5, 0x4C, 0x54, 0x5A, 0x92,
-    0x6B, 0xA3, 0xD4, 0x6E, 0xC1, 0x57, 0x6D, 0xC2, 0x59, 0x73, 0xA0, 0x6F, 0xCE, 0xE9, 0x58, 0x71,
-    0xA3, 0x9F, 0x59, 0xE9, 0x77, 0xDE, 0x46, 0x2A, 0xAD, 0xD3, 0x66, 0x38, 0x09, 0x44, 0x3B, 0xB4,
-    0xB1, 0x2C, 0xF6, 0x23, 0x65, 0x47, 0x2B, 0x2F, 0xD3, 0xB8, 0x68, 0x18, 0x79, 0x6A, 0x28, 0xE8,
-    0x37, 0xB0, 0xE6, 0x99, 0x84, 0x6C, 0x35, 0x95, 0x2A, 0x6F, 0x2F, 0x0E, 0xAC, 0xE2, 0xD2, 0x27,
-    0x94, 0xA6, 0x5E, 0xE3, 0x74, 0xEA, 0xA4, 0x30, 0x57, 0xDA, 0xB7, 0x2A, 0x32, 0xDA, 0x68, 0xBB,
-    0x0D, 0xEC, 0x58, 0xDB, 0xE4, 0x54, 0xAD, 0x6D, 0x23, 0x8D, 0xCE, 0xAF, 0xE5, 0x63, 0xB4, 0x43,
-    0xA7, 0x96, 0x33, 0x4E, 0xB3, 0x6F, 0x02, 0xD3, 0xD2, 0x69, 0x72, 0x01, 0x57, 0x9D, 0xCE, 0xE4,
-    0x92, 0xC1, 0x7F, 0x1A, 0x2C, 0x13, 0xC1, 0x54, 0x0D, 0xD8, 0xE1, 0x58, 0x28, 0xD7, 0x87, 0xC5,
-    0x22, 0x7C, 0xEF, 0x35, 0xAA, 0xAE, 0xC6, 0x69, 0xE5, 0x00, 0xD6, 0x68, 0x40, 0xB8, 0x52, 0x96,
-    0xD0, 0x66, 0x3F, 0xA8, 0xE4, 0x22, 0x18, 0x98, 0x7C, 0x52, 0x4B, 0x73, 0xCA, 0x5E, 0x0D, 0x37,
-    0xBB, 0x77, 0x6B, 0x63, 0x2B, 0xB7, 0x85, 0xE1, 0x7B, 0x2A, 0x2C, 0x43, 0xF9, 0xB5, 0xBC, 0x8A,
-    0x05, 0xDB, 0x79, 0xFB, 0x00, 0xC1, 0xD5, 0x31, 0x9B, 0x54, 0x3C, 0x44, 0x0F, 0x0B, 0x1E, 0x1F,
-    0xC1, 0x24, 0xC8, 0xC5, 0xC0, 0x71, 0xC6, 0xF0, 0x78, 0xC9, 0x52, 0x31, 0x25, 0x89, 0x05, 0xAB,
-    0x80, 0x1B, 0x91, 0xCE, 0x7C, 0x52, 0xC9, 0x5B, 0x10, 0xA5, 0x70, 0xFE, 0x52, 0xD3, 0x9F, 0xC2,
-    0xB1, 0xFB, 0xC9, 0x44, 0x3B, 0xA5, 0x87, 0x13, 0x9E, 0x67, 0x24, 0xE9, 0x9F, 0x23, 0xD7, 0xB7,
-    0xAE, 0x8F, 0xEC, 0x68, 0x6B, 0x84, 0xC8, 0x15, 0xC0, 0x05, 0xA0, 0x4B, 0x77, 0x12, 0x4A, 0xE2,
-    0x8E, 0xA9, 0x9F, 0xFD, 0x12, 0xBF, 0xAD, 0x46, 0x7E, 0x5D, 0xA2, 0xCB, 0xEC, 0xAC, 0x1D, 0x95,
-    0xF0, 0x33, 0x0A, 0x9A, 0x2D, 0x4A, 0x78, 0x8F, 0x4A, 0x4D, 0xDE, 0x93, 0xE0, 0x6F, 0x1A, 0xFB,
-    0x11, 0xF7, 0x94, 0x1F, 0x31, 0x3A, 0xAA, 0x77, 0x06, 0xC1, 0x46, 0x3B, 0x63, 0xEA, 0x9A, 0x8E,
-    0x9E, 0x4B, 0x93, 0x8D, 0x56, 0xA1, 0xCD, 0x21, 0x2D, 0x49, 0x4C, 0x7A, 0x4C, 0x89, 0x71, 0x3E,
-    0x43, 0xAF, 0x8A, 0x5E, 0x02, 0xE1, 0x70, 0x3B, 0xE8, 0x28, 0x7A, 0x35, 0x31, 0xA8, 0x86, 0xDE,
-    0xD6, 0xC8, 0x14, 0x43, 0xCF, 0xDA, 0x4D, 0x72, 0x83, 0x01, 0x27, 0xB2, 0x1A, 0xB0, 0x29, 0x10,
-    0x5C, 0xDD, 0x19, 0x98, 0x93, 0x10, 0xD8, 0x36, 0x32, 0xCD, 0x3E, 0x80, 0x7D, 0xCB, 0xF0, 0x5D,
-    0x8B, 0x78, 0xEB, 0x77, 0x26, 0xA3, 0xAE, 0x2C, 0x89, 0x62, 0x21, 0x11, 0x00, 0x14, 0x32, 0xF4,
-    0xF1, 0xEC, 0xC5, 0xC0, 0x51, 0x9D, 0x07, 0xA5, 0x23, 0xBC, 0x54, 0xBE, 0xC1, 0xEA, 0x5D, 0xF2,
-    0x40, 0xCC, 0x24, 0x69, 0x9E, 0x0B, 0x5A, 0x21, 0x1D, 0xF6, 0xD5, 0xD1, 0x68, 0x74, 0x75, 0x9A,
-    0x45, 0x0C, 0x78, 0x13, 0x6E, 0x59, 0xEA, 0x01, 0x56, 0xBC, 0xCD, 0x85, 0x1A, 0x5A, 0x7E, 0x22,
-    0x7B, 0xC8, 0xF6, 0xDD, 0x61, 0xF4, 0xD0, 0x06, 0x92, 0x26, 0x5C, 0xBB, 0x10, 0x9F, 0xFF, 0x2A,
-    0x9C, 0xDA, 0x18, 0x30, 0x36, 0x77, 0xB3, 0x79, 0xFC, 0xC2, 0x9D, 0xF4, 0x0C, 0x57, 0xA7, 0xD4,
-    0xE3, 0x39, 0xA4, 0x8E, 0x9F, 0x4A, 0xD8, 0x19, 0xEA, 0xA1, 0xE9, 0xB3, 0x48, 0x6C, 0x1B, 0xCF,
-    0x56, 0xF3, 0xF6, 0x5F, 0x2E, 0x9D, 0x52, 0xC8, 0x2B, 0xC3, 0x40, 0x06, 0x44, 0x0A, 0x04, 0x22,
-    0xB7, 0x03, 0x19, 0xB8, 0x8C, 0x9C, 0x50, 0xE4, 0xF2, 0xC6, 0x43, 0x74, 0x9F, 0x33, 0xA7, 0xBE,
-    0x38, 0xA9, 0x71, 0xA6, 0x45, 0xDF, 0xB4, 0x27, 0xF1, 0xFE, 0x09, 0x77, 0x33, 0x85, 0xD5, 0x99,
-    0x99, 0x7E, 0x8B, 0x58, 0xC9, 0x15, 0x6A, 0x5D, 0x4D, 0x57, 0x76, 0x3B, 0xDD, 0x05, 0xBE, 0x64,
-    0x49, 0xE3, 0x43, 0xE4, 0xF9, 0x26, 0x24, 0xC1, 0x00, 0x99, 0xD9, 0x12, 0xBA, 0x25, 0x4C, 0x59,
-    0xBA, 0x00, 0x78, 0xE3, 0x3C, 0x60, 0xFF, 0x7B, 0xBD, 0x14, 0x86, 0x87, 0x31, 0x0E, 0x21, 0x86,
-    0x52, 0x0D, 0x8F, 0x09, 0x77, 0x44, 0x19, 0x40, 0x7A, 0x1A, 0x57, 0x9C, 0xD2, 0xAC, 0x6C, 0x0F,
-    0xA4, 0xFD, 0x80, 0xA3, 0x47, 0x2E, 0xFB, 0x6F, 0x9F, 0x81, 0x83, 0xD8, 0x5A, 0x34, 0x8C, 0x60,
-    0xC2, 0xD4, 0x03, 0x59, 0x77, 0xF4, 0xCF, 0x5B, 0xD3, 0x76, 0xEF, 0xAD, 0x59, 0xD2, 0xB3, 0xA5,
-    0x76, 0x6E, 0xFA, 0xE5, 0xC5, 0xA9, 0x2D, 0x8B, 0xA8, 0xB7, 0x6D, 0x94, 0x07, 0x7D, 0x2A, 0x4A,
-    0x52, 0xAF, 0x9F, 0x94, 0x68, 0xC0, 0xD2, 0x8A, 0xC8, 0xA9, 0xB5, 0x73, 0xBB, 0x4F, 0xA8, 0xAA,
-    0xDF, 0x67, 0x3B, 0x7C, 0xAF, 0x1D, 0x77, 0x9A, 0x97, 0x69, 0xCA, 0xED, 0x8E, 0x5B, 0xEF, 0x05,
-    0x55, 0xB0, 0xAC, 0x57, 0x25, 0x10, 0x15, 0x89, 0xD6, 0xAB, 0x26, 0xD8, 0x17, 0x3B, 0x06, 0x7F,
-    0x2F, 0x89, 0x08, 0x0E, 0x77, 0xC7, 0x7E, 0x81, 0x68, 0x04, 0x4F, 0x45, 0xE7, 0x38, 0x46, 0x13,
-    0x7F, 0x1C, 0x14, 0xE7, 0x22, 0xC4, 0xB7, 0xA0, 0x0A, 0xD3, 0xE3, 0x17, 0x86, 0xA7, 0xCB, 0x70,
-    0x73, 0x28, 0x51, 0x19, 0x74, 0x12, 0xFE, 0xB6, 0x97, 0x48, 0xA2, 0x19, 0x33, 0xE3, 0xD9, 0xA1,
-    0x93, 0x59, 0x67, 0x69, 0xD6, 0xB9, 0x38, 0xEB, 0xDC, 0x9A, 0x75, 0xAE, 0xED, 0x90, 0xD9, 0xA7,
-    0xAF, 0xC7, 0xAB, 0xD0, 0xDD, 0x92, 0x07, 0x05, 0x5C, 0x70, 0x70, 0xF8, 0x5B, 0xBB, 0x00, 0x81,
-    0xE4, 0x36, 0x93, 0xF4, 0x90, 0xA3, 0x99, 0x8F, 0x79, 0x09, 0xF5, 0x9B, 0xFC, 0x8A, 0x9B, 0x93,
-    0x84, 0x21, 0x4F, 0x19, 0x40, 0x53, 0x07, 0x18, 0x3E, 0x8F, 0xFB, 0xF8, 0xF7, 0x56, 0x08, 0x97,
-    0x69, 0xDF, 0xE8, 0xC4, 0x7B, 0xBC, 0x08, 0xCE, 0xFC, 0xA8, 0x4A, 0xD2, 0xFD, 0x41, 0x99, 0xE4,
-    0x87, 0xBD, 0x22, 0x2A, 0x16, 0xDC, 0x34, 0x2C, 0xFA, 0xA8, 0x22, 0xAC, 0x34, 0x9C, 0x1C, 0x95,
-    0x86, 0x57, 0x78, 0x50, 0x0A, 0x0E, 0xCE, 0xE2, 0x2B, 0x67, 0xA8, 0x66, 0x22, 0xA8, 0x41, 0xEF,
-    0xEE, 0x2A, 0xCD, 0xD6, 0x32, 0xE9, 0x1B, 0x3A, 0x69, 0x54, 0xCC, 0x99, 0xC1, 0xE9, 0x87, 0x9A,
-    0x1D, 0xF1, 0x2F, 0x36, 0x26, 0x0C, 0xEC, 0xE0, 0xF4, 0xC6, 0xEC, 0x1D, 0x56, 0x36, 0x8C, 0xA2,
-    0x46, 0xBD, 0x81, 0xC9, 0xC4, 0x8C, 0xD2, 0xE7, 0x99, 0xF3, 0x3C, 0x70, 0xC3, 0x43, 0xF6, 0xA1,
-    0x70, 0x4B, 0x35, 0x5B, 0xB1, 0x83, 0x86, 0xC5, 0x52, 0x68, 0x1F, 0x33, 0x08, 0xBE, 0x7D, 0xA7,
-    0x83, 0x5F, 0x7A, 0xF0, 0x10, 0xD4, 0x8A, 0xC5, 0x10, 0x7B, 0x7B, 0xC5, 0x02, 0xB6, 0xE4, 0xCC,
-    0xA8, 0x20, 0xC6, 0x8A, 0x49, 0xFE, 0x95, 0xF8, 0xD8, 0x22, 0xCD, 0x7B, 0x9F, 0xD9, 0x71, 0x52,
-    0x70, 0x1D, 0xCE, 0x37, 0xBA, 0xC2, 0x9A, 0x06, 0xF8, 0x35, 0x14, 0x8E, 0x44, 0xB7, 0x21, 0x8A,
-    0xB9, 0x4C, 0x8C, 0xEC, 0x97, 0x4C, 0x9D, 0x96, 0x7C, 0x87, 0xA2, 0x76, 0x64, 0x73, 0x95, 0x00,
-    0x3D, 0x77, 0x55, 0xA5, 0xAC, 0x71, 0xFA, 0x78, 0x8E, 0xE7, 0x17, 0x4A, 0x93, 0x3F, 0x2A, 0x11,
-    0x2B, 0x2D, 0xBF, 0x4A, 0xFA, 0x8A, 0x3B, 0x5E, 0xD3, 0x05, 0x12, 0xE9, 0xCB, 0x8C, 0xE6, 0xEC,
-    0xEA, 0xC8, 0x3C, 0xBA, 0x06, 0x07, 0xA5, 0x69, 0x8E, 0x71, 0xA1, 0xB3, 0x66, 0xB4, 0xBA, 0x75,
-    0xAD, 0x1F, 0x95, 0x8F, 0xC5, 0x9B, 0xB0, 0xC0, 0x40, 0x3E, 0x70, 0x18, 0xAA, 0x85, 0xF9, 0xA5,
-    0x53, 0x09, 0x0C, 0xE9, 0x0C, 0xD3, 0xAC, 0x6C, 0xCA, 0x3E, 0xFB, 0x00, 0xFA, 0x8F, 0x34, 0x34,
-    0x51, 0x0E, 0xE6, 0x5A, 0xBB, 0xCA, 0xA0, 0x8E, 0x2F, 0x60, 0xE4, 0x21, 0x05, 0x4F, 0xE8, 0xA7,
-    0x3B, 0xB7, 0x8D, 0x4C, 0xE6, 0x06, 0x03, 0x9B, 0x72, 0x9F, 0x6A, 0x6E, 0x60, 0x37, 0xE1, 0x14,
-    0xBC, 0x50, 0x18, 0xAB, 0x51, 0x12, 0x91, 0xAD, 0x1B, 0x0C, 0x96, 0x43, 0x9E, 0x45, 0xEB, 0x14,
-    0xC4, 0xF3, 0x57, 0x08, 0x2A, 0x68, 0x44, 0x22, 0xC5, 0xA9, 0xC7, 0x1A, 0xD0, 0xE9, 0x7E, 0xDC,
-    0x72, 0x4B, 0x9E, 0xFD, 0xE4, 0x76, 0x10, 0x08, 0xB6, 0x6B, 0x7C, 0x96, 0xDE, 0xE6, 0x1D, 0xD6,
-    0xF8, 0x01, 0x6B, 0xFC, 0x80, 0x35, 0x7E, 0xC0, 0x1A, 0x3F, 0xA0, 0xC1, 0x02, 0xC6, 0x56, 0x42,
-    0xFE, 0x7F, 0xA1, 0x98, 0x4D, 0x8E, 0xF8, 0x59, 0x58, 0xF1, 0xBE, 0x81, 0xB4, 0x8B, 0x1A, 0x3F,
-    0x60, 0x8D, 0x7F, 0xE5, 0xD9, 0x1A, 0x5F, 0x4B, 0x59, 0x15, 0x63, 0x1F, 0x6B, 0x9F, 0x80, 0x5E,
-    0x1F, 0xBE, 0x18, 0xB4, 0x04, 0x54, 0xF8, 0xCA, 0x29, 0x2F, 0x05, 0xBA, 0x47, 0xC0, 0x1B, 0x8C,
-    0xD7, 0x9E, 0xF1, 0x2A, 0x14, 0x35, 0x5A, 0x59, 0x4D, 0x43, 0x05, 0x4B, 0x14, 0x8B, 0xEC, 0x8D,
-    0x81, 0x96, 0x9E, 0x37, 0xA4, 0x12, 0x97, 0x08, 0x6F, 0xCA, 0x2E, 0x97, 0xD4, 0x84, 0xD5, 0xA9,
-    0xE6, 0xA8, 0xCD, 0x84, 0x5D, 0x5F, 0xBB, 0x59, 0x33, 0x0B, 0x18, 0x1A, 0x9A, 0xFB, 0x42, 0x32,
-    0xCE, 0x63, 0xB3, 0x16, 0xE5, 0xDF, 0xFB, 0xC7, 0x9F, 0xE3, 0xF4, 0xBB, 0xF7, 0xAF, 0x24, 0xF2,
-    0xFD, 0xFB, 0x57, 0x6E, 0xE3, 0x46, 0xF6, 0x41, 0x4D, 0xBA, 0xC2, 0x97, 0xFF, 0xFA, 0x01, 0x96,
-    0xBA, 0x7F, 0x65, 0x0A, 0xB4, 0xAA, 0x9A, 0x7B, 0x57, 0x4A, 0x3D, 0x8B, 0x5C, 0x9A, 0xF2, 0xF8,
-    0xE9, 0xC4, 0x87, 0xFB, 0x57, 0x5E, 0xE5, 0x13, 0xBC, 0xBC, 0x24, 0x5C, 0xF5, 0x2A, 0x90, 0x7C,
-    0x27, 0x85, 0xBE, 0x2C, 0x68, 0x6E, 0x5D, 0xE9, 0x48, 0x42, 0xD8, 0x84, 0x39, 0x29, 0x57, 0x90,
-    0xBE, 0xAC, 0xCC, 0x76, 0x4E, 0x50, 0xF4, 0xA3, 0x73, 0x83, 0xEC, 0x8B, 0x74, 0x76, 0xDB, 0x4B,
-    0xA7, 0x81, 0xE1, 0x50, 0xC3, 0x04, 0x03, 0xC5, 0xC4, 0xF4, 0x3C, 0x65, 0x62, 0xAF, 0x21, 0xF5,
-    0xA6, 0x6E, 0x16, 0x3A, 0x24, 0xD3, 0x95, 0xC6, 0xB3, 0x39, 0x3E, 0xF6, 0x45, 0x61, 0x50, 0xF4,
-    0xEE, 0x80, 0xFC, 0x3C, 0x8B, 0x33, 0xD9, 0x0E, 0x30, 0xAC, 0x66, 0x2B, 0xF8, 0x0E, 0xC5, 0x28,
-    0x84, 0x4C, 0xC9, 0x5F, 0x38, 0xC7, 0xF9, 0x8C, 0x65, 0x6E, 0xB6, 0x39, 0xD5, 0x72, 0xC4, 0xDA,
-    0xE5, 0xE7, 0x19, 0x93, 0x71, 0x86, 0xE0, 0x0F, 0x50, 0xC2, 0xBB, 0xCA, 0x7A, 0xFE, 0x0B, 0x5F,
-    0xCC, 0xE8, 0x8A, 0x88, 0x21, 0xE9, 0x3E, 0xFB, 0x10, 0xE5, 0xC7, 0x2C, 0xCD, 0x41, 0x54, 0xF5,
-    0xC5, 0x78, 0x55, 0x2F, 0x66, 0x3E, 0xCF, 0xB4, 0xA0, 0x61, 0x63, 0xD1, 0xFB, 0x14, 0x21, 0x31,
-    0xB9, 0x0E, 0x0F, 0x63, 0x39, 0x73, 0x1D, 0x7E, 0x7D, 0x9D, 0x5C, 0xE0, 0x7D, 0x2C, 0x54, 0x0C,
-    0x7A, 0x4C, 0xC5, 0xFD, 0xF4, 0x15, 0xF6, 0x1F, 0x9F, 0x08, 0x35, 0xFE, 0x20, 0xA7, 0xBA, 0xEB,
-    0xFF, 0x9C, 0x30, 0xE4, 0x5C, 0x1E, 0x4F, 0xEF, 0xC7, 0xF2, 0x27, 0x0D, 0x3C, 0x3F, 0xE9, 0x77,
-    0xAD, 0xE0, 0xA2, 0x82, 0x90, 0x71, 0x4C, 0x73, 0xD0, 0x9A, 0x32, 0xAF, 0xD9, 0xE6, 0x90, 0xCC,
-    0x11, 0xBE, 0x21, 0xDB, 0x57, 0xC5, 0xDD, 0xE8, 0x5C, 0x4C, 0xF5, 0x02, 0xC0, 0x50, 0xD7, 0x9D,
-    0x80, 0xF6, 0x82, 0x6A, 0x11, 0x74, 0x0E, 0x8B, 0x45, 0x8F, 0x77, 0xE4, 0x45, 0x96, 0xF6, 0x98,
-    0xD9, 0x82, 0xBA, 0x8B, 0x58, 0x79, 0x0D, 0x98, 0x21, 0x2B, 0x2F, 0xE2, 0x6D, 0xFB, 0xB5, 0x30,
-    0xB3, 0xB0, 0x93, 0x5E, 0x38, 0x50, 0x70, 0x19, 0x66, 0xEC, 0x38, 0x07, 0xA0, 0x08, 0xC4, 0x75,
-    0x7C, 0xFC, 0x2C, 0x14, 0xB3, 0xD1, 0x4C, 0x0E, 0xB6, 0xEF, 0x36, 0xFD, 0x4F, 0x1F, 0x07, 0xDB,
-    0xE5, 0xAF, 0x77, 0x09, 0x4F, 0x79, 0xD2, 0xF5, 0x62, 0x37, 0x04, 0x9A, 0xAA, 0x9E, 0xDA, 0xDC,
-    0x9D, 0xAC, 0xDF, 0xAB, 0x82, 0x72, 0xFD, 0x4E, 0x13, 0x16, 0xEB, 0x45, 0x1B, 0xE7, 0xEB, 0xC5,
-    0x30, 0x49, 0xD7, 0x8B, 0xA5, 0x44, 0xA6, 0xB0, 0xB0, 0x43, 0xA3, 0x9D, 0x58, 0xCA, 0x82, 0xAA,
-    0x77, 0x64, 0xBD, 0xC0, 0xAB, 0x13, 0xF4, 0x55, 0x09, 0x87, 0x8F, 0xAC, 0x3E, 0x1A, 0xFD, 0x8E,
-    0x3F, 0x3A, 0xD4, 0x0A, 0x72, 0x98, 0x3F, 0x85, 0x10, 0x0C, 0xC5, 0x5D, 0xD1, 0xB8, 0x55, 0x21,
-    0x85, 0xFB, 0xFC, 0x1D, 0xC4, 0xAF, 0x1C, 0x85, 0x96, 0x5E, 0xD4, 0xCE, 0xFE, 0xD5, 0x01, 0x94,
-    0xA7, 0xFE, 0xC6, 0x0A, 0x83, 0x1C, 0x18, 0xEB, 0x6F, 0x9C, 0x2A, 0x67, 0xA3, 0x48, 0x08, 0x3E,
-    0xB3, 0xB1, 0x4F, 0x66, 0x3E, 0x03, 0x66, 0x36, 0x8A, 0x05, 0x4E, 0x6F, 0xAD, 0xF2, 0x6E, 0x4B,
-    0xF7, 0xD8, 0x96, 0x40, 0xBE, 0xF9, 0xE6, 0x94, 0xAF, 0x59, 0x97, 0x7A, 0xED, 0x4A, 0x19, 0x96,
-    0x7E, 0x8D, 0x64, 0x5A, 0x27, 0xA9, 0xCB, 0x1F, 0x52, 0xF4, 0xA0, 0x2F, 0xFA, 0xA3, 0x97, 0xD2,
-    0x85, 0x91, 0x11, 0xBE, 0x85, 0x02, 0xF5, 0xA6, 0x47, 0x3E, 0x67, 0xCC, 0x3B, 0xCB, 0xBA, 0x1C,
-    0x72, 0xCB, 0x32, 0x5C, 0xBB, 0x3A, 0x32, 0x1A, 0x7D, 0xF8, 0x5F, 0x63, 0x60, 0x60, 0x60, 0xF8,
-    0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x0E, 0x0D, 0x0D, 0x0D, 0x01, 0x00, 0xCD, 0x54, 0xBB, 0x4E, 0xC3,
-    0x40, 0x10, 0x1C, 0xDB, 0x08, 0x17, 0x2E, 0xDC, 0x80, 0x84, 0xA0, 0x70, 0x4F, 0x41, 0x5A, 0x2A,
-    0x6C, 0xF1, 0x05, 0x29, 0xE8, 0xE9, 0xA1, 0xE0, 0x07, 0x08, 0xA1, 0xA3, 0x4D, 0xC3, 0x27, 0x20,
-    0x91, 0x50, 0xE4, 0x0B, 0x82, 0xF3, 0x09, 0xA9, 0xA8, 0x4D, 0x83, 0xE8, 0x70, 0x91, 0xE2, 0x10,
-    0x8E, 0x97, 0xD9, 0xC5, 0xE6, 0x25, 0x3A, 0x22, 0x44, 0x22, 0xCD, 0x9C, 0x6F, 0xB3, 0x7B, 0x33,
-    0xB7, 0xEB, 0x00, 0xEB, 0xF0, 0x86, 0x40, 0x28, 0x45, 0x47, 0x66, 0x48, 0x2E, 0xDC, 0x24, 0x2C,
-    0x91, 0x7A, 0xAE, 0x0A, 0x0A, 0xF4, 0x70, 0xEF, 0xBC, 0x0C, 0x13, 0xF8, 0x0E, 0x40, 0xF5, 0x99,
-    0x52, 0xE1, 0xA7, 0xC2, 0xB6, 0x8C, 0xF2, 0xFA, 0xFA, 0x5B, 0x6C, 0xB9, 0xB4, 0x40, 0x50, 0x01,
-    0x5B, 0x32, 0x38, 0xAC, 0xBB, 0x3C, 0xD6, 0x89, 0xE8, 0xEE, 0xF1, 0x33, 0x21, 0xAC, 0xA5, 0x00,
-    0x92, 0x69, 0x5C, 0x52, 0x10, 0x02, 0xE2, 0x2D, 0x82, 0x99, 0xA6, 0xC0, 0xF2, 0xDF, 0x51, 0xD5,
-    0xCE, 0x55, 0xEC, 0x8D, 0x6B, 0xEB, 0x2E, 0x0B, 0x4D, 0x1E, 0xD5, 0x25, 0x75, 0x97, 0xE2, 0xFA,
-    0x2A, 0x68, 0xF3, 0xAA, 0x0B, 0x04, 0x7A, 0x22, 0xB5, 0x25, 0x73, 0xD3, 0x46, 0x3C, 0x33, 0x5C,
-    0xC0, 0x9F, 0x5B, 0x6E, 0x8B, 0xD4, 0xB6, 0x6F, 0xDA, 0xBE, 0xED, 0x2F, 0x01, 0xA9, 0xCD, 0x7D,
-    0x68, 0xCB, 0x55, 0xDB, 0x3A, 0x30, 0x7E, 0x84, 0xF5, 0x3B, 0x7A, 0x91, 0x73, 0x68, 0xC7, 0xD3,
-    0xAC, 0xC3, 0x4B, 0x63, 0xCF, 0x27, 0x88, 0xB9, 0xE8, 0xA1, 0xA8, 0x10, 0x31, 0x34, 0x81, 0xE7,
-    0x9A, 0x3B, 0xF4, 0xBF, 0x2E, 0xAC, 0xFB, 0xC2, 0x7A, 0x7A, 0xA5, 0xF5, 0x68, 0x5C, 0x36, 0xA1,
-    0xF0, 0x8F, 0x17, 0x76, 0xF9, 0x51, 0xD9, 0x4C, 0xC7, 0x49, 0x9D, 0xD9, 0x7C, 0x94, 0x22, 0x53,
-    0x73, 0x7A, 0x74, 0xD9, 0x7D, 0x73, 0xCA, 0xBD, 0xD6, 0x69, 0xD9, 0x3A, 0x2D, 0x1B, 0xA7, 0x5A,
-    0xC7, 0x9C, 0xFE, 0x78, 0x84, 0x39, 0xAD, 0xB9, 0x30, 0xA7, 0xC3, 0xF0, 0x1F, 0x3A, 0xF5, 0x46,
-    0x19, 0x5B, 0x12, 0xBF, 0x68, 0x67, 0x52, 0x7E, 0xD5, 0x4E, 0x72, 0xAE, 0xB9, 0x31, 0x83, 0x2D,
-    0x26, 0x53, 0xF5, 0xD8, 0x51, 0xF4, 0x72, 0x99, 0x7A, 0x8E, 0x03, 0x4A, 0x6C, 0xF6, 0x7F, 0x8B,
-    0x76, 0x8A, 0x5F, 0xE9, 0xFC, 0x6C, 0xC9, 0x41, 0xF4, 0x3C, 0xC8, 0xC5, 0xF9, 0xFC, 0x3F, 0x81,
-    0xF5, 0x01, 0xAB, 0x43, 0x1B, 0x9F, 0xF4, 0xA9, 0xB0, 0x29, 0xF2, 0xF4, 0xA5, 0xE4, 0x80, 0x9E,
-    0x29, 0x95, 0x26, 0x39, 0x78, 0xA3, 0xE6, 0x89, 0x55, 0x73, 0x3E, 0x48, 0xB5, 0x2A, 0x82, 0xF8,
-    0xAE, 0x8E, 0x45, 0x32, 0xB5, 0xD6, 0x07, 0xF6, 0xB0, 0xA3, 0x3F, 0xE9, 0x61, 0x43, 0x29, 0x35,
-    0xCF, 0x48, 0x67, 0x46, 0xC9, 0xC2, 0x88, 0x1D, 0xB7, 0x40, 0xBF, 0x32, 0x0A, 0xC5, 0x08, 0x7D,
-    0x96, 0xC0, 0x0A, 0xAF, 0x86, 0xB4, 0x8B, 0x58, 0xE9, 0x14, 0x49, 0x66, 0xC5, 0x58, 0x3C, 0x43,
-    0x7A, 0xB9, 0x40, 0xE7, 0x21, 0x8B, 0x98, 0x1E, 0xF1, 0xD5, 0x58, 0x63, 0xCE, 0x01, 0x5E, 0x01,
-    0x4D, 0x8F, 0xD1, 0x0D, 0xC3, 0x20, 0x0C, 0x44, 0x51, 0x19, 0xC0, 0x03, 0xF4, 0x83, 0x11, 0x18,
-    0xC1, 0x8C, 0xD0, 0x8D, 0x32, 0x59, 0x05, 0x23, 0x30, 0x42, 0x46, 0xE0, 0x83, 0x4A, 0xE9, 0x07,
-    0xBD, 0x1E, 0x46, 0x89, 0xE2, 0x9F, 0xB3, 0xEC, 0x67, 0xDD, 0xD9, 0xB9, 0xAB, 0x7C, 0x5A, 0x2A,
-    0x75, 0xA9, 0xF6, 0xA5, 0x18, 0x6B, 0x0D, 0x18, 0x20, 0x80, 0x01, 0xFA, 0x7A, 0x1A, 0x70, 0x38,
-    0xF7, 0x9E, 0xEB, 0x26, 0x45, 0x09, 0x48, 0x93, 0x3D, 0x10, 0xD0, 0x23, 0x34, 0x21, 0x00, 0x60,
-    0x97, 0x31, 0xAF, 0x51, 0x05, 0x89, 0xD7, 0x28, 0x11, 0x55, 0xA9, 0x69, 0x43, 0xA7, 0x8E, 0x07,
-    0xD0, 0x39, 0x6F, 0x81, 0x08, 0xB9, 0xB6, 0x4D, 0x27, 0xCE, 0xF2, 0x74, 0x56, 0xFC, 0xD8, 0x9A,
-    0xAD, 0x19, 0x7B, 0x7C, 0xB3, 0x05, 0x41, 0x8D, 0x16, 0x4C, 0x4B, 0xEC, 0x2B, 0x76, 0xB4, 0x5C,
-    0xFE, 0x93, 0xD3, 0x3D, 0xF7, 0xF5, 0xC7, 0xF9, 0xD7, 0xF9, 0xA7, 0xD5, 0x1F,
+static const uint8_t notoserif_16_regularBitmaps[38378] = {
+    0xCD, 0x5A, 0x3F, 0xAC, 0xDD, 0xD4, 0x19, 0xFF, 0x6C, 0x27, 0x71, 0x55, 0x57, 0x38, 0x43, 0xA9,
+    0xAA, 0x3E, 0xE5, 0x79, 0x61, 0x40, 0x88, 0xE0, 0x0E, 0x0C, 0x19, 0x6E, 0x72, 0xDC, 0xAE, 0x0C,
+    0x7D, 0x03, 0xAF, 0xAD, 0x54, 0x55, 0xD9, 0x8B, 0xAA, 0xDB, 0x21, 0x43, 0xD4, 0x92, 0x67, 0xD3,
+    0x0E, 0xAC, 0x19, 0xCA, 0xD4, 0x85, 0x81, 0x4A, 0xF0, 0xA8, 0x94, 0x0C, 0x19, 0x22, 0x91, 0xF7,
+    0x6C, 0xE8, 0xC0, 0xD0, 0x01, 0x17, 0xA4, 0x32, 0x74, 0xC0, 0x88, 0x14, 0x5A, 0x50, 0x85, 0xDB,
+    0x1A, 0xE1, 0x97, 0xD8, 0x3E, 0xFD, 0xFD, 0xBE, 0x73, 0xEF, 0x7B, 0x37, 0xF0, 0x80, 0x24, 0x84,
+    0xAA, 0xF7, 0xF9, 0x7C, 0x76, 0xEC, 0xE3, 0x73, 0xBE, 0xFF, 0xDF, 0xEF, 0x1C, 0x27, 0xCF, 0x72,
+    0xFC, 0x99, 0xCC, 0xC8, 0xEA, 0x5F, 0x2A, 0x8F, 0xE8, 0xDF, 0xBA, 0x9C, 0x90, 0x23, 0x22, 0x68,
+    0x26, 0x2B, 0x8B, 0xB2, 0x30, 0xE2, 0x7E, 0x5E, 0x2D, 0x71, 0x25, 0x67, 0x44, 0x06, 0x09, 0x5A,
+    0x09, 0x1B, 0x89, 0xF5, 0x46, 0x52, 0x49, 0x5A, 0x88, 0xC1, 0x91, 0x1D, 0x76, 0x14, 0x7C, 0x8A,
+    0x3E, 0xE8, 0x89, 0xFE, 0x61, 0x2B, 0x41, 0xC7, 0x11, 0x30, 0x9F, 0x44, 0x15, 0xC7, 0xD4, 0x5F,
+    0x23, 0x72, 0x41, 0x24, 0x29, 0x38, 0xAC, 0xEF, 0x3A, 0x8C, 0x22, 0xBB, 0x22, 0xB9, 0xF6, 0xDC,
+    0x1F, 0xEB, 0x96, 0xC3, 0xDD, 0xD4, 0x3E, 0xBB, 0xDA, 0x7F, 0xE0, 0xBB, 0x18, 0x01, 0xE3, 0xEC,
+    0xE8, 0x98, 0x4E, 0x8A, 0xC2, 0xD4, 0xA6, 0x8E, 0xEB, 0xA0, 0x0A, 0xAA, 0x08, 0xD3, 0xF0, 0xFE,
+    0xFD, 0x9B, 0x99, 0xB1, 0x0D, 0x0E, 0xED, 0x51, 0x8A, 0xC5, 0x5F, 0x2E, 0xCB, 0x5F, 0x32, 0x81,
+    0xD8, 0xB2, 0x02, 0xAF, 0x2A, 0xA9, 0xD7, 0x93, 0xFD, 0x81, 0x62, 0xEC, 0x52, 0x9C, 0x9C, 0xD3,
+    0xE7, 0x6E, 0x76, 0xE5, 0xE2, 0x73, 0x89, 0xEB, 0xAC, 0xAF, 0xE9, 0x00, 0x3A, 0x54, 0xD4, 0x78,
+    0x83, 0x1B, 0x5E, 0xA6, 0x39, 0x94, 0x90, 0x5A, 0x4E, 0xBC, 0x81, 0xE6, 0xE3, 0x56, 0x8C, 0x96,
+    0x63, 0xE6, 0x8F, 0x5B, 0x31, 0xAF, 0xA2, 0x41, 0x6D, 0xF2, 0x65, 0x5A, 0xD4, 0xC9, 0xD1, 0xF9,
+    0xB4, 0x91, 0x58, 0xDB, 0x71, 0x1A, 0x1F, 0xA7, 0xE4, 0x86, 0x05, 0x7F, 0x69, 0x05, 0x7E, 0xEA,
+    0x1D, 0x89, 0x9B, 0x0B, 0x60, 0xE9, 0x08, 0x9A, 0xD0, 0x4C, 0xE4, 0x51, 0x92, 0x4C, 0x75, 0x2F,
+    0xD7, 0x60, 0x7A, 0xBC, 0x16, 0xF0, 0x51, 0x21, 0x70, 0x10, 0x77, 0x8B, 0x43, 0x57, 0xF2, 0x40,
+    0x2C, 0x72, 0xEE, 0xB4, 0x48, 0x37, 0x6D, 0xBF, 0xD8, 0x59, 0x8C, 0x6F, 0xF7, 0xE7, 0xE8, 0x39,
+    0x47, 0x66, 0x8A, 0xA4, 0xCE, 0x21, 0xD0, 0x16, 0x18, 0x39, 0x8D, 0x76, 0xC4, 0x31, 0xD4, 0xB8,
+    0x39, 0x30, 0xFE, 0xB1, 0x5E, 0xA4, 0xBC, 0x2E, 0xF2, 0x84, 0xC5, 0x7C, 0x69, 0xA3, 0xCC, 0x4A,
+    0x80, 0x9B, 0xFE, 0xC0, 0x76, 0x1C, 0xED, 0x0A, 0xFE, 0xDD, 0xE3, 0xBD, 0x1D, 0x49, 0x6A, 0xF3,
+    0xAE, 0xCD, 0x22, 0x8C, 0x2D, 0xF7, 0x73, 0x96, 0x90, 0x06, 0xA4, 0xB6, 0xC4, 0x90, 0xFC, 0x8A,
+    0xE4, 0x3F, 0x20, 0xFE, 0xAB, 0x64, 0xEF, 0x69, 0xAA, 0x92, 0xD3, 0x9D, 0x24, 0x39, 0x4F, 0xD2,
+    0x82, 0xF8, 0x35, 0x48, 0x58, 0x81, 0xC4, 0x64, 0xE6, 0x11, 0x92, 0xD3, 0x9B, 0x3F, 0xF9, 0x68,
+    0xA3, 0x04, 0xF3, 0xED, 0x26, 0xAF, 0x9C, 0xDA, 0x56, 0x48, 0x04, 0xE2, 0xCD, 0xA7, 0x4C, 0x02,
+    0x6B, 0xAB, 0xC8, 0xDA, 0x3A, 0xB6, 0xB6, 0xD1, 0x06, 0x47, 0xBB, 0xCF, 0x35, 0x61, 0x3B, 0xB1,
+    0x68, 0x27, 0x8F, 0xD2, 0xA8, 0xBD, 0xA4, 0xDB, 0x16, 0x4A, 0x4B, 0x6B, 0x37, 0x44, 0xB0, 0x90,
+    0xED, 0xA0, 0x3D, 0x8A, 0x7B, 0xD7, 0xF0, 0x0C, 0x8E, 0x55, 0x99, 0xF7, 0x57, 0x65, 0xE3, 0xAC,
+    0x78, 0x37, 0xFF, 0x5D, 0xE7, 0x0D, 0xDE, 0x00, 0x4F, 0x19, 0xA2, 0x5A, 0xAE, 0xAA, 0x65, 0xD0,
+    0xE0, 0x4F, 0xF4, 0x3D, 0x31, 0xDF, 0x7B, 0x5C, 0xCC, 0xDC, 0x16, 0x66, 0xEF, 0x6C, 0x6B, 0x2A,
+    0x7F, 0xC0, 0xBD, 0x11, 0x6D, 0x42, 0xDB, 0x65, 0x43, 0xBF, 0x5D, 0xF4, 0x9F, 0xF0, 0xDE, 0x48,
+    0xA7, 0x83, 0xCF, 0x75, 0x32, 0x5D, 0xAA, 0xC1, 0x5C, 0x46, 0x87, 0xCB, 0xAD, 0x1D, 0x4B, 0xD7,
+    0xA0, 0x67, 0xE9, 0x2F, 0xC3, 0x01, 0x2F, 0x33, 0xC0, 0x25, 0xAC, 0x35, 0x44, 0x6F, 0xF1, 0x05,
+    0x44, 0x3F, 0x43, 0x8B, 0xF1, 0x29, 0xBD, 0xF3, 0x55, 0xED, 0xDA, 0x7C, 0x76, 0x57, 0xFD, 0xCD,
+    0x11, 0x51, 0x3E, 0x1D, 0x3D, 0x6A, 0xD0, 0x3F, 0xA9, 0x10, 0x51, 0x60, 0x6C, 0x90, 0x34, 0x23,
+    0x29, 0x5C, 0x6C, 0x21, 0xCA, 0x1A, 0x8C, 0x18, 0x8E, 0x90, 0xD3, 0xB3, 0x08, 0x69, 0xC9, 0x47,
+    0x12, 0x28, 0x21, 0x68, 0x11, 0x0E, 0x71, 0x15, 0x0E, 0x94, 0x79, 0x62, 0xA8, 0xE6, 0x2E, 0x35,
+    0x1C, 0x10, 0xC3, 0x14, 0x82, 0x91, 0x11, 0x5B, 0x1F, 0xAD, 0xB5, 0xE2, 0x95, 0x94, 0xCF, 0xCB,
+    0x16, 0x0C, 0xE4, 0xBD, 0x04, 0x13, 0xB4, 0xDB, 0x24, 0x75, 0x02, 0xCB, 0x9B, 0x2C, 0xE8, 0x8C,
+    0x78, 0x03, 0xDE, 0x5C, 0xB6, 0x91, 0x8D, 0xDA, 0x4B, 0xAB, 0x60, 0x8C, 0xBB, 0x64, 0x0C, 0xEC,
+    0x30, 0xCA, 0xFC, 0xE2, 0xE8, 0xC4, 0xF5, 0xE8, 0x8D, 0xFD, 0xC2, 0x82, 0xED, 0x37, 0x24, 0xAA,
+    0xD7, 0xC1, 0x78, 0xFC, 0xEE, 0x24, 0x21, 0x1D, 0x5E, 0x2D, 0x96, 0x66, 0xA6, 0xCA, 0x2B, 0x53,
+    0x1C, 0x95, 0x4F, 0xFE, 0x98, 0x85, 0xF0, 0xA4, 0x32, 0xCA, 0x4F, 0x54, 0xC7, 0x6D, 0xD2, 0xC6,
+    0xCD, 0x3E, 0x77, 0xFB, 0x3F, 0x0F, 0x1E, 0x9E, 0xE2, 0x59, 0xD8, 0x7A, 0xAD, 0x87, 0x8C, 0x95,
+    0xCA, 0xB9, 0xC5, 0x93, 0x10, 0xB9, 0xCA, 0xBC, 0x3F, 0x21, 0x57, 0xA5, 0xD9, 0x08, 0x55, 0x5C,
+    0x43, 0x9C, 0x3E, 0x78, 0x10, 0xAF, 0xB5, 0xF3, 0x0A, 0xA4, 0x1A, 0xA8, 0x47, 0x42, 0x30, 0x6A,
+    0x70, 0x0B, 0x81, 0x29, 0xB3, 0x95, 0x76, 0x64, 0x65, 0xAA, 0x92, 0x39, 0x6E, 0xD1, 0x76, 0x97,
+    0x37, 0x43, 0xCD, 0xC7, 0xB1, 0xA6, 0xCE, 0xA4, 0x55, 0x99, 0x34, 0x9A, 0x4F, 0xF7, 0xA4, 0xE7,
+    0x69, 0x76, 0xE9, 0xA8, 0x11, 0x69, 0xF9, 0xBE, 0xDF, 0xD0, 0xD2, 0x41, 0xC5, 0x69, 0xC3, 0x8A,
+    0x0C, 0x44, 0x99, 0xB2, 0xA3, 0x43, 0xAC, 0x6B, 0xE8, 0x18, 0x24, 0x06, 0x50, 0xB8, 0x97, 0xC8,
+    0x55, 0x55, 0x63, 0xCB, 0x64, 0xCD, 0xFC, 0x51, 0x22, 0x14, 0x69, 0xC9, 0x40, 0x39, 0x87, 0xD5,
+    0xC5, 0x54, 0xF3, 0x3D, 0x39, 0xCA, 0x2C, 0x02, 0xDF, 0x9F, 0x4A, 0x3B, 0x5D, 0x94, 0x39, 0x9C,
+    0x53, 0x82, 0x41, 0xF2, 0xC2, 0xA7, 0x97, 0x80, 0xC0, 0x4B, 0x96, 0xA4, 0xDD, 0xBF, 0xAA, 0x41,
+    0x4C, 0xE1, 0x8F, 0x3F, 0x9C, 0x90, 0x7A, 0x60, 0x11, 0x7F, 0xDC, 0x2C, 0xB3, 0xE5, 0x83, 0x90,
+    0xFD, 0x82, 0x8E, 0xA4, 0x27, 0x19, 0xF6, 0xAF, 0x7A, 0x7D, 0x8A, 0xE1, 0x93, 0xE6, 0xEC, 0xF4,
+    0xA2, 0xCD, 0x10, 0x06, 0xD7, 0x97, 0xB6, 0xB0, 0xD0, 0x64, 0x72, 0xA3, 0xAC, 0xA5, 0xCC, 0x62,
+    0x37, 0x00, 0x7C, 0x37, 0x80, 0xDD, 0xC0, 0x36, 0xA5, 0x44, 0xC4, 0x32, 0xF1, 0x28, 0x29, 0x3E,
+    0x97, 0x54, 0xCB, 0xCE, 0x49, 0xBD, 0xCC, 0x57, 0x21, 0x94, 0x72, 0x1C, 0xF3, 0xCA, 0x65, 0xB1,
+    0x05, 0xF4, 0x04, 0x05, 0xA1, 0x3C, 0x72, 0x4A, 0x39, 0x9A, 0x09, 0xD8, 0xB8, 0x28, 0x14, 0x1D,
+    0x4E, 0x8C, 0x4E, 0xF3, 0x86, 0xD9, 0x10, 0x56, 0x05, 0xF5, 0x46, 0xCD, 0x8C, 0xA5, 0xD2, 0x9C,
+    0x22, 0x0A, 0xE3, 0x9E, 0x13, 0x1C, 0xD0, 0xA4, 0x3E, 0x9C, 0xAE, 0xF6, 0x71, 0x6F, 0x99, 0x6C,
+    0x7F, 0x34, 0x6F, 0x12, 0x55, 0x0E, 0x8F, 0xB4, 0x15, 0xEA, 0xA3, 0x10, 0xA7, 0x10, 0x66, 0xC6,
+    0x8A, 0xEC, 0x54, 0x78, 0x16, 0xF1, 0xC5, 0x80, 0xC4, 0xDF, 0x27, 0x2E, 0x5D, 0xAF, 0x92, 0x71,
+    0x73, 0x83, 0x96, 0x18, 0x78, 0xF5, 0xB8, 0x1C, 0xDA, 0x65, 0x49, 0xCE, 0x91, 0x5C, 0x21, 0xE9,
+    0x30, 0xBC, 0xDF, 0x9E, 0x9D, 0xB6, 0x2F, 0xB5, 0x9A, 0x8C, 0xEF, 0x62, 0x5E, 0x25, 0xD3, 0xF6,
+    0x73, 0x8B, 0xC9, 0x3F, 0x6F, 0xDE, 0x15, 0x42, 0x4B, 0xC8, 0x59, 0xFB, 0x5B, 0x8A, 0xDA, 0xAF,
+    0x04, 0x09, 0xCD, 0x10, 0x4F, 0x97, 0x9C, 0xAA, 0x27, 0x75, 0x5F, 0xAB, 0x39, 0x60, 0x4B, 0xF3,
+    0xF9, 0x29, 0x8D, 0x3C, 0x17, 0x7B, 0x0B, 0x13, 0x3B, 0x93, 0x1F, 0x4E, 0x53, 0xDB, 0x82, 0x86,
+    0xB6, 0xA6, 0x47, 0x58, 0xED, 0x5F, 0xEA, 0x08, 0xBB, 0x1A, 0x30, 0xBB, 0xEA, 0x15, 0xBB, 0xCA,
+    0x11, 0x42, 0xB2, 0x2C, 0x48, 0x93, 0xE9, 0x45, 0x26, 0x4F, 0xE7, 0x97, 0xDE, 0x06, 0x79, 0x6A,
+    0x43, 0xC4, 0xC7, 0xDC, 0x3E, 0x7B, 0x0C, 0xEE, 0x42, 0xC6, 0x51, 0x5D, 0xD4, 0xC4, 0xD5, 0x9D,
+    0x9C, 0xC6, 0xCD, 0xCD, 0x79, 0xC5, 0x71, 0xA1, 0xDC, 0xFD, 0x7F, 0xDD, 0xF1, 0x28, 0xEE, 0xA4,
+    0x4C, 0x54, 0xD0, 0xDF, 0x45, 0xAF, 0xDC, 0x23, 0x83, 0xA8, 0x90, 0x3C, 0x81, 0xC7, 0x40, 0x6D,
+    0x70, 0x17, 0x07, 0x5E, 0xC4, 0x78, 0x6E, 0xAC, 0x63, 0xF6, 0x06, 0x83, 0x28, 0xFD, 0xF2, 0x87,
+    0xC2, 0x51, 0x64, 0x61, 0x26, 0x7B, 0xE6, 0xB6, 0x9C, 0x1E, 0xDE, 0xC6, 0x74, 0xB2, 0x67, 0x51,
+    0x6D, 0xF7, 0xB9, 0x45, 0xA4, 0x33, 0xE2, 0x54, 0xC2, 0x44, 0x7D, 0x64, 0xA6, 0xB4, 0x23, 0x0D,
+    0x6A, 0x52, 0x82, 0x21, 0x7F, 0x48, 0xD5, 0x83, 0x80, 0x15, 0xA1, 0x43, 0xC2, 0x49, 0xDF, 0xBE,
+    0xC6, 0x3E, 0x36, 0x50, 0xF4, 0xE2, 0x59, 0x7D, 0x0B, 0x71, 0xC4, 0xF4, 0xA4, 0x66, 0x4A, 0x74,
+    0xE4, 0x48, 0x63, 0x39, 0xD0, 0xCC, 0xE6, 0xD9, 0x0C, 0x92, 0x4A, 0x7E, 0x1D, 0x9C, 0xE0, 0x01,
+    0x29, 0xAD, 0xBB, 0x70, 0x4A, 0xFF, 0x9E, 0x91, 0x83, 0x30, 0x53, 0xD2, 0x7E, 0x2A, 0xD6, 0xE8,
+    0xC8, 0xD4, 0x04, 0x2B, 0xF8, 0x54, 0x04, 0x04, 0x2E, 0x80, 0x55, 0xFE, 0x87, 0x10, 0xEE, 0x25,
+    0x9C, 0xDF, 0x82, 0xD8, 0x40, 0xA4, 0xFE, 0x5F, 0x51, 0x5D, 0xDF, 0xC3, 0xF9, 0x0D, 0xB4, 0x37,
+    0x79, 0x46, 0x6D, 0x05, 0xDE, 0xF2, 0xFF, 0x3C, 0x28, 0xE4, 0xF2, 0x6B, 0x88, 0xA7, 0x30, 0x6B,
+    0x57, 0xD1, 0x97, 0x0F, 0xFC, 0x77, 0x42, 0xCF, 0x26, 0x9B, 0xE9, 0x39, 0x2D, 0xDC, 0x39, 0xA9,
+    0xAE, 0xE8, 0x39, 0xAE, 0x1D, 0x2C, 0x8B, 0xDA, 0x46, 0xCF, 0xC1, 0xBF, 0x6B, 0x77, 0xBE, 0x59,
+    0xE9, 0xD9, 0xD3, 0x0C, 0x89, 0x5A, 0x61, 0x33, 0x2E, 0x20, 0x1A, 0x04, 0x0D, 0x82, 0xEF, 0xEC,
+    0x1E, 0x82, 0x10, 0x90, 0x0C, 0x7C, 0xCF, 0x04, 0x4E, 0x5C, 0x22, 0xE9, 0xDB, 0x71, 0x0E, 0xA1,
+    0xCA, 0xBD, 0xC0, 0x12, 0xAC, 0xFA, 0x90, 0x24, 0xCA, 0x7C, 0xF8, 0x37, 0xE8, 0x87, 0x2D, 0xE9,
+    0x9B, 0x1D, 0xE9, 0x1B, 0x03, 0x69, 0x3D, 0x29, 0xCD, 0x33, 0x52, 0x53, 0x91, 0xC6, 0x0D, 0x69,
+    0xD4, 0x91, 0x06, 0x03, 0xA9, 0x4C, 0x4A, 0xCB, 0xC7, 0x48, 0xCD, 0x9F, 0x48, 0x93, 0x0F, 0x48,
+    0x23, 0x4B, 0x1A, 0x28, 0x85, 0x05, 0x09, 0x8F, 0xCB, 0xEC, 0xEC, 0x1E, 0x51, 0x7F, 0x09, 0xCD,
+    0x25, 0xCB, 0xDA, 0x0E, 0x9E, 0x98, 0x1A, 0x58, 0x47, 0x10, 0xF2, 0x08, 0x70, 0xE2, 0xBE, 0x51,
+    0x4B, 0x63, 0xAE, 0x51, 0x0F, 0x84, 0x4C, 0x3C, 0x57, 0x31, 0x1B, 0x24, 0x9A, 0x19, 0xE2, 0x9A,
+    0x19, 0x23, 0x6E, 0x94, 0xB6, 0x9F, 0x41, 0x1B, 0xED, 0xD9, 0xB8, 0xB7, 0x12, 0x45, 0x85, 0x6E,
+    0x34, 0xE6, 0x25, 0xB3, 0x98, 0x05, 0x60, 0x80, 0x17, 0xE6, 0x1F, 0x9C, 0xDD, 0x55, 0x17, 0x96,
+    0x17, 0x59, 0x56, 0x56, 0x0D, 0x33, 0xAD, 0x93, 0x5A, 0x13, 0xB4, 0x58, 0xAE, 0x54, 0xD6, 0xF6,
+    0x96, 0x6A, 0xAB, 0xC5, 0x17, 0x35, 0x76, 0xF0, 0x96, 0x35, 0x76, 0xDA, 0xCE, 0xEE, 0x2A, 0xAF,
+    0x7E, 0x5A, 0x27, 0xC3, 0x57, 0xA3, 0x93, 0x74, 0x45, 0x27, 0xF9, 0x61, 0x3A, 0x39, 0xE6, 0x74,
+    0xE2, 0x10, 0x8F, 0x16, 0x66, 0xCD, 0xEB, 0xAE, 0x3E, 0x2F, 0xD8, 0x07, 0x8F, 0x6A, 0xCC, 0x54,
+    0xFF, 0xE1, 0x3D, 0x4F, 0xED, 0x65, 0xE2, 0x80, 0x89, 0xD3, 0x9F, 0xC6, 0xB5, 0xE6, 0x8A, 0xB8,
+    0x59, 0xA1, 0xED, 0xA7, 0xEE, 0x68, 0x1F, 0xC3, 0xFE, 0x28, 0xE3, 0x54, 0x22, 0x33, 0x09, 0xD1,
+    0x38, 0xF3, 0x49, 0xAB, 0xB9, 0x45, 0x57, 0x3E, 0xFE, 0xE8, 0xF2, 0x86, 0xD2, 0xDC, 0x65, 0x8F,
+    0x6A, 0x31, 0x66, 0xA0, 0xD9, 0x03, 0x19, 0x23, 0x20, 0x5C, 0x69, 0xA5, 0xAC, 0x96, 0x10, 0x3B,
+    0xC0, 0x48, 0x31, 0x42, 0x27, 0xCD, 0x7C, 0xA2, 0x5B, 0x34, 0xB9, 0x68, 0x16, 0xF5, 0x87, 0x2B,
+    0x90, 0xB8, 0xA7, 0x13, 0x14, 0x70, 0xD7, 0x9E, 0x8B, 0x13, 0x5E, 0x40, 0xEE, 0xA4, 0x5F, 0xC8,
+    0x39, 0x7E, 0x0D, 0x0D, 0x69, 0x6E, 0xE7, 0xC2, 0x02, 0x15, 0x9B, 0x22, 0x68, 0x93, 0xBF, 0xCD,
+    0x6B, 0x9F, 0x4A, 0x82, 0xDB, 0x00, 0xA3, 0xD8, 0x91, 0x64, 0x3A, 0x83, 0x10, 0x3C, 0xF3, 0x24,
+    0xC8, 0xFA, 0x79, 0x90, 0xFB, 0xCE, 0xB1, 0x8C, 0x39, 0x48, 0x79, 0x0F, 0xC9, 0xB7, 0x58, 0xF2,
+    0x0C, 0x94, 0xAC, 0x4B, 0xAE, 0xAE, 0x9C, 0x8A, 0x63, 0xF6, 0x7A, 0xD4, 0xAB, 0x77, 0x77, 0x5C,
+    0x88, 0x52, 0x57, 0x33, 0xAD, 0xC9, 0x4F, 0xAA, 0x61, 0xAF, 0x2A, 0xF8, 0x55, 0x53, 0x13, 0x5E,
+    0x1A, 0x86, 0x26, 0xF2, 0x7D, 0xA0, 0xC1, 0x11, 0xAA, 0x13, 0x45, 0x19, 0x17, 0x9F, 0xB1, 0x2E,
+    0xEB, 0xD6, 0x69, 0xE0, 0xEE, 0x24, 0xFD, 0xB1, 0x27, 0x3A, 0xF6, 0x86, 0xF3, 0x9C, 0x7A, 0xBC,
+    0x42, 0xBA, 0xAB, 0x5E, 0x60, 0xD4, 0x2F, 0x4C, 0x7D, 0x50, 0xDD, 0x99, 0xF5, 0x4B, 0x98, 0xED,
+    0x41, 0xE2, 0xFE, 0x39, 0xD2, 0xF6, 0x2E, 0x7C, 0xE8, 0x7A, 0xA8, 0xB8, 0x60, 0x11, 0x76, 0x96,
+    0xBC, 0xF9, 0x9A, 0xD7, 0x81, 0xC0, 0x89, 0xD7, 0xA0, 0xEA, 0x99, 0xFA, 0xDD, 0x5B, 0x15, 0x59,
+    0x2D, 0x25, 0x78, 0xAD, 0x92, 0x2B, 0xE4, 0x33, 0x7C, 0xAC, 0x11, 0x65, 0x95, 0x19, 0x93, 0x17,
+    0x45, 0x1C, 0xB4, 0x7E, 0xC3, 0xD9, 0xD6, 0x81, 0x37, 0x15, 0xDA, 0x9F, 0xF4, 0xFB, 0x40, 0xFD,
+    0x7A, 0xE6, 0x0D, 0x94, 0x22, 0x6A, 0x67, 0x58, 0xCB, 0x65, 0x14, 0xE1, 0xBC, 0xEC, 0xC6, 0x2A,
+    0xC5, 0x15, 0xC9, 0x63, 0x15, 0x04, 0x48, 0x72, 0x5D, 0x65, 0xC1, 0xC5, 0xCF, 0x55, 0x1C, 0x2C,
+    0xF5, 0xAE, 0xA9, 0x13, 0x57, 0x12, 0xAB, 0x07, 0xC3, 0x61, 0xE2, 0x7E, 0x81, 0x48, 0x9C, 0xB3,
+    0xC3, 0x23, 0x15, 0xAA, 0xDB, 0x26, 0xB1, 0x45, 0x6A, 0x6B, 0x54, 0x42, 0xDF, 0xEA, 0x72, 0x07,
+    0x14, 0xCC, 0xE4, 0xAA, 0x43, 0x04, 0x53, 0x46, 0x36, 0x1E, 0xD1, 0xF0, 0x98, 0x69, 0x78, 0xE8,
+    0xEB, 0xBA, 0x8D, 0xB2, 0xF0, 0x43, 0xE3, 0x90, 0x90, 0x6A, 0x2C, 0xD7, 0xA7, 0x1F, 0x73, 0x2E,
+    0xFF, 0x75, 0x46, 0x7C, 0x58, 0xB0, 0xC6, 0xC4, 0xF4, 0x68, 0x68, 0x86, 0x0A, 0xBD, 0xAA, 0x41,
+    0xD7, 0x6A, 0x0E, 0x68, 0x59, 0x0F, 0x81, 0xFF, 0x13, 0x96, 0x7D, 0x2C, 0xFB, 0x1A, 0xC3, 0xCA,
+    0xDC, 0xA4, 0xF6, 0xD9, 0xAF, 0xDB, 0x06, 0x8F, 0x68, 0xD6, 0x51, 0x9C, 0x02, 0x69, 0x6B, 0x70,
+    0xDD, 0x2A, 0x98, 0xA5, 0x96, 0x1A, 0x72, 0x18, 0xB6, 0x54, 0x4B, 0xD0, 0x27, 0xAA, 0x81, 0x99,
+    0xDA, 0x51, 0x6D, 0x6A, 0xDA, 0x03, 0xAE, 0xE2, 0xEA, 0x76, 0xA9, 0xA2, 0xF5, 0xA3, 0xE5, 0x1E,
+    0x7D, 0xC6, 0xC2, 0x86, 0x74, 0xFD, 0x42, 0xC9, 0x19, 0xF2, 0x30, 0x23, 0x62, 0x9E, 0x31, 0x76,
+    0x4E, 0xB9, 0x74, 0xA1, 0xF9, 0x43, 0xDD, 0x84, 0x02, 0xEA, 0xCA, 0x8A, 0x0C, 0xBB, 0xE8, 0x52,
+    0x4D, 0x27, 0xCD, 0x52, 0x45, 0x79, 0xB6, 0xE8, 0xA1, 0x69, 0x12, 0xD0, 0xDE, 0xAB, 0x63, 0xAD,
+    0x89, 0xA8, 0x29, 0x4C, 0x78, 0x61, 0x55, 0xBE, 0xBF, 0x5D, 0x56, 0x0E, 0x9E, 0x69, 0xDE, 0x29,
+    0xB9, 0xB0, 0xDB, 0xA3, 0xF1, 0x6A, 0x2C, 0xFB, 0xE2, 0x8A, 0x5B, 0x53, 0x24, 0x6E, 0x09, 0xAE,
+    0xC4, 0xFB, 0x11, 0x4A, 0x33, 0x4A, 0xB9, 0xC4, 0x5C, 0xAA, 0xC0, 0xF3, 0x5B, 0xBA, 0x64, 0xCB,
+    0xD4, 0x47, 0xC2, 0x65, 0x06, 0x99, 0x34, 0xC5, 0x43, 0x1D, 0xB4, 0xFC, 0x2F, 0x64, 0x5C, 0xFB,
+    0x14, 0x9C, 0xF4, 0x9B, 0xDC, 0x11, 0xDB, 0x70, 0xAB, 0x64, 0xB7, 0x78, 0x54, 0xDB, 0x8B, 0x77,
+    0x28, 0x49, 0xC1, 0x6B, 0x8F, 0x85, 0x89, 0x77, 0x13, 0xE9, 0x19, 0x00, 0x27, 0x6A, 0x20, 0x64,
+    0xD0, 0xEA, 0x7E, 0xD6, 0x92, 0xF8, 0x3D, 0x3A, 0x2F, 0xC9, 0xE0, 0xC8, 0xF2, 0xA9, 0x76, 0xC6,
+    0x6B, 0xAD, 0x7F, 0xB3, 0x48, 0xEB, 0xB5, 0x8F, 0xA0, 0xCE, 0xBC, 0xD5, 0x95, 0xFE, 0x72, 0x3D,
+    0x9C, 0x4F, 0xBA, 0x59, 0x10, 0x35, 0x51, 0x4B, 0x31, 0x21, 0x47, 0x63, 0x32, 0x4F, 0x77, 0x15,
+    0x0E, 0x6D, 0x99, 0xD3, 0x3A, 0x80, 0xF4, 0x77, 0xA3, 0xCE, 0x6B, 0x91, 0x56, 0x1B, 0xB8, 0x4F,
+    0xA6, 0x68, 0x59, 0x8E, 0x6E, 0x2A, 0xAC, 0xD1, 0x05, 0x9D, 0x0E, 0x7E, 0x38, 0x29, 0x7B, 0xC3,
+    0xBD, 0x1D, 0x23, 0x51, 0x17, 0x22, 0x99, 0x51, 0x30, 0x20, 0x45, 0xEE, 0x91, 0xC1, 0xD2, 0xBA,
+    0xC9, 0xF8, 0xD9, 0x84, 0x5D, 0xB4, 0x73, 0xC2, 0xD7, 0xE2, 0x16, 0x03, 0x04, 0x76, 0x32, 0xD7,
+    0x39, 0xE8, 0xB0, 0xB2, 0x07, 0x41, 0xB1, 0x4A, 0x40, 0x1A, 0x15, 0xAB, 0x4B, 0x0A, 0xEE, 0xD6,
+    0x78, 0x83, 0x61, 0xA6, 0xDD, 0xDE, 0x1E, 0xB8, 0x44, 0x36, 0x9B, 0x9B, 0x8F, 0xAF, 0x8A, 0x95,
+    0x38, 0xB1, 0x1E, 0x08, 0x3B, 0xAF, 0xBB, 0x55, 0x2C, 0x54, 0xDE, 0x08, 0x86, 0x36, 0x30, 0xD4,
+    0x96, 0xD7, 0xC9, 0x8E, 0x64, 0xBA, 0x29, 0xB3, 0x68, 0x18, 0x4B, 0x1E, 0xB2, 0xDB, 0xB2, 0x7A,
+    0xEF, 0xB6, 0x1B, 0x4C, 0xB1, 0x86, 0x8A, 0x6D, 0xAC, 0x66, 0x8B, 0x08, 0x90, 0x79, 0xCA, 0x81,
+    0x83, 0xE6, 0xEF, 0xD5, 0x41, 0x1B, 0x36, 0x59, 0xC8, 0x2D, 0x9C, 0xA8, 0xF6, 0x3B, 0x92, 0x7E,
+    0x71, 0xD5, 0xF8, 0x0C, 0x60, 0xA2, 0xE6, 0x9E, 0xEB, 0x78, 0xDD, 0x7C, 0xF9, 0xE5, 0x73, 0xD0,
+    0x79, 0xA3, 0x1B, 0x04, 0x24, 0xD7, 0xB5, 0xF0, 0x73, 0xB3, 0x04, 0xF5, 0x53, 0x17, 0x1E, 0x04,
+    0x49, 0x26, 0x3B, 0xC3, 0x8D, 0xDF, 0xD3, 0x90, 0x53, 0xAF, 0x32, 0x6E, 0xF7, 0x52, 0x9B, 0xD7,
+    0x24, 0xBA, 0x71, 0x89, 0xFB, 0x38, 0xA8, 0xB5, 0xEA, 0x9C, 0xCE, 0x3B, 0x9D, 0x7B, 0x3A, 0xFF,
+    0x74, 0x1E, 0x79, 0x28, 0x65, 0x5F, 0x6F, 0x0F, 0x53, 0x88, 0x77, 0xB3, 0xC8, 0x2B, 0x46, 0x2A,
+    0x62, 0xDA, 0x23, 0xC4, 0x21, 0x45, 0x00, 0x2D, 0x68, 0x7F, 0x67, 0x94, 0xD0, 0xBD, 0x85, 0x7A,
+    0xB2, 0x68, 0x8F, 0x19, 0x2A, 0xC2, 0x04, 0xC7, 0x75, 0xE3, 0x79, 0xD0, 0x3A, 0x74, 0xE5, 0x60,
+    0xE9, 0x08, 0xCB, 0xAF, 0xB9, 0x9B, 0xB7, 0x71, 0x20, 0x28, 0xD6, 0xEC, 0x45, 0xE4, 0x3B, 0x39,
+    0x82, 0x82, 0xC2, 0xDD, 0xE8, 0x07, 0xDD, 0x28, 0xF1, 0x14, 0x4D, 0xB8, 0xB3, 0xF5, 0x85, 0x7F,
+    0xBB, 0x70, 0x81, 0xC1, 0xEF, 0xD3, 0x66, 0x2B, 0xBB, 0xFD, 0x50, 0x0E, 0x6C, 0xE7, 0xF5, 0xBE,
+    0xE5, 0x06, 0x77, 0xCE, 0x7B, 0x8C, 0x6C, 0x9F, 0xA2, 0x72, 0x6B, 0x9E, 0x59, 0xD4, 0xEB, 0xB7,
+    0x54, 0x8F, 0x0C, 0x1E, 0xE4, 0x21, 0xCF, 0xAA, 0xFA, 0xA0, 0x01, 0xBC, 0x0B, 0xAE, 0x7B, 0xF0,
+    0x8D, 0xD7, 0x4A, 0x87, 0x4F, 0xA0, 0x95, 0xB8, 0x87, 0x52, 0xFC, 0x09, 0x1C, 0x94, 0xBD, 0xEE,
+    0x57, 0x70, 0xC4, 0xBB, 0x3A, 0x54, 0xA5, 0x6B, 0x76, 0x43, 0x57, 0x43, 0xEE, 0x97, 0x76, 0xE9,
+    0xE0, 0xA3, 0xF4, 0xAE, 0x21, 0xFB, 0xC4, 0x80, 0x30, 0xDE, 0x54, 0x99, 0x7F, 0xFA, 0x5A, 0x79,
+    0xE3, 0x8E, 0x95, 0x7F, 0x64, 0x72, 0x23, 0x70, 0xA1, 0xA5, 0x96, 0x67, 0xF3, 0xA5, 0xCF, 0x10,
+    0x32, 0x62, 0xE6, 0x84, 0x85, 0x60, 0x75, 0xC3, 0xB2, 0x04, 0xBB, 0x9B, 0x05, 0x9C, 0x35, 0x5D,
+    0xCA, 0x80, 0xE9, 0x59, 0x20, 0xC0, 0x51, 0xAA, 0x2B, 0x7B, 0xE2, 0xC9, 0x49, 0x6B, 0xEA, 0xB0,
+    0xA0, 0xC1, 0x9D, 0x53, 0xCD, 0x94, 0x9C, 0x15, 0xB5, 0x0F, 0x73, 0xEA, 0x7A, 0x4C, 0x91, 0x1E,
+    0x82, 0x0B, 0xA0, 0xB1, 0xE1, 0xB6, 0x96, 0x7E, 0x99, 0x18, 0x19, 0x2F, 0x5B, 0x8B, 0xEF, 0x11,
+    0x8B, 0xBD, 0x50, 0x93, 0x1D, 0x42, 0x5C, 0x17, 0xFD, 0x14, 0xA1, 0xAF, 0xE9, 0x57, 0x08, 0x7F,
+    0x3A, 0xDB, 0xBA, 0x5D, 0x56, 0x97, 0x59, 0x34, 0xD4, 0x3A, 0x64, 0xF9, 0x79, 0x87, 0x2C, 0xEF,
+    0x7F, 0xD9, 0x2C, 0x8F, 0xC5, 0x5B, 0x5A, 0x33, 0x14, 0x0B, 0x44, 0x25, 0xDD, 0x05, 0xF9, 0xF0,
+    0x30, 0x6F, 0xD4, 0x3A, 0xB8, 0xC6, 0xBC, 0x91, 0x3B, 0x3C, 0xA1, 0x98, 0xA2, 0x4F, 0x7A, 0x66,
+    0xE5, 0xEB, 0x58, 0x92, 0xDD, 0xA3, 0xAC, 0xEC, 0x52, 0x3D, 0xE0, 0x6C, 0xFE, 0x59, 0xD5, 0x60,
+    0x05, 0x7B, 0x6A, 0x06, 0xB4, 0xB5, 0xAD, 0xE7, 0x6F, 0xD8, 0x36, 0xFC, 0x20, 0x6C, 0x83, 0x11,
+    0x59, 0x6E, 0xF0, 0xB3, 0x60, 0x7F, 0x2B, 0xF8, 0xF3, 0x1B, 0x71, 0xC1, 0x7C, 0xDA, 0x10, 0xBB,
+    0x90, 0x89, 0x9F, 0x5E, 0xE2, 0xBF, 0x8C, 0x6A, 0xA3, 0x33, 0x80, 0x89, 0x5B, 0xF2, 0x6D, 0x97,
+    0xEC, 0xB9, 0x81, 0x3B, 0xBA, 0x6D, 0x5E, 0xC9, 0x07, 0x5E, 0x28, 0x48, 0x38, 0x82, 0xDC, 0x78,
+    0x0A, 0xA0, 0xF3, 0x49, 0x64, 0xC6, 0x0B, 0x7C, 0xEB, 0x19, 0x58, 0x8D, 0x7D, 0x58, 0xB3, 0xCF,
+    0x69, 0xC2, 0xE9, 0xF8, 0xD5, 0x2B, 0xB1, 0x88, 0xBC, 0x1E, 0x1C, 0x7D, 0xE1, 0x81, 0xCE, 0x1A,
+    0x33, 0x3F, 0xE6, 0x34, 0x5E, 0x66, 0x7A, 0x0F, 0x21, 0x05, 0x6B, 0x97, 0x0D, 0xA3, 0x35, 0xBE,
+    0xF3, 0x94, 0xB8, 0xA0, 0xCB, 0xA4, 0x4A, 0xD7, 0x1F, 0x14, 0xE8, 0x58, 0xFD, 0x1E, 0x63, 0xEC,
+    0x3B, 0x90, 0x2B, 0xB6, 0xBF, 0x71, 0xDF, 0x1B, 0xB4, 0x36, 0xD8, 0x21, 0x9F, 0xB2, 0x4B, 0x3D,
+    0xA2, 0x35, 0xE2, 0x0A, 0x3F, 0x2A, 0xC0, 0x57, 0xAC, 0xD3, 0xF3, 0xDD, 0x93, 0x8C, 0xE4, 0x19,
+    0xED, 0x70, 0x8A, 0x3E, 0x7B, 0x99, 0x40, 0x15, 0x03, 0x25, 0x2F, 0x13, 0xE7, 0xBD, 0x42, 0x00,
+    0xFC, 0x0E, 0xF7, 0x9B, 0x6F, 0x12, 0xEA, 0x29, 0x82, 0xD2, 0x25, 0x1C, 0x65, 0xB2, 0xB2, 0x0E,
+    0x4D, 0x14, 0x40, 0x4A, 0x69, 0x16, 0x4D, 0x99, 0x42, 0x1D, 0xE8, 0x07, 0x53, 0xA0, 0x04, 0x70,
+    0xEF, 0x56, 0x5E, 0xAA, 0xA5, 0xA1, 0x16, 0xDE, 0x6B, 0x80, 0x1A, 0xE1, 0xB0, 0x6F, 0xB4, 0x01,
+    0xCB, 0x82, 0xFF, 0x4A, 0x17, 0x60, 0xCC, 0x31, 0x78, 0xAA, 0x0F, 0x31, 0xEC, 0x6E, 0x98, 0x0D,
+    0x84, 0xD3, 0xC0, 0xD4, 0x3B, 0x3C, 0x9B, 0xFB, 0x64, 0x8B, 0x1F, 0x75, 0xCC, 0x4F, 0xC5, 0x3C,
+    0x4C, 0x38, 0xF1, 0x07, 0x49, 0x89, 0x2E, 0xE3, 0xAB, 0x92, 0x5C, 0xE5, 0xB9, 0x73, 0xD8, 0x0F,
+    0x69, 0x42, 0x61, 0x5E, 0xD8, 0xE8, 0x27, 0x11, 0x63, 0xFF, 0x68, 0xDB, 0xD4, 0xFE, 0x1A, 0x29,
+    0x71, 0xE4, 0xF7, 0x90, 0x49, 0xCE, 0x33, 0x12, 0x29, 0x8B, 0x8A, 0xF1, 0x31, 0x25, 0x50, 0xE6,
+    0x75, 0x4B, 0x9D, 0xB2, 0x04, 0xDC, 0x6C, 0x89, 0x7E, 0xC0, 0xDD, 0x73, 0xBA, 0xD7, 0xCC, 0xED,
+    0x97, 0xEF, 0x2A, 0x7E, 0x2B, 0xE6, 0x7B, 0x1E, 0xB7, 0xC6, 0x23, 0x3B, 0x00, 0x1F, 0xC3, 0xE0,
+    0x93, 0x94, 0x5D, 0xAC, 0xDF, 0x45, 0x40, 0x32, 0xD5, 0x21, 0xFA, 0xAF, 0x53, 0x17, 0xA7, 0xB9,
+    0x83, 0x38, 0xA3, 0xFA, 0x74, 0xCA, 0x8E, 0x50, 0x82, 0x5F, 0xC3, 0x5E, 0xE6, 0x97, 0x9A, 0x77,
+    0x30, 0x47, 0xF0, 0x1F, 0x6E, 0x59, 0xDD, 0x5C, 0xA2, 0x50, 0x51, 0x36, 0x2E, 0x90, 0x3C, 0x29,
+    0xEE, 0xE3, 0x8E, 0xAE, 0xA1, 0x1C, 0xB6, 0x8C, 0x96, 0x7B, 0xDC, 0x6B, 0xEC, 0xC6, 0x8F, 0x74,
+    0x58, 0x3E, 0xDA, 0x16, 0x28, 0xA3, 0x3D, 0x0D, 0x94, 0x7C, 0x0A, 0xCF, 0x1E, 0xD5, 0xB0, 0x19,
+    0xDD, 0x67, 0x2D, 0x2A, 0x81, 0xDB, 0x9A, 0x7C, 0xE5, 0xE0, 0xF6, 0x71, 0xDC, 0xFE, 0x05, 0x6E,
+    0x63, 0xAD, 0xEE, 0xB5, 0xB9, 0xDB, 0xDD, 0x45, 0xC7, 0x63, 0x17, 0x97, 0x50, 0x5B, 0xBF, 0x8E,
+    0x28, 0x0F, 0x44, 0xD3, 0x5E, 0x71, 0xCB, 0xA7, 0x91, 0xAF, 0x36, 0xEB, 0x11, 0xD5, 0xB7, 0x4A,
+    0x5C, 0x52, 0xB7, 0xEE, 0xD7, 0x2D, 0x2F, 0x0E, 0xF6, 0x2E, 0xD6, 0x51, 0xE9, 0x4C, 0x9D, 0xD6,
+    0x61, 0x1D, 0x54, 0x61, 0x91, 0x40, 0x53, 0xE0, 0xFA, 0x01, 0xAF, 0xF0, 0xDB, 0xB8, 0x88, 0xB2,
+    0x99, 0x9C, 0x80, 0xC3, 0xCE, 0x60, 0xB3, 0x33, 0x40, 0x65, 0xE6, 0x65, 0xA4, 0xAA, 0xB7, 0x91,
+    0xB3, 0x6A, 0x2B, 0xC7, 0xB2, 0x07, 0xF1, 0xEE, 0x55, 0xDC, 0x9B, 0xC4, 0xBC, 0xEE, 0xEE, 0x85,
+    0x75, 0x0A, 0x70, 0x74, 0x1F, 0xD6, 0x45, 0x0F, 0x4B, 0x82, 0x58, 0xEE, 0xC3, 0x5A, 0x00, 0x74,
+    0xF9, 0x9D, 0x26, 0x93, 0xE3, 0x86, 0xBB, 0x5D, 0x53, 0x5E, 0xC1, 0xBB, 0x6C, 0x5E, 0x45, 0xA0,
+    0x7A, 0x67, 0x5C, 0x72, 0x72, 0xBF, 0x78, 0x2F, 0x68, 0xC6, 0xC0, 0x8A, 0x4D, 0x92, 0xA7, 0xFB,
+    0x1D, 0xE2, 0x7B, 0xAF, 0x1F, 0x82, 0x06, 0x4A, 0x7C, 0x9B, 0x79, 0x76, 0xC7, 0x15, 0xFF, 0x61,
+    0xF5, 0xA4, 0x12, 0x0D, 0x44, 0x87, 0xE5, 0xF4, 0xFC, 0x27, 0x9E, 0xDD, 0xDB, 0x93, 0x6E, 0x6E,
+    0xB2, 0x7E, 0x9D, 0x45, 0x02, 0x34, 0xB6, 0x77, 0x5A, 0x7C, 0x62, 0x8F, 0x01, 0x32, 0xE9, 0xCE,
+    0x43, 0x15, 0xBB, 0xBD, 0xAA, 0x96, 0xDE, 0xCA, 0xC5, 0xAE, 0x93, 0x6D, 0x38, 0xA0, 0x46, 0xBF,
+    0x27, 0x83, 0xD9, 0x17, 0xFB, 0xE5, 0xB8, 0xF7, 0x8A, 0x2A, 0x7B, 0xE0, 0x2E, 0x99, 0x36, 0x0C,
+    0xB3, 0x27, 0x18, 0xFA, 0xCE, 0xEF, 0x37, 0x98, 0x53, 0xAC, 0x86, 0x4B, 0xD2, 0x2D, 0x77, 0x1A,
+    0xB6, 0x94, 0x8E, 0x8B, 0xFF, 0x99, 0xB0, 0x4F, 0xC1, 0xDB, 0xF7, 0x95, 0xB7, 0x4F, 0xDC, 0xBF,
+    0x07, 0x74, 0x64, 0xBC, 0xEC, 0xF3, 0x56, 0x92, 0xB7, 0xFB, 0x45, 0x2E, 0xFD, 0xDD, 0x7D, 0x08,
+    0x8C, 0x6E, 0xD2, 0x6D, 0x61, 0x71, 0x93, 0x71, 0x49, 0x0B, 0x9B, 0xEF, 0x68, 0xB8, 0x5D, 0x90,
+    0x66, 0x20, 0x5E, 0x87, 0xDD, 0x1D, 0x0E, 0x5E, 0x5A, 0xE2, 0xE0, 0x62, 0xE1, 0xCF, 0x8D, 0xAA,
+    0x94, 0x5B, 0xBF, 0x8B, 0x47, 0xE1, 0xFF, 0xF8, 0x42, 0x95, 0xAF, 0x48, 0x9A, 0xDE, 0x31, 0x9F,
+    0x32, 0xF5, 0x8F, 0x56, 0x17, 0xBB, 0x90, 0xF4, 0x67, 0xCF, 0x6C, 0x38, 0x49, 0x35, 0x20, 0x9D,
+    0xA4, 0xED, 0x52, 0xD2, 0x76, 0x21, 0x29, 0xC7, 0x51, 0x49, 0x0F, 0x9D, 0x42, 0x25, 0x9D, 0x70,
+    0xA1, 0x92, 0xBE, 0x10, 0xFE, 0xFF, 0x49, 0xFA, 0x5F, 0xAD, 0x55, 0xBF, 0x6F, 0xDC, 0x36, 0x14,
+    0xFE, 0x48, 0xC1, 0x15, 0xD0, 0x03, 0xCC, 0x0E, 0xF1, 0xD2, 0x20, 0xA7, 0xA5, 0x43, 0x11, 0xC0,
+    0xB9, 0x35, 0xC3, 0xF9, 0x24, 0x78, 0xCD, 0xE2, 0xC1, 0xB7, 0x74, 0xE9, 0x9E, 0x02, 0xF5, 0xD2,
+    0xE1, 0x06, 0x3B, 0x12, 0xDA, 0x7F, 0xA0, 0x7F, 0x42, 0x87, 0x2E, 0xB9, 0x0C, 0x59, 0x6E, 0xF0,
+    0x70, 0xB6, 0xE8, 0x74, 0xC8, 0x2A, 0x74, 0xE9, 0x2A, 0x04, 0xB7, 0xB4, 0x13, 0x51, 0x68, 0x38,
+    0x24, 0x92, 0xD8, 0xEF, 0x51, 0x4E, 0x1C, 0xB4, 0x31, 0xDA, 0x00, 0xA5, 0xC8, 0xF7, 0x78, 0xE4,
+    0xFB, 0xCD, 0x8F, 0xBC, 0xF4, 0x70, 0x9B, 0xB2, 0xEB, 0x66, 0xA2, 0xD8, 0x5D, 0x02, 0x37, 0x86,
+    0xDB, 0x85, 0x03, 0x5B, 0x64, 0x77, 0x85, 0x8C, 0x81, 0xB8, 0xD8, 0x07, 0x46, 0xC5, 0x94, 0x24,
+    0x23, 0x31, 0x20, 0x49, 0x70, 0x0E, 0xE3, 0xBD, 0x77, 0x9F, 0x96, 0xCB, 0xFE, 0x27, 0xEC, 0x8B,
+    0xCE, 0x34, 0x10, 0x55, 0x93, 0xE8, 0x0A, 0x58, 0x08, 0x59, 0x45, 0x16, 0xF7, 0xFB, 0x67, 0x7F,
+    0x14, 0x29, 0x85, 0x0B, 0xE5, 0x46, 0x05, 0x54, 0x3D, 0xCA, 0xA0, 0x2B, 0x83, 0x81, 0x04, 0x17,
+    0x37, 0x7E, 0x80, 0x8C, 0x1B, 0x76, 0x18, 0x77, 0x5F, 0x43, 0x79, 0x5F, 0x47, 0x7F, 0xFE, 0xD2,
+    0x98, 0x17, 0x57, 0x5B, 0xF3, 0xC2, 0xCA, 0x70, 0x1C, 0x30, 0xAF, 0x2C, 0xE2, 0xD7, 0x16, 0xDA,
+    0xD3, 0x4B, 0xDE, 0x31, 0x36, 0x5F, 0xF0, 0x87, 0x83, 0x7E, 0xB9, 0x85, 0xBE, 0x6A, 0xEF, 0x69,
+    0xDB, 0xCD, 0x38, 0x52, 0x6D, 0xDB, 0xF4, 0xF0, 0x6A, 0x9B, 0xFC, 0xFA, 0xD2, 0xC5, 0x0C, 0x01,
+    0xDF, 0x6C, 0x6E, 0xEC, 0xCB, 0x50, 0x05, 0xAE, 0x9B, 0xE6, 0x6E, 0x5C, 0xC0, 0xFC, 0xE6, 0x60,
+    0x32, 0xB0, 0x24, 0xCC, 0x12, 0x29, 0x5A, 0x1C, 0x00, 0x33, 0xB2, 0x53, 0xE0, 0x09, 0x2E, 0xD0,
+    0x04, 0xA6, 0x5C, 0x60, 0x51, 0x15, 0x58, 0x6C, 0x03, 0x33, 0xD9, 0x5C, 0x14, 0x92, 0xD8, 0xDB,
+    0x14, 0xDB, 0x03, 0xF3, 0xBD, 0x4B, 0x0E, 0xDD, 0x29, 0xA7, 0xB1, 0xAF, 0x1A, 0x31, 0xF1, 0x54,
+    0xB9, 0x27, 0x64, 0x88, 0xAA, 0x33, 0x5A, 0x42, 0x6C, 0x2F, 0x84, 0x99, 0x2C, 0xB0, 0x04, 0x61,
+    0xF1, 0x00, 0x41, 0xE4, 0x34, 0xB8, 0xA6, 0x37, 0x09, 0x84, 0xDE, 0xCC, 0x0F, 0x8E, 0x6A, 0x88,
+    0xFC, 0x10, 0xEF, 0x9D, 0xB7, 0x51, 0x27, 0x61, 0xC1, 0x3F, 0x63, 0x3C, 0xBA, 0x55, 0x5B, 0xDA,
+    0x76, 0xC1, 0xC3, 0xFB, 0xB4, 0x11, 0xAA, 0x5A, 0x72, 0xA0, 0x37, 0x0C, 0x19, 0x79, 0x2F, 0xBA,
+    0xA9, 0x43, 0xD9, 0x28, 0xDF, 0xA0, 0xFC, 0xD1, 0xBC, 0xEA, 0xB0, 0xC6, 0xA4, 0x28, 0xB3, 0x73,
+    0xE4, 0x48, 0x6D, 0x83, 0x4B, 0x18, 0xE7, 0xD0, 0x23, 0xEA, 0x6A, 0xB0, 0xBE, 0xAC, 0xF3, 0x25,
+    0x35, 0x2C, 0x4A, 0x06, 0xEC, 0x90, 0xB2, 0x42, 0x2D, 0x26, 0x15, 0x2E, 0x7A, 0x8C, 0xFA, 0xE7,
+    0x75, 0xBE, 0xE1, 0x49, 0x65, 0x49, 0x07, 0x95, 0x89, 0xE1, 0x8C, 0x1F, 0x26, 0xFC, 0x12, 0x8C,
+    0xB1, 0x2B, 0xBE, 0x76, 0x38, 0x4C, 0x21, 0xC9, 0xE2, 0xE1, 0x48, 0xD9, 0xFC, 0xD1, 0xA8, 0x3E,
+    0x79, 0x53, 0xD6, 0xAA, 0xE4, 0x79, 0x70, 0x4C, 0xDE, 0x94, 0x55, 0xFE, 0xC8, 0xD4, 0x0F, 0x8D,
+    0xAA, 0x44, 0x26, 0xC8, 0xEE, 0x64, 0x43, 0x8E, 0x04, 0xCC, 0x87, 0x46, 0xE9, 0x7D, 0x43, 0x58,
+    0x35, 0xB7, 0xED, 0x0F, 0x4D, 0xC0, 0x46, 0x80, 0x49, 0xE7, 0xE9, 0x72, 0xD9, 0x08, 0x86, 0x19,
+    0x16, 0x51, 0x2B, 0x50, 0x66, 0x5F, 0x10, 0xA8, 0x10, 0xF4, 0xD6, 0xA0, 0x77, 0xFD, 0xDF, 0x64,
+    0x6F, 0xDA, 0x17, 0x2C, 0x3D, 0x4B, 0x3B, 0xA1, 0x36, 0xCB, 0x9A, 0x90, 0x79, 0x6A, 0x72, 0xA5,
+    0x64, 0x0C, 0x25, 0xC2, 0x52, 0xD8, 0x12, 0x11, 0xE8, 0x4E, 0x26, 0xD5, 0xA0, 0x83, 0xEF, 0xDE,
+    0x1A, 0x91, 0x44, 0x24, 0x21, 0xFC, 0xAD, 0x3D, 0x5E, 0x2E, 0x7F, 0x96, 0xBD, 0xF9, 0x7C, 0x7E,
+    0x24, 0xBF, 0xE5, 0xF4, 0xC4, 0x42, 0xCA, 0x49, 0x2C, 0x93, 0x9C, 0x85, 0x8A, 0x79, 0xEE, 0x28,
+    0x39, 0x19, 0x51, 0x3F, 0x6E, 0xC2, 0xA2, 0x6C, 0x52, 0x48, 0xDC, 0x89, 0x37, 0x71, 0x5F, 0xBF,
+    0xB3, 0xAA, 0x4E, 0x7E, 0x17, 0x36, 0xE1, 0xED, 0x62, 0x20, 0x7D, 0xF6, 0x09, 0x01, 0x62, 0x38,
+    0x9D, 0x64, 0x72, 0xB2, 0x04, 0xA6, 0x20, 0x06, 0xBA, 0xD6, 0x0E, 0x9F, 0x67, 0x70, 0x71, 0x15,
+    0xF1, 0x74, 0x57, 0xC6, 0x26, 0x04, 0xF6, 0x22, 0xE1, 0xD9, 0xA6, 0x98, 0xA6, 0x8C, 0x63, 0x86,
+    0xE9, 0x4C, 0xB5, 0x44, 0xEC, 0xF4, 0x8C, 0xE9, 0x9C, 0x61, 0xBA, 0x26, 0xE4, 0xD6, 0x58, 0xAC,
+    0x03, 0xF2, 0x16, 0x6D, 0x2C, 0x6C, 0xD5, 0x46, 0x8E, 0xC8, 0x74, 0x64, 0x7A, 0xAB, 0xAB, 0x75,
+    0xD4, 0xC4, 0xEB, 0xD8, 0xAE, 0xD1, 0x7F, 0x3B, 0x3B, 0xA1, 0x4E, 0xBE, 0x4D, 0x5A, 0x1A, 0xDA,
+    0xC9, 0xD4, 0x11, 0x01, 0x13, 0x9A, 0x19, 0x40, 0x3E, 0x92, 0x80, 0x8F, 0x88, 0x6B, 0x09, 0x85,
+    0x49, 0x55, 0x4A, 0x2A, 0x3A, 0xBA, 0xAE, 0xD2, 0x57, 0x4F, 0x25, 0x7B, 0xEF, 0x22, 0xDF, 0x9D,
+    0xF8, 0x5A, 0x97, 0x5B, 0x49, 0xD5, 0x14, 0x4A, 0x52, 0xC9, 0x02, 0xC5, 0xFF, 0x4B, 0x31, 0xD0,
+    0x4E, 0xAE, 0xAA, 0x9C, 0xEB, 0x2C, 0x14, 0xB8, 0x95, 0x3B, 0xF8, 0x5C, 0xAE, 0x1F, 0x4B, 0x24,
+    0xA5, 0x25, 0xD9, 0x9B, 0x97, 0xBE, 0xCC, 0x2E, 0xF1, 0xB1, 0x5F, 0x59, 0x94, 0x7E, 0xEF, 0xF8,
+    0x28, 0xE0, 0x6B, 0x15, 0xB0, 0x36, 0x80, 0xEE, 0x1E, 0xE4, 0x12, 0xD1, 0xF7, 0x48, 0x9E, 0xC9,
+    0x6B, 0x34, 0x13, 0xD6, 0xF2, 0xD8, 0xBA, 0x7F, 0x48, 0xEF, 0x07, 0xC4, 0x0E, 0xD0, 0x25, 0x86,
+    0xDF, 0x57, 0x00, 0xE6, 0xC7, 0xBE, 0x27, 0x16, 0x3F, 0x3A, 0x36, 0xDD, 0xFB, 0x7E, 0xEF, 0x18,
+    0xCA, 0xCA, 0xEB, 0xC5, 0x28, 0xE8, 0x53, 0x20, 0x3E, 0xA6, 0xBF, 0x03, 0x3A, 0x3C, 0x65, 0x49,
+    0x56, 0x46, 0xA0, 0x62, 0x75, 0x15, 0xD9, 0xC8, 0xF2, 0x99, 0x2F, 0xE0, 0x18, 0xC1, 0xF9, 0x03,
+    0x06, 0x45, 0xA9, 0x07, 0xEF, 0xC0, 0x27, 0xFF, 0x05, 0xD9, 0xFD, 0xE5, 0x72, 0x99, 0x3D, 0x26,
+    0xDA, 0x12, 0x1B, 0xD7, 0xCC, 0xE0, 0x4B, 0xE0, 0x98, 0x2F, 0x89, 0x60, 0x35, 0xE5, 0xB1, 0xDE,
+    0xD2, 0x2F, 0xA5, 0xFC, 0x77, 0x1B, 0xE4, 0x36, 0x60, 0xBE, 0x0B, 0x2B, 0xB7, 0x09, 0xCB, 0x1B,
+    0x55, 0x89, 0x4D, 0xDC, 0xF9, 0x6C, 0xF5, 0x6F, 0x6D, 0x8F, 0x2A, 0x2E, 0x40, 0x6D, 0x30, 0xFA,
+    0xC1, 0x3E, 0x18, 0x35, 0x1B, 0x5E, 0x19, 0x24, 0x1B, 0x99, 0xE7, 0xB7, 0x0B, 0x77, 0x88, 0x5B,
+    0xE4, 0xB5, 0x3C, 0xD5, 0x7A, 0x83, 0x5D, 0xE3, 0x31, 0x4E, 0xBE, 0xB6, 0xFB, 0x07, 0xBA, 0x61,
+    0x39, 0xCA, 0xED, 0x34, 0x3C, 0x0B, 0xC0, 0x5F, 0xD5, 0x5A, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E,
+    0x24, 0xA3, 0x10, 0x30, 0x91, 0xD0, 0x83, 0x5D, 0x04, 0x51, 0x2D, 0x76, 0xF0, 0x60, 0x18, 0x91,
+    0x98, 0xC1, 0x83, 0x07, 0xC9, 0x64, 0x92, 0xB1, 0x8B, 0x87, 0x28, 0x1E, 0x0C, 0xD4, 0x5D, 0x9B,
+    0xA1, 0xF2, 0xE0, 0x41, 0x68, 0x25, 0x91, 0x49, 0x86, 0x8C, 0xF5, 0xDE, 0x45, 0x43, 0x06, 0x47,
+    0x1E, 0xEC, 0x41, 0x83, 0x06, 0x5B, 0x64, 0xDC, 0x21, 0x43, 0x16, 0xB6, 0x45, 0x91, 0x21, 0x43,
+    0x89, 0x38, 0x09, 0xD0, 0x64, 0x30, 0xD3, 0xD2, 0xC1, 0x53, 0xC2, 0xF7, 0x6E, 0xBF, 0xEF, 0xDC,
+    0xF7, 0x23, 0xC9, 0x0A, 0x62, 0x18, 0xFE, 0x91, 0xA9, 0xC7, 0x73, 0x29, 0xF2, 0xF2, 0xDE, 0x73,
+    0xCE, 0x3D, 0xFF, 0x97, 0x22, 0x89, 0x64, 0x79, 0x91, 0x67, 0xE9, 0x94, 0xF0, 0x38, 0x21, 0x33,
+    0x32, 0xA7, 0x7F, 0x31, 0x9E, 0xEC, 0xF9, 0x4B, 0x33, 0xFD, 0x13, 0xA7, 0x14, 0x71, 0x79, 0x56,
+    0x22, 0x99, 0xC9, 0xBD, 0x1F, 0xEF, 0x35, 0xE1, 0x97, 0x7F, 0x6B, 0xA3, 0x3B, 0x77, 0xDA, 0xE4,
+    0xCD, 0x4F, 0xEA, 0x04, 0xCF, 0x78, 0x66, 0xFB, 0x4E, 0xBD, 0xFF, 0x66, 0x29, 0xF1, 0xFB, 0xA5,
+    0x84, 0xFF, 0x28, 0x5F, 0x0F, 0x7E, 0xF8, 0xA4, 0x71, 0x8D, 0xA9, 0x25, 0x36, 0xA9, 0x8E, 0xE5,
+    0x0E, 0xC7, 0xD5, 0x63, 0xDA, 0xE4, 0x22, 0xC5, 0x8D, 0x56, 0xDC, 0xD6, 0xE9, 0xC4, 0x6B, 0xA4,
+    0x13, 0xBF, 0x92, 0x5B, 0x12, 0x54, 0xF2, 0x7B, 0x02, 0x11, 0xBF, 0x06, 0xF0, 0x14, 0x34, 0x00,
+    0x6E, 0x2B, 0x44, 0x07, 0x63, 0x29, 0x90, 0x55, 0x8E, 0x72, 0x8E, 0x20, 0x19, 0x03, 0xFD, 0x77,
+    0x9E, 0x60, 0x13, 0xA7, 0xF3, 0x6D, 0x2A, 0x79, 0x60, 0x06, 0x17, 0xF3, 0xD8, 0x18, 0x23, 0x67,
+    0x65, 0xA9, 0xE3, 0xDD, 0x54, 0xE7, 0x7F, 0x5D, 0x64, 0xFD, 0x56, 0xF6, 0x65, 0x83, 0x47, 0x55,
+    0x58, 0x46, 0x69, 0x28, 0x7E, 0x39, 0x0B, 0xF4, 0xE6, 0xC5, 0xA9, 0x78, 0xE2, 0xBA, 0x8A, 0xC4,
+    0x2B, 0xC3, 0x3C, 0x4A, 0xE3, 0x81, 0x29, 0x6F, 0x67, 0xDF, 0x34, 0x67, 0x44, 0x6E, 0xF2, 0xDD,
+    0xC2, 0x38, 0xA6, 0x2D, 0x06, 0x52, 0x7C, 0x15, 0x36, 0x12, 0xE5, 0x3E, 0x80, 0x78, 0x3D, 0x99,
+    0x15, 0x50, 0x82, 0xD9, 0xFB, 0xB2, 0x0C, 0x4C, 0x05, 0x48, 0x27, 0x6F, 0x00, 0xFD, 0xE8, 0x03,
+    0xD0, 0x1C, 0x7E, 0x0A, 0x72, 0xFD, 0x2F, 0x30, 0xFD, 0x05, 0xB3, 0x28, 0x9E, 0x31, 0x03, 0x61,
+    0x6F, 0x1C, 0x00, 0xCE, 0x3B, 0xFD, 0x07, 0xEE, 0x59, 0xE0, 0xF4, 0x01, 0x2E, 0x9A, 0xAB, 0x9C,
+    0xB3, 0x27, 0x47, 0x37, 0x77, 0x1F, 0x96, 0x8F, 0xFB, 0xEE, 0x4D, 0x81, 0x3A, 0xD3, 0x17, 0xFF,
+    0xEB, 0x22, 0x05, 0xE6, 0x65, 0x24, 0x61, 0x19, 0x4B, 0x90, 0xC7, 0xE2, 0x48, 0x8C, 0x47, 0x21,
+    0xF0, 0x09, 0x30, 0x4D, 0x84, 0x65, 0x99, 0xCF, 0xFA, 0xB2, 0xE2, 0x9B, 0x7C, 0x45, 0xB2, 0x7A,
+    0x55, 0x82, 0x26, 0xC9, 0xDD, 0x36, 0x6E, 0xA5, 0x0D, 0x4C, 0xDA, 0x82, 0xBE, 0x06, 0xEB, 0x56,
+    0x89, 0xCB, 0x65, 0x4A, 0x40, 0x00, 0x97, 0xC4, 0xAB, 0x5E, 0x06, 0x57, 0x62, 0x3D, 0xBD, 0x32,
+    0xAA, 0xC2, 0xD4, 0xC7, 0x5C, 0xB2, 0x74, 0x55, 0x66, 0x9D, 0x3A, 0xF1, 0x5A, 0xFC, 0xE6, 0x9C,
+    0x46, 0x46, 0xC7, 0x12, 0xF1, 0x16, 0xDF, 0xDC, 0x18, 0x70, 0x7D, 0x72, 0x89, 0x31, 0x4C, 0x0F,
+    0x0B, 0xD9, 0x70, 0x55, 0x17, 0x65, 0x45, 0x82, 0x12, 0x78, 0xCC, 0x49, 0x28, 0xB7, 0xDD, 0x36,
+    0x94, 0x19, 0x07, 0x93, 0xFB, 0xF9, 0x2C, 0x1E, 0xA6, 0x5E, 0x39, 0xEF, 0x73, 0x42, 0xDB, 0x60,
+    0x55, 0x02, 0x95, 0xC7, 0x71, 0x53, 0x69, 0x33, 0xEC, 0x42, 0xF1, 0xF0, 0xCA, 0x19, 0x08, 0xC8,
+    0x49, 0x3F, 0x0F, 0xC1, 0xFE, 0xCD, 0x30, 0x05, 0xC9, 0xA6, 0xC6, 0xAA, 0x54, 0xEE, 0xC7, 0x98,
+    0x88, 0xD3, 0x62, 0x74, 0x88, 0xB8, 0x44, 0x15, 0x39, 0xB0, 0x31, 0xB0, 0xEB, 0x58, 0x2B, 0xA2,
+    0xE7, 0x45, 0xB9, 0x92, 0x5C, 0x2C, 0x13, 0xAF, 0x9E, 0xC2, 0xFC, 0x17, 0xEA, 0xE8, 0xBB, 0x7A,
+    0xCD, 0xAB, 0x3B, 0xFC, 0xFC, 0x7A, 0x3B, 0x6A, 0xE2, 0xFB, 0x9D, 0x83, 0x4E, 0xC7, 0x20, 0x3C,
+    0x57, 0xFC, 0xDC, 0x69, 0x38, 0xF2, 0x02, 0x78, 0xDB, 0x49, 0xF2, 0x56, 0x2B, 0x45, 0xD0, 0xE8,
+    0xC9, 0x6B, 0xDE, 0xE3, 0x33, 0xF6, 0x61, 0x5F, 0xBE, 0x53, 0x18, 0xD3, 0x42, 0x02, 0xDB, 0xA1,
+    0x5C, 0x1E, 0x74, 0x5E, 0x39, 0xBE, 0x98, 0x26, 0xA6, 0x4E, 0x86, 0x18, 0x3D, 0x0C, 0x07, 0x85,
+    0x1C, 0xFC, 0x14, 0xBA, 0x40, 0x0E, 0x6E, 0x5F, 0xAC, 0xC1, 0x41, 0x59, 0x75, 0xC8, 0x41, 0xE8,
+    0x46, 0x0B, 0xBE, 0x8C, 0x1B, 0xA7, 0xA1, 0x5C, 0xAF, 0x5D, 0xAC, 0xC0, 0x33, 0x68, 0x0F, 0x59,
+    0x27, 0xAB, 0x89, 0x6D, 0xC2, 0x5C, 0xBB, 0x04, 0x15, 0x38, 0x28, 0xAB, 0x5E, 0x43, 0x0E, 0xAE,
+    0x3A, 0x3D, 0x70, 0xF0, 0x43, 0x53, 0x19, 0xD0, 0xF9, 0xF7, 0xC5, 0xF4, 0xF8, 0x43, 0x71, 0xF0,
+    0xF8, 0xE2, 0xE2, 0xA2, 0x24, 0xA0, 0x33, 0x3D, 0xBD, 0xB1, 0xB1, 0x41, 0x2D, 0xF3, 0x4C, 0x8A,
+    0x05, 0x3E, 0xE7, 0x34, 0xF3, 0xB2, 0xB5, 0x22, 0xCB, 0x2B, 0xB2, 0x35, 0x2F, 0x30, 0x21, 0x4D,
+    0x68, 0x2A, 0x67, 0x60, 0x29, 0x0C, 0xD2, 0x03, 0xCF, 0x31, 0xC7, 0x7E, 0xE6, 0xF9, 0xEE, 0xC3,
+    0x0C, 0xFB, 0x3A, 0x6F, 0x43, 0xAC, 0xCB, 0x73, 0x7E, 0xB3, 0xE2, 0x35, 0xA7, 0x20, 0x13, 0x9E,
+    0x72, 0x09, 0x12, 0x13, 0xAA, 0x4D, 0x68, 0xC4, 0xCF, 0x4F, 0xCD, 0xC8, 0xD9, 0xCC, 0xF4, 0xA8,
+    0x4B, 0x20, 0x87, 0xFD, 0xF3, 0xB5, 0x49, 0xFF, 0x1A, 0xBA, 0xEC, 0xF5, 0xC5, 0x59, 0xAA, 0xC4,
+    0x6B, 0xC5, 0xE9, 0x5D, 0x76, 0x7A, 0x9B, 0x6E, 0xBB, 0x3A, 0xDD, 0xD0, 0x80, 0x9D, 0x17, 0xE7,
+    0x23, 0xBF, 0x0D, 0xAB, 0x28, 0x5D, 0x80, 0x81, 0x82, 0x2E, 0x75, 0x8F, 0x00, 0x92, 0xD4, 0x19,
+    0x81, 0xDC, 0x05, 0x28, 0x3D, 0x80, 0x3A, 0xEA, 0x83, 0x6D, 0x5D, 0x96, 0x2F, 0x14, 0x4D, 0x5C,
+    0x2E, 0xD0, 0x4C, 0x2F, 0xEC, 0xB3, 0x6D, 0x39, 0x01, 0x15, 0x2B, 0x26, 0xBB, 0x03, 0xB5, 0xA1,
+    0xE0, 0xF6, 0xF9, 0x00, 0x74, 0x03, 0xBB, 0xFB, 0x19, 0x06, 0x68, 0xB8, 0xB4, 0x00, 0xC5, 0x01,
+    0x40, 0x1F, 0x68, 0x97, 0x88, 0xC0, 0x27, 0x10, 0x2E, 0x0B, 0xD8, 0xF2, 0xE8, 0x40, 0x07, 0x70,
+    0x1B, 0x20, 0xBB, 0xD4, 0x24, 0xB5, 0xBC, 0xBB, 0x7E, 0x7A, 0x5D, 0x64, 0x4D, 0x0C, 0xFE, 0x0A,
+    0x39, 0x06, 0x8B, 0x13, 0x48, 0x58, 0xF9, 0x2D, 0xE8, 0xBE, 0x25, 0x1D, 0x0C, 0x66, 0x2E, 0x2F,
+    0x88, 0xDC, 0x16, 0xBF, 0x2F, 0x6B, 0x7D, 0x39, 0x79, 0x9B, 0xD7, 0x07, 0xFF, 0x06, 0xC4, 0x15,
+    0x93, 0xBC, 0x38, 0x48, 0xA3, 0xBF, 0x42, 0x7E, 0xDA, 0xDB, 0xD2, 0x75, 0xA3, 0x1F, 0xC6, 0x5A,
+    0x95, 0x5E, 0xFC, 0x56, 0x13, 0xC0, 0x34, 0x1D, 0x93, 0xA3, 0xD0, 0xCB, 0x65, 0xA8, 0xD9, 0x82,
+    0x57, 0x49, 0xF4, 0x06, 0xF5, 0x0F, 0xD6, 0xAF, 0x81, 0x70, 0x77, 0x71, 0xC9, 0x93, 0xD7, 0xBC,
+    0xC7, 0x67, 0xEC, 0xC3, 0xBE, 0x7C, 0x87, 0xB8, 0xF0, 0xB8, 0x05, 0x31, 0xCD, 0xC5, 0x87, 0xB1,
+    0x0D, 0x53, 0xD9, 0x46, 0x03, 0xB5, 0x3D, 0xD9, 0xD9, 0x25, 0xE8, 0xA8, 0x62, 0xDA, 0xB4, 0xDA,
+    0xA8, 0x6D, 0xA3, 0x7A, 0x6B, 0xE3, 0x97, 0xDA, 0x84, 0x74, 0xAC, 0x1D, 0x5E, 0x4B, 0xD8, 0x2C,
+    0x80, 0x78, 0x58, 0xA0, 0x15, 0xD7, 0x90, 0x86, 0xD6, 0xCB, 0x28, 0x68, 0x4D, 0xC8, 0x65, 0xF4,
+    0xAA, 0xD7, 0xD8, 0xF8, 0xE5, 0x15, 0x36, 0x61, 0x5A, 0xB3, 0x89, 0xDC, 0x6F, 0x8B, 0x6B, 0x98,
+    0x0D, 0xD6, 0xDF, 0xCE, 0xC6, 0x9B, 0xAD, 0x36, 0x9C, 0x0D, 0xEA, 0x86, 0xD9, 0x3C, 0x33, 0x36,
+    0xAA, 0x13, 0xAC, 0x03, 0x51, 0xAC, 0x81, 0xEE, 0xB6, 0x45, 0xF7, 0xE4, 0x43, 0xA2, 0xAB, 0x4D,
+    0x04, 0xE9, 0x27, 0xBA, 0xD0, 0x18, 0x34, 0x2B, 0x09, 0xE4, 0xBF, 0x2F, 0xED, 0x82, 0xDB, 0x26,
+    0xE6, 0xFB, 0xE6, 0x15, 0xFA, 0x5A, 0xCE, 0xDB, 0x10, 0x5D, 0x6D, 0xF0, 0x1A, 0x07, 0x88, 0xF4,
+    0x8A, 0xB3, 0x2D, 0xA8, 0xFD, 0xA1, 0x93, 0xC3, 0x6C, 0x5E, 0xF9, 0x0A, 0x67, 0x83, 0x76, 0xF1,
+    0x35, 0x68, 0x18, 0x3B, 0x67, 0xAA, 0x65, 0x62, 0x35, 0x8D, 0x07, 0xB4, 0x4D, 0xFC, 0x54, 0xA0,
+    0x71, 0x54, 0x49, 0x68, 0x1D, 0x82, 0x10, 0xA1, 0xE6, 0xCD, 0x5B, 0x47, 0xBF, 0xC5, 0x3E, 0x39,
+    0x87, 0x84, 0x16, 0xBA, 0x90, 0x74, 0x68, 0xA2, 0x47, 0xAC, 0xBD, 0x36, 0xA0, 0x06, 0xC0, 0x2A,
+    0x61, 0xC1, 0xA1, 0x95, 0x73, 0x40, 0x19, 0x9A, 0x39, 0x0F, 0xED, 0x81, 0x76, 0x6E, 0x05, 0x1D,
+    0x43, 0x8C, 0xE6, 0x25, 0x10, 0x7E, 0xDE, 0xAD, 0xE7, 0xE9, 0x37, 0xBD, 0xF2, 0x26, 0x9B, 0xE0,
+    0xBD, 0x8A, 0x4D, 0xE8, 0xE5, 0x6C, 0xE6, 0x82, 0x8D, 0x01, 0x24, 0x74, 0x3E, 0x34, 0xE4, 0xE7,
+    0x96, 0xF5, 0xB0, 0x8D, 0x36, 0x9C, 0xAD, 0xCF, 0xD7, 0x24, 0x34, 0xA3, 0x08, 0x45, 0xF5, 0x2C,
+    0xA2, 0x03, 0x6F, 0xAC, 0xE3, 0x74, 0x77, 0xD9, 0x1D, 0x3F, 0xDF, 0x7B, 0xC6, 0xB9, 0xB8, 0x30,
+    0x69, 0x70, 0x02, 0x6A, 0xA4, 0xB1, 0x6E, 0xC2, 0xA5, 0xDF, 0xD6, 0xD3, 0xC1, 0xE9, 0x55, 0x6B,
+    0x88, 0x68, 0x92, 0x34, 0xAC, 0xC3, 0xAF, 0xB3, 0xD2, 0xA5, 0xAF, 0x9F, 0x82, 0xD5, 0x74, 0xD7,
+    0x39, 0x9A, 0x67, 0x39, 0xD5, 0x97, 0xB1, 0xCA, 0xDB, 0x75, 0x9A, 0x84, 0x4B, 0x93, 0x89, 0x2B,
+    0x7D, 0xAA, 0x66, 0x37, 0x52, 0xB1, 0x88, 0xB9, 0xDA, 0xB2, 0xA0, 0x43, 0x2C, 0x6B, 0xE4, 0xD0,
+    0xEA, 0x40, 0x4D, 0xC1, 0x01, 0x54, 0xCA, 0xBC, 0x92, 0x26, 0xC4, 0x2F, 0x23, 0x3A, 0xF2, 0x34,
+    0xC4, 0x10, 0xA1, 0x0E, 0x31, 0x03, 0x55, 0xC1, 0x84, 0x1B, 0xD7, 0x29, 0x71, 0x2A, 0x81, 0x5B,
+    0x1A, 0x81, 0x34, 0xC4, 0x85, 0xE2, 0x53, 0xD8, 0x20, 0x90, 0x8C, 0x81, 0x15, 0xA2, 0xDB, 0x4D,
+    0xCA, 0xA5, 0x1D, 0x99, 0xA2, 0xC5, 0x95, 0x80, 0x44, 0xC8, 0xAB, 0x8A, 0x68, 0x92, 0x8E, 0x09,
+    0x70, 0x14, 0x1F, 0x95, 0x3A, 0x79, 0x51, 0x0E, 0x3B, 0xFE, 0x2F, 0x5E, 0x9D, 0x60, 0x92, 0x28,
+    0x0E, 0xB7, 0x6E, 0xAB, 0xCE, 0x46, 0x9C, 0x37, 0xF7, 0xF2, 0x43, 0x8E, 0xBF, 0xAA, 0x16, 0x1C,
+    0x2D, 0x03, 0x3B, 0xF3, 0x0D, 0x3A, 0xBC, 0xEC, 0x53, 0x82, 0x5F, 0x90, 0x3F, 0x1E, 0x72, 0xCE,
+    0x3B, 0xF5, 0x11, 0x0D, 0xED, 0xA1, 0x39, 0x50, 0x70, 0x42, 0xB7, 0x8E, 0xE4, 0xC0, 0xE3, 0xB0,
+    0xF1, 0xDC, 0xA6, 0x10, 0x56, 0x5A, 0x7A, 0x9A, 0x87, 0xD4, 0x2F, 0x2B, 0x0C, 0x15, 0x87, 0x19,
+    0xC2, 0xAC, 0x9B, 0x60, 0x7B, 0x18, 0x70, 0xF6, 0x11, 0x2A, 0x50, 0x30, 0x5E, 0x2C, 0x6C, 0x2B,
+    0x7F, 0xEA, 0xD9, 0x40, 0xE2, 0xBF, 0x3D, 0x7D, 0xCB, 0xF9, 0xD2, 0xB6, 0xDE, 0x9D, 0x9E, 0x5A,
+    0x1D, 0xFF, 0x7D, 0x6B, 0x93, 0x42, 0xD7, 0xB6, 0x33, 0xC3, 0x76, 0x7E, 0xD8, 0x2E, 0xBB, 0xFD,
+    0x45, 0x46, 0x7D, 0x4C, 0xF1, 0xD4, 0x80, 0xE2, 0xFF, 0xB7, 0x49, 0x81, 0x7D, 0x1E, 0x7C, 0x7B,
+    0x5D, 0x5B, 0xD8, 0x5A, 0x6D, 0x91, 0x4E, 0xF5, 0x6C, 0x72, 0x66, 0xDB, 0x4D, 0x6D, 0x2F, 0x83,
+    0x02, 0xB6, 0x37, 0x61, 0x2D, 0xD8, 0x36, 0x58, 0x69, 0xD8, 0x42, 0xB7, 0x01, 0xEE, 0x97, 0x06,
+    0x1B, 0x37, 0x1A, 0x60, 0x4F, 0xBC, 0x87, 0xEE, 0xCF, 0x21, 0x21, 0xD1, 0x8F, 0x45, 0x25, 0xC8,
+    0x6E, 0x1A, 0x04, 0x50, 0x5E, 0xAB, 0x71, 0x1E, 0x58, 0xE4, 0x56, 0xE4, 0x96, 0xDA, 0x5E, 0x4D,
+    0x57, 0x86, 0x31, 0xD3, 0xCF, 0x82, 0x72, 0xD4, 0x99, 0xD1, 0xAC, 0x84, 0x9C, 0x00, 0x91, 0x8A,
+    0x1C, 0x85, 0x4B, 0x41, 0x8E, 0x67, 0x98, 0xD3, 0x81, 0xD1, 0x15, 0xD8, 0x46, 0x1B, 0x77, 0x82,
+    0x0B, 0x4E, 0x11, 0x95, 0xE9, 0x71, 0x2A, 0xAA, 0x66, 0x0E, 0x91, 0x38, 0x52, 0x24, 0xBA, 0x2A,
+    0xA6, 0xA4, 0xA7, 0xC7, 0xC1, 0x9A, 0x22, 0xA3, 0x69, 0xAB, 0xFA, 0x62, 0x79, 0x6D, 0xB7, 0x38,
+    0xEB, 0x0A, 0x2C, 0x11, 0x60, 0xB6, 0xA0, 0x24, 0x1D, 0x04, 0xEE, 0x18, 0x60, 0xCC, 0x7D, 0x80,
+    0xBC, 0x56, 0x46, 0x2B, 0x97, 0x0F, 0xEC, 0x32, 0x02, 0x57, 0x08, 0x36, 0x09, 0x5A, 0x0C, 0xEF,
+    0x36, 0xCA, 0xC7, 0xC2, 0x32, 0x51, 0xBD, 0x0D, 0x7D, 0x94, 0x44, 0xE5, 0xC8, 0xD3, 0x6C, 0xA9,
+    0xE4, 0x1E, 0x0E, 0xFC, 0xAE, 0xB1, 0x8F, 0xB1, 0x06, 0x0D, 0x4C, 0xFC, 0x0C, 0x48, 0xCE, 0x91,
+    0xC5, 0x67, 0xE4, 0xCA, 0x61, 0xC0, 0x0F, 0x59, 0x2E, 0x94, 0x8C, 0xCB, 0x9A, 0x21, 0x41, 0x90,
+    0x05, 0xB7, 0xDE, 0x6F, 0xA9, 0x9E, 0x15, 0x6A, 0x7F, 0x00, 0x4A, 0x29, 0x17, 0x15, 0x0A, 0x44,
+    0x7B, 0x70, 0x72, 0x8C, 0x4F, 0xB3, 0x64, 0xD6, 0xD9, 0xF9, 0x91, 0x7E, 0x78, 0xF1, 0x92, 0xB9,
+    0x8A, 0x41, 0xE8, 0x26, 0x21, 0xD3, 0xF0, 0xF2, 0xAB, 0x94, 0x68, 0xA7, 0x7C, 0xCC, 0xE3, 0x3B,
+    0x1F, 0xF1, 0x3A, 0x30, 0x12, 0x5D, 0xCA, 0x11, 0xA5, 0xAF, 0xCB, 0xFA, 0xE3, 0x1D, 0xFF, 0x94,
+    0x5B, 0xF5, 0xFD, 0x66, 0xC0, 0x5C, 0xAF, 0xDA, 0xB5, 0x58, 0x8F, 0x67, 0x70, 0xAC, 0xC0, 0x55,
+    0xE6, 0xEA, 0x2C, 0x4B, 0xE1, 0xE6, 0x52, 0xCD, 0xA7, 0x7E, 0x8F, 0xD0, 0xE9, 0xEB, 0xC2, 0x15,
+    0x0A, 0xB3, 0x94, 0x30, 0x51, 0x31, 0x88, 0x87, 0xF0, 0x57, 0xFD, 0x45, 0x98, 0x20, 0x8C, 0x90,
+    0x46, 0xD5, 0x3B, 0x7A, 0xCD, 0xFB, 0x16, 0xC6, 0xBB, 0x7A, 0xDA, 0xB7, 0x92, 0x74, 0x3C, 0x1A,
+    0x12, 0x68, 0x8B, 0x03, 0x7E, 0x71, 0x03, 0x6B, 0x79, 0x1D, 0xD1, 0x35, 0xC6, 0xF9, 0x8A, 0x94,
+    0x69, 0x50, 0xE0, 0x9A, 0xFC, 0x26, 0xAC, 0xDA, 0xBD, 0xFB, 0x0C, 0x0D, 0x5C, 0xDA, 0xFC, 0xA9,
+    0xFD, 0x41, 0x41, 0xD1, 0xA2, 0x57, 0x7F, 0x09, 0xE4, 0x14, 0x3B, 0x1E, 0xF4, 0x2E, 0xCC, 0x5D,
+    0xD0, 0x10, 0xA4, 0xEC, 0x0D, 0x78, 0xAF, 0x21, 0xFC, 0x9C, 0x59, 0xB8, 0xFB, 0xCF, 0x8E, 0xB0,
+    0x1A, 0x28, 0xCC, 0x52, 0xC2, 0xA4, 0x24, 0x0C, 0x6B, 0xC2, 0xA0, 0x25, 0xF4, 0x3A, 0x42, 0x19,
+    0x28, 0x2C, 0x7E, 0x4B, 0x98, 0x7C, 0x46, 0x18, 0x7D, 0x47, 0x18, 0x18, 0x42, 0x4F, 0x21, 0x0C,
+    0x26, 0x6B, 0x18, 0x45, 0x7A, 0x69, 0x27, 0x05, 0x5D, 0x05, 0xB0, 0x8F, 0xD2, 0xBD, 0xE1, 0x70,
+    0xF7, 0xCB, 0xE1, 0xB0, 0xCB, 0xFA, 0x93, 0xC4, 0x74, 0x09, 0x48, 0xBC, 0x60, 0xC1, 0xF9, 0x6A,
+    0x5F, 0xBD, 0x65, 0xA6, 0x9E, 0x33, 0xC9, 0x69, 0xE9, 0xE2, 0x92, 0xB6, 0x3E, 0xAA, 0x68, 0xF6,
+    0xC3, 0x8A, 0x16, 0x3A, 0xAC, 0x15, 0x36, 0x3F, 0x03, 0x6B, 0xED, 0x59, 0xDB, 0xB7, 0x38, 0x42,
+    0x54, 0xDA, 0xD1, 0x68, 0x3C, 0x93, 0xE1, 0x2C, 0xC8, 0x53, 0x79, 0x91, 0xFC, 0x87, 0xB3, 0x5B,
+    0x47, 0xA1, 0xF5, 0x37, 0x1C, 0xEF, 0x4E, 0xE2, 0x79, 0xEB, 0xEF, 0xB4, 0x5E, 0x33, 0xA4, 0xE2,
+    0x84, 0x3C, 0x1F, 0x54, 0x1C, 0xD1, 0xD8, 0x37, 0x51, 0xCC, 0x33, 0xF5, 0x65, 0x3D, 0xCD, 0xAD,
+    0xEA, 0x39, 0x7A, 0xCB, 0xD4, 0x7F, 0x2E, 0xA8, 0x70, 0xCE, 0x6B, 0x38, 0x32, 0xA0, 0xE8, 0x44,
+    0xC5, 0xE7, 0x18, 0xF0, 0xB5, 0xC0, 0x68, 0x29, 0x6F, 0xEB, 0xB9, 0xC0, 0xDF, 0xCD, 0x67, 0x89,
+    0xBF, 0x86, 0x87, 0x41, 0x63, 0xEB, 0x08, 0x73, 0x07, 0x46, 0xC9, 0x87, 0x12, 0xFF, 0xDF, 0x88,
+    0x5C, 0x5D, 0x81, 0xAB, 0x8A, 0x25, 0xA8, 0x82, 0x32, 0x4E, 0xDD, 0x06, 0xD9, 0xD5, 0x36, 0x9C,
+    0x67, 0x5C, 0xD9, 0x00, 0x6C, 0x1B, 0x11, 0x60, 0xCB, 0xB2, 0x7F, 0x2C, 0x71, 0x1A, 0x94, 0xAB,
+    0xE8, 0x0B, 0xE7, 0x75, 0x75, 0x42, 0xD6, 0x2C, 0x29, 0xDB, 0x39, 0xAB, 0x94, 0x35, 0x4A, 0x59,
+    0x8F, 0x53, 0x79, 0x4A, 0x99, 0x6F, 0x48, 0x59, 0xA8, 0x94, 0xCD, 0x2A, 0x65, 0xF3, 0x4A, 0xD9,
+    0xA6, 0x52, 0xD6, 0x90, 0x32, 0xB7, 0x24, 0x1D, 0x7E, 0x4E, 0x18, 0x2A, 0x4D, 0x33, 0x0A, 0xE7,
+    0x95, 0xB2, 0x2B, 0x4A, 0x59, 0x43, 0xCA, 0xEE, 0x54, 0xA4, 0xEC, 0x6E, 0x49, 0xCA, 0x7E, 0x4A,
+    0x49, 0xD9, 0x60, 0x17, 0x65, 0x99, 0x52, 0xF6, 0x83, 0x86, 0xFF, 0x15, 0x29, 0x1B, 0xEE, 0x23,
+    0x38, 0xD7, 0x1E, 0x4C, 0xDD, 0xF3, 0x49, 0x02, 0x3C, 0x72, 0x64, 0xA3, 0x23, 0x33, 0x8D, 0x07,
+    0x8B, 0x6B, 0x6A, 0xB7, 0xE8, 0xB9, 0x7D, 0xF6, 0x75, 0xB4, 0xF4, 0xA4, 0x50, 0x1E, 0x2F, 0x14,
+    0x0B, 0xFB, 0x5A, 0xB6, 0x29, 0xB4, 0xA0, 0x98, 0x54, 0xBC, 0x19, 0x99, 0x1B, 0x1A, 0xB7, 0x9A,
+    0x74, 0xB2, 0x1F, 0xF2, 0x6A, 0x3E, 0x49, 0xE3, 0xB7, 0xF5, 0x4E, 0x6F, 0x42, 0x85, 0x9F, 0x3E,
+    0x1F, 0x54, 0x58, 0xF7, 0x11, 0xD8, 0xCC, 0x43, 0x97, 0x24, 0x89, 0x35, 0xC6, 0xD5, 0x4C, 0xA7,
+    0x72, 0xAA, 0xE7, 0x82, 0x8A, 0x4D, 0x16, 0x94, 0xA4, 0xD3, 0x1C, 0xC2, 0xC2, 0x2D, 0xBF, 0x3C,
+    0x40, 0xE1, 0x0F, 0xAD, 0x2C, 0x9D, 0xD6, 0x26, 0xDB, 0xE5, 0x03, 0x6D, 0x49, 0x48, 0x89, 0x38,
+    0xB2, 0x8F, 0x8A, 0xC4, 0x34, 0xA1, 0xA9, 0x63, 0xB3, 0x7E, 0xC4, 0xD4, 0x50, 0x6A, 0xBC, 0xC6,
+    0x4D, 0xAF, 0x15, 0x9D, 0x65, 0x4B, 0x25, 0x52, 0x6B, 0x6A, 0xCC, 0x6F, 0xC3, 0x9A, 0x43, 0xF8,
+    0x0D, 0x37, 0x00, 0xBC, 0x1E, 0x8B, 0x05, 0x4E, 0xA7, 0xBB, 0x7D, 0xDB, 0xCB, 0x32, 0xAA, 0x90,
+    0xAB, 0x61, 0x41, 0xD7, 0xF2, 0x61, 0xA1, 0x26, 0x80, 0x53, 0xC5, 0x0E, 0x37, 0x16, 0x8C, 0xC6,
+    0x50, 0x0D, 0x83, 0x39, 0x48, 0x92, 0xB7, 0x2F, 0x02, 0x37, 0xB8, 0xE9, 0x0E, 0xAE, 0x6B, 0xE0,
+    0x95, 0xB1, 0x7E, 0x1F, 0x31, 0x28, 0x0B, 0x6B, 0x82, 0x66, 0x2F, 0xD0, 0x7B, 0x0C, 0xE2, 0x34,
+    0x7A, 0x43, 0xC0, 0x36, 0xB8, 0x81, 0x78, 0xD0, 0x0C, 0xD2, 0x5D, 0xE3, 0xE9, 0xF0, 0x97, 0xEC,
+    0xDE, 0x9E, 0xF2, 0xE7, 0x78, 0xAA, 0x9B, 0x3D, 0x6A, 0xC5, 0xAB, 0x25, 0xAD, 0x20, 0x52, 0x6E,
+    0x6F, 0x6B, 0xF0, 0xA0, 0x7B, 0xA4, 0x13, 0xD8, 0x4A, 0x0C, 0x24, 0x5A, 0x39, 0xDD, 0x79, 0xAC,
+    0x69, 0x8E, 0x84, 0x25, 0xDF, 0x05, 0xB5, 0xDE, 0xAB, 0x99, 0x6D, 0xE7, 0xD3, 0x1E, 0x77, 0x0E,
+    0xF2, 0x59, 0xEE, 0x44, 0xF4, 0x74, 0x84, 0xBE, 0xAE, 0x29, 0x98, 0xDC, 0xBD, 0xA0, 0xA5, 0xEB,
+    0x5F, 0x2B, 0x9C, 0x05, 0x74, 0xBA, 0x18, 0xEB, 0x3B, 0xDD, 0x85, 0xFF, 0xEA, 0x24, 0xE9, 0x7C,
+    0xBB, 0xC5, 0x73, 0x7C, 0x64, 0xEA, 0xFA, 0x63, 0x43, 0xA7, 0xF3, 0xD8, 0x45, 0xDD, 0x63, 0xE5,
+    0x9C, 0x82, 0xF5, 0x86, 0x9D, 0xA2, 0x04, 0x0B, 0x02, 0x58, 0xE7, 0x12, 0x38, 0xFB, 0xA5, 0x66,
+    0xC3, 0x63, 0xE0, 0x5C, 0x68, 0x10, 0x02, 0x82, 0xD5, 0x21, 0x53, 0xF8, 0x38, 0x07, 0x48, 0xF8,
+    0x20, 0xB3, 0x80, 0xE9, 0x37, 0xB3, 0xF2, 0x24, 0x3F, 0xDD, 0x42, 0xC4, 0xBE, 0x87, 0xB1, 0x37,
+    0xEF, 0x41, 0xC4, 0x8E, 0x4D, 0x6C, 0x95, 0xE6, 0xD9, 0xDB, 0x23, 0x43, 0xA5, 0xA9, 0x98, 0x97,
+    0x3E, 0x4D, 0x34, 0xB4, 0x72, 0x18, 0x72, 0xE5, 0x62, 0xAE, 0xE4, 0x2A, 0xF7, 0x6B, 0x5A, 0x44,
+    0x78, 0x6E, 0xBE, 0x27, 0x4C, 0x7D, 0xD2, 0x68, 0x1C, 0xD3, 0xC2, 0x48, 0x7E, 0x59, 0xBC, 0x7B,
+    0xF7, 0x1B, 0x06, 0xFA, 0x15, 0xE2, 0xFC, 0xB9, 0xF4, 0x29, 0x62, 0xB0, 0x0E, 0x7D, 0xF4, 0x5A,
+    0x78, 0x60, 0xE8, 0x64, 0xC9, 0xDD, 0x8E, 0x74, 0xBF, 0xA5, 0x7A, 0xE2, 0x12, 0xA1, 0xE2, 0x48,
+    0x39, 0x38, 0xC7, 0x62, 0xDA, 0x66, 0x00, 0x70, 0x93, 0x4E, 0x4B, 0xAF, 0xF4, 0x5E, 0xD8, 0x7B,
+    0xEA, 0x08, 0x71, 0x16, 0x16, 0x87, 0x30, 0xCF, 0xBF, 0xBF, 0xA3, 0x3D, 0x40, 0xE0, 0x99, 0x71,
+    0xAE, 0x3E, 0x46, 0xF3, 0x59, 0x21, 0x60, 0x34, 0x85, 0xE0, 0x82, 0xAA, 0x0A, 0x8D, 0x86, 0x0E,
+    0x3B, 0x17, 0x7E, 0xDC, 0xB8, 0x51, 0x39, 0xAC, 0x79, 0x99, 0x0A, 0xF3, 0xDE, 0x5F, 0x5C, 0x4C,
+    0x31, 0x73, 0xAB, 0x2A, 0xA7, 0x4D, 0x66, 0xB3, 0xA3, 0x4C, 0x37, 0x7F, 0x88, 0x01, 0xCC, 0x51,
+    0x9A, 0xE4, 0x73, 0x59, 0x1E, 0xE4, 0x91, 0xE9, 0x45, 0x06, 0x01, 0x92, 0xA9, 0x5C, 0x56, 0xDD,
+    0x8E, 0x31, 0xE3, 0x1B, 0xBA, 0x0A, 0xF4, 0x1A, 0x2C, 0x81, 0xD4, 0xA0, 0x21, 0xAD, 0x18, 0xB2,
+    0x4E, 0x52, 0x47, 0xD5, 0xF8, 0xC0, 0x33, 0xB5, 0xC1, 0x19, 0x30, 0x7A, 0x3D, 0x68, 0x1D, 0xFB,
+    0x19, 0x47, 0x66, 0x74, 0x33, 0x4A, 0xBC, 0xAF, 0x86, 0xDF, 0x25, 0x8C, 0x7A, 0xD3, 0x17, 0x74,
+    0x36, 0x51, 0xA0, 0x85, 0x18, 0x0C, 0x07, 0x50, 0xAA, 0x68, 0x96, 0x6E, 0xEE, 0x72, 0x59, 0xC4,
+    0xA3, 0x28, 0x61, 0xC2, 0x89, 0x47, 0x1B, 0xC1, 0x8A, 0x72, 0x3B, 0x94, 0x96, 0x27, 0xD9, 0xD8,
+    0xE8, 0x58, 0xDB, 0x4C, 0x16, 0x17, 0xDF, 0xDE, 0x8D, 0x47, 0x64, 0xF1, 0x38, 0xE9, 0xB7, 0x4E,
+    0x3B, 0xC6, 0x43, 0xA3, 0x7A, 0x9A, 0x01, 0x5A, 0x81, 0x35, 0x6B, 0x03, 0x68, 0x02, 0x76, 0x5B,
+    0x80, 0xC7, 0x39, 0x17, 0x75, 0x9D, 0xA6, 0x94, 0x9A, 0xBE, 0xBA, 0xA6, 0x7A, 0x0E, 0x35, 0xCF,
+    0x9F, 0xC4, 0x5C, 0xAC, 0x8B, 0x7B, 0x6D, 0x5C, 0xF2, 0x7C, 0x40, 0x97, 0x1E, 0xE3, 0x3C, 0xA7,
+    0x95, 0x79, 0xA1, 0xDD, 0xE5, 0x6B, 0x27, 0x25, 0x4A, 0x2C, 0xE5, 0x74, 0xA7, 0x5E, 0xFF, 0x21,
+    0x7E, 0x90, 0x83, 0x69, 0x73, 0x95, 0xBB, 0xB5, 0x08, 0xBD, 0x90, 0x0F, 0x60, 0x32, 0xCC, 0xBB,
+    0x3C, 0x29, 0x28, 0x3E, 0xDA, 0x68, 0xF0, 0x34, 0x50, 0x12, 0x96, 0x83, 0xFE, 0x92, 0x2F, 0x78,
+    0xF5, 0xE5, 0x91, 0x08, 0x3D, 0xDA, 0x68, 0xA7, 0xDC, 0x6A, 0xDB, 0x6F, 0xB6, 0xF7, 0x16, 0x7F,
+    0x1E, 0x91, 0xCC, 0x61, 0x64, 0x7C, 0x19, 0x9E, 0xF3, 0x43, 0xEE, 0x8E, 0x32, 0xEC, 0xE1, 0xC6,
+    0x9F, 0x44, 0x37, 0x20, 0x0D, 0x0B, 0xAC, 0xBC, 0x1F, 0xB5, 0x75, 0x5F, 0x48, 0xE4, 0xF4, 0xCE,
+    0x2D, 0x5A, 0x10, 0x58, 0x86, 0x96, 0x89, 0x4A, 0x89, 0xE4, 0x25, 0xCE, 0xA1, 0xBA, 0x09, 0x2B,
+    0x1E, 0x89, 0x1C, 0x0C, 0xF4, 0x29, 0xFB, 0xAD, 0xF1, 0x0D, 0x64, 0x46, 0xB5, 0x83, 0xD0, 0x61,
+    0x70, 0x89, 0x69, 0x1C, 0x67, 0x53, 0xD1, 0xB7, 0x59, 0x6D, 0xD8, 0xE7, 0xF6, 0x54, 0x6C, 0xBE,
+    0xC0, 0xED, 0xB3, 0x21, 0xB3, 0xDA, 0xA3, 0xFB, 0xB3, 0xDA, 0xA4, 0x8D, 0xA1, 0xAA, 0xD3, 0x3D,
+    0x46, 0x36, 0xCE, 0x40, 0x53, 0x3F, 0x4D, 0x99, 0xA0, 0xA5, 0xBE, 0x46, 0x12, 0x7E, 0xF3, 0x40,
+    0x6C, 0xF1, 0x70, 0x10, 0x3C, 0x01, 0x04, 0x5B, 0x3C, 0x7E, 0xBE, 0x80, 0x48, 0x34, 0x97, 0x8F,
+    0xB5, 0xA6, 0xA4, 0x41, 0x58, 0x3A, 0xFA, 0x4E, 0xC1, 0xD6, 0x48, 0x2F, 0xCB, 0xDE, 0xCF, 0x5A,
+    0x52, 0x46, 0x44, 0xB0, 0x8C, 0x8D, 0xAB, 0xD6, 0xAF, 0x6F, 0xE9, 0x55, 0xCA, 0x2D, 0x0F, 0x7E,
+    0x89, 0x39, 0x99, 0x7D, 0x0D, 0xCC, 0xE9, 0xC6, 0xCC, 0xC9, 0x87, 0x7C, 0xB1, 0x55, 0x6E, 0x5A,
+    0xC9, 0x48, 0xCD, 0x54, 0x32, 0xCC, 0x00, 0x9C, 0x7D, 0x09, 0xC0, 0x13, 0x46, 0x63, 0xE8, 0x98,
+    0xCF, 0xC0, 0x31, 0xEF, 0xC0, 0xBB, 0xBC, 0x01, 0xD5, 0x73, 0xF6, 0x3A, 0xE6, 0x27, 0x8D, 0x01,
+    0x13, 0x09, 0x87, 0xA1, 0xA1, 0x02, 0xB1, 0xBB, 0xE8, 0xF2, 0x34, 0x97, 0x62, 0x14, 0x26, 0xDA,
+    0xB2, 0xC1, 0x03, 0xFB, 0xC1, 0xBB, 0x3E, 0x8C, 0x9A, 0x1C, 0x53, 0xC3, 0xD0, 0x5C, 0x0D, 0xD7,
+    0x5E, 0x8C, 0x67, 0x80, 0xF0, 0x60, 0x85, 0x08, 0xB7, 0x23, 0x84, 0xAD, 0x33, 0x1D, 0x00, 0x9B,
+    0x90, 0xB8, 0xCE, 0x12, 0x2C, 0x13, 0xC3, 0x06, 0xC0, 0xAD, 0x00, 0xBC, 0x12, 0x20, 0x24, 0xC2,
+    0xBF, 0x23, 0xC2, 0xB7, 0x88, 0x70, 0x4B, 0x84, 0x1B, 0x7E, 0x78, 0x48, 0x84, 0x7D, 0x56, 0x1F,
+    0x43, 0x22, 0x6C, 0x3F, 0xAF, 0xB0, 0x5B, 0xDA, 0xBA, 0x45, 0xA2, 0xFA, 0x31, 0xDA, 0xD3, 0xD6,
+    0xCF, 0x2B, 0x44, 0x5E, 0xDA, 0x9F, 0xC1, 0xF4, 0x18, 0x59, 0x23, 0xAC, 0x2E, 0x6A, 0x56, 0xFB,
+    0xA0, 0x5D, 0xD0, 0xD8, 0xE0, 0x11, 0x60, 0x37, 0x84, 0xA1, 0xC6, 0xFB, 0xFC, 0xF4, 0xC0, 0xC8,
+    0x9F, 0x59, 0x64, 0x31, 0x77, 0x99, 0xDE, 0x99, 0x0F, 0xA8, 0xFF, 0x43, 0xB6, 0x5E, 0x9B, 0x14,
+    0x4A, 0x2D, 0x8A, 0x36, 0x9B, 0xB1, 0xA5, 0xA1, 0x33, 0x87, 0x00, 0xC3, 0xD3, 0x76, 0x85, 0xF5,
+    0xC3, 0x0D, 0xA3, 0xDB, 0x61, 0x77, 0x89, 0x67, 0x90, 0x6F, 0x69, 0x09, 0xF4, 0xC4, 0x33, 0xC7,
+    0x30, 0x48, 0x97, 0x75, 0x95, 0xFB, 0x63, 0x18, 0xE4, 0xCB, 0x07, 0x15, 0xD6, 0x9E, 0x05, 0xF7,
+    0xDC, 0x8F, 0x46, 0x0B, 0xAB, 0xEB, 0xAA, 0xF6, 0x74, 0xFE, 0x81, 0x4C, 0xAB, 0x30, 0x62, 0x7A,
+    0x88, 0x09, 0x8A, 0x16, 0xC1, 0x49, 0x58, 0xF2, 0xC3, 0x9A, 0x94, 0x81, 0x24, 0x27, 0x99, 0xB1,
+    0x9F, 0x23, 0x21, 0x45, 0x9A, 0xA7, 0xB6, 0x2E, 0x53, 0x6F, 0x5B, 0x52, 0xCA, 0xAF, 0x59, 0x3E,
+    0xE1, 0x9E, 0xC0, 0x5D, 0x06, 0x68, 0xFF, 0xE3, 0x17, 0x95, 0x3F, 0x71, 0x78, 0xFA, 0x0F, 0x0D,
+    0xDE, 0xEC, 0xA7, 0xB5, 0x2B, 0xA3, 0xD4, 0xCA, 0x19, 0x47, 0xC5, 0xC1, 0x68, 0x63, 0x75, 0x7A,
+    0x30, 0xFA, 0x16, 0xED, 0x38, 0xD1, 0xCD, 0xD8, 0xCD, 0xEF, 0x8D, 0x8A, 0xDD, 0xCE, 0x81, 0x00,
+    0xFC, 0x73, 0xE0, 0x86, 0x52, 0xE7, 0x27, 0x78, 0x21, 0xC7, 0xD0, 0x5E, 0xD0, 0x83, 0x50, 0x07,
+    0xDB, 0x11, 0x70, 0x7B, 0xF4, 0x75, 0x43, 0xD0, 0x59, 0x30, 0x7A, 0xAA, 0x9D, 0x0D, 0xB5, 0xD6,
+    0xE4, 0x71, 0xE5, 0xEC, 0xC0, 0xA3, 0x39, 0xBD, 0xAC, 0x8F, 0x41, 0x9D, 0xF4, 0xC0, 0x29, 0x35,
+    0xC9, 0x9E, 0x26, 0x4B, 0x33, 0x4D, 0x61, 0x67, 0xC8, 0xBB, 0xE4, 0xCD, 0x6E, 0x08, 0x22, 0x69,
+    0x1F, 0xDC, 0xBD, 0x7B, 0xD6, 0xEC, 0xFC, 0x3F, 0xD5, 0x5C, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0x3E,
+    0x00, 0xCC, 0x85, 0x42, 0x24, 0x02, 0x0B, 0xFD, 0x0D, 0x37, 0xE6, 0x4B, 0x91, 0x42, 0xA3, 0x58,
+    0x44, 0x0A, 0x17, 0x2C, 0x96, 0x0B, 0x4C, 0x5A, 0x35, 0x5B, 0x70, 0x9D, 0x34, 0x09, 0xD3, 0xCA,
+    0x33, 0x99, 0x65, 0xC1, 0x82, 0x93, 0x90, 0x0B, 0xD8, 0x2E, 0xDD, 0x6C, 0xE3, 0x3A, 0x4C, 0xC6,
+    0x85, 0xF2, 0x98, 0xC9, 0xAA, 0x60, 0xC1, 0x4C, 0xA8, 0x05, 0xE2, 0x14, 0x29, 0x52, 0x08, 0x63,
+    0x4D, 0xE2, 0x32, 0xC8, 0x88, 0x19, 0xC7, 0x56, 0x61, 0x38, 0x01, 0xC7, 0x58, 0xEA, 0x3D, 0xDC,
+    0x7C, 0xDF, 0xB9, 0x78, 0x7F, 0xCB, 0x15, 0xC5, 0x5D, 0x3D, 0x2E, 0x9F, 0x96, 0xEF, 0x7D, 0xEF,
+    0x0F, 0xB8, 0xB8, 0xF7, 0x3B, 0xF7, 0x9E, 0xBF, 0x7B, 0x40, 0x71, 0x87, 0xC3, 0x44, 0xC4, 0x33,
+    0x26, 0x13, 0x71, 0xB6, 0xB7, 0xE5, 0xC8, 0x9F, 0x5F, 0x12, 0xC3, 0x8A, 0x38, 0xA8, 0x89, 0x51,
+    0x43, 0xBC, 0xDA, 0x12, 0x6F, 0x8D, 0x88, 0xCD, 0x98, 0x58, 0xE7, 0x00, 0xB7, 0x8A, 0x81, 0x5E,
+    0x11, 0xA3, 0x35, 0xBF, 0x18, 0x14, 0x22, 0x41, 0x12, 0xA2, 0x89, 0x50, 0x9B, 0xB8, 0x24, 0x3E,
+    0x9A, 0x88, 0x87, 0xF7, 0xD0, 0x44, 0x6C, 0x0C, 0x4E, 0x7E, 0x20, 0x0E, 0x10, 0x5F, 0x8E, 0xC5,
+    0x01, 0xE6, 0xE2, 0xE2, 0xE0, 0x14, 0x0D, 0xE0, 0x80, 0x2C, 0xC0, 0xFB, 0xB8, 0xD8, 0x39, 0x94,
+    0x73, 0xA6, 0x31, 0x46, 0x02, 0xD3, 0x39, 0xEC, 0x2C, 0xFA, 0x5A, 0xB0, 0xAB, 0xC9, 0x5C, 0x37,
+    0x9D, 0xBC, 0xC3, 0x05, 0x0F, 0xF3, 0x42, 0xC2, 0x32, 0xA8, 0x24, 0x2C, 0xBC, 0x1A, 0xD7, 0xF7,
+    0xD8, 0xE1, 0x29, 0x38, 0x7F, 0x5C, 0x8B, 0x63, 0x4C, 0x2D, 0x61, 0x83, 0x8F, 0x51, 0x06, 0x88,
+    0xF9, 0x43, 0x6A, 0xC1, 0xE7, 0xC7, 0x10, 0x90, 0xBD, 0xD3, 0xC8, 0xC0, 0xFC, 0x7A, 0x2C, 0xBE,
+    0xF9, 0x9E, 0x49, 0xE4, 0x35, 0xB6, 0xEF, 0x66, 0x9E, 0x8E, 0x2B, 0xE4, 0xB5, 0x9E, 0x70, 0xA4,
+    0x92, 0xEB, 0xD8, 0xD7, 0xEF, 0xAE, 0x38, 0x63, 0x85, 0x9B, 0x89, 0x53, 0xF9, 0x68, 0xBD, 0xDB,
+    0x07, 0x63, 0x29, 0x78, 0x92, 0xE0, 0x91, 0x9C, 0x21, 0x77, 0x2B, 0xC6, 0x08, 0xAF, 0x13, 0xE8,
+    0xDC, 0xB9, 0xAD, 0xBD, 0xD3, 0xAE, 0x38, 0xDA, 0x2D, 0xD7, 0xBE, 0xD7, 0x0E, 0x89, 0x69, 0x67,
+    0x3D, 0x7D, 0xA1, 0x1C, 0x51, 0x36, 0x72, 0x99, 0x57, 0x79, 0x48, 0x68, 0xA7, 0xA0, 0x94, 0xA4,
+    0xEC, 0xCD, 0xBA, 0x7E, 0xFE, 0x2E, 0x81, 0xFD, 0x77, 0xF8, 0xD1, 0x23, 0x9F, 0x01, 0xCF, 0xFD,
+    0x9D, 0x85, 0xF9, 0xE7, 0x70, 0x88, 0x83, 0x27, 0x79, 0x29, 0x79, 0x12, 0xD6, 0xEE, 0x48, 0x3C,
+    0x76, 0xC7, 0xAB, 0x41, 0x9E, 0x5B, 0x92, 0x47, 0x89, 0xC0, 0x0C, 0x48, 0x21, 0x64, 0xCF, 0x84,
+    0x62, 0x72, 0xF0, 0x80, 0xA7, 0x85, 0x1C, 0xA8, 0x0F, 0x3E, 0x2E, 0x78, 0xE8, 0xD3, 0x87, 0x62,
+    0x32, 0x0E, 0xC9, 0x98, 0x12, 0x03, 0x61, 0xAF, 0xCE, 0x91, 0xD4, 0x8B, 0x38, 0x31, 0xC6, 0x9B,
+    0x03, 0x3B, 0x08, 0x0F, 0x27, 0xFA, 0x73, 0x0B, 0x15, 0xD3, 0xCF, 0xED, 0x76, 0x40, 0x61, 0x50,
+    0x93, 0x43, 0x90, 0x54, 0xC5, 0x89, 0x23, 0x14, 0xF8, 0xB1, 0xCF, 0xC4, 0x76, 0x00, 0xDD, 0xFE,
+    0xC3, 0xA0, 0x71, 0x6A, 0xD7, 0x98, 0x4A, 0x52, 0x90, 0xE6, 0x6C, 0xE1, 0xD7, 0xF3, 0xDA, 0x49,
+    0xD2, 0x90, 0xB2, 0x6B, 0xED, 0x88, 0xA4, 0x5C, 0xE6, 0x05, 0xFD, 0x95, 0x21, 0xC4, 0x85, 0x7E,
+    0x08, 0x40, 0xC4, 0x00, 0x47, 0x6C, 0x62, 0x48, 0x6D, 0x90, 0x39, 0xA5, 0x53, 0xBC, 0x18, 0x42,
+    0x1C, 0x5D, 0x67, 0xD3, 0xFE, 0x29, 0xE8, 0x0C, 0x91, 0x15, 0x9A, 0x21, 0x89, 0x5D, 0x2D, 0x3C,
+    0x8C, 0x2B, 0xD9, 0x2D, 0x17, 0x3B, 0xB7, 0x4C, 0x42, 0xCE, 0xE1, 0x1F, 0x96, 0xE9, 0xBB, 0xB8,
+    0x4A, 0xCD, 0x25, 0x63, 0xD8, 0xBF, 0x54, 0x07, 0x98, 0xAD, 0x0A, 0x21, 0x4E, 0x26, 0x99, 0xD4,
+    0x7E, 0x21, 0x77, 0x22, 0x9C, 0x89, 0x25, 0x1F, 0xB6, 0x96, 0x98, 0x17, 0x41, 0xC8, 0x6B, 0xF2,
+    0x16, 0xBB, 0x06, 0x95, 0x89, 0x89, 0xF1, 0x2F, 0x5C, 0x39, 0x9E, 0x29, 0x94, 0x00, 0x5D, 0xA3,
+    0x07, 0x47, 0x26, 0x4A, 0x6E, 0xCC, 0x9E, 0xC8, 0x8E, 0x31, 0xF8, 0x19, 0x03, 0xD8, 0x01, 0x1D,
+    0x23, 0xF1, 0x5B, 0xA2, 0x33, 0x26, 0x52, 0xD9, 0x02, 0xD3, 0x84, 0x18, 0x17, 0xC4, 0x68, 0x0E,
+    0x07, 0xE5, 0xF1, 0x38, 0x7F, 0x8C, 0x3D, 0x2B, 0x4E, 0xA6, 0xAD, 0x39, 0x1D, 0xD1, 0xD3, 0x47,
+    0x54, 0xCB, 0xF5, 0xEE, 0x1E, 0x5C, 0x13, 0xF4, 0x44, 0x6D, 0xD6, 0xB9, 0x6D, 0x07, 0x3D, 0x1D,
+    0x18, 0x9A, 0x14, 0xC7, 0x04, 0xEC, 0x7B, 0x1A, 0x26, 0x8A, 0xCA, 0xD5, 0xEF, 0x2A, 0xCA, 0x04,
+    0xF3, 0x36, 0x56, 0xDF, 0x06, 0x18, 0x34, 0x7E, 0xCE, 0xC5, 0xE1, 0x18, 0x95, 0xBE, 0x51, 0xA6,
+    0x72, 0xE5, 0x2C, 0xFD, 0x52, 0xD4, 0x23, 0xED, 0x59, 0x03, 0x6D, 0x21, 0xAC, 0xD9, 0x9A, 0x67,
+    0xBA, 0xF8, 0x91, 0x5E, 0x05, 0x9D, 0x67, 0xC7, 0xBE, 0x12, 0x63, 0x6F, 0x8C, 0xB7, 0xC1, 0x0F,
+    0x5A, 0x48, 0x06, 0xE5, 0x77, 0xF4, 0xFD, 0x72, 0x18, 0xA3, 0xC4, 0x8D, 0x0A, 0xB9, 0xA7, 0xC5,
+    0xD9, 0xCE, 0xAF, 0x91, 0x95, 0xD1, 0x84, 0x2B, 0xC0, 0xDA, 0x56, 0x8C, 0x03, 0x46, 0xB1, 0xF8,
+    0x5D, 0x9E, 0xC2, 0xD0, 0x7A, 0x06, 0x23, 0xC5, 0x78, 0x75, 0xD0, 0x3A, 0x7E, 0xA5, 0xE2, 0x58,
+    0xE0, 0xAF, 0x7A, 0x9C, 0x72, 0xA3, 0xD4, 0x58, 0x66, 0x94, 0x18, 0xE5, 0xE5, 0x9D, 0xE1, 0x5D,
+    0x9A, 0x6B, 0xAC, 0x84, 0xD7, 0xB7, 0xB7, 0x16, 0x67, 0x98, 0x29, 0x48, 0x57, 0x81, 0xBE, 0x07,
+    0x1C, 0x98, 0x47, 0x70, 0xA7, 0x20, 0x72, 0x14, 0xC6, 0x68, 0xC0, 0x65, 0xE7, 0xF1, 0xEE, 0x9A,
+    0x1C, 0x7B, 0xC8, 0x04, 0x6E, 0x12, 0xEE, 0x13, 0x1A, 0x34, 0xEF, 0xD6, 0xD7, 0xBB, 0xE1, 0x7E,
+    0xCD, 0x4B, 0xD6, 0x74, 0x24, 0xD1, 0x48, 0xB1, 0xE0, 0x46, 0xEA, 0x4A, 0xCB, 0x0B, 0xBF, 0xD6,
+    0x95, 0xD6, 0x0C, 0x32, 0x77, 0x84, 0x95, 0x06, 0x4E, 0x64, 0x14, 0x0F, 0x87, 0x23, 0x7A, 0x1B,
+    0xF1, 0xF6, 0xF6, 0xB5, 0xF9, 0x95, 0x36, 0xB0, 0x2B, 0xED, 0xF7, 0xFD, 0xC6, 0x69, 0x16, 0x56,
+    0xDA, 0xB7, 0xE5, 0x86, 0xC8, 0x06, 0xBD, 0x92, 0xE8, 0x1E, 0xD6, 0x59, 0xC8, 0x65, 0xE6, 0xFC,
+    0xA3, 0xAC, 0xC2, 0xD0, 0xE1, 0x11, 0xAA, 0x43, 0x48, 0x7F, 0x30, 0x86, 0x16, 0x3A, 0xFF, 0x48,
+    0x5E, 0x08, 0x05, 0x72, 0x61, 0xEA, 0xC4, 0x74, 0x53, 0xB8, 0xB5, 0x0A, 0x14, 0xA8, 0x11, 0xA2,
+    0x8E, 0x0D, 0xFA, 0xE7, 0xB1, 0x46, 0x68, 0x39, 0x34, 0xBC, 0xBC, 0x31, 0xCA, 0xBB, 0xEA, 0x52,
+    0x4F, 0x5C, 0x45, 0xF5, 0xC2, 0x2D, 0x34, 0xAA, 0xF8, 0xF9, 0x65, 0x5E, 0x2E, 0x77, 0xBC, 0x0F,
+    0xAC, 0x2B, 0xAD, 0x6E, 0x1F, 0x9F, 0xB8, 0x86, 0xD7, 0xDD, 0x85, 0x66, 0xC1, 0x97, 0xAF, 0x27,
+    0xF2, 0xE7, 0xF8, 0x27, 0x1B, 0x2E, 0x3E, 0x0C, 0xDE, 0xA3, 0x5F, 0x4F, 0xB3, 0xE3, 0x75, 0x33,
+    0x9F, 0xFB, 0x65, 0x2F, 0x8D, 0xC4, 0xC9, 0x9C, 0x1A, 0x1E, 0xD3, 0x43, 0x8C, 0x92, 0x3A, 0x3D,
+    0x6C, 0xEC, 0x18, 0x5E, 0xC8, 0xF2, 0x58, 0xDB, 0x53, 0x77, 0x4D, 0x03, 0x8C, 0x48, 0xC7, 0x7F,
+    0x67, 0x57, 0x03, 0x12, 0x1A, 0x34, 0x37, 0x73, 0x8B, 0xA7, 0xAC, 0x31, 0x4E, 0x08, 0xBB, 0x7D,
+    0x6B, 0x3E, 0x3A, 0xE5, 0xCC, 0xC0, 0x55, 0x11, 0xD9, 0xD5, 0x49, 0x7C, 0x45, 0xD4, 0x55, 0xD1,
+    0x2B, 0xF6, 0x4E, 0x88, 0x75, 0x4A, 0x8E, 0xC7, 0xC8, 0xD4, 0x40, 0xDF, 0x94, 0xF4, 0x59, 0x8C,
+    0x1E, 0x9F, 0x6B, 0x0B, 0x07, 0x1A, 0x67, 0x1D, 0xE8, 0x34, 0x39, 0x50, 0xC6, 0xE0, 0x17, 0xE4,
+    0x19, 0x71, 0xD0, 0xDD, 0x83, 0xB4, 0x5C, 0x6B, 0x5A, 0x74, 0x10, 0xF4, 0x6F, 0xC5, 0x67, 0xEF,
+    0x43, 0xAE, 0xF4, 0x38, 0x62, 0x18, 0x43, 0xBB, 0x5C, 0x39, 0xB3, 0x35, 0x05, 0x46, 0xA3, 0x0E,
+    0x7E, 0x57, 0xB7, 0xF3, 0xF3, 0xD2, 0xAB, 0xFD, 0x2A, 0xF1, 0x2B, 0xF8, 0x57, 0x41, 0x89, 0x78,
+    0x0B, 0xD0, 0xF6, 0xEF, 0x2A, 0x80, 0x57, 0xE3, 0x07, 0xB7, 0x65, 0xD4, 0x96, 0x73, 0x72, 0xFC,
+    0xE5, 0x8F, 0x71, 0x1D, 0xF5, 0x53, 0x38, 0x1C, 0x8F, 0x97, 0xC5, 0xD5, 0x1B, 0xFE, 0xDA, 0xF1,
+    0x1D, 0x6C, 0x0E, 0x94, 0x58, 0xB2, 0x89, 0xAE, 0x65, 0x57, 0xD1, 0x07, 0x7D, 0x97, 0x50, 0x7A,
+    0xB4, 0x48, 0x0F, 0x25, 0x78, 0xB2, 0x5F, 0x33, 0x78, 0x43, 0x53, 0x1A, 0x09, 0xF7, 0xA1, 0x30,
+    0x74, 0x5F, 0x2F, 0xCE, 0xA7, 0xA2, 0xE1, 0x95, 0x65, 0x5A, 0xA3, 0x86, 0x9A, 0x3C, 0x1C, 0xEC,
+    0x33, 0xC8, 0xA2, 0x35, 0x5F, 0x9B, 0xEB, 0xFA, 0x4A, 0x90, 0xAC, 0x9A, 0xB5, 0x8F, 0x89, 0xAD,
+    0x9E, 0xE9, 0x7D, 0xD9, 0xA3, 0x1A, 0x76, 0xA5, 0xA9, 0xD6, 0x41, 0x78, 0x13, 0xDF, 0xDD, 0x82,
+    0x5B, 0x1D, 0xE9, 0xF9, 0x8A, 0xF0, 0xBD, 0xC2, 0x2C, 0xF6, 0xF9, 0x30, 0x95, 0x7F, 0x50, 0x4E,
+    0x63, 0x53, 0x51, 0x87, 0x5D, 0x5E, 0xD5, 0x5F, 0xBF, 0xA1, 0xF8, 0x0A, 0x61, 0x63, 0x9A, 0x93,
+    0x69, 0x27, 0xB9, 0x18, 0xB7, 0x5E, 0x35, 0xBE, 0xAD, 0xD2, 0xEE, 0xB5, 0x76, 0xAF, 0xB6, 0x65,
+    0x77, 0x53, 0xA6, 0x8A, 0x9B, 0x06, 0xAA, 0x78, 0x7A, 0x96, 0xD7, 0x3E, 0x2E, 0xB3, 0x63, 0xEE,
+    0xAE, 0xE1, 0x92, 0x8C, 0x05, 0xA3, 0x52, 0xE9, 0x83, 0x40, 0x4E, 0xF0, 0x32, 0xDE, 0xDE, 0xDE,
+    0x29, 0xB4, 0xC7, 0x66, 0xF6, 0xE9, 0xC4, 0xAD, 0xD8, 0x17, 0xED, 0x44, 0x21, 0xD7, 0xCD, 0x9E,
+    0x93, 0x1F, 0xB2, 0x83, 0x81, 0xA1, 0x46, 0x79, 0xC7, 0xE6, 0xBE, 0x12, 0x8D, 0x17, 0x94, 0xAE,
+    0x4F, 0x6B, 0x15, 0x19, 0x65, 0xF2, 0x4D, 0xF9, 0x16, 0xCC, 0xB8, 0xCA, 0x36, 0xD5, 0x8C, 0x94,
+    0xAF, 0xE8, 0x2A, 0x3A, 0x5F, 0x88, 0x3C, 0xD6, 0x39, 0x64, 0xF3, 0xCE, 0xE7, 0x59, 0x5A, 0x30,
+    0x5E, 0xC1, 0x44, 0xC0, 0x1C, 0xC5, 0x94, 0x02, 0x06, 0xD5, 0x04, 0xDB, 0x93, 0x21, 0x46, 0x82,
+    0xC9, 0xBD, 0x6E, 0x92, 0xE0, 0x10, 0x56, 0xB5, 0x0A, 0xCC, 0xF3, 0xF0, 0xFC, 0x06, 0x69, 0xFB,
+    0x77, 0x75, 0x31, 0x70, 0xE4, 0x77, 0xEC, 0xA7, 0xB3, 0xE6, 0xF9, 0x8B, 0x38, 0x64, 0x08, 0x88,
+    0xEF, 0x19, 0x3D, 0x5A, 0x7F, 0x65, 0xCA, 0xE1, 0xDA, 0x16, 0x31, 0x1F, 0x33, 0xFD, 0xFC, 0x84,
+    0x1E, 0x84, 0x49, 0xD0, 0x2A, 0x62, 0xCA, 0x9E, 0xC3, 0xD3, 0x32, 0xF9, 0x34, 0x87, 0x4C, 0xD2,
+    0x44, 0x6D, 0x20, 0xBB, 0xE6, 0xCF, 0xE4, 0x43, 0x4C, 0xF0, 0xAD, 0xB5, 0x99, 0xE6, 0x8B, 0xE0,
+    0x60, 0xAD, 0x9B, 0xFF, 0xA1, 0x52, 0xA0, 0x4A, 0x58, 0xCE, 0x13, 0x6D, 0xBD, 0x09, 0xAD, 0xC1,
+    0xB6, 0x9F, 0x75, 0xED, 0x10, 0xC7, 0xAD, 0x99, 0x3E, 0x64, 0x8D, 0x4F, 0xF8, 0x4C, 0x13, 0x9C,
+    0xFB, 0x08, 0x6D, 0x8C, 0xE4, 0xBB, 0xC3, 0x3D, 0x48, 0x61, 0x7B, 0x12, 0x86, 0xE2, 0x3D, 0xA6,
+    0x0B, 0x1D, 0xC1, 0x53, 0x3D, 0x70, 0x22, 0x44, 0x8B, 0x46, 0x86, 0xC3, 0x3D, 0x78, 0x77, 0xD3,
+    0x66, 0xE1, 0x3D, 0xAE, 0x8F, 0x54, 0x0F, 0x3F, 0xC7, 0x03, 0x62, 0x5C, 0x37, 0x7B, 0xB1, 0xA9,
+    0x6F, 0xC8, 0xDD, 0x5B, 0x4E, 0x15, 0xDF, 0x2B, 0x06, 0x26, 0x73, 0x0F, 0x65, 0xB9, 0x3D, 0xEC,
+    0x1B, 0xDF, 0x47, 0xE3, 0xC9, 0xB4, 0xF1, 0xD3, 0xF5, 0x73, 0x59, 0x5D, 0x92, 0x07, 0x0C, 0x15,
+    0xE0, 0x2E, 0x86, 0x99, 0x3E, 0xF0, 0x1E, 0x31, 0xB9, 0xC9, 0x18, 0x3A, 0xEA, 0x91, 0xEC, 0xD8,
+    0xFD, 0x99, 0x1E, 0x3D, 0x5D, 0x6F, 0x61, 0x54, 0x1C, 0xA6, 0xEB, 0xF5, 0x42, 0x05, 0x67, 0xBD,
+    0x67, 0x4A, 0x9A, 0xAD, 0x0B, 0x5C, 0x76, 0x76, 0x14, 0xF2, 0xE3, 0x05, 0x6D, 0xBD, 0x94, 0xD1,
+    0x9D, 0x96, 0xDB, 0x5F, 0x6B, 0xF4, 0xF3, 0x37, 0xB9, 0xC9, 0x18, 0xFE, 0x34, 0x9A, 0x42, 0xAA,
+    0xCF, 0x08, 0x3D, 0x45, 0xF4, 0x1F, 0x48, 0x6D, 0x5A, 0xCF, 0x4C, 0xF8, 0x3C, 0x06, 0xBA, 0x2E,
+    0xAD, 0x53, 0xA1, 0x6E, 0xC3, 0xF9, 0x6E, 0xBA, 0xC7, 0x73, 0x81, 0x79, 0x68, 0x2A, 0x77, 0xB4,
+    0x18, 0x56, 0x56, 0xCD, 0xDF, 0x17, 0xFF, 0x68, 0x1E, 0x3A, 0x1E, 0x39, 0xA6, 0x5C, 0x1F, 0x39,
+    0x79, 0x69, 0x0F, 0xE9, 0x21, 0x38, 0x05, 0x80, 0xBB, 0xA0, 0x04, 0x7B, 0x41, 0x09, 0xFE, 0xD4,
+    0xD3, 0x50, 0x08, 0x67, 0xA0, 0x19, 0xD9, 0xAC, 0x57, 0x06, 0x6B, 0xE3, 0x7E, 0x04, 0x17, 0x13,
+    0x26, 0x6C, 0xF3, 0xDA, 0x79, 0xDC, 0x7A, 0xE5, 0xD5, 0xF3, 0x72, 0xBE, 0xF7, 0x34, 0x8C, 0x59,
+    0x33, 0x4F, 0xF8, 0x53, 0xF4, 0xD5, 0x1F, 0x19, 0x1F, 0x08, 0x04, 0x53, 0xA6, 0x42, 0xA2, 0x46,
+    0x52, 0xF4, 0xE2, 0x03, 0x44, 0x91, 0x70, 0xAF, 0x92, 0xF0, 0xE3, 0xE2, 0xB2, 0x5B, 0xDF, 0x94,
+    0x9B, 0xBD, 0x86, 0xEB, 0x24, 0xE8, 0xD4, 0xA5, 0xDA, 0x3D, 0xF9, 0x03, 0x67, 0x7D, 0xA4, 0x8B,
+    0xA6, 0x95, 0xA8, 0x92, 0xDD, 0x84, 0xD2, 0x0B, 0x39, 0x8F, 0xEE, 0x06, 0x3A, 0x8F, 0xFA, 0xB9,
+    0x69, 0xE5, 0xAC, 0xD6, 0x69, 0xA0, 0x36, 0x66, 0x43, 0xB1, 0x21, 0x32, 0x6A, 0x77, 0x47, 0x58,
+    0x87, 0xC0, 0x48, 0x83, 0xE5, 0xBC, 0x60, 0x68, 0xCD, 0x4C, 0x81, 0x6B, 0x3E, 0xE6, 0x31, 0x86,
+    0xE6, 0xCC, 0x1D, 0x31, 0x95, 0x88, 0xB3, 0xB0, 0x50, 0x81, 0xB1, 0x9A, 0xD8, 0x81, 0xB6, 0x1C,
+    0x68, 0xAA, 0xD3, 0x1B, 0x73, 0x1E, 0xC1, 0x44, 0x61, 0x1E, 0x49, 0xFA, 0x88, 0x0B, 0x3D, 0x68,
+    0x17, 0xA5, 0x6F, 0x3D, 0x41, 0x15, 0x89, 0x44, 0xFA, 0x8D, 0xEE, 0x80, 0x59, 0x27, 0x50, 0x33,
+    0x47, 0x6A, 0x23, 0xD5, 0x44, 0xAA, 0x85, 0x54, 0x03, 0xE9, 0x1C, 0x0B, 0x9E, 0x69, 0x9C, 0xD6,
+    0x35, 0x15, 0x3E, 0xA6, 0xFC, 0xAE, 0x05, 0xB8, 0x34, 0x70, 0x58, 0xEF, 0x4E, 0x3B, 0xE0, 0x21,
+    0xBB, 0xEA, 0x81, 0xD0, 0xA7, 0xE1, 0xDE, 0xB1, 0x51, 0xA3, 0x09, 0xBB, 0x87, 0x73, 0xD1, 0xCF,
+    0x16, 0xF3, 0x07, 0xA7, 0x69, 0x2E, 0x35, 0x2E, 0x60, 0x0B, 0xC3, 0x16, 0xA6, 0xD0, 0xED, 0x16,
+    0x66, 0x2B, 0x61, 0x73, 0xEA, 0xA1, 0x3E, 0x98, 0xA4, 0x56, 0x18, 0x2A, 0xA4, 0xEC, 0x41, 0xC4,
+    0x1E, 0xB8, 0xCB, 0xEE, 0x81, 0x86, 0xD7, 0x41, 0x3D, 0x21, 0x2C, 0x9E, 0x76, 0xA0, 0x3A, 0xEA,
+    0x5F, 0x32, 0xEB, 0x8C, 0x83, 0xBD, 0x67, 0x65, 0x3E, 0x4E, 0x0E, 0xB3, 0x5C, 0x89, 0x42, 0x7D,
+    0x34, 0xC9, 0xB4, 0x76, 0x97, 0x0B, 0x0C, 0x33, 0x7C, 0x93, 0x1B, 0xA9, 0x08, 0xF9, 0x21, 0xB5,
+    0xBC, 0xD5, 0x8C, 0x37, 0x39, 0x38, 0xD5, 0x43, 0x27, 0xEA, 0xBA, 0xD9, 0xCA, 0xD5, 0xCE, 0xBC,
+    0x9C, 0x71, 0xCD, 0xFD, 0xE9, 0xA6, 0xC8, 0x68, 0xBA, 0x29, 0xCB, 0xDF, 0x34, 0x98, 0xA0, 0xE4,
+    0x97, 0x3B, 0xDA, 0x7E, 0x33, 0xAA, 0x15, 0x8D, 0x61, 0x18, 0xAD, 0x40, 0x69, 0x3A, 0x2A, 0xDD,
+    0x30, 0x03, 0x0B, 0x21, 0xD7, 0xF1, 0x80, 0xC7, 0xBF, 0x6B, 0x57, 0x2E, 0xE0, 0xF7, 0x5E, 0x20,
+    0x0B, 0xAF, 0x6F, 0x9D, 0xC3, 0xF0, 0x22, 0x8C, 0x6F, 0x13, 0x03, 0xDC, 0x40, 0xCF, 0xAE, 0xE0,
+    0x79, 0x43, 0x97, 0xDD, 0x57, 0x7A, 0x8E, 0xEC, 0xE5, 0x31, 0x6A, 0x9D, 0xB9, 0x27, 0x90, 0xB2,
+    0xA3, 0xAA, 0x86, 0x29, 0xC0, 0x68, 0x0A, 0x41, 0x72, 0xEA, 0xF1, 0x71, 0xEF, 0xC6, 0xEA, 0x17,
+    0xF7, 0xB9, 0xFA, 0xEE, 0x70, 0x35, 0x17, 0x4E, 0x1B, 0x15, 0xF6, 0x35, 0x48, 0x96, 0x3B, 0x3E,
+    0x9F, 0x00, 0x4B, 0xE1, 0x76, 0xEC, 0x92, 0xC9, 0xFA, 0x1F, 0xC2, 0xD1, 0xA4, 0xDE, 0xE4, 0x6F,
+    0x4F, 0x34, 0xBE, 0x6B, 0x74, 0x98, 0xDC, 0x67, 0x7B, 0x1E, 0xE3, 0xFB, 0x02, 0xFD, 0x6E, 0x12,
+    0xEE, 0x1D, 0x8D, 0xE4, 0xED, 0xA3, 0xBF, 0xF2, 0xA1, 0x7E, 0x49, 0xD3, 0x6F, 0xEE, 0xDB, 0xAC,
+    0xE6, 0x64, 0xAF, 0x50, 0x97, 0x84, 0xA7, 0x6E, 0xC0, 0xFC, 0x36, 0xBF, 0xEA, 0x24, 0x38, 0x2E,
+    0x66, 0xBC, 0x83, 0x0E, 0xE4, 0x87, 0x1E, 0xB7, 0xCC, 0x32, 0x17, 0x71, 0x0B, 0x84, 0x05, 0xFD,
+    0x07, 0xFC, 0x55, 0x4D, 0xFC, 0x59, 0x43, 0xFC, 0x44, 0x85, 0x58, 0x76, 0x8A, 0x69, 0x42, 0x8C,
+    0x0B, 0x62, 0x58, 0x11, 0x83, 0x86, 0xE8, 0x8D, 0x88, 0xD2, 0x29, 0xE6, 0xEF, 0x11, 0xE3, 0x7F,
+    0x23, 0x0E, 0x3E, 0x23, 0x06, 0x86, 0xE8, 0x29, 0xC2, 0xF2, 0x30, 0xE5, 0x9D, 0x27, 0xD7, 0x0F,
+    0x19, 0xD8, 0xC3, 0x91, 0x62, 0x84, 0x2F, 0xF2, 0x77, 0xB3, 0xF2, 0x0E, 0xAF, 0x99, 0xAB, 0x4C,
+    0xD1, 0xFE, 0xBE, 0x7D, 0xD4, 0x3F, 0x69, 0xB8, 0x1B, 0xBB, 0xDE, 0xB2, 0x32, 0xCA, 0xE9, 0x8A,
+    0x48, 0x53, 0x21, 0x74, 0x70, 0x3A, 0xF5, 0x81, 0x46, 0x3D, 0x7A, 0x27, 0x47, 0x28, 0x7B, 0x8F,
+    0x31, 0xD7, 0x1E, 0xEC, 0x24, 0x1C, 0x16, 0xCF, 0x64, 0x2B, 0xC8, 0xD5, 0xDC, 0x5F, 0x9F, 0xCD,
+    0x53, 0xA5, 0xA7, 0x5B, 0xAE, 0x7D, 0x51, 0x41, 0x38, 0x97, 0xC1, 0x39, 0x6B, 0xC6, 0x16, 0x7B,
+    0xD8, 0xE7, 0xB5, 0x92, 0xA9, 0xA5, 0x96, 0xAB, 0x8A, 0x57, 0xA6, 0xDE, 0x84, 0x08, 0xF7, 0xD9,
+    0x61, 0xA4, 0x7C, 0x1E, 0x7A, 0x55, 0x5D, 0x8E, 0x81, 0xEE, 0x4D, 0x85, 0xA3, 0xD9, 0x18, 0x57,
+    0x78, 0xF6, 0x6A, 0x2D, 0x83, 0x2D, 0x66, 0xE8, 0xAB, 0x19, 0x6C, 0x39, 0x83, 0xAD, 0x67, 0x38,
+    0x52, 0xD0, 0x70, 0xB6, 0xB2, 0xB8, 0xD4, 0x5F, 0xD2, 0xA6, 0xBD, 0x62, 0x9B, 0xE9, 0x8D, 0xCA,
+    0xB9, 0xDA, 0x2F, 0x9B, 0x79, 0xC3, 0xA7, 0xBF, 0x1E, 0x0D, 0x58, 0x6A, 0x11, 0x8C, 0x52, 0xF0,
+    0xD8, 0x4A, 0x57, 0x0D, 0x2A, 0xD8, 0xD1, 0x3C, 0xD3, 0xA8, 0x22, 0xB7, 0xAB, 0xF2, 0x60, 0xF2,
+    0xE2, 0x7E, 0x95, 0x17, 0xA3, 0x2A, 0xDD, 0x37, 0x7B, 0x6E, 0x97, 0x48, 0x64, 0x1A, 0x08, 0x0E,
+    0xBA, 0xFE, 0x29, 0x99, 0x66, 0x4F, 0xC9, 0xB4, 0x25, 0xFE, 0xD4, 0xCA, 0xD4, 0x58, 0x99, 0x66,
+    0xC4, 0xC8, 0xCA, 0xB4, 0x26, 0xFA, 0x2D, 0xD1, 0xB5, 0x32, 0x35, 0x8A, 0xE9, 0x0F, 0x89, 0x91,
+    0xCA, 0x34, 0xFC, 0x9C, 0xE8, 0xAB, 0x34, 0x5D, 0x45, 0xB1, 0x32, 0x4D, 0x55, 0xA6, 0x91, 0xCA,
+    0xD4, 0x66, 0x41, 0x83, 0x39, 0xB4, 0xEB, 0xC9, 0xE2, 0x40, 0xA6, 0x0E, 0xE7, 0xDA, 0x68, 0x16,
+    0x71, 0xF5, 0x82, 0x55, 0xB9, 0x5A, 0xB1, 0xAA, 0x54, 0x55, 0xA8, 0x23, 0x0B, 0xDE, 0x73, 0x83,
+    0x4A, 0x92, 0x82, 0xAC, 0x29, 0xC7, 0x69, 0x2D, 0x9B, 0x3F, 0x05, 0xBD, 0xA6, 0x06, 0x50, 0x5C,
+    0x60, 0x5A, 0x3F, 0x40, 0xD1, 0xAC, 0x0D, 0x87, 0x36, 0x4A, 0xD2, 0xF2, 0x82, 0xA3, 0x25, 0xA3,
+    0xA0, 0x98, 0xE2, 0x67, 0x35, 0x0D, 0x3A, 0xE7, 0xC3, 0x95, 0x69, 0x69, 0x44, 0xD8, 0x60, 0xAA,
+    0x33, 0x30, 0xCE, 0xD8, 0x5A, 0xA4, 0x73, 0x72, 0xA0, 0x29, 0xE6, 0xB0, 0x64, 0x0C, 0x19, 0x56,
+    0x8A, 0xF5, 0x17, 0x60, 0xA5, 0x47, 0x56, 0xF6, 0x2C, 0xB6, 0x30, 0x28, 0x6C, 0x6B, 0x74, 0x8F,
+    0xE3, 0xFE, 0x2A, 0x60, 0x82, 0x6F, 0xE2, 0x5F, 0xF0, 0xEA, 0xB6, 0xC6, 0xC6, 0x56, 0x1D, 0x0D,
+    0x87, 0x19, 0x5D, 0x6F, 0x7C, 0xBB, 0x58, 0x38, 0x0A, 0xBB, 0x9C, 0xC0, 0xDC, 0xEE, 0x57, 0xE8,
+    0x20, 0x26, 0x0C, 0xBC, 0xEC, 0x31, 0xD7, 0xD2, 0x2E, 0xAD, 0x5C, 0x2C, 0x9A, 0x03, 0x26, 0x24,
+    0xC7, 0x80, 0x3D, 0x04, 0x07, 0xA7, 0xF6, 0xB4, 0x80, 0xB1, 0xAE, 0xDB, 0x5D, 0xE7, 0x40, 0xB5,
+    0x9A, 0x96, 0x01, 0x8C, 0xA7, 0xB5, 0x68, 0xB6, 0x70, 0xD4, 0x7B, 0xF2, 0xD1, 0xAC, 0xB0, 0xF0,
+    0x0F, 0xF6, 0xBE, 0x16, 0xBC, 0x7D, 0xD9, 0xAE, 0xD3, 0x8B, 0x67, 0x50, 0xDE, 0xF9, 0x23, 0xE6,
+    0x66, 0x52, 0x9D, 0x91, 0x63, 0xCE, 0x46, 0xB7, 0xA1, 0xA6, 0x47, 0xC4, 0xAE, 0x2B, 0xE7, 0xFE,
+    0xD7, 0x82, 0xC7, 0xB5, 0xBD, 0xF7, 0x79, 0x1D, 0x1C, 0x11, 0x7D, 0x1F, 0x07, 0xEC, 0xD2, 0x9A,
+    0xB6, 0x21, 0x4B, 0x73, 0x2F, 0x9D, 0x29, 0x99, 0x53, 0x92, 0x34, 0xFD, 0x4D, 0x9A, 0xB4, 0x56,
+    0xC9, 0x90, 0x9F, 0x28, 0x41, 0xDF, 0xF1, 0x1A, 0x26, 0x00, 0x3E, 0x92, 0xB0, 0xB2, 0xAF, 0x18,
+    0xAE, 0xD2, 0x1F, 0xF5, 0xAF, 0xF1, 0xE4, 0x35, 0x9B, 0xBD, 0x3E, 0xDE, 0xDE, 0xD2, 0x57, 0x86,
+    0x4F, 0xF3, 0x9F, 0x17, 0x8E, 0x3B, 0xD2, 0xCE, 0xA4, 0x5D, 0x7B, 0x1D, 0x29, 0x03, 0xBD, 0xAE,
+    0x53, 0xD9, 0x7E, 0xD0, 0x5E, 0xEA, 0xF5, 0x61, 0x2B, 0x7F, 0xB1, 0xFF, 0x64, 0x98, 0x53, 0xA7,
+    0xF2, 0xAF, 0xEC, 0x49, 0x9D, 0xB1, 0xD6, 0x49, 0xC4, 0xAD, 0xF9, 0xFD, 0xD2, 0xE4, 0x25, 0x98,
+    0xFB, 0x4D, 0xE3, 0xD7, 0x20, 0xC1, 0x94, 0x6E, 0x4B, 0x42, 0x0A, 0x19, 0x91, 0x9C, 0x4C, 0xC6,
+    0xB1, 0x4C, 0x5F, 0x86, 0x43, 0x7D, 0x31, 0xA6, 0xE3, 0xCB, 0x8F, 0x74, 0xD7, 0x9E, 0xAE, 0xAD,
+    0x3D, 0x44, 0xD9, 0x2C, 0xD4, 0xAE, 0xA6, 0x85, 0x46, 0xDF, 0xF0, 0x92, 0xDF, 0x0A, 0x2A, 0xF7,
+    0xF3, 0x56, 0x1E, 0x80, 0xD5, 0x8A, 0xC3, 0x4C, 0x4D, 0x12, 0xD1, 0xBE, 0x82, 0x59, 0xDD, 0xD0,
+    0xBF, 0x3B, 0x4B, 0x8A, 0x59, 0x7B, 0xBC, 0x39, 0x57, 0x61, 0x5C, 0x3E, 0xB5, 0x27, 0xC4, 0x0D,
+    0xA5, 0x1D, 0xC3, 0xE9, 0x0A, 0xE7, 0x3B, 0x4F, 0x6C, 0x68, 0x23, 0x9A, 0x35, 0x9B, 0xC3, 0xFA,
+    0xA9, 0x6F, 0xF4, 0x98, 0x98, 0xC7, 0x43, 0x83, 0x53, 0x94, 0x5C, 0x13, 0x18, 0xBB, 0x66, 0x6F,
+    0x6A, 0xCD, 0xE4, 0x30, 0x7C, 0x18, 0xB9, 0x63, 0x9B, 0xA5, 0x51, 0x4C, 0x6D, 0xAE, 0xA6, 0xE8,
+    0xDB, 0xF4, 0x34, 0x57, 0x73, 0x1D, 0xCA, 0xDF, 0x24, 0x1A, 0xA3, 0x14, 0xEA, 0x1E, 0x33, 0x58,
+    0xA0, 0x11, 0xA0, 0x9B, 0x37, 0x58, 0x74, 0x8A, 0x4D, 0x69, 0xCA, 0x9D, 0x4F, 0x4C, 0xED, 0x7F,
+    0xE6, 0xD7, 0xDE, 0xD8, 0x43, 0xB0, 0xE1, 0x72, 0xBE, 0xA8, 0x45, 0xE0, 0x29, 0xCF, 0x7A, 0x72,
+    0xBF, 0x70, 0xA7, 0xDB, 0x12, 0xD6, 0x3F, 0xAC, 0xDE, 0xB8, 0x17, 0x2A, 0x7F, 0x14, 0x55, 0x4F,
+    0xDB, 0xA0, 0xDF, 0x4A, 0xAF, 0xCF, 0xB7, 0x24, 0x4B, 0xE6, 0x62, 0xDE, 0xC3, 0xA6, 0x46, 0x20,
+    0xED, 0xCC, 0xBF, 0x85, 0x13, 0xBF, 0x7A, 0x8B, 0x05, 0x33, 0x72, 0x5B, 0x37, 0x9F, 0x23, 0x4D,
+    0x01, 0x85, 0x5A, 0xC5, 0xE7, 0x8D, 0x67, 0x9B, 0x43, 0x2B, 0x3C, 0xA7, 0xDE, 0x92, 0x57, 0xA0,
+    0x4D, 0x6E, 0x8B, 0xFF, 0x53, 0x5C, 0x91, 0x4D, 0x52, 0x11, 0xA5, 0xCB, 0x9F, 0x53, 0x9A, 0xCA,
+    0xE5, 0x26, 0x0F, 0x55, 0xB0, 0xD3, 0xD8, 0x90, 0x74, 0x6D, 0x51, 0x41, 0x78, 0x18, 0x4D, 0x08,
+    0xE5, 0x10, 0x25, 0x6E, 0x13, 0xE3, 0x20, 0xAC, 0xF3, 0xBD, 0xB8, 0x4F, 0x5F, 0xD3, 0x59, 0xD5,
+    0xBA, 0x5B, 0xAE, 0x66, 0xDA, 0x67, 0x5D, 0xD6, 0x6C, 0x78, 0xD0, 0xF6, 0x51, 0xFB, 0xF8, 0x15,
+    0x3C, 0x37, 0x30, 0x35, 0xEE, 0x60, 0x62, 0xA4, 0x2C, 0xF8, 0xC9, 0xBC, 0x7A, 0xF0, 0xDF, 0x3B,
+    0xA5, 0x4B, 0x2D, 0xAF, 0xEA, 0xE8, 0x83, 0xD9, 0xFA, 0x09, 0xFB, 0xF5, 0x73, 0x65, 0x5E, 0xE5,
+    0x36, 0x12, 0xFE, 0xC7, 0x58, 0x35, 0xF8, 0xA6, 0x5C, 0x86, 0x4E, 0x7F, 0xCB, 0x6E, 0x4F, 0x95,
+    0x36, 0x12, 0xF1, 0x79, 0x39, 0x56, 0xFB, 0xFB, 0xBA, 0xC9, 0x95, 0x7C, 0x43, 0x06, 0xD9, 0x15,
+    0xCC, 0x86, 0xDB, 0xF0, 0xFE, 0xEF, 0xF0, 0xAC, 0x1F, 0x41, 0xA7, 0xF3, 0x98, 0xD7, 0xFA, 0xB2,
+    0x1B, 0xEE, 0x41, 0x47, 0x7D, 0x59, 0x79, 0x13, 0x66, 0x4E, 0x39, 0xB7, 0xEF, 0x7C, 0x16, 0xE3,
+    0x25, 0xE5, 0x5A, 0x20, 0x80, 0x19, 0xF4, 0xB8, 0x41, 0x68, 0x72, 0x5B, 0xA6, 0x29, 0xF4, 0x65,
+    0x8F, 0xF7, 0x2C, 0xC6, 0x44, 0x27, 0x9C, 0x1E, 0xAF, 0xFA, 0xDB, 0xBC, 0x15, 0xE3, 0x8E, 0xD5,
+    0x01, 0x4C, 0x11, 0xD9, 0x20, 0x6B, 0x79, 0x63, 0x62, 0x9A, 0x7B, 0x33, 0xB1, 0x55, 0xE2, 0x0C,
+    0x0C, 0x7A, 0x05, 0xC0, 0x6A, 0x6C, 0xD6, 0xC3, 0x4D, 0x0B, 0xD1, 0x6E, 0x47, 0x7D, 0x21, 0x5A,
+    0xBB, 0x58, 0x88, 0x76, 0x06, 0xF2, 0x7D, 0x45, 0x7E, 0x0B, 0x6B, 0x77, 0x43, 0xBC, 0xFF, 0x6A,
+    0xEC, 0xA9, 0x54, 0x95, 0x71, 0xF2, 0x42, 0xE4, 0x0B, 0x2B, 0x6C, 0xC6, 0x84, 0x6E, 0x13, 0x51,
+    0xE0, 0xE6, 0x6D, 0xC0, 0xA5, 0x5B, 0x80, 0x57, 0x6F, 0xB2, 0xF0, 0xC4, 0x6E, 0x13, 0x2F, 0x11,
+    0xDE, 0x60, 0x91, 0x4A, 0xAC, 0x7E, 0xA2, 0xEE, 0x37, 0x50, 0x12, 0xB6, 0x60, 0x7F, 0xEE, 0x8E,
+    0x9E, 0xAA, 0x2F, 0x8E, 0xD7, 0xFA, 0xC4, 0x9B, 0xBA, 0x0D, 0xD9, 0x30, 0xB4, 0x1C, 0x98, 0x36,
+    0x35, 0x2D, 0x34, 0xD4, 0x97, 0x3E, 0x5C, 0xDD, 0xBA, 0x13, 0xF3, 0x27, 0xA4, 0x01, 0xE1, 0x5E,
+    0xB8, 0xA7, 0x4A, 0xAB, 0x15, 0xDD, 0x1F, 0x60, 0xF8, 0x0E, 0xA9, 0x68, 0x49, 0xBE, 0x56, 0xE4,
+    0xFB, 0x3F, 0xA9, 0x27, 0xF5, 0xF8, 0x9A, 0xDF, 0xD8, 0x5D, 0x88, 0xE7, 0x5F, 0x1A, 0x43, 0x4C,
+    0x3B, 0x30, 0x23, 0x14, 0xD9, 0xAC, 0xCA, 0x4D, 0xA8, 0xB4, 0xFB, 0x37, 0xD4, 0x2C, 0x32, 0xCE,
+    0x06, 0x1B, 0x70, 0x83, 0x5A, 0xAB, 0xB1, 0x4F, 0xF0, 0x74, 0x9B, 0x3E, 0x8F, 0x09, 0x76, 0x74,
+    0x96, 0x38, 0xC9, 0x69, 0xC7, 0xE8, 0x0E, 0xCD, 0x10, 0x26, 0x47, 0xED, 0xC0, 0xE9, 0xC6, 0xF8,
+    0x4C, 0xE9, 0xBE, 0xF9, 0x78, 0x2B, 0x36, 0xCD, 0x9B, 0x87, 0x5B, 0xCF, 0x92, 0x2E, 0x8B, 0xDC,
+    0x5F, 0xB3, 0xB7, 0x92, 0x64, 0x20, 0xC7, 0xFB, 0xD5, 0x63, 0x2E, 0x68, 0x35, 0x79, 0xE7, 0xE4,
+    0xF2, 0x62, 0x3E, 0x2D, 0x65, 0xD2, 0x64, 0xBC, 0x63, 0x2A, 0x37, 0x6F, 0x69, 0x4E, 0xA1, 0xBA,
+    0xB9, 0xC2, 0x13, 0x45, 0x59, 0x2E, 0x8A, 0xC5, 0xB1, 0x5A, 0xA3, 0x5C, 0x1D, 0xD2, 0x98, 0x7B,
+    0xA6, 0x18, 0xE7, 0x7E, 0xAD, 0x76, 0x5E, 0x2B, 0x7D, 0xA6, 0x00, 0xFD, 0xC0, 0x78, 0x75, 0xD3,
+    0x5C, 0x07, 0xDE, 0x60, 0x0A, 0x49, 0xB6, 0xDC, 0x23, 0xF5, 0x91, 0x71, 0xEB, 0x60, 0x5C, 0x51,
+    0x2B, 0x79, 0xC5, 0x1C, 0x4B, 0x78, 0xF2, 0xC2, 0x9D, 0x1E, 0x27, 0x05, 0x2B, 0x0C, 0xA3, 0xE0,
+    0xA6, 0x54, 0x8C, 0xD7, 0xFE, 0x8A, 0xC1, 0x94, 0xF9, 0x94, 0xB4, 0x98, 0x1F, 0xB0, 0x73, 0x36,
+    0x6A, 0x61, 0xF8, 0xDE, 0xC7, 0xEF, 0x47, 0x03, 0xF8, 0x55, 0xE5, 0xF3, 0xE2, 0xF0, 0x83, 0xBE,
+    0x62, 0x86, 0x37, 0x3D, 0x5C, 0x7B, 0xF9, 0x1C, 0xDA, 0xDB, 0xCE, 0x34, 0x96, 0xB7, 0xF7, 0x82,
+    0x6A, 0xF5, 0xFF, 0x62, 0xFD, 0xFF, 0x0A, 0xF3, 0xF9, 0xDB, 0x1A, 0x8C, 0x84, 0xAA, 0xB1, 0xC3,
+    0x5F, 0xCE, 0x4A, 0xD8, 0xE5, 0x1F, 0x92, 0x97, 0xCF, 0x6D, 0xBF, 0xA9, 0xAD, 0xFE, 0xF8, 0xA6,
+    0x6A, 0x98, 0xFB, 0x01, 0xF1, 0x43, 0xDD, 0x15, 0xB1, 0xEF, 0xED, 0xF7, 0x61, 0xFB, 0xB5, 0x60,
+    0x7B, 0x72, 0x63, 0x1C, 0xDF, 0xFB, 0x9F, 0x69, 0x1E, 0x50, 0xB7, 0x3E, 0x43, 0xF9, 0x70, 0xFA,
+    0xDE, 0x7E, 0xDF, 0xDF, 0x3B, 0xF6, 0x72, 0xF9, 0xD7, 0xF4, 0x8A, 0xCD, 0xAF, 0x48, 0xFC, 0x03,
+    0x52, 0xAC, 0x19, 0x16, 0x4D, 0xB1, 0x20, 0xF4, 0xFE, 0xE6, 0xD7, 0x83, 0xF3, 0xF7, 0xB5, 0xBA,
+    0xD4, 0xE6, 0xB8, 0x98, 0xB8, 0x80, 0xCB, 0x47, 0x27, 0x20, 0xCC, 0xB4, 0xF8, 0xF2, 0x68, 0x06,
+    0xE1, 0xEC, 0x79, 0x8E, 0x99, 0x46, 0xEF, 0x22, 0xF3, 0xC8, 0xC9, 0x0F, 0x9D, 0x4E, 0x6C, 0x9E,
+    0x89, 0x9B, 0x41, 0xCB, 0xC7, 0xA4, 0xC7, 0x03, 0x65, 0x0F, 0x91, 0x5D, 0xA4, 0xBC, 0x3D, 0x64,
+    0x7F, 0xF6, 0x1B, 0xB5, 0x05, 0xD9, 0xB4, 0x2A, 0xDB, 0x6E, 0x47, 0x0D, 0x66, 0x85, 0x1A, 0x13,
+    0xB4, 0xDF, 0x6B, 0xC4, 0xCC, 0x72, 0x8E, 0x33, 0x66, 0xCC, 0x76, 0xE8, 0xE1, 0xDC, 0xFD, 0xE5,
+    0xF5, 0x6C, 0xAB, 0xC9, 0x16, 0x7C, 0x8A, 0xB1, 0xB7, 0x7F, 0x58, 0xD7, 0xFE, 0xFD, 0x69, 0x5C,
+    0x3C, 0xF5, 0xB1, 0xFB, 0x90, 0xCE, 0xFF, 0x59, 0xEF, 0xFC, 0x87, 0x89, 0xCD, 0x47, 0x40, 0x19,
+    0xBE, 0xFD, 0x05, 0x05, 0xF5, 0x25, 0x7E, 0xF1, 0x4D, 0xB3, 0x63, 0xF6, 0xC0, 0xDE, 0x9A, 0x79,
+    0xE4, 0x6B, 0x31, 0x78, 0x9F, 0xA2, 0x34, 0x2C, 0xB4, 0x71, 0xB5, 0x38, 0x07, 0xDE, 0x1C, 0xEF,
+    0x49, 0x04, 0x8F, 0x1B, 0x9A, 0xB7, 0xFC, 0xCF, 0x82, 0xA5, 0x25, 0xB9, 0x78, 0x1F, 0x17, 0x74,
+    0x87, 0x52, 0xF1, 0xDF, 0xAB, 0xB8, 0xCE, 0xE3, 0x24, 0xF0, 0x6B, 0x7D, 0x93, 0x85, 0x5E, 0x4D,
+    0xC6, 0xA3, 0xE2, 0x92, 0xD7, 0x30, 0xC4, 0x0E, 0xCB, 0x77, 0xDD, 0xD6, 0xD3, 0xBC, 0xE8, 0x86,
+    0x33, 0xE2, 0xD6, 0x5A, 0x50, 0x6F, 0xC8, 0x38, 0xD0, 0xDB, 0xAB, 0x6E, 0xC9, 0x81, 0x66, 0xBD,
+    0x9B, 0xFB, 0xF6, 0xEE, 0x4C, 0xB7, 0xAD, 0x25, 0xBE, 0xA4, 0x3B, 0xB0, 0x78, 0xF3, 0x17, 0x7A,
+    0x73, 0x18, 0xA4, 0xA1, 0xFC, 0x60, 0x9C, 0x76, 0x1F, 0x8E, 0x77, 0xD8, 0xB7, 0xBD, 0xEC, 0xB4,
+    0xEE, 0x85, 0x21, 0x47, 0x7F, 0x3B, 0xEC, 0xC5, 0x5E, 0xD1, 0xA4, 0x3D, 0x29, 0x7D, 0x02, 0xC5,
+    0xFD, 0x5F, 0x4B, 0x09, 0x03, 0x50, 0x5B, 0x58, 0x7E, 0xFE, 0x18, 0x5E, 0x8C, 0x91, 0x4B, 0x98,
+    0x0A, 0x59, 0xDE, 0x49, 0x94, 0x04, 0x5D, 0xA2, 0x77, 0xE2, 0xC3, 0xE7, 0x43, 0xDB, 0x68, 0x8F,
+    0x77, 0xFB, 0xCA, 0x3F, 0x95, 0x52, 0xD1, 0xB3, 0xFB, 0x79, 0xC5, 0x7D, 0x9B, 0xD6, 0xF9, 0x84,
+    0xB6, 0xD2, 0x19, 0xB9, 0x3F, 0x69, 0x3C, 0x4C, 0xA4, 0xB1, 0xF7, 0xBD, 0x96, 0xDA, 0xFC, 0xC0,
+    0x4F, 0x46, 0xA1, 0xBD, 0xE3, 0xF4, 0x23, 0xBE, 0xC6, 0xAF, 0xCA, 0x2E, 0xF5, 0x4B, 0xFC, 0xA7,
+    0x12, 0x7F, 0x8B, 0xD3, 0xED, 0xEF, 0x25, 0x52, 0x1B, 0xF5, 0x40, 0x06, 0x0F, 0x6C, 0xA9, 0xB8,
+    0xDE, 0x06, 0x8C, 0xD1, 0xE8, 0x80, 0xA0, 0x97, 0x6C, 0x24, 0x77, 0x3E, 0x9B, 0x89, 0x3E, 0xD5,
+    0x21, 0xB4, 0xBA, 0xB1, 0xCF, 0x5B, 0xD8, 0x79, 0x0F, 0xFB, 0xA2, 0x5A, 0x8D, 0x59, 0xCE, 0x55,
+    0x45, 0xE6, 0xEE, 0x79, 0x53, 0x31, 0xFB, 0x93, 0x52, 0x78, 0x56, 0x60, 0x0C, 0x1E, 0xC0, 0x52,
+    0xAD, 0x37, 0x88, 0x52, 0x2A, 0x15, 0x45, 0xE2, 0xD7, 0x14, 0x83, 0xC7, 0xEA, 0x23, 0x0C, 0x42,
+    0xE3, 0x9C, 0x03, 0xBD, 0xFB, 0x2E, 0xAE, 0x67, 0xFB, 0x73, 0x7D, 0x41, 0xFE, 0x73, 0xA0, 0x86,
+    0x47, 0xE7, 0xF2, 0xC3, 0x44, 0x77, 0x7E, 0xB2, 0x7E, 0xB6, 0xDA, 0x3D, 0x21, 0x7E, 0x0C, 0xFE,
+    0x95, 0x71, 0x9F, 0xA3, 0x37, 0x1B, 0xBC, 0xBD, 0x30, 0x1F, 0x05, 0x2E, 0x75, 0x27, 0x79, 0x03,
+    0x16, 0xC2, 0x42, 0xD3, 0xCB, 0xE0, 0x58, 0xD5, 0xE3, 0x25, 0xAE, 0x9E, 0xAB, 0xDC, 0xB2, 0xDB,
+    0xE0, 0xFC, 0xBC, 0xC5, 0x61, 0x30, 0xA6, 0x28, 0x98, 0x41, 0xF9, 0x67, 0xE6, 0xC3, 0x3E, 0x65,
+    0x00, 0xF6, 0x7F, 0xAC, 0x42, 0xFB, 0x3C, 0x99, 0xAC, 0x0B, 0x75, 0x5A, 0xEE, 0x2C, 0xDC, 0x2C,
+    0xE0, 0x4C, 0xC3, 0xB6, 0x60, 0x72, 0x8F, 0xF6, 0x7A, 0x37, 0x25, 0xD7, 0x29, 0x2F, 0xEA, 0xCF,
+    0xB1, 0xDE, 0x7A, 0xCE, 0x1F, 0xDD, 0x6A, 0x70, 0xDC, 0xDA, 0x59, 0x3D, 0x8E, 0xCF, 0xEF, 0x4D,
+    0x6F, 0x3E, 0x9F, 0xE8, 0x12, 0x1D, 0xAB, 0x9B, 0x1D, 0x0D, 0x0E, 0x33, 0x85, 0x4D, 0xF6, 0x75,
+    0x83, 0x15, 0xF6, 0x1B, 0x0C, 0xF3, 0xAF, 0xD8, 0x7B, 0x57, 0xC2, 0x7A, 0xD2, 0x0A, 0xAB, 0x0F,
+    0x95, 0x45, 0x0E, 0xCC, 0x26, 0x02, 0x74, 0x52, 0x52, 0x85, 0xD9, 0x0D, 0xDC, 0x74, 0xC2, 0xB3,
+    0x46, 0x67, 0x3E, 0x22, 0xD5, 0x92, 0xE9, 0xC2, 0x12, 0x7D, 0xF3, 0xB8, 0x59, 0xE2, 0x17, 0xF9,
+    0x2F, 0x87, 0x79, 0x61, 0x6B, 0xE3, 0xF5, 0x76, 0x81, 0xDC, 0xA6, 0x49, 0x34, 0x85, 0x51, 0x4C,
+    0xEE, 0xEB, 0xE8, 0xCB, 0xC5, 0x4D, 0x8D, 0x6E, 0xD5, 0x57, 0x31, 0xB2, 0x2B, 0x90, 0xCA, 0xB7,
+    0xF5, 0x58, 0xE6, 0x26, 0x5B, 0x7B, 0x5D, 0x5A, 0x3A, 0xCA, 0x63, 0xF6, 0xF5, 0x05, 0x7C, 0x7D,
+    0x03, 0x5F, 0x43, 0x4C, 0x4E, 0x9D, 0x1A, 0x96, 0x80, 0x71, 0x9B, 0xFB, 0xC2, 0xA4, 0x70, 0x43,
+    0x7B, 0x65, 0x4B, 0x38, 0xEE, 0x1F, 0x23, 0xBF, 0x97, 0xC4, 0x83, 0xD3, 0x97, 0x9C, 0xD2, 0x1E,
+    0xF0, 0xB9, 0xB6, 0xB8, 0x1B, 0xBF, 0x34, 0x1E, 0x34, 0x1D, 0xAC, 0xD9, 0x60, 0x4D, 0x06, 0x6B,
+    0x2E, 0x58, 0x53, 0xC1, 0x6E, 0xBB, 0x0A, 0x3C, 0xB8, 0x89, 0x93, 0xB8, 0x55, 0x98, 0xC8, 0xC3,
+    0x4D, 0x9B, 0xB6, 0xE2, 0xFF, 0xF6, 0x12, 0x54, 0xCB, 0xE7, 0xC1, 0x19, 0x26, 0xD0, 0xE5, 0x15,
+    0x9C, 0xBC, 0x5A, 0x46, 0xB0, 0xAA, 0x23, 0x47, 0x7D, 0xB7, 0xE5, 0x15, 0xA6, 0x5D, 0x83, 0xDE,
+    0x6A, 0xE5, 0xFF, 0x01, 0xED, 0x5B, 0x31, 0x90, 0xDC, 0xD8, 0x71, 0x6D, 0x00, 0xE4, 0x42, 0xE6,
+    0x94, 0x0F, 0x0C, 0xEE, 0x54, 0xA7, 0x5B, 0x9B, 0x70, 0x70, 0x81, 0xEA, 0x44, 0x12, 0x89, 0x02,
+    0x06, 0xCB, 0x05, 0x64, 0x85, 0x4A, 0xE8, 0x2A, 0x6D, 0xC9, 0x91, 0xA9, 0x40, 0x81, 0xEF, 0x92,
+    0x51, 0xB0, 0xC1, 0x5A, 0x5E, 0x12, 0x38, 0x39, 0x70, 0xBA, 0x81, 0x9D, 0x33, 0xB8, 0xE0, 0x6A,
+    0x58, 0xA5, 0x65, 0xB0, 0x81, 0xAE, 0x6A, 0xB9, 0x80, 0x2E, 0x55, 0x60, 0x94, 0x55, 0x65, 0x87,
+    0x86, 0x2C, 0xAA, 0x5C, 0xBE, 0x0B, 0x0C, 0xBB, 0x20, 0x17, 0x76, 0x85, 0xC1, 0x57, 0xBF, 0xEE,
+    0x0F, 0xCC, 0xEC, 0x90, 0xBC, 0xBB, 0xA5, 0xA9, 0xBD, 0xA5, 0xCA, 0x53, 0x3B, 0xFD, 0x7B, 0x67,
+    0x06, 0x1F, 0xFF, 0xF7, 0xEF, 0xDF, 0xDD, 0xAF, 0xFB, 0x83, 0x88, 0x5F, 0x5F, 0x23, 0x79, 0xC5,
+    0x09, 0xB9, 0x66, 0x4E, 0x71, 0x46, 0xD1, 0x49, 0x5E, 0x86, 0x09, 0x19, 0xF2, 0x9B, 0x80, 0xBC,
+    0x96, 0x68, 0x7E, 0x8D, 0xFC, 0x9A, 0x28, 0x6D, 0x28, 0xA8, 0xF8, 0x87, 0x05, 0x85, 0x05, 0x51,
+    0x54, 0xE0, 0x8F, 0xC2, 0x12, 0x1F, 0xE0, 0x0B, 0xBE, 0x72, 0x6C, 0xEA, 0xCF, 0x68, 0xAA, 0xE1,
+    0x02, 0x7B, 0x39, 0x3A, 0xE3, 0xB7, 0x74, 0x9D, 0xD1, 0x84, 0x6F, 0x14, 0x93, 0xDE, 0x96, 0x47,
+    0xD5, 0x0B, 0x47, 0xF1, 0x7F, 0xE6, 0x25, 0x37, 0xBE, 0xE9, 0x65, 0xAC, 0x97, 0x13, 0x1D, 0x33,
+    0xFD, 0x94, 0xDF, 0x8E, 0x7C, 0xD6, 0xD3, 0xD4, 0x24, 0xB7, 0xDD, 0x7E, 0xBF, 0xDA, 0xF0, 0x6B,
+    0xB7, 0x3D, 0x08, 0x0A, 0x32, 0x45, 0x94, 0x51, 0x8A, 0x89, 0xC5, 0xE8, 0x52, 0x49, 0xF2, 0x0C,
+    0xA2, 0x3F, 0x91, 0x1F, 0xF3, 0x65, 0x73, 0x9A, 0x54, 0x4E, 0x47, 0x6E, 0x7F, 0x17, 0x73, 0x36,
+    0x3C, 0x64, 0xE7, 0x8E, 0xBD, 0xDD, 0x9A, 0xDE, 0x37, 0x28, 0x53, 0x53, 0x7B, 0x26, 0xA8, 0xA6,
+    0xA6, 0x72, 0x73, 0xBF, 0x74, 0x79, 0xA4, 0x81, 0x57, 0xF0, 0x45, 0x14, 0xF8, 0x99, 0x34, 0x3F,
+    0x21, 0x69, 0x9E, 0x68, 0x43, 0x2F, 0xB7, 0x21, 0xDB, 0xF0, 0x6D, 0x43, 0x6E, 0x72, 0xA2, 0x4D,
+    0xC8, 0xA8, 0xC4, 0xE7, 0x14, 0x9A, 0x7D, 0x1E, 0x37, 0xAF, 0xA5, 0x91, 0xC1, 0x3A, 0x83, 0xA8,
+    0x9C, 0x06, 0xD4, 0xEB, 0x94, 0xC6, 0xAD, 0x63, 0xCA, 0x2E, 0x6A, 0x29, 0xAF, 0x0E, 0xDC, 0x96,
+    0x82, 0x5F, 0xD6, 0x4E, 0x4B, 0x13, 0x93, 0x81, 0x36, 0x04, 0x5A, 0x7D, 0x31, 0xDA, 0x59, 0x8A,
+    0xE5, 0xEB, 0x28, 0x64, 0x6A, 0xE8, 0x6F, 0xB1, 0x86, 0xE6, 0x57, 0x90, 0x8A, 0xF9, 0x3B, 0x0C,
+    0x63, 0x90, 0x1F, 0xBF, 0xBE, 0x4F, 0x7F, 0x36, 0xB0, 0x1B, 0x4E, 0x3D, 0xB0, 0xE1, 0x77, 0x8A,
+    0x81, 0x9D, 0x98, 0x61, 0xC4, 0xE4, 0xF5, 0xE3, 0x65, 0x4E, 0x47, 0xCF, 0x79, 0xE5, 0xC6, 0xEC,
+    0xB1, 0x36, 0x1A, 0x63, 0x8A, 0xA9, 0xC1, 0xA4, 0x63, 0xB0, 0x3C, 0xCF, 0x69, 0x85, 0x05, 0x4F,
+    0x13, 0xB7, 0x23, 0xBF, 0xA5, 0xDB, 0x18, 0x18, 0xB3, 0xCE, 0x9C, 0x36, 0x88, 0x17, 0x8C, 0x59,
+    0x16, 0xDC, 0x06, 0xD4, 0x0B, 0x6C, 0x9A, 0x88, 0x82, 0x82, 0x8D, 0x55, 0x2D, 0xC1, 0x42, 0x43,
+    0xF9, 0xDF, 0x81, 0x65, 0x41, 0x83, 0xE5, 0x2F, 0xA1, 0x73, 0x96, 0x85, 0x44, 0x2D, 0xEB, 0x37,
+    0x23, 0xCB, 0x7D, 0x0D, 0x97, 0xE1, 0x4A, 0xCB, 0xA6, 0x19, 0x0D, 0xB7, 0x30, 0x64, 0xD9, 0xC4,
+    0x99, 0x5B, 0x36, 0x97, 0xBE, 0x4A, 0x0C, 0xB2, 0xC7, 0x3E, 0x70, 0x2A, 0x66, 0x3D, 0x11, 0xAA,
+    0x5B, 0x72, 0x1B, 0xD5, 0xB8, 0xD0, 0x2B, 0xEF, 0xF6, 0x0F, 0x59, 0x2B, 0xD3, 0x4F, 0x66, 0xFB,
+    0x25, 0x4F, 0xFE, 0x89, 0x88, 0xC0, 0x94, 0x56, 0x4E, 0x89, 0x93, 0x59, 0xAE, 0x9E, 0x64, 0x2A,
+    0x1B, 0x3A, 0x8C, 0x49, 0x45, 0x43, 0xB1, 0x74, 0xC8, 0x92, 0xA1, 0xA0, 0x21, 0x15, 0x0C, 0xD6,
+    0x4F, 0xE5, 0x42, 0xE3, 0x38, 0x06, 0x2E, 0x4D, 0x58, 0xAE, 0xB5, 0x8E, 0x78, 0xE0, 0xA2, 0xE2,
+    0x26, 0x2F, 0xB6, 0x72, 0x1B, 0xFC, 0xD6, 0x09, 0xDF, 0xE2, 0xBD, 0x63, 0xA7, 0xCE, 0x5B, 0xD1,
+    0x72, 0xDC, 0x0C, 0x92, 0xA9, 0x07, 0x11, 0x04, 0xD5, 0x92, 0x5C, 0xAC, 0x2C, 0xD2, 0x41, 0x14,
+    0xD4, 0x0F, 0x23, 0x60, 0x7A, 0x55, 0x05, 0xC1, 0x97, 0x7E, 0x53, 0xE5, 0xC0, 0x97, 0x1E, 0xA8,
+    0x18, 0xF8, 0xD2, 0x46, 0xA5, 0xC0, 0x8B, 0xDD, 0xA8, 0x10, 0x52, 0xE6, 0xD8, 0x32, 0x6C, 0x11,
+    0x0B, 0x20, 0xC3, 0x36, 0x20, 0x6A, 0x7C, 0x16, 0xBD, 0xC3, 0xCC, 0xBD, 0x08, 0x33, 0xE2, 0xDB,
+    0x44, 0x73, 0xCB, 0x04, 0xAD, 0x65, 0xFC, 0xDA, 0x32, 0xFA, 0xB2, 0x4C, 0xDE, 0xC6, 0xDC, 0x83,
+    0x69, 0x3C, 0x63, 0x94, 0x99, 0x34, 0x7E, 0x4E, 0x11, 0x2F, 0x6B, 0x50, 0x70, 0x87, 0xD7, 0xD9,
+    0x60, 0xB1, 0xB9, 0x00, 0xC3, 0x16, 0x24, 0x11, 0x89, 0x19, 0xD1, 0x36, 0xD1, 0x54, 0x65, 0xBC,
+    0xC6, 0x32, 0xBC, 0x94, 0xCA, 0xB0, 0x95, 0x53, 0x46, 0xEC, 0x0D, 0x98, 0x5C, 0xF8, 0x1C, 0x17,
+    0xBD, 0x2E, 0x1D, 0xF2, 0x45, 0xB7, 0x42, 0xDC, 0x82, 0x2F, 0xDA, 0x09, 0x6A, 0xBE, 0x29, 0x5F,
+    0xD4, 0x7A, 0xA6, 0x8F, 0x9F, 0xF0, 0x54, 0x5B, 0x0C, 0xAC, 0xC3, 0x9C, 0xC7, 0x7D, 0x9D, 0x1B,
+    0xD9, 0x6C, 0xED, 0xD4, 0x3C, 0x20, 0xFA, 0x86, 0x79, 0xA2, 0x1B, 0x5C, 0x54, 0x9D, 0x86, 0xA5,
+    0x38, 0xAF, 0x76, 0xDB, 0xB6, 0x07, 0x2B, 0x6D, 0x0D, 0x33, 0xCE, 0xBA, 0x80, 0xF6, 0x6E, 0x3F,
+    0xDB, 0x47, 0x0B, 0x9D, 0x45, 0xAB, 0xAF, 0xD5, 0x76, 0x6E, 0x5B, 0xBB, 0xEB, 0xDD, 0x56, 0x5B,
+    0x5D, 0x2C, 0x72, 0x72, 0xD5, 0x76, 0xF7, 0x78, 0x58, 0x36, 0x15, 0x86, 0xD7, 0x88, 0x34, 0x3C,
+    0x15, 0x86, 0xD7, 0x8A, 0x2C, 0x64, 0x17, 0x0D, 0x0A, 0xBD, 0xD2, 0xA4, 0x8D, 0x34, 0xD3, 0x56,
+    0x1A, 0x4F, 0x1B, 0xF7, 0xC5, 0x9A, 0x6D, 0x6D, 0x0E, 0x4E, 0x35, 0xEC, 0x89, 0x64, 0xE2, 0x6E,
+    0x2B, 0xF3, 0x76, 0x5B, 0x99, 0xB6, 0x9D, 0x8E, 0xDB, 0x2C, 0x37, 0x9E, 0x6D, 0xEA, 0xE5, 0x99,
+    0x06, 0xA5, 0xCE, 0x37, 0xB1, 0x52, 0x78, 0xE3, 0x0E, 0x39, 0xAC, 0x03, 0xEC, 0xA6, 0x78, 0xE7,
+    0xF2, 0xDE, 0x6B, 0x59, 0x3D, 0x60, 0x88, 0x13, 0x07, 0x5D, 0x2E, 0x13, 0xCF, 0xF0, 0x17, 0x6E,
+    0x8E, 0x6F, 0xE5, 0x27, 0xC1, 0x8B, 0x10, 0xDE, 0x73, 0xD8, 0xDF, 0x41, 0xB1, 0x6E, 0xEE, 0x04,
+    0x05, 0x0B, 0x37, 0x80, 0x99, 0x5E, 0x21, 0x21, 0x0C, 0x4E, 0x94, 0xD8, 0xCD, 0x33, 0xE9, 0x74,
+    0xD8, 0x79, 0x83, 0x70, 0x22, 0x34, 0xF3, 0x29, 0xCF, 0x3F, 0x3F, 0x9E, 0x18, 0x1E, 0x11, 0x7F,
+    0x91, 0x51, 0x9E, 0xB9, 0x6C, 0x89, 0x26, 0xBC, 0x03, 0x12, 0xD7, 0x14, 0xC2, 0x90, 0xFB, 0x5F,
+    0xB5, 0x65, 0xFE, 0xB5, 0xB1, 0xCC, 0x2F, 0x3A, 0xCB, 0x94, 0xFD, 0xC0, 0xA4, 0x89, 0x65, 0xE2,
+    0xC2, 0x32, 0x41, 0x65, 0x99, 0x49, 0x63, 0x19, 0xAF, 0xB3, 0x0C, 0xF5, 0x03, 0x93, 0x7F, 0xC7,
+    0x32, 0xF1, 0xCF, 0x2D, 0x13, 0x7E, 0x6A, 0x19, 0xF8, 0x1A, 0x61, 0xBC, 0x81, 0x71, 0x84, 0xF1,
+    0xD8, 0x40, 0xE6, 0x60, 0xEE, 0x1E, 0x27, 0xBA, 0x59, 0x73, 0xB6, 0x35, 0xA1, 0xEC, 0x5A, 0x1B,
+    0x2D, 0x3D, 0xC5, 0x8C, 0x26, 0x24, 0xA7, 0x15, 0x25, 0x76, 0x07, 0xDF, 0xB5, 0x5F, 0x0D, 0x6A,
+    0x3E, 0xBA, 0xB8, 0xAB, 0x83, 0xA2, 0xAB, 0xBC, 0x1C, 0x2B, 0x2E, 0xA7, 0xB3, 0xD2, 0x3A, 0xB0,
+    0xC2, 0x22, 0x2B, 0xAB, 0x41, 0x54, 0x56, 0x52, 0x51, 0xA7, 0x82, 0x5A, 0xEF, 0x54, 0x4E, 0x4E,
+    0x67, 0xC5, 0xD4, 0x59, 0x29, 0x75, 0x56, 0x48, 0x9D, 0x95, 0x51, 0x67, 0x45, 0xD4, 0x59, 0x09,
+    0x75, 0x56, 0x40, 0x9D, 0x95, 0x4F, 0x67, 0xC5, 0xD3, 0x59, 0xE9, 0x74, 0x56, 0x38, 0x9D, 0x95,
+    0x4D, 0x67, 0x45, 0xD3, 0x59, 0xC9, 0x74, 0x56, 0x30, 0xDD, 0xE9, 0x0D, 0xBB, 0xDA, 0x0E, 0xEE,
+    0xDB, 0xEA, 0xFA, 0xA0, 0xDE, 0x94, 0x17, 0xA7, 0x45, 0x75, 0x69, 0x45, 0xAA, 0x69, 0x72, 0xBA,
+    0xBD, 0xF9, 0xBC, 0x28, 0x80, 0xE2, 0x86, 0x6D, 0xFB, 0xC4, 0xD0, 0x7A, 0x6B, 0x4C, 0xB6, 0x66,
+    0xD8, 0x73, 0x14, 0x91, 0x98, 0x5B, 0x23, 0x11, 0x27, 0x4C, 0x8B, 0x2F, 0x76, 0xB8, 0x1B, 0x5B,
+    0xEF, 0x65, 0xB4, 0xEC, 0x37, 0xA5, 0x5D, 0x37, 0x7B, 0xDE, 0x1C, 0xA1, 0x24, 0x22, 0xC3, 0x2C,
+    0x5E, 0x99, 0xC7, 0xF3, 0xDA, 0xA3, 0xD3, 0xE2, 0xF9, 0x86, 0x15, 0x0F, 0xE2, 0x64, 0xF5, 0xE4,
+    0xF0, 0xE2, 0xEA, 0xC1, 0x49, 0xBC, 0x37, 0x89, 0xE7, 0x26, 0xF1, 0xDA, 0x2B, 0x2F, 0x5F, 0x6C,
+    0x45, 0x20, 0x9F, 0x87, 0x22, 0xDF, 0x48, 0x7E, 0x79, 0x5B, 0xAC, 0xCD, 0x8E, 0x5C, 0xDB, 0x88,
+    0xA0, 0x6B, 0xA8, 0xA8, 0x5B, 0xA1, 0x4F, 0xAF, 0xC0, 0xBD, 0xFC, 0x02, 0x41, 0xF8, 0x24, 0x81,
+    0xB9, 0x09, 0xA4, 0x0B, 0x8D, 0xF8, 0xE3, 0xD9, 0xC3, 0x06, 0xDE, 0xC5, 0x74, 0x08, 0xB5, 0x1D,
+    0x31, 0xE5, 0xBC, 0x56, 0x88, 0xDB, 0x72, 0xEC, 0x16, 0x56, 0x7A, 0x0F, 0x21, 0x52, 0x36, 0x29,
+    0xE1, 0xC8, 0xA7, 0xC7, 0x74, 0xD9, 0x34, 0x86, 0x9D, 0x97, 0xE9, 0x75, 0xF8, 0x32, 0xFA, 0x5D,
+    0x78, 0xDF, 0x48, 0xEC, 0x42, 0xBB, 0xB4, 0xF6, 0x76, 0xEA, 0x39, 0xDB, 0x7C, 0xFF, 0x98, 0x15,
+    0x21, 0x28, 0x79, 0x4E, 0x41, 0xC1, 0xD2, 0xF4, 0x0B, 0xB1, 0x82, 0x23, 0x71, 0xBE, 0xC7, 0xC1,
+    0x10, 0xDC, 0x45, 0xD0, 0xF0, 0xBF, 0x51, 0x26, 0x02, 0x67, 0x92, 0x2A, 0x91, 0xF5, 0x14, 0x74,
+    0xF1, 0x4E, 0xC3, 0xCE, 0xFA, 0xBF, 0xE7, 0x8C, 0x13, 0xDE, 0x67, 0x5D, 0x7D, 0x9D, 0x10, 0x79,
+    0x7E, 0x7F, 0xD7, 0xAD, 0xA2, 0xA0, 0x08, 0xD8, 0xB7, 0xCE, 0x47, 0x47, 0x02, 0xB7, 0xC9, 0x4E,
+    0xC2, 0xEB, 0x6C, 0x8C, 0x72, 0xD6, 0x3F, 0xBE, 0xF0, 0xAE, 0xD9, 0xE3, 0x4E, 0x38, 0x9C, 0xE5,
+    0x30, 0x96, 0xC3, 0x57, 0xDE, 0x2C, 0x1C, 0xAE, 0x8E, 0x61, 0x2A, 0x2F, 0xD5, 0x7A, 0x27, 0xFF,
+    0x7E, 0x81, 0x3F, 0xD6, 0x21, 0x56, 0x1F, 0xD6, 0x1C, 0x5A, 0x23, 0x57, 0x16, 0x25, 0x94, 0x80,
+    0xFD, 0x50, 0x46, 0x2A, 0x8B, 0x18, 0xEB, 0xB2, 0x16, 0x2B, 0x6B, 0x0E, 0xC4, 0x46, 0x02, 0xD8,
+    0x48, 0xF0, 0x9A, 0xC5, 0x4D, 0x82, 0xD6, 0x2C, 0xA2, 0x52, 0xAC, 0xA6, 0x58, 0x4B, 0x80, 0x57,
+    0xA9, 0x28, 0x4C, 0x21, 0xD9, 0x73, 0x68, 0xA5, 0x10, 0x4D, 0xAF, 0x52, 0x80, 0xA6, 0xBD, 0x29,
+    0x3C, 0xB3, 0xE8, 0x4C, 0xC1, 0x99, 0x62, 0x33, 0x0B, 0xCD, 0x04, 0x99, 0x65, 0xB4, 0x67, 0x83,
+    0xAF, 0x4D, 0x36, 0x0D, 0x14, 0xF6, 0x83, 0x5F, 0xB0, 0x3E, 0x6E, 0x78, 0x31, 0x62, 0x23, 0x20,
+    0x36, 0x02, 0x62, 0x53, 0xE8, 0xC5, 0x41, 0xD0, 0xFD, 0x97, 0x86, 0xD8, 0x64, 0x1C, 0x3A, 0x10,
+    0x1D, 0x89, 0x0E, 0x45, 0xC7, 0xB2, 0x3A, 0x18, 0x12, 0x4C, 0x37, 0x17, 0x48, 0xD7, 0x0A, 0xA2,
+    0x53, 0x24, 0x97, 0x28, 0xE8, 0x7A, 0xB9, 0xD4, 0x22, 0x38, 0x05, 0x70, 0x8A, 0xDF, 0x14, 0xBE,
+    0x29, 0x7A, 0xB3, 0xE0, 0x4D, 0x62, 0xBC, 0xD7, 0xE9, 0x4D, 0xEC, 0x1C, 0x81, 0xBA, 0xFE, 0x3F,
+    0x2B, 0xB4, 0x13, 0x35, 0x30, 0xD9, 0x29, 0xB7, 0x33, 0x28, 0x1E, 0x80, 0x1D, 0x09, 0xB0, 0x83,
+    0xB6, 0x07, 0xD5, 0x59, 0xC0, 0xDC, 0x0B, 0x02, 0xBB, 0xAD, 0x2D, 0x0C, 0x54, 0x31, 0xC8, 0x6C,
+    0xB6, 0x37, 0x8E, 0xE5, 0x07, 0x2E, 0x3E, 0xEF, 0x24, 0x88, 0x51, 0xDA, 0x4E, 0x8A, 0x57, 0x41,
+    0xE6, 0x21, 0x0C, 0x1E, 0x63, 0xCA, 0x55, 0xD0, 0x19, 0x26, 0xF2, 0x79, 0xB6, 0xA0, 0x57, 0xE8,
+    0x07, 0x5F, 0xBE, 0xFC, 0xE9, 0xCA, 0xDE, 0xC2, 0x3A, 0xA8, 0x6B, 0xD9, 0x15, 0x2A, 0x96, 0xF6,
+    0xEA, 0xB7, 0xC4, 0x11, 0x43, 0xF2, 0xCE, 0xF2, 0x5A, 0x5C, 0x1D, 0x53, 0x03, 0x17, 0x74, 0x15,
+    0x4E, 0x85, 0x4F, 0x1A, 0x17, 0x4F, 0xD4, 0xC7, 0xC9, 0xB7, 0xD7, 0x65, 0xE6, 0x0C, 0x32, 0xC6,
+    0x15, 0x79, 0xBF, 0x1B, 0x77, 0xCA, 0x97, 0xBC, 0x22, 0x6A, 0x79, 0x5A, 0xB1, 0x3C, 0xB1, 0xC4,
+    0xC6, 0x81, 0x78, 0x5E, 0x5F, 0xFC, 0xCF, 0x55, 0x47, 0x57, 0xA4, 0x5C, 0xAC, 0xC8, 0xE4, 0x15,
+    0x5A, 0x91, 0x9B, 0xB4, 0x81, 0x09, 0x7D, 0x0C, 0xFB, 0xE9, 0x69, 0xE2, 0x41, 0x6D, 0xD1, 0x7B,
+    0x4F, 0xAD, 0x88, 0xD0, 0x20, 0xB9, 0x00, 0x2B, 0xF2, 0xE1, 0x52, 0xBC, 0xA5, 0x5B, 0x44, 0xC0,
+    0x8B, 0x44, 0x31, 0x2C, 0xF9, 0xBF, 0x18, 0x57, 0x84, 0x77, 0x47, 0xF5, 0xAA, 0xAD, 0x88, 0xEE,
+    0x7C, 0x0D, 0x09, 0xDD, 0x7A, 0xCC, 0x8C, 0x3E, 0x6B, 0x8F, 0x14, 0x17, 0x66, 0x45, 0x90, 0x9A,
+    0x41, 0xCE, 0xD1, 0x24, 0x61, 0x12, 0x15, 0x5F, 0x97, 0xCC, 0x2F, 0x7C, 0x32, 0x62, 0x34, 0xC8,
+    0x41, 0xDF, 0x29, 0x07, 0x9F, 0xE9, 0xEC, 0x61, 0x97, 0x32, 0xCF, 0x08, 0xAD, 0x8D, 0x13, 0xAF,
+    0x41, 0x04, 0x18, 0x94, 0x41, 0xC9, 0x61, 0x23, 0xE3, 0xC9, 0xB9, 0x46, 0x1D, 0xCE, 0xD6, 0x96,
+    0xE8, 0x23, 0x54, 0xD1, 0x9D, 0xCD, 0x16, 0xC2, 0xD9, 0xBB, 0x22, 0xCE, 0x9E, 0x83, 0x05, 0x50,
+    0x24, 0xE3, 0xEA, 0x30, 0xB9, 0xD0, 0xB1, 0xB3, 0x8B, 0x49, 0xF0, 0x4C, 0x96, 0x7D, 0xA5, 0x53,
+    0x33, 0x1A, 0xF4, 0x5A, 0xBE, 0x97, 0xDB, 0xE0, 0x86, 0x7B, 0x6B, 0xE7, 0x18, 0x45, 0x5B, 0xB1,
+    0x2A, 0x3D, 0x2D, 0xB8, 0x62, 0x21, 0x38, 0xAB, 0x7F, 0xD9, 0xAB, 0x24, 0x56, 0xF2, 0xCA, 0x61,
+    0xE4, 0x42, 0xDC, 0xEC, 0x3C, 0xC5, 0xCA, 0x26, 0x73, 0xF6, 0x60, 0x91, 0xC6, 0x93, 0x50, 0xEA,
+    0xCE, 0xB3, 0xD0, 0xAD, 0x6F, 0x8C, 0x8C, 0x7B, 0x2D, 0xD7, 0x96, 0x7E, 0xC4, 0x3B, 0x07, 0xED,
+    0xFF, 0xB4, 0x32, 0x5D, 0xE7, 0xDF, 0xB5, 0xF5, 0x3E, 0x6E, 0xC9, 0xE5, 0xD6, 0xFF, 0xB1, 0x02,
+    0x9D, 0xC0, 0x02, 0x9E, 0x6B, 0xB6, 0xDD, 0xB0, 0xED, 0x8E, 0x3B, 0x97, 0x1B, 0xD5, 0xAE, 0x08,
+    0xD2, 0xAD, 0xF8, 0xFF, 0xEF, 0x42, 0xF4, 0xFA, 0xFD, 0xE4, 0x93, 0x87, 0xD2, 0x06, 0x48, 0x39,
+    0xF2, 0xEB, 0x86, 0x05, 0x4E, 0x1B, 0xB6, 0x3D, 0x90, 0xF6, 0x87, 0x2C, 0x7A, 0xB4, 0x8F, 0x58,
+    0x86, 0x68, 0x6B, 0x5E, 0x6E, 0xA4, 0xD3, 0x6B, 0x16, 0xBA, 0xA4, 0xBB, 0x58, 0xEC, 0x46, 0xD2,
+    0x7C, 0x3C, 0x4D, 0x89, 0x50, 0x8C, 0xCE, 0xF2, 0x19, 0x93, 0x64, 0x49, 0xBB, 0xA6, 0x82, 0xAC,
+    0xFF, 0xED, 0xD3, 0x0E, 0xD2, 0x36, 0x12, 0xDA, 0x7B, 0x40, 0x04, 0x3E, 0xB2, 0xF9, 0xD0, 0x06,
+    0x4F, 0x40, 0x02, 0x8C, 0x04, 0x6B, 0x85, 0xF3, 0xBD, 0x93, 0xD9, 0x7E, 0xE9, 0xE0, 0x06, 0xA6,
+    0x64, 0xD9, 0xFF, 0x86, 0xA3, 0x50, 0x96, 0x7E, 0x23, 0xF6, 0x5D, 0x9A, 0x54, 0x6B, 0x47, 0xBC,
+    0x06, 0x9D, 0x7C, 0x18, 0xF4, 0xE4, 0x26, 0x71, 0x76, 0x33, 0xCD, 0x26, 0x59, 0x68, 0xDA, 0x90,
+    0x87, 0xE7, 0x9B, 0xD2, 0xC5, 0x14, 0x79, 0x35, 0x2E, 0x2F, 0x97, 0x14, 0x78, 0xB4, 0x41, 0xBF,
+    0x2F, 0x19, 0x70, 0x57, 0x51, 0x9D, 0xA4, 0x66, 0x19, 0x9B, 0xC0, 0x4A, 0xDD, 0xB2, 0x79, 0x39,
+    0x35, 0xBB, 0x51, 0x31, 0x40, 0xF6, 0xE7, 0xD0, 0xC8, 0x00, 0x54, 0xF1, 0xAD, 0x00, 0xAA, 0x8C,
+    0xAD, 0x24, 0x70, 0x0F, 0x33, 0xF3, 0x80, 0xF5, 0xDA, 0x98, 0x06, 0x75, 0x83, 0x23, 0x89, 0x73,
+    0xD8, 0x3F, 0xB1, 0x49, 0x3B, 0x02, 0x50, 0x79, 0xD8, 0x8B, 0xA5, 0x7F, 0x42, 0x63, 0xFD, 0x89,
+    0xB1, 0x74, 0xD4, 0xA7, 0x25, 0xF5, 0xD3, 0xFF, 0x28, 0xBD, 0xDA, 0xAF, 0x12, 0xBF, 0x62, 0x15,
+    0x9B, 0x94, 0x6E, 0x03, 0xD2, 0x5A, 0xAE, 0x62, 0xE2, 0xD5, 0x1E, 0x96, 0x06, 0x5B, 0x20, 0x87,
+    0xC1, 0xFD, 0xD1, 0x07, 0xC8, 0x83, 0xCA, 0xDE, 0x02, 0x79, 0xA2, 0xF5, 0xA1, 0x06, 0xDF, 0xCE,
+    0xC1, 0x19, 0xC9, 0x6D, 0x25, 0x9B, 0x48, 0xE6, 0xDD, 0xC6, 0x88, 0x36, 0xE9, 0xBD, 0xFC, 0x81,
+    0x00, 0x2D, 0x36, 0x9B, 0x6C, 0xD3, 0x4F, 0xD8, 0xEF, 0xF0, 0x12, 0x25, 0x63, 0x81, 0x41, 0xD3,
+    0x12, 0x82, 0xEC, 0x15, 0xDA, 0xDB, 0x8C, 0xFA, 0x69, 0x70, 0x7F, 0x8E, 0xC2, 0x64, 0xA1, 0xC1,
+    0x48, 0x1C, 0xD1, 0x17, 0x12, 0xA6, 0x22, 0x54, 0xEF, 0xB3, 0x11, 0xEA, 0xEF, 0x45, 0xDE, 0xFD,
+    0xD3, 0xF2, 0x66, 0x77, 0x0C, 0x2E, 0x19, 0xE4, 0x7D, 0xB8, 0x2C, 0x6F, 0x37, 0x01, 0x88, 0x72,
+    0x2B, 0xD4, 0xFB, 0xA8, 0xBD, 0x27, 0xA1, 0x88, 0x48, 0x3A, 0xAA, 0x17, 0x09, 0xE2, 0x65, 0x69,
+    0xD7, 0x01, 0x0A, 0x61, 0x0F, 0x26, 0x26, 0x1B, 0xB3, 0x1B, 0x9E, 0x54, 0x5F, 0x7C, 0xA9, 0xB7,
+    0x84, 0x12, 0x50, 0x6F, 0x08, 0x95, 0x72, 0x15, 0x0C, 0xA0, 0xDB, 0x05, 0x52, 0x99, 0x8A, 0x24,
+    0xDC, 0x46, 0x52, 0xCE, 0x9D, 0xF3, 0x6E, 0xE4, 0xA1, 0xFE, 0x13, 0x7E, 0x63, 0xB4, 0xC6, 0x85,
+    0x4A, 0x0A, 0x5F, 0xC5, 0x46, 0x94, 0x69, 0x2C, 0xE5, 0x9D, 0x50, 0x7A, 0x9E, 0x48, 0x0D, 0x8D,
+    0xF7, 0x2A, 0xFF, 0xCE, 0x31, 0xC9, 0x5D, 0x5E, 0xF1, 0xF4, 0x09, 0x2C, 0x1A, 0x7F, 0xF1, 0x36,
+    0xF6, 0xD6, 0x4D, 0x18, 0xE9, 0xE0, 0xEF, 0x4B, 0xB8, 0x10, 0xDC, 0xC8, 0xD8, 0x9C, 0xDF, 0x1B,
+    0x77, 0x86, 0xE9, 0x48, 0x60, 0xEC, 0xAE, 0x26, 0xB1, 0x97, 0xD3, 0xD9, 0x8D, 0xD3, 0xB2, 0x85,
+    0xE0, 0x7F, 0x53, 0x7C, 0xD6, 0x32, 0x71, 0x11, 0x75, 0xB0, 0x15, 0x74, 0xDA, 0x10, 0x3F, 0xB9,
+    0xCF, 0xE4, 0xD8, 0x20, 0xAA, 0x60, 0x0B, 0xE9, 0x18, 0x98, 0x88, 0x0E, 0x55, 0x34, 0x64, 0xE0,
+    0x9D, 0xD6, 0x99, 0xE3, 0x32, 0x29, 0x2C, 0xC5, 0xC5, 0xBA, 0x49, 0x82, 0x36, 0xE5, 0x58, 0xAE,
+    0xBF, 0xA8, 0x79, 0x14, 0x8D, 0x50, 0x6E, 0xCB, 0xE0, 0xD4, 0x64, 0x8B, 0x62, 0x3A, 0xED, 0x52,
+    0xBA, 0x34, 0x97, 0x7D, 0x17, 0xB6, 0xBF, 0xFF, 0x74, 0x8A, 0x38, 0x49, 0x41, 0x5D, 0x9B, 0xE3,
+    0xB0, 0xEE, 0xD9, 0x43, 0x03, 0xC0, 0xC9, 0x58, 0x40, 0x8C, 0x69, 0x6D, 0x36, 0x93, 0x0A, 0x2E,
+    0x3E, 0xB8, 0x2C, 0xF1, 0xD8, 0x85, 0x4E, 0x56, 0x9D, 0x51, 0xC8, 0xB3, 0x59, 0x06, 0xE5, 0x2A,
+    0x87, 0x84, 0xC7, 0x39, 0xE4, 0xB1, 0x90, 0x6D, 0x57, 0xC1, 0x8B, 0xA5, 0xDD, 0x1C, 0xC9, 0x92,
+    0xE0, 0x31, 0x95, 0x3D, 0xC4, 0xD4, 0x3B, 0x58, 0xA6, 0x08, 0x3B, 0x39, 0x18, 0x57, 0x64, 0x4C,
+    0x78, 0xDA, 0xDA, 0x3A, 0x2F, 0x4D, 0x60, 0x49, 0x07, 0x8C, 0xD1, 0xD0, 0x1F, 0x63, 0x75, 0x2F,
+    0xE9, 0x4D, 0x6E, 0x0F, 0x92, 0x70, 0x2B, 0xB5, 0x7F, 0xDC, 0xDF, 0x07, 0xB8, 0x1B, 0x26, 0xFD,
+    0xC6, 0x5D, 0x29, 0xA7, 0xC9, 0xDE, 0x45, 0x21, 0x5B, 0x0A, 0xE5, 0x6A, 0xB0, 0xA3, 0xE2, 0x36,
+    0xC8, 0x7D, 0x7C, 0x96, 0xC2, 0xCE, 0xC7, 0x85, 0xD3, 0x53, 0x78, 0x32, 0x6D, 0x49, 0x82, 0x2E,
+    0xBA, 0x7C, 0x07, 0x96, 0xCC, 0x49, 0xD8, 0x8E, 0x25, 0x62, 0xC5, 0x90, 0xCA, 0x86, 0x05, 0x5B,
+    0xB2, 0x5F, 0x28, 0xB3, 0xF2, 0x1B, 0x7E, 0xB9, 0xBE, 0xC9, 0xD6, 0xEA, 0x3A, 0x8F, 0xE9, 0x92,
+    0x0C, 0xE9, 0xA7, 0x8A, 0x6A, 0x10, 0x6B, 0xC2, 0x0C, 0xC6, 0xDC, 0x59, 0xDA, 0xDB, 0x32, 0xE0,
+    0xC4, 0x16, 0xDA, 0xA5, 0xD2, 0x30, 0x5F, 0x7A, 0x77, 0x97, 0xF8, 0xBD, 0xCB, 0x8B, 0xF9, 0x98,
+    0xED, 0x5F, 0x0E, 0x7D, 0x3A, 0x31, 0xC9, 0x1A, 0xBB, 0x80, 0xB7, 0xE9, 0xED, 0x1B, 0x54, 0xB3,
+    0x35, 0xF2, 0x4D, 0x06, 0x4B, 0x34, 0xD4, 0x1E, 0x38, 0x3C, 0x98, 0xF4, 0xE2, 0x35, 0xEE, 0x9F,
+    0xFD, 0x8F, 0xAF, 0x7A, 0x8C, 0x31, 0xB0, 0xBC, 0xA3, 0x8A, 0xEE, 0x27, 0xFF, 0x7F, 0x2C, 0xC1,
+    0x1E, 0x4B, 0xB0, 0x47, 0x10, 0x64, 0x97, 0xD8, 0x23, 0x29, 0xC3, 0x11, 0x04, 0xED, 0xDF, 0x6F,
+    0x07, 0xEE, 0x0F, 0xE7, 0x08, 0xC2, 0xA0, 0xD0, 0x23, 0xCE, 0x7D, 0xAA, 0x48, 0xF8, 0xF9, 0xCC,
+    0xAB, 0x73, 0x04, 0x81, 0x5F, 0x6F, 0x25, 0x8B, 0x2A, 0xDD, 0x7C, 0xE9, 0xB4, 0x91, 0xEC, 0xEE,
+    0x35, 0x7A, 0x25, 0x62, 0x42, 0xCD, 0xA2, 0xCA, 0xCD, 0x24, 0x41, 0x74, 0x28, 0xA8, 0x7B, 0x05,
+    0x13, 0x5E, 0x84, 0x98, 0x90, 0x23, 0x2B, 0x5F, 0x5C, 0x2C, 0x87, 0x79, 0x6B, 0xE2, 0xC9, 0xB0,
+    0x41, 0xA3, 0xD2, 0xEE, 0x18, 0x11, 0xDA, 0x0B, 0x32, 0xF3, 0xAD, 0xAD, 0x69, 0xA1, 0x23, 0x63,
+    0x6B, 0xC5, 0x37, 0xD2, 0x4F, 0xD6, 0xFB, 0x44, 0x7F, 0xE3, 0xD9, 0xED, 0x54, 0xB8, 0x67, 0x62,
+    0xD4, 0x98, 0x05, 0x25, 0xAF, 0x30, 0x86, 0x1A, 0x54, 0xBC, 0xA3, 0x10, 0x25, 0x7A, 0xC7, 0xD3,
+    0x52, 0xA1, 0x6F, 0x3E, 0xEE, 0x95, 0x11, 0x1A, 0xA6, 0x8D, 0x2F, 0x39, 0xA9, 0xD8, 0xA0, 0x9F,
+    0x63, 0xD4, 0x74, 0xF9, 0x7F, 0xB6, 0x55, 0x2C, 0xCD, 0x48, 0x2C, 0x15, 0xEF, 0xEA, 0xB9, 0xA4,
+    0x17, 0xBA, 0xE7, 0xD3, 0x50, 0x12, 0x67, 0xFC, 0xFB, 0x4E, 0x54, 0xA5, 0x13, 0x9D, 0xEF, 0xE4,
+    0xA4, 0xC9, 0x50, 0x9F, 0x83, 0xDE, 0x75, 0xA2, 0x2F, 0x9D, 0xF8, 0xD5, 0x4E, 0x0C, 0x51, 0x87,
+    0xE4, 0x15, 0xF5, 0x62, 0xB2, 0x44, 0x49, 0xAC, 0xA3, 0xE8, 0x56, 0xA9, 0xD6, 0xFC, 0x5C, 0xF9,
+    0x76, 0x5D, 0x8C, 0x5D, 0x6A, 0x34, 0x8E, 0xF8, 0x60, 0xA9, 0xB6, 0x9B, 0xD2, 0x22, 0xE2, 0xD0,
+    0xA4, 0x09, 0xAD, 0x86, 0xEE, 0x72, 0x02, 0x40, 0xEB, 0xFF, 0x5A, 0xFD, 0xD7, 0xDA, 0xBF, 0x56,
+    0xFE, 0xB5, 0xEE, 0xAF, 0x55, 0x7F, 0xAD, 0xF9, 0x6B, 0xC5, 0x5F, 0xEB, 0xFD, 0x5A, 0xED, 0xD7,
+    0x5A, 0xBF, 0x56, 0xFA, 0xB5, 0xCE, 0xAF, 0x55, 0x7E, 0xAD, 0xF1, 0x6B, 0x85, 0x5F, 0xEB, 0xFB,
+    0x5A, 0xDD, 0xD7, 0xDA, 0xBE, 0x56, 0xF6, 0xB5, 0xAE, 0xAF, 0x55, 0x7D, 0x5B, 0xD3, 0x5F, 0x93,
+    0xD4, 0x84, 0xD7, 0x2E, 0x4D, 0x78, 0x93, 0x16, 0xF9, 0x77, 0x37, 0x7B, 0x46, 0x05, 0x5E, 0xEB,
+    0xEF, 0xB6, 0xFA, 0xAE, 0xB5, 0x77, 0xAD, 0xBC, 0x6B, 0xDD, 0x5D, 0xAB, 0xE6, 0x67, 0xA5, 0x5A,
+    0x63, 0xB7, 0x15, 0x76, 0xA9, 0xAF, 0x8F, 0xBB, 0xFF, 0x68, 0xC9, 0xD8, 0x88, 0x54, 0x1D, 0x95,
+    0xB3, 0xB8, 0x97, 0x23, 0x29, 0xA0, 0xD6, 0xD7, 0x40, 0x15, 0x40, 0xD5, 0xAF, 0x81, 0x7E, 0xF4,
+    0x78, 0x91, 0x8A, 0x0A, 0x96, 0xD3, 0x52, 0x32, 0xC9, 0x6D, 0xA1, 0xF5, 0x91, 0x9C, 0x1D, 0x4A,
+    0xC5, 0x8A, 0x41, 0x2B, 0x3C, 0x99, 0xD1, 0x24, 0x09, 0x8A, 0x95, 0x84, 0x94, 0x6C, 0xE2, 0x54,
+    0xF2, 0x28, 0x07, 0xA2, 0x24, 0xB5, 0xF8, 0x9F, 0x4A, 0x12, 0x10, 0x48, 0x42, 0x65, 0xBE, 0xA6,
+    0xA2, 0x7E, 0xB3, 0x48, 0x45, 0x59, 0x3B, 0x93, 0x0E, 0xF1, 0x96, 0x18, 0x4A, 0x19, 0xBA, 0x08,
+    0x5D, 0x8E, 0xA9, 0xED, 0x60, 0xC4, 0x8F, 0x70, 0xD6, 0x43, 0xC8, 0x6E, 0x38, 0x7C, 0xE1, 0xEC,
+    0x9D, 0x5B, 0x7A, 0x8A, 0xE8, 0xDD, 0xD3, 0x87, 0x59, 0xC6, 0x03, 0x1C, 0x56, 0x79, 0x03, 0xEB,
+    0x03, 0xFE, 0x84, 0xFE, 0x10, 0xD3, 0x56, 0xB4, 0xB6, 0xB7, 0x74, 0x0C, 0x4B, 0x0F, 0x39, 0x59,
+    0xE4, 0x63, 0xB1, 0x02, 0x39, 0x05, 0x5D, 0xD4, 0x5C, 0xD6, 0x7B, 0x8B, 0x85, 0xD3, 0xF9, 0x0B,
+    0x9A, 0xB0, 0x4B, 0xF6, 0xA7, 0xA7, 0x86, 0x7C, 0x03, 0x26, 0xFF, 0xF8, 0x96, 0xA0, 0xB3, 0x5A,
+    0xD0, 0x59, 0x8B, 0x1B, 0x7A, 0x82, 0xCE, 0x7C, 0xD9, 0xC6, 0x81, 0xA0, 0xB3, 0x1B, 0x82, 0xCE,
+    0x36, 0x04, 0x9D, 0x1D, 0x08, 0x3A, 0xAB, 0x81, 0xCE, 0xDC, 0x02, 0x58, 0xCC, 0xCF, 0x40, 0x03,
+    0xC1, 0x65, 0xD7, 0x84, 0x6E, 0x08, 0x3A, 0xDB, 0x16, 0x74, 0x56, 0x03, 0x9D, 0x7D, 0x8C, 0xF3,
+    0xDE, 0xC1, 0xAF, 0x0A, 0xA0, 0xB3, 0xDF, 0xCA, 0x51, 0xAB, 0x7E, 0x09, 0x9D, 0xA5, 0x82, 0xCE,
+    0xFE, 0x17, 0xFB, 0xC3, 0x29, 0x25, 0xA9, 0x6F, 0xD5, 0xEB, 0xAD, 0x71, 0xC7, 0x1F, 0x9D, 0x82,
+    0x28, 0xDE, 0x12, 0x0E, 0xE3, 0x6D, 0x3E, 0xED, 0x77, 0x01, 0xC4, 0x9A, 0x01, 0x88, 0xA9, 0xC8,
+    0x7B, 0x36, 0x69, 0x01, 0x30, 0xD8, 0x0D, 0x90, 0x1D, 0x20, 0xAF, 0x9A, 0x09, 0xDB, 0xCC, 0x24,
+    0xF6, 0x0A, 0x26, 0x01, 0x80, 0xD8, 0x5F, 0xC1, 0xD1, 0x1E, 0x62, 0xA5, 0x1A, 0x00, 0xB1, 0x9A,
+    0xED, 0xB6, 0x07, 0x20, 0xE6, 0xC3, 0x1A, 0x06, 0x70, 0x4B, 0x7A, 0x38, 0xE9, 0xAF, 0xAF, 0x60,
+    0x18, 0x29, 0xC2, 0x14, 0x8A, 0xBE, 0xDD, 0x48, 0x21, 0x49, 0x32, 0x47, 0x95, 0xA0, 0xA7, 0x47,
+    0x93, 0x8B, 0x7D, 0x2E, 0xE7, 0x5D, 0xA8, 0x74, 0x0C, 0xCB, 0x10, 0xBE, 0x8F, 0xC3, 0xBF, 0xE5,
+    0x21, 0xC0, 0x15, 0xD0, 0xE5, 0xF6, 0xE4, 0x5C, 0x53, 0xDF, 0x57, 0xC4, 0xBB, 0xA4, 0x32, 0xF1,
+    0x5E, 0x26, 0x5E, 0xCA, 0xB9, 0xB6, 0xCC, 0xBB, 0xD8, 0xC5, 0x19, 0x1D, 0xB8, 0x8C, 0x1B, 0xC3,
+    0x76, 0x2A, 0x9F, 0xDD, 0x5D, 0xE1, 0x65, 0xE7, 0x27, 0xBB, 0x2B, 0xD9, 0x87, 0x30, 0x49, 0x73,
+    0x74, 0x84, 0xA9, 0xB6, 0x38, 0x81, 0xB9, 0x8B, 0xA0, 0xE2, 0x35, 0xA7, 0x3A, 0x7D, 0x32, 0x5E,
+    0xC1, 0x27, 0x6C, 0xCE, 0x04, 0xE1, 0x98, 0x27, 0x31, 0xD9, 0x48, 0x2C, 0x72, 0x5E, 0x22, 0x30,
+    0xAF, 0x62, 0x5B, 0xC5, 0xB0, 0x3E, 0xF3, 0x27, 0x03, 0xD9, 0xD6, 0x63, 0xAE, 0x1D, 0xF2, 0xA8,
+    0x38, 0xE2, 0x2A, 0xA6, 0x53, 0x8E, 0xB7, 0x42, 0xC5, 0x52, 0x9E, 0x40, 0xF4, 0x63, 0x0E, 0x56,
+    0x8A, 0x43, 0x5E, 0x90, 0xCD, 0xD3, 0xFB, 0x82, 0xC1, 0xBB, 0xDB, 0xE7, 0x85, 0x5F, 0x4F, 0x18,
+    0xCB, 0x78, 0x4D, 0x98, 0xB9, 0x1D, 0xE3, 0xCD, 0x0E, 0x87, 0xEA, 0xE2, 0xD9, 0x0C, 0xE0, 0xA2,
+    0x8B, 0xB7, 0xB6, 0xBE, 0x1B, 0xDB, 0x48, 0x1C, 0xDE, 0x37, 0x94, 0x64, 0x10, 0xBD, 0xED, 0x37,
+    0x4E, 0xC3, 0x03, 0xAC, 0xD8, 0xE1, 0x26, 0x12, 0x2B, 0x3A, 0x1F, 0x89, 0xC1, 0x67, 0x09, 0x44,
+    0x0F, 0x4B, 0x98, 0x7A, 0x96, 0xED, 0x37, 0xE9, 0xD1, 0x05, 0x10, 0x03, 0x5D, 0xE1, 0xA8, 0x31,
+    0x66, 0x4D, 0xE8, 0xF7, 0x13, 0x62, 0x2D, 0x71, 0x8A, 0xA5, 0x88, 0xE9, 0x25, 0x8A, 0x00, 0xE2,
+    0xC6, 0x86, 0x0E, 0x7F, 0xD6, 0xF2, 0x56, 0x39, 0x64, 0x25, 0x8E, 0xB0, 0x99, 0x93, 0x45, 0xDA,
+    0xCD, 0x14, 0xAC, 0x91, 0x99, 0x84, 0x3A, 0x93, 0x97, 0xF4, 0xE6, 0xBE, 0x9C, 0x94, 0x51, 0x01,
+    0xF7, 0xFD, 0x8E, 0xCB, 0xF7, 0x67, 0x43, 0x08, 0x33, 0xE8, 0x57, 0xF7, 0xF8, 0xFE, 0x1C, 0xA9,
+    0xEC, 0xF8, 0x8B, 0x5D, 0x0C, 0x4F, 0x3A, 0xAD, 0xB5, 0x36, 0xE0, 0x9D, 0xF1, 0x0D, 0xE4, 0x36,
+    0x65, 0xCC, 0xC3, 0xF7, 0x71, 0x3F, 0xE4, 0x8D, 0x90, 0xC4, 0xFB, 0xC5, 0x8E, 0x53, 0xFD, 0x90,
+    0x1E, 0xBC, 0xDC, 0x73, 0x7C, 0x8B, 0xCE, 0xDD, 0xF2, 0x11, 0x55, 0xFF, 0xA7, 0x43, 0x7C, 0x1F,
+    0x5A, 0x0F, 0x51, 0x89, 0x87, 0xA8, 0x3F, 0xD7, 0x43, 0x5C, 0xC8, 0x43, 0x7C, 0x6F, 0xFD, 0x39,
+    0x4B, 0x38, 0xFC, 0x59, 0x07, 0x17, 0xF1, 0x78, 0xB4, 0x34, 0x48, 0x2E, 0x5E, 0x77, 0x8B, 0xF3,
+    0x3C, 0xC4, 0xB7, 0xAE, 0x95, 0x43, 0x71, 0xF9, 0x27, 0x8F, 0xC5, 0xB2, 0x07, 0xE2, 0xF9, 0x5F,
+    0x09, 0x31, 0xD2, 0xDA, 0x13, 0xC9, 0x9F, 0x22, 0x72, 0xD9, 0xC7, 0x81, 0x58, 0xB8, 0x95, 0xD2,
+    0x39, 0x47, 0x09, 0xBE, 0xE3, 0x0A, 0xA2, 0x90, 0xC8, 0xDA, 0xEA, 0x61, 0x2D, 0x30, 0xAE, 0x91,
+    0x40, 0xF0, 0xBA, 0x97, 0xAD, 0xE6, 0x66, 0x50, 0x76, 0x62, 0x7B, 0x39, 0x97, 0xBC, 0x42, 0x9E,
+    0x48, 0x9D, 0x47, 0x12, 0x65, 0x9A, 0x38, 0xB3, 0xB4, 0x7E, 0xEA, 0x13, 0xF9, 0x0D, 0x1E, 0x23,
+    0x14, 0x00, 0xED, 0x4A, 0xA6, 0x9C, 0xE7, 0xA5, 0xF5, 0x25, 0x49, 0x3C, 0x42, 0x44, 0x6E, 0x07,
+    0xA8, 0x8C, 0x3A, 0x92, 0xD0, 0x54, 0xAB, 0x49, 0x85, 0xED, 0xD3, 0x93, 0x6A, 0x12, 0xEF, 0x49,
+    0x06, 0xA6, 0x48, 0x0C, 0xE4, 0x05, 0xC6, 0x8F, 0xD1, 0x63, 0xEC, 0x1E, 0x3C, 0x49, 0xC3, 0xE6,
+    0xE5, 0xD6, 0x62, 0xD4, 0x71, 0x13, 0x37, 0xEB, 0x8D, 0xE9, 0x9C, 0x13, 0x56, 0x56, 0x93, 0xA0,
+    0xDF, 0x3D, 0x79, 0x8E, 0x64, 0x6E, 0x51, 0xEB, 0x67, 0xBC, 0x31, 0xCE, 0x75, 0xF3, 0x0F, 0x78,
+    0x7E, 0x86, 0x07, 0xF3, 0x11, 0x0D, 0xAE, 0x84, 0x62, 0xF8, 0x12, 0xDA, 0x10, 0x77, 0x3A, 0xDA,
+    0x9A, 0x8B, 0x2A, 0x21, 0x7A, 0x67, 0x4F, 0x8E, 0xD2, 0x78, 0x27, 0xAC, 0xED, 0x1C, 0x78, 0xFB,
+    0x74, 0x65, 0x61, 0x7B, 0x4B, 0x53, 0x4E, 0x7F, 0x61, 0x6A, 0xFF, 0x53, 0xBF, 0xF6, 0xE6, 0x5E,
+    0xED, 0x75, 0x6E, 0x82, 0x7B, 0x00, 0x54, 0x7C, 0x31, 0xDB, 0x7B, 0x87, 0xE0, 0x6B, 0xE8, 0xAD,
+    0x6F, 0x21, 0x9B, 0x11, 0xC0, 0x20, 0xB0, 0x95, 0x3F, 0xA2, 0x21, 0x6A, 0xA4, 0x43, 0x29, 0x13,
+    0xAC, 0x18, 0x85, 0x0B, 0x7A, 0x5C, 0xCA, 0x7D, 0xF0, 0xAE, 0xD4, 0x78, 0xA5, 0x7A, 0xD2, 0x49,
+    0xCA, 0xEB, 0x9E, 0x44, 0x97, 0xA1, 0x24, 0xFA, 0xFC, 0x64, 0xFB, 0xCB, 0x3F, 0x16, 0x25, 0x06,
+    0x43, 0x2D, 0x86, 0x9A, 0x0C, 0xB5, 0x19, 0xAB, 0x46, 0xE3, 0xC2, 0x1E, 0x48, 0xFB, 0x49, 0x22,
+    0xE7, 0x85, 0xA4, 0x70, 0xF5, 0x09, 0xE2, 0xF4, 0xD7, 0x68, 0x47, 0x12, 0x04, 0x5F, 0xBF, 0x08,
+    0x47, 0xCE, 0x58, 0xA1, 0x19, 0xD6, 0xED, 0xE3, 0xF0, 0x58, 0x1D, 0x25, 0x6E, 0x13, 0x93, 0xC3,
+    0x6F, 0xDA, 0x8B, 0x2D, 0xBE, 0x44, 0x16, 0x15, 0x27, 0x19, 0x7C, 0x24, 0xB1, 0x60, 0x15, 0x22,
+    0x61, 0x2A, 0x2D, 0x01, 0xCA, 0x03, 0x65, 0xF3, 0xAF, 0xF0, 0x7B, 0x83, 0xE8, 0xF1, 0x3D, 0xBE,
+    0x1F, 0x92, 0x89, 0x31, 0x07, 0xEF, 0xE1, 0xAF, 0xA7, 0x8C, 0xBE, 0xFB, 0xC5, 0xA3, 0xC9, 0x7E,
+    0xA5, 0xA7, 0x55, 0x03, 0x5B, 0xB4, 0xBA, 0xB6, 0x78, 0xBA, 0xC5, 0x35, 0x1C, 0x2C, 0xFD, 0x8B,
+    0x3C, 0x2C, 0xC2, 0x92, 0xBC, 0xC9, 0x96, 0xFE, 0x4D, 0x0D, 0xF2, 0xF8, 0xE7, 0xE1, 0x1C, 0xF7,
+    0x46, 0xEE, 0xA8, 0x03, 0x23, 0x49, 0xF5, 0x4B, 0x14, 0x66, 0xB7, 0x78, 0x7D, 0x77, 0x29, 0x4C,
+    0xEE, 0xE1, 0xAA, 0x7F, 0xC4, 0x93, 0x2E, 0x15, 0x8D, 0x49, 0x9A, 0xD8, 0x66, 0xE6, 0x76, 0xED,
+    0xB9, 0xBF, 0x5A, 0x9F, 0x88, 0x43, 0xC5, 0x69, 0x0E, 0xD2, 0x6F, 0xF2, 0xA2, 0x6D, 0xEE, 0x32,
+    0xB9, 0xB6, 0xC3, 0xE4, 0xB5, 0x6D, 0xA4, 0xC7, 0x6D, 0x91, 0xE5, 0xE5, 0x91, 0xAF, 0x22, 0x4B,
+    0x1A, 0x9B, 0xF9, 0xA9, 0x55, 0x16, 0xB8, 0xFE, 0x78, 0x2C, 0xB0, 0xD6, 0x64, 0x93, 0xE0, 0xF2,
+    0xC4, 0xDE, 0xB6, 0x64, 0xCC, 0x1A, 0x24, 0x95, 0x42, 0xD3, 0xA6, 0xA6, 0x45, 0x7E, 0xF8, 0xF3,
+    0xFE, 0x5C, 0x79, 0x70, 0x95, 0xCC, 0x5F, 0x42, 0x44, 0xAA, 0x72, 0xEC, 0x00, 0x63, 0x91, 0x00,
+    0xAF, 0xCA, 0xCE, 0xF8, 0x4C, 0x95, 0x0B, 0x33, 0x1D, 0x9E, 0xB0, 0x7A, 0xA5, 0x38, 0x0A, 0x71,
+    0x04, 0x6B, 0x2F, 0x8E, 0xFA, 0x10, 0xE4, 0x75, 0xFB, 0xB0, 0xE1, 0x50, 0xE5, 0x92, 0xA8, 0x56,
+    0x2A, 0x61, 0xEB, 0x9D, 0x40, 0x3B, 0xE6, 0xB2, 0x49, 0x33, 0x9E, 0x3F, 0xEE, 0x9F, 0x37, 0x75,
+    0xAC, 0x91, 0x24, 0x8C, 0x45, 0x39, 0x24, 0x9D, 0x98, 0x16, 0x5A, 0x96, 0x75, 0xF8, 0xDE, 0x50,
+    0x38, 0x16, 0x43, 0x72, 0x3A, 0x52, 0xE1, 0x09, 0xFF, 0xBA, 0xC7, 0x52, 0x66, 0xF7, 0xD8, 0x73,
+    0x6C, 0xB0, 0x96, 0xBC, 0xA9, 0x9A, 0x52, 0xC8, 0x6C, 0xE4, 0xC1, 0xD4, 0x56, 0x52, 0xC2, 0x4E,
+    0x73, 0x44, 0x63, 0xEC, 0x2F, 0xC1, 0xCC, 0xF2, 0x1B, 0x3A, 0x8F, 0xEF, 0xD8, 0xA0, 0xA1, 0xF6,
+    0x87, 0x47, 0xB7, 0x51, 0x91, 0xE2, 0x61, 0xFF, 0xCD, 0xF2, 0xD3, 0xC0, 0x7A, 0x5A, 0xC7, 0x1E,
+    0xD7, 0xB1, 0xE7, 0x75, 0xEC, 0x81, 0x9D, 0x67, 0x9C, 0xD8, 0x19, 0x0A, 0x0C, 0xB6, 0xBC, 0x60,
+    0x8B, 0x0B, 0xB6, 0x48, 0x70, 0x86, 0x46, 0x8B, 0x09, 0x5A, 0x4A, 0x18, 0xFF, 0x3B, 0x73, 0x2F,
+    0xDA, 0x78, 0x9A, 0xC4, 0x67, 0xB7, 0xE7, 0xE4, 0xC7, 0x18, 0xA0, 0x1C, 0x32, 0xF8, 0x0A, 0xFD,
+    0x91, 0x24, 0xB4, 0xA0, 0xF8, 0xDE, 0x2F, 0x1B, 0x29, 0xB5, 0x55, 0x8B, 0xE7, 0xCA, 0x60, 0xE6,
+    0xE5, 0x88, 0x89, 0x3D, 0x32, 0xA3, 0xA5, 0x46, 0xCD, 0x85, 0x39, 0xCF, 0xA5, 0xF8, 0xAD, 0x73,
+    0x8C, 0xEE, 0x9D, 0xDF, 0x66, 0xBC, 0x94, 0x2C, 0x58, 0x5E, 0x16, 0x47, 0x2A, 0x04, 0xA3, 0xB1,
+    0x79, 0x01, 0x43, 0x85, 0x83, 0x32, 0xC8, 0x62, 0x27, 0x93, 0x63, 0x36, 0xDE, 0xD5, 0xC4, 0xD0,
+    0xEF, 0x00, 0xA5, 0x56, 0x3D, 0x8C, 0x1B, 0x45, 0x14, 0xFE, 0x76, 0x37, 0xBE, 0xBD, 0xF3, 0xC4,
+    0x5E, 0x17, 0x58, 0x39, 0x88, 0xE3, 0xBD, 0x22, 0xC5, 0x71, 0x9C, 0x6F, 0x53, 0xB8, 0x70, 0xE1,
+    0xF3, 0x4E, 0x84, 0xA8, 0x90, 0xC8, 0x4A, 0xC4, 0x55, 0x9A, 0x93, 0xA0, 0xE0, 0x27, 0x04, 0x17,
+    0x29, 0x12, 0x29, 0x67, 0xAF, 0x42, 0x0F, 0x16, 0x2D, 0x05, 0x16, 0x50, 0x9C, 0x0E, 0xA1, 0x18,
+    0x74, 0x48, 0x57, 0x9C, 0x6F, 0x87, 0x02, 0x21, 0xBA, 0x95, 0x88, 0x44, 0x81, 0x90, 0xA6, 0xA0,
+    0x08, 0x54, 0x5B, 0x58, 0xC8, 0xC0, 0xDA, 0xC3, 0x9B, 0x75, 0x2E, 0xF7, 0x13, 0xA0, 0x61, 0xFE,
+    0x3C, 0x6F, 0x76, 0xE6, 0xFD, 0x7E, 0xEF, 0xDD, 0xAD, 0xC1, 0x17, 0x4E, 0x6C, 0x25, 0xD8, 0xC7,
+    0x3A, 0x76, 0xCC, 0xD4, 0x4A, 0x1C, 0xE1, 0xA2, 0x01, 0xEC, 0xC0, 0x9A, 0xC1, 0x56, 0x70, 0x3E,
+    0x10, 0x2D, 0x4B, 0xDE, 0x46, 0xC7, 0xE0, 0x80, 0x3B, 0xB1, 0x79, 0x4B, 0x7D, 0x8C, 0xDB, 0xDE,
+    0x14, 0x25, 0xF3, 0x17, 0xBC, 0xB5, 0xDB, 0x57, 0x2A, 0x69, 0xB7, 0x83, 0x72, 0xBB, 0xCD, 0x15,
+    0x6D, 0x77, 0x77, 0x77, 0x07, 0x5B, 0xE8, 0xDF, 0x36, 0x62, 0xFF, 0x81, 0x70, 0x15, 0x37, 0x27,
+    0x28, 0x1D, 0x2A, 0xB5, 0xFA, 0x86, 0xD9, 0x9F, 0xDA, 0x09, 0x8D, 0x7B, 0x56, 0x6C, 0x70, 0x7F,
+    0x72, 0xB7, 0x5B, 0xF2, 0xD0, 0xB2, 0x52, 0x4B, 0x58, 0xA1, 0x01, 0x62, 0x3C, 0xEE, 0x8E, 0x12,
+    0x47, 0xF7, 0xEE, 0xC8, 0x1D, 0x03, 0xE6, 0x60, 0x0D, 0x2C, 0x89, 0xE0, 0x88, 0x14, 0x3E, 0x69,
+    0x77, 0xCF, 0x16, 0x18, 0x32, 0x20, 0xC0, 0x56, 0xD3, 0x94, 0xEE, 0xCB, 0x82, 0x29, 0x4E, 0xFA,
+    0x19, 0x29, 0x82, 0x44, 0x37, 0x94, 0xCE, 0xDD, 0xA9, 0x1D, 0x75, 0x60, 0xCD, 0x1C, 0xC0, 0x7F,
+    0x71, 0x9C, 0x3D, 0xB7, 0x64, 0x17, 0x46, 0xE2, 0x02, 0x0D, 0x3B, 0xC4, 0x00, 0xA4, 0x11, 0x8D,
+    0x60, 0x1C, 0x0C, 0x21, 0xB7, 0xED, 0xD8, 0x53, 0x21, 0x9B, 0x91, 0x02, 0x30, 0x77, 0x40, 0xFA,
+    0x92, 0xD6, 0x77, 0xCC, 0x98, 0x3E, 0x61, 0xCB, 0x96, 0x55, 0x34, 0x71, 0x07, 0x23, 0x44, 0x61,
+    0x24, 0x7C, 0x91, 0x07, 0xE3, 0x7E, 0xEC, 0x4B, 0x57, 0x5A, 0xD2, 0x8C, 0x2D, 0xF2, 0xD2, 0x3E,
+    0x38, 0xAA, 0xE8, 0x89, 0x48, 0x44, 0xFC, 0x80, 0x6E, 0x36, 0xE1, 0x70, 0x53, 0xA2, 0xF4, 0x4F,
+    0xF7, 0xD6, 0xB8, 0x27, 0x58, 0x6C, 0x6A, 0x3F, 0x57, 0xB0, 0x63, 0x4D, 0x6C, 0xE9, 0x84, 0x1B,
+    0xA8, 0x03, 0x7D, 0xC8, 0xB7, 0x65, 0x24, 0x0D, 0x49, 0x32, 0xB1, 0x85, 0x21, 0x0E, 0xFB, 0x91,
+    0xDC, 0xA3, 0x5F, 0xA0, 0xDC, 0x46, 0xA4, 0x78, 0xFB, 0x06, 0x27, 0xC9, 0xA7, 0x86, 0x01, 0xB3,
+    0xCF, 0x12, 0x36, 0x36, 0x13, 0x23, 0x31, 0x63, 0x8F, 0x13, 0x1B, 0x6F, 0x44, 0x5E, 0xE8, 0x92,
+    0x95, 0xE4, 0x51, 0xEA, 0x7E, 0xEA, 0xA7, 0xE5, 0xEB, 0x7E, 0xFA, 0xC2, 0x23, 0x4D, 0x99, 0xA1,
+    0x19, 0x5A, 0xE2, 0xC2, 0x43, 0x3F, 0xBD, 0xF0, 0x50, 0x53, 0xBD, 0x69, 0x34, 0x23, 0x57, 0x26,
+    0xF3, 0x7E, 0x35, 0x51, 0x52, 0x89, 0x67, 0x8F, 0x0F, 0x30, 0x2E, 0x45, 0x89, 0x9F, 0x2C, 0x70,
+    0x6C, 0x2B, 0xB5, 0x8D, 0x93, 0xB1, 0x5B, 0xE8, 0xFB, 0xE9, 0xFE, 0xC6, 0xB0, 0xB8, 0x57, 0x6D,
+    0x1D, 0x30, 0xE9, 0x0A, 0x37, 0xF4, 0xB0, 0x49, 0x86, 0x97, 0x48, 0x27, 0x8B, 0xDB, 0xD2, 0x4C,
+    0xB1, 0x4D, 0x07, 0xA3, 0x5E, 0xDA, 0x23, 0xE3, 0x5D, 0xDA, 0xDE, 0x23, 0x07, 0xF6, 0xE0, 0xCF,
+    0xD8, 0x74, 0xA0, 0x03, 0x35, 0x20, 0x84, 0x10, 0x50, 0x66, 0xED, 0x28, 0x81, 0x23, 0xC1, 0xFA,
+    0x58, 0xE8, 0x5C, 0x2E, 0x5C, 0x69, 0x54, 0x5A, 0xB3, 0x03, 0xF7, 0xA7, 0x84, 0xAC, 0x1E, 0x1B,
+    0xC9, 0xA6, 0x2D, 0xDC, 0x07, 0x9C, 0xE2, 0x62, 0xA5, 0x3A, 0xE4, 0xB4, 0xDA, 0x53, 0x38, 0x0A,
+    0x2D, 0x47, 0xEC, 0x9B, 0x92, 0xA3, 0x34, 0x87, 0x58, 0xEB, 0xF3, 0x0C, 0x62, 0x7F, 0x3C, 0x15,
+    0x3B, 0xC2, 0x93, 0x5C, 0xF0, 0xA7, 0xC5, 0x61, 0x34, 0x95, 0x8C, 0xD0, 0x04, 0x42, 0x28, 0x81,
+    0x93, 0xD0, 0xDA, 0xCE, 0x76, 0x73, 0x9C, 0xEA, 0xA9, 0x32, 0xF8, 0xB6, 0x03, 0x8D, 0x80, 0x93,
+    0x74, 0x8E, 0xC3, 0x1B, 0xB3, 0x9E, 0xBA, 0x95, 0xF8, 0x69, 0xB0, 0x20, 0xCB, 0xED, 0xEB, 0xF4,
+    0x85, 0x2E, 0x10, 0xCE, 0x09, 0xE9, 0x3D, 0x22, 0x54, 0xBC, 0x46, 0xF4, 0x6E, 0xA8, 0x5F, 0x52,
+    0xEA, 0x18, 0x53, 0x6D, 0x4E, 0xC4, 0xED, 0x09, 0xFC, 0x90, 0xCC, 0x9E, 0x37, 0x0D, 0x6D, 0x4B,
+    0x40, 0xC7, 0x0C, 0x0E, 0xED, 0xAB, 0x34, 0xF5, 0xB7, 0x26, 0xCD, 0x3D, 0x9A, 0x64, 0x2F, 0x05,
+    0x1E, 0x56, 0xFC, 0xBF, 0xAF, 0xED, 0xD3, 0x2C, 0x69, 0x91, 0x93, 0xAE, 0xE3, 0x38, 0xA3, 0x31,
+    0xF9, 0x95, 0xBC, 0x4B, 0x3E, 0x26, 0x4F, 0x3F, 0x51, 0x9D, 0xFB, 0x4A, 0x89, 0x06, 0xCC, 0x27,
+    0x53, 0xD3, 0x64, 0x46, 0xC8, 0x3E, 0x94, 0x9E, 0x4A, 0xEB, 0xCD, 0x4A, 0x67, 0xBD, 0x90, 0x29,
+    0xDE, 0x6C, 0x7A, 0x13, 0x26, 0x9D, 0xA4, 0x75, 0xB0, 0x7C, 0x99, 0x04, 0x0A, 0x8F, 0x37, 0x49,
+    0x94, 0x07, 0x27, 0xD4, 0x78, 0xF2, 0xC2, 0xE7, 0x71, 0xD2, 0x93, 0xC8, 0x5C, 0x7C, 0x4C, 0xFF,
+    0x1B, 0xD8, 0xCF, 0x78, 0x75, 0x09, 0x3E, 0xF7, 0x43, 0x16, 0x32, 0x5E, 0xC5, 0x0A, 0x99, 0xA4,
+    0x0B, 0x8C, 0xC0, 0xAA, 0xFB, 0x5D, 0xD8, 0x73, 0xAF, 0x89, 0xC8, 0x75, 0xC4, 0x66, 0x8D, 0x85,
+    0x58, 0x06, 0xDE, 0x24, 0x10, 0x8D, 0x70, 0xC8, 0x7B, 0xE2, 0x39, 0x3C, 0x0D, 0xA0, 0xFF, 0x0A,
+    0xE4, 0xE9, 0xBA, 0xD0, 0x0E, 0x22, 0x59, 0xD6, 0x99, 0x26, 0x29, 0xEF, 0x0C, 0xE4, 0xAE, 0xC1,
+    0x9B, 0x65, 0xFA, 0xF4, 0xD2, 0xE0, 0x77, 0x7D, 0x86, 0x55, 0x10, 0x80, 0xF5, 0x58, 0x25, 0xD6,
+    0x79, 0xC2, 0xD0, 0xD7, 0x51, 0x2A, 0x2F, 0x8E, 0xF1, 0x4C, 0x76, 0x78, 0xA8, 0x9D, 0x7D, 0xC6,
+    0x8A, 0x33, 0x24, 0xC9, 0x3F, 0x6F, 0xC1, 0x57, 0x22, 0x52, 0x72, 0xE3, 0x46, 0xB8, 0x68, 0xCE,
+    0x91, 0x60, 0x09, 0x27, 0x71, 0xC7, 0x76, 0x3C, 0xEF, 0x91, 0xF0, 0x26, 0xD6, 0x4C, 0xC5, 0xDE,
+    0xC4, 0x56, 0x1A, 0xF3, 0x70, 0x8E, 0xD6, 0x57, 0xBF, 0x85, 0x13, 0xE0, 0xAB, 0xF7, 0x91, 0x43,
+    0x11, 0xBA, 0x0A, 0x2C, 0xE9, 0xAA, 0xA0, 0xDD, 0xB3, 0x84, 0xA0, 0x03, 0x14, 0x73, 0x8F, 0x6F,
+    0x92, 0xAE, 0x96, 0x93, 0x10, 0x22, 0xEC, 0xC7, 0x6F, 0x07, 0xFA, 0x6B, 0x1E, 0xB4, 0x16, 0x8E,
+    0x5E, 0xCD, 0x39, 0xE0, 0xCB, 0x57, 0x34, 0x84, 0x5E, 0xFB, 0xFE, 0x58, 0x8A, 0x5E, 0x95, 0xD6,
+    0x41, 0xCD, 0x75, 0x58, 0x41, 0x0B, 0x6C, 0x6C, 0xA4, 0x6C, 0xE2, 0xEB, 0x62, 0x42, 0x71, 0xD8,
+    0x1E, 0x26, 0x7B, 0xAD, 0x3C, 0xED, 0x28, 0x0B, 0xA9, 0x46, 0x52, 0xA5, 0xDC, 0x33, 0x64, 0x90,
+    0x04, 0xF3, 0xF2, 0x89, 0xC1, 0x59, 0x8C, 0x2C, 0xE2, 0xC0, 0x95, 0x3E, 0xF7, 0x24, 0x95, 0xE4,
+    0x8A, 0xD6, 0xF7, 0x34, 0xC3, 0x80, 0x1C, 0x38, 0xD2, 0x08, 0xA2, 0x62, 0x6C, 0x4D, 0x22, 0xAA,
+    0xF7, 0x7F, 0xF1, 0xAE, 0xF9, 0x83, 0x18, 0x58, 0xDF, 0xC4, 0x98, 0x6C, 0x17, 0x9D, 0x6A, 0x3A,
+    0x38, 0x07, 0x1F, 0x3D, 0xDE, 0xE3, 0x1B, 0x5A, 0xDB, 0xCA, 0xA7, 0xDC, 0x7B, 0x10, 0x92, 0x28,
+    0x5A, 0x97, 0x3F, 0xE1, 0x74, 0x92, 0xBF, 0x3F, 0xF0, 0x55, 0xBA, 0xD7, 0xAC, 0x0E, 0x9B, 0x45,
+    0x1A, 0x5D, 0x35, 0x72, 0x7F, 0x1C, 0x6B, 0x1B, 0x2B, 0xD0, 0xD5, 0x8E, 0xFE, 0x66, 0x75, 0x70,
+    0xD4, 0x32, 0x1B, 0x0C, 0xA1, 0x13, 0x84, 0xB2, 0x85, 0x91, 0x97, 0x28, 0x7A, 0xC6, 0x2C, 0xC0,
+    0x0D, 0x7A, 0xE1, 0x11, 0x36, 0x74, 0xDA, 0xBE, 0xAB, 0xC8, 0x87, 0xD9, 0x1B, 0x23, 0xAE, 0xE9,
+    0x1F, 0x3B, 0x74, 0xF4, 0xF9, 0x06, 0xA8, 0xA4, 0x60, 0x81, 0xAC, 0xD4, 0x79, 0x4E, 0x6F, 0xCD,
+    0x48, 0x3D, 0xC2, 0xA9, 0xA6, 0xF3, 0x5F, 0xE9, 0xBC, 0x9A, 0x9D, 0x21, 0x0D, 0xF5, 0x2B, 0xD1,
+    0xD2, 0x51, 0xEA, 0x0F, 0x4A, 0xD7, 0x4D, 0x5C, 0x54, 0xB3, 0x28, 0xA4, 0x18, 0x5C, 0x54, 0x53,
+    0x68, 0x6C, 0x12, 0x58, 0x74, 0x5D, 0xD7, 0x2B, 0x9B, 0xBF, 0x8E, 0x7E, 0xDB, 0x8D, 0x24, 0x2C,
+    0xD2, 0x8B, 0x3C, 0xA7, 0x53, 0x00, 0x6E, 0x96, 0xD0, 0x84, 0x98, 0x95, 0x8C, 0x79, 0xF8, 0x44,
+    0xEA, 0x15, 0x2D, 0x26, 0x55, 0x19, 0xFA, 0xA9, 0xE9, 0x94, 0xC7, 0xFC, 0x4E, 0x7E, 0x50, 0x59,
+    0xC7, 0x7A, 0xFE, 0xA0, 0xB1, 0x5E, 0x5F, 0xDF, 0xFC, 0x22, 0x97, 0xAB, 0xC6, 0x9D, 0xCE, 0xA0,
+    0xF1, 0xE7, 0xBE, 0xA4, 0xF8, 0x6F, 0x76, 0x72, 0x7C, 0x59, 0xC7, 0x04, 0x37, 0x69, 0x3D, 0xEA,
+    0x35, 0xB4, 0xC1, 0x3E, 0x5B, 0x2F, 0xD4, 0x8B, 0x75, 0x56, 0x67, 0x8D, 0xE2, 0xA5, 0x9B, 0x46,
+    0x50, 0x63, 0xBC, 0x68, 0x1D, 0x8F, 0x3C, 0x15, 0xF4, 0x8F, 0x42, 0x04, 0x41, 0x5E, 0xD6, 0xEB,
+    0x1D, 0xE2, 0xD4, 0xA1, 0x5E, 0x7B, 0x9D, 0xFE, 0x0F, 0x78, 0x27, 0xC3, 0x58, 0x01, 0xEC, 0x67,
+    0x34, 0x6A, 0xE8, 0x14, 0x1E, 0x8F, 0xFA, 0x25, 0xD4, 0x6E, 0x21, 0xF7, 0x12, 0x31, 0xD7, 0xD0,
+    0xD3, 0x63, 0x04, 0xC7, 0x3E, 0xC5, 0xD4, 0xB5, 0xC2, 0xF2, 0x55, 0x5E, 0x1B, 0x75, 0xE1, 0xB0,
+    0xF7, 0xC2, 0x82, 0x6D, 0x8A, 0x93, 0xB3, 0x6A, 0xDF, 0x8F, 0xCB, 0x06, 0x0F, 0xEE, 0x8E, 0xAB,
+    0xF5, 0x63, 0x4D, 0xCB, 0x38, 0x47, 0xE9, 0x78, 0xC8, 0x1B, 0x38, 0xEA, 0x35, 0x4A, 0x8F, 0x91,
+    0xCB, 0x9B, 0x4B, 0xA8, 0x9C, 0x47, 0x61, 0x11, 0x6C, 0x05, 0xD6, 0x56, 0x56, 0x1F, 0x39, 0xBA,
+    0x1B, 0x28, 0x2C, 0xC3, 0xDE, 0xA2, 0xF2, 0x06, 0x73, 0x88, 0xC5, 0x06, 0x6E, 0x6E, 0xE0, 0x7A,
+    0x19, 0x7F, 0x03, 0xDD, 0x7D, 0x4D, 0xB0, 0xDC, 0xD6, 0x95, 0xDE, 0x45, 0x37, 0xF9, 0x90, 0x11,
+    0x62, 0x41, 0x0B, 0xC9, 0x56, 0xCC, 0x11, 0x7B, 0x16, 0x5A, 0xD8, 0x92, 0x48, 0x64, 0xE1, 0x05,
+    0x33, 0x79, 0x24, 0x20, 0x7B, 0xE9, 0xC5, 0x30, 0x55, 0x7A, 0xD2, 0x42, 0x0B, 0xCE, 0x32, 0x9E,
+    0x54, 0xFC, 0x66, 0xC1, 0xAA, 0x30, 0x2E, 0x52, 0x80, 0xAC, 0x4A, 0xBC, 0x48, 0xD5, 0xF8, 0xA5,
+    0x6A, 0x3C, 0x9B, 0x59, 0x98, 0x0B, 0xB9, 0xCA, 0x7E, 0x5C, 0x3C, 0x2D, 0x98, 0x1A, 0x26, 0x21,
+    0x1F, 0x20, 0x6B, 0xE1, 0x45, 0xAA, 0x32, 0x2D, 0x4F, 0x64, 0x2F, 0xB2, 0x18, 0xD8, 0xA6, 0xFF,
+    0xA4, 0xA4, 0x04, 0xD9, 0xAD, 0x08, 0x8F, 0x02, 0x70, 0x73, 0xBE, 0xEF, 0x5C, 0xA0, 0xBB, 0xDF,
+    0x0F, 0x49, 0x89, 0xA4, 0x48, 0x99, 0x52, 0x9F, 0x83, 0xD7, 0x8D, 0x9F, 0x7B, 0xCF, 0xBD, 0xF7,
+    0xDC, 0xF3, 0x0F, 0x63, 0xF0, 0x2F, 0xCE, 0x04, 0x4C, 0x0A, 0x01, 0x7E, 0x29, 0xC0, 0xAB, 0xF0,
+    0xE5, 0x79, 0x80, 0x43, 0x46, 0xFF, 0xE5, 0xD6, 0xDA, 0x62, 0x1D, 0x60, 0xDC, 0x98, 0xA0, 0x18,
+    0x35, 0x66, 0x0C, 0x30, 0x9A, 0xF6, 0xC0, 0x98, 0xDD, 0xA0, 0x5D, 0x7B, 0xCE, 0x8C, 0xAC, 0x6D,
+    0xDC, 0xD1, 0x7E, 0xA7, 0xF4, 0xE0, 0x2C, 0xC0, 0x65, 0x80, 0x19, 0xEE, 0x37, 0x7B, 0x51, 0x1E,
+    0x34, 0xC3, 0x23, 0x2B, 0x6D, 0xC0, 0x4B, 0x5E, 0x2D, 0x4D, 0xC0, 0xEF, 0xE9, 0x48, 0x8E, 0x1E,
+    0x35, 0xA7, 0xCD, 0xFC, 0xDF, 0xFD, 0x6A, 0x5A, 0x2C, 0xA0, 0x13, 0xDA, 0x09, 0xB2, 0xC6, 0x9C,
+    0x32, 0xDB, 0x26, 0x36, 0x66, 0x55, 0xD0, 0x44, 0x51, 0x68, 0xCC, 0x09, 0x45, 0x4F, 0x0A, 0x3A,
+    0x8C, 0xA6, 0x6E, 0x6B, 0x8B, 0x77, 0xA1, 0xC8, 0x4E, 0xB5, 0x1B, 0x78, 0x66, 0xBE, 0x31, 0xB2,
+    0xFA, 0x5B, 0x9E, 0x10, 0x61, 0x6C, 0x04, 0x45, 0xC5, 0xC1, 0xC8, 0x9D, 0x92, 0xCA, 0x75, 0x72,
+    0xAD, 0xB4, 0xE9, 0x73, 0xF6, 0x7F, 0x4D, 0x6A, 0x34, 0xAD, 0x89, 0x30, 0xB2, 0x2B, 0x17, 0x05,
+    0x84, 0x18, 0x59, 0xFE, 0x79, 0x0A, 0x4F, 0xAD, 0x31, 0xCE, 0x53, 0xB3, 0x8B, 0x8E, 0x59, 0x4F,
+    0xC7, 0xC9, 0x40, 0xC7, 0x39, 0xF0, 0x92, 0x9B, 0x52, 0xEA, 0xB6, 0xC1, 0x18, 0xE0, 0x45, 0xFB,
+    0xD7, 0x78, 0x64, 0xDD, 0x3F, 0xDD, 0x03, 0x2D, 0x27, 0x37, 0x84, 0x14, 0x79, 0x12, 0x56, 0x78,
+    0x64, 0xE5, 0x57, 0x02, 0xA4, 0xD9, 0xA3, 0x82, 0x53, 0x13, 0x9D, 0xD5, 0x99, 0xBA, 0x00, 0x30,
+    0x45, 0x04, 0x94, 0x8B, 0xDF, 0x0D, 0x27, 0x4F, 0xA6, 0x7D, 0xBF, 0x83, 0x99, 0x31, 0x8F, 0xE0,
+    0xB9, 0xAF, 0x19, 0x9B, 0xF9, 0xBC, 0xA4, 0x30, 0x3E, 0x1E, 0x69, 0x0E, 0x27, 0xDA, 0x80, 0xB4,
+    0x4B, 0xC6, 0x5D, 0x5E, 0x86, 0xD3, 0xF1, 0x2C, 0xCA, 0xBC, 0x3A, 0x4E, 0x4C, 0x2D, 0xE3, 0x79,
+    0x51, 0x30, 0x6F, 0x1B, 0xC9, 0x6D, 0xC2, 0x56, 0x1A, 0x8F, 0xC1, 0xCA, 0xE5, 0x60, 0x22, 0x77,
+    0x30, 0xB9, 0xAC, 0x94, 0xB0, 0xC1, 0x8C, 0x92, 0x3B, 0x74, 0xFF, 0x44, 0x86, 0x61, 0x55, 0x3E,
+    0x17, 0x8C, 0xB9, 0x26, 0x83, 0xD1, 0xC4, 0xD9, 0xA8, 0x0E, 0x77, 0xD6, 0xCB, 0x91, 0xED, 0x12,
+    0x3C, 0x27, 0xB7, 0xD5, 0xBA, 0xBD, 0x28, 0xCD, 0x18, 0x7D, 0xAC, 0xFF, 0xE5, 0xC2, 0x17, 0xED,
+    0x86, 0xDC, 0xC4, 0x98, 0xE4, 0xA5, 0x71, 0x99, 0xFB, 0xD5, 0x4B, 0x7E, 0xF5, 0xA8, 0x97, 0xF4,
+    0xC3, 0x77, 0x77, 0x6E, 0x1E, 0xC8, 0x6C, 0x5E, 0xB1, 0x37, 0x94, 0x8E, 0xD1, 0xBD, 0xFC, 0x08,
+    0x55, 0x41, 0x5D, 0x4C, 0x5B, 0x21, 0x5F, 0x24, 0x43, 0x94, 0x66, 0x98, 0x08, 0x58, 0x61, 0xF2,
+    0xDD, 0x96, 0xE0, 0xEB, 0x60, 0x49, 0x05, 0xA6, 0xB4, 0x50, 0xBE, 0xC0, 0x69, 0xB7, 0xC6, 0x7E,
+    0x36, 0xE0, 0xEE, 0x7B, 0x09, 0xB1, 0xB5, 0xAD, 0xFE, 0xBD, 0x96, 0x67, 0x26, 0x48, 0xE4, 0xF7,
+    0x49, 0xA9, 0x58, 0xE6, 0x42, 0x08, 0x3C, 0xAE, 0xB1, 0x50, 0x89, 0x27, 0xC4, 0x8D, 0x89, 0x1C,
+    0x3E, 0xE5, 0xBE, 0xBF, 0x4A, 0x0C, 0x2E, 0x20, 0x38, 0xAC, 0xA4, 0x8D, 0x5E, 0x2B, 0x44, 0x92,
+    0x29, 0x70, 0x04, 0x1C, 0x20, 0x2D, 0x30, 0xAB, 0xAE, 0x2F, 0x70, 0xCC, 0x2A, 0xC4, 0x63, 0x65,
+    0x50, 0x02, 0x4C, 0x73, 0xCC, 0x3E, 0x79, 0x3A, 0x97, 0x00, 0xBA, 0x4D, 0x6C, 0x3E, 0x02, 0xEE,
+    0x36, 0x37, 0xED, 0xDB, 0xAF, 0x82, 0x6F, 0xE1, 0x5F, 0xA6, 0xF7, 0x59, 0xAF, 0xF4, 0xF7, 0x71,
+    0xAD, 0xD8, 0x6B, 0xDC, 0xF9, 0xAD, 0xC3, 0xDD, 0x2E, 0xDC, 0x2E, 0x9F, 0x37, 0x6E, 0xD0, 0xAE,
+    0x54, 0xFA, 0x23, 0xA3, 0xBF, 0x82, 0xC5, 0x2F, 0xED, 0x9E, 0x58, 0xBB, 0x63, 0xEE, 0x3E, 0x7B,
+    0xAB, 0xC9, 0xDE, 0xFC, 0x56, 0x7F, 0x73, 0x5C, 0x2E, 0x55, 0x14, 0xDF, 0x06, 0x4A, 0x78, 0x91,
+    0x20, 0x61, 0x6F, 0x26, 0xBE, 0x0E, 0xF6, 0x66, 0x62, 0xDC, 0xED, 0x29, 0x25, 0x38, 0x61, 0xC3,
+    0xA9, 0xC0, 0x0D, 0xCC, 0x07, 0x0F, 0x30, 0x0F, 0x9B, 0xE5, 0x7F, 0x1C, 0x97, 0x29, 0x47, 0x25,
+    0x93, 0xBE, 0x7B, 0x3A, 0xFB, 0x2B, 0x40, 0xB9, 0x40, 0xE0, 0x84, 0x34, 0x3F, 0x49, 0x38, 0x03,
+    0x1C, 0x4F, 0x01, 0x03, 0x8C, 0x5D, 0xBB, 0x8E, 0x91, 0x10, 0xEA, 0xE3, 0x38, 0xE5, 0xF7, 0x61,
+    0x05, 0xE8, 0x83, 0x09, 0x34, 0xA3, 0x8E, 0x57, 0xD9, 0x04, 0x30, 0xD6, 0xBB, 0xF1, 0xCE, 0x41,
+    0xCD, 0xA7, 0x70, 0x3E, 0xC9, 0xCF, 0x42, 0x6B, 0x93, 0x5E, 0xC7, 0x4A, 0x0E, 0x9A, 0xBE, 0x5D,
+    0x23, 0x77, 0xD4, 0x29, 0x8A, 0x15, 0x85, 0x99, 0xFE, 0xE8, 0x38, 0x75, 0xB2, 0xD4, 0x8F, 0xB1,
+    0xB5, 0x89, 0x74, 0x04, 0xEC, 0x05, 0xF7, 0xD5, 0x47, 0x99, 0x70, 0xBA, 0x88, 0x62, 0x45, 0x39,
+    0xD1, 0xE8, 0x5D, 0xA2, 0xE0, 0xDB, 0x44, 0x13, 0x3D, 0xE5, 0xBC, 0xA2, 0x8A, 0x68, 0x5C, 0x10,
+    0x85, 0x09, 0xD1, 0x49, 0xBD, 0xCB, 0x15, 0xA2, 0xAE, 0x24, 0x92, 0xBE, 0x13, 0xED, 0x7E, 0x90,
+    0x20, 0x34, 0x42, 0xD8, 0xAD, 0xF4, 0xCE, 0xCB, 0x77, 0x5C, 0x03, 0x33, 0xD9, 0x36, 0xC0, 0xA2,
+    0xC2, 0x02, 0xA2, 0x45, 0x38, 0x0D, 0x04, 0x06, 0x3B, 0x20, 0x1D, 0x39, 0xFE, 0xE2, 0x3F, 0x6B,
+    0xA7, 0xA1, 0x2D, 0x73, 0x9B, 0x3D, 0x64, 0x4B, 0xD0, 0xE5, 0x25, 0xDE, 0xF0, 0x3C, 0xEF, 0x7E,
+    0x85, 0x84, 0xA9, 0x30, 0xCA, 0x5E, 0x09, 0x8E, 0x0C, 0x8A, 0x44, 0x85, 0xAC, 0x79, 0xE1, 0xF2,
+    0x3E, 0xEE, 0x5F, 0x85, 0x18, 0xF2, 0xD9, 0x51, 0x6E, 0x30, 0xCF, 0x60, 0x47, 0x69, 0x57, 0x79,
+    0xD7, 0xB3, 0xE4, 0xEE, 0x9C, 0x11, 0x31, 0xF6, 0x02, 0x15, 0x74, 0x1C, 0x65, 0x43, 0x52, 0x34,
+    0x02, 0xD8, 0xE4, 0x00, 0xE4, 0xF5, 0xFC, 0xC4, 0xC3, 0x8E, 0xCE, 0x81, 0xED, 0x84, 0xCC, 0xC2,
+    0x14, 0xD1, 0x9E, 0x18, 0x5B, 0xA1, 0x3C, 0x9A, 0x30, 0xBB, 0xC7, 0x10, 0x5B, 0xB1, 0x40, 0x08,
+    0x1D, 0xF6, 0xFD, 0xDC, 0xEA, 0x5A, 0x8C, 0xD8, 0xD0, 0x50, 0xE7, 0x38, 0x1B, 0x3A, 0x9E, 0x3A,
+    0x06, 0x38, 0x40, 0x9D, 0x29, 0x01, 0xBF, 0x0F, 0xB5, 0xD7, 0x3C, 0x1F, 0x5C, 0x56, 0x56, 0x33,
+    0x3B, 0x79, 0x8E, 0xF7, 0x99, 0x91, 0x59, 0x56, 0x58, 0x3D, 0xA3, 0x32, 0xE6, 0x0D, 0xB0, 0xDF,
+    0xF9, 0xDC, 0x74, 0x03, 0xCC, 0x03, 0x59, 0xE3, 0xB8, 0xC5, 0x51, 0x30, 0x4B, 0x13, 0x6F, 0x5E,
+    0x9A, 0x91, 0x2B, 0x70, 0x50, 0x64, 0xF5, 0x60, 0x50, 0x5A, 0x8A, 0x8C, 0x39, 0xA7, 0x69, 0xCA,
+    0x16, 0xC4, 0x19, 0x9E, 0x1D, 0x17, 0xEB, 0x3B, 0xE6, 0xB0, 0x9D, 0x49, 0xAB, 0x85, 0x86, 0x83,
+    0x80, 0x81, 0x75, 0x37, 0x41, 0x07, 0xFD, 0x6C, 0x49, 0xC0, 0xD8, 0x2B, 0x2E, 0x58, 0x59, 0x28,
+    0x23, 0xF0, 0x21, 0xF9, 0x33, 0xC7, 0x29, 0x61, 0x89, 0xF9, 0x0B, 0xA6, 0xE7, 0x13, 0xCC, 0x06,
+    0x50, 0xF5, 0x3F, 0xF0, 0x94, 0x14, 0x34, 0xEB, 0xC0, 0x75, 0x4A, 0x01, 0xDD, 0x86, 0xB0, 0x61,
+    0xF9, 0x53, 0x9E, 0x9B, 0xE3, 0x91, 0x93, 0x69, 0x7F, 0x1E, 0x45, 0x8D, 0x70, 0xB8, 0x2C, 0xC4,
+    0x0F, 0x32, 0xB9, 0xDA, 0xE7, 0x5B, 0x3C, 0x57, 0x56, 0x6D, 0xFB, 0x3C, 0xAF, 0xE0, 0xAF, 0x7C,
+    0x06, 0x39, 0xED, 0xB8, 0x59, 0x06, 0x35, 0x7F, 0x45, 0xB7, 0x4A, 0x8C, 0x55, 0x96, 0x63, 0x27,
+    0xB8, 0x6F, 0x02, 0x15, 0xA6, 0x49, 0xCB, 0xFD, 0xB3, 0xC6, 0xD4, 0x90, 0xE1, 0x04, 0x4C, 0x30,
+    0x3C, 0x31, 0x27, 0xC8, 0xCD, 0x60, 0x06, 0xE8, 0x2B, 0x4C, 0x00, 0x03, 0x32, 0xA3, 0x70, 0x01,
+    0x1E, 0x35, 0xBA, 0x17, 0xCC, 0xE1, 0x15, 0x42, 0x4C, 0x0F, 0x99, 0x44, 0x80, 0x29, 0xDB, 0xC0,
+    0x19, 0xDB, 0x71, 0xD7, 0xEB, 0xB8, 0x1D, 0x6C, 0x5F, 0xE5, 0xF4, 0xBB, 0x02, 0x78, 0xFC, 0x32,
+    0xE0, 0xD1, 0xD7, 0xC8, 0xA4, 0x1F, 0xA1, 0xB2, 0x71, 0xBF, 0x44, 0xF9, 0xD0, 0x16, 0x29, 0xB6,
+    0xBD, 0x2C, 0xC0, 0x80, 0x95, 0x47, 0x84, 0x81, 0x77, 0xE4, 0xD6, 0x33, 0xF0, 0x06, 0x8F, 0x3B,
+    0x83, 0x30, 0x0C, 0x39, 0x00, 0xBF, 0x18, 0x4F, 0xE5, 0xE0, 0x38, 0xF5, 0x24, 0x39, 0xA0, 0x9A,
+    0x74, 0x45, 0x0E, 0xB8, 0xBE, 0x4E, 0x7A, 0x8D, 0x2E, 0xC6, 0xD0, 0xE3, 0x8E, 0x21, 0xE4, 0xFB,
+    0x49, 0x7B, 0x86, 0x8B, 0x31, 0x44, 0xBF, 0xC8, 0x5C, 0x7E, 0xD2, 0xAE, 0x73, 0x49, 0xA6, 0xCF,
+    0x36, 0xBA, 0x8A, 0xAD, 0xC7, 0x6D, 0x58, 0x06, 0x52, 0xF6, 0x65, 0xAC, 0x47, 0xBF, 0x96, 0x1B,
+    0x5A, 0xAE, 0x72, 0x0F, 0x93, 0x59, 0x9A, 0x81, 0x87, 0x46, 0x58, 0x5F, 0x6C, 0x46, 0x85, 0xBD,
+    0x10, 0x0D, 0xE3, 0xAE, 0x02, 0x42, 0x75, 0x26, 0xAA, 0x45, 0x12, 0xD9, 0x30, 0x76, 0x9A, 0x6E,
+    0x80, 0x6B, 0x99, 0xA8, 0x52, 0xC9, 0x3A, 0x97, 0xEE, 0x84, 0xDD, 0xD6, 0x4C, 0x2E, 0x97, 0x9B,
+    0xCB, 0x3C, 0xB0, 0x18, 0xAC, 0x1C, 0xC3, 0x98, 0x0E, 0x1B, 0x27, 0x01, 0x1E, 0x8D, 0x3E, 0x1F,
+    0x5E, 0xC7, 0x13, 0x45, 0x68, 0x35, 0x87, 0xB7, 0x66, 0xC6, 0x89, 0xB7, 0x7A, 0xCA, 0x5C, 0xC4,
+    0x8E, 0x8B, 0x93, 0xF8, 0xF3, 0x25, 0x80, 0x14, 0xB7, 0x8A, 0x0B, 0xAF, 0x33, 0x93, 0x9D, 0xF5,
+    0xDA, 0xED, 0x90, 0x87, 0x4F, 0x7F, 0x8A, 0x76, 0x29, 0x73, 0x9A, 0x82, 0xF4, 0xB8, 0x1C, 0x81,
+    0x6A, 0xB2, 0x96, 0xD1, 0xEF, 0x71, 0xB7, 0x5E, 0xE9, 0x1E, 0x90, 0x99, 0xBD, 0x62, 0xC4, 0xA7,
+    0xA2, 0x63, 0x0F, 0x9A, 0xB8, 0x43, 0xF1, 0xBE, 0x21, 0x73, 0xFA, 0x0D, 0x5A, 0x90, 0x26, 0x60,
+    0x3C, 0xA9, 0x39, 0x10, 0x0A, 0x2B, 0xDA, 0x17, 0x8A, 0xF8, 0x3E, 0xC0, 0x50, 0x21, 0xE7, 0xF3,
+    0x84, 0x30, 0x22, 0x3C, 0x45, 0x78, 0x15, 0x90, 0xC6, 0x03, 0x03, 0xC5, 0x22, 0x87, 0xD6, 0xF6,
+    0x59, 0x7B, 0x5D, 0x56, 0x55, 0x64, 0x9B, 0x43, 0x6E, 0x34, 0x21, 0x42, 0x80, 0x4E, 0x50, 0xF5,
+    0xEC, 0xC6, 0x18, 0x2B, 0x35, 0xAE, 0x39, 0x62, 0xE6, 0x5F, 0xCE, 0x04, 0xCB, 0x82, 0xFD, 0x3B,
+    0xC1, 0xBF, 0x96, 0xEE, 0xFF, 0x5E, 0xF0, 0x2F, 0x44, 0xFA, 0x97, 0xCF, 0xE8, 0xE7, 0x42, 0xCF,
+    0x37, 0x04, 0xFF, 0x4C, 0xBA, 0x0B, 0x5C, 0x76, 0xC6, 0x7F, 0x05, 0x38, 0x37, 0xE1, 0x18, 0x38,
+    0x4E, 0x1C, 0xCE, 0x8E, 0x11, 0x47, 0xC5, 0x2A, 0x71, 0x38, 0x3D, 0xA1, 0xB8, 0xBA, 0x4C, 0xEC,
+    0x57, 0x15, 0xF1, 0xF8, 0xFD, 0x92, 0x78, 0xD4, 0x15, 0xC4, 0x9E, 0x55, 0x2C, 0x7A, 0x2B, 0x70,
+    0x25, 0xCD, 0x17, 0x5D, 0xE4, 0x45, 0x91, 0xCF, 0xB1, 0x40, 0x73, 0x2B, 0x23, 0x97, 0x43, 0x68,
+    0xAA, 0x7C, 0xD9, 0x64, 0x29, 0xA5, 0x70, 0x9B, 0x03, 0xAB, 0x40, 0x97, 0x27, 0xC5, 0x47, 0x41,
+    0xED, 0xDA, 0x9A, 0xAC, 0x7C, 0x6A, 0x18, 0xF3, 0xBF, 0x3E, 0xF2, 0x5D, 0x14, 0xB9, 0x46, 0xCC,
+    0x67, 0x23, 0x1A, 0xD8, 0xCB, 0xBA, 0x50, 0x8C, 0x4C, 0x74, 0x43, 0x96, 0x85, 0x30, 0x5A, 0xBF,
+    0x46, 0x97, 0x70, 0x50, 0x51, 0x15, 0x81, 0xE0, 0x90, 0x4D, 0xA8, 0x25, 0x46, 0x94, 0xEF, 0xC0,
+    0x6E, 0xC2, 0x12, 0x9C, 0xC7, 0xC1, 0xEA, 0x00, 0x58, 0xEA, 0x99, 0x7A, 0x15, 0xEE, 0x30, 0x29,
+    0xF4, 0x6E, 0x41, 0xA5, 0x4A, 0x12, 0xA5, 0xC8, 0x8E, 0x07, 0xF1, 0x2F, 0xC1, 0x84, 0xD5, 0x06,
+    0x40, 0x23, 0x80, 0x6E, 0x56, 0xD8, 0x7D, 0x54, 0xD0, 0x8B, 0x3E, 0x49, 0x41, 0x2F, 0x53, 0xD1,
+    0x52, 0xA8, 0x75, 0x18, 0x82, 0x9E, 0xAC, 0x59, 0xDB, 0x8B, 0x2D, 0x90, 0x31, 0xBC, 0x1C, 0xA2,
+    0x42, 0x54, 0x2C, 0x89, 0x2D, 0xC1, 0x32, 0x58, 0x10, 0x60, 0xE4, 0x3C, 0xCF, 0x3A, 0x01, 0xA6,
+    0xDB, 0x4C, 0xEE, 0xC0, 0x1E, 0x23, 0x23, 0x94, 0xE3, 0x69, 0xF5, 0x41, 0xF6, 0x98, 0xFD, 0x8C,
+    0x32, 0xBB, 0xC0, 0x47, 0xB6, 0xC7, 0x50, 0xF5, 0xA4, 0xE2, 0x79, 0x0A, 0xDB, 0xCA, 0xAA, 0x80,
+    0x09, 0x40, 0x78, 0x02, 0xE0, 0x49, 0x01, 0x87, 0xDD, 0xD6, 0x75, 0xC7, 0x00, 0x46, 0xB6, 0xCF,
+    0xC2, 0xCC, 0x10, 0xCB, 0xC3, 0x1F, 0x4C, 0x05, 0xC4, 0x98, 0xC7, 0xD6, 0x68, 0xEF, 0x4C, 0x2D,
+    0xEF, 0x31, 0x56, 0xB5, 0xC9, 0x6B, 0xDC, 0xE6, 0xBE, 0x83, 0xEB, 0x6D, 0x27, 0x82, 0xAE, 0xD7,
+    0x79, 0xE0, 0xCC, 0xFE, 0x4C, 0x7E, 0x93, 0x51, 0x2B, 0x3D, 0x4C, 0x85, 0xA8, 0xF0, 0x20, 0xF0,
+    0xC6, 0x14, 0x1B, 0x84, 0x1D, 0x51, 0x7A, 0x48, 0x97, 0x90, 0xFB, 0xD2, 0x9D, 0xE2, 0x2E, 0xD0,
+    0xCB, 0x33, 0x77, 0x33, 0x77, 0x6B, 0x90, 0x49, 0x1E, 0xD4, 0x3F, 0xD6, 0x35, 0x02, 0x9C, 0x7E,
+    0xA1, 0x81, 0x7F, 0xB1, 0x79, 0x11, 0x27, 0x96, 0x22, 0x55, 0x89, 0xEE, 0x2F, 0xFB, 0x8E, 0xEC,
+    0x56, 0x30, 0xE0, 0x5A, 0xCA, 0x86, 0x69, 0x36, 0xE6, 0xD2, 0x0E, 0x49, 0xB3, 0xA3, 0xA4, 0xD9,
+    0x2A, 0x69, 0x46, 0xD5, 0xC4, 0xB2, 0xE3, 0xB9, 0x0A, 0x4A, 0x84, 0x51, 0x39, 0xA7, 0xDF, 0x07,
+    0x9C, 0xB4, 0x6F, 0x52, 0x44, 0x2A, 0x28, 0x1F, 0x71, 0x8E, 0x9D, 0xA4, 0x64, 0x74, 0x9E, 0x62,
+    0xD1, 0x8C, 0xFC, 0xA4, 0x42, 0x9B, 0x44, 0xF9, 0x38, 0x02, 0x9B, 0x56, 0x12, 0xDB, 0x4A, 0xD5,
+    0x38, 0xE5, 0x90, 0x37, 0x8C, 0xAE, 0x36, 0xA3, 0x0B, 0x5C, 0x51, 0xF6, 0x89, 0xA3, 0xB1, 0xA2,
+    0x17, 0x55, 0xAD, 0xEB, 0xB5, 0x3B, 0xAE, 0xBD, 0x25, 0x1B, 0xC0, 0xC4, 0x99, 0x02, 0x96, 0x50,
+    0xE0, 0x96, 0xA9, 0x10, 0x7D, 0x26, 0x1D, 0x8B, 0x6C, 0x29, 0xFD, 0xC2, 0x86, 0x2C, 0xDD, 0xD2,
+    0x5E, 0xE9, 0xDD, 0x0F, 0x82, 0xED, 0x02, 0xB4, 0x84, 0xB2, 0xBF, 0x8B, 0xA4, 0x1E, 0x41, 0x69,
+    0xC1, 0x52, 0x5C, 0x17, 0xBA, 0x3E, 0x96, 0xD0, 0x60, 0x6C, 0x6E, 0x0E, 0x39, 0x4C, 0xC2, 0xB6,
+    0x54, 0xC6, 0x15, 0x42, 0xA7, 0xB6, 0xB0, 0x94, 0x39, 0xD6, 0x21, 0x7F, 0x6C, 0x8C, 0x69, 0x5D,
+    0xF4, 0x55, 0x26, 0xA8, 0x21, 0x60, 0x3E, 0xE8, 0x07, 0xB5, 0x1B, 0x14, 0x8B, 0x1D, 0x56, 0xFF,
+    0x4D, 0xFF, 0x10, 0xFA, 0x35, 0xEB, 0xFB, 0x85, 0xEE, 0xE8, 0xBF, 0xD2, 0xF1, 0xFB, 0xA8, 0x3F,
+    0xF0, 0xFB, 0x83, 0x71, 0x7F, 0x30, 0xEA, 0x0F, 0xBC, 0xFE, 0xC0, 0x0C, 0x07, 0x09, 0x2D, 0xF0,
+    0x6A, 0x82, 0x17, 0x71, 0x0B, 0xAC, 0x69, 0x95, 0x36, 0x38, 0x85, 0x27, 0x08, 0x9F, 0x54, 0xAB,
+    0xDC, 0x12, 0xA4, 0x69, 0x56, 0x0D, 0xB3, 0xA6, 0x5D, 0x83, 0xD8, 0xD5, 0x70, 0x7F, 0xC0, 0x66,
+    0x06, 0xE8, 0xCF, 0x00, 0xB1, 0x51, 0xEF, 0x82, 0xFC, 0x5E, 0xB6, 0x0C, 0xF2, 0x2A, 0xA3, 0xDA,
+    0xD1, 0x11, 0x9A, 0x2A, 0x53, 0x55, 0xF6, 0x2B, 0xE3, 0x44, 0x21, 0x43, 0x59, 0x88, 0x92, 0x86,
+    0x0A, 0x43, 0xBD, 0x74, 0x72, 0x5B, 0xB8, 0xFB, 0x9E, 0x62, 0x6C, 0xA2, 0x94, 0x8D, 0x9E, 0xB7,
+    0x89, 0xFE, 0x1E, 0x15, 0x8A, 0xC3, 0x52, 0x71, 0x50, 0x29, 0xF6, 0x7B, 0x3C, 0xDB, 0x85, 0xAB,
+    0xE5, 0xF3, 0xC2, 0xA9, 0xE2, 0x34, 0x93, 0x55, 0x0A, 0x33, 0x85, 0x0A, 0x48, 0x76, 0x23, 0x20,
+    0x1B, 0xA8, 0x68, 0x33, 0x76, 0x4C, 0xF5, 0x16, 0xDA, 0x3F, 0x1A, 0xD9, 0xDB, 0x29, 0xEC, 0xB2,
+    0x88, 0x70, 0x0B, 0x23, 0xC9, 0x94, 0x0D, 0xE8, 0x8D, 0x24, 0x1B, 0x6E, 0x80, 0xF3, 0x0E, 0xAA,
+    0xA2, 0xC8, 0xC7, 0xB4, 0x3C, 0xF5, 0xAA, 0x62, 0x9C, 0x1D, 0xDD, 0xB3, 0x83, 0x53, 0x71, 0x15,
+    0x70, 0x78, 0xED, 0x4C, 0x05, 0xA6, 0xE1, 0x8E, 0x0C, 0x87, 0xCF, 0xFD, 0x5A, 0xF6, 0x60, 0x02,
+    0x55, 0x31, 0x2A, 0xA0, 0x2A, 0x26, 0x29, 0x36, 0x52, 0x1A, 0xD1, 0x44, 0x55, 0x14, 0x61, 0xC2,
+    0x52, 0xCD, 0x5C, 0x36, 0x6C, 0xCA, 0x0D, 0x33, 0x43, 0xD5, 0x6A, 0xAB, 0xC6, 0x1A, 0x93, 0x9B,
+    0xE4, 0xD4, 0x31, 0x32, 0x95, 0x97, 0x20, 0xEC, 0xA3, 0x03, 0xB0, 0xEA, 0x4B, 0x6F, 0xB0, 0x0B,
+    0xC1, 0x30, 0x0F, 0x9A, 0xC0, 0x14, 0x03, 0xC6, 0x0A, 0xBB, 0x0C, 0x66, 0x8C, 0x7C, 0xDB, 0xBE,
+    0xA0, 0x98, 0x16, 0x68, 0xFC, 0xFD, 0xA2, 0xE2, 0xFE, 0xF7, 0x39, 0x56, 0xAD, 0x66, 0xB8, 0x4F,
+    0x7F, 0xDF, 0xFE, 0x39, 0xD0, 0x80, 0x55, 0xC0, 0x4A, 0xA4, 0x4B, 0x68, 0xD7, 0x54, 0x9A, 0x22,
+    0x32, 0xDB, 0xB8, 0x7B, 0xB1, 0x61, 0xBB, 0x53, 0xEB, 0x0C, 0xB5, 0xDC, 0xB0, 0x3F, 0x2F, 0xEB,
+    0x0C, 0x93, 0x51, 0xC8, 0x3B, 0x99, 0x71, 0xCB, 0x81, 0x0C, 0x0F, 0x09, 0x7E, 0x46, 0x29, 0x74,
+    0x17, 0xB4, 0x66, 0xFE, 0xAB, 0x9E, 0x29, 0x57, 0xCD, 0x38, 0xC0, 0x33, 0xD2, 0x45, 0xA0, 0xD7,
+    0xE1, 0x9B, 0x71, 0x03, 0xE8, 0xF3, 0xD7, 0x90, 0xAA, 0x6A, 0x04, 0x2D, 0x01, 0x7B, 0x6B, 0x7F,
+    0x9F, 0x91, 0xFA, 0x32, 0x6A, 0xB3, 0xDE, 0x25, 0xA2, 0x84, 0xF6, 0x0B, 0x9D, 0x62, 0x5D, 0xB0,
+    0x23, 0x72, 0x3D, 0x4D, 0xB1, 0x61, 0x21, 0x3B, 0xA5, 0x5F, 0xD0, 0x5E, 0x3E, 0x00, 0xEF, 0x85,
+    0x0A, 0x5E, 0x98, 0xCA, 0x84, 0x3B, 0xF2, 0xA7, 0xB4, 0xA4, 0x82, 0x51, 0x6F, 0x00, 0x7E, 0x45,
+    0x7F, 0x81, 0xFC, 0x70, 0x7C, 0x66, 0x26, 0xF6, 0xBD, 0x56, 0xBA, 0xF8, 0xBA, 0xE8, 0x4F, 0x8F,
+    0x3A, 0x6E, 0x01, 0xB0, 0x4E, 0x11, 0x01, 0x72, 0x49, 0x4B, 0xBB, 0xAE, 0x08, 0x2D, 0x32, 0xC2,
+    0x41, 0xD9, 0x0B, 0x3C, 0x47, 0x41, 0xA0, 0x67, 0x26, 0xF2, 0xC3, 0x2A, 0x46, 0xE3, 0x4F, 0x4B,
+    0x03, 0x57, 0x8A, 0xDC, 0x37, 0xCD, 0x30, 0x45, 0x12, 0x19, 0x66, 0x28, 0x71, 0x05, 0xF4, 0x39,
+    0x05, 0xB1, 0x03, 0x51, 0x11, 0xE3, 0xD7, 0x09, 0xCE, 0x0B, 0x71, 0x85, 0x8F, 0x6B, 0xBD, 0xF6,
+    0x45, 0x10, 0x81, 0x6A, 0x3A, 0xAD, 0x0E, 0xF2, 0xB8, 0x75, 0x74, 0x81, 0xC3, 0x27, 0xE4, 0x68,
+    0x97, 0x01, 0xBE, 0x83, 0x38, 0x2B, 0x1A, 0xBC, 0x19, 0xDF, 0xD8, 0x9A, 0xC9, 0x9F, 0x1E, 0x7F,
+    0x48, 0x01, 0xE2, 0x01, 0xA4, 0x7A, 0xC5, 0x7A, 0x27, 0xF3, 0x90, 0xCB, 0x44, 0x40, 0x85, 0x1B,
+    0xCB, 0x7D, 0x41, 0xF7, 0xFE, 0xF3, 0x1A, 0x47, 0xE5, 0x56, 0x1F, 0x99, 0x66, 0xEB, 0xDD, 0x69,
+    0x4E, 0x94, 0x31, 0xB4, 0xE0, 0x11, 0x9D, 0x22, 0x13, 0x6C, 0xA3, 0x0F, 0x9B, 0x28, 0x59, 0x00,
+    0x4F, 0x0C, 0xE0, 0x19, 0x80, 0xD5, 0x01, 0x9C, 0x00, 0xB8, 0x0C, 0x20, 0x8B, 0x24, 0xF1, 0x00,
+    0x44, 0x5F, 0x8F, 0x92, 0xF5, 0xB7, 0x37, 0xF3, 0xDF, 0xE6, 0xB4, 0xB9, 0x25, 0x42, 0x8D, 0x6B,
+    0x42, 0x87, 0x0B, 0xB0, 0xB5, 0x9D, 0x84, 0xA9, 0xED, 0x18, 0x2C, 0x6D, 0x4F, 0xC0, 0xD0, 0xF6,
+    0x84, 0x73, 0x75, 0x42, 0xB5, 0x2F, 0x82, 0x29, 0x38, 0xD3, 0xA8, 0x86, 0xF8, 0x07, 0xCF, 0x50,
+    0x8A, 0xCF, 0xDA, 0x5A, 0x2B, 0x7C, 0xB4, 0x13, 0xFC, 0x5C, 0xEA, 0x84, 0xE4, 0xDE, 0x05, 0x2A,
+    0x5C, 0xEB, 0x71, 0x11, 0xDC, 0xAF, 0x8C, 0x2C, 0x67, 0x7A, 0x66, 0x3C, 0xE9, 0x4B, 0x13, 0xD9,
+    0x1F, 0xCA, 0xCE, 0x58, 0x1F, 0xB1, 0x2F, 0xDB, 0x92, 0x8B, 0x44, 0x56, 0x39, 0x8C, 0x56, 0xF2,
+    0xE0, 0xF3, 0x5E, 0x83, 0x2D, 0xE3, 0xB8, 0xD7, 0x40, 0xE4, 0x0B, 0x9F, 0x6D, 0x20, 0xB4, 0x8C,
+    0x5F, 0x6F, 0x28, 0xF4, 0xA9, 0xB0, 0x13, 0x7E, 0x48, 0xF3, 0x60, 0xF4, 0x7A, 0x03, 0xA1, 0x38,
+    0x56, 0x83, 0x58, 0xEE, 0x61, 0x7E, 0x7B, 0x8D, 0xA7, 0xB6, 0x55, 0xB9, 0x59, 0xA7, 0x5C, 0x2B,
+    0x4F, 0xD2, 0xE9, 0x11, 0x11, 0xE7, 0xAE, 0x77, 0x89, 0x48, 0x96, 0x3E, 0x25, 0xE5, 0x40, 0x96,
+    0x45, 0xFC, 0xAB, 0x0E, 0xFE, 0xA9, 0xE4, 0xAA, 0x4C, 0x8F, 0x55, 0x8A, 0xD7, 0x74, 0x2E, 0x1A,
+    0xE8, 0xFE, 0x1E, 0x66, 0xFE, 0xA5, 0xD6, 0xF5, 0x23, 0x44, 0x43, 0xA6, 0x27, 0xE4, 0x73, 0x55,
+    0x3E, 0x2D, 0xA6, 0xD8, 0x77, 0x72, 0x99, 0xC5, 0x72, 0xAB, 0xC7, 0x68, 0xE7, 0xC1, 0xD6, 0x21,
+    0xBB, 0x3E, 0x75, 0x44, 0x61, 0x3B, 0xD2, 0x0E, 0x58, 0x56, 0x7A, 0x18, 0x03, 0x7A, 0x98, 0xCF,
+    0x33, 0xFF, 0xEF, 0x01, 0x27, 0xFC, 0xFE, 0x2A, 0xE0, 0xFF, 0x83, 0x09, 0x67, 0x6C, 0x33, 0xC0,
+    0x8E, 0xE7, 0xD7, 0x0B, 0xD7, 0xF2, 0x6E, 0x72, 0xE7, 0x74, 0xC7, 0x3D, 0x45, 0xC6, 0xE2, 0x04,
+    0x9D, 0xF1, 0x31, 0x25, 0x3D, 0x98, 0x47, 0xA3, 0x77, 0xC0, 0xD4, 0xBD, 0xED, 0x8D, 0xDD, 0xA6,
+    0xA6, 0x4F, 0xAE, 0x55, 0xB9, 0x7D, 0x45, 0x26, 0x78, 0xF7, 0x65, 0x5B, 0xCA, 0x6F, 0xDB, 0x38,
+    0x0D, 0x6B, 0x63, 0x84, 0x47, 0xFA, 0x19, 0xEE, 0x8C, 0xA9, 0xBC, 0x0A, 0x37, 0x38, 0x7C, 0xE1,
+    0x9D, 0xC5, 0x9F, 0xB2, 0x70, 0xE5, 0x07, 0xDC, 0x33, 0xC0, 0x82, 0x83, 0x58, 0x34, 0xF3, 0xD8,
+    0xD4, 0x3C, 0x91, 0x7B, 0x47, 0xD7, 0xE5, 0xD6, 0x7E, 0xBD, 0x34, 0xE3, 0x63, 0xCC, 0xF8, 0x38,
+    0x59, 0x00, 0x47, 0x07, 0xF0, 0x04, 0xC0, 0x31, 0x80, 0x67, 0x00, 0x56, 0x07, 0x70, 0x45, 0x80,
+    0x27, 0xBD, 0x4D, 0xB6, 0xC0, 0x7C, 0xEC, 0xD4, 0xB3, 0xD7, 0xD3, 0xCC, 0x77, 0x26, 0x1C, 0xB8,
+    0xE4, 0x7D, 0x18, 0x8F, 0x21, 0x84, 0x66, 0x63, 0x41, 0xC2, 0xFB, 0xA4, 0xDF, 0x26, 0x96, 0x0E,
+    0xBC, 0x5B, 0xC0, 0x88, 0x33, 0x16, 0xDA, 0xFC, 0x9D, 0xA0, 0xFF, 0x51, 0xC1, 0x84, 0x33, 0x7E,
+    0x63, 0x36, 0xFA, 0x07, 0xA0, 0x06, 0x86, 0x1B, 0x99, 0x95, 0xB0, 0xDB, 0x8C, 0x8B, 0x0E, 0xE6,
+    0x9A, 0x71, 0x91, 0x1E, 0x25, 0x8A, 0xFF, 0x2D, 0x51, 0xD4, 0x10, 0x85, 0x60, 0xB8, 0xE3, 0xA9,
+    0x70, 0x5C, 0x61, 0xAB, 0x3B, 0x7E, 0x39, 0xC1, 0x90, 0xC8, 0xB9, 0x70, 0x9A, 0xBE, 0x6C, 0x2D,
+    0x46, 0xE8, 0x06, 0xC9, 0x0B, 0xEA, 0x16, 0xFB, 0x02, 0xDA, 0xB6, 0xBB, 0xCD, 0xAD, 0xE2, 0xE0,
+    0x53, 0x70, 0x03, 0x0E, 0x09, 0x6F, 0xEA, 0xA4, 0x33, 0xD8, 0xD8, 0x3A, 0xD9, 0x5F, 0x03, 0x68,
+    0x65, 0x32, 0xC1, 0xB7, 0xC1, 0x02, 0x62, 0x6E, 0xCE, 0xD8, 0x51, 0x69, 0x81, 0x9D, 0xF3, 0xCC,
+    0x68, 0xF8, 0x33, 0xCE, 0x78, 0x4A, 0x8C, 0x93, 0x79, 0x19, 0xD5, 0xBA, 0x71, 0xFB, 0x22, 0x4C,
+    0x2D, 0x60, 0x97, 0xDE, 0x69, 0xB5, 0x7C, 0xD0, 0xF0, 0xB1, 0x23, 0x2D, 0x98, 0x14, 0x77, 0x04,
+    0x6A, 0x69, 0xC1, 0x7A, 0xF7, 0x6C, 0x2E, 0xAD, 0xFF, 0xA6, 0x73, 0xF0, 0xE5, 0xA5, 0x4C, 0xAF,
+    0xF5, 0xDF, 0x09, 0xAF, 0xF5, 0x3F, 0x90, 0xBD, 0x08, 0xFB, 0x26, 0x28, 0x48, 0x1B, 0xEB, 0x98,
+    0x24, 0xAD, 0xA1, 0xAF, 0x01, 0x8C, 0x06, 0x20, 0x7F, 0xCE, 0x1C, 0xC0, 0x8C, 0xA2, 0x73, 0x45,
+    0x2E, 0xB3, 0x89, 0xEC, 0x74, 0xBF, 0x97, 0x5B, 0x8D, 0x2B, 0x19, 0xF1, 0x71, 0xE5, 0x25, 0x66,
+    0x79, 0xF3, 0x72, 0x00, 0x1B, 0xE6, 0x3A, 0xF6, 0x1C, 0x67, 0x73, 0x77, 0x01, 0x1E, 0xED, 0x7A,
+    0x19, 0x96, 0x90, 0xCB, 0x64, 0xD6, 0x26, 0xA3, 0x2A, 0x76, 0x1C, 0x6E, 0xBF, 0xCF, 0x02, 0xD7,
+    0xFB, 0x93, 0x70, 0x66, 0x2E, 0x8F, 0x95, 0xEB, 0x25, 0xA0, 0x18, 0x6C, 0x13, 0x19, 0xC1, 0xC9,
+    0xD1, 0x2C, 0xC8, 0x56, 0x47, 0xB3, 0x71, 0x76, 0x42, 0x40, 0xF1, 0x25, 0x00, 0x33, 0xA2, 0xCD,
+    0xFC, 0xD6, 0x40, 0x6D, 0xCC, 0x75, 0xDF, 0xD4, 0x1C, 0xC1, 0x2F, 0xD6, 0xD8, 0x46, 0xF8, 0x73,
+    0x5A, 0x0B, 0x23, 0x0C, 0x0A, 0xD9, 0xA3, 0x02, 0xEC, 0xE9, 0x21, 0xC5, 0x5D, 0x48, 0xBE, 0xC7,
+    0xE0, 0x0B, 0xA7, 0xD3, 0xE5, 0x1C, 0xDA, 0x78, 0x19, 0x0D, 0x44, 0x10, 0xCA, 0x9B, 0xF0, 0xAB,
+    0xFE, 0x5C, 0xA4, 0x8F, 0xF1, 0xEF, 0x0B, 0x43, 0x33, 0xB1, 0xBA, 0xD8, 0x15, 0x5C, 0x30, 0x14,
+    0xC9, 0xE1, 0xF4, 0xA3, 0xCF, 0xAF, 0x0F, 0xF2, 0xF2, 0xE5, 0x82, 0x15, 0x28, 0xDB, 0x81, 0x1D,
+    0xD4, 0x78, 0x8A, 0x2E, 0xDE, 0x9A, 0xF2, 0x56, 0x2A, 0x78, 0xE9, 0xAD, 0x95, 0xC0, 0x23, 0x14,
+    0xE3, 0xEC, 0xD6, 0xBB, 0x18, 0xAF, 0xC9, 0xCB, 0x2D, 0x84, 0x5C, 0x99, 0x7F, 0xD8, 0xA8, 0xA3,
+    0x2C, 0x4E, 0x26, 0x19, 0xB6, 0xF1, 0x89, 0x70, 0x21, 0xC2, 0xF2, 0x00, 0x38, 0xC5, 0x99, 0x61,
+    0x21, 0x02, 0xB6, 0x88, 0xC6, 0xB8, 0x43, 0x0C, 0x21, 0x3A, 0x93, 0xFD, 0xDD, 0x6E, 0xFD, 0x2D,
+    0xE4, 0x21, 0xEC, 0xD7, 0xB7, 0x52, 0x47, 0x29, 0xA8, 0x1E, 0xCE, 0xDF, 0x67, 0xFB, 0x07, 0x93,
+    0x63, 0x6C, 0xDF, 0xB0, 0x55, 0x24, 0x73, 0xB2, 0x14, 0xC9, 0xE8, 0x14, 0x88, 0x48, 0xFA, 0x09,
+    0x11, 0x26, 0x3F, 0x44, 0xFF, 0x3F, 0x48, 0x7A, 0xCB, 0x4A, 0xDB, 0x53, 0x0D, 0x6C, 0xC3, 0x04,
+    0x7F, 0x06, 0xD7, 0x27, 0x46, 0x6A, 0x55, 0x9D, 0x9D, 0xDB, 0x94, 0x82, 0xB2, 0xF5, 0x1D, 0x0F,
+    0x7E, 0xCD, 0xC0, 0x36, 0x9C, 0xE8, 0x9C, 0xF2, 0x9C, 0xFC, 0x77, 0xBC, 0x84, 0xD6, 0xBB, 0xCD,
+    0xFC, 0xED, 0xBC, 0x37, 0x06, 0xD8, 0xC1, 0x10, 0x10, 0x0D, 0xDA, 0xBF, 0x82, 0x54, 0x36, 0x5E,
+    0xD1, 0xFB, 0x5F, 0xE6, 0x73, 0x65, 0x1F, 0x9F, 0x29, 0x08, 0x17, 0x81, 0xF0, 0x12, 0x58, 0x73,
+    0x64, 0xD7, 0xB3, 0x89, 0xC8, 0x7C, 0x29, 0x56, 0xC3, 0xCA, 0x0F, 0xCE, 0x80, 0x42, 0xE1, 0x00,
+    0x26, 0x3D, 0x80, 0x1E, 0x22, 0x3C, 0xB3, 0xCB, 0xED, 0xB7, 0x6C, 0x1D, 0x0B, 0x33, 0x95, 0x7D,
+    0xE0, 0xBA, 0x08, 0x55, 0x72, 0xFF, 0x38, 0x53, 0xFD, 0x31, 0x4E, 0xB8, 0x22, 0x81, 0xAB, 0xBB,
+    0x8C, 0x67, 0x03, 0x26, 0x05, 0x2E, 0x0D, 0xBA, 0x77, 0x71, 0x7F, 0xDA, 0x33, 0xC7, 0xAE, 0x3D,
+    0x59, 0xDF, 0x1E, 0xC7, 0x93, 0x1D, 0x0E, 0x1C, 0x1E, 0xEF, 0xC2, 0x23, 0x87, 0xBD, 0x82, 0xD6,
+    0xCD, 0x18, 0x2B, 0xE4, 0x24, 0x27, 0x12, 0x58, 0xD4, 0x09, 0x80, 0x2F, 0x2D, 0x70, 0xAC, 0x1B,
+    0x3F, 0x00, 0xED, 0x21, 0x1A, 0x56, 0x3E, 0x3D, 0x34, 0x60, 0x6F, 0x6E, 0xB6, 0x01, 0xE4, 0x00,
+    0x9D, 0xEA, 0x21, 0xEB, 0x10, 0x59, 0xD5, 0xCF, 0x5C, 0x08, 0xCB, 0x28, 0xE0, 0xB6, 0x58, 0xEF,
+    0x40, 0x12, 0x1A, 0xBF, 0x66, 0xBC, 0xE7, 0xFE, 0x48, 0x1E, 0x33, 0xA6, 0xF8, 0x39, 0x1B, 0xAB,
+    0x74, 0xAC, 0xBF, 0x75, 0x8A, 0xD2, 0xFD, 0x50, 0x4E, 0xE4, 0xB5, 0x1C, 0x99, 0xAD, 0x7A, 0x9D,
+    0x03, 0x93, 0x71, 0x5C, 0x0A, 0xE8, 0xAA, 0x99, 0x63, 0x62, 0xE3, 0xD9, 0x3E, 0xC0, 0x75, 0x6B,
+    0x36, 0x48, 0xE2, 0xDD, 0x20, 0x57, 0xCF, 0x41, 0xAE, 0xF2, 0x77, 0x2F, 0x66, 0xAB, 0xB3, 0x2D,
+    0x40, 0x54, 0xDF, 0x4F, 0x5A, 0x27, 0xD8, 0x4D, 0x44, 0xB0, 0x83, 0x2D, 0x9F, 0xF1, 0x23, 0x15,
+    0xF4, 0x31, 0xB3, 0x29, 0x72, 0x00, 0xAD, 0x0F, 0xF0, 0x1B, 0xE0, 0xBB, 0xA0, 0x54, 0xC1, 0x6E,
+    0x52, 0xB4, 0x70, 0x41, 0x7F, 0xA7, 0x15, 0x86, 0x21, 0xA7, 0x3F, 0xB7, 0x28, 0x49, 0x4D, 0x48,
+    0xAA, 0xA4, 0x7B, 0xD1, 0xED, 0x2E, 0x90, 0xFA, 0x45, 0x85, 0x40, 0x33, 0xC2, 0x29, 0xA7, 0x93,
+    0xAC, 0x89, 0x48, 0x78, 0xAE, 0x2C, 0x08, 0x2C, 0xC8, 0x88, 0x08, 0x6D, 0x12, 0x04, 0x59, 0x75,
+    0xFE, 0x65, 0x7F, 0xCA, 0x44, 0x2F, 0x70, 0x97, 0x4B, 0x03, 0xE3, 0xFE, 0xD6, 0x78, 0xD0, 0x0B,
+    0x33, 0x3C, 0x36, 0x72, 0x9D, 0x3A, 0x4D, 0x5E, 0x69, 0x4B, 0xB8, 0xC1, 0x36, 0x28, 0xDA, 0x06,
+    0x10, 0x96, 0xC3, 0xE9, 0x00, 0xB0, 0x3F, 0xFB, 0xF8, 0x6E, 0xD4, 0x3D, 0x0F, 0x9F, 0x15, 0x02,
+    0x2D, 0xA2, 0x9F, 0x34, 0xF4, 0x16, 0x8B, 0xA6, 0x48, 0x07, 0x9E, 0xE7, 0xC4, 0x62, 0xBA, 0x01,
+    0xD2, 0xE2, 0x88, 0xDD, 0xE8, 0x60, 0x70, 0x35, 0xDF, 0x77, 0x0C, 0xA3, 0x97, 0x74, 0x69, 0xB9,
+    0x79, 0x6D, 0x2E, 0x49, 0xDE, 0x45, 0xC1, 0xDF, 0x2B, 0x1F, 0x4A, 0xC6, 0x33, 0x25, 0x86, 0x57,
+    0x85, 0xC9, 0x92, 0xC4, 0x7A, 0x17, 0x9F, 0x43, 0xD3, 0xB7, 0x1D, 0x0C, 0x0B, 0x5C, 0x2B, 0x2F,
+    0xBC, 0xBF, 0xC6, 0x20, 0x87, 0x7E, 0x8E, 0xE9, 0x0F, 0x9F, 0x15, 0x51, 0xE0, 0x3D, 0x44, 0x3C,
+    0x7C, 0xF0, 0x8E, 0x05, 0x2B, 0x4F, 0xE1, 0x95, 0xC5, 0xC0, 0x60, 0x90, 0x2A, 0x55, 0x75, 0x6F,
+    0x0B, 0xF8, 0x60, 0x9D, 0x32, 0x74, 0x61, 0x21, 0x73, 0x3C, 0xDC, 0x8F, 0x57, 0x62, 0x2C, 0xA3,
+    0xC4, 0xB5, 0x7E, 0x05, 0x42, 0x3B, 0x55, 0xDB, 0xAF, 0xE9, 0xEE, 0x41, 0xDD, 0x7C, 0xAA, 0x9A,
+    0xEE, 0x1F, 0x2F, 0xC5, 0xD7, 0xDE, 0x15, 0xD5, 0xF1, 0xB6, 0x84, 0x99, 0xCD, 0x57, 0x85, 0x80,
+    0xF5, 0x6D, 0x09, 0x33, 0xEA, 0x90, 0x13, 0x2A, 0xFD, 0xAA, 0xA5, 0x44, 0x79, 0x41, 0x76, 0x9A,
+    0x0B, 0x22, 0x85, 0xF3, 0x3A, 0xE9, 0xC6, 0x84, 0x92, 0x35, 0x22, 0x0F, 0x1A, 0x1C, 0x38, 0x79,
+    0x60, 0x92, 0x9D, 0x33, 0x61, 0x26, 0x4A, 0x54, 0x76, 0x4D, 0xCE, 0x8F, 0x65, 0xAD, 0x41, 0x11,
+    0x83, 0x12, 0x65, 0x12, 0x43, 0xD1, 0x0D, 0xFF, 0xCF, 0x2D, 0x86, 0xD2, 0x7F, 0x61, 0x1F, 0xE4,
+    0xD5, 0xB7, 0xF5, 0x3F, 0x0D, 0x17, 0xD6, 0x4E, 0x1F, 0xF1, 0xCC, 0xB5, 0x50, 0xA4, 0xF2, 0x69,
+    0x1B, 0x16, 0x5F, 0xF0, 0xB3, 0x3B, 0xBC, 0x9B, 0x79, 0x44, 0x06, 0xA8, 0x93, 0xFF, 0xCE, 0x39,
+    0x1E, 0xDE, 0x1E, 0x69, 0xCD, 0xED, 0xFC, 0xD7, 0x98, 0xC6, 0x13, 0xB1, 0x74, 0x7D, 0xDA, 0x51,
+    0x75, 0x87, 0x55, 0x26, 0xD7, 0xF0, 0xD4, 0x89, 0x3A, 0x92, 0x1E, 0x86, 0xDE, 0xBB, 0x1B, 0x1D,
+    0xED, 0x51, 0xBA, 0x79, 0x1A, 0x0A, 0x5F, 0x0A, 0x89, 0xF8, 0x98, 0x7C, 0x29, 0x14, 0x7C, 0x46,
+    0x90, 0x0C, 0xC7, 0xAA, 0x20, 0xE1, 0x1C, 0x0E, 0x5D, 0x21, 0x12, 0x25, 0x47, 0x50, 0xB1, 0x05,
+    0xF6, 0x1F, 0x17, 0x76, 0xBA, 0x62, 0x2F, 0x59, 0xB9, 0x64, 0xB2, 0x10, 0x5E, 0x9A, 0xDB, 0x2F,
+    0x33, 0xB8, 0xB4, 0x7B, 0x16, 0x8E, 0x18, 0x6C, 0x88, 0x05, 0x67, 0x0A, 0x44, 0xA0, 0xFD, 0xD1,
+    0xCE, 0xDA, 0xFA, 0x5B, 0x09, 0x1B, 0x0F, 0xE9, 0x19, 0x7F, 0xAD, 0x4F, 0xF9, 0x5B, 0x50, 0x11,
+    0x51, 0x12, 0xDF, 0x83, 0x20, 0xA8, 0x47, 0x59, 0x28, 0x2A, 0xA1, 0x97, 0xBF, 0x0D, 0x8E, 0xFF,
+    0x0A, 0x62, 0x43, 0xEF, 0x7C, 0x51, 0xD6, 0x2A, 0xED, 0xDC, 0xFE, 0xA2, 0x1C, 0xF7, 0x8B, 0x72,
+    0x07, 0x8B, 0x12, 0x81, 0x07, 0x17, 0xFB, 0xC7, 0x73, 0x4D, 0xC6, 0x83, 0x70, 0x5B, 0x2E, 0xEB,
+    0xCE, 0xF7, 0x4A, 0x9F, 0x35, 0x4F, 0x25, 0x73, 0x5F, 0x1E, 0x97, 0xBF, 0x0A, 0xF5, 0x2E, 0x71,
+    0xC2, 0x99, 0x5A, 0xEE, 0x8F, 0x16, 0x2F, 0x93, 0xEB, 0x1C, 0x6C, 0x1F, 0xD7, 0x20, 0xE7, 0x4A,
+    0xC7, 0xE2, 0x77, 0x84, 0x7F, 0xAC, 0x6C, 0x67, 0x4B, 0xCD, 0x79, 0x20, 0x14, 0x8D, 0x7B, 0x21,
+    0x3C, 0xEF, 0x50, 0x9F, 0x15, 0x9D, 0x21, 0xE9, 0xA3, 0x90, 0xE7, 0xAD, 0x9A, 0x03, 0x27, 0xBC,
+    0x91, 0x4D, 0x85, 0x55, 0xCC, 0xA8, 0x89, 0x49, 0xFD, 0x0D, 0x8B, 0xA8, 0x6E, 0x1F, 0x71, 0x82,
+    0xE8, 0x10, 0xC3, 0x5A, 0x72, 0x90, 0x32, 0x9A, 0x22, 0x54, 0xE5, 0x3C, 0x28, 0x2D, 0x5F, 0xD1,
+    0xD5, 0x18, 0x01, 0xCB, 0x14, 0x91, 0xA9, 0x72, 0x9E, 0x43, 0x51, 0xCA, 0xFA, 0x45, 0x37, 0x2A,
+    0x43, 0x8F, 0x4B, 0x5C, 0x19, 0xBA, 0x29, 0xFE, 0xDD, 0xCC, 0x63, 0x8C, 0xE4, 0xEF, 0x6B, 0xF8,
+    0x8C, 0x3B, 0xEF, 0xC7, 0x34, 0x87, 0xE5, 0x30, 0x39, 0x08, 0xF1, 0x52, 0x3F, 0x69, 0x21, 0xD0,
+    0xC7, 0x5F, 0x35, 0x1D, 0x0C, 0x63, 0xF1, 0x5F, 0x99, 0x1C, 0x0D, 0x8C, 0xFE, 0x8F, 0x49, 0xE1,
+    0x39, 0x9E, 0xD4, 0xEA, 0xFB, 0x84, 0xC5, 0xD5, 0x59, 0xDF, 0xE9, 0x70, 0x13, 0xB1, 0x33, 0x1A,
+    0xBA, 0x11, 0x65, 0x22, 0xC3, 0x44, 0x99, 0xCC, 0x72, 0x39, 0xAB, 0x08, 0x2A, 0x27, 0xFD, 0x43,
+    0x94, 0x98, 0x82, 0x77, 0x69, 0x70, 0xFC, 0x35, 0x06, 0xDC, 0xC0, 0x66, 0x5A, 0x90, 0xD3, 0x07,
+    0x89, 0xEC, 0x62, 0x71, 0x12, 0xD2, 0xB4, 0x0A, 0x1B, 0x7F, 0x58, 0xE4, 0xC5, 0x31, 0x84, 0x8D,
+    0xBE, 0x33, 0x95, 0x26, 0xF8, 0x3F, 0xFB, 0x51, 0xF9, 0x1A, 0xC6, 0xF9, 0x95, 0xF7, 0x64, 0xCC,
+    0xC7, 0x1F, 0x7E, 0xE5, 0x03, 0xE8, 0x08, 0x96, 0xF9, 0x29, 0x64, 0x8A, 0x74, 0xE6, 0xA8, 0x81,
+    0x9A, 0xDA, 0x43, 0x97, 0x0D, 0x71, 0xA9, 0xC1, 0x1C, 0xC6, 0x64, 0x0A, 0xE9, 0xD6, 0x0D, 0xA1,
+    0xE3, 0xB9, 0x00, 0x5E, 0xF2, 0xB3, 0x41, 0x15, 0x2C, 0x9F, 0x03, 0x4D, 0x4D, 0x2E, 0x0E, 0xDE,
+    0x5F, 0xAF, 0xF1, 0x8D, 0xD7, 0xF1, 0xFB, 0x94, 0x50, 0xF6, 0x2D, 0xC0, 0x02, 0x30, 0x2A, 0xE6,
+    0xC7, 0xFA, 0x7D, 0xEA, 0xCE, 0xF7, 0x28, 0x13, 0x23, 0x56, 0x34, 0x31, 0x8F, 0x41, 0xE2, 0x8B,
+    0x87, 0xD0, 0x06, 0x73, 0x53, 0x10, 0xA3, 0x75, 0x4F, 0x75, 0x9B, 0x37, 0x3B, 0x8F, 0x9C, 0xBE,
+    0xDB, 0xB4, 0x99, 0x3A, 0xA9, 0xE8, 0xA3, 0xA2, 0x13, 0xCA, 0x01, 0x67, 0x95, 0x39, 0x22, 0xA7,
+    0xC0, 0x21, 0x56, 0x2F, 0xF9, 0x32, 0x20, 0xC7, 0xC2, 0xA1, 0x93, 0x5F, 0x62, 0x3C, 0x94, 0x4C,
+    0x10, 0xAB, 0x5E, 0x20, 0x04, 0x4B, 0xD2, 0x98, 0x43, 0x2C, 0x5B, 0xF4, 0x17, 0x8C, 0xFA, 0x36,
+    0xE8, 0xDD, 0xC9, 0x1D, 0xEE, 0x96, 0x70, 0xBB, 0xD6, 0xAD, 0x3D, 0x67, 0x34, 0x44, 0x07, 0x4C,
+    0xB0, 0x7D, 0xBE, 0x5B, 0x5B, 0xDB, 0xE7, 0x3C, 0x8D, 0x1E, 0x5C, 0xBC, 0x4F, 0x9A, 0x28, 0x66,
+    0x4C, 0x06, 0x3D, 0x45, 0xC6, 0x63, 0x3B, 0xA4, 0x85, 0xF4, 0x63, 0xB6, 0xF2, 0xE8, 0x33, 0x76,
+    0xC3, 0x43, 0xC4, 0x89, 0xFA, 0x60, 0x1C, 0x27, 0x9D, 0xCB, 0xCF, 0xB1, 0xAD, 0xBC, 0xBC, 0x36,
+    0x4F, 0xDB, 0x8D, 0x60, 0x27, 0x4F, 0x64, 0xA1, 0x44, 0x19, 0x1D, 0xCD, 0x31, 0x84, 0xA3, 0x06,
+    0xD6, 0x25, 0x50, 0xC8, 0x4D, 0x0C, 0x87, 0x1C, 0x01, 0x49, 0x15, 0xA1, 0x8F, 0x9D, 0x0D, 0x5F,
+    0xEE, 0x3E, 0x33, 0x57, 0x24, 0x84, 0x28, 0x70, 0xEB, 0xA9, 0x0F, 0xC1, 0x36, 0xA0, 0xA5, 0xA5,
+    0xF2, 0xAC, 0x86, 0x18, 0xD0, 0x51, 0xA4, 0x1A, 0x57, 0x48, 0x57, 0xCB, 0x84, 0x8D, 0x8C, 0x39,
+    0x89, 0xBE, 0x41, 0xFE, 0xFB, 0x5F, 0x78, 0xF3, 0xAA, 0xA5, 0xC3, 0x72, 0x9B, 0x0A, 0x59, 0xAA,
+    0x61, 0xCD, 0x70, 0x41, 0x7C, 0x07, 0xA1, 0x8D, 0x21, 0x27, 0xEC, 0x24, 0xFD, 0xAE, 0x5C, 0x7C,
+    0x2C, 0xFA, 0x96, 0x5C, 0xBC, 0x1A, 0xBD, 0x22, 0x17, 0x9F, 0x8B, 0xBE, 0x89, 0xE8, 0xD0, 0xE8,
+    0x65, 0x68, 0xFA, 0x51, 0xD6, 0x21, 0x5E, 0x2B, 0xCB, 0x61, 0x00, 0xCC, 0xE2, 0xC4, 0x07, 0x84,
+    0x75, 0x22, 0x8B, 0x8B, 0xF4, 0x7A, 0xF4, 0x72, 0x3E, 0xB3, 0x4D, 0xF4, 0x0A, 0xC4, 0xF3, 0x6B,
+    0x3D, 0xFB, 0x1B, 0x81, 0xE5, 0x8C, 0xFF, 0x5E, 0xEE, 0xED, 0x7F, 0x1B, 0x8F, 0xF1, 0x69, 0x3B,
+    0x90, 0xDB, 0x3F, 0x33, 0x62, 0xD0, 0xB4, 0x9C, 0xFB, 0xDF, 0x3A, 0x69, 0xD8, 0x7B, 0xF5, 0xB6,
+    0xF1, 0xDE, 0xAC, 0x45, 0x4F, 0x78, 0xBD, 0x96, 0xA5, 0xFB, 0x72, 0x3D, 0x29, 0x82, 0x67, 0xEB,
+    0x70, 0x1A, 0x7A, 0xC2, 0x8D, 0x53, 0xF9, 0xAE, 0xB1, 0xAF, 0xD7, 0x71, 0x47, 0x69, 0x0F, 0x81,
+    0xA6, 0xF4, 0x07, 0xC6, 0xFD, 0x7C, 0xEE, 0xB3, 0x48, 0x0C, 0x3A, 0x81, 0x03, 0xEF, 0x9D, 0xA9,
+    0x1E, 0x8C, 0x7E, 0x54, 0xE9, 0xC1, 0xF8, 0x0D, 0x77, 0xE0, 0x7F, 0xB9, 0xD6, 0x83, 0xD0, 0x6B,
+    0xF4, 0x60, 0x02, 0x72, 0x23, 0xB6, 0xEB, 0xEB, 0x6B, 0x9D, 0xE9, 0xB3, 0x49, 0xF4, 0x9B, 0xFF,
+    0xDA, 0xA5, 0x1A, 0x9C, 0x30, 0xBB, 0xE6, 0xA2, 0x22, 0xAA, 0x6B, 0x1A, 0x5E, 0x38, 0x2A, 0xAF,
+    0x21, 0xF0, 0x07, 0x7C, 0xE4, 0x9A, 0xEF, 0x82, 0x07, 0xAF, 0xA9, 0x5F, 0x39, 0x48, 0xAE, 0x69,
+    0x06, 0x51, 0x68, 0xAE, 0x69, 0x74, 0xE1, 0x44, 0x08, 0x42, 0x76, 0x1A, 0xCB, 0x81, 0x95, 0x39,
+    0xF5, 0x9F, 0xED, 0xC6, 0xB5, 0x15, 0xB8, 0x9C, 0x7F, 0x6F, 0xE5, 0x3E, 0xC8, 0x9C, 0x83, 0x64,
+    0x83, 0x69, 0x04, 0xAA, 0x79, 0xAD, 0xB2, 0xEA, 0x46, 0x29, 0x27, 0xB7, 0xFE, 0x36, 0xFD, 0xC0,
+    0xA4, 0x5E, 0x63, 0x1E, 0x1E, 0xD3, 0x1F, 0x7C, 0x0C, 0x89, 0x7F, 0x1A, 0x3B, 0x28, 0xD3, 0xE8,
+    0x06, 0xA8, 0xD8, 0x98, 0xAA, 0x46, 0x9A, 0x95, 0x57, 0x22, 0x53, 0x4B, 0x98, 0x6A, 0x8D, 0xE8,
+    0x86, 0x71, 0x56, 0x63, 0x32, 0x06, 0x49, 0x0D, 0x7D, 0x2A, 0x14, 0x54, 0x1D, 0x69, 0x52, 0xF9,
+    0xAD, 0x8D, 0x1B, 0x3B, 0x15, 0xAA, 0x1A, 0x97, 0x60, 0xE4, 0x50, 0xBE, 0xB6, 0xF6, 0x42, 0x45,
+    0x09, 0xD9, 0x67, 0xC0, 0x18, 0xC5, 0x76, 0x59, 0xDF, 0xA7, 0xD4, 0x36, 0xC7, 0x80, 0xE5, 0x56,
+    0x33, 0x22, 0x53, 0x0D, 0xED, 0x8D, 0xFE, 0x5E, 0x23, 0x77, 0xB8, 0xC2, 0x7C, 0x75, 0x61, 0x8B,
+    0xF0, 0x8C, 0x61, 0x89, 0x31, 0x94, 0x72, 0xA2, 0x8C, 0x63, 0x09, 0x3F, 0x46, 0x0D, 0xEE, 0xD6,
+    0x79, 0x35, 0xFD, 0xD5, 0x5E, 0x4D, 0x8A, 0x79, 0xB5, 0x7A, 0x35, 0xC0, 0x9D, 0x65, 0xC3, 0xAF,
+    0x65, 0x3C, 0xE8, 0xDC, 0x10, 0xE1, 0x00, 0xCE, 0x8D, 0x74, 0x2A, 0x1B, 0xB9, 0x2D, 0x8F, 0x54,
+    0x8C, 0x94, 0xD4, 0x74, 0x28, 0x6E, 0x63, 0x17, 0xD8, 0x48, 0x78, 0xFC, 0x0A, 0xB4, 0x63, 0x5C,
+    0x21, 0x80, 0xC8, 0x6B, 0x8E, 0x0F, 0x71, 0xD5, 0x81, 0xA5, 0x94, 0xFE, 0xDD, 0x9F, 0x0A, 0xA5,
+    0x44, 0x5A, 0x16, 0xB2, 0x36, 0x61, 0xB1, 0x6D, 0x46, 0x42, 0x0F, 0x38, 0xB3, 0x04, 0x26, 0xC2,
+    0x7E, 0x8B, 0xA8, 0x08, 0x4B, 0x99, 0x6A, 0xD3, 0xB4, 0x58, 0x9F, 0x05, 0xB5, 0x90, 0xA3, 0x1D,
+    0xB5, 0x1A, 0x9E, 0x87, 0x55, 0x21, 0x53, 0xCD, 0x1D, 0x81, 0x57, 0xED, 0xAC, 0xAD, 0x9D, 0xE1,
+    0x94, 0xC0, 0xEC, 0x89, 0x74, 0x02, 0x6D, 0x53, 0xC2, 0x71, 0x69, 0x4C, 0x33, 0x37, 0xBB, 0x0A,
+    0x44, 0x0B, 0x70, 0xC2, 0x55, 0x81, 0x9B, 0x95, 0xA3, 0x7A, 0xD2, 0xFB, 0xA9, 0x19, 0x08, 0x85,
+    0x19, 0xB6, 0x96, 0xD6, 0x66, 0x98, 0x74, 0xA5, 0x7E, 0x67, 0xBF, 0xFB, 0x6B, 0x9D, 0x9A, 0x5E,
+    0x1B, 0x4E, 0x73, 0xA3, 0xF9, 0x68, 0x30, 0x14, 0x72, 0xBE, 0x89, 0x5A, 0x1D, 0x67, 0xEA, 0x45,
+    0x0F, 0xA7, 0x91, 0xF3, 0xA3, 0xF7, 0x1E, 0x74, 0xED, 0x88, 0x72, 0x53, 0xF9, 0xAF, 0x52, 0xBE,
+    0x16, 0x4E, 0xE1, 0xDA, 0x03, 0xA7, 0x0B, 0x21, 0xF5, 0x61, 0xFE, 0x79, 0xE9, 0xCE, 0x08, 0x66,
+    0x8B, 0x0F, 0xEA, 0x11, 0x53, 0xB5, 0x62, 0xFB, 0x1E, 0xE9, 0xFA, 0xB4, 0xFC, 0x46, 0x2A, 0xB7,
+    0x8E, 0xC2, 0x8D, 0xEB, 0x54, 0xE3, 0xBA, 0x04, 0x4B, 0x4C, 0xC0, 0xE0, 0x04, 0xAF, 0x8E, 0x74,
+    0x3B, 0xD8, 0x3E, 0xEF, 0x18, 0x1A, 0x76, 0x2C, 0xE1, 0x68, 0xEF, 0xBE, 0xC3, 0xF3, 0xBB, 0xA0,
+    0x68, 0xC8, 0xDA, 0x02, 0xA1, 0xB9, 0x69, 0x46, 0x75, 0x50, 0x70, 0x56, 0xCE, 0x02, 0xE4, 0x53,
+    0x34, 0xA0, 0xCB, 0xA4, 0x90, 0x11, 0x41, 0x93, 0x4B, 0xCC, 0xC8, 0xF5, 0xDA, 0xAF, 0xE3, 0x06,
+    0xF4, 0xF7, 0x5A, 0x6A, 0x4D, 0xA3, 0x12, 0xB3, 0xE5, 0x4A, 0x8C, 0xB5, 0x7E, 0xC5, 0x65, 0x6C,
+    0x8C, 0xC0, 0xE5, 0xA3, 0x1B, 0x79, 0x29, 0xFC, 0x5B, 0x64, 0x4E, 0x26, 0x42, 0x30, 0x01, 0x8D,
+    0xD9, 0x68, 0x8F, 0xAA, 0xB5, 0x92, 0x51, 0x58, 0x34, 0xC1, 0x50, 0x0E, 0x05, 0xA7, 0xE7, 0xA4,
+    0xDC, 0x44, 0x7C, 0x25, 0x44, 0x1C, 0x2E, 0xB2, 0x5E, 0x44, 0xCB, 0x97, 0x81, 0xED, 0xE3, 0xBB,
+    0x8F, 0x88, 0xBA, 0xB6, 0x2E, 0x33, 0x68, 0x62, 0x7F, 0x23, 0xF7, 0xD8, 0xE8, 0x7F, 0x97, 0xE7,
+    0x3F, 0x22, 0x47, 0x47, 0xAC, 0x89, 0xDF, 0x16, 0xCD, 0x21, 0xB0, 0x3B, 0xEB, 0xF0, 0xF5, 0x3E,
+    0xEC, 0x82, 0x91, 0x44, 0x96, 0x9F, 0xE6, 0x99, 0xF7, 0x7E, 0xC9, 0xA0, 0x2D, 0x5F, 0x56, 0x54,
+    0xF4, 0x4B, 0x8B, 0xA8, 0xBD, 0x0C, 0xEA, 0xCD, 0x31, 0xCA, 0xC7, 0x13, 0x75, 0xC6, 0xAD, 0xC9,
+    0xFE, 0x27, 0x2B, 0xDF, 0xDB, 0xEC, 0x9C, 0xAD, 0x96, 0xB9, 0x25, 0xFD, 0x87, 0x49, 0x23, 0xE6,
+    0xB3, 0x9D, 0x3C, 0xFF, 0xBA, 0x49, 0x4F, 0xEB, 0xCE, 0x8B, 0x1C, 0x09, 0xD9, 0x18, 0xAA, 0x74,
+    0xCB, 0xCE, 0x82, 0xEE, 0x5F, 0x61, 0x15, 0x26, 0xE9, 0x4C, 0x76, 0xD4, 0xA8, 0x59, 0xAF, 0x03,
+    0xBB, 0x11, 0xD5, 0x63, 0x10, 0x25, 0x2A, 0x28, 0xDD, 0x53, 0xAF, 0xB8, 0x39, 0x42, 0x4A, 0x26,
+    0x2D, 0x4A, 0xA3, 0x86, 0xC8, 0x6B, 0x34, 0xB1, 0x0D, 0xE3, 0x9F, 0xA3, 0xC7, 0x2A, 0x2F, 0x4F,
+    0xB7, 0xE1, 0x5C, 0x0C, 0x2C, 0x57, 0x94, 0xF9, 0x0B, 0xFB, 0x3D, 0x73, 0x70, 0x7E, 0x9B, 0x4B,
+    0x5E, 0x22, 0xFC, 0x1C, 0xA2, 0x28, 0xC1, 0xE9, 0xEB, 0x79, 0x12, 0x8E, 0xEA, 0xC0, 0xB7, 0x86,
+    0x69, 0xED, 0x95, 0xA7, 0x4C, 0x24, 0x30, 0x4D, 0x44, 0x74, 0x43, 0x1C, 0x9E, 0xC0, 0x90, 0xD0,
+    0x27, 0x1C, 0x2B, 0x9C, 0x02, 0x8E, 0x16, 0x61, 0xFF, 0x6B, 0xD3, 0x43, 0x11, 0x2C, 0x05, 0x86,
+    0xC8, 0x2C, 0x28, 0x85, 0x41, 0xA4, 0x6F, 0xFE, 0xAC, 0xA1, 0xF5, 0x9C, 0x33, 0x8A, 0x72, 0xF1,
+    0x4A, 0xF9, 0x51, 0xDA, 0xB6, 0x4F, 0xDC, 0xAE, 0x45, 0x88, 0x0E, 0x26, 0x5D, 0xDB, 0xC7, 0xED,
+    0x96, 0xFB, 0xC6, 0xED, 0x4E, 0xE3, 0x97, 0x4F, 0x23, 0xF0, 0x50, 0xD4, 0x1E, 0x11, 0xB3, 0x6F,
+    0xE4, 0xEF, 0xA7, 0x55, 0x9C, 0x05, 0xC8, 0x9F, 0xCE, 0xCC, 0xD7, 0xF6, 0xC6, 0xED, 0x86, 0x7D,
+    0xDC, 0x6E, 0xD9, 0xC7, 0xED, 0xA6, 0xEE, 0x29, 0x7D, 0xDC, 0xEE, 0x6F, 0xF1, 0xF4, 0x85, 0xB8,
+    0x5D, 0xFD, 0xB7, 0x4E, 0x0F, 0xD9, 0x56, 0x09, 0x03, 0x29, 0xAC, 0xDE, 0x06, 0xC2, 0x89, 0xA8,
+    0xD1, 0x71, 0xEF, 0x26, 0x33, 0xF1, 0xD7, 0x45, 0xD6, 0x8D, 0xAD, 0x08, 0x2E, 0xF1, 0xB3, 0x42,
+    0x83, 0xD8, 0x1C, 0x96, 0x3F, 0xF9, 0x03, 0x4E, 0x41, 0x00, 0x9C, 0x5E, 0x16, 0x20, 0x7A, 0x86,
+    0xCE, 0xB6, 0xB9, 0x87, 0x8C, 0xF1, 0xD0, 0x35, 0x04, 0xDC, 0xB0, 0xC1, 0x7A, 0x8A, 0xAF, 0x42,
+    0xC9, 0x3D, 0xCF, 0x06, 0xED, 0xCA, 0x82, 0xEA, 0x16, 0xB3, 0xA0, 0x12, 0xC6, 0x3A, 0x66, 0x3E,
+    0x4D, 0x2F, 0x21, 0x85, 0x96, 0x90, 0xCB, 0x94, 0x2E, 0xF0, 0xEA, 0x98, 0x71, 0xEA, 0xA7, 0xDC,
+    0xFC, 0x04, 0x17, 0x32, 0x63, 0x45, 0x5B, 0x9A, 0xEC, 0xB6, 0x17, 0x22, 0x46, 0x5D, 0x24, 0xE4,
+    0x42, 0xDC, 0xA8, 0x06, 0xAD, 0x7B, 0x6D, 0xDA, 0x25, 0xBE, 0x15, 0xCE, 0x17, 0xFE, 0x95, 0x8C,
+    0xC2, 0x51, 0xA8, 0x21, 0xAB, 0x72, 0x33, 0xA8, 0x38, 0x0D, 0x54, 0xB0, 0xD6, 0x5C, 0xC6, 0xAC,
+    0xC6, 0x06, 0xC7, 0xB0, 0xD5, 0x6F, 0xC2, 0xA0, 0xF3, 0x06, 0xE8, 0xFC, 0x06, 0xE4, 0xED, 0x9F,
+    0x22, 0x3F, 0xF6, 0x43, 0xB4, 0x62, 0x60, 0x03, 0x5C, 0x77, 0x5F, 0x5C, 0xC1, 0xFA, 0x8F, 0xBF,
+    0x42, 0xC5, 0xE3, 0xF5, 0x86, 0x0A, 0xDC, 0x05, 0xEA, 0x72, 0x0C, 0x46, 0x3C, 0xEB, 0x27, 0xBB,
+    0x32, 0xF7, 0x1E, 0x2C, 0xF2, 0xAC, 0x6C, 0x7C, 0x0D, 0x1B, 0xA4, 0x6C, 0x21, 0x1E, 0x64, 0x02,
+    0x73, 0x15, 0x7B, 0x52, 0x04, 0x6B, 0x68, 0x90, 0xBC, 0xB6, 0xA4, 0x04, 0xDF, 0x33, 0x0A, 0x2E,
+    0xFC, 0x5B, 0xB1, 0xB3, 0x41, 0x80, 0xBE, 0x61, 0x7B, 0xCA, 0x75, 0x1A, 0x4C, 0xA5, 0x9C, 0x7B,
+    0xEC, 0xCC, 0x7A, 0x41, 0x35, 0xE4, 0x81, 0x82, 0x29, 0xB6, 0x2E, 0x00, 0x54, 0x9E, 0xD6, 0x45,
+    0x76, 0x1A, 0x5B, 0xF6, 0x31, 0x3F, 0x62, 0xB3, 0xA8, 0x63, 0xA7, 0xD3, 0x11, 0xBD, 0x04, 0x58,
+    0x44, 0x69, 0xD2, 0xC2, 0xDE, 0x1B, 0x33, 0xAB, 0x7A, 0xDB, 0xE5, 0x7D, 0xD1, 0x3B, 0x8C, 0xC4,
+    0xAE, 0x4C, 0xBD, 0xC0, 0xB2, 0x95, 0xE9, 0x21, 0xC9, 0xAD, 0x97, 0x85, 0xC5, 0x44, 0x29, 0x98,
+    0x0A, 0xE1, 0x8F, 0x29, 0x19, 0xE1, 0x6C, 0x58, 0x75, 0x0F, 0x36, 0xA3, 0xD9, 0xB9, 0xBE, 0x39,
+    0x5E, 0x73, 0x99, 0x8D, 0xC4, 0x90, 0x36, 0x95, 0x71, 0xE6, 0x35, 0xF3, 0x52, 0xC9, 0x1D, 0x86,
+    0x6B, 0x16, 0x9D, 0x8A, 0x7F, 0x85, 0xB8, 0x6A, 0x8E, 0x07, 0x73, 0x9F, 0xDD, 0x9C, 0x7D, 0x6C,
+    0x21, 0x7E, 0x75, 0xF0, 0x68, 0xE9, 0xBF, 0x93, 0xF3, 0xC3, 0xAB, 0xC3, 0x91, 0x37, 0x9B, 0xEB,
+    0xE9, 0xD5, 0x9C, 0x9A, 0x83, 0x19, 0x23, 0xD8, 0x59, 0x26, 0xF4, 0xBA, 0xFD, 0x8A, 0x6D, 0xC6,
+    0xB6, 0x14, 0x3E, 0xF0, 0x73, 0x2B, 0x3B, 0xFD, 0x14, 0xBC, 0x20, 0x2E, 0x54, 0x3D, 0x69, 0xA5,
+    0x33, 0x27, 0xC9, 0x13, 0x68, 0x6E, 0xC3, 0xA2, 0x97, 0xDD, 0xF2, 0x1C, 0x79, 0xC3, 0x18, 0x1A,
+    0x3B, 0x0E, 0x44, 0x5A, 0xAE, 0x78, 0xF0, 0x6C, 0x03, 0x5A, 0x82, 0x52, 0xAD, 0xE6, 0xC5, 0x09,
+    0x21, 0xDD, 0x81, 0x5C, 0x97, 0x38, 0x9E, 0xF1, 0x67, 0xC6, 0xF1, 0x8D, 0xFF, 0x69, 0x1C, 0xEF,
+    0xF8, 0xBF, 0x46, 0x95, 0x41, 0x26, 0xC8, 0x80, 0x87, 0x70, 0x5B, 0xA6, 0x2D, 0x9B, 0xB6, 0x10,
+    0xE1, 0x25, 0xA3, 0x6A, 0x77, 0x80, 0xA5, 0xDF, 0xBB, 0xA8, 0x87, 0xA5, 0x3D, 0x50, 0xA6, 0x4F,
+    0x91, 0x5D, 0xEF, 0x75, 0x4A, 0xD7, 0xFB, 0x95, 0xE9, 0x90, 0x03, 0xCA, 0xA0, 0x3D, 0x30, 0x77,
+    0x08, 0xB3, 0xDF, 0x7E, 0x0F, 0x22, 0x82, 0x97, 0x20, 0x70, 0x9B, 0xCB, 0x89, 0xEE, 0x12, 0x0C,
+    0x1E, 0xBD, 0x16, 0xD2, 0x1C, 0x1A, 0x0A, 0x9B, 0x98, 0x3A, 0xC4, 0x2D, 0x20, 0xCF, 0xD4, 0xAB,
+    0xF4, 0x0E, 0x7A, 0x37, 0xB0, 0x7B, 0x86, 0xC1, 0x61, 0x02, 0xE5, 0x5F, 0xAD, 0x20, 0xA1, 0x68,
+    0x6C, 0x9D, 0xBA, 0x6E, 0xC2, 0xD9, 0xDC, 0x24, 0xA6, 0xFF, 0xFE, 0x35, 0x9A, 0x89, 0xAE, 0xC0,
+    0x1F, 0xE3, 0x41, 0x62, 0xF6, 0x67, 0x4D, 0x8C, 0x24, 0xA7, 0x10, 0xB1, 0x94, 0x41, 0x19, 0xC3,
+    0x8D, 0x8F, 0xEC, 0x43, 0x82, 0xD9, 0x3E, 0xA0, 0xE2, 0x29, 0x22, 0x49, 0xF8, 0xB2, 0x25, 0x1A,
+    0x88, 0x78, 0x57, 0xE2, 0xCC, 0xA3, 0x12, 0x1C, 0x41, 0x3B, 0xE7, 0xED, 0xCD, 0x95, 0xC5, 0xE9,
+    0x30, 0x72, 0x61, 0x8D, 0x3E, 0x12, 0x29, 0x98, 0x92, 0x97, 0x93, 0xF4, 0x7F, 0xE4, 0xFF, 0xC7,
+    0x8B, 0x66, 0x9E, 0x18, 0x3B, 0x0F, 0x70, 0xF5, 0x7A, 0x8F, 0x9E, 0x5B, 0xA3, 0x8F, 0x2F, 0xCD,
+    0xAE, 0x00, 0xC2, 0x0F, 0x56, 0x4C, 0x3E, 0x8D, 0x45, 0xE4, 0x83, 0x50, 0x1F, 0x53, 0x3E, 0x1C,
+    0x57, 0xA7, 0xB8, 0x76, 0xBC, 0x29, 0x02, 0x56, 0x54, 0x2D, 0x8D, 0x34, 0x47, 0x42, 0x56, 0x90,
+    0xE3, 0x4A, 0x53, 0xE5, 0x51, 0x9A, 0xC0, 0xB2, 0x0F, 0xAE, 0x0E, 0xC0, 0x65, 0x7F, 0x5D, 0x7F,
+    0x9F, 0xC8, 0xDD, 0x57, 0xB9, 0x47, 0x5C, 0xC8, 0x1C, 0xF0, 0x31, 0x12, 0x3E, 0xC3, 0x54, 0x69,
+    0x64, 0xCD, 0x67, 0xF0, 0x64, 0xCB, 0x90, 0x70, 0x54, 0x26, 0x76, 0x63, 0x42, 0x31, 0xE6, 0xB4,
+    0x53, 0xE5, 0x1F, 0x99, 0x13, 0x27, 0x20, 0x69, 0x42, 0xD6, 0xB1, 0xF8, 0x23, 0xFF, 0x3F, 0x5C,
+    0x1C, 0xD4, 0x6A, 0x4D, 0x38, 0x57, 0x82, 0x28, 0x39, 0x1E, 0xDF, 0x93, 0x01, 0x57, 0x09, 0x45,
+    0xC6, 0x37, 0x9A, 0xF8, 0x6F, 0x65, 0x44, 0x4E, 0x9E, 0x1C, 0xCD, 0x26, 0xD9, 0xC9, 0x55, 0x23,
+    0xC3, 0xFA, 0xC8, 0x21, 0xD3, 0xD0, 0x1C, 0xDB, 0x12, 0x6E, 0x2B, 0x4C, 0x17, 0xE0, 0xC2, 0xF7,
+    0xD7, 0xF4, 0x4C, 0x7A, 0x53, 0x1A, 0x11, 0x90, 0x45, 0x94, 0x91, 0xC1, 0x2D, 0x85, 0xAA, 0x5D,
+    0xDE, 0x6D, 0x4D, 0x19, 0x60, 0xC6, 0xE2, 0x19, 0xA7, 0x97, 0x86, 0x42, 0xB7, 0xFF, 0xF1, 0x5B,
+    0xEF, 0xD3, 0xD8, 0x3A, 0x4A, 0x2E, 0xEE, 0x69, 0xDE, 0x1F, 0x80, 0x6D, 0xCF, 0xDB, 0xDC, 0xDC,
+    0x4C, 0x54, 0x5D, 0x02, 0x79, 0xCA, 0x55, 0xF2, 0xCE, 0xE4, 0xD1, 0xC3, 0xBB, 0x7B, 0x7A, 0x7F,
+    0xCD, 0x7F, 0x7B, 0x12, 0x86, 0x5C, 0x01, 0x17, 0x7A, 0x98, 0x99, 0x30, 0x34, 0xE5, 0xA4, 0xFA,
+    0xB8, 0x09, 0x43, 0xB4, 0x1F, 0xCF, 0x06, 0x6B, 0x9E, 0xCD, 0x0E, 0x39, 0x09, 0xDB, 0xE7, 0xDE,
+    0xC2, 0x30, 0xC0, 0xD1, 0x3E, 0x80, 0xA7, 0xAF, 0x63, 0x9E, 0x5B, 0xE7, 0x36, 0x83, 0x5F, 0xB2,
+    0x5B, 0x9F, 0x06, 0x25, 0xF4, 0xE0, 0x71, 0x25, 0x3A, 0x01, 0x12, 0x62, 0x5C, 0x04, 0xDE, 0x3E,
+    0x1F, 0xB7, 0x89, 0xD1, 0xEF, 0x3C, 0xF3, 0x30, 0x10, 0xE0, 0xE5, 0xD2, 0xD7, 0xF4, 0xA0, 0x2B,
+    0x7A, 0x4F, 0x04, 0xA7, 0xE3, 0x29, 0xD4, 0x4F, 0x92, 0xED, 0x6C, 0x92, 0x48, 0x73, 0xA2, 0x5F,
+    0x54, 0xCE, 0x8F, 0x86, 0x4C, 0x0B, 0xF9, 0x92, 0xC6, 0x47, 0x18, 0x0D, 0xAE, 0x4E, 0xA6, 0x8F,
+    0x9B, 0xDA, 0xCB, 0x28, 0x6E, 0x45, 0x1F, 0xC2, 0x96, 0xC3, 0x18, 0x03, 0x9E, 0xC6, 0x02, 0x17,
+    0x57, 0xE5, 0x34, 0x59, 0x17, 0x19, 0x02, 0x9E, 0xD4, 0x96, 0x3E, 0x44, 0x17, 0xA8, 0x7F, 0xE9,
+    0xB1, 0xB5, 0x94, 0xBE, 0x17, 0x18, 0x03, 0xAF, 0xF4, 0x8E, 0xE6, 0x23, 0x9D, 0xE8, 0xB7, 0x36,
+    0x8B, 0x77, 0x46, 0xC5, 0x17, 0x8D, 0x97, 0x9D, 0xEC, 0xEA, 0xCB, 0xA7, 0x56, 0xCE, 0xE7, 0xD1,
+    0xD1, 0xAB, 0x1B, 0xD0, 0x4C, 0x02, 0xD9, 0x36, 0x22, 0x7B, 0x23, 0x59, 0x5D, 0xB1, 0xC5, 0x93,
+    0xE6, 0xF3, 0x64, 0x37, 0xDE, 0x7C, 0x95, 0x4D, 0xBA, 0x05, 0xB3, 0xDF, 0xB0, 0xE5, 0x9E, 0x1D,
+    0x0F, 0xCF, 0xFD, 0x73, 0x6F, 0x4F, 0x52, 0xAC, 0x5E, 0x4E, 0xA8, 0x97, 0xD3, 0x46, 0x12, 0x73,
+    0xF6, 0xC6, 0xE8, 0xD3, 0x65, 0x5E, 0x7E, 0x02, 0x6B, 0xE5, 0x22, 0x2F, 0xFF, 0x13, 0xB3, 0x61,
+    0xEE, 0xFC, 0x5F, 0xE0, 0x04, 0xA5, 0xA0, 0x73, 0x0F, 0x63, 0x2C, 0xF0, 0xBF, 0x77, 0xFB, 0xEA,
+    0x49, 0xBF, 0x78, 0xCD, 0x95, 0x3A, 0x3A, 0xBB, 0x5C, 0xF2, 0xE8, 0x63, 0xFE, 0xF3, 0xA8, 0xE4,
+    0x79, 0xAF, 0xE2, 0x31, 0xF3, 0x6E, 0xA6, 0x39, 0x27, 0xEF, 0x96, 0x3C, 0xF4, 0xB5, 0x79, 0x37,
+    0x4F, 0x1F, 0xD4, 0xCD, 0xD1, 0xAB, 0x73, 0x52, 0x0F, 0x51, 0x4A, 0xE6, 0xD4, 0xD6, 0x40, 0xD4,
+    0xD7, 0xE6, 0xA4, 0x3E, 0xBD, 0x50, 0xF8, 0x63, 0x90, 0x5F, 0xBD, 0x41, 0x24, 0x1A, 0x24, 0x8A,
+    0xB9, 0x48, 0xA1, 0x93, 0x44, 0xBE, 0x70, 0x7E, 0x6B, 0xA1, 0x4D, 0xD6, 0x1F, 0xC9, 0x4F, 0x0F,
+    0xC9, 0x7C, 0xBA, 0xDA, 0xD7, 0x49, 0xC1, 0x4C, 0xF4, 0x28, 0x5F, 0x70, 0x76, 0xB6, 0x43, 0x06,
+    0x12, 0xED, 0x9A, 0x14, 0xB9, 0xBF, 0xF4, 0xB1, 0x69, 0xD5, 0xB9, 0x96, 0x5F, 0x63, 0x84, 0x26,
+    0xF7, 0x8D, 0xEB, 0x47, 0xDC, 0xD4, 0x12, 0x95, 0xF0, 0xA5, 0x3E, 0xF1, 0xE0, 0x2E, 0x0C, 0x0B,
+    0x7D, 0xED, 0xC7, 0x58, 0x2F, 0x8C, 0x9D, 0xE9, 0x1D, 0xF4, 0x01, 0x1F, 0x87, 0x1D, 0x46, 0xB4,
+    0x05, 0xEF, 0x22, 0xC9, 0x70, 0x8A, 0x9D, 0xEF, 0x89, 0x54, 0xF5, 0x22, 0x00, 0xBE, 0x28, 0x96,
+    0xA2, 0x7A, 0x16, 0x84, 0x32, 0x33, 0x8F, 0x72, 0xE8, 0x85, 0xD8, 0xC4, 0x25, 0x8D, 0x93, 0xEE,
+    0x90, 0x04, 0xE8, 0xDC, 0x52, 0x9B, 0xB4, 0x4B, 0x1A, 0x5F, 0x58, 0x52, 0x0F, 0x7C, 0xD2, 0x78,
+    0xA2, 0x0D, 0x9C, 0x2E, 0xC6, 0x31, 0x8D, 0x87, 0xE9, 0xB3, 0x40, 0x82, 0xC9, 0x52, 0x82, 0xDA,
+    0xC9, 0x07, 0x2C, 0x98, 0xF9, 0x86, 0x3E, 0x25, 0x99, 0xE7, 0xC9, 0xE9, 0x78, 0xD1, 0x54, 0xEA,
+    0xBC, 0x7F, 0xEA, 0xA4, 0x55, 0xA9, 0x7A, 0xA6, 0x82, 0xD1, 0x7E, 0x19, 0x36, 0xCF, 0xB7, 0x6B,
+    0x8C, 0xDC, 0x48, 0xCC, 0x67, 0xDB, 0xB5, 0x9B, 0x65, 0xE2, 0xC0, 0x9C, 0x39, 0x6A, 0x5F, 0xEC,
+    0x34, 0xB1, 0x67, 0xE4, 0x0A, 0x7E, 0xEC, 0x5B, 0x63, 0xA4, 0xE4, 0xAF, 0x63, 0xB8, 0x64, 0xCE,
+    0x74, 0x97, 0x5A, 0x97, 0x7F, 0xF3, 0xDC, 0x27, 0xE9, 0x9F, 0x5A, 0xCC, 0x2D, 0x36, 0x0B, 0xB9,
+    0xC5, 0x07, 0xD4, 0x45, 0xF9, 0x0C, 0x7E, 0x08, 0xD1, 0xA3, 0x31, 0x0A, 0x4F, 0x8D, 0xBA, 0x21,
+    0xB7, 0x98, 0xC9, 0xB1, 0x47, 0x01, 0x1E, 0x3A, 0x38, 0xB7, 0xF8, 0xCC, 0x72, 0x6E, 0x71, 0x3A,
+    0x8B, 0x6A, 0xB3, 0x3E, 0x13, 0xA2, 0x8E, 0x3E, 0x44, 0x7A, 0xAA, 0x45, 0xFB, 0x18, 0xCC, 0x4B,
+    0x83, 0xB8, 0x03, 0x22, 0xBE, 0xD4, 0x03, 0x68, 0x14, 0xE0, 0x87, 0x31, 0x43, 0xD1, 0xDE, 0xA8,
+    0x3C, 0xEB, 0xBD, 0x23, 0x00, 0x71, 0xE0, 0x3B, 0xB2, 0xCB, 0x79, 0x75, 0x8A, 0x2C, 0x53, 0xEF,
+    0xAB, 0x89, 0x5C, 0x01, 0x43, 0x99, 0x31, 0x19, 0x99, 0x1A, 0x01, 0xDB, 0x82, 0xB2, 0x1E, 0xB2,
+    0x7D, 0x97, 0xF3, 0xFC, 0xC9, 0x60, 0x98, 0x1B, 0x11, 0x83, 0xA0, 0x41, 0x12, 0xAB, 0x6D, 0x1E,
+    0xDD, 0x33, 0xB0, 0x97, 0x24, 0x7F, 0x6E, 0x68, 0x20, 0xC1, 0x67, 0x84, 0xB2, 0x82, 0xD5, 0xD3,
+    0xDD, 0xE6, 0x45, 0xAF, 0x31, 0xBD, 0x0D, 0xF4, 0xB6, 0x3F, 0xB0, 0xF2, 0xA2, 0x04, 0x08, 0xA4,
+    0x23, 0x24, 0x72, 0x96, 0x47, 0x58, 0x43, 0xD1, 0x6A, 0xFC, 0xA0, 0xD9, 0x05, 0xCC, 0x7E, 0x80,
+    0xB1, 0x8A, 0x4F, 0xD9, 0xCD, 0xCC, 0x1C, 0x78, 0xCA, 0x7E, 0x16, 0xE4, 0xCF, 0xD9, 0x5F, 0x32,
+    0x0B, 0x99, 0x37, 0xA8, 0x9F, 0xEE, 0x2E, 0x61, 0xB8, 0x6A, 0x5A, 0x50, 0x1A, 0x66, 0x01, 0x3E,
+    0xDA, 0xB7, 0x11, 0x5E, 0xB0, 0xA7, 0xED, 0xF7, 0x6F, 0xD9, 0xFE, 0xA5, 0xEA, 0x39, 0xE1, 0x3E,
+    0xD5, 0x73, 0x0E, 0x5C, 0x88, 0x2C, 0x19, 0x84, 0xA2, 0x28, 0x1E, 0xAB, 0xA4, 0x45, 0x65, 0x9F,
+    0xFE, 0xA6, 0x99, 0x5D, 0xAC, 0x80, 0xC6, 0x72, 0x68, 0xDB, 0xE4, 0xB2, 0x2C, 0xCC, 0x86, 0xF1,
+    0xC8, 0x31, 0x1E, 0xDB, 0x83, 0x4D, 0xB7, 0x85, 0xA2, 0x04, 0x01, 0x97, 0x93, 0xD0, 0xAF, 0xA4,
+    0x71, 0xB2, 0xB6, 0xF2, 0xB7, 0x65, 0x16, 0x31, 0x5F, 0x04, 0xE6, 0x0C, 0x2E, 0x26, 0xF4, 0xD6,
+    0xB0, 0xBB, 0x6A, 0x31, 0x42, 0x87, 0xD9, 0xE3, 0xA5, 0x15, 0x9A, 0x01, 0xC0, 0x53, 0x00, 0x4D,
+    0x95, 0x6E, 0x86, 0x46, 0xB3, 0x74, 0xE9, 0x3A, 0x0D, 0xA7, 0xB0, 0x9F, 0x4C, 0xA5, 0xF3, 0xA2,
+    0x29, 0x5A, 0xAA, 0xDB, 0xAA, 0x89, 0xF5, 0xA1, 0x67, 0xAB, 0xB0, 0xA2, 0x5F, 0x05, 0x7F, 0xDD,
+    0x66, 0x31, 0xB4, 0x77, 0x28, 0xFF, 0x66, 0x68, 0x92, 0x16, 0x83, 0x8B, 0x65, 0x21, 0x77, 0x49,
+    0xD8, 0x99, 0x53, 0x2F, 0xD1, 0x7D, 0x95, 0x9B, 0x13, 0x41, 0x22, 0xAB, 0xFF, 0xF2, 0x67, 0xC0,
+    0xC3, 0x65, 0x71, 0xB1, 0xB2, 0xE7, 0x54, 0x36, 0x29, 0x32, 0x74, 0xD9, 0xAB, 0xD4, 0x88, 0x77,
+    0x76, 0x5C, 0x29, 0x77, 0x5C, 0x1D, 0x57, 0x1A, 0xB3, 0xF2, 0x30, 0x6D, 0x3F, 0x58, 0x1E, 0x5F,
+    0xA9, 0x58, 0xA3, 0x07, 0x11, 0x8B, 0xB3, 0xA1, 0x46, 0x24, 0xFD, 0xC8, 0xAD, 0x48, 0xCF, 0x05,
+    0x6D, 0x57, 0x72, 0xB9, 0x06, 0x02, 0xC9, 0x0D, 0x67, 0x94, 0xD9, 0xC7, 0x15, 0xA7, 0x78, 0x8C,
+    0x87, 0xB6, 0xF4, 0x47, 0xE8, 0xF4, 0xD3, 0x79, 0x08, 0x6F, 0x0E, 0x8D, 0x56, 0x72, 0xBD, 0x4F,
+    0xFE, 0x24, 0xD7, 0xAF, 0x23, 0xC8, 0x36, 0xF1, 0xBB, 0xC4, 0xA2, 0x58, 0x5F, 0xE6, 0xF5, 0x69,
+    0x74, 0xCC, 0xEB, 0x5E, 0x94, 0x67, 0xE6, 0xA5, 0xD0, 0x16, 0xAA, 0x57, 0xDE, 0xE4, 0x20, 0x2A,
+    0x45, 0x49, 0x10, 0x8A, 0xC7, 0xCD, 0xC8, 0x5E, 0x17, 0xF5, 0xFD, 0xC2, 0xD7, 0x61, 0xFC, 0x3A,
+    0x93, 0x3D, 0x19, 0x24, 0xB1, 0xF4, 0x98, 0x6E, 0x61, 0x18, 0xF8, 0x8C, 0x57, 0xC6, 0x6A, 0xE8,
+    0xBE, 0x1C, 0x2B, 0x81, 0x8E, 0xC7, 0x67, 0x54, 0xAD, 0xD1, 0xD4, 0xB9, 0x60, 0x27, 0x7D, 0x91,
+    0xA9, 0xA1, 0xD3, 0x98, 0x46, 0x19, 0x24, 0x56, 0x68, 0x74, 0x5D, 0x4C, 0x85, 0xA5, 0x43, 0x82,
+    0x05, 0x77, 0xD5, 0x18, 0x1D, 0x12, 0xA5, 0x24, 0x86, 0xC3, 0x66, 0x5D, 0x58, 0xD4, 0x75, 0xD1,
+    0xB5, 0x6D, 0x06, 0x65, 0x25, 0x75, 0x82, 0x9A, 0x5F, 0x2D, 0x0B, 0x6E, 0x83, 0x28, 0x77, 0x0B,
+    0x0C, 0x91, 0x22, 0x40, 0x90, 0xEC, 0x64, 0x8A, 0x3E, 0x65, 0x42, 0x55, 0x9A, 0xA6, 0x22, 0x80,
+    0xC3, 0xAA, 0xB0, 0x68, 0x00, 0x41, 0xD7, 0xAF, 0x07, 0xC8, 0x22, 0x31, 0x56, 0xE8, 0x53, 0x5A,
+    0xC9, 0x87, 0xB2, 0x10, 0x63, 0x01, 0xE6, 0x6A, 0x56, 0x34, 0x4F, 0xCF, 0x64, 0x25, 0x9F, 0x44,
+    0x2B, 0xF9, 0xDC, 0x18, 0x2A, 0xF9, 0xA8, 0xB3, 0xE0, 0xF2, 0xB0, 0x7B, 0x9E, 0xEA, 0xC1, 0x43,
+    0x6D, 0xEF, 0x60, 0xEA, 0x25, 0xD4, 0xDE, 0x03, 0x14, 0xDF, 0xA6, 0x07, 0xE8, 0x90, 0x7C, 0xCE,
+    0x6B, 0x3A, 0x56, 0xB1, 0x8D, 0xEC, 0xBE, 0xB7, 0x72, 0xB5, 0x19, 0x1E, 0x77, 0x42, 0x07, 0x7D,
+    0x9D, 0xA5, 0x7E, 0xB6, 0xA6, 0x1A, 0x7C, 0x78, 0x48, 0x23, 0x2B, 0x72, 0x48, 0x52, 0x63, 0x65,
+    0x10, 0xEF, 0x82, 0x25, 0x1C, 0x1F, 0x63, 0x25, 0xAC, 0xB2, 0xEB, 0xAF, 0x11, 0xD2, 0x2B, 0x39,
+    0xA2, 0x47, 0x72, 0x4C, 0xA3, 0x56, 0x40, 0xC2, 0x3C, 0x61, 0x9C, 0x6B, 0x4D, 0x37, 0x6E, 0x7C,
+    0x3F, 0x33, 0x8E, 0x3F, 0x68, 0x0C, 0x85, 0x46, 0x4E, 0x68, 0xBC, 0x84, 0x46, 0x4B, 0x70, 0x2F,
+    0xD4, 0xBC, 0x5E, 0xA3, 0xA9, 0xDF, 0x8C, 0x96, 0xF8, 0x6B, 0xE6, 0x7D, 0x92, 0x04, 0x9A, 0x90,
+    0xE6, 0x84, 0x0A, 0x8D, 0x30, 0x3C, 0x71, 0x00, 0x44, 0xAD, 0x04, 0x1F, 0x8C, 0x70, 0x43, 0x34,
+    0x08, 0x59, 0x25, 0x17, 0x8E, 0xD3, 0x9F, 0xFD, 0x4F, 0xE1, 0x39, 0xC4, 0xE4, 0xA5, 0xF9, 0xC0,
+    0x34, 0x5C, 0x99, 0xCD, 0xF9, 0x81, 0x83, 0x18, 0xAD, 0x1C, 0xD5, 0x70, 0xA5, 0xB1, 0xB5, 0x46,
+    0x23, 0x3E, 0x34, 0x7A, 0x82, 0xAD, 0x45, 0xEC, 0x44, 0x09, 0x36, 0x1A, 0xC2, 0x91, 0x5C, 0x69,
+    0x84, 0x96, 0x71, 0xE6, 0xA4, 0xCC, 0x55, 0xC6, 0x34, 0xAC, 0xF4, 0xB5, 0x07, 0x32, 0xEE, 0x03,
+    0x19, 0xEE, 0xC6, 0x62, 0x11, 0x8F, 0x3F, 0x64, 0xC2, 0x70, 0x46, 0x89, 0x80, 0xD4, 0x78, 0x06,
+    0xF0, 0xDC, 0x09, 0x42, 0x52, 0xF8, 0x1C, 0xA9, 0xF7, 0x0D, 0x52, 0x18, 0xD3, 0x6A, 0xD4, 0xB1,
+    0x5A, 0x90, 0xCB, 0xB5, 0x7D, 0xA9, 0xE5, 0x39, 0xA4, 0xE4, 0x39, 0x52, 0xF2, 0x1C, 0x29, 0x79,
+    0x4E, 0x29, 0xA9, 0xE6, 0x6E, 0xAD, 0x59, 0xEA, 0xB9, 0x6A, 0x41, 0xA0, 0xEA, 0xAE, 0xE2, 0x88,
+    0x29, 0xE2, 0x3F, 0x18, 0x75, 0x22, 0xAC, 0x41, 0xB8, 0xF0, 0x57, 0x21, 0xE7, 0x60, 0xF1, 0x36,
+    0x27, 0x30, 0x27, 0x9B, 0x13, 0xA4, 0xC9, 0x9F, 0x62, 0x2A, 0xB3, 0x0D, 0x2E, 0xDB, 0xB5, 0xE5,
+    0xA8, 0x34, 0xFF, 0xA2, 0xE5, 0x39, 0xA4, 0xCF, 0x09, 0x90, 0xA1, 0x79, 0x34, 0x62, 0x9C, 0x01,
+    0xD2, 0xC7, 0x5B, 0x94, 0x22, 0x39, 0x82, 0x0C, 0x5E, 0xD0, 0xCA, 0xE4, 0xC5, 0x41, 0xF3, 0x4A,
+    0xBE, 0x5F, 0xC5, 0xAC, 0x2B, 0xEF, 0xC9, 0xBC, 0xAA, 0xF6, 0xCE, 0xAB, 0x0D, 0x2D, 0xE1, 0xC5,
+    0x58, 0x26, 0x0D, 0x66, 0x72, 0xF6, 0x0F, 0xDD, 0x50, 0x1E, 0x6B, 0x19, 0xE4, 0x44, 0x87, 0x9C,
+    0x3A, 0x77, 0x87, 0xF4, 0x7A, 0x9F, 0x7E, 0xE8, 0x88, 0xDB, 0xCC, 0x3D, 0x99, 0x57, 0xAD, 0xE1,
+    0xBC, 0xD2, 0xAC, 0x7F, 0x61, 0x41, 0x97, 0x58, 0x30, 0xE9, 0x3C, 0x3A, 0xB2, 0x55, 0x9C, 0x1D,
+    0xD5, 0xE6, 0xD8, 0x38, 0x81, 0x09, 0xE6, 0x9C, 0x5A, 0x62, 0x2A, 0x22, 0xB2, 0xEB, 0x51, 0x4D,
+    0xE6, 0x3A, 0xAA, 0xB9, 0xF7, 0x8C, 0x6A, 0xB6, 0x63, 0x54, 0x1F, 0x9B, 0x3B, 0x17, 0x41, 0x38,
+    0x3D, 0x33, 0xD0, 0xEB, 0x54, 0x1A, 0xAB, 0xD9, 0x47, 0xB9, 0x59, 0xAE, 0x88, 0x15, 0x54, 0x6B,
+    0xB2, 0xAF, 0x11, 0xE5, 0x7E, 0x20, 0x5C, 0xA1, 0x14, 0x14, 0x12, 0x9E, 0xF6, 0x10, 0x5E, 0x22,
+    0x34, 0x5C, 0x2F, 0x7B, 0x2B, 0x86, 0x2D, 0x26, 0x55, 0x7A, 0xA9, 0xCB, 0xD2, 0xFA, 0x1C, 0x02,
+    0x41, 0xAF, 0xCA, 0xD6, 0x37, 0x9E, 0x7E, 0x09, 0x1E, 0xFE, 0x84, 0xF1, 0x14, 0xD4, 0xE1, 0x58,
+    0x8B, 0xE4, 0x7D, 0x2A, 0x72, 0x1C, 0xC8, 0xF1, 0xFB, 0x08, 0x5B, 0x1C, 0x57, 0x13, 0xC6, 0x5C,
+    0xF0, 0x11, 0x08, 0x8A, 0x15, 0xC8, 0x40, 0x1B, 0x48, 0x57, 0x4C, 0x61, 0x60, 0x5A, 0x41, 0x2C,
+    0x9A, 0x8B, 0x2D, 0xFC, 0xF6, 0xC1, 0xAD, 0xC7, 0x74, 0x66, 0xA8, 0xC7, 0x14, 0x38, 0x0D, 0xC9,
+    0xCB, 0x9D, 0xC5, 0x24, 0x59, 0xD4, 0xF0, 0x9C, 0x0D, 0xDC, 0x39, 0xFA, 0xC6, 0x3D, 0x8A, 0x19,
+    0xBD, 0x23, 0x4B, 0xF1, 0x69, 0x7B, 0x11, 0x81, 0x3B, 0x0C, 0xC3, 0xB9, 0xD9, 0xFF, 0x7D, 0xC4,
+    0xCE, 0x66, 0x73, 0x8B, 0x33, 0xF5, 0x6E, 0x32, 0xBD, 0x8E, 0xD8, 0x8B, 0xFA, 0x94, 0xF9, 0x4E,
+    0xE9, 0xF6, 0xC7, 0x45, 0xF8, 0xDA, 0x22, 0x54, 0x72, 0xB7, 0x24, 0xF7, 0xDB, 0xAD, 0x16, 0x6F,
+    0x3A, 0xA5, 0xFD, 0x3E, 0xBA, 0x84, 0x1E, 0xFE, 0x64, 0xC9, 0x5D, 0x2C, 0x93, 0xDB, 0xB0, 0x5F,
+    0xB6, 0x00, 0xF9, 0xBA, 0x2D, 0x48, 0x7C, 0x1E, 0x56, 0x25, 0xBA, 0xEF, 0x2D, 0x21, 0x63, 0x76,
+    0x21, 0xA5, 0xA2, 0x23, 0xE3, 0xFE, 0xA7, 0x2C, 0x21, 0xDE, 0xDA, 0x28, 0x35, 0x37, 0x8C, 0x23,
+    0x67, 0xEE, 0xC2, 0xA7, 0xA8, 0xE5, 0xD8, 0xDE, 0x42, 0xDA, 0xC7, 0x05, 0x0E, 0x81, 0x87, 0x77,
+    0x7C, 0x00, 0x65, 0x54, 0x0F, 0x6C, 0xE6, 0x7E, 0x4A, 0x2B, 0x77, 0xE0, 0x37, 0xEE, 0xC0, 0xEB,
+    0xFA, 0xAB, 0xF2, 0xFE, 0x80, 0x41, 0x19, 0x2C, 0xDE, 0x96, 0xB9, 0x03, 0xEA, 0xD0, 0x7A, 0x40,
+    0x29, 0x1D, 0x07, 0x67, 0x50, 0xA7, 0xF8, 0xBA, 0x1C, 0xE4, 0xC8, 0xE7, 0x6B, 0x5C, 0x00, 0xF6,
+    0x42, 0x3E, 0x96, 0xDB, 0xEA, 0x7A, 0x71, 0xC8, 0x15, 0x81, 0x53, 0x6B, 0x45, 0xEB, 0x4E, 0x70,
+    0x3B, 0x35, 0x03, 0x6B, 0x9C, 0x8B, 0xC8, 0x5D, 0x8C, 0x88, 0x02, 0x96, 0x9E, 0x92, 0xE5, 0x2E,
+    0x6A, 0xD8, 0x25, 0xA8, 0xE6, 0x9E, 0x16, 0x1F, 0xE9, 0xCB, 0x8F, 0xDC, 0x16, 0xB6, 0x9D, 0xC3,
+    0x56, 0xA3, 0x88, 0x58, 0xFF, 0xC1, 0x25, 0x40, 0x29, 0x4E, 0x1D, 0xA6, 0x26, 0xC0, 0x68, 0x7B,
+    0x8F, 0x35, 0x1B, 0xA2, 0x4C, 0xC6, 0x0C, 0x71, 0xE6, 0x19, 0xCB, 0x16, 0x95, 0x51, 0xD6, 0x1B,
+    0xF9, 0x97, 0xB1, 0xF6, 0xAE, 0x52, 0x23, 0x8C, 0x37, 0x53, 0x6B, 0x9D, 0xD7, 0xB8, 0x92, 0x4C,
+    0xF9, 0x96, 0xF6, 0xEC, 0x48, 0x97, 0xCC, 0xFD, 0x61, 0x35, 0xFB, 0xCC, 0x09, 0x05, 0x19, 0x4A,
+    0xF7, 0x13, 0x59, 0x62, 0xD2, 0x69, 0x94, 0xD8, 0xA0, 0xD1, 0xA2, 0xCD, 0x85, 0x92, 0x7E, 0x25,
+    0xF2, 0x6D, 0x81, 0x02, 0x27, 0x71, 0x86, 0xD0, 0x2A, 0xC4, 0x75, 0xC0, 0x55, 0x15, 0xF5, 0xB0,
+    0x5A, 0x82, 0x05, 0xCA, 0x45, 0x21, 0xF0, 0x0A, 0xD1, 0x1B, 0xB8, 0x2A, 0x2C, 0x83, 0x0A, 0x77,
+    0x41, 0x66, 0x0A, 0x2A, 0x69, 0xB0, 0xEA, 0x9A, 0xD5, 0xE8, 0x8D, 0x12, 0x3E, 0x5C, 0xBB, 0x73,
+    0x55, 0x68, 0xFD, 0xAC, 0xAA, 0x15, 0x7D, 0x14, 0x47, 0x04, 0xD3, 0xBA, 0xBD, 0xE4, 0x56, 0xBD,
+    0xE6, 0xDB, 0x64, 0x01, 0x4A, 0x56, 0xC6, 0xB9, 0x88, 0xDB, 0xDB, 0xD2, 0x0E, 0xD9, 0xA2, 0x4A,
+    0x80, 0x2A, 0xF6, 0x06, 0xC0, 0x3F, 0x93, 0x36, 0x28, 0x27, 0x99, 0x9C, 0x12, 0x16, 0xF1, 0x44,
+    0x9E, 0x2C, 0xF7, 0xF2, 0xBA, 0x33, 0x2D, 0x5D, 0x93, 0xD2, 0xCD, 0xE7, 0x26, 0xB3, 0x4F, 0xCA,
+    0x4D, 0xB1, 0xAB, 0xAE, 0xD9, 0xD4, 0x4D, 0x2E, 0xB2, 0x57, 0x5A, 0xD1, 0x18, 0x45, 0xA8, 0x16,
+    0x43, 0x80, 0xAD, 0x69, 0x9F, 0x62, 0x7B, 0x68, 0x21, 0x7D, 0xEA, 0xE3, 0xB9, 0x29, 0xFE, 0x79,
+    0x30, 0xF3, 0x2A, 0x8A, 0x1E, 0x48, 0xEE, 0xE1, 0x83, 0x2A, 0x67, 0xEC, 0x5A, 0xD5, 0x38, 0xF8,
+    0x87, 0x9B, 0xDE, 0x41, 0xCB, 0x69, 0xDE, 0xB2, 0xD6, 0xDA, 0x29, 0x59, 0x5A, 0xA7, 0xCE, 0xA3,
+    0x24, 0xE8, 0x39, 0x01, 0x0F, 0x9F, 0x45, 0xF5, 0xB0, 0xDB, 0xD7, 0xFF, 0x6F, 0x13, 0xB8, 0x32,
+    0x6B, 0xED, 0x10, 0x26, 0x71, 0x6D, 0x70, 0xFC, 0x1F, 0x1B, 0x12, 0x26, 0x3E, 0xA3, 0x00, 0xAD,
+    0x9A, 0xC6, 0x97, 0x84, 0x49, 0xAE, 0x7A, 0xF5, 0x78, 0x7A, 0xCE, 0x13, 0xF1, 0xE1, 0xAC, 0x68,
+    0xE1, 0xE5, 0x23, 0x02, 0x4E, 0x9B, 0xB9, 0x61, 0xE7, 0x36, 0x80, 0xB3, 0xFD, 0x5C, 0x34, 0x2E,
+    0x7B, 0x8A, 0x93, 0x4B, 0x77, 0x94, 0x6A, 0xD8, 0x43, 0xE6, 0xE0, 0x2F, 0xC1, 0x2E, 0x43, 0x59,
+    0x76, 0xF6, 0xE2, 0x43, 0xB6, 0x44, 0xA6, 0x42, 0xCA, 0x6D, 0xEE, 0x3C, 0x7B, 0x71, 0x85, 0xE4,
+    0xAE, 0x58, 0x17, 0x10, 0x51, 0x6B, 0x25, 0xE4, 0x19, 0x5F, 0x05, 0x08, 0xC6, 0x3B, 0x7A, 0x0D,
+    0x35, 0xA4, 0xED, 0x73, 0xF3, 0xB0, 0x64, 0xD5, 0x61, 0xD5, 0xF8, 0x7E, 0x3B, 0x90, 0xD3, 0xE9,
+    0x70, 0xBE, 0x93, 0xB8, 0xB0, 0xF8, 0xDC, 0x26, 0x48, 0xD5, 0x48, 0xB6, 0x76, 0xA7, 0x6A, 0x8C,
+    0xEA, 0x21, 0x55, 0xA3, 0xC5, 0xF8, 0xE6, 0x50, 0x2E, 0x62, 0x74, 0x23, 0xCE, 0x90, 0xD8, 0xFC,
+    0x3A, 0x5A, 0xC8, 0xEC, 0xE6, 0x5F, 0xA0, 0xA2, 0x33, 0x53, 0x9C, 0xED, 0xA0, 0x04, 0xDE, 0x34,
+    0x2A, 0x9E, 0xE2, 0x16, 0xF6, 0x0E, 0x50, 0xE3, 0x5E, 0x52, 0xE4, 0xF0, 0x99, 0xB7, 0x12, 0xF7,
+    0x1E, 0x07, 0xF3, 0xD8, 0xFA, 0x5B, 0xA7, 0xEF, 0x33, 0x45, 0x18, 0x9C, 0x60, 0x36, 0xBB, 0xEF,
+    0xDF, 0x92, 0x22, 0xE5, 0x04, 0x59, 0x9D, 0xAE, 0xBC, 0xDD, 0x68, 0xFF, 0xF2, 0x76, 0x88, 0xBD,
+    0x1B, 0xCA, 0xDB, 0x55, 0x07, 0x94, 0xB7, 0x9B, 0x2E, 0x94, 0xB7, 0xE3, 0x7C, 0xFD, 0x31, 0xCB,
+    0xDB, 0x65, 0x5A, 0xDE, 0x2E, 0xD5, 0xF2, 0x76, 0x05, 0x08, 0x0D, 0x16, 0x53, 0x51, 0x4D, 0xE8,
+    0xCB, 0xDB, 0x4D, 0xA0, 0x26, 0x30, 0xD3, 0x6F, 0xD0, 0xC3, 0xBD, 0x5B, 0x28, 0xA1, 0xBB, 0x13,
+    0xE1, 0xBB, 0xBB, 0x90, 0x08, 0xBF, 0x83, 0x44, 0xF8, 0x6E, 0x88, 0x57, 0x39, 0x35, 0x18, 0xDB,
+    0x8F, 0x0E, 0x15, 0xF8, 0x15, 0x60, 0x5D, 0xBF, 0x61, 0x69, 0x84, 0x46, 0xF6, 0x7A, 0x22, 0x42,
+    0x5A, 0x50, 0x4C, 0x4A, 0x73, 0xDE, 0x79, 0x31, 0xCE, 0x39, 0x7C, 0x16, 0xCA, 0x55, 0xE8, 0xA2,
+    0xDA, 0xEF, 0x07, 0x76, 0x6E, 0x11, 0x73, 0x46, 0x44, 0xAE, 0xAD, 0x9D, 0xC4, 0x55, 0xE7, 0x73,
+    0x3B, 0x6F, 0xEE, 0xF0, 0xC4, 0x61, 0xE7, 0x1B, 0x71, 0x5A, 0xF4, 0x7E, 0x58, 0xFA, 0xDB, 0x46,
+    0x76, 0x16, 0x6F, 0xDD, 0x68, 0x85, 0x13, 0xAD, 0xFA, 0xE5, 0x49, 0xD0, 0xDD, 0x2F, 0x8F, 0x0A,
+    0x91, 0xCF, 0xFA, 0xE5, 0xC3, 0x32, 0xC3, 0x1E, 0xF1, 0xCB, 0xC3, 0x98, 0x68, 0x1A, 0xF5, 0xFE,
+    0xF1, 0x50, 0xAB, 0x61, 0x37, 0x32, 0x08, 0xEB, 0x37, 0x36, 0x37, 0x45, 0x42, 0xB7, 0xFD, 0xCB,
+    0x34, 0x9C, 0x07, 0xDD, 0xA5, 0x64, 0xCD, 0xD1, 0x65, 0xE7, 0xD6, 0x5D, 0x46, 0x31, 0x6B, 0x0A,
+    0x1A, 0x2D, 0x2A, 0x68, 0x5C, 0x55, 0x41, 0x16, 0x0B, 0xA4, 0xE2, 0x7C, 0xBB, 0xC8, 0x5D, 0x60,
+    0x5D, 0x78, 0x59, 0xE6, 0xC3, 0x05, 0x2C, 0xFB, 0x31, 0x5C, 0xA4, 0xBE, 0x65, 0x3C, 0x92, 0xEC,
+    0x79, 0x4E, 0x6E, 0xBB, 0x0D, 0xA4, 0x0B, 0x46, 0x2B, 0x0D, 0x22, 0x87, 0x63, 0xBF, 0x62, 0x89,
+    0xFB, 0x56, 0x49, 0xF4, 0x7B, 0x94, 0xDA, 0x37, 0xE9, 0x7F, 0x7B, 0x39, 0xA7, 0xFB, 0x0D, 0x9B,
+    0x3E, 0x7D, 0x47, 0x02, 0x83, 0x7D, 0x21, 0xFD, 0x29, 0x5E, 0xF7, 0x3C, 0xDF, 0xFA, 0x62, 0xFF,
+    0xD3, 0x14, 0x61, 0xD2, 0x5A, 0x55, 0x7F, 0x2F, 0x64, 0x38, 0x91, 0x97, 0xDE, 0x20, 0x53, 0xD9,
+    0x6B, 0x75, 0x09, 0x0E, 0xB4, 0xBD, 0x7C, 0x94, 0x12, 0x8E, 0x5E, 0x06, 0x38, 0x9A, 0xA2, 0x78,
+    0xE3, 0x02, 0xB4, 0x84, 0xE9, 0x8F, 0xA7, 0xBB, 0x4B, 0x38, 0x7E, 0x0E, 0xDF, 0x9B, 0xD1, 0x01,
+    0x90, 0x77, 0xDB, 0x53, 0xC2, 0xF1, 0x56, 0x95, 0x25, 0x9E, 0x41, 0x70, 0xC9, 0x33, 0xA8, 0x2C,
+    0xF1, 0x0C, 0x2A, 0x4B, 0x5C, 0x18, 0x2A, 0x4B, 0x6C, 0xA3, 0xB2, 0x04, 0xBE, 0x73, 0x60, 0x9F,
+    0xCA, 0x12, 0x55, 0x9F, 0xCE, 0xE2, 0xA4, 0xCF, 0xD1, 0x6D, 0xC1, 0x40, 0xE8, 0x3F, 0x6A, 0xE9,
+    0x73, 0xB2, 0xD7, 0x57, 0x3A, 0x0A, 0x10, 0xB9, 0x7B, 0x35, 0x8A, 0x66, 0x22, 0xDC, 0x0E, 0xA4,
+    0xBA, 0x93, 0xA9, 0x02, 0xC1, 0x1A, 0xBB, 0xDD, 0x63, 0x5A, 0x58, 0x75, 0xC1, 0x7A, 0x37, 0x5A,
+    0x60, 0xA2, 0xFB, 0x41, 0x9C, 0x0B, 0x87, 0x93, 0xC0, 0x0F, 0xB3, 0xB4, 0x80, 0x1E, 0x23, 0x5D,
+    0x65, 0xF6, 0x3E, 0x60, 0x50, 0xF6, 0xB0, 0xFE, 0x68, 0x50, 0xAD, 0x61, 0x47, 0x6C, 0x12, 0xEC,
+    0xC0, 0x47, 0x15, 0xD8, 0x45, 0x9F, 0x69, 0xA7, 0xC1, 0x0D, 0x54, 0x56, 0xE2, 0x82, 0x0D, 0xCD,
+    0xB9, 0xBC, 0x3C, 0xD5, 0x8A, 0x18, 0x17, 0xAD, 0x4B, 0x3C, 0xCE, 0x4E, 0xC1, 0x46, 0x11, 0x65,
+    0xD7, 0x42, 0xEE, 0xC9, 0xC8, 0xDB, 0x41, 0x51, 0x20, 0x70, 0xEF, 0x49, 0x11, 0x6B, 0x01, 0x8B,
+    0x15, 0x57, 0xC7, 0xC2, 0x05, 0xC0, 0xF5, 0xA8, 0x5A, 0x0C, 0xB5, 0x74, 0xFC, 0x42, 0x15, 0x1F,
+    0x27, 0xB1, 0x71, 0x2D, 0x07, 0x0C, 0xBB, 0xF5, 0xB6, 0x75, 0xAE, 0xD4, 0x6A, 0x23, 0xDF, 0xD8,
+    0xE5, 0xEA, 0x66, 0x5C, 0x84, 0xDD, 0x9A, 0xB2, 0xC0, 0xCF, 0x21, 0xF8, 0x1F, 0x2F, 0xC0, 0xCF,
+    0x71, 0x55, 0x26, 0x43, 0x7B, 0x4D, 0xE6, 0x5C, 0x97, 0xE6, 0x6F, 0x6F, 0x76, 0x13, 0x66, 0xB1,
+    0xA5, 0xDF, 0x59, 0x7B, 0x4E, 0xB5, 0x1A, 0x82, 0xC9, 0x90, 0x6C, 0x2F, 0x2D, 0x79, 0xDC, 0xE5,
+    0xE0, 0x50, 0x3E, 0x18, 0xEA, 0xBB, 0x7D, 0xEA, 0x28, 0xA3, 0xAF, 0xEC, 0xE8, 0xEF, 0xE3, 0x4A,
+    0x6C, 0x6A, 0x36, 0x51, 0x1F, 0xC9, 0xB3, 0x8C, 0xEE, 0x0D, 0x0D, 0xFB, 0x1A, 0x79, 0x7E, 0x33,
+    0x64, 0x2B, 0xCF, 0xE5, 0xE0, 0x72, 0x01, 0xDC, 0xF9, 0xCB, 0xA4, 0xCE, 0xB8, 0x37, 0x55, 0xC9,
+    0x9E, 0xA2, 0xC1, 0x96, 0xF4, 0x06, 0xAA, 0x85, 0xB2, 0x0F, 0x71, 0x4E, 0xDF, 0x75, 0x7E, 0x8D,
+    0x95, 0x2E, 0xD9, 0x37, 0xA2, 0xE3, 0x0F, 0xF7, 0xBD, 0x0C, 0x8E, 0x2A, 0x8E, 0x26, 0x8E, 0x22,
+    0x8E, 0x1E, 0xFB, 0x50, 0xE3, 0xFE, 0x96, 0xD9, 0xBB, 0x1B, 0xBE, 0x16, 0x1A, 0x85, 0xAC, 0xB3,
+    0x08, 0xA9, 0x39, 0x48, 0x6D, 0x41, 0xCE, 0x10, 0x94, 0x2F, 0xF2, 0xF1, 0x6C, 0x5E, 0x79, 0x5D,
+    0x2D, 0x3F, 0x34, 0xFB, 0xA8, 0xCD, 0xC7, 0x09, 0x03, 0x51, 0xBF, 0xBF, 0x1E, 0xE6, 0x02, 0x3F,
+    0xC5, 0xD5, 0x9E, 0x72, 0xE9, 0xAB, 0x79, 0x47, 0xB3, 0x54, 0x76, 0xE7, 0x89, 0x80, 0xB5, 0xD6,
+    0x4F, 0xDB, 0x8D, 0x18, 0x49, 0x57, 0xD7, 0x2E, 0xC8, 0x7E, 0x5A, 0x3D, 0x6E, 0x48, 0xB7, 0x06,
+    0x1A, 0x0B, 0x69, 0xD6, 0x5E, 0xA0, 0xC5, 0x0D, 0xF9, 0xAA, 0x7F, 0xA3, 0x21, 0x15, 0xA5, 0x5A,
+    0x68, 0x1A, 0x97, 0x7D, 0xA5, 0x29, 0x58, 0x50, 0x08, 0xB6, 0x31, 0xB0, 0xDB, 0xA9, 0xE6, 0x33,
+    0x3A, 0x8D, 0xD6, 0x05, 0x46, 0x06, 0x08, 0x44, 0x08, 0x33, 0x16, 0x2F, 0x10, 0xF9, 0x20, 0xB8,
+    0x81, 0xC2, 0x8C, 0xF9, 0x75, 0xF3, 0xC0, 0xBC, 0x00, 0xE1, 0xB7, 0x7C, 0x01, 0x42, 0x77, 0x68,
+    0x5E, 0xAC, 0x60, 0x31, 0x32, 0xE6, 0xCA, 0x5C, 0x4A, 0x54, 0x5D, 0x79, 0x5C, 0xDD, 0x8B, 0x0A,
+    0x7E, 0xBF, 0x81, 0x54, 0xD8, 0x1E, 0x5A, 0x2A, 0x1A, 0x70, 0xB9, 0x67, 0x49, 0x7C, 0xB0, 0x1A,
+    0x4A, 0xA6, 0x0F, 0xA8, 0x45, 0x7D, 0x42, 0x13, 0x2F, 0x10, 0xA6, 0xA6, 0xB3, 0x45, 0x3A, 0x0B,
+    0x5D, 0x9C, 0x0D, 0x82, 0xE9, 0x1F, 0xAB, 0x09, 0xE4, 0x94, 0x0B, 0xE9, 0x61, 0x70, 0xBE, 0x9B,
+    0xA1, 0xD2, 0x98, 0x1D, 0x4D, 0xAD, 0xBE, 0x77, 0x86, 0x75, 0x81, 0x98, 0xA8, 0x0D, 0x55, 0xD7,
+    0x3D, 0xB5, 0x98, 0x21, 0xDA, 0xAC, 0x70, 0x3B, 0x98, 0x30, 0x22, 0x70, 0x82, 0xF9, 0xAA, 0x13,
+    0xD6, 0x20, 0xDD, 0xDB, 0x3C, 0xA8, 0xDE, 0x0C, 0x67, 0x5E, 0xBF, 0x91, 0xA8, 0x79, 0x7D, 0x29,
+    0x5E, 0xCD, 0x95, 0x8A, 0x09, 0x97, 0x4A, 0xA8, 0x1F, 0x5F, 0x4A, 0x36, 0xB9, 0x6A, 0xB4, 0xC2,
+    0x22, 0xEB, 0x36, 0x2E, 0x84, 0x92, 0x15, 0x07, 0x43, 0x4D, 0x8C, 0x45, 0xFD, 0xC6, 0x5B, 0x9D,
+    0xC9, 0xBB, 0xF5, 0xC1, 0x68, 0x7D, 0x1D, 0xC7, 0xD0, 0x0C, 0x4A, 0xB1, 0xDA, 0xBC, 0xDC, 0x92,
+    0xBB, 0x3A, 0x57, 0xD9, 0xB1, 0x3C, 0xF6, 0xAA, 0x03, 0xED, 0xA0, 0x0E, 0xDC, 0x0A, 0xEA, 0x99,
+    0xAA, 0x72, 0xA9, 0xC6, 0xA5, 0x0A, 0x97, 0xD3, 0xB7, 0x7A, 0x75, 0xEB, 0xE6, 0x70, 0x59, 0x1D,
+    0x18, 0x52, 0x3A, 0x9C, 0x49, 0x26, 0x99, 0x77, 0xE5, 0xE1, 0x65, 0xF8, 0x09, 0xA8, 0x57, 0x50,
+    0x24, 0x9C, 0x7A, 0xA5, 0x02, 0x98, 0x86, 0xBC, 0xEE, 0x7D, 0x03, 0xDA, 0x1C, 0xA2, 0x10, 0x31,
+    0x5E, 0xD7, 0x89, 0x14, 0x41, 0x13, 0x77, 0x19, 0xAA, 0x82, 0xC2, 0x10, 0x35, 0x82, 0x59, 0xE3,
+    0xBF, 0x0B, 0xFE, 0x47, 0xB9, 0xF8, 0x03, 0xC1, 0xFF, 0xBB, 0x32, 0xDE, 0xAF, 0x05, 0xFF, 0x83,
+    0x7C, 0x7E, 0x0A, 0x5C, 0x9B, 0xF1, 0x8F, 0x04, 0xBF, 0x29, 0x7B, 0xD5, 0xB7, 0x04, 0x4F, 0x85,
+    0xAB, 0x23, 0xFB, 0x7D, 0xBA, 0x6D, 0x42, 0xE2, 0xD4, 0x3C, 0x41, 0x1C, 0x27, 0xAB, 0xC4, 0x51,
+    0xA6, 0x78, 0x52, 0x5C, 0x26, 0x0E, 0xA7, 0x15, 0x71, 0x50, 0x95, 0xC4, 0xE3, 0xDF, 0x4D, 0x15,
+    0x7F, 0x58, 0x10, 0x7B, 0x34, 0x12, 0x8F, 0xA6, 0xC6, 0x22, 0x52, 0x67, 0x0C, 0x67, 0xAA, 0xC8,
+    0x6B, 0x67, 0x76, 0x64, 0x73, 0x5F, 0x47, 0xB9, 0x39, 0x99, 0x1E, 0x7D, 0x34, 0xE6, 0x20, 0x18,
+    0xF6, 0x51, 0xC1, 0xBD, 0xD1, 0xA1, 0x0F, 0x4A, 0x9D, 0xEC, 0x4A, 0x1D, 0x3A, 0x75, 0x9F, 0x4A,
+    0xA2, 0x66, 0x5A, 0x12, 0xF5, 0x66, 0x31, 0xA4, 0x4B, 0x0D, 0x3E, 0xD5, 0xAF, 0xC9, 0xBB, 0x26,
+    0x73, 0x8E, 0x0A, 0x78, 0x2D, 0x03, 0xE5, 0x62, 0xC8, 0x16, 0x32, 0x2C, 0xDC, 0x66, 0xCC, 0xBF,
+    0xF9, 0xCD, 0x6E, 0xB9, 0xCA, 0x3F, 0xE0, 0x05, 0x79, 0x27, 0xEF, 0xCB, 0x0B, 0xF2, 0x46, 0x85,
+    0xC8, 0x4D, 0xFE, 0xD4, 0x47, 0x12, 0x2B, 0x54, 0xC2, 0x0E, 0x76, 0xC2, 0xA7, 0x7F, 0xBB, 0x14,
+    0x7A, 0x0E, 0x8D, 0xC7, 0xDF, 0xC9, 0x6F, 0xAF, 0x7E, 0x37, 0x5C, 0x1B, 0x28, 0xE2, 0x84, 0x8A,
+    0x74, 0x8B, 0xF5, 0xBB, 0x63, 0xAD, 0xDF, 0xFD, 0xD4, 0x50, 0xBF, 0xFB, 0xE5, 0xBE, 0x7E, 0xB7,
+    0x57, 0x3E, 0xC4, 0xBB, 0x68, 0xE5, 0x28, 0x1A, 0x0A, 0xCA, 0xC9, 0xFE, 0xE1, 0xD6, 0x0F, 0x16,
+    0xED, 0xCC, 0xC5, 0x00, 0x75, 0xC7, 0xB0, 0x35, 0xA0, 0x04, 0xC3, 0x9E, 0x92, 0x74, 0x9F, 0x00,
+    0xED, 0x8C, 0x2B, 0x9C, 0x60, 0x56, 0x72, 0xA7, 0x52, 0x7C, 0xA3, 0xD6, 0x38, 0xF2, 0xDF, 0xD5,
+    0x6C, 0xB7, 0xF7, 0x73, 0xC5, 0xE3, 0x1F, 0xD6, 0x5C, 0xCE, 0xFE, 0x37, 0x55, 0x85, 0x0C, 0xD5,
+    0xE8, 0x60, 0x8E, 0x3A, 0xBC, 0xEA, 0xF0, 0x39, 0xD9, 0x24, 0xA1, 0xED, 0x56, 0x7C, 0xC1, 0x1D,
+    0x5E, 0x0A, 0x85, 0x77, 0xDC, 0x21, 0xFA, 0x51, 0xED, 0xBD, 0x6F, 0x5F, 0xAA, 0xCD, 0x5C, 0xD7,
+    0x94, 0x1D, 0x45, 0xBF, 0x5F, 0x75, 0xF8, 0x32, 0xF1, 0x5F, 0x9A, 0x8A, 0xF8, 0x35, 0x61, 0x91,
+    0xC0, 0x95, 0xCF, 0x50, 0xE9, 0x51, 0x25, 0xD4, 0x3B, 0x23, 0x3B, 0x59, 0x25, 0xF4, 0xB3, 0xB6,
+    0xCF, 0x90, 0x21, 0x95, 0x46, 0xB6, 0x04, 0x9D, 0xFE, 0xF1, 0x1D, 0x58, 0x35, 0x02, 0xCB, 0xC4,
+    0xE8, 0x31, 0xF2, 0xA9, 0x7D, 0x7D, 0x93, 0x21, 0x59, 0x6F, 0xA8, 0x05, 0xC7, 0x60, 0xF6, 0x78,
+    0xE1, 0xC6, 0xE6, 0xD6, 0x54, 0x6D, 0x8D, 0x53, 0xA1, 0xDB, 0xFB, 0x6B, 0x6B, 0x09, 0xEB, 0xEE,
+    0x19, 0x2D, 0xA2, 0xDE, 0xA7, 0x70, 0xAB, 0xFB, 0x17, 0x5F, 0x86, 0x22, 0xF3, 0x27, 0x71, 0x76,
+    0x3C, 0xCD, 0x82, 0x6C, 0x62, 0x6B, 0x51, 0x61, 0x91, 0x19, 0x43, 0xFF, 0xE4, 0xA3, 0xFA, 0xD6,
+    0x1B, 0xEA, 0x47, 0xD4, 0x8E, 0xA8, 0x1B, 0x51, 0x33, 0x5A, 0xD6, 0x8B, 0x0E, 0x7A, 0x57, 0xE0,
+    0x00, 0xF6, 0x7B, 0x57, 0xE0, 0xE9, 0x8F, 0xF1, 0xAE, 0x40, 0x70, 0xA4, 0x8A, 0x94, 0xE2, 0xBB,
+    0x02, 0xBD, 0xE9, 0x38, 0xF3, 0xCB, 0x71, 0x89, 0x25, 0xCA, 0x15, 0xBA, 0xB8, 0x40, 0xE9, 0xB9,
+    0xCB, 0x85, 0xB9, 0xD3, 0x73, 0x37, 0xC3, 0x4B, 0x2E, 0x5D, 0xF1, 0xC3, 0x26, 0x16, 0x49, 0x0D,
+    0x33, 0x3B, 0x5E, 0x5B, 0x7B, 0x6E, 0xD1, 0x73, 0x37, 0x51, 0xCF, 0xDD, 0x93, 0xFE, 0xCC, 0x9B,
+    0x0D, 0x9E, 0xBB, 0xB9, 0x25, 0x85, 0x55, 0x78, 0xF8, 0x0A, 0x4C, 0xBC, 0xD7, 0x47, 0x66, 0x95,
+    0x4C, 0x73, 0xCD, 0x2F, 0x50, 0x33, 0x84, 0x5A, 0xD1, 0x5C, 0x04, 0x50, 0xB7, 0x50, 0x8A, 0x20,
+    0x77, 0x50, 0x5F, 0xE0, 0xEB, 0x60, 0xC2, 0x6F, 0x50, 0x1F, 0x82, 0xD2, 0xA9, 0xC2, 0x8E, 0xB5,
+    0x80, 0x5A, 0x27, 0x56, 0x69, 0x44, 0xBE, 0x86, 0x65, 0xEA, 0x6B, 0xDD, 0x4C, 0xFE, 0x37, 0x9A,
+    0xBB, 0x89, 0x72, 0x77, 0x7D, 0x99, 0x7F, 0x59, 0x25, 0x35, 0x9C, 0x31, 0xC9, 0x24, 0x89, 0x8A,
+    0x2F, 0x68, 0xE8, 0xCD, 0x4C, 0xCD, 0x67, 0x58, 0xB7, 0xFA, 0x49, 0xA5, 0xBF, 0xE9, 0xE6, 0xA5,
+    0x26, 0x35, 0xA0, 0x01, 0x0A, 0x41, 0x82, 0xA7, 0x8C, 0x2B, 0x38, 0x8A, 0x65, 0x82, 0x65, 0xDC,
+    0xA2, 0xA0, 0x9B, 0x3D, 0x44, 0xA1, 0x9F, 0x75, 0x77, 0x1C, 0x9C, 0xCC, 0x33, 0xCB, 0x96, 0x53,
+    0xDD, 0x1E, 0x44, 0x7A, 0x78, 0xD3, 0xCF, 0x33, 0x43, 0x55, 0x3E, 0xD9, 0x6E, 0x7E, 0x79, 0x57,
+    0xE9, 0x64, 0xCC, 0x17, 0xFB, 0xB0, 0xD7, 0xB4, 0xCF, 0x19, 0x1F, 0x0E, 0x4E, 0x8E, 0xCA, 0x9B,
+    0x27, 0xC8, 0xFC, 0xE1, 0x9A, 0x53, 0x1C, 0x55, 0x1C, 0x29, 0x1C, 0x3A, 0x98, 0x1E, 0xF7, 0xF9,
+    0xAD, 0x05, 0x67, 0xA1, 0x9C, 0x34, 0xD8, 0xFC, 0x08, 0xAE, 0xF8, 0xC5, 0xDE, 0xAD, 0xEA, 0x3E,
+    0xBE, 0xB3, 0xD3, 0xCF, 0xBE, 0xC0, 0x60, 0xDC, 0x50, 0xE4, 0xDC, 0x20, 0x3B, 0xBF, 0x2B, 0x09,
+    0xFA, 0xEE, 0xBD, 0x6D, 0x01, 0xE5, 0x55, 0x38, 0x5D, 0x00, 0x18, 0x60, 0x3A, 0x33, 0x9F, 0x81,
+    0x24, 0x7F, 0x48, 0x85, 0xDA, 0x93, 0xBD, 0x52, 0xC4, 0x71, 0xE4, 0x34, 0x8B, 0x5E, 0xA5, 0xAA,
+    0x2C, 0x44, 0x7B, 0xEC, 0x4C, 0x33, 0x38, 0x7F, 0xD2, 0xEC, 0xA0, 0x70, 0xE6, 0x62, 0xDF, 0x70,
+    0x66, 0x74, 0x12, 0xF9, 0xF2, 0xF2, 0xC1, 0xDE, 0x53, 0x1D, 0x97, 0x89, 0xFF, 0x8C, 0x3C, 0xF3,
+    0x10, 0x1F, 0x79, 0x45, 0xE3, 0xB2, 0xB9, 0x16, 0x70, 0xDF, 0xD3, 0x64, 0xEB, 0x32, 0x24, 0x53,
+    0xB5, 0x00, 0x8F, 0xFA, 0x84, 0x85, 0x76, 0xE1, 0x83, 0x97, 0x10, 0x34, 0xE7, 0x45, 0x95, 0xBE,
+    0x26, 0x8C, 0x20, 0x47, 0x94, 0xF8, 0x0D, 0x9B, 0xAC, 0x90, 0x43, 0x6C, 0x22, 0x97, 0x02, 0x42,
+    0x05, 0xA7, 0xA8, 0xEC, 0x8D, 0x7B, 0x66, 0xE3, 0xA7, 0xE5, 0x1D, 0xA9, 0x9F, 0xDF, 0xFC, 0x3E,
+    0x39, 0x30, 0x3A, 0xFF, 0xD8, 0xDA, 0x73, 0xF7, 0xB1, 0xBE, 0xA5, 0xB9, 0x4C, 0xFD, 0xDE, 0xE3,
+    0xFA, 0xE9, 0x91, 0x99, 0x05, 0xD9, 0x41, 0x0B, 0xFE, 0xD3, 0x42, 0x62, 0xB7, 0x11, 0x66, 0xDC,
+    0x08, 0x51, 0x50, 0x4A, 0xA6, 0xE5, 0x95, 0xFD, 0x7B, 0xF4, 0x09, 0x92, 0x7B, 0x94, 0x1D, 0x63,
+    0x45, 0x87, 0x98, 0x0E, 0x05, 0xCA, 0xF1, 0xD3, 0xE3, 0xFB, 0x12, 0xFA, 0xE3, 0x55, 0x08, 0xCA,
+    0x3E, 0xD6, 0x9B, 0x3D, 0xCB, 0xE5, 0x37, 0x7B, 0xDE, 0xA4, 0x42, 0x10, 0x66, 0x0B, 0x27, 0x89,
+    0xCE, 0x94, 0xFD, 0xE6, 0xC9, 0x6D, 0xD4, 0x0F, 0x62, 0x09, 0x95, 0xBD, 0x60, 0x6F, 0xFD, 0x20,
+    0x6F, 0x4F, 0xFD, 0xA0, 0xBB, 0x40, 0x9D, 0xEF, 0xAC, 0xAD, 0x9D, 0xA9, 0x28, 0xB6, 0x54, 0xEE,
+    0x78, 0x5F, 0xEA, 0xDC, 0xC3, 0xFA, 0x49, 0xEC, 0x30, 0x12, 0x80, 0x44, 0x94, 0xCD, 0x6F, 0xD6,
+    0xFF, 0xBD, 0xF5, 0x93, 0x44, 0x79, 0xD3, 0x92, 0x3E, 0xF1, 0x00, 0xEF, 0xC5, 0x0C, 0xBA, 0x77,
+    0x34, 0xBA, 0x7C, 0xCB, 0x2D, 0xFB, 0x5E, 0x53, 0xF0, 0xF2, 0x6D, 0x08, 0x0D, 0xF7, 0xF1, 0xED,
+    0x6D, 0x41, 0x72, 0xCE, 0xA0, 0xE6, 0x20, 0x6A, 0xEF, 0xEF, 0x15, 0x1A, 0xEE, 0x62, 0x25, 0xFF,
+    0x95, 0xCD, 0x1F, 0x0C, 0x66, 0xC9, 0xC3, 0x6B, 0x6B, 0x66, 0x57, 0x21, 0xAA, 0x07, 0xF2, 0x0D,
+    0xAE, 0x9F, 0xDF, 0x7C, 0xD5, 0x95, 0xFF, 0x5C, 0xDE, 0x36, 0x51, 0x84, 0xB9, 0x4E, 0x51, 0xB0,
+    0x25, 0x64, 0xE1, 0x79, 0x01, 0x49, 0x5F, 0x84, 0xF9, 0x28, 0x84, 0x8C, 0x93, 0xCB, 0x45, 0x98,
+    0x67, 0x7D, 0x11, 0xE6, 0xD7, 0x41, 0xBB, 0x5F, 0x14, 0x7D, 0x11, 0xE6, 0x0F, 0x93, 0x5E, 0xCD,
+    0xE9, 0x86, 0x72, 0xC7, 0xE7, 0x7B, 0xE9, 0xC9, 0x1B, 0x0C, 0x1C, 0x41, 0x1F, 0xD4, 0xCA, 0x04,
+    0x7C, 0x7D, 0xE3, 0x63, 0xCF, 0xDA, 0xD3, 0x01, 0xFA, 0xC5, 0xC9, 0xFD, 0xD6, 0xE5, 0x03, 0x4A,
+    0x5A, 0x6E, 0x98, 0x54, 0x19, 0xE3, 0x97, 0x9B, 0x7D, 0xD5, 0xC6, 0x07, 0x80, 0xC8, 0xE6, 0xA9,
+    0x2F, 0x43, 0x70, 0xCD, 0xB9, 0xBA, 0xB8, 0x7C, 0x47, 0x33, 0xC4, 0x03, 0x6B, 0x51, 0xB5, 0x60,
+    0xF1, 0x15, 0x0D, 0x0F, 0x30, 0xA9, 0xCD, 0xD7, 0x56, 0x36, 0xE4, 0x66, 0xAC, 0x8C, 0x8E, 0x72,
+    0xA9, 0xE5, 0x4B, 0xB8, 0x58, 0x4E, 0x7B, 0x62, 0xA9, 0xAA, 0xC6, 0x83, 0x40, 0xEF, 0xCB, 0x2E,
+    0xCD, 0x69, 0x3A, 0xC0, 0xFD, 0x38, 0xB6, 0x79, 0xE0, 0x5E, 0x9E, 0xBB, 0x30, 0x9D, 0x09, 0x42,
+    0x73, 0x65, 0x6F, 0x93, 0xEF, 0xDD, 0x6B, 0x7F, 0x16, 0x2C, 0x6A, 0x1F, 0x21, 0xE3, 0xFA, 0x8E,
+    0x33, 0xE0, 0x83, 0x21, 0x56, 0x5B, 0xBB, 0x7B, 0x6E, 0x08, 0x57, 0xED, 0xC1, 0xAD, 0x92, 0xCA,
+    0x6F, 0x9D, 0x14, 0xFF, 0xAA, 0x96, 0x0C, 0xA2, 0x1D, 0xB2, 0x76, 0x0F, 0x3A, 0xE7, 0x9E, 0xD0,
+    0x7F, 0xB0, 0x87, 0xA9, 0x9F, 0xAB, 0x75, 0x75, 0xF7, 0x5A, 0xE7, 0xB7, 0x38, 0x7F, 0x13, 0xAB,
+    0xCA, 0xA7, 0xFD, 0x8D, 0xB3, 0xB0, 0x33, 0x73, 0x2A, 0x36, 0x5A, 0xB2, 0xAD, 0x55, 0xB4, 0xFF,
+    0x82, 0xD1, 0x0E, 0xDF, 0xCF, 0x97, 0x0E, 0x7D, 0xD2, 0x75, 0x0D, 0x7E, 0xCB, 0x90, 0xD5, 0xE5,
+    0x38, 0x66, 0xF0, 0xD6, 0x43, 0x27, 0xFB, 0x22, 0x4E, 0x21, 0x6D, 0x14, 0x1B, 0x77, 0xA3, 0xF4,
+    0xC1, 0xAB, 0x2A, 0x25, 0xD0, 0x2D, 0xEC, 0x3E, 0x8F, 0xC8, 0xDC, 0x8B, 0x6B, 0x8D, 0x9C, 0x5F,
+    0x49, 0x1E, 0xB4, 0xC0, 0xF3, 0xBD, 0x89, 0x79, 0x84, 0x5F, 0x2E, 0x87, 0x72, 0x42, 0x46, 0xAD,
+    0x81, 0xFF, 0xCC, 0xDC, 0x8B, 0xC0, 0xF3, 0x1A, 0x81, 0xE7, 0x3C, 0xFD, 0x99, 0x01, 0xAC, 0xF6,
+    0x1B, 0x45, 0xCC, 0x74, 0x27, 0xB4, 0x67, 0x25, 0xB9, 0x13, 0xB2, 0x79, 0x6B, 0xF6, 0xAD, 0xE7,
+    0x68, 0xFA, 0xEB, 0xE4, 0x38, 0xFD, 0xE5, 0x73, 0x77, 0x4E, 0xB6, 0xF2, 0x36, 0x88, 0xB1, 0x72,
+    0x49, 0x66, 0xAB, 0xAF, 0xD6, 0xD4, 0x8F, 0xF0, 0x3A, 0xBA, 0xFF, 0x0F, 0xDD, 0x5B, 0x3D, 0x70,
+    0x1C, 0x49, 0x15, 0x7E, 0x3D, 0x23, 0x69, 0x40, 0x03, 0x37, 0x0A, 0x4C, 0xC0, 0xA9, 0xEE, 0x26,
+    0x21, 0x80, 0x2B, 0x9F, 0x37, 0x71, 0x40, 0x51, 0x5E, 0xCF, 0x98, 0x94, 0x44, 0x81, 0x54, 0x64,
+    0xE8, 0x42, 0xA0, 0x0A, 0x74, 0x81, 0x03, 0x51, 0x58, 0x9A, 0xB1, 0x09, 0x9C, 0xAA, 0x8A, 0x80,
+    0xE0, 0x02, 0x14, 0x10, 0x18, 0x5D, 0x15, 0x72, 0xA0, 0x40, 0x54, 0x59, 0x9A, 0x31, 0x09, 0x01,
+    0xC9, 0x16, 0x14, 0x10, 0x32, 0x70, 0x2E, 0x28, 0x20, 0xF0, 0x5C, 0xB1, 0x57, 0xB5, 0xBA, 0xDB,
+    0xDD, 0xE6, 0x7D, 0xAF, 0x7B, 0x66, 0x76, 0x17, 0x9F, 0x31, 0x2E, 0x79, 0x7F, 0x98, 0xF3, 0xBD,
+    0xDD, 0x99, 0x9D, 0x99, 0x7E, 0xFD, 0xBD, 0xD7, 0xEF, 0x7D, 0xFD, 0xBA, 0x45, 0xE4, 0x75, 0x88,
+    0x8F, 0xA0, 0x80, 0x0C, 0x4B, 0xC8, 0x56, 0x17, 0xB2, 0xDD, 0x83, 0xDC, 0xED, 0x43, 0x76, 0x07,
+    0x90, 0x65, 0xC6, 0xC2, 0x29, 0x22, 0x96, 0x6E, 0x1E, 0xA5, 0x44, 0x5E, 0x1E, 0xE6, 0x44, 0x7E,
+    0x1C, 0xF0, 0x2B, 0x02, 0x79, 0xC5, 0x9B, 0xE4, 0xF1, 0x2B, 0xA2, 0xA3, 0xF7, 0xF9, 0x15, 0x91,
+    0xD6, 0xFC, 0xF0, 0x29, 0x29, 0x96, 0x7C, 0x71, 0x40, 0x8A, 0x65, 0x46, 0x0E, 0xDF, 0x9C, 0xF0,
+    0x0B, 0xF8, 0x86, 0xD4, 0xE7, 0xEF, 0x51, 0xBE, 0x73, 0x41, 0xCB, 0xBA, 0xAB, 0x35, 0xF9, 0x7A,
+    0x48, 0x63, 0x87, 0x9F, 0x37, 0xBA, 0x19, 0x69, 0xAE, 0xD4, 0x87, 0xCA, 0xF8, 0x09, 0xEF, 0x22,
+    0xCB, 0x29, 0xE8, 0xF8, 0x05, 0x05, 0xB9, 0x5B, 0xB2, 0x56, 0x2E, 0xBA, 0x51, 0x0B, 0xF5, 0xCD,
+    0x92, 0x94, 0xD6, 0x25, 0x05, 0x5D, 0x3E, 0x6D, 0xA5, 0x2C, 0x22, 0xFC, 0x90, 0x18, 0xE1, 0xE1,
+    0x34, 0x60, 0x91, 0xBE, 0xD5, 0xA5, 0x50, 0x7F, 0x38, 0x20, 0x4F, 0xDF, 0xD5, 0x31, 0x5D, 0xA9,
+    0x1B, 0x11, 0x84, 0x82, 0xB2, 0x12, 0x06, 0x30, 0x39, 0xD6, 0x45, 0xA7, 0x4C, 0x30, 0x3A, 0xBC,
+    0x29, 0x97, 0x44, 0x2A, 0xB9, 0xE2, 0xCB, 0xAF, 0x5E, 0xDC, 0xC8, 0x91, 0xF7, 0xCD, 0x0F, 0xE2,
+    0x0A, 0xAA, 0x45, 0x68, 0xFB, 0x97, 0xFB, 0x2C, 0xD6, 0x5A, 0x55, 0x37, 0x5C, 0x68, 0xE2, 0x01,
+    0x70, 0x37, 0x45, 0xA7, 0xA6, 0x08, 0xFA, 0xEB, 0x02, 0x17, 0xFA, 0xBD, 0x1C, 0x3F, 0x02, 0x4C,
+    0x1F, 0x16, 0x95, 0x92, 0xD4, 0x6B, 0xA3, 0x8D, 0x8E, 0x1F, 0x43, 0x25, 0x35, 0xB7, 0xB0, 0xDA,
+    0x23, 0x4C, 0x0D, 0x9A, 0x7E, 0x79, 0xCA, 0x27, 0xBD, 0x03, 0x3E, 0xD9, 0x83, 0x22, 0x41, 0x4C,
+    0x4E, 0xEA, 0xA4, 0xD3, 0xF3, 0x65, 0xE7, 0x50, 0x1A, 0x11, 0x48, 0xE8, 0xCE, 0x32, 0x00, 0x0E,
+    0x0D, 0x4C, 0x0B, 0x07, 0xEB, 0xBE, 0x68, 0x21, 0xCA, 0xFD, 0x0A, 0xED, 0xDF, 0xC7, 0xE5, 0xE0,
+    0xA7, 0xAC, 0x79, 0xDB, 0xE5, 0x27, 0x0E, 0xE9, 0xE1, 0x68, 0x8C, 0xD8, 0xD1, 0x29, 0xA9, 0xE1,
+    0x4E, 0x49, 0x6E, 0xD7, 0xE9, 0x01, 0xA7, 0x3E, 0x5A, 0x12, 0xBD, 0x6B, 0xB1, 0xC5, 0x22, 0x61,
+    0x75, 0xDC, 0x01, 0x9F, 0x32, 0xF8, 0x7D, 0x86, 0x9F, 0x45, 0x68, 0x84, 0xC2, 0x29, 0x8F, 0x86,
+    0xA0, 0x58, 0x3D, 0x63, 0x44, 0xFB, 0x49, 0xAC, 0x74, 0x91, 0x74, 0x68, 0x79, 0xB4, 0x99, 0x40,
+    0x50, 0xF9, 0xCC, 0x0D, 0x39, 0xB9, 0x0A, 0xCF, 0xBD, 0xD5, 0x15, 0xCF, 0xCD, 0x17, 0x0E, 0x62,
+    0x71, 0x15, 0x1F, 0xE3, 0x8E, 0xDF, 0xC6, 0xC7, 0xDB, 0x70, 0xDF, 0x12, 0xEE, 0x1B, 0xCF, 0xCC,
+    0x7D, 0x89, 0xCE, 0x1C, 0x56, 0xD8, 0xD1, 0xFF, 0x64, 0xE9, 0xDE, 0xE7, 0xAB, 0xE4, 0xD0, 0x77,
+    0x48, 0x22, 0x44, 0x83, 0xDB, 0x42, 0xE1, 0x7C, 0x85, 0x58, 0x41, 0x7D, 0xB7, 0xC3, 0x9D, 0xD2,
+    0x39, 0xDF, 0x96, 0xD5, 0x69, 0x0F, 0xBA, 0x85, 0x50, 0x6A, 0x66, 0x60, 0xAF, 0x1C, 0x4C, 0x82,
+    0xFA, 0xE8, 0x0C, 0xED, 0x96, 0xA1, 0xA4, 0x03, 0x37, 0x1D, 0x4F, 0xD4, 0x8B, 0xCB, 0x22, 0xA4,
+    0xA3, 0x32, 0x76, 0x5B, 0x50, 0x72, 0xEF, 0x66, 0x03, 0x78, 0x3E, 0x3F, 0x44, 0xC3, 0x78, 0xBA,
+    0x89, 0x57, 0x4A, 0xE0, 0x15, 0x0B, 0xB8, 0x39, 0x78, 0x85, 0x53, 0xC0, 0x28, 0x64, 0xBA, 0x6D,
+    0x8C, 0xA5, 0xE6, 0xDD, 0x34, 0x91, 0xB8, 0x14, 0x34, 0xE5, 0x97, 0xAA, 0x7B, 0xB7, 0x62, 0xFE,
+    0xE2, 0x71, 0x8B, 0xC3, 0x63, 0xEE, 0x50, 0x82, 0xBB, 0xFC, 0x27, 0x53, 0x25, 0x7A, 0x3F, 0xA3,
+    0x4A, 0x23, 0x9B, 0x5A, 0x0C, 0x65, 0x5B, 0x58, 0x84, 0xCF, 0xEA, 0x8E, 0xF8, 0xDC, 0x8C, 0xBA,
+    0x7B, 0x77, 0xE6, 0x08, 0xAF, 0x4B, 0xCC, 0xF8, 0x9A, 0xE0, 0x43, 0xB7, 0x1B, 0x4F, 0xF6, 0xC4,
+    0x93, 0x1F, 0x2F, 0x1E, 0xCE, 0xAA, 0xD6, 0x63, 0x69, 0x17, 0x5F, 0xBF, 0x2A, 0x6D, 0xC2, 0x9D,
+    0x67, 0x0F, 0xF6, 0x99, 0x92, 0x64, 0xF9, 0x37, 0x24, 0xCB, 0x5F, 0x8F, 0x24, 0x4B, 0x39, 0x16,
+    0xD1, 0xA9, 0xEB, 0x64, 0xA9, 0x6C, 0xB2, 0xB4, 0x13, 0x2A, 0x95, 0xAA, 0x59, 0x83, 0xED, 0xA4,
+    0xAE, 0x74, 0x3D, 0x40, 0x5B, 0x1F, 0x67, 0xCD, 0x94, 0x70, 0xFD, 0x90, 0xFE, 0x4F, 0xD2, 0xA4,
+    0xCA, 0x99, 0x7E, 0xCC, 0xD8, 0xA5, 0x9F, 0x97, 0x21, 0x33, 0xCD, 0x5E, 0xB1, 0x03, 0xC1, 0x34,
+    0xDD, 0xCF, 0x1D, 0x66, 0xF2, 0x10, 0x4E, 0x2D, 0x18, 0xCB, 0x09, 0x31, 0xD8, 0xDA, 0x00, 0xF1,
+    0xEA, 0xE3, 0xDB, 0x26, 0x3D, 0xF3, 0x96, 0x4A, 0xDC, 0x86, 0x38, 0x81, 0xE8, 0xF2, 0xEB, 0x9D,
+    0x72, 0x7B, 0x78, 0x74, 0x5C, 0xA2, 0xC9, 0x72, 0x14, 0x80, 0xDE, 0xD8, 0x73, 0x72, 0x5A, 0x1F,
+    0x8C, 0x97, 0x33, 0xCC, 0x72, 0xAF, 0xF4, 0x4B, 0x06, 0xA6, 0x1B, 0xA6, 0x4E, 0x3F, 0x8A, 0x55,
+    0x9F, 0xAD, 0xDB, 0x8F, 0x8E, 0x8E, 0xFA, 0xB0, 0x5E, 0xB4, 0xB5, 0xB5, 0x19, 0xD9, 0xCC, 0x18,
+    0x31, 0xC4, 0xB0, 0x36, 0xDB, 0xFA, 0x4B, 0x5E, 0x57, 0x75, 0x59, 0xCF, 0x82, 0xE7, 0x27, 0xEC,
+    0xE8, 0x1B, 0x0D, 0x0E, 0x40, 0x00, 0xFF, 0x57, 0x20, 0xA8, 0x73, 0xD8, 0x84, 0x07, 0x07, 0xAD,
+    0xBA, 0x85, 0x10, 0x60, 0x32, 0x6F, 0xA1, 0xF3, 0x3A, 0xE2, 0xDE, 0x9E, 0x35, 0x5E, 0x28, 0x36,
+    0x44, 0xFC, 0xC3, 0x0F, 0x12, 0xA2, 0xB5, 0xD0, 0x74, 0x17, 0x75, 0x06, 0x28, 0x0B, 0x37, 0x55,
+    0xF1, 0xE5, 0x03, 0x26, 0x13, 0x84, 0xA8, 0xFB, 0x1A, 0x77, 0x7B, 0xF8, 0x3D, 0xA2, 0x22, 0xE1,
+    0xF6, 0xE2, 0x95, 0x62, 0xC4, 0x3C, 0x33, 0x83, 0x63, 0x13, 0x41, 0x3A, 0x7D, 0xE8, 0x3D, 0xFD,
+    0xA8, 0xF0, 0x1D, 0x9D, 0x2F, 0xD3, 0xF7, 0x5F, 0x95, 0xCF, 0x28, 0xC4, 0x22, 0xF8, 0xC5, 0x26,
+    0xF3, 0x01, 0x67, 0xC8, 0xF3, 0x3A, 0x0F, 0x69, 0x21, 0xB8, 0xCF, 0xC0, 0xB7, 0x11, 0x32, 0xD6,
+    0xF8, 0xBF, 0xB9, 0x18, 0x4B, 0x75, 0xC5, 0xA4, 0xA8, 0x2A, 0x26, 0xFB, 0x32, 0x0B, 0x0A, 0x69,
+    0x72, 0x16, 0x24, 0x61, 0x08, 0x18, 0x11, 0x40, 0x42, 0xC8, 0xE1, 0xB0, 0xC1, 0x30, 0x11, 0x70,
+    0x02, 0x28, 0x2C, 0x18, 0x29, 0x13, 0x1C, 0x81, 0x95, 0xA1, 0x9D, 0x46, 0xC4, 0xD5, 0xE8, 0x00,
+    0x60, 0x04, 0xC4, 0x48, 0x20, 0x13, 0xCC, 0x04, 0xB4, 0xAF, 0x48, 0x7C, 0x8E, 0x25, 0x10, 0xB2,
+    0xA1, 0xD4, 0x5F, 0x10, 0xF4, 0xE6, 0x12, 0xB5, 0x11, 0xB2, 0x77, 0x8F, 0xE3, 0x8E, 0x92, 0x82,
+    0x48, 0x88, 0x40, 0xDD, 0x46, 0xFD, 0xEE, 0x90, 0xC6, 0x12, 0x51, 0xA8, 0x19, 0xC4, 0xEC, 0x98,
+    0x07, 0x63, 0x1F, 0x6A, 0x96, 0x9C, 0x2D, 0xBC, 0x82, 0x93, 0x05, 0x03, 0x91, 0xA0, 0xEE, 0xC1,
+    0x31, 0xF8, 0x1F, 0x47, 0x7C, 0xCA, 0xAF, 0xA7, 0xE0, 0xF7, 0x5B, 0x5B, 0xB8, 0x46, 0x56, 0x20,
+    0xA6, 0x78, 0x12, 0xCE, 0xBB, 0xF4, 0x59, 0x52, 0x03, 0xDA, 0x43, 0xD7, 0x7B, 0x78, 0x29, 0x7E,
+    0xDA, 0x6C, 0x5A, 0x01, 0x4E, 0x74, 0x5F, 0xAA, 0x87, 0x2C, 0x36, 0x43, 0x9E, 0x52, 0x0D, 0xAF,
+    0xCE, 0x23, 0x7E, 0xA8, 0x76, 0x48, 0xB1, 0xE3, 0x0D, 0x29, 0xDC, 0xF8, 0x45, 0x21, 0x85, 0x0E,
+    0x38, 0x1D, 0xFB, 0xDC, 0x98, 0xCB, 0x5D, 0xE6, 0x90, 0xF4, 0x0F, 0x18, 0x8D, 0x68, 0xC0, 0x3E,
+    0xBE, 0x9B, 0xB0, 0x16, 0xEF, 0xAC, 0xA4, 0x16, 0x3F, 0x67, 0x2E, 0xDD, 0x0C, 0xFC, 0x4B, 0xDF,
+    0xCB, 0x51, 0xAA, 0x70, 0x53, 0x5B, 0xA9, 0x40, 0x81, 0x1B, 0x65, 0x8A, 0x57, 0x0D, 0x15, 0x3D,
+    0x80, 0x7E, 0x1A, 0xAE, 0x24, 0xB0, 0xFC, 0x86, 0x6F, 0xBC, 0xE6, 0x30, 0x2C, 0xD7, 0xEB, 0x84,
+    0x36, 0xEF, 0x24, 0x00, 0x65, 0x06, 0x24, 0x6B, 0x14, 0x19, 0xF6, 0xF6, 0xA5, 0xC4, 0xF0, 0xEA,
+    0xE0, 0x7A, 0x36, 0x41, 0x58, 0xB9, 0xC0, 0xC8, 0xFF, 0x1C, 0x93, 0x3A, 0xFE, 0xB7, 0x13, 0xD3,
+    0x85, 0x30, 0x45, 0xB3, 0x82, 0xA1, 0xCB, 0x1D, 0x7D, 0x88, 0x6E, 0xBD, 0xD4, 0x3F, 0x7E, 0x70,
+    0x5B, 0x1F, 0xF0, 0x4B, 0x68, 0x83, 0x09, 0x48, 0x1C, 0x6C, 0xE7, 0x4B, 0xAE, 0xB4, 0xC2, 0x24,
+    0xBD, 0x2B, 0xAD, 0x88, 0x56, 0x9C, 0xF7, 0xD7, 0xFB, 0xC2, 0x50, 0x5F, 0xE0, 0x1F, 0x87, 0x96,
+    0x75, 0x7D, 0x10, 0xE9, 0xF2, 0xD2, 0x74, 0x23, 0x5B, 0xFF, 0x36, 0x17, 0x6D, 0x21, 0x7C, 0x0D,
+    0x6D, 0x39, 0x46, 0xAB, 0x93, 0xC6, 0x8C, 0x2F, 0xA7, 0x6A, 0xED, 0x03, 0xA6, 0xE9, 0x31, 0x0A,
+    0xE8, 0x68, 0xD0, 0xFA, 0xD6, 0xC7, 0x19, 0x1B, 0x43, 0x73, 0xBA, 0x21, 0xB7, 0x07, 0x9A, 0x8E,
+    0x58, 0x9A, 0x08, 0xDD, 0x8E, 0x52, 0x18, 0xB4, 0x95, 0xB7, 0x58, 0x86, 0x9D, 0x48, 0x8C, 0x0B,
+    0xDE, 0x1F, 0x14, 0x22, 0xCB, 0x4F, 0x91, 0x85, 0xDC, 0x59, 0x98, 0xA7, 0xF0, 0x86, 0x30, 0x37,
+    0x6F, 0x43, 0x11, 0x31, 0xB2, 0xAD, 0xD0, 0x50, 0xBE, 0x44, 0x7F, 0x47, 0xEB, 0x9E, 0x21, 0xFE,
+    0xCB, 0x23, 0x2B, 0x52, 0x81, 0x38, 0xA2, 0x64, 0x43, 0x2B, 0x83, 0x89, 0x02, 0xDF, 0x8E, 0x46,
+    0xFC, 0x3E, 0x2E, 0x58, 0x61, 0xA7, 0x87, 0x5C, 0x30, 0x60, 0xFA, 0x4E, 0xFB, 0x70, 0xC4, 0x08,
+    0x1E, 0x69, 0x44, 0xFC, 0x0C, 0x61, 0x6E, 0xE1, 0x9B, 0x13, 0xF3, 0x98, 0x5F, 0x30, 0xAC, 0xCE,
+    0x70, 0x1B, 0x1D, 0x47, 0x22, 0xAA, 0x3C, 0x96, 0x21, 0xB2, 0x79, 0x85, 0x00, 0x8F, 0x9D, 0x35,
+    0x98, 0xA3, 0x25, 0xD5, 0x48, 0x2D, 0x43, 0xAA, 0x73, 0x47, 0x2E, 0x49, 0x9D, 0x5D, 0x09, 0xC2,
+    0x81, 0x99, 0x54, 0x99, 0x90, 0x34, 0xF7, 0x88, 0xA3, 0xBB, 0x21, 0xCE, 0xDB, 0x3C, 0x06, 0x69,
+    0x2D, 0x10, 0x1E, 0x02, 0xC6, 0x31, 0xB4, 0xE5, 0x03, 0x99, 0xB4, 0x11, 0xC5, 0xD3, 0x83, 0xFE,
+    0xAD, 0x7A, 0x55, 0x65, 0x39, 0x96, 0x4A, 0xE8, 0x6F, 0xA1, 0x41, 0xD6, 0x95, 0xF1, 0xF2, 0x48,
+    0x16, 0x01, 0x43, 0x1A, 0xAF, 0xA5, 0xCF, 0xB7, 0x3B, 0xC3, 0x85, 0x43, 0xB8, 0x11, 0x7B, 0x49,
+    0xD0, 0x7F, 0x87, 0x6F, 0x45, 0xE7, 0x4E, 0x99, 0xF9, 0xAA, 0x8E, 0xEA, 0x4C, 0xCF, 0xAF, 0x9D,
+    0x83, 0xDA, 0xAF, 0xB9, 0x79, 0x51, 0xF1, 0xED, 0x96, 0xB4, 0x9F, 0x34, 0xE0, 0xBA, 0x0B, 0x04,
+    0x6E, 0x54, 0xC7, 0x06, 0xF7, 0x31, 0x74, 0xFC, 0x31, 0x92, 0x72, 0xF0, 0x27, 0xC9, 0xC7, 0x05,
+    0xA6, 0x97, 0xA3, 0xF9, 0x98, 0xA3, 0x22, 0xBF, 0x22, 0x7B, 0xBF, 0x87, 0x40, 0x7A, 0x8E, 0xF1,
+    0x1C, 0xC5, 0x4C, 0x19, 0xC2, 0x94, 0x07, 0x6C, 0x90, 0x33, 0x68, 0x46, 0x74, 0x9E, 0x21, 0x72,
+    0xB9, 0x05, 0x37, 0xE7, 0xF2, 0x18, 0xDB, 0x86, 0x27, 0x8C, 0xD9, 0x4F, 0xFA, 0x20, 0x9A, 0xC5,
+    0x38, 0xD1, 0x34, 0xA5, 0x00, 0x5B, 0x83, 0x93, 0x22, 0xDC, 0xF2, 0xD7, 0x71, 0xA5, 0xF5, 0xBB,
+    0x74, 0x41, 0xBD, 0x58, 0xA1, 0x18, 0xED, 0x9E, 0xD7, 0x51, 0x0D, 0x93, 0xB5, 0xEE, 0x09, 0x5C,
+    0x79, 0x63, 0x66, 0xAE, 0xCC, 0xB1, 0x16, 0x4B, 0x0E, 0xAE, 0x7E, 0x8F, 0x55, 0xF4, 0xBF, 0x01,
+    0xBB, 0xAF, 0xD2, 0xB7, 0x1B, 0x9D, 0x8D, 0x5B, 0x2F, 0x20, 0xDA, 0x4B, 0x88, 0xC8, 0x59, 0x87,
+    0x1F, 0xF8, 0x84, 0xDD, 0xD5, 0xC9, 0x93, 0x2A, 0xF3, 0x49, 0x12, 0x0A, 0x90, 0x73, 0x66, 0x05,
+    0x39, 0xAD, 0x8A, 0x2E, 0x91, 0x70, 0xB4, 0x44, 0xBC, 0xBC, 0xD7, 0x97, 0x69, 0xFC, 0x35, 0x59,
+    0x9F, 0xF0, 0x26, 0xAA, 0x8B, 0x8B, 0xCB, 0x31, 0xCC, 0x8A, 0x33, 0xB2, 0x79, 0x88, 0x2E, 0x44,
+    0x91, 0x00, 0x9E, 0x4F, 0x1D, 0xF0, 0xE7, 0xD3, 0x10, 0xFA, 0xAE, 0xF9, 0x18, 0x98, 0xFB, 0x0C,
+    0xBD, 0x73, 0x4D, 0x21, 0x29, 0x30, 0x5D, 0x7D, 0xA3, 0xBE, 0xF7, 0x8B, 0x36, 0x62, 0xC6, 0x62,
+    0x16, 0xC6, 0x11, 0x76, 0xE1, 0x44, 0x0F, 0xC3, 0x04, 0x06, 0x33, 0x53, 0xC0, 0xE5, 0x54, 0x20,
+    0x68, 0xE6, 0x64, 0x8C, 0x43, 0x06, 0x67, 0x32, 0xA0, 0x93, 0xB1, 0x80, 0xF9, 0x28, 0x9F, 0xF3,
+    0x51, 0x54, 0x0F, 0xD8, 0xC7, 0x8D, 0x9D, 0xAC, 0xD9, 0xC9, 0x58, 0xAA, 0x32, 0x95, 0xB5, 0x95,
+    0x35, 0x56, 0x65, 0xAD, 0xCA, 0x5C, 0xB2, 0x24, 0x1A, 0x76, 0xAA, 0x22, 0xC9, 0x9E, 0x14, 0xA5,
+    0xA5, 0xD4, 0x4E, 0xA7, 0x64, 0x89, 0x0A, 0xBF, 0x81, 0x6D, 0xD1, 0x86, 0x2D, 0x6E, 0xC0, 0x16,
+    0x27, 0x0C, 0xAA, 0xCE, 0x05, 0xDE, 0x4B, 0xB2, 0x85, 0xD9, 0xAF, 0x62, 0xF4, 0xAC, 0x96, 0x3E,
+    0x6D, 0x02, 0xAA, 0xD1, 0x6E, 0x96, 0x68, 0x17, 0x16, 0xED, 0x9F, 0x4B, 0xD8, 0x1C, 0xA9, 0x34,
+    0x55, 0x2C, 0x90, 0xDE, 0x9D, 0x26, 0xDA, 0x96, 0x62, 0x5B, 0x8E, 0x5D, 0x91, 0x6C, 0xC3, 0xB2,
+    0x2D, 0xCD, 0xB6, 0x3C, 0xDB, 0x12, 0x6D, 0x30, 0xED, 0xC5, 0x75, 0xF1, 0x17, 0x22, 0xE1, 0x0C,
+    0x7F, 0x3C, 0x25, 0xF8, 0x6D, 0xF4, 0xF1, 0x87, 0xE2, 0xD1, 0x61, 0xF6, 0x47, 0x84, 0xC6, 0xAB,
+    0x3E, 0xB2, 0x2C, 0x5D, 0x51, 0xA7, 0x0B, 0xEF, 0xE5, 0x58, 0xC1, 0x51, 0x3A, 0xBD, 0x4E, 0xEE,
+    0xD3, 0x8B, 0x92, 0xBC, 0x5B, 0xCC, 0xE1, 0x14, 0x5D, 0x8B, 0xA7, 0xE9, 0xE0, 0x0B, 0x1D, 0x92,
+    0xC7, 0x72, 0xA8, 0x4D, 0x9F, 0xD5, 0xC7, 0xE4, 0x54, 0x7D, 0xCA, 0xA0, 0x7E, 0x6A, 0xBE, 0x4C,
+    0x74, 0xE9, 0xEA, 0xC1, 0x8E, 0x2E, 0x9C, 0xAC, 0xE7, 0x0C, 0xA0, 0x27, 0xEA, 0x29, 0x41, 0x2C,
+    0x92, 0x2E, 0x57, 0x92, 0x91, 0x03, 0x99, 0xF6, 0x65, 0xB2, 0x7C, 0x10, 0x75, 0x48, 0x66, 0x0B,
+    0xC7, 0x28, 0xF1, 0x6A, 0xA9, 0x46, 0xAB, 0xFF, 0xDC, 0x84, 0x5B, 0x36, 0xB2, 0xD9, 0x6E, 0x13,
+    0xF5, 0x14, 0x53, 0xC1, 0x56, 0x8F, 0xB2, 0x02, 0x59, 0x9E, 0xED, 0xC5, 0x11, 0xD0, 0x7F, 0x09,
+    0xD9, 0xB7, 0x12, 0x16, 0xEF, 0x53, 0x58, 0x80, 0x96, 0xFD, 0x10, 0x66, 0xD7, 0x1F, 0x00, 0x10,
+    0xFD, 0x23, 0xA8, 0xB5, 0x31, 0x62, 0x3B, 0xB3, 0xF3, 0x24, 0x89, 0x1B, 0x19, 0x8D, 0xFC, 0xBA,
+    0x2A, 0x71, 0x38, 0x92, 0xA8, 0xF0, 0x65, 0x93, 0x02, 0x8D, 0x4C, 0x1A, 0x3E, 0x62, 0x8A, 0x07,
+    0xAA, 0x4E, 0x8C, 0xF3, 0x6A, 0x85, 0x2F, 0x88, 0x9A, 0xB2, 0x68, 0xE0, 0xFE, 0x41, 0xD8, 0x85,
+    0x70, 0x0C, 0xBB, 0x27, 0xC4, 0xCC, 0x26, 0xAE, 0xD5, 0x7B, 0x29, 0x41, 0xD3, 0x67, 0x6A, 0x9D,
+    0xD7, 0x53, 0xAA, 0x57, 0x8D, 0xEC, 0x82, 0x6A, 0x55, 0xDF, 0x73, 0x3B, 0x34, 0xBE, 0xC3, 0x7B,
+    0x25, 0xB6, 0xE9, 0x52, 0xB0, 0x0F, 0x0A, 0x01, 0xDF, 0xEB, 0x08, 0xFA, 0x6E, 0x2E, 0x50, 0x79,
+    0xC6, 0x0A, 0xBF, 0x30, 0xC0, 0x3D, 0xA9, 0xF0, 0xBB, 0xD4, 0x0F, 0x6B, 0x0D, 0x6B, 0x0E, 0x6B,
+    0x0F, 0x6B, 0x10, 0x6B, 0x91, 0xCA, 0x24, 0xF5, 0xC8, 0x78, 0xD0, 0x50, 0x2E, 0xAF, 0xAC, 0x4B,
+    0x29, 0xD6, 0x10, 0xD7, 0x6D, 0xD1, 0x54, 0xF6, 0x85, 0xB3, 0x14, 0x43, 0xF4, 0xC5, 0x10, 0x27,
+    0x30, 0xC4, 0x9F, 0x4B, 0x00, 0xAB, 0x53, 0xC8, 0xEE, 0xAB, 0x31, 0x84, 0x7A, 0x30, 0xCA, 0xC0,
+    0x6B, 0x36, 0x98, 0x8E, 0x1A, 0xA2, 0x59, 0xEC, 0x5A, 0x58, 0x43, 0x98, 0xED, 0xEF, 0x26, 0xBE,
+    0x1B, 0x3B, 0x54, 0xFB, 0xB6, 0x45, 0x7E, 0x7E, 0xF6, 0x86, 0xB0, 0xB1, 0xC8, 0x06, 0xA3, 0x2A,
+    0x1A, 0x55, 0xBC, 0x3C, 0x19, 0x9D, 0x20, 0x99, 0x88, 0x84, 0x90, 0xB4, 0xB8, 0x03, 0xE3, 0x7F,
+    0x89, 0x56, 0xB0, 0xCD, 0xD2, 0x4C, 0x6D, 0x63, 0xF6, 0xCB, 0x30, 0xDF, 0x7A, 0x17, 0x2A, 0x3C,
+    0xFD, 0x48, 0xB6, 0xCA, 0x38, 0xA2, 0xFD, 0x32, 0xB3, 0xAE, 0x45, 0x1F, 0x1D, 0x46, 0x86, 0x3D,
+    0x94, 0x3F, 0x6E, 0xEA, 0x6D, 0x4C, 0x95, 0x5A, 0x08, 0x08, 0x1B, 0xCE, 0x93, 0xD9, 0x8F, 0x8B,
+    0xC5, 0x8E, 0xFF, 0xA3, 0xDC, 0xC8, 0xD2, 0xA2, 0xEA, 0xC3, 0xEB, 0x8C, 0xD3, 0xCC, 0xB9, 0x80,
+    0xFA, 0xBF, 0x51, 0x26, 0x53, 0x44, 0xB0, 0x35, 0x84, 0xC1, 0x48, 0xCE, 0x30, 0x81, 0xCA, 0x19,
+    0xFF, 0x6B, 0x32, 0x6E, 0xA4, 0x0C, 0x74, 0xD1, 0xD2, 0x87, 0xAB, 0xBA, 0x70, 0x07, 0x88, 0x63,
+    0x6A, 0x20, 0x41, 0x37, 0x13, 0x5A, 0xCD, 0xD9, 0x1F, 0x4B, 0xB8, 0x39, 0x22, 0x5A, 0x50, 0x60,
+    0x5B, 0x83, 0x57, 0xE2, 0x8F, 0x0C, 0xDC, 0x9E, 0x94, 0x3A, 0xFB, 0x32, 0x5B, 0x3E, 0x97, 0x3A,
+    0x74, 0x34, 0x12, 0x18, 0x4C, 0x0E, 0x7D, 0x11, 0x29, 0x45, 0x97, 0xE5, 0xEC, 0x02, 0x25, 0x56,
+    0x0D, 0x96, 0x2D, 0x2B, 0x33, 0xAD, 0x7A, 0xE7, 0x85, 0xE1, 0xD6, 0xA7, 0x0D, 0x2B, 0xAA, 0x57,
+    0xBE, 0x49, 0xF7, 0x92, 0x21, 0x65, 0xDD, 0x00, 0xDB, 0x60, 0x38, 0x65, 0x04, 0x31, 0x33, 0x72,
+    0xE1, 0x65, 0x6F, 0x02, 0xC7, 0x36, 0x38, 0xCB, 0x0D, 0x74, 0x7E, 0x17, 0xDD, 0xE8, 0x22, 0xB9,
+    0x60, 0x75, 0xF8, 0x31, 0xE3, 0xEB, 0x7F, 0x80, 0x4D, 0xA2, 0xFF, 0xC2, 0x7E, 0xD1, 0x4F, 0x80,
+    0x8A, 0x36, 0x53, 0x87, 0xAA, 0xF2, 0x73, 0xA7, 0x62, 0x3A, 0xAA, 0xDE, 0xCA, 0x27, 0x45, 0x0A,
+    0xCC, 0x70, 0xD6, 0x71, 0x5B, 0xAB, 0x98, 0x47, 0xE4, 0xC6, 0x8E, 0x91, 0x7B, 0xAC, 0x0C, 0xF2,
+    0x29, 0x63, 0xC7, 0xD3, 0x4C, 0xB7, 0x8C, 0xB0, 0x2A, 0xCE, 0x22, 0x4A, 0xC3, 0xB8, 0xC1, 0x6E,
+    0x62, 0x7D, 0xB3, 0x2D, 0x97, 0xDA, 0x93, 0x7F, 0x47, 0xE8, 0x4F, 0xAC, 0x6F, 0xCE, 0x1F, 0xE2,
+    0x57, 0x64, 0xDE, 0xCA, 0xDF, 0xFC, 0xF7, 0xF8, 0xB7, 0x25, 0x29, 0x8C, 0x4A, 0xD4, 0x90, 0x92,
+    0xFA, 0x6E, 0xBD, 0xFF, 0x70, 0x6D, 0x6E, 0xBC, 0xD6, 0xAE, 0x23, 0xB9, 0x3A, 0xC6, 0x1B, 0xF5,
+    0x5F, 0x59, 0xD9, 0xD7, 0x3C, 0xEC, 0xA0, 0x5C, 0x1A, 0xDD, 0x88, 0x37, 0x97, 0x68, 0x4B, 0x61,
+    0xA0, 0xD5, 0x65, 0x7F, 0xD8, 0xD7, 0xDF, 0x22, 0x7A, 0x88, 0x8D, 0x25, 0x1B, 0x13, 0x9B, 0x1A,
+    0x67, 0x0D, 0xEF, 0xBF, 0x01, 0xA5, 0x58, 0xBD, 0x6F, 0xDC, 0xC8, 0x15, 0x7F, 0x24, 0x57, 0xC7,
+    0x4B, 0x18, 0x68, 0x54, 0xC8, 0x08, 0x70, 0xB1, 0xC4, 0x14, 0x2E, 0x02, 0x43, 0x12, 0xAF, 0x70,
+    0xE1, 0x62, 0x57, 0xC3, 0xB3, 0x8B, 0x2B, 0x5C, 0x44, 0x85, 0x85, 0x03, 0x62, 0x04, 0x97, 0x22,
+    0xD5, 0x35, 0x0E, 0x02, 0x17, 0x2E, 0x24, 0x73, 0xCE, 0xAE, 0x83, 0xE8, 0x3F, 0x88, 0x8A, 0x04,
+    0x38, 0xAB, 0xB8, 0x53, 0xE1, 0x42, 0x08, 0x6C, 0x73, 0x6C, 0x17, 0x29, 0x52, 0x64, 0x2E, 0x87,
+    0x20, 0x65, 0x18, 0xD8, 0xD7, 0xB8, 0x22, 0x10, 0x22, 0xD9, 0x73, 0xB8, 0xCB, 0xFC, 0xDE, 0x0C,
+    0xB9, 0xBB, 0x92, 0x2C, 0xC7, 0xB2, 0x48, 0xBE, 0xB7, 0x43, 0xCE, 0x7B, 0x6F, 0xDE, 0xBC, 0x79,
+    0x1F, 0x33, 0xBB, 0xBB, 0x7B, 0xC2, 0xB5, 0xF1, 0x8B, 0xEF, 0x5D, 0x5E, 0x99, 0xDF, 0x0F, 0xB4,
+    0x28, 0x92, 0xE1, 0xAF, 0x7F, 0xE3, 0xAB, 0xB7, 0xBB, 0xBD, 0x94, 0x34, 0x51, 0x49, 0xD4, 0xA7,
+    0xBC, 0xA1, 0xFD, 0x3E, 0xED, 0xEE, 0xD3, 0xAE, 0xA6, 0x5D, 0x7A, 0xF7, 0x67, 0x83, 0x08, 0x32,
+    0x03, 0x45, 0x82, 0x48, 0x36, 0x6A, 0x3E, 0x50, 0xC1, 0x5D, 0x45, 0x4F, 0x15, 0xF9, 0x67, 0x78,
+    0xBC, 0xF4, 0xDC, 0x66, 0x2A, 0x9B, 0x02, 0x0F, 0xC4, 0xCF, 0xB6, 0xED, 0x95, 0x37, 0x4D, 0x93,
+    0x32, 0xC2, 0x88, 0xEE, 0xAA, 0xBA, 0xC6, 0xB0, 0xA3, 0xA1, 0xC5, 0xB9, 0xBE, 0x38, 0xEB, 0xCD,
+    0x72, 0x20, 0xB9, 0x96, 0xAD, 0xE0, 0x73, 0x9B, 0x9B, 0x1B, 0xFC, 0x7E, 0x71, 0x6F, 0xEF, 0x0B,
+    0xBA, 0xE0, 0x97, 0x51, 0xBA, 0x04, 0x53, 0xAE, 0x93, 0xD4, 0xB2, 0x48, 0xCC, 0x7B, 0x69, 0x8F,
+    0xA4, 0x92, 0x46, 0x1A, 0x61, 0x02, 0x1D, 0xE8, 0x88, 0xB6, 0x89, 0x75, 0x8E, 0x54, 0x62, 0x64,
+    0x21, 0xF5, 0x3A, 0xAD, 0xD0, 0x3C, 0x85, 0xCA, 0xAB, 0x68, 0xA1, 0x47, 0x0B, 0xA0, 0x1D, 0x91,
+    0xFC, 0x2B, 0x26, 0xF1, 0x75, 0x43, 0xC2, 0x64, 0x14, 0xE8, 0x18, 0xB0, 0x44, 0x11, 0x64, 0x6E,
+    0xFB, 0x25, 0x15, 0x61, 0x6A, 0x67, 0x12, 0xA9, 0x55, 0x4A, 0x0C, 0xE8, 0xFE, 0x09, 0x78, 0x32,
+    0xA6, 0x75, 0x08, 0x58, 0xC1, 0x2A, 0xCE, 0xD3, 0x03, 0x48, 0x1B, 0x90, 0x57, 0x45, 0x1A, 0xE2,
+    0x52, 0x3A, 0xC7, 0xEA, 0xCE, 0xC0, 0x5A, 0x0B, 0x4B, 0x0E, 0xC6, 0x5F, 0xE6, 0x1A, 0x26, 0xD2,
+    0x1B, 0x4B, 0xF0, 0x83, 0x8E, 0x26, 0x4B, 0x1D, 0xCC, 0xF2, 0xAD, 0xCF, 0xF0, 0xAE, 0x4E, 0xF9,
+    0x27, 0x70, 0x7E, 0x06, 0xDE, 0x67, 0xB3, 0xBC, 0x7E, 0xCC, 0xFB, 0x3F, 0xFF, 0x99, 0xE2, 0xF1,
+    0xEE, 0x2F, 0x7D, 0xA0, 0xEC, 0xB7, 0x6E, 0x3C, 0xD9, 0xCA, 0xF9, 0x41, 0x0B, 0xE7, 0x5B, 0x9E,
+    0x19, 0x1D, 0x36, 0x56, 0xBD, 0x94, 0x79, 0x1B, 0xE8, 0x6C, 0x69, 0x57, 0x8F, 0xD0, 0x5C, 0x24,
+    0xF2, 0xBE, 0xA0, 0xB8, 0x81, 0x6B, 0x68, 0xD9, 0x98, 0xAC, 0x7B, 0xF0, 0x8A, 0x8F, 0xE1, 0x88,
+    0x0D, 0x07, 0xF7, 0x7C, 0x0C, 0x6F, 0x29, 0x28, 0x1F, 0xC3, 0x67, 0x8A, 0xBC, 0xA9, 0x72, 0xF8,
+    0x4D, 0x45, 0x79, 0x0A, 0xCB, 0xB9, 0xEB, 0x0E, 0x35, 0xB8, 0x73, 0x5A, 0x6C, 0xDF, 0x04, 0xEC,
+    0x1C, 0x17, 0x80, 0x32, 0x47, 0x7B, 0x11, 0x9E, 0xD8, 0x43, 0x2F, 0xD3, 0x64, 0x9D, 0xEF, 0xD1,
+    0x3E, 0x9D, 0x29, 0x62, 0xA6, 0x71, 0x63, 0x23, 0x86, 0x63, 0xC7, 0x3F, 0xF3, 0x63, 0xAD, 0x35,
+    0x73, 0xBD, 0x7D, 0x46, 0x68, 0x9A, 0x6F, 0x37, 0x0D, 0xF1, 0x5D, 0xD0, 0xE9, 0xF8, 0x36, 0x6F,
+    0x50, 0x68, 0xEF, 0xE8, 0x34, 0x7C, 0x34, 0xBD, 0x7C, 0xCC, 0x3E, 0x54, 0xB6, 0x29, 0xFE, 0x5E,
+    0x92, 0x70, 0x7D, 0x09, 0xDC, 0x3B, 0x76, 0x04, 0x92, 0x6A, 0x1A, 0xB8, 0xE6, 0x3A, 0x9A, 0x5B,
+    0xDD, 0x9A, 0x3D, 0xA2, 0x6A, 0xD2, 0xF4, 0xCA, 0x49, 0x33, 0x30, 0x93, 0x66, 0xA8, 0xBB, 0xE6,
+    0x43, 0x91, 0x6E, 0xC2, 0x45, 0xD9, 0xE3, 0xEB, 0x38, 0x6C, 0x34, 0x35, 0x15, 0x9A, 0xC3, 0x81,
+    0xB8, 0x5B, 0x06, 0xC5, 0x43, 0x8A, 0xAF, 0x94, 0x5B, 0x78, 0x8D, 0x10, 0x9D, 0x61, 0x63, 0x2A,
+    0x0C, 0x23, 0x34, 0xFC, 0xEB, 0xBE, 0x57, 0xDE, 0x41, 0x53, 0x25, 0xD0, 0x29, 0x30, 0xDB, 0xF4,
+    0x28, 0xB6, 0xCD, 0x50, 0x3F, 0xB2, 0x4D, 0x28, 0x2D, 0xD2, 0x49, 0x33, 0xA6, 0x09, 0xC1, 0x80,
+    0x98, 0x4D, 0x73, 0x73, 0x8B, 0x47, 0xB4, 0xC2, 0xA0, 0x6D, 0xC2, 0x41, 0x8A, 0xB8, 0x82, 0xB6,
+    0xE2, 0x5E, 0x19, 0x94, 0x0F, 0x59, 0x2C, 0x05, 0x30, 0x40, 0xD3, 0xEA, 0x0F, 0x0F, 0x9C, 0xA3,
+    0x23, 0xD7, 0x8C, 0x81, 0x0E, 0xDB, 0xE8, 0xB0, 0x99, 0x0E, 0x5B, 0xEA, 0xB0, 0xB1, 0x0E, 0xDB,
+    0xEB, 0xB0, 0xC9, 0x0E, 0x5B, 0xED, 0xB0, 0xE1, 0x0E, 0xDB, 0xCE, 0xDB, 0x60, 0x99, 0x13, 0xF3,
+    0x8D, 0x66, 0x2D, 0x58, 0xC7, 0xE9, 0xD4, 0x88, 0x5E, 0x25, 0xF4, 0xD4, 0x8E, 0x41, 0x89, 0xCC,
+    0x34, 0x31, 0xE5, 0xD5, 0x32, 0x34, 0x53, 0x6B, 0xE2, 0xAD, 0x98, 0x1A, 0xF4, 0x9E, 0x7D, 0xEB,
+    0x6C, 0xEA, 0xDE, 0x3A, 0xB3, 0x3A, 0x4A, 0x67, 0xD9, 0x4E, 0x4A, 0x67, 0x5C, 0x9F, 0x47, 0x98,
+    0xD8, 0x97, 0x47, 0x9F, 0x31, 0x71, 0x9D, 0xCC, 0x5A, 0x39, 0xA9, 0x67, 0x0D, 0x0D, 0x47, 0x14,
+    0x46, 0x68, 0x88, 0x47, 0x5A, 0x19, 0x20, 0xE3, 0x5E, 0x62, 0x0B, 0x9B, 0xC7, 0x42, 0x8F, 0x62,
+    0x55, 0x43, 0xDC, 0x9A, 0x57, 0x0E, 0xFC, 0xA2, 0x1F, 0xE8, 0x4B, 0x81, 0x72, 0x5D, 0x61, 0x81,
+    0xCE, 0xA8, 0x40, 0x37, 0x16, 0x18, 0x43, 0x29, 0x90, 0x88, 0x14, 0x44, 0x31, 0x81, 0x6C, 0x95,
+    0x40, 0xB8, 0xD2, 0xAD, 0x86, 0x4C, 0x63, 0x05, 0x4B, 0xA0, 0x0A, 0xF8, 0x1C, 0x58, 0x24, 0xFD,
+    0x4A, 0x5E, 0x19, 0x5A, 0xD6, 0x87, 0xA1, 0x06, 0xF9, 0xC0, 0x37, 0xCB, 0x54, 0x70, 0x85, 0x41,
+    0x57, 0xAC, 0xD0, 0xC9, 0xCA, 0xA0, 0x9B, 0x09, 0x0C, 0x93, 0x18, 0x26, 0x2A, 0x98, 0xAC, 0x64,
+    0xC2, 0x7D, 0x27, 0x7A, 0x81, 0xE8, 0x36, 0x61, 0x79, 0xBD, 0x31, 0xF9, 0xFF, 0xA0, 0xE0, 0x4F,
+    0x2A, 0xBA, 0xAA, 0x85, 0x5F, 0xAC, 0x52, 0xD9, 0x47, 0x52, 0x5B, 0xA4, 0x5B, 0x5E, 0x19, 0x60,
+    0x5E, 0x32, 0xCD, 0x91, 0xB7, 0x64, 0x2A, 0x74, 0x60, 0x60, 0x90, 0x5B, 0xB4, 0xB8, 0x00, 0xBE,
+    0x01, 0xC5, 0x29, 0x6A, 0x53, 0xE9, 0xD7, 0x7E, 0x1D, 0x94, 0xC2, 0xC4, 0xE9, 0x00, 0x5F, 0x21,
+    0xD2, 0x7A, 0xD9, 0x05, 0x4C, 0x92, 0x3E, 0xDC, 0x26, 0x51, 0xD0, 0x30, 0x66, 0xCE, 0x82, 0x2D,
+    0x2D, 0xB8, 0x5E, 0x71, 0x49, 0xD8, 0x26, 0x42, 0x11, 0x8C, 0xD3, 0x80, 0x97, 0xCD, 0x08, 0x30,
+    0x78, 0x95, 0xFD, 0x7C, 0x67, 0x48, 0x07, 0x9C, 0x35, 0xBD, 0x9A, 0xEB, 0x98, 0x5F, 0x3F, 0xA2,
+    0xF5, 0x0A, 0x1A, 0xD2, 0x10, 0x1C, 0x14, 0x14, 0x71, 0xCA, 0x42, 0x58, 0xD4, 0x1D, 0x70, 0x90,
+    0x37, 0x64, 0x1E, 0xBB, 0xBE, 0xB0, 0x51, 0xA4, 0x43, 0xB3, 0x0E, 0x2E, 0xAF, 0xBA, 0xCC, 0xA3,
+    0xFF, 0x0A, 0xD5, 0x4E, 0x73, 0x91, 0xC8, 0x01, 0x8D, 0xFD, 0xE5, 0x99, 0x48, 0x9E, 0x0B, 0x72,
+    0xB9, 0x84, 0x88, 0x29, 0x6C, 0x03, 0x06, 0x94, 0x00, 0xD6, 0x2C, 0xF4, 0x2D, 0x2C, 0x03, 0xB8,
+    0x2A, 0xF7, 0x70, 0xF3, 0xC5, 0xD8, 0x5A, 0x43, 0x35, 0x16, 0x58, 0xCE, 0x34, 0xBE, 0xBE, 0xA3,
+    0xF8, 0x55, 0xAE, 0xA5, 0x0A, 0x91, 0xEF, 0xFD, 0xE1, 0xF6, 0xDC, 0x47, 0xF5, 0x2A, 0x16, 0x99,
+    0x2C, 0x3C, 0xA9, 0x49, 0x3C, 0x05, 0x3C, 0xAB, 0x48, 0xFC, 0xB6, 0x20, 0xD1, 0xC0, 0x65, 0x86,
+    0x5C, 0x8E, 0x01, 0xE9, 0x14, 0xBC, 0x56, 0x18, 0xFF, 0xC6, 0x50, 0x3E, 0x31, 0x0E, 0x84, 0x8B,
+    0x24, 0xEC, 0x19, 0x36, 0xED, 0x3E, 0x25, 0xC5, 0xAE, 0x61, 0xAF, 0x0B, 0xDF, 0x4B, 0x96, 0x43,
+    0x2F, 0xDB, 0xFA, 0x9E, 0x46, 0x1C, 0x82, 0xDB, 0x58, 0xD3, 0x0D, 0xBA, 0x01, 0x63, 0x27, 0xA0,
+    0x66, 0x9F, 0xBB, 0xD9, 0xEC, 0x38, 0x09, 0xCC, 0x85, 0x24, 0x3B, 0xE6, 0xFA, 0xF3, 0x72, 0x0F,
+    0x05, 0x2D, 0x00, 0x95, 0x57, 0xBB, 0x6C, 0x00, 0xEF, 0x63, 0xAA, 0x40, 0xFF, 0xD8, 0x4A, 0x66,
+    0x46, 0xC4, 0xB7, 0x5F, 0xF0, 0x27, 0xA7, 0xAD, 0x68, 0x6B, 0x27, 0xD3, 0x1D, 0xBC, 0xA6, 0x9B,
+    0x95, 0xC6, 0x7B, 0x1F, 0xDF, 0x0F, 0xD0, 0x0F, 0x4F, 0xF2, 0x8B, 0x35, 0x74, 0x0B, 0x74, 0x47,
+    0x4A, 0xA0, 0xB5, 0x86, 0x2F, 0xE0, 0x2E, 0x0F, 0x9C, 0x80, 0x2E, 0x8B, 0x47, 0x6D, 0xB2, 0x68,
+    0x93, 0xC6, 0x52, 0xA8, 0x76, 0xAD, 0xFB, 0xDF, 0xFB, 0xD8, 0x66, 0x98, 0xE4, 0x3F, 0xB9, 0xDB,
+    0xB3, 0x65, 0xDF, 0x39, 0xBA, 0x9B, 0x6E, 0x7B, 0x96, 0xFC, 0xD7, 0x7D, 0x97, 0xF7, 0xAE, 0x95,
+    0xB3, 0x7C, 0x9D, 0x9C, 0x56, 0xEE, 0x7B, 0x6A, 0x2E, 0xFD, 0xBE, 0x72, 0x6F, 0x80, 0x5E, 0xA8,
+    0x17, 0x7A, 0xF0, 0xD3, 0xB5, 0xE0, 0xF3, 0x72, 0x2D, 0xFC, 0xBC, 0x94, 0xDF, 0xFC, 0xB4, 0x92,
+    0xDF, 0x7C, 0x5A, 0x85, 0x4D, 0xB3, 0xC3, 0x00, 0x0F, 0x24, 0x06, 0xAF, 0x19, 0xA7, 0x3E, 0x40,
+    0x3E, 0xFF, 0xB4, 0x92, 0xCF, 0x6F, 0x56, 0xC9, 0xD5, 0xBB, 0x65, 0xF2, 0xF1, 0x95, 0xF2, 0xFD,
+    0x50, 0x6D, 0x30, 0x74, 0xF2, 0x3A, 0xB8, 0xB8, 0xB7, 0x93, 0xCD, 0x6C, 0x20, 0xF0, 0x60, 0xEC,
+    0xC2, 0x66, 0x0E, 0xAB, 0x10, 0x1B, 0x99, 0x13, 0x2D, 0xA7, 0xD7, 0x2D, 0x9B, 0xCC, 0x39, 0xC5,
+    0x9C, 0xA1, 0x1B, 0x0B, 0x9A, 0x37, 0x79, 0xFA, 0x98, 0x5E, 0x7F, 0xE7, 0xA3, 0x13, 0x7B, 0x54,
+    0xDE, 0x9C, 0xBB, 0xBE, 0x79, 0xBD, 0x19, 0x23, 0xFA, 0x4F, 0x20, 0xCA, 0x4E, 0xEC, 0xF1, 0xC7,
+    0xCD, 0xF8, 0xDC, 0xF5, 0xCE, 0xF5, 0x43, 0x6C, 0xA7, 0x19, 0xE4, 0xCB, 0xB1, 0x85, 0x9C, 0x12,
+    0x04, 0x49, 0xA2, 0x5A, 0xDF, 0xD7, 0x0F, 0x11, 0x8E, 0x0C, 0x3F, 0xA1, 0xA8, 0x60, 0xE0, 0x0C,
+    0x48, 0x9C, 0x1A, 0xDC, 0xAF, 0x71, 0xBE, 0xCE, 0x20, 0x95, 0x03, 0xF6, 0xCE, 0x06, 0x82, 0x87,
+    0x0E, 0xA4, 0x71, 0x30, 0x68, 0x27, 0xDF, 0x7F, 0x0D, 0xAC, 0xB4, 0xF1, 0xD9, 0x3B, 0x52, 0xF7,
+    0xF8, 0x3D, 0x6F, 0xA1, 0x39, 0x02, 0x8F, 0xDB, 0xEF, 0x87, 0x2E, 0x9E, 0x49, 0xA2, 0xED, 0x5C,
+    0x34, 0xCF, 0x24, 0xB1, 0x73, 0x48, 0xEC, 0x2C, 0x12, 0xC5, 0xFA, 0xDB, 0x92, 0x6D, 0xE2, 0x09,
+    0x8E, 0x35, 0xE7, 0x25, 0xA9, 0x18, 0x8F, 0x91, 0x8A, 0x58, 0x67, 0xAC, 0x15, 0x34, 0x06, 0x1E,
+    0xD8, 0x98, 0xE9, 0x1F, 0xC3, 0xBD, 0x63, 0x35, 0x1A, 0x9A, 0x24, 0x9A, 0xF5, 0x92, 0x1D, 0x86,
+    0x7E, 0x89, 0x9A, 0x25, 0xC9, 0xD2, 0x08, 0x2E, 0x95, 0xA5, 0xD9, 0xCB, 0x1A, 0x98, 0x4B, 0xA7,
+    0xFC, 0xA8, 0x06, 0x8D, 0x84, 0x2F, 0xC4, 0xD8, 0x1E, 0xFC, 0x92, 0xDC, 0x26, 0x21, 0xB6, 0x38,
+    0xB1, 0x18, 0xC7, 0x08, 0x2B, 0x1C, 0xD8, 0x1B, 0x21, 0xC5, 0x51, 0x54, 0x71, 0x04, 0x67, 0x76,
+    0x1F, 0xBD, 0x65, 0xA3, 0x19, 0x55, 0x60, 0xD9, 0xE2, 0x25, 0x8B, 0x7B, 0xB6, 0x34, 0x4C, 0xCC,
+    0xB7, 0xC0, 0x49, 0x8F, 0xB0, 0x0B, 0xCE, 0x15, 0x7C, 0xA5, 0xC5, 0x90, 0x36, 0xEA, 0x68, 0x2E,
+    0xA0, 0x10, 0x66, 0xEE, 0x68, 0x53, 0xC7, 0x00, 0x6C, 0xE2, 0x0F, 0x5A, 0xF7, 0x2C, 0x9D, 0x07,
+    0x7B, 0x5D, 0x9A, 0x30, 0x2E, 0x55, 0x84, 0x5D, 0xBA, 0x50, 0xCE, 0xAB, 0x05, 0x39, 0xCF, 0x5E,
+    0xA3, 0xE9, 0x22, 0x6F, 0xB5, 0xE0, 0x44, 0xF1, 0x71, 0xC9, 0x1D, 0xD6, 0xC2, 0x6F, 0xF3, 0x46,
+    0xFB, 0x45, 0xD6, 0x14, 0x1E, 0x50, 0xF9, 0x46, 0x64, 0x18, 0x69, 0xA0, 0x31, 0x79, 0x05, 0x84,
+    0x9D, 0x05, 0xF9, 0x8C, 0x02, 0x46, 0x59, 0x91, 0x15, 0xF4, 0xD9, 0xCE, 0xC5, 0xDD, 0xCE, 0x61,
+    0x9A, 0xA6, 0x88, 0x9B, 0x97, 0x63, 0x3E, 0x3F, 0x1C, 0x10, 0x06, 0x7C, 0x00, 0x4D, 0x8F, 0x23,
+    0xDB, 0x01, 0x12, 0x38, 0x12, 0x38, 0x76, 0x3C, 0xA4, 0xF0, 0x9D, 0xEE, 0x0C, 0x3A, 0xA2, 0x1F,
+    0xBD, 0xC2, 0x81, 0xC2, 0x6F, 0xD5, 0x75, 0x8A, 0x5B, 0x54, 0x4C, 0x90, 0xB1, 0xBD, 0x01, 0xA3,
+    0x9B, 0x7C, 0x60, 0xFD, 0x6C, 0x6F, 0xEF, 0xF7, 0xCE, 0x89, 0x5A, 0x33, 0x5E, 0x8E, 0x3C, 0x9D,
+    0x5D, 0x8B, 0x8A, 0x9B, 0xC8, 0x89, 0x5E, 0xFE, 0x02, 0x82, 0x5F, 0x70, 0x7E, 0x34, 0xD9, 0x35,
+    0x51, 0x5C, 0x16, 0x9E, 0x71, 0xA6, 0x06, 0xED, 0x1C, 0xE7, 0xDC, 0x24, 0x95, 0x3A, 0x43, 0xB9,
+    0x3A, 0xB6, 0x53, 0xB4, 0x9E, 0x93, 0xF1, 0x0D, 0x57, 0xED, 0xF3, 0x31, 0xD3, 0x74, 0x3B, 0x06,
+    0xCE, 0xA4, 0x0D, 0x27, 0xE0, 0xEC, 0x55, 0x6E, 0x50, 0xE4, 0xC8, 0xAF, 0x89, 0x0B, 0x8E, 0xB4,
+    0xAB, 0x17, 0x29, 0x0E, 0xC4, 0xC0, 0x58, 0xE7, 0x49, 0xE9, 0xCC, 0x17, 0x4B, 0xF3, 0x4D, 0x62,
+    0x93, 0xB8, 0x2D, 0x2C, 0x5C, 0xAB, 0x50, 0xAA, 0x28, 0xFF, 0xC3, 0x57, 0x05, 0x57, 0x31, 0x4E,
+    0x13, 0x6E, 0x32, 0xEF, 0x6A, 0x85, 0x77, 0xE4, 0x8B, 0xD4, 0xAD, 0xD8, 0x94, 0x78, 0xC4, 0x13,
+    0xC3, 0x0E, 0x8D, 0x07, 0xE5, 0x1B, 0x5E, 0x3C, 0x6F, 0x4F, 0x97, 0x7D, 0x1B, 0x46, 0x0F, 0xD8,
+    0xFD, 0xBD, 0x02, 0x53, 0xE0, 0x7E, 0x54, 0x9B, 0xC8, 0x3A, 0xFA, 0x32, 0xCC, 0x14, 0x1B, 0x3C,
+    0xB7, 0x6C, 0x55, 0xF7, 0x5F, 0xD0, 0xBC, 0x68, 0x68, 0x39, 0xFE, 0x54, 0xAF, 0x0E, 0xFC, 0xAA,
+    0xDF, 0xA7, 0x7C, 0xD8, 0xB7, 0xF5, 0x67, 0x7A, 0x79, 0x79, 0xF3, 0x82, 0x8D, 0xCE, 0xA7, 0x58,
+    0xF2, 0x11, 0x77, 0x3F, 0x1C, 0xDA, 0xF0, 0x41, 0xBC, 0xAC, 0x5A, 0x0F, 0x54, 0xB7, 0x2C, 0x99,
+    0xDB, 0x7D, 0x63, 0x30, 0x3F, 0xD0, 0x2A, 0x7A, 0xF6, 0xAC, 0x08, 0x9F, 0xFF, 0xD9, 0xD0, 0xBF,
+    0x7F, 0x07, 0xD3, 0x0D, 0x29, 0xFB, 0xEA, 0xD5, 0x08, 0x12, 0x46, 0x8B, 0x71, 0xB5, 0x48, 0x7F,
+    0xFC, 0x92, 0x82, 0x7F, 0xFD, 0x45, 0x8B, 0x67, 0xCF, 0xCA, 0xE0, 0xEA, 0x13, 0x3B, 0x01, 0x3E,
+    0xFA, 0xB5, 0x17, 0x4E, 0x14, 0x1C, 0xE3, 0x1E, 0xE7, 0xC8, 0xB1, 0xDB, 0xE6, 0xB6, 0x9B, 0xD1,
+    0xD4, 0xE6, 0x25, 0xCA, 0xDA, 0x5C, 0x3D, 0xE3, 0x3B, 0xBC, 0xE8, 0x23, 0xC7, 0xC3, 0xBC, 0x2E,
+    0x3B, 0x88, 0xAF, 0x6B, 0x6C, 0xB2, 0xC5, 0xD3, 0xA1, 0x0C, 0xCB, 0xF8, 0x5E, 0x29, 0x23, 0x93,
+    0x04, 0xE5, 0x76, 0xA4, 0xD7, 0x02, 0xB3, 0x25, 0xD4, 0x20, 0xD4, 0x07, 0x82, 0xFA, 0x61, 0x5A,
+    0x2E, 0xD3, 0xA5, 0x88, 0x8A, 0xF3, 0x87, 0x97, 0xFF, 0x11, 0xB5, 0x69, 0xDA, 0xA1, 0x31, 0xCD,
+    0x6A, 0x62, 0xBD, 0x34, 0x25, 0x6C, 0x85, 0xA1, 0x7C, 0x9D, 0x31, 0x82, 0x42, 0xC1, 0x90, 0x35,
+    0xDA, 0x98, 0x51, 0xC9, 0xB1, 0x4D, 0xA5, 0x8C, 0x4E, 0x23, 0xE0, 0xFF, 0xAA, 0xC1, 0xC5, 0x25,
+    0xB5, 0x6C, 0x4E, 0x80, 0x45, 0x29, 0x5E, 0x27, 0x03, 0x9C, 0x1C, 0x63, 0xB3, 0x97, 0x6C, 0xE9,
+    0x7A, 0x6F, 0x3D, 0xF7, 0x63, 0x02, 0x10, 0x1B, 0x47, 0x66, 0xD2, 0x3B, 0x39, 0x0A, 0xDF, 0x64,
+    0x99, 0x35, 0xBA, 0xED, 0x17, 0x32, 0xBD, 0x1D, 0x54, 0x19, 0xD0, 0x50, 0xD2, 0xED, 0xA0, 0xB4,
+    0xFE, 0x7C, 0x04, 0xB1, 0x37, 0x0E, 0x33, 0xF7, 0x3F, 0xD9, 0xF1, 0x5E, 0xB0, 0xF9, 0xA5, 0x13,
+    0xC0, 0x28, 0xE1, 0xD7, 0xD7, 0xDB, 0x43, 0xBE, 0xE1, 0x5B, 0xEF, 0x88, 0x0D, 0xE7, 0xE0, 0x75,
+    0x68, 0xDB, 0x33, 0x31, 0xD7, 0x2C, 0xD7, 0xF3, 0xC1, 0x11, 0x9E, 0xA6, 0xF9, 0xE4, 0x6F, 0xEE,
+    0x2F, 0x82, 0x40, 0x9F, 0xF2, 0xEF, 0x8B, 0x1B, 0x26, 0xE4, 0xBB, 0x38, 0xD5, 0xDF, 0x10, 0xF9,
+    0x58, 0xD6, 0xC9, 0x50, 0x94, 0x51, 0x81, 0x23, 0x9A, 0x3A, 0xCD, 0xDF, 0x17, 0x5E, 0x1A, 0xE0,
+    0xD0, 0x22, 0xCA, 0xB8, 0x92, 0x75, 0x3E, 0x7E, 0x7B, 0x4E, 0x5F, 0x45, 0xC5, 0xCA, 0xE5, 0xFD,
+    0xF9, 0x7E, 0x5F, 0x94, 0x6F, 0x3F, 0x26, 0x66, 0xA8, 0x3E, 0x51, 0xEF, 0x62, 0x99, 0xFF, 0x01,
+    0xED, 0x54, 0x31, 0x8F, 0x1C, 0x35, 0x18, 0x7D, 0x1E, 0x87, 0xB3, 0x84, 0x8B, 0xA1, 0xC8, 0x55,
+    0x91, 0xCE, 0x4D, 0x8A, 0x53, 0x94, 0x64, 0x28, 0x52, 0x04, 0x69, 0x33, 0xE3, 0xE4, 0x94, 0x86,
+    0x02, 0x5D, 0xB1, 0x2B, 0x0A, 0x8A, 0xF4, 0x69, 0xF6, 0x8A, 0x14, 0x51, 0x74, 0xB7, 0x6B, 0xD1,
+    0x50, 0xD0, 0xE4, 0x27, 0x80, 0x04, 0xD2, 0xE6, 0x0A, 0xD2, 0x6C, 0x71, 0x90, 0xBD, 0x9C, 0x11,
+    0x05, 0x05, 0xCD, 0xF0, 0x0B, 0x98, 0x22, 0x05, 0x52, 0x0A, 0x2C, 0x98, 0x62, 0x42, 0xE6, 0xCE,
+    0xBC, 0x99, 0xBD, 0xE3, 0x08, 0x6C, 0x43, 0x8B, 0x18, 0x7F, 0x6F, 0xF4, 0x8D, 0xFD, 0xD9, 0xF3,
+    0xFC, 0x7D, 0xCF, 0xC6, 0x10, 0x2A, 0x3A, 0xB3, 0x55, 0x15, 0xA2, 0x9E, 0xA0, 0x39, 0x44, 0x4B,
+    0x6B, 0x7B, 0x5B, 0xFA, 0xEC, 0x2C, 0x92, 0x60, 0x3E, 0xA9, 0x18, 0x86, 0x8B, 0x58, 0xB3, 0xDA,
+    0xAD, 0x59, 0x60, 0x1D, 0x99, 0xD3, 0x4E, 0xBD, 0xD1, 0xCC, 0x8B, 0xF5, 0x21, 0x04, 0x07, 0xD3,
+    0x12, 0x30, 0x44, 0x41, 0xBC, 0x2E, 0x21, 0x7E, 0x28, 0x21, 0x3F, 0x2D, 0x91, 0xEA, 0x12, 0x57,
+    0x89, 0xFC, 0xE9, 0xEF, 0x76, 0x1A, 0xB9, 0x1C, 0xFD, 0x1E, 0x69, 0x05, 0xC4, 0x13, 0x9C, 0x3E,
+    0x26, 0x86, 0x2C, 0x86, 0xAB, 0xD8, 0xD9, 0xC4, 0x3B, 0x37, 0x81, 0xF7, 0x46, 0x28, 0x62, 0x79,
+    0x51, 0xD6, 0x10, 0x2D, 0xD0, 0x5E, 0x46, 0xBB, 0x10, 0xCD, 0x44, 0x31, 0xC6, 0x61, 0x9B, 0x44,
+    0x6C, 0x12, 0x83, 0xFE, 0xB6, 0x36, 0xA8, 0x0B, 0xD8, 0x1C, 0x98, 0x3C, 0xB7, 0xD3, 0x97, 0x61,
+    0xC2, 0x18, 0xB4, 0x39, 0xDA, 0x02, 0x6D, 0x86, 0x26, 0xFD, 0x2E, 0x24, 0xD1, 0x93, 0x3F, 0x9F,
+    0x69, 0x6C, 0x68, 0x3B, 0x78, 0xB0, 0x83, 0x00, 0x41, 0x6A, 0x1E, 0x8A, 0x5C, 0x48, 0x03, 0xB8,
+    0x06, 0x0C, 0x80, 0x03, 0x74, 0x23, 0x55, 0xCF, 0x66, 0x04, 0x1D, 0xCB, 0x2C, 0x09, 0xB9, 0xA8,
+    0x99, 0xA2, 0xE2, 0x4E, 0x30, 0xAF, 0xBD, 0x8A, 0x56, 0xC5, 0xAA, 0x50, 0xCB, 0x74, 0x2D, 0xF8,
+    0x2E, 0xEE, 0xD4, 0x0C, 0xC3, 0x10, 0xB4, 0x34, 0xDA, 0x42, 0x97, 0x7B, 0x32, 0x2C, 0x92, 0x9A,
+    0x54, 0x0F, 0x45, 0x93, 0x8B, 0x26, 0xFB, 0xA5, 0x49, 0xBE, 0x6C, 0x20, 0x6A, 0x24, 0xE1, 0x5D,
+    0x59, 0x0D, 0x8C, 0xCF, 0x4E, 0xFA, 0x5C, 0xDD, 0x00, 0x1E, 0x9C, 0x5B, 0x8C, 0xED, 0xE8, 0xEB,
+    0xE1, 0x5F, 0x7B, 0x96, 0x4F, 0xD7, 0x3F, 0x1A, 0xEE, 0xEF, 0xCF, 0xE8, 0x9C, 0xE5, 0x09, 0xA7,
+    0x9F, 0x17, 0x70, 0x20, 0x43, 0xEA, 0x33, 0xE4, 0xD8, 0x03, 0xE9, 0xA0, 0xED, 0xDB, 0x82, 0xFE,
+    0x04, 0x05, 0x32, 0x9B, 0x96, 0x49, 0x8D, 0x4D, 0xC0, 0x72, 0x63, 0x99, 0xD5, 0xA5, 0x0C, 0x49,
+    0x2D, 0x9A, 0xD3, 0xB0, 0x65, 0x6B, 0x44, 0x2D, 0x83, 0xAA, 0x52, 0x37, 0xC1, 0x67, 0x5C, 0x79,
+    0xFD, 0x2D, 0x8B, 0x6C, 0xDC, 0xB0, 0x38, 0xB7, 0xA0, 0xFC, 0x75, 0xE6, 0x67, 0x63, 0x25, 0x4C,
+    0x65, 0xDC, 0xFA, 0x36, 0x83, 0xFF, 0xA5, 0x8A, 0xC8, 0x99, 0xEC, 0xD4, 0x31, 0x26, 0xC7, 0xB8,
+    0x7C, 0xD8, 0xF9, 0xAB, 0xED, 0x84, 0xA5, 0x0F, 0xE4, 0x23, 0x86, 0x54, 0x85, 0xCF, 0x55, 0xD8,
+    0x95, 0x61, 0x53, 0x06, 0x74, 0x56, 0x41, 0xFB, 0xAE, 0x64, 0x83, 0xAE, 0x58, 0xCA, 0x6D, 0x6E,
+    0xE0, 0x26, 0xCB, 0x7A, 0x14, 0x9B, 0xB3, 0x78, 0x37, 0x39, 0x8F, 0xAF, 0x60, 0x9C, 0x3C, 0x86,
+    0x18, 0xB3, 0xDC, 0x14, 0x52, 0xB3, 0x23, 0x9A, 0x79, 0x52, 0xEF, 0x5D, 0xA2, 0x8A, 0x6C, 0xA7,
+    0xA2, 0xFF, 0x55, 0xFB, 0x1F, 0x50, 0xED, 0xDA, 0x0C, 0xF9, 0x3D, 0x3B, 0x50, 0xEE, 0x02, 0x93,
+    0x23, 0xFD, 0xA5, 0xE8, 0x77, 0xA5, 0xAF, 0xA5, 0x0F, 0xCA, 0x1F, 0x68, 0x5F, 0xFC, 0x16, 0x28,
+    0xD4, 0x64, 0x06, 0xC3, 0x18, 0xE9, 0x1F, 0xCA, 0x72, 0x9E, 0x94, 0x31, 0x96, 0x35, 0x30, 0x07,
+    0x76, 0x81, 0x5C, 0x78, 0x1D, 0x3B, 0x29, 0x27, 0x4F, 0x60, 0x3E, 0x72, 0x03, 0x51, 0x1D, 0x20,
+    0xCC, 0x11, 0x6A, 0xD4, 0x34, 0x3A, 0x0F, 0x11, 0x06, 0x49, 0x99, 0x3E, 0xED, 0x62, 0xEE, 0x7F,
+    0xFE, 0x04, 0xD9, 0x8F, 0xAF, 0x78, 0x3A, 0x2A, 0x88, 0x5F, 0x1D, 0xF0, 0x8C, 0x04, 0x6E, 0x11,
+    0x05, 0xF1, 0x3D, 0x7F, 0x7F, 0x9B, 0xFA, 0x44, 0x83, 0xA3, 0x8F, 0xB9, 0x64, 0xC7, 0xED, 0x0B,
+    0xE4, 0x47, 0xD8, 0xD6, 0xAE, 0x2B, 0x9C, 0x2C, 0x47, 0x1F, 0xF6, 0xBF, 0x96, 0x7E, 0x2E, 0xFD,
+    0x40, 0x5B, 0xF3, 0x1C, 0x62, 0x1B, 0xD3, 0x4E, 0x84, 0x84, 0x3E, 0xC3, 0xFB, 0x8F, 0xA1, 0xBF,
+    0xE1, 0x29, 0xF4, 0x03, 0x68, 0x77, 0x8D, 0x7D, 0xFF, 0x44, 0x6A, 0xAF, 0x63, 0x5A, 0x65, 0xAE,
+    0x97, 0xC8, 0xDF, 0xE7, 0xDF, 0xDE, 0x27, 0x8E, 0xE9, 0x93, 0xCB, 0x16, 0xC5, 0xF2, 0x01, 0xFB,
+    0xA6, 0xC4, 0x4F, 0xF4, 0xB7, 0x4A, 0x8E, 0x05, 0xC6, 0x2F, 0xBA, 0xF9, 0x3D, 0xC7, 0x23, 0x9B,
+    0x5A, 0xBD, 0xB2, 0xA5, 0x76, 0xFA, 0x02, 0xB8, 0xF2, 0xF6, 0xE3, 0x2B, 0xD6, 0x3C, 0x7A, 0xF5,
+    0xB2, 0x54, 0xBE, 0x10, 0xA1, 0xBB, 0x18, 0x82, 0x22, 0xAF, 0x95, 0x2F, 0xED, 0x38, 0x3A, 0xAE,
+    0x33, 0xB7, 0x3C, 0x21, 0x9C, 0x0B, 0xF3, 0xA8, 0x65, 0xBE, 0xBA, 0x1B, 0x65, 0xF5, 0x6D, 0xA2,
+    0x89, 0x71, 0x6D, 0xFA, 0xBD, 0xDC, 0x3F, 0x8D, 0xD7, 0xFC, 0x89, 0x76, 0x86, 0x7B, 0x48, 0xCF,
+    0xE1, 0x08, 0x6F, 0xFA, 0xDB, 0x49, 0x4F, 0x6B, 0xE8, 0xBB, 0xF6, 0xCF, 0x3D, 0xA7, 0x9C, 0x3D,
+    0xE5, 0x95, 0x21, 0x66, 0xD8, 0xB8, 0x87, 0x81, 0xB2, 0x3C, 0x18, 0xDC, 0x9D, 0xE2, 0xAD, 0xD0,
+    0xED, 0xDC, 0xDD, 0x60, 0xBE, 0xA5, 0x33, 0x5F, 0x75, 0xF9, 0x96, 0x50, 0x30, 0xB3, 0xF1, 0x2C,
+    0xC5, 0x1B, 0xCD, 0xAA, 0x9F, 0x31, 0xFC, 0x03, 0x9D, 0x58, 0x4D, 0x8C, 0xD5, 0xD6, 0x15, 0x3E,
+    0xB6, 0x01, 0x47, 0xB1, 0x82, 0x59, 0x74, 0xA0, 0xD2, 0x90, 0xB8, 0x8B, 0x2C, 0x2A, 0x4A, 0xB0,
+    0x2A, 0xA1, 0x6A, 0x2A, 0x0D, 0x63, 0x57, 0x59, 0x74, 0x91, 0x45, 0x67, 0xC1, 0x6B, 0x16, 0x2C,
+    0xA0, 0x5B, 0xBA, 0x18, 0x16, 0x91, 0x4A, 0x55, 0x78, 0x76, 0x60, 0xD1, 0x05, 0x52, 0x83, 0xD4,
+    0xEE, 0x9B, 0x45, 0x17, 0xE4, 0xB1, 0x18, 0x5A, 0xA1, 0x2A, 0x95, 0x60, 0xAE, 0x03, 0x8A, 0xB2,
+    0x60, 0xD1, 0x97, 0xA2, 0xA8, 0xCB, 0xBA, 0x53, 0x50, 0x2B, 0xB2, 0xC0, 0x15, 0x1E, 0xF1, 0x66,
+    0x6A, 0xFB, 0xF6, 0xFB, 0x8E, 0xDF, 0x9B, 0x19, 0x28, 0xA9, 0x50, 0x2C, 0xCD, 0x77, 0xEF, 0xF8,
+    0x5E, 0xDF, 0x7B, 0xEE, 0x39, 0xDF, 0xF9, 0xB9, 0x4F, 0x84, 0xCF, 0x4A, 0x27, 0xE2, 0x6E, 0xAE,
+    0x14, 0x12, 0x14, 0x41, 0x21, 0x51, 0xEA, 0x17, 0x92, 0xF0, 0xBD, 0xC2, 0x50, 0xC1, 0x19, 0x0C,
+    0x4E, 0x0E, 0x7D, 0x6B, 0x9B, 0xA1, 0x64, 0x72, 0x21, 0x93, 0x25, 0x39, 0x9A, 0x00, 0x0E, 0xC7,
+    0xE9, 0x92, 0x48, 0x58, 0x00, 0xBC, 0xCD, 0x6C, 0x90, 0x4A, 0x66, 0xED, 0x58, 0x30, 0x05, 0xCF,
+    0xD2, 0xF3, 0x10, 0x10, 0x42, 0x71, 0xCC, 0x20, 0x13, 0x2C, 0x65, 0x45, 0xF6, 0xEC, 0xC1, 0xC0,
+    0xFE, 0xD7, 0x00, 0xAF, 0x1D, 0x06, 0x1C, 0xBB, 0x20, 0x12, 0x58, 0x8B, 0x55, 0xDA, 0xAC, 0x74,
+    0xDA, 0x85, 0xA4, 0xF2, 0xEA, 0xE3, 0x3F, 0xAB, 0xC3, 0xF2, 0xDC, 0x1F, 0xAA, 0xA8, 0xB8, 0xF1,
+    0xFB, 0x34, 0x2E, 0x6E, 0x94, 0x92, 0x14, 0xE5, 0x58, 0x92, 0xFC, 0x73, 0xC0, 0xFB, 0x9F, 0x43,
+    0xD2, 0xF7, 0xEF, 0x00, 0x2E, 0xDD, 0xCD, 0x25, 0xB9, 0x7B, 0x39, 0x97, 0xF8, 0xEE, 0x2F, 0x53,
+    0x89, 0xEE, 0xFF, 0x10, 0x52, 0x3D, 0xC5, 0x86, 0xBE, 0x0D, 0xE5, 0x9C, 0x6B, 0xF7, 0x3B, 0x95,
+    0x18, 0xBB, 0x5A, 0x4A, 0xC4, 0xE5, 0x5F, 0x1F, 0x5E, 0x15, 0x39, 0xBA, 0x88, 0x1D, 0x17, 0x17,
+    0x00, 0x0B, 0xC7, 0x65, 0xFA, 0x38, 0x16, 0x9A, 0x88, 0xB6, 0xCC, 0x58, 0x4C, 0x1A, 0x56, 0x6E,
+    0x23, 0x5E, 0xED, 0x55, 0xE2, 0x55, 0x61, 0x29, 0xEE, 0x38, 0xC4, 0xC1, 0x24, 0x2E, 0xA8, 0x17,
+    0x85, 0xCB, 0x6D, 0x34, 0x4E, 0x2E, 0x75, 0xA6, 0x4A, 0xF2, 0xE4, 0x2E, 0xE1, 0xD2, 0x18, 0x90,
+    0x42, 0xB4, 0x84, 0x53, 0x12, 0x4E, 0x06, 0x60, 0x12, 0x64, 0xA9, 0x00, 0x7E, 0x9D, 0xC8, 0x01,
+    0xAF, 0x49, 0xE4, 0x86, 0x58, 0xE3, 0x57, 0x92, 0x50, 0x57, 0x3E, 0xB7, 0x94, 0xBD, 0xAA, 0x39,
+    0x2B, 0x2B, 0x80, 0xD4, 0x9D, 0x48, 0x9C, 0x3A, 0x13, 0x09, 0x09, 0xFE, 0x36, 0x40, 0xBC, 0x17,
+    0x41, 0x37, 0xFA, 0x10, 0x72, 0xDB, 0xFA, 0xF9, 0x81, 0x9F, 0x76, 0x1F, 0xC1, 0x10, 0xB6, 0xFD,
+    0x9F, 0x2F, 0x70, 0x2C, 0x91, 0x79, 0xBB, 0x2C, 0xD0, 0xC8, 0x64, 0x76, 0xF2, 0x79, 0x0B, 0x95,
+    0x98, 0xD5, 0x5A, 0xDC, 0xDA, 0xC1, 0xB1, 0x2B, 0x69, 0xC4, 0x1F, 0xCB, 0x2D, 0x09, 0xC6, 0x72,
+    0x86, 0x00, 0xE9, 0x4B, 0x00, 0x06, 0xA6, 0x70, 0x70, 0x73, 0xC0, 0xE5, 0xA1, 0xCD, 0xB9, 0xDB,
+    0xE8, 0xC9, 0x45, 0xFC, 0xCD, 0x65, 0xB3, 0x77, 0x3D, 0x75, 0xD4, 0xEE, 0x54, 0xB3, 0xDC, 0xE4,
+    0xE6, 0x8F, 0x52, 0xC9, 0x03, 0xDB, 0x9D, 0xCA, 0x63, 0x1E, 0x75, 0x41, 0x56, 0x28, 0x88, 0x93,
+    0xCA, 0xEE, 0xC7, 0x2D, 0xFA, 0xD6, 0xCB, 0xFB, 0x36, 0x98, 0x0E, 0x87, 0xD4, 0x7D, 0x1D, 0x37,
+    0x11, 0x54, 0x36, 0x3F, 0xB1, 0x36, 0x81, 0xE8, 0x4E, 0x57, 0x24, 0x2D, 0x4F, 0x63, 0x25, 0xAC,
+    0x05, 0x6A, 0x6C, 0xA1, 0x67, 0x72, 0xAF, 0x91, 0xA0, 0xDC, 0x6E, 0x93, 0x17, 0xB5, 0xE1, 0xB4,
+    0x8D, 0xA7, 0x6D, 0x32, 0x6D, 0xB3, 0x69, 0xFB, 0x9F, 0x69, 0xFB, 0x25, 0x5B, 0xA7, 0x75, 0xEF,
+    0xC1, 0x5A, 0xD0, 0xD1, 0xAF, 0xEF, 0x6D, 0x62, 0x6A, 0x62, 0x9F, 0xBE, 0x63, 0x25, 0x99, 0xF4,
+    0x52, 0xF1, 0xD9, 0x3F, 0x6D, 0x8F, 0x4E, 0xDB, 0x6F, 0x2B, 0xC6, 0x58, 0xDF, 0xE6, 0xF3, 0x1D,
+    0x3E, 0xCC, 0x1D, 0xB0, 0xBD, 0x86, 0xA4, 0xB9, 0x40, 0x79, 0xB6, 0x50, 0x2C, 0x89, 0x4F, 0x2B,
+    0xE2, 0x93, 0x09, 0xF1, 0xDF, 0x8D, 0x90, 0xA6, 0x78, 0xCA, 0xB3, 0x5B, 0x66, 0xB4, 0x75, 0x55,
+    0x40, 0x2B, 0xBC, 0x07, 0xF9, 0xA7, 0xEF, 0xAB, 0xB3, 0x5B, 0xD7, 0xB7, 0xF8, 0xDE, 0x9B, 0xF0,
+    0xBD, 0xD3, 0x10, 0xA5, 0x53, 0xCC, 0x14, 0x13, 0xC5, 0x48, 0x11, 0xDA, 0x98, 0xEF, 0x52, 0x30,
+    0x2D, 0xB6, 0x85, 0x47, 0xBE, 0x6D, 0x51, 0x9B, 0xDF, 0xB1, 0x6A, 0x76, 0xA7, 0xA5, 0x4C, 0x54,
+    0x5A, 0x92, 0x6B, 0xA3, 0xD4, 0x6E, 0xC1, 0x57, 0x6D, 0xC2, 0x59, 0x73, 0xA0, 0x6F, 0xCE, 0xE9,
+    0x58, 0x71, 0xA3, 0x9F, 0x59, 0xE9, 0x77, 0xDE, 0x46, 0x2A, 0xAD, 0xD3, 0x66, 0x38, 0x09, 0x44,
+    0x3B, 0xB4, 0xB1, 0x2C, 0xF6, 0x23, 0x65, 0x47, 0x2B, 0x2F, 0xD3, 0xB8, 0x68, 0x18, 0x79, 0x6A,
+    0x28, 0xE8, 0x37, 0xB0, 0xE6, 0x99, 0x84, 0x6C, 0x35, 0x95, 0x2A, 0x6F, 0x2F, 0x0E, 0xAC, 0xE2,
+    0xD2, 0x27, 0x94, 0xA6, 0x5E, 0xE3, 0x74, 0xEA, 0xA4, 0x30, 0x57, 0xDA, 0xB7, 0x2A, 0x32, 0xDA,
+    0x68, 0xBB, 0x0D, 0xEC, 0x58, 0xDB, 0xE4, 0x54, 0xAD, 0x6D, 0x23, 0x8D, 0xCE, 0xAF, 0xE5, 0x63,
+    0xB4, 0x43, 0xA7, 0x96, 0x33, 0x4E, 0xB3, 0x6F, 0x02, 0xD3, 0xD2, 0x69, 0x72, 0x01, 0x57, 0x9D,
+    0xCE, 0xE4, 0x92, 0xC1, 0x7F, 0x1A, 0x2C, 0x13, 0xC1, 0x54, 0x0D, 0xD8, 0xE1, 0x58, 0x28, 0xD7,
+    0x87, 0xC5, 0x22, 0x7C, 0xEF, 0x35, 0xAA, 0xAE, 0xC6, 0x69, 0xE5, 0x00, 0xD6, 0x68, 0x40, 0xB8,
+    0x52, 0x96, 0xD0, 0x66, 0x3F, 0xA8, 0xE4, 0x22, 0x18, 0x98, 0x7C, 0x52, 0x4B, 0x73, 0xCA, 0x5E,
+    0x0D, 0x37, 0xBB, 0x77, 0x6B, 0x63, 0x2B, 0xB7, 0x85, 0xE1, 0x7B, 0x2A, 0x2C, 0x43, 0xF9, 0xB5,
+    0xBC, 0x8A, 0x05, 0xDB, 0x79, 0xFB, 0x00, 0xC1, 0xD5, 0x31, 0x9B, 0x54, 0x3C, 0x44, 0x0F, 0x0B,
+    0x1E, 0x1F, 0xC1, 0x24, 0xC8, 0xC5, 0xC0, 0x71, 0xC6, 0xF0, 0x78, 0xC9, 0x52, 0x31, 0x25, 0x89,
+    0x05, 0xAB, 0x80, 0x1B, 0x91, 0xCE, 0x7C, 0x52, 0xC9, 0x5B, 0x10, 0xA5, 0x70, 0xFE, 0x52, 0xD3,
+    0x9F, 0xC2, 0xB1, 0xFB, 0xC9, 0x44, 0x3B, 0xA5, 0x87, 0x13, 0x9E, 0x67, 0x24, 0xE9, 0x9F, 0x23,
+    0xD7, 0xB7, 0xAE, 0x8F, 0xEC, 0x68, 0x6B, 0x84, 0xC8, 0x15, 0xC0, 0x05, 0xA0, 0x4B, 0x77, 0x12,
+    0x4A, 0xE2, 0x8E, 0xA9, 0x9F, 0xFD, 0x12, 0xBF, 0xAD, 0x46, 0x7E, 0x5D, 0xA2, 0xCB, 0xEC, 0xAC,
+    0x1D, 0x95, 0xF0, 0x33, 0x0A, 0x9A, 0x2D, 0x4A, 0x78, 0x8F, 0x4A, 0x4D, 0xDE, 0x93, 0xE0, 0x6F,
+    0x1A, 0xFB, 0x11, 0xF7, 0x94, 0x1F, 0x31, 0x3A, 0xAA, 0x77, 0x06, 0xC1, 0x46, 0x3B, 0x63, 0xEA,
+    0x9A, 0x8E, 0x9E, 0x4B, 0x93, 0x8D, 0x56, 0xA1, 0xCD, 0x21, 0x2D, 0x49, 0x4C, 0x7A, 0x4C, 0x89,
+    0x71, 0x3E, 0x43, 0xAF, 0x8A, 0x5E, 0x02, 0xE1, 0x70, 0x3B, 0xE8, 0x28, 0x7A, 0x35, 0x31, 0xA8,
+    0x86, 0xDE, 0xD6, 0xC8, 0x14, 0x43, 0xCF, 0xDA, 0x4D, 0x72, 0x83, 0x01, 0x27, 0xB2, 0x1A, 0xB0,
+    0x29, 0x10, 0x5C, 0xDD, 0x19, 0x98, 0x93, 0x10, 0xD8, 0x36, 0x32, 0xCD, 0x3E, 0x80, 0x7D, 0xCB,
+    0xF0, 0x5D, 0x8B, 0x78, 0xEB, 0x77, 0x26, 0xA3, 0xAE, 0x2C, 0x89, 0x62, 0x21, 0x11, 0x00, 0x14,
+    0x32, 0xF4, 0xF1, 0xEC, 0xC5, 0xC0, 0x51, 0x9D, 0x07, 0xA5, 0x23, 0xBC, 0x54, 0xBE, 0xC1, 0xEA,
+    0x5D, 0xF2, 0x40, 0xCC, 0x24, 0x69, 0x9E, 0x0B, 0x5A, 0x21, 0x1D, 0xF6, 0xD5, 0xD1, 0x68, 0x74,
+    0x75, 0x9A, 0x45, 0x0C, 0x78, 0x13, 0x6E, 0x59, 0xEA, 0x01, 0x56, 0xBC, 0xCD, 0x85, 0x1A, 0x5A,
+    0x7E, 0x22, 0x7B, 0xC8, 0xF6, 0xDD, 0x61, 0xF4, 0xD0, 0x06, 0x92, 0x26, 0x5C, 0xBB, 0x10, 0x9F,
+    0xFF, 0x2A, 0x9C, 0xDA, 0x18, 0x30, 0x36, 0x77, 0xB3, 0x79, 0xFC, 0xC2, 0x9D, 0xF4, 0x0C, 0x57,
+    0xA7, 0xD4, 0xE3, 0x39, 0xA4, 0x8E, 0x9F, 0x4A, 0xD8, 0x19, 0xEA, 0xA1, 0xE9, 0xB3, 0x48, 0x6C,
+    0x1B, 0xCF, 0x56, 0xF3, 0xF6, 0x5F, 0x2E, 0x9D, 0x52, 0xC8, 0x2B, 0xC3, 0x40, 0x06, 0x44, 0x0A,
+    0x04, 0x22, 0xB7, 0x03, 0x19, 0xB8, 0x8C, 0x9C, 0x50, 0xE4, 0xF2, 0xC6, 0x43, 0x74, 0x9F, 0x33,
+    0xA7, 0xBE, 0x38, 0xA9, 0x71, 0xA6, 0x45, 0xDF, 0xB4, 0x27, 0xF1, 0xFE, 0x09, 0x77, 0x33, 0x85,
+    0xD5, 0x99, 0x99, 0x7E, 0x8B, 0x58, 0xC9, 0x15, 0x6A, 0x5D, 0x4D, 0x57, 0x76, 0x3B, 0xDD, 0x05,
+    0xBE, 0x64, 0x49, 0xE3, 0x43, 0xE4, 0xF9, 0x26, 0x24, 0xC1, 0x00, 0x99, 0xD9, 0x12, 0xBA, 0x25,
+    0x4C, 0x59, 0xBA, 0x00, 0x78, 0xE3, 0x3C, 0x60, 0xFF, 0x7B, 0xBD, 0x14, 0x86, 0x87, 0x31, 0x0E,
+    0x21, 0x86, 0x52, 0x0D, 0x8F, 0x09, 0x77, 0x44, 0x19, 0x40, 0x7A, 0x1A, 0x57, 0x9C, 0xD2, 0xAC,
+    0x6C, 0x0F, 0xA4, 0xFD, 0x80, 0xA3, 0x47, 0x2E, 0xFB, 0x6F, 0x9F, 0x81, 0x83, 0xD8, 0x5A, 0x34,
+    0x8C, 0x60, 0xC2, 0xD4, 0x03, 0x59, 0x77, 0xF4, 0xCF, 0x5B, 0xD3, 0x76, 0xEF, 0xAD, 0x59, 0xD2,
+    0xB3, 0xA5, 0x76, 0x6E, 0xFA, 0xE5, 0xC5, 0xA9, 0x2D, 0x8B, 0xA8, 0xB7, 0x6D, 0x94, 0x07, 0x7D,
+    0x2A, 0x4A, 0x52, 0xAF, 0x9F, 0x94, 0x68, 0xC0, 0xD2, 0x8A, 0xC8, 0xA9, 0xB5, 0x73, 0xBB, 0x4F,
+    0xA8, 0xAA, 0xDF, 0x67, 0x3B, 0x7C, 0xAF, 0x1D, 0x77, 0x9A, 0x97, 0x69, 0xCA, 0xED, 0x8E, 0x5B,
+    0xEF, 0x05, 0x55, 0xB0, 0xAC, 0x57, 0x25, 0x10, 0x15, 0x89, 0xD6, 0xAB, 0x26, 0xD8, 0x17, 0x3B,
+    0x06, 0x7F, 0x2F, 0x89, 0x08, 0x0E, 0x77, 0xC7, 0x7E, 0x81, 0x68, 0x04, 0x4F, 0x45, 0xE7, 0x38,
+    0x46, 0x13, 0x7F, 0x1C, 0x14, 0xE7, 0x22, 0xC4, 0xB7, 0xA0, 0x0A, 0xD3, 0xE3, 0x17, 0x86, 0xA7,
+    0xCB, 0x70, 0x73, 0x28, 0x51, 0x19, 0x74, 0x12, 0xFE, 0xB6, 0x97, 0x48, 0xA2, 0x19, 0x33, 0xE3,
+    0xD9, 0xA1, 0x93, 0x59, 0x67, 0x69, 0xD6, 0xB9, 0x38, 0xEB, 0xDC, 0x9A, 0x75, 0xAE, 0xED, 0x90,
+    0xD9, 0xA7, 0xAF, 0xC7, 0xAB, 0xD0, 0xDD, 0x92, 0x07, 0x05, 0x5C, 0x70, 0x70, 0xF8, 0x5B, 0xBB,
+    0x00, 0x81, 0xE4, 0x36, 0x93, 0xF4, 0x90, 0xA3, 0x99, 0x8F, 0x79, 0x09, 0xF5, 0x9B, 0xFC, 0x8A,
+    0x9B, 0x93, 0x84, 0x21, 0x4F, 0x19, 0x40, 0x53, 0x07, 0x18, 0x3E, 0x8F, 0xFB, 0xF8, 0xF7, 0x56,
+    0x08, 0x97, 0x69, 0xDF, 0xE8, 0xC4, 0x7B, 0xBC, 0x08, 0xCE, 0xFC, 0xA8, 0x4A, 0xD2, 0xFD, 0x41,
+    0x99, 0xE4, 0x87, 0xBD, 0x22, 0x2A, 0x16, 0xDC, 0x34, 0x2C, 0xFA, 0xA8, 0x22, 0xAC, 0x34, 0x9C,
+    0x1C, 0x95, 0x86, 0x57, 0x78, 0x50, 0x0A, 0x0E, 0xCE, 0xE2, 0x2B, 0x67, 0xA8, 0x66, 0x22, 0xA8,
+    0x41, 0xEF, 0xEE, 0x2A, 0xCD, 0xD6, 0x32, 0xE9, 0x1B, 0x3A, 0x69, 0x54, 0xCC, 0x99, 0xC1, 0xE9,
+    0x87, 0x9A, 0x1D, 0xF1, 0x2F, 0x36, 0x26, 0x0C, 0xEC, 0xE0, 0xF4, 0xC6, 0xEC, 0x1D, 0x56, 0x36,
+    0x8C, 0xA2, 0x46, 0xBD, 0x81, 0xC9, 0xC4, 0x8C, 0xD2, 0xE7, 0x99, 0xF3, 0x3C, 0x70, 0xC3, 0x43,
+    0xF6, 0xA1, 0x70, 0x4B, 0x35, 0x5B, 0xB1, 0x83, 0x86, 0xC5, 0x52, 0x68, 0x1F, 0x33, 0x08, 0xBE,
+    0x7D, 0xA7, 0x83, 0x5F, 0x7A, 0xF0, 0x10, 0xD4, 0x8A, 0xC5, 0x10, 0x7B, 0x7B, 0xC5, 0x02, 0xB6,
+    0xE4, 0xCC, 0xA8, 0x20, 0xC6, 0x8A, 0x49, 0xFE, 0x95, 0xF8, 0xD8, 0x22, 0xCD, 0x7B, 0x9F, 0xD9,
+    0x71, 0x52, 0x70, 0x1D, 0xCE, 0x37, 0xBA, 0xC2, 0x9A, 0x06, 0xF8, 0x35, 0x14, 0x8E, 0x44, 0xB7,
+    0x21, 0x8A, 0xB9, 0x4C, 0x8C, 0xEC, 0x97, 0x4C, 0x9D, 0x96, 0x7C, 0x87, 0xA2, 0x76, 0x64, 0x73,
+    0x95, 0x00, 0x3D, 0x77, 0x55, 0xA5, 0xAC, 0x71, 0xFA, 0x78, 0x8E, 0xE7, 0x17, 0x4A, 0x93, 0x3F,
+    0x2A, 0x11, 0x2B, 0x2D, 0xBF, 0x4A, 0xFA, 0x8A, 0x3B, 0x5E, 0xD3, 0x05, 0x12, 0xE9, 0xCB, 0x8C,
+    0xE6, 0xEC, 0xEA, 0xC8, 0x3C, 0xBA, 0x06, 0x07, 0xA5, 0x69, 0x8E, 0x71, 0xA1, 0xB3, 0x66, 0xB4,
+    0xBA, 0x75, 0xAD, 0x1F, 0x95, 0x8F, 0xC5, 0x9B, 0xB0, 0xC0, 0x40, 0x3E, 0x70, 0x18, 0xAA, 0x85,
+    0xF9, 0xA5, 0x53, 0x09, 0x0C, 0xE9, 0x0C, 0xD3, 0xAC, 0x6C, 0xCA, 0x3E, 0xFB, 0x00, 0xFA, 0x8F,
+    0x34, 0x34, 0x51, 0x0E, 0xE6, 0x5A, 0xBB, 0xCA, 0xA0, 0x8E, 0x2F, 0x60, 0xE4, 0x21, 0x05, 0x4F,
+    0xE8, 0xA7, 0x3B, 0xB7, 0x8D, 0x4C, 0xE6, 0x06, 0x03, 0x9B, 0x72, 0x9F, 0x6A, 0x6E, 0x60, 0x37,
+    0xE1, 0x14, 0xBC, 0x50, 0x18, 0xAB, 0x51, 0x12, 0x91, 0xAD, 0x1B, 0x0C, 0x96, 0x43, 0x9E, 0x45,
+    0xEB, 0x14, 0xC4, 0xF3, 0x57, 0x08, 0x2A, 0x68, 0x44, 0x22, 0xC5, 0xA9, 0xC7, 0x1A, 0xD0, 0xE9,
+    0x7E, 0xDC, 0x72, 0x4B, 0x9E, 0xFD, 0xE4, 0x76, 0x10, 0x08, 0xB6, 0x6B, 0x7C, 0x96, 0xDE, 0xE6,
+    0x1D, 0xD6, 0xF8, 0x01, 0x6B, 0xFC, 0x80, 0x35, 0x7E, 0xC0, 0x1A, 0x3F, 0xA0, 0xC1, 0x02, 0xC6,
+    0x56, 0x42, 0xFE, 0x7F, 0xA1, 0x98, 0x4D, 0x8E, 0xF8, 0x59, 0x58, 0xF1, 0xBE, 0x81, 0xB4, 0x8B,
+    0x1A, 0x3F, 0x60, 0x8D, 0x7F, 0xE5, 0xD9, 0x1A, 0x5F, 0x4B, 0x59, 0x15, 0x63, 0x1F, 0x6B, 0x9F,
+    0x80, 0x5E, 0x1F, 0xBE, 0x18, 0xB4, 0x04, 0x54, 0xF8, 0xCA, 0x29, 0x2F, 0x05, 0xBA, 0x47, 0xC0,
+    0x1B, 0x8C, 0xD7, 0x9E, 0xF1, 0x2A, 0x14, 0x35, 0x5A, 0x59, 0x4D, 0x43, 0x05, 0x4B, 0x14, 0x8B,
+    0xEC, 0x8D, 0x81, 0x96, 0x9E, 0x37, 0xA4, 0x12, 0x97, 0x08, 0x6F, 0xCA, 0x2E, 0x97, 0xD4, 0x84,
+    0xD5, 0xA9, 0xE6, 0xA8, 0xCD, 0x84, 0x5D, 0x5F, 0xBB, 0x59, 0x33, 0x0B, 0x18, 0x1A, 0x9A, 0xFB,
+    0x42, 0x32, 0xCE, 0x63, 0xB3, 0x16, 0xE5, 0xDF, 0xFB, 0xC7, 0x9F, 0xE3, 0xF4, 0xBB, 0xF7, 0xAF,
+    0x24, 0xF2, 0xFD, 0xFB, 0x57, 0x6E, 0xE3, 0x46, 0xF6, 0x41, 0x4D, 0xBA, 0xC2, 0x97, 0xFF, 0xFA,
+    0x01, 0x96, 0xBA, 0x7F, 0x65, 0x0A, 0xB4, 0xAA, 0x9A, 0x7B, 0x57, 0x4A, 0x3D, 0x8B, 0x5C, 0x9A,
+    0xF2, 0xF8, 0xE9, 0xC4, 0x87, 0xFB, 0x57, 0x5E, 0xE5, 0x13, 0xBC, 0xBC, 0x24, 0x5C, 0xF5, 0x2A,
+    0x90, 0x7C, 0x27, 0x85, 0xBE, 0x2C, 0x68, 0x6E, 0x5D, 0xE9, 0x48, 0x42, 0xD8, 0x84, 0x39, 0x29,
+    0x57, 0x90, 0xBE, 0xAC, 0xCC, 0x76, 0x4E, 0x50, 0xF4, 0xA3, 0x73, 0x83, 0xEC, 0x8B, 0x74, 0x76,
+    0xDB, 0x4B, 0xA7, 0x81, 0xE1, 0x50, 0xC3, 0x04, 0x03, 0xC5, 0xC4, 0xF4, 0x3C, 0x65, 0x62, 0xAF,
+    0x21, 0xF5, 0xA6, 0x6E, 0x16, 0x3A, 0x24, 0xD3, 0x95, 0xC6, 0xB3, 0x39, 0x3E, 0xF6, 0x45, 0x61,
+    0x50, 0xF4, 0xEE, 0x80, 0xFC, 0x3C, 0x8B, 0x33, 0xD9, 0x0E, 0x30, 0xAC, 0x66, 0x2B, 0xF8, 0x0E,
+    0xC5, 0x28, 0x84, 0x4C, 0xC9, 0x5F, 0x38, 0xC7, 0xF9, 0x8C, 0x65, 0x6E, 0xB6, 0x39, 0xD5, 0x72,
+    0xC4, 0xDA, 0xE5, 0xE7, 0x19, 0x93, 0x71, 0x86, 0xE0, 0x0F, 0x50, 0xC2, 0xBB, 0xCA, 0x7A, 0xFE,
+    0x0B, 0x5F, 0xCC, 0xE8, 0x8A, 0x88, 0x21, 0xE9, 0x3E, 0xFB, 0x10, 0xE5, 0xC7, 0x2C, 0xCD, 0x41,
+    0x54, 0xF5, 0xC5, 0x78, 0x55, 0x2F, 0x66, 0x3E, 0xCF, 0xB4, 0xA0, 0x61, 0x63, 0xD1, 0xFB, 0x14,
+    0x21, 0x31, 0xB9, 0x0E, 0x0F, 0x63, 0x39, 0x73, 0x1D, 0x7E, 0x7D, 0x9D, 0x5C, 0xE0, 0x7D, 0x2C,
+    0x54, 0x0C, 0x7A, 0x4C, 0xC5, 0xFD, 0xF4, 0x15, 0xF6, 0x1F, 0x9F, 0x08, 0x35, 0xFE, 0x20, 0xA7,
+    0xBA, 0xEB, 0xFF, 0x9C, 0x30, 0xE4, 0x5C, 0x1E, 0x4F, 0xEF, 0xC7, 0xF2, 0x27, 0x0D, 0x3C, 0x3F,
+    0xE9, 0x77, 0xAD, 0xE0, 0xA2, 0x82, 0x90, 0x71, 0x4C, 0x73, 0xD0, 0x9A, 0x32, 0xAF, 0xD9, 0xE6,
+    0x90, 0xCC, 0x11, 0xBE, 0x21, 0xDB, 0x57, 0xC5, 0xDD, 0xE8, 0x5C, 0x4C, 0xF5, 0x02, 0xC0, 0x50,
+    0xD7, 0x9D, 0x80, 0xF6, 0x82, 0x6A, 0x11, 0x74, 0x0E, 0x8B, 0x45, 0x8F, 0x77, 0xE4, 0x45, 0x96,
+    0xF6, 0x98, 0xD9, 0x82, 0xBA, 0x8B, 0x58, 0x79, 0x0D, 0x98, 0x21, 0x2B, 0x2F, 0xE2, 0x6D, 0xFB,
+    0xB5, 0x30, 0xB3, 0xB0, 0x93, 0x5E, 0x38, 0x50, 0x70, 0x19, 0x66, 0xEC, 0x38, 0x07, 0xA0, 0x08,
+    0xC4, 0x75, 0x7C, 0xFC, 0x2C, 0x14, 0xB3, 0xD1, 0x4C, 0x0E, 0xB6, 0xEF, 0x36, 0xFD, 0x4F, 0x1F,
+    0x07, 0xDB, 0xE5, 0xAF, 0x77, 0x09, 0x4F, 0x79, 0xD2, 0xF5, 0x62, 0x37, 0x04, 0x9A, 0xAA, 0x9E,
+    0xDA, 0xDC, 0x9D, 0xAC, 0xDF, 0xAB, 0x82, 0x72, 0xFD, 0x4E, 0x13, 0x16, 0xEB, 0x45, 0x1B, 0xE7,
+    0xEB, 0xC5, 0x30, 0x49, 0xD7, 0x8B, 0xA5, 0x44, 0xA6, 0xB0, 0xB0, 0x43, 0xA3, 0x9D, 0x58, 0xCA,
+    0x82, 0xAA, 0x77, 0x64, 0xBD, 0xC0, 0xAB, 0x13, 0xF4, 0x55, 0x09, 0x87, 0x8F, 0xAC, 0x3E, 0x1A,
+    0xFD, 0x8E, 0x3F, 0x3A, 0xD4, 0x0A, 0x72, 0x98, 0x3F, 0x85, 0x10, 0x0C, 0xC5, 0x5D, 0xD1, 0xB8,
+    0x55, 0x21, 0x85, 0xFB, 0xFC, 0x1D, 0xC4, 0xAF, 0x1C, 0x85, 0x96, 0x5E, 0xD4, 0xCE, 0xFE, 0xD5,
+    0x01, 0x94, 0xA7, 0xFE, 0xC6, 0x0A, 0x83, 0x1C, 0x18, 0xEB, 0x6F, 0x9C, 0x2A, 0x67, 0xA3, 0x48,
+    0x08, 0x3E, 0xB3, 0xB1, 0x4F, 0x66, 0x3E, 0x03, 0x66, 0x36, 0x8A, 0x05, 0x4E, 0x6F, 0xAD, 0xF2,
+    0x6E, 0x4B, 0xF7, 0xD8, 0x96, 0x40, 0xBE, 0xF9, 0xE6, 0x94, 0xAF, 0x59, 0x97, 0x7A, 0xED, 0x4A,
+    0x19, 0x96, 0x7E, 0x8D, 0x64, 0x5A, 0x27, 0xA9, 0xCB, 0x1F, 0x52, 0xF4, 0xA0, 0x2F, 0xFA, 0xA3,
+    0x97, 0xD2, 0x85, 0x91, 0x11, 0xBE, 0x85, 0x02, 0xF5, 0xA6, 0x47, 0x3E, 0x67, 0xCC, 0x3B, 0xCB,
+    0xBA, 0x1C, 0x72, 0xCB, 0x32, 0x5C, 0xBB, 0x3A, 0x32, 0x1A, 0x7D, 0xF8, 0x5F, 0x63, 0x60, 0x60,
+    0x60, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x0E, 0x0D, 0x0D, 0x0D, 0x01, 0x00, 0xA5, 0x90, 0x3D,
+    0x0E, 0x82, 0x40, 0x10, 0x85, 0x1F, 0x60, 0xA0, 0xA0, 0xD8, 0x46, 0x13, 0x13, 0x0B, 0x6E, 0x20,
+    0xAD, 0x95, 0xBB, 0x87, 0xE0, 0x38, 0x2A, 0x1C, 0xC1, 0xC6, 0x43, 0xE8, 0x1D, 0x0C, 0x1C, 0x81,
+    0xCA, 0x9A, 0xCA, 0x56, 0x0B, 0x0B, 0x8C, 0x8B, 0xE3, 0xCC, 0x88, 0x27, 0x30, 0x9B, 0x7D, 0xDF,
+    0xFE, 0xCC, 0xBC, 0x9D, 0x59, 0x04, 0x27, 0x07, 0xC0, 0xBC, 0x7A, 0x56, 0xCB, 0x03, 0x38, 0x23,
+    0xAB, 0x00, 0x0F, 0xD3, 0x20, 0xF8, 0x69, 0xC6, 0xDA, 0x23, 0x17, 0x0D, 0x6A, 0x6A, 0x82, 0x3E,
+    0x22, 0xD1, 0xF1, 0xFC, 0x5F, 0xD5, 0x57, 0x42, 0xD6, 0x16, 0x0B, 0x2A, 0xD2, 0xE7, 0xBE, 0xA6,
+    0x3E, 0xA4, 0x96, 0x6B, 0xC1, 0x8C, 0x67, 0x7C, 0x94, 0x15, 0xEC, 0xAD, 0x13, 0x78, 0x0E, 0x07,
+    0xC2, 0x07, 0x76, 0x82, 0xBB, 0x96, 0x1C, 0x7D, 0x31, 0xEE, 0xD8, 0xB5, 0xE6, 0x0D, 0xF9, 0x98,
+    0x08, 0xE6, 0xF2, 0x36, 0x44, 0x4E, 0x5A, 0x2B, 0x81, 0x35, 0x96, 0x12, 0xB2, 0xC5, 0x5C, 0x60,
+    0xB5, 0x67, 0xD8, 0x56, 0x91, 0x0D, 0x8A, 0x84, 0x3A, 0xBD, 0x28, 0xBD, 0x22, 0x21, 0x05, 0x4A,
+    0xB6, 0xC0, 0x84, 0xBF, 0x86, 0xB1, 0x82, 0x11, 0x6C, 0x90, 0x39, 0x35, 0x63, 0x73, 0x07, 0x7B,
+    0x18, 0x90, 0x5F, 0x5D, 0xCA, 0xE9, 0x29, 0x55, 0x98, 0x72, 0x4E, 0x81, 0x0F, 0x4D, 0x8F, 0xD1,
+    0x0D, 0xC3, 0x20, 0x0C, 0x44, 0x51, 0x19, 0xC0, 0x03, 0xF4, 0x83, 0x11, 0x18, 0xC1, 0x8C, 0xD0,
+    0x8D, 0x32, 0x59, 0x05, 0x23, 0x30, 0x42, 0x46, 0xE0, 0x83, 0x4A, 0xE9, 0x07, 0xBD, 0x1E, 0x46,
+    0x89, 0xE2, 0x9F, 0xB3, 0xEC, 0x67, 0xDD, 0xD9, 0xB9, 0xAB, 0x7C, 0x5A, 0x2A, 0x75, 0xA9, 0xF6,
+    0xA5, 0x18, 0x6B, 0x0D, 0x18, 0x20, 0x80, 0x01, 0xFA, 0x7A, 0x1A, 0x70, 0x38, 0xF7, 0x9E, 0xEB,
+    0x26, 0x45, 0x09, 0x48, 0x93, 0x3D, 0x10, 0xD0, 0x23, 0x34, 0x21, 0x00, 0x60, 0x97, 0x31, 0xAF,
+    0x51, 0x05, 0x89, 0xD7, 0x28, 0x11, 0x55, 0xA9, 0x69, 0x43, 0xA7, 0x8E, 0x07, 0xD0, 0x39, 0x6F,
+    0x81, 0x08, 0xB9, 0xB6, 0x4D, 0x27, 0xCE, 0xF2, 0x74, 0x56, 0xFC, 0xD8, 0x9A, 0xAD, 0x19, 0x7B,
+    0x7C, 0xB3, 0x05, 0x41, 0x8D, 0x16, 0x4C, 0x4B, 0xEC, 0x2B, 0x76, 0xB4, 0x5C, 0xFE, 0x93, 0xD3,
+    0x3D, 0xF7, 0xF5, 0xC7, 0xF9, 0xD7, 0xF9, 0xA7, 0xD5, 0x1F,
 };
 
 static const EpdGlyph notoserif_16_regularGlyphs[] = {
@@ -2412,99 +2415,99 @@ static const EpdGlyph notoserif_16_regularGlyphs[] = {
     { 0, 0, 139, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 139, 0, 0, 0, 0 }, // U+0020
     { 5, 25, 177, 3, 24, 32, 0 }, // !
-    { 11, 9, 218, 1, 24, 25, 32 }, // "
-    { 18, 24, 298, 0, 24, 108, 57 }, // #
-    { 16, 29, 298, 1, 26, 116, 165 }, // $
-    { 28, 26, 478, 1, 25, 182, 281 }, // %
-    { 24, 26, 396, 1, 25, 156, 463 }, // &
-    { 5, 9, 117, 1, 24, 12, 619 }, // '
-    { 10, 31, 185, 1, 26, 78, 631 }, // (
-    { 9, 31, 185, 1, 26, 70, 709 }, // )
-    { 15, 14, 267, 1, 26, 53, 779 }, // *
-    { 15, 16, 298, 2, 20, 60, 832 }, // +
-    { 6, 11, 133, 1, 5, 17, 892 }, // ,
-    { 10, 4, 165, 0, 11, 10, 909 }, // -
-    { 5, 6, 133, 2, 5, 8, 919 }, // .
-    { 10, 31, 154, 0, 26, 78, 927 }, // /
-    { 17, 26, 309, 1, 25, 111, 1005 }, // 0
-    { 15, 24, 245, 0, 24, 90, 1116 }, // 1
-    { 15, 25, 264, 1, 25, 94, 1206 }, // 2
-    { 15, 26, 272, 1, 25, 98, 1300 }, // 3
-    { 18, 24, 294, 0, 24, 108, 1398 }, // 4
-    { 15, 25, 272, 1, 24, 94, 1506 }, // 5
-    { 16, 26, 293, 1, 25, 104, 1600 }, // 6
-    { 16, 24, 274, 1, 24, 96, 1704 }, // 7
-    { 17, 26, 297, 1, 25, 111, 1800 }, // 8
-    { 16, 26, 293, 1, 25, 104, 1911 }, // 9
-    { 5, 20, 153, 2, 19, 25, 2015 }, // :
-    { 7, 25, 153, 1, 19, 44, 2040 }, // ;
-    { 15, 18, 298, 2, 21, 68, 2084 }, // <
-    { 15, 10, 298, 2, 17, 38, 2152 }, // =
-    { 15, 18, 298, 2, 21, 68, 2190 }, // >
-    { 14, 26, 253, 1, 25, 91, 2258 }, // ?
-    { 27, 29, 491, 2, 24, 196, 2349 }, // @
-    { 24, 24, 376, 0, 24, 144, 2545 }, // A
-    { 19, 24, 349, 1, 24, 114, 2689 }, // B
-    { 19, 26, 327, 1, 25, 124, 2803 }, // C
-    { 22, 24, 388, 1, 24, 132, 2927 }, // D
-    { 19, 24, 332, 1, 24, 114, 3059 }, // E
-    { 18, 24, 315, 1, 24, 108, 3173 }, // F
-    { 23, 26, 381, 1, 25, 150, 3281 }, // G
-    { 25, 24, 423, 1, 24, 150, 3431 }, // H
-    { 10, 24, 196, 1, 24, 60, 3581 }, // I
-    { 12, 32, 190, -1, 24, 96, 3641 }, // J
-    { 23, 24, 373, 1, 24, 138, 3737 }, // K
-    { 19, 24, 332, 1, 24, 114, 3875 }, // L
-    { 29, 24, 500, 1, 24, 174, 3989 }, // M
-    { 24, 24, 407, 1, 24, 144, 4163 }, // N
-    { 22, 26, 396, 1, 25, 143, 4307 }, // O
-    { 18, 24, 322, 1, 24, 108, 4450 }, // P
-    { 22, 33, 396, 1, 25, 182, 4558 }, // Q
-    { 22, 24, 350, 1, 24, 132, 4740 }, // R
-    { 16, 26, 290, 1, 25, 104, 4872 }, // S
-    { 20, 24, 327, 0, 24, 120, 4976 }, // T
-    { 24, 25, 382, 0, 24, 150, 5096 }, // U
-    { 23, 24, 360, 0, 24, 138, 5246 }, // V
-    { 35, 24, 558, 0, 24, 210, 5384 }, // W
-    { 22, 24, 352, 0, 24, 132, 5594 }, // X
-    { 22, 24, 333, -1, 24, 132, 5726 }, // Y
-    { 18, 24, 316, 1, 24, 108, 5858 }, // Z
-    { 8, 31, 192, 3, 26, 62, 5966 }, // [
-    { 10, 31, 154, 0, 26, 78, 6028 }, // <backslash>
-    { 8, 31, 192, 1, 26, 62, 6106 }, // ]
-    { 16, 16, 298, 1, 24, 64, 6168 }, // ^
-    { 17, 3, 245, -1, -2, 13, 6232 }, // _
-    { 7, 6, 146, 1, 26, 11, 6245 }, // `
-    { 17, 20, 300, 1, 19, 85, 6256 }, // a
-    { 19, 27, 327, 0, 26, 129, 6341 }, // b
-    { 15, 20, 262, 1, 19, 75, 6470 }, // c
-    { 19, 27, 327, 1, 26, 129, 6545 }, // d
-    { 16, 20, 285, 1, 19, 80, 6674 }, // e
-    { 15, 26, 197, 0, 26, 98, 6754 }, // f
-    { 18, 27, 287, 0, 19, 122, 6852 }, // g
-    { 21, 26, 339, 0, 26, 137, 6974 }, // h
-    { 11, 26, 171, 0, 26, 72, 7111 }, // i
-    { 8, 34, 160, -1, 26, 68, 7183 }, // j
-    { 20, 26, 312, 0, 26, 130, 7251 }, // k
-    { 10, 26, 165, 0, 26, 65, 7381 }, // l
-    { 31, 19, 504, 0, 19, 148, 7446 }, // m
-    { 21, 19, 344, 0, 19, 100, 7594 }, // n
-    { 17, 20, 308, 1, 19, 85, 7694 }, // o
-    { 19, 27, 327, 0, 19, 129, 7779 }, // p
-    { 19, 27, 327, 1, 19, 129, 7908 }, // q
-    { 15, 19, 251, 1, 19, 72, 8037 }, // r
-    { 13, 20, 240, 1, 19, 65, 8109 }, // s
-    { 11, 23, 188, 0, 22, 64, 8174 }, // t
-    { 21, 19, 339, 0, 18, 100, 8238 }, // u
-    { 20, 18, 309, 0, 18, 90, 8338 }, // v
-    { 29, 18, 460, 0, 18, 131, 8428 }, // w
-    { 20, 18, 308, 0, 18, 90, 8559 }, // x
-    { 19, 26, 301, 0, 18, 124, 8649 }, // y
-    { 15, 18, 272, 1, 18, 68, 8773 }, // z
-    { 12, 31, 228, 1, 26, 93, 8841 }, // {
-    { 3, 34, 298, 8, 26, 26, 8934 }, // |
-    { 12, 31, 228, 1, 26, 93, 8960 }, // }
-    { 16, 7, 298, 1, 15, 28, 9053 }, // ~
+    { 11, 9, 218, 1, 24, 25, 0 }, // "
+    { 18, 24, 298, 0, 24, 108, 25 }, // #
+    { 16, 29, 298, 1, 26, 116, 133 }, // $
+    { 28, 26, 478, 1, 25, 182, 249 }, // %
+    { 24, 26, 396, 1, 25, 156, 431 }, // &
+    { 5, 9, 117, 1, 24, 12, 587 }, // '
+    { 10, 31, 185, 1, 26, 78, 32 }, // (
+    { 9, 31, 185, 1, 26, 70, 110 }, // )
+    { 15, 14, 267, 1, 26, 53, 599 }, // *
+    { 15, 16, 298, 2, 20, 60, 652 }, // +
+    { 6, 11, 133, 1, 5, 17, 180 }, // ,
+    { 10, 4, 165, 0, 11, 10, 197 }, // -
+    { 5, 6, 133, 2, 5, 8, 207 }, // .
+    { 10, 31, 154, 0, 26, 78, 712 }, // /
+    { 17, 26, 309, 1, 25, 111, 215 }, // 0
+    { 15, 24, 245, 0, 24, 90, 326 }, // 1
+    { 15, 25, 264, 1, 25, 94, 416 }, // 2
+    { 15, 26, 272, 1, 25, 98, 510 }, // 3
+    { 18, 24, 294, 0, 24, 108, 608 }, // 4
+    { 15, 25, 272, 1, 24, 94, 716 }, // 5
+    { 16, 26, 293, 1, 25, 104, 810 }, // 6
+    { 16, 24, 274, 1, 24, 96, 914 }, // 7
+    { 17, 26, 297, 1, 25, 111, 1010 }, // 8
+    { 16, 26, 293, 1, 25, 104, 1121 }, // 9
+    { 5, 20, 153, 2, 19, 25, 1225 }, // :
+    { 7, 25, 153, 1, 19, 44, 1250 }, // ;
+    { 15, 18, 298, 2, 21, 68, 790 }, // <
+    { 15, 10, 298, 2, 17, 38, 858 }, // =
+    { 15, 18, 298, 2, 21, 68, 896 }, // >
+    { 14, 26, 253, 1, 25, 91, 1294 }, // ?
+    { 27, 29, 491, 2, 24, 196, 964 }, // @
+    { 24, 24, 376, 0, 24, 144, 1385 }, // A
+    { 19, 24, 349, 1, 24, 114, 1529 }, // B
+    { 19, 26, 327, 1, 25, 124, 1643 }, // C
+    { 22, 24, 388, 1, 24, 132, 1767 }, // D
+    { 19, 24, 332, 1, 24, 114, 1899 }, // E
+    { 18, 24, 315, 1, 24, 108, 2013 }, // F
+    { 23, 26, 381, 1, 25, 150, 2121 }, // G
+    { 25, 24, 423, 1, 24, 150, 2271 }, // H
+    { 10, 24, 196, 1, 24, 60, 2421 }, // I
+    { 12, 32, 190, -1, 24, 96, 2481 }, // J
+    { 23, 24, 373, 1, 24, 138, 2577 }, // K
+    { 19, 24, 332, 1, 24, 114, 2715 }, // L
+    { 29, 24, 500, 1, 24, 174, 2829 }, // M
+    { 24, 24, 407, 1, 24, 144, 3003 }, // N
+    { 22, 26, 396, 1, 25, 143, 3147 }, // O
+    { 18, 24, 322, 1, 24, 108, 3290 }, // P
+    { 22, 33, 396, 1, 25, 182, 3398 }, // Q
+    { 22, 24, 350, 1, 24, 132, 3580 }, // R
+    { 16, 26, 290, 1, 25, 104, 3712 }, // S
+    { 20, 24, 327, 0, 24, 120, 3816 }, // T
+    { 24, 25, 382, 0, 24, 150, 1160 }, // U
+    { 23, 24, 360, 0, 24, 138, 3936 }, // V
+    { 35, 24, 558, 0, 24, 210, 4074 }, // W
+    { 22, 24, 352, 0, 24, 132, 4284 }, // X
+    { 22, 24, 333, -1, 24, 132, 4416 }, // Y
+    { 18, 24, 316, 1, 24, 108, 4548 }, // Z
+    { 8, 31, 192, 3, 26, 62, 1310 }, // [
+    { 10, 31, 154, 0, 26, 78, 1372 }, // <backslash>
+    { 8, 31, 192, 1, 26, 62, 1450 }, // ]
+    { 16, 16, 298, 1, 24, 64, 1512 }, // ^
+    { 17, 3, 245, -1, -2, 13, 1576 }, // _
+    { 7, 6, 146, 1, 26, 11, 1589 }, // `
+    { 17, 20, 300, 1, 19, 85, 4656 }, // a
+    { 19, 27, 327, 0, 26, 129, 4741 }, // b
+    { 15, 20, 262, 1, 19, 75, 4870 }, // c
+    { 19, 27, 327, 1, 26, 129, 4945 }, // d
+    { 16, 20, 285, 1, 19, 80, 5074 }, // e
+    { 15, 26, 197, 0, 26, 98, 5154 }, // f
+    { 18, 27, 287, 0, 19, 122, 5252 }, // g
+    { 21, 26, 339, 0, 26, 137, 5374 }, // h
+    { 11, 26, 171, 0, 26, 72, 5511 }, // i
+    { 8, 34, 160, -1, 26, 68, 5583 }, // j
+    { 20, 26, 312, 0, 26, 130, 5651 }, // k
+    { 10, 26, 165, 0, 26, 65, 5781 }, // l
+    { 31, 19, 504, 0, 19, 148, 5846 }, // m
+    { 21, 19, 344, 0, 19, 100, 5994 }, // n
+    { 17, 20, 308, 1, 19, 85, 6094 }, // o
+    { 19, 27, 327, 0, 19, 129, 6179 }, // p
+    { 19, 27, 327, 1, 19, 129, 6308 }, // q
+    { 15, 19, 251, 1, 19, 72, 6437 }, // r
+    { 13, 20, 240, 1, 19, 65, 6509 }, // s
+    { 11, 23, 188, 0, 22, 64, 6574 }, // t
+    { 21, 19, 339, 0, 18, 100, 6638 }, // u
+    { 20, 18, 309, 0, 18, 90, 6738 }, // v
+    { 29, 18, 460, 0, 18, 131, 6828 }, // w
+    { 20, 18, 308, 0, 18, 90, 6959 }, // x
+    { 19, 26, 301, 0, 18, 124, 7049 }, // y
+    { 15, 18, 272, 1, 18, 68, 7173 }, // z
+    { 12, 31, 228, 1, 26, 93, 1600 }, // {
+    { 3, 34, 298, 8, 26, 26, 1693 }, // |
+    { 12, 31, 228, 1, 26, 93, 1719 }, // }
+    { 16, 7, 298, 1, 15, 28, 1812 }, // ~
     { 0, 0, 139, 0, 0, 0, 0 }, // U+00A0
     { 5, 25, 177, 3, 19, 32, 0 }, // U+00A1
     { 15, 24, 298, 2, 24, 90, 32 }, // U+00A2
@@ -2588,19 +2591,19 @@ static const EpdGlyph notoserif_16_regularGlyphs[] = {
     { 17, 27, 308, 1, 26, 115, 8935 }, // U+00F0
     { 21, 25, 344, 0, 25, 132, 9050 }, // U+00F1
     { 17, 27, 308, 1, 26, 115, 9182 }, // U+00F2
-    { 17, 27, 308, 1, 26, 115, 9297 }, // U+00F3
-    { 17, 27, 308, 1, 26, 115, 9412 }, // U+00F4
-    { 17, 26, 308, 1, 25, 111, 9527 }, // U+00F5
-    { 17, 26, 308, 1, 25, 111, 9638 }, // U+00F6
-    { 15, 18, 298, 2, 21, 68, 9749 }, // U+00F7
-    { 17, 22, 308, 1, 20, 94, 9817 }, // U+00F8
-    { 21, 27, 339, 0, 26, 142, 9911 }, // U+00F9
-    { 21, 27, 339, 0, 26, 142, 10053 }, // U+00FA
-    { 21, 27, 339, 0, 26, 142, 10195 }, // U+00FB
-    { 21, 26, 339, 0, 25, 137, 10337 }, // U+00FC
-    { 19, 34, 301, 0, 26, 162, 10474 }, // U+00FD
-    { 19, 34, 327, 0, 26, 162, 10636 }, // U+00FE
-    { 19, 33, 301, 0, 25, 157, 10798 }, // U+00FF
+    { 17, 27, 308, 1, 26, 115, 7241 }, // U+00F3
+    { 17, 27, 308, 1, 26, 115, 9297 }, // U+00F4
+    { 17, 26, 308, 1, 25, 111, 9412 }, // U+00F5
+    { 17, 26, 308, 1, 25, 111, 9523 }, // U+00F6
+    { 15, 18, 298, 2, 21, 68, 9634 }, // U+00F7
+    { 17, 22, 308, 1, 20, 94, 9702 }, // U+00F8
+    { 21, 27, 339, 0, 26, 142, 9796 }, // U+00F9
+    { 21, 27, 339, 0, 26, 142, 9938 }, // U+00FA
+    { 21, 27, 339, 0, 26, 142, 10080 }, // U+00FB
+    { 21, 26, 339, 0, 25, 137, 10222 }, // U+00FC
+    { 19, 34, 301, 0, 26, 162, 10359 }, // U+00FD
+    { 19, 34, 327, 0, 26, 162, 10521 }, // U+00FE
+    { 19, 33, 301, 0, 25, 157, 10683 }, // U+00FF
     { 24, 29, 376, 0, 29, 174, 0 }, // U+0100
     { 17, 24, 300, 1, 23, 102, 174 }, // U+0101
     { 24, 31, 376, 0, 31, 186, 276 }, // U+0102
@@ -3302,98 +3305,98 @@ static const EpdGlyph notoserif_16_regularGlyphs[] = {
     { 10, 4, 165, 0, 11, 10, 195 }, // U+2010
     { 10, 4, 165, 0, 11, 10, 205 }, // U+2011
     { 17, 3, 298, 1, 14, 13, 215 }, // U+2012
-    { 18, 3, 267, -1, 10, 14, 228 }, // U+2013
-    { 35, 3, 533, -1, 10, 27, 242 }, // U+2014
-    { 35, 3, 533, -1, 10, 27, 269 }, // U+2015
-    { 8, 34, 298, 5, 26, 68, 296 }, // U+2016
-    { 15, 7, 219, -1, 0, 27, 364 }, // U+2017
-    { 7, 10, 133, 1, 24, 18, 391 }, // U+2018
-    { 6, 10, 133, 1, 24, 15, 409 }, // U+2019
-    { 6, 11, 133, 1, 5, 17, 424 }, // U+201A
-    { 7, 10, 133, 1, 24, 18, 441 }, // U+201B
-    { 13, 10, 240, 1, 24, 33, 459 }, // U+201C
-    { 13, 10, 240, 1, 24, 33, 492 }, // U+201D
-    { 13, 11, 240, 1, 5, 36, 525 }, // U+201E
-    { 13, 10, 240, 1, 24, 33, 561 }, // U+201F
-    { 13, 30, 239, 1, 26, 98, 594 }, // U+2020
-    { 13, 30, 239, 1, 26, 98, 692 }, // U+2021
-    { 10, 10, 193, 1, 17, 25, 790 }, // U+2022
-    { 11, 12, 267, 3, 18, 33, 815 }, // U+2023
-    { 5, 6, 133, 2, 15, 8, 848 }, // U+2024
-    { 14, 6, 286, 2, 15, 21, 856 }, // U+2025
-    { 24, 6, 458, 2, 5, 36, 877 }, // U+2026
-    { 5, 6, 133, 2, 13, 8, 913 }, // U+2027
-    { 0, 0, 320, 0, 0, 0, 921 }, // U+2028
-    { 0, 0, 320, 0, 0, 0, 921 }, // U+2029
-    { 9, 26, 0, -1, 21, 59, 921 }, // U+202A
-    { 9, 26, 0, -8, 21, 59, 980 }, // U+202B
-    { 8, 28, 0, -4, 23, 56, 1039 }, // U+202C
-    { 8, 28, 0, -4, 23, 56, 1095 }, // U+202D
-    { 8, 28, 0, -4, 23, 56, 1151 }, // U+202E
-    { 0, 0, 89, 0, 0, 0, 1207 }, // U+202F
-    { 41, 26, 688, 1, 25, 267, 1207 }, // U+2030
-    { 54, 26, 899, 1, 25, 351, 1474 }, // U+2031
-    { 6, 9, 100, 0, 24, 14, 1825 }, // U+2032
-    { 12, 9, 201, 0, 24, 27, 1839 }, // U+2033
-    { 19, 9, 301, 0, 24, 43, 1866 }, // U+2034
-    { 6, 9, 100, 0, 24, 14, 1909 }, // U+2035
-    { 12, 9, 201, 0, 24, 27, 1923 }, // U+2036
-    { 19, 9, 301, 0, 24, 43, 1950 }, // U+2037
-    { 11, 10, 213, 1, 2, 28, 1993 }, // U+2038
-    { 7, 14, 178, 2, 16, 25, 2021 }, // U+2039
-    { 7, 14, 178, 2, 16, 25, 2046 }, // U+203A
-    { 24, 24, 437, 2, 24, 144, 2071 }, // U+203B
-    { 13, 25, 298, 3, 24, 82, 2215 }, // U+203C
-    { 16, 26, 288, 1, 25, 104, 2297 }, // U+203D
-    { 17, 3, 245, -1, 28, 13, 2401 }, // U+203E
-    { 26, 7, 0, -13, 0, 46, 2414 }, // U+203F
-    { 26, 7, 0, -13, 28, 46, 2460 }, // U+2040
-    { 15, 24, 240, 0, 24, 90, 2506 }, // U+2041
-    { 31, 26, 533, 1, 26, 202, 2596 }, // U+2042
-    { 10, 6, 193, 1, 15, 15, 2798 }, // U+2043
-    { 15, 24, 33, -6, 24, 90, 2813 }, // U+2044
-    { 8, 31, 192, 3, 26, 62, 2903 }, // U+2045
-    { 8, 31, 192, 1, 26, 62, 2965 }, // U+2046
-    { 30, 26, 509, 1, 25, 195, 3027 }, // U+2047
-    { 22, 26, 410, 1, 25, 143, 3222 }, // U+2048
-    { 22, 26, 405, 3, 25, 143, 3365 }, // U+2049
-    { 16, 25, 298, 1, 19, 100, 3508 }, // U+204A
-    { 19, 30, 329, 1, 26, 143, 3608 }, // U+204B
-    { 18, 13, 318, 1, 19, 59, 3751 }, // U+204C
-    { 18, 13, 318, 1, 19, 59, 3810 }, // U+204D
-    { 15, 14, 267, 1, 19, 53, 3869 }, // U+204E
-    { 6, 25, 153, 2, 19, 38, 3922 }, // U+204F
-    { 22, 26, 389, 1, 25, 143, 3960 }, // U+2050
-    { 15, 28, 267, 1, 26, 105, 4103 }, // U+2051
-    { 11, 25, 175, 0, 24, 69, 4208 }, // U+2052
-    { 16, 7, 298, 1, 15, 28, 4277 }, // U+2053
-    { 26, 7, 0, -13, 0, 46, 4305 }, // U+2054
-    { 16, 16, 288, 1, 20, 64, 4351 }, // U+2055
-    { 16, 20, 327, 2, 19, 80, 4415 }, // U+2056
-    { 23, 9, 369, 0, 24, 52, 4495 }, // U+2057
-    { 19, 20, 378, 2, 19, 95, 4547 }, // U+2058
-    { 19, 20, 378, 2, 19, 95, 4642 }, // U+2059
-    { 5, 26, 153, 2, 25, 33, 4737 }, // U+205A
-    { 19, 26, 378, 2, 25, 124, 4770 }, // U+205B
-    { 19, 18, 372, 2, 18, 86, 4894 }, // U+205C
-    { 5, 26, 153, 2, 25, 33, 4980 }, // U+205D
-    { 5, 26, 153, 2, 25, 33, 5013 }, // U+205E
-    { 0, 0, 118, 0, 0, 0, 5046 }, // U+205F
-    { 0, 0, 320, 0, 0, 0, 5046 }, // U+2060
-    { 0, 0, 320, 0, 0, 0, 5046 }, // U+2061
-    { 0, 0, 320, 0, 0, 0, 5046 }, // U+2062
-    { 0, 0, 320, 0, 0, 0, 5046 }, // U+2063
-    { 0, 0, 320, 0, 0, 0, 5046 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 5046 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 5046 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 5046 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 5046 }, // U+2069
-    { 8, 28, 0, -4, 23, 56, 5046 }, // U+206A
-    { 8, 28, 0, -4, 23, 56, 5102 }, // U+206B
-    { 8, 28, 0, -4, 23, 56, 5158 }, // U+206C
-    { 8, 29, 0, -4, 24, 58, 5214 }, // U+206D
-    { 8, 28, 0, -4, 23, 56, 5272 }, // U+206E
-    { 8, 28, 0, -4, 23, 56, 5328 }, // U+206F
+    { 18, 3, 267, -1, 10, 14, 7356 }, // U+2013
+    { 35, 3, 533, -1, 10, 27, 7370 }, // U+2014
+    { 35, 3, 533, -1, 10, 27, 228 }, // U+2015
+    { 8, 34, 298, 5, 26, 68, 255 }, // U+2016
+    { 15, 7, 219, -1, 0, 27, 323 }, // U+2017
+    { 7, 10, 133, 1, 24, 18, 350 }, // U+2018
+    { 6, 10, 133, 1, 24, 15, 7397 }, // U+2019
+    { 6, 11, 133, 1, 5, 17, 368 }, // U+201A
+    { 7, 10, 133, 1, 24, 18, 385 }, // U+201B
+    { 13, 10, 240, 1, 24, 33, 7412 }, // U+201C
+    { 13, 10, 240, 1, 24, 33, 7445 }, // U+201D
+    { 13, 11, 240, 1, 5, 36, 403 }, // U+201E
+    { 13, 10, 240, 1, 24, 33, 439 }, // U+201F
+    { 13, 30, 239, 1, 26, 98, 472 }, // U+2020
+    { 13, 30, 239, 1, 26, 98, 570 }, // U+2021
+    { 10, 10, 193, 1, 17, 25, 668 }, // U+2022
+    { 11, 12, 267, 3, 18, 33, 693 }, // U+2023
+    { 5, 6, 133, 2, 15, 8, 726 }, // U+2024
+    { 14, 6, 286, 2, 15, 21, 734 }, // U+2025
+    { 24, 6, 458, 2, 5, 36, 7478 }, // U+2026
+    { 5, 6, 133, 2, 13, 8, 755 }, // U+2027
+    { 0, 0, 320, 0, 0, 0, 763 }, // U+2028
+    { 0, 0, 320, 0, 0, 0, 763 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 763 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 822 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 881 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 937 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 993 }, // U+202E
+    { 0, 0, 89, 0, 0, 0, 1049 }, // U+202F
+    { 41, 26, 688, 1, 25, 267, 1049 }, // U+2030
+    { 54, 26, 899, 1, 25, 351, 1316 }, // U+2031
+    { 6, 9, 100, 0, 24, 14, 1667 }, // U+2032
+    { 12, 9, 201, 0, 24, 27, 1681 }, // U+2033
+    { 19, 9, 301, 0, 24, 43, 1708 }, // U+2034
+    { 6, 9, 100, 0, 24, 14, 1751 }, // U+2035
+    { 12, 9, 201, 0, 24, 27, 1765 }, // U+2036
+    { 19, 9, 301, 0, 24, 43, 1792 }, // U+2037
+    { 11, 10, 213, 1, 2, 28, 1835 }, // U+2038
+    { 7, 14, 178, 2, 16, 25, 1863 }, // U+2039
+    { 7, 14, 178, 2, 16, 25, 1888 }, // U+203A
+    { 24, 24, 437, 2, 24, 144, 1913 }, // U+203B
+    { 13, 25, 298, 3, 24, 82, 2057 }, // U+203C
+    { 16, 26, 288, 1, 25, 104, 2139 }, // U+203D
+    { 17, 3, 245, -1, 28, 13, 2243 }, // U+203E
+    { 26, 7, 0, -13, 0, 46, 2256 }, // U+203F
+    { 26, 7, 0, -13, 28, 46, 2302 }, // U+2040
+    { 15, 24, 240, 0, 24, 90, 2348 }, // U+2041
+    { 31, 26, 533, 1, 26, 202, 2438 }, // U+2042
+    { 10, 6, 193, 1, 15, 15, 2640 }, // U+2043
+    { 15, 24, 33, -6, 24, 90, 2655 }, // U+2044
+    { 8, 31, 192, 3, 26, 62, 2745 }, // U+2045
+    { 8, 31, 192, 1, 26, 62, 2807 }, // U+2046
+    { 30, 26, 509, 1, 25, 195, 2869 }, // U+2047
+    { 22, 26, 410, 1, 25, 143, 3064 }, // U+2048
+    { 22, 26, 405, 3, 25, 143, 3207 }, // U+2049
+    { 16, 25, 298, 1, 19, 100, 3350 }, // U+204A
+    { 19, 30, 329, 1, 26, 143, 3450 }, // U+204B
+    { 18, 13, 318, 1, 19, 59, 3593 }, // U+204C
+    { 18, 13, 318, 1, 19, 59, 3652 }, // U+204D
+    { 15, 14, 267, 1, 19, 53, 3711 }, // U+204E
+    { 6, 25, 153, 2, 19, 38, 3764 }, // U+204F
+    { 22, 26, 389, 1, 25, 143, 3802 }, // U+2050
+    { 15, 28, 267, 1, 26, 105, 3945 }, // U+2051
+    { 11, 25, 175, 0, 24, 69, 4050 }, // U+2052
+    { 16, 7, 298, 1, 15, 28, 4119 }, // U+2053
+    { 26, 7, 0, -13, 0, 46, 4147 }, // U+2054
+    { 16, 16, 288, 1, 20, 64, 4193 }, // U+2055
+    { 16, 20, 327, 2, 19, 80, 4257 }, // U+2056
+    { 23, 9, 369, 0, 24, 52, 4337 }, // U+2057
+    { 19, 20, 378, 2, 19, 95, 4389 }, // U+2058
+    { 19, 20, 378, 2, 19, 95, 4484 }, // U+2059
+    { 5, 26, 153, 2, 25, 33, 4579 }, // U+205A
+    { 19, 26, 378, 2, 25, 124, 4612 }, // U+205B
+    { 19, 18, 372, 2, 18, 86, 4736 }, // U+205C
+    { 5, 26, 153, 2, 25, 33, 4822 }, // U+205D
+    { 5, 26, 153, 2, 25, 33, 4855 }, // U+205E
+    { 0, 0, 118, 0, 0, 0, 4888 }, // U+205F
+    { 0, 0, 320, 0, 0, 0, 4888 }, // U+2060
+    { 0, 0, 320, 0, 0, 0, 4888 }, // U+2061
+    { 0, 0, 320, 0, 0, 0, 4888 }, // U+2062
+    { 0, 0, 320, 0, 0, 0, 4888 }, // U+2063
+    { 0, 0, 320, 0, 0, 0, 4888 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 4888 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 4888 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 4888 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 4888 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 4888 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 4944 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 5000 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 5056 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 5114 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 5170 }, // U+206F
     { 12, 16, 213, 1, 28, 48, 0 }, // U+2070
     { 7, 16, 111, 0, 25, 28, 48 }, // U+2071
     { 13, 16, 213, 0, 28, 52, 76 }, // U+2074
@@ -3470,13 +3473,13 @@ static const EpdGlyph notoserif_16_regularGlyphs[] = {
     { 17, 29, 298, 1, 26, 124, 4323 }, // U+20BF
     { 15, 24, 262, 1, 19, 90, 4447 }, // U+20C0
     { 16, 4, 309, 2, 14, 16, 0 }, // U+2212
-    { 26, 26, 378, 0, 26, 169, 0 }, // U+FB00
-    { 22, 26, 354, 0, 26, 143, 169 }, // U+FB01
-    { 22, 26, 353, 0, 26, 143, 312 }, // U+FB02
-    { 33, 26, 534, 0, 26, 215, 455 }, // U+FB03
-    { 33, 26, 534, 0, 26, 215, 670 }, // U+FB04
-    { 22, 27, 356, 0, 26, 149, 885 }, // U+FB05
-    { 25, 27, 421, 1, 26, 169, 1034 }, // U+FB06
+    { 26, 26, 378, 0, 26, 169, 7514 }, // U+FB00
+    { 22, 26, 354, 0, 26, 143, 7683 }, // U+FB01
+    { 22, 26, 353, 0, 26, 143, 7826 }, // U+FB02
+    { 33, 26, 534, 0, 26, 215, 7969 }, // U+FB03
+    { 33, 26, 534, 0, 26, 215, 8184 }, // U+FB04
+    { 22, 27, 356, 0, 26, 149, 0 }, // U+FB05
+    { 25, 27, 421, 1, 26, 169, 149 }, // U+FB06
     { 31, 32, 533, 1, 26, 248, 0 }, // U+FFFD
 };
 
@@ -3484,8 +3487,7 @@ static const EpdUnicodeInterval notoserif_16_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3493,8 +3495,7 @@ static const EpdUnicodeInterval notoserif_16_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3504,19 +3505,57 @@ static const EpdUnicodeInterval notoserif_16_regularIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_16_regularGroups[] = {
-    { 0, 4222, 9745, 97, 0 },
-    { 4222, 3583, 11829, 96, 97 },
-    { 7805, 4508, 18717, 128, 193 },
-    { 12313, 4478, 16767, 96, 321 },
-    { 16791, 1361, 2282, 112, 417 },
-    { 18152, 11481, 38354, 256, 529 },
-    { 29633, 2569, 15453, 90, 785 },
-    { 32202, 2292, 5871, 111, 875 },
-    { 34494, 808, 1816, 42, 986 },
-    { 35302, 2437, 4859, 33, 1028 },
-    { 37739, 16, 16, 1, 1061 },
-    { 37755, 437, 1313, 7, 1062 },
-    { 38192, 141, 256, 1, 1069 },
+    { 0, 3673, 9095, 83, 2 },
+    { 3673, 943, 1925, 26, 0 },
+    { 4616, 3568, 11694, 95, 97 },
+    { 8184, 4508, 18717, 128, 193 },
+    { 12692, 4478, 16767, 96, 321 },
+    { 17170, 1361, 2282, 112, 417 },
+    { 18531, 11481, 38354, 256, 529 },
+    { 30012, 2569, 15453, 90, 785 },
+    { 32581, 2203, 5693, 105, 875 },
+    { 34784, 808, 1816, 42, 986 },
+    { 35592, 2437, 4859, 33, 1028 },
+    { 38029, 16, 16, 1, 1061 },
+    { 38045, 192, 351, 2, 1067 },
+    { 38237, 141, 256, 1, 1069 },
+};
+
+static const uint16_t notoserif_16_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_16_regularKernLeftClasses[] = {
@@ -4436,18 +4475,81 @@ static const EpdLigaturePair notoserif_16_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_16_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 51 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_16_regular = {
     notoserif_16_regularBitmaps,
     notoserif_16_regularGlyphs,
     notoserif_16_regularIntervals,
-    20,
+    18,
     45,
     36,
     -10,
     true,
     notoserif_16_regularGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_16_regularGlyphToGroup,
     notoserif_16_regularKernLeftClasses,
     notoserif_16_regularKernRightClasses,
     notoserif_16_regularKernMatrix,
@@ -4457,4 +4559,8 @@ static const EpdFontData notoserif_16_regular = {
     66,
     notoserif_16_regularLigaturePairs,
     5,
+    notoserif_16_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -3,2999 +3,3004 @@
  * name: notoserif_18_bold
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_18_bold 18 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_18_bold 18 ../builtinFonts/source/NotoSerif/NotoSerif-Bold.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_18_boldBitmaps[47783] = {
-    0xC5, 0x5B, 0xBF, 0x93, 0xDC, 0x46, 0x76, 0x6E, 0x00, 0xE6, 0x4E, 0x99, 0x53, 0x65, 0x24, 0xA6,
-    0xEA, 0x4C, 0xDA, 0x86, 0x03, 0x47, 0x72, 0x95, 0xF1, 0x0F, 0x98, 0x04, 0x4E, 0x89, 0xAA, 0xEC,
-    0xC0, 0x1B, 0x68, 0xED, 0x2A, 0x2B, 0x60, 0xA2, 0x88, 0x0E, 0x36, 0x71, 0xE0, 0x60, 0x45, 0x8C,
-    0x75, 0x81, 0x83, 0x0B, 0xBC, 0xC1, 0xC9, 0x17, 0x5C, 0xE0, 0x0B, 0xE8, 0x2A, 0x69, 0x2F, 0xD8,
-    0xC4, 0x81, 0x83, 0x25, 0x01, 0x4B, 0x81, 0x03, 0x05, 0xC2, 0x49, 0x57, 0x77, 0xC1, 0x05, 0x42,
-    0xB9, 0xC4, 0xC0, 0x4C, 0x04, 0x9F, 0xA0, 0x13, 0x48, 0x01, 0x68, 0x7F, 0xDF, 0xF7, 0x80, 0xD9,
-    0xA1, 0x4C, 0xAE, 0x7E, 0x51, 0xE7, 0xE1, 0xCC, 0x7B, 0x58, 0xA0, 0xD1, 0xFD, 0xFA, 0xF5, 0xFB,
-    0xDD, 0xCD, 0x6C, 0xCC, 0xC6, 0x6C, 0x48, 0xF5, 0x2F, 0xE9, 0x93, 0x3E, 0xEE, 0xE3, 0x0E, 0xFF,
-    0xDA, 0xB8, 0x5D, 0xE3, 0xDF, 0xAA, 0x5D, 0x35, 0x51, 0x13, 0xE4, 0x0E, 0x9F, 0xBD, 0xE3, 0x64,
-    0xC8, 0x86, 0x6C, 0x4C, 0x87, 0xB8, 0x73, 0x79, 0xD1, 0x66, 0x1D, 0x7F, 0x59, 0xCB, 0x7F, 0x69,
-    0x9B, 0x35, 0x69, 0x9B, 0xD6, 0x49, 0x93, 0xD4, 0x71, 0x93, 0x54, 0x71, 0x1D, 0x57, 0xF6, 0x6F,
-    0x2F, 0xDF, 0xCB, 0x5D, 0xD8, 0xAC, 0x37, 0x2E, 0x6A, 0x62, 0x82, 0x24, 0x77, 0xAB, 0x3A, 0x71,
-    0x6E, 0x55, 0xA5, 0xCE, 0xAD, 0xAB, 0xCC, 0xB9, 0xB8, 0xBA, 0xE1, 0xAE, 0x9E, 0x3E, 0xB8, 0xF7,
-    0x46, 0xEA, 0xBD, 0x1F, 0x04, 0x5C, 0xEA, 0x06, 0xE7, 0x32, 0xD7, 0x3B, 0x77, 0xC3, 0x75, 0x00,
-    0x01, 0xC0, 0xAB, 0x61, 0xEB, 0xDC, 0x19, 0xC1, 0x10, 0xB5, 0x0E, 0xCD, 0x7C, 0x2B, 0x70, 0xEB,
-    0xD1, 0xE9, 0x83, 0xE3, 0xB0, 0x5D, 0x57, 0x2E, 0x6C, 0xE3, 0xCA, 0x45, 0xED, 0x53, 0xC6, 0x71,
-    0xEE, 0x8F, 0x09, 0x8E, 0x16, 0x10, 0xDC, 0x3B, 0xC6, 0x18, 0x7E, 0x72, 0x81, 0xBF, 0xE7, 0x37,
-    0xAB, 0xE1, 0xA8, 0xAC, 0xE2, 0xEE, 0x28, 0xAB, 0xE2, 0x96, 0xA0, 0x3B, 0xFA, 0x53, 0x17, 0x0F,
-    0x68, 0x17, 0xFB, 0x33, 0x74, 0x00, 0x9A, 0x5C, 0xE4, 0x3D, 0x38, 0xE1, 0x3D, 0x68, 0x49, 0xF1,
-    0x9A, 0x0B, 0xBD, 0xAF, 0x9C, 0x2B, 0x7C, 0xE3, 0xDC, 0x6D, 0xDF, 0xAE, 0xF2, 0x23, 0x30, 0x62,
-    0x73, 0x04, 0x5E, 0x54, 0x47, 0xC9, 0x0C, 0x9A, 0x23, 0x30, 0xA5, 0x3B, 0x2A, 0xAA, 0x95, 0xE7,
-    0x1B, 0x25, 0xDF, 0x0D, 0xEE, 0x3E, 0x46, 0xC6, 0x0E, 0xB0, 0x4F, 0xC0, 0x46, 0xD7, 0x39, 0x26,
-    0xDE, 0xC0, 0xD8, 0x49, 0x53, 0xE6, 0xE4, 0x44, 0x56, 0x65, 0x15, 0x67, 0x5F, 0x54, 0x59, 0x1D,
-    0x11, 0x6F, 0xD2, 0x66, 0x5D, 0xA3, 0x53, 0x60, 0xCC, 0x9B, 0xB8, 0x4D, 0x73, 0xC3, 0x9C, 0x2E,
-    0xEF, 0xDF, 0x9D, 0xF1, 0xE0, 0xF6, 0xF1, 0x5E, 0xFA, 0x5E, 0x97, 0xFA, 0x1C, 0xFD, 0xBC, 0xDD,
-    0xFA, 0xD3, 0x26, 0xAD, 0x8B, 0x7F, 0x7C, 0x6F, 0x5C, 0x77, 0xF1, 0x27, 0x3E, 0x7E, 0x7B, 0x88,
-    0x86, 0xD0, 0xF7, 0xC9, 0x8B, 0x7D, 0x34, 0xB8, 0x2B, 0x79, 0xB6, 0xEE, 0xC3, 0x11, 0xAF, 0xDE,
-    0x5E, 0x77, 0x21, 0x88, 0x70, 0x58, 0x72, 0xE2, 0xA0, 0x37, 0x1C, 0xB5, 0x76, 0x7F, 0xD5, 0x58,
-    0xBB, 0xB8, 0x5A, 0xF5, 0x11, 0x70, 0xB2, 0x89, 0xD0, 0x0F, 0x17, 0x2E, 0x1C, 0x57, 0x98, 0xC4,
-    0x6D, 0x70, 0xEB, 0x14, 0xDC, 0x19, 0xC8, 0xB0, 0xDC, 0x26, 0xB7, 0xBF, 0x33, 0xD1, 0x72, 0x12,
-    0x8E, 0xBD, 0xAF, 0x89, 0xB3, 0x3E, 0xE9, 0x88, 0x0B, 0x74, 0x4B, 0x5C, 0xD6, 0xAB, 0xE1, 0x49,
-    0xB8, 0x68, 0xED, 0x39, 0xDA, 0xB7, 0xC4, 0xE9, 0x58, 0x54, 0xD6, 0x8F, 0xF5, 0xB7, 0xF2, 0x6D,
-    0xE0, 0x41, 0xCE, 0x35, 0x62, 0x71, 0x1D, 0x73, 0x83, 0x38, 0xF8, 0xD4, 0x8B, 0xDA, 0x61, 0xED,
-    0xDF, 0x22, 0x95, 0x7D, 0xE8, 0x3F, 0x26, 0x5F, 0x3B, 0xE7, 0x3F, 0xC3, 0xC0, 0x45, 0x07, 0x69,
-    0x68, 0x85, 0x63, 0xAE, 0x29, 0x70, 0x44, 0x9C, 0xA1, 0x8D, 0x67, 0x3B, 0xBC, 0x43, 0x8A, 0x93,
-    0x89, 0x2B, 0xBF, 0xC1, 0xFA, 0xFC, 0xEC, 0xF0, 0x53, 0x34, 0xC0, 0x1F, 0xFE, 0x1F, 0x78, 0x23,
-    0x45, 0xAB, 0x02, 0xD8, 0x1D, 0x38, 0x23, 0xB3, 0x90, 0x72, 0x40, 0x35, 0xEA, 0xA4, 0x4E, 0x66,
-    0x75, 0x80, 0x22, 0xE1, 0x91, 0x03, 0xFB, 0x30, 0xD9, 0xA2, 0x71, 0xBE, 0x8A, 0xBC, 0x5B, 0x4F,
-    0x2E, 0x1E, 0x5D, 0x3A, 0x70, 0x0C, 0x0C, 0x87, 0x91, 0x4B, 0x7D, 0x41, 0xCE, 0xF6, 0x6B, 0x77,
-    0x48, 0x64, 0xCF, 0x2F, 0x1A, 0xE3, 0x15, 0xBC, 0x88, 0xD7, 0x03, 0x0C, 0x5A, 0xD4, 0xEC, 0x70,
-    0x85, 0xF9, 0x95, 0x10, 0x1D, 0x0C, 0x0F, 0xE1, 0xE6, 0x1F, 0x15, 0x6F, 0xAF, 0x47, 0x36, 0xC3,
-    0x58, 0xAE, 0x6C, 0x40, 0x97, 0xBA, 0x18, 0xD8, 0x45, 0x32, 0x72, 0x3A, 0x89, 0xC7, 0x8C, 0x1F,
-    0xFB, 0xF2, 0xE6, 0x04, 0xC6, 0x8A, 0x26, 0x34, 0x6E, 0xF9, 0xA2, 0xAF, 0xC0, 0xC6, 0x15, 0x48,
-    0xED, 0x38, 0x1A, 0x38, 0xD1, 0xD8, 0x3A, 0xEE, 0xDD, 0x21, 0xD3, 0xB9, 0x74, 0x14, 0xCB, 0x3F,
-    0x88, 0xDA, 0xDF, 0x77, 0xD9, 0xF7, 0x9A, 0xC9, 0x15, 0xBF, 0xFA, 0x85, 0x77, 0x87, 0x12, 0xFC,
-    0xC3, 0x29, 0xC7, 0x72, 0xFB, 0x63, 0xF0, 0xE7, 0x23, 0x6F, 0x0F, 0xD0, 0xE4, 0x9E, 0x35, 0x76,
-    0xAB, 0x76, 0xE9, 0xE0, 0x12, 0xC5, 0x23, 0xFC, 0xF1, 0xDC, 0xD5, 0x53, 0xC1, 0xAD, 0x9F, 0x3C,
-    0x3A, 0xD9, 0x94, 0xE0, 0x7B, 0x25, 0x70, 0x71, 0x63, 0x47, 0xA5, 0x81, 0xF5, 0xEA, 0x61, 0xE3,
-    0xC6, 0x64, 0x04, 0x8B, 0x06, 0xD7, 0x87, 0xB0, 0x56, 0xB7, 0xDD, 0x1F, 0x49, 0x8C, 0x7C, 0xBF,
-    0xFD, 0x5E, 0xDE, 0x64, 0x6D, 0xD1, 0x97, 0x7D, 0xD1, 0xA5, 0x4D, 0x80, 0x67, 0xAF, 0x38, 0x68,
-    0x1E, 0x8C, 0x0F, 0xBA, 0x40, 0x57, 0x51, 0x03, 0x9B, 0x02, 0x63, 0x02, 0x81, 0x77, 0x30, 0x32,
-    0x30, 0x31, 0x29, 0x85, 0x1D, 0x36, 0xCA, 0xBD, 0x2A, 0x55, 0x1D, 0xBE, 0x72, 0xF3, 0x3B, 0x8B,
-    0x32, 0xAC, 0x25, 0x72, 0x10, 0xDB, 0xC0, 0xFF, 0xC2, 0xE7, 0x58, 0x2D, 0x5F, 0x61, 0x71, 0x8B,
-    0x26, 0xC6, 0x02, 0xB4, 0x09, 0x40, 0xA7, 0xA5, 0xA0, 0x80, 0x0C, 0x5A, 0x3B, 0xC9, 0xC0, 0xE3,
-    0x60, 0xFC, 0xFC, 0xBD, 0xC1, 0x00, 0x0D, 0x3C, 0xB5, 0x85, 0xBD, 0xA8, 0x3F, 0xC8, 0x43, 0xD1,
-    0x68, 0x8C, 0xC0, 0xBF, 0x06, 0xD5, 0x28, 0xB9, 0x46, 0x09, 0xED, 0x8E, 0xC9, 0x2E, 0x96, 0x17,
-    0x62, 0x5D, 0xF3, 0x1E, 0x0D, 0x0C, 0xC0, 0xB5, 0x11, 0x20, 0xEB, 0x08, 0x6A, 0x80, 0xCB, 0x4E,
-    0x2A, 0xFB, 0xEC, 0x40, 0xE0, 0x35, 0x64, 0x4B, 0x23, 0xEB, 0x3B, 0x01, 0xE3, 0x4B, 0x29, 0x4D,
-    0xF3, 0x9C, 0x1D, 0xC4, 0xB4, 0x68, 0x23, 0x9F, 0x97, 0x75, 0x84, 0x85, 0x87, 0x30, 0x56, 0x05,
-    0x41, 0x4A, 0x10, 0x80, 0x65, 0x15, 0x4D, 0x74, 0x4E, 0xFD, 0xA7, 0x31, 0xA0, 0xFD, 0x4A, 0x68,
-    0x27, 0x32, 0xCA, 0x00, 0x1F, 0x86, 0xBC, 0x2F, 0x13, 0x22, 0xBB, 0x51, 0x40, 0x53, 0x03, 0x58,
-    0xFF, 0x36, 0xEA, 0xE9, 0x39, 0x1A, 0x2C, 0x59, 0x86, 0x55, 0x6A, 0xCF, 0x3D, 0xCB, 0x39, 0x58,
-    0x68, 0x39, 0x26, 0x2D, 0x83, 0xD1, 0x92, 0x81, 0x96, 0x4D, 0x41, 0x5A, 0x44, 0x46, 0x46, 0xB0,
-    0x26, 0x20, 0x19, 0x1B, 0x27, 0x8D, 0xA3, 0xE6, 0xD1, 0x12, 0xF0, 0x5D, 0x9A, 0x66, 0xFF, 0xA1,
-    0x73, 0x57, 0x64, 0xF6, 0x56, 0x6C, 0x17, 0x70, 0xD1, 0x9D, 0xBA, 0x2F, 0x0D, 0x5C, 0x27, 0x18,
-    0x79, 0x8F, 0xFA, 0xDA, 0xF8, 0x0D, 0xA7, 0xFA, 0xC9, 0xA1, 0xCF, 0xE1, 0x17, 0x47, 0xBC, 0x04,
-    0x0A, 0x4C, 0x49, 0x6C, 0xAA, 0x20, 0x27, 0x97, 0xE5, 0xCB, 0x25, 0xC8, 0x84, 0x85, 0xE0, 0xA7,
-    0x84, 0xE1, 0xC7, 0x62, 0xC7, 0xFB, 0x84, 0xF1, 0xF7, 0x08, 0x13, 0xBD, 0x75, 0x43, 0xF0, 0x8C,
-    0x30, 0xE8, 0x08, 0x23, 0xB2, 0x15, 0x92, 0x4A, 0x18, 0x6F, 0x08, 0x53, 0xF5, 0x5F, 0x1C, 0xBC,
-    0xEC, 0x5F, 0x47, 0x8F, 0xF8, 0xE4, 0x06, 0x97, 0x71, 0x77, 0xE1, 0x8A, 0xB3, 0x05, 0x0D, 0xB5,
-    0x5C, 0xA4, 0x9F, 0xE1, 0x8A, 0xCD, 0xD7, 0x5B, 0x10, 0x0B, 0xBC, 0x7E, 0x70, 0x98, 0xC7, 0x18,
-    0x43, 0x60, 0x13, 0xF3, 0xED, 0xC4, 0x6D, 0x01, 0x03, 0x8D, 0xD4, 0x2C, 0x29, 0x16, 0xFC, 0x0F,
-    0xF7, 0x0B, 0x71, 0xD0, 0x78, 0x59, 0xCD, 0x32, 0xE2, 0x8C, 0x65, 0x06, 0xBE, 0x43, 0xF0, 0x2A,
-    0x1F, 0xD0, 0x0E, 0x56, 0x25, 0x86, 0xCA, 0x8B, 0xFB, 0xC5, 0xC4, 0x0E, 0x3A, 0xB7, 0xC7, 0xAE,
-    0x66, 0x6E, 0xF1, 0x13, 0xFA, 0x87, 0x94, 0x68, 0xDC, 0x2C, 0xEB, 0xB2, 0x09, 0xB4, 0x82, 0xB0,
-    0x73, 0xED, 0x1A, 0xA6, 0xB4, 0x86, 0x5E, 0xFC, 0x4E, 0x2E, 0x79, 0x49, 0x29, 0x79, 0x99, 0x40,
-    0x7B, 0x25, 0x77, 0xD9, 0xAF, 0xC1, 0xF8, 0x4C, 0x1C, 0x98, 0x30, 0x10, 0x0C, 0x30, 0xCD, 0xBA,
-    0x63, 0xE8, 0x43, 0x7D, 0x6C, 0x5D, 0xDA, 0xA3, 0x71, 0xDA, 0xA7, 0x04, 0xE8, 0x20, 0xED, 0xA9,
-    0x62, 0xDD, 0x7A, 0x90, 0x80, 0x40, 0x95, 0x02, 0x78, 0x87, 0x0A, 0x4C, 0x9C, 0x38, 0x97, 0x59,
-    0xC5, 0xD8, 0x5F, 0xB7, 0x05, 0xAD, 0x81, 0xD7, 0x0F, 0x8A, 0xFA, 0x3A, 0xFD, 0xFC, 0x9F, 0x51,
-    0x38, 0x01, 0xBC, 0xA2, 0x01, 0x52, 0x4E, 0x29, 0xA2, 0x67, 0x75, 0xF2, 0x7C, 0x71, 0xB7, 0xC8,
-    0x70, 0x46, 0x8E, 0xC8, 0xFB, 0x95, 0x5C, 0x03, 0x2D, 0x3A, 0x5F, 0x88, 0xA6, 0x45, 0xD4, 0x63,
-    0xC9, 0x7B, 0xB7, 0xE8, 0x41, 0x46, 0xC6, 0x95, 0xD5, 0xAC, 0x11, 0xF6, 0xB9, 0x46, 0xA9, 0xE4,
-    0x92, 0x45, 0xFE, 0xBB, 0x10, 0xE1, 0x71, 0xC7, 0xEA, 0xA4, 0xB4, 0x3A, 0x69, 0xC7, 0xAB, 0x16,
-    0xBE, 0x22, 0x6B, 0x21, 0x69, 0x45, 0xBD, 0x82, 0x60, 0xE6, 0x01, 0x15, 0xC1, 0xA2, 0x9F, 0x98,
-    0xDE, 0x16, 0x96, 0x78, 0xB3, 0x9A, 0x12, 0xDF, 0xC4, 0xF0, 0xAB, 0x64, 0x4E, 0x31, 0x90, 0x39,
-    0x03, 0x7C, 0x5C, 0x3C, 0x1A, 0x68, 0x41, 0x0D, 0xEE, 0x25, 0x43, 0xDA, 0xD3, 0x12, 0x4D, 0x70,
-    0x2A, 0x14, 0x15, 0x38, 0x2F, 0xFA, 0xD7, 0xD9, 0x6D, 0x92, 0x5C, 0xDC, 0x0A, 0xB8, 0x82, 0x2B,
-    0xFF, 0x23, 0xB8, 0x9B, 0x21, 0x80, 0xF8, 0xF7, 0x20, 0x98, 0x6E, 0xA8, 0x66, 0xCF, 0x0D, 0x7D,
-    0x58, 0xBB, 0x05, 0x9D, 0x40, 0x46, 0xD7, 0x48, 0xEF, 0xD9, 0x27, 0x13, 0x62, 0x19, 0x4A, 0x5D,
-    0x87, 0x5E, 0x70, 0xFB, 0xEA, 0x9D, 0xEC, 0x9C, 0x01, 0x52, 0x7D, 0x71, 0xA1, 0x5E, 0x93, 0x0B,
-    0x09, 0x66, 0x92, 0x27, 0x15, 0x38, 0x16, 0x73, 0xC6, 0x78, 0xAD, 0xE1, 0xE0, 0xB9, 0x49, 0xCE,
-    0xA5, 0x3C, 0x85, 0x43, 0x28, 0x86, 0x02, 0x8B, 0xBC, 0x97, 0xBB, 0xCF, 0x7D, 0x2E, 0x1F, 0x63,
-    0x6C, 0x3C, 0xCD, 0xFA, 0xB4, 0x0D, 0xBE, 0xA8, 0x2D, 0x5D, 0x0B, 0x5A, 0x67, 0x88, 0xB1, 0xA3,
-    0x2E, 0x6A, 0x57, 0x75, 0xB1, 0x19, 0xE9, 0xA5, 0x97, 0x68, 0x88, 0xEB, 0x91, 0x48, 0xCC, 0x01,
-    0xD6, 0x5C, 0x40, 0xF8, 0x5C, 0xBB, 0x80, 0xD0, 0x81, 0x17, 0xF9, 0x2C, 0x96, 0x5A, 0x3E, 0xDA,
-    0x14, 0x7B, 0xA8, 0x66, 0x76, 0x69, 0x1A, 0x92, 0x8C, 0xBA, 0xA4, 0x40, 0xA4, 0x6C, 0x1A, 0xDA,
-    0x4A, 0xDF, 0x3A, 0x39, 0x39, 0xD9, 0x50, 0x89, 0x2B, 0x01, 0xF7, 0xB4, 0x4F, 0xB9, 0x6D, 0x52,
-    0x6A, 0x71, 0xF8, 0xA1, 0x47, 0x76, 0x77, 0x2D, 0x08, 0x5B, 0x46, 0x08, 0x6D, 0x84, 0x7E, 0x7B,
-    0x29, 0xE2, 0x44, 0xA6, 0x48, 0xD4, 0x4D, 0x3E, 0xD6, 0x05, 0x5F, 0x11, 0x79, 0x7A, 0x57, 0x24,
-    0xDF, 0xDB, 0xF6, 0xBC, 0x1B, 0x13, 0xA2, 0x71, 0x42, 0xF5, 0xCF, 0xC6, 0xB5, 0x47, 0xC4, 0x03,
-    0x53, 0x5A, 0xB6, 0x34, 0xAF, 0x88, 0xE5, 0xEA, 0xBD, 0x46, 0x16, 0x33, 0x34, 0x50, 0xCF, 0x76,
-    0x41, 0xF6, 0x27, 0xA6, 0xD8, 0x17, 0xFD, 0x7C, 0x5F, 0x66, 0x77, 0xAD, 0xB0, 0x42, 0xA0, 0xF9,
-    0x5C, 0xE8, 0xA9, 0x7C, 0x86, 0x13, 0xA1, 0x76, 0x64, 0x8F, 0x03, 0x69, 0x97, 0xB3, 0xF5, 0x7B,
-    0xEE, 0x9E, 0x16, 0x68, 0xCF, 0x4C, 0x9F, 0x2B, 0x1E, 0x1E, 0xD0, 0x4E, 0x33, 0x9A, 0x54, 0x24,
-    0xC9, 0x96, 0x05, 0x4C, 0x04, 0x99, 0x09, 0x27, 0xEF, 0x15, 0x7D, 0x36, 0xE1, 0xE0, 0xF6, 0x1E,
-    0x5D, 0xC2, 0x0A, 0x77, 0x74, 0xAC, 0x41, 0x17, 0x37, 0xD1, 0x08, 0xF1, 0xEA, 0x11, 0x02, 0x76,
-    0x78, 0xAD, 0xCF, 0xAA, 0xB4, 0x81, 0x32, 0x0F, 0x59, 0x5E, 0x54, 0xC4, 0x05, 0xD8, 0x05, 0x5D,
-    0x1D, 0x4A, 0xE7, 0x37, 0xD0, 0xEF, 0xBE, 0x84, 0x40, 0xAE, 0x3B, 0xD7, 0xC3, 0xDC, 0x70, 0x88,
-    0x0E, 0xD2, 0x0C, 0xD9, 0x0C, 0x5A, 0xE2, 0xA4, 0x8D, 0x5A, 0xDE, 0x4F, 0x21, 0x3F, 0xF7, 0xA0,
-    0xEF, 0xD0, 0xC8, 0xAA, 0x74, 0xE5, 0x4F, 0x3F, 0xEE, 0x33, 0x44, 0x95, 0x99, 0xFF, 0x0F, 0x1A,
-    0x2B, 0x06, 0x69, 0x10, 0xF1, 0x74, 0x5E, 0xE3, 0xB8, 0x9E, 0x43, 0x8C, 0xD9, 0x8D, 0x31, 0x54,
-    0x77, 0x8C, 0x7D, 0xC8, 0xB7, 0x90, 0xD9, 0xCC, 0x43, 0x73, 0xF9, 0x54, 0x46, 0x3D, 0x4B, 0xE5,
-    0x67, 0xF0, 0xB9, 0x32, 0x47, 0xED, 0xB3, 0xB8, 0x84, 0x16, 0xA8, 0x5B, 0x5C, 0x6C, 0x91, 0xF6,
-    0x1C, 0xC1, 0x9B, 0xB7, 0x8E, 0x0B, 0x05, 0xE8, 0x2E, 0x4D, 0x0C, 0x67, 0xF2, 0xC2, 0x48, 0x04,
-    0xB4, 0x3A, 0x70, 0x39, 0x6B, 0xC3, 0x83, 0x1C, 0xA4, 0x9C, 0x4F, 0xA5, 0x28, 0xCD, 0x3A, 0x66,
-    0x5A, 0x27, 0x59, 0xAE, 0xCD, 0x27, 0x82, 0xA5, 0xA5, 0x4C, 0x9D, 0xF7, 0x32, 0x10, 0x96, 0x1B,
-    0x2A, 0x86, 0x4A, 0x95, 0x9E, 0xF0, 0x91, 0x53, 0x9C, 0xAB, 0x01, 0x06, 0xF3, 0x87, 0xC1, 0x60,
-    0x82, 0x01, 0xBF, 0x0E, 0x8C, 0x08, 0x6C, 0x20, 0xA5, 0x88, 0xA6, 0xBD, 0xD2, 0xC6, 0x2D, 0x86,
-    0x78, 0xBF, 0x29, 0xC3, 0x27, 0x4B, 0xF3, 0xA0, 0xF4, 0x9C, 0x1F, 0xDC, 0x0D, 0x04, 0x0D, 0xAF,
-    0x01, 0x42, 0xCE, 0x9E, 0x08, 0xED, 0xE9, 0x8A, 0x2D, 0x9B, 0x43, 0xE6, 0x8F, 0xB3, 0xCD, 0x00,
-    0x91, 0xB8, 0x73, 0x8D, 0xB6, 0xB1, 0xB6, 0xAF, 0x63, 0x0A, 0x52, 0xBB, 0xB2, 0x27, 0x2C, 0x0C,
-    0x0E, 0xE7, 0xD0, 0xEE, 0xFB, 0x2E, 0x64, 0x63, 0x78, 0x8B, 0xFB, 0x37, 0x4D, 0xF3, 0x26, 0x51,
-    0x75, 0xBC, 0xA3, 0x92, 0x1F, 0x72, 0x6A, 0xF4, 0xAD, 0xC5, 0xC3, 0x97, 0x19, 0xB5, 0x55, 0x22,
-    0x80, 0x8A, 0x04, 0x33, 0x8A, 0xC5, 0xA3, 0x56, 0x65, 0x39, 0xE5, 0xF7, 0x77, 0x9D, 0x2D, 0x42,
-    0xD9, 0x9F, 0x43, 0x5B, 0x9E, 0xA7, 0xC1, 0xDD, 0x96, 0xF6, 0xAE, 0xF4, 0xC0, 0x78, 0x6C, 0x9C,
-    0x3D, 0xA6, 0x17, 0x0E, 0x61, 0xAD, 0x61, 0xBD, 0x41, 0xB6, 0xFF, 0x09, 0xD8, 0x9B, 0x88, 0x1E,
-    0x4C, 0xFB, 0x43, 0x2E, 0xE5, 0x4B, 0x32, 0x1C, 0x8F, 0x72, 0x63, 0xE8, 0x48, 0x8E, 0x3F, 0x38,
-    0x45, 0x2B, 0x4D, 0xAD, 0x93, 0xEA, 0xA3, 0x57, 0xA2, 0xC4, 0x0B, 0xC5, 0x62, 0x13, 0xE3, 0x20,
-    0xA2, 0x68, 0x41, 0xB5, 0x21, 0xB2, 0xD9, 0x85, 0x17, 0xA0, 0x68, 0x41, 0xF5, 0xCE, 0xEB, 0x73,
-    0x67, 0xB6, 0x86, 0xA4, 0x9C, 0x28, 0x9D, 0x9C, 0x71, 0xDC, 0x68, 0x69, 0xD1, 0xEA, 0xFE, 0x21,
-    0xA6, 0x33, 0xD3, 0x39, 0x73, 0x9A, 0xB6, 0xCE, 0xCB, 0x3C, 0x7A, 0x24, 0xEB, 0x0F, 0x4E, 0x18,
-    0x5F, 0x82, 0x56, 0xF5, 0x17, 0xEF, 0xC0, 0x75, 0x65, 0x46, 0xF6, 0x49, 0x50, 0x56, 0x46, 0xE2,
-    0xB4, 0xC0, 0xE6, 0x29, 0x2D, 0x1F, 0x87, 0x41, 0xA7, 0x89, 0x19, 0x94, 0x2E, 0x30, 0x20, 0xBB,
-    0x7F, 0x70, 0x53, 0xC1, 0xA7, 0x9F, 0xE1, 0xB3, 0xA0, 0xD0, 0xE0, 0xFD, 0x83, 0xFD, 0xCF, 0xD1,
-    0x59, 0x7F, 0x29, 0x3A, 0x17, 0x28, 0xFB, 0x2B, 0x95, 0x12, 0xFB, 0xDA, 0x05, 0x6E, 0x3F, 0x87,
-    0xDE, 0x42, 0x5C, 0xAF, 0xFC, 0x79, 0x3A, 0xF0, 0x83, 0x78, 0x91, 0x8E, 0x8A, 0x8C, 0x61, 0x14,
-    0x28, 0x54, 0x6B, 0xA5, 0x9F, 0x34, 0xD0, 0x14, 0xB7, 0x60, 0x91, 0x3A, 0x19, 0xF1, 0xAD, 0x3C,
-    0xCE, 0x22, 0xFA, 0x7F, 0xD1, 0xE5, 0x93, 0x93, 0x63, 0xCF, 0x4C, 0xDD, 0x37, 0x68, 0xC9, 0x50,
-    0x8F, 0x2F, 0x64, 0xA3, 0x24, 0x58, 0x39, 0x8F, 0x10, 0x65, 0x18, 0x88, 0xE3, 0x01, 0xD1, 0x53,
-    0x64, 0x83, 0xE8, 0xB7, 0x6C, 0x3E, 0x67, 0xEB, 0xD8, 0xCC, 0x0B, 0x5C, 0xCF, 0x24, 0x73, 0x77,
-    0x60, 0x4E, 0x30, 0x2F, 0x8D, 0xDD, 0xFA, 0x71, 0xB2, 0xD7, 0xF0, 0xE3, 0xAB, 0xB4, 0x29, 0x81,
-    0x70, 0xF5, 0x0D, 0xB0, 0x39, 0xE1, 0x73, 0xFC, 0x4D, 0xFB, 0x33, 0xBC, 0xD0, 0xB7, 0x92, 0x4D,
-    0x93, 0x9D, 0xDB, 0xEC, 0xFE, 0x4A, 0xF3, 0xED, 0xD5, 0x6A, 0x9E, 0x4B, 0xF0, 0x0C, 0x7F, 0xEC,
-    0xCF, 0xEC, 0xAC, 0x8D, 0xC1, 0x54, 0x29, 0xA6, 0xC5, 0x2E, 0xA0, 0x60, 0x89, 0x55, 0x4E, 0xBE,
-    0xDD, 0xDF, 0xE8, 0x96, 0x05, 0x97, 0x14, 0x49, 0xD7, 0xE1, 0x96, 0xF1, 0x68, 0x56, 0xF1, 0xB7,
-    0xBC, 0xAF, 0xBD, 0x21, 0x52, 0x5A, 0x4C, 0x39, 0x89, 0x4E, 0x5B, 0xB3, 0x4F, 0x95, 0x19, 0x0A,
-    0x89, 0x39, 0x9D, 0x08, 0x4D, 0x7D, 0x27, 0x14, 0x5B, 0x8A, 0x9A, 0xE5, 0xCE, 0x92, 0x0D, 0xA2,
-    0xF7, 0x0D, 0xFD, 0xD2, 0xCF, 0x5A, 0x5F, 0x19, 0x52, 0xCB, 0x5F, 0x53, 0x1D, 0xC0, 0x13, 0xC9,
-    0x15, 0x92, 0x06, 0x0B, 0x7E, 0x32, 0x6F, 0x9D, 0x29, 0xBC, 0x85, 0xA7, 0xD1, 0x78, 0xB4, 0xA9,
-    0x81, 0x19, 0x49, 0xD2, 0xE2, 0xA9, 0x23, 0x2D, 0x73, 0x39, 0x76, 0x99, 0xF8, 0x9E, 0x28, 0x28,
-    0xFB, 0x52, 0x03, 0xD8, 0x30, 0x96, 0x46, 0x84, 0xB3, 0x75, 0xF9, 0x96, 0xE0, 0xBE, 0x60, 0x77,
-    0x0E, 0x83, 0x56, 0x8B, 0xDC, 0x4A, 0xC4, 0xDA, 0xD5, 0x13, 0xEC, 0x93, 0xFC, 0x2D, 0x26, 0x6D,
-    0xE6, 0xDF, 0x37, 0x6B, 0xCB, 0x79, 0x46, 0x96, 0xC8, 0x2C, 0x48, 0x50, 0x60, 0x9D, 0x70, 0xC6,
-    0x9F, 0x32, 0xCD, 0x2B, 0x75, 0x51, 0xB9, 0x1B, 0xBC, 0xF8, 0x04, 0xAC, 0x3B, 0xE2, 0x45, 0x87,
-    0x01, 0xCE, 0x74, 0x01, 0xD0, 0xEB, 0xA2, 0xE8, 0x82, 0x56, 0x17, 0x59, 0x1F, 0xDA, 0x45, 0x3A,
-    0x44, 0x8D, 0x2E, 0x92, 0x71, 0x55, 0xEB, 0x22, 0xF6, 0xEB, 0x4A, 0x17, 0x6B, 0x1F, 0x6F, 0x74,
-    0xB1, 0xF2, 0x37, 0x73, 0x5D, 0x44, 0xFE, 0x23, 0xA7, 0x8B, 0x10, 0x14, 0xE9, 0x82, 0x05, 0x42,
-    0x5D, 0x38, 0xC8, 0xA7, 0x5D, 0xC0, 0x7E, 0xD8, 0x05, 0xCB, 0x6F, 0x2D, 0x03, 0xA3, 0x4C, 0x55,
-    0x37, 0x84, 0x66, 0x29, 0x7C, 0xCD, 0x00, 0xE6, 0xB3, 0x8E, 0xA7, 0x09, 0xD6, 0x71, 0xC5, 0x0B,
-    0x2B, 0x4E, 0x4C, 0x5E, 0xCE, 0xC6, 0x2B, 0x1A, 0x2A, 0x10, 0x23, 0x80, 0x0F, 0xE9, 0x46, 0x25,
-    0x48, 0x26, 0x17, 0x7E, 0x46, 0x15, 0x11, 0x0B, 0x86, 0x40, 0x1D, 0x78, 0x41, 0x04, 0xF3, 0x43,
-    0x04, 0x17, 0x45, 0x04, 0x97, 0x48, 0xB4, 0x52, 0x52, 0x02, 0x5A, 0x5B, 0x22, 0x18, 0x3B, 0xA1,
-    0x6C, 0x10, 0x4A, 0xBC, 0xD0, 0xDA, 0xFF, 0x0B, 0x11, 0x26, 0x46, 0x44, 0xB6, 0xB2, 0x44, 0x5E,
-    0x1A, 0xCA, 0x0C, 0xA1, 0x3B, 0x46, 0x77, 0x08, 0x89, 0x56, 0x8A, 0x88, 0x72, 0x33, 0xD5, 0x86,
-    0x8A, 0x7C, 0x27, 0xE4, 0xAE, 0x2D, 0xC8, 0x52, 0xCE, 0xF1, 0xF0, 0xAF, 0x65, 0x46, 0x2A, 0xF2,
-    0x80, 0xC1, 0x3C, 0x0B, 0x8D, 0x78, 0x10, 0xAB, 0x1C, 0x88, 0xCE, 0xA4, 0x5D, 0x78, 0x50, 0x58,
-    0x94, 0x55, 0xF6, 0xBB, 0x88, 0x82, 0x09, 0xF3, 0x73, 0x11, 0x2A, 0xBB, 0xDD, 0x17, 0x0A, 0x43,
-    0xD6, 0xE7, 0x26, 0x55, 0x04, 0xB7, 0x8C, 0xC7, 0x60, 0x11, 0x77, 0x68, 0xD6, 0x98, 0x00, 0xF9,
-    0x6E, 0x8F, 0x84, 0xA6, 0x0A, 0x3B, 0x28, 0x52, 0x1F, 0xBA, 0x39, 0xF0, 0xA0, 0x66, 0xFF, 0xF7,
-    0x79, 0x24, 0x77, 0x7F, 0x89, 0xE4, 0x2A, 0x45, 0x6C, 0x16, 0x8A, 0xB5, 0xE7, 0xD1, 0xD8, 0x53,
-    0x60, 0x30, 0xC7, 0x76, 0x95, 0x74, 0x13, 0x2B, 0x76, 0xBF, 0x1C, 0xCF, 0x63, 0xBB, 0x7F, 0xFD,
-    0x72, 0xAA, 0xB3, 0xB8, 0xC6, 0xF6, 0x29, 0xAE, 0xF1, 0xD9, 0x30, 0xBB, 0xFB, 0x76, 0x99, 0xDD,
-    0xEE, 0x32, 0xDB, 0xAC, 0x9C, 0x05, 0xFC, 0x56, 0x67, 0xB2, 0x92, 0xCC, 0x16, 0x59, 0x0C, 0x3F,
-    0xCF, 0x7C, 0xEB, 0xA2, 0x33, 0xBF, 0x6F, 0x6D, 0xEC, 0xCF, 0xC3, 0xEE, 0x73, 0xE1, 0xE1, 0x35,
-    0x7F, 0xFF, 0x94, 0x31, 0xA5, 0x6F, 0xA2, 0xD9, 0x7D, 0xC8, 0x0E, 0x36, 0xCE, 0x82, 0x68, 0x6A,
-    0xE3, 0x13, 0x50, 0xB7, 0xD3, 0x72, 0x76, 0x3B, 0x2B, 0x2B, 0x16, 0xF8, 0xD1, 0xCD, 0x8B, 0xC5,
-    0x00, 0x67, 0x36, 0xBF, 0x85, 0xCC, 0x6F, 0x93, 0xE9, 0x59, 0x93, 0xC8, 0xFC, 0x36, 0x66, 0x7E,
-    0x9B, 0x95, 0x79, 0xCD, 0x68, 0x19, 0xD6, 0xCC, 0x6F, 0x39, 0x68, 0xF1, 0xCC, 0xFC, 0x6E, 0x62,
-    0xD9, 0xB6, 0x4D, 0x50, 0xB6, 0x4B, 0xA5, 0xA4, 0xD7, 0x04, 0x36, 0xD1, 0xF4, 0x02, 0x3A, 0x62,
-    0x29, 0x28, 0x65, 0x11, 0x82, 0x45, 0x0D, 0x81, 0x0A, 0x39, 0xF0, 0x6F, 0xCD, 0xB9, 0xA4, 0xB2,
-    0x5E, 0x2F, 0x3D, 0xC4, 0x65, 0xA4, 0x18, 0xA3, 0x34, 0xFB, 0xA7, 0x00, 0x82, 0x34, 0xAE, 0x95,
-    0xD7, 0xF8, 0x21, 0x20, 0xF3, 0xD3, 0x9C, 0x45, 0x12, 0x80, 0x01, 0xE9, 0xF3, 0x9A, 0x20, 0xEE,
-    0xB1, 0x16, 0x69, 0x0B, 0xFA, 0xCB, 0x9A, 0x51, 0xCA, 0x1C, 0x6D, 0x53, 0xE6, 0x0B, 0xCB, 0x13,
-    0x84, 0xBC, 0x2B, 0x1E, 0x94, 0xD3, 0x09, 0x32, 0x1A, 0xD5, 0xEB, 0x91, 0xA8, 0x0B, 0x9D, 0x11,
-    0xA5, 0x0B, 0x7A, 0x85, 0xE8, 0xB2, 0xD3, 0x2A, 0xBB, 0xDF, 0x08, 0xCA, 0x2C, 0xF9, 0x53, 0x15,
-    0x8F, 0x93, 0x1E, 0xB6, 0xA8, 0xA0, 0x29, 0xF5, 0x23, 0x10, 0x16, 0x65, 0x5C, 0xA9, 0xEA, 0x6D,
-    0x39, 0x5F, 0xE6, 0xFE, 0xBF, 0x50, 0x69, 0x1B, 0x56, 0xD4, 0x34, 0x86, 0x10, 0x93, 0x0B, 0x15,
-    0x1A, 0xDE, 0x3F, 0x6C, 0x2D, 0x31, 0xAE, 0x14, 0xD7, 0xDA, 0x94, 0x0E, 0x4C, 0xBB, 0xB9, 0x5F,
-    0x24, 0xEE, 0xC3, 0x52, 0x63, 0x5D, 0x42, 0x6F, 0x45, 0x68, 0x25, 0x1A, 0x2E, 0x30, 0x91, 0xA5,
-    0x05, 0xF6, 0xDA, 0x0E, 0xE0, 0x08, 0x51, 0xA3, 0xC8, 0x84, 0xDB, 0x76, 0x8C, 0x4A, 0x2B, 0xC5,
-    0x2B, 0xF1, 0xC6, 0x34, 0x3E, 0x57, 0xB2, 0x95, 0x59, 0x55, 0xF7, 0xB6, 0x34, 0x6B, 0x73, 0xD7,
-    0x14, 0x6C, 0x90, 0x12, 0xFE, 0xD4, 0x92, 0xB9, 0xFF, 0x92, 0x34, 0xFA, 0x8F, 0x85, 0x8A, 0x4F,
-    0xA5, 0x76, 0xD9, 0x67, 0x95, 0x25, 0xEE, 0x95, 0x31, 0x3B, 0xDF, 0xA6, 0x6E, 0x52, 0x72, 0x25,
-    0xEB, 0x46, 0xBB, 0xCA, 0x88, 0xAA, 0x67, 0xDC, 0x61, 0x4A, 0x29, 0x71, 0x0E, 0x18, 0x21, 0x7B,
-    0x49, 0x2B, 0xEB, 0x1A, 0xDA, 0xF9, 0xAA, 0x55, 0x44, 0x4C, 0xAB, 0x39, 0x9C, 0xA4, 0x4B, 0xD3,
-    0x84, 0x98, 0x61, 0x93, 0x54, 0x4C, 0x2A, 0xC6, 0x68, 0x99, 0x15, 0xB0, 0x93, 0xF9, 0x12, 0x8A,
-    0x9A, 0xA2, 0xD1, 0x6D, 0x4B, 0x25, 0xB9, 0x9F, 0x76, 0xD7, 0xF2, 0xC9, 0x1B, 0x98, 0xFD, 0x60,
-    0x49, 0xE5, 0xAB, 0x59, 0xAF, 0x4B, 0x84, 0x6C, 0x43, 0x36, 0xD0, 0x53, 0x91, 0xD2, 0x21, 0x19,
-    0x43, 0xD5, 0xB4, 0x3C, 0x1C, 0xE1, 0xA4, 0x8D, 0x9B, 0x95, 0x7F, 0xAD, 0x8D, 0x3D, 0x79, 0x06,
-    0x22, 0xDE, 0x46, 0xC8, 0xF1, 0xA2, 0xAA, 0x04, 0xFE, 0x3F, 0xA1, 0xB5, 0xDF, 0x57, 0x65, 0xCB,
-    0xFF, 0x12, 0x06, 0xFE, 0x5D, 0xCD, 0xD9, 0x7F, 0x04, 0xC3, 0xFD, 0x81, 0x2C, 0x92, 0x57, 0x76,
-    0x97, 0x5B, 0xE6, 0xCC, 0xDD, 0x8D, 0xAD, 0x1C, 0x9A, 0x2C, 0x72, 0x75, 0xF5, 0x9B, 0x93, 0x5C,
-    0x4B, 0x74, 0x55, 0x0C, 0x8A, 0x4D, 0x74, 0xE3, 0xE5, 0x32, 0x95, 0xA4, 0xB2, 0x40, 0xDB, 0xA4,
-    0xBE, 0xDD, 0x43, 0x86, 0xB0, 0x42, 0x28, 0x49, 0xC7, 0x60, 0x42, 0xC2, 0xF8, 0x10, 0x76, 0x85,
-    0x05, 0x26, 0xF8, 0x9B, 0x58, 0xB5, 0xFF, 0x26, 0xD3, 0x6A, 0xB5, 0xB7, 0x45, 0xC0, 0x60, 0x19,
-    0xB5, 0x39, 0x81, 0xC4, 0x0A, 0x28, 0xB1, 0x2D, 0x53, 0x64, 0x7F, 0xCD, 0x55, 0x94, 0xD8, 0xDB,
-    0xAE, 0x66, 0x21, 0x6A, 0xEE, 0xA6, 0xF2, 0x72, 0x3D, 0xAD, 0x15, 0x72, 0x24, 0x35, 0x8D, 0xAB,
-    0x50, 0xC2, 0x9A, 0x6B, 0x3F, 0xB2, 0xC4, 0x74, 0x66, 0x3A, 0xBC, 0xD6, 0xB8, 0x80, 0xBD, 0xF7,
-    0xE0, 0x92, 0x1F, 0x66, 0xE4, 0x95, 0xC4, 0xB4, 0x16, 0xFB, 0x43, 0x44, 0x1F, 0xD2, 0x95, 0xD0,
-    0xE0, 0x85, 0xA3, 0xF6, 0x5A, 0x28, 0xE1, 0x94, 0xCD, 0x4E, 0xEB, 0x46, 0x96, 0x63, 0xA1, 0xD6,
-    0x14, 0xCA, 0xC9, 0x84, 0xD2, 0x73, 0xC7, 0x8A, 0x76, 0xFE, 0x86, 0x89, 0xE1, 0x99, 0xF9, 0x39,
-    0x13, 0xC3, 0x5F, 0x99, 0xFC, 0x7D, 0x66, 0xF2, 0xB7, 0x08, 0xDE, 0x66, 0x47, 0xF0, 0xBE, 0x3C,
-    0x32, 0xB9, 0x8D, 0xCD, 0xB5, 0x1B, 0x62, 0x79, 0xC1, 0xD7, 0xF4, 0xF6, 0x60, 0xFD, 0xA3, 0x93,
-    0x53, 0x5C, 0xC3, 0x20, 0xC2, 0x6D, 0x41, 0xFC, 0x44, 0x17, 0xCC, 0x4B, 0x4A, 0xDB, 0x09, 0x18,
-    0x88, 0x83, 0x56, 0x95, 0x5A, 0xAB, 0x2B, 0xD3, 0x00, 0x5B, 0xE3, 0x72, 0xD8, 0xFA, 0xA5, 0xC8,
-    0xB7, 0xCB, 0xDE, 0x8B, 0x8B, 0xAD, 0x7E, 0x29, 0x02, 0x8C, 0xE7, 0x74, 0x3D, 0x77, 0xC4, 0x98,
-    0x2E, 0x52, 0x42, 0xCE, 0x75, 0x8A, 0x3A, 0xFA, 0x8D, 0x55, 0x87, 0x34, 0xF6, 0xE0, 0xB0, 0x95,
-    0xBD, 0x9D, 0xE1, 0xF3, 0x27, 0x6F, 0x14, 0x7E, 0x28, 0xFC, 0x0F, 0x20, 0xE9, 0x85, 0x76, 0x6D,
-    0x9F, 0xCD, 0xB7, 0xD7, 0x17, 0xB9, 0xA9, 0x1F, 0x32, 0x3F, 0xBC, 0xA2, 0xBA, 0xD6, 0x99, 0xF6,
-    0x0C, 0x6F, 0x58, 0xED, 0x8B, 0x01, 0x25, 0x17, 0x08, 0xE2, 0x86, 0xD5, 0x5A, 0xD5, 0x34, 0x2B,
-    0x58, 0xBD, 0x50, 0xD1, 0x2B, 0x8F, 0x0A, 0x7C, 0xE5, 0x17, 0xEE, 0xDC, 0x3A, 0xB9, 0x53, 0xFA,
-    0xE1, 0x6F, 0x98, 0xAC, 0x0D, 0x73, 0xFA, 0xFC, 0xEC, 0xBE, 0x01, 0x25, 0x72, 0x50, 0x91, 0xFF,
-    0xEF, 0x9C, 0xD5, 0xE9, 0x24, 0xB7, 0xB6, 0x45, 0xA6, 0x8A, 0x71, 0xFC, 0x2E, 0xBD, 0xE5, 0x5F,
-    0x60, 0x5D, 0x32, 0xEA, 0xFB, 0x0D, 0x9D, 0xF5, 0x20, 0x65, 0x34, 0x15, 0xF8, 0xE3, 0x36, 0xE9,
-    0xCD, 0x68, 0x38, 0x93, 0x9C, 0xDB, 0xA9, 0x55, 0xCA, 0xF3, 0x1D, 0xD9, 0xBC, 0xC3, 0xBB, 0xBB,
-    0xA1, 0x72, 0xE5, 0xE0, 0xE0, 0x60, 0xFF, 0xD6, 0x1D, 0x3A, 0xA1, 0xF5, 0xA4, 0x52, 0x6D, 0x51,
-    0xA9, 0xF4, 0xB9, 0xEF, 0x2E, 0x9D, 0xA8, 0x36, 0x4D, 0x23, 0x8E, 0xC0, 0x59, 0xB1, 0x3B, 0x63,
-    0xAF, 0xF5, 0xC8, 0xB2, 0x23, 0x62, 0x64, 0x0A, 0xC7, 0x1B, 0x56, 0x7A, 0xDC, 0x81, 0x57, 0xE9,
-    0xA9, 0x43, 0x85, 0x71, 0xB1, 0x3F, 0x06, 0x84, 0xB9, 0xF0, 0x2A, 0x5A, 0x00, 0x62, 0xA5, 0xB6,
-    0x30, 0xEB, 0x03, 0xDD, 0xA7, 0x90, 0xA5, 0xD3, 0x4D, 0xA8, 0x54, 0xCC, 0x15, 0x44, 0x8A, 0xD9,
-    0x72, 0x6B, 0xEE, 0x0A, 0x3B, 0x7C, 0xFE, 0x64, 0x23, 0x53, 0x54, 0x4B, 0xF4, 0xEA, 0x6D, 0x4D,
-    0xF5, 0x82, 0x82, 0xCB, 0xD5, 0x1C, 0xF0, 0x3D, 0x95, 0x50, 0x3E, 0x60, 0x9C, 0xEF, 0xA7, 0x17,
-    0x19, 0xA3, 0xF6, 0x0A, 0x81, 0x5A, 0xC5, 0xAE, 0xC8, 0x53, 0x94, 0x9C, 0x15, 0xDD, 0x02, 0x6B,
-    0x51, 0xB3, 0x0B, 0x1B, 0xD5, 0x1F, 0x77, 0xDB, 0xD8, 0x5B, 0x9D, 0x7A, 0x18, 0x42, 0x66, 0xC4,
-    0xA7, 0x3F, 0x42, 0x90, 0xE8, 0xFF, 0x52, 0x2E, 0x2D, 0x34, 0x73, 0x44, 0xAA, 0x83, 0x13, 0x6D,
-    0xCC, 0x59, 0x34, 0xBC, 0x59, 0xF9, 0x00, 0x96, 0x6E, 0x72, 0x30, 0x8C, 0x48, 0x9D, 0x2A, 0xF0,
-    0xB9, 0xCC, 0x61, 0xD1, 0x5F, 0xD2, 0x41, 0x89, 0x0B, 0xC0, 0xB0, 0x44, 0x06, 0xB0, 0xFB, 0x41,
-    0x85, 0x50, 0x72, 0x85, 0x60, 0xFB, 0x3E, 0xA2, 0x1C, 0x6F, 0x41, 0xD1, 0x76, 0x0B, 0x28, 0x3C,
-    0x79, 0x53, 0x62, 0x41, 0xE5, 0x0D, 0xED, 0x8C, 0x48, 0x22, 0x18, 0x3F, 0x11, 0xEE, 0xFD, 0x20,
-    0xD6, 0x21, 0x8F, 0x98, 0x7B, 0x80, 0xFE, 0x03, 0x86, 0xB2, 0xFF, 0x8C, 0x77, 0xF1, 0x27, 0x37,
-    0x02, 0x07, 0x1A, 0x01, 0x16, 0x82, 0x26, 0x92, 0x91, 0xEC, 0x40, 0x36, 0xD8, 0x81, 0xD9, 0x02,
-    0xCF, 0xDB, 0xE8, 0x2D, 0xEB, 0x21, 0x66, 0xB9, 0x18, 0x3D, 0xFF, 0xFC, 0x33, 0xAE, 0xA7, 0x7F,
-    0x9B, 0x47, 0x3D, 0xA6, 0x88, 0x06, 0x43, 0x61, 0x6E, 0x70, 0x4B, 0x1C, 0xB2, 0xE8, 0x30, 0xD7,
-    0x3E, 0x1A, 0xB7, 0xB7, 0xB8, 0xA1, 0x84, 0x10, 0x71, 0xB0, 0x8D, 0x29, 0x03, 0x03, 0xA5, 0x74,
-    0x06, 0x0F, 0x0F, 0x0E, 0x5E, 0x7A, 0x12, 0x87, 0x38, 0xA1, 0x16, 0x66, 0x97, 0x65, 0xC0, 0x87,
-    0x87, 0x8D, 0xA5, 0xFD, 0x89, 0x82, 0x0F, 0x55, 0xE4, 0x0F, 0x1F, 0x2A, 0xC1, 0x86, 0x32, 0x8C,
-    0xDA, 0xFA, 0x42, 0x10, 0x5A, 0xB4, 0x2C, 0xCC, 0xB6, 0x97, 0xE6, 0x9D, 0x64, 0xBF, 0x80, 0x8C,
-    0x01, 0x97, 0xC0, 0x15, 0xFF, 0xC9, 0x4B, 0x3B, 0x0F, 0xBE, 0x09, 0x90, 0x6C, 0x14, 0xCC, 0xB6,
-    0x8A, 0x65, 0xA3, 0xFE, 0x16, 0x98, 0xF0, 0xE6, 0x0B, 0xDA, 0xCB, 0xF3, 0x3C, 0x28, 0xF2, 0x91,
-    0xBF, 0xB9, 0x59, 0x4D, 0x81, 0xFF, 0x73, 0xFA, 0x51, 0x50, 0x0F, 0x58, 0xD6, 0x74, 0xB1, 0x65,
-    0x33, 0x43, 0xBB, 0x63, 0x4F, 0xA9, 0x82, 0x8C, 0x34, 0x7E, 0xE8, 0xA5, 0xA0, 0x16, 0x3F, 0x1F,
-    0xF3, 0xC4, 0x91, 0xFC, 0xA4, 0x86, 0xB0, 0x43, 0x3F, 0xDA, 0x4C, 0x56, 0x40, 0xD6, 0x4A, 0x1C,
-    0x07, 0xA6, 0x54, 0x9E, 0xC7, 0x58, 0x4E, 0x20, 0x2A, 0x05, 0x42, 0x95, 0x89, 0x7B, 0xA1, 0x88,
-    0x5D, 0x18, 0x74, 0x8F, 0x82, 0x36, 0x34, 0x52, 0xE8, 0xE9, 0xAF, 0x14, 0xC0, 0x28, 0x36, 0xF8,
-    0xDB, 0xE9, 0x78, 0x51, 0xC7, 0x59, 0x1F, 0x67, 0x85, 0x5C, 0x76, 0x39, 0x82, 0x8B, 0xD1, 0xD5,
-    0x7D, 0x37, 0xEB, 0xA5, 0x29, 0xA6, 0xD2, 0x8F, 0x53, 0xE5, 0x16, 0xBD, 0xE5, 0x16, 0xAD, 0x15,
-    0x0A, 0x55, 0xD0, 0xB5, 0xE4, 0xF2, 0x1C, 0xD5, 0x5F, 0x13, 0x35, 0x56, 0xE8, 0x93, 0xF6, 0x62,
-    0x55, 0xBF, 0x2B, 0x55, 0x15, 0x72, 0xB7, 0x73, 0x37, 0xD7, 0xC7, 0x2D, 0x17, 0xA3, 0x93, 0xFB,
-    0xBD, 0xC7, 0x77, 0xD7, 0x38, 0xCF, 0xC2, 0xAA, 0xE6, 0x2E, 0xF8, 0x5A, 0x3F, 0xAB, 0xF0, 0x61,
-    0xC8, 0x0D, 0x7F, 0x2E, 0x39, 0x56, 0xB5, 0xA4, 0xE7, 0x17, 0xF9, 0xCF, 0xCE, 0xAE, 0x27, 0x62,
-    0x49, 0x86, 0x93, 0xFE, 0x9B, 0xF9, 0xC2, 0x92, 0xF6, 0x0D, 0xFC, 0xBB, 0x89, 0x7C, 0x6C, 0x64,
-    0x11, 0xEF, 0x6B, 0xD8, 0x4F, 0x37, 0xD7, 0xDE, 0x7A, 0xC1, 0x4E, 0x39, 0x3E, 0xB7, 0x1E, 0xA2,
-    0x5E, 0xC5, 0xB8, 0x46, 0x4F, 0x55, 0x91, 0x2B, 0xB5, 0xA2, 0xE3, 0x52, 0xD5, 0x0B, 0x20, 0xC4,
-    0xF9, 0x5C, 0xDA, 0x0B, 0xFC, 0x23, 0x4B, 0x14, 0xAD, 0x5C, 0x5E, 0x68, 0x2B, 0x23, 0xF5, 0x73,
-    0x39, 0x4F, 0xE9, 0x24, 0x2B, 0x8A, 0xA1, 0xEF, 0x0A, 0x55, 0x59, 0x09, 0xD7, 0x9E, 0xD4, 0x92,
-    0xD6, 0x54, 0xEB, 0xF2, 0x75, 0x79, 0xFE, 0x15, 0xD7, 0x04, 0x1E, 0xEB, 0xD8, 0x5D, 0xE5, 0x66,
-    0xB1, 0x7F, 0xCB, 0x8F, 0x11, 0x05, 0x34, 0xF3, 0xEF, 0x78, 0x99, 0x75, 0xFA, 0xB1, 0xD3, 0xAD,
-    0x98, 0x46, 0x5B, 0x49, 0x0D, 0x29, 0xAC, 0xBA, 0x42, 0x77, 0x5B, 0x79, 0xDD, 0x91, 0xD5, 0x6F,
-    0xE7, 0x6A, 0x19, 0xC3, 0x04, 0xFA, 0x5C, 0xA6, 0x83, 0xAD, 0x58, 0xAB, 0x7C, 0x86, 0x19, 0xED,
-    0xDB, 0x74, 0x96, 0xB9, 0x28, 0x25, 0xB3, 0x59, 0x0C, 0xD1, 0x32, 0x85, 0x99, 0xFE, 0xDF, 0x88,
-    0xB2, 0x05, 0xB7, 0xF6, 0xDD, 0x7C, 0x0C, 0xD4, 0x04, 0x84, 0xE7, 0x92, 0x5A, 0xA5, 0x71, 0x03,
-    0xED, 0x9B, 0x1D, 0xE7, 0x8B, 0xA7, 0x79, 0xF3, 0x01, 0xF6, 0x7D, 0xFD, 0x85, 0x50, 0x2D, 0xED,
-    0x2D, 0xBC, 0xAE, 0xB3, 0x08, 0x7C, 0xA4, 0x1D, 0x70, 0x95, 0x0E, 0x2A, 0x56, 0x20, 0xC6, 0xC5,
-    0x2B, 0x9B, 0x33, 0xC8, 0xFC, 0x0B, 0xDC, 0x2C, 0xF7, 0xFF, 0xA4, 0xF3, 0x1B, 0xFE, 0x65, 0xBF,
-    0x81, 0x71, 0x9E, 0x37, 0xBA, 0x6C, 0x02, 0x5A, 0x53, 0xB9, 0xFA, 0x7A, 0x0E, 0x0D, 0x2E, 0x82,
-    0xCD, 0x1C, 0x4A, 0xD8, 0x72, 0xB0, 0x07, 0xEB, 0x6D, 0xD2, 0xB6, 0xE3, 0x07, 0xAA, 0x41, 0xBC,
-    0xA5, 0x1A, 0x4D, 0x7D, 0x25, 0xFF, 0x82, 0x1D, 0xA2, 0x6B, 0xFE, 0x61, 0xBE, 0x10, 0x7E, 0xEB,
-    0x44, 0xC1, 0x97, 0x9D, 0xC6, 0x29, 0x7D, 0xC4, 0x75, 0xF3, 0xEF, 0xF3, 0x98, 0x06, 0x5D, 0xEA,
-    0x33, 0x73, 0xD6, 0xE3, 0xE2, 0xAC, 0x19, 0x06, 0xFC, 0xDC, 0xEB, 0xA8, 0xE6, 0xBB, 0xDC, 0x21,
-    0x9D, 0xE8, 0x53, 0x83, 0xFD, 0xF8, 0x82, 0x40, 0x62, 0xDE, 0x4D, 0xBE, 0x54, 0xFA, 0x9F, 0x2D,
-    0x85, 0x8A, 0xCB, 0x27, 0x27, 0x3C, 0xA1, 0x77, 0x35, 0xCF, 0xFC, 0x6B, 0x8C, 0xE2, 0xDE, 0x21,
-    0xD9, 0xEF, 0x7A, 0x44, 0xB4, 0x63, 0x02, 0xD0, 0xC7, 0x0C, 0xF9, 0xD6, 0x62, 0xB6, 0x15, 0x00,
-    0x67, 0x50, 0x7F, 0x31, 0x68, 0xE6, 0x1D, 0xB4, 0xCC, 0xCB, 0x28, 0xF3, 0xE6, 0xDE, 0x1D, 0x92,
-    0x5B, 0xC7, 0x53, 0xD9, 0x65, 0xCD, 0x7A, 0xC8, 0xAA, 0x68, 0x28, 0xAA, 0xB0, 0x2B, 0x9A, 0x20,
-    0x2F, 0x94, 0xE6, 0x35, 0xCC, 0x47, 0x79, 0x94, 0x0A, 0x3A, 0x8A, 0x35, 0x50, 0x44, 0x50, 0x4E,
-    0xBF, 0x8D, 0xA9, 0x22, 0x3E, 0xF6, 0xA5, 0x0B, 0xA7, 0x32, 0x8F, 0xC6, 0xA2, 0x5E, 0xF7, 0xE8,
-    0x95, 0x29, 0x20, 0xA2, 0xCE, 0x7D, 0xA7, 0x94, 0x8E, 0x3B, 0x18, 0x69, 0xAD, 0x13, 0x43, 0xDA,
-    0x14, 0xB5, 0x53, 0x47, 0xED, 0x73, 0xFE, 0xFE, 0xFE, 0xD7, 0xB1, 0x3A, 0x0A, 0x03, 0xFC, 0xF4,
-    0x6F, 0xA0, 0xBC, 0x53, 0x41, 0xDF, 0xBD, 0xB4, 0x58, 0xFE, 0x8C, 0x66, 0xB6, 0x5E, 0x50, 0xA4,
-    0xED, 0x72, 0x67, 0x95, 0xD8, 0x6F, 0xA0, 0x8B, 0x0B, 0x9A, 0x8D, 0x53, 0x64, 0x34, 0x18, 0xEA,
-    0x62, 0x3B, 0xA6, 0x38, 0x59, 0xC0, 0xD3, 0x53, 0x41, 0xD7, 0x4C, 0x86, 0xDD, 0x0E, 0x59, 0x0C,
-    0xCD, 0xA6, 0xB5, 0xEF, 0xD1, 0x6C, 0x45, 0xB1, 0xAB, 0x5C, 0xC1, 0xC3, 0x75, 0x3C, 0xAC, 0xCC,
-    0x1D, 0x08, 0xCD, 0xEA, 0x4C, 0xF3, 0x1A, 0x14, 0x43, 0x31, 0xC2, 0xE9, 0x42, 0xE5, 0xC4, 0xCC,
-    0x31, 0xD2, 0x21, 0x62, 0x06, 0x3E, 0x89, 0x97, 0x9E, 0xD9, 0xF1, 0xCA, 0xC7, 0x3A, 0x0E, 0x77,
-    0x2A, 0x79, 0xB7, 0x32, 0xA9, 0xA5, 0x91, 0x3B, 0xFB, 0xEF, 0x45, 0xB7, 0xE3, 0x7E, 0xC1, 0x70,
-    0x0C, 0x54, 0xF8, 0x8A, 0x17, 0x05, 0x2F, 0x98, 0xB2, 0xAA, 0x3C, 0xCF, 0x13, 0x16, 0x88, 0xF7,
-    0x58, 0x2C, 0xC2, 0x4C, 0x2B, 0x8E, 0xA8, 0x49, 0x32, 0x19, 0x2A, 0x31, 0xCD, 0x06, 0x49, 0x1B,
-    0x0F, 0x3E, 0x7B, 0x9E, 0x73, 0xE7, 0xE1, 0xA9, 0xB2, 0x8B, 0x75, 0xBC, 0x26, 0x49, 0x7B, 0x92,
-    0x91, 0x0C, 0x69, 0x3C, 0xA4, 0xAA, 0x5C, 0x5C, 0x8F, 0xC7, 0x1B, 0x3A, 0x00, 0x79, 0xB4, 0x9E,
-    0xAE, 0x33, 0x90, 0x9E, 0xCE, 0x22, 0x7F, 0xA4, 0x6C, 0x0B, 0x69, 0xED, 0x99, 0x65, 0xC1, 0xE1,
-    0xBC, 0x85, 0xD4, 0x5A, 0x50, 0xB7, 0x94, 0xDF, 0xEC, 0x8C, 0xB0, 0x42, 0x1C, 0x04, 0x51, 0x59,
-    0xB5, 0x43, 0xF9, 0x3B, 0x0A, 0x5A, 0xBF, 0xCF, 0x4C, 0x61, 0x60, 0x54, 0x05, 0x17, 0xC8, 0xFA,
-    0xD0, 0xC8, 0x10, 0x2D, 0xF6, 0x91, 0xAA, 0x64, 0xEF, 0xDA, 0x1E, 0x98, 0x5E, 0x1F, 0xCF, 0x4B,
-    0x80, 0x99, 0x37, 0xF6, 0xF3, 0x50, 0xD0, 0xFF, 0x48, 0xF0, 0x55, 0x98, 0x4E, 0x36, 0xDA, 0xAC,
-    0x53, 0x0D, 0x80, 0xEA, 0x5A, 0xAD, 0x78, 0xF6, 0xB8, 0xB5, 0x8A, 0x85, 0xC1, 0x65, 0xE1, 0x86,
-    0x84, 0xBB, 0x2E, 0x7D, 0xA2, 0xEA, 0x6D, 0xE0, 0x55, 0x84, 0x1A, 0xB4, 0x99, 0xCC, 0x62, 0x5B,
-    0xA5, 0x2D, 0x10, 0x1D, 0x8A, 0x87, 0x48, 0xB0, 0xC4, 0xD6, 0x92, 0x5D, 0x59, 0xAF, 0x02, 0xDB,
-    0x40, 0x46, 0x25, 0x43, 0x22, 0x2D, 0xCF, 0x94, 0x59, 0x5C, 0x17, 0x13, 0xCE, 0xDC, 0x1C, 0xC9,
-    0x6E, 0x8F, 0x43, 0x58, 0x45, 0xC3, 0x0A, 0x1A, 0xD5, 0x0E, 0xB4, 0x52, 0x92, 0x02, 0x3F, 0xD9,
-    0x09, 0x3B, 0x87, 0xAE, 0x83, 0x82, 0x7F, 0x22, 0x4B, 0x67, 0x47, 0x2F, 0x9F, 0x3F, 0x3F, 0x61,
-    0xC4, 0x1A, 0x46, 0x47, 0xD0, 0xC6, 0x9F, 0x20, 0xE8, 0x8C, 0xB1, 0xD2, 0x55, 0x9C, 0xC3, 0xA0,
-    0x27, 0x96, 0xCB, 0x28, 0xD6, 0x2F, 0xDB, 0xD9, 0x1A, 0x44, 0xDB, 0x13, 0x4C, 0x2A, 0x45, 0x29,
-    0x1B, 0x00, 0x31, 0x7F, 0x4F, 0x61, 0xFF, 0x77, 0x16, 0xB8, 0x7B, 0x3C, 0x0C, 0xFB, 0x74, 0x3A,
-    0x39, 0xED, 0x19, 0x5F, 0x1B, 0x70, 0xEE, 0xB9, 0x1F, 0xCB, 0x86, 0x24, 0x08, 0x8C, 0xB4, 0xE7,
-    0xD9, 0x59, 0x19, 0xF3, 0xC2, 0x5F, 0x7B, 0xBE, 0x2F, 0xCA, 0xD3, 0x0F, 0x2A, 0xC5, 0x57, 0x36,
-    0xF7, 0xB2, 0xFD, 0xE2, 0xF7, 0x39, 0x06, 0xC7, 0x4A, 0xA7, 0x7D, 0xB3, 0x5F, 0xB7, 0xEE, 0xBC,
-    0x32, 0x7C, 0x99, 0x0F, 0x1D, 0x26, 0xB5, 0xE4, 0xE5, 0x79, 0xB7, 0xDA, 0x2C, 0xC8, 0x05, 0xBF,
-    0x72, 0xFE, 0xB1, 0x88, 0xCF, 0xFF, 0x3E, 0x10, 0xAA, 0x44, 0xCF, 0xD9, 0xEE, 0x8B, 0x43, 0x3B,
-    0xB3, 0xB9, 0xF8, 0xD7, 0x38, 0xEE, 0xB2, 0x50, 0x98, 0x68, 0xCC, 0x79, 0xE4, 0xB7, 0x83, 0x75,
-    0x08, 0x18, 0x9F, 0x86, 0x5D, 0x16, 0x4E, 0x51, 0x7B, 0xC3, 0x95, 0x1F, 0x35, 0xD7, 0x59, 0xC4,
-    0x7C, 0x55, 0x15, 0x03, 0x7E, 0xFE, 0x17, 0xE5, 0x5B, 0xBF, 0x8F, 0xDD, 0xD8, 0x75, 0xBE, 0x24,
-    0xA5, 0x21, 0x3C, 0x04, 0xC2, 0x2D, 0xA4, 0x00, 0x9E, 0x4D, 0x96, 0x4D, 0x02, 0xD8, 0x0A, 0xB2,
-    0x6C, 0x53, 0xEC, 0xCC, 0xA5, 0x2D, 0x20, 0x6E, 0x15, 0x40, 0xCF, 0x01, 0xB2, 0x85, 0x1A, 0x07,
-    0x70, 0xD4, 0xA8, 0x49, 0x91, 0x62, 0x3C, 0xA4, 0xF3, 0x17, 0x4C, 0x93, 0xCA, 0x45, 0x54, 0x18,
-    0xB0, 0x34, 0x2E, 0xD4, 0x2A, 0xC8, 0x48, 0x64, 0xD6, 0x45, 0x0A, 0x37, 0xD4, 0x3A, 0x41, 0x8A,
-    0x14, 0x21, 0x12, 0x6D, 0x12, 0xAC, 0x8B, 0x10, 0xC9, 0x13, 0xC2, 0x91, 0xF9, 0x78, 0xFD, 0x7D,
-    0xE7, 0xDC, 0x37, 0xEF, 0xBD, 0xD1, 0x68, 0x37, 0xBB, 0x96, 0x95, 0x59, 0xED, 0x9B, 0xE1, 0x39,
-    0x7C, 0x7C, 0xE4, 0xBD, 0xE7, 0x9C, 0x7B, 0xEE, 0xF9, 0x75, 0x2F, 0x83, 0x22, 0x9D, 0xDB, 0x91,
-    0x7F, 0xF9, 0xB8, 0x75, 0x68, 0xF0, 0x09, 0x8A, 0xB8, 0xC3, 0x5F, 0x9F, 0xE0, 0x2F, 0xE5, 0xDF,
-    0x1C, 0x7F, 0x43, 0x86, 0xBF, 0x7C, 0xE4, 0x1F, 0xEE, 0x5D, 0xD8, 0x85, 0x31, 0xEF, 0xF1, 0xE6,
-    0xFD, 0x25, 0x78, 0xDB, 0x3D, 0x35, 0xC6, 0x39, 0x57, 0xC4, 0x6E, 0x72, 0x4D, 0xBA, 0xD8, 0xAF,
-    0xBB, 0x7C, 0xDC, 0x2F, 0x3B, 0x3B, 0xDF, 0xB7, 0x6D, 0xD9, 0xEF, 0xDB, 0xA2, 0xEE, 0x71, 0x9F,
-    0x00, 0xB7, 0x09, 0x56, 0x3F, 0x94, 0x73, 0x00, 0x3B, 0xEC, 0x9B, 0x2A, 0x5F, 0xEC, 0x87, 0x6D,
-    0xEA, 0x8E, 0xB3, 0x26, 0x46, 0xA3, 0x15, 0x5A, 0x9E, 0x8C, 0xD9, 0x76, 0x87, 0xEB, 0x5D, 0x2A,
-    0xE0, 0x27, 0x74, 0x53, 0x61, 0x32, 0xE7, 0x3A, 0x53, 0x3F, 0x2D, 0x07, 0xE3, 0x9A, 0x7C, 0x0C,
-    0x5D, 0x91, 0x02, 0x98, 0x74, 0x88, 0x00, 0x3A, 0x00, 0xDE, 0x56, 0x80, 0x3D, 0xB4, 0x86, 0x8E,
-    0x1B, 0x63, 0xAE, 0xBA, 0x7F, 0x9C, 0x19, 0x8B, 0xE6, 0x15, 0x98, 0x7C, 0x8E, 0x1F, 0xB2, 0x01,
-    0x20, 0x5D, 0x01, 0x5E, 0x4B, 0x7B, 0x80, 0xBC, 0x05, 0xB0, 0x85, 0x09, 0x0D, 0x3A, 0x4B, 0x40,
-    0xD5, 0x54, 0xA3, 0x47, 0xE7, 0xF2, 0xC9, 0xB9, 0xC5, 0xBB, 0x66, 0xCB, 0xCD, 0xDF, 0x32, 0xE6,
-    0x72, 0x21, 0xF4, 0xFC, 0xB6, 0x31, 0xEF, 0x18, 0x7B, 0x67, 0x2A, 0x8B, 0x8C, 0x84, 0xC7, 0x8B,
-    0xF7, 0x07, 0x93, 0x74, 0xC1, 0x60, 0xD2, 0xC6, 0x1C, 0x9B, 0xB4, 0x30, 0xDF, 0x33, 0x59, 0x61,
-    0x76, 0x79, 0x06, 0x50, 0xE1, 0x5A, 0xD2, 0x9A, 0xD1, 0xC4, 0x43, 0x3C, 0x90, 0x8D, 0x85, 0xB1,
-    0xB5, 0xAB, 0x8B, 0x77, 0x82, 0xC3, 0x77, 0xCC, 0x25, 0x83, 0xFF, 0xDA, 0x0D, 0x99, 0xAB, 0x6A,
-    0x37, 0xE6, 0x60, 0xCD, 0xB5, 0xF1, 0x64, 0x12, 0x57, 0x05, 0xA3, 0x89, 0x00, 0xE7, 0x60, 0xAB,
-    0x09, 0x41, 0xA1, 0x6B, 0xA3, 0x96, 0x12, 0x8D, 0xC1, 0x5A, 0xD9, 0xA3, 0x55, 0x48, 0x32, 0x23,
-    0x47, 0xE3, 0x1E, 0x79, 0x58, 0x50, 0x5A, 0xF1, 0xF4, 0x10, 0x30, 0x72, 0x3D, 0x81, 0x73, 0x83,
-    0xA1, 0x74, 0x47, 0x13, 0xCC, 0xDC, 0xB3, 0x9B, 0x94, 0x4A, 0x67, 0x78, 0xFE, 0xD1, 0x0D, 0x7F,
-    0x5D, 0xA1, 0x5E, 0xDF, 0x80, 0x91, 0xA3, 0x5C, 0x6A, 0x47, 0x31, 0x0A, 0xFC, 0xCE, 0xB8, 0xF1,
-    0xF9, 0x8E, 0x1F, 0x98, 0xCD, 0xAB, 0xA3, 0xB9, 0x7C, 0x53, 0x1E, 0x6B, 0x4D, 0x34, 0x3D, 0x80,
-    0x34, 0xFA, 0x78, 0x34, 0x59, 0x1B, 0x2E, 0x4C, 0xDE, 0x80, 0x1B, 0x80, 0x81, 0x62, 0xC6, 0x50,
-    0xF6, 0x42, 0x31, 0x40, 0x82, 0x7B, 0x4D, 0x0A, 0x89, 0x18, 0x5B, 0xE2, 0xB4, 0x8C, 0x41, 0x73,
-    0x6D, 0xCA, 0x09, 0x20, 0x71, 0x45, 0xD9, 0x60, 0x20, 0xED, 0xDC, 0x94, 0x4D, 0xE6, 0x0A, 0xDB,
-    0x24, 0x6E, 0x9E, 0x57, 0x81, 0x73, 0x65, 0x61, 0x72, 0xEA, 0x4B, 0x28, 0xC4, 0xE7, 0xA3, 0x30,
-    0x6E, 0x02, 0xD0, 0x4E, 0x89, 0xD7, 0xC6, 0x56, 0xA6, 0x34, 0xB6, 0x31, 0x07, 0xC6, 0xB6, 0x66,
-    0x61, 0xB2, 0x79, 0x88, 0xE1, 0xA1, 0xF6, 0x04, 0xB5, 0x2B, 0x96, 0x3A, 0x75, 0x09, 0x77, 0x94,
-    0x45, 0xD9, 0xD6, 0x4D, 0xD9, 0xA2, 0x93, 0xA6, 0x6C, 0x76, 0xCC, 0x8E, 0x39, 0xFD, 0xDC, 0x11,
-    0x09, 0xA8, 0x72, 0x9A, 0xFC, 0xC4, 0xDC, 0x99, 0xB3, 0x79, 0x13, 0x4C, 0x26, 0xE2, 0x0F, 0x79,
-    0x95, 0xB4, 0xA1, 0xEB, 0x92, 0x36, 0xAD, 0x72, 0xB7, 0x88, 0xFA, 0x1C, 0xDD, 0xD6, 0xC1, 0x7C,
-    0x0F, 0x6C, 0xEE, 0x99, 0x71, 0x1F, 0xF7, 0x7C, 0xCD, 0xEC, 0x1F, 0xC7, 0xE4, 0x73, 0x77, 0x48,
-    0x88, 0xF6, 0x86, 0xA4, 0x13, 0x94, 0x76, 0xEB, 0xDF, 0xF4, 0x37, 0x7F, 0xE7, 0xBE, 0xB4, 0xBD,
-    0xBF, 0x1B, 0x62, 0xE8, 0xCD, 0xB1, 0x35, 0x93, 0xC9, 0xCC, 0x90, 0x15, 0xF6, 0x39, 0x7A, 0x48,
-    0xDB, 0x84, 0xFD, 0xE1, 0x8E, 0x2B, 0xE8, 0x1D, 0x3F, 0x09, 0x3D, 0xF6, 0xA9, 0x68, 0x34, 0xB8,
-    0xA3, 0x20, 0x4D, 0xE9, 0x4E, 0x84, 0xFA, 0x99, 0xCC, 0x06, 0xFC, 0xF6, 0x8B, 0x09, 0x6C, 0x3A,
-    0x93, 0x35, 0x64, 0xDC, 0x15, 0x21, 0x04, 0x90, 0x3F, 0x77, 0x45, 0x8D, 0xEF, 0xF2, 0xF7, 0x7D,
-    0x9C, 0xFF, 0xDC, 0x55, 0x76, 0xB2, 0xFD, 0xD6, 0xDD, 0x9D, 0xBB, 0x66, 0xBB, 0x80, 0x0C, 0x2C,
-    0xC4, 0x67, 0x1E, 0x43, 0x72, 0xE1, 0x18, 0x51, 0x6B, 0x31, 0x49, 0xB2, 0xDE, 0xF6, 0xC6, 0x76,
-    0x75, 0x6B, 0xF0, 0x68, 0x63, 0x6A, 0x88, 0xCC, 0xD8, 0xBE, 0x6C, 0x31, 0x81, 0xF2, 0xDE, 0xC4,
-    0x63, 0x32, 0x37, 0xC1, 0x02, 0x37, 0xE3, 0x49, 0x8C, 0x65, 0x5E, 0x58, 0xCE, 0x95, 0xCB, 0xD4,
-    0x1D, 0xEA, 0x35, 0xC0, 0xED, 0xA3, 0xA3, 0x07, 0x9C, 0x98, 0xE9, 0xA7, 0x03, 0xEB, 0x86, 0xD3,
-    0xFF, 0x97, 0x8C, 0x07, 0x38, 0xC3, 0xD7, 0x69, 0x63, 0x3C, 0x3E, 0x3C, 0xBA, 0x5F, 0x60, 0x3C,
-    0xBE, 0xE5, 0xDC, 0x9C, 0xE3, 0x51, 0x06, 0x0B, 0x33, 0xDF, 0x15, 0x5E, 0x8E, 0xF7, 0x81, 0xAC,
-    0xD9, 0x7F, 0x28, 0x68, 0x77, 0x90, 0x8B, 0x7B, 0x73, 0xA0, 0x51, 0x10, 0xA6, 0xCB, 0xBB, 0x44,
-    0x0D, 0xC6, 0xC3, 0xD8, 0xB4, 0x35, 0x7B, 0xB8, 0x13, 0x23, 0xB2, 0x8B, 0xE7, 0xA0, 0x3A, 0xFB,
-    0x6C, 0x65, 0x61, 0x8E, 0xF7, 0xE4, 0xB9, 0x21, 0xFB, 0xA6, 0xEB, 0xEC, 0xBF, 0xF6, 0xE9, 0x07,
-    0x47, 0x77, 0xB7, 0x7F, 0xD4, 0x46, 0x1C, 0xB8, 0xAC, 0x22, 0xD7, 0x50, 0x01, 0x88, 0xC8, 0xBC,
-    0xFD, 0x92, 0xF1, 0xB8, 0x76, 0x74, 0x74, 0xF4, 0x43, 0x5A, 0xA2, 0x39, 0xCF, 0xEE, 0xAA, 0x5D,
-    0x83, 0x00, 0xA1, 0xC4, 0xF9, 0xC7, 0x18, 0xA6, 0xA2, 0x84, 0xC2, 0xE6, 0xC5, 0x63, 0x1C, 0xC4,
-    0x25, 0x89, 0x7D, 0x82, 0xA1, 0x93, 0x79, 0x8A, 0x5E, 0x6E, 0x63, 0x04, 0x43, 0x3E, 0x26, 0x5D,
-    0xBE, 0x0C, 0xDC, 0xFE, 0xF1, 0xF3, 0x23, 0x91, 0x78, 0x23, 0xE0, 0x93, 0x6F, 0x36, 0xB4, 0x2B,
-    0xAB, 0x0F, 0xC6, 0x68, 0xFD, 0xD9, 0x2D, 0x98, 0xE3, 0x1C, 0xBD, 0xDB, 0xBF, 0x5C, 0x98, 0xF2,
-    0x1B, 0x93, 0xC9, 0xA1, 0x70, 0x41, 0xC0, 0x79, 0x87, 0x71, 0xA6, 0xD4, 0x61, 0xD4, 0x40, 0xA8,
-    0x31, 0x8F, 0xD8, 0x5A, 0x58, 0xA4, 0x55, 0x54, 0x94, 0xB3, 0x5B, 0x05, 0x1E, 0x96, 0x63, 0x36,
-    0x9B, 0x81, 0xC3, 0x43, 0x70, 0x30, 0x68, 0x1B, 0x81, 0x43, 0x1B, 0x1C, 0x34, 0x08, 0x0B, 0xBA,
-    0x12, 0x40, 0x9B, 0x02, 0xBA, 0x95, 0xD0, 0x2B, 0xB3, 0xA9, 0x8B, 0x3F, 0xC7, 0x01, 0x03, 0x6F,
-    0x1E, 0xC7, 0x30, 0x92, 0x18, 0xF2, 0xAD, 0x23, 0x5C, 0x3E, 0xBA, 0x0B, 0x41, 0x45, 0x34, 0xF8,
-    0x26, 0xEF, 0x0C, 0x66, 0xFF, 0x95, 0x25, 0xC5, 0x75, 0xFF, 0x4A, 0xFF, 0xE7, 0x30, 0xAF, 0x4B,
-    0x38, 0x04, 0x84, 0x8B, 0x18, 0x44, 0x80, 0x19, 0x3B, 0x9A, 0xC9, 0x2D, 0x52, 0xD7, 0x8C, 0xF5,
-    0x1C, 0xF6, 0x78, 0x14, 0x47, 0x30, 0x0A, 0x0D, 0x0B, 0x81, 0x4E, 0xA1, 0x98, 0x17, 0xF2, 0x04,
-    0xDA, 0xE4, 0x67, 0x4B, 0xED, 0x84, 0x11, 0x94, 0x9F, 0xBF, 0x4D, 0x01, 0x53, 0x87, 0x5D, 0x43,
-    0xDF, 0x32, 0x15, 0xD6, 0x4D, 0xD0, 0x33, 0x42, 0xF0, 0x05, 0xD8, 0xBE, 0x14, 0x5A, 0x81, 0xB9,
-    0xC0, 0x54, 0x60, 0x24, 0xD0, 0xFC, 0xC9, 0x63, 0x42, 0xB3, 0xF7, 0x6B, 0x81, 0xB4, 0x51, 0x8F,
-    0x69, 0x9B, 0xF2, 0x29, 0x86, 0x32, 0x29, 0x94, 0x4F, 0x60, 0xF2, 0xBE, 0x9C, 0xD7, 0x43, 0x39,
-    0xD8, 0x7E, 0xBB, 0x32, 0x37, 0x4C, 0xD8, 0x99, 0x68, 0xA0, 0xC7, 0x82, 0xB5, 0x26, 0xBF, 0x59,
-    0xFB, 0xBB, 0x75, 0x63, 0x61, 0x6E, 0x30, 0x1D, 0x76, 0x60, 0x95, 0xC1, 0x77, 0x65, 0xCB, 0x6A,
-    0x17, 0xC6, 0xF9, 0x13, 0xFE, 0xEB, 0x36, 0x77, 0xEE, 0xEA, 0x6C, 0x16, 0xD4, 0x4F, 0x39, 0x89,
-    0x30, 0xDE, 0x25, 0x6C, 0x73, 0xDE, 0xD5, 0x4D, 0xD6, 0xD7, 0xD5, 0xEA, 0x80, 0x47, 0xE8, 0x6D,
-    0x63, 0x5B, 0x7C, 0x43, 0x04, 0x01, 0xFD, 0xB9, 0x7D, 0xD7, 0x7C, 0xD7, 0xDC, 0xA3, 0xED, 0x3A,
-    0x80, 0xB8, 0x1B, 0x34, 0x95, 0xF6, 0xA0, 0x42, 0x8C, 0x57, 0x34, 0xC1, 0x0F, 0x05, 0xEE, 0x3A,
-    0xC6, 0xC8, 0xFD, 0x1D, 0x86, 0xC8, 0x7D, 0x00, 0x4B, 0xE8, 0x10, 0x32, 0x44, 0x8B, 0x64, 0x34,
-    0xC9, 0x1C, 0xFE, 0x3F, 0xED, 0x72, 0xB0, 0x57, 0xC1, 0xFF, 0x5B, 0xAA, 0xF3, 0x15, 0x43, 0x47,
-    0x76, 0x8D, 0x32, 0x60, 0x44, 0x61, 0x44, 0xC7, 0x13, 0xA7, 0x63, 0xFE, 0x18, 0xF3, 0x3C, 0xC4,
-    0xB0, 0xFE, 0x45, 0xED, 0x67, 0x51, 0xAD, 0x53, 0x81, 0x38, 0x6D, 0x14, 0x73, 0x5A, 0x88, 0x3D,
-    0x30, 0x8A, 0x1F, 0x79, 0x3C, 0x2A, 0xC6, 0xE3, 0x47, 0xC4, 0x51, 0xCF, 0xC6, 0xE1, 0xEB, 0xA0,
-    0xDE, 0x8C, 0x5C, 0xD2, 0x26, 0x65, 0xB4, 0xB2, 0xC8, 0x8B, 0x77, 0x9D, 0xB9, 0x3A, 0xBB, 0x09,
-    0xA3, 0x25, 0x8A, 0xF5, 0xC8, 0xF4, 0x82, 0xC7, 0xB0, 0x95, 0x40, 0x67, 0x1E, 0x57, 0x4E, 0xE6,
-    0x70, 0x2A, 0x8A, 0x97, 0xB4, 0x96, 0xCE, 0x1E, 0xBD, 0x5B, 0x71, 0xE8, 0xEC, 0x9D, 0xD7, 0xAD,
-    0x57, 0xCC, 0x47, 0x64, 0xA2, 0x90, 0xDE, 0x33, 0xA7, 0x53, 0xFE, 0xF2, 0xEC, 0x86, 0xF0, 0x77,
-    0xEC, 0xB5, 0x76, 0x24, 0x7F, 0x85, 0xF0, 0x55, 0x62, 0x86, 0x91, 0xAF, 0xF7, 0x80, 0x85, 0x2F,
-    0x60, 0xE1, 0x8B, 0x7E, 0xB7, 0x50, 0x2C, 0x7C, 0x01, 0x3F, 0xF2, 0x78, 0x54, 0x1C, 0xCE, 0x15,
-    0xC3, 0x00, 0x9F, 0x10, 0x27, 0x4F, 0x68, 0x83, 0xCA, 0x22, 0xFD, 0xC9, 0x98, 0x75, 0xC6, 0x55,
-    0xF9, 0xF5, 0x21, 0xED, 0xA1, 0xCA, 0x36, 0x84, 0xD0, 0x31, 0xCC, 0x8F, 0xCC, 0x5B, 0x12, 0x7C,
-    0x8D, 0x3A, 0x45, 0xF8, 0x38, 0x46, 0x4E, 0x7A, 0x3F, 0x10, 0xBE, 0x4C, 0x20, 0x51, 0x5A, 0x63,
-    0x44, 0x21, 0x73, 0x12, 0xF0, 0x3B, 0xC2, 0xD7, 0x68, 0xFE, 0x80, 0x7C, 0x45, 0xCF, 0x66, 0x0F,
-    0xF9, 0x25, 0x26, 0xFF, 0x78, 0x5C, 0x30, 0xD5, 0x73, 0x36, 0xBB, 0x49, 0xDB, 0x83, 0x48, 0x4C,
-    0xEC, 0x0F, 0x7B, 0xA0, 0x0D, 0x62, 0x73, 0xB4, 0x43, 0xEC, 0x81, 0xB6, 0x48, 0x34, 0x1C, 0xF6,
-    0x48, 0xF8, 0x83, 0x4D, 0x82, 0x25, 0x17, 0xBB, 0x44, 0xFE, 0x68, 0x9B, 0x0E, 0xC4, 0x4C, 0x4F,
-    0x7E, 0xAA, 0xBB, 0x40, 0x1D, 0x52, 0x7D, 0xBD, 0x0F, 0xEF, 0x19, 0xD8, 0xAA, 0x6F, 0x75, 0xD0,
-    0x2C, 0xD8, 0x2B, 0x8C, 0xDB, 0x48, 0x9B, 0x95, 0x55, 0x30, 0x14, 0xB0, 0x5B, 0xD6, 0xFC, 0xED,
-    0x48, 0xDB, 0x75, 0x10, 0xFC, 0x8F, 0x3C, 0x39, 0x46, 0x3F, 0x21, 0x0E, 0x86, 0xE4, 0xFA, 0x28,
-    0xE3, 0xF6, 0x4E, 0x24, 0x51, 0x4B, 0xF7, 0x9E, 0xE0, 0xB4, 0x71, 0x0C, 0x4F, 0xD0, 0x3B, 0x70,
-    0x2F, 0xFC, 0xC9, 0xF5, 0x03, 0x8F, 0x71, 0xC0, 0x1E, 0x2A, 0xF1, 0x7E, 0x02, 0x5E, 0x9D, 0xF9,
-    0x48, 0x46, 0x8C, 0x67, 0xCC, 0x21, 0x4C, 0xE8, 0x1A, 0x39, 0x88, 0x46, 0xA2, 0x61, 0xCE, 0x86,
-    0xF5, 0xCF, 0x4D, 0xE3, 0x4D, 0x56, 0x70, 0x0A, 0x12, 0x82, 0x7A, 0xE0, 0x03, 0x0D, 0xC3, 0x30,
-    0xAA, 0x0C, 0x2F, 0x95, 0x64, 0xB3, 0xE6, 0x58, 0x8A, 0xB6, 0x00, 0xFC, 0x27, 0x01, 0x5C, 0x39,
-    0xF4, 0xB5, 0xB1, 0x03, 0x2C, 0x60, 0xB6, 0x48, 0x5C, 0x13, 0x49, 0x5C, 0x7D, 0x47, 0xED, 0x1D,
-    0x69, 0x39, 0xAA, 0xD4, 0x38, 0x38, 0xB5, 0x77, 0x88, 0x53, 0x15, 0xA7, 0xA3, 0xBF, 0x61, 0xE1,
-    0xEF, 0x2C, 0x3D, 0xBE, 0xBC, 0x49, 0x63, 0xE0, 0xB9, 0x0B, 0x7D, 0x03, 0x91, 0xC6, 0xA4, 0xEA,
-    0x00, 0xD9, 0x8E, 0x44, 0x01, 0xC0, 0xA5, 0x36, 0x98, 0x67, 0x8A, 0x6D, 0xAA, 0x0D, 0x1F, 0xA4,
-    0x6A, 0x87, 0x8F, 0x13, 0xC5, 0x63, 0x24, 0xD9, 0x40, 0x30, 0x17, 0x06, 0xE9, 0xA5, 0xA4, 0x61,
-    0x8C, 0xBE, 0x34, 0x0C, 0xFD, 0x92, 0x86, 0x31, 0xFA, 0xC2, 0x6D, 0xE6, 0x54, 0x7D, 0x72, 0x1F,
-    0x17, 0x63, 0x1C, 0xF2, 0x85, 0x8E, 0x43, 0xE6, 0xD4, 0xD4, 0xA7, 0xDE, 0x08, 0x50, 0xCE, 0x94,
-    0x21, 0x1B, 0x8E, 0x44, 0x82, 0xAD, 0x88, 0x93, 0xFE, 0x82, 0x63, 0x48, 0xC9, 0x2C, 0xF1, 0x9A,
-    0x64, 0x62, 0xA7, 0xD8, 0xD3, 0xAB, 0x39, 0x09, 0xE5, 0xE1, 0xCD, 0xEA, 0xE4, 0x05, 0x71, 0xE3,
-    0xCB, 0x21, 0x97, 0xC0, 0x8B, 0x65, 0xC9, 0x4F, 0xE2, 0xF9, 0xC8, 0xFF, 0x4D, 0xE9, 0x2F, 0x0B,
-    0xE7, 0x7D, 0x6C, 0x5E, 0xA9, 0x58, 0x82, 0xE2, 0xCB, 0x20, 0x97, 0xED, 0x4A, 0xF9, 0x2C, 0x07,
-    0xE6, 0x7C, 0x60, 0xD3, 0xDD, 0x12, 0x7A, 0x24, 0xA4, 0x03, 0xEE, 0x4A, 0xA1, 0x37, 0x6E, 0x92,
-    0xE5, 0x84, 0x2A, 0xBE, 0x14, 0xFA, 0x72, 0x69, 0x19, 0xF7, 0xF9, 0x89, 0x82, 0xFC, 0x65, 0x89,
-    0x35, 0xF2, 0xF2, 0xFA, 0xF2, 0x75, 0x04, 0x03, 0xE7, 0x7D, 0xDE, 0x58, 0xFB, 0x52, 0x17, 0x9E,
-    0x0F, 0xE5, 0x27, 0x7D, 0xE2, 0xF9, 0x30, 0x0F, 0x37, 0x71, 0x35, 0xF8, 0x79, 0xD6, 0x7B, 0xFE,
-    0x3F, 0x45, 0x0E, 0x77, 0x86, 0xCF, 0x24, 0x87, 0x61, 0x25, 0x87, 0xE6, 0x73, 0xCA, 0x61, 0xFA,
-    0x95, 0xE4, 0xC0, 0xD8, 0x5A, 0x69, 0x97, 0x33, 0xA1, 0xFE, 0x96, 0x9B, 0x8E, 0x1E, 0xC8, 0x59,
-    0x76, 0x67, 0x34, 0xA1, 0x9C, 0x59, 0x56, 0x0D, 0xE4, 0xEC, 0x7B, 0xA7, 0x67, 0x23, 0xCF, 0xC4,
-    0x37, 0xCE, 0x73, 0xEF, 0xAF, 0x10, 0xC7, 0xF8, 0xB3, 0xB8, 0x5D, 0x9E, 0xA5, 0xCD, 0xF2, 0x2C,
-    0x2F, 0x72, 0x3F, 0xFD, 0xAC, 0xB0, 0x22, 0x12, 0x39, 0x3D, 0x1B, 0x8C, 0xFF, 0x15, 0x49, 0x96,
-    0x7F, 0x22, 0xF2, 0xFC, 0x92, 0xBD, 0xE5, 0x59, 0xF6, 0x57, 0x33, 0xAF, 0x6C, 0xD6, 0x2C, 0xEF,
-    0x3B, 0xD0, 0xB3, 0x5C, 0xC8, 0xE1, 0x99, 0x15, 0xDF, 0xAF, 0x67, 0x94, 0x82, 0x95, 0x4C, 0x9B,
-    0x5E, 0xB5, 0x5C, 0xCC, 0xBE, 0x4D, 0x09, 0xB4, 0xA9, 0x30, 0xBC, 0x76, 0x76, 0x9A, 0x23, 0xD1,
-    0x3D, 0x27, 0x72, 0xA5, 0x3C, 0x79, 0xDF, 0x35, 0x01, 0xFF, 0xDB, 0x98, 0x71, 0x67, 0x97, 0x42,
-    0xDA, 0x65, 0x9B, 0xB1, 0xFC, 0x52, 0xB0, 0xCD, 0x2B, 0x46, 0x69, 0xA9, 0x87, 0x15, 0xF4, 0xE2,
-    0x7C, 0x09, 0x5C, 0xBF, 0x53, 0x9F, 0x95, 0x08, 0xC2, 0xF3, 0x2E, 0xA3, 0x78, 0xC8, 0xC0, 0x24,
-    0xEC, 0x58, 0x95, 0x42, 0x90, 0x57, 0xBB, 0x1F, 0x63, 0x28, 0x33, 0xA1, 0x07, 0x76, 0x8D, 0xA1,
-    0x43, 0xFC, 0x0F, 0x22, 0xE1, 0xA7, 0xAA, 0x81, 0x4A, 0xB4, 0x98, 0x7B, 0xDB, 0x9C, 0xC2, 0x3F,
-    0x15, 0x05, 0xAB, 0xE5, 0xD7, 0x92, 0x3D, 0x5F, 0x93, 0xF0, 0x46, 0x05, 0xA6, 0x5A, 0xA8, 0x95,
-    0x3F, 0xFF, 0x50, 0xD2, 0x6F, 0xFA, 0x51, 0x66, 0xB4, 0xAE, 0x12, 0xC9, 0x20, 0x61, 0xF8, 0xF8,
-    0xA8, 0x6E, 0x38, 0x55, 0x33, 0x8A, 0x02, 0x23, 0xBA, 0x82, 0x49, 0xA3, 0xC1, 0xCB, 0x79, 0xB0,
-    0x53, 0x53, 0x0C, 0xC6, 0x97, 0xB0, 0x7B, 0xC9, 0x9D, 0x9B, 0x30, 0x98, 0x13, 0x86, 0x0A, 0xC5,
-    0x44, 0x44, 0x7D, 0xE4, 0x3E, 0x9A, 0xDD, 0xEA, 0x85, 0x1E, 0x0F, 0x25, 0xD1, 0x3D, 0x7D, 0x2E,
-    0x12, 0x83, 0xA6, 0x71, 0x53, 0x26, 0x93, 0xD3, 0xCA, 0x14, 0xBF, 0x62, 0xBE, 0x48, 0x1C, 0x1D,
-    0x1D, 0xCA, 0x03, 0x52, 0x6F, 0x10, 0x7D, 0x4F, 0x9F, 0x71, 0x7E, 0xE7, 0x4D, 0x59, 0x89, 0x02,
-    0xB7, 0x64, 0xE8, 0xD4, 0xA5, 0x7F, 0x01, 0x38, 0x0A, 0x58, 0x66, 0x44, 0xB6, 0xC8, 0x6C, 0x25,
-    0x67, 0x4D, 0xCC, 0xC3, 0xAC, 0xCF, 0xD1, 0xCF, 0x56, 0xB5, 0xB5, 0xE9, 0x87, 0x2F, 0x3E, 0x47,
-    0x9C, 0x46, 0x9C, 0xFF, 0x32, 0xEF, 0x68, 0xB4, 0x59, 0x07, 0x97, 0x6A, 0xA4, 0x4E, 0x1D, 0x58,
-    0x33, 0x24, 0x6C, 0x0E, 0x71, 0xFF, 0x42, 0xA7, 0x79, 0xF9, 0x0A, 0x0F, 0xB4, 0xC7, 0x76, 0xAD,
-    0xEF, 0x43, 0xA2, 0x64, 0xA6, 0x32, 0xF4, 0x32, 0x39, 0x68, 0xA0, 0x96, 0x2C, 0x56, 0xB3, 0x98,
-    0x95, 0x68, 0x95, 0x24, 0x8B, 0xE2, 0x9D, 0x48, 0xE2, 0x55, 0x1D, 0x6C, 0x4F, 0x7D, 0x8A, 0xF6,
-    0x61, 0xAE, 0xDD, 0x95, 0x12, 0x4E, 0xC0, 0xFA, 0xFE, 0x50, 0x17, 0x2C, 0x10, 0xD8, 0x22, 0xEE,
-    0xAF, 0x78, 0x6A, 0x5E, 0xA7, 0x5C, 0x2E, 0x21, 0xEE, 0x29, 0xAB, 0x9A, 0xA5, 0xD7, 0x8A, 0x47,
-    0xD9, 0xB8, 0x62, 0x07, 0x31, 0xCE, 0x9A, 0x96, 0xBD, 0x36, 0xB9, 0xA0, 0xAF, 0xE7, 0x85, 0x7A,
-    0x57, 0xD1, 0x9A, 0x8F, 0x1F, 0x40, 0x56, 0x50, 0xAE, 0x40, 0x34, 0xB3, 0xA5, 0xF5, 0x27, 0xCA,
-    0x9C, 0xA0, 0xD4, 0x15, 0x44, 0xB1, 0xB8, 0x1C, 0xFA, 0x70, 0x45, 0xAD, 0xA2, 0x2E, 0xD4, 0x0E,
-    0xD0, 0x66, 0xBF, 0x42, 0xFE, 0xA2, 0xBF, 0x65, 0xE3, 0x81, 0x66, 0xAD, 0x31, 0xAE, 0x90, 0x48,
-    0x0F, 0xD2, 0x51, 0x3E, 0x09, 0x82, 0x07, 0x12, 0x5A, 0x7A, 0xDC, 0xF5, 0xD1, 0x1D, 0x59, 0x57,
-    0x12, 0x3A, 0x89, 0x64, 0xF1, 0xCB, 0x07, 0xD6, 0x1A, 0x57, 0xFB, 0xB0, 0xDA, 0x47, 0xD5, 0x3E,
-    0xA8, 0x8E, 0x4E, 0x63, 0xEA, 0x62, 0x4D, 0xC0, 0x15, 0xFA, 0x9B, 0x9C, 0xF4, 0xE7, 0x24, 0x48,
-    0x2A, 0xDB, 0x90, 0xD1, 0x05, 0xD7, 0x23, 0x70, 0x7B, 0x06, 0x36, 0x9D, 0x47, 0x0D, 0xD1, 0xFF,
-    0x82, 0x09, 0xA0, 0x39, 0xA4, 0x42, 0x04, 0xBA, 0x88, 0x40, 0x25, 0x11, 0xA4, 0x42, 0x04, 0x46,
-    0x88, 0x42, 0xD7, 0x13, 0xC1, 0x9F, 0x0A, 0xB2, 0xA3, 0xA0, 0xCC, 0x09, 0x4A, 0xDC, 0x5F, 0x13,
-    0x45, 0xEE, 0xBF, 0x88, 0xD0, 0x3A, 0x11, 0xE8, 0x11, 0x64, 0x15, 0xA1, 0x39, 0x16, 0x4E, 0x10,
-    0x29, 0xC5, 0x12, 0x28, 0x15, 0x62, 0x7A, 0x3D, 0x2A, 0x0B, 0xB3, 0x7D, 0xE4, 0x63, 0xBB, 0x62,
-    0x3D, 0x04, 0xB6, 0xEA, 0x20, 0x13, 0x0D, 0xF4, 0x02, 0x1F, 0xD2, 0x5C, 0x59, 0x0F, 0x96, 0x6B,
-    0xB1, 0x25, 0xB2, 0xC4, 0x85, 0x3E, 0x4F, 0xFE, 0x58, 0x46, 0xBA, 0x61, 0xA5, 0x94, 0x6D, 0xC1,
-    0xF5, 0x32, 0x7C, 0xC0, 0x41, 0x5F, 0x0F, 0x17, 0x6C, 0x25, 0x2C, 0x2B, 0x4A, 0x8D, 0xD6, 0x7C,
-    0x59, 0xC1, 0x23, 0x06, 0x0B, 0x18, 0xC6, 0x4F, 0x42, 0xF5, 0x7C, 0xFD, 0x81, 0x52, 0x91, 0xB6,
-    0x59, 0xE5, 0x12, 0x09, 0x2E, 0xFB, 0xA3, 0xBB, 0xCF, 0x47, 0x09, 0x09, 0x19, 0x0A, 0xB8, 0xF9,
-    0x16, 0x09, 0xF5, 0x71, 0x57, 0xA8, 0x31, 0x85, 0x09, 0x6E, 0x2A, 0x17, 0x3B, 0xF7, 0xCD, 0x2A,
-    0x2A, 0x59, 0x16, 0x24, 0x34, 0x52, 0x88, 0x74, 0xA0, 0x7D, 0xA8, 0xB0, 0x91, 0x59, 0xBE, 0x11,
-    0xBC, 0x6F, 0xDF, 0xF7, 0x26, 0x5C, 0x59, 0x57, 0xA6, 0x9D, 0x2C, 0x74, 0x46, 0x63, 0xCC, 0x81,
-    0x4F, 0x3A, 0x19, 0xF8, 0xCB, 0x1B, 0x03, 0xFF, 0x46, 0xF0, 0xFE, 0x67, 0x52, 0x5A, 0x42, 0xF3,
-    0xB9, 0xC4, 0x87, 0x27, 0xA5, 0x06, 0xDD, 0x1C, 0xF1, 0xFC, 0x9B, 0xBA, 0x6E, 0x68, 0xCA, 0xCE,
-    0x97, 0xB2, 0xDF, 0x30, 0xDE, 0x0B, 0x31, 0x5D, 0xD1, 0xA0, 0x43, 0x3C, 0xCA, 0x42, 0x37, 0x90,
-    0x54, 0x1C, 0xC7, 0x84, 0xDF, 0x82, 0xBB, 0xE1, 0xE1, 0x8B, 0xC9, 0xF1, 0x1B, 0x31, 0xDF, 0x8D,
-    0xF9, 0x8A, 0x31, 0xBF, 0xC5, 0x52, 0x71, 0x89, 0x74, 0x23, 0x58, 0x98, 0x78, 0x1E, 0xC3, 0x9D,
-    0x2E, 0x18, 0x44, 0x97, 0x4C, 0x2B, 0x24, 0xC3, 0x14, 0x29, 0x30, 0xEE, 0xC1, 0x35, 0x24, 0x98,
-    0x93, 0x2C, 0x15, 0x40, 0x5E, 0x59, 0x87, 0x27, 0x64, 0xFD, 0xF8, 0x37, 0xD8, 0xCA, 0xEA, 0xA3,
-    0x21, 0x48, 0xD4, 0x89, 0x98, 0x7E, 0xD0, 0x68, 0x0E, 0x5B, 0x9D, 0x23, 0xA6, 0x5A, 0xC5, 0xE4,
-    0x44, 0x4C, 0xA1, 0x13, 0x31, 0xC5, 0xFF, 0x24, 0x62, 0x4A, 0xFF, 0x5E, 0xD8, 0xCD, 0xAE, 0x0B,
-    0xDA, 0x53, 0x31, 0xED, 0xAB, 0x44, 0x06, 0x41, 0x41, 0x2F, 0x28, 0xEA, 0x04, 0x25, 0x8D, 0x88,
-    0x29, 0xAD, 0x44, 0x4C, 0xB9, 0x8A, 0x69, 0x57, 0xC5, 0x74, 0x2C, 0x62, 0x5A, 0xCC, 0x45, 0x4C,
-    0x30, 0xF4, 0x22, 0xA6, 0xF6, 0x1C, 0x31, 0xE9, 0xDE, 0x07, 0x73, 0xA0, 0x62, 0x1A, 0x54, 0x4C,
-    0x77, 0x3D, 0x57, 0xBA, 0x0C, 0xA9, 0x09, 0x15, 0x77, 0x12, 0xF8, 0x2C, 0xD5, 0x7B, 0x3D, 0x35,
-    0x88, 0x59, 0x73, 0xD6, 0x3C, 0x96, 0x70, 0x84, 0x99, 0x5B, 0x00, 0x75, 0x40, 0x31, 0x26, 0x15,
-    0x7D, 0xAF, 0x2F, 0x5C, 0xFF, 0x3F, 0x21, 0x6A, 0xD3, 0x81, 0xA6, 0xA0, 0xCC, 0x66, 0x27, 0x59,
-    0xA4, 0x4C, 0x11, 0x04, 0xF4, 0xAB, 0xB2, 0xD9, 0x1D, 0xB7, 0x38, 0x5D, 0x8D, 0x5D, 0xD5, 0x64,
-    0xB5, 0x74, 0x21, 0x83, 0xB6, 0x2A, 0xC8, 0xFA, 0x7A, 0xEC, 0xF4, 0x42, 0x35, 0xF6, 0x0D, 0xE1,
-    0x5D, 0x07, 0x3E, 0xD0, 0x1C, 0x5E, 0x53, 0x33, 0x9F, 0x9B, 0x21, 0x39, 0xE3, 0x12, 0x8C, 0xCF,
-    0xCE, 0xD6, 0xD3, 0xB3, 0x37, 0x85, 0x77, 0x5F, 0xBC, 0x69, 0xA4, 0x50, 0x60, 0xBB, 0xB2, 0x5D,
-    0x43, 0xAD, 0x5C, 0xDC, 0x2E, 0xB6, 0xCF, 0x1A, 0xC7, 0x37, 0x84, 0xF7, 0xAD, 0xA3, 0xE2, 0xB4,
-    0x2E, 0x03, 0x19, 0x68, 0x75, 0xCF, 0xFB, 0x41, 0x8D, 0x0F, 0xB5, 0x3E, 0xB6, 0x11, 0x0D, 0x39,
-    0x59, 0xD0, 0xEF, 0x35, 0x95, 0xED, 0x33, 0x77, 0x42, 0x43, 0xC7, 0x72, 0x4E, 0x48, 0x0B, 0xD7,
-    0x4B, 0xB7, 0x40, 0xDC, 0x12, 0x00, 0xBB, 0xC6, 0xA5, 0x35, 0xD8, 0xBC, 0x84, 0xB9, 0xE4, 0x24,
-    0x3B, 0x3A, 0x52, 0xAE, 0xFB, 0xCB, 0xFA, 0xD4, 0x9E, 0x68, 0x5B, 0x73, 0xAC, 0x89, 0xAD, 0x96,
-    0x97, 0xFE, 0x5B, 0xC2, 0xAF, 0xF2, 0x17, 0x5A, 0xE4, 0xD0, 0xE8, 0x34, 0xF3, 0x73, 0xD2, 0x99,
-    0xCF, 0x86, 0x72, 0x79, 0x3C, 0x55, 0x93, 0xA7, 0x48, 0x37, 0x31, 0xA9, 0x34, 0x62, 0xD1, 0xF7,
-    0xD0, 0x27, 0xD0, 0x3E, 0xB1, 0x3E, 0x59, 0xA5, 0xD7, 0x1F, 0xD5, 0x4C, 0x23, 0x3A, 0xC9, 0x5A,
-    0x3A, 0x49, 0x37, 0x3A, 0xC9, 0x3D, 0x3A, 0xC9, 0x47, 0x00, 0xFB, 0x35, 0xD8, 0x9D, 0x42, 0xBD,
-    0x33, 0x66, 0x42, 0xD2, 0x49, 0x3E, 0xF2, 0x5C, 0x12, 0x38, 0xA6, 0x0B, 0x38, 0xFF, 0xE1, 0xB2,
-    0x2F, 0xED, 0x57, 0x69, 0x70, 0x6B, 0x54, 0x71, 0x73, 0xDD, 0xA1, 0x7A, 0xB2, 0x85, 0x18, 0xA2,
-    0x3F, 0x74, 0xB2, 0xB9, 0x4B, 0xC6, 0x05, 0x01, 0x2B, 0x23, 0x75, 0x3C, 0x4A, 0xCB, 0xC4, 0xCC,
-    0x6A, 0x50, 0xA4, 0x79, 0x16, 0xEC, 0x7D, 0xE9, 0xDA, 0xC4, 0x09, 0xB2, 0xD3, 0x3D, 0xF3, 0x9B,
-    0xF0, 0x18, 0x92, 0xDA, 0xB4, 0x6C, 0x24, 0x70, 0x4F, 0x96, 0xA8, 0xD1, 0x8B, 0x9D, 0xA2, 0x85,
-    0xA0, 0x52, 0x28, 0x6C, 0xB9, 0x40, 0x1A, 0x70, 0x87, 0x85, 0x4F, 0xA2, 0x34, 0x69, 0x4B, 0x24,
-    0xCF, 0x7A, 0x2B, 0x24, 0x7A, 0xD2, 0x1B, 0xA2, 0x9F, 0x79, 0x34, 0x20, 0x80, 0x0E, 0xDD, 0x87,
-    0x53, 0x28, 0xF5, 0x46, 0x92, 0x0D, 0x94, 0xFB, 0x1A, 0xF2, 0x4D, 0x2E, 0xEB, 0x48, 0x74, 0xA1,
-    0xC5, 0x64, 0x2B, 0xC3, 0x2C, 0x4B, 0x8D, 0xBA, 0x94, 0xAE, 0x6B, 0xBC, 0x1B, 0x6B, 0x7F, 0x97,
-    0x45, 0x2D, 0x6B, 0x92, 0x85, 0x54, 0x47, 0xB2, 0x2D, 0xBA, 0x54, 0x64, 0x62, 0x4C, 0x3F, 0x47,
-    0x69, 0xE9, 0x9E, 0x6F, 0x6F, 0x05, 0x77, 0xA4, 0x66, 0x20, 0x75, 0x99, 0xD4, 0x1D, 0x02, 0xC2,
-    0xE3, 0x02, 0x5A, 0xB9, 0x9F, 0xFB, 0x04, 0x97, 0xD0, 0xCA, 0x66, 0x0E, 0x3B, 0x52, 0x67, 0xF3,
-    0xE9, 0x16, 0x46, 0x27, 0x75, 0xA3, 0xE5, 0x26, 0x00, 0xE4, 0xD7, 0x85, 0xB9, 0xBA, 0xEE, 0x0F,
-    0x34, 0x4D, 0xD2, 0x3A, 0xB7, 0xE6, 0x48, 0x65, 0xB5, 0xDA, 0xE6, 0x71, 0xE3, 0x62, 0xD1, 0xAC,
-    0xEB, 0x67, 0x5A, 0xBD, 0xD7, 0xB5, 0xB3, 0x4C, 0x56, 0xCE, 0xCA, 0xA2, 0xD6, 0x55, 0xB3, 0x66,
-    0x73, 0xCD, 0xEC, 0x22, 0xD0, 0xBC, 0x5D, 0x31, 0x3C, 0x45, 0x06, 0xDE, 0x71, 0x02, 0xFC, 0xA0,
-    0x95, 0x96, 0xB9, 0x51, 0x09, 0x7A, 0x67, 0xA2, 0xF6, 0x74, 0x45, 0xEB, 0x22, 0xD1, 0x7C, 0xC9,
-    0xAF, 0x3A, 0xB9, 0xD3, 0xB5, 0x26, 0x0F, 0x65, 0xBD, 0xE9, 0xEB, 0xE6, 0x6B, 0x17, 0x90, 0x66,
-    0xF3, 0xD5, 0xD5, 0x4A, 0x57, 0xF2, 0x73, 0xD9, 0xE7, 0x5A, 0x3C, 0x94, 0xB5, 0xA0, 0xFD, 0xD5,
-    0xF9, 0xBF, 0xCF, 0x57, 0xAB, 0x3F, 0xB7, 0x2F, 0x16, 0xFD, 0x97, 0xEF, 0x17, 0xC1, 0xFD, 0x82,
-    0x54, 0x0C, 0xB9, 0x93, 0x12, 0x08, 0xB7, 0x4C, 0x09, 0x25, 0x0E, 0x31, 0x1B, 0x69, 0x41, 0xC3,
-    0x0D, 0xA9, 0x19, 0x48, 0xD6, 0x3D, 0xAE, 0x48, 0xD4, 0x7E, 0xBF, 0xC2, 0x1A, 0xDE, 0xD1, 0x42,
-    0x67, 0xE8, 0x14, 0x93, 0xB2, 0x67, 0xB3, 0xD9, 0x0D, 0xA5, 0xCD, 0x78, 0xEA, 0xA4, 0xEE, 0x26,
-    0x13, 0x88, 0x18, 0x16, 0xAB, 0x20, 0x8D, 0xB0, 0xB1, 0x2D, 0xA9, 0x74, 0x5C, 0xFE, 0x99, 0x6E,
-    0xFD, 0x07, 0x1C, 0x44, 0x03, 0xAF, 0xF2, 0x7D, 0x3A, 0xC4, 0x10, 0x8E, 0x23, 0xE7, 0x9D, 0x57,
-    0x0B, 0xF5, 0xAE, 0x01, 0x65, 0x96, 0x4B, 0x60, 0x00, 0x47, 0x19, 0xBB, 0xC0, 0x35, 0x88, 0x29,
-    0x61, 0x5D, 0x47, 0x53, 0x73, 0xC9, 0xA8, 0x46, 0x93, 0x30, 0x8E, 0x62, 0x0E, 0x5F, 0x0E, 0x4E,
-    0x77, 0xB4, 0x22, 0x4D, 0x09, 0xD0, 0x59, 0x11, 0xC3, 0x2E, 0xA3, 0x5B, 0x71, 0xC2, 0xBA, 0x95,
-    0xC5, 0xFC, 0xCD, 0x69, 0x68, 0xAA, 0x09, 0x1B, 0xC9, 0xD7, 0x5C, 0x0F, 0xE0, 0x2B, 0xF4, 0xFE,
-    0xA9, 0x6C, 0xAB, 0x9D, 0x96, 0x81, 0x9E, 0xC4, 0xF7, 0x99, 0xDF, 0x27, 0xBB, 0xF4, 0xF4, 0x12,
-    0xD7, 0x9F, 0x9A, 0x86, 0xE0, 0xB6, 0x50, 0x3F, 0xA8, 0xB7, 0x8F, 0xDC, 0x37, 0x84, 0xFA, 0xBA,
-    0xC7, 0x53, 0x25, 0x17, 0xC1, 0xEC, 0x00, 0xFA, 0x14, 0x8C, 0x4C, 0x29, 0x3C, 0x38, 0x99, 0xCD,
-    0x6E, 0x9E, 0x47, 0x3D, 0xFB, 0xEE, 0xE1, 0xF0, 0x59, 0x72, 0x3E, 0xB9, 0xD3, 0xA9, 0xA7, 0xCB,
-    0xC4, 0xBF, 0x51, 0x5E, 0x6A, 0x6B, 0xC5, 0xD4, 0x8A, 0xA5, 0x95, 0xA8, 0x5B, 0x62, 0xEE, 0xC5,
-    0x86, 0x95, 0x7D, 0xBD, 0x54, 0x89, 0x35, 0x95, 0xC9, 0x20, 0xB6, 0x54, 0x4C, 0xA9, 0x58, 0x52,
-    0xD9, 0x7E, 0xB0, 0xB2, 0xA3, 0xAF, 0x97, 0xAA, 0x4B, 0x9A, 0x8B, 0x39, 0x6F, 0x73, 0x74, 0x07,
-    0x1B, 0xBF, 0x9E, 0x31, 0x3B, 0xAF, 0x95, 0xAA, 0xF5, 0x65, 0x03, 0x59, 0x77, 0xB3, 0x9B, 0xCB,
-    0x06, 0x1A, 0xC4, 0xCD, 0xE5, 0x90, 0x79, 0x55, 0x7E, 0x9E, 0x43, 0xCB, 0xE0, 0x99, 0xC4, 0xDC,
-    0xAC, 0x0A, 0xAF, 0x2F, 0x0F, 0xCC, 0x55, 0x61, 0x16, 0x67, 0xD3, 0xB3, 0x56, 0x8E, 0x48, 0x23,
-    0x9B, 0xCF, 0x71, 0x68, 0xB9, 0x1B, 0x71, 0x7E, 0xC5, 0x83, 0xFB, 0x0A, 0x8D, 0x58, 0x1F, 0x44,
-    0xB4, 0xCF, 0x9C, 0xC9, 0x5A, 0x5B, 0x95, 0x26, 0xE9, 0xD6, 0xD3, 0xA2, 0x57, 0xCE, 0xA7, 0x4F,
-    0xC2, 0x2C, 0xF7, 0x3E, 0x76, 0x75, 0x6B, 0xDB, 0xB2, 0x91, 0x7D, 0xD9, 0x6B, 0x9F, 0x57, 0xDE,
-    0xE7, 0x0D, 0xBF, 0xEC, 0x9A, 0xD0, 0xE2, 0x2E, 0x98, 0xFA, 0xC7, 0x9A, 0x39, 0x88, 0x51, 0x4C,
-    0xB4, 0x70, 0xF6, 0x33, 0x4E, 0xD8, 0xDF, 0x37, 0x1A, 0xB4, 0x32, 0x38, 0x0A, 0x66, 0x1C, 0x87,
-    0x5C, 0xDE, 0x31, 0xF0, 0x6F, 0x14, 0x54, 0x88, 0xA1, 0x59, 0x23, 0x72, 0x34, 0x38, 0xA9, 0x94,
-    0x3F, 0x14, 0xB2, 0x62, 0x34, 0x7C, 0x22, 0xC4, 0x3D, 0x93, 0x94, 0x99, 0x16, 0xF2, 0xAC, 0x14,
-    0x52, 0x72, 0xD9, 0x53, 0x4A, 0x73, 0xAE, 0xF5, 0x96, 0x4C, 0x77, 0x54, 0x6B, 0x3A, 0x73, 0x4F,
-    0x26, 0x47, 0xAC, 0x79, 0x45, 0xEA, 0x4E, 0x1E, 0x19, 0x4F, 0x0C, 0xA8, 0xD3, 0x38, 0x7B, 0xD7,
-    0xD4, 0xED, 0x39, 0xFB, 0x40, 0x76, 0x6E, 0x30, 0xD5, 0xF8, 0x80, 0x77, 0x5A, 0xF7, 0x53, 0xA6,
-    0x09, 0x30, 0xF2, 0x0F, 0xD0, 0x3E, 0x6C, 0x3E, 0xEB, 0x27, 0x81, 0x93, 0x1D, 0x0C, 0x01, 0x43,
-    0x7D, 0x51, 0x8A, 0x0D, 0xD4, 0x7E, 0x4E, 0xC4, 0x5C, 0x81, 0xAF, 0x56, 0x88, 0xF3, 0x73, 0x98,
-    0xA0, 0x8E, 0x7A, 0x46, 0xF4, 0x99, 0x03, 0xE6, 0xE0, 0xF6, 0x0D, 0xE1, 0x75, 0xD2, 0xE4, 0xA5,
-    0x61, 0xD9, 0xBF, 0x96, 0x2A, 0x10, 0xE4, 0x97, 0x89, 0x08, 0xB5, 0x5E, 0xE7, 0xC5, 0x3F, 0xFC,
-    0x9F, 0xC4, 0xCF, 0x44, 0x4D, 0x9E, 0xD2, 0x11, 0xD0, 0x9F, 0xBC, 0xF8, 0x35, 0x8F, 0x7A, 0x5B,
-    0x95, 0xC2, 0x47, 0x18, 0x42, 0xB5, 0x6E, 0xF9, 0xD0, 0x75, 0xFB, 0x54, 0x37, 0x57, 0xB4, 0x7E,
-    0xB7, 0xEB, 0xE6, 0x82, 0xC2, 0x85, 0xA0, 0xF9, 0x25, 0x01, 0xB3, 0xAD, 0x34, 0x60, 0xCE, 0xCE,
-    0x04, 0xCC, 0x17, 0x81, 0xE6, 0xAD, 0x43, 0x06, 0xCC, 0x88, 0x43, 0x34, 0x60, 0xEE, 0xCE, 0x06,
-    0xCC, 0x5A, 0xA4, 0x7A, 0xEB, 0x42, 0xC9, 0xF9, 0x92, 0xCC, 0x4C, 0x4D, 0x43, 0x5C, 0xC3, 0x89,
-    0xAB, 0xB0, 0xAE, 0x68, 0x42, 0xBE, 0xBA, 0xB6, 0x78, 0x79, 0x91, 0xF4, 0x79, 0xF9, 0x46, 0x44,
-    0x3C, 0x2C, 0x81, 0xBC, 0x5C, 0x12, 0xBC, 0x58, 0x2B, 0x3F, 0xF3, 0xAA, 0xC4, 0x0B, 0xBF, 0x17,
-    0xCB, 0x67, 0xCF, 0x34, 0xB5, 0xFC, 0x7C, 0x97, 0x2C, 0xFF, 0x91, 0xDA, 0xCE, 0xCE, 0xD7, 0x0A,
-    0xC0, 0x72, 0x29, 0x2C, 0x83, 0x48, 0x3A, 0xED, 0x91, 0xC4, 0x3B, 0x7E, 0x95, 0x32, 0xF2, 0x10,
-    0xFD, 0x33, 0x61, 0xFA, 0x53, 0xC2, 0x4C, 0x78, 0xD9, 0x13, 0xC8, 0x4D, 0x58, 0xF6, 0x64, 0x4E,
-    0x28, 0xF5, 0x87, 0x5C, 0x1C, 0x3F, 0x17, 0x19, 0xCF, 0xB0, 0x2C, 0x94, 0x6A, 0x95, 0x21, 0x6A,
-    0xC9, 0xB2, 0xDF, 0xAD, 0xA0, 0x5B, 0x69, 0x96, 0x9B, 0x8F, 0xFC, 0x96, 0x2E, 0xBF, 0x9B, 0xC6,
-    0x6F, 0xA7, 0x59, 0x2E, 0x92, 0x9D, 0xDD, 0x98, 0x2A, 0x25, 0x9B, 0xD6, 0x72, 0xE1, 0x57, 0x51,
-    0xC4, 0x3A, 0x82, 0xD8, 0xBC, 0xF0, 0x57, 0xB2, 0x95, 0x4B, 0xA4, 0xAD, 0x74, 0xB2, 0x51, 0xCD,
-    0xF5, 0x8A, 0xE6, 0x12, 0xDE, 0xD6, 0x6E, 0x92, 0x3A, 0x98, 0x1B, 0x68, 0xBF, 0x13, 0xD7, 0xCA,
-    0xE6, 0xA0, 0xE5, 0x2A, 0x80, 0xE7, 0xC9, 0x57, 0xB6, 0x75, 0x9B, 0x5B, 0xA8, 0x9C, 0xC5, 0x5A,
-    0xE1, 0x4A, 0xDB, 0xF3, 0x76, 0x20, 0x5F, 0x58, 0x8E, 0x76, 0x94, 0x21, 0xEB, 0x5F, 0x37, 0xD1,
-    0x5D, 0xC5, 0x0B, 0x89, 0x99, 0x93, 0x5E, 0xDE, 0x29, 0xCB, 0x1A, 0x51, 0xB1, 0xCB, 0xE7, 0x0C,
-    0xD2, 0x85, 0xE4, 0xA8, 0xF0, 0x8A, 0x25, 0x6F, 0x00, 0xA4, 0x43, 0x36, 0x5F, 0x43, 0x73, 0xB9,
-    0x18, 0x1E, 0x86, 0x95, 0x39, 0xFF, 0x73, 0x31, 0xB5, 0x4E, 0xB2, 0xAD, 0xF0, 0x85, 0x0D, 0x5C,
-    0x79, 0xE7, 0x5F, 0x93, 0x38, 0xB3, 0xC2, 0xAE, 0x23, 0x39, 0x66, 0xAE, 0x73, 0x7C, 0x03, 0x14,
-    0x93, 0xB7, 0x82, 0xC3, 0xE7, 0x96, 0x47, 0x79, 0xF7, 0xD3, 0x70, 0x37, 0x43, 0x23, 0xEB, 0xFE,
-    0xF2, 0x9E, 0x19, 0x28, 0x91, 0x8A, 0x20, 0xDF, 0x85, 0x80, 0x21, 0x60, 0x81, 0x75, 0x64, 0x7D,
-    0x35, 0x1B, 0x33, 0x09, 0xD8, 0xAD, 0xF8, 0xE1, 0x5D, 0xE9, 0xFC, 0x58, 0x08, 0x59, 0xDF, 0xC0,
-    0xD7, 0xAF, 0x4A, 0xBD, 0x6B, 0xFB, 0xEA, 0xFC, 0xB6, 0x32, 0x71, 0xD6, 0x81, 0x78, 0x92, 0x78,
-    0x3C, 0x5D, 0x07, 0xF9, 0x3D, 0xF1, 0x93, 0x56, 0x38, 0xB9, 0x26, 0x4A, 0x75, 0xED, 0x48, 0xDF,
-    0xD0, 0x93, 0xB7, 0x31, 0x04, 0x86, 0x9F, 0xB6, 0x11, 0x09, 0xD9, 0x42, 0x80, 0x50, 0x8B, 0xF1,
-    0xE6, 0xBF, 0x30, 0xD4, 0x71, 0xEE, 0x7D, 0xB2, 0x39, 0xF8, 0x8D, 0x1A, 0x1A, 0x15, 0x49, 0x4D,
-    0xD5, 0xD4, 0x12, 0x6E, 0x95, 0xF3, 0x4F, 0x83, 0x7A, 0xA7, 0x3E, 0xA5, 0x2D, 0x68, 0x6B, 0x93,
-    0x6C, 0x6F, 0xD4, 0x5E, 0x3E, 0xD4, 0xA2, 0xA6, 0xF4, 0x7E, 0x3E, 0x6D, 0x4A, 0xB9, 0x6E, 0x79,
-    0xAD, 0x75, 0x31, 0xCF, 0xE9, 0x36, 0xD6, 0xCD, 0x4D, 0x5E, 0xDD, 0xD9, 0x4D, 0x5E, 0xDB, 0xC5,
-    0x39, 0x0A, 0xF9, 0xC5, 0x1A, 0xC7, 0x5F, 0x02, 0xE5, 0x5C, 0xBF, 0x8F, 0xDD, 0x56, 0x76, 0xBE,
-    0x24, 0x3D, 0xF3, 0xB0, 0x7A, 0x40, 0xE8, 0x00, 0xD2, 0x02, 0x2B, 0x15, 0xAC, 0x02, 0xEC, 0x6A,
-    0x03, 0xF0, 0x2F, 0xB0, 0xC9, 0x75, 0x8A, 0x00, 0x49, 0xB1, 0x53, 0xE8, 0x6D, 0x0A, 0x17, 0x6E,
-    0x5C, 0xEC, 0x2A, 0x85, 0xDA, 0x14, 0x6B, 0xF1, 0x45, 0x29, 0x53, 0x64, 0x8A, 0xDD, 0x4D, 0x91,
-    0x22, 0x2A, 0x54, 0xC8, 0x2F, 0x85, 0x10, 0x20, 0x85, 0x0B, 0x59, 0x64, 0xE2, 0x22, 0x85, 0x0B,
-    0x73, 0x63, 0x20, 0x5B, 0xB8, 0x30, 0x93, 0x58, 0x8B, 0xC0, 0x8B, 0xAC, 0x98, 0x80, 0x4E, 0x28,
-    0x89, 0xE4, 0xDD, 0xF3, 0x7D, 0xE7, 0xF2, 0x3D, 0xBE, 0xD1, 0xC8, 0x6B, 0xFD, 0x98, 0xF1, 0xCC,
-    0x64, 0xA0, 0x77, 0x0F, 0xF5, 0x1E, 0x79, 0x79, 0xEF, 0x39, 0xE7, 0x9E, 0x7B, 0x7E, 0x5E, 0x63,
-    0xAE, 0xAE, 0xDE, 0x35, 0xF8, 0xCB, 0xEC, 0xB0, 0x05, 0x2F, 0x2C, 0xAE, 0x98, 0xE9, 0x9F, 0x67,
-    0x0B, 0x42, 0xDF, 0x96, 0x84, 0x81, 0xAD, 0x08, 0x67, 0xB6, 0x26, 0x0C, 0x6D, 0xA3, 0x30, 0xEB,
-    0x08, 0xE3, 0x48, 0x61, 0x12, 0xF6, 0x84, 0xD7, 0x43, 0x4B, 0x78, 0x77, 0xAE, 0xB0, 0x0B, 0xEC,
-    0x12, 0xDD, 0x36, 0x01, 0x3B, 0x0E, 0x6A, 0xED, 0x38, 0xA8, 0x0D, 0x3B, 0x9E, 0x97, 0x86, 0x1D,
-    0x87, 0x85, 0xC9, 0xD1, 0x71, 0x64, 0xAD, 0x6D, 0xD1, 0xAD, 0x40, 0x74, 0x9C, 0xC8, 0x25, 0x3A,
-    0xBE, 0x8E, 0x9F, 0x04, 0xF6, 0x18, 0x01, 0xBA, 0x95, 0x47, 0x6D, 0x6A, 0xBC, 0x0E, 0x23, 0x2C,
-    0x4C, 0xD0, 0x02, 0x96, 0x66, 0xDE, 0x61, 0xA4, 0x8D, 0xB1, 0xD2, 0xA9, 0xF4, 0xB0, 0x86, 0xE6,
-    0x32, 0xA7, 0x9F, 0x70, 0xD2, 0xDA, 0x4E, 0x27, 0xBE, 0xB3, 0x4A, 0xA5, 0xCD, 0x6D, 0x8F, 0x5E,
-    0x1E, 0xC8, 0x80, 0xE7, 0xD6, 0x97, 0x5E, 0xE7, 0x3D, 0x06, 0x39, 0xEB, 0x38, 0xC4, 0xDB, 0x3A,
-    0xD0, 0x49, 0x7B, 0x11, 0xBD, 0xFB, 0x16, 0x6D, 0x68, 0xF7, 0xA5, 0x95, 0x91, 0x4A, 0x9B, 0xF0,
-    0xFE, 0xAC, 0xDD, 0xB4, 0x49, 0xEB, 0xF1, 0xFB, 0x00, 0xF7, 0x0C, 0x6F, 0xE5, 0xAD, 0xDC, 0xDF,
-    0x25, 0x36, 0xF5, 0x6D, 0x2D, 0xAD, 0xB9, 0xA0, 0x83, 0xF8, 0xA1, 0x39, 0xA7, 0x98, 0x33, 0xB1,
-    0x52, 0x28, 0xCD, 0x15, 0xB3, 0xB6, 0x77, 0x98, 0x6F, 0xB7, 0x28, 0x63, 0x5E, 0x31, 0xFF, 0x1F,
-    0x28, 0x77, 0xD3, 0x7C, 0x47, 0x9E, 0x6A, 0xD1, 0x8F, 0x19, 0xF0, 0x94, 0xB0, 0x6E, 0xC7, 0xF7,
-    0xD4, 0x9C, 0x1C, 0xC6, 0x68, 0x5E, 0x35, 0x27, 0x8B, 0x96, 0x67, 0x94, 0x16, 0x1C, 0x6A, 0xAA,
-    0x33, 0xD4, 0x01, 0x9B, 0x40, 0x27, 0x62, 0xE6, 0x3A, 0x31, 0x13, 0x8E, 0x70, 0xFC, 0xDE, 0xDE,
-    0x75, 0x18, 0x70, 0x0F, 0x60, 0x80, 0x5F, 0x37, 0x8D, 0xDE, 0x27, 0x2D, 0xD8, 0x71, 0x44, 0x42,
-    0x25, 0xDA, 0x2E, 0x27, 0xD7, 0x43, 0x45, 0x44, 0x56, 0xA4, 0xE2, 0x3E, 0xBE, 0x3A, 0xB7, 0xE2,
-    0x0F, 0x9C, 0x47, 0xA6, 0xA3, 0xC2, 0x03, 0x41, 0xBF, 0x99, 0xBF, 0x97, 0x6E, 0x18, 0x31, 0xB7,
-    0x9F, 0x61, 0xFA, 0xC0, 0x5B, 0xF6, 0xF0, 0x4D, 0x5B, 0x78, 0xF8, 0x57, 0xCE, 0xE4, 0xBF, 0x79,
-    0x15, 0x8A, 0x04, 0xCA, 0xCA, 0x48, 0x9E, 0x4C, 0x52, 0x74, 0x78, 0xDE, 0x28, 0x23, 0xE4, 0xED,
-    0xA6, 0x55, 0x16, 0x79, 0x5A, 0x3B, 0xBD, 0x53, 0x9F, 0xD5, 0x81, 0x91, 0xCE, 0x4A, 0xDD, 0xFD,
-    0xB9, 0x8C, 0xCF, 0xAF, 0x80, 0x85, 0xA8, 0x94, 0xE1, 0xFC, 0x9D, 0xA0, 0x38, 0xE2, 0x78, 0x3C,
-    0x8B, 0xB1, 0x19, 0x8F, 0x12, 0x70, 0x17, 0xC4, 0xE0, 0x03, 0x64, 0xC2, 0x04, 0x33, 0x16, 0x2C,
-    0x19, 0x9F, 0xFD, 0xED, 0xAD, 0xC5, 0x0B, 0x6E, 0x8B, 0x85, 0x64, 0xF2, 0xB0, 0x5D, 0xCE, 0xAC,
-    0x4C, 0x47, 0x66, 0x61, 0x4B, 0x79, 0x28, 0x2F, 0x62, 0x69, 0xD2, 0xA4, 0x35, 0x57, 0x04, 0xF7,
-    0xE8, 0xE3, 0xA9, 0x0D, 0x57, 0x2E, 0x9A, 0x68, 0x30, 0x5E, 0x11, 0xDA, 0x74, 0x56, 0x06, 0xF6,
-    0x7E, 0x5E, 0x80, 0xBF, 0x52, 0x19, 0x1D, 0x6E, 0x5A, 0xE0, 0x75, 0x17, 0x6F, 0x2B, 0x15, 0x14,
-    0x93, 0x20, 0xC2, 0x00, 0xC2, 0xCC, 0x1A, 0x30, 0x58, 0x58, 0xF8, 0x72, 0xE3, 0x0E, 0xF0, 0x76,
-    0xCA, 0xB0, 0xED, 0x03, 0x8B, 0x33, 0x2C, 0xE2, 0x10, 0x2C, 0x9D, 0x7C, 0x28, 0x5D, 0x5A, 0xAF,
-    0x37, 0x32, 0x9F, 0x04, 0xC8, 0xDE, 0xF9, 0x7A, 0xB0, 0xBD, 0xCB, 0x59, 0x46, 0x9C, 0x4D, 0x3C,
-    0x6C, 0xDA, 0x90, 0xB3, 0xF4, 0xF6, 0xCD, 0x81, 0xBF, 0xD3, 0xC2, 0xDB, 0xF7, 0x28, 0x79, 0x96,
-    0x0E, 0xE5, 0x6C, 0x02, 0xF0, 0xB6, 0x79, 0x7B, 0x7B, 0xEB, 0x3C, 0x56, 0x6C, 0x5F, 0x4C, 0x45,
-    0xB8, 0x99, 0xB0, 0x9A, 0xC9, 0x64, 0x83, 0x2E, 0x82, 0x20, 0xB7, 0xF9, 0x92, 0x1B, 0x9B, 0x19,
-    0xBB, 0x30, 0x3B, 0x7B, 0xA7, 0x0D, 0xDB, 0xFE, 0x4D, 0xCC, 0xAC, 0x37, 0xA2, 0xB5, 0x64, 0x7F,
-    0x21, 0x3D, 0xC4, 0x0F, 0x1A, 0x8C, 0xBA, 0xD4, 0xBD, 0xC5, 0x31, 0xDA, 0xF1, 0x63, 0xFB, 0xDC,
-    0xD2, 0xFC, 0x08, 0xD2, 0xBE, 0xA1, 0x3C, 0xF3, 0x7A, 0xDD, 0xA0, 0xF2, 0x5C, 0xA5, 0x3C, 0x99,
-    0xC1, 0x84, 0xAA, 0x0B, 0x7B, 0x57, 0xA6, 0x38, 0xB7, 0x8F, 0xE4, 0x37, 0xE9, 0x0C, 0xBB, 0xD4,
-    0xCC, 0x7E, 0x7E, 0x47, 0x26, 0x21, 0xBB, 0xAE, 0x27, 0x48, 0x13, 0xE4, 0xE3, 0xFD, 0x00, 0xB2,
-    0x9D, 0x02, 0xC8, 0xEB, 0x01, 0x66, 0x24, 0x0C, 0xE6, 0xAB, 0xA0, 0x54, 0x50, 0x01, 0xF8, 0x5F,
-    0x02, 0x82, 0x11, 0x94, 0x93, 0xC7, 0x5D, 0x67, 0x82, 0x7A, 0x7D, 0x03, 0x5F, 0x24, 0xCB, 0x12,
-    0x40, 0xE8, 0xC4, 0xB1, 0xD4, 0x72, 0xD7, 0xFD, 0x6B, 0x42, 0x1C, 0x37, 0x4E, 0x00, 0x2E, 0x56,
-    0x7F, 0xF5, 0xAE, 0x77, 0x1B, 0xE3, 0x1E, 0x02, 0x99, 0xB6, 0x9F, 0x0F, 0xB3, 0x96, 0xA8, 0xE2,
-    0x36, 0x15, 0x0E, 0x61, 0xA9, 0x60, 0x49, 0xF0, 0x8D, 0x35, 0x0E, 0x76, 0x7F, 0x42, 0x90, 0x5B,
-    0x80, 0xC0, 0xDA, 0x4F, 0x07, 0x90, 0xF0, 0x67, 0x50, 0x98, 0xE5, 0x9B, 0x6C, 0x20, 0xCA, 0x21,
-    0x94, 0x65, 0xFA, 0x90, 0x10, 0x42, 0x8A, 0x68, 0x0B, 0x90, 0x1D, 0xB7, 0x40, 0xB2, 0x06, 0xD3,
-    0x3B, 0xF5, 0x71, 0xD7, 0x99, 0xCC, 0x0D, 0x22, 0x7E, 0x6E, 0xFF, 0xF5, 0xB1, 0xD0, 0x43, 0x76,
-    0xF8, 0x0F, 0x40, 0xBD, 0x6C, 0x08, 0x00, 0xBC, 0xBD, 0x97, 0x4E, 0x0E, 0xC1, 0x3A, 0x30, 0x2F,
-    0x7D, 0xD6, 0x1B, 0xE0, 0xBE, 0x3C, 0x32, 0x72, 0x50, 0xFB, 0x03, 0x72, 0x85, 0x18, 0x46, 0xD9,
-    0x76, 0xC4, 0xFA, 0xEA, 0x8E, 0xBD, 0xCD, 0x9B, 0x85, 0x54, 0x8B, 0xB7, 0x86, 0x2B, 0xEE, 0x7B,
-    0x6F, 0x8F, 0x68, 0x1C, 0xA4, 0x15, 0x9C, 0x7C, 0x34, 0x00, 0x41, 0xD2, 0x83, 0xBC, 0x5A, 0x08,
-    0xA1, 0xA8, 0x53, 0x3C, 0x2A, 0x52, 0xB5, 0x55, 0xAC, 0x4F, 0xDB, 0x64, 0x6C, 0xA3, 0xF1, 0x7E,
-    0x7D, 0x16, 0xFD, 0x58, 0x87, 0xF4, 0x40, 0x71, 0xAE, 0x28, 0x57, 0x8C, 0x9F, 0x5B, 0xAD, 0x96,
-    0x20, 0x8D, 0xEE, 0x55, 0x68, 0x77, 0x16, 0x8B, 0xC9, 0xEA, 0x90, 0xA5, 0x8B, 0xC6, 0x16, 0x42,
-    0x8C, 0x55, 0x5E, 0x40, 0x21, 0x8D, 0x88, 0xA1, 0x70, 0xD2, 0xCE, 0xD9, 0x1A, 0x73, 0x58, 0x5B,
-    0xB1, 0xB5, 0x24, 0xA0, 0xB6, 0xD5, 0x53, 0xEE, 0xDC, 0x6E, 0xBD, 0x86, 0x2B, 0x47, 0x5B, 0x2A,
-    0xC2, 0x41, 0x2D, 0x2B, 0x7F, 0xF1, 0x56, 0xCD, 0xF1, 0xB8, 0x56, 0x2C, 0xBE, 0x15, 0xD6, 0xB7,
-    0x75, 0xCD, 0xC6, 0xDC, 0xF3, 0xAE, 0x52, 0xFC, 0xB4, 0xC4, 0xB8, 0xCC, 0xFC, 0x7B, 0x14, 0x3F,
-    0x79, 0x2D, 0xE2, 0x27, 0xAB, 0x81, 0x9A, 0x56, 0x70, 0xA5, 0x8D, 0x28, 0x8D, 0xD6, 0xBA, 0xE6,
-    0xE1, 0x62, 0x71, 0xE5, 0x30, 0xF1, 0x03, 0x1A, 0xD5, 0xC2, 0x15, 0x18, 0xC4, 0xC3, 0x6B, 0x15,
-    0x3A, 0x85, 0x70, 0x84, 0xF0, 0xBC, 0x20, 0x2F, 0xBA, 0x68, 0x7C, 0xE1, 0x80, 0x48, 0xA4, 0x13,
-    0x44, 0x3E, 0xB4, 0x4D, 0x11, 0xE4, 0x4B, 0x2E, 0xAE, 0x8D, 0xD8, 0xF5, 0xCC, 0x29, 0x42, 0xEC,
-    0x2D, 0x99, 0x93, 0x58, 0x0E, 0xA2, 0xAE, 0x64, 0xDF, 0xC3, 0x52, 0x06, 0xD7, 0x46, 0xD8, 0x4A,
-    0x02, 0xF6, 0xB4, 0xB6, 0x4A, 0x8F, 0x17, 0xCF, 0x26, 0xE2, 0x42, 0xCB, 0x9E, 0xD8, 0xD2, 0x12,
-    0xCA, 0xFB, 0xDD, 0xF4, 0xA0, 0x02, 0x73, 0xE2, 0xF1, 0x4C, 0xE5, 0xC5, 0x57, 0x95, 0xA5, 0x74,
-    0x8D, 0x47, 0x8B, 0xE3, 0x5B, 0xDB, 0xCA, 0xCB, 0x71, 0xE2, 0xF9, 0x34, 0xE0, 0xCD, 0x78, 0x24,
-    0x3C, 0xF7, 0x38, 0x13, 0xEB, 0x3E, 0x9F, 0xAA, 0x47, 0x85, 0xAD, 0x5A, 0x79, 0x8F, 0x4A, 0x1A,
-    0xC8, 0x68, 0x77, 0x05, 0xAB, 0x47, 0x80, 0xC5, 0x6A, 0xC4, 0xE2, 0x9D, 0x0A, 0x78, 0x1B, 0xB1,
-    0x18, 0x61, 0xB6, 0x31, 0x06, 0x41, 0xFF, 0xCE, 0x40, 0xAD, 0x84, 0x53, 0xA4, 0x4E, 0xF6, 0xAB,
-    0x14, 0xDC, 0x29, 0xCD, 0x25, 0xF9, 0xE5, 0x32, 0xB4, 0x2A, 0x99, 0x03, 0xE6, 0x12, 0xD6, 0x18,
-    0x79, 0x30, 0xF0, 0x01, 0xB5, 0xA6, 0x69, 0xEC, 0x9B, 0x0B, 0x7B, 0xA7, 0x87, 0xAB, 0xBD, 0x5B,
-    0x1B, 0x25, 0xF1, 0x06, 0x04, 0x87, 0x2A, 0x89, 0xD5, 0x93, 0x4A, 0xE2, 0xF1, 0x4A, 0x8F, 0xDD,
-    0x95, 0xF3, 0xCB, 0x90, 0x39, 0x94, 0x2D, 0x4C, 0xF6, 0x57, 0x94, 0x1D, 0x3D, 0x35, 0xC7, 0xA0,
-    0x21, 0xBD, 0xC4, 0xC2, 0xDF, 0x99, 0x2C, 0xBE, 0x6B, 0xDC, 0xD2, 0x67, 0xD2, 0x5D, 0x05, 0x6B,
-    0x75, 0x61, 0x3B, 0x22, 0x4C, 0x74, 0x67, 0x98, 0x1D, 0x61, 0x4F, 0xFD, 0x79, 0xDE, 0xD1, 0xB4,
-    0x9A, 0xD1, 0x57, 0x01, 0x61, 0xAF, 0x0A, 0x36, 0xF6, 0xE7, 0x8D, 0x9C, 0x72, 0xDA, 0xF8, 0x93,
-    0x40, 0x36, 0xE2, 0x7D, 0x01, 0xB2, 0x07, 0x57, 0x72, 0xE7, 0xAE, 0x10, 0x18, 0x0F, 0x24, 0x3D,
-    0x95, 0x75, 0xE9, 0x29, 0x51, 0x00, 0x75, 0x5D, 0x00, 0xDE, 0x27, 0x00, 0x7E, 0xB1, 0x04, 0x5A,
-    0x49, 0xC5, 0xDF, 0xF3, 0x21, 0xC5, 0xDD, 0xA1, 0xFA, 0x85, 0xBC, 0xDC, 0x0E, 0x5C, 0x0A, 0x0B,
-    0x33, 0x9A, 0xA4, 0x42, 0x83, 0x62, 0xED, 0xEF, 0xA0, 0x55, 0x4A, 0xB3, 0xD4, 0xD9, 0xA5, 0x9B,
-    0x49, 0x5F, 0x95, 0xFF, 0xBC, 0xFB, 0x86, 0x74, 0x9E, 0x01, 0x83, 0xBE, 0x7D, 0x60, 0xDF, 0x5A,
-    0xCE, 0x06, 0xCF, 0xFE, 0x11, 0x4C, 0x45, 0xE9, 0x42, 0xDA, 0xBC, 0x84, 0x23, 0x21, 0xAF, 0x5C,
-    0xAB, 0xDF, 0xE8, 0xAF, 0x70, 0xF0, 0x14, 0x82, 0x99, 0xBF, 0xB6, 0x64, 0x56, 0xBA, 0x1B, 0xA0,
-    0x20, 0xE9, 0x82, 0x55, 0x57, 0xD2, 0xBC, 0x55, 0xB7, 0x11, 0xB4, 0xF8, 0x80, 0x0B, 0xDA, 0xA3,
-    0x66, 0x24, 0x83, 0x16, 0x72, 0x45, 0xC3, 0x4A, 0xD4, 0xA7, 0x4C, 0xD4, 0x31, 0x61, 0x86, 0xA5,
-    0xAC, 0x06, 0xF8, 0x60, 0x82, 0x9E, 0xAD, 0xBE, 0xBA, 0x11, 0x32, 0xFC, 0x40, 0xA6, 0xA1, 0x3D,
-    0x98, 0x3F, 0x1D, 0xB0, 0x2F, 0x78, 0x37, 0xCD, 0xB7, 0x31, 0xD5, 0xC6, 0xDC, 0xDD, 0x50, 0x54,
-    0x46, 0xD0, 0xA8, 0x11, 0x50, 0xE9, 0x2B, 0x75, 0x8F, 0x78, 0xD5, 0x9C, 0x2D, 0xFA, 0xD2, 0x81,
-    0x2A, 0x18, 0x7E, 0x67, 0xE2, 0x40, 0x6D, 0x9F, 0xE6, 0x40, 0x3D, 0xA5, 0xF4, 0x35, 0xDE, 0x43,
-    0xE7, 0x6D, 0x74, 0xCB, 0x38, 0x9D, 0x80, 0x99, 0xF3, 0x5C, 0xBE, 0x6D, 0x9E, 0xFC, 0x3B, 0x03,
-    0xF4, 0xF5, 0xD4, 0x9B, 0x69, 0x37, 0xAB, 0x78, 0xAE, 0x7E, 0x49, 0x7B, 0xC8, 0xAC, 0x4F, 0x2B,
-    0x7D, 0xCF, 0x0E, 0xB9, 0xC6, 0x3F, 0x5F, 0xE3, 0x71, 0x81, 0x8E, 0x6D, 0xD6, 0x4C, 0xBD, 0xE8,
-    0xA1, 0x46, 0x0F, 0x22, 0x15, 0x48, 0x4E, 0xF4, 0xFA, 0x44, 0xC4, 0xBC, 0x3C, 0xE8, 0xB5, 0xA6,
-    0xEB, 0xC8, 0xD8, 0xAD, 0x37, 0x9C, 0x5A, 0x32, 0xAF, 0x96, 0x5B, 0xF1, 0x92, 0xB9, 0xA3, 0x4B,
-    0xF4, 0x1F, 0x2E, 0x3E, 0xE2, 0x62, 0x62, 0xBD, 0xD3, 0xEB, 0xF6, 0x0E, 0x78, 0xDC, 0x6D, 0x9A,
-    0xAB, 0x02, 0xB4, 0x54, 0xD7, 0x52, 0x63, 0x2E, 0xC9, 0x07, 0x64, 0x81, 0xFA, 0xEC, 0x11, 0x16,
-    0x2F, 0x00, 0xA9, 0x59, 0x4D, 0xE0, 0x8B, 0xF6, 0xA7, 0x70, 0x1C, 0x1F, 0xC6, 0x3B, 0xD3, 0x58,
-    0xCB, 0x72, 0xFA, 0x31, 0xE7, 0x6E, 0x6B, 0xE8, 0xC5, 0xBA, 0xD0, 0xAD, 0x52, 0x3C, 0x66, 0x08,
-    0xA8, 0x55, 0x97, 0x4E, 0x49, 0xC9, 0xEE, 0x5C, 0xE2, 0x97, 0x15, 0x8D, 0x99, 0xAA, 0x31, 0x4E,
-    0x9B, 0x71, 0xB1, 0x28, 0xEF, 0xCB, 0xC1, 0xC5, 0x3D, 0x80, 0x7F, 0x01, 0xD1, 0x3D, 0xFB, 0xA9,
-    0x73, 0xF1, 0xDD, 0x81, 0x82, 0x6C, 0xDB, 0x19, 0xC7, 0x5C, 0x2B, 0x2A, 0xA9, 0xE2, 0x79, 0xEA,
-    0x29, 0x59, 0x83, 0xF2, 0x39, 0x41, 0xA5, 0xA8, 0x68, 0x18, 0xB7, 0xB1, 0xA2, 0xEC, 0xC1, 0x37,
-    0x41, 0x10, 0x5B, 0x5B, 0xCA, 0xA7, 0x4A, 0xDC, 0xC7, 0x13, 0xEE, 0xDA, 0x85, 0xDE, 0x86, 0x55,
-    0x09, 0xEE, 0xC0, 0xAA, 0xC6, 0x4E, 0xE6, 0xE0, 0x65, 0x3B, 0xAC, 0x56, 0x76, 0xB8, 0x99, 0x59,
-    0x55, 0x38, 0x2F, 0xE4, 0xA2, 0x12, 0xDA, 0x2F, 0xF6, 0x0E, 0xDE, 0xB7, 0x81, 0xCE, 0x6A, 0x58,
-    0xC3, 0xA7, 0xDD, 0xF7, 0x8C, 0xD0, 0x8D, 0xCF, 0xA3, 0x9F, 0xB3, 0x33, 0xC9, 0x64, 0x0E, 0xF8,
-    0x6C, 0x93, 0xE8, 0xBB, 0x87, 0x91, 0xE8, 0xAA, 0x7D, 0x74, 0x5B, 0xB9, 0x9A, 0x6A, 0xAA, 0xBD,
-    0x7F, 0x65, 0x8B, 0x52, 0x3B, 0x29, 0xC0, 0xCF, 0x29, 0x61, 0xEC, 0x27, 0x4A, 0xA9, 0x07, 0x96,
-    0x94, 0xEA, 0xD6, 0x94, 0x2A, 0x5E, 0x1A, 0xA5, 0x9E, 0x4E, 0x22, 0xD1, 0xE9, 0x5F, 0x15, 0x39,
-    0x28, 0x1A, 0xF8, 0x2F, 0x5B, 0xF9, 0xAA, 0xEE, 0x44, 0x8B, 0x6C, 0x7C, 0x30, 0xE9, 0x2B, 0x8E,
-    0x6D, 0x11, 0x77, 0x13, 0xDD, 0x7F, 0x24, 0x5B, 0xF6, 0x12, 0x3F, 0xD2, 0x1F, 0xFA, 0x4D, 0xC6,
-    0x77, 0x1C, 0x32, 0x96, 0xD6, 0xDB, 0x8C, 0x85, 0xC2, 0x44, 0xC8, 0x42, 0x87, 0x05, 0xD9, 0xE7,
-    0x79, 0x3E, 0xFA, 0xCE, 0x48, 0xC8, 0x18, 0x91, 0x94, 0x2B, 0xFA, 0x98, 0xF0, 0xB9, 0xE0, 0x7C,
-    0x64, 0xB0, 0xF7, 0xD4, 0x0A, 0x53, 0xF1, 0xE3, 0xBD, 0xC4, 0x0F, 0xFA, 0xD3, 0xF0, 0xAC, 0xBE,
-    0x03, 0xA9, 0x1D, 0x99, 0x8C, 0x07, 0x9F, 0x69, 0x56, 0x03, 0x78, 0x2B, 0x53, 0x3F, 0xA6, 0xF1,
-    0x9E, 0xEB, 0xA3, 0xEF, 0x11, 0x3C, 0x2E, 0xF1, 0xF9, 0xA1, 0x39, 0x97, 0xBE, 0x23, 0x9B, 0x12,
-    0x84, 0x70, 0x4C, 0x47, 0xA4, 0xEE, 0x78, 0x23, 0x6A, 0x8F, 0x73, 0xCE, 0x48, 0x96, 0x40, 0xA2,
-    0x04, 0x92, 0x24, 0x90, 0x20, 0x81, 0xE4, 0x08, 0xAE, 0x9E, 0x49, 0x52, 0xC4, 0xCB, 0x9E, 0xFF,
-    0x71, 0xCE, 0xCF, 0x5C, 0x92, 0xB9, 0x64, 0x1A, 0x66, 0x87, 0x8A, 0xC0, 0xD0, 0x3C, 0xC3, 0xF4,
-    0xBF, 0x96, 0xFB, 0xE1, 0x3A, 0x17, 0x85, 0xF7, 0x7A, 0x6A, 0x5C, 0x10, 0x41, 0xE9, 0x00, 0xE5,
-    0x6F, 0xDB, 0x37, 0xF4, 0xD2, 0x71, 0x40, 0xCD, 0xE3, 0x9E, 0x1B, 0x57, 0x3B, 0x1D, 0xD7, 0x7F,
-    0x7D, 0xE5, 0x71, 0x1D, 0x2B, 0x1E, 0x8F, 0x86, 0x0F, 0xFE, 0x49, 0xD3, 0x22, 0xEC, 0x07, 0x80,
-    0x33, 0xCA, 0x93, 0xCF, 0xDC, 0xBB, 0x0B, 0x77, 0xFF, 0xF2, 0xC4, 0x41, 0xDF, 0x41, 0x55, 0x33,
-    0x18, 0xA4, 0x28, 0xA6, 0xD0, 0x6C, 0xCC, 0xC1, 0x09, 0x4C, 0xA7, 0x86, 0xD5, 0x18, 0x29, 0x1B,
-    0x55, 0x6A, 0xCF, 0xE9, 0x67, 0xB1, 0xBB, 0x3D, 0xFE, 0x4F, 0x66, 0xAF, 0xA4, 0xC2, 0xBE, 0x8C,
-    0xCA, 0xB4, 0x78, 0x67, 0xD6, 0x69, 0x0B, 0x3E, 0x48, 0x1A, 0x70, 0xC2, 0x41, 0x6F, 0xAC, 0xA3,
-    0x92, 0x2C, 0x62, 0x6D, 0x41, 0xA9, 0xBC, 0xD5, 0x1E, 0x5E, 0x5E, 0x2B, 0xBA, 0x79, 0x8B, 0xB9,
-    0x27, 0xD8, 0x19, 0x96, 0x63, 0x6B, 0x46, 0x67, 0xD1, 0xD8, 0x36, 0x1B, 0x3F, 0xB2, 0x7A, 0x13,
-    0xB9, 0xE3, 0x5E, 0xE2, 0x0C, 0x35, 0x74, 0x93, 0x8B, 0xAE, 0x0A, 0x95, 0x0C, 0xFA, 0x18, 0x94,
-    0x31, 0xD1, 0xC4, 0xA0, 0x86, 0x85, 0x95, 0xD7, 0x8D, 0x39, 0x09, 0xA2, 0xD6, 0x76, 0x21, 0xF4,
-    0xE1, 0x4C, 0x14, 0x67, 0x84, 0x7A, 0x8E, 0xFC, 0xD3, 0x9B, 0xD1, 0x26, 0x19, 0x55, 0x10, 0xF0,
-    0x22, 0x96, 0x24, 0x43, 0x50, 0xAB, 0x7D, 0x68, 0x02, 0x4C, 0xC3, 0x09, 0xFF, 0x7B, 0x10, 0xF5,
-    0x39, 0x4B, 0xEF, 0x89, 0xD6, 0x78, 0x7E, 0xA2, 0x40, 0xBF, 0xF8, 0xBE, 0xF8, 0x25, 0x9F, 0xBC,
-    0xE6, 0x98, 0x20, 0xA3, 0xDF, 0x12, 0x9E, 0x62, 0x74, 0x6C, 0x9F, 0xB2, 0x40, 0xD6, 0x52, 0x69,
-    0x15, 0x70, 0x95, 0x0D, 0x29, 0xD8, 0x25, 0xAE, 0x35, 0xAE, 0x57, 0x68, 0x80, 0x8D, 0x64, 0xF0,
-    0xA8, 0x94, 0x96, 0x30, 0x40, 0x04, 0x84, 0xF4, 0x87, 0x97, 0x09, 0xD5, 0xA0, 0x52, 0xBD, 0xA2,
-    0x1F, 0x2B, 0xF8, 0xC4, 0x3A, 0x27, 0x66, 0xA1, 0x80, 0x77, 0xFE, 0x2F, 0xA8, 0x29, 0x5C, 0xA0,
-    0x0A, 0x53, 0x99, 0xF5, 0xFA, 0xB8, 0xD5, 0xCE, 0xB8, 0x4E, 0xCA, 0x39, 0x97, 0x6F, 0x19, 0xD0,
-    0x9C, 0x61, 0x70, 0x11, 0x63, 0xB1, 0x30, 0x2F, 0xA1, 0xF5, 0xA4, 0xE8, 0x32, 0xB2, 0x2D, 0x80,
-    0xE7, 0xEC, 0xC8, 0xE9, 0xDF, 0x4A, 0x71, 0xA9, 0x6B, 0xC5, 0xD3, 0xA5, 0xA2, 0xAE, 0x26, 0xA4,
-    0x6A, 0x71, 0x3D, 0x69, 0x3E, 0x18, 0x91, 0xAE, 0x2A, 0xA0, 0x6A, 0x80, 0xAA, 0xA3, 0xFB, 0xBF,
-    0xD5, 0xCB, 0xEA, 0xC6, 0xDC, 0xB2, 0x6D, 0x38, 0x54, 0x84, 0x3A, 0x83, 0x96, 0x93, 0xA8, 0xF8,
-    0x2B, 0x67, 0x92, 0x53, 0x8D, 0xEF, 0x47, 0x6C, 0x40, 0x35, 0x4C, 0x1D, 0x4A, 0x3C, 0xFB, 0x88,
-    0xF3, 0xAB, 0x34, 0x76, 0x9A, 0x31, 0x74, 0x1A, 0x5B, 0x87, 0x06, 0xF9, 0x7E, 0x46, 0x4A, 0xF8,
-    0xB6, 0x51, 0x69, 0x87, 0x76, 0x5C, 0xFF, 0x6B, 0xEB, 0xF5, 0xF6, 0xC6, 0x78, 0x55, 0xDB, 0x55,
-    0xE3, 0xEA, 0x6A, 0xB9, 0xAA, 0xE1, 0xBA, 0x33, 0x5D, 0xDB, 0x09, 0xD7, 0xB6, 0x8C, 0x39, 0xF8,
-    0x6D, 0x63, 0x26, 0x91, 0x3F, 0xE9, 0x75, 0xCC, 0x66, 0x3D, 0xE6, 0xC7, 0x94, 0xC4, 0xFF, 0xA6,
-    0x94, 0xC9, 0x39, 0xE6, 0x04, 0xAA, 0x75, 0xC9, 0x98, 0x6F, 0x15, 0x72, 0x3F, 0x09, 0x38, 0xE6,
-    0x3F, 0xB7, 0x1C, 0xF3, 0x25, 0xE4, 0x7D, 0x72, 0x9C, 0x79, 0xBD, 0xCE, 0xC9, 0x0B, 0x86, 0x8D,
-    0xF5, 0xAA, 0x56, 0xF4, 0xCE, 0xF6, 0xCE, 0x64, 0xD4, 0x37, 0xEC, 0x4C, 0x4F, 0xDF, 0x79, 0xBF,
-    0x8F, 0xA8, 0xDD, 0x63, 0xDB, 0x6C, 0x5A, 0xAF, 0xE6, 0x2E, 0x56, 0xD3, 0x24, 0xAC, 0x67, 0x4F,
-    0x46, 0x37, 0x3C, 0x59, 0xC8, 0x50, 0xEB, 0x41, 0x90, 0x10, 0x8E, 0x89, 0x52, 0xE3, 0x08, 0xE7,
-    0x95, 0x9F, 0xC0, 0x4D, 0x31, 0xF7, 0xDE, 0xE7, 0xDD, 0xEB, 0x9E, 0x5D, 0x27, 0x3A, 0xE1, 0x18,
-    0xDB, 0xFA, 0xBB, 0x78, 0x93, 0xDB, 0x54, 0x35, 0x49, 0xF4, 0x23, 0xAF, 0x5E, 0xD7, 0x34, 0x4B,
-    0x33, 0xA6, 0xBC, 0x7D, 0x1D, 0xB8, 0xDC, 0x38, 0xE9, 0x96, 0xEA, 0xCF, 0xB1, 0xAA, 0x67, 0x21,
-    0xD7, 0x0D, 0xE2, 0xC3, 0x4B, 0x95, 0x43, 0xE3, 0x0A, 0xF8, 0x4E, 0x4A, 0xE0, 0x3B, 0x59, 0x72,
-    0x6F, 0x65, 0x5F, 0xEF, 0xB3, 0x6D, 0xBF, 0x66, 0x7C, 0x0B, 0xE6, 0x2E, 0x2F, 0xB1, 0xD4, 0x0B,
-    0xC1, 0x5D, 0x26, 0xB2, 0x5C, 0x96, 0xB5, 0xCC, 0x16, 0x0B, 0xF6, 0xE7, 0x5C, 0xF1, 0xFB, 0x2A,
-    0xC8, 0x8E, 0xA8, 0xA9, 0x34, 0x75, 0x95, 0x48, 0xD5, 0xE6, 0x45, 0x59, 0xF4, 0x7A, 0xAA, 0x46,
-    0xB3, 0xC7, 0x1C, 0x91, 0x75, 0x6B, 0x90, 0x0F, 0x52, 0x89, 0x36, 0xF3, 0x52, 0x50, 0xE6, 0xF6,
-    0x01, 0x6E, 0x03, 0xFE, 0x73, 0x23, 0x20, 0x46, 0x6E, 0x4A, 0x2E, 0x6F, 0x2B, 0xB9, 0x37, 0xB0,
-    0xC9, 0xF0, 0xDF, 0xDD, 0xF4, 0xA8, 0x51, 0xF6, 0xFB, 0x68, 0xFF, 0x9D, 0xB2, 0xDB, 0x72, 0x7F,
-    0xB6, 0xDC, 0x97, 0xDB, 0xF5, 0x3D, 0x33, 0x0D, 0x2D, 0xB1, 0xCD, 0xD9, 0xFE, 0xFD, 0x0B, 0xA2,
-    0xEC, 0xD9, 0xD6, 0xE7, 0x2F, 0x52, 0x8C, 0x09, 0x36, 0xCA, 0x98, 0x33, 0x14, 0x42, 0xBF, 0x90,
-    0xCF, 0x6B, 0xF2, 0xF9, 0xDD, 0xAF, 0xB6, 0x3E, 0x21, 0x7D, 0xCD, 0x18, 0xAB, 0x34, 0x73, 0xDD,
-    0xE1, 0x23, 0x55, 0x04, 0x12, 0xDD, 0xDA, 0xEF, 0x19, 0xB3, 0x95, 0x37, 0x8B, 0xD9, 0x22, 0xC1,
-    0x79, 0xB0, 0x7C, 0xA5, 0x65, 0x0A, 0x78, 0x56, 0xFA, 0x40, 0x0D, 0xE8, 0xD5, 0x63, 0xBB, 0xF4,
-    0xE0, 0xBE, 0x21, 0x28, 0x00, 0xFE, 0x4F, 0xDE, 0x2C, 0xA0, 0x81, 0x42, 0x26, 0x40, 0x76, 0x68,
-    0x80, 0x78, 0x20, 0x08, 0x6D, 0x0A, 0x20, 0xDA, 0x1D, 0x80, 0x6F, 0x6B, 0x00, 0xD1, 0xD9, 0x08,
-    0x92, 0x8E, 0x20, 0xB2, 0x04, 0x73, 0xFB, 0xB7, 0x00, 0x81, 0x7D, 0x00, 0xC0, 0xF9, 0x37, 0x8C,
-    0x2E, 0x03, 0x24, 0x0A, 0xA4, 0x3B, 0x9F, 0x31, 0xD8, 0x74, 0x46, 0x3B, 0x2E, 0xA5, 0xCC, 0x74,
-    0x80, 0x11, 0xF3, 0x8B, 0xEF, 0x4E, 0x55, 0xFE, 0x5C, 0x25, 0xAA, 0x8A, 0x2B, 0xCD, 0x7D, 0x1E,
-    0xDD, 0xD6, 0xDE, 0xB6, 0x5A, 0x0F, 0x57, 0x62, 0x22, 0x7A, 0x1D, 0x1C, 0xE6, 0xF6, 0x43, 0xCC,
-    0x30, 0x18, 0x5D, 0x89, 0xDD, 0xDA, 0x33, 0x45, 0xE0, 0x1D, 0x8B, 0x2B, 0xF1, 0xB4, 0xD3, 0xE1,
-    0x70, 0x5D, 0x53, 0xC1, 0x30, 0x4D, 0xCA, 0x77, 0x39, 0xF9, 0x41, 0xB5, 0x45, 0x95, 0x93, 0x46,
-    0x8E, 0x83, 0x7F, 0xAA, 0x52, 0x9A, 0x59, 0xBB, 0x15, 0x09, 0xD1, 0x39, 0xA8, 0xA6, 0xE6, 0x0A,
-    0x63, 0x46, 0x1F, 0xCF, 0x6D, 0xE4, 0x76, 0xC2, 0x4B, 0xC2, 0xBC, 0xFD, 0xB8, 0x64, 0x97, 0xE1,
-    0xE3, 0x4E, 0x57, 0xA8, 0xE6, 0xE3, 0xBB, 0x38, 0xC2, 0x22, 0x3D, 0x23, 0xAB, 0x51, 0x66, 0x7C,
-    0x9B, 0xB5, 0x0B, 0x70, 0xBC, 0x18, 0xDF, 0x65, 0xB3, 0xDA, 0xAD, 0x6C, 0x56, 0xCD, 0x2C, 0x34,
-    0x3B, 0x57, 0x4E, 0xF4, 0x6A, 0x9C, 0xB9, 0xB8, 0x5E, 0xDC, 0x6C, 0x79, 0x14, 0xD6, 0x50, 0x93,
-    0xD1, 0x0D, 0xCA, 0x41, 0x36, 0xBC, 0x7D, 0x55, 0x6C, 0x18, 0xB1, 0xBE, 0xE6, 0xB0, 0x64, 0x65,
-    0x27, 0x88, 0x65, 0x36, 0x71, 0x21, 0xD4, 0x14, 0xBB, 0xFC, 0x3A, 0x42, 0x27, 0xA1, 0x15, 0xC1,
-    0x2B, 0xB3, 0x61, 0x2C, 0x3F, 0x80, 0x49, 0x40, 0xB8, 0x1C, 0x61, 0xF0, 0x32, 0xE0, 0x0C, 0x90,
-    0xB9, 0x91, 0x65, 0xA0, 0xFB, 0x64, 0xCF, 0xEA, 0x16, 0x85, 0x47, 0xC3, 0x5F, 0x81, 0xF2, 0x97,
-    0xE7, 0xF8, 0x2B, 0x6F, 0x95, 0xBF, 0x7A, 0x82, 0x50, 0xF9, 0x6B, 0xA6, 0xFC, 0xE5, 0x3B, 0xC6,
-    0xB2, 0x5B, 0x8C, 0x15, 0x29, 0x98, 0x2B, 0x7F, 0x05, 0xCA, 0x5F, 0x9E, 0x63, 0xAC, 0x5C, 0x81,
-    0xAA, 0xC2, 0x63, 0xD8, 0xD1, 0x01, 0x57, 0xEF, 0x93, 0x98, 0x29, 0xB8, 0x37, 0x25, 0x8D, 0x7A,
-    0x4C, 0x4C, 0xB2, 0xEF, 0xD8, 0x4C, 0xB9, 0x4C, 0x99, 0x4C, 0x79, 0x4C, 0x59, 0x4C, 0x39, 0x4C,
-    0x19, 0x6C, 0xAD, 0x52, 0x29, 0xA7, 0x3C, 0xE3, 0xBF, 0x8A, 0x86, 0x6F, 0x43, 0x23, 0x58, 0x98,
-    0xA9, 0x24, 0x4B, 0x1D, 0x6E, 0x2E, 0xFB, 0x6A, 0xF5, 0xB1, 0x55, 0x67, 0xD6, 0xB5, 0x61, 0x13,
-    0xF0, 0x45, 0x5C, 0xD6, 0x5F, 0xAD, 0x6E, 0xF2, 0x46, 0x8A, 0x0C, 0x07, 0xCC, 0x62, 0x31, 0xD9,
-    0xC1, 0xBD, 0x9C, 0x7D, 0x45, 0x96, 0xE1, 0xE7, 0xFC, 0xE1, 0x9F, 0x30, 0x68, 0x57, 0x60, 0x2F,
-    0x44, 0x9F, 0x71, 0x47, 0xBF, 0x98, 0x7C, 0xE0, 0x81, 0x11, 0xCB, 0x2C, 0x61, 0x01, 0x15, 0x63,
-    0xC0, 0xF2, 0xE6, 0xBC, 0x9D, 0x02, 0x97, 0x29, 0xF9, 0x65, 0x20, 0x6F, 0xA6, 0x0F, 0x64, 0x0A,
-    0xB4, 0xCF, 0x65, 0xCC, 0x9A, 0xAD, 0xF1, 0x7D, 0xB0, 0x02, 0xE5, 0x1B, 0x4C, 0x2F, 0xA3, 0xE3,
-    0x66, 0x57, 0xB5, 0x48, 0x8A, 0x57, 0x5F, 0x73, 0xF3, 0x5D, 0x5A, 0x3B, 0xF3, 0x61, 0x35, 0x17,
-    0xD6, 0xB5, 0xD3, 0x58, 0x81, 0x77, 0x75, 0x8F, 0x5E, 0x88, 0x61, 0x34, 0xB8, 0x85, 0x43, 0x64,
-    0x76, 0x21, 0x93, 0x85, 0xA3, 0x0E, 0xA1, 0x75, 0x9D, 0xA5, 0xC6, 0xBC, 0x93, 0x96, 0xD3, 0xFC,
-    0xF2, 0x96, 0x77, 0xEA, 0x53, 0xF2, 0xB8, 0x74, 0xA2, 0x3F, 0xC9, 0xDA, 0x81, 0x0E, 0xA1, 0x3A,
-    0xE6, 0x25, 0x2D, 0x6E, 0x64, 0xD9, 0x9C, 0xBF, 0x34, 0xB7, 0xB8, 0x6D, 0x81, 0x51, 0x4D, 0xD0,
-    0xCE, 0xD4, 0x6A, 0x57, 0x11, 0x9E, 0xAB, 0xCA, 0xE5, 0x64, 0x9B, 0x99, 0xEE, 0x87, 0x67, 0x81,
-    0x3A, 0x5A, 0xFC, 0xF9, 0x0E, 0x57, 0x9B, 0x06, 0xB9, 0x63, 0x62, 0x46, 0x8B, 0x3E, 0x55, 0xFB,
-    0x9E, 0xC6, 0x36, 0x4E, 0x02, 0xBD, 0xCC, 0xB9, 0x5B, 0x97, 0xB1, 0x72, 0xE2, 0x9A, 0xDB, 0x4F,
-    0x56, 0x70, 0x79, 0xD9, 0x37, 0x98, 0xCC, 0xD8, 0xD3, 0x2B, 0x14, 0x34, 0xCC, 0xC2, 0xF4, 0xD2,
-    0x9D, 0x33, 0x46, 0x2F, 0x6F, 0xB5, 0xFB, 0x2E, 0x9C, 0x49, 0x28, 0x90, 0x9A, 0x77, 0x11, 0x6A,
-    0xD2, 0x6A, 0xF8, 0x13, 0x92, 0x02, 0xB4, 0xCB, 0xB8, 0x59, 0x9D, 0x9F, 0x18, 0x01, 0x27, 0x82,
-    0x5E, 0x13, 0x02, 0x58, 0x7A, 0x45, 0x23, 0x0D, 0x92, 0x57, 0x24, 0xC2, 0xA3, 0x55, 0x5E, 0x81,
-    0x0C, 0x22, 0xFF, 0xE6, 0x15, 0x08, 0x21, 0xBD, 0x04, 0xAC, 0x2F, 0xE2, 0x05, 0x88, 0xC1, 0x0B,
-    0x26, 0xB8, 0xD4, 0xAE, 0x58, 0x88, 0x17, 0x40, 0xED, 0xF6, 0x05, 0x50, 0xCF, 0xE4, 0x54, 0x5E,
-    0xC0, 0x0F, 0xBE, 0x7D, 0xB1, 0xFE, 0xA9, 0x76, 0x59, 0xAC, 0xDB, 0x8F, 0x67, 0xE3, 0xC5, 0xFA,
-    0x5D, 0xB1, 0xBB, 0xB8, 0xEB, 0xC6, 0x63, 0x3A, 0x10, 0x8B, 0x17, 0x81, 0xB2, 0x8E, 0xD7, 0x91,
-    0x60, 0x5F, 0x2C, 0xDE, 0xEC, 0x48, 0x32, 0x66, 0xA3, 0xF8, 0xE3, 0xC5, 0xBA, 0xB6, 0x07, 0x79,
-    0xA5, 0xDF, 0xFC, 0x09, 0x69, 0xD1, 0xF9, 0x1A, 0x2D, 0xB7, 0xF6, 0xFB, 0x96, 0xAE, 0xF1, 0x34,
-    0xB3, 0xB5, 0xE2, 0x53, 0xCC, 0x4A, 0x45, 0x69, 0x08, 0x5D, 0x82, 0x48, 0x86, 0x12, 0xA1, 0x38,
-    0x4F, 0x05, 0x39, 0x24, 0xC1, 0xFA, 0x02, 0x39, 0x2C, 0xDB, 0x17, 0x3F, 0x5D, 0x2C, 0x94, 0x4C,
-    0xA9, 0x06, 0x16, 0xDC, 0x45, 0xE7, 0x32, 0x4C, 0xD9, 0x61, 0x21, 0x0B, 0x1A, 0x6F, 0x11, 0x42,
-    0xFC, 0x0E, 0x69, 0x27, 0x18, 0xB9, 0x4E, 0xF2, 0xD9, 0xE1, 0x6F, 0x7A, 0xA2, 0xEB, 0x8F, 0x99,
-    0x40, 0x84, 0x62, 0xA6, 0x9C, 0xCF, 0x2D, 0xC6, 0x7A, 0x18, 0x73, 0xF5, 0x96, 0xD9, 0x54, 0xC7,
-    0xFA, 0x6A, 0x8D, 0xCD, 0x86, 0x69, 0xE9, 0x6D, 0xAC, 0x0E, 0xA5, 0xF3, 0xE6, 0x69, 0x45, 0x4D,
-    0x97, 0xEC, 0xFD, 0x3B, 0x1A, 0x16, 0x0A, 0x5C, 0xF4, 0x4C, 0xDD, 0xC2, 0xC6, 0xAA, 0x0F, 0x29,
-    0x3F, 0x14, 0x34, 0x93, 0x3B, 0x5D, 0xD4, 0x6D, 0xE6, 0xD0, 0xD8, 0x2B, 0x73, 0x57, 0x00, 0xF7,
-    0x9D, 0xB7, 0x3D, 0xA3, 0xB7, 0xBD, 0x4A, 0xF8, 0x5B, 0x15, 0xD1, 0xA1, 0x5B, 0xA9, 0xB7, 0xBD,
-    0x72, 0xC1, 0xB2, 0x60, 0x7C, 0xAD, 0x7A, 0xDB, 0xF3, 0x8E, 0x49, 0x30, 0xEA, 0x6D, 0x5F, 0x86,
-    0xB4, 0xF8, 0x97, 0x1E, 0x48, 0xCD, 0x02, 0x5C, 0xEE, 0x00, 0x54, 0x39, 0xF2, 0xD2, 0x25, 0x4D,
-    0x53, 0x17, 0x9E, 0x1A, 0x9F, 0x17, 0xD3, 0xC4, 0xDE, 0x40, 0x42, 0xC0, 0x87, 0x50, 0x3C, 0x3E,
-    0xB2, 0x9D, 0x28, 0x5E, 0x91, 0x34, 0x6D, 0x88, 0xCA, 0xE0, 0x39, 0x2B, 0x75, 0xD4, 0x36, 0x70,
-    0xCD, 0x33, 0x38, 0x96, 0x12, 0xCB, 0x70, 0x22, 0x22, 0x54, 0xA7, 0x1B, 0x9B, 0xDB, 0x7F, 0xBB,
-    0x6A, 0x7D, 0xCD, 0x9B, 0x69, 0x15, 0x77, 0x54, 0x4E, 0x39, 0xC9, 0xE9, 0x7E, 0xE7, 0x8F, 0x15,
-    0xC9, 0x93, 0xBF, 0xCB, 0xB4, 0xF6, 0xB0, 0xD5, 0xE4, 0xE9, 0x68, 0xF2, 0x42, 0xCE, 0xFA, 0xF5,
-    0x5A, 0x23, 0xF8, 0x0E, 0xF3, 0xE5, 0x65, 0xC0, 0x1C, 0xB9, 0x66, 0xCC, 0xBB, 0x94, 0xF9, 0x31,
-    0x67, 0x7E, 0x74, 0x60, 0x5C, 0xD8, 0x3B, 0x23, 0xEB, 0x62, 0x4C, 0xA9, 0xCF, 0x04, 0x6D, 0x37,
-    0xC6, 0x5A, 0x9C, 0xC3, 0x52, 0xEA, 0x8F, 0x91, 0x64, 0x70, 0x93, 0x05, 0x5A, 0x72, 0x6B, 0x34,
-    0x4E, 0xA1, 0xEE, 0xB1, 0x7C, 0x4B, 0x22, 0x5D, 0x72, 0xE9, 0xFD, 0xCB, 0x60, 0x78, 0x43, 0x26,
-    0xDF, 0x20, 0xB3, 0x5F, 0x26, 0x58, 0x27, 0xB5, 0x89, 0xD8, 0x14, 0xB2, 0xCE, 0x5F, 0x51, 0x8B,
-    0x30, 0x81, 0x88, 0xE3, 0xD4, 0x42, 0x48, 0xED, 0x80, 0x82, 0x31, 0xD7, 0x52, 0x4F, 0x5A, 0x9A,
-    0x18, 0xFA, 0x9C, 0xDA, 0x92, 0x4C, 0x0B, 0x12, 0x56, 0x54, 0xA9, 0xB0, 0x17, 0x93, 0x39, 0xEC,
-    0x44, 0x3D, 0x99, 0xA3, 0x09, 0xDB, 0xAC, 0x16, 0x6D, 0x45, 0x70, 0x9E, 0x97, 0xC8, 0xCD, 0x74,
-    0xD5, 0xAB, 0xBA, 0x35, 0xC0, 0xCB, 0xC5, 0xED, 0xA6, 0x62, 0x95, 0x0D, 0x3C, 0x5B, 0xF3, 0x6A,
-    0x13, 0x1D, 0xDA, 0xBD, 0x85, 0xCD, 0xA4, 0x0C, 0x87, 0xBC, 0x49, 0xAA, 0x79, 0x97, 0x14, 0x41,
-    0x97, 0x15, 0x7E, 0x93, 0x55, 0x5E, 0x8A, 0x48, 0x22, 0xFC, 0x9A, 0xB2, 0xEB, 0xA4, 0x48, 0x1B,
-    0xF5, 0x31, 0x36, 0xD6, 0x16, 0xE4, 0xC3, 0x37, 0x64, 0x4C, 0x90, 0xE9, 0xB9, 0xF1, 0x87, 0x3C,
-    0x0D, 0xFA, 0xAC, 0x9C, 0xB7, 0xC8, 0x53, 0x9A, 0x61, 0xE4, 0x60, 0x41, 0x6F, 0xB5, 0x74, 0xB5,
-    0x3D, 0x2C, 0x08, 0x8F, 0x3F, 0x46, 0xFC, 0x36, 0x1D, 0xB0, 0x9D, 0xC9, 0xB2, 0xDB, 0x14, 0x84,
-    0x9F, 0x24, 0x5C, 0xA1, 0x36, 0x3F, 0x61, 0x79, 0xA3, 0xF1, 0xFB, 0xA4, 0x40, 0x4D, 0x3E, 0x2A,
-    0xF2, 0x77, 0x46, 0xAF, 0xE7, 0x51, 0xE1, 0xEA, 0x44, 0x21, 0x82, 0x82, 0xF2, 0xE1, 0x3A, 0xAE,
-    0x08, 0x15, 0x50, 0x9D, 0x56, 0x90, 0x9D, 0xDF, 0xBA, 0x56, 0x41, 0xC3, 0x28, 0x9C, 0x1B, 0xE3,
-    0x28, 0x10, 0x82, 0x7A, 0x37, 0x78, 0xC7, 0xC2, 0xDE, 0xED, 0x82, 0xF0, 0x11, 0xCA, 0xE7, 0x67,
-    0x72, 0xCD, 0xE8, 0x7A, 0x85, 0xC4, 0xBC, 0x73, 0x4B, 0x91, 0x93, 0x94, 0x0C, 0xF0, 0x3C, 0x3C,
-    0x6E, 0xDD, 0x11, 0x24, 0x07, 0x24, 0xC3, 0x09, 0x62, 0x2E, 0x14, 0xC7, 0x87, 0x15, 0xFC, 0x5B,
-    0xB1, 0x88, 0xA3, 0x7C, 0xC9, 0xA2, 0x63, 0xBC, 0x78, 0x2C, 0x88, 0x3F, 0x22, 0xE6, 0x62, 0xFA,
-    0xE7, 0xA0, 0xC0, 0x9A, 0xEC, 0xF3, 0x7C, 0x58, 0x59, 0x11, 0x57, 0xA8, 0x34, 0x32, 0xEF, 0x2B,
-    0xB8, 0x0B, 0x10, 0x8F, 0xE0, 0x6D, 0x80, 0x73, 0xEB, 0x7A, 0xFD, 0x63, 0x00, 0x49, 0xEF, 0x82,
-    0xE9, 0x9A, 0xAC, 0xC1, 0xED, 0xCC, 0x01, 0x13, 0xA8, 0x83, 0x74, 0xF6, 0xD9, 0x56, 0xB6, 0x4E,
-    0xEE, 0x36, 0x6E, 0xFD, 0x51, 0x8F, 0x37, 0xF9, 0xA9, 0x3A, 0x09, 0xDD, 0xF1, 0x4F, 0x39, 0x1F,
-    0x98, 0x17, 0x5A, 0x2E, 0x87, 0x8C, 0xE2, 0x44, 0x83, 0x1F, 0x63, 0xD2, 0xE6, 0x37, 0xED, 0xFD,
-    0xBD, 0xE7, 0x09, 0x6E, 0x52, 0x33, 0xB5, 0xC3, 0x3F, 0xC8, 0x70, 0xE1, 0x00, 0xAD, 0x8D, 0xFF,
-    0x99, 0xCB, 0x16, 0x03, 0xFF, 0x60, 0x17, 0xC7, 0x16, 0x2D, 0x9F, 0xDF, 0x13, 0x7E, 0x80, 0xE3,
-    0x32, 0x6E, 0xC7, 0x93, 0x11, 0xDC, 0xD1, 0x08, 0xE3, 0xD9, 0x08, 0xEE, 0x70, 0x04, 0x37, 0xEF,
-    0x11, 0x19, 0xD3, 0xF3, 0x11, 0x4E, 0x39, 0xED, 0xCC, 0xC5, 0xE5, 0x48, 0xA4, 0xCC, 0x95, 0x05,
-    0xCE, 0x4B, 0x1C, 0xD1, 0x53, 0x42, 0xF7, 0x2F, 0xF7, 0xDD, 0xDE, 0x09, 0xA4, 0x7E, 0xD7, 0xAA,
-    0x1F, 0xB5, 0x36, 0xA0, 0xCB, 0x8B, 0x87, 0x4A, 0xD5, 0x7E, 0xB0, 0xC3, 0x7B, 0xAE, 0x28, 0x88,
-    0xEB, 0x1A, 0x72, 0xE1, 0x48, 0x50, 0xBA, 0xC8, 0x7A, 0x88, 0x1C, 0x16, 0x29, 0x8A, 0x8E, 0x20,
-    0x7D, 0xA6, 0x2F, 0x01, 0xA5, 0x5A, 0x47, 0xAF, 0x07, 0x1E, 0x39, 0xF0, 0x8C, 0xFC, 0x7C, 0xD9,
-    0x7E, 0xBE, 0x8F, 0x9C, 0x6C, 0xF9, 0x2D, 0xFD, 0xCA, 0xFC, 0x6C, 0xAE, 0x68, 0x4D, 0x06, 0xED,
-    0xFA, 0x81, 0xDB, 0x41, 0x66, 0x7F, 0x51, 0xEB, 0xFC, 0x80, 0xDA, 0x96, 0xF2, 0xDF, 0xAB, 0x7D,
-    0xB7, 0x18, 0x5F, 0x9D, 0xF2, 0x6B, 0x29, 0x62, 0x29, 0x63, 0xFE, 0x70, 0x3F, 0x63, 0x86, 0xB8,
-    0x9E, 0xE0, 0x94, 0x98, 0xAF, 0x0B, 0xC0, 0x08, 0xBF, 0xAE, 0x36, 0x7D, 0xCF, 0x73, 0x77, 0x7C,
-    0x16, 0xB0, 0xDC, 0xBF, 0xC6, 0xDD, 0x42, 0x33, 0x29, 0xAF, 0xB9, 0x93, 0xC8, 0x74, 0xDF, 0xF8,
-    0x11, 0xFD, 0x51, 0xA2, 0xE3, 0xBE, 0x4E, 0xC4, 0x3F, 0x7C, 0x5F, 0x53, 0xBD, 0xB9, 0x47, 0x50,
-    0x23, 0x34, 0xAF, 0xD1, 0x44, 0x3B, 0xF4, 0x2F, 0x81, 0xEB, 0xB6, 0x1C, 0x01, 0x73, 0x82, 0x88,
-    0x67, 0xFF, 0x85, 0xA2, 0x0D, 0x23, 0x70, 0x09, 0xEF, 0x81, 0xD2, 0x4D, 0x41, 0x83, 0x70, 0xAF,
-    0x6C, 0x54, 0x03, 0x27, 0x8C, 0x1C, 0x2E, 0x9E, 0x4E, 0xC2, 0xB3, 0x85, 0x9C, 0x6F, 0xE0, 0xDC,
-    0x8A, 0x0C, 0x19, 0x69, 0xAC, 0xD7, 0x81, 0xC9, 0xA9, 0x07, 0x67, 0x83, 0x70, 0xBB, 0x2B, 0x06,
-    0xB1, 0x67, 0xAA, 0xAA, 0x3B, 0xE0, 0x2D, 0x16, 0xE9, 0xA9, 0xA0, 0xD1, 0xB7, 0x35, 0x79, 0xF4,
-    0x75, 0xC3, 0xB3, 0x4B, 0x92, 0x65, 0xE6, 0x28, 0xA6, 0xDB, 0x5E, 0x37, 0x0D, 0xFA, 0x6D, 0xA5,
-    0x82, 0x9F, 0x05, 0xC2, 0x2D, 0xCD, 0x4D, 0x0A, 0x37, 0x1A, 0xBC, 0xB3, 0x86, 0xDA, 0x66, 0xE0,
-    0x2C, 0x2E, 0x97, 0x3F, 0x14, 0xF7, 0x4F, 0xFA, 0xC7, 0x4F, 0x30, 0x35, 0x5D, 0x5A, 0xB8, 0xAB,
-    0x7B, 0x99, 0xFF, 0x4A, 0x33, 0x09, 0x53, 0xAD, 0xDF, 0xD7, 0x5A, 0xDD, 0x30, 0x7D, 0x8F, 0xE0,
-    0x97, 0xCD, 0xB4, 0x30, 0xEC, 0xEA, 0x19, 0xA3, 0xAD, 0xD9, 0x55, 0x7D, 0xC6, 0x9D, 0x07, 0x38,
-    0xD0, 0x50, 0xF6, 0xEA, 0x30, 0xA5, 0x7F, 0x83, 0xC0, 0xFD, 0xCF, 0xF4, 0x99, 0xDE, 0xA9, 0x4F,
-    0xEF, 0xEE, 0x9F, 0x12, 0x4A, 0xAF, 0x6E, 0xAC, 0xB8, 0x36, 0xFF, 0x60, 0xA0, 0x4B, 0x86, 0x19,
-    0x98, 0xB3, 0x96, 0x66, 0x53, 0x58, 0x51, 0xF9, 0x89, 0x97, 0xF7, 0xD4, 0x3D, 0x70, 0xFE, 0x8C,
-    0xD1, 0xF6, 0xF2, 0xCD, 0xAB, 0x14, 0x56, 0x95, 0xE6, 0x90, 0xDF, 0xD0, 0xEC, 0x64, 0x26, 0xCF,
-    0x06, 0x1D, 0x5D, 0x6D, 0x73, 0x9E, 0x0C, 0x73, 0x20, 0x4E, 0x72, 0x62, 0xA9, 0x09, 0x5D, 0x29,
-    0xB4, 0x03, 0xD4, 0x29, 0x51, 0xB8, 0x76, 0xED, 0x90, 0x7A, 0x79, 0x49, 0xEF, 0xBD, 0x98, 0x7A,
-    0x40, 0xCF, 0xB1, 0x80, 0xCC, 0x81, 0x96, 0x79, 0x21, 0x48, 0xDE, 0x4F, 0xD4, 0x52, 0xD4, 0x53,
-    0x2E, 0x3D, 0x86, 0x76, 0xEE, 0xBF, 0xD9, 0x32, 0x74, 0xE3, 0x92, 0xAC, 0xD5, 0xE8, 0x89, 0xA7,
-    0x99, 0x5A, 0x63, 0xCE, 0x4C, 0xBB, 0x05, 0xDC, 0x97, 0xF6, 0xD7, 0xBA, 0xA1, 0xB8, 0xE7, 0x1E,
-    0x9E, 0x54, 0xAA, 0xF8, 0xCD, 0xB4, 0x6E, 0xD8, 0xC5, 0xF1, 0xB5, 0x54, 0xD6, 0x65, 0xA3, 0x8F,
-    0x89, 0x42, 0xF9, 0x63, 0x97, 0x2A, 0x52, 0x4C, 0xCB, 0x3C, 0xDC, 0xF1, 0x17, 0x93, 0xA2, 0xF9,
-    0xC9, 0x4D, 0x7C, 0xEC, 0xFB, 0xA3, 0xC7, 0xD8, 0xEB, 0x1D, 0x72, 0x98, 0x94, 0x7A, 0x6F, 0xFC,
-    0x36, 0xDD, 0x0A, 0x34, 0xE8, 0x8E, 0x24, 0x3D, 0xDD, 0x42, 0x50, 0x84, 0xAE, 0x05, 0x0F, 0x21,
-    0x0F, 0x4B, 0x0B, 0xC3, 0xEF, 0x59, 0x13, 0x80, 0x79, 0x21, 0x1D, 0x3B, 0x2E, 0x5C, 0xF5, 0x2B,
-    0x3D, 0xCD, 0x1E, 0x8B, 0x82, 0x53, 0x46, 0x42, 0x79, 0xD2, 0x67, 0x41, 0xC7, 0x33, 0x8E, 0x9E,
-    0x73, 0x97, 0xC2, 0x68, 0x31, 0xF2, 0x32, 0x55, 0x5C, 0x26, 0xF2, 0xCB, 0xFB, 0x1A, 0x5B, 0x79,
-    0x5D, 0x38, 0xA3, 0xD3, 0x4D, 0xF0, 0x1D, 0xE1, 0x07, 0x77, 0x38, 0x5C, 0x97, 0x74, 0xD4, 0xCE,
-    0x51, 0x16, 0x18, 0xF5, 0xDC, 0x3B, 0xE7, 0xD6, 0x6B, 0xC2, 0x21, 0xD0, 0xF3, 0x0F, 0x6E, 0x08,
-    0x13, 0x33, 0x55, 0x2A, 0xB0, 0x1F, 0xD4, 0x33, 0xFB, 0x87, 0xAC, 0xAA, 0xB5, 0xFF, 0x2C, 0xD8,
-    0xFF, 0xCB, 0x82, 0x7B, 0xD3, 0x27, 0x42, 0x8F, 0x8F, 0x88, 0x09, 0xFB, 0xA0, 0xF0, 0xEC, 0xA7,
-    0xCB, 0x71, 0xBF, 0xB5, 0x8A, 0x2A, 0x9C, 0xD6, 0x92, 0xDB, 0xB5, 0x7D, 0xE7, 0xEC, 0x54, 0x9E,
-    0x92, 0xE6, 0xF8, 0xA6, 0x5F, 0x6F, 0xCC, 0x38, 0x62, 0x53, 0x0F, 0x55, 0x24, 0x08, 0xC7, 0xE4,
-    0x16, 0x57, 0xF7, 0xEC, 0xCE, 0x50, 0x32, 0xCE, 0x1B, 0xC8, 0x87, 0x3F, 0x76, 0xF7, 0x64, 0xA9,
-    0xA3, 0x64, 0x37, 0x3A, 0xE4, 0xF7, 0xCC, 0xCE, 0x53, 0x94, 0x6B, 0x2B, 0x0A, 0x52, 0x66, 0x0B,
-    0x5C, 0x64, 0xB8, 0xC0, 0xB6, 0xC9, 0x94, 0x0F, 0x38, 0xAB, 0xEC, 0x12, 0x09, 0x62, 0x60, 0xB6,
-    0x02, 0x28, 0x20, 0x9F, 0x01, 0x01, 0xB9, 0x70, 0x5A, 0x85, 0x02, 0x85, 0xAC, 0x9E, 0xDB, 0x1A,
-    0x36, 0x54, 0xD2, 0x84, 0x79, 0x03, 0x45, 0x2B, 0x6E, 0xA3, 0xB8, 0xC5, 0xF6, 0x13, 0x75, 0x71,
-    0xD8, 0xC5, 0x1C, 0xFD, 0x6B, 0x61, 0x4F, 0xCD, 0xBF, 0xFF, 0xF1, 0x7C, 0x78, 0x8D, 0xD1, 0xA7,
-    0xBB, 0x81, 0xFD, 0x31, 0xE7, 0xD0, 0x04, 0x3C, 0xF5, 0x35, 0x40, 0xC2, 0x87, 0x66, 0x8F, 0xD6,
-    0x9B, 0x5A, 0x1A, 0x77, 0xA0, 0x6B, 0xE1, 0x8C, 0x03, 0x31, 0xEE, 0xD5, 0x3F, 0xB1, 0x3E, 0x82,
-    0x25, 0x9D, 0xF0, 0x9E, 0xF2, 0x9D, 0xE3, 0x39, 0xC7, 0x6F, 0x5B, 0xBC, 0x66, 0x59, 0xF3, 0x5D,
-    0x6B, 0xA9, 0x74, 0x1D, 0xD9, 0x87, 0x08, 0x15, 0xC3, 0x73, 0x2E, 0x4C, 0x86, 0xD7, 0x42, 0x38,
-    0x23, 0xB8, 0xD7, 0x90, 0x6F, 0x30, 0x5F, 0x61, 0x14, 0xCC, 0x2D, 0x1E, 0xA8, 0x42, 0x22, 0x84,
-    0xAA, 0x47, 0x26, 0xBC, 0xAE, 0x79, 0x22, 0x77, 0x55, 0x83, 0xD4, 0x83, 0x13, 0xFF, 0x87, 0x63,
-    0xCD, 0x1E, 0x57, 0x93, 0x21, 0x45, 0xBA, 0x66, 0xC2, 0xF1, 0xA8, 0x89, 0xAF, 0x0A, 0x68, 0x0E,
-    0xF2, 0x4C, 0x80, 0x0D, 0x30, 0x57, 0x6F, 0xAE, 0x93, 0x51, 0xF4, 0x84, 0xDC, 0xF9, 0x17, 0x96,
-    0x12, 0x0A, 0xCE, 0x9A, 0x8C, 0xD5, 0xFE, 0xE7, 0x0F, 0xE6, 0x55, 0x8A, 0x8D, 0x15, 0xD9, 0x4A,
-    0x2C, 0xDD, 0x88, 0x11, 0x03, 0xCF, 0x72, 0xBD, 0x74, 0xF4, 0xAC, 0x20, 0xE4, 0x59, 0x30, 0xBB,
-    0xAC, 0x24, 0x6D, 0x6B, 0x10, 0x36, 0xAB, 0x41, 0xD5, 0xA4, 0x85, 0x78, 0x88, 0x3B, 0xCC, 0x3A,
-    0xEA, 0x22, 0x16, 0x73, 0x25, 0x5C, 0x01, 0xAF, 0xF1, 0xED, 0x77, 0x49, 0xA8, 0xE9, 0x81, 0x91,
-    0x3A, 0xF9, 0x69, 0xAE, 0xFC, 0x24, 0x63, 0x3E, 0xDF, 0xD4, 0xB8, 0x68, 0x1E, 0x10, 0x13, 0xB9,
-    0xBE, 0xEB, 0xB2, 0x7C, 0x59, 0xDF, 0xB2, 0x37, 0x35, 0x7C, 0x3D, 0x77, 0x8C, 0x8E, 0x65, 0x05,
-    0x86, 0x03, 0xFE, 0xA0, 0x19, 0xA4, 0x6F, 0x9B, 0x5B, 0xE6, 0x10, 0xF1, 0x71, 0x8A, 0x09, 0x6B,
-    0x56, 0x4A, 0xD9, 0x6A, 0x3C, 0x81, 0x14, 0xA7, 0x2A, 0xAC, 0x23, 0x6B, 0xEA, 0x8A, 0x3B, 0x3F,
-    0x29, 0x49, 0xB6, 0x5A, 0xE7, 0x2E, 0x3B, 0x6B, 0xFC, 0x68, 0x75, 0x47, 0xAE, 0x0B, 0x84, 0x8A,
-    0x45, 0x08, 0xC6, 0x9C, 0x47, 0xD2, 0xA3, 0x45, 0xBA, 0x1B, 0xCB, 0xB8, 0x46, 0x45, 0x78, 0x3C,
-    0xB5, 0x27, 0xDD, 0x9C, 0x95, 0xDB, 0x4D, 0x18, 0x4A, 0x05, 0x5C, 0xB1, 0x3E, 0xD8, 0x48, 0x0F,
-    0x10, 0x50, 0xCD, 0x11, 0xC1, 0xAC, 0x5B, 0x44, 0x24, 0x4A, 0x72, 0xA4, 0x85, 0xA4, 0x0D, 0x1A,
-    0x44, 0xA2, 0x66, 0x4D, 0x32, 0x2C, 0x16, 0xD7, 0x6A, 0x2D, 0x89, 0x1F, 0x0B, 0xE3, 0xFD, 0xD5,
-    0xD2, 0xA5, 0x50, 0xF1, 0x90, 0xEA, 0xB8, 0x1E, 0xFD, 0x55, 0xFD, 0x81, 0x7C, 0x67, 0x45, 0x42,
-    0x83, 0xA6, 0x0E, 0xBF, 0xF8, 0x81, 0x30, 0xA9, 0xC8, 0x9F, 0x22, 0x4C, 0xE7, 0x22, 0xFD, 0x5D,
-    0xF8, 0xB6, 0x73, 0x71, 0x38, 0x4F, 0x4F, 0x36, 0x5B, 0x3A, 0x5C, 0x52, 0x48, 0xB2, 0x0C, 0x4F,
-    0x5E, 0xF8, 0x67, 0xD8, 0x05, 0xDF, 0xC3, 0x0E, 0xD5, 0xCA, 0x8F, 0x7E, 0x1B, 0x0F, 0xAB, 0x3B,
-    0xA8, 0xD9, 0xB3, 0xDA, 0x68, 0x78, 0x66, 0xF4, 0x06, 0xA9, 0x33, 0x48, 0x73, 0x07, 0x35, 0x1F,
-    0xFB, 0xE0, 0xA1, 0xB5, 0xA7, 0x01, 0xC5, 0xD7, 0x52, 0xC7, 0x32, 0x2E, 0x10, 0x57, 0x3B, 0xB7,
-    0xDF, 0xC1, 0xAA, 0xDE, 0xE3, 0x42, 0xF1, 0x65, 0x84, 0x10, 0x4C, 0x58, 0xC2, 0xD2, 0x9C, 0xB5,
-    0x58, 0xFD, 0xFE, 0xA0, 0x49, 0x3E, 0x13, 0x74, 0x6F, 0x3C, 0xB1, 0xA7, 0x00, 0xC5, 0xCC, 0x19,
-    0xCE, 0x21, 0xC2, 0x92, 0x7F, 0x1C, 0x5C, 0xB6, 0x30, 0xDF, 0xA0, 0x26, 0xE8, 0x96, 0x13, 0xE4,
-    0x78, 0xB8, 0xF8, 0xDA, 0x43, 0x56, 0x8B, 0x16, 0xA2, 0x5D, 0xE6, 0x15, 0x02, 0x2F, 0xB2, 0x53,
-    0xC3, 0x1A, 0xB0, 0xD5, 0x2B, 0x8E, 0xF8, 0xC7, 0x50, 0x2D, 0x83, 0x33, 0x50, 0xB5, 0xF9, 0x0D,
-    0xED, 0x5C, 0xBD, 0x93, 0xDD, 0xD6, 0x75, 0xBF, 0x00, 0xC2, 0xC5, 0x84, 0x2F, 0x33, 0x70, 0x21,
-    0x7A, 0x32, 0xCB, 0x02, 0x6D, 0xCC, 0xC2, 0xA8, 0x53, 0x98, 0x80, 0xA4, 0x2E, 0xD5, 0x66, 0x86,
-    0x6B, 0x15, 0x2E, 0xD8, 0xA4, 0x10, 0x99, 0x82, 0x7D, 0xC6, 0x24, 0x20, 0xE7, 0x0F, 0xC8, 0x66,
-    0x26, 0x4E, 0x8A, 0x14, 0x61, 0xA1, 0xCC, 0x90, 0x2F, 0x85, 0x1A, 0x15, 0xC9, 0x0C, 0x4D, 0xC0,
-    0x4E, 0x91, 0x42, 0x45, 0x10, 0x67, 0x26, 0x2E, 0x5C, 0x18, 0x05, 0x39, 0x99, 0xA8, 0x11, 0x0A,
-    0xC4, 0x01, 0x45, 0x00, 0x37, 0xE7, 0x77, 0xCE, 0xB9, 0x00, 0xDE, 0xDB, 0x15, 0xF5, 0x45, 0xD1,
-    0xAB, 0x95, 0x1E, 0xB9, 0xF7, 0x9E, 0xF7, 0x1E, 0x3E, 0xEE, 0x3D, 0xE7, 0xDE, 0xF3, 0xF9, 0xC3,
-    0x33, 0x06, 0xAF, 0xEF, 0x1B, 0x79, 0x95, 0x95, 0xF1, 0x4A, 0x5B, 0x1B, 0xFA, 0x1F, 0x5B, 0x3B,
-    0x99, 0xB2, 0x31, 0xE5, 0xB3, 0xB7, 0x6C, 0x95, 0x34, 0xBE, 0xAD, 0x4C, 0xD9, 0x46, 0x75, 0x68,
-    0x33, 0x93, 0x0C, 0x51, 0x15, 0x4D, 0xC6, 0x44, 0x63, 0x62, 0x92, 0xD1, 0x98, 0x8D, 0x1D, 0x4C,
-    0x3A, 0x18, 0x13, 0xD2, 0x69, 0x39, 0xF5, 0x01, 0x8E, 0xED, 0x77, 0x7B, 0xDB, 0xA1, 0xAF, 0x3F,
-    0xB5, 0x2F, 0xBB, 0xDD, 0xF3, 0x72, 0xED, 0xE5, 0xFA, 0x05, 0xDD, 0x1B, 0xF7, 0xA3, 0x7B, 0x4F,
-    0xF2, 0x07, 0x3A, 0xD1, 0x7B, 0xE6, 0x2D, 0x4D, 0xC1, 0x76, 0x07, 0x74, 0x19, 0xFA, 0x10, 0xE3,
-    0xA7, 0x97, 0x6F, 0xED, 0x13, 0x9E, 0x9B, 0x77, 0xC3, 0xB8, 0xD7, 0x11, 0x9A, 0x60, 0x40, 0x1B,
-    0x4E, 0xC6, 0xBB, 0x7D, 0x14, 0x5A, 0x3A, 0x7E, 0xF2, 0xAD, 0x67, 0xAD, 0xAD, 0x1E, 0x07, 0x36,
-    0xCB, 0xDB, 0xBB, 0x74, 0xF5, 0xA4, 0xEF, 0xE3, 0xC1, 0x44, 0xB6, 0x4D, 0xD0, 0x66, 0x29, 0x5A,
-    0x93, 0xF6, 0xB8, 0xE9, 0xA7, 0xB4, 0x7C, 0x24, 0xCE, 0x9A, 0x88, 0x4B, 0x86, 0x2E, 0x22, 0x5F,
-    0x05, 0xB6, 0x28, 0x69, 0x90, 0x25, 0xDD, 0xC5, 0x98, 0xAB, 0x76, 0xC4, 0x08, 0xAE, 0xCC, 0xC3,
-    0xF2, 0x1B, 0xE9, 0x37, 0x43, 0x6E, 0x6D, 0x1D, 0x4F, 0xD1, 0x48, 0x7D, 0x13, 0xDB, 0xCD, 0x74,
-    0x40, 0x87, 0x7A, 0xA5, 0x3F, 0x19, 0x4B, 0x67, 0xA7, 0x66, 0xD4, 0x7E, 0x90, 0xDE, 0xEF, 0xA4,
-    0xBF, 0x53, 0x4B, 0x4F, 0x97, 0xE5, 0x3E, 0xD3, 0xDE, 0x7C, 0x75, 0x3D, 0xC4, 0x75, 0x8F, 0x7A,
-    0x88, 0xFD, 0x67, 0xD4, 0xA7, 0x93, 0xF1, 0xC1, 0xD7, 0xC8, 0x3E, 0xBD, 0xD3, 0x81, 0xC9, 0xC4,
-    0x50, 0x48, 0xC3, 0xDC, 0x11, 0x69, 0x18, 0x73, 0x9C, 0xCD, 0xF3, 0xFD, 0x43, 0xED, 0xAD, 0x74,
-    0x1E, 0x89, 0x57, 0xFA, 0x2A, 0xB5, 0x75, 0x6E, 0xEB, 0x12, 0x3D, 0xFD, 0x4F, 0x2A, 0x5A, 0x19,
-    0xF4, 0x3F, 0xCE, 0x7C, 0x5B, 0xD3, 0xFF, 0x94, 0x0E, 0xA9, 0x3D, 0xFB, 0x1F, 0x83, 0xF4, 0x74,
-    0x03, 0xEE, 0xFF, 0xC7, 0x48, 0x5F, 0x7F, 0xAE, 0xDE, 0x97, 0xBE, 0x09, 0x78, 0x9C, 0xB6, 0xD5,
-    0xBE, 0x8B, 0xB8, 0x2F, 0xED, 0x84, 0xA9, 0x9A, 0xD4, 0xF6, 0x16, 0xC3, 0xDC, 0xD8, 0xA6, 0xE4,
-    0xE1, 0x2E, 0x8B, 0x09, 0xAF, 0xCB, 0x85, 0xB9, 0x35, 0xBF, 0x09, 0x3A, 0x66, 0x81, 0x4E, 0x6A,
-    0xDA, 0xB4, 0xCB, 0x71, 0x65, 0x59, 0x2F, 0x6F, 0x12, 0x9D, 0x2F, 0xBF, 0x22, 0xBB, 0xBA, 0x9C,
-    0xB7, 0x7B, 0x75, 0x5E, 0x30, 0x1F, 0x67, 0xB8, 0x3B, 0xBD, 0x5A, 0x34, 0x23, 0xCE, 0xA0, 0x57,
-    0x17, 0xDA, 0x0F, 0xDF, 0xA3, 0xC5, 0x14, 0x4D, 0xDB, 0x7F, 0xB2, 0xAD, 0x8F, 0x69, 0x75, 0x26,
-    0x6A, 0xB0, 0x95, 0x30, 0x41, 0xAC, 0x43, 0xFA, 0xD2, 0x56, 0x1E, 0xEF, 0x68, 0xBC, 0xA1, 0x16,
-    0x6F, 0x68, 0x39, 0xD3, 0x1B, 0x12, 0x17, 0xDE, 0x84, 0xB6, 0xA2, 0x37, 0x25, 0xF3, 0x93, 0x77,
-    0x92, 0xC1, 0x65, 0xE4, 0x4D, 0x0D, 0x21, 0x36, 0xFA, 0xA6, 0xC1, 0x18, 0x2A, 0x7E, 0xE3, 0xE3,
-    0x0D, 0x5D, 0x65, 0x79, 0x93, 0x5A, 0xB3, 0xBC, 0xC1, 0x82, 0x98, 0xDF, 0xD8, 0xDE, 0xCC, 0x17,
-    0xF0, 0xC1, 0x4F, 0x77, 0xE9, 0x50, 0x85, 0xC0, 0x37, 0x8D, 0xC0, 0x0F, 0x1D, 0x0E, 0x31, 0xC7,
-    0xC8, 0x9B, 0x0D, 0x7D, 0x8A, 0x15, 0xFD, 0xB6, 0x8C, 0x9A, 0x2E, 0x46, 0x57, 0x7E, 0x84, 0x37,
-    0x09, 0x06, 0x4F, 0x17, 0x1B, 0x3C, 0xD1, 0x3B, 0x3C, 0xBC, 0x81, 0x79, 0xD0, 0xF2, 0x30, 0xFD,
-    0x21, 0xA4, 0x65, 0x48, 0xE7, 0xC7, 0xF6, 0xA7, 0xC7, 0x37, 0x07, 0xE5, 0x5B, 0x82, 0x9E, 0xDF,
-    0x9C, 0xB8, 0x37, 0x8E, 0xED, 0xEF, 0x42, 0x90, 0xFA, 0x9A, 0x4C, 0xEE, 0xD8, 0x6E, 0xD2, 0x9F,
-    0xD0, 0x8E, 0x93, 0xB3, 0x4D, 0xFC, 0xBC, 0x33, 0xCA, 0x74, 0xAC, 0x06, 0xA3, 0x3C, 0xE7, 0x19,
-    0x28, 0xCB, 0x69, 0x91, 0xCB, 0xD8, 0xE3, 0x79, 0x65, 0x33, 0xC3, 0x67, 0x1A, 0xFC, 0x86, 0x24,
-    0x75, 0xE6, 0xF1, 0x42, 0xD7, 0xF1, 0xD3, 0xB7, 0x44, 0x74, 0x34, 0x9B, 0xB8, 0x20, 0x7D, 0xA1,
-    0x4C, 0x8C, 0x31, 0x77, 0xA5, 0x59, 0xEB, 0x2E, 0x9C, 0xEE, 0x57, 0x8C, 0x6E, 0x57, 0x7C, 0xAE,
-    0x56, 0x6C, 0x2E, 0x56, 0x5C, 0x5E, 0x31, 0x79, 0x58, 0x78, 0x9C, 0x77, 0x6E, 0x9C, 0x74, 0x99,
-    0xC6, 0xBC, 0xAF, 0x1C, 0xC6, 0x29, 0x9D, 0x32, 0x78, 0x63, 0x33, 0xAF, 0x53, 0xFE, 0x92, 0x62,
-    0xF3, 0x3B, 0x65, 0x6F, 0x3A, 0x6D, 0xDF, 0xEB, 0x94, 0x3F, 0x39, 0x16, 0xA5, 0x32, 0xB7, 0x04,
-    0x4D, 0x6A, 0x6D, 0xFB, 0xD0, 0xF8, 0xF7, 0xCD, 0x35, 0x68, 0x5B, 0xCB, 0xFA, 0x01, 0x7C, 0xF4,
-    0x4B, 0x52, 0x08, 0x36, 0xEC, 0xC1, 0x93, 0x98, 0xC8, 0xF4, 0x23, 0xDE, 0x27, 0xAC, 0xD7, 0xC1,
-    0x5B, 0xA7, 0xDE, 0x33, 0x47, 0x7A, 0xC7, 0xC6, 0x91, 0xFC, 0x3A, 0xF8, 0x9B, 0x99, 0x2C, 0x2D,
-    0x94, 0x35, 0xDD, 0x8D, 0x76, 0xB1, 0xFD, 0x8D, 0x92, 0x1B, 0xFB, 0xB7, 0x74, 0xB7, 0xF4, 0xE9,
-    0x8F, 0x2C, 0x8C, 0x55, 0x4E, 0x24, 0xAE, 0x46, 0x53, 0xA6, 0x45, 0x7F, 0x1D, 0xB7, 0x24, 0x49,
-    0xD1, 0x04, 0x7F, 0x80, 0x9E, 0x54, 0x33, 0xC6, 0x40, 0x16, 0xCE, 0x91, 0x2C, 0xCA, 0x9E, 0xEF,
-    0xA6, 0x66, 0x48, 0x46, 0x66, 0x1C, 0x19, 0xD3, 0x24, 0xF4, 0x00, 0xEA, 0xDC, 0x69, 0xAC, 0x17,
-    0x99, 0x84, 0x5E, 0x69, 0xE5, 0x16, 0xC4, 0x7E, 0xAF, 0x95, 0x1B, 0xD3, 0x05, 0xFC, 0x96, 0x9A,
-    0x92, 0xAD, 0x43, 0xD0, 0x6E, 0xEC, 0x7F, 0x3D, 0x27, 0x6B, 0x43, 0x0C, 0xA4, 0xCD, 0x6B, 0xFF,
-    0x15, 0x5A, 0x86, 0xD6, 0x02, 0x8D, 0x36, 0x70, 0xA4, 0x77, 0xB4, 0x52, 0x02, 0x15, 0x33, 0xB8,
-    0xB6, 0x8E, 0xA2, 0x49, 0x42, 0xCB, 0xC2, 0x3C, 0xB0, 0xFC, 0xA1, 0xB8, 0xA0, 0xCC, 0x8C, 0xD1,
-    0xB5, 0x70, 0x2E, 0xA8, 0xA3, 0x99, 0xEA, 0x4E, 0x53, 0x5E, 0xEB, 0x28, 0x9F, 0x29, 0xCC, 0x23,
-    0x60, 0x8A, 0x56, 0xD7, 0xF1, 0x4D, 0xA6, 0xAC, 0xB0, 0x62, 0x87, 0x72, 0xB6, 0xE3, 0x45, 0x94,
-    0x8E, 0x83, 0xBD, 0x80, 0x4A, 0xA9, 0x70, 0xD6, 0xBA, 0x77, 0xDC, 0xF2, 0x09, 0x98, 0x89, 0x4C,
-    0x4D, 0x8B, 0x75, 0x7A, 0x3C, 0x7F, 0x5B, 0x09, 0xE7, 0x89, 0xB0, 0x8E, 0x10, 0xBE, 0xFB, 0xB6,
-    0x50, 0xB6, 0xDF, 0x58, 0xEE, 0xF5, 0x49, 0x84, 0x85, 0x16, 0xDE, 0x21, 0x42, 0x47, 0x04, 0x8E,
-    0xF0, 0xBF, 0x14, 0x71, 0xE4, 0x88, 0x6E, 0x9F, 0xF0, 0x5A, 0x25, 0x7C, 0x10, 0xC2, 0x62, 0x22,
-    0x84, 0xC3, 0x3E, 0xCF, 0xCB, 0xDA, 0x1D, 0x62, 0x8F, 0x6D, 0xC1, 0x19, 0x44, 0xE1, 0x18, 0x9A,
-    0xED, 0x9A, 0x30, 0xAF, 0x1C, 0xDC, 0x21, 0xCA, 0x80, 0xE0, 0x63, 0x63, 0xAE, 0x6D, 0x0B, 0x73,
-    0x15, 0x56, 0x9D, 0xF6, 0x47, 0xC2, 0xFA, 0xC4, 0xE7, 0x96, 0x37, 0x1A, 0x6B, 0x98, 0x83, 0x8C,
-    0x6D, 0xB2, 0xD9, 0x6B, 0x23, 0xDB, 0xCF, 0x2D, 0xB9, 0x85, 0xB2, 0x31, 0x5F, 0x5E, 0xDB, 0x50,
-    0x1B, 0x92, 0x34, 0xD3, 0x9E, 0xF6, 0x53, 0xE1, 0x5A, 0x8C, 0x7A, 0xA7, 0xE5, 0x15, 0x92, 0x77,
-    0xF3, 0xF2, 0x92, 0xE1, 0x5D, 0x65, 0x26, 0x94, 0xBC, 0x90, 0xCA, 0x13, 0xDA, 0xA1, 0x05, 0xE9,
-    0x98, 0x89, 0xF4, 0x79, 0x6F, 0x59, 0x95, 0x5A, 0x90, 0x21, 0x4E, 0xC8, 0x6B, 0x72, 0xAC, 0xC9,
-    0x7F, 0xA1, 0xAB, 0x25, 0x6C, 0xD0, 0x3C, 0x68, 0xCB, 0x38, 0x83, 0xF6, 0xF1, 0xE0, 0x5A, 0xCC,
-    0x64, 0xE5, 0xC8, 0xFF, 0xA3, 0xB1, 0x29, 0xD9, 0xD1, 0x00, 0x1D, 0x49, 0x8A, 0xD8, 0x91, 0xA4,
-    0x5B, 0x1C, 0x49, 0xE6, 0xC5, 0x91, 0xB4, 0xAC, 0x1C, 0x49, 0xC6, 0xD6, 0x91, 0xA4, 0x19, 0x66,
-    0x32, 0x1D, 0x66, 0x32, 0xB6, 0x33, 0xB9, 0xB1, 0xFF, 0xE0, 0xC8, 0xC0, 0x7E, 0xE4, 0x48, 0x1A,
-    0x91, 0x23, 0x69, 0x7E, 0x33, 0x99, 0x2E, 0x64, 0x24, 0x24, 0x79, 0xA1, 0xAC, 0xAE, 0x89, 0x0C,
-    0xD9, 0x21, 0x67, 0x12, 0xBB, 0xD5, 0xAC, 0xC8, 0x3C, 0x13, 0x0B, 0x29, 0xAF, 0x4F, 0x25, 0xF3,
-    0x7E, 0xF1, 0x81, 0xE6, 0xFD, 0xBD, 0x6C, 0x6B, 0x15, 0x80, 0xEC, 0xFA, 0x71, 0x3E, 0x14, 0xC6,
-    0x67, 0xF6, 0xB2, 0x96, 0x03, 0x5A, 0x95, 0x8F, 0x81, 0x0F, 0xC5, 0xE2, 0x21, 0x4A, 0xA5, 0x43,
-    0xA1, 0x8E, 0x13, 0xCE, 0x95, 0x59, 0x36, 0x66, 0x16, 0x8D, 0x99, 0x25, 0x63, 0x9C, 0x60, 0x52,
-    0xB2, 0xD9, 0x22, 0x97, 0x04, 0x14, 0x8B, 0xC5, 0x03, 0x25, 0x52, 0x01, 0x25, 0x42, 0x29, 0x5B,
-    0x27, 0x13, 0x50, 0x22, 0x12, 0x50, 0x22, 0x11, 0xA6, 0x58, 0x20, 0x4C, 0xB1, 0x3C, 0x98, 0x62,
-    0x71, 0x30, 0xC5, 0xD2, 0x60, 0x8A, 0x85, 0xC1, 0x14, 0xCB, 0x42, 0xA8, 0x74, 0xA6, 0x22, 0xA6,
-    0x9C, 0x20, 0xCA, 0xD6, 0xC9, 0xA1, 0x6C, 0x9D, 0x18, 0x94, 0xCA, 0xB3, 0x15, 0x3B, 0xCB, 0x17,
-    0x2B, 0xD3, 0xC6, 0x2C, 0x4E, 0xCC, 0x9E, 0x0E, 0x20, 0xAF, 0x7E, 0x3E, 0x6C, 0x16, 0xD4, 0x34,
-    0x33, 0x3C, 0x76, 0x27, 0xE4, 0x4E, 0xBF, 0x96, 0xFD, 0x3E, 0x91, 0xBA, 0x1B, 0x1D, 0x64, 0xE6,
-    0xAC, 0xD7, 0x21, 0x9B, 0xBF, 0xD4, 0xFE, 0x82, 0xBC, 0xB4, 0xD8, 0x76, 0xA9, 0xFD, 0x80, 0x24,
-    0x42, 0x04, 0x19, 0xFA, 0xF7, 0x48, 0x9A, 0x96, 0x34, 0xC7, 0xC0, 0x06, 0x9A, 0x08, 0xD6, 0x5B,
-    0xD0, 0x25, 0xAD, 0x53, 0x2A, 0xCD, 0x29, 0xA2, 0x7E, 0x49, 0x44, 0xC3, 0x9A, 0x83, 0x86, 0x81,
-    0xDB, 0x11, 0x91, 0x5A, 0xFB, 0x3A, 0x8D, 0x2C, 0xED, 0x72, 0x47, 0xB8, 0x09, 0x76, 0xFB, 0x4C,
-    0x58, 0xB8, 0xD1, 0xEE, 0x71, 0xDB, 0x77, 0x2C, 0x8E, 0xDD, 0xB2, 0x2E, 0xDD, 0xA2, 0x26, 0xED,
-    0xB2, 0xF8, 0xA7, 0xF0, 0x4D, 0x8D, 0xFA, 0xA5, 0x7C, 0xF8, 0xF3, 0x5E, 0x55, 0x71, 0xBB, 0x2B,
-    0xA0, 0xE3, 0x5D, 0x66, 0x7A, 0xFA, 0xB9, 0xBB, 0x8F, 0x53, 0xD0, 0xEE, 0xBC, 0x48, 0x0D, 0x61,
-    0x94, 0xCB, 0x0E, 0x4C, 0x62, 0xE9, 0xD3, 0x48, 0xEE, 0x73, 0x4F, 0x55, 0xFC, 0xA3, 0x8D, 0xF4,
-    0x83, 0x18, 0x01, 0xAF, 0x93, 0x1B, 0xC2, 0xA6, 0xD4, 0xDC, 0xCB, 0xAA, 0xD9, 0x48, 0x3C, 0x8A,
-    0xA8, 0x03, 0x71, 0x22, 0x52, 0x0A, 0xBC, 0x4C, 0x12, 0xF5, 0xB9, 0x29, 0x80, 0x44, 0xFA, 0x00,
-    0x01, 0x24, 0x7B, 0xCA, 0xA3, 0xDA, 0x90, 0x41, 0xD6, 0xAF, 0xA7, 0x61, 0x7D, 0xD0, 0x4B, 0x6A,
-    0x60, 0xC3, 0x29, 0x80, 0x8E, 0xF5, 0x88, 0xC5, 0xDE, 0xD5, 0x5E, 0xD9, 0x22, 0x4C, 0x11, 0x96,
-    0x08, 0x43, 0x42, 0x67, 0x5C, 0xF7, 0x58, 0x71, 0x69, 0x9B, 0xB1, 0x3B, 0x35, 0xE2, 0xCB, 0x8F,
-    0x58, 0x27, 0x60, 0xE5, 0x6C, 0x46, 0x0C, 0x3B, 0x94, 0xA0, 0xFA, 0x81, 0x0A, 0x65, 0x69, 0x0F,
-    0x2D, 0x7B, 0x27, 0x68, 0x23, 0x7B, 0x42, 0x6D, 0xC2, 0x61, 0x78, 0xCA, 0xC7, 0x93, 0x9E, 0x9A,
-    0x5B, 0x58, 0x15, 0x7C, 0x1E, 0xE0, 0x98, 0xE9, 0x26, 0x2D, 0xF5, 0xC8, 0x0E, 0x29, 0x94, 0x7F,
-    0x8B, 0xAD, 0xCA, 0xF1, 0xFE, 0x35, 0xF2, 0x88, 0x93, 0x2A, 0x6A, 0x36, 0x6D, 0x5A, 0x04, 0x93,
-    0x46, 0x35, 0x58, 0x18, 0x57, 0x8E, 0x34, 0x36, 0xC4, 0xC1, 0x58, 0xC8, 0xA3, 0x6C, 0x96, 0xFC,
-    0x25, 0xFE, 0x95, 0x3D, 0x6B, 0xB8, 0x54, 0xEF, 0xF1, 0xC0, 0x1C, 0x9C, 0xE4, 0x59, 0x52, 0xC5,
-    0xB5, 0x35, 0x9B, 0xE7, 0x83, 0xB8, 0x43, 0x98, 0xF1, 0x95, 0x65, 0x4B, 0xC6, 0x50, 0x74, 0xFC,
-    0x79, 0x27, 0xE3, 0xFC, 0xDC, 0x7F, 0x72, 0xCF, 0x98, 0x13, 0x1A, 0xC4, 0x66, 0x8D, 0x98, 0x43,
-    0x89, 0x95, 0xBD, 0x31, 0x6A, 0x25, 0x3E, 0xAE, 0x64, 0xBB, 0x67, 0x2B, 0x87, 0x62, 0x27, 0x1A,
-    0xE6, 0xF4, 0x94, 0x91, 0xEC, 0x94, 0x91, 0xE4, 0x94, 0x91, 0xDC, 0x94, 0x91, 0xD4, 0x94, 0xCB,
-    0x0C, 0x49, 0x62, 0x4A, 0xF3, 0x46, 0x99, 0xA6, 0xA5, 0x34, 0xAB, 0xA4, 0x9D, 0xE6, 0x9C, 0x5E,
-    0xD4, 0x69, 0x3A, 0x4A, 0x4F, 0xD0, 0x64, 0x94, 0xE6, 0xA2, 0x34, 0x15, 0xA5, 0xF7, 0xD3, 0x44,
-    0x94, 0xE8, 0xA2, 0x39, 0x0D, 0x85, 0xA5, 0xBE, 0x4A, 0x42, 0xC9, 0x54, 0x1E, 0xF0, 0x7A, 0x2D,
-    0x4D, 0x4A, 0x6D, 0xF2, 0x73, 0xCC, 0x23, 0x7A, 0x3E, 0xF0, 0x4A, 0x5D, 0x3C, 0x8B, 0x75, 0x9E,
-    0xC4, 0xBB, 0x7D, 0xC4, 0x4B, 0x82, 0xC3, 0x12, 0x98, 0x21, 0xD2, 0xE9, 0x25, 0x87, 0x60, 0x74,
-    0x43, 0x24, 0xA8, 0x46, 0x9D, 0xF7, 0x57, 0x99, 0xA0, 0xBA, 0x85, 0x18, 0x8E, 0x44, 0x53, 0xC4,
-    0x10, 0x51, 0xD4, 0x94, 0x19, 0x67, 0xCF, 0x46, 0xD1, 0x27, 0xFD, 0x5A, 0x8F, 0xAD, 0xD6, 0x0D,
-    0x27, 0xB2, 0xAC, 0xE6, 0xB1, 0xC6, 0xD0, 0x4A, 0xDC, 0xAA, 0xD9, 0xA3, 0xDF, 0x51, 0xA7, 0x39,
-    0x2B, 0x2C, 0x89, 0x71, 0xCE, 0x58, 0x21, 0x61, 0xD5, 0x4A, 0xBE, 0xAA, 0x62, 0xC3, 0x36, 0x2E,
-    0x0A, 0xF4, 0x1A, 0x54, 0x0C, 0xCC, 0x19, 0xA7, 0x72, 0xC2, 0x2E, 0xC5, 0x11, 0xFE, 0x64, 0xD7,
-    0x6E, 0x87, 0xB8, 0x89, 0xE6, 0xD2, 0xD1, 0x29, 0x0B, 0x26, 0x39, 0x2C, 0xD7, 0x49, 0x26, 0xCB,
-    0x25, 0x9E, 0xD4, 0xA0, 0x7C, 0x89, 0x4E, 0xAE, 0x22, 0xD9, 0x2B, 0x4D, 0x5E, 0x69, 0xEE, 0x4A,
-    0x53, 0x57, 0x9A, 0xB9, 0xDA, 0xD0, 0x5A, 0xB6, 0xA7, 0xF2, 0x56, 0xB1, 0xE5, 0x9D, 0xA6, 0xDD,
-    0xE1, 0x76, 0xBB, 0x32, 0xC2, 0xE4, 0xD7, 0x70, 0xEE, 0xA3, 0xCA, 0x31, 0xDD, 0xB4, 0x96, 0xAE,
-    0xE2, 0xC9, 0x5F, 0xCE, 0x0E, 0xF7, 0xA7, 0x79, 0x21, 0x24, 0x1D, 0x4A, 0xB6, 0x72, 0xB7, 0x73,
-    0x21, 0xE4, 0xC9, 0x01, 0x8C, 0x5D, 0xD4, 0xC6, 0x6C, 0xD3, 0x3A, 0xE9, 0xE4, 0x5D, 0x58, 0x6F,
-    0x2A, 0x73, 0xF6, 0xEB, 0x9C, 0x8A, 0xFF, 0xB6, 0xB8, 0xC8, 0x62, 0x1B, 0x7D, 0x59, 0xCA, 0x81,
-    0xAC, 0xE1, 0x48, 0x9C, 0x82, 0xC3, 0x17, 0xAD, 0x02, 0xEE, 0x2E, 0x9B, 0x8B, 0xB9, 0x0A, 0x48,
-    0x83, 0xDD, 0x58, 0x3B, 0xA7, 0x62, 0x94, 0xCC, 0x0E, 0x93, 0xC2, 0xFA, 0xA2, 0xAD, 0x89, 0xEF,
-    0x9B, 0x0D, 0xE6, 0x12, 0x57, 0xEC, 0x5B, 0x86, 0xBF, 0x3D, 0x4B, 0xB3, 0xDF, 0x66, 0xF7, 0x53,
-    0x77, 0xBF, 0xEA, 0x82, 0xDD, 0x35, 0x11, 0x67, 0xF1, 0x85, 0x5C, 0x13, 0x97, 0x33, 0x1F, 0x3B,
-    0x66, 0xD3, 0x44, 0x10, 0xBC, 0x3F, 0xE4, 0xAC, 0x29, 0xB5, 0xA8, 0xA1, 0x01, 0xEB, 0xE1, 0xBB,
-    0x6C, 0xAD, 0x0B, 0x3F, 0xE3, 0x55, 0x10, 0x9D, 0xB1, 0x26, 0x9A, 0x4D, 0xFD, 0x75, 0x5A, 0x13,
-    0x5B, 0xD1, 0x12, 0xB9, 0x86, 0x07, 0x12, 0x1D, 0x04, 0xC3, 0x4E, 0x82, 0xEC, 0x9B, 0xAB, 0x27,
-    0xD4, 0x57, 0xD7, 0x20, 0x29, 0x1C, 0x35, 0xC6, 0x52, 0x79, 0x4A, 0x04, 0x27, 0x3A, 0xE0, 0x02,
-    0xE9, 0x89, 0x83, 0x87, 0xEC, 0x85, 0x22, 0x3F, 0x41, 0xAB, 0x3F, 0x7E, 0x72, 0xD3, 0xD2, 0x8E,
-    0x27, 0xAF, 0xF7, 0x0F, 0x34, 0x55, 0xC0, 0x41, 0x2D, 0x87, 0xB8, 0x9C, 0xBB, 0x49, 0xFB, 0x6B,
-    0xDB, 0x6D, 0x89, 0xAC, 0x9A, 0xD5, 0xA6, 0x43, 0x90, 0xDC, 0xD1, 0x21, 0xE4, 0x32, 0x95, 0x6D,
-    0x42, 0x21, 0x53, 0x13, 0x0F, 0x1E, 0x52, 0xAA, 0x21, 0x62, 0x24, 0x30, 0xF8, 0x0E, 0x5F, 0xE9,
-    0xC6, 0x2E, 0x2B, 0xEC, 0x4E, 0x4F, 0x57, 0xDD, 0x61, 0x55, 0x62, 0xAE, 0x8B, 0xAE, 0x2E, 0x24,
-    0x76, 0x28, 0x2B, 0x09, 0xA1, 0xF3, 0x82, 0x1D, 0x55, 0x5A, 0x81, 0xDF, 0x3B, 0x93, 0xC5, 0x17,
-    0x33, 0x24, 0xA6, 0xFD, 0x35, 0x19, 0xD7, 0xA6, 0xAE, 0xF4, 0x4A, 0xAF, 0xEF, 0x99, 0xB7, 0xA1,
-    0xB6, 0x32, 0x5C, 0xD3, 0xBE, 0x6E, 0x67, 0xFA, 0xBA, 0xB9, 0xBB, 0xC7, 0x98, 0x73, 0x10, 0x24,
-    0xAF, 0xA5, 0x3F, 0xED, 0xF4, 0xD7, 0xB6, 0x0F, 0x77, 0x0F, 0x70, 0xC2, 0x9D, 0xA5, 0x59, 0xED,
-    0x48, 0xD7, 0xB8, 0x7C, 0xCA, 0x6B, 0xDF, 0x10, 0xE9, 0x8F, 0x66, 0xB7, 0x35, 0xAB, 0xE9, 0x7B,
-    0xBC, 0x43, 0x84, 0x45, 0xD2, 0xCA, 0x27, 0xE6, 0x8F, 0xCE, 0x9D, 0xF4, 0x0F, 0xB6, 0x5B, 0x15,
-    0xDC, 0x66, 0xF6, 0xC5, 0x17, 0xCA, 0x3B, 0x3E, 0xDE, 0x4F, 0x1A, 0x72, 0xFD, 0xA2, 0x9B, 0x29,
-    0x76, 0x5E, 0x6E, 0xDA, 0x69, 0xFB, 0x9E, 0xD4, 0x19, 0xEF, 0x0C, 0xC6, 0x97, 0x7C, 0x3E, 0x82,
-    0x77, 0xA6, 0xEE, 0xCE, 0xD4, 0x00, 0x8A, 0xB3, 0x11, 0x5D, 0xE2, 0x2A, 0x18, 0xAD, 0xA3, 0xC2,
-    0xDA, 0x51, 0x51, 0xE5, 0xA8, 0x24, 0x4B, 0x94, 0xB7, 0xA9, 0x0B, 0xF4, 0xCD, 0xA3, 0x99, 0xEA,
-    0x8D, 0x7E, 0xEB, 0xB7, 0x46, 0xCF, 0x08, 0xE6, 0x62, 0x73, 0x34, 0x53, 0xF1, 0x4F, 0x8F, 0x75,
-    0x71, 0xA5, 0xC6, 0x1D, 0x77, 0x4F, 0xA8, 0x84, 0x87, 0x03, 0x2A, 0x35, 0x5E, 0xEF, 0x28, 0x48,
-    0x1F, 0x0E, 0x47, 0x6E, 0x22, 0xB4, 0xE3, 0xF1, 0x0F, 0x21, 0xF9, 0x9A, 0xE1, 0x00, 0x6B, 0x0A,
-    0x85, 0xD7, 0xED, 0x7D, 0xBD, 0x6D, 0xBB, 0xEE, 0x89, 0x6F, 0xEB, 0x30, 0xF5, 0xD2, 0xC3, 0xCC,
-    0x7B, 0x98, 0x41, 0xDA, 0x7D, 0x62, 0x39, 0xDB, 0x6C, 0xA1, 0xDA, 0x21, 0x71, 0x4B, 0xEB, 0x19,
-    0x32, 0x27, 0x01, 0x56, 0x90, 0x3A, 0x94, 0x35, 0xE4, 0xDE, 0x89, 0x9A, 0xA7, 0xCB, 0xAD, 0xFA,
-    0x43, 0x57, 0x3C, 0x92, 0x1E, 0x2B, 0xE0, 0x7F, 0xE9, 0x4E, 0xB2, 0x06, 0x8C, 0xAE, 0x02, 0x36,
-    0x0B, 0x56, 0xCD, 0x03, 0xE4, 0x93, 0x61, 0x2D, 0x0C, 0xC6, 0xAB, 0xB1, 0x1A, 0x2C, 0xF8, 0x3C,
-    0xDD, 0xFC, 0x6F, 0xFB, 0xB4, 0x44, 0x85, 0xFC, 0x1D, 0xBA, 0x0E, 0xAD, 0x89, 0x67, 0xC4, 0xD3,
-    0x5E, 0xD2, 0x0A, 0xEB, 0x84, 0xA6, 0x40, 0x4A, 0x42, 0xD4, 0x7A, 0x61, 0xAE, 0x8F, 0x71, 0x15,
-    0x22, 0xE9, 0x7E, 0xD8, 0x85, 0xB4, 0x43, 0xB1, 0x77, 0x68, 0x8F, 0xA0, 0x52, 0x1B, 0xF2, 0x2A,
-    0x34, 0xDE, 0xEC, 0xAB, 0x69, 0x61, 0x41, 0xF3, 0xD0, 0xBA, 0xCD, 0x4F, 0x75, 0x34, 0x86, 0x46,
-    0x3B, 0x1C, 0x59, 0x4E, 0x7C, 0x02, 0x5D, 0x02, 0x22, 0x4B, 0x19, 0xF5, 0x54, 0xD2, 0x77, 0x09,
-    0xC3, 0x03, 0x50, 0xD7, 0x3D, 0xCE, 0xC7, 0x23, 0x54, 0x18, 0x51, 0x0F, 0x41, 0x82, 0x78, 0xC0,
-    0x49, 0x9C, 0x7D, 0x8A, 0x64, 0x39, 0x7A, 0x64, 0x5B, 0xB3, 0x75, 0x3E, 0xF2, 0x36, 0x7D, 0xF6,
-    0xF0, 0x0D, 0x14, 0xE0, 0xE1, 0x62, 0xF8, 0xC4, 0xFC, 0x9B, 0x45, 0x38, 0x79, 0xF6, 0x4F, 0x20,
-    0x5E, 0xD4, 0xEB, 0xE9, 0x16, 0x35, 0x7C, 0x8C, 0xB2, 0xD1, 0x56, 0x3E, 0x91, 0x6F, 0x21, 0x1C,
-    0xE4, 0x83, 0xFE, 0xCE, 0xF2, 0x76, 0x65, 0x25, 0x82, 0xEA, 0x87, 0xD7, 0x0B, 0x12, 0x85, 0x37,
-    0x4C, 0xAF, 0xDB, 0x86, 0x76, 0x56, 0x20, 0x35, 0x65, 0x5E, 0x7D, 0x34, 0x14, 0x64, 0xE4, 0xA6,
-    0x2D, 0x4D, 0x2B, 0xAF, 0x81, 0x84, 0x2A, 0x8B, 0x2B, 0x6F, 0x91, 0x3D, 0x28, 0x52, 0xD4, 0x98,
-    0x8B, 0x6B, 0xEF, 0x4D, 0x27, 0x14, 0xFA, 0x44, 0xBD, 0x49, 0x9F, 0x1D, 0xE3, 0xBE, 0x7C, 0x05,
-    0xBA, 0x0B, 0xDC, 0x5C, 0xFF, 0xBE, 0x39, 0xCC, 0x90, 0xB8, 0x33, 0x25, 0xB3, 0xF3, 0x4D, 0x66,
-    0x6B, 0xA2, 0x45, 0x7C, 0xD9, 0xA1, 0xAE, 0x44, 0xB8, 0x93, 0x85, 0x7E, 0x05, 0x52, 0xBB, 0xBC,
-    0xDD, 0x9E, 0x2C, 0x52, 0x3B, 0xB0, 0xB6, 0x60, 0xA9, 0x8D, 0x2B, 0xA9, 0x71, 0xF1, 0x7F, 0x34,
-    0x9A, 0x07, 0xE3, 0x9A, 0xD5, 0x67, 0x96, 0x9A, 0x60, 0x19, 0x48, 0x19, 0xC3, 0x01, 0x2E, 0x79,
-    0xE2, 0x32, 0xEF, 0x48, 0xB3, 0x06, 0x6C, 0x02, 0xCE, 0xA7, 0x7C, 0x4D, 0x30, 0xC1, 0x16, 0x06,
-    0x23, 0xB7, 0x72, 0x6B, 0x72, 0xC8, 0xA6, 0x1F, 0xD2, 0xB4, 0xE5, 0x0A, 0xE6, 0xCF, 0xA7, 0x93,
-    0x79, 0x92, 0x6E, 0x96, 0x3A, 0xCD, 0x3D, 0xF9, 0x6A, 0x29, 0xDD, 0x3B, 0xDE, 0x01, 0x2A, 0xFD,
-    0x42, 0x00, 0x0A, 0xE8, 0x60, 0x9C, 0xF2, 0x29, 0x03, 0x4F, 0x13, 0x41, 0xA6, 0xA4, 0x02, 0x4A,
-    0xC9, 0x05, 0x82, 0x25, 0xF0, 0x93, 0x40, 0x90, 0x27, 0x91, 0x40, 0x81, 0x80, 0x5A, 0xA3, 0x6E,
-    0x62, 0xB3, 0xF4, 0x9F, 0xD2, 0xFD, 0x5A, 0xC0, 0x40, 0x56, 0x90, 0x49, 0x56, 0x40, 0x43, 0xBF,
-    0x15, 0x20, 0x51, 0xA3, 0xE0, 0xA2, 0x7C, 0x94, 0xD3, 0xAD, 0x16, 0x8D, 0x19, 0xF1, 0xA2, 0x60,
-    0xA5, 0x40, 0x70, 0x31, 0xC0, 0xE9, 0x60, 0x2C, 0x76, 0xE4, 0x54, 0x2B, 0x59, 0x1A, 0x5C, 0x32,
-    0x66, 0xA4, 0x45, 0xE5, 0xD1, 0x1A, 0xB9, 0x5C, 0x90, 0x72, 0x33, 0x9B, 0x16, 0x2A, 0xD6, 0x1F,
-    0x62, 0x2E, 0xD6, 0x73, 0xF0, 0x9F, 0xB2, 0x46, 0x8F, 0x59, 0x9F, 0x5F, 0xBA, 0x21, 0xC5, 0x6C,
-    0x98, 0x56, 0x01, 0x1A, 0xD6, 0xB3, 0x07, 0xE1, 0x7D, 0x5A, 0x9B, 0x72, 0x19, 0x3B, 0x45, 0xD5,
-    0x88, 0x46, 0x85, 0x82, 0x77, 0xC0, 0xF0, 0x9D, 0x88, 0x11, 0x56, 0x29, 0x0F, 0xBA, 0xC4, 0x91,
-    0xBF, 0x1C, 0xDD, 0xC4, 0x3D, 0x5A, 0x32, 0x99, 0xCE, 0xDE, 0xB3, 0x1F, 0x0B, 0x58, 0x42, 0xE0,
-    0x59, 0x39, 0x23, 0xB6, 0x12, 0xAB, 0x33, 0xA6, 0xCF, 0x43, 0x66, 0xBA, 0x6F, 0x51, 0x86, 0x2A,
-    0x4A, 0x8B, 0x76, 0x63, 0x2F, 0x46, 0xEE, 0x3C, 0x54, 0x57, 0x4C, 0x3C, 0xB6, 0x54, 0x2C, 0x7F,
-    0xB9, 0x83, 0x20, 0x54, 0x24, 0x42, 0xF9, 0x5C, 0xAB, 0x08, 0xD5, 0xB2, 0x4A, 0x7F, 0xC7, 0x39,
-    0xF4, 0xC7, 0xEC, 0x72, 0xC9, 0x46, 0x95, 0x2D, 0x54, 0x2F, 0x15, 0xD2, 0x58, 0x91, 0x4F, 0xEF,
-    0xF3, 0x36, 0xEE, 0x58, 0x52, 0xCD, 0x62, 0xBF, 0xD5, 0x6C, 0x3B, 0xEB, 0xBD, 0x63, 0xBC, 0xBF,
-    0xC9, 0x22, 0x95, 0x10, 0x50, 0x02, 0x42, 0x69, 0xAF, 0x1C, 0x1F, 0x9F, 0x97, 0xA2, 0xC9, 0x69,
-    0x81, 0x37, 0x9F, 0x2E, 0x70, 0x29, 0x0C, 0xE5, 0x52, 0x18, 0xAA, 0x19, 0x6F, 0xAA, 0x85, 0xA1,
-    0x6E, 0x81, 0x3D, 0x2C, 0x3E, 0xEF, 0x86, 0xD5, 0xFC, 0xBA, 0x15, 0x73, 0x15, 0x3D, 0xC1, 0xDD,
-    0x88, 0xAB, 0x09, 0x19, 0xD4, 0x02, 0x0A, 0x3C, 0xCA, 0x74, 0x28, 0xCD, 0x02, 0x89, 0x60, 0xBD,
-    0xEE, 0x8F, 0x19, 0x5F, 0x1F, 0xD6, 0x4D, 0x17, 0x98, 0xC2, 0x77, 0x04, 0xBB, 0x28, 0xF8, 0x3B,
-    0xC0, 0x10, 0xB9, 0x4D, 0x32, 0x96, 0x7B, 0xC1, 0x53, 0x16, 0x96, 0x02, 0x3D, 0x88, 0x04, 0x11,
-    0x00, 0x75, 0xA3, 0x61, 0x4F, 0x5E, 0x10, 0xB9, 0xCC, 0x07, 0xB1, 0x0D, 0x3C, 0xAF, 0xC7, 0x8C,
-    0xFD, 0x40, 0xB9, 0x2B, 0x42, 0x75, 0x96, 0x43, 0x2C, 0xD1, 0x9A, 0x3B, 0x5E, 0x3C, 0x3C, 0x83,
-    0x9E, 0x9B, 0x8D, 0x6B, 0x5A, 0x8A, 0x9B, 0xE2, 0x6A, 0x53, 0xC0, 0xE5, 0xCD, 0x28, 0x28, 0xBA,
-    0x24, 0x86, 0x8F, 0xB7, 0x10, 0xA7, 0x59, 0x1E, 0x73, 0x4A, 0xCE, 0x48, 0x34, 0x04, 0x56, 0x64,
-    0x82, 0xCD, 0x54, 0xA7, 0x80, 0x9D, 0x07, 0x76, 0xAD, 0x59, 0x83, 0xAF, 0x1B, 0x62, 0x4F, 0x3C,
-    0xA4, 0x40, 0x42, 0xA6, 0x80, 0x0E, 0xA4, 0x08, 0xD4, 0xE2, 0x91, 0xD6, 0x57, 0xA8, 0x89, 0x88,
-    0x13, 0x83, 0xF2, 0x68, 0x8A, 0xF2, 0x68, 0x53, 0x92, 0x38, 0x46, 0x49, 0x89, 0xBE, 0xF4, 0xF2,
-    0xE8, 0x0B, 0xFE, 0xB0, 0xB6, 0x38, 0xAE, 0xAA, 0x29, 0x94, 0xC9, 0xB8, 0xE0, 0xA4, 0xE8, 0xCA,
-    0x6F, 0x31, 0xC1, 0x5F, 0x1D, 0x26, 0xD8, 0x61, 0x7F, 0x5D, 0x2C, 0x39, 0xCE, 0xEB, 0x53, 0xB0,
-    0xBF, 0x9A, 0x36, 0xF0, 0x1C, 0x76, 0x70, 0xC6, 0xFE, 0x9A, 0x6F, 0xB1, 0xBF, 0xBB, 0xD8, 0xDF,
-    0x99, 0x71, 0x73, 0x1A, 0xCA, 0x2F, 0x97, 0x8C, 0x54, 0xBC, 0x90, 0xD1, 0x67, 0x26, 0xBF, 0x71,
-    0xD8, 0x5F, 0x64, 0x30, 0x1F, 0xAE, 0x0B, 0xCD, 0x62, 0x0B, 0x34, 0x71, 0xA3, 0x19, 0x79, 0x2D,
-    0xDC, 0x5D, 0x32, 0x17, 0x2B, 0xDE, 0x32, 0x74, 0x03, 0x36, 0x5B, 0xE3, 0x82, 0xA7, 0x92, 0xE4,
-    0xD5, 0xB4, 0x38, 0x11, 0x5E, 0xF6, 0xB5, 0x8E, 0xB7, 0xE0, 0x3B, 0xD0, 0xDB, 0x42, 0x94, 0xCD,
-    0xCF, 0x95, 0x0C, 0x39, 0xCD, 0xDE, 0x89, 0xAA, 0x69, 0x44, 0xF1, 0x2E, 0xBA, 0xF1, 0x25, 0x91,
-    0xCD, 0x42, 0xE2, 0x55, 0xA1, 0x34, 0xB3, 0x43, 0x36, 0x82, 0x4F, 0xEE, 0xE6, 0xD3, 0x66, 0x4D,
-    0xF3, 0xD9, 0x49, 0xFF, 0x4C, 0x92, 0x6B, 0x3E, 0x8D, 0xAA, 0xAF, 0x46, 0x4E, 0x01, 0x3A, 0xB1,
-    0xC7, 0xE2, 0x60, 0xA7, 0x4D, 0x1C, 0x5B, 0x8D, 0x7D, 0x16, 0xD8, 0xE7, 0x1A, 0x12, 0x44, 0x26,
-    0x26, 0x07, 0xC0, 0xD4, 0xBE, 0x69, 0x19, 0x34, 0xFE, 0x57, 0x1F, 0xF3, 0x12, 0xFF, 0x28, 0x63,
-    0xAB, 0x36, 0xC2, 0xDD, 0xF5, 0x2C, 0x3B, 0x69, 0x12, 0xFF, 0x55, 0x1E, 0x1B, 0x53, 0xEE, 0x3C,
-    0x99, 0x9F, 0x76, 0xBE, 0x68, 0x5F, 0x5F, 0x4C, 0xA3, 0x76, 0x81, 0xEB, 0x0A, 0xD1, 0x9C, 0x99,
-    0x28, 0x4D, 0xD1, 0x97, 0x62, 0x2A, 0xE3, 0xC1, 0xA9, 0x0C, 0x86, 0x28, 0xB7, 0x52, 0x5C, 0xA9,
-    0x24, 0x00, 0x95, 0xE0, 0x94, 0x8D, 0xDD, 0xAF, 0xC4, 0xB2, 0x89, 0x63, 0x24, 0x12, 0xF6, 0xDC,
-    0x3E, 0xAE, 0x5F, 0xD0, 0x35, 0xC6, 0xB9, 0x36, 0xAC, 0x63, 0xAB, 0xA5, 0x33, 0x9E, 0x56, 0xE8,
-    0x14, 0x4A, 0x98, 0xF4, 0x67, 0x95, 0xA2, 0x12, 0x4D, 0x86, 0x67, 0xAB, 0x30, 0x9D, 0x81, 0xB0,
-    0x8A, 0x82, 0x55, 0x08, 0xAC, 0xE2, 0x5F, 0x15, 0xFC, 0xAA, 0xC8, 0x57, 0x85, 0xBD, 0x2A, 0xE6,
-    0x55, 0x01, 0xAF, 0x0E, 0xED, 0x2A, 0x50, 0x57, 0xC5, 0xB9, 0x2A, 0xC8, 0x55, 0x11, 0xAE, 0x0A,
-    0x6F, 0x55, 0x6C, 0xAB, 0x02, 0x5B, 0x15, 0xD5, 0xAA, 0x90, 0x56, 0xC5, 0xB3, 0x2A, 0x98, 0x55,
-    0x91, 0xAC, 0x0A, 0x63, 0x55, 0x0C, 0xAB, 0x02, 0x58, 0x15, 0xBD, 0xEA, 0xA0, 0xAB, 0xA2, 0x0E,
-    0x66, 0x94, 0xA3, 0xA6, 0x83, 0x13, 0x61, 0x41, 0x38, 0xB8, 0xE7, 0x77, 0xCE, 0x48, 0xF8, 0x03,
-    0x4D, 0x2A, 0x58, 0x52, 0x23, 0x48, 0x52, 0xA3, 0x38, 0x52, 0x45, 0x91, 0x2A, 0x86, 0x54, 0x11,
-    0xA4, 0x0A, 0x1B, 0x9D, 0xBB, 0x2F, 0x5A, 0x69, 0x6B, 0x64, 0x0F, 0x09, 0x52, 0x54, 0xE0, 0xA1,
-    0x8A, 0x12, 0x5D, 0xCD, 0xC2, 0x85, 0xE9, 0x89, 0xFA, 0x13, 0xB9, 0x26, 0xBE, 0x9F, 0xED, 0x57,
-    0x2C, 0xB4, 0xAE, 0xE8, 0x2A, 0x14, 0x85, 0x82, 0x36, 0xCC, 0x3F, 0xEF, 0xF6, 0xEF, 0x74, 0x7B,
-    0x90, 0xD0, 0xDD, 0xCA, 0xC6, 0xC6, 0x55, 0x36, 0x24, 0x33, 0xBE, 0xAA, 0x6C, 0x08, 0xE3, 0xEE,
-    0x6A, 0x65, 0x63, 0x50, 0x78, 0x7F, 0x2F, 0xC9, 0x3C, 0xBF, 0xF3, 0xB5, 0xB2, 0x21, 0xAB, 0x33,
-    0x6C, 0xB4, 0xA2, 0x51, 0x7F, 0x62, 0x45, 0x83, 0x3D, 0xED, 0xC7, 0xA7, 0x2B, 0x19, 0xD8, 0xE3,
-    0x81, 0x3E, 0xDD, 0x29, 0x95, 0x8C, 0xF6, 0x74, 0x25, 0x43, 0xD9, 0x23, 0xCC, 0x11, 0xD6, 0x08,
-    0x63, 0xFA, 0x7D, 0x96, 0xC8, 0xC4, 0xA2, 0x77, 0x7A, 0x66, 0xC2, 0xA3, 0xA5, 0x2D, 0xFA, 0xF9,
-    0x5B, 0x6F, 0xF5, 0xC4, 0xDD, 0x19, 0x15, 0x0E, 0x54, 0x83, 0x36, 0x13, 0x57, 0x38, 0x24, 0x67,
-    0x7D, 0xEB, 0x55, 0xD4, 0xB7, 0x24, 0x47, 0xBF, 0x46, 0xFF, 0xD2, 0x80, 0x66, 0x8F, 0x67, 0x86,
-    0xC2, 0x27, 0xB3, 0xF2, 0xCB, 0xB3, 0x9D, 0x72, 0xCE, 0xB7, 0xF5, 0x8F, 0x4F, 0xAA, 0x7F, 0xCC,
-    0x3E, 0x93, 0x73, 0x9A, 0x4C, 0xD9, 0x98, 0x95, 0xDB, 0x04, 0xB3, 0xBC, 0x76, 0x9C, 0xF6, 0x3C,
-    0xA7, 0xAF, 0x5F, 0x5D, 0xC4, 0xB9, 0x88, 0xC3, 0x1A, 0xB5, 0x21, 0x6B, 0x5E, 0xA7, 0xAA, 0x0F,
-    0xA3, 0x92, 0x29, 0x10, 0xD7, 0x32, 0x68, 0xD8, 0xD9, 0xFA, 0xFB, 0x4A, 0xB6, 0x6E, 0x71, 0x46,
-    0x0E, 0xA9, 0x94, 0x1C, 0x92, 0xE5, 0x1C, 0x92, 0x6F, 0x39, 0x0D, 0x12, 0xFE, 0x8A, 0x73, 0x48,
-    0xD1, 0xBF, 0x71, 0x2E, 0x28, 0x7E, 0x93, 0xBB, 0xEB, 0x92, 0x43, 0xFA, 0xB1, 0xA4, 0x8B, 0x7A,
-    0xEE, 0xBC, 0x96, 0xBB, 0xA0, 0xE1, 0x6E, 0x53, 0x71, 0x0E, 0x29, 0x2A, 0x38, 0x87, 0x94, 0x48,
-    0x0E, 0xE9, 0x07, 0x92, 0x43, 0x7A, 0xC4, 0x39, 0xA4, 0xB1, 0xE3, 0x1C, 0x92, 0x04, 0x19, 0x1B,
-    0x84, 0x21, 0xA7, 0x72, 0x48, 0xA9, 0x08, 0xF7, 0x9E, 0xE4, 0x90, 0x7A, 0x71, 0x05, 0xEE, 0xCF,
-    0xBB, 0xE9, 0x64, 0x56, 0x1A, 0x21, 0xAF, 0x81, 0x48, 0xD6, 0x7B, 0xBD, 0xA4, 0x96, 0xDC, 0xAE,
-    0x79, 0x1B, 0x49, 0xA2, 0x3F, 0xED, 0x58, 0x59, 0x35, 0x9A, 0x57, 0xE6, 0x47, 0xBF, 0x39, 0x2B,
-    0xD4, 0xC3, 0xAC, 0xD3, 0x1C, 0x69, 0x00, 0x08, 0x25, 0x7A, 0x9E, 0x79, 0x1F, 0xFC, 0x1A, 0x6D,
-    0xF4, 0x01, 0xDA, 0x98, 0xB3, 0x3F, 0xD7, 0xB9, 0x45, 0x01, 0x38, 0x7D, 0xD6, 0xA1, 0xB5, 0x0D,
-    0x92, 0x44, 0x1C, 0x78, 0xC0, 0x2E, 0xEE, 0x25, 0x89, 0xD8, 0x95, 0x11, 0x94, 0x43, 0x50, 0x5F,
-    0x59, 0x9E, 0x7B, 0xB8, 0xFD, 0x8E, 0x60, 0x2F, 0xD3, 0x46, 0xEC, 0x41, 0xDC, 0xC9, 0x90, 0xC3,
-    0x41, 0x90, 0xD1, 0xDE, 0xA8, 0xC0, 0xB3, 0xDC, 0x0C, 0xBA, 0x56, 0x5F, 0xFB, 0x06, 0x94, 0xB2,
-    0xAF, 0xDD, 0x47, 0xA6, 0x3D, 0xE9, 0xC8, 0x9F, 0xA6, 0x63, 0x60, 0xE2, 0x83, 0x91, 0xFD, 0xEF,
-    0x92, 0xF3, 0x3D, 0x49, 0xF1, 0x98, 0x59, 0x71, 0xE9, 0x9C, 0x15, 0xAE, 0x6F, 0xB9, 0x90, 0xB7,
-    0xD1, 0xF4, 0x90, 0xF2, 0xFA, 0xF9, 0xA8, 0xC8, 0x29, 0x79, 0x7E, 0x63, 0x80, 0x8A, 0xA3, 0xD7,
-    0x77, 0xF6, 0x34, 0xCF, 0x05, 0x85, 0x25, 0x08, 0x5B, 0x84, 0x29, 0xC2, 0x92, 0xF4, 0xF9, 0xC4,
-    0xD7, 0xCD, 0xC5, 0x72, 0xEC, 0xB1, 0xE2, 0x1C, 0xC8, 0xF2, 0xF2, 0x83, 0x6B, 0xF7, 0xB1, 0xF2,
-    0x62, 0xE4, 0x32, 0x2C, 0x66, 0x66, 0xEC, 0x1B, 0x23, 0x43, 0xDB, 0x4A, 0xCE, 0xA7, 0x22, 0x97,
-    0xEA, 0x65, 0xB3, 0x6B, 0x8D, 0xB4, 0x87, 0x2D, 0x24, 0x7A, 0x0A, 0xED, 0x87, 0xDB, 0xB2, 0x02,
-    0xAB, 0x63, 0x0E, 0x21, 0xA2, 0x55, 0xBB, 0xA9, 0x3E, 0xB9, 0x48, 0xD4, 0x68, 0x2C, 0xD6, 0xCD,
-    0x6D, 0xF3, 0x59, 0x4A, 0x4B, 0x24, 0x5E, 0x0E, 0x5B, 0xA4, 0x65, 0x11, 0x07, 0xA4, 0x7D, 0xF1,
-    0x84, 0xA7, 0x9D, 0x73, 0x84, 0xB6, 0xBD, 0x76, 0x42, 0x3B, 0x2A, 0x69, 0xB9, 0xB0, 0x4B, 0xFB,
-    0x29, 0x18, 0x36, 0x50, 0xAD, 0xD8, 0x4D, 0x69, 0xF6, 0x78, 0xAD, 0x56, 0xBC, 0xDB, 0x99, 0x11,
-    0x03, 0x03, 0x6B, 0x13, 0x90, 0xBF, 0x0A, 0x95, 0x56, 0xB6, 0x50, 0x8B, 0x9C, 0xD1, 0xE8, 0x49,
-    0xAB, 0x49, 0x33, 0x40, 0x27, 0x6B, 0xF3, 0xEC, 0xF8, 0xF8, 0x46, 0xDA, 0x3B, 0x9B, 0xBB, 0xA4,
-    0x5E, 0x61, 0x43, 0xDA, 0x8D, 0x2D, 0x30, 0xA6, 0x67, 0x77, 0x1A, 0x17, 0xDE, 0x8D, 0xEE, 0x79,
-    0x81, 0x43, 0x79, 0xC8, 0x4E, 0x9C, 0x35, 0xCB, 0x27, 0xC0, 0x4A, 0x27, 0xFC, 0xBC, 0x41, 0xCA,
-    0x38, 0xBA, 0xDF, 0x33, 0x5F, 0x23, 0x3E, 0xCB, 0x6A, 0xE7, 0x2C, 0x34, 0x33, 0x91, 0xF7, 0x3E,
-    0x6F, 0x7C, 0xDE, 0xF5, 0x47, 0xF3, 0x3A, 0x7F, 0xA5, 0x7C, 0xBE, 0x7D, 0x42, 0x7B, 0x2A, 0x15,
-    0xE9, 0xA7, 0x14, 0x94, 0x0C, 0xC0, 0x74, 0x4E, 0x01, 0x4B, 0x7F, 0x5C, 0x4B, 0x9F, 0x8B, 0x19,
-    0x7C, 0x2E, 0x07, 0x9E, 0x1C, 0xA2, 0x7B, 0x5F, 0x6D, 0xC3, 0xF7, 0xE0, 0xBB, 0x59, 0x77, 0xF3,
-    0xDB, 0x7F, 0xCD, 0xC3, 0x45, 0xDA, 0xA6, 0x93, 0xE1, 0x52, 0x70, 0x3D, 0xB1, 0x07, 0x68, 0xC6,
-    0x53, 0x36, 0x90, 0xEB, 0xB1, 0xB9, 0x64, 0xA7, 0x35, 0x87, 0xFC, 0x25, 0x1B, 0x37, 0x20, 0xD4,
-    0x51, 0xA5, 0xB9, 0x9D, 0x71, 0x8E, 0x22, 0xC2, 0x4F, 0xDE, 0x3C, 0x27, 0xC3, 0x4E, 0xFF, 0xEE,
-    0x52, 0x0C, 0xFC, 0x9A, 0x8A, 0x53, 0xF3, 0x38, 0x55, 0xA8, 0xA5, 0x66, 0xEF, 0x25, 0xFE, 0xE1,
-    0x7A, 0xA2, 0x57, 0xF5, 0x41, 0xF4, 0x5B, 0xA2, 0x4C, 0x63, 0x1E, 0xCB, 0xC4, 0x6A, 0x14, 0x4A,
-    0x74, 0xAD, 0x42, 0xC1, 0x8D, 0x5C, 0x33, 0xC1, 0xDE, 0x17, 0xFA, 0x93, 0x7B, 0x62, 0xEE, 0xF8,
-    0xF3, 0xB6, 0x07, 0xEC, 0x63, 0xDA, 0xBF, 0x64, 0xCB, 0x92, 0xD7, 0xF2, 0xFC, 0x48, 0xCB, 0x48,
-    0xF0, 0xB0, 0x63, 0x47, 0xDA, 0x1B, 0x82, 0x56, 0xFC, 0xAC, 0x0B, 0x53, 0xA8, 0x64, 0x27, 0x53,
-    0x7C, 0x91, 0x18, 0x0B, 0x91, 0xAC, 0x0F, 0x6A, 0x78, 0xFE, 0xC4, 0xBF, 0x5F, 0x51, 0x7A, 0xE3,
-    0x0C, 0x9C, 0xF7, 0xB2, 0x4B, 0xE7, 0xEB, 0xB9, 0x2D, 0x7E, 0x74, 0x09, 0xA3, 0x10, 0xC0, 0xBA,
-    0x82, 0x15, 0x38, 0x3C, 0x09, 0x3A, 0x9F, 0x7F, 0xA3, 0xA7, 0xE6, 0xF8, 0x8F, 0x74, 0xEB, 0x77,
-    0x2E, 0xD6, 0x73, 0x76, 0xD8, 0xAC, 0xEE, 0xA9, 0xBA, 0x48, 0xFD, 0x0D, 0x2E, 0x16, 0xF3, 0x4F,
-    0x17, 0xFD, 0x98, 0x9F, 0xE6, 0x7E, 0xCD, 0x9C, 0x2B, 0x79, 0x89, 0xBF, 0x61, 0xC2, 0x91, 0xC3,
-    0x16, 0xCF, 0x4A, 0x36, 0xAB, 0x7C, 0x47, 0xF2, 0x1F, 0x15, 0x87, 0xFE, 0x61, 0xCB, 0x8F, 0xE0,
-    0x99, 0xA3, 0x9D, 0x84, 0x1E, 0x57, 0xAB, 0xB4, 0x10, 0x73, 0xD5, 0x3E, 0x45, 0x52, 0xCB, 0x47,
-    0x4D, 0x44, 0x74, 0x87, 0xFE, 0xC4, 0x86, 0xED, 0xB9, 0x2B, 0xCF, 0xEC, 0xBA, 0xD5, 0x91, 0xAA,
-    0x73, 0xA4, 0x78, 0xC4, 0xD7, 0xF4, 0xA4, 0x82, 0xE0, 0xD9, 0xA7, 0x8A, 0xBB, 0x91, 0x9C, 0x66,
-    0x93, 0xF2, 0x77, 0x4D, 0xCC, 0x89, 0xCE, 0x46, 0x70, 0x37, 0x4D, 0xC8, 0x49, 0xB4, 0x26, 0x70,
-    0xB7, 0x15, 0x65, 0x58, 0x0E, 0xEC, 0xC1, 0x0A, 0xEE, 0xA6, 0x88, 0xD8, 0x52, 0x16, 0x5E, 0xD9,
-    0xF2, 0xC6, 0x8A, 0x61, 0x8F, 0x78, 0x5B, 0xD1, 0xAE, 0x42, 0x41, 0xE0, 0xF5, 0x51, 0xF7, 0xD4,
-    0x7A, 0x4B, 0x1D, 0x66, 0xA9, 0xFD, 0x09, 0xFC, 0xB3, 0x0F, 0x90, 0xB0, 0xFB, 0x77, 0x3B, 0x78,
-    0x76, 0x04, 0x7A, 0xBC, 0x8F, 0xE0, 0xCC, 0x6D, 0xB8, 0x3C, 0xB5, 0x63, 0x57, 0x3E, 0x87, 0x92,
-    0x07, 0xEA, 0x8D, 0x1F, 0x4C, 0x40, 0x54, 0xA6, 0x69, 0x55, 0xF7, 0x13, 0x62, 0xC5, 0xF2, 0x38,
-    0xD8, 0xA6, 0xE6, 0x2A, 0x3A, 0x05, 0xB1, 0xAD, 0xA4, 0x0C, 0x8E, 0x2E, 0x86, 0x14, 0xF6, 0x1D,
-    0x16, 0x06, 0x0E, 0xFF, 0x0C, 0x99, 0xBB, 0x1E, 0xFB, 0xE5, 0xC8, 0xBC, 0x72, 0x29, 0x1C, 0xDE,
-    0xE7, 0xA7, 0xD4, 0xC8, 0x53, 0x69, 0x65, 0x4F, 0x08, 0x0A, 0x42, 0xAA, 0x5D, 0x79, 0xC6, 0xB2,
-    0x89, 0xAB, 0xD4, 0xEC, 0xA9, 0xDD, 0x8B, 0xF0, 0x6C, 0xC9, 0xC1, 0x03, 0x7E, 0x98, 0x28, 0x98,
-    0x38, 0x01, 0xE8, 0xD9, 0x37, 0xF9, 0xAB, 0xBC, 0x12, 0x1C, 0x5A, 0xCD, 0xA8, 0x87, 0xB0, 0x8D,
-    0x4E, 0xE9, 0x81, 0x73, 0xFD, 0xD0, 0x21, 0xBB, 0xF8, 0xEA, 0xE3, 0xA3, 0xFA, 0x65, 0x66, 0x2F,
-    0x5F, 0xDD, 0x7C, 0xF5, 0xF3, 0xD7, 0x8E, 0xFE, 0x05, 0x79, 0xA2, 0xF0, 0xE0, 0x5D, 0x57, 0xAB,
-    0x12, 0x2B, 0x5C, 0xAD, 0xAC, 0x70, 0x1B, 0xC8, 0x63, 0x40, 0xA6, 0x5B, 0x67, 0xE6, 0xBE, 0x0E,
-    0x4F, 0x10, 0x5F, 0xD5, 0xA8, 0xA5, 0x08, 0xA6, 0x37, 0x48, 0xEB, 0x74, 0x08, 0x58, 0x48, 0xB3,
-    0xB4, 0xB4, 0x5F, 0x63, 0x6E, 0xAA, 0xB4, 0x23, 0x61, 0xA6, 0x52, 0x46, 0x2D, 0x04, 0x27, 0x83,
-    0xDC, 0x2F, 0x00, 0x44, 0x38, 0xB7, 0x44, 0x05, 0x34, 0x56, 0xBC, 0x50, 0x8B, 0x7B, 0x60, 0x6D,
-    0x90, 0x3E, 0x81, 0x8D, 0x4F, 0x32, 0x32, 0x99, 0x64, 0xF1, 0xA2, 0xA1, 0x44, 0x85, 0x80, 0x63,
-    0x96, 0x9C, 0x42, 0xF5, 0x16, 0x38, 0x23, 0xCE, 0xF2, 0xE2, 0xAC, 0x27, 0xEB, 0x6A, 0xA0, 0xFF,
-    0xD0, 0x55, 0xC3, 0xB9, 0x2A, 0xBC, 0x69, 0x1D, 0xBA, 0x8C, 0x7F, 0xB8, 0xE5, 0x92, 0x4A, 0xC2,
-    0x47, 0x92, 0x78, 0x2A, 0xC9, 0x91, 0xDB, 0x0C, 0x69, 0x15, 0x0C, 0x79, 0xE5, 0x77, 0x79, 0xE3,
-    0x65, 0x80, 0x90, 0xA6, 0xA8, 0x8D, 0xD3, 0xA8, 0x50, 0xCC, 0xF6, 0x31, 0x46, 0x0E, 0x9D, 0xCA,
-    0xE9, 0xF7, 0x69, 0x6C, 0xF7, 0x68, 0xD4, 0x25, 0x99, 0xA7, 0x32, 0x0B, 0xC6, 0xBC, 0xDE, 0xF4,
-    0xF8, 0xF1, 0x84, 0x10, 0x33, 0xD0, 0x07, 0xC1, 0xCC, 0xE5, 0xFB, 0x82, 0xED, 0x42, 0xC1, 0x0D,
-    0x5B, 0x34, 0xE5, 0xB4, 0x06, 0x92, 0x1A, 0x5C, 0x8D, 0x26, 0xC7, 0x22, 0x97, 0xDC, 0x74, 0xFE,
-    0x61, 0x39, 0x6D, 0xAD, 0x29, 0xE1, 0x19, 0xA4, 0xA4, 0x64, 0xB9, 0x7B, 0x84, 0x2E, 0x71, 0xDD,
-    0x9F, 0xA1, 0xBB, 0x6C, 0xE6, 0x9C, 0xF8, 0x57, 0xDF, 0xA5, 0xA3, 0x6E, 0x38, 0x7D, 0x32, 0x7C,
-    0x58, 0xBA, 0xBD, 0xD7, 0xE5, 0x77, 0xD7, 0xCF, 0x03, 0x6A, 0xF6, 0x3C, 0xDE, 0x41, 0xF1, 0x5D,
-    0x5F, 0x57, 0x28, 0xB0, 0xA9, 0x81, 0xD6, 0x4A, 0x6A, 0xCE, 0xC4, 0x32, 0xBC, 0x44, 0x7F, 0x7C,
-    0xE2, 0xBB, 0xF6, 0xE9, 0xD1, 0x17, 0x09, 0x4C, 0x78, 0x2B, 0xDA, 0xE9, 0x7D, 0x1A, 0x2E, 0x6A,
-    0x8B, 0xED, 0xBC, 0x2E, 0x31, 0x36, 0xA4, 0x4C, 0x31, 0x2A, 0x4E, 0x1D, 0x64, 0x32, 0x98, 0xD7,
-    0x16, 0x23, 0xFD, 0x44, 0x4A, 0xEF, 0x29, 0x69, 0x93, 0xBA, 0xC4, 0x8F, 0x89, 0xB1, 0xF9, 0x85,
-    0x43, 0x49, 0x4B, 0x81, 0x9A, 0xAB, 0xF2, 0xB3, 0xA3, 0x92, 0x0C, 0xB3, 0xAD, 0xE6, 0x93, 0x93,
-    0x09, 0x16, 0xEA, 0x09, 0x18, 0x44, 0x5F, 0x5E, 0xFF, 0x91, 0x20, 0x93, 0x5A, 0x07, 0x8F, 0x60,
-    0xEE, 0xE1, 0x98, 0xFD, 0x26, 0x9D, 0x5C, 0x7C, 0x5E, 0xF6, 0x7A, 0x46, 0xC8, 0xD7, 0xB3, 0xFA,
-    0x78, 0x6D, 0xC9, 0xB1, 0x25, 0xAA, 0xA0, 0xA8, 0xF5, 0xFD, 0x0B, 0x0F, 0xF2, 0xBB, 0xFF, 0xC8,
-    0x6E, 0x47, 0x43, 0xFA, 0x91, 0xEC, 0x75, 0xDA, 0xC2, 0x6B, 0xAC, 0xC8, 0x1D, 0x45, 0x53, 0x71,
-    0x73, 0x50, 0x04, 0xF2, 0x5B, 0x64, 0x85, 0x66, 0xBA, 0xB9, 0xCE, 0x86, 0x21, 0xF3, 0x6F, 0x22,
-    0x95, 0xB8, 0xE0, 0x1F, 0x73, 0x31, 0x8F, 0x0F, 0xF1, 0x05, 0xC1, 0x55, 0x3B, 0xE8, 0xC8, 0x2A,
-    0xEA, 0xAE, 0x75, 0x82, 0x8C, 0x52, 0xC2, 0x34, 0x7C, 0x9C, 0x0B, 0x70, 0x8F, 0xF8, 0x01, 0x40,
-    0x62, 0xFC, 0x85, 0x48, 0xF5, 0x81, 0xFE, 0x00, 0x4D, 0xA9, 0x62, 0x66, 0x38, 0x9F, 0x51, 0x44,
-    0xDF, 0x2A, 0x41, 0x39, 0x97, 0xB2, 0x76, 0xA0, 0x7D, 0xD8, 0xED, 0xA5, 0xA4, 0x6D, 0xF8, 0x0F,
-    0xF6, 0xFE, 0xAA, 0x7A, 0x25, 0x81, 0x06, 0x9B, 0x52, 0x85, 0xFD, 0xA2, 0xBD, 0x75, 0x48, 0x01,
-    0xED, 0xBF, 0xEC, 0xF5, 0xA4, 0x77, 0xE3, 0xC3, 0x78, 0xA5, 0x4A, 0xB9, 0xCC, 0x81, 0x8B, 0x26,
-    0x82, 0x1B, 0x57, 0xE0, 0xB8, 0x43, 0x8E, 0x2B, 0x74, 0xDC, 0xE9, 0x7C, 0x01, 0x8F, 0x33, 0x7A,
-    0x5C, 0xE1, 0xE3, 0x8A, 0x1F, 0x57, 0x00, 0xB9, 0xE3, 0xD9, 0x8B, 0xA1, 0x00, 0x35, 0x2A, 0xD8,
-    0x9E, 0xFD, 0xA5, 0x65, 0xF4, 0xD6, 0x6F, 0x2C, 0xFB, 0x7B, 0x5A, 0xC1, 0xEE, 0xC5, 0xDF, 0x6B,
-    0x85, 0x95, 0xAD, 0xFF, 0x4A, 0x2A, 0xD8, 0xFF, 0x0F, 0x85, 0x56, 0x31, 0x8C, 0xE4, 0x48, 0x15,
-    0x7D, 0x6E, 0x4F, 0xB7, 0x01, 0x8B, 0xF5, 0x06, 0xD3, 0x62, 0x99, 0xE3, 0x54, 0x17, 0x0C, 0xD2,
-    0x32, 0xBA, 0xC1, 0xC9, 0x05, 0x17, 0x4C, 0x77, 0x79, 0x75, 0x12, 0x1B, 0x20, 0xA4, 0x0E, 0xA6,
-    0x45, 0xC6, 0x6E, 0x70, 0x01, 0x37, 0x08, 0x8D, 0xC8, 0x1A, 0x69, 0x66, 0x6C, 0x8E, 0x80, 0x80,
-    0xA4, 0x45, 0x42, 0xC8, 0x04, 0x8B, 0x98, 0x6D, 0x82, 0xBD, 0x04, 0x69, 0x82, 0x9E, 0x75, 0xA1,
-    0x0B, 0x08, 0x2E, 0xB1, 0x10, 0xD2, 0xA5, 0xD6, 0x4A, 0x17, 0x40, 0x82, 0x41, 0x5E, 0xC9, 0x3B,
-    0xD8, 0x5D, 0xBC, 0x6F, 0xF7, 0xEC, 0xDC, 0xB2, 0xA3, 0xA5, 0xAA, 0xEC, 0xB2, 0xAB, 0x7E, 0xD5,
-    0xFF, 0xF5, 0xFF, 0xFB, 0xFF, 0xD7, 0xCE, 0x19, 0xC2, 0x06, 0x9E, 0x85, 0x63, 0x13, 0xE8, 0x0C,
-    0x5E, 0x01, 0x4C, 0xB0, 0x38, 0x85, 0xCD, 0x5D, 0x9B, 0xF8, 0x0D, 0x54, 0x01, 0x9D, 0x60, 0x13,
-    0xC0, 0xC1, 0x29, 0x60, 0x4B, 0xB8, 0xB6, 0x86, 0xFF, 0xDC, 0x22, 0x34, 0x3A, 0x89, 0x11, 0x64,
-    0x9B, 0x70, 0x22, 0x9C, 0x61, 0xD3, 0xB3, 0xC9, 0x48, 0xD9, 0xE7, 0xB5, 0xB6, 0xB6, 0x1E, 0x7B,
-    0xB6, 0x38, 0x42, 0x9A, 0x01, 0x1B, 0x38, 0x58, 0x3C, 0x8E, 0x6D, 0xC3, 0x36, 0x9C, 0xEE, 0x2F,
-    0x58, 0x4E, 0x2D, 0x4B, 0x71, 0xC0, 0xAF, 0xF9, 0x23, 0x6C, 0xD5, 0xD0, 0xE9, 0xBD, 0x95, 0xB6,
-    0xB5, 0xB2, 0xA5, 0x6B, 0x0D, 0x19, 0xF9, 0xB9, 0xAE, 0xA5, 0x86, 0x55, 0x3F, 0x92, 0xF5, 0xC2,
-    0x47, 0x67, 0xA9, 0x89, 0xF3, 0xD4, 0x68, 0x13, 0x9B, 0xAF, 0x45, 0x5B, 0x78, 0xEB, 0x05, 0x62,
-    0x9B, 0x9C, 0x87, 0xE6, 0x9D, 0xC0, 0x40, 0x19, 0xA4, 0x91, 0x5B, 0xA1, 0x57, 0xA0, 0x97, 0xC3,
-    0x79, 0x84, 0xC0, 0x42, 0x3F, 0x31, 0x47, 0x6E, 0xD6, 0x35, 0xFD, 0xC0, 0x28, 0x1B, 0x71, 0xDC,
-    0x59, 0x7C, 0xEF, 0xB1, 0x6B, 0x83, 0xDA, 0xAF, 0x55, 0x11, 0x14, 0xDA, 0x84, 0x26, 0x45, 0x8C,
-    0x9A, 0x3C, 0x27, 0xD8, 0x41, 0xEF, 0x34, 0x4C, 0x82, 0x2C, 0x28, 0xE2, 0xC4, 0x5D, 0xAD, 0xA8,
-    0x8E, 0x1A, 0x48, 0x4B, 0x60, 0x38, 0xC1, 0xDD, 0xE3, 0xB6, 0x7C, 0x67, 0x90, 0x8C, 0x7D, 0xF3,
-    0x3F, 0x6D, 0xF1, 0x8B, 0x05, 0x74, 0x6E, 0x13, 0x55, 0xE8, 0xCC, 0xAB, 0x54, 0xE1, 0x34, 0x5E,
-    0x89, 0xD8, 0xA9, 0xD1, 0x6F, 0x75, 0x06, 0x84, 0x09, 0xF7, 0xC9, 0xA9, 0xB9, 0xA2, 0xEB, 0xF9,
-    0x3F, 0x86, 0x6F, 0x74, 0xA4, 0x8C, 0xBA, 0xB4, 0x91, 0x6F, 0x85, 0x17, 0xF9, 0xF4, 0x49, 0xFB,
-    0x11, 0x7C, 0x9B, 0x87, 0xB6, 0xA2, 0xB2, 0x9E, 0xE2, 0x29, 0x55, 0x33, 0xE1, 0xF0, 0x57, 0x71,
-    0xE1, 0x56, 0x41, 0x12, 0x42, 0x47, 0x3A, 0x8B, 0x4B, 0x51, 0x8D, 0x2A, 0x07, 0xF3, 0xC1, 0x5C,
-    0x55, 0x61, 0x1D, 0x36, 0xAA, 0xF1, 0x1A, 0x9E, 0xA1, 0xEA, 0x15, 0xA1, 0x39, 0xC1, 0x6D, 0x0C,
-    0xE6, 0x21, 0x69, 0xE2, 0x9A, 0x94, 0x99, 0x46, 0x88, 0xC0, 0x50, 0x35, 0x17, 0xD8, 0x10, 0x7A,
-    0xFD, 0x25, 0x7A, 0x77, 0x4D, 0x4F, 0x53, 0xEB, 0x1A, 0x41, 0x83, 0x9E, 0x05, 0x62, 0x83, 0x20,
-    0x17, 0x7B, 0x2E, 0x4E, 0x69, 0x0C, 0xA2, 0x22, 0xA8, 0x04, 0x14, 0x29, 0xDA, 0xC3, 0xCC, 0x51,
-    0x4C, 0x0B, 0x5B, 0x2C, 0x0A, 0xB0, 0x3E, 0xE4, 0xEB, 0x79, 0x64, 0x8B, 0xCB, 0x53, 0xF9, 0x3D,
-    0x58, 0x9C, 0xA6, 0xB6, 0x64, 0x1B, 0xFE, 0xB0, 0x44, 0xEF, 0xB5, 0x86, 0x89, 0x9F, 0xAB, 0x96,
-    0x79, 0xAF, 0x46, 0xED, 0x95, 0xB1, 0xF9, 0x88, 0xFB, 0x79, 0x59, 0x68, 0xC6, 0xD8, 0x63, 0x1D,
-    0x43, 0x65, 0x3D, 0xA2, 0xC5, 0x35, 0x52, 0xBF, 0xF1, 0xB7, 0x74, 0x75, 0xF0, 0x98, 0xEA, 0x5A,
-    0xA5, 0xAB, 0x6E, 0xA4, 0x97, 0xF4, 0x12, 0xE9, 0xAF, 0x46, 0x7A, 0xC9, 0x74, 0x6A, 0xED, 0x62,
-    0x81, 0x6F, 0xF2, 0x84, 0x52, 0xC7, 0x38, 0x49, 0x9B, 0xB4, 0x8E, 0x8B, 0x7E, 0xF4, 0x21, 0x2A,
-    0xD6, 0x73, 0x2C, 0x79, 0xEA, 0x78, 0xA5, 0x57, 0x41, 0xE3, 0x4C, 0xFC, 0xB9, 0xAE, 0xA8, 0x92,
-    0x5A, 0x57, 0x83, 0xA4, 0x35, 0xCA, 0x1A, 0x53, 0x5A, 0x30, 0x95, 0x75, 0x98, 0x62, 0xF1, 0x57,
-    0xD0, 0xD6, 0x1C, 0x7B, 0x6B, 0xE0, 0xD0, 0xBC, 0xA1, 0x4D, 0xA8, 0xAE, 0xAD, 0xD3, 0x30, 0xD7,
-    0x34, 0xD9, 0x09, 0x15, 0x37, 0x01, 0x22, 0x50, 0x56, 0x6A, 0xD5, 0xB5, 0x91, 0x68, 0x4C, 0x65,
-    0xDC, 0xEF, 0xDB, 0x04, 0xA8, 0x8D, 0x74, 0x05, 0xA7, 0x22, 0x82, 0x39, 0x20, 0x5E, 0x13, 0xB7,
-    0xF3, 0xFA, 0x32, 0x53, 0x36, 0x1B, 0xD8, 0x64, 0xB3, 0xC3, 0x11, 0x86, 0xD3, 0x69, 0x24, 0x3E,
-    0x20, 0x0F, 0x7D, 0xAF, 0x28, 0xE1, 0x14, 0x44, 0x47, 0xC1, 0xAD, 0x27, 0xF3, 0xED, 0x41, 0xFE,
-    0xBE, 0x5F, 0x2C, 0x6F, 0x11, 0x03, 0xEA, 0xE3, 0xF2, 0xA9, 0xB8, 0x43, 0x12, 0x9A, 0xA0, 0xB0,
-    0x64, 0xD7, 0x74, 0x50, 0x11, 0x28, 0x49, 0x21, 0x9C, 0x9C, 0xB5, 0x43, 0x06, 0x6B, 0x87, 0x3C,
-    0x81, 0x9F, 0xC9, 0xD4, 0x48, 0x20, 0x46, 0xDB, 0x87, 0x5F, 0xA4, 0x51, 0x60, 0x6D, 0x4B, 0xD3,
-    0xC2, 0x4F, 0xCA, 0xE1, 0xBC, 0x5B, 0xC3, 0x71, 0xF5, 0x8F, 0x34, 0xD2, 0x50, 0x89, 0x40, 0x52,
-    0xA6, 0x9C, 0x17, 0xB8, 0xEB, 0x53, 0x05, 0xCA, 0x5E, 0xD6, 0x3A, 0xB5, 0xD5, 0x31, 0x1D, 0xF9,
-    0xC7, 0x88, 0x5B, 0xA5, 0xD1, 0x7F, 0x3B, 0x47, 0xDE, 0x59, 0x9C, 0x4D, 0xA7, 0x62, 0x80, 0xAE,
-    0xD0, 0x95, 0x1F, 0x5F, 0xFD, 0xA7, 0x96, 0x78, 0x5E, 0x97, 0xAB, 0x79, 0x1E, 0x77, 0x1F, 0x8F,
-    0xB0, 0xE9, 0xDB, 0xE4, 0x78, 0x1D, 0x20, 0xAA, 0xB1, 0xDF, 0x06, 0x08, 0x23, 0x0E, 0x2E, 0x25,
-    0xB6, 0xB2, 0xB3, 0x6C, 0xBD, 0x38, 0x5B, 0x2F, 0xD7, 0xED, 0x62, 0xB3, 0xEE, 0x76, 0x24, 0x74,
-    0x2C, 0x44, 0x8E, 0xDB, 0x94, 0x92, 0x4A, 0xF0, 0xBB, 0x03, 0x79, 0x82, 0x5A, 0x62, 0x8C, 0xD1,
-    0x2B, 0xAC, 0x68, 0x58, 0x9E, 0xFE, 0xEB, 0x78, 0x59, 0x1E, 0xF2, 0xA9, 0x3B, 0x7A, 0x46, 0x07,
-    0xB8, 0x54, 0x80, 0x47, 0x9E, 0x0C, 0x1A, 0x50, 0x0C, 0x2E, 0x21, 0xA7, 0xC7, 0x7C, 0x8E, 0x5E,
-    0x27, 0xF3, 0x6F, 0x20, 0xBB, 0xB8, 0x81, 0x2C, 0xBB, 0x99, 0xEC, 0xDD, 0x97, 0x22, 0x1C, 0x13,
-    0x08, 0x7E, 0x0B, 0x62, 0xDF, 0xC4, 0xD1, 0x4C, 0xC4, 0x8F, 0xC4, 0xD8, 0x62, 0xF4, 0x1A, 0x6E,
-    0x71, 0x05, 0x04, 0x2A, 0x70, 0x72, 0x05, 0x8C, 0xE7, 0xD3, 0x69, 0x0B, 0x88, 0xAB, 0x47, 0xC6,
-    0x24, 0x72, 0x0E, 0xEE, 0x9D, 0xEA, 0xFF, 0x34, 0x7F, 0x3A, 0xF9, 0x51, 0xBE, 0xE7, 0xE7, 0xEF,
-    0xFA, 0xC0, 0xFB, 0xDF, 0x1A, 0x1F, 0xAB, 0x92, 0xBE, 0x55, 0x1D, 0x1F, 0x6F, 0xDF, 0x71, 0x12,
-    0x65, 0x46, 0x3C, 0xCC, 0x08, 0x62, 0x7A, 0x2F, 0x73, 0x33, 0x89, 0x33, 0x9B, 0xAF, 0x18, 0xE3,
-    0x4A, 0x2C, 0xD1, 0xE6, 0x95, 0xF1, 0x24, 0x04, 0x54, 0x12, 0x02, 0x5C, 0x4E, 0xA7, 0x89, 0x00,
-    0xBA, 0x0D, 0x01, 0xBD, 0x2E, 0x04, 0xD4, 0x08, 0x73, 0x81, 0xB2, 0x6C, 0xF4, 0x46, 0x33, 0x86,
-    0x49, 0x9C, 0xC5, 0xB9, 0xCA, 0x85, 0xEF, 0x49, 0xCB, 0x85, 0x5A, 0x71, 0xA9, 0x31, 0xB7, 0x41,
-    0xF8, 0xAB, 0xAA, 0xD1, 0x7F, 0xF9, 0xB7, 0x8D, 0x3F, 0x7B, 0x66, 0xF5, 0x67, 0x7F, 0x5E, 0xF5,
-    0x83, 0xE4, 0x43, 0x38, 0xB4, 0x5D, 0x96, 0xE6, 0x69, 0x1E, 0xE7, 0x31, 0x83, 0x93, 0x9F, 0xBF,
-    0xC9, 0x33, 0xFE, 0x1F, 0xC4, 0x6E, 0x0C, 0xCF, 0xC3, 0xFD, 0xB8, 0x89, 0x9B, 0xE1, 0x05, 0xCD,
-    0x20, 0x15, 0xEF, 0x01, 0xFB, 0xCB, 0x0D, 0xCF, 0x96, 0xBB, 0xCA, 0xBE, 0x58, 0x4A, 0xAA, 0xDA,
-    0x0B, 0x6C, 0x39, 0xA3, 0x7F, 0xB6, 0xE6, 0x93, 0x20, 0x3C, 0x98, 0xD3, 0x9C, 0x34, 0xB1, 0xC0,
-    0x49, 0xF1, 0xF1, 0x68, 0xE6, 0x7D, 0x8C, 0x3C, 0x9B, 0x2D, 0x15, 0xE9, 0xB9, 0xA6, 0x1C, 0x0F,
-    0x6C, 0x76, 0x24, 0x47, 0xF6, 0xF3, 0x8E, 0xAE, 0xA5, 0xE5, 0x1A, 0xAA, 0xED, 0x8D, 0x2A, 0x7A,
-    0xB3, 0x17, 0xB8, 0x30, 0xC1, 0xA2, 0x60, 0x2E, 0x64, 0x0A, 0xF0, 0x91, 0xF7, 0xD0, 0xBA, 0x1D,
-    0x7A, 0x09, 0x93, 0x55, 0xED, 0x65, 0x57, 0x35, 0x96, 0x44, 0xA9, 0x9A, 0x75, 0xF7, 0xF3, 0x09,
-    0xA6, 0xE8, 0xFF, 0x74, 0xD6, 0x92, 0xEE, 0xCE, 0xDA, 0x48, 0xCD, 0xEE, 0xD6, 0xDE, 0x27, 0xD8,
-    0x05, 0x6E, 0x6D, 0x7E, 0x22, 0x1B, 0x1B, 0x69, 0xDC, 0x48, 0x1A, 0xBE, 0xC2, 0x91, 0x6D, 0xDC,
-    0x7E, 0x9B, 0xDD, 0x6C, 0x63, 0x26, 0x9C, 0x6F, 0xEF, 0xCE, 0x08, 0x4B, 0x6C, 0xEC, 0xCE, 0xF6,
-    0x64, 0x93, 0xDD, 0xD9, 0x36, 0xBB, 0x3B, 0xBB, 0xEB, 0x3D, 0xB7, 0x5B, 0xCA, 0x3B, 0x90, 0xEE,
-    0xBD, 0xF6, 0x8C, 0x72, 0xCC, 0xF5, 0x9E, 0xCE, 0x0F, 0xF0, 0xB3, 0x08, 0x6B, 0x7E, 0x5C, 0x70,
-    0xB7, 0x13, 0x02, 0xD7, 0xDD, 0xAB, 0xE2, 0x8A, 0x4F, 0x9E, 0x50, 0x57, 0xCC, 0x93, 0x4D, 0x98,
-    0xCD, 0x18, 0x4E, 0x1D, 0x66, 0x5D, 0x9D, 0x8C, 0x98, 0x05, 0x88, 0x5B, 0x7E, 0x3B, 0x89, 0x98,
-    0x41, 0x02, 0x9B, 0xE4, 0x46, 0xC9, 0x91, 0x92, 0x2B, 0xDB, 0x00, 0x75, 0x43, 0x2E, 0x15, 0x1F,
-    0x38, 0xB9, 0x10, 0x1F, 0x08, 0x5B, 0x1F, 0xE0, 0x00, 0x13, 0xA6, 0x2A, 0xE3, 0x28, 0x66, 0x3E,
-    0xA6, 0x0A, 0xFA, 0xAF, 0x73, 0x94, 0x32, 0x93, 0x00, 0x99, 0xD1, 0x4B, 0x1A, 0x66, 0x9E, 0x26,
-    0x2C, 0x54, 0xB5, 0x57, 0x9C, 0xE0, 0x7C, 0xC6, 0xB4, 0xB6, 0xB7, 0xCD, 0x5B, 0x41, 0x68, 0x3C,
-    0xBA, 0xAC, 0xC7, 0x3B, 0x42, 0x4C, 0x65, 0x85, 0x49, 0x5A, 0xD8, 0xD2, 0x96, 0x71, 0x31, 0x88,
-    0x98, 0xED, 0xDE, 0x29, 0x92, 0xD1, 0x1F, 0xCC, 0x5B, 0xAB, 0x68, 0xEB, 0x32, 0x3A, 0xF9, 0x63,
-    0xB6, 0xFD, 0xAF, 0x84, 0x83, 0xCE, 0x64, 0xBF, 0x95, 0x76, 0x74, 0xF8, 0x5B, 0x33, 0x0B, 0x7A,
-    0x99, 0x3C, 0x47, 0xEA, 0x83, 0x8C, 0x86, 0x36, 0x7E, 0xB1, 0xA2, 0x89, 0x77, 0x79, 0x46, 0xDD,
-    0xC4, 0x35, 0xBB, 0x19, 0x1E, 0xEE, 0xB6, 0x72, 0x78, 0x89, 0xEA, 0x32, 0x52, 0x7B, 0xF3, 0x02,
-    0x24, 0xC4, 0x47, 0x1D, 0x98, 0xB4, 0x5D, 0xA4, 0xBC, 0x11, 0x61, 0x40, 0x80, 0xBF, 0x90, 0xB9,
-    0x2D, 0x7B, 0x19, 0x5D, 0xC7, 0xB6, 0x71, 0xFB, 0xF6, 0x4D, 0x70, 0xB5, 0xBE, 0x94, 0xF8, 0x4D,
-    0x6F, 0xB3, 0x04, 0xF0, 0x21, 0x37, 0x0B, 0xC5, 0x33, 0x38, 0xD9, 0x63, 0x57, 0x09, 0x4D, 0x7F,
-    0xF1, 0x7B, 0xBE, 0xDB, 0x48, 0x7A, 0xD6, 0x86, 0xD5, 0xFA, 0xCB, 0xDF, 0xDD, 0x7B, 0x28, 0x6E,
-    0xB6, 0xFF, 0x92, 0x49, 0x2A, 0x9B, 0xE1, 0xC8, 0xE5, 0x14, 0x3F, 0xEA, 0x40, 0x68, 0xFE, 0x7E,
-    0x58, 0x86, 0x99, 0x43, 0x37, 0xB4, 0xB9, 0x26, 0x47, 0x7E, 0x24, 0x77, 0x85, 0xF5, 0xC1, 0xD9,
-    0xB5, 0x70, 0x94, 0xD5, 0x3E, 0x42, 0x27, 0xBB, 0xAC, 0xEC, 0x36, 0xE7, 0xD9, 0xBE, 0x00, 0x7E,
-    0x62, 0x23, 0xAF, 0x95, 0xE7, 0x30, 0xEB, 0xCE, 0xEE, 0x96, 0xDF, 0xED, 0x16, 0x9D, 0x5F, 0xAF,
-    0x77, 0xBA, 0x88, 0x5F, 0xB4, 0x0B, 0xAB, 0xF6, 0x5D, 0xB6, 0xE3, 0x6D, 0x7A, 0x73, 0xD6, 0x7A,
-    0xE8, 0x4F, 0x30, 0xBE, 0xC0, 0x1E, 0x55, 0xC1, 0xAB, 0x8E, 0xC5, 0x52, 0xA3, 0xD2, 0x58, 0xD2,
-    0x7A, 0x0F, 0x12, 0x67, 0x02, 0x75, 0x81, 0x91, 0xC2, 0x32, 0x88, 0x52, 0x1B, 0x2D, 0x25, 0x12,
-    0x43, 0xDF, 0x87, 0xCF, 0xFC, 0x1C, 0x05, 0x89, 0x83, 0x21, 0xAD, 0x1A, 0x5C, 0x57, 0xA3, 0x0B,
-    0xBA, 0xB9, 0xFF, 0x24, 0x09, 0x99, 0xF8, 0xDD, 0x7C, 0xEC, 0x16, 0x7C, 0xF3, 0x3B, 0xF8, 0xBE,
-    0xE9, 0xAD, 0x30, 0xEC, 0x47, 0x71, 0x90, 0xF1, 0xF7, 0xBA, 0x79, 0x99, 0xFA, 0x5D, 0xE6, 0x3D,
-    0x2B, 0x9D, 0x7D, 0x04, 0x4F, 0x30, 0x0E, 0x30, 0xDA, 0x10, 0x16, 0xC7, 0xAD, 0x65, 0xC2, 0xFB,
-    0x18, 0xD0, 0x66, 0x3B, 0x89, 0xC0, 0xD6, 0x33, 0xCE, 0x7D, 0xA3, 0x52, 0x33, 0x0E, 0xCC, 0xC8,
-    0xE7, 0xF5, 0x42, 0x1A, 0x3F, 0xC2, 0x07, 0x99, 0xFF, 0xAC, 0x5C, 0x88, 0xEC, 0x12, 0x7C, 0x42,
-    0x0A, 0x94, 0x9A, 0xF0, 0xFE, 0xAB, 0x5C, 0xDC, 0x3C, 0xFD, 0xB4, 0x1C, 0xF6, 0x79, 0x60, 0x9D,
-    0xFE, 0xB3, 0x82, 0xFA, 0x25, 0x93, 0x86, 0xFA, 0x20, 0x5F, 0xBE, 0xFE, 0x2A, 0x78, 0xDD, 0xF9,
-    0x6B, 0x15, 0x63, 0xB3, 0x8F, 0x38, 0x8E, 0xD4, 0xAF, 0x23, 0xE6, 0x24, 0x85, 0x75, 0x0B, 0xA3,
-    0x2E, 0xFB, 0x7B, 0x50, 0x93, 0x34, 0x57, 0x78, 0x59, 0xE7, 0x5E, 0x39, 0xBC, 0x37, 0x89, 0x7F,
-    0x53, 0xAA, 0xC8, 0x04, 0x1F, 0x27, 0xDE, 0xA7, 0x91, 0xFB, 0x39, 0x7A, 0x97, 0x6D, 0xA2, 0x3B,
-    0x87, 0x4C, 0x7D, 0x9E, 0xFB, 0x1C, 0x6C, 0x64, 0xA4, 0xF7, 0x14, 0x5E, 0x90, 0xBC, 0xED, 0xE7,
-    0xE9, 0x83, 0xEA, 0xBF, 0xED, 0x7D, 0x3D, 0x90, 0xE5, 0xD6, 0x75, 0xE6, 0xC5, 0x03, 0xBB, 0x61,
-    0xF3, 0xED, 0x1A, 0x0C, 0x38, 0x92, 0xCD, 0xF1, 0x0A, 0x1B, 0x28, 0xB0, 0x68, 0x9B, 0x48, 0x36,
-    0x50, 0x40, 0x0E, 0x40, 0x29, 0x60, 0xB0, 0xC1, 0x4E, 0x30, 0x3D, 0xAC, 0x32, 0x83, 0x71, 0xC0,
-    0xAD, 0x92, 0xE5, 0xDA, 0xEA, 0x64, 0x83, 0x0D, 0x66, 0x06, 0x20, 0x19, 0x38, 0x50, 0xA0, 0xD9,
-    0x2A, 0xC9, 0xAE, 0xDA, 0x64, 0x19, 0x50, 0x2E, 0xB2, 0x19, 0x8C, 0x03, 0x07, 0xDE, 0xDA, 0x19,
-    0x02, 0xE2, 0x94, 0x4B, 0x01, 0x03, 0x82, 0xD2, 0xD2, 0x0C, 0x1C, 0x08, 0xB2, 0xD9, 0xF2, 0x2E,
-    0x19, 0x0C, 0x2C, 0x63, 0xAC, 0xD7, 0x33, 0x00, 0xEE, 0x9E, 0xF3, 0x9D, 0x73, 0x01, 0xBC, 0xD7,
-    0xDD, 0xF3, 0x43, 0x0E, 0xA9, 0x19, 0xDA, 0x4D, 0xCE, 0x3D, 0xA7, 0xFB, 0xE1, 0x01, 0x17, 0xF7,
-    0xE7, 0xFC, 0x9F, 0x73, 0x4D, 0xB6, 0x32, 0xF4, 0x13, 0x77, 0xDC, 0x06, 0x96, 0x5B, 0xCF, 0xE6,
-    0x0C, 0x92, 0x0A, 0x7F, 0x6A, 0xCC, 0xDA, 0x4F, 0x61, 0xE9, 0x27, 0xE7, 0xC6, 0x96, 0x01, 0xDA,
-    0x85, 0xAD, 0x4C, 0x5C, 0x7A, 0xD4, 0x86, 0xB3, 0x76, 0x89, 0x96, 0x6F, 0x76, 0xB8, 0xDD, 0xDF,
-    0x39, 0x4D, 0xAD, 0xB5, 0xED, 0xD8, 0xCA, 0x5F, 0x8E, 0xBB, 0xDE, 0xB5, 0x5E, 0xC3, 0xED, 0x02,
-    0xAD, 0xDF, 0xF0, 0x73, 0x83, 0xC6, 0xB7, 0x37, 0xF7, 0x2E, 0x37, 0xE8, 0x8F, 0xB6, 0x5B, 0x66,
-    0x0B, 0xBD, 0xE7, 0xFE, 0x27, 0x4D, 0xD2, 0x8C, 0x2D, 0xFE, 0x22, 0x9F, 0x3E, 0x5C, 0x6F, 0x94,
-    0x00, 0x18, 0x93, 0x6D, 0x42, 0x93, 0x74, 0xD4, 0x98, 0x8B, 0x0C, 0x63, 0x63, 0x2E, 0x30, 0x8C,
-    0x8C, 0x39, 0xAF, 0xF0, 0x77, 0x18, 0x3E, 0x8A, 0xB9, 0xEC, 0xE4, 0x5D, 0x0F, 0xC3, 0x5D, 0x7B,
-    0x89, 0x21, 0xDD, 0xAF, 0x53, 0xC8, 0x6B, 0x20, 0x19, 0x4C, 0x64, 0x4B, 0x5C, 0xE7, 0x8F, 0xB0,
-    0x06, 0x5C, 0x28, 0xF4, 0x36, 0xE0, 0x62, 0x84, 0xD5, 0xDA, 0xF7, 0x02, 0x5E, 0x4D, 0xD9, 0x60,
-    0x76, 0xE9, 0xBE, 0x11, 0xBF, 0xD2, 0x4A, 0x21, 0x16, 0xD9, 0xDE, 0xAB, 0xD4, 0xE0, 0x2B, 0xF4,
-    0x05, 0xFE, 0x43, 0x88, 0x9E, 0xC5, 0x35, 0xB7, 0x59, 0xCA, 0xED, 0xE3, 0xEB, 0x33, 0x65, 0xF0,
-    0xF2, 0xE9, 0x49, 0xFB, 0xD1, 0x9E, 0x4D, 0xF9, 0x9B, 0x09, 0xDA, 0x68, 0xD6, 0x86, 0x39, 0xB7,
-    0x8F, 0xA6, 0x72, 0xDF, 0xCF, 0xAE, 0x0D, 0x2C, 0x6F, 0x0E, 0xEA, 0x4D, 0xED, 0x5A, 0xF7, 0xB3,
-    0xCB, 0x6F, 0xC9, 0x8B, 0x29, 0x37, 0xF1, 0xF0, 0x3C, 0x7D, 0x42, 0xFF, 0x17, 0x34, 0xBF, 0x25,
-    0xAD, 0xC5, 0xC0, 0xA6, 0xD4, 0x86, 0xF4, 0xB6, 0x71, 0x19, 0x0D, 0xC6, 0x3C, 0x62, 0xE2, 0x1E,
-    0x73, 0xD1, 0x4F, 0x33, 0x23, 0x2D, 0xCD, 0xF3, 0x20, 0xB3, 0xCD, 0x23, 0xB8, 0xB7, 0xB7, 0xFE,
-    0xA9, 0x5C, 0x2F, 0xDF, 0xE5, 0xFB, 0xD0, 0xD8, 0x61, 0x04, 0x97, 0x3C, 0xB2, 0x7F, 0xE8, 0x63,
-    0x75, 0x19, 0xEA, 0xC7, 0xB2, 0xA1, 0x69, 0xFD, 0x88, 0x17, 0x30, 0x8F, 0x1B, 0x8F, 0x22, 0xEF,
-    0x78, 0x6F, 0xC7, 0xF5, 0xF5, 0x24, 0xFF, 0xCE, 0x5D, 0xF5, 0x87, 0x67, 0x6D, 0x1D, 0xAE, 0xA8,
-    0x73, 0x71, 0x63, 0xE2, 0x96, 0xF6, 0x4C, 0xC8, 0x1B, 0x27, 0xAC, 0x92, 0xD6, 0x3D, 0x2E, 0xE6,
-    0x7B, 0x47, 0xFC, 0x85, 0xD0, 0xD2, 0xC2, 0xF1, 0xAD, 0xED, 0x31, 0x2D, 0x39, 0xDF, 0xBC, 0x66,
-    0xB4, 0xE5, 0x0E, 0x70, 0xFF, 0x8A, 0x0E, 0xBD, 0x8B, 0x52, 0x13, 0xF6, 0x19, 0x7D, 0xDE, 0x17,
-    0xD4, 0x74, 0x45, 0x49, 0x33, 0x9C, 0x35, 0x26, 0x6A, 0xE8, 0x7E, 0x45, 0x15, 0x72, 0x97, 0x3C,
-    0xDE, 0x31, 0xC6, 0x3B, 0x83, 0x3B, 0xA5, 0xDC, 0x93, 0x93, 0xF4, 0x07, 0x5E, 0x4F, 0x3C, 0xCC,
-    0xF7, 0xF3, 0x1F, 0x4F, 0x98, 0x6E, 0xF6, 0x7C, 0x8B, 0x16, 0x56, 0x56, 0x5A, 0x53, 0xFC, 0xD0,
-    0xA6, 0xFC, 0x8F, 0xF1, 0xAD, 0xF5, 0xC5, 0xF6, 0xB9, 0xF5, 0x85, 0x06, 0x6F, 0x15, 0xF2, 0x0E,
-    0xCC, 0x68, 0x82, 0x62, 0x9A, 0xCB, 0xA8, 0xFF, 0x6C, 0xFF, 0xF1, 0xAA, 0x61, 0x92, 0xCF, 0x2B,
-    0x89, 0x18, 0x80, 0x47, 0x7D, 0xD9, 0xA5, 0xC5, 0x59, 0xD0, 0xA3, 0x8B, 0x4B, 0x6E, 0xA7, 0xB5,
-    0xB2, 0xB8, 0x2D, 0xD6, 0x0B, 0x2F, 0xE6, 0x81, 0xF7, 0xE3, 0x62, 0xA5, 0xEB, 0xCF, 0x6B, 0x8F,
-    0x45, 0x16, 0x87, 0x91, 0x66, 0x86, 0x0C, 0x7B, 0x74, 0x23, 0x9F, 0x97, 0x25, 0x2F, 0x1F, 0x41,
-    0x68, 0x09, 0x31, 0xD2, 0xF1, 0x50, 0x03, 0x31, 0xF4, 0x7C, 0x41, 0x32, 0x22, 0x22, 0x35, 0x23,
-    0xF4, 0xFF, 0x52, 0x90, 0x9E, 0x56, 0xE5, 0x26, 0x12, 0x97, 0x7A, 0x4D, 0xA6, 0xC8, 0x9B, 0x74,
-    0x4F, 0x42, 0x8A, 0x96, 0xF7, 0x4F, 0xD2, 0xD1, 0x4B, 0x62, 0x3B, 0x0D, 0x97, 0x6D, 0x49, 0x43,
-    0x1D, 0xF1, 0x0B, 0xD1, 0x5A, 0x07, 0x72, 0x69, 0xE2, 0x0A, 0xF4, 0xEA, 0xAF, 0x60, 0xDF, 0xF1,
-    0xBB, 0x5F, 0x13, 0x72, 0x18, 0x50, 0x5F, 0x22, 0xDD, 0xF8, 0x35, 0x2D, 0xFD, 0x54, 0xC9, 0xF7,
-    0xF2, 0x3E, 0x60, 0xF8, 0xF9, 0x70, 0xC4, 0xA8, 0xCF, 0x1E, 0x33, 0x00, 0xFB, 0x26, 0xD8, 0x08,
-    0xAE, 0xCB, 0x7A, 0x87, 0x45, 0xD6, 0x61, 0xE1, 0x88, 0x2D, 0x79, 0x07, 0x29, 0x96, 0x1F, 0x81,
-    0xA5, 0x87, 0xBE, 0x41, 0x77, 0xE1, 0xF7, 0x20, 0x0C, 0x74, 0x9A, 0xB6, 0x38, 0x9E, 0xA6, 0xEF,
-    0x4B, 0x3D, 0x50, 0xEC, 0xFF, 0x2A, 0x43, 0xB0, 0x66, 0xE2, 0x39, 0x33, 0x44, 0xB9, 0xCF, 0xC8,
-    0x7E, 0x46, 0xFE, 0x33, 0x32, 0xA0, 0x19, 0x07, 0x1A, 0x59, 0xCE, 0x91, 0x88, 0x70, 0x21, 0x3C,
-    0x6D, 0xE5, 0x10, 0x90, 0x34, 0x30, 0xA2, 0x54, 0x2E, 0x06, 0x61, 0x1B, 0x59, 0xCB, 0xA7, 0x45,
-    0x88, 0x25, 0x81, 0xA5, 0xD1, 0xF4, 0xB7, 0x3E, 0xBF, 0xF4, 0x88, 0x18, 0xB3, 0xBD, 0x97, 0x4E,
-    0xF4, 0x54, 0x65, 0x23, 0x93, 0x08, 0x7D, 0x47, 0x6F, 0xCC, 0x42, 0xFE, 0xE6, 0xA5, 0x6B, 0x72,
-    0xC4, 0xCB, 0xD6, 0x56, 0xD4, 0xF3, 0xB7, 0x09, 0xF0, 0x92, 0xC9, 0x86, 0x94, 0xC7, 0x99, 0xA8,
-    0x29, 0x0F, 0x7C, 0x52, 0x02, 0x64, 0x98, 0x7E, 0xAF, 0x03, 0xA0, 0x05, 0xCE, 0x80, 0xD6, 0x30,
-    0x83, 0x24, 0x05, 0x78, 0x0B, 0xEB, 0xE2, 0xE7, 0x56, 0x97, 0x47, 0x2E, 0xA0, 0x92, 0x3F, 0xCA,
-    0x17, 0x40, 0x30, 0x6D, 0x55, 0xC8, 0x5D, 0x68, 0x90, 0x18, 0xD0, 0xB4, 0xE2, 0x66, 0x16, 0x0F,
-    0x02, 0x03, 0xB0, 0xD5, 0xC2, 0xCA, 0xD3, 0x69, 0x5C, 0xB9, 0x2F, 0x45, 0x8F, 0x09, 0x4F, 0x40,
-    0xDB, 0xCA, 0xD0, 0xB6, 0x0C, 0xBC, 0xA2, 0x55, 0x99, 0x84, 0x5F, 0x43, 0x05, 0xBE, 0x78, 0x25,
-    0x30, 0xE8, 0xF5, 0xFD, 0xAC, 0xC2, 0xB8, 0x34, 0x87, 0x7F, 0xE8, 0xE5, 0x79, 0x65, 0x30, 0x35,
-    0x4B, 0x33, 0xA5, 0x9A, 0x81, 0x3D, 0x50, 0x6A, 0x27, 0xD4, 0xD3, 0x53, 0xCA, 0xE7, 0xA0, 0xAF,
-    0x70, 0xA9, 0x30, 0x56, 0x98, 0x09, 0xF4, 0x0E, 0x04, 0x06, 0xFF, 0x28, 0x30, 0xFC, 0xA1, 0xC0,
-    0x44, 0xBF, 0xDF, 0x09, 0xFC, 0x89, 0x88, 0x50, 0xF6, 0x6F, 0x2B, 0x81, 0xB2, 0xDE, 0x17, 0xB4,
-    0x7C, 0x04, 0xAE, 0x14, 0xD6, 0x87, 0x9E, 0xEF, 0x8D, 0xD4, 0xB8, 0x06, 0x35, 0xF6, 0x65, 0x0F,
-    0xA4, 0xF3, 0xF7, 0x30, 0xE6, 0x8A, 0x79, 0x8A, 0x85, 0x93, 0x8E, 0xE7, 0xCF, 0xF8, 0x3D, 0xC4,
-    0x62, 0xDF, 0x3E, 0x8B, 0x35, 0x24, 0x0C, 0x95, 0x38, 0xE8, 0x87, 0x9B, 0xE3, 0x21, 0xDF, 0x67,
-    0xF9, 0x2D, 0x27, 0x9E, 0x18, 0xD1, 0x48, 0x10, 0xDB, 0xE7, 0x87, 0x78, 0x83, 0xC1, 0x94, 0xD0,
-    0xCC, 0x31, 0x63, 0x69, 0xC1, 0x28, 0x79, 0x19, 0x10, 0x05, 0x23, 0x2A, 0x47, 0x83, 0x40, 0xE2,
-    0x26, 0x2F, 0xBD, 0x34, 0xCA, 0x99, 0x95, 0x96, 0x31, 0x44, 0xA3, 0x2A, 0x01, 0xF1, 0x69, 0xAE,
-    0xE2, 0xE6, 0xAD, 0x88, 0x07, 0x7D, 0x2B, 0x7B, 0x05, 0x33, 0x16, 0x89, 0xFC, 0x11, 0xA2, 0x63,
-    0x22, 0x75, 0x39, 0x99, 0x8A, 0x1F, 0x8A, 0x1F, 0x4C, 0xE5, 0x23, 0x41, 0x27, 0xD7, 0x1F, 0xF5,
-    0x35, 0xBD, 0xF0, 0xB4, 0x9B, 0x53, 0xA1, 0x49, 0xBC, 0x58, 0x4E, 0x82, 0x06, 0x7E, 0x28, 0xAC,
-    0xAB, 0x94, 0xF9, 0xCB, 0x1F, 0x04, 0x40, 0x42, 0xFB, 0xFE, 0xCE, 0xF3, 0xD8, 0x78, 0xB3, 0x1F,
-    0x1E, 0x82, 0x7A, 0xA6, 0xCD, 0xB8, 0xE5, 0xFB, 0x96, 0x80, 0x8B, 0x02, 0x9E, 0x11, 0xF0, 0x34,
-    0xDA, 0x85, 0x5E, 0x29, 0xF4, 0x81, 0x6F, 0x20, 0x5B, 0x22, 0x94, 0x91, 0x1A, 0x61, 0x24, 0x2A,
-    0x93, 0x49, 0x94, 0x80, 0x9D, 0x12, 0x19, 0xCC, 0x5C, 0x11, 0x29, 0xCC, 0x74, 0x42, 0x37, 0xBC,
-    0x95, 0x90, 0xF8, 0x05, 0x49, 0x7C, 0x7C, 0x43, 0xBF, 0x91, 0x1B, 0x07, 0x35, 0x44, 0x65, 0x9E,
-    0x66, 0xDC, 0xD0, 0xC1, 0x48, 0x89, 0xDF, 0x28, 0x8B, 0xEF, 0xEC, 0x64, 0x7C, 0x63, 0x9A, 0x72,
-    0x16, 0x09, 0x4C, 0x27, 0x04, 0xC9, 0x03, 0x4C, 0x99, 0x0F, 0xF3, 0xF2, 0x30, 0x7E, 0xCB, 0x3D,
-    0x25, 0xB1, 0x0A, 0xBF, 0xB3, 0x4C, 0x51, 0x1B, 0x11, 0x93, 0x05, 0x16, 0x20, 0xA5, 0x32, 0x26,
-    0x50, 0x6F, 0x64, 0x8F, 0x09, 0x49, 0x42, 0x1B, 0xCF, 0xDA, 0x47, 0x8F, 0x54, 0x54, 0x68, 0xF9,
-    0x8E, 0x8A, 0xCD, 0x4D, 0xD9, 0x59, 0x21, 0xF6, 0x19, 0xBD, 0x11, 0x68, 0x0C, 0xEF, 0x3D, 0x52,
-    0x04, 0xD0, 0x36, 0xB3, 0xB6, 0x1E, 0x3F, 0xF5, 0xB1, 0x66, 0xE8, 0x5B, 0xA4, 0xDE, 0x10, 0xD7,
-    0x17, 0xF9, 0x42, 0x64, 0x0A, 0xEA, 0xE1, 0xFF, 0x4B, 0x8D, 0x08, 0x1A, 0x24, 0xD6, 0x17, 0x10,
-    0xEB, 0x65, 0x8D, 0xD1, 0x48, 0xE1, 0xEB, 0x50, 0x8D, 0x66, 0xAD, 0xFC, 0x45, 0xFE, 0x97, 0x85,
-    0xB0, 0xDB, 0xF3, 0xDE, 0x17, 0x0A, 0x60, 0x19, 0xAF, 0x4E, 0xCA, 0x2A, 0x95, 0x6F, 0x15, 0x2D,
-    0x54, 0x85, 0xEE, 0xE8, 0x36, 0x43, 0x5B, 0xAC, 0xE4, 0xCE, 0xB4, 0x9E, 0x76, 0x65, 0x39, 0xC9,
-    0xB8, 0x5D, 0x7A, 0x18, 0x14, 0x8F, 0x4C, 0xC6, 0x0F, 0x3D, 0x25, 0x79, 0x69, 0x20, 0x09, 0xE2,
-    0x12, 0x2D, 0x41, 0xE1, 0x61, 0x04, 0x78, 0x05, 0xB5, 0x73, 0xE0, 0xAD, 0x83, 0x06, 0x60, 0xB1,
-    0x06, 0x7C, 0x05, 0xB5, 0x80, 0x0A, 0x20, 0x10, 0xB0, 0x2C, 0x01, 0x42, 0x05, 0x39, 0x00, 0x0B,
-    0xFB, 0x04, 0x88, 0x56, 0x31, 0x38, 0x25, 0xE0, 0x2A, 0x00, 0x96, 0xED, 0x60, 0xBE, 0x7C, 0xB0,
-    0xB3, 0xB3, 0x6B, 0xCF, 0xA0, 0x9B, 0xB6, 0x73, 0x80, 0xDF, 0x89, 0x74, 0x03, 0x61, 0xAC, 0xB2,
-    0x43, 0xBB, 0x2B, 0xB2, 0xA7, 0x04, 0x9C, 0x17, 0xF0, 0xF4, 0x5F, 0x09, 0x78, 0x18, 0x54, 0xF6,
-    0x15, 0xED, 0xE3, 0x9A, 0xFE, 0x4F, 0x6C, 0xA7, 0xD8, 0x49, 0x5E, 0x5D, 0xBD, 0xD9, 0xE5, 0x25,
-    0x4F, 0xB2, 0x36, 0x0D, 0x7C, 0x0B, 0x6E, 0x4A, 0x58, 0x44, 0x84, 0x81, 0xF4, 0x34, 0xC2, 0x58,
-    0x06, 0xF0, 0x57, 0x8C, 0xF5, 0x42, 0xB1, 0x69, 0xE5, 0x82, 0xDC, 0x64, 0x84, 0x89, 0x31, 0x26,
-    0x2A, 0x8B, 0x36, 0x04, 0x89, 0x0A, 0xEB, 0xA2, 0x4D, 0x40, 0xB4, 0xA2, 0x1B, 0xC5, 0x8D, 0xA2,
-    0x74, 0xA2, 0x93, 0x10, 0xAA, 0xCC, 0x09, 0xF1, 0xC6, 0xDE, 0x28, 0x0E, 0xA0, 0x8F, 0xD1, 0xEA,
-    0xA6, 0x6F, 0xF4, 0xC2, 0x52, 0x8A, 0x36, 0xB6, 0xD0, 0x17, 0xF9, 0x7E, 0x4C, 0xAA, 0xA8, 0x29,
-    0x5A, 0xA6, 0x29, 0xCC, 0x85, 0x8A, 0xD6, 0x87, 0x26, 0x8F, 0x1E, 0xF0, 0x0D, 0x0B, 0x16, 0xA5,
-    0x0D, 0x94, 0xC5, 0x96, 0xB1, 0x42, 0x6C, 0x02, 0xDC, 0xE7, 0x01, 0xFC, 0x03, 0x42, 0x35, 0xCD,
-    0x4A, 0xCA, 0xEF, 0x4B, 0x4A, 0x20, 0x5D, 0xCA, 0x98, 0x57, 0x74, 0xA3, 0x56, 0x7C, 0x60, 0xA0,
-    0x85, 0x32, 0xAF, 0x3F, 0x4B, 0x1F, 0x67, 0x24, 0x23, 0xF5, 0x26, 0xAB, 0x99, 0xC0, 0x65, 0xB4,
-    0x89, 0x2C, 0x33, 0x59, 0x6A, 0xB7, 0x59, 0x1A, 0xC3, 0x6B, 0xF5, 0x93, 0x00, 0x96, 0x35, 0x8E,
-    0x46, 0x07, 0x4E, 0x23, 0x61, 0xD1, 0xE8, 0xAC, 0xBC, 0xA2, 0xD0, 0xE0, 0x99, 0x06, 0xCC, 0x2C,
-    0x70, 0x1B, 0xA4, 0x31, 0x01, 0x5E, 0xA4, 0xFC, 0x77, 0xFA, 0x84, 0xAE, 0xA1, 0x05, 0x47, 0x4F,
-    0x4C, 0x0E, 0xB8, 0x6B, 0x11, 0x36, 0x90, 0x27, 0xF2, 0x26, 0xB4, 0xE2, 0x2F, 0xAE, 0x2C, 0x73,
-    0xC1, 0x7C, 0x05, 0x1C, 0xA9, 0x17, 0x03, 0x0B, 0x49, 0x07, 0x10, 0x6A, 0x17, 0xF6, 0xBF, 0x17,
-    0xB5, 0x72, 0xFC, 0x5C, 0x06, 0x70, 0xF5, 0x2F, 0x48, 0xC6, 0x7B, 0xB8, 0x05, 0x77, 0xA5, 0xF8,
-    0x56, 0x09, 0x3F, 0x78, 0x14, 0x0B, 0x07, 0x91, 0x10, 0xF7, 0xC3, 0x60, 0xB1, 0x0E, 0x9A, 0x39,
-    0xF0, 0xEF, 0x0C, 0x48, 0x48, 0x65, 0xB0, 0x14, 0x40, 0x03, 0x30, 0x03, 0x44, 0xCC, 0x18, 0x64,
-    0x00, 0xAC, 0x7E, 0x47, 0xCC, 0x41, 0x61, 0x9E, 0xE2, 0xED, 0x95, 0x58, 0xA6, 0x11, 0x44, 0x00,
-    0x3A, 0x36, 0x2B, 0x11, 0xD8, 0x72, 0x0B, 0xAB, 0xC7, 0x50, 0x35, 0x90, 0xDB, 0x48, 0x07, 0x6B,
-    0x03, 0x11, 0xE0, 0x58, 0x56, 0x86, 0x6D, 0x89, 0xCD, 0x8C, 0x2C, 0xE3, 0x30, 0x72, 0x8B, 0x90,
-    0x28, 0x23, 0xE4, 0x9F, 0x79, 0x8A, 0xD8, 0x02, 0x79, 0x83, 0x06, 0xE6, 0x14, 0x23, 0x2D, 0x21,
-    0x17, 0x80, 0x14, 0x2B, 0x73, 0x05, 0x08, 0x5D, 0xB8, 0x02, 0x92, 0x74, 0xFC, 0x8F, 0x90, 0x78,
-    0x58, 0x34, 0x40, 0x22, 0xEB, 0xD7, 0x40, 0x42, 0xFB, 0x5C, 0x05, 0x64, 0x69, 0xBF, 0x53, 0x02,
-    0xF1, 0xED, 0xBB, 0xB9, 0x22, 0xD7, 0x61, 0xE4, 0x24, 0x12, 0x68, 0x05, 0xE1, 0x37, 0x51, 0xA4,
-    0x53, 0xA4, 0x70, 0x48, 0x02, 0xDB, 0x08, 0x5B, 0x48, 0x60, 0xB8, 0x20, 0xA5, 0x21, 0x6A, 0x78,
-    0xE6, 0x2C, 0xAF, 0x14, 0x7A, 0x61, 0x9A, 0xB4, 0x3A, 0x2C, 0x19, 0x29, 0x44, 0x32, 0x33, 0x2A,
-    0x5C, 0xA7, 0xBC, 0x97, 0xC4, 0xD2, 0x04, 0x91, 0xF6, 0x3E, 0x40, 0xB0, 0xC5, 0x19, 0xBC, 0x5F,
-    0xF7, 0x15, 0xC8, 0x7B, 0x69, 0x29, 0x12, 0x66, 0x3A, 0xFF, 0x37, 0xB3, 0x80, 0x7E, 0x68, 0x84,
-    0xD8, 0xE7, 0xCC, 0x44, 0xD8, 0xC2, 0xC4, 0x46, 0xD0, 0x58, 0xD4, 0xEF, 0x90, 0x65, 0xD1, 0x94,
-    0xFF, 0x85, 0x98, 0x71, 0x18, 0x42, 0xE9, 0xDE, 0x31, 0x16, 0x42, 0x9D, 0x00, 0x34, 0x90, 0xAF,
-    0x47, 0x90, 0x1D, 0x05, 0xD6, 0x2F, 0xD1, 0xEF, 0xE9, 0x5D, 0xF4, 0x9E, 0xFA, 0x84, 0xA5, 0x3C,
-    0x4F, 0x9F, 0xEE, 0x49, 0x5F, 0xD8, 0xF8, 0xC5, 0x0A, 0x6F, 0xA8, 0xDB, 0x55, 0x6C, 0xA3, 0x23,
-    0x1B, 0x98, 0xFD, 0xB0, 0xD8, 0xF7, 0xA6, 0xA8, 0x3F, 0xFE, 0x03, 0xA4, 0xFE, 0x04, 0x2C, 0x00,
-    0xF1, 0x66, 0xAA, 0x74, 0x06, 0x14, 0xB0, 0x4C, 0x2D, 0xD6, 0xBB, 0x1A, 0x34, 0x01, 0x12, 0x71,
-    0x04, 0xBA, 0x19, 0x40, 0x66, 0xF7, 0x21, 0x95, 0x2F, 0x54, 0x66, 0xAF, 0x0F, 0xC9, 0xEC, 0xF5,
-    0x78, 0x8D, 0xC8, 0xF8, 0xB0, 0x3C, 0xB1, 0xE4, 0xEE, 0x39, 0x7E, 0x79, 0x60, 0xEE, 0x42, 0x5A,
-    0x12, 0x8B, 0x99, 0x01, 0xED, 0x42, 0x7F, 0x1A, 0xD7, 0x7E, 0x2A, 0x53, 0x79, 0x77, 0xC8, 0x54,
-    0x7E, 0xA8, 0xBD, 0xBF, 0xA6, 0x72, 0xB5, 0x83, 0x39, 0x70, 0xF3, 0xB2, 0xDD, 0x23, 0x90, 0xD2,
-    0xCD, 0x92, 0x34, 0xE1, 0x7B, 0xC6, 0xE9, 0x29, 0x06, 0x91, 0x03, 0x5F, 0x63, 0xF0, 0xE8, 0xF8,
-    0xBC, 0xCF, 0x0F, 0x64, 0xD8, 0x84, 0xA1, 0xE8, 0x90, 0x02, 0xBE, 0x08, 0xC6, 0x08, 0x9E, 0x86,
-    0x9D, 0x33, 0xAA, 0x97, 0x5B, 0x91, 0x28, 0xB7, 0x0B, 0x36, 0x51, 0xCA, 0x17, 0x05, 0x6E, 0xED,
-    0xDA, 0x1D, 0xBD, 0x04, 0x0B, 0x54, 0x37, 0x71, 0xC9, 0x7C, 0x3F, 0x1C, 0xB6, 0xE9, 0x25, 0x69,
-    0xCA, 0x49, 0x0D, 0xC9, 0x58, 0xEE, 0x63, 0x7D, 0x84, 0xDE, 0x90, 0x6D, 0xC8, 0x2C, 0xC0, 0xF2,
-    0x5A, 0x21, 0x84, 0x2E, 0xC8, 0x14, 0x29, 0x05, 0x09, 0x8E, 0x47, 0xE8, 0xE2, 0xF1, 0x5B, 0xE3,
-    0x7D, 0xC6, 0x3B, 0x8F, 0xCF, 0x1A, 0x9F, 0x3E, 0xF6, 0x07, 0x2B, 0x0C, 0x3D, 0x1C, 0xFB, 0x3C,
-    0xCE, 0xA0, 0xF1, 0x32, 0xFB, 0xBD, 0x8D, 0x37, 0xDD, 0xDB, 0x7B, 0x0D, 0xEE, 0x17, 0xDE, 0x88,
-    0xEC, 0x0F, 0xAC, 0x63, 0xDB, 0x6C, 0x5B, 0x9E, 0xC5, 0x4B, 0xCC, 0x60, 0xBC, 0x1E, 0xA6, 0x52,
-    0x9E, 0x41, 0x7A, 0x3A, 0x4F, 0x1D, 0xF5, 0x9E, 0xA7, 0x8E, 0x26, 0x2B, 0x16, 0xB9, 0x1F, 0x16,
-    0x8F, 0x62, 0xD5, 0xAD, 0xCD, 0x52, 0x35, 0x1B, 0x6E, 0x5F, 0x7E, 0x13, 0xDD, 0x12, 0xAC, 0x96,
-    0xAF, 0x84, 0x09, 0xC2, 0x5C, 0xC5, 0x00, 0x2F, 0x56, 0x21, 0xC4, 0xEF, 0x06, 0x97, 0x86, 0x25,
-    0xD4, 0x02, 0x92, 0x7D, 0x78, 0x97, 0x14, 0xBC, 0x04, 0xA4, 0x1F, 0xFC, 0xE2, 0xBC, 0x0E, 0xAB,
-    0x82, 0x75, 0x69, 0xD6, 0xF2, 0x14, 0x58, 0x35, 0x4C, 0x80, 0x42, 0x19, 0x35, 0x28, 0xA9, 0x33,
-    0xC4, 0xB1, 0x96, 0xFC, 0x81, 0x85, 0x62, 0x66, 0x7A, 0x5F, 0x4D, 0x62, 0x8E, 0xD8, 0x2A, 0xCB,
-    0x5B, 0x38, 0xD6, 0x57, 0x28, 0x4C, 0x14, 0xC6, 0x0A, 0x23, 0x85, 0xA1, 0x83, 0xBC, 0x14, 0x7E,
-    0xC8, 0xDF, 0x77, 0x30, 0x80, 0xF9, 0xE3, 0x43, 0x38, 0x63, 0x60, 0x29, 0x62, 0x4F, 0xC8, 0x3D,
-    0xC1, 0x66, 0x03, 0xB6, 0x02, 0x8B, 0x0E, 0xE3, 0x4B, 0x13, 0xF3, 0xE7, 0x05, 0xC3, 0x48, 0x97,
-    0x20, 0xC9, 0x06, 0xFF, 0x80, 0xA9, 0xDF, 0x3A, 0xE3, 0x4C, 0x5E, 0xF7, 0x0A, 0x97, 0xB2, 0x66,
-    0x3C, 0x1D, 0x07, 0x4F, 0xDF, 0xE7, 0xBB, 0xD6, 0xAE, 0x54, 0x43, 0x7F, 0x97, 0x66, 0x9E, 0x51,
-    0x88, 0xD5, 0xEC, 0x8E, 0x10, 0x6F, 0x5A, 0xDC, 0x1B, 0x95, 0x73, 0x19, 0x5D, 0x88, 0xE4, 0xFB,
-    0x05, 0x40, 0x17, 0x0E, 0xE5, 0x35, 0x73, 0x73, 0xAF, 0x18, 0x48, 0x68, 0xA8, 0xCD, 0x24, 0x46,
-    0xE4, 0x33, 0xF4, 0x5F, 0x07, 0x4A, 0xD0, 0x71, 0xA0, 0x3E, 0x4A, 0xA7, 0xD1, 0x29, 0x67, 0xA8,
-    0x13, 0x15, 0xBC, 0x09, 0x85, 0x35, 0x5E, 0x7F, 0xA2, 0x09, 0x0D, 0x8F, 0x44, 0x97, 0x13, 0x1A,
-    0xCC, 0x9D, 0x17, 0x89, 0xD8, 0xCE, 0x32, 0x11, 0x48, 0x32, 0x78, 0x23, 0x61, 0x67, 0x81, 0x81,
-    0x18, 0xE0, 0x82, 0x80, 0xF3, 0x02, 0x7E, 0x47, 0x80, 0xD9, 0x04, 0x37, 0xDF, 0x50, 0xFD, 0xB8,
-    0x55, 0x96, 0x83, 0xCF, 0x60, 0x49, 0x61, 0xE3, 0x49, 0x8D, 0x2B, 0x61, 0x43, 0x69, 0x0D, 0xB8,
-    0x00, 0xE9, 0x0C, 0xAB, 0xA3, 0x40, 0x3B, 0xBB, 0xD2, 0x93, 0xEF, 0x05, 0x18, 0xB7, 0x9B, 0x85,
-    0x1D, 0xDD, 0x63, 0x89, 0xB3, 0x9A, 0x96, 0xCC, 0x45, 0x56, 0xD6, 0x21, 0x01, 0x1E, 0x9F, 0xD9,
-    0x4B, 0x22, 0x72, 0xC5, 0x83, 0x4A, 0x60, 0xD1, 0x3D, 0x23, 0x37, 0x5F, 0x53, 0x84, 0xC7, 0x47,
-    0x91, 0x4E, 0xAF, 0x21, 0x4E, 0x20, 0x48, 0x00, 0xA9, 0x5D, 0xC4, 0x44, 0x41, 0x16, 0x90, 0xB9,
-    0x45, 0x88, 0x74, 0x48, 0xB3, 0xF1, 0x97, 0xC5, 0x84, 0x54, 0xEE, 0xEB, 0x7C, 0x1F, 0x31, 0x0E,
-    0xC7, 0xEC, 0x94, 0x63, 0x29, 0x33, 0x13, 0xFA, 0xDA, 0xE8, 0x0B, 0x0E, 0x78, 0x41, 0xBC, 0xB2,
-    0x91, 0x15, 0x21, 0x2F, 0x2B, 0x6F, 0x7A, 0x37, 0x62, 0xA8, 0xBC, 0xD4, 0x28, 0xBC, 0x42, 0xA3,
-    0x14, 0xA1, 0xF6, 0x1E, 0x04, 0xE2, 0x63, 0x4D, 0xD9, 0x70, 0xE5, 0x0F, 0x33, 0x99, 0xB6, 0x9D,
-    0x64, 0xDA, 0x67, 0x59, 0x6D, 0x87, 0x1F, 0x3C, 0x83, 0x3D, 0x35, 0x81, 0xE7, 0x35, 0x02, 0x53,
-    0xF1, 0x72, 0x25, 0xA5, 0x8B, 0x99, 0xAC, 0xEC, 0x5A, 0x26, 0xE3, 0x76, 0x6C, 0xBD, 0x9D, 0xB3,
-    0xE0, 0xCC, 0xD0, 0xA4, 0xD6, 0xAE, 0xE4, 0x9E, 0x83, 0x24, 0xC7, 0xCC, 0xA4, 0xF2, 0x8C, 0x57,
-    0x03, 0x5B, 0x18, 0xE9, 0x59, 0x45, 0x23, 0xCE, 0x71, 0x0F, 0x3A, 0x82, 0x38, 0x97, 0x37, 0xC2,
-    0x3F, 0xCC, 0x68, 0xF8, 0x81, 0xCA, 0xE6, 0x4C, 0xAA, 0x29, 0x46, 0x38, 0x1E, 0xCE, 0xAA, 0xF1,
-    0x84, 0xEF, 0xB4, 0x92, 0x99, 0xAC, 0xD8, 0x2C, 0x87, 0x71, 0xC8, 0x45, 0x95, 0xAA, 0x54, 0xB7,
-    0xF2, 0x46, 0x65, 0x6B, 0x0D, 0x83, 0xF1, 0x00, 0x5F, 0x8C, 0xA1, 0x91, 0xD1, 0x48, 0xEE, 0xB3,
-    0x58, 0x01, 0x0C, 0x9B, 0x6E, 0xC1, 0x23, 0x3D, 0x61, 0xFA, 0x29, 0x8F, 0x7E, 0xE2, 0xAE, 0x9B,
-    0xBE, 0x3B, 0xBB, 0x5F, 0x74, 0xC4, 0xD3, 0xA6, 0xBE, 0xF8, 0x30, 0x1D, 0xC8, 0x5A, 0xA3, 0xD1,
-    0xE8, 0xF1, 0x1E, 0x16, 0xEF, 0x01, 0x53, 0x4A, 0xEF, 0x09, 0x69, 0x2E, 0x45, 0xDA, 0xC7, 0xBA,
-    0x2A, 0xC4, 0x9A, 0x68, 0x24, 0x1E, 0x45, 0x64, 0x4C, 0x18, 0x62, 0x30, 0x07, 0x4B, 0xDA, 0x87,
-    0x03, 0x22, 0x34, 0x10, 0x38, 0x01, 0xB5, 0x1F, 0x06, 0xD0, 0x0E, 0x5C, 0xF7, 0x58, 0xA0, 0x97,
-    0xE8, 0x17, 0x62, 0x88, 0x9A, 0xB8, 0x59, 0x27, 0x63, 0x3F, 0x01, 0xD5, 0x7A, 0x59, 0xC6, 0xEE,
-    0xC4, 0x78, 0x29, 0xEE, 0x1E, 0x06, 0x91, 0x7C, 0x8F, 0x86, 0x04, 0xF7, 0x14, 0xA3, 0x83, 0x6D,
-    0x25, 0xC8, 0xAA, 0xE6, 0xE0, 0x8D, 0xC4, 0xE6, 0x1C, 0x5A, 0x95, 0x1C, 0x20, 0xC2, 0x0A, 0x93,
-    0x0C, 0x95, 0x36, 0xB0, 0xD7, 0x49, 0x26, 0xED, 0x69, 0x80, 0x42, 0xB6, 0xA8, 0x85, 0x2B, 0x43,
-    0xC3, 0xF7, 0x57, 0x06, 0xAB, 0xC7, 0x35, 0x4F, 0x58, 0xF6, 0xB5, 0x50, 0x13, 0xD9, 0xEF, 0x5B,
-    0xB6, 0x8B, 0xD8, 0x9A, 0x94, 0x63, 0x5B, 0x33, 0x3D, 0xAA, 0x41, 0x8D, 0x40, 0xCA, 0xB2, 0x2E,
-    0x60, 0x9B, 0xF6, 0xE5, 0x82, 0xF4, 0x88, 0x2E, 0xB3, 0x3E, 0xFF, 0x62, 0x4E, 0xE8, 0x98, 0x7D,
-    0x85, 0x9B, 0x2F, 0xF5, 0x78, 0x6A, 0x0F, 0x41, 0xA3, 0xC3, 0x8B, 0xAD, 0xD4, 0x37, 0x43, 0x0B,
-    0xEB, 0x35, 0x76, 0x03, 0xB0, 0xAC, 0x10, 0x41, 0xD4, 0x8F, 0x25, 0xD4, 0x70, 0xC1, 0xA2, 0xF0,
-    0xA9, 0x88, 0xAF, 0x79, 0xA6, 0x78, 0x89, 0x1E, 0x79, 0x71, 0x60, 0xF5, 0x5C, 0x84, 0xEC, 0x0C,
-    0x5E, 0x0C, 0x6A, 0x69, 0x32, 0xB3, 0x16, 0x01, 0x11, 0x6C, 0x78, 0x5C, 0x6B, 0x13, 0xFC, 0x3D,
-    0xC1, 0x35, 0x31, 0xAE, 0x0F, 0x3B, 0x9E, 0xF2, 0x65, 0x2F, 0x26, 0x07, 0xBE, 0xCC, 0x88, 0x31,
-    0x2E, 0x02, 0x99, 0x37, 0x27, 0x46, 0x5B, 0x45, 0x06, 0x1F, 0x4F, 0xA6, 0x5A, 0xF2, 0xFE, 0xAE,
-    0x12, 0x85, 0xDC, 0x60, 0xAB, 0xCF, 0x5A, 0xFE, 0x0B, 0x8B, 0xB6, 0x76, 0xBF, 0xD0, 0x90, 0x29,
-    0xB4, 0x74, 0x3B, 0x77, 0xBD, 0x87, 0x2B, 0xDD, 0xFF, 0xB5, 0x51, 0xC7, 0x18, 0x2F, 0x40, 0xBA,
-    0xF3, 0x39, 0xDA, 0x9C, 0xB8, 0x5E, 0x9E, 0x38, 0x3E, 0xBC, 0x45, 0x43, 0x17, 0xBC, 0xD0, 0xF2,
-    0xE5, 0x2D, 0x7F, 0x79, 0xA3, 0x31, 0x77, 0xDB, 0x80, 0xDA, 0x2D, 0x94, 0x9F, 0x55, 0xD2, 0x18,
-    0x95, 0xD9, 0x98, 0x7D, 0x48, 0x6B, 0xE2, 0xF7, 0xCF, 0x59, 0x76, 0xDB, 0x88, 0xF3, 0x86, 0x06,
-    0xCA, 0xB5, 0x29, 0xB7, 0x91, 0xB4, 0x3C, 0x80, 0x26, 0x46, 0x9B, 0xCC, 0xDA, 0x53, 0x68, 0xAF,
-    0xA2, 0xC5, 0x20, 0xB3, 0x9B, 0xA9, 0x67, 0xE5, 0x83, 0xDA, 0xE7, 0x6F, 0xEC, 0x9C, 0x1B, 0xCE,
-    0x88, 0x35, 0x52, 0x5B, 0x7A, 0xD3, 0x93, 0xDD, 0x00, 0xDF, 0x0E, 0x74, 0x0A, 0x6D, 0x61, 0x69,
-    0xB9, 0x82, 0xED, 0x76, 0xFE, 0x2F, 0xB8, 0xFD, 0xBA, 0x31, 0x3B, 0x50, 0x72, 0x98, 0xCE, 0x5C,
-    0x67, 0x0B, 0x91, 0xC7, 0x0B, 0x96, 0x48, 0x0F, 0x2F, 0x85, 0x96, 0x8D, 0x6B, 0xAB, 0x8C, 0x97,
-    0x3B, 0x9A, 0xC2, 0x39, 0x90, 0xBA, 0xE2, 0x80, 0x34, 0x43, 0xB0, 0xE2, 0x0C, 0xCD, 0xCA, 0xE9,
-    0xFD, 0xAC, 0xF0, 0xFF, 0x05, 0xD3, 0x69, 0xD2, 0x3F, 0x0E, 0x2E, 0xD7, 0x32, 0x63, 0x32, 0xFD,
-    0x27, 0x66, 0xC4, 0x2F, 0xB3, 0x7F, 0x67, 0xED, 0xDF, 0x43, 0xBB, 0x27, 0xE4, 0xEF, 0xE0, 0x21,
-    0x65, 0x6D, 0x2A, 0xAB, 0x58, 0x1A, 0x20, 0x5A, 0x97, 0x20, 0xEA, 0x81, 0x10, 0xFE, 0xE6, 0xB2,
-    0x8E, 0x7A, 0xD6, 0xB3, 0x8C, 0xDF, 0x46, 0xFD, 0x12, 0x8B, 0xB8, 0x8F, 0x7A, 0xC8, 0x20, 0x9E,
-    0xDD, 0x1D, 0x8A, 0xDA, 0x0D, 0x75, 0xA3, 0xF6, 0x2F, 0xD0, 0xDB, 0xD0, 0x46, 0x3D, 0xAC, 0x10,
-    0x09, 0x5F, 0x8C, 0xF0, 0x99, 0x55, 0xD4, 0xC3, 0xEB, 0x42, 0x2C, 0xB2, 0x17, 0xD3, 0x1A, 0xDF,
-    0x19, 0xF6, 0x1A, 0x7E, 0x16, 0xB4, 0xA3, 0x94, 0x36, 0x17, 0xDB, 0x0F, 0x87, 0x05, 0x54, 0xBE,
-    0x92, 0x0D, 0x50, 0xB6, 0xDE, 0xA6, 0xAB, 0x4F, 0x9C, 0x01, 0x87, 0x61, 0x47, 0x06, 0xC7, 0x8D,
-    0x31, 0x51, 0x2C, 0x72, 0xDE, 0x26, 0x24, 0x39, 0x9A, 0x93, 0xD0, 0xC0, 0xC4, 0xDB, 0xC7, 0x01,
-    0x95, 0x27, 0xB8, 0x57, 0x09, 0x3F, 0x2C, 0x01, 0x7D, 0x83, 0xA2, 0xC9, 0xC6, 0x15, 0xE6, 0x41,
-    0x5F, 0x61, 0xC2, 0x99, 0x31, 0xC6, 0x3A, 0x48, 0x5A, 0x30, 0x55, 0x4D, 0xAC, 0x18, 0x6A, 0x69,
-    0x04, 0x4E, 0x9C, 0x9E, 0x0D, 0xD4, 0x40, 0x4C, 0xA4, 0x14, 0x90, 0x83, 0x40, 0xAB, 0x8D, 0xBA,
-    0x36, 0x66, 0x13, 0x04, 0x02, 0x22, 0x01, 0x19, 0xC0, 0x8F, 0x57, 0x00, 0x7F, 0x5B, 0x8B, 0xE3,
-    0x32, 0x07, 0x18, 0xE4, 0x0B, 0xAD, 0x80, 0x7A, 0x76, 0x17, 0xDC, 0xBA, 0xE1, 0xD5, 0xBC, 0x80,
-    0x50, 0x3C, 0x7B, 0x3A, 0xC9, 0x44, 0xA7, 0x3D, 0xDE, 0x42, 0xCB, 0x06, 0xA1, 0x38, 0x61, 0xE3,
-    0xF3, 0xE8, 0x86, 0x2B, 0xD8, 0x13, 0x96, 0xB6, 0x00, 0x93, 0x2B, 0x54, 0x3D, 0x39, 0x7D, 0xC8,
-    0x97, 0xF1, 0x40, 0xBD, 0x8A, 0xEB, 0x11, 0xAD, 0x7C, 0xB4, 0xEC, 0x6F, 0xF3, 0x45, 0x36, 0x62,
-    0x3A, 0x53, 0x2D, 0xE5, 0xF1, 0x4C, 0x6D, 0xAA, 0x8B, 0xD8, 0xE7, 0x30, 0x77, 0xFE, 0xC3, 0x30,
-    0x86, 0xA0, 0x88, 0x4C, 0x64, 0x7F, 0x2C, 0x0F, 0x84, 0x91, 0x0D, 0x3E, 0x06, 0x61, 0xA0, 0x4E,
-    0xD0, 0x09, 0xF1, 0xA6, 0x44, 0xB2, 0xE9, 0x29, 0x1E, 0x53, 0xEF, 0x41, 0x6D, 0x62, 0xBA, 0x62,
-    0xBB, 0x85, 0x2C, 0xD7, 0x50, 0x88, 0x43, 0x29, 0x7E, 0x5E, 0x71, 0xF3, 0x1E, 0x6A, 0xF3, 0xCD,
-    0x96, 0x88, 0x06, 0xBB, 0x00, 0x52, 0xF1, 0x00, 0x73, 0x5B, 0x70, 0xBB, 0x3D, 0x70, 0x6B, 0x61,
-    0x1C, 0xA1, 0x45, 0x15, 0x93, 0x60, 0xC7, 0xC6, 0xF4, 0x2E, 0xAB, 0x16, 0x93, 0x07, 0x60, 0x9C,
-    0x15, 0xB0, 0xC7, 0x3E, 0xB3, 0xB0, 0x23, 0xF4, 0x0B, 0x89, 0x76, 0xCE, 0x3D, 0xE1, 0xCF, 0xC6,
-    0xDC, 0x22, 0x16, 0x7F, 0x8B, 0xE0, 0x2F, 0x89, 0x9E, 0xFE, 0x92, 0xE0, 0x0D, 0x5B, 0xFB, 0x1F,
-    0x10, 0x6C, 0x49, 0x52, 0xFC, 0x11, 0xC3, 0xA2, 0x0D, 0x9F, 0x63, 0x98, 0x74, 0x11, 0x07, 0xB3,
-    0xB7, 0x71, 0x7F, 0x0A, 0x30, 0xB4, 0xE7, 0x15, 0x76, 0x80, 0x01, 0xFB, 0x18, 0x08, 0xFA, 0x6C,
-    0x9B, 0x20, 0x88, 0x88, 0x03, 0x18, 0xF5, 0x49, 0x1A, 0xE0, 0xE8, 0x2E, 0xDE, 0x4C, 0x44, 0xAD,
-    0xCB, 0x84, 0x9E, 0x4B, 0xFD, 0x29, 0x4F, 0x19, 0x51, 0x0F, 0x74, 0xAA, 0x88, 0x55, 0xE5, 0x0A,
-    0x30, 0xA7, 0xEB, 0x8B, 0xA7, 0x3A, 0x0E, 0xEC, 0x9F, 0x05, 0x10, 0x46, 0xE4, 0xC0, 0xED, 0xBE,
-    0x00, 0xA0, 0xB7, 0xD6, 0x07, 0xAD, 0x3F, 0x9D, 0x68, 0x66, 0x0A, 0xA2, 0x09, 0x9B, 0xF7, 0x2D,
-    0x98, 0xE6, 0x21, 0x68, 0x82, 0xF1, 0xC5, 0xA0, 0xCF, 0xC9, 0x6A, 0xC6, 0x46, 0x5B, 0x48, 0x87,
-    0x60, 0x97, 0x87, 0x5B, 0xF9, 0x54, 0xAE, 0x94, 0x6F, 0xC9, 0x1D, 0xF8, 0x6E, 0x2B, 0x70, 0xDB,
-    0xC6, 0x31, 0xBE, 0x48, 0xAC, 0x57, 0x3B, 0xF3, 0xD9, 0x83, 0x71, 0x54, 0xC1, 0x82, 0x5F, 0xB6,
-    0x76, 0xD2, 0x97, 0xF9, 0x0C, 0x80, 0xDE, 0x5A, 0x96, 0x34, 0x0F, 0x4B, 0x82, 0xA7, 0x03, 0x08,
-    0x83, 0x2F, 0xEC, 0x37, 0xC0, 0x6D, 0x49, 0xCD, 0x26, 0x61, 0xDD, 0xBE, 0xC0, 0xBC, 0x78, 0xE5,
-    0xC9, 0x66, 0xE7, 0x96, 0xBE, 0x05, 0x35, 0x2B, 0x59, 0xC1, 0xCF, 0xD7, 0xB9, 0xB6, 0x9C, 0xB5,
-    0xD5, 0x7A, 0xBB, 0x72, 0xDF, 0x92, 0x3B, 0xAC, 0xA0, 0x1E, 0xD0, 0x9D, 0x49, 0xF4, 0x7C, 0x17,
-    0x7E, 0xC9, 0xB7, 0xC1, 0xBE, 0x4A, 0x7A, 0xBA, 0xA8, 0xAB, 0x47, 0xB5, 0x12, 0xEE, 0x5E, 0x8B,
-    0xD4, 0x57, 0xBA, 0x56, 0xA6, 0x32, 0x86, 0x14, 0xF2, 0x31, 0x07, 0x05, 0xD3, 0x7B, 0xD2, 0xC0,
-    0x17, 0x35, 0xB3, 0xBF, 0x8A, 0xD9, 0x5F, 0x4E, 0xF3, 0xF3, 0xB8, 0x70, 0xB9, 0xE2, 0xB8, 0x66,
-    0x9D, 0xFD, 0xB1, 0x60, 0x1C, 0xD0, 0xD2, 0xDE, 0x2F, 0x4A, 0x31, 0xD2, 0xC4, 0x60, 0x47, 0x3B,
-    0x73, 0x15, 0x58, 0xA7, 0xCC, 0x64, 0x67, 0xED, 0xFB, 0x99, 0x39, 0x4F, 0x9D, 0x8C, 0xD0, 0x86,
-    0xD2, 0xA6, 0x5F, 0xA5, 0x76, 0xDB, 0xDC, 0xE6, 0x75, 0x6E, 0xDF, 0x56, 0xA3, 0xF9, 0x3F, 0x53,
-    0xA3, 0xFA, 0xE8, 0x26, 0xA2, 0x2D, 0x15, 0xB0, 0x7E, 0xC7, 0x6D, 0xC8, 0xA3, 0x9B, 0x33, 0x23,
-    0x4C, 0xA0, 0x0D, 0x5D, 0x04, 0x05, 0xBD, 0x02, 0x19, 0x1A, 0x8E, 0x1A, 0xDA, 0x9C, 0x1C, 0xAE,
-    0xD3, 0x70, 0x54, 0x80, 0x5F, 0x33, 0x77, 0x0B, 0x60, 0x47, 0x15, 0x33, 0xE7, 0x77, 0x53, 0x16,
-    0x7B, 0x7E, 0x8A, 0x27, 0x42, 0x11, 0x93, 0xDD, 0xAA, 0xBE, 0x00, 0xC9, 0x71, 0x11, 0xC3, 0x26,
-    0xDA, 0x65, 0x35, 0x19, 0x06, 0x42, 0x91, 0x41, 0x47, 0xDB, 0xB4, 0x0F, 0x79, 0xDC, 0xC7, 0x40,
-    0x49, 0xC7, 0x8D, 0x4C, 0x8F, 0x06, 0x87, 0x7F, 0x7B, 0x2F, 0x57, 0xA5, 0xA9, 0x54, 0x6D, 0x6F,
-    0xDD, 0x28, 0xB6, 0xB8, 0x03, 0xFC, 0xB2, 0xFD, 0x3F, 0x46, 0x65, 0x03, 0x5D, 0x02, 0x16, 0x1A,
-    0xCD, 0x8F, 0x69, 0xED, 0xB0, 0xEE, 0x46, 0xD7, 0x91, 0xB6, 0xC5, 0xB2, 0x40, 0x09, 0x87, 0x22,
-    0xC1, 0x88, 0x84, 0xFD, 0x15, 0x41, 0xDE, 0xC6, 0x2D, 0x43, 0x2B, 0x3E, 0x92, 0xDB, 0x40, 0x77,
-    0x9D, 0xFB, 0x9E, 0xBB, 0x4F, 0xA8, 0xF7, 0x0D, 0xF4, 0x39, 0x0B, 0x7A, 0xEE, 0x8F, 0xB8, 0x67,
-    0x99, 0xAA, 0xB0, 0xDB, 0x2E, 0x95, 0xC1, 0xC5, 0xBF, 0x2D, 0xEE, 0xF2, 0xBD, 0x34, 0xE0, 0x0E,
-    0x7E, 0xCD, 0x39, 0xD4, 0x75, 0xF6, 0x0E, 0x02, 0x61, 0xDE, 0x61, 0x2E, 0x43, 0xCA, 0x45, 0xCE,
-    0x0A, 0x0C, 0xF3, 0x8B, 0x5E, 0x02, 0xDA, 0xD8, 0xEB, 0xE0, 0xDB, 0x77, 0x21, 0xC1, 0x62, 0x7D,
-    0x14, 0xC3, 0x2C, 0x29, 0xC2, 0xCA, 0x6A, 0xE1, 0x99, 0xFE, 0x47, 0x7E, 0xCA, 0xB2, 0xE2, 0xB5,
-    0x1E, 0xB3, 0xCD, 0x9D, 0x44, 0x34, 0x56, 0x42, 0x61, 0xAF, 0xA7, 0x2D, 0x13, 0xDA, 0xA6, 0x80,
-    0xAB, 0xA3, 0x50, 0x77, 0xB2, 0xA3, 0xD8, 0x4A, 0x1C, 0x62, 0x90, 0x26, 0x50, 0x8C, 0xCF, 0x83,
-    0x34, 0x11, 0x0D, 0x7C, 0x5F, 0x29, 0x62, 0x9A, 0x4D, 0xF6, 0x62, 0x4F, 0xB7, 0x80, 0x5A, 0x89,
-    0xD5, 0x48, 0x1C, 0x1E, 0x05, 0x02, 0x67, 0x58, 0xE6, 0xE1, 0x1B, 0xA4, 0x0D, 0x98, 0x5B, 0xB1,
-    0x5A, 0x72, 0x9B, 0xFF, 0x17, 0xDA, 0xD6, 0xD0, 0x5E, 0x38, 0xE8, 0x1D, 0xFD, 0xE0, 0x05, 0x26,
-    0x56, 0x5F, 0xFF, 0x98, 0x76, 0xA9, 0xAB, 0x72, 0x18, 0xDB, 0x71, 0x0C, 0x33, 0x96, 0xE9, 0xBB,
-    0x11, 0x59, 0x30, 0xF3, 0x2C, 0x45, 0xB6, 0x20, 0xF1, 0x91, 0x75, 0xF0, 0xCF, 0x11, 0x19, 0x1F,
-    0x4A, 0xA3, 0xFC, 0xBC, 0xFD, 0xFE, 0x39, 0x37, 0xC0, 0xE8, 0xA1, 0x22, 0x0F, 0x4F, 0xE7, 0xCF,
-    0x1C, 0xDB, 0xF9, 0xA5, 0x43, 0xBC, 0xF1, 0x75, 0x46, 0xE4, 0x8A, 0x43, 0xCE, 0x3B, 0xE4, 0x69,
-    0x87, 0xFC, 0xDE, 0x8C, 0xC2, 0x1B, 0x97, 0x45, 0x64, 0xB2, 0xE7, 0xB1, 0xA9, 0xCF, 0xCB, 0x54,
-    0xAF, 0x83, 0xAF, 0xFA, 0xCE, 0x11, 0xF4, 0xFE, 0x69, 0x15, 0x09, 0x73, 0x01, 0x2D, 0xD6, 0x46,
-    0x06, 0xC3, 0x04, 0xA4, 0x3F, 0x1F, 0xA4, 0x45, 0xDC, 0xEA, 0x73, 0x30, 0xF3, 0xE6, 0x07, 0xF6,
-    0xFD, 0xA2, 0x73, 0x2E, 0xE8, 0x75, 0xF3, 0x18, 0x7A, 0x93, 0x73, 0x23, 0x2C, 0x21, 0x93, 0x3D,
-    0x29, 0x3C, 0x51, 0x15, 0xD8, 0x52, 0xD4, 0xD9, 0xE3, 0x90, 0xFD, 0xD3, 0x8A, 0x58, 0xB7, 0xEF,
-    0x30, 0xA5, 0xA5, 0x08, 0xBB, 0x8A, 0x2C, 0x89, 0xFD, 0x97, 0x32, 0xE6, 0x2F, 0x1F, 0x87, 0x04,
-    0xB8, 0x06, 0xC2, 0xB1, 0xEE, 0xD8, 0x6C, 0x10, 0x71, 0x42, 0xF4, 0x72, 0x24, 0x61, 0xF1, 0xCA,
-    0x9A, 0xF7, 0x5C, 0x39, 0xD9, 0x42, 0x0D, 0x72, 0x20, 0x93, 0x47, 0xB4, 0xFB, 0xA7, 0x8D, 0x33,
-    0x3A, 0xC8, 0x7C, 0x8A, 0xC5, 0x4A, 0x6C, 0x54, 0xCE, 0xA0, 0x30, 0x6F, 0x47, 0x1B, 0x1A, 0xBA,
-    0x21, 0x7D, 0x90, 0x0E, 0x88, 0x1E, 0x16, 0x88, 0x45, 0x91, 0xFF, 0x58, 0x45, 0x2C, 0xA3, 0xB2,
-    0xB0, 0x46, 0x92, 0x4D, 0x1A, 0x21, 0xAE, 0xC1, 0xCC, 0x9B, 0x8A, 0x67, 0x5E, 0x1B, 0x19, 0x2B,
-    0xF7, 0xE9, 0x53, 0xAC, 0xEB, 0x15, 0x2C, 0x27, 0xDA, 0x74, 0x49, 0x6A, 0x63, 0x49, 0xF2, 0x05,
-    0xBB, 0x14, 0x69, 0xE7, 0xE3, 0x41, 0xA9, 0xF3, 0xB7, 0x62, 0xDB, 0xD0, 0x3F, 0x28, 0x2C, 0x0B,
-    0x8B, 0x70, 0x9C, 0x66, 0x49, 0x18, 0xAC, 0x7A, 0x9D, 0x48, 0xA7, 0x49, 0xCB, 0xE2, 0x26, 0xA9,
-    0x45, 0xB0, 0x72, 0x92, 0xDA, 0x01, 0x03, 0x1B, 0x94, 0x10, 0x36, 0x22, 0xED, 0x2B, 0xB4, 0x1B,
-    0xB0, 0xDA, 0x84, 0xEE, 0x7B, 0xAC, 0xDC, 0xF3, 0x7D, 0xE8, 0x97, 0xAC, 0x71, 0xCF, 0xD1, 0xE7,
-    0xE6, 0xAE, 0x1F, 0x50, 0x5D, 0x5C, 0xD4, 0xFD, 0x19, 0x33, 0xA5, 0xB2, 0xA9, 0x29, 0x96, 0x09,
-    0xFC, 0xFE, 0x2E, 0xF3, 0x84, 0x94, 0x05, 0x58, 0x6B, 0x8E, 0x6C, 0x03, 0x9B, 0xC7, 0x9C, 0xB0,
-    0x78, 0xC0, 0x2B, 0x3B, 0xB3, 0xA2, 0x7C, 0x70, 0x9B, 0xAC, 0x38, 0x36, 0x04, 0x76, 0x07, 0x12,
-    0x42, 0x70, 0x4D, 0x39, 0x5E, 0x1F, 0xC1, 0x38, 0xC0, 0x7A, 0x04, 0x71, 0x98, 0x4B, 0xDC, 0x7A,
-    0x7B, 0x97, 0x10, 0x7E, 0xE2, 0xB2, 0x26, 0x96, 0x3D, 0x96, 0xC5, 0x68, 0xDF, 0x9A, 0xB2, 0x44,
-    0x3E, 0x67, 0xFB, 0xC6, 0x63, 0xC6, 0x0C, 0x1E, 0xDB, 0x6A, 0x7D, 0x5E, 0x52, 0xDF, 0x64, 0xB2,
-    0xB3, 0xA0, 0x6D, 0xF8, 0x2D, 0xF3, 0xE2, 0x9A, 0xDA, 0xF5, 0x79, 0xF6, 0xEA, 0xC9, 0x3D, 0xC9,
-    0x37, 0xAD, 0x31, 0x5D, 0x62, 0xBD, 0x87, 0xD8, 0x80, 0x56, 0x32, 0xC2, 0xA4, 0x9D, 0xFF, 0x9D,
-    0x5A, 0x5E, 0x96, 0xF6, 0x67, 0xD8, 0x45, 0x7F, 0xCB, 0xBB, 0x51, 0x3C, 0x43, 0x3C, 0x0D, 0xE5,
-    0x18, 0x19, 0xAE, 0x8A, 0xD2, 0x27, 0xFD, 0x1F, 0xC1, 0x81, 0x75, 0xC2, 0xBE, 0x5D, 0x6D, 0x67,
-    0x1D, 0x98, 0x47, 0xB4, 0x08, 0xB3, 0xCC, 0xC1, 0x2C, 0xC1, 0x9B, 0xFB, 0xE9, 0x3D, 0x7E, 0x60,
-    0x5C, 0x02, 0x11, 0x62, 0x4C, 0xB0, 0x20, 0xB2, 0x5A, 0x13, 0x87, 0x10, 0xCA, 0x3B, 0x4F, 0x1A,
-    0xFA, 0xBC, 0x0C, 0x80, 0x73, 0xCD, 0xA2, 0x74, 0x9A, 0x45, 0xC6, 0x4B, 0x3B, 0x81, 0x66, 0x91,
-    0x66, 0xE3, 0x4C, 0x16, 0xAD, 0x73, 0x08, 0x48, 0xB3, 0x3A, 0x56, 0xB3, 0x48, 0x8F, 0xD1, 0x2C,
-    0xB6, 0xCE, 0xB0, 0x10, 0x57, 0x85, 0x43, 0xD1, 0x26, 0xF5, 0xB2, 0xCB, 0x4A, 0x9F, 0xFE, 0x2D,
-    0xDA, 0xA2, 0xF2, 0xD2, 0xE2, 0x80, 0xFB, 0x55, 0xF3, 0x14, 0xA7, 0xA1, 0x58, 0x9C, 0x57, 0xB2,
-    0x38, 0x8A, 0xE1, 0x11, 0x1A, 0xCD, 0x8B, 0x34, 0xAE, 0x44, 0x66, 0x06, 0x6B, 0xFC, 0xBE, 0xA8,
-    0x96, 0x2C, 0x31, 0x72, 0xF0, 0x40, 0x0A, 0xF2, 0x77, 0x31, 0x1D, 0xE3, 0x3C, 0xE1, 0xF9, 0xE0,
-    0x79, 0xF8, 0xAD, 0x4D, 0xBB, 0xCE, 0x18, 0x5B, 0x2A, 0x23, 0x71, 0x8F, 0xFF, 0xE4, 0xFE, 0x0D,
-    0xC8, 0x3C, 0xFF, 0x8B, 0xF2, 0xAB, 0x26, 0xF9, 0x19, 0x89, 0x16, 0xBF, 0xA0, 0xDF, 0x7F, 0x61,
-    0xD3, 0xE4, 0x3D, 0x6B, 0xB6, 0xD3, 0xC7, 0x3F, 0xD3, 0x67, 0x9A, 0xE8, 0x12, 0xCF, 0x04, 0x0D,
-    0x7C, 0x81, 0x48, 0xC2, 0xED, 0x69, 0xBD, 0x44, 0x1C, 0xBE, 0x03, 0x3F, 0xA1, 0x90, 0xC9, 0x7B,
-    0xFD, 0x3F, 0x03, 0xB1, 0x26, 0x52, 0xCB, 0x23, 0x5F, 0x92, 0xC8, 0xC4, 0xFE, 0xAB, 0x4B, 0xE3,
-    0xED, 0x7D, 0x8D, 0x18, 0x5F, 0xB8, 0xC8, 0x71, 0xB1, 0x04, 0xB1, 0xCD, 0x47, 0x22, 0xB1, 0x97,
-    0x0A, 0xC3, 0xC3, 0x70, 0xD8, 0x81, 0x2A, 0x15, 0x61, 0xEF, 0x02, 0xB2, 0x7B, 0x28, 0x17, 0x93,
-    0x66, 0x94, 0xD2, 0x75, 0xF4, 0xD8, 0x98, 0x21, 0x77, 0x1D, 0x66, 0x55, 0x7A, 0x41, 0x81, 0xDB,
-    0x83, 0xC1, 0xDF, 0xE9, 0xAB, 0x6C, 0xF9, 0x6C, 0x38, 0xB2, 0x72, 0x78, 0x81, 0xA3, 0x65, 0x7D,
-    0x91, 0x9C, 0x2B, 0x1F, 0x49, 0x92, 0x5B, 0x47, 0x98, 0xF1, 0x12, 0x15, 0x6F, 0x20, 0xD9, 0x1B,
-    0x27, 0xDB, 0x9B, 0x51, 0xBA, 0x1F, 0x25, 0xF3, 0xDB, 0x23, 0x56, 0xF3, 0x5B, 0x45, 0xF6, 0x6A,
-    0xC5, 0x56, 0xF3, 0x7E, 0xD1, 0xEB, 0x35, 0x22, 0xBB, 0x2D, 0x44, 0xD0, 0x01, 0x12, 0x80, 0x87,
-    0xCF, 0x91, 0xD1, 0xD7, 0x14, 0xAA, 0x8A, 0xC1, 0x5F, 0x97, 0x1E, 0x0A, 0x0B, 0x15, 0xC7, 0xED,
-    0x93, 0xA2, 0x3E, 0x66, 0x22, 0x24, 0x9C, 0x74, 0x11, 0x14, 0xA2, 0x6B, 0x09, 0x70, 0xAE, 0x68,
-    0x01, 0x5F, 0xB2, 0xFB, 0x67, 0xA6, 0xCF, 0x08, 0x80, 0x43, 0x93, 0xDA, 0xC6, 0xFB, 0x4D, 0x88,
-    0xA1, 0x61, 0x7D, 0x87, 0xED, 0x83, 0xAB, 0x40, 0x22, 0x40, 0x44, 0x02, 0xAA, 0x65, 0x39, 0x2A,
-    0xA8, 0x3E, 0x11, 0x50, 0x97, 0x9F, 0x9A, 0x48, 0xA9, 0x4B, 0x2F, 0x89, 0x50, 0xF4, 0x92, 0x88,
-    0x44, 0x4F, 0xBE, 0x6E, 0x1C, 0x69, 0x30, 0x4A, 0x1D, 0xB9, 0x77, 0x12, 0xD6, 0x15, 0x82, 0x22,
-    0x6E, 0x1D, 0x9E, 0xB4, 0x5F, 0x8D, 0xA5, 0xF3, 0xD1, 0x3D, 0x0D, 0x5A, 0x59, 0x53, 0x5B, 0x33,
-    0xD1, 0x5A, 0x43, 0x71, 0xFC, 0x69, 0x62, 0xA7, 0x79, 0xFC, 0xC1, 0x36, 0x19, 0x7B, 0xF9, 0x82,
-    0x39, 0x4C, 0xC5, 0xD9, 0x5F, 0x71, 0xED, 0xB3, 0x77, 0xB0, 0x59, 0x42, 0x91, 0x2E, 0x10, 0x61,
-    0x6E, 0xF3, 0x43, 0x8C, 0xE6, 0x61, 0x35, 0xB7, 0xFC, 0xCA, 0x15, 0xF8, 0x7A, 0xC3, 0xB2, 0xE9,
-    0x62, 0x2C, 0xB5, 0x56, 0x85, 0x09, 0x64, 0xE5, 0xF8, 0xCD, 0x1C, 0x2C, 0x64, 0x55, 0x79, 0xD5,
-    0xEC, 0x25, 0x52, 0x6C, 0x0E, 0xB6, 0xB4, 0xB2, 0x1D, 0xBC, 0x84, 0x7B, 0x93, 0xC3, 0xC0, 0xD9,
-    0x17, 0xCD, 0xCE, 0x9E, 0xFF, 0x0D, 0x8F, 0x3B, 0x72, 0x5C, 0x2C, 0x3E, 0x62, 0x2F, 0xBE, 0x5C,
-    0xC4, 0xF1, 0x2E, 0x74, 0x11, 0x07, 0xAC, 0x12, 0x16, 0x5B, 0x44, 0x74, 0x25, 0xF0, 0xBF, 0xFB,
-    0x0E, 0xD3, 0xA4, 0x34, 0x83, 0xE4, 0xEF, 0x9A, 0x47, 0x18, 0xAA, 0x7F, 0xC3, 0x99, 0x0B, 0x30,
-    0x05, 0x34, 0x9C, 0xFD, 0x88, 0x8C, 0xB9, 0xD6, 0xC0, 0xD7, 0x5C, 0xD3, 0x42, 0xF0, 0x24, 0x74,
-    0x3A, 0x24, 0xF5, 0x09, 0x09, 0xFF, 0x4D, 0x74, 0xB9, 0xC3, 0x3B, 0x10, 0xF3, 0x8E, 0x7A, 0x4C,
-    0x5C, 0xB6, 0xBA, 0x18, 0x0E, 0xA1, 0x64, 0x4F, 0x77, 0xA1, 0x85, 0xB5, 0x22, 0xEE, 0x57, 0x4B,
-    0x9B, 0x69, 0xEC, 0x66, 0x20, 0xCA, 0x6A, 0xC8, 0xD3, 0xB2, 0x12, 0xAC, 0xD2, 0xA9, 0x5C, 0x4A,
-    0xB0, 0xB4, 0xF8, 0x9B, 0x3C, 0x17, 0x0F, 0xAA, 0xD2, 0xB1, 0x48, 0xEE, 0xA7, 0x49, 0x5D, 0xA4,
-    0xA1, 0x24, 0x86, 0x6F, 0xF3, 0x60, 0x30, 0xFE, 0xF0, 0xC7, 0xFC, 0x6D, 0x76, 0xC2, 0xF1, 0xD2,
-    0xA7, 0x01, 0x23, 0xCE, 0xC1, 0x59, 0x9C, 0x19, 0x14, 0x04, 0x1A, 0x11, 0x96, 0xDD, 0x0B, 0x5E,
-    0xB2, 0xA4, 0x1B, 0xD0, 0xEE, 0x85, 0x27, 0x32, 0xE1, 0x65, 0x4B, 0xDA, 0x4C, 0xDC, 0x1A, 0xB6,
-    0x6D, 0xB1, 0xA1, 0x96, 0xC3, 0xDF, 0xD2, 0x82, 0x5F, 0x66, 0x41, 0xD4, 0xAA, 0xF3, 0x99, 0x96,
-    0x5D, 0xFB, 0xB8, 0xE7, 0x55, 0x68, 0xDF, 0xB9, 0x66, 0x39, 0x3F, 0xDD, 0x5E, 0xF7, 0xED, 0x29,
-    0x18, 0x9B, 0x16, 0x78, 0x85, 0xAC, 0x93, 0xF0, 0x8A, 0xA4, 0x11, 0x62, 0x96, 0x54, 0x46, 0x89,
-    0x4E, 0x6E, 0x1C, 0xED, 0xD1, 0xD0, 0x13, 0x0D, 0xBE, 0xD0, 0xC8, 0x8D, 0x6C, 0x56, 0x99, 0x85,
-    0xC0, 0x9F, 0xD9, 0x9F, 0x17, 0xA9, 0xB9, 0xC0, 0x31, 0x2E, 0xA9, 0x39, 0xCF, 0xD1, 0x22, 0xA9,
-    0x79, 0x91, 0xC0, 0xF6, 0xF8, 0x05, 0xE6, 0xB1, 0x37, 0x53, 0x61, 0xB5, 0x2B, 0x06, 0xFB, 0x1C,
-    0xE1, 0xB3, 0x60, 0xDD, 0xB0, 0x94, 0x39, 0x42, 0x42, 0xCD, 0x02, 0x14, 0x80, 0x43, 0x51, 0x0E,
-    0x03, 0xFD, 0x4C, 0x53, 0x6C, 0x02, 0x98, 0xFE, 0xEB, 0x5D, 0x15, 0x8D, 0xC5, 0x41, 0x3D, 0xB2,
-    0x1B, 0xE1, 0x36, 0xBF, 0x3B, 0xCB, 0x21, 0xBC, 0x7D, 0xB8, 0xCC, 0x09, 0xF0, 0x9C, 0x02, 0x0C,
-    0xE8, 0x8F, 0xED, 0xCD, 0xD7, 0xEF, 0x1C, 0x5E, 0xB3, 0xBF, 0x23, 0xE1, 0x35, 0x2B, 0xC4, 0x89,
-    0xCF, 0x22, 0xCD, 0xD7, 0xB3, 0x43, 0xA5, 0xD5, 0x30, 0x1A, 0x9F, 0xA3, 0x0D, 0xD2, 0x43, 0x3E,
-    0xF1, 0xB1, 0xFE, 0x06, 0xDB, 0x22, 0x73, 0x19, 0xFD, 0xCC, 0x22, 0x8E, 0xA1, 0x55, 0xD5, 0x18,
-    0x11, 0x1D, 0x83, 0x84, 0x77, 0x94, 0xE2, 0xE2, 0x07, 0x96, 0xF1, 0x05, 0xC0, 0x78, 0x70, 0x38,
-    0x3E, 0xA2, 0x84, 0x5C, 0x0E, 0x6B, 0xFC, 0xC2, 0xF1, 0xDA, 0x52, 0x2D, 0x1D, 0x6B, 0x58, 0xE0,
-    0x30, 0xAB, 0xDE, 0xDB, 0x39, 0x56, 0x05, 0x47, 0x7C, 0x63, 0x8E, 0xB9, 0x3B, 0x4F, 0xCF, 0xF0,
-    0x5C, 0xFE, 0xB1, 0xE6, 0xF7, 0x02, 0x63, 0x69, 0xDA, 0x07, 0xC6, 0xEC, 0x2A, 0x94, 0xF7, 0x60,
-    0x29, 0x1B, 0xB6, 0x0F, 0x92, 0x7D, 0x2F, 0xF7, 0xF2, 0xBE, 0x88, 0x9A, 0xB0, 0x5A, 0x59, 0x25,
-    0xD7, 0x31, 0x19, 0x7D, 0xB1, 0x7F, 0xF0, 0x3D, 0x18, 0x4D, 0x96, 0x22, 0x31, 0x92, 0xB0, 0xC4,
-    0x3B, 0x8F, 0xA5, 0x3A, 0x78, 0x32, 0xD8, 0xD0, 0xBB, 0x42, 0xAF, 0x52, 0x40, 0xDA, 0x0E, 0x21,
-    0x8D, 0x3B, 0x0B, 0x28, 0xBF, 0x6E, 0x04, 0x62, 0xC6, 0xCE, 0x59, 0xCD, 0x81, 0xD4, 0xCC, 0xDE,
-    0xCB, 0x76, 0xEF, 0x35, 0xFE, 0x3C, 0x94, 0xCF, 0xDD, 0x75, 0x23, 0x84, 0xC7, 0x58, 0xDF, 0xFB,
-    0xEB, 0x32, 0x9B, 0x66, 0x85, 0x3A, 0x26, 0xC3, 0x2E, 0x6C, 0x25, 0x44, 0x9B, 0x6B, 0x86, 0xDB,
-    0x52, 0x2A, 0x84, 0x58, 0x3F, 0x40, 0xA1, 0x95, 0x71, 0x34, 0xEC, 0xDF, 0xD3, 0xEC, 0x32, 0x5F,
-    0x4D, 0x5C, 0xC1, 0x75, 0x71, 0xAC, 0x2D, 0xDF, 0x15, 0x13, 0x51, 0xF8, 0x8E, 0x30, 0xE8, 0xE8,
-    0x39, 0x21, 0xB3, 0x89, 0x8E, 0xF3, 0x45, 0xE5, 0xD8, 0x57, 0x55, 0x25, 0xEB, 0x8C, 0xDA, 0x5F,
-    0x44, 0x56, 0xF5, 0xD5, 0x66, 0xE6, 0xFF, 0xD3, 0x00, 0x25, 0x65, 0xF9, 0x93, 0x01, 0x7E, 0xEE,
-    0xF0, 0xDA, 0x80, 0x17, 0x8A, 0x5E, 0x19, 0x90, 0x90, 0x9D, 0xF8, 0x03, 0x02, 0xD2, 0x09, 0xE2,
-    0xC6, 0x57, 0xFD, 0x01, 0x93, 0xD6, 0x91, 0x20, 0x82, 0x60, 0x78, 0x81, 0xFE, 0x8A, 0x20, 0x4D,
-    0xD7, 0x12, 0xBF, 0x73, 0x1E, 0xD3, 0x37, 0x87, 0x25, 0x12, 0x39, 0x05, 0x8E, 0x0B, 0xD5, 0x95,
-    0x87, 0x70, 0xE1, 0xF7, 0x00, 0xB7, 0x24, 0x1E, 0xF6, 0x9F, 0x45, 0x55, 0xFC, 0x47, 0x71, 0x82,
-    0x54, 0x12, 0x13, 0x50, 0x66, 0x22, 0x5A, 0x43, 0x68, 0x8A, 0x5D, 0xE1, 0xA5, 0xEB, 0xFC, 0xFD,
-    0x0B, 0x19, 0xDE, 0xBD, 0xCB, 0xAE, 0x71, 0xA8, 0x56, 0x4B, 0x80, 0x88, 0x41, 0x93, 0x71, 0x56,
-    0x9C, 0x5F, 0x67, 0x25, 0x87, 0x20, 0x55, 0x59, 0xC9, 0x09, 0xA3, 0xFC, 0x1B, 0x2D, 0x95, 0x2E,
-    0xFB, 0x11, 0xC7, 0x4A, 0x0A, 0x10, 0xCF, 0x0A, 0x34, 0x4E, 0x97, 0x77, 0x33, 0x92, 0xAB, 0x6C,
-    0x18, 0x45, 0x1E, 0x6B, 0x47, 0xEF, 0xCC, 0x2D, 0x9D, 0x51, 0xFA, 0xE8, 0x9F, 0xB8, 0x05, 0xEA,
-    0xFF, 0x62, 0x44, 0x03, 0xC8, 0x2A, 0x40, 0xC3, 0x52, 0x76, 0x02, 0x50, 0x11, 0x32, 0x38, 0x51,
-    0x94, 0x63, 0x6E, 0x04, 0x4D, 0xA0, 0x1B, 0xBA, 0x32, 0x26, 0xFD, 0x84, 0x5A, 0x4D, 0x9C, 0xED,
-    0xEC, 0x77, 0xAC, 0x5C, 0xBB, 0x68, 0xED, 0x9F, 0x20, 0x16, 0xAD, 0x24, 0x76, 0x69, 0x5F, 0x01,
-    0xBF, 0x2D, 0xF9, 0x61, 0x2F, 0x43, 0xE0, 0x2C, 0xE9, 0x2D, 0x49, 0x3C, 0x6A, 0x80, 0xD2, 0x73,
-    0x1D, 0x1A, 0xE7, 0xB4, 0xDC, 0x57, 0xB2, 0x7B, 0x0C, 0x22, 0xEF, 0xB1, 0xE5, 0x09, 0xD5, 0x48,
-    0x52, 0xCB, 0x28, 0xEA, 0x7A, 0x30, 0xF3, 0xC8, 0x13, 0x04, 0xD6, 0xC6, 0x24, 0x26, 0xBE, 0x24,
-    0xD1, 0x28, 0x89, 0xA2, 0x73, 0xE5, 0x5B, 0x2A, 0x5E, 0x00, 0x11, 0x3B, 0x27, 0x13, 0x55, 0x49,
-    0xCF, 0x33, 0xFE, 0xF5, 0x5E, 0x3A, 0x1C, 0xFC, 0x54, 0x7B, 0x1E, 0xFE, 0xC8, 0x8A, 0x63, 0x2F,
-    0xFA, 0xA6, 0xF6, 0x3A, 0x16, 0x71, 0x61, 0x7F, 0x27, 0x3B, 0xAB, 0xA1, 0x85, 0x12, 0xAE, 0x67,
-    0x6F, 0xBE, 0x69, 0x39, 0x0C, 0x81, 0x29, 0xC1, 0x3F, 0xDB, 0x18, 0x7D, 0xA5, 0x91, 0x45, 0xE8,
-    0x5C, 0x19, 0xFC, 0xD8, 0xC2, 0x08, 0x5C, 0x86, 0x6F, 0x5B, 0xE1, 0x8B, 0xE1, 0xCB, 0x16, 0xF1,
-    0x6B, 0x65, 0xFC, 0x0D, 0x2B, 0xD4, 0x3C, 0xE3, 0xBF, 0xD0, 0xB6, 0xBA, 0x66, 0xFF, 0xCE, 0x92,
-    0x36, 0x35, 0x22, 0x08, 0xE4, 0xC3, 0xF4, 0x86, 0x2E, 0x3C, 0x36, 0xB4, 0x1F, 0xED, 0xED, 0x15,
-    0xB9, 0x1A, 0x25, 0x32, 0x47, 0x95, 0x3B, 0xAD, 0xE7, 0xE1, 0xB7, 0x9A, 0x0A, 0x23, 0x62, 0x18,
-    0xD1, 0xCD, 0x28, 0x57, 0x8E, 0x9C, 0x38, 0x51, 0x58, 0xC7, 0xC4, 0xFE, 0xA2, 0x75, 0x66, 0xE3,
-    0xDA, 0x99, 0xD4, 0x64, 0x2F, 0xBB, 0x48, 0x16, 0xDF, 0x7E, 0x60, 0x51, 0x8F, 0x20, 0xA4, 0x9E,
-    0x83, 0x22, 0x44, 0x24, 0x4F, 0x62, 0x27, 0xC5, 0x1D, 0x8C, 0x47, 0xF4, 0x65, 0x76, 0xAE, 0x23,
-    0x7C, 0x95, 0xBD, 0xEB, 0x05, 0x52, 0xBF, 0xC0, 0x93, 0x85, 0x8A, 0x68, 0x16, 0x18, 0x21, 0x34,
-    0x1A, 0x48, 0x45, 0xD1, 0xB4, 0x89, 0x25, 0xE3, 0x39, 0xB2, 0x19, 0x57, 0x24, 0xF4, 0x22, 0x3C,
-    0x6F, 0xA5, 0xCA, 0xC5, 0xE4, 0xAE, 0x44, 0x7E, 0xB2, 0x7B, 0xF1, 0x9D, 0x1D, 0xAE, 0x12, 0xC6,
-    0xFD, 0x78, 0x4B, 0x95, 0xBE, 0x95, 0xBC, 0x75, 0x20, 0xF1, 0x65, 0x9D, 0x44, 0x07, 0x2F, 0x6D,
-    0xA2, 0xBE, 0xB7, 0x3E, 0x55, 0xDF, 0x1B, 0xEA, 0x59, 0x0D, 0xF6, 0x16, 0x86, 0xAC, 0x2D, 0x7E,
-    0x26, 0x1A, 0x53, 0x21, 0xD2, 0x79, 0x55, 0xD4, 0x19, 0x2F, 0x84, 0xB2, 0xA8, 0x93, 0x16, 0xF6,
-    0xD2, 0x1A, 0x06, 0x40, 0xC3, 0x41, 0x3A, 0x26, 0x22, 0xA5, 0x82, 0x53, 0xA6, 0x2D, 0x49, 0x43,
-    0xF4, 0xEA, 0x0D, 0x2B, 0x1C, 0xFC, 0x9E, 0xBC, 0x01, 0x17, 0x76, 0x0C, 0x08, 0xCD, 0x7D, 0xC5,
-    0x85, 0x6F, 0xDD, 0xDC, 0xDB, 0xBB, 0xDC, 0xA8, 0xD9, 0xBA, 0x41, 0x80, 0xB2, 0x0C, 0xD6, 0x0A,
-    0x7E, 0x20, 0xE0, 0xAC, 0x4D, 0xBF, 0xA5, 0xFB, 0x89, 0x79, 0x9B, 0xDB, 0x5B, 0xCC, 0x2B, 0xDD,
-    0xEE, 0x33, 0x9C, 0x43, 0xE8, 0xF0, 0xAC, 0x8D, 0xDD, 0x0E, 0xA6, 0x77, 0xBD, 0x38, 0x6E, 0x6C,
-    0x49, 0xDF, 0x18, 0x77, 0x60, 0x3D, 0xC3, 0x07, 0x5D, 0x1D, 0xF6, 0x06, 0xCD, 0xA4, 0xF4, 0x81,
-    0xFA, 0x44, 0xFF, 0xD5, 0xB2, 0x21, 0x69, 0x02, 0xD8, 0x2F, 0xE8, 0x49, 0x28, 0x81, 0x2D, 0x93,
-    0x56, 0x56, 0x3E, 0x91, 0xC0, 0x52, 0x96, 0x31, 0x94, 0xF4, 0x52, 0x56, 0x32, 0x8C, 0xB7, 0xA5,
-    0x2C, 0x66, 0x18, 0x6E, 0xCB, 0x40, 0x70, 0x36, 0x32, 0x94, 0xC8, 0x52, 0x2B, 0xA1, 0xD7, 0x88,
-    0x43, 0xAA, 0x46, 0x5D, 0x07, 0xFA, 0xB5, 0xC5, 0xCE, 0x4C, 0x21, 0xD4, 0x0F, 0xBC, 0x35, 0x0F,
-    0x78, 0x72, 0x69, 0xB9, 0xAD, 0x9B, 0xC6, 0x24, 0x61, 0x26, 0x9D, 0xA3, 0x88, 0xDD, 0x1C, 0x76,
-    0x76, 0xF4, 0x3D, 0xB8, 0xB6, 0x80, 0x0E, 0x13, 0x3D, 0x2D, 0xD0, 0x51, 0x62, 0x1D, 0xD0, 0x0D,
-    0x52, 0xD6, 0x24, 0x6E, 0x5C, 0xE2, 0xAE, 0x53, 0x61, 0x65, 0xE7, 0x1C, 0xE2, 0x17, 0xDC, 0xA8,
-    0xE0, 0x0E, 0x37, 0xF7, 0x68, 0x35, 0x5C, 0xD7, 0x9D, 0x4E, 0x2A, 0xE6, 0x35, 0xAB, 0x62, 0xC3,
-    0xDB, 0xF0, 0xCC, 0x82, 0xF3, 0xBD, 0xCC, 0x43, 0x25, 0xCB, 0x78, 0xE1, 0xC6, 0x0C, 0xAE, 0x83,
-    0x0C, 0x43, 0x16, 0x8D, 0xDE, 0xD5, 0x32, 0xE1, 0x48, 0xC9, 0x98, 0x05, 0x9B, 0x6B, 0xB6, 0x89,
-    0x79, 0xA9, 0x94, 0x8C, 0xE6, 0x84, 0xF2, 0x9D, 0x6A, 0x92, 0x5F, 0xBD, 0x8E, 0x65, 0xFD, 0x8C,
-    0xA5, 0xFA, 0xF8, 0x7A, 0xA9, 0x16, 0xC3, 0xC2, 0x7E, 0x28, 0xF9, 0x67, 0x49, 0xBF, 0x4D, 0xEB,
-    0x91, 0xCD, 0x35, 0x08, 0x3C, 0xC0, 0x58, 0xA3, 0xB6, 0xD5, 0xC9, 0x52, 0xCC, 0x70, 0xD0, 0xB3,
-    0x8A, 0x46, 0xE7, 0xF3, 0x24, 0x24, 0x3F, 0xA8, 0x96, 0x34, 0x34, 0x3B, 0x2F, 0x80, 0xE7, 0xC0,
-    0x70, 0x87, 0x8B, 0x85, 0x17, 0x0E, 0x2E, 0xF7, 0x0D, 0x18, 0xFE, 0x06, 0xFE, 0xC5, 0x72, 0xC9,
-    0x0B, 0x9C, 0xAB, 0x2F, 0x76, 0xB9, 0x4B, 0x26, 0x61, 0xE3, 0x7A, 0x96, 0x4B, 0x46, 0xCB, 0x56,
-    0x9A, 0xB1, 0x21, 0x30, 0xA9, 0x4E, 0xDA, 0x8E, 0xB7, 0x1E, 0x6D, 0xF8, 0xE1, 0x6C, 0xC7, 0x8A,
-    0xBD, 0x50, 0x8B, 0xA0, 0x32, 0xFF, 0x8B, 0x19, 0x26, 0xDD, 0x18, 0xBC, 0x36, 0xB9, 0x9C, 0x23,
-    0xCC, 0x95, 0xA5, 0x5B, 0xAE, 0x2F, 0x51, 0xB0, 0x5C, 0xCE, 0xB6, 0xF8, 0x9A, 0xA6, 0x28, 0x62,
-    0x67, 0xC7, 0x76, 0x09, 0x52, 0x05, 0xC9, 0x22, 0xEA, 0x35, 0x2E, 0x2D, 0x63, 0x01, 0xF0, 0xC9,
-    0xA2, 0x77, 0xC1, 0x69, 0x0B, 0xE1, 0x43, 0x93, 0x51, 0xB3, 0x94, 0x52, 0x27, 0x1E, 0x31, 0x59,
-    0xC4, 0xB5, 0x86, 0x4C, 0x9B, 0x92, 0x7D, 0x57, 0x2A, 0x10, 0x05, 0x24, 0x0A, 0xD6, 0x9F, 0xB2,
-    0x7C, 0xD7, 0x56, 0x08, 0xEF, 0x5F, 0xDA, 0x83, 0x73, 0x95, 0x39, 0xE1, 0xDC, 0xA8, 0x19, 0x12,
-    0x0B, 0xBE, 0xC9, 0x21, 0x3D, 0x3F, 0x14, 0xE4, 0xA4, 0x2D, 0x4F, 0xB2, 0x9D, 0xE9, 0xC3, 0x85,
-    0x7A, 0x4E, 0x73, 0x4F, 0xD7, 0x6A, 0x7A, 0x4F, 0x88, 0x99, 0x90, 0x0A, 0xC8, 0x68, 0x27, 0x62,
-    0x01, 0x88, 0xCD, 0x43, 0x1C, 0x17, 0x05, 0xE7, 0x3C, 0x6B, 0xEB, 0x9D, 0xAC, 0x13, 0x7A, 0x9F,
-    0x3F, 0xB3, 0x7F, 0x33, 0x8F, 0x03, 0x40, 0xC8, 0xF1, 0x70, 0x69, 0xCD, 0x44, 0x71, 0x3B, 0xC4,
-    0x45, 0x1D, 0x8C, 0xEE, 0x77, 0x6F, 0x72, 0x32, 0xBB, 0x48, 0x8B, 0x5F, 0x57, 0xEB, 0xE1, 0xBD,
-    0x83, 0xC7, 0x10, 0x53, 0xEC, 0xB1, 0xBE, 0x9A, 0x47, 0x3E, 0x73, 0xD9, 0x3C, 0x82, 0x80, 0x9D,
-    0x47, 0xCC, 0x67, 0x18, 0x70, 0x02, 0x18, 0x01, 0x62, 0x29, 0x0C, 0xC2, 0xBB, 0x00, 0xF2, 0x85,
-    0x50, 0xBE, 0x1E, 0xB3, 0xBA, 0x1F, 0x71, 0xB1, 0x90, 0xAC, 0x8E, 0xD8, 0x00, 0x91, 0xB4, 0x91,
-    0xE4, 0xB1, 0x5D, 0xDE, 0xAD, 0x45, 0xAA, 0x4B, 0x31, 0x71, 0xC2, 0x05, 0x76, 0x3F, 0xF1, 0xAB,
-    0x4C, 0x3F, 0x1A, 0x17, 0x18, 0xC9, 0x78, 0x17, 0x07, 0xCF, 0x6B, 0x3E, 0x4A, 0xD1, 0x60, 0xDD,
-    0xC5, 0x9D, 0xD4, 0x34, 0x91, 0xE8, 0x38, 0x49, 0x0C, 0x44, 0xEC, 0x93, 0x44, 0x64, 0x43, 0x84,
-    0x67, 0xF0, 0x08, 0x03, 0xD2, 0x75, 0x58, 0xFA, 0x97, 0xD0, 0xDA, 0x0A, 0x89, 0xB7, 0x04, 0x56,
-    0x88, 0x77, 0x66, 0x75, 0xFE, 0x97, 0x16, 0xA1, 0x0A, 0xFE, 0xF8, 0x3D, 0xF5, 0xA2, 0xCA, 0x3D,
-    0xD9, 0x9F, 0xC4, 0x9B, 0x40, 0x9F, 0xC7, 0xDB, 0x41, 0x33, 0xA4, 0x11, 0xAF, 0xDC, 0x6E, 0x73,
-    0x47, 0x63, 0xAB, 0x96, 0x4D, 0x71, 0x78, 0x69, 0x60, 0xFA, 0xB7, 0x4F, 0x43, 0x7A, 0x1C, 0x9C,
-    0x8B, 0x91, 0x16, 0x6E, 0x86, 0x5A, 0x2E, 0xA4, 0x14, 0x47, 0xBD, 0x86, 0x6E, 0x2D, 0xAD, 0x14,
-    0x4E, 0x23, 0x52, 0x71, 0x9A, 0xB9, 0xBD, 0xED, 0x97, 0xA0, 0xB9, 0xA0, 0x2E, 0xBB, 0xDC, 0xAE,
-    0xB6, 0x3F, 0x40, 0xDC, 0x74, 0x80, 0x18, 0xF3, 0xA5, 0xF3, 0x8E, 0x49, 0xCC, 0xD7, 0x52, 0x59,
-    0x75, 0xCE, 0x44, 0x46, 0x82, 0x94, 0x4E, 0x4E, 0xD1, 0xD3, 0xE8, 0xD6, 0x72, 0x25, 0x86, 0xB9,
-    0xC4, 0x22, 0x99, 0x8F, 0x85, 0x4B, 0x1F, 0x04, 0xB2, 0x90, 0x24, 0xA8, 0xD5, 0xBF, 0x85, 0x63,
-    0x04, 0x95, 0x4B, 0x20, 0xBE, 0x0A, 0x51, 0x82, 0x35, 0x81, 0xE3, 0xCC, 0xB4, 0xA4, 0x9B, 0xDA,
-    0x14, 0xC4, 0x2C, 0x44, 0x7D, 0x3F, 0xA5, 0x49, 0xBA, 0x17, 0x84, 0x79, 0xA7, 0x57, 0x64, 0xA9,
-    0xE7, 0x9D, 0x2E, 0xF9, 0x56, 0x16, 0xF8, 0xDB, 0xA2, 0x51, 0xD8, 0x9F, 0x28, 0xFC, 0x27, 0xD9,
-    0x02, 0xD9, 0x2F, 0x2B, 0x15, 0x17, 0x64, 0x6F, 0xC4, 0xAA, 0x41, 0x45, 0xBA, 0x1F, 0xB4, 0xB0,
-    0x1B, 0xDB, 0x0B, 0xD6, 0x6A, 0x9C, 0xF9, 0x93, 0x64, 0xF8, 0x18, 0xC8, 0x68, 0x30, 0x00, 0x84,
-    0x16, 0xA5, 0x96, 0x12, 0x79, 0xB7, 0x6C, 0x0B, 0xBB, 0xEF, 0xAA, 0x90, 0x25, 0x31, 0x9F, 0x78,
-    0x70, 0x9A, 0x34, 0x0B, 0x18, 0x0F, 0x5A, 0x1F, 0xBE, 0xAC, 0x2E, 0xC0, 0x2A, 0xEB, 0x60, 0xF6,
-    0x52, 0x03, 0xCA, 0xD2, 0x22, 0xAC, 0x23, 0x80, 0xF5, 0x81, 0xEE, 0xB6, 0x2B, 0x7B, 0x59, 0x6A,
-    0xDE, 0xA8, 0x60, 0xAA, 0xC0, 0x55, 0x99, 0xC2, 0xAB, 0x3E, 0x79, 0x49, 0xAC, 0xC6, 0x71, 0x53,
-    0x88, 0x0C, 0xB7, 0x12, 0xF3, 0x9A, 0xDF, 0x2F, 0x85, 0x04, 0x5B, 0x35, 0x5C, 0x26, 0xA9, 0xDC,
-    0x6B, 0x6B, 0xCD, 0x7C, 0xF6, 0x45, 0x9D, 0xAA, 0xED, 0x37, 0x9E, 0x78, 0x0D, 0x4F, 0x11, 0x53,
-    0x1C, 0xA9, 0x66, 0x92, 0x1B, 0x26, 0x4E, 0x8B, 0x1A, 0xB5, 0x71, 0xFC, 0x26, 0xC4, 0x23, 0x4E,
-    0x6F, 0x9A, 0x43, 0x1F, 0xB0, 0x29, 0x9E, 0xFF, 0x78, 0x93, 0xCE, 0xCF, 0x64, 0x6A, 0x14, 0x80,
-    0x89, 0x99, 0xD9, 0xD1, 0x57, 0x53, 0x8E, 0x3C, 0x00, 0x4E, 0x09, 0xD5, 0x48, 0x99, 0x94, 0x64,
-    0xED, 0xA4, 0x9A, 0xCE, 0x4B, 0xFE, 0xC6, 0x7D, 0xC2, 0xF2, 0x6A, 0xC7, 0x34, 0x28, 0x1A, 0x04,
-    0x2F, 0x50, 0x8F, 0x97, 0xB5, 0xF8, 0x04, 0x6A, 0x5D, 0x68, 0x61, 0x3C, 0x4C, 0x2D, 0x70, 0x64,
-    0xB0, 0x18, 0xC5, 0x89, 0x0A, 0x5C, 0x74, 0x38, 0x91, 0x8C, 0x2B, 0x0E, 0xA7, 0xC7, 0x74, 0x0E,
-    0x8F, 0x7A, 0x4F, 0xF2, 0xD8, 0x98, 0x88, 0x0C, 0x34, 0x58, 0x72, 0x7F, 0x1A, 0x0E, 0x1A, 0x31,
-    0x7E, 0xDF, 0x88, 0xF5, 0xB3, 0xE7, 0x2A, 0xED, 0x0F, 0x0D, 0xCC, 0x77, 0x4A, 0xD7, 0x4F, 0xCF,
-    0xBE, 0x8B, 0x92, 0x21, 0x18, 0x10, 0x7B, 0x3D, 0xC5, 0x7B, 0x89, 0x76, 0x86, 0x15, 0x25, 0xE2,
-    0x32, 0x28, 0x5E, 0x0B, 0xC9, 0x01, 0xA2, 0x4B, 0xAC, 0x11, 0xF6, 0x9D, 0xD0, 0xC8, 0x4B, 0xA3,
-    0x2D, 0x7F, 0x0B, 0xD6, 0x92, 0xE5, 0xAC, 0xD6, 0x40, 0x38, 0x2B, 0xD1, 0x3B, 0xCB, 0x1A, 0x9C,
-    0x27, 0x13, 0x8E, 0x09, 0xBC, 0x7C, 0xB7, 0x59, 0xC8, 0xCA, 0xEE, 0x44, 0x1A, 0xC2, 0x59, 0xF9,
-    0x02, 0xC9, 0x65, 0x31, 0xDE, 0xB7, 0xC7, 0x10, 0xF3, 0x18, 0x21, 0x0A, 0x6D, 0x62, 0xE1, 0x16,
-    0xFD, 0x21, 0x6A, 0x41, 0xB1, 0x58, 0x50, 0x90, 0x0C, 0x98, 0xFA, 0x4A, 0x98, 0xD9, 0x43, 0xB4,
-    0x32, 0x88, 0xC6, 0xE3, 0x70, 0xE3, 0x46, 0x78, 0x8E, 0xCF, 0x4E, 0x73, 0xA4, 0xA1, 0xB3, 0x3E,
-    0xC5, 0x35, 0x4F, 0x39, 0x9F, 0x85, 0x0D, 0x30, 0xA5, 0xA0, 0x22, 0xFA, 0x0B, 0x5A, 0x34, 0x51,
-    0xAA, 0x68, 0xD2, 0xC6, 0xC6, 0xA1, 0xAB, 0x53, 0x0E, 0x8D, 0xBA, 0x0B, 0x46, 0x6E, 0x46, 0x4F,
-    0xB9, 0x62, 0x94, 0xAD, 0x2D, 0x07, 0x2E, 0xDE, 0xDB, 0xF3, 0xB3, 0x61, 0xA1, 0xC5, 0x77, 0x5C,
-    0xF4, 0x4D, 0x5E, 0x34, 0x6A, 0xCF, 0xD3, 0x54, 0xBB, 0xD2, 0x38, 0x8A, 0x5F, 0x60, 0x3D, 0x9E,
-    0x98, 0xCA, 0x32, 0xAF, 0xD5, 0x84, 0xA4, 0x9F, 0x69, 0xAC, 0x66, 0x54, 0x74, 0x39, 0xA9, 0x6E,
-    0xD9, 0x38, 0x68, 0x7F, 0x3C, 0xA5, 0x71, 0x16, 0xD3, 0xB7, 0xBE, 0xBD, 0xBE, 0x3B, 0xBD, 0xDE,
-    0xCC, 0x6A, 0x06, 0x48, 0x21, 0x06, 0xF1, 0x29, 0x42, 0x50, 0x62, 0x7D, 0xEA, 0xBD, 0x3E, 0xE2,
-    0x54, 0xFC, 0xF4, 0xB1, 0xA9, 0x8C, 0x88, 0xAB, 0x1F, 0x32, 0xAF, 0x11, 0xD2, 0x8A, 0x07, 0x7B,
-    0x05, 0x90, 0xAD, 0xC4, 0x1A, 0xD2, 0xDD, 0x0E, 0xE8, 0x95, 0xFA, 0x3D, 0xDC, 0xA5, 0x68, 0xF5,
-    0x9E, 0x08, 0x98, 0xA7, 0x69, 0x40, 0x36, 0x1A, 0x8A, 0x8A, 0xF8, 0xAC, 0xF3, 0xBD, 0xD7, 0x23,
-    0xE0, 0xFD, 0x96, 0x95, 0xE5, 0x2E, 0x55, 0x7F, 0x0A, 0x09, 0x91, 0x76, 0x75, 0x0F, 0x7A, 0x47,
-    0x76, 0xA6, 0x1F, 0x49, 0x7F, 0xCA, 0x54, 0x1A, 0x49, 0xB5, 0x36, 0x86, 0x6F, 0xFF, 0xE7, 0x39,
-    0xAD, 0x2A, 0x20, 0xF3, 0x94, 0x0A, 0x17, 0x46, 0x75, 0xED, 0x12, 0xD3, 0x25, 0x6D, 0x25, 0x29,
-    0x79, 0x63, 0xBB, 0xD0, 0xB6, 0x4C, 0x5C, 0xC8, 0x0A, 0x07, 0x99, 0x71, 0x06, 0x31, 0x67, 0x85,
-    0x2C, 0xD9, 0x6C, 0x7A, 0xF9, 0xB2, 0xA4, 0x64, 0xA1, 0x44, 0x00, 0x16, 0x2F, 0x9E, 0x3E, 0xE6,
-    0xA7, 0x4B, 0x57, 0x5F, 0x9B, 0x88, 0x4F, 0x3D, 0xA9, 0xDE, 0xAF, 0x8E, 0x96, 0x59, 0xA5, 0x2F,
-    0xDD, 0xC2, 0x61, 0xED, 0xA3, 0x8F, 0xB6, 0x87, 0x36, 0xD3, 0x54, 0x29, 0x74, 0x4A, 0xBB, 0x0D,
-    0x46, 0xBA, 0xF6, 0xD4, 0x8C, 0x10, 0x6F, 0xFC, 0x04, 0xC8, 0x18, 0x53, 0x17, 0x68, 0x1A, 0x49,
-    0x59, 0xBF, 0xBF, 0xA1, 0xD7, 0x3A, 0xC8, 0x60, 0xDC, 0x2F, 0xAA, 0xAC, 0x16, 0x09, 0x25, 0xA9,
-    0xB3, 0x4A, 0x0C, 0x0A, 0x49, 0x95, 0x94, 0x32, 0x46, 0x71, 0x1E, 0xB1, 0x24, 0x4F, 0x97, 0x3E,
-    0x6E, 0x3C, 0x76, 0x8A, 0x28, 0x99, 0x45, 0x0A, 0x9B, 0x62, 0x8D, 0x3D, 0x1E, 0x33, 0xB7, 0xC5,
-    0xD6, 0xBE, 0x51, 0xB8, 0x3B, 0xCB, 0x5A, 0x83, 0x53, 0x80, 0x17, 0xCA, 0xD6, 0x98, 0xC2, 0x17,
-    0x8E, 0x01, 0x71, 0x51, 0x2E, 0x55, 0x78, 0x53, 0xF6, 0x2A, 0x44, 0x56, 0x52, 0x18, 0x5B, 0xF6,
-    0xEF, 0x78, 0x76, 0xB8, 0x7C, 0x03, 0x25, 0x78, 0x11, 0xAE, 0x21, 0x21, 0x5B, 0x01, 0x92, 0x5E,
-    0x47, 0x61, 0xEB, 0xC4, 0x06, 0xF3, 0xCA, 0x3E, 0x74, 0x7A, 0x80, 0x5A, 0xCD, 0x03, 0x17, 0xED,
-    0x1A, 0xFE, 0xDC, 0x21, 0xB9, 0x7A, 0x3A, 0xB7, 0x16, 0xED, 0x89, 0x8D, 0xAD, 0x39, 0xC5, 0x12,
-    0x8E, 0x91, 0x83, 0x7F, 0x71, 0x68, 0x86, 0x36, 0x99, 0xD2, 0x1F, 0x11, 0xC3, 0xFD, 0x1E, 0x48,
-    0x1C, 0x17, 0xD1, 0x62, 0x27, 0xED, 0xF5, 0xCE, 0x67, 0x87, 0xA3, 0x6F, 0xFD, 0x21, 0xE8, 0x96,
-    0x24, 0x3F, 0x76, 0xDE, 0x10, 0xB0, 0x1E, 0x48, 0xD4, 0xB8, 0xF7, 0x5B, 0x5E, 0xB9, 0x2B, 0xD2,
-    0x11, 0xFF, 0x52, 0x95, 0x1D, 0x68, 0xD6, 0x49, 0xBB, 0x81, 0x54, 0xB7, 0x43, 0xC6, 0x6F, 0xAD,
-    0x54, 0xEB, 0x61, 0x9A, 0xDF, 0xE8, 0xBA, 0xF6, 0x56, 0xBA, 0xB4, 0x83, 0x41, 0x3C, 0x61, 0xFB,
-    0x05, 0xFD, 0x2F, 0x0B, 0xFC, 0x3F, 0xC1, 0x72, 0x7F, 0x12, 0xA2, 0x78, 0x2A, 0xA4, 0x4B, 0x18,
-    0x82, 0x96, 0x55, 0x37, 0x63, 0xB8, 0x11, 0xA2, 0x25, 0xFD, 0x52, 0x23, 0x27, 0x7F, 0xCD, 0x4B,
-    0x1F, 0x3F, 0xF2, 0xF5, 0xFF, 0xD5, 0x7B, 0xB7, 0xE1, 0xBD, 0x33, 0x27, 0x76, 0x76, 0x76, 0x66,
-    0x21, 0xA6, 0xE6, 0xA9, 0xE7, 0xF7, 0x21, 0x04, 0xFE, 0x1B, 0xAF, 0xFC, 0xBD, 0x23, 0x06, 0xF0,
-    0x61, 0xF1, 0xF6, 0x8D, 0x0E, 0xA8, 0x0F, 0xC5, 0x50, 0x48, 0x17, 0x1E, 0x20, 0xC1, 0xA3, 0x84,
-    0x1F, 0x88, 0xD5, 0x79, 0x08, 0x59, 0x15, 0x0C, 0x17, 0x48, 0xCD, 0x7D, 0x5C, 0x3D, 0xDF, 0x42,
-    0x0F, 0xA4, 0xD5, 0xD2, 0x8B, 0xC7, 0xB4, 0xF3, 0x2B, 0xE7, 0x05, 0x8B, 0x0E, 0xD7, 0x31, 0x54,
-    0x1A, 0x5B, 0xD8, 0x37, 0xA5, 0x5A, 0xB5, 0xD8, 0xF2, 0xEA, 0x59, 0xF6, 0xFB, 0xD1, 0xED, 0x46,
-    0xE1, 0x25, 0x97, 0x39, 0xEF, 0xED, 0x69, 0x28, 0x98, 0x27, 0xD5, 0x26, 0x3C, 0x44, 0xF4, 0x22,
-    0xCE, 0x12, 0x91, 0xA0, 0x05, 0x6B, 0x83, 0x67, 0xC4, 0xB6, 0x74, 0x7C, 0xD3, 0x39, 0xE9, 0x4B,
-    0xCC, 0x4A, 0x92, 0x4A, 0xB8, 0x7F, 0x85, 0x6F, 0x8A, 0x28, 0xCA, 0xCE, 0xBD, 0x56, 0x72, 0x97,
-    0x8D, 0xF1, 0x40, 0x9F, 0x6A, 0x64, 0x58, 0x9A, 0x05, 0x6B, 0x1D, 0xCB, 0x3A, 0xC6, 0xE1, 0x01,
-    0xFC, 0x42, 0x3D, 0xC4, 0x6C, 0xBC, 0x4F, 0xCA, 0x03, 0xC3, 0x02, 0xE6, 0x8F, 0x90, 0x6E, 0x76,
-    0xF5, 0x37, 0x68, 0x89, 0xFC, 0x5A, 0x52, 0x71, 0xC2, 0xEA, 0xB0, 0x72, 0xF9, 0xF1, 0x71, 0xEB,
-    0xBA, 0x95, 0xB0, 0xF7, 0x29, 0x63, 0x41, 0xA4, 0x23, 0x12, 0xE7, 0xAD, 0x46, 0x17, 0xFD, 0xAB,
-    0x1B, 0x3C, 0xA7, 0x3E, 0xB1, 0x73, 0x8E, 0x2D, 0xB8, 0x9C, 0x36, 0x50, 0x0D, 0xA8, 0xF6, 0xA0,
-    0xC1, 0x91, 0x27, 0x6D, 0xF9, 0x84, 0x1C, 0xC3, 0xB1, 0x4A, 0x6C, 0xDA, 0x25, 0x97, 0x1C, 0xD1,
-    0x8C, 0xF2, 0xA4, 0x3C, 0x65, 0x9E, 0xE6, 0xEA, 0xAF, 0xA5, 0xC4, 0xF1, 0x27, 0x24, 0xAB, 0xF9,
-    0x65, 0x94, 0x7E, 0x5D, 0x17, 0x7C, 0x28, 0xB1, 0x6E, 0xDF, 0xCB, 0xCE, 0x5A, 0x7B, 0x95, 0x66,
-    0xEF, 0x5B, 0x2E, 0xF7, 0x26, 0x9E, 0x95, 0x8C, 0x1E, 0x13, 0xCB, 0x58, 0xE4, 0x2C, 0x26, 0x39,
-    0xAA, 0x5C, 0x8E, 0xA4, 0xD8, 0x4F, 0xFD, 0xE3, 0xC8, 0xB2, 0x99, 0x17, 0x2F, 0x0E, 0xA4, 0x8E,
-    0xE7, 0x54, 0xDE, 0x27, 0xFA, 0x53, 0x2C, 0xB1, 0x53, 0x7F, 0xD0, 0x70, 0x6C, 0x38, 0x68, 0xDC,
-    0x7F, 0x33, 0x7F, 0xC9, 0x2B, 0xF6, 0x37, 0x19, 0xFF, 0xF7, 0xE6, 0xAB, 0xE6, 0xBE, 0xFD, 0xFC,
-    0x67, 0x87, 0xFC, 0x11, 0x74, 0x29, 0x57, 0x44, 0x39, 0x72, 0xF2, 0x72, 0x68, 0xDB, 0x67, 0xCC,
-    0xCA, 0x71, 0xFF, 0x2B, 0x4F, 0xBB, 0x60, 0xF5, 0xA7, 0xA7, 0xA8, 0xF5, 0xFB, 0xFB, 0xF3, 0x47,
-    0xC2, 0xB7, 0xDE, 0x98, 0xAC, 0x63, 0xA1, 0x78, 0x0D, 0xA6, 0x5A, 0x55, 0x4F, 0x49, 0x0C, 0xFD,
-    0xD3, 0x6C, 0xC9, 0xD4, 0x7E, 0xFC, 0x57, 0x1A, 0xA1, 0xDB, 0xFE, 0xC4, 0x33, 0x7D, 0x6D, 0x16,
-    0xD6, 0xBE, 0xB8, 0x79, 0xF4, 0xDC, 0x2D, 0xD2, 0xC5, 0x34, 0x77, 0xF3, 0x5C, 0x54, 0x7F, 0x16,
-    0x1C, 0x32, 0x2F, 0x4C, 0x32, 0x2B, 0x5D, 0xB2, 0xA6, 0xA6, 0xC4, 0xEE, 0x36, 0x97, 0xA6, 0xFA,
-    0x42, 0x5E, 0x23, 0x0E, 0x1F, 0x97, 0x17, 0x90, 0x39, 0xC9, 0xEA, 0xAA, 0x94, 0x2F, 0x10, 0xE3,
-    0xD9, 0xAC, 0xDE, 0x7E, 0x32, 0x95, 0x9B, 0x30, 0x51, 0x35, 0x09, 0xF1, 0xF2, 0xD0, 0xFF, 0x20,
-    0x9D, 0xB9, 0x2F, 0xA3, 0xFF, 0xD5, 0x19, 0x92, 0xED, 0x3B, 0xE9, 0xF0, 0xD2, 0xA8, 0xEA, 0xB3,
-    0x2A, 0xB7, 0x3D, 0xE2, 0x28, 0xE0, 0xAB, 0xEF, 0xB4, 0x5B, 0x31, 0xBB, 0x1D, 0xF9, 0xEE, 0x7D,
-    0xFE, 0xF9, 0x77, 0x32, 0x2B, 0x12, 0x69, 0x27, 0x83, 0xDC, 0x4E, 0x7A, 0x8D, 0x88, 0x88, 0x71,
-    0x39, 0xD5, 0x2D, 0x83, 0xF9, 0x80, 0x2F, 0x09, 0xD5, 0x38, 0x12, 0x20, 0xF4, 0xCA, 0x2C, 0x9A,
-    0xD9, 0x1C, 0xB5, 0xB3, 0x39, 0xFA, 0x43, 0xF7, 0xAE, 0xF3, 0x5A, 0x33, 0x33, 0xFC, 0x99, 0x19,
-    0x7E, 0xFE, 0xA8, 0x1E, 0xFE, 0x96, 0xF9, 0x9A, 0xEA, 0x54, 0x89, 0xE4, 0xD0, 0xA9, 0x50, 0x4D,
-    0x0A, 0x5A, 0x69, 0xC6, 0x44, 0xBA, 0x7F, 0x21, 0x75, 0x5A, 0x6B, 0x85, 0xD5, 0x7A, 0x31, 0x1F,
-    0xB7, 0x49, 0xA2, 0x7C, 0xBD, 0xE0, 0x96, 0x1B, 0xE8, 0x62, 0x5D, 0x2F, 0x65, 0xED, 0xEB, 0x76,
-    0x29, 0xE3, 0xC1, 0x7A, 0xCA, 0xB8, 0x79, 0x08, 0x52, 0xC6, 0xC3, 0x7C, 0x5E, 0x59, 0x4C, 0xDF,
-    0x3B, 0x5B, 0x2B, 0x73, 0xDF, 0xCF, 0x63, 0x1A, 0x39, 0xC4, 0x12, 0xD1, 0xF7, 0xC7, 0x49, 0x0C,
-    0x12, 0xE8, 0x23, 0x85, 0x48, 0x24, 0xE8, 0xD4, 0xBB, 0xAD, 0x84, 0xE1, 0x5A, 0x56, 0x41, 0xA4,
-    0x7E, 0x8B, 0xC7, 0x55, 0x0A, 0x68, 0xD2, 0x6B, 0xF8, 0xB2, 0x6B, 0xD4, 0x6B, 0xA9, 0x3D, 0x49,
-    0xB5, 0x9D, 0xB5, 0xDE, 0xAC, 0x95, 0x2A, 0xEF, 0xA8, 0x63, 0xC9, 0xC1, 0x4B, 0xE2, 0x8C, 0x73,
-    0x87, 0xCD, 0x98, 0x07, 0x30, 0x44, 0x69, 0xBD, 0xB4, 0xE6, 0x7E, 0xD1, 0x6B, 0xED, 0xA2, 0xB1,
-    0x54, 0xE6, 0xBC, 0x92, 0x90, 0x54, 0xB1, 0x71, 0xED, 0x58, 0x43, 0xE8, 0x27, 0xD7, 0xF8, 0xCA,
-    0x9F, 0x7C, 0xC0, 0xB2, 0xFE, 0x7B, 0x96, 0x05, 0xEA, 0x7D, 0xA9, 0x71, 0x8B, 0xAD, 0x60, 0x2F,
-    0x23, 0xD0, 0x3D, 0x90, 0x30, 0x44, 0x59, 0x09, 0xD5, 0x9D, 0x4B, 0x6B, 0xD6, 0xB3, 0x53, 0xA8,
-    0x4E, 0xB0, 0x99, 0xF7, 0x1B, 0xA8, 0xC0, 0xFD, 0x5D, 0xD8, 0x79, 0xED, 0x0B, 0xBC, 0x66, 0xB5,
-    0xC2, 0x3D, 0x42, 0x82, 0xDD, 0x8C, 0x14, 0xD8, 0xB4, 0x9C, 0xD2, 0x7C, 0xFB, 0xB6, 0xFE, 0x43,
-    0xBE, 0xB2, 0x5E, 0x61, 0xE1, 0x5F, 0xE5, 0x3B, 0x90, 0x34, 0x44, 0x77, 0x1B, 0x76, 0xF9, 0x5D,
-    0x7E, 0x8A, 0xB7, 0x90, 0xE4, 0xE7, 0xEA, 0x04, 0xAA, 0x2B, 0x99, 0x0B, 0xB3, 0x83, 0x05, 0x1E,
-    0x59, 0xEB, 0xF3, 0x49, 0x7B, 0x90, 0x3A, 0x23, 0xD3, 0xB7, 0xF7, 0xF6, 0xD2, 0x59, 0xCC, 0xED,
-    0xF9, 0x31, 0xAF, 0xED, 0x8A, 0x4B, 0x75, 0x5B, 0x48, 0xC6, 0x09, 0x92, 0xE2, 0x02, 0xFB, 0xD1,
-    0xDE, 0x6B, 0x8B, 0xD1, 0x27, 0xF8, 0xD9, 0x35, 0xE8, 0xA8, 0x3F, 0xD6, 0x2B, 0x5D, 0x2B, 0x5A,
-    0x2A, 0xE6, 0xDE, 0xB1, 0x01, 0x8F, 0x4E, 0x4A, 0xA4, 0x57, 0xA2, 0xF1, 0x45, 0x48, 0xFF, 0xD4,
-    0xDD, 0x40, 0x0F, 0xDA, 0x29, 0x5D, 0xAE, 0x54, 0x1F, 0xB8, 0x04, 0x80, 0x04, 0xEC, 0xB0, 0xCE,
-    0xB9, 0x9F, 0x09, 0x54, 0xC6, 0x08, 0x6D, 0x28, 0x2D, 0xC2, 0xCF, 0xB6, 0xD3, 0xE3, 0x36, 0xED,
-    0x9B, 0xD8, 0x30, 0x12, 0x31, 0x75, 0xF6, 0x1E, 0xB6, 0xFA, 0xB1, 0xEA, 0xC5, 0x7A, 0x5D, 0x57,
-    0x94, 0x54, 0xCB, 0x24, 0x0F, 0xAB, 0x8E, 0x1A, 0x14, 0xCC, 0x76, 0xCD, 0x62, 0x6C, 0xF4, 0x56,
-    0x99, 0x95, 0xC0, 0xF2, 0xE6, 0x93, 0x0C, 0x85, 0xD1, 0x60, 0x18, 0x19, 0x0C, 0x23, 0xA3, 0x61,
-    0x64, 0x20, 0xE6, 0x60, 0x29, 0x60, 0x91, 0x9A, 0x31, 0x2E, 0xEF, 0x48, 0x70, 0xF3, 0x07, 0x4A,
-    0xD2, 0x70, 0x24, 0xD3, 0x4D, 0x09, 0x5E, 0xAA, 0x03, 0xEC, 0x4B, 0x0E, 0x5B, 0x00, 0xD0, 0x63,
-    0xEF, 0x50, 0x61, 0xAD, 0x76, 0xE5, 0x84, 0x41, 0x02, 0x6A, 0xA7, 0xBF, 0x2F, 0x65, 0x66, 0x96,
-    0x1C, 0x04, 0xD2, 0xA0, 0xF2, 0x3C, 0x9C, 0xD1, 0x0E, 0xA8, 0xAF, 0xC4, 0xE9, 0x7A, 0xEE, 0xE0,
-    0x84, 0x1C, 0xCE, 0xF0, 0x02, 0x36, 0x5E, 0x56, 0x76, 0x0B, 0xD4, 0x62, 0x0D, 0xB4, 0x6A, 0xA3,
-    0x84, 0x70, 0x49, 0x4F, 0xB7, 0xCE, 0xAC, 0x67, 0x10, 0x69, 0x4B, 0xB4, 0x27, 0xC0, 0x61, 0x3E,
-    0x0B, 0xB4, 0x9E, 0x1C, 0xEC, 0xF3, 0xEA, 0x26, 0x21, 0x3C, 0x63, 0x26, 0x62, 0x03, 0xC2, 0x53,
-    0x8F, 0x89, 0xB0, 0x12, 0x3F, 0x38, 0x92, 0xC0, 0x91, 0x54, 0x70, 0x0C, 0x0B, 0xE6, 0x34, 0x47,
-    0x5B, 0x6A, 0xA4, 0x76, 0xA3, 0x29, 0x52, 0x0B, 0xCE, 0x5F, 0xA4, 0x9D, 0x80, 0x90, 0xA8, 0x8A,
-    0xB5, 0x91, 0x04, 0x95, 0x35, 0xA2, 0x7E, 0xB7, 0x87, 0x1A, 0x0D, 0xA3, 0x04, 0x11, 0xF5, 0x88,
-    0xEB, 0xDA, 0x30, 0x49, 0xE1, 0xEA, 0xE7, 0x31, 0x52, 0x80, 0x48, 0xB3, 0xCA, 0x59, 0xC5, 0x5B,
-    0xDA, 0xE6, 0x54, 0xC4, 0x75, 0x7F, 0x4D, 0xF8, 0xE3, 0xE6, 0xB7, 0xD9, 0x14, 0xCE, 0xCE, 0x87,
-    0x0A, 0x95, 0xB5, 0x1B, 0xF1, 0x2F, 0x5D, 0x61, 0x6C, 0x25, 0x42, 0x54, 0xD2, 0x78, 0x78, 0x7A,
-    0x4C, 0x98, 0x2F, 0xD2, 0x7D, 0x4A, 0x0F, 0x15, 0x23, 0x45, 0x99, 0x34, 0x92, 0x40, 0xED, 0x37,
-    0x49, 0x93, 0x68, 0xE1, 0xD9, 0xE2, 0x66, 0xEF, 0x5C, 0x2A, 0x2A, 0x4F, 0x14, 0xF4, 0x37, 0x29,
-    0x88, 0x66, 0xEB, 0x44, 0x8C, 0xBB, 0xEC, 0x9C, 0x45, 0xCD, 0x61, 0xF8, 0x44, 0x1B, 0xD5, 0xA8,
-    0xF8, 0x19, 0x88, 0x20, 0x61, 0xE3, 0x83, 0x9C, 0x79, 0x88, 0xE4, 0x1C, 0x78, 0x46, 0xA5, 0xA7,
-    0x2B, 0x59, 0x1B, 0x8D, 0xD4, 0x6C, 0x94, 0xF7, 0xB0, 0x70, 0x64, 0x71, 0x18, 0xA1, 0xAD, 0xAC,
-    0xBC, 0xAF, 0x6F, 0x07, 0x5A, 0x5C, 0x8C, 0xCD, 0xCC, 0xDF, 0xCB, 0x11, 0xF3, 0x26, 0x85, 0xE2,
-    0xAD, 0x11, 0x3B, 0x75, 0x97, 0xD8, 0x53, 0xEA, 0xE3, 0xDA, 0xE2, 0x28, 0x40, 0x30, 0xD2, 0x2A,
-    0x63, 0xFF, 0x16, 0xD7, 0x39, 0xC9, 0x76, 0xB9, 0xA4, 0x49, 0xF8, 0x71, 0xF3, 0xF4, 0x12, 0x31,
-    0x58, 0x1E, 0x9F, 0x5F, 0x11, 0xA8, 0xDF, 0x6E, 0x45, 0x08, 0x86, 0xF5, 0x7C, 0x60, 0x45, 0xAE,
-    0x8D, 0x03, 0x1B, 0x88, 0xAB, 0xF1, 0x63, 0x7B, 0x39, 0x57, 0xB9, 0x52, 0x03, 0x2D, 0x3F, 0xB6,
-    0x85, 0x8B, 0x00, 0xC3, 0x22, 0x8E, 0x06, 0x8D, 0x00, 0x4B, 0x10, 0x01, 0xA6, 0x75, 0x0B, 0xB1,
-    0x38, 0x50, 0x5F, 0x25, 0x5B, 0x61, 0x61, 0x4A, 0xAD, 0x5D, 0x8B, 0x6E, 0x10, 0x11, 0x43, 0xC7,
-    0x02, 0xDB, 0xD3, 0x68, 0x20, 0xCC, 0xCB, 0x69, 0xC1, 0x8B, 0x51, 0x1D, 0xBE, 0xEA, 0x90, 0x0B,
-    0x87, 0x44, 0xE7, 0xDB, 0x20, 0xBF, 0x33, 0x7A, 0x62, 0x0E, 0x8C, 0x16, 0x1E, 0x0B, 0xED, 0xB3,
-    0x34, 0x07, 0x52, 0x10, 0x25, 0x81, 0x97, 0x5C, 0x27, 0x07, 0xED, 0x76, 0xA3, 0x06, 0x17, 0x04,
-    0xC5, 0xB8, 0xE3, 0x26, 0x5A, 0xA8, 0x4F, 0xA8, 0x9B, 0x7A, 0x20, 0x46, 0x2E, 0x36, 0xC3, 0x1E,
-    0x71, 0xDC, 0x04, 0xA9, 0x09, 0xA8, 0xBF, 0x97, 0xC7, 0x29, 0xFC, 0xFC, 0xB9, 0xC4, 0x50, 0xA1,
-    0xAD, 0xC4, 0x55, 0xC3, 0x66, 0x12, 0x3E, 0x49, 0x63, 0x85, 0x98, 0x3D, 0x84, 0x09, 0x22, 0x65,
-    0xF0, 0xAD, 0x99, 0x5E, 0x27, 0x5E, 0x4A, 0x71, 0x57, 0x2D, 0xA7, 0xDC, 0x09, 0x5F, 0xF7, 0xEC,
-    0xA4, 0x42, 0x7E, 0xE9, 0x07, 0x9F, 0x36, 0xB0, 0x86, 0x7A, 0x79, 0x92, 0xB7, 0x3B, 0x4E, 0x01,
-    0x2A, 0x52, 0x0E, 0x73, 0x83, 0xC5, 0xBC, 0xE6, 0x12, 0x8C, 0xDC, 0xB5, 0x40, 0x4C, 0xD0, 0xED,
-    0x98, 0x6C, 0x5E, 0x8C, 0x22, 0x36, 0x1A, 0x76, 0x92, 0xA1, 0x8A, 0x55, 0xD8, 0xCD, 0xC2, 0xB5,
-    0x3D, 0x39, 0x31, 0x71, 0xC9, 0xB2, 0x5C, 0xCB, 0x36, 0x52, 0x54, 0xF1, 0xFE, 0x8F, 0xA0, 0x09,
-    0x9D, 0xCF, 0xF6, 0x43, 0x4F, 0xE2, 0x46, 0x7D, 0x09, 0x2A, 0x0D, 0x24, 0x42, 0x8B, 0xE5, 0x58,
-    0x14, 0x1D, 0x01, 0x78, 0x46, 0x80, 0xC4, 0x69, 0x7D, 0xDC, 0x4E, 0x71, 0x2C, 0xF4, 0x9B, 0x06,
-    0xA3, 0xCA, 0x21, 0x0A, 0x88, 0xA4, 0xF0, 0x9C, 0xCF, 0x07, 0x41, 0xCB, 0x88, 0x55, 0xCE, 0x5D,
-    0x88, 0xB2, 0x27, 0xA1, 0x66, 0x08, 0xE6, 0x6A, 0xE1, 0xCF, 0xCD, 0xE4, 0xC8, 0x12, 0x39, 0x44,
-    0x21, 0x97, 0x43, 0x14, 0x72, 0xE7, 0xC3, 0x50, 0xAD, 0x5E, 0xFD, 0xE9, 0xBE, 0xDA, 0xF8, 0xD7,
-    0x80, 0x39, 0x02, 0x78, 0x12, 0x9C, 0xC6, 0xC9, 0xB2, 0xD6, 0xEA, 0x31, 0x0D, 0x8B, 0x03, 0x88,
-    0xC2, 0x7E, 0xFD, 0xF4, 0x14, 0x88, 0xA6, 0x75, 0x98, 0xAB, 0x53, 0x02, 0xE4, 0xFD, 0x6E, 0x69,
-    0x00, 0xF3, 0x20, 0x6F, 0x2B, 0xF1, 0x4E, 0xEF, 0xB9, 0xB3, 0x22, 0x60, 0xCD, 0xAA, 0xE4, 0x35,
-    0x51, 0xFF, 0x50, 0xCE, 0x5D, 0xE2, 0x5B, 0x2F, 0x11, 0x9D, 0xC7, 0xDB, 0x9A, 0x1F, 0xEB, 0x89,
-    0xC6, 0xE7, 0x82, 0x8F, 0x03, 0xBB, 0xE6, 0x9D, 0x4B, 0xD6, 0x40, 0x7C, 0x74, 0x74, 0x0C, 0x62,
-    0x87, 0x63, 0x8E, 0x63, 0x21, 0x52, 0xCC, 0xE5, 0x91, 0x98, 0xDD, 0x22, 0x3A, 0xFD, 0xBD, 0x06,
-    0x21, 0x7F, 0xE9, 0xAB, 0x0C, 0x4E, 0x71, 0x27, 0xFE, 0x9A, 0x45, 0x33, 0xCF, 0xBE, 0x93, 0x63,
-    0x1E, 0xDE, 0x79, 0x19, 0xDD, 0x7D, 0xE7, 0x15, 0xF0, 0xE9, 0x77, 0xBE, 0x8B, 0x77, 0x78, 0xE7,
-    0x32, 0xDE, 0xE8, 0x7A, 0x6F, 0x5C, 0xD1, 0x4D, 0x64, 0x17, 0x77, 0xF2, 0xD9, 0x20, 0x57, 0x62,
-    0xC6, 0xDE, 0xF9, 0x13, 0x4C, 0xD5, 0x3B, 0xAF, 0x80, 0x1B, 0xBD, 0xF3, 0x12, 0xC4, 0x80, 0xBF,
-    0x4E, 0x6D, 0xEB, 0xA2, 0x0B, 0xC1, 0x51, 0x34, 0xE2, 0x9F, 0xCB, 0xF8, 0xB0, 0xD4, 0x5D, 0xC9,
-    0xC4, 0xF5, 0x52, 0x62, 0xB3, 0x57, 0x8D, 0x4D, 0x42, 0xE2, 0x65, 0x3A, 0x84, 0xEF, 0x12, 0xCD,
-    0x63, 0x72, 0xD4, 0x85, 0x74, 0x97, 0x0F, 0xDE, 0x46, 0x3F, 0x3F, 0xF8, 0x11, 0xFA, 0xF9, 0xC1,
-    0xBB, 0x58, 0x75, 0x1F, 0x48, 0x2C, 0xF4, 0x2D, 0x17, 0x2D, 0x99, 0xCB, 0x3C, 0xB4, 0xF2, 0x19,
-    0xBA, 0xFB, 0xC1, 0xF5, 0x41, 0xBE, 0x80, 0xEE, 0x7E, 0xF0, 0x27, 0xF3, 0x53, 0x3A, 0x58, 0x87,
-    0x41, 0x74, 0x67, 0x21, 0xD3, 0x9F, 0x40, 0x00, 0x64, 0xB2, 0x71, 0x17, 0xFB, 0x81, 0x3E, 0x7B,
-    0x49, 0xAA, 0x12, 0xBE, 0xF2, 0x80, 0xEC, 0x07, 0x94, 0x88, 0xF7, 0x8A, 0x66, 0x3D, 0x45, 0xF1,
-    0x77, 0x5D, 0xC2, 0xCA, 0x3C, 0x53, 0x31, 0x1B, 0x8B, 0xDD, 0xAE, 0xE6, 0xE2, 0x53, 0xC5, 0xFB,
-    0x01, 0x52, 0xBF, 0xE8, 0xFA, 0xD0, 0x09, 0xAB, 0x45, 0x7F, 0x15, 0x63, 0xB6, 0xBE, 0x1F, 0xD2,
-    0xE3, 0xF7, 0x83, 0xD5, 0xFD, 0x20, 0xF2, 0x9F, 0xEE, 0x87, 0x4C, 0xF6, 0x83, 0x44, 0x99, 0x4F,
-    0x87, 0xA6, 0xA4, 0x22, 0xA0, 0x95, 0xD8, 0x78, 0xB2, 0x1F, 0x8C, 0xEE, 0x87, 0x93, 0x92, 0xB3,
-    0x55, 0x9B, 0xDD, 0x0A, 0x90, 0x3E, 0xCE, 0x3E, 0x2A, 0x98, 0xBC, 0x35, 0x19, 0x13, 0x78, 0x12,
-    0x33, 0xAE, 0xB2, 0x63, 0x3A, 0x36, 0xD5, 0x15, 0x86, 0x34, 0xD6, 0x7F, 0xC5, 0x90, 0x96, 0xF7,
-    0x8B, 0x0C, 0xC5, 0x2C, 0x24, 0x21, 0x1F, 0x04, 0x45, 0xB4, 0xC8, 0x1A, 0x51, 0xBC, 0xB3, 0x46,
-    0xB6, 0x52, 0xA6, 0x42, 0x85, 0x33, 0x51, 0x64, 0x22, 0x50, 0x70, 0xD8, 0x69, 0xAF, 0xD7, 0x5B,
-    0x81, 0x22, 0xF7, 0x65, 0x7A, 0x0E, 0x1C, 0xDD, 0x57, 0x4E, 0xEE, 0x6A, 0xC4, 0x25, 0x40, 0x10,
-    0x16, 0xF3, 0xAC, 0x91, 0xB8, 0xFD, 0xAC, 0x15, 0x12, 0x6B, 0x21, 0x3C, 0xA0, 0x42, 0x03, 0xBB,
-    0x2D, 0x50, 0xA9, 0xC1, 0x45, 0x23, 0x9C, 0x96, 0x9A, 0x2E, 0x4B, 0xA9, 0x15, 0x91, 0x27, 0x5C,
-    0x0E, 0x82, 0xEB, 0xEA, 0x64, 0xE6, 0x22, 0xEB, 0x6C, 0xED, 0x6F, 0x10, 0xE7, 0xCC, 0x20, 0x1C,
-    0x9D, 0xE7, 0x7E, 0x94, 0xF0, 0x54, 0x34, 0x62, 0x31, 0xC8, 0xA4, 0x24, 0x3C, 0xF5, 0xB7, 0x9B,
-    0x55, 0xB6, 0x20, 0x78, 0x4B, 0x8F, 0x8F, 0x52, 0xEF, 0xE6, 0xF4, 0x1E, 0x91, 0x75, 0xEF, 0x93,
-    0xCA, 0x78, 0xE0, 0x3D, 0xF8, 0xA0, 0x28, 0xAC, 0xC3, 0x0E, 0x85, 0xE0, 0x63, 0x28, 0x41, 0x25,
-    0xA0, 0xEE, 0x83, 0x42, 0x8F, 0xB9, 0x75, 0xE5, 0xAD, 0xDD, 0x91, 0xBA, 0xBA, 0x87, 0x34, 0x0A,
-    0xE9, 0x93, 0x42, 0x09, 0x05, 0x9F, 0xE0, 0xA7, 0xBD, 0x5F, 0xAD, 0x07, 0x9D, 0x48, 0xFF, 0x02,
-    0x18, 0xCF, 0xC6, 0xA3, 0x7A, 0x4B, 0x07, 0x95, 0xEB, 0x95, 0xEB, 0x9E, 0xEE, 0x70, 0x03, 0x3A,
-    0x63, 0x55, 0xB0, 0x09, 0xF3, 0x49, 0x76, 0x27, 0x89, 0xA0, 0x52, 0xE0, 0xB3, 0x6E, 0x2D, 0xBA,
-    0x85, 0x1E, 0xC9, 0xA9, 0x01, 0x19, 0x47, 0x80, 0xFD, 0x9D, 0x62, 0xAC, 0x4B, 0x8B, 0xD0, 0xE5,
-    0xE6, 0x0E, 0x5F, 0x50, 0x80, 0x5B, 0xD3, 0x5B, 0x79, 0x38, 0x6E, 0x78, 0xFE, 0x74, 0x79, 0x23,
-    0x01, 0xB1, 0x1E, 0x7D, 0x28, 0x60, 0xB9, 0x06, 0x82, 0x75, 0xE0, 0xA6, 0x78, 0x1C, 0x1B, 0x39,
-    0x43, 0xE9, 0xA4, 0xDD, 0xE7, 0x12, 0x7F, 0x18, 0xCD, 0xB0, 0xD2, 0x61, 0x0D, 0x1C, 0xE2, 0x1F,
-    0x42, 0xBC, 0xD4, 0x0D, 0xBD, 0xB9, 0x2D, 0xA2, 0x91, 0xFF, 0x33, 0xE4, 0x6E, 0xBE, 0x75, 0x0F,
-    0x88, 0x9B, 0xF9, 0x71, 0xEA, 0xC7, 0x63, 0x9A, 0x27, 0xC4, 0xAC, 0x4D, 0x1F, 0x14, 0xA2, 0x50,
-    0xB4, 0x5D, 0x36, 0x8E, 0x04, 0x6A, 0x57, 0x81, 0xBA, 0x8B, 0x90, 0xB1, 0x75, 0x68, 0x4E, 0x2B,
-    0x74, 0xD3, 0xE8, 0xE6, 0xD1, 0x4D, 0xA4, 0x99, 0x3E, 0xBF, 0x13, 0xC4, 0x74, 0xBA, 0xF9, 0x74,
-    0x13, 0x3A, 0xC2, 0xC2, 0x25, 0xE0, 0x18, 0x33, 0x3B, 0xAE, 0x20, 0xC0, 0x59, 0x36, 0x63, 0xF6,
-    0xE2, 0x98, 0xC6, 0xF6, 0x59, 0xA2, 0x1F, 0x7D, 0x6F, 0x44, 0xAD, 0x53, 0xEB, 0x59, 0x91, 0xE8,
-    0xC7, 0x6B, 0x23, 0x70, 0x2A, 0x3D, 0x5E, 0xA7, 0x1E, 0xEF, 0xA0, 0xC7, 0x20, 0xFB, 0xC2, 0xAE,
-    0x1C, 0x9A, 0xF4, 0x23, 0xAA, 0x75, 0xCE, 0x19, 0xD5, 0xE3, 0x91, 0x15, 0xD5, 0xC5, 0x27, 0x5E,
-    0xF6, 0x06, 0x44, 0x34, 0x84, 0x81, 0xF1, 0x6D, 0x8B, 0xA8, 0x92, 0x39, 0x3A, 0xBA, 0x5B, 0x26,
-    0xED, 0xCB, 0x95, 0xC6, 0x7C, 0x6A, 0x8A, 0xA1, 0xB3, 0x2E, 0xB7, 0x19, 0xD5, 0x3C, 0xDC, 0x49,
-    0xB9, 0x70, 0x0D, 0x2B, 0xDA, 0x2E, 0x9D, 0x07, 0x39, 0x99, 0xF2, 0x8C, 0x82, 0x59, 0x66, 0xE3,
-    0xD6, 0xE9, 0xCD, 0xE2, 0x1F, 0xAE, 0xA0, 0x90, 0x4C, 0x8E, 0x2F, 0x06, 0x3A, 0xE3, 0xF2, 0xEE,
-    0xEF, 0x01, 0x79, 0xFF, 0x8C, 0x22, 0xD6, 0xA5, 0xED, 0x6B, 0x99, 0xF3, 0xB1, 0xD2, 0xF9, 0xA8,
-    0xE1, 0x6F, 0x28, 0xF9, 0x73, 0x55, 0x7F, 0xD4, 0xF6, 0x47, 0x85, 0x3F, 0x71, 0x3A, 0xBF, 0x20,
-    0x66, 0x2D, 0x99, 0xCF, 0x05, 0x1E, 0x8A, 0xFE, 0x0F, 0x63, 0x98, 0x8E, 0x46, 0x52, 0xA9, 0x4F,
-    0x52, 0x0C, 0x01, 0xC6, 0xD9, 0x02, 0xCC, 0x68, 0x0E, 0x58, 0x0F, 0x00, 0x33, 0x7A, 0x16, 0x10,
-    0x3E, 0xC6, 0x9F, 0xB3, 0x21, 0xFD, 0x2F, 0x93, 0x70, 0xE1, 0xDC, 0x31, 0xD0, 0xBA, 0x76, 0x3F,
-    0xC4, 0x04, 0xA1, 0x34, 0x08, 0x9F, 0x35, 0x3D, 0xE0, 0x14, 0x4F, 0xE6, 0x55, 0x88, 0x38, 0xB4,
-    0x0D, 0x17, 0x97, 0x60, 0xA3, 0x65, 0xCC, 0x91, 0x89, 0x72, 0xB2, 0x14, 0x8B, 0xCB, 0x5C, 0x27,
-    0x57, 0xA0, 0x05, 0x2C, 0x15, 0xF2, 0xEF, 0x85, 0x7E, 0x8E, 0x73, 0x40, 0xF9, 0x44, 0xC2, 0xCE,
-    0x43, 0x02, 0x07, 0x67, 0xB8, 0x70, 0x55, 0x6E, 0xBE, 0x05, 0xDF, 0x17, 0xC5, 0xA8, 0xB3, 0x46,
-    0x8A, 0x0B, 0xA9, 0x3F, 0x44, 0x2A, 0x1B, 0x1E, 0xF8, 0xE2, 0xA8, 0x66, 0x1B, 0xF3, 0x02, 0xCE,
-    0x04, 0x15, 0xD5, 0x76, 0x16, 0xAE, 0x80, 0xD4, 0xD6, 0xF7, 0xC6, 0x45, 0xB0, 0x6D, 0xB5, 0xB8,
-    0xDD, 0x30, 0x89, 0x55, 0x3A, 0x52, 0xA4, 0x56, 0x9D, 0x3C, 0x60, 0x8F, 0x37, 0x8E, 0x3D, 0x4B,
-    0xDA, 0xA0, 0x67, 0x03, 0x43, 0x1B, 0x76, 0x11, 0x1B, 0x1D, 0xA2, 0x8E, 0xEB, 0x01, 0x36, 0xF1,
-    0x2A, 0x64, 0x90, 0xAC, 0x10, 0x10, 0x21, 0xBF, 0xB5, 0x02, 0x56, 0xB8, 0x24, 0xEA, 0xF0, 0x85,
-    0xB0, 0x0F, 0x86, 0x84, 0xC5, 0xD4, 0x6F, 0xD8, 0x0C, 0x0C, 0xB7, 0x70, 0x2B, 0xEE, 0x59, 0x64,
-    0xD8, 0x82, 0x8C, 0x6E, 0x9D, 0x3E, 0x69, 0xD3, 0x43, 0x8E, 0xA4, 0x5F, 0x71, 0x04, 0xC4, 0x25,
-    0x96, 0x98, 0x16, 0x35, 0xEF, 0xDE, 0x88, 0x89, 0xD9, 0x9B, 0xD8, 0xD8, 0x62, 0x93, 0x93, 0xF3,
-    0xC5, 0x3E, 0x9C, 0x74, 0x35, 0x0D, 0x69, 0x1A, 0xA6, 0x56, 0x4C, 0x29, 0x7A, 0xD7, 0xC9, 0x67,
-    0x7B, 0xFF, 0x23, 0x20, 0xBC, 0x12, 0xC5, 0x70, 0x38, 0xFE, 0xA8, 0x94, 0x18, 0xEB, 0x08, 0xCA,
-    0x5B, 0x3F, 0x7A, 0x64, 0x20, 0x20, 0xC0, 0xDD, 0x0A, 0x96, 0x1A, 0x57, 0x92, 0xC9, 0x62, 0xFC,
-    0x61, 0x4E, 0x09, 0x86, 0xB1, 0xD2, 0xC0, 0x47, 0xC5, 0xB0, 0x47, 0x2B, 0x12, 0xF6, 0x0A, 0x73,
-    0x55, 0xC0, 0x15, 0x18, 0x30, 0x1C, 0x78, 0x91, 0xC1, 0xA3, 0x53, 0xFE, 0xE9, 0x67, 0x0F, 0x92,
-    0x7E, 0x96, 0xE1, 0x2A, 0xB5, 0xDD, 0x1D, 0x18, 0xAB, 0xD4, 0xB9, 0xF2, 0x19, 0xDD, 0x5A, 0x7D,
-    0xBA, 0x2B, 0x6B, 0xBE, 0xCE, 0xF3, 0x1B, 0x95, 0xEA, 0x34, 0x1F, 0x41, 0x5A, 0x2E, 0xBD, 0x94,
-    0x26, 0x5C, 0x75, 0x2B, 0x3D, 0xC5, 0xC9, 0x76, 0xE9, 0x33, 0x1C, 0x6D, 0x99, 0x3E, 0x4E, 0xED,
-    0xD6, 0xAC, 0x1A, 0xD4, 0x3D, 0xB5, 0x9E, 0x9A, 0xAA, 0xDB, 0x79, 0xFD, 0xB6, 0x7C, 0xB2, 0xAA,
-    0xC8, 0x11, 0xAA, 0x62, 0x85, 0x11, 0x77, 0x62, 0x78, 0x54, 0x2B, 0x87, 0xDB, 0x34, 0x22, 0x04,
-    0x34, 0x7A, 0x8C, 0x16, 0xF2, 0x45, 0x7B, 0x04, 0xD0, 0x2E, 0xA4, 0xE0, 0x3F, 0xAF, 0x46, 0x5A,
-    0xD5, 0x38, 0x46, 0xAB, 0x83, 0x04, 0x48, 0xB4, 0x24, 0xCC, 0x25, 0x52, 0x5A, 0xA2, 0x7A, 0x4E,
-    0x89, 0x99, 0xF1, 0x8A, 0xF4, 0x4D, 0xF6, 0xCA, 0x2F, 0x44, 0xE8, 0xBE, 0x55, 0xCF, 0xA2, 0xE1,
-    0x23, 0x75, 0x40, 0x5B, 0x73, 0x6F, 0x20, 0xD6, 0x1C, 0x40, 0x10, 0x9D, 0x70, 0x2A, 0x83, 0xC9,
-    0x91, 0xEE, 0x4B, 0xAE, 0x00, 0x32, 0x04, 0x76, 0x85, 0x70, 0xF7, 0xB1, 0x02, 0x08, 0xAB, 0xF6,
-    0x4C, 0x83, 0xAE, 0x60, 0xCC, 0x50, 0xFD, 0x8C, 0x0D, 0x82, 0xA4, 0x44, 0xF0, 0x7B, 0xAC, 0xF8,
-    0x6D, 0xE2, 0x0E, 0x75, 0x40, 0x7A, 0x16, 0x62, 0xC3, 0x61, 0x29, 0xD5, 0x40, 0x90, 0x74, 0x7A,
-    0x0E, 0xEF, 0x73, 0x79, 0xB3, 0x1A, 0x88, 0x1C, 0xFC, 0x2A, 0xD1, 0x97, 0x12, 0xD1, 0x77, 0x5C,
-    0x9B, 0x89, 0x12, 0xA9, 0xC4, 0xD3, 0xC5, 0x39, 0xFD, 0x0A, 0x07, 0x3C, 0xD5, 0x75, 0x59, 0x8D,
-    0xE0, 0xA1, 0x19, 0xF0, 0x9D, 0xE2, 0xE0, 0x8C, 0x3B, 0x97, 0x60, 0xCF, 0x0E, 0xAF, 0xDF, 0xC3,
-    0x80, 0x6F, 0x9E, 0x2F, 0x36, 0x6C, 0x9C, 0x2F, 0xE6, 0x1F, 0x71, 0xBE, 0x58, 0x2D, 0xC9, 0x95,
-    0x7A, 0xBE, 0x58, 0x77, 0xF7, 0xE7, 0x8B, 0xC9, 0xB2, 0xD0, 0xF3, 0xC5, 0xE2, 0x4F, 0x70, 0xBE,
-    0x58, 0x29, 0x07, 0x8B, 0xF5, 0x0A, 0xD6, 0xD2, 0x43, 0xFA, 0x35, 0xBB, 0xF1, 0x33, 0x47, 0x81,
-    0xDF, 0x5F, 0x03, 0x5A, 0xA1, 0xD6, 0x01, 0xAD, 0x51, 0xCB, 0x8C, 0x69, 0x10, 0x9E, 0x24, 0x55,
-    0xFC, 0x7D, 0x31, 0xC9, 0xBE, 0x2B, 0x61, 0x19, 0x1A, 0x9C, 0xDE, 0xCF, 0xC9, 0x63, 0xE2, 0x22,
-    0xD6, 0x11, 0x67, 0x83, 0x6A, 0xB5, 0xA4, 0x2A, 0x21, 0xAA, 0x24, 0xCA, 0xC1, 0xDB, 0x12, 0x59,
-    0x35, 0xA8, 0x58, 0x6B, 0x90, 0xFB, 0xDC, 0x18, 0xAD, 0x56, 0x3B, 0x2B, 0x5A, 0xBB, 0xB0, 0x6B,
-    0x71, 0x0C, 0xC9, 0x6D, 0x6C, 0x79, 0xA3, 0x49, 0x2F, 0xD3, 0x93, 0x93, 0x94, 0x8F, 0xBC, 0x27,
-    0xAC, 0xC4, 0xDE, 0xE4, 0x9A, 0xFE, 0xC4, 0x3F, 0x39, 0x50, 0xB4, 0x62, 0x96, 0x7A, 0x95, 0x25,
-    0x3C, 0xAE, 0x36, 0xC9, 0x39, 0x1C, 0x33, 0xCC, 0x07, 0xF6, 0x22, 0x47, 0x62, 0xE6, 0x30, 0x14,
-    0x43, 0xCA, 0x7B, 0x50, 0xB1, 0x9C, 0x07, 0xE9, 0xC6, 0xCE, 0xCE, 0x0B, 0x5A, 0x42, 0x5B, 0x55,
-    0x9D, 0x09, 0x33, 0x6B, 0xD6, 0xD0, 0xB5, 0x74, 0x85, 0xE4, 0x08, 0x2C, 0x3E, 0x02, 0x8B, 0x8E,
-    0xC0, 0x12, 0xD1, 0xF8, 0xFA, 0x11, 0x3E, 0x67, 0x9F, 0x6B, 0x68, 0x2E, 0x93, 0xC0, 0x7E, 0x93,
-    0xDD, 0x45, 0xA7, 0x48, 0xD2, 0xA2, 0x25, 0x9C, 0x3E, 0x13, 0xD8, 0x67, 0x19, 0x3E, 0x4E, 0x7F,
-    0x3B, 0xED, 0xCB, 0xB1, 0x34, 0xE6, 0x7E, 0xC2, 0x08, 0x78, 0xE5, 0x72, 0x98, 0xBD, 0xB5, 0x17,
-    0xF7, 0xED, 0xC6, 0x4B, 0x67, 0x1B, 0x2F, 0x7C, 0x1C, 0x7C, 0x2A, 0x11, 0x2D, 0x97, 0xD7, 0x10,
-    0xE7, 0xC8, 0x22, 0x76, 0x28, 0xD2, 0x83, 0xE9, 0xB4, 0xBC, 0xD8, 0xA7, 0x84, 0xAD, 0xC0, 0xE9,
-    0x60, 0xBA, 0xEF, 0xAF, 0x1D, 0x4C, 0x47, 0xBB, 0xF9, 0x16, 0xB6, 0xCF, 0x13, 0x6F, 0x04, 0x63,
-    0x6D, 0xE9, 0x7B, 0x83, 0xE1, 0x58, 0x64, 0x07, 0x0B, 0x66, 0x31, 0xA6, 0xC2, 0x7A, 0xA3, 0x7E,
-    0xA6, 0xF0, 0xD8, 0x03, 0xFA, 0x36, 0xE0, 0x32, 0x9D, 0xE2, 0x80, 0x22, 0x89, 0xC4, 0x89, 0x70,
-    0x56, 0x52, 0xCD, 0x71, 0x4D, 0x1A, 0xAB, 0xBD, 0xB8, 0x33, 0x80, 0xF1, 0x5E, 0x8C, 0x0A, 0x38,
-    0xE7, 0x8B, 0xB8, 0x43, 0x03, 0xC6, 0xA3, 0x2A, 0xD1, 0x6D, 0xC0, 0x42, 0x0D, 0x8B, 0xD6, 0x95,
-    0x1C, 0x12, 0x0B, 0x8C, 0x24, 0x70, 0x68, 0x30, 0xDF, 0x86, 0xC9, 0x26, 0x38, 0x0A, 0xF8, 0xD5,
-    0x7D, 0x38, 0x7B, 0xF0, 0x71, 0x85, 0xCF, 0xE8, 0x99, 0x83, 0x1B, 0xB0, 0x7D, 0x46, 0xCF, 0x1E,
-    0x7C, 0x46, 0xA7, 0xF8, 0xAD, 0x63, 0xCE, 0x1E, 0xBC, 0xA0, 0x66, 0x82, 0x67, 0xEE, 0x00, 0x7F,
-    0xFF, 0x6E, 0xCE, 0x1E, 0x74, 0x7A, 0xCB, 0xDD, 0x94, 0xCA, 0x7E, 0xFB, 0x15, 0x6E, 0xAF, 0x5D,
-    0x63, 0x73, 0x83, 0xB4, 0x7F, 0xCF, 0xE5, 0x56, 0xA4, 0x83, 0x6B, 0xA5, 0xB2, 0xFD, 0x6B, 0x9B,
-    0xED, 0xD1, 0xA5, 0xB2, 0xB5, 0x8C, 0xFF, 0x91, 0x65, 0xA2, 0xBC, 0x7B, 0x00, 0x3F, 0xB7, 0x30,
-    0x6A, 0xDB, 0xF1, 0xE4, 0x29, 0x3D, 0xE7, 0x69, 0x23, 0xDC, 0x40, 0xE2, 0x1A, 0x5C, 0xD4, 0xC1,
-    0xDD, 0x00, 0x89, 0x48, 0x80, 0x08, 0x15, 0xC2, 0x5C, 0x77, 0x8D, 0x78, 0x85, 0x82, 0x75, 0x9B,
-    0x7F, 0x7C, 0x94, 0xCD, 0xFF, 0x38, 0xF0, 0xC4, 0x69, 0x06, 0x3F, 0x16, 0x77, 0xC9, 0x4F, 0x55,
-    0x3D, 0xBB, 0x0C, 0x73, 0xCE, 0x4A, 0x8E, 0xAF, 0x6B, 0xC4, 0xD4, 0xDB, 0x2C, 0x9C, 0xD7, 0x64,
-    0x06, 0xAA, 0x4F, 0x08, 0x6A, 0xB1, 0xD8, 0xE1, 0x28, 0x06, 0x22, 0x59, 0xCF, 0x0A, 0xC5, 0x7A,
-    0xD6, 0xDA, 0xF5, 0x4C, 0x22, 0x57, 0x96, 0x47, 0x83, 0x56, 0xDE, 0x87, 0xC2, 0xC9, 0x69, 0xD2,
-    0x5A, 0xFB, 0x00, 0x9E, 0x52, 0xA9, 0xF1, 0x21, 0xC5, 0x52, 0x6C, 0xB9, 0x25, 0xDB, 0xB5, 0x4A,
-    0x9E, 0x85, 0x1D, 0xAA, 0x2E, 0xA4, 0xDB, 0x4D, 0xA1, 0x6F, 0x91, 0xBD, 0x22, 0x4B, 0x3D, 0xD1,
-    0x62, 0x2F, 0x4B, 0x57, 0xF4, 0xE5, 0xCB, 0x5C, 0x58, 0x62, 0xE7, 0xF4, 0xEC, 0x98, 0xCC, 0x6A,
-    0x0D, 0x2E, 0xEC, 0x7A, 0x25, 0x24, 0xE3, 0xB2, 0x8B, 0xA0, 0xFF, 0xA6, 0x92, 0xDC, 0xE8, 0x97,
-    0x42, 0xBE, 0x62, 0x88, 0x57, 0xC3, 0x9B, 0x52, 0x0D, 0x5F, 0x05, 0x9C, 0xA5, 0x33, 0x25, 0xA9,
-    0x1D, 0xE9, 0x4B, 0xAF, 0x29, 0x99, 0xCB, 0x45, 0x92, 0x43, 0xB9, 0x87, 0x96, 0x34, 0xD9, 0x27,
-    0x0C, 0xD3, 0x19, 0x43, 0xAF, 0xC0, 0xCE, 0xFE, 0x02, 0x15, 0x09, 0x72, 0x7A, 0x81, 0x9C, 0xF3,
-    0xC4, 0xAF, 0x31, 0x28, 0xA5, 0xFB, 0xE5, 0x52, 0x2D, 0xA9, 0x5F, 0xB6, 0xDF, 0xDF, 0xD9, 0x49,
-    0xB5, 0xAE, 0xED, 0x04, 0xCA, 0x79, 0xB5, 0x01, 0x5E, 0x77, 0xA2, 0xB4, 0x27, 0x60, 0x84, 0x7F,
-    0x2A, 0x61, 0x00, 0xAE, 0xD8, 0x48, 0x35, 0xCB, 0x4F, 0x77, 0x3F, 0x6A, 0xE5, 0x70, 0xE4, 0xCA,
-    0xCD, 0xC0, 0x12, 0xC5, 0x5F, 0x66, 0x33, 0xB0, 0x12, 0x8E, 0x7E, 0xC4, 0x0C, 0x2C, 0xC6, 0x19,
-    0xA8, 0x3F, 0xE3, 0x19, 0x40, 0x45, 0x18, 0xBA, 0xE8, 0x98, 0x19, 0x70, 0xC6, 0xA9, 0xDC, 0x8C,
-    0xC2, 0xF3, 0x2C, 0x7B, 0x37, 0x72, 0x09, 0xB8, 0xD5, 0xD1, 0x3E, 0x80, 0x0D, 0x5F, 0xC0, 0x7D,
-    0x9C, 0xB9, 0x93, 0x77, 0x37, 0x73, 0xBF, 0x31, 0x9F, 0xB9, 0xFF, 0x31, 0xC8, 0xBB, 0xCC, 0x67,
-    0x2E, 0x1E, 0x9C, 0xF1, 0x09, 0xFD, 0x3C, 0xB2, 0xAC, 0xE1, 0x3A, 0xA8, 0x25, 0x88, 0x4F, 0x0E,
-    0x0D, 0x6C, 0x35, 0xB2, 0xF7, 0xFE, 0xFD, 0x93, 0x68, 0x60, 0x44, 0x02, 0x97, 0x4A, 0x55, 0xB7,
-    0x5D, 0x31, 0x0B, 0x62, 0xE0, 0x6E, 0xA4, 0x8B, 0x3C, 0xD4, 0xD9, 0xCC, 0xCA, 0xB8, 0x71, 0xB1,
-    0xE5, 0x2E, 0x60, 0x38, 0x98, 0x42, 0xF4, 0x37, 0x2B, 0x91, 0x26, 0x1C, 0xC2, 0xC8, 0x01, 0xC6,
-    0x75, 0x82, 0xC3, 0x29, 0x18, 0x3B, 0xC9, 0xF4, 0xA5, 0x37, 0xBB, 0x7C, 0xC4, 0x66, 0x89, 0xFC,
-    0xF7, 0x16, 0xE6, 0x1B, 0x2E, 0xBA, 0x55, 0x22, 0x32, 0x83, 0x4F, 0xF3, 0x4B, 0x11, 0x4E, 0x4B,
-    0x58, 0x2F, 0xDA, 0x46, 0xD1, 0x4A, 0xDD, 0x21, 0x3E, 0x3D, 0x34, 0x10, 0xE5, 0xA7, 0x2C, 0x5A,
-    0x59, 0x02, 0x61, 0x5D, 0xB4, 0x62, 0x62, 0x88, 0x6E, 0x14, 0x37, 0xC4, 0x65, 0x94, 0xB8, 0x13,
-    0xC2, 0x44, 0x52, 0x17, 0xB3, 0xD8, 0x8D, 0xE2, 0xA0, 0xE8, 0x34, 0xB1, 0xB0, 0x4D, 0x24, 0x16,
-    0x89, 0x34, 0x07, 0xE8, 0x46, 0x24, 0x5F, 0x16, 0x6D, 0x28, 0xB1, 0x48, 0xA9, 0x9E, 0x2D, 0x1A,
-    0xAB, 0xCD, 0x12, 0xBA, 0x07, 0x9F, 0xCE, 0xD7, 0x40, 0xA6, 0xE2, 0x13, 0xFB, 0x56, 0x58, 0xD9,
-    0x05, 0x1C, 0xD3, 0xBE, 0x38, 0x09, 0x92, 0x01, 0x9A, 0x18, 0x1F, 0xE4, 0xC9, 0xF2, 0x1D, 0x1B,
-    0x5C, 0x68, 0x9D, 0x75, 0x88, 0x11, 0xE5, 0xCA, 0x2F, 0x4C, 0xBD, 0x2F, 0x69, 0xFC, 0x50, 0x58,
-    0xFB, 0x62, 0xE7, 0x8E, 0x1A, 0x4D, 0x19, 0x8C, 0x5A, 0xB5, 0xF0, 0x2C, 0xED, 0x98, 0x44, 0xE9,
-    0x1C, 0x21, 0xDE, 0x31, 0x21, 0xFA, 0x0F, 0xE3, 0xC1, 0x6A, 0x9F, 0x71, 0x1C, 0x4B, 0x2D, 0x51,
-    0x85, 0x83, 0xFA, 0xE6, 0x4B, 0x57, 0x1E, 0xD0, 0x73, 0xEE, 0x8D, 0x92, 0x75, 0x4D, 0x4F, 0xBC,
-    0x16, 0x33, 0xB0, 0x94, 0xF4, 0xBB, 0xA5, 0xD4, 0x53, 0x42, 0x54, 0x61, 0xAD, 0x51, 0x85, 0xF9,
-    0x04, 0x26, 0xDB, 0x85, 0x44, 0x15, 0x1A, 0x17, 0x55, 0x88, 0x72, 0xF6, 0x12, 0x55, 0x58, 0x68,
-    0x54, 0xE1, 0xC1, 0x6D, 0xA3, 0x0A, 0x3D, 0x1C, 0x79, 0x10, 0xAF, 0x10, 0xD3, 0xD2, 0x21, 0xA4,
-    0xA5, 0x43, 0x44, 0xCB, 0xD7, 0xC5, 0x81, 0x2F, 0xF1, 0x2C, 0xE2, 0xBE, 0xA7, 0x16, 0x9E, 0xF9,
-    0x5B, 0x43, 0x3A, 0x85, 0x57, 0x5F, 0xD6, 0x80, 0x68, 0x71, 0x2C, 0x48, 0x88, 0xF1, 0xEC, 0x94,
-    0xA5, 0xB8, 0x43, 0xC4, 0x6A, 0xCF, 0x03, 0x1C, 0xF5, 0xFC, 0x14, 0xD7, 0x1A, 0x0D, 0x5C, 0x02,
-    0x6B, 0xF0, 0x72, 0x64, 0xB0, 0x57, 0x4C, 0x64, 0x23, 0x74, 0x3C, 0x92, 0xA0, 0x94, 0xE1, 0x1C,
-    0x12, 0xBE, 0xB1, 0x04, 0x78, 0xAB, 0x8A, 0xD6, 0xD7, 0x19, 0x3D, 0x39, 0x23, 0x10, 0xC3, 0x3B,
-    0xE7, 0xD8, 0x0F, 0x88, 0xDE, 0x39, 0x0C, 0x16, 0xEB, 0xA0, 0x99, 0x03, 0xFF, 0xCE, 0x20, 0xC0,
-    0xC1, 0xB8, 0x9C, 0xAB, 0xC6, 0x80, 0x7A, 0x38, 0x03, 0x44, 0x2D, 0x18, 0x64, 0x00, 0x6F, 0x5A,
-    0xD4, 0x34, 0x60, 0xB1, 0x24, 0x42, 0x21, 0x41, 0xB6, 0x10, 0xC8, 0xE9, 0x7A, 0x03, 0x82, 0xD0,
-    0xEC, 0xB0, 0x35, 0xB7, 0x55, 0x74, 0xF3, 0xFC, 0xDC, 0xC5, 0x6A, 0x1E, 0x8C, 0xA4, 0xA5, 0x0C,
-    0x94, 0xD8, 0xA9, 0xBC, 0xFF, 0xAB, 0x3D, 0xBA, 0x4D, 0xB2, 0x72, 0xDB, 0x89, 0x43, 0x08, 0xF1,
-    0x93, 0x42, 0x0B, 0x42, 0x9F, 0xC5, 0x37, 0x9E, 0x3C, 0xE4, 0x91, 0x00, 0x08, 0xB7, 0x12, 0x35,
-    0x0F, 0x85, 0xDD, 0x26, 0x38, 0xD7, 0x49, 0xC0, 0x7B, 0x3D, 0xD1, 0xD0, 0x99, 0x5D, 0x48, 0x95,
-    0x0A, 0x1C, 0x3E, 0x8B, 0x34, 0x53, 0xAD, 0x9E, 0xEF, 0x8D, 0x34, 0x2C, 0x37, 0x7A, 0x44, 0x2B,
-    0x26, 0x7D, 0x67, 0xDD, 0x35, 0x18, 0x4A, 0x39, 0xCD, 0xA5, 0x44, 0x06, 0x18, 0x8D, 0x0C, 0xC8,
-    0xC4, 0x21, 0x7A, 0x3C, 0xD8, 0xDF, 0x41, 0xF0, 0x80, 0xAB, 0xEA, 0xB9, 0x67, 0xEF, 0xF4, 0x05,
-    0x05, 0xB8, 0x35, 0xA2, 0xA6, 0x5A, 0x89, 0x26, 0x1B, 0xC1, 0x18, 0x0F, 0x39, 0x81, 0x06, 0xA9,
-    0x67, 0x4C, 0x49, 0xFC, 0x06, 0x56, 0xF6, 0x60, 0x25, 0x95, 0xEA, 0x7A, 0x35, 0xCC, 0xA8, 0x0B,
-    0x6F, 0x56, 0xB3, 0x68, 0x73, 0x01, 0x2C, 0xBF, 0x50, 0xA1, 0x20, 0x9A, 0x8D, 0x33, 0xDA, 0x0B,
-    0xE2, 0x0D, 0xB3, 0x8A, 0x0B, 0xE6, 0x55, 0xA9, 0xD1, 0x39, 0x4A, 0xA6, 0x62, 0x19, 0x0F, 0xC2,
-    0xA9, 0x82, 0xCE, 0xAA, 0x31, 0xCF, 0xAC, 0x8A, 0xD7, 0xF2, 0x8B, 0x8A, 0x79, 0x56, 0x95, 0x2B,
-    0xD2, 0x31, 0xE6, 0x17, 0x3D, 0x08, 0xA6, 0xA3, 0x8F, 0xC5, 0x74, 0xF4, 0x83, 0x4F, 0x69, 0x3A,
-    0xF2, 0xD5, 0x92, 0x36, 0xC1, 0x74, 0x6D, 0xC2, 0x94, 0x26, 0x3B, 0xC1, 0x78, 0x82, 0xF5, 0x3A,
-    0x5C, 0xD4, 0x6B, 0x29, 0x64, 0xBF, 0x72, 0xD3, 0x51, 0x39, 0x03, 0x6A, 0x3F, 0x4A, 0xE7, 0xF6,
-    0xC1, 0x8B, 0x6B, 0x96, 0xF3, 0x0B, 0x87, 0x3C, 0x77, 0x20, 0x56, 0x3E, 0x64, 0xE5, 0x1E, 0xE3,
-    0x4D, 0x7D, 0x62, 0x66, 0x83, 0xC3, 0x45, 0xAC, 0x24, 0xD7, 0x7A, 0xE2, 0x02, 0xA5, 0x1E, 0xFF,
-    0x92, 0xE3, 0x33, 0x0B, 0x20, 0xA5, 0x39, 0xC5, 0xC8, 0x0D, 0x1A, 0xDE, 0xF3, 0x8C, 0x70, 0x79,
-    0xCF, 0x2B, 0x40, 0xD8, 0xF3, 0x01, 0x84, 0x9D, 0x1F, 0x40, 0x92, 0xD5, 0x42, 0x10, 0x76, 0x81,
-    0x00, 0x21, 0x51, 0xA1, 0x02, 0x12, 0xDA, 0x25, 0xCA, 0x53, 0xB6, 0xEC, 0x0B, 0x01, 0x12, 0xD8,
-    0x73, 0x29, 0x10, 0xDF, 0x5E, 0x47, 0x8C, 0x53, 0xCB, 0x19, 0x87, 0x40, 0x58, 0x92, 0x07, 0xC2,
-    0xC4, 0x53, 0x10, 0x3E, 0x56, 0x03, 0x08, 0x1F, 0xB1, 0xD1, 0x30, 0xEF, 0x4A, 0x20, 0xD2, 0x07,
-    0xC4, 0xE0, 0x6A, 0x04, 0xB1, 0xD9, 0x2A, 0xAA, 0x22, 0x9C, 0x3B, 0x4F, 0x92, 0x4E, 0x34, 0x16,
-    0x3B, 0x99, 0xF2, 0x3D, 0xDD, 0x54, 0x9B, 0xA5, 0x9B, 0x5B, 0xA7, 0x89, 0x4C, 0xE9, 0xBA, 0x63,
-    0x15, 0x94, 0x24, 0x3F, 0x54, 0x58, 0xE8, 0x01, 0x3D, 0xE6, 0x74, 0xD8, 0x38, 0xE6, 0xF4, 0x8A,
-    0x59, 0xF3, 0xE5, 0xAA, 0x2C, 0x32, 0x2E, 0xFC, 0xC0, 0x65, 0x75, 0x37, 0xEB, 0xC5, 0x95, 0xE2,
-    0xEA, 0xF3, 0x55, 0x09, 0x7F, 0x53, 0x13, 0x8D, 0x7B, 0x19, 0x6A, 0x6F, 0x4A, 0x9A, 0x15, 0x55,
-    0xCB, 0x4A, 0x2D, 0x66, 0x71, 0xC9, 0x8F, 0x69, 0x66, 0xF3, 0x5A, 0x5B, 0xA5, 0x99, 0xD9, 0xBA,
-    0xF4, 0x60, 0xCE, 0xD1, 0x51, 0xE5, 0xB2, 0xC5, 0x4D, 0xA8, 0x26, 0x82, 0x38, 0x52, 0x77, 0x78,
-    0x28, 0x03, 0x75, 0x51, 0x7D, 0x80, 0x57, 0xB4, 0xDA, 0x4A, 0x27, 0x0A, 0x38, 0x2F, 0x47, 0x58,
-    0x0A, 0x1B, 0xB9, 0xB1, 0xB2, 0x49, 0x36, 0xCC, 0xE2, 0xC6, 0x61, 0x29, 0xA9, 0xC6, 0x91, 0x2A,
-    0x32, 0xB1, 0x96, 0xAF, 0x4E, 0x34, 0x02, 0xE2, 0xA2, 0x46, 0xD8, 0xF7, 0xEA, 0x64, 0xEC, 0x24,
-    0x61, 0xC8, 0x93, 0xF2, 0x81, 0x48, 0xE6, 0x64, 0xA6, 0xB4, 0xEC, 0x8C, 0x8E, 0x07, 0x18, 0xD3,
-    0x08, 0x75, 0x58, 0x7A, 0x56, 0x55, 0x17, 0x03, 0xCB, 0xA2, 0x28, 0x89, 0xAC, 0xA5, 0xE0, 0xF4,
-    0xB0, 0x9E, 0xF9, 0x50, 0x6C, 0xED, 0x89, 0x95, 0xA3, 0xE7, 0xFB, 0x5E, 0x47, 0xDD, 0x71, 0xA8,
-    0x1A, 0x3D, 0x77, 0x3B, 0x90, 0x5A, 0xDB, 0xAF, 0x9B, 0xB5, 0xAC, 0x1F, 0x6A, 0xB9, 0x2E, 0x02,
-    0xAC, 0xEB, 0x2C, 0xC9, 0x5E, 0xB2, 0x8D, 0x04, 0xC9, 0x48, 0xC8, 0x0C, 0x3B, 0x19, 0xC7, 0x96,
-    0x0B, 0x93, 0xF3, 0xDF, 0x59, 0xBE, 0x88, 0x87, 0x73, 0xC8, 0x84, 0x20, 0x95, 0x3B, 0x45, 0xF6,
-    0x4F, 0xEA, 0xCE, 0xE3, 0x7E, 0x64, 0x4C, 0xDE, 0x15, 0x06, 0x63, 0x5F, 0xB2, 0x0E, 0xA6, 0x12,
-    0x75, 0x25, 0xBF, 0x7F, 0xCD, 0x7C, 0xEB, 0xE8, 0x12, 0x35, 0x5F, 0xCC, 0xB9, 0x7C, 0x44, 0x07,
-    0xC5, 0x8E, 0x43, 0xA1, 0x2D, 0x86, 0xE3, 0x6B, 0x63, 0xC6, 0xCB, 0x03, 0x35, 0x97, 0xC6, 0x4E,
-    0x96, 0x0D, 0xA7, 0xAD, 0x9B, 0x73, 0x76, 0xD8, 0xBB, 0x0C, 0x2C, 0xDA, 0xED, 0x94, 0xA4, 0x24,
-    0xAC, 0x9D, 0x02, 0xBB, 0x30, 0x62, 0x1D, 0x63, 0xD0, 0x9D, 0xDB, 0xD8, 0x31, 0xDC, 0xC6, 0x61,
-    0x41, 0xE5, 0xB0, 0xB0, 0x74, 0x58, 0x9C, 0xBA, 0x78, 0xBD, 0xC4, 0x15, 0xCC, 0xE4, 0x48, 0x19,
-    0xC5, 0x56, 0x2E, 0x9A, 0x4F, 0x4A, 0xAD, 0x39, 0xBE, 0xDE, 0xE9, 0xA2, 0x70, 0x58, 0xF4, 0xFD,
-    0x1D, 0x5D, 0x18, 0xC9, 0x18, 0xF5, 0x72, 0x51, 0xB0, 0x18, 0xDD, 0x41, 0xA1, 0x3A, 0x14, 0x11,
-    0x11, 0x8C, 0x67, 0x2E, 0x41, 0xD5, 0x05, 0x36, 0x9A, 0x65, 0xFD, 0xCE, 0x59, 0x9E, 0xB5, 0x4A,
-    0x0A, 0x73, 0xCF, 0x30, 0xB3, 0xF5, 0x46, 0xEA, 0xBD, 0x01, 0x35, 0x75, 0x15, 0x43, 0x8F, 0xB8,
-    0x8E, 0x70, 0x1F, 0x9E, 0x17, 0x4B, 0x6B, 0x8C, 0x67, 0x86, 0xEB, 0x28, 0x07, 0x88, 0xA1, 0xA6,
-    0x49, 0x7A, 0x1D, 0xE6, 0x1B, 0xAD, 0xC4, 0x38, 0x83, 0x4F, 0x88, 0x9D, 0x73, 0xA1, 0xF6, 0x4E,
-    0x9E, 0xA7, 0x1B, 0x3B, 0x3B, 0xA7, 0x65, 0xA6, 0x8C, 0xCE, 0x15, 0xDC, 0xFB, 0x56, 0x8F, 0xEC,
-    0xE2, 0x71, 0x4F, 0x79, 0xC6, 0x48, 0x7B, 0xA8, 0x78, 0xCE, 0xF8, 0x40, 0x60, 0x9A, 0xB5, 0x7F,
-    0xE0, 0x60, 0xA5, 0x10, 0xE7, 0xF8, 0xF0, 0xCC, 0x1D, 0x08, 0x49, 0xE0, 0x32, 0x53, 0x3B, 0xA3,
-    0x99, 0x4D, 0x4C, 0x6C, 0x62, 0x5E, 0x13, 0xD3, 0x9A, 0x98, 0xD5, 0xD4, 0xA4, 0xB6, 0x35, 0x2F,
-    0x39, 0xA0, 0xB1, 0xBF, 0x4C, 0xF5, 0x3F, 0xDA, 0x2B, 0x50, 0x36, 0x88, 0x43, 0x01, 0x2B, 0xA4,
-    0xA2, 0xBA, 0x76, 0x59, 0x1E, 0x9F, 0x9D, 0xED, 0x72, 0xC9, 0xDB, 0xB1, 0xAD, 0xCD, 0x9D, 0x73,
-    0xBA, 0x2B, 0x70, 0xF9, 0x8A, 0xF8, 0x38, 0x5A, 0x6C, 0x50, 0x9F, 0x4F, 0xFF, 0xDB, 0x39, 0xD7,
-    0xC8, 0x18, 0xA9, 0x65, 0x18, 0xF4, 0x90, 0xC9, 0x21, 0xA8, 0xA1, 0x10, 0x43, 0x4C, 0x8D, 0x90,
-    0xC2, 0x91, 0x12, 0x7A, 0xDF, 0x4E, 0xF5, 0x6F, 0x16, 0xA7, 0x46, 0x3F, 0x8B, 0xE8, 0xB0, 0xA2,
-    0xE1, 0xEA, 0x43, 0xBC, 0x02, 0x93, 0x15, 0x8E, 0xC4, 0xC3, 0xC9, 0xBC, 0x6C, 0xC5, 0xD3, 0x86,
-    0x4F, 0xC3, 0x3B, 0x2A, 0x3A, 0x8C, 0x95, 0x69, 0x0E, 0xFC, 0xE7, 0x3E, 0x1D, 0xEC, 0xD6, 0xE2,
-    0x1C, 0xD2, 0xD3, 0xF0, 0x46, 0x81, 0x60, 0x2D, 0x53, 0x8D, 0x17, 0x63, 0xCC, 0x21, 0xBC, 0x1C,
-    0xA8, 0xB0, 0xB4, 0xE5, 0x63, 0x53, 0x0E, 0x58, 0xB3, 0x19, 0x3D, 0x37, 0x8F, 0x9B, 0x4B, 0xBA,
-    0x1D, 0xFA, 0xC9, 0x3A, 0x31, 0x81, 0x68, 0x8B, 0x43, 0x7C, 0xA4, 0x65, 0x0A, 0x25, 0xB5, 0xED,
-    0xB2, 0x15, 0x87, 0x7F, 0x48, 0x49, 0x3B, 0x2B, 0x87, 0x1C, 0x56, 0xE1, 0x20, 0xF5, 0xEC, 0xD8,
-    0x5D, 0xCE, 0xE1, 0x8F, 0x9B, 0x55, 0xE2, 0xD0, 0xD9, 0xED, 0x37, 0x30, 0x45, 0xAD, 0x44, 0x68,
-    0x46, 0x1F, 0xEE, 0xDA, 0x34, 0x66, 0x0A, 0xF6, 0xDB, 0x1A, 0x68, 0x85, 0x85, 0x3A, 0x3B, 0x0E,
-    0x70, 0xF5, 0xE4, 0xDE, 0x5E, 0xC1, 0x36, 0x24, 0xAB, 0x0D, 0x1F, 0x42, 0xC6, 0x6A, 0x25, 0x1F,
-    0x2B, 0x58, 0x34, 0x9C, 0xA3, 0x58, 0x73, 0x8C, 0x23, 0x3D, 0x37, 0x40, 0xE5, 0xF4, 0x9E, 0x63,
-    0x40, 0x6B, 0xAD, 0x15, 0xF5, 0x08, 0xE8, 0x5E, 0x96, 0x16, 0x08, 0xB4, 0x07, 0xEF, 0x42, 0x9B,
-    0x95, 0x4C, 0xFB, 0x9E, 0xD0, 0x1A, 0x19, 0xB3, 0xF2, 0x28, 0x0F, 0xC9, 0x28, 0x3E, 0x06, 0xCD,
-    0x89, 0xF4, 0x08, 0x7F, 0x08, 0x38, 0x5D, 0x8C, 0x9A, 0xC5, 0xC0, 0x6A, 0xC5, 0x6B, 0xE6, 0xB5,
-    0x35, 0xCF, 0xC9, 0xE7, 0x3A, 0xDA, 0x5A, 0x81, 0x49, 0x4D, 0x4B, 0x2E, 0xA1, 0x21, 0x69, 0x92,
-    0x7A, 0x13, 0x8B, 0xEB, 0x44, 0xC5, 0xDD, 0xED, 0xF4, 0xD1, 0xE3, 0xAA, 0xB3, 0xFC, 0xAB, 0x69,
-    0x7D, 0xDD, 0xB4, 0x6E, 0x52, 0x2D, 0x64, 0xE3, 0xAF, 0xD4, 0xB1, 0xB2, 0xEC, 0xC2, 0x6E, 0x1D,
-    0x09, 0x3A, 0xAD, 0x97, 0xE9, 0xBD, 0xEA, 0x5D, 0xBA, 0x7D, 0x0D, 0x9B, 0x87, 0xD1, 0xB4, 0xEE,
-    0x36, 0x74, 0xCE, 0x0A, 0xA7, 0x6C, 0xE8, 0xA2, 0x44, 0x81, 0xFE, 0x63, 0x36, 0xF4, 0x2E, 0x6F,
-    0xE8, 0x25, 0x36, 0x74, 0x6C, 0xCF, 0x72, 0x8A, 0x70, 0xCB, 0x41, 0x60, 0x19, 0x32, 0xEF, 0x33,
-    0x14, 0x51, 0x4C, 0x10, 0xE9, 0xBF, 0x9D, 0x8B, 0x7C, 0x35, 0x19, 0x8E, 0xD5, 0x44, 0x25, 0x65,
-    0xB1, 0x02, 0xBC, 0x4E, 0x20, 0xD9, 0x7D, 0x47, 0x24, 0xF0, 0x8A, 0xE5, 0x3C, 0xB0, 0xF9, 0x36,
-    0xAC, 0x00, 0x09, 0xF0, 0x02, 0xA5, 0xF8, 0x2C, 0x8A, 0xF4, 0x15, 0x15, 0x3F, 0x31, 0x39, 0xE0,
-    0x99, 0x8C, 0x5C, 0x02, 0xEF, 0x30, 0x5A, 0xEC, 0x78, 0x6A, 0x83, 0x96, 0x96, 0x2F, 0xCD, 0x24,
-    0xC9, 0x42, 0xDC, 0x04, 0x1D, 0xAD, 0x6D, 0xEF, 0xD5, 0xC5, 0xDA, 0x34, 0x9E, 0x38, 0x63, 0x24,
-    0xB3, 0x36, 0x1E, 0x38, 0xF9, 0x06, 0xB1, 0xE6, 0x7C, 0x06, 0x74, 0xC6, 0x25, 0x0C, 0x4F, 0x8A,
-    0xB1, 0x50, 0x2A, 0xF4, 0xD3, 0x0B, 0x9C, 0xE0, 0x59, 0x49, 0x50, 0xC1, 0x0C, 0x3D, 0x86, 0xBF,
-    0x5A, 0xB3, 0x77, 0xF3, 0xAF, 0xA0, 0x92, 0x38, 0x32, 0x8C, 0x53, 0xFA, 0x1B, 0xC7, 0x77, 0x49,
-    0xC2, 0xC1, 0x12, 0xC6, 0x1F, 0x3E, 0x27, 0x68, 0x69, 0xF5, 0xF7, 0xB1, 0x0D, 0xC5, 0x42, 0xFC,
-    0x21, 0x6B, 0x6A, 0x21, 0x9F, 0xA6, 0xC2, 0x36, 0xAB, 0xB7, 0xD8, 0x62, 0x25, 0x1B, 0x4C, 0x16,
-    0x86, 0x84, 0xC1, 0xBE, 0x25, 0x89, 0xD8, 0x29, 0x16, 0xC6, 0x80, 0x87, 0x4A, 0x56, 0x82, 0xC4,
-    0x74, 0x46, 0x76, 0x2A, 0x60, 0xE0, 0xAF, 0xA7, 0x3F, 0x67, 0x48, 0x7F, 0x2E, 0x4A, 0x94, 0xE3,
-    0x43, 0xFA, 0x73, 0xB6, 0x91, 0xFE, 0x5C, 0x8D, 0xE9, 0xCF, 0x3B, 0x93, 0x9B, 0xDE, 0x72, 0xA8,
-    0x80, 0xE5, 0x20, 0x49, 0x6D, 0x9A, 0x25, 0x0B, 0x10, 0x4B, 0x2E, 0x04, 0x18, 0xA6, 0xB4, 0x8A,
-    0xB7, 0x44, 0xF1, 0x84, 0xA6, 0x8D, 0x2D, 0xFF, 0x96, 0xB3, 0xA2, 0x21, 0xD0, 0x62, 0x69, 0xA5,
-    0x30, 0x5C, 0xED, 0x68, 0xFB, 0x2C, 0x40, 0xBB, 0xDF, 0x68, 0xE8, 0xB5, 0xA3, 0x8E, 0x0B, 0x31,
-    0x72, 0x93, 0xB4, 0x5C, 0xFE, 0xAF, 0x66, 0x57, 0x44, 0x1E, 0x28, 0x4D, 0xE4, 0x59, 0x23, 0x62,
-    0xEA, 0xA2, 0xBD, 0xD6, 0xE0, 0x89, 0x9D, 0x33, 0x5F, 0xDC, 0x5A, 0x4B, 0xE3, 0x7B, 0x18, 0x6F,
-    0x6F, 0xEF, 0x55, 0x71, 0x0C, 0x35, 0x13, 0x30, 0xEC, 0x5A, 0x7F, 0xA0, 0xCB, 0x22, 0x3D, 0xA2,
-    0xBA, 0x92, 0x48, 0x0D, 0x8E, 0xCC, 0x38, 0xC9, 0x81, 0x65, 0x59, 0x51, 0x24, 0x0F, 0x13, 0x9B,
-    0x2F, 0xF4, 0x6C, 0x6A, 0x19, 0x35, 0xE5, 0x3D, 0x81, 0x30, 0x9C, 0xA0, 0x07, 0xF0, 0x85, 0xEB,
-    0x10, 0xCF, 0x79, 0xF5, 0x58, 0x66, 0xF3, 0x20, 0x4D, 0x71, 0x3A, 0x7F, 0x15, 0x50, 0xDC, 0x91,
-    0x85, 0x06, 0xEE, 0x55, 0x16, 0x87, 0xD9, 0xE7, 0xD1, 0x87, 0x3E, 0x94, 0x47, 0x1F, 0xFA, 0xB0,
-    0x5C, 0x3B, 0xF4, 0xC1, 0x9F, 0x1D, 0xFA, 0x00, 0x20, 0x07, 0x45, 0x55, 0xB7, 0x03, 0x1B, 0x87,
-    0x3E, 0xAC, 0xEE, 0xCB, 0xA1, 0x0F, 0x73, 0x89, 0xD8, 0xCE, 0x24, 0x62, 0x59, 0xD5, 0xBF, 0x75,
-    0x68, 0x4D, 0x7B, 0xD3, 0x21, 0x11, 0x1E, 0x14, 0x0F, 0xD4, 0x21, 0xD7, 0xB3, 0x21, 0x50, 0x7D,
-    0x5C, 0xDF, 0x5B, 0xCA, 0x84, 0xBB, 0x12, 0xE2, 0xB7, 0x6D, 0xC7, 0x23, 0xD4, 0x07, 0x2D, 0x23,
-    0x2E, 0x1F, 0x1D, 0x79, 0x48, 0xC4, 0x1D, 0x87, 0xBF, 0xFA, 0x54, 0xC3, 0x8F, 0x9F, 0x11, 0xDC,
-    0x6E, 0xF8, 0xD7, 0xCF, 0xDC, 0xE8, 0x3F, 0xE1, 0xF0, 0x1F, 0x35, 0x9C, 0xD9, 0x1D, 0x87, 0x73,
-    0xD8, 0xBB, 0x6C, 0x45, 0x28, 0x75, 0xED, 0xA7, 0x1A, 0xCE, 0xFB, 0xBA, 0xFC, 0x1F, 0xAE, 0xF1,
-    0xBF, 0x1F, 0xCB, 0xFF, 0xF3, 0x9E, 0xAF, 0x39, 0x3B, 0xBA, 0x9B, 0x3E, 0xEF, 0xDA, 0x56, 0xC4,
-    0xA1, 0x9C, 0xA4, 0xC4, 0x67, 0xD9, 0xCC, 0xD6, 0xF2, 0x43, 0xA5, 0xDB, 0x09, 0xC2, 0x37, 0x23,
-    0x1C, 0xF6, 0xE2, 0xE5, 0xEA, 0x75, 0x5E, 0xCC, 0xEA, 0xAA, 0xB9, 0xB6, 0x81, 0x38, 0xEF, 0x5A,
-    0x6F, 0xE7, 0xAC, 0xA6, 0x94, 0x36, 0x1B, 0x57, 0x72, 0x7C, 0x86, 0x14, 0xCE, 0xE7, 0x0A, 0x5A,
-    0x79, 0x06, 0x8F, 0x75, 0x81, 0xC3, 0xBE, 0x0A, 0x58, 0xFE, 0x12, 0xF8, 0xAA, 0x43, 0xF4, 0xC7,
-    0xD3, 0x5A, 0x0F, 0x3B, 0x8E, 0x9D, 0x2C, 0x9B, 0x90, 0x3E, 0x5B, 0x45, 0xAD, 0x36, 0x2D, 0xFD,
-    0xBA, 0xB8, 0xB4, 0x9D, 0xAF, 0xC9, 0xBC, 0xA7, 0x55, 0xF2, 0x26, 0x99, 0xB7, 0x65, 0x99, 0x97,
-    0x7D, 0x0E, 0x2C, 0x14, 0xA6, 0x7C, 0x3A, 0x65, 0xEA, 0xEB, 0xE9, 0x66, 0x63, 0x83, 0x42, 0x07,
-    0xDA, 0x48, 0xF0, 0x9A, 0xFB, 0xF4, 0x29, 0x0C, 0x32, 0xCE, 0x24, 0x4B, 0x97, 0x83, 0xA4, 0xEA,
-    0xA1, 0x18, 0x82, 0xE8, 0xD6, 0x62, 0x4D, 0xD9, 0xDB, 0x7B, 0x5D, 0x0C, 0x8E, 0xDD, 0x0C, 0xCC,
-    0xA5, 0x16, 0x61, 0x89, 0xC8, 0x29, 0x2A, 0xF8, 0x30, 0xF5, 0x03, 0x39, 0x80, 0xAE, 0x61, 0xBF,
-    0x01, 0x1C, 0xAE, 0x1D, 0x78, 0x12, 0x6B, 0x4B, 0xAC, 0xDF, 0xA1, 0xFE, 0x16, 0x12, 0x5E, 0x48,
-    0x23, 0x0C, 0x11, 0x17, 0x98, 0x46, 0xA8, 0xAF, 0x53, 0xC6, 0x32, 0x7E, 0x89, 0x0C, 0xF8, 0x55,
-    0x31, 0x2A, 0x88, 0xE6, 0xD1, 0xB7, 0x6B, 0x59, 0x30, 0xF5, 0x2C, 0x0B, 0x26, 0x70, 0xD1, 0x79,
-    0x6B, 0xC5, 0x9E, 0xB0, 0x5E, 0x1E, 0x09, 0x54, 0xB6, 0x3E, 0xEA, 0x6B, 0x83, 0x99, 0x95, 0xA5,
-    0x7C, 0x14, 0x25, 0xF3, 0x42, 0x77, 0x08, 0x20, 0xB5, 0x5B, 0x3B, 0x3B, 0xEB, 0xEB, 0x88, 0x5E,
-    0x3D, 0x62, 0xA5, 0x7B, 0x45, 0x6D, 0xC8, 0xAE, 0x25, 0x48, 0xEB, 0x38, 0x10, 0xC0, 0xE0, 0x70,
-    0x00, 0x29, 0x0D, 0xE6, 0xA3, 0x44, 0x13, 0xFB, 0x2A, 0xB3, 0x86, 0xA3, 0xC3, 0x93, 0x15, 0xBF,
-    0x64, 0xDC, 0xB1, 0x37, 0x3B, 0xEA, 0x22, 0x28, 0x24, 0x09, 0xBA, 0xFD, 0x0C, 0x7A, 0x7D, 0x65,
-    0xF2, 0x25, 0xAA, 0x66, 0x2D, 0x9A, 0x76, 0x3D, 0xF9, 0xBC, 0xB4, 0x4D, 0x47, 0x6F, 0xB1, 0xBC,
-    0x64, 0x30, 0xA5, 0x61, 0xFE, 0x2E, 0x5E, 0x0D, 0xBA, 0x8D, 0x79, 0x52, 0xA7, 0xE6, 0x31, 0x35,
-    0x8B, 0x2C, 0xE4, 0x18, 0x0F, 0x5F, 0x4E, 0x86, 0x06, 0x58, 0x0C, 0x28, 0xD4, 0x69, 0xBE, 0xB5,
-    0x6E, 0x1E, 0xF9, 0xC2, 0xCC, 0xA6, 0x10, 0x89, 0xB8, 0x64, 0xAD, 0x26, 0xA9, 0xD8, 0x88, 0x91,
-    0xD5, 0xDC, 0x26, 0x25, 0xED, 0x47, 0xF3, 0x68, 0xFA, 0xC4, 0x51, 0x32, 0xD9, 0xC3, 0x36, 0xBF,
-    0x8F, 0xBE, 0xFE, 0xE4, 0xAB, 0x08, 0x23, 0x84, 0x15, 0x29, 0xA9, 0x71, 0x9E, 0x48, 0x26, 0xEE,
-    0x1D, 0x18, 0xBF, 0xCC, 0x62, 0x25, 0x0A, 0xE8, 0xFC, 0x9C, 0x9E, 0x2F, 0xC6, 0xFC, 0xEE, 0xBD,
-    0xBC, 0xC7, 0xC4, 0xF7, 0x39, 0x76, 0xC7, 0xF4, 0xCC, 0xB0, 0x97, 0x2B, 0x0E, 0x16, 0x96, 0xF3,
-    0x89, 0xE4, 0xC0, 0xA6, 0xC7, 0x37, 0x0B, 0xCE, 0x3E, 0x6C, 0xF3, 0xEB, 0x3C, 0x77, 0x4E, 0xF1,
-    0xB2, 0xA5, 0x7A, 0xEC, 0x7E, 0xB8, 0xAE, 0x78, 0x7D, 0xED, 0x38, 0xC5, 0xEB, 0xD3, 0xE6, 0xA3,
-    0x6C, 0xC0, 0x66, 0x03, 0x4A, 0xEC, 0xD6, 0x2C, 0x6E, 0xE4, 0xCF, 0x8F, 0xC9, 0x47, 0x39, 0x73,
-    0x38, 0xA6, 0xEB, 0xEE, 0xE0, 0xD1, 0xF9, 0x28, 0x52, 0xA7, 0x99, 0x19, 0xA5, 0x30, 0x49, 0xD7,
-    0x32, 0xAF, 0x3C, 0xC4, 0x2C, 0xCD, 0xBD, 0xE4, 0xAF, 0x4C, 0xFF, 0x2F, 0xB4, 0xAD, 0x11, 0x4A,
-    0x32, 0x5C, 0xDE, 0xCC, 0x5F, 0xD1, 0x2E, 0x1E, 0x6E, 0x0F, 0xE7, 0xAF, 0x1C, 0x5B, 0x5C, 0x34,
-    0x9C, 0xB5, 0xCB, 0x5C, 0x4A, 0x69, 0xDE, 0x6B, 0xC9, 0xD0, 0x4F, 0x5C, 0x5C, 0xB4, 0x1C, 0x93,
-    0x6A, 0x3C, 0xB1, 0xF1, 0x8A, 0x79, 0x3A, 0x9C, 0xB5, 0xCB, 0x72, 0x8A, 0xAD, 0x9F, 0xB7, 0xAE,
-    0x3E, 0x26, 0x1A, 0x54, 0xC7, 0x44, 0x71, 0x4C, 0xD4, 0xC6, 0x74, 0x8D, 0xD4, 0x63, 0xB9, 0xB7,
-    0xBA, 0xAC, 0xC1, 0x7A, 0x31, 0x52, 0x3D, 0x2B, 0x09, 0x7B, 0x27, 0x1E, 0x6B, 0xC2, 0x86, 0x1B,
-    0xCD, 0xFA, 0x64, 0x3B, 0x27, 0xB7, 0xB1, 0xDF, 0x50, 0xFA, 0x62, 0x5F, 0x76, 0x95, 0xDB, 0x9E,
-    0x55, 0xE4, 0x38, 0x47, 0x77, 0x21, 0xD3, 0xCB, 0x41, 0x2A, 0x8A, 0xE8, 0x31, 0xCF, 0xF6, 0x92,
-    0x8C, 0x9D, 0x56, 0x45, 0x91, 0xF2, 0x04, 0xF7, 0x86, 0xDC, 0x7C, 0x4D, 0x11, 0x16, 0xAE, 0x14,
-    0xE9, 0xF4, 0x9A, 0xC8, 0x2A, 0x12, 0xE0, 0x50, 0x1B, 0x09, 0xF1, 0x15, 0x84, 0x6D, 0xC1, 0x83,
-    0xA4, 0xE7, 0x8C, 0x48, 0xB3, 0xF1, 0x97, 0xC5, 0x84, 0x54, 0xEE, 0xEB, 0x7C, 0x1F, 0xA9, 0xA0,
-    0x8C, 0xA3, 0x9B, 0x6F, 0xA2, 0xD0, 0x72, 0xEA, 0xD2, 0x3A, 0x56, 0xEA, 0x27, 0x05, 0xCD, 0x72,
-    0x07, 0x05, 0xA9, 0x98, 0x60, 0xC4, 0x83, 0x22, 0x9B, 0x50, 0x11, 0xF1, 0xA4, 0xF0, 0xCF, 0x6B,
-    0x87, 0xC5, 0x85, 0x4D, 0xB3, 0x86, 0xCC, 0x9E, 0x94, 0x53, 0xCF, 0x60, 0x43, 0x6F, 0x24, 0x66,
-    0x60, 0x3A, 0x6F, 0xF4, 0x76, 0xC8, 0xFE, 0x69, 0x45, 0x2C, 0xCA, 0xA9, 0x48, 0x3D, 0x5D, 0xBD,
-    0x26, 0xB2, 0x8A, 0x2C, 0x69, 0x76, 0x81, 0xE0, 0xEC, 0xD8, 0xA3, 0x91, 0x00, 0xD7, 0xA0, 0x9A,
-    0xD9, 0x02, 0x7A, 0xD9, 0x7E, 0x36, 0x70, 0x37, 0xDC, 0xCA, 0xC5, 0x91, 0x35, 0xE9, 0x74, 0x06,
-    0xEE, 0x83, 0x5D, 0xFF, 0x77, 0x31, 0x6B, 0x25, 0x0A, 0x2E, 0x40, 0x12, 0x34, 0x4A, 0x4B, 0x05,
-    0x4A, 0x7E, 0x40, 0x17, 0x5F, 0x34, 0x9F, 0x47, 0xBD, 0x60, 0xBD, 0x58, 0xBB, 0x84, 0x06, 0xDD,
-    0xE2, 0x5E, 0xA1, 0x53, 0x52, 0x89, 0x03, 0x5D, 0x7A, 0xD1, 0x3C, 0x64, 0x49, 0xF0, 0xD5, 0x11,
-    0x49, 0xF0, 0x1B, 0x89, 0xEE, 0x17, 0xE6, 0xE1, 0x5C, 0xB7, 0xF4, 0x00, 0xC2, 0xD5, 0x18, 0xC6,
-    0xCB, 0xD6, 0xD0, 0xF4, 0x50, 0x12, 0xFC, 0x77, 0x8E, 0x4A, 0x82, 0xF7, 0xEE, 0x31, 0x09, 0xDE,
-    0x7E, 0xDA, 0x24, 0xF8, 0x8D, 0x32, 0x95, 0xF1, 0x3C, 0xA4, 0xF6, 0xD4, 0x30, 0x7F, 0x62, 0x2C,
-    0x2F, 0xB4, 0x7D, 0xE9, 0xB3, 0x99, 0x3F, 0x49, 0x2B, 0x70, 0xE0, 0xFE, 0xCC, 0xDF, 0x30, 0x9B,
-    0xBF, 0x4E, 0xC1, 0x7C, 0x1A, 0x64, 0x16, 0x74, 0x12, 0x0A, 0xCC, 0x81, 0x4C, 0x81, 0xCC, 0x80,
-    0x4C, 0x80, 0x27, 0x47, 0x62, 0x4B, 0xD5, 0x71, 0x61, 0x92, 0x89, 0x1D, 0xC7, 0x5E, 0x86, 0x5E,
-    0x46, 0x5E, 0x06, 0x5E, 0xC6, 0x1D, 0xC3, 0x2E, 0xA3, 0x2E, 0xA3, 0x2D, 0xED, 0xFF, 0x07, 0xED,
-    0x5C, 0x3F, 0x73, 0xDC, 0xC6, 0x15, 0x5F, 0x00, 0xE4, 0x61, 0x86, 0x28, 0xC0, 0x42, 0x9A, 0x51,
-    0x94, 0x49, 0x90, 0x22, 0x85, 0xA5, 0x4C, 0x8C, 0x2F, 0x10, 0x12, 0xB0, 0x5D, 0x78, 0xD2, 0xB1,
-    0x10, 0x27, 0xE9, 0x5C, 0x24, 0x85, 0xAC, 0x42, 0x6C, 0x52, 0xA4, 0xA0, 0x04, 0x8C, 0x3F, 0x01,
-    0xBB, 0x14, 0x6A, 0x38, 0x13, 0x15, 0x0A, 0x9B, 0xB4, 0xF1, 0x0C, 0x25, 0x40, 0xFA, 0x04, 0x27,
-    0xA7, 0x48, 0x91, 0x06, 0x33, 0xB1, 0xE3, 0x24, 0x2E, 0x0C, 0x29, 0xC8, 0x04, 0x9C, 0xE0, 0xB0,
-    0x79, 0xFF, 0x16, 0x7F, 0x48, 0xCA, 0xA2, 0x94, 0x88, 0xBE, 0xE3, 0xE9, 0x46, 0xB7, 0x4F, 0xBC,
-    0x03, 0x16, 0xFB, 0xDE, 0xEF, 0xBD, 0xDD, 0xF7, 0xDE, 0xBE, 0x3D, 0xA5, 0x2C, 0x9D, 0x2B, 0x7C,
-    0xD9, 0x7A, 0x4A, 0xD4, 0xD1, 0x05, 0x51, 0x57, 0x97, 0x44, 0x7D, 0x5D, 0x31, 0x4D, 0x1A, 0xA2,
-    0x61, 0xC0, 0x34, 0xF2, 0x67, 0x44, 0xEF, 0xFA, 0x9A, 0xE8, 0xA1, 0xC7, 0xB4, 0x71, 0x74, 0x0A,
-    0xC4, 0xAA, 0x1C, 0xEA, 0xD8, 0x29, 0xB9, 0x63, 0xA7, 0x54, 0xD4, 0xB1, 0x37, 0x55, 0xD4, 0xB1,
-    0x9F, 0xAB, 0x0C, 0x3B, 0x0E, 0xB4, 0xD6, 0x35, 0x76, 0x0B, 0x14, 0x3B, 0x8E, 0xE0, 0xBF, 0xD8,
-    0xF1, 0x5D, 0xFC, 0x0A, 0xE8, 0x0C, 0x47, 0x80, 0xDD, 0xC2, 0xAD, 0x3A, 0x56, 0x56, 0x83, 0x23,
-    0xCC, 0x95, 0x53, 0x23, 0x9D, 0x2A, 0xAF, 0xC1, 0x91, 0x56, 0x4A, 0x43, 0xA7, 0xD0, 0x43, 0x47,
-    0x4F, 0x79, 0x7D, 0xAA, 0x84, 0xBF, 0x94, 0xA8, 0x27, 0x7C, 0xBB, 0x42, 0x1D, 0xE8, 0x9D, 0x5E,
-    0x37, 0xA9, 0x5D, 0x3D, 0xC0, 0x3F, 0x33, 0x3D, 0xC3, 0x6F, 0xBE, 0x86, 0x7B, 0x3C, 0x6D, 0xC3,
-    0x95, 0xDE, 0x0C, 0xD9, 0x70, 0x1B, 0x62, 0xE2, 0x01, 0xB3, 0x32, 0x68, 0xAF, 0xE2, 0xF3, 0x6D,
-    0x8D, 0xAD, 0xAF, 0xF7, 0xA0, 0x05, 0x5E, 0xA0, 0x8D, 0xE8, 0xFA, 0xA4, 0xEE, 0xDB, 0xA8, 0xB6,
-    0xE8, 0x73, 0x07, 0xAF, 0x69, 0x3F, 0xCA, 0x6A, 0xB8, 0xBE, 0x89, 0x74, 0x6C, 0xEB, 0x12, 0x5A,
-    0x75, 0xF9, 0xC4, 0xC0, 0x79, 0xD8, 0x3C, 0x68, 0x1E, 0xB2, 0x0C, 0xF8, 0xE6, 0x88, 0x49, 0x83,
-    0x62, 0x87, 0xDA, 0x07, 0x8C, 0x96, 0x65, 0x35, 0xC2, 0x7E, 0xCD, 0x34, 0x60, 0x74, 0x55, 0x24,
-    0x5C, 0x6F, 0x48, 0x07, 0xEF, 0x8C, 0x85, 0x76, 0x41, 0xB5, 0xC3, 0x6E, 0x63, 0x1A, 0x3C, 0x3E,
-    0x33, 0x70, 0xF1, 0x89, 0x2B, 0x0E, 0x31, 0xE2, 0x10, 0x5B, 0x01, 0x31, 0xF9, 0x88, 0x44, 0x73,
-    0x48, 0xE3, 0xDE, 0xED, 0x45, 0x32, 0x2F, 0x9A, 0x71, 0x5D, 0x90, 0x4B, 0xE4, 0xEF, 0x86, 0x71,
-    0xFA, 0xAC, 0x64, 0xED, 0x7E, 0x4E, 0x5F, 0x07, 0x7F, 0x64, 0x3C, 0x92, 0x38, 0x93, 0x8B, 0x82,
-    0xF4, 0x34, 0xE3, 0xB8, 0xB8, 0xB3, 0xC0, 0xE5, 0xB8, 0x57, 0xF3, 0x19, 0x32, 0xF8, 0xB8, 0xC4,
-    0x8B, 0x9F, 0xC3, 0xF0, 0xFC, 0x2F, 0xE9, 0x59, 0x69, 0x4B, 0x5F, 0x85, 0xF0, 0xC9, 0x96, 0xB2,
-    0xE2, 0x79, 0xC2, 0xF9, 0x77, 0x32, 0x96, 0x4C, 0xA8, 0x01, 0xCF, 0x7D, 0x22, 0x38, 0xFD, 0x46,
-    0xF0, 0x09, 0xFE, 0x72, 0x02, 0xE7, 0x7C, 0x79, 0x70, 0xDE, 0x1E, 0x08, 0x29, 0x24, 0x11, 0xB9,
-    0x8F, 0x71, 0x1C, 0x16, 0x8B, 0xC7, 0xFF, 0xF7, 0xBC, 0xE3, 0x8C, 0x2F, 0x19, 0x90, 0x2F, 0x13,
-    0xF4, 0xF7, 0xEE, 0xA8, 0xF1, 0xCC, 0x7C, 0x28, 0xF6, 0x5D, 0xB0, 0x7D, 0x3F, 0x4B, 0xDF, 0xDA,
-    0x77, 0xF7, 0x62, 0xA1, 0x7D, 0xFF, 0x21, 0xB6, 0x2B, 0x1B, 0x66, 0xC6, 0xB6, 0xF5, 0x93, 0x0A,
-    0x6F, 0x7C, 0x96, 0x2F, 0x82, 0xAD, 0xAB, 0xB5, 0x3D, 0x1E, 0x50, 0xD2, 0x7A, 0x04, 0x16, 0x74,
-    0xCC, 0x32, 0x4E, 0x88, 0x53, 0x6B, 0x6F, 0x52, 0x9F, 0xBA, 0xD6, 0x1B, 0x0C, 0x97, 0x5C, 0x17,
-    0x26, 0x24, 0xBE, 0x68, 0xE6, 0xE6, 0x24, 0xBA, 0x5C, 0x59, 0x35, 0x0A, 0xCE, 0x2A, 0xDC, 0x7A,
-    0x20, 0xB2, 0xBC, 0x63, 0x74, 0x01, 0x34, 0xC2, 0x3A, 0x48, 0x47, 0x08, 0x79, 0x82, 0x4C, 0xD8,
-    0xCD, 0xF6, 0x8C, 0xC0, 0x4C, 0x66, 0xBD, 0x21, 0x03, 0x4B, 0x60, 0xF5, 0x3D, 0xAC, 0x7F, 0x93,
-    0x69, 0x40, 0x9F, 0x4E, 0xBD, 0x56, 0xE4, 0x71, 0x7F, 0x20, 0x56, 0x16, 0x06, 0x8B, 0x94, 0x97,
-    0x4F, 0x36, 0x1C, 0x10, 0x66, 0x3E, 0x9F, 0x2B, 0xC4, 0x59, 0x63, 0x01, 0x5B, 0x14, 0xDE, 0x15,
-    0x1F, 0xDF, 0x17, 0x57, 0xE0, 0x5D, 0x26, 0xBB, 0x97, 0x42, 0x46, 0x19, 0x81, 0x40, 0xAA, 0x9B,
-    0x91, 0x36, 0xD8, 0x7A, 0x4F, 0x2D, 0xD3, 0x1A, 0x32, 0xD9, 0xA7, 0x51, 0x17, 0xBD, 0x83, 0x45,
-    0x2B, 0x48, 0xF5, 0x83, 0x0D, 0xEA, 0x0D, 0xD7, 0xDD, 0xE4, 0x2B, 0x7E, 0x72, 0x49, 0x72, 0xA7,
-    0x6B, 0xD6, 0xE7, 0x2C, 0x22, 0xF0, 0xA7, 0xA2, 0xEB, 0x02, 0xBA, 0x5D, 0xC9, 0xE8, 0x24, 0x74,
-    0xD9, 0x5D, 0x79, 0x8B, 0xFA, 0x00, 0x75, 0x8E, 0x9E, 0xD8, 0x49, 0x76, 0x89, 0x23, 0x8B, 0xF8,
-    0xA8, 0x7E, 0xB8, 0x50, 0xA8, 0xF7, 0x28, 0xF1, 0x6C, 0x65, 0xFF, 0x59, 0x6C, 0xDD, 0xCD, 0xC7,
-    0xB6, 0x2F, 0x5E, 0xE4, 0xEE, 0x3B, 0x6F, 0xB5, 0xE0, 0xC4, 0x4A, 0x62, 0xD3, 0xF2, 0xE0, 0xFE,
-    0x1E, 0x45, 0x68, 0xF9, 0xEC, 0x57, 0x93, 0x38, 0xC9, 0x05, 0xAF, 0x7E, 0xB5, 0x50, 0x1A, 0x31,
-    0xD9, 0x5B, 0x65, 0x6F, 0x70, 0x16, 0x08, 0xC2, 0xCC, 0xE7, 0x6E, 0xC0, 0x48, 0x5C, 0xB2, 0xF7,
-    0x47, 0xC8, 0xFE, 0x44, 0xFD, 0x58, 0x34, 0x82, 0x03, 0x8E, 0xE0, 0xAB, 0x66, 0xE4, 0x6B, 0x58,
-    0x3A, 0x5D, 0x26, 0x8D, 0x58, 0xE5, 0x74, 0x41, 0xB5, 0x69, 0x90, 0x54, 0x0D, 0x31, 0xB0, 0xEF,
-    0x15, 0x1D, 0xEB, 0xBF, 0xA4, 0x2C, 0xD9, 0x21, 0x69, 0x44, 0x74, 0xAF, 0xA6, 0xD1, 0x94, 0xC4,
-    0xFA, 0x5C, 0x6A, 0xC4, 0x4D, 0xB5, 0x26, 0x01, 0x64, 0x38, 0x8A, 0x0F, 0x22, 0x3D, 0x13, 0xA4,
-    0xEA, 0x11, 0x92, 0x6A, 0x65, 0xA9, 0x62, 0xC7, 0xD7, 0xCD, 0x10, 0xEF, 0xAB, 0x6B, 0xD0, 0xD6,
-    0x34, 0x91, 0xB6, 0x94, 0x5E, 0x4D, 0x68, 0x7C, 0xE1, 0x3C, 0xEB, 0xC2, 0x59, 0xBD, 0xC8, 0x4C,
-    0x63, 0xF4, 0x89, 0x8D, 0xCE, 0x5D, 0xFD, 0x8F, 0x83, 0x2C, 0x47, 0x90, 0x82, 0xDC, 0x82, 0xD6,
-    0x1F, 0xB4, 0x1E, 0xB5, 0xA8, 0x23, 0x27, 0xDB, 0x82, 0x5A, 0x0D, 0xB2, 0x37, 0x6D, 0xF1, 0x82,
-    0x2B, 0xC7, 0xAD, 0x55, 0x61, 0x6B, 0x73, 0x4B, 0xCA, 0xE1, 0x94, 0x8E, 0xFE, 0x62, 0xFB, 0xA3,
-    0x92, 0xC6, 0x23, 0xED, 0x18, 0xBA, 0xEF, 0x92, 0xB4, 0x13, 0x16, 0x5B, 0xDD, 0xB7, 0xFC, 0xC9,
-    0x1A, 0xCD, 0xEC, 0xB7, 0x62, 0x04, 0xA7, 0xA6, 0xE8, 0x30, 0x76, 0xF4, 0x7B, 0x3A, 0xF7, 0x5B,
-    0x95, 0x95, 0xA0, 0xAD, 0x49, 0x19, 0x36, 0x20, 0xC0, 0xA8, 0x96, 0x06, 0xE4, 0xA6, 0xB5, 0x34,
-    0x47, 0xDB, 0xDB, 0x37, 0x22, 0xEC, 0x8B, 0x1B, 0x42, 0x18, 0x1B, 0xB8, 0x57, 0x95, 0xB0, 0x06,
-    0xE0, 0xD8, 0x8E, 0x76, 0x0A, 0x0E, 0x39, 0x03, 0x32, 0xA9, 0xCB, 0x5D, 0xE4, 0x70, 0xDB, 0xC4,
-    0x9C, 0xA8, 0x89, 0xDC, 0xB0, 0x35, 0x5D, 0xEB, 0x87, 0x9E, 0xD4, 0xC4, 0x37, 0xAE, 0x41, 0x56,
-    0x41, 0xC9, 0xDC, 0x38, 0xEA, 0x13, 0xBB, 0x93, 0x59, 0xEF, 0xDC, 0x71, 0x5A, 0x60, 0xD2, 0xF5,
-    0xBE, 0x00, 0x20, 0xD9, 0xA8, 0x52, 0x3E, 0xA2, 0xE5, 0x7F, 0x58, 0x99, 0x2C, 0x3B, 0x35, 0x94,
-    0x63, 0xA7, 0x14, 0xFB, 0xEE, 0x28, 0xC1, 0x7E, 0xBE, 0x30, 0x41, 0x44, 0x08, 0x26, 0x1A, 0xB4,
-    0x60, 0xC7, 0x30, 0x1F, 0xFE, 0xB5, 0x22, 0xA1, 0xC2, 0x68, 0x9B, 0x00, 0x39, 0xAD, 0x6C, 0x3D,
-    0x8A, 0xA7, 0x17, 0x41, 0xE2, 0x6B, 0xA9, 0x8A, 0x41, 0xA7, 0x1C, 0x64, 0xF5, 0xDE, 0x14, 0x67,
-    0x8E, 0xDC, 0x29, 0x13, 0x90, 0xE4, 0xD4, 0x9B, 0x8D, 0x66, 0xF5, 0xF3, 0x36, 0x87, 0x35, 0x32,
-    0xD1, 0x88, 0xDA, 0xBB, 0x34, 0xBB, 0xD1, 0x0C, 0x5D, 0x83, 0xC3, 0xE9, 0x3D, 0x43, 0xED, 0x0F,
-    0x73, 0xCC, 0xD2, 0x3F, 0xC2, 0x05, 0x60, 0xC1, 0x64, 0xDE, 0x31, 0x99, 0xBC, 0xFA, 0x36, 0x03,
-    0xE1, 0xC0, 0x40, 0x10, 0x12, 0x8A, 0xA0, 0x50, 0x84, 0x85, 0x22, 0x30, 0x14, 0xA1, 0x31, 0xF8,
-    0xD7, 0x28, 0xC2, 0xC2, 0xB4, 0x08, 0x09, 0xC3, 0x61, 0x5A, 0x5A, 0x7F, 0x09, 0x16, 0xC6, 0x45,
-    0x11, 0x30, 0x8A, 0x91, 0x61, 0x68, 0x04, 0x1B, 0x1A, 0xF7, 0x75, 0xD5, 0x23, 0xC3, 0xF1, 0x82,
-    0x5D, 0x12, 0x57, 0xBF, 0xA0, 0x51, 0x79, 0xFF, 0x12, 0x74, 0xD2, 0x85, 0x44, 0x67, 0xBB, 0xDB,
-    0x1B, 0xA0, 0x24, 0x99, 0xFB, 0x04, 0x53, 0x83, 0xB4, 0x31, 0x40, 0xC0, 0x10, 0x2E, 0x04, 0x4B,
-    0x8F, 0xCA, 0xB9, 0xDB, 0x06, 0xB5, 0x6C, 0x9F, 0xFE, 0x0E, 0xBB, 0xE1, 0xAA, 0xB7, 0x93, 0xEA,
-    0x02, 0xD9, 0x49, 0x97, 0xAD, 0xA7, 0x64, 0x3D, 0xE7, 0xEA, 0x0F, 0x31, 0x53, 0x5F, 0x72, 0xA2,
-    0x7E, 0x4E, 0x30, 0x99, 0xDC, 0x87, 0x47, 0xC3, 0xE3, 0x3E, 0x28, 0xD0, 0xAD, 0x43, 0x3E, 0x61,
-    0x45, 0x00, 0xF5, 0xD9, 0xB7, 0x8E, 0x7A, 0x89, 0x13, 0x47, 0x0E, 0xDB, 0xC8, 0x82, 0x23, 0x43,
-    0xC9, 0x73, 0xCA, 0x9D, 0xE3, 0x20, 0x69, 0xCB, 0x61, 0x90, 0x38, 0x27, 0x17, 0xC6, 0x65, 0x93,
-    0xC1, 0x85, 0x32, 0xFE, 0x06, 0x78, 0xAC, 0x73, 0x31, 0x99, 0x83, 0x3D, 0xE2, 0x8F, 0x01, 0xA0,
-    0x1B, 0x64, 0x92, 0x4A, 0x52, 0x74, 0x9C, 0xD0, 0x5F, 0xBA, 0xD4, 0x4F, 0xB2, 0x17, 0xD1, 0x9B,
-    0xC5, 0x1C, 0x36, 0x45, 0x62, 0x14, 0xA8, 0x53, 0x02, 0x9B, 0x02, 0xBB, 0x6F, 0x7B, 0x2A, 0x1B,
-    0x7B, 0xBD, 0xC5, 0x69, 0x5E, 0x2F, 0x0A, 0xC1, 0x83, 0x21, 0x79, 0x9F, 0x34, 0xCA, 0xC2, 0xB8,
-    0xCD, 0x6E, 0xB8, 0x20, 0x05, 0xAD, 0x67, 0xB3, 0xBF, 0x0E, 0x60, 0xCB, 0x19, 0xB2, 0x0A, 0xEE,
-    0x29, 0x48, 0xE4, 0xFF, 0xAF, 0x37, 0xF6, 0xC7, 0x61, 0x21, 0x3F, 0xC3, 0x06, 0xEB, 0x46, 0x3F,
-    0xD5, 0xFF, 0xB0, 0x56, 0xAB, 0x98, 0x40, 0xC7, 0xF8, 0x11, 0xC7, 0x84, 0x4B, 0xFA, 0x1D, 0xCA,
-    0x93, 0xF4, 0x1E, 0x3B, 0x8C, 0x1F, 0xDF, 0xC8, 0x99, 0xF5, 0x5A, 0x6F, 0x7E, 0x36, 0x4C, 0x2C,
-    0x29, 0xBE, 0xCF, 0x93, 0xCF, 0x8E, 0x89, 0xDB, 0x31, 0x8D, 0xC5, 0x96, 0x6B, 0x14, 0xA2, 0xF4,
-    0x1D, 0x5C, 0x72, 0x8E, 0x7F, 0x9E, 0xF3, 0xE7, 0xEA, 0xCD, 0xF1, 0xFF, 0xA2, 0x31, 0x91, 0xD2,
-    0x0C, 0x22, 0x25, 0x2B, 0x23, 0xAB, 0x0A, 0x34, 0x05, 0x4B, 0xD9, 0xD1, 0xCF, 0xE0, 0x7B, 0xD4,
-    0xB3, 0x0C, 0xD7, 0x8E, 0x18, 0x15, 0x14, 0xD5, 0x13, 0xDE, 0x98, 0x1F, 0xF0, 0x34, 0xA9, 0x2D,
-    0x7C, 0x91, 0x70, 0x46, 0x20, 0xAB, 0x87, 0x44, 0xD3, 0xA2, 0x3A, 0xFD, 0x26, 0x92, 0x55, 0xC3,
-    0x1B, 0x12, 0x26, 0xDC, 0x67, 0x1A, 0x52, 0xB6, 0xC1, 0x3C, 0x0F, 0x13, 0x1B, 0xF0, 0x09, 0xA6,
-    0x1D, 0x12, 0xB8, 0x49, 0x57, 0x13, 0x1C, 0x68, 0xC8, 0x69, 0x06, 0x70, 0xC1, 0x3F, 0xA7, 0xD1,
-    0xDF, 0x18, 0x6D, 0x59, 0x7D, 0xAE, 0x8C, 0x7B, 0xA6, 0x24, 0x91, 0xD1, 0x11, 0xC9, 0x9B, 0x58,
-    0xFB, 0x6C, 0xC0, 0x5B, 0xE4, 0x1F, 0xB6, 0x3C, 0xFD, 0xE4, 0x18, 0xA5, 0x03, 0xC3, 0xC8, 0x65,
-    0x83, 0xFE, 0x21, 0x5C, 0xCC, 0x8C, 0xC3, 0xC8, 0x7C, 0x8D, 0xF6, 0xEA, 0xBD, 0xB4, 0xA5, 0x2B,
-    0xF9, 0x2E, 0xB8, 0x1D, 0x3A, 0xE1, 0xAF, 0x1C, 0x50, 0xC5, 0x92, 0xCD, 0x0E, 0xE6, 0x20, 0xF1,
-    0x0F, 0x07, 0x63, 0xBE, 0x1D, 0x77, 0x33, 0x1B, 0xA9, 0x86, 0xB4, 0x8A, 0xB5, 0x6A, 0xA4, 0x24,
-    0x41, 0x2B, 0x9A, 0x42, 0x5F, 0xFD, 0x3A, 0xA0, 0x05, 0x71, 0x5D, 0xF6, 0x28, 0x38, 0xEB, 0x6E,
-    0x65, 0xF1, 0x60, 0x9F, 0xC2, 0x2E, 0x07, 0x3C, 0x5F, 0x20, 0xBC, 0xAD, 0x6C, 0x4F, 0x71, 0x02,
-    0x4A, 0xD1, 0x7C, 0x07, 0xDF, 0x73, 0xA5, 0x16, 0x17, 0xE4, 0x79, 0x55, 0xEF, 0x7A, 0x6F, 0x0E,
-    0x37, 0xE9, 0x5E, 0x04, 0x7D, 0x72, 0xFE, 0xD0, 0x5B, 0x0F, 0x38, 0xFD, 0xC5, 0x40, 0x91, 0x6F,
-    0x13, 0xB4, 0x7E, 0x4C, 0x19, 0xC4, 0x9F, 0x13, 0xFE, 0x21, 0xE5, 0xEF, 0x6A, 0xB7, 0xE2, 0x54,
-    0x45, 0x73, 0x32, 0x59, 0x7C, 0x31, 0x2C, 0x77, 0x58, 0x4B, 0xF6, 0x10, 0x41, 0x79, 0x4A, 0x0F,
-    0xA2, 0x20, 0xEF, 0x9F, 0x1C, 0xE4, 0x9D, 0xBE, 0x83, 0x3C, 0x07, 0x48, 0xF2, 0x2E, 0xA7, 0x41,
-    0xD1, 0x60, 0xB4, 0xC9, 0x86, 0x3A, 0x89, 0x78, 0x16, 0xD6, 0xC1, 0x00, 0x49, 0xAF, 0x50, 0xB3,
-    0x8B, 0x88, 0xE4, 0xF6, 0xA0, 0x6C, 0x92, 0xF7, 0x7B, 0xDD, 0xA7, 0xC4, 0xD4, 0x6F, 0x39, 0xEF,
-    0x3C, 0xEF, 0x48, 0x0E, 0x52, 0xF4, 0x19, 0xAF, 0xE7, 0x5F, 0x96, 0xC3, 0x39, 0xD4, 0x1D, 0x59,
-    0xE8, 0x4F, 0x97, 0xCA, 0x42, 0x79, 0x8A, 0x1A, 0x56, 0x83, 0xF1, 0xAC, 0x7A, 0x07, 0xE1, 0xFA,
-    0x8C, 0x1E, 0x4A, 0xD5, 0x60, 0xF3, 0x8F, 0xF1, 0x2D, 0xA2, 0xE0, 0x41, 0x6F, 0x50, 0x96, 0x9E,
-    0x83, 0x9C, 0x4F, 0x68, 0x1D, 0x59, 0x93, 0x72, 0x9F, 0xF1, 0x5A, 0x1B, 0x71, 0xAE, 0x72, 0x39,
-    0xA0, 0xEE, 0x8A, 0xBD, 0xA6, 0x28, 0xBC, 0xAF, 0x41, 0x78, 0x75, 0x82, 0x9B, 0x3F, 0x85, 0x3B,
-    0x1B, 0xEC, 0x5B, 0x91, 0x24, 0x16, 0xC5, 0xA8, 0xD7, 0xB8, 0xD8, 0x37, 0xD4, 0xE2, 0x39, 0xA5,
-    0x03, 0x34, 0x1B, 0x99, 0x90, 0xC9, 0x69, 0x58, 0xC5, 0xD8, 0x76, 0xB9, 0x9D, 0x62, 0xF5, 0x82,
-    0x0A, 0x2E, 0x03, 0x70, 0x70, 0x06, 0x80, 0xE7, 0xD9, 0x89, 0xBE, 0x2A, 0x85, 0xDF, 0x91, 0x58,
-    0x6F, 0x22, 0x09, 0x02, 0x89, 0x95, 0x9C, 0xD9, 0xB8, 0xD6, 0x07, 0x19, 0x35, 0x7E, 0x23, 0x2C,
-    0x09, 0xA4, 0x12, 0x98, 0xE0, 0x40, 0x9D, 0xC8, 0x0A, 0x56, 0x8A, 0xB0, 0x60, 0xAD, 0xF0, 0xA7,
-    0xAC, 0x16, 0x7E, 0x4E, 0x38, 0xCD, 0x42, 0x51, 0x8C, 0x46, 0x34, 0x03, 0x42, 0x3B, 0xD9, 0x41,
-    0x15, 0x8C, 0x3B, 0x2A, 0x1A, 0xF0, 0x52, 0x2A, 0x2A, 0xD2, 0xDD, 0x27, 0x4A, 0x22, 0xFD, 0xA7,
-    0x4A, 0xD4, 0xC4, 0xE8, 0x89, 0x51, 0x14, 0xBE, 0x16, 0x39, 0x12, 0x55, 0x41, 0x5D, 0x69, 0xD5,
-    0x40, 0x59, 0x7A, 0x6D, 0xA1, 0xF4, 0x8F, 0x23, 0x5B, 0x97, 0x7D, 0x01, 0x70, 0x34, 0x95, 0x5C,
-    0xEF, 0x16, 0x9A, 0x88, 0x43, 0xC2, 0x73, 0x5B, 0x44, 0x1F, 0xAE, 0x02, 0xF4, 0x6D, 0x4D, 0xE8,
-    0x3F, 0x22, 0xF3, 0xBE, 0x83, 0xE8, 0xD7, 0x35, 0xA2, 0xAF, 0x31, 0x13, 0xE2, 0xEB, 0xF8, 0x0D,
-    0xA2, 0xBF, 0x76, 0x20, 0x75, 0x39, 0xB2, 0xA3, 0x64, 0x36, 0xD5, 0x55, 0x24, 0x18, 0x7A, 0xE2,
-    0x98, 0x99, 0x83, 0x3A, 0x68, 0xE3, 0xCB, 0x83, 0xA9, 0x45, 0x88, 0xCA, 0xBE, 0x37, 0xEF, 0x62,
-    0x78, 0x1C, 0x26, 0x69, 0xB3, 0x39, 0xB1, 0x85, 0x33, 0xDF, 0x5C, 0x61, 0x7A, 0x7C, 0x05, 0x36,
-    0xE1, 0xAE, 0x89, 0x77, 0xBB, 0x80, 0xD7, 0x1C, 0xC6, 0x90, 0x90, 0xB7, 0xAB, 0xCD, 0xB3, 0x8D,
-    0xFD, 0xEE, 0x2F, 0x95, 0xFD, 0xBE, 0x5A, 0x4C, 0xBC, 0x85, 0xB2, 0x99, 0x2F, 0xDC, 0x3F, 0x56,
-    0xAB, 0x5C, 0x41, 0x31, 0x0D, 0xB9, 0x50, 0xE4, 0x28, 0xE1, 0x42, 0x18, 0xBE, 0x28, 0x7C, 0x9F,
-    0xAB, 0xEA, 0x42, 0x95, 0x48, 0xD1, 0x90, 0xB5, 0x54, 0xF8, 0x4E, 0xF6, 0x70, 0x43, 0x2B, 0x6A,
-    0x1C, 0xDA, 0x6C, 0xBC, 0x57, 0x50, 0xFD, 0x0A, 0xAC, 0xB9, 0xB8, 0x0D, 0xAD, 0x9C, 0xA9, 0xD7,
-    0x22, 0xA6, 0x6A, 0x7D, 0xFE, 0x6C, 0x79, 0xA9, 0xD6, 0xD0, 0xB1, 0xCF, 0x65, 0x9C, 0x2E, 0xE3,
-    0x6E, 0x75, 0x54, 0xFC, 0xAE, 0x61, 0x66, 0x6E, 0x8B, 0x94, 0x7F, 0x0E, 0x67, 0xE2, 0x97, 0xFB,
-    0x56, 0xB8, 0x97, 0x17, 0xE8, 0x19, 0x90, 0x02, 0x88, 0x0B, 0x5D, 0xE0, 0xE5, 0xB8, 0xEC, 0x44,
-    0xEA, 0xDB, 0x22, 0x88, 0xF5, 0x5D, 0x45, 0x2A, 0x03, 0x1C, 0x45, 0x2D, 0x6D, 0x87, 0xF8, 0xFA,
-    0x8B, 0x9D, 0x12, 0xF1, 0xE4, 0x9C, 0xFD, 0x8E, 0xD4, 0xEA, 0x6D, 0x8F, 0xB0, 0xBB, 0x3D, 0x38,
-    0xD4, 0x62, 0xCA, 0xF2, 0x1C, 0xAE, 0xD2, 0x33, 0xFE, 0xC5, 0x20, 0x7D, 0x1E, 0xE9, 0x29, 0xFC,
-    0x33, 0x04, 0xAE, 0x93, 0xFC, 0xBD, 0xCD, 0xC4, 0xFA, 0xDF, 0x08, 0xF7, 0x52, 0xD0, 0xE3, 0x75,
-    0xC9, 0xA4, 0xF2, 0x35, 0xC5, 0x67, 0x2D, 0x71, 0xAA, 0x6B, 0x74, 0xFD, 0x3D, 0x88, 0x21, 0x50,
-    0xB5, 0x6E, 0xA8, 0xD7, 0xF3, 0xFC, 0xC7, 0x87, 0x9F, 0xA4, 0x4A, 0xD5, 0x7F, 0xBF, 0x19, 0x9E,
-    0x72, 0x96, 0x43, 0xCE, 0x72, 0xC6, 0x59, 0x8E, 0x38, 0x4B, 0x05, 0xF4, 0xB0, 0xF2, 0xEA, 0x42,
-    0x28, 0x43, 0xC8, 0xA2, 0x63, 0x33, 0xB7, 0x4A, 0xCE, 0x6B, 0xC5, 0xC2, 0x34, 0x57, 0x92, 0x59,
-    0x2C, 0x56, 0x8F, 0xAF, 0xF4, 0xF2, 0x51, 0x85, 0xB8, 0x9A, 0x77, 0x0D, 0xB1, 0xBB, 0x53, 0x50,
-    0xE9, 0x68, 0xA6, 0x0A, 0xC5, 0x8B, 0x4A, 0x84, 0x91, 0xB6, 0x9F, 0x9E, 0x6C, 0x59, 0x77, 0xBD,
-    0x86, 0x30, 0x6E, 0x7D, 0x01, 0xD9, 0x6B, 0x27, 0x88, 0x72, 0x66, 0xB7, 0x22, 0xEF, 0x99, 0x50,
-    0x2E, 0xBF, 0x8C, 0xC0, 0x31, 0x23, 0xBA, 0x23, 0x6A, 0x30, 0x13, 0x5C, 0xE2, 0x0E, 0x9F, 0x37,
-    0x46, 0x05, 0x78, 0x42, 0x1E, 0x33, 0x57, 0x02, 0x3D, 0x61, 0x4F, 0x45, 0x73, 0x5A, 0xB3, 0xCA,
-    0xEF, 0x68, 0x61, 0x74, 0x5B, 0xC2, 0xDB, 0xEB, 0x0F, 0x44, 0x0E, 0x22, 0x0F, 0x29, 0xD3, 0xB5,
-    0x65, 0x02, 0x37, 0xBB, 0xF8, 0xE8, 0x8B, 0x5E, 0xE1, 0xF4, 0x81, 0xD2, 0x6A, 0x54, 0xDB, 0x0D,
-    0x93, 0x05, 0x00, 0x9E, 0x80, 0xDC, 0x73, 0xC6, 0x3E, 0xCC, 0x19, 0xFC, 0x20, 0xB6, 0x09, 0xB7,
-    0x88, 0x61, 0x7C, 0xDA, 0x30, 0x35, 0xB0, 0xFE, 0x5D, 0x19, 0x78, 0x5F, 0x85, 0xDA, 0x4C, 0x59,
-    0x11, 0x8C, 0x26, 0x18, 0x55, 0x30, 0xBA, 0x60, 0x94, 0x01, 0xB4, 0xA1, 0x20, 0x6D, 0xE8, 0xD4,
-    0xE1, 0x60, 0x7F, 0xCC, 0x6E, 0x60, 0x7E, 0xD9, 0xC0, 0xD4, 0xF4, 0x8A, 0x93, 0xDD, 0x9D, 0x80,
-    0x86, 0xE8, 0x78, 0x89, 0xF4, 0xC1, 0x68, 0x43, 0x28, 0x62, 0xF1, 0x8E, 0x61, 0xAD, 0xA2, 0xBC,
-    0x4F, 0x1E, 0x5C, 0x11, 0x7B, 0x59, 0x64, 0x7D, 0x38, 0x7E, 0x1C, 0xD6, 0x1C, 0x5C, 0x90, 0x35,
-    0xE1, 0xEC, 0x3F, 0x7D, 0x71, 0x6D, 0xB9, 0xE6, 0x0D, 0x59, 0x37, 0x64, 0xE1, 0xE8, 0x56, 0x8E,
-    0x6E, 0xE9, 0x90, 0xB5, 0xC3, 0x2C, 0x1E, 0x66, 0xF5, 0xA0, 0xE5, 0xE3, 0x8A, 0xAC, 0x1F, 0x8B,
-    0xAC, 0x37, 0xF6, 0x1E, 0x3B, 0xB2, 0x61, 0xCB, 0x27, 0xBF, 0x12, 0xFD, 0xA7, 0x52, 0x8E, 0x5D,
-    0x93, 0x16, 0xD4, 0x21, 0x2D, 0xB6, 0x56, 0x69, 0x26, 0x52, 0xB5, 0xBE, 0x54, 0xFA, 0xF1, 0x31,
-    0x6F, 0x32, 0x41, 0xB4, 0xB1, 0xC9, 0xC1, 0xED, 0xD1, 0x43, 0xCE, 0x4F, 0x73, 0x70, 0x1B, 0x71,
-    0xFC, 0x0E, 0xD6, 0x93, 0x4D, 0x79, 0x1E, 0x51, 0x8B, 0x3F, 0x8F, 0x2C, 0x95, 0xDF, 0x30, 0x8E,
-    0x22, 0x4C, 0x18, 0xD1, 0x1D, 0xEF, 0x91, 0x40, 0xA2, 0xCF, 0x54, 0x0E, 0x3C, 0xE7, 0x8B, 0x82,
-    0xF7, 0x6B, 0x04, 0xC0, 0xC6, 0x1B, 0x15, 0x29, 0x45, 0xB2, 0xD8, 0x34, 0x83, 0x93, 0x84, 0xA6,
-    0x0E, 0x9C, 0xB3, 0x44, 0x22, 0x29, 0xAD, 0xE3, 0x8C, 0xAA, 0xFD, 0x52, 0xAD, 0xCB, 0x40, 0x1F,
-    0x61, 0x26, 0x18, 0xF7, 0xA6, 0xEC, 0x19, 0x48, 0xBE, 0x24, 0xCC, 0x80, 0xE0, 0xF6, 0x3C, 0xC4,
-    0xFC, 0xF8, 0x33, 0x44, 0x10, 0x04, 0xE3, 0x54, 0x1B, 0x42, 0x08, 0x9C, 0xD2, 0x11, 0xA7, 0x90,
-    0x0F, 0x1D, 0x6E, 0x72, 0xEA, 0xFB, 0x90, 0xAB, 0x12, 0xB9, 0x3A, 0xF0, 0x39, 0xCD, 0x5C, 0xC9,
-    0x7F, 0x0A, 0xF6, 0xE2, 0x73, 0x1E, 0x7F, 0x3A, 0x38, 0x03, 0x7F, 0x76, 0xC2, 0xD3, 0x9E, 0xCF,
-    0xFB, 0x34, 0x42, 0x6E, 0xDD, 0xEF, 0x77, 0x23, 0xFC, 0x76, 0xE0, 0x5D, 0xB2, 0xEF, 0xCD, 0x67,
-    0xA7, 0xAD, 0x63, 0x7A, 0x05, 0x13, 0x45, 0xA0, 0x0B, 0xAD, 0x6B, 0x68, 0x7D, 0x9D, 0x5A, 0x9A,
-    0xCE, 0x67, 0x35, 0xE4, 0xC7, 0x37, 0xA8, 0x6E, 0x16, 0x56, 0x51, 0x4E, 0x91, 0x57, 0x00, 0x0F,
-    0x0B, 0x6D, 0x4B, 0xDC, 0xCE, 0x8B, 0x6A, 0xAC, 0x41, 0x0F, 0x1B, 0xE4, 0x3A, 0x68, 0x02, 0x7A,
-    0x62, 0x44, 0x13, 0xD1, 0x06, 0x71, 0x7E, 0x48, 0x4F, 0x67, 0xBE, 0xAB, 0x3E, 0x69, 0xCC, 0xA9,
-    0x36, 0x76, 0x6E, 0xA4, 0x8D, 0xBB, 0xCA, 0x6F, 0x5E, 0xC3, 0xDC, 0xA6, 0x0B, 0x1B, 0x7E, 0x44,
-    0xF0, 0xF1, 0x96, 0xE9, 0xF5, 0xAD, 0xC5, 0x07, 0xE8, 0xB8, 0x4E, 0xFF, 0x61, 0x7C, 0x5F, 0x3C,
-    0xF8, 0x4B, 0x1C, 0x42, 0xF9, 0x2D, 0x84, 0x39, 0x02, 0x0A, 0x0D, 0xD1, 0x6A, 0x71, 0x94, 0x6E,
-    0x83, 0x6D, 0x08, 0x96, 0x8C, 0x40, 0xE1, 0xB6, 0x9C, 0x8E, 0x61, 0xBC, 0x0C, 0x54, 0xBF, 0xCD,
-    0xCF, 0x6C, 0x85, 0x6C, 0x89, 0xEF, 0xF2, 0x66, 0xD8, 0x0A, 0xFF, 0x82, 0x97, 0xD9, 0x1A, 0x93,
-    0xD8, 0x50, 0x4C, 0x58, 0x1C, 0xC0, 0xFB, 0x17, 0xC5, 0x2C, 0x59, 0x96, 0x36, 0x2D, 0xC8, 0xCE,
-    0x94, 0x74, 0x3C, 0x66, 0x2F, 0xEE, 0x11, 0xE5, 0x61, 0x9B, 0xFE, 0xEC, 0x98, 0x1F, 0xF7, 0xED,
-    0xA2, 0x9A, 0xA8, 0x52, 0x57, 0x63, 0x8B, 0xBB, 0xF3, 0xA9, 0xBA, 0xB8, 0xDD, 0x49, 0xF1, 0xA1,
-    0x2C, 0x92, 0xC7, 0xB4, 0xBE, 0xF9, 0x71, 0x58, 0x8F, 0x7E, 0x4F, 0x69, 0xE1, 0x41, 0x9E, 0x90,
-    0x9F, 0xCA, 0x5E, 0x2A, 0xFB, 0xA8, 0xE4, 0xA1, 0x5A, 0xE4, 0x9F, 0x76, 0xDE, 0xE9, 0xFA, 0x22,
-    0x03, 0xFB, 0x5F, 0xBD, 0x59, 0xBD, 0xAF, 0x1D, 0x47, 0x15, 0x3F, 0xBB, 0x1B, 0xDF, 0x0D, 0x6F,
-    0x85, 0xD6, 0x85, 0x8D, 0x22, 0x9B, 0x64, 0x53, 0x82, 0x91, 0xB3, 0x0D, 0x05, 0x45, 0xFC, 0x66,
-    0x9C, 0x14, 0x29, 0x52, 0xE4, 0x15, 0x7E, 0x42, 0xA4, 0x80, 0x16, 0x9C, 0xC2, 0x69, 0x22, 0x45,
-    0x08, 0xBF, 0x5D, 0x94, 0x82, 0xF6, 0x15, 0x48, 0x94, 0xB8, 0x70, 0x84, 0xF3, 0x8A, 0x98, 0x82,
-    0x22, 0x02, 0xFB, 0xED, 0x46, 0xF9, 0x03, 0x58, 0x82, 0x00, 0x09, 0x8A, 0x2C, 0x60, 0x1A, 0x1A,
-    0x8F, 0xA2, 0x09, 0xD9, 0xD8, 0xBB, 0x77, 0xF8, 0x9D, 0x33, 0xBB, 0xF7, 0xDE, 0x77, 0x9F, 0x3F,
-    0x40, 0x5C, 0xB3, 0xDA, 0x7B, 0x66, 0x76, 0x77, 0xE6, 0x9C, 0x33, 0xE7, 0x9C, 0x39, 0x1F, 0x73,
-    0x77, 0xCC, 0x23, 0xAE, 0x53, 0x81, 0x3E, 0x1F, 0x97, 0xC9, 0x77, 0x29, 0xEC, 0x28, 0xB0, 0x14,
-    0x0F, 0xF4, 0xDC, 0x7D, 0xFD, 0xAD, 0x4F, 0x6B, 0x32, 0xB4, 0x81, 0x7B, 0x87, 0xE8, 0x57, 0x44,
-    0xE7, 0xE9, 0xF2, 0x4D, 0xED, 0x5C, 0x69, 0x9E, 0x23, 0xF3, 0x36, 0x99, 0x6B, 0x1B, 0x40, 0x7C,
-    0x8D, 0x28, 0xD0, 0x14, 0x97, 0xF4, 0x1C, 0xD1, 0xDE, 0x81, 0xAE, 0x5C, 0x7D, 0x3E, 0xAA, 0x93,
-    0x97, 0xEB, 0xF0, 0x9D, 0x9A, 0xA2, 0xFF, 0xFD, 0x2E, 0x89, 0x48, 0xB9, 0x6E, 0x71, 0xAF, 0x3D,
-    0x2A, 0xE7, 0x9C, 0x15, 0x70, 0xEE, 0xE0, 0xE0, 0xE0, 0xFA, 0xE9, 0x5D, 0x5C, 0xFC, 0xE8, 0x04,
-    0xC8, 0xA3, 0x00, 0xBE, 0x2E, 0xC9, 0x3B, 0xBE, 0xBA, 0x65, 0x6F, 0xF1, 0x15, 0x02, 0x9A, 0xAE,
-    0x07, 0x8D, 0x5B, 0x7E, 0xFD, 0x3A, 0x5D, 0xDB, 0x0E, 0xEC, 0xFF, 0xF3, 0x5E, 0x30, 0x55, 0x0A,
-    0x58, 0xB2, 0xC2, 0x6B, 0xD6, 0xF2, 0x4E, 0x7A, 0xF4, 0x4C, 0xD0, 0x27, 0x77, 0x72, 0xBD, 0x4D,
-    0x87, 0xE4, 0x4A, 0x67, 0x9C, 0xA9, 0x8C, 0x32, 0x5B, 0xE5, 0x6C, 0x3F, 0xEB, 0xF2, 0x3E, 0x1F,
-    0xB2, 0x01, 0x46, 0xD5, 0x53, 0x17, 0x99, 0xBC, 0xDE, 0xA3, 0x93, 0xB4, 0xFE, 0x3E, 0x34, 0x59,
-    0xB3, 0x47, 0xCF, 0x53, 0x52, 0x2A, 0xCC, 0xE4, 0xF9, 0xAE, 0x3C, 0xA4, 0x6D, 0xCA, 0x75, 0x62,
-    0x83, 0x9E, 0x4E, 0xD1, 0x33, 0x74, 0x2A, 0xE8, 0xC3, 0x2E, 0xB9, 0x93, 0xB6, 0xB9, 0xCE, 0xF1,
-    0xE5, 0x2A, 0x28, 0xDD, 0x66, 0x5A, 0x4C, 0xAD, 0xF5, 0x14, 0x99, 0xA6, 0x6A, 0xB7, 0xCA, 0x2D,
-    0x3D, 0xDB, 0x4F, 0x98, 0x82, 0xCD, 0x7B, 0x05, 0x2A, 0xAA, 0xCF, 0x86, 0xAC, 0x8F, 0x87, 0xB8,
-    0xA7, 0x1E, 0xD8, 0xBA, 0xC0, 0x46, 0x86, 0x39, 0x61, 0x5E, 0x98, 0x9B, 0x1D, 0xF0, 0x33, 0x5B,
-    0x1B, 0x9F, 0xAF, 0x8E, 0x07, 0x7F, 0x11, 0x38, 0xF4, 0xE3, 0x9F, 0xC7, 0xF8, 0xA4, 0x64, 0x4E,
-    0x17, 0xBC, 0x1A, 0xE1, 0xA1, 0x64, 0x9E, 0x6F, 0x0B, 0x6F, 0xE0, 0x11, 0x9C, 0x27, 0x6D, 0xD0,
-    0x07, 0x1D, 0xB8, 0x3F, 0x45, 0x5B, 0x30, 0xD6, 0xD4, 0x2C, 0x7F, 0x49, 0x8B, 0x5F, 0x43, 0x14,
-    0xE3, 0x07, 0x63, 0xAB, 0x7E, 0xF1, 0xE7, 0x79, 0xE5, 0x9C, 0xFC, 0x7E, 0xFD, 0xCA, 0x87, 0xEF,
-    0xCB, 0x77, 0x1E, 0x97, 0x41, 0x05, 0x79, 0xE7, 0x5B, 0xFE, 0x1D, 0xC3, 0xB1, 0x82, 0x27, 0xAE,
-    0xFD, 0x2F, 0x7A, 0xC8, 0x8F, 0xAF, 0x55, 0x3E, 0x78, 0x2E, 0xE6, 0xED, 0x44, 0xF5, 0x89, 0xEA,
-    0xFE, 0xDD, 0x05, 0xFD, 0x77, 0xE3, 0xFA, 0x3B, 0x0B, 0xFA, 0xF9, 0x48, 0x97, 0x9F, 0x57, 0x71,
-    0x31, 0x3D, 0xF9, 0xDE, 0x2D, 0xF9, 0xC2, 0x98, 0xC3, 0x6F, 0xFF, 0xE1, 0x70, 0xC2, 0x73, 0xF8,
-    0xB3, 0x3F, 0xCE, 0x85, 0x1F, 0xE6, 0x2F, 0x6D, 0x97, 0x74, 0xF9, 0x3A, 0x49, 0x09, 0xDB, 0x54,
-    0x5B, 0x38, 0x5B, 0xB9, 0xCE, 0xB9, 0xDE, 0xDF, 0xE8, 0x17, 0xBC, 0xAB, 0x4C, 0xEA, 0xEA, 0xE0,
-    0x5D, 0x19, 0xF9, 0x4D, 0xB6, 0x40, 0x8D, 0x9F, 0x65, 0x4B, 0xD4, 0xF8, 0x59, 0xB6, 0x48, 0x18,
-    0xDF, 0x80, 0xB6, 0x21, 0x35, 0xE0, 0x3D, 0x28, 0x5C, 0x10, 0xAC, 0x70, 0x09, 0x94, 0x9B, 0xC2,
-    0x56, 0x5D, 0xD1, 0xB1, 0x01, 0x06, 0x04, 0xE1, 0xE7, 0x26, 0x70, 0xBA, 0xB0, 0x91, 0xAB, 0xAB,
-    0x0E, 0xA0, 0x60, 0xA0, 0x4C, 0xE8, 0xCA, 0xAD, 0x92, 0x7E, 0x40, 0x5B, 0xFB, 0x74, 0x46, 0xD3,
-    0x39, 0x26, 0x50, 0xB5, 0xC4, 0x9F, 0xC9, 0xE1, 0x63, 0x5B, 0xF4, 0xBE, 0x55, 0xFC, 0x1C, 0xB8,
-    0x26, 0x37, 0x54, 0x34, 0x54, 0x31, 0x4A, 0xDC, 0x4F, 0xD1, 0x16, 0x2C, 0xA0, 0xE8, 0x40, 0xC8,
-    0xE6, 0x6D, 0x40, 0x97, 0x0F, 0x4A, 0xE7, 0xEA, 0x8D, 0x38, 0x4C, 0x7F, 0xFF, 0x92, 0x08, 0x1B,
-    0x0B, 0x38, 0x37, 0xE1, 0xCB, 0x96, 0x4E, 0xAD, 0x70, 0xCD, 0x03, 0xEF, 0x8D, 0x30, 0x0D, 0x3C,
-    0x3F, 0x3C, 0x28, 0xDF, 0x24, 0x5A, 0xDC, 0x6F, 0xED, 0xEA, 0x0D, 0x22, 0x3F, 0x77, 0x00, 0x45,
-    0x2F, 0xEF, 0xD3, 0xBB, 0x1B, 0xE3, 0x7C, 0xF5, 0x0A, 0x60, 0x61, 0x62, 0x4E, 0xB8, 0x12, 0x37,
-    0x27, 0xBA, 0xE5, 0xFB, 0x59, 0x5B, 0x69, 0x1A, 0xDD, 0xB1, 0xAA, 0x55, 0x1D, 0x8E, 0xD3, 0x8A,
-    0x5A, 0x35, 0xD1, 0xD4, 0x2F, 0xF3, 0x96, 0xED, 0x9D, 0xAF, 0x0A, 0xFD, 0xB4, 0x5E, 0xF4, 0x4D,
-    0xAE, 0x97, 0x7D, 0x45, 0xCB, 0x31, 0xB7, 0x57, 0xFA, 0x3D, 0x87, 0x4B, 0x44, 0xB5, 0xA2, 0xCE,
-    0x3F, 0xB6, 0x39, 0xCC, 0xBD, 0x98, 0x33, 0xAD, 0x8F, 0x8C, 0xBB, 0xD9, 0x86, 0xAE, 0xAA, 0xF3,
-    0xA6, 0xF8, 0xC9, 0xC7, 0x43, 0x62, 0xE3, 0x2E, 0x6B, 0xD3, 0xCF, 0x5C, 0xFA, 0x51, 0x1F, 0xF5,
-    0xA9, 0x49, 0x61, 0xA7, 0x5D, 0xF6, 0x4A, 0xC7, 0xFD, 0xC4, 0xD2, 0x69, 0xAD, 0x92, 0x2E, 0x1C,
-    0xB2, 0x36, 0x61, 0x6E, 0xF7, 0x12, 0x1B, 0xCE, 0xF3, 0x16, 0xCE, 0x8C, 0xA8, 0x4F, 0x17, 0xFD,
-    0xA0, 0x5B, 0xF6, 0x23, 0xB3, 0x1C, 0x13, 0xB7, 0xCB, 0xB9, 0x69, 0x1D, 0x77, 0xD1, 0x20, 0x38,
-    0x29, 0x2B, 0xA3, 0x91, 0x16, 0x56, 0x4F, 0xE1, 0x10, 0x0B, 0x0F, 0x40, 0x4F, 0xC4, 0xBC, 0xCD,
-    0x2B, 0xAC, 0x14, 0xD3, 0x99, 0xE7, 0x6A, 0x3E, 0x0A, 0x72, 0xC7, 0xFF, 0xD6, 0xAE, 0x55, 0xF9,
-    0xAE, 0xCB, 0x78, 0x5D, 0xCE, 0xEB, 0xB2, 0x5E, 0x97, 0xF7, 0xBA, 0xCC, 0xD7, 0xE5, 0xBE, 0x2E,
-    0xFB, 0x75, 0xF9, 0xAF, 0xEB, 0xE0, 0x88, 0x1E, 0x48, 0x7B, 0x5D, 0x94, 0xA3, 0x2E, 0x14, 0xF8,
-    0xAC, 0x86, 0x85, 0x3E, 0x02, 0xE8, 0x23, 0x9A, 0xBB, 0x72, 0xD2, 0x89, 0x97, 0x7E, 0xDE, 0x4C,
-    0x7A, 0x41, 0x00, 0xB0, 0x47, 0x75, 0x23, 0x5A, 0x33, 0x93, 0x7E, 0x52, 0x13, 0xF5, 0x18, 0x6D,
-    0x27, 0x1D, 0x65, 0x78, 0x56, 0x8D, 0xE8, 0x4C, 0xF4, 0xB4, 0x7C, 0xF6, 0xBA, 0x5A, 0x3E, 0x7B,
-    0x7D, 0x2D, 0x9F, 0xBD, 0xCE, 0x96, 0xF8, 0x26, 0xBD, 0x8D, 0xF4, 0x46, 0xDD, 0x4D, 0xFC, 0x4C,
-    0xFA, 0x13, 0x7E, 0x4D, 0xDE, 0x4C, 0x3A, 0xF4, 0xEB, 0xA9, 0xCA, 0x85, 0x1E, 0x0B, 0xBF, 0xDE,
-    0x23, 0xBA, 0x3C, 0xA1, 0xA1, 0x2F, 0x9D, 0x3A, 0x4A, 0x07, 0xCA, 0x7A, 0xF6, 0xFD, 0xF0, 0x8B,
-    0xAA, 0x26, 0x55, 0x92, 0x1A, 0xB5, 0xF9, 0x92, 0x6B, 0x52, 0x07, 0x17, 0x9B, 0x0E, 0x91, 0xD3,
-    0x88, 0xBB, 0x0E, 0xA3, 0x10, 0xE6, 0x73, 0x93, 0xF4, 0x18, 0x09, 0xFA, 0xAA, 0x44, 0x38, 0x50,
-    0x34, 0xE9, 0x48, 0x66, 0x54, 0x56, 0xE6, 0xC0, 0xF3, 0xF3, 0x2C, 0xD7, 0xF0, 0xBC, 0xC0, 0xD5,
-    0x3C, 0x13, 0xCE, 0x9B, 0xE7, 0x86, 0x4E, 0x66, 0x47, 0xBD, 0xCC, 0x8F, 0x3A, 0xC1, 0xB0, 0xB4,
-    0x03, 0xD5, 0x53, 0x3E, 0x30, 0x57, 0xF1, 0x9C, 0x22, 0x07, 0x23, 0xC3, 0x9A, 0x60, 0x1B, 0x9A,
-    0x72, 0x49, 0xE4, 0x7A, 0xB0, 0x9C, 0x0F, 0xCC, 0x3A, 0xE3, 0x8F, 0xE7, 0x81, 0x2B, 0x31, 0x0A,
-    0x51, 0xC6, 0xC1, 0x9E, 0x88, 0x51, 0x63, 0x6C, 0xD6, 0x60, 0x34, 0x87, 0xBA, 0x71, 0x06, 0x18,
-    0xE2, 0x39, 0xBC, 0x20, 0xCF, 0x95, 0xCC, 0x2B, 0x5A, 0x99, 0xA9, 0x8C, 0xCC, 0xCD, 0x0C, 0x79,
-    0xC6, 0x64, 0x7E, 0x6C, 0x05, 0x43, 0xB8, 0x30, 0xDF, 0x33, 0xA0, 0xAE, 0x80, 0xB1, 0x02, 0xA3,
-    0xC8, 0xE5, 0xC2, 0xA1, 0xA7, 0xC8, 0xCE, 0x29, 0x31, 0x05, 0xA5, 0x8D, 0x2A, 0xF3, 0x3A, 0xAB,
-    0x95, 0x4E, 0xDB, 0x8A, 0x62, 0x43, 0x5B, 0x9A, 0x65, 0x78, 0x48, 0x61, 0x4F, 0x71, 0x47, 0x40,
-    0x8C, 0x89, 0xD8, 0x56, 0x15, 0x82, 0x9C, 0x21, 0xE8, 0x15, 0xDB, 0x33, 0x80, 0x3A, 0x0A, 0x68,
-    0x47, 0x43, 0x11, 0xDF, 0x67, 0x45, 0x52, 0x56, 0x73, 0x50, 0xC5, 0xF8, 0x68, 0x8E, 0x45, 0x6B,
-    0x30, 0x86, 0x1B, 0xB2, 0x8A, 0x06, 0xC2, 0xB6, 0x85, 0xA0, 0x73, 0xD1, 0xCC, 0x29, 0x51, 0xE2,
-    0x07, 0x00, 0x5F, 0x26, 0x68, 0x24, 0x04, 0x55, 0x08, 0x83, 0xD5, 0x8F, 0x06, 0xC0, 0xE2, 0x65,
-    0xA5, 0xC3, 0x21, 0x18, 0x42, 0x90, 0xC0, 0x06, 0xE4, 0x3D, 0x0F, 0xDB, 0x60, 0xF3, 0x40, 0x17,
-    0x2F, 0xC0, 0x7B, 0x28, 0xC6, 0x50, 0xBD, 0xCA, 0xA1, 0xB8, 0xC9, 0xEF, 0x36, 0x79, 0x5B, 0x21,
-    0x52, 0xEB, 0x02, 0x79, 0x10, 0xA8, 0x57, 0xB6, 0x32, 0x09, 0x07, 0x5A, 0xD5, 0xE6, 0xAE, 0x51,
-    0xE6, 0x84, 0xAE, 0x5E, 0xB3, 0xB0, 0x97, 0x70, 0x88, 0x78, 0x1E, 0xB0, 0x80, 0x3D, 0x46, 0xC8,
-    0xE1, 0x1A, 0x08, 0xB1, 0x22, 0xD0, 0xBB, 0x21, 0x8C, 0x82, 0xBA, 0xB0, 0x81, 0xB8, 0xDE, 0x08,
-    0x67, 0xA9, 0x79, 0x96, 0xF9, 0xE4, 0x5C, 0x83, 0xD7, 0x8C, 0x30, 0xCF, 0x09, 0x83, 0x80, 0x9E,
-    0x39, 0x86, 0x79, 0x08, 0x20, 0x01, 0x19, 0x42, 0xBA, 0x07, 0xA9, 0x00, 0x0B, 0x76, 0x78, 0xCB,
-    0x40, 0x34, 0xE0, 0x39, 0x35, 0x40, 0x91, 0x8C, 0xA0, 0x67, 0x49, 0x03, 0xB4, 0x00, 0x11, 0x03,
-    0xEC, 0xF0, 0x4B, 0x2B, 0xBB, 0x7F, 0xB6, 0x4F, 0x37, 0x60, 0xD9, 0xC0, 0x22, 0x84, 0x84, 0xA4,
-    0x50, 0x13, 0xA4, 0x70, 0x09, 0x27, 0x27, 0x37, 0x56, 0xB9, 0x3B, 0xD8, 0x6A, 0x92, 0x17, 0xAB,
-    0xF9, 0x45, 0x67, 0xA8, 0xEA, 0xD8, 0x0A, 0xA1, 0xE9, 0x14, 0x4E, 0xFB, 0x53, 0xF7, 0x9A, 0xA3,
-    0xD9, 0xDF, 0x19, 0xC2, 0x1E, 0x19, 0x86, 0x2E, 0x15, 0x98, 0x0D, 0xEC, 0x03, 0x73, 0xF6, 0xC1,
-    0xF3, 0xC2, 0x70, 0x5F, 0x32, 0x6B, 0xC7, 0x0E, 0x9A, 0x7C, 0x92, 0xED, 0x37, 0x9D, 0x87, 0xDE,
-    0x33, 0x5E, 0x3A, 0xE6, 0x45, 0x6F, 0x30, 0xC4, 0xDA, 0x65, 0x07, 0xB1, 0x7B, 0x4B, 0x05, 0x26,
-    0xF2, 0x26, 0x9A, 0x8F, 0x69, 0x96, 0x4F, 0xD5, 0xAF, 0x2F, 0x0A, 0x95, 0x6B, 0xE7, 0xE5, 0x43,
-    0x5C, 0x66, 0x42, 0x28, 0x67, 0x69, 0x08, 0x29, 0xB6, 0x1D, 0x49, 0xE5, 0x94, 0x3B, 0x40, 0x29,
-    0x05, 0x41, 0x60, 0xCA, 0x17, 0x62, 0xC2, 0xEE, 0x9E, 0x5E, 0xA5, 0x7C, 0xC6, 0xB9, 0xEB, 0xE4,
-    0xBF, 0xBB, 0xFD, 0xB1, 0x66, 0x81, 0x18, 0xDD, 0x3F, 0x88, 0xDE, 0xC0, 0xD6, 0x12, 0xD3, 0xBF,
-    0xD2, 0x78, 0xFC, 0x91, 0x7D, 0xC1, 0x4F, 0x62, 0xCB, 0x93, 0xEE, 0x85, 0xC5, 0x9A, 0xD8, 0xF1,
-    0x89, 0x5F, 0x8F, 0xD8, 0x79, 0x27, 0xEC, 0x0D, 0x52, 0x2D, 0x3C, 0x3D, 0x64, 0x98, 0xF1, 0x56,
-    0x84, 0x61, 0x2C, 0xAA, 0x9C, 0x87, 0x5C, 0xC8, 0x78, 0x18, 0x4F, 0xB3, 0x40, 0x80, 0x34, 0xBD,
-    0x01, 0x36, 0x8C, 0xC6, 0x83, 0x65, 0x6C, 0xB7, 0x18, 0xDB, 0x05, 0xC6, 0x96, 0x33, 0x36, 0xC1,
-    0x4F, 0xEF, 0x4D, 0x2B, 0x99, 0x4F, 0x9D, 0xD1, 0xC9, 0x45, 0xE5, 0x2D, 0x29, 0xFB, 0x60, 0x27,
-    0xB7, 0x72, 0xF1, 0x4E, 0xE9, 0xF0, 0xB6, 0x6B, 0xBC, 0x88, 0x65, 0xB1, 0xB8, 0xCE, 0xBA, 0x31,
-    0xD6, 0x5C, 0xF1, 0xE2, 0x81, 0xDC, 0x7F, 0xE3, 0xC4, 0x67, 0xA4, 0xFD, 0x8F, 0x2A, 0xF9, 0x16,
-    0xB7, 0xB7, 0x32, 0x99, 0x1E, 0x51, 0x1F, 0xEA, 0x55, 0x12, 0xB3, 0xEB, 0x20, 0x7A, 0x0E, 0x34,
-    0x62, 0x5E, 0x07, 0x68, 0x3C, 0x15, 0x99, 0xA7, 0x48, 0xE7, 0xE5, 0xC9, 0x17, 0x22, 0x73, 0x9E,
-    0x6C, 0x56, 0x1A, 0xF5, 0xD1, 0x5F, 0x5D, 0x30, 0x4F, 0x5F, 0xB5, 0xC5, 0xBF, 0xFE, 0xE2, 0x42,
-    0xF7, 0x5B, 0xD5, 0x9F, 0x65, 0x45, 0x20, 0xA5, 0xBE, 0x43, 0xF9, 0xDC, 0x87, 0xCF, 0x99, 0x3C,
-    0x80, 0xA3, 0xE2, 0xDE, 0x27, 0xEE, 0x65, 0xF7, 0x49, 0xD1, 0xAB, 0xDF, 0xFF, 0x0D, 0xFE, 0x32,
-    0x4D, 0xBA, 0x3C, 0x32, 0x17, 0xA8, 0xCB, 0x2E, 0x9A, 0xA7, 0x23, 0xF3, 0x34, 0xED, 0x64, 0xE5,
-    0x49, 0xAF, 0x62, 0x5E, 0x8F, 0x08, 0x0F, 0x9E, 0xEE, 0x34, 0x57, 0xA4, 0xAB, 0xA5, 0x6C, 0x77,
-    0xEE, 0xE0, 0xC6, 0x24, 0xF9, 0xED, 0x85, 0xE4, 0xBB, 0x85, 0xE4, 0xDB, 0x85, 0x82, 0xCA, 0x27,
-    0x3D, 0x0C, 0x9C, 0x14, 0xAE, 0x2F, 0xDC, 0x4F, 0x91, 0x7F, 0x23, 0x15, 0x2F, 0xEC, 0xE3, 0x6E,
-    0x1E, 0xDC, 0x3F, 0x7E, 0x64, 0x27, 0xF7, 0x1C, 0xE9, 0x68, 0xAF, 0x5C, 0x7F, 0xF9, 0xE0, 0x7A,
-    0xE5, 0xFA, 0xD7, 0x61, 0xB7, 0x20, 0xA3, 0x1E, 0x7F, 0x57, 0x5C, 0x9B, 0xFC, 0x47, 0x23, 0x71,
-    0x07, 0x32, 0xB8, 0x58, 0x2D, 0xDD, 0xE1, 0x2C, 0x4A, 0x68, 0x6D, 0xAE, 0x29, 0xE3, 0x92, 0x1E,
-    0x7B, 0xC6, 0x88, 0x4B, 0x43, 0x4C, 0x40, 0x14, 0xAD, 0x50, 0x9B, 0x94, 0xAE, 0xC5, 0x63, 0x85,
-    0x6C, 0xA1, 0x46, 0x9C, 0x81, 0x9B, 0xE3, 0x9A, 0x03, 0x01, 0xD9, 0xD5, 0x33, 0x44, 0xE6, 0xF6,
-    0x0C, 0xF7, 0xD8, 0x7B, 0x70, 0x21, 0xE6, 0x7B, 0x5C, 0xF2, 0xB1, 0xBB, 0x90, 0x47, 0x71, 0x01,
-    0xF2, 0xC8, 0x4E, 0xC6, 0x03, 0xC5, 0xDB, 0xA4, 0x60, 0x2E, 0x40, 0xCD, 0x4F, 0x48, 0x78, 0x44,
-    0xC2, 0xB6, 0x98, 0x75, 0x62, 0xE7, 0x3C, 0x96, 0x6D, 0x56, 0x6C, 0x44, 0x22, 0x72, 0xDC, 0x4E,
-    0x3D, 0xC9, 0xDD, 0x4E, 0x68, 0x7A, 0xF0, 0x35, 0xE3, 0xED, 0xB0, 0xC5, 0x1A, 0xCC, 0x98, 0x8E,
-    0x32, 0x13, 0xC5, 0xCA, 0x2E, 0x7A, 0xDD, 0x82, 0x0B, 0xD9, 0xB6, 0x62, 0xF3, 0xB2, 0x55, 0xB4,
-    0x54, 0x6A, 0x47, 0xC5, 0x53, 0x75, 0x22, 0x9B, 0xAA, 0x13, 0xC1, 0x54, 0x9D, 0x48, 0x05, 0xA5,
-    0x1C, 0x8B, 0x04, 0x41, 0x85, 0xE5, 0xA1, 0x8C, 0x08, 0x43, 0xC9, 0x72, 0xC6, 0xA6, 0xE1, 0x46,
-    0x2A, 0x3A, 0x11, 0x00, 0xE3, 0xE7, 0x58, 0xDF, 0xCA, 0xD2, 0x11, 0xD1, 0x79, 0xDD, 0x68, 0x78,
-    0xD1, 0x58, 0x15, 0xAF, 0x18, 0x4D, 0x3C, 0x36, 0xAD, 0x34, 0x63, 0x62, 0x73, 0x7C, 0x7D, 0x58,
-    0x1E, 0x2F, 0x0E, 0xA8, 0x79, 0x15, 0x85, 0xF8, 0xF7, 0xD1, 0xCD, 0xF3, 0x92, 0x78, 0x41, 0x4C,
-    0x48, 0xAF, 0x2C, 0x06, 0xF5, 0xE8, 0x15, 0x28, 0x49, 0x21, 0x61, 0x40, 0x5E, 0xCB, 0x59, 0xC4,
-    0x4B, 0xC8, 0x22, 0xFA, 0x0C, 0xF1, 0xD1, 0xA0, 0x81, 0xC1, 0xD9, 0xBC, 0x87, 0x03, 0x53, 0x5D,
-    0xD6, 0x21, 0x1E, 0xAB, 0x5E, 0x14, 0x51, 0x74, 0xE9, 0xD8, 0xB0, 0x8C, 0x9C, 0xE5, 0x26, 0x70,
-    0x92, 0xAC, 0x71, 0x26, 0x65, 0x64, 0x4D, 0xCC, 0x3B, 0x84, 0x8B, 0x06, 0x59, 0x08, 0x2F, 0x21,
-    0xE8, 0xBD, 0xBA, 0x7A, 0xBF, 0xA9, 0x7A, 0x49, 0x57, 0x8F, 0x87, 0x0A, 0x5E, 0xC9, 0x0D, 0x51,
-    0x13, 0x87, 0x0B, 0xF0, 0xCE, 0xC6, 0x02, 0x3E, 0xB9, 0xC9, 0xFD, 0x13, 0xE8, 0x49, 0xC8, 0xD0,
-    0xB4, 0x88, 0x6F, 0xDB, 0x3B, 0xF4, 0x95, 0x0F, 0xD8, 0xB9, 0xA3, 0x24, 0x1F, 0x0F, 0xA4, 0x3C,
-    0xC8, 0x38, 0x96, 0xC4, 0xCE, 0xDD, 0x47, 0x26, 0x7B, 0x49, 0x9C, 0x72, 0xBC, 0xDC, 0xD1, 0x0C,
-    0xC4, 0xF5, 0x4B, 0xC6, 0x2D, 0x29, 0xA1, 0x80, 0x3D, 0x06, 0x92, 0x65, 0xF7, 0x13, 0x08, 0xC4,
-    0x23, 0xD8, 0xC9, 0xB3, 0xAF, 0x60, 0x6A, 0x26, 0x4C, 0x02, 0x50, 0x9D, 0x5F, 0x3E, 0x38, 0x78,
-    0x4F, 0xB3, 0x0B, 0x84, 0x7D, 0x7C, 0x83, 0xE3, 0x0D, 0x96, 0x8E, 0xC8, 0xAB, 0x89, 0x61, 0x29,
-    0xB0, 0x7E, 0x24, 0xF4, 0x63, 0x38, 0xB1, 0xE6, 0x62, 0x03, 0xB0, 0x63, 0xF8, 0x4F, 0xCD, 0xB0,
-    0xA4, 0x27, 0x02, 0xC3, 0x9E, 0x37, 0x56, 0xC1, 0x89, 0x27, 0x55, 0x02, 0xC7, 0x8B, 0x0F, 0xFE,
-    0x60, 0x95, 0x9C, 0x38, 0x80, 0x9B, 0x9B, 0x5F, 0xC0, 0x91, 0xF7, 0x10, 0x9E, 0x12, 0x58, 0x3C,
-    0x04, 0xAA, 0x15, 0x98, 0x01, 0xB6, 0xD0, 0xA5, 0xA4, 0x1E, 0x2C, 0x94, 0x52, 0x50, 0x12, 0xEB,
-    0xA9, 0xA5, 0xB3, 0xF3, 0x9B, 0x9C, 0x4A, 0x20, 0x79, 0x71, 0xAB, 0x50, 0x0B, 0x2C, 0x8F, 0x41,
-    0xFF, 0x1E, 0xF2, 0xE4, 0x32, 0x4C, 0x34, 0x2D, 0x70, 0x5F, 0x62, 0xD5, 0x18, 0xA7, 0x58, 0x35,
-    0xCF, 0x46, 0xE6, 0xAB, 0xA4, 0xDE, 0x69, 0x31, 0xE8, 0xD3, 0x3F, 0x39, 0xD8, 0x38, 0x0B, 0xF2,
-    0x0A, 0x1C, 0x1A, 0xF6, 0xEE, 0x3E, 0xA6, 0xDC, 0x75, 0xFE, 0x03, 0x86, 0x1C, 0xFA, 0xC1, 0xDE,
-    0xA7, 0x08, 0x82, 0x13, 0x52, 0xD5, 0xA2, 0xEC, 0xEA, 0x0A, 0xB8, 0x6A, 0x65, 0x67, 0xFA, 0xB8,
-    0x8D, 0x66, 0x56, 0xF5, 0xAA, 0xC7, 0x46, 0x6F, 0x14, 0x62, 0x02, 0x52, 0xFB, 0x0E, 0xF6, 0xF2,
-    0xA5, 0x65, 0x95, 0xC7, 0xD9, 0x96, 0x84, 0x61, 0xC8, 0xB6, 0xFA, 0x62, 0xB7, 0xF2, 0x16, 0x1B,
-    0xCE, 0xBD, 0x13, 0x2B, 0x4A, 0x89, 0xB8, 0xC8, 0xA9, 0xF5, 0xE4, 0xCD, 0x9E, 0xD4, 0x25, 0xF6,
-    0x1C, 0x9B, 0xDC, 0xD3, 0x93, 0x13, 0x2D, 0x55, 0x73, 0x8A, 0x1B, 0x72, 0xCD, 0x71, 0x27, 0xB8,
-    0xC2, 0x67, 0x62, 0xE0, 0xB3, 0x11, 0xBF, 0x26, 0x39, 0x42, 0x70, 0x69, 0x0C, 0xFE, 0x9B, 0x14,
-    0xE8, 0xA6, 0xF1, 0x25, 0x6D, 0x5C, 0xAB, 0x2E, 0xAD, 0xE1, 0xB3, 0x90, 0x64, 0xE7, 0x5A, 0x75,
-    0xA8, 0xB0, 0xDA, 0xED, 0x71, 0xDF, 0xF6, 0x3E, 0x84, 0xF3, 0x7E, 0x65, 0x6A, 0xD1, 0x78, 0xF0,
-    0xC8, 0x3B, 0x94, 0x7F, 0x99, 0xF6, 0x82, 0xE1, 0xDF, 0xD5, 0x71, 0x38, 0xFB, 0x23, 0x7B, 0xA6,
-    0x8C, 0x4C, 0x61, 0x22, 0x53, 0xD9, 0xB8, 0x75, 0x48, 0xD2, 0x50, 0x31, 0xD4, 0x5C, 0x10, 0x05,
-    0xC8, 0x7E, 0xF1, 0x39, 0x71, 0x4D, 0x60, 0x33, 0x67, 0x43, 0xAB, 0xC2, 0x79, 0x64, 0xB6, 0xA9,
-    0xBA, 0xDB, 0x5E, 0x80, 0xF8, 0xEA, 0xAB, 0x10, 0xE7, 0xBA, 0x95, 0x5C, 0xF1, 0x39, 0x18, 0x1B,
-    0x01, 0x3B, 0xAB, 0xE2, 0xDE, 0xEE, 0xEB, 0x90, 0x72, 0xC8, 0x7D, 0x94, 0xC1, 0xBE, 0x70, 0x3B,
-    0xA4, 0xCC, 0x9F, 0x22, 0xE8, 0xAF, 0x49, 0x1B, 0x96, 0xDE, 0xD1, 0x5C, 0x64, 0xE6, 0x3F, 0xEC,
-    0x5E, 0x84, 0xB9, 0x58, 0x54, 0x5B, 0xDD, 0x67, 0x98, 0x35, 0x7C, 0xCE, 0x0E, 0x1C, 0x2E, 0x62,
-    0xEF, 0xE7, 0xEE, 0x8D, 0x56, 0xB6, 0x8F, 0x80, 0x93, 0x99, 0x2B, 0x77, 0xA8, 0xBA, 0xDF, 0x62,
-    0x13, 0x7F, 0xDE, 0xC3, 0x39, 0x5A, 0x54, 0x22, 0xBF, 0xEB, 0x90, 0x45, 0xFE, 0xB8, 0x3B, 0xC5,
-    0x3B, 0x7B, 0x25, 0x72, 0x49, 0xC6, 0xBA, 0x88, 0x78, 0x4B, 0x20, 0xEF, 0x66, 0xFE, 0xC8, 0x3C,
-    0x63, 0x87, 0xC6, 0x07, 0x98, 0x3E, 0x1A, 0x17, 0x32, 0xA8, 0x93, 0xA3, 0x8E, 0xF5, 0x80, 0x9A,
-    0x77, 0xC7, 0x51, 0x71, 0x56, 0x0E, 0x79, 0x8D, 0x75, 0x72, 0x3E, 0x8C, 0x95, 0x32, 0xF4, 0xE4,
-    0xAB, 0x52, 0x65, 0xC7, 0x6A, 0xB9, 0x30, 0x63, 0xBD, 0x5C, 0x34, 0x63, 0xC5, 0x5C, 0xD5, 0x63,
-    0xCD, 0xEC, 0xA6, 0xAA, 0x79, 0x3E, 0xD5, 0xCD, 0xFD, 0x11, 0xD1, 0x7A, 0x51, 0xA7, 0x3E, 0x65,
-    0xC9, 0xFD, 0xB7, 0x7C, 0x58, 0x6D, 0x32, 0xFF, 0x72, 0x76, 0x6D, 0xF5, 0xA4, 0x06, 0x86, 0xD0,
-    0xC9, 0x52, 0xE0, 0xDF, 0x78, 0x59, 0xDC, 0xF8, 0x27, 0x5E, 0x2E, 0x1A, 0x5E, 0x7A, 0xB8, 0x92,
-    0x08, 0x8D, 0xD3, 0xB3, 0x07, 0x51, 0x18, 0xC9, 0x8E, 0x4C, 0xAC, 0xE6, 0x08, 0x39, 0xC7, 0xF6,
-    0xE1, 0xE1, 0x84, 0x92, 0x39, 0x1F, 0xE3, 0x52, 0x70, 0x7D, 0xE5, 0x54, 0xC9, 0x3E, 0x9C, 0xD0,
-    0xF8, 0x72, 0x1C, 0xE2, 0x0F, 0xC6, 0xFD, 0xF4, 0x11, 0x59, 0x71, 0x84, 0xD0, 0x48, 0x76, 0x64,
-    0x22, 0x98, 0x78, 0xCB, 0xDA, 0xC9, 0x9D, 0xAD, 0x9E, 0x3E, 0x3D, 0xE8, 0xDA, 0xDA, 0x57, 0xB6,
-    0xC0, 0x58, 0xD5, 0xE5, 0x26, 0x38, 0xC6, 0xE2, 0xA3, 0xA4, 0x1D, 0xB7, 0x8F, 0x71, 0x46, 0x92,
-    0xB6, 0xEC, 0x48, 0xF6, 0x05, 0xDE, 0x8A, 0x07, 0x0A, 0xC8, 0x48, 0xCA, 0x37, 0xF3, 0x23, 0x1F,
-    0x7D, 0xFD, 0x97, 0xEA, 0x19, 0x5D, 0xB3, 0xBE, 0x8A, 0xF2, 0x06, 0x5B, 0x36, 0xE4, 0x73, 0x91,
-    0xAB, 0x72, 0x3A, 0xC2, 0x7D, 0xFF, 0xDE, 0xFB, 0x83, 0x55, 0xB8, 0xBB, 0x7B, 0x88, 0x70, 0x25,
-    0xFF, 0x6E, 0x8D, 0x70, 0x77, 0x77, 0x8F, 0x03, 0xD8, 0xB1, 0x91, 0xC0, 0x00, 0x2F, 0x71, 0x1C,
-    0xB3, 0xC2, 0xD7, 0xDB, 0x0F, 0x51, 0xC1, 0x09, 0xCD, 0xE7, 0xF2, 0xF2, 0xD6, 0x2C, 0xE3, 0xCC,
-    0xBA, 0x0A, 0x30, 0xD3, 0xC2, 0xC1, 0xE1, 0x89, 0x25, 0x98, 0x34, 0xFE, 0x49, 0x59, 0xB6, 0x83,
-    0x19, 0x30, 0xF8, 0xA7, 0xAC, 0xF5, 0x7F, 0x28, 0xC8, 0x57, 0x9B, 0x61, 0x26, 0x9F, 0x42, 0xDF,
-    0x2B, 0x57, 0x8F, 0x8E, 0x4F, 0x7F, 0xA6, 0x37, 0x7A, 0x7E, 0xDE, 0xBC, 0x49, 0xCB, 0xFB, 0xAD,
-    0xCD, 0x1D, 0x71, 0x2B, 0xA4, 0xA1, 0x9C, 0x71, 0xB0, 0x7D, 0xC3, 0x21, 0xF0, 0xA6, 0xDC, 0xE0,
-    0xDF, 0x15, 0xC4, 0x30, 0xB0, 0x8C, 0x19, 0x76, 0xC8, 0xBB, 0x85, 0xFF, 0xDF, 0xD9, 0xD8, 0x5F,
-    0xC8, 0xE0, 0x36, 0x79, 0x9F, 0xCE, 0xC7, 0xE5, 0x8B, 0x51, 0x9D, 0x7E, 0x8F, 0xA9, 0x6C, 0x8A,
-    0xF3, 0xA2, 0xA5, 0x73, 0x47, 0xDF, 0x6C, 0x50, 0xA1, 0xFF, 0x06, 0xED, 0x55, 0x3D, 0x8F, 0xDC,
-    0x44, 0x18, 0x7E, 0xEC, 0x3D, 0xD6, 0x52, 0x46, 0x68, 0xAE, 0xD9, 0x86, 0xC6, 0x0D, 0x0D, 0x88,
-    0x30, 0x35, 0xD2, 0xDD, 0x79, 0xC2, 0x2F, 0xB8, 0x22, 0x2B, 0x0A, 0x0A, 0x6A, 0x56, 0x48, 0xDB,
-    0x50, 0x50, 0x44, 0x9A, 0x11, 0xBF, 0xE0, 0x7E, 0x02, 0x45, 0x8A, 0x9C, 0x8B, 0x40, 0x11, 0x0A,
-    0x4E, 0xCA, 0x8E, 0x53, 0xD3, 0xF8, 0x27, 0x18, 0x74, 0xA2, 0xB9, 0x22, 0x83, 0x30, 0x8A, 0xA5,
-    0xB3, 0x3D, 0x3C, 0xE3, 0xD5, 0x71, 0x9B, 0xE4, 0x2E, 0x69, 0x28, 0x28, 0xE2, 0x9D, 0xC7, 0x3B,
-    0x5F, 0x7E, 0xE7, 0xFD, 0x7A, 0xDE, 0xC1, 0xFA, 0x1C, 0xB3, 0x10, 0x20, 0x5A, 0x63, 0x73, 0xAF,
-    0x2A, 0xD5, 0xE4, 0x4D, 0x51, 0xE7, 0xFE, 0x36, 0xA8, 0x46, 0xD5, 0xD2, 0x17, 0x95, 0xE8, 0x9C,
-    0x4D, 0xC3, 0x08, 0x7C, 0xFC, 0x03, 0xF8, 0x64, 0x1E, 0xB2, 0x85, 0xF0, 0xD8, 0x3E, 0xCE, 0x43,
-    0xF9, 0x38, 0xBC, 0xB1, 0xC9, 0x0E, 0x2E, 0x6C, 0x37, 0x9E, 0x02, 0xB3, 0x01, 0x10, 0x44, 0x4E,
-    0x1C, 0x12, 0x3F, 0x0F, 0x48, 0x7E, 0x1B, 0x30, 0x7B, 0x36, 0x40, 0xDE, 0x1B, 0xF0, 0x69, 0x32,
-    0xC0, 0x84, 0xD0, 0x46, 0x80, 0xFD, 0x09, 0x29, 0x3F, 0x2F, 0x82, 0xC7, 0x62, 0x79, 0x7C, 0xA7,
-    0x7C, 0x84, 0x3C, 0x0C, 0x13, 0x54, 0xF9, 0x14, 0x77, 0xF1, 0x3E, 0x0E, 0x28, 0xF9, 0x60, 0x11,
-    0xB7, 0xB4, 0x28, 0x7E, 0x1C, 0xB7, 0xFB, 0x11, 0xF4, 0x1E, 0xF1, 0x80, 0x18, 0x92, 0x00, 0xF7,
-    0xC5, 0x30, 0xAD, 0xCF, 0x4B, 0x0D, 0xA8, 0x16, 0xE9, 0x38, 0x42, 0x34, 0x06, 0xB2, 0x3A, 0x82,
-    0xD2, 0xFB, 0x28, 0x38, 0x5D, 0xBC, 0xA7, 0x79, 0x76, 0x07, 0x63, 0x47, 0x98, 0xE9, 0x57, 0xE8,
-    0x88, 0xF8, 0x53, 0x15, 0xF7, 0xD6, 0x23, 0x9D, 0xD7, 0x01, 0x2B, 0x8B, 0x55, 0x59, 0xD2, 0xAA,
-    0xA0, 0x23, 0x36, 0xA5, 0xC3, 0x13, 0x1C, 0xE1, 0x27, 0x3C, 0xE0, 0xB9, 0x3D, 0x75, 0x6E, 0x69,
-    0x27, 0x9D, 0x23, 0x6A, 0xF0, 0x00, 0x9E, 0x67, 0x29, 0x9C, 0x4B, 0xE3, 0xD6, 0x9C, 0x59, 0xDC,
-    0x72, 0xCC, 0xF1, 0xBA, 0x8B, 0xC1, 0xB0, 0xD2, 0xAB, 0x3A, 0x67, 0x20, 0x72, 0x4F, 0xB4, 0xAA,
-    0x92, 0xA3, 0xD3, 0x69, 0x3C, 0x87, 0x6E, 0xCB, 0x2E, 0x03, 0xD7, 0x0C, 0x43, 0x20, 0xFF, 0x05,
-    0xC3, 0x52, 0x67, 0x3C, 0x17, 0xAB, 0x87, 0x48, 0x9C, 0x85, 0xA0, 0x5D, 0xAA, 0xA2, 0x7D, 0xDA,
-    0x5D, 0xEB, 0x1D, 0xB5, 0xB6, 0x46, 0xAB, 0x3F, 0x82, 0x16, 0xC1, 0x68, 0xEC, 0x47, 0x05, 0x0C,
-    0xB1, 0xC1, 0x27, 0xD4, 0xF1, 0x30, 0x6D, 0x91, 0x3F, 0xAF, 0x31, 0x67, 0x48, 0xB0, 0x47, 0x1C,
-    0xBD, 0x8E, 0x10, 0x42, 0x15, 0xB1, 0x34, 0x4B, 0xFD, 0xDA, 0xFA, 0x47, 0x3B, 0xEB, 0xCB, 0xA5,
-    0xBE, 0xEA, 0x97, 0x65, 0x69, 0xB1, 0xF3, 0x5C, 0xCD, 0x5F, 0x8D, 0x05, 0x5D, 0x8C, 0xB4, 0x8F,
-    0x79, 0x91, 0xD7, 0x28, 0x2A, 0x14, 0x96, 0xFE, 0x06, 0x15, 0x74, 0x3B, 0x8D, 0x43, 0x4E, 0xC6,
-    0xD5, 0x0A, 0x79, 0xC3, 0x6C, 0x9D, 0xFC, 0xA6, 0x34, 0x52, 0x86, 0x09, 0x9F, 0xB1, 0x5B, 0xC5,
-    0xC9, 0x94, 0x93, 0x0C, 0xB5, 0xDB, 0xD9, 0xFD, 0x6A, 0x9B, 0x44, 0x73, 0x0F, 0x33, 0xAC, 0x83,
-    0x6C, 0x62, 0x9C, 0x3F, 0xDC, 0x6A, 0x62, 0x7E, 0x0F, 0x3A, 0xA7, 0x77, 0x45, 0x9F, 0x37, 0xA2,
-    0x95, 0x5E, 0xF8, 0x9B, 0x21, 0xB9, 0xE6, 0x82, 0x1C, 0xA7, 0x8F, 0xFE, 0x0B, 0xFA, 0x7C, 0x40,
-    0x13, 0x6D, 0x16, 0x6C, 0x61, 0xEC, 0x21, 0xF5, 0x7B, 0x43, 0x73, 0xB5, 0x0A, 0x61, 0xB1, 0x5C,
-    0xCE, 0xC3, 0x09, 0x54, 0xE8, 0x51, 0x7C, 0x4F, 0x72, 0xDC, 0x1B, 0xA1, 0x68, 0x51, 0x92, 0xC4,
-    0x44, 0x67, 0x26, 0xCD, 0xDA, 0x6D, 0xA2, 0xD1, 0x3B, 0x78, 0x1A, 0xF3, 0x2E, 0xD5, 0xD2, 0xCE,
-    0xB4, 0x59, 0x7E, 0xA5, 0xAF, 0x12, 0x94, 0x01, 0x22, 0x27, 0x4E, 0x48, 0x9A, 0x6E, 0x2B, 0x83,
-    0x84, 0x50, 0x3B, 0xD9, 0x98, 0xB8, 0x1A, 0x49, 0x38, 0xA7, 0xBC, 0x68, 0x65, 0x24, 0x8F, 0xD3,
-    0xDF, 0x12, 0x1D, 0xFB, 0x9B, 0xEC, 0x8A, 0x38, 0xEF, 0x08, 0xFC, 0x8E, 0xC0, 0xFF, 0x17, 0x02,
-    0x27, 0x1B, 0x8B, 0xFC, 0x82, 0xD9, 0xF2, 0x79, 0x8F, 0x3C, 0xE9, 0xA7, 0xB0, 0x24, 0x5F, 0x32,
-    0xA3, 0x2E, 0x23, 0x43, 0x06, 0x04, 0x8E, 0x03, 0xA5, 0xBB, 0x98, 0xBD, 0x43, 0xB0, 0xA2, 0x59,
-    0xD9, 0xE4, 0xB1, 0x96, 0xA1, 0x2D, 0x9E, 0xF5, 0x46, 0x8F, 0x8E, 0x76, 0x95, 0x21, 0x3E, 0x3C,
-    0x9D, 0x6E, 0xD5, 0x7B, 0x45, 0x7D, 0x57, 0x86, 0x3E, 0x71, 0x27, 0xC9, 0x63, 0x0B, 0x79, 0x49,
-    0xA2, 0xC4, 0x24, 0x62, 0x18, 0x1C, 0x7B, 0x61, 0x8B, 0x2A, 0xFE, 0xC7, 0x71, 0x9C, 0x8F, 0x33,
-    0xF2, 0x32, 0x92, 0xE7, 0x84, 0x79, 0xBD, 0xB8, 0x5F, 0x84, 0xBC, 0xCB, 0xFA, 0xAC, 0x4A, 0x46,
-    0x49, 0x99, 0xDF, 0x20, 0x5E, 0x89, 0x90, 0x84, 0xA2, 0x7A, 0x4F, 0x48, 0xD8, 0xBA, 0xB0, 0x19,
-    0x2B, 0x86, 0x39, 0x77, 0xC3, 0xEA, 0x61, 0x79, 0x3A, 0x3F, 0xD3, 0x2A, 0x34, 0xDF, 0x65, 0xFD,
-    0x7E, 0x74, 0x0D, 0x33, 0x2B, 0x94, 0xE5, 0xA4, 0x14, 0xA8, 0xDD, 0x40, 0xC3, 0xF2, 0xE7, 0x3E,
-    0xDD, 0xE8, 0x15, 0x2B, 0x86, 0x89, 0xA9, 0xF8, 0x12, 0xCE, 0x20, 0x5E, 0x84, 0x4A, 0x0C, 0xAA,
-    0x11, 0x1D, 0xCB, 0xD4, 0x6D, 0xE5, 0x8B, 0xF3, 0xEB, 0x51, 0x0E, 0xAB, 0x72, 0x7E, 0x7A, 0xB3,
-    0x9C, 0xE5, 0x7D, 0xE1, 0x4D, 0x2B, 0x7C, 0xAE, 0x85, 0x3F, 0xE4, 0x98, 0x97, 0xFA, 0x5F, 0xBC,
-    0xB4, 0x59, 0x6B, 0x44, 0xE4, 0x97, 0x67, 0xEE, 0xC5, 0xF2, 0xD5, 0x2A, 0xCA, 0x11, 0x94, 0x83,
-    0xAF, 0x29, 0xC7, 0xDC, 0x7E, 0xD7, 0xBF, 0xDA, 0x5A, 0xAC, 0x47, 0x52, 0x0D, 0x8B, 0xE3, 0x4D,
-    0xF2, 0x0B, 0xCC, 0x8B, 0xF0, 0xEB, 0xA4, 0x75, 0x5F, 0xD4, 0xD4, 0xBB, 0x95, 0x53, 0xE1, 0xE5,
-    0xDB, 0xBF, 0xF5, 0x3D, 0xD9, 0x21, 0xBB, 0x68, 0xC9, 0x9D, 0x47, 0x8B, 0xE3, 0xB3, 0x28, 0xEB,
-    0xED, 0xF6, 0xFB, 0x6B, 0xFB, 0x17, 0xFA, 0x14, 0xE6, 0x22, 0x54, 0x72, 0x2A, 0xF7, 0x82, 0x6B,
-    0x19, 0xDF, 0xB3, 0xEE, 0x1A, 0x1C, 0xC7, 0xF9, 0x9E, 0xDF, 0x5D, 0x52, 0xF6, 0x9F, 0xE3, 0x4B,
-    0xBE, 0x5A, 0x0F, 0x91, 0xCE, 0x1A, 0x49, 0xA9, 0xE5, 0x85, 0x57, 0x49, 0x5B, 0x80, 0xA5, 0x1F,
-    0x6A, 0x24, 0x3B, 0x1B, 0xB8, 0x6E, 0x2F, 0xEB, 0x0F, 0xD0, 0x1F, 0xA1, 0x2B, 0x2E, 0xFC, 0x7C,
-    0x24, 0x5D, 0x01, 0x8F, 0x94, 0x2E, 0xF8, 0x9B, 0x25, 0xA6, 0x7A, 0x83, 0x83, 0x66, 0xA1, 0xC6,
-    0xC6, 0xFE, 0x03, 0xA5, 0x58, 0x3D, 0x90, 0xDD, 0xD4, 0x15, 0xBE, 0x92, 0xF0, 0x8A, 0xF0, 0x0A,
-    0xB9, 0xB0, 0x67, 0x18, 0xC8, 0xAC, 0x28, 0xA8, 0x48, 0x6C, 0xB5, 0x29, 0x76, 0x2D, 0x91, 0x14,
-    0x14, 0x29, 0xB2, 0x85, 0xD7, 0x14, 0x29, 0xDC, 0xA4, 0x89, 0x53, 0xB8, 0x75, 0x66, 0xCC, 0x48,
-    0x19, 0xCA, 0x14, 0xD9, 0x14, 0x54, 0x69, 0x5C, 0x90, 0x19, 0xBC, 0x2E, 0x36, 0xC5, 0x16, 0x2E,
-    0x16, 0xEB, 0x19, 0x4F, 0x26, 0x45, 0x0A, 0x3F, 0xC8, 0x40, 0x0A, 0x8A, 0x88, 0x1F, 0x0F, 0x03,
-    0x14, 0x08, 0x10, 0xA0, 0xDD, 0x95, 0x74, 0xF2, 0x7D, 0xE7, 0x48, 0x6F, 0x77, 0xF9, 0x0D, 0x44,
-    0xF3, 0xE6, 0x9C, 0xF3, 0xA4, 0xFB, 0x73, 0xEE, 0x3D, 0xE7, 0x7C, 0xE7, 0xDC, 0xEB, 0x9C, 0x3D,
-    0x8F, 0x4B, 0x4B, 0x26, 0x22, 0x99, 0x73, 0xA1, 0x3C, 0x2D, 0x73, 0xE7, 0xA2, 0xCE, 0x95, 0x60,
-    0x49, 0xE3, 0x72, 0xBC, 0x4C, 0x6B, 0x77, 0x06, 0x2D, 0xF2, 0x4A, 0xDB, 0x97, 0x13, 0x7B, 0x64,
-    0x7B, 0x7B, 0x7B, 0xAB, 0xAC, 0x62, 0xF4, 0x5C, 0x94, 0x95, 0x27, 0x0F, 0x2E, 0x2F, 0xD0, 0xA4,
-    0x5C, 0x84, 0x15, 0x3A, 0x94, 0x8B, 0xA0, 0x42, 0xF7, 0x72, 0xE1, 0x6F, 0x71, 0xB0, 0x05, 0x87,
-    0xCE, 0xC8, 0x9C, 0x0C, 0x72, 0x70, 0x93, 0xD3, 0x8A, 0x0C, 0xF8, 0x7B, 0x4A, 0x1E, 0x5C, 0xD4,
-    0xF1, 0x16, 0xEE, 0x6B, 0x59, 0xA3, 0xCC, 0x23, 0x93, 0x45, 0x00, 0xC6, 0xF9, 0x8E, 0x98, 0x7B,
-    0xF2, 0x51, 0x36, 0xBC, 0xBD, 0x46, 0xBA, 0x7B, 0x8D, 0xF4, 0xB3, 0x5D, 0x76, 0x91, 0xDE, 0xB9,
-    0x19, 0x55, 0x73, 0xB9, 0xBC, 0x2D, 0xB5, 0x27, 0xEF, 0xBC, 0x2A, 0x6D, 0x20, 0xCF, 0xBF, 0xF2,
-    0x51, 0x1B, 0x49, 0x70, 0xEF, 0x7E, 0x13, 0x4B, 0xF8, 0xFC, 0xFD, 0x2A, 0xE9, 0x67, 0xCF, 0xFC,
-    0xDD, 0xA5, 0x7D, 0x34, 0x2B, 0x5C, 0xDA, 0x45, 0xB3, 0x0C, 0x74, 0x35, 0xC2, 0x9A, 0xBB, 0xF3,
-    0x4A, 0xD7, 0x57, 0x49, 0xD7, 0xCE, 0x81, 0xF6, 0x6B, 0xEB, 0xD8, 0x92, 0xE1, 0xDA, 0x1A, 0x27,
-    0xDF, 0x05, 0x8D, 0xA4, 0xBE, 0xE6, 0x9E, 0x08, 0xA5, 0xDE, 0x75, 0xBB, 0xBE, 0x34, 0x75, 0x88,
-    0xF5, 0xCA, 0x41, 0x59, 0xAB, 0x6E, 0x73, 0x17, 0x08, 0x75, 0x08, 0xFE, 0xF1, 0x3E, 0xF7, 0xF5,
-    0x79, 0x6C, 0xA7, 0x9B, 0x29, 0x8D, 0x9E, 0x29, 0xDC, 0x97, 0x9E, 0x44, 0xF6, 0x1D, 0xDB, 0xA3,
-    0x57, 0x3C, 0x5C, 0x12, 0x6C, 0x5F, 0xED, 0xF2, 0xC6, 0xC3, 0xDF, 0x04, 0x3A, 0x67, 0x2E, 0x6E,
-    0x66, 0x82, 0x8E, 0x8B, 0x08, 0xF4, 0x14, 0x9A, 0x68, 0x9F, 0x9E, 0x34, 0x05, 0x7D, 0x24, 0x4B,
-    0xBB, 0xB4, 0x2B, 0xEB, 0xB4, 0x8B, 0x7B, 0x69, 0xD2, 0x2E, 0x90, 0xBF, 0xB4, 0xA4, 0x01, 0xDE,
-    0x04, 0x83, 0x5F, 0xA4, 0x7D, 0xD0, 0xB3, 0x3D, 0x69, 0x3C, 0x90, 0x62, 0x07, 0x94, 0xFE, 0xA2,
-    0xA7, 0x5D, 0xEE, 0xF5, 0xEE, 0x49, 0x5F, 0xDE, 0xE9, 0xDD, 0x6D, 0x78, 0x41, 0x8F, 0x55, 0xA4,
-    0x22, 0x50, 0x60, 0xA6, 0xFA, 0x60, 0x49, 0xD0, 0xCD, 0x79, 0x9B, 0x94, 0x44, 0x3A, 0x21, 0x09,
-    0xE5, 0x83, 0x5B, 0x1D, 0xD4, 0xF3, 0x48, 0x9C, 0x92, 0x3D, 0x92, 0xEB, 0x24, 0xEE, 0xEB, 0xC9,
-    0xC1, 0x76, 0xE6, 0xA1, 0x6F, 0xE1, 0xC9, 0x07, 0x94, 0x4E, 0x7C, 0xBD, 0x25, 0x07, 0x37, 0x38,
-    0x7C, 0xE3, 0x2E, 0xC9, 0x83, 0x8D, 0x13, 0xDD, 0x16, 0xDC, 0x98, 0x5A, 0xFD, 0x73, 0x61, 0xC4,
-    0x9E, 0x19, 0xD5, 0xCA, 0xA1, 0xA1, 0x27, 0xAF, 0x4A, 0x15, 0x88, 0xCB, 0xEB, 0x70, 0x80, 0xAB,
-    0xCE, 0x7A, 0x97, 0x56, 0x20, 0x49, 0x31, 0xE3, 0x06, 0x29, 0x09, 0xB9, 0x61, 0x68, 0xE2, 0x30,
-    0xFC, 0x0B, 0x17, 0x39, 0x4A, 0x67, 0xC4, 0xFC, 0x2C, 0x85, 0x47, 0x6F, 0x97, 0x07, 0x2F, 0xD9,
-    0x3B, 0x95, 0x5C, 0x4A, 0x4B, 0xD1, 0xF9, 0x1D, 0x06, 0x78, 0x38, 0xC0, 0x64, 0x3F, 0x85, 0x55,
-    0x0F, 0xBA, 0x9C, 0x6D, 0xF2, 0x43, 0x91, 0xF6, 0xF7, 0x70, 0xE1, 0x0A, 0x0D, 0xCE, 0x9A, 0x3E,
-    0xE1, 0x7C, 0x32, 0x66, 0x74, 0x24, 0x65, 0x4B, 0x03, 0x8F, 0xFC, 0xB1, 0xAD, 0x0B, 0x8F, 0x31,
-    0xA2, 0xE4, 0x15, 0xE9, 0x73, 0x2A, 0x90, 0xCA, 0x3F, 0xB9, 0xA3, 0xD0, 0xCD, 0x17, 0xD9, 0xE1,
-    0xAF, 0xC0, 0xA2, 0x61, 0xF4, 0x36, 0xC4, 0xFA, 0x3D, 0xA9, 0x7D, 0xA9, 0x03, 0x93, 0x3C, 0xA9,
-    0x7C, 0x2C, 0x1F, 0x4C, 0x7F, 0x94, 0x16, 0xF6, 0xFB, 0x61, 0x92, 0xBF, 0x94, 0x82, 0xA5, 0x14,
-    0x4E, 0x52, 0x35, 0xB3, 0x39, 0x02, 0x69, 0x22, 0x4E, 0x5D, 0xD3, 0x29, 0x2E, 0x8B, 0xC0, 0x84,
-    0xDC, 0xF5, 0xDC, 0x24, 0x3C, 0xEB, 0x4B, 0x27, 0xDE, 0x5B, 0x4A, 0xED, 0x24, 0x68, 0xD8, 0x9A,
-    0x74, 0x63, 0xF2, 0xF4, 0x8A, 0x2B, 0x2D, 0x52, 0xD8, 0x3A, 0x50, 0xEB, 0x61, 0x13, 0x62, 0x34,
-    0x2B, 0x61, 0xA3, 0xB0, 0xA2, 0x49, 0x33, 0x17, 0x2E, 0xC8, 0xE7, 0x23, 0xAF, 0x95, 0x3F, 0x87,
-    0x0E, 0xCA, 0xD3, 0xCE, 0x78, 0x2C, 0xE4, 0xA5, 0xEE, 0x1E, 0x00, 0x68, 0xE4, 0xEE, 0x65, 0x4F,
-    0x9A, 0x19, 0xC6, 0x79, 0xCE, 0x95, 0x2D, 0xBE, 0x5F, 0x91, 0xED, 0x72, 0xD8, 0x39, 0x28, 0xA6,
-    0xEF, 0x57, 0x86, 0xED, 0x5B, 0xF2, 0xE1, 0x41, 0x81, 0xEF, 0xBE, 0xBC, 0xC7, 0x71, 0xE0, 0x5A,
-    0x87, 0xC6, 0x73, 0x31, 0x9E, 0x8C, 0x3C, 0x1A, 0x79, 0x40, 0xFE, 0xF2, 0xE8, 0x8C, 0xA2, 0x40,
-    0x84, 0xDD, 0xA0, 0xF1, 0x46, 0x1E, 0xAB, 0x67, 0xDE, 0x1C, 0x61, 0x54, 0x5D, 0xF4, 0x71, 0x79,
-    0x43, 0x71, 0xD5, 0x97, 0x79, 0x44, 0xEF, 0x83, 0x37, 0x87, 0x62, 0x3C, 0x80, 0x89, 0x8D, 0x9B,
-    0x97, 0xFB, 0x47, 0xFC, 0xCC, 0xC8, 0xF7, 0xC6, 0x76, 0x9D, 0xF1, 0x9F, 0x2B, 0x9F, 0xC9, 0x4C,
-    0x79, 0x0C, 0x27, 0x44, 0xC8, 0xBD, 0x21, 0xB5, 0x90, 0x03, 0xB7, 0x77, 0x86, 0x97, 0x3C, 0x19,
-    0xB6, 0x08, 0xDB, 0xDE, 0x08, 0xDF, 0xFF, 0x2B, 0xD7, 0xC9, 0x31, 0x6E, 0x08, 0xBB, 0x80, 0xB8,
-    0x11, 0xB9, 0x7A, 0x8B, 0x7D, 0x2E, 0x8E, 0xCF, 0xA9, 0x0D, 0xFC, 0x7F, 0x7F, 0x34, 0xA5, 0x8C,
-    0xC8, 0x4B, 0xA7, 0x97, 0xD7, 0xCB, 0xC1, 0xC4, 0x80, 0x0A, 0x9A, 0xBF, 0xFB, 0xE3, 0xDA, 0x26,
-    0x71, 0x31, 0x89, 0xEA, 0xBE, 0x37, 0xB3, 0x49, 0x2C, 0x31, 0x8C, 0x89, 0x81, 0xEC, 0x0C, 0x26,
-    0xCE, 0xA3, 0xD6, 0x97, 0x71, 0x84, 0xB8, 0x76, 0x2A, 0x42, 0x2D, 0x88, 0xDA, 0x20, 0x46, 0x60,
-    0xB7, 0x6E, 0x83, 0x2E, 0x24, 0xC4, 0xD9, 0x4C, 0xE3, 0x06, 0x93, 0x45, 0x54, 0xC9, 0xC7, 0xA6,
-    0x2C, 0x88, 0x5B, 0x05, 0xDB, 0xA2, 0x01, 0xBE, 0xB5, 0x14, 0xF3, 0x86, 0xD6, 0xD5, 0x11, 0xE0,
-    0x3E, 0x50, 0x5B, 0xC7, 0x55, 0x1C, 0x4D, 0xA4, 0xE0, 0xAC, 0xE2, 0x56, 0x32, 0x5F, 0xC5, 0x50,
-    0x8A, 0xA4, 0x70, 0x2A, 0x42, 0x75, 0xE0, 0x40, 0x49, 0x11, 0x11, 0x00, 0x6B, 0x0B, 0x96, 0x89,
-    0x14, 0xD7, 0x25, 0x8D, 0x3F, 0x68, 0xC6, 0x4C, 0xE4, 0x4F, 0x9C, 0x82, 0xE2, 0x8A, 0xFC, 0xE1,
-    0x08, 0x9D, 0xDC, 0xA9, 0x8B, 0x8C, 0x6D, 0xFC, 0xBF, 0x42, 0x25, 0xE6, 0x10, 0x2B, 0x8C, 0x49,
-    0x8F, 0x0F, 0x99, 0x15, 0x08, 0xF4, 0x64, 0x8D, 0x1A, 0x62, 0x56, 0xAB, 0xE8, 0xA3, 0x0D, 0x5D,
-    0x37, 0x6F, 0x15, 0xF2, 0x66, 0x0B, 0xA6, 0x1E, 0x15, 0x09, 0x29, 0xF4, 0xFB, 0xFF, 0x34, 0x2A,
-    0x02, 0xFA, 0x67, 0xF7, 0x5B, 0x17, 0x17, 0xCC, 0x44, 0x2E, 0xFA, 0x63, 0xE7, 0x92, 0x8C, 0xEE,
-    0xEA, 0xE2, 0x67, 0x80, 0x7E, 0x80, 0xA4, 0xCB, 0xB2, 0x79, 0xF5, 0xD9, 0x61, 0x33, 0xDF, 0xCC,
-    0x52, 0x99, 0x9E, 0xC5, 0x31, 0x91, 0xAB, 0xBF, 0xEE, 0xE8, 0x5F, 0xEA, 0xD5, 0x7B, 0xD0, 0xC7,
-    0x8A, 0x80, 0xAA, 0x75, 0xE5, 0x5D, 0x35, 0xAE, 0xD4, 0x48, 0xFE, 0xAF, 0xD5, 0x9A, 0x85, 0x3F,
-    0x46, 0xF4, 0xBF, 0xA3, 0x62, 0xFA, 0x79, 0xE5, 0x92, 0x4F, 0xB5, 0x02, 0x48, 0x31, 0x4C, 0x7C,
-    0xB8, 0xB0, 0xA0, 0xA6, 0x01, 0xD4, 0xE2, 0xF1, 0x91, 0x18, 0xC1, 0x0C, 0x33, 0x29, 0x0C, 0xAC,
-    0x33, 0xE6, 0x7F, 0x73, 0x99, 0x11, 0x8A, 0xC1, 0x06, 0x9A, 0x0C, 0xC2, 0xD9, 0xCD, 0x4D, 0x6C,
-    0x97, 0x29, 0x0B, 0xD4, 0x29, 0xC8, 0x3B, 0xF2, 0x83, 0xED, 0x1D, 0x21, 0xA7, 0x25, 0x9F, 0x56,
-    0xEE, 0xB0, 0xCB, 0xC6, 0xEF, 0x1E, 0xE7, 0x57, 0xB6, 0x8C, 0xE7, 0xD5, 0xF7, 0xE5, 0xCE, 0xFB,
-    0x12, 0xF7, 0x25, 0x53, 0x0E, 0x25, 0x95, 0xCF, 0x94, 0x6B, 0x6A, 0x30, 0xDE, 0x18, 0x1F, 0xB8,
-    0x1C, 0x7F, 0xFB, 0xA6, 0xAE, 0x89, 0x9E, 0xE4, 0x5B, 0x28, 0x58, 0x76, 0xD6, 0xA0, 0x87, 0xF6,
-    0x2F, 0xB9, 0x31, 0xD3, 0x6C, 0x5E, 0x1E, 0x2E, 0x8E, 0xEF, 0xBD, 0x0D, 0xD2, 0x7C, 0x88, 0xE8,
-    0x90, 0x72, 0x7F, 0xC0, 0x14, 0x6F, 0x60, 0x04, 0xD8, 0x2F, 0x1F, 0x5C, 0x82, 0x69, 0x06, 0x1A,
-    0x3B, 0x01, 0x6D, 0x39, 0x9A, 0x51, 0x38, 0x45, 0x74, 0x92, 0xA6, 0x13, 0x8D, 0xA7, 0xF6, 0xD6,
-    0x97, 0xE3, 0x08, 0xC7, 0x3C, 0x94, 0x0C, 0x0E, 0x77, 0x0F, 0xFE, 0x99, 0x0F, 0x48, 0x28, 0x98,
-    0xF7, 0x4B, 0x65, 0x07, 0x2B, 0x0E, 0xC9, 0x42, 0xA5, 0xDE, 0x26, 0x9E, 0xE9, 0x43, 0x89, 0xC5,
-    0xCD, 0x18, 0x61, 0xC9, 0x7E, 0xCE, 0xEA, 0x0D, 0x40, 0x21, 0xC8, 0xA7, 0xD8, 0x9A, 0x10, 0x75,
-    0x85, 0x0B, 0x6B, 0x58, 0xD1, 0xE3, 0xCE, 0xC0, 0xB4, 0x83, 0x41, 0x42, 0x43, 0xD2, 0xBA, 0xCB,
-    0xC3, 0xE6, 0x86, 0x2D, 0x1E, 0x52, 0x66, 0x70, 0xA2, 0x44, 0xDB, 0x69, 0x0F, 0xC5, 0xC1, 0xC0,
-    0x42, 0xB7, 0x30, 0x34, 0xFD, 0x31, 0xB2, 0xB7, 0xBB, 0x8E, 0x25, 0xFC, 0xBA, 0xB3, 0x79, 0x81,
-    0x0D, 0x04, 0xC9, 0x0D, 0xB8, 0x96, 0xD4, 0xC0, 0x89, 0xD4, 0x98, 0x87, 0xD8, 0x89, 0x65, 0x0B,
-    0xD0, 0x4E, 0xCC, 0x42, 0x89, 0xE4, 0xA2, 0x5A, 0x59, 0x3C, 0x57, 0x96, 0x3B, 0x65, 0xBD, 0x32,
-    0x16, 0x8B, 0x60, 0xD1, 0x42, 0x59, 0x5A, 0x28, 0xE3, 0xB0, 0x96, 0x0B, 0xEA, 0x91, 0x6D, 0x82,
-    0xEF, 0x43, 0xE9, 0xBC, 0x2F, 0x19, 0x0E, 0x79, 0x9B, 0x0E, 0xDA, 0x52, 0xC1, 0x05, 0xDD, 0x45,
-    0x87, 0x66, 0xDC, 0x83, 0xF9, 0x62, 0xF3, 0x89, 0xCD, 0x9E, 0x63, 0x26, 0xE8, 0x92, 0xA2, 0x29,
-    0xDE, 0x44, 0x1A, 0x63, 0xD8, 0x9B, 0x81, 0xCC, 0x5D, 0x1D, 0xE8, 0x2D, 0x30, 0x6C, 0x6E, 0x19,
-    0x3E, 0xFF, 0xA0, 0x1C, 0xB6, 0xC5, 0x95, 0x6A, 0x26, 0xE4, 0x13, 0x65, 0x7B, 0x64, 0xC9, 0xC4,
-    0x7E, 0x43, 0xF6, 0x08, 0x23, 0xAA, 0x7B, 0x5C, 0x03, 0x6B, 0xD0, 0xA0, 0xD1, 0xF2, 0x50, 0xA1,
-    0x8A, 0x2C, 0xEF, 0x2D, 0x8E, 0xBA, 0x15, 0xFE, 0x41, 0x35, 0x02, 0x76, 0x27, 0xD1, 0x6C, 0xFC,
-    0x04, 0xD3, 0x2B, 0x63, 0x53, 0x7D, 0xD0, 0x33, 0xF8, 0x8E, 0x8D, 0x89, 0x2E, 0xCF, 0x5D, 0x4B,
-    0x0C, 0xD3, 0x47, 0x96, 0xEA, 0x60, 0x74, 0x18, 0x6D, 0xA9, 0x4D, 0x47, 0xC6, 0x11, 0x8E, 0x7C,
-    0xE5, 0xA8, 0xAA, 0x71, 0xE9, 0xB2, 0x7E, 0xF5, 0x86, 0xE5, 0xCB, 0xB0, 0x9B, 0xA4, 0xAB, 0x62,
-    0x4A, 0x20, 0x09, 0x0E, 0xE5, 0x61, 0x3F, 0xF6, 0xC9, 0x50, 0xA6, 0x59, 0xBF, 0x27, 0x01, 0x79,
-    0xF9, 0x62, 0xF2, 0xC0, 0x2C, 0xA9, 0x27, 0xD1, 0xC5, 0xED, 0x54, 0xDB, 0x31, 0x35, 0xD9, 0xB4,
-    0x3D, 0x7F, 0x26, 0x76, 0xE6, 0x44, 0xD4, 0xF0, 0x48, 0x4C, 0x3A, 0xF3, 0x2A, 0xCE, 0xD1, 0x1E,
-    0x89, 0xCD, 0x52, 0x84, 0x67, 0x4D, 0x6D, 0x51, 0xD4, 0x46, 0xA3, 0x08, 0x15, 0xA3, 0xDE, 0xD3,
-    0xB3, 0x0C, 0x71, 0xAC, 0x9B, 0x11, 0x95, 0x15, 0x96, 0xBB, 0xE4, 0x6D, 0x6C, 0x3A, 0x61, 0x39,
-    0x6D, 0xF3, 0x39, 0xD8, 0x25, 0xE8, 0x9D, 0xD6, 0x52, 0x30, 0x4B, 0xE0, 0x4B, 0x59, 0x51, 0x4C,
-    0x77, 0xC4, 0xB0, 0x47, 0xE6, 0xEB, 0x01, 0xE3, 0x8C, 0x09, 0xA7, 0xB8, 0x80, 0x34, 0x1A, 0x23,
-    0x42, 0xEE, 0x02, 0x33, 0xCA, 0x2F, 0x84, 0x75, 0x29, 0xC6, 0x05, 0xFA, 0x21, 0xB0, 0xC3, 0xE5,
-    0xB6, 0x2C, 0xF5, 0xB1, 0xF5, 0x2D, 0xC5, 0xE5, 0x0E, 0x72, 0x7D, 0xCB, 0xCA, 0xB1, 0x3D, 0xDA,
-    0xF7, 0x65, 0x35, 0xC5, 0x45, 0x4D, 0xCF, 0xD9, 0xEC, 0x78, 0x48, 0x97, 0xAD, 0xC5, 0x35, 0xC7,
-    0x83, 0xFA, 0x18, 0xAA, 0x8E, 0x99, 0x47, 0xEA, 0xC8, 0x68, 0x75, 0x44, 0xED, 0x7D, 0xC2, 0xD4,
-    0xD2, 0xB0, 0xDC, 0x4D, 0x5A, 0x1A, 0x36, 0xEE, 0x4A, 0x85, 0xA9, 0x41, 0x11, 0xBC, 0x53, 0x6B,
-    0x34, 0x6E, 0x2C, 0xC2, 0x1F, 0x66, 0xDA, 0x76, 0xAB, 0x1E, 0x57, 0x02, 0x8B, 0x32, 0x4E, 0x5F,
-    0x61, 0x99, 0x23, 0xEF, 0x49, 0xA7, 0x68, 0xD2, 0x73, 0x99, 0xF7, 0x61, 0xBE, 0x7F, 0xCB, 0x2F,
-    0x61, 0xDA, 0x7B, 0xC0, 0x9D, 0x22, 0x7D, 0xBA, 0xC3, 0xE6, 0xDC, 0x71, 0x7F, 0xD3, 0xFA, 0xE9,
-    0xB4, 0xB3, 0x6D, 0x28, 0xB5, 0x46, 0x23, 0xEE, 0xB2, 0x60, 0x77, 0xC8, 0xA7, 0x29, 0xD3, 0x92,
-    0xA3, 0xCE, 0x80, 0x43, 0xC6, 0x9E, 0x9A, 0x64, 0x05, 0xE1, 0x0E, 0xE7, 0xC6, 0x21, 0x2A, 0x55,
-    0x80, 0xF1, 0x64, 0xBF, 0xC4, 0xEA, 0xCA, 0x86, 0xF5, 0x31, 0x03, 0xB2, 0xB2, 0x38, 0x36, 0xCA,
-    0xF5, 0x43, 0x5D, 0x46, 0x68, 0x73, 0xB6, 0xDC, 0xDF, 0x64, 0xE3, 0x63, 0x5F, 0xD9, 0x9E, 0xBD,
-    0x98, 0x8F, 0xF2, 0xFD, 0xB2, 0xD7, 0x13, 0x84, 0x16, 0x9D, 0x37, 0x0D, 0x39, 0xBE, 0x93, 0x96,
-    0x96, 0x27, 0x3B, 0x4D, 0x80, 0x5C, 0xBA, 0x51, 0xC7, 0x85, 0xE9, 0xD3, 0x1C, 0x2F, 0x81, 0xAF,
-    0x6A, 0x62, 0x20, 0xC0, 0x72, 0xC3, 0x86, 0x7D, 0x61, 0xE1, 0x55, 0x35, 0xC8, 0xDF, 0xD8, 0x97,
-    0x86, 0xBE, 0x2D, 0xAE, 0x01, 0x92, 0xA1, 0x16, 0x68, 0xC2, 0x9A, 0x28, 0xDE, 0x78, 0x9A, 0xE9,
-    0x15, 0xBA, 0x5A, 0x3B, 0xFC, 0x1A, 0xC3, 0xAA, 0xBE, 0x96, 0x0D, 0x38, 0x84, 0x1B, 0xF8, 0x56,
-    0x68, 0x79, 0x80, 0xDA, 0x87, 0x1D, 0x10, 0xD6, 0x00, 0x6E, 0x9C, 0x05, 0x75, 0x30, 0x66, 0x87,
-    0x5E, 0x19, 0xE7, 0x63, 0x21, 0x81, 0xD9, 0x53, 0x16, 0x7F, 0x15, 0x19, 0xE0, 0xBE, 0x45, 0x6B,
-    0x7C, 0xD4, 0xB5, 0x78, 0xA5, 0xE5, 0x36, 0xB7, 0x7F, 0x62, 0x45, 0xCD, 0x14, 0xA5, 0x86, 0x3E,
-    0x85, 0xA5, 0xF8, 0xF9, 0x31, 0x16, 0x8F, 0xE0, 0x63, 0xCE, 0xB9, 0x9E, 0x2A, 0xBB, 0x6E, 0x5E,
-    0xDB, 0x19, 0xDE, 0xB4, 0xEA, 0xD9, 0x1E, 0x97, 0xEE, 0xCE, 0x3E, 0xFB, 0x19, 0xEA, 0x94, 0x8B,
-    0x86, 0x8E, 0x86, 0x95, 0xB0, 0x78, 0x64, 0xF5, 0x71, 0x64, 0x65, 0x71, 0x52, 0x78, 0x7A, 0x82,
-    0x3F, 0xD6, 0x64, 0x70, 0x77, 0x68, 0x7E, 0x3D, 0x98, 0x61, 0x8B, 0x5C, 0xA7, 0x1B, 0xE6, 0x75,
-    0x5A, 0x16, 0x05, 0x2D, 0x41, 0x53, 0x93, 0x43, 0x8A, 0xD8, 0x94, 0x1A, 0xD9, 0xA4, 0x1D, 0xD9,
-    0x18, 0x21, 0x2B, 0xEA, 0x56, 0x5A, 0x90, 0x61, 0xFF, 0x62, 0xAD, 0x0F, 0x03, 0x66, 0x62, 0x1C,
-    0x4A, 0x9D, 0xFE, 0x10, 0xE3, 0xAC, 0x06, 0x74, 0xB5, 0x85, 0x06, 0x40, 0x81, 0x0A, 0x25, 0x97,
-    0x2D, 0x55, 0xA0, 0xD5, 0x3A, 0xAA, 0xA5, 0x55, 0x39, 0x99, 0xE8, 0x61, 0x80, 0x09, 0xD0, 0xBE,
-    0xFE, 0x44, 0x60, 0x91, 0x17, 0xB5, 0x9C, 0xD6, 0xB2, 0xE7, 0xB4, 0x46, 0x7B, 0xAA, 0x07, 0xD1,
-    0x74, 0x1E, 0x2A, 0x65, 0xE1, 0x53, 0xE2, 0xFC, 0xA5, 0x28, 0x53, 0x2E, 0x58, 0x24, 0x25, 0x7A,
-    0x1B, 0xE2, 0x1B, 0x46, 0x9C, 0xD2, 0x1B, 0x11, 0xA7, 0x46, 0xF0, 0xAA, 0x23, 0x5A, 0xCA, 0xBB,
-    0x76, 0xA9, 0x81, 0x95, 0x1F, 0x1C, 0xB2, 0x28, 0xBD, 0xFB, 0x16, 0xCF, 0x6C, 0x5E, 0x55, 0x56,
-    0xD1, 0xE0, 0x55, 0xF9, 0x22, 0xEE, 0xBD, 0x2A, 0xCD, 0xD2, 0xCE, 0xAB, 0xCE, 0xC0, 0x01, 0xD8,
-    0xAB, 0x6C, 0x8F, 0x28, 0x12, 0xE8, 0xB7, 0xD0, 0xE3, 0x2D, 0xAD, 0x6F, 0xAA, 0x34, 0xE9, 0x49,
-    0x23, 0xCC, 0xE2, 0xB6, 0x66, 0xF2, 0x87, 0xCA, 0x07, 0xAA, 0x7D, 0x5C, 0xC5, 0xAC, 0xDF, 0x0F,
-    0x09, 0x98, 0xAA, 0x0F, 0xCE, 0x21, 0xEF, 0xB2, 0x06, 0x6A, 0x4E, 0xEA, 0x8C, 0xB5, 0x33, 0xF7,
-    0x8B, 0xD3, 0xBA, 0xFC, 0x9B, 0xA8, 0x27, 0xE3, 0x41, 0xCE, 0x8E, 0x71, 0x0B, 0x7B, 0xF3, 0x5D,
-    0xBD, 0xBE, 0x3F, 0xD5, 0x62, 0xAE, 0x1C, 0x6E, 0xCC, 0x58, 0x21, 0xC1, 0x27, 0xA0, 0xBB, 0xE6,
-    0xA1, 0x8B, 0x4B, 0xD7, 0x18, 0x46, 0xCF, 0x90, 0x3F, 0x97, 0x6D, 0x80, 0xB3, 0x46, 0x07, 0x4F,
-    0x8A, 0x3A, 0x66, 0x1E, 0x25, 0x15, 0xFC, 0xD6, 0xC3, 0x56, 0x64, 0x34, 0x43, 0x35, 0x16, 0x7E,
-    0xBE, 0x1E, 0x87, 0x4A, 0xEE, 0x42, 0x6C, 0xB5, 0xB5, 0xDD, 0x4F, 0x75, 0xDC, 0x95, 0x5E, 0xB3,
-    0xB8, 0x46, 0xCC, 0xEC, 0xCD, 0x37, 0xEF, 0xC9, 0x79, 0x91, 0x4F, 0x86, 0xB5, 0xDB, 0xCD, 0x27,
-    0xFD, 0xDA, 0x6E, 0xFD, 0x69, 0xB7, 0xBE, 0x5B, 0x7F, 0xD1, 0xC6, 0x4D, 0xCD, 0xF3, 0x36, 0x8F,
-    0x2D, 0xEA, 0x53, 0xB7, 0x3F, 0x43, 0xE4, 0xEC, 0xD6, 0x13, 0x39, 0xBD, 0xA1, 0x65, 0x10, 0xC6,
-    0x57, 0x3F, 0xCB, 0x9E, 0xDA, 0xC6, 0x73, 0xA2, 0x8E, 0x4B, 0x8F, 0x7D, 0x4D, 0x5F, 0x97, 0xB7,
-    0xCA, 0x2C, 0xC5, 0x92, 0x53, 0xA5, 0x71, 0x76, 0x41, 0xE9, 0x3A, 0x28, 0xEF, 0x23, 0x6C, 0xC5,
-    0xFF, 0x17, 0xAD, 0xF4, 0x34, 0x57, 0xDB, 0xC4, 0xC5, 0x48, 0x39, 0xBB, 0x95, 0xC7, 0x67, 0xAF,
-    0xCA, 0x0B, 0x1B, 0x4E, 0x4F, 0x80, 0x3C, 0xD1, 0xF0, 0xEA, 0xC2, 0x3D, 0xB5, 0x2D, 0x07, 0x37,
-    0xF4, 0xAB, 0x4A, 0xFA, 0x4E, 0xCF, 0x52, 0xD8, 0xC7, 0xB9, 0x1D, 0xFA, 0xF5, 0x3A, 0x24, 0xD7,
-    0xF1, 0x06, 0x05, 0x93, 0x6C, 0x04, 0x16, 0x6D, 0xE6, 0x6B, 0x12, 0x52, 0xDC, 0xCD, 0x07, 0x9D,
-    0x79, 0xC2, 0x9D, 0xD0, 0x4E, 0x7E, 0xA2, 0x05, 0x12, 0x37, 0xAA, 0x9A, 0xA2, 0xDB, 0x76, 0x7F,
-    0x82, 0xEF, 0xDA, 0x28, 0xAB, 0xAB, 0xFC, 0x63, 0xD1, 0x9A, 0x67, 0xDF, 0x8D, 0x33, 0x7A, 0x3A,
-    0x7A, 0x22, 0x75, 0x42, 0x43, 0x7E, 0x8E, 0x09, 0x76, 0x73, 0x7D, 0xA5, 0x73, 0xAD, 0x48, 0xED,
-    0xBD, 0x48, 0x8F, 0x41, 0xF4, 0xDE, 0x29, 0x6B, 0x60, 0xE8, 0x46, 0x5E, 0xAF, 0x50, 0xE5, 0xDA,
-    0xE5, 0x05, 0x69, 0xAA, 0x34, 0xD1, 0x37, 0xA9, 0x9B, 0x68, 0xC3, 0x4B, 0x03, 0x69, 0xC3, 0x56,
-    0x37, 0x47, 0x61, 0x62, 0x99, 0xED, 0xC3, 0x61, 0x3A, 0x2D, 0x41, 0xDB, 0x1D, 0xEE, 0xEB, 0x5A,
-    0xC0, 0x7D, 0x5D, 0xF3, 0xA8, 0xE7, 0x05, 0x00, 0x79, 0x6F, 0x06, 0x9D, 0xAB, 0xE9, 0x09, 0x60,
-    0x7F, 0xBD, 0xDA, 0xB8, 0xDF, 0xE2, 0x94, 0xD8, 0x2A, 0x16, 0x77, 0x4A, 0xF7, 0x40, 0x8B, 0xEC,
-    0xBA, 0x73, 0x5F, 0xFC, 0x6B, 0x7E, 0x9B, 0x75, 0xF8, 0x5B, 0x0D, 0xE9, 0x61, 0x0D, 0x40, 0x7C,
-    0x99, 0x37, 0x28, 0xCD, 0xCF, 0x52, 0xBD, 0x5F, 0x39, 0x63, 0x60, 0x89, 0x1E, 0x7B, 0x04, 0x96,
-    0xD3, 0xE8, 0xC2, 0x7D, 0x72, 0x01, 0xA6, 0x4B, 0xDE, 0xBD, 0x5C, 0x2B, 0xFA, 0xD7, 0x9A, 0xAB,
-    0xE6, 0xCE, 0x6E, 0x63, 0xDC, 0x78, 0x60, 0xB0, 0x53, 0x83, 0x5F, 0x7F, 0x33, 0xFB, 0xDD, 0xB0,
-    0xA5, 0x68, 0xA7, 0xD9, 0x2E, 0xD7, 0xB5, 0x7A, 0xF2, 0x5A, 0x8D, 0x72, 0x0B, 0x75, 0x51, 0xCD,
-    0x0A, 0xAD, 0xF7, 0x6B, 0x66, 0xBB, 0xCE, 0xE7, 0x25, 0x5D, 0xDC, 0xFA, 0x35, 0xF2, 0x08, 0x0E,
-    0xD1, 0x64, 0xA9, 0x32, 0x9C, 0xB9, 0x96, 0xCC, 0x9F, 0x58, 0xF1, 0x43, 0x19, 0x32, 0xD8, 0x8B,
-    0x76, 0x51, 0x51, 0xE8, 0x4D, 0x0C, 0x15, 0x29, 0xF4, 0x2C, 0x5D, 0xE0, 0xB0, 0x04, 0x1A, 0xC9,
-    0xB7, 0x52, 0x6D, 0x93, 0x68, 0x7B, 0x58, 0xF1, 0x96, 0x7C, 0x64, 0x77, 0x8F, 0x58, 0xDE, 0xB3,
-    0xF2, 0x7A, 0x36, 0xE5, 0x05, 0xA3, 0x76, 0xE1, 0x63, 0xF4, 0xAB, 0x5F, 0xED, 0x22, 0x64, 0xA6,
-    0x91, 0x73, 0xBC, 0xA5, 0x73, 0x8F, 0xFE, 0x88, 0xF4, 0xDC, 0xEA, 0x11, 0x3D, 0x7F, 0xDE, 0x69,
-    0xF6, 0xDD, 0x52, 0x20, 0x61, 0x8E, 0xE8, 0x63, 0xDE, 0x89, 0x9C, 0x5B, 0x4D, 0xEB, 0xB0, 0x3B,
-    0xB7, 0x0A, 0x20, 0x6A, 0xCF, 0xAD, 0x86, 0x7D, 0x5C, 0x9F, 0x5B, 0x0D, 0x86, 0x14, 0xD4, 0x1F,
-    0xD2, 0x0A, 0xB4, 0x27, 0xF5, 0xDA, 0xBC, 0x7A, 0xE8, 0x21, 0x97, 0x59, 0x69, 0x9D, 0x56, 0xC7,
-    0xA8, 0x5A, 0xC9, 0xEA, 0xEC, 0x48, 0x83, 0x61, 0xA6, 0xAE, 0x10, 0x58, 0x95, 0x69, 0x19, 0x3D,
-    0x2F, 0x46, 0xDB, 0x8D, 0x89, 0xEC, 0x04, 0x75, 0x1E, 0x4F, 0x02, 0xD1, 0xAF, 0x0A, 0x23, 0xB9,
-    0x18, 0x60, 0xF3, 0x30, 0xB6, 0x83, 0x33, 0xE1, 0xC0, 0xDB, 0x2D, 0x20, 0xFD, 0x02, 0xA4, 0xAC,
-    0xBE, 0x4A, 0xEC, 0x6B, 0x11, 0x4A, 0xA8, 0x65, 0x70, 0x43, 0x82, 0x4A, 0x71, 0x80, 0xA5, 0xD8,
-    0x64, 0xA1, 0x17, 0xB7, 0x24, 0x0D, 0x49, 0x7B, 0x92, 0x34, 0xD3, 0xD7, 0x12, 0x41, 0x70, 0x49,
-    0xE6, 0xA5, 0x96, 0x79, 0x9A, 0x6E, 0x96, 0x0A, 0x19, 0x71, 0x38, 0x70, 0x22, 0x88, 0x7B, 0xA0,
-    0xC1, 0x87, 0x38, 0xAE, 0x12, 0xF6, 0xE1, 0x74, 0x65, 0x05, 0x43, 0xE6, 0x0B, 0x1C, 0x0E, 0x52,
-    0x1A, 0xF3, 0x8C, 0xE1, 0x41, 0xF9, 0x4D, 0x44, 0xA3, 0x84, 0x45, 0x91, 0x5E, 0xB0, 0xF3, 0xC6,
-    0x3D, 0x44, 0x86, 0x7D, 0x50, 0xCE, 0xF5, 0xA6, 0x0D, 0xC3, 0xF3, 0xFB, 0xE6, 0x71, 0xF4, 0x45,
-    0x6D, 0x60, 0x57, 0x17, 0x73, 0x25, 0x84, 0xE7, 0xE2, 0xBF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFB, 0xE1, 0x04, 0x03, 0x08, 0x00, 0x00, 0xCD, 0x94, 0x3D, 0x6E, 0xDB, 0x40, 0x10, 0x85, 0x87,
-    0x22, 0x2C, 0x22, 0x60, 0xC1, 0x4A, 0x8D, 0x5C, 0xB0, 0x4E, 0xB5, 0x47, 0x58, 0x76, 0x69, 0x5D,
-    0x48, 0x48, 0x91, 0x43, 0xF8, 0x06, 0x21, 0x8F, 0xE0, 0x1B, 0xA4, 0x49, 0x61, 0x04, 0x08, 0x7C,
-    0x01, 0x03, 0x2B, 0xC3, 0xA5, 0x1B, 0x02, 0xB9, 0x00, 0x9B, 0x14, 0x71, 0x1A, 0x16, 0x0C, 0x40,
-    0x05, 0x4B, 0x4E, 0xDE, 0xEC, 0x50, 0x24, 0x0C, 0xB8, 0x8C, 0xE3, 0x08, 0x12, 0xBF, 0x11, 0xB0,
-    0x7F, 0xEF, 0xED, 0x1B, 0x12, 0x9D, 0xED, 0x68, 0x3D, 0x5E, 0xD1, 0x8A, 0xB9, 0x28, 0xD9, 0x53,
-    0xC6, 0x7C, 0xC7, 0x9F, 0x06, 0x32, 0xBD, 0xFD, 0xC6, 0xE9, 0x40, 0xB6, 0x35, 0x0F, 0x63, 0xD2,
-    0x53, 0xD9, 0x6E, 0xB3, 0x21, 0x22, 0x72, 0x2D, 0xE5, 0x03, 0x11, 0x31, 0xE8, 0x95, 0x06, 0xFF,
-    0x2D, 0x87, 0x4F, 0x71, 0xE2, 0x86, 0x7F, 0xED, 0x6F, 0xC6, 0xFD, 0x93, 0x71, 0x2F, 0x4D, 0x39,
-    0xC7, 0x8A, 0x71, 0x54, 0x2E, 0xF0, 0xE3, 0x9F, 0xCC, 0xE3, 0x4C, 0xA2, 0x35, 0xFF, 0xC0, 0x33,
-    0xC2, 0xE1, 0x1A, 0xA2, 0x84, 0xDF, 0x73, 0x47, 0x32, 0x13, 0xE3, 0xC9, 0x76, 0x54, 0xE2, 0x5F,
-    0xD9, 0x92, 0x6D, 0x82, 0xC2, 0xB7, 0x14, 0x40, 0xBA, 0x2E, 0x4D, 0xF2, 0xFC, 0x09, 0x22, 0xEE,
-    0xD2, 0xCF, 0x7B, 0xBF, 0x10, 0x20, 0x67, 0x52, 0xA3, 0x22, 0xBA, 0x09, 0x22, 0xE5, 0xF1, 0x5A,
-    0xA5, 0x78, 0x95, 0xE2, 0x55, 0x8A, 0x0F, 0x52, 0xAC, 0x57, 0x29, 0x3E, 0x68, 0x30, 0x8A, 0x65,
-    0x69, 0x68, 0xE8, 0x17, 0x40, 0xCA, 0x2E, 0xFF, 0xB7, 0x52, 0xEE, 0x55, 0xCA, 0x7D, 0x90, 0x82,
-    0xF4, 0x45, 0x37, 0xBF, 0x0B, 0x0A, 0xF9, 0x33, 0x41, 0x10, 0x12, 0x78, 0xE0, 0xEF, 0x0E, 0x77,
-    0x16, 0x32, 0x48, 0x86, 0x49, 0x53, 0x48, 0xD9, 0x48, 0x9A, 0x43, 0xCA, 0x66, 0x55, 0xEB, 0x62,
-    0xC9, 0xC0, 0x9C, 0x82, 0x39, 0x8F, 0xCC, 0xD5, 0x52, 0x85, 0x6B, 0x1B, 0xF7, 0x1F, 0xB8, 0x9A,
-    0x66, 0xC4, 0xAF, 0x5B, 0xE1, 0xA4, 0x09, 0x57, 0x93, 0x31, 0x19, 0xD7, 0x7A, 0xBF, 0x03, 0xE2,
-    0xBA, 0x54, 0x44, 0xDB, 0xCF, 0x14, 0xB9, 0xC7, 0x2F, 0x85, 0x38, 0x54, 0x19, 0xD1, 0x01, 0x1F,
-    0xDC, 0x1D, 0x1C, 0x42, 0x65, 0xBA, 0x1C, 0x0E, 0xE5, 0xA8, 0x6C, 0x9B, 0xC1, 0xA1, 0x14, 0x95,
-    0x6B, 0xDF, 0x64, 0x61, 0xE5, 0xA9, 0x57, 0x9F, 0xDB, 0x37, 0x9E, 0x7D, 0x79, 0x52, 0x4D, 0x0E,
-    0xC5, 0xFF, 0xA3, 0x43, 0xA4, 0x0E, 0x3D, 0x30, 0xB7, 0xEA, 0x10, 0xAA, 0x2E, 0x38, 0x64, 0xF8,
-    0x0A, 0x37, 0x1E, 0x6B, 0x9B, 0x67, 0xE3, 0x3B, 0xAE, 0x43, 0x1F, 0x38, 0x6D, 0x69, 0xE9, 0x6C,
-    0xB4, 0xBC, 0x15, 0xD4, 0x27, 0x94, 0x0A, 0x24, 0x30, 0xE2, 0x3A, 0x45, 0xEC, 0x80, 0x4C, 0x71,
-    0xE6, 0x8E, 0xBB, 0x48, 0x87, 0xFC, 0x7D, 0xF4, 0x40, 0x23, 0xAD, 0x99, 0x60, 0x6B, 0xCB, 0x5F,
-    0x1D, 0xD4, 0xE4, 0x3C, 0x08, 0x12, 0x0E, 0xC1, 0xA5, 0x8D, 0x3C, 0x2E, 0xC7, 0x42, 0x90, 0x30,
-    0x1F, 0x85, 0xF9, 0xF1, 0x1C, 0x86, 0x40, 0x55, 0x2D, 0xD3, 0x21, 0xEB, 0x40, 0xCF, 0xD2, 0x2A,
-    0xD7, 0xAE, 0x59, 0x81, 0x08, 0x4C, 0x77, 0x8E, 0x36, 0x47, 0x5C, 0xBC, 0xB4, 0xBB, 0x6D, 0x52,
-    0x8F, 0x1B, 0xBE, 0xB0, 0x87, 0xD8, 0xCB, 0xB8, 0xF2, 0x10, 0xF7, 0x81, 0x4D, 0x54, 0x04, 0x86,
-    0xF7, 0x3A, 0x8E, 0x27, 0x06, 0x82, 0x46, 0x0C, 0x05, 0x53, 0x79, 0x65, 0xE2, 0x8B, 0x17, 0x4E,
-    0x18, 0x8F, 0xBC, 0x0D, 0xBA, 0x1F, 0x9A, 0x14, 0xDC, 0x62, 0x84, 0xF0, 0x23, 0xEE, 0x40, 0xC8,
-    0xB4, 0x1A, 0xE5, 0xF6, 0xB8, 0x8A, 0x07, 0xB1, 0xD8, 0xD5, 0x69, 0x8F, 0xA1, 0xB7, 0x96, 0xC3,
-    0xE2, 0x1E, 0xAA, 0x0A, 0x4C, 0xE9, 0x69, 0x73, 0x81, 0x35, 0xF6, 0xF4, 0x07, 0x4D, 0x90, 0xB1,
-    0x0D, 0x83, 0x30, 0x14, 0x44, 0x0F, 0x53, 0x50, 0xD0, 0xA6, 0x77, 0x36, 0x60, 0x04, 0xCA, 0x8C,
-    0x90, 0x55, 0xD2, 0xC1, 0x26, 0x59, 0x24, 0x12, 0x8C, 0x90, 0x11, 0x18, 0x81, 0x22, 0x05, 0x52,
-    0x88, 0x2F, 0x77, 0x36, 0x91, 0xE2, 0xE2, 0xFB, 0xC9, 0x7A, 0xFF, 0xFE, 0x97, 0x81, 0xBF, 0x73,
-    0x3B, 0xEE, 0x2A, 0x1D, 0xD0, 0x70, 0x2C, 0x10, 0xB9, 0x14, 0x18, 0xB8, 0x15, 0x85, 0x4C, 0x87,
-    0xC2, 0x22, 0xC5, 0x27, 0xBA, 0x2C, 0x0D, 0x38, 0xD5, 0x96, 0xAA, 0x0F, 0x12, 0x2C, 0x35, 0x7B,
-    0x45, 0x0C, 0x92, 0x62, 0x0A, 0x44, 0xBF, 0x38, 0xE5, 0x2D, 0xD8, 0x9C, 0x42, 0x41, 0xCA, 0x29,
-    0x09, 0x13, 0xC7, 0x28, 0xD8, 0x41, 0x2E, 0xBD, 0xE0, 0x55, 0x93, 0x5B, 0xE7, 0x01, 0x7A, 0x5E,
-    0x5B, 0x81, 0x1B, 0xE6, 0xA0, 0x52, 0xBB, 0x51, 0x0D, 0xBC, 0xD8, 0x87, 0xA4, 0xBB, 0x14, 0xC0,
-    0x92, 0x14, 0x20, 0x64, 0xF0, 0x3E, 0x53, 0xAA, 0xAD, 0x48, 0xD2, 0x1E, 0xAB, 0xA1, 0xD5, 0x84,
-    0xD9, 0x10, 0xBC, 0x59, 0x3E, 0xD3, 0x75, 0x2F, 0xD0, 0x15, 0xC5, 0x49, 0x73, 0x81, 0xC0, 0xDF,
-    0xFF, 0x3C, 0x7E, 0x70, 0x76, 0xF9, 0x02,
+static const uint8_t notoserif_18_boldBitmaps[47866] = {
+    0xCD, 0x5A, 0xBF, 0xB3, 0xDD, 0xD6, 0x71, 0x3E, 0xB8, 0x30, 0x1F, 0xC6, 0xC4, 0x4C, 0x90, 0x42,
+    0xF4, 0x38, 0xE4, 0x4C, 0x90, 0x36, 0x4A, 0x81, 0x7F, 0x20, 0x22, 0x60, 0x35, 0x9E, 0x71, 0x93,
+    0x57, 0xF0, 0xD9, 0x85, 0x0A, 0x36, 0xA9, 0x94, 0xE2, 0xB5, 0x29, 0x24, 0xE2, 0x46, 0x29, 0x5D,
+    0xE4, 0x15, 0x91, 0x53, 0xB8, 0x70, 0xC3, 0xCC, 0x58, 0x2F, 0xC5, 0x6B, 0x52, 0xB8, 0x20, 0x03,
+    0x58, 0x2A, 0x52, 0xB0, 0x10, 0x1C, 0x66, 0x9C, 0xC2, 0x85, 0x30, 0x19, 0xBD, 0x22, 0x74, 0x21,
+    0x24, 0x86, 0x2C, 0x50, 0x02, 0x70, 0xF2, 0x7D, 0xDF, 0x02, 0xF7, 0x5D, 0x32, 0x14, 0xA5, 0x50,
+    0xA4, 0xEC, 0xFB, 0xEE, 0xDD, 0x3D, 0x0F, 0x3F, 0xCE, 0xD9, 0xDD, 0xB3, 0xBB, 0x67, 0x77, 0xCF,
+    0xC9, 0xA7, 0x7C, 0xCA, 0xC7, 0x4C, 0x7F, 0xE9, 0x90, 0x0E, 0xC9, 0x90, 0xF4, 0xF8, 0xEB, 0x92,
+    0x2E, 0xC6, 0x5F, 0xD4, 0x45, 0x6D, 0xD8, 0x06, 0x85, 0xC3, 0xE7, 0xE0, 0x24, 0x1D, 0xF3, 0x31,
+    0x9F, 0xB2, 0x31, 0xE9, 0x1D, 0xAE, 0x1C, 0x38, 0x57, 0xBA, 0xCD, 0xEC, 0xD2, 0xDE, 0x95, 0xAD,
+    0xF3, 0x75, 0xE8, 0x5D, 0x3C, 0xBB, 0x64, 0x72, 0xD9, 0xE8, 0x72, 0x7C, 0x07, 0x57, 0xF6, 0xAE,
+    0xD2, 0xD7, 0x77, 0x17, 0x5F, 0xBB, 0x82, 0x5B, 0x78, 0x00, 0x5F, 0x3C, 0x8C, 0x57, 0xF0, 0x22,
+    0x5E, 0x0F, 0xFC, 0xD6, 0x95, 0x0D, 0x3B, 0x8C, 0x26, 0xE7, 0x2A, 0xE7, 0x62, 0x0C, 0x7B, 0xE2,
+    0x1C, 0xFF, 0xA9, 0x79, 0x39, 0x9E, 0xF8, 0x18, 0xC6, 0x72, 0x55, 0xEB, 0xCA, 0x4E, 0x5D, 0x8C,
+    0xEC, 0x22, 0x9D, 0x5C, 0x0A, 0x4A, 0xBC, 0x4B, 0x1E, 0xFD, 0xF2, 0xE2, 0xEC, 0x32, 0xA3, 0x09,
+    0x0F, 0x77, 0x7C, 0xD1, 0xD7, 0x1B, 0x5F, 0x44, 0x20, 0xB5, 0xE7, 0x68, 0xB3, 0x73, 0xAD, 0x5B,
+    0xF8, 0x1B, 0x20, 0x85, 0x29, 0x9D, 0x30, 0xFA, 0xE8, 0x86, 0x4D, 0x97, 0x35, 0xB7, 0xDC, 0x9F,
+    0xF0, 0x56, 0xEE, 0x87, 0xDD, 0xF7, 0xF2, 0x36, 0xEF, 0xCA, 0xA1, 0x1A, 0xCA, 0x3E, 0x6B, 0x03,
+    0x67, 0x9F, 0xD8, 0xA3, 0x8B, 0xD2, 0x4F, 0xE0, 0xE0, 0x3F, 0x7C, 0x01, 0x12, 0x7D, 0x0D, 0x8E,
+    0xCA, 0x36, 0xC1, 0xA8, 0x5D, 0x0A, 0xD0, 0x6B, 0x7C, 0x4A, 0x65, 0x14, 0xC1, 0x62, 0xFC, 0x51,
+    0x30, 0x3D, 0x7E, 0x6D, 0x34, 0xC0, 0xC9, 0xC1, 0xBB, 0xEA, 0x45, 0xFD, 0x41, 0x08, 0x65, 0xAB,
+    0x31, 0x02, 0xFF, 0x96, 0x2F, 0x5C, 0xE5, 0xC1, 0x42, 0xEA, 0x7B, 0xD0, 0x71, 0x44, 0x62, 0xC0,
+    0x93, 0xDB, 0xF8, 0x86, 0xD7, 0x00, 0x2A, 0x80, 0x6B, 0x13, 0x40, 0xDE, 0x13, 0x34, 0x00, 0x97,
+    0x1D, 0x6F, 0x3C, 0x47, 0x10, 0x78, 0x0D, 0xD9, 0x61, 0x72, 0xBC, 0xEF, 0x05, 0x4C, 0x2E, 0x15,
+    0x26, 0x34, 0xF6, 0x9E, 0xDC, 0x61, 0x6E, 0xCA, 0x2E, 0xF4, 0x45, 0xD5, 0x84, 0xBE, 0xAE, 0x30,
+    0x03, 0x75, 0x49, 0x90, 0x11, 0x04, 0x10, 0x59, 0xED, 0xF0, 0x36, 0xB4, 0x2A, 0xC2, 0xFC, 0x52,
+    0x23, 0x40, 0xFE, 0x40, 0xC9, 0x77, 0x4E, 0xF3, 0x8D, 0xEE, 0xD1, 0x88, 0x46, 0x5E, 0xE7, 0xA5,
+    0x72, 0x8B, 0x61, 0x67, 0x17, 0x74, 0xE1, 0xE0, 0x36, 0x5D, 0xD2, 0xBA, 0xB0, 0xCB, 0xB7, 0xB8,
+    0x85, 0xB1, 0xFD, 0xE3, 0x60, 0xA5, 0xE5, 0x84, 0xB4, 0x8C, 0x46, 0x4B, 0x0E, 0x5A, 0xB6, 0x25,
+    0x69, 0x11, 0x19, 0x39, 0x41, 0x4C, 0x40, 0x32, 0xB6, 0x4E, 0x6A, 0x46, 0x75, 0x73, 0x54, 0x33,
+    0xBC, 0x5B, 0x10, 0x7C, 0xE8, 0xDC, 0x95, 0x6A, 0x26, 0x1D, 0x7C, 0x2E, 0xE0, 0xA4, 0x3B, 0x75,
+    0x5F, 0x19, 0x78, 0x85, 0x60, 0xE2, 0x35, 0x2A, 0x69, 0xEB, 0xB7, 0x64, 0xF5, 0xE3, 0x63, 0x5F,
+    0x64, 0x1E, 0xBA, 0x11, 0x79, 0x50, 0xE0, 0x2E, 0x1D, 0x92, 0x18, 0xB1, 0x0A, 0x72, 0x08, 0x13,
+    0xC1, 0x5C, 0xB0, 0x14, 0xFC, 0x84, 0x70, 0xF3, 0x1B, 0x89, 0xE3, 0x3E, 0x61, 0xF2, 0xB7, 0x84,
+    0xA9, 0xDE, 0xBA, 0x2E, 0x78, 0x87, 0x30, 0xE8, 0x09, 0x43, 0x8A, 0xD5, 0xC5, 0x35, 0x61, 0xB2,
+    0x25, 0xCC, 0xD4, 0x7F, 0x79, 0xF4, 0x9A, 0x7F, 0x1B, 0x3D, 0xE2, 0x53, 0x18, 0x5C, 0xC7, 0xDD,
+    0x87, 0x11, 0xB9, 0x05, 0x0D, 0x8D, 0xD3, 0xEC, 0x2D, 0x30, 0xE2, 0xE3, 0xF1, 0x0E, 0x24, 0x02,
+    0x6F, 0x1F, 0x1D, 0x17, 0x09, 0xC6, 0x10, 0xD8, 0x26, 0x7C, 0x3B, 0x75, 0x3B, 0x40, 0x27, 0x01,
+    0x3E, 0xB7, 0x04, 0x83, 0xFB, 0xE3, 0xC3, 0x52, 0x12, 0x34, 0x59, 0xD6, 0x8B, 0x8E, 0x38, 0x13,
+    0x99, 0x81, 0x6F, 0x13, 0xBC, 0xC9, 0x1B, 0x34, 0xFE, 0xBA, 0xC2, 0x50, 0x45, 0x79, 0x5E, 0xCE,
+    0xEC, 0xA0, 0x77, 0x07, 0xEC, 0x6A, 0x91, 0x16, 0x3F, 0x1B, 0xFF, 0x90, 0x1A, 0x8D, 0x8B, 0x55,
+    0x53, 0xB5, 0x81, 0x66, 0x10, 0xC6, 0xDD, 0xC5, 0xF0, 0x1F, 0x0D, 0xEC, 0xE2, 0x0F, 0x0A, 0xE9,
+    0x4B, 0x46, 0xCD, 0xCB, 0x05, 0xBA, 0x2B, 0x85, 0xCB, 0x7F, 0x0B, 0xC1, 0xE7, 0x92, 0xC0, 0x8C,
+    0x81, 0xE0, 0x75, 0xCA, 0x0E, 0x2A, 0x95, 0xF7, 0x04, 0x03, 0x40, 0x36, 0xE0, 0xE1, 0x6C, 0xC8,
+    0x08, 0xD0, 0x41, 0x36, 0xD0, 0xC4, 0xFA, 0x78, 0x94, 0x82, 0xC0, 0x94, 0x02, 0xFF, 0x37, 0xA0,
+    0xBE, 0xA4, 0x89, 0xC5, 0xAB, 0x89, 0xB1, 0xBF, 0x7E, 0x07, 0x3A, 0x03, 0x6F, 0x1F, 0x95, 0x0D,
+    0xE6, 0x3F, 0xAF, 0xFF, 0x9C, 0xCA, 0x09, 0x40, 0xF6, 0x03, 0x82, 0x0D, 0xB5, 0x28, 0xA4, 0xE6,
+    0xC6, 0xA4, 0x30, 0xE9, 0x57, 0x1D, 0xCE, 0x29, 0x91, 0xB2, 0xA6, 0xEA, 0x70, 0x0E, 0x34, 0xE9,
+    0x7C, 0x21, 0x9C, 0x57, 0x55, 0x4F, 0xA4, 0xEF, 0xFD, 0x6A, 0x07, 0x39, 0x05, 0x57, 0xD5, 0x8B,
+    0x45, 0xD8, 0xE7, 0x1A, 0xB5, 0x92, 0x53, 0x16, 0xFA, 0xEF, 0x40, 0x85, 0xA7, 0x3D, 0xAF, 0x93,
+    0xD1, 0xEB, 0x64, 0x3D, 0x5B, 0x1D, 0x1C, 0x64, 0xDE, 0x41, 0xD3, 0xCA, 0x26, 0x82, 0x62, 0x16,
+    0x01, 0x0D, 0x01, 0x6C, 0xB5, 0x9C, 0x7A, 0xBA, 0x57, 0x08, 0x36, 0x9A, 0x53, 0xDF, 0x26, 0xC3,
+    0xC6, 0x53, 0x38, 0xE5, 0x48, 0xE1, 0x8C, 0x70, 0xEC, 0xC9, 0x64, 0xA0, 0x03, 0x35, 0xB8, 0x96,
+    0x8E, 0xD9, 0x40, 0x4F, 0x34, 0xC3, 0x93, 0x52, 0x55, 0xE0, 0xB1, 0xFD, 0xB0, 0xBA, 0x1E, 0x29,
+    0x02, 0x2E, 0x05, 0x9C, 0xC1, 0xC8, 0xFF, 0x18, 0x3E, 0x76, 0x0C, 0xA0, 0xFE, 0x03, 0x08, 0xA6,
+    0xEF, 0x6D, 0xD8, 0x73, 0x4B, 0xC7, 0xDD, 0xED, 0x40, 0x2F, 0x90, 0x73, 0x3D, 0xE0, 0x92, 0x31,
+    0xA4, 0xF3, 0xC6, 0x0F, 0xD4, 0xBA, 0x1E, 0xBD, 0xE0, 0xF2, 0xD5, 0xDB, 0xF9, 0x85, 0x00, 0x64,
+    0xFA, 0x92, 0x42, 0x13, 0x53, 0x0A, 0x29, 0x38, 0x29, 0xD2, 0x1A, 0x12, 0x4B, 0xC8, 0x31, 0x5E,
+    0x6B, 0x39, 0x78, 0x61, 0x9A, 0x73, 0xA9, 0xC8, 0xE0, 0xAA, 0xCB, 0xB1, 0xC4, 0x24, 0x1F, 0x14,
+    0xEE, 0xB1, 0xCF, 0xE5, 0x13, 0x8C, 0x8D, 0xBB, 0xF9, 0x90, 0x75, 0xC1, 0x17, 0x3D, 0x4B, 0xA7,
+    0x8F, 0xA7, 0x73, 0xAC, 0x8F, 0x61, 0x1F, 0x76, 0x51, 0x53, 0x6E, 0x27, 0x2E, 0x4D, 0xFC, 0x04,
+    0x74, 0x73, 0x29, 0xB5, 0x3E, 0x9F, 0x62, 0x8F, 0xD5, 0x0D, 0x1E, 0xA4, 0xEA, 0xE8, 0x55, 0x3A,
+    0xE8, 0xDC, 0x41, 0x2B, 0x47, 0xB1, 0x31, 0xD0, 0x2C, 0xE6, 0x20, 0xB3, 0x4B, 0x38, 0xDB, 0xE5,
+    0xB0, 0x5C, 0x97, 0xB7, 0x89, 0xC9, 0x61, 0x24, 0x40, 0x36, 0x83, 0xC3, 0x47, 0xC8, 0x38, 0xE0,
+    0x88, 0x29, 0x95, 0x22, 0x7F, 0x14, 0x48, 0xA9, 0x9C, 0xC8, 0x0E, 0x16, 0xDD, 0x50, 0x9F, 0x32,
+    0x73, 0x5B, 0xDE, 0xA2, 0xC5, 0x11, 0x26, 0x8B, 0x73, 0x4E, 0xCA, 0x51, 0x38, 0x4B, 0x0D, 0xE7,
+    0x72, 0xBA, 0xCE, 0xDD, 0x12, 0x55, 0xF0, 0x30, 0xB1, 0xE1, 0x51, 0xFE, 0x50, 0xBE, 0x86, 0x1D,
+    0x87, 0x9D, 0x75, 0x1C, 0x76, 0x66, 0xC7, 0x71, 0x63, 0x2E, 0x30, 0xA9, 0xB9, 0xAC, 0xCB, 0x44,
+    0xA5, 0x0F, 0x30, 0x62, 0x2F, 0xF2, 0x1C, 0x97, 0x5F, 0x74, 0xCB, 0x5B, 0x4E, 0x6B, 0xB9, 0x06,
+    0x18, 0xCD, 0xFD, 0x05, 0xA3, 0x09, 0x04, 0x6E, 0x1C, 0xB8, 0x71, 0xB0, 0x3C, 0x50, 0x8A, 0x88,
+    0x81, 0xC1, 0x02, 0xB4, 0x7A, 0xC5, 0x50, 0xD0, 0x77, 0xA4, 0xE7, 0x52, 0xAC, 0x07, 0x95, 0x27,
+    0x7F, 0xF0, 0x2E, 0x10, 0x30, 0x5E, 0x03, 0x84, 0x7C, 0x9F, 0x08, 0xED, 0x6E, 0xC4, 0x27, 0xDB,
+    0xE3, 0x99, 0xCA, 0x61, 0x2A, 0x02, 0x22, 0x71, 0xE5, 0x1A, 0x4D, 0xA1, 0xB1, 0x2F, 0xF8, 0x20,
+    0xAC, 0x06, 0xC2, 0xD2, 0xE0, 0x78, 0x01, 0xED, 0xBA, 0xEF, 0x37, 0x7C, 0x18, 0xCE, 0xE1, 0xFC,
+    0xA6, 0xAF, 0x49, 0xCF, 0x2C, 0xAA, 0x4E, 0x76, 0x73, 0xA4, 0x65, 0x22, 0x96, 0x2B, 0x2D, 0x1F,
+    0xBE, 0xC6, 0x45, 0xBA, 0x16, 0x01, 0xB8, 0xD3, 0xC2, 0x6A, 0xE0, 0x53, 0x60, 0x8B, 0x2E, 0x2F,
+    0x38, 0x6F, 0x2F, 0x39, 0x9B, 0x84, 0x6A, 0xB8, 0x80, 0x36, 0x3D, 0x9F, 0x07, 0xF7, 0x9F, 0xB4,
+    0x77, 0x35, 0xFF, 0x26, 0x63, 0x93, 0xEC, 0x09, 0x9D, 0xEE, 0x06, 0xC6, 0x09, 0x63, 0x05, 0xD9,
+    0xFE, 0x9F, 0x20, 0xDE, 0x54, 0xF4, 0x80, 0xED, 0x0F, 0x39, 0x95, 0x37, 0x64, 0xF0, 0x9F, 0x16,
+    0x26, 0xD0, 0x89, 0x12, 0x7F, 0x70, 0x86, 0xA7, 0xC4, 0x5A, 0x2F, 0x57, 0x8D, 0x5E, 0x89, 0x52,
+    0x2F, 0x94, 0x48, 0x4C, 0x5C, 0xF6, 0x88, 0xC2, 0x15, 0x35, 0x86, 0x28, 0x66, 0xB7, 0x79, 0x0A,
+    0x0A, 0x57, 0xD4, 0xEC, 0xBD, 0xBE, 0x74, 0x66, 0x73, 0x48, 0xCA, 0x89, 0xB2, 0xD9, 0x99, 0xC4,
+    0x8D, 0x96, 0x0E, 0x4F, 0x9D, 0x1F, 0x83, 0x9D, 0x85, 0xCE, 0x45, 0xD2, 0x15, 0xF1, 0x96, 0xC0,
+    0xD7, 0x20, 0xFD, 0x94, 0xE1, 0x04, 0x68, 0x55, 0x7F, 0xC9, 0x1E, 0x8C, 0x6B, 0x5B, 0x75, 0x9E,
+    0x04, 0x65, 0x5D, 0x52, 0xA7, 0x15, 0xB6, 0x9F, 0xF3, 0xE4, 0xA3, 0x30, 0xE8, 0xC5, 0x98, 0x41,
+    0xD9, 0x02, 0xD7, 0xDF, 0xF3, 0xA3, 0x9B, 0x8A, 0x35, 0xFC, 0x02, 0x9F, 0x07, 0x85, 0x06, 0xCF,
+    0x8F, 0x0E, 0x1F, 0xA3, 0xB3, 0xF9, 0x52, 0x74, 0xAE, 0x50, 0x7E, 0x47, 0x26, 0x25, 0xF1, 0x75,
+    0x2B, 0xDC, 0x7D, 0x8E, 0xBD, 0x45, 0x34, 0xB4, 0x0B, 0x97, 0xCF, 0x47, 0x7E, 0x94, 0x2C, 0xB2,
+    0x49, 0x81, 0x10, 0x9C, 0x02, 0x95, 0x2A, 0x56, 0x88, 0x4D, 0xC7, 0x44, 0x75, 0x0B, 0x56, 0xAD,
+    0x93, 0xF3, 0xDA, 0xE9, 0xE3, 0xA2, 0xA2, 0xFF, 0x17, 0x5D, 0x3E, 0x3D, 0x3D, 0x01, 0x42, 0x14,
+    0xD1, 0xE2, 0x49, 0xAE, 0xEC, 0x7C, 0x21, 0x9F, 0xA4, 0xC1, 0x0A, 0x71, 0x85, 0xA8, 0xC3, 0x40,
+    0x1C, 0x0F, 0x88, 0x1E, 0x32, 0x1F, 0x45, 0x3F, 0xEF, 0x57, 0x73, 0xC1, 0xA7, 0x13, 0x73, 0x2F,
+    0x70, 0xB9, 0xB3, 0xBC, 0xDD, 0x91, 0x2C, 0x0E, 0x61, 0xA5, 0x89, 0x5B, 0x3F, 0x32, 0x7B, 0x0D,
+    0x3F, 0xBE, 0x4A, 0x9F, 0x12, 0x08, 0xD7, 0x5F, 0x01, 0x6B, 0x1E, 0xF7, 0xF0, 0x57, 0xED, 0xCF,
+    0xF0, 0x4A, 0x5F, 0x24, 0x9F, 0x26, 0x3F, 0xB7, 0xDD, 0xFF, 0x81, 0xA7, 0xDA, 0x14, 0xC8, 0x78,
+    0x09, 0x9E, 0xE3, 0x8F, 0xFD, 0x99, 0x9F, 0xB5, 0x31, 0x18, 0x19, 0x27, 0xF4, 0xD8, 0x25, 0x0C,
+    0x2C, 0x65, 0x42, 0xF1, 0xA2, 0x7F, 0x93, 0x5B, 0x27, 0x5C, 0x5A, 0x24, 0x5B, 0xAF, 0x1D, 0x95,
+    0x71, 0x31, 0xF1, 0x77, 0xBD, 0x6F, 0xBC, 0x21, 0x52, 0x5A, 0xCE, 0x05, 0x89, 0xCE, 0x3A, 0xF3,
+    0x4F, 0xB5, 0x39, 0x0A, 0xA9, 0x39, 0x17, 0x11, 0xBA, 0xFA, 0x5E, 0x28, 0xB1, 0x8C, 0x24, 0x2F,
+    0x9C, 0xC5, 0x96, 0x44, 0xF7, 0x0D, 0xFD, 0xCA, 0x2F, 0x56, 0x5F, 0x1B, 0xD2, 0x93, 0xBF, 0xA5,
+    0x39, 0x40, 0x26, 0xD2, 0x2B, 0xC4, 0x88, 0x93, 0xBD, 0xEE, 0xAD, 0x33, 0x45, 0x33, 0x58, 0x69,
+    0x34, 0x1E, 0x7D, 0x6A, 0x60, 0x4E, 0x92, 0xB4, 0x78, 0xDA, 0x48, 0xC7, 0xD0, 0x9D, 0x5D, 0xA6,
+    0x7E, 0x20, 0x0A, 0xAA, 0xA1, 0xD2, 0x00, 0x36, 0x8C, 0x45, 0x8D, 0x9B, 0xC5, 0xBB, 0xBC, 0x20,
+    0x78, 0x28, 0xD8, 0x5F, 0xC0, 0xA0, 0xD3, 0x24, 0x77, 0x52, 0xB1, 0x2E, 0x7A, 0x82, 0x7F, 0xD2,
+    0x7A, 0x0B, 0xA6, 0xCD, 0xFD, 0xFB, 0x36, 0xB6, 0x10, 0x77, 0x02, 0xA9, 0xDE, 0x82, 0x04, 0xC5,
+    0x51, 0x29, 0x39, 0xFE, 0x84, 0x51, 0x7D, 0xA5, 0x46, 0xED, 0xAE, 0xB3, 0xF1, 0x31, 0x44, 0xF7,
+    0x06, 0x1B, 0x3D, 0x06, 0xB8, 0xA3, 0x06, 0xC0, 0xA0, 0x46, 0xD9, 0x07, 0x9D, 0x1A, 0x39, 0x52,
+    0x68, 0x35, 0xB2, 0x31, 0x6C, 0xD5, 0x40, 0x6A, 0xDD, 0xA8, 0x91, 0xF8, 0xB8, 0x56, 0x23, 0xF6,
+    0xC9, 0x56, 0x8D, 0xC8, 0xDF, 0x2C, 0xD4, 0x08, 0xFD, 0x47, 0x4E, 0x8D, 0x0D, 0x28, 0x52, 0x23,
+    0x00, 0x55, 0x6A, 0x38, 0xE8, 0xA7, 0x35, 0xE0, 0x3F, 0xAC, 0xC1, 0x12, 0x43, 0x07, 0x77, 0xAC,
+    0xD4, 0xBE, 0x67, 0xD4, 0x8C, 0xAC, 0x1C, 0x8F, 0x61, 0x6E, 0xD3, 0x26, 0x15, 0x83, 0x4D, 0x52,
+    0xB3, 0x61, 0xB9, 0xE8, 0xEC, 0xB5, 0xD8, 0x78, 0x45, 0x43, 0x25, 0x62, 0x04, 0xC8, 0x21, 0xDB,
+    0x72, 0x04, 0xC7, 0x58, 0xD2, 0x2F, 0xA8, 0x26, 0xFA, 0x04, 0xBC, 0x01, 0xF5, 0x90, 0x05, 0x11,
+    0xDC, 0x0F, 0x11, 0x96, 0x28, 0x22, 0x2C, 0x89, 0x44, 0x91, 0x62, 0x50, 0xD0, 0xDA, 0x11, 0xC1,
+    0xD9, 0x09, 0xE5, 0xA3, 0x50, 0xEA, 0x85, 0x62, 0xFF, 0x13, 0x22, 0x30, 0x46, 0x44, 0xB1, 0x02,
+    0x31, 0xA7, 0x24, 0xCA, 0x0D, 0xA1, 0x3B, 0x30, 0xC1, 0x90, 0x28, 0x52, 0x44, 0x54, 0x98, 0xAB,
+    0x36, 0x54, 0xEE, 0xE2, 0xD1, 0xA0, 0x92, 0x53, 0x4F, 0xBD, 0x9C, 0x76, 0xF5, 0xF0, 0x07, 0x72,
+    0x23, 0x35, 0x65, 0x10, 0x31, 0xF1, 0x83, 0xF7, 0xC4, 0x8D, 0x44, 0x25, 0x0F, 0x74, 0x26, 0xEB,
+    0xC2, 0x8D, 0xD2, 0xA2, 0xAC, 0x6A, 0xD8, 0x47, 0x54, 0x4C, 0xB8, 0x9F, 0xA7, 0xA1, 0xAA, 0xDF,
+    0x7F, 0xA1, 0x34, 0x64, 0x7D, 0x6E, 0x33, 0x45, 0x70, 0xEB, 0x78, 0x0C, 0x16, 0x71, 0x85, 0x6E,
+    0x0D, 0x53, 0x02, 0x39, 0x1C, 0x90, 0xD0, 0x4C, 0x61, 0x07, 0x55, 0xEA, 0x43, 0xB7, 0x04, 0x1E,
+    0xB4, 0xEC, 0xFF, 0xBA, 0x88, 0xE4, 0xCE, 0xD7, 0x48, 0xAE, 0x56, 0xC4, 0x66, 0xA1, 0x58, 0x77,
+    0x11, 0x8D, 0x7D, 0x0E, 0x0C, 0x96, 0xD8, 0xAE, 0x96, 0x6D, 0x62, 0xC6, 0xCE, 0xAB, 0xE9, 0x22,
+    0xB6, 0xFB, 0xC7, 0x2F, 0x67, 0x3A, 0xEB, 0xD2, 0xD8, 0x7D, 0xCE, 0xD2, 0xF8, 0x7C, 0x84, 0xDD,
+    0xBF, 0x58, 0x61, 0x77, 0xFB, 0xC2, 0x36, 0x2F, 0x67, 0x01, 0xBF, 0x95, 0x15, 0x2C, 0x03, 0xDF,
+    0x21, 0x8B, 0xE1, 0x17, 0xCE, 0x77, 0x4B, 0x74, 0xEE, 0x0F, 0xED, 0x19, 0xFB, 0xF7, 0xB8, 0x7F,
+    0x2C, 0x3C, 0xBC, 0xE6, 0xCF, 0xCF, 0x18, 0x53, 0xFA, 0x36, 0x5C, 0x96, 0x0F, 0xF9, 0x41, 0x20,
+    0x05, 0xD1, 0xB4, 0xC6, 0x27, 0xA0, 0x7E, 0xEF, 0xC9, 0x65, 0xD9, 0x89, 0x2C, 0x37, 0xF4, 0x93,
+    0x5B, 0x26, 0x8B, 0x01, 0xCE, 0xE2, 0x7E, 0x4B, 0xB9, 0xDF, 0x36, 0xD7, 0xBD, 0x36, 0x95, 0xFB,
+    0x6D, 0xCD, 0xFD, 0xB6, 0x91, 0xAD, 0x9A, 0xE1, 0x3A, 0xAC, 0xB9, 0xDF, 0x6A, 0xD4, 0xE4, 0x99,
+    0xFB, 0xDD, 0x26, 0xF2, 0x6D, 0xDB, 0xA0, 0xEA, 0xD6, 0xC4, 0x78, 0x10, 0x03, 0xDB, 0x70, 0x7E,
+    0x15, 0x1D, 0x31, 0xF3, 0xCF, 0x98, 0x73, 0x32, 0x87, 0x15, 0xA8, 0x91, 0x57, 0x7E, 0x63, 0xC9,
+    0xA1, 0x28, 0x1D, 0x95, 0xD0, 0x12, 0x66, 0xB4, 0xA1, 0x62, 0x8C, 0xCA, 0xFC, 0x9F, 0x02, 0x08,
+    0xD2, 0x18, 0x2B, 0xAF, 0xF1, 0x63, 0x40, 0xE1, 0x67, 0x05, 0x73, 0x62, 0x80, 0x11, 0xF9, 0x78,
+    0x4C, 0x90, 0x0C, 0x98, 0x8B, 0xAC, 0x03, 0xFD, 0x55, 0xC3, 0x28, 0x65, 0x89, 0xB6, 0xA9, 0xF3,
+    0xA5, 0xE5, 0x09, 0x42, 0xDE, 0x95, 0x0F, 0xAA, 0xF9, 0x14, 0x19, 0x8D, 0x6A, 0x92, 0xEE, 0xAE,
+    0xA1, 0x3B, 0x44, 0xD9, 0x8A, 0xFE, 0x92, 0xE8, 0xB2, 0xD3, 0x2C, 0xBB, 0xAF, 0x05, 0xE5, 0x96,
+    0xFC, 0xA9, 0x68, 0x43, 0xA6, 0xC7, 0x1D, 0x22, 0xC9, 0xB9, 0x64, 0x8B, 0xBB, 0x5D, 0x0A, 0x9E,
+    0x36, 0xDE, 0xEA, 0x75, 0x0A, 0xD2, 0x5D, 0x60, 0xD3, 0x4D, 0xEF, 0xC5, 0x0A, 0x20, 0xAB, 0x65,
+    0xF0, 0x75, 0xAD, 0x56, 0x75, 0x24, 0x87, 0x8A, 0xE8, 0x6A, 0xAD, 0xF5, 0xC9, 0xD6, 0xAC, 0xA5,
+    0x50, 0xA2, 0x92, 0x5B, 0x01, 0xEC, 0x96, 0xB4, 0x72, 0x7B, 0xD7, 0x94, 0x73, 0x94, 0x02, 0xFF,
+    0xC2, 0x12, 0xA1, 0xFF, 0xD4, 0x4C, 0xFA, 0xDF, 0x08, 0x95, 0x9F, 0x48, 0x65, 0xF3, 0xCF, 0xA4,
+    0xC0, 0x99, 0xE9, 0x71, 0x6A, 0x3A, 0xBE, 0x64, 0xAC, 0x4B, 0xC2, 0x1A, 0x19, 0x2B, 0xAA, 0xB8,
+    0xA8, 0xEA, 0x75, 0x9B, 0xE9, 0x98, 0x54, 0x21, 0x60, 0x74, 0xE9, 0x35, 0xD3, 0xAC, 0xCA, 0x94,
+    0xBD, 0xE2, 0x2F, 0xD6, 0x5B, 0xB2, 0x7A, 0x09, 0xC5, 0xB8, 0x1C, 0x88, 0x21, 0x66, 0xA7, 0x24,
+    0x15, 0x4C, 0x25, 0x18, 0x2D, 0xB7, 0x5A, 0x5F, 0xBA, 0x34, 0xA1, 0xE4, 0x19, 0x1E, 0xBA, 0x65,
+    0x69, 0x18, 0xE4, 0xE3, 0xEE, 0x5A, 0x2E, 0x76, 0x1D, 0xDC, 0x8F, 0x96, 0x90, 0xBD, 0x99, 0x0F,
+    0x6A, 0x22, 0xDC, 0x19, 0xF3, 0x91, 0x5E, 0x9E, 0x94, 0x8E, 0xE9, 0xB4, 0xE9, 0x44, 0x2D, 0x16,
+    0x91, 0x39, 0x54, 0xAA, 0xEF, 0xDF, 0xEA, 0x12, 0x4F, 0x99, 0x81, 0x88, 0xF7, 0xB0, 0x5C, 0x7F,
+    0x57, 0x19, 0xB6, 0xFF, 0x57, 0x68, 0xFC, 0x0F, 0x6B, 0xD9, 0xEB, 0xAF, 0xE0, 0x1C, 0xDF, 0x17,
+    0xCF, 0xFE, 0x23, 0x38, 0xBD, 0x0F, 0x64, 0xCD, 0x5E, 0x99, 0x51, 0x61, 0x59, 0x27, 0x0B, 0xC1,
+    0xBB, 0x39, 0xB4, 0x79, 0x44, 0x38, 0x6F, 0xBF, 0x25, 0x41, 0xB4, 0x24, 0x51, 0x05, 0x84, 0xC4,
+    0xA6, 0x3D, 0x59, 0x9B, 0x19, 0x17, 0x4C, 0xD5, 0xB2, 0xDA, 0xCC, 0x77, 0x07, 0x88, 0xAE, 0x23,
+    0x84, 0x61, 0x74, 0xAA, 0x93, 0xBA, 0x60, 0x6C, 0x05, 0x9B, 0x64, 0x51, 0x02, 0xBE, 0x3A, 0x51,
+    0x99, 0xB4, 0xCD, 0x35, 0x5B, 0xDD, 0x2D, 0x11, 0x30, 0x5A, 0x36, 0x6A, 0x0E, 0x34, 0xB5, 0xE2,
+    0x43, 0x62, 0xD3, 0x14, 0xDA, 0x7F, 0x4B, 0x05, 0x22, 0x91, 0x1D, 0xB9, 0xBC, 0x14, 0x35, 0x77,
+    0x33, 0xAD, 0x10, 0x03, 0x2D, 0x1D, 0xF9, 0x85, 0x1E, 0x4D, 0x6A, 0x16, 0x93, 0x91, 0x23, 0x3B,
+    0xD9, 0x21, 0xD8, 0x59, 0xE8, 0xF0, 0x9A, 0xE3, 0x12, 0xBE, 0xD2, 0x43, 0x4A, 0x7E, 0x5C, 0x90,
+    0x57, 0x02, 0xD0, 0x59, 0xDC, 0x0C, 0x15, 0x7D, 0x48, 0x37, 0x4C, 0x67, 0xB1, 0x99, 0x54, 0x96,
+    0xDE, 0x8C, 0xA6, 0x9B, 0xBD, 0xE6, 0x8D, 0x22, 0xC7, 0x44, 0xC5, 0x54, 0xCA, 0xD9, 0x94, 0xD2,
+    0xC3, 0xE6, 0xE4, 0x23, 0xAF, 0x9B, 0x1A, 0xDE, 0xB1, 0x35, 0xC2, 0xD4, 0xF0, 0x7F, 0x4C, 0xFF,
+    0x3E, 0x33, 0xFD, 0x5B, 0x15, 0x6F, 0xBB, 0xA7, 0x78, 0x5F, 0x1E, 0x99, 0xDE, 0x26, 0xB6, 0x2C,
+    0x1A, 0x62, 0x6A, 0xEE, 0x1B, 0xAE, 0x94, 0x10, 0xFD, 0xA7, 0xA7, 0x67, 0x68, 0xC3, 0x99, 0xC0,
+    0xE5, 0x43, 0xFD, 0x44, 0x17, 0x4C, 0x33, 0xA3, 0xDF, 0x01, 0x0C, 0x24, 0x41, 0xAB, 0xE8, 0xC4,
+    0xEA, 0xCA, 0x2C, 0xC0, 0xE6, 0xB8, 0x1A, 0x77, 0x3E, 0x3D, 0xF4, 0xDD, 0x5A, 0xA6, 0x76, 0x92,
+    0xAC, 0x93, 0x98, 0x9D, 0xC9, 0x9C, 0x6E, 0xFB, 0xB6, 0x04, 0xD3, 0x87, 0x4A, 0x66, 0x39, 0x4F,
+    0x61, 0x4F, 0x9F, 0x1B, 0xF5, 0x48, 0x01, 0x8F, 0x8E, 0x3B, 0xF9, 0xAA, 0x05, 0xBA, 0x4B, 0xA7,
+    0x85, 0x54, 0x6C, 0x62, 0xC7, 0x1F, 0x29, 0x8E, 0xE2, 0x3A, 0x18, 0x4F, 0x2C, 0x01, 0x21, 0x5E,
+    0xE1, 0x60, 0x3F, 0xB5, 0x32, 0xD0, 0x1E, 0xBC, 0xCA, 0x57, 0x37, 0xEA, 0x20, 0xF1, 0x27, 0x80,
+    0x50, 0x3F, 0xAF, 0x04, 0x12, 0x10, 0xCE, 0x61, 0x07, 0xF3, 0x21, 0xD0, 0x75, 0x12, 0x9D, 0xCD,
+    0x37, 0x31, 0x45, 0x89, 0x1F, 0xE1, 0xD5, 0x37, 0xD4, 0xC7, 0xC2, 0x5D, 0x61, 0x87, 0x2F, 0x9F,
+    0x6E, 0xA5, 0xDA, 0x8D, 0x58, 0x69, 0x76, 0xF5, 0xAD, 0xA7, 0x24, 0xBF, 0x57, 0x0B, 0xC0, 0x7F,
+    0x53, 0x3A, 0xFB, 0x01, 0x63, 0x2E, 0x3F, 0x7F, 0x97, 0xF1, 0xC2, 0xA0, 0xE5, 0xA8, 0x53, 0x1C,
+    0x81, 0x98, 0x51, 0x81, 0x72, 0xD9, 0xAF, 0xB0, 0x11, 0x35, 0xFB, 0xB0, 0x55, 0x2D, 0x68, 0xFF,
+    0x19, 0x7B, 0xAB, 0x57, 0x0F, 0xE3, 0x86, 0xD9, 0xC9, 0xD9, 0x8F, 0xB1, 0x60, 0xFB, 0xBF, 0x90,
+    0x8B, 0xDC, 0x98, 0x7A, 0x93, 0xEA, 0xE0, 0x54, 0x35, 0x71, 0x8B, 0x4C, 0x90, 0x96, 0x06, 0xB0,
+    0x9C, 0xD9, 0xC1, 0xD0, 0x10, 0xC6, 0xD6, 0x70, 0xBC, 0x55, 0x01, 0x0F, 0x71, 0x83, 0x1B, 0x53,
+    0xEE, 0x29, 0x60, 0x5C, 0xBD, 0x34, 0xFC, 0x48, 0x50, 0x63, 0x59, 0x8F, 0x10, 0xF8, 0x9C, 0x63,
+    0xC5, 0xF1, 0xB6, 0x40, 0xED, 0xAA, 0xAF, 0x9B, 0xD3, 0x77, 0x34, 0xE9, 0x54, 0x86, 0x8D, 0xF6,
+    0x29, 0x94, 0x69, 0xC9, 0xE9, 0x3E, 0x01, 0x1E, 0xFC, 0x3D, 0x61, 0xE5, 0x13, 0x96, 0xDF, 0xFD,
+    0x07, 0x0C, 0x2B, 0x7E, 0x84, 0x77, 0xF1, 0x2F, 0x6B, 0xF0, 0x23, 0x95, 0x8A, 0x49, 0xF9, 0x4C,
+    0x32, 0xD2, 0x3D, 0xC8, 0x07, 0xF6, 0x60, 0xBE, 0xC2, 0x8B, 0x67, 0xF4, 0x96, 0xF5, 0x90, 0xB0,
+    0x74, 0x87, 0x9E, 0x7F, 0xF9, 0x19, 0xE7, 0xD3, 0xBF, 0x07, 0x6A, 0xCB, 0x39, 0xA4, 0x02, 0x2A,
+    0xE4, 0x08, 0x5E, 0x97, 0x84, 0x6C, 0xA5, 0x2E, 0x54, 0xC2, 0x66, 0x65, 0x99, 0xB5, 0x5C, 0x2C,
+    0xD7, 0xA3, 0xD5, 0x84, 0x0D, 0x8C, 0xAC, 0xB3, 0x2F, 0xE0, 0xE1, 0xD1, 0xD1, 0x8D, 0x27, 0x49,
+    0x88, 0x0C, 0x75, 0x30, 0x63, 0x96, 0x64, 0x1E, 0x1E, 0xB7, 0x96, 0x82, 0xA5, 0xD4, 0x5B, 0x77,
+    0x85, 0x2A, 0x7C, 0xFC, 0x50, 0xC9, 0x4E, 0x83, 0xEC, 0x53, 0x55, 0x67, 0x04, 0x04, 0x65, 0xC7,
+    0x22, 0x59, 0x77, 0x69, 0xD9, 0xC4, 0xF1, 0x2B, 0xC8, 0xB9, 0xF8, 0x09, 0x5C, 0xF1, 0x1F, 0xDF,
+    0xD8, 0xBB, 0xF1, 0x55, 0x80, 0x74, 0xA3, 0x64, 0xE4, 0x5B, 0xAE, 0x7B, 0x64, 0xAF, 0x43, 0x08,
+    0xEF, 0xBC, 0xAA, 0x32, 0xBA, 0xE7, 0xC6, 0xE4, 0x47, 0xFE, 0xE6, 0x36, 0x9A, 0x03, 0xFF, 0x3D,
+    0xFA, 0x65, 0x50, 0x0F, 0x58, 0x35, 0x74, 0xD9, 0x55, 0xBB, 0x40, 0xBB, 0x62, 0x77, 0x69, 0x82,
+    0x5C, 0xB9, 0xFE, 0xC1, 0xCB, 0x40, 0x2D, 0x96, 0x41, 0xFA, 0x1C, 0x48, 0x07, 0x43, 0x0D, 0xA1,
+    0x5D, 0x07, 0x55, 0x24, 0x0B, 0x6D, 0xEE, 0x74, 0x52, 0xC7, 0x91, 0xE1, 0xAD, 0xE7, 0xB6, 0xE9,
+    0x29, 0x54, 0xA5, 0xC4, 0xD2, 0x37, 0x73, 0x1B, 0x02, 0x6B, 0x21, 0x03, 0xA0, 0x49, 0xD0, 0x86,
+    0x46, 0x3A, 0x33, 0x7F, 0x5F, 0x0B, 0xA2, 0xD6, 0x9A, 0xBF, 0x9A, 0x4F, 0x56, 0x73, 0x5C, 0xEC,
+    0x71, 0x31, 0xC8, 0xB5, 0xE2, 0x1C, 0x3C, 0x1D, 0x5D, 0x3D, 0x74, 0x8B, 0x5D, 0x9A, 0x61, 0x2A,
+    0x14, 0x3C, 0x53, 0x9C, 0x37, 0x58, 0x9C, 0xD7, 0x59, 0xD1, 0x46, 0xC5, 0x35, 0x0B, 0xF4, 0x2F,
+    0x50, 0xF3, 0x8C, 0xA8, 0xB5, 0xA2, 0x8B, 0xAC, 0x17, 0xB3, 0xFA, 0x1D, 0x99, 0xAA, 0x90, 0xBB,
+    0x55, 0xB8, 0xA5, 0x56, 0x69, 0x71, 0x31, 0x9D, 0xE6, 0x1F, 0x3D, 0x5A, 0xFE, 0x27, 0x9F, 0xA5,
+    0x55, 0x30, 0x5D, 0xF0, 0x4C, 0x3F, 0xAB, 0xB6, 0x60, 0xC8, 0x2D, 0x7F, 0x2E, 0x3D, 0x51, 0xE6,
+    0x3A, 0xF0, 0x8B, 0x58, 0x74, 0x6F, 0xC3, 0x01, 0xB1, 0x09, 0xC3, 0x13, 0xAF, 0xD4, 0xF6, 0x99,
+    0xBF, 0x15, 0xFD, 0x1B, 0xE4, 0x77, 0x13, 0xB1, 0xF1, 0xC4, 0x82, 0xCA, 0x33, 0xF8, 0x4F, 0xB7,
+    0xD4, 0x41, 0x06, 0xC1, 0x5E, 0xF9, 0x16, 0xCB, 0xC0, 0xE1, 0xA0, 0xC2, 0x48, 0xAB, 0xBB, 0xAA,
+    0x8E, 0x54, 0x9A, 0xD1, 0x69, 0xAD, 0xB0, 0x04, 0x50, 0xE2, 0x62, 0x29, 0xB3, 0x04, 0xFE, 0x53,
+    0x0B, 0xDA, 0xAD, 0x74, 0x59, 0xAA, 0xAC, 0x9C, 0xF9, 0xA5, 0xB4, 0xA2, 0xD0, 0x9E, 0xD5, 0x9D,
+    0x8D, 0xEF, 0x4B, 0x55, 0xBC, 0x08, 0x63, 0x4F, 0x6A, 0x49, 0x6B, 0xA6, 0x79, 0x79, 0x56, 0x99,
+    0xFF, 0x3F, 0xE7, 0x04, 0x2B, 0xD6, 0x89, 0xC3, 0xA2, 0x01, 0xFD, 0x78, 0xD7, 0x4F, 0x21, 0x15,
+    0x34, 0xF7, 0xF7, 0xBC, 0xDC, 0x3A, 0xD7, 0xB1, 0xB3, 0x9D, 0x9A, 0x86, 0x3B, 0x4D, 0xDD, 0x50,
+    0x59, 0xD5, 0x42, 0x77, 0x3B, 0x7D, 0xDD, 0xD3, 0xD5, 0x17, 0xD3, 0x5A, 0xC7, 0x30, 0x85, 0xBE,
+    0xD0, 0xE9, 0x60, 0xA7, 0xD6, 0x2A, 0x65, 0x80, 0xA3, 0x43, 0x63, 0x67, 0xE5, 0x45, 0x45, 0x1F,
+    0xE3, 0x62, 0x0C, 0x57, 0x16, 0x16, 0xFA, 0xBF, 0x16, 0x63, 0x0B, 0x5E, 0x3F, 0x94, 0x06, 0xCE,
+    0x6B, 0x1D, 0x8E, 0x47, 0x02, 0x3A, 0xA5, 0x05, 0x23, 0xFD, 0x9B, 0x1D, 0x1F, 0x49, 0xE6, 0xA5,
+    0x10, 0x0C, 0xFF, 0x1E, 0x7F, 0x21, 0xD4, 0x93, 0xF6, 0x16, 0x5E, 0xD7, 0x36, 0x20, 0x6F, 0x69,
+    0x17, 0x4E, 0x69, 0x5C, 0xCD, 0x6C, 0x70, 0x5A, 0x57, 0x65, 0x5B, 0x0C, 0x72, 0xFF, 0x2A, 0x37,
+    0xEC, 0xFC, 0xDF, 0x69, 0xEB, 0xD4, 0xBF, 0xE6, 0xB7, 0x70, 0xCE, 0xCB, 0xA6, 0x83, 0x31, 0xA0,
+    0x39, 0xD5, 0x52, 0xDF, 0x2C, 0xA1, 0xC1, 0xD3, 0x60, 0xBB, 0x84, 0x12, 0x36, 0x1D, 0xEC, 0xC1,
+    0x7A, 0x9B, 0xB5, 0x05, 0xF4, 0x81, 0xF2, 0xC1, 0x77, 0x95, 0x2F, 0x37, 0x57, 0x8A, 0x2F, 0xA8,
+    0xD6, 0x5F, 0xF3, 0x0F, 0x8B, 0x95, 0xF0, 0xD7, 0x4F, 0x15, 0x7C, 0xD9, 0x46, 0x78, 0xE5, 0x43,
+    0xCE, 0x9B, 0xBF, 0xCF, 0x1D, 0x52, 0x2E, 0xA9, 0xCF, 0x6D, 0xB1, 0x9E, 0xD6, 0xC5, 0x9A, 0x61,
+    0xC0, 0x2F, 0x31, 0x3D, 0x50, 0xF8, 0xF7, 0xB9, 0x5B, 0x35, 0x73, 0x4D, 0x0D, 0x0E, 0x93, 0xA7,
+    0x04, 0x12, 0xCB, 0xCE, 0xDE, 0xA5, 0xCA, 0xFF, 0xFB, 0x9A, 0x34, 0x5E, 0x3E, 0x3D, 0xBD, 0x4D,
+    0xF5, 0x2B, 0x72, 0xFF, 0x16, 0xA3, 0xB8, 0x7B, 0x24, 0xFB, 0x7D, 0xE4, 0xCE, 0x7E, 0x4A, 0x01,
+    0x86, 0x84, 0x21, 0x5F, 0x2C, 0x61, 0x5B, 0x31, 0x66, 0x01, 0xCD, 0x17, 0x83, 0x76, 0xD9, 0xCD,
+    0xC8, 0xBD, 0x9C, 0x32, 0x2F, 0x1E, 0xDC, 0x26, 0xB9, 0x4D, 0x32, 0x57, 0x7D, 0xDE, 0xC6, 0x63,
+    0x5E, 0x87, 0x63, 0x59, 0x6F, 0xFA, 0xB2, 0x0D, 0x8A, 0x52, 0x69, 0x43, 0xCB, 0xFC, 0x86, 0xA7,
+    0x18, 0x60, 0xA3, 0x98, 0x03, 0x45, 0x04, 0xD5, 0xFC, 0x4D, 0xB0, 0x7A, 0x0B, 0x93, 0x5F, 0xB9,
+    0xCD, 0x5C, 0x15, 0xE1, 0x54, 0x36, 0xF1, 0x80, 0x5E, 0x99, 0x52, 0x20, 0xEA, 0x84, 0xC0, 0x99,
+    0x22, 0xB0, 0x9A, 0x9C, 0x35, 0xDA, 0xAC, 0xD7, 0x06, 0x95, 0x6D, 0xF8, 0x77, 0xDF, 0xF2, 0xE7,
+    0x87, 0xCF, 0xE2, 0x75, 0x14, 0x06, 0xF8, 0xF9, 0x9F, 0x41, 0x79, 0xAF, 0xE2, 0xAA, 0xBB, 0xB1,
+    0x7A, 0xFE, 0x9C, 0x6E, 0xB6, 0x59, 0x51, 0xA8, 0xAD, 0x4B, 0x67, 0x55, 0xB1, 0xAF, 0x60, 0x8B,
+    0x2B, 0x5A, 0x9C, 0x53, 0x68, 0x34, 0x18, 0xEA, 0x13, 0x3B, 0x21, 0x34, 0x5B, 0xC0, 0x33, 0xD0,
+    0x40, 0x63, 0x26, 0x57, 0x6E, 0x8F, 0x2C, 0x86, 0x66, 0x73, 0xEC, 0x07, 0x3C, 0x16, 0x51, 0xED,
+    0x6A, 0x57, 0xF2, 0x5C, 0x0B, 0xB2, 0x60, 0x7A, 0x8E, 0xEB, 0xE2, 0xEA, 0x8E, 0xF8, 0x1A, 0x15,
+    0x43, 0x31, 0xC2, 0xE9, 0x37, 0xCA, 0xB1, 0x98, 0x69, 0x65, 0x63, 0xC8, 0x8C, 0x6E, 0x96, 0x2C,
+    0x3D, 0xB3, 0xAD, 0xC8, 0x27, 0x3A, 0x89, 0x72, 0x26, 0x7D, 0xB7, 0x92, 0x95, 0xA5, 0x25, 0x7B,
+    0x7B, 0xA1, 0x65, 0xBF, 0xB7, 0xFC, 0x42, 0xE0, 0x18, 0xA8, 0xF4, 0x35, 0x1B, 0x25, 0x1B, 0x4C,
+    0x81, 0x54, 0x2A, 0xE5, 0x6E, 0x37, 0xE2, 0x3D, 0x16, 0x1F, 0xC0, 0x69, 0xCD, 0x11, 0xC5, 0x24,
+    0x93, 0xE9, 0x0A, 0x6C, 0xB6, 0x51, 0xC3, 0x23, 0x3C, 0x31, 0xB4, 0xAD, 0xE6, 0xC1, 0x90, 0xA4,
+    0xEA, 0x49, 0x43, 0x36, 0xA4, 0xD9, 0x40, 0x32, 0xD2, 0x31, 0x4B, 0xC6, 0x4C, 0x99, 0xF0, 0x2B,
+    0xC9, 0x74, 0x5D, 0x67, 0x8F, 0xDE, 0x88, 0xE7, 0x57, 0x18, 0x48, 0xCF, 0x77, 0x42, 0xFF, 0x86,
+    0x92, 0x29, 0xA4, 0x49, 0x77, 0x2C, 0xAB, 0xDA, 0x2C, 0xE5, 0xFC, 0xCE, 0x82, 0x3A, 0x2B, 0x48,
+    0x3A, 0x3B, 0x91, 0x51, 0x29, 0xC4, 0x41, 0x10, 0x95, 0xD7, 0x7B, 0x94, 0xDF, 0x53, 0xD0, 0xFA,
+    0x43, 0x66, 0x0A, 0x23, 0xA3, 0x2A, 0x2C, 0x81, 0xAC, 0x37, 0x4C, 0x0C, 0xD1, 0x90, 0xF4, 0x77,
+    0xEC, 0xF6, 0x7D, 0xDB, 0x8F, 0xD0, 0xEB, 0xD3, 0x45, 0x39, 0x26, 0xF7, 0x26, 0x7E, 0x1E, 0x7F,
+    0xFA, 0x6F, 0x29, 0xBE, 0x8A, 0x84, 0xE9, 0x56, 0x1B, 0x27, 0xCA, 0x29, 0x69, 0xAE, 0x75, 0xC4,
+    0xB3, 0x6E, 0x9D, 0x65, 0xC0, 0x06, 0xD7, 0x89, 0x1B, 0x53, 0x56, 0xC0, 0x87, 0x54, 0x95, 0xB4,
+    0xC0, 0xAB, 0xA8, 0x31, 0x6A, 0x63, 0x8F, 0xC5, 0x9B, 0x5A, 0xE5, 0xE8, 0x46, 0x42, 0xEB, 0x54,
+    0xB2, 0xE9, 0x28, 0xAE, 0x7C, 0x50, 0xC1, 0x66, 0xA4, 0xA0, 0xD2, 0x31, 0x95, 0x95, 0xE7, 0xCA,
+    0x2C, 0x5E, 0x91, 0x10, 0xEE, 0xB8, 0x25, 0x92, 0xDD, 0x6D, 0x4D, 0x5B, 0x86, 0x6C, 0x09, 0x72,
+    0xBD, 0x07, 0xAD, 0x34, 0xA1, 0xC0, 0x4F, 0x7E, 0x22, 0xB2, 0xBD, 0x6A, 0xBE, 0xF4, 0x67, 0xF2,
+    0x74, 0x76, 0xEA, 0xE9, 0xE5, 0x8B, 0x53, 0x0E, 0xCC, 0x89, 0x7B, 0x82, 0x2E, 0xF9, 0x18, 0x41,
+    0x67, 0x82, 0x99, 0xAE, 0x93, 0x02, 0x0E, 0x3D, 0xB5, 0x5C, 0x46, 0xB1, 0x7E, 0xD5, 0x2D, 0xDE,
+    0x20, 0xDC, 0x9D, 0xA2, 0x50, 0x69, 0x43, 0xD9, 0x00, 0x88, 0xF9, 0x6B, 0x2A, 0xFB, 0xCF, 0x58,
+    0x6C, 0x1C, 0x70, 0x73, 0x33, 0x64, 0xF3, 0xE9, 0xD9, 0xC0, 0xF8, 0xDA, 0x00, 0x1E, 0x3A, 0x3D,
+    0xD9, 0x15, 0x43, 0x75, 0xE0, 0xCC, 0x25, 0x56, 0x93, 0x68, 0x76, 0x04, 0xBB, 0x97, 0xF6, 0x0A,
+    0xC1, 0xBF, 0xFB, 0x45, 0xEB, 0xCA, 0x11, 0x3E, 0x4C, 0x7E, 0xBC, 0x80, 0xFE, 0x15, 0xE0, 0xE7,
+    0x86, 0xAE, 0xF1, 0x33, 0x5C, 0xB4, 0x76, 0x77, 0x0F, 0x1F, 0x3F, 0xD8, 0x18, 0x76, 0x59, 0x7D,
+    0xCB, 0xFD, 0xA1, 0x73, 0xDF, 0x76, 0x2F, 0x05, 0xE3, 0x66, 0x88, 0x3F, 0x4C, 0xDA, 0xAC, 0xC8,
+    0x60, 0x62, 0x6F, 0xBA, 0x7F, 0x71, 0x77, 0xA1, 0xA4, 0xF8, 0xEB, 0xA0, 0x38, 0x1D, 0x94, 0x0A,
+    0x7F, 0x79, 0x97, 0xB7, 0x97, 0xB7, 0x97, 0x8B, 0x83, 0x93, 0x98, 0x3D, 0xF5, 0x3C, 0x96, 0x98,
+    0x4D, 0xF9, 0x98, 0xC2, 0x97, 0x47, 0x13, 0xE6, 0x74, 0x0C, 0xD0, 0x6B, 0xD0, 0x23, 0xEB, 0x42,
+    0xCF, 0xEC, 0x9B, 0xBD, 0x1F, 0xBA, 0xCB, 0x0A, 0xA7, 0x5E, 0xE6, 0x71, 0x2C, 0x9D, 0xBA, 0x54,
+    0xB6, 0x8F, 0x15, 0xAE, 0x1C, 0x0D, 0xE7, 0x83, 0x15, 0xF3, 0x99, 0x85, 0x21, 0x07, 0xDB, 0x06,
+    0xDA, 0x59, 0xFE, 0x06, 0x97, 0x92, 0x1B, 0xEE, 0x00, 0x69, 0xC6, 0x46, 0x27, 0xD7, 0x54, 0xB3,
+    0xFB, 0xB9, 0xFF, 0xC9, 0xC4, 0xC3, 0x5A, 0xF7, 0x7D, 0xCC, 0x93, 0x4C, 0xD9, 0xBD, 0x39, 0x42,
+    0x26, 0xD9, 0x5D, 0x4D, 0xA6, 0x40, 0xFA, 0xC0, 0xED, 0x44, 0xD5, 0xE7, 0x46, 0xC3, 0xB2, 0x10,
+    0x93, 0x44, 0xB1, 0x62, 0x24, 0x72, 0x47, 0x67, 0xF3, 0xD1, 0x23, 0xCF, 0xBD, 0x68, 0x4C, 0x3A,
+    0x68, 0x2B, 0x3C, 0xD8, 0x07, 0xE5, 0xFB, 0xF5, 0x52, 0x07, 0xFE, 0xB5, 0xD5, 0xEA, 0x0F, 0xB8,
+    0x15, 0xB2, 0x96, 0xC2, 0x23, 0xFF, 0x03, 0x9A, 0x13, 0xDE, 0xA4, 0x8A, 0xE6, 0x8A, 0xE3, 0x75,
+    0xC8, 0x55, 0xAE, 0xCC, 0xFD, 0xE9, 0x7A, 0xCE, 0x70, 0xB5, 0x37, 0xB1, 0x35, 0xAE, 0x88, 0xCC,
+    0x1D, 0x8F, 0xBB, 0xB1, 0x5F, 0x10, 0xCA, 0xA6, 0x95, 0x1B, 0x63, 0xA2, 0x5F, 0x10, 0x59, 0x79,
+    0xF0, 0x53, 0xB7, 0x64, 0x96, 0x62, 0x65, 0x34, 0x56, 0x46, 0xB1, 0xA2, 0x5D, 0x5E, 0x3B, 0x3C,
+    0x50, 0x75, 0xCA, 0xD5, 0xAB, 0xFD, 0xAE, 0x73, 0xFA, 0xA8, 0x1D, 0x62, 0xC2, 0x9D, 0x7E, 0xBD,
+    0xAC, 0xBC, 0x67, 0xAC, 0xBC, 0x27, 0x56, 0xA0, 0x7D, 0xC1, 0xD9, 0xA7, 0x3A, 0x8D, 0xA7, 0xA3,
+    0x9B, 0x76, 0xEC, 0xA0, 0xF6, 0xE7, 0xAC, 0xA9, 0x48, 0x07, 0x55, 0x4D, 0x93, 0x16, 0x2A, 0x00,
+    0x92, 0x1E, 0xAA, 0x8E, 0x6A, 0x5C, 0x1D, 0x14, 0x17, 0x3A, 0xB0, 0xD3, 0x82, 0x9D, 0x3E, 0x22,
+    0xD7, 0xB8, 0x68, 0x69, 0xDA, 0xE6, 0xA3, 0xD7, 0x58, 0xC9, 0xD5, 0x1B, 0xE1, 0xEF, 0xB6, 0x95,
+    0xF1, 0x9C, 0xEA, 0x76, 0x11, 0x0C, 0xC2, 0x03, 0x9B, 0xDF, 0x09, 0xEA, 0x7A, 0xD1, 0x42, 0x5C,
+    0x77, 0xDB, 0x05, 0xD5, 0x03, 0x04, 0xA6, 0x90, 0xD0, 0x36, 0xD3, 0x29, 0x40, 0x04, 0x5F, 0x3F,
+    0xE7, 0x6E, 0xDE, 0x96, 0x27, 0x0E, 0xEF, 0x7B, 0x55, 0x48, 0xF3, 0x2E, 0xB9, 0x37, 0x6B, 0xEB,
+    0xA9, 0xEA, 0xBE, 0x99, 0xA8, 0xE7, 0xC5, 0x56, 0x9F, 0x34, 0x6E, 0xB8, 0x93, 0xCB, 0x23, 0xAD,
+    0x45, 0x42, 0xE1, 0xEF, 0xA3, 0x84, 0x9C, 0x49, 0xE8, 0x9E, 0xF6, 0xD5, 0x67, 0x6B, 0xF5, 0x68,
+    0xFD, 0x2F, 0xC5, 0x56, 0xBD, 0x6E, 0xDC, 0x46, 0x10, 0x1E, 0x92, 0xB0, 0x58, 0xB0, 0x60, 0x65,
+    0x17, 0xF9, 0x01, 0x53, 0xA4, 0x4A, 0x11, 0x3E, 0x81, 0xB5, 0xEC, 0x52, 0xA4, 0x51, 0x23, 0x04,
+    0x48, 0x5A, 0x55, 0xD7, 0xA8, 0x49, 0x79, 0xD2, 0x32, 0x48, 0x91, 0x56, 0x45, 0x1E, 0xC0, 0xC5,
+    0x15, 0xC6, 0xA5, 0xD0, 0x0B, 0xC8, 0xC7, 0x4D, 0xFC, 0x00, 0x61, 0x0C, 0x03, 0x69, 0xD9, 0xA4,
+    0x71, 0xE3, 0x45, 0xCC, 0x20, 0xB4, 0xB2, 0xC7, 0xC9, 0x37, 0xB3, 0x27, 0x41, 0x01, 0x22, 0x39,
+    0x09, 0x0C, 0x84, 0x77, 0x9C, 0xE1, 0x2D, 0x67, 0x76, 0x7E, 0xBF, 0xD9, 0xB3, 0xDE, 0x8C, 0x16,
+    0xB7, 0xF1, 0xF2, 0xA9, 0xBD, 0x19, 0x6A, 0x5F, 0xF7, 0xD5, 0x50, 0xF5, 0xE5, 0x50, 0xB9, 0xB2,
+    0x2F, 0x5D, 0xFC, 0xEC, 0x35, 0x7B, 0x0D, 0xA5, 0x43, 0xD1, 0x52, 0x36, 0x94, 0x42, 0xAA, 0x86,
+    0xF2, 0xBE, 0x22, 0xCA, 0x5D, 0x4D, 0x54, 0x38, 0x43, 0x54, 0xBA, 0x7D, 0x7A, 0xE7, 0xFC, 0xC5,
+    0xE6, 0x71, 0xCD, 0xCC, 0x41, 0x09, 0xD5, 0x14, 0x88, 0x0C, 0x4D, 0x44, 0xFB, 0x34, 0x82, 0x24,
+    0x20, 0x27, 0xA9, 0x27, 0xBA, 0x10, 0x12, 0x32, 0x4F, 0x10, 0x63, 0xAF, 0x64, 0x71, 0x79, 0xFE,
+    0xE2, 0x2C, 0xF5, 0x85, 0xA3, 0xD4, 0x97, 0x8E, 0x32, 0x7F, 0x8B, 0x1D, 0xA2, 0x0F, 0x85, 0x2C,
+    0xAF, 0x48, 0xB2, 0x39, 0x83, 0x0D, 0x9E, 0x29, 0xE1, 0x0D, 0xB7, 0x79, 0x58, 0x76, 0xAE, 0x1C,
+    0x97, 0xC6, 0x95, 0x5E, 0xC8, 0xB8, 0xFC, 0x98, 0xCA, 0x00, 0xB9, 0x92, 0x2F, 0xB0, 0x01, 0x7C,
+    0xA2, 0x8C, 0xB9, 0x21, 0x18, 0x86, 0x2F, 0x35, 0xD4, 0x28, 0x65, 0x76, 0x44, 0x96, 0x07, 0xA2,
+    0x53, 0xF6, 0x79, 0xB3, 0x44, 0x22, 0xDA, 0x25, 0x72, 0xE1, 0x96, 0xD5, 0x8E, 0x0C, 0x4B, 0x24,
+    0x65, 0x5C, 0x5A, 0x97, 0xB3, 0x68, 0x74, 0xA2, 0x9B, 0x3C, 0xF9, 0x8B, 0x1B, 0x37, 0x48, 0xBC,
+    0x12, 0x11, 0x7A, 0x28, 0x36, 0xA1, 0x01, 0xDB, 0xD5, 0xD0, 0x35, 0x92, 0x09, 0xE3, 0x8C, 0x93,
+    0xE8, 0xAD, 0x33, 0x7D, 0x26, 0xBC, 0xAD, 0x87, 0xA2, 0xC7, 0xA6, 0xE0, 0x88, 0x5B, 0xB8, 0xAF,
+    0x9B, 0xC8, 0x25, 0x5C, 0x59, 0x7F, 0xB2, 0xE3, 0x81, 0x0E, 0xA0, 0x57, 0x3F, 0x1B, 0x6B, 0x6E,
+    0xB0, 0xCF, 0x53, 0xCF, 0xE7, 0x43, 0xDD, 0xDB, 0x6F, 0x9E, 0x6D, 0x8B, 0xB1, 0xFC, 0x8D, 0xCB,
+    0xA7, 0x21, 0x0B, 0x29, 0x4F, 0xD5, 0x27, 0x53, 0x16, 0xE8, 0x7E, 0x63, 0x8A, 0x29, 0xDD, 0x42,
+    0xF5, 0xB4, 0x18, 0x53, 0x38, 0x41, 0xA1, 0x54, 0x9E, 0x4C, 0x91, 0x67, 0x3E, 0xAE, 0xE7, 0x43,
+    0x94, 0x2B, 0x5D, 0x3E, 0x65, 0xE0, 0x55, 0x9B, 0x61, 0x1F, 0x29, 0x5C, 0xBA, 0xCD, 0x11, 0xC4,
+    0x29, 0xB2, 0x75, 0x8E, 0xEC, 0x04, 0x49, 0x58, 0x13, 0x83, 0x3B, 0xB8, 0x11, 0x68, 0x37, 0x2B,
+    0x2F, 0x99, 0x7B, 0xE1, 0x66, 0xAA, 0x46, 0xE1, 0x16, 0xDB, 0x0A, 0xEF, 0xFA, 0x3C, 0xFC, 0x1D,
+    0xB7, 0x3E, 0xBE, 0x87, 0xBC, 0x17, 0x5E, 0x6F, 0xAD, 0x8B, 0xFB, 0xC4, 0xFD, 0x72, 0xF6, 0x09,
+    0xC3, 0x9D, 0x77, 0x85, 0x6B, 0xD6, 0x11, 0x1B, 0xDA, 0x81, 0x6B, 0x56, 0x6F, 0x43, 0xC1, 0x3F,
+    0x88, 0x97, 0x53, 0xCA, 0xAF, 0x24, 0xAF, 0x23, 0xF1, 0x1F, 0x30, 0x6C, 0x47, 0x74, 0x83, 0x57,
+    0x5E, 0x4A, 0x4D, 0xC1, 0x33, 0xE1, 0x06, 0x32, 0x2C, 0x72, 0xD0, 0x11, 0x8F, 0xAB, 0x59, 0x2A,
+    0xDF, 0xA2, 0x3E, 0xCF, 0x8F, 0x7F, 0x87, 0x00, 0x7E, 0xF0, 0x57, 0xB2, 0x50, 0x43, 0xCA, 0x82,
+    0xD3, 0x21, 0x45, 0x37, 0xAD, 0x82, 0x03, 0xD0, 0xE8, 0xAB, 0xBE, 0xDA, 0xC1, 0x81, 0xF6, 0x56,
+    0xE2, 0xA2, 0x04, 0x2A, 0x45, 0x7C, 0x3F, 0xF3, 0xEF, 0x91, 0xF9, 0x7A, 0x98, 0xC9, 0xFE, 0xFA,
+    0x33, 0xD3, 0xB1, 0xB6, 0xC9, 0xF1, 0xDC, 0x20, 0x39, 0x7C, 0x86, 0xDD, 0x5E, 0x72, 0x7C, 0x01,
+    0x91, 0x4D, 0x14, 0xA6, 0xDC, 0x5F, 0x6D, 0x70, 0x4F, 0x92, 0x99, 0x3E, 0xDA, 0x6D, 0x75, 0x2B,
+    0x59, 0x7C, 0x77, 0xB9, 0x6E, 0x3B, 0x78, 0xE9, 0x94, 0xDC, 0x2D, 0x4C, 0xA9, 0xE6, 0xF4, 0x88,
+    0xD0, 0x72, 0x40, 0x1D, 0x7E, 0x61, 0x35, 0x1B, 0x00, 0x26, 0xA0, 0x08, 0x95, 0x26, 0xA0, 0x0B,
+    0xD8, 0xAA, 0xA5, 0xCA, 0x00, 0x27, 0x9D, 0x68, 0x8F, 0x86, 0x7F, 0x2D, 0xBE, 0xBA, 0xD1, 0x07,
+    0x52, 0xBD, 0xCA, 0x49, 0xE7, 0x83, 0x14, 0x52, 0xC4, 0x6E, 0xD8, 0x3D, 0xA0, 0x08, 0x28, 0x5C,
+    0xA3, 0x55, 0xC2, 0xB2, 0xD3, 0xBC, 0xD2, 0xEE, 0xA5, 0x8A, 0xC5, 0xC7, 0x44, 0x5B, 0xA8, 0xDA,
+    0xEA, 0x63, 0x2B, 0x4D, 0x21, 0xA2, 0xA9, 0xF6, 0x05, 0x2D, 0xD6, 0xEB, 0x75, 0x2B, 0xB3, 0xC2,
+    0x29, 0xA1, 0xDB, 0xAE, 0xEE, 0x5A, 0x44, 0x9E, 0x5A, 0x5D, 0x93, 0xEC, 0xD2, 0x93, 0xD8, 0x7E,
+    0x57, 0x16, 0xD2, 0x68, 0x61, 0xBA, 0x7E, 0x54, 0xE7, 0xD4, 0x4D, 0x75, 0x51, 0x17, 0xE5, 0xB5,
+    0x3E, 0x88, 0x8A, 0xBA, 0xA7, 0xBA, 0xEA, 0xF2, 0xE6, 0x7A, 0xE7, 0xAB, 0xEB, 0x81, 0x0C, 0x23,
+    0xA2, 0x3D, 0xD6, 0x19, 0x43, 0xF6, 0xF5, 0x61, 0xE7, 0x45, 0x1F, 0xC3, 0x53, 0x5A, 0x56, 0xF6,
+    0xB7, 0x0D, 0x46, 0x80, 0xB4, 0xB9, 0x23, 0xD6, 0x36, 0x1F, 0xD2, 0x40, 0x7B, 0x97, 0xF7, 0x32,
+    0x8F, 0x66, 0xE8, 0x78, 0x4E, 0xC6, 0x72, 0xC8, 0xB6, 0xD9, 0x4C, 0x13, 0x7A, 0x6D, 0x84, 0xDA,
+    0x64, 0x5C, 0x3D, 0x00, 0x8F, 0xC1, 0x34, 0xD6, 0x09, 0xB7, 0xF0, 0x0E, 0x10, 0x0A, 0x1D, 0x71,
+    0x0B, 0x08, 0x4D, 0x5D, 0xC2, 0x4D, 0x31, 0xD2, 0x34, 0x27, 0x2C, 0x26, 0xC6, 0x39, 0x05, 0xF7,
+    0x89, 0x17, 0x5E, 0xF9, 0xCC, 0xCB, 0x7A, 0xED, 0xF3, 0x7E, 0x43, 0x98, 0x1A, 0x98, 0xAD, 0x1D,
+    0x75, 0x3F, 0xBD, 0x9A, 0x0C, 0x59, 0x00, 0xE5, 0x7B, 0x20, 0xCC, 0x34, 0x39, 0xFA, 0x76, 0x88,
+    0xB9, 0x16, 0xCF, 0xFA, 0xC8, 0x0B, 0x1F, 0xB9, 0xCC, 0x04, 0xA2, 0x0F, 0x00, 0x1F, 0xA4, 0x21,
+    0x95, 0xB1, 0xF9, 0x1A, 0x61, 0xF4, 0x3A, 0x49, 0x59, 0xDF, 0x61, 0xDA, 0x6B, 0xDC, 0x98, 0x39,
+    0x12, 0x21, 0x06, 0x41, 0xC5, 0x5B, 0xB0, 0x01, 0x2C, 0x87, 0x88, 0xE4, 0x4D, 0x30, 0x89, 0xE6,
+    0xF9, 0x9F, 0x58, 0x17, 0xE7, 0x98, 0x45, 0xCB, 0xC2, 0x63, 0x03, 0xEC, 0x07, 0x99, 0x34, 0xBF,
+    0x1C, 0xFB, 0x18, 0x86, 0x84, 0x7E, 0x1C, 0x83, 0x51, 0xDC, 0x7F, 0xB4, 0x7E, 0x6C, 0x39, 0x58,
+    0xFE, 0x16, 0x1A, 0x76, 0x92, 0xFE, 0x7D, 0x3B, 0xDF, 0x49, 0xBF, 0x73, 0x83, 0xCD, 0x0D, 0x87,
+    0x23, 0xC5, 0xD0, 0x85, 0xE2, 0x69, 0x5F, 0xFD, 0x04, 0xC2, 0x80, 0x33, 0xA0, 0x0D, 0xED, 0x01,
+    0xE4, 0x01, 0x7F, 0x40, 0x21, 0xB0, 0x08, 0x44, 0xCA, 0xE1, 0x39, 0xFD, 0x07, 0x85, 0xD5, 0x62,
+    0xBD, 0xC2, 0xEC, 0xFC, 0x1C, 0x67, 0x1F, 0x82, 0x31, 0x6F, 0xF9, 0x9B, 0x70, 0xE8, 0x24, 0x51,
+    0x30, 0xF4, 0xA5, 0x24, 0x4F, 0x46, 0x7B, 0x22, 0x79, 0xCC, 0xF8, 0x0A, 0x4C, 0xE5, 0x8F, 0x02,
+    0x9F, 0x4F, 0x91, 0x62, 0x03, 0xDF, 0x68, 0x5F, 0xFF, 0x00, 0x88, 0x67, 0x13, 0xA4, 0xF1, 0xE3,
+    0x54, 0xFC, 0x35, 0x84, 0x43, 0xB0, 0x6A, 0x64, 0xD4, 0xB8, 0x5A, 0x0E, 0x7D, 0xB3, 0x1B, 0x64,
+    0x72, 0xB8, 0xE3, 0xB0, 0x56, 0x72, 0xFF, 0xF0, 0xF0, 0xF0, 0x60, 0xB1, 0xA2, 0x3A, 0xC8, 0xB8,
+    0x10, 0x58, 0xE1, 0xC8, 0x90, 0x36, 0xC5, 0x04, 0x7D, 0xF0, 0x08, 0xD6, 0x46, 0xAA, 0xD0, 0x89,
+    0x32, 0xE2, 0x65, 0xE2, 0x74, 0x6F, 0xBA, 0xBD, 0xF6, 0x47, 0x8E, 0xEA, 0x4B, 0xE9, 0xE3, 0x61,
+    0xE3, 0x62, 0xCF, 0xC8, 0xBB, 0x37, 0xE9, 0x8B, 0x0D, 0xB1, 0x55, 0xCF, 0x07, 0x6A, 0x9B, 0x16,
+    0xAB, 0xA3, 0xF0, 0x4F, 0xAE, 0x05, 0xFC, 0x95, 0x13, 0xE2, 0x0B, 0x58, 0x4B, 0xE4, 0x70, 0x62,
+    0x7F, 0xF7, 0xDD, 0xED, 0x6E, 0x34, 0x8F, 0x9E, 0xC1, 0x29, 0xAC, 0xA5, 0x1A, 0xED, 0x81, 0x1E,
+    0x6C, 0x37, 0xA2, 0xB9, 0xFB, 0x1E, 0xE8, 0x33, 0x89, 0x16, 0xB5, 0x59, 0x63, 0x74, 0x27, 0xF8,
+    0xD7, 0x34, 0x16, 0xDC, 0x27, 0x63, 0xC5, 0x63, 0x3A, 0x9A, 0x74, 0xCE, 0xFC, 0x3E, 0x75, 0x2F,
+    0x87, 0x87, 0xD8, 0xD9, 0x9D, 0x68, 0x86, 0xE5, 0xFA, 0x13, 0xE5, 0x5B, 0xBF, 0x8F, 0xDD, 0xD8,
+    0x75, 0xBE, 0x24, 0xA5, 0x21, 0x3C, 0x04, 0xC2, 0x2D, 0xA4, 0x00, 0x9E, 0x4D, 0x96, 0x4D, 0x02,
+    0xD8, 0x0A, 0xB2, 0x6C, 0x53, 0xEC, 0xCC, 0xA5, 0x2D, 0x20, 0x6E, 0x15, 0x40, 0xCF, 0x01, 0xB2,
+    0x85, 0x1A, 0x07, 0x70, 0xD4, 0xA8, 0x49, 0x91, 0x62, 0x3C, 0xA4, 0xF3, 0x17, 0x4C, 0x93, 0xCA,
+    0x45, 0x54, 0x18, 0xB0, 0x34, 0x2E, 0xD4, 0x2A, 0xC8, 0x48, 0x64, 0xD6, 0x45, 0x0A, 0x37, 0xD4,
+    0x3A, 0x41, 0x8A, 0x14, 0x21, 0x12, 0x6D, 0x12, 0xAC, 0x8B, 0x10, 0xC9, 0x13, 0xC2, 0x91, 0xF9,
+    0x78, 0xFD, 0x7D, 0xE7, 0xDC, 0x37, 0xEF, 0xBD, 0xD1, 0x68, 0x37, 0xBB, 0x96, 0x95, 0x59, 0xED,
+    0x9B, 0xE1, 0x39, 0x7C, 0x7C, 0xE4, 0xBD, 0xE7, 0x9C, 0x7B, 0xEE, 0xF9, 0x75, 0x2F, 0x83, 0x22,
+    0x9D, 0xDB, 0x91, 0x7F, 0xF9, 0xB8, 0x75, 0x68, 0xF0, 0x09, 0x8A, 0xB8, 0xC3, 0x5F, 0x9F, 0xE0,
+    0x2F, 0xE5, 0xDF, 0x1C, 0x7F, 0x43, 0x86, 0xBF, 0x7C, 0xE4, 0x1F, 0xEE, 0x5D, 0xD8, 0x85, 0x31,
+    0xEF, 0xF1, 0xE6, 0xFD, 0x25, 0x78, 0xDB, 0x3D, 0x35, 0xC6, 0x39, 0x57, 0xC4, 0x6E, 0x72, 0x4D,
+    0xBA, 0xD8, 0xAF, 0xBB, 0x7C, 0xDC, 0x2F, 0x3B, 0x3B, 0xDF, 0xB7, 0x6D, 0xD9, 0xEF, 0xDB, 0xA2,
+    0xEE, 0x71, 0x9F, 0x00, 0xB7, 0x09, 0x56, 0x3F, 0x94, 0x73, 0x00, 0x3B, 0xEC, 0x9B, 0x2A, 0x5F,
+    0xEC, 0x87, 0x6D, 0xEA, 0x8E, 0xB3, 0x26, 0x46, 0xA3, 0x15, 0x5A, 0x9E, 0x8C, 0xD9, 0x76, 0x87,
+    0xEB, 0x5D, 0x2A, 0xE0, 0x27, 0x74, 0x53, 0x61, 0x32, 0xE7, 0x3A, 0x53, 0x3F, 0x2D, 0x07, 0xE3,
+    0x9A, 0x7C, 0x0C, 0x5D, 0x91, 0x02, 0x98, 0x74, 0x88, 0x00, 0x3A, 0x00, 0xDE, 0x56, 0x80, 0x3D,
+    0xB4, 0x86, 0x8E, 0x1B, 0x63, 0xAE, 0xBA, 0x7F, 0x9C, 0x19, 0x8B, 0xE6, 0x15, 0x98, 0x7C, 0x8E,
+    0x1F, 0xB2, 0x01, 0x20, 0x5D, 0x01, 0x5E, 0x4B, 0x7B, 0x80, 0xBC, 0x05, 0xB0, 0x85, 0x09, 0x0D,
+    0x3A, 0x4B, 0x40, 0xD5, 0x54, 0xA3, 0x47, 0xE7, 0xF2, 0xC9, 0xB9, 0xC5, 0xBB, 0x66, 0xCB, 0xCD,
+    0xDF, 0x32, 0xE6, 0x72, 0x21, 0xF4, 0xFC, 0xB6, 0x31, 0xEF, 0x18, 0x7B, 0x67, 0x2A, 0x8B, 0x8C,
+    0x84, 0xC7, 0x8B, 0xF7, 0x07, 0x93, 0x74, 0xC1, 0x60, 0xD2, 0xC6, 0x1C, 0x9B, 0xB4, 0x30, 0xDF,
+    0x33, 0x59, 0x61, 0x76, 0x79, 0x06, 0x50, 0xE1, 0x5A, 0xD2, 0x9A, 0xD1, 0xC4, 0x43, 0x3C, 0x90,
+    0x8D, 0x85, 0xB1, 0xB5, 0xAB, 0x8B, 0x77, 0x82, 0xC3, 0x77, 0xCC, 0x25, 0x83, 0xFF, 0xDA, 0x0D,
+    0x99, 0xAB, 0x6A, 0x37, 0xE6, 0x60, 0xCD, 0xB5, 0xF1, 0x64, 0x12, 0x57, 0x05, 0xA3, 0x89, 0x00,
+    0xE7, 0x60, 0xAB, 0x09, 0x41, 0xA1, 0x6B, 0xA3, 0x96, 0x12, 0x8D, 0xC1, 0x5A, 0xD9, 0xA3, 0x55,
+    0x48, 0x32, 0x23, 0x47, 0xE3, 0x1E, 0x79, 0x58, 0x50, 0x5A, 0xF1, 0xF4, 0x10, 0x30, 0x72, 0x3D,
+    0x81, 0x73, 0x83, 0xA1, 0x74, 0x47, 0x13, 0xCC, 0xDC, 0xB3, 0x9B, 0x94, 0x4A, 0x67, 0x78, 0xFE,
+    0xD1, 0x0D, 0x7F, 0x5D, 0xA1, 0x5E, 0xDF, 0x80, 0x91, 0xA3, 0x5C, 0x6A, 0x47, 0x31, 0x0A, 0xFC,
+    0xCE, 0xB8, 0xF1, 0xF9, 0x8E, 0x1F, 0x98, 0xCD, 0xAB, 0xA3, 0xB9, 0x7C, 0x53, 0x1E, 0x6B, 0x4D,
+    0x34, 0x3D, 0x80, 0x34, 0xFA, 0x78, 0x34, 0x59, 0x1B, 0x2E, 0x4C, 0xDE, 0x80, 0x1B, 0x80, 0x81,
+    0x62, 0xC6, 0x50, 0xF6, 0x42, 0x31, 0x40, 0x82, 0x7B, 0x4D, 0x0A, 0x89, 0x18, 0x5B, 0xE2, 0xB4,
+    0x8C, 0x41, 0x73, 0x6D, 0xCA, 0x09, 0x20, 0x71, 0x45, 0xD9, 0x60, 0x20, 0xED, 0xDC, 0x94, 0x4D,
+    0xE6, 0x0A, 0xDB, 0x24, 0x6E, 0x9E, 0x57, 0x81, 0x73, 0x65, 0x61, 0x72, 0xEA, 0x4B, 0x28, 0xC4,
+    0xE7, 0xA3, 0x30, 0x6E, 0x02, 0xD0, 0x4E, 0x89, 0xD7, 0xC6, 0x56, 0xA6, 0x34, 0xB6, 0x31, 0x07,
+    0xC6, 0xB6, 0x66, 0x61, 0xB2, 0x79, 0x88, 0xE1, 0xA1, 0xF6, 0x04, 0xB5, 0x2B, 0x96, 0x3A, 0x75,
+    0x09, 0x77, 0x94, 0x45, 0xD9, 0xD6, 0x4D, 0xD9, 0xA2, 0x93, 0xA6, 0x6C, 0x76, 0xCC, 0x8E, 0x39,
+    0xFD, 0xDC, 0x11, 0x09, 0xA8, 0x72, 0x9A, 0xFC, 0xC4, 0xDC, 0x99, 0xB3, 0x79, 0x13, 0x4C, 0x26,
+    0xE2, 0x0F, 0x79, 0x95, 0xB4, 0xA1, 0xEB, 0x92, 0x36, 0xAD, 0x72, 0xB7, 0x88, 0xFA, 0x1C, 0xDD,
+    0xD6, 0xC1, 0x7C, 0x0F, 0x6C, 0xEE, 0x99, 0x71, 0x1F, 0xF7, 0x7C, 0xCD, 0xEC, 0x1F, 0xC7, 0xE4,
+    0x73, 0x77, 0x48, 0x88, 0xF6, 0x86, 0xA4, 0x13, 0x94, 0x76, 0xEB, 0xDF, 0xF4, 0x37, 0x7F, 0xE7,
+    0xBE, 0xB4, 0xBD, 0xBF, 0x1B, 0x62, 0xE8, 0xCD, 0xB1, 0x35, 0x93, 0xC9, 0xCC, 0x90, 0x15, 0xF6,
+    0x39, 0x7A, 0x48, 0xDB, 0x84, 0xFD, 0xE1, 0x8E, 0x2B, 0xE8, 0x1D, 0x3F, 0x09, 0x3D, 0xF6, 0xA9,
+    0x68, 0x34, 0xB8, 0xA3, 0x20, 0x4D, 0xE9, 0x4E, 0x84, 0xFA, 0x99, 0xCC, 0x06, 0xFC, 0xF6, 0x8B,
+    0x09, 0x6C, 0x3A, 0x93, 0x35, 0x64, 0xDC, 0x15, 0x21, 0x04, 0x90, 0x3F, 0x77, 0x45, 0x8D, 0xEF,
+    0xF2, 0xF7, 0x7D, 0x9C, 0xFF, 0xDC, 0x55, 0x76, 0xB2, 0xFD, 0xD6, 0xDD, 0x9D, 0xBB, 0x66, 0xBB,
+    0x80, 0x0C, 0x2C, 0xC4, 0x67, 0x1E, 0x43, 0x72, 0xE1, 0x18, 0x51, 0x6B, 0x31, 0x49, 0xB2, 0xDE,
+    0xF6, 0xC6, 0x76, 0x75, 0x6B, 0xF0, 0x68, 0x63, 0x6A, 0x88, 0xCC, 0xD8, 0xBE, 0x6C, 0x31, 0x81,
+    0xF2, 0xDE, 0xC4, 0x63, 0x32, 0x37, 0xC1, 0x02, 0x37, 0xE3, 0x49, 0x8C, 0x65, 0x5E, 0x58, 0xCE,
+    0x95, 0xCB, 0xD4, 0x1D, 0xEA, 0x35, 0xC0, 0xED, 0xA3, 0xA3, 0x07, 0x9C, 0x98, 0xE9, 0xA7, 0x03,
+    0xEB, 0x86, 0xD3, 0xFF, 0x97, 0x8C, 0x07, 0x38, 0xC3, 0xD7, 0x69, 0x63, 0x3C, 0x3E, 0x3C, 0xBA,
+    0x5F, 0x60, 0x3C, 0xBE, 0xE5, 0xDC, 0x9C, 0xE3, 0x51, 0x06, 0x0B, 0x33, 0xDF, 0x15, 0x5E, 0x8E,
+    0xF7, 0x81, 0xAC, 0xD9, 0x7F, 0x28, 0x68, 0x77, 0x90, 0x8B, 0x7B, 0x73, 0xA0, 0x51, 0x10, 0xA6,
+    0xCB, 0xBB, 0x44, 0x0D, 0xC6, 0xC3, 0xD8, 0xB4, 0x35, 0x7B, 0xB8, 0x13, 0x23, 0xB2, 0x8B, 0xE7,
+    0xA0, 0x3A, 0xFB, 0x6C, 0x65, 0x61, 0x8E, 0xF7, 0xE4, 0xB9, 0x21, 0xFB, 0xA6, 0xEB, 0xEC, 0xBF,
+    0xF6, 0xE9, 0x07, 0x47, 0x77, 0xB7, 0x7F, 0xD4, 0x46, 0x1C, 0xB8, 0xAC, 0x22, 0xD7, 0x50, 0x01,
+    0x88, 0xC8, 0xBC, 0xFD, 0x92, 0xF1, 0xB8, 0x76, 0x74, 0x74, 0xF4, 0x43, 0x5A, 0xA2, 0x39, 0xCF,
+    0xEE, 0xAA, 0x5D, 0x83, 0x00, 0xA1, 0xC4, 0xF9, 0xC7, 0x18, 0xA6, 0xA2, 0x84, 0xC2, 0xE6, 0xC5,
+    0x63, 0x1C, 0xC4, 0x25, 0x89, 0x7D, 0x82, 0xA1, 0x93, 0x79, 0x8A, 0x5E, 0x6E, 0x63, 0x04, 0x43,
+    0x3E, 0x26, 0x5D, 0xBE, 0x0C, 0xDC, 0xFE, 0xF1, 0xF3, 0x23, 0x91, 0x78, 0x23, 0xE0, 0x93, 0x6F,
+    0x36, 0xB4, 0x2B, 0xAB, 0x0F, 0xC6, 0x68, 0xFD, 0xD9, 0x2D, 0x98, 0xE3, 0x1C, 0xBD, 0xDB, 0xBF,
+    0x5C, 0x98, 0xF2, 0x1B, 0x93, 0xC9, 0xA1, 0x70, 0x41, 0xC0, 0x79, 0x87, 0x71, 0xA6, 0xD4, 0x61,
+    0xD4, 0x40, 0xA8, 0x31, 0x8F, 0xD8, 0x5A, 0x58, 0xA4, 0x55, 0x54, 0x94, 0xB3, 0x5B, 0x05, 0x1E,
+    0x96, 0x63, 0x36, 0x9B, 0x81, 0xC3, 0x43, 0x70, 0x30, 0x68, 0x1B, 0x81, 0x43, 0x1B, 0x1C, 0x34,
+    0x08, 0x0B, 0xBA, 0x12, 0x40, 0x9B, 0x02, 0xBA, 0x95, 0xD0, 0x2B, 0xB3, 0xA9, 0x8B, 0x3F, 0xC7,
+    0x01, 0x03, 0x6F, 0x1E, 0xC7, 0x30, 0x92, 0x18, 0xF2, 0xAD, 0x23, 0x5C, 0x3E, 0xBA, 0x0B, 0x41,
+    0x45, 0x34, 0xF8, 0x26, 0xEF, 0x0C, 0x66, 0xFF, 0x95, 0x25, 0xC5, 0x75, 0xFF, 0x4A, 0xFF, 0xE7,
+    0x30, 0xAF, 0x4B, 0x38, 0x04, 0x84, 0x8B, 0x18, 0x44, 0x80, 0x19, 0x3B, 0x9A, 0xC9, 0x2D, 0x52,
+    0xD7, 0x8C, 0xF5, 0x1C, 0xF6, 0x78, 0x14, 0x47, 0x30, 0x0A, 0x0D, 0x0B, 0x81, 0x4E, 0xA1, 0x98,
+    0x17, 0xF2, 0x04, 0xDA, 0xE4, 0x67, 0x4B, 0xED, 0x84, 0x11, 0x94, 0x9F, 0xBF, 0x4D, 0x01, 0x53,
+    0x87, 0x5D, 0x43, 0xDF, 0x32, 0x15, 0xD6, 0x4D, 0xD0, 0x33, 0x42, 0xF0, 0x05, 0xD8, 0xBE, 0x14,
+    0x5A, 0x81, 0xB9, 0xC0, 0x54, 0x60, 0x24, 0xD0, 0xFC, 0xC9, 0x63, 0x42, 0xB3, 0xF7, 0x6B, 0x81,
+    0xB4, 0x51, 0x8F, 0x69, 0x9B, 0xF2, 0x29, 0x86, 0x32, 0x29, 0x94, 0x4F, 0x60, 0xF2, 0xBE, 0x9C,
+    0xD7, 0x43, 0x39, 0xD8, 0x7E, 0xBB, 0x32, 0x37, 0x4C, 0xD8, 0x99, 0x68, 0xA0, 0xC7, 0x82, 0xB5,
+    0x26, 0xBF, 0x59, 0xFB, 0xBB, 0x75, 0x63, 0x61, 0x6E, 0x30, 0x1D, 0x76, 0x60, 0x95, 0xC1, 0x77,
+    0x65, 0xCB, 0x6A, 0x17, 0xC6, 0xF9, 0x13, 0xFE, 0xEB, 0x36, 0x77, 0xEE, 0xEA, 0x6C, 0x16, 0xD4,
+    0x4F, 0x39, 0x89, 0x30, 0xDE, 0x25, 0x6C, 0x73, 0xDE, 0xD5, 0x4D, 0xD6, 0xD7, 0xD5, 0xEA, 0x80,
+    0x47, 0xE8, 0x6D, 0x63, 0x5B, 0x7C, 0x43, 0x04, 0x01, 0xFD, 0xB9, 0x7D, 0xD7, 0x7C, 0xD7, 0xDC,
+    0xA3, 0xED, 0x3A, 0x80, 0xB8, 0x1B, 0x34, 0x95, 0xF6, 0xA0, 0x42, 0x8C, 0x57, 0x34, 0xC1, 0x0F,
+    0x05, 0xEE, 0x3A, 0xC6, 0xC8, 0xFD, 0x1D, 0x86, 0xC8, 0x7D, 0x00, 0x4B, 0xE8, 0x10, 0x32, 0x44,
+    0x8B, 0x64, 0x34, 0xC9, 0x1C, 0xFE, 0x3F, 0xED, 0x72, 0xB0, 0x57, 0xC1, 0xFF, 0x5B, 0xAA, 0xF3,
+    0x15, 0x43, 0x47, 0x76, 0x8D, 0x32, 0x60, 0x44, 0x61, 0x44, 0xC7, 0x13, 0xA7, 0x63, 0xFE, 0x18,
+    0xF3, 0x3C, 0xC4, 0xB0, 0xFE, 0x45, 0xED, 0x67, 0x51, 0xAD, 0x53, 0x81, 0x38, 0x6D, 0x14, 0x73,
+    0x5A, 0x88, 0x3D, 0x30, 0x8A, 0x1F, 0x79, 0x3C, 0x2A, 0xC6, 0xE3, 0x47, 0xC4, 0x51, 0xCF, 0xC6,
+    0xE1, 0xEB, 0xA0, 0xDE, 0x8C, 0x5C, 0xD2, 0x26, 0x65, 0xB4, 0xB2, 0xC8, 0x8B, 0x77, 0x9D, 0xB9,
+    0x3A, 0xBB, 0x09, 0xA3, 0x25, 0x8A, 0xF5, 0xC8, 0xF4, 0x82, 0xC7, 0xB0, 0x95, 0x40, 0x67, 0x1E,
+    0x57, 0x4E, 0xE6, 0x70, 0x2A, 0x8A, 0x97, 0xB4, 0x96, 0xCE, 0x1E, 0xBD, 0x5B, 0x71, 0xE8, 0xEC,
+    0x9D, 0xD7, 0xAD, 0x57, 0xCC, 0x47, 0x64, 0xA2, 0x90, 0xDE, 0x33, 0xA7, 0x53, 0xFE, 0xF2, 0xEC,
+    0x86, 0xF0, 0x77, 0xEC, 0xB5, 0x76, 0x24, 0x7F, 0x85, 0xF0, 0x55, 0x62, 0x86, 0x91, 0xAF, 0xF7,
+    0x80, 0x85, 0x2F, 0x60, 0xE1, 0x8B, 0x7E, 0xB7, 0x50, 0x2C, 0x7C, 0x01, 0x3F, 0xF2, 0x78, 0x54,
+    0x1C, 0xCE, 0x15, 0xC3, 0x00, 0x9F, 0x10, 0x27, 0x4F, 0x68, 0x83, 0xCA, 0x22, 0xFD, 0xC9, 0x98,
+    0x75, 0xC6, 0x55, 0xF9, 0xF5, 0x21, 0xED, 0xA1, 0xCA, 0x36, 0x84, 0xD0, 0x31, 0xCC, 0x8F, 0xCC,
+    0x5B, 0x12, 0x7C, 0x8D, 0x3A, 0x45, 0xF8, 0x38, 0x46, 0x4E, 0x7A, 0x3F, 0x10, 0xBE, 0x4C, 0x20,
+    0x51, 0x5A, 0x63, 0x44, 0x21, 0x73, 0x12, 0xF0, 0x3B, 0xC2, 0xD7, 0x68, 0xFE, 0x80, 0x7C, 0x45,
+    0xCF, 0x66, 0x0F, 0xF9, 0x25, 0x26, 0xFF, 0x78, 0x5C, 0x30, 0xD5, 0x73, 0x36, 0xBB, 0x49, 0xDB,
+    0x83, 0x48, 0x4C, 0xEC, 0x0F, 0x7B, 0xA0, 0x0D, 0x62, 0x73, 0xB4, 0x43, 0xEC, 0x81, 0xB6, 0x48,
+    0x34, 0x1C, 0xF6, 0x48, 0xF8, 0x83, 0x4D, 0x82, 0x25, 0x17, 0xBB, 0x44, 0xFE, 0x68, 0x9B, 0x0E,
+    0xC4, 0x4C, 0x4F, 0x7E, 0xAA, 0xBB, 0x40, 0x1D, 0x52, 0x7D, 0xBD, 0x0F, 0xEF, 0x19, 0xD8, 0xAA,
+    0x6F, 0x75, 0xD0, 0x2C, 0xD8, 0x2B, 0x8C, 0xDB, 0x48, 0x9B, 0x95, 0x55, 0x30, 0x14, 0xB0, 0x5B,
+    0xD6, 0xFC, 0xED, 0x48, 0xDB, 0x75, 0x10, 0xFC, 0x8F, 0x3C, 0x39, 0x46, 0x3F, 0x21, 0x0E, 0x86,
+    0xE4, 0xFA, 0x28, 0xE3, 0xF6, 0x4E, 0x24, 0x51, 0x4B, 0xF7, 0x9E, 0xE0, 0xB4, 0x71, 0x0C, 0x4F,
+    0xD0, 0x3B, 0x70, 0x2F, 0xFC, 0xC9, 0xF5, 0x03, 0x8F, 0x71, 0xC0, 0x1E, 0x2A, 0xF1, 0x7E, 0x02,
+    0x5E, 0x9D, 0xF9, 0x48, 0x46, 0x8C, 0x67, 0xCC, 0x21, 0x4C, 0xE8, 0x1A, 0x39, 0x88, 0x46, 0xA2,
+    0x61, 0xCE, 0x86, 0xF5, 0xCF, 0x4D, 0xE3, 0x4D, 0x56, 0x70, 0x0A, 0x12, 0x82, 0x7A, 0xE0, 0x03,
+    0x0D, 0xC3, 0x30, 0xAA, 0x0C, 0x2F, 0x95, 0x64, 0xB3, 0xE6, 0x58, 0x8A, 0xB6, 0x00, 0xFC, 0x27,
+    0x01, 0x5C, 0x39, 0xF4, 0xB5, 0xB1, 0x03, 0x2C, 0x60, 0xB6, 0x48, 0x5C, 0x13, 0x49, 0x5C, 0x7D,
+    0x47, 0xED, 0x1D, 0x69, 0x39, 0xAA, 0xD4, 0x38, 0x38, 0xB5, 0x77, 0x88, 0x53, 0x15, 0xA7, 0xA3,
+    0xBF, 0x61, 0xE1, 0xEF, 0x2C, 0x3D, 0xBE, 0xBC, 0x49, 0x63, 0xE0, 0xB9, 0x0B, 0x7D, 0x03, 0x91,
+    0xC6, 0xA4, 0xEA, 0x00, 0xD9, 0x8E, 0x44, 0x01, 0xC0, 0xA5, 0x36, 0x98, 0x67, 0x8A, 0x6D, 0xAA,
+    0x0D, 0x1F, 0xA4, 0x6A, 0x87, 0x8F, 0x13, 0xC5, 0x63, 0x24, 0xD9, 0x40, 0x30, 0x17, 0x06, 0xE9,
+    0xA5, 0xA4, 0x61, 0x8C, 0xBE, 0x34, 0x0C, 0xFD, 0x92, 0x86, 0x31, 0xFA, 0xC2, 0x6D, 0xE6, 0x54,
+    0x7D, 0x72, 0x1F, 0x17, 0x63, 0x1C, 0xF2, 0x85, 0x8E, 0x43, 0xE6, 0xD4, 0xD4, 0xA7, 0xDE, 0x08,
+    0x50, 0xCE, 0x94, 0x21, 0x1B, 0x8E, 0x44, 0x82, 0xAD, 0x88, 0x93, 0xFE, 0x82, 0x63, 0x48, 0xC9,
+    0x2C, 0xF1, 0x9A, 0x64, 0x62, 0xA7, 0xD8, 0xD3, 0xAB, 0x39, 0x09, 0xE5, 0xE1, 0xCD, 0xEA, 0xE4,
+    0x05, 0x71, 0xE3, 0xCB, 0x21, 0x97, 0xC0, 0x8B, 0x65, 0xC9, 0x4F, 0xE2, 0xF9, 0xC8, 0xFF, 0x4D,
+    0xE9, 0x2F, 0x0B, 0xE7, 0x7D, 0x6C, 0x5E, 0xA9, 0x58, 0x82, 0xE2, 0xCB, 0x20, 0x97, 0xED, 0x4A,
+    0xF9, 0x2C, 0x07, 0xE6, 0x7C, 0x60, 0xD3, 0xDD, 0x12, 0x7A, 0x24, 0xA4, 0x03, 0xEE, 0x4A, 0xA1,
+    0x37, 0x6E, 0x92, 0xE5, 0x84, 0x2A, 0xBE, 0x14, 0xFA, 0x72, 0x69, 0x19, 0xF7, 0xF9, 0x89, 0x82,
+    0xFC, 0x65, 0x89, 0x35, 0xF2, 0xF2, 0xFA, 0xF2, 0x75, 0x04, 0x03, 0xE7, 0x7D, 0xDE, 0x58, 0xFB,
+    0x52, 0x17, 0x9E, 0x0F, 0xE5, 0x27, 0x7D, 0xE2, 0xF9, 0x30, 0x0F, 0x37, 0x71, 0x35, 0xF8, 0x79,
+    0xD6, 0x7B, 0xFE, 0x3F, 0x45, 0x0E, 0x77, 0x86, 0xCF, 0x24, 0x87, 0x61, 0x25, 0x87, 0xE6, 0x73,
+    0xCA, 0x61, 0xFA, 0x95, 0xE4, 0xC0, 0xD8, 0x5A, 0x69, 0x97, 0x33, 0xA1, 0xFE, 0x96, 0x9B, 0x8E,
+    0x1E, 0xC8, 0x59, 0x76, 0x67, 0x34, 0xA1, 0x9C, 0x59, 0x56, 0x0D, 0xE4, 0xEC, 0x7B, 0xA7, 0x67,
+    0x23, 0xCF, 0xC4, 0x37, 0xCE, 0x73, 0xEF, 0xAF, 0x10, 0xC7, 0xF8, 0xB3, 0xB8, 0x5D, 0x9E, 0xA5,
+    0xCD, 0xF2, 0x2C, 0x2F, 0x72, 0x3F, 0xFD, 0xAC, 0xB0, 0x22, 0x12, 0x39, 0x3D, 0x1B, 0x8C, 0xFF,
+    0x15, 0x49, 0x96, 0x7F, 0x22, 0xF2, 0xFC, 0x92, 0xBD, 0xE5, 0x59, 0xF6, 0x57, 0x33, 0xAF, 0x6C,
+    0xD6, 0x2C, 0xEF, 0x3B, 0xD0, 0xB3, 0x5C, 0xC8, 0xE1, 0x99, 0x15, 0xDF, 0xAF, 0x67, 0x94, 0x82,
+    0x95, 0x4C, 0x9B, 0x5E, 0xB5, 0x5C, 0xCC, 0xBE, 0x4D, 0x09, 0xB4, 0xA9, 0x30, 0xBC, 0x76, 0x76,
+    0x9A, 0x23, 0xD1, 0x3D, 0x27, 0x72, 0xA5, 0x3C, 0x79, 0xDF, 0x35, 0x01, 0xFF, 0xDB, 0x98, 0x71,
+    0x67, 0x97, 0x42, 0xDA, 0x65, 0x9B, 0xB1, 0xFC, 0x52, 0xB0, 0xCD, 0x2B, 0x46, 0x69, 0xA9, 0x87,
+    0x15, 0xF4, 0xE2, 0x7C, 0x09, 0x5C, 0xBF, 0x53, 0x9F, 0x95, 0x08, 0xC2, 0xF3, 0x2E, 0xA3, 0x78,
+    0xC8, 0xC0, 0x24, 0xEC, 0x58, 0x95, 0x42, 0x90, 0x57, 0xBB, 0x1F, 0x63, 0x28, 0x33, 0xA1, 0x07,
+    0x76, 0x8D, 0xA1, 0x43, 0xFC, 0x0F, 0x22, 0xE1, 0xA7, 0xAA, 0x81, 0x4A, 0xB4, 0x98, 0x7B, 0xDB,
+    0x9C, 0xC2, 0x3F, 0x15, 0x05, 0xAB, 0xE5, 0xD7, 0x92, 0x3D, 0x5F, 0x93, 0xF0, 0x46, 0x05, 0xA6,
+    0x5A, 0xA8, 0x95, 0x3F, 0xFF, 0x50, 0xD2, 0x6F, 0xFA, 0x51, 0x66, 0xB4, 0xAE, 0x12, 0xC9, 0x20,
+    0x61, 0xF8, 0xF8, 0xA8, 0x6E, 0x38, 0x55, 0x33, 0x8A, 0x02, 0x23, 0xBA, 0x82, 0x49, 0xA3, 0xC1,
+    0xCB, 0x79, 0xB0, 0x53, 0x53, 0x0C, 0xC6, 0x97, 0xB0, 0x7B, 0xC9, 0x9D, 0x9B, 0x30, 0x98, 0x13,
+    0x86, 0x0A, 0xC5, 0x44, 0x44, 0x7D, 0xE4, 0x3E, 0x9A, 0xDD, 0xEA, 0x85, 0x1E, 0x0F, 0x25, 0xD1,
+    0x3D, 0x7D, 0x2E, 0x12, 0x83, 0xA6, 0x71, 0x53, 0x26, 0x93, 0xD3, 0xCA, 0x14, 0xBF, 0x62, 0xBE,
+    0x48, 0x1C, 0x1D, 0x1D, 0xCA, 0x03, 0x52, 0x6F, 0x10, 0x7D, 0x4F, 0x9F, 0x71, 0x7E, 0xE7, 0x4D,
+    0x59, 0x89, 0x02, 0xB7, 0x64, 0xE8, 0xD4, 0xA5, 0x7F, 0x01, 0x38, 0x0A, 0x58, 0x66, 0x44, 0xB6,
+    0xC8, 0x6C, 0x25, 0x67, 0x4D, 0xCC, 0xC3, 0xAC, 0xCF, 0xD1, 0xCF, 0x56, 0xB5, 0xB5, 0xE9, 0x87,
+    0x2F, 0x3E, 0x47, 0x9C, 0x46, 0x9C, 0xFF, 0x32, 0xEF, 0x68, 0xB4, 0x59, 0x07, 0x97, 0x6A, 0xA4,
+    0x4E, 0x1D, 0x58, 0x33, 0x24, 0x6C, 0x0E, 0x71, 0xFF, 0x42, 0xA7, 0x79, 0xF9, 0x0A, 0x0F, 0xB4,
+    0xC7, 0x76, 0xAD, 0xEF, 0x43, 0xA2, 0x64, 0xA6, 0x32, 0xF4, 0x32, 0x39, 0x68, 0xA0, 0x96, 0x2C,
+    0x56, 0xB3, 0x98, 0x95, 0x68, 0x95, 0x24, 0x8B, 0xE2, 0x9D, 0x48, 0xE2, 0x55, 0x1D, 0x6C, 0x4F,
+    0x7D, 0x8A, 0xF6, 0x61, 0xAE, 0xDD, 0x95, 0x12, 0x4E, 0xC0, 0xFA, 0xFE, 0x50, 0x17, 0x2C, 0x10,
+    0xD8, 0x22, 0xEE, 0xAF, 0x78, 0x6A, 0x5E, 0xA7, 0x5C, 0x2E, 0x21, 0xEE, 0x29, 0xAB, 0x9A, 0xA5,
+    0xD7, 0x8A, 0x47, 0xD9, 0xB8, 0x62, 0x07, 0x31, 0xCE, 0x9A, 0x96, 0xBD, 0x36, 0xB9, 0xA0, 0xAF,
+    0xE7, 0x85, 0x7A, 0x57, 0xD1, 0x9A, 0x8F, 0x1F, 0x40, 0x56, 0x50, 0xAE, 0x40, 0x34, 0xB3, 0xA5,
+    0xF5, 0x27, 0xCA, 0x9C, 0xA0, 0xD4, 0x15, 0x44, 0xB1, 0xB8, 0x1C, 0xFA, 0x70, 0x45, 0xAD, 0xA2,
+    0x2E, 0xD4, 0x0E, 0xD0, 0x66, 0xBF, 0x42, 0xFE, 0xA2, 0xBF, 0x65, 0xE3, 0x81, 0x66, 0xAD, 0x31,
+    0xAE, 0x90, 0x48, 0x0F, 0xD2, 0x51, 0x3E, 0x09, 0x82, 0x07, 0x12, 0x5A, 0x7A, 0xDC, 0xF5, 0xD1,
+    0x1D, 0x59, 0x57, 0x12, 0x3A, 0x89, 0x64, 0xF1, 0xCB, 0x07, 0xD6, 0x1A, 0x57, 0xFB, 0xB0, 0xDA,
+    0x47, 0xD5, 0x3E, 0xA8, 0x8E, 0x4E, 0x63, 0xEA, 0x62, 0x4D, 0xC0, 0x15, 0xFA, 0x9B, 0x9C, 0xF4,
+    0xE7, 0x24, 0x48, 0x2A, 0xDB, 0x90, 0xD1, 0x05, 0xD7, 0x23, 0x70, 0x7B, 0x06, 0x36, 0x9D, 0x47,
+    0x0D, 0xD1, 0xFF, 0x82, 0x09, 0xA0, 0x39, 0xA4, 0x42, 0x04, 0xBA, 0x88, 0x40, 0x25, 0x11, 0xA4,
+    0x42, 0x04, 0x46, 0x88, 0x42, 0xD7, 0x13, 0xC1, 0x9F, 0x0A, 0xB2, 0xA3, 0xA0, 0xCC, 0x09, 0x4A,
+    0xDC, 0x5F, 0x13, 0x45, 0xEE, 0xBF, 0x88, 0xD0, 0x3A, 0x11, 0xE8, 0x11, 0x64, 0x15, 0xA1, 0x39,
+    0x16, 0x4E, 0x10, 0x29, 0xC5, 0x12, 0x28, 0x15, 0x62, 0x7A, 0x3D, 0x2A, 0x0B, 0xB3, 0x7D, 0xE4,
+    0x63, 0xBB, 0x62, 0x3D, 0x04, 0xB6, 0xEA, 0x20, 0x13, 0x0D, 0xF4, 0x02, 0x1F, 0xD2, 0x5C, 0x59,
+    0x0F, 0x96, 0x6B, 0xB1, 0x25, 0xB2, 0xC4, 0x85, 0x3E, 0x4F, 0xFE, 0x58, 0x46, 0xBA, 0x61, 0xA5,
+    0x94, 0x6D, 0xC1, 0xF5, 0x32, 0x7C, 0xC0, 0x41, 0x5F, 0x0F, 0x17, 0x6C, 0x25, 0x2C, 0x2B, 0x4A,
+    0x8D, 0xD6, 0x7C, 0x59, 0xC1, 0x23, 0x06, 0x0B, 0x18, 0xC6, 0x4F, 0x42, 0xF5, 0x7C, 0xFD, 0x81,
+    0x52, 0x91, 0xB6, 0x59, 0xE5, 0x12, 0x09, 0x2E, 0xFB, 0xA3, 0xBB, 0xCF, 0x47, 0x09, 0x09, 0x19,
+    0x0A, 0xB8, 0xF9, 0x16, 0x09, 0xF5, 0x71, 0x57, 0xA8, 0x31, 0x85, 0x09, 0x6E, 0x2A, 0x17, 0x3B,
+    0xF7, 0xCD, 0x2A, 0x2A, 0x59, 0x16, 0x24, 0x34, 0x52, 0x88, 0x74, 0xA0, 0x7D, 0xA8, 0xB0, 0x91,
+    0x59, 0xBE, 0x11, 0xBC, 0x6F, 0xDF, 0xF7, 0x26, 0x5C, 0x59, 0x57, 0xA6, 0x9D, 0x2C, 0x74, 0x46,
+    0x63, 0xCC, 0x81, 0x4F, 0x3A, 0x19, 0xF8, 0xCB, 0x1B, 0x03, 0xFF, 0x46, 0xF0, 0xFE, 0x67, 0x52,
+    0x5A, 0x42, 0xF3, 0xB9, 0xC4, 0x87, 0x27, 0xA5, 0x06, 0xDD, 0x1C, 0xF1, 0xFC, 0x9B, 0xBA, 0x6E,
+    0x68, 0xCA, 0xCE, 0x97, 0xB2, 0xDF, 0x30, 0xDE, 0x0B, 0x31, 0x5D, 0xD1, 0xA0, 0x43, 0x3C, 0xCA,
+    0x42, 0x37, 0x90, 0x54, 0x1C, 0xC7, 0x84, 0xDF, 0x82, 0xBB, 0xE1, 0xE1, 0x8B, 0xC9, 0xF1, 0x1B,
+    0x31, 0xDF, 0x8D, 0xF9, 0x8A, 0x31, 0xBF, 0xC5, 0x52, 0x71, 0x89, 0x74, 0x23, 0x58, 0x98, 0x78,
+    0x1E, 0xC3, 0x9D, 0x2E, 0x18, 0x44, 0x97, 0x4C, 0x2B, 0x24, 0xC3, 0x14, 0x29, 0x30, 0xEE, 0xC1,
+    0x35, 0x24, 0x98, 0x93, 0x2C, 0x15, 0x40, 0x5E, 0x59, 0x87, 0x27, 0x64, 0xFD, 0xF8, 0x37, 0xD8,
+    0xCA, 0xEA, 0xA3, 0x21, 0x48, 0xD4, 0x89, 0x98, 0x7E, 0xD0, 0x68, 0x0E, 0x5B, 0x9D, 0x23, 0xA6,
+    0x5A, 0xC5, 0xE4, 0x44, 0x4C, 0xA1, 0x13, 0x31, 0xC5, 0xFF, 0x24, 0x62, 0x4A, 0xFF, 0x5E, 0xD8,
+    0xCD, 0xAE, 0x0B, 0xDA, 0x53, 0x31, 0xED, 0xAB, 0x44, 0x06, 0x41, 0x41, 0x2F, 0x28, 0xEA, 0x04,
+    0x25, 0x8D, 0x88, 0x29, 0xAD, 0x44, 0x4C, 0xB9, 0x8A, 0x69, 0x57, 0xC5, 0x74, 0x2C, 0x62, 0x5A,
+    0xCC, 0x45, 0x4C, 0x30, 0xF4, 0x22, 0xA6, 0xF6, 0x1C, 0x31, 0xE9, 0xDE, 0x07, 0x73, 0xA0, 0x62,
+    0x1A, 0x54, 0x4C, 0x77, 0x3D, 0x57, 0xBA, 0x0C, 0xA9, 0x09, 0x15, 0x77, 0x12, 0xF8, 0x2C, 0xD5,
+    0x7B, 0x3D, 0x35, 0x88, 0x59, 0x73, 0xD6, 0x3C, 0x96, 0x70, 0x84, 0x99, 0x5B, 0x00, 0x75, 0x40,
+    0x31, 0x26, 0x15, 0x7D, 0xAF, 0x2F, 0x5C, 0xFF, 0x3F, 0x21, 0x6A, 0xD3, 0x81, 0xA6, 0xA0, 0xCC,
+    0x66, 0x27, 0x59, 0xA4, 0x4C, 0x11, 0x04, 0xF4, 0xAB, 0xB2, 0xD9, 0x1D, 0xB7, 0x38, 0x5D, 0x8D,
+    0x5D, 0xD5, 0x64, 0xB5, 0x74, 0x21, 0x83, 0xB6, 0x2A, 0xC8, 0xFA, 0x7A, 0xEC, 0xF4, 0x42, 0x35,
+    0xF6, 0x0D, 0xE1, 0x5D, 0x07, 0x3E, 0xD0, 0x1C, 0x5E, 0x53, 0x33, 0x9F, 0x9B, 0x21, 0x39, 0xE3,
+    0x12, 0x8C, 0xCF, 0xCE, 0xD6, 0xD3, 0xB3, 0x37, 0x85, 0x77, 0x5F, 0xBC, 0x69, 0xA4, 0x50, 0x60,
+    0xBB, 0xB2, 0x5D, 0x43, 0xAD, 0x5C, 0xDC, 0x2E, 0xB6, 0xCF, 0x1A, 0xC7, 0x37, 0x84, 0xF7, 0xAD,
+    0xA3, 0xE2, 0xB4, 0x2E, 0x03, 0x19, 0x68, 0x75, 0xCF, 0xFB, 0x41, 0x8D, 0x0F, 0xB5, 0x3E, 0xB6,
+    0x11, 0x0D, 0x39, 0x59, 0xD0, 0xEF, 0x35, 0x95, 0xED, 0x33, 0x77, 0x42, 0x43, 0xC7, 0x72, 0x4E,
+    0x48, 0x0B, 0xD7, 0x4B, 0xB7, 0x40, 0xDC, 0x12, 0x00, 0xBB, 0xC6, 0xA5, 0x35, 0xD8, 0xBC, 0x84,
+    0xB9, 0xE4, 0x24, 0x3B, 0x3A, 0x52, 0xAE, 0xFB, 0xCB, 0xFA, 0xD4, 0x9E, 0x68, 0x5B, 0x73, 0xAC,
+    0x89, 0xAD, 0x96, 0x97, 0xFE, 0x5B, 0xC2, 0xAF, 0xF2, 0x17, 0x5A, 0xE4, 0xD0, 0xE8, 0x34, 0xF3,
+    0x73, 0xD2, 0x99, 0xCF, 0x86, 0x72, 0x79, 0x3C, 0x55, 0x93, 0xA7, 0x48, 0x37, 0x31, 0xA9, 0x34,
+    0x62, 0xD1, 0xF7, 0xD0, 0x27, 0xD0, 0x3E, 0xB1, 0x3E, 0x59, 0xA5, 0xD7, 0x1F, 0xD5, 0x4C, 0x23,
+    0x3A, 0xC9, 0x5A, 0x3A, 0x49, 0x37, 0x3A, 0xC9, 0x3D, 0x3A, 0xC9, 0x47, 0x00, 0xFB, 0x35, 0xD8,
+    0x9D, 0x42, 0xBD, 0x33, 0x66, 0x42, 0xD2, 0x49, 0x3E, 0xF2, 0x5C, 0x12, 0x38, 0xA6, 0x0B, 0x38,
+    0xFF, 0xE1, 0xB2, 0x2F, 0xED, 0x57, 0x69, 0x70, 0x6B, 0x54, 0x71, 0x73, 0xDD, 0xA1, 0x7A, 0xB2,
+    0x85, 0x18, 0xA2, 0x3F, 0x74, 0xB2, 0xB9, 0x4B, 0xC6, 0x05, 0x01, 0x2B, 0x23, 0x75, 0x3C, 0x4A,
+    0xCB, 0xC4, 0xCC, 0x6A, 0x50, 0xA4, 0x79, 0x16, 0xEC, 0x7D, 0xE9, 0xDA, 0xC4, 0x09, 0xB2, 0xD3,
+    0x3D, 0xF3, 0x9B, 0xF0, 0x18, 0x92, 0xDA, 0xB4, 0x6C, 0x24, 0x70, 0x4F, 0x96, 0xA8, 0xD1, 0x8B,
+    0x9D, 0xA2, 0x85, 0xA0, 0x52, 0x28, 0x6C, 0xB9, 0x40, 0x1A, 0x70, 0x87, 0x85, 0x4F, 0xA2, 0x34,
+    0x69, 0x4B, 0x24, 0xCF, 0x7A, 0x2B, 0x24, 0x7A, 0xD2, 0x1B, 0xA2, 0x9F, 0x79, 0x34, 0x20, 0x80,
+    0x0E, 0xDD, 0x87, 0x53, 0x28, 0xF5, 0x46, 0x92, 0x0D, 0x94, 0xFB, 0x1A, 0xF2, 0x4D, 0x2E, 0xEB,
+    0x48, 0x74, 0xA1, 0xC5, 0x64, 0x2B, 0xC3, 0x2C, 0x4B, 0x8D, 0xBA, 0x94, 0xAE, 0x6B, 0xBC, 0x1B,
+    0x6B, 0x7F, 0x97, 0x45, 0x2D, 0x6B, 0x92, 0x85, 0x54, 0x47, 0xB2, 0x2D, 0xBA, 0x54, 0x64, 0x62,
+    0x4C, 0x3F, 0x47, 0x69, 0xE9, 0x9E, 0x6F, 0x6F, 0x05, 0x77, 0xA4, 0x66, 0x20, 0x75, 0x99, 0xD4,
+    0x1D, 0x02, 0xC2, 0xE3, 0x02, 0x5A, 0xB9, 0x9F, 0xFB, 0x04, 0x97, 0xD0, 0xCA, 0x66, 0x0E, 0x3B,
+    0x52, 0x67, 0xF3, 0xE9, 0x16, 0x46, 0x27, 0x75, 0xA3, 0xE5, 0x26, 0x00, 0xE4, 0xD7, 0x85, 0xB9,
+    0xBA, 0xEE, 0x0F, 0x34, 0x4D, 0xD2, 0x3A, 0xB7, 0xE6, 0x48, 0x65, 0xB5, 0xDA, 0xE6, 0x71, 0xE3,
+    0x62, 0xD1, 0xAC, 0xEB, 0x67, 0x5A, 0xBD, 0xD7, 0xB5, 0xB3, 0x4C, 0x56, 0xCE, 0xCA, 0xA2, 0xD6,
+    0x55, 0xB3, 0x66, 0x73, 0xCD, 0xEC, 0x22, 0xD0, 0xBC, 0x5D, 0x31, 0x3C, 0x45, 0x06, 0xDE, 0x71,
+    0x02, 0xFC, 0xA0, 0x95, 0x96, 0xB9, 0x51, 0x09, 0x7A, 0x67, 0xA2, 0xF6, 0x74, 0x45, 0xEB, 0x22,
+    0xD1, 0x7C, 0xC9, 0xAF, 0x3A, 0xB9, 0xD3, 0xB5, 0x26, 0x0F, 0x65, 0xBD, 0xE9, 0xEB, 0xE6, 0x6B,
+    0x17, 0x90, 0x66, 0xF3, 0xD5, 0xD5, 0x4A, 0x57, 0xF2, 0x73, 0xD9, 0xE7, 0x5A, 0x3C, 0x94, 0xB5,
+    0xA0, 0xFD, 0xD5, 0xF9, 0xBF, 0xCF, 0x57, 0xAB, 0x3F, 0xB7, 0x2F, 0x16, 0xFD, 0x97, 0xEF, 0x17,
+    0xC1, 0xFD, 0x82, 0x54, 0x0C, 0xB9, 0x93, 0x12, 0x08, 0xB7, 0x4C, 0x09, 0x25, 0x0E, 0x31, 0x1B,
+    0x69, 0x41, 0xC3, 0x0D, 0xA9, 0x19, 0x48, 0xD6, 0x3D, 0xAE, 0x48, 0xD4, 0x7E, 0xBF, 0xC2, 0x1A,
+    0xDE, 0xD1, 0x42, 0x67, 0xE8, 0x14, 0x93, 0xB2, 0x67, 0xB3, 0xD9, 0x0D, 0xA5, 0xCD, 0x78, 0xEA,
+    0xA4, 0xEE, 0x26, 0x13, 0x88, 0x18, 0x16, 0xAB, 0x20, 0x8D, 0xB0, 0xB1, 0x2D, 0xA9, 0x74, 0x5C,
+    0xFE, 0x99, 0x6E, 0xFD, 0x07, 0x1C, 0x44, 0x03, 0xAF, 0xF2, 0x7D, 0x3A, 0xC4, 0x10, 0x8E, 0x23,
+    0xE7, 0x9D, 0x57, 0x0B, 0xF5, 0xAE, 0x01, 0x65, 0x96, 0x4B, 0x60, 0x00, 0x47, 0x19, 0xBB, 0xC0,
+    0x35, 0x88, 0x29, 0x61, 0x5D, 0x47, 0x53, 0x73, 0xC9, 0xA8, 0x46, 0x93, 0x30, 0x8E, 0x62, 0x0E,
+    0x5F, 0x0E, 0x4E, 0x77, 0xB4, 0x22, 0x4D, 0x09, 0xD0, 0x59, 0x11, 0xC3, 0x2E, 0xA3, 0x5B, 0x71,
+    0xC2, 0xBA, 0x95, 0xC5, 0xFC, 0xCD, 0x69, 0x68, 0xAA, 0x09, 0x1B, 0xC9, 0xD7, 0x5C, 0x0F, 0xE0,
+    0x2B, 0xF4, 0xFE, 0xA9, 0x6C, 0xAB, 0x9D, 0x96, 0x81, 0x9E, 0xC4, 0xF7, 0x99, 0xDF, 0x27, 0xBB,
+    0xF4, 0xF4, 0x12, 0xD7, 0x9F, 0x9A, 0x86, 0xE0, 0xB6, 0x50, 0x3F, 0xA8, 0xB7, 0x8F, 0xDC, 0x37,
+    0x84, 0xFA, 0xBA, 0xC7, 0x53, 0x25, 0x17, 0xC1, 0xEC, 0x00, 0xFA, 0x14, 0x8C, 0x4C, 0x29, 0x3C,
+    0x38, 0x99, 0xCD, 0x6E, 0x9E, 0x47, 0x3D, 0xFB, 0xEE, 0xE1, 0xF0, 0x59, 0x72, 0x3E, 0xB9, 0xD3,
+    0xA9, 0xA7, 0xCB, 0xC4, 0xBF, 0x51, 0x5E, 0x6A, 0x6B, 0xC5, 0xD4, 0x8A, 0xA5, 0x95, 0xA8, 0x5B,
+    0x62, 0xEE, 0xC5, 0x86, 0x95, 0x7D, 0xBD, 0x54, 0x89, 0x35, 0x95, 0xC9, 0x20, 0xB6, 0x54, 0x4C,
+    0xA9, 0x58, 0x52, 0xD9, 0x7E, 0xB0, 0xB2, 0xA3, 0xAF, 0x97, 0xAA, 0x4B, 0x9A, 0x8B, 0x39, 0x6F,
+    0x73, 0x74, 0x07, 0x1B, 0xBF, 0x9E, 0x31, 0x3B, 0xAF, 0x95, 0xAA, 0xF5, 0x65, 0x03, 0x59, 0x77,
+    0xB3, 0x9B, 0xCB, 0x06, 0x1A, 0xC4, 0xCD, 0xE5, 0x90, 0x79, 0x55, 0x7E, 0x9E, 0x43, 0xCB, 0xE0,
+    0x99, 0xC4, 0xDC, 0xAC, 0x0A, 0xAF, 0x2F, 0x0F, 0xCC, 0x55, 0x61, 0x16, 0x67, 0xD3, 0xB3, 0x56,
+    0x8E, 0x48, 0x23, 0x9B, 0xCF, 0x71, 0x68, 0xB9, 0x1B, 0x71, 0x7E, 0xC5, 0x83, 0xFB, 0x0A, 0x8D,
+    0x58, 0x1F, 0x44, 0xB4, 0xCF, 0x9C, 0xC9, 0x5A, 0x5B, 0x95, 0x26, 0xE9, 0xD6, 0xD3, 0xA2, 0x57,
+    0xCE, 0xA7, 0x4F, 0xC2, 0x2C, 0xF7, 0x3E, 0x76, 0x75, 0x6B, 0xDB, 0xB2, 0x91, 0x7D, 0xD9, 0x6B,
+    0x9F, 0x57, 0xDE, 0xE7, 0x0D, 0xBF, 0xEC, 0x9A, 0xD0, 0xE2, 0x2E, 0x98, 0xFA, 0xC7, 0x9A, 0x39,
+    0x88, 0x51, 0x4C, 0xB4, 0x70, 0xF6, 0x33, 0x4E, 0xD8, 0xDF, 0x37, 0x1A, 0xB4, 0x32, 0x38, 0x0A,
+    0x66, 0x1C, 0x87, 0x5C, 0xDE, 0x31, 0xF0, 0x6F, 0x14, 0x54, 0x88, 0xA1, 0x59, 0x23, 0x72, 0x34,
+    0x38, 0xA9, 0x94, 0x3F, 0x14, 0xB2, 0x62, 0x34, 0x7C, 0x22, 0xC4, 0x3D, 0x93, 0x94, 0x99, 0x16,
+    0xF2, 0xAC, 0x14, 0x52, 0x72, 0xD9, 0x53, 0x4A, 0x73, 0xAE, 0xF5, 0x96, 0x4C, 0x77, 0x54, 0x6B,
+    0x3A, 0x73, 0x4F, 0x26, 0x47, 0xAC, 0x79, 0x45, 0xEA, 0x4E, 0x1E, 0x19, 0x4F, 0x0C, 0xA8, 0xD3,
+    0x38, 0x7B, 0xD7, 0xD4, 0xED, 0x39, 0xFB, 0x40, 0x76, 0x6E, 0x30, 0xD5, 0xF8, 0x80, 0x77, 0x5A,
+    0xF7, 0x53, 0xA6, 0x09, 0x30, 0xF2, 0x0F, 0xD0, 0x3E, 0x6C, 0x3E, 0xEB, 0x27, 0x81, 0x93, 0x1D,
+    0x0C, 0x01, 0x43, 0x7D, 0x51, 0x8A, 0x0D, 0xD4, 0x7E, 0x4E, 0xC4, 0x5C, 0x81, 0xAF, 0x56, 0x88,
+    0xF3, 0x73, 0x98, 0xA0, 0x8E, 0x7A, 0x46, 0xF4, 0x99, 0x03, 0xE6, 0xE0, 0xF6, 0x0D, 0xE1, 0x75,
+    0xD2, 0xE4, 0xA5, 0x61, 0xD9, 0xBF, 0x96, 0x2A, 0x10, 0xE4, 0x97, 0x89, 0x08, 0xB5, 0x5E, 0xE7,
+    0xC5, 0x3F, 0xFC, 0x9F, 0xC4, 0xCF, 0x44, 0x4D, 0x9E, 0xD2, 0x11, 0xD0, 0x9F, 0xBC, 0xF8, 0x35,
+    0x8F, 0x7A, 0x5B, 0x95, 0x42, 0x3D, 0xF4, 0x4B, 0x82, 0x4F, 0x5B, 0x69, 0xF0, 0x99, 0x9D, 0x09,
+    0x3E, 0x2F, 0x02, 0xCD, 0x5B, 0x87, 0x0C, 0x3E, 0xE1, 0xD3, 0x35, 0xF8, 0xEC, 0xCE, 0x06, 0x9F,
+    0x5A, 0xF0, 0x79, 0xEB, 0x42, 0xC9, 0xF9, 0x92, 0x68, 0xB9, 0x86, 0xF4, 0xAE, 0xE1, 0x24, 0x50,
+    0x58, 0x57, 0x9C, 0x8E, 0x5F, 0x5D, 0x5B, 0x08, 0xBC, 0x40, 0xBA, 0x61, 0x96, 0x6F, 0x17, 0xC4,
+    0xC3, 0x12, 0xC8, 0x8B, 0x1A, 0xC1, 0x8B, 0x75, 0xE7, 0x33, 0xAF, 0x1D, 0xBC, 0xF0, 0x7B, 0xB1,
+    0x7C, 0xF6, 0x4C, 0x53, 0xCB, 0xCF, 0x77, 0xC9, 0xF2, 0x1F, 0xA9, 0x1D, 0xEA, 0x7C, 0xDE, 0x0D,
+    0x96, 0x4B, 0x61, 0x19, 0x44, 0xD2, 0x01, 0x8E, 0x24, 0xDE, 0xF1, 0xAB, 0x94, 0x64, 0x87, 0xE8,
+    0x9F, 0x09, 0xD3, 0x9F, 0x12, 0x66, 0xC2, 0xCB, 0x9E, 0x40, 0x6E, 0x68, 0xB2, 0x27, 0x73, 0x42,
+    0xC9, 0xE5, 0x73, 0x71, 0xA2, 0x5C, 0xB0, 0x3B, 0xC3, 0xB2, 0x50, 0xAA, 0x19, 0x7B, 0xD4, 0x92,
+    0x65, 0xBF, 0xF2, 0xAF, 0xDB, 0x52, 0x96, 0x1B, 0x79, 0xFC, 0xF6, 0x28, 0xBF, 0x33, 0xC5, 0x6F,
+    0x4D, 0x59, 0x2E, 0x38, 0x9D, 0xDD, 0xE4, 0x29, 0xE5, 0x8F, 0xD6, 0x72, 0x11, 0x55, 0x51, 0xC4,
+    0x9C, 0x5C, 0xEC, 0x47, 0xF8, 0x2B, 0xD9, 0x9D, 0x25, 0xD2, 0x56, 0x3A, 0xD9, 0xF4, 0xE5, 0x7A,
+    0x45, 0x73, 0x09, 0x15, 0x6B, 0x37, 0x49, 0x4D, 0xC9, 0x0D, 0xB4, 0x85, 0x89, 0x6B, 0x65, 0xA3,
+    0xCD, 0xB2, 0xA2, 0xEE, 0x79, 0xF2, 0x55, 0x62, 0xDD, 0x32, 0x16, 0x2A, 0x67, 0xB1, 0x56, 0x8B,
+    0xD2, 0xF6, 0xBC, 0xDD, 0xBC, 0x17, 0x96, 0xA3, 0x1D, 0x65, 0xC8, 0xFA, 0x57, 0x37, 0x74, 0x87,
+    0xEE, 0x42, 0xE2, 0xCF, 0xA4, 0x97, 0xF7, 0xB3, 0xB2, 0x46, 0x54, 0xEC, 0xF2, 0x39, 0x83, 0x74,
+    0x21, 0x39, 0x2A, 0xBC, 0x62, 0xC9, 0x6E, 0xFA, 0x74, 0xC8, 0xE6, 0x6B, 0x68, 0x2E, 0x17, 0xC3,
+    0xC3, 0xB0, 0x32, 0xE7, 0x7F, 0x2E, 0xA6, 0xD6, 0x49, 0xE6, 0x12, 0xBE, 0xB0, 0x19, 0x2A, 0xEF,
+    0xFC, 0x2B, 0x07, 0x67, 0x56, 0xAB, 0x75, 0x24, 0xC7, 0xCC, 0x75, 0x8E, 0x6F, 0x53, 0x62, 0xF2,
+    0x56, 0x70, 0x9E, 0xDC, 0x3E, 0x28, 0xEF, 0x51, 0x1A, 0xEE, 0x0C, 0x68, 0x64, 0x0D, 0x5D, 0xDE,
+    0xD9, 0x02, 0x25, 0x52, 0x5D, 0xE3, 0x7B, 0x05, 0x30, 0x04, 0x2C, 0x56, 0x8E, 0xAC, 0x55, 0x66,
+    0x63, 0x26, 0xC1, 0xAF, 0x95, 0xC0, 0x62, 0x57, 0x3A, 0x3F, 0x16, 0x42, 0xD6, 0x37, 0xC3, 0xF5,
+    0xAB, 0xB2, 0xE9, 0xDA, 0x1E, 0x35, 0xBF, 0x45, 0xAB, 0x96, 0x29, 0x2F, 0x9E, 0x24, 0x1E, 0x4F,
+    0xD7, 0x14, 0x7E, 0x4F, 0xFC, 0xA4, 0x15, 0x4E, 0xAE, 0x89, 0x52, 0x5D, 0x3B, 0xD2, 0xB7, 0xDD,
+    0xE4, 0xCD, 0x06, 0x81, 0xE1, 0xA7, 0x6D, 0xEA, 0x41, 0xE4, 0x1D, 0x20, 0x6C, 0x61, 0xEC, 0xF6,
+    0x2F, 0x0C, 0x1B, 0x9C, 0x7B, 0x9F, 0x6C, 0x0E, 0x7E, 0xD3, 0x83, 0x46, 0x18, 0x52, 0x9F, 0x34,
+    0xB5, 0x84, 0x2E, 0xE5, 0xFC, 0xD3, 0xA0, 0xDE, 0xA9, 0x4F, 0x69, 0x0B, 0xDA, 0xDA, 0x24, 0x5B,
+    0x05, 0xB5, 0x97, 0x0F, 0xB5, 0x40, 0x28, 0xBD, 0x9F, 0x4F, 0x9B, 0x52, 0xAE, 0xDB, 0x47, 0x6B,
+    0x5D, 0x18, 0x73, 0xBA, 0x25, 0x74, 0x73, 0xC3, 0x54, 0x77, 0x76, 0xC3, 0xD4, 0x76, 0x71, 0x8E,
+    0x42, 0x7E, 0xB1, 0xC6, 0xF1, 0x97, 0xE5, 0x5C, 0xBF, 0x8F, 0xDD, 0x56, 0x76, 0xBE, 0x24, 0x3D,
+    0xF3, 0xB0, 0x7A, 0x40, 0xE8, 0x00, 0xD2, 0x02, 0x2B, 0x15, 0xAC, 0x02, 0xEC, 0x6A, 0x03, 0xF0,
+    0x2F, 0xB0, 0xC9, 0x75, 0x8A, 0x00, 0x49, 0xB1, 0x53, 0xE8, 0x6D, 0x0A, 0x17, 0x6E, 0x5C, 0xEC,
+    0x2A, 0x85, 0xDA, 0x14, 0x6B, 0xF1, 0x45, 0x29, 0x53, 0x64, 0x8A, 0xDD, 0x4D, 0x91, 0x22, 0x2A,
+    0x54, 0xC8, 0x2F, 0x85, 0x10, 0x20, 0x85, 0x0B, 0x59, 0x64, 0xE2, 0x22, 0x85, 0x0B, 0x73, 0x63,
+    0x20, 0x5B, 0xB8, 0x30, 0x93, 0x58, 0x8B, 0xC0, 0x8B, 0xAC, 0x98, 0x80, 0x4E, 0x28, 0x89, 0xE4,
+    0xDD, 0xF3, 0x7D, 0xE7, 0xF2, 0x3D, 0xBE, 0xD1, 0xC8, 0x6B, 0xFD, 0x98, 0xF1, 0xCC, 0x64, 0xA0,
+    0x77, 0x0F, 0xF5, 0x1E, 0x79, 0x79, 0xEF, 0x39, 0xE7, 0x9E, 0x7B, 0x7E, 0x5E, 0x63, 0xAE, 0xAE,
+    0xDE, 0x35, 0xF8, 0xCB, 0xEC, 0xB0, 0x05, 0x2F, 0x2C, 0xAE, 0x98, 0xE9, 0x9F, 0x67, 0x0B, 0x42,
+    0xDF, 0x96, 0x84, 0x81, 0xAD, 0x08, 0x67, 0xB6, 0x26, 0x0C, 0x6D, 0xA3, 0x30, 0xEB, 0x08, 0xE3,
+    0x48, 0x61, 0x12, 0xF6, 0x84, 0xD7, 0x43, 0x4B, 0x78, 0x77, 0xAE, 0xB0, 0x0B, 0xEC, 0x12, 0xDD,
+    0x36, 0x01, 0x3B, 0x0E, 0x6A, 0xED, 0x38, 0xA8, 0x0D, 0x3B, 0x9E, 0x97, 0x86, 0x1D, 0x87, 0x85,
+    0xC9, 0xD1, 0x71, 0x64, 0xAD, 0x6D, 0xD1, 0xAD, 0x40, 0x74, 0x9C, 0xC8, 0x25, 0x3A, 0xBE, 0x8E,
+    0x9F, 0x04, 0xF6, 0x18, 0x01, 0xBA, 0x95, 0x47, 0x6D, 0x6A, 0xBC, 0x0E, 0x23, 0x2C, 0x4C, 0xD0,
+    0x02, 0x96, 0x66, 0xDE, 0x61, 0xA4, 0x8D, 0xB1, 0xD2, 0xA9, 0xF4, 0xB0, 0x86, 0xE6, 0x32, 0xA7,
+    0x9F, 0x70, 0xD2, 0xDA, 0x4E, 0x27, 0xBE, 0xB3, 0x4A, 0xA5, 0xCD, 0x6D, 0x8F, 0x5E, 0x1E, 0xC8,
+    0x80, 0xE7, 0xD6, 0x97, 0x5E, 0xE7, 0x3D, 0x06, 0x39, 0xEB, 0x38, 0xC4, 0xDB, 0x3A, 0xD0, 0x49,
+    0x7B, 0x11, 0xBD, 0xFB, 0x16, 0x6D, 0x68, 0xF7, 0xA5, 0x95, 0x91, 0x4A, 0x9B, 0xF0, 0xFE, 0xAC,
+    0xDD, 0xB4, 0x49, 0xEB, 0xF1, 0xFB, 0x00, 0xF7, 0x0C, 0x6F, 0xE5, 0xAD, 0xDC, 0xDF, 0x25, 0x36,
+    0xF5, 0x6D, 0x2D, 0xAD, 0xB9, 0xA0, 0x83, 0xF8, 0xA1, 0x39, 0xA7, 0x98, 0x33, 0xB1, 0x52, 0x28,
+    0xCD, 0x15, 0xB3, 0xB6, 0x77, 0x98, 0x6F, 0xB7, 0x28, 0x63, 0x5E, 0x31, 0xFF, 0x1F, 0x28, 0x77,
+    0xD3, 0x7C, 0x47, 0x9E, 0x6A, 0xD1, 0x8F, 0x19, 0xF0, 0x94, 0xB0, 0x6E, 0xC7, 0xF7, 0xD4, 0x9C,
+    0x1C, 0xC6, 0x68, 0x5E, 0x35, 0x27, 0x8B, 0x96, 0x67, 0x94, 0x16, 0x1C, 0x6A, 0xAA, 0x33, 0xD4,
+    0x01, 0x9B, 0x40, 0x27, 0x62, 0xE6, 0x3A, 0x31, 0x13, 0x8E, 0x70, 0xFC, 0xDE, 0xDE, 0x75, 0x18,
+    0x70, 0x0F, 0x60, 0x80, 0x5F, 0x37, 0x8D, 0xDE, 0x27, 0x2D, 0xD8, 0x71, 0x44, 0x42, 0x25, 0xDA,
+    0x2E, 0x27, 0xD7, 0x43, 0x45, 0x44, 0x56, 0xA4, 0xE2, 0x3E, 0xBE, 0x3A, 0xB7, 0xE2, 0x0F, 0x9C,
+    0x47, 0xA6, 0xA3, 0xC2, 0x03, 0x41, 0xBF, 0x99, 0xBF, 0x97, 0x6E, 0x18, 0x31, 0xB7, 0x9F, 0x61,
+    0xFA, 0xC0, 0x5B, 0xF6, 0xF0, 0x4D, 0x5B, 0x78, 0xF8, 0x57, 0xCE, 0xE4, 0xBF, 0x79, 0x15, 0x8A,
+    0x04, 0xCA, 0xCA, 0x48, 0x9E, 0x4C, 0x52, 0x74, 0x78, 0xDE, 0x28, 0x23, 0xE4, 0xED, 0xA6, 0x55,
+    0x16, 0x79, 0x5A, 0x3B, 0xBD, 0x53, 0x9F, 0xD5, 0x81, 0x91, 0xCE, 0x4A, 0xDD, 0xFD, 0xB9, 0x8C,
+    0xCF, 0xAF, 0x80, 0x85, 0xA8, 0x94, 0xE1, 0xFC, 0x9D, 0xA0, 0x38, 0xE2, 0x78, 0x3C, 0x8B, 0xB1,
+    0x19, 0x8F, 0x12, 0x70, 0x17, 0xC4, 0xE0, 0x03, 0x64, 0xC2, 0x04, 0x33, 0x16, 0x2C, 0x19, 0x9F,
+    0xFD, 0xED, 0xAD, 0xC5, 0x0B, 0x6E, 0x8B, 0x85, 0x64, 0xF2, 0xB0, 0x5D, 0xCE, 0xAC, 0x4C, 0x47,
+    0x66, 0x61, 0x4B, 0x79, 0x28, 0x2F, 0x62, 0x69, 0xD2, 0xA4, 0x35, 0x57, 0x04, 0xF7, 0xE8, 0xE3,
+    0xA9, 0x0D, 0x57, 0x2E, 0x9A, 0x68, 0x30, 0x5E, 0x11, 0xDA, 0x74, 0x56, 0x06, 0xF6, 0x7E, 0x5E,
+    0x80, 0xBF, 0x52, 0x19, 0x1D, 0x6E, 0x5A, 0xE0, 0x75, 0x17, 0x6F, 0x2B, 0x15, 0x14, 0x93, 0x20,
+    0xC2, 0x00, 0xC2, 0xCC, 0x1A, 0x30, 0x58, 0x58, 0xF8, 0x72, 0xE3, 0x0E, 0xF0, 0x76, 0xCA, 0xB0,
+    0xED, 0x03, 0x8B, 0x33, 0x2C, 0xE2, 0x10, 0x2C, 0x9D, 0x7C, 0x28, 0x5D, 0x5A, 0xAF, 0x37, 0x32,
+    0x9F, 0x04, 0xC8, 0xDE, 0xF9, 0x7A, 0xB0, 0xBD, 0xCB, 0x59, 0x46, 0x9C, 0x4D, 0x3C, 0x6C, 0xDA,
+    0x90, 0xB3, 0xF4, 0xF6, 0xCD, 0x81, 0xBF, 0xD3, 0xC2, 0xDB, 0xF7, 0x28, 0x79, 0x96, 0x0E, 0xE5,
+    0x6C, 0x02, 0xF0, 0xB6, 0x79, 0x7B, 0x7B, 0xEB, 0x3C, 0x56, 0x6C, 0x5F, 0x4C, 0x45, 0xB8, 0x99,
+    0xB0, 0x9A, 0xC9, 0x64, 0x83, 0x2E, 0x82, 0x20, 0xB7, 0xF9, 0x92, 0x1B, 0x9B, 0x19, 0xBB, 0x30,
+    0x3B, 0x7B, 0xA7, 0x0D, 0xDB, 0xFE, 0x4D, 0xCC, 0xAC, 0x37, 0xA2, 0xB5, 0x64, 0x7F, 0x21, 0x3D,
+    0xC4, 0x0F, 0x1A, 0x8C, 0xBA, 0xD4, 0xBD, 0xC5, 0x31, 0xDA, 0xF1, 0x63, 0xFB, 0xDC, 0xD2, 0xFC,
+    0x08, 0xD2, 0xBE, 0xA1, 0x3C, 0xF3, 0x7A, 0xDD, 0xA0, 0xF2, 0x5C, 0xA5, 0x3C, 0x99, 0xC1, 0x84,
+    0xAA, 0x0B, 0x7B, 0x57, 0xA6, 0x38, 0xB7, 0x8F, 0xE4, 0x37, 0xE9, 0x0C, 0xBB, 0xD4, 0xCC, 0x7E,
+    0x7E, 0x47, 0x26, 0x21, 0xBB, 0xAE, 0x27, 0x48, 0x13, 0xE4, 0xE3, 0xFD, 0x00, 0xB2, 0x9D, 0x02,
+    0xC8, 0xEB, 0x01, 0x66, 0x24, 0x0C, 0xE6, 0xAB, 0xA0, 0x54, 0x50, 0x01, 0xF8, 0x5F, 0x02, 0x82,
+    0x11, 0x94, 0x93, 0xC7, 0x5D, 0x67, 0x82, 0x7A, 0x7D, 0x03, 0x5F, 0x24, 0xCB, 0x12, 0x40, 0xE8,
+    0xC4, 0xB1, 0xD4, 0x72, 0xD7, 0xFD, 0x6B, 0x42, 0x1C, 0x37, 0x4E, 0x00, 0x2E, 0x56, 0x7F, 0xF5,
+    0xAE, 0x77, 0x1B, 0xE3, 0x1E, 0x02, 0x99, 0xB6, 0x9F, 0x0F, 0xB3, 0x96, 0xA8, 0xE2, 0x36, 0x15,
+    0x0E, 0x61, 0xA9, 0x60, 0x49, 0xF0, 0x8D, 0x35, 0x0E, 0x76, 0x7F, 0x42, 0x90, 0x5B, 0x80, 0xC0,
+    0xDA, 0x4F, 0x07, 0x90, 0xF0, 0x67, 0x50, 0x98, 0xE5, 0x9B, 0x6C, 0x20, 0xCA, 0x21, 0x94, 0x65,
+    0xFA, 0x90, 0x10, 0x42, 0x8A, 0x68, 0x0B, 0x90, 0x1D, 0xB7, 0x40, 0xB2, 0x06, 0xD3, 0x3B, 0xF5,
+    0x71, 0xD7, 0x99, 0xCC, 0x0D, 0x22, 0x7E, 0x6E, 0xFF, 0xF5, 0xB1, 0xD0, 0x43, 0x76, 0xF8, 0x0F,
+    0x40, 0xBD, 0x6C, 0x08, 0x00, 0xBC, 0xBD, 0x97, 0x4E, 0x0E, 0xC1, 0x3A, 0x30, 0x2F, 0x7D, 0xD6,
+    0x1B, 0xE0, 0xBE, 0x3C, 0x32, 0x72, 0x50, 0xFB, 0x03, 0x72, 0x85, 0x18, 0x46, 0xD9, 0x76, 0xC4,
+    0xFA, 0xEA, 0x8E, 0xBD, 0xCD, 0x9B, 0x85, 0x54, 0x8B, 0xB7, 0x86, 0x2B, 0xEE, 0x7B, 0x6F, 0x8F,
+    0x68, 0x1C, 0xA4, 0x15, 0x9C, 0x7C, 0x34, 0x00, 0x41, 0xD2, 0x83, 0xBC, 0x5A, 0x08, 0xA1, 0xA8,
+    0x53, 0x3C, 0x2A, 0x52, 0xB5, 0x55, 0xAC, 0x4F, 0xDB, 0x64, 0x6C, 0xA3, 0xF1, 0x7E, 0x7D, 0x16,
+    0xFD, 0x58, 0x87, 0xF4, 0x40, 0x71, 0xAE, 0x28, 0x57, 0x8C, 0x9F, 0x5B, 0xAD, 0x96, 0x20, 0x8D,
+    0xEE, 0x55, 0x68, 0x77, 0x16, 0x8B, 0xC9, 0xEA, 0x90, 0xA5, 0x8B, 0xC6, 0x16, 0x42, 0x8C, 0x55,
+    0x5E, 0x40, 0x21, 0x8D, 0x88, 0xA1, 0x70, 0xD2, 0xCE, 0xD9, 0x1A, 0x73, 0x58, 0x5B, 0xB1, 0xB5,
+    0x24, 0xA0, 0xB6, 0xD5, 0x53, 0xEE, 0xDC, 0x6E, 0xBD, 0x86, 0x2B, 0x47, 0x5B, 0x2A, 0xC2, 0x41,
+    0x2D, 0x2B, 0x7F, 0xF1, 0x56, 0xCD, 0xF1, 0xB8, 0x56, 0x2C, 0xBE, 0x15, 0xD6, 0xB7, 0x75, 0xCD,
+    0xC6, 0xDC, 0xF3, 0xAE, 0x52, 0xFC, 0xB4, 0xC4, 0xB8, 0xCC, 0xFC, 0x7B, 0x14, 0x3F, 0x79, 0x2D,
+    0xE2, 0x27, 0xAB, 0x81, 0x9A, 0x56, 0x70, 0xA5, 0x8D, 0x28, 0x8D, 0xD6, 0xBA, 0xE6, 0xE1, 0x62,
+    0x71, 0xE5, 0x30, 0xF1, 0x03, 0x1A, 0xD5, 0xC2, 0x15, 0x18, 0xC4, 0xC3, 0x6B, 0x15, 0x3A, 0x85,
+    0x70, 0x84, 0xF0, 0xBC, 0x20, 0x2F, 0xBA, 0x68, 0x7C, 0xE1, 0x80, 0x48, 0xA4, 0x13, 0x44, 0x3E,
+    0xB4, 0x4D, 0x11, 0xE4, 0x4B, 0x2E, 0xAE, 0x8D, 0xD8, 0xF5, 0xCC, 0x29, 0x42, 0xEC, 0x2D, 0x99,
+    0x93, 0x58, 0x0E, 0xA2, 0xAE, 0x64, 0xDF, 0xC3, 0x52, 0x06, 0xD7, 0x46, 0xD8, 0x4A, 0x02, 0xF6,
+    0xB4, 0xB6, 0x4A, 0x8F, 0x17, 0xCF, 0x26, 0xE2, 0x42, 0xCB, 0x9E, 0xD8, 0xD2, 0x12, 0xCA, 0xFB,
+    0xDD, 0xF4, 0xA0, 0x02, 0x73, 0xE2, 0xF1, 0x4C, 0xE5, 0xC5, 0x57, 0x95, 0xA5, 0x74, 0x8D, 0x47,
+    0x8B, 0xE3, 0x5B, 0xDB, 0xCA, 0xCB, 0x71, 0xE2, 0xF9, 0x34, 0xE0, 0xCD, 0x78, 0x24, 0x3C, 0xF7,
+    0x38, 0x13, 0xEB, 0x3E, 0x9F, 0xAA, 0x47, 0x85, 0xAD, 0x5A, 0x79, 0x8F, 0x4A, 0x1A, 0xC8, 0x68,
+    0x77, 0x05, 0xAB, 0x47, 0x80, 0xC5, 0x6A, 0xC4, 0xE2, 0x9D, 0x0A, 0x78, 0x1B, 0xB1, 0x18, 0x61,
+    0xB6, 0x31, 0x06, 0x41, 0xFF, 0xCE, 0x40, 0xAD, 0x84, 0x53, 0xA4, 0x4E, 0xF6, 0xAB, 0x14, 0xDC,
+    0x29, 0xCD, 0x25, 0xF9, 0xE5, 0x32, 0xB4, 0x2A, 0x99, 0x03, 0xE6, 0x12, 0xD6, 0x18, 0x79, 0x30,
+    0xF0, 0x01, 0xB5, 0xA6, 0x69, 0xEC, 0x9B, 0x0B, 0x7B, 0xA7, 0x87, 0xAB, 0xBD, 0x5B, 0x1B, 0x25,
+    0xF1, 0x06, 0x04, 0x87, 0x2A, 0x89, 0xD5, 0x93, 0x4A, 0xE2, 0xF1, 0x4A, 0x8F, 0xDD, 0x95, 0xF3,
+    0xCB, 0x90, 0x39, 0x94, 0x2D, 0x4C, 0xF6, 0x57, 0x94, 0x1D, 0x3D, 0x35, 0xC7, 0xA0, 0x21, 0xBD,
+    0xC4, 0xC2, 0xDF, 0x99, 0x2C, 0xBE, 0x6B, 0xDC, 0xD2, 0x67, 0xD2, 0x5D, 0x05, 0x6B, 0x75, 0x61,
+    0x3B, 0x22, 0x4C, 0x74, 0x67, 0x98, 0x1D, 0x61, 0x4F, 0xFD, 0x79, 0xDE, 0xD1, 0xB4, 0x9A, 0xD1,
+    0x57, 0x01, 0x61, 0xAF, 0x0A, 0x36, 0xF6, 0xE7, 0x8D, 0x9C, 0x72, 0xDA, 0xF8, 0x93, 0x40, 0x36,
+    0xE2, 0x7D, 0x01, 0xB2, 0x07, 0x57, 0x72, 0xE7, 0xAE, 0x10, 0x18, 0x0F, 0x24, 0x3D, 0x95, 0x75,
+    0xE9, 0x29, 0x51, 0x00, 0x75, 0x5D, 0x00, 0xDE, 0x27, 0x00, 0x7E, 0xB1, 0x04, 0x5A, 0x49, 0xC5,
+    0xDF, 0xF3, 0x21, 0xC5, 0xDD, 0xA1, 0xFA, 0x85, 0xBC, 0xDC, 0x0E, 0x5C, 0x0A, 0x0B, 0x33, 0x9A,
+    0xA4, 0x42, 0x83, 0x62, 0xED, 0xEF, 0xA0, 0x55, 0x4A, 0xB3, 0xD4, 0xD9, 0xA5, 0x9B, 0x49, 0x5F,
+    0x95, 0xFF, 0xBC, 0xFB, 0x86, 0x74, 0x9E, 0x01, 0x83, 0xBE, 0x7D, 0x60, 0xDF, 0x5A, 0xCE, 0x06,
+    0xCF, 0xFE, 0x11, 0x4C, 0x45, 0xE9, 0x42, 0xDA, 0xBC, 0x84, 0x23, 0x21, 0xAF, 0x5C, 0xAB, 0xDF,
+    0xE8, 0xAF, 0x70, 0xF0, 0x14, 0x82, 0x99, 0xBF, 0xB6, 0x64, 0x56, 0xBA, 0x1B, 0xA0, 0x20, 0xE9,
+    0x82, 0x55, 0x57, 0xD2, 0xBC, 0x55, 0xB7, 0x11, 0xB4, 0xF8, 0x80, 0x0B, 0xDA, 0xA3, 0x66, 0x24,
+    0x83, 0x16, 0x72, 0x45, 0xC3, 0x4A, 0xD4, 0xA7, 0x4C, 0xD4, 0x31, 0x61, 0x86, 0xA5, 0xAC, 0x06,
+    0xF8, 0x60, 0x82, 0x9E, 0xAD, 0xBE, 0xBA, 0x11, 0x32, 0xFC, 0x40, 0xA6, 0xA1, 0x3D, 0x98, 0x3F,
+    0x1D, 0xB0, 0x2F, 0x78, 0x37, 0xCD, 0xB7, 0x31, 0xD5, 0xC6, 0xDC, 0xDD, 0x50, 0x54, 0x46, 0xD0,
+    0xA8, 0x11, 0x50, 0xE9, 0x2B, 0x75, 0x8F, 0x78, 0xD5, 0x9C, 0x2D, 0xFA, 0xD2, 0x81, 0x2A, 0x18,
+    0x7E, 0x67, 0xE2, 0x40, 0x6D, 0x9F, 0xE6, 0x40, 0x3D, 0xA5, 0xF4, 0x35, 0xDE, 0x43, 0xE7, 0x6D,
+    0x74, 0xCB, 0x38, 0x9D, 0x80, 0x99, 0xF3, 0x5C, 0xBE, 0x6D, 0x9E, 0xFC, 0x3B, 0x03, 0xF4, 0xF5,
+    0xD4, 0x9B, 0x69, 0x37, 0xAB, 0x78, 0xAE, 0x7E, 0x49, 0x7B, 0xC8, 0xAC, 0x4F, 0x2B, 0x7D, 0xCF,
+    0x0E, 0xB9, 0xC6, 0x3F, 0x5F, 0xE3, 0x71, 0x81, 0x8E, 0x6D, 0xD6, 0x4C, 0xBD, 0xE8, 0xA1, 0x46,
+    0x0F, 0x22, 0x15, 0x48, 0x4E, 0xF4, 0xFA, 0x44, 0xC4, 0xBC, 0x3C, 0xE8, 0xB5, 0xA6, 0xEB, 0xC8,
+    0xD8, 0xAD, 0x37, 0x9C, 0x5A, 0x32, 0xAF, 0x96, 0x5B, 0xF1, 0x92, 0xB9, 0xA3, 0x4B, 0xF4, 0x1F,
+    0x2E, 0x3E, 0xE2, 0x62, 0x62, 0xBD, 0xD3, 0xEB, 0xF6, 0x0E, 0x78, 0xDC, 0x6D, 0x9A, 0xAB, 0x02,
+    0xB4, 0x54, 0xD7, 0x52, 0x63, 0x2E, 0xC9, 0x07, 0x64, 0x81, 0xFA, 0xEC, 0x11, 0x16, 0x2F, 0x00,
+    0xA9, 0x59, 0x4D, 0xE0, 0x8B, 0xF6, 0xA7, 0x70, 0x1C, 0x1F, 0xC6, 0x3B, 0xD3, 0x58, 0xCB, 0x72,
+    0xFA, 0x31, 0xE7, 0x6E, 0x6B, 0xE8, 0xC5, 0xBA, 0xD0, 0xAD, 0x52, 0x3C, 0x66, 0x08, 0xA8, 0x55,
+    0x97, 0x4E, 0x49, 0xC9, 0xEE, 0x5C, 0xE2, 0x97, 0x15, 0x8D, 0x99, 0xAA, 0x31, 0x4E, 0x9B, 0x71,
+    0xB1, 0x28, 0xEF, 0xCB, 0xC1, 0xC5, 0x3D, 0x80, 0x7F, 0x01, 0xD1, 0x3D, 0xFB, 0xA9, 0x73, 0xF1,
+    0xDD, 0x81, 0x82, 0x6C, 0xDB, 0x19, 0xC7, 0x5C, 0x2B, 0x2A, 0xA9, 0xE2, 0x79, 0xEA, 0x29, 0x59,
+    0x83, 0xF2, 0x39, 0x41, 0xA5, 0xA8, 0x68, 0x18, 0xB7, 0xB1, 0xA2, 0xEC, 0xC1, 0x37, 0x41, 0x10,
+    0x5B, 0x5B, 0xCA, 0xA7, 0x4A, 0xDC, 0xC7, 0x13, 0xEE, 0xDA, 0x85, 0xDE, 0x86, 0x55, 0x09, 0xEE,
+    0xC0, 0xAA, 0xC6, 0x4E, 0xE6, 0xE0, 0x65, 0x3B, 0xAC, 0x56, 0x76, 0xB8, 0x99, 0x59, 0x55, 0x38,
+    0x2F, 0xE4, 0xA2, 0x12, 0xDA, 0x2F, 0xF6, 0x0E, 0xDE, 0xB7, 0x81, 0xCE, 0x6A, 0x58, 0xC3, 0xA7,
+    0xDD, 0xF7, 0x8C, 0xD0, 0x8D, 0xCF, 0xA3, 0x9F, 0xB3, 0x33, 0xC9, 0x64, 0x0E, 0xF8, 0x6C, 0x93,
+    0xE8, 0xBB, 0x87, 0x91, 0xE8, 0xAA, 0x7D, 0x74, 0x5B, 0xB9, 0x9A, 0x6A, 0xAA, 0xBD, 0x7F, 0x65,
+    0x8B, 0x52, 0x3B, 0x29, 0xC0, 0xCF, 0x29, 0x61, 0xEC, 0x27, 0x4A, 0xA9, 0x07, 0x96, 0x94, 0xEA,
+    0xD6, 0x94, 0x2A, 0x5E, 0x1A, 0xA5, 0x9E, 0x4E, 0x22, 0xD1, 0xE9, 0x5F, 0x15, 0x39, 0x28, 0x1A,
+    0xF8, 0x2F, 0x5B, 0xF9, 0xAA, 0xEE, 0x44, 0x8B, 0x6C, 0x7C, 0x30, 0xE9, 0x2B, 0x8E, 0x6D, 0x11,
+    0x77, 0x13, 0xDD, 0x7F, 0x24, 0x5B, 0xF6, 0x12, 0x3F, 0xD2, 0x1F, 0xFA, 0x4D, 0xC6, 0x77, 0x1C,
+    0x32, 0x96, 0xD6, 0xDB, 0x8C, 0x85, 0xC2, 0x44, 0xC8, 0x42, 0x87, 0x05, 0xD9, 0xE7, 0x79, 0x3E,
+    0xFA, 0xCE, 0x48, 0xC8, 0x18, 0x91, 0x94, 0x2B, 0xFA, 0x98, 0xF0, 0xB9, 0xE0, 0x7C, 0x64, 0xB0,
+    0xF7, 0xD4, 0x0A, 0x53, 0xF1, 0xE3, 0xBD, 0xC4, 0x0F, 0xFA, 0xD3, 0xF0, 0xAC, 0xBE, 0x03, 0xA9,
+    0x1D, 0x99, 0x8C, 0x07, 0x9F, 0x69, 0x56, 0x03, 0x78, 0x2B, 0x53, 0x3F, 0xA6, 0xF1, 0x9E, 0xEB,
+    0xA3, 0xEF, 0x11, 0x3C, 0x2E, 0xF1, 0xF9, 0xA1, 0x39, 0x97, 0xBE, 0x23, 0x9B, 0x12, 0x84, 0x70,
+    0x4C, 0x47, 0xA4, 0xEE, 0x78, 0x23, 0x6A, 0x8F, 0x73, 0xCE, 0x48, 0x96, 0x40, 0xA2, 0x04, 0x92,
+    0x24, 0x90, 0x20, 0x81, 0xE4, 0x08, 0xAE, 0x9E, 0x49, 0x52, 0xC4, 0xCB, 0x9E, 0xFF, 0x71, 0xCE,
+    0xCF, 0x5C, 0x92, 0xB9, 0x64, 0x1A, 0x66, 0x87, 0x8A, 0xC0, 0xD0, 0x3C, 0xC3, 0xF4, 0xBF, 0x96,
+    0xFB, 0xE1, 0x3A, 0x17, 0x85, 0xF7, 0x7A, 0x6A, 0x5C, 0x10, 0x41, 0xE9, 0x00, 0xE5, 0x6F, 0xDB,
+    0x37, 0xF4, 0xD2, 0x71, 0x40, 0xCD, 0xE3, 0x9E, 0x1B, 0x57, 0x3B, 0x1D, 0xD7, 0x7F, 0x7D, 0xE5,
+    0x71, 0x1D, 0x2B, 0x1E, 0x8F, 0x86, 0x0F, 0xFE, 0x49, 0xD3, 0x22, 0xEC, 0x07, 0x80, 0x33, 0xCA,
+    0x93, 0xCF, 0xDC, 0xBB, 0x0B, 0x77, 0xFF, 0xF2, 0xC4, 0x41, 0xDF, 0x41, 0x55, 0x33, 0x18, 0xA4,
+    0x28, 0xA6, 0xD0, 0x6C, 0xCC, 0xC1, 0x09, 0x4C, 0xA7, 0x86, 0xD5, 0x18, 0x29, 0x1B, 0x55, 0x6A,
+    0xCF, 0xE9, 0x67, 0xB1, 0xBB, 0x3D, 0xFE, 0x4F, 0x66, 0xAF, 0xA4, 0xC2, 0xBE, 0x8C, 0xCA, 0xB4,
+    0x78, 0x67, 0xD6, 0x69, 0x0B, 0x3E, 0x48, 0x1A, 0x70, 0xC2, 0x41, 0x6F, 0xAC, 0xA3, 0x92, 0x2C,
+    0x62, 0x6D, 0x41, 0xA9, 0xBC, 0xD5, 0x1E, 0x5E, 0x5E, 0x2B, 0xBA, 0x79, 0x8B, 0xB9, 0x27, 0xD8,
+    0x19, 0x96, 0x63, 0x6B, 0x46, 0x67, 0xD1, 0xD8, 0x36, 0x1B, 0x3F, 0xB2, 0x7A, 0x13, 0xB9, 0xE3,
+    0x5E, 0xE2, 0x0C, 0x35, 0x74, 0x93, 0x8B, 0xAE, 0x0A, 0x95, 0x0C, 0xFA, 0x18, 0x94, 0x31, 0xD1,
+    0xC4, 0xA0, 0x86, 0x85, 0x95, 0xD7, 0x8D, 0x39, 0x09, 0xA2, 0xD6, 0x76, 0x21, 0xF4, 0xE1, 0x4C,
+    0x14, 0x67, 0x84, 0x7A, 0x8E, 0xFC, 0xD3, 0x9B, 0xD1, 0x26, 0x19, 0x55, 0x10, 0xF0, 0x22, 0x96,
+    0x24, 0x43, 0x50, 0xAB, 0x7D, 0x68, 0x02, 0x4C, 0xC3, 0x09, 0xFF, 0x7B, 0x10, 0xF5, 0x39, 0x4B,
+    0xEF, 0x89, 0xD6, 0x78, 0x7E, 0xA2, 0x40, 0xBF, 0xF8, 0xBE, 0xF8, 0x25, 0x9F, 0xBC, 0xE6, 0x98,
+    0x20, 0xA3, 0xDF, 0x12, 0x9E, 0x62, 0x74, 0x6C, 0x9F, 0xB2, 0x40, 0xD6, 0x52, 0x69, 0x15, 0x70,
+    0x95, 0x0D, 0x29, 0xD8, 0x25, 0xAE, 0x35, 0xAE, 0x57, 0x68, 0x80, 0x8D, 0x64, 0xF0, 0xA8, 0x94,
+    0x96, 0x30, 0x40, 0x04, 0x84, 0xF4, 0x87, 0x97, 0x09, 0xD5, 0xA0, 0x52, 0xBD, 0xA2, 0x1F, 0x2B,
+    0xF8, 0xC4, 0x3A, 0x27, 0x66, 0xA1, 0x80, 0x77, 0xFE, 0x2F, 0xA8, 0x29, 0x5C, 0xA0, 0x0A, 0x53,
+    0x99, 0xF5, 0xFA, 0xB8, 0xD5, 0xCE, 0xB8, 0x4E, 0xCA, 0x39, 0x97, 0x6F, 0x19, 0xD0, 0x9C, 0x61,
+    0x70, 0x11, 0x63, 0xB1, 0x30, 0x2F, 0xA1, 0xF5, 0xA4, 0xE8, 0x32, 0xB2, 0x2D, 0x80, 0xE7, 0xEC,
+    0xC8, 0xE9, 0xDF, 0x4A, 0x71, 0xA9, 0x6B, 0xC5, 0xD3, 0xA5, 0xA2, 0xAE, 0x26, 0xA4, 0x6A, 0x71,
+    0x3D, 0x69, 0x3E, 0x18, 0x91, 0xAE, 0x2A, 0xA0, 0x6A, 0x80, 0xAA, 0xA3, 0xFB, 0xBF, 0xD5, 0xCB,
+    0xEA, 0xC6, 0xDC, 0xB2, 0x6D, 0x38, 0x54, 0x84, 0x3A, 0x83, 0x96, 0x93, 0xA8, 0xF8, 0x2B, 0x67,
+    0x92, 0x53, 0x8D, 0xEF, 0x47, 0x6C, 0x40, 0x35, 0x4C, 0x1D, 0x4A, 0x3C, 0xFB, 0x88, 0xF3, 0xAB,
+    0x34, 0x76, 0x9A, 0x31, 0x74, 0x1A, 0x5B, 0x87, 0x06, 0xF9, 0x7E, 0x46, 0x4A, 0xF8, 0xB6, 0x51,
+    0x69, 0x87, 0x76, 0x5C, 0xFF, 0x6B, 0xEB, 0xF5, 0xF6, 0xC6, 0x78, 0x55, 0xDB, 0x55, 0xE3, 0xEA,
+    0x6A, 0xB9, 0xAA, 0xE1, 0xBA, 0x33, 0x5D, 0xDB, 0x09, 0xD7, 0xB6, 0x8C, 0x39, 0xF8, 0x6D, 0x63,
+    0x26, 0x91, 0x3F, 0xE9, 0x75, 0xCC, 0x66, 0x3D, 0xE6, 0xC7, 0x94, 0xC4, 0xFF, 0xA6, 0x94, 0xC9,
+    0x39, 0xE6, 0x04, 0xAA, 0x75, 0xC9, 0x98, 0x6F, 0x15, 0x72, 0x3F, 0x09, 0x38, 0xE6, 0x3F, 0xB7,
+    0x1C, 0xF3, 0x25, 0xE4, 0x7D, 0x72, 0x9C, 0x79, 0xBD, 0xCE, 0xC9, 0x0B, 0x86, 0x8D, 0xF5, 0xAA,
+    0x56, 0xF4, 0xCE, 0xF6, 0xCE, 0x64, 0xD4, 0x37, 0xEC, 0x4C, 0x4F, 0xDF, 0x79, 0xBF, 0x8F, 0xA8,
+    0xDD, 0x63, 0xDB, 0x6C, 0x5A, 0xAF, 0xE6, 0x2E, 0x56, 0xD3, 0x24, 0xAC, 0x67, 0x4F, 0x46, 0x37,
+    0x3C, 0x59, 0xC8, 0x50, 0xEB, 0x41, 0x90, 0x10, 0x8E, 0x89, 0x52, 0xE3, 0x08, 0xE7, 0x95, 0x9F,
+    0xC0, 0x4D, 0x31, 0xF7, 0xDE, 0xE7, 0xDD, 0xEB, 0x9E, 0x5D, 0x27, 0x3A, 0xE1, 0x18, 0xDB, 0xFA,
+    0xBB, 0x78, 0x93, 0xDB, 0x54, 0x35, 0x49, 0xF4, 0x23, 0xAF, 0x5E, 0xD7, 0x34, 0x4B, 0x33, 0xA6,
+    0xBC, 0x7D, 0x1D, 0xB8, 0xDC, 0x38, 0xE9, 0x96, 0xEA, 0xCF, 0xB1, 0xAA, 0x67, 0x21, 0xD7, 0x0D,
+    0xE2, 0xC3, 0x4B, 0x95, 0x43, 0xE3, 0x0A, 0xF8, 0x4E, 0x4A, 0xE0, 0x3B, 0x59, 0x72, 0x6F, 0x65,
+    0x5F, 0xEF, 0xB3, 0x6D, 0xBF, 0x66, 0x7C, 0x0B, 0xE6, 0x2E, 0x2F, 0xB1, 0xD4, 0x0B, 0xC1, 0x5D,
+    0x26, 0xB2, 0x5C, 0x96, 0xB5, 0xCC, 0x16, 0x0B, 0xF6, 0xE7, 0x5C, 0xF1, 0xFB, 0x2A, 0xC8, 0x8E,
+    0xA8, 0xA9, 0x34, 0x75, 0x95, 0x48, 0xD5, 0xE6, 0x45, 0x59, 0xF4, 0x7A, 0xAA, 0x46, 0xB3, 0xC7,
+    0x1C, 0x91, 0x75, 0x6B, 0x90, 0x0F, 0x52, 0x89, 0x36, 0xF3, 0x52, 0x50, 0xE6, 0xF6, 0x01, 0x6E,
+    0x03, 0xFE, 0x73, 0x23, 0x20, 0x46, 0x6E, 0x4A, 0x2E, 0x6F, 0x2B, 0xB9, 0x37, 0xB0, 0xC9, 0xF0,
+    0xDF, 0xDD, 0xF4, 0xA8, 0x51, 0xF6, 0xFB, 0x68, 0xFF, 0x9D, 0xB2, 0xDB, 0x72, 0x7F, 0xB6, 0xDC,
+    0x97, 0xDB, 0xF5, 0x3D, 0x33, 0x0D, 0x2D, 0xB1, 0xCD, 0xD9, 0xFE, 0xFD, 0x0B, 0xA2, 0xEC, 0xD9,
+    0xD6, 0xE7, 0x2F, 0x52, 0x8C, 0x09, 0x36, 0xCA, 0x98, 0x33, 0x14, 0x42, 0xBF, 0x90, 0xCF, 0x6B,
+    0xF2, 0xF9, 0xDD, 0xAF, 0xB6, 0x3E, 0x21, 0x7D, 0xCD, 0x18, 0xAB, 0x34, 0x73, 0xDD, 0xE1, 0x23,
+    0x55, 0x04, 0x12, 0xDD, 0xDA, 0xEF, 0x19, 0xB3, 0x95, 0x37, 0x8B, 0xD9, 0x22, 0xC1, 0x79, 0xB0,
+    0x7C, 0xA5, 0x65, 0x0A, 0x78, 0x56, 0xFA, 0x40, 0x0D, 0xE8, 0xD5, 0x63, 0xBB, 0xF4, 0xE0, 0xBE,
+    0x21, 0x28, 0x00, 0xFE, 0x4F, 0xDE, 0x2C, 0xA0, 0x81, 0x42, 0x26, 0x40, 0x76, 0x68, 0x80, 0x78,
+    0x20, 0x08, 0x6D, 0x0A, 0x20, 0xDA, 0x1D, 0x80, 0x6F, 0x6B, 0x00, 0xD1, 0xD9, 0x08, 0x92, 0x8E,
+    0x20, 0xB2, 0x04, 0x73, 0xFB, 0xB7, 0x00, 0x81, 0x7D, 0x00, 0xC0, 0xF9, 0x37, 0x8C, 0x2E, 0x03,
+    0x24, 0x0A, 0xA4, 0x3B, 0x9F, 0x31, 0xD8, 0x74, 0x46, 0x3B, 0x2E, 0xA5, 0xCC, 0x74, 0x80, 0x11,
+    0xF3, 0x8B, 0xEF, 0x4E, 0x55, 0xFE, 0x5C, 0x25, 0xAA, 0x8A, 0x2B, 0xCD, 0x7D, 0x1E, 0xDD, 0xD6,
+    0xDE, 0xB6, 0x5A, 0x0F, 0x57, 0x62, 0x22, 0x7A, 0x1D, 0x1C, 0xE6, 0xF6, 0x43, 0xCC, 0x30, 0x18,
+    0x5D, 0x89, 0xDD, 0xDA, 0x33, 0x45, 0xE0, 0x1D, 0x8B, 0x2B, 0xF1, 0xB4, 0xD3, 0xE1, 0x70, 0x5D,
+    0x53, 0xC1, 0x30, 0x4D, 0xCA, 0x77, 0x39, 0xF9, 0x41, 0xB5, 0x45, 0x95, 0x93, 0x46, 0x8E, 0x83,
+    0x7F, 0xAA, 0x52, 0x9A, 0x59, 0xBB, 0x15, 0x09, 0xD1, 0x39, 0xA8, 0xA6, 0xE6, 0x0A, 0x63, 0x46,
+    0x1F, 0xCF, 0x6D, 0xE4, 0x76, 0xC2, 0x4B, 0xC2, 0xBC, 0xFD, 0xB8, 0x64, 0x97, 0xE1, 0xE3, 0x4E,
+    0x57, 0xA8, 0xE6, 0xE3, 0xBB, 0x38, 0xC2, 0x22, 0x3D, 0x23, 0xAB, 0x51, 0x66, 0x7C, 0x9B, 0xB5,
+    0x0B, 0x70, 0xBC, 0x18, 0xDF, 0x65, 0xB3, 0xDA, 0xAD, 0x6C, 0x56, 0xCD, 0x2C, 0x34, 0x3B, 0x57,
+    0x4E, 0xF4, 0x6A, 0x9C, 0xB9, 0xB8, 0x5E, 0xDC, 0x6C, 0x79, 0x14, 0xD6, 0x50, 0x93, 0xD1, 0x0D,
+    0xCA, 0x41, 0x36, 0xBC, 0x7D, 0x55, 0x6C, 0x18, 0xB1, 0xBE, 0xE6, 0xB0, 0x64, 0x65, 0x27, 0x88,
+    0x65, 0x36, 0x71, 0x21, 0xD4, 0x14, 0xBB, 0xFC, 0x3A, 0x42, 0x27, 0xA1, 0x15, 0xC1, 0x2B, 0xB3,
+    0x61, 0x2C, 0x3F, 0x80, 0x49, 0x40, 0xB8, 0x1C, 0x61, 0xF0, 0x32, 0xE0, 0x0C, 0x90, 0xB9, 0x91,
+    0x65, 0xA0, 0xFB, 0x64, 0xCF, 0xEA, 0x16, 0x85, 0x47, 0xC3, 0x5F, 0x81, 0xF2, 0x97, 0xE7, 0xF8,
+    0x2B, 0x6F, 0x95, 0xBF, 0x7A, 0x82, 0x50, 0xF9, 0x6B, 0xA6, 0xFC, 0xE5, 0x3B, 0xC6, 0xB2, 0x5B,
+    0x8C, 0x15, 0x29, 0x98, 0x2B, 0x7F, 0x05, 0xCA, 0x5F, 0x9E, 0x63, 0xAC, 0x5C, 0x81, 0xAA, 0xC2,
+    0x63, 0xD8, 0xD1, 0x01, 0x57, 0xEF, 0x93, 0x98, 0x29, 0xB8, 0x37, 0x25, 0x8D, 0x7A, 0x4C, 0x4C,
+    0xB2, 0xEF, 0xD8, 0x4C, 0xB9, 0x4C, 0x99, 0x4C, 0x79, 0x4C, 0x59, 0x4C, 0x39, 0x4C, 0x19, 0x6C,
+    0xAD, 0x52, 0x29, 0xA7, 0x3C, 0xE3, 0xBF, 0x8A, 0x86, 0x6F, 0x43, 0x23, 0x58, 0x98, 0xA9, 0x24,
+    0x4B, 0x1D, 0x6E, 0x2E, 0xFB, 0x6A, 0xF5, 0xB1, 0x55, 0x67, 0xD6, 0xB5, 0x61, 0x13, 0xF0, 0x45,
+    0x5C, 0xD6, 0x5F, 0xAD, 0x6E, 0xF2, 0x46, 0x8A, 0x0C, 0x07, 0xCC, 0x62, 0x31, 0xD9, 0xC1, 0xBD,
+    0x9C, 0x7D, 0x45, 0x96, 0xE1, 0xE7, 0xFC, 0xE1, 0x9F, 0x30, 0x68, 0x57, 0x60, 0x2F, 0x44, 0x9F,
+    0x71, 0x47, 0xBF, 0x98, 0x7C, 0xE0, 0x81, 0x11, 0xCB, 0x2C, 0x61, 0x01, 0x15, 0x63, 0xC0, 0xF2,
+    0xE6, 0xBC, 0x9D, 0x02, 0x97, 0x29, 0xF9, 0x65, 0x20, 0x6F, 0xA6, 0x0F, 0x64, 0x0A, 0xB4, 0xCF,
+    0x65, 0xCC, 0x9A, 0xAD, 0xF1, 0x7D, 0xB0, 0x02, 0xE5, 0x1B, 0x4C, 0x2F, 0xA3, 0xE3, 0x66, 0x57,
+    0xB5, 0x48, 0x8A, 0x57, 0x5F, 0x73, 0xF3, 0x5D, 0x5A, 0x3B, 0xF3, 0x61, 0x35, 0x17, 0xD6, 0xB5,
+    0xD3, 0x58, 0x81, 0x77, 0x75, 0x8F, 0x5E, 0x88, 0x61, 0x34, 0xB8, 0x85, 0x43, 0x64, 0x76, 0x21,
+    0x93, 0x85, 0xA3, 0x0E, 0xA1, 0x75, 0x9D, 0xA5, 0xC6, 0xBC, 0x93, 0x96, 0xD3, 0xFC, 0xF2, 0x96,
+    0x77, 0xEA, 0x53, 0xF2, 0xB8, 0x74, 0xA2, 0x3F, 0xC9, 0xDA, 0x81, 0x0E, 0xA1, 0x3A, 0xE6, 0x25,
+    0x2D, 0x6E, 0x64, 0xD9, 0x9C, 0xBF, 0x34, 0xB7, 0xB8, 0x6D, 0x81, 0x51, 0x4D, 0xD0, 0xCE, 0xD4,
+    0x6A, 0x57, 0x11, 0x9E, 0xAB, 0xCA, 0xE5, 0x64, 0x9B, 0x99, 0xEE, 0x87, 0x67, 0x81, 0x3A, 0x5A,
+    0xFC, 0xF9, 0x0E, 0x57, 0x9B, 0x06, 0xB9, 0x63, 0x62, 0x46, 0x8B, 0x3E, 0x55, 0xFB, 0x9E, 0xC6,
+    0x36, 0x4E, 0x02, 0xBD, 0xCC, 0xB9, 0x5B, 0x97, 0xB1, 0x72, 0xE2, 0x9A, 0xDB, 0x4F, 0x56, 0x70,
+    0x79, 0xD9, 0x37, 0x98, 0xCC, 0xD8, 0xD3, 0x2B, 0x14, 0x34, 0xCC, 0xC2, 0xF4, 0xD2, 0x9D, 0x33,
+    0x46, 0x2F, 0x6F, 0xB5, 0xFB, 0x2E, 0x9C, 0x49, 0x28, 0x90, 0x9A, 0x77, 0x11, 0x6A, 0xD2, 0x6A,
+    0xF8, 0x13, 0x92, 0x02, 0xB4, 0xCB, 0xB8, 0x59, 0x9D, 0x9F, 0x18, 0x01, 0x27, 0x82, 0x5E, 0x13,
+    0x02, 0x58, 0x7A, 0x45, 0x23, 0x0D, 0x92, 0x57, 0x24, 0xC2, 0xA3, 0x55, 0x5E, 0x81, 0x0C, 0x22,
+    0xFF, 0xE6, 0x15, 0x08, 0x21, 0xBD, 0x04, 0xAC, 0x2F, 0xE2, 0x05, 0x88, 0xC1, 0x0B, 0x26, 0xB8,
+    0xD4, 0xAE, 0x58, 0x88, 0x17, 0x40, 0xED, 0xF6, 0x05, 0x50, 0xCF, 0xE4, 0x54, 0x5E, 0xC0, 0x0F,
+    0xBE, 0x7D, 0xB1, 0xFE, 0xA9, 0x76, 0x59, 0xAC, 0xDB, 0x8F, 0x67, 0xE3, 0xC5, 0xFA, 0x5D, 0xB1,
+    0xBB, 0xB8, 0xEB, 0xC6, 0x63, 0x3A, 0x10, 0x8B, 0x17, 0x81, 0xB2, 0x8E, 0xD7, 0x91, 0x60, 0x5F,
+    0x2C, 0xDE, 0xEC, 0x48, 0x32, 0x66, 0xA3, 0xF8, 0xE3, 0xC5, 0xBA, 0xB6, 0x07, 0x79, 0xA5, 0xDF,
+    0xFC, 0x09, 0x69, 0xD1, 0xF9, 0x1A, 0x2D, 0xB7, 0xF6, 0xFB, 0x96, 0xAE, 0xF1, 0x34, 0xB3, 0xB5,
+    0xE2, 0x53, 0xCC, 0x4A, 0x45, 0x69, 0x08, 0x5D, 0x82, 0x48, 0x86, 0x12, 0xA1, 0x38, 0x4F, 0x05,
+    0x39, 0x24, 0xC1, 0xFA, 0x02, 0x39, 0x2C, 0xDB, 0x17, 0x3F, 0x5D, 0x2C, 0x94, 0x4C, 0xA9, 0x06,
+    0x16, 0xDC, 0x45, 0xE7, 0x32, 0x4C, 0xD9, 0x61, 0x21, 0x0B, 0x1A, 0x6F, 0x11, 0x42, 0xFC, 0x0E,
+    0x69, 0x27, 0x18, 0xB9, 0x4E, 0xF2, 0xD9, 0xE1, 0x6F, 0x7A, 0xA2, 0xEB, 0x8F, 0x99, 0x40, 0x84,
+    0x62, 0xA6, 0x9C, 0xCF, 0x2D, 0xC6, 0x7A, 0x18, 0x73, 0xF5, 0x96, 0xD9, 0x54, 0xC7, 0xFA, 0x6A,
+    0x8D, 0xCD, 0x86, 0x69, 0xE9, 0x6D, 0xAC, 0x0E, 0xA5, 0xF3, 0xE6, 0x69, 0x45, 0x4D, 0x97, 0xEC,
+    0xFD, 0x3B, 0x1A, 0x16, 0x0A, 0x5C, 0xF4, 0x4C, 0xDD, 0xC2, 0xC6, 0xAA, 0x0F, 0x29, 0x3F, 0x14,
+    0x34, 0x93, 0x3B, 0x5D, 0xD4, 0x6D, 0xE6, 0xD0, 0xD8, 0x2B, 0x73, 0x57, 0x00, 0xF7, 0x9D, 0xB7,
+    0x3D, 0xA3, 0xB7, 0xBD, 0x4A, 0xF8, 0x5B, 0x15, 0xD1, 0xA1, 0x5B, 0xA9, 0xB7, 0xBD, 0x72, 0xC1,
+    0xB2, 0x60, 0x7C, 0xAD, 0x7A, 0xDB, 0xF3, 0x8E, 0x49, 0x30, 0xEA, 0x6D, 0x5F, 0x86, 0xB4, 0xF8,
+    0x97, 0x1E, 0x48, 0xCD, 0x02, 0x5C, 0xEE, 0x00, 0x54, 0x39, 0xF2, 0xD2, 0x25, 0x4D, 0x53, 0x17,
+    0x9E, 0x1A, 0x9F, 0x17, 0xD3, 0xC4, 0xDE, 0x40, 0x42, 0xC0, 0x87, 0x50, 0x3C, 0x3E, 0xB2, 0x9D,
+    0x28, 0x5E, 0x91, 0x34, 0x6D, 0x88, 0xCA, 0xE0, 0x39, 0x2B, 0x75, 0xD4, 0x36, 0x70, 0xCD, 0x33,
+    0x38, 0x96, 0x12, 0xCB, 0x70, 0x22, 0x22, 0x54, 0xA7, 0x1B, 0x9B, 0xDB, 0x7F, 0xBB, 0x6A, 0x7D,
+    0xCD, 0x9B, 0x69, 0x15, 0x77, 0x54, 0x4E, 0x39, 0xC9, 0xE9, 0x7E, 0xE7, 0x8F, 0x15, 0xC9, 0x93,
+    0xBF, 0xCB, 0xB4, 0xF6, 0xB0, 0xD5, 0xE4, 0xE9, 0x68, 0xF2, 0x42, 0xCE, 0xFA, 0xF5, 0x5A, 0x23,
+    0xF8, 0x0E, 0xF3, 0xE5, 0x65, 0xC0, 0x1C, 0xB9, 0x66, 0xCC, 0xBB, 0x94, 0xF9, 0x31, 0x67, 0x7E,
+    0x74, 0x60, 0x5C, 0xD8, 0x3B, 0x23, 0xEB, 0x62, 0x4C, 0xA9, 0xCF, 0x04, 0x6D, 0x37, 0xC6, 0x5A,
+    0x9C, 0xC3, 0x52, 0xEA, 0x8F, 0x91, 0x64, 0x70, 0x93, 0x05, 0x5A, 0x72, 0x6B, 0x34, 0x4E, 0xA1,
+    0xEE, 0xB1, 0x7C, 0x4B, 0x22, 0x5D, 0x72, 0xE9, 0xFD, 0xCB, 0x60, 0x78, 0x43, 0x26, 0xDF, 0x20,
+    0xB3, 0x5F, 0x26, 0x58, 0x27, 0xB5, 0x89, 0xD8, 0x14, 0xB2, 0xCE, 0x5F, 0x51, 0x8B, 0x30, 0x81,
+    0x88, 0xE3, 0xD4, 0x42, 0x48, 0xED, 0x80, 0x82, 0x31, 0xD7, 0x52, 0x4F, 0x5A, 0x9A, 0x18, 0xFA,
+    0x9C, 0xDA, 0x92, 0x4C, 0x0B, 0x12, 0x56, 0x54, 0xA9, 0xB0, 0x17, 0x93, 0x39, 0xEC, 0x44, 0x3D,
+    0x99, 0xA3, 0x09, 0xDB, 0xAC, 0x16, 0x6D, 0x45, 0x70, 0x9E, 0x97, 0xC8, 0xCD, 0x74, 0xD5, 0xAB,
+    0xBA, 0x35, 0xC0, 0xCB, 0xC5, 0xED, 0xA6, 0x62, 0x95, 0x0D, 0x3C, 0x5B, 0xF3, 0x6A, 0x13, 0x1D,
+    0xDA, 0xBD, 0x85, 0xCD, 0xA4, 0x0C, 0x87, 0xBC, 0x49, 0xAA, 0x79, 0x97, 0x14, 0x41, 0x97, 0x15,
+    0x7E, 0x93, 0x55, 0x5E, 0x8A, 0x48, 0x22, 0xFC, 0x9A, 0xB2, 0xEB, 0xA4, 0x48, 0x1B, 0xF5, 0x31,
+    0x36, 0xD6, 0x16, 0xE4, 0xC3, 0x37, 0x64, 0x4C, 0x90, 0xE9, 0xB9, 0xF1, 0x87, 0x3C, 0x0D, 0xFA,
+    0xAC, 0x9C, 0xB7, 0xC8, 0x53, 0x9A, 0x61, 0xE4, 0x60, 0x41, 0x6F, 0xB5, 0x74, 0xB5, 0x3D, 0x2C,
+    0x08, 0x8F, 0x3F, 0x46, 0xFC, 0x36, 0x1D, 0xB0, 0x9D, 0xC9, 0xB2, 0xDB, 0x14, 0x84, 0x9F, 0x24,
+    0x5C, 0xA1, 0x36, 0x3F, 0x61, 0x79, 0xA3, 0xF1, 0xFB, 0xA4, 0x40, 0x4D, 0x3E, 0x2A, 0xF2, 0x77,
+    0x46, 0xAF, 0xE7, 0x51, 0xE1, 0xEA, 0x44, 0x21, 0x82, 0x82, 0xF2, 0xE1, 0x3A, 0xAE, 0x08, 0x15,
+    0x50, 0x9D, 0x56, 0x90, 0x9D, 0xDF, 0xBA, 0x56, 0x41, 0xC3, 0x28, 0x9C, 0x1B, 0xE3, 0x28, 0x10,
+    0x82, 0x7A, 0x37, 0x78, 0xC7, 0xC2, 0xDE, 0xED, 0x82, 0xF0, 0x11, 0xCA, 0xE7, 0x67, 0x72, 0xCD,
+    0xE8, 0x7A, 0x85, 0xC4, 0xBC, 0x73, 0x4B, 0x91, 0x93, 0x94, 0x0C, 0xF0, 0x3C, 0x3C, 0x6E, 0xDD,
+    0x11, 0x24, 0x07, 0x24, 0xC3, 0x09, 0x62, 0x2E, 0x14, 0xC7, 0x87, 0x15, 0xFC, 0x5B, 0xB1, 0x88,
+    0xA3, 0x7C, 0xC9, 0xA2, 0x63, 0xBC, 0x78, 0x2C, 0x88, 0x3F, 0x22, 0xE6, 0x62, 0xFA, 0xE7, 0xA0,
+    0xC0, 0x9A, 0xEC, 0xF3, 0x7C, 0x58, 0x59, 0x11, 0x57, 0xA8, 0x34, 0x32, 0xEF, 0x2B, 0xB8, 0x0B,
+    0x10, 0x8F, 0xE0, 0x6D, 0x80, 0x73, 0xEB, 0x7A, 0xFD, 0x63, 0x00, 0x49, 0xEF, 0x82, 0xE9, 0x9A,
+    0xAC, 0xC1, 0xED, 0xCC, 0x01, 0x13, 0xA8, 0x83, 0x74, 0xF6, 0xD9, 0x56, 0xB6, 0x4E, 0xEE, 0x36,
+    0x6E, 0xFD, 0x51, 0x8F, 0x37, 0xF9, 0xA9, 0x3A, 0x09, 0xDD, 0xF1, 0x4F, 0x39, 0x1F, 0x98, 0x17,
+    0x5A, 0x2E, 0x87, 0x8C, 0xE2, 0x44, 0x83, 0x1F, 0x63, 0xD2, 0xE6, 0x37, 0xED, 0xFD, 0xBD, 0xE7,
+    0x09, 0x6E, 0x52, 0x33, 0xB5, 0xC3, 0x3F, 0xC8, 0x70, 0xE1, 0x00, 0xAD, 0x8D, 0xFF, 0x99, 0xCB,
+    0x16, 0x03, 0xFF, 0x60, 0x17, 0xC7, 0x16, 0x2D, 0x9F, 0xDF, 0x13, 0x7E, 0x80, 0xE3, 0x32, 0x6E,
+    0xC7, 0x93, 0x11, 0xDC, 0xD1, 0x08, 0xE3, 0xD9, 0x08, 0xEE, 0x70, 0x04, 0x37, 0xEF, 0x11, 0x19,
+    0xD3, 0xF3, 0x11, 0x4E, 0x39, 0xED, 0xCC, 0xC5, 0xE5, 0x48, 0xA4, 0xCC, 0x95, 0x05, 0xCE, 0x4B,
+    0x1C, 0xD1, 0x53, 0x42, 0xF7, 0x2F, 0xF7, 0xDD, 0xDE, 0x09, 0xA4, 0x7E, 0xD7, 0xAA, 0x1F, 0xB5,
+    0x36, 0xA0, 0xCB, 0x8B, 0x87, 0x4A, 0xD5, 0x7E, 0xB0, 0xC3, 0x7B, 0xAE, 0x28, 0x88, 0xEB, 0x1A,
+    0x72, 0xE1, 0x48, 0x50, 0xBA, 0xC8, 0x7A, 0x88, 0x1C, 0x16, 0x29, 0x8A, 0x8E, 0x20, 0x7D, 0xA6,
+    0x2F, 0x01, 0xA5, 0x5A, 0x47, 0xAF, 0x07, 0x1E, 0x39, 0xF0, 0x8C, 0xFC, 0x7C, 0xD9, 0x7E, 0xBE,
+    0x8F, 0x9C, 0x6C, 0xF9, 0x2D, 0xFD, 0xCA, 0xFC, 0x6C, 0xAE, 0x68, 0x4D, 0x06, 0xED, 0xFA, 0x81,
+    0xDB, 0x41, 0x66, 0x7F, 0x51, 0xEB, 0xFC, 0x80, 0xDA, 0x96, 0xF2, 0xDF, 0xAB, 0x7D, 0xB7, 0x18,
+    0x5F, 0x9D, 0xF2, 0x6B, 0x29, 0x62, 0x29, 0x63, 0xFE, 0x70, 0x3F, 0x63, 0x86, 0xB8, 0x9E, 0xE0,
+    0x94, 0x98, 0xAF, 0x0B, 0xC0, 0x08, 0xBF, 0xAE, 0x36, 0x7D, 0xCF, 0x73, 0x77, 0x7C, 0x16, 0xB0,
+    0xDC, 0xBF, 0xC6, 0xDD, 0x42, 0x33, 0x29, 0xAF, 0xB9, 0x93, 0xC8, 0x74, 0xDF, 0xF8, 0x11, 0xFD,
+    0x51, 0xA2, 0xE3, 0xBE, 0x4E, 0xC4, 0x3F, 0x7C, 0x5F, 0x53, 0xBD, 0xB9, 0x47, 0x50, 0x23, 0x34,
+    0xAF, 0xD1, 0x44, 0x3B, 0xF4, 0x2F, 0x81, 0xEB, 0xB6, 0x1C, 0x01, 0x73, 0x82, 0x88, 0x67, 0xFF,
+    0x85, 0xA2, 0x0D, 0x23, 0x70, 0x09, 0xEF, 0x81, 0xD2, 0x4D, 0x41, 0x83, 0x70, 0xAF, 0x6C, 0x54,
+    0x03, 0x27, 0x8C, 0x1C, 0x2E, 0x9E, 0x4E, 0xC2, 0xB3, 0x85, 0x9C, 0x6F, 0xE0, 0xDC, 0x8A, 0x0C,
+    0x19, 0x69, 0xAC, 0xD7, 0x81, 0xC9, 0xA9, 0x07, 0x67, 0x83, 0x70, 0xBB, 0x2B, 0x06, 0xB1, 0x67,
+    0xAA, 0xAA, 0x3B, 0xE0, 0x2D, 0x16, 0xE9, 0xA9, 0xA0, 0xD1, 0xB7, 0x35, 0x79, 0xF4, 0x75, 0xC3,
+    0xB3, 0x4B, 0x92, 0x65, 0xE6, 0x28, 0xA6, 0xDB, 0x5E, 0x37, 0x0D, 0xFA, 0x6D, 0xA5, 0x82, 0x9F,
+    0x05, 0xC2, 0x2D, 0xCD, 0x4D, 0x0A, 0x37, 0x1A, 0xBC, 0xB3, 0x86, 0xDA, 0x66, 0xE0, 0x2C, 0x2E,
+    0x97, 0x3F, 0x14, 0xF7, 0x4F, 0xFA, 0xC7, 0x4F, 0x30, 0x35, 0x5D, 0x5A, 0xB8, 0xAB, 0x7B, 0x99,
+    0xFF, 0x4A, 0x33, 0x09, 0x53, 0xAD, 0xDF, 0xD7, 0x5A, 0xDD, 0x30, 0x7D, 0x8F, 0xE0, 0x97, 0xCD,
+    0xB4, 0x30, 0xEC, 0xEA, 0x19, 0xA3, 0xAD, 0xD9, 0x55, 0x7D, 0xC6, 0x9D, 0x07, 0x38, 0xD0, 0x50,
+    0xF6, 0xEA, 0x30, 0xA5, 0x7F, 0x83, 0xC0, 0xFD, 0xCF, 0xF4, 0x99, 0xDE, 0xA9, 0x4F, 0xEF, 0xEE,
+    0x9F, 0x12, 0x4A, 0xAF, 0x6E, 0xAC, 0xB8, 0x36, 0xFF, 0x60, 0xA0, 0x4B, 0x86, 0x19, 0x98, 0xB3,
+    0x96, 0x66, 0x53, 0x58, 0x51, 0xF9, 0x89, 0x97, 0xF7, 0xD4, 0x3D, 0x70, 0xFE, 0x8C, 0xD1, 0xF6,
+    0xF2, 0xCD, 0xAB, 0x14, 0x56, 0x95, 0xE6, 0x90, 0xDF, 0xD0, 0xEC, 0x64, 0x26, 0xCF, 0x06, 0x1D,
+    0x5D, 0x6D, 0x73, 0x9E, 0x0C, 0x73, 0x20, 0x4E, 0x72, 0x62, 0xA9, 0x09, 0x5D, 0x29, 0xB4, 0x03,
+    0xD4, 0x29, 0x51, 0xB8, 0x76, 0xED, 0x90, 0x7A, 0x79, 0x49, 0xEF, 0xBD, 0x98, 0x7A, 0x40, 0xCF,
+    0xB1, 0x80, 0xCC, 0x81, 0x96, 0x79, 0x21, 0x48, 0xDE, 0x4F, 0xD4, 0x52, 0xD4, 0x53, 0x2E, 0x3D,
+    0x86, 0x76, 0xEE, 0xBF, 0xD9, 0x32, 0x74, 0xE3, 0x92, 0xAC, 0xD5, 0xE8, 0x89, 0xA7, 0x99, 0x5A,
+    0x63, 0xCE, 0x4C, 0xBB, 0x05, 0xDC, 0x97, 0xF6, 0xD7, 0xBA, 0xA1, 0xB8, 0xE7, 0x1E, 0x9E, 0x54,
+    0xAA, 0xF8, 0xCD, 0xB4, 0x6E, 0xD8, 0xC5, 0xF1, 0xB5, 0x54, 0xD6, 0x65, 0xA3, 0x8F, 0x89, 0x42,
+    0xF9, 0x63, 0x97, 0x2A, 0x52, 0x4C, 0xCB, 0x3C, 0xDC, 0xF1, 0x17, 0x93, 0xA2, 0xF9, 0xC9, 0x4D,
+    0x7C, 0xEC, 0xFB, 0xA3, 0xC7, 0xD8, 0xEB, 0x1D, 0x72, 0x98, 0x94, 0x7A, 0x6F, 0xFC, 0x36, 0xDD,
+    0x0A, 0x34, 0xE8, 0x8E, 0x24, 0x3D, 0xDD, 0x42, 0x50, 0x84, 0xAE, 0x05, 0x0F, 0x21, 0x0F, 0x4B,
+    0x0B, 0xC3, 0xEF, 0x59, 0x13, 0x80, 0x79, 0x21, 0x1D, 0x3B, 0x2E, 0x5C, 0xF5, 0x2B, 0x3D, 0xCD,
+    0x1E, 0x8B, 0x82, 0x53, 0x46, 0x42, 0x79, 0xD2, 0x67, 0x41, 0xC7, 0x33, 0x8E, 0x9E, 0x73, 0x97,
+    0xC2, 0x68, 0x31, 0xF2, 0x32, 0x55, 0x5C, 0x26, 0xF2, 0xCB, 0xFB, 0x1A, 0x5B, 0x79, 0x5D, 0x38,
+    0xA3, 0xD3, 0x4D, 0xF0, 0x1D, 0xE1, 0x07, 0x77, 0x38, 0x5C, 0x97, 0x74, 0xD4, 0xCE, 0x51, 0x16,
+    0x18, 0xF5, 0xDC, 0x3B, 0xE7, 0xD6, 0x6B, 0xC2, 0x21, 0xD0, 0xF3, 0x0F, 0x6E, 0x08, 0x13, 0x33,
+    0x55, 0x2A, 0xB0, 0x1F, 0xD4, 0x33, 0xFB, 0x87, 0xAC, 0xAA, 0xB5, 0xFF, 0x2C, 0xD8, 0xFF, 0xCB,
+    0x82, 0x7B, 0xD3, 0x27, 0x42, 0x8F, 0x8F, 0x88, 0x09, 0xFB, 0xA0, 0xF0, 0xEC, 0xA7, 0xCB, 0x71,
+    0xBF, 0xB5, 0x8A, 0x2A, 0x9C, 0xD6, 0x92, 0xDB, 0xB5, 0x7D, 0xE7, 0xEC, 0x54, 0x9E, 0x92, 0xE6,
+    0xF8, 0xA6, 0x5F, 0x6F, 0xCC, 0x38, 0x62, 0x53, 0x0F, 0x55, 0x24, 0x08, 0xC7, 0xE4, 0x16, 0x57,
+    0xF7, 0xEC, 0xCE, 0x50, 0x32, 0xCE, 0x1B, 0xC8, 0x87, 0x3F, 0x76, 0xF7, 0x64, 0xA9, 0xA3, 0x64,
+    0x37, 0x3A, 0xE4, 0xF7, 0xCC, 0xCE, 0x53, 0x94, 0x6B, 0x2B, 0x0A, 0x52, 0x66, 0x0B, 0x5C, 0x64,
+    0xB8, 0xC0, 0xB6, 0xC9, 0x94, 0x0F, 0x38, 0xAB, 0xEC, 0x12, 0x09, 0x62, 0x60, 0xB6, 0x02, 0x28,
+    0x20, 0x9F, 0x01, 0x01, 0xB9, 0x70, 0x5A, 0x85, 0x02, 0x85, 0xAC, 0x9E, 0xDB, 0x1A, 0x36, 0x54,
+    0xD2, 0x84, 0x79, 0x03, 0x45, 0x2B, 0x6E, 0xA3, 0xB8, 0xC5, 0xF6, 0x13, 0x75, 0x71, 0xD8, 0xC5,
+    0x1C, 0xFD, 0x6B, 0x61, 0x4F, 0xCD, 0xBF, 0xFF, 0xF1, 0x7C, 0x78, 0x8D, 0xD1, 0xA7, 0xBB, 0x81,
+    0xFD, 0x31, 0xE7, 0xD0, 0x04, 0x3C, 0xF5, 0x35, 0x40, 0xC2, 0x87, 0x66, 0x8F, 0xD6, 0x9B, 0x5A,
+    0x1A, 0x77, 0xA0, 0x6B, 0xE1, 0x8C, 0x03, 0x31, 0xEE, 0xD5, 0x3F, 0xB1, 0x3E, 0x82, 0x25, 0x9D,
+    0xF0, 0x9E, 0xF2, 0x9D, 0xE3, 0x39, 0xC7, 0x6F, 0x5B, 0xBC, 0x66, 0x59, 0xF3, 0x5D, 0x6B, 0xA9,
+    0x74, 0x1D, 0xD9, 0x87, 0x08, 0x15, 0xC3, 0x73, 0x2E, 0x4C, 0x86, 0xD7, 0x42, 0x38, 0x23, 0xB8,
+    0xD7, 0x90, 0x6F, 0x30, 0x5F, 0x61, 0x14, 0xCC, 0x2D, 0x1E, 0xA8, 0x42, 0x22, 0x84, 0xAA, 0x47,
+    0x26, 0xBC, 0xAE, 0x79, 0x22, 0x77, 0x55, 0x83, 0xD4, 0x83, 0x13, 0xFF, 0x87, 0x63, 0xCD, 0x1E,
+    0x57, 0x93, 0x21, 0x45, 0xBA, 0x66, 0xC2, 0xF1, 0xA8, 0x89, 0xAF, 0x0A, 0x68, 0x0E, 0xF2, 0x4C,
+    0x80, 0x0D, 0x30, 0x57, 0x6F, 0xAE, 0x93, 0x51, 0xF4, 0x84, 0xDC, 0xF9, 0x17, 0x96, 0x12, 0x0A,
+    0xCE, 0x9A, 0x8C, 0xD5, 0xFE, 0xE7, 0x0F, 0xE6, 0x55, 0x8A, 0x8D, 0x15, 0xD9, 0x4A, 0x2C, 0xDD,
+    0x88, 0x11, 0x03, 0xCF, 0x72, 0xBD, 0x74, 0xF4, 0xAC, 0x20, 0xE4, 0x59, 0x30, 0xBB, 0xAC, 0x24,
+    0x6D, 0x6B, 0x10, 0x36, 0xAB, 0x41, 0xD5, 0xA4, 0x85, 0x78, 0x88, 0x3B, 0xCC, 0x3A, 0xEA, 0x22,
+    0x16, 0x73, 0x25, 0x5C, 0x01, 0xAF, 0xF1, 0xED, 0x77, 0x49, 0xA8, 0xE9, 0x81, 0x91, 0x3A, 0xF9,
+    0x69, 0xAE, 0xFC, 0x24, 0x63, 0x3E, 0xDF, 0xD4, 0xB8, 0x68, 0x1E, 0x10, 0x13, 0xB9, 0xBE, 0xEB,
+    0xB2, 0x7C, 0x59, 0xDF, 0xB2, 0x37, 0x35, 0x7C, 0x3D, 0x77, 0x8C, 0x8E, 0x65, 0x05, 0x86, 0x03,
+    0xFE, 0xA0, 0x19, 0xA4, 0x6F, 0x9B, 0x5B, 0xE6, 0x10, 0xF1, 0x71, 0x8A, 0x09, 0x6B, 0x56, 0x4A,
+    0xD9, 0x6A, 0x3C, 0x81, 0x14, 0xA7, 0x2A, 0xAC, 0x23, 0x6B, 0xEA, 0x8A, 0x3B, 0x3F, 0x29, 0x49,
+    0xB6, 0x5A, 0xE7, 0x2E, 0x3B, 0x6B, 0xFC, 0x68, 0x75, 0x47, 0xAE, 0x0B, 0x84, 0x8A, 0x45, 0x08,
+    0xC6, 0x9C, 0x47, 0xD2, 0xA3, 0x45, 0xBA, 0x1B, 0xCB, 0xB8, 0x46, 0x45, 0x78, 0x3C, 0xB5, 0x27,
+    0xDD, 0x9C, 0x95, 0xDB, 0x4D, 0x18, 0x4A, 0x05, 0x5C, 0xB1, 0x3E, 0xD8, 0x48, 0x0F, 0x10, 0x50,
+    0xCD, 0x11, 0xC1, 0xAC, 0x5B, 0x44, 0x24, 0x4A, 0x72, 0xA4, 0x85, 0xA4, 0x0D, 0x1A, 0x44, 0xA2,
+    0x66, 0x4D, 0x32, 0x2C, 0x16, 0xD7, 0x6A, 0x2D, 0x89, 0x1F, 0x0B, 0xE3, 0xFD, 0xD5, 0xD2, 0xA5,
+    0x50, 0xF1, 0x90, 0xEA, 0xB8, 0x1E, 0xFD, 0x55, 0xFD, 0x81, 0x7C, 0x67, 0x45, 0x42, 0x83, 0xA6,
+    0x0E, 0xBF, 0xF8, 0x81, 0x30, 0xA9, 0xC8, 0x9F, 0x22, 0x4C, 0xE7, 0x22, 0xFD, 0x5D, 0xF8, 0xB6,
+    0x73, 0x71, 0x38, 0x4F, 0x4F, 0x36, 0x5B, 0x3A, 0x5C, 0x52, 0x48, 0xB2, 0x0C, 0x4F, 0x5E, 0xF8,
+    0x67, 0xD8, 0x05, 0xDF, 0xC3, 0x0E, 0xD5, 0xCA, 0x8F, 0x7E, 0x1B, 0x0F, 0xAB, 0x3B, 0xA8, 0xD9,
+    0xB3, 0xDA, 0x68, 0x78, 0x66, 0xF4, 0x06, 0xA9, 0x33, 0x48, 0x73, 0x07, 0x35, 0x1F, 0xFB, 0xE0,
+    0xA1, 0xB5, 0xA7, 0x01, 0xC5, 0xD7, 0x52, 0xC7, 0x32, 0x2E, 0x10, 0x57, 0x3B, 0xB7, 0xDF, 0xC1,
+    0xAA, 0xDE, 0xE3, 0x42, 0xF1, 0x65, 0x84, 0x10, 0x4C, 0x58, 0xC2, 0xD2, 0x9C, 0xB5, 0x58, 0xFD,
+    0xFE, 0xA0, 0x49, 0x3E, 0x13, 0x74, 0x6F, 0x3C, 0xB1, 0xA7, 0x00, 0xC5, 0xCC, 0x19, 0xCE, 0x21,
+    0xC2, 0x92, 0x7F, 0x1C, 0x5C, 0xB6, 0x30, 0xDF, 0xA0, 0x26, 0xE8, 0x96, 0x13, 0xE4, 0x78, 0xB8,
+    0xF8, 0xDA, 0x43, 0x56, 0x8B, 0x16, 0xA2, 0x5D, 0xE6, 0x15, 0x02, 0x2F, 0xB2, 0x53, 0xC3, 0x1A,
+    0xB0, 0xD5, 0x2B, 0x8E, 0xF8, 0xC7, 0x50, 0x2D, 0x83, 0x33, 0x50, 0xB5, 0xF9, 0x0D, 0xED, 0x5C,
+    0xBD, 0x93, 0xDD, 0xD6, 0x75, 0xBF, 0x00, 0xC2, 0xC5, 0x84, 0x2F, 0x33, 0x70, 0x21, 0x7A, 0x32,
+    0xCB, 0x02, 0x6D, 0xCC, 0xC2, 0xA8, 0x53, 0x98, 0x80, 0xA4, 0x2E, 0xD5, 0x66, 0x86, 0x6B, 0x15,
+    0x2E, 0xD8, 0xA4, 0x10, 0x99, 0x82, 0x7D, 0xC6, 0x24, 0x20, 0xE7, 0x0F, 0xC8, 0x66, 0x26, 0x4E,
+    0x8A, 0x14, 0x61, 0xA1, 0xCC, 0x90, 0x2F, 0x85, 0x1A, 0x15, 0xC9, 0x0C, 0x4D, 0xC0, 0x4E, 0x91,
+    0x42, 0x45, 0x10, 0x67, 0x26, 0x2E, 0x5C, 0x18, 0x05, 0x39, 0x99, 0xA8, 0x11, 0x0A, 0xC4, 0x01,
+    0x45, 0x00, 0x37, 0xE7, 0x77, 0xCE, 0xB9, 0x00, 0xDE, 0xDB, 0x15, 0xF5, 0x45, 0xD1, 0xAB, 0x95,
+    0x1E, 0xB9, 0xF7, 0x9E, 0xF7, 0x1E, 0x3E, 0xEE, 0x3D, 0xE7, 0xDE, 0xF3, 0xF9, 0xC3, 0x33, 0x06,
+    0xAF, 0xEF, 0x1B, 0x79, 0x95, 0x95, 0xF1, 0x4A, 0x5B, 0x1B, 0xFA, 0x1F, 0x5B, 0x3B, 0x99, 0xB2,
+    0x31, 0xE5, 0xB3, 0xB7, 0x6C, 0x95, 0x34, 0xBE, 0xAD, 0x4C, 0xD9, 0x46, 0x75, 0x68, 0x33, 0x93,
+    0x0C, 0x51, 0x15, 0x4D, 0xC6, 0x44, 0x63, 0x62, 0x92, 0xD1, 0x98, 0x8D, 0x1D, 0x4C, 0x3A, 0x18,
+    0x13, 0xD2, 0x69, 0x39, 0xF5, 0x01, 0x8E, 0xED, 0x77, 0x7B, 0xDB, 0xA1, 0xAF, 0x3F, 0xB5, 0x2F,
+    0xBB, 0xDD, 0xF3, 0x72, 0xED, 0xE5, 0xFA, 0x05, 0xDD, 0x1B, 0xF7, 0xA3, 0x7B, 0x4F, 0xF2, 0x07,
+    0x3A, 0xD1, 0x7B, 0xE6, 0x2D, 0x4D, 0xC1, 0x76, 0x07, 0x74, 0x19, 0xFA, 0x10, 0xE3, 0xA7, 0x97,
+    0x6F, 0xED, 0x13, 0x9E, 0x9B, 0x77, 0xC3, 0xB8, 0xD7, 0x11, 0x9A, 0x60, 0x40, 0x1B, 0x4E, 0xC6,
+    0xBB, 0x7D, 0x14, 0x5A, 0x3A, 0x7E, 0xF2, 0xAD, 0x67, 0xAD, 0xAD, 0x1E, 0x07, 0x36, 0xCB, 0xDB,
+    0xBB, 0x74, 0xF5, 0xA4, 0xEF, 0xE3, 0xC1, 0x44, 0xB6, 0x4D, 0xD0, 0x66, 0x29, 0x5A, 0x93, 0xF6,
+    0xB8, 0xE9, 0xA7, 0xB4, 0x7C, 0x24, 0xCE, 0x9A, 0x88, 0x4B, 0x86, 0x2E, 0x22, 0x5F, 0x05, 0xB6,
+    0x28, 0x69, 0x90, 0x25, 0xDD, 0xC5, 0x98, 0xAB, 0x76, 0xC4, 0x08, 0xAE, 0xCC, 0xC3, 0xF2, 0x1B,
+    0xE9, 0x37, 0x43, 0x6E, 0x6D, 0x1D, 0x4F, 0xD1, 0x48, 0x7D, 0x13, 0xDB, 0xCD, 0x74, 0x40, 0x87,
+    0x7A, 0xA5, 0x3F, 0x19, 0x4B, 0x67, 0xA7, 0x66, 0xD4, 0x7E, 0x90, 0xDE, 0xEF, 0xA4, 0xBF, 0x53,
+    0x4B, 0x4F, 0x97, 0xE5, 0x3E, 0xD3, 0xDE, 0x7C, 0x75, 0x3D, 0xC4, 0x75, 0x8F, 0x7A, 0x88, 0xFD,
+    0x67, 0xD4, 0xA7, 0x93, 0xF1, 0xC1, 0xD7, 0xC8, 0x3E, 0xBD, 0xD3, 0x81, 0xC9, 0xC4, 0x50, 0x48,
+    0xC3, 0xDC, 0x11, 0x69, 0x18, 0x73, 0x9C, 0xCD, 0xF3, 0xFD, 0x43, 0xED, 0xAD, 0x74, 0x1E, 0x89,
+    0x57, 0xFA, 0x2A, 0xB5, 0x75, 0x6E, 0xEB, 0x12, 0x3D, 0xFD, 0x4F, 0x2A, 0x5A, 0x19, 0xF4, 0x3F,
+    0xCE, 0x7C, 0x5B, 0xD3, 0xFF, 0x94, 0x0E, 0xA9, 0x3D, 0xFB, 0x1F, 0x83, 0xF4, 0x74, 0x03, 0xEE,
+    0xFF, 0xC7, 0x48, 0x5F, 0x7F, 0xAE, 0xDE, 0x97, 0xBE, 0x09, 0x78, 0x9C, 0xB6, 0xD5, 0xBE, 0x8B,
+    0xB8, 0x2F, 0xED, 0x84, 0xA9, 0x9A, 0xD4, 0xF6, 0x16, 0xC3, 0xDC, 0xD8, 0xA6, 0xE4, 0xE1, 0x2E,
+    0x8B, 0x09, 0xAF, 0xCB, 0x85, 0xB9, 0x35, 0xBF, 0x09, 0x3A, 0x66, 0x81, 0x4E, 0x6A, 0xDA, 0xB4,
+    0xCB, 0x71, 0x65, 0x59, 0x2F, 0x6F, 0x12, 0x9D, 0x2F, 0xBF, 0x22, 0xBB, 0xBA, 0x9C, 0xB7, 0x7B,
+    0x75, 0x5E, 0x30, 0x1F, 0x67, 0xB8, 0x3B, 0xBD, 0x5A, 0x34, 0x23, 0xCE, 0xA0, 0x57, 0x17, 0xDA,
+    0x0F, 0xDF, 0xA3, 0xC5, 0x14, 0x4D, 0xDB, 0x7F, 0xB2, 0xAD, 0x8F, 0x69, 0x75, 0x26, 0x6A, 0xB0,
+    0x95, 0x30, 0x41, 0xAC, 0x43, 0xFA, 0xD2, 0x56, 0x1E, 0xEF, 0x68, 0xBC, 0xA1, 0x16, 0x6F, 0x68,
+    0x39, 0xD3, 0x1B, 0x12, 0x17, 0xDE, 0x84, 0xB6, 0xA2, 0x37, 0x25, 0xF3, 0x93, 0x77, 0x92, 0xC1,
+    0x65, 0xE4, 0x4D, 0x0D, 0x21, 0x36, 0xFA, 0xA6, 0xC1, 0x18, 0x2A, 0x7E, 0xE3, 0xE3, 0x0D, 0x5D,
+    0x65, 0x79, 0x93, 0x5A, 0xB3, 0xBC, 0xC1, 0x82, 0x98, 0xDF, 0xD8, 0xDE, 0xCC, 0x17, 0xF0, 0xC1,
+    0x4F, 0x77, 0xE9, 0x50, 0x85, 0xC0, 0x37, 0x8D, 0xC0, 0x0F, 0x1D, 0x0E, 0x31, 0xC7, 0xC8, 0x9B,
+    0x0D, 0x7D, 0x8A, 0x15, 0xFD, 0xB6, 0x8C, 0x9A, 0x2E, 0x46, 0x57, 0x7E, 0x84, 0x37, 0x09, 0x06,
+    0x4F, 0x17, 0x1B, 0x3C, 0xD1, 0x3B, 0x3C, 0xBC, 0x81, 0x79, 0xD0, 0xF2, 0x30, 0xFD, 0x21, 0xA4,
+    0x65, 0x48, 0xE7, 0xC7, 0xF6, 0xA7, 0xC7, 0x37, 0x07, 0xE5, 0x5B, 0x82, 0x9E, 0xDF, 0x9C, 0xB8,
+    0x37, 0x8E, 0xED, 0xEF, 0x42, 0x90, 0xFA, 0x9A, 0x4C, 0xEE, 0xD8, 0x6E, 0xD2, 0x9F, 0xD0, 0x8E,
+    0x93, 0xB3, 0x4D, 0xFC, 0xBC, 0x33, 0xCA, 0x74, 0xAC, 0x06, 0xA3, 0x3C, 0xE7, 0x19, 0x28, 0xCB,
+    0x69, 0x91, 0xCB, 0xD8, 0xE3, 0x79, 0x65, 0x33, 0xC3, 0x67, 0x1A, 0xFC, 0x86, 0x24, 0x75, 0xE6,
+    0xF1, 0x42, 0xD7, 0xF1, 0xD3, 0xB7, 0x44, 0x74, 0x34, 0x9B, 0xB8, 0x20, 0x7D, 0xA1, 0x4C, 0x8C,
+    0x31, 0x77, 0xA5, 0x59, 0xEB, 0x2E, 0x9C, 0xEE, 0x57, 0x8C, 0x6E, 0x57, 0x7C, 0xAE, 0x56, 0x6C,
+    0x2E, 0x56, 0x5C, 0x5E, 0x31, 0x79, 0x58, 0x78, 0x9C, 0x77, 0x6E, 0x9C, 0x74, 0x99, 0xC6, 0xBC,
+    0xAF, 0x1C, 0xC6, 0x29, 0x9D, 0x32, 0x78, 0x63, 0x33, 0xAF, 0x53, 0xFE, 0x92, 0x62, 0xF3, 0x3B,
+    0x65, 0x6F, 0x3A, 0x6D, 0xDF, 0xEB, 0x94, 0x3F, 0x39, 0x16, 0xA5, 0x32, 0xB7, 0x04, 0x4D, 0x6A,
+    0x6D, 0xFB, 0xD0, 0xF8, 0xF7, 0xCD, 0x35, 0x68, 0x5B, 0xCB, 0xFA, 0x01, 0x7C, 0xF4, 0x4B, 0x52,
+    0x08, 0x36, 0xEC, 0xC1, 0x93, 0x98, 0xC8, 0xF4, 0x23, 0xDE, 0x27, 0xAC, 0xD7, 0xC1, 0x5B, 0xA7,
+    0xDE, 0x33, 0x47, 0x7A, 0xC7, 0xC6, 0x91, 0xFC, 0x3A, 0xF8, 0x9B, 0x99, 0x2C, 0x2D, 0x94, 0x35,
+    0xDD, 0x8D, 0x76, 0xB1, 0xFD, 0x8D, 0x92, 0x1B, 0xFB, 0xB7, 0x74, 0xB7, 0xF4, 0xE9, 0x8F, 0x2C,
+    0x8C, 0x55, 0x4E, 0x24, 0xAE, 0x46, 0x53, 0xA6, 0x45, 0x7F, 0x1D, 0xB7, 0x24, 0x49, 0xD1, 0x04,
+    0x7F, 0x80, 0x9E, 0x54, 0x33, 0xC6, 0x40, 0x16, 0xCE, 0x91, 0x2C, 0xCA, 0x9E, 0xEF, 0xA6, 0x66,
+    0x48, 0x46, 0x66, 0x1C, 0x19, 0xD3, 0x24, 0xF4, 0x00, 0xEA, 0xDC, 0x69, 0xAC, 0x17, 0x99, 0x84,
+    0x5E, 0x69, 0xE5, 0x16, 0xC4, 0x7E, 0xAF, 0x95, 0x1B, 0xD3, 0x05, 0xFC, 0x96, 0x9A, 0x92, 0xAD,
+    0x43, 0xD0, 0x6E, 0xEC, 0x7F, 0x3D, 0x27, 0x6B, 0x43, 0x0C, 0xA4, 0xCD, 0x6B, 0xFF, 0x15, 0x5A,
+    0x86, 0xD6, 0x02, 0x8D, 0x36, 0x70, 0xA4, 0x77, 0xB4, 0x52, 0x02, 0x15, 0x33, 0xB8, 0xB6, 0x8E,
+    0xA2, 0x49, 0x42, 0xCB, 0xC2, 0x3C, 0xB0, 0xFC, 0xA1, 0xB8, 0xA0, 0xCC, 0x8C, 0xD1, 0xB5, 0x70,
+    0x2E, 0xA8, 0xA3, 0x99, 0xEA, 0x4E, 0x53, 0x5E, 0xEB, 0x28, 0x9F, 0x29, 0xCC, 0x23, 0x60, 0x8A,
+    0x56, 0xD7, 0xF1, 0x4D, 0xA6, 0xAC, 0xB0, 0x62, 0x87, 0x72, 0xB6, 0xE3, 0x45, 0x94, 0x8E, 0x83,
+    0xBD, 0x80, 0x4A, 0xA9, 0x70, 0xD6, 0xBA, 0x77, 0xDC, 0xF2, 0x09, 0x98, 0x89, 0x4C, 0x4D, 0x8B,
+    0x75, 0x7A, 0x3C, 0x7F, 0x5B, 0x09, 0xE7, 0x89, 0xB0, 0x8E, 0x10, 0xBE, 0xFB, 0xB6, 0x50, 0xB6,
+    0xDF, 0x58, 0xEE, 0xF5, 0x49, 0x84, 0x85, 0x16, 0xDE, 0x21, 0x42, 0x47, 0x04, 0x8E, 0xF0, 0xBF,
+    0x14, 0x71, 0xE4, 0x88, 0x6E, 0x9F, 0xF0, 0x5A, 0x25, 0x7C, 0x10, 0xC2, 0x62, 0x22, 0x84, 0xC3,
+    0x3E, 0xCF, 0xCB, 0xDA, 0x1D, 0x62, 0x8F, 0x6D, 0xC1, 0x19, 0x44, 0xE1, 0x18, 0x9A, 0xED, 0x9A,
+    0x30, 0xAF, 0x1C, 0xDC, 0x21, 0xCA, 0x80, 0xE0, 0x63, 0x63, 0xAE, 0x6D, 0x0B, 0x73, 0x15, 0x56,
+    0x9D, 0xF6, 0x47, 0xC2, 0xFA, 0xC4, 0xE7, 0x96, 0x37, 0x1A, 0x6B, 0x98, 0x83, 0x8C, 0x6D, 0xB2,
+    0xD9, 0x6B, 0x23, 0xDB, 0xCF, 0x2D, 0xB9, 0x85, 0xB2, 0x31, 0x5F, 0x5E, 0xDB, 0x50, 0x1B, 0x92,
+    0x34, 0xD3, 0x9E, 0xF6, 0x53, 0xE1, 0x5A, 0x8C, 0x7A, 0xA7, 0xE5, 0x15, 0x92, 0x77, 0xF3, 0xF2,
+    0x92, 0xE1, 0x5D, 0x65, 0x26, 0x94, 0xBC, 0x90, 0xCA, 0x13, 0xDA, 0xA1, 0x05, 0xE9, 0x98, 0x89,
+    0xF4, 0x79, 0x6F, 0x59, 0x95, 0x5A, 0x90, 0x21, 0x4E, 0xC8, 0x6B, 0x72, 0xAC, 0xC9, 0x7F, 0xA1,
+    0xAB, 0x25, 0x6C, 0xD0, 0x3C, 0x68, 0xCB, 0x38, 0x83, 0xF6, 0xF1, 0xE0, 0x5A, 0xCC, 0x64, 0xE5,
+    0xC8, 0xFF, 0xA3, 0xB1, 0x29, 0xD9, 0xD1, 0x00, 0x1D, 0x49, 0x8A, 0xD8, 0x91, 0xA4, 0x5B, 0x1C,
+    0x49, 0xE6, 0xC5, 0x91, 0xB4, 0xAC, 0x1C, 0x49, 0xC6, 0xD6, 0x91, 0xA4, 0x19, 0x66, 0x32, 0x1D,
+    0x66, 0x32, 0xB6, 0x33, 0xB9, 0xB1, 0xFF, 0xE0, 0xC8, 0xC0, 0x7E, 0xE4, 0x48, 0x1A, 0x91, 0x23,
+    0x69, 0x7E, 0x33, 0x99, 0x2E, 0x64, 0x24, 0x24, 0x79, 0xA1, 0xAC, 0xAE, 0x89, 0x0C, 0xD9, 0x21,
+    0x67, 0x12, 0xBB, 0xD5, 0xAC, 0xC8, 0x3C, 0x13, 0x0B, 0x29, 0xAF, 0x4F, 0x25, 0xF3, 0x7E, 0xF1,
+    0x81, 0xE6, 0xFD, 0xBD, 0x6C, 0x6B, 0x15, 0x80, 0xEC, 0xFA, 0x71, 0x3E, 0x14, 0xC6, 0x67, 0xF6,
+    0xB2, 0x96, 0x03, 0x5A, 0x95, 0x8F, 0x81, 0x0F, 0xC5, 0xE2, 0x21, 0x4A, 0xA5, 0x43, 0xA1, 0x8E,
+    0x13, 0xCE, 0x95, 0x59, 0x36, 0x66, 0x16, 0x8D, 0x99, 0x25, 0x63, 0x9C, 0x60, 0x52, 0xB2, 0xD9,
+    0x22, 0x97, 0x04, 0x14, 0x8B, 0xC5, 0x03, 0x25, 0x52, 0x01, 0x25, 0x42, 0x29, 0x5B, 0x27, 0x13,
+    0x50, 0x22, 0x12, 0x50, 0x22, 0x11, 0xA6, 0x58, 0x20, 0x4C, 0xB1, 0x3C, 0x98, 0x62, 0x71, 0x30,
+    0xC5, 0xD2, 0x60, 0x8A, 0x85, 0xC1, 0x14, 0xCB, 0x42, 0xA8, 0x74, 0xA6, 0x22, 0xA6, 0x9C, 0x20,
+    0xCA, 0xD6, 0xC9, 0xA1, 0x6C, 0x9D, 0x18, 0x94, 0xCA, 0xB3, 0x15, 0x3B, 0xCB, 0x17, 0x2B, 0xD3,
+    0xC6, 0x2C, 0x4E, 0xCC, 0x9E, 0x0E, 0x20, 0xAF, 0x7E, 0x3E, 0x6C, 0x16, 0xD4, 0x34, 0x33, 0x3C,
+    0x76, 0x27, 0xE4, 0x4E, 0xBF, 0x96, 0xFD, 0x3E, 0x91, 0xBA, 0x1B, 0x1D, 0x64, 0xE6, 0xAC, 0xD7,
+    0x21, 0x9B, 0xBF, 0xD4, 0xFE, 0x82, 0xBC, 0xB4, 0xD8, 0x76, 0xA9, 0xFD, 0x80, 0x24, 0x42, 0x04,
+    0x19, 0xFA, 0xF7, 0x48, 0x9A, 0x96, 0x34, 0xC7, 0xC0, 0x06, 0x9A, 0x08, 0xD6, 0x5B, 0xD0, 0x25,
+    0xAD, 0x53, 0x2A, 0xCD, 0x29, 0xA2, 0x7E, 0x49, 0x44, 0xC3, 0x9A, 0x83, 0x86, 0x81, 0xDB, 0x11,
+    0x91, 0x5A, 0xFB, 0x3A, 0x8D, 0x2C, 0xED, 0x72, 0x47, 0xB8, 0x09, 0x76, 0xFB, 0x4C, 0x58, 0xB8,
+    0xD1, 0xEE, 0x71, 0xDB, 0x77, 0x2C, 0x8E, 0xDD, 0xB2, 0x2E, 0xDD, 0xA2, 0x26, 0xED, 0xB2, 0xF8,
+    0xA7, 0xF0, 0x4D, 0x8D, 0xFA, 0xA5, 0x7C, 0xF8, 0xF3, 0x5E, 0x55, 0x71, 0xBB, 0x2B, 0xA0, 0xE3,
+    0x5D, 0x66, 0x7A, 0xFA, 0xB9, 0xBB, 0x8F, 0x53, 0xD0, 0xEE, 0xBC, 0x48, 0x0D, 0x61, 0x94, 0xCB,
+    0x0E, 0x4C, 0x62, 0xE9, 0xD3, 0x48, 0xEE, 0x73, 0x4F, 0x55, 0xFC, 0xA3, 0x8D, 0xF4, 0x83, 0x18,
+    0x01, 0xAF, 0x93, 0x1B, 0xC2, 0xA6, 0xD4, 0xDC, 0xCB, 0xAA, 0xD9, 0x48, 0x3C, 0x8A, 0xA8, 0x03,
+    0x71, 0x22, 0x52, 0x0A, 0xBC, 0x4C, 0x12, 0xF5, 0xB9, 0x29, 0x80, 0x44, 0xFA, 0x00, 0x01, 0x24,
+    0x7B, 0xCA, 0xA3, 0xDA, 0x90, 0x41, 0xD6, 0xAF, 0xA7, 0x61, 0x7D, 0xD0, 0x4B, 0x6A, 0x60, 0xC3,
+    0x29, 0x80, 0x8E, 0xF5, 0x88, 0xC5, 0xDE, 0xD5, 0x5E, 0xD9, 0x22, 0x4C, 0x11, 0x96, 0x08, 0x43,
+    0x42, 0x67, 0x5C, 0xF7, 0x58, 0x71, 0x69, 0x9B, 0xB1, 0x3B, 0x35, 0xE2, 0xCB, 0x8F, 0x58, 0x27,
+    0x60, 0xE5, 0x6C, 0x46, 0x0C, 0x3B, 0x94, 0xA0, 0xFA, 0x81, 0x0A, 0x65, 0x69, 0x0F, 0x2D, 0x7B,
+    0x27, 0x68, 0x23, 0x7B, 0x42, 0x6D, 0xC2, 0x61, 0x78, 0xCA, 0xC7, 0x93, 0x9E, 0x9A, 0x5B, 0x58,
+    0x15, 0x7C, 0x1E, 0xE0, 0x98, 0xE9, 0x26, 0x2D, 0xF5, 0xC8, 0x0E, 0x29, 0x94, 0x7F, 0x8B, 0xAD,
+    0xCA, 0xF1, 0xFE, 0x35, 0xF2, 0x88, 0x93, 0x2A, 0x6A, 0x36, 0x6D, 0x5A, 0x04, 0x93, 0x46, 0x35,
+    0x58, 0x18, 0x57, 0x8E, 0x34, 0x36, 0xC4, 0xC1, 0x58, 0xC8, 0xA3, 0x6C, 0x96, 0xFC, 0x25, 0xFE,
+    0x95, 0x3D, 0x6B, 0xB8, 0x54, 0xEF, 0xF1, 0xC0, 0x1C, 0x9C, 0xE4, 0x59, 0x52, 0xC5, 0xB5, 0x35,
+    0x9B, 0xE7, 0x83, 0xB8, 0x43, 0x98, 0xF1, 0x95, 0x65, 0x4B, 0xC6, 0x50, 0x74, 0xFC, 0x79, 0x27,
+    0xE3, 0xFC, 0xDC, 0x7F, 0x72, 0xCF, 0x98, 0x13, 0x1A, 0xC4, 0x66, 0x8D, 0x98, 0x43, 0x89, 0x95,
+    0xBD, 0x31, 0x6A, 0x25, 0x3E, 0xAE, 0x64, 0xBB, 0x67, 0x2B, 0x87, 0x62, 0x27, 0x1A, 0xE6, 0xF4,
+    0x94, 0x91, 0xEC, 0x94, 0x91, 0xE4, 0x94, 0x91, 0xDC, 0x94, 0x91, 0xD4, 0x94, 0xCB, 0x0C, 0x49,
+    0x62, 0x4A, 0xF3, 0x46, 0x99, 0xA6, 0xA5, 0x34, 0xAB, 0xA4, 0x9D, 0xE6, 0x9C, 0x5E, 0xD4, 0x69,
+    0x3A, 0x4A, 0x4F, 0xD0, 0x64, 0x94, 0xE6, 0xA2, 0x34, 0x15, 0xA5, 0xF7, 0xD3, 0x44, 0x94, 0xE8,
+    0xA2, 0x39, 0x0D, 0x85, 0xA5, 0xBE, 0x4A, 0x42, 0xC9, 0x54, 0x1E, 0xF0, 0x7A, 0x2D, 0x4D, 0x4A,
+    0x6D, 0xF2, 0x73, 0xCC, 0x23, 0x7A, 0x3E, 0xF0, 0x4A, 0x5D, 0x3C, 0x8B, 0x75, 0x9E, 0xC4, 0xBB,
+    0x7D, 0xC4, 0x4B, 0x82, 0xC3, 0x12, 0x98, 0x21, 0xD2, 0xE9, 0x25, 0x87, 0x60, 0x74, 0x43, 0x24,
+    0xA8, 0x46, 0x9D, 0xF7, 0x57, 0x99, 0xA0, 0xBA, 0x85, 0x18, 0x8E, 0x44, 0x53, 0xC4, 0x10, 0x51,
+    0xD4, 0x94, 0x19, 0x67, 0xCF, 0x46, 0xD1, 0x27, 0xFD, 0x5A, 0x8F, 0xAD, 0xD6, 0x0D, 0x27, 0xB2,
+    0xAC, 0xE6, 0xB1, 0xC6, 0xD0, 0x4A, 0xDC, 0xAA, 0xD9, 0xA3, 0xDF, 0x51, 0xA7, 0x39, 0x2B, 0x2C,
+    0x89, 0x71, 0xCE, 0x58, 0x21, 0x61, 0xD5, 0x4A, 0xBE, 0xAA, 0x62, 0xC3, 0x36, 0x2E, 0x0A, 0xF4,
+    0x1A, 0x54, 0x0C, 0xCC, 0x19, 0xA7, 0x72, 0xC2, 0x2E, 0xC5, 0x11, 0xFE, 0x64, 0xD7, 0x6E, 0x87,
+    0xB8, 0x89, 0xE6, 0xD2, 0xD1, 0x29, 0x0B, 0x26, 0x39, 0x2C, 0xD7, 0x49, 0x26, 0xCB, 0x25, 0x9E,
+    0xD4, 0xA0, 0x7C, 0x89, 0x4E, 0xAE, 0x22, 0xD9, 0x2B, 0x4D, 0x5E, 0x69, 0xEE, 0x4A, 0x53, 0x57,
+    0x9A, 0xB9, 0xDA, 0xD0, 0x5A, 0xB6, 0xA7, 0xF2, 0x56, 0xB1, 0xE5, 0x9D, 0xA6, 0xDD, 0xE1, 0x76,
+    0xBB, 0x32, 0xC2, 0xE4, 0xD7, 0x70, 0xEE, 0xA3, 0xCA, 0x31, 0xDD, 0xB4, 0x96, 0xAE, 0xE2, 0xC9,
+    0x5F, 0xCE, 0x0E, 0xF7, 0xA7, 0x79, 0x21, 0x24, 0x1D, 0x4A, 0xB6, 0x72, 0xB7, 0x73, 0x21, 0xE4,
+    0xC9, 0x01, 0x8C, 0x5D, 0xD4, 0xC6, 0x6C, 0xD3, 0x3A, 0xE9, 0xE4, 0x5D, 0x58, 0x6F, 0x2A, 0x73,
+    0xF6, 0xEB, 0x9C, 0x8A, 0xFF, 0xB6, 0xB8, 0xC8, 0x62, 0x1B, 0x7D, 0x59, 0xCA, 0x81, 0xAC, 0xE1,
+    0x48, 0x9C, 0x82, 0xC3, 0x17, 0xAD, 0x02, 0xEE, 0x2E, 0x9B, 0x8B, 0xB9, 0x0A, 0x48, 0x83, 0xDD,
+    0x58, 0x3B, 0xA7, 0x62, 0x94, 0xCC, 0x0E, 0x93, 0xC2, 0xFA, 0xA2, 0xAD, 0x89, 0xEF, 0x9B, 0x0D,
+    0xE6, 0x12, 0x57, 0xEC, 0x5B, 0x86, 0xBF, 0x3D, 0x4B, 0xB3, 0xDF, 0x66, 0xF7, 0x53, 0x77, 0xBF,
+    0xEA, 0x82, 0xDD, 0x35, 0x11, 0x67, 0xF1, 0x85, 0x5C, 0x13, 0x97, 0x33, 0x1F, 0x3B, 0x66, 0xD3,
+    0x44, 0x10, 0xBC, 0x3F, 0xE4, 0xAC, 0x29, 0xB5, 0xA8, 0xA1, 0x01, 0xEB, 0xE1, 0xBB, 0x6C, 0xAD,
+    0x0B, 0x3F, 0xE3, 0x55, 0x10, 0x9D, 0xB1, 0x26, 0x9A, 0x4D, 0xFD, 0x75, 0x5A, 0x13, 0x5B, 0xD1,
+    0x12, 0xB9, 0x86, 0x07, 0x12, 0x1D, 0x04, 0xC3, 0x4E, 0x82, 0xEC, 0x9B, 0xAB, 0x27, 0xD4, 0x57,
+    0xD7, 0x20, 0x29, 0x1C, 0x35, 0xC6, 0x52, 0x79, 0x4A, 0x04, 0x27, 0x3A, 0xE0, 0x02, 0xE9, 0x89,
+    0x83, 0x87, 0xEC, 0x85, 0x22, 0x3F, 0x41, 0xAB, 0x3F, 0x7E, 0x72, 0xD3, 0xD2, 0x8E, 0x27, 0xAF,
+    0xF7, 0x0F, 0x34, 0x55, 0xC0, 0x41, 0x2D, 0x87, 0xB8, 0x9C, 0xBB, 0x49, 0xFB, 0x6B, 0xDB, 0x6D,
+    0x89, 0xAC, 0x9A, 0xD5, 0xA6, 0x43, 0x90, 0xDC, 0xD1, 0x21, 0xE4, 0x32, 0x95, 0x6D, 0x42, 0x21,
+    0x53, 0x13, 0x0F, 0x1E, 0x52, 0xAA, 0x21, 0x62, 0x24, 0x30, 0xF8, 0x0E, 0x5F, 0xE9, 0xC6, 0x2E,
+    0x2B, 0xEC, 0x4E, 0x4F, 0x57, 0xDD, 0x61, 0x55, 0x62, 0xAE, 0x8B, 0xAE, 0x2E, 0x24, 0x76, 0x28,
+    0x2B, 0x09, 0xA1, 0xF3, 0x82, 0x1D, 0x55, 0x5A, 0x81, 0xDF, 0x3B, 0x93, 0xC5, 0x17, 0x33, 0x24,
+    0xA6, 0xFD, 0x35, 0x19, 0xD7, 0xA6, 0xAE, 0xF4, 0x4A, 0xAF, 0xEF, 0x99, 0xB7, 0xA1, 0xB6, 0x32,
+    0x5C, 0xD3, 0xBE, 0x6E, 0x67, 0xFA, 0xBA, 0xB9, 0xBB, 0xC7, 0x98, 0x73, 0x10, 0x24, 0xAF, 0xA5,
+    0x3F, 0xED, 0xF4, 0xD7, 0xB6, 0x0F, 0x77, 0x0F, 0x70, 0xC2, 0x9D, 0xA5, 0x59, 0xED, 0x48, 0xD7,
+    0xB8, 0x7C, 0xCA, 0x6B, 0xDF, 0x10, 0xE9, 0x8F, 0x66, 0xB7, 0x35, 0xAB, 0xE9, 0x7B, 0xBC, 0x43,
+    0x84, 0x45, 0xD2, 0xCA, 0x27, 0xE6, 0x8F, 0xCE, 0x9D, 0xF4, 0x0F, 0xB6, 0x5B, 0x15, 0xDC, 0x66,
+    0xF6, 0xC5, 0x17, 0xCA, 0x3B, 0x3E, 0xDE, 0x4F, 0x1A, 0x72, 0xFD, 0xA2, 0x9B, 0x29, 0x76, 0x5E,
+    0x6E, 0xDA, 0x69, 0xFB, 0x9E, 0xD4, 0x19, 0xEF, 0x0C, 0xC6, 0x97, 0x7C, 0x3E, 0x82, 0x77, 0xA6,
+    0xEE, 0xCE, 0xD4, 0x00, 0x8A, 0xB3, 0x11, 0x5D, 0xE2, 0x2A, 0x18, 0xAD, 0xA3, 0xC2, 0xDA, 0x51,
+    0x51, 0xE5, 0xA8, 0x24, 0x4B, 0x94, 0xB7, 0xA9, 0x0B, 0xF4, 0xCD, 0xA3, 0x99, 0xEA, 0x8D, 0x7E,
+    0xEB, 0xB7, 0x46, 0xCF, 0x08, 0xE6, 0x62, 0x73, 0x34, 0x53, 0xF1, 0x4F, 0x8F, 0x75, 0x71, 0xA5,
+    0xC6, 0x1D, 0x77, 0x4F, 0xA8, 0x84, 0x87, 0x03, 0x2A, 0x35, 0x5E, 0xEF, 0x28, 0x48, 0x1F, 0x0E,
+    0x47, 0x6E, 0x22, 0xB4, 0xE3, 0xF1, 0x0F, 0x21, 0xF9, 0x9A, 0xE1, 0x00, 0x6B, 0x0A, 0x85, 0xD7,
+    0xED, 0x7D, 0xBD, 0x6D, 0xBB, 0xEE, 0x89, 0x6F, 0xEB, 0x30, 0xF5, 0xD2, 0xC3, 0xCC, 0x7B, 0x98,
+    0x41, 0xDA, 0x7D, 0x62, 0x39, 0xDB, 0x6C, 0xA1, 0xDA, 0x21, 0x71, 0x4B, 0xEB, 0x19, 0x32, 0x27,
+    0x01, 0x56, 0x90, 0x3A, 0x94, 0x35, 0xE4, 0xDE, 0x89, 0x9A, 0xA7, 0xCB, 0xAD, 0xFA, 0x43, 0x57,
+    0x3C, 0x92, 0x1E, 0x2B, 0xE0, 0x7F, 0xE9, 0x4E, 0xB2, 0x06, 0x8C, 0xAE, 0x02, 0x36, 0x0B, 0x56,
+    0xCD, 0x03, 0xE4, 0x93, 0x61, 0x2D, 0x0C, 0xC6, 0xAB, 0xB1, 0x1A, 0x2C, 0xF8, 0x3C, 0xDD, 0xFC,
+    0x6F, 0xFB, 0xB4, 0x44, 0x85, 0xFC, 0x1D, 0xBA, 0x0E, 0xAD, 0x89, 0x67, 0xC4, 0xD3, 0x5E, 0xD2,
+    0x0A, 0xEB, 0x84, 0xA6, 0x40, 0x4A, 0x42, 0xD4, 0x7A, 0x61, 0xAE, 0x8F, 0x71, 0x15, 0x22, 0xE9,
+    0x7E, 0xD8, 0x85, 0xB4, 0x43, 0xB1, 0x77, 0x68, 0x8F, 0xA0, 0x52, 0x1B, 0xF2, 0x2A, 0x34, 0xDE,
+    0xEC, 0xAB, 0x69, 0x61, 0x41, 0xF3, 0xD0, 0xBA, 0xCD, 0x4F, 0x75, 0x34, 0x86, 0x46, 0x3B, 0x1C,
+    0x59, 0x4E, 0x7C, 0x02, 0x5D, 0x02, 0x22, 0x4B, 0x19, 0xF5, 0x54, 0xD2, 0x77, 0x09, 0xC3, 0x03,
+    0x50, 0xD7, 0x3D, 0xCE, 0xC7, 0x23, 0x54, 0x18, 0x51, 0x0F, 0x41, 0x82, 0x78, 0xC0, 0x49, 0x9C,
+    0x7D, 0x8A, 0x64, 0x39, 0x7A, 0x64, 0x5B, 0xB3, 0x75, 0x3E, 0xF2, 0x36, 0x7D, 0xF6, 0xF0, 0x0D,
+    0x14, 0xE0, 0xE1, 0x62, 0xF8, 0xC4, 0xFC, 0x9B, 0x45, 0x38, 0x79, 0xF6, 0x4F, 0x20, 0x5E, 0xD4,
+    0xEB, 0xE9, 0x16, 0x35, 0x7C, 0x8C, 0xB2, 0xD1, 0x56, 0x3E, 0x91, 0x6F, 0x21, 0x1C, 0xE4, 0x83,
+    0xFE, 0xCE, 0xF2, 0x76, 0x65, 0x25, 0x82, 0xEA, 0x87, 0xD7, 0x0B, 0x12, 0x85, 0x37, 0x4C, 0xAF,
+    0xDB, 0x86, 0x76, 0x56, 0x20, 0x35, 0x65, 0x5E, 0x7D, 0x34, 0x14, 0x64, 0xE4, 0xA6, 0x2D, 0x4D,
+    0x2B, 0xAF, 0x81, 0x84, 0x2A, 0x8B, 0x2B, 0x6F, 0x91, 0x3D, 0x28, 0x52, 0xD4, 0x98, 0x8B, 0x6B,
+    0xEF, 0x4D, 0x27, 0x14, 0xFA, 0x44, 0xBD, 0x49, 0x9F, 0x1D, 0xE3, 0xBE, 0x7C, 0x05, 0xBA, 0x0B,
+    0xDC, 0x5C, 0xFF, 0xBE, 0x39, 0xCC, 0x90, 0xB8, 0x33, 0x25, 0xB3, 0xF3, 0x4D, 0x66, 0x6B, 0xA2,
+    0x45, 0x7C, 0xD9, 0xA1, 0xAE, 0x44, 0xB8, 0x93, 0x85, 0x7E, 0x05, 0x52, 0xBB, 0xBC, 0xDD, 0x9E,
+    0x2C, 0x52, 0x3B, 0xB0, 0xB6, 0x60, 0xA9, 0x8D, 0x2B, 0xA9, 0x71, 0xF1, 0x7F, 0x34, 0x9A, 0x07,
+    0xE3, 0x9A, 0xD5, 0x67, 0x96, 0x9A, 0x60, 0x19, 0x48, 0x19, 0xC3, 0x01, 0x2E, 0x79, 0xE2, 0x32,
+    0xEF, 0x48, 0xB3, 0x06, 0x6C, 0x02, 0xCE, 0xA7, 0x7C, 0x4D, 0x30, 0xC1, 0x16, 0x06, 0x23, 0xB7,
+    0x72, 0x6B, 0x72, 0xC8, 0xA6, 0x1F, 0xD2, 0xB4, 0xE5, 0x0A, 0xE6, 0xCF, 0xA7, 0x93, 0x79, 0x92,
+    0x6E, 0x96, 0x3A, 0xCD, 0x3D, 0xF9, 0x6A, 0x29, 0xDD, 0x3B, 0xDE, 0x01, 0x2A, 0xFD, 0x42, 0x00,
+    0x0A, 0xE8, 0x60, 0x9C, 0xF2, 0x29, 0x03, 0x4F, 0x13, 0x41, 0xA6, 0xA4, 0x02, 0x4A, 0xC9, 0x05,
+    0x82, 0x25, 0xF0, 0x93, 0x40, 0x90, 0x27, 0x91, 0x40, 0x81, 0x80, 0x5A, 0xA3, 0x6E, 0x62, 0xB3,
+    0xF4, 0x9F, 0xD2, 0xFD, 0x5A, 0xC0, 0x40, 0x56, 0x90, 0x49, 0x56, 0x40, 0x43, 0xBF, 0x15, 0x20,
+    0x51, 0xA3, 0xE0, 0xA2, 0x7C, 0x94, 0xD3, 0xAD, 0x16, 0x8D, 0x19, 0xF1, 0xA2, 0x60, 0xA5, 0x40,
+    0x70, 0x31, 0xC0, 0xE9, 0x60, 0x2C, 0x76, 0xE4, 0x54, 0x2B, 0x59, 0x1A, 0x5C, 0x32, 0x66, 0xA4,
+    0x45, 0xE5, 0xD1, 0x1A, 0xB9, 0x5C, 0x90, 0x72, 0x33, 0x9B, 0x16, 0x2A, 0xD6, 0x1F, 0x62, 0x2E,
+    0xD6, 0x73, 0xF0, 0x9F, 0xB2, 0x46, 0x8F, 0x59, 0x9F, 0x5F, 0xBA, 0x21, 0xC5, 0x6C, 0x98, 0x56,
+    0x01, 0x1A, 0xD6, 0xB3, 0x07, 0xE1, 0x7D, 0x5A, 0x9B, 0x72, 0x19, 0x3B, 0x45, 0xD5, 0x88, 0x46,
+    0x85, 0x82, 0x77, 0xC0, 0xF0, 0x9D, 0x88, 0x11, 0x56, 0x29, 0x0F, 0xBA, 0xC4, 0x91, 0xBF, 0x1C,
+    0xDD, 0xC4, 0x3D, 0x5A, 0x32, 0x99, 0xCE, 0xDE, 0xB3, 0x1F, 0x0B, 0x58, 0x42, 0xE0, 0x59, 0x39,
+    0x23, 0xB6, 0x12, 0xAB, 0x33, 0xA6, 0xCF, 0x43, 0x66, 0xBA, 0x6F, 0x51, 0x86, 0x2A, 0x4A, 0x8B,
+    0x76, 0x63, 0x2F, 0x46, 0xEE, 0x3C, 0x54, 0x57, 0x4C, 0x3C, 0xB6, 0x54, 0x2C, 0x7F, 0xB9, 0x83,
+    0x20, 0x54, 0x24, 0x42, 0xF9, 0x5C, 0xAB, 0x08, 0xD5, 0xB2, 0x4A, 0x7F, 0xC7, 0x39, 0xF4, 0xC7,
+    0xEC, 0x72, 0xC9, 0x46, 0x95, 0x2D, 0x54, 0x2F, 0x15, 0xD2, 0x58, 0x91, 0x4F, 0xEF, 0xF3, 0x36,
+    0xEE, 0x58, 0x52, 0xCD, 0x62, 0xBF, 0xD5, 0x6C, 0x3B, 0xEB, 0xBD, 0x63, 0xBC, 0xBF, 0xC9, 0x22,
+    0x95, 0x10, 0x50, 0x02, 0x42, 0x69, 0xAF, 0x1C, 0x1F, 0x9F, 0x97, 0xA2, 0xC9, 0x69, 0x81, 0x37,
+    0x9F, 0x2E, 0x70, 0x29, 0x0C, 0xE5, 0x52, 0x18, 0xAA, 0x19, 0x6F, 0xAA, 0x85, 0xA1, 0x6E, 0x81,
+    0x3D, 0x2C, 0x3E, 0xEF, 0x86, 0xD5, 0xFC, 0xBA, 0x15, 0x73, 0x15, 0x3D, 0xC1, 0xDD, 0x88, 0xAB,
+    0x09, 0x19, 0xD4, 0x02, 0x0A, 0x3C, 0xCA, 0x74, 0x28, 0xCD, 0x02, 0x89, 0x60, 0xBD, 0xEE, 0x8F,
+    0x19, 0x5F, 0x1F, 0xD6, 0x4D, 0x17, 0x98, 0xC2, 0x77, 0x04, 0xBB, 0x28, 0xF8, 0x3B, 0xC0, 0x10,
+    0xB9, 0x4D, 0x32, 0x96, 0x7B, 0xC1, 0x53, 0x16, 0x96, 0x02, 0x3D, 0x88, 0x04, 0x11, 0x00, 0x75,
+    0xA3, 0x61, 0x4F, 0x5E, 0x10, 0xB9, 0xCC, 0x07, 0xB1, 0x0D, 0x3C, 0xAF, 0xC7, 0x8C, 0xFD, 0x40,
+    0xB9, 0x2B, 0x42, 0x75, 0x96, 0x43, 0x2C, 0xD1, 0x9A, 0x3B, 0x5E, 0x3C, 0x3C, 0x83, 0x9E, 0x9B,
+    0x8D, 0x6B, 0x5A, 0x8A, 0x9B, 0xE2, 0x6A, 0x53, 0xC0, 0xE5, 0xCD, 0x28, 0x28, 0xBA, 0x24, 0x86,
+    0x8F, 0xB7, 0x10, 0xA7, 0x59, 0x1E, 0x73, 0x4A, 0xCE, 0x48, 0x34, 0x04, 0x56, 0x64, 0x82, 0xCD,
+    0x54, 0xA7, 0x80, 0x9D, 0x07, 0x76, 0xAD, 0x59, 0x83, 0xAF, 0x1B, 0x62, 0x4F, 0x3C, 0xA4, 0x40,
+    0x42, 0xA6, 0x80, 0x0E, 0xA4, 0x08, 0xD4, 0xE2, 0x91, 0xD6, 0x57, 0xA8, 0x89, 0x88, 0x13, 0x83,
+    0xF2, 0x68, 0x8A, 0xF2, 0x68, 0x53, 0x92, 0x38, 0x46, 0x49, 0x89, 0xBE, 0xF4, 0xF2, 0xE8, 0x0B,
+    0xFE, 0xB0, 0xB6, 0x38, 0xAE, 0xAA, 0x29, 0x94, 0xC9, 0xB8, 0xE0, 0xA4, 0xE8, 0xCA, 0x6F, 0x31,
+    0xC1, 0x5F, 0x1D, 0x26, 0xD8, 0x61, 0x7F, 0x5D, 0x2C, 0x39, 0xCE, 0xEB, 0x53, 0xB0, 0xBF, 0x9A,
+    0x36, 0xF0, 0x1C, 0x76, 0x70, 0xC6, 0xFE, 0x9A, 0x6F, 0xB1, 0xBF, 0xBB, 0xD8, 0xDF, 0x99, 0x71,
+    0x73, 0x1A, 0xCA, 0x2F, 0x97, 0x8C, 0x54, 0xBC, 0x90, 0xD1, 0x67, 0x26, 0xBF, 0x71, 0xD8, 0x5F,
+    0x64, 0x30, 0x1F, 0xAE, 0x0B, 0xCD, 0x62, 0x0B, 0x34, 0x71, 0xA3, 0x19, 0x79, 0x2D, 0xDC, 0x5D,
+    0x32, 0x17, 0x2B, 0xDE, 0x32, 0x74, 0x03, 0x36, 0x5B, 0xE3, 0x82, 0xA7, 0x92, 0xE4, 0xD5, 0xB4,
+    0x38, 0x11, 0x5E, 0xF6, 0xB5, 0x8E, 0xB7, 0xE0, 0x3B, 0xD0, 0xDB, 0x42, 0x94, 0xCD, 0xCF, 0x95,
+    0x0C, 0x39, 0xCD, 0xDE, 0x89, 0xAA, 0x69, 0x44, 0xF1, 0x2E, 0xBA, 0xF1, 0x25, 0x91, 0xCD, 0x42,
+    0xE2, 0x55, 0xA1, 0x34, 0xB3, 0x43, 0x36, 0x82, 0x4F, 0xEE, 0xE6, 0xD3, 0x66, 0x4D, 0xF3, 0xD9,
+    0x49, 0xFF, 0x4C, 0x92, 0x6B, 0x3E, 0x8D, 0xAA, 0xAF, 0x46, 0x4E, 0x01, 0x3A, 0xB1, 0xC7, 0xE2,
+    0x60, 0xA7, 0x4D, 0x1C, 0x5B, 0x8D, 0x7D, 0x16, 0xD8, 0xE7, 0x1A, 0x12, 0x44, 0x26, 0x26, 0x07,
+    0xC0, 0xD4, 0xBE, 0x69, 0x19, 0x34, 0xFE, 0x57, 0x1F, 0xF3, 0x12, 0xFF, 0x28, 0x63, 0xAB, 0x36,
+    0xC2, 0xDD, 0xF5, 0x2C, 0x3B, 0x69, 0x12, 0xFF, 0x55, 0x1E, 0x1B, 0x53, 0xEE, 0x3C, 0x99, 0x9F,
+    0x76, 0xBE, 0x68, 0x5F, 0x5F, 0x4C, 0xA3, 0x76, 0x81, 0xEB, 0x0A, 0xD1, 0x9C, 0x99, 0x28, 0x4D,
+    0xD1, 0x97, 0x62, 0x2A, 0xE3, 0xC1, 0xA9, 0x0C, 0x86, 0x28, 0xB7, 0x52, 0x5C, 0xA9, 0x24, 0x00,
+    0x95, 0xE0, 0x94, 0x8D, 0xDD, 0xAF, 0xC4, 0xB2, 0x89, 0x63, 0x24, 0x12, 0xF6, 0xDC, 0x3E, 0xAE,
+    0x5F, 0xD0, 0x35, 0xC6, 0xB9, 0x36, 0xAC, 0x63, 0xAB, 0xA5, 0x33, 0x9E, 0x56, 0xE8, 0x14, 0x4A,
+    0x98, 0xF4, 0x67, 0x95, 0xA2, 0x12, 0x4D, 0x86, 0x67, 0xAB, 0x30, 0x9D, 0x81, 0xB0, 0x8A, 0x82,
+    0x55, 0x08, 0xAC, 0xE2, 0x5F, 0x15, 0xFC, 0xAA, 0xC8, 0x57, 0x85, 0xBD, 0x2A, 0xE6, 0x55, 0x01,
+    0xAF, 0x0E, 0xED, 0x2A, 0x50, 0x57, 0xC5, 0xB9, 0x2A, 0xC8, 0x55, 0x11, 0xAE, 0x0A, 0x6F, 0x55,
+    0x6C, 0xAB, 0x02, 0x5B, 0x15, 0xD5, 0xAA, 0x90, 0x56, 0xC5, 0xB3, 0x2A, 0x98, 0x55, 0x91, 0xAC,
+    0x0A, 0x63, 0x55, 0x0C, 0xAB, 0x02, 0x58, 0x15, 0xBD, 0xEA, 0xA0, 0xAB, 0xA2, 0x0E, 0x66, 0x94,
+    0xA3, 0xA6, 0x83, 0x13, 0x61, 0x41, 0x38, 0xB8, 0xE7, 0x77, 0xCE, 0x48, 0xF8, 0x03, 0x4D, 0x2A,
+    0x58, 0x52, 0x23, 0x48, 0x52, 0xA3, 0x38, 0x52, 0x45, 0x91, 0x2A, 0x86, 0x54, 0x11, 0xA4, 0x0A,
+    0x1B, 0x9D, 0xBB, 0x2F, 0x5A, 0x69, 0x6B, 0x64, 0x0F, 0x09, 0x52, 0x54, 0xE0, 0xA1, 0x8A, 0x12,
+    0x5D, 0xCD, 0xC2, 0x85, 0xE9, 0x89, 0xFA, 0x13, 0xB9, 0x26, 0xBE, 0x9F, 0xED, 0x57, 0x2C, 0xB4,
+    0xAE, 0xE8, 0x2A, 0x14, 0x85, 0x82, 0x36, 0xCC, 0x3F, 0xEF, 0xF6, 0xEF, 0x74, 0x7B, 0x90, 0xD0,
+    0xDD, 0xCA, 0xC6, 0xC6, 0x55, 0x36, 0x24, 0x33, 0xBE, 0xAA, 0x6C, 0x08, 0xE3, 0xEE, 0x6A, 0x65,
+    0x63, 0x50, 0x78, 0x7F, 0x2F, 0xC9, 0x3C, 0xBF, 0xF3, 0xB5, 0xB2, 0x21, 0xAB, 0x33, 0x6C, 0xB4,
+    0xA2, 0x51, 0x7F, 0x62, 0x45, 0x83, 0x3D, 0xED, 0xC7, 0xA7, 0x2B, 0x19, 0xD8, 0xE3, 0x81, 0x3E,
+    0xDD, 0x29, 0x95, 0x8C, 0xF6, 0x74, 0x25, 0x43, 0xD9, 0x23, 0xCC, 0x11, 0xD6, 0x08, 0x63, 0xFA,
+    0x7D, 0x96, 0xC8, 0xC4, 0xA2, 0x77, 0x7A, 0x66, 0xC2, 0xA3, 0xA5, 0x2D, 0xFA, 0xF9, 0x5B, 0x6F,
+    0xF5, 0xC4, 0xDD, 0x19, 0x15, 0x0E, 0x54, 0x83, 0x36, 0x13, 0x57, 0x38, 0x24, 0x67, 0x7D, 0xEB,
+    0x55, 0xD4, 0xB7, 0x24, 0x47, 0xBF, 0x46, 0xFF, 0xD2, 0x80, 0x66, 0x8F, 0x67, 0x86, 0xC2, 0x27,
+    0xB3, 0xF2, 0xCB, 0xB3, 0x9D, 0x72, 0xCE, 0xB7, 0xF5, 0x8F, 0x4F, 0xAA, 0x7F, 0xCC, 0x3E, 0x93,
+    0x73, 0x9A, 0x4C, 0xD9, 0x98, 0x95, 0xDB, 0x04, 0xB3, 0xBC, 0x76, 0x9C, 0xF6, 0x3C, 0xA7, 0xAF,
+    0x5F, 0x5D, 0xC4, 0xB9, 0x88, 0xC3, 0x1A, 0xB5, 0x21, 0x6B, 0x5E, 0xA7, 0xAA, 0x0F, 0xA3, 0x92,
+    0x29, 0x10, 0xD7, 0x32, 0x68, 0xD8, 0xD9, 0xFA, 0xFB, 0x4A, 0xB6, 0x6E, 0x71, 0x46, 0x0E, 0xA9,
+    0x94, 0x1C, 0x92, 0xE5, 0x1C, 0x92, 0x6F, 0x39, 0x0D, 0x12, 0xFE, 0x8A, 0x73, 0x48, 0xD1, 0xBF,
+    0x71, 0x2E, 0x28, 0x7E, 0x93, 0xBB, 0xEB, 0x92, 0x43, 0xFA, 0xB1, 0xA4, 0x8B, 0x7A, 0xEE, 0xBC,
+    0x96, 0xBB, 0xA0, 0xE1, 0x6E, 0x53, 0x71, 0x0E, 0x29, 0x2A, 0x38, 0x87, 0x94, 0x48, 0x0E, 0xE9,
+    0x07, 0x92, 0x43, 0x7A, 0xC4, 0x39, 0xA4, 0xB1, 0xE3, 0x1C, 0x92, 0x04, 0x19, 0x1B, 0x84, 0x21,
+    0xA7, 0x72, 0x48, 0xA9, 0x08, 0xF7, 0x9E, 0xE4, 0x90, 0x7A, 0x71, 0x05, 0xEE, 0xCF, 0xBB, 0xE9,
+    0x64, 0x56, 0x1A, 0x21, 0xAF, 0x81, 0x48, 0xD6, 0x7B, 0xBD, 0xA4, 0x96, 0xDC, 0xAE, 0x79, 0x1B,
+    0x49, 0xA2, 0x3F, 0xED, 0x58, 0x59, 0x35, 0x9A, 0x57, 0xE6, 0x47, 0xBF, 0x39, 0x2B, 0xD4, 0xC3,
+    0xAC, 0xD3, 0x1C, 0x69, 0x00, 0x08, 0x25, 0x7A, 0x9E, 0x79, 0x1F, 0xFC, 0x1A, 0x6D, 0xF4, 0x01,
+    0xDA, 0x98, 0xB3, 0x3F, 0xD7, 0xB9, 0x45, 0x01, 0x38, 0x7D, 0xD6, 0xA1, 0xB5, 0x0D, 0x92, 0x44,
+    0x1C, 0x78, 0xC0, 0x2E, 0xEE, 0x25, 0x89, 0xD8, 0x95, 0x11, 0x94, 0x43, 0x50, 0x5F, 0x59, 0x9E,
+    0x7B, 0xB8, 0xFD, 0x8E, 0x60, 0x2F, 0xD3, 0x46, 0xEC, 0x41, 0xDC, 0xC9, 0x90, 0xC3, 0x41, 0x90,
+    0xD1, 0xDE, 0xA8, 0xC0, 0xB3, 0xDC, 0x0C, 0xBA, 0x56, 0x5F, 0xFB, 0x06, 0x94, 0xB2, 0xAF, 0xDD,
+    0x47, 0xA6, 0x3D, 0xE9, 0xC8, 0x9F, 0xA6, 0x63, 0x60, 0xE2, 0x83, 0x91, 0xFD, 0xEF, 0x92, 0xF3,
+    0x3D, 0x49, 0xF1, 0x98, 0x59, 0x71, 0xE9, 0x9C, 0x15, 0xAE, 0x6F, 0xB9, 0x90, 0xB7, 0xD1, 0xF4,
+    0x90, 0xF2, 0xFA, 0xF9, 0xA8, 0xC8, 0x29, 0x79, 0x7E, 0x63, 0x80, 0x8A, 0xA3, 0xD7, 0x77, 0xF6,
+    0x34, 0xCF, 0x05, 0x85, 0x25, 0x08, 0x5B, 0x84, 0x29, 0xC2, 0x92, 0xF4, 0xF9, 0xC4, 0xD7, 0xCD,
+    0xC5, 0x72, 0xEC, 0xB1, 0xE2, 0x1C, 0xC8, 0xF2, 0xF2, 0x83, 0x6B, 0xF7, 0xB1, 0xF2, 0x62, 0xE4,
+    0x32, 0x2C, 0x66, 0x66, 0xEC, 0x1B, 0x23, 0x43, 0xDB, 0x4A, 0xCE, 0xA7, 0x22, 0x97, 0xEA, 0x65,
+    0xB3, 0x6B, 0x8D, 0xB4, 0x87, 0x2D, 0x24, 0x7A, 0x0A, 0xED, 0x87, 0xDB, 0xB2, 0x02, 0xAB, 0x63,
+    0x0E, 0x21, 0xA2, 0x55, 0xBB, 0xA9, 0x3E, 0xB9, 0x48, 0xD4, 0x68, 0x2C, 0xD6, 0xCD, 0x6D, 0xF3,
+    0x59, 0x4A, 0x4B, 0x24, 0x5E, 0x0E, 0x5B, 0xA4, 0x65, 0x11, 0x07, 0xA4, 0x7D, 0xF1, 0x84, 0xA7,
+    0x9D, 0x73, 0x84, 0xB6, 0xBD, 0x76, 0x42, 0x3B, 0x2A, 0x69, 0xB9, 0xB0, 0x4B, 0xFB, 0x29, 0x18,
+    0x36, 0x50, 0xAD, 0xD8, 0x4D, 0x69, 0xF6, 0x78, 0xAD, 0x56, 0xBC, 0xDB, 0x99, 0x11, 0x03, 0x03,
+    0x6B, 0x13, 0x90, 0xBF, 0x0A, 0x95, 0x56, 0xB6, 0x50, 0x8B, 0x9C, 0xD1, 0xE8, 0x49, 0xAB, 0x49,
+    0x33, 0x40, 0x27, 0x6B, 0xF3, 0xEC, 0xF8, 0xF8, 0x46, 0xDA, 0x3B, 0x9B, 0xBB, 0xA4, 0x5E, 0x61,
+    0x43, 0xDA, 0x8D, 0x2D, 0x30, 0xA6, 0x67, 0x77, 0x1A, 0x17, 0xDE, 0x8D, 0xEE, 0x79, 0x81, 0x43,
+    0x79, 0xC8, 0x4E, 0x9C, 0x35, 0xCB, 0x27, 0xC0, 0x4A, 0x27, 0xFC, 0xBC, 0x41, 0xCA, 0x38, 0xBA,
+    0xDF, 0x33, 0x5F, 0x23, 0x3E, 0xCB, 0x6A, 0xE7, 0x2C, 0x34, 0x33, 0x91, 0xF7, 0x3E, 0x6F, 0x7C,
+    0xDE, 0xF5, 0x47, 0xF3, 0x3A, 0x7F, 0xA5, 0x7C, 0xBE, 0x7D, 0x42, 0x7B, 0x2A, 0x15, 0xE9, 0xA7,
+    0x14, 0x94, 0x0C, 0xC0, 0x74, 0x4E, 0x01, 0x4B, 0x7F, 0x5C, 0x4B, 0x9F, 0x8B, 0x19, 0x7C, 0x2E,
+    0x07, 0x9E, 0x1C, 0xA2, 0x7B, 0x5F, 0x6D, 0xC3, 0xF7, 0xE0, 0xBB, 0x59, 0x77, 0xF3, 0xDB, 0x7F,
+    0xCD, 0xC3, 0x45, 0xDA, 0xA6, 0x93, 0xE1, 0x52, 0x70, 0x3D, 0xB1, 0x07, 0x68, 0xC6, 0x53, 0x36,
+    0x90, 0xEB, 0xB1, 0xB9, 0x64, 0xA7, 0x35, 0x87, 0xFC, 0x25, 0x1B, 0x37, 0x20, 0xD4, 0x51, 0xA5,
+    0xB9, 0x9D, 0x71, 0x8E, 0x22, 0xC2, 0x4F, 0xDE, 0x3C, 0x27, 0xC3, 0x4E, 0xFF, 0xEE, 0x52, 0x0C,
+    0xFC, 0x9A, 0x8A, 0x53, 0xF3, 0x38, 0x55, 0xA8, 0xA5, 0x66, 0xEF, 0x25, 0xFE, 0xE1, 0x7A, 0xA2,
+    0x57, 0xF5, 0x41, 0xF4, 0x5B, 0xA2, 0x4C, 0x63, 0x1E, 0xCB, 0xC4, 0x6A, 0x14, 0x4A, 0x74, 0xAD,
+    0x42, 0xC1, 0x8D, 0x5C, 0x33, 0xC1, 0xDE, 0x17, 0xFA, 0x93, 0x7B, 0x62, 0xEE, 0xF8, 0xF3, 0xB6,
+    0x07, 0xEC, 0x63, 0xDA, 0xBF, 0x64, 0xCB, 0x92, 0xD7, 0xF2, 0xFC, 0x48, 0xCB, 0x48, 0xF0, 0xB0,
+    0x63, 0x47, 0xDA, 0x1B, 0x82, 0x56, 0xFC, 0xAC, 0x0B, 0x53, 0xA8, 0x64, 0x27, 0x53, 0x7C, 0x91,
+    0x18, 0x0B, 0x91, 0xAC, 0x0F, 0x6A, 0x78, 0xFE, 0xC4, 0xBF, 0x5F, 0x51, 0x7A, 0xE3, 0x0C, 0x9C,
+    0xF7, 0xB2, 0x4B, 0xE7, 0xEB, 0xB9, 0x2D, 0x7E, 0x74, 0x09, 0xA3, 0x10, 0xC0, 0xBA, 0x82, 0x15,
+    0x38, 0x3C, 0x09, 0x3A, 0x9F, 0x7F, 0xA3, 0xA7, 0xE6, 0xF8, 0x8F, 0x74, 0xEB, 0x77, 0x2E, 0xD6,
+    0x73, 0x76, 0xD8, 0xAC, 0xEE, 0xA9, 0xBA, 0x48, 0xFD, 0x0D, 0x2E, 0x16, 0xF3, 0x4F, 0x17, 0xFD,
+    0x98, 0x9F, 0xE6, 0x7E, 0xCD, 0x9C, 0x2B, 0x79, 0x89, 0xBF, 0x61, 0xC2, 0x91, 0xC3, 0x16, 0xCF,
+    0x4A, 0x36, 0xAB, 0x7C, 0x47, 0xF2, 0x1F, 0x15, 0x87, 0xFE, 0x61, 0xCB, 0x8F, 0xE0, 0x99, 0xA3,
+    0x9D, 0x84, 0x1E, 0x57, 0xAB, 0xB4, 0x10, 0x73, 0xD5, 0x3E, 0x45, 0x52, 0xCB, 0x47, 0x4D, 0x44,
+    0x74, 0x87, 0xFE, 0xC4, 0x86, 0xED, 0xB9, 0x2B, 0xCF, 0xEC, 0xBA, 0xD5, 0x91, 0xAA, 0x73, 0xA4,
+    0x78, 0xC4, 0xD7, 0xF4, 0xA4, 0x82, 0xE0, 0xD9, 0xA7, 0x8A, 0xBB, 0x91, 0x9C, 0x66, 0x93, 0xF2,
+    0x77, 0x4D, 0xCC, 0x89, 0xCE, 0x46, 0x70, 0x37, 0x4D, 0xC8, 0x49, 0xB4, 0x26, 0x70, 0xB7, 0x15,
+    0x65, 0x58, 0x0E, 0xEC, 0xC1, 0x0A, 0xEE, 0xA6, 0x88, 0xD8, 0x52, 0x16, 0x5E, 0xD9, 0xF2, 0xC6,
+    0x8A, 0x61, 0x8F, 0x78, 0x5B, 0xD1, 0xAE, 0x42, 0x41, 0xE0, 0xF5, 0x51, 0xF7, 0xD4, 0x7A, 0x4B,
+    0x1D, 0x66, 0xA9, 0xFD, 0x09, 0xFC, 0xB3, 0x0F, 0x90, 0xB0, 0xFB, 0x77, 0x3B, 0x78, 0x76, 0x04,
+    0x7A, 0xBC, 0x8F, 0xE0, 0xCC, 0x6D, 0xB8, 0x3C, 0xB5, 0x63, 0x57, 0x3E, 0x87, 0x92, 0x07, 0xEA,
+    0x8D, 0x1F, 0x4C, 0x40, 0x54, 0xA6, 0x69, 0x55, 0xF7, 0x13, 0x62, 0xC5, 0xF2, 0x38, 0xD8, 0xA6,
+    0xE6, 0x2A, 0x3A, 0x05, 0xB1, 0xAD, 0xA4, 0x0C, 0x8E, 0x2E, 0x86, 0x14, 0xF6, 0x1D, 0x16, 0x06,
+    0x0E, 0xFF, 0x0C, 0x99, 0xBB, 0x1E, 0xFB, 0xE5, 0xC8, 0xBC, 0x72, 0x29, 0x1C, 0xDE, 0xE7, 0xA7,
+    0xD4, 0xC8, 0x53, 0x69, 0x65, 0x4F, 0x08, 0x0A, 0x42, 0xAA, 0x5D, 0x79, 0xC6, 0xB2, 0x89, 0xAB,
+    0xD4, 0xEC, 0xA9, 0xDD, 0x8B, 0xF0, 0x6C, 0xC9, 0xC1, 0x03, 0x7E, 0x98, 0x28, 0x98, 0x38, 0x01,
+    0xE8, 0xD9, 0x37, 0xF9, 0xAB, 0xBC, 0x12, 0x1C, 0x5A, 0xCD, 0xA8, 0x87, 0xB0, 0x8D, 0x4E, 0xE9,
+    0x81, 0x73, 0xFD, 0xD0, 0x21, 0xBB, 0xF8, 0xEA, 0xE3, 0xA3, 0xFA, 0x65, 0x66, 0x2F, 0x5F, 0xDD,
+    0x7C, 0xF5, 0xF3, 0xD7, 0x8E, 0xFE, 0x05, 0x79, 0xA2, 0xF0, 0xE0, 0x5D, 0x57, 0xAB, 0x12, 0x2B,
+    0x5C, 0xAD, 0xAC, 0x70, 0x1B, 0xC8, 0x63, 0x40, 0xA6, 0x5B, 0x67, 0xE6, 0xBE, 0x0E, 0x4F, 0x10,
+    0x5F, 0xD5, 0xA8, 0xA5, 0x08, 0xA6, 0x37, 0x48, 0xEB, 0x74, 0x08, 0x58, 0x48, 0xB3, 0xB4, 0xB4,
+    0x5F, 0x63, 0x6E, 0xAA, 0xB4, 0x23, 0x61, 0xA6, 0x52, 0x46, 0x2D, 0x04, 0x27, 0x83, 0xDC, 0x2F,
+    0x00, 0x44, 0x38, 0xB7, 0x44, 0x05, 0x34, 0x56, 0xBC, 0x50, 0x8B, 0x7B, 0x60, 0x6D, 0x90, 0x3E,
+    0x81, 0x8D, 0x4F, 0x32, 0x32, 0x99, 0x64, 0xF1, 0xA2, 0xA1, 0x44, 0x85, 0x80, 0x63, 0x96, 0x9C,
+    0x42, 0xF5, 0x16, 0x38, 0x23, 0xCE, 0xF2, 0xE2, 0xAC, 0x27, 0xEB, 0x6A, 0xA0, 0xFF, 0xD0, 0x55,
+    0xC3, 0xB9, 0x2A, 0xBC, 0x69, 0x1D, 0xBA, 0x8C, 0x7F, 0xB8, 0xE5, 0x92, 0x4A, 0xC2, 0x47, 0x92,
+    0x78, 0x2A, 0xC9, 0x91, 0xDB, 0x0C, 0x69, 0x15, 0x0C, 0x79, 0xE5, 0x77, 0x79, 0xE3, 0x65, 0x80,
+    0x90, 0xA6, 0xA8, 0x8D, 0xD3, 0xA8, 0x50, 0xCC, 0xF6, 0x31, 0x46, 0x0E, 0x9D, 0xCA, 0xE9, 0xF7,
+    0x69, 0x6C, 0xF7, 0x68, 0xD4, 0x25, 0x99, 0xA7, 0x32, 0x0B, 0xC6, 0xBC, 0xDE, 0xF4, 0xF8, 0xF1,
+    0x84, 0x10, 0x33, 0xD0, 0x07, 0xC1, 0xCC, 0xE5, 0xFB, 0x82, 0xED, 0x42, 0xC1, 0x0D, 0x5B, 0x34,
+    0xE5, 0xB4, 0x06, 0x92, 0x1A, 0x5C, 0x8D, 0x26, 0xC7, 0x22, 0x97, 0xDC, 0x74, 0xFE, 0x61, 0x39,
+    0x6D, 0xAD, 0x29, 0xE1, 0x19, 0xA4, 0xA4, 0x64, 0xB9, 0x7B, 0x84, 0x2E, 0x71, 0xDD, 0x9F, 0xA1,
+    0xBB, 0x6C, 0xE6, 0x9C, 0xF8, 0x57, 0xDF, 0xA5, 0xA3, 0x6E, 0x38, 0x7D, 0x32, 0x7C, 0x58, 0xBA,
+    0xBD, 0xD7, 0xE5, 0x77, 0xD7, 0xCF, 0x03, 0x6A, 0xF6, 0x3C, 0xDE, 0x41, 0xF1, 0x5D, 0x5F, 0x57,
+    0x28, 0xB0, 0xA9, 0x81, 0xD6, 0x4A, 0x6A, 0xCE, 0xC4, 0x32, 0xBC, 0x44, 0x7F, 0x7C, 0xE2, 0xBB,
+    0xF6, 0xE9, 0xD1, 0x17, 0x09, 0x4C, 0x78, 0x2B, 0xDA, 0xE9, 0x7D, 0x1A, 0x2E, 0x6A, 0x8B, 0xED,
+    0xBC, 0x2E, 0x31, 0x36, 0xA4, 0x4C, 0x31, 0x2A, 0x4E, 0x1D, 0x64, 0x32, 0x98, 0xD7, 0x16, 0x23,
+    0xFD, 0x44, 0x4A, 0xEF, 0x29, 0x69, 0x93, 0xBA, 0xC4, 0x8F, 0x89, 0xB1, 0xF9, 0x85, 0x43, 0x49,
+    0x4B, 0x81, 0x9A, 0xAB, 0xF2, 0xB3, 0xA3, 0x92, 0x0C, 0xB3, 0xAD, 0xE6, 0x93, 0x93, 0x09, 0x16,
+    0xEA, 0x09, 0x18, 0x44, 0x5F, 0x5E, 0xFF, 0x91, 0x20, 0x93, 0x5A, 0x07, 0x8F, 0x60, 0xEE, 0xE1,
+    0x98, 0xFD, 0x26, 0x9D, 0x5C, 0x7C, 0x5E, 0xF6, 0x7A, 0x46, 0xC8, 0xD7, 0xB3, 0xFA, 0x78, 0x6D,
+    0xC9, 0xB1, 0x25, 0xAA, 0xA0, 0xA8, 0xF5, 0xFD, 0x0B, 0x0F, 0xF2, 0xBB, 0xFF, 0xC8, 0x6E, 0x47,
+    0x43, 0xFA, 0x91, 0xEC, 0x75, 0xDA, 0xC2, 0x6B, 0xAC, 0xC8, 0x1D, 0x45, 0x53, 0x71, 0x73, 0x50,
+    0x04, 0xF2, 0x5B, 0x64, 0x85, 0x66, 0xBA, 0xB9, 0xCE, 0x86, 0x21, 0xF3, 0x6F, 0x22, 0x95, 0xB8,
+    0xE0, 0x1F, 0x73, 0x31, 0x8F, 0x0F, 0xF1, 0x05, 0xC1, 0x55, 0x3B, 0xE8, 0xC8, 0x2A, 0xEA, 0xAE,
+    0x75, 0x82, 0x8C, 0x52, 0xC2, 0x34, 0x7C, 0x9C, 0x0B, 0x70, 0x8F, 0xF8, 0x01, 0x40, 0x62, 0xFC,
+    0x85, 0x48, 0xF5, 0x81, 0xFE, 0x00, 0x4D, 0xA9, 0x62, 0x66, 0x38, 0x9F, 0x51, 0x44, 0xDF, 0x2A,
+    0x41, 0x39, 0x97, 0xB2, 0x76, 0xA0, 0x7D, 0xD8, 0xED, 0xA5, 0xA4, 0x6D, 0xF8, 0x0F, 0xF6, 0xFE,
+    0xAA, 0x7A, 0x25, 0x81, 0x06, 0x9B, 0x52, 0x85, 0xFD, 0xA2, 0xBD, 0x75, 0x48, 0x01, 0xED, 0xBF,
+    0xEC, 0xF5, 0xA4, 0x77, 0xE3, 0xC3, 0x78, 0xA5, 0x4A, 0xB9, 0xCC, 0x81, 0x8B, 0x26, 0x82, 0x1B,
+    0x57, 0xE0, 0xB8, 0x43, 0x8E, 0x2B, 0x74, 0xDC, 0xE9, 0x7C, 0x01, 0x8F, 0x33, 0x7A, 0x5C, 0xE1,
+    0xE3, 0x8A, 0x1F, 0x57, 0x00, 0xB9, 0xE3, 0xD9, 0x8B, 0xA1, 0x00, 0x35, 0x2A, 0xD8, 0x9E, 0xFD,
+    0xA5, 0x65, 0xF4, 0xD6, 0x6F, 0x2C, 0xFB, 0x7B, 0x5A, 0xC1, 0xEE, 0xC5, 0xDF, 0x6B, 0x85, 0x95,
+    0xAD, 0xFF, 0x4A, 0x2A, 0xD8, 0xFF, 0x0F, 0x85, 0x56, 0x31, 0x8C, 0xE4, 0x48, 0x15, 0x7D, 0x6E,
+    0x4F, 0xB7, 0x01, 0x8B, 0xF5, 0x06, 0xD3, 0x62, 0x99, 0xE3, 0x54, 0x17, 0x0C, 0xD2, 0x32, 0xBA,
+    0xC1, 0xC9, 0x05, 0x17, 0x4C, 0x77, 0x79, 0x75, 0x12, 0x1B, 0x20, 0xA4, 0x0E, 0xA6, 0x45, 0xC6,
+    0x6E, 0x70, 0x01, 0x37, 0x08, 0x8D, 0xC8, 0x1A, 0x69, 0x66, 0x6C, 0x8E, 0x80, 0x80, 0xA4, 0x45,
+    0x42, 0xC8, 0x04, 0x8B, 0x98, 0x6D, 0x82, 0xBD, 0x04, 0x69, 0x82, 0x9E, 0x75, 0xA1, 0x0B, 0x08,
+    0x2E, 0xB1, 0x10, 0xD2, 0xA5, 0xD6, 0x4A, 0x17, 0x40, 0x82, 0x41, 0x5E, 0xC9, 0x3B, 0xD8, 0x5D,
+    0xBC, 0x6F, 0xF7, 0xEC, 0xDC, 0xB2, 0xA3, 0xA5, 0xAA, 0xEC, 0xB2, 0xAB, 0x7E, 0xD5, 0xFF, 0xF5,
+    0xFF, 0xFB, 0xFF, 0xD7, 0xCE, 0x19, 0xC2, 0x06, 0x9E, 0x85, 0x63, 0x13, 0xE8, 0x0C, 0x5E, 0x01,
+    0x4C, 0xB0, 0x38, 0x85, 0xCD, 0x5D, 0x9B, 0xF8, 0x0D, 0x54, 0x01, 0x9D, 0x60, 0x13, 0xC0, 0xC1,
+    0x29, 0x60, 0x4B, 0xB8, 0xB6, 0x86, 0xFF, 0xDC, 0x22, 0x34, 0x3A, 0x89, 0x11, 0x64, 0x9B, 0x70,
+    0x22, 0x9C, 0x61, 0xD3, 0xB3, 0xC9, 0x48, 0xD9, 0xE7, 0xB5, 0xB6, 0xB6, 0x1E, 0x7B, 0xB6, 0x38,
+    0x42, 0x9A, 0x01, 0x1B, 0x38, 0x58, 0x3C, 0x8E, 0x6D, 0xC3, 0x36, 0x9C, 0xEE, 0x2F, 0x58, 0x4E,
+    0x2D, 0x4B, 0x71, 0xC0, 0xAF, 0xF9, 0x23, 0x6C, 0xD5, 0xD0, 0xE9, 0xBD, 0x95, 0xB6, 0xB5, 0xB2,
+    0xA5, 0x6B, 0x0D, 0x19, 0xF9, 0xB9, 0xAE, 0xA5, 0x86, 0x55, 0x3F, 0x92, 0xF5, 0xC2, 0x47, 0x67,
+    0xA9, 0x89, 0xF3, 0xD4, 0x68, 0x13, 0x9B, 0xAF, 0x45, 0x5B, 0x78, 0xEB, 0x05, 0x62, 0x9B, 0x9C,
+    0x87, 0xE6, 0x9D, 0xC0, 0x40, 0x19, 0xA4, 0x91, 0x5B, 0xA1, 0x57, 0xA0, 0x97, 0xC3, 0x79, 0x84,
+    0xC0, 0x42, 0x3F, 0x31, 0x47, 0x6E, 0xD6, 0x35, 0xFD, 0xC0, 0x28, 0x1B, 0x71, 0xDC, 0x59, 0x7C,
+    0xEF, 0xB1, 0x6B, 0x83, 0xDA, 0xAF, 0x55, 0x11, 0x14, 0xDA, 0x84, 0x26, 0x45, 0x8C, 0x9A, 0x3C,
+    0x27, 0xD8, 0x41, 0xEF, 0x34, 0x4C, 0x82, 0x2C, 0x28, 0xE2, 0xC4, 0x5D, 0xAD, 0xA8, 0x8E, 0x1A,
+    0x48, 0x4B, 0x60, 0x38, 0xC1, 0xDD, 0xE3, 0xB6, 0x7C, 0x67, 0x90, 0x8C, 0x7D, 0xF3, 0x3F, 0x6D,
+    0xF1, 0x8B, 0x05, 0x74, 0x6E, 0x13, 0x55, 0xE8, 0xCC, 0xAB, 0x54, 0xE1, 0x34, 0x5E, 0x89, 0xD8,
+    0xA9, 0xD1, 0x6F, 0x75, 0x06, 0x84, 0x09, 0xF7, 0xC9, 0xA9, 0xB9, 0xA2, 0xEB, 0xF9, 0x3F, 0x86,
+    0x6F, 0x74, 0xA4, 0x8C, 0xBA, 0xB4, 0x91, 0x6F, 0x85, 0x17, 0xF9, 0xF4, 0x49, 0xFB, 0x11, 0x7C,
+    0x9B, 0x87, 0xB6, 0xA2, 0xB2, 0x9E, 0xE2, 0x29, 0x55, 0x33, 0xE1, 0xF0, 0x57, 0x71, 0xE1, 0x56,
+    0x41, 0x12, 0x42, 0x47, 0x3A, 0x8B, 0x4B, 0x51, 0x8D, 0x2A, 0x07, 0xF3, 0xC1, 0x5C, 0x55, 0x61,
+    0x1D, 0x36, 0xAA, 0xF1, 0x1A, 0x9E, 0xA1, 0xEA, 0x15, 0xA1, 0x39, 0xC1, 0x6D, 0x0C, 0xE6, 0x21,
+    0x69, 0xE2, 0x9A, 0x94, 0x99, 0x46, 0x88, 0xC0, 0x50, 0x35, 0x17, 0xD8, 0x10, 0x7A, 0xFD, 0x25,
+    0x7A, 0x77, 0x4D, 0x4F, 0x53, 0xEB, 0x1A, 0x41, 0x83, 0x9E, 0x05, 0x62, 0x83, 0x20, 0x17, 0x7B,
+    0x2E, 0x4E, 0x69, 0x0C, 0xA2, 0x22, 0xA8, 0x04, 0x14, 0x29, 0xDA, 0xC3, 0xCC, 0x51, 0x4C, 0x0B,
+    0x5B, 0x2C, 0x0A, 0xB0, 0x3E, 0xE4, 0xEB, 0x79, 0x64, 0x8B, 0xCB, 0x53, 0xF9, 0x3D, 0x58, 0x9C,
+    0xA6, 0xB6, 0x64, 0x1B, 0xFE, 0xB0, 0x44, 0xEF, 0xB5, 0x86, 0x89, 0x9F, 0xAB, 0x96, 0x79, 0xAF,
+    0x46, 0xED, 0x95, 0xB1, 0xF9, 0x88, 0xFB, 0x79, 0x59, 0x68, 0xC6, 0xD8, 0x63, 0x1D, 0x43, 0x65,
+    0x3D, 0xA2, 0xC5, 0x35, 0x52, 0xBF, 0xF1, 0xB7, 0x74, 0x75, 0xF0, 0x98, 0xEA, 0x5A, 0xA5, 0xAB,
+    0x6E, 0xA4, 0x97, 0xF4, 0x12, 0xE9, 0xAF, 0x46, 0x7A, 0xC9, 0x74, 0x6A, 0xED, 0x62, 0x81, 0x6F,
+    0xF2, 0x84, 0x52, 0xC7, 0x38, 0x49, 0x9B, 0xB4, 0x8E, 0x8B, 0x7E, 0xF4, 0x21, 0x2A, 0xD6, 0x73,
+    0x2C, 0x79, 0xEA, 0x78, 0xA5, 0x57, 0x41, 0xE3, 0x4C, 0xFC, 0xB9, 0xAE, 0xA8, 0x92, 0x5A, 0x57,
+    0x83, 0xA4, 0x35, 0xCA, 0x1A, 0x53, 0x5A, 0x30, 0x95, 0x75, 0x98, 0x62, 0xF1, 0x57, 0xD0, 0xD6,
+    0x1C, 0x7B, 0x6B, 0xE0, 0xD0, 0xBC, 0xA1, 0x4D, 0xA8, 0xAE, 0xAD, 0xD3, 0x30, 0xD7, 0x34, 0xD9,
+    0x09, 0x15, 0x37, 0x01, 0x22, 0x50, 0x56, 0x6A, 0xD5, 0xB5, 0x91, 0x68, 0x4C, 0x65, 0xDC, 0xEF,
+    0xDB, 0x04, 0xA8, 0x8D, 0x74, 0x05, 0xA7, 0x22, 0x82, 0x39, 0x20, 0x5E, 0x13, 0xB7, 0xF3, 0xFA,
+    0x32, 0x53, 0x36, 0x1B, 0xD8, 0x64, 0xB3, 0xC3, 0x11, 0x86, 0xD3, 0x69, 0x24, 0x3E, 0x20, 0x0F,
+    0x7D, 0xAF, 0x28, 0xE1, 0x14, 0x44, 0x47, 0xC1, 0xAD, 0x27, 0xF3, 0xED, 0x41, 0xFE, 0xBE, 0x5F,
+    0x2C, 0x6F, 0x11, 0x03, 0xEA, 0xE3, 0xF2, 0xA9, 0xB8, 0x43, 0x12, 0x9A, 0xA0, 0xB0, 0x64, 0xD7,
+    0x74, 0x50, 0x11, 0x28, 0x49, 0x21, 0x9C, 0x9C, 0xB5, 0x43, 0x06, 0x6B, 0x87, 0x3C, 0x81, 0x9F,
+    0xC9, 0xD4, 0x48, 0x20, 0x46, 0xDB, 0x87, 0x5F, 0xA4, 0x51, 0x60, 0x6D, 0x4B, 0xD3, 0xC2, 0x4F,
+    0xCA, 0xE1, 0xBC, 0x5B, 0xC3, 0x71, 0xF5, 0x8F, 0x34, 0xD2, 0x50, 0x89, 0x40, 0x52, 0xA6, 0x9C,
+    0x17, 0xB8, 0xEB, 0x53, 0x05, 0xCA, 0x5E, 0xD6, 0x3A, 0xB5, 0xD5, 0x31, 0x1D, 0xF9, 0xC7, 0x88,
+    0x5B, 0xA5, 0xD1, 0x7F, 0x3B, 0x47, 0xDE, 0x59, 0x9C, 0x4D, 0xA7, 0x62, 0x80, 0xAE, 0xD0, 0x95,
+    0x1F, 0x5F, 0xFD, 0xA7, 0x96, 0x78, 0x5E, 0x97, 0xAB, 0x79, 0x1E, 0x77, 0x1F, 0x8F, 0xB0, 0xE9,
+    0xDB, 0xE4, 0x78, 0x1D, 0x20, 0xAA, 0xB1, 0xDF, 0x06, 0x08, 0x23, 0x0E, 0x2E, 0x25, 0xB6, 0xB2,
+    0xB3, 0x6C, 0xBD, 0x38, 0x5B, 0x2F, 0xD7, 0xED, 0x62, 0xB3, 0xEE, 0x76, 0x24, 0x74, 0x2C, 0x44,
+    0x8E, 0xDB, 0x94, 0x92, 0x4A, 0xF0, 0xBB, 0x03, 0x79, 0x82, 0x5A, 0x62, 0x8C, 0xD1, 0x2B, 0xAC,
+    0x68, 0x58, 0x9E, 0xFE, 0xEB, 0x78, 0x59, 0x1E, 0xF2, 0xA9, 0x3B, 0x7A, 0x46, 0x07, 0xB8, 0x54,
+    0x80, 0x47, 0x9E, 0x0C, 0x1A, 0x50, 0x0C, 0x2E, 0x21, 0xA7, 0xC7, 0x7C, 0x8E, 0x5E, 0x27, 0xF3,
+    0x6F, 0x20, 0xBB, 0xB8, 0x81, 0x2C, 0xBB, 0x99, 0xEC, 0xDD, 0x97, 0x22, 0x1C, 0x13, 0x08, 0x7E,
+    0x0B, 0x62, 0xDF, 0xC4, 0xD1, 0x4C, 0xC4, 0x8F, 0xC4, 0xD8, 0x62, 0xF4, 0x1A, 0x6E, 0x71, 0x05,
+    0x04, 0x2A, 0x70, 0x72, 0x05, 0x8C, 0xE7, 0xD3, 0x69, 0x0B, 0x88, 0xAB, 0x47, 0xC6, 0x24, 0x72,
+    0x0E, 0xEE, 0x9D, 0xEA, 0xFF, 0x34, 0x7F, 0x3A, 0xF9, 0x51, 0xBE, 0xE7, 0xE7, 0xEF, 0xFA, 0xC0,
+    0xFB, 0xDF, 0x1A, 0x1F, 0xAB, 0x92, 0xBE, 0x55, 0x1D, 0x1F, 0x6F, 0xDF, 0x71, 0x12, 0x65, 0x46,
+    0x3C, 0xCC, 0x08, 0x62, 0x7A, 0x2F, 0x73, 0x33, 0x89, 0x33, 0x9B, 0xAF, 0x18, 0xE3, 0x4A, 0x2C,
+    0xD1, 0xE6, 0x95, 0xF1, 0x24, 0x04, 0x54, 0x12, 0x02, 0x5C, 0x4E, 0xA7, 0x89, 0x00, 0xBA, 0x0D,
+    0x01, 0xBD, 0x2E, 0x04, 0xD4, 0x08, 0x73, 0x81, 0xB2, 0x6C, 0xF4, 0x46, 0x33, 0x86, 0x49, 0x9C,
+    0xC5, 0xB9, 0xCA, 0x85, 0xEF, 0x49, 0xCB, 0x85, 0x5A, 0x71, 0xA9, 0x31, 0xB7, 0x41, 0xF8, 0xAB,
+    0xAA, 0xD1, 0x7F, 0xF9, 0xB7, 0x8D, 0x3F, 0x7B, 0x66, 0xF5, 0x67, 0x7F, 0x5E, 0xF5, 0x83, 0xE4,
+    0x43, 0x38, 0xB4, 0x5D, 0x96, 0xE6, 0x69, 0x1E, 0xE7, 0x31, 0x83, 0x93, 0x9F, 0xBF, 0xC9, 0x33,
+    0xFE, 0x1F, 0xC4, 0x6E, 0x0C, 0xCF, 0xC3, 0xFD, 0xB8, 0x89, 0x9B, 0xE1, 0x05, 0xCD, 0x20, 0x15,
+    0xEF, 0x01, 0xFB, 0xCB, 0x0D, 0xCF, 0x96, 0xBB, 0xCA, 0xBE, 0x58, 0x4A, 0xAA, 0xDA, 0x0B, 0x6C,
+    0x39, 0xA3, 0x7F, 0xB6, 0xE6, 0x93, 0x20, 0x3C, 0x98, 0xD3, 0x9C, 0x34, 0xB1, 0xC0, 0x49, 0xF1,
+    0xF1, 0x68, 0xE6, 0x7D, 0x8C, 0x3C, 0x9B, 0x2D, 0x15, 0xE9, 0xB9, 0xA6, 0x1C, 0x0F, 0x6C, 0x76,
+    0x24, 0x47, 0xF6, 0xF3, 0x8E, 0xAE, 0xA5, 0xE5, 0x1A, 0xAA, 0xED, 0x8D, 0x2A, 0x7A, 0xB3, 0x17,
+    0xB8, 0x30, 0xC1, 0xA2, 0x60, 0x2E, 0x64, 0x0A, 0xF0, 0x91, 0xF7, 0xD0, 0xBA, 0x1D, 0x7A, 0x09,
+    0x93, 0x55, 0xED, 0x65, 0x57, 0x35, 0x96, 0x44, 0xA9, 0x9A, 0x75, 0xF7, 0xF3, 0x09, 0xA6, 0xE8,
+    0xFF, 0x74, 0xD6, 0x92, 0xEE, 0xCE, 0xDA, 0x48, 0xCD, 0xEE, 0xD6, 0xDE, 0x27, 0xD8, 0x05, 0x6E,
+    0x6D, 0x7E, 0x22, 0x1B, 0x1B, 0x69, 0xDC, 0x48, 0x1A, 0xBE, 0xC2, 0x91, 0x6D, 0xDC, 0x7E, 0x9B,
+    0xDD, 0x6C, 0x63, 0x26, 0x9C, 0x6F, 0xEF, 0xCE, 0x08, 0x4B, 0x6C, 0xEC, 0xCE, 0xF6, 0x64, 0x93,
+    0xDD, 0xD9, 0x36, 0xBB, 0x3B, 0xBB, 0xEB, 0x3D, 0xB7, 0x5B, 0xCA, 0x3B, 0x90, 0xEE, 0xBD, 0xF6,
+    0x8C, 0x72, 0xCC, 0xF5, 0x9E, 0xCE, 0x0F, 0xF0, 0xB3, 0x08, 0x6B, 0x7E, 0x5C, 0x70, 0xB7, 0x13,
+    0x02, 0xD7, 0xDD, 0xAB, 0xE2, 0x8A, 0x4F, 0x9E, 0x50, 0x57, 0xCC, 0x93, 0x4D, 0x98, 0xCD, 0x18,
+    0x4E, 0x1D, 0x66, 0x5D, 0x9D, 0x8C, 0x98, 0x05, 0x88, 0x5B, 0x7E, 0x3B, 0x89, 0x98, 0x41, 0x02,
+    0x9B, 0xE4, 0x46, 0xC9, 0x91, 0x92, 0x2B, 0xDB, 0x00, 0x75, 0x43, 0x2E, 0x15, 0x1F, 0x38, 0xB9,
+    0x10, 0x1F, 0x08, 0x5B, 0x1F, 0xE0, 0x00, 0x13, 0xA6, 0x2A, 0xE3, 0x28, 0x66, 0x3E, 0xA6, 0x0A,
+    0xFA, 0xAF, 0x73, 0x94, 0x32, 0x93, 0x00, 0x99, 0xD1, 0x4B, 0x1A, 0x66, 0x9E, 0x26, 0x2C, 0x54,
+    0xB5, 0x57, 0x9C, 0xE0, 0x7C, 0xC6, 0xB4, 0xB6, 0xB7, 0xCD, 0x5B, 0x41, 0x68, 0x3C, 0xBA, 0xAC,
+    0xC7, 0x3B, 0x42, 0x4C, 0x65, 0x85, 0x49, 0x5A, 0xD8, 0xD2, 0x96, 0x71, 0x31, 0x88, 0x98, 0xED,
+    0xDE, 0x29, 0x92, 0xD1, 0x1F, 0xCC, 0x5B, 0xAB, 0x68, 0xEB, 0x32, 0x3A, 0xF9, 0x63, 0xB6, 0xFD,
+    0xAF, 0x84, 0x83, 0xCE, 0x64, 0xBF, 0x95, 0x76, 0x74, 0xF8, 0x5B, 0x33, 0x0B, 0x7A, 0x99, 0x3C,
+    0x47, 0xEA, 0x83, 0x8C, 0x86, 0x36, 0x7E, 0xB1, 0xA2, 0x89, 0x77, 0x79, 0x46, 0xDD, 0xC4, 0x35,
+    0xBB, 0x19, 0x1E, 0xEE, 0xB6, 0x72, 0x78, 0x89, 0xEA, 0x32, 0x52, 0x7B, 0xF3, 0x02, 0x24, 0xC4,
+    0x47, 0x1D, 0x98, 0xB4, 0x5D, 0xA4, 0xBC, 0x11, 0x61, 0x40, 0x80, 0xBF, 0x90, 0xB9, 0x2D, 0x7B,
+    0x19, 0x5D, 0xC7, 0xB6, 0x71, 0xFB, 0xF6, 0x4D, 0x70, 0xB5, 0xBE, 0x94, 0xF8, 0x4D, 0x6F, 0xB3,
+    0x04, 0xF0, 0x21, 0x37, 0x0B, 0xC5, 0x33, 0x38, 0xD9, 0x63, 0x57, 0x09, 0x4D, 0x7F, 0xF1, 0x7B,
+    0xBE, 0xDB, 0x48, 0x7A, 0xD6, 0x86, 0xD5, 0xFA, 0xCB, 0xDF, 0xDD, 0x7B, 0x28, 0x6E, 0xB6, 0xFF,
+    0x92, 0x49, 0x2A, 0x9B, 0xE1, 0xC8, 0xE5, 0x14, 0x3F, 0xEA, 0x40, 0x68, 0xFE, 0x7E, 0x58, 0x86,
+    0x99, 0x43, 0x37, 0xB4, 0xB9, 0x26, 0x47, 0x7E, 0x24, 0x77, 0x85, 0xF5, 0xC1, 0xD9, 0xB5, 0x70,
+    0x94, 0xD5, 0x3E, 0x42, 0x27, 0xBB, 0xAC, 0xEC, 0x36, 0xE7, 0xD9, 0xBE, 0x00, 0x7E, 0x62, 0x23,
+    0xAF, 0x95, 0xE7, 0x30, 0xEB, 0xCE, 0xEE, 0x96, 0xDF, 0xED, 0x16, 0x9D, 0x5F, 0xAF, 0x77, 0xBA,
+    0x88, 0x5F, 0xB4, 0x0B, 0xAB, 0xF6, 0x5D, 0xB6, 0xE3, 0x6D, 0x7A, 0x73, 0xD6, 0x7A, 0xE8, 0x4F,
+    0x30, 0xBE, 0xC0, 0x1E, 0x55, 0xC1, 0xAB, 0x8E, 0xC5, 0x52, 0xA3, 0xD2, 0x58, 0xD2, 0x7A, 0x0F,
+    0x12, 0x67, 0x02, 0x75, 0x81, 0x91, 0xC2, 0x32, 0x88, 0x52, 0x1B, 0x2D, 0x25, 0x12, 0x43, 0xDF,
+    0x87, 0xCF, 0xFC, 0x1C, 0x05, 0x89, 0x83, 0x21, 0xAD, 0x1A, 0x5C, 0x57, 0xA3, 0x0B, 0xBA, 0xB9,
+    0xFF, 0x24, 0x09, 0x99, 0xF8, 0xDD, 0x7C, 0xEC, 0x16, 0x7C, 0xF3, 0x3B, 0xF8, 0xBE, 0xE9, 0xAD,
+    0x30, 0xEC, 0x47, 0x71, 0x90, 0xF1, 0xF7, 0xBA, 0x79, 0x99, 0xFA, 0x5D, 0xE6, 0x3D, 0x2B, 0x9D,
+    0x7D, 0x04, 0x4F, 0x30, 0x0E, 0x30, 0xDA, 0x10, 0x16, 0xC7, 0xAD, 0x65, 0xC2, 0xFB, 0x18, 0xD0,
+    0x66, 0x3B, 0x89, 0xC0, 0xD6, 0x33, 0xCE, 0x7D, 0xA3, 0x52, 0x33, 0x0E, 0xCC, 0xC8, 0xE7, 0xF5,
+    0x42, 0x1A, 0x3F, 0xC2, 0x07, 0x99, 0xFF, 0xAC, 0x5C, 0x88, 0xEC, 0x12, 0x7C, 0x42, 0x0A, 0x94,
+    0x9A, 0xF0, 0xFE, 0xAB, 0x5C, 0xDC, 0x3C, 0xFD, 0xB4, 0x1C, 0xF6, 0x79, 0x60, 0x9D, 0xFE, 0xB3,
+    0x82, 0xFA, 0x25, 0x93, 0x86, 0xFA, 0x20, 0x5F, 0xBE, 0xFE, 0x2A, 0x78, 0xDD, 0xF9, 0x6B, 0x15,
+    0x63, 0xB3, 0x8F, 0x38, 0x8E, 0xD4, 0xAF, 0x23, 0xE6, 0x24, 0x85, 0x75, 0x0B, 0xA3, 0x2E, 0xFB,
+    0x7B, 0x50, 0x93, 0x34, 0x57, 0x78, 0x59, 0xE7, 0x5E, 0x39, 0xBC, 0x37, 0x89, 0x7F, 0x53, 0xAA,
+    0xC8, 0x04, 0x1F, 0x27, 0xDE, 0xA7, 0x91, 0xFB, 0x39, 0x7A, 0x97, 0x6D, 0xA2, 0x3B, 0x87, 0x4C,
+    0x7D, 0x9E, 0xFB, 0x1C, 0x6C, 0x64, 0xA4, 0xF7, 0x14, 0x5E, 0x90, 0xBC, 0xED, 0xE7, 0xE9, 0x83,
+    0xEA, 0xBF, 0xED, 0x7D, 0x3D, 0x90, 0xE5, 0xD6, 0x75, 0xE6, 0xC5, 0x03, 0xBB, 0x61, 0xF3, 0xED,
+    0x1A, 0x0C, 0x38, 0x92, 0xCD, 0xF1, 0x0A, 0x1B, 0x28, 0xB0, 0x68, 0x9B, 0x48, 0x36, 0x50, 0x40,
+    0x0E, 0x40, 0x29, 0x60, 0xB0, 0xC1, 0x4E, 0x30, 0x3D, 0xAC, 0x32, 0x83, 0x71, 0xC0, 0xAD, 0x92,
+    0xE5, 0xDA, 0xEA, 0x64, 0x83, 0x0D, 0x66, 0x06, 0x20, 0x19, 0x38, 0x50, 0xA0, 0xD9, 0x2A, 0xC9,
+    0xAE, 0xDA, 0x64, 0x19, 0x50, 0x2E, 0xB2, 0x19, 0x8C, 0x03, 0x07, 0xDE, 0xDA, 0x19, 0x02, 0xE2,
+    0x94, 0x4B, 0x01, 0x03, 0x82, 0xD2, 0xD2, 0x0C, 0x1C, 0x08, 0xB2, 0xD9, 0xF2, 0x2E, 0x19, 0x0C,
+    0x2C, 0x63, 0xAC, 0xD7, 0x33, 0x00, 0xEE, 0x9E, 0xF3, 0x9D, 0x73, 0x01, 0xBC, 0xD7, 0xDD, 0xF3,
+    0x43, 0x0E, 0xA9, 0x19, 0xDA, 0x4D, 0xCE, 0x3D, 0xA7, 0xFB, 0xE1, 0x01, 0x17, 0xF7, 0xE7, 0xFC,
+    0x9F, 0x73, 0x4D, 0xB6, 0x32, 0xF4, 0x13, 0x77, 0xDC, 0x06, 0x96, 0x5B, 0xCF, 0xE6, 0x0C, 0x92,
+    0x0A, 0x7F, 0x6A, 0xCC, 0xDA, 0x4F, 0x61, 0xE9, 0x27, 0xE7, 0xC6, 0x96, 0x01, 0xDA, 0x85, 0xAD,
+    0x4C, 0x5C, 0x7A, 0xD4, 0x86, 0xB3, 0x76, 0x89, 0x96, 0x6F, 0x76, 0xB8, 0xDD, 0xDF, 0x39, 0x4D,
+    0xAD, 0xB5, 0xED, 0xD8, 0xCA, 0x5F, 0x8E, 0xBB, 0xDE, 0xB5, 0x5E, 0xC3, 0xED, 0x02, 0xAD, 0xDF,
+    0xF0, 0x73, 0x83, 0xC6, 0xB7, 0x37, 0xF7, 0x2E, 0x37, 0xE8, 0x8F, 0xB6, 0x5B, 0x66, 0x0B, 0xBD,
+    0xE7, 0xFE, 0x27, 0x4D, 0xD2, 0x8C, 0x2D, 0xFE, 0x22, 0x9F, 0x3E, 0x5C, 0x6F, 0x94, 0x00, 0x18,
+    0x93, 0x6D, 0x42, 0x93, 0x74, 0xD4, 0x98, 0x8B, 0x0C, 0x63, 0x63, 0x2E, 0x30, 0x8C, 0x8C, 0x39,
+    0xAF, 0xF0, 0x77, 0x18, 0x3E, 0x8A, 0xB9, 0xEC, 0xE4, 0x5D, 0x0F, 0xC3, 0x5D, 0x7B, 0x89, 0x21,
+    0xDD, 0xAF, 0x53, 0xC8, 0x6B, 0x20, 0x19, 0x4C, 0x64, 0x4B, 0x5C, 0xE7, 0x8F, 0xB0, 0x06, 0x5C,
+    0x28, 0xF4, 0x36, 0xE0, 0x62, 0x84, 0xD5, 0xDA, 0xF7, 0x02, 0x5E, 0x4D, 0xD9, 0x60, 0x76, 0xE9,
+    0xBE, 0x11, 0xBF, 0xD2, 0x4A, 0x21, 0x16, 0xD9, 0xDE, 0xAB, 0xD4, 0xE0, 0x2B, 0xF4, 0x05, 0xFE,
+    0x43, 0x88, 0x9E, 0xC5, 0x35, 0xB7, 0x59, 0xCA, 0xED, 0xE3, 0xEB, 0x33, 0x65, 0xF0, 0xF2, 0xE9,
+    0x49, 0xFB, 0xD1, 0x9E, 0x4D, 0xF9, 0x9B, 0x09, 0xDA, 0x68, 0xD6, 0x86, 0x39, 0xB7, 0x8F, 0xA6,
+    0x72, 0xDF, 0xCF, 0xAE, 0x0D, 0x2C, 0x6F, 0x0E, 0xEA, 0x4D, 0xED, 0x5A, 0xF7, 0xB3, 0xCB, 0x6F,
+    0xC9, 0x8B, 0x29, 0x37, 0xF1, 0xF0, 0x3C, 0x7D, 0x42, 0xFF, 0x17, 0x34, 0xBF, 0x25, 0xAD, 0xC5,
+    0xC0, 0xA6, 0xD4, 0x86, 0xF4, 0xB6, 0x71, 0x19, 0x0D, 0xC6, 0x3C, 0x62, 0xE2, 0x1E, 0x73, 0xD1,
+    0x4F, 0x33, 0x23, 0x2D, 0xCD, 0xF3, 0x20, 0xB3, 0xCD, 0x23, 0xB8, 0xB7, 0xB7, 0xFE, 0xA9, 0x5C,
+    0x2F, 0xDF, 0xE5, 0xFB, 0xD0, 0xD8, 0x61, 0x04, 0x97, 0x3C, 0xB2, 0x7F, 0xE8, 0x63, 0x75, 0x19,
+    0xEA, 0xC7, 0xB2, 0xA1, 0x69, 0xFD, 0x88, 0x17, 0x30, 0x8F, 0x1B, 0x8F, 0x22, 0xEF, 0x78, 0x6F,
+    0xC7, 0xF5, 0xF5, 0x24, 0xFF, 0xCE, 0x5D, 0xF5, 0x87, 0x67, 0x6D, 0x1D, 0xAE, 0xA8, 0x73, 0x71,
+    0x63, 0xE2, 0x96, 0xF6, 0x4C, 0xC8, 0x1B, 0x27, 0xAC, 0x92, 0xD6, 0x3D, 0x2E, 0xE6, 0x7B, 0x47,
+    0xFC, 0x85, 0xD0, 0xD2, 0xC2, 0xF1, 0xAD, 0xED, 0x31, 0x2D, 0x39, 0xDF, 0xBC, 0x66, 0xB4, 0xE5,
+    0x0E, 0x70, 0xFF, 0x8A, 0x0E, 0xBD, 0x8B, 0x52, 0x13, 0xF6, 0x19, 0x7D, 0xDE, 0x17, 0xD4, 0x74,
+    0x45, 0x49, 0x33, 0x9C, 0x35, 0x26, 0x6A, 0xE8, 0x7E, 0x45, 0x15, 0x72, 0x97, 0x3C, 0xDE, 0x31,
+    0xC6, 0x3B, 0x83, 0x3B, 0xA5, 0xDC, 0x93, 0x93, 0xF4, 0x07, 0x5E, 0x4F, 0x3C, 0xCC, 0xF7, 0xF3,
+    0x1F, 0x4F, 0x98, 0x6E, 0xF6, 0x7C, 0x8B, 0x16, 0x56, 0x56, 0x5A, 0x53, 0xFC, 0xD0, 0xA6, 0xFC,
+    0x8F, 0xF1, 0xAD, 0xF5, 0xC5, 0xF6, 0xB9, 0xF5, 0x85, 0x06, 0x6F, 0x15, 0xF2, 0x0E, 0xCC, 0x68,
+    0x82, 0x62, 0x9A, 0xCB, 0xA8, 0xFF, 0x6C, 0xFF, 0xF1, 0xAA, 0x61, 0x92, 0xCF, 0x2B, 0x89, 0x18,
+    0x80, 0x47, 0x7D, 0xD9, 0xA5, 0xC5, 0x59, 0xD0, 0xA3, 0x8B, 0x4B, 0x6E, 0xA7, 0xB5, 0xB2, 0xB8,
+    0x2D, 0xD6, 0x0B, 0x2F, 0xE6, 0x81, 0xF7, 0xE3, 0x62, 0xA5, 0xEB, 0xCF, 0x6B, 0x8F, 0x45, 0x16,
+    0x87, 0x91, 0x66, 0x86, 0x0C, 0x7B, 0x74, 0x23, 0x9F, 0x97, 0x25, 0x2F, 0x1F, 0x41, 0x68, 0x09,
+    0x31, 0xD2, 0xF1, 0x50, 0x03, 0x31, 0xF4, 0x7C, 0x41, 0x32, 0x22, 0x22, 0x35, 0x23, 0xF4, 0xFF,
+    0x52, 0x90, 0x9E, 0x56, 0xE5, 0x26, 0x12, 0x97, 0x7A, 0x4D, 0xA6, 0xC8, 0x9B, 0x74, 0x4F, 0x42,
+    0x8A, 0x96, 0xF7, 0x4F, 0xD2, 0xD1, 0x4B, 0x62, 0x3B, 0x0D, 0x97, 0x6D, 0x49, 0x43, 0x1D, 0xF1,
+    0x0B, 0xD1, 0x5A, 0x07, 0x72, 0x69, 0xE2, 0x0A, 0xF4, 0xEA, 0xAF, 0x60, 0xDF, 0xF1, 0xBB, 0x5F,
+    0x13, 0x72, 0x18, 0x50, 0x5F, 0x22, 0xDD, 0xF8, 0x35, 0x2D, 0xFD, 0x54, 0xC9, 0xF7, 0xF2, 0x3E,
+    0x60, 0xF8, 0xF9, 0x70, 0xC4, 0xA8, 0xCF, 0x1E, 0x33, 0x00, 0xFB, 0x26, 0xD8, 0x08, 0xAE, 0xCB,
+    0x7A, 0x87, 0x45, 0xD6, 0x61, 0xE1, 0x88, 0x2D, 0x79, 0x07, 0x29, 0x96, 0x1F, 0x81, 0xA5, 0x87,
+    0xBE, 0x41, 0x77, 0xE1, 0xF7, 0x20, 0x0C, 0x74, 0x9A, 0xB6, 0x38, 0x9E, 0xA6, 0xEF, 0x4B, 0x3D,
+    0x50, 0xEC, 0xFF, 0x2A, 0x43, 0xB0, 0x66, 0xE2, 0x39, 0x33, 0x44, 0xB9, 0xCF, 0xC8, 0x7E, 0x46,
+    0xFE, 0x33, 0x32, 0xA0, 0x19, 0x07, 0x1A, 0x59, 0xCE, 0x91, 0x88, 0x70, 0x21, 0x3C, 0x6D, 0xE5,
+    0x10, 0x90, 0x34, 0x30, 0xA2, 0x54, 0x2E, 0x06, 0x61, 0x1B, 0x59, 0xCB, 0xA7, 0x45, 0x88, 0x25,
+    0x81, 0xA5, 0xD1, 0xF4, 0xB7, 0x3E, 0xBF, 0xF4, 0x88, 0x18, 0xB3, 0xBD, 0x97, 0x4E, 0xF4, 0x54,
+    0x65, 0x23, 0x93, 0x08, 0x7D, 0x47, 0x6F, 0xCC, 0x42, 0xFE, 0xE6, 0xA5, 0x6B, 0x72, 0xC4, 0xCB,
+    0xD6, 0x56, 0xD4, 0xF3, 0xB7, 0x09, 0xF0, 0x92, 0xC9, 0x86, 0x94, 0xC7, 0x99, 0xA8, 0x29, 0x0F,
+    0x7C, 0x52, 0x02, 0x64, 0x98, 0x7E, 0xAF, 0x03, 0xA0, 0x05, 0xCE, 0x80, 0xD6, 0x30, 0x83, 0x24,
+    0x05, 0x78, 0x0B, 0xEB, 0xE2, 0xE7, 0x56, 0x97, 0x47, 0x2E, 0xA0, 0x92, 0x3F, 0xCA, 0x17, 0x40,
+    0x30, 0x6D, 0x55, 0xC8, 0x5D, 0x68, 0x90, 0x18, 0xD0, 0xB4, 0xE2, 0x66, 0x16, 0x0F, 0x02, 0x03,
+    0xB0, 0xD5, 0xC2, 0xCA, 0xD3, 0x69, 0x5C, 0xB9, 0x2F, 0x45, 0x8F, 0x09, 0x4F, 0x40, 0xDB, 0xCA,
+    0xD0, 0xB6, 0x0C, 0xBC, 0xA2, 0x55, 0x99, 0x84, 0x5F, 0x43, 0x05, 0xBE, 0x78, 0x25, 0x30, 0xE8,
+    0xF5, 0xFD, 0xAC, 0xC2, 0xB8, 0x34, 0x87, 0x7F, 0xE8, 0xE5, 0x79, 0x65, 0x30, 0x35, 0x4B, 0x33,
+    0xA5, 0x9A, 0x81, 0x3D, 0x50, 0x6A, 0x27, 0xD4, 0xD3, 0x53, 0xCA, 0xE7, 0xA0, 0xAF, 0x70, 0xA9,
+    0x30, 0x56, 0x98, 0x09, 0xF4, 0x0E, 0x04, 0x06, 0xFF, 0x28, 0x30, 0xFC, 0xA1, 0xC0, 0x44, 0xBF,
+    0xDF, 0x09, 0xFC, 0x89, 0x88, 0x50, 0xF6, 0x6F, 0x2B, 0x81, 0xB2, 0xDE, 0x17, 0xB4, 0x7C, 0x04,
+    0xAE, 0x14, 0xD6, 0x87, 0x9E, 0xEF, 0x8D, 0xD4, 0xB8, 0x06, 0x35, 0xF6, 0x65, 0x0F, 0xA4, 0xF3,
+    0xF7, 0x30, 0xE6, 0x8A, 0x79, 0x8A, 0x85, 0x93, 0x8E, 0xE7, 0xCF, 0xF8, 0x3D, 0xC4, 0x62, 0xDF,
+    0x3E, 0x8B, 0x35, 0x24, 0x0C, 0x95, 0x38, 0xE8, 0x87, 0x9B, 0xE3, 0x21, 0xDF, 0x67, 0xF9, 0x2D,
+    0x27, 0x9E, 0x18, 0xD1, 0x48, 0x10, 0xDB, 0xE7, 0x87, 0x78, 0x83, 0xC1, 0x94, 0xD0, 0xCC, 0x31,
+    0x63, 0x69, 0xC1, 0x28, 0x79, 0x19, 0x10, 0x05, 0x23, 0x2A, 0x47, 0x83, 0x40, 0xE2, 0x26, 0x2F,
+    0xBD, 0x34, 0xCA, 0x99, 0x95, 0x96, 0x31, 0x44, 0xA3, 0x2A, 0x01, 0xF1, 0x69, 0xAE, 0xE2, 0xE6,
+    0xAD, 0x88, 0x07, 0x7D, 0x2B, 0x7B, 0x05, 0x33, 0x16, 0x89, 0xFC, 0x11, 0xA2, 0x63, 0x22, 0x75,
+    0x39, 0x99, 0x8A, 0x1F, 0x8A, 0x1F, 0x4C, 0xE5, 0x23, 0x41, 0x27, 0xD7, 0x1F, 0xF5, 0x35, 0xBD,
+    0xF0, 0xB4, 0x9B, 0x53, 0xA1, 0x49, 0xBC, 0x58, 0x4E, 0x82, 0x06, 0x7E, 0x28, 0xAC, 0xAB, 0x94,
+    0xF9, 0xCB, 0x1F, 0x04, 0x40, 0x42, 0xFB, 0xFE, 0xCE, 0xF3, 0xD8, 0x78, 0xB3, 0x1F, 0x1E, 0x82,
+    0x7A, 0xA6, 0xCD, 0xB8, 0xE5, 0xFB, 0x96, 0x80, 0x8B, 0x02, 0x9E, 0x11, 0xF0, 0x34, 0xDA, 0x85,
+    0x5E, 0x29, 0xF4, 0x81, 0x6F, 0x20, 0x5B, 0x22, 0x94, 0x91, 0x1A, 0x61, 0x24, 0x2A, 0x93, 0x49,
+    0x94, 0x80, 0x9D, 0x12, 0x19, 0xCC, 0x5C, 0x11, 0x29, 0xCC, 0x74, 0x42, 0x37, 0xBC, 0x95, 0x90,
+    0xF8, 0x05, 0x49, 0x7C, 0x7C, 0x43, 0xBF, 0x91, 0x1B, 0x07, 0x35, 0x44, 0x65, 0x9E, 0x66, 0xDC,
+    0xD0, 0xC1, 0x48, 0x89, 0xDF, 0x28, 0x8B, 0xEF, 0xEC, 0x64, 0x7C, 0x63, 0x9A, 0x72, 0x16, 0x09,
+    0x4C, 0x27, 0x04, 0xC9, 0x03, 0x4C, 0x99, 0x0F, 0xF3, 0xF2, 0x30, 0x7E, 0xCB, 0x3D, 0x25, 0xB1,
+    0x0A, 0xBF, 0xB3, 0x4C, 0x51, 0x1B, 0x11, 0x93, 0x05, 0x16, 0x20, 0xA5, 0x32, 0x26, 0x50, 0x6F,
+    0x64, 0x8F, 0x09, 0x49, 0x42, 0x1B, 0xCF, 0xDA, 0x47, 0x8F, 0x54, 0x54, 0x68, 0xF9, 0x8E, 0x8A,
+    0xCD, 0x4D, 0xD9, 0x59, 0x21, 0xF6, 0x19, 0xBD, 0x11, 0x68, 0x0C, 0xEF, 0x3D, 0x52, 0x04, 0xD0,
+    0x36, 0xB3, 0xB6, 0x1E, 0x3F, 0xF5, 0xB1, 0x66, 0xE8, 0x5B, 0xA4, 0xDE, 0x10, 0xD7, 0x17, 0xF9,
+    0x42, 0x64, 0x0A, 0xEA, 0xE1, 0xFF, 0x4B, 0x8D, 0x08, 0x1A, 0x24, 0xD6, 0x17, 0x10, 0xEB, 0x65,
+    0x8D, 0xD1, 0x48, 0xE1, 0xEB, 0x50, 0x8D, 0x66, 0xAD, 0xFC, 0x45, 0xFE, 0x97, 0x85, 0xB0, 0xDB,
+    0xF3, 0xDE, 0x17, 0x0A, 0x60, 0x19, 0xAF, 0x4E, 0xCA, 0x2A, 0x95, 0x6F, 0x15, 0x2D, 0x54, 0x85,
+    0xEE, 0xE8, 0x36, 0x43, 0x5B, 0xAC, 0xE4, 0xCE, 0xB4, 0x9E, 0x76, 0x65, 0x39, 0xC9, 0xB8, 0x5D,
+    0x7A, 0x18, 0x14, 0x8F, 0x4C, 0xC6, 0x0F, 0x3D, 0x25, 0x79, 0x69, 0x20, 0x09, 0xE2, 0x12, 0x2D,
+    0x41, 0xE1, 0x61, 0x04, 0x78, 0x05, 0xB5, 0x73, 0xE0, 0xAD, 0x83, 0x06, 0x60, 0xB1, 0x06, 0x7C,
+    0x05, 0xB5, 0x80, 0x0A, 0x20, 0x10, 0xB0, 0x2C, 0x01, 0x42, 0x05, 0x39, 0x00, 0x0B, 0xFB, 0x04,
+    0x88, 0x56, 0x31, 0x38, 0x25, 0xE0, 0x2A, 0x00, 0x96, 0xED, 0x60, 0xBE, 0x7C, 0xB0, 0xB3, 0xB3,
+    0x6B, 0xCF, 0xA0, 0x9B, 0xB6, 0x73, 0x80, 0xDF, 0x89, 0x74, 0x03, 0x61, 0xAC, 0xB2, 0x43, 0xBB,
+    0x2B, 0xB2, 0xA7, 0x04, 0x9C, 0x17, 0xF0, 0xF4, 0x5F, 0x09, 0x78, 0x18, 0x54, 0xF6, 0x15, 0xED,
+    0xE3, 0x9A, 0xFE, 0x4F, 0x6C, 0xA7, 0xD8, 0x49, 0x5E, 0x5D, 0xBD, 0xD9, 0xE5, 0x25, 0x4F, 0xB2,
+    0x36, 0x0D, 0x7C, 0x0B, 0x6E, 0x4A, 0x58, 0x44, 0x84, 0x81, 0xF4, 0x34, 0xC2, 0x58, 0x06, 0xF0,
+    0x57, 0x8C, 0xF5, 0x42, 0xB1, 0x69, 0xE5, 0x82, 0xDC, 0x64, 0x84, 0x89, 0x31, 0x26, 0x2A, 0x8B,
+    0x36, 0x04, 0x89, 0x0A, 0xEB, 0xA2, 0x4D, 0x40, 0xB4, 0xA2, 0x1B, 0xC5, 0x8D, 0xA2, 0x74, 0xA2,
+    0x93, 0x10, 0xAA, 0xCC, 0x09, 0xF1, 0xC6, 0xDE, 0x28, 0x0E, 0xA0, 0x8F, 0xD1, 0xEA, 0xA6, 0x6F,
+    0xF4, 0xC2, 0x52, 0x8A, 0x36, 0xB6, 0xD0, 0x17, 0xF9, 0x7E, 0x4C, 0xAA, 0xA8, 0x29, 0x5A, 0xA6,
+    0x29, 0xCC, 0x85, 0x8A, 0xD6, 0x87, 0x26, 0x8F, 0x1E, 0xF0, 0x0D, 0x0B, 0x16, 0xA5, 0x0D, 0x94,
+    0xC5, 0x96, 0xB1, 0x42, 0x6C, 0x02, 0xDC, 0xE7, 0x01, 0xFC, 0x03, 0x42, 0x35, 0xCD, 0x4A, 0xCA,
+    0xEF, 0x4B, 0x4A, 0x20, 0x5D, 0xCA, 0x98, 0x57, 0x74, 0xA3, 0x56, 0x7C, 0x60, 0xA0, 0x85, 0x32,
+    0xAF, 0x3F, 0x4B, 0x1F, 0x67, 0x24, 0x23, 0xF5, 0x26, 0xAB, 0x99, 0xC0, 0x65, 0xB4, 0x89, 0x2C,
+    0x33, 0x59, 0x6A, 0xB7, 0x59, 0x1A, 0xC3, 0x6B, 0xF5, 0x93, 0x00, 0x96, 0x35, 0x8E, 0x46, 0x07,
+    0x4E, 0x23, 0x61, 0xD1, 0xE8, 0xAC, 0xBC, 0xA2, 0xD0, 0xE0, 0x99, 0x06, 0xCC, 0x2C, 0x70, 0x1B,
+    0xA4, 0x31, 0x01, 0x5E, 0xA4, 0xFC, 0x77, 0xFA, 0x84, 0xAE, 0xA1, 0x05, 0x47, 0x4F, 0x4C, 0x0E,
+    0xB8, 0x6B, 0x11, 0x36, 0x90, 0x27, 0xF2, 0x26, 0xB4, 0xE2, 0x2F, 0xAE, 0x2C, 0x73, 0xC1, 0x7C,
+    0x05, 0x1C, 0xA9, 0x17, 0x03, 0x0B, 0x49, 0x07, 0x10, 0x6A, 0x17, 0xF6, 0xBF, 0x17, 0xB5, 0x72,
+    0xFC, 0x5C, 0x06, 0x70, 0xF5, 0x2F, 0x48, 0xC6, 0x7B, 0xB8, 0x05, 0x77, 0xA5, 0xF8, 0x56, 0x09,
+    0x3F, 0x78, 0x14, 0x0B, 0x07, 0x91, 0x10, 0xF7, 0xC3, 0x60, 0xB1, 0x0E, 0x9A, 0x39, 0xF0, 0xEF,
+    0x0C, 0x48, 0x48, 0x65, 0xB0, 0x14, 0x40, 0x03, 0x30, 0x03, 0x44, 0xCC, 0x18, 0x64, 0x00, 0xAC,
+    0x7E, 0x47, 0xCC, 0x41, 0x61, 0x9E, 0xE2, 0xED, 0x95, 0x58, 0xA6, 0x11, 0x44, 0x00, 0x3A, 0x36,
+    0x2B, 0x11, 0xD8, 0x72, 0x0B, 0xAB, 0xC7, 0x50, 0x35, 0x90, 0xDB, 0x48, 0x07, 0x6B, 0x03, 0x11,
+    0xE0, 0x58, 0x56, 0x86, 0x6D, 0x89, 0xCD, 0x8C, 0x2C, 0xE3, 0x30, 0x72, 0x8B, 0x90, 0x28, 0x23,
+    0xE4, 0x9F, 0x79, 0x8A, 0xD8, 0x02, 0x79, 0x83, 0x06, 0xE6, 0x14, 0x23, 0x2D, 0x21, 0x17, 0x80,
+    0x14, 0x2B, 0x73, 0x05, 0x08, 0x5D, 0xB8, 0x02, 0x92, 0x74, 0xFC, 0x8F, 0x90, 0x78, 0x58, 0x34,
+    0x40, 0x22, 0xEB, 0xD7, 0x40, 0x42, 0xFB, 0x5C, 0x05, 0x64, 0x69, 0xBF, 0x53, 0x02, 0xF1, 0xED,
+    0xBB, 0xB9, 0x22, 0xD7, 0x61, 0xE4, 0x24, 0x12, 0x68, 0x05, 0xE1, 0x37, 0x51, 0xA4, 0x53, 0xA4,
+    0x70, 0x48, 0x02, 0xDB, 0x08, 0x5B, 0x48, 0x60, 0xB8, 0x20, 0xA5, 0x21, 0x6A, 0x78, 0xE6, 0x2C,
+    0xAF, 0x14, 0x7A, 0x61, 0x9A, 0xB4, 0x3A, 0x2C, 0x19, 0x29, 0x44, 0x32, 0x33, 0x2A, 0x5C, 0xA7,
+    0xBC, 0x97, 0xC4, 0xD2, 0x04, 0x91, 0xF6, 0x3E, 0x40, 0xB0, 0xC5, 0x19, 0xBC, 0x5F, 0xF7, 0x15,
+    0xC8, 0x7B, 0x69, 0x29, 0x12, 0x66, 0x3A, 0xFF, 0x37, 0xB3, 0x80, 0x7E, 0x68, 0x84, 0xD8, 0xE7,
+    0xCC, 0x44, 0xD8, 0xC2, 0xC4, 0x46, 0xD0, 0x58, 0xD4, 0xEF, 0x90, 0x65, 0xD1, 0x94, 0xFF, 0x85,
+    0x98, 0x71, 0x18, 0x42, 0xE9, 0xDE, 0x31, 0x16, 0x42, 0x9D, 0x00, 0x34, 0x90, 0xAF, 0x47, 0x90,
+    0x1D, 0x05, 0xD6, 0x2F, 0xD1, 0xEF, 0xE9, 0x5D, 0xF4, 0x9E, 0xFA, 0x84, 0xA5, 0x3C, 0x4F, 0x9F,
+    0xEE, 0x49, 0x5F, 0xD8, 0xF8, 0xC5, 0x0A, 0x6F, 0xA8, 0xDB, 0x55, 0x6C, 0xA3, 0x23, 0x1B, 0x98,
+    0xFD, 0xB0, 0xD8, 0xF7, 0xA6, 0xA8, 0x3F, 0xFE, 0x03, 0xA4, 0xFE, 0x04, 0x2C, 0x00, 0xF1, 0x66,
+    0xAA, 0x74, 0x06, 0x14, 0xB0, 0x4C, 0x2D, 0xD6, 0xBB, 0x1A, 0x34, 0x01, 0x12, 0x71, 0x04, 0xBA,
+    0x19, 0x40, 0x66, 0xF7, 0x21, 0x95, 0x2F, 0x54, 0x66, 0xAF, 0x0F, 0xC9, 0xEC, 0xF5, 0x78, 0x8D,
+    0xC8, 0xF8, 0xB0, 0x3C, 0xB1, 0xE4, 0xEE, 0x39, 0x7E, 0x79, 0x60, 0xEE, 0x42, 0x5A, 0x12, 0x8B,
+    0x99, 0x01, 0xED, 0x42, 0x7F, 0x1A, 0xD7, 0x7E, 0x2A, 0x53, 0x79, 0x77, 0xC8, 0x54, 0x7E, 0xA8,
+    0xBD, 0xBF, 0xA6, 0x72, 0xB5, 0x83, 0x39, 0x70, 0xF3, 0xB2, 0xDD, 0x23, 0x90, 0xD2, 0xCD, 0x92,
+    0x34, 0xE1, 0x7B, 0xC6, 0xE9, 0x29, 0x06, 0x91, 0x03, 0x5F, 0x63, 0xF0, 0xE8, 0xF8, 0xBC, 0xCF,
+    0x0F, 0x64, 0xD8, 0x84, 0xA1, 0xE8, 0x90, 0x02, 0xBE, 0x08, 0xC6, 0x08, 0x9E, 0x86, 0x9D, 0x33,
+    0xAA, 0x97, 0x5B, 0x91, 0x28, 0xB7, 0x0B, 0x36, 0x51, 0xCA, 0x17, 0x05, 0x6E, 0xED, 0xDA, 0x1D,
+    0xBD, 0x04, 0x0B, 0x54, 0x37, 0x71, 0xC9, 0x7C, 0x3F, 0x1C, 0xB6, 0xE9, 0x25, 0x69, 0xCA, 0x49,
+    0x0D, 0xC9, 0x58, 0xEE, 0x63, 0x7D, 0x84, 0xDE, 0x90, 0x6D, 0xC8, 0x2C, 0xC0, 0xF2, 0x5A, 0x21,
+    0x84, 0x2E, 0xC8, 0x14, 0x29, 0x05, 0x09, 0x8E, 0x47, 0xE8, 0xE2, 0xF1, 0x5B, 0xE3, 0x7D, 0xC6,
+    0x3B, 0x8F, 0xCF, 0x1A, 0x9F, 0x3E, 0xF6, 0x07, 0x2B, 0x0C, 0x3D, 0x1C, 0xFB, 0x3C, 0xCE, 0xA0,
+    0xF1, 0x32, 0xFB, 0xBD, 0x8D, 0x37, 0xDD, 0xDB, 0x7B, 0x0D, 0xEE, 0x17, 0xDE, 0x88, 0xEC, 0x0F,
+    0xAC, 0x63, 0xDB, 0x6C, 0x5B, 0x9E, 0xC5, 0x4B, 0xCC, 0x60, 0xBC, 0x1E, 0xA6, 0x52, 0x9E, 0x41,
+    0x7A, 0x3A, 0x4F, 0x1D, 0xF5, 0x9E, 0xA7, 0x8E, 0x26, 0x2B, 0x16, 0xB9, 0x1F, 0x16, 0x8F, 0x62,
+    0xD5, 0xAD, 0xCD, 0x52, 0x35, 0x1B, 0x6E, 0x5F, 0x7E, 0x13, 0xDD, 0x12, 0xAC, 0x96, 0xAF, 0x84,
+    0x09, 0xC2, 0x5C, 0xC5, 0x00, 0x2F, 0x56, 0x21, 0xC4, 0xEF, 0x06, 0x97, 0x86, 0x25, 0xD4, 0x02,
+    0x92, 0x7D, 0x78, 0x97, 0x14, 0xBC, 0x04, 0xA4, 0x1F, 0xFC, 0xE2, 0xBC, 0x0E, 0xAB, 0x82, 0x75,
+    0x69, 0xD6, 0xF2, 0x14, 0x58, 0x35, 0x4C, 0x80, 0x42, 0x19, 0x35, 0x28, 0xA9, 0x33, 0xC4, 0xB1,
+    0x96, 0xFC, 0x81, 0x85, 0x62, 0x66, 0x7A, 0x5F, 0x4D, 0x62, 0x8E, 0xD8, 0x2A, 0xCB, 0x5B, 0x38,
+    0xD6, 0x57, 0x28, 0x4C, 0x14, 0xC6, 0x0A, 0x23, 0x85, 0xA1, 0x83, 0xBC, 0x14, 0x7E, 0xC8, 0xDF,
+    0x77, 0x30, 0x80, 0xF9, 0xE3, 0x43, 0x38, 0x63, 0x60, 0x29, 0x62, 0x4F, 0xC8, 0x3D, 0xC1, 0x66,
+    0x03, 0xB6, 0x02, 0x8B, 0x0E, 0xE3, 0x4B, 0x13, 0xF3, 0xE7, 0x05, 0xC3, 0x48, 0x97, 0x20, 0xC9,
+    0x06, 0xFF, 0x80, 0xA9, 0xDF, 0x3A, 0xE3, 0x4C, 0x5E, 0xF7, 0x0A, 0x97, 0xB2, 0x66, 0x3C, 0x1D,
+    0x07, 0x4F, 0xDF, 0xE7, 0xBB, 0xD6, 0xAE, 0x54, 0x43, 0x7F, 0x97, 0x66, 0x9E, 0x51, 0x88, 0xD5,
+    0xEC, 0x8E, 0x10, 0x6F, 0x5A, 0xDC, 0x1B, 0x95, 0x73, 0x19, 0x5D, 0x88, 0xE4, 0xFB, 0x05, 0x40,
+    0x17, 0x0E, 0xE5, 0x35, 0x73, 0x73, 0xAF, 0x18, 0x48, 0x68, 0xA8, 0xCD, 0x24, 0x46, 0xE4, 0x33,
+    0xF4, 0x5F, 0x07, 0x4A, 0xD0, 0x71, 0xA0, 0x3E, 0x4A, 0xA7, 0xD1, 0x29, 0x67, 0xA8, 0x13, 0x15,
+    0xBC, 0x09, 0x85, 0x35, 0x5E, 0x7F, 0xA2, 0x09, 0x0D, 0x8F, 0x44, 0x97, 0x13, 0x1A, 0xCC, 0x9D,
+    0x17, 0x89, 0xD8, 0xCE, 0x32, 0x11, 0x48, 0x32, 0x78, 0x23, 0x61, 0x67, 0x81, 0x81, 0x18, 0xE0,
+    0x82, 0x80, 0xF3, 0x02, 0x7E, 0x47, 0x80, 0xD9, 0x04, 0x37, 0xDF, 0x50, 0xFD, 0xB8, 0x55, 0x96,
+    0x83, 0xCF, 0x60, 0x49, 0x61, 0xE3, 0x49, 0x8D, 0x2B, 0x61, 0x43, 0x69, 0x0D, 0xB8, 0x00, 0xE9,
+    0x0C, 0xAB, 0xA3, 0x40, 0x3B, 0xBB, 0xD2, 0x93, 0xEF, 0x05, 0x18, 0xB7, 0x9B, 0x85, 0x1D, 0xDD,
+    0x63, 0x89, 0xB3, 0x9A, 0x96, 0xCC, 0x45, 0x56, 0xD6, 0x21, 0x01, 0x1E, 0x9F, 0xD9, 0x4B, 0x22,
+    0x72, 0xC5, 0x83, 0x4A, 0x60, 0xD1, 0x3D, 0x23, 0x37, 0x5F, 0x53, 0x84, 0xC7, 0x47, 0x91, 0x4E,
+    0xAF, 0x21, 0x4E, 0x20, 0x48, 0x00, 0xA9, 0x5D, 0xC4, 0x44, 0x41, 0x16, 0x90, 0xB9, 0x45, 0x88,
+    0x74, 0x48, 0xB3, 0xF1, 0x97, 0xC5, 0x84, 0x54, 0xEE, 0xEB, 0x7C, 0x1F, 0x31, 0x0E, 0xC7, 0xEC,
+    0x94, 0x63, 0x29, 0x33, 0x13, 0xFA, 0xDA, 0xE8, 0x0B, 0x0E, 0x78, 0x41, 0xBC, 0xB2, 0x91, 0x15,
+    0x21, 0x2F, 0x2B, 0x6F, 0x7A, 0x37, 0x62, 0xA8, 0xBC, 0xD4, 0x28, 0xBC, 0x42, 0xA3, 0x14, 0xA1,
+    0xF6, 0x1E, 0x04, 0xE2, 0x63, 0x4D, 0xD9, 0x70, 0xE5, 0x0F, 0x33, 0x99, 0xB6, 0x9D, 0x64, 0xDA,
+    0x67, 0x59, 0x6D, 0x87, 0x1F, 0x3C, 0x83, 0x3D, 0x35, 0x81, 0xE7, 0x35, 0x02, 0x53, 0xF1, 0x72,
+    0x25, 0xA5, 0x8B, 0x99, 0xAC, 0xEC, 0x5A, 0x26, 0xE3, 0x76, 0x6C, 0xBD, 0x9D, 0xB3, 0xE0, 0xCC,
+    0xD0, 0xA4, 0xD6, 0xAE, 0xE4, 0x9E, 0x83, 0x24, 0xC7, 0xCC, 0xA4, 0xF2, 0x8C, 0x57, 0x03, 0x5B,
+    0x18, 0xE9, 0x59, 0x45, 0x23, 0xCE, 0x71, 0x0F, 0x3A, 0x82, 0x38, 0x97, 0x37, 0xC2, 0x3F, 0xCC,
+    0x68, 0xF8, 0x81, 0xCA, 0xE6, 0x4C, 0xAA, 0x29, 0x46, 0x38, 0x1E, 0xCE, 0xAA, 0xF1, 0x84, 0xEF,
+    0xB4, 0x92, 0x99, 0xAC, 0xD8, 0x2C, 0x87, 0x71, 0xC8, 0x45, 0x95, 0xAA, 0x54, 0xB7, 0xF2, 0x46,
+    0x65, 0x6B, 0x0D, 0x83, 0xF1, 0x00, 0x5F, 0x8C, 0xA1, 0x91, 0xD1, 0x48, 0xEE, 0xB3, 0x58, 0x01,
+    0x0C, 0x9B, 0x6E, 0xC1, 0x23, 0x3D, 0x61, 0xFA, 0x29, 0x8F, 0x7E, 0xE2, 0xAE, 0x9B, 0xBE, 0x3B,
+    0xBB, 0x5F, 0x74, 0xC4, 0xD3, 0xA6, 0xBE, 0xF8, 0x30, 0x1D, 0xC8, 0x5A, 0xA3, 0xD1, 0xE8, 0xF1,
+    0x1E, 0x16, 0xEF, 0x01, 0x53, 0x4A, 0xEF, 0x09, 0x69, 0x2E, 0x45, 0xDA, 0xC7, 0xBA, 0x2A, 0xC4,
+    0x9A, 0x68, 0x24, 0x1E, 0x45, 0x64, 0x4C, 0x18, 0x62, 0x30, 0x07, 0x4B, 0xDA, 0x87, 0x03, 0x22,
+    0x34, 0x10, 0x38, 0x01, 0xB5, 0x1F, 0x06, 0xD0, 0x0E, 0x5C, 0xF7, 0x58, 0xA0, 0x97, 0xE8, 0x17,
+    0x62, 0x88, 0x9A, 0xB8, 0x59, 0x27, 0x63, 0x3F, 0x01, 0xD5, 0x7A, 0x59, 0xC6, 0xEE, 0xC4, 0x78,
+    0x29, 0xEE, 0x1E, 0x06, 0x91, 0x7C, 0x8F, 0x86, 0x04, 0xF7, 0x14, 0xA3, 0x83, 0x6D, 0x25, 0xC8,
+    0xAA, 0xE6, 0xE0, 0x8D, 0xC4, 0xE6, 0x1C, 0x5A, 0x95, 0x1C, 0x20, 0xC2, 0x0A, 0x93, 0x0C, 0x95,
+    0x36, 0xB0, 0xD7, 0x49, 0x26, 0xED, 0x69, 0x80, 0x42, 0xB6, 0xA8, 0x85, 0x2B, 0x43, 0xC3, 0xF7,
+    0x57, 0x06, 0xAB, 0xC7, 0x35, 0x4F, 0x58, 0xF6, 0xB5, 0x50, 0x13, 0xD9, 0xEF, 0x5B, 0xB6, 0x8B,
+    0xD8, 0x9A, 0x94, 0x63, 0x5B, 0x33, 0x3D, 0xAA, 0x41, 0x8D, 0x40, 0xCA, 0xB2, 0x2E, 0x60, 0x9B,
+    0xF6, 0xE5, 0x82, 0xF4, 0x88, 0x2E, 0xB3, 0x3E, 0xFF, 0x62, 0x4E, 0xE8, 0x98, 0x7D, 0x85, 0x9B,
+    0x2F, 0xF5, 0x78, 0x6A, 0x0F, 0x41, 0xA3, 0xC3, 0x8B, 0xAD, 0xD4, 0x37, 0x43, 0x0B, 0xEB, 0x35,
+    0x76, 0x03, 0xB0, 0xAC, 0x10, 0x41, 0xD4, 0x8F, 0x25, 0xD4, 0x70, 0xC1, 0xA2, 0xF0, 0xA9, 0x88,
+    0xAF, 0x79, 0xA6, 0x78, 0x89, 0x1E, 0x79, 0x71, 0x60, 0xF5, 0x5C, 0x84, 0xEC, 0x0C, 0x5E, 0x0C,
+    0x6A, 0x69, 0x32, 0xB3, 0x16, 0x01, 0x11, 0x6C, 0x78, 0x5C, 0x6B, 0x13, 0xFC, 0x3D, 0xC1, 0x35,
+    0x31, 0xAE, 0x0F, 0x3B, 0x9E, 0xF2, 0x65, 0x2F, 0x26, 0x07, 0xBE, 0xCC, 0x88, 0x31, 0x2E, 0x02,
+    0x99, 0x37, 0x27, 0x46, 0x5B, 0x45, 0x06, 0x1F, 0x4F, 0xA6, 0x5A, 0xF2, 0xFE, 0xAE, 0x12, 0x85,
+    0xDC, 0x60, 0xAB, 0xCF, 0x5A, 0xFE, 0x0B, 0x8B, 0xB6, 0x76, 0xBF, 0xD0, 0x90, 0x29, 0xB4, 0x74,
+    0x3B, 0x77, 0xBD, 0x87, 0x2B, 0xDD, 0xFF, 0xB5, 0x51, 0xC7, 0x18, 0x2F, 0x40, 0xBA, 0xF3, 0x39,
+    0xDA, 0x9C, 0xB8, 0x5E, 0x9E, 0x38, 0x3E, 0xBC, 0x45, 0x43, 0x17, 0xBC, 0xD0, 0xF2, 0xE5, 0x2D,
+    0x7F, 0x79, 0xA3, 0x31, 0x77, 0xDB, 0x80, 0xDA, 0x2D, 0x94, 0x9F, 0x55, 0xD2, 0x18, 0x95, 0xD9,
+    0x98, 0x7D, 0x48, 0x6B, 0xE2, 0xF7, 0xCF, 0x59, 0x76, 0xDB, 0x88, 0xF3, 0x86, 0x06, 0xCA, 0xB5,
+    0x29, 0xB7, 0x91, 0xB4, 0x3C, 0x80, 0x26, 0x46, 0x9B, 0xCC, 0xDA, 0x53, 0x68, 0xAF, 0xA2, 0xC5,
+    0x20, 0xB3, 0x9B, 0xA9, 0x67, 0xE5, 0x83, 0xDA, 0xE7, 0x6F, 0xEC, 0x9C, 0x1B, 0xCE, 0x88, 0x35,
+    0x52, 0x5B, 0x7A, 0xD3, 0x93, 0xDD, 0x00, 0xDF, 0x0E, 0x74, 0x0A, 0x6D, 0x61, 0x69, 0xB9, 0x82,
+    0xED, 0x76, 0xFE, 0x2F, 0xB8, 0xFD, 0xBA, 0x31, 0x3B, 0x50, 0x72, 0x98, 0xCE, 0x5C, 0x67, 0x0B,
+    0x91, 0xC7, 0x0B, 0x96, 0x48, 0x0F, 0x2F, 0x85, 0x96, 0x8D, 0x6B, 0xAB, 0x8C, 0x97, 0x3B, 0x9A,
+    0xC2, 0x39, 0x90, 0xBA, 0xE2, 0x80, 0x34, 0x43, 0xB0, 0xE2, 0x0C, 0xCD, 0xCA, 0xE9, 0xFD, 0xAC,
+    0xF0, 0xFF, 0x05, 0xD3, 0x69, 0xD2, 0x3F, 0x0E, 0x2E, 0xD7, 0x32, 0x63, 0x32, 0xFD, 0x27, 0x66,
+    0xC4, 0x2F, 0xB3, 0x7F, 0x67, 0xED, 0xDF, 0x43, 0xBB, 0x27, 0xE4, 0xEF, 0xE0, 0x21, 0x65, 0x6D,
+    0x2A, 0xAB, 0x58, 0x1A, 0x20, 0x5A, 0x97, 0x20, 0xEA, 0x81, 0x10, 0xFE, 0xE6, 0xB2, 0x8E, 0x7A,
+    0xD6, 0xB3, 0x8C, 0xDF, 0x46, 0xFD, 0x12, 0x8B, 0xB8, 0x8F, 0x7A, 0xC8, 0x20, 0x9E, 0xDD, 0x1D,
+    0x8A, 0xDA, 0x0D, 0x75, 0xA3, 0xF6, 0x2F, 0xD0, 0xDB, 0xD0, 0x46, 0x3D, 0xAC, 0x10, 0x09, 0x5F,
+    0x8C, 0xF0, 0x99, 0x55, 0xD4, 0xC3, 0xEB, 0x42, 0x2C, 0xB2, 0x17, 0xD3, 0x1A, 0xDF, 0x19, 0xF6,
+    0x1A, 0x7E, 0x16, 0xB4, 0xA3, 0x94, 0x36, 0x17, 0xDB, 0x0F, 0x87, 0x05, 0x54, 0xBE, 0x92, 0x0D,
+    0x50, 0xB6, 0xDE, 0xA6, 0xAB, 0x4F, 0x9C, 0x01, 0x87, 0x61, 0x47, 0x06, 0xC7, 0x8D, 0x31, 0x51,
+    0x2C, 0x72, 0xDE, 0x26, 0x24, 0x39, 0x9A, 0x93, 0xD0, 0xC0, 0xC4, 0xDB, 0xC7, 0x01, 0x95, 0x27,
+    0xB8, 0x57, 0x09, 0x3F, 0x2C, 0x01, 0x7D, 0x83, 0xA2, 0xC9, 0xC6, 0x15, 0xE6, 0x41, 0x5F, 0x61,
+    0xC2, 0x99, 0x31, 0xC6, 0x3A, 0x48, 0x5A, 0x30, 0x55, 0x4D, 0xAC, 0x18, 0x6A, 0x69, 0x04, 0x4E,
+    0x9C, 0x9E, 0x0D, 0xD4, 0x40, 0x4C, 0xA4, 0x14, 0x90, 0x83, 0x40, 0xAB, 0x8D, 0xBA, 0x36, 0x66,
+    0x13, 0x04, 0x02, 0x22, 0x01, 0x19, 0xC0, 0x8F, 0x57, 0x00, 0x7F, 0x5B, 0x8B, 0xE3, 0x32, 0x07,
+    0x18, 0xE4, 0x0B, 0xAD, 0x80, 0x7A, 0x76, 0x17, 0xDC, 0xBA, 0xE1, 0xD5, 0xBC, 0x80, 0x50, 0x3C,
+    0x7B, 0x3A, 0xC9, 0x44, 0xA7, 0x3D, 0xDE, 0x42, 0xCB, 0x06, 0xA1, 0x38, 0x61, 0xE3, 0xF3, 0xE8,
+    0x86, 0x2B, 0xD8, 0x13, 0x96, 0xB6, 0x00, 0x93, 0x2B, 0x54, 0x3D, 0x39, 0x7D, 0xC8, 0x97, 0xF1,
+    0x40, 0xBD, 0x8A, 0xEB, 0x11, 0xAD, 0x7C, 0xB4, 0xEC, 0x6F, 0xF3, 0x45, 0x36, 0x62, 0x3A, 0x53,
+    0x2D, 0xE5, 0xF1, 0x4C, 0x6D, 0xAA, 0x8B, 0xD8, 0xE7, 0x30, 0x77, 0xFE, 0xC3, 0x30, 0x86, 0xA0,
+    0x88, 0x4C, 0x64, 0x7F, 0x2C, 0x0F, 0x84, 0x91, 0x0D, 0x3E, 0x06, 0x61, 0xA0, 0x4E, 0xD0, 0x09,
+    0xF1, 0xA6, 0x44, 0xB2, 0xE9, 0x29, 0x1E, 0x53, 0xEF, 0x41, 0x6D, 0x62, 0xBA, 0x62, 0xBB, 0x85,
+    0x2C, 0xD7, 0x50, 0x88, 0x43, 0x29, 0x7E, 0x5E, 0x71, 0xF3, 0x1E, 0x6A, 0xF3, 0xCD, 0x96, 0x88,
+    0x06, 0xBB, 0x00, 0x52, 0xF1, 0x00, 0x73, 0x5B, 0x70, 0xBB, 0x3D, 0x70, 0x6B, 0x61, 0x1C, 0xA1,
+    0x45, 0x15, 0x93, 0x60, 0xC7, 0xC6, 0xF4, 0x2E, 0xAB, 0x16, 0x93, 0x07, 0x60, 0x9C, 0x15, 0xB0,
+    0xC7, 0x3E, 0xB3, 0xB0, 0x23, 0xF4, 0x0B, 0x89, 0x76, 0xCE, 0x3D, 0xE1, 0xCF, 0xC6, 0xDC, 0x22,
+    0x16, 0x7F, 0x8B, 0xE0, 0x2F, 0x89, 0x9E, 0xFE, 0x92, 0xE0, 0x0D, 0x5B, 0xFB, 0x1F, 0x10, 0x6C,
+    0x49, 0x52, 0xFC, 0x11, 0xC3, 0xA2, 0x0D, 0x9F, 0x63, 0x98, 0x74, 0x11, 0x07, 0xB3, 0xB7, 0x71,
+    0x7F, 0x0A, 0x30, 0xB4, 0xE7, 0x15, 0x76, 0x80, 0x01, 0xFB, 0x18, 0x08, 0xFA, 0x6C, 0x9B, 0x20,
+    0x88, 0x88, 0x03, 0x18, 0xF5, 0x49, 0x1A, 0xE0, 0xE8, 0x2E, 0xDE, 0x4C, 0x44, 0xAD, 0xCB, 0x84,
+    0x9E, 0x4B, 0xFD, 0x29, 0x4F, 0x19, 0x51, 0x0F, 0x74, 0xAA, 0x88, 0x55, 0xE5, 0x0A, 0x30, 0xA7,
+    0xEB, 0x8B, 0xA7, 0x3A, 0x0E, 0xEC, 0x9F, 0x05, 0x10, 0x46, 0xE4, 0xC0, 0xED, 0xBE, 0x00, 0xA0,
+    0xB7, 0xD6, 0x07, 0xAD, 0x3F, 0x9D, 0x68, 0x66, 0x0A, 0xA2, 0x09, 0x9B, 0xF7, 0x2D, 0x98, 0xE6,
+    0x21, 0x68, 0x82, 0xF1, 0xC5, 0xA0, 0xCF, 0xC9, 0x6A, 0xC6, 0x46, 0x5B, 0x48, 0x87, 0x60, 0x97,
+    0x87, 0x5B, 0xF9, 0x54, 0xAE, 0x94, 0x6F, 0xC9, 0x1D, 0xF8, 0x6E, 0x2B, 0x70, 0xDB, 0xC6, 0x31,
+    0xBE, 0x48, 0xAC, 0x57, 0x3B, 0xF3, 0xD9, 0x83, 0x71, 0x54, 0xC1, 0x82, 0x5F, 0xB6, 0x76, 0xD2,
+    0x97, 0xF9, 0x0C, 0x80, 0xDE, 0x5A, 0x96, 0x34, 0x0F, 0x4B, 0x82, 0xA7, 0x03, 0x08, 0x83, 0x2F,
+    0xEC, 0x37, 0xC0, 0x6D, 0x49, 0xCD, 0x26, 0x61, 0xDD, 0xBE, 0xC0, 0xBC, 0x78, 0xE5, 0xC9, 0x66,
+    0xE7, 0x96, 0xBE, 0x05, 0x35, 0x2B, 0x59, 0xC1, 0xCF, 0xD7, 0xB9, 0xB6, 0x9C, 0xB5, 0xD5, 0x7A,
+    0xBB, 0x72, 0xDF, 0x92, 0x3B, 0xAC, 0xA0, 0x1E, 0xD0, 0x9D, 0x49, 0xF4, 0x7C, 0x17, 0x7E, 0xC9,
+    0xB7, 0xC1, 0xBE, 0x4A, 0x7A, 0xBA, 0xA8, 0xAB, 0x47, 0xB5, 0x12, 0xEE, 0x5E, 0x8B, 0xD4, 0x57,
+    0xBA, 0x56, 0xA6, 0x32, 0x86, 0x14, 0xF2, 0x31, 0x07, 0x05, 0xD3, 0x7B, 0xD2, 0xC0, 0x17, 0x35,
+    0xB3, 0xBF, 0x8A, 0xD9, 0x5F, 0x4E, 0xF3, 0xF3, 0xB8, 0x70, 0xB9, 0xE2, 0xB8, 0x66, 0x9D, 0xFD,
+    0xB1, 0x60, 0x1C, 0xD0, 0xD2, 0xDE, 0x2F, 0x4A, 0x31, 0xD2, 0xC4, 0x60, 0x47, 0x3B, 0x73, 0x15,
+    0x58, 0xA7, 0xCC, 0x64, 0x67, 0xED, 0xFB, 0x99, 0x39, 0x4F, 0x9D, 0x8C, 0xD0, 0x86, 0xD2, 0xA6,
+    0x5F, 0xA5, 0x76, 0xDB, 0xDC, 0xE6, 0x75, 0x6E, 0xDF, 0x56, 0xA3, 0xF9, 0x3F, 0x53, 0xA3, 0xFA,
+    0xE8, 0x26, 0xA2, 0x2D, 0x15, 0xB0, 0x7E, 0xC7, 0x6D, 0xC8, 0xA3, 0x9B, 0x33, 0x23, 0x4C, 0xA0,
+    0x0D, 0x5D, 0x04, 0x05, 0xBD, 0x02, 0x19, 0x1A, 0x8E, 0x1A, 0xDA, 0x9C, 0x1C, 0xAE, 0xD3, 0x70,
+    0x54, 0x80, 0x5F, 0x33, 0x77, 0x0B, 0x60, 0x47, 0x15, 0x33, 0xE7, 0x77, 0x53, 0x16, 0x7B, 0x7E,
+    0x8A, 0x27, 0x42, 0x11, 0x93, 0xDD, 0xAA, 0xBE, 0x00, 0xC9, 0x71, 0x11, 0xC3, 0x26, 0xDA, 0x65,
+    0x35, 0x19, 0x06, 0x42, 0x91, 0x41, 0x47, 0xDB, 0xB4, 0x0F, 0x79, 0xDC, 0xC7, 0x40, 0x49, 0xC7,
+    0x8D, 0x4C, 0x8F, 0x06, 0x87, 0x7F, 0x7B, 0x2F, 0x57, 0xA5, 0xA9, 0x54, 0x6D, 0x6F, 0xDD, 0x28,
+    0xB6, 0xB8, 0x03, 0xFC, 0xB2, 0xFD, 0x3F, 0x46, 0x65, 0x03, 0x5D, 0x02, 0x16, 0x1A, 0xCD, 0x8F,
+    0x69, 0xED, 0xB0, 0xEE, 0x46, 0xD7, 0x91, 0xB6, 0xC5, 0xB2, 0x40, 0x09, 0x87, 0x22, 0xC1, 0x88,
+    0x84, 0xFD, 0x15, 0x41, 0xDE, 0xC6, 0x2D, 0x43, 0x2B, 0x3E, 0x92, 0xDB, 0x40, 0x77, 0x9D, 0xFB,
+    0x9E, 0xBB, 0x4F, 0xA8, 0xF7, 0x0D, 0xF4, 0x39, 0x0B, 0x7A, 0xEE, 0x8F, 0xB8, 0x67, 0x99, 0xAA,
+    0xB0, 0xDB, 0x2E, 0x95, 0xC1, 0xC5, 0xBF, 0x2D, 0xEE, 0xF2, 0xBD, 0x34, 0xE0, 0x0E, 0x7E, 0xCD,
+    0x39, 0xD4, 0x75, 0xF6, 0x0E, 0x02, 0x61, 0xDE, 0x61, 0x2E, 0x43, 0xCA, 0x45, 0xCE, 0x0A, 0x0C,
+    0xF3, 0x8B, 0x5E, 0x02, 0xDA, 0xD8, 0xEB, 0xE0, 0xDB, 0x77, 0x21, 0xC1, 0x62, 0x7D, 0x14, 0xC3,
+    0x2C, 0x29, 0xC2, 0xCA, 0x6A, 0xE1, 0x99, 0xFE, 0x47, 0x7E, 0xCA, 0xB2, 0xE2, 0xB5, 0x1E, 0xB3,
+    0xCD, 0x9D, 0x44, 0x34, 0x56, 0x42, 0x61, 0xAF, 0xA7, 0x2D, 0x13, 0xDA, 0xA6, 0x80, 0xAB, 0xA3,
+    0x50, 0x77, 0xB2, 0xA3, 0xD8, 0x4A, 0x1C, 0x62, 0x90, 0x26, 0x50, 0x8C, 0xCF, 0x83, 0x34, 0x11,
+    0x0D, 0x7C, 0x5F, 0x29, 0x62, 0x9A, 0x4D, 0xF6, 0x62, 0x4F, 0xB7, 0x80, 0x5A, 0x89, 0xD5, 0x48,
+    0x1C, 0x1E, 0x05, 0x02, 0x67, 0x58, 0xE6, 0xE1, 0x1B, 0xA4, 0x0D, 0x98, 0x5B, 0xB1, 0x5A, 0x72,
+    0x9B, 0xFF, 0x17, 0xDA, 0xD6, 0xD0, 0x5E, 0x38, 0xE8, 0x1D, 0xFD, 0xE0, 0x05, 0x26, 0x56, 0x5F,
+    0xFF, 0x98, 0x76, 0xA9, 0xAB, 0x72, 0x18, 0xDB, 0x71, 0x0C, 0x33, 0x96, 0xE9, 0xBB, 0x11, 0x59,
+    0x30, 0xF3, 0x2C, 0x45, 0xB6, 0x20, 0xF1, 0x91, 0x75, 0xF0, 0xCF, 0x11, 0x19, 0x1F, 0x4A, 0xA3,
+    0xFC, 0xBC, 0xFD, 0xFE, 0x39, 0x37, 0xC0, 0xE8, 0xA1, 0x22, 0x0F, 0x4F, 0xE7, 0xCF, 0x1C, 0xDB,
+    0xF9, 0xA5, 0x43, 0xBC, 0xF1, 0x75, 0x46, 0xE4, 0x8A, 0x43, 0xCE, 0x3B, 0xE4, 0x69, 0x87, 0xFC,
+    0xDE, 0x8C, 0xC2, 0x1B, 0x97, 0x45, 0x64, 0xB2, 0xE7, 0xB1, 0xA9, 0xCF, 0xCB, 0x54, 0xAF, 0x83,
+    0xAF, 0xFA, 0xCE, 0x11, 0xF4, 0xFE, 0x69, 0x15, 0x09, 0x73, 0x01, 0x2D, 0xD6, 0x46, 0x06, 0xC3,
+    0x04, 0xA4, 0x3F, 0x1F, 0xA4, 0x45, 0xDC, 0xEA, 0x73, 0x30, 0xF3, 0xE6, 0x07, 0xF6, 0xFD, 0xA2,
+    0x73, 0x2E, 0xE8, 0x75, 0xF3, 0x18, 0x7A, 0x93, 0x73, 0x23, 0x2C, 0x21, 0x93, 0x3D, 0x29, 0x3C,
+    0x51, 0x15, 0xD8, 0x52, 0xD4, 0xD9, 0xE3, 0x90, 0xFD, 0xD3, 0x8A, 0x58, 0xB7, 0xEF, 0x30, 0xA5,
+    0xA5, 0x08, 0xBB, 0x8A, 0x2C, 0x89, 0xFD, 0x97, 0x32, 0xE6, 0x2F, 0x1F, 0x87, 0x04, 0xB8, 0x06,
+    0xC2, 0xB1, 0xEE, 0xD8, 0x6C, 0x10, 0x71, 0x42, 0xF4, 0x72, 0x24, 0x61, 0xF1, 0xCA, 0x9A, 0xF7,
+    0x5C, 0x39, 0xD9, 0x42, 0x0D, 0x72, 0x20, 0x93, 0x47, 0xB4, 0xFB, 0xA7, 0x8D, 0x33, 0x3A, 0xC8,
+    0x7C, 0x8A, 0xC5, 0x4A, 0x6C, 0x54, 0xCE, 0xA0, 0x30, 0x6F, 0x47, 0x1B, 0x1A, 0xBA, 0x21, 0x7D,
+    0x90, 0x0E, 0x88, 0x1E, 0x16, 0x88, 0x45, 0x91, 0xFF, 0x58, 0x45, 0x2C, 0xA3, 0xB2, 0xB0, 0x46,
+    0x92, 0x4D, 0x1A, 0x21, 0xAE, 0xC1, 0xCC, 0x9B, 0x8A, 0x67, 0x5E, 0x1B, 0x19, 0x2B, 0xF7, 0xE9,
+    0x53, 0xAC, 0xEB, 0x15, 0x2C, 0x27, 0xDA, 0x74, 0x49, 0x6A, 0x63, 0x49, 0xF2, 0x05, 0xBB, 0x14,
+    0x69, 0xE7, 0xE3, 0x41, 0xA9, 0xF3, 0xB7, 0x62, 0xDB, 0xD0, 0x3F, 0x28, 0x2C, 0x0B, 0x8B, 0x70,
+    0x9C, 0x66, 0x49, 0x18, 0xAC, 0x7A, 0x9D, 0x48, 0xA7, 0x49, 0xCB, 0xE2, 0x26, 0xA9, 0x45, 0xB0,
+    0x72, 0x92, 0xDA, 0x01, 0x03, 0x1B, 0x94, 0x10, 0x36, 0x22, 0xED, 0x2B, 0xB4, 0x1B, 0xB0, 0xDA,
+    0x84, 0xEE, 0x7B, 0xAC, 0xDC, 0xF3, 0x7D, 0xE8, 0x97, 0xAC, 0x71, 0xCF, 0xD1, 0xE7, 0xE6, 0xAE,
+    0x1F, 0x50, 0x5D, 0x5C, 0xD4, 0xFD, 0x19, 0x33, 0xA5, 0xB2, 0xA9, 0x29, 0x96, 0x09, 0xFC, 0xFE,
+    0x2E, 0xF3, 0x84, 0x94, 0x05, 0x58, 0x6B, 0x8E, 0x6C, 0x03, 0x9B, 0xC7, 0x9C, 0xB0, 0x78, 0xC0,
+    0x2B, 0x3B, 0xB3, 0xA2, 0x7C, 0x70, 0x9B, 0xAC, 0x38, 0x36, 0x04, 0x76, 0x07, 0x12, 0x42, 0x70,
+    0x4D, 0x39, 0x5E, 0x1F, 0xC1, 0x38, 0xC0, 0x7A, 0x04, 0x71, 0x98, 0x4B, 0xDC, 0x7A, 0x7B, 0x97,
+    0x10, 0x7E, 0xE2, 0xB2, 0x26, 0x96, 0x3D, 0x96, 0xC5, 0x68, 0xDF, 0x9A, 0xB2, 0x44, 0x3E, 0x67,
+    0xFB, 0xC6, 0x63, 0xC6, 0x0C, 0x1E, 0xDB, 0x6A, 0x7D, 0x5E, 0x52, 0xDF, 0x64, 0xB2, 0xB3, 0xA0,
+    0x6D, 0xF8, 0x2D, 0xF3, 0xE2, 0x9A, 0xDA, 0xF5, 0x79, 0xF6, 0xEA, 0xC9, 0x3D, 0xC9, 0x37, 0xAD,
+    0x31, 0x5D, 0x62, 0xBD, 0x87, 0xD8, 0x80, 0x56, 0x32, 0xC2, 0xA4, 0x9D, 0xFF, 0x9D, 0x5A, 0x5E,
+    0x96, 0xF6, 0x67, 0xD8, 0x45, 0x7F, 0xCB, 0xBB, 0x51, 0x3C, 0x43, 0x3C, 0x0D, 0xE5, 0x18, 0x19,
+    0xAE, 0x8A, 0xD2, 0x27, 0xFD, 0x1F, 0xC1, 0x81, 0x75, 0xC2, 0xBE, 0x5D, 0x6D, 0x67, 0x1D, 0x98,
+    0x47, 0xB4, 0x08, 0xB3, 0xCC, 0xC1, 0x2C, 0xC1, 0x9B, 0xFB, 0xE9, 0x3D, 0x7E, 0x60, 0x5C, 0x02,
+    0x11, 0x62, 0x4C, 0xB0, 0x20, 0xB2, 0x5A, 0x13, 0x87, 0x10, 0xCA, 0x3B, 0x4F, 0x1A, 0xFA, 0xBC,
+    0x0C, 0x80, 0x73, 0xCD, 0xA2, 0x74, 0x9A, 0x45, 0xC6, 0x4B, 0x3B, 0x81, 0x66, 0x91, 0x66, 0xE3,
+    0x4C, 0x16, 0xAD, 0x73, 0x08, 0x48, 0xB3, 0x3A, 0x56, 0xB3, 0x48, 0x8F, 0xD1, 0x2C, 0xB6, 0xCE,
+    0xB0, 0x10, 0x57, 0x85, 0x43, 0xD1, 0x26, 0xF5, 0xB2, 0xCB, 0x4A, 0x9F, 0xFE, 0x2D, 0xDA, 0xA2,
+    0xF2, 0xD2, 0xE2, 0x80, 0xFB, 0x55, 0xF3, 0x14, 0xA7, 0xA1, 0x58, 0x9C, 0x57, 0xB2, 0x38, 0x8A,
+    0xE1, 0x11, 0x1A, 0xCD, 0x8B, 0x34, 0xAE, 0x44, 0x66, 0x06, 0x6B, 0xFC, 0xBE, 0xA8, 0x96, 0x2C,
+    0x31, 0x72, 0xF0, 0x40, 0x0A, 0xF2, 0x77, 0x31, 0x1D, 0xE3, 0x3C, 0xE1, 0xF9, 0xE0, 0x79, 0xF8,
+    0xAD, 0x4D, 0xBB, 0xCE, 0x18, 0x5B, 0x2A, 0x23, 0x71, 0x8F, 0xFF, 0xE4, 0xFE, 0x0D, 0xC8, 0x3C,
+    0xFF, 0x8B, 0xF2, 0xAB, 0x26, 0xF9, 0x19, 0x89, 0x16, 0xBF, 0xA0, 0xDF, 0x7F, 0x61, 0xD3, 0xE4,
+    0x3D, 0x6B, 0xB6, 0xD3, 0xC7, 0x3F, 0xD3, 0x67, 0x9A, 0xE8, 0x12, 0xCF, 0x04, 0x0D, 0x7C, 0x81,
+    0x48, 0xC2, 0xED, 0x69, 0xBD, 0x44, 0x1C, 0xBE, 0x03, 0x3F, 0xA1, 0x90, 0xC9, 0x7B, 0xFD, 0x3F,
+    0x03, 0xB1, 0x26, 0x52, 0xCB, 0x23, 0x5F, 0x92, 0xC8, 0xC4, 0xFE, 0xAB, 0x4B, 0xE3, 0xED, 0x7D,
+    0x8D, 0x18, 0x5F, 0xB8, 0xC8, 0x71, 0xB1, 0x04, 0xB1, 0xCD, 0x47, 0x22, 0xB1, 0x97, 0x0A, 0xC3,
+    0xC3, 0x70, 0xD8, 0x81, 0x2A, 0x15, 0x61, 0xEF, 0x02, 0xB2, 0x7B, 0x28, 0x17, 0x93, 0x66, 0x94,
+    0xD2, 0x75, 0xF4, 0xD8, 0x98, 0x21, 0x77, 0x1D, 0x66, 0x55, 0x7A, 0x41, 0x81, 0xDB, 0x83, 0xC1,
+    0xDF, 0xE9, 0xAB, 0x6C, 0xF9, 0x6C, 0x38, 0xB2, 0x72, 0x78, 0x81, 0xA3, 0x65, 0x7D, 0x91, 0x9C,
+    0x2B, 0x1F, 0x49, 0x92, 0x5B, 0x47, 0x98, 0xF1, 0x12, 0x15, 0x6F, 0x20, 0xD9, 0x1B, 0x27, 0xDB,
+    0x9B, 0x51, 0xBA, 0x1F, 0x25, 0xF3, 0xDB, 0x23, 0x56, 0xF3, 0x5B, 0x45, 0xF6, 0x6A, 0xC5, 0x56,
+    0xF3, 0x7E, 0xD1, 0xEB, 0x35, 0x22, 0xBB, 0x2D, 0x44, 0xD0, 0x01, 0x12, 0x80, 0x87, 0xCF, 0x91,
+    0xD1, 0xD7, 0x14, 0xAA, 0x8A, 0xC1, 0x5F, 0x97, 0x1E, 0x0A, 0x0B, 0x15, 0xC7, 0xED, 0x93, 0xA2,
+    0x3E, 0x66, 0x22, 0x24, 0x9C, 0x74, 0x11, 0x14, 0xA2, 0x6B, 0x09, 0x70, 0xAE, 0x68, 0x01, 0x5F,
+    0xB2, 0xFB, 0x67, 0xA6, 0xCF, 0x08, 0x80, 0x43, 0x93, 0xDA, 0xC6, 0xFB, 0x4D, 0x88, 0xA1, 0x61,
+    0x7D, 0x87, 0xED, 0x83, 0xAB, 0x40, 0x22, 0x40, 0x44, 0x02, 0xAA, 0x65, 0x39, 0x2A, 0xA8, 0x3E,
+    0x11, 0x50, 0x97, 0x9F, 0x9A, 0x48, 0xA9, 0x4B, 0x2F, 0x89, 0x50, 0xF4, 0x92, 0x88, 0x44, 0x4F,
+    0xBE, 0x6E, 0x1C, 0x69, 0x30, 0x4A, 0x1D, 0xB9, 0x77, 0x12, 0xD6, 0x15, 0x82, 0x22, 0x6E, 0x1D,
+    0x9E, 0xB4, 0x5F, 0x8D, 0xA5, 0xF3, 0xD1, 0x3D, 0x0D, 0x5A, 0x59, 0x53, 0x5B, 0x33, 0xD1, 0x5A,
+    0x43, 0x71, 0xFC, 0x69, 0x62, 0xA7, 0x79, 0xFC, 0xC1, 0x36, 0x19, 0x7B, 0xF9, 0x82, 0x39, 0x4C,
+    0xC5, 0xD9, 0x5F, 0x71, 0xED, 0xB3, 0x77, 0xB0, 0x59, 0x42, 0x91, 0x2E, 0x10, 0x61, 0x6E, 0xF3,
+    0x43, 0x8C, 0xE6, 0x61, 0x35, 0xB7, 0xFC, 0xCA, 0x15, 0xF8, 0x7A, 0xC3, 0xB2, 0xE9, 0x62, 0x2C,
+    0xB5, 0x56, 0x85, 0x09, 0x64, 0xE5, 0xF8, 0xCD, 0x1C, 0x2C, 0x64, 0x55, 0x79, 0xD5, 0xEC, 0x25,
+    0x52, 0x6C, 0x0E, 0xB6, 0xB4, 0xB2, 0x1D, 0xBC, 0x84, 0x7B, 0x93, 0xC3, 0xC0, 0xD9, 0x17, 0xCD,
+    0xCE, 0x9E, 0xFF, 0x0D, 0x8F, 0x3B, 0x72, 0x5C, 0x2C, 0x3E, 0x62, 0x2F, 0xBE, 0x5C, 0xC4, 0xF1,
+    0x2E, 0x74, 0x11, 0x07, 0xAC, 0x12, 0x16, 0x5B, 0x44, 0x74, 0x25, 0xF0, 0xBF, 0xFB, 0x0E, 0xD3,
+    0xA4, 0x34, 0x83, 0xE4, 0xEF, 0x9A, 0x47, 0x18, 0xAA, 0x7F, 0xC3, 0x99, 0x0B, 0x30, 0x05, 0x34,
+    0x9C, 0xFD, 0x88, 0x8C, 0xB9, 0xD6, 0xC0, 0xD7, 0x5C, 0xD3, 0x42, 0xF0, 0x24, 0x74, 0x3A, 0x24,
+    0xF5, 0x09, 0x09, 0xFF, 0x4D, 0x74, 0xB9, 0xC3, 0x3B, 0x10, 0xF3, 0x8E, 0x7A, 0x4C, 0x5C, 0xB6,
+    0xBA, 0x18, 0x0E, 0xA1, 0x64, 0x4F, 0x77, 0xA1, 0x85, 0xB5, 0x22, 0xEE, 0x57, 0x4B, 0x9B, 0x69,
+    0xEC, 0x66, 0x20, 0xCA, 0x6A, 0xC8, 0xD3, 0xB2, 0x12, 0xAC, 0xD2, 0xA9, 0x5C, 0x4A, 0xB0, 0xB4,
+    0xF8, 0x9B, 0x3C, 0x17, 0x0F, 0xAA, 0xD2, 0xB1, 0x48, 0xEE, 0xA7, 0x49, 0x5D, 0xA4, 0xA1, 0x24,
+    0x86, 0x6F, 0xF3, 0x60, 0x30, 0xFE, 0xF0, 0xC7, 0xFC, 0x6D, 0x76, 0xC2, 0xF1, 0xD2, 0xA7, 0x01,
+    0x23, 0xCE, 0xC1, 0x59, 0x9C, 0x19, 0x14, 0x04, 0x1A, 0x11, 0x96, 0xDD, 0x0B, 0x5E, 0xB2, 0xA4,
+    0x1B, 0xD0, 0xEE, 0x85, 0x27, 0x32, 0xE1, 0x65, 0x4B, 0xDA, 0x4C, 0xDC, 0x1A, 0xB6, 0x6D, 0xB1,
+    0xA1, 0x96, 0xC3, 0xDF, 0xD2, 0x82, 0x5F, 0x66, 0x41, 0xD4, 0xAA, 0xF3, 0x99, 0x96, 0x5D, 0xFB,
+    0xB8, 0xE7, 0x55, 0x68, 0xDF, 0xB9, 0x66, 0x39, 0x3F, 0xDD, 0x5E, 0xF7, 0xED, 0x29, 0x18, 0x9B,
+    0x16, 0x78, 0x85, 0xAC, 0x93, 0xF0, 0x8A, 0xA4, 0x11, 0x62, 0x96, 0x54, 0x46, 0x89, 0x4E, 0x6E,
+    0x1C, 0xED, 0xD1, 0xD0, 0x13, 0x0D, 0xBE, 0xD0, 0xC8, 0x8D, 0x6C, 0x56, 0x99, 0x85, 0xC0, 0x9F,
+    0xD9, 0x9F, 0x17, 0xA9, 0xB9, 0xC0, 0x31, 0x2E, 0xA9, 0x39, 0xCF, 0xD1, 0x22, 0xA9, 0x79, 0x91,
+    0xC0, 0xF6, 0xF8, 0x05, 0xE6, 0xB1, 0x37, 0x53, 0x61, 0xB5, 0x2B, 0x06, 0xFB, 0x1C, 0xE1, 0xB3,
+    0x60, 0xDD, 0xB0, 0x94, 0x39, 0x42, 0x42, 0xCD, 0x02, 0x14, 0x80, 0x43, 0x51, 0x0E, 0x03, 0xFD,
+    0x4C, 0x53, 0x6C, 0x02, 0x98, 0xFE, 0xEB, 0x5D, 0x15, 0x8D, 0xC5, 0x41, 0x3D, 0xB2, 0x1B, 0xE1,
+    0x36, 0xBF, 0x3B, 0xCB, 0x21, 0xBC, 0x7D, 0xB8, 0xCC, 0x09, 0xF0, 0x9C, 0x02, 0x0C, 0xE8, 0x8F,
+    0xED, 0xCD, 0xD7, 0xEF, 0x1C, 0x5E, 0xB3, 0xBF, 0x23, 0xE1, 0x35, 0x2B, 0xC4, 0x89, 0xCF, 0x22,
+    0xCD, 0xD7, 0xB3, 0x43, 0xA5, 0xD5, 0x30, 0x1A, 0x9F, 0xA3, 0x0D, 0xD2, 0x43, 0x3E, 0xF1, 0xB1,
+    0xFE, 0x06, 0xDB, 0x22, 0x73, 0x19, 0xFD, 0xCC, 0x22, 0x8E, 0xA1, 0x55, 0xD5, 0x18, 0x11, 0x1D,
+    0x83, 0x84, 0x77, 0x94, 0xE2, 0xE2, 0x07, 0x96, 0xF1, 0x05, 0xC0, 0x78, 0x70, 0x38, 0x3E, 0xA2,
+    0x84, 0x5C, 0x0E, 0x6B, 0xFC, 0xC2, 0xF1, 0xDA, 0x52, 0x2D, 0x1D, 0x6B, 0x58, 0xE0, 0x30, 0xAB,
+    0xDE, 0xDB, 0x39, 0x56, 0x05, 0x47, 0x7C, 0x63, 0x8E, 0xB9, 0x3B, 0x4F, 0xCF, 0xF0, 0x5C, 0xFE,
+    0xB1, 0xE6, 0xF7, 0x02, 0x63, 0x69, 0xDA, 0x07, 0xC6, 0xEC, 0x2A, 0x94, 0xF7, 0x60, 0x29, 0x1B,
+    0xB6, 0x0F, 0x92, 0x7D, 0x2F, 0xF7, 0xF2, 0xBE, 0x88, 0x9A, 0xB0, 0x5A, 0x59, 0x25, 0xD7, 0x31,
+    0x19, 0x7D, 0xB1, 0x7F, 0xF0, 0x3D, 0x18, 0x4D, 0x96, 0x22, 0x31, 0x92, 0xB0, 0xC4, 0x3B, 0x8F,
+    0xA5, 0x3A, 0x78, 0x32, 0xD8, 0xD0, 0xBB, 0x42, 0xAF, 0x52, 0x40, 0xDA, 0x0E, 0x21, 0x8D, 0x3B,
+    0x0B, 0x28, 0xBF, 0x6E, 0x04, 0x62, 0xC6, 0xCE, 0x59, 0xCD, 0x81, 0xD4, 0xCC, 0xDE, 0xCB, 0x76,
+    0xEF, 0x35, 0xFE, 0x3C, 0x94, 0xCF, 0xDD, 0x75, 0x23, 0x84, 0xC7, 0x58, 0xDF, 0xFB, 0xEB, 0x32,
+    0x9B, 0x66, 0x85, 0x3A, 0x26, 0xC3, 0x2E, 0x6C, 0x25, 0x44, 0x9B, 0x6B, 0x86, 0xDB, 0x52, 0x2A,
+    0x84, 0x58, 0x3F, 0x40, 0xA1, 0x95, 0x71, 0x34, 0xEC, 0xDF, 0xD3, 0xEC, 0x32, 0x5F, 0x4D, 0x5C,
+    0xC1, 0x75, 0x71, 0xAC, 0x2D, 0xDF, 0x15, 0x13, 0x51, 0xF8, 0x8E, 0x30, 0xE8, 0xE8, 0x39, 0x21,
+    0xB3, 0x89, 0x8E, 0xF3, 0x45, 0xE5, 0xD8, 0x57, 0x55, 0x25, 0xEB, 0x8C, 0xDA, 0x5F, 0x44, 0x56,
+    0xF5, 0xD5, 0x66, 0xE6, 0xFF, 0xD3, 0x00, 0x25, 0x65, 0xF9, 0x93, 0x01, 0x7E, 0xEE, 0xF0, 0xDA,
+    0x80, 0x17, 0x8A, 0x5E, 0x19, 0x90, 0x90, 0x9D, 0xF8, 0x03, 0x02, 0xD2, 0x09, 0xE2, 0xC6, 0x57,
+    0xFD, 0x01, 0x93, 0xD6, 0x91, 0x20, 0x82, 0x60, 0x78, 0x81, 0xFE, 0x8A, 0x20, 0x4D, 0xD7, 0x12,
+    0xBF, 0x73, 0x1E, 0xD3, 0x37, 0x87, 0x25, 0x12, 0x39, 0x05, 0x8E, 0x0B, 0xD5, 0x95, 0x87, 0x70,
+    0xE1, 0xF7, 0x00, 0xB7, 0x24, 0x1E, 0xF6, 0x9F, 0x45, 0x55, 0xFC, 0x47, 0x71, 0x82, 0x54, 0x12,
+    0x13, 0x50, 0x66, 0x22, 0x5A, 0x43, 0x68, 0x8A, 0x5D, 0xE1, 0xA5, 0xEB, 0xFC, 0xFD, 0x0B, 0x19,
+    0xDE, 0xBD, 0xCB, 0xAE, 0x71, 0xA8, 0x56, 0x4B, 0x80, 0x88, 0x41, 0x93, 0x71, 0x56, 0x9C, 0x5F,
+    0x67, 0x25, 0x87, 0x20, 0x55, 0x59, 0xC9, 0x09, 0xA3, 0xFC, 0x1B, 0x2D, 0x95, 0x2E, 0xFB, 0x11,
+    0xC7, 0x4A, 0x0A, 0x10, 0xCF, 0x0A, 0x34, 0x4E, 0x97, 0x77, 0x33, 0x92, 0xAB, 0x6C, 0x18, 0x45,
+    0x1E, 0x6B, 0x47, 0xEF, 0xCC, 0x2D, 0x9D, 0x51, 0xFA, 0xE8, 0x9F, 0xB8, 0x05, 0xEA, 0xFF, 0x62,
+    0x44, 0x03, 0xC8, 0x2A, 0x40, 0xC3, 0x52, 0x76, 0x02, 0x50, 0x11, 0x32, 0x38, 0x51, 0x94, 0x63,
+    0x6E, 0x04, 0x4D, 0xA0, 0x1B, 0xBA, 0x32, 0x26, 0xFD, 0x84, 0x5A, 0x4D, 0x9C, 0xED, 0xEC, 0x77,
+    0xAC, 0x5C, 0xBB, 0x68, 0xED, 0x9F, 0x20, 0x16, 0xAD, 0x24, 0x76, 0x69, 0x5F, 0x01, 0xBF, 0x2D,
+    0xF9, 0x61, 0x2F, 0x43, 0xE0, 0x2C, 0xE9, 0x2D, 0x49, 0x3C, 0x6A, 0x80, 0xD2, 0x73, 0x1D, 0x1A,
+    0xE7, 0xB4, 0xDC, 0x57, 0xB2, 0x7B, 0x0C, 0x22, 0xEF, 0xB1, 0xE5, 0x09, 0xD5, 0x48, 0x52, 0xCB,
+    0x28, 0xEA, 0x7A, 0x30, 0xF3, 0xC8, 0x13, 0x04, 0xD6, 0xC6, 0x24, 0x26, 0xBE, 0x24, 0xD1, 0x28,
+    0x89, 0xA2, 0x73, 0xE5, 0x5B, 0x2A, 0x5E, 0x00, 0x11, 0x3B, 0x27, 0x13, 0x55, 0x49, 0xCF, 0x33,
+    0xFE, 0xF5, 0x5E, 0x3A, 0x1C, 0xFC, 0x54, 0x7B, 0x1E, 0xFE, 0xC8, 0x8A, 0x63, 0x2F, 0xFA, 0xA6,
+    0xF6, 0x3A, 0x16, 0x71, 0x61, 0x7F, 0x27, 0x3B, 0xAB, 0xA1, 0x85, 0x12, 0xAE, 0x67, 0x6F, 0xBE,
+    0x69, 0x39, 0x0C, 0x81, 0x29, 0xC1, 0x3F, 0xDB, 0x18, 0x7D, 0xA5, 0x91, 0x45, 0xE8, 0x5C, 0x19,
+    0xFC, 0xD8, 0xC2, 0x08, 0x5C, 0x86, 0x6F, 0x5B, 0xE1, 0x8B, 0xE1, 0xCB, 0x16, 0xF1, 0x6B, 0x65,
+    0xFC, 0x0D, 0x2B, 0xD4, 0x3C, 0xE3, 0xBF, 0xD0, 0xB6, 0xBA, 0x66, 0xFF, 0xCE, 0x92, 0x36, 0x35,
+    0x22, 0x08, 0xE4, 0xC3, 0xF4, 0x86, 0x2E, 0x3C, 0x36, 0xB4, 0x1F, 0xED, 0xED, 0x15, 0xB9, 0x1A,
+    0x25, 0x32, 0x47, 0x95, 0x3B, 0xAD, 0xE7, 0xE1, 0xB7, 0x9A, 0x0A, 0x23, 0x62, 0x18, 0xD1, 0xCD,
+    0x28, 0x57, 0x8E, 0x9C, 0x38, 0x51, 0x58, 0xC7, 0xC4, 0xFE, 0xA2, 0x75, 0x66, 0xE3, 0xDA, 0x99,
+    0xD4, 0x64, 0x2F, 0xBB, 0x48, 0x16, 0xDF, 0x7E, 0x60, 0x51, 0x8F, 0x20, 0xA4, 0x9E, 0x83, 0x22,
+    0x44, 0x24, 0x4F, 0x62, 0x27, 0xC5, 0x1D, 0x8C, 0x47, 0xF4, 0x65, 0x76, 0xAE, 0x23, 0x7C, 0x95,
+    0xBD, 0xEB, 0x05, 0x52, 0xBF, 0xC0, 0x93, 0x85, 0x8A, 0x68, 0x16, 0x18, 0x21, 0x34, 0x1A, 0x48,
+    0x45, 0xD1, 0xB4, 0x89, 0x25, 0xE3, 0x39, 0xB2, 0x19, 0x57, 0x24, 0xF4, 0x22, 0x3C, 0x6F, 0xA5,
+    0xCA, 0xC5, 0xE4, 0xAE, 0x44, 0x7E, 0xB2, 0x7B, 0xF1, 0x9D, 0x1D, 0xAE, 0x12, 0xC6, 0xFD, 0x78,
+    0x4B, 0x95, 0xBE, 0x95, 0xBC, 0x75, 0x20, 0xF1, 0x65, 0x9D, 0x44, 0x07, 0x2F, 0x6D, 0xA2, 0xBE,
+    0xB7, 0x3E, 0x55, 0xDF, 0x1B, 0xEA, 0x59, 0x0D, 0xF6, 0x16, 0x86, 0xAC, 0x2D, 0x7E, 0x26, 0x1A,
+    0x53, 0x21, 0xD2, 0x79, 0x55, 0xD4, 0x19, 0x2F, 0x84, 0xB2, 0xA8, 0x93, 0x16, 0xF6, 0xD2, 0x1A,
+    0x06, 0x40, 0xC3, 0x41, 0x3A, 0x26, 0x22, 0xA5, 0x82, 0x53, 0xA6, 0x2D, 0x49, 0x43, 0xF4, 0xEA,
+    0x0D, 0x2B, 0x1C, 0xFC, 0x9E, 0xBC, 0x01, 0x17, 0x76, 0x0C, 0x08, 0xCD, 0x7D, 0xC5, 0x85, 0x6F,
+    0xDD, 0xDC, 0xDB, 0xBB, 0xDC, 0xA8, 0xD9, 0xBA, 0x41, 0x80, 0xB2, 0x0C, 0xD6, 0x0A, 0x7E, 0x20,
+    0xE0, 0xAC, 0x4D, 0xBF, 0xA5, 0xFB, 0x89, 0x79, 0x9B, 0xDB, 0x5B, 0xCC, 0x2B, 0xDD, 0xEE, 0x33,
+    0x9C, 0x43, 0xE8, 0xF0, 0xAC, 0x8D, 0xDD, 0x0E, 0xA6, 0x77, 0xBD, 0x38, 0x6E, 0x6C, 0x49, 0xDF,
+    0x18, 0x77, 0x60, 0x3D, 0xC3, 0x07, 0x5D, 0x1D, 0xF6, 0x06, 0xCD, 0xA4, 0xF4, 0x81, 0xFA, 0x44,
+    0xFF, 0xD5, 0xB2, 0x21, 0x69, 0x02, 0xD8, 0x2F, 0xE8, 0x49, 0x28, 0x81, 0x2D, 0x93, 0x56, 0x56,
+    0x3E, 0x91, 0xC0, 0x52, 0x96, 0x31, 0x94, 0xF4, 0x52, 0x56, 0x32, 0x8C, 0xB7, 0xA5, 0x2C, 0x66,
+    0x18, 0x6E, 0xCB, 0x40, 0x70, 0x36, 0x32, 0x94, 0xC8, 0x52, 0x2B, 0xA1, 0xD7, 0x88, 0x43, 0xAA,
+    0x46, 0x5D, 0x07, 0xFA, 0xB5, 0xC5, 0xCE, 0x4C, 0x21, 0xD4, 0x0F, 0xBC, 0x35, 0x0F, 0x78, 0x72,
+    0x69, 0xB9, 0xAD, 0x9B, 0xC6, 0x24, 0x61, 0x26, 0x9D, 0xA3, 0x88, 0xDD, 0x1C, 0x76, 0x76, 0xF4,
+    0x3D, 0xB8, 0xB6, 0x80, 0x0E, 0x13, 0x3D, 0x2D, 0xD0, 0x51, 0x62, 0x1D, 0xD0, 0x0D, 0x52, 0xD6,
+    0x24, 0x6E, 0x5C, 0xE2, 0xAE, 0x53, 0x61, 0x65, 0xE7, 0x1C, 0xE2, 0x17, 0xDC, 0xA8, 0xE0, 0x0E,
+    0x37, 0xF7, 0x68, 0x35, 0x5C, 0xD7, 0x9D, 0x4E, 0x2A, 0xE6, 0x35, 0xAB, 0x62, 0xC3, 0xDB, 0xF0,
+    0xCC, 0x82, 0xF3, 0xBD, 0xCC, 0x43, 0x25, 0xCB, 0x78, 0xE1, 0xC6, 0x0C, 0xAE, 0x83, 0x0C, 0x43,
+    0x16, 0x8D, 0xDE, 0xD5, 0x32, 0xE1, 0x48, 0xC9, 0x98, 0x05, 0x9B, 0x6B, 0xB6, 0x89, 0x79, 0xA9,
+    0x94, 0x8C, 0xE6, 0x84, 0xF2, 0x9D, 0x6A, 0x92, 0x5F, 0xBD, 0x8E, 0x65, 0xFD, 0x8C, 0xA5, 0xFA,
+    0xF8, 0x7A, 0xA9, 0x16, 0xC3, 0xC2, 0x7E, 0x28, 0xF9, 0x67, 0x49, 0xBF, 0x4D, 0xEB, 0x91, 0xCD,
+    0x35, 0x08, 0x3C, 0xC0, 0x58, 0xA3, 0xB6, 0xD5, 0xC9, 0x52, 0xCC, 0x70, 0xD0, 0xB3, 0x8A, 0x46,
+    0xE7, 0xF3, 0x24, 0x24, 0x3F, 0xA8, 0x96, 0x34, 0x34, 0x3B, 0x2F, 0x80, 0xE7, 0xC0, 0x70, 0x87,
+    0x8B, 0x85, 0x17, 0x0E, 0x2E, 0xF7, 0x0D, 0x18, 0xFE, 0x06, 0xFE, 0xC5, 0x72, 0xC9, 0x0B, 0x9C,
+    0xAB, 0x2F, 0x76, 0xB9, 0x4B, 0x26, 0x61, 0xE3, 0x7A, 0x96, 0x4B, 0x46, 0xCB, 0x56, 0x9A, 0xB1,
+    0x21, 0x30, 0xA9, 0x4E, 0xDA, 0x8E, 0xB7, 0x1E, 0x6D, 0xF8, 0xE1, 0x6C, 0xC7, 0x8A, 0xBD, 0x50,
+    0x8B, 0xA0, 0x32, 0xFF, 0x8B, 0x19, 0x26, 0xDD, 0x18, 0xBC, 0x36, 0xB9, 0x9C, 0x23, 0xCC, 0x95,
+    0xA5, 0x5B, 0xAE, 0x2F, 0x51, 0xB0, 0x5C, 0xCE, 0xB6, 0xF8, 0x9A, 0xA6, 0x28, 0x62, 0x67, 0xC7,
+    0x76, 0x09, 0x52, 0x05, 0xC9, 0x22, 0xEA, 0x35, 0x2E, 0x2D, 0x63, 0x01, 0xF0, 0xC9, 0xA2, 0x77,
+    0xC1, 0x69, 0x0B, 0xE1, 0x43, 0x93, 0x51, 0xB3, 0x94, 0x52, 0x27, 0x1E, 0x31, 0x59, 0xC4, 0xB5,
+    0x86, 0x4C, 0x9B, 0x92, 0x7D, 0x57, 0x2A, 0x10, 0x05, 0x24, 0x0A, 0xD6, 0x9F, 0xB2, 0x7C, 0xD7,
+    0x56, 0x08, 0xEF, 0x5F, 0xDA, 0x83, 0x73, 0x95, 0x39, 0xE1, 0xDC, 0xA8, 0x19, 0x12, 0x0B, 0xBE,
+    0xC9, 0x21, 0x3D, 0x3F, 0x14, 0xE4, 0xA4, 0x2D, 0x4F, 0xB2, 0x9D, 0xE9, 0xC3, 0x85, 0x7A, 0x4E,
+    0x73, 0x4F, 0xD7, 0x6A, 0x7A, 0x4F, 0x88, 0x99, 0x90, 0x0A, 0xC8, 0x68, 0x27, 0x62, 0x01, 0x88,
+    0xCD, 0x43, 0x1C, 0x17, 0x05, 0xE7, 0x3C, 0x6B, 0xEB, 0x9D, 0xAC, 0x13, 0x7A, 0x9F, 0x3F, 0xB3,
+    0x7F, 0x33, 0x8F, 0x03, 0x40, 0xC8, 0xF1, 0x70, 0x69, 0xCD, 0x44, 0x71, 0x3B, 0xC4, 0x45, 0x1D,
+    0x8C, 0xEE, 0x77, 0x6F, 0x72, 0x32, 0xBB, 0x48, 0x8B, 0x5F, 0x57, 0xEB, 0xE1, 0xBD, 0x83, 0xC7,
+    0x10, 0x53, 0xEC, 0xB1, 0xBE, 0x9A, 0x47, 0x3E, 0x73, 0xD9, 0x3C, 0x82, 0x80, 0x9D, 0x47, 0xCC,
+    0x67, 0x18, 0x70, 0x02, 0x18, 0x01, 0x62, 0x29, 0x0C, 0xC2, 0xBB, 0x00, 0xF2, 0x85, 0x50, 0xBE,
+    0x1E, 0xB3, 0xBA, 0x1F, 0x71, 0xB1, 0x90, 0xAC, 0x8E, 0xD8, 0x00, 0x91, 0xB4, 0x91, 0xE4, 0xB1,
+    0x5D, 0xDE, 0xAD, 0x45, 0xAA, 0x4B, 0x31, 0x71, 0xC2, 0x05, 0x76, 0x3F, 0xF1, 0xAB, 0x4C, 0x3F,
+    0x1A, 0x17, 0x18, 0xC9, 0x78, 0x17, 0x07, 0xCF, 0x6B, 0x3E, 0x4A, 0xD1, 0x60, 0xDD, 0xC5, 0x9D,
+    0xD4, 0x34, 0x91, 0xE8, 0x38, 0x49, 0x0C, 0x44, 0xEC, 0x93, 0x44, 0x64, 0x43, 0x84, 0x67, 0xF0,
+    0x08, 0x03, 0xD2, 0x75, 0x58, 0xFA, 0x97, 0xD0, 0xDA, 0x0A, 0x89, 0xB7, 0x04, 0x56, 0x88, 0x77,
+    0x66, 0x75, 0xFE, 0x97, 0x16, 0xA1, 0x0A, 0xFE, 0xF8, 0x3D, 0xF5, 0xA2, 0xCA, 0x3D, 0xD9, 0x9F,
+    0xC4, 0x9B, 0x40, 0x9F, 0xC7, 0xDB, 0x41, 0x33, 0xA4, 0x11, 0xAF, 0xDC, 0x6E, 0x73, 0x47, 0x63,
+    0xAB, 0x96, 0x4D, 0x71, 0x78, 0x69, 0x60, 0xFA, 0xB7, 0x4F, 0x43, 0x7A, 0x1C, 0x9C, 0x8B, 0x91,
+    0x16, 0x6E, 0x86, 0x5A, 0x2E, 0xA4, 0x14, 0x47, 0xBD, 0x86, 0x6E, 0x2D, 0xAD, 0x14, 0x4E, 0x23,
+    0x52, 0x71, 0x9A, 0xB9, 0xBD, 0xED, 0x97, 0xA0, 0xB9, 0xA0, 0x2E, 0xBB, 0xDC, 0xAE, 0xB6, 0x3F,
+    0x40, 0xDC, 0x74, 0x80, 0x18, 0xF3, 0xA5, 0xF3, 0x8E, 0x49, 0xCC, 0xD7, 0x52, 0x59, 0x75, 0xCE,
+    0x44, 0x46, 0x82, 0x94, 0x4E, 0x4E, 0xD1, 0xD3, 0xE8, 0xD6, 0x72, 0x25, 0x86, 0xB9, 0xC4, 0x22,
+    0x99, 0x8F, 0x85, 0x4B, 0x1F, 0x04, 0xB2, 0x90, 0x24, 0xA8, 0xD5, 0xBF, 0x85, 0x63, 0x04, 0x95,
+    0x4B, 0x20, 0xBE, 0x0A, 0x51, 0x82, 0x35, 0x81, 0xE3, 0xCC, 0xB4, 0xA4, 0x9B, 0xDA, 0x14, 0xC4,
+    0x2C, 0x44, 0x7D, 0x3F, 0xA5, 0x49, 0xBA, 0x17, 0x84, 0x79, 0xA7, 0x57, 0x64, 0xA9, 0xE7, 0x9D,
+    0x2E, 0xF9, 0x56, 0x16, 0xF8, 0xDB, 0xA2, 0x51, 0xD8, 0x9F, 0x28, 0xFC, 0x27, 0xD9, 0x02, 0xD9,
+    0x2F, 0x2B, 0x15, 0x17, 0x64, 0x6F, 0xC4, 0xAA, 0x41, 0x45, 0xBA, 0x1F, 0xB4, 0xB0, 0x1B, 0xDB,
+    0x0B, 0xD6, 0x6A, 0x9C, 0xF9, 0x93, 0x64, 0xF8, 0x18, 0xC8, 0x68, 0x30, 0x00, 0x84, 0x16, 0xA5,
+    0x96, 0x12, 0x79, 0xB7, 0x6C, 0x0B, 0xBB, 0xEF, 0xAA, 0x90, 0x25, 0x31, 0x9F, 0x78, 0x70, 0x9A,
+    0x34, 0x0B, 0x18, 0x0F, 0x5A, 0x1F, 0xBE, 0xAC, 0x2E, 0xC0, 0x2A, 0xEB, 0x60, 0xF6, 0x52, 0x03,
+    0xCA, 0xD2, 0x22, 0xAC, 0x23, 0x80, 0xF5, 0x81, 0xEE, 0xB6, 0x2B, 0x7B, 0x59, 0x6A, 0xDE, 0xA8,
+    0x60, 0xAA, 0xC0, 0x55, 0x99, 0xC2, 0xAB, 0x3E, 0x79, 0x49, 0xAC, 0xC6, 0x71, 0x53, 0x88, 0x0C,
+    0xB7, 0x12, 0xF3, 0x9A, 0xDF, 0x2F, 0x85, 0x04, 0x5B, 0x35, 0x5C, 0x26, 0xA9, 0xDC, 0x6B, 0x6B,
+    0xCD, 0x7C, 0xF6, 0x45, 0x9D, 0xAA, 0xED, 0x37, 0x9E, 0x78, 0x0D, 0x4F, 0x11, 0x53, 0x1C, 0xA9,
+    0x66, 0x92, 0x1B, 0x26, 0x4E, 0x8B, 0x1A, 0xB5, 0x71, 0xFC, 0x26, 0xC4, 0x23, 0x4E, 0x6F, 0x9A,
+    0x43, 0x1F, 0xB0, 0x29, 0x9E, 0xFF, 0x78, 0x93, 0xCE, 0xCF, 0x64, 0x6A, 0x14, 0x80, 0x89, 0x99,
+    0xD9, 0xD1, 0x57, 0x53, 0x8E, 0x3C, 0x00, 0x4E, 0x09, 0xD5, 0x48, 0x99, 0x94, 0x64, 0xED, 0xA4,
+    0x9A, 0xCE, 0x4B, 0xFE, 0xC6, 0x7D, 0xC2, 0xF2, 0x6A, 0xC7, 0x34, 0x28, 0x1A, 0x04, 0x2F, 0x50,
+    0x8F, 0x97, 0xB5, 0xF8, 0x04, 0x6A, 0x5D, 0x68, 0x61, 0x3C, 0x4C, 0x2D, 0x70, 0x64, 0xB0, 0x18,
+    0xC5, 0x89, 0x0A, 0x5C, 0x74, 0x38, 0x91, 0x8C, 0x2B, 0x0E, 0xA7, 0xC7, 0x74, 0x0E, 0x8F, 0x7A,
+    0x4F, 0xF2, 0xD8, 0x98, 0x88, 0x0C, 0x34, 0x58, 0x72, 0x7F, 0x1A, 0x0E, 0x1A, 0x31, 0x7E, 0xDF,
+    0x88, 0xF5, 0xB3, 0xE7, 0x2A, 0xED, 0x0F, 0x0D, 0xCC, 0x77, 0x4A, 0xD7, 0x4F, 0xCF, 0xBE, 0x8B,
+    0x92, 0x21, 0x18, 0x10, 0x7B, 0x3D, 0xC5, 0x7B, 0x89, 0x76, 0x86, 0x15, 0x25, 0xE2, 0x32, 0x28,
+    0x5E, 0x0B, 0xC9, 0x01, 0xA2, 0x4B, 0xAC, 0x11, 0xF6, 0x9D, 0xD0, 0xC8, 0x4B, 0xA3, 0x2D, 0x7F,
+    0x0B, 0xD6, 0x92, 0xE5, 0xAC, 0xD6, 0x40, 0x38, 0x2B, 0xD1, 0x3B, 0xCB, 0x1A, 0x9C, 0x27, 0x13,
+    0x8E, 0x09, 0xBC, 0x7C, 0xB7, 0x59, 0xC8, 0xCA, 0xEE, 0x44, 0x1A, 0xC2, 0x59, 0xF9, 0x02, 0xC9,
+    0x65, 0x31, 0xDE, 0xB7, 0xC7, 0x10, 0xF3, 0x18, 0x21, 0x0A, 0x6D, 0x62, 0xE1, 0x16, 0xFD, 0x21,
+    0x6A, 0x41, 0xB1, 0x58, 0x50, 0x90, 0x0C, 0x98, 0xFA, 0x4A, 0x98, 0xD9, 0x43, 0xB4, 0x32, 0x88,
+    0xC6, 0xE3, 0x70, 0xE3, 0x46, 0x78, 0x8E, 0xCF, 0x4E, 0x73, 0xA4, 0xA1, 0xB3, 0x3E, 0xC5, 0x35,
+    0x4F, 0x39, 0x9F, 0x85, 0x0D, 0x30, 0xA5, 0xA0, 0x22, 0xFA, 0x0B, 0x5A, 0x34, 0x51, 0xAA, 0x68,
+    0xD2, 0xC6, 0xC6, 0xA1, 0xAB, 0x53, 0x0E, 0x8D, 0xBA, 0x0B, 0x46, 0x6E, 0x46, 0x4F, 0xB9, 0x62,
+    0x94, 0xAD, 0x2D, 0x07, 0x2E, 0xDE, 0xDB, 0xF3, 0xB3, 0x61, 0xA1, 0xC5, 0x77, 0x5C, 0xF4, 0x4D,
+    0x5E, 0x34, 0x6A, 0xCF, 0xD3, 0x54, 0xBB, 0xD2, 0x38, 0x8A, 0x5F, 0x60, 0x3D, 0x9E, 0x98, 0xCA,
+    0x32, 0xAF, 0xD5, 0x84, 0xA4, 0x9F, 0x69, 0xAC, 0x66, 0x54, 0x74, 0x39, 0xA9, 0x6E, 0xD9, 0x38,
+    0x68, 0x7F, 0x3C, 0xA5, 0x71, 0x16, 0xD3, 0xB7, 0xBE, 0xBD, 0xBE, 0x3B, 0xBD, 0xDE, 0xCC, 0x6A,
+    0x06, 0x48, 0x21, 0x06, 0xF1, 0x29, 0x42, 0x50, 0x62, 0x7D, 0xEA, 0xBD, 0x3E, 0xE2, 0x54, 0xFC,
+    0xF4, 0xB1, 0xA9, 0x8C, 0x88, 0xAB, 0x1F, 0x32, 0xAF, 0x11, 0xD2, 0x8A, 0x07, 0x7B, 0x05, 0x90,
+    0xAD, 0xC4, 0x1A, 0xD2, 0xDD, 0x0E, 0xE8, 0x95, 0xFA, 0x3D, 0xDC, 0xA5, 0x68, 0xF5, 0x9E, 0x08,
+    0x98, 0xA7, 0x69, 0x40, 0x36, 0x1A, 0x8A, 0x8A, 0xF8, 0xAC, 0xF3, 0xBD, 0xD7, 0x23, 0xE0, 0xFD,
+    0x96, 0x95, 0xE5, 0x2E, 0x55, 0x7F, 0x0A, 0x09, 0x91, 0x76, 0x75, 0x0F, 0x7A, 0x47, 0x76, 0xA6,
+    0x1F, 0x49, 0x7F, 0xCA, 0x54, 0x1A, 0x49, 0xB5, 0x36, 0x86, 0x6F, 0xFF, 0xE7, 0x39, 0xAD, 0x2A,
+    0x20, 0xF3, 0x94, 0x0A, 0x17, 0x46, 0x75, 0xED, 0x12, 0xD3, 0x25, 0x6D, 0x25, 0x29, 0x79, 0x63,
+    0xBB, 0xD0, 0xB6, 0x4C, 0x5C, 0xC8, 0x0A, 0x07, 0x99, 0x71, 0x06, 0x31, 0x67, 0x85, 0x2C, 0xD9,
+    0x6C, 0x7A, 0xF9, 0xB2, 0xA4, 0x64, 0xA1, 0x44, 0x00, 0x16, 0x2F, 0x9E, 0x3E, 0xE6, 0xA7, 0x4B,
+    0x57, 0x5F, 0x9B, 0x88, 0x4F, 0x3D, 0xA9, 0xDE, 0xAF, 0x8E, 0x96, 0x59, 0xA5, 0x2F, 0xDD, 0xC2,
+    0x61, 0xED, 0xA3, 0x8F, 0xB6, 0x87, 0x36, 0xD3, 0x54, 0x29, 0x74, 0x4A, 0xBB, 0x0D, 0x46, 0xBA,
+    0xF6, 0xD4, 0x8C, 0x10, 0x6F, 0xFC, 0x04, 0xC8, 0x18, 0x53, 0x17, 0x68, 0x1A, 0x49, 0x59, 0xBF,
+    0xBF, 0xA1, 0xD7, 0x3A, 0xC8, 0x60, 0xDC, 0x2F, 0xAA, 0xAC, 0x16, 0x09, 0x25, 0xA9, 0xB3, 0x4A,
+    0x0C, 0x0A, 0x49, 0x95, 0x94, 0x32, 0x46, 0x71, 0x1E, 0xB1, 0x24, 0x4F, 0x97, 0x3E, 0x6E, 0x3C,
+    0x76, 0x8A, 0x28, 0x99, 0x45, 0x0A, 0x9B, 0x62, 0x8D, 0x3D, 0x1E, 0x33, 0xB7, 0xC5, 0xD6, 0xBE,
+    0x51, 0xB8, 0x3B, 0xCB, 0x5A, 0x83, 0x53, 0x80, 0x17, 0xCA, 0xD6, 0x98, 0xC2, 0x17, 0x8E, 0x01,
+    0x71, 0x51, 0x2E, 0x55, 0x78, 0x53, 0xF6, 0x2A, 0x44, 0x56, 0x52, 0x18, 0x5B, 0xF6, 0xEF, 0x78,
+    0x76, 0xB8, 0x7C, 0x03, 0x25, 0x78, 0x11, 0xAE, 0x21, 0x21, 0x5B, 0x01, 0x92, 0x5E, 0x47, 0x61,
+    0xEB, 0xC4, 0x06, 0xF3, 0xCA, 0x3E, 0x74, 0x7A, 0x80, 0x5A, 0xCD, 0x03, 0x17, 0xED, 0x1A, 0xFE,
+    0xDC, 0x21, 0xB9, 0x7A, 0x3A, 0xB7, 0x16, 0xED, 0x89, 0x8D, 0xAD, 0x39, 0xC5, 0x12, 0x8E, 0x91,
+    0x83, 0x7F, 0x71, 0x68, 0x86, 0x36, 0x99, 0xD2, 0x1F, 0x11, 0xC3, 0xFD, 0x1E, 0x48, 0x1C, 0x17,
+    0xD1, 0x62, 0x27, 0xED, 0xF5, 0xCE, 0x67, 0x87, 0xA3, 0x6F, 0xFD, 0x21, 0xE8, 0x96, 0x24, 0x3F,
+    0x76, 0xDE, 0x10, 0xB0, 0x1E, 0x48, 0xD4, 0xB8, 0xF7, 0x5B, 0x5E, 0xB9, 0x2B, 0xD2, 0x11, 0xFF,
+    0x52, 0x95, 0x1D, 0x68, 0xD6, 0x49, 0xBB, 0x81, 0x54, 0xB7, 0x43, 0xC6, 0x6F, 0xAD, 0x54, 0xEB,
+    0x61, 0x9A, 0xDF, 0xE8, 0xBA, 0xF6, 0x56, 0xBA, 0xB4, 0x83, 0x41, 0x3C, 0x61, 0xFB, 0x05, 0xFD,
+    0x2F, 0x0B, 0xFC, 0x3F, 0xC1, 0x72, 0x7F, 0x12, 0xA2, 0x78, 0x2A, 0xA4, 0x4B, 0x18, 0x82, 0x96,
+    0x55, 0x37, 0x63, 0xB8, 0x11, 0xA2, 0x25, 0xFD, 0x52, 0x23, 0x27, 0x7F, 0xCD, 0x4B, 0x1F, 0x3F,
+    0xF2, 0xF5, 0xFF, 0xD5, 0x7B, 0xB7, 0xE1, 0xBD, 0x33, 0x27, 0x76, 0x76, 0x76, 0x66, 0x21, 0xA6,
+    0xE6, 0xA9, 0xE7, 0xF7, 0x21, 0x04, 0xFE, 0x1B, 0xAF, 0xFC, 0xBD, 0x23, 0x06, 0xF0, 0x61, 0xF1,
+    0xF6, 0x8D, 0x0E, 0xA8, 0x0F, 0xC5, 0x50, 0x48, 0x17, 0x1E, 0x20, 0xC1, 0xA3, 0x84, 0x1F, 0x88,
+    0xD5, 0x79, 0x08, 0x59, 0x15, 0x0C, 0x17, 0x48, 0xCD, 0x7D, 0x5C, 0x3D, 0xDF, 0x42, 0x0F, 0xA4,
+    0xD5, 0xD2, 0x8B, 0xC7, 0xB4, 0xF3, 0x2B, 0xE7, 0x05, 0x8B, 0x0E, 0xD7, 0x31, 0x54, 0x1A, 0x5B,
+    0xD8, 0x37, 0xA5, 0x5A, 0xB5, 0xD8, 0xF2, 0xEA, 0x59, 0xF6, 0xFB, 0xD1, 0xED, 0x46, 0xE1, 0x25,
+    0x97, 0x39, 0xEF, 0xED, 0x69, 0x28, 0x98, 0x27, 0xD5, 0x26, 0x3C, 0x44, 0xF4, 0x22, 0xCE, 0x12,
+    0x91, 0xA0, 0x05, 0x6B, 0x83, 0x67, 0xC4, 0xB6, 0x74, 0x7C, 0xD3, 0x39, 0xE9, 0x4B, 0xCC, 0x4A,
+    0x92, 0x4A, 0xB8, 0x7F, 0x85, 0x6F, 0x8A, 0x28, 0xCA, 0xCE, 0xBD, 0x56, 0x72, 0x97, 0x8D, 0xF1,
+    0x40, 0x9F, 0x6A, 0x64, 0x58, 0x9A, 0x05, 0x6B, 0x1D, 0xCB, 0x3A, 0xC6, 0xE1, 0x01, 0xFC, 0x42,
+    0x3D, 0xC4, 0x6C, 0xBC, 0x4F, 0xCA, 0x03, 0xC3, 0x02, 0xE6, 0x8F, 0x90, 0x6E, 0x76, 0xF5, 0x37,
+    0x68, 0x89, 0xFC, 0x5A, 0x52, 0x71, 0xC2, 0xEA, 0xB0, 0x72, 0xF9, 0xF1, 0x71, 0xEB, 0xBA, 0x95,
+    0xB0, 0xF7, 0x29, 0x63, 0x41, 0xA4, 0x23, 0x12, 0xE7, 0xAD, 0x46, 0x17, 0xFD, 0xAB, 0x1B, 0x3C,
+    0xA7, 0x3E, 0xB1, 0x73, 0x8E, 0x2D, 0xB8, 0x9C, 0x36, 0x50, 0x0D, 0xA8, 0xF6, 0xA0, 0xC1, 0x91,
+    0x27, 0x6D, 0xF9, 0x84, 0x1C, 0xC3, 0xB1, 0x4A, 0x6C, 0xDA, 0x25, 0x97, 0x1C, 0xD1, 0x8C, 0xF2,
+    0xA4, 0x3C, 0x65, 0x9E, 0xE6, 0xEA, 0xAF, 0xA5, 0xC4, 0xF1, 0x27, 0x24, 0xAB, 0xF9, 0x65, 0x94,
+    0x7E, 0x5D, 0x17, 0x7C, 0x28, 0xB1, 0x6E, 0xDF, 0xCB, 0xCE, 0x5A, 0x7B, 0x95, 0x66, 0xEF, 0x5B,
+    0x2E, 0xF7, 0x26, 0x9E, 0x95, 0x8C, 0x1E, 0x13, 0xCB, 0x58, 0xE4, 0x2C, 0x26, 0x39, 0xAA, 0x5C,
+    0x8E, 0xA4, 0xD8, 0x4F, 0xFD, 0xE3, 0xC8, 0xB2, 0x99, 0x17, 0x2F, 0x0E, 0xA4, 0x8E, 0xE7, 0x54,
+    0xDE, 0x27, 0xFA, 0x53, 0x2C, 0xB1, 0x53, 0x7F, 0xD0, 0x70, 0x6C, 0x38, 0x68, 0xDC, 0x7F, 0x33,
+    0x7F, 0xC9, 0x2B, 0xF6, 0x37, 0x19, 0xFF, 0xF7, 0xE6, 0xAB, 0xE6, 0xBE, 0xFD, 0xFC, 0x67, 0x87,
+    0xFC, 0x11, 0x74, 0x29, 0x57, 0x44, 0x39, 0x72, 0xF2, 0x72, 0x68, 0xDB, 0x67, 0xCC, 0xCA, 0x71,
+    0xFF, 0x2B, 0x4F, 0xBB, 0x60, 0xF5, 0xA7, 0xA7, 0xA8, 0xF5, 0xFB, 0xFB, 0xF3, 0x47, 0xC2, 0xB7,
+    0xDE, 0x98, 0xAC, 0x63, 0xA1, 0x78, 0x0D, 0xA6, 0x5A, 0x55, 0x4F, 0x49, 0x0C, 0xFD, 0xD3, 0x6C,
+    0xC9, 0xD4, 0x7E, 0xFC, 0x57, 0x1A, 0xA1, 0xDB, 0xFE, 0xC4, 0x33, 0x7D, 0x6D, 0x16, 0xD6, 0xBE,
+    0xB8, 0x79, 0xF4, 0xDC, 0x2D, 0xD2, 0xC5, 0x34, 0x77, 0xF3, 0x5C, 0x54, 0x7F, 0x16, 0x1C, 0x32,
+    0x2F, 0x4C, 0x32, 0x2B, 0x5D, 0xB2, 0xA6, 0xA6, 0xC4, 0xEE, 0x36, 0x97, 0xA6, 0xFA, 0x42, 0x5E,
+    0x23, 0x0E, 0x1F, 0x97, 0x17, 0x90, 0x39, 0xC9, 0xEA, 0xAA, 0x94, 0x2F, 0x10, 0xE3, 0xD9, 0xAC,
+    0xDE, 0x7E, 0x32, 0x95, 0x9B, 0x30, 0x51, 0x35, 0x09, 0xF1, 0xF2, 0xD0, 0xFF, 0x20, 0x9D, 0xB9,
+    0x2F, 0xA3, 0xFF, 0xD5, 0x19, 0x92, 0xED, 0x3B, 0xE9, 0xF0, 0xD2, 0xA8, 0xEA, 0xB3, 0x2A, 0xB7,
+    0x3D, 0xE2, 0x28, 0xE0, 0xAB, 0xEF, 0xB4, 0x5B, 0x31, 0xBB, 0x1D, 0xF9, 0xEE, 0x7D, 0xFE, 0xF9,
+    0x77, 0x32, 0x2B, 0x12, 0x69, 0x27, 0x83, 0xDC, 0x4E, 0x7A, 0x8D, 0x88, 0x88, 0x71, 0x39, 0xD5,
+    0x2D, 0x83, 0xF9, 0x80, 0x2F, 0x09, 0xD5, 0x38, 0x12, 0x20, 0xF4, 0xCA, 0x2C, 0x9A, 0xD9, 0x1C,
+    0xB5, 0xB3, 0x39, 0xFA, 0x43, 0xF7, 0xAE, 0xF3, 0x5A, 0x33, 0x33, 0xFC, 0x99, 0x19, 0x7E, 0xFE,
+    0xA8, 0x1E, 0xFE, 0x96, 0xF9, 0x9A, 0xEA, 0x54, 0x89, 0xE4, 0xD0, 0xA9, 0x50, 0x4D, 0x0A, 0x5A,
+    0x69, 0xC6, 0x44, 0xBA, 0x7F, 0x21, 0x75, 0x5A, 0x6B, 0x85, 0xD5, 0x7A, 0x31, 0x1F, 0xB7, 0x49,
+    0xA2, 0x7C, 0xBD, 0xE0, 0x96, 0x1B, 0xE8, 0x62, 0x5D, 0x2F, 0x65, 0xED, 0xEB, 0x76, 0x29, 0xE3,
+    0xC1, 0x7A, 0xCA, 0xB8, 0x79, 0x08, 0x52, 0xC6, 0xC3, 0x7C, 0x5E, 0x59, 0x4C, 0xDF, 0x3B, 0x5B,
+    0x2B, 0x73, 0xDF, 0xCF, 0x63, 0x1A, 0x39, 0xC4, 0x12, 0xD1, 0xF7, 0xC7, 0x49, 0x0C, 0x12, 0xE8,
+    0x23, 0x85, 0x48, 0x24, 0xE8, 0xD4, 0xBB, 0xAD, 0x84, 0xE1, 0x5A, 0x56, 0x41, 0xA4, 0x7E, 0x8B,
+    0xC7, 0x55, 0x0A, 0x68, 0xD2, 0x6B, 0xF8, 0xB2, 0x6B, 0xD4, 0x6B, 0xA9, 0x3D, 0x49, 0xB5, 0x9D,
+    0xB5, 0xDE, 0xAC, 0x95, 0x2A, 0xEF, 0xA8, 0x63, 0xC9, 0xC1, 0x4B, 0xE2, 0x8C, 0x73, 0x87, 0xCD,
+    0x98, 0x07, 0x30, 0x44, 0x69, 0xBD, 0xB4, 0xE6, 0x7E, 0xD1, 0x6B, 0xED, 0xA2, 0xB1, 0x54, 0xE6,
+    0xBC, 0x92, 0x90, 0x54, 0xB1, 0x71, 0xED, 0x58, 0x43, 0xE8, 0x27, 0xD7, 0xF8, 0xCA, 0x9F, 0x7C,
+    0xC0, 0xB2, 0xFE, 0x7B, 0x96, 0x05, 0xEA, 0x7D, 0xA9, 0x71, 0x8B, 0xAD, 0x60, 0x2F, 0x23, 0xD0,
+    0x3D, 0x90, 0x30, 0x44, 0x59, 0x09, 0xD5, 0x9D, 0x4B, 0x6B, 0xD6, 0xB3, 0x53, 0xA8, 0x4E, 0xB0,
+    0x99, 0xF7, 0x1B, 0xA8, 0xC0, 0xFD, 0x5D, 0xD8, 0x79, 0xED, 0x0B, 0xBC, 0x66, 0xB5, 0xC2, 0x3D,
+    0x42, 0x82, 0xDD, 0x8C, 0x14, 0xD8, 0xB4, 0x9C, 0xD2, 0x7C, 0xFB, 0xB6, 0xFE, 0x43, 0xBE, 0xB2,
+    0x5E, 0x61, 0xE1, 0x5F, 0xE5, 0x3B, 0x90, 0x34, 0x44, 0x77, 0x1B, 0x76, 0xF9, 0x5D, 0x7E, 0x8A,
+    0xB7, 0x90, 0xE4, 0xE7, 0xEA, 0x04, 0xAA, 0x2B, 0x99, 0x0B, 0xB3, 0x83, 0x05, 0x1E, 0x59, 0xEB,
+    0xF3, 0x49, 0x7B, 0x90, 0x3A, 0x23, 0xD3, 0xB7, 0xF7, 0xF6, 0xD2, 0x59, 0xCC, 0xED, 0xF9, 0x31,
+    0xAF, 0xED, 0x8A, 0x4B, 0x75, 0x5B, 0x48, 0xC6, 0x09, 0x92, 0xE2, 0x02, 0xFB, 0xD1, 0xDE, 0x6B,
+    0x8B, 0xD1, 0x27, 0xF8, 0xD9, 0x35, 0xE8, 0xA8, 0x3F, 0xD6, 0x2B, 0x5D, 0x2B, 0x5A, 0x2A, 0xE6,
+    0xDE, 0xB1, 0x01, 0x8F, 0x4E, 0x4A, 0xA4, 0x57, 0xA2, 0xF1, 0x45, 0x48, 0xFF, 0xD4, 0xDD, 0x40,
+    0x0F, 0xDA, 0x29, 0x5D, 0xAE, 0x54, 0x1F, 0xB8, 0x04, 0x80, 0x04, 0xEC, 0xB0, 0xCE, 0xB9, 0x9F,
+    0x09, 0x54, 0xC6, 0x08, 0x6D, 0x28, 0x2D, 0xC2, 0xCF, 0xB6, 0xD3, 0xE3, 0x36, 0xED, 0x9B, 0xD8,
+    0x30, 0x12, 0x31, 0x75, 0xF6, 0x1E, 0xB6, 0xFA, 0xB1, 0xEA, 0xC5, 0x7A, 0x5D, 0x57, 0x94, 0x54,
+    0xCB, 0x24, 0x0F, 0xAB, 0x8E, 0x1A, 0x14, 0xCC, 0x76, 0xCD, 0x62, 0x6C, 0xF4, 0x56, 0x99, 0x95,
+    0xC0, 0xF2, 0xE6, 0x93, 0x0C, 0x85, 0xD1, 0x60, 0x18, 0x19, 0x0C, 0x23, 0xA3, 0x61, 0x64, 0x20,
+    0xE6, 0x60, 0x29, 0x60, 0x91, 0x9A, 0x31, 0x2E, 0xEF, 0x48, 0x70, 0xF3, 0x07, 0x4A, 0xD2, 0x70,
+    0x24, 0xD3, 0x4D, 0x09, 0x5E, 0xAA, 0x03, 0xEC, 0x4B, 0x0E, 0x5B, 0x00, 0xD0, 0x63, 0xEF, 0x50,
+    0x61, 0xAD, 0x76, 0xE5, 0x84, 0x41, 0x02, 0x6A, 0xA7, 0xBF, 0x2F, 0x65, 0x66, 0x96, 0x1C, 0x04,
+    0xD2, 0xA0, 0xF2, 0x3C, 0x9C, 0xD1, 0x0E, 0xA8, 0xAF, 0xC4, 0xE9, 0x7A, 0xEE, 0xE0, 0x84, 0x1C,
+    0xCE, 0xF0, 0x02, 0x36, 0x5E, 0x56, 0x76, 0x0B, 0xD4, 0x62, 0x0D, 0xB4, 0x6A, 0xA3, 0x84, 0x70,
+    0x49, 0x4F, 0xB7, 0xCE, 0xAC, 0x67, 0x10, 0x69, 0x4B, 0xB4, 0x27, 0xC0, 0x61, 0x3E, 0x0B, 0xB4,
+    0x9E, 0x1C, 0xEC, 0xF3, 0xEA, 0x26, 0x21, 0x3C, 0x63, 0x26, 0x62, 0x03, 0xC2, 0x53, 0x8F, 0x89,
+    0xB0, 0x12, 0x3F, 0x38, 0x92, 0xC0, 0x91, 0x54, 0x70, 0x0C, 0x0B, 0xE6, 0x34, 0x47, 0x5B, 0x6A,
+    0xA4, 0x76, 0xA3, 0x29, 0x52, 0x0B, 0xCE, 0x5F, 0xA4, 0x9D, 0x80, 0x90, 0xA8, 0x8A, 0xB5, 0x91,
+    0x04, 0x95, 0x35, 0xA2, 0x7E, 0xB7, 0x87, 0x1A, 0x0D, 0xA3, 0x04, 0x11, 0xF5, 0x88, 0xEB, 0xDA,
+    0x30, 0x49, 0xE1, 0xEA, 0xE7, 0x31, 0x52, 0x80, 0x48, 0xB3, 0xCA, 0x59, 0xC5, 0x5B, 0xDA, 0xE6,
+    0x54, 0xC4, 0x75, 0x7F, 0x4D, 0xF8, 0xE3, 0xE6, 0xB7, 0xD9, 0x14, 0xCE, 0xCE, 0x87, 0x0A, 0x95,
+    0xB5, 0x1B, 0xF1, 0x2F, 0x5D, 0x61, 0x6C, 0x25, 0x42, 0x54, 0xD2, 0x78, 0x78, 0x7A, 0x4C, 0x98,
+    0x2F, 0xD2, 0x7D, 0x4A, 0x0F, 0x15, 0x23, 0x45, 0x99, 0x34, 0x92, 0x40, 0xED, 0x37, 0x49, 0x93,
+    0x68, 0xE1, 0xD9, 0xE2, 0x66, 0xEF, 0x5C, 0x2A, 0x2A, 0x4F, 0x14, 0xF4, 0x37, 0x29, 0x88, 0x66,
+    0xEB, 0x44, 0x8C, 0xBB, 0xEC, 0x9C, 0x45, 0xCD, 0x61, 0xF8, 0x44, 0x1B, 0xD5, 0xA8, 0xF8, 0x19,
+    0x88, 0x20, 0x61, 0xE3, 0x83, 0x9C, 0x79, 0x88, 0xE4, 0x1C, 0x78, 0x46, 0xA5, 0xA7, 0x2B, 0x59,
+    0x1B, 0x8D, 0xD4, 0x6C, 0x94, 0xF7, 0xB0, 0x70, 0x64, 0x71, 0x18, 0xA1, 0xAD, 0xAC, 0xBC, 0xAF,
+    0x6F, 0x07, 0x5A, 0x5C, 0x8C, 0xCD, 0xCC, 0xDF, 0xCB, 0x11, 0xF3, 0x26, 0x85, 0xE2, 0xAD, 0x11,
+    0x3B, 0x75, 0x97, 0xD8, 0x53, 0xEA, 0xE3, 0xDA, 0xE2, 0x28, 0x40, 0x30, 0xD2, 0x2A, 0x63, 0xFF,
+    0x16, 0xD7, 0x39, 0xC9, 0x76, 0xB9, 0xA4, 0x49, 0xF8, 0x71, 0xF3, 0xF4, 0x12, 0x31, 0x58, 0x1E,
+    0x9F, 0x5F, 0x11, 0xA8, 0xDF, 0x6E, 0x45, 0x08, 0x86, 0xF5, 0x7C, 0x60, 0x45, 0xAE, 0x8D, 0x03,
+    0x1B, 0x88, 0xAB, 0xF1, 0x63, 0x7B, 0x39, 0x57, 0xB9, 0x52, 0x03, 0x2D, 0x3F, 0xB6, 0x85, 0x8B,
+    0x00, 0xC3, 0x22, 0x8E, 0x06, 0x8D, 0x00, 0x4B, 0x10, 0x01, 0xA6, 0x75, 0x0B, 0xB1, 0x38, 0x50,
+    0x5F, 0x25, 0x5B, 0x61, 0x61, 0x4A, 0xAD, 0x5D, 0x8B, 0x6E, 0x10, 0x11, 0x43, 0xC7, 0x02, 0xDB,
+    0xD3, 0x68, 0x20, 0xCC, 0xCB, 0x69, 0xC1, 0x8B, 0x51, 0x1D, 0xBE, 0xEA, 0x90, 0x0B, 0x87, 0x44,
+    0xE7, 0xDB, 0x20, 0xBF, 0x33, 0x7A, 0x62, 0x0E, 0x8C, 0x16, 0x1E, 0x0B, 0xED, 0xB3, 0x34, 0x07,
+    0x52, 0x10, 0x25, 0x81, 0x97, 0x5C, 0x27, 0x07, 0xED, 0x76, 0xA3, 0x06, 0x17, 0x04, 0xC5, 0xB8,
+    0xE3, 0x26, 0x5A, 0xA8, 0x4F, 0xA8, 0x9B, 0x7A, 0x20, 0x46, 0x2E, 0x36, 0xC3, 0x1E, 0x71, 0xDC,
+    0x04, 0xA9, 0x09, 0xA8, 0xBF, 0x97, 0xC7, 0x29, 0xFC, 0xFC, 0xB9, 0xC4, 0x50, 0xA1, 0xAD, 0xC4,
+    0x55, 0xC3, 0x66, 0x12, 0x3E, 0x49, 0x63, 0x85, 0x98, 0x3D, 0x84, 0x09, 0x22, 0x65, 0xF0, 0xAD,
+    0x99, 0x5E, 0x27, 0x5E, 0x4A, 0x71, 0x57, 0x2D, 0xA7, 0xDC, 0x09, 0x5F, 0xF7, 0xEC, 0xA4, 0x42,
+    0x7E, 0xE9, 0x07, 0x9F, 0x36, 0xB0, 0x86, 0x7A, 0x79, 0x92, 0xB7, 0x3B, 0x4E, 0x01, 0x2A, 0x52,
+    0x0E, 0x73, 0x83, 0xC5, 0xBC, 0xE6, 0x12, 0x8C, 0xDC, 0xB5, 0x40, 0x4C, 0xD0, 0xED, 0x98, 0x6C,
+    0x5E, 0x8C, 0x22, 0x36, 0x1A, 0x76, 0x92, 0xA1, 0x8A, 0x55, 0xD8, 0xCD, 0xC2, 0xB5, 0x3D, 0x39,
+    0x31, 0x71, 0xC9, 0xB2, 0x5C, 0xCB, 0x36, 0x52, 0x54, 0xF1, 0xFE, 0x8F, 0xA0, 0x09, 0x9D, 0xCF,
+    0xF6, 0x43, 0x4F, 0xE2, 0x46, 0x7D, 0x09, 0x2A, 0x0D, 0x24, 0x42, 0x8B, 0xE5, 0x58, 0x14, 0x1D,
+    0x01, 0x78, 0x46, 0x80, 0xC4, 0x69, 0x7D, 0xDC, 0x4E, 0x71, 0x2C, 0xF4, 0x9B, 0x06, 0xA3, 0xCA,
+    0x21, 0x0A, 0x88, 0xA4, 0xF0, 0x9C, 0xCF, 0x07, 0x41, 0xCB, 0x88, 0x55, 0xCE, 0x5D, 0x88, 0xB2,
+    0x27, 0xA1, 0x66, 0x08, 0xE6, 0x6A, 0xE1, 0xCF, 0xCD, 0xE4, 0xC8, 0x12, 0x39, 0x44, 0x21, 0x97,
+    0x43, 0x14, 0x72, 0xE7, 0xC3, 0x50, 0xAD, 0x5E, 0xFD, 0xE9, 0xBE, 0xDA, 0xF8, 0xD7, 0x80, 0x39,
+    0x02, 0x78, 0x12, 0x9C, 0xC6, 0xC9, 0xB2, 0xD6, 0xEA, 0x31, 0x0D, 0x8B, 0x03, 0x88, 0xC2, 0x7E,
+    0xFD, 0xF4, 0x14, 0x88, 0xA6, 0x75, 0x98, 0xAB, 0x53, 0x02, 0xE4, 0xFD, 0x6E, 0x69, 0x00, 0xF3,
+    0x20, 0x6F, 0x2B, 0xF1, 0x4E, 0xEF, 0xB9, 0xB3, 0x22, 0x60, 0xCD, 0xAA, 0xE4, 0x35, 0x51, 0xFF,
+    0x50, 0xCE, 0x5D, 0xE2, 0x5B, 0x2F, 0x11, 0x9D, 0xC7, 0xDB, 0x9A, 0x1F, 0xEB, 0x89, 0xC6, 0xE7,
+    0x82, 0x8F, 0x03, 0xBB, 0xE6, 0x9D, 0x4B, 0xD6, 0x40, 0x7C, 0x74, 0x74, 0x0C, 0x62, 0x87, 0x63,
+    0x8E, 0x63, 0x21, 0x52, 0xCC, 0xE5, 0x91, 0x98, 0xDD, 0x22, 0x3A, 0xFD, 0xBD, 0x06, 0x21, 0x7F,
+    0xE9, 0xAB, 0x0C, 0x4E, 0x71, 0x27, 0xFE, 0x9A, 0x45, 0x33, 0xCF, 0xBE, 0x93, 0x63, 0x1E, 0xDE,
+    0x79, 0x19, 0xDD, 0x7D, 0xE7, 0x15, 0xF0, 0xE9, 0x77, 0xBE, 0x8B, 0x77, 0x78, 0xE7, 0x32, 0xDE,
+    0xE8, 0x7A, 0x6F, 0x5C, 0xD1, 0x4D, 0x64, 0x17, 0x77, 0xF2, 0xD9, 0x20, 0x57, 0x62, 0xC6, 0xDE,
+    0xF9, 0x13, 0x4C, 0xD5, 0x3B, 0xAF, 0x80, 0x1B, 0xBD, 0xF3, 0x12, 0xC4, 0x80, 0xBF, 0x4E, 0x6D,
+    0xEB, 0xA2, 0x0B, 0xC1, 0x51, 0x34, 0xE2, 0x9F, 0xCB, 0xF8, 0xB0, 0xD4, 0x5D, 0xC9, 0xC4, 0xF5,
+    0x52, 0x62, 0xB3, 0x57, 0x8D, 0x4D, 0x42, 0xE2, 0x65, 0x3A, 0x84, 0xEF, 0x12, 0xCD, 0x63, 0x72,
+    0xD4, 0x85, 0x74, 0x97, 0x0F, 0xDE, 0x46, 0x3F, 0x3F, 0xF8, 0x11, 0xFA, 0xF9, 0xC1, 0xBB, 0x58,
+    0x75, 0x1F, 0x48, 0x2C, 0xF4, 0x2D, 0x17, 0x2D, 0x99, 0xCB, 0x3C, 0xB4, 0xF2, 0x19, 0xBA, 0xFB,
+    0xC1, 0xF5, 0x41, 0xBE, 0x80, 0xEE, 0x7E, 0xF0, 0x27, 0xF3, 0x53, 0x3A, 0x58, 0x87, 0x41, 0x74,
+    0x67, 0x21, 0xD3, 0x9F, 0x40, 0x00, 0x64, 0xB2, 0x71, 0x17, 0xFB, 0x81, 0x3E, 0x7B, 0x49, 0xAA,
+    0x12, 0xBE, 0xF2, 0x80, 0xEC, 0x07, 0x94, 0x88, 0xF7, 0x8A, 0x66, 0x3D, 0x45, 0xF1, 0x77, 0x5D,
+    0xC2, 0xCA, 0x3C, 0x53, 0x31, 0x1B, 0x8B, 0xDD, 0xAE, 0xE6, 0xE2, 0x53, 0xC5, 0xFB, 0x01, 0x52,
+    0xBF, 0xE8, 0xFA, 0xD0, 0x09, 0xAB, 0x45, 0x7F, 0x15, 0x63, 0xB6, 0xBE, 0x1F, 0xD2, 0xE3, 0xF7,
+    0x83, 0xD5, 0xFD, 0x20, 0xF2, 0x9F, 0xEE, 0x87, 0x4C, 0xF6, 0x83, 0x44, 0x99, 0x4F, 0x87, 0xA6,
+    0xA4, 0x22, 0xA0, 0x95, 0xD8, 0x78, 0xB2, 0x1F, 0x8C, 0xEE, 0x87, 0x93, 0x92, 0xB3, 0x55, 0x9B,
+    0xDD, 0x0A, 0x90, 0x3E, 0xCE, 0x3E, 0x2A, 0x98, 0xBC, 0x35, 0x19, 0x13, 0x78, 0x12, 0x33, 0xAE,
+    0xB2, 0x63, 0x3A, 0x36, 0xD5, 0x15, 0x86, 0x34, 0xD6, 0x7F, 0xC5, 0x90, 0x96, 0xF7, 0x8B, 0x0C,
+    0xC5, 0x2C, 0x24, 0x21, 0x1F, 0x04, 0x45, 0xB4, 0xC8, 0x1A, 0x51, 0xBC, 0xB3, 0x46, 0xB6, 0x52,
+    0xA6, 0x42, 0x85, 0x33, 0x51, 0x64, 0x22, 0x50, 0x70, 0xD8, 0x69, 0xAF, 0xD7, 0x5B, 0x81, 0x22,
+    0xF7, 0x65, 0x7A, 0x0E, 0x1C, 0xDD, 0x57, 0x4E, 0xEE, 0x6A, 0xC4, 0x25, 0x40, 0x10, 0x16, 0xF3,
+    0xAC, 0x91, 0xB8, 0xFD, 0xAC, 0x15, 0x12, 0x6B, 0x21, 0x3C, 0xA0, 0x42, 0x03, 0xBB, 0x2D, 0x50,
+    0xA9, 0xC1, 0x45, 0x23, 0x9C, 0x96, 0x9A, 0x2E, 0x4B, 0xA9, 0x15, 0x91, 0x27, 0x5C, 0x0E, 0x82,
+    0xEB, 0xEA, 0x64, 0xE6, 0x22, 0xEB, 0x6C, 0xED, 0x6F, 0x10, 0xE7, 0xCC, 0x20, 0x1C, 0x9D, 0xE7,
+    0x7E, 0x94, 0xF0, 0x54, 0x34, 0x62, 0x31, 0xC8, 0xA4, 0x24, 0x3C, 0xF5, 0xB7, 0x9B, 0x55, 0xB6,
+    0x20, 0x78, 0x4B, 0x8F, 0x8F, 0x52, 0xEF, 0xE6, 0xF4, 0x1E, 0x91, 0x75, 0xEF, 0x93, 0xCA, 0x78,
+    0xE0, 0x3D, 0xF8, 0xA0, 0x28, 0xAC, 0xC3, 0x0E, 0x85, 0xE0, 0x63, 0x28, 0x41, 0x25, 0xA0, 0xEE,
+    0x83, 0x42, 0x8F, 0xB9, 0x75, 0xE5, 0xAD, 0xDD, 0x91, 0xBA, 0xBA, 0x87, 0x34, 0x0A, 0xE9, 0x93,
+    0x42, 0x09, 0x05, 0x9F, 0xE0, 0xA7, 0xBD, 0x5F, 0xAD, 0x07, 0x9D, 0x48, 0xFF, 0x02, 0x18, 0xCF,
+    0xC6, 0xA3, 0x7A, 0x4B, 0x07, 0x95, 0xEB, 0x95, 0xEB, 0x9E, 0xEE, 0x70, 0x03, 0x3A, 0x63, 0x55,
+    0xB0, 0x09, 0xF3, 0x49, 0x76, 0x27, 0x89, 0xA0, 0x52, 0xE0, 0xB3, 0x6E, 0x2D, 0xBA, 0x85, 0x1E,
+    0xC9, 0xA9, 0x01, 0x19, 0x47, 0x80, 0xFD, 0x9D, 0x62, 0xAC, 0x4B, 0x8B, 0xD0, 0xE5, 0xE6, 0x0E,
+    0x5F, 0x50, 0x80, 0x5B, 0xD3, 0x5B, 0x79, 0x38, 0x6E, 0x78, 0xFE, 0x74, 0x79, 0x23, 0x01, 0xB1,
+    0x1E, 0x7D, 0x28, 0x60, 0xB9, 0x06, 0x82, 0x75, 0xE0, 0xA6, 0x78, 0x1C, 0x1B, 0x39, 0x43, 0xE9,
+    0xA4, 0xDD, 0xE7, 0x12, 0x7F, 0x18, 0xCD, 0xB0, 0xD2, 0x61, 0x0D, 0x1C, 0xE2, 0x1F, 0x42, 0xBC,
+    0xD4, 0x0D, 0xBD, 0xB9, 0x2D, 0xA2, 0x91, 0xFF, 0x33, 0xE4, 0x6E, 0xBE, 0x75, 0x0F, 0x88, 0x9B,
+    0xF9, 0x71, 0xEA, 0xC7, 0x63, 0x9A, 0x27, 0xC4, 0xAC, 0x4D, 0x1F, 0x14, 0xA2, 0x50, 0xB4, 0x5D,
+    0x36, 0x8E, 0x04, 0x6A, 0x57, 0x81, 0xBA, 0x8B, 0x90, 0xB1, 0x75, 0x68, 0x4E, 0x2B, 0x74, 0xD3,
+    0xE8, 0xE6, 0xD1, 0x4D, 0xA4, 0x99, 0x3E, 0xBF, 0x13, 0xC4, 0x74, 0xBA, 0xF9, 0x74, 0x13, 0x3A,
+    0xC2, 0xC2, 0x25, 0xE0, 0x18, 0x33, 0x3B, 0xAE, 0x20, 0xC0, 0x59, 0x36, 0x63, 0xF6, 0xE2, 0x98,
+    0xC6, 0xF6, 0x59, 0xA2, 0x1F, 0x7D, 0x6F, 0x44, 0xAD, 0x53, 0xEB, 0x59, 0x91, 0xE8, 0xC7, 0x6B,
+    0x23, 0x70, 0x2A, 0x3D, 0x5E, 0xA7, 0x1E, 0xEF, 0xA0, 0xC7, 0x20, 0xFB, 0xC2, 0xAE, 0x1C, 0x9A,
+    0xF4, 0x23, 0xAA, 0x75, 0xCE, 0x19, 0xD5, 0xE3, 0x91, 0x15, 0xD5, 0xC5, 0x27, 0x5E, 0xF6, 0x06,
+    0x44, 0x34, 0x84, 0x81, 0xF1, 0x6D, 0x8B, 0xA8, 0x92, 0x39, 0x3A, 0xBA, 0x5B, 0x26, 0xED, 0xCB,
+    0x95, 0xC6, 0x7C, 0x6A, 0x8A, 0xA1, 0xB3, 0x2E, 0xB7, 0x19, 0xD5, 0x3C, 0xDC, 0x49, 0xB9, 0x70,
+    0x0D, 0x2B, 0xDA, 0x2E, 0x9D, 0x07, 0x39, 0x99, 0xF2, 0x8C, 0x82, 0x59, 0x66, 0xE3, 0xD6, 0xE9,
+    0xCD, 0xE2, 0x1F, 0xAE, 0xA0, 0x90, 0x4C, 0x8E, 0x2F, 0x06, 0x3A, 0xE3, 0xF2, 0xEE, 0xEF, 0x01,
+    0x79, 0xFF, 0x8C, 0x22, 0xD6, 0xA5, 0xED, 0x6B, 0x99, 0xF3, 0xB1, 0xD2, 0xF9, 0xA8, 0xE1, 0x6F,
+    0x28, 0xF9, 0x73, 0x55, 0x7F, 0xD4, 0xF6, 0x47, 0x85, 0x3F, 0x71, 0x3A, 0xBF, 0x20, 0x66, 0x2D,
+    0x99, 0xCF, 0x05, 0x1E, 0x8A, 0xFE, 0x0F, 0x63, 0x98, 0x8E, 0x46, 0x52, 0xA9, 0x4F, 0x52, 0x0C,
+    0x01, 0xC6, 0xD9, 0x02, 0xCC, 0x68, 0x0E, 0x58, 0x0F, 0x00, 0x33, 0x7A, 0x16, 0x10, 0x3E, 0xC6,
+    0x9F, 0xB3, 0x21, 0xFD, 0x2F, 0x93, 0x70, 0xE1, 0xDC, 0x31, 0xD0, 0xBA, 0x76, 0x3F, 0xC4, 0x04,
+    0xA1, 0x34, 0x08, 0x9F, 0x35, 0x3D, 0xE0, 0x14, 0x4F, 0xE6, 0x55, 0x88, 0x38, 0xB4, 0x0D, 0x17,
+    0x97, 0x60, 0xA3, 0x65, 0xCC, 0x91, 0x89, 0x72, 0xB2, 0x14, 0x8B, 0xCB, 0x5C, 0x27, 0x57, 0xA0,
+    0x05, 0x2C, 0x15, 0xF2, 0xEF, 0x85, 0x7E, 0x8E, 0x73, 0x40, 0xF9, 0x44, 0xC2, 0xCE, 0x43, 0x02,
+    0x07, 0x67, 0xB8, 0x70, 0x55, 0x6E, 0xBE, 0x05, 0xDF, 0x17, 0xC5, 0xA8, 0xB3, 0x46, 0x8A, 0x0B,
+    0xA9, 0x3F, 0x44, 0x2A, 0x1B, 0x1E, 0xF8, 0xE2, 0xA8, 0x66, 0x1B, 0xF3, 0x02, 0xCE, 0x04, 0x15,
+    0xD5, 0x76, 0x16, 0xAE, 0x80, 0xD4, 0xD6, 0xF7, 0xC6, 0x45, 0xB0, 0x6D, 0xB5, 0xB8, 0xDD, 0x30,
+    0x89, 0x55, 0x3A, 0x52, 0xA4, 0x56, 0x9D, 0x3C, 0x60, 0x8F, 0x37, 0x8E, 0x3D, 0x4B, 0xDA, 0xA0,
+    0x67, 0x03, 0x43, 0x1B, 0x76, 0x11, 0x1B, 0x1D, 0xA2, 0x8E, 0xEB, 0x01, 0x36, 0xF1, 0x2A, 0x64,
+    0x90, 0xAC, 0x10, 0x10, 0x21, 0xBF, 0xB5, 0x02, 0x56, 0xB8, 0x24, 0xEA, 0xF0, 0x85, 0xB0, 0x0F,
+    0x86, 0x84, 0xC5, 0xD4, 0x6F, 0xD8, 0x0C, 0x0C, 0xB7, 0x70, 0x2B, 0xEE, 0x59, 0x64, 0xD8, 0x82,
+    0x8C, 0x6E, 0x9D, 0x3E, 0x69, 0xD3, 0x43, 0x8E, 0xA4, 0x5F, 0x71, 0x04, 0xC4, 0x25, 0x96, 0x98,
+    0x16, 0x35, 0xEF, 0xDE, 0x88, 0x89, 0xD9, 0x9B, 0xD8, 0xD8, 0x62, 0x93, 0x93, 0xF3, 0xC5, 0x3E,
+    0x9C, 0x74, 0x35, 0x0D, 0x69, 0x1A, 0xA6, 0x56, 0x4C, 0x29, 0x7A, 0xD7, 0xC9, 0x67, 0x7B, 0xFF,
+    0x23, 0x20, 0xBC, 0x12, 0xC5, 0x70, 0x38, 0xFE, 0xA8, 0x94, 0x18, 0xEB, 0x08, 0xCA, 0x5B, 0x3F,
+    0x7A, 0x64, 0x20, 0x20, 0xC0, 0xDD, 0x0A, 0x96, 0x1A, 0x57, 0x92, 0xC9, 0x62, 0xFC, 0x61, 0x4E,
+    0x09, 0x86, 0xB1, 0xD2, 0xC0, 0x47, 0xC5, 0xB0, 0x47, 0x2B, 0x12, 0xF6, 0x0A, 0x73, 0x55, 0xC0,
+    0x15, 0x18, 0x30, 0x1C, 0x78, 0x91, 0xC1, 0xA3, 0x53, 0xFE, 0xE9, 0x67, 0x0F, 0x92, 0x7E, 0x96,
+    0xE1, 0x2A, 0xB5, 0xDD, 0x1D, 0x18, 0xAB, 0xD4, 0xB9, 0xF2, 0x19, 0xDD, 0x5A, 0x7D, 0xBA, 0x2B,
+    0x6B, 0xBE, 0xCE, 0xF3, 0x1B, 0x95, 0xEA, 0x34, 0x1F, 0x41, 0x5A, 0x2E, 0xBD, 0x94, 0x26, 0x5C,
+    0x75, 0x2B, 0x3D, 0xC5, 0xC9, 0x76, 0xE9, 0x33, 0x1C, 0x6D, 0x99, 0x3E, 0x4E, 0xED, 0xD6, 0xAC,
+    0x1A, 0xD4, 0x3D, 0xB5, 0x9E, 0x9A, 0xAA, 0xDB, 0x79, 0xFD, 0xB6, 0x7C, 0xB2, 0xAA, 0xC8, 0x11,
+    0xAA, 0x62, 0x85, 0x11, 0x77, 0x62, 0x78, 0x54, 0x2B, 0x87, 0xDB, 0x34, 0x22, 0x04, 0x34, 0x7A,
+    0x8C, 0x16, 0xF2, 0x45, 0x7B, 0x04, 0xD0, 0x2E, 0xA4, 0xE0, 0x3F, 0xAF, 0x46, 0x5A, 0xD5, 0x38,
+    0x46, 0xAB, 0x83, 0x04, 0x48, 0xB4, 0x24, 0xCC, 0x25, 0x52, 0x5A, 0xA2, 0x7A, 0x4E, 0x89, 0x99,
+    0xF1, 0x8A, 0xF4, 0x4D, 0xF6, 0xCA, 0x2F, 0x44, 0xE8, 0xBE, 0x55, 0xCF, 0xA2, 0xE1, 0x23, 0x75,
+    0x40, 0x5B, 0x73, 0x6F, 0x20, 0xD6, 0x1C, 0x40, 0x10, 0x9D, 0x70, 0x2A, 0x83, 0xC9, 0x91, 0xEE,
+    0x4B, 0xAE, 0x00, 0x32, 0x04, 0x76, 0x85, 0x70, 0xF7, 0xB1, 0x02, 0x08, 0xAB, 0xF6, 0x4C, 0x83,
+    0xAE, 0x60, 0xCC, 0x50, 0xFD, 0x8C, 0x0D, 0x82, 0xA4, 0x44, 0xF0, 0x7B, 0xAC, 0xF8, 0x6D, 0xE2,
+    0x0E, 0x75, 0x40, 0x7A, 0x16, 0x62, 0xC3, 0x61, 0x29, 0xD5, 0x40, 0x90, 0x74, 0x7A, 0x0E, 0xEF,
+    0x73, 0x79, 0xB3, 0x1A, 0x88, 0x1C, 0xFC, 0x2A, 0xD1, 0x97, 0x12, 0xD1, 0x77, 0x5C, 0x9B, 0x89,
+    0x12, 0xA9, 0xC4, 0xD3, 0xC5, 0x39, 0xFD, 0x0A, 0x07, 0x3C, 0xD5, 0x75, 0x59, 0x8D, 0xE0, 0xA1,
+    0x19, 0xF0, 0x9D, 0xE2, 0xE0, 0x8C, 0x3B, 0x97, 0x60, 0xCF, 0x0E, 0xAF, 0xDF, 0xC3, 0x80, 0x6F,
+    0x9E, 0x2F, 0x36, 0x6C, 0x9C, 0x2F, 0xE6, 0x1F, 0x71, 0xBE, 0x58, 0x2D, 0xC9, 0x95, 0x7A, 0xBE,
+    0x58, 0x77, 0xF7, 0xE7, 0x8B, 0xC9, 0xB2, 0xD0, 0xF3, 0xC5, 0xE2, 0x4F, 0x70, 0xBE, 0x58, 0x29,
+    0x07, 0x8B, 0xF5, 0x0A, 0xD6, 0xD2, 0x43, 0xFA, 0x35, 0xBB, 0xF1, 0x33, 0x47, 0x81, 0xDF, 0x5F,
+    0x03, 0x5A, 0xA1, 0xD6, 0x01, 0xAD, 0x51, 0xCB, 0x8C, 0x69, 0x10, 0x9E, 0x24, 0x55, 0xFC, 0x7D,
+    0x31, 0xC9, 0xBE, 0x2B, 0x61, 0x19, 0x1A, 0x9C, 0xDE, 0xCF, 0xC9, 0x63, 0xE2, 0x22, 0xD6, 0x11,
+    0x67, 0x83, 0x6A, 0xB5, 0xA4, 0x2A, 0x21, 0xAA, 0x24, 0xCA, 0xC1, 0xDB, 0x12, 0x59, 0x35, 0xA8,
+    0x58, 0x6B, 0x90, 0xFB, 0xDC, 0x18, 0xAD, 0x56, 0x3B, 0x2B, 0x5A, 0xBB, 0xB0, 0x6B, 0x71, 0x0C,
+    0xC9, 0x6D, 0x6C, 0x79, 0xA3, 0x49, 0x2F, 0xD3, 0x93, 0x93, 0x94, 0x8F, 0xBC, 0x27, 0xAC, 0xC4,
+    0xDE, 0xE4, 0x9A, 0xFE, 0xC4, 0x3F, 0x39, 0x50, 0xB4, 0x62, 0x96, 0x7A, 0x95, 0x25, 0x3C, 0xAE,
+    0x36, 0xC9, 0x39, 0x1C, 0x33, 0xCC, 0x07, 0xF6, 0x22, 0x47, 0x62, 0xE6, 0x30, 0x14, 0x43, 0xCA,
+    0x7B, 0x50, 0xB1, 0x9C, 0x07, 0xE9, 0xC6, 0xCE, 0xCE, 0x0B, 0x5A, 0x42, 0x5B, 0x55, 0x9D, 0x09,
+    0x33, 0x6B, 0xD6, 0xD0, 0xB5, 0x74, 0x85, 0xE4, 0x08, 0x2C, 0x3E, 0x02, 0x8B, 0x8E, 0xC0, 0x12,
+    0xD1, 0xF8, 0xFA, 0x11, 0x3E, 0x67, 0x9F, 0x6B, 0x68, 0x2E, 0x93, 0xC0, 0x7E, 0x93, 0xDD, 0x45,
+    0xA7, 0x48, 0xD2, 0xA2, 0x25, 0x9C, 0x3E, 0x13, 0xD8, 0x67, 0x19, 0x3E, 0x4E, 0x7F, 0x3B, 0xED,
+    0xCB, 0xB1, 0x34, 0xE6, 0x7E, 0xC2, 0x08, 0x78, 0xE5, 0x72, 0x98, 0xBD, 0xB5, 0x17, 0xF7, 0xED,
+    0xC6, 0x4B, 0x67, 0x1B, 0x2F, 0x7C, 0x1C, 0x7C, 0x2A, 0x11, 0x2D, 0x97, 0xD7, 0x10, 0xE7, 0xC8,
+    0x22, 0x76, 0x28, 0xD2, 0x83, 0xE9, 0xB4, 0xBC, 0xD8, 0xA7, 0x84, 0xAD, 0xC0, 0xE9, 0x60, 0xBA,
+    0xEF, 0xAF, 0x1D, 0x4C, 0x47, 0xBB, 0xF9, 0x16, 0xB6, 0xCF, 0x13, 0x6F, 0x04, 0x63, 0x6D, 0xE9,
+    0x7B, 0x83, 0xE1, 0x58, 0x64, 0x07, 0x0B, 0x66, 0x31, 0xA6, 0xC2, 0x7A, 0xA3, 0x7E, 0xA6, 0xF0,
+    0xD8, 0x03, 0xFA, 0x36, 0xE0, 0x32, 0x9D, 0xE2, 0x80, 0x22, 0x89, 0xC4, 0x89, 0x70, 0x56, 0x52,
+    0xCD, 0x71, 0x4D, 0x1A, 0xAB, 0xBD, 0xB8, 0x33, 0x80, 0xF1, 0x5E, 0x8C, 0x0A, 0x38, 0xE7, 0x8B,
+    0xB8, 0x43, 0x03, 0xC6, 0xA3, 0x2A, 0xD1, 0x6D, 0xC0, 0x42, 0x0D, 0x8B, 0xD6, 0x95, 0x1C, 0x12,
+    0x0B, 0x8C, 0x24, 0x70, 0x68, 0x30, 0xDF, 0x86, 0xC9, 0x26, 0x38, 0x0A, 0xF8, 0xD5, 0x7D, 0x38,
+    0x7B, 0xF0, 0x71, 0x85, 0xCF, 0xE8, 0x99, 0x83, 0x1B, 0xB0, 0x7D, 0x46, 0xCF, 0x1E, 0x7C, 0x46,
+    0xA7, 0xF8, 0xAD, 0x63, 0xCE, 0x1E, 0xBC, 0xA0, 0x66, 0x82, 0x67, 0xEE, 0x00, 0x7F, 0xFF, 0x6E,
+    0xCE, 0x1E, 0x74, 0x7A, 0xCB, 0xDD, 0x94, 0xCA, 0x7E, 0xFB, 0x15, 0x6E, 0xAF, 0x5D, 0x63, 0x73,
+    0x83, 0xB4, 0x7F, 0xCF, 0xE5, 0x56, 0xA4, 0x83, 0x6B, 0xA5, 0xB2, 0xFD, 0x6B, 0x9B, 0xED, 0xD1,
+    0xA5, 0xB2, 0xB5, 0x8C, 0xFF, 0x91, 0x65, 0xA2, 0xBC, 0x7B, 0x00, 0x3F, 0xB7, 0x30, 0x6A, 0xDB,
+    0xF1, 0xE4, 0x29, 0x3D, 0xE7, 0x69, 0x23, 0xDC, 0x40, 0xE2, 0x1A, 0x5C, 0xD4, 0xC1, 0xDD, 0x00,
+    0x89, 0x48, 0x80, 0x08, 0x15, 0xC2, 0x5C, 0x77, 0x8D, 0x78, 0x85, 0x82, 0x75, 0x9B, 0x7F, 0x7C,
+    0x94, 0xCD, 0xFF, 0x38, 0xF0, 0xC4, 0x69, 0x06, 0x3F, 0x16, 0x77, 0xC9, 0x4F, 0x55, 0x3D, 0xBB,
+    0x0C, 0x73, 0xCE, 0x4A, 0x8E, 0xAF, 0x6B, 0xC4, 0xD4, 0xDB, 0x2C, 0x9C, 0xD7, 0x64, 0x06, 0xAA,
+    0x4F, 0x08, 0x6A, 0xB1, 0xD8, 0xE1, 0x28, 0x06, 0x22, 0x59, 0xCF, 0x0A, 0xC5, 0x7A, 0xD6, 0xDA,
+    0xF5, 0x4C, 0x22, 0x57, 0x96, 0x47, 0x83, 0x56, 0xDE, 0x87, 0xC2, 0xC9, 0x69, 0xD2, 0x5A, 0xFB,
+    0x00, 0x9E, 0x52, 0xA9, 0xF1, 0x21, 0xC5, 0x52, 0x6C, 0xB9, 0x25, 0xDB, 0xB5, 0x4A, 0x9E, 0x85,
+    0x1D, 0xAA, 0x2E, 0xA4, 0xDB, 0x4D, 0xA1, 0x6F, 0x91, 0xBD, 0x22, 0x4B, 0x3D, 0xD1, 0x62, 0x2F,
+    0x4B, 0x57, 0xF4, 0xE5, 0xCB, 0x5C, 0x58, 0x62, 0xE7, 0xF4, 0xEC, 0x98, 0xCC, 0x6A, 0x0D, 0x2E,
+    0xEC, 0x7A, 0x25, 0x24, 0xE3, 0xB2, 0x8B, 0xA0, 0xFF, 0xA6, 0x92, 0xDC, 0xE8, 0x97, 0x42, 0xBE,
+    0x62, 0x88, 0x57, 0xC3, 0x9B, 0x52, 0x0D, 0x5F, 0x05, 0x9C, 0xA5, 0x33, 0x25, 0xA9, 0x1D, 0xE9,
+    0x4B, 0xAF, 0x29, 0x99, 0xCB, 0x45, 0x92, 0x43, 0xB9, 0x87, 0x96, 0x34, 0xD9, 0x27, 0x0C, 0xD3,
+    0x19, 0x43, 0xAF, 0xC0, 0xCE, 0xFE, 0x02, 0x15, 0x09, 0x72, 0x7A, 0x81, 0x9C, 0xF3, 0xC4, 0xAF,
+    0x31, 0x28, 0xA5, 0xFB, 0xE5, 0x52, 0x2D, 0xA9, 0x5F, 0xB6, 0xDF, 0xDF, 0xD9, 0x49, 0xB5, 0xAE,
+    0xED, 0x04, 0xCA, 0x79, 0xB5, 0x01, 0x5E, 0x77, 0xA2, 0xB4, 0x27, 0x60, 0x84, 0x7F, 0x2A, 0x61,
+    0x00, 0xAE, 0xD8, 0x48, 0x35, 0xCB, 0x4F, 0x77, 0x3F, 0x6A, 0xE5, 0x70, 0xE4, 0xCA, 0xCD, 0xC0,
+    0x12, 0xC5, 0x5F, 0x66, 0x33, 0xB0, 0x12, 0x8E, 0x7E, 0xC4, 0x0C, 0x2C, 0xC6, 0x19, 0xA8, 0x3F,
+    0xE3, 0x19, 0x40, 0x45, 0x18, 0xBA, 0xE8, 0x98, 0x19, 0x70, 0xC6, 0xA9, 0xDC, 0x8C, 0xC2, 0xF3,
+    0x2C, 0x7B, 0x37, 0x72, 0x09, 0xB8, 0xD5, 0xD1, 0x3E, 0x80, 0x0D, 0x5F, 0xC0, 0x7D, 0x9C, 0xB9,
+    0x93, 0x77, 0x37, 0x73, 0xBF, 0x31, 0x9F, 0xB9, 0xFF, 0x31, 0xC8, 0xBB, 0xCC, 0x67, 0x2E, 0x1E,
+    0x9C, 0xF1, 0x09, 0xFD, 0x3C, 0xB2, 0xAC, 0xE1, 0x3A, 0xA8, 0x25, 0x88, 0x4F, 0x0E, 0x0D, 0x6C,
+    0x35, 0xB2, 0xF7, 0xFE, 0xFD, 0x93, 0x68, 0x60, 0x44, 0x02, 0x97, 0x4A, 0x55, 0xB7, 0x5D, 0x31,
+    0x0B, 0x62, 0xE0, 0x6E, 0xA4, 0x8B, 0x3C, 0xD4, 0xD9, 0xCC, 0xCA, 0xB8, 0x71, 0xB1, 0xE5, 0x2E,
+    0x60, 0x38, 0x98, 0x42, 0xF4, 0x37, 0x2B, 0x91, 0x26, 0x1C, 0xC2, 0xC8, 0x01, 0xC6, 0x75, 0x82,
+    0xC3, 0x29, 0x18, 0x3B, 0xC9, 0xF4, 0xA5, 0x37, 0xBB, 0x7C, 0xC4, 0x66, 0x89, 0xFC, 0xF7, 0x16,
+    0xE6, 0x1B, 0x2E, 0xBA, 0x55, 0x22, 0x32, 0x83, 0x4F, 0xF3, 0x4B, 0x11, 0x4E, 0x4B, 0x58, 0x2F,
+    0xDA, 0x46, 0xD1, 0x4A, 0xDD, 0x21, 0x3E, 0x3D, 0x34, 0x10, 0xE5, 0xA7, 0x2C, 0x5A, 0x59, 0x02,
+    0x61, 0x5D, 0xB4, 0x62, 0x62, 0x88, 0x6E, 0x14, 0x37, 0xC4, 0x65, 0x94, 0xB8, 0x13, 0xC2, 0x44,
+    0x52, 0x17, 0xB3, 0xD8, 0x8D, 0xE2, 0xA0, 0xE8, 0x34, 0xB1, 0xB0, 0x4D, 0x24, 0x16, 0x89, 0x34,
+    0x07, 0xE8, 0x46, 0x24, 0x5F, 0x16, 0x6D, 0x28, 0xB1, 0x48, 0xA9, 0x9E, 0x2D, 0x1A, 0xAB, 0xCD,
+    0x12, 0xBA, 0x07, 0x9F, 0xCE, 0xD7, 0x40, 0xA6, 0xE2, 0x13, 0xFB, 0x56, 0x58, 0xD9, 0x05, 0x1C,
+    0xD3, 0xBE, 0x38, 0x09, 0x92, 0x01, 0x9A, 0x18, 0x1F, 0xE4, 0xC9, 0xF2, 0x1D, 0x1B, 0x5C, 0x68,
+    0x9D, 0x75, 0x88, 0x11, 0xE5, 0xCA, 0x2F, 0x4C, 0xBD, 0x2F, 0x69, 0xFC, 0x50, 0x58, 0xFB, 0x62,
+    0xE7, 0x8E, 0x1A, 0x4D, 0x19, 0x8C, 0x5A, 0xB5, 0xF0, 0x2C, 0xED, 0x98, 0x44, 0xE9, 0x1C, 0x21,
+    0xDE, 0x31, 0x21, 0xFA, 0x0F, 0xE3, 0xC1, 0x6A, 0x9F, 0x71, 0x1C, 0x4B, 0x2D, 0x51, 0x85, 0x83,
+    0xFA, 0xE6, 0x4B, 0x57, 0x1E, 0xD0, 0x73, 0xEE, 0x8D, 0x92, 0x75, 0x4D, 0x4F, 0xBC, 0x16, 0x33,
+    0xB0, 0x94, 0xF4, 0xBB, 0xA5, 0xD4, 0x53, 0x42, 0x54, 0x61, 0xAD, 0x51, 0x85, 0xF9, 0x04, 0x26,
+    0xDB, 0x85, 0x44, 0x15, 0x1A, 0x17, 0x55, 0x88, 0x72, 0xF6, 0x12, 0x55, 0x58, 0x68, 0x54, 0xE1,
+    0xC1, 0x6D, 0xA3, 0x0A, 0x3D, 0x1C, 0x79, 0x10, 0xAF, 0x10, 0xD3, 0xD2, 0x21, 0xA4, 0xA5, 0x43,
+    0x44, 0xCB, 0xD7, 0xC5, 0x81, 0x2F, 0xF1, 0x2C, 0xE2, 0xBE, 0xA7, 0x16, 0x9E, 0xF9, 0x5B, 0x43,
+    0x3A, 0x85, 0x57, 0x5F, 0xD6, 0x80, 0x68, 0x71, 0x2C, 0x48, 0x88, 0xF1, 0xEC, 0x94, 0xA5, 0xB8,
+    0x43, 0xC4, 0x6A, 0xCF, 0x03, 0x1C, 0xF5, 0xFC, 0x14, 0xD7, 0x1A, 0x0D, 0x5C, 0x02, 0x6B, 0xF0,
+    0x72, 0x64, 0xB0, 0x57, 0x4C, 0x64, 0x23, 0x74, 0x3C, 0x92, 0xA0, 0x94, 0xE1, 0x1C, 0x12, 0xBE,
+    0xB1, 0x04, 0x78, 0xAB, 0x8A, 0xD6, 0xD7, 0x19, 0x3D, 0x39, 0x23, 0x10, 0xC3, 0x3B, 0xE7, 0xD8,
+    0x0F, 0x88, 0xDE, 0x39, 0x0C, 0x16, 0xEB, 0xA0, 0x99, 0x03, 0xFF, 0xCE, 0x20, 0xC0, 0xC1, 0xB8,
+    0x9C, 0xAB, 0xC6, 0x80, 0x7A, 0x38, 0x03, 0x44, 0x2D, 0x18, 0x64, 0x00, 0x6F, 0x5A, 0xD4, 0x34,
+    0x60, 0xB1, 0x24, 0x42, 0x21, 0x41, 0xB6, 0x10, 0xC8, 0xE9, 0x7A, 0x03, 0x82, 0xD0, 0xEC, 0xB0,
+    0x35, 0xB7, 0x55, 0x74, 0xF3, 0xFC, 0xDC, 0xC5, 0x6A, 0x1E, 0x8C, 0xA4, 0xA5, 0x0C, 0x94, 0xD8,
+    0xA9, 0xBC, 0xFF, 0xAB, 0x3D, 0xBA, 0x4D, 0xB2, 0x72, 0xDB, 0x89, 0x43, 0x08, 0xF1, 0x93, 0x42,
+    0x0B, 0x42, 0x9F, 0xC5, 0x37, 0x9E, 0x3C, 0xE4, 0x91, 0x00, 0x08, 0xB7, 0x12, 0x35, 0x0F, 0x85,
+    0xDD, 0x26, 0x38, 0xD7, 0x49, 0xC0, 0x7B, 0x3D, 0xD1, 0xD0, 0x99, 0x5D, 0x48, 0x95, 0x0A, 0x1C,
+    0x3E, 0x8B, 0x34, 0x53, 0xAD, 0x9E, 0xEF, 0x8D, 0x34, 0x2C, 0x37, 0x7A, 0x44, 0x2B, 0x26, 0x7D,
+    0x67, 0xDD, 0x35, 0x18, 0x4A, 0x39, 0xCD, 0xA5, 0x44, 0x06, 0x18, 0x8D, 0x0C, 0xC8, 0xC4, 0x21,
+    0x7A, 0x3C, 0xD8, 0xDF, 0x41, 0xF0, 0x80, 0xAB, 0xEA, 0xB9, 0x67, 0xEF, 0xF4, 0x05, 0x05, 0xB8,
+    0x35, 0xA2, 0xA6, 0x5A, 0x89, 0x26, 0x1B, 0xC1, 0x18, 0x0F, 0x39, 0x81, 0x06, 0xA9, 0x67, 0x4C,
+    0x49, 0xFC, 0x06, 0x56, 0xF6, 0x60, 0x25, 0x95, 0xEA, 0x7A, 0x35, 0xCC, 0xA8, 0x0B, 0x6F, 0x56,
+    0xB3, 0x68, 0x73, 0x01, 0x2C, 0xBF, 0x50, 0xA1, 0x20, 0x9A, 0x8D, 0x33, 0xDA, 0x0B, 0xE2, 0x0D,
+    0xB3, 0x8A, 0x0B, 0xE6, 0x55, 0xA9, 0xD1, 0x39, 0x4A, 0xA6, 0x62, 0x19, 0x0F, 0xC2, 0xA9, 0x82,
+    0xCE, 0xAA, 0x31, 0xCF, 0xAC, 0x8A, 0xD7, 0xF2, 0x8B, 0x8A, 0x79, 0x56, 0x95, 0x2B, 0xD2, 0x31,
+    0xE6, 0x17, 0x3D, 0x08, 0xA6, 0xA3, 0x8F, 0xC5, 0x74, 0xF4, 0x83, 0x4F, 0x69, 0x3A, 0xF2, 0xD5,
+    0x92, 0x36, 0xC1, 0x74, 0x6D, 0xC2, 0x94, 0x26, 0x3B, 0xC1, 0x78, 0x82, 0xF5, 0x3A, 0x5C, 0xD4,
+    0x6B, 0x29, 0x64, 0xBF, 0x72, 0xD3, 0x51, 0x39, 0x03, 0x6A, 0x3F, 0x4A, 0xE7, 0xF6, 0xC1, 0x8B,
+    0x6B, 0x96, 0xF3, 0x0B, 0x87, 0x3C, 0x77, 0x20, 0x56, 0x3E, 0x64, 0xE5, 0x1E, 0xE3, 0x4D, 0x7D,
+    0x62, 0x66, 0x83, 0xC3, 0x45, 0xAC, 0x24, 0xD7, 0x7A, 0xE2, 0x02, 0xA5, 0x1E, 0xFF, 0x92, 0xE3,
+    0x33, 0x0B, 0x20, 0xA5, 0x39, 0xC5, 0xC8, 0x0D, 0x1A, 0xDE, 0xF3, 0x8C, 0x70, 0x79, 0xCF, 0x2B,
+    0x40, 0xD8, 0xF3, 0x01, 0x84, 0x9D, 0x1F, 0x40, 0x92, 0xD5, 0x42, 0x10, 0x76, 0x81, 0x00, 0x21,
+    0x51, 0xA1, 0x02, 0x12, 0xDA, 0x25, 0xCA, 0x53, 0xB6, 0xEC, 0x0B, 0x01, 0x12, 0xD8, 0x73, 0x29,
+    0x10, 0xDF, 0x5E, 0x47, 0x8C, 0x53, 0xCB, 0x19, 0x87, 0x40, 0x58, 0x92, 0x07, 0xC2, 0xC4, 0x53,
+    0x10, 0x3E, 0x56, 0x03, 0x08, 0x1F, 0xB1, 0xD1, 0x30, 0xEF, 0x4A, 0x20, 0xD2, 0x07, 0xC4, 0xE0,
+    0x6A, 0x04, 0xB1, 0xD9, 0x2A, 0xAA, 0x22, 0x9C, 0x3B, 0x4F, 0x92, 0x4E, 0x34, 0x16, 0x3B, 0x99,
+    0xF2, 0x3D, 0xDD, 0x54, 0x9B, 0xA5, 0x9B, 0x5B, 0xA7, 0x89, 0x4C, 0xE9, 0xBA, 0x63, 0x15, 0x94,
+    0x24, 0x3F, 0x54, 0x58, 0xE8, 0x01, 0x3D, 0xE6, 0x74, 0xD8, 0x38, 0xE6, 0xF4, 0x8A, 0x59, 0xF3,
+    0xE5, 0xAA, 0x2C, 0x32, 0x2E, 0xFC, 0xC0, 0x65, 0x75, 0x37, 0xEB, 0xC5, 0x95, 0xE2, 0xEA, 0xF3,
+    0x55, 0x09, 0x7F, 0x53, 0x13, 0x8D, 0x7B, 0x19, 0x6A, 0x6F, 0x4A, 0x9A, 0x15, 0x55, 0xCB, 0x4A,
+    0x2D, 0x66, 0x71, 0xC9, 0x8F, 0x69, 0x66, 0xF3, 0x5A, 0x5B, 0xA5, 0x99, 0xD9, 0xBA, 0xF4, 0x60,
+    0xCE, 0xD1, 0x51, 0xE5, 0xB2, 0xC5, 0x4D, 0xA8, 0x26, 0x82, 0x38, 0x52, 0x77, 0x78, 0x28, 0x03,
+    0x75, 0x51, 0x7D, 0x80, 0x57, 0xB4, 0xDA, 0x4A, 0x27, 0x0A, 0x38, 0x2F, 0x47, 0x58, 0x0A, 0x1B,
+    0xB9, 0xB1, 0xB2, 0x49, 0x36, 0xCC, 0xE2, 0xC6, 0x61, 0x29, 0xA9, 0xC6, 0x91, 0x2A, 0x32, 0xB1,
+    0x96, 0xAF, 0x4E, 0x34, 0x02, 0xE2, 0xA2, 0x46, 0xD8, 0xF7, 0xEA, 0x64, 0xEC, 0x24, 0x61, 0xC8,
+    0x93, 0xF2, 0x81, 0x48, 0xE6, 0x64, 0xA6, 0xB4, 0xEC, 0x8C, 0x8E, 0x07, 0x18, 0xD3, 0x08, 0x75,
+    0x58, 0x7A, 0x56, 0x55, 0x17, 0x03, 0xCB, 0xA2, 0x28, 0x89, 0xAC, 0xA5, 0xE0, 0xF4, 0xB0, 0x9E,
+    0xF9, 0x50, 0x6C, 0xED, 0x89, 0x95, 0xA3, 0xE7, 0xFB, 0x5E, 0x47, 0xDD, 0x71, 0xA8, 0x1A, 0x3D,
+    0x77, 0x3B, 0x90, 0x5A, 0xDB, 0xAF, 0x9B, 0xB5, 0xAC, 0x1F, 0x6A, 0xB9, 0x2E, 0x02, 0xAC, 0xEB,
+    0x2C, 0xC9, 0x5E, 0xB2, 0x8D, 0x04, 0xC9, 0x48, 0xC8, 0x0C, 0x3B, 0x19, 0xC7, 0x96, 0x0B, 0x93,
+    0xF3, 0xDF, 0x59, 0xBE, 0x88, 0x87, 0x73, 0xC8, 0x84, 0x20, 0x95, 0x3B, 0x45, 0xF6, 0x4F, 0xEA,
+    0xCE, 0xE3, 0x7E, 0x64, 0x4C, 0xDE, 0x15, 0x06, 0x63, 0x5F, 0xB2, 0x0E, 0xA6, 0x12, 0x75, 0x25,
+    0xBF, 0x7F, 0xCD, 0x7C, 0xEB, 0xE8, 0x12, 0x35, 0x5F, 0xCC, 0xB9, 0x7C, 0x44, 0x07, 0xC5, 0x8E,
+    0x43, 0xA1, 0x2D, 0x86, 0xE3, 0x6B, 0x63, 0xC6, 0xCB, 0x03, 0x35, 0x97, 0xC6, 0x4E, 0x96, 0x0D,
+    0xA7, 0xAD, 0x9B, 0x73, 0x76, 0xD8, 0xBB, 0x0C, 0x2C, 0xDA, 0xED, 0x94, 0xA4, 0x24, 0xAC, 0x9D,
+    0x02, 0xBB, 0x30, 0x62, 0x1D, 0x63, 0xD0, 0x9D, 0xDB, 0xD8, 0x31, 0xDC, 0xC6, 0x61, 0x41, 0xE5,
+    0xB0, 0xB0, 0x74, 0x58, 0x9C, 0xBA, 0x78, 0xBD, 0xC4, 0x15, 0xCC, 0xE4, 0x48, 0x19, 0xC5, 0x56,
+    0x2E, 0x9A, 0x4F, 0x4A, 0xAD, 0x39, 0xBE, 0xDE, 0xE9, 0xA2, 0x70, 0x58, 0xF4, 0xFD, 0x1D, 0x5D,
+    0x18, 0xC9, 0x18, 0xF5, 0x72, 0x51, 0xB0, 0x18, 0xDD, 0x41, 0xA1, 0x3A, 0x14, 0x11, 0x11, 0x8C,
+    0x67, 0x2E, 0x41, 0xD5, 0x05, 0x36, 0x9A, 0x65, 0xFD, 0xCE, 0x59, 0x9E, 0xB5, 0x4A, 0x0A, 0x73,
+    0xCF, 0x30, 0xB3, 0xF5, 0x46, 0xEA, 0xBD, 0x01, 0x35, 0x75, 0x15, 0x43, 0x8F, 0xB8, 0x8E, 0x70,
+    0x1F, 0x9E, 0x17, 0x4B, 0x6B, 0x8C, 0x67, 0x86, 0xEB, 0x28, 0x07, 0x88, 0xA1, 0xA6, 0x49, 0x7A,
+    0x1D, 0xE6, 0x1B, 0xAD, 0xC4, 0x38, 0x83, 0x4F, 0x88, 0x9D, 0x73, 0xA1, 0xF6, 0x4E, 0x9E, 0xA7,
+    0x1B, 0x3B, 0x3B, 0xA7, 0x65, 0xA6, 0x8C, 0xCE, 0x15, 0xDC, 0xFB, 0x56, 0x8F, 0xEC, 0xE2, 0x71,
+    0x4F, 0x79, 0xC6, 0x48, 0x7B, 0xA8, 0x78, 0xCE, 0xF8, 0x40, 0x60, 0x9A, 0xB5, 0x7F, 0xE0, 0x60,
+    0xA5, 0x10, 0xE7, 0xF8, 0xF0, 0xCC, 0x1D, 0x08, 0x49, 0xE0, 0x32, 0x53, 0x3B, 0xA3, 0x99, 0x4D,
+    0x4C, 0x6C, 0x62, 0x5E, 0x13, 0xD3, 0x9A, 0x98, 0xD5, 0xD4, 0xA4, 0xB6, 0x35, 0x2F, 0x39, 0xA0,
+    0xB1, 0xBF, 0x4C, 0xF5, 0x3F, 0xDA, 0x2B, 0x50, 0x36, 0x88, 0x43, 0x01, 0x2B, 0xA4, 0xA2, 0xBA,
+    0x76, 0x59, 0x1E, 0x9F, 0x9D, 0xED, 0x72, 0xC9, 0xDB, 0xB1, 0xAD, 0xCD, 0x9D, 0x73, 0xBA, 0x2B,
+    0x70, 0xF9, 0x8A, 0xF8, 0x38, 0x5A, 0x6C, 0x50, 0x9F, 0x4F, 0xFF, 0xDB, 0x39, 0xD7, 0xC8, 0x18,
+    0xA9, 0x65, 0x18, 0xF4, 0x90, 0xC9, 0x21, 0xA8, 0xA1, 0x10, 0x43, 0x4C, 0x8D, 0x90, 0xC2, 0x91,
+    0x12, 0x7A, 0xDF, 0x4E, 0xF5, 0x6F, 0x16, 0xA7, 0x46, 0x3F, 0x8B, 0xE8, 0xB0, 0xA2, 0xE1, 0xEA,
+    0x43, 0xBC, 0x02, 0x93, 0x15, 0x8E, 0xC4, 0xC3, 0xC9, 0xBC, 0x6C, 0xC5, 0xD3, 0x86, 0x4F, 0xC3,
+    0x3B, 0x2A, 0x3A, 0x8C, 0x95, 0x69, 0x0E, 0xFC, 0xE7, 0x3E, 0x1D, 0xEC, 0xD6, 0xE2, 0x1C, 0xD2,
+    0xD3, 0xF0, 0x46, 0x81, 0x60, 0x2D, 0x53, 0x8D, 0x17, 0x63, 0xCC, 0x21, 0xBC, 0x1C, 0xA8, 0xB0,
+    0xB4, 0xE5, 0x63, 0x53, 0x0E, 0x58, 0xB3, 0x19, 0x3D, 0x37, 0x8F, 0x9B, 0x4B, 0xBA, 0x1D, 0xFA,
+    0xC9, 0x3A, 0x31, 0x81, 0x68, 0x8B, 0x43, 0x7C, 0xA4, 0x65, 0x0A, 0x25, 0xB5, 0xED, 0xB2, 0x15,
+    0x87, 0x7F, 0x48, 0x49, 0x3B, 0x2B, 0x87, 0x1C, 0x56, 0xE1, 0x20, 0xF5, 0xEC, 0xD8, 0x5D, 0xCE,
+    0xE1, 0x8F, 0x9B, 0x55, 0xE2, 0xD0, 0xD9, 0xED, 0x37, 0x30, 0x45, 0xAD, 0x44, 0x68, 0x46, 0x1F,
+    0xEE, 0xDA, 0x34, 0x66, 0x0A, 0xF6, 0xDB, 0x1A, 0x68, 0x85, 0x85, 0x3A, 0x3B, 0x0E, 0x70, 0xF5,
+    0xE4, 0xDE, 0x5E, 0xC1, 0x36, 0x24, 0xAB, 0x0D, 0x1F, 0x42, 0xC6, 0x6A, 0x25, 0x1F, 0x2B, 0x58,
+    0x34, 0x9C, 0xA3, 0x58, 0x73, 0x8C, 0x23, 0x3D, 0x37, 0x40, 0xE5, 0xF4, 0x9E, 0x63, 0x40, 0x6B,
+    0xAD, 0x15, 0xF5, 0x08, 0xE8, 0x5E, 0x96, 0x16, 0x08, 0xB4, 0x07, 0xEF, 0x42, 0x9B, 0x95, 0x4C,
+    0xFB, 0x9E, 0xD0, 0x1A, 0x19, 0xB3, 0xF2, 0x28, 0x0F, 0xC9, 0x28, 0x3E, 0x06, 0xCD, 0x89, 0xF4,
+    0x08, 0x7F, 0x08, 0x38, 0x5D, 0x8C, 0x9A, 0xC5, 0xC0, 0x6A, 0xC5, 0x6B, 0xE6, 0xB5, 0x35, 0xCF,
+    0xC9, 0xE7, 0x3A, 0xDA, 0x5A, 0x81, 0x49, 0x4D, 0x4B, 0x2E, 0xA1, 0x21, 0x69, 0x92, 0x7A, 0x13,
+    0x8B, 0xEB, 0x44, 0xC5, 0xDD, 0xED, 0xF4, 0xD1, 0xE3, 0xAA, 0xB3, 0xFC, 0xAB, 0x69, 0x7D, 0xDD,
+    0xB4, 0x6E, 0x52, 0x2D, 0x64, 0xE3, 0xAF, 0xD4, 0xB1, 0xB2, 0xEC, 0xC2, 0x6E, 0x1D, 0x09, 0x3A,
+    0xAD, 0x97, 0xE9, 0xBD, 0xEA, 0x5D, 0xBA, 0x7D, 0x0D, 0x9B, 0x87, 0xD1, 0xB4, 0xEE, 0x36, 0x74,
+    0xCE, 0x0A, 0xA7, 0x6C, 0xE8, 0xA2, 0x44, 0x81, 0xFE, 0x63, 0x36, 0xF4, 0x2E, 0x6F, 0xE8, 0x25,
+    0x36, 0x74, 0x6C, 0xCF, 0x72, 0x8A, 0x70, 0xCB, 0x41, 0x60, 0x19, 0x32, 0xEF, 0x33, 0x14, 0x51,
+    0x4C, 0x10, 0xE9, 0xBF, 0x9D, 0x8B, 0x7C, 0x35, 0x19, 0x8E, 0xD5, 0x44, 0x25, 0x65, 0xB1, 0x02,
+    0xBC, 0x4E, 0x20, 0xD9, 0x7D, 0x47, 0x24, 0xF0, 0x8A, 0xE5, 0x3C, 0xB0, 0xF9, 0x36, 0xAC, 0x00,
+    0x09, 0xF0, 0x02, 0xA5, 0xF8, 0x2C, 0x8A, 0xF4, 0x15, 0x15, 0x3F, 0x31, 0x39, 0xE0, 0x99, 0x8C,
+    0x5C, 0x02, 0xEF, 0x30, 0x5A, 0xEC, 0x78, 0x6A, 0x83, 0x96, 0x96, 0x2F, 0xCD, 0x24, 0xC9, 0x42,
+    0xDC, 0x04, 0x1D, 0xAD, 0x6D, 0xEF, 0xD5, 0xC5, 0xDA, 0x34, 0x9E, 0x38, 0x63, 0x24, 0xB3, 0x36,
+    0x1E, 0x38, 0xF9, 0x06, 0xB1, 0xE6, 0x7C, 0x06, 0x74, 0xC6, 0x25, 0x0C, 0x4F, 0x8A, 0xB1, 0x50,
+    0x2A, 0xF4, 0xD3, 0x0B, 0x9C, 0xE0, 0x59, 0x49, 0x50, 0xC1, 0x0C, 0x3D, 0x86, 0xBF, 0x5A, 0xB3,
+    0x77, 0xF3, 0xAF, 0xA0, 0x92, 0x38, 0x32, 0x8C, 0x53, 0xFA, 0x1B, 0xC7, 0x77, 0x49, 0xC2, 0xC1,
+    0x12, 0xC6, 0x1F, 0x3E, 0x27, 0x68, 0x69, 0xF5, 0xF7, 0xB1, 0x0D, 0xC5, 0x42, 0xFC, 0x21, 0x6B,
+    0x6A, 0x21, 0x9F, 0xA6, 0xC2, 0x36, 0xAB, 0xB7, 0xD8, 0x62, 0x25, 0x1B, 0x4C, 0x16, 0x86, 0x84,
+    0xC1, 0xBE, 0x25, 0x89, 0xD8, 0x29, 0x16, 0xC6, 0x80, 0x87, 0x4A, 0x56, 0x82, 0xC4, 0x74, 0x46,
+    0x76, 0x2A, 0x60, 0xE0, 0xAF, 0xA7, 0x3F, 0x67, 0x48, 0x7F, 0x2E, 0x4A, 0x94, 0xE3, 0x43, 0xFA,
+    0x73, 0xB6, 0x91, 0xFE, 0x5C, 0x8D, 0xE9, 0xCF, 0x3B, 0x93, 0x9B, 0xDE, 0x72, 0xA8, 0x80, 0xE5,
+    0x20, 0x49, 0x6D, 0x9A, 0x25, 0x0B, 0x10, 0x4B, 0x2E, 0x04, 0x18, 0xA6, 0xB4, 0x8A, 0xB7, 0x44,
+    0xF1, 0x84, 0xA6, 0x8D, 0x2D, 0xFF, 0x96, 0xB3, 0xA2, 0x21, 0xD0, 0x62, 0x69, 0xA5, 0x30, 0x5C,
+    0xED, 0x68, 0xFB, 0x2C, 0x40, 0xBB, 0xDF, 0x68, 0xE8, 0xB5, 0xA3, 0x8E, 0x0B, 0x31, 0x72, 0x93,
+    0xB4, 0x5C, 0xFE, 0xAF, 0x66, 0x57, 0x44, 0x1E, 0x28, 0x4D, 0xE4, 0x59, 0x23, 0x62, 0xEA, 0xA2,
+    0xBD, 0xD6, 0xE0, 0x89, 0x9D, 0x33, 0x5F, 0xDC, 0x5A, 0x4B, 0xE3, 0x7B, 0x18, 0x6F, 0x6F, 0xEF,
+    0x55, 0x71, 0x0C, 0x35, 0x13, 0x30, 0xEC, 0x5A, 0x7F, 0xA0, 0xCB, 0x22, 0x3D, 0xA2, 0xBA, 0x92,
+    0x48, 0x0D, 0x8E, 0xCC, 0x38, 0xC9, 0x81, 0x65, 0x59, 0x51, 0x24, 0x0F, 0x13, 0x9B, 0x2F, 0xF4,
+    0x6C, 0x6A, 0x19, 0x35, 0xE5, 0x3D, 0x81, 0x30, 0x9C, 0xA0, 0x07, 0xF0, 0x85, 0xEB, 0x10, 0xCF,
+    0x79, 0xF5, 0x58, 0x66, 0xF3, 0x20, 0x4D, 0x71, 0x3A, 0x7F, 0x15, 0x50, 0xDC, 0x91, 0x85, 0x06,
+    0xEE, 0x55, 0x16, 0x87, 0xD9, 0xE7, 0xD1, 0x87, 0x3E, 0x94, 0x47, 0x1F, 0xFA, 0xB0, 0x5C, 0x3B,
+    0xF4, 0xC1, 0x9F, 0x1D, 0xFA, 0x00, 0x20, 0x07, 0x45, 0x55, 0xB7, 0x03, 0x1B, 0x87, 0x3E, 0xAC,
+    0xEE, 0xCB, 0xA1, 0x0F, 0x73, 0x89, 0xD8, 0xCE, 0x24, 0x62, 0x59, 0xD5, 0xBF, 0x75, 0x68, 0x4D,
+    0x7B, 0xD3, 0x21, 0x11, 0x1E, 0x14, 0x0F, 0xD4, 0x21, 0xD7, 0xB3, 0x21, 0x50, 0x7D, 0x5C, 0xDF,
+    0x5B, 0xCA, 0x84, 0xBB, 0x12, 0xE2, 0xB7, 0x6D, 0xC7, 0x23, 0xD4, 0x07, 0x2D, 0x23, 0x2E, 0x1F,
+    0x1D, 0x79, 0x48, 0xC4, 0x1D, 0x87, 0xBF, 0xFA, 0x54, 0xC3, 0x8F, 0x9F, 0x11, 0xDC, 0x6E, 0xF8,
+    0xD7, 0xCF, 0xDC, 0xE8, 0x3F, 0xE1, 0xF0, 0x1F, 0x35, 0x9C, 0xD9, 0x1D, 0x87, 0x73, 0xD8, 0xBB,
+    0x6C, 0x45, 0x28, 0x75, 0xED, 0xA7, 0x1A, 0xCE, 0xFB, 0xBA, 0xFC, 0x1F, 0xAE, 0xF1, 0xBF, 0x1F,
+    0xCB, 0xFF, 0xF3, 0x9E, 0xAF, 0x39, 0x3B, 0xBA, 0x9B, 0x3E, 0xEF, 0xDA, 0x56, 0xC4, 0xA1, 0x9C,
+    0xA4, 0xC4, 0x67, 0xD9, 0xCC, 0xD6, 0xF2, 0x43, 0xA5, 0xDB, 0x09, 0xC2, 0x37, 0x23, 0x1C, 0xF6,
+    0xE2, 0xE5, 0xEA, 0x75, 0x5E, 0xCC, 0xEA, 0xAA, 0xB9, 0xB6, 0x81, 0x38, 0xEF, 0x5A, 0x6F, 0xE7,
+    0xAC, 0xA6, 0x94, 0x36, 0x1B, 0x57, 0x72, 0x7C, 0x86, 0x14, 0xCE, 0xE7, 0x0A, 0x5A, 0x79, 0x06,
+    0x8F, 0x75, 0x81, 0xC3, 0xBE, 0x0A, 0x58, 0xFE, 0x12, 0xF8, 0xAA, 0x43, 0xF4, 0xC7, 0xD3, 0x5A,
+    0x0F, 0x3B, 0x8E, 0x9D, 0x2C, 0x9B, 0x90, 0x3E, 0x5B, 0x45, 0xAD, 0x36, 0x2D, 0xFD, 0xBA, 0xB8,
+    0xB4, 0x9D, 0xAF, 0xC9, 0xBC, 0xA7, 0x55, 0xF2, 0x26, 0x99, 0xB7, 0x65, 0x99, 0x97, 0x7D, 0x0E,
+    0x2C, 0x14, 0xA6, 0x7C, 0x3A, 0x65, 0xEA, 0xEB, 0xE9, 0x66, 0x63, 0x83, 0x42, 0x07, 0xDA, 0x48,
+    0xF0, 0x9A, 0xFB, 0xF4, 0x29, 0x0C, 0x32, 0xCE, 0x24, 0x4B, 0x97, 0x83, 0xA4, 0xEA, 0xA1, 0x18,
+    0x82, 0xE8, 0xD6, 0x62, 0x4D, 0xD9, 0xDB, 0x7B, 0x5D, 0x0C, 0x8E, 0xDD, 0x0C, 0xCC, 0xA5, 0x16,
+    0x61, 0x89, 0xC8, 0x29, 0x2A, 0xF8, 0x30, 0xF5, 0x03, 0x39, 0x80, 0xAE, 0x61, 0xBF, 0x01, 0x1C,
+    0xAE, 0x1D, 0x78, 0x12, 0x6B, 0x4B, 0xAC, 0xDF, 0xA1, 0xFE, 0x16, 0x12, 0x5E, 0x48, 0x23, 0x0C,
+    0x11, 0x17, 0x98, 0x46, 0xA8, 0xAF, 0x53, 0xC6, 0x32, 0x7E, 0x89, 0x0C, 0xF8, 0x55, 0x31, 0x2A,
+    0x88, 0xE6, 0xD1, 0xB7, 0x6B, 0x59, 0x30, 0xF5, 0x2C, 0x0B, 0x26, 0x70, 0xD1, 0x79, 0x6B, 0xC5,
+    0x9E, 0xB0, 0x5E, 0x1E, 0x09, 0x54, 0xB6, 0x3E, 0xEA, 0x6B, 0x83, 0x99, 0x95, 0xA5, 0x7C, 0x14,
+    0x25, 0xF3, 0x42, 0x77, 0x08, 0x20, 0xB5, 0x5B, 0x3B, 0x3B, 0xEB, 0xEB, 0x88, 0x5E, 0x3D, 0x62,
+    0xA5, 0x7B, 0x45, 0x6D, 0xC8, 0xAE, 0x25, 0x48, 0xEB, 0x38, 0x10, 0xC0, 0xE0, 0x70, 0x00, 0x29,
+    0x0D, 0xE6, 0xA3, 0x44, 0x13, 0xFB, 0x2A, 0xB3, 0x86, 0xA3, 0xC3, 0x93, 0x15, 0xBF, 0x64, 0xDC,
+    0xB1, 0x37, 0x3B, 0xEA, 0x22, 0x28, 0x24, 0x09, 0xBA, 0xFD, 0x0C, 0x7A, 0x7D, 0x65, 0xF2, 0x25,
+    0xAA, 0x66, 0x2D, 0x9A, 0x76, 0x3D, 0xF9, 0xBC, 0xB4, 0x4D, 0x47, 0x6F, 0xB1, 0xBC, 0x64, 0x30,
+    0xA5, 0x61, 0xFE, 0x2E, 0x5E, 0x0D, 0xBA, 0x8D, 0x79, 0x52, 0xA7, 0xE6, 0x31, 0x35, 0x8B, 0x2C,
+    0xE4, 0x18, 0x0F, 0x5F, 0x4E, 0x86, 0x06, 0x58, 0x0C, 0x28, 0xD4, 0x69, 0xBE, 0xB5, 0x6E, 0x1E,
+    0xF9, 0xC2, 0xCC, 0xA6, 0x10, 0x89, 0xB8, 0x64, 0xAD, 0x26, 0xA9, 0xD8, 0x88, 0x91, 0xD5, 0xDC,
+    0x26, 0x25, 0xED, 0x47, 0xF3, 0x68, 0xFA, 0xC4, 0x51, 0x32, 0xD9, 0xC3, 0x36, 0xBF, 0x8F, 0xBE,
+    0xFE, 0xE4, 0xAB, 0x08, 0x23, 0x84, 0x15, 0x29, 0xA9, 0x71, 0x9E, 0x48, 0x26, 0xEE, 0x1D, 0x18,
+    0xBF, 0xCC, 0x62, 0x25, 0x0A, 0xE8, 0xFC, 0x9C, 0x9E, 0x2F, 0xC6, 0xFC, 0xEE, 0xBD, 0xBC, 0xC7,
+    0xC4, 0xF7, 0x39, 0x76, 0xC7, 0xF4, 0xCC, 0xB0, 0x97, 0x2B, 0x0E, 0x16, 0x96, 0xF3, 0x89, 0xE4,
+    0xC0, 0xA6, 0xC7, 0x37, 0x0B, 0xCE, 0x3E, 0x6C, 0xF3, 0xEB, 0x3C, 0x77, 0x4E, 0xF1, 0xB2, 0xA5,
+    0x7A, 0xEC, 0x7E, 0xB8, 0xAE, 0x78, 0x7D, 0xED, 0x38, 0xC5, 0xEB, 0xD3, 0xE6, 0xA3, 0x6C, 0xC0,
+    0x66, 0x03, 0x4A, 0xEC, 0xD6, 0x2C, 0x6E, 0xE4, 0xCF, 0x8F, 0xC9, 0x47, 0x39, 0x73, 0x38, 0xA6,
+    0xEB, 0xEE, 0xE0, 0xD1, 0xF9, 0x28, 0x52, 0xA7, 0x99, 0x19, 0xA5, 0x30, 0x49, 0xD7, 0x32, 0xAF,
+    0x3C, 0xC4, 0x2C, 0xCD, 0xBD, 0xE4, 0xAF, 0x4C, 0xFF, 0x2F, 0xB4, 0xAD, 0x11, 0x4A, 0x32, 0x5C,
+    0xDE, 0xCC, 0x5F, 0xD1, 0x2E, 0x1E, 0x6E, 0x0F, 0xE7, 0xAF, 0x1C, 0x5B, 0x5C, 0x34, 0x9C, 0xB5,
+    0xCB, 0x5C, 0x4A, 0x69, 0xDE, 0x6B, 0xC9, 0xD0, 0x4F, 0x5C, 0x5C, 0xB4, 0x1C, 0x93, 0x6A, 0x3C,
+    0xB1, 0xF1, 0x8A, 0x79, 0x3A, 0x9C, 0xB5, 0xCB, 0x72, 0x8A, 0xAD, 0x9F, 0xB7, 0xAE, 0x3E, 0x26,
+    0x1A, 0x54, 0xC7, 0x44, 0x71, 0x4C, 0xD4, 0xC6, 0x74, 0x8D, 0xD4, 0x63, 0xB9, 0xB7, 0xBA, 0xAC,
+    0xC1, 0x7A, 0x31, 0x52, 0x3D, 0x2B, 0x09, 0x7B, 0x27, 0x1E, 0x6B, 0xC2, 0x86, 0x1B, 0xCD, 0xFA,
+    0x64, 0x3B, 0x27, 0xB7, 0xB1, 0xDF, 0x50, 0xFA, 0x62, 0x5F, 0x76, 0x95, 0xDB, 0x9E, 0x55, 0xE4,
+    0x38, 0x47, 0x77, 0x21, 0xD3, 0xCB, 0x41, 0x2A, 0x8A, 0xE8, 0x31, 0xCF, 0xF6, 0x92, 0x8C, 0x9D,
+    0x56, 0x45, 0x91, 0xF2, 0x04, 0xF7, 0x86, 0xDC, 0x7C, 0x4D, 0x11, 0x16, 0xAE, 0x14, 0xE9, 0xF4,
+    0x9A, 0xC8, 0x2A, 0x12, 0xE0, 0x50, 0x1B, 0x09, 0xF1, 0x15, 0x84, 0x6D, 0xC1, 0x83, 0xA4, 0xE7,
+    0x8C, 0x48, 0xB3, 0xF1, 0x97, 0xC5, 0x84, 0x54, 0xEE, 0xEB, 0x7C, 0x1F, 0xA9, 0xA0, 0x8C, 0xA3,
+    0x9B, 0x6F, 0xA2, 0xD0, 0x72, 0xEA, 0xD2, 0x3A, 0x56, 0xEA, 0x27, 0x05, 0xCD, 0x72, 0x07, 0x05,
+    0xA9, 0x98, 0x60, 0xC4, 0x83, 0x22, 0x9B, 0x50, 0x11, 0xF1, 0xA4, 0xF0, 0xCF, 0x6B, 0x87, 0xC5,
+    0x85, 0x4D, 0xB3, 0x86, 0xCC, 0x9E, 0x94, 0x53, 0xCF, 0x60, 0x43, 0x6F, 0x24, 0x66, 0x60, 0x3A,
+    0x6F, 0xF4, 0x76, 0xC8, 0xFE, 0x69, 0x45, 0x2C, 0xCA, 0xA9, 0x48, 0x3D, 0x5D, 0xBD, 0x26, 0xB2,
+    0x8A, 0x2C, 0x69, 0x76, 0x81, 0xE0, 0xEC, 0xD8, 0xA3, 0x91, 0x00, 0xD7, 0xA0, 0x9A, 0xD9, 0x02,
+    0x7A, 0xD9, 0x7E, 0x36, 0x70, 0x37, 0xDC, 0xCA, 0xC5, 0x91, 0x35, 0xE9, 0x74, 0x06, 0xEE, 0x83,
+    0x5D, 0xFF, 0x77, 0x31, 0x6B, 0x25, 0x0A, 0x2E, 0x40, 0x12, 0x34, 0x4A, 0x4B, 0x05, 0x4A, 0x7E,
+    0x40, 0x17, 0x5F, 0x34, 0x9F, 0x47, 0xBD, 0x60, 0xBD, 0x58, 0xBB, 0x84, 0x06, 0xDD, 0xE2, 0x5E,
+    0xA1, 0x53, 0x52, 0x89, 0x03, 0x5D, 0x7A, 0xD1, 0x3C, 0x64, 0x49, 0xF0, 0xD5, 0x11, 0x49, 0xF0,
+    0x1B, 0x89, 0xEE, 0x17, 0xE6, 0xE1, 0x5C, 0xB7, 0xF4, 0x00, 0xC2, 0xD5, 0x18, 0xC6, 0xCB, 0xD6,
+    0xD0, 0xF4, 0x50, 0x12, 0xFC, 0x77, 0x8E, 0x4A, 0x82, 0xF7, 0xEE, 0x31, 0x09, 0xDE, 0x7E, 0xDA,
+    0x24, 0xF8, 0x8D, 0x32, 0x95, 0xF1, 0x3C, 0xA4, 0xF6, 0xD4, 0x30, 0x7F, 0x62, 0x2C, 0x2F, 0xB4,
+    0x7D, 0xE9, 0xB3, 0x99, 0x3F, 0x49, 0x2B, 0x70, 0xE0, 0xFE, 0xCC, 0xDF, 0x30, 0x9B, 0xBF, 0x4E,
+    0xC1, 0x7C, 0x1A, 0x64, 0x16, 0x74, 0x12, 0x0A, 0xCC, 0x81, 0x4C, 0x81, 0xCC, 0x80, 0x4C, 0x80,
+    0x27, 0x47, 0x62, 0x4B, 0xD5, 0x71, 0x61, 0x92, 0x89, 0x1D, 0xC7, 0x5E, 0x86, 0x5E, 0x46, 0x5E,
+    0x06, 0x5E, 0xC6, 0x1D, 0xC3, 0x2E, 0xA3, 0x2E, 0xA3, 0x2D, 0xED, 0xFF, 0x07, 0xED, 0x5C, 0x3F,
+    0x73, 0xDC, 0xC6, 0x15, 0x5F, 0x00, 0xE4, 0x61, 0x86, 0x28, 0xC0, 0x42, 0x9A, 0x51, 0x94, 0x49,
+    0x90, 0x22, 0x85, 0xA5, 0x4C, 0x8C, 0x2F, 0x10, 0x12, 0xB0, 0x5D, 0x78, 0xD2, 0xB1, 0x10, 0x27,
+    0xE9, 0x5C, 0x24, 0x85, 0xAC, 0x42, 0x6C, 0x52, 0xA4, 0xA0, 0x04, 0x8C, 0x3F, 0x01, 0xBB, 0x14,
+    0x6A, 0x38, 0x13, 0x15, 0x0A, 0x9B, 0xB4, 0xF1, 0x0C, 0x25, 0x40, 0xFA, 0x04, 0x27, 0xA7, 0x48,
+    0x91, 0x06, 0x33, 0xB1, 0xE3, 0x24, 0x2E, 0x0C, 0x29, 0xC8, 0x04, 0x9C, 0xE0, 0xB0, 0x79, 0xFF,
+    0x16, 0x7F, 0x48, 0xCA, 0xA2, 0x94, 0x88, 0xBE, 0xE3, 0xE9, 0x46, 0xB7, 0x4F, 0xBC, 0x03, 0x16,
+    0xFB, 0xDE, 0xEF, 0xBD, 0xDD, 0xF7, 0xDE, 0xBE, 0x3D, 0xA5, 0x2C, 0x9D, 0x2B, 0x7C, 0xD9, 0x7A,
+    0x4A, 0xD4, 0xD1, 0x05, 0x51, 0x57, 0x97, 0x44, 0x7D, 0x5D, 0x31, 0x4D, 0x1A, 0xA2, 0x61, 0xC0,
+    0x34, 0xF2, 0x67, 0x44, 0xEF, 0xFA, 0x9A, 0xE8, 0xA1, 0xC7, 0xB4, 0x71, 0x74, 0x0A, 0xC4, 0xAA,
+    0x1C, 0xEA, 0xD8, 0x29, 0xB9, 0x63, 0xA7, 0x54, 0xD4, 0xB1, 0x37, 0x55, 0xD4, 0xB1, 0x9F, 0xAB,
+    0x0C, 0x3B, 0x0E, 0xB4, 0xD6, 0x35, 0x76, 0x0B, 0x14, 0x3B, 0x8E, 0xE0, 0xBF, 0xD8, 0xF1, 0x5D,
+    0xFC, 0x0A, 0xE8, 0x0C, 0x47, 0x80, 0xDD, 0xC2, 0xAD, 0x3A, 0x56, 0x56, 0x83, 0x23, 0xCC, 0x95,
+    0x53, 0x23, 0x9D, 0x2A, 0xAF, 0xC1, 0x91, 0x56, 0x4A, 0x43, 0xA7, 0xD0, 0x43, 0x47, 0x4F, 0x79,
+    0x7D, 0xAA, 0x84, 0xBF, 0x94, 0xA8, 0x27, 0x7C, 0xBB, 0x42, 0x1D, 0xE8, 0x9D, 0x5E, 0x37, 0xA9,
+    0x5D, 0x3D, 0xC0, 0x3F, 0x33, 0x3D, 0xC3, 0x6F, 0xBE, 0x86, 0x7B, 0x3C, 0x6D, 0xC3, 0x95, 0xDE,
+    0x0C, 0xD9, 0x70, 0x1B, 0x62, 0xE2, 0x01, 0xB3, 0x32, 0x68, 0xAF, 0xE2, 0xF3, 0x6D, 0x8D, 0xAD,
+    0xAF, 0xF7, 0xA0, 0x05, 0x5E, 0xA0, 0x8D, 0xE8, 0xFA, 0xA4, 0xEE, 0xDB, 0xA8, 0xB6, 0xE8, 0x73,
+    0x07, 0xAF, 0x69, 0x3F, 0xCA, 0x6A, 0xB8, 0xBE, 0x89, 0x74, 0x6C, 0xEB, 0x12, 0x5A, 0x75, 0xF9,
+    0xC4, 0xC0, 0x79, 0xD8, 0x3C, 0x68, 0x1E, 0xB2, 0x0C, 0xF8, 0xE6, 0x88, 0x49, 0x83, 0x62, 0x87,
+    0xDA, 0x07, 0x8C, 0x96, 0x65, 0x35, 0xC2, 0x7E, 0xCD, 0x34, 0x60, 0x74, 0x55, 0x24, 0x5C, 0x6F,
+    0x48, 0x07, 0xEF, 0x8C, 0x85, 0x76, 0x41, 0xB5, 0xC3, 0x6E, 0x63, 0x1A, 0x3C, 0x3E, 0x33, 0x70,
+    0xF1, 0x89, 0x2B, 0x0E, 0x31, 0xE2, 0x10, 0x5B, 0x01, 0x31, 0xF9, 0x88, 0x44, 0x73, 0x48, 0xE3,
+    0xDE, 0xED, 0x45, 0x32, 0x2F, 0x9A, 0x71, 0x5D, 0x90, 0x4B, 0xE4, 0xEF, 0x86, 0x71, 0xFA, 0xAC,
+    0x64, 0xED, 0x7E, 0x4E, 0x5F, 0x07, 0x7F, 0x64, 0x3C, 0x92, 0x38, 0x93, 0x8B, 0x82, 0xF4, 0x34,
+    0xE3, 0xB8, 0xB8, 0xB3, 0xC0, 0xE5, 0xB8, 0x57, 0xF3, 0x19, 0x32, 0xF8, 0xB8, 0xC4, 0x8B, 0x9F,
+    0xC3, 0xF0, 0xFC, 0x2F, 0xE9, 0x59, 0x69, 0x4B, 0x5F, 0x85, 0xF0, 0xC9, 0x96, 0xB2, 0xE2, 0x79,
+    0xC2, 0xF9, 0x77, 0x32, 0x96, 0x4C, 0xA8, 0x01, 0xCF, 0x7D, 0x22, 0x38, 0xFD, 0x46, 0xF0, 0x09,
+    0xFE, 0x72, 0x02, 0xE7, 0x7C, 0x79, 0x70, 0xDE, 0x1E, 0x08, 0x29, 0x24, 0x11, 0xB9, 0x8F, 0x71,
+    0x1C, 0x16, 0x8B, 0xC7, 0xFF, 0xF7, 0xBC, 0xE3, 0x8C, 0x2F, 0x19, 0x90, 0x2F, 0x13, 0xF4, 0xF7,
+    0xEE, 0xA8, 0xF1, 0xCC, 0x7C, 0x28, 0xF6, 0x5D, 0xB0, 0x7D, 0x3F, 0x4B, 0xDF, 0xDA, 0x77, 0xF7,
+    0x62, 0xA1, 0x7D, 0xFF, 0x21, 0xB6, 0x2B, 0x1B, 0x66, 0xC6, 0xB6, 0xF5, 0x93, 0x0A, 0x6F, 0x7C,
+    0x96, 0x2F, 0x82, 0xAD, 0xAB, 0xB5, 0x3D, 0x1E, 0x50, 0xD2, 0x7A, 0x04, 0x16, 0x74, 0xCC, 0x32,
+    0x4E, 0x88, 0x53, 0x6B, 0x6F, 0x52, 0x9F, 0xBA, 0xD6, 0x1B, 0x0C, 0x97, 0x5C, 0x17, 0x26, 0x24,
+    0xBE, 0x68, 0xE6, 0xE6, 0x24, 0xBA, 0x5C, 0x59, 0x35, 0x0A, 0xCE, 0x2A, 0xDC, 0x7A, 0x20, 0xB2,
+    0xBC, 0x63, 0x74, 0x01, 0x34, 0xC2, 0x3A, 0x48, 0x47, 0x08, 0x79, 0x82, 0x4C, 0xD8, 0xCD, 0xF6,
+    0x8C, 0xC0, 0x4C, 0x66, 0xBD, 0x21, 0x03, 0x4B, 0x60, 0xF5, 0x3D, 0xAC, 0x7F, 0x93, 0x69, 0x40,
+    0x9F, 0x4E, 0xBD, 0x56, 0xE4, 0x71, 0x7F, 0x20, 0x56, 0x16, 0x06, 0x8B, 0x94, 0x97, 0x4F, 0x36,
+    0x1C, 0x10, 0x66, 0x3E, 0x9F, 0x2B, 0xC4, 0x59, 0x63, 0x01, 0x5B, 0x14, 0xDE, 0x15, 0x1F, 0xDF,
+    0x17, 0x57, 0xE0, 0x5D, 0x26, 0xBB, 0x97, 0x42, 0x46, 0x19, 0x81, 0x40, 0xAA, 0x9B, 0x91, 0x36,
+    0xD8, 0x7A, 0x4F, 0x2D, 0xD3, 0x1A, 0x32, 0xD9, 0xA7, 0x51, 0x17, 0xBD, 0x83, 0x45, 0x2B, 0x48,
+    0xF5, 0x83, 0x0D, 0xEA, 0x0D, 0xD7, 0xDD, 0xE4, 0x2B, 0x7E, 0x72, 0x49, 0x72, 0xA7, 0x6B, 0xD6,
+    0xE7, 0x2C, 0x22, 0xF0, 0xA7, 0xA2, 0xEB, 0x02, 0xBA, 0x5D, 0xC9, 0xE8, 0x24, 0x74, 0xD9, 0x5D,
+    0x79, 0x8B, 0xFA, 0x00, 0x75, 0x8E, 0x9E, 0xD8, 0x49, 0x76, 0x89, 0x23, 0x8B, 0xF8, 0xA8, 0x7E,
+    0xB8, 0x50, 0xA8, 0xF7, 0x28, 0xF1, 0x6C, 0x65, 0xFF, 0x59, 0x6C, 0xDD, 0xCD, 0xC7, 0xB6, 0x2F,
+    0x5E, 0xE4, 0xEE, 0x3B, 0x6F, 0xB5, 0xE0, 0xC4, 0x4A, 0x62, 0xD3, 0xF2, 0xE0, 0xFE, 0x1E, 0x45,
+    0x68, 0xF9, 0xEC, 0x57, 0x93, 0x38, 0xC9, 0x05, 0xAF, 0x7E, 0xB5, 0x50, 0x1A, 0x31, 0xD9, 0x5B,
+    0x65, 0x6F, 0x70, 0x16, 0x08, 0xC2, 0xCC, 0xE7, 0x6E, 0xC0, 0x48, 0x5C, 0xB2, 0xF7, 0x47, 0xC8,
+    0xFE, 0x44, 0xFD, 0x58, 0x34, 0x82, 0x03, 0x8E, 0xE0, 0xAB, 0x66, 0xE4, 0x6B, 0x58, 0x3A, 0x5D,
+    0x26, 0x8D, 0x58, 0xE5, 0x74, 0x41, 0xB5, 0x69, 0x90, 0x54, 0x0D, 0x31, 0xB0, 0xEF, 0x15, 0x1D,
+    0xEB, 0xBF, 0xA4, 0x2C, 0xD9, 0x21, 0x69, 0x44, 0x74, 0xAF, 0xA6, 0xD1, 0x94, 0xC4, 0xFA, 0x5C,
+    0x6A, 0xC4, 0x4D, 0xB5, 0x26, 0x01, 0x64, 0x38, 0x8A, 0x0F, 0x22, 0x3D, 0x13, 0xA4, 0xEA, 0x11,
+    0x92, 0x6A, 0x65, 0xA9, 0x62, 0xC7, 0xD7, 0xCD, 0x10, 0xEF, 0xAB, 0x6B, 0xD0, 0xD6, 0x34, 0x91,
+    0xB6, 0x94, 0x5E, 0x4D, 0x68, 0x7C, 0xE1, 0x3C, 0xEB, 0xC2, 0x59, 0xBD, 0xC8, 0x4C, 0x63, 0xF4,
+    0x89, 0x8D, 0xCE, 0x5D, 0xFD, 0x8F, 0x83, 0x2C, 0x47, 0x90, 0x82, 0xDC, 0x82, 0xD6, 0x1F, 0xB4,
+    0x1E, 0xB5, 0xA8, 0x23, 0x27, 0xDB, 0x82, 0x5A, 0x0D, 0xB2, 0x37, 0x6D, 0xF1, 0x82, 0x2B, 0xC7,
+    0xAD, 0x55, 0x61, 0x6B, 0x73, 0x4B, 0xCA, 0xE1, 0x94, 0x8E, 0xFE, 0x62, 0xFB, 0xA3, 0x92, 0xC6,
+    0x23, 0xED, 0x18, 0xBA, 0xEF, 0x92, 0xB4, 0x13, 0x16, 0x5B, 0xDD, 0xB7, 0xFC, 0xC9, 0x1A, 0xCD,
+    0xEC, 0xB7, 0x62, 0x04, 0xA7, 0xA6, 0xE8, 0x30, 0x76, 0xF4, 0x7B, 0x3A, 0xF7, 0x5B, 0x95, 0x95,
+    0xA0, 0xAD, 0x49, 0x19, 0x36, 0x20, 0xC0, 0xA8, 0x96, 0x06, 0xE4, 0xA6, 0xB5, 0x34, 0x47, 0xDB,
+    0xDB, 0x37, 0x22, 0xEC, 0x8B, 0x1B, 0x42, 0x18, 0x1B, 0xB8, 0x57, 0x95, 0xB0, 0x06, 0xE0, 0xD8,
+    0x8E, 0x76, 0x0A, 0x0E, 0x39, 0x03, 0x32, 0xA9, 0xCB, 0x5D, 0xE4, 0x70, 0xDB, 0xC4, 0x9C, 0xA8,
+    0x89, 0xDC, 0xB0, 0x35, 0x5D, 0xEB, 0x87, 0x9E, 0xD4, 0xC4, 0x37, 0xAE, 0x41, 0x56, 0x41, 0xC9,
+    0xDC, 0x38, 0xEA, 0x13, 0xBB, 0x93, 0x59, 0xEF, 0xDC, 0x71, 0x5A, 0x60, 0xD2, 0xF5, 0xBE, 0x00,
+    0x20, 0xD9, 0xA8, 0x52, 0x3E, 0xA2, 0xE5, 0x7F, 0x58, 0x99, 0x2C, 0x3B, 0x35, 0x94, 0x63, 0xA7,
+    0x14, 0xFB, 0xEE, 0x28, 0xC1, 0x7E, 0xBE, 0x30, 0x41, 0x44, 0x08, 0x26, 0x1A, 0xB4, 0x60, 0xC7,
+    0x30, 0x1F, 0xFE, 0xB5, 0x22, 0xA1, 0xC2, 0x68, 0x9B, 0x00, 0x39, 0xAD, 0x6C, 0x3D, 0x8A, 0xA7,
+    0x17, 0x41, 0xE2, 0x6B, 0xA9, 0x8A, 0x41, 0xA7, 0x1C, 0x64, 0xF5, 0xDE, 0x14, 0x67, 0x8E, 0xDC,
+    0x29, 0x13, 0x90, 0xE4, 0xD4, 0x9B, 0x8D, 0x66, 0xF5, 0xF3, 0x36, 0x87, 0x35, 0x32, 0xD1, 0x88,
+    0xDA, 0xBB, 0x34, 0xBB, 0xD1, 0x0C, 0x5D, 0x83, 0xC3, 0xE9, 0x3D, 0x43, 0xED, 0x0F, 0x73, 0xCC,
+    0xD2, 0x3F, 0xC2, 0x05, 0x60, 0xC1, 0x64, 0xDE, 0x31, 0x99, 0xBC, 0xFA, 0x36, 0x03, 0xE1, 0xC0,
+    0x40, 0x10, 0x12, 0x8A, 0xA0, 0x50, 0x84, 0x85, 0x22, 0x30, 0x14, 0xA1, 0x31, 0xF8, 0xD7, 0x28,
+    0xC2, 0xC2, 0xB4, 0x08, 0x09, 0xC3, 0x61, 0x5A, 0x5A, 0x7F, 0x09, 0x16, 0xC6, 0x45, 0x11, 0x30,
+    0x8A, 0x91, 0x61, 0x68, 0x04, 0x1B, 0x1A, 0xF7, 0x75, 0xD5, 0x23, 0xC3, 0xF1, 0x82, 0x5D, 0x12,
+    0x57, 0xBF, 0xA0, 0x51, 0x79, 0xFF, 0x12, 0x74, 0xD2, 0x85, 0x44, 0x67, 0xBB, 0xDB, 0x1B, 0xA0,
+    0x24, 0x99, 0xFB, 0x04, 0x53, 0x83, 0xB4, 0x31, 0x40, 0xC0, 0x10, 0x2E, 0x04, 0x4B, 0x8F, 0xCA,
+    0xB9, 0xDB, 0x06, 0xB5, 0x6C, 0x9F, 0xFE, 0x0E, 0xBB, 0xE1, 0xAA, 0xB7, 0x93, 0xEA, 0x02, 0xD9,
+    0x49, 0x97, 0xAD, 0xA7, 0x64, 0x3D, 0xE7, 0xEA, 0x0F, 0x31, 0x53, 0x5F, 0x72, 0xA2, 0x7E, 0x4E,
+    0x30, 0x99, 0xDC, 0x87, 0x47, 0xC3, 0xE3, 0x3E, 0x28, 0xD0, 0xAD, 0x43, 0x3E, 0x61, 0x45, 0x00,
+    0xF5, 0xD9, 0xB7, 0x8E, 0x7A, 0x89, 0x13, 0x47, 0x0E, 0xDB, 0xC8, 0x82, 0x23, 0x43, 0xC9, 0x73,
+    0xCA, 0x9D, 0xE3, 0x20, 0x69, 0xCB, 0x61, 0x90, 0x38, 0x27, 0x17, 0xC6, 0x65, 0x93, 0xC1, 0x85,
+    0x32, 0xFE, 0x06, 0x78, 0xAC, 0x73, 0x31, 0x99, 0x83, 0x3D, 0xE2, 0x8F, 0x01, 0xA0, 0x1B, 0x64,
+    0x92, 0x4A, 0x52, 0x74, 0x9C, 0xD0, 0x5F, 0xBA, 0xD4, 0x4F, 0xB2, 0x17, 0xD1, 0x9B, 0xC5, 0x1C,
+    0x36, 0x45, 0x62, 0x14, 0xA8, 0x53, 0x02, 0x9B, 0x02, 0xBB, 0x6F, 0x7B, 0x2A, 0x1B, 0x7B, 0xBD,
+    0xC5, 0x69, 0x5E, 0x2F, 0x0A, 0xC1, 0x83, 0x21, 0x79, 0x9F, 0x34, 0xCA, 0xC2, 0xB8, 0xCD, 0x6E,
+    0xB8, 0x20, 0x05, 0xAD, 0x67, 0xB3, 0xBF, 0x0E, 0x60, 0xCB, 0x19, 0xB2, 0x0A, 0xEE, 0x29, 0x48,
+    0xE4, 0xFF, 0xAF, 0x37, 0xF6, 0xC7, 0x61, 0x21, 0x3F, 0xC3, 0x06, 0xEB, 0x46, 0x3F, 0xD5, 0xFF,
+    0xB0, 0x56, 0xAB, 0x98, 0x40, 0xC7, 0xF8, 0x11, 0xC7, 0x84, 0x4B, 0xFA, 0x1D, 0xCA, 0x93, 0xF4,
+    0x1E, 0x3B, 0x8C, 0x1F, 0xDF, 0xC8, 0x99, 0xF5, 0x5A, 0x6F, 0x7E, 0x36, 0x4C, 0x2C, 0x29, 0xBE,
+    0xCF, 0x93, 0xCF, 0x8E, 0x89, 0xDB, 0x31, 0x8D, 0xC5, 0x96, 0x6B, 0x14, 0xA2, 0xF4, 0x1D, 0x5C,
+    0x72, 0x8E, 0x7F, 0x9E, 0xF3, 0xE7, 0xEA, 0xCD, 0xF1, 0xFF, 0xA2, 0x31, 0x91, 0xD2, 0x0C, 0x22,
+    0x25, 0x2B, 0x23, 0xAB, 0x0A, 0x34, 0x05, 0x4B, 0xD9, 0xD1, 0xCF, 0xE0, 0x7B, 0xD4, 0xB3, 0x0C,
+    0xD7, 0x8E, 0x18, 0x15, 0x14, 0xD5, 0x13, 0xDE, 0x98, 0x1F, 0xF0, 0x34, 0xA9, 0x2D, 0x7C, 0x91,
+    0x70, 0x46, 0x20, 0xAB, 0x87, 0x44, 0xD3, 0xA2, 0x3A, 0xFD, 0x26, 0x92, 0x55, 0xC3, 0x1B, 0x12,
+    0x26, 0xDC, 0x67, 0x1A, 0x52, 0xB6, 0xC1, 0x3C, 0x0F, 0x13, 0x1B, 0xF0, 0x09, 0xA6, 0x1D, 0x12,
+    0xB8, 0x49, 0x57, 0x13, 0x1C, 0x68, 0xC8, 0x69, 0x06, 0x70, 0xC1, 0x3F, 0xA7, 0xD1, 0xDF, 0x18,
+    0x6D, 0x59, 0x7D, 0xAE, 0x8C, 0x7B, 0xA6, 0x24, 0x91, 0xD1, 0x11, 0xC9, 0x9B, 0x58, 0xFB, 0x6C,
+    0xC0, 0x5B, 0xE4, 0x1F, 0xB6, 0x3C, 0xFD, 0xE4, 0x18, 0xA5, 0x03, 0xC3, 0xC8, 0x65, 0x83, 0xFE,
+    0x21, 0x5C, 0xCC, 0x8C, 0xC3, 0xC8, 0x7C, 0x8D, 0xF6, 0xEA, 0xBD, 0xB4, 0xA5, 0x2B, 0xF9, 0x2E,
+    0xB8, 0x1D, 0x3A, 0xE1, 0xAF, 0x1C, 0x50, 0xC5, 0x92, 0xCD, 0x0E, 0xE6, 0x20, 0xF1, 0x0F, 0x07,
+    0x63, 0xBE, 0x1D, 0x77, 0x33, 0x1B, 0xA9, 0x86, 0xB4, 0x8A, 0xB5, 0x6A, 0xA4, 0x24, 0x41, 0x2B,
+    0x9A, 0x42, 0x5F, 0xFD, 0x3A, 0xA0, 0x05, 0x71, 0x5D, 0xF6, 0x28, 0x38, 0xEB, 0x6E, 0x65, 0xF1,
+    0x60, 0x9F, 0xC2, 0x2E, 0x07, 0x3C, 0x5F, 0x20, 0xBC, 0xAD, 0x6C, 0x4F, 0x71, 0x02, 0x4A, 0xD1,
+    0x7C, 0x07, 0xDF, 0x73, 0xA5, 0x16, 0x17, 0xE4, 0x79, 0x55, 0xEF, 0x7A, 0x6F, 0x0E, 0x37, 0xE9,
+    0x5E, 0x04, 0x7D, 0x72, 0xFE, 0xD0, 0x5B, 0x0F, 0x38, 0xFD, 0xC5, 0x40, 0x91, 0x6F, 0x13, 0xB4,
+    0x7E, 0x4C, 0x19, 0xC4, 0x9F, 0x13, 0xFE, 0x21, 0xE5, 0xEF, 0x6A, 0xB7, 0xE2, 0x54, 0x45, 0x73,
+    0x32, 0x59, 0x7C, 0x31, 0x2C, 0x77, 0x58, 0x4B, 0xF6, 0x10, 0x41, 0x79, 0x4A, 0x0F, 0xA2, 0x20,
+    0xEF, 0x9F, 0x1C, 0xE4, 0x9D, 0xBE, 0x83, 0x3C, 0x07, 0x48, 0xF2, 0x2E, 0xA7, 0x41, 0xD1, 0x60,
+    0xB4, 0xC9, 0x86, 0x3A, 0x89, 0x78, 0x16, 0xD6, 0xC1, 0x00, 0x49, 0xAF, 0x50, 0xB3, 0x8B, 0x88,
+    0xE4, 0xF6, 0xA0, 0x6C, 0x92, 0xF7, 0x7B, 0xDD, 0xA7, 0xC4, 0xD4, 0x6F, 0x39, 0xEF, 0x3C, 0xEF,
+    0x48, 0x0E, 0x52, 0xF4, 0x19, 0xAF, 0xE7, 0x5F, 0x96, 0xC3, 0x39, 0xD4, 0x1D, 0x59, 0xE8, 0x4F,
+    0x97, 0xCA, 0x42, 0x79, 0x8A, 0x1A, 0x56, 0x83, 0xF1, 0xAC, 0x7A, 0x07, 0xE1, 0xFA, 0x8C, 0x1E,
+    0x4A, 0xD5, 0x60, 0xF3, 0x8F, 0xF1, 0x2D, 0xA2, 0xE0, 0x41, 0x6F, 0x50, 0x96, 0x9E, 0x83, 0x9C,
+    0x4F, 0x68, 0x1D, 0x59, 0x93, 0x72, 0x9F, 0xF1, 0x5A, 0x1B, 0x71, 0xAE, 0x72, 0x39, 0xA0, 0xEE,
+    0x8A, 0xBD, 0xA6, 0x28, 0xBC, 0xAF, 0x41, 0x78, 0x75, 0x82, 0x9B, 0x3F, 0x85, 0x3B, 0x1B, 0xEC,
+    0x5B, 0x91, 0x24, 0x16, 0xC5, 0xA8, 0xD7, 0xB8, 0xD8, 0x37, 0xD4, 0xE2, 0x39, 0xA5, 0x03, 0x34,
+    0x1B, 0x99, 0x90, 0xC9, 0x69, 0x58, 0xC5, 0xD8, 0x76, 0xB9, 0x9D, 0x62, 0xF5, 0x82, 0x0A, 0x2E,
+    0x03, 0x70, 0x70, 0x06, 0x80, 0xE7, 0xD9, 0x89, 0xBE, 0x2A, 0x85, 0xDF, 0x91, 0x58, 0x6F, 0x22,
+    0x09, 0x02, 0x89, 0x95, 0x9C, 0xD9, 0xB8, 0xD6, 0x07, 0x19, 0x35, 0x7E, 0x23, 0x2C, 0x09, 0xA4,
+    0x12, 0x98, 0xE0, 0x40, 0x9D, 0xC8, 0x0A, 0x56, 0x8A, 0xB0, 0x60, 0xAD, 0xF0, 0xA7, 0xAC, 0x16,
+    0x7E, 0x4E, 0x38, 0xCD, 0x42, 0x51, 0x8C, 0x46, 0x34, 0x03, 0x42, 0x3B, 0xD9, 0x41, 0x15, 0x8C,
+    0x3B, 0x2A, 0x1A, 0xF0, 0x52, 0x2A, 0x2A, 0xD2, 0xDD, 0x27, 0x4A, 0x22, 0xFD, 0xA7, 0x4A, 0xD4,
+    0xC4, 0xE8, 0x89, 0x51, 0x14, 0xBE, 0x16, 0x39, 0x12, 0x55, 0x41, 0x5D, 0x69, 0xD5, 0x40, 0x59,
+    0x7A, 0x6D, 0xA1, 0xF4, 0x8F, 0x23, 0x5B, 0x97, 0x7D, 0x01, 0x70, 0x34, 0x95, 0x5C, 0xEF, 0x16,
+    0x9A, 0x88, 0x43, 0xC2, 0x73, 0x5B, 0x44, 0x1F, 0xAE, 0x02, 0xF4, 0x6D, 0x4D, 0xE8, 0x3F, 0x22,
+    0xF3, 0xBE, 0x83, 0xE8, 0xD7, 0x35, 0xA2, 0xAF, 0x31, 0x13, 0xE2, 0xEB, 0xF8, 0x0D, 0xA2, 0xBF,
+    0x76, 0x20, 0x75, 0x39, 0xB2, 0xA3, 0x64, 0x36, 0xD5, 0x55, 0x24, 0x18, 0x7A, 0xE2, 0x98, 0x99,
+    0x83, 0x3A, 0x68, 0xE3, 0xCB, 0x83, 0xA9, 0x45, 0x88, 0xCA, 0xBE, 0x37, 0xEF, 0x62, 0x78, 0x1C,
+    0x26, 0x69, 0xB3, 0x39, 0xB1, 0x85, 0x33, 0xDF, 0x5C, 0x61, 0x7A, 0x7C, 0x05, 0x36, 0xE1, 0xAE,
+    0x89, 0x77, 0xBB, 0x80, 0xD7, 0x1C, 0xC6, 0x90, 0x90, 0xB7, 0xAB, 0xCD, 0xB3, 0x8D, 0xFD, 0xEE,
+    0x2F, 0x95, 0xFD, 0xBE, 0x5A, 0x4C, 0xBC, 0x85, 0xB2, 0x99, 0x2F, 0xDC, 0x3F, 0x56, 0xAB, 0x5C,
+    0x41, 0x31, 0x0D, 0xB9, 0x50, 0xE4, 0x28, 0xE1, 0x42, 0x18, 0xBE, 0x28, 0x7C, 0x9F, 0xAB, 0xEA,
+    0x42, 0x95, 0x48, 0xD1, 0x90, 0xB5, 0x54, 0xF8, 0x4E, 0xF6, 0x70, 0x43, 0x2B, 0x6A, 0x1C, 0xDA,
+    0x6C, 0xBC, 0x57, 0x50, 0xFD, 0x0A, 0xAC, 0xB9, 0xB8, 0x0D, 0xAD, 0x9C, 0xA9, 0xD7, 0x22, 0xA6,
+    0x6A, 0x7D, 0xFE, 0x6C, 0x79, 0xA9, 0xD6, 0xD0, 0xB1, 0xCF, 0x65, 0x9C, 0x2E, 0xE3, 0x6E, 0x75,
+    0x54, 0xFC, 0xAE, 0x61, 0x66, 0x6E, 0x8B, 0x94, 0x7F, 0x0E, 0x67, 0xE2, 0x97, 0xFB, 0x56, 0xB8,
+    0x97, 0x17, 0xE8, 0x19, 0x90, 0x02, 0x88, 0x0B, 0x5D, 0xE0, 0xE5, 0xB8, 0xEC, 0x44, 0xEA, 0xDB,
+    0x22, 0x88, 0xF5, 0x5D, 0x45, 0x2A, 0x03, 0x1C, 0x45, 0x2D, 0x6D, 0x87, 0xF8, 0xFA, 0x8B, 0x9D,
+    0x12, 0xF1, 0xE4, 0x9C, 0xFD, 0x8E, 0xD4, 0xEA, 0x6D, 0x8F, 0xB0, 0xBB, 0x3D, 0x38, 0xD4, 0x62,
+    0xCA, 0xF2, 0x1C, 0xAE, 0xD2, 0x33, 0xFE, 0xC5, 0x20, 0x7D, 0x1E, 0xE9, 0x29, 0xFC, 0x33, 0x04,
+    0xAE, 0x93, 0xFC, 0xBD, 0xCD, 0xC4, 0xFA, 0xDF, 0x08, 0xF7, 0x52, 0xD0, 0xE3, 0x75, 0xC9, 0xA4,
+    0xF2, 0x35, 0xC5, 0x67, 0x2D, 0x71, 0xAA, 0x6B, 0x74, 0xFD, 0x3D, 0x88, 0x21, 0x50, 0xB5, 0x6E,
+    0xA8, 0xD7, 0xF3, 0xFC, 0xC7, 0x87, 0x9F, 0xA4, 0x4A, 0xD5, 0x7F, 0xBF, 0x19, 0x9E, 0x72, 0x96,
+    0x43, 0xCE, 0x72, 0xC6, 0x59, 0x8E, 0x38, 0x4B, 0x05, 0xF4, 0xB0, 0xF2, 0xEA, 0x42, 0x28, 0x43,
+    0xC8, 0xA2, 0x63, 0x33, 0xB7, 0x4A, 0xCE, 0x6B, 0xC5, 0xC2, 0x34, 0x57, 0x92, 0x59, 0x2C, 0x56,
+    0x8F, 0xAF, 0xF4, 0xF2, 0x51, 0x85, 0xB8, 0x9A, 0x77, 0x0D, 0xB1, 0xBB, 0x53, 0x50, 0xE9, 0x68,
+    0xA6, 0x0A, 0xC5, 0x8B, 0x4A, 0x84, 0x91, 0xB6, 0x9F, 0x9E, 0x6C, 0x59, 0x77, 0xBD, 0x86, 0x30,
+    0x6E, 0x7D, 0x01, 0xD9, 0x6B, 0x27, 0x88, 0x72, 0x66, 0xB7, 0x22, 0xEF, 0x99, 0x50, 0x2E, 0xBF,
+    0x8C, 0xC0, 0x31, 0x23, 0xBA, 0x23, 0x6A, 0x30, 0x13, 0x5C, 0xE2, 0x0E, 0x9F, 0x37, 0x46, 0x05,
+    0x78, 0x42, 0x1E, 0x33, 0x57, 0x02, 0x3D, 0x61, 0x4F, 0x45, 0x73, 0x5A, 0xB3, 0xCA, 0xEF, 0x68,
+    0x61, 0x74, 0x5B, 0xC2, 0xDB, 0xEB, 0x0F, 0x44, 0x0E, 0x22, 0x0F, 0x29, 0xD3, 0xB5, 0x65, 0x02,
+    0x37, 0xBB, 0xF8, 0xE8, 0x8B, 0x5E, 0xE1, 0xF4, 0x81, 0xD2, 0x6A, 0x54, 0xDB, 0x0D, 0x93, 0x05,
+    0x00, 0x9E, 0x80, 0xDC, 0x73, 0xC6, 0x3E, 0xCC, 0x19, 0xFC, 0x20, 0xB6, 0x09, 0xB7, 0x88, 0x61,
+    0x7C, 0xDA, 0x30, 0x35, 0xB0, 0xFE, 0x5D, 0x19, 0x78, 0x5F, 0x85, 0xDA, 0x4C, 0x59, 0x11, 0x8C,
+    0x26, 0x18, 0x55, 0x30, 0xBA, 0x60, 0x94, 0x01, 0xB4, 0xA1, 0x20, 0x6D, 0xE8, 0xD4, 0xE1, 0x60,
+    0x7F, 0xCC, 0x6E, 0x60, 0x7E, 0xD9, 0xC0, 0xD4, 0xF4, 0x8A, 0x93, 0xDD, 0x9D, 0x80, 0x86, 0xE8,
+    0x78, 0x89, 0xF4, 0xC1, 0x68, 0x43, 0x28, 0x62, 0xF1, 0x8E, 0x61, 0xAD, 0xA2, 0xBC, 0x4F, 0x1E,
+    0x5C, 0x11, 0x7B, 0x59, 0x64, 0x7D, 0x38, 0x7E, 0x1C, 0xD6, 0x1C, 0x5C, 0x90, 0x35, 0xE1, 0xEC,
+    0x3F, 0x7D, 0x71, 0x6D, 0xB9, 0xE6, 0x0D, 0x59, 0x37, 0x64, 0xE1, 0xE8, 0x56, 0x8E, 0x6E, 0xE9,
+    0x90, 0xB5, 0xC3, 0x2C, 0x1E, 0x66, 0xF5, 0xA0, 0xE5, 0xE3, 0x8A, 0xAC, 0x1F, 0x8B, 0xAC, 0x37,
+    0xF6, 0x1E, 0x3B, 0xB2, 0x61, 0xCB, 0x27, 0xBF, 0x12, 0xFD, 0xA7, 0x52, 0x8E, 0x5D, 0x93, 0x16,
+    0xD4, 0x21, 0x2D, 0xB6, 0x56, 0x69, 0x26, 0x52, 0xB5, 0xBE, 0x54, 0xFA, 0xF1, 0x31, 0x6F, 0x32,
+    0x41, 0xB4, 0xB1, 0xC9, 0xC1, 0xED, 0xD1, 0x43, 0xCE, 0x4F, 0x73, 0x70, 0x1B, 0x71, 0xFC, 0x0E,
+    0xD6, 0x93, 0x4D, 0x79, 0x1E, 0x51, 0x8B, 0x3F, 0x8F, 0x2C, 0x95, 0xDF, 0x30, 0x8E, 0x22, 0x4C,
+    0x18, 0xD1, 0x1D, 0xEF, 0x91, 0x40, 0xA2, 0xCF, 0x54, 0x0E, 0x3C, 0xE7, 0x8B, 0x82, 0xF7, 0x6B,
+    0x04, 0xC0, 0xC6, 0x1B, 0x15, 0x29, 0x45, 0xB2, 0xD8, 0x34, 0x83, 0x93, 0x84, 0xA6, 0x0E, 0x9C,
+    0xB3, 0x44, 0x22, 0x29, 0xAD, 0xE3, 0x8C, 0xAA, 0xFD, 0x52, 0xAD, 0xCB, 0x40, 0x1F, 0x61, 0x26,
+    0x18, 0xF7, 0xA6, 0xEC, 0x19, 0x48, 0xBE, 0x24, 0xCC, 0x80, 0xE0, 0xF6, 0x3C, 0xC4, 0xFC, 0xF8,
+    0x33, 0x44, 0x10, 0x04, 0xE3, 0x54, 0x1B, 0x42, 0x08, 0x9C, 0xD2, 0x11, 0xA7, 0x90, 0x0F, 0x1D,
+    0x6E, 0x72, 0xEA, 0xFB, 0x90, 0xAB, 0x12, 0xB9, 0x3A, 0xF0, 0x39, 0xCD, 0x5C, 0xC9, 0x7F, 0x0A,
+    0xF6, 0xE2, 0x73, 0x1E, 0x7F, 0x3A, 0x38, 0x03, 0x7F, 0x76, 0xC2, 0xD3, 0x9E, 0xCF, 0xFB, 0x34,
+    0x42, 0x6E, 0xDD, 0xEF, 0x77, 0x23, 0xFC, 0x76, 0xE0, 0x5D, 0xB2, 0xEF, 0xCD, 0x67, 0xA7, 0xAD,
+    0x63, 0x7A, 0x05, 0x13, 0x45, 0xA0, 0x0B, 0xAD, 0x6B, 0x68, 0x7D, 0x9D, 0x5A, 0x9A, 0xCE, 0x67,
+    0x35, 0xE4, 0xC7, 0x37, 0xA8, 0x6E, 0x16, 0x56, 0x51, 0x4E, 0x91, 0x57, 0x00, 0x0F, 0x0B, 0x6D,
+    0x4B, 0xDC, 0xCE, 0x8B, 0x6A, 0xAC, 0x41, 0x0F, 0x1B, 0xE4, 0x3A, 0x68, 0x02, 0x7A, 0x62, 0x44,
+    0x13, 0xD1, 0x06, 0x71, 0x7E, 0x48, 0x4F, 0x67, 0xBE, 0xAB, 0x3E, 0x69, 0xCC, 0xA9, 0x36, 0x76,
+    0x6E, 0xA4, 0x8D, 0xBB, 0xCA, 0x6F, 0x5E, 0xC3, 0xDC, 0xA6, 0x0B, 0x1B, 0x7E, 0x44, 0xF0, 0xF1,
+    0x96, 0xE9, 0xF5, 0xAD, 0xC5, 0x07, 0xE8, 0xB8, 0x4E, 0xFF, 0x61, 0x7C, 0x5F, 0x3C, 0xF8, 0x4B,
+    0x1C, 0x42, 0xF9, 0x2D, 0x84, 0x39, 0x02, 0x0A, 0x0D, 0xD1, 0x6A, 0x71, 0x94, 0x6E, 0x83, 0x6D,
+    0x08, 0x96, 0x8C, 0x40, 0xE1, 0xB6, 0x9C, 0x8E, 0x61, 0xBC, 0x0C, 0x54, 0xBF, 0xCD, 0xCF, 0x6C,
+    0x85, 0x6C, 0x89, 0xEF, 0xF2, 0x66, 0xD8, 0x0A, 0xFF, 0x82, 0x97, 0xD9, 0x1A, 0x93, 0xD8, 0x50,
+    0x4C, 0x58, 0x1C, 0xC0, 0xFB, 0x17, 0xC5, 0x2C, 0x59, 0x96, 0x36, 0x2D, 0xC8, 0xCE, 0x94, 0x74,
+    0x3C, 0x66, 0x2F, 0xEE, 0x11, 0xE5, 0x61, 0x9B, 0xFE, 0xEC, 0x98, 0x1F, 0xF7, 0xED, 0xA2, 0x9A,
+    0xA8, 0x52, 0x57, 0x63, 0x8B, 0xBB, 0xF3, 0xA9, 0xBA, 0xB8, 0xDD, 0x49, 0xF1, 0xA1, 0x2C, 0x92,
+    0xC7, 0xB4, 0xBE, 0xF9, 0x71, 0x58, 0x8F, 0x7E, 0x4F, 0x69, 0xE1, 0x41, 0x9E, 0x90, 0x9F, 0xCA,
+    0x5E, 0x2A, 0xFB, 0xA8, 0xE4, 0xA1, 0x5A, 0xE4, 0x9F, 0x76, 0xDE, 0xE9, 0xFA, 0x22, 0x03, 0xFB,
+    0x5F, 0xBD, 0x59, 0xBD, 0xB3, 0xDD, 0x46, 0x15, 0x3F, 0x92, 0xE2, 0xAB, 0xF0, 0x34, 0x8C, 0x5C,
+    0xD8, 0x0C, 0x63, 0x13, 0x8B, 0x12, 0xCC, 0x38, 0x6A, 0x28, 0x28, 0xE2, 0xB7, 0x4A, 0x52, 0xA4,
+    0x48, 0x91, 0x57, 0xF8, 0x0D, 0x43, 0x0A, 0x68, 0xC1, 0x29, 0x9C, 0x26, 0x33, 0x19, 0x06, 0x3F,
+    0x89, 0x49, 0x41, 0xFB, 0x0A, 0x66, 0x28, 0x71, 0xE1, 0x0C, 0xCE, 0x2B, 0x62, 0x0A, 0x8A, 0x0C,
+    0xD8, 0x4F, 0xCA, 0xF8, 0x0F, 0x40, 0x84, 0x01, 0x66, 0xA0, 0x88, 0x00, 0xD3, 0xD0, 0x78, 0xC7,
+    0xB3, 0x21, 0x8A, 0xBD, 0xBA, 0xCB, 0xEF, 0x9C, 0x95, 0xEE, 0xBD, 0xEF, 0x3E, 0x7F, 0xC0, 0x70,
+    0x83, 0xAE, 0x74, 0xB4, 0x92, 0x76, 0xCF, 0x39, 0x7B, 0xCE, 0xD9, 0xF3, 0xB1, 0x77, 0x47, 0x3F,
+    0xE1, 0x38, 0x15, 0x14, 0x17, 0xE2, 0x2A, 0xF9, 0x2E, 0x85, 0x3D, 0x05, 0x86, 0xE2, 0x81, 0xCE,
+    0x3D, 0x2C, 0xBE, 0x75, 0xBF, 0x21, 0x4D, 0x1B, 0x38, 0x77, 0x88, 0x7E, 0x45, 0x74, 0x81, 0x2E,
+    0xDF, 0x2C, 0x9C, 0xAB, 0xF4, 0x39, 0xD2, 0x6F, 0x93, 0xBE, 0xB6, 0x01, 0xC4, 0xD7, 0x88, 0x82,
+    0x82, 0xE2, 0x8A, 0xCE, 0x11, 0xED, 0x1D, 0x14, 0xB5, 0x6B, 0x2E, 0x44, 0x4D, 0xF2, 0x72, 0x13,
+    0xBE, 0xD3, 0x50, 0xF4, 0xBF, 0x9F, 0x15, 0x11, 0x29, 0xD7, 0x2F, 0xCE, 0xB5, 0x47, 0xE5, 0x9C,
+    0x33, 0x02, 0xCE, 0x1F, 0x1C, 0x1C, 0x5C, 0xA7, 0xC5, 0xC1, 0xEF, 0xE4, 0xE8, 0x97, 0xAD, 0xE5,
+    0xD7, 0xAF, 0xD3, 0xB5, 0xED, 0xC0, 0xFC, 0x3F, 0xCF, 0x05, 0x53, 0x95, 0x80, 0x25, 0x2B, 0xCC,
+    0x77, 0x21, 0xEF, 0xA4, 0x45, 0x5F, 0x0E, 0x6C, 0x72, 0x37, 0x2F, 0xB6, 0xE9, 0x90, 0x5C, 0xE5,
+    0xB4, 0xD3, 0xB5, 0x56, 0x7A, 0xAB, 0x9A, 0xED, 0x67, 0x7D, 0x6E, 0xF3, 0x21, 0x1B, 0x60, 0x18,
+    0x96, 0xFA, 0x50, 0x67, 0xED, 0x1E, 0x7D, 0x95, 0x92, 0x4A, 0xA1, 0x07, 0xF7, 0x73, 0xD5, 0x21,
+    0x6D, 0x53, 0x5E, 0x24, 0x26, 0xB0, 0x74, 0x6A, 0xB6, 0x2F, 0x23, 0x4C, 0x6E, 0x15, 0x46, 0x29,
+    0x9B, 0x0D, 0xB9, 0x8D, 0x87, 0xD8, 0x92, 0xC5, 0xD7, 0x3E, 0xC0, 0xF8, 0x08, 0x18, 0xF2, 0x66,
+    0x8F, 0x18, 0xCB, 0x0E, 0xF0, 0x30, 0xA6, 0x05, 0x2E, 0xFE, 0x75, 0xA0, 0x0F, 0x9C, 0xB7, 0x81,
+    0xF5, 0x2A, 0xF0, 0x32, 0xE6, 0xA4, 0x0B, 0x6C, 0xD0, 0xD3, 0x29, 0xFC, 0xB6, 0xA0, 0xF8, 0x54,
+    0x2F, 0xAF, 0xA4, 0xC3, 0xD5, 0x12, 0xC5, 0xB8, 0xA0, 0xB8, 0xFA, 0x17, 0x7F, 0x9E, 0xD7, 0xCE,
+    0xC9, 0xF5, 0xEB, 0x57, 0x3E, 0x7C, 0x5F, 0xBE, 0x73, 0xBF, 0x0C, 0xA2, 0xC8, 0x7B, 0x7F, 0xE7,
+    0xEB, 0x18, 0x8E, 0x15, 0x3C, 0x71, 0xE3, 0xAF, 0xE8, 0x31, 0x17, 0x1F, 0xAB, 0x7C, 0xF0, 0x58,
+    0x8C, 0xDB, 0x89, 0x9A, 0x13, 0xF5, 0xC3, 0x7B, 0x0B, 0xFA, 0xEF, 0xC6, 0xCD, 0x77, 0x16, 0xF4,
+    0xF3, 0x91, 0x2E, 0x3F, 0xAF, 0xE2, 0x62, 0x7A, 0xF2, 0xBD, 0x5F, 0xF2, 0x85, 0x3E, 0x87, 0xDF,
+    0xFE, 0xC3, 0xE1, 0x84, 0xE7, 0xF0, 0x67, 0x7F, 0x9C, 0x0B, 0x3F, 0xCC, 0x5F, 0xDA, 0x2D, 0xE9,
+    0xF2, 0x71, 0x92, 0x12, 0xD6, 0x6D, 0x57, 0x3A, 0x53, 0xBB, 0xDE, 0x39, 0xEB, 0x4F, 0xB4, 0x4B,
+    0xB6, 0x50, 0x9D, 0xBA, 0x26, 0x78, 0x57, 0x7A, 0x7E, 0x93, 0x2D, 0xA1, 0xC0, 0x65, 0xD8, 0x22,
+    0x0A, 0x5C, 0x86, 0x2D, 0x03, 0x46, 0x30, 0xE0, 0xDE, 0x92, 0x1A, 0xF0, 0x1E, 0x14, 0x2E, 0x0A,
+    0x56, 0x2C, 0x2F, 0xCA, 0x75, 0x69, 0xEA, 0xBE, 0xEC, 0xD9, 0x10, 0x02, 0x82, 0xF0, 0x73, 0x1D,
+    0xB8, 0xA2, 0x34, 0x91, 0x6B, 0xEA, 0x1E, 0xA0, 0x64, 0xA0, 0x74, 0xE8, 0xAA, 0xAD, 0x8A, 0x7E,
+    0x40, 0x5B, 0xD0, 0x64, 0xD9, 0x63, 0x80, 0xC9, 0xBB, 0x80, 0x2E, 0x1F, 0x54, 0xCE, 0x35, 0x1B,
+    0x71, 0x22, 0xFE, 0xFC, 0x25, 0x11, 0x0C, 0x15, 0x38, 0x37, 0xB1, 0xBE, 0x97, 0x0B, 0xBD, 0x74,
+    0xED, 0x23, 0xCF, 0x8D, 0x30, 0x0D, 0x3C, 0x3F, 0x3C, 0xA8, 0xDE, 0x24, 0x5A, 0x9C, 0x6F, 0xED,
+    0x16, 0x1B, 0x44, 0x7E, 0xFE, 0x00, 0x0A, 0x5B, 0x9E, 0xA7, 0x77, 0x37, 0xC6, 0xF9, 0xEA, 0x11,
+    0xC0, 0x52, 0xC4, 0x2C, 0x70, 0x24, 0x6E, 0x4E, 0x74, 0xCB, 0xB7, 0xB3, 0xAE, 0x2E, 0x68, 0x74,
+    0x6F, 0xAA, 0x51, 0x4D, 0x38, 0x0E, 0x2B, 0x1B, 0xD5, 0x46, 0x53, 0xBB, 0xCA, 0x3B, 0xB6, 0x5B,
+    0x3E, 0x6A, 0xB4, 0xD3, 0x66, 0xD1, 0xD6, 0x79, 0xB1, 0x6C, 0x2B, 0x5A, 0xF6, 0xB9, 0xBD, 0xD2,
+    0xB6, 0x1C, 0x42, 0xE0, 0xE9, 0xCB, 0x26, 0xFF, 0xC8, 0xE4, 0x30, 0xDB, 0x72, 0xCE, 0xB4, 0xEE,
+    0x68, 0x77, 0xB3, 0x0B, 0x5D, 0xDD, 0xE4, 0x6D, 0xF9, 0x93, 0x8F, 0x86, 0xC4, 0xC4, 0x7D, 0xD6,
+    0xA5, 0x9F, 0xB8, 0xF4, 0x8E, 0x8D, 0x6C, 0xAA, 0x53, 0x18, 0x65, 0x9F, 0xBD, 0xD2, 0x73, 0x3B,
+    0x31, 0x74, 0xBA, 0x50, 0x49, 0x1F, 0x0E, 0x59, 0x97, 0x30, 0xB7, 0x7B, 0x89, 0x09, 0xE7, 0x79,
+    0x07, 0xA7, 0x44, 0x64, 0xD3, 0x45, 0x3B, 0xE8, 0x97, 0xED, 0x48, 0x2F, 0xFB, 0xC4, 0xDD, 0x72,
+    0x6C, 0xDA, 0xC4, 0x7D, 0x34, 0x08, 0x4E, 0xCA, 0xAA, 0x68, 0xA4, 0x85, 0xD9, 0x53, 0x38, 0xC4,
+    0xC2, 0x03, 0xD0, 0x13, 0x31, 0x6F, 0xF3, 0x1A, 0x33, 0xC5, 0x70, 0xE6, 0xB9, 0x9E, 0x8F, 0x82,
+    0xDC, 0xF1, 0xD7, 0xDA, 0xB1, 0x2A, 0xDF, 0x75, 0x19, 0xAF, 0xCB, 0x79, 0x5D, 0xD6, 0xEB, 0xF2,
+    0x5E, 0x97, 0xF9, 0xBA, 0xDC, 0xD7, 0x65, 0xBF, 0x2E, 0xFF, 0x75, 0x1D, 0x1C, 0xD1, 0x03, 0x15,
+    0x5E, 0x17, 0xD5, 0xA8, 0x0B, 0x05, 0x3E, 0xEB, 0x61, 0xA1, 0x8F, 0x00, 0xFA, 0x88, 0xE6, 0xAE,
+    0x9A, 0x74, 0xE2, 0xA5, 0x9F, 0xB7, 0x93, 0x5E, 0xE0, 0xC8, 0xCD, 0x51, 0xDD, 0x88, 0xD6, 0xF4,
+    0xA4, 0x9F, 0x54, 0x47, 0x16, 0xBD, 0xCD, 0xA4, 0xA3, 0x0C, 0xCF, 0xAA, 0x15, 0x9D, 0x89, 0x9E,
+    0x96, 0xCF, 0x5E, 0x57, 0xCB, 0x67, 0xAF, 0xAF, 0xE5, 0xB3, 0xD7, 0xD9, 0x12, 0xDF, 0xA4, 0xB7,
+    0x91, 0xDE, 0xA8, 0xBB, 0x89, 0x9F, 0x49, 0x7F, 0xC2, 0xAF, 0xCE, 0xDB, 0x49, 0x87, 0x7E, 0x3E,
+    0x75, 0xB5, 0xD0, 0x63, 0xE9, 0xE7, 0x7B, 0x44, 0x97, 0x27, 0x0A, 0xE8, 0xAB, 0x48, 0x1D, 0xA5,
+    0x03, 0x65, 0x96, 0x7D, 0x78, 0xAE, 0x21, 0x11, 0x52, 0x15, 0xA9, 0x51, 0x9B, 0x2F, 0xB9, 0x36,
+    0x75, 0x70, 0x95, 0xE9, 0x10, 0xB9, 0x22, 0xB3, 0xB1, 0x43, 0x2F, 0x84, 0xD3, 0x5C, 0x27, 0x16,
+    0x3D, 0x41, 0x5F, 0x55, 0x70, 0xEB, 0x8A, 0x26, 0x1D, 0xC9, 0x88, 0xDA, 0xC8, 0x18, 0x78, 0x70,
+    0x1E, 0xE5, 0x5A, 0x1E, 0x17, 0xB8, 0x86, 0x47, 0xC2, 0x09, 0xF3, 0xD8, 0xD0, 0xC9, 0xE8, 0xC8,
+    0xCA, 0xF8, 0xA8, 0x17, 0x0C, 0x4B, 0x3B, 0x50, 0x96, 0xF2, 0x81, 0xB9, 0x8A, 0xE7, 0x14, 0x39,
+    0x18, 0x19, 0xE6, 0x04, 0xDB, 0x28, 0x28, 0x97, 0xE4, 0xC6, 0x82, 0xE5, 0x7C, 0x60, 0xD6, 0x19,
+    0x7F, 0x3C, 0x0F, 0x5C, 0x85, 0x5E, 0x88, 0x16, 0x0E, 0xF6, 0x44, 0x8C, 0x1A, 0x7D, 0xB3, 0x16,
+    0xBD, 0x39, 0x64, 0x8D, 0x23, 0xC0, 0x10, 0x8F, 0xE1, 0x09, 0x79, 0xAE, 0x64, 0x5C, 0xD9, 0xC9,
+    0x48, 0xA5, 0x65, 0x6C, 0xA6, 0xC9, 0x33, 0x26, 0xE3, 0x63, 0x23, 0x18, 0xC2, 0x85, 0xF9, 0x9E,
+    0x01, 0x75, 0x05, 0x8C, 0x35, 0x18, 0x45, 0x6E, 0x14, 0x0E, 0x96, 0x22, 0x33, 0xA7, 0x44, 0x97,
+    0x94, 0xB6, 0xAA, 0xCA, 0x9B, 0xAC, 0x51, 0x45, 0xDA, 0xD5, 0x14, 0x6B, 0xDA, 0x2A, 0x58, 0x86,
+    0x87, 0x14, 0x5A, 0x8A, 0x7B, 0x02, 0x62, 0x0C, 0xC4, 0xB2, 0xAA, 0x11, 0xAC, 0x34, 0x41, 0xAF,
+    0x58, 0x9E, 0x01, 0xD4, 0x51, 0x42, 0x3B, 0x05, 0x14, 0xF1, 0x7D, 0x56, 0x24, 0x65, 0x0D, 0x07,
+    0x47, 0xF4, 0x8F, 0xE6, 0x98, 0x74, 0x01, 0xC6, 0x70, 0x42, 0x56, 0xD1, 0x40, 0x58, 0xB6, 0x10,
+    0x74, 0x2E, 0x9A, 0x39, 0x25, 0x4A, 0xFC, 0x00, 0xE0, 0x8B, 0x04, 0x8D, 0x84, 0xA0, 0x0A, 0x61,
+    0xB0, 0xFA, 0x71, 0x03, 0x30, 0x78, 0x59, 0x17, 0xE1, 0x10, 0x0C, 0x21, 0x48, 0x60, 0x01, 0xF2,
+    0x9A, 0x87, 0x6D, 0xB0, 0x79, 0xA0, 0x89, 0x17, 0xE0, 0x3D, 0x14, 0x63, 0xA8, 0x5F, 0xE5, 0x90,
+    0xDA, 0xE6, 0xF7, 0xDA, 0xBC, 0xAB, 0x11, 0x71, 0x8B, 0x12, 0xF9, 0x0C, 0xA8, 0xD7, 0xA6, 0xD6,
+    0x09, 0x07, 0x4C, 0xD5, 0xE5, 0xAE, 0x55, 0xFA, 0x44, 0x51, 0xBF, 0x66, 0x60, 0x2F, 0xE1, 0x10,
+    0xF1, 0x38, 0x60, 0x01, 0x7B, 0x8C, 0x90, 0xC3, 0x2E, 0x10, 0x62, 0x46, 0xA0, 0x77, 0x43, 0x18,
+    0x05, 0x75, 0x61, 0x03, 0xF1, 0xB9, 0x15, 0xCE, 0x52, 0xFD, 0x1C, 0xF3, 0xC9, 0x39, 0x03, 0xCF,
+    0x19, 0xE1, 0x9A, 0x03, 0xBF, 0x00, 0xCB, 0x1C, 0xC3, 0x3C, 0x04, 0x90, 0x80, 0x0C, 0xA1, 0xD9,
+    0x83, 0x54, 0x80, 0x01, 0x3B, 0xBC, 0x64, 0x20, 0x1A, 0xF0, 0x9C, 0x6A, 0xA0, 0x48, 0x46, 0x60,
+    0x59, 0xD2, 0x00, 0x1D, 0x40, 0xC4, 0x00, 0x2B, 0xFC, 0xD2, 0xCA, 0xEA, 0x9F, 0xED, 0xD3, 0x0D,
+    0x58, 0x36, 0xB0, 0x08, 0x21, 0x21, 0x29, 0xD4, 0x04, 0x29, 0x5C, 0xC2, 0xC9, 0xC9, 0x8D, 0xD5,
+    0xEE, 0x2E, 0x96, 0x9A, 0xE4, 0x99, 0x6A, 0xFE, 0xA2, 0xD3, 0x54, 0xF7, 0x6C, 0x85, 0xD0, 0x74,
+    0x0A, 0xA7, 0x7D, 0xDF, 0xBD, 0xE6, 0x68, 0xF6, 0x77, 0x86, 0xB0, 0x47, 0x86, 0xA1, 0x4B, 0x05,
+    0x66, 0x03, 0xFB, 0xC0, 0x9C, 0x7D, 0xF0, 0xBC, 0xD4, 0xDC, 0x96, 0x4C, 0xD5, 0xB1, 0x83, 0x26,
+    0x9F, 0xB4, 0xFA, 0x45, 0xE7, 0xA1, 0xF7, 0x8C, 0x97, 0x8E, 0x79, 0xD1, 0x1B, 0x0C, 0x31, 0x77,
+    0x59, 0x41, 0xEC, 0xDE, 0x52, 0x81, 0x89, 0xBC, 0x89, 0xE6, 0x63, 0xBA, 0xE4, 0x53, 0xDF, 0xEB,
+    0x8B, 0xE4, 0xFD, 0xDA, 0x05, 0xF9, 0x10, 0x57, 0x99, 0x10, 0xCA, 0x59, 0x1A, 0x42, 0x8A, 0x6D,
+    0x47, 0x52, 0x32, 0xE5, 0x0E, 0x50, 0x5E, 0x40, 0x10, 0x18, 0xF2, 0x99, 0x98, 0xB0, 0x7B, 0x50,
+    0xAC, 0x52, 0x3E, 0xE3, 0x1C, 0x97, 0x00, 0xFC, 0xDD, 0xED, 0x8F, 0x35, 0x00, 0xC4, 0xE8, 0xFE,
+    0x41, 0xF4, 0x06, 0x96, 0x96, 0x98, 0xFE, 0x95, 0xD6, 0xE3, 0x8F, 0xCC, 0xF3, 0x7E, 0x10, 0x5B,
+    0x9E, 0x34, 0x2F, 0x2E, 0xE6, 0xC4, 0x8E, 0x4F, 0xFC, 0x7A, 0xC4, 0xCE, 0x3B, 0x61, 0x6F, 0x90,
+    0x16, 0xC2, 0xD3, 0x63, 0xBA, 0x69, 0x6F, 0x45, 0xE8, 0xC6, 0xA2, 0xCA, 0xB9, 0xCB, 0xC5, 0x8C,
+    0xBB, 0xF1, 0x30, 0x03, 0x04, 0x48, 0xB7, 0x5B, 0x60, 0x43, 0x6F, 0x3C, 0x18, 0xC6, 0x76, 0x8B,
+    0xB1, 0x5D, 0x64, 0x6C, 0x39, 0x63, 0x13, 0xFC, 0xF4, 0xDE, 0x34, 0x93, 0xF9, 0xD4, 0x18, 0x9D,
+    0x5C, 0x54, 0xDD, 0x92, 0x52, 0x08, 0x76, 0x72, 0x2B, 0x17, 0xEF, 0x94, 0x0E, 0x6F, 0xBB, 0xD6,
+    0x8B, 0x58, 0x26, 0x8B, 0xE3, 0xAC, 0x1B, 0x63, 0xCD, 0x15, 0x2F, 0x1E, 0xC8, 0xFD, 0x37, 0x4E,
+    0x7C, 0x46, 0x6A, 0x7F, 0x54, 0xCB, 0xB7, 0xB8, 0xBB, 0x95, 0xC9, 0xF0, 0x88, 0x6C, 0x58, 0xAC,
+    0x92, 0x98, 0x5D, 0x07, 0xD1, 0xF3, 0xA0, 0x11, 0xF3, 0x3C, 0x40, 0xE3, 0x99, 0x48, 0x3F, 0x43,
+    0x45, 0x5E, 0x9D, 0x7C, 0x3E, 0xD2, 0x17, 0xC8, 0x64, 0x95, 0x56, 0x77, 0xFE, 0xEA, 0x82, 0x79,
+    0xFA, 0xAA, 0x29, 0xFF, 0xF5, 0x17, 0x17, 0xBA, 0xDF, 0x2A, 0x7B, 0x96, 0x15, 0x81, 0xD4, 0xF8,
+    0x2E, 0xE5, 0x73, 0x1F, 0x3E, 0x67, 0xF2, 0x00, 0x8E, 0xCA, 0x07, 0x1F, 0xBB, 0x97, 0xDD, 0xC7,
+    0xA5, 0x55, 0xBF, 0xFF, 0x1B, 0xFC, 0x65, 0x9A, 0xF4, 0x79, 0xA4, 0x2F, 0x52, 0x9F, 0xBD, 0xA8,
+    0x9F, 0x8D, 0xF4, 0xB3, 0xB4, 0x93, 0x55, 0x27, 0xBD, 0x8A, 0x79, 0x3E, 0x22, 0x3C, 0x78, 0xBA,
+    0xD3, 0xBB, 0x97, 0x8E, 0x96, 0x77, 0xFD, 0xF9, 0x83, 0x1B, 0x93, 0xE4, 0xB7, 0x17, 0x92, 0xEF,
+    0x17, 0x92, 0xEF, 0x16, 0x0A, 0xAA, 0x3E, 0xEF, 0x6E, 0xE0, 0xA4, 0x74, 0xB6, 0x74, 0x3F, 0x2D,
+    0x2D, 0x95, 0x3D, 0x95, 0xE6, 0x69, 0x27, 0x77, 0xB6, 0x4F, 0xEF, 0xD9, 0xCB, 0x39, 0x47, 0x3A,
+    0x6A, 0x95, 0xB3, 0x97, 0x0F, 0xAE, 0xD7, 0xCE, 0xBE, 0x0E, 0xBB, 0x05, 0x19, 0xF5, 0xF4, 0xB3,
+    0xE6, 0x1A, 0xE3, 0x3F, 0xEA, 0x89, 0x33, 0x90, 0xCE, 0xE5, 0x6A, 0x29, 0x0C, 0x67, 0x51, 0x41,
+    0x6B, 0xF3, 0x82, 0x32, 0x2E, 0x91, 0xB1, 0x66, 0xB4, 0xB8, 0x34, 0xC4, 0x04, 0x44, 0xD1, 0x1A,
+    0x35, 0x46, 0xE5, 0x3A, 0x3C, 0xD6, 0xC8, 0x16, 0x1A, 0xC4, 0x19, 0xB8, 0x39, 0x84, 0x97, 0x16,
+    0x01, 0xD9, 0x35, 0x33, 0x44, 0xE6, 0xEE, 0x0C, 0xB7, 0xD8, 0x7B, 0x70, 0x41, 0xE5, 0x5B, 0x5C,
+    0xBA, 0xB1, 0xBB, 0x90, 0x47, 0x71, 0x01, 0xF2, 0xC8, 0x4E, 0xC6, 0x03, 0xC5, 0xCB, 0xA4, 0x64,
+    0x2E, 0x40, 0xCD, 0x0F, 0x48, 0xB8, 0x47, 0xC2, 0xB6, 0x98, 0xF5, 0x62, 0xE7, 0xDC, 0x97, 0x6D,
+    0x56, 0x6C, 0x44, 0x22, 0x72, 0xDC, 0x4D, 0x2D, 0xC9, 0xDD, 0x4E, 0x14, 0xF4, 0xE8, 0x63, 0xC6,
+    0xCB, 0x61, 0x8B, 0x35, 0x98, 0x31, 0x1D, 0xA5, 0x27, 0x8A, 0xB5, 0x59, 0xB4, 0xFA, 0x05, 0x17,
+    0xB2, 0x6C, 0xC5, 0xE6, 0x65, 0xA9, 0x14, 0x52, 0x71, 0x1D, 0x15, 0x4F, 0xDD, 0x8B, 0x6C, 0xEA,
+    0x5E, 0x04, 0x53, 0xF7, 0x22, 0x15, 0x94, 0x64, 0x2C, 0x12, 0x04, 0x15, 0x96, 0x87, 0xD2, 0x22,
+    0x0C, 0x25, 0xD3, 0x19, 0x6F, 0x2D, 0xDF, 0xA4, 0x32, 0x13, 0x01, 0x30, 0x7E, 0x8E, 0xF5, 0x9D,
+    0x4C, 0x1D, 0x11, 0x9D, 0xE7, 0x8D, 0x1B, 0x4F, 0x1A, 0xB3, 0xE2, 0x19, 0xE3, 0x16, 0x8F, 0xB7,
+    0x4E, 0x6E, 0x63, 0x62, 0x73, 0x7C, 0x7E, 0x98, 0x1E, 0x4F, 0x0E, 0xA8, 0x79, 0x16, 0xA5, 0xF8,
+    0xF7, 0xD1, 0xCD, 0xF3, 0x94, 0x78, 0x42, 0x4C, 0xA8, 0x58, 0x99, 0x0C, 0xEA, 0xCA, 0x2B, 0x50,
+    0x92, 0x42, 0xC2, 0x80, 0xBC, 0x96, 0xB3, 0x88, 0x97, 0x90, 0x45, 0xD8, 0x0C, 0xF1, 0x51, 0xE3,
+    0x06, 0x83, 0x33, 0xB9, 0x85, 0x03, 0x53, 0x7D, 0xD6, 0x23, 0x1E, 0x2B, 0x2B, 0x8A, 0x28, 0xFB,
+    0x74, 0xBC, 0xB1, 0x8C, 0x9C, 0xE1, 0x5B, 0xE0, 0x24, 0x59, 0xE3, 0x4C, 0x4A, 0xCB, 0x9C, 0x98,
+    0x77, 0x08, 0x17, 0x37, 0x64, 0x21, 0x3C, 0x85, 0xC0, 0x7A, 0x75, 0x59, 0xBF, 0xA8, 0xAC, 0xA4,
+    0xAB, 0xC7, 0x43, 0x05, 0xCF, 0xE4, 0x86, 0xA8, 0x89, 0xC3, 0x05, 0x78, 0x67, 0x63, 0x01, 0x9F,
+    0x7C, 0xCB, 0xFD, 0x13, 0xE8, 0x49, 0xC8, 0x28, 0x68, 0x11, 0xDF, 0xB6, 0x77, 0xE8, 0x4B, 0x1F,
+    0xB0, 0x73, 0x47, 0x69, 0x3D, 0x6E, 0xF0, 0x78, 0x90, 0x71, 0x2C, 0x89, 0x9D, 0x7B, 0x88, 0x4C,
+    0xF6, 0x92, 0x38, 0xE5, 0x78, 0xB9, 0xA2, 0x19, 0x88, 0xEB, 0x97, 0x8C, 0x5B, 0x52, 0x42, 0x01,
+    0x7B, 0x0C, 0x24, 0xCB, 0xB6, 0x13, 0x08, 0xC4, 0x23, 0x98, 0xC9, 0xB3, 0xAF, 0x60, 0x6A, 0x27,
+    0x4C, 0x02, 0xCE, 0x14, 0xA8, 0xAE, 0x0F, 0xDE, 0x2B, 0xD8, 0x05, 0xC2, 0x3E, 0xBE, 0xC1, 0xF1,
+    0x06, 0x53, 0x47, 0xE4, 0x2D, 0x88, 0x61, 0x25, 0xB0, 0x79, 0x22, 0xF4, 0x7D, 0x38, 0xB1, 0xE6,
+    0x62, 0x03, 0xB0, 0x67, 0xF8, 0xCF, 0x82, 0x61, 0x45, 0x9F, 0x0B, 0x0C, 0x2D, 0x2F, 0xAC, 0x92,
+    0x13, 0x4F, 0xAA, 0x05, 0x8E, 0xC7, 0xE9, 0xDD, 0xDD, 0x5D, 0x58, 0x25, 0x27, 0x0E, 0xE0, 0xE6,
+    0xE6, 0x67, 0x70, 0xE4, 0x16, 0xC2, 0x53, 0x02, 0xCB, 0xC7, 0x40, 0xB5, 0x02, 0x33, 0xC0, 0x0E,
+    0xBA, 0x94, 0xD4, 0x83, 0x85, 0x52, 0x09, 0x4A, 0x62, 0x3D, 0x75, 0x74, 0x76, 0x7E, 0x93, 0x53,
+    0x09, 0x24, 0x2F, 0x6E, 0x15, 0x16, 0x02, 0xAB, 0x63, 0xD0, 0xBF, 0x87, 0x3C, 0xB9, 0x0C, 0x13,
+    0x4D, 0x0B, 0xDC, 0x97, 0x58, 0x35, 0xC6, 0x29, 0x56, 0xCD, 0x73, 0x91, 0xFE, 0x0A, 0xA9, 0x77,
+    0x3A, 0x74, 0xBA, 0xFF, 0x27, 0x07, 0x1B, 0x67, 0x41, 0x5E, 0x81, 0x43, 0xC3, 0xDA, 0xDD, 0xC7,
+    0x90, 0x7B, 0xCE, 0x7F, 0x40, 0x97, 0x43, 0xDF, 0xD9, 0xFB, 0x14, 0x41, 0x70, 0x42, 0xAA, 0x5A,
+    0x94, 0x5D, 0x7D, 0x09, 0x57, 0xAD, 0xCC, 0xAC, 0x38, 0x6E, 0xA3, 0x99, 0x51, 0x56, 0x59, 0x2C,
+    0xF4, 0x56, 0x21, 0x26, 0x20, 0xB5, 0xEF, 0x61, 0x2F, 0x5F, 0x58, 0x56, 0x79, 0x9C, 0x6D, 0x49,
+    0x18, 0x86, 0x6C, 0xEB, 0xCF, 0x76, 0x6B, 0x6F, 0xB1, 0xE1, 0xDC, 0x3B, 0xB1, 0xB2, 0x92, 0x88,
+    0x8B, 0x9C, 0xBA, 0x98, 0xBC, 0xD9, 0xE7, 0x75, 0x88, 0x3D, 0xC7, 0x3A, 0xF7, 0xF4, 0x64, 0x67,
+    0x4A, 0x35, 0x9C, 0xE2, 0x86, 0x5C, 0x73, 0xDC, 0x0D, 0xAE, 0xF0, 0xDE, 0x16, 0xF8, 0x6C, 0xC5,
+    0xAF, 0x49, 0x8E, 0x10, 0x5C, 0x1A, 0x83, 0xFF, 0x26, 0x05, 0xBA, 0x69, 0x7C, 0x49, 0x17, 0x37,
+    0xAA, 0x4F, 0x1B, 0xF8, 0x2C, 0x24, 0xD9, 0x79, 0xA1, 0x7A, 0x54, 0x58, 0xDD, 0xF6, 0xB8, 0x6E,
+    0xAD, 0x0F, 0xE1, 0xBC, 0x5E, 0x99, 0x5A, 0x34, 0x6E, 0x20, 0xF2, 0x0A, 0xE5, 0x2B, 0x2B, 0xBC,
+    0x60, 0xF8, 0xBA, 0x3A, 0x76, 0x67, 0x7F, 0x64, 0xCE, 0x54, 0x91, 0x2E, 0x75, 0xA4, 0x6B, 0x13,
+    0x77, 0x0E, 0x49, 0x1A, 0x2A, 0x86, 0x86, 0x0B, 0xA2, 0x00, 0xD9, 0x2F, 0x3E, 0x27, 0xAE, 0x0D,
+    0x4C, 0xE6, 0x4C, 0x68, 0x54, 0x38, 0x8F, 0xF4, 0x36, 0xD5, 0xF7, 0xBA, 0x8B, 0x10, 0x5F, 0x73,
+    0x15, 0xE2, 0x5C, 0xB7, 0x92, 0x2B, 0x3E, 0x07, 0x63, 0x23, 0x60, 0x67, 0x55, 0x3E, 0xD8, 0x7D,
+    0x1D, 0x52, 0x0E, 0xB9, 0x8D, 0x32, 0xD8, 0x17, 0x6E, 0x87, 0x94, 0xF9, 0x5D, 0x84, 0xE2, 0x6B,
+    0x72, 0x0F, 0x2B, 0xEF, 0x68, 0x5E, 0x64, 0xE6, 0x3F, 0xEC, 0x5F, 0x80, 0xB9, 0x18, 0x54, 0x5B,
+    0xFD, 0x27, 0x18, 0x35, 0x7C, 0xCA, 0x0E, 0x1C, 0x2E, 0x62, 0xEF, 0xE7, 0xEE, 0x8D, 0x4E, 0x96,
+    0x8F, 0x80, 0x93, 0x99, 0xAB, 0x76, 0xA8, 0x7E, 0xD8, 0x61, 0x11, 0x7F, 0x6A, 0xE1, 0x1C, 0x0D,
+    0x2A, 0x91, 0xDF, 0xF5, 0xC8, 0x22, 0x7F, 0xDC, 0x9F, 0xE2, 0x95, 0xBD, 0x12, 0xB9, 0x24, 0x63,
+    0x5D, 0x44, 0xBC, 0x25, 0x90, 0x77, 0x33, 0xBF, 0x05, 0x9D, 0xB1, 0x43, 0xE3, 0x8D, 0x48, 0x1F,
+    0x8D, 0x4B, 0xE9, 0xD4, 0xCB, 0x56, 0xC7, 0x7A, 0x40, 0xCD, 0xFB, 0xE3, 0xA8, 0x38, 0x2B, 0x87,
+    0xBC, 0xC6, 0x3A, 0x39, 0x1F, 0xC6, 0x4A, 0x19, 0x7A, 0xF2, 0x55, 0xA9, 0x32, 0x63, 0xB5, 0x5C,
+    0xEA, 0xB1, 0x5E, 0x2E, 0xDB, 0xB1, 0x62, 0xAE, 0x9B, 0xB1, 0x66, 0x76, 0x53, 0xD5, 0x3C, 0x9F,
+    0xEA, 0x66, 0x7B, 0x44, 0xB4, 0x5E, 0xD4, 0xA9, 0x4F, 0x59, 0x72, 0xFF, 0x2D, 0x1F, 0x56, 0x6F,
+    0x99, 0x7F, 0x39, 0xBB, 0xB6, 0xBA, 0x53, 0x03, 0x43, 0xE8, 0x65, 0x2A, 0xF0, 0x6F, 0x3C, 0x2D,
+    0xBE, 0xF9, 0x27, 0x9E, 0x2E, 0x6E, 0x3C, 0xF5, 0x70, 0x25, 0x11, 0x1A, 0x87, 0x67, 0x8F, 0xA2,
+    0x30, 0x92, 0x1D, 0x99, 0x58, 0xCD, 0x11, 0x72, 0x8E, 0xED, 0xC3, 0xE3, 0x09, 0x25, 0x73, 0xDA,
+    0x82, 0xF4, 0x82, 0x95, 0xBF, 0x26, 0x12, 0xF3, 0x78, 0x42, 0xE3, 0xCB, 0xB1, 0x8B, 0xDF, 0xE0,
+    0xF6, 0xC3, 0x47, 0x64, 0xE5, 0x11, 0x42, 0x23, 0xD9, 0x91, 0x89, 0x60, 0xE2, 0x2D, 0xEB, 0x26,
+    0x77, 0xB6, 0xBA, 0xFB, 0xF4, 0xA8, 0x63, 0x6B, 0x5F, 0x99, 0x12, 0x7D, 0x55, 0x9F, 0xEB, 0xE0,
+    0x18, 0x8B, 0x4F, 0x92, 0x76, 0xDC, 0x3D, 0xC5, 0x19, 0x49, 0xDA, 0xB2, 0x23, 0xD9, 0x17, 0x78,
+    0x2B, 0x1F, 0x29, 0x20, 0x2D, 0x29, 0xDF, 0xCC, 0xF7, 0x7C, 0xF2, 0xF1, 0x5F, 0xAA, 0x67, 0x74,
+    0xCD, 0xC5, 0x55, 0x94, 0x37, 0x58, 0xB2, 0x21, 0xEF, 0x8B, 0x5C, 0x95, 0xDD, 0x11, 0x6E, 0xFB,
+    0xF7, 0xDE, 0x1F, 0xAC, 0xC2, 0xDD, 0xDD, 0x43, 0x84, 0x2B, 0xF9, 0xB7, 0x68, 0x84, 0xBB, 0xBB,
+    0x7B, 0x1C, 0xC0, 0x8E, 0xF5, 0x04, 0x06, 0x78, 0x89, 0xE3, 0x98, 0x15, 0xBE, 0xDE, 0x7E, 0x8C,
+    0x0A, 0x4E, 0x14, 0xBC, 0x2F, 0x2F, 0x6F, 0xF5, 0x32, 0xCE, 0xAC, 0xAB, 0x00, 0x23, 0x0D, 0x1C,
+    0x1C, 0x9E, 0x58, 0x82, 0x49, 0xEB, 0x9F, 0x94, 0x61, 0x3B, 0x98, 0x01, 0x83, 0x7F, 0xCA, 0x3A,
+    0xFF, 0xC7, 0x80, 0x7C, 0x35, 0x19, 0x46, 0xF2, 0x2E, 0xF4, 0x83, 0x6A, 0x75, 0xEB, 0xF8, 0xF4,
+    0x27, 0xC5, 0x46, 0xF7, 0xCF, 0xDB, 0x37, 0x69, 0x79, 0xBE, 0xB5, 0xB9, 0x2D, 0x6E, 0x85, 0x34,
+    0x94, 0x33, 0x0E, 0xB6, 0x6F, 0x38, 0x04, 0x5E, 0x94, 0x1B, 0xFC, 0xBB, 0x82, 0x18, 0x06, 0x86,
+    0x31, 0xC3, 0x0E, 0x79, 0xB5, 0xF0, 0xFF, 0x34, 0x1B, 0xFB, 0x5B, 0x15, 0xDC, 0x26, 0xEF, 0xD3,
+    0x85, 0xB8, 0x7A, 0x21, 0x6A, 0xD2, 0xEF, 0x31, 0x95, 0x4D, 0x71, 0x5E, 0x76, 0x74, 0xFE, 0xE8,
+    0x9B, 0x0D, 0x2A, 0xF4, 0xDF, 0xED, 0x55, 0x3D, 0x8F, 0xDC, 0x44, 0x18, 0x7E, 0xEC, 0x3D, 0xD6,
+    0x52, 0x46, 0x68, 0xAE, 0xD9, 0x86, 0xC6, 0x0D, 0x0D, 0x88, 0x30, 0x35, 0xD2, 0xDD, 0x79, 0xC2,
+    0x2F, 0xB8, 0x22, 0x2B, 0x0A, 0x0A, 0x6A, 0x56, 0x48, 0xDB, 0x50, 0x50, 0x44, 0x9A, 0x11, 0xBF,
+    0xE0, 0x7E, 0x02, 0x45, 0x8A, 0x9C, 0x8B, 0x40, 0x11, 0x0A, 0x4E, 0xCA, 0x8E, 0x53, 0xD3, 0xF8,
+    0x27, 0x18, 0x74, 0xA2, 0xB9, 0x22, 0x83, 0x30, 0x8A, 0xA5, 0xB3, 0x3D, 0x3C, 0xE3, 0xD5, 0x71,
+    0x9B, 0xE4, 0x2E, 0x69, 0x28, 0x28, 0xE2, 0x9D, 0xC7, 0x3B, 0x5F, 0x7E, 0xE7, 0xFD, 0x7A, 0xDE,
+    0xC1, 0xFA, 0x1C, 0xB3, 0x10, 0x20, 0x5A, 0x63, 0x73, 0xAF, 0x2A, 0xD5, 0xE4, 0x4D, 0x51, 0xE7,
+    0xFE, 0x36, 0xA8, 0x46, 0xD5, 0xD2, 0x17, 0x95, 0xE8, 0x9C, 0x4D, 0xC3, 0x08, 0x7C, 0xFC, 0x03,
+    0xF8, 0x64, 0x1E, 0xB2, 0x85, 0xF0, 0xD8, 0x3E, 0xCE, 0x43, 0xF9, 0x38, 0xBC, 0xB1, 0xC9, 0x0E,
+    0x2E, 0x6C, 0x37, 0x9E, 0x02, 0xB3, 0x01, 0x10, 0x44, 0x4E, 0x1C, 0x12, 0x3F, 0x0F, 0x48, 0x7E,
+    0x1B, 0x30, 0x7B, 0x36, 0x40, 0xDE, 0x1B, 0xF0, 0x69, 0x32, 0xC0, 0x84, 0xD0, 0x46, 0x80, 0xFD,
+    0x09, 0x29, 0x3F, 0x2F, 0x82, 0xC7, 0x62, 0x79, 0x7C, 0xA7, 0x7C, 0x84, 0x3C, 0x0C, 0x13, 0x54,
+    0xF9, 0x14, 0x77, 0xF1, 0x3E, 0x0E, 0x28, 0xF9, 0x60, 0x11, 0xB7, 0xB4, 0x28, 0x7E, 0x1C, 0xB7,
+    0xFB, 0x11, 0xF4, 0x1E, 0xF1, 0x80, 0x18, 0x92, 0x00, 0xF7, 0xC5, 0x30, 0xAD, 0xCF, 0x4B, 0x0D,
+    0xA8, 0x16, 0xE9, 0x38, 0x42, 0x34, 0x06, 0xB2, 0x3A, 0x82, 0xD2, 0xFB, 0x28, 0x38, 0x5D, 0xBC,
+    0xA7, 0x79, 0x76, 0x07, 0x63, 0x47, 0x98, 0xE9, 0x57, 0xE8, 0x88, 0xF8, 0x53, 0x15, 0xF7, 0xD6,
+    0x23, 0x9D, 0xD7, 0x01, 0x2B, 0x8B, 0x55, 0x59, 0xD2, 0xAA, 0xA0, 0x23, 0x36, 0xA5, 0xC3, 0x13,
+    0x1C, 0xE1, 0x27, 0x3C, 0xE0, 0xB9, 0x3D, 0x75, 0x6E, 0x69, 0x27, 0x9D, 0x23, 0x6A, 0xF0, 0x00,
+    0x9E, 0x67, 0x29, 0x9C, 0x4B, 0xE3, 0xD6, 0x9C, 0x59, 0xDC, 0x72, 0xCC, 0xF1, 0xBA, 0x8B, 0xC1,
+    0xB0, 0xD2, 0xAB, 0x3A, 0x67, 0x20, 0x72, 0x4F, 0xB4, 0xAA, 0x92, 0xA3, 0xD3, 0x69, 0x3C, 0x87,
+    0x6E, 0xCB, 0x2E, 0x03, 0xD7, 0x0C, 0x43, 0x20, 0xFF, 0x05, 0xC3, 0x52, 0x67, 0x3C, 0x17, 0xAB,
+    0x87, 0x48, 0x9C, 0x85, 0xA0, 0x5D, 0xAA, 0xA2, 0x7D, 0xDA, 0x5D, 0xEB, 0x1D, 0xB5, 0xB6, 0x46,
+    0xAB, 0x3F, 0x82, 0x16, 0xC1, 0x68, 0xEC, 0x47, 0x05, 0x0C, 0xB1, 0xC1, 0x27, 0xD4, 0xF1, 0x30,
+    0x6D, 0x91, 0x3F, 0xAF, 0x31, 0x67, 0x48, 0xB0, 0x47, 0x1C, 0xBD, 0x8E, 0x10, 0x42, 0x15, 0xB1,
+    0x34, 0x4B, 0xFD, 0xDA, 0xFA, 0x47, 0x3B, 0xEB, 0xCB, 0xA5, 0xBE, 0xEA, 0x97, 0x65, 0x69, 0xB1,
+    0xF3, 0x5C, 0xCD, 0x5F, 0x8D, 0x05, 0x5D, 0x8C, 0xB4, 0x8F, 0x79, 0x91, 0xD7, 0x28, 0x2A, 0x14,
+    0x96, 0xFE, 0x06, 0x15, 0x74, 0x3B, 0x8D, 0x43, 0x4E, 0xC6, 0xD5, 0x0A, 0x79, 0xC3, 0x6C, 0x9D,
+    0xFC, 0xA6, 0x34, 0x52, 0x86, 0x09, 0x9F, 0xB1, 0x5B, 0xC5, 0xC9, 0x94, 0x93, 0x0C, 0xB5, 0xDB,
+    0xD9, 0xFD, 0x6A, 0x9B, 0x44, 0x73, 0x0F, 0x33, 0xAC, 0x83, 0x6C, 0x62, 0x9C, 0x3F, 0xDC, 0x6A,
+    0x62, 0x7E, 0x0F, 0x3A, 0xA7, 0x77, 0x45, 0x9F, 0x37, 0xA2, 0x95, 0x5E, 0xF8, 0x9B, 0x21, 0xB9,
+    0xE6, 0x82, 0x1C, 0xA7, 0x8F, 0xFE, 0x0B, 0xFA, 0x7C, 0x40, 0x13, 0x6D, 0x16, 0x6C, 0x61, 0xEC,
+    0x21, 0xF5, 0x7B, 0x43, 0x73, 0xB5, 0x0A, 0x61, 0xB1, 0x5C, 0xCE, 0xC3, 0x09, 0x54, 0xE8, 0x51,
+    0x7C, 0x4F, 0x72, 0xDC, 0x1B, 0xA1, 0x68, 0x51, 0x92, 0xC4, 0x44, 0x67, 0x26, 0xCD, 0xDA, 0x6D,
+    0xA2, 0xD1, 0x3B, 0x78, 0x1A, 0xF3, 0x2E, 0xD5, 0xD2, 0xCE, 0xB4, 0x59, 0x7E, 0xA5, 0xAF, 0x12,
+    0x94, 0x01, 0x22, 0x27, 0x4E, 0x48, 0x9A, 0x6E, 0x2B, 0x83, 0x84, 0x50, 0x3B, 0xD9, 0x98, 0xB8,
+    0x1A, 0x49, 0x38, 0xA7, 0xBC, 0x68, 0x65, 0x24, 0x8F, 0xD3, 0xDF, 0x12, 0x1D, 0xFB, 0x9B, 0xEC,
+    0x8A, 0x38, 0xEF, 0x08, 0xFC, 0x8E, 0xC0, 0xFF, 0x17, 0x02, 0x27, 0x1B, 0x8B, 0xFC, 0x82, 0xD9,
+    0xF2, 0x79, 0x8F, 0x3C, 0xE9, 0xA7, 0xB0, 0x24, 0x5F, 0x32, 0xA3, 0x2E, 0x23, 0x43, 0x06, 0x04,
+    0x8E, 0x03, 0xA5, 0xBB, 0x98, 0xBD, 0x43, 0xB0, 0xA2, 0x59, 0xD9, 0xE4, 0xB1, 0x96, 0xA1, 0x2D,
+    0x9E, 0xF5, 0x46, 0x8F, 0x8E, 0x76, 0x95, 0x21, 0x3E, 0x3C, 0x9D, 0x6E, 0xD5, 0x7B, 0x45, 0x7D,
+    0x57, 0x86, 0x3E, 0x71, 0x27, 0xC9, 0x63, 0x0B, 0x79, 0x49, 0xA2, 0xC4, 0x24, 0x62, 0x18, 0x1C,
+    0x7B, 0x61, 0x8B, 0x2A, 0xFE, 0xC7, 0x71, 0x9C, 0x8F, 0x33, 0xF2, 0x32, 0x92, 0xE7, 0x84, 0x79,
+    0xBD, 0xB8, 0x5F, 0x84, 0xBC, 0xCB, 0xFA, 0xAC, 0x4A, 0x46, 0x49, 0x99, 0xDF, 0x20, 0x5E, 0x89,
+    0x90, 0x84, 0xA2, 0x7A, 0x4F, 0x48, 0xD8, 0xBA, 0xB0, 0x19, 0x2B, 0x86, 0x39, 0x77, 0xC3, 0xEA,
+    0x61, 0x79, 0x3A, 0x3F, 0xD3, 0x2A, 0x34, 0xDF, 0x65, 0xFD, 0x7E, 0x74, 0x0D, 0x33, 0x2B, 0x94,
+    0xE5, 0xA4, 0x14, 0xA8, 0xDD, 0x40, 0xC3, 0xF2, 0xE7, 0x3E, 0xDD, 0xE8, 0x15, 0x2B, 0x86, 0x89,
+    0xA9, 0xF8, 0x12, 0xCE, 0x20, 0x5E, 0x84, 0x4A, 0x0C, 0xAA, 0x11, 0x1D, 0xCB, 0xD4, 0x6D, 0xE5,
+    0x8B, 0xF3, 0xEB, 0x51, 0x0E, 0xAB, 0x72, 0x7E, 0x7A, 0xB3, 0x9C, 0xE5, 0x7D, 0xE1, 0x4D, 0x2B,
+    0x7C, 0xAE, 0x85, 0x3F, 0xE4, 0x98, 0x97, 0xFA, 0x5F, 0xBC, 0xB4, 0x59, 0x6B, 0x44, 0xE4, 0x97,
+    0x67, 0xEE, 0xC5, 0xF2, 0xD5, 0x2A, 0xCA, 0x11, 0x94, 0x83, 0xAF, 0x29, 0xC7, 0xDC, 0x7E, 0xD7,
+    0xBF, 0xDA, 0x5A, 0xAC, 0x47, 0x52, 0x0D, 0x8B, 0xE3, 0x4D, 0xF2, 0x0B, 0xCC, 0x8B, 0xF0, 0xEB,
+    0xA4, 0x75, 0x5F, 0xD4, 0xD4, 0xBB, 0x95, 0x53, 0xE1, 0xE5, 0xDB, 0xBF, 0xF5, 0x3D, 0xD9, 0x21,
+    0xBB, 0x68, 0xC9, 0x9D, 0x47, 0x8B, 0xE3, 0xB3, 0x28, 0xEB, 0xED, 0xF6, 0xFB, 0x6B, 0xFB, 0x17,
+    0xFA, 0x14, 0xE6, 0x22, 0x54, 0x72, 0x2A, 0xF7, 0x82, 0x6B, 0x19, 0xDF, 0xB3, 0xEE, 0x1A, 0x1C,
+    0xC7, 0xF9, 0x9E, 0xDF, 0x5D, 0x52, 0xF6, 0x9F, 0xE3, 0x4B, 0xBE, 0x5A, 0x0F, 0x91, 0xCE, 0x1A,
+    0x49, 0xA9, 0xE5, 0x85, 0x57, 0x49, 0x5B, 0x80, 0xA5, 0x1F, 0x6A, 0x24, 0x3B, 0x1B, 0xB8, 0x6E,
+    0x2F, 0xEB, 0x0F, 0xD0, 0x1F, 0xA1, 0x2B, 0x2E, 0xFC, 0x7C, 0x24, 0x5D, 0x01, 0x8F, 0x94, 0x2E,
+    0xF8, 0x9B, 0x25, 0xA6, 0x7A, 0x83, 0x83, 0x66, 0xA1, 0xC6, 0xC6, 0xFE, 0x03, 0xA5, 0x58, 0x3D,
+    0x90, 0xDD, 0xD4, 0x15, 0xBE, 0x92, 0xF0, 0x8A, 0xF0, 0x0A, 0xB9, 0xB0, 0x67, 0x18, 0xC8, 0xAC,
+    0x28, 0xA8, 0x48, 0x6C, 0xB5, 0x29, 0x76, 0x2D, 0x91, 0x14, 0x14, 0x29, 0xB2, 0x85, 0xD7, 0x14,
+    0x29, 0xDC, 0xA4, 0x89, 0x53, 0xB8, 0x75, 0x66, 0xCC, 0x48, 0x19, 0xCA, 0x14, 0xD9, 0x14, 0x54,
+    0x69, 0x5C, 0x90, 0x19, 0xBC, 0x2E, 0x36, 0xC5, 0x16, 0x2E, 0x16, 0xEB, 0x19, 0x4F, 0x26, 0x45,
+    0x0A, 0x3F, 0xC8, 0x40, 0x0A, 0x8A, 0x88, 0x1F, 0x0F, 0x03, 0x14, 0x08, 0x10, 0xA0, 0xDD, 0x95,
+    0x74, 0xF2, 0x7D, 0xE7, 0x48, 0x6F, 0x77, 0xF9, 0x0D, 0x44, 0xF3, 0xE6, 0x9C, 0xF3, 0xA4, 0xFB,
+    0x73, 0xEE, 0x3D, 0xE7, 0x7C, 0xE7, 0xDC, 0xEB, 0x9C, 0x3D, 0x8F, 0x4B, 0x4B, 0x26, 0x22, 0x99,
+    0x73, 0xA1, 0x3C, 0x2D, 0x73, 0xE7, 0xA2, 0xCE, 0x95, 0x60, 0x49, 0xE3, 0x72, 0xBC, 0x4C, 0x6B,
+    0x77, 0x06, 0x2D, 0xF2, 0x4A, 0xDB, 0x97, 0x13, 0x7B, 0x64, 0x7B, 0x7B, 0x7B, 0xAB, 0xAC, 0x62,
+    0xF4, 0x5C, 0x94, 0x95, 0x27, 0x0F, 0x2E, 0x2F, 0xD0, 0xA4, 0x5C, 0x84, 0x15, 0x3A, 0x94, 0x8B,
+    0xA0, 0x42, 0xF7, 0x72, 0xE1, 0x6F, 0x71, 0xB0, 0x05, 0x87, 0xCE, 0xC8, 0x9C, 0x0C, 0x72, 0x70,
+    0x93, 0xD3, 0x8A, 0x0C, 0xF8, 0x7B, 0x4A, 0x1E, 0x5C, 0xD4, 0xF1, 0x16, 0xEE, 0x6B, 0x59, 0xA3,
+    0xCC, 0x23, 0x93, 0x45, 0x00, 0xC6, 0xF9, 0x8E, 0x98, 0x7B, 0xF2, 0x51, 0x36, 0xBC, 0xBD, 0x46,
+    0xBA, 0x7B, 0x8D, 0xF4, 0xB3, 0x5D, 0x76, 0x91, 0xDE, 0xB9, 0x19, 0x55, 0x73, 0xB9, 0xBC, 0x2D,
+    0xB5, 0x27, 0xEF, 0xBC, 0x2A, 0x6D, 0x20, 0xCF, 0xBF, 0xF2, 0x51, 0x1B, 0x49, 0x70, 0xEF, 0x7E,
+    0x13, 0x4B, 0xF8, 0xFC, 0xFD, 0x2A, 0xE9, 0x67, 0xCF, 0xFC, 0xDD, 0xA5, 0x7D, 0x34, 0x2B, 0x5C,
+    0xDA, 0x45, 0xB3, 0x0C, 0x74, 0x35, 0xC2, 0x9A, 0xBB, 0xF3, 0x4A, 0xD7, 0x57, 0x49, 0xD7, 0xCE,
+    0x81, 0xF6, 0x6B, 0xEB, 0xD8, 0x92, 0xE1, 0xDA, 0x1A, 0x27, 0xDF, 0x05, 0x8D, 0xA4, 0xBE, 0xE6,
+    0x9E, 0x08, 0xA5, 0xDE, 0x75, 0xBB, 0xBE, 0x34, 0x75, 0x88, 0xF5, 0xCA, 0x41, 0x59, 0xAB, 0x6E,
+    0x73, 0x17, 0x08, 0x75, 0x08, 0xFE, 0xF1, 0x3E, 0xF7, 0xF5, 0x79, 0x6C, 0xA7, 0x9B, 0x29, 0x8D,
+    0x9E, 0x29, 0xDC, 0x97, 0x9E, 0x44, 0xF6, 0x1D, 0xDB, 0xA3, 0x57, 0x3C, 0x5C, 0x12, 0x6C, 0x5F,
+    0xED, 0xF2, 0xC6, 0xC3, 0xDF, 0x04, 0x3A, 0x67, 0x2E, 0x6E, 0x66, 0x82, 0x8E, 0x8B, 0x08, 0xF4,
+    0x14, 0x9A, 0x68, 0x9F, 0x9E, 0x34, 0x05, 0x7D, 0x24, 0x4B, 0xBB, 0xB4, 0x2B, 0xEB, 0xB4, 0x8B,
+    0x7B, 0x69, 0xD2, 0x2E, 0x90, 0xBF, 0xB4, 0xA4, 0x01, 0xDE, 0x04, 0x83, 0x5F, 0xA4, 0x7D, 0xD0,
+    0xB3, 0x3D, 0x69, 0x3C, 0x90, 0x62, 0x07, 0x94, 0xFE, 0xA2, 0xA7, 0x5D, 0xEE, 0xF5, 0xEE, 0x49,
+    0x5F, 0xDE, 0xE9, 0xDD, 0x6D, 0x78, 0x41, 0x8F, 0x55, 0xA4, 0x22, 0x50, 0x60, 0xA6, 0xFA, 0x60,
+    0x49, 0xD0, 0xCD, 0x79, 0x9B, 0x94, 0x44, 0x3A, 0x21, 0x09, 0xE5, 0x83, 0x5B, 0x1D, 0xD4, 0xF3,
+    0x48, 0x9C, 0x92, 0x3D, 0x92, 0xEB, 0x24, 0xEE, 0xEB, 0xC9, 0xC1, 0x76, 0xE6, 0xA1, 0x6F, 0xE1,
+    0xC9, 0x07, 0x94, 0x4E, 0x7C, 0xBD, 0x25, 0x07, 0x37, 0x38, 0x7C, 0xE3, 0x2E, 0xC9, 0x83, 0x8D,
+    0x13, 0xDD, 0x16, 0xDC, 0x98, 0x5A, 0xFD, 0x73, 0x61, 0xC4, 0x9E, 0x19, 0xD5, 0xCA, 0xA1, 0xA1,
+    0x27, 0xAF, 0x4A, 0x15, 0x88, 0xCB, 0xEB, 0x70, 0x80, 0xAB, 0xCE, 0x7A, 0x97, 0x56, 0x20, 0x49,
+    0x31, 0xE3, 0x06, 0x29, 0x09, 0xB9, 0x61, 0x68, 0xE2, 0x30, 0xFC, 0x0B, 0x17, 0x39, 0x4A, 0x67,
+    0xC4, 0xFC, 0x2C, 0x85, 0x47, 0x6F, 0x97, 0x07, 0x2F, 0xD9, 0x3B, 0x95, 0x5C, 0x4A, 0x4B, 0xD1,
+    0xF9, 0x1D, 0x06, 0x78, 0x38, 0xC0, 0x64, 0x3F, 0x85, 0x55, 0x0F, 0xBA, 0x9C, 0x6D, 0xF2, 0x43,
+    0x91, 0xF6, 0xF7, 0x70, 0xE1, 0x0A, 0x0D, 0xCE, 0x9A, 0x3E, 0xE1, 0x7C, 0x32, 0x66, 0x74, 0x24,
+    0x65, 0x4B, 0x03, 0x8F, 0xFC, 0xB1, 0xAD, 0x0B, 0x8F, 0x31, 0xA2, 0xE4, 0x15, 0xE9, 0x73, 0x2A,
+    0x90, 0xCA, 0x3F, 0xB9, 0xA3, 0xD0, 0xCD, 0x17, 0xD9, 0xE1, 0xAF, 0xC0, 0xA2, 0x61, 0xF4, 0x36,
+    0xC4, 0xFA, 0x3D, 0xA9, 0x7D, 0xA9, 0x03, 0x93, 0x3C, 0xA9, 0x7C, 0x2C, 0x1F, 0x4C, 0x7F, 0x94,
+    0x16, 0xF6, 0xFB, 0x61, 0x92, 0xBF, 0x94, 0x82, 0xA5, 0x14, 0x4E, 0x52, 0x35, 0xB3, 0x39, 0x02,
+    0x69, 0x22, 0x4E, 0x5D, 0xD3, 0x29, 0x2E, 0x8B, 0xC0, 0x84, 0xDC, 0xF5, 0xDC, 0x24, 0x3C, 0xEB,
+    0x4B, 0x27, 0xDE, 0x5B, 0x4A, 0xED, 0x24, 0x68, 0xD8, 0x9A, 0x74, 0x63, 0xF2, 0xF4, 0x8A, 0x2B,
+    0x2D, 0x52, 0xD8, 0x3A, 0x50, 0xEB, 0x61, 0x13, 0x62, 0x34, 0x2B, 0x61, 0xA3, 0xB0, 0xA2, 0x49,
+    0x33, 0x17, 0x2E, 0xC8, 0xE7, 0x23, 0xAF, 0x95, 0x3F, 0x87, 0x0E, 0xCA, 0xD3, 0xCE, 0x78, 0x2C,
+    0xE4, 0xA5, 0xEE, 0x1E, 0x00, 0x68, 0xE4, 0xEE, 0x65, 0x4F, 0x9A, 0x19, 0xC6, 0x79, 0xCE, 0x95,
+    0x2D, 0xBE, 0x5F, 0x91, 0xED, 0x72, 0xD8, 0x39, 0x28, 0xA6, 0xEF, 0x57, 0x86, 0xED, 0x5B, 0xF2,
+    0xE1, 0x41, 0x81, 0xEF, 0xBE, 0xBC, 0xC7, 0x71, 0xE0, 0x5A, 0x87, 0xC6, 0x73, 0x31, 0x9E, 0x8C,
+    0x3C, 0x1A, 0x79, 0x40, 0xFE, 0xF2, 0xE8, 0x8C, 0xA2, 0x40, 0x84, 0xDD, 0xA0, 0xF1, 0x46, 0x1E,
+    0xAB, 0x67, 0xDE, 0x1C, 0x61, 0x54, 0x5D, 0xF4, 0x71, 0x79, 0x43, 0x71, 0xD5, 0x97, 0x79, 0x44,
+    0xEF, 0x83, 0x37, 0x87, 0x62, 0x3C, 0x80, 0x89, 0x8D, 0x9B, 0x97, 0xFB, 0x47, 0xFC, 0xCC, 0xC8,
+    0xF7, 0xC6, 0x76, 0x9D, 0xF1, 0x9F, 0x2B, 0x9F, 0xC9, 0x4C, 0x79, 0x0C, 0x27, 0x44, 0xC8, 0xBD,
+    0x21, 0xB5, 0x90, 0x03, 0xB7, 0x77, 0x86, 0x97, 0x3C, 0x19, 0xB6, 0x08, 0xDB, 0xDE, 0x08, 0xDF,
+    0xFF, 0x2B, 0xD7, 0xC9, 0x31, 0x6E, 0x08, 0xBB, 0x80, 0xB8, 0x11, 0xB9, 0x7A, 0x8B, 0x7D, 0x2E,
+    0x8E, 0xCF, 0xA9, 0x0D, 0xFC, 0x7F, 0x7F, 0x34, 0xA5, 0x8C, 0xC8, 0x4B, 0xA7, 0x97, 0xD7, 0xCB,
+    0xC1, 0xC4, 0x80, 0x0A, 0x9A, 0xBF, 0xFB, 0xE3, 0xDA, 0x26, 0x71, 0x31, 0x89, 0xEA, 0xBE, 0x37,
+    0xB3, 0x49, 0x2C, 0x31, 0x8C, 0x89, 0x81, 0xEC, 0x0C, 0x26, 0xCE, 0xA3, 0xD6, 0x97, 0x71, 0x84,
+    0xB8, 0x76, 0x2A, 0x42, 0x2D, 0x88, 0xDA, 0x20, 0x46, 0x60, 0xB7, 0x6E, 0x83, 0x2E, 0x24, 0xC4,
+    0xD9, 0x4C, 0xE3, 0x06, 0x93, 0x45, 0x54, 0xC9, 0xC7, 0xA6, 0x2C, 0x88, 0x5B, 0x05, 0xDB, 0xA2,
+    0x01, 0xBE, 0xB5, 0x14, 0xF3, 0x86, 0xD6, 0xD5, 0x11, 0xE0, 0x3E, 0x50, 0x5B, 0xC7, 0x55, 0x1C,
+    0x4D, 0xA4, 0xE0, 0xAC, 0xE2, 0x56, 0x32, 0x5F, 0xC5, 0x50, 0x8A, 0xA4, 0x70, 0x2A, 0x42, 0x75,
+    0xE0, 0x40, 0x49, 0x11, 0x11, 0x00, 0x6B, 0x0B, 0x96, 0x89, 0x14, 0xD7, 0x25, 0x8D, 0x3F, 0x68,
+    0xC6, 0x4C, 0xE4, 0x4F, 0x9C, 0x82, 0xE2, 0x8A, 0xFC, 0xE1, 0x08, 0x9D, 0xDC, 0xA9, 0x8B, 0x8C,
+    0x6D, 0xFC, 0xBF, 0x42, 0x25, 0xE6, 0x10, 0x2B, 0x8C, 0x49, 0x8F, 0x0F, 0x99, 0x15, 0x08, 0xF4,
+    0x64, 0x8D, 0x1A, 0x62, 0x56, 0xAB, 0xE8, 0xA3, 0x0D, 0x5D, 0x37, 0x6F, 0x15, 0xF2, 0x66, 0x0B,
+    0xA6, 0x1E, 0x15, 0x09, 0x29, 0xF4, 0xFB, 0xFF, 0x34, 0x2A, 0x02, 0xFA, 0x67, 0xF7, 0x5B, 0x17,
+    0x17, 0xCC, 0x44, 0x2E, 0xFA, 0x63, 0xE7, 0x92, 0x8C, 0xEE, 0xEA, 0xE2, 0x67, 0x80, 0x7E, 0x80,
+    0xA4, 0xCB, 0xB2, 0x79, 0xF5, 0xD9, 0x61, 0x33, 0xDF, 0xCC, 0x52, 0x99, 0x9E, 0xC5, 0x31, 0x91,
+    0xAB, 0xBF, 0xEE, 0xE8, 0x5F, 0xEA, 0xD5, 0x7B, 0xD0, 0xC7, 0x8A, 0x80, 0xAA, 0x75, 0xE5, 0x5D,
+    0x35, 0xAE, 0xD4, 0x48, 0xFE, 0xAF, 0xD5, 0x9A, 0x85, 0x3F, 0x46, 0xF4, 0xBF, 0xA3, 0x62, 0xFA,
+    0x79, 0xE5, 0x92, 0x4F, 0xB5, 0x02, 0x48, 0x31, 0x4C, 0x7C, 0xB8, 0xB0, 0xA0, 0xA6, 0x01, 0xD4,
+    0xE2, 0xF1, 0x91, 0x18, 0xC1, 0x0C, 0x33, 0x29, 0x0C, 0xAC, 0x33, 0xE6, 0x7F, 0x73, 0x99, 0x11,
+    0x8A, 0xC1, 0x06, 0x9A, 0x0C, 0xC2, 0xD9, 0xCD, 0x4D, 0x6C, 0x97, 0x29, 0x0B, 0xD4, 0x29, 0xC8,
+    0x3B, 0xF2, 0x83, 0xED, 0x1D, 0x21, 0xA7, 0x25, 0x9F, 0x56, 0xEE, 0xB0, 0xCB, 0xC6, 0xEF, 0x1E,
+    0xE7, 0x57, 0xB6, 0x8C, 0xE7, 0xD5, 0xF7, 0xE5, 0xCE, 0xFB, 0x12, 0xF7, 0x25, 0x53, 0x0E, 0x25,
+    0x95, 0xCF, 0x94, 0x6B, 0x6A, 0x30, 0xDE, 0x18, 0x1F, 0xB8, 0x1C, 0x7F, 0xFB, 0xA6, 0xAE, 0x89,
+    0x9E, 0xE4, 0x5B, 0x28, 0x58, 0x76, 0xD6, 0xA0, 0x87, 0xF6, 0x2F, 0xB9, 0x31, 0xD3, 0x6C, 0x5E,
+    0x1E, 0x2E, 0x8E, 0xEF, 0xBD, 0x0D, 0xD2, 0x7C, 0x88, 0xE8, 0x90, 0x72, 0x7F, 0xC0, 0x14, 0x6F,
+    0x60, 0x04, 0xD8, 0x2F, 0x1F, 0x5C, 0x82, 0x69, 0x06, 0x1A, 0x3B, 0x01, 0x6D, 0x39, 0x9A, 0x51,
+    0x38, 0x45, 0x74, 0x92, 0xA6, 0x13, 0x8D, 0xA7, 0xF6, 0xD6, 0x97, 0xE3, 0x08, 0xC7, 0x3C, 0x94,
+    0x0C, 0x0E, 0x77, 0x0F, 0xFE, 0x99, 0x0F, 0x48, 0x28, 0x98, 0xF7, 0x4B, 0x65, 0x07, 0x2B, 0x0E,
+    0xC9, 0x42, 0xA5, 0xDE, 0x26, 0x9E, 0xE9, 0x43, 0x89, 0xC5, 0xCD, 0x18, 0x61, 0xC9, 0x7E, 0xCE,
+    0xEA, 0x0D, 0x40, 0x21, 0xC8, 0xA7, 0xD8, 0x9A, 0x10, 0x75, 0x85, 0x0B, 0x6B, 0x58, 0xD1, 0xE3,
+    0xCE, 0xC0, 0xB4, 0x83, 0x41, 0x42, 0x43, 0xD2, 0xBA, 0xCB, 0xC3, 0xE6, 0x86, 0x2D, 0x1E, 0x52,
+    0x66, 0x70, 0xA2, 0x44, 0xDB, 0x69, 0x0F, 0xC5, 0xC1, 0xC0, 0x42, 0xB7, 0x30, 0x34, 0xFD, 0x31,
+    0xB2, 0xB7, 0xBB, 0x8E, 0x25, 0xFC, 0xBA, 0xB3, 0x79, 0x81, 0x0D, 0x04, 0xC9, 0x0D, 0xB8, 0x96,
+    0xD4, 0xC0, 0x89, 0xD4, 0x98, 0x87, 0xD8, 0x89, 0x65, 0x0B, 0xD0, 0x4E, 0xCC, 0x42, 0x89, 0xE4,
+    0xA2, 0x5A, 0x59, 0x3C, 0x57, 0x96, 0x3B, 0x65, 0xBD, 0x32, 0x16, 0x8B, 0x60, 0xD1, 0x42, 0x59,
+    0x5A, 0x28, 0xE3, 0xB0, 0x96, 0x0B, 0xEA, 0x91, 0x6D, 0x82, 0xEF, 0x43, 0xE9, 0xBC, 0x2F, 0x19,
+    0x0E, 0x79, 0x9B, 0x0E, 0xDA, 0x52, 0xC1, 0x05, 0xDD, 0x45, 0x87, 0x66, 0xDC, 0x83, 0xF9, 0x62,
+    0xF3, 0x89, 0xCD, 0x9E, 0x63, 0x26, 0xE8, 0x92, 0xA2, 0x29, 0xDE, 0x44, 0x1A, 0x63, 0xD8, 0x9B,
+    0x81, 0xCC, 0x5D, 0x1D, 0xE8, 0x2D, 0x30, 0x6C, 0x6E, 0x19, 0x3E, 0xFF, 0xA0, 0x1C, 0xB6, 0xC5,
+    0x95, 0x6A, 0x26, 0xE4, 0x13, 0x65, 0x7B, 0x64, 0xC9, 0xC4, 0x7E, 0x43, 0xF6, 0x08, 0x23, 0xAA,
+    0x7B, 0x5C, 0x03, 0x6B, 0xD0, 0xA0, 0xD1, 0xF2, 0x50, 0xA1, 0x8A, 0x2C, 0xEF, 0x2D, 0x8E, 0xBA,
+    0x15, 0xFE, 0x41, 0x35, 0x02, 0x76, 0x27, 0xD1, 0x6C, 0xFC, 0x04, 0xD3, 0x2B, 0x63, 0x53, 0x7D,
+    0xD0, 0x33, 0xF8, 0x8E, 0x8D, 0x89, 0x2E, 0xCF, 0x5D, 0x4B, 0x0C, 0xD3, 0x47, 0x96, 0xEA, 0x60,
+    0x74, 0x18, 0x6D, 0xA9, 0x4D, 0x47, 0xC6, 0x11, 0x8E, 0x7C, 0xE5, 0xA8, 0xAA, 0x71, 0xE9, 0xB2,
+    0x7E, 0xF5, 0x86, 0xE5, 0xCB, 0xB0, 0x9B, 0xA4, 0xAB, 0x62, 0x4A, 0x20, 0x09, 0x0E, 0xE5, 0x61,
+    0x3F, 0xF6, 0xC9, 0x50, 0xA6, 0x59, 0xBF, 0x27, 0x01, 0x79, 0xF9, 0x62, 0xF2, 0xC0, 0x2C, 0xA9,
+    0x27, 0xD1, 0xC5, 0xED, 0x54, 0xDB, 0x31, 0x35, 0xD9, 0xB4, 0x3D, 0x7F, 0x26, 0x76, 0xE6, 0x44,
+    0xD4, 0xF0, 0x48, 0x4C, 0x3A, 0xF3, 0x2A, 0xCE, 0xD1, 0x1E, 0x89, 0xCD, 0x52, 0x84, 0x67, 0x4D,
+    0x6D, 0x51, 0xD4, 0x46, 0xA3, 0x08, 0x15, 0xA3, 0xDE, 0xD3, 0xB3, 0x0C, 0x71, 0xAC, 0x9B, 0x11,
+    0x95, 0x15, 0x96, 0xBB, 0xE4, 0x6D, 0x6C, 0x3A, 0x61, 0x39, 0x6D, 0xF3, 0x39, 0xD8, 0x25, 0xE8,
+    0x9D, 0xD6, 0x52, 0x30, 0x4B, 0xE0, 0x4B, 0x59, 0x51, 0x4C, 0x77, 0xC4, 0xB0, 0x47, 0xE6, 0xEB,
+    0x01, 0xE3, 0x8C, 0x09, 0xA7, 0xB8, 0x80, 0x34, 0x1A, 0x23, 0x42, 0xEE, 0x02, 0x33, 0xCA, 0x2F,
+    0x84, 0x75, 0x29, 0xC6, 0x05, 0xFA, 0x21, 0xB0, 0xC3, 0xE5, 0xB6, 0x2C, 0xF5, 0xB1, 0xF5, 0x2D,
+    0xC5, 0xE5, 0x0E, 0x72, 0x7D, 0xCB, 0xCA, 0xB1, 0x3D, 0xDA, 0xF7, 0x65, 0x35, 0xC5, 0x45, 0x4D,
+    0xCF, 0xD9, 0xEC, 0x78, 0x48, 0x97, 0xAD, 0xC5, 0x35, 0xC7, 0x83, 0xFA, 0x18, 0xAA, 0x8E, 0x99,
+    0x47, 0xEA, 0xC8, 0x68, 0x75, 0x44, 0xED, 0x7D, 0xC2, 0xD4, 0xD2, 0xB0, 0xDC, 0x4D, 0x5A, 0x1A,
+    0x36, 0xEE, 0x4A, 0x85, 0xA9, 0x41, 0x11, 0xBC, 0x53, 0x6B, 0x34, 0x6E, 0x2C, 0xC2, 0x1F, 0x66,
+    0xDA, 0x76, 0xAB, 0x1E, 0x57, 0x02, 0x8B, 0x32, 0x4E, 0x5F, 0x61, 0x99, 0x23, 0xEF, 0x49, 0xA7,
+    0x68, 0xD2, 0x73, 0x99, 0xF7, 0x61, 0xBE, 0x7F, 0xCB, 0x2F, 0x61, 0xDA, 0x7B, 0xC0, 0x9D, 0x22,
+    0x7D, 0xBA, 0xC3, 0xE6, 0xDC, 0x71, 0x7F, 0xD3, 0xFA, 0xE9, 0xB4, 0xB3, 0x6D, 0x28, 0xB5, 0x46,
+    0x23, 0xEE, 0xB2, 0x60, 0x77, 0xC8, 0xA7, 0x29, 0xD3, 0x92, 0xA3, 0xCE, 0x80, 0x43, 0xC6, 0x9E,
+    0x9A, 0x64, 0x05, 0xE1, 0x0E, 0xE7, 0xC6, 0x21, 0x2A, 0x55, 0x80, 0xF1, 0x64, 0xBF, 0xC4, 0xEA,
+    0xCA, 0x86, 0xF5, 0x31, 0x03, 0xB2, 0xB2, 0x38, 0x36, 0xCA, 0xF5, 0x43, 0x5D, 0x46, 0x68, 0x73,
+    0xB6, 0xDC, 0xDF, 0x64, 0xE3, 0x63, 0x5F, 0xD9, 0x9E, 0xBD, 0x98, 0x8F, 0xF2, 0xFD, 0xB2, 0xD7,
+    0x13, 0x84, 0x16, 0x9D, 0x37, 0x0D, 0x39, 0xBE, 0x93, 0x96, 0x96, 0x27, 0x3B, 0x4D, 0x80, 0x5C,
+    0xBA, 0x51, 0xC7, 0x85, 0xE9, 0xD3, 0x1C, 0x2F, 0x81, 0xAF, 0x6A, 0x62, 0x20, 0xC0, 0x72, 0xC3,
+    0x86, 0x7D, 0x61, 0xE1, 0x55, 0x35, 0xC8, 0xDF, 0xD8, 0x97, 0x86, 0xBE, 0x2D, 0xAE, 0x01, 0x92,
+    0xA1, 0x16, 0x68, 0xC2, 0x9A, 0x28, 0xDE, 0x78, 0x9A, 0xE9, 0x15, 0xBA, 0x5A, 0x3B, 0xFC, 0x1A,
+    0xC3, 0xAA, 0xBE, 0x96, 0x0D, 0x38, 0x84, 0x1B, 0xF8, 0x56, 0x68, 0x79, 0x80, 0xDA, 0x87, 0x1D,
+    0x10, 0xD6, 0x00, 0x6E, 0x9C, 0x05, 0x75, 0x30, 0x66, 0x87, 0x5E, 0x19, 0xE7, 0x63, 0x21, 0x81,
+    0xD9, 0x53, 0x16, 0x7F, 0x15, 0x19, 0xE0, 0xBE, 0x45, 0x6B, 0x7C, 0xD4, 0xB5, 0x78, 0xA5, 0xE5,
+    0x36, 0xB7, 0x7F, 0x62, 0x45, 0xCD, 0x14, 0xA5, 0x86, 0x3E, 0x85, 0xA5, 0xF8, 0xF9, 0x31, 0x16,
+    0x8F, 0xE0, 0x63, 0xCE, 0xB9, 0x9E, 0x2A, 0xBB, 0x6E, 0x5E, 0xDB, 0x19, 0xDE, 0xB4, 0xEA, 0xD9,
+    0x1E, 0x97, 0xEE, 0xCE, 0x3E, 0xFB, 0x19, 0xEA, 0x94, 0x8B, 0x86, 0x8E, 0x86, 0x95, 0xB0, 0x78,
+    0x64, 0xF5, 0x71, 0x64, 0x65, 0x71, 0x52, 0x78, 0x7A, 0x82, 0x3F, 0xD6, 0x64, 0x70, 0x77, 0x68,
+    0x7E, 0x3D, 0x98, 0x61, 0x8B, 0x5C, 0xA7, 0x1B, 0xE6, 0x75, 0x5A, 0x16, 0x05, 0x2D, 0x41, 0x53,
+    0x93, 0x43, 0x8A, 0xD8, 0x94, 0x1A, 0xD9, 0xA4, 0x1D, 0xD9, 0x18, 0x21, 0x2B, 0xEA, 0x56, 0x5A,
+    0x90, 0x61, 0xFF, 0x62, 0xAD, 0x0F, 0x03, 0x66, 0x62, 0x1C, 0x4A, 0x9D, 0xFE, 0x10, 0xE3, 0xAC,
+    0x06, 0x74, 0xB5, 0x85, 0x06, 0x40, 0x81, 0x0A, 0x25, 0x97, 0x2D, 0x55, 0xA0, 0xD5, 0x3A, 0xAA,
+    0xA5, 0x55, 0x39, 0x99, 0xE8, 0x61, 0x80, 0x09, 0xD0, 0xBE, 0xFE, 0x44, 0x60, 0x91, 0x17, 0xB5,
+    0x9C, 0xD6, 0xB2, 0xE7, 0xB4, 0x46, 0x7B, 0xAA, 0x07, 0xD1, 0x74, 0x1E, 0x2A, 0x65, 0xE1, 0x53,
+    0xE2, 0xFC, 0xA5, 0x28, 0x53, 0x2E, 0x58, 0x24, 0x25, 0x7A, 0x1B, 0xE2, 0x1B, 0x46, 0x9C, 0xD2,
+    0x1B, 0x11, 0xA7, 0x46, 0xF0, 0xAA, 0x23, 0x5A, 0xCA, 0xBB, 0x76, 0xA9, 0x81, 0x95, 0x1F, 0x1C,
+    0xB2, 0x28, 0xBD, 0xFB, 0x16, 0xCF, 0x6C, 0x5E, 0x55, 0x56, 0xD1, 0xE0, 0x55, 0xF9, 0x22, 0xEE,
+    0xBD, 0x2A, 0xCD, 0xD2, 0xCE, 0xAB, 0xCE, 0xC0, 0x01, 0xD8, 0xAB, 0x6C, 0x8F, 0x28, 0x12, 0xE8,
+    0xB7, 0xD0, 0xE3, 0x2D, 0xAD, 0x6F, 0xAA, 0x34, 0xE9, 0x49, 0x23, 0xCC, 0xE2, 0xB6, 0x66, 0xF2,
+    0x87, 0xCA, 0x07, 0xAA, 0x7D, 0x5C, 0xC5, 0xAC, 0xDF, 0x0F, 0x09, 0x98, 0xAA, 0x0F, 0xCE, 0x21,
+    0xEF, 0xB2, 0x06, 0x6A, 0x4E, 0xEA, 0x8C, 0xB5, 0x33, 0xF7, 0x8B, 0xD3, 0xBA, 0xFC, 0x9B, 0xA8,
+    0x27, 0xE3, 0x41, 0xCE, 0x8E, 0x71, 0x0B, 0x7B, 0xF3, 0x5D, 0xBD, 0xBE, 0x3F, 0xD5, 0x62, 0xAE,
+    0x1C, 0x6E, 0xCC, 0x58, 0x21, 0xC1, 0x27, 0xA0, 0xBB, 0xE6, 0xA1, 0x8B, 0x4B, 0xD7, 0x18, 0x46,
+    0xCF, 0x90, 0x3F, 0x97, 0x6D, 0x80, 0xB3, 0x46, 0x07, 0x4F, 0x8A, 0x3A, 0x66, 0x1E, 0x25, 0x15,
+    0xFC, 0xD6, 0xC3, 0x56, 0x64, 0x34, 0x43, 0x35, 0x16, 0x7E, 0xBE, 0x1E, 0x87, 0x4A, 0xEE, 0x42,
+    0x6C, 0xB5, 0xB5, 0xDD, 0x4F, 0x75, 0xDC, 0x95, 0x5E, 0xB3, 0xB8, 0x46, 0xCC, 0xEC, 0xCD, 0x37,
+    0xEF, 0xC9, 0x79, 0x91, 0x4F, 0x86, 0xB5, 0xDB, 0xCD, 0x27, 0xFD, 0xDA, 0x6E, 0xFD, 0x69, 0xB7,
+    0xBE, 0x5B, 0x7F, 0xD1, 0xC6, 0x4D, 0xCD, 0xF3, 0x36, 0x8F, 0x2D, 0xEA, 0x53, 0xB7, 0x3F, 0x43,
+    0xE4, 0xEC, 0xD6, 0x13, 0x39, 0xBD, 0xA1, 0x65, 0x10, 0xC6, 0x57, 0x3F, 0xCB, 0x9E, 0xDA, 0xC6,
+    0x73, 0xA2, 0x8E, 0x4B, 0x8F, 0x7D, 0x4D, 0x5F, 0x97, 0xB7, 0xCA, 0x2C, 0xC5, 0x92, 0x53, 0xA5,
+    0x71, 0x76, 0x41, 0xE9, 0x3A, 0x28, 0xEF, 0x23, 0x6C, 0xC5, 0xFF, 0x17, 0xAD, 0xF4, 0x34, 0x57,
+    0xDB, 0xC4, 0xC5, 0x48, 0x39, 0xBB, 0x95, 0xC7, 0x67, 0xAF, 0xCA, 0x0B, 0x1B, 0x4E, 0x4F, 0x80,
+    0x3C, 0xD1, 0xF0, 0xEA, 0xC2, 0x3D, 0xB5, 0x2D, 0x07, 0x37, 0xF4, 0xAB, 0x4A, 0xFA, 0x4E, 0xCF,
+    0x52, 0xD8, 0xC7, 0xB9, 0x1D, 0xFA, 0xF5, 0x3A, 0x24, 0xD7, 0xF1, 0x06, 0x05, 0x93, 0x6C, 0x04,
+    0x16, 0x6D, 0xE6, 0x6B, 0x12, 0x52, 0xDC, 0xCD, 0x07, 0x9D, 0x79, 0xC2, 0x9D, 0xD0, 0x4E, 0x7E,
+    0xA2, 0x05, 0x12, 0x37, 0xAA, 0x9A, 0xA2, 0xDB, 0x76, 0x7F, 0x82, 0xEF, 0xDA, 0x28, 0xAB, 0xAB,
+    0xFC, 0x63, 0xD1, 0x9A, 0x67, 0xDF, 0x8D, 0x33, 0x7A, 0x3A, 0x7A, 0x22, 0x75, 0x42, 0x43, 0x7E,
+    0x8E, 0x09, 0x76, 0x73, 0x7D, 0xA5, 0x73, 0xAD, 0x48, 0xED, 0xBD, 0x48, 0x8F, 0x41, 0xF4, 0xDE,
+    0x29, 0x6B, 0x60, 0xE8, 0x46, 0x5E, 0xAF, 0x50, 0xE5, 0xDA, 0xE5, 0x05, 0x69, 0xAA, 0x34, 0xD1,
+    0x37, 0xA9, 0x9B, 0x68, 0xC3, 0x4B, 0x03, 0x69, 0xC3, 0x56, 0x37, 0x47, 0x61, 0x62, 0x99, 0xED,
+    0xC3, 0x61, 0x3A, 0x2D, 0x41, 0xDB, 0x1D, 0xEE, 0xEB, 0x5A, 0xC0, 0x7D, 0x5D, 0xF3, 0xA8, 0xE7,
+    0x05, 0x00, 0x79, 0x6F, 0x06, 0x9D, 0xAB, 0xE9, 0x09, 0x60, 0x7F, 0xBD, 0xDA, 0xB8, 0xDF, 0xE2,
+    0x94, 0xD8, 0x2A, 0x16, 0x77, 0x4A, 0xF7, 0x40, 0x8B, 0xEC, 0xBA, 0x73, 0x5F, 0xFC, 0x6B, 0x7E,
+    0x9B, 0x75, 0xF8, 0x5B, 0x0D, 0xE9, 0x61, 0x0D, 0x40, 0x7C, 0x99, 0x37, 0x28, 0xCD, 0xCF, 0x52,
+    0xBD, 0x5F, 0x39, 0x63, 0x60, 0x89, 0x1E, 0x7B, 0x04, 0x96, 0xD3, 0xE8, 0xC2, 0x7D, 0x72, 0x01,
+    0xA6, 0x4B, 0xDE, 0xBD, 0x5C, 0x2B, 0xFA, 0xD7, 0x9A, 0xAB, 0xE6, 0xCE, 0x6E, 0x63, 0xDC, 0x78,
+    0x60, 0xB0, 0x53, 0x83, 0x5F, 0x7F, 0x33, 0xFB, 0xDD, 0xB0, 0xA5, 0x68, 0xA7, 0xD9, 0x2E, 0xD7,
+    0xB5, 0x7A, 0xF2, 0x5A, 0x8D, 0x72, 0x0B, 0x75, 0x51, 0xCD, 0x0A, 0xAD, 0xF7, 0x6B, 0x66, 0xBB,
+    0xCE, 0xE7, 0x25, 0x5D, 0xDC, 0xFA, 0x35, 0xF2, 0x08, 0x0E, 0xD1, 0x64, 0xA9, 0x32, 0x9C, 0xB9,
+    0x96, 0xCC, 0x9F, 0x58, 0xF1, 0x43, 0x19, 0x32, 0xD8, 0x8B, 0x76, 0x51, 0x51, 0xE8, 0x4D, 0x0C,
+    0x15, 0x29, 0xF4, 0x2C, 0x5D, 0xE0, 0xB0, 0x04, 0x1A, 0xC9, 0xB7, 0x52, 0x6D, 0x93, 0x68, 0x7B,
+    0x58, 0xF1, 0x96, 0x7C, 0x64, 0x77, 0x8F, 0x58, 0xDE, 0xB3, 0xF2, 0x7A, 0x36, 0xE5, 0x05, 0xA3,
+    0x76, 0xE1, 0x63, 0xF4, 0xAB, 0x5F, 0xED, 0x22, 0x64, 0xA6, 0x91, 0x73, 0xBC, 0xA5, 0x73, 0x8F,
+    0xFE, 0x88, 0xF4, 0xDC, 0xEA, 0x11, 0x3D, 0x7F, 0xDE, 0x69, 0xF6, 0xDD, 0x52, 0x20, 0x61, 0x8E,
+    0xE8, 0x63, 0xDE, 0x89, 0x9C, 0x5B, 0x4D, 0xEB, 0xB0, 0x3B, 0xB7, 0x0A, 0x20, 0x6A, 0xCF, 0xAD,
+    0x86, 0x7D, 0x5C, 0x9F, 0x5B, 0x0D, 0x86, 0x14, 0xD4, 0x1F, 0xD2, 0x0A, 0xB4, 0x27, 0xF5, 0xDA,
+    0xBC, 0x7A, 0xE8, 0x21, 0x97, 0x59, 0x69, 0x9D, 0x56, 0xC7, 0xA8, 0x5A, 0xC9, 0xEA, 0xEC, 0x48,
+    0x83, 0x61, 0xA6, 0xAE, 0x10, 0x58, 0x95, 0x69, 0x19, 0x3D, 0x2F, 0x46, 0xDB, 0x8D, 0x89, 0xEC,
+    0x04, 0x75, 0x1E, 0x4F, 0x02, 0xD1, 0xAF, 0x0A, 0x23, 0xB9, 0x18, 0x60, 0xF3, 0x30, 0xB6, 0x83,
+    0x33, 0xE1, 0xC0, 0xDB, 0x2D, 0x20, 0xFD, 0x02, 0xA4, 0xAC, 0xBE, 0x4A, 0xEC, 0x6B, 0x11, 0x4A,
+    0xA8, 0x65, 0x70, 0x43, 0x82, 0x4A, 0x71, 0x80, 0xA5, 0xD8, 0x64, 0xA1, 0x17, 0xB7, 0x24, 0x0D,
+    0x49, 0x7B, 0x92, 0x34, 0xD3, 0xD7, 0x12, 0x41, 0x70, 0x49, 0xE6, 0xA5, 0x96, 0x79, 0x9A, 0x6E,
+    0x96, 0x0A, 0x19, 0x71, 0x38, 0x70, 0x22, 0x88, 0x7B, 0xA0, 0xC1, 0x87, 0x38, 0xAE, 0x12, 0xF6,
+    0xE1, 0x74, 0x65, 0x05, 0x43, 0xE6, 0x0B, 0x1C, 0x0E, 0x52, 0x1A, 0xF3, 0x8C, 0xE1, 0x41, 0xF9,
+    0x4D, 0x44, 0xA3, 0x84, 0x45, 0x91, 0x5E, 0xB0, 0xF3, 0xC6, 0x3D, 0x44, 0x86, 0x7D, 0x50, 0xCE,
+    0xF5, 0xA6, 0x0D, 0xC3, 0xF3, 0xFB, 0xE6, 0x71, 0xF4, 0x45, 0x6D, 0x60, 0x57, 0x17, 0x73, 0x25,
+    0x84, 0xE7, 0xE2, 0xBF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFB, 0xE1, 0x04, 0x03, 0x08, 0x00,
+    0x00, 0xAD, 0xD1, 0xB1, 0x71, 0x84, 0x30, 0x10, 0x05, 0xD0, 0x0F, 0x8C, 0x4D, 0x40, 0x40, 0x44,
+    0xE2, 0x0B, 0xAE, 0x84, 0x2B, 0x41, 0x64, 0x4E, 0x2F, 0xF0, 0xD5, 0x71, 0x1D, 0x98, 0x2B, 0xC1,
+    0x8D, 0xB8, 0x03, 0xCF, 0x88, 0x12, 0x28, 0x81, 0x12, 0x08, 0xF0, 0x8C, 0x98, 0x11, 0xFA, 0xFE,
+    0x8B, 0x1C, 0x3A, 0xB4, 0x02, 0xBD, 0x19, 0x69, 0xB5, 0x5A, 0xAD, 0x80, 0x0B, 0x3F, 0x00, 0x54,
+    0x64, 0x12, 0x6D, 0x7A, 0xE5, 0x04, 0xB8, 0x15, 0x7E, 0x05, 0x86, 0x05, 0x83, 0xE0, 0x6C, 0x0B,
+    0xD0, 0xC6, 0x2F, 0x43, 0x86, 0x2B, 0x0A, 0x4E, 0x0D, 0x19, 0x45, 0x9B, 0x79, 0xF2, 0xDB, 0x5B,
+    0x91, 0x43, 0xFE, 0x9F, 0x20, 0x54, 0x4B, 0x44, 0xAD, 0xAB, 0x1D, 0x3F, 0x3D, 0xB9, 0x9C, 0xB9,
+    0x1B, 0x35, 0x77, 0xD8, 0xE8, 0x6C, 0xBA, 0xA7, 0xDE, 0xA8, 0xC9, 0xCD, 0x3C, 0x6F, 0x27, 0x3E,
+    0xA4, 0x9B, 0xEC, 0xB8, 0x9E, 0x35, 0xE2, 0x4F, 0x5D, 0xF6, 0xD9, 0xCF, 0xA5, 0x2C, 0xC9, 0xF5,
+    0x44, 0x86, 0x36, 0xF9, 0xE8, 0xA4, 0x9B, 0x9B, 0xD8, 0xF1, 0xFB, 0xEA, 0xC6, 0x2A, 0x5A, 0xDC,
+    0x30, 0x56, 0xE1, 0x70, 0x2E, 0xFA, 0x43, 0x2B, 0xC0, 0xCA, 0xB3, 0x06, 0xCA, 0x8B, 0x35, 0x54,
+    0xAA, 0x3F, 0xB3, 0x59, 0x28, 0xC7, 0x91, 0x5F, 0x15, 0xE7, 0xFB, 0x7C, 0x32, 0x5F, 0x14, 0x61,
+    0xBE, 0xEB, 0x0F, 0x4C, 0xA2, 0xD4, 0xFA, 0x02, 0x3E, 0xAA, 0xDD, 0x5A, 0xEC, 0xA7, 0x26, 0x28,
+    0xF4, 0xCB, 0xF1, 0x48, 0x1E, 0xF5, 0xAA, 0x5E, 0x47, 0x02, 0xBA, 0xAB, 0x72, 0xDC, 0xF0, 0x03,
+    0x4D, 0x90, 0xB1, 0x0D, 0x83, 0x30, 0x14, 0x44, 0x0F, 0x53, 0x50, 0xD0, 0xA6, 0x77, 0x36, 0x60,
+    0x04, 0xCA, 0x8C, 0x90, 0x55, 0xD2, 0xC1, 0x26, 0x59, 0x24, 0x12, 0x8C, 0x90, 0x11, 0x18, 0x81,
+    0x22, 0x05, 0x52, 0x88, 0x2F, 0x77, 0x36, 0x91, 0xE2, 0xE2, 0xFB, 0xC9, 0x7A, 0xFF, 0xFE, 0x97,
+    0x81, 0xBF, 0x73, 0x3B, 0xEE, 0x2A, 0x1D, 0xD0, 0x70, 0x2C, 0x10, 0xB9, 0x14, 0x18, 0xB8, 0x15,
+    0x85, 0x4C, 0x87, 0xC2, 0x22, 0xC5, 0x27, 0xBA, 0x2C, 0x0D, 0x38, 0xD5, 0x96, 0xAA, 0x0F, 0x12,
+    0x2C, 0x35, 0x7B, 0x45, 0x0C, 0x92, 0x62, 0x0A, 0x44, 0xBF, 0x38, 0xE5, 0x2D, 0xD8, 0x9C, 0x42,
+    0x41, 0xCA, 0x29, 0x09, 0x13, 0xC7, 0x28, 0xD8, 0x41, 0x2E, 0xBD, 0xE0, 0x55, 0x93, 0x5B, 0xE7,
+    0x01, 0x7A, 0x5E, 0x5B, 0x81, 0x1B, 0xE6, 0xA0, 0x52, 0xBB, 0x51, 0x0D, 0xBC, 0xD8, 0x87, 0xA4,
+    0xBB, 0x14, 0xC0, 0x92, 0x14, 0x20, 0x64, 0xF0, 0x3E, 0x53, 0xAA, 0xAD, 0x48, 0xD2, 0x1E, 0xAB,
+    0xA1, 0xD5, 0x84, 0xD9, 0x10, 0xBC, 0x59, 0x3E, 0xD3, 0x75, 0x2F, 0xD0, 0x15, 0xC5, 0x49, 0x73,
+    0x81, 0xC0, 0xDF, 0xFF, 0x3C, 0x7E, 0x70, 0x76, 0xF9, 0x02,
 };
 
 static const EpdGlyph notoserif_18_boldGlyphs[] = {
@@ -3003,99 +3008,99 @@ static const EpdGlyph notoserif_18_boldGlyphs[] = {
     { 0, 0, 156, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 156, 0, 0, 0, 0 }, // U+0020
     { 8, 28, 229, 3, 27, 56, 0 }, // !
-    { 15, 11, 305, 2, 27, 42, 56 }, // "
-    { 20, 27, 339, 1, 27, 135, 98 }, // #
-    { 19, 32, 339, 1, 29, 152, 233 }, // $
-    { 32, 29, 544, 1, 28, 232, 385 }, // %
-    { 29, 29, 481, 1, 28, 211, 617 }, // &
-    { 7, 11, 174, 2, 27, 20, 828 }, // '
-    { 12, 35, 241, 2, 29, 105, 848 }, // (
-    { 12, 35, 241, 1, 29, 105, 953 }, // )
-    { 17, 16, 301, 1, 29, 68, 1058 }, // *
-    { 17, 17, 339, 2, 22, 73, 1126 }, // +
-    { 8, 12, 176, 1, 6, 24, 1199 }, // ,
-    { 11, 5, 186, 0, 13, 14, 1223 }, // -
-    { 7, 7, 176, 2, 6, 13, 1237 }, // .
-    { 11, 34, 173, 0, 29, 94, 1250 }, // /
-    { 20, 29, 349, 1, 28, 145, 1344 }, // 0
-    { 19, 27, 304, 0, 27, 129, 1489 }, // 1
-    { 19, 28, 319, 1, 28, 133, 1618 }, // 2
-    { 19, 29, 323, 1, 28, 138, 1751 }, // 3
-    { 21, 27, 334, 0, 27, 142, 1889 }, // 4
-    { 18, 28, 318, 1, 27, 126, 2031 }, // 5
-    { 19, 29, 336, 1, 28, 138, 2157 }, // 6
-    { 19, 27, 325, 1, 27, 129, 2295 }, // 7
-    { 20, 29, 347, 1, 28, 145, 2424 }, // 8
-    { 19, 29, 336, 1, 28, 138, 2569 }, // 9
-    { 7, 22, 182, 2, 21, 39, 2707 }, // :
-    { 7, 27, 182, 2, 21, 48, 2746 }, // ;
-    { 17, 21, 339, 2, 24, 90, 2794 }, // <
-    { 17, 11, 339, 2, 19, 47, 2884 }, // =
-    { 17, 21, 339, 2, 24, 90, 2931 }, // >
-    { 18, 29, 330, 1, 28, 131, 3021 }, // ?
-    { 31, 33, 553, 2, 27, 256, 3152 }, // @
-    { 29, 27, 452, 0, 27, 196, 3408 }, // A
-    { 23, 27, 403, 1, 27, 156, 3604 }, // B
-    { 22, 29, 401, 2, 28, 160, 3760 }, // C
-    { 26, 27, 460, 1, 27, 176, 3920 }, // D
-    { 23, 27, 392, 1, 27, 156, 4096 }, // E
-    { 22, 27, 373, 1, 27, 149, 4252 }, // F
-    { 26, 29, 462, 2, 28, 189, 4401 }, // G
-    { 29, 27, 491, 1, 27, 196, 4590 }, // H
-    { 14, 27, 241, 1, 27, 95, 4786 }, // I
-    { 16, 36, 238, -1, 27, 144, 4881 }, // J
-    { 27, 27, 440, 1, 27, 183, 5025 }, // K
-    { 23, 27, 392, 1, 27, 156, 5208 }, // L
-    { 34, 27, 571, 1, 27, 230, 5364 }, // M
-    { 28, 27, 473, 1, 27, 189, 5594 }, // N
-    { 26, 29, 472, 2, 28, 189, 5783 }, // O
-    { 23, 27, 383, 1, 27, 156, 5972 }, // P
-    { 26, 37, 472, 2, 28, 241, 6128 }, // Q
-    { 26, 27, 427, 1, 27, 176, 6369 }, // R
-    { 20, 29, 347, 1, 28, 145, 6545 }, // S
-    { 25, 27, 392, 0, 27, 169, 6690 }, // T
-    { 28, 28, 448, 0, 27, 196, 6859 }, // U
-    { 27, 27, 419, 0, 27, 183, 7055 }, // V
-    { 41, 27, 640, 0, 27, 277, 7238 }, // W
-    { 28, 27, 440, 0, 27, 189, 7515 }, // X
-    { 27, 27, 416, 0, 27, 183, 7704 }, // Y
-    { 23, 27, 400, 1, 27, 156, 7887 }, // Z
-    { 12, 34, 249, 3, 29, 102, 8043 }, // [
-    { 11, 34, 173, 0, 29, 94, 8145 }, // <backslash>
-    { 11, 34, 249, 1, 29, 94, 8239 }, // ]
-    { 19, 18, 335, 1, 27, 86, 8333 }, // ^
-    { 19, 3, 275, -1, -3, 15, 8419 }, // _
-    { 11, 7, 200, 1, 29, 20, 8434 }, // `
-    { 21, 22, 360, 1, 21, 116, 8454 }, // a
-    { 23, 30, 389, 0, 29, 173, 8570 }, // b
-    { 18, 22, 316, 1, 21, 99, 8743 }, // c
-    { 23, 30, 389, 1, 29, 173, 8842 }, // d
-    { 19, 22, 343, 1, 21, 105, 9015 }, // e
-    { 18, 29, 244, 0, 29, 131, 9120 }, // f
-    { 21, 31, 336, 0, 22, 163, 9251 }, // g
-    { 25, 29, 400, 0, 29, 182, 9414 }, // h
-    { 13, 29, 211, 0, 29, 95, 9596 }, // i
-    { 11, 38, 207, -1, 29, 105, 9691 }, // j
-    { 24, 29, 382, 0, 29, 174, 9796 }, // k
-    { 13, 29, 211, 0, 29, 95, 9970 }, // l
-    { 37, 21, 592, 0, 21, 195, 10065 }, // m
-    { 25, 21, 400, 0, 21, 132, 10260 }, // n
-    { 21, 22, 368, 1, 21, 116, 10392 }, // o
-    { 23, 30, 387, 0, 21, 173, 10508 }, // p
-    { 23, 30, 389, 1, 21, 173, 10681 }, // q
-    { 20, 21, 314, 0, 21, 105, 10854 }, // r
-    { 16, 22, 289, 1, 21, 88, 10959 }, // s
-    { 15, 26, 243, 0, 25, 98, 11047 }, // t
-    { 25, 22, 400, 0, 21, 138, 11145 }, // u
-    { 23, 21, 364, 0, 21, 121, 11283 }, // v
-    { 34, 21, 514, -1, 21, 179, 11404 }, // w
-    { 24, 21, 388, 0, 21, 126, 11583 }, // x
-    { 22, 30, 347, 0, 21, 165, 11709 }, // y
-    { 19, 21, 317, 0, 21, 100, 11874 }, // z
-    { 15, 34, 265, 1, 29, 128, 11974 }, // {
-    { 3, 38, 339, 9, 29, 29, 12102 }, // |
-    { 15, 34, 265, 1, 29, 128, 12131 }, // }
-    { 19, 8, 339, 1, 17, 38, 12259 }, // ~
+    { 15, 11, 305, 2, 27, 42, 0 }, // "
+    { 20, 27, 339, 1, 27, 135, 42 }, // #
+    { 19, 32, 339, 1, 29, 152, 177 }, // $
+    { 32, 29, 544, 1, 28, 232, 329 }, // %
+    { 29, 29, 481, 1, 28, 211, 561 }, // &
+    { 7, 11, 174, 2, 27, 20, 772 }, // '
+    { 12, 35, 241, 2, 29, 105, 56 }, // (
+    { 12, 35, 241, 1, 29, 105, 161 }, // )
+    { 17, 16, 301, 1, 29, 68, 792 }, // *
+    { 17, 17, 339, 2, 22, 73, 860 }, // +
+    { 8, 12, 176, 1, 6, 24, 266 }, // ,
+    { 11, 5, 186, 0, 13, 14, 290 }, // -
+    { 7, 7, 176, 2, 6, 13, 304 }, // .
+    { 11, 34, 173, 0, 29, 94, 933 }, // /
+    { 20, 29, 349, 1, 28, 145, 317 }, // 0
+    { 19, 27, 304, 0, 27, 129, 462 }, // 1
+    { 19, 28, 319, 1, 28, 133, 591 }, // 2
+    { 19, 29, 323, 1, 28, 138, 724 }, // 3
+    { 21, 27, 334, 0, 27, 142, 862 }, // 4
+    { 18, 28, 318, 1, 27, 126, 1004 }, // 5
+    { 19, 29, 336, 1, 28, 138, 1130 }, // 6
+    { 19, 27, 325, 1, 27, 129, 1268 }, // 7
+    { 20, 29, 347, 1, 28, 145, 1397 }, // 8
+    { 19, 29, 336, 1, 28, 138, 1542 }, // 9
+    { 7, 22, 182, 2, 21, 39, 1680 }, // :
+    { 7, 27, 182, 2, 21, 48, 1719 }, // ;
+    { 17, 21, 339, 2, 24, 90, 1027 }, // <
+    { 17, 11, 339, 2, 19, 47, 1117 }, // =
+    { 17, 21, 339, 2, 24, 90, 1164 }, // >
+    { 18, 29, 330, 1, 28, 131, 1767 }, // ?
+    { 31, 33, 553, 2, 27, 256, 1254 }, // @
+    { 29, 27, 452, 0, 27, 196, 1898 }, // A
+    { 23, 27, 403, 1, 27, 156, 2094 }, // B
+    { 22, 29, 401, 2, 28, 160, 2250 }, // C
+    { 26, 27, 460, 1, 27, 176, 2410 }, // D
+    { 23, 27, 392, 1, 27, 156, 2586 }, // E
+    { 22, 27, 373, 1, 27, 149, 2742 }, // F
+    { 26, 29, 462, 2, 28, 189, 2891 }, // G
+    { 29, 27, 491, 1, 27, 196, 3080 }, // H
+    { 14, 27, 241, 1, 27, 95, 3276 }, // I
+    { 16, 36, 238, -1, 27, 144, 3371 }, // J
+    { 27, 27, 440, 1, 27, 183, 3515 }, // K
+    { 23, 27, 392, 1, 27, 156, 3698 }, // L
+    { 34, 27, 571, 1, 27, 230, 3854 }, // M
+    { 28, 27, 473, 1, 27, 189, 4084 }, // N
+    { 26, 29, 472, 2, 28, 189, 4273 }, // O
+    { 23, 27, 383, 1, 27, 156, 4462 }, // P
+    { 26, 37, 472, 2, 28, 241, 4618 }, // Q
+    { 26, 27, 427, 1, 27, 176, 4859 }, // R
+    { 20, 29, 347, 1, 28, 145, 5035 }, // S
+    { 25, 27, 392, 0, 27, 169, 5180 }, // T
+    { 28, 28, 448, 0, 27, 196, 1510 }, // U
+    { 27, 27, 419, 0, 27, 183, 5349 }, // V
+    { 41, 27, 640, 0, 27, 277, 5532 }, // W
+    { 28, 27, 440, 0, 27, 189, 5809 }, // X
+    { 27, 27, 416, 0, 27, 183, 5998 }, // Y
+    { 23, 27, 400, 1, 27, 156, 6181 }, // Z
+    { 12, 34, 249, 3, 29, 102, 1706 }, // [
+    { 11, 34, 173, 0, 29, 94, 1808 }, // <backslash>
+    { 11, 34, 249, 1, 29, 94, 1902 }, // ]
+    { 19, 18, 335, 1, 27, 86, 1996 }, // ^
+    { 19, 3, 275, -1, -3, 15, 2082 }, // _
+    { 11, 7, 200, 1, 29, 20, 2097 }, // `
+    { 21, 22, 360, 1, 21, 116, 6337 }, // a
+    { 23, 30, 389, 0, 29, 173, 6453 }, // b
+    { 18, 22, 316, 1, 21, 99, 6626 }, // c
+    { 23, 30, 389, 1, 29, 173, 6725 }, // d
+    { 19, 22, 343, 1, 21, 105, 6898 }, // e
+    { 18, 29, 244, 0, 29, 131, 7003 }, // f
+    { 21, 31, 336, 0, 22, 163, 7134 }, // g
+    { 25, 29, 400, 0, 29, 182, 7297 }, // h
+    { 13, 29, 211, 0, 29, 95, 7479 }, // i
+    { 11, 38, 207, -1, 29, 105, 7574 }, // j
+    { 24, 29, 382, 0, 29, 174, 7679 }, // k
+    { 13, 29, 211, 0, 29, 95, 7853 }, // l
+    { 37, 21, 592, 0, 21, 195, 7948 }, // m
+    { 25, 21, 400, 0, 21, 132, 8143 }, // n
+    { 21, 22, 368, 1, 21, 116, 8275 }, // o
+    { 23, 30, 387, 0, 21, 173, 8391 }, // p
+    { 23, 30, 389, 1, 21, 173, 8564 }, // q
+    { 20, 21, 314, 0, 21, 105, 8737 }, // r
+    { 16, 22, 289, 1, 21, 88, 8842 }, // s
+    { 15, 26, 243, 0, 25, 98, 8930 }, // t
+    { 25, 22, 400, 0, 21, 138, 9028 }, // u
+    { 23, 21, 364, 0, 21, 121, 9166 }, // v
+    { 34, 21, 514, -1, 21, 179, 9287 }, // w
+    { 24, 21, 388, 0, 21, 126, 9466 }, // x
+    { 22, 30, 347, 0, 21, 165, 9592 }, // y
+    { 19, 21, 317, 0, 21, 100, 9757 }, // z
+    { 15, 34, 265, 1, 29, 128, 2117 }, // {
+    { 3, 38, 339, 9, 29, 29, 2245 }, // |
+    { 15, 34, 265, 1, 29, 128, 2274 }, // }
+    { 19, 8, 339, 1, 17, 38, 2402 }, // ~
     { 0, 0, 156, 0, 0, 0, 0 }, // U+00A0
     { 8, 28, 229, 3, 21, 56, 0 }, // U+00A1
     { 18, 27, 339, 2, 27, 122, 56 }, // U+00A2
@@ -3179,19 +3184,19 @@ static const EpdGlyph notoserif_18_boldGlyphs[] = {
     { 21, 30, 368, 1, 29, 158, 11901 }, // U+00F0
     { 25, 29, 400, 0, 29, 182, 12059 }, // U+00F1
     { 21, 30, 368, 1, 29, 158, 12241 }, // U+00F2
-    { 21, 30, 368, 1, 29, 158, 12399 }, // U+00F3
-    { 21, 30, 368, 1, 29, 158, 12557 }, // U+00F4
-    { 21, 30, 368, 1, 29, 158, 12715 }, // U+00F5
-    { 21, 30, 368, 1, 29, 158, 12873 }, // U+00F6
-    { 17, 21, 339, 2, 24, 90, 13031 }, // U+00F7
-    { 21, 24, 368, 1, 22, 126, 13121 }, // U+00F8
-    { 25, 30, 400, 0, 29, 188, 13247 }, // U+00F9
-    { 25, 30, 400, 0, 29, 188, 13435 }, // U+00FA
-    { 25, 30, 400, 0, 29, 188, 13623 }, // U+00FB
-    { 25, 30, 400, 0, 29, 188, 13811 }, // U+00FC
-    { 22, 38, 347, 0, 29, 209, 13999 }, // U+00FD
-    { 23, 38, 387, 0, 29, 219, 14208 }, // U+00FE
-    { 22, 38, 347, 0, 29, 209, 14427 }, // U+00FF
+    { 21, 30, 368, 1, 29, 158, 9857 }, // U+00F3
+    { 21, 30, 368, 1, 29, 158, 12399 }, // U+00F4
+    { 21, 30, 368, 1, 29, 158, 12557 }, // U+00F5
+    { 21, 30, 368, 1, 29, 158, 12715 }, // U+00F6
+    { 17, 21, 339, 2, 24, 90, 12873 }, // U+00F7
+    { 21, 24, 368, 1, 22, 126, 12963 }, // U+00F8
+    { 25, 30, 400, 0, 29, 188, 13089 }, // U+00F9
+    { 25, 30, 400, 0, 29, 188, 13277 }, // U+00FA
+    { 25, 30, 400, 0, 29, 188, 13465 }, // U+00FB
+    { 25, 30, 400, 0, 29, 188, 13653 }, // U+00FC
+    { 22, 38, 347, 0, 29, 209, 13841 }, // U+00FD
+    { 23, 38, 387, 0, 29, 219, 14050 }, // U+00FE
+    { 22, 38, 347, 0, 29, 209, 14269 }, // U+00FF
     { 29, 32, 452, 0, 32, 232, 0 }, // U+0100
     { 21, 27, 360, 1, 26, 142, 232 }, // U+0101
     { 29, 35, 452, 0, 35, 254, 374 }, // U+0102
@@ -3893,98 +3898,98 @@ static const EpdGlyph notoserif_18_boldGlyphs[] = {
     { 11, 5, 186, 0, 13, 14, 233 }, // U+2010
     { 11, 5, 186, 0, 13, 14, 247 }, // U+2011
     { 19, 3, 339, 1, 15, 15, 261 }, // U+2012
-    { 20, 4, 300, -1, 12, 20, 276 }, // U+2013
-    { 39, 4, 600, -1, 12, 39, 296 }, // U+2014
-    { 39, 4, 600, -1, 12, 39, 335 }, // U+2015
-    { 11, 38, 335, 5, 29, 105, 374 }, // U+2016
-    { 17, 8, 247, -1, 0, 34, 479 }, // U+2017
-    { 7, 12, 168, 2, 27, 21, 513 }, // U+2018
-    { 8, 12, 168, 1, 27, 24, 534 }, // U+2019
-    { 8, 12, 176, 1, 6, 24, 558 }, // U+201A
-    { 7, 12, 168, 2, 27, 21, 582 }, // U+201B
-    { 15, 12, 293, 2, 27, 45, 603 }, // U+201C
-    { 16, 12, 293, 1, 27, 48, 648 }, // U+201D
-    { 16, 12, 293, 1, 6, 48, 696 }, // U+201E
-    { 15, 12, 293, 2, 27, 45, 744 }, // U+201F
-    { 16, 34, 287, 1, 29, 136, 789 }, // U+2020
-    { 16, 34, 287, 1, 29, 136, 925 }, // U+2021
-    { 11, 13, 240, 2, 20, 36, 1061 }, // U+2022
-    { 13, 13, 300, 3, 20, 43, 1097 }, // U+2023
-    { 7, 7, 176, 2, 17, 13, 1140 }, // U+2024
-    { 18, 7, 346, 2, 17, 32, 1153 }, // U+2025
-    { 30, 7, 548, 2, 6, 53, 1185 }, // U+2026
-    { 7, 7, 176, 2, 15, 13, 1238 }, // U+2027
-    { 0, 0, 360, 0, 0, 0, 1251 }, // U+2028
-    { 0, 0, 360, 0, 0, 0, 1251 }, // U+2029
-    { 9, 28, 0, -1, 23, 63, 1251 }, // U+202A
-    { 9, 28, 0, -8, 23, 63, 1314 }, // U+202B
-    { 10, 31, 0, -5, 26, 78, 1377 }, // U+202C
-    { 10, 31, 0, -5, 26, 78, 1455 }, // U+202D
-    { 10, 31, 0, -5, 26, 78, 1533 }, // U+202E
-    { 0, 0, 100, 0, 0, 0, 1611 }, // U+202F
-    { 47, 29, 786, 1, 28, 341, 1611 }, // U+2030
-    { 63, 29, 1038, 1, 28, 457, 1952 }, // U+2031
-    { 9, 10, 151, 0, 27, 23, 2409 }, // U+2032
-    { 18, 10, 295, 0, 27, 45, 2432 }, // U+2033
-    { 27, 10, 439, 0, 27, 68, 2477 }, // U+2034
-    { 9, 10, 151, 0, 27, 23, 2545 }, // U+2035
-    { 18, 10, 295, 0, 27, 45, 2568 }, // U+2036
-    { 27, 10, 439, 0, 27, 68, 2613 }, // U+2037
-    { 15, 11, 264, 1, 2, 42, 2681 }, // U+2038
-    { 9, 16, 212, 2, 18, 36, 2723 }, // U+2039
-    { 9, 16, 212, 2, 18, 36, 2759 }, // U+203A
-    { 27, 27, 491, 2, 27, 183, 2795 }, // U+203B
-    { 17, 28, 377, 3, 27, 119, 2978 }, // U+203C
-    { 21, 29, 370, 1, 28, 153, 3097 }, // U+203D
-    { 19, 3, 275, -1, 31, 15, 3250 }, // U+203E
-    { 30, 7, 0, -15, -1, 53, 3265 }, // U+203F
-    { 32, 8, 0, -16, 32, 64, 3318 }, // U+2040
-    { 17, 27, 270, 0, 27, 115, 3382 }, // U+2041
-    { 36, 29, 600, 1, 29, 261, 3497 }, // U+2042
-    { 11, 7, 217, 1, 17, 20, 3758 }, // U+2043
-    { 17, 27, 37, -7, 27, 115, 3778 }, // U+2044
-    { 12, 34, 249, 3, 29, 102, 3893 }, // U+2045
-    { 11, 34, 249, 1, 29, 94, 3995 }, // U+2046
-    { 37, 29, 640, 1, 28, 269, 4089 }, // U+2047
-    { 27, 29, 506, 1, 28, 196, 4358 }, // U+2048
-    { 27, 29, 509, 3, 28, 196, 4554 }, // U+2049
-    { 19, 29, 366, 1, 22, 138, 4750 }, // U+204A
-    { 22, 34, 376, 1, 29, 187, 4888 }, // U+204B
-    { 21, 14, 370, 1, 21, 74, 5075 }, // U+204C
-    { 21, 14, 370, 1, 21, 74, 5149 }, // U+204D
-    { 17, 16, 301, 1, 21, 68, 5223 }, // U+204E
-    { 8, 27, 182, 2, 21, 54, 5291 }, // U+204F
-    { 27, 29, 462, 1, 28, 196, 5345 }, // U+2050
-    { 17, 32, 301, 1, 29, 136, 5541 }, // U+2051
-    { 15, 28, 242, 0, 27, 105, 5677 }, // U+2052
-    { 19, 8, 335, 1, 17, 38, 5782 }, // U+2053
-    { 30, 8, 0, -15, 0, 60, 5820 }, // U+2054
-    { 18, 18, 324, 1, 22, 81, 5880 }, // U+2055
-    { 19, 22, 378, 2, 21, 105, 5961 }, // U+2056
-    { 36, 10, 582, 0, 27, 90, 6066 }, // U+2057
-    { 25, 22, 459, 2, 21, 138, 6156 }, // U+2058
-    { 25, 22, 459, 2, 21, 138, 6294 }, // U+2059
-    { 7, 29, 182, 2, 28, 51, 6432 }, // U+205A
-    { 25, 29, 459, 2, 28, 182, 6483 }, // U+205B
-    { 21, 21, 418, 3, 21, 111, 6665 }, // U+205C
-    { 7, 29, 182, 2, 28, 51, 6776 }, // U+205D
-    { 7, 29, 182, 2, 28, 51, 6827 }, // U+205E
-    { 0, 0, 133, 0, 0, 0, 6878 }, // U+205F
-    { 0, 0, 360, 0, 0, 0, 6878 }, // U+2060
-    { 0, 0, 360, 0, 0, 0, 6878 }, // U+2061
-    { 0, 0, 360, 0, 0, 0, 6878 }, // U+2062
-    { 0, 0, 360, 0, 0, 0, 6878 }, // U+2063
-    { 0, 0, 360, 0, 0, 0, 6878 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 6878 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 6878 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 6878 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 6878 }, // U+2069
-    { 10, 31, 0, -5, 26, 78, 6878 }, // U+206A
-    { 10, 31, 0, -5, 26, 78, 6956 }, // U+206B
-    { 10, 31, 0, -5, 26, 78, 7034 }, // U+206C
-    { 10, 31, 0, -5, 26, 78, 7112 }, // U+206D
-    { 10, 31, 0, -5, 26, 78, 7190 }, // U+206E
-    { 10, 31, 0, -5, 26, 78, 7268 }, // U+206F
+    { 20, 4, 300, -1, 12, 20, 10015 }, // U+2013
+    { 39, 4, 600, -1, 12, 39, 10035 }, // U+2014
+    { 39, 4, 600, -1, 12, 39, 276 }, // U+2015
+    { 11, 38, 335, 5, 29, 105, 315 }, // U+2016
+    { 17, 8, 247, -1, 0, 34, 420 }, // U+2017
+    { 7, 12, 168, 2, 27, 21, 454 }, // U+2018
+    { 8, 12, 168, 1, 27, 24, 10074 }, // U+2019
+    { 8, 12, 176, 1, 6, 24, 475 }, // U+201A
+    { 7, 12, 168, 2, 27, 21, 499 }, // U+201B
+    { 15, 12, 293, 2, 27, 45, 10098 }, // U+201C
+    { 16, 12, 293, 1, 27, 48, 10143 }, // U+201D
+    { 16, 12, 293, 1, 6, 48, 520 }, // U+201E
+    { 15, 12, 293, 2, 27, 45, 568 }, // U+201F
+    { 16, 34, 287, 1, 29, 136, 613 }, // U+2020
+    { 16, 34, 287, 1, 29, 136, 749 }, // U+2021
+    { 11, 13, 240, 2, 20, 36, 885 }, // U+2022
+    { 13, 13, 300, 3, 20, 43, 921 }, // U+2023
+    { 7, 7, 176, 2, 17, 13, 964 }, // U+2024
+    { 18, 7, 346, 2, 17, 32, 977 }, // U+2025
+    { 30, 7, 548, 2, 6, 53, 10191 }, // U+2026
+    { 7, 7, 176, 2, 15, 13, 1009 }, // U+2027
+    { 0, 0, 360, 0, 0, 0, 1022 }, // U+2028
+    { 0, 0, 360, 0, 0, 0, 1022 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 1022 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 1085 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 1148 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 1226 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 1304 }, // U+202E
+    { 0, 0, 100, 0, 0, 0, 1382 }, // U+202F
+    { 47, 29, 786, 1, 28, 341, 1382 }, // U+2030
+    { 63, 29, 1038, 1, 28, 457, 1723 }, // U+2031
+    { 9, 10, 151, 0, 27, 23, 2180 }, // U+2032
+    { 18, 10, 295, 0, 27, 45, 2203 }, // U+2033
+    { 27, 10, 439, 0, 27, 68, 2248 }, // U+2034
+    { 9, 10, 151, 0, 27, 23, 2316 }, // U+2035
+    { 18, 10, 295, 0, 27, 45, 2339 }, // U+2036
+    { 27, 10, 439, 0, 27, 68, 2384 }, // U+2037
+    { 15, 11, 264, 1, 2, 42, 2452 }, // U+2038
+    { 9, 16, 212, 2, 18, 36, 2494 }, // U+2039
+    { 9, 16, 212, 2, 18, 36, 2530 }, // U+203A
+    { 27, 27, 491, 2, 27, 183, 2566 }, // U+203B
+    { 17, 28, 377, 3, 27, 119, 2749 }, // U+203C
+    { 21, 29, 370, 1, 28, 153, 2868 }, // U+203D
+    { 19, 3, 275, -1, 31, 15, 3021 }, // U+203E
+    { 30, 7, 0, -15, -1, 53, 3036 }, // U+203F
+    { 32, 8, 0, -16, 32, 64, 3089 }, // U+2040
+    { 17, 27, 270, 0, 27, 115, 3153 }, // U+2041
+    { 36, 29, 600, 1, 29, 261, 3268 }, // U+2042
+    { 11, 7, 217, 1, 17, 20, 3529 }, // U+2043
+    { 17, 27, 37, -7, 27, 115, 3549 }, // U+2044
+    { 12, 34, 249, 3, 29, 102, 3664 }, // U+2045
+    { 11, 34, 249, 1, 29, 94, 3766 }, // U+2046
+    { 37, 29, 640, 1, 28, 269, 3860 }, // U+2047
+    { 27, 29, 506, 1, 28, 196, 4129 }, // U+2048
+    { 27, 29, 509, 3, 28, 196, 4325 }, // U+2049
+    { 19, 29, 366, 1, 22, 138, 4521 }, // U+204A
+    { 22, 34, 376, 1, 29, 187, 4659 }, // U+204B
+    { 21, 14, 370, 1, 21, 74, 4846 }, // U+204C
+    { 21, 14, 370, 1, 21, 74, 4920 }, // U+204D
+    { 17, 16, 301, 1, 21, 68, 4994 }, // U+204E
+    { 8, 27, 182, 2, 21, 54, 5062 }, // U+204F
+    { 27, 29, 462, 1, 28, 196, 5116 }, // U+2050
+    { 17, 32, 301, 1, 29, 136, 5312 }, // U+2051
+    { 15, 28, 242, 0, 27, 105, 5448 }, // U+2052
+    { 19, 8, 335, 1, 17, 38, 5553 }, // U+2053
+    { 30, 8, 0, -15, 0, 60, 5591 }, // U+2054
+    { 18, 18, 324, 1, 22, 81, 5651 }, // U+2055
+    { 19, 22, 378, 2, 21, 105, 5732 }, // U+2056
+    { 36, 10, 582, 0, 27, 90, 5837 }, // U+2057
+    { 25, 22, 459, 2, 21, 138, 5927 }, // U+2058
+    { 25, 22, 459, 2, 21, 138, 6065 }, // U+2059
+    { 7, 29, 182, 2, 28, 51, 6203 }, // U+205A
+    { 25, 29, 459, 2, 28, 182, 6254 }, // U+205B
+    { 21, 21, 418, 3, 21, 111, 6436 }, // U+205C
+    { 7, 29, 182, 2, 28, 51, 6547 }, // U+205D
+    { 7, 29, 182, 2, 28, 51, 6598 }, // U+205E
+    { 0, 0, 133, 0, 0, 0, 6649 }, // U+205F
+    { 0, 0, 360, 0, 0, 0, 6649 }, // U+2060
+    { 0, 0, 360, 0, 0, 0, 6649 }, // U+2061
+    { 0, 0, 360, 0, 0, 0, 6649 }, // U+2062
+    { 0, 0, 360, 0, 0, 0, 6649 }, // U+2063
+    { 0, 0, 360, 0, 0, 0, 6649 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 6649 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 6649 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 6649 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 6649 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 6649 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 6727 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 6805 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 6883 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 6961 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 7039 }, // U+206F
     { 15, 17, 240, 0, 31, 64, 0 }, // U+2070
     { 9, 19, 137, 0, 29, 43, 64 }, // U+2071
     { 15, 17, 240, 0, 31, 64, 107 }, // U+2074
@@ -4061,13 +4066,13 @@ static const EpdGlyph notoserif_18_boldGlyphs[] = {
     { 19, 33, 339, 1, 30, 157, 5863 }, // U+20BF
     { 18, 28, 316, 1, 21, 126, 6020 }, // U+20C0
     { 18, 4, 344, 2, 15, 18, 0 }, // U+2212
-    { 32, 29, 457, 0, 29, 232, 0 }, // U+FB00
-    { 27, 29, 431, 0, 29, 196, 232 }, // U+FB01
-    { 27, 29, 431, 0, 29, 196, 428 }, // U+FB02
-    { 40, 29, 644, 0, 29, 290, 624 }, // U+FB03
-    { 40, 29, 644, 0, 29, 290, 914 }, // U+FB04
-    { 28, 30, 452, 0, 29, 210, 1204 }, // U+FB05
-    { 31, 30, 521, 1, 29, 233, 1414 }, // U+FB06
+    { 32, 29, 457, 0, 29, 232, 10244 }, // U+FB00
+    { 27, 29, 431, 0, 29, 196, 10476 }, // U+FB01
+    { 27, 29, 431, 0, 29, 196, 10672 }, // U+FB02
+    { 40, 29, 644, 0, 29, 290, 10868 }, // U+FB03
+    { 40, 29, 644, 0, 29, 290, 11158 }, // U+FB04
+    { 28, 30, 452, 0, 29, 210, 0 }, // U+FB05
+    { 31, 30, 521, 1, 29, 233, 210 }, // U+FB06
     { 35, 35, 600, 1, 29, 307, 0 }, // U+FFFD
 };
 
@@ -4075,8 +4080,7 @@ static const EpdUnicodeInterval notoserif_18_boldIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -4084,8 +4088,7 @@ static const EpdUnicodeInterval notoserif_18_boldIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -4095,19 +4098,57 @@ static const EpdUnicodeInterval notoserif_18_boldIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_18_boldGroups[] = {
-    { 0, 5143, 13082, 97, 0 },
-    { 5143, 4465, 15895, 96, 97 },
-    { 9608, 5544, 25130, 128, 193 },
-    { 15152, 5417, 22592, 96, 321 },
-    { 20569, 1771, 3129, 112, 417 },
-    { 22340, 14939, 52237, 256, 529 },
-    { 37279, 2964, 21126, 90, 785 },
-    { 40243, 2952, 8055, 111, 875 },
-    { 43195, 920, 2457, 42, 986 },
-    { 44115, 2951, 6493, 33, 1028 },
-    { 47066, 13, 20, 1, 1061 },
-    { 47079, 534, 1668, 7, 1062 },
-    { 47613, 170, 315, 1, 1069 },
+    { 0, 4514, 12117, 83, 2 },
+    { 4514, 1144, 2599, 26, 0 },
+    { 5658, 4444, 15715, 95, 97 },
+    { 10102, 5544, 25130, 128, 193 },
+    { 15646, 5417, 22592, 96, 321 },
+    { 21063, 1771, 3129, 112, 417 },
+    { 22834, 14939, 52237, 256, 529 },
+    { 37773, 2964, 21126, 90, 785 },
+    { 40737, 2852, 7819, 105, 875 },
+    { 43589, 920, 2457, 42, 986 },
+    { 44509, 2951, 6493, 33, 1028 },
+    { 47460, 13, 20, 1, 1061 },
+    { 47473, 223, 450, 2, 1067 },
+    { 47696, 170, 315, 1, 1069 },
+};
+
+static const uint16_t notoserif_18_boldGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_18_boldKernLeftClasses[] = {
@@ -5027,18 +5068,81 @@ static const EpdLigaturePair notoserif_18_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_18_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 51 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_18_bold = {
     notoserif_18_boldBitmaps,
     notoserif_18_boldGlyphs,
     notoserif_18_boldIntervals,
-    20,
+    18,
     51,
     41,
     -11,
     true,
     notoserif_18_boldGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_18_boldGlyphToGroup,
     notoserif_18_boldKernLeftClasses,
     notoserif_18_boldKernRightClasses,
     notoserif_18_boldKernMatrix,
@@ -5048,4 +5152,8 @@ static const EpdFontData notoserif_18_bold = {
     66,
     notoserif_18_boldLigaturePairs,
     5,
+    notoserif_18_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
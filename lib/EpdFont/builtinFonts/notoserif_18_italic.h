@@ -3,3322 +3,3329 @@
  * name: notoserif_18_italic
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_18_italic 18 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_18_italic 18 ../builtinFonts/source/NotoSerif/NotoSerif-Italic.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_18_italicBitmaps[52953] = {
-    0xD5, 0x5B, 0x3D, 0xD0, 0xDD, 0x58, 0x79, 0x3E, 0x92, 0xB0, 0x35, 0xA0, 0x09, 0xA2, 0xD8, 0x05,
-    0x26, 0x4E, 0x56, 0x4D, 0x8A, 0x0C, 0x83, 0xAD, 0xD6, 0xC9, 0xD8, 0x9F, 0x04, 0x14, 0xB4, 0xCE,
-    0xCC, 0x3A, 0x99, 0x24, 0x05, 0x29, 0x52, 0xB1, 0xC5, 0x97, 0x62, 0x8B, 0x2D, 0xBE, 0x5D, 0x29,
-    0x4B, 0x91, 0x82, 0x22, 0x6E, 0xA0, 0xC5, 0xC5, 0x66, 0x26, 0x98, 0x62, 0x99, 0xCC, 0x16, 0x9E,
-    0xC4, 0xB6, 0x04, 0x5B, 0x50, 0xA4, 0xE0, 0x26, 0xCC, 0x40, 0x89, 0x92, 0x2C, 0x43, 0x20, 0x99,
-    0xB1, 0x02, 0x77, 0x41, 0xB6, 0x75, 0xA5, 0x3C, 0xCF, 0xF3, 0x1E, 0xE9, 0xDE, 0xEB, 0x3F, 0x08,
-    0x99, 0x24, 0x93, 0xFB, 0xDD, 0x7B, 0x8E, 0x7C, 0xAF, 0x74, 0xCE, 0xFB, 0xFF, 0x7B, 0xEC, 0xB2,
-    0xCE, 0xE5, 0x1B, 0x57, 0xB4, 0x7A, 0xD7, 0xAE, 0x2A, 0x5D, 0xE5, 0x5C, 0xE3, 0xDC, 0xE4, 0xDC,
-    0xCE, 0xB9, 0x91, 0xEF, 0x60, 0xEB, 0xC2, 0x9E, 0xEF, 0xA8, 0x73, 0xD1, 0xC6, 0x45, 0xAD, 0x8B,
-    0x5B, 0x17, 0x94, 0xCE, 0x5E, 0x19, 0x9E, 0x68, 0x5D, 0xA3, 0x37, 0x9E, 0xFE, 0x00, 0xBE, 0xD9,
-    0x14, 0x65, 0xD6, 0x56, 0x65, 0xDE, 0x56, 0x2E, 0xAF, 0xEF, 0xB9, 0xDC, 0xDD, 0x71, 0x05, 0x3E,
-    0x27, 0x6E, 0x70, 0x57, 0x5C, 0xAF, 0x8F, 0xBD, 0x52, 0x77, 0x91, 0x2B, 0xB8, 0xAB, 0x18, 0x2F,
-    0xE1, 0x7B, 0x87, 0xAB, 0xDB, 0x18, 0xCF, 0xDC, 0x16, 0xE3, 0x6D, 0xDD, 0xB7, 0x0D, 0x7A, 0x17,
-    0x5C, 0x7F, 0xFF, 0x0F, 0xDE, 0x2F, 0xA3, 0x19, 0xAF, 0x36, 0xE4, 0x58, 0x03, 0x8A, 0xA4, 0x76,
-    0x00, 0x24, 0x05, 0x1C, 0x49, 0x9D, 0x72, 0xB1, 0x32, 0xD3, 0x92, 0x97, 0x30, 0xE6, 0x7E, 0xB1,
-    0x33, 0xE7, 0x0A, 0xDC, 0x3E, 0xF8, 0xF1, 0xC5, 0x07, 0xBF, 0xFF, 0xFE, 0x35, 0xE7, 0xFA, 0xB0,
-    0x73, 0x2E, 0xE8, 0x81, 0x8B, 0x0B, 0x3B, 0xA0, 0x03, 0xAC, 0x62, 0x8E, 0x07, 0x4B, 0xDA, 0x62,
-    0x78, 0x7D, 0x9C, 0xC3, 0x95, 0x65, 0x38, 0x7F, 0x0F, 0xBF, 0x35, 0xF3, 0xD6, 0xC5, 0xC3, 0x4F,
-    0x76, 0x2E, 0xDD, 0xF4, 0xB3, 0xCB, 0xDB, 0xAE, 0x72, 0xC5, 0x9F, 0x6F, 0x4E, 0x5C, 0xF1, 0xE9,
-    0xCD, 0x6F, 0xB9, 0xE2, 0x0B, 0x58, 0xA9, 0x78, 0x17, 0x43, 0xFE, 0x43, 0xAC, 0x96, 0xCE, 0x78,
-    0x20, 0x9A, 0xB1, 0x93, 0xC3, 0xFE, 0xC0, 0x75, 0xD6, 0x80, 0x9F, 0x2F, 0xE6, 0x5D, 0xE0, 0xAE,
-    0xA4, 0x7D, 0xE6, 0xAE, 0x24, 0x7D, 0xE1, 0x2E, 0x63, 0x28, 0x5F, 0x4D, 0xBB, 0xA2, 0x7D, 0x27,
-    0x6D, 0xF3, 0xAE, 0x2F, 0xEA, 0x74, 0xF7, 0xB3, 0xC9, 0x01, 0x5B, 0x90, 0xE2, 0x63, 0x0F, 0xF0,
-    0x54, 0x88, 0x87, 0x48, 0x7C, 0x3F, 0xC4, 0xB5, 0xDB, 0xBF, 0xB2, 0x81, 0x48, 0x80, 0x6B, 0x60,
-    0x5E, 0xDA, 0xBA, 0xA8, 0x4F, 0x6B, 0xD0, 0xC0, 0x25, 0x1B, 0xFC, 0xE3, 0x2A, 0xBF, 0x4A, 0x37,
-    0x20, 0xBE, 0xCB, 0xCB, 0x74, 0x03, 0x3E, 0x82, 0x1B, 0xE9, 0x26, 0xDE, 0x68, 0x6E, 0x71, 0xA7,
-    0x7B, 0x03, 0x33, 0x6E, 0xC7, 0x9C, 0xB5, 0xAF, 0x63, 0xBE, 0x8B, 0x3B, 0x07, 0x77, 0xCD, 0xBD,
-    0xEE, 0x8A, 0xA8, 0xCF, 0x26, 0x7C, 0x7F, 0x37, 0x69, 0xDF, 0xF8, 0x5C, 0x5B, 0xB8, 0x31, 0xFB,
-    0xD4, 0x90, 0x6C, 0xF2, 0xCF, 0xF6, 0x27, 0x51, 0x1F, 0x77, 0xC9, 0x5C, 0xDF, 0x49, 0x36, 0x51,
-    0xEF, 0x5E, 0x0E, 0xB6, 0x69, 0x8B, 0x19, 0x22, 0x92, 0xD5, 0x31, 0xE6, 0xA4, 0xCD, 0xCB, 0xB8,
-    0xA3, 0x74, 0x14, 0x2E, 0xC1, 0x7C, 0xA2, 0x3D, 0x29, 0x4D, 0xDC, 0x93, 0xC2, 0x54, 0x40, 0x36,
-    0x1C, 0x80, 0xC8, 0x71, 0xC5, 0xAF, 0xB2, 0xF2, 0x2E, 0xF9, 0xE6, 0xD2, 0xEF, 0x02, 0x61, 0x00,
-    0x11, 0x92, 0x48, 0x7C, 0xBD, 0x70, 0x80, 0x67, 0x32, 0x77, 0x9C, 0x9A, 0x7F, 0xDB, 0x91, 0x20,
-    0x3B, 0x0A, 0xAA, 0x8B, 0x06, 0x0A, 0xAE, 0xC3, 0xAE, 0x9C, 0x92, 0x9E, 0xEB, 0x72, 0x2A, 0x4A,
-    0x4D, 0x15, 0x69, 0xB5, 0x0D, 0xF8, 0x40, 0x34, 0x66, 0x94, 0xAB, 0x70, 0x9A, 0x25, 0xBC, 0xF3,
-    0x7B, 0xAE, 0x1A, 0x5D, 0x8C, 0x7D, 0xC0, 0x9A, 0xEA, 0x7E, 0x07, 0x99, 0x8F, 0x76, 0xE9, 0x36,
-    0x18, 0x5C, 0xDA, 0x47, 0x23, 0x40, 0xCC, 0xDB, 0x70, 0x82, 0xCC, 0x63, 0xD9, 0xF9, 0xB3, 0x2D,
-    0xF7, 0x2A, 0xBE, 0x5D, 0x73, 0x22, 0x13, 0x31, 0x25, 0x3B, 0x4D, 0x11, 0x26, 0x08, 0x7E, 0x88,
-    0x2F, 0xA1, 0x43, 0x09, 0x96, 0xC3, 0x2E, 0x55, 0xDE, 0x61, 0xE5, 0xB7, 0x87, 0x74, 0xC2, 0x13,
-    0xF3, 0x0D, 0x6E, 0x12, 0x5C, 0x13, 0xA7, 0x36, 0x79, 0x9B, 0xD7, 0x05, 0xC8, 0x72, 0x02, 0xCE,
-    0x5C, 0x71, 0x97, 0x0D, 0xB1, 0x8F, 0x50, 0x20, 0xF9, 0xAB, 0x96, 0x0C, 0x47, 0x81, 0x0E, 0x00,
-    0xB4, 0xB4, 0xC3, 0xD2, 0x44, 0x20, 0x1A, 0x89, 0x0A, 0x48, 0xD4, 0xDB, 0x87, 0x77, 0xF3, 0x96,
-    0x62, 0xF9, 0xD4, 0x76, 0xBB, 0x3E, 0xEE, 0xF8, 0x53, 0xF0, 0x83, 0xEF, 0x49, 0x1C, 0x50, 0x1B,
-    0xA2, 0x81, 0xF5, 0xA8, 0x5F, 0xA3, 0x14, 0xC5, 0x51, 0x71, 0xF5, 0x8A, 0xEA, 0x83, 0x1F, 0x4E,
-    0xA8, 0x4B, 0x78, 0x2A, 0x6B, 0xED, 0x29, 0xB2, 0x90, 0xEC, 0x24, 0x70, 0xCB, 0x67, 0x81, 0x26,
-    0xED, 0xEC, 0x73, 0x04, 0x55, 0xBD, 0x22, 0x40, 0x8B, 0x42, 0xBC, 0xC0, 0x2E, 0x3D, 0xC6, 0xDB,
-    0xF8, 0x33, 0x7E, 0x0A, 0x07, 0x7B, 0x92, 0x77, 0xBE, 0xB5, 0xF2, 0x5A, 0xE4, 0x22, 0x21, 0x38,
-    0x64, 0x2D, 0xF0, 0xCE, 0xFA, 0xFE, 0x1C, 0xD6, 0xE8, 0x40, 0xA1, 0xFC, 0xFE, 0xEC, 0xCE, 0x9D,
-    0xCE, 0x3F, 0x06, 0x71, 0xF1, 0x70, 0xF5, 0x9D, 0xA6, 0x76, 0x97, 0xE3, 0x2F, 0xE2, 0x9E, 0xE4,
-    0x4D, 0xDC, 0x9D, 0xD6, 0xEF, 0x50, 0xF4, 0x40, 0xD4, 0x0B, 0x8B, 0x99, 0x32, 0xF2, 0x53, 0xF1,
-    0x9F, 0x39, 0x7C, 0xFE, 0x6B, 0x0F, 0x6F, 0x95, 0x0D, 0xAD, 0x8B, 0xAE, 0x9E, 0x7F, 0xB3, 0x0B,
-    0x6E, 0xE0, 0xF3, 0x5E, 0xBC, 0x8B, 0xA7, 0x68, 0x02, 0x6E, 0xE4, 0xE5, 0x36, 0x81, 0x15, 0xF8,
-    0x88, 0xFB, 0xC4, 0xAD, 0xBF, 0x2E, 0xE6, 0xA1, 0xA2, 0xE2, 0xC2, 0x34, 0xE5, 0x5D, 0xD1, 0x17,
-    0x5D, 0xEE, 0x85, 0xF9, 0x26, 0x1F, 0x27, 0x75, 0xA9, 0xAD, 0xB4, 0xA3, 0x34, 0x35, 0xB2, 0x81,
-    0x9E, 0x0D, 0x34, 0x59, 0x8E, 0xBA, 0x2A, 0x79, 0xB0, 0xAD, 0xA4, 0xEF, 0xB4, 0x4D, 0x8E, 0x76,
-    0x8E, 0x4A, 0xE2, 0xEF, 0xBD, 0xC3, 0x61, 0xBB, 0xDC, 0xFB, 0xB4, 0x25, 0x4F, 0xD6, 0x25, 0x69,
-    0x57, 0xDD, 0x63, 0x4B, 0xAE, 0xF7, 0xEE, 0x97, 0xFC, 0xED, 0x03, 0x6D, 0x6B, 0x68, 0x55, 0x66,
-    0x28, 0x0B, 0x84, 0x16, 0x3E, 0x82, 0x6C, 0xDB, 0xB9, 0x68, 0x1B, 0x8C, 0x60, 0x62, 0xB4, 0x85,
-    0x38, 0x42, 0xE7, 0xA2, 0x11, 0x9C, 0xC3, 0xB0, 0xA1, 0x76, 0xC1, 0xF2, 0x8C, 0xC0, 0x34, 0x1A,
-    0x0A, 0x0D, 0xB0, 0xD2, 0x5B, 0xC8, 0x5C, 0xDC, 0x83, 0xB1, 0x89, 0x1F, 0x28, 0x43, 0x32, 0x52,
-    0x15, 0x65, 0xB1, 0xA2, 0x50, 0x16, 0xF4, 0x39, 0xB8, 0x79, 0x47, 0x85, 0x83, 0xF2, 0x75, 0xD8,
-    0x27, 0x9A, 0xC0, 0x51, 0xD7, 0x50, 0x6B, 0xCF, 0x19, 0x0B, 0x81, 0x6B, 0x0C, 0xD6, 0x16, 0x83,
-    0x0B, 0x1F, 0x6D, 0xDD, 0xE9, 0xF7, 0xFA, 0x60, 0xC6, 0x7D, 0xC3, 0x22, 0x79, 0xCF, 0xD2, 0x05,
-    0x5A, 0x08, 0x2F, 0x7D, 0x54, 0xA1, 0x70, 0xE7, 0xA5, 0xD0, 0x4B, 0x22, 0xD5, 0x49, 0xD2, 0xB8,
-    0x75, 0x9F, 0x98, 0xA7, 0xB7, 0xAA, 0x59, 0x56, 0x5A, 0xAF, 0xD3, 0x99, 0x9A, 0x30, 0x93, 0x08,
-    0xE9, 0x96, 0x4A, 0x8E, 0x65, 0x67, 0x29, 0xD1, 0x2C, 0x75, 0x9A, 0xE9, 0xB3, 0xB4, 0xB6, 0x56,
-    0x77, 0x72, 0x98, 0x26, 0xCC, 0x5E, 0x83, 0xA4, 0x2E, 0xA6, 0x40, 0x32, 0x69, 0x8E, 0xAE, 0x94,
-    0x3C, 0x3A, 0xF8, 0x5A, 0x2C, 0x0C, 0xED, 0xEE, 0xD6, 0x73, 0xEC, 0x23, 0x12, 0x80, 0xDE, 0xC1,
-    0x80, 0x06, 0x1D, 0x1D, 0x2C, 0x94, 0x95, 0x0E, 0xAC, 0xF5, 0xA3, 0x64, 0x74, 0xE5, 0x52, 0x3E,
-    0xDF, 0xA0, 0xB5, 0xBC, 0x4F, 0x38, 0x87, 0x00, 0x90, 0xC0, 0xA5, 0xCF, 0x22, 0x46, 0x53, 0x52,
-    0xDD, 0x41, 0x05, 0x88, 0x02, 0xAE, 0x03, 0x0F, 0x6D, 0x20, 0x68, 0x49, 0x01, 0x53, 0x5C, 0x10,
-    0x8A, 0xAB, 0x49, 0x5E, 0xDD, 0xFC, 0x40, 0xB7, 0xD8, 0xFA, 0x79, 0xB7, 0xBF, 0x27, 0x31, 0xD0,
-    0x0F, 0x46, 0x7C, 0x93, 0xE9, 0xD7, 0x42, 0x7B, 0x82, 0xE2, 0x8C, 0x21, 0xBA, 0x80, 0x02, 0x33,
-    0x37, 0x23, 0x81, 0x22, 0x68, 0xEE, 0xDC, 0x35, 0x0F, 0xA9, 0xED, 0xAB, 0x31, 0x15, 0xAD, 0x72,
-    0xC1, 0xF0, 0x06, 0xC7, 0xE0, 0xA7, 0xA4, 0x5B, 0xF4, 0x1D, 0xAE, 0x9C, 0xFE, 0x05, 0x77, 0x3C,
-    0x49, 0x64, 0x85, 0xB8, 0x7B, 0xD8, 0x93, 0xC5, 0x49, 0x4B, 0x26, 0x67, 0x25, 0x8D, 0xD1, 0xEB,
-    0x62, 0xF6, 0xC0, 0x1D, 0xCD, 0x42, 0xA7, 0x8A, 0x3E, 0xF2, 0x2F, 0x5D, 0x6F, 0xBE, 0x54, 0x56,
-    0x0A, 0x11, 0x3E, 0x7F, 0xEB, 0xD6, 0x7C, 0x6B, 0x65, 0x4B, 0x60, 0xCC, 0x19, 0xF7, 0xA8, 0x53,
-    0x9A, 0xDC, 0x87, 0x9A, 0xF9, 0x26, 0xBD, 0xF4, 0xDC, 0x0B, 0xDC, 0x89, 0xF2, 0x3E, 0x73, 0x98,
-    0xA8, 0x70, 0xAF, 0x53, 0xE1, 0x3E, 0x69, 0xC3, 0x4B, 0x7C, 0xE6, 0x93, 0x6B, 0x34, 0xF0, 0x1A,
-    0x87, 0x77, 0x38, 0x3C, 0x22, 0x92, 0xF3, 0x3C, 0xD2, 0x1A, 0x88, 0xBE, 0x0D, 0xF9, 0x48, 0x19,
-    0x64, 0x64, 0x25, 0xD2, 0x98, 0x78, 0xDA, 0x90, 0xB7, 0x1F, 0xE7, 0xAF, 0xAF, 0x53, 0x3C, 0xEF,
-    0x91, 0x26, 0x4D, 0x09, 0x48, 0x8A, 0x87, 0xF0, 0x6C, 0xC9, 0x4C, 0xDA, 0xBC, 0x58, 0xEE, 0xDD,
-    0x3A, 0xD8, 0x10, 0xCC, 0x6F, 0xF7, 0x20, 0x35, 0x84, 0x15, 0xDA, 0x31, 0x42, 0x9E, 0xC3, 0x01,
-    0xB8, 0x04, 0x9D, 0x90, 0x10, 0x23, 0xC4, 0x1F, 0x12, 0x08, 0x77, 0xC0, 0x8A, 0x17, 0xDF, 0x9A,
-    0x29, 0x2E, 0x6F, 0xC3, 0xA7, 0xD1, 0xED, 0x81, 0xB7, 0x33, 0xB5, 0xA0, 0x2A, 0xF7, 0xC3, 0xBD,
-    0xC3, 0xA1, 0xA1, 0x7F, 0x98, 0xC0, 0x44, 0xDC, 0x9C, 0x97, 0x58, 0x36, 0xDD, 0x60, 0xC5, 0x78,
-    0xA2, 0xFF, 0x9D, 0x17, 0x05, 0x4C, 0x19, 0x3F, 0x65, 0x18, 0xB6, 0x39, 0x86, 0xFE, 0x84, 0x36,
-    0xE1, 0x0A, 0x35, 0xF8, 0x55, 0xEA, 0xC2, 0xD7, 0x9D, 0xBB, 0x47, 0x1A, 0x13, 0xA4, 0x88, 0x20,
-    0xC5, 0xFD, 0x22, 0xFD, 0xF4, 0x37, 0x72, 0x3E, 0xE2, 0xFE, 0xFE, 0x8E, 0xE4, 0xF8, 0x8E, 0xEA,
-    0x79, 0x77, 0x14, 0xEB, 0x1D, 0xFE, 0x55, 0x81, 0x2E, 0xF1, 0xDC, 0x40, 0xFE, 0x3A, 0x90, 0x04,
-    0x3F, 0x4F, 0xFC, 0xB9, 0x12, 0x9A, 0x5C, 0xA5, 0xA2, 0xA0, 0xDF, 0xE3, 0x3F, 0x47, 0xE0, 0x8F,
-    0xD5, 0x8A, 0x0E, 0x0B, 0xA5, 0x3B, 0x7C, 0x11, 0x53, 0xCC, 0x43, 0x6A, 0x79, 0xFE, 0x95, 0x19,
-    0xE6, 0x20, 0x98, 0x5B, 0x4A, 0x30, 0x0D, 0x74, 0x8A, 0x08, 0xCC, 0x4C, 0x54, 0xDC, 0x37, 0xEB,
-    0x40, 0x63, 0xD5, 0x61, 0x8B, 0xAC, 0x05, 0x23, 0xAB, 0x32, 0x9E, 0x5E, 0xA1, 0xDB, 0x67, 0x1C,
-    0x12, 0xBC, 0x7C, 0x64, 0x29, 0x13, 0x5A, 0xCA, 0x02, 0xEE, 0x1D, 0x9B, 0x27, 0x3D, 0x0C, 0x4D,
-    0xDC, 0x83, 0x69, 0xD1, 0x16, 0x6A, 0x12, 0x6D, 0xB1, 0x07, 0x86, 0x6E, 0x19, 0x20, 0x09, 0x31,
-    0xAF, 0x92, 0x1E, 0x3F, 0xE4, 0x3D, 0x6E, 0x69, 0xFA, 0x68, 0xFA, 0x63, 0xC4, 0x20, 0xF3, 0x7C,
-    0xBA, 0x71, 0xBF, 0xFE, 0x96, 0xC4, 0x47, 0x78, 0x37, 0xA5, 0xB7, 0x60, 0x16, 0xC2, 0x0C, 0x88,
-    0x18, 0x40, 0xDD, 0x3B, 0xA4, 0xCC, 0x3D, 0x85, 0xEB, 0x8C, 0x85, 0x32, 0xC5, 0x45, 0x0B, 0x3C,
-    0x80, 0x7B, 0x2E, 0x03, 0xBE, 0xBD, 0x7D, 0x79, 0xCE, 0x6B, 0x0D, 0xDF, 0xC1, 0xEE, 0x6A, 0x8D,
-    0x02, 0x40, 0xFB, 0x74, 0x4B, 0xA3, 0x98, 0xF5, 0xE6, 0x25, 0x9E, 0xF3, 0x82, 0x3F, 0x49, 0x46,
-    0x06, 0x43, 0xF1, 0x4E, 0x30, 0x9E, 0x49, 0x39, 0x7A, 0x77, 0xA1, 0xF5, 0xB6, 0x8C, 0xAF, 0x72,
-    0xF1, 0x60, 0x44, 0x27, 0x26, 0x26, 0x15, 0x38, 0x1B, 0x93, 0xE3, 0x55, 0xC7, 0x90, 0x8C, 0x82,
-    0xD0, 0x2F, 0xE8, 0x16, 0xC4, 0x46, 0x77, 0xE9, 0x36, 0x45, 0x5A, 0xF8, 0x49, 0x97, 0x32, 0xAF,
-    0xBA, 0x2B, 0xE3, 0x7A, 0x3E, 0x0F, 0x91, 0x49, 0x3C, 0xB6, 0x8B, 0x8F, 0xBF, 0x68, 0x15, 0xCC,
-    0xBD, 0xBF, 0x78, 0xFD, 0xFA, 0x75, 0x41, 0x64, 0x4E, 0x91, 0x9E, 0xC6, 0x29, 0x32, 0x0C, 0x14,
-    0x18, 0xE6, 0x0A, 0x12, 0xE7, 0xD5, 0x00, 0x9A, 0xC5, 0xA2, 0x8D, 0xD4, 0x97, 0xFC, 0x59, 0x37,
-    0x66, 0x5B, 0x6F, 0x28, 0x05, 0x93, 0x6C, 0xE8, 0x9D, 0x35, 0x70, 0xB1, 0x2D, 0xA7, 0x12, 0x62,
-    0xDA, 0x65, 0x5D, 0x0C, 0x8F, 0x18, 0x8E, 0x10, 0xAF, 0x1D, 0x54, 0x61, 0x7A, 0x69, 0xEF, 0x8E,
-    0xBC, 0x1B, 0xA2, 0x0A, 0x83, 0x0D, 0x24, 0x03, 0xB7, 0x9C, 0xBC, 0x5B, 0xEF, 0xCD, 0xB3, 0x2B,
-    0x5D, 0xD9, 0x5B, 0x05, 0x85, 0xFE, 0x19, 0xC3, 0xF8, 0xDE, 0x48, 0x45, 0x83, 0x18, 0xD8, 0x4F,
-    0x1F, 0xBD, 0x77, 0x43, 0x3C, 0x21, 0xAE, 0x84, 0xF5, 0x41, 0x70, 0xDA, 0x9B, 0xC5, 0xA7, 0x62,
-    0xC9, 0x86, 0x17, 0xE6, 0x28, 0x11, 0x24, 0x99, 0x4E, 0x21, 0x6C, 0x18, 0xDD, 0xF9, 0x07, 0x1F,
-    0x40, 0x2A, 0x84, 0xB8, 0xF5, 0xFE, 0x18, 0x20, 0xB0, 0x0F, 0x47, 0x40, 0x86, 0x90, 0x3E, 0xE9,
-    0x11, 0x0D, 0x6F, 0xB3, 0x3A, 0xA3, 0x63, 0x1E, 0xF2, 0xB2, 0xA0, 0x32, 0xDD, 0x2E, 0xF0, 0x20,
-    0x1C, 0xDC, 0x50, 0x40, 0xD2, 0x30, 0x6F, 0xDF, 0x00, 0xC0, 0xF0, 0x55, 0x98, 0x77, 0x8C, 0x0E,
-    0xFB, 0xBB, 0x8E, 0xB9, 0x51, 0x60, 0x73, 0x1B, 0x75, 0x9C, 0xB3, 0x36, 0x86, 0xCD, 0xBB, 0x07,
-    0x05, 0x49, 0xEB, 0x37, 0xE0, 0x44, 0x7F, 0x8A, 0x9C, 0xA7, 0x80, 0xDC, 0xFE, 0xC3, 0xCC, 0x94,
-    0xE0, 0xFC, 0x4C, 0x31, 0xC8, 0x3D, 0x8E, 0xA9, 0x97, 0xB8, 0xA4, 0xF3, 0x21, 0xA9, 0xC2, 0x21,
-    0x6F, 0x20, 0x28, 0x45, 0x40, 0x5A, 0x4E, 0x2C, 0x99, 0x7F, 0xDC, 0x74, 0xE6, 0xAB, 0x77, 0x76,
-    0xEB, 0x8B, 0x6B, 0xA6, 0xB0, 0x31, 0xF1, 0xB6, 0x25, 0x0A, 0x9B, 0x2A, 0x4B, 0x3C, 0x1F, 0x69,
-    0x0A, 0x7F, 0xA8, 0x29, 0xFA, 0x96, 0x9C, 0x59, 0xFA, 0x05, 0x4D, 0x99, 0xF6, 0x72, 0x57, 0xCD,
-    0x45, 0xDC, 0x31, 0x7F, 0xB1, 0xD5, 0x14, 0x76, 0xD2, 0xC0, 0xB8, 0xD5, 0x94, 0xD6, 0x82, 0x26,
-    0x33, 0xA0, 0xE8, 0x97, 0xBD, 0x14, 0x9A, 0x93, 0x67, 0x5E, 0x60, 0x11, 0x6D, 0x6C, 0x31, 0x3C,
-    0xC3, 0xAC, 0x42, 0x49, 0x19, 0x5D, 0xC3, 0x89, 0x4D, 0x12, 0xFF, 0xF6, 0x02, 0x5C, 0xD0, 0x85,
-    0xF9, 0x41, 0x01, 0xCB, 0x54, 0x00, 0x0F, 0x98, 0xDA, 0x1F, 0xC9, 0xF6, 0xCF, 0x52, 0xEA, 0xA6,
-    0xCD, 0x46, 0x89, 0x97, 0x84, 0xAF, 0x52, 0xF4, 0x61, 0x1A, 0x2E, 0xB3, 0x40, 0x4D, 0x98, 0xD6,
-    0x0C, 0x61, 0x56, 0x84, 0xE3, 0x25, 0x2B, 0x1E, 0xE4, 0xEA, 0x4E, 0x37, 0x8A, 0xE2, 0x04, 0xFB,
-    0x2C, 0x0F, 0xC3, 0xAC, 0x68, 0x23, 0xA1, 0xF3, 0xB1, 0x7B, 0x62, 0x01, 0x38, 0x1F, 0xA0, 0x65,
-    0x1A, 0x25, 0x21, 0xFC, 0x17, 0x13, 0x9A, 0x41, 0x80, 0xC3, 0x1C, 0x50, 0xC4, 0x29, 0x76, 0x0D,
-    0xCD, 0x1C, 0xF7, 0x0A, 0x01, 0xC3, 0xA9, 0x12, 0x6B, 0x62, 0x3E, 0x1D, 0x48, 0x68, 0xD0, 0x50,
-    0x2F, 0x32, 0xB9, 0xD5, 0xA6, 0x4E, 0x47, 0x26, 0x49, 0x78, 0x63, 0x2B, 0x80, 0x87, 0x45, 0x21,
-    0x8C, 0x78, 0x36, 0xE8, 0x82, 0xF9, 0x31, 0x7F, 0xAC, 0x7D, 0x96, 0x90, 0x23, 0xEB, 0xF7, 0x41,
-    0x48, 0x21, 0x7E, 0xCA, 0x2C, 0x3E, 0x73, 0x94, 0xBB, 0xF5, 0x2C, 0xE7, 0x3A, 0xBF, 0x21, 0x1B,
-    0x72, 0x06, 0x38, 0x6F, 0x10, 0x99, 0x4A, 0x04, 0x4D, 0x4C, 0x33, 0xE4, 0x65, 0x0F, 0x48, 0xBD,
-    0x15, 0xA9, 0x3F, 0x36, 0x99, 0x26, 0x37, 0xC6, 0x34, 0x6E, 0xDD, 0x18, 0x34, 0xB3, 0x69, 0x0F,
-    0x7E, 0xC7, 0x52, 0x3E, 0x19, 0x0B, 0xFD, 0x64, 0xF1, 0x64, 0xE4, 0x27, 0xA3, 0x3A, 0x3D, 0x33,
-    0x30, 0xA2, 0x13, 0x8B, 0x07, 0xAD, 0x80, 0xC7, 0x3D, 0xB9, 0x15, 0xAF, 0xF6, 0x96, 0x01, 0x6D,
-    0x2C, 0xC9, 0x53, 0xFD, 0x85, 0x34, 0x01, 0xA9, 0x69, 0x05, 0x18, 0x2C, 0x0F, 0x46, 0xEA, 0x8E,
-    0x9B, 0x9F, 0x7F, 0x92, 0xD4, 0xA9, 0x15, 0x42, 0x32, 0x9B, 0x7C, 0xF9, 0x45, 0x3C, 0x32, 0x39,
-    0x49, 0x4D, 0x4E, 0x32, 0x73, 0x1F, 0x2F, 0xAD, 0x51, 0xAA, 0x45, 0x42, 0x02, 0x7E, 0x8D, 0x88,
-    0x3C, 0x0B, 0x2C, 0xF0, 0x91, 0x9C, 0xEC, 0x16, 0x0F, 0xBC, 0x30, 0x63, 0x9D, 0x4C, 0x95, 0x32,
-    0xD3, 0x2F, 0x9F, 0xD7, 0x10, 0xF8, 0x9B, 0x92, 0x93, 0xA0, 0x13, 0x0C, 0xCC, 0x45, 0x1A, 0x13,
-    0xFE, 0x59, 0x06, 0xEA, 0xD4, 0xC0, 0xA4, 0x86, 0xCC, 0xE5, 0xFF, 0x10, 0xF0, 0x16, 0xBA, 0x2F,
-    0xC0, 0x33, 0x24, 0xFB, 0xA5, 0x81, 0x5F, 0xBC, 0xAD, 0xB7, 0xE3, 0xDE, 0xC3, 0x60, 0xF3, 0xDA,
-    0xCC, 0xCB, 0x43, 0xEF, 0x64, 0x8E, 0x5D, 0x8A, 0xC2, 0x00, 0x22, 0x31, 0xC9, 0x3D, 0x45, 0xAC,
-    0x4B, 0x51, 0x0B, 0xDB, 0xC5, 0xA0, 0x2B, 0x13, 0x29, 0xA5, 0xAB, 0xBF, 0xE3, 0x4C, 0xD8, 0x17,
-    0x68, 0x63, 0x83, 0xD6, 0xE4, 0x7D, 0x81, 0xCF, 0x9B, 0x2B, 0x13, 0x64, 0x0A, 0x47, 0x70, 0xFD,
-    0x7A, 0xC9, 0x18, 0x17, 0x61, 0x3F, 0xD7, 0x3A, 0x95, 0xF6, 0x28, 0xE6, 0x6E, 0x85, 0x0D, 0x27,
-    0x60, 0x93, 0x5B, 0xF6, 0xC3, 0xC7, 0x0B, 0xDB, 0x1C, 0xD8, 0x28, 0x5D, 0x82, 0x38, 0x91, 0xEC,
-    0xA5, 0xF9, 0x3F, 0xA3, 0xCB, 0x7B, 0x6E, 0x8D, 0xCA, 0xC1, 0x87, 0x3A, 0xF5, 0x9C, 0x28, 0x33,
-    0xB1, 0x86, 0x6E, 0x56, 0xAE, 0x96, 0x94, 0x10, 0x35, 0x96, 0x9A, 0x82, 0x92, 0xA9, 0xC6, 0xF9,
-    0x78, 0x64, 0x5E, 0x42, 0xB6, 0xC9, 0xF3, 0x25, 0xF0, 0x45, 0x19, 0x63, 0xCB, 0x92, 0x65, 0x2D,
-    0x7A, 0x21, 0xE1, 0xB2, 0xF4, 0x2A, 0x9E, 0xBD, 0xC2, 0x2D, 0x25, 0x84, 0xB5, 0x86, 0x70, 0x70,
-    0xD1, 0x1D, 0x44, 0xCE, 0x3E, 0x70, 0xF6, 0x1C, 0x5B, 0x52, 0x3C, 0x71, 0xCC, 0x62, 0xC3, 0x7A,
-    0x01, 0xB0, 0x5C, 0x02, 0xA6, 0xD2, 0x7C, 0xF4, 0xE9, 0xFC, 0xAF, 0xFA, 0x80, 0x55, 0xA3, 0x3E,
-    0x86, 0xB2, 0xDB, 0xA3, 0xBA, 0x47, 0x71, 0x8F, 0xDA, 0x8A, 0x92, 0x09, 0x5A, 0xB8, 0xA0, 0x61,
-    0x22, 0x16, 0xEF, 0xA3, 0xD3, 0xFE, 0x28, 0xFC, 0x5E, 0xC1, 0xDC, 0x83, 0x67, 0xAB, 0x2F, 0x20,
-    0xED, 0x41, 0x31, 0x2A, 0x6C, 0x96, 0xD1, 0x62, 0x0E, 0x2F, 0x97, 0xF9, 0xA1, 0x61, 0xAB, 0xF7,
-    0x32, 0x29, 0x18, 0x0D, 0xC8, 0xC3, 0xB4, 0xF3, 0xC9, 0xCC, 0xC6, 0x8F, 0xC3, 0x41, 0xAA, 0xD6,
-    0xEF, 0x85, 0xCC, 0x74, 0xC0, 0xC6, 0x67, 0x6E, 0xF8, 0xBC, 0xAD, 0xBC, 0xB9, 0xDE, 0xAE, 0x02,
-    0x5B, 0xC9, 0xA2, 0x36, 0x5E, 0xA0, 0x41, 0xDE, 0x1C, 0x38, 0x91, 0xC2, 0x05, 0x73, 0x08, 0x10,
-    0x79, 0x09, 0x90, 0x14, 0xCD, 0xD3, 0xAE, 0x7A, 0x6A, 0xDF, 0xB1, 0xF5, 0x2D, 0x59, 0x9E, 0xCC,
-    0xEF, 0x63, 0x8F, 0xC2, 0x23, 0x34, 0xD8, 0x1C, 0x77, 0xB6, 0x6B, 0xD6, 0x1A, 0x5A, 0x95, 0xE6,
-    0xF8, 0x67, 0x22, 0x9C, 0x4B, 0x1E, 0xDD, 0x37, 0xB4, 0x26, 0x8F, 0xDE, 0xD6, 0x42, 0xC4, 0xD4,
-    0x32, 0x24, 0xA0, 0x18, 0x59, 0xAE, 0xD9, 0x9A, 0xFE, 0x31, 0x8B, 0x2F, 0x0D, 0xD1, 0xC6, 0x33,
-    0x48, 0x98, 0x7B, 0x53, 0xCB, 0x1F, 0x19, 0xD8, 0x91, 0x53, 0x09, 0xAE, 0xC9, 0xAC, 0xA0, 0xA9,
-    0xBD, 0xD8, 0x78, 0xB9, 0x31, 0xC1, 0xF9, 0xA5, 0xD8, 0xF2, 0x24, 0x73, 0x9E, 0xC5, 0x96, 0xFE,
-    0x69, 0x6C, 0x31, 0x45, 0x57, 0x69, 0x33, 0x64, 0xFA, 0x41, 0xC3, 0x0A, 0x48, 0x93, 0xD6, 0x52,
-    0x7C, 0xB3, 0xAA, 0xDE, 0xA8, 0xA6, 0xD2, 0xA9, 0x0C, 0x3E, 0x37, 0x93, 0x9A, 0x15, 0xF2, 0xBE,
-    0x22, 0xBD, 0x06, 0x6E, 0xCF, 0xAF, 0x94, 0x70, 0x87, 0xF7, 0xB9, 0xD3, 0xDF, 0x52, 0x37, 0xBF,
-    0xCD, 0xAB, 0xF7, 0x01, 0x68, 0xFA, 0x39, 0xEE, 0xDB, 0x33, 0x9F, 0x50, 0x48, 0xD9, 0x03, 0x91,
-    0xAB, 0x84, 0x22, 0xEC, 0xB1, 0xDB, 0x19, 0x45, 0x23, 0x64, 0xF1, 0x8D, 0x79, 0x12, 0x00, 0x41,
-    0x2A, 0xDA, 0x11, 0xF9, 0xA8, 0x45, 0x38, 0xD8, 0x36, 0x8A, 0x8D, 0xAA, 0x32, 0x2D, 0x65, 0x65,
-    0xEA, 0xA2, 0xCE, 0x44, 0x88, 0x14, 0x41, 0xE3, 0x55, 0xE5, 0xE0, 0xB8, 0x6A, 0xEF, 0x28, 0xBF,
-    0x4B, 0x01, 0x7A, 0x2F, 0xA2, 0x64, 0x2E, 0xFF, 0xA6, 0x31, 0xEA, 0x92, 0xCB, 0xBE, 0xD3, 0x8A,
-    0x38, 0x57, 0x5D, 0xFA, 0xFD, 0x52, 0x04, 0xBA, 0x02, 0x9C, 0x2C, 0x97, 0x3C, 0x63, 0xC5, 0x40,
-    0xE4, 0x42, 0xE6, 0x33, 0x1A, 0x99, 0xE4, 0x5D, 0x19, 0x23, 0xBC, 0x32, 0xDF, 0x44, 0xC8, 0x4A,
-    0xAF, 0x08, 0x83, 0x1C, 0xB7, 0xB1, 0x38, 0x95, 0x2A, 0x47, 0x64, 0x39, 0x04, 0x72, 0x62, 0x99,
-    0x35, 0x63, 0x45, 0x53, 0xCA, 0xDE, 0x97, 0xBC, 0x48, 0x18, 0xF6, 0x0B, 0xDC, 0xDF, 0x8D, 0xBE,
-    0xFE, 0xF5, 0xB3, 0x9D, 0x4F, 0xF0, 0x85, 0xB2, 0x4A, 0x6B, 0x20, 0xED, 0x6D, 0x15, 0x69, 0x20,
-    0x78, 0x4A, 0x0D, 0xBA, 0xC2, 0x2E, 0xA2, 0x0D, 0xC4, 0x5F, 0x95, 0x37, 0xE4, 0x90, 0x2A, 0xC1,
-    0xC5, 0x6D, 0x32, 0xA8, 0xBE, 0x96, 0xD4, 0xD1, 0xA8, 0x7A, 0x5C, 0x5A, 0x86, 0xBB, 0xC8, 0xEA,
-    0x6C, 0xC1, 0x6C, 0xC5, 0x39, 0xA7, 0x72, 0xB2, 0x9C, 0x5B, 0xF5, 0xC5, 0x5A, 0xA8, 0xBB, 0xE2,
-    0xDB, 0xA5, 0x55, 0xE0, 0xF2, 0xFB, 0xBE, 0xC4, 0x90, 0xCE, 0xBE, 0x74, 0x97, 0x4C, 0xBE, 0x4E,
-    0x64, 0x79, 0xC8, 0x68, 0x15, 0x67, 0x08, 0xE8, 0x4D, 0x4B, 0x96, 0xE5, 0x84, 0xC6, 0x43, 0xB7,
-    0x14, 0x08, 0x5B, 0x97, 0x5B, 0x00, 0x39, 0xD7, 0xC9, 0xA8, 0x58, 0x84, 0xF2, 0xBF, 0xC4, 0x6F,
-    0xED, 0xAA, 0x08, 0xD0, 0x0B, 0x25, 0x5F, 0x1B, 0x71, 0x01, 0xA9, 0x8A, 0x4D, 0xF2, 0x4B, 0x79,
-    0x27, 0xA9, 0xCC, 0x3B, 0x45, 0x62, 0xC8, 0x6D, 0x3B, 0x4D, 0x8A, 0xC5, 0x0A, 0x39, 0x24, 0x38,
-    0x39, 0xAF, 0x3D, 0x9A, 0x66, 0xAD, 0x8C, 0x00, 0x86, 0x13, 0x16, 0xA4, 0x5F, 0x82, 0x3A, 0x66,
-    0x16, 0xF0, 0xC8, 0x2F, 0x59, 0x60, 0x39, 0x2B, 0x29, 0x49, 0x14, 0xD9, 0x3E, 0x14, 0x98, 0xC6,
-    0xA2, 0xA5, 0xFC, 0x01, 0x6D, 0x7B, 0xCB, 0x47, 0x66, 0x32, 0xA0, 0xAD, 0x92, 0x43, 0xE4, 0xF2,
-    0x7A, 0xA2, 0x54, 0xBE, 0xD8, 0xAC, 0x7E, 0xC8, 0x17, 0xF8, 0x8E, 0x82, 0x60, 0x4D, 0xA3, 0xF2,
-    0x84, 0x25, 0x38, 0x1B, 0x64, 0x88, 0x20, 0x59, 0xB9, 0xC2, 0xB1, 0x8F, 0x9A, 0x98, 0x48, 0x57,
-    0xD2, 0x87, 0x5F, 0xFD, 0xD5, 0xE2, 0x83, 0xD2, 0xE2, 0x83, 0x1F, 0x3F, 0x2D, 0x3E, 0xF8, 0x7F,
-    0xCD, 0x87, 0xEA, 0x18, 0xF9, 0xA3, 0xC9, 0x42, 0xF2, 0x25, 0x68, 0x89, 0xA7, 0x3F, 0x34, 0x5A,
-    0xD8, 0x83, 0x0A, 0x2C, 0x9E, 0x48, 0x62, 0x2E, 0xF8, 0x24, 0x66, 0x3A, 0x4E, 0x62, 0xDC, 0x61,
-    0x12, 0xD3, 0x3C, 0x85, 0x7F, 0x3E, 0xC6, 0x56, 0x2E, 0x33, 0x68, 0xE3, 0x78, 0xFA, 0x1A, 0xE3,
-    0xDF, 0xC4, 0x56, 0x4E, 0xFB, 0xCC, 0x26, 0xEF, 0x86, 0x95, 0xE2, 0xC2, 0xE6, 0x0F, 0xE2, 0x9F,
-    0x68, 0x89, 0xD4, 0x7B, 0x27, 0xFE, 0x05, 0x3E, 0xBA, 0x9F, 0x8D, 0x7F, 0xDC, 0x75, 0x56, 0xF9,
-    0xE3, 0x15, 0xF0, 0x2F, 0x1F, 0xC4, 0xBF, 0xF3, 0xE3, 0x41, 0x61, 0xB5, 0x53, 0x61, 0x75, 0xA2,
-    0xB0, 0x30, 0x9A, 0x80, 0x3C, 0xD0, 0x5B, 0xD4, 0xBE, 0x51, 0x9A, 0xAB, 0x28, 0xF5, 0xC2, 0xE2,
-    0x01, 0x4C, 0x30, 0xBC, 0x17, 0xB5, 0x2C, 0x66, 0x32, 0x3F, 0x2F, 0x69, 0xB2, 0xC2, 0x72, 0x6E,
-    0x09, 0x8F, 0xF5, 0xB6, 0x2C, 0x77, 0xCD, 0xBD, 0xDB, 0x42, 0xBA, 0xC2, 0x1C, 0xE1, 0x75, 0x49,
-    0xE8, 0x5D, 0x39, 0x07, 0xCB, 0x3D, 0x58, 0xC0, 0xDD, 0x30, 0x18, 0xA4, 0x07, 0x9D, 0x5E, 0x61,
-    0x2E, 0x6F, 0xB8, 0xAB, 0x00, 0x95, 0xD0, 0xF8, 0xEF, 0x52, 0x1B, 0x37, 0xF1, 0x36, 0x18, 0x33,
-    0x3E, 0x7A, 0xE7, 0x12, 0x1F, 0x3D, 0xBB, 0x42, 0x91, 0x7E, 0xED, 0x32, 0x39, 0xFF, 0xEA, 0x2F,
-    0x74, 0xF7, 0xE5, 0xDE, 0x85, 0xFD, 0x37, 0xE2, 0x0B, 0xE1, 0xF3, 0xA1, 0x79, 0x32, 0x6F, 0x49,
-    0x01, 0x87, 0x60, 0xE4, 0xF3, 0x60, 0xD3, 0x56, 0x15, 0x13, 0x53, 0x56, 0x9A, 0x55, 0x2B, 0x75,
-    0x68, 0x8F, 0x5E, 0x9B, 0x04, 0xBD, 0xD6, 0x67, 0xBB, 0x79, 0x50, 0xE9, 0x83, 0x3B, 0xC0, 0x94,
-    0x92, 0xB1, 0x30, 0xA4, 0x4A, 0xA8, 0x2C, 0xC4, 0x4D, 0x6A, 0xEB, 0x39, 0x89, 0x3C, 0x9C, 0x88,
-    0x58, 0x6A, 0x98, 0x65, 0x36, 0x5D, 0x32, 0x0C, 0xAF, 0x1A, 0x8A, 0x57, 0x6C, 0x3A, 0xB3, 0x69,
-    0x50, 0x68, 0x1E, 0x78, 0x5D, 0xE8, 0x54, 0xCF, 0x61, 0x2D, 0xD2, 0x27, 0xC9, 0x3E, 0xB8, 0xF7,
-    0x55, 0x3E, 0xF6, 0x7C, 0xAB, 0xB9, 0xE3, 0xD4, 0xCC, 0x1B, 0xD6, 0xA3, 0x58, 0xDB, 0x1B, 0x55,
-    0xE8, 0xD7, 0xB4, 0xD1, 0x94, 0xB4, 0x9A, 0x32, 0xA3, 0xD7, 0x89, 0x09, 0xF2, 0x99, 0xD1, 0x70,
-    0x90, 0xAA, 0xA9, 0xD4, 0x3F, 0x59, 0xAF, 0x66, 0xB6, 0xDA, 0xDA, 0x6C, 0x3D, 0x98, 0xC6, 0x9A,
-    0x35, 0x8D, 0xB5, 0x6B, 0xAA, 0x52, 0xE4, 0xAD, 0x3E, 0x25, 0x9A, 0x16, 0x9F, 0xB1, 0xF4, 0xF7,
-    0x8B, 0xC6, 0xB4, 0xBF, 0x14, 0xA7, 0x8A, 0xAF, 0x98, 0x98, 0xDE, 0x5D, 0x5B, 0xC0, 0x6B, 0xCE,
-    0xBC, 0x18, 0x32, 0xAB, 0xA4, 0x54, 0x90, 0xBD, 0xE0, 0x06, 0x74, 0x72, 0x64, 0x53, 0x0A, 0xFE,
-    0x14, 0x57, 0x2C, 0xBD, 0x29, 0x49, 0x29, 0x05, 0x70, 0xCF, 0x92, 0x3A, 0xAF, 0x58, 0x53, 0xBA,
-    0xA3, 0x2B, 0x3A, 0xC9, 0xAD, 0xF0, 0x98, 0xED, 0x00, 0x00, 0x2C, 0xD7, 0xCF, 0xB7, 0x84, 0x1C,
-    0x48, 0x45, 0xDF, 0xDB, 0x12, 0x78, 0xE0, 0x15, 0xBF, 0x3B, 0x10, 0x7E, 0x5C, 0x25, 0x9F, 0x19,
-    0xA8, 0x13, 0x40, 0x32, 0x05, 0x71, 0xAE, 0x0A, 0xCF, 0x8B, 0x58, 0xE9, 0x8E, 0xAE, 0xAE, 0xE0,
-    0x6A, 0x2B, 0x6C, 0x6F, 0xAB, 0xB9, 0xCA, 0x2B, 0xC4, 0x00, 0x46, 0x88, 0xB0, 0x0B, 0x47, 0xA3,
-    0x45, 0xD4, 0x86, 0xA3, 0x91, 0x23, 0xA9, 0x83, 0x51, 0x4E, 0xBA, 0x49, 0xB1, 0xBA, 0x9C, 0x73,
-    0x73, 0x09, 0x57, 0x46, 0x1E, 0xF0, 0x72, 0x27, 0xD1, 0xAB, 0x28, 0x44, 0xFD, 0x52, 0xDD, 0x31,
-    0x5D, 0x53, 0xCE, 0xBC, 0x4A, 0xB9, 0xD9, 0x68, 0xDF, 0x6B, 0x34, 0x8D, 0x41, 0x64, 0x5A, 0xD3,
-    0x46, 0xA9, 0x92, 0x4C, 0x3D, 0xB4, 0xCA, 0x58, 0x67, 0x04, 0x63, 0x6E, 0x5E, 0x9A, 0x4E, 0xAA,
-    0x6B, 0x03, 0xCB, 0xB9, 0x35, 0xB9, 0x8F, 0x3A, 0x0B, 0xEA, 0xD2, 0xDA, 0xEC, 0xFB, 0x89, 0x59,
-    0x8A, 0xD9, 0x1B, 0x8D, 0xC6, 0x1F, 0x6C, 0xF0, 0x66, 0xD2, 0x17, 0x2D, 0xD6, 0xBA, 0x53, 0x60,
-    0x2D, 0x16, 0x10, 0xCF, 0x87, 0xCA, 0x9F, 0xB1, 0xE7, 0x4E, 0x42, 0xB3, 0x9C, 0x83, 0x01, 0x88,
-    0x4D, 0x04, 0x72, 0xDA, 0x9A, 0x4D, 0xC9, 0xFD, 0x82, 0x77, 0x0D, 0xB1, 0xD0, 0x73, 0xE9, 0x74,
-    0xAE, 0xCF, 0x5B, 0xCC, 0xD3, 0xAA, 0xA6, 0x91, 0xCF, 0x23, 0xEC, 0x42, 0x5D, 0xD8, 0x14, 0xC9,
-    0x6A, 0xC9, 0xFD, 0x25, 0x2A, 0xD6, 0xB0, 0x62, 0xC5, 0x75, 0x73, 0x33, 0x55, 0x67, 0x06, 0xE6,
-    0xD6, 0x5C, 0x8E, 0xB2, 0x97, 0xCE, 0xFA, 0x81, 0x7D, 0x66, 0x1A, 0x7D, 0xD5, 0xD4, 0xDB, 0xDA,
-    0x59, 0x0F, 0x0D, 0x71, 0xDF, 0x93, 0x9F, 0x0F, 0xFA, 0x39, 0x6B, 0x4A, 0x7E, 0x9C, 0x8B, 0x1F,
-    0xA7, 0xE4, 0x5B, 0xB7, 0xB7, 0x12, 0x56, 0x6A, 0xA5, 0x85, 0xB8, 0x61, 0x8E, 0x62, 0xE3, 0x16,
-    0x33, 0x56, 0x5A, 0x5D, 0x40, 0x0A, 0x4D, 0x04, 0x78, 0x84, 0xC1, 0x02, 0x33, 0x0A, 0xE8, 0x15,
-    0x23, 0xE8, 0xAB, 0x4B, 0x56, 0x6E, 0xF1, 0x90, 0x39, 0xAF, 0x55, 0xF0, 0xAB, 0xCD, 0x81, 0x5F,
-    0xFE, 0xAF, 0xDE, 0x91, 0xF7, 0xAB, 0xEB, 0xBB, 0xA1, 0x3B, 0x42, 0x83, 0x83, 0x76, 0x67, 0x94,
-    0xDD, 0xE1, 0x1D, 0x88, 0x8D, 0xAB, 0xE3, 0x6A, 0x46, 0x70, 0xEB, 0xAB, 0xB0, 0xE9, 0x3B, 0xDD,
-    0x1B, 0x0F, 0x07, 0x6D, 0xF1, 0xCE, 0x3A, 0x18, 0x4F, 0x6B, 0x89, 0x57, 0xEE, 0xC9, 0xE6, 0xE4,
-    0x41, 0x63, 0x92, 0x2D, 0x90, 0xA5, 0x39, 0x79, 0xD8, 0xE3, 0xCC, 0xDA, 0xC7, 0x96, 0x62, 0x86,
-    0x25, 0x50, 0x6A, 0xF7, 0x27, 0xEE, 0x1D, 0x98, 0x54, 0xFB, 0x7B, 0x0D, 0x1C, 0xB6, 0xBF, 0x2B,
-    0x47, 0x7F, 0x57, 0xFD, 0xDF, 0x45, 0xD8, 0x46, 0xFB, 0x7B, 0x09, 0xE6, 0xCA, 0xFE, 0x52, 0xF7,
-    0xA1, 0x3D, 0x2E, 0x2A, 0x1F, 0x44, 0x4F, 0x69, 0x95, 0x26, 0xCF, 0xE9, 0xF5, 0x17, 0xE5, 0xD3,
-    0xBB, 0xAE, 0xE3, 0xD3, 0xBB, 0xAE, 0x87, 0x34, 0x62, 0x88, 0x52, 0x91, 0xB2, 0xAD, 0x70, 0x71,
-    0xEE, 0xCF, 0xD6, 0x46, 0xF8, 0xB8, 0x30, 0x2A, 0xFA, 0x3E, 0x79, 0xC5, 0x98, 0x39, 0x65, 0x28,
-    0x7D, 0x89, 0x72, 0x7B, 0x35, 0x90, 0xC5, 0xDA, 0xD2, 0x58, 0x9D, 0xD1, 0x4E, 0x5D, 0xA5, 0x89,
-    0xCA, 0xE5, 0x24, 0x4A, 0xC8, 0x7C, 0xD2, 0x66, 0x34, 0xCF, 0x27, 0x4B, 0x97, 0x55, 0xB5, 0xDA,
-    0xAD, 0x06, 0xF6, 0x01, 0xAE, 0x7D, 0x1E, 0x11, 0x53, 0xDA, 0xC6, 0x1D, 0x96, 0xB9, 0xCD, 0x6E,
-    0x85, 0xC2, 0x17, 0x44, 0x6E, 0x8C, 0xBC, 0xDF, 0x3F, 0x55, 0xF1, 0x93, 0xE0, 0xCE, 0x04, 0x3A,
-    0x54, 0xCA, 0x11, 0xA9, 0x90, 0x97, 0xA8, 0x8E, 0xC7, 0xB7, 0xCA, 0x2F, 0x99, 0x8A, 0x3D, 0x79,
-    0x7B, 0x70, 0x94, 0x4A, 0x41, 0x02, 0x9C, 0xAA, 0x85, 0x3B, 0x08, 0x5A, 0x67, 0x2D, 0xC6, 0x73,
-    0x24, 0xED, 0x6F, 0xF2, 0x0C, 0x43, 0x77, 0xBB, 0xF9, 0x2C, 0x24, 0xBE, 0xAB, 0xB0, 0x38, 0x4C,
-    0xD2, 0x96, 0x1D, 0x9C, 0x73, 0x80, 0xF3, 0xD6, 0x8D, 0xE5, 0xA4, 0x4B, 0xB5, 0x59, 0x8B, 0x09,
-    0x6B, 0x45, 0xA1, 0x38, 0xA8, 0x57, 0xC0, 0x37, 0xCD, 0xCC, 0x52, 0xA7, 0x02, 0x5A, 0xB4, 0x7B,
-    0x27, 0xEB, 0x83, 0xDD, 0x26, 0xED, 0xC3, 0x19, 0xE9, 0x53, 0x44, 0x88, 0x55, 0x88, 0x84, 0x44,
-    0xC6, 0xEC, 0x42, 0x25, 0xDB, 0x84, 0x60, 0x13, 0xE4, 0x1E, 0x40, 0x67, 0x1D, 0x0B, 0x47, 0x2D,
-    0x41, 0xAE, 0x8B, 0xD6, 0x5A, 0xF0, 0x08, 0x18, 0xE9, 0x0F, 0xAA, 0x92, 0xC1, 0xC7, 0x0F, 0x90,
-    0xF6, 0xBE, 0x3F, 0xEF, 0x5B, 0xF0, 0xA4, 0x4C, 0x48, 0xDF, 0x98, 0xFE, 0x60, 0x26, 0x6E, 0x2A,
-    0x60, 0x67, 0x8C, 0xB1, 0x40, 0xBF, 0xAD, 0xFB, 0xA0, 0xF9, 0xFF, 0xAC, 0x3B, 0x2E, 0x82, 0xB4,
-    0x6B, 0x89, 0x65, 0x1D, 0x0C, 0x0D, 0xDF, 0x20, 0x7D, 0xD5, 0xA5, 0x03, 0x9D, 0xBD, 0xEC, 0x40,
-    0x33, 0x2D, 0x27, 0x35, 0x60, 0x20, 0x6E, 0x95, 0xBE, 0x05, 0xBA, 0x34, 0x66, 0x7C, 0x92, 0x7D,
-    0x38, 0xEE, 0x1B, 0xEF, 0xE7, 0x7E, 0x6F, 0x54, 0x60, 0x34, 0xFE, 0x9F, 0xF1, 0x6D, 0xA1, 0xD0,
-    0x4E, 0x14, 0xE2, 0x93, 0x15, 0x0F, 0x35, 0x14, 0xA4, 0x90, 0x80, 0x41, 0x72, 0xDC, 0x63, 0xC9,
-    0x6C, 0x13, 0xF2, 0xA8, 0x03, 0xCC, 0x60, 0xF1, 0x5D, 0xF5, 0xF4, 0x1F, 0xE0, 0xDE, 0x2F, 0x3D,
-    0x9F, 0x42, 0xE7, 0x9F, 0x46, 0x21, 0x77, 0xFA, 0x9E, 0x45, 0x93, 0xD6, 0x52, 0xEF, 0x2A, 0x8B,
-    0xEE, 0x54, 0x3E, 0x29, 0x4A, 0xF9, 0xA6, 0xCA, 0x1A, 0x70, 0xCD, 0xA1, 0xC1, 0xF6, 0x93, 0xEF,
-    0x99, 0x58, 0xB5, 0x74, 0x35, 0xDF, 0x66, 0xB0, 0x23, 0x33, 0xD8, 0x71, 0x7F, 0x38, 0x25, 0xC7,
-    0xA1, 0x85, 0x6F, 0xB0, 0xB4, 0x47, 0xA9, 0x52, 0x7D, 0x34, 0x59, 0x8E, 0x54, 0x39, 0xF7, 0x24,
-    0x0C, 0xE6, 0x34, 0x82, 0xF1, 0xD0, 0x77, 0x2C, 0x30, 0x1C, 0x6D, 0x9E, 0x1C, 0x46, 0x32, 0x7E,
-    0xE5, 0x62, 0x3A, 0xEC, 0xEA, 0xE8, 0xF5, 0x86, 0x72, 0x47, 0xC9, 0x49, 0x32, 0x3F, 0xE2, 0x54,
-    0x7C, 0x79, 0xFA, 0xB0, 0x36, 0x6A, 0xEC, 0x54, 0x46, 0x65, 0x6B, 0x56, 0x6E, 0x3D, 0x16, 0x06,
-    0x4C, 0x1A, 0xC3, 0x44, 0x85, 0x8A, 0x8D, 0xD5, 0x26, 0x3A, 0xEB, 0x60, 0x6F, 0x85, 0x67, 0x38,
-    0xAF, 0x67, 0xC5, 0xD6, 0x83, 0x1B, 0xCE, 0x1F, 0x0D, 0x2C, 0xFC, 0xF4, 0xA3, 0x6B, 0x3E, 0xCB,
-    0x2B, 0xCD, 0x8F, 0xA9, 0x8D, 0xF9, 0x35, 0xC6, 0xFB, 0x88, 0x2A, 0x69, 0x45, 0xB3, 0xDA, 0x9C,
-    0xB6, 0xE1, 0x5B, 0xAD, 0x53, 0xB8, 0xD5, 0x97, 0x44, 0x14, 0x6C, 0x3E, 0x6D, 0xF5, 0xF4, 0x64,
-    0xBC, 0xA1, 0x6F, 0x0C, 0x6E, 0xDD, 0x14, 0x7B, 0xFB, 0x83, 0x34, 0xA1, 0xDB, 0xD3, 0xDE, 0x48,
-    0x9F, 0x1F, 0xC4, 0xF1, 0x45, 0xC9, 0xFE, 0x57, 0xF1, 0x69, 0x0A, 0x4A, 0x95, 0xAA, 0xFC, 0x73,
-    0x55, 0x5D, 0x8B, 0xAF, 0x93, 0xAF, 0x13, 0xCB, 0x2B, 0xA0, 0x10, 0xF0, 0x0B, 0x55, 0x56, 0x09,
-    0x55, 0x52, 0xA1, 0xFE, 0x9A, 0x72, 0x74, 0x8A, 0x0D, 0x37, 0x2A, 0xAB, 0xB4, 0xFC, 0x67, 0xAE,
-    0xB1, 0x50, 0xE1, 0x4E, 0x2D, 0x70, 0xB2, 0x34, 0xD7, 0xC8, 0x2C, 0xE8, 0x1B, 0x3C, 0xBA, 0x53,
-    0x40, 0x03, 0x1C, 0x6B, 0x32, 0xBE, 0x19, 0xFB, 0x41, 0x19, 0xA7, 0x46, 0xD5, 0xB5, 0xE2, 0xB8,
-    0x01, 0xBB, 0x73, 0xA7, 0xA3, 0x6F, 0x91, 0x44, 0x8A, 0x43, 0x93, 0xDE, 0xB7, 0x43, 0x52, 0x29,
-    0xA2, 0x4C, 0x91, 0xDE, 0x25, 0xDF, 0x58, 0xA6, 0x78, 0x13, 0x91, 0x5A, 0x89, 0xD0, 0xD6, 0xDA,
-    0x9F, 0x1F, 0x5C, 0xA5, 0x4A, 0xA5, 0xBB, 0xA6, 0xDE, 0x73, 0xE1, 0xC9, 0x76, 0xAF, 0x8A, 0x24,
-    0xC7, 0x95, 0xDB, 0xFD, 0xD9, 0x04, 0x0D, 0xC9, 0x5A, 0xB9, 0x15, 0x41, 0x45, 0xCF, 0xFC, 0xD8,
-    0xCE, 0x6A, 0xB3, 0x6A, 0x15, 0xDF, 0x69, 0x11, 0x5D, 0x05, 0x3D, 0xC1, 0xB8, 0x16, 0x87, 0x87,
-    0xE3, 0x35, 0xD7, 0xEA, 0xF4, 0xB4, 0x88, 0xE9, 0xAF, 0xC0, 0x4B, 0x1B, 0x69, 0xD9, 0x2B, 0x48,
-    0x17, 0x4F, 0x1E, 0x5A, 0x07, 0x8A, 0x81, 0xDC, 0x8E, 0xC9, 0x42, 0xA0, 0x12, 0x69, 0x38, 0x52,
-    0x2C, 0xC3, 0x81, 0x21, 0x6B, 0xB4, 0xD5, 0x89, 0xC8, 0x9F, 0x50, 0x14, 0x63, 0x25, 0x5F, 0xC9,
-    0x4E, 0x67, 0xF7, 0x7A, 0x73, 0xB3, 0x72, 0xBA, 0x4A, 0x8E, 0x65, 0xB7, 0x7D, 0xD1, 0x81, 0x07,
-    0x1C, 0x8D, 0xE2, 0xEF, 0x91, 0x9C, 0xC9, 0x72, 0x04, 0xEA, 0xFC, 0xAD, 0x3A, 0x9D, 0x75, 0x38,
-    0xC0, 0x78, 0xB2, 0x9E, 0x0C, 0xD6, 0xE1, 0xE0, 0x40, 0x9D, 0xAF, 0x95, 0x97, 0xF1, 0x6A, 0x5A,
-    0x17, 0x5E, 0xE6, 0xED, 0xF3, 0x78, 0xF9, 0x22, 0xAD, 0x66, 0x3E, 0x43, 0x56, 0x61, 0x43, 0x2F,
-    0xCC, 0x90, 0xD6, 0x9C, 0x27, 0x31, 0x2F, 0x26, 0xDB, 0xDB, 0x70, 0x21, 0x90, 0xD8, 0x07, 0x1B,
-    0x2C, 0x06, 0x99, 0x7D, 0x54, 0xA6, 0x3C, 0x53, 0x84, 0x00, 0x20, 0xED, 0x28, 0xB7, 0x3C, 0xA0,
-    0x42, 0xC9, 0xDD, 0x7A, 0xDF, 0xC3, 0x73, 0x9A, 0x26, 0xBD, 0x45, 0x6D, 0xF2, 0x5B, 0x94, 0x26,
-    0xC1, 0x95, 0x97, 0xE1, 0xC6, 0x4B, 0x71, 0xE3, 0xE5, 0x78, 0xF2, 0x92, 0x3C, 0x29, 0xA3, 0xD7,
-    0xE1, 0x17, 0xF5, 0xC2, 0xE7, 0x73, 0xF8, 0xB2, 0xA1, 0x8D, 0x2D, 0x84, 0xA9, 0x65, 0xF1, 0xDE,
-    0xFD, 0xBD, 0xE8, 0x0C, 0x5A, 0x27, 0x58, 0x9D, 0x20, 0xFD, 0xDF, 0xD5, 0xAC, 0xBD, 0x03, 0xCE,
-    0x1E, 0xA8, 0x61, 0x96, 0xF6, 0xCC, 0xBF, 0x78, 0x34, 0x28, 0x1A, 0xB4, 0x1D, 0x77, 0x1B, 0x19,
-    0x3B, 0x8F, 0xEC, 0x19, 0x8D, 0xCB, 0x29, 0xBC, 0x78, 0x80, 0x53, 0x49, 0xB6, 0x2C, 0x1F, 0xF4,
-    0x6C, 0xB1, 0xF1, 0x38, 0x0B, 0xDC, 0x04, 0x79, 0x93, 0xD3, 0x87, 0xAB, 0x54, 0x1E, 0x4F, 0x6F,
-    0x77, 0xDE, 0xBD, 0xF8, 0x13, 0x77, 0xF0, 0x32, 0xE1, 0xDC, 0x17, 0xAC, 0x7F, 0xFF, 0x07, 0x2B,
-    0x5B, 0xE9, 0xBF, 0xB4, 0x8C, 0xD0, 0xBF, 0x2F, 0xB0, 0xFF, 0x9D, 0xEE, 0x89, 0x2E, 0x4C, 0x31,
-    0x31, 0x3D, 0xE7, 0x7A, 0x8A, 0xBC, 0xDD, 0x97, 0x48, 0x2A, 0xA3, 0xA7, 0x82, 0x41, 0xC9, 0x0D,
-    0xF5, 0x66, 0x47, 0xC2, 0x40, 0x7A, 0x62, 0xE5, 0x94, 0x3A, 0x39, 0xA8, 0x96, 0xE1, 0xFC, 0x65,
-    0x46, 0x9D, 0x8F, 0x18, 0xF8, 0xC4, 0xFD, 0xCB, 0xFB, 0xAA, 0xC2, 0x33, 0xD4, 0xC4, 0x2B, 0xCB,
-    0x43, 0x8B, 0xE9, 0x3C, 0xA7, 0xAE, 0xBD, 0xC0, 0xD8, 0x6D, 0xB4, 0x10, 0x00, 0xF2, 0x30, 0x28,
-    0x00, 0x90, 0xFF, 0x8F, 0xD8, 0x86, 0x95, 0x88, 0x4A, 0x48, 0xE5, 0xFB, 0xE5, 0xFA, 0x05, 0xB3,
-    0x1C, 0x3F, 0x3B, 0xBF, 0xA5, 0xDC, 0x3E, 0xD2, 0xE2, 0xD9, 0x9C, 0x3E, 0x7C, 0xFE, 0x44, 0x97,
-    0xCF, 0xC6, 0xFC, 0x3F, 0xF1, 0xB8, 0xF0, 0xA7, 0xC1, 0x90, 0x97, 0xF7, 0xE6, 0x64, 0x6F, 0x53,
-    0x1E, 0x6F, 0x09, 0xB1, 0x4A, 0x95, 0xC9, 0x29, 0xBC, 0x0C, 0x43, 0x10, 0xCF, 0xEE, 0xC2, 0x8E,
-    0xD1, 0xCC, 0xEE, 0x32, 0xF6, 0x1A, 0xBB, 0xBC, 0x74, 0xBB, 0xF6, 0x25, 0x8B, 0x6C, 0xD4, 0xDA,
-    0x0F, 0x77, 0xCF, 0xEA, 0x32, 0xAD, 0x16, 0xEA, 0xA9, 0x66, 0xAA, 0xDC, 0x1B, 0xC1, 0xEB, 0xF2,
-    0x7E, 0x8C, 0x7D, 0xBE, 0x3C, 0x93, 0xCE, 0x55, 0x19, 0x80, 0x0A, 0x65, 0xC8, 0xBC, 0x1C, 0x34,
-    0xF8, 0x80, 0x6F, 0x47, 0x58, 0x49, 0x55, 0x15, 0xB2, 0xFD, 0xF1, 0xF4, 0x6A, 0xBB, 0x9C, 0xAE,
-    0x01, 0x0C, 0x17, 0xC9, 0x9F, 0x13, 0xC7, 0xA7, 0xE9, 0xA5, 0x4C, 0xB1, 0x1E, 0xC0, 0x43, 0x29,
-    0xBA, 0xB1, 0x1A, 0xED, 0x79, 0x15, 0x5B, 0x32, 0x96, 0x39, 0x02, 0x56, 0x76, 0xE6, 0x6A, 0x9E,
-    0xC2, 0x63, 0xE3, 0x9E, 0x3C, 0xCB, 0xB8, 0x3B, 0x13, 0xF4, 0x6B, 0xF9, 0xDC, 0xF1, 0x84, 0xBC,
-    0x0F, 0x67, 0x1A, 0x48, 0xC6, 0x70, 0x3A, 0xFA, 0xB8, 0x95, 0x0C, 0x03, 0xD7, 0xA8, 0x3D, 0xDC,
-    0x9D, 0xA7, 0x42, 0x33, 0x1A, 0xB0, 0xBC, 0x95, 0xFE, 0x48, 0x71, 0xA4, 0x37, 0xD2, 0x70, 0xDA,
-    0x30, 0xA2, 0xCA, 0x21, 0xE6, 0x71, 0xB0, 0x5F, 0xC3, 0x50, 0x5E, 0x86, 0x6A, 0x7F, 0xA3, 0x87,
-    0x5E, 0xCF, 0x6D, 0x33, 0xA5, 0x13, 0x35, 0xFA, 0x9A, 0x85, 0x6A, 0xAE, 0x2C, 0x10, 0x16, 0xF7,
-    0xF9, 0xC8, 0xF0, 0x13, 0xC3, 0x28, 0x73, 0x16, 0xE8, 0xFF, 0x3C, 0xA8, 0x58, 0x33, 0x31, 0xA1,
-    0x98, 0x58, 0x95, 0x6A, 0xD4, 0x7A, 0x61, 0x12, 0x58, 0xF1, 0xE8, 0x4D, 0x51, 0xB2, 0xC6, 0x54,
-    0xAB, 0xB4, 0x74, 0x46, 0x4E, 0xD0, 0x7D, 0xBF, 0xCB, 0xD4, 0xEC, 0xEF, 0x99, 0x98, 0xB0, 0x7E,
-    0x9F, 0x1E, 0x74, 0x9E, 0x97, 0xD7, 0x39, 0x36, 0x1B, 0x78, 0x14, 0xAD, 0x3E, 0x65, 0x3C, 0xCE,
-    0xB0, 0x70, 0x60, 0x85, 0x21, 0xE5, 0x0C, 0xAB, 0x98, 0x70, 0xCE, 0x31, 0xD7, 0x60, 0xD7, 0xEF,
-    0xB2, 0xA6, 0x82, 0xF9, 0x6F, 0x30, 0x33, 0x76, 0xF9, 0xE7, 0x01, 0x89, 0x5A, 0x38, 0x84, 0xDF,
-    0x1C, 0x91, 0xC2, 0x85, 0x43, 0xF4, 0xE6, 0x88, 0x04, 0x2F, 0x1C, 0x12, 0x00, 0x0D, 0x25, 0x1A,
-    0x3E, 0x1C, 0x8C, 0xC8, 0x54, 0xC3, 0xE1, 0x93, 0xC1, 0x08, 0x28, 0xC3, 0xE1, 0x72, 0x30, 0xA6,
-    0x74, 0x09, 0x7D, 0x30, 0x5E, 0xC4, 0xFC, 0xA0, 0x0B, 0x46, 0x40, 0x1A, 0x3E, 0x6A, 0xDD, 0xA8,
-    0x73, 0x8E, 0xB5, 0xEA, 0x24, 0x94, 0x3A, 0x8A, 0x42, 0x38, 0xAD, 0x19, 0xBD, 0x3B, 0x38, 0xC3,
-    0xD1, 0x74, 0x2C, 0x33, 0x9C, 0x02, 0xFF, 0x1B, 0x3C, 0x40, 0x3F, 0x2C, 0xF5, 0x8F, 0x60, 0xA7,
-    0x3A, 0xC1, 0xA4, 0x28, 0xA8, 0x51, 0x95, 0xA0, 0x90, 0xC7, 0x28, 0xFA, 0x83, 0xDE, 0x55, 0xB7,
-    0xAF, 0x7B, 0xFC, 0x5C, 0x42, 0xF5, 0x8F, 0xA2, 0xC9, 0x37, 0x76, 0x2A, 0x68, 0x4C, 0x2A, 0x67,
-    0xB0, 0xDE, 0x3B, 0x50, 0xF5, 0x69, 0x41, 0x06, 0x36, 0xD5, 0xF2, 0x71, 0x21, 0x96, 0x6A, 0xA4,
-    0xE0, 0x6C, 0xD0, 0xA8, 0xF4, 0xC9, 0xB4, 0x82, 0x6B, 0x32, 0x80, 0xB7, 0xF3, 0xE7, 0xAC, 0x6A,
-    0x80, 0x8C, 0x3A, 0xC7, 0x3E, 0xC8, 0xE3, 0xD2, 0xDC, 0xD6, 0x72, 0xCD, 0xAA, 0xDE, 0x4C, 0xD6,
-    0xE2, 0x99, 0xAD, 0xAF, 0xD3, 0x58, 0xB3, 0xB1, 0x2A, 0x65, 0xD3, 0x8B, 0x37, 0xAD, 0xF4, 0xFA,
-    0xAE, 0x6C, 0x88, 0x18, 0xE7, 0x59, 0xB7, 0x1C, 0x4D, 0x5D, 0xBC, 0x60, 0xE4, 0x43, 0x60, 0x1F,
-    0xF9, 0xD5, 0x87, 0x91, 0xDF, 0x78, 0x58, 0xDC, 0x50, 0xCF, 0xFE, 0x85, 0xF3, 0xD6, 0x5B, 0xF4,
-    0xC5, 0xDE, 0xC3, 0x23, 0x31, 0xB9, 0xFF, 0x6F, 0x28, 0x5B, 0xE8, 0x0B, 0x90, 0x79, 0x8D, 0x76,
-    0xF2, 0xEB, 0x6E, 0x55, 0x7C, 0x3B, 0xC9, 0xD9, 0x2D, 0x61, 0xFF, 0xFE, 0xFB, 0x61, 0x11, 0x25,
-    0xAB, 0xEF, 0xBB, 0x60, 0x03, 0x04, 0x23, 0x0A, 0x4B, 0xCC, 0x93, 0x8B, 0x59, 0xCD, 0x03, 0x99,
-    0xA5, 0x3F, 0x80, 0x14, 0xFC, 0xD1, 0xF2, 0x7F, 0x4C, 0xAA, 0xCD, 0xE1, 0xB1, 0xC1, 0x5F, 0xD0,
-    0xC1, 0x3E, 0x0E, 0x81, 0x68, 0x56, 0xD4, 0x2B, 0x95, 0x49, 0x50, 0xAB, 0x53, 0xCD, 0x08, 0x2B,
-    0xF4, 0x4C, 0xC7, 0xFD, 0xF1, 0xE3, 0x10, 0xE8, 0xB1, 0xD5, 0x0F, 0x06, 0xFD, 0x2A, 0x43, 0xC3,
-    0x38, 0xF7, 0x4F, 0x6F, 0xFF, 0x32, 0x2F, 0x17, 0xFC, 0xD5, 0x5A, 0x2C, 0xCF, 0xFA, 0x27, 0x17,
-    0x7D, 0x5A, 0xE7, 0xFD, 0xF1, 0xF6, 0x7B, 0xB9, 0x5C, 0x89, 0x3F, 0x3A, 0x70, 0x78, 0x7E, 0x5E,
-    0x4A, 0x73, 0xD3, 0x71, 0xFC, 0xF6, 0x34, 0x4B, 0xFE, 0x94, 0xBE, 0x7E, 0xB5, 0xD0, 0xA7, 0x51,
-    0xFB, 0x8D, 0x91, 0x7A, 0x78, 0xD3, 0x9D, 0xAF, 0x53, 0x9E, 0x19, 0x2E, 0x9A, 0x36, 0xA9, 0xCF,
-    0xE2, 0x3E, 0x75, 0xB7, 0x83, 0xA9, 0x82, 0x09, 0x29, 0x58, 0xF6, 0x84, 0xCC, 0xFE, 0x27, 0xDD,
-    0x5B, 0x3D, 0x8C, 0xDD, 0x56, 0x76, 0xBE, 0x24, 0xA5, 0x21, 0x6C, 0xC2, 0xA2, 0x0A, 0x2B, 0x81,
-    0xA4, 0x95, 0xD8, 0x26, 0xB2, 0x34, 0x4C, 0xE9, 0x62, 0xDE, 0x90, 0x5E, 0x17, 0x2E, 0x33, 0x40,
-    0x3C, 0x49, 0xE1, 0xC2, 0xCD, 0x36, 0xD9, 0x66, 0x9A, 0x2D, 0x54, 0x8C, 0x4D, 0xDA, 0x5B, 0xA6,
-    0x88, 0x9A, 0xAD, 0x33, 0x40, 0x5C, 0xAC, 0x9F, 0x81, 0x68, 0x81, 0x08, 0xC8, 0x00, 0x91, 0x44,
-    0x2E, 0x0C, 0x24, 0x85, 0x8B, 0x10, 0x1B, 0x20, 0x29, 0x92, 0x82, 0x8B, 0xD8, 0x70, 0xE2, 0x2D,
-    0x44, 0x64, 0xB9, 0x1B, 0x4A, 0xE6, 0xE3, 0xDD, 0xF3, 0x7D, 0xE7, 0xBE, 0x79, 0xEF, 0x49, 0xB2,
-    0xB3, 0x46, 0x10, 0xAD, 0x3C, 0xF3, 0x73, 0x2F, 0xDF, 0x7B, 0xFC, 0x39, 0x7F, 0xF7, 0x9C, 0xEF,
-    0x9C, 0x7B, 0x9E, 0xF1, 0x8C, 0x89, 0x5B, 0x93, 0x76, 0x26, 0xEB, 0x4C, 0xDA, 0x9A, 0xA8, 0x34,
-    0xFA, 0xF3, 0x82, 0x31, 0x57, 0x8C, 0xD9, 0xE1, 0xDF, 0xA1, 0x31, 0x77, 0x8D, 0x19, 0xF0, 0xE7,
-    0xF5, 0xC6, 0xEF, 0x4C, 0xD0, 0x99, 0xB0, 0x33, 0x51, 0x87, 0x4B, 0xE5, 0x2F, 0x69, 0x4C, 0x5A,
-    0x9B, 0xAC, 0x36, 0x45, 0x6D, 0xBE, 0x8F, 0x1B, 0x04, 0x18, 0x42, 0x0E, 0xB9, 0x31, 0x5E, 0x25,
-    0x97, 0xC6, 0xD6, 0x1A, 0x53, 0xFC, 0x71, 0x55, 0x7A, 0x8B, 0xAB, 0x59, 0x1D, 0x0C, 0x37, 0xD2,
-    0x32, 0xEA, 0xAE, 0x6F, 0x9B, 0xA4, 0x95, 0x07, 0xA4, 0xF5, 0xAB, 0x46, 0xAE, 0xFF, 0x81, 0x9C,
-    0x51, 0xDE, 0x31, 0xA6, 0xCA, 0x3B, 0x19, 0x8C, 0x0C, 0xD6, 0xB4, 0x32, 0x78, 0x8D, 0xBC, 0xF4,
-    0x6B, 0x19, 0x5E, 0x97, 0x21, 0xFB, 0x61, 0xFD, 0x47, 0x26, 0xFD, 0xFC, 0x3D, 0x79, 0xBA, 0x7D,
-    0x50, 0x1B, 0xDF, 0x5A, 0x79, 0x46, 0xFA, 0x81, 0x3C, 0x2C, 0x06, 0xE1, 0x57, 0x31, 0xDC, 0x30,
-    0xAB, 0x1F, 0xAF, 0x9A, 0xF0, 0xD9, 0x64, 0x71, 0x6D, 0x2E, 0x9C, 0x9A, 0x05, 0x48, 0xF7, 0x07,
-    0xF0, 0x10, 0xF4, 0x26, 0x68, 0xC0, 0x8F, 0xC8, 0x41, 0x5E, 0x9A, 0xCD, 0x31, 0xD0, 0xB1, 0xC7,
-    0xF8, 0xD1, 0xA3, 0x79, 0x8E, 0x87, 0xD9, 0xD2, 0x78, 0x7F, 0xBA, 0xD8, 0xC7, 0x8D, 0x47, 0xB3,
-    0x1A, 0x07, 0x8C, 0xFE, 0xB0, 0xBA, 0x2A, 0x6C, 0x31, 0xC6, 0x94, 0xE7, 0x36, 0x09, 0xB1, 0x53,
-    0x7E, 0xCE, 0x84, 0xD6, 0x3E, 0x5A, 0x98, 0xF4, 0x17, 0xD6, 0xF6, 0xE6, 0x0F, 0xCC, 0x65, 0xCB,
-    0xCF, 0xDF, 0x74, 0xA4, 0xDE, 0x30, 0x7B, 0x51, 0x9E, 0x1D, 0x4C, 0x69, 0x2E, 0xE2, 0x5A, 0xC8,
-    0x83, 0x41, 0x64, 0x2D, 0xC2, 0x8F, 0x73, 0x33, 0x03, 0x7B, 0xDB, 0x18, 0xAE, 0xBA, 0x23, 0xBC,
-    0x27, 0x9F, 0x1E, 0xCA, 0x03, 0xE5, 0xBC, 0xC8, 0xDE, 0x96, 0xFB, 0x1E, 0xD8, 0x22, 0x9F, 0x79,
-    0x7B, 0x71, 0x7E, 0x46, 0x68, 0x32, 0x89, 0xED, 0x42, 0xDB, 0xA5, 0xB6, 0x8B, 0x6C, 0x17, 0x4C,
-    0x10, 0xA7, 0xB7, 0x30, 0x46, 0x08, 0x96, 0x63, 0x4A, 0x37, 0x68, 0x21, 0x68, 0xB9, 0x89, 0x29,
-    0x72, 0x48, 0x2F, 0x2B, 0x67, 0x18, 0xEB, 0x9B, 0x06, 0x4A, 0x01, 0x1F, 0xF1, 0xC7, 0x0D, 0xC6,
-    0x7F, 0x05, 0x9D, 0xD1, 0x03, 0x43, 0x45, 0x8A, 0x26, 0x13, 0x8E, 0x26, 0xEC, 0x4F, 0x84, 0x75,
-    0xE1, 0xED, 0x5F, 0x09, 0x1B, 0x99, 0xB5, 0x23, 0x8E, 0x3F, 0x03, 0x4B, 0x09, 0x2E, 0x85, 0x69,
-    0xF0, 0x9E, 0x18, 0x0B, 0x8C, 0xAF, 0xD8, 0x47, 0x38, 0xE4, 0x0D, 0xBE, 0x77, 0xBC, 0xF1, 0xF3,
-    0x3D, 0x27, 0x88, 0xCD, 0x77, 0x8F, 0x85, 0x17, 0x08, 0x3C, 0xB5, 0xAD, 0xF1, 0xA6, 0xB7, 0x46,
-    0x21, 0x5B, 0xF8, 0x88, 0x6A, 0x61, 0x43, 0xE4, 0x7B, 0xCF, 0x24, 0xA5, 0xF9, 0x81, 0x49, 0x70,
-    0xEB, 0x98, 0xC4, 0x82, 0xA8, 0xC8, 0xBA, 0x0B, 0xCC, 0x71, 0x25, 0x3C, 0x77, 0x89, 0x2D, 0xFD,
-    0xCE, 0xB3, 0x8D, 0x0F, 0x4B, 0x87, 0xB8, 0x3A, 0x6F, 0x82, 0xA6, 0xF8, 0x4E, 0x31, 0x88, 0x20,
-    0x12, 0x2B, 0xD6, 0x15, 0xD8, 0x07, 0x62, 0x4D, 0xC5, 0x02, 0x77, 0x80, 0x62, 0x21, 0x2F, 0x63,
-    0xEE, 0x1B, 0x11, 0xE7, 0x2E, 0x96, 0xC2, 0x4C, 0x7E, 0x45, 0xE2, 0x19, 0xD6, 0x42, 0x56, 0xCA,
-    0xF5, 0xC9, 0xA3, 0x0A, 0x36, 0x88, 0xD3, 0xCE, 0x52, 0xD3, 0x77, 0x8B, 0x7C, 0x2A, 0x5E, 0x9B,
-    0x32, 0x33, 0x9E, 0x31, 0xE7, 0x4F, 0x8C, 0xF0, 0xC0, 0x82, 0xA8, 0x90, 0xE6, 0x63, 0xD2, 0x4F,
-    0xCD, 0xE5, 0x1E, 0x66, 0x88, 0x3B, 0xD3, 0x5A, 0x92, 0x32, 0xAA, 0xBD, 0xAA, 0x0D, 0x9B, 0x38,
-    0x4F, 0xBE, 0x5C, 0xF8, 0xDD, 0xB6, 0x7C, 0x50, 0x98, 0x7E, 0x47, 0xCC, 0x6A, 0xD7, 0x1C, 0x1E,
-    0xCA, 0x39, 0x2F, 0x9B, 0x9D, 0x63, 0x9E, 0x3A, 0xEB, 0x69, 0x59, 0xDB, 0x7D, 0xC4, 0xA9, 0x8B,
-    0x9A, 0xB5, 0x57, 0x6E, 0x3A, 0xA6, 0x46, 0x66, 0x87, 0xBC, 0x60, 0x67, 0x47, 0xD8, 0xF5, 0xCD,
-    0xE1, 0xAE, 0x88, 0xEB, 0xAA, 0x19, 0x12, 0x93, 0x7D, 0x31, 0x7A, 0x5D, 0x5C, 0x87, 0xB6, 0x0D,
-    0x1A, 0x9E, 0x21, 0x42, 0x04, 0x2D, 0x85, 0x68, 0xA9, 0x31, 0xE1, 0x00, 0xE1, 0xFD, 0xC2, 0x36,
-    0xD4, 0xD1, 0x43, 0x52, 0x0F, 0xE1, 0x9B, 0xCB, 0x9F, 0xE5, 0x66, 0xAA, 0xCA, 0xB0, 0x15, 0xEB,
-    0xAC, 0x33, 0x93, 0xE6, 0x99, 0x88, 0xE1, 0x5D, 0xB9, 0xEA, 0x9E, 0x10, 0x3B, 0x9A, 0xFB, 0xBE,
-    0xFC, 0x07, 0x77, 0x4D, 0x71, 0xE5, 0x6E, 0x9E, 0xF5, 0x55, 0xFD, 0x62, 0xF9, 0x87, 0x72, 0x51,
-    0x2E, 0xEB, 0x2A, 0xA8, 0x13, 0xE1, 0x30, 0x17, 0x2F, 0xF2, 0xAE, 0xDF, 0xCB, 0x7A, 0x11, 0x1A,
-    0xA3, 0x4E, 0xAC, 0x22, 0x6D, 0x2A, 0x79, 0xC4, 0xFB, 0x0B, 0xAC, 0xEB, 0x11, 0xB6, 0x27, 0x47,
-    0x49, 0x2D, 0xEF, 0x45, 0x8D, 0xC8, 0x37, 0x68, 0xC5, 0xC0, 0xBD, 0x4E, 0xB4, 0x6C, 0xEE, 0x04,
-    0xE2, 0x57, 0xE6, 0xF3, 0x79, 0x5E, 0x41, 0x7E, 0x72, 0x74, 0x9B, 0xD6, 0xF8, 0xBF, 0x0F, 0x67,
-    0xCD, 0xB5, 0xF9, 0x8F, 0x33, 0x3B, 0x14, 0x94, 0xFE, 0x37, 0x50, 0xC6, 0x4F, 0xF7, 0xF7, 0x8D,
-    0x28, 0xE3, 0x0D, 0x6B, 0x3B, 0x28, 0x23, 0x93, 0x45, 0xDE, 0xEF, 0x90, 0xDD, 0x43, 0x28, 0x3F,
-    0x13, 0x65, 0x70, 0x9A, 0xF5, 0x7C, 0x73, 0x1B, 0xD3, 0x28, 0xCA, 0x10, 0xFB, 0x6F, 0xF9, 0x4A,
-    0x8C, 0x02, 0x93, 0xD8, 0xE3, 0xB6, 0x9C, 0x29, 0xB7, 0x9D, 0xC9, 0x75, 0xA2, 0x87, 0x1D, 0xDC,
-    0x65, 0x01, 0x65, 0x64, 0x22, 0xB9, 0x21, 0xF1, 0x6D, 0x9B, 0xFD, 0xBC, 0x8B, 0xFF, 0x61, 0x7E,
-    0xF4, 0xE2, 0x5F, 0x7F, 0x03, 0x65, 0x5C, 0x13, 0x69, 0x08, 0x63, 0xD6, 0x0E, 0x38, 0x3A, 0x82,
-    0xEB, 0xB1, 0x4D, 0x6C, 0xFB, 0xB4, 0x1C, 0x77, 0xCD, 0xEE, 0xA1, 0x49, 0x0F, 0x4D, 0x22, 0xA3,
-    0x1C, 0xA7, 0xEF, 0x8D, 0xF2, 0xBE, 0xCF, 0x3B, 0x18, 0x6F, 0x0F, 0x67, 0xB6, 0x5F, 0x33, 0x7C,
-    0x1F, 0x6E, 0x4E, 0xC5, 0xAC, 0x0E, 0xEF, 0xEB, 0x4E, 0x36, 0xDE, 0x2D, 0xF3, 0xF8, 0x0F, 0xAF,
-    0xE5, 0x60, 0x2E, 0x3F, 0x34, 0x9E, 0xAD, 0xCA, 0xA0, 0x8F, 0x85, 0xB3, 0xB8, 0xF1, 0x1B, 0xAC,
-    0xCE, 0xB8, 0x86, 0x80, 0x0D, 0x56, 0x10, 0x82, 0x8A, 0x2C, 0x3E, 0xAA, 0x0A, 0x6E, 0xA7, 0x0F,
-    0xF2, 0xB0, 0x0E, 0x4D, 0x3A, 0xBF, 0x2D, 0x77, 0x99, 0x44, 0xE3, 0x1F, 0xCA, 0x67, 0xE2, 0xA9,
-    0xAA, 0xDB, 0x8D, 0x37, 0x86, 0x9D, 0xDF, 0x8B, 0x55, 0xFF, 0x04, 0x96, 0x2D, 0x21, 0xC7, 0xA4,
-    0xA5, 0xB9, 0x24, 0xF2, 0xC8, 0xE0, 0x71, 0x8B, 0x5C, 0xBD, 0x4C, 0x52, 0x5F, 0x97, 0xFF, 0x5D,
-    0x39, 0xCE, 0xF2, 0x4A, 0xD6, 0xF3, 0x68, 0x3C, 0x61, 0xC1, 0xCC, 0xB1, 0x8A, 0xC5, 0x89, 0xCB,
-    0xE3, 0xD3, 0xDC, 0x88, 0x6B, 0x5B, 0x2D, 0xCB, 0x90, 0x21, 0x0C, 0x81, 0xAC, 0xC1, 0x28, 0x3E,
-    0x04, 0xC1, 0xB0, 0xE6, 0xA9, 0x35, 0x5E, 0x66, 0x25, 0x43, 0x5B, 0x8E, 0x03, 0xA8, 0xA4, 0x14,
-    0x77, 0x89, 0x97, 0x13, 0x35, 0x04, 0xE2, 0x68, 0x3A, 0x13, 0xC3, 0xC0, 0x64, 0x64, 0x0D, 0xE0,
-    0x59, 0xB2, 0xDE, 0xC4, 0x3F, 0x49, 0x68, 0x99, 0x4C, 0x2A, 0xA3, 0x2D, 0xFF, 0x76, 0x38, 0x1F,
-    0x3E, 0xB0, 0x3F, 0x13, 0x47, 0xFC, 0x89, 0xCD, 0x6D, 0x19, 0x97, 0x7B, 0xB2, 0xA0, 0x35, 0x36,
-    0x24, 0x39, 0x9D, 0x64, 0xB9, 0x72, 0x92, 0x19, 0x23, 0x47, 0x46, 0x93, 0xCD, 0x18, 0x4B, 0xE8,
-    0xDB, 0x8C, 0xF9, 0x3D, 0xAC, 0x81, 0x40, 0x64, 0x6B, 0xEB, 0xD8, 0x4E, 0x7F, 0xD6, 0x8B, 0x7F,
-    0x5B, 0x88, 0xE3, 0xCA, 0x64, 0x6C, 0x7E, 0xAB, 0x31, 0xE1, 0x18, 0x73, 0x0C, 0x38, 0x9A, 0x4B,
-    0xF7, 0x30, 0x9A, 0xD9, 0xFF, 0xE3, 0x28, 0xEC, 0x6C, 0x2D, 0x82, 0x45, 0x6E, 0x92, 0x45, 0x60,
-    0x95, 0x13, 0x93, 0x9A, 0xAA, 0xB6, 0xB5, 0x2D, 0x0B, 0xBC, 0x78, 0xD9, 0x88, 0xFF, 0x06, 0xBE,
-    0x90, 0x48, 0x0E, 0x15, 0xF0, 0x2F, 0x2B, 0x8B, 0xC9, 0x14, 0x9F, 0xCA, 0xC7, 0x47, 0x50, 0x4D,
-    0xD5, 0xC5, 0x0F, 0xDA, 0x2D, 0xD1, 0x4B, 0x4C, 0xBD, 0xA4, 0x54, 0x8D, 0x28, 0xA2, 0xA0, 0x22,
-    0xEE, 0x43, 0x0B, 0x22, 0x79, 0x59, 0xE8, 0xFB, 0xFB, 0x7B, 0x5C, 0xD0, 0x93, 0xC4, 0x35, 0xF1,
-    0x32, 0x71, 0x9D, 0xD4, 0x69, 0x19, 0x37, 0x59, 0x9E, 0xD4, 0x85, 0xC1, 0x7F, 0x2A, 0xFF, 0x59,
-    0x5E, 0xC8, 0x35, 0xD9, 0x6B, 0xA3, 0x08, 0x43, 0x62, 0xCA, 0xDC, 0x79, 0x2A, 0x31, 0x41, 0xA1,
-    0xEF, 0x10, 0x46, 0xB9, 0x2B, 0x48, 0x47, 0xCC, 0x65, 0x74, 0x2E, 0x29, 0x6E, 0xC5, 0xC8, 0xA2,
-    0x4E, 0x14, 0x14, 0x77, 0x85, 0x3C, 0xB8, 0x14, 0xD5, 0xDF, 0x17, 0x9B, 0xF2, 0x06, 0xF1, 0xBF,
-    0x41, 0x2B, 0x4A, 0x8C, 0xF3, 0x19, 0x02, 0x38, 0xF5, 0x75, 0xA4, 0xE8, 0x47, 0xC8, 0xA6, 0x7A,
-    0x2B, 0xDC, 0x4F, 0xEE, 0xF1, 0xA0, 0xA5, 0xCD, 0x83, 0x0B, 0x8F, 0x4B, 0xBD, 0x36, 0x14, 0x91,
-    0xF2, 0x4C, 0x1B, 0x4E, 0xA8, 0xF4, 0x92, 0xEB, 0x01, 0xEC, 0x11, 0x50, 0x14, 0x5C, 0x26, 0x98,
-    0xC3, 0xC6, 0xFB, 0x00, 0xDC, 0xC6, 0x65, 0x48, 0x9F, 0x95, 0x9A, 0xA4, 0x07, 0xDF, 0x87, 0x30,
-    0x14, 0x61, 0xBE, 0x37, 0xFF, 0xD3, 0x99, 0xFD, 0xFD, 0x3F, 0x69, 0x83, 0x4F, 0x60, 0x44, 0x51,
-    0x1D, 0x33, 0x22, 0x26, 0xF9, 0x8C, 0x0F, 0xD8, 0x35, 0x77, 0x68, 0x4A, 0x77, 0xFD, 0x06, 0xEB,
-    0xC5, 0xEB, 0x43, 0x86, 0xF1, 0xA0, 0xDD, 0x9A, 0x57, 0x5F, 0xE8, 0xDA, 0xC4, 0xBA, 0x4C, 0xD4,
-    0xFF, 0x90, 0x08, 0xE1, 0x1D, 0x44, 0x24, 0x96, 0x46, 0x69, 0x2E, 0xEC, 0xEF, 0x29, 0x7F, 0x71,
-    0x4E, 0xF6, 0x76, 0x95, 0xBB, 0xBB, 0xCA, 0x5C, 0x4F, 0xDE, 0xA0, 0x70, 0xB9, 0x55, 0xC4, 0x15,
-    0xC9, 0x9B, 0xC9, 0xC3, 0x76, 0x95, 0xAF, 0xBB, 0x64, 0x8B, 0xDC, 0x17, 0xCA, 0x7C, 0x61, 0xE2,
-    0xF7, 0xAA, 0x46, 0x78, 0x4A, 0xE3, 0x2F, 0x47, 0x61, 0xE9, 0x9D, 0xB4, 0x9E, 0x84, 0xA3, 0x21,
-    0x35, 0x45, 0x61, 0x7F, 0xDD, 0x25, 0xA6, 0xD8, 0xDF, 0x7F, 0xAB, 0xA6, 0x8A, 0xE5, 0x99, 0x00,
-    0x2F, 0x42, 0xA2, 0xC4, 0x11, 0xDC, 0x2A, 0x6C, 0xF0, 0x4C, 0xC8, 0x18, 0xCF, 0x3C, 0x04, 0xC3,
-    0x14, 0x95, 0xBC, 0x11, 0x95, 0xDF, 0xC1, 0x33, 0x67, 0xE6, 0x55, 0x39, 0xD1, 0x9B, 0xE6, 0xBD,
-    0x3C, 0x53, 0x96, 0x0E, 0x1E, 0xEC, 0xCF, 0xE7, 0xB7, 0xE0, 0x9C, 0x78, 0xAD, 0xAD, 0x78, 0x49,
-    0x30, 0xC8, 0xC2, 0x17, 0x1C, 0x14, 0x74, 0x12, 0x9D, 0x10, 0x78, 0x1A, 0x79, 0xBD, 0x6B, 0x14,
-    0xC4, 0xDC, 0xA5, 0xF0, 0x73, 0x58, 0x84, 0x79, 0xA5, 0xE7, 0xB3, 0x4C, 0xD1, 0x93, 0x41, 0x80,
-    0x28, 0xEA, 0x4C, 0x98, 0xDB, 0x75, 0xF3, 0x68, 0xFE, 0x5C, 0x9E, 0x9A, 0xBD, 0xD7, 0xA9, 0x62,
-    0x5E, 0x6F, 0x42, 0x31, 0x4C, 0x6F, 0x8A, 0xCB, 0x78, 0x94, 0x15, 0x2B, 0x8C, 0xCD, 0x46, 0xB3,
-    0x35, 0xCF, 0xDF, 0x31, 0xFF, 0x4D, 0xED, 0x0E, 0xC1, 0xC7, 0xB8, 0xB1, 0xDF, 0xC5, 0xAF, 0x83,
-    0xBA, 0xB0, 0xBE, 0xC1, 0xE8, 0x1D, 0xE7, 0x77, 0x20, 0x60, 0x89, 0x3D, 0x58, 0xEF, 0xC2, 0xAE,
-    0x37, 0xBF, 0xFD, 0xA8, 0x04, 0x00, 0xA7, 0x9E, 0x40, 0x04, 0x74, 0x09, 0x22, 0xE8, 0xFB, 0x72,
-    0x09, 0x68, 0xBC, 0x9F, 0x39, 0xBB, 0x4F, 0x3C, 0x99, 0xAB, 0x01, 0x02, 0x0D, 0x25, 0xB8, 0xA8,
-    0x73, 0x90, 0xDC, 0xFD, 0x9C, 0x75, 0x80, 0x39, 0x76, 0x0A, 0xDF, 0x56, 0xB0, 0x83, 0x53, 0x65,
-    0x19, 0x22, 0xF0, 0x24, 0xAD, 0x7A, 0xA4, 0x2A, 0x07, 0x97, 0xFC, 0xEF, 0xC4, 0xD1, 0x0D, 0x56,
-    0x70, 0x6E, 0x95, 0x07, 0x7D, 0x56, 0x27, 0x02, 0xAB, 0x04, 0x57, 0xB9, 0xC0, 0x04, 0x26, 0x7E,
-    0xAC, 0x90, 0x7B, 0xE1, 0x82, 0x81, 0x5B, 0xEC, 0x74, 0x71, 0x6A, 0xE3, 0x46, 0xB5, 0xAE, 0xF4,
-    0xAD, 0x7E, 0x22, 0x7D, 0x33, 0x51, 0x2B, 0x53, 0x0F, 0x68, 0x0A, 0x5A, 0xBD, 0xF9, 0x92, 0x93,
-    0xFF, 0xB9, 0x82, 0xF1, 0x7F, 0xA4, 0x5F, 0x8C, 0x7F, 0xC8, 0x29, 0x09, 0xC8, 0xF2, 0x2C, 0x20,
-    0x08, 0xBF, 0xEB, 0x73, 0xEA, 0x39, 0xF9, 0x2D, 0xA9, 0x08, 0x6B, 0x4E, 0xE2, 0x6B, 0x27, 0x65,
-    0x14, 0x53, 0xA6, 0xE8, 0xB5, 0xE2, 0x04, 0x89, 0x56, 0x2A, 0x50, 0x59, 0xE3, 0x8A, 0x85, 0x69,
-    0x6A, 0xF0, 0xFD, 0xEA, 0x94, 0x77, 0x75, 0x9A, 0x88, 0x60, 0x2F, 0xDB, 0x23, 0xC1, 0xED, 0x0F,
-    0x33, 0x01, 0x11, 0x99, 0x55, 0x46, 0x5F, 0x3C, 0xDA, 0xA0, 0x5E, 0xA5, 0xAC, 0x1F, 0xF9, 0x8A,
-    0x3C, 0x42, 0xE5, 0xDD, 0x33, 0xA7, 0x86, 0x69, 0xA7, 0x6A, 0xA2, 0x64, 0x51, 0xF1, 0xA4, 0x0A,
-    0xCF, 0x34, 0x19, 0x62, 0x68, 0x0B, 0x1B, 0x78, 0x53, 0xF0, 0x9C, 0x9F, 0x16, 0xA6, 0x2F, 0xAA,
-    0x16, 0x6D, 0x73, 0x8E, 0x00, 0x72, 0x38, 0xC4, 0x03, 0x03, 0xC2, 0xC9, 0x97, 0x4C, 0xA5, 0x9C,
-    0x9D, 0x39, 0x2D, 0x2A, 0xF6, 0x7A, 0x2E, 0xD5, 0x60, 0x84, 0xEB, 0x58, 0x4E, 0xBE, 0xA6, 0x18,
-    0x9B, 0xAB, 0xF7, 0x54, 0xE8, 0x76, 0x4B, 0x59, 0x2A, 0x48, 0x8B, 0xF7, 0xF0, 0x5D, 0x92, 0xDB,
-    0xC4, 0xEA, 0xB2, 0xE2, 0xB5, 0x57, 0x5E, 0x5F, 0xA8, 0xB1, 0x8F, 0xDF, 0x62, 0x6E, 0x91, 0xC6,
-    0x5B, 0x3E, 0x3A, 0x39, 0x39, 0x32, 0x7F, 0x37, 0x1A, 0x25, 0xCE, 0xFB, 0xE5, 0xC8, 0xE8, 0x28,
-    0x8F, 0xF8, 0x78, 0x70, 0x47, 0xF1, 0x1B, 0xBD, 0x51, 0x78, 0x93, 0x22, 0xAE, 0x90, 0xDD, 0xC3,
-    0xB8, 0x73, 0xAA, 0xEF, 0x97, 0x47, 0x7E, 0x1B, 0xB7, 0x0E, 0x5C, 0xD7, 0x89, 0x73, 0xF5, 0xB1,
-    0x2B, 0x02, 0x00, 0x2F, 0x64, 0x1A, 0x84, 0x25, 0xA8, 0xCA, 0x11, 0x93, 0x08, 0x41, 0x2E, 0xE5,
-    0x32, 0x32, 0x54, 0x2E, 0x54, 0x28, 0xB3, 0x4C, 0xE1, 0x97, 0x47, 0x87, 0x2A, 0x07, 0x86, 0x6D,
-    0x17, 0x60, 0x84, 0x7F, 0xC8, 0x6D, 0x8B, 0xFE, 0x15, 0xF2, 0x8C, 0x09, 0x12, 0x70, 0x94, 0x10,
-    0x27, 0x80, 0x9B, 0x19, 0xAF, 0x8B, 0x91, 0x79, 0x9A, 0x57, 0xEC, 0x91, 0x5F, 0x91, 0xDD, 0x0C,
-    0xA5, 0x11, 0x24, 0x50, 0x6B, 0x75, 0x22, 0xA4, 0x83, 0x09, 0xC9, 0xAB, 0x10, 0xAB, 0x83, 0x05,
-    0xFE, 0x84, 0x2F, 0x01, 0xF3, 0x22, 0x49, 0xB9, 0x5C, 0x02, 0xA3, 0xD7, 0x7A, 0xA4, 0x47, 0xB5,
-    0x17, 0x72, 0x8C, 0x55, 0x3E, 0x0A, 0xD5, 0x55, 0x42, 0x0A, 0xE1, 0x9B, 0x35, 0x50, 0xFF, 0x15,
-    0x63, 0xDA, 0xAC, 0x6C, 0x08, 0xF7, 0xF9, 0x8E, 0x11, 0xB4, 0x20, 0xBC, 0xFA, 0xF6, 0x16, 0x62,
-    0x70, 0x41, 0x19, 0x45, 0xAC, 0x71, 0x99, 0x1B, 0xB9, 0x8A, 0xF0, 0xA4, 0x92, 0x62, 0x74, 0x2D,
-    0x06, 0x6B, 0x25, 0x2B, 0x8A, 0x3C, 0x65, 0x59, 0x29, 0x75, 0x61, 0x79, 0xBE, 0x11, 0x8C, 0x5D,
-    0x74, 0xDA, 0x0C, 0xC6, 0x9E, 0x53, 0xDE, 0x2A, 0x33, 0x52, 0x03, 0x29, 0xD5, 0x3A, 0xE4, 0x12,
-    0x81, 0x49, 0x48, 0xB3, 0x44, 0x53, 0x89, 0x66, 0x5C, 0xB1, 0xDE, 0x32, 0x51, 0x60, 0x80, 0xAA,
-    0xDB, 0xB4, 0x1E, 0xFB, 0x7D, 0x37, 0xA9, 0x61, 0x05, 0x6E, 0xB2, 0x76, 0xD2, 0xCC, 0x9B, 0x05,
-    0x16, 0x7D, 0x68, 0xBC, 0x39, 0xA9, 0xF1, 0x38, 0xCB, 0x71, 0x66, 0x03, 0x51, 0x1D, 0x91, 0x74,
-    0xAF, 0x25, 0x0D, 0x20, 0xBB, 0x52, 0xC3, 0xB7, 0xC4, 0x41, 0x07, 0x4A, 0x26, 0x74, 0x6B, 0xF3,
-    0xF5, 0x98, 0xAC, 0xF2, 0x05, 0x94, 0x5E, 0x8B, 0xC9, 0xFA, 0x28, 0x87, 0x86, 0xD6, 0x63, 0xF2,
-    0xB7, 0x9D, 0xE9, 0xB9, 0x7B, 0xA2, 0x7A, 0x63, 0x7D, 0x33, 0xFD, 0x4B, 0xDE, 0xEF, 0x1E, 0xC0,
-    0xB2, 0xB0, 0x4E, 0x55, 0x7B, 0xEB, 0xAA, 0xFE, 0x76, 0x33, 0x2D, 0x49, 0x0C, 0xA3, 0xD4, 0xA0,
-    0x51, 0xCA, 0x4D, 0xBD, 0x86, 0xA2, 0xA7, 0x44, 0xA9, 0x6F, 0x35, 0xB7, 0x1E, 0x41, 0xD7, 0x64,
-    0x5C, 0x82, 0xA6, 0x65, 0x03, 0xE6, 0x21, 0xFE, 0x06, 0xBF, 0xB1, 0x63, 0x11, 0xC9, 0x27, 0x93,
-    0xAC, 0xD2, 0x95, 0x49, 0xD4, 0x0B, 0xD8, 0xE5, 0x5D, 0xC8, 0x14, 0x59, 0x22, 0x43, 0x64, 0x87,
-    0x11, 0x80, 0x85, 0x5D, 0x32, 0x12, 0xAF, 0x86, 0xF6, 0xC4, 0xBF, 0xD4, 0x4B, 0xFF, 0x45, 0x6F,
-    0xC2, 0xBB, 0xD3, 0x73, 0xE3, 0x81, 0x07, 0xF6, 0x3F, 0x11, 0xA6, 0x54, 0x32, 0x97, 0x6E, 0x2D,
-    0xCF, 0xB4, 0xCB, 0x2A, 0x39, 0xCB, 0x97, 0x88, 0x55, 0x2B, 0xA4, 0xF4, 0xBC, 0x90, 0x4B, 0x4C,
-    0x1B, 0xE3, 0x30, 0x65, 0x3D, 0x90, 0x99, 0x26, 0x92, 0xC9, 0x5A, 0x34, 0x72, 0xE6, 0x44, 0xBC,
-    0xCF, 0x09, 0xB9, 0x7E, 0x2B, 0x9A, 0x0F, 0x7B, 0xC9, 0xB8, 0xC3, 0x3E, 0xC1, 0x26, 0x06, 0x7C,
-    0x7A, 0xEE, 0x3D, 0x66, 0xEC, 0xCF, 0x03, 0xA5, 0x42, 0xC6, 0x7F, 0x39, 0xA4, 0x81, 0xFB, 0x55,
-    0xF5, 0xEF, 0x4F, 0x7A, 0x7A, 0xA5, 0xC8, 0x25, 0xE5, 0x36, 0x04, 0xEF, 0x2E, 0x24, 0x45, 0x3D,
-    0x89, 0x92, 0xF0, 0x07, 0xB2, 0x84, 0x16, 0xDF, 0x4D, 0x23, 0xA7, 0x80, 0x13, 0x76, 0x62, 0xEA,
-    0x60, 0x44, 0x35, 0xAC, 0x94, 0x28, 0x0C, 0x12, 0xE5, 0x02, 0xDC, 0x41, 0x2E, 0xC7, 0x14, 0xB3,
-    0xB4, 0x87, 0x78, 0x0C, 0x52, 0x33, 0x16, 0xF4, 0x10, 0x35, 0x41, 0xAE, 0x65, 0x3D, 0xCF, 0x9F,
-    0xF8, 0xF0, 0x68, 0x20, 0xD1, 0xC0, 0x6F, 0xD6, 0x6C, 0xC9, 0x47, 0x07, 0x0A, 0x0B, 0x64, 0xCD,
-    0x4D, 0x4E, 0xE1, 0x17, 0x97, 0xE9, 0xAD, 0xAD, 0xAF, 0x3B, 0xD7, 0xDA, 0xDF, 0xE4, 0xC1, 0xD5,
-    0x50, 0xD1, 0x8C, 0xB9, 0x6E, 0x96, 0xA5, 0xAD, 0xCD, 0x04, 0x40, 0x78, 0x2F, 0xC5, 0x31, 0x4C,
-    0xE0, 0xBE, 0x91, 0xEB, 0xC0, 0x78, 0xD5, 0x2E, 0x05, 0xD6, 0x19, 0xC2, 0x35, 0x82, 0x4E, 0x6E,
-    0x12, 0xFD, 0xFD, 0xA8, 0x65, 0x17, 0xF3, 0xEB, 0x05, 0xB7, 0xDE, 0x04, 0x71, 0x59, 0x42, 0x1F,
-    0x09, 0xD1, 0x42, 0xDA, 0x31, 0x5D, 0xB8, 0x70, 0xC1, 0x8A, 0x41, 0x9B, 0xE9, 0x41, 0xD0, 0x08,
-    0x7E, 0xA0, 0xDB, 0xAB, 0x63, 0xF5, 0xEF, 0x61, 0x1D, 0x0D, 0xAC, 0xD0, 0x46, 0xA5, 0xC8, 0x88,
-    0x9B, 0x22, 0xB9, 0xBF, 0x60, 0x3A, 0x16, 0xE7, 0x9E, 0x65, 0x36, 0x2A, 0x8E, 0xCE, 0xBE, 0x51,
-    0x2B, 0xC0, 0x2C, 0xFE, 0xA2, 0xD4, 0x12, 0x40, 0xF6, 0x4F, 0xB9, 0x16, 0x7E, 0x52, 0xEC, 0xF5,
-    0x80, 0x82, 0xD8, 0x3A, 0xF0, 0x15, 0x4D, 0x0A, 0xDB, 0x50, 0xD5, 0x34, 0x2C, 0xC4, 0x04, 0x0B,
-    0x16, 0xD3, 0x8F, 0x74, 0x0F, 0xAC, 0x02, 0x52, 0xD1, 0x55, 0x6F, 0xAE, 0x95, 0xEB, 0x6E, 0x4E,
-    0x51, 0x8A, 0x83, 0x29, 0xC6, 0x38, 0xC8, 0xB5, 0xF3, 0xA4, 0xB4, 0x3C, 0x8A, 0x07, 0x98, 0x0F,
-    0x57, 0xD8, 0x12, 0xC9, 0xA5, 0x28, 0x17, 0x88, 0x0B, 0xB8, 0x0A, 0x5A, 0xAA, 0x69, 0x70, 0xDC,
-    0xF2, 0xAB, 0xBD, 0x89, 0x01, 0x9E, 0xD6, 0x9A, 0xB4, 0xA1, 0x4E, 0x04, 0x63, 0x69, 0x4B, 0x4B,
-    0x4D, 0x5B, 0xC2, 0xB1, 0xAC, 0x21, 0x1E, 0xCB, 0x1A, 0x02, 0xB2, 0xAC, 0xA6, 0xC5, 0x16, 0x3A,
-    0x55, 0xB9, 0xF3, 0x4E, 0x98, 0xC4, 0x22, 0x30, 0xC9, 0x0D, 0x01, 0x1B, 0xC4, 0x30, 0x12, 0xB5,
-    0x20, 0xDC, 0x4C, 0x3E, 0x00, 0x20, 0x03, 0xF8, 0x9E, 0x34, 0xEB, 0x2D, 0x1E, 0x91, 0x4C, 0xD5,
-    0xA9, 0x31, 0x17, 0x96, 0xCE, 0x77, 0x13, 0x79, 0x14, 0xEB, 0xC8, 0xC3, 0x89, 0xC0, 0xED, 0xB2,
-    0x6E, 0x18, 0xCA, 0xA9, 0xE0, 0x5D, 0xE3, 0x93, 0x09, 0x27, 0x67, 0xFA, 0x1A, 0xE5, 0x0E, 0xC8,
-    0xEE, 0xC8, 0x38, 0x15, 0xB4, 0xBA, 0x73, 0x60, 0x4E, 0x1D, 0xEF, 0xCE, 0x49, 0xD8, 0xF6, 0x1C,
-    0x11, 0xC1, 0x02, 0x7B, 0xD0, 0xD1, 0x77, 0x99, 0x60, 0x9C, 0x33, 0x45, 0xFB, 0x04, 0xD6, 0x3C,
-    0x15, 0x4C, 0x1F, 0xAB, 0x36, 0x17, 0x8C, 0x13, 0xBE, 0x4E, 0xDE, 0xA8, 0x66, 0x7E, 0xFE, 0x29,
-    0xF0, 0xEB, 0x74, 0xAC, 0x70, 0xC9, 0xD2, 0xCC, 0x4B, 0xC8, 0x2F, 0x33, 0xE4, 0x51, 0x12, 0x92,
-    0x3A, 0x70, 0x3C, 0xB2, 0x7E, 0x5E, 0x2C, 0x21, 0x04, 0x65, 0xC1, 0x23, 0xBE, 0x87, 0x4F, 0x79,
-    0x1E, 0xAF, 0xE0, 0xB5, 0xD7, 0x61, 0x19, 0x6B, 0xB2, 0xC9, 0x4F, 0x4A, 0x85, 0x22, 0xA6, 0x58,
-    0xC5, 0xB4, 0x78, 0x8A, 0x98, 0x02, 0x4B, 0x31, 0x45, 0x15, 0xC5, 0x74, 0x55, 0xC5, 0xB4, 0xA3,
-    0x62, 0xEA, 0x29, 0x26, 0xBF, 0xA5, 0x98, 0xC2, 0x9A, 0x62, 0x8A, 0x55, 0x4C, 0x33, 0x15, 0xD3,
-    0x31, 0xC5, 0x24, 0x61, 0x02, 0x62, 0x0A, 0x6A, 0x8A, 0x29, 0xCA, 0x29, 0xA6, 0xAB, 0x2A, 0xA6,
-    0x1D, 0x15, 0x53, 0x4F, 0x31, 0xFD, 0xAC, 0xA5, 0x98, 0x3E, 0xAF, 0x29, 0x26, 0xAB, 0x62, 0x5A,
-    0xAC, 0x8B, 0xC9, 0xB3, 0x14, 0x53, 0xF0, 0x6F, 0x14, 0x53, 0x94, 0x53, 0x4C, 0x2F, 0x98, 0x4D,
-    0x6F, 0xA8, 0x9D, 0x02, 0xAE, 0x5B, 0x42, 0xB2, 0x91, 0xE5, 0x36, 0x90, 0x3A, 0x8A, 0xFC, 0xF1,
-    0xD5, 0x91, 0xC9, 0xBD, 0x52, 0x3B, 0xE8, 0xD4, 0x7B, 0x40, 0xEA, 0x93, 0xE2, 0x95, 0x63, 0x45,
-    0x2C, 0xAE, 0x06, 0xD0, 0x11, 0x15, 0xA0, 0xB6, 0x3F, 0x1A, 0xAD, 0xE3, 0x73, 0x6B, 0x12, 0x4F,
-    0x93, 0xB0, 0x07, 0x24, 0x21, 0x1C, 0x12, 0x1C, 0xD4, 0x0A, 0x0E, 0x4A, 0xA2, 0x02, 0x79, 0x20,
-    0x50, 0x81, 0x4C, 0x08, 0x51, 0xB1, 0x82, 0x98, 0x44, 0xA7, 0x6D, 0x0D, 0xCE, 0x33, 0x75, 0xDD,
-    0x3B, 0x3A, 0x1D, 0xEA, 0x34, 0x30, 0x93, 0xF4, 0x9C, 0xB1, 0xB4, 0x2C, 0x97, 0x03, 0x83, 0x87,
-    0x9A, 0x00, 0x68, 0x0C, 0x14, 0x7A, 0x96, 0x0D, 0x1D, 0xDA, 0x0E, 0xE3, 0x80, 0xD6, 0x32, 0x69,
-    0x08, 0x5D, 0x46, 0xA0, 0x1F, 0xCD, 0x9E, 0xC8, 0xBC, 0x4F, 0x09, 0xEF, 0xCB, 0x30, 0xA8, 0x8A,
-    0x2F, 0x5C, 0xB3, 0xCC, 0x42, 0x7B, 0x63, 0x32, 0xDD, 0xFA, 0x74, 0x69, 0x80, 0x77, 0xCA, 0x78,
-    0x8F, 0xCA, 0x6D, 0x85, 0x3F, 0x0C, 0xFE, 0x69, 0x4D, 0x4C, 0x9C, 0xE8, 0x66, 0xE7, 0xE3, 0xF8,
-    0xF0, 0x14, 0x19, 0xFB, 0x7C, 0x3D, 0x43, 0x76, 0x0B, 0xDE, 0xD5, 0x99, 0x32, 0x17, 0x2E, 0x9E,
-    0xD8, 0xFA, 0x49, 0xED, 0xE8, 0x09, 0x84, 0xCF, 0x74, 0x02, 0xB4, 0x14, 0x3E, 0xE0, 0xCF, 0x90,
-    0xC0, 0x5B, 0x5D, 0x25, 0xE2, 0xE4, 0x52, 0xCD, 0x17, 0x0E, 0x35, 0xDF, 0xE8, 0x35, 0x2A, 0x30,
-    0x0F, 0x69, 0x09, 0x2B, 0xE2, 0x8E, 0xBB, 0x70, 0x51, 0x37, 0xD3, 0x67, 0x6B, 0x23, 0xD6, 0xA3,
-    0xD6, 0xA1, 0xF6, 0xB5, 0x45, 0xF8, 0x58, 0x3A, 0xBF, 0x99, 0xC7, 0xBB, 0x69, 0x58, 0xE7, 0xC0,
-    0xA5, 0xF3, 0x09, 0x5F, 0xBD, 0x68, 0xA7, 0x5B, 0x9A, 0xD0, 0x34, 0x2E, 0xBF, 0xAA, 0x99, 0xD7,
-    0x30, 0xF3, 0xE1, 0x5B, 0x5A, 0xCB, 0x54, 0xD4, 0x57, 0x31, 0xDD, 0xB1, 0x1F, 0x21, 0x98, 0x4D,
-    0xC8, 0x30, 0x3C, 0xAD, 0x27, 0x8E, 0x08, 0x34, 0xFE, 0xE8, 0xB2, 0x99, 0x80, 0x55, 0x57, 0x19,
-    0x43, 0x7A, 0x5C, 0x79, 0x9E, 0x66, 0x32, 0x9A, 0xC8, 0x68, 0x1E, 0x23, 0x71, 0x2D, 0x69, 0x3C,
-    0x08, 0xE2, 0x8B, 0xDB, 0x0B, 0x16, 0x83, 0x6F, 0x9D, 0xF4, 0x54, 0xF1, 0x81, 0x5A, 0x38, 0x65,
-    0x45, 0xE4, 0x80, 0xC9, 0x56, 0xE5, 0x82, 0x96, 0xC1, 0x5E, 0xA3, 0x59, 0x51, 0x23, 0xA8, 0x5D,
-    0x79, 0x97, 0xBB, 0x16, 0x0E, 0xA4, 0xB3, 0x3A, 0x86, 0x26, 0x87, 0xDC, 0x75, 0x9E, 0xB8, 0x0C,
-    0x91, 0xF3, 0xA4, 0x73, 0x86, 0xDD, 0x75, 0x6C, 0x80, 0x8E, 0xC1, 0x34, 0xA7, 0xE4, 0xB4, 0xA4,
-    0xE1, 0x8F, 0xDA, 0x9D, 0x10, 0x0C, 0xDA, 0xC3, 0x10, 0xF4, 0x8A, 0xFA, 0xC3, 0x4E, 0x01, 0x70,
-    0xD4, 0xB9, 0xF2, 0x68, 0xAB, 0x09, 0x44, 0xDC, 0xAA, 0x3E, 0x24, 0x6D, 0x65, 0xAD, 0x1C, 0x9B,
-    0xDF, 0x83, 0x92, 0x41, 0xF1, 0xA3, 0x18, 0xC2, 0xF9, 0xB5, 0x9A, 0xD9, 0x44, 0x11, 0x36, 0x3A,
-    0x47, 0x8D, 0xA6, 0x19, 0x51, 0xC7, 0x86, 0xBC, 0x29, 0x98, 0x0E, 0x5A, 0x02, 0xEB, 0x8A, 0x95,
-    0x91, 0xD1, 0x9C, 0xDD, 0x5B, 0x29, 0x74, 0xA9, 0x43, 0xD7, 0xBC, 0x77, 0xA2, 0x45, 0xED, 0x10,
-    0x5B, 0x95, 0x41, 0x33, 0x27, 0xA4, 0xEC, 0xD3, 0x8D, 0x1D, 0x4C, 0x67, 0x1D, 0xD5, 0xDA, 0xF6,
-    0xA5, 0x1A, 0xB2, 0xAB, 0x97, 0xAE, 0x19, 0x30, 0x9F, 0x2A, 0xF1, 0x1A, 0x19, 0xD2, 0xAF, 0x0E,
-    0xB0, 0x66, 0xB8, 0x37, 0x6F, 0xA1, 0x4D, 0x9F, 0xDA, 0x0C, 0xA8, 0xC7, 0x93, 0x6E, 0x49, 0xF4,
-    0x96, 0x34, 0xEC, 0x2D, 0xA9, 0x5D, 0xDB, 0x64, 0xC6, 0x66, 0x06, 0xD1, 0x63, 0x81, 0x30, 0x8C,
-    0x11, 0xBD, 0x92, 0xB9, 0x6F, 0x79, 0x33, 0xE8, 0xA1, 0xBE, 0x52, 0x01, 0xEB, 0x1C, 0x57, 0x6F,
-    0xA0, 0x61, 0x41, 0xF4, 0x10, 0xDA, 0x1C, 0x0D, 0x22, 0x6F, 0x72, 0x1B, 0x57, 0x54, 0xFC, 0xC1,
-    0xAA, 0xD4, 0xA4, 0x56, 0x71, 0x7F, 0xD5, 0x95, 0xA8, 0x34, 0xAF, 0x43, 0xCF, 0xE7, 0x81, 0x66,
-    0x15, 0x74, 0xB8, 0xD0, 0x2D, 0x08, 0x1A, 0x32, 0x04, 0xED, 0x0D, 0xDC, 0xDD, 0x6E, 0x40, 0xF4,
-    0xC6, 0xCE, 0xE1, 0xF3, 0x40, 0xF3, 0xC5, 0x55, 0x11, 0x20, 0xB2, 0xBD, 0x50, 0x72, 0x8E, 0xE9,
-    0xFF, 0x32, 0xF7, 0x3F, 0xF3, 0x5C, 0x49, 0xD8, 0x6F, 0x23, 0xF6, 0xA0, 0xC0, 0xF7, 0x47, 0x5C,
-    0x8C, 0x21, 0x2B, 0x44, 0x8F, 0x95, 0x88, 0x9E, 0x17, 0xD9, 0x6A, 0x2F, 0x99, 0xEE, 0x23, 0xBF,
-    0xF3, 0x36, 0xF4, 0xDE, 0xB3, 0x4C, 0xD1, 0x05, 0xAB, 0xF1, 0x5E, 0x52, 0x9E, 0x9C, 0xA3, 0x26,
-    0xFF, 0xFC, 0xD0, 0x2F, 0xA8, 0x17, 0x64, 0xF8, 0x76, 0xC1, 0x6E, 0xD0, 0xA4, 0x3F, 0xF8, 0xAB,
-    0xCF, 0x70, 0x8B, 0x52, 0x4E, 0x2B, 0x4A, 0x89, 0x68, 0xDC, 0x45, 0x52, 0x77, 0x9F, 0x95, 0xE2,
-    0xDB, 0x85, 0xB6, 0x22, 0x57, 0x07, 0x6F, 0x11, 0xA0, 0x93, 0x46, 0xCE, 0x40, 0x5B, 0x64, 0x2D,
-    0xA1, 0x06, 0xE4, 0xFC, 0x8B, 0xD5, 0x26, 0x27, 0xB4, 0x57, 0x80, 0xB0, 0x1F, 0x69, 0x5C, 0xA9,
-    0x5C, 0x0D, 0xCF, 0xBA, 0x92, 0x1B, 0xE7, 0xAC, 0x54, 0xAF, 0x9A, 0xD5, 0xE1, 0xDB, 0x0D, 0xBA,
-    0x61, 0xBB, 0xED, 0x78, 0xD8, 0x12, 0x8E, 0xED, 0x10, 0x20, 0x56, 0xF9, 0x12, 0xAB, 0xD9, 0x07,
-    0x7D, 0xC1, 0x49, 0xCB, 0x11, 0x8B, 0x9D, 0xB1, 0xCF, 0x2C, 0xB8, 0xE6, 0x5E, 0x61, 0x02, 0x02,
-    0xE3, 0x5A, 0x48, 0x7B, 0x41, 0xBD, 0x09, 0x37, 0xA6, 0xD6, 0xCA, 0x7C, 0xF5, 0x49, 0x11, 0xF1,
-    0x64, 0xA0, 0x27, 0xE5, 0x07, 0x29, 0x9E, 0x1C, 0x0F, 0x3E, 0x3B, 0x6D, 0x50, 0xC9, 0x66, 0x3E,
-    0xB0, 0xB7, 0xC4, 0xBA, 0xCC, 0xD4, 0xB4, 0x45, 0x7A, 0x5C, 0xA6, 0x02, 0x50, 0x53, 0xC4, 0x2D,
-    0x2E, 0xD6, 0xDA, 0xBC, 0x0F, 0x4F, 0x22, 0xB4, 0x22, 0xC4, 0x55, 0x7D, 0x7B, 0x73, 0xD7, 0xD9,
-    0x89, 0x9A, 0xD4, 0x43, 0x1A, 0x05, 0xBA, 0x26, 0x29, 0x5E, 0xAA, 0x9E, 0x82, 0xB5, 0x4B, 0x91,
-    0x42, 0x9E, 0x14, 0x26, 0x25, 0xF9, 0xA3, 0xAF, 0xA7, 0x7E, 0x6B, 0x83, 0x7A, 0x76, 0x4C, 0x3A,
-    0x2C, 0xCB, 0x78, 0xC6, 0x90, 0xB8, 0x58, 0x6E, 0x22, 0xAD, 0x37, 0xD4, 0x3C, 0x73, 0xAA, 0x7E,
-    0xCB, 0x6A, 0xF5, 0xB3, 0xA5, 0x8A, 0x5E, 0x87, 0xF5, 0xE8, 0x08, 0x43, 0xF8, 0x94, 0xA2, 0xF4,
-    0x33, 0x25, 0xE8, 0xD2, 0x2D, 0x18, 0x72, 0xC0, 0xDD, 0x5F, 0xC0, 0xC7, 0xAB, 0x2B, 0x32, 0x8A,
-    0x85, 0x39, 0x38, 0x41, 0x5F, 0xFD, 0xF2, 0x1B, 0x0D, 0x9D, 0xF3, 0x0F, 0xAB, 0x26, 0xC3, 0xD2,
-    0x41, 0x23, 0x59, 0x73, 0xD9, 0xFB, 0x79, 0x66, 0xF3, 0x64, 0xD0, 0x5C, 0x7D, 0xAE, 0x60, 0x37,
-    0xEC, 0x57, 0xAD, 0x73, 0xC7, 0x9B, 0xE0, 0x00, 0x8D, 0xE4, 0x07, 0x5A, 0xB6, 0x26, 0x22, 0x01,
-    0x1A, 0x41, 0xFA, 0x17, 0x69, 0x81, 0x5A, 0xE1, 0x79, 0xA3, 0x9D, 0x5C, 0x58, 0x65, 0x60, 0x88,
-    0xFF, 0xB9, 0xFE, 0x03, 0x46, 0xCA, 0x33, 0x85, 0x79, 0xC1, 0xF0, 0x83, 0x2B, 0x11, 0x5C, 0x2B,
-    0x05, 0x6A, 0x7A, 0xB6, 0x0B, 0x7F, 0xD9, 0x25, 0xE5, 0xF8, 0x8E, 0x99, 0x9D, 0x5F, 0x46, 0x9E,
-    0xC4, 0xE6, 0x97, 0x2D, 0x81, 0xEE, 0xC4, 0x86, 0xC8, 0x71, 0x09, 0x32, 0xD7, 0x19, 0x5C, 0x3A,
-    0x40, 0xF0, 0x28, 0x63, 0x7B, 0x2B, 0xB6, 0x0D, 0x0A, 0x76, 0x7B, 0x68, 0x13, 0xCC, 0x6A, 0x8B,
-    0xBF, 0xFC, 0xDE, 0x7A, 0x92, 0xF2, 0x7F, 0xBC, 0x2D, 0xE2, 0xF8, 0x19, 0x9C, 0x79, 0x53, 0xB4,
-    0x8E, 0x26, 0x82, 0x04, 0x2E, 0x8B, 0xC5, 0x9C, 0x62, 0x82, 0x47, 0x10, 0x4E, 0x83, 0x72, 0xD5,
-    0xBF, 0x0F, 0x01, 0x55, 0x9F, 0xC3, 0x77, 0x09, 0x60, 0x2D, 0x9A, 0x74, 0x40, 0x9F, 0xFF, 0x00,
-    0x7C, 0x3C, 0xC2, 0x93, 0xA3, 0x0F, 0x25, 0x18, 0xB1, 0xE1, 0x31, 0x88, 0xEA, 0x39, 0x84, 0xBD,
-    0x98, 0x43, 0x84, 0xC6, 0x4C, 0x76, 0x67, 0xC6, 0x6D, 0x81, 0xB6, 0x5D, 0xEA, 0x0E, 0xA5, 0x24,
-    0xF1, 0x62, 0x80, 0xDC, 0xD3, 0x01, 0x6E, 0x0C, 0xB0, 0xA8, 0x1E, 0xF0, 0xE2, 0xAA, 0x97, 0x27,
-    0xB0, 0xC3, 0x0E, 0x3B, 0x79, 0x86, 0xB5, 0x46, 0x9E, 0xB5, 0x9F, 0x0B, 0x48, 0x54, 0xBE, 0x2B,
-    0x86, 0x75, 0xD9, 0xC6, 0x88, 0xF8, 0xF6, 0x06, 0x37, 0x29, 0x7E, 0x02, 0x9D, 0x4E, 0xB5, 0x8C,
-    0x02, 0xCD, 0x85, 0x41, 0x89, 0x16, 0x21, 0xDB, 0x05, 0x48, 0xA7, 0x33, 0x3C, 0x34, 0x16, 0x3E,
-    0xD9, 0x60, 0xDC, 0x42, 0xCF, 0xF2, 0xA6, 0x8C, 0x09, 0x01, 0xF8, 0x49, 0x9B, 0x71, 0xF6, 0xD3,
-    0x3C, 0xA3, 0xC6, 0x33, 0xB7, 0xBA, 0x55, 0xEB, 0x1F, 0x9E, 0xA4, 0x30, 0x74, 0x41, 0x8C, 0xE4,
-    0xDC, 0xF9, 0x5C, 0xEE, 0xDD, 0x6F, 0x2C, 0x2E, 0xEC, 0x37, 0x3C, 0xE4, 0xDE, 0x66, 0x8C, 0x36,
-    0xC4, 0xB0, 0x87, 0xAE, 0x86, 0x4D, 0xF1, 0x8D, 0x10, 0xDF, 0xA8, 0x32, 0x94, 0x35, 0x3B, 0x40,
-    0x86, 0xFD, 0x52, 0x86, 0x49, 0x9B, 0x2D, 0x65, 0x98, 0xA7, 0xFC, 0xA6, 0x45, 0x0B, 0x0D, 0x4C,
-    0xB7, 0x5B, 0xB7, 0xB8, 0xCE, 0xBA, 0x6D, 0xF6, 0x0F, 0x96, 0x51, 0x82, 0x8B, 0xF1, 0xBE, 0xD1,
-    0xE6, 0x14, 0x6D, 0x78, 0xF3, 0x7E, 0x47, 0x54, 0xD1, 0x33, 0xB2, 0x82, 0x47, 0xAC, 0x50, 0x64,
-    0xAE, 0x27, 0x8D, 0x1D, 0x69, 0xDE, 0xE3, 0x9E, 0xF1, 0x59, 0x51, 0x75, 0x51, 0xCD, 0xED, 0x8A,
-    0x36, 0x8E, 0xC5, 0xA1, 0x58, 0xF7, 0x15, 0xB5, 0xB5, 0x33, 0xBF, 0x13, 0x31, 0xF9, 0x1D, 0xBA,
-    0x66, 0x7A, 0xD8, 0x27, 0x86, 0xE0, 0xAB, 0x5D, 0xF5, 0x33, 0x22, 0x88, 0x10, 0x90, 0xB5, 0x63,
-    0xA6, 0xDE, 0x3C, 0x7A, 0xCA, 0x57, 0x0C, 0x36, 0xBE, 0x0A, 0x32, 0x7F, 0xB2, 0xC6, 0x9C, 0x6F,
-    0xDC, 0x45, 0x2B, 0xD3, 0x47, 0x2E, 0x1B, 0x44, 0x6D, 0xF5, 0x4D, 0x54, 0x9D, 0x2A, 0xFB, 0x37,
-    0xD8, 0xA7, 0x00, 0x58, 0x4C, 0x58, 0x38, 0x2D, 0xF2, 0x80, 0x8D, 0xFC, 0x31, 0xBB, 0xF8, 0xB7,
-    0x2D, 0x16, 0xF0, 0x4D, 0x20, 0x48, 0xAF, 0xB3, 0xC2, 0x44, 0x50, 0x63, 0x8C, 0x73, 0x90, 0xBE,
-    0x2D, 0x68, 0x2E, 0x69, 0x6F, 0xCA, 0x3A, 0x4F, 0x7E, 0xDE, 0xC9, 0x69, 0xC9, 0x7F, 0xD4, 0xC8,
-    0xD8, 0x1F, 0xE4, 0xF0, 0x83, 0x13, 0x97, 0x3A, 0xBE, 0x1D, 0x04, 0xFF, 0x88, 0xEE, 0x6A, 0xFB,
-    0x11, 0xBE, 0xFF, 0x76, 0x00, 0xA7, 0xB7, 0xCD, 0x18, 0x79, 0x73, 0xAD, 0x40, 0x86, 0x8A, 0xB3,
-    0xAB, 0x8A, 0xDE, 0x3B, 0xA9, 0x88, 0xB2, 0x2C, 0xB6, 0xA1, 0x88, 0x0A, 0xDF, 0x2A, 0x38, 0x40,
-    0x89, 0x00, 0x72, 0xEB, 0x02, 0x7C, 0x81, 0x89, 0xBE, 0x85, 0xDF, 0x60, 0x80, 0x67, 0x69, 0x64,
-    0x48, 0x6B, 0x7A, 0x17, 0xBA, 0x15, 0x7A, 0x15, 0x91, 0x75, 0x05, 0x4A, 0xAC, 0x1C, 0xFB, 0x18,
-    0xC4, 0x23, 0x17, 0xE6, 0x25, 0x19, 0xF2, 0x57, 0x27, 0xF1, 0x34, 0x9D, 0x3D, 0x9B, 0xD9, 0xBA,
-    0x9A, 0x84, 0x6A, 0x81, 0xB2, 0x7B, 0x8A, 0x64, 0x2F, 0x1D, 0x2D, 0xA3, 0x6A, 0xB5, 0xA4, 0x2D,
-    0x78, 0x72, 0xCF, 0xFE, 0x19, 0x53, 0x45, 0xB8, 0xAF, 0xD5, 0x74, 0x80, 0x9D, 0xA9, 0x58, 0x82,
-    0x9D, 0x72, 0x13, 0xEC, 0x3C, 0x53, 0xAA, 0xFC, 0x36, 0xAC, 0x75, 0xF1, 0x08, 0xE2, 0xF9, 0x8A,
-    0x15, 0xF4, 0x8C, 0x95, 0x27, 0xCB, 0x23, 0xFF, 0xE6, 0x25, 0x67, 0xD7, 0x10, 0x8E, 0xAF, 0x67,
-    0xC8, 0x53, 0x3D, 0x71, 0x4A, 0xD8, 0x48, 0x11, 0x96, 0xB0, 0xAD, 0x82, 0xC4, 0xA9, 0x25, 0x66,
-    0x41, 0x4D, 0x4E, 0xD6, 0x13, 0x26, 0x61, 0x22, 0xD6, 0x8D, 0x14, 0xDC, 0x54, 0x9C, 0x42, 0xA2,
-    0xB5, 0xA2, 0x54, 0x9F, 0x3D, 0xD3, 0xF2, 0x89, 0xEB, 0x9C, 0xD7, 0xAF, 0xB2, 0xBC, 0x4F, 0x08,
-    0x9F, 0x7E, 0xCC, 0x5C, 0x39, 0xF9, 0x84, 0xB4, 0xC4, 0x0F, 0x94, 0x30, 0xAD, 0xB7, 0x44, 0xC3,
-    0xFA, 0x2E, 0x69, 0xE8, 0xBA, 0x49, 0xCB, 0xF5, 0x0A, 0xE2, 0xB8, 0x5E, 0x9A, 0x23, 0x22, 0x7F,
-    0x79, 0x8B, 0x55, 0xAF, 0x4C, 0x5B, 0xF9, 0x52, 0xB7, 0x67, 0x7F, 0xED, 0x43, 0x27, 0xF9, 0x93,
-    0x2E, 0x3D, 0x2D, 0xEE, 0x69, 0x5D, 0xC8, 0x8D, 0xAB, 0x6F, 0x2F, 0x0A, 0x77, 0x70, 0x41, 0x71,
-    0x5B, 0x01, 0xCC, 0xFD, 0x33, 0x33, 0xB8, 0x4F, 0x5E, 0xC3, 0x76, 0xCB, 0xBF, 0x43, 0x92, 0xE9,
-    0x1D, 0xD7, 0x22, 0x50, 0x70, 0xE7, 0x45, 0x46, 0x97, 0x29, 0xB2, 0xF0, 0x66, 0xB9, 0x52, 0xB4,
-    0x64, 0xBB, 0xFC, 0x32, 0x90, 0xAF, 0x20, 0x49, 0xEB, 0x7A, 0x2C, 0xD5, 0xD2, 0x4A, 0x58, 0x4A,
-    0xED, 0x71, 0x7A, 0x34, 0xBD, 0x35, 0x2C, 0x0B, 0x89, 0x71, 0xF3, 0xE6, 0xC9, 0xB7, 0x7C, 0xD2,
-    0xB5, 0x51, 0x8B, 0x54, 0xDA, 0xBB, 0xE6, 0xCA, 0x7C, 0xEC, 0xE9, 0x73, 0x6D, 0xE7, 0xF0, 0x16,
-    0x87, 0x7A, 0x9E, 0xB6, 0x04, 0x95, 0x2E, 0x73, 0x5A, 0x68, 0x35, 0xE2, 0xFC, 0xD3, 0x7A, 0x74,
-    0x4F, 0x95, 0x9A, 0x7F, 0x03, 0xE5, 0x5C, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xB4, 0x8B,
-    0x31, 0x31, 0x21, 0x54, 0x50, 0x89, 0x43, 0x46, 0x42, 0xE3, 0x26, 0x8A, 0x48, 0x34, 0x29, 0x98,
-    0xCC, 0x92, 0x80, 0xA4, 0xC2, 0x45, 0x1A, 0x66, 0x86, 0x74, 0xE3, 0x22, 0x2E, 0x5C, 0x24, 0x72,
-    0xB1, 0x0D, 0x0B, 0x15, 0x94, 0x00, 0x53, 0xA5, 0x0B, 0x6F, 0x63, 0xB5, 0xE1, 0x64, 0x5C, 0x50,
-    0xEB, 0xC2, 0x9A, 0x8C, 0x33, 0xC3, 0x4C, 0x48, 0x02, 0x8A, 0x8B, 0x14, 0x99, 0x89, 0x5F, 0x26,
-    0x7F, 0x45, 0x52, 0xC0, 0x89, 0x34, 0x8E, 0xD3, 0x08, 0x13, 0x3D, 0x39, 0x58, 0x11, 0x0F, 0x37,
-    0xE7, 0x7C, 0xE7, 0x5C, 0x3C, 0xBC, 0xB7, 0x6F, 0x29, 0x8D, 0x2C, 0x2F, 0xB9, 0xEB, 0x9D, 0x5D,
-    0x5C, 0xEC, 0x2E, 0xDE, 0xC5, 0xF9, 0xBB, 0xE7, 0xFF, 0x5E, 0x63, 0x4C, 0x60, 0x6D, 0x6B, 0x30,
-    0x34, 0x34, 0x78, 0x37, 0x6E, 0xE4, 0x66, 0xF9, 0x15, 0xCD, 0x30, 0x24, 0x0D, 0x86, 0x4C, 0x86,
-    0xA2, 0xC5, 0xF0, 0x08, 0x83, 0xFF, 0x33, 0x0C, 0xC1, 0xDF, 0xCD, 0x79, 0x88, 0xDF, 0xC2, 0x90,
-    0x04, 0x1D, 0x0F, 0x57, 0x82, 0x9E, 0x87, 0xFB, 0x3E, 0x86, 0x39, 0x06, 0xBF, 0xF1, 0x16, 0x34,
-    0x84, 0x35, 0x86, 0xB8, 0x34, 0x03, 0x3F, 0x6F, 0x30, 0x64, 0xD6, 0x5A, 0x1A, 0x2A, 0x0C, 0x1E,
-    0xCD, 0x54, 0xD1, 0xC4, 0xF4, 0xCE, 0x22, 0xA7, 0xE7, 0x31, 0xC4, 0x04, 0x5C, 0x56, 0x9A, 0x94,
-    0x1F, 0xAE, 0xCD, 0x55, 0x19, 0xF8, 0xA3, 0x45, 0x7D, 0xC1, 0xDE, 0x31, 0x17, 0xEC, 0x41, 0x66,
-    0xE7, 0x34, 0xCF, 0xC2, 0xF8, 0x40, 0x4B, 0x90, 0x5B, 0x41, 0x6A, 0xEB, 0x1A, 0xA3, 0x69, 0x87,
-    0x5B, 0x84, 0xDD, 0xC7, 0xBB, 0x1D, 0xCF, 0x17, 0xD2, 0xAB, 0xAC, 0xA1, 0x2B, 0x41, 0x18, 0xB5,
-    0x26, 0x98, 0x9B, 0xB8, 0xE5, 0x9B, 0xB8, 0xC1, 0xF7, 0xCC, 0xA4, 0x33, 0x93, 0xD4, 0xFC, 0xAA,
-    0x14, 0x57, 0xFE, 0x2E, 0x4D, 0x51, 0x32, 0x44, 0x55, 0xCE, 0x57, 0xCB, 0xD0, 0xF9, 0x16, 0x93,
-    0x55, 0x0C, 0xD4, 0xF3, 0x74, 0x4D, 0x9B, 0x7B, 0xD5, 0x57, 0x4D, 0x6C, 0x9B, 0x82, 0x26, 0xB7,
-    0x79, 0x46, 0x6F, 0xB9, 0x6E, 0xB6, 0x00, 0x84, 0x57, 0x9B, 0x77, 0x79, 0x68, 0x3C, 0x90, 0x74,
-    0xF1, 0x27, 0xB5, 0x01, 0xE2, 0x00, 0x33, 0x5D, 0x08, 0xA4, 0x53, 0x46, 0x9C, 0x64, 0x4E, 0x00,
-    0x57, 0xAF, 0xF1, 0x19, 0xE6, 0x03, 0x60, 0x2A, 0x88, 0xA6, 0xFD, 0x3A, 0x9A, 0x4F, 0x05, 0x6F,
-    0x4E, 0x30, 0xA9, 0x01, 0x7D, 0x89, 0xE1, 0x01, 0xAE, 0x81, 0x40, 0x1D, 0x0A, 0x0E, 0xD1, 0xEA,
-    0x70, 0xF0, 0x0D, 0x3C, 0x62, 0xE5, 0x99, 0x6A, 0xF6, 0xC4, 0xE9, 0x7F, 0x89, 0x45, 0xC1, 0x17,
-    0x9A, 0x62, 0x41, 0x24, 0xC0, 0x25, 0xC5, 0x35, 0x93, 0xFB, 0x0F, 0x78, 0x88, 0x2D, 0xFF, 0xDB,
-    0x97, 0xE5, 0x62, 0xFC, 0x77, 0x80, 0x23, 0xA8, 0x1F, 0x37, 0xCB, 0x4F, 0xBC, 0x81, 0x95, 0xD6,
-    0xAE, 0x09, 0x99, 0x57, 0x59, 0xFA, 0x6F, 0x02, 0xC5, 0x50, 0x95, 0x71, 0x6F, 0x82, 0x05, 0x7F,
-    0x13, 0x56, 0xFE, 0x82, 0xA1, 0xF7, 0x7A, 0x43, 0xF3, 0xD2, 0xCA, 0xB4, 0xA0, 0x0E, 0xB8, 0x18,
-    0xE2, 0x1A, 0x0B, 0x64, 0x98, 0x30, 0xC1, 0x35, 0xC5, 0xDB, 0x32, 0xC8, 0x4B, 0x56, 0x3F, 0xEE,
-    0x9A, 0xCE, 0x96, 0x22, 0xC5, 0xF3, 0xFC, 0x8E, 0x09, 0x89, 0x5D, 0xB7, 0x08, 0x87, 0x3D, 0x06,
-    0xBC, 0x80, 0xF6, 0x8D, 0x2C, 0x30, 0x7A, 0x4E, 0x80, 0xDD, 0xFE, 0xBE, 0x7B, 0x1B, 0xA6, 0x78,
-    0xC8, 0xB0, 0x33, 0x8E, 0x01, 0x4F, 0xE5, 0xAD, 0xAC, 0x19, 0xDF, 0x92, 0x38, 0xC4, 0x1F, 0x58,
-    0xA6, 0x3A, 0x64, 0x23, 0xA9, 0x09, 0xF0, 0xB8, 0x26, 0xB6, 0x7D, 0x49, 0xA6, 0xC0, 0x9B, 0xD3,
-    0xDA, 0x4D, 0x86, 0x4B, 0x51, 0xAE, 0x5C, 0x40, 0x60, 0xFC, 0x83, 0x80, 0xBD, 0x69, 0xE2, 0xCE,
-    0x6F, 0x59, 0x7F, 0xD2, 0xDB, 0x2A, 0x16, 0x36, 0xEF, 0x9A, 0xBC, 0x6F, 0x1F, 0x24, 0x07, 0x71,
-    0x22, 0xA6, 0xA4, 0x49, 0x7F, 0xC2, 0x9F, 0x79, 0x93, 0x65, 0x96, 0xC4, 0xB7, 0x05, 0xB1, 0x9F,
-    0x3D, 0x69, 0xD4, 0xF6, 0xDE, 0xC1, 0x52, 0x80, 0x6C, 0xF1, 0x34, 0x7F, 0x4E, 0x50, 0x2F, 0xC2,
-    0x19, 0xAD, 0x44, 0x12, 0x20, 0x22, 0xF6, 0xB3, 0x4F, 0x88, 0xDA, 0xE7, 0x70, 0xB5, 0x87, 0xAE,
-    0x0F, 0xCC, 0xA6, 0xAF, 0x13, 0x23, 0xDB, 0x8C, 0x1D, 0x34, 0x63, 0x30, 0x5E, 0xFC, 0xEE, 0x30,
-    0x3E, 0xC7, 0x4C, 0x6D, 0xBF, 0x34, 0x77, 0xA0, 0xAD, 0x23, 0xE0, 0xD5, 0x65, 0x00, 0xF6, 0xA1,
-    0xE8, 0xD5, 0x6C, 0x3E, 0x35, 0x07, 0x5B, 0xF9, 0x3A, 0xD5, 0x95, 0xEC, 0x42, 0x77, 0x25, 0xBC,
-    0x52, 0x5E, 0x49, 0x2F, 0xB4, 0x37, 0x42, 0x7C, 0xA5, 0xBE, 0x92, 0x5F, 0xE9, 0xAF, 0x0C, 0x50,
-    0x0E, 0x28, 0x0B, 0x94, 0x07, 0x4A, 0xEC, 0xC7, 0x0E, 0xE9, 0x8A, 0xE5, 0x12, 0x5E, 0x28, 0x33,
-    0x1C, 0x37, 0x94, 0x1D, 0x8E, 0x1F, 0x8E, 0x21, 0x67, 0x18, 0x79, 0xB2, 0x1D, 0x69, 0xCE, 0xD6,
-    0x87, 0x31, 0xF6, 0x1F, 0x01, 0x24, 0x8B, 0x29, 0x81, 0xA0, 0x79, 0x6E, 0xCD, 0x52, 0x83, 0x35,
-    0xC2, 0x1B, 0x61, 0x0E, 0xB8, 0x63, 0xC0, 0x1E, 0x03, 0xFE, 0x38, 0x89, 0x12, 0xAD, 0x7C, 0x48,
-    0x72, 0xC0, 0x9B, 0x95, 0xAB, 0x68, 0xF9, 0x51, 0xAE, 0x6E, 0x1A, 0xE1, 0x95, 0x32, 0x4B, 0xB8,
-    0x35, 0x2E, 0x8E, 0xED, 0xDC, 0xDB, 0x83, 0x42, 0x04, 0xBF, 0xBC, 0x79, 0x81, 0xBF, 0x0E, 0x42,
-    0xD1, 0xAA, 0x9D, 0x12, 0x6F, 0x02, 0x7A, 0x6C, 0xED, 0xCF, 0x85, 0x5D, 0x96, 0x31, 0xAC, 0xEA,
-    0xDF, 0x1A, 0xE4, 0xF5, 0x95, 0x98, 0x5B, 0xA6, 0x7A, 0x25, 0x90, 0x13, 0xA7, 0xA2, 0x39, 0xCC,
-    0x34, 0x91, 0x8E, 0x6D, 0x37, 0xA1, 0xE6, 0xEB, 0xD0, 0x63, 0x08, 0x74, 0xE8, 0x30, 0xB0, 0xB1,
-    0x0C, 0x61, 0x27, 0xF9, 0x03, 0x3C, 0x43, 0x04, 0x7B, 0xC9, 0x3F, 0x6C, 0x99, 0x88, 0xAF, 0xC9,
-    0x0C, 0x30, 0x31, 0x2D, 0x0A, 0x58, 0x4B, 0x96, 0x0A, 0xC2, 0xDA, 0x1F, 0xF0, 0xF2, 0x88, 0x26,
-    0x22, 0xB3, 0xC9, 0x52, 0x66, 0xCD, 0x36, 0xFD, 0x6B, 0x97, 0xC0, 0xEC, 0xE0, 0x1E, 0x0C, 0xCA,
-    0xA9, 0xFD, 0x97, 0xBF, 0x0F, 0xF0, 0xE1, 0x75, 0x78, 0xF6, 0x55, 0xD0, 0xB6, 0x12, 0x91, 0xAD,
-    0x62, 0xC1, 0xFD, 0x79, 0xA1, 0x84, 0x68, 0x0F, 0xC8, 0xEF, 0xD6, 0x1F, 0xF7, 0x78, 0xDC, 0xF2,
-    0x20, 0xC6, 0x5D, 0xAD, 0xBB, 0x98, 0x77, 0xB5, 0xEF, 0x6A, 0xE0, 0xD5, 0xC2, 0xAB, 0x89, 0x57,
-    0x1B, 0xAF, 0x46, 0x5E, 0xAD, 0xBC, 0x9A, 0x79, 0xB5, 0xF3, 0x6A, 0xE8, 0xD5, 0xD2, 0xAB, 0xA9,
-    0x57, 0x5B, 0xAF, 0xC6, 0x5E, 0xAD, 0xBD, 0x33, 0xF7, 0xCE, 0xDF, 0xFA, 0x15, 0xB0, 0x83, 0x7C,
-    0x7F, 0x4B, 0x4A, 0x82, 0x64, 0xC6, 0x96, 0xBF, 0x7A, 0x76, 0xE4, 0x80, 0xBE, 0x04, 0x75, 0xF1,
-    0xB7, 0xCA, 0xB8, 0x6B, 0x0C, 0x72, 0x27, 0xF8, 0x88, 0xF2, 0x81, 0xF5, 0x80, 0x39, 0xFF, 0x17,
-    0x3D, 0xAF, 0x1E, 0xFE, 0x73, 0xD2, 0x24, 0x73, 0x7E, 0x55, 0xD8, 0x32, 0x46, 0xEC, 0x61, 0x75,
-    0xEB, 0x1E, 0x56, 0xB2, 0xE6, 0x61, 0x89, 0x7B, 0xB5, 0xEE, 0x61, 0xB1, 0xF1, 0x2A, 0xCA, 0xE8,
-    0xB0, 0x87, 0x55, 0xAD, 0x7B, 0xB8, 0xFE, 0x18, 0xF1, 0xB5, 0xEB, 0x11, 0x1F, 0x01, 0x4C, 0x34,
-    0x03, 0x33, 0x18, 0x23, 0x62, 0x41, 0x91, 0x83, 0x19, 0x89, 0x11, 0x57, 0x54, 0x10, 0x4B, 0xC4,
-    0x0E, 0xBD, 0x60, 0xC4, 0x85, 0x35, 0x60, 0x06, 0xCF, 0xAC, 0x43, 0x3F, 0xD5, 0x70, 0xF4, 0x1E,
-    0x7E, 0x28, 0xB4, 0x70, 0x50, 0xA3, 0x76, 0xAA, 0xE8, 0xDC, 0x20, 0x0A, 0x2B, 0x91, 0xB5, 0x9A,
-    0x2E, 0x75, 0xDA, 0x1D, 0x88, 0x19, 0x07, 0x49, 0x04, 0x03, 0x3B, 0x3E, 0x95, 0x78, 0xC5, 0xF4,
-    0x72, 0x22, 0xC9, 0xAE, 0x80, 0xC9, 0xAE, 0x33, 0x53, 0x1E, 0x08, 0x85, 0xAC, 0xDE, 0x26, 0x38,
-    0x89, 0x09, 0x59, 0x40, 0x4D, 0x31, 0x0A, 0x34, 0x0F, 0x9B, 0x42, 0x82, 0x0D, 0xD2, 0x5F, 0xE4,
-    0x04, 0x82, 0xA5, 0x37, 0x13, 0xE8, 0x69, 0x4D, 0xAC, 0xC8, 0xFE, 0x95, 0x7C, 0xCB, 0xCC, 0x1E,
-    0xD0, 0xB3, 0xDF, 0x7B, 0xBC, 0x09, 0xD9, 0xDE, 0x60, 0x42, 0x7C, 0x17, 0xD7, 0x21, 0xD8, 0xD1,
-    0x68, 0x67, 0x8C, 0xEB, 0xFA, 0x43, 0x71, 0xDD, 0xC9, 0xA6, 0x77, 0x69, 0xC8, 0x41, 0xAA, 0x83,
-    0xDA, 0xF8, 0x07, 0xBB, 0x04, 0x3D, 0xE2, 0x98, 0xAC, 0xDB, 0xE0, 0x9D, 0x1E, 0x17, 0xF9, 0x8D,
-    0xD9, 0x13, 0xA3, 0x2A, 0xD6, 0x34, 0xEA, 0xA6, 0x83, 0xC6, 0x42, 0x1B, 0xBE, 0x4E, 0x34, 0x17,
-    0x0C, 0x6C, 0x60, 0xD8, 0x3A, 0x27, 0x02, 0x17, 0x0D, 0xF8, 0x36, 0x38, 0x53, 0xC7, 0xC4, 0x8A,
-    0x93, 0x4D, 0x52, 0x13, 0xCA, 0x04, 0x6F, 0x0A, 0x4C, 0x2B, 0xF2, 0xE3, 0x42, 0x6A, 0xFD, 0x6D,
-    0x71, 0x5D, 0x54, 0xAA, 0x48, 0x5C, 0xD1, 0x1C, 0x27, 0xA5, 0xD9, 0x34, 0x1B, 0xF6, 0xD8, 0x04,
-    0xD0, 0x87, 0xE3, 0xA5, 0x7A, 0x1B, 0x89, 0x05, 0xA6, 0xD2, 0x62, 0xE2, 0xDE, 0xB1, 0x7F, 0x07,
-    0xA0, 0x1B, 0x10, 0x54, 0x3D, 0x3C, 0x4F, 0x5C, 0x3C, 0xF5, 0xF1, 0xD6, 0x3C, 0xA5, 0x13, 0xCC,
-    0x44, 0x75, 0x69, 0xEB, 0x04, 0x2E, 0xED, 0x83, 0x89, 0x4B, 0x2B, 0x1E, 0xD3, 0x11, 0x2E, 0xED,
-    0xC2, 0x28, 0xDF, 0x84, 0x71, 0xE0, 0x9C, 0x01, 0xEB, 0x0C, 0x78, 0x67, 0xC0, 0x3C, 0xE1, 0x9E,
-    0xB0, 0x4F, 0xF8, 0x27, 0x0C, 0x14, 0x0E, 0x7E, 0xAA, 0x4B, 0xBB, 0x7D, 0x94, 0x4B, 0x2B, 0xE1,
-    0xB5, 0xC6, 0xD7, 0x1A, 0x60, 0x6B, 0x84, 0x2D, 0x21, 0xB6, 0x8B, 0xB1, 0xA7, 0x41, 0x36, 0x4C,
-    0x4C, 0x23, 0x4E, 0xD4, 0x80, 0x54, 0x4E, 0x40, 0x1F, 0xE4, 0xF8, 0x83, 0xE0, 0x62, 0xA2, 0xAA,
-    0x6B, 0x43, 0xF1, 0x0C, 0x53, 0xE6, 0x0F, 0xD6, 0x43, 0x90, 0x6E, 0x53, 0x08, 0xD2, 0x4C, 0x23,
-    0x0A, 0x72, 0x91, 0xD8, 0xA6, 0x32, 0x25, 0xC8, 0xB5, 0xE2, 0xB9, 0x76, 0x41, 0x17, 0x7E, 0x1A,
-    0x43, 0x83, 0x21, 0x41, 0x3A, 0x88, 0x59, 0xC6, 0x1F, 0xCF, 0xE4, 0xE5, 0x4C, 0xB8, 0x1E, 0x83,
-    0xCF, 0xEC, 0xC9, 0x11, 0x82, 0x58, 0x09, 0x41, 0xDE, 0x1F, 0x09, 0xCF, 0x0C, 0x13, 0xE5, 0x9D,
-    0x09, 0x00, 0xB2, 0xA2, 0xFC, 0xAE, 0x97, 0x94, 0x1C, 0x92, 0x39, 0x97, 0x20, 0x6B, 0x84, 0xB8,
-    0x33, 0x30, 0x90, 0xFB, 0xE7, 0xE0, 0x77, 0x45, 0xF6, 0x11, 0x0F, 0xD9, 0xDB, 0xC3, 0x59, 0xF8,
-    0x5A, 0x95, 0xC4, 0x94, 0x85, 0xAC, 0xD5, 0x42, 0x84, 0xAD, 0x10, 0xF1, 0xAA, 0x64, 0xF1, 0xC8,
-    0x1A, 0x82, 0x47, 0x16, 0x37, 0x01, 0xF4, 0xE6, 0x1C, 0xC2, 0xE7, 0xAB, 0x1A, 0x10, 0xF8, 0x54,
-    0x19, 0x24, 0xF2, 0xCA, 0x4C, 0x87, 0x9F, 0x03, 0xEA, 0x54, 0x9E, 0x8C, 0x34, 0xF6, 0xFB, 0x01,
-    0xBB, 0x74, 0xA4, 0x7C, 0x19, 0xE1, 0xA4, 0x84, 0xE8, 0x67, 0xE2, 0xF3, 0x15, 0xE3, 0xC0, 0x09,
-    0xAE, 0x4C, 0x14, 0x08, 0x11, 0x6B, 0xB7, 0xC6, 0xA7, 0x21, 0x04, 0xBB, 0x56, 0x28, 0x60, 0x1A,
-    0x96, 0x12, 0x43, 0x7C, 0x06, 0x29, 0x1E, 0x7E, 0x5D, 0x42, 0x71, 0x2B, 0x39, 0xB1, 0x61, 0x43,
-    0x76, 0xF8, 0x14, 0xB0, 0x3F, 0x22, 0x57, 0x02, 0x2A, 0x0A, 0x09, 0xCC, 0xF0, 0x83, 0xC2, 0x8C,
-    0xCB, 0x91, 0x50, 0xD2, 0xA8, 0xDB, 0x9C, 0x6E, 0xBE, 0x6B, 0xBA, 0x47, 0x73, 0x3C, 0xDE, 0xCA,
-    0x60, 0x16, 0xE6, 0xC8, 0xAF, 0xD3, 0xB0, 0xFA, 0xBD, 0x7C, 0x45, 0xF9, 0xAF, 0x24, 0x42, 0xE2,
-    0xD9, 0x46, 0xB4, 0x4F, 0xAB, 0x14, 0x9C, 0x1E, 0xA6, 0xCA, 0xD7, 0x6B, 0x2B, 0x02, 0x2C, 0xA0,
-    0xF9, 0xEA, 0x3F, 0x89, 0x75, 0x0F, 0xF3, 0x35, 0xD6, 0x7E, 0x59, 0x86, 0xD7, 0x65, 0x58, 0xF1,
-    0xBC, 0xB4, 0x3C, 0x23, 0x15, 0x82, 0xD3, 0xAF, 0x12, 0xFC, 0xBB, 0x7A, 0x13, 0x3A, 0x05, 0x90,
-    0xA8, 0x42, 0x30, 0x45, 0xAA, 0x64, 0xEB, 0x94, 0x18, 0xC1, 0x2C, 0x10, 0x00, 0xBD, 0x35, 0xFB,
-    0x40, 0x9E, 0x5C, 0x19, 0xAB, 0x2F, 0x97, 0x27, 0x00, 0x94, 0xEB, 0x3D, 0xFC, 0x23, 0x49, 0x9C,
-    0x52, 0x3C, 0x3A, 0xFC, 0x80, 0x26, 0x95, 0xD3, 0x43, 0x78, 0xD9, 0xA0, 0x3F, 0xEC, 0xD9, 0xC1,
-    0xBB, 0x63, 0xE7, 0x47, 0x4A, 0x5B, 0xFD, 0x24, 0x89, 0x2B, 0x37, 0x56, 0x72, 0x24, 0xEC, 0xE3,
-    0x49, 0x4E, 0x27, 0x6A, 0xD5, 0xD3, 0xD3, 0xDC, 0xCB, 0xF4, 0xA6, 0x51, 0xB9, 0x64, 0x6F, 0x0F,
-    0x1E, 0x1F, 0xFB, 0x7B, 0x63, 0x32, 0x57, 0x12, 0xBA, 0xA5, 0x3A, 0x51, 0x9A, 0x6E, 0x82, 0xDF,
-    0x87, 0x1F, 0x64, 0x54, 0x19, 0x99, 0x5D, 0xFB, 0xDF, 0xF8, 0xA1, 0x45, 0xD3, 0xE3, 0x87, 0xBF,
-    0x5E, 0x2C, 0x5D, 0x5D, 0x8B, 0x1E, 0xE2, 0x77, 0x84, 0x1F, 0x21, 0x5D, 0x5C, 0xF6, 0x28, 0x0E,
-    0x5D, 0x81, 0x27, 0xF1, 0x8C, 0xF1, 0xF6, 0xEF, 0x2C, 0xCB, 0x60, 0x69, 0xBB, 0x54, 0x42, 0xA2,
-    0x75, 0x92, 0x7A, 0x92, 0xBB, 0x14, 0x57, 0x2E, 0x67, 0xAF, 0x31, 0x7B, 0x85, 0xDD, 0xB7, 0x22,
-    0x46, 0xAE, 0xFD, 0x0A, 0xF2, 0x52, 0xEF, 0x72, 0x1A, 0x70, 0xA8, 0xE9, 0x4A, 0x40, 0x91, 0x10,
-    0x91, 0x17, 0x17, 0x22, 0x01, 0xCC, 0x69, 0x9D, 0x9E, 0x11, 0xE6, 0xEC, 0x5A, 0xC3, 0x7F, 0xA4,
-    0xB9, 0xE9, 0x8F, 0x34, 0x37, 0xFD, 0x9A, 0xE2, 0x4A, 0x73, 0xD3, 0x1F, 0xE9, 0xCA, 0xB9, 0x9E,
-    0x1C, 0xB9, 0x1E, 0x64, 0xA2, 0xB2, 0xF7, 0x72, 0xBE, 0xB1, 0x39, 0x09, 0x4A, 0xDC, 0x3B, 0x4D,
-    0xF9, 0xF9, 0x18, 0xFA, 0x9A, 0xDD, 0xDF, 0xDF, 0xB7, 0x77, 0xA5, 0xDA, 0x88, 0xDC, 0xD4, 0x6F,
-    0x0E, 0x37, 0x6E, 0x7C, 0x6D, 0xB8, 0x7E, 0x02, 0x18, 0xBA, 0xCA, 0xA6, 0x66, 0x8D, 0x4D, 0x31,
-    0xD6, 0x4D, 0x2C, 0x51, 0x85, 0x63, 0x13, 0xD6, 0x48, 0xCE, 0xDA, 0xA7, 0x08, 0x11, 0x34, 0x25,
-    0xFC, 0xE9, 0x61, 0x87, 0x99, 0xB5, 0xE0, 0x55, 0xEE, 0xD9, 0x7A, 0xC9, 0xA6, 0x61, 0xC2, 0xA6,
-    0xEE, 0x0B, 0x62, 0x93, 0xF9, 0x26, 0x60, 0x2E, 0x5F, 0x22, 0xD0, 0xE6, 0xF7, 0xCC, 0x0B, 0x11,
-    0x01, 0xF0, 0x92, 0x07, 0xAF, 0xFE, 0x99, 0xC9, 0xD2, 0x34, 0x4B, 0x0E, 0x2E, 0x39, 0xB7, 0x5C,
-    0x82, 0xE3, 0xD2, 0x93, 0x90, 0x6A, 0x52, 0x38, 0xE9, 0x5C, 0xB2, 0x63, 0xE4, 0xC6, 0x92, 0x0B,
-    0x4B, 0xEA, 0x2F, 0xA9, 0x2E, 0xB3, 0x3B, 0x4A, 0x2F, 0x29, 0x0C, 0x40, 0x43, 0x9B, 0x5F, 0x4E,
-    0xEC, 0x4F, 0xDB, 0x9D, 0xD8, 0xCE, 0x7E, 0x1F, 0xC5, 0xD5, 0x65, 0x84, 0xC1, 0xF4, 0xDB, 0xB6,
-    0xCA, 0x40, 0xF0, 0x2F, 0x87, 0x06, 0x03, 0x90, 0x56, 0x41, 0x5C, 0x88, 0x62, 0x83, 0x04, 0x75,
-    0xFA, 0x33, 0x97, 0x1F, 0x06, 0x32, 0xE8, 0xBE, 0x42, 0xB4, 0x60, 0xAA, 0x97, 0xE2, 0xE9, 0x84,
-    0x1C, 0x01, 0x45, 0x7C, 0x59, 0x26, 0xEC, 0x9E, 0x0E, 0x72, 0x54, 0x76, 0x41, 0xCB, 0xE3, 0xC6,
-    0x8D, 0xEB, 0xAA, 0x68, 0x17, 0x66, 0xB7, 0xD7, 0x3C, 0x3F, 0x61, 0x13, 0x4A, 0x7E, 0xB6, 0x75,
-    0xF9, 0x59, 0xC9, 0xCC, 0x96, 0xF8, 0xCE, 0xF9, 0x9B, 0xE0, 0xCD, 0x6E, 0xE7, 0x24, 0x0C, 0x49,
-    0x07, 0x31, 0x08, 0x4A, 0xEF, 0x70, 0xA6, 0xAC, 0x58, 0xC9, 0x94, 0x3D, 0x1D, 0x78, 0xDF, 0x34,
-    0xCF, 0xEF, 0x98, 0x5B, 0xD9, 0xD7, 0xE6, 0x89, 0x6D, 0x48, 0x1C, 0x46, 0x01, 0xF8, 0x65, 0x09,
-    0xF0, 0x94, 0x08, 0xF9, 0x85, 0x5C, 0xFD, 0x0F, 0xB8, 0x12, 0xA2, 0x38, 0xEA, 0xF1, 0xEE, 0xE3,
-    0x6B, 0x22, 0xE7, 0x22, 0xA0, 0x9C, 0x4B, 0xA4, 0xB7, 0x46, 0x1D, 0x7F, 0xAF, 0xE6, 0x0E, 0xE9,
-    0x21, 0x5E, 0x0B, 0x92, 0x8B, 0x67, 0x6C, 0x81, 0x86, 0x05, 0x0A, 0x0B, 0x5E, 0x02, 0xBE, 0x10,
-    0x0A, 0xB4, 0x62, 0x72, 0xCD, 0x59, 0xF6, 0x49, 0xF4, 0x69, 0x62, 0xAF, 0xE3, 0x57, 0x66, 0xA8,
-    0xE0, 0x2E, 0xF0, 0x6D, 0xBF, 0x67, 0x8A, 0x41, 0x92, 0x94, 0x92, 0xCA, 0x9B, 0xBB, 0x9C, 0x65,
-    0x34, 0x5F, 0x26, 0x9A, 0xD6, 0xAD, 0xF9, 0x53, 0x40, 0xCD, 0x2F, 0x44, 0x2C, 0xBE, 0xCD, 0xEE,
-    0x12, 0xE1, 0xF2, 0x8A, 0x14, 0xAD, 0x67, 0xA2, 0x3C, 0xE9, 0x9D, 0x00, 0x4F, 0xD2, 0x2D, 0x52,
-    0x00, 0x6A, 0x04, 0x35, 0x80, 0x38, 0x88, 0x1B, 0xEB, 0x2D, 0x04, 0x5A, 0xAD, 0xB1, 0x8A, 0x93,
-    0x55, 0x0A, 0xA6, 0x4C, 0x0F, 0x46, 0xB6, 0x52, 0x7C, 0xAD, 0xA2, 0x6C, 0x15, 0xE1, 0x41, 0x46,
-    0xE9, 0xC8, 0x69, 0x84, 0x42, 0x34, 0x37, 0x88, 0x44, 0x73, 0x82, 0x4E, 0x59, 0x2D, 0xA4, 0x92,
-    0xDC, 0xCF, 0x12, 0xAC, 0x4A, 0xC1, 0x22, 0x82, 0x30, 0x58, 0x4C, 0x13, 0x06, 0x8B, 0xC9, 0xA2,
-    0xE9, 0x2A, 0x57, 0x91, 0x55, 0x5B, 0xA4, 0xEC, 0x19, 0x8B, 0x43, 0x2E, 0x53, 0xE6, 0x92, 0x63,
-    0xC2, 0x6A, 0xF6, 0x21, 0x35, 0xE9, 0x75, 0x80, 0xE1, 0x4B, 0xD0, 0x93, 0x52, 0xE1, 0xA9, 0xCA,
-    0xE5, 0x35, 0x3B, 0xAA, 0x01, 0x40, 0x99, 0x42, 0xD6, 0x9A, 0xF8, 0xB2, 0x3B, 0x67, 0x6C, 0x22,
-    0x16, 0x3E, 0x66, 0x0D, 0x31, 0x88, 0x80, 0x0F, 0xC1, 0x9D, 0x08, 0xA6, 0x2D, 0x9E, 0x9A, 0x36,
-    0x14, 0xC1, 0x12, 0xF0, 0x6B, 0x34, 0x6A, 0x05, 0xE0, 0xAF, 0xA0, 0xED, 0x07, 0x77, 0x25, 0x70,
-    0x98, 0xDC, 0xB7, 0x5F, 0x66, 0x62, 0xDB, 0x57, 0xD8, 0xBD, 0xED, 0x98, 0x5A, 0x5E, 0x0E, 0xBF,
-    0x59, 0x05, 0x36, 0x9A, 0x38, 0x52, 0xC9, 0xC4, 0x79, 0x02, 0xFE, 0x15, 0xB0, 0xAE, 0x9C, 0x8B,
-    0xFB, 0x8E, 0x71, 0xCD, 0x17, 0x24, 0x11, 0x39, 0xDA, 0x2F, 0xF8, 0x13, 0x0F, 0xD8, 0xDB, 0xF6,
-    0xB9, 0x01, 0x63, 0xDA, 0x81, 0x21, 0x56, 0x43, 0xAF, 0x26, 0x9D, 0x2F, 0x53, 0x85, 0x2B, 0xF5,
-    0xE5, 0x69, 0x65, 0x79, 0x52, 0x95, 0xB3, 0x4B, 0xE2, 0x4B, 0x96, 0x52, 0x18, 0x10, 0x4C, 0xAF,
-    0xDD, 0xB2, 0x84, 0xA0, 0x58, 0x4C, 0x9D, 0xC2, 0xE6, 0xB1, 0x2F, 0x7C, 0xDC, 0xAB, 0xB4, 0xDF,
-    0x62, 0x3E, 0xC6, 0x62, 0x05, 0x90, 0xAD, 0xBA, 0x49, 0xEA, 0xCF, 0x97, 0xF8, 0x85, 0xBB, 0x38,
-    0x38, 0xE9, 0xC7, 0x29, 0x3F, 0x49, 0xF8, 0xAD, 0xA6, 0xFB, 0x98, 0xC9, 0x86, 0x79, 0x3C, 0x5D,
-    0xD5, 0xC1, 0xA8, 0x2E, 0x70, 0x89, 0xC6, 0x55, 0x0D, 0xF5, 0x06, 0x26, 0xA4, 0xE3, 0xAA, 0x96,
-    0x0B, 0xBF, 0xBF, 0x18, 0x41, 0x1E, 0x5C, 0x94, 0x06, 0x78, 0xBD, 0x7E, 0x54, 0x1C, 0xDD, 0xEA,
-    0x9C, 0xA3, 0x0F, 0x37, 0x8C, 0x0D, 0x11, 0xAC, 0x92, 0x58, 0x78, 0x59, 0x2B, 0x21, 0x51, 0x45,
-    0x2B, 0x19, 0x3A, 0xAC, 0x28, 0xE5, 0xF5, 0x5C, 0xC9, 0x55, 0x0D, 0x75, 0x5F, 0xA8, 0x23, 0x3A,
-    0x75, 0x90, 0xE9, 0xE8, 0x8D, 0x99, 0xB2, 0xA3, 0x93, 0x51, 0x4A, 0x18, 0x41, 0x2F, 0xC2, 0x13,
-    0x74, 0x05, 0xC6, 0xF0, 0x17, 0xB2, 0x42, 0xA2, 0x47, 0x1F, 0x0A, 0x53, 0x06, 0x65, 0xCE, 0x3C,
-    0xD2, 0xFE, 0x2F, 0xA1, 0x72, 0x32, 0x0B, 0x16, 0xC2, 0x22, 0x09, 0x8C, 0x89, 0x49, 0x22, 0x59,
-    0xA5, 0x24, 0x7E, 0x09, 0x2C, 0xF0, 0x4D, 0x8B, 0xBB, 0xFC, 0x4F, 0xCE, 0xE4, 0xF2, 0x4A, 0x8E,
-    0xE8, 0x9E, 0x57, 0xB2, 0x57, 0x95, 0x1B, 0x56, 0x97, 0x26, 0x29, 0x5D, 0xF8, 0x69, 0x12, 0x5D,
-    0xD7, 0x57, 0xF5, 0xFF, 0xB7, 0x74, 0x7C, 0xD7, 0x4C, 0xD3, 0x74, 0x9F, 0x23, 0xC6, 0x90, 0x6B,
-    0x46, 0xE8, 0x16, 0xA4, 0x16, 0x78, 0x15, 0x4A, 0xED, 0x3B, 0x46, 0x4E, 0xFA, 0x2A, 0xF8, 0xD3,
-    0x81, 0x50, 0xBC, 0x4A, 0x3A, 0x64, 0xB9, 0xE7, 0xCC, 0xC6, 0xE0, 0x7F, 0x19, 0x53, 0x5A, 0x1F,
-    0x1C, 0x4E, 0x2E, 0x12, 0x44, 0xF4, 0xA8, 0xE5, 0xCF, 0x98, 0x7B, 0xF1, 0x8C, 0xB9, 0x89, 0x1E,
-    0x1A, 0x26, 0xCE, 0x80, 0x17, 0x5A, 0xD1, 0xCE, 0xEF, 0x33, 0x0F, 0xA2, 0xB5, 0x3E, 0x9C, 0x33,
-    0xD3, 0x1E, 0xBC, 0x09, 0x8A, 0x3F, 0xD2, 0x4C, 0xE5, 0x5A, 0x2E, 0x32, 0x65, 0xFE, 0xCF, 0x2E,
-    0x58, 0xC0, 0x6C, 0x9F, 0x00, 0xCC, 0xDE, 0x3B, 0xCB, 0xB5, 0x26, 0xB2, 0x21, 0xB0, 0x4B, 0x2D,
-    0x67, 0xBE, 0x06, 0x2F, 0x4C, 0xA9, 0xDA, 0x52, 0x31, 0xA6, 0x9F, 0x49, 0x69, 0x1C, 0x56, 0x1D,
-    0x47, 0x29, 0x8D, 0x76, 0x93, 0xD2, 0x90, 0x0C, 0x4B, 0x8B, 0x04, 0x4A, 0xC3, 0xAF, 0xA2, 0xB0,
-    0x9D, 0x24, 0x31, 0xAA, 0xF9, 0x55, 0x69, 0x2D, 0x95, 0x0C, 0x57, 0xC8, 0xE0, 0x3E, 0x40, 0x24,
-    0x5D, 0x6A, 0x20, 0xC1, 0xD5, 0x28, 0x8E, 0xF2, 0x49, 0x25, 0x6E, 0xEF, 0x97, 0xD2, 0x0A, 0x59,
-    0x6D, 0x70, 0xCA, 0x87, 0x23, 0x9C, 0xF2, 0xB9, 0x2C, 0xE5, 0x50, 0x43, 0x38, 0xA1, 0xB2, 0x88,
-    0xA0, 0x8B, 0xD4, 0xDC, 0x54, 0x99, 0xC6, 0x8F, 0x64, 0xB3, 0x39, 0xB2, 0x21, 0x3D, 0xAF, 0x51,
-    0xCD, 0x09, 0xA0, 0xDA, 0xF4, 0xEB, 0x45, 0x33, 0x56, 0xC6, 0x4C, 0xBF, 0x6C, 0x0A, 0xF5, 0x31,
-    0x73, 0x50, 0x9A, 0xD1, 0x0F, 0x3F, 0xBF, 0x2F, 0x65, 0x33, 0xFF, 0x53, 0x22, 0x9A, 0x4D, 0xC4,
-    0x4B, 0xD6, 0x88, 0x57, 0x4C, 0xE2, 0x6E, 0x9D, 0xCA, 0xB8, 0xEC, 0xC9, 0x40, 0x86, 0x9D, 0x23,
-    0x55, 0x2E, 0x17, 0x6A, 0x02, 0xCB, 0xBF, 0x23, 0x8D, 0xB9, 0xAC, 0x57, 0x38, 0xBD, 0x74, 0x91,
-    0x7E, 0x2E, 0x1B, 0x35, 0x7B, 0x4C, 0xEF, 0x9E, 0xE9, 0xFD, 0x72, 0x87, 0x54, 0x20, 0xE7, 0xFF,
-    0xCA, 0x00, 0xFD, 0x31, 0x11, 0x3B, 0x81, 0xE6, 0xEC, 0x13, 0xA6, 0x37, 0x49, 0xE2, 0x9F, 0x91,
-    0x24, 0x52, 0xA8, 0xFE, 0xDE, 0xDC, 0x64, 0x6F, 0x51, 0x98, 0xFC, 0x6A, 0x6D, 0x8A, 0x88, 0x40,
-    0xDB, 0x7A, 0xAA, 0x25, 0x91, 0xE6, 0x58, 0x46, 0xFC, 0x2D, 0x53, 0x46, 0x7A, 0x6F, 0xA2, 0xD9,
-    0x17, 0x48, 0x99, 0xCF, 0xB1, 0x46, 0xFD, 0x3C, 0x6C, 0xE3, 0x59, 0xD8, 0xA6, 0x4D, 0x44, 0x3F,
-    0x71, 0x13, 0xD7, 0xC7, 0x46, 0x19, 0x0F, 0x7E, 0x34, 0xBF, 0x2A, 0x58, 0x0C, 0x30, 0x5A, 0x48,
-    0x9D, 0xE1, 0x99, 0x44, 0xEA, 0xA7, 0xF0, 0x04, 0x60, 0x7F, 0xCF, 0xFE, 0x32, 0x6B, 0xF4, 0xB5,
-    0xBB, 0x34, 0x17, 0xA1, 0x1C, 0xF5, 0x47, 0xAC, 0xAC, 0x35, 0x81, 0x00, 0xCA, 0x7F, 0x64, 0x38,
-    0x5A, 0x42, 0x3B, 0x3E, 0x4D, 0x11, 0xB1, 0x2D, 0x20, 0xC0, 0xFF, 0x4A, 0xA9, 0x37, 0x95, 0xAD,
-    0x23, 0xD3, 0x0E, 0xCB, 0xDC, 0xA0, 0x0B, 0x6C, 0xA6, 0xE5, 0x15, 0x71, 0x62, 0x19, 0x43, 0xB5,
-    0xF0, 0x28, 0x6C, 0xE3, 0xEB, 0x99, 0xF5, 0x30, 0x8C, 0xC2, 0x02, 0x4E, 0x3B, 0x25, 0x48, 0x63,
-    0x0C, 0x5A, 0xA7, 0x92, 0xA0, 0x89, 0x53, 0xBA, 0x46, 0xA3, 0xFC, 0x4B, 0x7C, 0xF3, 0x37, 0x04,
-    0x1A, 0xA7, 0x1C, 0xCD, 0x2F, 0xE8, 0x4D, 0x3B, 0xC8, 0x6A, 0x5B, 0xB1, 0xA5, 0x5E, 0x4B, 0x98,
-    0xDC, 0x43, 0x4E, 0x9C, 0x9C, 0x9C, 0x39, 0x3A, 0x50, 0x33, 0xB9, 0x09, 0x66, 0xE4, 0x28, 0xA2,
-    0x59, 0xAB, 0x8E, 0x5B, 0x68, 0xAD, 0xB0, 0x8E, 0x3A, 0x34, 0x17, 0x45, 0x65, 0xD0, 0x23, 0xDB,
-    0x1B, 0xE7, 0xFE, 0x02, 0x69, 0xF4, 0x38, 0xF7, 0x6C, 0x88, 0x1B, 0xA2, 0xCD, 0x57, 0x6B, 0xC9,
-    0x53, 0x17, 0xDF, 0x29, 0x51, 0x38, 0x35, 0xD9, 0x4F, 0x18, 0x53, 0x82, 0x20, 0xFD, 0x90, 0x5F,
-    0xBE, 0xA3, 0x9D, 0xCE, 0x0C, 0x41, 0x04, 0xE6, 0x92, 0x5B, 0x16, 0x0C, 0xAA, 0x22, 0xE1, 0x3C,
-    0xED, 0xDA, 0x3B, 0xE2, 0x04, 0xA2, 0x12, 0xD1, 0xAF, 0x98, 0xD7, 0xCD, 0xCD, 0xF6, 0xA6, 0x3D,
-    0x54, 0x9A, 0x7C, 0x8E, 0x5D, 0x02, 0x4E, 0x95, 0x5E, 0xB0, 0x48, 0x95, 0xDA, 0x8B, 0xC7, 0x9F,
-    0x2A, 0xFD, 0x35, 0x64, 0xD3, 0xE1, 0xD6, 0x70, 0x57, 0x46, 0x18, 0x53, 0x19, 0x63, 0x8F, 0xD0,
-    0x28, 0xE8, 0xB1, 0x7B, 0xF8, 0xA5, 0xC3, 0x9F, 0x7F, 0xF2, 0x7C, 0xD4, 0x9E, 0xDF, 0xBD, 0xC9,
-    0xF6, 0x90, 0x5C, 0x9A, 0x02, 0x94, 0x50, 0x13, 0xAF, 0x5B, 0xBF, 0xBE, 0x69, 0x7E, 0x5B, 0x6E,
-    0xAE, 0x38, 0xBA, 0xA4, 0x2E, 0x9D, 0x12, 0x7F, 0xA8, 0x58, 0x47, 0xAE, 0x9A, 0x12, 0x38, 0xD2,
-    0x79, 0xD7, 0x7E, 0xED, 0x97, 0xB9, 0xF4, 0xCE, 0x84, 0xD2, 0x3B, 0xD3, 0x72, 0xAE, 0xC1, 0x7B,
-    0xD4, 0x4D, 0x7A, 0x67, 0xEA, 0xB5, 0xDE, 0x99, 0x27, 0x2F, 0x1E, 0xBE, 0xF6, 0xBC, 0x6B, 0xE1,
-    0x53, 0xD0, 0x88, 0xFA, 0x95, 0x24, 0xCB, 0x7D, 0x33, 0x46, 0x2E, 0xD7, 0x98, 0x1D, 0x5D, 0x32,
-    0x98, 0x0B, 0xF5, 0x0F, 0xE7, 0x85, 0x2D, 0xDF, 0x30, 0xD1, 0xC7, 0x2D, 0x9B, 0xAE, 0xE8, 0xA3,
-    0x92, 0x6D, 0x0D, 0xD1, 0x8A, 0x87, 0x58, 0x12, 0x3A, 0xF1, 0x1C, 0xEC, 0x26, 0x26, 0xB1, 0xB9,
-    0x25, 0x70, 0x0A, 0x31, 0x77, 0x95, 0xC4, 0x6B, 0xD6, 0xB8, 0xDC, 0x08, 0xFF, 0x63, 0x01, 0xEB,
-    0x2A, 0x14, 0x95, 0x57, 0x0F, 0x32, 0x2C, 0x30, 0x70, 0x7A, 0x70, 0xF1, 0x65, 0x38, 0x1F, 0x56,
-    0x1A, 0xC7, 0x97, 0xCD, 0x0D, 0x4F, 0x9F, 0xA8, 0x99, 0xCF, 0x22, 0x6A, 0xC9, 0x67, 0x10, 0x35,
-    0xFF, 0x31, 0xAA, 0xEA, 0x9E, 0xBB, 0x71, 0xA6, 0xD7, 0x38, 0x1D, 0xE5, 0x8F, 0xCA, 0xCA, 0x75,
-    0x00, 0xB8, 0xB8, 0x5B, 0xD2, 0x16, 0x46, 0x3C, 0x08, 0xB9, 0xD9, 0x1B, 0x65, 0x11, 0xA2, 0x28,
-    0x92, 0x08, 0x41, 0x84, 0x1C, 0xB2, 0x18, 0x42, 0x0A, 0x21, 0x84, 0x90, 0x41, 0x88, 0x20, 0x24,
-    0x10, 0x02, 0x08, 0xF9, 0x83, 0xF8, 0x41, 0xFA, 0x58, 0xF8, 0x72, 0x66, 0x76, 0x9E, 0x32, 0xC7,
-    0x91, 0x09, 0x03, 0x9B, 0x33, 0xCD, 0x92, 0xAC, 0x26, 0x48, 0x82, 0x65, 0x52, 0x75, 0xB6, 0x92,
-    0x20, 0x79, 0x7F, 0x63, 0xD3, 0xF5, 0x44, 0xC9, 0x78, 0x52, 0xF3, 0x4D, 0x65, 0x67, 0x86, 0x2D,
-    0x59, 0x6C, 0xC3, 0x1E, 0x25, 0x7D, 0x6E, 0x80, 0xE0, 0x1C, 0x45, 0x3D, 0xA6, 0x30, 0x24, 0x00,
-    0x36, 0xE9, 0x0C, 0xFA, 0x2A, 0x69, 0x42, 0x19, 0x50, 0xEA, 0x27, 0x57, 0xB1, 0xC5, 0x80, 0xBE,
-    0x89, 0x6C, 0x86, 0x32, 0x59, 0x36, 0xC3, 0x1E, 0x88, 0xAC, 0x96, 0x8D, 0x31, 0xB5, 0xE6, 0x3D,
-    0x30, 0x58, 0x49, 0x9B, 0x0E, 0x18, 0x68, 0x42, 0x4E, 0xAA, 0x52, 0x30, 0x9D, 0x48, 0x73, 0xBC,
-    0x46, 0x9D, 0xDC, 0x4C, 0xC0, 0x7B, 0x13, 0x07, 0x59, 0x4F, 0xC5, 0x27, 0xBA, 0x81, 0x44, 0x52,
-    0x98, 0xB2, 0x81, 0x04, 0xE8, 0x01, 0xB9, 0x43, 0xBD, 0xD7, 0x2C, 0xCE, 0x07, 0xE8, 0x1D, 0x24,
-    0x81, 0x5B, 0x90, 0x4B, 0x86, 0xD4, 0x38, 0x14, 0x00, 0xAF, 0xFF, 0x1E, 0x49, 0x57, 0xF4, 0xD8,
-    0xF1, 0xA5, 0xE3, 0x5C, 0x6B, 0xC7, 0x89, 0xD6, 0x39, 0xA7, 0x8E, 0x5A, 0xEE, 0x36, 0x6C, 0x90,
-    0x93, 0x44, 0x16, 0x39, 0xE5, 0x1D, 0x40, 0x48, 0xF2, 0x84, 0xC3, 0x0F, 0x1B, 0xED, 0x9E, 0xD3,
-    0xCD, 0x38, 0x0D, 0x02, 0x26, 0x92, 0x9D, 0xF9, 0xE1, 0xAE, 0xA9, 0x78, 0x43, 0xD7, 0xD4, 0x29,
-    0x20, 0xBB, 0x37, 0x63, 0x93, 0x87, 0x75, 0xBC, 0xF8, 0x3A, 0x97, 0xA3, 0xE1, 0xF3, 0x2F, 0x56,
-    0x30, 0x3D, 0x66, 0x2E, 0x98, 0xFD, 0xED, 0xBB, 0x08, 0x24, 0x40, 0x93, 0x70, 0x8E, 0xAC, 0x56,
-    0x5C, 0x17, 0x92, 0x3F, 0x82, 0x7A, 0xBE, 0x27, 0x5D, 0x0A, 0xB9, 0x77, 0xBA, 0x98, 0x61, 0xFC,
-    0xBB, 0xE7, 0xF7, 0x38, 0x64, 0xCC, 0x10, 0xB0, 0xC0, 0x1C, 0x60, 0x57, 0x5B, 0xC7, 0xAE, 0x56,
-    0x30, 0xE3, 0x7D, 0xBC, 0xDE, 0x34, 0x88, 0x98, 0x6C, 0xA2, 0x02, 0x6F, 0xA4, 0x33, 0x18, 0xDC,
-    0xD1, 0xFA, 0xD1, 0xD2, 0x4C, 0xF6, 0x5A, 0x9C, 0xD0, 0x66, 0x54, 0x14, 0x28, 0xC0, 0x24, 0x14,
-    0x25, 0xE6, 0xC8, 0xB3, 0xB6, 0xE8, 0xCD, 0x6D, 0x5C, 0x0A, 0xBF, 0x54, 0xAB, 0x39, 0xB8, 0xB4,
-    0xA8, 0x30, 0x4B, 0x3B, 0x4E, 0xB7, 0xD6, 0x92, 0x24, 0x1E, 0x5A, 0x02, 0x16, 0x60, 0x81, 0xF4,
-    0x06, 0xD8, 0xD2, 0x87, 0xE5, 0x0A, 0x65, 0x97, 0xCD, 0x7D, 0x26, 0x07, 0x4F, 0xF3, 0xBA, 0x02,
-    0x41, 0x7A, 0x9B, 0x98, 0xC1, 0xBA, 0xEF, 0x26, 0xB3, 0x03, 0x69, 0x05, 0xFE, 0x33, 0x74, 0x20,
-    0xB3, 0x24, 0x76, 0x4D, 0xE9, 0xCB, 0x16, 0x81, 0x46, 0x9B, 0xBA, 0x12, 0x6E, 0x24, 0x60, 0xD6,
-    0xA4, 0xAC, 0x33, 0x98, 0x39, 0xE3, 0xDE, 0xBD, 0xB1, 0xE9, 0x19, 0x81, 0x2A, 0xDF, 0x54, 0xE3,
-    0x8D, 0xCB, 0xB7, 0x5B, 0xD7, 0xC8, 0x44, 0xEF, 0xF5, 0x73, 0x42, 0x99, 0xA3, 0xD7, 0x88, 0xA9,
-    0xC7, 0xFA, 0x38, 0x66, 0xB2, 0x20, 0x59, 0xC8, 0x0C, 0xE3, 0x9B, 0x87, 0x60, 0x99, 0xE0, 0x17,
-    0x39, 0xFC, 0x1C, 0xDB, 0x84, 0x11, 0xD7, 0x85, 0x15, 0x29, 0xE9, 0x8B, 0xE4, 0x93, 0xEA, 0xBD,
-    0x61, 0x97, 0xA9, 0x99, 0xFC, 0xAC, 0x0D, 0xE7, 0xBC, 0x2F, 0xC7, 0xCE, 0x82, 0x8E, 0xEB, 0x5C,
-    0xB6, 0x0C, 0xB1, 0x68, 0x38, 0xB3, 0xC9, 0x6C, 0xA1, 0x65, 0xD0, 0x32, 0x63, 0x16, 0x2C, 0x62,
-    0x4C, 0x15, 0xB2, 0x30, 0x3C, 0x2E, 0x76, 0x3B, 0x88, 0x0D, 0x07, 0xE1, 0xCC, 0xA0, 0x83, 0x6B,
-    0x92, 0x0A, 0xD7, 0x2A, 0x52, 0xAC, 0x55, 0xA5, 0x54, 0xC7, 0x8C, 0x24, 0x9D, 0x59, 0x45, 0xF0,
-    0x85, 0xCC, 0xAC, 0x85, 0xCD, 0x77, 0x89, 0x5D, 0xBB, 0x4D, 0x81, 0x6A, 0xF4, 0x90, 0x47, 0x2C,
-    0x6F, 0xCC, 0xB2, 0xEB, 0x2B, 0x5D, 0x41, 0xAE, 0xB3, 0xAB, 0x9E, 0xF6, 0x23, 0x69, 0xA3, 0x75,
-    0x63, 0xCC, 0xCA, 0x56, 0x8C, 0x95, 0xAD, 0x56, 0x90, 0x83, 0xFA, 0x82, 0xD4, 0xDA, 0xFC, 0xC1,
-    0x8C, 0x1B, 0xB8, 0xAA, 0xB1, 0xEB, 0x87, 0xA9, 0x3E, 0xE0, 0x0F, 0x4C, 0x5C, 0x2B, 0x26, 0xDC,
-    0xC2, 0xE2, 0xE9, 0xA6, 0xAB, 0x50, 0x52, 0x62, 0xCC, 0xC6, 0x70, 0xF8, 0xC1, 0x80, 0xCA, 0x05,
-    0x66, 0x26, 0x9A, 0xC8, 0xA0, 0x95, 0x45, 0x54, 0xB7, 0x12, 0x64, 0x71, 0x09, 0x4B, 0x2C, 0xDA,
-    0xAC, 0xF6, 0xA5, 0x55, 0xC3, 0xD3, 0xED, 0x5E, 0x56, 0x82, 0x71, 0x7E, 0x2B, 0x49, 0x15, 0xB9,
-    0x2D, 0xDF, 0xB2, 0xFF, 0x63, 0xD2, 0x8E, 0x5B, 0x55, 0xCC, 0x76, 0xEF, 0xEA, 0x23, 0x78, 0x1A,
-    0xF3, 0x2C, 0x9B, 0xDF, 0x6F, 0x19, 0x33, 0x6D, 0x55, 0x20, 0x12, 0x65, 0x43, 0x68, 0xCD, 0x85,
-    0x05, 0xEF, 0xCA, 0x5A, 0x5C, 0x26, 0xF2, 0xF6, 0x0D, 0x3D, 0xB8, 0xA8, 0x5F, 0x90, 0xDE, 0x12,
-    0x64, 0xF7, 0xF0, 0xF6, 0x8D, 0x15, 0xD1, 0xB1, 0x62, 0xB2, 0xB1, 0x6C, 0x92, 0x8F, 0x74, 0x3E,
-    0xE1, 0xD4, 0x5C, 0xF9, 0x92, 0xA8, 0xCA, 0x39, 0x57, 0x5A, 0xD3, 0xD0, 0x92, 0xC6, 0x8E, 0xD9,
-    0x14, 0x5A, 0x6D, 0xE5, 0x81, 0x6D, 0x8A, 0xD6, 0xAB, 0xFE, 0xD1, 0x76, 0x26, 0xFE, 0xA7, 0xB7,
-    0xE8, 0xF2, 0x0F, 0x3E, 0x79, 0x52, 0xFF, 0xE1, 0x35, 0x92, 0x26, 0x42, 0x95, 0x23, 0x9D, 0xAD,
-    0x96, 0x92, 0xF3, 0x43, 0xA5, 0xA6, 0x23, 0x3D, 0xA9, 0xB5, 0xED, 0x3A, 0xA8, 0xBB, 0x00, 0xBE,
-    0x54, 0x02, 0x3A, 0xD7, 0x1D, 0xD8, 0x4E, 0x8D, 0x9D, 0xDB, 0xE7, 0x80, 0xC0, 0x45, 0xBB, 0xFE,
-    0x5D, 0xDB, 0xBF, 0xC6, 0x2E, 0xDA, 0xF8, 0x7F, 0xC4, 0x8E, 0xD0, 0x13, 0xC8, 0xC9, 0x3D, 0xF3,
-    0xA7, 0x7C, 0xCE, 0x04, 0xCD, 0xF8, 0x06, 0xD3, 0x27, 0x63, 0xFA, 0xC2, 0x05, 0x80, 0x92, 0x99,
-    0x04, 0xB3, 0xC7, 0xB4, 0x2E, 0xC6, 0xEC, 0x9A, 0x1D, 0xF7, 0x3B, 0x2A, 0x33, 0x45, 0xBC, 0x24,
-    0x5E, 0x7F, 0x76, 0x5A, 0x32, 0x6A, 0xF8, 0xE5, 0x1F, 0x0E, 0x5C, 0x06, 0x67, 0x48, 0xD8, 0xDD,
-    0x2E, 0xB5, 0x71, 0x80, 0xEB, 0x86, 0x70, 0xF6, 0xCF, 0xB9, 0xCC, 0x65, 0x31, 0xD9, 0x4F, 0x21,
-    0x9B, 0xB2, 0xC5, 0xB9, 0x0B, 0x75, 0xAB, 0x72, 0x27, 0x73, 0x4A, 0x4D, 0xB9, 0x5E, 0x76, 0x8F,
-    0x6B, 0xD9, 0x6D, 0xCE, 0x7B, 0xA2, 0x89, 0xF0, 0x6F, 0x00, 0xB9, 0x07, 0xC0, 0x4E, 0xF6, 0x97,
-    0xD2, 0xF4, 0xA4, 0xCA, 0xC9, 0x16, 0xB1, 0x82, 0x1E, 0xBE, 0x35, 0xC0, 0x26, 0x62, 0xCB, 0x85,
-    0x2A, 0xDD, 0x33, 0x77, 0x5C, 0xAE, 0x13, 0xE8, 0x2E, 0xDC, 0x69, 0x15, 0x61, 0xB9, 0xA2, 0x68,
-    0x6F, 0x80, 0xE1, 0x7C, 0x7A, 0xC6, 0xDB, 0x96, 0x9F, 0x2A, 0x72, 0x8F, 0x8C, 0x41, 0x4E, 0xAE,
-    0x40, 0xCA, 0x42, 0xF2, 0x8C, 0xA6, 0x9F, 0xD1, 0x64, 0x82, 0xE2, 0x6F, 0x2A, 0xBB, 0x17, 0x51,
-    0x26, 0x1D, 0x9B, 0x3F, 0x88, 0x07, 0x17, 0x99, 0x7A, 0x57, 0xB9, 0xE2, 0x93, 0xF1, 0x8B, 0xB2,
-    0x92, 0xA3, 0x94, 0x83, 0xDD, 0x5A, 0xDB, 0xE2, 0xD5, 0x7C, 0x9D, 0xDF, 0x5B, 0xEE, 0x9A, 0x90,
-    0x18, 0xE3, 0x63, 0xE8, 0xC7, 0xFA, 0x3E, 0xD6, 0xF0, 0xA5, 0x55, 0x62, 0x9F, 0x18, 0x6A, 0x6F,
-    0x83, 0xD8, 0xE8, 0xC2, 0x40, 0xF0, 0xFC, 0x80, 0xA5, 0x28, 0xE5, 0xD3, 0x53, 0xA2, 0x92, 0xBB,
-    0x36, 0x9F, 0x10, 0xB5, 0x4F, 0x06, 0x0D, 0x83, 0x7F, 0x5E, 0xBA, 0x00, 0x7A, 0xC2, 0xC0, 0xC3,
-    0x49, 0xD4, 0xFC, 0xE6, 0x98, 0xF0, 0x0F, 0xD0, 0xCF, 0xE9, 0xEB, 0xDE, 0xAF, 0xE3, 0xA2, 0x25,
-    0xB4, 0x33, 0x2E, 0xF0, 0xCE, 0xA1, 0xEF, 0xB1, 0x92, 0xC6, 0x18, 0x1A, 0x25, 0x13, 0x17, 0xB4,
-    0x7D, 0x03, 0x69, 0xBC, 0x1D, 0x04, 0x0F, 0x29, 0x4E, 0xAF, 0x91, 0xEC, 0x9D, 0xA4, 0x1B, 0x04,
-    0xBF, 0x89, 0x9E, 0x3B, 0x21, 0x12, 0xEE, 0x95, 0xDC, 0x74, 0xD9, 0x32, 0x93, 0xEE, 0x27, 0x4E,
-    0x71, 0x63, 0x8F, 0x30, 0x22, 0x97, 0xA5, 0x7F, 0x7E, 0x9C, 0x12, 0x0E, 0xE7, 0x78, 0x11, 0xCB,
-    0x75, 0x46, 0xBE, 0x6F, 0x9F, 0x30, 0x42, 0xF7, 0x2F, 0x31, 0x42, 0xB7, 0x76, 0xD8, 0x0A, 0xBC,
-    0x7E, 0x99, 0x63, 0x8C, 0x9B, 0x9F, 0xDA, 0x04, 0x93, 0xAF, 0x9F, 0x59, 0xF2, 0xB9, 0xBA, 0x6E,
-    0x40, 0xE5, 0x33, 0x76, 0x90, 0x5A, 0x16, 0xBF, 0xE5, 0xAC, 0x30, 0x39, 0x5F, 0xF6, 0x01, 0x8B,
-    0x75, 0x91, 0x83, 0x83, 0x82, 0x65, 0xF7, 0x91, 0x9C, 0x12, 0x14, 0x2F, 0x9C, 0x10, 0xC1, 0x57,
-    0xE0, 0x50, 0x39, 0x90, 0x1E, 0x65, 0xCE, 0x59, 0x60, 0xBB, 0xF8, 0xA7, 0x94, 0x6D, 0x37, 0xF6,
-    0xB4, 0xB6, 0x3A, 0x76, 0x5B, 0x12, 0xC1, 0xF1, 0x3A, 0xFA, 0x6B, 0xED, 0x2E, 0x94, 0x10, 0x55,
-    0x6B, 0xB9, 0x12, 0xC8, 0x70, 0xCC, 0x55, 0xBD, 0xBF, 0x3C, 0x64, 0xC4, 0x6F, 0xB0, 0x8D, 0x41,
-    0x8E, 0x18, 0x91, 0x13, 0x46, 0x44, 0xF6, 0xA4, 0x9D, 0x66, 0x64, 0xFE, 0x09, 0xE0, 0x87, 0x31,
-    0xBF, 0x6B, 0xA4, 0x1F, 0xAD, 0x43, 0xC2, 0x6E, 0x3B, 0xA8, 0x4D, 0x1C, 0x92, 0xEC, 0x6F, 0xC1,
-    0x85, 0x64, 0x3F, 0x86, 0x82, 0x3C, 0x53, 0xD8, 0xE1, 0x50, 0xE9, 0x37, 0x3A, 0xA2, 0xF4, 0xEB,
-    0x1A, 0xC4, 0x51, 0xE0, 0x54, 0x73, 0x9B, 0x95, 0xD7, 0xB0, 0xB2, 0xD1, 0x21, 0x76, 0xED, 0x8B,
-    0xA6, 0x4C, 0x8C, 0xCE, 0xF6, 0x33, 0xFB, 0x16, 0x8D, 0x3A, 0x5F, 0x10, 0x65, 0xBC, 0x52, 0x36,
-    0xB8, 0x70, 0x0A, 0x35, 0x96, 0xA6, 0x7C, 0x82, 0xBA, 0x4E, 0xB0, 0x4D, 0xF5, 0xB0, 0x7C, 0xFD,
-    0xDE, 0x70, 0x17, 0x8D, 0x47, 0x47, 0xD5, 0x41, 0x59, 0x9C, 0x30, 0x36, 0xE7, 0xA0, 0x0F, 0xB0,
-    0xC2, 0xCF, 0x69, 0xA1, 0x43, 0x34, 0x56, 0x7E, 0x13, 0x7E, 0xEC, 0x4F, 0x19, 0x14, 0x6E, 0xE3,
-    0xA6, 0xE1, 0xA6, 0x3B, 0x26, 0x6B, 0xE9, 0x04, 0x64, 0x88, 0x73, 0x3B, 0x19, 0xE6, 0xA8, 0x8B,
-    0x0E, 0x22, 0x14, 0xF7, 0x04, 0xA8, 0xB9, 0x20, 0x2F, 0xD1, 0xB4, 0x27, 0x51, 0xBF, 0x8F, 0x22,
-    0x39, 0xE7, 0xD9, 0x51, 0x54, 0x9D, 0xA1, 0xB5, 0x87, 0xB0, 0xC3, 0xE9, 0x1A, 0xB2, 0x2D, 0x88,
-    0x0C, 0x33, 0x60, 0x85, 0xDE, 0xE3, 0x01, 0x8B, 0x40, 0x48, 0x9E, 0xC8, 0x70, 0x49, 0x48, 0x7F,
-    0x45, 0x68, 0xBF, 0x23, 0xC3, 0x2D, 0x19, 0x3A, 0x30, 0xDA, 0xD3, 0x84, 0x4B, 0x83, 0x72, 0x33,
-    0x17, 0x17, 0x43, 0xDD, 0x13, 0x23, 0x1B, 0xA2, 0x46, 0x6F, 0x4C, 0x5B, 0xEB, 0x2F, 0x73, 0x6B,
-    0xFD, 0x8F, 0xCC, 0x45, 0x8E, 0x90, 0x2F, 0xAF, 0xB6, 0xD6, 0xE3, 0x43, 0x0B, 0x02, 0x7B, 0x97,
-    0x8F, 0x66, 0x61, 0xC7, 0xBC, 0x45, 0x4E, 0x65, 0xCC, 0xF8, 0x36, 0x9C, 0xF1, 0xE5, 0xB4, 0x6F,
-    0xAA, 0x69, 0x5F, 0x2E, 0x37, 0xA0, 0xDA, 0x80, 0xE4, 0x3E, 0x52, 0xFB, 0x19, 0x9F, 0x68, 0x92,
-    0xE5, 0xE1, 0x40, 0xAA, 0xE1, 0x37, 0xE8, 0x92, 0x5F, 0x1E, 0x4C, 0xF6, 0x5E, 0x6B, 0xB7, 0x32,
-    0x5B, 0x57, 0x03, 0x99, 0x0A, 0x5A, 0xB7, 0xD7, 0xD0, 0xC5, 0xA1, 0xB5, 0xF6, 0x14, 0xDD, 0xDD,
-    0x66, 0xEB, 0xC6, 0x8D, 0xD3, 0x45, 0x70, 0xD7, 0xAD, 0x5F, 0xAF, 0x1D, 0x12, 0x79, 0x8C, 0x14,
-    0x3E, 0x2B, 0xDD, 0x3A, 0x31, 0x8E, 0xC4, 0x33, 0xD1, 0x07, 0x0F, 0xC5, 0x28, 0xF7, 0xD3, 0xF0,
-    0x6E, 0xC2, 0xFC, 0x53, 0x41, 0xF6, 0xCF, 0xB0, 0x77, 0xE0, 0x98, 0xB9, 0x60, 0xB6, 0x85, 0xFB,
-    0xD2, 0xB8, 0xEA, 0x7F, 0xFC, 0x40, 0x36, 0xF2, 0x25, 0x32, 0xC4, 0x93, 0xDF, 0xFC, 0xB9, 0xB4,
-    0x05, 0x88, 0x0F, 0x65, 0xCE, 0x97, 0xA7, 0x4C, 0x05, 0x81, 0x10, 0xCC, 0x0B, 0xEF, 0xE0, 0x4D,
-    0xEE, 0x27, 0x8B, 0x91, 0xE6, 0xD5, 0x3B, 0x39, 0x8F, 0x0A, 0xAD, 0xCE, 0x67, 0xF6, 0x9E, 0x10,
-    0xA7, 0x5E, 0x2C, 0x71, 0x9E, 0x40, 0x71, 0x5B, 0x52, 0x2D, 0x92, 0xA2, 0x9D, 0x23, 0x0E, 0x8F,
-    0x66, 0x99, 0x6C, 0x65, 0xBC, 0x27, 0xAB, 0x26, 0x3F, 0x65, 0xBC, 0x39, 0x73, 0xE7, 0x45, 0x94,
-    0x6C, 0xD9, 0xBA, 0x67, 0xDF, 0x66, 0x78, 0x1F, 0xB0, 0x61, 0xF5, 0xE7, 0x11, 0x2C, 0xF2, 0x25,
-    0x2C, 0xA0, 0x73, 0x6B, 0xFB, 0xA8, 0x99, 0x35, 0x06, 0xBC, 0x41, 0x1E, 0xA7, 0x75, 0x39, 0xF8,
-    0xB1, 0x48, 0x8D, 0xD6, 0xF9, 0x04, 0xA5, 0xEA, 0x74, 0xD2, 0x3A, 0x3F, 0x2D, 0x52, 0x57, 0xAE,
-    0x26, 0x9C, 0xC9, 0xA9, 0x97, 0xCC, 0x28, 0xE1, 0x94, 0xB0, 0x4A, 0x78, 0x65, 0xC0, 0x2C, 0x23,
-    0xDC, 0x12, 0x76, 0x9D, 0x70, 0xBA, 0x2F, 0xA6, 0x5D, 0x25, 0x72, 0x72, 0xE7, 0xB8, 0x43, 0x76,
-    0xA5, 0x64, 0x9B, 0xFD, 0x4B, 0x6E, 0x5C, 0x94, 0xE2, 0x3A, 0xCB, 0x8E, 0x73, 0x65, 0x5C, 0x72,
-    0xC1, 0x02, 0x5C, 0x70, 0x40, 0x9A, 0x2E, 0x2F, 0x7C, 0xC0, 0x28, 0x22, 0x07, 0xE7, 0x37, 0xED,
-    0x3B, 0xF0, 0x02, 0xD7, 0x29, 0x82, 0x16, 0x71, 0x8D, 0x35, 0xBF, 0xEB, 0xEA, 0xD1, 0x0F, 0x5C,
-    0x3F, 0x8D, 0xDF, 0xEA, 0x99, 0xA3, 0x2B, 0xBB, 0x16, 0x84, 0x00, 0xA4, 0x08, 0xBD, 0x3D, 0x9A,
-    0xBE, 0x2F, 0x2C, 0xB6, 0xCB, 0xD0, 0x1D, 0xE3, 0x8F, 0x0D, 0xDD, 0x39, 0xB3, 0x93, 0x43, 0xBF,
-    0x37, 0xC0, 0x58, 0x4E, 0xE8, 0xDC, 0x97, 0x9D, 0x2C, 0x2D, 0xB3, 0x9E, 0x79, 0x4E, 0x1F, 0xF2,
-    0xC1, 0x7D, 0xEF, 0xFF, 0xE6, 0xCC, 0x6B, 0x0A, 0xFC, 0x82, 0x7F, 0x9B, 0x73, 0x03, 0x0F, 0x17,
-    0x8D, 0x7E, 0xDC, 0x31, 0x73, 0xB9, 0x5A, 0xF1, 0x2A, 0x87, 0x86, 0xEC, 0x79, 0xC7, 0x44, 0xC3,
-    0x2B, 0xF0, 0x34, 0x2F, 0xD2, 0x4C, 0xF7, 0x71, 0xB7, 0x43, 0x77, 0x72, 0xEC, 0xDB, 0xBD, 0xA0,
-    0x47, 0x81, 0xDD, 0x9A, 0xD6, 0x97, 0xCA, 0xBF, 0xF5, 0x1B, 0xBF, 0x47, 0x3F, 0x90, 0x0D, 0x6A,
-    0xBF, 0x87, 0x99, 0xAD, 0xA2, 0xD2, 0xEB, 0x91, 0x74, 0xAD, 0x62, 0x9A, 0x1D, 0x99, 0xD7, 0xEA,
-    0x12, 0xDD, 0x21, 0xEF, 0x5E, 0x90, 0xB0, 0x2C, 0xE0, 0x0B, 0x17, 0x2C, 0xA5, 0xC0, 0x1C, 0xCD,
-    0x79, 0x33, 0x17, 0xCD, 0xD8, 0xD1, 0xED, 0x16, 0xAA, 0xB1, 0xA0, 0x8D, 0x94, 0x7C, 0x4D, 0xFB,
-    0xE3, 0x35, 0x01, 0xA1, 0x01, 0xB6, 0x89, 0xFF, 0x5D, 0x88, 0x99, 0x69, 0x03, 0x40, 0xA7, 0x3D,
-    0x02, 0xF9, 0xE1, 0xC6, 0xA4, 0x2D, 0x56, 0xC0, 0x01, 0x47, 0xB3, 0xBB, 0x1D, 0xAF, 0x81, 0x8C,
-    0xBB, 0x4D, 0x28, 0x2A, 0x8F, 0x79, 0x4C, 0x48, 0x84, 0x78, 0x4C, 0x69, 0x2C, 0x29, 0x60, 0xFE,
-    0x43, 0x26, 0x11, 0x8D, 0x7F, 0x49, 0x23, 0x6F, 0x09, 0xFF, 0xCF, 0x8E, 0xA4, 0xC1, 0xEF, 0xFC,
-    0xBF, 0xED, 0x49, 0xE8, 0xFD, 0x2E, 0xB8, 0xDD, 0x9B, 0xD7, 0x69, 0x8C, 0xC8, 0x25, 0x27, 0x3A,
-    0x77, 0x67, 0xBD, 0xDE, 0x27, 0x2A, 0x77, 0x2F, 0x79, 0x3D, 0xDB, 0xDF, 0xEE, 0xB2, 0xD7, 0xB3,
-    0x76, 0xEF, 0x5A, 0xAF, 0xBF, 0x48, 0xE3, 0x41, 0xE3, 0xF5, 0x7C, 0xB2, 0xE2, 0xA3, 0xDA, 0xF4,
-    0xAD, 0x64, 0x51, 0x18, 0x6D, 0x5E, 0xF5, 0x8C, 0x8F, 0x3F, 0x2C, 0x11, 0xCD, 0x57, 0xDA, 0x0E,
-    0x05, 0x4B, 0x5F, 0xB7, 0x32, 0xFC, 0x97, 0x84, 0x0F, 0x2F, 0xCF, 0xA5, 0x67, 0xE2, 0x96, 0x3C,
-    0xFF, 0xCC, 0x24, 0x9F, 0xD1, 0x7B, 0x14, 0x32, 0x64, 0x32, 0x04, 0x48, 0x6B, 0x20, 0xAC, 0x62,
-    0xF9, 0xB5, 0x12, 0x5A, 0x58, 0xA4, 0x35, 0x38, 0xC2, 0xB8, 0x25, 0xC4, 0x9E, 0x4B, 0x7D, 0x14,
-    0xF5, 0x36, 0x39, 0xCF, 0x32, 0x6E, 0x13, 0x09, 0x59, 0xAE, 0x48, 0xFC, 0x02, 0x9B, 0x1C, 0x7C,
-    0xD2, 0x08, 0x28, 0xF5, 0x24, 0x30, 0x5C, 0x3B, 0xC6, 0x67, 0xF5, 0xFC, 0x1E, 0x1D, 0xC4, 0xA2,
-    0xBB, 0x83, 0xB6, 0xB4, 0x0C, 0x85, 0xDF, 0x28, 0x04, 0xDA, 0x93, 0xA4, 0xFA, 0x6C, 0xB5, 0xD9,
-    0xB2, 0x52, 0xAC, 0xF1, 0xC6, 0xE8, 0x23, 0x39, 0x19, 0xB2, 0xEC, 0xA4, 0x65, 0x64, 0xC7, 0xE8,
-    0x76, 0xEC, 0x55, 0xDE, 0x42, 0x22, 0x68, 0x81, 0x7B, 0x15, 0x32, 0x29, 0x1C, 0xCF, 0x71, 0xCC,
-    0xCF, 0x5D, 0xBA, 0x8D, 0xD1, 0x4E, 0x5D, 0x6C, 0xD3, 0x9B, 0x01, 0xA6, 0x58, 0x4A, 0xB8, 0x4C,
-    0x11, 0x82, 0x1E, 0x19, 0xA6, 0x41, 0x0A, 0x06, 0x56, 0x4A, 0x06, 0x95, 0x34, 0x01, 0x15, 0xB9,
-    0x04, 0xDB, 0xB7, 0x25, 0x93, 0xF3, 0x63, 0x69, 0x27, 0xFB, 0xFB, 0x52, 0x3A, 0xC3, 0x44, 0x04,
-    0xF5, 0x38, 0xE5, 0x95, 0xC3, 0x9F, 0xDC, 0xFE, 0xFF, 0xF2, 0x70, 0xBD, 0x4D, 0x49, 0x81, 0x8A,
-    0xC7, 0xB9, 0x6D, 0xD9, 0x6C, 0xA2, 0xB9, 0x23, 0x3D, 0x2A, 0x90, 0x00, 0xB9, 0x25, 0xBB, 0x3A,
-    0x06, 0x81, 0x61, 0x90, 0x49, 0x7A, 0x31, 0xC0, 0xCF, 0xAE, 0x4B, 0xF6, 0x89, 0xE7, 0xBB, 0x64,
-    0xA6, 0x35, 0xC1, 0xA6, 0x93, 0xEB, 0x31, 0xAF, 0x4A, 0xC8, 0xF8, 0x70, 0x63, 0x6D, 0x24, 0xCD,
-    0xC1, 0xB1, 0x0C, 0x5C, 0x5B, 0x1D, 0x50, 0xF3, 0x89, 0xA4, 0xDB, 0x89, 0x15, 0xE4, 0x8E, 0x1C,
-    0xEB, 0x79, 0xD3, 0x9D, 0x59, 0x25, 0x4D, 0x46, 0xAE, 0xDB, 0x4B, 0xCF, 0x0C, 0x29, 0xF4, 0x54,
-    0xAB, 0xFC, 0xF3, 0x3C, 0x91, 0xEA, 0x13, 0x35, 0x4E, 0x94, 0xA3, 0x27, 0x7C, 0x81, 0x83, 0x0D,
-    0x6B, 0x0F, 0xC3, 0xCA, 0x4F, 0x70, 0x6F, 0xD0, 0xFA, 0xC9, 0x61, 0x9F, 0xB1, 0x46, 0xA0, 0xBD,
-    0x0E, 0x1D, 0x1F, 0xFF, 0x3D, 0x37, 0x57, 0x59, 0xAE, 0x51, 0x56, 0x7F, 0xD7, 0x8C, 0x45, 0x18,
-    0xD0, 0x18, 0x55, 0x17, 0x6D, 0x53, 0x70, 0x7F, 0xEF, 0xCC, 0xF4, 0x5C, 0xE8, 0xCA, 0x78, 0x33,
-    0xE2, 0x58, 0xC0, 0x6A, 0x2E, 0xAC, 0x79, 0x4B, 0x5F, 0xC9, 0x15, 0xFC, 0x5C, 0xCF, 0x15, 0x77,
-    0xCE, 0xBA, 0x9E, 0xA6, 0xA5, 0xC7, 0xD7, 0xEA, 0xA9, 0xA8, 0x49, 0x7D, 0xD4, 0x26, 0xC2, 0x13,
-    0xCE, 0x85, 0xBD, 0xB1, 0x7E, 0xD5, 0x3B, 0x8A, 0x1D, 0x75, 0xFC, 0xDF, 0xF1, 0x70, 0xE1, 0x2B,
-    0xE6, 0x8C, 0x94, 0x54, 0xA1, 0x7E, 0x92, 0x57, 0xDB, 0x49, 0x0F, 0x6A, 0xA8, 0xB8, 0x2F, 0x5C,
-    0x99, 0xEE, 0x94, 0x70, 0xC1, 0xCF, 0x39, 0xD3, 0x19, 0x40, 0x0B, 0x79, 0x73, 0x28, 0xCB, 0x01,
-    0x38, 0x16, 0x9B, 0x32, 0x9D, 0x53, 0x76, 0x08, 0x3F, 0x84, 0x21, 0xC2, 0x11, 0x65, 0x89, 0xA6,
-    0xBA, 0x45, 0xFD, 0x48, 0xFB, 0xB9, 0xE4, 0xF3, 0xA6, 0xFF, 0xEC, 0x96, 0x39, 0x39, 0xF9, 0x27,
-    0x33, 0xC7, 0x80, 0x3B, 0xD8, 0x0A, 0x0B, 0xAF, 0x98, 0x54, 0x38, 0x18, 0xE4, 0xCE, 0xDF, 0xE7,
-    0xEE, 0xC4, 0xF7, 0xC5, 0x05, 0x19, 0x64, 0xF2, 0x42, 0x72, 0x86, 0x99, 0xA8, 0xEC, 0xAB, 0xE2,
-    0xC0, 0x3E, 0x3B, 0xD9, 0xC3, 0x3B, 0x4C, 0x37, 0x0E, 0xA8, 0xD2, 0xF4, 0x56, 0x3A, 0x4E, 0x55,
-    0x5B, 0xEA, 0x96, 0x02, 0x6D, 0x3D, 0x8E, 0x36, 0x1D, 0x76, 0x17, 0xAF, 0x2C, 0x48, 0x77, 0xE6,
-    0x5D, 0xB9, 0x32, 0xE4, 0x53, 0x27, 0x7A, 0x23, 0x0C, 0x2B, 0x2F, 0x77, 0x30, 0xAC, 0xBE, 0xBC,
-    0x99, 0x16, 0xFA, 0x75, 0xAF, 0xE1, 0x30, 0x55, 0x0D, 0xFF, 0x0F, 0xED, 0x5C, 0x3D, 0xAC, 0x1C,
-    0xD7, 0x75, 0xBE, 0x33, 0x23, 0xBE, 0x8D, 0x39, 0x88, 0x87, 0x85, 0x88, 0x44, 0xA6, 0xAD, 0x69,
-    0x5C, 0x18, 0x0A, 0xC4, 0x6D, 0x15, 0x80, 0xE4, 0x8C, 0xE5, 0x42, 0x2D, 0x03, 0x90, 0x55, 0x0A,
-    0xB9, 0x70, 0x11, 0x48, 0xC5, 0x6B, 0x5C, 0xA8, 0x78, 0xD2, 0x8C, 0x9D, 0x32, 0x0D, 0x1B, 0xB9,
-    0x0D, 0x0B, 0x15, 0x12, 0x05, 0xC4, 0x2A, 0x0C, 0x84, 0x41, 0x1E, 0x35, 0xA3, 0xB8, 0x48, 0x99,
-    0x4D, 0x10, 0xA4, 0x49, 0xB3, 0x46, 0x24, 0x38, 0x4E, 0xC3, 0x45, 0xB2, 0x11, 0xF6, 0x99, 0xBB,
-    0x33, 0x39, 0xE7, 0xFB, 0xCE, 0xBD, 0x73, 0xDF, 0x3E, 0x52, 0x90, 0x03, 0x88, 0xA2, 0x68, 0x3D,
-    0x90, 0x73, 0xE7, 0xBD, 0xDD, 0x9D, 0xB9, 0xF7, 0x9C, 0x73, 0xCF, 0xCF, 0x77, 0xBE, 0x59, 0xE7,
-    0xF4, 0x27, 0x5D, 0x62, 0x70, 0xF9, 0xC6, 0xB9, 0x64, 0x1C, 0x30, 0xCE, 0xC7, 0x71, 0x99, 0xAD,
-    0x9D, 0x1B, 0xDB, 0x7C, 0x9B, 0xAE, 0xDC, 0x6C, 0x2B, 0xAF, 0x64, 0x0B, 0x57, 0xAE, 0x9C, 0xEB,
-    0x5E, 0xAD, 0x5D, 0xD5, 0x3B, 0x57, 0xE9, 0xCB, 0xB5, 0xBC, 0xB5, 0x77, 0xC9, 0x20, 0x1F, 0x9F,
-    0x2F, 0x5C, 0xB6, 0x95, 0xB1, 0x5C, 0xEA, 0xDB, 0x31, 0x16, 0x6B, 0xFD, 0xBB, 0x8C, 0x2B, 0x8E,
-    0xFA, 0x71, 0x57, 0x2D, 0xF4, 0x14, 0xA3, 0xFC, 0x73, 0x7A, 0x2D, 0xBD, 0x9C, 0x6B, 0x6C, 0xEC,
-    0x78, 0x79, 0x37, 0xE2, 0x25, 0x97, 0x0E, 0x1C, 0xF5, 0xDA, 0x72, 0x0B, 0xCC, 0x4E, 0x2E, 0x8D,
-    0x6B, 0xE9, 0x75, 0xF5, 0xB5, 0xD9, 0x06, 0x6F, 0xD7, 0x79, 0xE4, 0x7A, 0x6B, 0xD7, 0xFC, 0x76,
-    0xC4, 0xA2, 0xF2, 0x71, 0xE0, 0xDA, 0x2E, 0xD6, 0xCE, 0xFF, 0x7C, 0x97, 0xC3, 0x88, 0x63, 0xA2,
-    0xC3, 0xB9, 0xEB, 0xFA, 0x5B, 0x2A, 0xEF, 0x7D, 0x4B, 0xAE, 0x7B, 0xD2, 0xF5, 0x47, 0x72, 0x85,
-    0xBA, 0xF8, 0xD5, 0xCA, 0x25, 0x3B, 0x37, 0x1B, 0x5B, 0x97, 0x6D, 0x70, 0xFB, 0x7C, 0x85, 0xA1,
-    0xE0, 0x50, 0x72, 0xBD, 0x72, 0x7F, 0x3F, 0xC8, 0x2C, 0xAA, 0x16, 0x93, 0x69, 0x5A, 0x97, 0xAF,
-    0x31, 0xE8, 0x14, 0x75, 0x58, 0xE2, 0xB5, 0x79, 0x8F, 0xA1, 0xA2, 0xD8, 0x74, 0x6E, 0xC5, 0x12,
-    0x42, 0x9B, 0x0D, 0x3F, 0xC7, 0x84, 0x3B, 0xCE, 0xF7, 0xDC, 0x34, 0x5D, 0x57, 0xDA, 0x79, 0xD5,
-    0x57, 0x32, 0xC3, 0xF9, 0xB6, 0x5A, 0x70, 0x2C, 0xFB, 0x44, 0xA6, 0xE6, 0xB6, 0x45, 0x8F, 0xB5,
-    0xDC, 0x2D, 0x1D, 0x2E, 0xB8, 0x3E, 0xD6, 0x59, 0xCB, 0xFA, 0x96, 0x2E, 0x95, 0x2B, 0x27, 0x6B,
-    0x8A, 0x4E, 0x95, 0xAC, 0x13, 0xD4, 0x71, 0xA6, 0x7F, 0x53, 0x51, 0xEA, 0xD8, 0x63, 0x5D, 0x6E,
-    0xD6, 0x53, 0x9C, 0x79, 0xEB, 0x30, 0xD9, 0xA2, 0xC6, 0x0A, 0x31, 0xEA, 0xAC, 0x0B, 0x6A, 0xCA,
-    0x95, 0x36, 0x5E, 0x76, 0x58, 0x89, 0xBB, 0xAA, 0xD2, 0x96, 0xF7, 0x5C, 0xB1, 0xF1, 0xC8, 0xC6,
-    0x8D, 0xBE, 0x5E, 0xBB, 0x64, 0xC5, 0xF7, 0xCF, 0x74, 0x75, 0xE5, 0xDA, 0xCD, 0x5B, 0x5D, 0xEC,
-    0x68, 0x6A, 0xE9, 0xA8, 0x25, 0x97, 0xDC, 0x98, 0x96, 0xFB, 0x0D, 0x5B, 0x6D, 0x8B, 0xA1, 0xE9,
-    0x6D, 0xED, 0xDD, 0x4E, 0xA6, 0x5F, 0xB6, 0x87, 0x5B, 0x99, 0xFD, 0x5C, 0x57, 0x34, 0x5B, 0x1D,
-    0xE9, 0x82, 0xF2, 0x07, 0x4B, 0x27, 0x86, 0x5A, 0x9C, 0xC8, 0x65, 0x57, 0xAE, 0x58, 0x60, 0x35,
-    0x25, 0x07, 0xCC, 0x7B, 0xC9, 0x61, 0x81, 0x2B, 0x96, 0xBD, 0x97, 0x7D, 0xC7, 0x7B, 0x8C, 0x98,
-    0x66, 0xCA, 0x61, 0xA6, 0xB3, 0x6A, 0xDC, 0x1F, 0x62, 0xA8, 0x5F, 0xD2, 0xA1, 0xFA, 0x68, 0x35,
-    0x9E, 0x93, 0x61, 0xEC, 0x55, 0x33, 0xC5, 0x00, 0xAB, 0x77, 0xD7, 0xDD, 0x39, 0x17, 0xFF, 0xFC,
-    0xD0, 0x3D, 0x37, 0xFD, 0x72, 0x94, 0x6C, 0xA6, 0x5F, 0xE6, 0xF9, 0x32, 0xD2, 0xE4, 0xFD, 0x76,
-    0xFA, 0xA5, 0x18, 0xA3, 0x0B, 0x60, 0xC3, 0xF8, 0x9F, 0xE4, 0xBA, 0x3B, 0xFD, 0x53, 0x8C, 0xE3,
-    0x6F, 0x1C, 0xF6, 0xA4, 0xC8, 0xAD, 0x94, 0xE3, 0x5A, 0x67, 0x04, 0x21, 0x76, 0xFD, 0x1F, 0x0D,
-    0x10, 0xB4, 0xDA, 0xBD, 0xD8, 0x59, 0xD7, 0xAB, 0x06, 0x74, 0x6F, 0x88, 0x12, 0x64, 0x9B, 0xDD,
-    0xC5, 0x3E, 0xD3, 0xD5, 0x8A, 0x72, 0x57, 0xBA, 0x9F, 0x61, 0xF9, 0xA2, 0x79, 0x11, 0x9B, 0x2E,
-    0x70, 0xE0, 0xEE, 0xC1, 0xE7, 0xD5, 0x6E, 0xB8, 0x85, 0xE5, 0x9D, 0xA9, 0xFF, 0xA5, 0x91, 0xCF,
-    0xAB, 0x25, 0xE1, 0x17, 0xDD, 0xF0, 0x99, 0xFD, 0x82, 0xCF, 0xAB, 0x4D, 0x61, 0x6F, 0xC0, 0x8A,
-    0xD7, 0x5C, 0x0A, 0xF6, 0x39, 0xAC, 0x6A, 0xC3, 0xCF, 0xD3, 0xB4, 0xCC, 0x61, 0xE0, 0x17, 0xDD,
-    0x44, 0x30, 0x82, 0x82, 0x7B, 0x99, 0xFB, 0x56, 0x15, 0xA7, 0xFE, 0x61, 0x05, 0xD9, 0xF5, 0xD0,
-    0x3F, 0x4D, 0x40, 0x6D, 0x4E, 0x3E, 0x2C, 0xFF, 0xD2, 0x5A, 0x15, 0x27, 0x6E, 0x41, 0x3F, 0x3F,
-    0x6B, 0x75, 0xA1, 0xE2, 0x13, 0xF4, 0xF3, 0x79, 0x0D, 0xE7, 0xB1, 0xC4, 0xE7, 0x0B, 0x5D, 0xE8,
-    0x81, 0xBC, 0x5F, 0x3F, 0xDF, 0xB8, 0x43, 0x91, 0x97, 0x7A, 0x09, 0x88, 0xAD, 0x93, 0x83, 0xD8,
-    0xA6, 0xFE, 0xB2, 0x9B, 0xC4, 0xFC, 0xC7, 0xEE, 0x60, 0xDA, 0x76, 0xA5, 0xFA, 0x02, 0x13, 0xBC,
-    0xCB, 0xFF, 0x41, 0x9D, 0x0E, 0x05, 0xEF, 0x66, 0x0F, 0x54, 0xA5, 0x14, 0xBC, 0xCB, 0x46, 0xB8,
-    0x2E, 0x08, 0x9E, 0xCE, 0xC4, 0x04, 0xEF, 0x1C, 0x6C, 0x9A, 0x82, 0x77, 0xC1, 0xE5, 0xA8, 0x0C,
-    0xF8, 0x43, 0xC1, 0x37, 0xE3, 0xB8, 0x0A, 0x82, 0x97, 0x69, 0x2D, 0x82, 0xE0, 0x37, 0xF4, 0x7E,
-    0x90, 0xB5, 0xEC, 0x22, 0xBD, 0x34, 0x05, 0x9F, 0xF6, 0xFA, 0xC7, 0x20, 0xF8, 0xD9, 0x3A, 0x16,
-    0xFC, 0x32, 0x12, 0x3C, 0xBC, 0x68, 0x10, 0xBC, 0x9B, 0x04, 0x9F, 0xEE, 0x22, 0xC1, 0x43, 0xFB,
-    0x5E, 0xF0, 0xC5, 0x32, 0x12, 0x7C, 0x15, 0x0B, 0xBE, 0xF3, 0xBB, 0x52, 0x04, 0x2F, 0xD3, 0xCD,
-    0x6A, 0x67, 0x82, 0xD7, 0x3D, 0x68, 0x5E, 0x1B, 0x8E, 0xBE, 0x70, 0x5E, 0xF0, 0x72, 0xBD, 0xC6,
-    0x79, 0xC1, 0x37, 0x34, 0x57, 0x08, 0x5E, 0x07, 0xCA, 0xFD, 0xFC, 0x9D, 0xDA, 0x9D, 0x77, 0xA9,
-    0x6E, 0x8B, 0x52, 0x4C, 0x33, 0xEF, 0xE1, 0xEC, 0x12, 0xF9, 0x70, 0xB6, 0xBC, 0xE7, 0x4C, 0x80,
-    0xE9, 0x83, 0x8D, 0x3F, 0x75, 0xE6, 0x30, 0x3A, 0x68, 0xC0, 0xCB, 0xD1, 0x5D, 0xA4, 0x48, 0x83,
-    0x2E, 0xCF, 0xFD, 0x99, 0xDF, 0x4F, 0xA2, 0xE3, 0xAD, 0xEE, 0x15, 0x91, 0x40, 0xFE, 0xBF, 0x87,
-    0x1B, 0x3D, 0xD5, 0x98, 0xD1, 0x8A, 0xC0, 0xDE, 0x44, 0x38, 0x19, 0x55, 0x76, 0xBF, 0x50, 0x0D,
-    0x8A, 0x54, 0x45, 0x72, 0x4B, 0xBD, 0xA0, 0x3A, 0x94, 0x95, 0xF3, 0x3E, 0x5F, 0x85, 0xA2, 0x32,
-    0x95, 0x51, 0xFD, 0xCB, 0x9C, 0xFF, 0xCB, 0x1E, 0x7A, 0x57, 0xF9, 0xA8, 0xBC, 0xC6, 0x10, 0xC9,
-    0xB0, 0x4F, 0x44, 0x50, 0x16, 0x03, 0x54, 0x4C, 0x22, 0x1C, 0x68, 0x46, 0x4E, 0x47, 0x73, 0x6D,
-    0x0D, 0x9C, 0xCE, 0xE8, 0xD2, 0x5E, 0x67, 0xD3, 0xE9, 0xDD, 0x33, 0xFD, 0xF8, 0x77, 0x3A, 0x9D,
-    0x90, 0x78, 0xE1, 0xF9, 0xF2, 0x6E, 0xF7, 0x8A, 0x7C, 0x6A, 0x5E, 0x8B, 0x19, 0x2E, 0x9B, 0x51,
-    0x37, 0xBC, 0xBA, 0xCE, 0xBA, 0x5A, 0xF3, 0x54, 0x0C, 0xEC, 0x5C, 0xE4, 0x21, 0x74, 0x2A, 0x74,
-    0x0F, 0x35, 0xCF, 0x5C, 0xB7, 0x80, 0x00, 0x5A, 0xCE, 0x93, 0x53, 0x6C, 0x6A, 0x86, 0x49, 0x8A,
-    0xD0, 0x22, 0x05, 0x92, 0x80, 0xAD, 0xC9, 0x12, 0xF3, 0xC7, 0xDF, 0x19, 0x2F, 0x70, 0xA6, 0xF6,
-    0x85, 0x77, 0x40, 0x10, 0x58, 0x21, 0x25, 0xB4, 0xF1, 0x67, 0x30, 0xC3, 0x20, 0x2A, 0x8B, 0x1D,
-    0x61, 0x1B, 0xF3, 0xAC, 0xA2, 0x3F, 0x36, 0xEF, 0xAE, 0xEF, 0xE0, 0xD4, 0xF4, 0x1D, 0x2B, 0x4C,
-    0xAD, 0xC2, 0x99, 0xF9, 0x66, 0x09, 0x55, 0x36, 0x65, 0x09, 0x56, 0x03, 0x6D, 0x2C, 0xEF, 0xFD,
-    0x94, 0xE7, 0xD8, 0x06, 0x6A, 0x5D, 0x63, 0xAB, 0x67, 0x9D, 0x9E, 0xD5, 0x59, 0x70, 0xA4, 0x59,
-    0xF0, 0xC2, 0xB3, 0xB0, 0xE7, 0xF2, 0xB0, 0x15, 0x8B, 0xE0, 0x96, 0xCB, 0xDE, 0x9F, 0x55, 0x6D,
-    0xB4, 0x51, 0x79, 0x8D, 0x71, 0x13, 0xCE, 0x6E, 0x45, 0x0E, 0xD9, 0x3B, 0x68, 0xB9, 0x1B, 0x25,
-    0x2F, 0x27, 0x14, 0xBC, 0x6E, 0x42, 0xC8, 0x3D, 0x5B, 0x7B, 0xB1, 0x7B, 0xA9, 0x7B, 0xBB, 0x3D,
-    0x75, 0x07, 0x47, 0x27, 0xB2, 0xA4, 0xC4, 0x13, 0xF9, 0x28, 0x05, 0x2E, 0x22, 0xA1, 0xBC, 0xE7,
-    0x66, 0x50, 0x38, 0xD9, 0xD8, 0x34, 0xB9, 0x22, 0xF5, 0xFA, 0x58, 0x50, 0xE3, 0x05, 0x1C, 0xBC,
-    0xCD, 0xE0, 0x57, 0x38, 0x78, 0x39, 0xEF, 0x4C, 0xCC, 0xC9, 0xD6, 0xA4, 0xAC, 0x97, 0x87, 0x90,
-    0xF5, 0xAA, 0x90, 0xB1, 0x4E, 0x19, 0x22, 0x9E, 0xAD, 0x4D, 0xC2, 0x12, 0x51, 0x29, 0x60, 0xB9,
-    0x0F, 0xE5, 0x1B, 0xE4, 0x56, 0x2C, 0xF6, 0xE5, 0x37, 0xEF, 0xF7, 0xE5, 0xD8, 0xC4, 0x8B, 0x0C,
-    0x46, 0xA6, 0xE3, 0x68, 0x8A, 0x48, 0xD5, 0x1B, 0x1C, 0xDC, 0x69, 0xDD, 0xB3, 0x22, 0x48, 0xE4,
-    0x31, 0x5D, 0x6F, 0x5B, 0x64, 0xC4, 0x02, 0xEF, 0xF9, 0xAB, 0x74, 0xD1, 0x85, 0x06, 0xDB, 0xED,
-    0xA2, 0x1D, 0x59, 0xCE, 0xE1, 0x1A, 0x5B, 0x77, 0xAD, 0xE2, 0x91, 0x09, 0xCB, 0x2A, 0x64, 0xB6,
-    0x33, 0x6C, 0x5B, 0x66, 0x04, 0x9A, 0x10, 0xF4, 0x96, 0x08, 0xC8, 0xAF, 0x72, 0xD4, 0x34, 0x00,
-    0xC9, 0x98, 0xDC, 0x41, 0x8E, 0x0D, 0x6E, 0xD8, 0xE1, 0x86, 0x83, 0x3F, 0x8A, 0x48, 0x44, 0x66,
-    0xD5, 0x4F, 0xBF, 0xAF, 0x72, 0x1A, 0x5F, 0x56, 0xE7, 0xBA, 0x51, 0x51, 0x25, 0x75, 0x06, 0xE9,
-    0xCF, 0x56, 0x93, 0x45, 0x51, 0x2A, 0x94, 0x04, 0x57, 0x8F, 0xE9, 0x76, 0x58, 0x6E, 0x77, 0x8B,
-    0x3B, 0x54, 0xD4, 0x36, 0x0E, 0xF9, 0x28, 0xCB, 0x2C, 0xC5, 0xCD, 0x4B, 0x66, 0x5A, 0xE8, 0xB9,
-    0xEB, 0x98, 0x19, 0x56, 0x7A, 0xA1, 0x46, 0x0E, 0x73, 0x73, 0xDC, 0xCD, 0x06, 0x49, 0x16, 0xCE,
-    0xFF, 0x7E, 0x8B, 0x44, 0x0B, 0x97, 0xFE, 0x74, 0x87, 0x64, 0x0B, 0x26, 0xB5, 0x1A, 0x91, 0x70,
-    0xE9, 0xCD, 0x92, 0x95, 0x98, 0xDF, 0x5D, 0x1A, 0x56, 0xBA, 0x12, 0xEF, 0xBD, 0xA6, 0x9C, 0xD2,
-    0x65, 0xA5, 0xE7, 0x30, 0xAF, 0x6C, 0x21, 0xFE, 0xC4, 0xDC, 0x7F, 0xD6, 0x17, 0x2B, 0x09, 0x2B,
-    0xD0, 0xC8, 0xAC, 0xCF, 0x37, 0xB2, 0xD9, 0x60, 0x67, 0x79, 0x9B, 0x6D, 0x65, 0xBB, 0xC1, 0xD4,
-    0x8A, 0x3A, 0xDD, 0x89, 0x53, 0x82, 0xB5, 0x15, 0x75, 0x32, 0x4A, 0x8E, 0x88, 0xF5, 0x6A, 0x68,
-    0x7D, 0xA5, 0xA7, 0xA9, 0x49, 0x3E, 0xD8, 0xFC, 0x15, 0xD3, 0x5C, 0x4C, 0xF7, 0x9F, 0x6A, 0x4A,
-    0x43, 0xA6, 0x3B, 0xBF, 0x6F, 0xC6, 0x77, 0x85, 0xD9, 0x0E, 0x0C, 0x44, 0xA6, 0x9B, 0x5B, 0x46,
-    0xEF, 0x8E, 0x99, 0x43, 0x60, 0x59, 0x1A, 0xDA, 0x76, 0x5C, 0xD6, 0xE1, 0x78, 0x5B, 0xF5, 0x8A,
-    0x73, 0x64, 0x88, 0xDB, 0x68, 0xE3, 0xC4, 0x7B, 0x27, 0xB2, 0x2C, 0xEF, 0xCB, 0xA6, 0x8D, 0x39,
-    0x9D, 0xAF, 0xA3, 0x4C, 0x6A, 0x15, 0xA5, 0x66, 0xFD, 0x74, 0xC5, 0xE8, 0x92, 0xE3, 0xC7, 0xA7,
-    0x72, 0xAF, 0x67, 0xA7, 0xD3, 0x2E, 0x68, 0x51, 0x03, 0xA2, 0x29, 0x11, 0xB3, 0x31, 0x1D, 0x7E,
-    0x38, 0xA9, 0xD0, 0x4D, 0x1A, 0x74, 0x93, 0x02, 0xDD, 0xA4, 0x3F, 0x17, 0xD4, 0x37, 0x6E, 0x83,
-    0xF6, 0x0E, 0x37, 0x41, 0x79, 0xF0, 0xB8, 0xD4, 0x1D, 0xD3, 0x75, 0xA8, 0x4E, 0x8D, 0xCE, 0x34,
-    0xC7, 0xA4, 0x1D, 0x8A, 0x83, 0xD7, 0xA5, 0xDE, 0x8A, 0x45, 0x50, 0x9B, 0x9A, 0xA3, 0x69, 0xCD,
-    0x12, 0x78, 0x55, 0xDA, 0xBC, 0x0F, 0x3A, 0x53, 0xB9, 0x9B, 0xCA, 0x34, 0x29, 0x36, 0x8D, 0x35,
-    0x93, 0xC2, 0xBA, 0x49, 0x5F, 0xC3, 0xA4, 0xAE, 0x61, 0xD2, 0xD6, 0x2E, 0x28, 0x2B, 0xD9, 0x06,
-    0x5D, 0xA5, 0x93, 0xEC, 0x27, 0x1F, 0x1C, 0x6B, 0x61, 0x36, 0x29, 0x61, 0x72, 0xC8, 0x93, 0x43,
-    0x39, 0xA5, 0x99, 0x66, 0x3A, 0x9B, 0xD4, 0xDB, 0x2C, 0x1E, 0xA2, 0x9F, 0xB3, 0xAE, 0x35, 0x9C,
-    0xDC, 0x73, 0x9F, 0xFD, 0xC3, 0xF4, 0x61, 0x3E, 0xBE, 0x2C, 0x2A, 0x15, 0x6D, 0x5C, 0x1A, 0x0B,
-    0xF1, 0x4F, 0xAA, 0x8B, 0xF1, 0xC5, 0x9C, 0xE2, 0x1F, 0x3E, 0xA0, 0x73, 0x71, 0x43, 0xAF, 0xF9,
-    0xCE, 0x4A, 0x53, 0x14, 0x4D, 0x12, 0xA4, 0xC6, 0x1A, 0xCD, 0xCB, 0xC8, 0xAE, 0xCA, 0x71, 0xA2,
-    0x41, 0x01, 0x1E, 0x87, 0x6F, 0x90, 0xC5, 0xF0, 0x0D, 0x22, 0x6E, 0x7A, 0xA2, 0xAA, 0xB6, 0xBF,
-    0x37, 0xF0, 0x1C, 0x74, 0x3D, 0x7C, 0x43, 0xE7, 0x4B, 0x94, 0xC1, 0x99, 0x7B, 0xDA, 0xD1, 0x3B,
-    0x7C, 0x04, 0x37, 0x54, 0x9B, 0x27, 0xAA, 0xE4, 0xFD, 0x5B, 0x13, 0xAE, 0xF8, 0xA3, 0xCD, 0xBE,
-    0x8C, 0x83, 0x58, 0x27, 0x77, 0x1D, 0xBC, 0x74, 0xBB, 0x27, 0xAF, 0xCE, 0xAB, 0xAB, 0xF3, 0x52,
-    0xB5, 0x84, 0xCC, 0x67, 0x63, 0x21, 0x15, 0x4B, 0x1F, 0xD8, 0xF5, 0x2D, 0x09, 0x73, 0x5D, 0x1B,
-    0xCB, 0x6F, 0x52, 0xAA, 0x5D, 0xA8, 0xB4, 0xB7, 0x55, 0x36, 0x36, 0x36, 0xAB, 0x07, 0x1C, 0xD3,
-    0x5F, 0x73, 0xCC, 0xFE, 0x91, 0x97, 0x2D, 0xFE, 0x92, 0x63, 0x69, 0xEB, 0xB9, 0x6A, 0x9B, 0xF8,
-    0xD8, 0x0C, 0x6A, 0xCD, 0x31, 0x5D, 0x72, 0xA3, 0xCF, 0x98, 0x09, 0xB8, 0xA2, 0xA5, 0x13, 0xB0,
-    0xF2, 0xD7, 0x59, 0x72, 0x84, 0x78, 0xE5, 0x58, 0xFF, 0x76, 0x58, 0x04, 0x1D, 0x8A, 0xD6, 0xB9,
-    0x3A, 0x6A, 0x5D, 0xAB, 0x1B, 0x60, 0x6E, 0x79, 0xC9, 0x35, 0x1B, 0x07, 0x16, 0x9D, 0x97, 0xC4,
-    0xAC, 0x2F, 0x8D, 0x27, 0x72, 0xB5, 0xB5, 0xFC, 0xDF, 0x05, 0xA9, 0xCC, 0x20, 0x93, 0x6C, 0xA5,
-    0x5B, 0x3D, 0x61, 0x5E, 0x4A, 0x69, 0x30, 0x1B, 0x8D, 0x24, 0x71, 0xEE, 0x3A, 0xB2, 0xAF, 0xE1,
-    0xC8, 0x32, 0x4F, 0x26, 0x9D, 0xCC, 0x37, 0x99, 0x6A, 0x32, 0xCB, 0x64, 0x82, 0xC9, 0xDC, 0x92,
-    0x69, 0x25, 0x33, 0x4A, 0x26, 0x93, 0xCC, 0x23, 0x99, 0x42, 0x32, 0x7B, 0x64, 0xE2, 0x88, 0x9C,
-    0x91, 0xE9, 0x22, 0x33, 0x45, 0x26, 0x89, 0xCC, 0x0F, 0x43, 0x6A, 0xF8, 0x1C, 0x2A, 0x9A, 0xA2,
-    0xD6, 0x45, 0xCE, 0xFE, 0x19, 0x55, 0x03, 0x84, 0x9F, 0xA2, 0x6A, 0x61, 0x31, 0xE6, 0x6E, 0xB8,
-    0xD3, 0x59, 0x24, 0x13, 0x19, 0x33, 0x07, 0xA6, 0x30, 0xCC, 0x5F, 0xBA, 0x68, 0x57, 0x0D, 0x93,
-    0xC7, 0x65, 0xC2, 0x42, 0xE5, 0x50, 0x65, 0x54, 0x20, 0x93, 0x14, 0x0B, 0x90, 0xF1, 0x71, 0xE9,
-    0xF3, 0x43, 0xBF, 0xD3, 0xAB, 0x28, 0x70, 0xF2, 0x86, 0x5D, 0x1D, 0xE6, 0x77, 0x38, 0xFE, 0x27,
-    0xB4, 0x89, 0x2B, 0xDF, 0x76, 0xDF, 0x73, 0x77, 0xD3, 0x95, 0xBB, 0xA6, 0xC2, 0xD2, 0xAC, 0x5A,
-    0xEE, 0x5D, 0x6C, 0x4E, 0x95, 0xCC, 0xEA, 0x27, 0x0E, 0x7D, 0x85, 0xBA, 0xE1, 0xA6, 0xD0, 0x9D,
-    0x9B, 0x1B, 0x5E, 0x04, 0x70, 0x63, 0xC1, 0x68, 0x6D, 0x70, 0x0C, 0xFF, 0xD7, 0xFC, 0x8F, 0x34,
-    0xF4, 0xA7, 0xBA, 0xD3, 0xE4, 0xF2, 0x88, 0xF7, 0xF1, 0xA6, 0x10, 0xFD, 0xEB, 0x40, 0x03, 0xF0,
-    0x16, 0x10, 0xAA, 0x92, 0xFE, 0xCC, 0x76, 0x48, 0x88, 0x74, 0x28, 0x9C, 0xE6, 0x88, 0xA6, 0x39,
-    0x82, 0x69, 0x2C, 0x92, 0x0D, 0xEB, 0x92, 0xFF, 0x44, 0xD2, 0x0C, 0x48, 0x33, 0x1C, 0xCD, 0x60,
-    0x34, 0x43, 0xD1, 0x0C, 0x44, 0x33, 0x0C, 0xCD, 0x20, 0x34, 0x43, 0xD0, 0x0C, 0x40, 0x33, 0xFC,
-    0xCC, 0xE0, 0x33, 0x43, 0xCF, 0x0C, 0x3C, 0x33, 0xEC, 0xCC, 0xA0, 0x33, 0x43, 0xCE, 0x0C, 0x38,
-    0xF3, 0xB8, 0x99, 0xC1, 0x66, 0x1E, 0x35, 0xBB, 0x18, 0x2F, 0x9D, 0xDE, 0x80, 0xBE, 0xE0, 0x73,
-    0x58, 0x7E, 0x8A, 0x6B, 0x28, 0x98, 0x06, 0x2C, 0x8D, 0x50, 0x1A, 0x72, 0x34, 0x3A, 0x50, 0x7A,
-    0x49, 0xCD, 0x9B, 0xE1, 0x31, 0x59, 0x37, 0x11, 0x44, 0x23, 0x86, 0xC6, 0xF2, 0x89, 0x08, 0x9A,
-    0x1C, 0xCB, 0xA5, 0x4F, 0xD9, 0x5A, 0xCB, 0xDA, 0x06, 0x0F, 0x9E, 0x19, 0x76, 0x46, 0xE8, 0xCC,
-    0x23, 0x67, 0xDF, 0x95, 0x69, 0x3B, 0xDD, 0xD6, 0xC7, 0xB0, 0xB6, 0x1F, 0xD0, 0xF4, 0xEE, 0x63,
-    0xAE, 0x33, 0x1A, 0x7E, 0x66, 0x11, 0x65, 0xDA, 0x00, 0x00, 0xD6, 0xC6, 0x0D, 0x87, 0x35, 0x4A,
-    0xA7, 0x81, 0x16, 0x7F, 0xD7, 0xC0, 0x35, 0xDA, 0x3C, 0xF3, 0xA6, 0x84, 0x38, 0xA0, 0x98, 0xA3,
-    0x01, 0x6B, 0x86, 0xAB, 0x19, 0xAC, 0x66, 0xA8, 0x9A, 0x81, 0x6A, 0x86, 0xA9, 0x19, 0xA4, 0x66,
-    0x01, 0xD9, 0x00, 0x35, 0xC3, 0xD3, 0x0C, 0x4E, 0x33, 0x34, 0xCD, 0xC0, 0x34, 0xC3, 0xD2, 0x0C,
-    0x4A, 0x33, 0x24, 0xCD, 0x80, 0x34, 0x8F, 0xA3, 0x19, 0x8C, 0xE6, 0x51, 0xB4, 0xDF, 0x71, 0xD7,
-    0xD3, 0x74, 0x15, 0x5E, 0x73, 0x40, 0xD7, 0x08, 0xAE, 0x79, 0x35, 0xAD, 0x7D, 0x1E, 0xBD, 0x34,
-    0x60, 0x8D, 0xB8, 0x5A, 0xC8, 0xA6, 0x65, 0xD2, 0xA5, 0xCF, 0xA3, 0xBB, 0x29, 0x71, 0x87, 0x8F,
-    0x02, 0xA0, 0x46, 0x3C, 0x8D, 0x70, 0x1A, 0xD1, 0x34, 0x82, 0x69, 0x86, 0xA5, 0x19, 0x94, 0x96,
-    0xDE, 0xB9, 0x73, 0x0B, 0x96, 0xA7, 0x08, 0x88, 0x3B, 0x7F, 0xE7, 0x4E, 0x84, 0x94, 0x25, 0xEE,
-    0x19, 0x26, 0x08, 0xBA, 0x3D, 0x65, 0x0A, 0x70, 0x14, 0x25, 0x7F, 0xCB, 0xDB, 0xCB, 0xFB, 0xD1,
-    0xFC, 0xE9, 0x50, 0xE2, 0xCD, 0x9B, 0xD7, 0x45, 0x61, 0x12, 0x7D, 0xD2, 0x71, 0x8C, 0x92, 0x56,
-    0xF1, 0x3C, 0x85, 0x66, 0xE4, 0xAA, 0x94, 0xB5, 0x6E, 0x9D, 0x65, 0xD1, 0xBB, 0x87, 0xA8, 0x12,
-    0x9A, 0x84, 0x22, 0xA1, 0x47, 0xA8, 0x11, 0x5A, 0x84, 0x12, 0xA1, 0x43, 0xA8, 0x10, 0x1A, 0x84,
-    0x02, 0xA1, 0x3F, 0xA8, 0x0F, 0xDA, 0x83, 0xF2, 0xA0, 0x3B, 0xA8, 0x0E, 0x9A, 0x83, 0xE2, 0xA8,
-    0x37, 0x8F, 0x80, 0x5A, 0x8C, 0xA7, 0x07, 0xB7, 0x08, 0x61, 0xF8, 0x67, 0xC6, 0x97, 0xF2, 0x9A,
-    0xD1, 0x1A, 0xB9, 0x44, 0xB1, 0x24, 0x28, 0x65, 0xC3, 0x62, 0x0E, 0x38, 0xE2, 0xA9, 0x53, 0x9E,
-    0x3B, 0x7F, 0xDB, 0xCB, 0x06, 0xC6, 0xFA, 0xA1, 0x25, 0x22, 0x40, 0xDB, 0xD3, 0x85, 0x4C, 0x66,
-    0xB6, 0xC2, 0x56, 0x12, 0xA7, 0x2C, 0x67, 0xBD, 0x04, 0x99, 0x73, 0x5F, 0x8E, 0x06, 0xD3, 0xDE,
-    0x7D, 0x80, 0xC9, 0xE5, 0xD0, 0xE0, 0x3D, 0xE6, 0xDB, 0x15, 0x33, 0x2E, 0xC2, 0xB0, 0xE6, 0x52,
-    0x7F, 0xBF, 0x34, 0x78, 0x4B, 0x12, 0x0D, 0x64, 0x1A, 0xEE, 0x9A, 0x26, 0x0A, 0xA5, 0xCE, 0xBF,
-    0x50, 0xA9, 0x1C, 0x88, 0x66, 0x93, 0xE5, 0x4C, 0x31, 0x18, 0x91, 0xBC, 0xEC, 0x41, 0xF5, 0x8E,
-    0x85, 0x6A, 0x30, 0xF9, 0x72, 0x34, 0x68, 0xE8, 0x96, 0xAF, 0xBA, 0x2C, 0xA6, 0x55, 0x96, 0xD1,
-    0x31, 0x1A, 0x66, 0xED, 0xEF, 0x9D, 0x06, 0x93, 0xF7, 0x42, 0x9A, 0x0A, 0x59, 0x94, 0xCC, 0xDE,
-    0xF4, 0x15, 0x79, 0x5B, 0x72, 0xFB, 0x40, 0xBB, 0x7A, 0xEA, 0x45, 0xF5, 0x90, 0xA9, 0x2E, 0x5D,
-    0x9D, 0xD4, 0x5F, 0x86, 0x06, 0x31, 0xE1, 0xB9, 0xC6, 0x3D, 0x05, 0xCA, 0xD3, 0xB5, 0xD4, 0xD8,
-    0x99, 0x5E, 0x20, 0xB1, 0x64, 0x18, 0x1E, 0x04, 0xBA, 0xD2, 0xC3, 0x45, 0x29, 0x4E, 0x72, 0xCD,
-    0xD3, 0xBB, 0x4F, 0xBA, 0x5A, 0x32, 0x98, 0x4E, 0x45, 0x3B, 0x4A, 0x76, 0x27, 0x2A, 0xA9, 0x7A,
-    0xCD, 0xA1, 0xB4, 0xCC, 0x68, 0x5A, 0x2D, 0x2C, 0x7B, 0xCD, 0x98, 0x14, 0x6F, 0xC8, 0xC7, 0x65,
-    0x14, 0xF2, 0xEF, 0xDC, 0x79, 0x87, 0xA0, 0x87, 0xFA, 0xE9, 0xC4, 0x7E, 0xF3, 0xC8, 0x26, 0x64,
-    0x90, 0x6E, 0xD0, 0xB6, 0xCA, 0xB6, 0xC8, 0x39, 0x45, 0x4E, 0x2B, 0xC8, 0x6D, 0xD6, 0x9F, 0xAD,
-    0x9D, 0xAD, 0xD8, 0xF3, 0x71, 0x60, 0x19, 0x57, 0x7A, 0x2C, 0xF4, 0xAC, 0xCE, 0xB3, 0x32, 0xCF,
-    0xAA, 0x3C, 0x2B, 0xF2, 0xAC, 0xC6, 0xB3, 0x12, 0x8F, 0x15, 0x9E, 0x15, 0x78, 0x56, 0xDF, 0x59,
-    0x79, 0x67, 0xD5, 0x9D, 0x15, 0x77, 0xAC, 0xED, 0xAC, 0xB4, 0xB3, 0xCA, 0xCE, 0x0A, 0x3B, 0xAB,
-    0xEB, 0xAC, 0xAC, 0xB3, 0xAA, 0x8E, 0x45, 0x9D, 0xD5, 0x74, 0xA1, 0xA4, 0xBB, 0x78, 0xF3, 0x06,
-    0xC4, 0xB0, 0x0D, 0xC2, 0x88, 0x13, 0xF7, 0x4D, 0xA6, 0x4D, 0xB0, 0x2D, 0xF1, 0x6E, 0x3D, 0x26,
-    0xEB, 0x6C, 0xB9, 0xB7, 0xF8, 0x27, 0xA1, 0xC6, 0x73, 0xEE, 0xB5, 0x3B, 0xEF, 0xBA, 0xB0, 0x10,
-    0xD1, 0xEE, 0xBB, 0x67, 0xB5, 0x64, 0x2D, 0x7E, 0xF3, 0x15, 0xD6, 0x84, 0xCA, 0x2C, 0xAF, 0xA8,
-    0x9F, 0x4A, 0x7D, 0x6E, 0xF7, 0x45, 0xB0, 0x88, 0x8A, 0xD2, 0x08, 0xC1, 0x8D, 0x37, 0xFD, 0x93,
-    0xA1, 0xCF, 0x78, 0xF6, 0xD3, 0x99, 0x26, 0x84, 0x8F, 0xFA, 0x29, 0x14, 0x9B, 0x67, 0x03, 0x35,
-    0x9C, 0xB9, 0xBF, 0xDD, 0x5A, 0x21, 0x9E, 0xFC, 0xCF, 0x56, 0x7D, 0xB6, 0xEA, 0xEC, 0x97, 0x1B,
-    0x3B, 0x2B, 0x5E, 0x59, 0xAB, 0x03, 0x47, 0x87, 0x5A, 0x06, 0xA8, 0xF9, 0x28, 0xA0, 0xA3, 0x6B,
-    0x7F, 0x96, 0x2E, 0x3D, 0x82, 0x24, 0xC1, 0xC3, 0x60, 0x9D, 0x22, 0xE0, 0x73, 0xD7, 0xAC, 0x9D,
-    0xA6, 0xD0, 0x60, 0xC5, 0x0A, 0x37, 0x59, 0xF9, 0xAE, 0x87, 0x84, 0x00, 0x56, 0xF1, 0x98, 0x9D,
-    0x81, 0x4F, 0xE1, 0xEC, 0x28, 0x40, 0xB7, 0x6B, 0x0F, 0xDC, 0x66, 0x24, 0x2C, 0x1C, 0xC0, 0x4D,
-    0x83, 0x67, 0x81, 0x20, 0x01, 0xAA, 0x05, 0x9C, 0xB8, 0xAE, 0xE6, 0x2A, 0x7B, 0x1B, 0x6B, 0x05,
-    0x1C, 0xFF, 0x64, 0xBC, 0x9D, 0x76, 0x23, 0x1B, 0x7C, 0xAB, 0xD9, 0x38, 0xDA, 0x1E, 0x36, 0xA8,
-    0x20, 0x88, 0x6E, 0x4F, 0x70, 0x52, 0xD4, 0xAA, 0x9A, 0xD3, 0x71, 0x97, 0xAA, 0xD1, 0x94, 0xEB,
-    0xC3, 0xBF, 0xFE, 0x44, 0x55, 0xD4, 0x8A, 0x1A, 0x9A, 0x56, 0x2A, 0xE1, 0xD4, 0x1C, 0x29, 0x7C,
-    0x29, 0xF1, 0x3F, 0x14, 0xB0, 0xF0, 0xB3, 0x22, 0x84, 0x72, 0x21, 0xEF, 0x98, 0xAB, 0xBE, 0x25,
-    0x00, 0xA9, 0xBA, 0xFF, 0x6D, 0x64, 0x55, 0x3A, 0x9E, 0xC0, 0x63, 0x37, 0x6F, 0x5B, 0xD3, 0xAF,
-    0xB5, 0x8E, 0x5F, 0x4B, 0x58, 0x63, 0xA4, 0x33, 0x67, 0x15, 0x56, 0xF5, 0xB3, 0x57, 0x17, 0xEE,
-    0xC7, 0x52, 0x8A, 0x5F, 0x2E, 0x36, 0x07, 0x62, 0x51, 0xE3, 0x26, 0xD3, 0xDA, 0x27, 0x15, 0x29,
-    0x76, 0xD6, 0xD2, 0x3C, 0x77, 0x6A, 0xDE, 0x0C, 0x6F, 0x25, 0x83, 0x5D, 0xB7, 0xC8, 0x94, 0x96,
-    0x22, 0xF3, 0x1F, 0x19, 0x5B, 0xAD, 0x5D, 0x5B, 0xA1, 0x43, 0xEE, 0xFE, 0xD4, 0x5A, 0xD1, 0x1E,
-    0x07, 0x67, 0x8F, 0x97, 0x74, 0x9C, 0x00, 0x82, 0xDB, 0x16, 0x9F, 0x53, 0xAD, 0xD5, 0xC2, 0x25,
-    0x37, 0x6F, 0x2A, 0x74, 0x20, 0xF3, 0x00, 0x90, 0x70, 0xB8, 0x63, 0xC3, 0x6E, 0xE5, 0xFB, 0x76,
-    0x32, 0x5C, 0x3C, 0xFC, 0x44, 0x3F, 0x20, 0xCA, 0xD6, 0x8F, 0x5F, 0x6C, 0xFE, 0x95, 0x40, 0x42,
-    0x8B, 0xBE, 0x97, 0x76, 0x93, 0x34, 0x30, 0xD5, 0xE8, 0xF6, 0x8E, 0x2C, 0xE7, 0x3E, 0x0E, 0xFB,
-    0x0A, 0x3F, 0x6F, 0x41, 0x05, 0xDA, 0xE0, 0x95, 0x17, 0x1F, 0xA0, 0x55, 0xF9, 0xB3, 0xE1, 0x9B,
-    0xC8, 0x5B, 0x3A, 0x04, 0x1E, 0x20, 0xBE, 0xB2, 0x33, 0x1B, 0x62, 0x47, 0x0D, 0x01, 0xA3, 0x8E,
-    0x00, 0x31, 0x08, 0x33, 0x0B, 0xC5, 0x9A, 0xB5, 0xF4, 0x67, 0xE3, 0x1B, 0x06, 0x9A, 0x12, 0xB3,
-    0x32, 0xF0, 0x7E, 0x66, 0x3E, 0xEC, 0x54, 0x2A, 0x54, 0xFD, 0xE6, 0xBA, 0x99, 0x60, 0xCD, 0x99,
-    0xA9, 0x14, 0xBA, 0xF7, 0xD5, 0x66, 0x66, 0x64, 0x2C, 0x95, 0xE8, 0x01, 0xCB, 0xFB, 0xCF, 0xBF,
-    0x3F, 0xDC, 0x96, 0x3B, 0x97, 0x6A, 0xD2, 0x32, 0x81, 0x74, 0x8D, 0x8B, 0xA8, 0xBB, 0x90, 0xB5,
-    0x1F, 0xF6, 0xF8, 0x34, 0xAC, 0xF7, 0xD0, 0x77, 0x05, 0xD3, 0xD6, 0xDD, 0x86, 0xF5, 0xF3, 0xD6,
-    0x5B, 0xA2, 0xAC, 0x6F, 0xD1, 0xC4, 0xAB, 0xCD, 0xD9, 0x6C, 0xFA, 0x49, 0x52, 0xAA, 0x1A, 0x35,
-    0x9A, 0xDA, 0x3D, 0x3E, 0x5E, 0xF5, 0xBF, 0x9B, 0x52, 0xBF, 0x47, 0xA4, 0xE5, 0xB2, 0x7B, 0x33,
-    0x8A, 0x07, 0xF9, 0xFD, 0x05, 0xDB, 0xA6, 0x10, 0x44, 0x36, 0x9C, 0x46, 0x5A, 0xBE, 0x12, 0x56,
-    0xC0, 0x1E, 0x54, 0x18, 0x3E, 0x87, 0x15, 0x00, 0x9E, 0x24, 0x05, 0x88, 0x4A, 0xA9, 0x8C, 0xFD,
-    0x53, 0x1A, 0x52, 0x5E, 0x98, 0x1C, 0xF2, 0xED, 0x43, 0x98, 0x3E, 0x8A, 0xBE, 0x6A, 0x1A, 0xA8,
-    0xF8, 0x6B, 0x85, 0xCE, 0xE0, 0x02, 0x64, 0x37, 0x60, 0x60, 0x0B, 0x23, 0x96, 0xD4, 0xAC, 0xB2,
-    0x8F, 0x89, 0xC4, 0x66, 0xD6, 0xEC, 0x05, 0x06, 0xA0, 0x09, 0xA0, 0x55, 0x02, 0x1B, 0x8E, 0x20,
-    0x5D, 0x89, 0xB9, 0xB0, 0x31, 0x99, 0x6D, 0xC8, 0xA4, 0x99, 0x7D, 0x0A, 0x8C, 0xC5, 0xE5, 0x0F,
-    0xEE, 0x13, 0x14, 0x1B, 0x0C, 0x97, 0x5D, 0xE7, 0xEC, 0xE6, 0x93, 0x91, 0x26, 0x56, 0x91, 0x59,
-    0x2B, 0x9A, 0x76, 0x67, 0x20, 0x25, 0xDA, 0x14, 0xE6, 0xD2, 0x02, 0x5F, 0x6F, 0x49, 0x5C, 0x49,
-    0x1C, 0x22, 0xF0, 0xDA, 0x5C, 0x09, 0x23, 0xE2, 0x7E, 0x13, 0xAE, 0xFB, 0x96, 0xFB, 0x0B, 0x64,
-    0x03, 0x7A, 0x9B, 0x37, 0x31, 0xD7, 0x0A, 0x48, 0x41, 0xB9, 0x9B, 0x0C, 0x58, 0x44, 0x91, 0xDC,
-    0xB9, 0x0D, 0x93, 0x59, 0x4D, 0xBB, 0x85, 0xD1, 0x87, 0xAD, 0x21, 0xAE, 0x62, 0x1E, 0x61, 0xC5,
-    0x40, 0x80, 0xE4, 0x58, 0x8D, 0xCA, 0x34, 0x99, 0xAB, 0x99, 0x22, 0xB4, 0x0F, 0x9A, 0x65, 0x88,
-    0x2D, 0x5D, 0x83, 0xF2, 0x36, 0x10, 0x85, 0x12, 0x6B, 0x36, 0x40, 0x30, 0xD7, 0x68, 0x07, 0xFC,
-    0x37, 0xBA, 0xF5, 0xE8, 0xC0, 0xE6, 0x3B, 0xB4, 0xCA, 0x56, 0x44, 0x86, 0x81, 0x13, 0x2F, 0x34,
-    0xD6, 0x94, 0x3D, 0x38, 0x87, 0x00, 0x65, 0x35, 0xA5, 0x47, 0x9B, 0xAC, 0xF9, 0x58, 0xA5, 0x9C,
-    0x6F, 0xF6, 0x43, 0xF0, 0x57, 0x1A, 0xE8, 0x9D, 0xDF, 0x8A, 0xFA, 0x64, 0xE9, 0x3A, 0xEE, 0xD2,
-    0x99, 0x05, 0x5B, 0x47, 0x69, 0x76, 0x72, 0xDD, 0x4D, 0x3A, 0xF2, 0x2D, 0x23, 0xC6, 0xD3, 0xC1,
-    0xE0, 0x5E, 0x0D, 0x96, 0x00, 0x7B, 0x81, 0xF5, 0x02, 0xEA, 0x05, 0xD2, 0x0B, 0xA0, 0x17, 0x38,
-    0x2F, 0x60, 0x5E, 0xA0, 0xBC, 0x00, 0x79, 0x81, 0xF1, 0x02, 0xE2, 0x05, 0xC2, 0x0B, 0x80, 0x17,
-    0xF8, 0x2E, 0x2C, 0x91, 0xE8, 0x2E, 0x62, 0x22, 0x72, 0x53, 0xF8, 0x8E, 0xAD, 0xEF, 0x76, 0x61,
-    0x07, 0xF0, 0x6C, 0x77, 0x43, 0xB5, 0x00, 0xC6, 0x0D, 0xED, 0x9E, 0x9B, 0x3B, 0xB3, 0xC4, 0x44,
-    0xFC, 0xA0, 0xFB, 0x5A, 0x69, 0x41, 0x69, 0x90, 0x0E, 0x0E, 0x91, 0x64, 0x9E, 0x4C, 0x45, 0xBA,
-    0x1F, 0x81, 0x5E, 0x79, 0x15, 0x5E, 0xAF, 0x7C, 0x65, 0x15, 0x80, 0xFC, 0x7C, 0x9C, 0x60, 0xFC,
-    0xC9, 0x95, 0xCE, 0xC0, 0xD3, 0x13, 0xE7, 0x2C, 0x6B, 0xD3, 0xD4, 0x73, 0xE1, 0x8A, 0xB7, 0x6F,
-    0x8A, 0x03, 0x7F, 0x1E, 0x6E, 0xF3, 0xDB, 0xE6, 0x34, 0x8B, 0x96, 0x19, 0xAC, 0x47, 0xE6, 0x2C,
-    0x5C, 0xCC, 0x27, 0x99, 0x22, 0x3D, 0xD4, 0x98, 0xC2, 0x17, 0xD6, 0x13, 0x4F, 0x93, 0x1D, 0xAF,
-    0x64, 0xB0, 0x63, 0x82, 0xE3, 0x1C, 0x7F, 0x6F, 0x48, 0xE4, 0xAB, 0xD1, 0xC1, 0xE8, 0x55, 0x97,
-    0xD5, 0x4A, 0xFB, 0xD5, 0xC5, 0xF8, 0xF3, 0x11, 0x8C, 0xC3, 0x75, 0x04, 0x32, 0x31, 0x5C, 0x1C,
-    0xE3, 0xFE, 0xD7, 0x20, 0x93, 0x39, 0x1C, 0x26, 0xC3, 0x04, 0x83, 0xC4, 0x3E, 0x19, 0x54, 0x54,
-    0x26, 0x3E, 0x6B, 0x86, 0x63, 0x8E, 0x80, 0x2C, 0x2B, 0x39, 0xD2, 0x64, 0x59, 0x91, 0x91, 0xEF,
-    0x10, 0xE2, 0xB0, 0x65, 0x20, 0x4A, 0xA4, 0xE4, 0xA9, 0xF4, 0x7B, 0xAB, 0x73, 0x4C, 0x96, 0x5F,
-    0x1F, 0x23, 0x9A, 0x2D, 0x93, 0x07, 0x5A, 0x0D, 0x0B, 0xA5, 0x2C, 0x3A, 0x86, 0x7E, 0xDE, 0x1F,
-    0x20, 0x7F, 0x78, 0x13, 0x7E, 0xF9, 0x43, 0x18, 0x6A, 0x07, 0x7E, 0x60, 0xB3, 0x40, 0xFC, 0xC4,
-    0x66, 0x4A, 0xBA, 0x13, 0x0F, 0xA4, 0xFD, 0x68, 0xF2, 0xFD, 0x65, 0xE4, 0xFB, 0xB7, 0x91, 0xEF,
-    0xDF, 0xDF, 0x99, 0xEC, 0xF5, 0x1F, 0x9E, 0x69, 0x29, 0xC6, 0xCC, 0x9B, 0xB3, 0xFC, 0x9B, 0x47,
-    0x86, 0x89, 0x28, 0x58, 0x9C, 0x25, 0x13, 0xED, 0xA6, 0x4E, 0x66, 0xB2, 0x8D, 0x3A, 0x99, 0x9B,
-    0x33, 0x37, 0x99, 0x2E, 0x59, 0x0D, 0x51, 0x71, 0xFC, 0x35, 0x3B, 0xF7, 0x0B, 0x65, 0xE7, 0x7A,
-    0x0E, 0xAE, 0xAF, 0x6E, 0x03, 0x8F, 0xC4, 0x18, 0xB8, 0xCE, 0x4D, 0x04, 0x5C, 0x17, 0xF3, 0x6F,
-    0xF7, 0xE9, 0xB7, 0x31, 0xFB, 0x36, 0x22, 0xDF, 0xC6, 0xDC, 0xDB, 0x98, 0x7A, 0x1B, 0x33, 0x6F,
-    0x63, 0xE2, 0x6D, 0xCC, 0xBB, 0x8D, 0x69, 0xB7, 0x31, 0xEB, 0x36, 0x26, 0xDD, 0xC6, 0x9C, 0xDB,
-    0x98, 0x72, 0x1B, 0x33, 0x6E, 0x63, 0xC2, 0x6D, 0xCC, 0xB7, 0x8D, 0xE9, 0xB6, 0x31, 0xDB, 0x36,
-    0x26, 0xDB, 0x46, 0x5C, 0xDB, 0x98, 0x6A, 0xBB, 0xC7, 0xB4, 0x55, 0xA2, 0xAD, 0x97, 0x61, 0x1B,
-    0xA2, 0x5F, 0x7D, 0x86, 0x3C, 0xF3, 0xD0, 0xB3, 0x89, 0x64, 0xB5, 0xDB, 0x27, 0xD8, 0x4E, 0xFC,
-    0xDA, 0x89, 0x5E, 0x3B, 0xB1, 0x6B, 0x03, 0xB9, 0x76, 0xE2, 0xD6, 0x4E, 0xD4, 0xDA, 0x89, 0x59,
-    0x3B, 0x11, 0x6B, 0x27, 0x5E, 0xED, 0x44, 0xAB, 0x9D, 0x58, 0xB5, 0x13, 0xA9, 0x76, 0xE2, 0xD4,
-    0x4E, 0x94, 0xDA, 0x89, 0x51, 0x3B, 0x11, 0x6A, 0x27, 0x3E, 0xED, 0x44, 0xA7, 0x9D, 0xD8, 0xB4,
-    0x11, 0x99, 0xF6, 0x46, 0xCC, 0xE8, 0x47, 0xF7, 0x66, 0xC2, 0xC0, 0xDA, 0x68, 0xE9, 0x3E, 0xCE,
-    0xF6, 0xD6, 0x99, 0x74, 0x4F, 0x59, 0x31, 0xE7, 0x5E, 0xAB, 0x23, 0x95, 0x1B, 0x13, 0xC7, 0x57,
-    0x31, 0x7C, 0xC9, 0x78, 0x6C, 0x17, 0xDC, 0xD3, 0x5C, 0xCC, 0x69, 0x31, 0x46, 0x3A, 0x0C, 0xEA,
-    0x31, 0xE3, 0xC4, 0x20, 0x77, 0xB2, 0xA4, 0xB7, 0x09, 0xBC, 0x6A, 0x74, 0x27, 0x8C, 0xE2, 0xDB,
-    0x4D, 0x1B, 0x67, 0x9C, 0x28, 0x68, 0x43, 0x90, 0xA8, 0x7A, 0x1B, 0xC3, 0xBB, 0xD4, 0x23, 0x58,
-    0xD7, 0x26, 0x38, 0xF0, 0xC9, 0x7D, 0x5B, 0xA8, 0x1F, 0x37, 0x00, 0xFB, 0x81, 0x6E, 0xAD, 0x71,
-    0x9A, 0x93, 0xCB, 0xA2, 0xC1, 0xC7, 0x5C, 0x8B, 0xF7, 0x38, 0x93, 0x1D, 0x18, 0x5B, 0x02, 0x3E,
-    0x46, 0xFE, 0x37, 0xF6, 0x0C, 0x8F, 0x7F, 0xEC, 0xC5, 0x72, 0x5A, 0x17, 0xC8, 0x2F, 0x83, 0xAD,
-    0xA7, 0x6A, 0x31, 0xB7, 0x0E, 0x98, 0x6B, 0x88, 0x28, 0xF3, 0x3E, 0xB7, 0xBA, 0xCE, 0x15, 0xBF,
-    0x85, 0x04, 0x14, 0x59, 0x4B, 0xC7, 0xC9, 0x2D, 0x9C, 0x3B, 0x1D, 0xC0, 0xC7, 0x4D, 0xAA, 0x5A,
-    0x4B, 0xC6, 0x4D, 0x89, 0x37, 0xE5, 0x1B, 0x51, 0x8A, 0x76, 0x6A, 0x3E, 0x5D, 0xC3, 0x4D, 0xCF,
-    0x1E, 0xB4, 0x88, 0x7B, 0x4A, 0x2C, 0x54, 0x57, 0x5D, 0x6C, 0xA7, 0xC7, 0xB9, 0x74, 0xF4, 0x8F,
-    0x77, 0x61, 0xFA, 0x4B, 0x9B, 0xFB, 0x22, 0x4C, 0x9C, 0xB3, 0x36, 0x1E, 0x97, 0x4E, 0x5B, 0xE7,
-    0x6B, 0xD2, 0x46, 0x52, 0x66, 0x1E, 0x5B, 0x97, 0x95, 0xDB, 0xD3, 0x15, 0x73, 0x0B, 0x93, 0x0D,
-    0xC9, 0xDA, 0xA9, 0x05, 0x47, 0x04, 0x04, 0xA6, 0x6A, 0xEA, 0xB1, 0x67, 0x4C, 0xBC, 0x56, 0xCC,
-    0x3B, 0x0B, 0x5B, 0x61, 0x61, 0xF5, 0xBD, 0xE7, 0xB3, 0x79, 0xF8, 0xB3, 0xDA, 0x1F, 0xDB, 0xD3,
-    0x6C, 0x6F, 0x73, 0xAF, 0xAF, 0x5B, 0xFC, 0xEA, 0xA6, 0x67, 0x4D, 0xBE, 0xD5, 0xEE, 0xF3, 0xF3,
-    0x02, 0x27, 0x32, 0x0D, 0xF1, 0xED, 0xD8, 0x9F, 0xBC, 0xE8, 0x4F, 0x9E, 0x79, 0x24, 0xFC, 0x4B,
-    0x56, 0x6A, 0xE0, 0xA4, 0x06, 0x46, 0x6A, 0xC4, 0x47, 0x0D, 0x6C, 0xD4, 0xC0, 0x45, 0x0D, 0x4C,
-    0x54, 0xA3, 0x11, 0x07, 0x0E, 0x71, 0x20, 0x10, 0x7B, 0x06, 0x6A, 0xE0, 0x9F, 0x06, 0xF6, 0x69,
-    0xE0, 0x9E, 0x06, 0xE6, 0x69, 0xE0, 0x9D, 0x06, 0xD6, 0x69, 0xE0, 0x9C, 0x06, 0xC6, 0x69, 0xE0,
-    0x9B, 0x06, 0xB6, 0x69, 0xE0, 0x9A, 0x06, 0xA6, 0x69, 0xE0, 0x99, 0x06, 0x96, 0x69, 0x20, 0x04,
-    0x07, 0x36, 0xB0, 0xB6, 0x39, 0x22, 0x91, 0x33, 0xE5, 0x63, 0xE7, 0x82, 0xE9, 0xAE, 0x04, 0x9D,
-    0x53, 0x3E, 0x8A, 0x80, 0x2A, 0x19, 0x9E, 0xA4, 0x77, 0x92, 0xDB, 0x49, 0x62, 0x27, 0x59, 0x9D,
-    0xA4, 0x74, 0x92, 0xCF, 0x49, 0x32, 0xA7, 0x71, 0x94, 0xD6, 0x8F, 0xA0, 0x92, 0x63, 0x8F, 0xED,
-    0x51, 0x60, 0xAA, 0x9A, 0x74, 0xCD, 0x1A, 0x5C, 0xCD, 0xBA, 0xB2, 0xAE, 0x71, 0x48, 0x71, 0x6D,
-    0x6B, 0x9B, 0x83, 0x37, 0x8B, 0x39, 0x8E, 0x1A, 0x14, 0x7E, 0x2F, 0x35, 0x74, 0xBD, 0x27, 0x1F,
-    0x1A, 0x0C, 0xCF, 0x77, 0x80, 0x4C, 0x91, 0x2E, 0x0A, 0x96, 0x2D, 0x73, 0xDF, 0xA9, 0x8C, 0xE0,
-    0xC5, 0xEA, 0x61, 0xAD, 0x9A, 0x5F, 0x12, 0xF3, 0xFF, 0x01, 0xAE, 0x39, 0xA7, 0x57, 0xBF, 0xC2,
-    0xA9, 0x6C, 0xD8, 0xA3, 0xC1, 0x73, 0x01, 0xA2, 0xE5, 0x47, 0xF7, 0x68, 0x46, 0xF6, 0x68, 0x56,
-    0xEC, 0xD1, 0x2C, 0xD8, 0x9C, 0xA1, 0xFB, 0x28, 0xB9, 0x94, 0x33, 0xCD, 0x99, 0x6F, 0x45, 0xCD,
-    0x19, 0xD3, 0x18, 0x8B, 0x26, 0xCE, 0x80, 0x61, 0x85, 0x51, 0xE5, 0x08, 0x2F, 0xFE, 0x62, 0x7A,
-    0x30, 0xEE, 0xDA, 0x9F, 0x83, 0x2D, 0x0E, 0xC3, 0xBA, 0x0B, 0xD1, 0xBC, 0x81, 0xE3, 0xB5, 0x4B,
-    0xB0, 0x27, 0xEC, 0xAD, 0xE4, 0x9D, 0x27, 0xAF, 0x75, 0xE3, 0xD2, 0xD0, 0x7E, 0x9B, 0x9E, 0xF5,
-    0x2A, 0x03, 0x61, 0xB9, 0xAA, 0xCF, 0x6C, 0xEF, 0x74, 0xE9, 0xBE, 0x6E, 0xEC, 0x7C, 0x9E, 0xC6,
-    0x8E, 0xDF, 0xF4, 0x81, 0xDD, 0xEF, 0x69, 0xCE, 0x65, 0x98, 0xB6, 0xBF, 0xF3, 0x43, 0x1A, 0x9B,
-    0x5F, 0xC1, 0xC6, 0x8F, 0xE5, 0xA1, 0x96, 0xFF, 0x59, 0x58, 0xD9, 0xC5, 0xBD, 0xDB, 0xBC, 0xB5,
-    0xC0, 0x60, 0xFE, 0x65, 0x86, 0xA7, 0x10, 0x87, 0x82, 0x2A, 0xD9, 0x3D, 0x04, 0xD4, 0xCA, 0x46,
-    0x80, 0x5A, 0x79, 0x07, 0x50, 0xEB, 0x79, 0x82, 0x5A, 0x57, 0x08, 0x6A, 0xAD, 0x01, 0x6A, 0xA5,
-    0x4B, 0x80, 0x5A, 0xB3, 0x1E, 0xA0, 0x56, 0x41, 0x50, 0xEB, 0x2A, 0x41, 0xAD, 0xBB, 0x00, 0xB5,
-    0x92, 0x15, 0x40, 0xAD, 0xAC, 0x07, 0xA8, 0x85, 0xBA, 0xAE, 0xEA, 0x9F, 0x27, 0xA8, 0x75, 0x85,
-    0xA0, 0x16, 0x58, 0x84, 0xF3, 0x7F, 0x59, 0x02, 0xD4, 0xFA, 0x35, 0x80, 0x90, 0x82, 0xB9, 0xFC,
-    0x6C, 0x17, 0x83, 0x5A, 0xC9, 0x08, 0x50, 0x2B, 0xFB, 0x77, 0x26, 0x0A, 0x35, 0x28, 0xA7, 0xDF,
-    0x98, 0x36, 0xD3, 0x7B, 0x53, 0x72, 0x6C, 0xCF, 0x26, 0x62, 0xC5, 0x68, 0x35, 0x24, 0xAB, 0x58,
-    0xCB, 0x1A, 0x79, 0x92, 0x1B, 0x05, 0x6A, 0x9E, 0xBF, 0x51, 0x52, 0xA8, 0x3A, 0x81, 0x12, 0xEB,
-    0x6A, 0x94, 0x28, 0xE1, 0x40, 0x39, 0x14, 0x43, 0xBC, 0x3C, 0xEA, 0xDC, 0xDE, 0x50, 0xCF, 0x20,
-    0x01, 0x4F, 0xB4, 0x9B, 0xF5, 0x7A, 0x2C, 0x6A, 0xC5, 0xA9, 0x2E, 0xCB, 0xBC, 0xCA, 0xE5, 0x1B,
-    0xA2, 0xE8, 0xF2, 0x57, 0x2B, 0x65, 0xA7, 0xFE, 0x47, 0x2F, 0x77, 0x2F, 0xEE, 0xD7, 0xEA, 0x37,
-    0x06, 0x84, 0x00, 0x10, 0x54, 0xC5, 0x64, 0x35, 0xCB, 0x18, 0xDF, 0x97, 0x9B, 0x14, 0x87, 0xAA,
-    0xE1, 0xCB, 0x40, 0x6A, 0xDE, 0xF0, 0x33, 0x7F, 0x8F, 0xCA, 0x1B, 0xED, 0x99, 0xAD, 0xEF, 0x13,
-    0xEE, 0xE8, 0xE1, 0xCE, 0x67, 0xCB, 0x39, 0xE7, 0x4F, 0x54, 0xE6, 0x42, 0x52, 0x3F, 0x4D, 0xBC,
-    0x8A, 0xF7, 0x94, 0x22, 0xE5, 0x3A, 0x4C, 0xA4, 0x6A, 0x71, 0xAF, 0xBE, 0x81, 0xC9, 0xC2, 0xD5,
-    0xAF, 0x91, 0x19, 0x5C, 0x88, 0x36, 0xE7, 0x93, 0xE1, 0xBA, 0x0F, 0x36, 0x46, 0x7E, 0x62, 0xD5,
-    0x01, 0x38, 0x21, 0x59, 0x21, 0xFE, 0x64, 0x7D, 0xB2, 0x64, 0xB5, 0x57, 0x3F, 0x1D, 0x4C, 0x89,
-    0x83, 0x13, 0x3A, 0x6D, 0xDD, 0x4B, 0x1D, 0x56, 0xBA, 0xD6, 0x28, 0x24, 0x01, 0x76, 0x85, 0x0D,
-    0xF5, 0x44, 0xE9, 0x26, 0x79, 0x97, 0x5B, 0x69, 0x60, 0x8E, 0xDC, 0x50, 0x62, 0x25, 0x2C, 0x4B,
-    0x94, 0xC0, 0x9E, 0xD7, 0x8A, 0x78, 0xEE, 0x85, 0xE4, 0xE1, 0x21, 0xB4, 0x65, 0xFC, 0x6C, 0xC1,
-    0x56, 0xB7, 0xB2, 0xA1, 0xA4, 0x4F, 0x2D, 0x58, 0xB1, 0x95, 0xAC, 0x1B, 0x9E, 0x3F, 0x55, 0xA9,
-    0x05, 0xAC, 0xD7, 0x17, 0x6A, 0x53, 0x65, 0x36, 0x10, 0x69, 0xDE, 0x4D, 0x61, 0xA8, 0x38, 0x3D,
-    0x2C, 0xE3, 0xC8, 0x3F, 0xEF, 0x43, 0xA5, 0x70, 0x1B, 0x5A, 0x52, 0x83, 0x92, 0x39, 0xA8, 0x79,
-    0x75, 0xD4, 0xE0, 0x88, 0x38, 0xC6, 0xC7, 0x2D, 0xED, 0x61, 0x4B, 0x5B, 0x3A, 0x16, 0x8E, 0x65,
-    0x63, 0xD1, 0x58, 0x32, 0x17, 0x3C, 0x2D, 0xD7, 0x22, 0x9B, 0xDC, 0x17, 0x31, 0x4D, 0x02, 0x9A,
-    0x3B, 0xC5, 0x07, 0xAB, 0x2D, 0x88, 0x21, 0x82, 0x69, 0xF8, 0x42, 0xEC, 0x42, 0xE0, 0x7A, 0xDB,
-    0x3F, 0x75, 0xB1, 0xC7, 0x36, 0x9B, 0x6B, 0x98, 0x42, 0x8C, 0x42, 0x80, 0x62, 0x74, 0x32, 0x38,
-    0x9A, 0x06, 0x24, 0x16, 0xC4, 0xAA, 0x98, 0x9B, 0x05, 0x36, 0xA4, 0x8C, 0xD2, 0x33, 0x9B, 0xE5,
-    0xAB, 0xAC, 0x03, 0x0B, 0x3F, 0x15, 0x72, 0xE0, 0x4E, 0x1F, 0x98, 0xD5, 0x2C, 0xA6, 0x97, 0xBD,
-    0x12, 0x2D, 0xF1, 0xB1, 0x8A, 0x1F, 0x0E, 0x16, 0xFE, 0x15, 0x61, 0xA5, 0xE8, 0xDF, 0x42, 0x48,
-    0xA9, 0x8D, 0xC5, 0x7B, 0xE1, 0x94, 0x97, 0x2A, 0x4C, 0xF0, 0xB5, 0x01, 0x17, 0x4D, 0xEB, 0x53,
-    0x89, 0x2E, 0x3C, 0xCD, 0x33, 0x78, 0x51, 0x43, 0xD0, 0xFC, 0x76, 0x01, 0xFF, 0x15, 0x03, 0x84,
-    0xFD, 0xF9, 0xD8, 0xE7, 0x74, 0x58, 0x7A, 0xB1, 0xCE, 0xFB, 0x40, 0x4E, 0x0C, 0x6B, 0x40, 0x76,
-    0x38, 0xD6, 0x06, 0x19, 0x00, 0x2C, 0xB8, 0x93, 0xBE, 0xE3, 0x9A, 0x97, 0x25, 0x9C, 0xF6, 0x12,
-    0xF6, 0x97, 0x95, 0x9A, 0x6F, 0xEF, 0x8E, 0x45, 0xF2, 0xCF, 0x46, 0x93, 0xFD, 0x42, 0x9E, 0xDC,
-    0x49, 0x4F, 0xBC, 0xA7, 0xEB, 0x74, 0xFD, 0x6A, 0xA3, 0x74, 0x73, 0xF5, 0xA9, 0xEA, 0xF0, 0xC9,
-    0x10, 0x93, 0x06, 0x93, 0x44, 0x4E, 0xB2, 0x41, 0x5B, 0xD8, 0xA5, 0xFB, 0xA6, 0xCB, 0x35, 0xB7,
-    0xFB, 0x82, 0x9F, 0x6D, 0x7A, 0x8D, 0x25, 0x4B, 0xF5, 0x13, 0x3A, 0x56, 0x9F, 0xA3, 0xA0, 0x54,
-    0x49, 0xD7, 0x6C, 0x7B, 0x1C, 0x93, 0xFB, 0xF8, 0x8C, 0x7B, 0xCA, 0x9A, 0xA8, 0x7C, 0xC4, 0x29,
-    0xDA, 0x51, 0x3F, 0xF1, 0x3B, 0x2A, 0xD3, 0x1D, 0xE5, 0xF6, 0x76, 0xD4, 0xE3, 0x6A, 0x90, 0x1A,
-    0x08, 0xF0, 0xB0, 0x9C, 0x24, 0x0D, 0x39, 0xC9, 0xE2, 0x4C, 0x4E, 0xF2, 0x34, 0x3C, 0x6D, 0xF6,
-    0xB9, 0xBD, 0xED, 0xE3, 0xD2, 0x02, 0xF3, 0x59, 0x4B, 0x68, 0xFD, 0x2E, 0x81, 0x89, 0x78, 0x23,
-    0x31, 0x33, 0xD9, 0x77, 0xBD, 0x71, 0x77, 0x50, 0x43, 0x1F, 0x1E, 0x52, 0xEB, 0x2F, 0x61, 0xE9,
-    0x6D, 0x3A, 0x84, 0xEF, 0x03, 0x51, 0x17, 0x63, 0xF0, 0xA5, 0xFA, 0x84, 0x01, 0x7F, 0x48, 0x58,
-    0x26, 0xA5, 0x36, 0x6C, 0x7D, 0x6F, 0x4A, 0xC5, 0x23, 0x33, 0x51, 0x85, 0xCC, 0x86, 0xF7, 0x07,
-    0x80, 0xEE, 0xB8, 0x72, 0xB1, 0x2A, 0x39, 0x98, 0xEB, 0x01, 0xFA, 0x50, 0x82, 0xC8, 0x22, 0x8B,
-    0xE4, 0x97, 0x92, 0xF4, 0xF0, 0x5C, 0x55, 0x9B, 0x18, 0xE0, 0x3B, 0xD2, 0x0D, 0x01, 0x3F, 0x45,
-    0x2B, 0xEE, 0xF5, 0xF1, 0xBF, 0xDC, 0x7C, 0xA3, 0xA1, 0xCF, 0x1D, 0x6C, 0xA5, 0xFE, 0x7C, 0xA1,
-    0xD6, 0xAF, 0x5B, 0xD2, 0x66, 0x98, 0xBA, 0x96, 0x7B, 0x19, 0xC0, 0xC4, 0x8D, 0xD6, 0x9D, 0x57,
-    0xD5, 0x7B, 0x4C, 0x80, 0xE4, 0x0D, 0x57, 0x0D, 0xB3, 0xD1, 0x5D, 0xDA, 0x69, 0x7B, 0x69, 0xF7,
-    0x92, 0xC8, 0x74, 0xAB, 0xA2, 0xD9, 0x49, 0x59, 0x88, 0xCE, 0x00, 0xBE, 0x61, 0x89, 0x5F, 0x3C,
-    0xF0, 0x30, 0x97, 0xB9, 0xF4, 0xED, 0x5B, 0x1C, 0x50, 0xCF, 0xCF, 0x83, 0xB7, 0x84, 0x23, 0xAA,
-    0x7C, 0xD6, 0xCD, 0xC7, 0xF3, 0x9B, 0xC1, 0xBA, 0x4F, 0x35, 0x10, 0x09, 0xD4, 0xC1, 0xB3, 0x1A,
-    0xE8, 0xE3, 0x7E, 0xE6, 0xF1, 0x95, 0x15, 0xBF, 0xF8, 0xFA, 0xD6, 0x68, 0x1B, 0xC5, 0x03, 0xA0,
-    0xB7, 0x47, 0x0A, 0x97, 0xBE, 0xA8, 0x76, 0xF6, 0xD8, 0x25, 0x0F, 0x5B, 0x70, 0xB4, 0x06, 0x67,
-    0xF6, 0x60, 0x16, 0xA1, 0x6F, 0x61, 0x85, 0xDE, 0x5E, 0x25, 0xD6, 0xF9, 0xCC, 0xD3, 0xF8, 0x4C,
-    0x5E, 0xFA, 0xCE, 0x0B, 0xAD, 0xFA, 0x16, 0xF9, 0xD3, 0x4E, 0x83, 0x6E, 0x95, 0x2A, 0xC0, 0xD0,
-    0x1E, 0xEB, 0x64, 0xB4, 0xE8, 0xFA, 0xB2, 0x1E, 0xE1, 0xF2, 0x15, 0x28, 0xD1, 0x41, 0x4D, 0x1D,
-    0x00, 0x0C, 0x95, 0x84, 0xF4, 0x80, 0x18, 0xC7, 0x39, 0xC4, 0xD3, 0xF1, 0x7C, 0x16, 0xDC, 0x80,
-    0x3A, 0x69, 0xB8, 0x00, 0x38, 0x80, 0x5C, 0xB7, 0xFF, 0xE9, 0x78, 0xF8, 0x58, 0x1F, 0x85, 0x64,
-    0xE4, 0xD5, 0x32, 0x7A, 0xBC, 0xAF, 0x9D, 0xA7, 0xB5, 0x6E, 0x3F, 0xFD, 0x96, 0x07, 0x7C, 0xD3,
-    0x46, 0x85, 0xFA, 0x77, 0x8E, 0xEE, 0xE3, 0xB3, 0x1E, 0xCC, 0x23, 0xA2, 0x6A, 0x8F, 0xBF, 0xAF,
-    0x27, 0x86, 0xE8, 0x8C, 0x9C, 0x23, 0xC2, 0x9E, 0x73, 0xB2, 0x9C, 0xF8, 0xF0, 0x6E, 0xB7, 0x8C,
-    0xC8, 0x91, 0x6B, 0xF7, 0x6D, 0xA0, 0xCC, 0x6F, 0x62, 0x47, 0xDF, 0xC3, 0x96, 0x26, 0xE3, 0xA1,
-    0x81, 0x16, 0x94, 0x14, 0x20, 0x5A, 0x19, 0x5E, 0xA7, 0x9C, 0x96, 0xEE, 0xF4, 0x37, 0xED, 0x1D,
-    0xDC, 0x9A, 0x68, 0x2D, 0x44, 0xE1, 0x09, 0xA0, 0xF2, 0xDB, 0x49, 0x3E, 0x88, 0xF7, 0xEF, 0x4D,
-    0x38, 0x3A, 0xD5, 0xD1, 0xCF, 0x46, 0x85, 0x20, 0x9B, 0x3A, 0xD9, 0xA8, 0x70, 0xC4, 0x13, 0xAA,
-    0x99, 0x3C, 0x63, 0x25, 0x1A, 0x01, 0x85, 0x8D, 0xAF, 0x0C, 0x33, 0x2C, 0xA3, 0x81, 0xB3, 0xD9,
-    0xD0, 0x01, 0xBD, 0xA8, 0xF8, 0xEE, 0x35, 0x7D, 0x44, 0xB4, 0xD2, 0x56, 0x97, 0x54, 0x47, 0xA2,
-    0x89, 0x93, 0xC3, 0xDE, 0xD8, 0x56, 0xD3, 0xD7, 0x34, 0xBE, 0xE0, 0xEC, 0xB9, 0x49, 0xF4, 0x7B,
-    0x00, 0xF5, 0x01, 0xFF, 0xC7, 0xA3, 0x6C, 0xB0, 0xE6, 0x1C, 0x04, 0x91, 0x82, 0xC7, 0xC5, 0x6C,
-    0x9D, 0x6C, 0x4B, 0x15, 0xC0, 0xF1, 0x65, 0x15, 0xC0, 0xD1, 0x15, 0xB5, 0xC6, 0x37, 0x5E, 0xD2,
-    0xCD, 0xF1, 0xE3, 0xCF, 0xF8, 0xB6, 0x81, 0x3A, 0xFA, 0xB6, 0x81, 0x47, 0x7C, 0xBD, 0x41, 0xCC,
-    0x42, 0xFA, 0xCC, 0xAF, 0x37, 0x80, 0x56, 0xCE, 0x8F, 0x03, 0xBF, 0x43, 0x61, 0xFF, 0x59, 0x29,
-    0xF6, 0xFC, 0xE6, 0x91, 0x9C, 0x8F, 0xF8, 0x25, 0x30, 0xB8, 0xD5, 0x22, 0x7E, 0xEB, 0x0F, 0xF9,
-    0x67, 0x5D, 0x74, 0xC6, 0x66, 0xAE, 0x3E, 0x04, 0x3C, 0x53, 0x0D, 0x86, 0xAC, 0xBE, 0x26, 0x97,
-    0xC9, 0xF7, 0x9B, 0x07, 0x22, 0xC3, 0xDA, 0xC5, 0x09, 0x24, 0x15, 0x2B, 0x10, 0xD4, 0x45, 0x63,
-    0xDC, 0x9C, 0x63, 0xD6, 0xA4, 0x14, 0x1A, 0x33, 0xD9, 0xF4, 0xB6, 0x15, 0x10, 0x3D, 0x9F, 0x15,
-    0x7C, 0xDE, 0xD4, 0x1F, 0x97, 0x46, 0x39, 0x34, 0xD3, 0x3D, 0x90, 0x15, 0x65, 0x3B, 0x5D, 0xA4,
-    0x58, 0x9C, 0xA8, 0xB3, 0x40, 0x87, 0xBD, 0x00, 0xA2, 0x9F, 0xF7, 0xA7, 0x84, 0x52, 0xAC, 0xA6,
-    0xB2, 0x1B, 0x26, 0x3E, 0xE3, 0x97, 0x5B, 0x21, 0x02, 0x23, 0x62, 0x0F, 0xAF, 0xCA, 0x1B, 0x93,
-    0x5B, 0xF6, 0x04, 0xFE, 0x18, 0x7D, 0x9B, 0x08, 0xF9, 0x44, 0x76, 0x6C, 0xA7, 0xBF, 0xB3, 0xE1,
-    0x13, 0x11, 0xFE, 0x0A, 0xDC, 0xB0, 0x21, 0x55, 0x40, 0x5F, 0x9C, 0x83, 0x28, 0xA5, 0x26, 0x78,
-    0x40, 0xF2, 0x20, 0x30, 0x8A, 0xBF, 0xF3, 0x39, 0xE3, 0x0D, 0xDC, 0x5C, 0x92, 0xC0, 0x93, 0x43,
-    0x6D, 0xE2, 0x69, 0x10, 0xAF, 0x45, 0x54, 0x95, 0xAA, 0xB9, 0x64, 0x7B, 0x31, 0x7C, 0xAF, 0x1E,
-    0x57, 0xA0, 0xB7, 0xCF, 0x55, 0xA8, 0x9D, 0x96, 0x59, 0x27, 0x83, 0x4A, 0x0D, 0x66, 0x33, 0xEF,
-    0x43, 0xD0, 0x5C, 0x3E, 0xA2, 0xCC, 0x1B, 0xFD, 0x3C, 0x95, 0x12, 0x8D, 0x92, 0xF2, 0xD2, 0xA0,
-    0x13, 0x5B, 0xD8, 0xFE, 0x08, 0x94, 0xA6, 0xE7, 0xFC, 0x97, 0x0E, 0x16, 0xB5, 0xA5, 0x38, 0xF9,
-    0x47, 0xD6, 0xDE, 0xC8, 0x1E, 0xF8, 0x66, 0x4D, 0x30, 0xA6, 0x71, 0x8A, 0xFA, 0x7B, 0x49, 0x66,
-    0x1B, 0x2A, 0xD8, 0xA9, 0x8A, 0x0D, 0x95, 0x6C, 0xA8, 0x66, 0x43, 0x45, 0xDB, 0x9D, 0x62, 0x28,
-    0x0C, 0x51, 0x75, 0x1B, 0x2A, 0xDC, 0x74, 0x1B, 0x33, 0x13, 0x02, 0x2F, 0x21, 0xF3, 0xFD, 0x18,
-    0x72, 0x12, 0x6C, 0x0F, 0x84, 0xCA, 0xB7, 0x38, 0x7D, 0xB2, 0xB4, 0xF0, 0x64, 0x4C, 0x84, 0xC0,
-    0x43, 0x98, 0x9A, 0xF9, 0xA1, 0x48, 0xE5, 0x4C, 0x6B, 0xDB, 0x8F, 0xBE, 0x3A, 0x4E, 0x7C, 0x85,
-    0x1C, 0xAA, 0x64, 0xFF, 0x7C, 0x0F, 0xD9, 0x93, 0xFC, 0xB6, 0x4D, 0x12, 0xED, 0x49, 0xB3, 0x67,
-    0xFF, 0x70, 0xB6, 0xFD, 0xFF, 0xB3, 0xCA, 0xF5, 0xBB, 0x2C, 0x2A, 0x6D, 0x15, 0xBB, 0x06, 0xAD,
-    0xE2, 0xEE, 0xEA, 0x63, 0x6E, 0x15, 0xFF, 0x1F, 0xA5, 0x56, 0x3D, 0x6C, 0x1C, 0xC7, 0x19, 0x7D,
-    0xBB, 0x4B, 0x6A, 0x45, 0x6E, 0x74, 0xC3, 0x82, 0x34, 0x18, 0x49, 0xD4, 0xA6, 0x60, 0x21, 0x08,
-    0xBC, 0xDB, 0x86, 0xC5, 0x15, 0x77, 0xB7, 0x13, 0xA8, 0x30, 0x82, 0x20, 0xC0, 0x15, 0x3C, 0xBB,
-    0x10, 0x90, 0xA8, 0x60, 0x11, 0x30, 0x30, 0x28, 0x03, 0x2C, 0x36, 0xC1, 0x51, 0x3B, 0x4E, 0x19,
-    0x20, 0x00, 0x0B, 0xA7, 0x0A, 0x10, 0xB0, 0x50, 0x21, 0x5C, 0x80, 0xF8, 0x02, 0xB0, 0xA0, 0x03,
-    0xD9, 0x37, 0x40, 0x8A, 0xB4, 0xAB, 0x20, 0x81, 0x4B, 0x2F, 0x10, 0x75, 0x29, 0xB2, 0x81, 0xD7,
-    0xC1, 0xD9, 0xD9, 0xBB, 0xF1, 0x9B, 0xBD, 0xA3, 0x15, 0xC1, 0x36, 0x52, 0x78, 0x6E, 0x6F, 0x76,
-    0x77, 0xE6, 0xDB, 0x6F, 0xBE, 0x9F, 0xF7, 0xBD, 0x99, 0x23, 0x19, 0x6B, 0x91, 0xF9, 0xB9, 0x53,
-    0x20, 0x01, 0x30, 0x82, 0x3B, 0x83, 0x5F, 0x42, 0x64, 0x88, 0x80, 0x4B, 0xD4, 0xED, 0x9E, 0xC2,
-    0x44, 0xBB, 0x26, 0xF7, 0x3F, 0x29, 0x42, 0x35, 0x3D, 0x45, 0x67, 0x03, 0x2B, 0x38, 0x04, 0x02,
-    0x83, 0x71, 0x64, 0x9E, 0xE7, 0x49, 0x68, 0xF4, 0xD8, 0x33, 0x94, 0xDC, 0x40, 0x6C, 0xE6, 0xA9,
-    0x99, 0x6D, 0x0D, 0x0E, 0x62, 0x63, 0xEC, 0x0B, 0xF8, 0x88, 0x47, 0xD8, 0x4B, 0x70, 0xD9, 0x7B,
-    0xB3, 0x88, 0x4C, 0xC6, 0x8F, 0x28, 0xB6, 0x8A, 0x58, 0xA5, 0x3A, 0x55, 0x31, 0x3F, 0x0A, 0x31,
-    0x8C, 0xD5, 0x3C, 0x55, 0xF3, 0x18, 0xB3, 0x15, 0x6C, 0xAC, 0x3F, 0x41, 0x6A, 0x70, 0x11, 0x49,
-    0x84, 0x12, 0x31, 0xD6, 0x67, 0x10, 0x67, 0x10, 0x40, 0x83, 0xA2, 0x87, 0x5C, 0x53, 0x46, 0x0F,
-    0xB2, 0x8E, 0x93, 0x77, 0x50, 0xB0, 0x8F, 0x5F, 0xCF, 0x84, 0x51, 0xCE, 0x53, 0x1A, 0xF9, 0xCE,
-    0x08, 0x93, 0xFB, 0x95, 0x33, 0x0B, 0x0A, 0xAF, 0x08, 0xB5, 0xD0, 0x3D, 0xB4, 0x50, 0x72, 0x29,
-    0x89, 0x73, 0xDC, 0x1D, 0x3A, 0x65, 0x1C, 0xE4, 0xE1, 0x44, 0x89, 0x39, 0x82, 0x0A, 0x4E, 0x1F,
-    0x6B, 0x61, 0xAB, 0xDB, 0xE9, 0xEC, 0xAE, 0x39, 0x2A, 0xF4, 0x74, 0xCB, 0xD3, 0x5D, 0x5F, 0x77,
-    0x02, 0xD5, 0x11, 0x72, 0x77, 0x1D, 0xF7, 0xBE, 0xFF, 0x14, 0x91, 0x9E, 0x43, 0xE4, 0x29, 0xAC,
-    0x32, 0x4C, 0xFD, 0x0C, 0x5D, 0x86, 0x88, 0xE6, 0x59, 0xC7, 0x67, 0x70, 0x78, 0x55, 0x18, 0x1F,
-    0xB6, 0x2F, 0x70, 0xF1, 0xF8, 0xCD, 0x22, 0x36, 0x3A, 0x98, 0x83, 0x4B, 0x61, 0x22, 0x7D, 0x53,
-    0x84, 0xFF, 0x2D, 0x7B, 0x18, 0x26, 0x8B, 0x40, 0x6D, 0x3B, 0x55, 0xA0, 0x5A, 0xE8, 0xE0, 0x94,
-    0x93, 0x93, 0x6C, 0x92, 0xC5, 0x7A, 0x15, 0x6E, 0x26, 0xA6, 0xA2, 0x0A, 0x2A, 0xB7, 0xC2, 0x33,
-    0x94, 0x4E, 0x1E, 0xEA, 0x0F, 0xF8, 0xF5, 0x35, 0x15, 0xE7, 0x69, 0x61, 0x32, 0x23, 0xA7, 0xB8,
-    0x60, 0x3E, 0x7A, 0x08, 0xB4, 0xA3, 0xBE, 0x5E, 0xF6, 0x88, 0x11, 0x0C, 0x75, 0x90, 0xB9, 0x05,
-    0x45, 0x37, 0x70, 0x24, 0x61, 0x40, 0x09, 0xBF, 0x80, 0x50, 0xE8, 0xDA, 0x18, 0x03, 0xDB, 0xE8,
-    0x6C, 0x0D, 0xE3, 0xE9, 0x91, 0xD5, 0x36, 0x5E, 0xC3, 0x0E, 0x5A, 0x07, 0x71, 0xD5, 0x7B, 0x9A,
-    0xE0, 0x04, 0xF7, 0x46, 0x32, 0x35, 0x7A, 0xF0, 0x40, 0x21, 0x90, 0x36, 0xBA, 0x8B, 0x00, 0xDF,
-    0x01, 0x9A, 0x36, 0xE3, 0x7E, 0x26, 0x0A, 0x51, 0x12, 0x07, 0x05, 0x0A, 0x9F, 0x91, 0xB4, 0xCA,
-    0x02, 0x1D, 0xEB, 0x67, 0x76, 0x00, 0x53, 0x3C, 0xA6, 0x2E, 0xDB, 0x08, 0x99, 0x0B, 0x70, 0x64,
-    0xEB, 0x53, 0xE6, 0x9A, 0x3A, 0xED, 0x58, 0x6C, 0x24, 0x9F, 0xDD, 0x0C, 0x9E, 0xB6, 0x97, 0xCB,
-    0xA0, 0x9C, 0x39, 0xB9, 0x9B, 0xA5, 0xF3, 0xC9, 0xDC, 0x53, 0xBE, 0xBC, 0x46, 0x48, 0x50, 0x42,
-    0xD3, 0x02, 0x5C, 0xC3, 0x72, 0xED, 0x10, 0xCC, 0x16, 0xCD, 0xFE, 0x45, 0x85, 0xC9, 0x14, 0x69,
-    0x4E, 0x80, 0xD0, 0xFA, 0x2E, 0xA3, 0xD6, 0xE1, 0x22, 0x97, 0xF8, 0xF0, 0xA7, 0xE9, 0x34, 0x2E,
-    0x1C, 0x19, 0x10, 0xAE, 0x31, 0x23, 0x18, 0xCA, 0xE8, 0x55, 0xD4, 0x38, 0xEF, 0x22, 0x34, 0xE8,
-    0xFD, 0x44, 0x5F, 0x7A, 0xFA, 0xC2, 0xCD, 0x2E, 0xBD, 0xAC, 0x77, 0x4B, 0x73, 0xC4, 0x79, 0x82,
-    0x6B, 0xE7, 0x22, 0x13, 0x2A, 0xA2, 0xA6, 0x13, 0x6B, 0xDF, 0x0A, 0xF8, 0xC4, 0x64, 0x10, 0xD3,
-    0x16, 0xE6, 0x41, 0x8E, 0x20, 0x43, 0xA8, 0xAD, 0xD9, 0x53, 0xE0, 0x03, 0xFA, 0x8E, 0xC8, 0x02,
-    0x0F, 0x29, 0x45, 0xD8, 0xFF, 0xDD, 0xBA, 0x16, 0xCC, 0xB0, 0xD6, 0x6A, 0x76, 0x3A, 0xC9, 0xE1,
-    0xEA, 0x60, 0x70, 0x10, 0x19, 0x53, 0x11, 0xDF, 0xD3, 0x1E, 0x9C, 0x92, 0x21, 0x28, 0x6C, 0x0C,
-    0xFA, 0x40, 0xFF, 0xE1, 0xB6, 0x8B, 0x71, 0xC7, 0x47, 0x31, 0x14, 0x98, 0x7C, 0x5C, 0xA1, 0xF5,
-    0x7A, 0x8E, 0x87, 0xF8, 0xEE, 0xD0, 0x99, 0x46, 0x04, 0xDF, 0xBF, 0x94, 0x30, 0xF0, 0x6B, 0xF0,
-    0xD5, 0x25, 0x95, 0x39, 0xA6, 0xF0, 0x3F, 0x29, 0x43, 0x55, 0x9D, 0xA2, 0x4B, 0xA4, 0xEC, 0x63,
-    0xA7, 0x43, 0xA7, 0xDE, 0x28, 0x43, 0x96, 0x9A, 0x91, 0x36, 0xE8, 0x57, 0x68, 0xEA, 0xE2, 0x59,
-    0xF2, 0x65, 0xD9, 0x79, 0x86, 0x30, 0x35, 0xE5, 0x45, 0x33, 0x30, 0x79, 0xDB, 0x31, 0xCA, 0xBA,
-    0xC4, 0x9A, 0x9B, 0x98, 0xCA, 0xD6, 0x9A, 0x6D, 0xA9, 0x31, 0x46, 0x4E, 0xD8, 0x2D, 0xEA, 0x77,
-    0x7D, 0x34, 0x1A, 0x9D, 0x85, 0x7C, 0xCD, 0x6E, 0xF2, 0x49, 0xE1, 0xCB, 0x16, 0x5B, 0xB9, 0x5A,
-    0xF8, 0x9B, 0xF4, 0xDE, 0x1B, 0x8D, 0xCE, 0x29, 0x90, 0x1F, 0x51, 0x03, 0x9F, 0xD9, 0xEA, 0x8F,
-    0xA8, 0xF9, 0x68, 0xF1, 0x86, 0x1A, 0xF5, 0x7E, 0xCE, 0x45, 0x33, 0xF8, 0xB3, 0xFA, 0x46, 0x0A,
-    0x41, 0xC4, 0x91, 0xC7, 0x9C, 0xFC, 0xDE, 0x72, 0x29, 0x0B, 0x03, 0xCA, 0x69, 0xDB, 0x8B, 0xFA,
-    0x39, 0xAA, 0xC7, 0xBB, 0x75, 0x3F, 0xB5, 0x1D, 0xEB, 0x8B, 0xCD, 0xCB, 0x50, 0x83, 0x0D, 0x35,
-    0x33, 0xD8, 0xD6, 0xAB, 0xFB, 0x61, 0xDD, 0x97, 0xB5, 0xAE, 0xFC, 0x5B, 0xEA, 0x7A, 0xF6, 0xFF,
-    0x75, 0x75, 0xEA, 0xFE, 0xEE, 0xD2, 0x7A, 0x5F, 0xD5, 0x85, 0x66, 0xAB, 0x21, 0x8F, 0x74, 0xD7,
-    0x62, 0x68, 0x73, 0x8F, 0x42, 0x94, 0x4A, 0xA8, 0xB2, 0x64, 0x88, 0x0A, 0xC6, 0xBB, 0x18, 0x0C,
-    0x06, 0xFD, 0x2B, 0x80, 0x74, 0x07, 0x83, 0x21, 0xE7, 0xDB, 0x6D, 0xE0, 0x84, 0xC0, 0x1B, 0xDB,
-    0x79, 0x46, 0xEC, 0xDC, 0x39, 0xBB, 0x8B, 0xF0, 0x3F, 0x06, 0xDD, 0xE3, 0x07, 0xF2, 0xD1, 0x1D,
-    0x5F, 0x9E, 0xDF, 0xF6, 0xB9, 0xC2, 0xF5, 0xEF, 0x84, 0xA7, 0x41, 0x19, 0xE4, 0xBD, 0xB2, 0x6D,
-    0x51, 0x7A, 0xE8, 0x97, 0x42, 0x87, 0x64, 0x40, 0xA1, 0x03, 0xED, 0x67, 0x5E, 0x16, 0xEA, 0x09,
-    0xFA, 0x0B, 0x63, 0x04, 0xC3, 0x5F, 0xD8, 0x2E, 0x7F, 0x99, 0x49, 0x9B, 0x1B, 0x65, 0x33, 0xA3,
-    0xEC, 0x93, 0x5C, 0x90, 0x83, 0x9F, 0xD3, 0xE6, 0x4B, 0xE2, 0x88, 0x68, 0xFB, 0x0A, 0x39, 0x38,
-    0x84, 0x0A, 0x39, 0xEB, 0x2B, 0x04, 0x2E, 0x6C, 0x85, 0xD9, 0x45, 0x95, 0xA8, 0x77, 0x84, 0xBA,
-    0x39, 0x0C, 0xAA, 0x57, 0x21, 0xBC, 0x3F, 0xBD, 0x8C, 0xFF, 0xFC, 0xEF, 0x59, 0xFC, 0x97, 0xE7,
-    0xB3, 0xE8, 0x87, 0xAA, 0x5A, 0x09, 0x6A, 0x66, 0xC0, 0x16, 0x52, 0x99, 0xB2, 0x58, 0x8C, 0x9A,
-    0x64, 0x37, 0xC1, 0x00, 0xF4, 0x6D, 0x75, 0xF0, 0x5F, 0x9E, 0xC2, 0xAD, 0xAB, 0x83, 0xE9, 0xC8,
-    0x69, 0xBE, 0xE4, 0xDC, 0x40, 0xD6, 0x50, 0xB4, 0x9D, 0xFE, 0x3A, 0x28, 0x6E, 0x51, 0x04, 0xA4,
-    0x65, 0x72, 0x72, 0xF3, 0x8A, 0x93, 0x13, 0x81, 0xC3, 0x75, 0x4A, 0x4D, 0x0A, 0x53, 0x38, 0xB9,
-    0x65, 0x13, 0x87, 0xF0, 0xEC, 0xC3, 0x39, 0xA3, 0x47, 0x46, 0x93, 0x7F, 0xFF, 0x9A, 0x27, 0x11,
-    0x9D, 0x88, 0xC9, 0xC2, 0x17, 0x1B, 0x0B, 0xF6, 0xB3, 0xF1, 0xF2, 0xCA, 0xE5, 0xBF, 0xA8, 0x81,
-    0xEA, 0xCE, 0xE5, 0xAE, 0x30, 0x9F, 0x96, 0xBD, 0x63, 0x93, 0xEF, 0xBB, 0x84, 0xFD, 0x8A, 0x4D,
-    0x38, 0xD3, 0x1E, 0x2F, 0xFF, 0x6B, 0x7C, 0xFF, 0x50, 0x6E, 0xFB, 0xA6, 0x1C, 0x8A, 0xF7, 0x4C,
-    0xB9, 0xE7, 0x9A, 0xCC, 0xBA, 0x67, 0x55, 0x31, 0x58, 0x5C, 0xE7, 0x9F, 0xF5, 0x3A, 0x7D, 0x0B,
-    0x71, 0x6A, 0x95, 0x67, 0x62, 0xC4, 0xE4, 0x93, 0x0C, 0xCA, 0x1D, 0x57, 0xAF, 0xB8, 0xCB, 0x68,
-    0xE9, 0xA0, 0x88, 0xAA, 0x20, 0x13, 0xDC, 0x85, 0x42, 0x15, 0xCA, 0xB4, 0xF4, 0x8C, 0x0E, 0x67,
-    0xCB, 0xDB, 0xCF, 0xFB, 0x18, 0x60, 0xF5, 0xAD, 0x45, 0x6C, 0x9B, 0xBC, 0x6D, 0xD6, 0xB7, 0x46,
-    0x67, 0x6C, 0xB9, 0xB7, 0xB1, 0x39, 0xB6, 0x8A, 0x6B, 0xEA, 0x84, 0xAB, 0xEC, 0x85, 0xEB, 0x1C,
-    0xD9, 0xC5, 0x86, 0xA5, 0xDC, 0x64, 0x25, 0xB1, 0x26, 0x6F, 0x34, 0x13, 0xEB, 0xE1, 0x4A, 0x33,
-    0xB1, 0x38, 0x6D, 0x36, 0x93, 0x5D, 0xCB, 0xF6, 0xCD, 0xA5, 0xCE, 0xDD, 0x5A, 0x72, 0xBB, 0xE6,
-    0xE8, 0x7D, 0x9A, 0x23, 0xED, 0x75, 0xA5, 0xD3, 0xF9, 0x11, 0xDE, 0x96, 0x58, 0xAE, 0x97, 0xD4,
-    0x10, 0x6F, 0xBE, 0xB4, 0xC5, 0xDE, 0x5E, 0x35, 0x17, 0xC8, 0xB8, 0xDF, 0x45, 0xB9, 0x57, 0x05,
-    0xD3, 0x54, 0x95, 0xA0, 0x3D, 0xE7, 0x41, 0x1E, 0xA9, 0x4E, 0xCD, 0xCD, 0xB1, 0x14, 0xD2, 0x01,
-    0x37, 0x23, 0xDF, 0x66, 0xB4, 0xE8, 0x61, 0x4A, 0x9E, 0xEA, 0x5F, 0x6E, 0x12, 0x6C, 0xBC, 0x9C,
-    0xE9, 0x32, 0xBB, 0xB7, 0x6F, 0x20, 0x4A, 0xED, 0xC6, 0xCB, 0x3C, 0x88, 0x0A, 0x71, 0x84, 0xEB,
-    0x8C, 0xB4, 0x63, 0xAB, 0xD2, 0xE1, 0x31, 0xA1, 0x44, 0x4C, 0x0A, 0x9E, 0xD5, 0x94, 0xEB, 0xDB,
-    0xDC, 0x11, 0xA2, 0xD1, 0x0B, 0xEA, 0xB4, 0xB3, 0xE1, 0x67, 0x36, 0x33, 0xFB, 0x35, 0xCF, 0xB0,
-    0xB8, 0x85, 0x9C, 0x9C, 0x85, 0x2A, 0xA8, 0x22, 0xED, 0x55, 0x71, 0x16, 0xBD, 0x78, 0xBF, 0x98,
-    0xA1, 0x28, 0xCF, 0x9D, 0x7C, 0xB8, 0x0A, 0x16, 0x0B, 0x0F, 0x32, 0x4E, 0xE1, 0xB2, 0x48, 0x63,
-    0xC6, 0x75, 0x8D, 0xB8, 0x9C, 0xA8, 0x89, 0x4A, 0x17, 0x56, 0xAC, 0x24, 0xD8, 0x3B, 0x41, 0xF4,
-    0x36, 0xCF, 0x32, 0x19, 0x77, 0x99, 0xF6, 0xC7, 0xD2, 0xF9, 0x48, 0xBB, 0xCF, 0xEB, 0x94, 0xF5,
-    0x0F, 0x10, 0xCE, 0x8D, 0xEC, 0x1D, 0x7F, 0xA4, 0x13, 0xE1, 0xE6, 0x89, 0xE0, 0x09, 0x43, 0xDC,
-    0xCF, 0x08, 0x4B, 0x1D, 0x94, 0x73, 0xE2, 0xA4, 0x69, 0xBD, 0x9D, 0xA5, 0x55, 0xBD, 0x21, 0x3D,
-    0xBC, 0x82, 0x6D, 0x7B, 0x41, 0x0F, 0xB2, 0xB9, 0x08, 0x9D, 0x2D, 0x2F, 0x2A, 0x2B, 0xE1, 0x7D,
-    0xC6, 0xFB, 0x31, 0xB1, 0x33, 0xF9, 0x7C, 0x34, 0x99, 0x5B, 0x12, 0xBA, 0xAA, 0xD7, 0x9B, 0xA3,
-    0x77, 0x5F, 0xA2, 0x7E, 0x49, 0x33, 0x9E, 0x5A, 0xB0, 0x53, 0xB8, 0xE4, 0xAA, 0x67, 0x35, 0x85,
-    0x22, 0xB4, 0xAC, 0x3A, 0x1F, 0xBD, 0x67, 0x2C, 0xC3, 0xF2, 0xFB, 0x17, 0x76, 0xEE, 0xB5, 0xD1,
-    0x93, 0x65, 0xB9, 0xD4, 0x7B, 0x90, 0xB1, 0xAC, 0x3F, 0x58, 0x54, 0xDC, 0xAB, 0x23, 0x07, 0x78,
-    0xED, 0x37, 0xF6, 0x83, 0x87, 0xAE, 0x31, 0xB4, 0xC6, 0xC9, 0xC5, 0xE7, 0x13, 0x3E, 0xDC, 0xD2,
-    0xDC, 0x68, 0x8F, 0x2D, 0x83, 0xDB, 0x74, 0x1F, 0x9B, 0x72, 0x51, 0x2B, 0x8B, 0xB6, 0xB5, 0xD8,
-    0x3F, 0x38, 0x3D, 0x5D, 0xDA, 0x6C, 0xB7, 0x81, 0xF4, 0x6F, 0xC0, 0xAD, 0x12, 0x6E, 0x4D, 0x98,
-    0xA7, 0x08, 0xEA, 0x1D, 0x44, 0x2C, 0x4E, 0x0A, 0xB4, 0x7D, 0xF1, 0xBD, 0x23, 0xFF, 0xC7, 0x2D,
-    0x5D, 0xEF, 0x15, 0x45, 0x6D, 0xCD, 0xD4, 0x56, 0xB5, 0x59, 0xF0, 0x71, 0xED, 0x9D, 0x7B, 0x25,
-    0x75, 0x00, 0xFF, 0xB7, 0xEA, 0x86, 0x2F, 0xB9, 0x63, 0xB6, 0x03, 0x9C, 0x34, 0x70, 0xD2, 0x44,
-    0xFB, 0x77, 0x20, 0xB3, 0xA0, 0x1F, 0xBC, 0xB5, 0xB7, 0xD3, 0xDE, 0xFB, 0x53, 0x5E, 0x62, 0x8C,
-    0x64, 0x37, 0xCC, 0x56, 0xED, 0x29, 0x81, 0x29, 0x1D, 0x62, 0x8F, 0x41, 0xDF, 0xE7, 0x91, 0x72,
-    0x8C, 0x3F, 0xDA, 0x5D, 0xDC, 0x2A, 0xC1, 0x8E, 0xA7, 0x3A, 0x9E, 0x4E, 0x3C, 0x75, 0xE2, 0xCB,
-    0x93, 0x00, 0xED, 0xDB, 0x76, 0x5B, 0x67, 0x5D, 0xB5, 0x3C, 0x75, 0xC3, 0x93, 0x24, 0xD8, 0x3D,
-    0x0E, 0x0A, 0xEC, 0xB7, 0xAC, 0xFE, 0x16, 0x1D, 0x38, 0x08, 0x7E, 0xBC, 0xD7, 0x68, 0x53, 0x87,
-    0xFD, 0x25, 0x9B, 0x61, 0x86, 0x6B, 0x67, 0x70, 0x32, 0x96, 0x2E, 0xDE, 0xD0, 0xDF, 0x64, 0xD5,
-    0x4D, 0xC9, 0x4C, 0x13, 0xA0, 0x08, 0x56, 0xD0, 0xF8, 0xBD, 0x14, 0xF7, 0xE5, 0xCE, 0x42, 0x73,
-    0x03, 0xFB, 0x0D, 0x3C, 0x6A, 0xE0, 0x61, 0xA0, 0x56, 0x57, 0x1D, 0x19, 0xFE, 0xEC, 0x57, 0x79,
-    0xF0, 0xCB, 0x7C, 0x2C, 0x3C, 0x9D, 0x73, 0xF9, 0xEC, 0xB6, 0xEF, 0xE8, 0xBD, 0xC0, 0xD5, 0x6D,
-    0xE1, 0xEA, 0xFD, 0x75, 0x94, 0x9B, 0x9B, 0xAD, 0x3F, 0x34, 0x7E, 0x70, 0x87, 0x9E, 0x74, 0x96,
-    0xBE, 0x30, 0x34, 0x3C, 0x87, 0x45, 0x67, 0x37, 0x70, 0x7B, 0xE9, 0x5F, 0x9B, 0xB4, 0xB4, 0xE9,
-    0x50, 0xBB, 0xBA, 0xE1, 0xAA, 0x86, 0x2B, 0x1B, 0x14, 0x58, 0x83, 0xBF, 0x0D, 0xFF, 0x9C, 0x21,
-    0x67, 0xB4, 0x37, 0x5C, 0x9D, 0xE1, 0x1F, 0x12, 0xEF, 0xD7, 0x20, 0x24, 0x62, 0x7E, 0x8D, 0x40,
-    0xE0, 0xAE, 0xAF, 0xBE, 0x00, 0xED, 0x7D, 0x4D, 0x8C, 0x25, 0xD7, 0x75, 0x5E, 0xFD, 0xA8, 0xA7,
-    0x68, 0x57, 0xAC, 0x22, 0x02, 0x0E, 0x63, 0x68, 0x22, 0x56, 0x16, 0x5E, 0x04, 0x92, 0x66, 0x2A,
-    0x0B, 0x2F, 0xB4, 0xE8, 0x9E, 0x2A, 0x91, 0x08, 0xB4, 0xD0, 0xC2, 0x93, 0x60, 0x9A, 0x04, 0x42,
-    0x20, 0xCC, 0xC2, 0x59, 0xC4, 0x84, 0xD1, 0x5E, 0x68, 0xC1, 0x00, 0x43, 0x56, 0xD1, 0x5A, 0x64,
-    0xE1, 0x85, 0x66, 0x61, 0x39, 0x0B, 0x2D, 0xCC, 0x45, 0x16, 0xE6, 0x10, 0xC8, 0x70, 0x41, 0x20,
-    0x13, 0x63, 0x38, 0x55, 0xB4, 0x17, 0x5A, 0x78, 0xA1, 0x92, 0x0D, 0xC6, 0x40, 0x0C, 0xC4, 0xCF,
-    0x09, 0x19, 0xDB, 0x54, 0x6C, 0x96, 0xA2, 0x62, 0xF4, 0x7A, 0xF8, 0x5E, 0x55, 0xCE, 0xF7, 0x9D,
-    0x73, 0xAB, 0xEA, 0x75, 0xF7, 0x0C, 0x49, 0x85, 0xA4, 0x48, 0x3A, 0x2D, 0xAA, 0xAA, 0x7A, 0xBA,
-    0xFB, 0xD5, 0xBD, 0xE7, 0xDC, 0x7B, 0x7E, 0xBF, 0x73, 0xAE, 0xE7, 0x79, 0x37, 0x3C, 0x7E, 0x95,
-    0x05, 0x6F, 0x59, 0xC3, 0x5B, 0xDC, 0xF2, 0x16, 0x76, 0xFA, 0x43, 0xBB, 0x3D, 0xE8, 0x4D, 0x5F,
-    0xC9, 0x28, 0x5F, 0x95, 0xBB, 0x79, 0xF5, 0xEB, 0x87, 0xF8, 0x80, 0x52, 0xFE, 0x45, 0x3F, 0x0B,
-    0xB7, 0xDA, 0xE3, 0x6D, 0xF4, 0xBC, 0x47, 0xE4, 0x36, 0xF0, 0xEF, 0x7C, 0xBB, 0x6D, 0x79, 0x0B,
-    0x36, 0xFA, 0x1A, 0xBB, 0x8D, 0x23, 0x7E, 0x1A, 0xE9, 0x2D, 0xD6, 0x97, 0x26, 0xBB, 0xB7, 0x15,
-    0x6F, 0x69, 0xBB, 0x1C, 0x6C, 0x2E, 0xB7, 0x17, 0x78, 0xF3, 0xE5, 0xC7, 0x79, 0xE5, 0x85, 0xF2,
-    0xE3, 0xBA, 0xF0, 0xA2, 0x86, 0x2F, 0x97, 0xDF, 0x7A, 0x5A, 0x87, 0x59, 0xE3, 0x56, 0xCC, 0x93,
-    0xF0, 0xD6, 0x7E, 0xCF, 0x51, 0x70, 0x00, 0x76, 0xF3, 0xD7, 0x41, 0xEF, 0x9D, 0xFD, 0xF5, 0x69,
-    0x9E, 0x74, 0x84, 0xDB, 0xD6, 0x8B, 0xF5, 0x96, 0xBC, 0xF9, 0xD4, 0x3B, 0x87, 0x72, 0x2B, 0xE4,
-    0x15, 0xB7, 0x65, 0xA4, 0xF2, 0x8A, 0x6B, 0xDE, 0x45, 0xBC, 0xE2, 0x19, 0x6F, 0xDF, 0xCB, 0x70,
-    0x7B, 0x08, 0x9F, 0xF1, 0xA0, 0xBD, 0xC9, 0xE3, 0x2B, 0x16, 0xEB, 0xA4, 0x7E, 0x72, 0xBC, 0x8E,
-    0x69, 0xE2, 0xC3, 0xE4, 0xF6, 0xD7, 0x4F, 0x83, 0xAE, 0x32, 0x83, 0xB1, 0xE1, 0x34, 0xF3, 0x15,
-    0xA7, 0x99, 0x76, 0x9C, 0xA6, 0xBC, 0x24, 0x5C, 0xF3, 0x16, 0xE9, 0x2D, 0x16, 0x0A, 0xA7, 0x2B,
-    0xCE, 0x56, 0xDE, 0x85, 0x69, 0xCA, 0x4B, 0x30, 0x4D, 0x19, 0x79, 0x2E, 0xBF, 0xBC, 0xF5, 0xBE,
-    0x30, 0x0E, 0xD5, 0xD8, 0x79, 0xD9, 0x38, 0x36, 0x83, 0xBE, 0xF1, 0xE7, 0x5F, 0xD0, 0xE9, 0xB7,
-    0xCB, 0x61, 0x18, 0x45, 0x95, 0x4E, 0x71, 0x75, 0x36, 0xC7, 0x0A, 0xBD, 0xE1, 0xAF, 0x5E, 0x3F,
-    0xAC, 0x75, 0x2A, 0xB9, 0x7E, 0xC6, 0x25, 0xE5, 0xD8, 0x45, 0xE5, 0x98, 0xDD, 0x3E, 0x37, 0x33,
-    0xEE, 0x4C, 0x8E, 0xAD, 0x79, 0x8B, 0x74, 0x95, 0xC4, 0x76, 0x7B, 0x7F, 0x1C, 0xBB, 0x17, 0x39,
-    0x75, 0x55, 0x3E, 0x3D, 0xDE, 0x25, 0x6D, 0x39, 0xD6, 0xE9, 0xEB, 0x1C, 0x49, 0x5C, 0x0A, 0x25,
-    0xBC, 0x60, 0x00, 0x79, 0x92, 0x1E, 0xEF, 0x91, 0xCF, 0x91, 0x97, 0xCA, 0x1F, 0xC6, 0x2B, 0xAC,
-    0xAF, 0x73, 0x85, 0x0E, 0x2F, 0x5E, 0xCF, 0xE3, 0xC8, 0x78, 0xCD, 0x39, 0x8A, 0xFC, 0xAD, 0x1B,
-    0x2F, 0xF2, 0x53, 0x36, 0x24, 0xC3, 0x55, 0x79, 0x0D, 0x47, 0x60, 0xD7, 0x62, 0xF1, 0xCC, 0x6B,
-    0xD9, 0xCC, 0x83, 0xCD, 0x64, 0x3A, 0xBF, 0x81, 0xD7, 0x0A, 0xA1, 0xA3, 0xB1, 0x38, 0x6A, 0x3D,
-    0x5F, 0x37, 0x52, 0x36, 0xF2, 0x6D, 0x87, 0x8B, 0xD1, 0xA6, 0x63, 0xCB, 0x75, 0x21, 0xAF, 0x89,
-    0xD6, 0xC1, 0x48, 0x5A, 0xC8, 0x35, 0x6D, 0xBC, 0x92, 0x93, 0xBE, 0xCC, 0xEB, 0x43, 0x8E, 0x00,
-    0xF3, 0x0B, 0xE4, 0x77, 0x48, 0xCA, 0x64, 0xD0, 0x6D, 0xC1, 0x51, 0xEB, 0xE7, 0x67, 0xFC, 0xA7,
-    0x68, 0xE4, 0x5F, 0x8C, 0x3A, 0x30, 0xFD, 0x8B, 0xCE, 0x26, 0x7B, 0x89, 0xD7, 0x9C, 0x6F, 0x2B,
-    0x49, 0x78, 0xF0, 0xB8, 0xC1, 0x07, 0x0B, 0x7B, 0xE3, 0xE1, 0xA6, 0x90, 0xD0, 0xAF, 0xF9, 0x99,
-    0xFE, 0x55, 0x5B, 0x18, 0xDC, 0xC8, 0xD8, 0xBF, 0xAD, 0x63, 0x07, 0x99, 0x51, 0x7B, 0xBA, 0x0A,
-    0xEC, 0x32, 0xB8, 0x65, 0xC0, 0x45, 0x40, 0x1A, 0x73, 0x01, 0x90, 0xFD, 0x64, 0x3E, 0x59, 0x4F,
-    0x82, 0x93, 0xED, 0x64, 0x3A, 0x59, 0x9E, 0xCF, 0x97, 0xE9, 0xD3, 0xF1, 0xC2, 0xA7, 0xC7, 0x63,
-    0x30, 0x79, 0xEB, 0x48, 0xE6, 0xAF, 0xA3, 0x95, 0x7C, 0x32, 0x76, 0x09, 0x2E, 0x7E, 0x1F, 0xB5,
-    0x67, 0xAC, 0xE3, 0x4F, 0xC4, 0x70, 0x39, 0x0E, 0x1B, 0x88, 0x8E, 0xC4, 0xF8, 0xA8, 0xEB, 0xB8,
-    0xF6, 0xA6, 0x81, 0xD8, 0x75, 0x98, 0xB7, 0x91, 0xEE, 0x22, 0x5D, 0xA5, 0xBA, 0x87, 0x74, 0x0B,
-    0xE9, 0x0E, 0x8A, 0xBB, 0x79, 0xDD, 0xEA, 0xF6, 0xD1, 0xDD, 0x93, 0x2D, 0xD6, 0xA1, 0x5D, 0xEF,
-    0xF1, 0xC2, 0xFB, 0xBE, 0x2A, 0x5E, 0x7C, 0xB0, 0xCE, 0x91, 0xBF, 0x5E, 0xBE, 0xE1, 0x56, 0xAD,
-    0x7C, 0xE9, 0x5A, 0xC3, 0x93, 0xEE, 0xE9, 0xED, 0xE1, 0x13, 0xC6, 0xA3, 0xDB, 0x14, 0x5C, 0xD4,
-    0x18, 0x6E, 0xC3, 0x7B, 0xBD, 0xDB, 0xF3, 0x7E, 0xE7, 0xB6, 0xBD, 0x6C, 0x0F, 0xDB, 0xF9, 0xE1,
-    0xCA, 0x6D, 0x7E, 0x11, 0xCB, 0xB6, 0xFF, 0x45, 0x32, 0xE7, 0xAF, 0x73, 0xD4, 0xB1, 0x3C, 0x29,
-    0x09, 0x13, 0x59, 0xA5, 0x6F, 0x8D, 0x64, 0x46, 0x21, 0x53, 0x8A, 0x31, 0xE2, 0x14, 0xD3, 0x0A,
-    0xF0, 0xE6, 0xCB, 0x9C, 0x1A, 0x66, 0x77, 0xA0, 0xC2, 0x55, 0x9E, 0xAE, 0x51, 0x9B, 0x8C, 0x1C,
-    0x0A, 0x7E, 0x49, 0x9E, 0x44, 0x89, 0x61, 0xC2, 0x23, 0xF5, 0xB5, 0x4C, 0x1A, 0xBF, 0x20, 0x0A,
-    0x5C, 0x26, 0x2E, 0x82, 0x14, 0x6F, 0x17, 0x3A, 0x47, 0x1B, 0xEF, 0x61, 0xC8, 0x8A, 0x0E, 0x7B,
-    0xA6, 0xC4, 0x86, 0xEC, 0x7C, 0xD9, 0x49, 0xE5, 0x46, 0xC4, 0x0B, 0x55, 0x8F, 0x6C, 0x28, 0x48,
-    0x49, 0x11, 0xEA, 0x7B, 0xBB, 0xCB, 0x2E, 0xA7, 0x62, 0x02, 0xCB, 0xF5, 0x09, 0x6C, 0xF7, 0x75,
-    0x2B, 0x82, 0x13, 0xA3, 0x13, 0x63, 0x26, 0x2B, 0xEB, 0x49, 0x5C, 0x8E, 0x93, 0xC4, 0x9C, 0x9F,
-    0x06, 0xC7, 0x0F, 0xFC, 0xB6, 0xB2, 0x1F, 0xBF, 0xAD, 0x94, 0x0C, 0xB7, 0x87, 0x87, 0x4F, 0xBD,
-    0x73, 0x55, 0x95, 0x22, 0xBE, 0x84, 0x82, 0xD1, 0x70, 0xE3, 0xC6, 0xCD, 0xBB, 0xF5, 0x46, 0x97,
-    0x49, 0xDA, 0x42, 0xA2, 0x50, 0x6D, 0x34, 0x90, 0x53, 0xA6, 0x39, 0x4C, 0x79, 0xE8, 0x96, 0x07,
-    0xDD, 0x65, 0x38, 0xD8, 0xFC, 0x0D, 0x05, 0x9B, 0xFE, 0x02, 0x06, 0x51, 0x4E, 0x4F, 0xF8, 0xE7,
-    0x0A, 0xC3, 0xF1, 0x47, 0x37, 0xF8, 0x68, 0xCB, 0xE5, 0x2E, 0x03, 0x2D, 0x7B, 0xAE, 0xF9, 0x9B,
-    0xA6, 0x3E, 0xB7, 0x81, 0x3C, 0xBC, 0xE1, 0x9D, 0xA1, 0x41, 0x1F, 0xFF, 0x70, 0x34, 0x28, 0x48,
-    0x33, 0xBE, 0x75, 0x73, 0x54, 0xFA, 0xC8, 0x3B, 0x41, 0x1C, 0x19, 0x2B, 0x28, 0x23, 0x7F, 0x1A,
-    0xDA, 0x6D, 0xCD, 0x1B, 0x16, 0xA2, 0x7C, 0x10, 0xA8, 0x51, 0x92, 0x9F, 0xB4, 0x38, 0x3A, 0xCE,
-    0x6A, 0xD6, 0xA0, 0x32, 0x2D, 0x68, 0x50, 0x7F, 0x7C, 0x03, 0x1A, 0x34, 0xD0, 0xA5, 0xED, 0x4C,
-    0xBD, 0xC0, 0x56, 0xB5, 0x69, 0x30, 0x2F, 0xD1, 0xE1, 0x51, 0x27, 0xE2, 0xEB, 0x96, 0xDD, 0x8B,
-    0x93, 0x12, 0xA8, 0x34, 0x21, 0x54, 0x9B, 0x1C, 0x4A, 0x7A, 0x9D, 0x55, 0x6A, 0xF2, 0xE2, 0x39,
-    0x5B, 0x00, 0x6B, 0x65, 0x7A, 0xB8, 0xD2, 0x7B, 0x52, 0x29, 0xEB, 0x2F, 0x1B, 0xE3, 0xD7, 0xCA,
-    0x76, 0xFD, 0xB1, 0x88, 0xBC, 0xCA, 0xEC, 0xA0, 0x4A, 0xA5, 0xBC, 0x0A, 0xF8, 0xB8, 0x57, 0xA5,
-    0x10, 0x77, 0x26, 0x13, 0x3A, 0x6E, 0x0E, 0x99, 0x63, 0xB8, 0x55, 0xE9, 0x10, 0x8C, 0x26, 0x1F,
-    0xB8, 0x93, 0x84, 0x34, 0xB5, 0x09, 0xB0, 0xDC, 0x24, 0x24, 0xB5, 0x03, 0xCC, 0xB2, 0xB5, 0x4A,
-    0xB2, 0x68, 0x50, 0x61, 0x16, 0x8C, 0x2B, 0x95, 0x67, 0x47, 0x7C, 0x43, 0xF0, 0x7B, 0x36, 0x45,
-    0x5B, 0xB7, 0xF2, 0x75, 0xC7, 0x3D, 0xE4, 0xD3, 0xF4, 0x9D, 0x6D, 0x11, 0x36, 0xDE, 0x59, 0xE4,
-    0x21, 0x7D, 0x62, 0x8C, 0x1D, 0x04, 0x4A, 0x38, 0x09, 0xC8, 0xC7, 0xBC, 0x33, 0xC6, 0x73, 0x0D,
-    0x80, 0xF5, 0x7C, 0xA8, 0x9D, 0x9E, 0x95, 0x39, 0x04, 0x1C, 0x3F, 0xD8, 0xE7, 0x24, 0x78, 0x3E,
-    0xDA, 0x0E, 0x59, 0x0F, 0x3A, 0xAC, 0xE8, 0x2F, 0xB6, 0x2A, 0xCF, 0xD2, 0x47, 0xB7, 0x2A, 0xD2,
-    0x9E, 0xE5, 0x60, 0xA3, 0x3E, 0xE8, 0xB9, 0xB3, 0xE2, 0x3E, 0x6E, 0xB8, 0xB1, 0xE2, 0x2E, 0x57,
-    0xBE, 0x26, 0xDD, 0xC6, 0x44, 0xFD, 0xFF, 0x58, 0xA9, 0x7C, 0x4A, 0xDF, 0xD6, 0x0D, 0xE3, 0x65,
-    0x5B, 0x93, 0x84, 0x79, 0x6F, 0x52, 0x16, 0x14, 0xCB, 0x9A, 0x33, 0x47, 0x8A, 0xC1, 0x81, 0xB0,
-    0x20, 0xDC, 0x97, 0x9D, 0x26, 0x28, 0x55, 0x12, 0x7C, 0xCE, 0xF3, 0x71, 0x7B, 0xD6, 0x0B, 0x2B,
-    0x0E, 0x3C, 0x25, 0xBF, 0xBF, 0x73, 0x9B, 0xAB, 0x7C, 0x24, 0x71, 0x2F, 0x0C, 0xA7, 0x6C, 0xB2,
-    0x52, 0x56, 0xA3, 0x10, 0xAB, 0x16, 0x29, 0x2B, 0xA4, 0x8A, 0xE5, 0x17, 0x64, 0x1D, 0x61, 0x16,
-    0xB1, 0xAE, 0x75, 0x21, 0x35, 0x56, 0x68, 0xA6, 0x76, 0xF3, 0x81, 0xD2, 0xE6, 0x96, 0xDE, 0x3A,
-    0xDA, 0x2A, 0x5C, 0x39, 0x79, 0x15, 0x29, 0xBF, 0x93, 0x82, 0x66, 0xE1, 0x25, 0xAE, 0x8A, 0xD5,
-    0xBE, 0x2E, 0x96, 0x57, 0x78, 0xFB, 0x11, 0x97, 0x4E, 0xFC, 0x93, 0x56, 0x57, 0x98, 0x2D, 0xB4,
-    0xE5, 0x26, 0xF0, 0x37, 0x4E, 0x86, 0x9B, 0xD8, 0x9E, 0x75, 0x4E, 0x69, 0xA2, 0x4D, 0x7F, 0x31,
-    0xD7, 0xDF, 0xD8, 0x5B, 0xB0, 0x3B, 0x35, 0xD3, 0xB2, 0xC8, 0x68, 0xB0, 0xD5, 0xAD, 0x19, 0x27,
-    0x65, 0x65, 0x06, 0x15, 0x88, 0x38, 0x3A, 0x35, 0x35, 0xE9, 0xE8, 0xC1, 0xB8, 0x4C, 0x81, 0x89,
-    0x29, 0x92, 0x95, 0xF8, 0xCE, 0xDC, 0x10, 0x93, 0x91, 0xF8, 0x8E, 0xAC, 0xC4, 0x77, 0xD4, 0x3A,
-    0xF8, 0x8E, 0x3C, 0xC5, 0x25, 0x71, 0x7A, 0x9C, 0xAC, 0xC4, 0x03, 0x59, 0x89, 0xEF, 0x38, 0x7E,
-    0x7C, 0x47, 0x0E, 0xE2, 0xBB, 0x49, 0xB7, 0x53, 0x06, 0xE1, 0x81, 0x52, 0x08, 0xDF, 0xD5, 0xCE,
-    0xFE, 0x9B, 0x06, 0x38, 0xD2, 0x14, 0xC5, 0xD7, 0x5F, 0x79, 0xEA, 0x3E, 0x8C, 0x6A, 0x5A, 0x8E,
-    0xB6, 0x09, 0x42, 0x67, 0xBA, 0x98, 0x29, 0x3C, 0x3B, 0x8A, 0x8B, 0x87, 0xF6, 0xD4, 0x86, 0x99,
-    0xBF, 0xCC, 0xBD, 0x34, 0x15, 0xA9, 0xB6, 0x9C, 0x57, 0xEB, 0x9F, 0xBE, 0xAB, 0xBA, 0xE0, 0x2F,
-    0x79, 0x8B, 0xBE, 0xA7, 0x9B, 0xFF, 0xEB, 0x14, 0x55, 0x99, 0xBE, 0xEF, 0x40, 0x6F, 0xB7, 0xD5,
-    0x5D, 0xEB, 0xD4, 0xD2, 0x59, 0xE9, 0x86, 0x68, 0x48, 0xD5, 0xA4, 0xE0, 0x2D, 0x53, 0x62, 0xE7,
-    0x6A, 0xFC, 0xAB, 0x0F, 0x00, 0x8F, 0x6F, 0x54, 0x4E, 0xD7, 0x5C, 0x72, 0x94, 0x10, 0xEA, 0xC6,
-    0x65, 0x4A, 0x92, 0x67, 0x95, 0x44, 0xB4, 0xBA, 0x9B, 0x2F, 0x8F, 0x2F, 0x78, 0x17, 0xC6, 0xE3,
-    0x5C, 0x94, 0x74, 0x0E, 0xB1, 0xAF, 0xDA, 0x72, 0xE1, 0x50, 0x0C, 0xFA, 0x47, 0x07, 0xCA, 0xEF,
-    0x7D, 0xE5, 0xF6, 0xBE, 0x92, 0x71, 0x7F, 0x32, 0x4E, 0xCE, 0x76, 0x28, 0x86, 0x17, 0x0B, 0x15,
-    0x7D, 0x34, 0xD1, 0x8E, 0x9F, 0xC4, 0x66, 0x13, 0x4E, 0xC3, 0xF6, 0x86, 0xA6, 0x5E, 0x91, 0xAF,
-    0xC6, 0x63, 0xE3, 0x70, 0xA2, 0xCA, 0xCF, 0xF9, 0x4C, 0x7A, 0x83, 0x53, 0x24, 0x63, 0x28, 0xA9,
-    0xF0, 0xFC, 0x91, 0xCC, 0x4C, 0xB7, 0xCA, 0xC5, 0x15, 0x79, 0x78, 0x6C, 0x8B, 0xF6, 0x45, 0x1D,
-    0x3B, 0x7C, 0xC5, 0xD7, 0x8F, 0xA8, 0x4A, 0xA0, 0xF7, 0xCA, 0x42, 0x3C, 0x0B, 0x19, 0xB7, 0x4F,
-    0x73, 0xC3, 0xAE, 0x03, 0x06, 0x2D, 0xDB, 0x44, 0xC6, 0x2C, 0x94, 0x96, 0x21, 0xD3, 0x40, 0x85,
-    0x30, 0x08, 0xF9, 0x79, 0xEA, 0xB2, 0xCA, 0x70, 0xEB, 0xC6, 0xEC, 0x0A, 0xF5, 0xEC, 0x64, 0xAC,
-    0xA2, 0xA4, 0x64, 0xA8, 0x72, 0x95, 0x91, 0x8A, 0x43, 0x02, 0x57, 0xA5, 0xB7, 0xE1, 0xCA, 0x30,
-    0x45, 0xB0, 0x0B, 0xA5, 0x64, 0xB0, 0xA3, 0x7C, 0x06, 0xC7, 0xB8, 0xC6, 0x10, 0xE1, 0xE7, 0x7D,
-    0xCA, 0xFD, 0x35, 0xEE, 0x95, 0x95, 0x7B, 0xC0, 0xA7, 0x45, 0x6F, 0x1E, 0x3E, 0xD5, 0xDB, 0x7E,
-    0x48, 0x57, 0x66, 0x06, 0xAA, 0x0F, 0x2B, 0xEE, 0xAA, 0xBE, 0x29, 0x29, 0xEC, 0x25, 0x89, 0x7B,
-    0x4D, 0xEA, 0x5E, 0x74, 0xD9, 0x99, 0xB8, 0x07, 0x6E, 0x21, 0x5D, 0x73, 0x0F, 0x6B, 0x37, 0xE9,
-    0xDE, 0x19, 0xBD, 0x9D, 0xB3, 0x7B, 0x57, 0x36, 0xF5, 0xA8, 0xB1, 0x07, 0x11, 0xA9, 0x6A, 0xC0,
-    0xA6, 0x85, 0xD1, 0x21, 0x77, 0x24, 0x78, 0xD6, 0x11, 0x61, 0x6D, 0x64, 0x08, 0x9C, 0x24, 0x81,
-    0x17, 0xC2, 0x91, 0xA6, 0xA6, 0x14, 0x22, 0xB5, 0xCA, 0x2A, 0x35, 0x81, 0xC8, 0x27, 0x2C, 0x2B,
-    0x7F, 0x74, 0x04, 0x2C, 0x9D, 0x9E, 0xBC, 0xEC, 0xA9, 0x2E, 0xC0, 0xC3, 0x25, 0x37, 0x7E, 0x4A,
-    0x66, 0x5C, 0xA7, 0x87, 0xCF, 0x48, 0x38, 0x29, 0xA0, 0x89, 0xD8, 0x25, 0xC2, 0xF9, 0x70, 0xDC,
-    0x84, 0xF6, 0xC8, 0xC8, 0xC6, 0x46, 0xF5, 0x4C, 0xCC, 0x7D, 0x4B, 0xD9, 0x18, 0x72, 0x27, 0xD3,
-    0xE4, 0xF2, 0xE9, 0x2E, 0xE4, 0xC6, 0x4D, 0x19, 0xC4, 0x6D, 0xE3, 0x70, 0xD6, 0x58, 0x44, 0xE3,
-    0x92, 0x8C, 0x22, 0xD6, 0x51, 0x25, 0x32, 0x92, 0xCC, 0xA4, 0x67, 0x55, 0x56, 0xB7, 0xCD, 0x84,
-    0x6B, 0xCB, 0x47, 0xBB, 0x99, 0x84, 0xF6, 0x98, 0x4F, 0x2E, 0x8C, 0x58, 0x93, 0x83, 0x91, 0x23,
-    0x18, 0xFD, 0xAD, 0x09, 0xEE, 0x78, 0x13, 0x6C, 0x7C, 0x5D, 0x45, 0x69, 0x27, 0x3F, 0x36, 0x45,
-    0xD7, 0x62, 0x77, 0xAB, 0x8F, 0x5D, 0x84, 0x6B, 0x5D, 0x93, 0xE1, 0x80, 0x05, 0x43, 0x53, 0x2C,
-    0xD9, 0xD8, 0x36, 0x67, 0x60, 0x21, 0xE9, 0xD4, 0xFC, 0xAB, 0xB9, 0xAB, 0x23, 0x28, 0x2D, 0xA1,
-    0x85, 0xFC, 0x00, 0xFA, 0x55, 0x2C, 0x8C, 0x9F, 0x97, 0xFD, 0xEC, 0xC3, 0xD0, 0xBA, 0x0E, 0xE7,
-    0xAA, 0xB2, 0x58, 0x84, 0x0A, 0x7A, 0xB0, 0x38, 0xA6, 0xD0, 0xCB, 0x56, 0xF2, 0x02, 0xF0, 0x79,
-    0x24, 0x7F, 0x85, 0xCA, 0x77, 0x68, 0x18, 0x5D, 0xDC, 0x0D, 0x4C, 0x8C, 0x33, 0xAF, 0x75, 0x37,
-    0x73, 0x40, 0x6A, 0x84, 0xE8, 0xD5, 0x9C, 0x51, 0xE5, 0x6B, 0xB4, 0x74, 0xFF, 0xB6, 0x76, 0xFD,
-    0x3C, 0xFF, 0x25, 0x77, 0x57, 0x88, 0x25, 0x9A, 0x88, 0xA2, 0x7D, 0x60, 0xCA, 0x8E, 0x2F, 0x41,
-    0x39, 0xD0, 0xD0, 0x5F, 0x84, 0x08, 0xFE, 0xAE, 0x59, 0x74, 0x6A, 0xD5, 0x99, 0x22, 0xDF, 0x77,
-    0x92, 0xF2, 0x15, 0x7D, 0xD8, 0x5E, 0x68, 0xDD, 0xC6, 0x32, 0xDB, 0xB7, 0x7E, 0xE3, 0x9E, 0x81,
-    0xD2, 0xBF, 0x6B, 0xA4, 0xFB, 0xCC, 0xFA, 0x47, 0xA9, 0xFA, 0xBB, 0x1A, 0x18, 0xD9, 0x30, 0x2C,
-    0xF2, 0xF8, 0xA8, 0x41, 0x11, 0xB5, 0xA1, 0xD7, 0xB6, 0xD3, 0x7A, 0xDD, 0x9B, 0xBE, 0x46, 0x79,
-    0x19, 0x2B, 0xEC, 0x55, 0xE0, 0x91, 0xF4, 0xA1, 0xDA, 0x2E, 0x10, 0xA3, 0xA4, 0x77, 0xDC, 0x98,
-    0xC1, 0x6A, 0x6A, 0xD0, 0x69, 0xC1, 0xD4, 0x68, 0x7D, 0xD9, 0x94, 0xE1, 0x81, 0xE9, 0xC2, 0x6B,
-    0xA6, 0x0A, 0xD7, 0x2A, 0x0E, 0xCC, 0x8E, 0xA3, 0x50, 0x1D, 0x54, 0xC4, 0xAA, 0xCD, 0xA7, 0x7E,
-    0xF3, 0xC3, 0xEA, 0xCA, 0xD3, 0x88, 0x07, 0x61, 0x4A, 0x91, 0xC4, 0xB5, 0x98, 0x72, 0x39, 0x64,
-    0xB4, 0xC8, 0xC9, 0xBD, 0x79, 0xA9, 0x72, 0x81, 0x88, 0x30, 0x4A, 0x68, 0x85, 0x65, 0xF8, 0xBE,
-    0xC4, 0x84, 0x72, 0x7C, 0x5C, 0xBE, 0x71, 0x51, 0xC8, 0xE7, 0xE4, 0xC9, 0x7F, 0x17, 0xBF, 0xFC,
-    0x9F, 0x61, 0xAA, 0xFF, 0x19, 0xE6, 0x72, 0x2C, 0x4F, 0xF1, 0xF7, 0xF1, 0xD4, 0xC3, 0x28, 0xE4,
-    0xBC, 0x3A, 0x79, 0xE3, 0x25, 0xCC, 0xCC, 0xC7, 0xD3, 0x3E, 0xE6, 0x16, 0xAC, 0xC0, 0x74, 0xCC,
-    0x2A, 0x6C, 0xC5, 0x3E, 0xEB, 0xF8, 0xD4, 0x94, 0x45, 0xD8, 0x62, 0x86, 0x51, 0x93, 0x57, 0x71,
-    0x83, 0x39, 0xC6, 0xF2, 0x94, 0x70, 0x96, 0x71, 0x95, 0x37, 0x97, 0x38, 0xBF, 0xA4, 0xC8, 0x9A,
-    0x6B, 0xFA, 0x24, 0x73, 0xEB, 0x29, 0x04, 0x53, 0x2F, 0xFD, 0x41, 0xC7, 0xD9, 0x5E, 0xF2, 0xD2,
-    0x3F, 0x69, 0xB9, 0xFA, 0x2F, 0x7B, 0xC9, 0x0F, 0x1B, 0x32, 0xE2, 0x00, 0x7B, 0x87, 0xAC, 0xD8,
-    0x47, 0x30, 0x95, 0x4C, 0xB8, 0x0D, 0x22, 0xD0, 0xF4, 0xE1, 0x0D, 0x0B, 0xF3, 0xE9, 0xB1, 0x8A,
-    0xBA, 0xA0, 0x1E, 0xA0, 0xC7, 0x9A, 0xB0, 0x0D, 0xB9, 0xAE, 0xB0, 0x8A, 0xA7, 0x58, 0x63, 0x3A,
-    0xC5, 0x1B, 0x6B, 0x17, 0x73, 0x9C, 0x22, 0x83, 0x53, 0xEC, 0xB1, 0x5E, 0x7A, 0x0D, 0xBB, 0xFE,
-    0x8D, 0x8B, 0x45, 0x4E, 0xF1, 0xC8, 0x29, 0x26, 0xA9, 0x71, 0x49, 0x17, 0x73, 0x8B, 0x5C, 0xC8,
-    0x0D, 0x03, 0x9C, 0x62, 0x94, 0x53, 0x9C, 0x72, 0x8A, 0x55, 0x4E, 0xF1, 0xCA, 0x29, 0x66, 0x39,
-    0xC5, 0x2D, 0xF3, 0xDD, 0x87, 0xE5, 0x48, 0x6B, 0x17, 0xC7, 0x74, 0xB1, 0xCC, 0x23, 0xBC, 0x14,
-    0xEB, 0xBB, 0x1E, 0x37, 0x3B, 0x61, 0xF6, 0xB5, 0x7A, 0x7D, 0xD8, 0x67, 0xA2, 0x95, 0xB0, 0x3B,
-    0x92, 0xDE, 0x85, 0x5D, 0x82, 0xAD, 0x7D, 0x88, 0x4E, 0x6B, 0xD4, 0x29, 0xD4, 0x05, 0xC3, 0xED,
-    0x75, 0xC5, 0x31, 0xD6, 0x55, 0xAA, 0x37, 0x3A, 0x34, 0x72, 0x53, 0x91, 0x51, 0x2E, 0x6F, 0x14,
-    0x74, 0xBE, 0xDE, 0x64, 0xA3, 0xF2, 0xA6, 0x5A, 0x57, 0x3E, 0x09, 0x8E, 0xA3, 0x7C, 0x12, 0x6E,
-    0xB2, 0xB9, 0x6D, 0x3A, 0x30, 0xC1, 0x46, 0xCF, 0x8C, 0x6F, 0x8A, 0xBD, 0x8E, 0xF1, 0x22, 0x8A,
-    0x83, 0xD4, 0x22, 0x3B, 0x87, 0xB3, 0x15, 0x35, 0xD9, 0xCF, 0xCE, 0x82, 0x3E, 0xAC, 0x1D, 0x4D,
-    0xDE, 0xCB, 0x29, 0x1D, 0x9D, 0x25, 0xF5, 0x1E, 0x4E, 0xE9, 0xDA, 0xF4, 0x70, 0xB4, 0xEB, 0x94,
-    0xF6, 0xC6, 0xAB, 0xF8, 0x43, 0x72, 0x4A, 0xA7, 0x91, 0xCA, 0x8C, 0x02, 0x75, 0x4A, 0x11, 0x95,
-    0xFB, 0x2B, 0xE5, 0x9E, 0x0A, 0x23, 0x99, 0xE9, 0x7F, 0xB0, 0x99, 0x53, 0x52, 0xBF, 0x7E, 0xA4,
-    0x32, 0x97, 0x26, 0x80, 0xBA, 0x35, 0xF8, 0x30, 0x5B, 0xA0, 0x8B, 0xDB, 0x30, 0x4D, 0x77, 0xE4,
-    0xF4, 0xF0, 0x9B, 0x32, 0xB9, 0x50, 0x27, 0x9A, 0xE8, 0xEC, 0x4A, 0x19, 0x77, 0x7C, 0xFC, 0xF4,
-    0x6C, 0xAF, 0x78, 0xC9, 0xDD, 0x17, 0x3F, 0xA9, 0x09, 0x9E, 0x66, 0x4E, 0xDB, 0xE8, 0xF5, 0xC3,
-    0x4D, 0xF0, 0x68, 0xF8, 0x53, 0xA3, 0x9F, 0xC9, 0x9B, 0x4F, 0x1E, 0x3F, 0xBE, 0x4D, 0x0A, 0x61,
-    0xF9, 0xED, 0x47, 0x30, 0xCA, 0x6B, 0x17, 0x31, 0xA2, 0x67, 0xF6, 0x41, 0x98, 0x67, 0x1E, 0x02,
-    0x5D, 0x1E, 0xFC, 0xE0, 0xA1, 0xFB, 0xF7, 0x93, 0x2B, 0x58, 0x64, 0x09, 0xB8, 0x0F, 0xC4, 0xCC,
-    0xBC, 0x4E, 0x1D, 0xD5, 0x7E, 0x46, 0x02, 0x4B, 0x9E, 0x77, 0xFE, 0xF0, 0x8A, 0x59, 0xF1, 0xFA,
-    0x93, 0xC8, 0x12, 0xA0, 0x66, 0xC7, 0xEF, 0xBD, 0x84, 0x19, 0x93, 0x41, 0xE0, 0x50, 0x3A, 0x3C,
-    0xF9, 0x0E, 0x22, 0x27, 0x75, 0x1B, 0x77, 0xB2, 0xE8, 0x45, 0x70, 0x25, 0x9D, 0xC8, 0x17, 0x11,
-    0xF7, 0x48, 0xBC, 0x21, 0x3A, 0x2D, 0xCC, 0x28, 0x2B, 0xE1, 0x30, 0x52, 0x70, 0x8D, 0x86, 0xC5,
-    0xF3, 0x06, 0xA1, 0xF0, 0x6A, 0xBA, 0x97, 0x8D, 0xC8, 0x1C, 0xF8, 0xE4, 0xE2, 0x59, 0xD0, 0x0E,
-    0xAF, 0xE8, 0x9D, 0xCB, 0x7F, 0xF2, 0xFB, 0x03, 0x57, 0x65, 0xEB, 0x6D, 0x61, 0x57, 0xA7, 0xD0,
-    0x3B, 0x42, 0x79, 0xB8, 0x10, 0x30, 0x28, 0xFC, 0xF1, 0xDF, 0x6F, 0x9F, 0x1C, 0x2C, 0x6F, 0xC2,
-    0x49, 0x3E, 0x7D, 0xF7, 0xB7, 0x77, 0xA3, 0xCB, 0xBD, 0xB9, 0x1F, 0x4A, 0x25, 0xFF, 0xC6, 0x0D,
-    0xCD, 0x81, 0x30, 0xA1, 0x40, 0x45, 0xE3, 0x95, 0xF4, 0xF9, 0x56, 0x2A, 0xFB, 0x91, 0x88, 0x68,
-    0x95, 0xBD, 0x69, 0xA1, 0x7F, 0xFF, 0xAC, 0xAD, 0xFB, 0xB5, 0x92, 0x41, 0x89, 0x19, 0x6C, 0x35,
-    0x6E, 0xED, 0x8F, 0xE6, 0x16, 0x8D, 0xE6, 0x13, 0xD5, 0xCE, 0x0B, 0x6A, 0x77, 0xEF, 0xF6, 0xEF,
-    0x81, 0xB9, 0x46, 0xD1, 0xF7, 0x54, 0x74, 0xA6, 0x8F, 0x29, 0x5D, 0x9F, 0x0D, 0x06, 0xF3, 0xC4,
-    0x46, 0xE3, 0x98, 0x66, 0x68, 0x1A, 0xCA, 0x63, 0xB8, 0x0C, 0x5C, 0xC3, 0xAF, 0x6A, 0xBC, 0x8A,
-    0x41, 0x79, 0xF9, 0xC0, 0xA3, 0xB1, 0x3A, 0x87, 0xC8, 0x85, 0x6C, 0xDE, 0x98, 0xFC, 0xF8, 0x2C,
-    0x07, 0x06, 0x87, 0x29, 0x30, 0xB8, 0xDD, 0x09, 0x0C, 0x7A, 0x6A, 0x63, 0xED, 0x86, 0x04, 0x7D,
-    0x87, 0xA2, 0xF0, 0xBB, 0x7B, 0x3F, 0xAC, 0x16, 0x62, 0x10, 0xC4, 0x12, 0x95, 0x8C, 0x2C, 0x13,
-    0x34, 0xB3, 0xAC, 0x89, 0x70, 0x74, 0xD2, 0xD9, 0x53, 0xE9, 0x4C, 0x5A, 0xAC, 0xF9, 0x0F, 0x91,
-    0x6D, 0xED, 0x53, 0x08, 0x83, 0x9E, 0x53, 0x8D, 0xD4, 0x9A, 0x87, 0xAA, 0xCA, 0xA6, 0x14, 0x4A,
-    0x30, 0x5E, 0x7F, 0x18, 0x8C, 0xB0, 0x28, 0x43, 0x36, 0x1E, 0x93, 0x1B, 0x57, 0x4D, 0x16, 0x9D,
-    0x1D, 0xAA, 0x3B, 0x2B, 0xB4, 0xA0, 0xB3, 0xA5, 0x41, 0x49, 0x3B, 0x66, 0x45, 0xBE, 0x3F, 0x2F,
-    0x52, 0x08, 0x23, 0x97, 0xC7, 0xAF, 0xC9, 0x7A, 0xA0, 0xC2, 0x10, 0xDE, 0xA7, 0x6B, 0xEC, 0x4A,
-    0x8D, 0x66, 0xE8, 0x68, 0x41, 0xE3, 0x74, 0xA5, 0xA4, 0xAA, 0x75, 0x9C, 0xBD, 0xE7, 0x82, 0x0B,
-    0x64, 0xE8, 0xE0, 0x99, 0xF8, 0xE7, 0x3A, 0xC8, 0xD5, 0x57, 0x61, 0x5A, 0xA8, 0x20, 0x23, 0x31,
-    0x1C, 0x19, 0x3B, 0x58, 0x89, 0x0F, 0xAC, 0x95, 0x99, 0xA1, 0xDA, 0xC6, 0x8C, 0xD5, 0xF4, 0xEE,
-    0x43, 0xF0, 0x29, 0x84, 0x64, 0xA8, 0x71, 0x81, 0xBF, 0x04, 0x8B, 0x6D, 0x28, 0xB5, 0xAE, 0x8C,
-    0x50, 0xF3, 0x87, 0xF8, 0xC0, 0xD0, 0x02, 0x4B, 0x9A, 0x37, 0xA4, 0x50, 0xD6, 0xA1, 0x90, 0x12,
-    0x1A, 0xC4, 0x23, 0x35, 0x30, 0xAA, 0x95, 0xB3, 0x83, 0xDC, 0x5F, 0x72, 0x12, 0x2D, 0x3D, 0x70,
-    0x5D, 0x29, 0xCC, 0x29, 0xD6, 0xEE, 0xF1, 0xFF, 0x13, 0xEA, 0x24, 0xA1, 0xFA, 0x05, 0xA1, 0xBA,
-    0x99, 0x50, 0x73, 0xB4, 0xA4, 0x9C, 0xF7, 0x48, 0x32, 0xE3, 0x02, 0x92, 0x39, 0xAA, 0x1E, 0x2F,
-    0x1E, 0xAB, 0x33, 0x1F, 0x77, 0x32, 0x55, 0x11, 0x23, 0x93, 0x31, 0x0D, 0xA6, 0xE4, 0x4D, 0x98,
-    0x4B, 0xE2, 0x62, 0xB4, 0x08, 0xAA, 0x81, 0x06, 0x17, 0x79, 0xDD, 0x27, 0x11, 0x1E, 0x3A, 0x2B,
-    0xAB, 0x7F, 0xA8, 0x71, 0xCE, 0x63, 0x08, 0xDE, 0x97, 0x64, 0x17, 0xC9, 0x0C, 0x73, 0x4E, 0x4E,
-    0x6D, 0x65, 0xD9, 0x70, 0xBA, 0x33, 0x63, 0xBD, 0x92, 0x78, 0x0A, 0xFC, 0x11, 0x1A, 0xC4, 0x6B,
-    0x0B, 0x61, 0x67, 0x8D, 0x59, 0xB8, 0x35, 0x94, 0xD2, 0x85, 0xD1, 0xBB, 0x40, 0x17, 0x20, 0x9F,
-    0xA2, 0xC0, 0x0C, 0x32, 0x6A, 0xFC, 0x40, 0x9F, 0xCC, 0x07, 0xE9, 0x4C, 0x8C, 0xCE, 0x8E, 0xF9,
-    0x1C, 0x43, 0x50, 0x19, 0x36, 0x4E, 0x26, 0xC6, 0xE0, 0x06, 0xEF, 0x3B, 0xEB, 0xD6, 0x36, 0xF5,
-    0xC8, 0x7D, 0x7D, 0xD5, 0x7E, 0x25, 0xC4, 0x9B, 0xF9, 0x83, 0x70, 0xB8, 0x39, 0x7A, 0x16, 0x4B,
-    0x90, 0x91, 0x59, 0x30, 0x01, 0x41, 0xAA, 0xB5, 0x67, 0xA1, 0x78, 0x0B, 0x27, 0xC0, 0xDD, 0xEE,
-    0x75, 0x45, 0x24, 0x3D, 0x25, 0x2F, 0xE7, 0xA5, 0x11, 0x05, 0x70, 0x5E, 0x43, 0x0A, 0x78, 0xD2,
-    0x98, 0x02, 0xEC, 0x78, 0x17, 0x54, 0xA0, 0x16, 0xB6, 0x48, 0xBD, 0xFA, 0x08, 0x08, 0xD6, 0x6B,
-    0x5C, 0x41, 0xB6, 0x88, 0x05, 0x16, 0xE4, 0x3A, 0xA5, 0xDE, 0x67, 0xCC, 0x05, 0xA9, 0xA0, 0x14,
-    0x78, 0x5F, 0x76, 0xD4, 0xF6, 0xAA, 0x9B, 0xA1, 0xCE, 0x4E, 0x67, 0xA6, 0xB3, 0xB2, 0xE4, 0x82,
-    0xFD, 0x87, 0x99, 0xCC, 0xDC, 0x51, 0xFB, 0x53, 0xAF, 0x59, 0x6B, 0xC9, 0x05, 0xCD, 0x2D, 0x70,
-    0xB4, 0x9A, 0x59, 0x70, 0x89, 0x05, 0x97, 0xD8, 0x5B, 0xC4, 0xF5, 0x02, 0x8D, 0xEB, 0xA9, 0x3D,
-    0x21, 0x1F, 0x72, 0x87, 0x88, 0xAF, 0x8B, 0x13, 0xC4, 0xA3, 0x9B, 0x6D, 0x83, 0x93, 0x57, 0x2E,
-    0x7F, 0xDF, 0x6D, 0x02, 0xC5, 0xF8, 0x68, 0xEC, 0x3C, 0x5B, 0x5A, 0xBA, 0x1A, 0xA9, 0x44, 0x5C,
-    0x4F, 0x66, 0x3C, 0xC7, 0xF5, 0x7A, 0xA6, 0x18, 0x64, 0xC8, 0x2B, 0x0C, 0x36, 0x19, 0x6E, 0x6E,
-    0x68, 0x7C, 0xC0, 0x66, 0xDA, 0xBB, 0x72, 0x06, 0xAA, 0xE6, 0xC8, 0x51, 0x37, 0x52, 0x27, 0x54,
-    0xFC, 0x5D, 0x19, 0xFD, 0x56, 0x59, 0x25, 0x9F, 0x50, 0xD3, 0xDB, 0x35, 0x0D, 0x22, 0x93, 0x01,
-    0xDF, 0xD5, 0x27, 0xC3, 0xC8, 0xD2, 0x95, 0x59, 0x49, 0x9C, 0xD1, 0xE0, 0x5C, 0x38, 0xA1, 0xFE,
-    0x58, 0x38, 0x31, 0x32, 0x7A, 0x26, 0x45, 0x68, 0x61, 0xE0, 0x49, 0x51, 0x73, 0x29, 0x8C, 0x6D,
-    0x6A, 0x50, 0x18, 0x54, 0x3D, 0x5D, 0x96, 0x0C, 0xD1, 0x12, 0x3E, 0xE5, 0x60, 0x85, 0x3E, 0x21,
-    0x62, 0xC2, 0x27, 0xB1, 0xDC, 0xD3, 0x96, 0x4F, 0x14, 0x81, 0x18, 0x14, 0xC5, 0x5E, 0xE3, 0x9C,
-    0xEA, 0xBC, 0x21, 0x9C, 0x82, 0x89, 0x1D, 0xFC, 0x04, 0xC3, 0x2B, 0x0B, 0xC3, 0x3E, 0x60, 0x48,
-    0x79, 0x1B, 0x58, 0x94, 0x47, 0x28, 0xD3, 0xAB, 0x27, 0xE5, 0xCF, 0xA0, 0x48, 0x47, 0xA1, 0x73,
-    0xB5, 0xFA, 0x53, 0xB5, 0xFA, 0x55, 0xD1, 0x78, 0x78, 0xD4, 0x29, 0x42, 0xCB, 0x19, 0x0C, 0xB6,
-    0x84, 0xA7, 0x3D, 0x57, 0x5A, 0xDC, 0xCE, 0xC5, 0x03, 0x9C, 0xD1, 0x60, 0x5B, 0x4F, 0x97, 0x63,
-    0x5D, 0xA9, 0x3A, 0xCD, 0x35, 0x66, 0x21, 0x63, 0x78, 0x62, 0xE3, 0xCD, 0x19, 0x30, 0x31, 0x75,
-    0x5F, 0xB2, 0x55, 0xA0, 0x86, 0x7E, 0xBE, 0xD2, 0x75, 0x52, 0x37, 0xBC, 0x8B, 0x5D, 0xCB, 0x7D,
-    0x25, 0x8E, 0xB3, 0x9A, 0x34, 0x6B, 0xB5, 0x68, 0xB2, 0xCE, 0xC4, 0x41, 0xCB, 0x3B, 0xF8, 0x8E,
-    0xDD, 0x94, 0x0E, 0x1A, 0xA4, 0x43, 0x84, 0x57, 0xC3, 0x9B, 0xE7, 0x35, 0x5A, 0xFF, 0x8A, 0x97,
-    0xBE, 0x53, 0x8A, 0x9F, 0x2D, 0xD6, 0xB1, 0x8C, 0x2B, 0xE9, 0xE0, 0xF0, 0xAD, 0xE4, 0x8D, 0x49,
-    0x9B, 0xC0, 0x4C, 0x86, 0x70, 0xC2, 0x16, 0xCD, 0x61, 0x0D, 0xE7, 0x45, 0x0D, 0x64, 0x0E, 0x8C,
-    0x62, 0x9D, 0xD6, 0x08, 0x73, 0x78, 0x04, 0x5C, 0x64, 0xF4, 0x7E, 0x41, 0xB6, 0x6D, 0xB1, 0xBF,
-    0xF5, 0xCA, 0xD7, 0xBA, 0xE1, 0x81, 0x4C, 0x34, 0xD9, 0x36, 0xA6, 0x03, 0x77, 0xC5, 0xCC, 0xF9,
-    0x80, 0x2B, 0xF5, 0x42, 0x43, 0xF0, 0x59, 0x45, 0x1F, 0xCF, 0x4D, 0x36, 0x19, 0xFF, 0x1A, 0x13,
-    0x7C, 0x63, 0x82, 0x1B, 0xA8, 0xBD, 0x14, 0xAE, 0xCE, 0x0B, 0x0B, 0xC2, 0x3F, 0x60, 0x6A, 0xED,
-    0xDB, 0x6F, 0x0A, 0xD7, 0x12, 0x0C, 0x13, 0xC1, 0xF7, 0xB0, 0xA7, 0x86, 0xDC, 0x30, 0xC8, 0xEE,
-    0xA4, 0xAE, 0xAC, 0x12, 0x5C, 0x9B, 0xF9, 0x5A, 0x32, 0xD7, 0x53, 0x12, 0x22, 0xA2, 0x9A, 0x14,
-    0xFA, 0x67, 0x02, 0xC4, 0x11, 0x87, 0x97, 0xAC, 0x68, 0x49, 0x0D, 0x64, 0x2A, 0xA3, 0x95, 0x9E,
-    0xAF, 0x9C, 0xC7, 0xDB, 0x03, 0xBC, 0x3C, 0x7D, 0x53, 0x48, 0x58, 0xCB, 0x4A, 0x17, 0x47, 0x26,
-    0x5D, 0x85, 0x70, 0x23, 0x84, 0x38, 0x59, 0xA3, 0xDE, 0x44, 0x73, 0x6E, 0x0B, 0xE0, 0x12, 0x09,
-    0x0B, 0xB7, 0x41, 0x86, 0x54, 0x63, 0x8F, 0xD0, 0xD5, 0x26, 0xAD, 0x4A, 0x5E, 0x84, 0x11, 0x78,
-    0xAB, 0xEC, 0x15, 0xE4, 0x67, 0x23, 0xBC, 0x50, 0x57, 0x1B, 0x17, 0x9A, 0x7F, 0x48, 0xB3, 0x0F,
-    0xDE, 0x0B, 0xB6, 0x41, 0x0F, 0x27, 0xBF, 0x59, 0x80, 0xD9, 0x26, 0x89, 0x4D, 0x59, 0x0B, 0xB7,
-    0x55, 0x08, 0x40, 0xF6, 0x5A, 0x68, 0xB5, 0xD9, 0x41, 0xC1, 0x09, 0xA3, 0x1E, 0xC4, 0x94, 0x5F,
-    0x16, 0xDA, 0x44, 0x2B, 0x38, 0x85, 0x48, 0x55, 0x0E, 0xC6, 0x77, 0x31, 0xD7, 0xAE, 0x83, 0xEC,
-    0xF2, 0x79, 0x7B, 0xFC, 0x08, 0x95, 0x26, 0x53, 0xC4, 0xC2, 0xC2, 0x1A, 0x2E, 0x44, 0xB5, 0x17,
-    0x02, 0x1A, 0xF5, 0x13, 0xA1, 0xF6, 0x5B, 0x30, 0x46, 0xBD, 0x74, 0x03, 0xED, 0xB6, 0xA1, 0x42,
-    0x4B, 0x40, 0x74, 0x9A, 0x95, 0xC8, 0x0E, 0xAD, 0x4B, 0x24, 0xD5, 0x6A, 0x80, 0x71, 0x08, 0xC5,
-    0xC1, 0x05, 0x01, 0xBF, 0xB4, 0x81, 0xE4, 0xAB, 0xE0, 0x56, 0x81, 0xF8, 0x58, 0xB3, 0xC2, 0xC2,
-    0xF8, 0x98, 0xDE, 0x35, 0x46, 0xB5, 0x57, 0x2C, 0xD6, 0x24, 0x28, 0xCE, 0xED, 0x53, 0x56, 0x3E,
-    0x58, 0x19, 0x62, 0xAB, 0xC5, 0x08, 0x06, 0x09, 0xC5, 0x85, 0x0F, 0x0D, 0x84, 0x5C, 0x83, 0x20,
-    0xD1, 0x7F, 0x15, 0xF5, 0xCD, 0xF0, 0x6C, 0xFD, 0x9D, 0x69, 0xE6, 0x93, 0x8B, 0xEF, 0x74, 0xE3,
-    0x2F, 0xCB, 0x5E, 0xA5, 0x33, 0xCF, 0x54, 0xEF, 0xE0, 0xB6, 0xB6, 0x72, 0xF9, 0xDC, 0x15, 0x04,
-    0x37, 0xE5, 0xC3, 0x6B, 0x99, 0x19, 0xF6, 0x54, 0xF8, 0xCE, 0x10, 0xAC, 0xCA, 0x46, 0xD6, 0x7F,
-    0xF3, 0x5C, 0x28, 0xDC, 0x95, 0x3D, 0x50, 0x3C, 0x07, 0x9D, 0x96, 0x36, 0xB9, 0xF7, 0x55, 0xCC,
-    0x27, 0xAB, 0x5E, 0xD5, 0xB8, 0x47, 0x5E, 0x58, 0x98, 0x39, 0xFF, 0x9A, 0x3E, 0xBC, 0x59, 0x3E,
-    0xB1, 0x76, 0xC1, 0x27, 0x2E, 0xE1, 0xF4, 0xAD, 0x51, 0x77, 0x71, 0xDA, 0x6C, 0x23, 0x0D, 0x53,
-    0x54, 0x1B, 0x7D, 0xC8, 0x7D, 0x7B, 0x28, 0x83, 0x0D, 0x34, 0xE9, 0x81, 0xF7, 0x6A, 0xB8, 0x96,
-    0x99, 0x16, 0xAF, 0x7A, 0x72, 0x0B, 0x37, 0x7E, 0x73, 0x27, 0xEC, 0xC2, 0x2E, 0x18, 0xA2, 0xA6,
-    0xFC, 0xDD, 0x46, 0x7E, 0x55, 0x46, 0x97, 0x0D, 0x5E, 0xBC, 0x42, 0x1C, 0x56, 0xC7, 0xEE, 0x17,
-    0xD3, 0xBA, 0x81, 0xAA, 0x78, 0x62, 0x0B, 0xAB, 0x63, 0x44, 0x18, 0xB8, 0x44, 0x88, 0x59, 0xA8,
-    0x0D, 0x7A, 0x9B, 0x2E, 0x84, 0x94, 0xD9, 0x7B, 0x72, 0x45, 0x51, 0xE0, 0x79, 0x5F, 0xB8, 0x09,
-    0x86, 0x87, 0xBD, 0xF3, 0xCE, 0x65, 0x69, 0x3D, 0x80, 0xCB, 0x01, 0xBE, 0xBD, 0xC3, 0x38, 0x1C,
-    0x88, 0x92, 0xBF, 0x59, 0xC3, 0x3E, 0x9A, 0xD6, 0x8D, 0x39, 0xE3, 0xF8, 0x4D, 0x31, 0x54, 0x7C,
-    0xE2, 0xEB, 0xF0, 0xC1, 0x7C, 0xB3, 0xCF, 0x7D, 0x89, 0xB5, 0x4D, 0x51, 0x1F, 0xD3, 0x0F, 0xC1,
-    0x55, 0xF3, 0xE0, 0x90, 0x29, 0xCC, 0x9A, 0x31, 0xE8, 0xAD, 0x38, 0xB5, 0x92, 0xDB, 0x51, 0x56,
-    0x60, 0xDA, 0x60, 0x1D, 0x66, 0x4D, 0x94, 0x43, 0x98, 0x7F, 0x31, 0x87, 0xB8, 0xBE, 0x95, 0xFF,
-    0xA6, 0x50, 0x72, 0x95, 0x23, 0x35, 0x5E, 0x60, 0xB5, 0x5F, 0xE1, 0x8C, 0xED, 0xEB, 0x65, 0xE1,
-    0x2B, 0x3E, 0xFA, 0x65, 0xAC, 0xD1, 0xA0, 0x9D, 0x52, 0x31, 0x2A, 0x3D, 0xF7, 0x4E, 0x64, 0x61,
-    0x3E, 0x09, 0x63, 0xCE, 0xE0, 0xE5, 0xC3, 0xC0, 0xCB, 0xE0, 0x24, 0x53, 0x7C, 0x0F, 0xF4, 0xEB,
-    0x41, 0x76, 0x8C, 0xA4, 0x67, 0xAA, 0x83, 0xE6, 0x39, 0xE2, 0x2D, 0xE1, 0xF1, 0x73, 0xAA, 0x0F,
-    0xB0, 0x21, 0xEF, 0xD2, 0xA0, 0x60, 0xB8, 0x5C, 0x56, 0x20, 0x23, 0xC0, 0xF4, 0x6B, 0x5B, 0x28,
-    0xB8, 0x94, 0x4A, 0x2F, 0x6B, 0x82, 0xC1, 0x69, 0xEA, 0xBC, 0x00, 0x74, 0xAF, 0x74, 0x21, 0x32,
-    0x97, 0x91, 0xA7, 0x97, 0x8E, 0x6B, 0xD4, 0xE0, 0xF5, 0x51, 0x85, 0x6B, 0x5C, 0xC0, 0x98, 0x4E,
-    0x30, 0x49, 0x2F, 0xA5, 0x16, 0xB9, 0x48, 0x55, 0xB6, 0x8F, 0x4F, 0x91, 0x6B, 0x49, 0x1C, 0x5C,
-    0xCD, 0xDA, 0x87, 0x9A, 0x1E, 0xEB, 0xC0, 0x14, 0xC6, 0x96, 0x18, 0x13, 0x40, 0xDB, 0xB1, 0x4D,
-    0xE5, 0xD7, 0xE4, 0x5A, 0x02, 0x23, 0xF1, 0x40, 0x09, 0x9F, 0x62, 0x83, 0xD8, 0x40, 0xBD, 0xDA,
-    0x3B, 0xC1, 0x0D, 0xF0, 0x07, 0x6A, 0x1B, 0x88, 0x8B, 0xC4, 0x9E, 0xB3, 0x5E, 0xEF, 0x65, 0xA7,
-    0xFE, 0x24, 0x46, 0x98, 0x6C, 0xBD, 0xE0, 0x6D, 0xF9, 0x84, 0x47, 0x06, 0x2F, 0xFA, 0xBE, 0x8C,
-    0xEF, 0xE2, 0x1D, 0x2F, 0x81, 0xA6, 0xDB, 0x2F, 0xBD, 0x4B, 0x18, 0xA9, 0xDC, 0xAF, 0x61, 0xAC,
-    0xAF, 0xE4, 0x5E, 0x87, 0xD1, 0x76, 0xF9, 0xA3, 0xB2, 0x21, 0x65, 0x74, 0xF9, 0xD7, 0x9B, 0x12,
-    0xE3, 0xCB, 0xBE, 0x0D, 0x4D, 0x15, 0x35, 0xD9, 0xDF, 0xD2, 0x5F, 0xAA, 0xD2, 0x0D, 0xC6, 0x5D,
-    0x42, 0x5C, 0x0E, 0x18, 0x27, 0x62, 0x42, 0x7B, 0x32, 0x52, 0x71, 0x1F, 0xEA, 0x41, 0xC6, 0x2A,
-    0xAE, 0x41, 0xDE, 0xEB, 0x48, 0xF7, 0x8A, 0x89, 0x63, 0x9E, 0x5B, 0x35, 0xDE, 0x68, 0xCE, 0x37,
-    0x0C, 0xE0, 0x53, 0x6B, 0xC7, 0xEC, 0xFB, 0xE3, 0xC3, 0xA7, 0x98, 0x54, 0x11, 0x49, 0x13, 0xDD,
-    0xBD, 0xA1, 0x60, 0x90, 0x8C, 0xAB, 0x46, 0xAF, 0xA6, 0x7E, 0xB0, 0x76, 0x70, 0x85, 0x06, 0xA2,
-    0xD9, 0x20, 0xAB, 0x46, 0xBE, 0xCD, 0xC7, 0x02, 0x80, 0xED, 0x8D, 0xDB, 0xDB, 0xA7, 0x34, 0x50,
-    0x02, 0x80, 0x4F, 0xD4, 0xC3, 0xAB, 0x58, 0xD3, 0x8A, 0x82, 0x03, 0xB5, 0xA1, 0xAE, 0xE3, 0x45,
-    0x96, 0x66, 0xB8, 0x11, 0xD9, 0x17, 0xAE, 0x31, 0xF3, 0x1E, 0xA0, 0x9E, 0x49, 0x04, 0x67, 0x0D,
-    0x5F, 0x85, 0xE5, 0x81, 0x84, 0xD8, 0x06, 0xD2, 0x77, 0xB5, 0x23, 0x7D, 0xBD, 0xF3, 0x98, 0xF1,
-    0xA3, 0x32, 0xF6, 0x0B, 0x63, 0x02, 0x16, 0x8C, 0x17, 0xA1, 0x6C, 0x86, 0x97, 0xE9, 0xDD, 0x21,
-    0x8D, 0x28, 0xEB, 0x1D, 0x33, 0x1E, 0x39, 0xE3, 0xED, 0xEC, 0xD1, 0x9C, 0xB9, 0x5B, 0xEE, 0x35,
-    0xE3, 0xFC, 0xF4, 0x8C, 0xB7, 0xD3, 0x8C, 0x21, 0xD9, 0x82, 0xB1, 0x83, 0x88, 0xAB, 0x7F, 0x84,
-    0x95, 0x9F, 0xFC, 0x8F, 0x56, 0x26, 0x94, 0xFC, 0x39, 0x3F, 0xE8, 0x7F, 0x11, 0xD4, 0xDA, 0x19,
-    0x9A, 0x5D, 0x2D, 0xAF, 0xDC, 0xA2, 0x77, 0xF6, 0xB9, 0xA5, 0xA7, 0x9A, 0x16, 0xFF, 0x0D, 0x66,
-    0x75, 0x41, 0x6F, 0x12, 0xB8, 0xE3, 0xBB, 0x7D, 0x9E, 0xAE, 0xCC, 0x3C, 0x08, 0xC7, 0xEF, 0x6E,
-    0xE9, 0x07, 0x62, 0x37, 0x74, 0x57, 0x4F, 0xA0, 0xA3, 0xD5, 0xC9, 0x4C, 0x9B, 0x39, 0x5E, 0x69,
-    0x71, 0xDC, 0xBB, 0x26, 0x53, 0x4E, 0xDA, 0x09, 0x40, 0x42, 0xC8, 0x58, 0xE4, 0x3D, 0x19, 0xB4,
-    0x56, 0x8A, 0x64, 0xC8, 0xCF, 0x2D, 0x71, 0xE5, 0x95, 0xD3, 0x4B, 0x75, 0xB1, 0xAB, 0xB0, 0x4E,
-    0x69, 0xAD, 0x6F, 0x9E, 0xAD, 0xB5, 0xC8, 0xA5, 0xAB, 0xCA, 0x27, 0x11, 0x31, 0xE4, 0x94, 0x58,
-    0x5B, 0xE4, 0xD5, 0x2D, 0x99, 0x96, 0x70, 0xEB, 0x18, 0xD6, 0x89, 0xF0, 0xEB, 0xDD, 0x22, 0x81,
-    0xDD, 0x8F, 0x30, 0xE8, 0x0A, 0x3C, 0x13, 0x56, 0xB5, 0xE0, 0x5A, 0xAF, 0xF2, 0x82, 0xCE, 0x8D,
-    0x72, 0x2E, 0xAF, 0x94, 0x77, 0x79, 0xA1, 0xDC, 0x2B, 0x8D, 0x7F, 0xB5, 0x71, 0xB0, 0x36, 0xA3,
-    0x69, 0x30, 0x2E, 0x0E, 0x66, 0x3B, 0x0D, 0x46, 0xF1, 0x71, 0x2F, 0x27, 0xCD, 0xC7, 0x2D, 0x4D,
-    0x1D, 0xE6, 0x8F, 0x67, 0x29, 0xBC, 0x27, 0x54, 0x06, 0x9F, 0xFC, 0x9A, 0xF9, 0xD6, 0x8C, 0xE8,
-    0x9F, 0x84, 0xA1, 0x4D, 0xA0, 0xA4, 0xB8, 0x64, 0x62, 0x06, 0x0E, 0x92, 0x8A, 0x09, 0x87, 0x82,
-    0x2C, 0xA2, 0x48, 0x3C, 0x60, 0x61, 0xCB, 0x3E, 0x75, 0xD8, 0x2B, 0xA4, 0x13, 0xF3, 0xE6, 0x8F,
-    0xD2, 0x91, 0xFC, 0x16, 0x0D, 0xDE, 0xEF, 0x93, 0x47, 0xFF, 0xCD, 0x53, 0x58, 0xC6, 0xE4, 0x3D,
-    0xA9, 0x72, 0x8D, 0x9A, 0xD9, 0xEB, 0xCF, 0x1C, 0x68, 0x48, 0xD8, 0xD5, 0x4F, 0x2E, 0x14, 0x3D,
-    0x35, 0xAF, 0xA4, 0x4D, 0xAC, 0xE3, 0x9E, 0xA5, 0xD5, 0x39, 0x0D, 0x37, 0xE7, 0x5A, 0x80, 0xB1,
-    0xE5, 0xD2, 0x08, 0xD6, 0x8C, 0xB9, 0x8A, 0x66, 0x2E, 0xA6, 0xB7, 0xB8, 0x1C, 0x88, 0xAE, 0x97,
-    0xF3, 0xE9, 0x6B, 0x57, 0xB8, 0xA6, 0xFE, 0x1C, 0xE2, 0xF8, 0x07, 0xE3, 0x30, 0x62, 0xCF, 0xE5,
-    0x6D, 0x06, 0x50, 0x49, 0x2E, 0x4C, 0x41, 0x36, 0x45, 0x3D, 0xE4, 0x5A, 0x9D, 0x62, 0x04, 0xAA,
-    0x89, 0xB2, 0x9B, 0x6E, 0xB4, 0x7C, 0xE4, 0x56, 0x00, 0x6B, 0xB6, 0xAA, 0x81, 0x41, 0x49, 0xDB,
-    0x1A, 0x1B, 0x2D, 0x13, 0x53, 0x2A, 0xC2, 0x16, 0xA0, 0x82, 0x2E, 0x8B, 0x12, 0x3C, 0x93, 0x8F,
-    0x17, 0x51, 0x8E, 0xF8, 0x43, 0x93, 0xAF, 0x90, 0xD4, 0x7C, 0x77, 0x3C, 0x16, 0x0F, 0x20, 0x1A,
-    0x6F, 0x72, 0x7F, 0x5F, 0xCD, 0x9F, 0x2F, 0x16, 0x79, 0x98, 0x5C, 0xB7, 0x7B, 0xA9, 0x08, 0x87,
-    0x41, 0xC1, 0x49, 0x1B, 0xB5, 0x45, 0x14, 0x11, 0xF5, 0x5D, 0xAD, 0x3A, 0x18, 0xDD, 0x96, 0x5C,
-    0x6A, 0xD2, 0x0E, 0x46, 0x77, 0x26, 0xC6, 0xD7, 0x75, 0xEC, 0x21, 0xB8, 0x5D, 0x5B, 0x42, 0x74,
-    0x06, 0xC2, 0x1C, 0x6B, 0xA6, 0xE8, 0xF3, 0x23, 0xCF, 0x25, 0x8C, 0x5D, 0x29, 0xCB, 0xC2, 0xD5,
-    0xCD, 0xA9, 0x93, 0x7E, 0x9F, 0x81, 0xDC, 0x1F, 0x6D, 0xC9, 0x25, 0xFA, 0x85, 0x15, 0x01, 0x6E,
-    0x1C, 0x25, 0x2D, 0xF8, 0x2F, 0xD3, 0xCA, 0xCF, 0x3B, 0xE3, 0xEB, 0xC7, 0xAA, 0xC6, 0xFF, 0x5D,
-    0x41, 0x35, 0x5E, 0x40, 0x8D, 0xBF, 0x4B, 0x35, 0xFE, 0x0D, 0x8E, 0xE0, 0x11, 0x52, 0x84, 0x06,
-    0x60, 0xC6, 0x51, 0xD1, 0x33, 0x0F, 0xB8, 0x88, 0xC2, 0x7E, 0x06, 0x79, 0x06, 0x13, 0xC2, 0x67,
-    0x2B, 0xEF, 0x3F, 0xC2, 0x98, 0xB0, 0xE7, 0x10, 0x3E, 0x49, 0x60, 0xFB, 0xA6, 0x30, 0xE9, 0xD2,
-    0x86, 0xFA, 0x81, 0x7E, 0x09, 0x06, 0x26, 0x6B, 0x83, 0x5E, 0xB5, 0x4C, 0x50, 0x8C, 0x75, 0xC0,
-    0x10, 0x57, 0x83, 0x2B, 0xED, 0x52, 0x33, 0xCD, 0x05, 0xBF, 0xA1, 0x65, 0xF1, 0x72, 0x7A, 0xC2,
-    0xAB, 0x9D, 0x45, 0x9B, 0x8F, 0x4A, 0x0E, 0xA5, 0x52, 0xD4, 0x29, 0x9D, 0xE4, 0x45, 0xA4, 0x94,
-    0x88, 0x84, 0x8D, 0x92, 0x45, 0xA9, 0x95, 0xB4, 0xFA, 0xC3, 0xB4, 0xE1, 0x0F, 0xEF, 0x2F, 0x12,
-    0x72, 0x13, 0x09, 0x04, 0x29, 0x81, 0x7A, 0x55, 0x00, 0x91, 0x10, 0x08, 0x99, 0xB6, 0x98, 0x51,
-    0xED, 0x7D, 0x7E, 0x2B, 0x9F, 0xF0, 0x48, 0x59, 0x7C, 0x75, 0x4B, 0x2A, 0xC2, 0x17, 0x24, 0x1D,
-    0xC5, 0x1D, 0x0C, 0xC7, 0x2A, 0x19, 0xA0, 0xE2, 0xAF, 0x7A, 0x93, 0x53, 0xF8, 0x09, 0x1C, 0xEF,
-    0xE7, 0x6D, 0xBC, 0x83, 0x8D, 0xF7, 0x6F, 0x6C, 0xBC, 0x5F, 0xB1, 0xE1, 0x5E, 0x33, 0xD1, 0x60,
-    0x22, 0xAE, 0xB4, 0xA4, 0x96, 0x8A, 0x08, 0x2F, 0x1E, 0x76, 0xC3, 0x93, 0x89, 0xFD, 0xD5, 0x03,
-    0x53, 0x49, 0x98, 0x78, 0x2B, 0x19, 0x2E, 0x39, 0x4C, 0x79, 0x9A, 0x58, 0xAF, 0x90, 0xAB, 0xF1,
-    0x8A, 0xDE, 0x81, 0xED, 0x4B, 0x1F, 0x1A, 0x29, 0x44, 0xC0, 0x26, 0xEA, 0xD4, 0xD5, 0xAF, 0x61,
-    0xA5, 0x89, 0x07, 0x04, 0x75, 0xA7, 0x17, 0x58, 0xF8, 0xAC, 0x28, 0x8B, 0xFB, 0x40, 0x68, 0x35,
-    0x3C, 0xD5, 0x1B, 0x9E, 0x6C, 0xB1, 0x61, 0xA1, 0xA3, 0xA2, 0x71, 0x05, 0xE8, 0x79, 0x50, 0x6B,
-    0x28, 0x47, 0xDC, 0x58, 0x05, 0x87, 0x70, 0x1D, 0xD9, 0x2D, 0xAF, 0x18, 0xD7, 0xCB, 0x0B, 0xAE,
-    0xE1, 0x52, 0x35, 0x62, 0x8D, 0x6A, 0xB1, 0x0D, 0x49, 0x28, 0x63, 0x18, 0x74, 0x14, 0x5B, 0xCC,
-    0xAD, 0x7C, 0x7E, 0x43, 0x62, 0xFF, 0xE6, 0x86, 0xF5, 0x65, 0xDF, 0xE2, 0x77, 0xE5, 0x63, 0xE4,
-    0xC8, 0x88, 0xAD, 0x27, 0x23, 0x0A, 0x37, 0x0F, 0x89, 0x57, 0xDD, 0x07, 0x44, 0xB4, 0x0A, 0x03,
-    0x5A, 0x8E, 0x6B, 0x6F, 0x1E, 0x17, 0xF6, 0xB1, 0x0B, 0xD1, 0x6D, 0x77, 0x16, 0x77, 0x30, 0xD5,
-    0x6A, 0x31, 0xA1, 0x10, 0xA1, 0x66, 0x2D, 0x26, 0x1D, 0xE0, 0x04, 0x92, 0xB1, 0x7A, 0x69, 0xF5,
-    0xA9, 0x84, 0x9E, 0xAD, 0x8B, 0x08, 0x90, 0x90, 0x60, 0x78, 0x72, 0x0D, 0xA9, 0xDE, 0x1A, 0x1D,
-    0xCC, 0x41, 0x42, 0x6C, 0xEA, 0x89, 0xCD, 0xE4, 0x20, 0xC9, 0x7C, 0x19, 0x20, 0x29, 0x2C, 0x6A,
-    0xD2, 0x2C, 0x2A, 0xBF, 0xE8, 0x2C, 0x67, 0x1A, 0xF4, 0xC9, 0x1D, 0x43, 0xE4, 0xCF, 0x1E, 0x50,
-    0x4B, 0x5D, 0xB6, 0xF1, 0xAB, 0x74, 0x18, 0x69, 0xCC, 0xFC, 0xCF, 0xD1, 0xE1, 0x66, 0x0E, 0xE7,
-    0xB8, 0x11, 0xEC, 0xC6, 0x1A, 0xCA, 0x59, 0x5D, 0xDC, 0x11, 0xD2, 0x05, 0x56, 0x67, 0x8D, 0x3F,
-    0xDE, 0x0A, 0xF9, 0x83, 0x8D, 0xBF, 0x61, 0x0E, 0x87, 0xBE, 0x9F, 0xBF, 0xD5, 0x62, 0xB7, 0x6D,
-    0x78, 0xFC, 0x14, 0x42, 0xE6, 0x9C, 0xB4, 0xFC, 0xE4, 0x6E, 0x0D, 0xF3, 0x2E, 0xEE, 0xE8, 0x5E,
-    0x8B, 0xD5, 0x0F, 0x1D, 0xC9, 0x5B, 0xDC, 0x25, 0x2D, 0xCD, 0xAB, 0x14, 0x31, 0x88, 0xAC, 0xC9,
-    0x48, 0x84, 0x42, 0xF6, 0x40, 0x2F, 0x1F, 0x9E, 0x17, 0x01, 0xD6, 0x42, 0xE9, 0x74, 0x9B, 0xAD,
-    0x87, 0xBD, 0x43, 0x5D, 0x57, 0xC8, 0x05, 0x0F, 0x80, 0x2D, 0x69, 0x41, 0xA0, 0x66, 0x37, 0x6B,
-    0x28, 0x75, 0x5C, 0xB7, 0x0C, 0xC6, 0xC2, 0x16, 0xAF, 0xC0, 0x05, 0xD1, 0x59, 0x48, 0xAC, 0x69,
-    0x2C, 0x4A, 0x9D, 0xDA, 0xE1, 0xC9, 0xCE, 0xE3, 0xB0, 0x10, 0x8B, 0x80, 0xE2, 0x4B, 0x57, 0x09,
-    0xD3, 0x68, 0x09, 0xB1, 0xA1, 0x72, 0xF5, 0xB1, 0x54, 0xAA, 0x2F, 0x23, 0xA9, 0xD1, 0xE6, 0x30,
-    0x61, 0x68, 0x60, 0xCA, 0x20, 0xFC, 0xDF, 0x9B, 0x22, 0xB3, 0xA5, 0xE7, 0x96, 0x3B, 0x63, 0xF6,
-    0x41, 0xBB, 0x53, 0x46, 0xF2, 0xB1, 0x06, 0x02, 0x82, 0x55, 0x5C, 0xC9, 0x36, 0x4B, 0xA1, 0x22,
-    0x90, 0x56, 0xE9, 0x90, 0x50, 0x28, 0xFC, 0x1D, 0xFF, 0xF1, 0xE3, 0x1C, 0x90, 0x7F, 0xE3, 0x05,
-    0x2C, 0xFC, 0xCE, 0x61, 0x3B, 0x35, 0x77, 0xD9, 0x32, 0xAC, 0x30, 0xE0, 0xB2, 0x75, 0x29, 0x4A,
-    0x86, 0xFC, 0x8B, 0x5F, 0x93, 0x0F, 0x8C, 0xF0, 0xBA, 0x54, 0xFE, 0x66, 0xD8, 0x17, 0xF5, 0xBF,
-    0x5D, 0x85, 0xBD, 0x3F, 0xCA, 0xE8, 0x68, 0xAA, 0x8B, 0xCC, 0xA3, 0xF2, 0x89, 0x35, 0xB8, 0x47,
-    0x39, 0x49, 0x21, 0x49, 0xF1, 0x49, 0xD9, 0x49, 0xC1, 0x49, 0xDB, 0x8E, 0x86, 0x1D, 0x4D, 0x3E,
-    0xDA, 0x79, 0xE5, 0xC9, 0xAD, 0xA9, 0xBB, 0xB2, 0x77, 0xA6, 0x4F, 0xE2, 0x4C, 0x5B, 0x62, 0x14,
-    0x2D, 0xBF, 0xFD, 0xA5, 0xEB, 0x6E, 0x8E, 0x0C, 0x3C, 0xAC, 0x0D, 0x40, 0xAD, 0x38, 0xE8, 0xCF,
-    0x4D, 0xA5, 0x9E, 0x1F, 0x6B, 0xC4, 0xEB, 0x83, 0x5B, 0xE9, 0xF8, 0xDD, 0x9A, 0x97, 0x9F, 0xC2,
-    0x4A, 0x3F, 0xD4, 0xA9, 0x89, 0xC8, 0x91, 0xE9, 0x0F, 0x22, 0x70, 0x9E, 0x13, 0x72, 0x1D, 0xC8,
-    0xFF, 0x1F, 0x44, 0x68, 0x2D, 0x24, 0xBE, 0x76, 0xA5, 0x66, 0x67, 0xCC, 0x8C, 0xCE, 0x4A, 0xA3,
-    0xFB, 0x51, 0xF7, 0x8C, 0x50, 0x57, 0xE4, 0x54, 0x87, 0xFF, 0x8B, 0xE4, 0x6D, 0xF2, 0x37, 0xEB,
-    0x22, 0x86, 0xD3, 0x7C, 0x1E, 0x5A, 0x87, 0xDE, 0x88, 0x18, 0xD1, 0xF2, 0x5F, 0x5A, 0x9D, 0x08,
-    0x70, 0x5C, 0x50, 0x40, 0xD6, 0x16, 0xDC, 0x0A, 0xF8, 0x1F, 0xCA, 0x1E, 0x7B, 0x30, 0x2A, 0xD6,
-    0xA4, 0x06, 0x6D, 0xEE, 0x94, 0x91, 0x4F, 0xF9, 0x2F, 0xFD, 0x41, 0x95, 0x8E, 0x0D, 0x34, 0x96,
-    0x58, 0x37, 0xD7, 0x1F, 0xA2, 0xC3, 0x18, 0xAF, 0xC7, 0x42, 0xFE, 0x2F, 0xEF, 0xBE, 0x73, 0x0A,
-    0xC9, 0x0A, 0x99, 0x0D, 0x91, 0x4D, 0x89, 0xBD, 0xD5, 0x45, 0xE1, 0xA0, 0x6C, 0x58, 0x16, 0x58,
-    0x15, 0x51, 0x37, 0x63, 0x9E, 0xF8, 0xFF, 0x56, 0xFD, 0x27, 0x87, 0x50, 0x93, 0x77, 0x0A, 0x6B,
-    0x1A, 0xD5, 0x93, 0xAA, 0xA6, 0x7E, 0x49, 0xD9, 0x8C, 0xD8, 0x05, 0x93, 0x02, 0x9B, 0x53, 0x2F,
-    0x06, 0x4C, 0xC1, 0xAF, 0xBB, 0x39, 0x93, 0x7F, 0xF2, 0x53, 0x09, 0x72, 0x2B, 0x54, 0xA8, 0xD4,
-    0xB6, 0xEC, 0x4E, 0x0C, 0xF2, 0xE4, 0x00, 0xDD, 0x20, 0xDD, 0xC7, 0xE0, 0xCF, 0xEF, 0xA8, 0xC9,
-    0x9A, 0xEF, 0x94, 0x1C, 0xBB, 0xDC, 0xCB, 0x91, 0x61, 0x3A, 0xA2, 0x46, 0x75, 0x7B, 0x54, 0xA5,
-    0xE6, 0x5B, 0x58, 0xE5, 0xC2, 0x54, 0xAF, 0xA0, 0xE6, 0xF5, 0x45, 0xCB, 0x49, 0xED, 0x5B, 0xC0,
-    0x7D, 0xDF, 0xAB, 0xDF, 0x02, 0xA7, 0x6F, 0xC1, 0x7B, 0xEA, 0x10, 0x4B, 0xA1, 0x2B, 0xE6, 0xE3,
-    0x2E, 0x6B, 0x22, 0x44, 0x70, 0x19, 0x19, 0xC3, 0x46, 0xEF, 0x69, 0xE5, 0xF3, 0xE7, 0xF4, 0xB2,
-    0xC4, 0x11, 0x80, 0x24, 0x11, 0x69, 0x8C, 0xC8, 0x8A, 0xE8, 0x9C, 0x02, 0xB1, 0x15, 0xAC, 0x8A,
-    0x3D, 0xF3, 0x08, 0xE7, 0x10, 0x13, 0x26, 0x7B, 0x61, 0x74, 0x79, 0x55, 0xDE, 0x06, 0xDD, 0xB0,
-    0x5B, 0x4E, 0xDE, 0x57, 0xF8, 0x2F, 0xFD, 0x0A, 0x86, 0x77, 0x31, 0x9D, 0x70, 0xB8, 0x71, 0xF3,
-    0xAD, 0x17, 0xAD, 0xD6, 0x74, 0x15, 0xBD, 0x73, 0x58, 0xBE, 0xFE, 0xD4, 0x1A, 0xF1, 0xBF, 0x2A,
-    0xD8, 0xD2, 0x30, 0xF5, 0x06, 0x77, 0xA3, 0x33, 0x3F, 0x50, 0x56, 0xF8, 0x5B, 0x68, 0x40, 0xD1,
-    0x13, 0xCC, 0x32, 0x45, 0xEB, 0x1C, 0x55, 0x10, 0x47, 0xAB, 0x12, 0x8B, 0x5B, 0x3D, 0x27, 0x91,
-    0xFB, 0x94, 0x66, 0x26, 0xCE, 0xAC, 0xB8, 0x7D, 0xE1, 0x5C, 0x27, 0xAE, 0x84, 0x68, 0x3B, 0xB9,
-    0x27, 0x4A, 0x3E, 0x8A, 0x35, 0x95, 0x6B, 0x2A, 0xD8, 0x54, 0xB2, 0x51, 0xB4, 0x79, 0x94, 0x6D,
-    0x16, 0x87, 0xA0, 0x74, 0x73, 0xF1, 0x97, 0xF5, 0x87, 0x16, 0x87, 0xF8, 0x52, 0x35, 0x27, 0xD6,
-    0xA8, 0xB0, 0x02, 0xCD, 0xCA, 0xB4, 0x9E, 0x13, 0x64, 0xB3, 0x24, 0xFB, 0x59, 0xC7, 0xF7, 0xB4,
-    0x6A, 0xD3, 0xEA, 0x3F, 0x4A, 0x1D, 0x4B, 0x31, 0xA7, 0xC3, 0xAD, 0xFC, 0xAC, 0xF8, 0xE4, 0x45,
-    0x44, 0x65, 0x84, 0x5E, 0x48, 0x9F, 0x8F, 0xB5, 0x2D, 0xD5, 0xB5, 0x09, 0xEA, 0x95, 0xAA, 0xE5,
-    0xB2, 0xE3, 0x79, 0x7E, 0x7A, 0xE3, 0x08, 0x3F, 0x1B, 0x6A, 0xFF, 0x53, 0x52, 0x3B, 0x26, 0xB5,
-    0xD3, 0x79, 0x6D, 0x68, 0xDA, 0xD1, 0x21, 0xE4, 0xAD, 0x12, 0x4A, 0xBE, 0xBE, 0xC8, 0x5F, 0xF9,
-    0xC5, 0x9D, 0x45, 0x02, 0xFC, 0x3C, 0x35, 0x60, 0x6A, 0xD5, 0x70, 0x55, 0x09, 0xD3, 0x56, 0xB6,
-    0x5E, 0x73, 0x45, 0x34, 0xF2, 0x54, 0x51, 0x5E, 0x16, 0xA6, 0x56, 0xF2, 0xE9, 0xA1, 0xC2, 0x83,
-    0x36, 0x9F, 0xC8, 0x74, 0xEF, 0x35, 0x58, 0x95, 0xFA, 0xA0, 0xDD, 0x29, 0xE4, 0xD7, 0x9E, 0x75,
-    0x0F, 0x1B, 0xCF, 0x66, 0xA8, 0x98, 0xA5, 0x91, 0x65, 0x3F, 0x80, 0xEF, 0x35, 0x58, 0xBE, 0x49,
-    0x17, 0xBE, 0xCD, 0xEA, 0x1F, 0xB1, 0x7C, 0x9F, 0x6A, 0x13, 0x86, 0xE9, 0xD2, 0xB4, 0xBD, 0xCC,
-    0x87, 0xFD, 0xB4, 0xBD, 0xC6, 0x87, 0x3E, 0x6D, 0x99, 0xC1, 0xFA, 0xD1, 0x2A, 0xF9, 0x13, 0xC2,
-    0xEA, 0x7F, 0xDC, 0x24, 0x7F, 0x06, 0xC6, 0xC5, 0xEF, 0x16, 0x5A, 0x43, 0x21, 0x6A, 0x27, 0xD9,
-    0x5A, 0x59, 0x8C, 0xB1, 0xB7, 0x37, 0x22, 0x88, 0xCD, 0x90, 0xCC, 0x1A, 0xF5, 0xA1, 0x4C, 0xC5,
-    0x5D, 0xDD, 0x43, 0xCE, 0x8D, 0xFF, 0x80, 0x15, 0x32, 0xB5, 0x70, 0x48, 0xE6, 0x92, 0x23, 0x0D,
-    0xD8, 0x78, 0x97, 0x91, 0xC6, 0xC2, 0x0C, 0x06, 0x84, 0x90, 0x6F, 0x8B, 0xF6, 0x48, 0x30, 0x0D,
-    0xDC, 0x7C, 0x06, 0x78, 0x5A, 0x26, 0x62, 0xF2, 0x16, 0xCD, 0x0E, 0x44, 0xC1, 0xA3, 0xBF, 0x81,
-    0xFF, 0xC3, 0x95, 0xAC, 0x9E, 0xFC, 0xB1, 0xEF, 0xAD, 0x64, 0xC4, 0xF9, 0xAF, 0x44, 0x9D, 0x8C,
-    0x21, 0xFF, 0xF5, 0xE8, 0xC7, 0x28, 0xAE, 0x5A, 0xB3, 0xA9, 0x47, 0xD6, 0x85, 0x0A, 0xA4, 0xA1,
-    0xE4, 0xCE, 0x14, 0x86, 0xA9, 0xB0, 0x87, 0xF4, 0x6C, 0xD8, 0xC3, 0xDE, 0xE1, 0x78, 0x78, 0x95,
-    0x29, 0x27, 0x19, 0xD6, 0x77, 0xC6, 0xC7, 0xD7, 0xDE, 0x25, 0x59, 0x6A, 0xAF, 0x78, 0xFB, 0x32,
-    0xDA, 0x57, 0x4E, 0xC0, 0x47, 0x89, 0x10, 0xB5, 0x62, 0xC5, 0xCE, 0xD7, 0x7A, 0xA5, 0x19, 0xFC,
-    0x40, 0xD4, 0x21, 0xCC, 0xE0, 0xDE, 0x30, 0x45, 0x53, 0x99, 0x22, 0xFC, 0xAE, 0x02, 0xEB, 0xBC,
-    0xB6, 0x62, 0xC5, 0x73, 0x23, 0x14, 0xE2, 0x5C, 0xAC, 0xA8, 0x4A, 0x48, 0xA3, 0xC7, 0x2E, 0x7C,
-    0x6C, 0xF1, 0x63, 0x0B, 0x20, 0x6B, 0x04, 0xD9, 0x42, 0xC8, 0x26, 0xBB, 0xB1, 0x16, 0xE3, 0x4E,
-    0xB5, 0xD0, 0xFF, 0x79, 0x91, 0x8B, 0x1E, 0xEA, 0xA7, 0x03, 0x18, 0x67, 0xAD, 0x4E, 0xFE, 0x86,
-    0xCB, 0xC3, 0x87, 0x16, 0x12, 0xD2, 0x0F, 0x1A, 0x87, 0xDC, 0xD2, 0x01, 0xA6, 0xFA, 0x81, 0xFF,
-    0x8A, 0xB5, 0xB6, 0x8A, 0x7A, 0xE1, 0x57, 0x3C, 0x1C, 0xAD, 0x72, 0x6F, 0xCA, 0xE2, 0xEF, 0x82,
-    0x1C, 0x48, 0xC5, 0x0B, 0xA8, 0x6A, 0x02, 0x25, 0xD5, 0x13, 0x02, 0x35, 0xE3, 0x35, 0x8D, 0xCA,
-    0x92, 0x51, 0x64, 0xD0, 0x55, 0x51, 0x02, 0xD0, 0x43, 0xDA, 0x7C, 0x22, 0xA7, 0x2A, 0x85, 0xE1,
-    0xF6, 0x4B, 0x9E, 0xAA, 0x63, 0x87, 0x8A, 0x53, 0x28, 0x06, 0x7E, 0xC9, 0x90, 0xCE, 0x42, 0x6D,
-    0x05, 0x13, 0x7B, 0x53, 0x01, 0x99, 0xD3, 0xAA, 0x0E, 0x37, 0xCC, 0x48, 0x01, 0x63, 0x76, 0x56,
-    0x7E, 0xE7, 0x9F, 0x7E, 0x5A, 0x99, 0x30, 0x17, 0x6E, 0xB8, 0xA7, 0xAC, 0x71, 0x7F, 0x91, 0xCF,
-    0x4F, 0x95, 0x81, 0xA9, 0x09, 0x2F, 0x69, 0xBC, 0x40, 0x31, 0xFE, 0x80, 0x8D, 0x2A, 0xC8, 0x5F,
-    0x16, 0x7B, 0x0D, 0xD3, 0xE5, 0xAF, 0x30, 0x88, 0x8D, 0x59, 0xDA, 0x56, 0x8E, 0x3E, 0x15, 0x77,
-    0xA9, 0xBD, 0x0A, 0x9F, 0x55, 0xF4, 0x2C, 0x0C, 0xBC, 0xFA, 0xC9, 0x0D, 0x4D, 0x07, 0x99, 0x16,
-    0x27, 0xBB, 0xF5, 0xB6, 0xDC, 0xA2, 0x70, 0x79, 0x2A, 0xEF, 0x85, 0x80, 0xB9, 0x6D, 0x87, 0xE6,
-    0x08, 0xD7, 0xFE, 0x30, 0x4D, 0x52, 0xF4, 0xD8, 0x4B, 0xA0, 0x6B, 0xAC, 0x95, 0xC8, 0xC9, 0x2A,
-    0xD4, 0x9B, 0x7E, 0xA7, 0x48, 0x87, 0x94, 0x39, 0x23, 0x58, 0x4D, 0x62, 0x97, 0x20, 0x1F, 0x51,
-    0x57, 0x69, 0x01, 0x95, 0x3C, 0x12, 0xBA, 0x12, 0x19, 0x26, 0xF5, 0xFC, 0x4E, 0xB3, 0x01, 0x23,
-    0xAF, 0xD1, 0x56, 0xCB, 0x7E, 0x82, 0xB7, 0x15, 0x72, 0xFC, 0x7D, 0x35, 0x27, 0xBE, 0xA1, 0xE0,
-    0x18, 0x8D, 0xDF, 0x1F, 0xA8, 0xD8, 0xBE, 0xA5, 0xC8, 0xDB, 0x8E, 0xF6, 0x4F, 0xA0, 0xD8, 0xA5,
-    0x68, 0x42, 0xCB, 0x33, 0xFE, 0x91, 0xFC, 0x00, 0xB7, 0xFD, 0xF4, 0x35, 0xC8, 0x85, 0x5B, 0x59,
-    0x03, 0xD0, 0x69, 0x97, 0x57, 0x4C, 0x71, 0xE5, 0xD5, 0xC8, 0x9A, 0x14, 0x24, 0x92, 0x12, 0xB1,
-    0x10, 0x6A, 0x54, 0x99, 0x30, 0x95, 0x7F, 0x4D, 0xF1, 0x2D, 0xE2, 0xCD, 0xCB, 0x98, 0xE0, 0xCD,
-    0x7B, 0x75, 0x23, 0xAB, 0x7F, 0x23, 0x36, 0x59, 0x29, 0xB7, 0x64, 0x51, 0x4E, 0xB1, 0x04, 0xA3,
-    0x73, 0xE0, 0xC1, 0x1F, 0xB1, 0xA4, 0xF4, 0xB7, 0xB8, 0xB3, 0x39, 0xCE, 0x8B, 0x2C, 0x87, 0xDC,
-    0xE7, 0x28, 0x7B, 0xDD, 0x1E, 0xB0, 0xF8, 0xC3, 0xB7, 0xEF, 0x42, 0x2C, 0x7E, 0x03, 0x23, 0x7C,
-    0x24, 0x69, 0x65, 0x80, 0xFB, 0x09, 0xC6, 0xF7, 0x0A, 0xD2, 0xE9, 0x7E, 0x97, 0x55, 0x35, 0xD2,
-    0x5C, 0x32, 0x2E, 0xF1, 0x12, 0x80, 0x53, 0xEE, 0xF2, 0x60, 0x5C, 0x8D, 0x9D, 0x18, 0x4D, 0x9D,
-    0x89, 0x8C, 0xCB, 0x9E, 0x13, 0x1B, 0xEA, 0xBA, 0xB4, 0x5A, 0xA2, 0xAA, 0xE2, 0x23, 0x1C, 0x1D,
-    0xFE, 0x36, 0xE2, 0x4A, 0x25, 0xAC, 0x2F, 0x73, 0xB8, 0xB1, 0x4B, 0x34, 0x6B, 0x69, 0xB9, 0xC2,
-    0xD0, 0xA5, 0x27, 0xD6, 0xE3, 0x09, 0x3B, 0xC2, 0xEF, 0x60, 0xBD, 0xD1, 0xAE, 0x6E, 0xCC, 0x8C,
-    0xF4, 0x62, 0x56, 0x7E, 0x84, 0x13, 0x66, 0x2F, 0x9A, 0x9E, 0xC0, 0x92, 0x6B, 0xF9, 0xD7, 0xAD,
-    0x26, 0xA2, 0xCF, 0x1F, 0xD3, 0xA7, 0x60, 0x55, 0x86, 0x5A, 0x69, 0x1B, 0x36, 0x35, 0x3E, 0x01,
-    0x88, 0x2B, 0xAD, 0xD1, 0x84, 0x77, 0xE2, 0x6D, 0xAD, 0xE9, 0xC7, 0x81, 0xBF, 0x31, 0x2C, 0xE2,
-    0x6D, 0xA1, 0xB4, 0x62, 0xA9, 0xFA, 0x60, 0xA3, 0x01, 0x8B, 0xB0, 0x63, 0x48, 0x47, 0x16, 0xBB,
-    0xB8, 0xB7, 0xE2, 0xF4, 0x62, 0xB1, 0x97, 0xDB, 0xA8, 0xFB, 0xF2, 0xB8, 0x12, 0xF7, 0x7B, 0x1C,
-    0xC4, 0xA4, 0x9A, 0x00, 0x84, 0x58, 0xE2, 0x42, 0x6F, 0x2C, 0xF1, 0x44, 0x4B, 0xA6, 0x2E, 0x29,
-    0x6E, 0xF1, 0xDF, 0x52, 0x1D, 0x7B, 0x1D, 0x33, 0x44, 0x41, 0xAB, 0xBE, 0x53, 0xB3, 0xA5, 0x91,
-    0x8C, 0x6C, 0xF8, 0x9A, 0x6C, 0x9F, 0x96, 0xF8, 0x8D, 0xBB, 0x83, 0xF8, 0x64, 0x9D, 0xBF, 0xDA,
-    0x20, 0x6C, 0x1B, 0xBE, 0xB6, 0xCE, 0xE4, 0x16, 0x3F, 0xDA, 0x8B, 0x33, 0xDD, 0xA6, 0x61, 0x97,
-    0x36, 0x69, 0xB3, 0x1F, 0x32, 0x44, 0x73, 0x2B, 0xEA, 0x92, 0x55, 0xFE, 0x7C, 0x1F, 0xAF, 0xD2,
-    0x2E, 0xFF, 0xC6, 0x36, 0x69, 0xEB, 0x4D, 0x9E, 0x6E, 0x93, 0x66, 0xDC, 0x18, 0xA5, 0x86, 0xA9,
-    0x97, 0x0A, 0xDB, 0xBB, 0xBC, 0x64, 0xD8, 0xA5, 0xC0, 0x90, 0x9B, 0x71, 0x63, 0xF8, 0x26, 0xDB,
-    0xED, 0xB7, 0x55, 0x12, 0x04, 0x96, 0xA3, 0x52, 0xFB, 0x2E, 0xEE, 0x32, 0x83, 0x1B, 0x2B, 0xEA,
-    0x3B, 0x18, 0x74, 0x07, 0x1D, 0xA9, 0x64, 0x8E, 0xCC, 0x83, 0x49, 0x65, 0x61, 0x30, 0xC6, 0xD7,
-    0xD4, 0x81, 0xE2, 0x2F, 0x07, 0x5F, 0xE1, 0x53, 0x5B, 0xFA, 0x5F, 0x1B, 0x25, 0xB3, 0xEC, 0x67,
-    0x92, 0x96, 0x5B, 0x78, 0xF0, 0x34, 0x64, 0x4D, 0x80, 0xA8, 0x2C, 0x4C, 0x80, 0x9B, 0x10, 0x68,
-    0x65, 0x61, 0xBC, 0xD0, 0xB0, 0xAE, 0xB2, 0x2D, 0xEA, 0xA6, 0xF2, 0x37, 0xF2, 0x15, 0xAA, 0xA6,
-    0xE2, 0x7E, 0x51, 0xD9, 0xCA, 0xD7, 0x9A, 0xE8, 0x2B, 0xD5, 0xD3, 0x92, 0x6D, 0x7E, 0x59, 0x11,
-    0x9B, 0xDC, 0x89, 0x2B, 0x4D, 0xA5, 0xF4, 0xBA, 0xC9, 0x37, 0x2C, 0xFA, 0xDB, 0x1B, 0xB6, 0xF6,
-    0xE7, 0x80, 0xAC, 0x0E, 0x47, 0xDF, 0x63, 0xBF, 0x9B, 0xEC, 0x79, 0xD6, 0x26, 0x72, 0x5F, 0xE6,
-    0xBA, 0x21, 0xCB, 0x22, 0x57, 0x8C, 0x4D, 0x29, 0xFF, 0x93, 0x45, 0x79, 0x47, 0x3E, 0x5D, 0x26,
-    0x88, 0x00, 0xCC, 0x91, 0x88, 0xB1, 0xEB, 0x69, 0x2F, 0xA3, 0x13, 0x6D, 0xB2, 0x76, 0x95, 0x5C,
-    0x08, 0x5F, 0xA5, 0x5A, 0xCB, 0xC5, 0x48, 0x16, 0x60, 0xB6, 0x77, 0x6F, 0xDC, 0xB8, 0xD9, 0x39,
-    0x98, 0xAD, 0x6B, 0x81, 0x00, 0xA1, 0x91, 0xE9, 0x86, 0x00, 0x33, 0x6E, 0x4F, 0xE5, 0x40, 0x9A,
-    0xE7, 0xE0, 0x4F, 0x62, 0xB7, 0x27, 0xB4, 0x14, 0x59, 0x23, 0xAB, 0xCD, 0x6D, 0x17, 0x26, 0x49,
-    0xFE, 0x7B, 0xE7, 0xB4, 0x6E, 0xFC, 0x6E, 0x33, 0xB7, 0xF1, 0x39, 0x9E, 0xB4, 0x00, 0xE3, 0x8B,
-    0xD8, 0x19, 0xF9, 0x6B, 0x1B, 0xEB, 0x6E, 0xE0, 0x8D, 0xC1, 0xC6, 0x50, 0xEB, 0xC1, 0x36, 0x5C,
-    0x47, 0xEA, 0xA2, 0x02, 0x15, 0x62, 0x10, 0xEE, 0xB8, 0x8B, 0x88, 0xBA, 0xA4, 0x4B, 0x13, 0x75,
-    0x56, 0x8F, 0x95, 0x35, 0xB1, 0x3E, 0x56, 0x4C, 0x23, 0xE0, 0xD1, 0x02, 0xDE, 0x04, 0xEB, 0x16,
-    0xFE, 0x60, 0x0E, 0xC4, 0x58, 0x44, 0x40, 0x49, 0xC9, 0x58, 0xB1, 0x49, 0xFA, 0x9F, 0x1F, 0xEF,
-    0x7A, 0xE3, 0x75, 0xEC, 0x12, 0x50, 0xC7, 0x75, 0x93, 0xD3, 0x7D, 0x82, 0x12, 0x86, 0x2D, 0x5C,
-    0x19, 0x9A, 0x15, 0x23, 0x98, 0x17, 0x20, 0x82, 0x29, 0x56, 0x76, 0x84, 0xCC, 0x3F, 0x40, 0x50,
-    0xB4, 0x65, 0xD7, 0x22, 0x0A, 0x69, 0xCD, 0x5A, 0xC9, 0x7D, 0x1E, 0x6B, 0x7B, 0x9E, 0xEC, 0xA6,
-    0x9B, 0xF3, 0x1A, 0x3B, 0x66, 0xFC, 0xE1, 0xDD, 0x11, 0x26, 0xC7, 0x10, 0x75, 0xC8, 0x72, 0x84,
-    0x9B, 0x78, 0x85, 0xB1, 0x6A, 0x20, 0x53, 0x76, 0xCD, 0x2A, 0x69, 0xB0, 0x6D, 0x72, 0xF9, 0x3F,
-    0xFE, 0xA5, 0x2E, 0x10, 0x98, 0xCA, 0x9F, 0x1F, 0x19, 0x5E, 0xCB, 0xBF, 0xB1, 0x09, 0xC6, 0x3E,
-    0x1A, 0xF2, 0x74, 0x25, 0xF2, 0x15, 0x12, 0x20, 0xAC, 0xC0, 0x8A, 0x60, 0x05, 0x0B, 0xD7, 0x5B,
-    0x3F, 0x87, 0xC6, 0x42, 0xCF, 0xF5, 0x53, 0x81, 0xC3, 0x05, 0xAA, 0x90, 0xF1, 0x5D, 0xD4, 0x3D,
-    0xB2, 0x5C, 0x23, 0xEE, 0xCD, 0xC4, 0xC1, 0x43, 0xAB, 0x6E, 0x36, 0xF5, 0x79, 0x61, 0x3D, 0x10,
-    0x92, 0x05, 0xB0, 0x92, 0x96, 0xD5, 0x39, 0x70, 0xF9, 0x86, 0xF5, 0x2F, 0x20, 0x26, 0xEC, 0xA8,
-    0x5F, 0xB4, 0xFB, 0x18, 0x17, 0x85, 0x4C, 0xA7, 0x4B, 0x8B, 0x46, 0x0D, 0x5A, 0x4C, 0x66, 0x36,
-    0x63, 0x17, 0x17, 0x46, 0x96, 0x6E, 0xC1, 0x00, 0x63, 0xAB, 0x80, 0x9D, 0x52, 0x25, 0xB9, 0x1E,
-    0x89, 0xC1, 0xD9, 0x5E, 0xD0, 0x25, 0x3A, 0xC2, 0xB9, 0x3D, 0xB6, 0xC2, 0x77, 0x04, 0xD3, 0x5E,
-    0xF0, 0x7E, 0x5D, 0x44, 0x28, 0x3E, 0x32, 0x4B, 0x5E, 0x97, 0x0F, 0xF8, 0x5B, 0xFB, 0x68, 0x56,
-    0x92, 0x88, 0xCF, 0x8D, 0x2C, 0x92, 0xCC, 0x27, 0x07, 0xEE, 0x2C, 0x5B, 0xF4, 0x3B, 0x53, 0x88,
-    0x6E, 0xEB, 0x05, 0x37, 0x40, 0x34, 0x90, 0xC5, 0x7F, 0x7C, 0x98, 0x5E, 0x3B, 0xD5, 0x42, 0x58,
-    0x95, 0x89, 0xA1, 0x73, 0x39, 0xF4, 0x87, 0xEB, 0xB5, 0xC7, 0x6A, 0x8E, 0xEC, 0xCD, 0xDD, 0x30,
-    0x9B, 0x77, 0x4E, 0x54, 0xDE, 0xF3, 0xB5, 0x2E, 0x0D, 0xF1, 0xEE, 0x8B, 0x4B, 0xA6, 0xE6, 0xB6,
-    0x3E, 0x8A, 0x16, 0xD6, 0xE5, 0x16, 0x98, 0x82, 0x71, 0x8D, 0x91, 0x20, 0x6D, 0x80, 0x7B, 0xA3,
-    0x7D, 0x33, 0x88, 0xC8, 0x44, 0x35, 0x7D, 0x15, 0x02, 0xC6, 0x80, 0xE1, 0xD2, 0xD9, 0x29, 0x69,
-    0x85, 0x77, 0x0A, 0x39, 0x62, 0x46, 0x43, 0xAD, 0x51, 0x66, 0x1C, 0xD2, 0x96, 0x70, 0x31, 0x58,
-    0x42, 0x4C, 0x0A, 0x12, 0x3D, 0x87, 0xFD, 0x6A, 0x72, 0x29, 0xE9, 0xC3, 0x35, 0x21, 0x9F, 0x43,
-    0xD4, 0x67, 0xBD, 0x37, 0x55, 0x34, 0x78, 0xE7, 0xEA, 0xE1, 0xB7, 0x97, 0xC9, 0xD9, 0x29, 0x27,
-    0x93, 0x36, 0xDE, 0xB2, 0x54, 0xCD, 0xD9, 0x16, 0x5A, 0x13, 0x0C, 0x46, 0xDD, 0x35, 0x97, 0x6D,
-    0x2A, 0x03, 0x27, 0x6F, 0x35, 0x44, 0xAD, 0xD9, 0x3D, 0xBD, 0x9A, 0x53, 0x58, 0x59, 0xE3, 0x8A,
-    0x29, 0xDD, 0x93, 0x7A, 0x57, 0x52, 0xE1, 0x63, 0xB4, 0x2E, 0x37, 0xDE, 0xA5, 0x64, 0xF3, 0xF7,
-    0xC5, 0xFD, 0x0C, 0xA1, 0xCC, 0x0E, 0x3C, 0x28, 0xB7, 0x6B, 0xDE, 0x65, 0x19, 0xF9, 0x6D, 0xB9,
-    0xF6, 0x62, 0x3F, 0x5C, 0x92, 0x5D, 0xBE, 0xF6, 0x2E, 0xCA, 0xD6, 0xE8, 0xBD, 0x8B, 0x62, 0x28,
-    0x75, 0xA2, 0xE3, 0x01, 0x31, 0xDC, 0xA7, 0xFB, 0xF0, 0x4C, 0xDA, 0x88, 0x5F, 0xF2, 0x72, 0xDA,
-    0xC4, 0xAD, 0xBF, 0xC2, 0x46, 0x09, 0x9B, 0xB4, 0x4D, 0x1A, 0x74, 0xDA, 0x4A, 0x9B, 0xE7, 0x60,
-    0xEE, 0xFE, 0xD9, 0xDA, 0xF0, 0x26, 0x62, 0xD6, 0x6D, 0x67, 0x24, 0x74, 0xE9, 0xCD, 0x78, 0xE8,
-    0x61, 0x6E, 0x0F, 0x79, 0xAF, 0x8A, 0xB2, 0x29, 0x26, 0xAB, 0x73, 0xCE, 0xAC, 0x73, 0x47, 0x85,
-    0x35, 0x26, 0x32, 0xC3, 0x1F, 0x35, 0x3A, 0xA9, 0xFE, 0x1E, 0x0D, 0x50, 0x14, 0xC4, 0x35, 0xB4,
-    0xFC, 0x98, 0xD6, 0xC6, 0xE6, 0x89, 0xF4, 0x96, 0xF4, 0x0F, 0x21, 0xD0, 0x93, 0xFC, 0x64, 0x04,
-    0x7A, 0x38, 0x85, 0x8E, 0x2B, 0xDB, 0xAC, 0x47, 0x6F, 0xB5, 0x16, 0x6E, 0xFB, 0x58, 0x13, 0xF3,
-    0x7D, 0x65, 0x82, 0x7E, 0x1B, 0xEE, 0x9B, 0x2B, 0x6F, 0xE0, 0x0D, 0x6B, 0xA6, 0x65, 0x6C, 0x23,
-    0xD5, 0xB8, 0xA8, 0xF5, 0x76, 0x89, 0xB4, 0x56, 0x41, 0x5E, 0xCB, 0x7D, 0x55, 0xDE, 0xE5, 0x30,
-    0x63, 0x63, 0x94, 0x21, 0xD4, 0xF6, 0xA6, 0x40, 0xEF, 0x5D, 0x20, 0xEA, 0xC5, 0x2A, 0xC1, 0xEF,
-    0xA3, 0x1C, 0x3E, 0x5C, 0xC7, 0x9D, 0x6B, 0x2E, 0xA8, 0xC8, 0x99, 0xB1, 0xC7, 0x65, 0xBC, 0xB9,
-    0xCE, 0xC5, 0x7A, 0x5B, 0x97, 0x95, 0xFF, 0x8D, 0x9E, 0xAA, 0x80, 0xEB, 0x0B, 0x9E, 0x6B, 0x03,
-    0xA1, 0xAA, 0xB6, 0x2A, 0x8D, 0xD9, 0x68, 0x40, 0x21, 0x78, 0xED, 0x40, 0x33, 0xA8, 0xAF, 0x93,
-    0x31, 0xF2, 0x36, 0x76, 0xF1, 0x96, 0x81, 0x2E, 0x1A, 0x43, 0xAB, 0xC2, 0xCA, 0xEC, 0x68, 0xCE,
-    0x28, 0xB5, 0x9F, 0x55, 0xD2, 0x6F, 0xA8, 0x2E, 0x80, 0x71, 0xF5, 0x29, 0x48, 0x31, 0x1F, 0xC6,
-    0x95, 0x06, 0x2D, 0x65, 0x18, 0xD5, 0x21, 0x1F, 0x55, 0xEB, 0xD7, 0x8C, 0x5D, 0xC8, 0x4D, 0x5B,
-    0x49, 0x15, 0x14, 0x43, 0xD6, 0xE9, 0x22, 0x7F, 0x4C, 0x65, 0xC8, 0x6F, 0xA9, 0x10, 0xF9, 0xB6,
-    0x46, 0xCE, 0x6E, 0xEA, 0xEA, 0x7E, 0x55, 0xD7, 0xA2, 0x1A, 0xA2, 0x9A, 0x84, 0x9F, 0x7A, 0x7D,
-    0xCC, 0x11, 0xCE, 0x2B, 0x48, 0xC6, 0xC7, 0x1B, 0xE4, 0xB2, 0x73, 0x1A, 0x5C, 0xAF, 0x7E, 0x05,
-    0x56, 0x01, 0xAB, 0x00, 0xA0, 0x9D, 0xB7, 0x5C, 0xE5, 0x03, 0xED, 0x70, 0xED, 0x6A, 0x55, 0x53,
-    0x85, 0x97, 0x0C, 0x80, 0x94, 0xD4, 0xE3, 0xF9, 0xD7, 0x18, 0x4C, 0xF9, 0x16, 0xE5, 0xC7, 0xBF,
-    0x63, 0x30, 0x85, 0x43, 0xB1, 0x90, 0xCA, 0xDF, 0x9C, 0x0C, 0xA9, 0x24, 0xDD, 0xA2, 0xE0, 0xF3,
-    0x05, 0x46, 0xDA, 0xC8, 0x10, 0xAC, 0x52, 0x87, 0x89, 0xB4, 0x16, 0x2D, 0xB7, 0x75, 0x9F, 0xA9,
-    0x81, 0x53, 0x9C, 0x44, 0xF5, 0x7D, 0xCA, 0xE9, 0xFF, 0xA5, 0xE7, 0x5F, 0xA4, 0x38, 0x1A, 0x99,
-    0xFE, 0x85, 0xBF, 0x29, 0xA6, 0x10, 0x3E, 0x6A, 0x13, 0x61, 0x5D, 0x5F, 0x66, 0x6D, 0xD8, 0xE7,
-    0x96, 0xAD, 0x86, 0x7F, 0xF6, 0xFC, 0xF2, 0x4E, 0x97, 0x89, 0x5B, 0xA9, 0xB8, 0x05, 0xF5, 0x64,
-    0x0B, 0x67, 0x26, 0x70, 0x45, 0xB7, 0x3A, 0x83, 0x30, 0x6B, 0x5D, 0xBD, 0x18, 0x64, 0xB7, 0xD5,
-    0x93, 0x4D, 0xB5, 0xF2, 0x7E, 0x41, 0xFB, 0x69, 0x4C, 0x81, 0x79, 0xE1, 0xEF, 0x8D, 0x17, 0x44,
-    0xE8, 0xF7, 0x04, 0x2F, 0x8E, 0x08, 0x84, 0xAF, 0x13, 0x2D, 0x76, 0x1A, 0xBC, 0x60, 0xAD, 0x45,
-    0xDF, 0xF0, 0xCD, 0xB5, 0xEF, 0x03, 0x2C, 0xC0, 0xA0, 0xC3, 0xA3, 0xC8, 0x29, 0xD1, 0x29, 0x1D,
-    0x34, 0x2B, 0x24, 0x49, 0x15, 0xAE, 0x28, 0x4D, 0xE0, 0xBD, 0x46, 0x8D, 0x13, 0x2C, 0x4D, 0xCC,
-    0x47, 0x14, 0x70, 0x8A, 0x20, 0x65, 0xC0, 0x15, 0x56, 0x41, 0x46, 0xC9, 0x03, 0x59, 0xB3, 0xDA,
-    0xD7, 0x26, 0x52, 0xB0, 0xB7, 0x6E, 0x69, 0xD9, 0x00, 0xF2, 0x83, 0x9D, 0x6B, 0x2D, 0x18, 0xFE,
-    0x98, 0x26, 0x04, 0x95, 0xCE, 0xBB, 0xAC, 0x53, 0xC6, 0x88, 0xA8, 0xEF, 0x6B, 0x96, 0xA2, 0x53,
-    0x2C, 0xC6, 0x4A, 0x9C, 0xCD, 0x54, 0x92, 0xEE, 0xCF, 0xB6, 0x71, 0xB4, 0x3A, 0xAB, 0x78, 0x29,
-    0x9F, 0x29, 0xBB, 0x9D, 0x7F, 0x75, 0x2A, 0x1D, 0xFC, 0x5A, 0x3D, 0xB5, 0x11, 0x9B, 0x35, 0x53,
-    0xE0, 0x7C, 0x79, 0x15, 0x7E, 0x00, 0xCF, 0x6D, 0x22, 0x22, 0x15, 0xB3, 0xBB, 0xE3, 0xA3, 0x04,
-    0x7F, 0x41, 0xC0, 0xA2, 0x02, 0x02, 0xF0, 0x7E, 0xD0, 0xE3, 0x0E, 0x42, 0xA3, 0xC8, 0x29, 0x3F,
-    0x07, 0x6D, 0x2B, 0x7A, 0xC4, 0x7B, 0x15, 0x91, 0x1F, 0x78, 0x74, 0xB7, 0xD9, 0x81, 0x58, 0xBE,
-    0x5B, 0x33, 0xF2, 0x23, 0x3F, 0xEF, 0xF9, 0x10, 0x75, 0x41, 0xC7, 0x28, 0x50, 0xD8, 0x87, 0x6D,
-    0x89, 0x68, 0x8B, 0x98, 0xA4, 0xA8, 0x93, 0xCD, 0xDA, 0x60, 0x2D, 0x8E, 0x71, 0xC5, 0x6C, 0x5A,
-    0x46, 0x34, 0x58, 0xE1, 0x6D, 0x58, 0x32, 0x25, 0xE4, 0xD8, 0xDC, 0x52, 0xD5, 0xEF, 0x0D, 0xA0,
-    0x6A, 0xA4, 0x26, 0x77, 0x34, 0x60, 0x1E, 0x2C, 0xFF, 0x1C, 0x6C, 0xD2, 0x84, 0x1F, 0x3E, 0xEB,
-    0xA6, 0x74, 0xAA, 0x8F, 0xDA, 0x44, 0x22, 0xC3, 0x2D, 0x4D, 0xCB, 0xE7, 0xCA, 0x53, 0xAE, 0xB3,
-    0xCF, 0xE8, 0x54, 0xF8, 0xF1, 0x89, 0xCC, 0x91, 0xF5, 0xBB, 0xD2, 0x32, 0xA0, 0x9A, 0x95, 0x2F,
-    0xA9, 0x75, 0x99, 0xFC, 0xF3, 0x2D, 0xDC, 0xC1, 0xED, 0xB9, 0x95, 0x62, 0x0A, 0xAD, 0xC0, 0x07,
-    0x2B, 0x16, 0x4B, 0x39, 0x5A, 0xD3, 0x51, 0x0E, 0x37, 0xA1, 0x76, 0x58, 0x89, 0xD4, 0xA6, 0xE2,
-    0x32, 0xA4, 0x0A, 0xA1, 0xCC, 0x22, 0x56, 0x7E, 0xC3, 0x55, 0x18, 0x6D, 0x68, 0xD0, 0xC5, 0xEC,
-    0x6D, 0x21, 0x4B, 0x4A, 0x2D, 0xAC, 0x4E, 0xAB, 0x4B, 0x57, 0x56, 0x2A, 0xA2, 0x1A, 0xAF, 0xA2,
-    0xA9, 0xAD, 0x19, 0x82, 0x70, 0xAB, 0x9E, 0x07, 0xD6, 0xD3, 0x39, 0xA4, 0x75, 0xFC, 0xF1, 0xE8,
-    0x7F, 0x63, 0x00, 0xF9, 0xD4, 0x10, 0xA2, 0x5A, 0x94, 0xBE, 0x99, 0xAD, 0xB2, 0x93, 0x7A, 0xD0,
-    0xF2, 0xEA, 0x68, 0xEB, 0xB9, 0xBE, 0xBE, 0x31, 0x67, 0x98, 0xFF, 0xE9, 0x3B, 0x83, 0x95, 0xA3,
-    0xB0, 0x1C, 0xA6, 0xC2, 0x5E, 0xCC, 0x1B, 0x55, 0xA5, 0x5A, 0xF8, 0xAA, 0xCA, 0xDC, 0xAE, 0xEC,
-    0xF0, 0xC2, 0xF0, 0x57, 0x45, 0xEE, 0x90, 0x47, 0x00, 0x96, 0x59, 0x78, 0x2B, 0x72, 0x05, 0x6B,
-    0xC9, 0xFF, 0xDE, 0x94, 0x8D, 0x6B, 0x29, 0xA5, 0xC1, 0x24, 0x8D, 0x26, 0x87, 0xBB, 0xCD, 0xC2,
-    0xCF, 0xB9, 0x30, 0x7F, 0x3D, 0xB8, 0xC5, 0x3A, 0xDE, 0x2D, 0xD4, 0x7C, 0xBA, 0xA0, 0xE2, 0x22,
-    0xF2, 0x5F, 0x38, 0x3A, 0xD9, 0x3E, 0x6F, 0x92, 0x29, 0xD3, 0xA7, 0xB9, 0x85, 0x70, 0xC1, 0xC5,
-    0x67, 0x1F, 0x3A, 0x21, 0x88, 0x8E, 0x06, 0x91, 0x45, 0x2B, 0x3A, 0x1C, 0xA2, 0xC7, 0x19, 0x4A,
-    0xCE, 0x64, 0x2A, 0xAC, 0x39, 0x48, 0x9A, 0x3B, 0xBA, 0x1C, 0xE3, 0x86, 0xDD, 0xA4, 0xB6, 0xDE,
-    0x9E, 0x87, 0xAA, 0x7C, 0x13, 0x47, 0xE9, 0xCA, 0x44, 0x54, 0x6A, 0xF5, 0x35, 0xF2, 0x60, 0x51,
-    0xBD, 0x74, 0x65, 0x2E, 0x51, 0xBA, 0x32, 0xB2, 0x67, 0xAD, 0x6B, 0x68, 0xD0, 0x96, 0x2E, 0x2E,
-    0xA5, 0x26, 0xFF, 0xFC, 0x50, 0x36, 0x26, 0x09, 0xEB, 0x6A, 0x74, 0x52, 0x6E, 0x34, 0xE3, 0xCA,
-    0x1E, 0x64, 0x53, 0xDA, 0xF4, 0x37, 0x30, 0xA9, 0xF6, 0x08, 0x84, 0x2E, 0x11, 0xF2, 0x60, 0xF9,
-    0x4E, 0x0B, 0x4B, 0x54, 0xFE, 0x4B, 0xD7, 0xD1, 0x78, 0x1C, 0x69, 0xD1, 0xDF, 0x0F, 0xC8, 0x52,
-    0x98, 0x67, 0x19, 0xE3, 0x87, 0x48, 0xAC, 0x59, 0xF0, 0x2E, 0x7B, 0xC3, 0xF6, 0x00, 0x16, 0x77,
-    0xF8, 0x26, 0x4B, 0x58, 0xA2, 0xE2, 0x1C, 0x2B, 0x4B, 0x82, 0xFE, 0xFC, 0x82, 0xA6, 0xFE, 0x7A,
-    0x49, 0x4F, 0xB5, 0x67, 0xAD, 0x27, 0xD9, 0xEE, 0xD7, 0x21, 0x20, 0xA6, 0x40, 0x6F, 0x20, 0x0D,
-    0x53, 0x7E, 0xB7, 0xAB, 0x9F, 0x5A, 0xF9, 0xDB, 0xA0, 0xDF, 0x20, 0xD8, 0xE2, 0x77, 0xEB, 0x40,
-    0xEC, 0x28, 0xBF, 0xFA, 0xD5, 0x60, 0xA3, 0x4D, 0xD2, 0x54, 0x75, 0x07, 0x1B, 0xDA, 0xD3, 0x8C,
-    0xC6, 0x4E, 0x37, 0xB1, 0xAE, 0xD8, 0xD5, 0x6F, 0x4D, 0xAB, 0x34, 0xEC, 0x4B, 0xCD, 0xA8, 0x94,
-    0xAA, 0x55, 0xF4, 0xD6, 0xCA, 0xAF, 0xA8, 0xA5, 0x15, 0x20, 0xCA, 0x2C, 0xF6, 0x2D, 0x82, 0x3C,
-    0xC9, 0x30, 0x96, 0x6F, 0xAF, 0x91, 0xFA, 0x8D, 0x31, 0x61, 0x82, 0x5E, 0x77, 0x32, 0x13, 0x2E,
-    0x2F, 0x1B, 0xDC, 0xAD, 0x5F, 0x22, 0xBF, 0xFC, 0xF6, 0x2B, 0xD6, 0x5F, 0xB1, 0xF8, 0x9C, 0x7F,
-    0xA6, 0xBE, 0xFA, 0x3B, 0x99, 0xCD, 0x38, 0x7F, 0x78, 0x78, 0xA8, 0x0A, 0x1A, 0xBF, 0x7A, 0xF0,
-    0xE4, 0xEB, 0xE8, 0xF2, 0xF0, 0xCB, 0x61, 0xF1, 0x4F, 0xCE, 0x24, 0xD1, 0x27, 0x2B, 0xEF, 0xE1,
-    0x04, 0x5C, 0x6D, 0xE9, 0x8F, 0x8E, 0xFD, 0x65, 0x36, 0x60, 0xA4, 0xCA, 0x4D, 0x95, 0x4C, 0x32,
-    0x2E, 0xE1, 0xA3, 0xBF, 0xD2, 0xD0, 0xA6, 0xF5, 0xFB, 0x3B, 0x65, 0xBF, 0xA4, 0x8B, 0x0C, 0xF4,
-    0x09, 0xDF, 0xFB, 0xCC, 0xAB, 0x6E, 0x7E, 0x95, 0x05, 0x46, 0x5D, 0xF5, 0x9E, 0xB8, 0xD1, 0x84,
-    0xA0, 0xEC, 0xCE, 0xB3, 0x2C, 0xCC, 0xBC, 0x7F, 0xAF, 0x6E, 0xBA, 0x97, 0xEA, 0x5C, 0xE6, 0xDA,
-    0xF4, 0x64, 0xF2, 0x54, 0x12, 0x40, 0x52, 0xCA, 0x82, 0x0D, 0x26, 0x14, 0x9B, 0x0D, 0xBC, 0xD8,
-    0xCF, 0x59, 0x7B, 0xAE, 0x95, 0x77, 0xAA, 0x2B, 0x79, 0x59, 0xED, 0x5C, 0xA6, 0x86, 0x05, 0x56,
-    0xC7, 0xB5, 0xF6, 0x5D, 0x5E, 0xB9, 0x9E, 0x9A, 0xA0, 0x7B, 0x9B, 0xFB, 0xE1, 0x78, 0xE6, 0x4E,
-    0xE8, 0x9E, 0x36, 0xB2, 0x25, 0xFD, 0xE3, 0x95, 0x17, 0x80, 0xBB, 0xF1, 0x0A, 0x6B, 0x7D, 0xCB,
-    0xC4, 0xFE, 0xD6, 0x19, 0xB5, 0x0C, 0x1F, 0xC7, 0xA0, 0x42, 0xF2, 0xBD, 0x01, 0x2C, 0x7B, 0xF5,
-    0xF3, 0xC2, 0xF6, 0x07, 0x72, 0xC4, 0xA9, 0xD3, 0x81, 0xA9, 0x1E, 0x42, 0x98, 0xB4, 0xA7, 0x14,
-    0x34, 0x1A, 0x40, 0x2E, 0x25, 0x6C, 0xBA, 0x8D, 0xF7, 0xB2, 0x0A, 0x23, 0xD5, 0xF1, 0x2F, 0x2C,
-    0x16, 0x20, 0xA4, 0xF8, 0x5A, 0xE8, 0xD3, 0xCB, 0x82, 0x05, 0x92, 0xC0, 0xFB, 0xC7, 0x4E, 0xE2,
-    0x5F, 0x18, 0x9B, 0x87, 0xE5, 0xDF, 0xEA, 0x6D, 0xD8, 0x0D, 0x45, 0xE0, 0x1A, 0x5B, 0xC8, 0xAE,
-    0x7D, 0xD5, 0x7B, 0x46, 0xA4, 0x58, 0xA4, 0xE8, 0x8B, 0x4A, 0xEC, 0x3B, 0x78, 0xC9, 0xC5, 0x81,
-    0x45, 0x71, 0xD0, 0x16, 0xE8, 0xF2, 0x93, 0x63, 0xF7, 0xB2, 0x77, 0xD4, 0x5D, 0x71, 0xD0, 0xC8,
-    0x6C, 0xD1, 0xAC, 0x6D, 0x6E, 0x3E, 0x2F, 0xA6, 0x5C, 0x3D, 0x0B, 0x8B, 0x66, 0x2E, 0x1B, 0x0F,
-    0x8B, 0xB0, 0xF2, 0xEE, 0xF7, 0x15, 0xB8, 0x86, 0x64, 0xAC, 0xD8, 0xD6, 0x25, 0x01, 0xB1, 0x95,
-    0xFE, 0x0E, 0x45, 0xEE, 0xE5, 0x7F, 0xD1, 0x01, 0x00, 0xC2, 0xB6, 0x29, 0xCF, 0x20, 0x29, 0xF7,
-    0x90, 0xE6, 0x59, 0xFF, 0x11, 0x13, 0x4A, 0x1F, 0xD2, 0xD7, 0xBF, 0x76, 0x0F, 0xFF, 0x46, 0x21,
-    0x45, 0x3A, 0xA0, 0x36, 0x1D, 0xA7, 0xA6, 0x88, 0xFD, 0x81, 0x33, 0xAE, 0x2E, 0x79, 0xB7, 0xF7,
-    0x5D, 0xD7, 0xC9, 0xFD, 0xDD, 0xF6, 0x93, 0x1F, 0xDE, 0xD7, 0xBF, 0xD1, 0xD5, 0xF4, 0x22, 0xC7,
-    0xA1, 0xDB, 0x48, 0xFB, 0x6A, 0xF5, 0x53, 0x4B, 0x97, 0x4B, 0xEA, 0x55, 0xED, 0x43, 0x4E, 0xDA,
-    0x38, 0xBE, 0x29, 0x14, 0xBA, 0xEF, 0x57, 0xB6, 0xB0, 0x32, 0x66, 0x43, 0x18, 0x7A, 0xE0, 0x4C,
-    0xDE, 0x05, 0x45, 0x30, 0xF3, 0x6E, 0x09, 0x65, 0x0F, 0x17, 0x30, 0x9F, 0xA8, 0xF1, 0xCE, 0xB2,
-    0xC8, 0xA7, 0x50, 0xD1, 0x04, 0x56, 0xB4, 0x80, 0xDC, 0x64, 0x89, 0x76, 0x2E, 0xD4, 0xA2, 0x1B,
-    0xAC, 0x74, 0x0A, 0xF5, 0x55, 0x73, 0x90, 0x8A, 0x29, 0x16, 0xA3, 0x60, 0x78, 0x6E, 0xD2, 0x40,
-    0xC1, 0xC2, 0x2A, 0x28, 0xC6, 0xC5, 0x4B, 0x7F, 0x59, 0x07, 0xF3, 0xA1, 0x50, 0xFF, 0x97, 0x16,
-    0x0F, 0xE5, 0x9B, 0xCE, 0x82, 0xBE, 0x2E, 0x74, 0x77, 0x61, 0x2F, 0x18, 0x4D, 0xEE, 0x79, 0x9C,
-    0x5A, 0xF3, 0x7B, 0xFE, 0x51, 0xBB, 0x00, 0x8B, 0x14, 0x1F, 0xF6, 0xAA, 0xF8, 0xE2, 0xC2, 0xF8,
-    0x28, 0x17, 0xBE, 0xB1, 0x55, 0xF0, 0xF7, 0x93, 0xF0, 0xB4, 0x33, 0x2E, 0x34, 0x34, 0x69, 0x9D,
-    0x4C, 0x68, 0x6F, 0x17, 0x1A, 0xD2, 0xEC, 0x16, 0x3C, 0xEA, 0x17, 0x3C, 0xFA, 0x57, 0xA7, 0xDD,
-    0xA9, 0x9D, 0xE7, 0x83, 0xC5, 0xF3, 0xB5, 0x7B, 0x8D, 0xD2, 0x0C, 0x88, 0x07, 0x0D, 0xF2, 0x01,
-    0x40, 0xA1, 0xBA, 0xB4, 0x2B, 0xFB, 0x9B, 0xA8, 0x8F, 0x1C, 0xF2, 0xDB, 0xB5, 0x82, 0xAE, 0xD7,
-    0x67, 0x7F, 0xD6, 0xD4, 0x01, 0x32, 0xD5, 0x0E, 0x90, 0x95, 0x26, 0xE2, 0xD8, 0x19, 0xAD, 0xDC,
-    0xE9, 0xAB, 0xE8, 0xB2, 0x70, 0xB5, 0x15, 0x90, 0x6B, 0x07, 0x48, 0x62, 0x04, 0x4D, 0x8C, 0xE7,
-    0xA3, 0x25, 0x1B, 0x5C, 0x07, 0xC8, 0x70, 0xEE, 0x00, 0x69, 0x62, 0xFD, 0x59, 0x8B, 0xFC, 0x06,
-    0xEA, 0x49, 0xC7, 0x5D, 0xDC, 0x44, 0xDA, 0xB3, 0x61, 0xEA, 0x00, 0xB9, 0x3E, 0xD5, 0x01, 0x52,
-    0x3B, 0x84, 0xB0, 0x03, 0xA4, 0x86, 0x81, 0xAD, 0xB2, 0x9F, 0x83, 0xCB, 0xA6, 0x01, 0x5A, 0xA1,
-    0xBB, 0x55, 0xBA, 0x17, 0x9A, 0xD0, 0x44, 0x7A, 0xF9, 0xCB, 0x23, 0x9B, 0xE7, 0x6D, 0x16, 0x81,
-    0x80, 0x09, 0xFB, 0x3E, 0x53, 0xFC, 0xF6, 0x49, 0xD3, 0x7E, 0xF2, 0xF1, 0xE2, 0xD5, 0xC9, 0xDD,
-    0x97, 0x2D, 0x25, 0xEE, 0xE7, 0x91, 0x6F, 0xD9, 0x07, 0xAB, 0xE1, 0xAA, 0x47, 0x2D, 0xCC, 0xC3,
-    0xC2, 0xDA, 0x17, 0xED, 0xF8, 0x42, 0x35, 0x50, 0x35, 0x47, 0x88, 0x2E, 0x23, 0x58, 0xD7, 0x31,
-    0xBE, 0x4C, 0x2C, 0x0D, 0x40, 0x05, 0xA8, 0x6B, 0x4F, 0x5B, 0x2D, 0xB9, 0x20, 0xF4, 0xB5, 0x35,
-    0x2C, 0x7D, 0xC1, 0x5A, 0x27, 0x7A, 0x09, 0x79, 0x11, 0xE0, 0x12, 0x01, 0xFA, 0xFA, 0x0B, 0x72,
-    0x29, 0xBE, 0x3A, 0x78, 0xF9, 0x6B, 0xDD, 0xB8, 0x27, 0xFB, 0xA6, 0x1E, 0x92, 0x01, 0xD5, 0xC2,
-    0x57, 0xBC, 0xBD, 0x6B, 0x6E, 0x16, 0x41, 0xE7, 0x44, 0x09, 0x47, 0x9E, 0x56, 0x6E, 0xB5, 0x01,
-    0x3F, 0xF9, 0xF3, 0xD7, 0xEF, 0x61, 0x10, 0xCC, 0x3D, 0x2B, 0xD4, 0xCD, 0xCB, 0x15, 0x5A, 0x7D,
-    0x8F, 0xC3, 0x3B, 0x3E, 0x2E, 0x08, 0x87, 0xB7, 0xC4, 0x15, 0x97, 0xD3, 0x06, 0xAD, 0x5D, 0x47,
-    0xB6, 0xA7, 0xC7, 0x1B, 0xD5, 0xC9, 0x3A, 0x94, 0x85, 0x1D, 0x71, 0x7C, 0x83, 0x47, 0x2B, 0x09,
-    0xC9, 0xDF, 0x79, 0x7C, 0x54, 0xA4, 0x92, 0x02, 0xF4, 0x5B, 0xAD, 0x95, 0xE7, 0x25, 0x37, 0xC0,
-    0x31, 0x72, 0x89, 0xE1, 0xF8, 0x5D, 0x62, 0x12, 0x56, 0x86, 0x44, 0xB0, 0x06, 0x76, 0xA9, 0x05,
-    0xF0, 0xEB, 0x26, 0xD3, 0x16, 0x27, 0xE1, 0x3D, 0x1B, 0xD8, 0xED, 0x76, 0xAE, 0x73, 0x0D, 0xEC,
-    0x22, 0xA6, 0x88, 0x36, 0xF1, 0xB7, 0x88, 0xFB, 0x0C, 0xFF, 0x4C, 0x1B, 0xD8, 0x31, 0x13, 0xDD,
-    0x3F, 0x6C, 0x2D, 0x2E, 0x06, 0x6D, 0x60, 0x97, 0xA8, 0xD9, 0x06, 0xF9, 0x2F, 0x83, 0x0B, 0x9A,
-    0x53, 0x0D, 0xEC, 0x2A, 0x6F, 0x46, 0xDB, 0x58, 0x7A, 0xC7, 0x9C, 0xB7, 0xA3, 0xF1, 0xAD, 0xDD,
-    0x06, 0x76, 0xA7, 0x4B, 0x17, 0xE1, 0x0A, 0xEE, 0x94, 0x2E, 0x92, 0x1F, 0xDA, 0xA2, 0x21, 0x6F,
-    0x77, 0x0B, 0x18, 0xB5, 0xE9, 0x98, 0x2B, 0x5D, 0xD4, 0x6E, 0x11, 0x83, 0xCF, 0xD2, 0xC5, 0xF8,
-    0x31, 0x24, 0xA6, 0xC3, 0xEF, 0x21, 0xC3, 0xE6, 0x8F, 0x8C, 0xA4, 0xB1, 0x23, 0xD4, 0xEF, 0x20,
-    0x7B, 0xFC, 0xEE, 0xF8, 0x36, 0x4B, 0x17, 0x45, 0xE3, 0x21, 0xBA, 0x4D, 0x88, 0x98, 0x5F, 0xBD,
-    0xCF, 0xD2, 0xC5, 0x09, 0xEE, 0x68, 0xE6, 0x93, 0xEB, 0x8F, 0x63, 0x5B, 0xB7, 0xF4, 0x5C, 0x93,
-    0xF7, 0xD4, 0x4E, 0xB7, 0xB2, 0x1C, 0x49, 0xB9, 0xD3, 0xD0, 0xEF, 0x83, 0xB6, 0x8C, 0x3A, 0xD1,
-    0x85, 0xFC, 0x03, 0x75, 0xA3, 0xFE, 0xA0, 0x3C, 0x99, 0x26, 0x95, 0x4C, 0xC0, 0xCD, 0xE7, 0xB4,
-    0x00, 0xE7, 0xC2, 0x78, 0xE3, 0xF7, 0x16, 0x27, 0x05, 0xDD, 0xBB, 0x04, 0xE5, 0x84, 0x91, 0xBC,
-    0xDA, 0x4D, 0x9A, 0x35, 0x3B, 0xA8, 0x71, 0x85, 0xE4, 0x3B, 0xB1, 0x3F, 0x12, 0x53, 0xA3, 0xCD,
-    0xE9, 0x6A, 0x56, 0x4C, 0xBA, 0xD6, 0xFA, 0x70, 0x31, 0x95, 0x72, 0x8F, 0x28, 0xE5, 0xBE, 0xF8,
-    0x7E, 0x28, 0x17, 0xDC, 0x1C, 0xD0, 0x31, 0x2E, 0xD2, 0x7E, 0x96, 0x2E, 0xB8, 0xFA, 0xD1, 0x50,
-    0x8E, 0x61, 0xA4, 0x71, 0x75, 0x6E, 0x7C, 0xAB, 0x86, 0x27, 0x1B, 0xB7, 0xDA, 0x0C, 0x30, 0x2F,
-    0x42, 0x4C, 0x24, 0xAC, 0x16, 0x88, 0xF8, 0xC1, 0xFD, 0xE1, 0x4B, 0xC3, 0x8B, 0x3B, 0x94, 0xBB,
-    0x27, 0xF9, 0x26, 0x79, 0xF9, 0x51, 0x50, 0x09, 0x68, 0x66, 0x03, 0x3E, 0xB0, 0xF3, 0xF1, 0xDD,
-    0x97, 0xAC, 0xFF, 0x4C, 0x49, 0xDF, 0x5B, 0x83, 0x7D, 0x2B, 0x3B, 0x44, 0xC7, 0x33, 0xB8, 0x89,
-    0x6B, 0x8B, 0xC6, 0x48, 0x99, 0x36, 0xBC, 0xAA, 0x5C, 0xC7, 0x2C, 0xCD, 0x9D, 0xE3, 0x06, 0x2A,
-    0x85, 0x94, 0x98, 0x6E, 0xF5, 0x2E, 0xA8, 0xAE, 0x6D, 0x1E, 0x61, 0x12, 0xA2, 0x15, 0x86, 0x9D,
-    0xAD, 0xA0, 0x07, 0x0F, 0xA1, 0x87, 0x2A, 0xF2, 0x0D, 0xE3, 0xBB, 0xB4, 0xB8, 0x32, 0x6B, 0x15,
-    0x74, 0xF8, 0x81, 0x68, 0x7D, 0x67, 0x5A, 0xAA, 0x48, 0xCF, 0xF9, 0xE3, 0xCD, 0xAD, 0x62, 0xB0,
-    0xD8, 0x9F, 0x9C, 0x95, 0xA1, 0x28, 0x66, 0x68, 0x5D, 0x7D, 0x87, 0x76, 0x70, 0x69, 0x89, 0xF8,
-    0x4F, 0x9A, 0x65, 0x89, 0x93, 0xD6, 0x34, 0xC5, 0xAC, 0xDF, 0xC5, 0x92, 0x67, 0xD5, 0x57, 0xDE,
-    0xA4, 0x2B, 0xC5, 0x0A, 0x05, 0xDA, 0xF8, 0x7B, 0x40, 0xBC, 0x6E, 0x85, 0xC4, 0x76, 0x38, 0x36,
-    0x62, 0xE5, 0xB4, 0xC0, 0x62, 0x03, 0x5A, 0x84, 0xDC, 0x26, 0xAA, 0xB2, 0x2A, 0xEA, 0x9B, 0x03,
-    0x51, 0x7E, 0x81, 0x77, 0x0B, 0x3C, 0x5D, 0xB3, 0x24, 0x16, 0x6A, 0xDA, 0xBA, 0xDA, 0xED, 0x63,
-    0x4C, 0x2E, 0xCC, 0x64, 0xBD, 0x24, 0x89, 0x94, 0x2F, 0x12, 0x93, 0x33, 0x45, 0x5E, 0x3C, 0x62,
-    0x26, 0x78, 0x55, 0x3A, 0x47, 0x24, 0x6C, 0x6B, 0x67, 0x21, 0xF8, 0xC7, 0xE3, 0x93, 0xED, 0x94,
-    0x62, 0x18, 0x5D, 0xDB, 0xC2, 0xDF, 0x19, 0x8E, 0xAC, 0xFB, 0xDC, 0xDA, 0x8E, 0x2A, 0xF4, 0x98,
-    0x18, 0x36, 0xB0, 0x5C, 0xDE, 0x84, 0xEB, 0xE9, 0x34, 0x26, 0x99, 0x9B, 0x4B, 0xCB, 0x47, 0xDA,
-    0x50, 0xD6, 0x60, 0x87, 0xDA, 0xD4, 0x5D, 0xAB, 0x08, 0xAD, 0xFD, 0x49, 0x62, 0x27, 0x13, 0x64,
-    0x2B, 0x77, 0xBE, 0x84, 0xA7, 0x60, 0xE3, 0x58, 0x51, 0xF5, 0x80, 0x4C, 0x84, 0x68, 0x9D, 0xBC,
-    0x06, 0xA9, 0xAC, 0xF8, 0xD3, 0xEC, 0x95, 0xF9, 0x31, 0x99, 0x63, 0x17, 0x8B, 0xE3, 0xCB, 0x16,
-    0x87, 0x7F, 0x2C, 0x1F, 0x67, 0x33, 0x27, 0x5A, 0x3C, 0x16, 0xCE, 0x57, 0x81, 0x62, 0xCC, 0x88,
-    0x99, 0xCC, 0xD8, 0x66, 0x1F, 0xB5, 0xA3, 0xC3, 0x51, 0xEB, 0xF7, 0x69, 0x87, 0xF6, 0x20, 0x49,
-    0x17, 0x54, 0x30, 0x45, 0xC5, 0x28, 0xEA, 0x7C, 0x24, 0x38, 0x57, 0x69, 0x65, 0x08, 0xF3, 0x36,
-    0x67, 0x11, 0x6A, 0xB0, 0x41, 0x04, 0xD4, 0xB3, 0x27, 0xDB, 0x2E, 0xEB, 0xF4, 0xB5, 0xE9, 0x60,
-    0x80, 0x71, 0x7E, 0x5A, 0x9B, 0x51, 0x96, 0x9B, 0x84, 0x8E, 0xBB, 0xD2, 0x9E, 0x92, 0xF6, 0x0E,
-    0x9F, 0x7E, 0x51, 0x98, 0xFB, 0x2A, 0x9F, 0xAE, 0x09, 0x17, 0xB7, 0x24, 0xFD, 0x56, 0x24, 0x2A,
-    0x10, 0x70, 0xBF, 0x2C, 0xFA, 0x0A, 0xF7, 0xD1, 0x17, 0x8A, 0x7F, 0xB7, 0x0B, 0xD6, 0xC2, 0xB2,
-    0x8E, 0x25, 0x09, 0x58, 0x30, 0x9D, 0x73, 0xBE, 0xAE, 0x4C, 0xD4, 0xF1, 0xDB, 0xD3, 0xBE, 0xD8,
-    0xEC, 0x89, 0xCD, 0x68, 0x5C, 0xE7, 0x6D, 0x79, 0xE7, 0x27, 0xE1, 0x94, 0x4F, 0xF8, 0xBA, 0x73,
-    0xD7, 0x17, 0x71, 0xE0, 0x91, 0x7D, 0x40, 0xDE, 0xDE, 0x32, 0xA2, 0x3A, 0xD2, 0xDC, 0x51, 0x0D,
-    0x9B, 0x29, 0xF6, 0x9F, 0x66, 0xBC, 0x5C, 0xFD, 0x33, 0xFA, 0x67, 0xE9, 0xDA, 0xB9, 0x00, 0x3C,
-    0xFD, 0x4B, 0xEC, 0x7B, 0xAC, 0x81, 0x81, 0x3D, 0x4D, 0xBB, 0x68, 0x04, 0x68, 0xD9, 0x47, 0x5F,
-    0x7B, 0x64, 0xCA, 0xF5, 0x22, 0x17, 0xD4, 0x73, 0xDA, 0xC4, 0x98, 0x91, 0x27, 0xB4, 0x2A, 0xEA,
-    0x51, 0xB8, 0x5C, 0xE2, 0x24, 0xB1, 0x9B, 0xDC, 0x53, 0x34, 0xF0, 0xF6, 0xFA, 0x85, 0x1D, 0x7C,
-    0x79, 0xE1, 0x9A, 0xF0, 0xFA, 0xE0, 0x9D, 0x79, 0x6A, 0x4B, 0x2F, 0xD7, 0x3B, 0x2C, 0xAC, 0xFD,
-    0xEC, 0xF8, 0x3B, 0xCC, 0xED, 0x88, 0x49, 0x84, 0x0D, 0x1B, 0x74, 0x8B, 0xB8, 0x10, 0x75, 0xB1,
-    0x0C, 0xEC, 0x4B, 0x37, 0x11, 0x54, 0x83, 0xC4, 0x3B, 0xCF, 0x9E, 0xE5, 0xE1, 0xC6, 0x9B, 0x5B,
-    0x19, 0xEF, 0x7B, 0x04, 0x73, 0xA2, 0x25, 0x97, 0x02, 0x54, 0x61, 0x21, 0x1E, 0x4F, 0x3D, 0x5E,
-    0x68, 0xBD, 0x92, 0x17, 0x34, 0xCC, 0x69, 0xDB, 0x12, 0xE2, 0xFE, 0xF5, 0xCE, 0xA5, 0x9A, 0xC6,
-    0x6A, 0xE9, 0xD6, 0x04, 0x6A, 0x1A, 0x14, 0xA9, 0x39, 0x35, 0x25, 0xDB, 0xDB, 0x57, 0xFE, 0x3A,
-    0x21, 0x8C, 0x36, 0x6C, 0xCF, 0x29, 0x58, 0xCA, 0xFA, 0x93, 0x25, 0x66, 0x20, 0x5C, 0x34, 0x09,
-    0x7E, 0xCD, 0x44, 0xB8, 0x1D, 0x7E, 0x16, 0xAC, 0x94, 0xC6, 0xBA, 0x06, 0xC2, 0x6D, 0x69, 0x31,
-    0x0C, 0x75, 0x97, 0xE3, 0xE3, 0xDA, 0x75, 0x77, 0xB7, 0xB6, 0xBF, 0x76, 0xA0, 0x87, 0xA2, 0x4B,
-    0x27, 0xA8, 0xAC, 0x03, 0xCA, 0xA2, 0xF8, 0xB7, 0xB0, 0x2E, 0x73, 0x16, 0x29, 0x9B, 0x1A, 0x75,
-    0xB5, 0xAA, 0xF7, 0xD2, 0x4E, 0xBD, 0x97, 0x64, 0xB8, 0x4E, 0xE7, 0xC5, 0x1C, 0xF3, 0xC9, 0xCC,
-    0x99, 0x7C, 0x62, 0xB7, 0x16, 0x4D, 0x6C, 0x4D, 0xAE, 0xCD, 0xC9, 0xFB, 0xE7, 0x5D, 0xA5, 0x02,
-    0x2B, 0x40, 0x1B, 0xD6, 0x71, 0x13, 0xCF, 0xF2, 0xEF, 0x81, 0x66, 0x39, 0xF0, 0x51, 0xDC, 0xCF,
-    0xBC, 0x33, 0xA6, 0x2A, 0x86, 0x6A, 0xC5, 0xF0, 0xF9, 0x84, 0xDD, 0xD3, 0x25, 0x27, 0x26, 0x1D,
-    0x6B, 0x41, 0x32, 0xAA, 0x2B, 0xAD, 0x79, 0x62, 0x2B, 0x4F, 0xE6, 0x2C, 0xD2, 0x26, 0xD8, 0xBA,
-    0x49, 0x12, 0x3C, 0x4B, 0xEB, 0xF1, 0x98, 0x27, 0xA0, 0xE9, 0xEE, 0xBE, 0x68, 0xB2, 0x77, 0xBE,
-    0xDE, 0x9A, 0xF3, 0x8F, 0xD4, 0xC4, 0x74, 0xF1, 0xED, 0x0C, 0x23, 0xFF, 0x57, 0x1D, 0x34, 0x1A,
-    0x1D, 0xD5, 0xD8, 0xFB, 0xAD, 0x53, 0x6C, 0xDC, 0xA8, 0xC0, 0xB8, 0xCB, 0xA1, 0x36, 0x4E, 0x5B,
-    0xFB, 0xCC, 0x0A, 0xA9, 0x68, 0x1F, 0xF7, 0x54, 0x86, 0x0D, 0x09, 0x79, 0xEB, 0x6F, 0xD3, 0x44,
-    0x79, 0x79, 0xE9, 0x40, 0x79, 0x79, 0xF1, 0x9A, 0xF2, 0xF2, 0xC0, 0x8E, 0xB3, 0x53, 0xFC, 0xAB,
-    0xF5, 0x95, 0x13, 0x5E, 0xAA, 0xD4, 0x49, 0xBA, 0x77, 0x06, 0xBD, 0x77, 0xA3, 0xF2, 0xB2, 0x23,
-    0xCF, 0xD2, 0x1F, 0xAC, 0xA8, 0xA5, 0xB2, 0x3F, 0xB0, 0xCC, 0xD9, 0x6B, 0x45, 0xE6, 0x3A, 0xF5,
-    0x9B, 0xDB, 0xAC, 0xC2, 0xB9, 0xD0, 0x06, 0x37, 0xCC, 0xE4, 0x29, 0x2F, 0xB5, 0x63, 0xFF, 0xC6,
-    0x9D, 0x68, 0x26, 0xF6, 0x2D, 0x78, 0x91, 0xA1, 0xBC, 0xDC, 0x23, 0x94, 0x2D, 0x7C, 0x67, 0xCD,
-    0xFC, 0xF8, 0x37, 0xBD, 0xED, 0xE7, 0x2E, 0x61, 0xE8, 0xFB, 0xCF, 0x60, 0xC0, 0xFB, 0x2C, 0x8A,
-    0x62, 0x92, 0x78, 0x5D, 0x7A, 0xAE, 0x9D, 0x50, 0x74, 0x57, 0x01, 0xAC, 0x3F, 0x06, 0x50, 0xF5,
-    0x47, 0xFF, 0x1D, 0x71, 0xFD, 0xBF, 0xF8, 0x01, 0x22, 0xB6, 0x7F, 0xDC, 0xDA, 0x49, 0x9E, 0x5A,
-    0x4B, 0x44, 0x1B, 0x3E, 0x53, 0x47, 0x0B, 0x5E, 0x23, 0xD3, 0xC1, 0xEF, 0xB5, 0x43, 0xCE, 0xD7,
-    0xDF, 0xE1, 0x0E, 0xC9, 0xC7, 0x81, 0x54, 0x3C, 0x3F, 0x1E, 0x7E, 0xE2, 0x76, 0x48, 0x6F, 0x3B,
-    0x84, 0x15, 0xCD, 0x1B, 0x9E, 0x76, 0xB8, 0x5B, 0xD1, 0xD5, 0x9D, 0xAE, 0xE8, 0xEA, 0x68, 0xCF,
-    0xAC, 0x96, 0x15, 0x5D, 0x7B, 0xBC, 0xD2, 0xBA, 0x0B, 0x59, 0x59, 0x7E, 0x72, 0x47, 0x70, 0x6A,
-    0xFE, 0x87, 0xB8, 0x23, 0x7A, 0xB6, 0x3D, 0xDD, 0xB8, 0x30, 0x0E, 0x7C, 0x4A, 0xE1, 0x09, 0xCC,
-    0x4D, 0x54, 0x3D, 0x26, 0x05, 0x3B, 0xE1, 0x35, 0xEC, 0xF4, 0xB9, 0x8E, 0xAB, 0x5F, 0x84, 0x4C,
-    0x5D, 0x9D, 0xA3, 0x1C, 0x55, 0xE2, 0xD6, 0xB6, 0xD9, 0x47, 0xCB, 0x90, 0x0D, 0xBA, 0x97, 0x84,
-    0x27, 0xB7, 0x94, 0x17, 0xBA, 0x11, 0x66, 0x5E, 0x1C, 0x15, 0xA6, 0x46, 0xB5, 0x3C, 0xF0, 0xF8,
-    0xA6, 0xF6, 0xC5, 0xEE, 0xA2, 0x5D, 0x5E, 0xE8, 0x61, 0x05, 0x76, 0x14, 0x2C, 0x2D, 0x50, 0x77,
-    0x36, 0x85, 0xF2, 0xA2, 0x99, 0xFA, 0xF6, 0xBB, 0x48, 0x7F, 0x66, 0x72, 0x17, 0x2A, 0x08, 0x4D,
-    0xFC, 0x62, 0x3D, 0x8A, 0xD1, 0xF3, 0x9D, 0x94, 0xDA, 0x33, 0x63, 0xA4, 0xC9, 0x6E, 0xA0, 0xEE,
-    0xA7, 0x3D, 0xA0, 0xC4, 0x69, 0xF7, 0x41, 0xE0, 0xA0, 0x79, 0x50, 0x29, 0x0C, 0x12, 0x6B, 0x9E,
-    0x8E, 0x6B, 0x2D, 0x5C, 0x5F, 0xD2, 0x94, 0xED, 0x2D, 0x5D, 0x41, 0x5A, 0x14, 0x44, 0x3A, 0x1B,
-    0xA1, 0xAD, 0x02, 0x0D, 0xC6, 0x64, 0x4F, 0x47, 0x47, 0x33, 0x33, 0xD6, 0x2F, 0x40, 0xB1, 0x5F,
-    0x08, 0x99, 0x68, 0xED, 0x25, 0x0A, 0x13, 0x4B, 0x4D, 0x04, 0x4F, 0x07, 0x27, 0xA4, 0xD3, 0xC1,
-    0x09, 0xB5, 0x3B, 0x38, 0x41, 0xF3, 0xCB, 0xDE, 0x7D, 0x0F, 0x4E, 0x70, 0xD5, 0x9B, 0xF3, 0x79,
-    0x09, 0xDB, 0x85, 0x53, 0x16, 0xBE, 0xD7, 0xC1, 0x09, 0xA7, 0xCF, 0x4B, 0x58, 0x1E, 0x9C, 0x40,
-    0xF1, 0x71, 0xBF, 0x83, 0x13, 0xAA, 0x45, 0x97, 0x1E, 0x1D, 0x60, 0x31, 0x1F, 0x9C, 0xC0, 0x42,
-    0x11, 0xEC, 0x87, 0x23, 0xB4, 0x2C, 0xC4, 0x86, 0xA8, 0xA7, 0x10, 0x74, 0xBC, 0xDD, 0xC9, 0xC7,
-    0x7B, 0xCB, 0x52, 0xD6, 0x5B, 0xA7, 0x1E, 0x5E, 0x71, 0x0F, 0x2F, 0x9F, 0xCC, 0x72, 0x53, 0x77,
-    0xE4, 0xD5, 0x85, 0xD1, 0x15, 0xA2, 0x4C, 0x9D, 0x8C, 0x98, 0xBE, 0xF4, 0x89, 0x55, 0x0F, 0xD8,
-    0x00, 0x7A, 0xAE, 0xF2, 0xDD, 0x98, 0xFD, 0x16, 0xDD, 0xBD, 0xF1, 0x12, 0x4F, 0x63, 0x8D, 0x34,
-    0x18, 0xD4, 0xD9, 0x71, 0x69, 0xA8, 0x91, 0x5B, 0xCD, 0x05, 0x91, 0xA9, 0x16, 0x44, 0x76, 0x57,
-    0x50, 0xB2, 0x39, 0xA2, 0x64, 0x26, 0xD4, 0x08, 0xFD, 0x3F, 0xE3, 0xE2, 0x0D, 0x16, 0x20, 0x47,
-    0xD5, 0xDD, 0xE9, 0x8C, 0x2A, 0x7C, 0x58, 0x61, 0x86, 0x5C, 0xD5, 0x0F, 0x17, 0x13, 0xBB, 0xD5,
-    0x89, 0x23, 0xB8, 0xDA, 0x31, 0xBC, 0xCA, 0x27, 0x8E, 0xA7, 0x13, 0xCB, 0x1F, 0x99, 0x78, 0xFE,
-    0xC8, 0xC4, 0xF4, 0xCF, 0x2D, 0xB8, 0x3E, 0xB3, 0x7D, 0xE6, 0xFB, 0xCC, 0xF8, 0x99, 0xF3, 0x33,
-    0xEB, 0x67, 0xDE, 0xCF, 0xCC, 0x9F, 0x99, 0xBE, 0x7C, 0x72, 0xFC, 0x9F, 0x17, 0xC0, 0xBC, 0x02,
-    0xE6, 0x25, 0x30, 0xAF, 0x81, 0x79, 0x11, 0xCC, 0xAB, 0x60, 0x5A, 0x06, 0xB6, 0x0E, 0xFE, 0xCA,
-    0x73, 0x0B, 0x61, 0xB3, 0x53, 0x0A, 0x0A, 0xA9, 0x4E, 0x1E, 0xDE, 0xD8, 0x2A, 0x13, 0xF7, 0x95,
-    0x8B, 0xFB, 0xCA, 0xC6, 0x7D, 0xE5, 0xE3, 0x43, 0xC1, 0xC6, 0x95, 0x28, 0x5B, 0x95, 0x72, 0xB8,
-    0x99, 0x6C, 0x71, 0x65, 0xA6, 0x71, 0xD3, 0xD8, 0xE9, 0x8E, 0xBF, 0x53, 0x86, 0x1A, 0x47, 0x8D,
-    0xA5, 0xC6, 0x53, 0x8F, 0x4C, 0x6D, 0xB5, 0x98, 0xC6, 0x90, 0x32, 0xCE, 0xD3, 0xD6, 0xF4, 0xDD,
-    0xF4, 0xA4, 0x6D, 0xEB, 0x0B, 0x07, 0xCB, 0x1A, 0x5C, 0x54, 0xC7, 0xFC, 0xE9, 0xFA, 0x7D, 0x1E,
-    0x5B, 0xBB, 0x75, 0x54, 0x0F, 0x36, 0x8E, 0xD6, 0xE1, 0xC6, 0x69, 0x05, 0xFC, 0x76, 0xCA, 0xA3,
-    0x22, 0x08, 0x5D, 0xA7, 0x62, 0xE0, 0xB1, 0xB5, 0x6F, 0xD5, 0x5B, 0xCF, 0x90, 0x9D, 0xD1, 0x68,
-    0x4F, 0x15, 0x0F, 0xD1, 0x52, 0x83, 0x03, 0x35, 0xEE, 0xAD, 0x36, 0xBB, 0xE6, 0xA2, 0xB5, 0xA3,
-    0x3F, 0xF2, 0xF9, 0x89, 0x18, 0x37, 0x3B, 0x26, 0xC4, 0xD7, 0x0F, 0xAB, 0x0B, 0x37, 0x08, 0xB3,
-    0x09, 0x92, 0x95, 0xF0, 0xC8, 0x47, 0x7B, 0x72, 0xE0, 0x04, 0x79, 0x24, 0xD9, 0x02, 0xEA, 0x9E,
-    0x4F, 0xEE, 0x86, 0x05, 0x45, 0x0A, 0x17, 0xC7, 0x8A, 0x1B, 0x47, 0x8F, 0xC4, 0x1D, 0x1D, 0xC7,
-    0x7A, 0x53, 0xF3, 0xF7, 0x7B, 0x57, 0x8B, 0x14, 0x8F, 0x37, 0x07, 0x07, 0x9E, 0x1D, 0xDF, 0x38,
-    0x55, 0x58, 0xE5, 0xD9, 0x69, 0x41, 0x32, 0x9A, 0x0B, 0xE3, 0x8D, 0x1B, 0x04, 0x28, 0x59, 0xBB,
-    0x6D, 0xF6, 0xDA, 0x36, 0xAB, 0xBD, 0x34, 0xB9, 0x61, 0x85, 0x55, 0x53, 0xC7, 0x46, 0x3B, 0xD5,
-    0x49, 0x5B, 0x32, 0x03, 0x15, 0x0E, 0x1F, 0xBC, 0x93, 0xFB, 0x4D, 0x2B, 0x16, 0xD5, 0xE6, 0x30,
-    0x61, 0xAF, 0xBD, 0x60, 0xD8, 0x18, 0x4A, 0x4B, 0x46, 0xD1, 0xB9, 0x52, 0x77, 0xBB, 0x6B, 0x40,
-    0xA7, 0x25, 0xD0, 0x72, 0x37, 0x54, 0x03, 0xCB, 0x46, 0x27, 0x0A, 0x58, 0x6C, 0xC8, 0xC5, 0xF4,
-    0x54, 0x26, 0x7F, 0xC1, 0xA0, 0x68, 0xB9, 0xAD, 0x88, 0xD2, 0xCA, 0x61, 0x73, 0x85, 0x30, 0x79,
-    0x99, 0x85, 0x8B, 0xCE, 0x8D, 0x6F, 0xEC, 0xA0, 0x88, 0x37, 0x8B, 0x1F, 0x8E, 0xC5, 0xCF, 0x4D,
-    0xF9, 0x78, 0x4B, 0x94, 0x1B, 0xDE, 0x1D, 0x67, 0xAB, 0x8D, 0xAC, 0x87, 0x4D, 0xFA, 0x51, 0x01,
-    0xE2, 0x65, 0x41, 0x4C, 0x8C, 0x05, 0x88, 0xE5, 0xD6, 0x31, 0xC5, 0xCF, 0xA3, 0xD9, 0xF2, 0x26,
-    0x5B, 0xB1, 0x6B, 0x5B, 0xDE, 0xB2, 0xAB, 0x6B, 0x8E, 0x72, 0x13, 0xA0, 0xDB, 0x62, 0xFE, 0x6E,
-    0x93, 0xA0, 0xFC, 0x07, 0x37, 0xFE, 0x09, 0x11, 0xBF, 0x99, 0xE8, 0x2E, 0x04, 0xC4, 0x57, 0xD1,
-    0x9A, 0xBC, 0x63, 0x9F, 0xBC, 0x68, 0x1D, 0x6C, 0x15, 0x45, 0x4C, 0xF1, 0x51, 0xDE, 0x1D, 0xDB,
-    0xCF, 0xD1, 0x62, 0xB9, 0x0B, 0x8B, 0xE3, 0x7C, 0x64, 0x6E, 0xF0, 0x17, 0x0A, 0x57, 0x41, 0xA8,
-    0xA8, 0xE8, 0x64, 0xF8, 0x8F, 0x53, 0x1D, 0xD7, 0x60, 0x4B, 0x1C, 0x2D, 0x8A, 0x7B, 0x4C, 0x17,
-    0xDD, 0xB0, 0x6B, 0x46, 0x5B, 0x72, 0x8C, 0x53, 0x68, 0x0C, 0x44, 0x15, 0xAE, 0x65, 0x51, 0x02,
-    0x51, 0x45, 0x3C, 0x15, 0xDA, 0xE6, 0xE2, 0x79, 0x8B, 0xAB, 0x76, 0xEB, 0xFA, 0x3A, 0xE2, 0x36,
-    0xF9, 0xB7, 0x31, 0x38, 0x98, 0x88, 0xE1, 0x70, 0x64, 0xD1, 0x34, 0xD4, 0xA1, 0x5D, 0xC9, 0x4E,
-    0x36, 0x43, 0xF8, 0x64, 0x40, 0x21, 0xFE, 0x21, 0x77, 0xD6, 0x35, 0x40, 0x21, 0x22, 0x36, 0xDB,
-    0xE1, 0x9E, 0xD6, 0x2C, 0x82, 0x3A, 0xEB, 0x06, 0x87, 0x6F, 0xE6, 0x2A, 0x74, 0x5E, 0x7D, 0x86,
-    0x4B, 0xD5, 0xF1, 0x08, 0xB7, 0xCB, 0xDA, 0xEE, 0x8F, 0x04, 0x0A, 0xF1, 0x4D, 0x2F, 0x59, 0x07,
-    0x9D, 0xD9, 0x64, 0x84, 0x42, 0x24, 0xD7, 0xCF, 0xF0, 0x70, 0xBB, 0x5D, 0x0F, 0xB7, 0x58, 0xC4,
-    0xE4, 0xC6, 0x6D, 0xA2, 0xD7, 0x36, 0xEA, 0x7D, 0xB1, 0x4B, 0x65, 0x63, 0xDD, 0xBE, 0x84, 0xC1,
-    0x5C, 0xD3, 0xF3, 0x5D, 0xBE, 0x8A, 0x31, 0x7D, 0xF3, 0x3D, 0x72, 0x3C, 0xCB, 0xB2, 0x90, 0xF7,
-    0x38, 0xA0, 0xFD, 0xBE, 0xA7, 0xBC, 0x64, 0x76, 0xCA, 0x8B, 0xAE, 0x00, 0xD2, 0x73, 0x5C, 0xBC,
-    0x31, 0x3D, 0x55, 0x88, 0x90, 0x2C, 0x9C, 0xD2, 0x5F, 0xF0, 0x5C, 0x59, 0xE5, 0x4F, 0xDF, 0x3D,
-    0x30, 0xF8, 0x68, 0xBA, 0x07, 0x9E, 0xD3, 0xEE, 0x81, 0xF5, 0x98, 0x6B, 0xF7, 0x40, 0x93, 0xA7,
-    0x7B, 0xFF, 0xD2, 0x18, 0x71, 0xD1, 0xF3, 0x16, 0xCE, 0xEC, 0x9C, 0xB5, 0x5D, 0xEF, 0x24, 0x11,
-    0x7D, 0x73, 0xF8, 0x22, 0x4B, 0x6A, 0xFB, 0xFF, 0x5A, 0xE6, 0xB9, 0xF1, 0x79, 0x6C, 0x3B, 0x6F,
-    0xA1, 0x1E, 0xD1, 0x6A, 0x47, 0xC2, 0x53, 0x87, 0x54, 0x64, 0x77, 0xA6, 0x8B, 0xE7, 0x9A, 0x52,
-    0xB2, 0xD7, 0x9A, 0x86, 0x95, 0x82, 0x03, 0x09, 0xE6, 0xEC, 0x52, 0x65, 0xC5, 0x81, 0xF2, 0x45,
-    0xCF, 0x5E, 0xB9, 0xBB, 0xD2, 0x58, 0x64, 0x73, 0xEF, 0xE4, 0xC7, 0x6E, 0x54, 0xFA, 0x3E, 0xC9,
-    0x0F, 0x4D, 0x81, 0xEB, 0x01, 0x3E, 0x50, 0xD4, 0xAD, 0xCB, 0xCD, 0x94, 0x48, 0xEB, 0x65, 0x42,
-    0x73, 0x94, 0x85, 0x8A, 0x48, 0x43, 0x43, 0x17, 0x9C, 0x40, 0x8B, 0xFA, 0xC7, 0xB0, 0xF3, 0xDD,
-    0x05, 0x35, 0x32, 0x31, 0x3B, 0x07, 0x82, 0xCC, 0x19, 0x62, 0xC5, 0x07, 0x86, 0x59, 0x2F, 0x89,
-    0x51, 0xC0, 0x92, 0xCF, 0x31, 0xDD, 0x3C, 0x77, 0x21, 0xA6, 0xAC, 0xF3, 0xBC, 0x93, 0x51, 0xE1,
-    0xBC, 0xD8, 0x49, 0xFF, 0x4D, 0x76, 0xB9, 0x47, 0xF9, 0xCE, 0x6E, 0xF6, 0x3F, 0x1B, 0x92, 0xFA,
-    0x8F, 0x0F, 0x87, 0xB6, 0x25, 0xE5, 0x05, 0xE7, 0x5E, 0x1A, 0x6E, 0x7C, 0xA2, 0x49, 0x5A, 0x42,
-    0x40, 0x97, 0x7C, 0xE9, 0x7B, 0x93, 0xF4, 0xFE, 0xE7, 0xFF, 0x28, 0x8C, 0xF8, 0xD4, 0xF9, 0x3F,
-    0x16, 0x8E, 0x9C, 0xCE, 0xFF, 0xA9, 0x54, 0xF1, 0x5E, 0xB6, 0x54, 0x9C, 0xE9, 0x8D, 0xE9, 0xFC,
-    0x1F, 0xA7, 0xE4, 0x5D, 0x2C, 0xDD, 0xB6, 0x8C, 0x3B, 0xFF, 0xE7, 0x4F, 0x2D, 0xCA, 0x6B, 0xE7,
-    0xFF, 0x5C, 0xBE, 0xF7, 0xF9, 0x3F, 0x8D, 0x36, 0xC0, 0x58, 0x9E, 0xFF, 0x13, 0xEC, 0x9C, 0xFF,
-    0x83, 0x48, 0x1A, 0xCE, 0xFF, 0x79, 0xBF, 0x91, 0xB4, 0xE2, 0xBE, 0x91, 0x34, 0x8F, 0xC4, 0x90,
-    0x4F, 0x3F, 0xEA, 0x70, 0x7C, 0xAA, 0x08, 0xE1, 0xB5, 0x9B, 0xB6, 0xBF, 0xE5, 0x4A, 0x1A, 0xB8,
-    0x90, 0x6A, 0xAE, 0x23, 0x6D, 0x2C, 0xA9, 0xA7, 0x48, 0x99, 0x44, 0x5E, 0xCD, 0xD3, 0xFD, 0x09,
-    0xD3, 0x51, 0x7F, 0xCC, 0xF2, 0xCC, 0xD7, 0xF4, 0x4C, 0xEC, 0x81, 0xB3, 0xA8, 0x09, 0x8D, 0x2D,
-    0x35, 0x80, 0xB3, 0x86, 0xEF, 0x62, 0x7A, 0xF7, 0x54, 0x0C, 0xCD, 0xE2, 0x30, 0xDD, 0x04, 0x59,
-    0xD8, 0x23, 0x41, 0x12, 0x2D, 0x11, 0xFC, 0x0F, 0xA6, 0x33, 0x1E, 0x93, 0xD9, 0x53, 0x6D, 0x7C,
-    0x5D, 0xA4, 0x34, 0xCA, 0x19, 0x4B, 0x84, 0x23, 0x52, 0x18, 0x06, 0xD0, 0x4A, 0x48, 0x85, 0xB0,
-    0xCF, 0xF2, 0xBE, 0xBC, 0x93, 0x01, 0x88, 0xAF, 0x8A, 0x86, 0xF8, 0xE2, 0x0C, 0xFF, 0x70, 0xE7,
-    0x07, 0xCC, 0xD9, 0xB5, 0xA9, 0x17, 0xD6, 0xE8, 0xC4, 0xCA, 0x60, 0xCB, 0xDF, 0x37, 0xF8, 0xC7,
-    0x9C, 0x76, 0x9B, 0x0A, 0xFF, 0xEC, 0xDC, 0x4F, 0xEB, 0xE6, 0x0E, 0x15, 0x12, 0xD9, 0x39, 0x1D,
-    0xBA, 0x47, 0x5C, 0xD5, 0x29, 0x49, 0x95, 0x38, 0xD5, 0x9A, 0xEE, 0xA0, 0x3E, 0xA6, 0x73, 0x3F,
-    0x6B, 0x83, 0x7F, 0x7C, 0x99, 0xC6, 0xEC, 0xDD, 0x82, 0xE9, 0x98, 0x71, 0x02, 0x7B, 0x9C, 0x9B,
-    0x22, 0xF3, 0x13, 0x0A, 0xEB, 0xF2, 0x29, 0xF8, 0xC7, 0xF4, 0xB0, 0x7F, 0xEA, 0xE1, 0xAB, 0x33,
-    0xE4, 0x0A, 0x95, 0xB1, 0x79, 0x91, 0xFD, 0x70, 0xA8, 0x85, 0x6E, 0x97, 0xC3, 0x75, 0xD2, 0x88,
-    0xEF, 0x14, 0xAE, 0xE3, 0x6A, 0xF4, 0x9E, 0x09, 0xFB, 0xA8, 0x18, 0xBC, 0x97, 0xA3, 0x2E, 0x2A,
-    0xD4, 0xE7, 0xF0, 0xD5, 0xCD, 0xA0, 0xC9, 0xAF, 0x87, 0xC9, 0xA4, 0x56, 0x7F, 0xCA, 0x46, 0x30,
-    0xEE, 0x14, 0x1C, 0x3B, 0xE1, 0x33, 0x67, 0x6F, 0x04, 0xF6, 0xE3, 0xE7, 0x2D, 0xF8, 0x3E, 0xFD,
-    0x8B, 0x98, 0x0E, 0x47, 0xF3, 0x2A, 0x7D, 0x27, 0x3D, 0xB1, 0x38, 0x11, 0xD9, 0x06, 0x6B, 0x40,
-    0xCC, 0x92, 0x7F, 0xDE, 0x2E, 0x73, 0x36, 0x76, 0x33, 0x7C, 0x59, 0x5A, 0x78, 0x33, 0x8E, 0x49,
-    0x1D, 0x63, 0x07, 0x03, 0x7A, 0xB8, 0x60, 0x45, 0x9E, 0x38, 0x72, 0x35, 0x65, 0x65, 0x0F, 0xBC,
-    0x64, 0xBC, 0xA5, 0xB3, 0x64, 0xD5, 0x23, 0xF1, 0x7C, 0x6E, 0xD3, 0xCE, 0x81, 0x4D, 0xF1, 0x7D,
-    0x8E, 0x37, 0xB7, 0xD9, 0xC0, 0x0A, 0xC3, 0x39, 0xCC, 0x43, 0x71, 0x44, 0x9C, 0x90, 0x66, 0x84,
-    0x8F, 0xC6, 0xEB, 0xEF, 0xE3, 0x2C, 0xE8, 0xB3, 0xCE, 0x00, 0x57, 0x69, 0x79, 0x4E, 0xA5, 0xA5,
-    0x05, 0xEF, 0x5C, 0xAB, 0x11, 0x87, 0x82, 0x4B, 0x76, 0xA6, 0x6E, 0x48, 0x01, 0x77, 0x3B, 0x01,
-    0xF9, 0x29, 0xE9, 0xEB, 0x1E, 0xD1, 0xD5, 0x0D, 0xA7, 0x88, 0xC5, 0xC6, 0x4E, 0xAC, 0x0A, 0x39,
-    0xF1, 0x50, 0x4F, 0xC9, 0xE1, 0xB4, 0xE3, 0xCE, 0xFE, 0x93, 0x7D, 0x1E, 0x6D, 0x9F, 0x44, 0xFF,
-    0xC3, 0x71, 0xFC, 0x36, 0x0A, 0x45, 0xFA, 0xA5, 0x69, 0x75, 0xC6, 0x31, 0x7A, 0xAF, 0x31, 0x4E,
-    0x3C, 0x36, 0x0E, 0x5E, 0xE8, 0xF9, 0x8F, 0x55, 0x2E, 0x85, 0xE6, 0xC4, 0x4B, 0xBA, 0x58, 0x90,
-    0x24, 0xC9, 0x13, 0x73, 0xEB, 0x56, 0xD8, 0xF9, 0x3F, 0xFD, 0x71, 0x5B, 0x7E, 0xC5, 0xE3, 0xB6,
-    0xC2, 0x86, 0xDC, 0x63, 0x33, 0x84, 0xA8, 0x8F, 0x1A, 0x1E, 0xB7, 0x15, 0x57, 0xDA, 0xB8, 0xB1,
-    0xE0, 0x71, 0x5B, 0xBF, 0xFB, 0xF8, 0x19, 0xC7, 0x6D, 0x3D, 0xA7, 0xDB, 0xE5, 0x40, 0xE5, 0xEC,
-    0xBE, 0xEA, 0xBA, 0x6B, 0xCA, 0xB6, 0x67, 0x34, 0xB7, 0xFD, 0xCA, 0x7B, 0x1E, 0xB7, 0x65, 0xB8,
-    0xA7, 0xFB, 0x76, 0x99, 0xFD, 0x55, 0x74, 0x99, 0x7D, 0x05, 0x25, 0xD7, 0xAC, 0xBF, 0xEE, 0x64,
-    0xD1, 0xBF, 0xF3, 0xEE, 0x4E, 0x97, 0x59, 0xF4, 0x3B, 0xF0, 0x42, 0xA4, 0x05, 0xA3, 0xE7, 0xE5,
-    0x72, 0xEE, 0xD1, 0x7B, 0x74, 0x99, 0x55, 0x00, 0x9B, 0x6B, 0x46, 0xE3, 0x96, 0xC8, 0x07, 0x07,
-    0x84, 0x9C, 0x03, 0x8C, 0x3A, 0x1C, 0x18, 0x87, 0x08, 0xC7, 0xE3, 0x27, 0x46, 0xC5, 0x57, 0xD7,
-    0x95, 0x16, 0xC5, 0x9F, 0x5A, 0xF7, 0x2B, 0xED, 0xCD, 0xD9, 0x72, 0xF9, 0x53, 0xC7, 0x16, 0x76,
-    0x0A, 0x0D, 0x85, 0xD4, 0xE8, 0x59, 0xBD, 0x0A, 0xB6, 0x05, 0x96, 0xBF, 0x16, 0x7F, 0x23, 0x3E,
-    0x73, 0x73, 0x7C, 0xC3, 0xB6, 0xE0, 0xFD, 0x23, 0xD7, 0x3B, 0x68, 0x19, 0x17, 0xB9, 0x46, 0xFD,
-    0x44, 0xCE, 0xAE, 0x36, 0x25, 0x81, 0xBD, 0xF5, 0xC1, 0x7D, 0x7A, 0xA2, 0x07, 0x1F, 0xA8, 0x27,
-    0x7A, 0x75, 0xAA, 0x17, 0xD9, 0x6B, 0x85, 0xF6, 0x22, 0xCB, 0x5D, 0xFD, 0x9D, 0x5F, 0x9C, 0x28,
-    0x77, 0xAC, 0xCC, 0x31, 0x51, 0xC8, 0x64, 0x4B, 0x1F, 0x2A, 0xD0, 0xE8, 0x20, 0x33, 0x21, 0x58,
-    0x55, 0x90, 0x74, 0x0E, 0xAD, 0x57, 0x17, 0xBE, 0x85, 0xAE, 0xB2, 0xE7, 0x35, 0xD6, 0x56, 0xF2,
-    0x74, 0x4F, 0xF1, 0x40, 0x19, 0xA1, 0x11, 0xB5, 0x87, 0xFA, 0x5E, 0xE8, 0xD8, 0xB7, 0x8F, 0x0F,
-    0xEB, 0xC1, 0x34, 0x18, 0xA4, 0xC0, 0x53, 0x77, 0x5F, 0xBC, 0xB2, 0xAC, 0xFE, 0x4B, 0x4F, 0xDC,
-    0x93, 0x7B, 0xDC, 0x5D, 0xC9, 0x1F, 0x8F, 0xE6, 0xF3, 0xB4, 0x30, 0x2E, 0x57, 0x83, 0xE7, 0x1F,
-    0x6C, 0x2D, 0x2E, 0x60, 0xD2, 0xC6, 0x92, 0x89, 0xAE, 0x4D, 0x8F, 0x46, 0x4D, 0x50, 0x93, 0xE1,
-    0x85, 0xC7, 0x25, 0x75, 0x11, 0xA3, 0x5A, 0x38, 0x9B, 0x86, 0xE5, 0x52, 0xE9, 0xF3, 0x28, 0x05,
-    0xCF, 0x19, 0x0B, 0xC8, 0x45, 0x88, 0x8A, 0xF3, 0xFF, 0x8D, 0x4E, 0x56, 0x4D, 0xF6, 0x36, 0xCE,
-    0x7D, 0x3C, 0xA7, 0xA8, 0xAE, 0xF4, 0xCD, 0x62, 0x72, 0x56, 0xCD, 0x65, 0x5D, 0xCD, 0xE3, 0x93,
-    0xD1, 0x7D, 0x11, 0xEB, 0xCE, 0x67, 0x57, 0x07, 0x0E, 0x24, 0xD3, 0x61, 0x5C, 0xF5, 0x3E, 0x83,
-    0xB4, 0xCE, 0x5D, 0x60, 0xD4, 0x68, 0x3D, 0xD5, 0x0B, 0x4E, 0xA0, 0x55, 0x9B, 0xEE, 0xB3, 0x27,
-    0x7C, 0xAB, 0x67, 0x4E, 0xC4, 0xA9, 0x5F, 0xF6, 0x7E, 0xA6, 0x3C, 0xCA, 0x39, 0x5E, 0x8B, 0x61,
-    0xAC, 0x16, 0x51, 0x85, 0x6A, 0x56, 0x42, 0xA7, 0x7C, 0xDE, 0x29, 0x09, 0xB1, 0x48, 0x3E, 0x2C,
-    0x5A, 0x19, 0x4C, 0xC9, 0x86, 0x29, 0xC9, 0xB0, 0xE8, 0x9C, 0xA0, 0xAD, 0x82, 0xFA, 0x9D, 0xD2,
-    0x88, 0x29, 0x89, 0xB0, 0xEC, 0x15, 0x3A, 0x23, 0x6A, 0x2A, 0x6F, 0x71, 0xC2, 0xF2, 0x91, 0x9E,
-    0xCD, 0x7B, 0xBA, 0x99, 0xA5, 0xB5, 0xBC, 0xB3, 0xAC, 0xFF, 0xA4, 0x30, 0xF3, 0x6A, 0xB2, 0x85,
-    0xF2, 0xB1, 0x9F, 0x73, 0xEC, 0x33, 0x26, 0xE4, 0xCA, 0xE9, 0xA2, 0x83, 0xAD, 0x28, 0x49, 0x9A,
-    0x2B, 0xA1, 0x06, 0x36, 0xF1, 0x08, 0x0B, 0x53, 0x84, 0x07, 0xA7, 0x13, 0xD3, 0x88, 0xA0, 0x7F,
-    0x1C, 0x6A, 0x1A, 0xA0, 0x51, 0xD0, 0x3A, 0x84, 0x90, 0x59, 0xF8, 0x32, 0x95, 0xDB, 0xC6, 0x79,
-    0xD7, 0x58, 0x06, 0x16, 0x6A, 0x13, 0x4F, 0x60, 0x9D, 0xCA, 0x0E, 0x15, 0x8D, 0xAB, 0xB2, 0xBA,
-    0xED, 0x60, 0x2D, 0x56, 0x01, 0xAD, 0x61, 0x65, 0xE7, 0x65, 0xB8, 0x30, 0x3C, 0x96, 0xD7, 0x60,
-    0x0A, 0x2B, 0x18, 0xFD, 0xAD, 0x85, 0x7A, 0x70, 0x50, 0xAA, 0xB5, 0xB8, 0x62, 0x40, 0xCF, 0x10,
-    0x3A, 0xED, 0xD4, 0x2A, 0x6B, 0x2C, 0x88, 0x65, 0xD2, 0x12, 0xB9, 0xA8, 0xB7, 0xF6, 0xB7, 0xDA,
-    0xEF, 0xBB, 0x53, 0x91, 0x9D, 0x74, 0xBA, 0x0A, 0x14, 0xF8, 0x1A, 0x6D, 0xB4, 0x0E, 0x05, 0xC7,
-    0x40, 0x8D, 0x84, 0x2F, 0x8B, 0xC3, 0x57, 0xA0, 0xB5, 0xAA, 0x38, 0x0B, 0x29, 0xD8, 0x9F, 0x9D,
-    0xA8, 0x5D, 0xFE, 0x8A, 0xF7, 0xF7, 0x5C, 0x6E, 0x66, 0xDF, 0x4C, 0x25, 0x77, 0x04, 0xE7, 0x54,
-    0x45, 0x5A, 0x0E, 0xBB, 0xD8, 0xC8, 0xDD, 0xEA, 0x81, 0x4F, 0xFB, 0x89, 0x41, 0x1F, 0x03, 0x6E,
-    0xE3, 0xBA, 0xCB, 0xCA, 0x14, 0xAC, 0x52, 0x7B, 0x89, 0x42, 0x27, 0xE1, 0xA9, 0x01, 0x7A, 0xE8,
-    0xDB, 0x56, 0x37, 0x92, 0x6F, 0xC7, 0x47, 0x72, 0x25, 0x64, 0xCD, 0xEC, 0x65, 0x38, 0x34, 0x3C,
-    0x53, 0x46, 0xD5, 0x7C, 0x78, 0x39, 0x8F, 0x60, 0x2D, 0x3C, 0xD7, 0xD4, 0x8C, 0xEA, 0x7E, 0xDC,
-    0x38, 0x13, 0xC3, 0x19, 0x17, 0x53, 0xA9, 0x39, 0x1D, 0x9F, 0x03, 0xDB, 0xB8, 0x83, 0xC5, 0x31,
-    0x47, 0x6B, 0xD6, 0x52, 0x33, 0x7A, 0x81, 0x70, 0x53, 0xED, 0x44, 0xA4, 0xB2, 0xFB, 0xFC, 0xB4,
-    0xD3, 0x7E, 0x1A, 0x1C, 0xC7, 0x9D, 0xC2, 0xB3, 0x43, 0xED, 0xA2, 0xBB, 0x8F, 0x8F, 0xB4, 0x66,
-    0xB2, 0xD5, 0x9C, 0x8B, 0x0B, 0x7B, 0x73, 0x54, 0xD2, 0x46, 0xAB, 0xD1, 0x19, 0xF7, 0xAE, 0xB4,
-    0x2D, 0x0A, 0xAE, 0x32, 0xD5, 0x70, 0xD1, 0x78, 0x72, 0x3A, 0x8E, 0xC4, 0x67, 0xE7, 0xDE, 0xA8,
-    0xB5, 0x23, 0x34, 0x47, 0x4F, 0x7B, 0x5A, 0x38, 0x1B, 0xF0, 0x68, 0x70, 0x25, 0xB6, 0xDC, 0x8E,
-    0xA1, 0x3B, 0x38, 0x33, 0x29, 0xAC, 0xD3, 0xA3, 0x7D, 0x52, 0x6A, 0x32, 0xF6, 0x92, 0x89, 0xD1,
-    0x03, 0x73, 0x94, 0xF7, 0x2D, 0xC8, 0xFB, 0x8C, 0xD9, 0xD5, 0xAF, 0xD8, 0x5D, 0xB3, 0x2C, 0x38,
-    0x9D, 0x96, 0x82, 0x33, 0x68, 0x55, 0x76, 0x86, 0x06, 0x21, 0x88, 0x2A, 0xBD, 0x27, 0x85, 0xF2,
-    0x20, 0x31, 0x3B, 0xEF, 0x92, 0x39, 0x1D, 0xFB, 0xC6, 0x8B, 0x5B, 0xE6, 0x76, 0xF4, 0x2A, 0x53,
-    0x03, 0xB6, 0xE2, 0xF1, 0x1E, 0x8A, 0x68, 0x1B, 0x79, 0xCF, 0xA4, 0xEA, 0xA6, 0xD5, 0xA3, 0x9A,
-    0x65, 0x35, 0xF6, 0x31, 0x60, 0x76, 0xEC, 0x63, 0xB6, 0xB2, 0x8A, 0xB4, 0xC6, 0x5B, 0xFA, 0x1F,
-    0x66, 0xD4, 0xCF, 0x7E, 0xE6, 0xED, 0xDD, 0xEC, 0xAB, 0x2B, 0x46, 0xB6, 0x70, 0x90, 0xAE, 0x7F,
-    0xB6, 0x9B, 0xF6, 0xB6, 0x4F, 0xB1, 0x79, 0x10, 0xDB, 0x95, 0x35, 0x7A, 0x02, 0x52, 0x3A, 0x9D,
-    0x80, 0xF4, 0x08, 0x17, 0xE2, 0xC1, 0xE2, 0x04, 0xA4, 0x5B, 0x9C, 0xBA, 0x3B, 0xFB, 0x68, 0x24,
-    0x11, 0x68, 0x30, 0xC3, 0x97, 0x88, 0xD1, 0xA7, 0xF7, 0x1F, 0x25, 0x98, 0xEE, 0xAD, 0xCB, 0xC4,
-    0x63, 0xE2, 0xFC, 0xF4, 0x07, 0xD8, 0x90, 0x82, 0xA0, 0x97, 0x7A, 0x83, 0xEC, 0xE6, 0xDE, 0x2B,
-    0x73, 0x8E, 0x57, 0x63, 0x36, 0xBA, 0x59, 0x34, 0x1C, 0x92, 0x2D, 0x26, 0x72, 0xFB, 0x33, 0x95,
-    0x40, 0xAF, 0x4E, 0x24, 0xD0, 0x39, 0x52, 0xB7, 0x75, 0x77, 0xF6, 0xEE, 0xB4, 0x79, 0xA7, 0xDD,
-    0x6B, 0x2E, 0xEA, 0x57, 0x9C, 0x59, 0xF0, 0xAA, 0x4B, 0x44, 0x8C, 0x73, 0xD3, 0x25, 0x2D, 0xC9,
-    0x84, 0x49, 0xE9, 0xA0, 0xA1, 0x77, 0xBD, 0x13, 0x69, 0xD8, 0x8F, 0x2A, 0x93, 0xCE, 0x8A, 0x06,
-    0x9A, 0xF0, 0xD5, 0xC2, 0x84, 0x3F, 0xEB, 0x60, 0xF7, 0x01, 0xC0, 0x65, 0x30, 0xE2, 0x59, 0xCE,
-    0xED, 0x0E, 0xC9, 0x5B, 0x13, 0xD1, 0xA4, 0x95, 0xA0, 0x96, 0x3E, 0xFB, 0x4C, 0x03, 0x27, 0x2A,
-    0x97, 0x30, 0xBF, 0x5B, 0x58, 0xBE, 0x7C, 0x0A, 0x19, 0x5D, 0x3A, 0x55, 0x8E, 0xE5, 0x2A, 0xA9,
-    0xA6, 0x22, 0xAF, 0xF0, 0xDE, 0xF5, 0x41, 0xF9, 0xC7, 0xC3, 0xEE, 0x7B, 0x01, 0x27, 0x2C, 0xDD,
-    0xF0, 0x44, 0x33, 0x87, 0x1B, 0xB2, 0x45, 0xB4, 0x4B, 0xDD, 0xF5, 0x7E, 0xCE, 0x53, 0xC4, 0xED,
-    0xA7, 0x32, 0x2E, 0x54, 0xE9, 0xFA, 0x64, 0x98, 0x65, 0xBD, 0x8C, 0x0A, 0x65, 0x3B, 0xB1, 0xBD,
-    0xFD, 0x1D, 0xEF, 0xE1, 0x9B, 0x27, 0x20, 0x2E, 0x1A, 0x16, 0x62, 0x54, 0x88, 0x41, 0x21, 0xC6,
-    0x84, 0x18, 0x55, 0x61, 0x44, 0x88, 0x01, 0x21, 0xC6, 0x83, 0x18, 0x0B, 0x62, 0x34, 0x88, 0xC1,
-    0x20, 0x61, 0xD1, 0xAF, 0x88, 0x49, 0xF7, 0xC6, 0x6C, 0x76, 0x9F, 0x48, 0x59, 0xD4, 0x95, 0x81,
-    0xEA, 0xD9, 0x04, 0x0B, 0x87, 0x5B, 0x6A, 0x05, 0xE6, 0xDA, 0x09, 0x5D, 0x9E, 0xAE, 0x4E, 0xFC,
-    0x13, 0xD5, 0x48, 0xA8, 0xE1, 0x22, 0xE2, 0x9A, 0x80, 0x68, 0xE7, 0x4E, 0x60, 0x45, 0x2A, 0xA3,
-    0x77, 0x04, 0xB7, 0x94, 0x1B, 0x17, 0x22, 0x7A, 0x0E, 0xE1, 0x55, 0x9C, 0x45, 0xC7, 0x33, 0x8B,
-    0xB4, 0xDF, 0xE8, 0x3B, 0x80, 0x16, 0x3C, 0x85, 0x0F, 0xEC, 0x50, 0x33, 0xC7, 0x16, 0x99, 0x9D,
-    0xCC, 0xEE, 0x00, 0x23, 0x0B, 0x80, 0x66, 0xBC, 0x86, 0xE1, 0x05, 0x38, 0x7A, 0xAD, 0x63, 0x6B,
-    0x9F, 0xB6, 0x46, 0xC7, 0x4B, 0x3C, 0x35, 0x25, 0x3A, 0x5E, 0x52, 0x07, 0x94, 0x45, 0x52, 0xD0,
-    0x9F, 0xAC, 0x10, 0x13, 0x1E, 0x14, 0x12, 0x5F, 0x1D, 0x30, 0x4A, 0x85, 0xC0, 0xD1, 0x6D, 0xAA,
-    0xB3, 0x44, 0xE6, 0xAB, 0x1D, 0x55, 0x53, 0x40, 0x22, 0xC9, 0xB0, 0x4B, 0x5E, 0xFA, 0x27, 0x0A,
-    0xC9, 0x3A, 0xF0, 0x92, 0x3F, 0x2F, 0xC8, 0xB6, 0x7D, 0x1C, 0xC3, 0x40, 0xBB, 0xE1, 0x1A, 0x3A,
-    0x03, 0x70, 0x37, 0xDF, 0x86, 0x01, 0xCD, 0x5D, 0x3C, 0xD9, 0xD1, 0x4F, 0x8F, 0x2F, 0x44, 0xAB,
-    0x00, 0x0A, 0xB6, 0x1E, 0x57, 0x51, 0x13, 0x4D, 0xC1, 0xFA, 0x25, 0x32, 0x3D, 0x99, 0x6C, 0xDF,
-    0xD4, 0x3B, 0x15, 0xD2, 0x9D, 0x91, 0x4D, 0xFE, 0x54, 0xF4, 0x38, 0xD5, 0xF2, 0xCD, 0xC5, 0x7C,
-    0x73, 0x32, 0x82, 0xC2, 0x1D, 0x98, 0x7D, 0x0A, 0x6C, 0xD8, 0x7F, 0x0C, 0x70, 0xE0, 0x3B, 0x66,
-    0x4E, 0x70, 0x1E, 0x00, 0xA9, 0x9E, 0xC8, 0xC3, 0x4F, 0x30, 0x97, 0x47, 0x6A, 0x2F, 0xFC, 0x53,
-    0xB6, 0x45, 0x15, 0x3B, 0xF4, 0xB7, 0xF8, 0x50, 0x7A, 0x29, 0x27, 0x72, 0x2B, 0x2F, 0x0E, 0x68,
-    0xBD, 0x08, 0x61, 0x6F, 0x61, 0x4D, 0xF8, 0x5D, 0xFE, 0x7C, 0xC7, 0xDE, 0xA4, 0x6D, 0xF6, 0x87,
-    0x3C, 0x5B, 0x3A, 0x6C, 0xB2, 0x3F, 0xAA, 0xD8, 0xCE, 0xA5, 0x4A, 0xDF, 0xC6, 0x42, 0x11, 0x15,
-    0x9D, 0xD2, 0xD0, 0x12, 0x2D, 0x9D, 0xD0, 0xCA, 0x62, 0xD6, 0x1E, 0x31, 0x17, 0x59, 0x06, 0x22,
-    0x55, 0xC4, 0xC3, 0x14, 0x75, 0x1D, 0x03, 0xC5, 0x64, 0x25, 0x85, 0xFE, 0x53, 0xF7, 0x2C, 0x60,
-    0xF4, 0x4F, 0x17, 0x30, 0xB6, 0xA7, 0x04, 0x54, 0xF1, 0x89, 0xF3, 0x40, 0xA3, 0xCA, 0x6F, 0x14,
-    0xCA, 0xC7, 0x10, 0x5E, 0x9B, 0x6A, 0xC0, 0x7D, 0x63, 0xA5, 0xE2, 0xFC, 0x9D, 0x13, 0xBD, 0x55,
-    0x62, 0xD7, 0x02, 0x45, 0x65, 0xED, 0x6A, 0x99, 0x3E, 0x7A, 0x57, 0x31, 0x3F, 0x7F, 0xA9, 0x56,
-    0xCD, 0xF7, 0xD4, 0x39, 0xFF, 0x96, 0x7A, 0x2F, 0x2A, 0x4D, 0x0E, 0x54, 0xB6, 0xDC, 0x56, 0x49,
-    0xD3, 0xAB, 0x2E, 0xE2, 0x81, 0xBB, 0x38, 0xE8, 0x60, 0xAB, 0x06, 0xD0, 0xA0, 0x6B, 0x6C, 0x30,
-    0x0F, 0x52, 0xE1, 0x0F, 0xA3, 0x12, 0xB9, 0x56, 0xD1, 0x8F, 0xA6, 0x9C, 0xEA, 0x16, 0x24, 0xEA,
-    0x19, 0x64, 0x3A, 0xF1, 0xCB, 0x7A, 0x63, 0x23, 0x1A, 0xB1, 0xD2, 0x5F, 0xF0, 0x2E, 0x8C, 0xC7,
-    0x39, 0x0F, 0x4F, 0x37, 0x63, 0x22, 0x68, 0x3C, 0x94, 0x9C, 0x37, 0x58, 0xD7, 0xC9, 0x8A, 0xD5,
-    0x7E, 0x8A, 0x28, 0xD5, 0x38, 0xC8, 0xCE, 0x64, 0x1D, 0xD6, 0x43, 0xB4, 0x50, 0xFC, 0xCE, 0x11,
-    0x1B, 0x6A, 0x46, 0xAC, 0xE2, 0x89, 0x7A, 0xD7, 0x9B, 0x9D, 0x6D, 0x0A, 0x97, 0x87, 0x69, 0x64,
-    0xB4, 0xCA, 0xF5, 0x30, 0xE1, 0xA9, 0x96, 0xAF, 0x64, 0x2D, 0x1F, 0xCF, 0x4A, 0xD6, 0xFE, 0x3B,
-    0x0C, 0xCB, 0x54, 0x11, 0x4F, 0xFF, 0xFE, 0x22, 0xCE, 0x62, 0x5C, 0xDD, 0xAA, 0xBF, 0x0E, 0xFD,
-    0x51, 0xB2, 0x2B, 0x3E, 0x8A, 0x6D, 0xAF, 0x5A, 0xBB, 0x78, 0xBF, 0x57, 0x74, 0x82, 0x6B, 0x31,
-    0x94, 0x28, 0x06, 0x5F, 0xB7, 0xD4, 0x99, 0xC5, 0xD8, 0x9F, 0x5E, 0x0E, 0xF1, 0xE0, 0x1D, 0x3D,
-    0x74, 0xC7, 0x30, 0xA7, 0x7A, 0xF6, 0xCE, 0xC9, 0xC3, 0x77, 0x3E, 0x29, 0xBC, 0x51, 0x08, 0xDD,
-    0xC6, 0x65, 0xA9, 0x6C, 0x6B, 0xFD, 0xA7, 0x8D, 0x03, 0xC4, 0xFD, 0x78, 0x63, 0x09, 0xC2, 0xF0,
-    0x0F, 0xD7, 0xF6, 0x94, 0xA0, 0xEB, 0xB1, 0xBA, 0xF1, 0xD8, 0xC5, 0x64, 0xCE, 0xB5, 0xA9, 0x9F,
-    0x5A, 0xEF, 0x9E, 0xC4, 0x19, 0x59, 0xB9, 0xFA, 0x97, 0x74, 0x3A, 0x3A, 0xCC, 0xE5, 0x4C, 0x2F,
-    0x83, 0xEA, 0x9D, 0xCA, 0x9F, 0x5C, 0xDD, 0x3D, 0xBF, 0x73, 0x21, 0xF7, 0xB0, 0x75, 0x85, 0x7C,
-    0xC9, 0xE8, 0x4C, 0xAA, 0x6C, 0x7A, 0xBA, 0x36, 0xD9, 0xD7, 0xBD, 0xD3, 0xFA, 0xA1, 0xA6, 0xCB,
-    0xCE, 0xD1, 0x05, 0x61, 0x60, 0x92, 0xC2, 0x9E, 0x48, 0x6A, 0x5A, 0x53, 0x98, 0xCD, 0x81, 0x22,
-    0xEB, 0x7A, 0x58, 0x4D, 0x5F, 0x1E, 0x5F, 0x08, 0x6A, 0x4E, 0x57, 0x34, 0x64, 0xE4, 0xEC, 0xC6,
-    0xF3, 0x85, 0x81, 0x76, 0xB6, 0x7A, 0x2E, 0x52, 0x7F, 0xF4, 0xBB, 0x6F, 0x6A, 0x7B, 0xE0, 0xB1,
-    0x28, 0x71, 0xE0, 0x3A, 0x01, 0x49, 0xB0, 0xAF, 0x36, 0xDA, 0x7B, 0x2A, 0x22, 0x46, 0x8D, 0x11,
-    0x9C, 0x51, 0x1B, 0x7A, 0x06, 0x5B, 0x3D, 0x89, 0x46, 0xCB, 0x62, 0xF3, 0xFF, 0x32, 0x6A, 0x25,
-    0x2C, 0xF5, 0xB8, 0xB0, 0xE9, 0x3B, 0x2A, 0x2B, 0x6B, 0x93, 0x99, 0xA3, 0x89, 0xB8, 0x51, 0x61,
-    0x3E, 0x8A, 0x12, 0xC8, 0x9B, 0xE8, 0x29, 0xE0, 0x7C, 0xD2, 0xEE, 0x52, 0xB2, 0x3E, 0xD7, 0xA1,
-    0xEB, 0x1A, 0xD1, 0x3E, 0xAC, 0x02, 0x18, 0x14, 0xEF, 0xB2, 0xEC, 0x02, 0x2F, 0x26, 0xC0, 0x0B,
-    0xD4, 0x50, 0xBE, 0x56, 0x7C, 0xD1, 0x99, 0xB4, 0x06, 0x92, 0x81, 0x05, 0xAF, 0x1E, 0x3A, 0x51,
-    0xBC, 0x6F, 0x32, 0x5C, 0x0B, 0xF7, 0x1B, 0x17, 0x93, 0x30, 0x44, 0x6B, 0xA2, 0xB2, 0x3C, 0x55,
-    0x69, 0xFE, 0xC8, 0xFB, 0xAB, 0x4F, 0xD4, 0x20, 0x68, 0xA4, 0x18, 0xCC, 0x0F, 0x56, 0xFF, 0xFA,
-    0x02, 0x37, 0x17, 0xCC, 0x19, 0x9C, 0x5E, 0xDA, 0xAA, 0xB5, 0xA7, 0x88, 0x48, 0x59, 0xEC, 0x47,
-    0x3A, 0xCC, 0x7A, 0x91, 0x99, 0x65, 0xB8, 0x91, 0x81, 0x46, 0x9E, 0xAF, 0xC1, 0xE0, 0xA2, 0x9E,
-    0xAE, 0x71, 0xE5, 0x24, 0xFC, 0x6A, 0x4B, 0xF8, 0x15, 0xA6, 0x55, 0xE2, 0x8C, 0x6E, 0x72, 0x8F,
-    0xFB, 0x8C, 0x7C, 0x1B, 0x1D, 0xC7, 0xC0, 0x2E, 0xF2, 0x8A, 0x8C, 0xFA, 0xCE, 0xFD, 0xE1, 0x57,
-    0xE7, 0x76, 0xE0, 0x57, 0xCB, 0xFE, 0x1B, 0x25, 0x22, 0xDF, 0x31, 0x69, 0x90, 0x1D, 0x3F, 0x39,
-    0xB2, 0x33, 0x74, 0xD9, 0x10, 0x4C, 0xB5, 0x1B, 0x0B, 0x76, 0x81, 0x9C, 0x1D, 0x8C, 0x54, 0x34,
-    0x5D, 0xFD, 0x5F, 0xBB, 0xB9, 0xA6, 0xA5, 0x2B, 0x5A, 0x7D, 0xF8, 0xED, 0xA4, 0x47, 0x2F, 0x96,
-    0xA4, 0x83, 0x91, 0x9A, 0xAE, 0x20, 0x0D, 0xF3, 0x16, 0x6E, 0x78, 0xD9, 0x68, 0xEC, 0x68, 0x74,
-    0x7D, 0xB8, 0x34, 0xFE, 0x98, 0xF4, 0x86, 0x34, 0xCD, 0x5B, 0xE0, 0x60, 0x93, 0x01, 0xF6, 0x5F,
-    0xA0, 0xC1, 0xF2, 0xBD, 0xA9, 0x00, 0x4F, 0x9B, 0x6E, 0xE1, 0x0D, 0x41, 0x1F, 0xA2, 0x6B, 0x3D,
-    0xBA, 0x47, 0x9D, 0x9A, 0x31, 0x2E, 0xE7, 0x61, 0x43, 0x90, 0x05, 0x6F, 0xD6, 0x05, 0xEB, 0xC1,
-    0x48, 0x39, 0x9E, 0xB9, 0xB7, 0xA0, 0xA7, 0x9E, 0x61, 0x07, 0x29, 0xF9, 0x7F, 0x10, 0x43, 0xE0,
-    0x96, 0xBE, 0x6A, 0xD1, 0x8D, 0x4B, 0x9E, 0x1D, 0xD6, 0x8B, 0xA3, 0x3E, 0x91, 0x62, 0x68, 0x34,
-    0xBD, 0x7C, 0xF2, 0xB8, 0x99, 0x4F, 0x09, 0xFD, 0xA2, 0x56, 0x84, 0x0B, 0xCF, 0x35, 0xE5, 0x25,
-    0x6E, 0xC5, 0x71, 0x3B, 0x21, 0xDE, 0x3F, 0x66, 0x12, 0x33, 0xC5, 0x3A, 0x19, 0xAB, 0xC3, 0xD4,
-    0x70, 0xCE, 0x9F, 0x1F, 0xBD, 0xCD, 0xDC, 0xCB, 0xEE, 0xC1, 0xFB, 0xF5, 0x40, 0xF9, 0xFF, 0x31,
-    0xF8, 0xF7, 0x1F, 0x83, 0xBF, 0xED, 0x88, 0xBE, 0x75, 0xFD, 0xE8, 0xDC, 0x83, 0x90, 0xBB, 0xBB,
-    0x3F, 0xB1, 0x3F, 0x1B, 0xA1, 0x77, 0xF9, 0x3B, 0xB6, 0xF9, 0xA0, 0x3A, 0x18, 0xC9, 0x9C, 0x3B,
-    0xFE, 0xD9, 0x5D, 0x63, 0x98, 0x7E, 0x8C, 0xA9, 0x6A, 0xB3, 0x55, 0x38, 0x58, 0x4B, 0x77, 0xC2,
-    0x24, 0x0B, 0x54, 0x82, 0x0B, 0xB3, 0x2E, 0x9E, 0xD1, 0x75, 0x5C, 0x1D, 0x7C, 0x25, 0xAB, 0xD6,
-    0x0D, 0x69, 0xC1, 0xB8, 0x21, 0xFB, 0xDB, 0x59, 0x30, 0x44, 0x9B, 0x93, 0x05, 0xAD, 0x72, 0xFD,
-    0x3C, 0xFF, 0x25, 0x77, 0xD7, 0x78, 0x6D, 0xC8, 0x19, 0x14, 0x4B, 0xC9, 0x3A, 0x1E, 0x5F, 0x1A,
-    0x27, 0x98, 0xBB, 0x26, 0x02, 0x63, 0x2C, 0xCC, 0x14, 0x2D, 0xFC, 0xD2, 0x16, 0xDA, 0x10, 0xA0,
-    0x72, 0xFF, 0x44, 0x7B, 0x4A, 0x3D, 0xE7, 0x0F, 0xD6, 0xDA, 0x13, 0xDB, 0xE9, 0x00, 0xCE, 0x12,
-    0xCA, 0x4B, 0xFE, 0xA2, 0x50, 0xF0, 0x8C, 0xC3, 0xBB, 0xEF, 0x3D, 0x89, 0x50, 0x13, 0xBE, 0xFB,
-    0xC2, 0xCD, 0xD6, 0x45, 0x71, 0x7D, 0x2B, 0x61, 0x7D, 0x00, 0x97, 0x03, 0x7C, 0x7B, 0x87, 0xD5,
-    0xAB, 0x2C, 0xE2, 0x7E, 0x73, 0xAA, 0x5E, 0x3D, 0x6F, 0x45, 0xFF, 0xF2, 0xAA, 0x98, 0x1B, 0x22,
-    0x61, 0x63, 0xEC, 0xE4, 0x3B, 0x87, 0x25, 0x35, 0xF3, 0x6D, 0x00, 0x97, 0x75, 0xA1, 0x69, 0xD8,
-    0xF5, 0xF2, 0xA2, 0x2C, 0xB2, 0x9D, 0x63, 0x19, 0xAF, 0xDA, 0xC6, 0xD6, 0x70, 0x7A, 0x3B, 0x57,
-    0xE3, 0x2A, 0xC9, 0x54, 0xA5, 0x2B, 0xA1, 0xE5, 0xEA, 0xF3, 0x9A, 0xF1, 0xDF, 0x4B, 0x3D, 0xF6,
-    0xA5, 0x80, 0xBC, 0x2D, 0xF5, 0xA4, 0xF2, 0x4E, 0x09, 0x77, 0x93, 0x31, 0x30, 0xAE, 0xB3, 0x65,
-    0x6D, 0x40, 0xC8, 0x63, 0x00, 0x22, 0x5E, 0x63, 0x1A, 0x6D, 0x09, 0x41, 0x93, 0x09, 0xCB, 0x2C,
-    0xBF, 0x68, 0x41, 0xE2, 0x6C, 0xF6, 0x3D, 0x0D, 0x7A, 0xD6, 0x9C, 0x18, 0xAD, 0xE2, 0x08, 0xC5,
-    0xB1, 0x57, 0x36, 0x37, 0xB3, 0x43, 0xA0, 0xD6, 0x85, 0x06, 0x75, 0xC2, 0xC5, 0x75, 0x42, 0x17,
-    0x3F, 0xC0, 0x05, 0xF1, 0x2C, 0x31, 0x10, 0x77, 0x5C, 0x4D, 0x20, 0x8E, 0x57, 0x68, 0x31, 0xDD,
-    0x94, 0xE6, 0xA6, 0xEF, 0xFA, 0xAA, 0x4E, 0x80, 0x93, 0x29, 0x66, 0xE0, 0x1F, 0x1E, 0x16, 0x27,
-    0xEC, 0x25, 0x6D, 0x76, 0x94, 0x68, 0xB3, 0xA3, 0x46, 0x57, 0x1D, 0x31, 0x79, 0x13, 0x98, 0x6C,
-    0xEE, 0x25, 0x64, 0xB1, 0x9B, 0xB9, 0xD9, 0xD1, 0x68, 0x47, 0x49, 0xB2, 0x38, 0xC2, 0xC1, 0xDE,
-    0x5C, 0xB3, 0xA3, 0x68, 0x6E, 0x76, 0x64, 0x85, 0x11, 0xCF, 0x06, 0xD6, 0xEC, 0xA8, 0xD7, 0x66,
-    0x47, 0x7D, 0xDC, 0x18, 0xEC, 0x6D, 0x6A, 0x76, 0xB4, 0x39, 0xD5, 0xEC, 0xC8, 0x8A, 0x47, 0xB3,
-    0xAD, 0xD9, 0x59, 0x79, 0xEF, 0x60, 0x6F, 0xED, 0x49, 0xD8, 0xDB, 0x34, 0x52, 0x6B, 0x4E, 0x21,
-    0x24, 0x3E, 0x66, 0x11, 0x1E, 0x2B, 0xF0, 0x4A, 0x67, 0xC7, 0x61, 0x09, 0xCA, 0x54, 0x77, 0x89,
-    0xF1, 0x31, 0xF4, 0x22, 0xEA, 0xDD, 0x49, 0xCA, 0x41, 0x67, 0x85, 0xF3, 0x61, 0x6F, 0xA6, 0x63,
-    0xE4, 0x1E, 0xC2, 0xCE, 0x85, 0x24, 0x8A, 0xB3, 0xDB, 0x62, 0xFE, 0x5D, 0xE4, 0x59, 0xB0, 0x8A,
-    0xF4, 0x34, 0x5D, 0xB9, 0xC8, 0x46, 0x09, 0xCF, 0x3A, 0xF3, 0xF5, 0x63, 0x66, 0xE1, 0x2D, 0xA6,
-    0x51, 0xFD, 0xAD, 0x26, 0xC8, 0xF4, 0xE6, 0x9B, 0x62, 0x3C, 0x4B, 0x2D, 0x7E, 0x38, 0xBD, 0xFA,
-    0xA9, 0x27, 0x94, 0xB4, 0x2B, 0xEA, 0xF7, 0xBC, 0xA5, 0xDE, 0xC8, 0xDB, 0x5C, 0x81, 0xA0, 0x4A,
-    0xD2, 0x8F, 0xA6, 0x57, 0x3F, 0x57, 0x6D, 0xA8, 0x5C, 0x48, 0xEE, 0xC1, 0x85, 0xB9, 0x9D, 0xFF,
-    0x31, 0x9D, 0x2F, 0x16, 0xD0, 0x46, 0x84, 0x6D, 0x9F, 0x6A, 0xE7, 0xDF, 0xD8, 0x65, 0x2D, 0xB4,
-    0x8F, 0xD6, 0xA2, 0x31, 0xE3, 0xA9, 0x9D, 0x7F, 0x7A, 0x8F, 0x76, 0xFE, 0xE8, 0x96, 0x30, 0xB5,
-    0xF3, 0xFF, 0x28, 0x69, 0xAB, 0x47, 0x7F, 0x69, 0x2D, 0x98, 0xD2, 0xB6, 0xFC, 0x48, 0x69, 0xFB,
-    0x81, 0x08, 0xF7, 0xFA, 0xE1, 0x13, 0x38, 0x07, 0x61, 0x5C, 0xE7, 0x6F, 0xDD, 0x78, 0xE9, 0xA7,
-    0x23, 0xDC, 0x27, 0x60, 0xF9, 0x7E, 0xDC, 0x24, 0xFE, 0xB0, 0x97, 0xEF, 0xFF, 0x3B, 0x17, 0xDE,
-    0xBF, 0x7D, 0x59, 0x2E, 0xED, 0xCB, 0x40, 0xED, 0xCB, 0x92, 0x8D, 0x86, 0xD0, 0x22, 0x9E, 0xD6,
-    0xC3, 0xC5, 0x65, 0x05, 0xED, 0x04, 0xBE, 0x3A, 0x71, 0xA5, 0xA1, 0xE5, 0x3B, 0xFF, 0x23, 0x5D,
-    0x9C, 0xA3, 0x73, 0xAA, 0xC1, 0x8A, 0xD0, 0xF3, 0xF3, 0xA4, 0xE8, 0x6C, 0x5F, 0xF6, 0x8C, 0x14,
-    0x8A, 0xDC, 0x5C, 0xA9, 0xF7, 0x78, 0x53, 0xCF, 0xB4, 0xB9, 0x3E, 0x79, 0x8F, 0xEF, 0xDF, 0xBE,
-    0x5C, 0x7D, 0x4C, 0x07, 0xBC, 0xD7, 0x1A, 0x5A, 0xB6, 0xE8, 0xDF, 0xE1, 0xE1, 0xD5, 0xD3, 0x94,
-    0x95, 0x21, 0x8C, 0x15, 0xCE, 0xA4, 0x10, 0x75, 0x1A, 0x6B, 0x18, 0x8D, 0xF9, 0x3C, 0x0B, 0xB7,
-    0xB1, 0xA1, 0x3A, 0xAC, 0x37, 0xAC, 0xE9, 0x03, 0xD5, 0x9F, 0xB7, 0xF4, 0xA6, 0x3D, 0x2D, 0x42,
-    0x6D, 0x9D, 0x10, 0xE9, 0x70, 0x99, 0x88, 0xC9, 0xDA, 0x4B, 0x4A, 0xD9, 0x7D, 0x65, 0x08, 0xE1,
-    0x04, 0xC9, 0x8F, 0xD4, 0x1A, 0xFC, 0x89, 0x9E, 0x4C, 0xA3, 0x58, 0xB1, 0x70, 0x5C, 0x06, 0x9E,
-    0x0C, 0x0D, 0x61, 0x9E, 0x97, 0x65, 0x51, 0x35, 0x9C, 0x54, 0x9A, 0xB1, 0xA8, 0xBF, 0xA8, 0x45,
-    0x13, 0x8B, 0x33, 0x4B, 0x77, 0x71, 0xBE, 0x7B, 0x87, 0x87, 0xBB, 0xCB, 0xDA, 0xE3, 0x61, 0xAC,
-    0xE8, 0x77, 0x55, 0xF3, 0x34, 0x6A, 0xD6, 0xE8, 0x6A, 0x41, 0x41, 0xAC, 0x05, 0x06, 0x88, 0x4B,
-    0x03, 0xD9, 0xDD, 0x6A, 0x93, 0x25, 0xDD, 0x6B, 0x30, 0xBC, 0x71, 0x6E, 0x62, 0x41, 0x6B, 0x21,
-    0x53, 0xBA, 0x9F, 0x71, 0xC0, 0x46, 0xFE, 0x9B, 0xBA, 0x86, 0xFE, 0x50, 0x4D, 0xD9, 0x3F, 0xD2,
-    0xD2, 0xB6, 0xB7, 0x75, 0x64, 0xE6, 0xC9, 0xAE, 0x97, 0x19, 0x18, 0x6B, 0xB4, 0x64, 0x87, 0x62,
-    0xE7, 0xCB, 0x2C, 0x95, 0x65, 0x34, 0xB9, 0x1E, 0x1F, 0xD2, 0x96, 0xAC, 0xB9, 0xDA, 0xCB, 0x99,
-    0xEB, 0x7B, 0x78, 0x49, 0xCB, 0x3B, 0xCA, 0xAF, 0x69, 0x51, 0xF4, 0xD7, 0xAC, 0xE8, 0x75, 0xA3,
-    0x71, 0x97, 0x07, 0x3F, 0xA3, 0x2C, 0xCE, 0x34, 0xE1, 0xCE, 0x43, 0xD5, 0xB0, 0x47, 0x15, 0x0E,
-    0xA5, 0x08, 0xF9, 0x33, 0x66, 0xFD, 0x19, 0xE4, 0xBB, 0xF7, 0x6B, 0x8F, 0xF2, 0xEC, 0xE4, 0x21,
-    0xD2, 0x7E, 0x75, 0xC4, 0x81, 0xEB, 0x51, 0x2C, 0x32, 0x56, 0xBA, 0x56, 0x07, 0xFE, 0x29, 0x15,
-    0xF6, 0x19, 0x61, 0xBF, 0xF7, 0xA5, 0xE7, 0x59, 0x45, 0x57, 0x3F, 0xA6, 0xFE, 0x35, 0x4D, 0xEE,
-    0x90, 0x79, 0x54, 0x61, 0xDB, 0x65, 0xDD, 0x17, 0xFD, 0x59, 0xFA, 0xFB, 0x33, 0xB6, 0x0A, 0xE2,
-    0x26, 0xD5, 0x22, 0x80, 0x5C, 0xD3, 0xA2, 0xBC, 0x51, 0xD5, 0x9C, 0x52, 0x36, 0xAE, 0xAE, 0xFD,
-    0xA7, 0xAB, 0x16, 0x51, 0xF0, 0xE3, 0x0E, 0xA6, 0xC3, 0x4E, 0xF6, 0x8B, 0xD6, 0x3B, 0x5D, 0x08,
-    0xC7, 0xEB, 0x0F, 0x9F, 0x51, 0x2D, 0x72, 0xF5, 0x03, 0x77, 0xDA, 0x3C, 0xA3, 0x5A, 0x84, 0x49,
-    0xB7, 0xA8, 0x67, 0x8F, 0x58, 0xBC, 0xF8, 0xDE, 0x9E, 0xCF, 0x7D, 0x0B, 0x4A, 0xE0, 0xEF, 0x74,
-    0x3C, 0x6F, 0x10, 0xD8, 0x6F, 0x74, 0xF4, 0x89, 0xFB, 0x0B, 0x3B, 0x05, 0x25, 0x8B, 0x8E, 0x9A,
-    0x73, 0x5B, 0xCD, 0xB3, 0x0B, 0x4A, 0x3E, 0xFC, 0x0E, 0x90, 0x1F, 0x57, 0x87, 0xD1, 0x68, 0x87,
-    0x15, 0x0E, 0x45, 0xBF, 0xBF, 0x73, 0xFB, 0xEA, 0x0E, 0x18, 0xE6, 0x37, 0xE6, 0xC4, 0xED, 0x07,
-    0xE9, 0xAF, 0x79, 0xA2, 0x3D, 0xE9, 0xDC, 0x5A, 0xF3, 0xAC, 0x1E, 0xFE, 0x89, 0x36, 0xB9, 0x6D,
-    0x76, 0xE0, 0x2E, 0x4C, 0x75, 0xA9, 0xA8, 0xC1, 0xE7, 0xDD, 0x71, 0x65, 0x50, 0xB4, 0x6D, 0xBE,
-    0x50, 0x4C, 0xB0, 0x8F, 0x83, 0xA9, 0x35, 0x46, 0x3D, 0x3D, 0x8D, 0x13, 0xE8, 0xEA, 0x39, 0xEF,
-    0x3D, 0xBF, 0x68, 0x39, 0x4C, 0xF1, 0x04, 0x7D, 0x52, 0xF8, 0x43, 0xDE, 0x4D, 0x79, 0x22, 0xE7,
-    0xA8, 0xCF, 0x31, 0x05, 0x6B, 0x2A, 0x3D, 0x81, 0xE7, 0x06, 0x37, 0x7F, 0x0D, 0xB5, 0x4D, 0x25,
-    0x90, 0x5A, 0x03, 0xB9, 0xBD, 0xEA, 0x8A, 0x20, 0x11, 0x55, 0xD3, 0x2A, 0xC8, 0xE1, 0xE6, 0xE8,
-    0x59, 0x6C, 0x41, 0x96, 0x91, 0x05, 0x17, 0x10, 0x3E, 0x35, 0xD8, 0x71, 0xD2, 0x59, 0x78, 0x01,
-    0x89, 0x3F, 0x2B, 0x85, 0x4C, 0xFA, 0xD8, 0x4A, 0x20, 0xB5, 0xB1, 0x94, 0x22, 0xAB, 0x34, 0xC4,
-    0x80, 0x27, 0x57, 0x0E, 0x99, 0xB5, 0x2E, 0xC8, 0x30, 0x39, 0x13, 0x62, 0xB2, 0x9A, 0x3F, 0x91,
-    0x6E, 0x2D, 0xCE, 0x20, 0x0C, 0xB5, 0x40, 0x83, 0x5C, 0xED, 0x00, 0xC1, 0x0F, 0x9E, 0xD1, 0xD7,
-    0x38, 0x3E, 0x41, 0x0A, 0x17, 0x06, 0x6C, 0xDF, 0x95, 0x1E, 0x2F, 0xDA, 0xFA, 0x7A, 0xCA, 0x28,
-    0xE7, 0xE8, 0x1A, 0x31, 0x55, 0x9C, 0x1D, 0x5B, 0x78, 0xB2, 0x3F, 0x07, 0x7B, 0x76, 0x7A, 0x31,
-    0x4C, 0x69, 0x14, 0xE0, 0xFB, 0xA3, 0x1E, 0xA3, 0x58, 0x17, 0x5B, 0x44, 0xF8, 0xCA, 0xE7, 0x37,
-    0xAC, 0x3D, 0xFA, 0xCD, 0x0D, 0x4F, 0x33, 0xF9, 0x16, 0xBF, 0x2B, 0x1F, 0x63, 0x13, 0xCC, 0x11,
-    0xE1, 0x8D, 0x3E, 0xD8, 0x86, 0x9B, 0x87, 0xC2, 0xE1, 0xA8, 0x0F, 0xD8, 0x1A, 0xBA, 0xF2, 0xC6,
-    0x96, 0x11, 0xEC, 0xBD, 0x4F, 0x7B, 0x47, 0x5B, 0x83, 0x31, 0x3D, 0x72, 0x06, 0x5E, 0xED, 0xF7,
-    0xAD, 0xC9, 0x4D, 0xBF, 0xAC, 0x7A, 0x5C, 0x28, 0xCA, 0x8F, 0xA6, 0x13, 0xAE, 0xEE, 0xD4, 0xEB,
-    0x3B, 0x3B, 0x35, 0xDA, 0xD9, 0xA9, 0x8F, 0xD4, 0x54, 0x53, 0x18, 0xFC, 0x7A, 0x2A, 0x47, 0xF8,
-    0x34, 0x55, 0x8B, 0x57, 0xEF, 0x55, 0x2D, 0x5E, 0x59, 0xB5, 0x78, 0xB3, 0x0B, 0x3F, 0x73, 0xAD,
-    0x50, 0xE3, 0xDD, 0x6A, 0xF1, 0x47, 0x4C, 0x22, 0xE5, 0x86, 0xEE, 0x49, 0xD7, 0xA7, 0xEA, 0x34,
-    0x3E, 0xE6, 0x6A, 0xF1, 0x63, 0x56, 0x8B, 0x6F, 0x17, 0x4B, 0x6A, 0x7F, 0x81, 0x64, 0xA5, 0x53,
-    0xF1, 0x43, 0x46, 0x42, 0xD4, 0x3F, 0xD6, 0x79, 0x3E, 0xF4, 0x31, 0x70, 0x31, 0xB1, 0x13, 0x86,
-    0x1D, 0x70, 0xE1, 0x14, 0x17, 0xC3, 0x0F, 0x91, 0x8B, 0x85, 0x71, 0xB1, 0xF8, 0x29, 0xB9, 0xE0,
-    0x13, 0xA7, 0xEA, 0x6B, 0xAB, 0xF1, 0xFF, 0x87, 0x9A, 0xFD, 0xFF, 0x0B, 0xED, 0x9C, 0x31, 0x90,
-    0xDB, 0xD6, 0x11, 0x86, 0x17, 0xE4, 0xE9, 0x10, 0x1D, 0xC7, 0xC2, 0x15, 0x72, 0x61, 0x5D, 0x2C,
-    0xA4, 0x50, 0xE1, 0xF1, 0x58, 0x87, 0x56, 0x85, 0x4E, 0x40, 0x9C, 0xC2, 0xA5, 0xAF, 0x50, 0x97,
-    0xC2, 0x8D, 0x2A, 0x17, 0xB9, 0x46, 0x85, 0x0B, 0xD9, 0xE4, 0x28, 0x45, 0x8A, 0x14, 0xB9, 0x26,
-    0x49, 0x99, 0x2B, 0x54, 0x48, 0x2A, 0xE2, 0x14, 0xCA, 0x8C, 0x0A, 0x49, 0x44, 0x26, 0x45, 0x8A,
-    0x34, 0xAC, 0x52, 0xC3, 0x33, 0x71, 0x92, 0x2E, 0x2C, 0xE0, 0x19, 0xCA, 0x26, 0xF9, 0xB2, 0xFB,
-    0xEF, 0x2E, 0x08, 0x48, 0x1A, 0x8F, 0x2B, 0xE9, 0x78, 0x0C, 0xE7, 0x84, 0x27, 0x1E, 0x41, 0x60,
-    0xDF, 0xFB, 0xDE, 0xEE, 0xDB, 0xDD, 0xB7, 0x38, 0x22, 0xA2, 0xC1, 0x84, 0xE4, 0x95, 0x56, 0x68,
-    0x72, 0x6D, 0x86, 0x53, 0x34, 0xDF, 0xA1, 0xE9, 0xFD, 0x1B, 0x4D, 0xFF, 0x6F, 0xB5, 0x34, 0xC9,
-    0x2F, 0xD1, 0xA4, 0xFD, 0x99, 0x34, 0x07, 0xFD, 0xB9, 0x34, 0x4F, 0x7A, 0x68, 0x6A, 0x34, 0xBD,
-    0x2A, 0x5A, 0x70, 0x13, 0x97, 0x68, 0x92, 0x11, 0x2D, 0xE5, 0x7C, 0x42, 0x93, 0x87, 0x10, 0xB8,
-    0x19, 0xA3, 0x89, 0xF8, 0x4A, 0x63, 0xBE, 0x30, 0xDF, 0x73, 0x58, 0xF0, 0xF9, 0x68, 0x92, 0x82,
-    0xCF, 0x1A, 0x51, 0x26, 0x27, 0x97, 0x74, 0x43, 0x1B, 0xF9, 0xEA, 0xB0, 0xDC, 0x0B, 0x27, 0xB4,
-    0x17, 0x9E, 0xE7, 0xA1, 0xE6, 0xEB, 0x2C, 0xA8, 0x79, 0xDD, 0xC2, 0x31, 0xD2, 0xDF, 0xF4, 0x96,
-    0xDA, 0xE8, 0xBB, 0x68, 0x4E, 0xAD, 0xD7, 0xB9, 0x43, 0xF9, 0x55, 0x58, 0xDE, 0xE1, 0x6E, 0x7F,
-    0x73, 0x34, 0x93, 0x1B, 0xC5, 0x2C, 0x43, 0x20, 0x3E, 0xB2, 0xE8, 0x83, 0x29, 0xF5, 0x6B, 0x4A,
-    0xA6, 0xF2, 0x9F, 0xA4, 0xC2, 0xCF, 0x84, 0xB2, 0x09, 0xA5, 0xA5, 0xC8, 0x90, 0xE1, 0x28, 0x3F,
-    0x23, 0x1A, 0x8E, 0x44, 0xD4, 0x71, 0x21, 0xC7, 0x20, 0x62, 0xF7, 0x02, 0x2E, 0x36, 0x16, 0x69,
-    0xDF, 0xE5, 0x63, 0x56, 0x3D, 0x1E, 0x7F, 0x44, 0x49, 0xA8, 0x86, 0x7C, 0xF1, 0x50, 0xE4, 0x7C,
-    0x97, 0x9B, 0x74, 0x4E, 0xE4, 0x2A, 0x30, 0x88, 0x18, 0xF4, 0xAC, 0x5A, 0x1D, 0x93, 0xB2, 0x2D,
-    0x28, 0x6D, 0x6B, 0x2F, 0xD2, 0x80, 0x5F, 0x5F, 0x8D, 0x15, 0x92, 0x35, 0x7A, 0xAE, 0xDC, 0x92,
-    0x74, 0xF4, 0xA4, 0xD1, 0xEF, 0xF7, 0x46, 0xED, 0xAB, 0xAC, 0x31, 0xDB, 0xE8, 0x01, 0x04, 0x42,
-    0xFF, 0xF7, 0xD1, 0x8F, 0xAD, 0x3E, 0x7A, 0x33, 0x90, 0xDF, 0x44, 0x63, 0x19, 0xC6, 0xFE, 0x3F,
-    0x57, 0x3D, 0xEF, 0x8F, 0x4E, 0x15, 0x66, 0x7D, 0xDD, 0xD7, 0xA6, 0x5F, 0x1B, 0x0E, 0x48, 0x1A,
-    0xCF, 0xF7, 0x95, 0xCA, 0xE2, 0x8A, 0xF2, 0x18, 0xEA, 0x4C, 0xAD, 0x13, 0x74, 0x61, 0x30, 0xEA,
-    0x77, 0xA7, 0xC2, 0x0B, 0x30, 0x9D, 0xA6, 0xE3, 0x74, 0x9E, 0x06, 0xD4, 0x89, 0x3A, 0x52, 0x67,
-    0xEA, 0x50, 0x9D, 0xAA, 0x63, 0x35, 0xAE, 0x0E, 0xD6, 0xC9, 0x3A, 0x5A, 0x67, 0xEB, 0x70, 0x8D,
-    0xAE, 0xE3, 0x75, 0xBE, 0x0E, 0xD8, 0x09, 0x3B, 0x62, 0x67, 0x6C, 0x90, 0xC9, 0x28, 0x53, 0x47,
-    0x85, 0x6F, 0xE2, 0xFE, 0x90, 0x2E, 0xE6, 0xCB, 0xF5, 0xE7, 0xA9, 0x5C, 0x68, 0xF1, 0x9E, 0x7C,
-    0x15, 0x63, 0x33, 0x97, 0x91, 0xE9, 0x4F, 0x84, 0x7F, 0x44, 0x54, 0x9C, 0x2A, 0xCE, 0xD1, 0x89,
-    0xCA, 0xA2, 0x83, 0x4B, 0x07, 0xC6, 0x28, 0xC6, 0xA0, 0x6E, 0xA7, 0x8B, 0x16, 0x62, 0x23, 0xFC,
-    0x6A, 0xC0, 0xEB, 0xAB, 0xAA, 0x87, 0x90, 0x71, 0xDE, 0xEA, 0x7E, 0x0A, 0x69, 0xB6, 0x3F, 0x46,
-    0xE7, 0x4F, 0x3F, 0x42, 0x79, 0xBD, 0x6D, 0x6D, 0x30, 0x34, 0x1F, 0x9A, 0x72, 0xF5, 0x4C, 0xE9,
-    0xB2, 0x91, 0xAA, 0xEE, 0x75, 0x53, 0xDD, 0xDD, 0xFF, 0xAB, 0x6E, 0xF3, 0x1A, 0xA3, 0x77, 0xBF,
-    0x43, 0x9F, 0x22, 0x1C, 0xF7, 0x4A, 0x51, 0x63, 0x99, 0x0C, 0xC9, 0xE2, 0xE2, 0x9A, 0xCC, 0x81,
-    0x88, 0xB6, 0x14, 0xCD, 0xBB, 0x98, 0x07, 0xCB, 0x27, 0xF2, 0xBB, 0xAF, 0x42, 0x8D, 0x45, 0xF5,
-    0x52, 0x7B, 0x59, 0x55, 0xDD, 0xA6, 0x4D, 0xD0, 0x6D, 0xF2, 0x79, 0x7B, 0x41, 0x3E, 0x15, 0x42,
-    0xF4, 0x4D, 0x60, 0xA9, 0xA2, 0xD2, 0xA7, 0xB2, 0x48, 0x0D, 0xC1, 0x92, 0xB5, 0xD1, 0xF6, 0x9E,
-    0x2E, 0xCB, 0x03, 0xC5, 0x98, 0xA9, 0xA7, 0x35, 0xCE, 0x81, 0x71, 0x06, 0x8C, 0xF1, 0x04, 0x18,
-    0x3B, 0xB2, 0x6F, 0x96, 0xA7, 0xAC, 0x63, 0x14, 0x2F, 0xD4, 0x09, 0x45, 0x47, 0xB3, 0x02, 0xE3,
-    0x53, 0x9E, 0x56, 0xB2, 0xD1, 0x31, 0x44, 0xD6, 0xA1, 0xC7, 0x90, 0x27, 0xF8, 0x7F, 0x3C, 0xED,
-    0x6A, 0xA3, 0xBD, 0x37, 0x87, 0xFB, 0x86, 0xFE, 0x12, 0x67, 0x46, 0x65, 0x21, 0xAB, 0x79, 0x34,
-    0xED, 0x81, 0xED, 0xF2, 0x4B, 0x9C, 0x32, 0x54, 0x3F, 0x3B, 0x9D, 0xD1, 0xD9, 0xD2, 0xEC, 0xDE,
-    0x3D, 0xF4, 0x00, 0x32, 0xA7, 0x20, 0x29, 0xEA, 0x4D, 0xC7, 0x87, 0xE2, 0x96, 0x4E, 0x49, 0xC4,
-    0x7E, 0xF6, 0xF3, 0x0A, 0xB7, 0x95, 0x71, 0x48, 0x74, 0xB6, 0x14, 0xA7, 0xCD, 0xCD, 0xCE, 0xB4,
-    0xD1, 0x15, 0x18, 0xE3, 0xD0, 0x2C, 0x43, 0x51, 0x79, 0xB8, 0x39, 0x3C, 0x2F, 0x15, 0xAB, 0x59,
-    0xAD, 0x91, 0x12, 0x10, 0xD2, 0xF1, 0x4F, 0xD6, 0x8B, 0xA7, 0x1B, 0x20, 0x15, 0xAF, 0xFF, 0x89,
-    0x0A, 0x38, 0xD0, 0xE6, 0xA8, 0xA3, 0xAD, 0xA3, 0xCD, 0xA1, 0x1B, 0x3D, 0x83, 0x5C, 0x5F, 0x8E,
-    0x56, 0x11, 0xEF, 0x1E, 0x86, 0xE4, 0x29, 0x18, 0x9F, 0xAC, 0x17, 0x63, 0xF3, 0xB5, 0xB2, 0x8E,
-    0xAF, 0x55, 0x8D, 0x5F, 0xF6, 0xB5, 0xA2, 0x92, 0x36, 0xC8, 0x22, 0xAB, 0x21, 0xAB, 0x06, 0x72,
-    0xD2, 0xF2, 0x17, 0x7C, 0xFC, 0xF3, 0x58, 0x04, 0x98, 0x0C, 0x56, 0xBE, 0xD6, 0x31, 0xAD, 0x15,
-    0x69, 0xE6, 0xF7, 0x27, 0xB0, 0x55, 0x83, 0xBC, 0xF8, 0xA4, 0xD4, 0x40, 0x04, 0x72, 0x66, 0xD6,
-    0xE7, 0x82, 0xCE, 0x96, 0x93, 0x65, 0xAF, 0x47, 0x2D, 0xE7, 0x98, 0xFA, 0x8B, 0xF6, 0xBB, 0x08,
-    0x32, 0xF7, 0x30, 0x38, 0x51, 0x85, 0xB9, 0xFD, 0x1C, 0x43, 0xA3, 0x23, 0x93, 0xCD, 0x4F, 0xAD,
-    0x69, 0x4E, 0x15, 0x8B, 0xAA, 0xA1, 0x1E, 0xA1, 0xAE, 0x97, 0x75, 0xEE, 0xF2, 0x38, 0x86, 0x11,
-    0x3B, 0x8C, 0x68, 0x68, 0x5C, 0x22, 0xB0, 0xE4, 0x33, 0xE4, 0x6B, 0x32, 0x98, 0x84, 0x11, 0x96,
-    0x77, 0x41, 0xBF, 0xB3, 0xEC, 0x38, 0xA4, 0xD6, 0xCC, 0x3B, 0x23, 0x17, 0x82, 0x9C, 0x14, 0x07,
-    0x0C, 0xF1, 0xC0, 0x9C, 0xB7, 0x6E, 0xA3, 0xB3, 0x24, 0xD5, 0xA9, 0x93, 0x95, 0x8D, 0x8C, 0x27,
-    0x60, 0x27, 0x73, 0x8F, 0x65, 0x90, 0x45, 0x71, 0xAC, 0x5C, 0xF9, 0xE6, 0x3C, 0x34, 0x47, 0x2A,
-    0xA6, 0xC0, 0x0F, 0xC5, 0x4B, 0xF8, 0x3E, 0x53, 0xC9, 0xCC, 0x47, 0x0E, 0xED, 0x77, 0xF4, 0x78,
-    0x45, 0xA5, 0x27, 0x62, 0x25, 0x5F, 0x63, 0x2C, 0xF9, 0x26, 0x0B, 0xBE, 0x2F, 0x0B, 0x0E, 0x3C,
-    0xC3, 0x82, 0xE5, 0x0B, 0x2C, 0x16, 0xF7, 0x2B, 0x2B, 0x53, 0x9E, 0x25, 0xFF, 0x60, 0x5D, 0xCD,
-    0x39, 0x86, 0xA6, 0xE1, 0x6F, 0x7D, 0xE4, 0x70, 0xC8, 0x47, 0x3E, 0xA8, 0x0C, 0xED, 0x36, 0x7B,
-    0xAF, 0xDB, 0x53, 0xE9, 0xB7, 0x08, 0x2C, 0x77, 0x8C, 0x0E, 0xDB, 0x73, 0x0A, 0xC3, 0x83, 0xF9,
-    0xA4, 0x23, 0xF4, 0xA8, 0x93, 0x31, 0xCE, 0x34, 0x83, 0x71, 0x5D, 0x73, 0x8D, 0x96, 0x72, 0x94,
-    0xDE, 0xCA, 0xF9, 0xB6, 0xA6, 0x5A, 0x32, 0x59, 0xED, 0xEC, 0x76, 0xAB, 0xEB, 0xEB, 0xCD, 0x6F,
-    0xE7, 0x9E, 0xAF, 0x0D, 0x8F, 0x25, 0x56, 0x51, 0xA7, 0x56, 0x14, 0x77, 0x07, 0x8A, 0x2F, 0xE1,
-    0x81, 0x74, 0x80, 0x2E, 0x74, 0xD4, 0xEA, 0x35, 0x02, 0x7C, 0x47, 0x07, 0x2B, 0x4C, 0x2E, 0x60,
-    0x5C, 0x66, 0x92, 0x4C, 0x1A, 0xF4, 0x25, 0x9E, 0x66, 0x99, 0x86, 0x95, 0x2D, 0x8D, 0x67, 0x84,
-    0xC6, 0x2D, 0xDC, 0x6D, 0x74, 0x8D, 0xBB, 0x51, 0x3F, 0xA2, 0xAB, 0x83, 0x50, 0xD1, 0xB5, 0x48,
-    0xFA, 0xA1, 0x6B, 0xFF, 0x9B, 0xD1, 0x9F, 0x4F, 0xAD, 0xB5, 0x58, 0xB7, 0xAF, 0x0B, 0xCA, 0xD2,
-    0xD2, 0x77, 0xE1, 0x47, 0xDA, 0xE5, 0x3F, 0xA8, 0x66, 0x3C, 0xD5, 0xED, 0x16, 0x36, 0xCF, 0xD3,
-    0x57, 0x38, 0x1A, 0x46, 0xA7, 0xC1, 0xE3, 0x7C, 0x1C, 0x90, 0x13, 0x72, 0x44, 0xCE, 0xC8, 0x20,
-    0x39, 0x25, 0xC7, 0xE4, 0x9C, 0x1C, 0x94, 0x93, 0x72, 0x54, 0xCE, 0xCA, 0x29, 0xAD, 0x5A, 0x73,
-    0x0E, 0x52, 0xCF, 0x54, 0x5A, 0x02, 0xCA, 0x88, 0x39, 0x32, 0x67, 0xE6, 0xD0, 0x8C, 0x9A, 0x63,
-    0xEB, 0x5A, 0xC1, 0x9B, 0xAB, 0x5D, 0x0B, 0x31, 0x20, 0x83, 0x99, 0xEC, 0x58, 0xA4, 0x73, 0x41,
-    0x3A, 0x7C, 0x86, 0x34, 0x49, 0x8A, 0x8F, 0xE4, 0x42, 0x5B, 0x2F, 0xA5, 0x01, 0x80, 0x54, 0x99,
-    0x2A, 0x54, 0x50, 0x25, 0x60, 0x25, 0x70, 0x25, 0x80, 0x55, 0xB2, 0x8A, 0x56, 0xD9, 0x2A, 0x5C,
-    0xA5, 0x6B, 0x0B, 0x8B, 0x1E, 0xF3, 0xD1, 0x6A, 0xD9, 0x01, 0x62, 0x65, 0x6C, 0x90, 0x95, 0xB2,
-    0x63, 0xB6, 0x4D, 0x97, 0x2F, 0xDA, 0x0B, 0x16, 0xC5, 0x77, 0xF5, 0x94, 0x5F, 0x87, 0x36, 0x62,
-    0x25, 0xFC, 0x2A, 0xC0, 0xEB, 0xAC, 0x7B, 0x18, 0x07, 0x75, 0x31, 0xC4, 0xB1, 0xA6, 0xFD, 0x01,
-    0x5B, 0x98, 0x9D, 0x74, 0x6E, 0xF4, 0x00, 0x0F, 0xEC, 0x5A, 0xE8, 0x5E, 0xBB, 0x2A, 0x9E, 0xD3,
-    0x3B, 0xE7, 0xDA, 0xEF, 0xDD, 0xBA, 0xED, 0x33, 0xC1, 0xDF, 0xED, 0x2D, 0x2F, 0xA8, 0x52, 0x6E,
-    0x9D, 0x79, 0x60, 0xAB, 0x17, 0x0C, 0x09, 0xFD, 0x7E, 0xB2, 0xDA, 0x7A, 0xD8, 0x83, 0xFE, 0x1D,
-    0x40, 0xFF, 0x76, 0xD7, 0x42, 0xFF, 0x7C, 0x11, 0x4B, 0x66, 0x03, 0xDD, 0x7D, 0xF8, 0x23, 0xC8,
-    0x0E, 0x31, 0xA6, 0x27, 0xDB, 0x27, 0x2F, 0x07, 0xF9, 0x83, 0x0D, 0x50, 0x4A, 0x7B, 0x65, 0x93,
-    0x1F, 0xF3, 0xE7, 0x8B, 0x27, 0x14, 0xFD, 0x2B, 0xB0, 0x62, 0x8C, 0xDC, 0x5A, 0x93, 0xE8, 0x28,
-    0x9D, 0x2E, 0x1D, 0x7D, 0x68, 0x03, 0x64, 0x8C, 0x34, 0x66, 0xFB, 0x4D, 0xD9, 0x62, 0x34, 0x8D,
-    0xA6, 0x4A, 0x7B, 0xF7, 0x8C, 0xE9, 0xE1, 0x0F, 0x0E, 0x01, 0x90, 0x27, 0x4F, 0xE6, 0x1E, 0xCD,
-    0x3E, 0xCB, 0xF9, 0x57, 0x35, 0x3B, 0x9E, 0x6F, 0xDC, 0xBE, 0x7E, 0x4F, 0xA8, 0x30, 0x58, 0x40,
-    0x2D, 0xF9, 0x42, 0xD7, 0x90, 0x2E, 0xC4, 0x21, 0xE5, 0xB7, 0xF1, 0xD2, 0x6B, 0x4C, 0x90, 0x6E,
-    0xDB, 0x6E, 0x31, 0x05, 0xD1, 0xC2, 0xF6, 0xFA, 0x54, 0x9A, 0x42, 0x49, 0x62, 0x28, 0x95, 0x22,
-    0x18, 0x82, 0xA0, 0xDE, 0x18, 0x87, 0x99, 0x27, 0xE5, 0xC1, 0x2D, 0x59, 0x1D, 0x2A, 0xE7, 0x05,
-    0x5A, 0xE8, 0x52, 0xDE, 0x74, 0x13, 0xF5, 0x1D, 0x72, 0xC3, 0xA3, 0xF0, 0x1F, 0x71, 0x4E, 0xE4,
-    0x52, 0xEF, 0x1F, 0x47, 0x61, 0xDE, 0x9B, 0x3C, 0x25, 0xFA, 0x5C, 0x3C, 0xB8, 0xAC, 0xA6, 0x1B,
-    0x05, 0x5D, 0x77, 0x4C, 0xFC, 0xC5, 0x05, 0x1D, 0xCD, 0xE5, 0xAE, 0x7C, 0x4F, 0x76, 0x5E, 0x62,
-    0x0D, 0x87, 0xA7, 0x16, 0x0E, 0xA7, 0x1A, 0x08, 0x8F, 0xF0, 0x53, 0xC8, 0x0F, 0xF7, 0x20, 0xBF,
-    0x5B, 0xE4, 0xA1, 0x48, 0x67, 0x14, 0x15, 0xA7, 0xA6, 0x9B, 0xAB, 0xE4, 0x57, 0xED, 0x57, 0x8F,
-    0x9B, 0xFB, 0x68, 0x1E, 0x85, 0x8E, 0xE5, 0x5E, 0x6C, 0x32, 0xF8, 0xA7, 0xDF, 0x31, 0x93, 0x71,
-    0x98, 0x6C, 0x07, 0x0F, 0xF6, 0xA5, 0x8F, 0x10, 0x3E, 0x40, 0xF0, 0x85, 0xEC, 0xF1, 0xF4, 0x74,
-    0x78, 0x30, 0x42, 0x32, 0x48, 0x7C, 0x9C, 0x5D, 0xE9, 0x87, 0x5A, 0x5C, 0xF3, 0x8B, 0x16, 0xC9,
-    0xB3, 0x68, 0xA2, 0xB7, 0x23, 0xDA, 0x6F, 0x4B, 0xA3, 0xEE, 0x68, 0x16, 0x42, 0x85, 0x85, 0x4A,
-    0xB6, 0xCF, 0x58, 0xAE, 0x48, 0x14, 0x69, 0x8A, 0x9E, 0x48, 0xDF, 0xF8, 0x9F, 0x74, 0x27, 0x2B,
-    0xA1, 0x27, 0xD9, 0x04, 0x42, 0xA7, 0x55, 0xAC, 0x0D, 0x36, 0x64, 0xB2, 0x0A, 0x03, 0x93, 0x55,
-    0xF2, 0x35, 0xCA, 0x27, 0xA8, 0x7F, 0xCA, 0x27, 0xF9, 0x04, 0xC3, 0x83, 0x01, 0x1A, 0x6A, 0x33,
-    0x2E, 0x72, 0xF5, 0x54, 0xA5, 0xE1, 0xB5, 0x22, 0xC7, 0xB6, 0xB2, 0x4C, 0x7C, 0xE9, 0xB8, 0xA4,
-    0x88, 0x52, 0x00, 0x96, 0x0F, 0xE2, 0x19, 0xBA, 0xC9, 0xB7, 0xC5, 0xBE, 0xDE, 0xF0, 0x5B, 0x88,
-    0x39, 0x50, 0xA1, 0xE9, 0xED, 0x8E, 0x72, 0x7F, 0x6E, 0x8B, 0xAD, 0xF5, 0xAB, 0xFD, 0xCE, 0x27,
-    0x93, 0xEA, 0x2B, 0x7F, 0x39, 0x7D, 0x0E, 0x13, 0x96, 0x4C, 0x99, 0x7A, 0x5C, 0x63, 0xE8, 0x24,
-    0xDB, 0x32, 0x4F, 0xE4, 0xC0, 0x5C, 0xFB, 0x73, 0x2C, 0xAD, 0x72, 0x98, 0xC9, 0xF2, 0x3A, 0xE3,
-    0x61, 0x1B, 0xD4, 0x7C, 0x48, 0xA6, 0x62, 0xF4, 0x2A, 0xC9, 0x1D, 0x95, 0x60, 0x91, 0x49, 0xDE,
-    0x28, 0xA9, 0xB8, 0x03, 0xF1, 0xF2, 0xCB, 0xCA, 0xF4, 0xF5, 0x5C, 0x23, 0xD8, 0xE5, 0x66, 0x9D,
-    0x45, 0x5E, 0x05, 0xD3, 0x63, 0xDF, 0x97, 0x49, 0xCD, 0xED, 0x63, 0xAD, 0xA5, 0x0B, 0x46, 0xDC,
-    0x1A, 0x4D, 0x98, 0x45, 0x6A, 0xBE, 0x7A, 0x75, 0xBB, 0x6A, 0xA1, 0x53, 0x0C, 0x76, 0x16, 0xF8,
-    0x45, 0x0F, 0xBD, 0x26, 0xEC, 0xB2, 0x54, 0x0A, 0x6D, 0xA1, 0xF6, 0x4D, 0x06, 0x00, 0xF5, 0x60,
-    0x08, 0x58, 0x90, 0x1B, 0x5F, 0x6D, 0xC2, 0xBF, 0x7E, 0x8E, 0x0F, 0x54, 0x52, 0xCD, 0x4D, 0x8B,
-    0x94, 0x6C, 0x80, 0x91, 0x89, 0x48, 0x96, 0xD0, 0xAF, 0xFC, 0x08, 0xA7, 0xCE, 0x90, 0x99, 0xE9,
-    0x4F, 0xA2, 0xEA, 0xA5, 0x65, 0xE7, 0x8C, 0x68, 0x5A, 0xAB, 0xAC, 0x4B, 0x10, 0xC5, 0xF3, 0x94,
-    0xBC, 0xAC, 0x0B, 0x35, 0x13, 0xEC, 0xE3, 0x14, 0xBE, 0xD5, 0x1E, 0xBD, 0xC2, 0x89, 0x45, 0x9A,
-    0x56, 0xA8, 0xE9, 0xEA, 0x08, 0x6E, 0x66, 0xBB, 0x40, 0x8E, 0x80, 0x8E, 0xC0, 0xCE, 0xFD, 0x5B,
-    0xA1, 0x07, 0x2F, 0x77, 0x46, 0xE0, 0x47, 0x00, 0x08, 0xF7, 0xA3, 0x42, 0x1A, 0xD7, 0xED, 0x22,
-    0x20, 0x2A, 0x45, 0xC3, 0x68, 0x4E, 0xAC, 0x81, 0xBC, 0xA7, 0xA2, 0x3C, 0xA1, 0xF6, 0x26, 0x71,
-    0xF2, 0x33, 0x78, 0x27, 0xBD, 0x8F, 0xB5, 0xAB, 0x9B, 0x40, 0x52, 0xFD, 0x89, 0x59, 0xB3, 0x3B,
-    0x8C, 0xC2, 0xB6, 0x6D, 0xD4, 0x7A, 0x08, 0x44, 0x30, 0x04, 0xC2, 0xE8, 0x45, 0x5F, 0xE7, 0x35,
-    0xEA, 0x9C, 0xA5, 0xA7, 0x2D, 0x83, 0x76, 0x68, 0x0B, 0xA2, 0x36, 0x7B, 0x13, 0x68, 0xE0, 0x55,
-    0xF0, 0x5B, 0x6E, 0x6D, 0x94, 0x06, 0x6A, 0x61, 0x4B, 0xF9, 0xAA, 0xEA, 0xAC, 0xB8, 0x55, 0x9D,
-    0x75, 0xFA, 0xB5, 0xD1, 0x43, 0xCA, 0xB4, 0x4E, 0x74, 0xFF, 0x0F, 0xBB, 0x9E, 0xD3, 0x31, 0xE6,
-    0xE5, 0x64, 0xE7, 0xB8, 0xD5, 0x5D, 0xDB, 0x68, 0x49, 0x36, 0x47, 0x45, 0x3D, 0xB2, 0xAC, 0xDE,
-    0x92, 0x51, 0x63, 0x2D, 0xFD, 0x3A, 0xD4, 0xD4, 0x2B, 0x3D, 0x1F, 0xA8, 0xCE, 0xE3, 0xA9, 0xD2,
-    0xD8, 0x48, 0x53, 0x74, 0xF1, 0xD2, 0xA2, 0x0B, 0x43, 0x05, 0x6F, 0x65, 0xAE, 0xA8, 0x74, 0x53,
-    0x2C, 0x3A, 0xAB, 0x5A, 0xF9, 0x03, 0x3C, 0x50, 0x44, 0x96, 0xB8, 0x12, 0x2A, 0xD4, 0x86, 0xB9,
-    0x55, 0xA7, 0xBD, 0x71, 0x6B, 0xFB, 0x7D, 0x9E, 0x2A, 0xED, 0x9C, 0x78, 0x9E, 0xC3, 0x6C, 0xB2,
-    0x7D, 0x6B, 0xD1, 0x4E, 0xB8, 0x4B, 0x9D, 0xA4, 0xB6, 0x5B, 0x48, 0xF4, 0x34, 0x09, 0x10, 0x21,
-    0x2C, 0xAD, 0x20, 0x16, 0x6F, 0x4E, 0x18, 0xF7, 0xA6, 0x0A, 0x99, 0x63, 0x77, 0x50, 0xFE, 0xC4,
-    0x30, 0xD7, 0x64, 0x9C, 0xC9, 0x40, 0x93, 0x91, 0x26, 0x43, 0x4D, 0xC6, 0x9A, 0x0C, 0x36, 0x19,
-    0x6D, 0x32, 0xDC, 0x64, 0xBC, 0xC9, 0x80, 0x93, 0x11, 0x27, 0x43, 0xEE, 0xCC, 0x1D, 0xBA, 0x53,
-    0x77, 0xEC, 0xCE, 0xDD, 0xC1, 0x37, 0xE4, 0x1D, 0x7D, 0xC3, 0x7E, 0x05, 0x7F, 0xE7, 0x5E, 0x67,
-    0x77, 0x5B, 0x47, 0xE1, 0x59, 0x6B, 0x4F, 0x58, 0x72, 0x13, 0x57, 0x74, 0xE6, 0xB7, 0x26, 0x07,
-    0x33, 0x0E, 0x4A, 0xF9, 0x0B, 0xE5, 0x7C, 0x07, 0x66, 0xF8, 0x2B, 0xB5, 0xC3, 0x1C, 0xB9, 0x09,
-    0xED, 0x39, 0x99, 0x25, 0x36, 0x53, 0x6C, 0xB6, 0xD8, 0x8C, 0xB1, 0x59, 0x63, 0x33, 0xC7, 0x66,
-    0x8F, 0xCD, 0x20, 0xA3, 0xA9, 0xC8, 0x4C, 0xB2, 0xD9, 0x64, 0x33, 0xCA, 0x66, 0x95, 0xDD, 0x2C,
-    0x9B, 0x5D, 0x5E, 0xCD, 0x86, 0xF7, 0x47, 0xDD, 0x6D, 0x07, 0xAF, 0x55, 0x68, 0xC2, 0x52, 0x2F,
-    0xD2, 0xB8, 0x4E, 0x8E, 0x7C, 0x93, 0x88, 0x3F, 0xE8, 0xA8, 0x76, 0x5E, 0xB4, 0x4B, 0x0F, 0xED,
-    0x69, 0x9E, 0x68, 0x4A, 0x57, 0x5E, 0x32, 0x07, 0xA7, 0x98, 0xB8, 0x45, 0xA3, 0x1E, 0x8E, 0x36,
-    0xF1, 0xE8, 0x4A, 0xB9, 0xAD, 0x5F, 0x96, 0x51, 0xB3, 0x98, 0xB4, 0x29, 0xA5, 0xE7, 0xA8, 0x74,
-    0x93, 0x66, 0x40, 0xF4, 0x90, 0x56, 0x4F, 0x32, 0x69, 0xDC, 0xEA, 0x91, 0x6B, 0x13, 0xBC, 0x23,
-    0x0D, 0xE4, 0x8F, 0x09, 0xF5, 0xD5, 0x02, 0x70, 0xB3, 0x1E, 0xF3, 0xE1, 0x1D, 0xDF, 0xBB, 0x40,
-    0x91, 0x38, 0xF5, 0x83, 0x3A, 0xDB, 0x83, 0x0F, 0xB1, 0xB1, 0xBD, 0xDA, 0xD9, 0x66, 0x9B, 0xB6,
-    0x49, 0xDC, 0xDF, 0xB1, 0xAC, 0x71, 0xF9, 0x01, 0x3E, 0xAD, 0x3F, 0x03, 0xFD, 0x20, 0x72, 0x7D,
-    0x40, 0xA1, 0xBC, 0xA2, 0xB6, 0x70, 0x3D, 0x10, 0xD3, 0x86, 0x2D, 0xD3, 0xF6, 0x72, 0xA7, 0x66,
-    0x68, 0x6B, 0xDC, 0xD8, 0xDB, 0xA2, 0xFB, 0x39, 0xBF, 0xD6, 0xCA, 0x82, 0xB7, 0x5D, 0x30, 0x73,
-    0xD4, 0xF2, 0x49, 0xFB, 0x9D, 0x56, 0xDB, 0xE6, 0x2C, 0x7B, 0x16, 0x66, 0xDA, 0x20, 0x41, 0x2C,
-    0x17, 0x0F, 0xBA, 0xF9, 0xB1, 0x44, 0x19, 0x2E, 0x52, 0xE1, 0x53, 0xE4, 0xC1, 0x23, 0xED, 0x00,
-    0xCF, 0x03, 0x11, 0x99, 0xA7, 0x8B, 0x64, 0xC3, 0x79, 0x36, 0x88, 0xC8, 0x6C, 0xCB, 0x24, 0x2D,
-    0xCE, 0xBE, 0x8D, 0x48, 0x3E, 0x50, 0xC9, 0x93, 0x02, 0x79, 0xF1, 0x04, 0xE1, 0x9F, 0xEC, 0x0B,
-    0x09, 0xA4, 0x54, 0x9B, 0x7D, 0x75, 0x8E, 0x0E, 0xD4, 0x81, 0xBC, 0xAE, 0xCD, 0x1D, 0x6D, 0x66,
-    0x58, 0x47, 0x23, 0x73, 0xBA, 0x05, 0x72, 0x8D, 0xC7, 0xB3, 0x62, 0x2B, 0x98, 0x18, 0x2B, 0xD5,
-    0xE8, 0x66, 0x27, 0x2F, 0x3E, 0x6A, 0x3B, 0x5E, 0xD9, 0xB4, 0xFD, 0x6E, 0xB0, 0x4A, 0x93, 0x8E,
-    0x17, 0x2C, 0xFD, 0xD1, 0x5C, 0xFC, 0x67, 0x3E, 0x4C, 0x11, 0xDC, 0x4A, 0x65, 0x5D, 0x15, 0xCB,
-    0x36, 0x02, 0xF7, 0x21, 0x9D, 0xF0, 0x21, 0x2B, 0x59, 0x7E, 0x3E, 0xF0, 0xDC, 0x1C, 0x49, 0x89,
-    0x9D, 0x38, 0xCC, 0x63, 0x11, 0x98, 0xE3, 0x04, 0x29, 0xA8, 0xCB, 0x0B, 0x0E, 0x6D, 0x86, 0xF4,
-    0x16, 0x1F, 0x8A, 0x6B, 0x1C, 0x34, 0xFC, 0x65, 0x1A, 0xCE, 0xE5, 0xA1, 0x1C, 0x2F, 0x39, 0x2A,
-    0x65, 0x85, 0x38, 0x6C, 0xEA, 0xE9, 0x70, 0x67, 0x8C, 0x39, 0xC6, 0x3F, 0x9B, 0xAC, 0x2A, 0x9D,
-    0x33, 0x5D, 0x0C, 0x6C, 0x6A, 0x56, 0xB9, 0x39, 0x10, 0xDA, 0x3C, 0x55, 0xF1, 0xF5, 0x94, 0x4C,
-    0xBF, 0x70, 0x55, 0x3F, 0x7A, 0x6F, 0xD5, 0xE7, 0xB3, 0xC1, 0x6F, 0xFB, 0x3E, 0xBA, 0xC2, 0x5F,
-    0x3C, 0x90, 0x7A, 0x95, 0xDD, 0x66, 0xB7, 0x0A, 0x9B, 0xC7, 0x83, 0x66, 0xC8, 0x06, 0x9D, 0xA4,
-    0xC7, 0xEB, 0xE4, 0xF8, 0xE9, 0xA8, 0xE3, 0xE4, 0x79, 0x21, 0x8F, 0x3F, 0x77, 0x62, 0x4F, 0x26,
-    0xF8, 0xA3, 0xA1, 0xB2, 0x57, 0x9A, 0x16, 0x5E, 0xA3, 0x03, 0x38, 0x73, 0x8E, 0x3D, 0xD1, 0xA6,
-    0x25, 0x28, 0xCD, 0x13, 0x5D, 0xFB, 0x1F, 0x5B, 0x95, 0x6A, 0xFD, 0x44, 0x41, 0xF1, 0xC0, 0x80,
-    0x54, 0xAD, 0x86, 0x4E, 0x4C, 0xB2, 0xB1, 0x72, 0x58, 0x4E, 0xCB, 0x71, 0x39, 0x2F, 0x07, 0xE6,
-    0xC4, 0x1C, 0x99, 0x33, 0x73, 0x68, 0x4E, 0xCD, 0xB1, 0x39, 0x37, 0x07, 0xE7, 0xE4, 0x1C, 0x9D,
-    0xB3, 0x6B, 0xE0, 0x39, 0xBD, 0x96, 0xFA, 0x5D, 0x3A, 0x69, 0xD5, 0x8C, 0xEA, 0x56, 0x9A, 0x3F,
-    0x6C, 0x64, 0x5E, 0x10, 0x0B, 0x74, 0x5E, 0x83, 0x41, 0x8B, 0x88, 0x86, 0xBE, 0x7F, 0x0B, 0x8E,
-    0xE9, 0x08, 0x24, 0x33, 0x02, 0xCB, 0x3B, 0x48, 0x39, 0x7D, 0x57, 0xA1, 0xE2, 0xF5, 0x39, 0x86,
-    0x59, 0x9E, 0xA6, 0x07, 0x53, 0x34, 0xE8, 0x5A, 0xA5, 0xCD, 0x04, 0x57, 0x04, 0x5B, 0xF4, 0x79,
-    0xAC, 0x5D, 0x0C, 0xE8, 0x49, 0x4F, 0x1B, 0xA4, 0x21, 0x40, 0x99, 0x94, 0x33, 0x29, 0x69, 0x94,
-    0x56, 0x8B, 0xE9, 0x54, 0xDA, 0xD4, 0xF0, 0xF6, 0x18, 0x37, 0x36, 0xC7, 0xB6, 0x79, 0x72, 0xEA,
-    0x29, 0x75, 0x1E, 0x49, 0xC1, 0x40, 0x5B, 0xEE, 0x6A, 0x83, 0x88, 0xDB, 0xE3, 0x75, 0x5E, 0xDF,
-    0xF6, 0xAC, 0x63, 0xB9, 0x4C, 0x19, 0x58, 0xE0, 0xF3, 0x5A, 0xE2, 0xBC, 0x16, 0xC4, 0xDD, 0x1A,
-    0xBB, 0x39, 0x6E, 0xEC, 0xB1, 0x77, 0xCB, 0xD1, 0x9B, 0x49, 0x76, 0x9B, 0xEC, 0x46, 0x59, 0xAC,
-    0xF2, 0x26, 0xE9, 0xFC, 0xF6, 0x7D, 0x5B, 0x80, 0xD0, 0xE7, 0x03, 0xAD, 0x3E, 0xDE, 0xB5, 0xB0,
-    0x37, 0x1D, 0xB5, 0x4B, 0x7F, 0x1A, 0x87, 0xE3, 0xBC, 0xDA, 0xF0, 0xF5, 0x98, 0x0F, 0xB7, 0x7C,
-    0xB7, 0xBD, 0xB8, 0xAD, 0x4F, 0x48, 0x7E, 0x05, 0x63, 0x7F, 0xDD, 0x62, 0xE2, 0xDB, 0x3D, 0xAF,
-    0x26, 0xD9, 0xDD, 0x28, 0xEE, 0xB7, 0xAC, 0x5C, 0x67, 0x74, 0x0D, 0x11, 0x6F, 0x2D, 0xF5, 0x26,
-    0xA8, 0xFC, 0x25, 0xD4, 0xFE, 0x9E, 0xD7, 0x98, 0x67, 0x3D, 0x10, 0xD3, 0x86, 0x2D, 0xD3, 0xDD,
-    0x30, 0x2F, 0x9E, 0xB5, 0xCA, 0xD2, 0x48, 0x05, 0x6E, 0x7F, 0x2E, 0xAF, 0xF3, 0xD4, 0xCE, 0x62,
-    0x9E, 0x7E, 0x9C, 0x2B, 0xDF, 0xBA, 0x6C, 0xC7, 0x3C, 0xE6, 0x98, 0xD8, 0x67, 0x9E, 0xD0, 0xB4,
-    0x73, 0xAC, 0xAE, 0xCC, 0x53, 0x5B, 0xB3, 0x4E, 0x2E, 0x73, 0xAB, 0xB5, 0xFB, 0x12, 0xE6, 0x51,
-    0x08, 0xA3, 0x5C, 0x1B, 0x79, 0xD0, 0x82, 0x47, 0x4C, 0x22, 0x5E, 0x31, 0x70, 0x41, 0xD7, 0x3D,
-    0xB6, 0x09, 0x99, 0x46, 0x93, 0x77, 0xF4, 0xB6, 0xB5, 0x6E, 0x50, 0x00, 0x50, 0x85, 0x7D, 0x8F,
-    0x64, 0x9A, 0x6A, 0xAD, 0xF7, 0x81, 0x3A, 0x18, 0xB8, 0x5F, 0xFF, 0xDB, 0xCA, 0x52, 0x09, 0x6D,
-    0x37, 0xB3, 0x5B, 0x36, 0xD7, 0xAD, 0x97, 0xB3, 0x66, 0xD6, 0x76, 0x53, 0xAC, 0x6C, 0x4E, 0x57,
-    0xA8, 0x9D, 0xB0, 0x3C, 0xD6, 0xC2, 0xAE, 0x49, 0xA7, 0xD7, 0xD6, 0x5D, 0x73, 0x5D, 0x3D, 0x73,
-    0xF7, 0xA4, 0xB3, 0x98, 0x6D, 0x75, 0x67, 0xCC, 0x39, 0x51, 0x78, 0xD4, 0x56, 0x45, 0x63, 0x0D,
-    0xD6, 0x39, 0xAC, 0x92, 0xD8, 0x5D, 0x1E, 0x47, 0xAA, 0x70, 0x5F, 0x6C, 0xFF, 0xD7, 0x68, 0x58,
-    0xA6, 0x44, 0xE3, 0x74, 0x19, 0x11, 0x96, 0x1E, 0x3A, 0xB6, 0x54, 0x97, 0x29, 0xA8, 0x8F, 0x3C,
-    0xD6, 0x1B, 0x0E, 0x0B, 0xDC, 0x3E, 0xBF, 0x0B, 0x99, 0xB2, 0xBF, 0xA2, 0xF7, 0xE9, 0xDF, 0x21,
-    0x68, 0xF2, 0x5F, 0x5A, 0xFD, 0xCD, 0x01, 0x9F, 0xA4, 0x06, 0xC9, 0xD2, 0xAA, 0xBA, 0xCC, 0xF8,
-    0x02, 0x3D, 0x6F, 0x0F, 0x05, 0xE2, 0xAC, 0x8B, 0xDB, 0xB0, 0xD1, 0xB9, 0x66, 0xA9, 0x32, 0x4D,
-    0x6A, 0xAE, 0x3B, 0xC6, 0xF6, 0xEB, 0x72, 0x27, 0x79, 0x61, 0xEA, 0x69, 0xEF, 0xF6, 0xD7, 0x88,
-    0x1F, 0x2A, 0x2D, 0xE7, 0xA8, 0xB7, 0xE3, 0x70, 0x6E, 0xE1, 0x9B, 0x7A, 0xE0, 0xF7, 0xE8, 0x05,
-    0x7E, 0x4D, 0x92, 0xA6, 0x1F, 0xF4, 0xD9, 0xFF, 0x9F, 0xCE, 0xDA, 0x8A, 0xDB, 0xD3, 0x3B, 0xE8,
-    0x1F, 0x2C, 0x71, 0x65, 0x36, 0xD5, 0x3E, 0x39, 0x3B, 0xCA, 0x4C, 0x97, 0x74, 0x47, 0x3C, 0xD8,
-    0x9F, 0x87, 0x51, 0xE7, 0xB4, 0x38, 0x68, 0x6B, 0xF3, 0x9E, 0x5E, 0xE8, 0x46, 0xD1, 0x36, 0x68,
-    0xD7, 0xCE, 0xB0, 0x6A, 0xFB, 0x1F, 0x88, 0xE0, 0xF5, 0xBB, 0xA7, 0x8F, 0x5A, 0x7E, 0x24, 0x4D,
-    0x85, 0x07, 0xC6, 0x7A, 0x65, 0x32, 0x7F, 0xF1, 0x61, 0xD4, 0x75, 0x9F, 0x05, 0x4D, 0x77, 0x23,
-    0x14, 0xB3, 0x86, 0x5F, 0xC9, 0xBD, 0xA6, 0x43, 0x19, 0x9A, 0xA8, 0x1C, 0xBC, 0xEA, 0xD9, 0xDB,
-    0xB3, 0x05, 0xFC, 0x7F, 0xBD, 0x59, 0x4D, 0x8C, 0xDE, 0x46, 0x19, 0x7E, 0x6D, 0xEF, 0xC6, 0xB4,
-    0x96, 0xEA, 0x1C, 0x12, 0xD4, 0xB4, 0x10, 0x5F, 0x8A, 0x44, 0xA3, 0xEE, 0xFA, 0xD2, 0x43, 0x25,
-    0x36, 0xEB, 0xA9, 0x72, 0xE8, 0x01, 0x89, 0xE6, 0x90, 0xE5, 0x40, 0x25, 0xCA, 0xA1, 0x1C, 0x88,
-    0x84, 0xB6, 0x87, 0x54, 0x8A, 0xD0, 0x26, 0x76, 0x41, 0xE2, 0x4A, 0x04, 0x48, 0x3D, 0x21, 0xE5,
-    0x50, 0xA4, 0x74, 0x91, 0x48, 0x0F, 0x39, 0xE4, 0xB0, 0x89, 0x27, 0xF4, 0xC0, 0xD5, 0xBD, 0xF4,
-    0x5A, 0x97, 0x96, 0x0B, 0x3D, 0xC4, 0x14, 0x23, 0x39, 0x89, 0x3F, 0x0F, 0xCF, 0x33, 0xE3, 0xEF,
-    0x67, 0xBF, 0x6C, 0x5B, 0x24, 0x3E, 0xE1, 0xF5, 0x8C, 0xE7, 0xB3, 0x67, 0xDE, 0x79, 0xFF, 0x7F,
-    0x66, 0xCF, 0x37, 0x5F, 0x71, 0x9D, 0xF0, 0xD4, 0x46, 0x58, 0x44, 0x3F, 0x16, 0xBF, 0x13, 0xAF,
-    0x95, 0x70, 0x22, 0xA7, 0x1F, 0xA9, 0x97, 0xBE, 0xD0, 0xD2, 0xC8, 0x0A, 0xEE, 0xF3, 0x22, 0xB7,
-    0x44, 0x36, 0xE4, 0xE2, 0x4D, 0x65, 0x4C, 0xD1, 0x9C, 0x96, 0xE6, 0xB2, 0x34, 0xD7, 0x57, 0x00,
-    0xF8, 0xBA, 0x88, 0xA7, 0x24, 0x2C, 0xE4, 0xB4, 0xC8, 0xD5, 0x7D, 0x55, 0x1A, 0xBD, 0x11, 0xE8,
-    0xE8, 0x9C, 0xF6, 0x7F, 0xA5, 0x25, 0xF8, 0xDF, 0xEF, 0xE2, 0xCC, 0xFE, 0x8D, 0xCC, 0x74, 0xB9,
-    0x69, 0x45, 0x64, 0x71, 0x9C, 0x19, 0xC3, 0x21, 0xBA, 0x93, 0x3B, 0x3B, 0x3B, 0x20, 0x4F, 0xC6,
-    0x97, 0x46, 0x72, 0xDB, 0x2F, 0x5F, 0xF6, 0x1B, 0xAF, 0x3E, 0x9F, 0x8E, 0x3A, 0x39, 0xE2, 0xFA,
-    0xEA, 0x79, 0xCF, 0x79, 0xD7, 0xF6, 0xFC, 0xFA, 0xFF, 0x79, 0xDB, 0x6D, 0x13, 0x60, 0x51, 0xA5,
-    0xE8, 0xF4, 0x1C, 0x95, 0x33, 0xFB, 0xFB, 0xFB, 0x8A, 0x38, 0xAA, 0x8B, 0x18, 0x89, 0xAC, 0xCB,
-    0xDD, 0xA0, 0x8E, 0x55, 0x22, 0x99, 0x64, 0x3A, 0x6B, 0xB2, 0x26, 0x69, 0x3C, 0x75, 0xEC, 0x5A,
-    0xDC, 0x26, 0x7D, 0xDC, 0x07, 0xBD, 0x74, 0xD2, 0xF8, 0x55, 0x52, 0x74, 0xA2, 0xC4, 0xFB, 0x2C,
-    0x9C, 0x84, 0x43, 0x30, 0xC8, 0x20, 0x67, 0x65, 0x4B, 0xDA, 0xA8, 0xDA, 0x96, 0xE3, 0xE2, 0xD7,
-    0x71, 0x9B, 0xB6, 0x58, 0x59, 0xF0, 0xE5, 0x86, 0xC4, 0x2A, 0x68, 0xE4, 0x27, 0x80, 0xFB, 0xB4,
-    0xDC, 0xF5, 0xFA, 0xA0, 0x8E, 0x2A, 0x42, 0x4F, 0xB0, 0x24, 0x93, 0x2B, 0xD8, 0xA3, 0x2C, 0xB2,
-    0xA6, 0xAC, 0xB3, 0x26, 0xAF, 0x93, 0x26, 0xAB, 0x3C, 0xB5, 0x2E, 0xC7, 0xAE, 0x45, 0x05, 0x60,
-    0x34, 0x49, 0x9F, 0xB5, 0x71, 0x9F, 0xB6, 0x41, 0x1F, 0xB6, 0xD2, 0xF9, 0x0D, 0x76, 0xAE, 0xFD,
-    0x2A, 0xD4, 0x49, 0xB1, 0x2B, 0x9D, 0x47, 0x0C, 0x88, 0x83, 0x5F, 0x87, 0x93, 0xB8, 0x0B, 0x07,
-    0x60, 0x37, 0x44, 0xBD, 0x0C, 0x7E, 0x0F, 0xD0, 0x07, 0xD8, 0xFA, 0x96, 0xB4, 0x5E, 0x13, 0x55,
-    0xCF, 0xEA, 0x6D, 0xEC, 0x73, 0x1C, 0xA4, 0xFA, 0x35, 0xE9, 0x48, 0x1B, 0x8B, 0x1D, 0xF7, 0x2C,
-    0x4A, 0xE5, 0xA6, 0xDE, 0x06, 0x9E, 0x5B, 0xC0, 0x74, 0x53, 0x02, 0xAC, 0x00, 0xB6, 0x05, 0x18,
-    0x83, 0x15, 0x39, 0xDA, 0x5D, 0xB4, 0x03, 0xB4, 0x1E, 0x8D, 0x22, 0x6C, 0x6C, 0x5B, 0x93, 0x7A,
-    0x3D, 0x1D, 0xCC, 0x90, 0x99, 0xFB, 0x93, 0xEF, 0x04, 0xFA, 0x69, 0xC1, 0x32, 0x89, 0xD1, 0x52,
-    0xB4, 0x8C, 0x0D, 0x3C, 0xCE, 0x00, 0x26, 0x13, 0xD7, 0xAE, 0xA2, 0x5D, 0x19, 0x41, 0xDD, 0x46,
-    0x6B, 0x67, 0xA0, 0xC4, 0x83, 0x74, 0x3C, 0x2C, 0xF1, 0xB1, 0x24, 0x60, 0xC3, 0xB2, 0x40, 0xCD,
-    0x24, 0x74, 0x03, 0xCD, 0xE3, 0xEE, 0x3E, 0xD7, 0xF8, 0x8D, 0xA5, 0x04, 0x5D, 0x80, 0x25, 0xC7,
-    0x03, 0xBD, 0x26, 0xD9, 0xE7, 0x9F, 0xF7, 0x54, 0xD7, 0x4E, 0x7E, 0x1A, 0xBD, 0xFC, 0x06, 0xD0,
-    0xC0, 0x7A, 0x49, 0xD9, 0x11, 0x09, 0xC9, 0x08, 0x6A, 0x83, 0x90, 0x5E, 0x60, 0xF7, 0x5D, 0x76,
-    0x2F, 0xB2, 0xBB, 0x24, 0x23, 0x49, 0x41, 0x3F, 0xEB, 0xB8, 0x45, 0x00, 0xE8, 0xD9, 0x6F, 0x3F,
-    0xBA, 0x43, 0x25, 0xEE, 0x65, 0xFB, 0x9D, 0x5F, 0x03, 0xE7, 0x90, 0xE0, 0x22, 0x76, 0x31, 0xC1,
-    0x25, 0x6A, 0x0A, 0x38, 0x9B, 0x22, 0xEA, 0x3F, 0x90, 0xD4, 0x14, 0xB9, 0xA9, 0x4A, 0xD3, 0x98,
-    0xE9, 0x8D, 0x71, 0x6E, 0xEA, 0xCC, 0xE8, 0x68, 0x98, 0x92, 0xF3, 0xE2, 0xB8, 0x28, 0x6B, 0x69,
-    0x25, 0x0A, 0xAD, 0xE5, 0x46, 0x68, 0x1D, 0x5A, 0x21, 0x59, 0xE7, 0x18, 0xF7, 0xD2, 0x38, 0x3F,
-    0x95, 0x52, 0x1B, 0x0D, 0xC8, 0x76, 0x2C, 0x5D, 0xA9, 0x83, 0x89, 0xD1, 0xC1, 0x60, 0x8A, 0x60,
-    0x92, 0x8B, 0xDF, 0x8B, 0x43, 0x67, 0x0F, 0x4C, 0x81, 0xFA, 0x18, 0x89, 0xFA, 0xBC, 0xF2, 0x8D,
-    0xC4, 0xD3, 0x47, 0x56, 0x78, 0x13, 0x09, 0xDB, 0x35, 0xA1, 0x0E, 0xA8, 0x48, 0x65, 0x3A, 0xD7,
-    0xA5, 0xCE, 0xD4, 0x9A, 0x5C, 0xDC, 0x2F, 0x60, 0x0A, 0x2B, 0x71, 0x8C, 0xEE, 0x7E, 0x5F, 0x04,
-    0xC6, 0x44, 0xF3, 0x0A, 0x56, 0x78, 0x93, 0xA7, 0x47, 0xDE, 0x2B, 0x41, 0x1A, 0x70, 0x7E, 0xB1,
-    0x5F, 0xBC, 0x29, 0x32, 0xBB, 0xDF, 0xDA, 0x51, 0x2B, 0x04, 0x7E, 0x66, 0x1F, 0x6A, 0x3A, 0xBF,
-    0x4F, 0xEE, 0xAC, 0x0C, 0xF3, 0x43, 0x57, 0xD2, 0x39, 0x83, 0xE0, 0x35, 0x40, 0x55, 0x62, 0xE7,
-    0xE2, 0x82, 0x06, 0xC6, 0x90, 0xBA, 0xD7, 0x70, 0x3C, 0x1A, 0xAE, 0xC1, 0x5E, 0xB1, 0x86, 0xAD,
-    0x8E, 0x0E, 0x39, 0x55, 0x71, 0xE5, 0x8F, 0xE0, 0x32, 0xD8, 0x70, 0x58, 0xCD, 0xC6, 0xDA, 0x9A,
-    0x92, 0xB5, 0xDE, 0x58, 0x8F, 0x60, 0x30, 0x4E, 0xF4, 0x95, 0x71, 0x7C, 0x07, 0xAB, 0x3B, 0x86,
-    0x45, 0x8F, 0xD6, 0x9D, 0x05, 0x4D, 0x02, 0x3D, 0x2F, 0x5B, 0xCC, 0xB9, 0x13, 0xE9, 0xAB, 0xAF,
-    0xEB, 0xA0, 0x85, 0x15, 0x49, 0x9F, 0xBC, 0xDC, 0x71, 0xF7, 0x4C, 0xD2, 0x57, 0x9A, 0xED, 0xA0,
-    0x09, 0xEB, 0x54, 0x65, 0x12, 0x99, 0xE2, 0x20, 0xAA, 0x82, 0x06, 0x6F, 0x95, 0x5C, 0xF0, 0xDA,
-    0x58, 0x07, 0xCD, 0x55, 0x8E, 0x61, 0x80, 0x49, 0x11, 0x36, 0xBD, 0x1D, 0x47, 0x3A, 0x55, 0x61,
-    0xDD, 0x5B, 0x93, 0x49, 0xB8, 0xEA, 0x93, 0xDE, 0xFA, 0x93, 0x6D, 0xE2, 0xF7, 0x61, 0x67, 0x5D,
-    0x14, 0xDF, 0xC4, 0xF7, 0x3A, 0x60, 0x43, 0xF7, 0x00, 0x78, 0x6F, 0x77, 0x74, 0x57, 0x20, 0x24,
-    0xC5, 0x2F, 0xBA, 0x4A, 0xF2, 0x23, 0x51, 0x77, 0xA4, 0x87, 0x2F, 0x26, 0x3F, 0xE2, 0x8F, 0x80,
-    0xE3, 0xEB, 0xDA, 0xBA, 0x24, 0x1F, 0xFA, 0x9A, 0x4C, 0xCD, 0xF3, 0x04, 0x9A, 0x7A, 0x3C, 0x9C,
-    0x2D, 0xB2, 0xF7, 0x30, 0x87, 0x97, 0x98, 0xBC, 0xC4, 0xE7, 0x25, 0x56, 0x2F, 0x71, 0x7B, 0x89,
-    0xE1, 0x4B, 0x3C, 0x5F, 0x62, 0xFB, 0x12, 0xE7, 0x97, 0x98, 0x0F, 0xC4, 0x17, 0xF9, 0x1F, 0x18,
-    0xBD, 0x28, 0x82, 0xE4, 0x9D, 0x66, 0x51, 0x0A, 0x57, 0xBD, 0x76, 0x51, 0x10, 0xBD, 0xF4, 0x0B,
-    0xB2, 0x78, 0xB9, 0xC5, 0x8B, 0xB9, 0x38, 0xCE, 0x35, 0x64, 0xE5, 0x4C, 0x22, 0xEE, 0xE7, 0x4C,
-    0x28, 0xDF, 0xAF, 0xE9, 0x99, 0x67, 0x72, 0x89, 0x2A, 0xA4, 0x5D, 0x73, 0xD1, 0x00, 0x44, 0xBB,
-    0x20, 0x1D, 0x42, 0x5C, 0x10, 0x50, 0xAC, 0xC3, 0x7A, 0x41, 0x46, 0x91, 0x06, 0xDB, 0xE6, 0x62,
-    0x0A, 0x2B, 0x48, 0x7F, 0x2E, 0xA9, 0xE0, 0xDF, 0x77, 0x0E, 0x09, 0xAB, 0x6C, 0x0F, 0xC9, 0x6B,
-    0x1D, 0x5F, 0xFA, 0xA0, 0x0B, 0x9B, 0xA8, 0x26, 0x03, 0x13, 0x1B, 0xCF, 0xF8, 0x2E, 0x6A, 0x82,
-    0x2E, 0xAE, 0xC3, 0x26, 0xD1, 0x51, 0x9D, 0x16, 0x24, 0x3E, 0x2E, 0xB6, 0x11, 0x7D, 0xF7, 0x30,
-    0xE3, 0x36, 0xE6, 0x38, 0x49, 0x70, 0x5E, 0xAA, 0x39, 0x33, 0x2B, 0x38, 0x17, 0xE4, 0x60, 0x36,
-    0xB9, 0x9F, 0x21, 0x60, 0x71, 0x45, 0xC7, 0x35, 0x5E, 0xC3, 0x55, 0x08, 0x3E, 0x58, 0x17, 0x4C,
-    0xC5, 0x9F, 0x16, 0xA9, 0x4E, 0x80, 0x7B, 0x04, 0x39, 0x06, 0x95, 0x5F, 0x33, 0x9A, 0xA5, 0x45,
-    0x29, 0xA9, 0x2E, 0x21, 0xAE, 0xDC, 0xC2, 0x88, 0x40, 0x4C, 0x88, 0xB8, 0x1F, 0xA0, 0xF9, 0x75,
-    0x54, 0x78, 0x75, 0x50, 0xB8, 0xB5, 0xA5, 0xDF, 0x63, 0xA2, 0xDF, 0x73, 0x66, 0xCF, 0xA9, 0x13,
-    0xCE, 0xBD, 0xC3, 0xC9, 0x67, 0x39, 0x7B, 0x9B, 0xD3, 0x37, 0x39, 0xFF, 0x29, 0xB7, 0xDD, 0xD3,
-    0x42, 0xDD, 0x82, 0xFE, 0x19, 0xE5, 0x3D, 0xD2, 0xC1, 0xA7, 0x55, 0xF8, 0x97, 0x26, 0x2A, 0x9A,
-    0x58, 0x6E, 0x6F, 0xCA, 0xD6, 0x96, 0x6C, 0x92, 0x1D, 0x01, 0xB9, 0x08, 0x6D, 0x81, 0x6C, 0xA2,
-    0x86, 0x11, 0x39, 0x2F, 0xA4, 0x54, 0x8C, 0x2A, 0x89, 0x66, 0xA0, 0x46, 0x80, 0x03, 0x29, 0x4C,
-    0x65, 0x5D, 0x20, 0xDE, 0xA3, 0xCC, 0x68, 0x6D, 0xF8, 0x1C, 0xD7, 0x5C, 0x13, 0x37, 0x8C, 0x9D,
-    0x77, 0x05, 0xA6, 0x83, 0xC9, 0x08, 0x79, 0x36, 0x7E, 0xDA, 0x15, 0xDF, 0x10, 0x7F, 0x22, 0x52,
-    0x64, 0x12, 0x4C, 0xA8, 0x16, 0x1A, 0xBF, 0x20, 0xC9, 0x06, 0xDF, 0x32, 0x17, 0xA6, 0x7B, 0x8B,
-    0x1E, 0x0D, 0x2D, 0x29, 0xAC, 0x95, 0x40, 0xCC, 0xB4, 0x58, 0xCF, 0x1A, 0x25, 0xB4, 0x98, 0x9F,
-    0x4E, 0x49, 0xF2, 0x1B, 0xED, 0x5F, 0xCB, 0x55, 0x88, 0x88, 0xD5, 0x94, 0x05, 0x56, 0xC6, 0x6D,
-    0xA9, 0x02, 0x44, 0xAC, 0x76, 0x53, 0xE2, 0x8F, 0xB5, 0x0D, 0xC2, 0xA1, 0x15, 0x4F, 0x6F, 0xC1,
-    0x62, 0x55, 0x2E, 0xCE, 0x90, 0xB5, 0x4D, 0x29, 0xF8, 0xB1, 0xB7, 0xA9, 0x01, 0x3E, 0xBD, 0x21,
-    0xE4, 0x34, 0xA2, 0x21, 0x85, 0x07, 0xCC, 0xC2, 0xFA, 0x5B, 0xC4, 0xD3, 0xD3, 0x63, 0x88, 0x97,
-    0xA4, 0x8E, 0xC9, 0x0A, 0x4B, 0x58, 0x52, 0xB3, 0xAB, 0xC0, 0x90, 0x54, 0x4B, 0x8E, 0x88, 0x88,
-    0xC5, 0x60, 0x4E, 0x49, 0x27, 0x33, 0x10, 0xF4, 0x84, 0x5B, 0xF5, 0x4C, 0x7D, 0x7A, 0x58, 0x99,
-    0x47, 0x8B, 0x80, 0xDE, 0x76, 0xEC, 0x60, 0x5B, 0x35, 0x98, 0x17, 0x54, 0xEC, 0x34, 0x74, 0x21,
-    0xD4, 0x70, 0x0C, 0x9E, 0xF2, 0x16, 0xBD, 0x46, 0xA2, 0x90, 0x2A, 0xE4, 0x1A, 0x79, 0x10, 0x22,
-    0x6D, 0xCD, 0xAE, 0xE2, 0x3E, 0x05, 0xD2, 0xA6, 0xB5, 0x71, 0x4A, 0x6E, 0x40, 0x7A, 0xD9, 0x24,
-    0x75, 0xD8, 0x65, 0xC0, 0x1B, 0x3B, 0x4F, 0xB0, 0xF1, 0x70, 0x3A, 0xD5, 0x83, 0xA4, 0xF7, 0x26,
-    0x92, 0xFD, 0x12, 0x76, 0x73, 0x0E, 0x29, 0x01, 0x30, 0xBE, 0x4A, 0x0C, 0x47, 0xA5, 0x1F, 0x94,
-    0x23, 0xA8, 0x9D, 0xE7, 0x4E, 0x72, 0x7E, 0xBE, 0x73, 0x08, 0x82, 0x13, 0xBC, 0xCF, 0xD8, 0xF0,
-    0x8D, 0xBC, 0xF2, 0xC6, 0x34, 0xF7, 0x86, 0xCD, 0xF6, 0x39, 0xBA, 0x3E, 0x9D, 0xEE, 0x92, 0x8C,
-    0x50, 0x39, 0xF1, 0x6E, 0xB8, 0xD4, 0x09, 0xF4, 0x06, 0x0F, 0xF0, 0xDC, 0x85, 0x5F, 0x2A, 0x1F,
-    0xEE, 0x97, 0xF4, 0x8D, 0x11, 0x96, 0xDA, 0x24, 0xFA, 0x99, 0xFD, 0xDF, 0xBB, 0xA5, 0xAE, 0x5A,
-    0xF0, 0x4A, 0x63, 0x3E, 0x1B, 0x53, 0x6B, 0x24, 0x33, 0x62, 0xAE, 0x61, 0x5D, 0x4D, 0x91, 0x5B,
-    0x81, 0x27, 0x76, 0xEA, 0xE6, 0xB8, 0x4F, 0x64, 0xD3, 0x50, 0x87, 0x10, 0x2B, 0x1D, 0x71, 0x6E,
-    0xF2, 0x60, 0x54, 0x43, 0x97, 0xDB, 0x59, 0x37, 0x1B, 0xE9, 0x69, 0xA6, 0x95, 0x7E, 0xD9, 0x34,
-    0x76, 0x11, 0x39, 0x11, 0x53, 0x3B, 0xD2, 0x6D, 0x4E, 0xE3, 0x76, 0x07, 0xA4, 0xA1, 0x05, 0x1F,
-    0xFC, 0x06, 0x3A, 0x64, 0xE5, 0x04, 0x68, 0x1D, 0xA1, 0xED, 0x11, 0xDA, 0x36, 0xA1, 0x25, 0x84,
-    0xE6, 0x1C, 0xED, 0x73, 0x73, 0xDF, 0xEB, 0xBC, 0x79, 0x31, 0xFA, 0xEE, 0xA8, 0xDE, 0x1B, 0x07,
-    0xDD, 0x65, 0xCF, 0x8D, 0xEE, 0x5E, 0xDA, 0x75, 0x62, 0x8E, 0x1F, 0x19, 0xBB, 0xD8, 0x7B, 0xCD,
-    0xFC, 0x43, 0xB9, 0x7A, 0x67, 0x32, 0xBA, 0x83, 0xBF, 0xDF, 0x77, 0xEE, 0xFC, 0x94, 0xFF, 0xC1,
-    0xF8, 0x2A, 0xD0, 0x66, 0x2A, 0x9C, 0xAD, 0x69, 0x4C, 0x70, 0x6A, 0xA0, 0x8E, 0x69, 0xA7, 0x10,
-    0xBD, 0xD3, 0xEC, 0x27, 0x29, 0xDA, 0xEB, 0xC0, 0x2B, 0x29, 0x1A, 0xB0, 0x2F, 0x06, 0xB8, 0x1A,
-    0x2E, 0x73, 0xC0, 0x20, 0x7C, 0x50, 0xDD, 0x95, 0xFC, 0x0F, 0x51, 0x2D, 0xF9, 0x7D, 0x23, 0xE1,
-    0x60, 0x1A, 0x79, 0xDD, 0x0C, 0xB2, 0x0E, 0xB1, 0x18, 0x64, 0x90, 0x31, 0xB9, 0x5F, 0x7E, 0x5A,
-    0x4A, 0x34, 0x7C, 0xAF, 0x91, 0xCB, 0xE1, 0xAB, 0x75, 0x58, 0x5C, 0x82, 0xE0, 0xE2, 0x73, 0x00,
-    0xDD, 0x42, 0x7F, 0x62, 0x05, 0xD6, 0xB5, 0x60, 0x42, 0xAA, 0x50, 0xA3, 0xB4, 0x9E, 0xE3, 0xAC,
-    0xBF, 0x98, 0x46, 0xAC, 0xEF, 0xEC, 0x24, 0x66, 0x48, 0xCD, 0x24, 0x33, 0xBD, 0xBD, 0xBB, 0x8B,
-    0xFB, 0xEF, 0x5A, 0xF7, 0x68, 0x29, 0xB2, 0x32, 0x71, 0x99, 0x2F, 0xDD, 0xC5, 0x54, 0x22, 0x9E,
-    0x05, 0xE1, 0x82, 0xA3, 0x8B, 0x89, 0x2E, 0x62, 0x39, 0x2E, 0x5A, 0xDB, 0x73, 0xBB, 0xB8, 0x30,
-    0xE7, 0x98, 0xEE, 0xA6, 0xEC, 0x4D, 0x1D, 0x90, 0xCB, 0xB9, 0xBF, 0x6E, 0x8B, 0xFA, 0xE8, 0x2D,
-    0xC4, 0xDB, 0x7F, 0x0F, 0x01, 0x0F, 0xDE, 0x08, 0xF4, 0x86, 0xD8, 0x10, 0xFE, 0x8B, 0x0E, 0x8C,
-    0xAE, 0xCC, 0x96, 0x24, 0x09, 0xCB, 0x12, 0x3D, 0x2F, 0x49, 0x72, 0xE5, 0x2A, 0x9B, 0x12, 0x8D,
-    0x92, 0x31, 0xFB, 0xE2, 0x81, 0x95, 0x4C, 0xA5, 0x59, 0x04, 0x04, 0x9D, 0xAB, 0x03, 0x50, 0x74,
-    0x1D, 0x02, 0x45, 0x30, 0x34, 0xA7, 0x74, 0x5A, 0xD9, 0x10, 0x14, 0xC6, 0x25, 0x54, 0x81, 0x6D,
-    0x86, 0x87, 0x84, 0x53, 0x48, 0x23, 0x34, 0x42, 0xA2, 0xB7, 0x5A, 0x86, 0xB6, 0x88, 0x14, 0x1C,
-    0xC0, 0x45, 0x88, 0xD0, 0x96, 0xDC, 0x6C, 0xA0, 0x05, 0x79, 0xBB, 0xF5, 0xA8, 0xFE, 0x12, 0xA8,
-    0x68, 0x0A, 0xAA, 0x9E, 0x83, 0x02, 0x22, 0x39, 0x42, 0x63, 0x69, 0x8A, 0x05, 0x81, 0xE6, 0x70,
-    0x16, 0x11, 0xCC, 0x13, 0x8E, 0x06, 0x6A, 0xF3, 0x68, 0x10, 0x7A, 0x1B, 0x6F, 0x10, 0x94, 0x9C,
-    0x9A, 0xE1, 0x12, 0x08, 0xD0, 0xEF, 0xC0, 0x94, 0x92, 0x8A, 0xCE, 0x07, 0x83, 0xB8, 0x82, 0x5D,
-    0x0E, 0xF0, 0x2A, 0x04, 0x4A, 0x04, 0xEC, 0xC0, 0x56, 0x19, 0xC4, 0x94, 0x28, 0x30, 0x9A, 0x58,
-    0x32, 0x2C, 0x9E, 0xE4, 0x00, 0xE9, 0xF5, 0xE9, 0x25, 0xD2, 0xDA, 0x35, 0xFB, 0x83, 0x8D, 0xE8,
-    0x59, 0x01, 0xC7, 0x32, 0xD6, 0x7B, 0xC9, 0x54, 0x9E, 0x9B, 0xD3, 0x3A, 0x8E, 0xBE, 0xC7, 0x7A,
-    0xCF, 0x13, 0x47, 0x1D, 0x24, 0xB8, 0xCA, 0x8B, 0x15, 0x23, 0xDD, 0x9A, 0x05, 0x4C, 0xDF, 0x16,
-    0x70, 0x6F, 0x3A, 0x38, 0x0A, 0xDD, 0x8A, 0xC5, 0xE2, 0x68, 0xED, 0xF4, 0xF8, 0x12, 0x0B, 0xF2,
-    0xC2, 0x32, 0xA0, 0x2C, 0x48, 0x3E, 0xE2, 0x26, 0x89, 0x07, 0xEE, 0x24, 0xDD, 0xB9, 0xFB, 0x01,
-    0x84, 0x5A, 0xB2, 0x2D, 0x88, 0x89, 0x85, 0xE4, 0xF7, 0xBE, 0x2D, 0x0D, 0x3B, 0x5B, 0x12, 0xC6,
-    0x8D, 0xF5, 0x37, 0x39, 0x33, 0x18, 0x22, 0x11, 0x3A, 0x42, 0xA9, 0xD2, 0x83, 0x53, 0xDB, 0xD6,
-    0xA9, 0x76, 0x63, 0xDD, 0x16, 0x09, 0x8C, 0x1D, 0x79, 0xB1, 0x23, 0x6E, 0xFD, 0x28, 0xB2, 0xAE,
-    0x58, 0xA2, 0x50, 0xB3, 0x91, 0x24, 0xDF, 0x58, 0x82, 0xF8, 0x00, 0x39, 0x56, 0xF6, 0x4B, 0xB4,
-    0x20, 0x6C, 0xED, 0x52, 0xBE, 0x29, 0x0A, 0x3B, 0x86, 0x82, 0x4C, 0xC7, 0x2D, 0xF5, 0xC2, 0xC6,
-    0xB2, 0x41, 0x5C, 0x38, 0x2B, 0xA9, 0xDF, 0xB0, 0x20, 0x3E, 0xE1, 0x70, 0xF9, 0xA4, 0x9E, 0x53,
-    0x56, 0x36, 0xC7, 0x1D, 0x18, 0xDD, 0x1C, 0xB7, 0x48, 0x66, 0xD4, 0xBA, 0x27, 0x92, 0x04, 0xB8,
-    0x7D, 0xE0, 0xA2, 0xAC, 0xB5, 0x26, 0xAD, 0xB3, 0xDA, 0x5C, 0x39, 0xBB, 0x3B, 0x18, 0x4D, 0xFC,
-    0xB6, 0xB8, 0x12, 0xBD, 0x1D, 0x43, 0x4D, 0x33, 0xCA, 0xEE, 0xFC, 0x11, 0x82, 0x03, 0x12, 0x56,
-    0xBE, 0xD0, 0x90, 0x98, 0xF3, 0x4B, 0x6D, 0xC1, 0xDA, 0xA7, 0x65, 0xA6, 0x72, 0xEA, 0xB1, 0x36,
-    0x8A, 0xCD, 0x5E, 0xDB, 0xCA, 0xFB, 0x91, 0x66, 0x9C, 0x72, 0x5D, 0x64, 0x0F, 0x6B, 0x76, 0x2E,
-    0xC4, 0xF3, 0xCA, 0x7B, 0x66, 0xFE, 0xD9, 0xCC, 0x4B, 0x9C, 0x9D, 0x39, 0x93, 0x83, 0x99, 0xCF,
-    0xE9, 0x5C, 0x20, 0x1B, 0x95, 0xCD, 0x85, 0x8C, 0xE9, 0xA9, 0x81, 0x73, 0x45, 0x2E, 0xC6, 0xE8,
-    0xA9, 0x4F, 0x5A, 0x82, 0x7E, 0x46, 0x50, 0x1F, 0xEF, 0xFF, 0x11, 0x8C, 0x34, 0xF4, 0xAF, 0xE1,
-    0x83, 0x5D, 0xD3, 0x03, 0x16, 0x1C, 0x24, 0xA8, 0x4E, 0x68, 0xA6, 0xEC, 0xD5, 0x97, 0xF4, 0x0B,
-    0x73, 0xDC, 0xFC, 0xDE, 0xF6, 0xAC, 0xDB, 0x92, 0xF7, 0x14, 0x7B, 0x6B, 0x0F, 0xAB, 0xEF, 0xFD,
-    0x86, 0xDE, 0xF3, 0xB5, 0x26, 0x41, 0x50, 0x2E, 0x9B, 0x59, 0x59, 0x83, 0x70, 0xBD, 0xB3, 0x73,
-    0x21, 0x04, 0x29, 0x43, 0x62, 0x1E, 0xDE, 0xAC, 0x32, 0x83, 0x79, 0x39, 0x3A, 0x90, 0xF7, 0x25,
-    0x9D, 0xFD, 0xCA, 0x79, 0x05, 0x62, 0x8B, 0x79, 0xE0, 0x73, 0x2D, 0x81, 0x58, 0x86, 0x54, 0xE1,
-    0xC3, 0x9B, 0xA6, 0xF5, 0x2C, 0x61, 0xE8, 0x26, 0x8E, 0xD0, 0xC7, 0x3B, 0xFB, 0xA1, 0x07, 0x52,
-    0xA6, 0xDB, 0x35, 0xF6, 0x3C, 0xC4, 0x66, 0x09, 0x17, 0x5C, 0x35, 0x83, 0xC4, 0x83, 0x61, 0xB8,
-    0x62, 0xD7, 0xDE, 0xF2, 0xA1, 0xF4, 0xEF, 0xE7, 0x36, 0x95, 0x50, 0xEB, 0x8C, 0xAB, 0x19, 0xB9,
-    0x96, 0xFD, 0xED, 0xE3, 0x42, 0x9E, 0x0F, 0xFE, 0x4A, 0xDF, 0x77, 0xCF, 0xDA, 0xDA, 0xDE, 0x28,
-    0xB5, 0x27, 0x67, 0x05, 0xD8, 0x71, 0x6F, 0x12, 0x0C, 0xF8, 0x9B, 0xC8, 0x91, 0x67, 0x91, 0x7E,
-    0x1D, 0x77, 0x69, 0x97, 0xB5, 0xEE, 0x44, 0xEE, 0xDB, 0x10, 0xB7, 0xCF, 0x13, 0xB9, 0xF1, 0xA3,
-    0x45, 0x28, 0xE5, 0xE9, 0x91, 0x37, 0x28, 0xAF, 0x54, 0xA1, 0x8D, 0x1A, 0x48, 0x5D, 0x11, 0x25,
-    0xAD, 0x76, 0x1D, 0xDC, 0x9E, 0x87, 0xA3, 0x95, 0x5D, 0x36, 0xF7, 0xDE, 0xB0, 0xC5, 0xDC, 0x1E,
-    0xCB, 0x5C, 0xAF, 0xE5, 0x01, 0x5A, 0x54, 0x33, 0xB7, 0x2E, 0x91, 0x3B, 0x3E, 0x2C, 0x31, 0x38,
-    0x66, 0x98, 0x4E, 0xC9, 0xBA, 0xCB, 0xB4, 0xD4, 0x98, 0xF5, 0xBC, 0xC0, 0x2E, 0xA7, 0x1E, 0xE7,
-    0x1F, 0xE8, 0x13, 0x12, 0xFD, 0x0B, 0x99, 0xA2, 0x94, 0x65, 0x2F, 0x27, 0x4B, 0x73, 0xC3, 0x67,
-    0x9A, 0xE6, 0x99, 0x1F, 0x80, 0x53, 0xF5, 0x69, 0x9E, 0xC5, 0x6D, 0x32, 0x52, 0x6C, 0x33, 0x82,
-    0x5F, 0x61, 0xA1, 0xF4, 0xF3, 0x19, 0x06, 0xD7, 0xC6, 0xBC, 0xE3, 0x29, 0x32, 0x2D, 0x2D, 0x58,
-    0x17, 0x7F, 0x52, 0xAF, 0x89, 0xFF, 0xE0, 0x43, 0xA4, 0xBD, 0xD9, 0x7D, 0xA4, 0x16, 0xBB, 0xE6,
-    0x3D, 0xA1, 0xEE, 0x4B, 0xF9, 0x3B, 0x54, 0x0F, 0x97, 0xA2, 0x57, 0xE9, 0xE3, 0xE8, 0x70, 0x12,
-    0xDA, 0x7D, 0x46, 0xDF, 0xF4, 0xEC, 0xAC, 0xE8, 0xD5, 0x1B, 0x49, 0xBD, 0x95, 0x34, 0x7B, 0x49,
-    0x7D, 0xFB, 0x98, 0x6A, 0x68, 0x75, 0xD8, 0x13, 0xAE, 0x22, 0x64, 0xEA, 0x41, 0x2F, 0x78, 0xDA,
-    0xDA, 0xE9, 0x96, 0xF5, 0x21, 0x2D, 0x3D, 0x87, 0xCF, 0xEC, 0x8C, 0xDF, 0x91, 0x2B, 0xE3, 0x7B,
-    0xE2, 0x29, 0xE0, 0xBA, 0x15, 0x37, 0x7B, 0x71, 0x73, 0x2B, 0xB2, 0xF9, 0xE3, 0xBB, 0xE2, 0x43,
-    0xF9, 0x00, 0x25, 0xBD, 0x59, 0x85, 0xFA, 0x6C, 0xD0, 0x46, 0xC5, 0x96, 0x0C, 0xBB, 0xCC, 0xE3,
-    0x06, 0xB9, 0x2C, 0xC7, 0x68, 0xDE, 0xCF, 0x18, 0x66, 0xC4, 0x42, 0xD5, 0xA6, 0x5F, 0xCB, 0x1F,
-    0xEE, 0xFC, 0x10, 0x1E, 0xC3, 0x67, 0xFE, 0x8A, 0x58, 0x69, 0x4F, 0xEC, 0x6C, 0xB1, 0x67, 0x73,
-    0x07, 0x1E, 0xEF, 0xF0, 0x03, 0x60, 0x5F, 0x1F, 0xFD, 0x83, 0xFF, 0x76, 0xF3, 0x22, 0x6A, 0xA2,
-    0xE6, 0x0E, 0x78, 0xFB, 0x4F, 0x3A, 0xC5, 0x4F, 0xB1, 0xF5, 0xE6, 0x7D, 0x25, 0x3F, 0x7B, 0x65,
-    0xF2, 0xCD, 0x82, 0x07, 0xC3, 0x3A, 0xFF, 0xD3, 0x00, 0x9F, 0x15, 0x33, 0xE2, 0x5C, 0xF9, 0xBC,
-    0x12, 0xBF, 0xFB, 0xA2, 0x83, 0xA4, 0x9A, 0x41, 0x82, 0x7B, 0xCD, 0x16, 0x1D, 0xCC, 0xF1, 0xD1,
-    0xD5, 0x4C, 0x2B, 0x42, 0x7B, 0xEA, 0x58, 0x8D, 0x01, 0xCA, 0x8D, 0xA2, 0x85, 0xF2, 0xE0, 0x09,
-    0x99, 0x1E, 0x4D, 0xE6, 0xB3, 0xCE, 0xFE, 0x5C, 0x3F, 0xCA, 0x87, 0x3E, 0x06, 0x2A, 0xD5, 0x0B,
-    0x35, 0x6B, 0x29, 0xAE, 0x6A, 0x45, 0x4A, 0x68, 0xEB, 0xD6, 0xDE, 0x55, 0xAE, 0x48, 0xBD, 0x6D,
-    0xED, 0x0A, 0x45, 0xB7, 0xD5, 0x2B, 0x5C, 0x9F, 0xAD, 0x5F, 0x21, 0x10, 0x5B, 0xC1, 0x22, 0xFA,
-    0xD8, 0x1A, 0x36, 0x5A, 0xDC, 0xCC, 0xE5, 0xA4, 0xB9, 0xC5, 0xB4, 0xB4, 0x9B, 0xB8, 0x83, 0xF2,
-    0xB2, 0x90, 0x31, 0x5E, 0x2F, 0x5E, 0xA7, 0x6C, 0x63, 0x2E, 0x50, 0x16, 0x9C, 0x6D, 0xB4, 0xEB,
-    0xDD, 0x9B, 0x53, 0xE3, 0x8C, 0xC5, 0xCB, 0x41, 0x70, 0xD0, 0x46, 0xC8, 0x7A, 0xBE, 0xE3, 0xDA,
-    0x0C, 0x0B, 0x97, 0x5C, 0xD9, 0xD4, 0x4A, 0xCF, 0xFB, 0x5C, 0x9F, 0x56, 0x8F, 0x63, 0xF1, 0x84,
-    0xCC, 0x98, 0x39, 0x42, 0x73, 0xBD, 0x7B, 0xB3, 0x7E, 0x04, 0x3B, 0x37, 0xC5, 0x41, 0x5B, 0x84,
-    0x3F, 0x4D, 0xE7, 0xC6, 0x42, 0x40, 0xF1, 0x84, 0x34, 0xD7, 0xA9, 0xFA, 0x7A, 0x3B, 0x7E, 0x46,
-    0x38, 0x97, 0x10, 0xE6, 0x7B, 0xE5, 0xB6, 0x77, 0x99, 0xD8, 0x62, 0x7F, 0xF5, 0xBF, 0xF4, 0x0D,
-    0xDB, 0x76, 0x2E, 0xD7, 0x18, 0x45, 0x3E, 0x99, 0xC2, 0x8D, 0xF3, 0x19, 0xEC, 0xAF, 0xBF, 0x1C,
-    0x9F, 0x8C, 0x5A, 0xC6, 0x61, 0x79, 0x7D, 0x5A, 0xC4, 0xA8, 0x08, 0x90, 0x49, 0xF0, 0xBF, 0x1D,
-    0xF3, 0x1E, 0xD4, 0xC4, 0x96, 0x7B, 0xF1, 0x68, 0x38, 0xF3, 0x3E, 0x99, 0xFE, 0x77, 0x47, 0xBB,
-    0xFE, 0xA8, 0x39, 0xEC, 0x9F, 0x44, 0xFF, 0x84, 0x3C, 0x06, 0x59, 0x27, 0x2A, 0xB6, 0x07, 0x7B,
-    0x69, 0x91, 0x57, 0x79, 0xC5, 0xDF, 0x87, 0x25, 0x94, 0x69, 0xBE, 0x4F, 0x8B, 0x43, 0x5C, 0x1E,
-    0xDF, 0x66, 0x7A, 0xDD, 0xD2, 0x00, 0x8E, 0x68, 0x53, 0x38, 0x97, 0xFC, 0x3C, 0x34, 0x8A, 0x1C,
-    0x2A, 0xD5, 0xA8, 0xBF, 0xE3, 0xD7, 0xCD, 0x43, 0x5F, 0x73, 0x7C, 0xE5, 0x69, 0xEC, 0xC3, 0x62,
-    0xF1, 0x08, 0xF5, 0xE4, 0xBF, 0xD5, 0x4A, 0xCF, 0x91, 0xAB, 0x37, 0x65, 0x7E, 0xBF, 0xB5, 0xBA,
-    0xA3, 0xDE, 0xCC, 0xE8, 0xD4, 0xD0, 0x15, 0x46, 0x03, 0x2B, 0x01, 0x66, 0xA6, 0x2B, 0x3C, 0xB6,
-    0xB7, 0x99, 0x39, 0x8B, 0xFE, 0x9E, 0xFF, 0x2F, 0xC5, 0x2E, 0xD8, 0x0B, 0x3B, 0xAE, 0xEA, 0x5F,
-    0xA6, 0xC0, 0x36, 0xFA, 0xB3, 0x6C, 0x84, 0xC5, 0x56, 0xA0, 0xE3, 0xD7, 0x6D, 0x25, 0xB3, 0x22,
-    0xCC, 0xF3, 0x5A, 0xCE, 0x1C, 0x7E, 0xB3, 0x42, 0x81, 0xFE, 0x07, 0xAD, 0x55, 0x31, 0x8F, 0xDC,
-    0x44, 0x14, 0xFE, 0xC6, 0x4E, 0xCE, 0xE2, 0xAC, 0xC8, 0x29, 0x92, 0xE6, 0x0E, 0x9D, 0x5B, 0x74,
-    0x90, 0x73, 0x73, 0x05, 0x48, 0xBB, 0xEB, 0x41, 0x48, 0xD0, 0x52, 0xDC, 0x56, 0x34, 0x29, 0x52,
-    0xA0, 0x03, 0x11, 0x0A, 0x8A, 0x2B, 0x9C, 0xB3, 0xF3, 0x0B, 0xB8, 0x86, 0xFE, 0x8A, 0x14, 0x61,
-    0x53, 0x5C, 0x8A, 0x2B, 0x0E, 0xB1, 0x5A, 0x4F, 0x68, 0x23, 0x21, 0xF3, 0x0F, 0x8C, 0x04, 0x11,
-    0xA2, 0x61, 0x0A, 0x07, 0x9C, 0x9C, 0x77, 0xCD, 0xF7, 0xEC, 0x5D, 0x92, 0x90, 0x13, 0x15, 0xF6,
-    0x3C, 0xAF, 0x77, 0xC6, 0xF3, 0xDE, 0xF7, 0xDE, 0xFB, 0xDE, 0x1B, 0xAC, 0x3D, 0x03, 0xE2, 0x36,
-    0x43, 0x13, 0x94, 0xAE, 0xF5, 0xAC, 0xCF, 0x67, 0x60, 0xDC, 0x2A, 0xA4, 0x44, 0x99, 0x67, 0x63,
-    0x11, 0xED, 0x53, 0x82, 0x92, 0x62, 0x62, 0x1D, 0x65, 0xB1, 0x8E, 0x11, 0x9A, 0x06, 0x7E, 0x6B,
-    0xA1, 0x66, 0x1A, 0x8A, 0x7B, 0x9C, 0x02, 0xBC, 0x52, 0x13, 0x98, 0x20, 0x0B, 0x74, 0x80, 0x10,
-    0x3B, 0x18, 0x62, 0x20, 0xF7, 0xD5, 0xB8, 0xBC, 0xCC, 0xB5, 0xF5, 0x8C, 0x86, 0x0C, 0x90, 0x1B,
-    0x38, 0xB4, 0xE7, 0xA7, 0x1A, 0x5B, 0x31, 0x70, 0x90, 0x72, 0x7F, 0x0E, 0xD7, 0x2C, 0x10, 0x60,
-    0x4E, 0x28, 0x6D, 0xBD, 0xFD, 0x60, 0x71, 0x0F, 0x4E, 0x0D, 0xB8, 0x22, 0x15, 0xB7, 0xB4, 0x1A,
-    0xE3, 0x31, 0xB0, 0x3D, 0x39, 0xE6, 0xBB, 0x45, 0xDB, 0x96, 0x28, 0x50, 0x28, 0x03, 0xED, 0x52,
-    0xA3, 0x4B, 0xCD, 0x5E, 0x4B, 0x3C, 0xDF, 0xB4, 0xB4, 0x13, 0xF3, 0x5F, 0x68, 0x2E, 0x51, 0x06,
-    0x88, 0xCC, 0x21, 0x88, 0x56, 0xE7, 0x08, 0xDB, 0x1A, 0x6A, 0xC2, 0xA5, 0xB5, 0xDF, 0x08, 0xB3,
-    0x85, 0x6A, 0x02, 0x7A, 0x46, 0xA4, 0xC5, 0x1B, 0xFC, 0x92, 0xBB, 0x3E, 0xD4, 0xB4, 0x5D, 0x23,
-    0xFD, 0x69, 0x8E, 0x1C, 0x33, 0xDE, 0xFD, 0x73, 0x86, 0x05, 0x0E, 0xD1, 0x20, 0x26, 0x96, 0x80,
-    0x66, 0xD5, 0x73, 0x7A, 0x32, 0x99, 0xE8, 0xA8, 0x6D, 0x33, 0x62, 0xD5, 0xBB, 0xD8, 0xC2, 0x97,
-    0xF4, 0x12, 0x38, 0x05, 0x94, 0x25, 0x18, 0x2A, 0xF3, 0x05, 0x02, 0xA7, 0x86, 0x94, 0xB3, 0xE5,
-    0x74, 0xF1, 0x62, 0xFA, 0xBA, 0x84, 0xCA, 0x5F, 0xD0, 0xAF, 0x93, 0x42, 0x35, 0x9E, 0x75, 0x6B,
-    0xD7, 0xBA, 0x15, 0xA5, 0xF1, 0x0A, 0xB5, 0x88, 0x34, 0x72, 0xFA, 0x9D, 0xCE, 0xE1, 0x3D, 0x6D,
-    0x75, 0x68, 0x62, 0xC6, 0x9C, 0x4F, 0x30, 0xF6, 0x08, 0x33, 0x46, 0x1F, 0xC1, 0x79, 0x43, 0x5F,
-    0x8E, 0x80, 0xCD, 0x63, 0xA8, 0x96, 0xDF, 0x59, 0xCE, 0x15, 0x61, 0x16, 0x9A, 0xD0, 0x44, 0x4B,
-    0x91, 0x67, 0x50, 0xE6, 0x99, 0x47, 0x8C, 0xF8, 0x36, 0xA5, 0xC1, 0x19, 0x2E, 0xD1, 0x8F, 0x81,
-    0x53, 0xE1, 0x8E, 0x57, 0x76, 0x29, 0x5F, 0xA7, 0x19, 0xBC, 0xF3, 0xBA, 0x4C, 0x66, 0x13, 0xDD,
-    0xCA, 0xBE, 0x0B, 0xD6, 0xA8, 0x04, 0x93, 0xC9, 0x72, 0x9D, 0xD7, 0x98, 0x79, 0x59, 0xBD, 0xBF,
-    0x7C, 0xE5, 0x9C, 0x5B, 0xCD, 0xD3, 0xFF, 0xB0, 0x64, 0x3C, 0x9D, 0x86, 0x50, 0x89, 0x94, 0x69,
-    0x61, 0x56, 0x40, 0x50, 0xB9, 0xC0, 0x62, 0xD6, 0x5F, 0x0C, 0xFE, 0xE5, 0x3C, 0x79, 0x11, 0x92,
-    0x22, 0x05, 0x1C, 0x86, 0xEE, 0x66, 0xA7, 0xF0, 0x06, 0xC0, 0xC8, 0x70, 0xCA, 0xB5, 0xC2, 0x09,
-    0xD2, 0x43, 0x35, 0xC0, 0x6A, 0xA8, 0x6E, 0x70, 0x92, 0x4B, 0x62, 0xA3, 0x94, 0xA4, 0xD2, 0x06,
-    0x83, 0x53, 0x21, 0xCA, 0xF0, 0x6E, 0x8F, 0x2A, 0xFD, 0xA1, 0x46, 0xF8, 0xE3, 0x21, 0x82, 0x87,
-    0x3B, 0x8C, 0x27, 0x45, 0x0F, 0x99, 0x91, 0x01, 0xB9, 0x9A, 0x30, 0x59, 0x67, 0x7C, 0xAB, 0xF8,
-    0x56, 0xF1, 0xAD, 0xD2, 0x15, 0x72, 0xE6, 0xEB, 0xDA, 0x8A, 0x31, 0xDA, 0xA9, 0x43, 0xE3, 0x95,
-    0x41, 0x19, 0x18, 0xDF, 0x86, 0x94, 0x38, 0xF3, 0xBB, 0xCA, 0x48, 0x69, 0x8D, 0x52, 0xE4, 0xD4,
-    0x48, 0x9E, 0x65, 0x29, 0xD1, 0xC7, 0xE4, 0x4C, 0x7C, 0xB7, 0xE9, 0x19, 0x33, 0x13, 0xCB, 0x9F,
-    0x0A, 0x99, 0x6F, 0x57, 0xFE, 0x5F, 0xD6, 0xF9, 0xC8, 0xC2, 0xEF, 0x20, 0x32, 0x12, 0x81, 0x11,
-    0xA0, 0x04, 0x48, 0xD6, 0xAE, 0x42, 0x12, 0xB7, 0xCD, 0xF5, 0xF1, 0xDE, 0x0B, 0x82, 0xF8, 0x56,
-    0x91, 0x1C, 0xB0, 0x14, 0xF1, 0x4D, 0xB6, 0x49, 0x74, 0x30, 0xA2, 0xDA, 0xBA, 0x67, 0x96, 0xB0,
-    0xEA, 0x4C, 0x19, 0xA7, 0x74, 0x4C, 0xF0, 0xFB, 0x49, 0x47, 0xCC, 0xED, 0xC9, 0x84, 0x04, 0x61,
-    0x44, 0xDB, 0xDC, 0xB8, 0xB5, 0x14, 0x37, 0xF5, 0x10, 0x7E, 0xBF, 0x9F, 0xC5, 0xF7, 0x36, 0xF7,
-    0xC6, 0xC2, 0x80, 0x55, 0xD1, 0x44, 0x52, 0x30, 0x59, 0x42, 0x1C, 0xA9, 0x5A, 0x20, 0x62, 0x31,
-    0xAC, 0x4D, 0x24, 0x7F, 0x1B, 0x59, 0xBF, 0xCE, 0x64, 0xBA, 0xFC, 0x36, 0x20, 0xC8, 0x01, 0xE5,
-    0x74, 0x06, 0xA7, 0x98, 0xC3, 0xD7, 0x0D, 0xB6, 0x18, 0x7B, 0xDA, 0xAC, 0xF6, 0x1F, 0x2C, 0x8E,
-    0xBB, 0x82, 0x15, 0xA8, 0xF4, 0x91, 0xCC, 0x40, 0x57, 0xB8, 0xFB, 0x64, 0x6B, 0xDB, 0x16, 0x8A,
-    0xE2, 0x18, 0x65, 0x58, 0xB0, 0xDA, 0xA5, 0x6A, 0x4F, 0xEA, 0x80, 0x76, 0x82, 0xBE, 0x70, 0x75,
-    0x6F, 0x27, 0xEE, 0x30, 0x4C, 0x19, 0xC4, 0x5C, 0xCD, 0x89, 0xA3, 0xEA, 0x71, 0xFC, 0x0F, 0x85,
-    0xBB, 0xC1, 0x98, 0x48, 0x6C, 0x28, 0x2C, 0xDA, 0x1B, 0x38, 0xC6, 0x01, 0xED, 0x12, 0xA7, 0x74,
-    0x2F, 0x8F, 0xCA, 0x02, 0xFE, 0xDD, 0xA1, 0x24, 0x14, 0xBA, 0xE1, 0x94, 0xCB, 0x69, 0xDD, 0x4F,
-    0x5F, 0x93, 0x4C, 0x6E, 0xB2, 0x61, 0xB6, 0x27, 0x8C, 0xA9, 0xDF, 0x35, 0x4C, 0xDE, 0xA5, 0x5B,
-    0xB1, 0x65, 0xCE, 0x49, 0xDA, 0x56, 0x9A, 0x15, 0x1B, 0xD1, 0x93, 0x96, 0x5E, 0xA4, 0x9A, 0x54,
-    0xC8, 0x66, 0x8C, 0xE9, 0x21, 0xA9, 0xCB, 0xA8, 0x22, 0x3C, 0x97, 0x26, 0x44, 0x65, 0x9F, 0x1D,
-    0x31, 0x94, 0xC4, 0x55, 0xCE, 0x20, 0xA5, 0x2D, 0x2D, 0xEA, 0xA5, 0x1B, 0xD1, 0xA3, 0x96, 0x98,
-    0xE9, 0xEB, 0x7D, 0xE6, 0x8F, 0x3E, 0x5C, 0x25, 0xB1, 0x4F, 0x19, 0xD3, 0x86, 0x74, 0xC9, 0x19,
-    0xAA, 0xCD, 0x5F, 0xD0, 0x63, 0xFD, 0x97, 0x6C, 0x9F, 0x4C, 0x24, 0xF7, 0xE6, 0xA2, 0x35, 0x5C,
-    0x96, 0xFE, 0xB9, 0x5C, 0x97, 0x26, 0x34, 0x1E, 0xEB, 0xD5, 0xFB, 0xCB, 0x97, 0xCC, 0xFD, 0x33,
-    0xFF, 0x39, 0xBC, 0x1A, 0x51, 0xC1, 0x90, 0x32, 0xC3, 0x4C, 0xAC, 0xDF, 0x91, 0x76, 0xC9, 0x58,
-    0xBD, 0x1A, 0x58, 0xBE, 0x70, 0x92, 0x4B, 0x41, 0x57, 0xA2, 0xC2, 0xCC, 0xB7, 0x56, 0x3A, 0x77,
-    0xC1, 0x54, 0x48, 0xF9, 0x12, 0x3F, 0x55, 0x78, 0x5D, 0x05, 0xBF, 0x32, 0xAC, 0x4C, 0xFA, 0x76,
-    0xA9, 0x9D, 0xBA, 0xBA, 0x6E, 0x11, 0x58, 0xA4, 0x99, 0x34, 0x56, 0xB9, 0x36, 0xEE, 0x42, 0x3D,
-    0xCD, 0x99, 0x8F, 0x11, 0xDD, 0x19, 0x92, 0xFD, 0x03, 0xA6, 0x29, 0xC1, 0x94, 0xC5, 0x5A, 0x33,
-    0x59, 0xB5, 0x23, 0x62, 0x31, 0xBD, 0x62, 0x11, 0x9F, 0x3E, 0x37, 0x9B, 0xD9, 0x77, 0x42, 0x5D,
-    0xF5, 0xA7, 0xF5, 0xB3, 0x3A, 0x44, 0x3D, 0x52, 0x36, 0xF1, 0x8A, 0xD9, 0x0C, 0x73, 0x2D, 0xD8,
-    0xD8, 0x35, 0xEE, 0xC0, 0x44, 0x27, 0x99, 0x9C, 0x7F, 0x1B, 0x47, 0xCE, 0xF3, 0xDA, 0xCF, 0x86,
-    0x21, 0xA2, 0x21, 0xA2, 0x04, 0xD1, 0x14, 0x51, 0x8D, 0x51, 0x8D, 0xA4, 0x46, 0x9D, 0x28, 0x1B,
-    0x7D, 0x22, 0x9F, 0xA9, 0x3D, 0xEC, 0xA9, 0xC6, 0x2D, 0x31, 0xF4, 0xE9, 0xCC, 0x9B, 0x8C, 0xEA,
-    0x57, 0x10, 0x77, 0x7A, 0x8A, 0xF0, 0xF7, 0x3D, 0xBA, 0x6D, 0xD9, 0x9A, 0xCC, 0x14, 0xA1, 0x1E,
-    0xE9, 0x6D, 0x6C, 0x68, 0xEC, 0xC3, 0xFB, 0xA3, 0xBC, 0xA2, 0xC8, 0x8B, 0xA9, 0x0C, 0x35, 0x55,
-    0x2D, 0x09, 0xDC, 0xA1, 0x71, 0xCB, 0x84, 0xCE, 0x7C, 0x21, 0x2A, 0xD6, 0x8F, 0xFB, 0x7A, 0x91,
-    0x76, 0x27, 0xA4, 0x93, 0x9A, 0x76, 0x1F, 0xDD, 0x83, 0xF7, 0x98, 0x05, 0x76, 0x9F, 0x7D, 0xAA,
-    0x94, 0x7E, 0x35, 0x62, 0x9D, 0x4B, 0xBF, 0x4A, 0x2E, 0xE8, 0x57, 0x0B, 0x73, 0x8B, 0xB3, 0x17,
-    0xEA, 0x31, 0xE3, 0x8F, 0x3D, 0x93, 0x1E, 0xF9, 0xD9, 0x80, 0x44, 0x66, 0x02, 0x3D, 0x8D, 0x90,
-    0xDD, 0x74, 0x8B, 0x44, 0x8A, 0xBE, 0xD6, 0xF4, 0xC6, 0x60, 0xC0, 0x0F, 0x13, 0x26, 0xE1, 0x0C,
-    0xCF, 0x70, 0x0B, 0xDB, 0xD4, 0xE3, 0x5B, 0xC7, 0x3A, 0xA5, 0x5B, 0xB8, 0xC6, 0x33, 0xBE, 0x9C,
-    0xE8, 0xAF, 0x9C, 0xE9, 0xF1, 0xC3, 0x50, 0x5F, 0x7F, 0xFF, 0x9E, 0x73, 0x84, 0xDB, 0x8F, 0xE7,
-    0x61, 0x2D, 0x18, 0x6F, 0x26, 0x44, 0x29, 0xED, 0x43, 0xCE, 0xA9, 0x69, 0x87, 0x94, 0xD4, 0xE9,
-    0xD0, 0x11, 0x2D, 0x8F, 0x00, 0xE2, 0xE5, 0x93, 0x88, 0x09, 0x2C, 0x01, 0x95, 0xD3, 0x9A, 0x75,
-    0xCE, 0x69, 0xEF, 0x98, 0x6F, 0xD4, 0x26, 0xBA, 0x5E, 0xF3, 0x36, 0xFA, 0x0F, 0x6F, 0xD5, 0xDE,
-    0x86, 0x5E, 0x6B, 0xDA, 0x02, 0xDF, 0x7F, 0x60, 0x31, 0xA7, 0xF2, 0x5A, 0x59, 0x25, 0xB8, 0x57,
-    0xD8, 0x0B, 0xCF, 0xB8, 0x26, 0xD0, 0x1E, 0x3B, 0xBD, 0xFF, 0x33, 0xCB, 0xED, 0x24, 0xEB, 0x2A,
-    0x21, 0x5C, 0x56, 0x79, 0x2C, 0xC2, 0x28, 0x61, 0x5F, 0x3B, 0x4F, 0x2A, 0x3F, 0x3B, 0x08, 0xF4,
-    0x2E, 0x83, 0x41, 0xCA, 0x4B, 0xAF, 0x0B, 0xC9, 0xE3, 0x72, 0x57, 0x95, 0x07, 0x4E, 0x31, 0xEA,
-    0xF2, 0x2F, 0x17, 0x0F, 0xDC, 0x02, 0xDE, 0xAF, 0xAC, 0x12, 0x39, 0xCD, 0xD9, 0x17, 0x38, 0xC2,
-    0x4E, 0xE3, 0x4E, 0x77, 0xDC, 0x0F, 0xBA, 0x11, 0x9F, 0xC1, 0x3F, 0xC2, 0xDF, 0x8D, 0x59, 0x3D,
-    0x90, 0xDD, 0xD4, 0x15, 0x3E, 0x7A, 0x62, 0xAD, 0x0C, 0x9A, 0xB1, 0xDC, 0xB8, 0xC1, 0x18, 0xB5,
-    0x99, 0x89, 0xBD, 0x4A, 0x41, 0xE1, 0x64, 0x76, 0x2D, 0x01, 0x85, 0x8B, 0x14, 0x6C, 0xC1, 0x83,
-    0x82, 0x82, 0x14, 0xA9, 0x28, 0x58, 0x32, 0xE3, 0x82, 0xC9, 0x60, 0x24, 0xE2, 0xC2, 0x05, 0x45,
-    0x9C, 0x22, 0x29, 0x42, 0x01, 0x05, 0x05, 0x6C, 0x0A, 0x6F, 0x66, 0x5C, 0x50, 0xD8, 0x96, 0x62,
-    0x17, 0x2E, 0x5C, 0x58, 0xC1, 0x93, 0xA1, 0xC8, 0xCF, 0x28, 0x04, 0x42, 0x70, 0x66, 0x82, 0x98,
-    0x88, 0xB1, 0xBC, 0xE8, 0xE9, 0xE6, 0xFB, 0xCE, 0xD1, 0x7B, 0xBB, 0x06, 0x32, 0x13, 0xE1, 0xBD,
-    0xE7, 0xEE, 0xEA, 0xEA, 0xDE, 0x73, 0xCE, 0x3D, 0xE7, 0x3B, 0xDF, 0xBD, 0x88, 0xE8, 0xE3, 0x95,
-    0x3D, 0xDA, 0x68, 0xCF, 0xA1, 0xCD, 0xB3, 0xB4, 0x10, 0x6F, 0x90, 0x24, 0x13, 0xBF, 0x93, 0xE3,
-    0x22, 0x61, 0xCB, 0x21, 0x51, 0xCD, 0x36, 0xA9, 0xD8, 0xA6, 0xC5, 0xD1, 0xF9, 0x7C, 0x2B, 0xCD,
-    0x52, 0xE7, 0xBA, 0x34, 0x0B, 0xBA, 0xA0, 0xCD, 0x25, 0x68, 0xBD, 0x36, 0x45, 0x2B, 0x6D, 0x9A,
-    0x85, 0x8D, 0x34, 0x69, 0xC1, 0x2F, 0xE2, 0x3A, 0xC2, 0x17, 0xC1, 0xFD, 0xED, 0x3F, 0x3E, 0x23,
-    0x52, 0x3A, 0x37, 0xE8, 0xD7, 0x3A, 0x47, 0xA6, 0xAD, 0x2E, 0x9F, 0x8B, 0x87, 0xDF, 0xAE, 0x89,
-    0x8F, 0x37, 0x0B, 0x09, 0xD1, 0x1F, 0x24, 0x12, 0x39, 0x36, 0xEE, 0x5C, 0xC3, 0x10, 0xE7, 0x16,
-    0x54, 0xF1, 0x09, 0x7E, 0xE0, 0x9F, 0xE7, 0xC7, 0xFE, 0x53, 0xEC, 0x07, 0x3F, 0x52, 0xBD, 0x5C,
-    0x87, 0x97, 0xEE, 0xF3, 0x11, 0x8A, 0x8E, 0x87, 0x61, 0x40, 0xFA, 0x97, 0xE3, 0x79, 0x26, 0xEE,
-    0xD1, 0x13, 0xA9, 0xCC, 0x86, 0x13, 0x27, 0x36, 0x24, 0xE8, 0x36, 0x4E, 0x61, 0x5C, 0x7B, 0xEA,
-    0x71, 0xEA, 0x73, 0xF6, 0x2C, 0xAD, 0xD8, 0xDD, 0xA5, 0x1E, 0xBB, 0x2D, 0xDB, 0xA6, 0xA1, 0xD1,
-    0x0D, 0xB4, 0xCD, 0xBD, 0x3F, 0x40, 0xDB, 0x7C, 0x76, 0x9D, 0xAD, 0x7F, 0x43, 0x5B, 0x2E, 0x98,
-    0x3E, 0x75, 0x06, 0x0B, 0xA6, 0x17, 0x02, 0xC9, 0x24, 0xBE, 0x15, 0xFA, 0x95, 0x84, 0x2E, 0x4A,
-    0x0A, 0x99, 0x39, 0xA7, 0x1E, 0x73, 0xF4, 0xDE, 0xC9, 0x73, 0x54, 0x07, 0xEB, 0xE1, 0xE1, 0x82,
-    0x22, 0x5C, 0x50, 0x84, 0x0B, 0xAE, 0x9E, 0x99, 0x1B, 0xE9, 0x45, 0xE7, 0x6A, 0xF1, 0xC6, 0x2C,
-    0x69, 0x25, 0xEC, 0x24, 0xEA, 0xE8, 0x56, 0x74, 0x4A, 0xA1, 0x17, 0x61, 0xAC, 0x5F, 0xF8, 0x74,
-    0x14, 0x34, 0x57, 0x0B, 0xD5, 0xFF, 0x71, 0xBD, 0x73, 0xF1, 0x1A, 0x06, 0xBA, 0x8F, 0x5C, 0x91,
-    0x56, 0xD1, 0x87, 0x97, 0x2A, 0x78, 0xF8, 0xCF, 0x51, 0x91, 0x67, 0xD1, 0xC7, 0x0F, 0x43, 0x7F,
-    0x8E, 0xCA, 0x31, 0x8A, 0x2D, 0x77, 0x29, 0x57, 0x3F, 0x63, 0x33, 0xA9, 0x79, 0x46, 0x3F, 0xA7,
-    0x55, 0xCE, 0xB5, 0xEB, 0x6B, 0xF2, 0x7D, 0xAC, 0xB9, 0xF0, 0x5A, 0xF1, 0xC7, 0x45, 0x0C, 0xE3,
-    0x61, 0x05, 0x86, 0xC6, 0xEA, 0x66, 0x99, 0xD3, 0xB5, 0xA1, 0x53, 0xCB, 0x26, 0x81, 0x2F, 0x65,
-    0xB4, 0x8D, 0x3B, 0x6D, 0x3B, 0xB7, 0x69, 0x5B, 0xB7, 0xA1, 0x7B, 0xA7, 0xA2, 0x34, 0xFB, 0x46,
-    0x13, 0x0B, 0x8B, 0xAA, 0xE1, 0xA0, 0x98, 0xF5, 0x2A, 0x7C, 0x0B, 0x82, 0x49, 0x04, 0x6A, 0xDB,
-    0x14, 0x62, 0x12, 0x35, 0x6C, 0x0F, 0x5D, 0xDA, 0x7B, 0xD7, 0x74, 0xE8, 0xF7, 0x43, 0x6E, 0x29,
-    0x2C, 0x78, 0xA6, 0xE8, 0x91, 0x52, 0x7F, 0xFB, 0x9E, 0xDB, 0xD3, 0xBF, 0xA9, 0xAE, 0xAB, 0xC7,
-    0x2B, 0xA9, 0x4C, 0x34, 0xBA, 0x8A, 0xC3, 0xE1, 0x6A, 0x86, 0x56, 0x4B, 0x35, 0xB0, 0x28, 0x22,
-    0xDB, 0xAF, 0xC5, 0x6F, 0xC5, 0x5B, 0xEA, 0xF0, 0xCD, 0xD6, 0xA7, 0xF7, 0x3D, 0x75, 0x8E, 0xB5,
-    0x93, 0x09, 0x6A, 0xCF, 0x6C, 0x67, 0x7C, 0x0F, 0x03, 0xCD, 0x3F, 0xF6, 0x77, 0xDF, 0xBE, 0x55,
-    0x1B, 0x22, 0x55, 0x6C, 0x5D, 0x15, 0x71, 0x63, 0x76, 0x98, 0x23, 0xF7, 0x16, 0x92, 0xFC, 0x0B,
-    0x19, 0x23, 0xDF, 0x95, 0x63, 0x4E, 0xDF, 0x3F, 0x33, 0xA9, 0xEA, 0x9B, 0x6D, 0x12, 0x98, 0x71,
-    0x8C, 0x7D, 0x7D, 0x4E, 0x6A, 0x7B, 0x54, 0x36, 0x9E, 0x41, 0xC8, 0x3C, 0xE9, 0x6A, 0xE7, 0xB2,
-    0x63, 0x2E, 0x72, 0x5F, 0x38, 0xD8, 0xE4, 0x4E, 0x86, 0xF7, 0x7A, 0xEC, 0xDE, 0xB8, 0xEB, 0xBB,
-    0x1A, 0x8E, 0x1B, 0x2B, 0xDF, 0x65, 0x51, 0xE3, 0xB9, 0xCC, 0x1F, 0xE1, 0xC8, 0x99, 0x93, 0x00,
-    0x49, 0x54, 0xCF, 0x16, 0x8C, 0xAC, 0xB8, 0x42, 0x40, 0x21, 0x42, 0x92, 0x0A, 0x46, 0x61, 0x70,
-    0x5A, 0xC0, 0x44, 0xE4, 0x27, 0x52, 0xB5, 0xC5, 0x4B, 0x6C, 0x22, 0xFE, 0x08, 0x0F, 0x97, 0xF6,
-    0x92, 0xB2, 0xA6, 0x73, 0x47, 0xBE, 0x74, 0x19, 0x24, 0xBE, 0x74, 0xDC, 0x5E, 0x7C, 0x09, 0xE9,
-    0xD6, 0xD2, 0x2C, 0xC2, 0x96, 0x97, 0x63, 0x2A, 0xEB, 0x90, 0x69, 0x67, 0x51, 0xB0, 0x86, 0x6D,
-    0xB9, 0x3C, 0x29, 0xDF, 0x4E, 0xB6, 0xD5, 0xF2, 0xC0, 0x13, 0x39, 0x4B, 0x82, 0x18, 0x8A, 0x6A,
-    0x32, 0xC0, 0x15, 0x31, 0xED, 0x2F, 0x2B, 0xB3, 0x1B, 0xA9, 0x61, 0xB2, 0x91, 0xC7, 0xE8, 0xED,
-    0xAF, 0x5A, 0xF5, 0x83, 0xF7, 0x69, 0xAB, 0x61, 0x37, 0xBB, 0xD3, 0xEB, 0x52, 0xFE, 0xF5, 0x81,
-    0xD2, 0x67, 0x88, 0xC2, 0xA7, 0x26, 0xB1, 0x66, 0x58, 0x38, 0x5D, 0x3A, 0xCC, 0x72, 0xCA, 0xB5,
-    0x17, 0x7E, 0x55, 0xFE, 0xFA, 0xCB, 0x2D, 0x2C, 0xCB, 0xA7, 0x96, 0xB5, 0xED, 0xF9, 0xF6, 0x87,
-    0x9F, 0x64, 0xF4, 0x6D, 0x74, 0x87, 0xCB, 0x6E, 0x4A, 0xF4, 0x77, 0xCA, 0x0D, 0x09, 0xEF, 0x15,
-    0x2A, 0x03, 0xDD, 0x9C, 0x57, 0x30, 0x25, 0x83, 0xEC, 0x32, 0xD4, 0x35, 0x73, 0x3C, 0xDD, 0xEA,
-    0xCE, 0x82, 0x7C, 0x7B, 0x2C, 0xE4, 0x2A, 0xB5, 0xC6, 0x56, 0x9C, 0x33, 0xBB, 0xC6, 0x8B, 0x26,
-    0x9D, 0x25, 0x41, 0x5E, 0x95, 0xB5, 0x45, 0xAC, 0x25, 0x70, 0x5E, 0x04, 0x1A, 0x26, 0x79, 0x66,
-    0xC9, 0x5D, 0x8A, 0x49, 0x37, 0xC9, 0x11, 0x12, 0xD1, 0x88, 0xFC, 0xF7, 0x87, 0x00, 0x0B, 0x0D,
-    0x12, 0xF4, 0x70, 0x84, 0x6E, 0xDC, 0xBA, 0xCA, 0xB8, 0x79, 0x0D, 0xB2, 0x97, 0xF2, 0x26, 0x52,
-    0x35, 0xE8, 0x8F, 0x8D, 0x29, 0x24, 0xD2, 0xA4, 0x61, 0x44, 0x46, 0x7B, 0xEF, 0x88, 0xD7, 0x1B,
-    0x5A, 0x50, 0x49, 0x26, 0x36, 0x23, 0x92, 0x88, 0x40, 0xC9, 0xFC, 0x61, 0x5C, 0xA7, 0x95, 0xC5,
-    0x28, 0x13, 0x29, 0x24, 0xF2, 0x51, 0xD6, 0xBA, 0x0D, 0xFC, 0x5D, 0x73, 0x29, 0x18, 0xBB, 0x9C,
-    0x81, 0x3D, 0x73, 0x8D, 0x4C, 0x21, 0xC8, 0x75, 0xDE, 0x59, 0xEE, 0x20, 0x1D, 0x69, 0x69, 0x58,
-    0xC5, 0xDD, 0xB2, 0x67, 0x56, 0x70, 0xE2, 0x99, 0xA5, 0x3F, 0x2C, 0xF5, 0x26, 0x3C, 0x28, 0xD9,
-    0xF3, 0xE6, 0x6A, 0x35, 0x7A, 0x09, 0xE7, 0x75, 0xE8, 0x79, 0xE3, 0xF3, 0x3D, 0x2D, 0x9F, 0x0D,
-    0x7E, 0x0B, 0x23, 0xD4, 0x76, 0x28, 0x31, 0xD0, 0xFA, 0xA8, 0x45, 0x0C, 0x5E, 0xA1, 0xDD, 0x79,
-    0x85, 0xA8, 0x3C, 0x02, 0xB4, 0xFA, 0xAD, 0x06, 0xB3, 0x6E, 0x7A, 0x0D, 0x25, 0x15, 0x21, 0x61,
-    0x97, 0xAA, 0x19, 0xB6, 0xB4, 0xB4, 0x5C, 0xD0, 0x03, 0xF4, 0x01, 0xE2, 0x0B, 0xC1, 0xCC, 0x9E,
-    0x87, 0x2D, 0x8A, 0x1B, 0xFD, 0x30, 0x69, 0xE0, 0x0F, 0x55, 0x54, 0xE3, 0x1D, 0xBD, 0x5D, 0x62,
-    0x42, 0x5A, 0x41, 0xE5, 0x8E, 0xE6, 0xA7, 0x05, 0x76, 0x79, 0xA0, 0x43, 0x10, 0x8E, 0xAE, 0x40,
-    0xFC, 0x17, 0xF0, 0x48, 0x96, 0x76, 0xF9, 0x3F, 0x1C, 0x70, 0xDE, 0x65, 0x61, 0xAF, 0x05, 0xC7,
-    0x9E, 0x39, 0x97, 0x81, 0x1A, 0x3F, 0xA1, 0x46, 0x0A, 0xA0, 0x30, 0x82, 0x5D, 0x0F, 0xDE, 0xE4,
-    0x32, 0x54, 0x09, 0x7E, 0x0C, 0xD8, 0xCD, 0xB4, 0x1B, 0xA1, 0x9B, 0xE8, 0xAE, 0x4B, 0x3C, 0x88,
-    0x46, 0x34, 0xF3, 0x07, 0x6A, 0x5F, 0xB1, 0xEE, 0x39, 0x74, 0x3B, 0x75, 0x99, 0x7C, 0xB9, 0x90,
-    0x59, 0x6B, 0x7E, 0x6C, 0x47, 0x4B, 0xA4, 0x3C, 0x9B, 0xD5, 0xA3, 0x84, 0x95, 0xC6, 0x93, 0x5F,
-    0x21, 0xD3, 0x31, 0xED, 0x8B, 0xE5, 0xDD, 0x4B, 0x77, 0xDD, 0x4E, 0xB9, 0x93, 0x89, 0x5B, 0x3E,
-    0x44, 0xFD, 0xEA, 0x34, 0x96, 0xB9, 0x62, 0xBB, 0xB3, 0x81, 0xB9, 0x3B, 0xEB, 0xBE, 0x2F, 0xA5,
-    0x4E, 0x8B, 0x6E, 0x2B, 0xA5, 0xE5, 0x67, 0x72, 0xBD, 0x91, 0x5C, 0xA7, 0x95, 0x04, 0x75, 0x2F,
-    0x7F, 0x5A, 0xF1, 0x35, 0xB9, 0x55, 0x48, 0xFE, 0x82, 0x9A, 0x1A, 0xDF, 0xC6, 0xF8, 0x73, 0xD6,
-    0xFD, 0x37, 0xBA, 0x57, 0xAC, 0x3B, 0x58, 0xEE, 0xD3, 0xA1, 0xD8, 0xC8, 0x74, 0x82, 0x71, 0x86,
-    0x59, 0xBD, 0x42, 0xF4, 0x54, 0xA7, 0x9D, 0xCF, 0xE7, 0xC4, 0x07, 0x47, 0x54, 0x8F, 0x6A, 0x37,
-    0x7F, 0xD6, 0x41, 0x8C, 0x7C, 0xAB, 0x22, 0xAA, 0x4D, 0xB4, 0x2A, 0x42, 0x13, 0x01, 0x85, 0xF7,
-    0xAE, 0x8A, 0xD9, 0xF0, 0xFF, 0x0B, 0x4E, 0xA7, 0x22, 0x9E, 0x44, 0xA5, 0x22, 0x31, 0x91, 0x16,
-    0x14, 0xD8, 0xE7, 0x91, 0xF5, 0x7B, 0x30, 0xA1, 0xB9, 0x3B, 0xDB, 0x51, 0x11, 0x4C, 0x61, 0x9F,
-    0xD7, 0xF2, 0xF5, 0x02, 0xE4, 0x1B, 0xE0, 0x07, 0xCB, 0x24, 0x9F, 0xEA, 0x50, 0xAE, 0x75, 0xEB,
-    0x5D, 0x2D, 0x82, 0xA5, 0xBE, 0x0A, 0xFA, 0x60, 0xA1, 0x55, 0x5B, 0xAB, 0x05, 0xB6, 0x6D, 0x98,
-    0x52, 0x5C, 0x33, 0x1B, 0x49, 0xCC, 0x1F, 0x56, 0x18, 0xD4, 0x78, 0xA6, 0x25, 0x7C, 0x16, 0x9A,
-    0xA0, 0xCB, 0x90, 0xBC, 0xCC, 0x5F, 0x84, 0x4F, 0xA2, 0x24, 0x4A, 0x7D, 0x08, 0xC1, 0x5A, 0x16,
-    0x37, 0xB3, 0xCF, 0x2B, 0x8E, 0x0C, 0xB6, 0x21, 0xC2, 0x7E, 0x3D, 0x01, 0x69, 0xF1, 0x5D, 0x9F,
-    0xE0, 0xA5, 0x87, 0x52, 0xB0, 0xD0, 0x7C, 0xF5, 0x32, 0xF9, 0xDA, 0x93, 0x2A, 0x4E, 0x32, 0x88,
-    0x09, 0x93, 0x20, 0x70, 0xF3, 0xAD, 0x03, 0x6F, 0xB7, 0x47, 0x65, 0x27, 0xCE, 0x38, 0x9B, 0x72,
-    0x89, 0x50, 0x4B, 0x26, 0x8B, 0x65, 0xCF, 0xE0, 0xB3, 0xA2, 0x68, 0x25, 0x3A, 0xAE, 0x0E, 0x92,
-    0xC1, 0x09, 0x13, 0x32, 0x79, 0xD8, 0xED, 0xEC, 0x58, 0x6C, 0x2F, 0xA9, 0x00, 0x98, 0x4E, 0xA3,
-    0x4B, 0x37, 0x8A, 0x6C, 0xF2, 0x6D, 0xED, 0x44, 0x1A, 0xDC, 0x84, 0x19, 0xF2, 0x36, 0x3E, 0x68,
-    0x82, 0x5A, 0x27, 0x65, 0xD1, 0x35, 0x5E, 0xC2, 0xD2, 0xC2, 0xBF, 0xBC, 0x0E, 0xF7, 0xC6, 0xCE,
-    0x3D, 0x41, 0x2F, 0x03, 0x60, 0x19, 0x67, 0x80, 0xB0, 0xDC, 0xD2, 0xA4, 0xD7, 0x1C, 0xD2, 0x12,
-    0x8C, 0x7C, 0x2C, 0x74, 0xEE, 0x73, 0xBA, 0x10, 0x21, 0x51, 0x66, 0x0B, 0x22, 0x1D, 0x36, 0x21,
-    0xD1, 0xCA, 0x34, 0x0C, 0x4B, 0xAA, 0xB3, 0x30, 0x31, 0x30, 0xF2, 0x14, 0xF5, 0xA3, 0x36, 0x57,
-    0xB3, 0x5A, 0x0D, 0xDE, 0xA8, 0x49, 0x1A, 0xDD, 0xCC, 0xB8, 0x55, 0xB3, 0xA3, 0x4E, 0xB3, 0x27,
-    0x34, 0x36, 0xAB, 0x78, 0x92, 0x17, 0xB3, 0xD1, 0x80, 0x8E, 0x76, 0x60, 0x0E, 0xEC, 0xC6, 0xB6,
-    0xFB, 0xA7, 0xA4, 0x80, 0x6B, 0xCC, 0x8B, 0xA1, 0xBA, 0x42, 0x1D, 0x59, 0x5B, 0x63, 0xAE, 0x2A,
-    0xC6, 0x54, 0x61, 0xB5, 0x8E, 0x99, 0x02, 0xE4, 0x27, 0x2A, 0x6B, 0x71, 0x8A, 0x55, 0x22, 0x53,
-    0x2F, 0x70, 0x32, 0xE5, 0x03, 0x4E, 0x49, 0x8E, 0x82, 0x8E, 0x42, 0x9E, 0x57, 0x2A, 0x7E, 0xDD,
-    0x63, 0x7B, 0xC8, 0x1F, 0x5E, 0xD2, 0xA8, 0x5C, 0x68, 0x50, 0x72, 0x60, 0xCE, 0x81, 0xC7, 0xB8,
-    0xC5, 0x92, 0x3E, 0x4D, 0xAD, 0x8F, 0xC4, 0xB6, 0x65, 0x07, 0xF9, 0xBB, 0xB6, 0x65, 0xB5, 0xE2,
-    0x4E, 0xF9, 0x83, 0xD4, 0x49, 0x9F, 0x13, 0xAB, 0xDE, 0xEE, 0xB2, 0xB3, 0x5F, 0xCB, 0xA3, 0x6A,
-    0x49, 0xB2, 0xA6, 0x44, 0x90, 0xD3, 0x17, 0xAF, 0x86, 0x96, 0x36, 0x47, 0x64, 0xF0, 0xFA, 0xE9,
-    0x83, 0x4E, 0x8B, 0xA4, 0x91, 0x23, 0xE3, 0xFA, 0x0C, 0xAB, 0xD8, 0x78, 0x0E, 0xF0, 0x7D, 0x9A,
-    0x07, 0x62, 0xEA, 0x21, 0xB2, 0xC2, 0x29, 0xED, 0x0A, 0x99, 0x26, 0x44, 0x92, 0x2D, 0x7B, 0xB2,
-    0xEC, 0xE5, 0xAB, 0x5E, 0xB9, 0xEA, 0x8D, 0xCB, 0x53, 0x0A, 0xF9, 0x67, 0x54, 0x3F, 0x82, 0x40,
-    0x12, 0xCD, 0x7E, 0x56, 0x05, 0xE6, 0x61, 0x72, 0xBD, 0xC5, 0xA9, 0x86, 0x6C, 0x2D, 0x3D, 0x53,
-    0x61, 0x41, 0xE6, 0x1F, 0x50, 0x0F, 0xFF, 0x7D, 0xCA, 0x58, 0x8F, 0x8A, 0xA0, 0x3E, 0xB9, 0xDD,
-    0x20, 0x41, 0xA3, 0x22, 0xAC, 0x1E, 0x47, 0xC0, 0x07, 0x6D, 0x8C, 0xB7, 0x8F, 0x47, 0x57, 0xE1,
-    0xB8, 0xA4, 0x8E, 0xB3, 0xCD, 0x97, 0xC2, 0xBB, 0xE0, 0x40, 0xF7, 0xAF, 0xA1, 0x0E, 0x79, 0x25,
-    0xCA, 0x45, 0xB2, 0xAC, 0x05, 0xAF, 0xAD, 0xBC, 0x75, 0x75, 0xD5, 0x1B, 0xBE, 0xD9, 0x9B, 0x48,
-    0xF0, 0x92, 0x5D, 0xCA, 0x3E, 0x6F, 0x54, 0x6F, 0x1E, 0xC8, 0x48, 0x8F, 0xA9, 0x18, 0x90, 0x02,
-    0x47, 0xD5, 0xAB, 0x30, 0xA2, 0x40, 0xA9, 0x48, 0xB2, 0xF5, 0xA9, 0x49, 0xAD, 0x77, 0x92, 0x6E,
-    0xDA, 0xE0, 0xB6, 0x6E, 0xD0, 0xCE, 0xF7, 0x69, 0x36, 0x51, 0xE4, 0x0B, 0x16, 0xC4, 0xFF, 0x54,
-    0x53, 0x4C, 0xF8, 0x4A, 0x5C, 0xE0, 0x9D, 0x87, 0x98, 0x64, 0x27, 0x18, 0x9D, 0x9B, 0x33, 0x52,
-    0x48, 0xDF, 0x55, 0x9E, 0x7B, 0xE3, 0x85, 0xC6, 0xBF, 0xFD, 0x57, 0xC0, 0xC9, 0x99, 0x21, 0xEC,
-    0x22, 0xBF, 0xF3, 0xFB, 0xE3, 0x5E, 0xEB, 0x0F, 0x1B, 0x62, 0xD0, 0x65, 0x5C, 0x7E, 0xE4, 0xB6,
-    0x5E, 0x23, 0x0B, 0x7A, 0x4D, 0x70, 0x70, 0xB8, 0x4A, 0xAA, 0x81, 0xB7, 0x9A, 0x56, 0xB9, 0x96,
-    0xDF, 0x31, 0x23, 0x2A, 0x7E, 0x36, 0x65, 0x14, 0x37, 0x24, 0xAD, 0x59, 0x1E, 0xA0, 0x9B, 0x66,
-    0x06, 0x62, 0xCE, 0x19, 0x08, 0xC1, 0xA6, 0xDC, 0x04, 0xE3, 0x9C, 0x79, 0x56, 0x6A, 0x0E, 0xCF,
-    0xDD, 0x7C, 0x5E, 0x5E, 0xF4, 0x26, 0x22, 0xF7, 0xEC, 0x88, 0x12, 0xB1, 0x85, 0x94, 0x5D, 0x62,
-    0x26, 0x93, 0xCE, 0x1F, 0xD6, 0x48, 0xAA, 0x7C, 0x83, 0xDF, 0x60, 0xEF, 0xBD, 0xEC, 0xC0, 0xE1,
-    0xE1, 0x41, 0x61, 0x21, 0x11, 0x3F, 0x00, 0xE1, 0x16, 0xF7, 0x16, 0xF8, 0xC8, 0x91, 0xBD, 0xCC,
-    0x60, 0x71, 0x62, 0xDD, 0xF2, 0xE3, 0x83, 0xC4, 0xB5, 0x54, 0x1B, 0x62, 0x5B, 0xA9, 0xFC, 0xE0,
-    0x26, 0x2B, 0xFA, 0xC2, 0xAF, 0xE0, 0xB6, 0xA8, 0xF5, 0xAB, 0xBC, 0x62, 0xD6, 0x16, 0x88, 0x4C,
-    0x50, 0x82, 0xEC, 0x07, 0xAC, 0x26, 0xA1, 0x18, 0x59, 0x13, 0xAD, 0xF7, 0x87, 0xA9, 0x43, 0xA7,
-    0x0C, 0x36, 0x32, 0x02, 0x8B, 0x34, 0xDC, 0xD0, 0xF3, 0x97, 0x0A, 0xE0, 0xD6, 0xE6, 0x7C, 0x9E,
-    0x41, 0x23, 0xF8, 0xA2, 0x82, 0xB8, 0xBC, 0xBD, 0xA0, 0x7E, 0xE4, 0x2E, 0x2A, 0x10, 0x5C, 0x95,
-    0xD7, 0x68, 0x05, 0x98, 0xD5, 0x09, 0x19, 0xCC, 0x8C, 0xC3, 0xB8, 0x38, 0x10, 0x37, 0x18, 0xFC,
-    0x22, 0xE5, 0x01, 0xF4, 0x42, 0x51, 0x66, 0x06, 0xEA, 0xE6, 0x79, 0xCB, 0x75, 0x8B, 0xA3, 0xC3,
-    0x66, 0xCF, 0xF1, 0x65, 0x48, 0x4D, 0x89, 0x25, 0xF1, 0xC4, 0xEA, 0xD2, 0x49, 0xE6, 0x53, 0x00,
-    0x7E, 0x65, 0x72, 0xF6, 0xA9, 0x49, 0xFF, 0xE6, 0x54, 0xD9, 0xCF, 0x9B, 0x8C, 0x7D, 0x0B, 0xDE,
-    0x4D, 0x05, 0xBC, 0xA3, 0xF3, 0xAB, 0xCF, 0x2D, 0x50, 0x42, 0xF2, 0x69, 0xBF, 0x8E, 0x3E, 0xF7,
-    0xC9, 0xB3, 0xFC, 0x5D, 0x82, 0xCA, 0x60, 0x3D, 0x2A, 0x0C, 0xD8, 0x63, 0x8D, 0x1E, 0xDB, 0x56,
-    0x57, 0xCC, 0x26, 0xC9, 0x28, 0xD2, 0x43, 0xA3, 0xDF, 0x18, 0xDC, 0x05, 0x95, 0x49, 0x12, 0x1A,
-    0x96, 0x94, 0x64, 0xDA, 0xAF, 0xD3, 0x93, 0x1C, 0x95, 0x52, 0x63, 0xD7, 0xDE, 0xC6, 0xCF, 0x7D,
-    0x6C, 0x5B, 0x27, 0xA9, 0x5B, 0xAC, 0xD2, 0x25, 0x70, 0x1F, 0x2B, 0x8E, 0x71, 0xA9, 0x91, 0x47,
-    0x17, 0x28, 0x09, 0xAF, 0x21, 0x87, 0x63, 0x3D, 0xE7, 0xC1, 0x9F, 0xDE, 0xC5, 0xC9, 0xF2, 0xA4,
-    0x36, 0x7E, 0x7E, 0x68, 0x67, 0x67, 0xC7, 0x7D, 0xAC, 0x88, 0xDC, 0x7B, 0x88, 0xB6, 0xFB, 0x5B,
-    0x2C, 0x58, 0xF5, 0xF2, 0x94, 0x1E, 0xB3, 0x9B, 0x28, 0x5E, 0x6B, 0xD8, 0x56, 0xBE, 0xDA, 0x13,
-    0xF6, 0xFB, 0x61, 0xF6, 0xF5, 0xF6, 0x65, 0xD4, 0x7D, 0xB2, 0x6F, 0x8C, 0xDC, 0x6E, 0x97, 0x07,
-    0xEB, 0xC4, 0xCE, 0xB1, 0xF3, 0x49, 0x53, 0x63, 0x1A, 0xB5, 0x81, 0xA7, 0x9E, 0xBB, 0x09, 0xD6,
-    0xE5, 0xF9, 0x5F, 0x80, 0x16, 0x2C, 0x82, 0xF3, 0x0B, 0x4C, 0x14, 0x3E, 0xC9, 0x58, 0x88, 0x90,
-    0x7F, 0x38, 0xD2, 0x79, 0x38, 0xD3, 0x71, 0x2B, 0x61, 0xD0, 0x71, 0x0D, 0xAD, 0x93, 0x1A, 0x59,
-    0x1B, 0xBA, 0x22, 0xD3, 0xBE, 0xC5, 0x59, 0x85, 0xCC, 0xF6, 0xAC, 0x46, 0xD5, 0xAE, 0xBA, 0xAB,
-    0xDD, 0x6F, 0x3D, 0xA5, 0x60, 0x5C, 0x10, 0x1C, 0xBD, 0xA2, 0xF5, 0xBE, 0xB2, 0x08, 0x5E, 0xB6,
-    0x44, 0x5D, 0x90, 0x3D, 0x2A, 0xC1, 0x22, 0xCC, 0x5E, 0x85, 0xD1, 0x6F, 0xF1, 0x80, 0x92, 0x6B,
-    0x0C, 0x85, 0xCA, 0x20, 0x65, 0x3D, 0xDB, 0xAF, 0x04, 0x7A, 0xB1, 0x11, 0x36, 0x2C, 0xAE, 0xE0,
-    0xD5, 0x8D, 0x51, 0x36, 0xA2, 0x0E, 0x91, 0x3B, 0xA9, 0x48, 0x09, 0xD2, 0x22, 0xD1, 0x16, 0xFB,
-    0x67, 0x7E, 0xD3, 0x96, 0xC7, 0xCA, 0x52, 0x31, 0x64, 0x54, 0x38, 0x31, 0x30, 0xD6, 0xD6, 0xD3,
-    0xD4, 0x26, 0x37, 0xF2, 0x7B, 0xE5, 0x44, 0x9D, 0x52, 0xA2, 0x96, 0x90, 0x18, 0xB6, 0xCA, 0x8B,
-    0x1A, 0xA5, 0x45, 0xF5, 0xC1, 0x05, 0xE3, 0x03, 0x0B, 0x72, 0x47, 0x71, 0x16, 0x1D, 0xDF, 0x46,
-    0x6D, 0x08, 0xEC, 0x58, 0x32, 0xDF, 0x07, 0xD1, 0x98, 0x51, 0x31, 0x5D, 0x0E, 0xF5, 0x7A, 0xD2,
-    0x54, 0x2A, 0x85, 0x7F, 0x50, 0x14, 0x5A, 0x82, 0x94, 0x23, 0xE6, 0x1E, 0xB2, 0x53, 0xD0, 0x12,
-    0x1F, 0x8C, 0xBA, 0x26, 0xFD, 0x74, 0x5A, 0xD5, 0xFA, 0xAA, 0x71, 0xA3, 0x37, 0x16, 0x7A, 0xB0,
-    0x60, 0x88, 0xD4, 0xFB, 0xA9, 0x63, 0x87, 0x20, 0x0B, 0x0C, 0xF8, 0x30, 0xBE, 0x75, 0xFB, 0x7C,
-    0x2F, 0x3F, 0xDC, 0xBB, 0xF7, 0x61, 0x27, 0x3F, 0xFD, 0xE2, 0xA3, 0x9B, 0xAD, 0xFC, 0xEE, 0x83,
-    0x1B, 0xB7, 0x1B, 0xF9, 0xD9, 0x8D, 0x1B, 0x60, 0x6E, 0xC9, 0x9D, 0x5B, 0xA3, 0x32, 0x48, 0xCC,
-    0x19, 0xBC, 0xF9, 0x96, 0x5E, 0x64, 0x11, 0x34, 0xC2, 0x88, 0xF9, 0xBA, 0xB6, 0xF6, 0xD0, 0x44,
-    0x33, 0x5D, 0x11, 0x98, 0xF7, 0xBE, 0xF1, 0xC4, 0x7A, 0x2D, 0xA3, 0xBE, 0x45, 0x7A, 0xE4, 0xF8,
-    0x21, 0xBB, 0xDF, 0x44, 0x18, 0x8C, 0xE8, 0x5D, 0xD6, 0x76, 0x17, 0x0E, 0x3E, 0xB5, 0xBC, 0x7B,
-    0x51, 0xF2, 0x29, 0x96, 0xBE, 0x56, 0x77, 0x8C, 0xCC, 0x85, 0x07, 0x5A, 0x03, 0x4C, 0xAB, 0x9F,
-    0x0F, 0xD0, 0xBB, 0xCA, 0x92, 0xC5, 0x10, 0x73, 0x75, 0xCD, 0xC2, 0x3C, 0x1E, 0x7D, 0xA5, 0x4E,
-    0x86, 0xA7, 0x9A, 0x04, 0x3A, 0x15, 0x18, 0xED, 0xDA, 0xFC, 0xF9, 0xFB, 0x5B, 0x4C, 0xAC, 0x56,
-    0x7B, 0xD3, 0x0B, 0x5D, 0x82, 0xF3, 0x91, 0x23, 0xBD, 0xC8, 0x2B, 0xC7, 0x12, 0x55, 0xC3, 0x2E,
-    0x71, 0x74, 0x19, 0x4D, 0x4C, 0x9B, 0xA8, 0x37, 0x34, 0xB5, 0xBA, 0x35, 0x91, 0x43, 0x1B, 0xA8,
-    0xB0, 0x6C, 0x6C, 0xD5, 0x98, 0xB8, 0x96, 0x39, 0x05, 0xF1, 0xA4, 0xD9, 0xD7, 0x3B, 0x39, 0x78,
-    0xCB, 0xF8, 0x84, 0x1E, 0xA3, 0x74, 0xFA, 0x52, 0x2F, 0x13, 0x6D, 0xB8, 0x95, 0xB6, 0xE1, 0x10,
-    0x3E, 0x78, 0x7D, 0xC8, 0x95, 0x6B, 0x1A, 0xCD, 0xCA, 0x1E, 0x51, 0x22, 0x85, 0x84, 0x01, 0x26,
-    0x96, 0xD5, 0xEC, 0x8C, 0xC2, 0x08, 0x68, 0x06, 0x68, 0x69, 0x64, 0x6D, 0x4D, 0xC4, 0x22, 0x5B,
-    0xD1, 0x58, 0x02, 0x6A, 0xD9, 0xED, 0x58, 0x5E, 0xA1, 0x32, 0xC2, 0x51, 0xA4, 0xA6, 0x0E, 0x38,
-    0xB5, 0x84, 0xA7, 0x89, 0x0D, 0x73, 0xD9, 0x57, 0x09, 0x75, 0xD2, 0xE9, 0xA5, 0x4F, 0xAB, 0x6D,
-    0xEF, 0xFF, 0x0B, 0xD1, 0x50, 0xAA, 0x37, 0x53, 0xB7, 0xF7, 0x1B, 0x27, 0x87, 0xDE, 0xCC, 0x78,
-    0x01, 0x1B, 0x66, 0x84, 0xD1, 0x88, 0xB7, 0x1A, 0xDA, 0x66, 0x72, 0xF8, 0xC8, 0x11, 0xAC, 0x75,
-    0xFC, 0xEC, 0x2E, 0x60, 0x35, 0x19, 0x3B, 0x90, 0x82, 0xB4, 0x5C, 0xC0, 0x59, 0xE7, 0xD6, 0x11,
-    0xB6, 0x5E, 0xFF, 0x1D, 0xD0, 0x02, 0x3D, 0xE9, 0xCA, 0x69, 0xBD, 0x87, 0x39, 0x6B, 0xB7, 0x31,
-    0x20, 0x06, 0x19, 0x4F, 0x98, 0x33, 0xAC, 0x76, 0x4E, 0x8F, 0x8F, 0xE9, 0x2F, 0xB9, 0x6B, 0xF1,
-    0x74, 0x9A, 0xE9, 0xA6, 0x43, 0xBE, 0x3E, 0x5B, 0x07, 0xCB, 0xA0, 0x67, 0x35, 0xC2, 0xB3, 0xD2,
-    0xA1, 0xB0, 0x25, 0xDE, 0x25, 0xAD, 0x9C, 0x89, 0x02, 0x97, 0xE7, 0xCE, 0xBC, 0xB1, 0xE0, 0xA6,
-    0x87, 0x99, 0xD3, 0xB3, 0x03, 0x73, 0x29, 0x2D, 0x22, 0xEE, 0x68, 0x09, 0xA5, 0x13, 0xDE, 0x1D,
-    0x3E, 0x06, 0x4F, 0x79, 0x44, 0xAE, 0xB8, 0xF2, 0x79, 0x7D, 0x13, 0xF3, 0x1E, 0x6A, 0x03, 0xEF,
-    0x02, 0x82, 0x17, 0x58, 0x70, 0x0B, 0xF4, 0xC2, 0x47, 0x0D, 0xA2, 0x57, 0x2F, 0x8E, 0x51, 0x04,
-    0xB3, 0x98, 0x00, 0xC6, 0xCB, 0x4C, 0xE8, 0x50, 0x1A, 0x84, 0xF1, 0xFE, 0x09, 0x36, 0xC0, 0x4B,
-    0x99, 0xCF, 0x09, 0x73, 0x51, 0x41, 0xB8, 0xFA, 0x6C, 0x75, 0x31, 0x91, 0x17, 0xC7, 0xC8, 0xF0,
-    0xF4, 0xC8, 0x95, 0x6A, 0xE1, 0xC8, 0x35, 0x80, 0x4A, 0x6D, 0x47, 0xFD, 0xB7, 0xE0, 0x3F, 0x4F,
-    0xEF, 0x19, 0x78, 0x64, 0xEF, 0x48, 0xCC, 0xB0, 0x3A, 0x2F, 0x57, 0x0A, 0x4F, 0xF7, 0x81, 0x1C,
-    0xA3, 0xF8, 0x96, 0xE4, 0x38, 0x74, 0xE9, 0xEE, 0x3B, 0xBA, 0x54, 0xF7, 0xE0, 0x09, 0x68, 0x0A,
-    0xB5, 0xDC, 0xCE, 0x32, 0x99, 0x52, 0xEB, 0xBB, 0x07, 0xA9, 0xF5, 0xA3, 0x7A, 0x27, 0x7C, 0x42,
-    0xEF, 0x84, 0x4F, 0xBD, 0xAC, 0x63, 0x47, 0xAB, 0xD9, 0x84, 0xE6, 0xF6, 0x73, 0x2C, 0x34, 0xEE,
-    0xFE, 0x89, 0xA7, 0xAD, 0xBF, 0xDD, 0xE4, 0x61, 0xF0, 0xA3, 0x1B, 0x8C, 0xB2, 0x3B, 0x2C, 0x20,
-    0xBF, 0xBF, 0xC1, 0xA2, 0xF8, 0x73, 0xB6, 0xF9, 0x53, 0x17, 0x18, 0xC4, 0x3E, 0xEF, 0xBE, 0x9D,
-    0xB7, 0xB6, 0x3A, 0x3D, 0xFD, 0xAF, 0xB6, 0x5C, 0x9E, 0xAA, 0x56, 0x7A, 0x1A, 0x25, 0xB2, 0x20,
-    0x99, 0x6E, 0x6A, 0x88, 0x78, 0xA9, 0x62, 0xCD, 0x7E, 0xAB, 0x63, 0x37, 0xEC, 0x36, 0xFB, 0x15,
-    0xB6, 0xAF, 0x5C, 0xD6, 0xDB, 0x0E, 0xBD, 0x5A, 0xD1, 0xC2, 0xEB, 0x9E, 0x74, 0x7A, 0xA7, 0x41,
-    0x6C, 0x70, 0x3A, 0xC7, 0xC8, 0x0C, 0x44, 0xF5, 0x8F, 0xC9, 0xA1, 0x99, 0xCD, 0x56, 0x84, 0xD1,
-    0x22, 0x18, 0xE0, 0x5B, 0x5E, 0x85, 0x74, 0xC1, 0xB0, 0x34, 0x3A, 0x52, 0x0C, 0x04, 0xC2, 0xF7,
-    0x7A, 0xAA, 0x5D, 0x10, 0x00, 0x08, 0x0D, 0x89, 0x51, 0x45, 0x6B, 0x0B, 0xB6, 0xBC, 0xD0, 0xA7,
-    0x2D, 0x04, 0x03, 0xBB, 0x2F, 0x73, 0x84, 0x08, 0xFC, 0x9A, 0x37, 0x38, 0x66, 0xB1, 0x58, 0xA1,
-    0x21, 0x03, 0xF0, 0x2F, 0xEC, 0xFF, 0xAF, 0x81, 0xF0, 0x69, 0x8D, 0x56, 0x02, 0xEA, 0x7F, 0x01,
-    0xD3, 0x5A, 0xB5, 0xC2, 0xFE, 0xFF, 0x8F, 0xFA, 0xFF, 0x5F, 0x18, 0x18, 0x18, 0x00, 0xDD, 0x95,
-    0x3D, 0x72, 0xDB, 0x30, 0x10, 0x85, 0x97, 0xA2, 0x35, 0x9A, 0x8C, 0x0A, 0x36, 0x4E, 0xE5, 0x82,
-    0x4D, 0x8A, 0x34, 0x19, 0xDE, 0xC0, 0x60, 0x6E, 0xE0, 0x26, 0xA7, 0x48, 0xA1, 0x23, 0x50, 0x47,
-    0x70, 0x95, 0xD3, 0xC4, 0x06, 0x7D, 0x03, 0x1E, 0x41, 0x85, 0x0F, 0xC0, 0x82, 0x99, 0xA1, 0x66,
-    0x04, 0x20, 0xFB, 0x0B, 0xD2, 0x93, 0x68, 0x52, 0x24, 0x55, 0xD4, 0x60, 0x05, 0x82, 0xD8, 0xC7,
-    0x0F, 0xFB, 0x16, 0x00, 0x00, 0xDB, 0x07, 0xF0, 0x8F, 0x38, 0x16, 0x29, 0xEC, 0xD2, 0x05, 0x83,
-    0xDD, 0x8F, 0xE7, 0xFA, 0x25, 0x60, 0x50, 0xF5, 0xF7, 0x0E, 0x28, 0x68, 0x8E, 0x1F, 0x9F, 0xE1,
-    0x3B, 0x06, 0xAE, 0xE5, 0xFF, 0x00, 0x1E, 0x8A, 0x0B, 0x07, 0x11, 0x36, 0x16, 0x94, 0x33, 0x8D,
-    0x87, 0x84, 0x3F, 0x8A, 0x68, 0x4C, 0x13, 0x06, 0xB8, 0x60, 0x37, 0xD2, 0x23, 0x5C, 0xB0, 0x97,
-    0x60, 0x82, 0xEA, 0x44, 0x01, 0xCE, 0x57, 0x83, 0x06, 0x75, 0x4F, 0x01, 0x2E, 0x68, 0x38, 0xC0,
-    0x05, 0x1A, 0x0C, 0xE0, 0x8E, 0x14, 0xE0, 0x02, 0xCC, 0x4F, 0x72, 0x7A, 0xE8, 0x38, 0x27, 0xCE,
-    0x7B, 0x0B, 0xA2, 0x04, 0x26, 0x10, 0x17, 0x5C, 0x53, 0x1A, 0x54, 0x29, 0xCE, 0x97, 0xA4, 0x6F,
-    0x11, 0x88, 0xC1, 0x35, 0x81, 0xFB, 0x2C, 0xC7, 0x54, 0x58, 0x4E, 0x17, 0x81, 0xBF, 0x17, 0xDC,
-    0x09, 0xD2, 0x23, 0xE8, 0xEF, 0x2E, 0xB6, 0xCC, 0x34, 0x8D, 0xBC, 0x4B, 0x35, 0xF3, 0x07, 0xEC,
-    0x67, 0xD6, 0xC8, 0xD9, 0x1C, 0x14, 0xA2, 0x4F, 0xD5, 0xAD, 0x06, 0x62, 0x38, 0x0A, 0xC1, 0x91,
-    0x55, 0x91, 0x18, 0x14, 0x4D, 0x52, 0x48, 0xDA, 0x90, 0x81, 0xED, 0x04, 0x17, 0xAA, 0x26, 0x46,
-    0xB8, 0x8C, 0xB4, 0xE1, 0xF3, 0x4E, 0x78, 0x79, 0xA1, 0xE5, 0x17, 0xB9, 0x38, 0x84, 0x85, 0x53,
-    0x27, 0x70, 0x94, 0x51, 0x84, 0x22, 0xBE, 0x63, 0x6E, 0x29, 0xF0, 0x4C, 0x77, 0x62, 0x66, 0x5B,
-    0x30, 0x74, 0xC2, 0x4B, 0x69, 0x11, 0x13, 0x25, 0xA2, 0x3C, 0x84, 0x86, 0xB2, 0xC8, 0x24, 0xCE,
-    0x5B, 0x10, 0x14, 0x49, 0xDE, 0xDD, 0x47, 0x39, 0xCD, 0x32, 0xC8, 0x6B, 0x72, 0x3E, 0x4E, 0x73,
-    0x78, 0x28, 0x2F, 0xEB, 0x7A, 0x8A, 0x92, 0xF4, 0x80, 0xD5, 0x39, 0x72, 0x55, 0x05, 0x3E, 0x22,
-    0x85, 0x62, 0x54, 0x0C, 0x4B, 0x2E, 0x24, 0x05, 0x63, 0x64, 0x0C, 0x8D, 0xB1, 0x31, 0x38, 0x46,
-    0x67, 0x39, 0x4D, 0xE1, 0x93, 0x0B, 0x49, 0x09, 0xE5, 0x32, 0x52, 0x46, 0x0A, 0xC9, 0x28, 0x19,
-    0x26, 0xE3, 0x64, 0xA0, 0x8C, 0x94, 0xA1, 0x32, 0x56, 0x0A, 0xCB, 0x68, 0xAD, 0x71, 0x91, 0x1F,
-    0x0F, 0x67, 0x30, 0x43, 0xA6, 0x41, 0x1D, 0x39, 0xB8, 0xD1, 0x2C, 0x59, 0x8F, 0xE6, 0x49, 0xDE,
-    0x8E, 0xA5, 0xDE, 0xBC, 0xA9, 0xF5, 0xA5, 0xD8, 0x33, 0x47, 0x31, 0x26, 0xEF, 0x27, 0x41, 0xEA,
-    0xAD, 0xE0, 0x09, 0x94, 0x78, 0x93, 0x64, 0x49, 0xED, 0x13, 0x2C, 0x29, 0xFE, 0x2E, 0x53, 0xF5,
-    0xD9, 0x9F, 0x49, 0x89, 0x0A, 0x34, 0x71, 0x68, 0x30, 0x8B, 0xB2, 0x06, 0xF6, 0x28, 0x6B, 0x60,
-    0x93, 0xB2, 0x06, 0x5E, 0x2E, 0x11, 0x49, 0x66, 0x46, 0x5D, 0xB6, 0xA1, 0x67, 0x1F, 0x4E, 0x26,
-    0xBE, 0x9C, 0x3F, 0xA8, 0x55, 0x4B, 0xEC, 0x22, 0xB2, 0xA8, 0x48, 0x47, 0x33, 0xEB, 0xED, 0xCA,
-    0xAD, 0x8B, 0x5D, 0x17, 0xBF, 0x2E, 0x86, 0x5D, 0x1C, 0xBB, 0x6A, 0x13, 0xE6, 0xD9, 0xB7, 0xA6,
-    0x65, 0xF6, 0xAF, 0xB7, 0x99, 0xBD, 0x75, 0xC3, 0xA1, 0xB9, 0x18, 0x7B, 0x76, 0x30, 0xB3, 0x67,
-    0xA9, 0xFC, 0x21, 0x7C, 0xC8, 0xCC, 0x9E, 0xF5, 0xA4, 0x5C, 0x9C, 0xD1, 0xCA, 0x53, 0x9A, 0x62,
-    0x6D, 0xEC, 0xA7, 0xFA, 0x2F, 0xD8, 0xFB, 0xFF, 0x94, 0xFD, 0x1D, 0x17, 0x3D, 0xF5, 0x09, 0x69,
-    0xB8, 0x93, 0x78, 0xA7, 0xEE, 0x37, 0xF3, 0xBA, 0x4F, 0xFC, 0x6A, 0x48, 0xA9, 0xEF, 0x80, 0x6F,
-    0xD0, 0xEB, 0x01, 0x3C, 0x6D, 0x5F, 0x5C, 0x0A, 0xBE, 0x7D, 0xD6, 0x7D, 0xE2, 0xF4, 0x9B, 0x3E,
-    0x61, 0xF7, 0x4D, 0x75, 0xBD, 0x4F, 0x74, 0x7F, 0xE8, 0x13, 0x57, 0x64, 0x41, 0xDC, 0xB4, 0xD2,
-    0x27, 0x90, 0x1C, 0x4D, 0xBA, 0x20, 0xFD, 0xA1, 0x68, 0xFF, 0x49, 0x9F, 0xF8, 0x2A, 0xBC, 0xB4,
-    0x45, 0x80, 0x1B, 0x64, 0x2F, 0x54, 0x69, 0x02, 0x82, 0xF0, 0x80, 0x27, 0xB9, 0xEC, 0x44, 0xB0,
-    0x74, 0x76, 0xF8, 0x12, 0xB8, 0xCF, 0xEE, 0xB1, 0x29, 0x1F, 0xB0, 0xCE, 0xDD, 0xB7, 0x04, 0x54,
-    0xEF, 0x01, 0xBA, 0x16, 0xEB, 0xA0, 0x98, 0xE5, 0x96, 0x42, 0xF4, 0x0D, 0x21, 0x42, 0xB9, 0x37,
-    0x84, 0x66, 0x13, 0x04, 0x0D, 0xE0, 0x27, 0x31, 0x3F, 0x3F, 0x33, 0x1A, 0x68, 0x52, 0x2B, 0xA5,
-    0x9C, 0xF4, 0xB6, 0xEE, 0x26, 0xE1, 0x88, 0x7E, 0x61, 0x7E, 0x98, 0x0C, 0x95, 0x7D, 0xA2, 0xE4,
-    0x38, 0xDE, 0x53, 0x86, 0xC8, 0x4D, 0x7F, 0xE2, 0xF1, 0x88, 0xC9, 0xFC, 0xE7, 0x63, 0x75, 0x3E,
-    0x20, 0xEF, 0xD4, 0x6F, 0xA8, 0xB7, 0x36, 0xF8, 0xE0, 0x3D, 0xEE, 0x51, 0x3C, 0xC0, 0x4F, 0x4D,
-    0x90, 0xB1, 0x0D, 0x83, 0x30, 0x14, 0x44, 0x0F, 0x53, 0x50, 0xD0, 0xA6, 0x77, 0x36, 0x60, 0x04,
-    0xCA, 0x8C, 0x90, 0x55, 0xD2, 0xC1, 0x26, 0x59, 0x24, 0x12, 0x8C, 0x90, 0x11, 0x18, 0x81, 0x22,
-    0x05, 0x52, 0x88, 0x2F, 0x77, 0x36, 0x91, 0xE2, 0xE2, 0xFB, 0xC9, 0x7A, 0xFF, 0xFE, 0x97, 0x81,
-    0xBF, 0x73, 0x3B, 0xEE, 0x2A, 0x1D, 0xD0, 0x70, 0x2C, 0x10, 0xB9, 0x14, 0x18, 0xB8, 0x15, 0x85,
-    0x4C, 0x87, 0xC2, 0x22, 0xC5, 0x27, 0xBA, 0x2C, 0x0D, 0x38, 0xD5, 0x96, 0xAA, 0x0F, 0x12, 0x2C,
-    0x35, 0x7B, 0x45, 0x0C, 0x92, 0x62, 0x0A, 0x44, 0xBF, 0x38, 0xE5, 0x2D, 0xD8, 0x9C, 0x42, 0x41,
-    0xCA, 0x29, 0x09, 0x13, 0xC7, 0x28, 0xD8, 0x41, 0x2E, 0xBD, 0xE0, 0x55, 0x93, 0x5B, 0xE7, 0x01,
-    0x7A, 0x5E, 0x5B, 0x81, 0x1B, 0xE6, 0xA0, 0x52, 0xBB, 0x51, 0x0D, 0xBC, 0xD8, 0x87, 0xA4, 0xBB,
-    0x14, 0xC0, 0x92, 0x14, 0x20, 0x64, 0xF0, 0x3E, 0x53, 0xAA, 0xAD, 0x48, 0xD2, 0x1E, 0xAB, 0xA1,
-    0xD5, 0x84, 0xD9, 0x10, 0xBC, 0x59, 0x3E, 0xD3, 0x75, 0x2F, 0xD0, 0x15, 0xC5, 0x49, 0x73, 0x81,
-    0xC0, 0xDF, 0xFF, 0x3C, 0x7E, 0x70, 0x76, 0xF9, 0x02,
+static const uint8_t notoserif_18_italicBitmaps[53069] = {
+    0xDD, 0x5A, 0x3F, 0xAC, 0xDD, 0xD6, 0x79, 0x3F, 0x24, 0xF5, 0x44, 0xD8, 0x44, 0xC3, 0x0E, 0x72,
+    0x1B, 0x54, 0xAD, 0xB9, 0x74, 0x28, 0x02, 0x5B, 0x5C, 0xD5, 0x42, 0xEF, 0x91, 0x8D, 0x87, 0xAC,
+    0x2A, 0x60, 0x0F, 0x45, 0x87, 0xEE, 0xF5, 0x70, 0x17, 0x0F, 0x1E, 0xA4, 0x90, 0x70, 0x87, 0x0C,
+    0x19, 0xA2, 0xC5, 0x5E, 0xA3, 0x41, 0x43, 0xAB, 0x0C, 0x36, 0x8A, 0x0C, 0x46, 0xF2, 0x2C, 0xD2,
+    0xF1, 0x90, 0xA1, 0x43, 0x88, 0x06, 0x68, 0xC6, 0xB0, 0xAD, 0x82, 0x36, 0x6D, 0x01, 0xB1, 0x2D,
+    0x9D, 0x50, 0x12, 0x2F, 0x4F, 0xBF, 0xDF, 0xEF, 0x3B, 0x87, 0xBC, 0xD7, 0xFA, 0xD3, 0x34, 0x46,
+    0x53, 0xB4, 0x0F, 0xEF, 0x9E, 0xC3, 0xF7, 0x2E, 0x79, 0xCE, 0xF7, 0xFD, 0xBE, 0xFF, 0xDF, 0xA1,
+    0xC9, 0x7A, 0x93, 0x77, 0xA6, 0x68, 0xF9, 0x5B, 0x9B, 0xAA, 0x34, 0x95, 0x31, 0x8D, 0x31, 0x8B,
+    0x31, 0x7B, 0x63, 0x66, 0xFC, 0x06, 0xA3, 0x09, 0x07, 0xFC, 0x46, 0xBD, 0x89, 0x3A, 0x13, 0xB5,
+    0x26, 0x6E, 0x4D, 0x50, 0x1A, 0xFD, 0xC9, 0xE4, 0x89, 0xD6, 0x34, 0xFC, 0x95, 0xA7, 0x2F, 0xF0,
+    0x9F, 0xBF, 0x6E, 0x4C, 0x30, 0xC8, 0x77, 0x1D, 0xD7, 0x0A, 0x65, 0x99, 0x44, 0xFE, 0xCC, 0x5B,
+    0x83, 0x5B, 0x8C, 0x95, 0x6F, 0x65, 0xF1, 0x48, 0xFE, 0x1D, 0x8F, 0xC6, 0xA4, 0x83, 0x7E, 0x70,
+    0x37, 0x6E, 0x29, 0xFC, 0xA7, 0xD6, 0xDB, 0xF9, 0x31, 0xC7, 0x9F, 0x02, 0x1F, 0xF9, 0x7F, 0x2E,
+    0xF7, 0xA4, 0x72, 0x6F, 0x22, 0xCF, 0x46, 0xB2, 0x06, 0x28, 0x36, 0xA7, 0xF2, 0xB9, 0xE0, 0xC8,
+    0x8B, 0xEA, 0x83, 0x2F, 0xCE, 0xE4, 0x93, 0xCB, 0x53, 0x59, 0xAB, 0x4F, 0xA5, 0xF2, 0x54, 0xD2,
+    0x2B, 0x71, 0xFE, 0xE3, 0xA9, 0x49, 0x7B, 0xFD, 0x1C, 0x51, 0x55, 0xAF, 0x0C, 0x00, 0x20, 0xF0,
+    0x15, 0x4D, 0xFA, 0x18, 0x6E, 0xC3, 0xD7, 0xF2, 0x55, 0x38, 0xE9, 0x93, 0xB8, 0xF3, 0x8E, 0x23,
+    0x23, 0xB8, 0x1F, 0xEF, 0xE3, 0x25, 0x5A, 0xE4, 0xB1, 0x53, 0x73, 0xCD, 0x8C, 0x49, 0x77, 0x26,
+    0x20, 0x7D, 0xE9, 0xEE, 0x5F, 0x14, 0x76, 0xAA, 0xAC, 0x80, 0x60, 0x92, 0x3A, 0xEF, 0x8B, 0xA1,
+    0xE8, 0xB1, 0x97, 0xFB, 0x69, 0x64, 0xA1, 0xC8, 0xDA, 0x52, 0x16, 0x87, 0x8C, 0xB0, 0xCF, 0xDE,
+    0x44, 0x63, 0x30, 0xCB, 0xAE, 0xD1, 0x28, 0xF8, 0xC5, 0x22, 0x93, 0x59, 0xB6, 0x92, 0x41, 0xE4,
+    0x32, 0x0B, 0x5B, 0xD1, 0x2C, 0xCF, 0x47, 0x53, 0xC1, 0xA1, 0x96, 0x9B, 0x05, 0xA4, 0x78, 0x10,
+    0x4A, 0x12, 0x37, 0x80, 0x69, 0x0C, 0x6D, 0x05, 0xF0, 0x2A, 0xA0, 0x58, 0x40, 0xE6, 0x72, 0xF3,
+    0x5E, 0xF8, 0x14, 0xDA, 0xD3, 0x5E, 0xF6, 0x89, 0x96, 0x46, 0x98, 0x69, 0x44, 0x4A, 0xE6, 0x44,
+    0x25, 0x7D, 0x2E, 0xC2, 0x12, 0x7E, 0x8B, 0xC9, 0x84, 0x8F, 0x47, 0xB3, 0xFB, 0xD1, 0x10, 0x58,
+    0xB9, 0x6F, 0xF2, 0x50, 0x3D, 0x4B, 0x78, 0x22, 0x7E, 0x0F, 0x17, 0x64, 0x1E, 0xEE, 0x1D, 0x6C,
+    0x0E, 0x3A, 0xC8, 0x9F, 0xF0, 0x8D, 0xE6, 0x4B, 0x76, 0xB9, 0x53, 0x59, 0x3B, 0x79, 0xEE, 0x77,
+    0x16, 0xA2, 0xB3, 0x00, 0x21, 0x1D, 0xA3, 0x3D, 0x97, 0xB5, 0x94, 0xBA, 0xA5, 0xFC, 0x65, 0xBC,
+    0xA2, 0x6B, 0x73, 0x75, 0x43, 0x85, 0x55, 0xF4, 0x9D, 0xC8, 0x29, 0x5F, 0x95, 0xB8, 0x31, 0x37,
+    0x29, 0x06, 0x20, 0x6D, 0xE2, 0x83, 0x7F, 0x9F, 0xF3, 0x19, 0xBD, 0x9B, 0xC8, 0x9F, 0x51, 0x7B,
+    0x65, 0x91, 0xC1, 0xC4, 0xBD, 0x09, 0x7A, 0x28, 0xB8, 0x68, 0x57, 0x61, 0xAD, 0x6D, 0xDD, 0xD8,
+    0xC8, 0x58, 0xAF, 0x52, 0xCA, 0xED, 0x2D, 0x59, 0xC1, 0x3E, 0x00, 0x9D, 0x53, 0x20, 0x94, 0x88,
+    0x49, 0x59, 0x82, 0xD1, 0x94, 0xD0, 0x4F, 0x41, 0x21, 0x33, 0xB8, 0x0E, 0x1C, 0xB5, 0x01, 0xA9,
+    0x05, 0x02, 0xAA, 0x69, 0x02, 0x14, 0x56, 0xA3, 0x16, 0x18, 0xFB, 0x90, 0xB7, 0xE8, 0xFA, 0x79,
+    0xBF, 0xDD, 0x93, 0x28, 0xE9, 0x07, 0xA3, 0xFC, 0x27, 0xE3, 0xB7, 0x05, 0xF7, 0x14, 0xC4, 0x61,
+    0xC3, 0x7D, 0x00, 0x85, 0xB1, 0xCD, 0x0C, 0xA2, 0x40, 0x9A, 0x39, 0xB9, 0xEE, 0x28, 0xD5, 0x7D,
+    0x39, 0xA6, 0xC4, 0x2A, 0x27, 0x0D, 0x5F, 0xC5, 0x18, 0xFC, 0x07, 0x70, 0x8B, 0x7E, 0x88, 0x95,
+    0xD3, 0xAF, 0x61, 0xC7, 0xB3, 0x84, 0x66, 0x83, 0xDD, 0xC3, 0x01, 0x22, 0x4E, 0x5A, 0x08, 0x39,
+    0x2B, 0x61, 0x3D, 0x37, 0x29, 0xEC, 0x09, 0x3B, 0x46, 0xDC, 0x3A, 0xA5, 0xF5, 0xE7, 0xEF, 0xBE,
+    0xD1, 0xBC, 0x5B, 0x8A, 0x14, 0x05, 0xA0, 0x3F, 0xBB, 0x7B, 0xD7, 0xDE, 0x5D, 0xC5, 0x12, 0xA8,
+    0x70, 0xE6, 0x8D, 0x75, 0x68, 0x93, 0x79, 0xB1, 0xB1, 0xB7, 0x65, 0x43, 0x6B, 0x07, 0x92, 0xBB,
+    0x40, 0xDF, 0x2D, 0x86, 0x45, 0x0C, 0x42, 0x76, 0x49, 0x8D, 0x79, 0x45, 0x87, 0x97, 0xF1, 0xCC,
+    0x2B, 0x18, 0xAE, 0x61, 0x78, 0x1B, 0xC3, 0xB7, 0x31, 0x3C, 0x06, 0x93, 0xD6, 0xCE, 0xB0, 0x31,
+    0xE2, 0xDB, 0x40, 0x8E, 0xD0, 0x41, 0x78, 0x36, 0x42, 0xA3, 0xEA, 0xA9, 0x43, 0xDE, 0x7E, 0x11,
+    0xDF, 0xDE, 0x84, 0x7A, 0xDE, 0x03, 0x26, 0x4D, 0x29, 0x94, 0x14, 0x8F, 0x6C, 0x6F, 0x12, 0x0B,
+    0x6C, 0x5E, 0x2A, 0x57, 0xD1, 0x66, 0x22, 0x86, 0xC0, 0xBE, 0x3F, 0x08, 0xD4, 0xA2, 0xAC, 0x62,
+    0x1D, 0xB3, 0xE8, 0x73, 0x38, 0x09, 0x2F, 0x41, 0x4F, 0x26, 0x28, 0x08, 0xCA, 0x07, 0x00, 0xC9,
+    0x1D, 0xE2, 0x76, 0x8A, 0xEF, 0x5B, 0xA8, 0xCB, 0xFB, 0x93, 0xA9, 0x46, 0xB9, 0x53, 0x64, 0x6B,
+    0x61, 0x05, 0x55, 0xB9, 0x0D, 0xF7, 0x0E, 0x87, 0x06, 0x0E, 0x6D, 0x11, 0x21, 0xCA, 0xCD, 0x79,
+    0x29, 0xCB, 0xA6, 0x9D, 0xAC, 0x18, 0x2F, 0xA2, 0x68, 0xC6, 0x7A, 0x03, 0x14, 0x84, 0xEC, 0x94,
+    0xC9, 0x30, 0xE6, 0x32, 0x0C, 0x67, 0xF0, 0x09, 0xD7, 0x60, 0xC1, 0x6F, 0xC1, 0x16, 0x3E, 0x30,
+    0xE6, 0x1E, 0x30, 0x06, 0x49, 0x11, 0x48, 0x8A, 0x07, 0xAF, 0xFD, 0x70, 0x90, 0xF4, 0x96, 0x94,
+    0xFE, 0x76, 0x47, 0x72, 0x7C, 0x47, 0xF5, 0xBC, 0x3B, 0x8A, 0xF5, 0x0E, 0xF7, 0x53, 0x09, 0x2E,
+    0xB1, 0x6D, 0x44, 0xFF, 0x7A, 0x81, 0x44, 0xBE, 0x5E, 0xF0, 0x75, 0x45, 0x36, 0xB1, 0x4A, 0x05,
+    0x45, 0xBF, 0x87, 0x3F, 0x67, 0xE1, 0x5F, 0x56, 0x2B, 0x7A, 0x59, 0x28, 0xDD, 0xCB, 0x3F, 0x62,
+    0xA8, 0x79, 0x08, 0x2B, 0xCF, 0xBF, 0x69, 0xC5, 0x1D, 0x04, 0xB6, 0x85, 0x06, 0xC3, 0xED, 0xA5,
+    0x43, 0xE1, 0x5C, 0x54, 0x3C, 0x34, 0xEB, 0x00, 0x67, 0xD5, 0xCB, 0x16, 0x59, 0x2B, 0x82, 0xAC,
+    0xCA, 0x78, 0x79, 0x53, 0x30, 0x69, 0x44, 0x5A, 0x26, 0x78, 0xFD, 0xC8, 0x53, 0x26, 0xF0, 0x94,
+    0x45, 0x97, 0xC3, 0x4B, 0x24, 0x83, 0x38, 0x9A, 0x78, 0x10, 0xA1, 0x45, 0xA3, 0x98, 0x49, 0x34,
+    0xCA, 0x1E, 0x32, 0xF4, 0x7E, 0x10, 0x4D, 0x88, 0x71, 0x95, 0x0C, 0xF2, 0x45, 0x3E, 0xC8, 0x2D,
+    0xCD, 0x10, 0x2D, 0x7F, 0xF2, 0x40, 0x2C, 0xD7, 0xEE, 0x3A, 0xF3, 0x5B, 0x77, 0xA8, 0x3E, 0xE4,
+    0xBB, 0x29, 0x9D, 0x07, 0xA3, 0x06, 0xCB, 0x8A, 0x57, 0x81, 0xEE, 0x39, 0x90, 0xB9, 0xC7, 0x70,
+    0xF9, 0x2F, 0x7B, 0x28, 0x0A, 0xC4, 0xEF, 0xE9, 0x11, 0xBA, 0x6D, 0x19, 0xE0, 0xD7, 0xF9, 0x97,
+    0xE7, 0xFC, 0xAC, 0xE1, 0x53, 0xC4, 0x5D, 0xAD, 0x61, 0x4B, 0xB0, 0x4F, 0x47, 0x38, 0xC5, 0x4C,
+    0x74, 0xAF, 0x7D, 0xFE, 0x0A, 0xA1, 0xB0, 0x31, 0x9B, 0x44, 0xF8, 0xDD, 0x93, 0xC6, 0x1B, 0x34,
+    0x8E, 0xC1, 0x5C, 0x6E, 0x9D, 0x2F, 0x53, 0x91, 0x2D, 0xA5, 0x48, 0xAC, 0xCF, 0xFA, 0x58, 0x82,
+    0x43, 0x38, 0x0B, 0xD2, 0x7B, 0xD1, 0x8A, 0xE5, 0xE5, 0xCD, 0x33, 0x3B, 0x8F, 0x0C, 0x6D, 0x16,
+    0x8A, 0xC2, 0x45, 0xDD, 0x0F, 0x74, 0x02, 0xDA, 0x30, 0x68, 0x44, 0x0F, 0x81, 0xFB, 0x66, 0x20,
+    0x26, 0x16, 0x88, 0x84, 0x46, 0x53, 0xE0, 0xD3, 0x6B, 0x64, 0x0D, 0xDC, 0x77, 0x49, 0xA7, 0x1C,
+    0xD2, 0x89, 0xF1, 0x5B, 0xD0, 0x41, 0x67, 0x66, 0x1E, 0x73, 0x0A, 0xFF, 0x91, 0x53, 0xF4, 0x7D,
+    0xFA, 0xB3, 0xF4, 0xCF, 0x39, 0x65, 0x11, 0x3D, 0xF8, 0xA9, 0x7A, 0x89, 0x73, 0x75, 0x19, 0x23,
+    0xA7, 0xB0, 0xA7, 0x10, 0xE2, 0x96, 0x53, 0x5A, 0x93, 0xBA, 0x4C, 0x89, 0x84, 0x6B, 0x06, 0xF6,
+    0x9C, 0xE0, 0xE7, 0x45, 0x0A, 0x91, 0x46, 0xE1, 0x58, 0xF3, 0x8E, 0xB4, 0xA4, 0x48, 0x73, 0xF5,
+    0x0E, 0x67, 0x3A, 0xE1, 0xD1, 0xAA, 0xBD, 0x2C, 0x5E, 0xE8, 0xB2, 0x7D, 0x58, 0x88, 0x72, 0x16,
+    0x62, 0x73, 0x62, 0x6D, 0x3F, 0xA5, 0xF9, 0x5B, 0xCA, 0xB5, 0x69, 0xB3, 0x99, 0x5E, 0x3A, 0xC4,
+    0x0E, 0x15, 0x03, 0x90, 0x0A, 0x99, 0x9A, 0x01, 0x0D, 0x59, 0xD6, 0xAC, 0xC6, 0x32, 0xC8, 0x39,
+    0x44, 0xE3, 0x89, 0xDE, 0x6E, 0xD7, 0x31, 0x90, 0x93, 0x76, 0x4B, 0x27, 0x23, 0x02, 0xAE, 0x3A,
+    0x82, 0xED, 0xF2, 0x8D, 0x44, 0x93, 0x06, 0x3C, 0x00, 0xE5, 0x9C, 0x19, 0x40, 0xF0, 0x97, 0xD0,
+    0x88, 0xEF, 0xE0, 0x62, 0x47, 0x46, 0x0A, 0xC0, 0xDD, 0x40, 0xD3, 0xB1, 0x57, 0x28, 0x34, 0xEC,
+    0x2C, 0xA3, 0xA6, 0x70, 0xBE, 0x1C, 0x48, 0x26, 0x68, 0x10, 0x43, 0x32, 0x7A, 0xD6, 0xA6, 0x4E,
+    0x25, 0x67, 0xD8, 0xE3, 0x57, 0xB6, 0x12, 0xF2, 0x64, 0x51, 0x31, 0x74, 0x79, 0x36, 0xE8, 0x03,
+    0xFB, 0x19, 0x97, 0xCC, 0x7D, 0x7C, 0xD4, 0xC9, 0x86, 0x2D, 0x0E, 0x15, 0x94, 0x27, 0x2D, 0xE3,
+    0x99, 0x23, 0x3D, 0xAE, 0x13, 0x39, 0xD6, 0xF9, 0x6D, 0x68, 0xA5, 0xA8, 0x64, 0x68, 0x6F, 0x81,
+    0x99, 0x8A, 0x80, 0xD2, 0x52, 0x9D, 0xA3, 0x3D, 0x80, 0x7A, 0x24, 0xD4, 0xBF, 0xB9, 0x68, 0x40,
+    0x6C, 0x54, 0x68, 0xD8, 0xBA, 0x51, 0x6A, 0xAC, 0x06, 0x41, 0xF9, 0x5E, 0x96, 0x72, 0x09, 0x64,
+    0xE8, 0x26, 0x4D, 0x29, 0x22, 0x37, 0x29, 0xEA, 0x70, 0xCE, 0xC2, 0x11, 0xFC, 0x98, 0x3C, 0x80,
+    0x15, 0xE4, 0x71, 0x07, 0x37, 0x53, 0x96, 0x41, 0xB3, 0xB6, 0x4E, 0x13, 0x53, 0xA6, 0xC0, 0xC0,
+    0x44, 0xA0, 0x86, 0xF6, 0x23, 0x5F, 0x9A, 0x14, 0xEA, 0x1E, 0x9B, 0x5F, 0x7C, 0x12, 0xEA, 0x94,
+    0x81, 0x8E, 0xC4, 0x03, 0x6C, 0xCD, 0x80, 0x29, 0x23, 0xD5, 0x93, 0x54, 0xF5, 0x24, 0x53, 0x0F,
+    0xF2, 0xF2, 0x9A, 0xA8, 0x68, 0x30, 0x24, 0xF1, 0x6B, 0x50, 0x74, 0x22, 0xD0, 0xD8, 0x47, 0x3D,
+    0xD9, 0x7B, 0x27, 0xEC, 0x85, 0xB1, 0x4E, 0x6A, 0x4A, 0x99, 0xDA, 0x97, 0x4B, 0x18, 0x41, 0xFC,
+    0x6D, 0xEA, 0x49, 0xD0, 0x93, 0x86, 0xA8, 0x23, 0xF1, 0x50, 0x7E, 0x4B, 0xC3, 0xDC, 0x29, 0x99,
+    0xB0, 0x10, 0x5B, 0xFE, 0x0F, 0x11, 0xAF, 0xD9, 0x9B, 0x27, 0x1E, 0x51, 0xF9, 0x17, 0x26, 0xDE,
+    0x3B, 0x5C, 0x97, 0x0E, 0x39, 0xCF, 0x2B, 0x9B, 0xD7, 0x9A, 0x0D, 0x3E, 0x32, 0x6A, 0xDE, 0xC7,
+    0xDE, 0x8F, 0x91, 0x00, 0x4C, 0x80, 0xB8, 0xA6, 0x8B, 0xE4, 0x6E, 0xE4, 0x8A, 0xB6, 0xF5, 0x8E,
+    0x8C, 0xC9, 0x68, 0x49, 0x5B, 0xFD, 0x7D, 0xA3, 0xCA, 0xEE, 0xA9, 0x8D, 0x95, 0x5A, 0xD5, 0x77,
+    0x4F, 0x9F, 0x73, 0x57, 0xAA, 0xC8, 0x50, 0x8E, 0xE0, 0x8D, 0x37, 0x4A, 0xA4, 0x39, 0x92, 0xF9,
+    0x61, 0xAD, 0x1D, 0xAD, 0x87, 0x69, 0x57, 0x4B, 0x6E, 0x30, 0x09, 0x37, 0xB9, 0x26, 0xC0, 0x78,
+    0xBC, 0xD0, 0xCD, 0x85, 0x1B, 0x66, 0xCC, 0xA2, 0x4E, 0x80, 0xBD, 0xA4, 0xFA, 0x5B, 0xC5, 0xE5,
+    0xBE, 0x59, 0x13, 0x33, 0x91, 0x43, 0x9D, 0x3A, 0x49, 0x94, 0x19, 0x45, 0xD3, 0x74, 0xFA, 0x21,
+    0x12, 0x44, 0xC3, 0xD7, 0x41, 0xCC, 0xA7, 0x1B, 0xE3, 0x42, 0x92, 0xF5, 0x51, 0x7B, 0x71, 0x72,
+    0xA1, 0x6C, 0x7C, 0x8E, 0xBD, 0x26, 0xDA, 0xDE, 0x2E, 0xA8, 0x5C, 0x9A, 0x61, 0xC7, 0xD6, 0x19,
+    0x9C, 0x2F, 0x7B, 0xD6, 0xBA, 0xE7, 0xE0, 0xA2, 0x3F, 0x48, 0x9E, 0x5C, 0xEE, 0xE4, 0x24, 0xE6,
+    0xB3, 0x7C, 0x4A, 0x4C, 0xD3, 0x83, 0xDA, 0x13, 0x58, 0xFA, 0x98, 0x29, 0xDE, 0x05, 0xCC, 0xEC,
+    0xEC, 0x3F, 0xF1, 0x23, 0xA2, 0x9A, 0xF9, 0x51, 0x96, 0xCD, 0xC6, 0xEA, 0xC6, 0xE2, 0xC6, 0xDA,
+    0xCA, 0x92, 0x2A, 0x5A, 0xE8, 0xD9, 0x50, 0x15, 0x8B, 0xB7, 0x04, 0x65, 0x38, 0xCA, 0xC0, 0x56,
+    0x32, 0x37, 0xF2, 0x74, 0x75, 0x4F, 0xD2, 0x46, 0x8A, 0xA2, 0xD0, 0xF9, 0xD1, 0xE4, 0xE3, 0xA6,
+    0x97, 0xF9, 0xA1, 0x63, 0xAB, 0x37, 0x9D, 0x24, 0x8D, 0x4A, 0xE4, 0x61, 0xE5, 0xF1, 0x64, 0x72,
+    0xEB, 0xC6, 0xE9, 0x20, 0x5B, 0x1F, 0x36, 0x25, 0x53, 0x1B, 0xD0, 0xF1, 0x99, 0x1B, 0x3E, 0x6F,
+    0x2B, 0xE7, 0xAE, 0xC7, 0x55, 0x61, 0x2B, 0x7A, 0xD4, 0xC6, 0x29, 0xB4, 0xC0, 0x9B, 0x0B, 0x4F,
+    0x40, 0xB8, 0x40, 0x1A, 0x29, 0x20, 0xC3, 0x95, 0x81, 0x09, 0x26, 0x74, 0xF0, 0xAB, 0x0E, 0xED,
+    0x73, 0x5D, 0x5F, 0xEB, 0xA5, 0x45, 0x6B, 0x20, 0xD9, 0xA3, 0x70, 0x0C, 0x4D, 0x3A, 0xC7, 0xBD,
+    0xEE, 0x9A, 0xB5, 0xCA, 0x56, 0xC5, 0x39, 0xFE, 0x19, 0x81, 0x33, 0xC9, 0xE3, 0x07, 0xCA, 0xD6,
+    0xE2, 0xD8, 0x1B, 0xB9, 0x9B, 0x30, 0xA8, 0x74, 0x66, 0x5D, 0xA4, 0xE5, 0x46, 0xAB, 0xF6, 0x87,
+    0x42, 0xAE, 0x54, 0x46, 0x1B, 0x27, 0x20, 0x72, 0xEE, 0x5C, 0x2D, 0xBE, 0x94, 0xD4, 0x87, 0x92,
+    0x4A, 0xE4, 0x1A, 0xC2, 0x0A, 0x70, 0x23, 0xD5, 0xC6, 0xE9, 0x8D, 0x2A, 0xCE, 0x2F, 0x24, 0x96,
+    0x27, 0x85, 0xF3, 0x2C, 0xB1, 0x0C, 0x4F, 0x13, 0x8B, 0x1A, 0xFA, 0x40, 0x3B, 0x46, 0x06, 0x0A,
+    0xC7, 0x2A, 0x94, 0x26, 0xAD, 0x56, 0x79, 0xEA, 0x55, 0x9D, 0x53, 0x4D, 0x69, 0x53, 0x99, 0xC4,
+    0xDC, 0x8C, 0x66, 0x56, 0x30, 0xFA, 0x12, 0x7A, 0x0E, 0xD8, 0x1E, 0xFF, 0x62, 0xCD, 0x15, 0x3E,
+    0xC0, 0x4E, 0xDF, 0x81, 0x6D, 0xFE, 0x00, 0x57, 0x9F, 0x0A, 0xA1, 0xE9, 0x9F, 0x62, 0xDF, 0x01,
+    0x29, 0x25, 0x53, 0xA9, 0x41, 0x18, 0x39, 0x05, 0x15, 0xE1, 0x20, 0xBB, 0xDD, 0x80, 0x6A, 0x84,
+    0xBD, 0x30, 0x8A, 0x54, 0x59, 0x08, 0x91, 0x6A, 0xA4, 0x07, 0xF3, 0x91, 0x94, 0xF3, 0x51, 0xDB,
+    0x30, 0x37, 0xAA, 0xCA, 0xB4, 0xA4, 0x97, 0xA9, 0x8B, 0x3A, 0x23, 0x10, 0x69, 0x59, 0xD4, 0xA7,
+    0x2C, 0xC3, 0xE4, 0xAA, 0x3D, 0x67, 0x8A, 0x9F, 0x0A, 0xE9, 0x03, 0x41, 0xC9, 0x4C, 0xFE, 0x3D,
+    0x15, 0xD4, 0x15, 0x93, 0xFD, 0xB0, 0x25, 0x38, 0xA7, 0x26, 0xFD, 0x71, 0x49, 0x80, 0xAE, 0x09,
+    0x4F, 0x5A, 0x4E, 0xDC, 0x40, 0xD1, 0x48, 0xB8, 0x24, 0xF9, 0x9D, 0x15, 0x26, 0x46, 0x57, 0xE4,
+    0x08, 0x6F, 0xDA, 0xDB, 0x71, 0x1F, 0x22, 0x2A, 0x8A, 0x43, 0x8E, 0xDB, 0x98, 0x92, 0x4A, 0x59,
+    0x26, 0xA0, 0x22, 0x16, 0x3D, 0xD1, 0xE2, 0xAA, 0xE9, 0xBD, 0x51, 0xA2, 0x1F, 0x64, 0x1C, 0x30,
+    0x57, 0x70, 0xF1, 0xDD, 0x59, 0x3B, 0x37, 0xE6, 0x67, 0x7B, 0x57, 0xE3, 0x91, 0x65, 0xC8, 0x71,
+    0x10, 0x68, 0x3F, 0x64, 0x9D, 0x2E, 0x8A, 0x37, 0x32, 0x11, 0x2C, 0xF4, 0x22, 0xEA, 0x44, 0xFD,
+    0x41, 0x53, 0x24, 0x65, 0x04, 0x12, 0x54, 0x01, 0x20, 0x99, 0x90, 0xA5, 0x0A, 0xFF, 0xD1, 0x8C,
+    0x18, 0x28, 0x4C, 0x87, 0xFB, 0xA8, 0xE5, 0x45, 0x60, 0x63, 0x5E, 0x88, 0x14, 0xBE, 0xD2, 0x6A,
+    0xEE, 0x58, 0x7D, 0xBD, 0x26, 0xEB, 0xA6, 0xF8, 0x41, 0xA9, 0xBD, 0xA3, 0xFC, 0x81, 0xAB, 0x32,
+    0x53, 0xEA, 0x92, 0x50, 0x90, 0x2C, 0xAE, 0x55, 0xA0, 0xC5, 0x33, 0x24, 0xB6, 0x67, 0x4C, 0xBA,
+    0xAD, 0xF5, 0x12, 0x83, 0xD0, 0x7C, 0x18, 0x96, 0x02, 0x72, 0x6B, 0x72, 0x4D, 0x20, 0x6D, 0x9D,
+    0xCC, 0xCC, 0x45, 0xA0, 0xFF, 0x3E, 0x7F, 0x6B, 0x57, 0x43, 0x10, 0xBB, 0x58, 0x18, 0x72, 0x28,
+    0x05, 0x49, 0xD1, 0x75, 0x62, 0x5C, 0xCA, 0x7B, 0x6A, 0x65, 0xDE, 0x33, 0x13, 0x93, 0xF2, 0xA6,
+    0xE7, 0xC4, 0x5C, 0xAC, 0x60, 0x40, 0x92, 0x20, 0xE7, 0xAC, 0x87, 0x93, 0xE5, 0xCA, 0x92, 0xC0,
+    0x60, 0x92, 0x05, 0x11, 0x97, 0xC4, 0x1C, 0x33, 0x4D, 0x78, 0x18, 0x97, 0x34, 0xB1, 0xB4, 0xEC,
+    0x44, 0x24, 0xCC, 0x6C, 0x1F, 0x91, 0x4C, 0x15, 0x91, 0xAF, 0x80, 0xC5, 0xDA, 0xEE, 0xB8, 0xCC,
+    0x8C, 0x0E, 0xB4, 0xCD, 0x07, 0x1A, 0x1C, 0x89, 0xAC, 0xCA, 0x70, 0x71, 0x49, 0xB0, 0xDA, 0x9C,
+    0xEB, 0xF1, 0x1C, 0x25, 0xC1, 0x9C, 0x66, 0xF6, 0x3B, 0x7C, 0x72, 0x36, 0xD1, 0x11, 0x89, 0x66,
+    0xE5, 0x4C, 0xC7, 0x7E, 0x43, 0xD5, 0x84, 0xB6, 0x92, 0x3E, 0xFA, 0xCB, 0x5F, 0x2E, 0x3F, 0x28,
+    0x35, 0x3F, 0xF8, 0xE7, 0xA7, 0xE5, 0x07, 0xFF, 0xA7, 0xE5, 0x50, 0x1D, 0x33, 0x7F, 0x34, 0x69,
+    0x4A, 0xEE, 0x93, 0x96, 0x78, 0xF9, 0x63, 0xC5, 0x42, 0x1F, 0x64, 0x62, 0xF1, 0x44, 0x11, 0x73,
+    0xD9, 0x15, 0x31, 0xCB, 0x71, 0x11, 0x63, 0x0E, 0x8B, 0x98, 0xE6, 0x29, 0xF2, 0x73, 0x39, 0x36,
+    0x6B, 0x99, 0x89, 0x1B, 0xC7, 0xCB, 0xB7, 0x90, 0xFF, 0x26, 0xBA, 0x72, 0x3A, 0x64, 0x3A, 0xB9,
+    0x30, 0xCC, 0x4E, 0x95, 0xF8, 0xFC, 0x89, 0xF2, 0x23, 0x96, 0x52, 0x72, 0xEE, 0x29, 0xBF, 0xC0,
+    0x65, 0xF7, 0x56, 0xE5, 0x87, 0x5D, 0x2D, 0x2B, 0xE0, 0x37, 0x45, 0x7E, 0xF9, 0x44, 0xF9, 0x5D,
+    0x9C, 0x0F, 0x7A, 0x6B, 0x3D, 0x7B, 0x6B, 0x0B, 0x94, 0x05, 0xD9, 0x84, 0xE8, 0x03, 0xA2, 0x45,
+    0xED, 0x7A, 0xD5, 0x39, 0xFB, 0x12, 0x97, 0x7C, 0x04, 0x50, 0xC5, 0x70, 0x51, 0x54, 0xAB, 0x98,
+    0x45, 0xE3, 0x3C, 0xB5, 0x49, 0x7B, 0x8B, 0xB9, 0x16, 0x3C, 0x96, 0x77, 0x35, 0x84, 0x31, 0x77,
+    0x61, 0x4B, 0xCA, 0x15, 0xD4, 0x08, 0x37, 0xA9, 0xA1, 0x1F, 0x31, 0x38, 0x68, 0xED, 0x81, 0x1E,
+    0x5E, 0x87, 0x64, 0x10, 0x11, 0x74, 0x79, 0x13, 0x25, 0xB3, 0xF2, 0xCE, 0x1E, 0x44, 0x02, 0xE7,
+    0xBF, 0x4F, 0x75, 0xEC, 0xE2, 0x31, 0x98, 0x33, 0x3C, 0x7A, 0x7E, 0x05, 0x8F, 0xDE, 0xB8, 0x06,
+    0x95, 0x7E, 0xFB, 0x2A, 0x24, 0xFF, 0xD6, 0x7F, 0x19, 0xEE, 0xCB, 0x2D, 0x84, 0x7D, 0x8E, 0xFC,
+    0x82, 0xFC, 0xBC, 0x68, 0x17, 0x8D, 0x96, 0x48, 0x00, 0x24, 0x2E, 0x55, 0xB6, 0xC7, 0xD4, 0xD8,
+    0x2E, 0xD9, 0xF3, 0x51, 0x1A, 0xE4, 0xA0, 0x53, 0xC7, 0x29, 0x69, 0x39, 0x65, 0xBA, 0xD7, 0x99,
+    0x2A, 0xC1, 0x0D, 0xDD, 0x7F, 0xA2, 0x9A, 0xB2, 0x53, 0xBA, 0xB0, 0xB6, 0x40, 0x9B, 0x45, 0x15,
+    0x3D, 0xD5, 0x5C, 0xE2, 0x4C, 0x83, 0xF0, 0x0D, 0x65, 0x87, 0xA4, 0x55, 0x7F, 0x48, 0x7A, 0x8A,
+    0xD7, 0xB4, 0x74, 0xFC, 0xBA, 0x32, 0xFC, 0x0D, 0x72, 0x59, 0x7C, 0x53, 0x45, 0xFC, 0x91, 0xDA,
+    0xBB, 0xA6, 0x2E, 0xD9, 0x51, 0x91, 0xA0, 0x1D, 0xD9, 0x4A, 0xE4, 0x16, 0xDC, 0x12, 0x7D, 0x9E,
+    0xD1, 0x29, 0x97, 0x58, 0x24, 0x57, 0xF1, 0xE2, 0x3A, 0x15, 0x25, 0x09, 0x1E, 0xD0, 0x91, 0xC4,
+    0x15, 0xFA, 0x10, 0xE7, 0xBC, 0x42, 0x80, 0x19, 0xC9, 0x87, 0xD5, 0xF3, 0x0B, 0xB1, 0xFA, 0x9F,
+    0x8F, 0xA0, 0x5C, 0x98, 0x8A, 0x7E, 0x34, 0x82, 0x78, 0xE1, 0x2B, 0xFE, 0x64, 0x02, 0xFD, 0x72,
+    0x95, 0xBC, 0x36, 0x41, 0x9F, 0x84, 0xC9, 0x54, 0xC0, 0x39, 0x25, 0x9F, 0xAF, 0xCA, 0x4A, 0xE7,
+    0xBC, 0xBA, 0x26, 0x57, 0x23, 0xB9, 0xFD, 0x30, 0x9A, 0x89, 0x82, 0x35, 0x12, 0x3F, 0x15, 0x88,
+    0xB0, 0x0F, 0x67, 0xC5, 0x22, 0x6A, 0xC3, 0x59, 0xE1, 0x48, 0xEA, 0x60, 0x66, 0x80, 0x6B, 0x52,
+    0x59, 0x9D, 0x81, 0xAD, 0xB9, 0x22, 0x57, 0x0A, 0x8F, 0x44, 0x97, 0x3D, 0xC5, 0x56, 0x49, 0x5C,
+    0x5B, 0x06, 0xDF, 0x19, 0x51, 0x3D, 0x65, 0xBD, 0xB9, 0x6A, 0x88, 0xFA, 0x37, 0x77, 0xB6, 0xA0,
+    0xDA, 0x26, 0x59, 0x5D, 0x0D, 0xFB, 0x66, 0x23, 0x0E, 0x3A, 0x4C, 0x93, 0x93, 0xC7, 0x08, 0x18,
+    0xEA, 0xDA, 0x52, 0xF5, 0x99, 0x4D, 0x6F, 0xF1, 0x3A, 0xA3, 0xEA, 0x4C, 0xD4, 0x6B, 0x42, 0x94,
+    0xD6, 0xEA, 0x1B, 0xCF, 0xD4, 0xCA, 0xAC, 0x33, 0xB8, 0x46, 0xC1, 0xF7, 0x2E, 0xC6, 0x15, 0xFC,
+    0x6B, 0xCF, 0x26, 0xD0, 0x0E, 0xB5, 0x80, 0xE7, 0xD2, 0xCC, 0xD7, 0xF4, 0xB9, 0xB3, 0x50, 0xBD,
+    0xCE, 0xA4, 0x04, 0xCA, 0x26, 0x24, 0x39, 0x6D, 0xD5, 0x1E, 0x73, 0xB7, 0xE0, 0x47, 0xCA, 0x58,
+    0xE8, 0xA4, 0xB4, 0xB3, 0xF5, 0x45, 0xCD, 0x17, 0x5A, 0xF6, 0x03, 0x72, 0x3B, 0x8B, 0x4D, 0xD5,
+    0x85, 0x4E, 0x11, 0x2D, 0x9E, 0xA1, 0x23, 0x61, 0xA3, 0x03, 0xDD, 0x1E, 0xAC, 0x9B, 0xAB, 0x99,
+    0xDF, 0x50, 0x32, 0x47, 0x75, 0xD7, 0xCC, 0xFC, 0x7B, 0x4A, 0x40, 0x9C, 0x91, 0x5A, 0xC3, 0xA9,
+    0x9A, 0x86, 0x9E, 0x06, 0x3C, 0x52, 0xC6, 0x15, 0x54, 0x87, 0xE3, 0x67, 0xCA, 0xD9, 0xE3, 0x3A,
+    0xF6, 0xB8, 0x9C, 0x1D, 0xCD, 0x66, 0x61, 0x4C, 0x4D, 0x69, 0x5D, 0xB7, 0xD4, 0xC9, 0x76, 0xC6,
+    0xBB, 0x80, 0x52, 0x6B, 0x6A, 0xFA, 0x0A, 0x30, 0x20, 0xB4, 0x26, 0x9A, 0xD4, 0x40, 0x41, 0xAF,
+    0x29, 0xA0, 0x6F, 0xF9, 0x8A, 0x56, 0x73, 0x09, 0x75, 0xFC, 0xAB, 0xE2, 0x57, 0xDD, 0x41, 0x4C,
+    0xFB, 0xEF, 0xDE, 0x91, 0x0F, 0x6B, 0xD8, 0xB8, 0xC5, 0x3B, 0x42, 0xA5, 0x43, 0x92, 0x1F, 0xC6,
+    0xBD, 0x96, 0x77, 0x48, 0x5E, 0x59, 0x1D, 0x77, 0x02, 0x34, 0x5E, 0x48, 0xA8, 0x44, 0xAA, 0xF3,
+    0xE9, 0x8E, 0xDD, 0x26, 0xF0, 0x6C, 0xC1, 0x79, 0xC8, 0x1C, 0x2F, 0x62, 0xE7, 0x24, 0x61, 0xE3,
+    0x04, 0xBF, 0xAC, 0x77, 0x33, 0x56, 0xD7, 0x79, 0x7B, 0x70, 0x7C, 0x48, 0xAF, 0x2C, 0x5E, 0x4C,
+    0xE3, 0x8B, 0x64, 0x09, 0x96, 0x8B, 0x35, 0x90, 0xD6, 0xEF, 0x34, 0x08, 0x5B, 0x1F, 0x36, 0x5F,
+    0x11, 0x98, 0xFA, 0x4A, 0x16, 0x17, 0x3D, 0x1E, 0xD1, 0x35, 0x3D, 0x11, 0xF8, 0xEF, 0xDE, 0x02,
+    0x88, 0xBD, 0x67, 0xB0, 0x38, 0x2E, 0xE1, 0x8A, 0x83, 0x02, 0x51, 0x3C, 0xAE, 0x45, 0x59, 0xB0,
+    0x14, 0x02, 0xFD, 0xFE, 0xDB, 0xD9, 0x10, 0xEC, 0xBB, 0x74, 0x08, 0xAD, 0xE4, 0xAB, 0x11, 0x28,
+    0x66, 0xE7, 0x47, 0x82, 0x55, 0x8C, 0xCE, 0x6F, 0x32, 0x26, 0x20, 0x1B, 0x24, 0x0F, 0x42, 0x74,
+    0xD6, 0xA3, 0x52, 0x6F, 0x41, 0x72, 0x5D, 0xB4, 0x7A, 0xEC, 0x25, 0x11, 0x1A, 0x4E, 0xA4, 0x2A,
+    0xE1, 0xED, 0x7F, 0x22, 0x75, 0xC6, 0xA7, 0x76, 0x3B, 0xF6, 0x02, 0x32, 0x21, 0xA2, 0x6A, 0xFA,
+    0x13, 0x0B, 0xDE, 0xD8, 0x31, 0xCC, 0x10, 0xD4, 0xD2, 0x56, 0xC0, 0x79, 0x41, 0x1D, 0x6E, 0xD6,
+    0x1F, 0x57, 0x9D, 0xED, 0x5A, 0xD3, 0xAE, 0x83, 0xB2, 0xE1, 0x0E, 0x25, 0xDE, 0x32, 0xE9, 0x84,
+    0xF3, 0x54, 0x2A, 0x4F, 0xC3, 0x4A, 0x57, 0xCF, 0x68, 0x5E, 0xBC, 0x5B, 0xBA, 0x63, 0x07, 0xA3,
+    0xC5, 0xB3, 0xAF, 0x6A, 0x0E, 0xC7, 0xED, 0xB0, 0xEB, 0xE4, 0x8F, 0x66, 0x46, 0xA2, 0xF9, 0x7F,
+    0x4D, 0x6E, 0x1E, 0xA1, 0x3D, 0x11, 0xC2, 0x93, 0x15, 0x0E, 0x12, 0x0B, 0x20, 0x44, 0x62, 0xA4,
+    0x1A, 0x19, 0x64, 0xC9, 0xAC, 0x0B, 0x71, 0xBC, 0x28, 0xB6, 0x53, 0xFC, 0x2D, 0xCF, 0xD1, 0x1E,
+    0xCA, 0xBD, 0xEF, 0x3E, 0x1F, 0xA1, 0x8B, 0x4F, 0x43, 0xC8, 0xEC, 0xEE, 0x6B, 0xF8, 0xD6, 0x63,
+    0xAC, 0xBE, 0xD2, 0x70, 0xCA, 0x7A, 0xB5, 0x28, 0xE9, 0xD0, 0x2A, 0x6D, 0x7A, 0x37, 0x87, 0x56,
+    0xEE, 0xA6, 0x1D, 0x45, 0x6B, 0xB4, 0x3D, 0xB5, 0xDA, 0xBC, 0x5A, 0x79, 0xA4, 0x56, 0x1E, 0x0F,
+    0x87, 0x53, 0x72, 0x1C, 0x8F, 0x5C, 0x47, 0xBB, 0x3D, 0xCA, 0x4D, 0xEB, 0xA3, 0x49, 0x93, 0xD2,
+    0xCA, 0x98, 0x27, 0x69, 0x50, 0x4F, 0x13, 0xCC, 0x87, 0x0E, 0xC7, 0xD3, 0x70, 0xB4, 0x79, 0x72,
+    0x18, 0xFE, 0xDC, 0xCA, 0xC5, 0x72, 0xD8, 0x46, 0xE7, 0xCF, 0x57, 0x99, 0xAC, 0x53, 0x4F, 0x12,
+    0xFB, 0x18, 0x53, 0xF1, 0xDE, 0xF2, 0x05, 0x6E, 0xD4, 0xE8, 0x49, 0x68, 0xA5, 0x6B, 0x56, 0xAE,
+    0xE3, 0xAC, 0x9C, 0x34, 0xCA, 0x09, 0x2B, 0xC3, 0x4E, 0x8B, 0xC1, 0x5E, 0x4F, 0x8D, 0x46, 0xF2,
+    0x19, 0xAA, 0x53, 0x30, 0xDA, 0xA4, 0x8A, 0x1D, 0xCF, 0x2E, 0x24, 0xB8, 0xE9, 0xA7, 0xD7, 0x5D,
+    0x5A, 0x5D, 0xAA, 0xF3, 0x03, 0xDD, 0xCD, 0xB7, 0x90, 0x60, 0xC5, 0x3D, 0xBB, 0x5E, 0x59, 0xAD,
+    0x9E, 0x5E, 0xF9, 0xAD, 0xD6, 0x29, 0x1C, 0xF9, 0x4F, 0x30, 0x2A, 0x62, 0xDE, 0xB5, 0x7C, 0x7A,
+    0x51, 0xD9, 0xC0, 0xA1, 0x06, 0x77, 0x6F, 0x53, 0xBC, 0xC3, 0x41, 0x5E, 0xD6, 0x6F, 0xD8, 0x2B,
+    0xF4, 0xF9, 0x41, 0xE2, 0x54, 0x94, 0x2F, 0x61, 0xFC, 0x32, 0x14, 0xA5, 0x4A, 0x59, 0x6F, 0x9F,
+    0xB2, 0x4D, 0xFC, 0x01, 0xE4, 0xBA, 0xA0, 0x9E, 0x15, 0x84, 0x84, 0xBF, 0x90, 0x75, 0x6C, 0xC8,
+    0x1A, 0x16, 0xF6, 0xAB, 0xC6, 0xD1, 0x33, 0xA1, 0xE8, 0x58, 0xC7, 0xB6, 0xF8, 0x33, 0xE7, 0x58,
+    0xB0, 0x53, 0xC2, 0x63, 0x27, 0x88, 0x34, 0xE7, 0x88, 0xB4, 0xF3, 0x63, 0x1C, 0x97, 0x17, 0x62,
+    0x01, 0x06, 0x45, 0xB0, 0xD1, 0xD3, 0x90, 0x17, 0xE8, 0x9C, 0x1A, 0xB6, 0x33, 0x8A, 0xA3, 0xFA,
+    0xA3, 0xDA, 0x9B, 0xDD, 0xEC, 0x7A, 0xD2, 0x11, 0x93, 0x97, 0x64, 0x70, 0xFD, 0xE7, 0x94, 0x86,
+    0x48, 0x57, 0xC4, 0xDF, 0x12, 0xBF, 0xB2, 0x4C, 0xF1, 0x8E, 0x84, 0xF7, 0x52, 0xF2, 0x21, 0x3D,
+    0x67, 0x79, 0x61, 0xD5, 0x2A, 0xF6, 0x4A, 0x9A, 0x7A, 0x93, 0xC2, 0x13, 0x3F, 0x15, 0xAB, 0xD2,
+    0xE3, 0x56, 0xD9, 0x76, 0x1E, 0xC8, 0x21, 0x59, 0x5B, 0x65, 0x04, 0x94, 0x78, 0xE6, 0xC7, 0x7E,
+    0x96, 0x9B, 0x55, 0xAB, 0xFA, 0x2E, 0x5E, 0x75, 0x19, 0x29, 0x83, 0x79, 0xED, 0xC6, 0x4D, 0xC7,
+    0x6B, 0xAE, 0xED, 0xC0, 0xC5, 0xAB, 0xE9, 0x2F, 0x21, 0x4B, 0x1D, 0xE1, 0xD9, 0x2B, 0xD1, 0x2E,
+    0x01, 0xD4, 0xB5, 0xFC, 0x11, 0xFD, 0xF7, 0xC8, 0x30, 0x03, 0xF6, 0xA4, 0xC2, 0x19, 0x6A, 0x19,
+    0x4E, 0xC8, 0x73, 0xA2, 0x11, 0x64, 0x46, 0xFF, 0x0E, 0x55, 0x8C, 0x99, 0xED, 0x26, 0x7B, 0xBE,
+    0xE0, 0xC1, 0x43, 0xEB, 0xB4, 0xE3, 0x4B, 0x1D, 0xAC, 0x46, 0xE8, 0xB7, 0x5D, 0x95, 0x27, 0x1B,
+    0x5A, 0x45, 0xFC, 0x3E, 0xE0, 0x4C, 0xFC, 0x6B, 0x07, 0x17, 0xEF, 0xD6, 0xA9, 0xE5, 0x81, 0x9C,
+    0xCA, 0x64, 0x7D, 0x1B, 0x86, 0x2F, 0xC4, 0x04, 0x3C, 0x6A, 0x58, 0x65, 0x19, 0xAF, 0xAE, 0xD5,
+    0xCB, 0x32, 0x6F, 0x9F, 0x27, 0xCB, 0x97, 0xE0, 0x35, 0x73, 0x2B, 0xBA, 0x2A, 0x3E, 0xF4, 0xB2,
+    0x15, 0x6D, 0xCD, 0x65, 0x2F, 0xFB, 0x6A, 0x32, 0x7E, 0x28, 0x21, 0x44, 0x34, 0xF6, 0x61, 0x27,
+    0x8B, 0x89, 0xCE, 0x3E, 0x2E, 0x53, 0x9C, 0xE3, 0x4B, 0xF0, 0x4E, 0x7B, 0xE8, 0x2D, 0x0E, 0x85,
+    0xA1, 0xB9, 0xA3, 0x8B, 0x3D, 0x03, 0x0A, 0xAB, 0x51, 0x15, 0x55, 0xF5, 0xB7, 0x28, 0x55, 0x83,
+    0x2B, 0xA7, 0xC3, 0x8D, 0xD3, 0xE2, 0xC6, 0xE9, 0xF1, 0xE2, 0x34, 0x79, 0x61, 0x09, 0xC5, 0x03,
+    0xE7, 0x1A, 0xB3, 0x3D, 0x91, 0x7F, 0x36, 0xF0, 0xB1, 0x05, 0x39, 0xD5, 0xB2, 0xC9, 0x85, 0xBF,
+    0x97, 0x8C, 0x52, 0x6B, 0x48, 0xAB, 0x21, 0xA5, 0xBF, 0x5A, 0xCB, 0xDA, 0x02, 0x70, 0xF6, 0x90,
+    0x27, 0x14, 0xE9, 0x80, 0xA4, 0x1D, 0xC7, 0xF1, 0xD1, 0xC4, 0xED, 0xB0, 0xDB, 0x8C, 0x84, 0x6B,
+    0x46, 0x93, 0x7E, 0xF6, 0x6F, 0xBE, 0xC4, 0x93, 0x04, 0x95, 0x64, 0x44, 0xBD, 0x36, 0xE0, 0x4C,
+    0x03, 0x47, 0xC8, 0x12, 0x26, 0x20, 0x9B, 0x1C, 0x31, 0x9C, 0xBD, 0xC9, 0x78, 0x79, 0xBF, 0x77,
+    0xE1, 0xC5, 0xBD, 0xE5, 0x22, 0x51, 0x26, 0xB4, 0x43, 0x81, 0x86, 0xE3, 0xBF, 0xA1, 0x95, 0x90,
+    0xFE, 0x43, 0x8B, 0xB4, 0xEE, 0xC7, 0x24, 0xFB, 0x5F, 0x11, 0x9E, 0x10, 0xC2, 0x98, 0x48, 0x21,
+    0x72, 0xAE, 0x6F, 0x4E, 0xB5, 0x5B, 0x4D, 0x5A, 0x29, 0x9E, 0x4C, 0x33, 0xA9, 0x37, 0xB0, 0x9B,
+    0x3D, 0x80, 0x11, 0xED, 0x89, 0x59, 0x88, 0xF0, 0x6D, 0x1D, 0x9E, 0xD1, 0xD8, 0xF7, 0xE4, 0xCB,
+    0xF8, 0x31, 0x12, 0x9F, 0x78, 0x78, 0x7D, 0x2B, 0xE3, 0x9E, 0x61, 0x26, 0xCE, 0x58, 0x78, 0x14,
+    0x52, 0xB8, 0x34, 0xF6, 0xE4, 0xFA, 0x25, 0xE4, 0x6E, 0xB3, 0xA6, 0x00, 0xA2, 0x0F, 0x13, 0x13,
+    0x00, 0xC6, 0xFF, 0x08, 0xE7, 0x5E, 0x54, 0x51, 0x2A, 0x29, 0x63, 0x3F, 0x43, 0x3F, 0x69, 0x66,
+    0xE0, 0xC7, 0x51, 0x5B, 0xC9, 0xB0, 0x2F, 0xB5, 0x94, 0xD5, 0xA0, 0x2F, 0x31, 0x7F, 0x41, 0xC8,
+    0xC7, 0x49, 0xE8, 0xDF, 0x09, 0xD1, 0xF6, 0xCB, 0x22, 0x90, 0xD7, 0x37, 0x77, 0xB2, 0xF9, 0x94,
+    0xCF, 0xF6, 0xE0, 0xD1, 0x16, 0xC8, 0x18, 0x14, 0x5E, 0x17, 0x47, 0x10, 0x5B, 0x73, 0x79, 0x8F,
+    0x6C, 0x66, 0x7F, 0x55, 0xF6, 0x9A, 0xFB, 0xBC, 0x34, 0xFB, 0xF6, 0x65, 0xCD, 0x6C, 0x78, 0x96,
+    0xCA, 0xAE, 0xC0, 0x53, 0xDB, 0xFA, 0xAB, 0x87, 0x7A, 0xAA, 0x9B, 0x2A, 0x37, 0x27, 0xF8, 0x06,
+    0xA3, 0x1F, 0x72, 0x9F, 0xF7, 0x2C, 0x70, 0xAE, 0xCA, 0x40, 0x50, 0x28, 0x43, 0x14, 0x73, 0x82,
+    0xC1, 0x05, 0xD7, 0xFF, 0xD5, 0x1E, 0x16, 0x5B, 0x12, 0xD8, 0x3D, 0x62, 0xDA, 0x5E, 0x8D, 0xC6,
+    0x99, 0xBE, 0xD0, 0xF0, 0x2A, 0xE4, 0x73, 0x66, 0xF0, 0x34, 0xA2, 0x94, 0x1A, 0xD6, 0x43, 0x89,
+    0x50, 0xCC, 0x6E, 0xB4, 0x29, 0x76, 0x91, 0xBD, 0xC3, 0x0C, 0xB5, 0xB1, 0x38, 0x11, 0x09, 0x7F,
+    0x95, 0x5D, 0xC2, 0x63, 0xE7, 0x9E, 0x3C, 0xCB, 0xB9, 0x1B, 0x55, 0xF4, 0xEB, 0xB9, 0xED, 0x53,
+    0x21, 0xC1, 0xA5, 0x33, 0x8D, 0x68, 0xC6, 0xB4, 0x9B, 0x5D, 0xDE, 0x0A, 0x81, 0x89, 0xD4, 0x60,
+    0x3D, 0xD8, 0x1D, 0x6F, 0x62, 0x65, 0x70, 0x60, 0x79, 0x4B, 0xFB, 0xA1, 0xE1, 0xD0, 0x6E, 0x68,
+    0xE1, 0xF0, 0x61, 0x60, 0x15, 0x43, 0x8C, 0x57, 0x30, 0x7E, 0x4D, 0x86, 0xF2, 0xAA, 0x98, 0xF6,
+    0xC7, 0x83, 0xD8, 0xB5, 0x6D, 0x9B, 0x25, 0x5D, 0x60, 0xD1, 0xD7, 0x35, 0x55, 0x33, 0x65, 0x21,
+    0x69, 0xF1, 0x90, 0xCF, 0x48, 0x3F, 0x65, 0x98, 0xE9, 0xCE, 0x02, 0xBE, 0xE7, 0xC7, 0x0A, 0x7F,
+    0x41, 0xC9, 0xBC, 0xA0, 0xD9, 0xDD, 0xB0, 0xD7, 0x8D, 0xCA, 0xA1, 0xC2, 0x19, 0x7F, 0x51, 0xA6,
+    0x80, 0x1E, 0x5D, 0xD2, 0xFA, 0x06, 0x24, 0x81, 0xF0, 0xFD, 0x09, 0x8E, 0x85, 0xFE, 0x1A, 0x0D,
+    0x3C, 0x34, 0x4C, 0xD3, 0x83, 0xA3, 0x3E, 0xFF, 0x73, 0x82, 0xEE, 0x2E, 0x5E, 0xFF, 0xA8, 0x77,
+    0xC8, 0xC7, 0x91, 0x16, 0x4E, 0x28, 0x4B, 0x53, 0xCC, 0xE2, 0x15, 0x13, 0xCC, 0xB9, 0xCC, 0xB5,
+    0x88, 0xEB, 0x0F, 0x50, 0x88, 0xCB, 0xFC, 0x57, 0x32, 0x23, 0x77, 0xF9, 0xFB, 0xC9, 0x5C, 0x91,
+    0x39, 0xFC, 0xDE, 0x2C, 0xA5, 0x53, 0x38, 0x45, 0xEF, 0xCC, 0xE6, 0x6D, 0x99, 0x13, 0x21, 0x5A,
+    0x8C, 0x68, 0xFA, 0x42, 0x30, 0x4B, 0x79, 0x13, 0x4E, 0xAF, 0x04, 0xB3, 0x50, 0x19, 0x4E, 0x57,
+    0x83, 0x39, 0x45, 0x48, 0x18, 0x82, 0xF9, 0x55, 0x99, 0x1F, 0xF6, 0xC1, 0x2C, 0x94, 0x86, 0x8F,
+    0x5B, 0x33, 0xF3, 0xDD, 0xA2, 0x9A, 0xC5, 0x35, 0xB4, 0x0E, 0xAA, 0x10, 0x2E, 0x6B, 0x19, 0x68,
+    0x0E, 0x0E, 0xCD, 0xA5, 0x94, 0x96, 0xDA, 0x74, 0x27, 0xFC, 0xDF, 0x12, 0x7A, 0x83, 0xC9, 0x17,
+    0xCD, 0xC1, 0x9E, 0xC5, 0xE5, 0xC2, 0x2C, 0xA8, 0x61, 0x69, 0x59, 0x30, 0x62, 0x14, 0xC3, 0xC1,
+    0x61, 0x41, 0xBF, 0x15, 0xCB, 0x3F, 0xA7, 0x52, 0xFD, 0x0D, 0x31, 0xF9, 0x78, 0xCF, 0x2A, 0x78,
+    0x61, 0x0D, 0x8C, 0x06, 0xDB, 0x04, 0xD3, 0x87, 0x07, 0x99, 0x70, 0x8A, 0x91, 0xCF, 0x1E, 0x2C,
+    0x36, 0xA5, 0x44, 0xB2, 0x41, 0xC3, 0x5E, 0x13, 0xCA, 0x0A, 0xAC, 0x89, 0x04, 0x5E, 0x5F, 0x52,
+    0x44, 0x29, 0x2C, 0x30, 0xF2, 0x65, 0xC7, 0x89, 0x11, 0x17, 0xEE, 0xB6, 0x66, 0x68, 0x66, 0xC9,
+    0xBF, 0x68, 0x4F, 0xDD, 0x6A, 0x23, 0xBD, 0xD1, 0xD3, 0x9D, 0xAA, 0xA4, 0x4F, 0x2F, 0xDE, 0xD1,
+    0x5E, 0xD7, 0x27, 0xF4, 0x21, 0x14, 0x9C, 0x13, 0x9D, 0x7F, 0x1D, 0xCC, 0x47, 0xC1, 0xC8, 0xA5,
+    0xC0, 0x2E, 0xF3, 0xAB, 0x0F, 0x33, 0xBF, 0xF9, 0xB0, 0x22, 0xE6, 0x21, 0xE9, 0xA5, 0x8B, 0x7A,
+    0x98, 0xE3, 0xBA, 0x6B, 0x87, 0xEF, 0x20, 0xE4, 0xE8, 0xEC, 0x16, 0x38, 0x68, 0x3C, 0x03, 0x33,
+    0x6F, 0xC3, 0x4F, 0x7E, 0x60, 0x56, 0xC3, 0xD7, 0xB7, 0xA7, 0x7A, 0x9F, 0xF6, 0x6F, 0xFF, 0x9F,
+    0xBC, 0x2A, 0x69, 0x43, 0xD5, 0x04, 0x9D, 0x30, 0x18, 0x41, 0x59, 0x62, 0xBC, 0x2D, 0x94, 0xD5,
+    0x78, 0x09, 0xAA, 0x74, 0x6F, 0x7C, 0x98, 0x17, 0xEF, 0xF8, 0x12, 0x8C, 0xCE, 0xE1, 0x9E, 0x7F,
+    0xCF, 0x8F, 0xAD, 0xFE, 0x60, 0x53, 0xC6, 0x5F, 0x6D, 0x24, 0x71, 0xAF, 0xA4, 0x58, 0x2D, 0xB6,
+    0x9F, 0x48, 0xD5, 0xF8, 0x1D, 0x7E, 0xE6, 0xCA, 0x5F, 0x4D, 0xDB, 0xB7, 0x17, 0x6F, 0xA5, 0x63,
+    0x36, 0xA7, 0x73, 0x84, 0x6C, 0x67, 0x08, 0xBB, 0xAC, 0x9E, 0xA0, 0xA6, 0x27, 0xE6, 0x8B, 0xE6,
+    0x9E, 0xE8, 0x7B, 0x9F, 0x74, 0x69, 0x99, 0x89, 0x1F, 0x3A, 0x15, 0xB1, 0xDC, 0x14, 0x94, 0x9A,
+    0xBA, 0x18, 0x9A, 0xBE, 0x18, 0xAA, 0x3E, 0x1B, 0x8A, 0x2E, 0x28, 0x4F, 0x64, 0x85, 0xA4, 0x4E,
+    0xC7, 0x7C, 0xC8, 0xE6, 0x62, 0x4C, 0xE7, 0x5C, 0xBC, 0x8B, 0xA0, 0x8D, 0xA2, 0x73, 0x08, 0xFB,
+    0xB0, 0x8B, 0xDB, 0xAC, 0xDE, 0x99, 0x29, 0xC0, 0xAA, 0x25, 0x54, 0xE7, 0x06, 0x8E, 0x54, 0xBA,
+    0xC0, 0x9A, 0x64, 0xAE, 0x3A, 0x31, 0x92, 0xD4, 0x4F, 0x45, 0x4D, 0x94, 0x2E, 0xF0, 0x4D, 0x22,
+    0x5F, 0x12, 0x37, 0xCC, 0xD4, 0xED, 0x3E, 0x66, 0xE7, 0x28, 0xFE, 0xF4, 0x5E, 0x46, 0x1D, 0x4F,
+    0xDB, 0xB3, 0x82, 0x99, 0x62, 0x5E, 0xFF, 0xDE, 0x3D, 0xEA, 0x1E, 0x5E, 0x33, 0x72, 0x85, 0x90,
+    0x2B, 0x7B, 0x16, 0x5F, 0xF1, 0x2C, 0xAE, 0xEE, 0xDA, 0x79, 0xD6, 0xAD, 0x3F, 0x92, 0x0E, 0x67,
+    0x57, 0x07, 0xD1, 0x19, 0xBA, 0xEA, 0x48, 0x23, 0xA2, 0x66, 0x14, 0x7A, 0xA1, 0x71, 0x91, 0xCE,
+    0xD1, 0x85, 0x4C, 0x77, 0xD1, 0xB9, 0x6C, 0x52, 0x13, 0x0C, 0x0D, 0x1C, 0x95, 0xAF, 0xA4, 0x1A,
+    0x7F, 0xB1, 0xF8, 0x72, 0x6D, 0xEF, 0x0B, 0xB6, 0x67, 0x51, 0xBA, 0x77, 0x94, 0xE2, 0xBD, 0xDB,
+    0xD1, 0x1C, 0x12, 0xA8, 0x35, 0xF6, 0x53, 0x09, 0x4C, 0x56, 0x72, 0x3C, 0x15, 0x7E, 0x4F, 0xC9,
+    0x8F, 0x55, 0xD4, 0x92, 0x23, 0xB3, 0xE4, 0xE1, 0xCF, 0x65, 0xDA, 0x4D, 0xA0, 0x95, 0x54, 0x3C,
+    0xA4, 0x13, 0x19, 0xA0, 0x41, 0x8A, 0x73, 0xA7, 0x2D, 0xA8, 0x2E, 0x3F, 0xBD, 0xAC, 0xE5, 0x73,
+    0x56, 0xA7, 0x50, 0x0F, 0xE7, 0xE0, 0x21, 0x3A, 0x25, 0xAD, 0x5B, 0x01, 0x8B, 0x15, 0xAE, 0x84,
+    0xC7, 0x99, 0x4C, 0xC7, 0x4A, 0x22, 0x56, 0x29, 0x5E, 0x8D, 0xA2, 0xD5, 0x6C, 0xE4, 0xF2, 0xBD,
+    0xE0, 0x15, 0xA7, 0xCA, 0x9D, 0x77, 0xE9, 0x24, 0xA9, 0xCD, 0xF2, 0x02, 0x71, 0xB3, 0x7B, 0xAD,
+    0xEF, 0x7A, 0x62, 0x76, 0xF2, 0xB9, 0xCA, 0xDA, 0xCB, 0x0F, 0x4F, 0xB4, 0xDB, 0xA8, 0x56, 0x13,
+    0x0F, 0x7A, 0xFA, 0x26, 0x89, 0xEF, 0x5E, 0x1F, 0x53, 0xF9, 0x14, 0x6E, 0x8F, 0xC6, 0x35, 0xEB,
+    0xBC, 0x3E, 0x2D, 0xBA, 0xA9, 0x54, 0xFA, 0xDC, 0x55, 0x4A, 0x7D, 0x8A, 0xC8, 0x81, 0xE2, 0x51,
+    0xF1, 0xB0, 0xAC, 0x8A, 0xE4, 0x80, 0xF1, 0xC8, 0x78, 0x68, 0x3C, 0x36, 0x1E, 0x1C, 0x8F, 0xCE,
+    0x26, 0x4D, 0xC5, 0x67, 0x55, 0x24, 0x87, 0xD0, 0xAA, 0x46, 0x0E, 0x23, 0x07, 0x92, 0x47, 0xC9,
+    0xC3, 0xE4, 0x71, 0xF2, 0x40, 0x79, 0xA4, 0x3C, 0x54, 0x1E, 0xAB, 0xB5, 0xBB, 0xE0, 0xC4, 0x7E,
+    0xD8, 0x05, 0x10, 0x7B, 0xDC, 0xB9, 0x97, 0x86, 0xF7, 0xEE, 0x55, 0x06, 0x58, 0x64, 0x57, 0x0C,
+    0xDE, 0x24, 0xD9, 0x39, 0xA4, 0x4D, 0x6A, 0x91, 0x06, 0x52, 0x2F, 0x1C, 0xE9, 0xFA, 0xA6, 0xEC,
+    0x2B, 0x8E, 0x6A, 0x98, 0x5C, 0xCF, 0xF9, 0xA7, 0xD6, 0x2B, 0x3C, 0x80, 0x52, 0xDB, 0x04, 0x59,
+    0xAE, 0x0E, 0x29, 0xBD, 0xF2, 0x57, 0x2B, 0xAA, 0xCD, 0x6A, 0x9F, 0xD6, 0x21, 0x5A, 0xBB, 0xAE,
+    0x83, 0x87, 0x8D, 0x26, 0x4A, 0x1A, 0x68, 0xA3, 0xA4, 0x81, 0x46, 0x4A, 0x1A, 0x78, 0xBB, 0x5E,
+    0x95, 0x7C, 0xF3, 0xDD, 0xE3, 0xCB, 0xAB, 0x86, 0x76, 0x38, 0x7A, 0xE2, 0xA3, 0xE9, 0x77, 0x9D,
+    0xA9, 0x46, 0xE2, 0x45, 0xF4, 0x26, 0xBC, 0x46, 0xED, 0x8C, 0xF5, 0xD2, 0x81, 0xB5, 0x6E, 0xE6,
+    0xBA, 0xD9, 0xEB, 0x66, 0xB0, 0x9B, 0xC5, 0x1E, 0xB8, 0x09, 0x6F, 0xB3, 0xC7, 0x46, 0x4B, 0xEC,
+    0xEF, 0x5F, 0x5A, 0xB1, 0xF7, 0xDE, 0xB0, 0x63, 0x4C, 0x27, 0xF6, 0xB4, 0x60, 0x62, 0x4F, 0x52,
+    0xC9, 0x08, 0x85, 0x4C, 0xEC, 0x13, 0x3D, 0x48, 0xF0, 0xCA, 0xB9, 0x78, 0xF5, 0x54, 0xA7, 0x98,
+    0x79, 0xEC, 0xC7, 0xEC, 0x73, 0x60, 0xDF, 0xFC, 0x3F, 0xC4, 0xFE, 0x3F, 0x01, 0x8D, 0x56, 0xBF,
+    0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xB6, 0x69, 0x2C, 0xE1, 0xE1, 0x32, 0x10, 0x40, 0x42, 0xC2, 0x0B,
+    0x03, 0x4B, 0xE2, 0xB5, 0x43, 0xF2, 0xAE, 0x61, 0xE9, 0x9A, 0xA1, 0x01, 0x89, 0x05, 0x06, 0xA6,
+    0x2E, 0x61, 0x60, 0x60, 0x48, 0x63, 0x03, 0x63, 0x97, 0xFE, 0x09, 0x5D, 0x18, 0x28, 0x03, 0x4B,
+    0x86, 0x0C, 0x49, 0xDE, 0x95, 0xF8, 0x03, 0x30, 0x42, 0x62, 0xC5, 0x03, 0x12, 0x52, 0x19, 0x72,
+    0x05, 0x2E, 0x72, 0x90, 0x9F, 0xCD, 0xF7, 0x1D, 0xDB, 0x49, 0x9A, 0xA6, 0x15, 0xB6, 0xDE, 0x39,
+    0xF7, 0xF9, 0x9E, 0xFB, 0x9D, 0xDF, 0xC7, 0x4E, 0x2B, 0x9B, 0xA7, 0xAE, 0xC8, 0x33, 0x57, 0x48,
+    0x56, 0x9E, 0x4A, 0x26, 0xC7, 0x62, 0xF1, 0x5B, 0x48, 0x2B, 0x5B, 0xE2, 0xF5, 0x37, 0x5E, 0x46,
+    0x36, 0x40, 0x53, 0xD9, 0x06, 0xDD, 0xC4, 0x73, 0xC1, 0xEA, 0x08, 0x74, 0x5F, 0x1A, 0xD0, 0x23,
+    0x95, 0x6B, 0x02, 0x2F, 0xC1, 0xEE, 0xD3, 0x8F, 0x9E, 0xE6, 0xD1, 0x80, 0xCB, 0x85, 0xA4, 0xA5,
+    0x44, 0x2E, 0x29, 0x45, 0x62, 0x67, 0x72, 0x91, 0xA4, 0x34, 0x04, 0xCB, 0x53, 0x85, 0xDC, 0x04,
+    0xCD, 0x26, 0xB0, 0x7D, 0x11, 0x0B, 0xF1, 0x76, 0xA2, 0xEB, 0xE7, 0x1F, 0x3E, 0xDD, 0x11, 0xF1,
+    0x61, 0x2D, 0x12, 0xF8, 0xA8, 0x12, 0x09, 0xEB, 0xC8, 0x89, 0x44, 0x55, 0x4C, 0x7A, 0x05, 0x72,
+    0x04, 0xC3, 0xF5, 0x16, 0xC9, 0xD6, 0x4C, 0xD6, 0x4E, 0xB1, 0xB7, 0x1C, 0x1A, 0x89, 0xDB, 0xBF,
+    0x56, 0x62, 0x2A, 0x3F, 0x48, 0xE6, 0xEA, 0x42, 0xEC, 0x57, 0xD5, 0x42, 0xEC, 0x07, 0xD5, 0xBB,
+    0x62, 0xBF, 0x01, 0x92, 0xFD, 0x11, 0x24, 0xFB, 0x03, 0x68, 0x66, 0xC0, 0x81, 0x68, 0x80, 0x26,
+    0x81, 0x7E, 0xF8, 0x3A, 0x28, 0xC1, 0xF6, 0x46, 0x56, 0x07, 0xB2, 0x65, 0x7C, 0x2A, 0x5B, 0x89,
+    0xB7, 0x72, 0x1B, 0x24, 0xFF, 0xC2, 0xD4, 0xD6, 0x1D, 0x1A, 0x97, 0xD5, 0xDE, 0x96, 0x66, 0xF5,
+    0x4F, 0x2F, 0xF0, 0x16, 0xA1, 0x78, 0xF3, 0x1C, 0xA7, 0x42, 0x1C, 0x92, 0xE8, 0x82, 0xC4, 0xA5,
+    0x5C, 0x5E, 0x69, 0x4B, 0x27, 0x44, 0xFA, 0x02, 0x2A, 0x9D, 0x44, 0xDE, 0x94, 0x88, 0x81, 0x24,
+    0x15, 0xFE, 0x6C, 0xF3, 0x91, 0xA9, 0x10, 0x7C, 0xC9, 0x72, 0x53, 0x85, 0x08, 0xAA, 0x85, 0xE9,
+    0x71, 0xA5, 0xDC, 0x41, 0x52, 0x0E, 0xC0, 0x21, 0x0E, 0x9E, 0xBA, 0xFB, 0xE0, 0x27, 0x90, 0x6C,
+    0x65, 0x47, 0xEE, 0x8B, 0x8D, 0x7C, 0xDA, 0xE3, 0xF9, 0x49, 0xE2, 0x0E, 0x3E, 0x71, 0x56, 0xBA,
+    0xF4, 0xFD, 0x36, 0xA9, 0xB2, 0x3B, 0x7E, 0x11, 0xF9, 0xB8, 0x4E, 0x86, 0xF2, 0x38, 0xA9, 0x22,
+    0x2F, 0x77, 0x83, 0xC6, 0x38, 0x70, 0x89, 0xEA, 0xB4, 0x8C, 0xC1, 0x13, 0x97, 0xE5, 0x31, 0xA2,
+    0x9C, 0xE6, 0x56, 0x12, 0xF0, 0x85, 0xEA, 0x14, 0xE9, 0x54, 0xA7, 0xC0, 0x08, 0x8B, 0xDA, 0x10,
+    0x18, 0x91, 0x61, 0xC5, 0x47, 0x69, 0x7E, 0xC2, 0xBC, 0x89, 0xF9, 0x15, 0x0E, 0xC3, 0x88, 0x90,
+    0x41, 0xE2, 0xF5, 0xFA, 0x15, 0x3F, 0x93, 0xA1, 0x26, 0x5B, 0xFE, 0xB9, 0x62, 0x40, 0x56, 0xB2,
+    0x64, 0x34, 0x90, 0x5D, 0xE6, 0xCD, 0x2B, 0x4B, 0x3C, 0x71, 0xC9, 0x6C, 0xAE, 0xAC, 0x60, 0xAC,
+    0x9A, 0x80, 0x07, 0xA2, 0x2E, 0x65, 0x5D, 0x85, 0x3D, 0x93, 0x82, 0x84, 0xFC, 0x2E, 0x45, 0x27,
+    0x31, 0xF4, 0x20, 0x35, 0xC5, 0x59, 0x2D, 0xBD, 0x44, 0x2B, 0xD3, 0x04, 0xAD, 0x18, 0x1F, 0x75,
+    0x30, 0x31, 0x73, 0x61, 0x1F, 0xD5, 0x84, 0x1D, 0xEE, 0x38, 0xEA, 0xB2, 0x3F, 0x95, 0x64, 0x4C,
+    0x22, 0x58, 0xB2, 0x52, 0x16, 0x81, 0x15, 0x39, 0xEC, 0xC5, 0xBE, 0x83, 0x85, 0x70, 0xA5, 0x91,
+    0x22, 0xAB, 0x81, 0xFC, 0x43, 0x6B, 0x7A, 0x9C, 0x18, 0x1E, 0x52, 0x49, 0xB0, 0xA3, 0x99, 0xAA,
+    0x32, 0x97, 0x95, 0x16, 0x61, 0x59, 0x20, 0x33, 0x5B, 0x72, 0x5B, 0xFD, 0xD2, 0xAD, 0x0E, 0x90,
+    0x24, 0xA9, 0x83, 0x95, 0xA9, 0xF7, 0xB7, 0x24, 0xEC, 0x6A, 0x28, 0xC8, 0xCE, 0x06, 0xB9, 0xB5,
+    0x37, 0x3C, 0x01, 0x10, 0x72, 0x58, 0xFC, 0xB2, 0x2C, 0xE5, 0x76, 0xFC, 0x00, 0x32, 0xC9, 0xD7,
+    0x90, 0x36, 0xE5, 0x21, 0xC3, 0xFC, 0x9A, 0xC8, 0xDB, 0xF9, 0x1C, 0x26, 0x55, 0xC5, 0x22, 0x7F,
+    0x21, 0xB9, 0xF7, 0xFD, 0xBF, 0x8F, 0xF3, 0x25, 0x3B, 0x49, 0x57, 0x2F, 0x17, 0x96, 0xE0, 0xE1,
+    0x88, 0xFB, 0x88, 0x0F, 0xD8, 0x94, 0xAC, 0x35, 0x61, 0xCF, 0x08, 0x9B, 0x45, 0xB4, 0x57, 0xD8,
+    0xC4, 0x6C, 0x38, 0x61, 0xA5, 0xA1, 0xBD, 0xE6, 0xC3, 0x5A, 0xAD, 0xEC, 0x2C, 0x61, 0x97, 0x32,
+    0xC5, 0x93, 0xEC, 0x31, 0x49, 0x33, 0xCB, 0xDE, 0x04, 0xB9, 0xB8, 0x80, 0xE4, 0x54, 0x90, 0x6B,
+    0x90, 0x17, 0xB2, 0x97, 0x90, 0xEF, 0xCD, 0x11, 0xC8, 0x67, 0x9D, 0x4B, 0xAC, 0x62, 0x26, 0xBF,
+    0x00, 0x7E, 0xDC, 0x73, 0x51, 0xB3, 0x04, 0x78, 0xCC, 0x4F, 0xFB, 0x62, 0x09, 0xAA, 0x52, 0x2A,
+    0xA6, 0x99, 0xC5, 0x96, 0x2E, 0x5B, 0x99, 0xA5, 0x52, 0xE2, 0x05, 0x63, 0x90, 0x35, 0x74, 0x4A,
+    0xE4, 0x45, 0x57, 0x81, 0xDD, 0x31, 0xC4, 0xEB, 0xBB, 0xBB, 0xBB, 0x6A, 0xD1, 0xE8, 0xC6, 0x92,
+    0x67, 0xB4, 0x12, 0x03, 0x2D, 0xC4, 0x4C, 0x8B, 0x72, 0xD0, 0xE0, 0xA8, 0x77, 0xBD, 0x1E, 0x2F,
+    0xA7, 0x87, 0xDC, 0x56, 0xC1, 0x54, 0x17, 0xE5, 0x64, 0x13, 0xF7, 0xC7, 0x10, 0xEE, 0x4C, 0x0A,
+    0xDF, 0x38, 0xD5, 0x34, 0x71, 0x40, 0x2A, 0xEC, 0x79, 0xB0, 0x07, 0x0F, 0x03, 0xA0, 0x05, 0x2C,
+    0x2D, 0x6A, 0x41, 0xAB, 0x65, 0x1A, 0xB6, 0x52, 0xFB, 0x82, 0x41, 0xEF, 0x64, 0xED, 0xFC, 0x15,
+    0x8C, 0x41, 0xD4, 0xEC, 0x59, 0x17, 0xA0, 0xA9, 0xC3, 0x2E, 0xEC, 0x04, 0xED, 0x9C, 0x78, 0x74,
+    0x42, 0x93, 0x96, 0xA9, 0x0B, 0x5B, 0x69, 0xB3, 0xDC, 0x96, 0x90, 0x39, 0xB2, 0x38, 0x88, 0x46,
+    0x6F, 0x2D, 0x4A, 0x1F, 0xBC, 0x39, 0x40, 0xD7, 0xA0, 0xD1, 0xC1, 0x57, 0x6C, 0x74, 0x7F, 0x22,
+    0x9C, 0x8B, 0xC1, 0xC8, 0x5D, 0x54, 0x93, 0xA7, 0x2E, 0xC6, 0x58, 0x39, 0x15, 0x5B, 0x99, 0xF2,
+    0x00, 0x7D, 0xF9, 0x37, 0xE6, 0x9D, 0x45, 0x17, 0xFD, 0x3C, 0x70, 0x1C, 0xAC, 0x0D, 0x4C, 0x49,
+    0x36, 0x15, 0xAF, 0x99, 0xBA, 0x3E, 0xA9, 0x47, 0x1E, 0x69, 0x31, 0xE1, 0xD7, 0x4F, 0x19, 0x45,
+    0xAE, 0x02, 0x5D, 0x0F, 0x4F, 0x96, 0x2A, 0xB3, 0x37, 0xAC, 0x46, 0xD1, 0x75, 0x12, 0x3B, 0xF4,
+    0x92, 0x0D, 0xED, 0xC8, 0x1A, 0x0D, 0x17, 0xA4, 0x87, 0x31, 0xF6, 0xBD, 0x16, 0x9C, 0xCE, 0x02,
+    0x8F, 0xE6, 0xD2, 0xCA, 0x8B, 0x3A, 0xAD, 0x69, 0xEA, 0x41, 0x6D, 0xC5, 0x8D, 0x06, 0x85, 0xC1,
+    0x42, 0x91, 0x61, 0x7C, 0xB0, 0x24, 0x8D, 0x57, 0xD5, 0xA6, 0xD6, 0x7A, 0x4B, 0x2B, 0x65, 0x8C,
+    0xA3, 0xD1, 0x96, 0x67, 0xAD, 0x92, 0xE1, 0xC5, 0xC3, 0x09, 0xB4, 0xAD, 0xE3, 0x80, 0xAF, 0x0B,
+    0xB2, 0xFD, 0x91, 0x01, 0x1D, 0xF3, 0x88, 0x85, 0x0E, 0x49, 0x1D, 0x8C, 0x8D, 0xCE, 0xA9, 0x78,
+    0x18, 0xFA, 0xB1, 0x9E, 0xD4, 0x97, 0xE0, 0xEE, 0xD8, 0xBF, 0x8F, 0xBF, 0xC3, 0x4B, 0x63, 0xA5,
+    0x95, 0x10, 0xB7, 0x3A, 0xC6, 0xD4, 0x08, 0xB5, 0xA0, 0x12, 0x35, 0x81, 0xFA, 0xA9, 0x95, 0x2A,
+    0xA9, 0x81, 0xF9, 0xE4, 0x38, 0x1C, 0xC6, 0x58, 0xD1, 0x49, 0x7A, 0x48, 0xF7, 0xE8, 0x1B, 0x72,
+    0xA7, 0xCE, 0x5D, 0x85, 0x22, 0x4C, 0xEA, 0xAE, 0x41, 0x39, 0x1A, 0x53, 0xEA, 0xEF, 0x53, 0x39,
+    0x44, 0xD4, 0xC6, 0xFB, 0x4B, 0x78, 0x32, 0xDE, 0x5B, 0xCF, 0xDC, 0xDB, 0xD3, 0xBD, 0x01, 0xF7,
+    0xC7, 0xFB, 0x1D, 0xC4, 0x63, 0xBC, 0x8D, 0xBC, 0x7A, 0xE9, 0x8B, 0xC4, 0xB3, 0x35, 0x93, 0x45,
+    0xB3, 0x35, 0xC9, 0xEC, 0x58, 0xFD, 0xBC, 0x63, 0x9C, 0xE1, 0x74, 0xEE, 0x06, 0xC7, 0xC2, 0x1B,
+    0xA0, 0xAE, 0xC6, 0x28, 0xAB, 0xD4, 0x99, 0x02, 0x93, 0x77, 0xA9, 0x5D, 0xFA, 0xF9, 0xC5, 0x68,
+    0xEA, 0xE6, 0x26, 0x8B, 0x7E, 0x63, 0x21, 0x3D, 0xE0, 0x7B, 0x9A, 0x93, 0x67, 0x13, 0xC3, 0x5E,
+    0xB6, 0x99, 0xA4, 0x63, 0xCE, 0xA5, 0x06, 0xCE, 0xA2, 0x32, 0xB6, 0x59, 0x10, 0x99, 0xD6, 0x41,
+    0x8E, 0xBE, 0x49, 0x5C, 0xCA, 0x12, 0x59, 0x4C, 0x93, 0x70, 0xFC, 0xC0, 0x68, 0x94, 0xB0, 0xCF,
+    0x77, 0xEE, 0xE5, 0xD6, 0x19, 0x17, 0xD7, 0x80, 0x39, 0x12, 0x4C, 0xE5, 0xE0, 0xE3, 0xF9, 0xB5,
+    0xAF, 0xA3, 0x85, 0x0B, 0x2D, 0xC0, 0x50, 0xAD, 0xE8, 0xE6, 0x12, 0xA7, 0x0B, 0xEA, 0x83, 0x3A,
+    0xA1, 0x5E, 0xA8, 0x1B, 0x9A, 0x20, 0x8D, 0x45, 0xA0, 0x18, 0xCD, 0x3C, 0x98, 0x18, 0xCE, 0x11,
+    0x49, 0xCB, 0x5A, 0xC9, 0x25, 0x70, 0x78, 0x01, 0x7C, 0x0D, 0xFD, 0x0A, 0xD1, 0x5D, 0xFD, 0x34,
+    0xD9, 0x83, 0x8E, 0xCF, 0x8E, 0xFE, 0xCF, 0x25, 0xC1, 0xB7, 0x7A, 0x8A, 0x46, 0xA5, 0xFE, 0x79,
+    0xD0, 0x4B, 0xE3, 0x99, 0xCA, 0x71, 0xD8, 0x28, 0xB1, 0xB3, 0x1B, 0x9A, 0xCF, 0x71, 0x95, 0xA9,
+    0x1F, 0x34, 0x7C, 0x8D, 0xBE, 0xD9, 0x6A, 0x72, 0x23, 0x7C, 0x36, 0x2A, 0xF1, 0x4B, 0xD1, 0x15,
+    0xB8, 0x98, 0xE3, 0xB3, 0xE4, 0xD1, 0x25, 0xE7, 0x60, 0xF8, 0x48, 0xD6, 0x4A, 0xD3, 0xA3, 0x71,
+    0xED, 0x12, 0x1F, 0x76, 0xFB, 0xB1, 0x37, 0x72, 0x14, 0xE0, 0x03, 0xA9, 0x11, 0x8B, 0xF9, 0xC6,
+    0x01, 0xF3, 0x1F, 0xDD, 0x5B, 0x3D, 0xAC, 0xDD, 0x46, 0x76, 0x1E, 0x92, 0x92, 0x08, 0x9B, 0xB0,
+    0xA8, 0xC2, 0x4A, 0x20, 0x69, 0x25, 0xB6, 0x89, 0x2C, 0x3D, 0xA6, 0x74, 0xF1, 0xEE, 0x23, 0xBD,
+    0x2E, 0x5C, 0x46, 0x40, 0xFC, 0x92, 0xC2, 0x85, 0x9B, 0x6D, 0xB2, 0xCD, 0x6B, 0xB6, 0x50, 0xF1,
+    0x6C, 0xD2, 0xDE, 0x32, 0x45, 0xD4, 0x6C, 0x9D, 0x07, 0xC4, 0xC5, 0xFA, 0x1A, 0x88, 0x16, 0x88,
+    0x80, 0x3C, 0x20, 0x92, 0x48, 0xC3, 0x40, 0x52, 0xB8, 0x08, 0xB1, 0x01, 0x92, 0x22, 0x29, 0xB8,
+    0x88, 0x0D, 0x27, 0xDE, 0x42, 0x44, 0x96, 0xBB, 0xA1, 0x64, 0x5E, 0x4E, 0xCE, 0xF7, 0x9D, 0xB9,
+    0x7F, 0x92, 0xEC, 0xAC, 0x11, 0x44, 0x91, 0xDF, 0xFB, 0x99, 0xE1, 0xBD, 0x97, 0x9C, 0x39, 0x3F,
+    0x33, 0xE7, 0x7C, 0xE7, 0xCC, 0xB9, 0xC6, 0x33, 0x26, 0x6E, 0x4D, 0xDA, 0x99, 0xAC, 0x33, 0x69,
+    0x6B, 0xA2, 0xD2, 0xE8, 0xCF, 0x0B, 0xC6, 0x5C, 0x36, 0x66, 0x97, 0x7F, 0x87, 0xC6, 0xDC, 0x35,
+    0x66, 0xC0, 0x9F, 0xD7, 0x1B, 0xBF, 0x33, 0x41, 0x67, 0xC2, 0xCE, 0x44, 0x1D, 0x1E, 0x95, 0xBF,
+    0xA4, 0x31, 0x69, 0x6D, 0xB2, 0xDA, 0x14, 0xB5, 0xF9, 0x21, 0x06, 0x08, 0xD0, 0x84, 0x6C, 0x72,
+    0x63, 0xBC, 0x4A, 0x1E, 0x8D, 0xAD, 0x35, 0xA6, 0xF8, 0xC3, 0xAA, 0xF4, 0x16, 0x57, 0xB2, 0x3A,
+    0x18, 0xAE, 0xA7, 0x65, 0xD4, 0x5D, 0xDB, 0x31, 0x49, 0x2B, 0x13, 0xA4, 0xF5, 0xAB, 0x46, 0x9E,
+    0xFF, 0x91, 0xDC, 0x51, 0xDE, 0x31, 0xA6, 0xCA, 0x3B, 0x69, 0x8C, 0x34, 0xD6, 0xB4, 0xD2, 0x78,
+    0x8D, 0xBC, 0xF4, 0x6B, 0x69, 0x5E, 0x97, 0x26, 0xFB, 0x71, 0xFD, 0x07, 0x26, 0xFD, 0xE2, 0x3D,
+    0x99, 0xDD, 0x3E, 0xA8, 0x8D, 0x6F, 0xAD, 0xCC, 0x91, 0x7E, 0x20, 0x93, 0xC5, 0x20, 0xFC, 0x0A,
+    0x9A, 0xEB, 0x66, 0xFD, 0xE3, 0x55, 0x13, 0x3E, 0x9B, 0x2C, 0x9E, 0xCD, 0x85, 0x53, 0xB3, 0x00,
+    0xE9, 0xFE, 0x00, 0x1E, 0x82, 0xDE, 0x04, 0x0D, 0xF8, 0x11, 0x39, 0xC8, 0x4B, 0xB3, 0xDD, 0x06,
+    0xDA, 0xF6, 0x68, 0x3F, 0x7A, 0x34, 0xCF, 0x31, 0x99, 0x2D, 0x8D, 0xF7, 0xC7, 0x8B, 0x7D, 0x0C,
+    0x3C, 0x9A, 0x75, 0x3B, 0xA0, 0xF5, 0x87, 0xF5, 0x53, 0x61, 0x8B, 0x36, 0xA6, 0x3C, 0x77, 0x48,
+    0x88, 0x9D, 0xF2, 0xB3, 0x26, 0xB4, 0xF6, 0xD1, 0xC2, 0xA4, 0xBF, 0xB4, 0xB6, 0x37, 0xBF, 0x67,
+    0x2E, 0x59, 0x7E, 0xFE, 0xA6, 0x23, 0xF5, 0xBA, 0xB9, 0x11, 0xE5, 0xD9, 0xC1, 0x94, 0xE6, 0x22,
+    0xAE, 0x85, 0x4C, 0x0C, 0x22, 0x6B, 0x11, 0x7E, 0x9C, 0x9B, 0x19, 0xD8, 0xDB, 0x41, 0x73, 0xC5,
+    0x5D, 0xE1, 0x3D, 0xF9, 0xF4, 0x50, 0x26, 0x94, 0xFB, 0x22, 0x7B, 0x5B, 0xC6, 0x3D, 0xB0, 0x45,
+    0x3E, 0xF3, 0x6E, 0xC4, 0xF9, 0x29, 0xA1, 0xC9, 0x24, 0xB6, 0x0B, 0x6D, 0x97, 0xDA, 0x2E, 0xB2,
+    0x5D, 0x30, 0x41, 0x9C, 0xDE, 0xC2, 0x18, 0x21, 0x58, 0xAE, 0x29, 0xDD, 0xA0, 0x85, 0xA0, 0x65,
+    0x10, 0x53, 0xE4, 0x90, 0x5E, 0x56, 0xCE, 0xD0, 0xD6, 0x37, 0x0D, 0x94, 0x02, 0x3E, 0xE2, 0x4F,
+    0x1A, 0xB4, 0xFF, 0x0C, 0x3A, 0xA3, 0x07, 0x86, 0x8A, 0x14, 0x4D, 0x26, 0x6C, 0x4D, 0xD8, 0xAF,
+    0x84, 0x75, 0xFE, 0xED, 0x5F, 0x0B, 0x1B, 0x99, 0xB5, 0x23, 0xAE, 0x3F, 0x07, 0x4B, 0x09, 0x1E,
+    0xC5, 0xD2, 0xE0, 0x98, 0x68, 0x0B, 0xB4, 0xAF, 0xD8, 0x47, 0xB8, 0xE4, 0x00, 0x3F, 0x38, 0xDE,
+    0xFA, 0xF9, 0x81, 0x13, 0xC4, 0xF6, 0xBB, 0xC7, 0xC2, 0x0B, 0x04, 0x9E, 0xDA, 0xD6, 0x78, 0xD3,
+    0x5B, 0xA3, 0x90, 0x2D, 0x7C, 0x44, 0xB5, 0xB0, 0x21, 0xF2, 0xBD, 0x67, 0x92, 0xD2, 0xFC, 0xC8,
+    0x24, 0x18, 0x3A, 0x26, 0xB1, 0x20, 0x2A, 0xB2, 0xEE, 0x01, 0x73, 0x5C, 0x09, 0xCF, 0x5D, 0x62,
+    0x4B, 0xBF, 0xF3, 0x6C, 0xE3, 0x63, 0xA5, 0x43, 0x5C, 0x9D, 0x37, 0x41, 0x53, 0x7C, 0xA7, 0x18,
+    0x44, 0x10, 0x89, 0x95, 0xD5, 0x15, 0xD8, 0x07, 0xB2, 0x9A, 0x8A, 0x05, 0x46, 0x80, 0x62, 0x21,
+    0x2F, 0x63, 0xEE, 0x1B, 0x11, 0xE7, 0x1E, 0xB6, 0xC2, 0x4C, 0x7E, 0x45, 0xE2, 0x19, 0xF6, 0x42,
+    0x56, 0xCA, 0xF3, 0xC9, 0xA3, 0x0A, 0x6B, 0x10, 0xB7, 0x9D, 0xA6, 0xA6, 0xEF, 0x16, 0xF9, 0x54,
+    0xBC, 0x36, 0x65, 0x66, 0x3C, 0x65, 0xCE, 0xAD, 0x16, 0xE1, 0x81, 0x05, 0x51, 0x21, 0x97, 0x8F,
+    0x49, 0x3F, 0x33, 0x97, 0x7A, 0x2C, 0x43, 0x8C, 0xCC, 0xD5, 0x92, 0x94, 0x51, 0xED, 0x55, 0x6D,
+    0xD8, 0xC4, 0x79, 0xF2, 0xD5, 0xC2, 0xEF, 0x76, 0xE4, 0x83, 0xC2, 0xF4, 0xBB, 0xB2, 0xAC, 0xF6,
+    0xCC, 0xE1, 0xA1, 0xDC, 0xF3, 0xB2, 0xD9, 0x3D, 0xE6, 0xAD, 0xB3, 0x9E, 0x2B, 0x6B, 0xA7, 0x8F,
+    0xD8, 0x75, 0x51, 0xB3, 0xF1, 0xCA, 0x75, 0xC7, 0xD4, 0xC8, 0xEC, 0x90, 0x0F, 0xEC, 0xEE, 0x0A,
+    0xBB, 0xBE, 0x39, 0xDC, 0x13, 0x71, 0x5D, 0x31, 0x43, 0x62, 0xB2, 0x2F, 0x47, 0xAF, 0x8B, 0xEB,
+    0xD0, 0xB6, 0x41, 0xC3, 0x3B, 0x44, 0x88, 0xA0, 0xA5, 0x10, 0x2D, 0x35, 0x26, 0x1C, 0x20, 0xBC,
+    0x5F, 0xDA, 0x86, 0x3A, 0x7A, 0x48, 0xEA, 0x21, 0x7C, 0x73, 0xE9, 0xF3, 0xDC, 0x4C, 0x55, 0x19,
+    0xB6, 0xB2, 0x3A, 0xEB, 0xCC, 0xA4, 0x79, 0x26, 0x62, 0x78, 0x57, 0x9E, 0xBA, 0x27, 0xC4, 0x8E,
+    0xE6, 0xBE, 0x2F, 0xFF, 0xC1, 0x5D, 0x53, 0x5C, 0xBE, 0x9B, 0x67, 0x7D, 0x55, 0xBF, 0x58, 0xFE,
+    0xBE, 0x3C, 0x94, 0xCB, 0xBE, 0x0A, 0xEA, 0x44, 0x38, 0xCC, 0xC5, 0x8A, 0xBC, 0xEB, 0xF7, 0xB2,
+    0x5F, 0x84, 0xC6, 0xA8, 0x93, 0x55, 0x91, 0x36, 0x95, 0x4C, 0xF1, 0xFE, 0x02, 0xFB, 0x7A, 0xC4,
+    0xDA, 0x93, 0xAB, 0xA4, 0x96, 0xF7, 0xA2, 0x46, 0xE4, 0x1B, 0xB4, 0xB2, 0xC0, 0xBD, 0x4E, 0xB4,
+    0x6C, 0xEE, 0x04, 0x62, 0x57, 0xE6, 0xF3, 0x79, 0x5E, 0x41, 0x7E, 0x72, 0x75, 0x9B, 0xAB, 0xF1,
+    0x7F, 0x6E, 0x4E, 0x9B, 0xAB, 0xF3, 0x9F, 0x66, 0x76, 0x28, 0x28, 0xFD, 0x6F, 0xA1, 0x8C, 0x8F,
+    0xF7, 0xF7, 0x8D, 0x28, 0xE3, 0x0D, 0x6B, 0x3B, 0x28, 0x23, 0x93, 0x4D, 0xDE, 0xEF, 0x92, 0xDD,
+    0x43, 0x28, 0x3F, 0x13, 0x65, 0xB0, 0x9B, 0xF5, 0x7C, 0x73, 0x07, 0xDD, 0x28, 0xCA, 0x90, 0xF5,
+    0xDF, 0xF2, 0x95, 0x2C, 0x0A, 0x74, 0xB2, 0x1E, 0x77, 0xE4, 0x4E, 0x19, 0x76, 0x26, 0xCF, 0x89,
+    0x1E, 0x76, 0x31, 0xCA, 0x02, 0xCA, 0xC8, 0x44, 0x72, 0x43, 0xE2, 0xDB, 0x36, 0xFB, 0x45, 0x17,
+    0xFF, 0xDD, 0xFC, 0xE8, 0xC5, 0xBF, 0xFC, 0x16, 0xCA, 0xB8, 0x2A, 0xD2, 0x10, 0xC6, 0xAC, 0x1D,
+    0x70, 0x75, 0x04, 0xD3, 0x63, 0x9B, 0xD8, 0xF6, 0x69, 0x39, 0xEE, 0x99, 0xBD, 0x43, 0x93, 0x1E,
+    0x9A, 0x44, 0x5A, 0xB9, 0x4E, 0xDF, 0x1B, 0xE5, 0x7D, 0x9F, 0x23, 0x18, 0xEF, 0x06, 0xEE, 0x6C,
+    0xBF, 0xA1, 0xF9, 0x21, 0xCC, 0x9C, 0x8A, 0x59, 0x0D, 0xDE, 0x37, 0xDD, 0x6C, 0xBC, 0x5B, 0xE6,
+    0xF1, 0x1F, 0x3E, 0xCB, 0xC6, 0x5C, 0x7A, 0x68, 0x3C, 0x5B, 0x95, 0x41, 0x1F, 0x0B, 0x67, 0x71,
+    0xE3, 0x37, 0xD8, 0x9D, 0x71, 0x0D, 0x01, 0x1B, 0xEC, 0x20, 0x38, 0x15, 0xD9, 0x7C, 0x54, 0x15,
+    0xCC, 0x4E, 0x1F, 0xE4, 0x61, 0x1D, 0x9A, 0x74, 0x7E, 0x5B, 0x46, 0x99, 0x44, 0xE3, 0x1F, 0xCA,
+    0x67, 0x62, 0xA9, 0xAA, 0xDB, 0x8D, 0x37, 0x86, 0x9D, 0xDF, 0xCB, 0xAA, 0xFE, 0x19, 0x56, 0xB6,
+    0xB8, 0x1C, 0x93, 0x96, 0xE6, 0xA2, 0xC8, 0x23, 0x83, 0xC5, 0x2D, 0x72, 0xB5, 0x32, 0x49, 0x7D,
+    0x4D, 0xFE, 0xF7, 0xE4, 0x3A, 0xCB, 0x2B, 0xD9, 0xCF, 0xA3, 0xF1, 0x84, 0x05, 0x33, 0xC7, 0x2E,
+    0x16, 0x23, 0x2E, 0xD3, 0xA7, 0xB9, 0x11, 0xD3, 0xB6, 0xDE, 0x96, 0x21, 0x5D, 0x18, 0x1C, 0x59,
+    0x83, 0x56, 0x6C, 0x08, 0x9C, 0x61, 0xCD, 0x5B, 0x6B, 0xBC, 0xCC, 0x4A, 0xBA, 0xB6, 0x1C, 0x17,
+    0x50, 0x49, 0x29, 0xE6, 0x12, 0x2F, 0x27, 0x6A, 0x08, 0xC4, 0x71, 0xE9, 0x4C, 0x74, 0x03, 0x93,
+    0x91, 0x3D, 0x80, 0xB9, 0x64, 0xBF, 0x89, 0x7D, 0x12, 0xD7, 0x32, 0x99, 0x54, 0x5A, 0x5B, 0xFE,
+    0xF5, 0x70, 0x2E, 0x7C, 0x60, 0x7F, 0x2E, 0x86, 0xF8, 0x53, 0x9B, 0xDB, 0x32, 0x2E, 0x6F, 0xC8,
+    0x86, 0x56, 0xDF, 0x90, 0xE4, 0x34, 0x92, 0xE5, 0xDA, 0x48, 0x66, 0xF4, 0x1C, 0x19, 0x97, 0x6C,
+    0x46, 0x5F, 0x42, 0xDB, 0x66, 0xCC, 0xEF, 0x60, 0x0F, 0x04, 0x22, 0x5B, 0x5B, 0xC7, 0x76, 0xFA,
+    0x93, 0x5E, 0xEC, 0xDB, 0x42, 0x0C, 0x57, 0x26, 0x6D, 0xF3, 0x5B, 0xB5, 0x09, 0xDB, 0x98, 0x6D,
+    0xC0, 0xD6, 0x5C, 0xBC, 0x87, 0xD6, 0xCC, 0xFE, 0x0F, 0x5B, 0x61, 0xE7, 0xCC, 0x22, 0x58, 0xE4,
+    0x26, 0x59, 0x04, 0x56, 0x39, 0x31, 0xA9, 0xA9, 0x6A, 0x5B, 0xDB, 0xB2, 0xC0, 0x8B, 0x97, 0x8D,
+    0xD8, 0x6F, 0xE0, 0x0B, 0xF1, 0xE4, 0x50, 0x01, 0xFF, 0xB2, 0xB2, 0x98, 0x4C, 0xF1, 0x99, 0x7C,
+    0x7C, 0x04, 0xD5, 0x54, 0x5D, 0xFC, 0xA0, 0x3D, 0x23, 0x7A, 0x89, 0xA9, 0x97, 0x94, 0xAA, 0x11,
+    0x45, 0x14, 0x54, 0xC4, 0x7D, 0x68, 0x41, 0x24, 0x2F, 0x1B, 0x7D, 0x7F, 0xFF, 0x06, 0x37, 0xF4,
+    0x24, 0x7E, 0x4D, 0xAC, 0x4C, 0x5C, 0x27, 0x75, 0x5A, 0xC6, 0x4D, 0x96, 0x27, 0x75, 0x61, 0xF0,
+    0x9F, 0xCA, 0x7F, 0x96, 0x17, 0xF2, 0x4C, 0xF6, 0xDA, 0x28, 0xC2, 0x10, 0x9F, 0x32, 0x77, 0x96,
+    0x4A, 0x96, 0xA0, 0xD0, 0x77, 0x88, 0x45, 0xB9, 0x27, 0x48, 0x47, 0x96, 0xCB, 0xE8, 0x4C, 0x52,
+    0xDC, 0xCA, 0x22, 0x8B, 0x3A, 0x51, 0x50, 0xDC, 0x15, 0x32, 0x71, 0x29, 0xAA, 0xBF, 0x2F, 0x6B,
+    0xCA, 0x1B, 0xC4, 0xFE, 0x06, 0xAD, 0x28, 0x31, 0xCE, 0x67, 0x70, 0xE0, 0xD4, 0xD7, 0x91, 0xA2,
+    0x1F, 0x21, 0x9B, 0xEA, 0xAD, 0x30, 0x9E, 0x8C, 0xF1, 0xA0, 0xE5, 0x9A, 0x07, 0x17, 0x1E, 0xB7,
+    0x7A, 0x6D, 0x28, 0x22, 0xE5, 0x99, 0x6B, 0x38, 0xA1, 0xD2, 0x4B, 0xEE, 0x07, 0xB0, 0x47, 0x40,
+    0x51, 0x70, 0x9B, 0xA0, 0x0F, 0x1B, 0xEF, 0x03, 0x70, 0x1B, 0x97, 0x21, 0x6D, 0x56, 0x6A, 0x92,
+    0x1E, 0x7C, 0x1F, 0x62, 0xA1, 0x08, 0xF3, 0xBD, 0xF9, 0xAF, 0xCE, 0xEC, 0xEF, 0xFF, 0x51, 0x1B,
+    0x7C, 0x8A, 0x45, 0x14, 0xD5, 0x31, 0x3D, 0x62, 0x92, 0xCF, 0x38, 0xC1, 0x9E, 0xB9, 0xC3, 0xA5,
+    0x74, 0xD7, 0x6F, 0xB0, 0x5F, 0xBC, 0x3E, 0xA4, 0x1B, 0x0F, 0xDA, 0x33, 0xF3, 0xEA, 0x4B, 0xDD,
+    0x9B, 0xD8, 0x97, 0x89, 0xDA, 0x1F, 0x12, 0x21, 0xBC, 0x83, 0x88, 0xC4, 0x72, 0x51, 0x9A, 0xF3,
+    0xFB, 0x37, 0x94, 0xBF, 0x38, 0x27, 0x7B, 0x7B, 0xCA, 0xDD, 0x5D, 0x65, 0xAE, 0x27, 0x6F, 0x50,
+    0xB8, 0x0C, 0x15, 0x71, 0x47, 0x72, 0x30, 0x99, 0x6C, 0x4F, 0xF9, 0xBA, 0x4B, 0xB6, 0xC8, 0x7D,
+    0xA1, 0xCC, 0x17, 0x26, 0x7E, 0xAF, 0x6A, 0x84, 0xA7, 0x34, 0xFE, 0x6A, 0x14, 0x96, 0xDE, 0x49,
+    0xEB, 0x49, 0x38, 0x1A, 0x52, 0x53, 0x14, 0xF6, 0x37, 0x5D, 0x62, 0x8A, 0xFD, 0xFD, 0xB7, 0x6A,
+    0xAA, 0x58, 0xE6, 0x04, 0x78, 0x11, 0x12, 0xC5, 0x8F, 0x60, 0xA8, 0xB0, 0xC1, 0x9C, 0x90, 0x31,
+    0xE6, 0x3C, 0x04, 0xC3, 0x14, 0x95, 0xBC, 0x11, 0x95, 0xDF, 0xC3, 0x9C, 0x33, 0xF3, 0xAA, 0xDC,
+    0xE8, 0x4D, 0xF3, 0x5E, 0xE6, 0x94, 0xAD, 0x83, 0x89, 0xFD, 0xF9, 0xFC, 0x16, 0x8C, 0x13, 0x9F,
+    0xB5, 0x15, 0x1F, 0x09, 0x06, 0xD9, 0xF8, 0x82, 0x83, 0x82, 0x4E, 0xBC, 0x13, 0x1C, 0x4F, 0x23,
+    0xAF, 0xF7, 0x8C, 0x82, 0x98, 0xBB, 0x14, 0x7E, 0x8E, 0x15, 0x61, 0x5E, 0xE9, 0x39, 0x97, 0x29,
+    0x7A, 0x32, 0x08, 0x10, 0x45, 0x9D, 0x09, 0x73, 0x7B, 0xAE, 0x1F, 0xCD, 0x9F, 0xCA, 0xAC, 0xD9,
+    0x7B, 0x9D, 0x2A, 0xE6, 0xF5, 0x26, 0x94, 0x85, 0xE9, 0x4D, 0x71, 0x19, 0x8F, 0xB2, 0x63, 0x85,
+    0xB1, 0xD9, 0x68, 0xCE, 0xCC, 0xF3, 0x77, 0xCC, 0x7F, 0x52, 0xBB, 0x43, 0xF0, 0x09, 0x06, 0xF6,
+    0xBB, 0xF8, 0x75, 0x50, 0x17, 0xD6, 0xD7, 0xE9, 0xBD, 0xE3, 0xFC, 0x0E, 0x04, 0x2C, 0xBE, 0x07,
+    0xFB, 0x5D, 0xD8, 0xF5, 0xE6, 0xB7, 0x1F, 0x95, 0x00, 0xE0, 0xD4, 0x13, 0x88, 0x80, 0x2E, 0x41,
+    0x04, 0x6D, 0x5F, 0x2E, 0x0E, 0x8D, 0xE3, 0x99, 0xD3, 0xFB, 0xC4, 0x93, 0xB9, 0x2E, 0x40, 0xA0,
+    0xA1, 0x04, 0x0F, 0x75, 0x0E, 0x92, 0xBB, 0x9F, 0xD3, 0x0E, 0x30, 0xC7, 0x4E, 0xE1, 0x3B, 0x0A,
+    0x76, 0x70, 0xAB, 0x6C, 0x43, 0x38, 0x9E, 0xA4, 0x55, 0x8B, 0x54, 0xE5, 0xE0, 0x92, 0xFF, 0x9D,
+    0x18, 0xBA, 0xC1, 0x0A, 0xCE, 0xAD, 0xF2, 0xA0, 0xCF, 0xEA, 0x44, 0x60, 0x95, 0xE0, 0x2A, 0xE7,
+    0x98, 0xC0, 0xC4, 0x4F, 0x15, 0x72, 0x2F, 0x9C, 0x33, 0x70, 0x9B, 0x9D, 0x26, 0x4E, 0xD7, 0xB8,
+    0x51, 0xAD, 0x2B, 0x7D, 0xEB, 0x9F, 0x48, 0xDF, 0x4C, 0x74, 0x95, 0xA9, 0x05, 0x34, 0x05, 0x57,
+    0xBD, 0xF9, 0x8A, 0x9D, 0xFF, 0x85, 0x82, 0xF1, 0xBF, 0xA7, 0x5D, 0x8C, 0x7F, 0xCC, 0x2E, 0x09,
+    0xC8, 0xF2, 0x2C, 0x20, 0x08, 0xBF, 0xEB, 0xB3, 0xEB, 0xD9, 0xF9, 0x2D, 0xA9, 0x08, 0x6B, 0x76,
+    0x62, 0x6B, 0x27, 0x65, 0x14, 0x5D, 0xA6, 0xE8, 0xB5, 0x62, 0x07, 0x89, 0x56, 0x2A, 0x50, 0xD9,
+    0xE3, 0x8A, 0x85, 0xB9, 0xD4, 0x60, 0xFB, 0xD5, 0x28, 0xEF, 0x69, 0x37, 0x11, 0xC1, 0x5E, 0xB2,
+    0x47, 0x82, 0xDB, 0x1F, 0x66, 0x02, 0x22, 0x32, 0xAB, 0x8C, 0xBE, 0x78, 0xB4, 0x45, 0xBD, 0x4A,
+    0x59, 0x3F, 0xF2, 0x15, 0x79, 0x84, 0xCA, 0xBB, 0x67, 0x4E, 0x0C, 0xD3, 0x4E, 0xD5, 0x44, 0xC9,
+    0xA2, 0xE2, 0x49, 0x15, 0x9E, 0x69, 0x30, 0x44, 0xD7, 0x16, 0x36, 0xB0, 0xA6, 0xE0, 0x39, 0x3F,
+    0x29, 0x4C, 0x5F, 0x50, 0x2D, 0xDA, 0xE6, 0x2C, 0x01, 0xE4, 0x70, 0x88, 0x09, 0x03, 0xC2, 0xC9,
+    0x97, 0x4C, 0xA5, 0x9C, 0x9D, 0x3A, 0x29, 0x2A, 0xF6, 0x7A, 0x6E, 0xD5, 0x60, 0x84, 0xE9, 0x58,
+    0x76, 0xBE, 0x86, 0x18, 0xDB, 0xBB, 0xF7, 0x44, 0xE8, 0xF6, 0x8C, 0xB2, 0x54, 0x90, 0x16, 0xEF,
+    0xE1, 0xBB, 0x24, 0xB7, 0x89, 0xD5, 0x64, 0xC5, 0x1B, 0xAF, 0xBC, 0xBE, 0xD0, 0xC5, 0x3E, 0x7E,
+    0x87, 0xB9, 0x45, 0x18, 0x6F, 0x39, 0x75, 0xB2, 0xBA, 0x32, 0x7F, 0x33, 0x1A, 0x25, 0xCE, 0xFB,
+    0xD5, 0x48, 0xEF, 0x28, 0x53, 0x7C, 0x32, 0xB8, 0xAB, 0xF8, 0x8D, 0xDE, 0x28, 0xBC, 0x49, 0xE1,
+    0x57, 0xC8, 0xEE, 0x61, 0xDC, 0x39, 0xD5, 0xF7, 0xCB, 0x2B, 0xBF, 0x8D, 0x5B, 0x07, 0xAE, 0xEB,
+    0xC4, 0x99, 0xFA, 0xD8, 0x25, 0x01, 0x80, 0x17, 0x32, 0x75, 0xC2, 0xE2, 0x54, 0xE5, 0x8A, 0x41,
+    0x84, 0x20, 0x97, 0x72, 0xE9, 0x19, 0x2A, 0xE7, 0x2A, 0x94, 0x59, 0x86, 0xF0, 0xCB, 0xAB, 0x43,
+    0x95, 0x03, 0xDD, 0xB6, 0x73, 0x30, 0xC2, 0x3F, 0xE4, 0x76, 0x86, 0xF6, 0x15, 0xF2, 0x8C, 0x09,
+    0x12, 0x70, 0x95, 0x10, 0x27, 0x80, 0x9B, 0x19, 0x9F, 0x8B, 0x11, 0x79, 0x9A, 0x57, 0xEC, 0x91,
+    0x5F, 0x91, 0xDD, 0x0C, 0xA9, 0x11, 0x04, 0x50, 0x1B, 0x79, 0x22, 0x84, 0x83, 0x09, 0xC9, 0xAB,
+    0xE0, 0xAB, 0x83, 0x05, 0xFE, 0x84, 0x2F, 0x01, 0xF3, 0x22, 0x49, 0x79, 0x5C, 0x1C, 0xA3, 0xD7,
+    0x7A, 0xA4, 0x47, 0xB5, 0x17, 0xB2, 0x8D, 0x55, 0x3E, 0x0A, 0xD5, 0x55, 0x42, 0x0A, 0xE1, 0x9B,
+    0x0D, 0x50, 0xFF, 0x35, 0x6D, 0xDA, 0xAC, 0xD7, 0x10, 0xC6, 0xF9, 0x9E, 0x11, 0xB4, 0x20, 0xBC,
+    0xFA, 0xF6, 0x16, 0x7C, 0x70, 0x41, 0x19, 0x45, 0xCC, 0x71, 0x99, 0xEB, 0xB9, 0x8A, 0x70, 0x95,
+    0x49, 0x31, 0xBA, 0x17, 0x83, 0x8D, 0x94, 0x15, 0x45, 0x9E, 0x32, 0xAD, 0x94, 0x3A, 0xB7, 0x3C,
+    0xDF, 0x72, 0xC6, 0xCE, 0x3B, 0x6D, 0x3B, 0x63, 0xCF, 0x29, 0x6F, 0x1D, 0x19, 0xE9, 0x02, 0x29,
+    0x75, 0x75, 0xC8, 0x23, 0x02, 0x93, 0x10, 0x66, 0x89, 0xA6, 0x12, 0x8D, 0xB8, 0x62, 0x1D, 0x32,
+    0x51, 0x60, 0x80, 0xAC, 0xDB, 0xB4, 0xE9, 0xFB, 0x7D, 0xD7, 0xE9, 0xC2, 0x0A, 0x5C, 0x67, 0xED,
+    0xA4, 0x91, 0x37, 0x13, 0x2C, 0x3A, 0x69, 0xBC, 0xDD, 0xE9, 0xE2, 0x71, 0x2B, 0xC7, 0x2D, 0x1B,
+    0x88, 0xEA, 0x88, 0xA4, 0x7B, 0x2D, 0x69, 0x00, 0xD9, 0x95, 0x2E, 0x7C, 0x4B, 0x1C, 0x74, 0xA0,
+    0x64, 0x42, 0xB7, 0x36, 0xDF, 0xF4, 0xC9, 0x2A, 0x5F, 0x40, 0xE9, 0x0D, 0x9F, 0xAC, 0x53, 0x39,
+    0x34, 0xB4, 0xE9, 0x93, 0xBF, 0xEB, 0x4C, 0xCF, 0xDD, 0x8C, 0x6A, 0x8D, 0xF5, 0xCD, 0xF4, 0xCF,
+    0x39, 0xDE, 0x3D, 0x80, 0x65, 0x61, 0x9D, 0xAA, 0xF6, 0x36, 0x55, 0xFD, 0xDD, 0x66, 0x5A, 0x82,
+    0x18, 0x7A, 0xA9, 0x41, 0xBD, 0x94, 0xEB, 0x7A, 0x75, 0x45, 0x4F, 0xF1, 0x52, 0xDF, 0x69, 0x6E,
+    0x3D, 0x82, 0xAE, 0xC9, 0xB8, 0x00, 0x4D, 0xD3, 0x06, 0x8C, 0x43, 0xFC, 0x2D, 0x7E, 0x63, 0xC7,
+    0x22, 0x82, 0x4F, 0x06, 0x59, 0xA5, 0x4B, 0x93, 0xA8, 0x15, 0xB0, 0xCB, 0x51, 0xC8, 0x14, 0x59,
+    0x22, 0x43, 0x64, 0x87, 0x1E, 0x80, 0x89, 0x5D, 0x32, 0x12, 0xAF, 0x9B, 0x76, 0x65, 0x5F, 0xEA,
+    0xA5, 0xFD, 0xA2, 0x35, 0xE1, 0xE8, 0xB4, 0xDC, 0x98, 0xF0, 0xC0, 0xFE, 0x3B, 0xDC, 0x94, 0x4A,
+    0xE6, 0xE2, 0xAD, 0xE5, 0x9D, 0x76, 0x99, 0x25, 0x67, 0xFA, 0x12, 0xBE, 0x6A, 0x8D, 0x94, 0x9E,
+    0x17, 0x72, 0x89, 0x69, 0x63, 0x5C, 0xA6, 0xCC, 0x07, 0x32, 0xD2, 0x44, 0x30, 0x59, 0x8B, 0x46,
+    0x4E, 0xAD, 0xC4, 0xFB, 0x9C, 0x90, 0xEB, 0xB7, 0xA2, 0xF9, 0xB0, 0x97, 0x88, 0x3B, 0xEC, 0x13,
+    0x1C, 0x62, 0xC0, 0xA6, 0xE7, 0xDE, 0x63, 0x8B, 0xFD, 0x79, 0xA0, 0x54, 0xC8, 0xF8, 0x0F, 0x87,
+    0x34, 0x30, 0x5E, 0x55, 0xFF, 0xEE, 0xA4, 0xB7, 0x57, 0x8A, 0x5C, 0x52, 0x1E, 0x43, 0x70, 0x74,
+    0x21, 0x29, 0xEA, 0x49, 0x94, 0xB8, 0x3F, 0x90, 0x25, 0xB4, 0xF8, 0xAE, 0x1B, 0xD9, 0x05, 0xEC,
+    0x70, 0x12, 0x53, 0x07, 0x23, 0xB2, 0x61, 0xA5, 0x78, 0x61, 0x90, 0x28, 0x0F, 0x60, 0x04, 0x79,
+    0x1C, 0x5D, 0xCC, 0xD4, 0x1E, 0xFC, 0x31, 0x48, 0xCD, 0x98, 0xD0, 0x83, 0xD7, 0x04, 0xB9, 0x96,
+    0xF9, 0x3C, 0x7F, 0xE2, 0xE4, 0xD1, 0x40, 0xA2, 0x81, 0xDF, 0xAC, 0x39, 0x23, 0x1F, 0x1D, 0x28,
+    0x2C, 0x90, 0x3D, 0x37, 0x39, 0x85, 0x5F, 0x58, 0x86, 0xB7, 0xB6, 0xBE, 0xE6, 0x4C, 0x6B, 0x7F,
+    0x93, 0x17, 0x57, 0x42, 0x45, 0x33, 0xE6, 0x9A, 0x59, 0xA6, 0xB6, 0xB6, 0x03, 0x00, 0xE1, 0xBD,
+    0x14, 0xC3, 0x30, 0x81, 0xFB, 0x46, 0x9E, 0x03, 0xE3, 0x55, 0xBB, 0x14, 0x58, 0x67, 0x08, 0xD7,
+    0x08, 0x3A, 0x79, 0x48, 0xF4, 0xB7, 0xA3, 0xA6, 0x5D, 0xCC, 0x6F, 0x16, 0x3C, 0x7A, 0x13, 0xC4,
+    0x65, 0x09, 0x7D, 0xC4, 0x45, 0x0B, 0x69, 0xC7, 0x34, 0xE1, 0xC2, 0x05, 0x33, 0x06, 0x6D, 0xA6,
+    0x17, 0x41, 0x23, 0xF8, 0x81, 0x66, 0xAF, 0x8E, 0xD5, 0xBE, 0x87, 0x75, 0x34, 0x30, 0x43, 0x1B,
+    0x95, 0x22, 0x23, 0x1E, 0x8A, 0xE4, 0xFE, 0x82, 0xE1, 0x58, 0x9C, 0x7B, 0x96, 0xD1, 0xA8, 0x18,
+    0x3A, 0xFB, 0x46, 0xAD, 0x00, 0xB3, 0xF8, 0xB3, 0x52, 0x53, 0x00, 0xD9, 0x3F, 0xE4, 0x9A, 0xF8,
+    0x49, 0x71, 0xD6, 0x03, 0x0A, 0x62, 0xEB, 0xC0, 0x57, 0x34, 0x29, 0x6C, 0x43, 0x56, 0xD3, 0x30,
+    0x11, 0x13, 0x2C, 0x98, 0x4C, 0x3F, 0xD2, 0x33, 0xB0, 0x0A, 0x48, 0x45, 0x77, 0xBD, 0xB9, 0x5A,
+    0x6E, 0x9A, 0x39, 0x45, 0x29, 0x0E, 0xA6, 0x18, 0xE3, 0x20, 0xD7, 0xEE, 0x93, 0xD2, 0xF2, 0x28,
+    0x1E, 0x60, 0x3E, 0x3C, 0x61, 0x4B, 0x04, 0x97, 0xA2, 0x5C, 0x20, 0x2E, 0xE0, 0x2A, 0x68, 0xA9,
+    0xE6, 0x82, 0xE3, 0x91, 0x5F, 0xED, 0x4D, 0x74, 0xF0, 0x5C, 0xAD, 0x49, 0x1B, 0x6A, 0x47, 0x30,
+    0x96, 0xB6, 0x5C, 0xA9, 0x69, 0x4B, 0x38, 0x96, 0x35, 0xC4, 0x63, 0x59, 0x43, 0x40, 0x96, 0xD5,
+    0x5C, 0xB1, 0x85, 0x76, 0x55, 0xEE, 0xAC, 0x13, 0x3A, 0x59, 0x11, 0xE8, 0x64, 0x40, 0xC0, 0x06,
+    0x59, 0x18, 0x89, 0xAE, 0x20, 0x0C, 0x26, 0x1F, 0x00, 0x90, 0x01, 0x7C, 0x4F, 0x1A, 0xF5, 0x16,
+    0x8F, 0x48, 0xA6, 0xEA, 0xD4, 0x98, 0xF3, 0x4B, 0xE3, 0xBB, 0x8D, 0x3C, 0x8A, 0x4D, 0xE4, 0xE1,
+    0x44, 0xE0, 0x4E, 0x59, 0xB7, 0x16, 0xCA, 0x89, 0xE0, 0x5D, 0xFD, 0x93, 0x09, 0x27, 0xB7, 0xF4,
+    0xD5, 0xCB, 0x1D, 0x90, 0xDD, 0x91, 0x7E, 0x2A, 0x68, 0xF5, 0xE4, 0xC0, 0x9C, 0x38, 0xDE, 0x9D,
+    0x91, 0xB0, 0xED, 0x59, 0x22, 0x82, 0x05, 0xCE, 0xA0, 0xA3, 0xEF, 0x33, 0xC0, 0x38, 0x6B, 0x8A,
+    0xF6, 0x09, 0xAC, 0x79, 0x22, 0x98, 0x3E, 0x56, 0x6D, 0x2E, 0xE8, 0x27, 0x7C, 0xED, 0xBC, 0x51,
+    0x97, 0xF9, 0xB9, 0xA7, 0xC0, 0xAF, 0x93, 0xB1, 0xC3, 0x25, 0x4A, 0x33, 0x2F, 0x21, 0xBE, 0xCC,
+    0x10, 0x47, 0x89, 0x4B, 0xEA, 0xC0, 0xF1, 0xC8, 0xFC, 0x79, 0xB1, 0x84, 0x10, 0x94, 0x05, 0xAF,
+    0xF8, 0x1E, 0x3E, 0xE5, 0x7D, 0x7C, 0x82, 0xCF, 0x5E, 0xC3, 0xCA, 0xD8, 0x90, 0x4D, 0xBE, 0x4A,
+    0x15, 0x8A, 0x98, 0x62, 0x15, 0xD3, 0xE2, 0x29, 0x62, 0x0A, 0x2C, 0xC5, 0x14, 0x55, 0x14, 0xD3,
+    0x15, 0x15, 0xD3, 0xAE, 0x8A, 0xA9, 0xA7, 0x98, 0xFC, 0x96, 0x62, 0x0A, 0x6B, 0x8A, 0x29, 0x56,
+    0x31, 0xCD, 0x54, 0x4C, 0xC7, 0x14, 0x93, 0xB8, 0x09, 0x88, 0x29, 0xA8, 0x29, 0xA6, 0x28, 0xA7,
+    0x98, 0xAE, 0xA8, 0x98, 0x76, 0x55, 0x4C, 0x3D, 0xC5, 0xF4, 0xF3, 0x96, 0x62, 0xFA, 0xA2, 0xA6,
+    0x98, 0xAC, 0x8A, 0x69, 0xB1, 0x29, 0x26, 0xCF, 0x52, 0x4C, 0xC1, 0xBF, 0x50, 0x4C, 0x51, 0x4E,
+    0x31, 0xBD, 0x60, 0xB6, 0xAD, 0xA1, 0x56, 0x0A, 0xB8, 0x6A, 0x09, 0x89, 0x46, 0x96, 0xC7, 0x40,
+    0x6A, 0x28, 0xF2, 0xC7, 0x77, 0x47, 0x26, 0x63, 0xA5, 0x76, 0xD0, 0xAE, 0xF7, 0x80, 0xD4, 0x27,
+    0xC5, 0x2B, 0xC7, 0x8A, 0x58, 0x5C, 0x0E, 0xA0, 0x23, 0x2A, 0x40, 0x6E, 0x7F, 0x34, 0x9A, 0xC7,
+    0xE7, 0xD1, 0x24, 0x66, 0x13, 0xB7, 0x07, 0x24, 0x21, 0x1C, 0x12, 0x1C, 0xD4, 0x0A, 0x0E, 0x4A,
+    0xA2, 0x02, 0x99, 0x10, 0xA8, 0x40, 0x3A, 0xB8, 0xA8, 0x58, 0x41, 0x4C, 0xA2, 0xDD, 0x8E, 0x3A,
+    0xE7, 0x99, 0x9A, 0xEE, 0x5D, 0xED, 0x0E, 0xB5, 0x1B, 0x18, 0x49, 0x7A, 0x6E, 0xB1, 0xB4, 0x4C,
+    0x97, 0x03, 0x83, 0x87, 0x1A, 0x00, 0xA8, 0x0F, 0x14, 0x7A, 0x96, 0x05, 0x1D, 0x5A, 0x0E, 0xE3,
+    0x80, 0xD6, 0x32, 0x68, 0x08, 0x5D, 0x44, 0xA0, 0x1F, 0xCD, 0x9E, 0x88, 0xBC, 0x4F, 0x08, 0xEF,
+    0x4B, 0x37, 0xA8, 0x8A, 0x2F, 0x5C, 0xB1, 0xCC, 0x42, 0x6B, 0x63, 0x32, 0x3D, 0xFA, 0x74, 0x61,
+    0x80, 0x77, 0xC2, 0x78, 0x8F, 0xCA, 0x1D, 0x85, 0x3F, 0x74, 0xFE, 0x69, 0x4D, 0x4C, 0x9C, 0xE8,
+    0x61, 0xE7, 0xE3, 0xF8, 0xF0, 0x04, 0x2D, 0xF6, 0xF9, 0x66, 0x84, 0xEC, 0x36, 0xBC, 0xCB, 0x33,
+    0x65, 0xCE, 0x5D, 0x3C, 0x71, 0xF4, 0x93, 0xDA, 0xD1, 0x13, 0x08, 0x9F, 0x69, 0x07, 0x68, 0x29,
+    0x7C, 0xC0, 0x9E, 0x21, 0x80, 0xB7, 0xBA, 0x4B, 0xC4, 0xC8, 0xA5, 0x1A, 0x2F, 0x1C, 0x6A, 0xBC,
+    0xD1, 0xAB, 0x57, 0x60, 0x1C, 0xD2, 0x12, 0x56, 0xC4, 0x1D, 0x4F, 0xE1, 0xA2, 0x6E, 0xA6, 0x73,
+    0x6B, 0x21, 0xD6, 0xA3, 0xD6, 0xA1, 0xF6, 0x8D, 0x4D, 0xF8, 0x58, 0x38, 0xBF, 0x1D, 0xC7, 0xBB,
+    0x6E, 0xD8, 0xE4, 0xC0, 0x85, 0xF3, 0x09, 0x5F, 0xBD, 0x68, 0xA7, 0x5B, 0x1A, 0xD0, 0x34, 0x2E,
+    0xBE, 0xAA, 0x19, 0xD7, 0x30, 0xF2, 0xE1, 0x5B, 0x9A, 0xCB, 0x54, 0xD4, 0x57, 0x31, 0xDC, 0xB1,
+    0x1F, 0xC1, 0x99, 0x4D, 0x88, 0x30, 0x3C, 0xCD, 0x27, 0x8E, 0x70, 0x34, 0xFE, 0xE8, 0xA2, 0x99,
+    0x80, 0x59, 0x57, 0x69, 0x43, 0x5A, 0x5C, 0x99, 0x4F, 0x23, 0x19, 0x0D, 0x64, 0x34, 0x8E, 0x11,
+    0xBF, 0x96, 0x34, 0x1E, 0x04, 0xF1, 0xE5, 0xED, 0x05, 0x93, 0xC1, 0xB7, 0x56, 0x35, 0x55, 0x9C,
+    0x50, 0x13, 0xA7, 0xCC, 0x88, 0x1C, 0x30, 0xD8, 0xAA, 0x9C, 0xD3, 0x32, 0x38, 0x6B, 0x34, 0x6B,
+    0x6A, 0x04, 0xB5, 0x2B, 0xEF, 0x32, 0x6A, 0xE1, 0x40, 0x3A, 0xB3, 0x63, 0x28, 0x72, 0xC8, 0x5D,
+    0xE5, 0x89, 0x8B, 0x10, 0xD9, 0x4F, 0xDA, 0x67, 0x38, 0x5D, 0xC7, 0x01, 0xE8, 0x18, 0x4C, 0x73,
+    0x4A, 0x4E, 0x53, 0x1A, 0xFE, 0xA8, 0xD5, 0x09, 0xC1, 0xA0, 0x35, 0x0C, 0x41, 0xAF, 0xA8, 0x3F,
+    0xEC, 0x14, 0x00, 0x47, 0x9D, 0x4B, 0x8F, 0xB6, 0x1A, 0x40, 0xC4, 0xAD, 0xEA, 0x43, 0xC2, 0x56,
+    0xE6, 0xCA, 0x71, 0xF8, 0x3D, 0x28, 0x19, 0x14, 0x3F, 0x92, 0x21, 0xEC, 0x5F, 0xAB, 0x19, 0x4D,
+    0x14, 0x61, 0xA3, 0x7D, 0xD4, 0x68, 0x98, 0x11, 0x75, 0x2C, 0xC8, 0x9B, 0x82, 0xE9, 0xA0, 0x25,
+    0xB0, 0xAE, 0x98, 0x19, 0x19, 0xCD, 0xE9, 0x1B, 0x6B, 0x85, 0x2E, 0x75, 0xE8, 0x8A, 0xF7, 0x56,
+    0x5A, 0xD4, 0x0A, 0xB1, 0x75, 0x1A, 0x34, 0x73, 0x42, 0xCA, 0x3E, 0xDB, 0x3A, 0xC1, 0x74, 0xAB,
+    0xA3, 0xDA, 0x38, 0xBE, 0xD4, 0x85, 0xEC, 0xF2, 0xA5, 0x1B, 0x0B, 0x98, 0xB3, 0x8A, 0xBF, 0x46,
+    0x84, 0xF4, 0xEB, 0x03, 0xEC, 0x19, 0x9E, 0xCD, 0x5B, 0x68, 0xD3, 0xA7, 0x36, 0x03, 0xEA, 0x71,
+    0x55, 0x2D, 0x89, 0xDA, 0x92, 0x86, 0xB5, 0x25, 0xB5, 0x2B, 0x9B, 0xCC, 0x58, 0xCC, 0x20, 0x7A,
+    0x2C, 0xE0, 0x86, 0xD1, 0xA2, 0x56, 0x32, 0xF7, 0x2D, 0x07, 0x83, 0x1E, 0xEA, 0xCB, 0x15, 0xB0,
+    0xCE, 0x71, 0xF5, 0x06, 0x0A, 0x16, 0x44, 0x0F, 0xA1, 0xCD, 0x51, 0x20, 0xF2, 0x26, 0x8F, 0x71,
+    0x45, 0xC5, 0x1F, 0xAC, 0x53, 0x4D, 0xBA, 0x2A, 0xEE, 0xAF, 0xAB, 0x12, 0x95, 0xE6, 0x4D, 0xE8,
+    0xF9, 0x3C, 0xD0, 0xAC, 0x82, 0x0E, 0x17, 0x7A, 0x04, 0xC1, 0x85, 0x0C, 0x41, 0x7B, 0x03, 0x4F,
+    0xB7, 0x1B, 0x10, 0xBD, 0x75, 0x72, 0xF8, 0x3C, 0xD0, 0x7C, 0x61, 0x9D, 0x04, 0x88, 0x6C, 0x2F,
+    0x94, 0x9C, 0x65, 0xF8, 0xBF, 0x8C, 0xFD, 0x4F, 0x3D, 0x57, 0x12, 0xF6, 0xDB, 0x88, 0x35, 0x28,
+    0xB0, 0xFD, 0x11, 0x37, 0x63, 0xC8, 0x0C, 0xD1, 0x63, 0x29, 0xA2, 0xE7, 0x45, 0xB6, 0x5A, 0x4B,
+    0xA6, 0xE7, 0xC8, 0xEF, 0xBC, 0x0D, 0xBD, 0xF7, 0x4C, 0x53, 0x74, 0xC1, 0xBA, 0xBD, 0x97, 0x94,
+    0xAB, 0x7B, 0x74, 0xC9, 0x3F, 0x3F, 0xF4, 0x0B, 0xEA, 0x05, 0x19, 0xBE, 0x5D, 0xB0, 0x1A, 0x34,
+    0xE9, 0x0F, 0xFE, 0xE2, 0x73, 0x0C, 0x51, 0xCA, 0x6D, 0x45, 0x29, 0x1E, 0x8D, 0xA7, 0x48, 0x6A,
+    0xEE, 0xB3, 0x52, 0x6C, 0xBB, 0xD0, 0x56, 0xE4, 0x6A, 0xE0, 0x2D, 0x1C, 0x74, 0xD2, 0xC8, 0x1D,
+    0x28, 0x8B, 0xAC, 0xC5, 0xD5, 0x80, 0x9C, 0x7F, 0xB2, 0x5A, 0xE4, 0x84, 0xF2, 0x0A, 0x10, 0xF6,
+    0x13, 0xF5, 0x2B, 0x95, 0xCB, 0xE1, 0x59, 0x97, 0x72, 0x63, 0x9F, 0x95, 0x6A, 0x55, 0xB3, 0x3A,
+    0x7C, 0xBB, 0x41, 0x35, 0x6C, 0xB7, 0x13, 0x0F, 0x67, 0x84, 0x63, 0x3B, 0x04, 0xF0, 0x55, 0xBE,
+    0xF8, 0x6A, 0xD6, 0x41, 0x9F, 0x77, 0xD2, 0x72, 0xC4, 0xE2, 0x64, 0xEC, 0x73, 0x0B, 0xAE, 0x79,
+    0x56, 0x98, 0x80, 0xC0, 0xB8, 0x16, 0xD2, 0x5E, 0x50, 0x6B, 0xC2, 0x83, 0xA9, 0x8D, 0x34, 0x5F,
+    0xBD, 0x4A, 0x22, 0xAE, 0x1A, 0x5A, 0x52, 0x7E, 0x90, 0x62, 0xE6, 0x78, 0xF0, 0x59, 0x69, 0x83,
+    0x4C, 0x36, 0xE3, 0x81, 0x1B, 0x4B, 0xAC, 0xCB, 0x48, 0x4D, 0x4B, 0xA4, 0xC7, 0x65, 0x28, 0x00,
+    0x35, 0x45, 0x3C, 0xE2, 0x62, 0xAE, 0xCD, 0xFB, 0x70, 0xE5, 0xA1, 0x15, 0x21, 0xAE, 0xF3, 0xDB,
+    0xDB, 0xA7, 0xCE, 0x4E, 0xD4, 0xA4, 0x1E, 0xD2, 0x28, 0x50, 0x35, 0x49, 0xF1, 0x52, 0xF5, 0x14,
+    0xAC, 0x5D, 0x8A, 0x14, 0xF2, 0xA4, 0x30, 0x29, 0xC9, 0x9F, 0x7C, 0x33, 0xF5, 0x67, 0xB6, 0xA8,
+    0x67, 0xC5, 0xA4, 0xC3, 0xB2, 0xF4, 0x67, 0x74, 0x89, 0x8B, 0xE5, 0x21, 0xD2, 0x66, 0x41, 0xCD,
+    0x33, 0xA7, 0xEA, 0xB7, 0xCC, 0x56, 0x3F, 0x5B, 0xAA, 0x68, 0x75, 0x98, 0x8F, 0x8E, 0xD0, 0x84,
+    0x4F, 0x49, 0x4A, 0x3F, 0x53, 0x82, 0x2E, 0xDE, 0xC2, 0x42, 0x0E, 0x78, 0xFA, 0x0B, 0xF8, 0x78,
+    0x65, 0x4D, 0x46, 0xB1, 0x30, 0x07, 0x2B, 0xF4, 0xD5, 0x2F, 0xBF, 0xD1, 0xD0, 0x39, 0xFB, 0xB0,
+    0x2E, 0x32, 0x2C, 0x1D, 0x34, 0x92, 0x3D, 0x97, 0xBD, 0x9F, 0x67, 0x36, 0x4F, 0x06, 0x8D, 0xD5,
+    0xE7, 0x0A, 0x76, 0xC3, 0x7E, 0x5D, 0x3A, 0x77, 0xBC, 0x0D, 0x0E, 0x50, 0x48, 0x7E, 0xA0, 0x69,
+    0x6B, 0x22, 0x12, 0xA0, 0x11, 0x84, 0x7F, 0x91, 0x26, 0xA8, 0x15, 0x9E, 0x37, 0x5A, 0xC9, 0x85,
+    0x5D, 0x06, 0x86, 0xF8, 0x9F, 0xEB, 0x3F, 0x60, 0xA4, 0xCC, 0x29, 0xCC, 0x0B, 0x86, 0x1F, 0x5C,
+    0x8A, 0xE0, 0x6A, 0x29, 0x50, 0xD3, 0xB3, 0x5D, 0xF8, 0xAB, 0x2E, 0x29, 0xC7, 0x77, 0xCC, 0xEC,
+    0xDC, 0xD2, 0xF3, 0x24, 0x36, 0xBF, 0x64, 0x09, 0x74, 0x27, 0x16, 0x44, 0x8E, 0x4B, 0x90, 0xB9,
+    0xC9, 0xE0, 0xD2, 0x00, 0x82, 0x47, 0x69, 0xDB, 0x5B, 0xB1, 0x6D, 0x90, 0xB0, 0xBB, 0x81, 0x32,
+    0xC1, 0xAC, 0xB6, 0xF8, 0xCB, 0xEF, 0x6D, 0x06, 0x29, 0xFF, 0xCB, 0x61, 0xE1, 0xC7, 0x4F, 0xE1,
+    0xCE, 0x9B, 0xA2, 0x75, 0x14, 0x11, 0x24, 0x30, 0x59, 0x4C, 0xE6, 0x14, 0x13, 0x2C, 0x82, 0x70,
+    0x1A, 0x94, 0xEB, 0xFA, 0x7D, 0x08, 0xA8, 0xFA, 0x02, 0xB6, 0x4B, 0x00, 0x6B, 0xD1, 0xA4, 0x03,
+    0xEA, 0xFC, 0x07, 0xE0, 0xE3, 0x11, 0x96, 0x1C, 0x75, 0x28, 0xC1, 0x88, 0x03, 0x8F, 0x41, 0x54,
+    0xCF, 0x26, 0xEC, 0x65, 0x39, 0x44, 0x28, 0xCC, 0x64, 0x75, 0x66, 0xDC, 0x16, 0x28, 0xDB, 0xA5,
+    0xEE, 0x90, 0x4A, 0x12, 0x2B, 0x06, 0xC8, 0x3D, 0x1D, 0x60, 0x60, 0x80, 0x45, 0xB5, 0x80, 0x17,
+    0xD6, 0xB5, 0x3C, 0x81, 0x1D, 0x76, 0x59, 0xC9, 0x33, 0x6C, 0x14, 0xF2, 0x6C, 0xFC, 0x9C, 0x47,
+    0xA0, 0xF2, 0x7D, 0x59, 0x58, 0x97, 0x6C, 0x0C, 0x8F, 0x6F, 0xAF, 0xF3, 0x90, 0xE2, 0x67, 0xD0,
+    0xE9, 0x54, 0x4B, 0x2B, 0xD0, 0x5C, 0x18, 0x14, 0x6F, 0x11, 0xB2, 0x5C, 0x80, 0x74, 0xBA, 0x85,
+    0x87, 0xC2, 0xC2, 0x27, 0x0B, 0x8C, 0x5B, 0xE8, 0x59, 0xDE, 0x94, 0x36, 0x21, 0x00, 0x5F, 0x95,
+    0x19, 0x67, 0x1F, 0xE7, 0x19, 0x35, 0x9E, 0xB9, 0xDD, 0xAD, 0x5A, 0xFF, 0x70, 0x15, 0xC2, 0xD0,
+    0x04, 0xD1, 0x93, 0xF3, 0xE4, 0x73, 0x79, 0x76, 0xBF, 0xB5, 0xB9, 0x70, 0xDE, 0xF0, 0x90, 0x67,
+    0x9B, 0x31, 0xCA, 0x10, 0xC3, 0x1E, 0xBA, 0x1A, 0xB6, 0xC5, 0x37, 0x42, 0x7C, 0xA3, 0xCA, 0x50,
+    0xF6, 0xEC, 0x00, 0x19, 0xF6, 0x4B, 0x19, 0x26, 0x6D, 0xB6, 0x94, 0x61, 0x9E, 0xF2, 0x9B, 0x16,
+    0x2D, 0x34, 0x30, 0xDD, 0x6E, 0xDD, 0xE6, 0x3A, 0x9D, 0xAF, 0x6C, 0x10, 0x73, 0x65, 0xF4, 0xCA,
+    0x45, 0xE6, 0xAA, 0xBF, 0x58, 0xFB, 0xE5, 0x3D, 0x6E, 0x83, 0x9E, 0x15, 0x55, 0x17, 0x54, 0xB1,
+    0x97, 0xB5, 0x44, 0x2B, 0x0E, 0x65, 0x1D, 0x5D, 0x56, 0xAD, 0x9E, 0xFA, 0x7F, 0x11, 0x93, 0xDF,
+    0xA1, 0x3E, 0xA5, 0xC7, 0x4A, 0x40, 0x13, 0x7C, 0xBD, 0x51, 0x7C, 0x46, 0x04, 0x11, 0x6C, 0x31,
+    0x4B, 0xCB, 0x20, 0x97, 0x57, 0x4F, 0x29, 0xE6, 0xDF, 0xFA, 0xD2, 0xC5, 0xFC, 0xC9, 0x6C, 0x6E,
+    0xBE, 0x35, 0x8A, 0xE6, 0x80, 0x8F, 0x5C, 0xDC, 0x85, 0x2C, 0xE6, 0x9B, 0xC8, 0xEF, 0x54, 0xF6,
+    0xAF, 0x70, 0x22, 0x00, 0x58, 0x96, 0x30, 0x45, 0x59, 0xE4, 0x01, 0x4B, 0xE6, 0x63, 0xD6, 0xCB,
+    0xEF, 0x58, 0x6C, 0x95, 0x9B, 0xC0, 0x6A, 0x5E, 0x67, 0x85, 0x89, 0xA0, 0x46, 0x1B, 0xE7, 0x20,
+    0x7D, 0x47, 0x70, 0x53, 0xD2, 0xDE, 0x94, 0x1D, 0x95, 0xFC, 0xA2, 0x93, 0xDB, 0x92, 0x7F, 0xAB,
+    0x11, 0x1B, 0x3F, 0xC8, 0x61, 0x71, 0x26, 0x6E, 0x2A, 0x7C, 0x0F, 0x07, 0x96, 0x08, 0x75, 0xCC,
+    0xF6, 0x23, 0x7C, 0xD3, 0xEC, 0x00, 0xE6, 0x65, 0x87, 0xDE, 0xE8, 0xE6, 0x46, 0x2A, 0x0A, 0xB9,
+    0x5D, 0x97, 0x7F, 0xBC, 0xB7, 0xCA, 0x3D, 0x32, 0x01, 0xB5, 0xA5, 0x88, 0x0A, 0xF5, 0xFB, 0x07,
+    0x08, 0xC6, 0x21, 0xB7, 0x2E, 0xC0, 0x57, 0x85, 0xB8, 0x8B, 0xF9, 0x5D, 0x01, 0xEC, 0xE1, 0x46,
+    0x9A, 0xB4, 0xE6, 0x3E, 0xE6, 0x06, 0xE6, 0xFE, 0x15, 0x59, 0x57, 0xA0, 0xC4, 0xCA, 0xB5, 0x8F,
+    0x46, 0x6C, 0x5F, 0x61, 0x5E, 0x92, 0x26, 0x7F, 0x55, 0x42, 0xFF, 0x8F, 0x3B, 0x7B, 0x3A, 0xB3,
+    0x75, 0x35, 0x09, 0xD5, 0x02, 0x1A, 0x6F, 0x28, 0x66, 0xBC, 0x78, 0xB4, 0xF4, 0x5F, 0xD5, 0x92,
+    0xB6, 0xE0, 0xC9, 0xD3, 0xF1, 0x67, 0x4C, 0x15, 0x81, 0xB5, 0xE6, 0xAD, 0x01, 0x2B, 0xA6, 0x62,
+    0x09, 0x2B, 0xCA, 0x6D, 0x58, 0xF1, 0x4C, 0xA9, 0xF2, 0xDB, 0xB0, 0xD6, 0xCD, 0x23, 0xD8, 0xE2,
+    0x6B, 0x76, 0xD0, 0x33, 0x56, 0x9E, 0x6C, 0x8F, 0xFC, 0xDB, 0x27, 0x77, 0x5D, 0xE9, 0x35, 0xBE,
+    0x08, 0x21, 0xB3, 0x7A, 0x62, 0x94, 0x70, 0x64, 0x21, 0x2C, 0xE1, 0x00, 0x03, 0x21, 0x4A, 0x4B,
+    0x74, 0x80, 0xEC, 0x97, 0xEC, 0x27, 0x74, 0xC2, 0x44, 0xAC, 0x47, 0x16, 0x18, 0x54, 0x8C, 0x42,
+    0xA2, 0x59, 0x99, 0x54, 0xE7, 0x9E, 0x69, 0xA2, 0xC2, 0xD5, 0xA8, 0xEB, 0x97, 0x46, 0xDE, 0x27,
+    0x58, 0x4E, 0x3F, 0x61, 0x54, 0x9A, 0x7C, 0x4A, 0x5A, 0xE2, 0x07, 0x4A, 0x98, 0x66, 0x36, 0xA2,
+    0x61, 0xF3, 0x3C, 0x32, 0x74, 0x75, 0x9B, 0xE5, 0x66, 0xAE, 0x6E, 0xDC, 0x4C, 0x82, 0x11, 0xFB,
+    0xBE, 0x7C, 0x86, 0xF9, 0xA5, 0x4C, 0x8B, 0xE6, 0x52, 0x77, 0x3A, 0x7E, 0xF5, 0x43, 0x27, 0xF9,
+    0x55, 0x3D, 0x9C, 0xA6, 0xD1, 0x34, 0x03, 0xE3, 0xDA, 0xF5, 0xF7, 0x04, 0x85, 0x3B, 0x98, 0xA0,
+    0xB8, 0xAD, 0x00, 0x9B, 0xFE, 0x91, 0xB1, 0xD2, 0xA7, 0xAF, 0xE1, 0x60, 0xE3, 0x5F, 0x21, 0xC9,
+    0xF4, 0x8E, 0x3B, 0x8C, 0x2F, 0x78, 0xC6, 0x21, 0xAD, 0x8B, 0xC9, 0x98, 0xE2, 0xB2, 0xDC, 0x29,
+    0x9A, 0x1C, 0x5D, 0x7E, 0xED, 0xC6, 0x57, 0x38, 0xA2, 0x19, 0x34, 0x26, 0x45, 0xB9, 0x4A, 0x98,
+    0xB4, 0xEC, 0x71, 0x7B, 0x34, 0xBD, 0x35, 0x2C, 0x53, 0x76, 0x71, 0xF3, 0xE6, 0xEA, 0xFB, 0x34,
+    0xE9, 0x46, 0xAB, 0xE9, 0x20, 0xAD, 0x12, 0x73, 0x09, 0x35, 0x56, 0xCF, 0xB9, 0x02, 0x6F, 0x58,
+    0x8B, 0x43, 0xBD, 0x4F, 0x8B, 0x6F, 0x4A, 0x17, 0xA3, 0x2C, 0x34, 0xEE, 0x3F, 0xF7, 0xB4, 0x6A,
+    0xD8, 0x13, 0xA5, 0xE6, 0xFF, 0x06, 0xE5, 0x5C, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xB4,
+    0x8B, 0x31, 0x31, 0x21, 0x54, 0x50, 0x89, 0x43, 0x46, 0x42, 0xE3, 0x26, 0x8A, 0x48, 0x34, 0x29,
+    0x98, 0xCC, 0x92, 0x80, 0xA4, 0xC2, 0x45, 0x1A, 0x66, 0x86, 0x74, 0xE3, 0x22, 0x2E, 0x5C, 0x24,
+    0x72, 0xB1, 0x0D, 0x0B, 0x15, 0x94, 0x00, 0x53, 0xA5, 0x0B, 0x6F, 0x63, 0xB5, 0xE1, 0x64, 0x5C,
+    0x50, 0xEB, 0xC2, 0x9A, 0x8C, 0x33, 0xC3, 0x4C, 0x48, 0x02, 0x8A, 0x8B, 0x14, 0x99, 0x89, 0x5F,
+    0x26, 0x7F, 0x45, 0x52, 0xC0, 0x89, 0x34, 0x8E, 0xD3, 0x08, 0x13, 0x3D, 0x39, 0x58, 0x11, 0x0F,
+    0x37, 0xE7, 0x7C, 0xE7, 0x5C, 0x3C, 0xBC, 0xB7, 0x6F, 0x29, 0x8D, 0x2C, 0x2F, 0xB9, 0xEB, 0x9D,
+    0x5D, 0x5C, 0xEC, 0x2E, 0xDE, 0xC5, 0xF9, 0xBB, 0xE7, 0xFF, 0x5E, 0x63, 0x4C, 0x60, 0x6D, 0x6B,
+    0x30, 0x34, 0x34, 0x78, 0x37, 0x6E, 0xE4, 0x66, 0xF9, 0x15, 0xCD, 0x30, 0x24, 0x0D, 0x86, 0x4C,
+    0x86, 0xA2, 0xC5, 0xF0, 0x08, 0x83, 0xFF, 0x33, 0x0C, 0xC1, 0xDF, 0xCD, 0x79, 0x88, 0xDF, 0xC2,
+    0x90, 0x04, 0x1D, 0x0F, 0x57, 0x82, 0x9E, 0x87, 0xFB, 0x3E, 0x86, 0x39, 0x06, 0xBF, 0xF1, 0x16,
+    0x34, 0x84, 0x35, 0x86, 0xB8, 0x34, 0x03, 0x3F, 0x6F, 0x30, 0x64, 0xD6, 0x5A, 0x1A, 0x2A, 0x0C,
+    0x1E, 0xCD, 0x54, 0xD1, 0xC4, 0xF4, 0xCE, 0x22, 0xA7, 0xE7, 0x31, 0xC4, 0x04, 0x5C, 0x56, 0x9A,
+    0x94, 0x1F, 0xAE, 0xCD, 0x55, 0x19, 0xF8, 0xA3, 0x45, 0x7D, 0xC1, 0xDE, 0x31, 0x17, 0xEC, 0x41,
+    0x66, 0xE7, 0x34, 0xCF, 0xC2, 0xF8, 0x40, 0x4B, 0x90, 0x5B, 0x41, 0x6A, 0xEB, 0x1A, 0xA3, 0x69,
+    0x87, 0x5B, 0x84, 0xDD, 0xC7, 0xBB, 0x1D, 0xCF, 0x17, 0xD2, 0xAB, 0xAC, 0xA1, 0x2B, 0x41, 0x18,
+    0xB5, 0x26, 0x98, 0x9B, 0xB8, 0xE5, 0x9B, 0xB8, 0xC1, 0xF7, 0xCC, 0xA4, 0x33, 0x93, 0xD4, 0xFC,
+    0xAA, 0x14, 0x57, 0xFE, 0x2E, 0x4D, 0x51, 0x32, 0x44, 0x55, 0xCE, 0x57, 0xCB, 0xD0, 0xF9, 0x16,
+    0x93, 0x55, 0x0C, 0xD4, 0xF3, 0x74, 0x4D, 0x9B, 0x7B, 0xD5, 0x57, 0x4D, 0x6C, 0x9B, 0x82, 0x26,
+    0xB7, 0x79, 0x46, 0x6F, 0xB9, 0x6E, 0xB6, 0x00, 0x84, 0x57, 0x9B, 0x77, 0x79, 0x68, 0x3C, 0x90,
+    0x74, 0xF1, 0x27, 0xB5, 0x01, 0xE2, 0x00, 0x33, 0x5D, 0x08, 0xA4, 0x53, 0x46, 0x9C, 0x64, 0x4E,
+    0x00, 0x57, 0xAF, 0xF1, 0x19, 0xE6, 0x03, 0x60, 0x2A, 0x88, 0xA6, 0xFD, 0x3A, 0x9A, 0x4F, 0x05,
+    0x6F, 0x4E, 0x30, 0xA9, 0x01, 0x7D, 0x89, 0xE1, 0x01, 0xAE, 0x81, 0x40, 0x1D, 0x0A, 0x0E, 0xD1,
+    0xEA, 0x70, 0xF0, 0x0D, 0x3C, 0x62, 0xE5, 0x99, 0x6A, 0xF6, 0xC4, 0xE9, 0x7F, 0x89, 0x45, 0xC1,
+    0x17, 0x9A, 0x62, 0x41, 0x24, 0xC0, 0x25, 0xC5, 0x35, 0x93, 0xFB, 0x0F, 0x78, 0x88, 0x2D, 0xFF,
+    0xDB, 0x97, 0xE5, 0x62, 0xFC, 0x77, 0x80, 0x23, 0xA8, 0x1F, 0x37, 0xCB, 0x4F, 0xBC, 0x81, 0x95,
+    0xD6, 0xAE, 0x09, 0x99, 0x57, 0x59, 0xFA, 0x6F, 0x02, 0xC5, 0x50, 0x95, 0x71, 0x6F, 0x82, 0x05,
+    0x7F, 0x13, 0x56, 0xFE, 0x82, 0xA1, 0xF7, 0x7A, 0x43, 0xF3, 0xD2, 0xCA, 0xB4, 0xA0, 0x0E, 0xB8,
+    0x18, 0xE2, 0x1A, 0x0B, 0x64, 0x98, 0x30, 0xC1, 0x35, 0xC5, 0xDB, 0x32, 0xC8, 0x4B, 0x56, 0x3F,
+    0xEE, 0x9A, 0xCE, 0x96, 0x22, 0xC5, 0xF3, 0xFC, 0x8E, 0x09, 0x89, 0x5D, 0xB7, 0x08, 0x87, 0x3D,
+    0x06, 0xBC, 0x80, 0xF6, 0x8D, 0x2C, 0x30, 0x7A, 0x4E, 0x80, 0xDD, 0xFE, 0xBE, 0x7B, 0x1B, 0xA6,
+    0x78, 0xC8, 0xB0, 0x33, 0x8E, 0x01, 0x4F, 0xE5, 0xAD, 0xAC, 0x19, 0xDF, 0x92, 0x38, 0xC4, 0x1F,
+    0x58, 0xA6, 0x3A, 0x64, 0x23, 0xA9, 0x09, 0xF0, 0xB8, 0x26, 0xB6, 0x7D, 0x49, 0xA6, 0xC0, 0x9B,
+    0xD3, 0xDA, 0x4D, 0x86, 0x4B, 0x51, 0xAE, 0x5C, 0x40, 0x60, 0xFC, 0x83, 0x80, 0xBD, 0x69, 0xE2,
+    0xCE, 0x6F, 0x59, 0x7F, 0xD2, 0xDB, 0x2A, 0x16, 0x36, 0xEF, 0x9A, 0xBC, 0x6F, 0x1F, 0x24, 0x07,
+    0x71, 0x22, 0xA6, 0xA4, 0x49, 0x7F, 0xC2, 0x9F, 0x79, 0x93, 0x65, 0x96, 0xC4, 0xB7, 0x05, 0xB1,
+    0x9F, 0x3D, 0x69, 0xD4, 0xF6, 0xDE, 0xC1, 0x52, 0x80, 0x6C, 0xF1, 0x34, 0x7F, 0x4E, 0x50, 0x2F,
+    0xC2, 0x19, 0xAD, 0x44, 0x12, 0x20, 0x22, 0xF6, 0xB3, 0x4F, 0x88, 0xDA, 0xE7, 0x70, 0xB5, 0x87,
+    0xAE, 0x0F, 0xCC, 0xA6, 0xAF, 0x13, 0x23, 0xDB, 0x8C, 0x1D, 0x34, 0x63, 0x30, 0x5E, 0xFC, 0xEE,
+    0x30, 0x3E, 0xC7, 0x4C, 0x6D, 0xBF, 0x34, 0x77, 0xA0, 0xAD, 0x23, 0xE0, 0xD5, 0x65, 0x00, 0xF6,
+    0xA1, 0xE8, 0xD5, 0x6C, 0x3E, 0x35, 0x07, 0x5B, 0xF9, 0x3A, 0xD5, 0x95, 0xEC, 0x42, 0x77, 0x25,
+    0xBC, 0x52, 0x5E, 0x49, 0x2F, 0xB4, 0x37, 0x42, 0x7C, 0xA5, 0xBE, 0x92, 0x5F, 0xE9, 0xAF, 0x0C,
+    0x50, 0x0E, 0x28, 0x0B, 0x94, 0x07, 0x4A, 0xEC, 0xC7, 0x0E, 0xE9, 0x8A, 0xE5, 0x12, 0x5E, 0x28,
+    0x33, 0x1C, 0x37, 0x94, 0x1D, 0x8E, 0x1F, 0x8E, 0x21, 0x67, 0x18, 0x79, 0xB2, 0x1D, 0x69, 0xCE,
+    0xD6, 0x87, 0x31, 0xF6, 0x1F, 0x01, 0x24, 0x8B, 0x29, 0x81, 0xA0, 0x79, 0x6E, 0xCD, 0x52, 0x83,
+    0x35, 0xC2, 0x1B, 0x61, 0x0E, 0xB8, 0x63, 0xC0, 0x1E, 0x03, 0xFE, 0x38, 0x89, 0x12, 0xAD, 0x7C,
+    0x48, 0x72, 0xC0, 0x9B, 0x95, 0xAB, 0x68, 0xF9, 0x51, 0xAE, 0x6E, 0x1A, 0xE1, 0x95, 0x32, 0x4B,
+    0xB8, 0x35, 0x2E, 0x8E, 0xED, 0xDC, 0xDB, 0x83, 0x42, 0x04, 0xBF, 0xBC, 0x79, 0x81, 0xBF, 0x0E,
+    0x42, 0xD1, 0xAA, 0x9D, 0x12, 0x6F, 0x02, 0x7A, 0x6C, 0xED, 0xCF, 0x85, 0x5D, 0x96, 0x31, 0xAC,
+    0xEA, 0xDF, 0x1A, 0xE4, 0xF5, 0x95, 0x98, 0x5B, 0xA6, 0x7A, 0x25, 0x90, 0x13, 0xA7, 0xA2, 0x39,
+    0xCC, 0x34, 0x91, 0x8E, 0x6D, 0x37, 0xA1, 0xE6, 0xEB, 0xD0, 0x63, 0x08, 0x74, 0xE8, 0x30, 0xB0,
+    0xB1, 0x0C, 0x61, 0x27, 0xF9, 0x03, 0x3C, 0x43, 0x04, 0x7B, 0xC9, 0x3F, 0x6C, 0x99, 0x88, 0xAF,
+    0xC9, 0x0C, 0x30, 0x31, 0x2D, 0x0A, 0x58, 0x4B, 0x96, 0x0A, 0xC2, 0xDA, 0x1F, 0xF0, 0xF2, 0x88,
+    0x26, 0x22, 0xB3, 0xC9, 0x52, 0x66, 0xCD, 0x36, 0xFD, 0x6B, 0x97, 0xC0, 0xEC, 0xE0, 0x1E, 0x0C,
+    0xCA, 0xA9, 0xFD, 0x97, 0xBF, 0x0F, 0xF0, 0xE1, 0x75, 0x78, 0xF6, 0x55, 0xD0, 0xB6, 0x12, 0x91,
+    0xAD, 0x62, 0xC1, 0xFD, 0x79, 0xA1, 0x84, 0x68, 0x0F, 0xC8, 0xEF, 0xD6, 0x1F, 0xF7, 0x78, 0xDC,
+    0xF2, 0x20, 0xC6, 0x5D, 0xAD, 0xBB, 0x98, 0x77, 0xB5, 0xEF, 0x6A, 0xE0, 0xD5, 0xC2, 0xAB, 0x89,
+    0x57, 0x1B, 0xAF, 0x46, 0x5E, 0xAD, 0xBC, 0x9A, 0x79, 0xB5, 0xF3, 0x6A, 0xE8, 0xD5, 0xD2, 0xAB,
+    0xA9, 0x57, 0x5B, 0xAF, 0xC6, 0x5E, 0xAD, 0xBD, 0x33, 0xF7, 0xCE, 0xDF, 0xFA, 0x15, 0xB0, 0x83,
+    0x7C, 0x7F, 0x4B, 0x4A, 0x82, 0x64, 0xC6, 0x96, 0xBF, 0x7A, 0x76, 0xE4, 0x80, 0xBE, 0x04, 0x75,
+    0xF1, 0xB7, 0xCA, 0xB8, 0x6B, 0x0C, 0x72, 0x27, 0xF8, 0x88, 0xF2, 0x81, 0xF5, 0x80, 0x39, 0xFF,
+    0x17, 0x3D, 0xAF, 0x1E, 0xFE, 0x73, 0xD2, 0x24, 0x73, 0x7E, 0x55, 0xD8, 0x32, 0x46, 0xEC, 0x61,
+    0x75, 0xEB, 0x1E, 0x56, 0xB2, 0xE6, 0x61, 0x89, 0x7B, 0xB5, 0xEE, 0x61, 0xB1, 0xF1, 0x2A, 0xCA,
+    0xE8, 0xB0, 0x87, 0x55, 0xAD, 0x7B, 0xB8, 0xFE, 0x18, 0xF1, 0xB5, 0xEB, 0x11, 0x1F, 0x01, 0x4C,
+    0x34, 0x03, 0x33, 0x18, 0x23, 0x62, 0x41, 0x91, 0x83, 0x19, 0x89, 0x11, 0x57, 0x54, 0x10, 0x4B,
+    0xC4, 0x0E, 0xBD, 0x60, 0xC4, 0x85, 0x35, 0x60, 0x06, 0xCF, 0xAC, 0x43, 0x3F, 0xD5, 0x70, 0xF4,
+    0x1E, 0x7E, 0x28, 0xB4, 0x70, 0x50, 0xA3, 0x76, 0xAA, 0xE8, 0xDC, 0x20, 0x0A, 0x2B, 0x91, 0xB5,
+    0x9A, 0x2E, 0x75, 0xDA, 0x1D, 0x88, 0x19, 0x07, 0x49, 0x04, 0x03, 0x3B, 0x3E, 0x95, 0x78, 0xC5,
+    0xF4, 0x72, 0x22, 0xC9, 0xAE, 0x80, 0xC9, 0xAE, 0x33, 0x53, 0x1E, 0x08, 0x85, 0xAC, 0xDE, 0x26,
+    0x38, 0x89, 0x09, 0x59, 0x40, 0x4D, 0x31, 0x0A, 0x34, 0x0F, 0x9B, 0x42, 0x82, 0x0D, 0xD2, 0x5F,
+    0xE4, 0x04, 0x82, 0xA5, 0x37, 0x13, 0xE8, 0x69, 0x4D, 0xAC, 0xC8, 0xFE, 0x95, 0x7C, 0xCB, 0xCC,
+    0x1E, 0xD0, 0xB3, 0xDF, 0x7B, 0xBC, 0x09, 0xD9, 0xDE, 0x60, 0x42, 0x7C, 0x17, 0xD7, 0x21, 0xD8,
+    0xD1, 0x68, 0x67, 0x8C, 0xEB, 0xFA, 0x43, 0x71, 0xDD, 0xC9, 0xA6, 0x77, 0x69, 0xC8, 0x41, 0xAA,
+    0x83, 0xDA, 0xF8, 0x07, 0xBB, 0x04, 0x3D, 0xE2, 0x98, 0xAC, 0xDB, 0xE0, 0x9D, 0x1E, 0x17, 0xF9,
+    0x8D, 0xD9, 0x13, 0xA3, 0x2A, 0xD6, 0x34, 0xEA, 0xA6, 0x83, 0xC6, 0x42, 0x1B, 0xBE, 0x4E, 0x34,
+    0x17, 0x0C, 0x6C, 0x60, 0xD8, 0x3A, 0x27, 0x02, 0x17, 0x0D, 0xF8, 0x36, 0x38, 0x53, 0xC7, 0xC4,
+    0x8A, 0x93, 0x4D, 0x52, 0x13, 0xCA, 0x04, 0x6F, 0x0A, 0x4C, 0x2B, 0xF2, 0xE3, 0x42, 0x6A, 0xFD,
+    0x6D, 0x71, 0x5D, 0x54, 0xAA, 0x48, 0x5C, 0xD1, 0x1C, 0x27, 0xA5, 0xD9, 0x34, 0x1B, 0xF6, 0xD8,
+    0x04, 0xD0, 0x87, 0xE3, 0xA5, 0x7A, 0x1B, 0x89, 0x05, 0xA6, 0xD2, 0x62, 0xE2, 0xDE, 0xB1, 0x7F,
+    0x07, 0xA0, 0x1B, 0x10, 0x54, 0x3D, 0x3C, 0x4F, 0x5C, 0x3C, 0xF5, 0xF1, 0xD6, 0x3C, 0xA5, 0x13,
+    0xCC, 0x44, 0x75, 0x69, 0xEB, 0x04, 0x2E, 0xED, 0x83, 0x89, 0x4B, 0x2B, 0x1E, 0xD3, 0x11, 0x2E,
+    0xED, 0xC2, 0x28, 0xDF, 0x84, 0x71, 0xE0, 0x9C, 0x01, 0xEB, 0x0C, 0x78, 0x67, 0xC0, 0x3C, 0xE1,
+    0x9E, 0xB0, 0x4F, 0xF8, 0x27, 0x0C, 0x14, 0x0E, 0x7E, 0xAA, 0x4B, 0xBB, 0x7D, 0x94, 0x4B, 0x2B,
+    0xE1, 0xB5, 0xC6, 0xD7, 0x1A, 0x60, 0x6B, 0x84, 0x2D, 0x21, 0xB6, 0x8B, 0xB1, 0xA7, 0x41, 0x36,
+    0x4C, 0x4C, 0x23, 0x4E, 0xD4, 0x80, 0x54, 0x4E, 0x40, 0x1F, 0xE4, 0xF8, 0x83, 0xE0, 0x62, 0xA2,
+    0xAA, 0x6B, 0x43, 0xF1, 0x0C, 0x53, 0xE6, 0x0F, 0xD6, 0x43, 0x90, 0x6E, 0x53, 0x08, 0xD2, 0x4C,
+    0x23, 0x0A, 0x72, 0x91, 0xD8, 0xA6, 0x32, 0x25, 0xC8, 0xB5, 0xE2, 0xB9, 0x76, 0x41, 0x17, 0x7E,
+    0x1A, 0x43, 0x83, 0x21, 0x41, 0x3A, 0x88, 0x59, 0xC6, 0x1F, 0xCF, 0xE4, 0xE5, 0x4C, 0xB8, 0x1E,
+    0x83, 0xCF, 0xEC, 0xC9, 0x11, 0x82, 0x58, 0x09, 0x41, 0xDE, 0x1F, 0x09, 0xCF, 0x0C, 0x13, 0xE5,
+    0x9D, 0x09, 0x00, 0xB2, 0xA2, 0xFC, 0xAE, 0x97, 0x94, 0x1C, 0x92, 0x39, 0x97, 0x20, 0x6B, 0x84,
+    0xB8, 0x33, 0x30, 0x90, 0xFB, 0xE7, 0xE0, 0x77, 0x45, 0xF6, 0x11, 0x0F, 0xD9, 0xDB, 0xC3, 0x59,
+    0xF8, 0x5A, 0x95, 0xC4, 0x94, 0x85, 0xAC, 0xD5, 0x42, 0x84, 0xAD, 0x10, 0xF1, 0xAA, 0x64, 0xF1,
+    0xC8, 0x1A, 0x82, 0x47, 0x16, 0x37, 0x01, 0xF4, 0xE6, 0x1C, 0xC2, 0xE7, 0xAB, 0x1A, 0x10, 0xF8,
+    0x54, 0x19, 0x24, 0xF2, 0xCA, 0x4C, 0x87, 0x9F, 0x03, 0xEA, 0x54, 0x9E, 0x8C, 0x34, 0xF6, 0xFB,
+    0x01, 0xBB, 0x74, 0xA4, 0x7C, 0x19, 0xE1, 0xA4, 0x84, 0xE8, 0x67, 0xE2, 0xF3, 0x15, 0xE3, 0xC0,
+    0x09, 0xAE, 0x4C, 0x14, 0x08, 0x11, 0x6B, 0xB7, 0xC6, 0xA7, 0x21, 0x04, 0xBB, 0x56, 0x28, 0x60,
+    0x1A, 0x96, 0x12, 0x43, 0x7C, 0x06, 0x29, 0x1E, 0x7E, 0x5D, 0x42, 0x71, 0x2B, 0x39, 0xB1, 0x61,
+    0x43, 0x76, 0xF8, 0x14, 0xB0, 0x3F, 0x22, 0x57, 0x02, 0x2A, 0x0A, 0x09, 0xCC, 0xF0, 0x83, 0xC2,
+    0x8C, 0xCB, 0x91, 0x50, 0xD2, 0xA8, 0xDB, 0x9C, 0x6E, 0xBE, 0x6B, 0xBA, 0x47, 0x73, 0x3C, 0xDE,
+    0xCA, 0x60, 0x16, 0xE6, 0xC8, 0xAF, 0xD3, 0xB0, 0xFA, 0xBD, 0x7C, 0x45, 0xF9, 0xAF, 0x24, 0x42,
+    0xE2, 0xD9, 0x46, 0xB4, 0x4F, 0xAB, 0x14, 0x9C, 0x1E, 0xA6, 0xCA, 0xD7, 0x6B, 0x2B, 0x02, 0x2C,
+    0xA0, 0xF9, 0xEA, 0x3F, 0x89, 0x75, 0x0F, 0xF3, 0x35, 0xD6, 0x7E, 0x59, 0x86, 0xD7, 0x65, 0x58,
+    0xF1, 0xBC, 0xB4, 0x3C, 0x23, 0x15, 0x82, 0xD3, 0xAF, 0x12, 0xFC, 0xBB, 0x7A, 0x13, 0x3A, 0x05,
+    0x90, 0xA8, 0x42, 0x30, 0x45, 0xAA, 0x64, 0xEB, 0x94, 0x18, 0xC1, 0x2C, 0x10, 0x00, 0xBD, 0x35,
+    0xFB, 0x40, 0x9E, 0x5C, 0x19, 0xAB, 0x2F, 0x97, 0x27, 0x00, 0x94, 0xEB, 0x3D, 0xFC, 0x23, 0x49,
+    0x9C, 0x52, 0x3C, 0x3A, 0xFC, 0x80, 0x26, 0x95, 0xD3, 0x43, 0x78, 0xD9, 0xA0, 0x3F, 0xEC, 0xD9,
+    0xC1, 0xBB, 0x63, 0xE7, 0x47, 0x4A, 0x5B, 0xFD, 0x24, 0x89, 0x2B, 0x37, 0x56, 0x72, 0x24, 0xEC,
+    0xE3, 0x49, 0x4E, 0x27, 0x6A, 0xD5, 0xD3, 0xD3, 0xDC, 0xCB, 0xF4, 0xA6, 0x51, 0xB9, 0x64, 0x6F,
+    0x0F, 0x1E, 0x1F, 0xFB, 0x7B, 0x63, 0x32, 0x57, 0x12, 0xBA, 0xA5, 0x3A, 0x51, 0x9A, 0x6E, 0x82,
+    0xDF, 0x87, 0x1F, 0x64, 0x54, 0x19, 0x99, 0x5D, 0xFB, 0xDF, 0xF8, 0xA1, 0x45, 0xD3, 0xE3, 0x87,
+    0xBF, 0x5E, 0x2C, 0x5D, 0x5D, 0x8B, 0x1E, 0xE2, 0x77, 0x84, 0x1F, 0x21, 0x5D, 0x5C, 0xF6, 0x28,
+    0x0E, 0x5D, 0x81, 0x27, 0xF1, 0x8C, 0xF1, 0xF6, 0xEF, 0x2C, 0xCB, 0x60, 0x69, 0xBB, 0x54, 0x42,
+    0xA2, 0x75, 0x92, 0x7A, 0x92, 0xBB, 0x14, 0x57, 0x2E, 0x67, 0xAF, 0x31, 0x7B, 0x85, 0xDD, 0xB7,
+    0x22, 0x46, 0xAE, 0xFD, 0x0A, 0xF2, 0x52, 0xEF, 0x72, 0x1A, 0x70, 0xA8, 0xE9, 0x4A, 0x40, 0x91,
+    0x10, 0x91, 0x17, 0x17, 0x22, 0x01, 0xCC, 0x69, 0x9D, 0x9E, 0x11, 0xE6, 0xEC, 0x5A, 0xC3, 0x7F,
+    0xA4, 0xB9, 0xE9, 0x8F, 0x34, 0x37, 0xFD, 0x9A, 0xE2, 0x4A, 0x73, 0xD3, 0x1F, 0xE9, 0xCA, 0xB9,
+    0x9E, 0x1C, 0xB9, 0x1E, 0x64, 0xA2, 0xB2, 0xF7, 0x72, 0xBE, 0xB1, 0x39, 0x09, 0x4A, 0xDC, 0x3B,
+    0x4D, 0xF9, 0xF9, 0x18, 0xFA, 0x9A, 0xDD, 0xDF, 0xDF, 0xB7, 0x77, 0xA5, 0xDA, 0x88, 0xDC, 0xD4,
+    0x6F, 0x0E, 0x37, 0x6E, 0x7C, 0x6D, 0xB8, 0x7E, 0x02, 0x18, 0xBA, 0xCA, 0xA6, 0x66, 0x8D, 0x4D,
+    0x31, 0xD6, 0x4D, 0x2C, 0x51, 0x85, 0x63, 0x13, 0xD6, 0x48, 0xCE, 0xDA, 0xA7, 0x08, 0x11, 0x34,
+    0x25, 0xFC, 0xE9, 0x61, 0x87, 0x99, 0xB5, 0xE0, 0x55, 0xEE, 0xD9, 0x7A, 0xC9, 0xA6, 0x61, 0xC2,
+    0xA6, 0xEE, 0x0B, 0x62, 0x93, 0xF9, 0x26, 0x60, 0x2E, 0x5F, 0x22, 0xD0, 0xE6, 0xF7, 0xCC, 0x0B,
+    0x11, 0x01, 0xF0, 0x92, 0x07, 0xAF, 0xFE, 0x99, 0xC9, 0xD2, 0x34, 0x4B, 0x0E, 0x2E, 0x39, 0xB7,
+    0x5C, 0x82, 0xE3, 0xD2, 0x93, 0x90, 0x6A, 0x52, 0x38, 0xE9, 0x5C, 0xB2, 0x63, 0xE4, 0xC6, 0x92,
+    0x0B, 0x4B, 0xEA, 0x2F, 0xA9, 0x2E, 0xB3, 0x3B, 0x4A, 0x2F, 0x29, 0x0C, 0x40, 0x43, 0x9B, 0x5F,
+    0x4E, 0xEC, 0x4F, 0xDB, 0x9D, 0xD8, 0xCE, 0x7E, 0x1F, 0xC5, 0xD5, 0x65, 0x84, 0xC1, 0xF4, 0xDB,
+    0xB6, 0xCA, 0x40, 0xF0, 0x2F, 0x87, 0x06, 0x03, 0x90, 0x56, 0x41, 0x5C, 0x88, 0x62, 0x83, 0x04,
+    0x75, 0xFA, 0x33, 0x97, 0x1F, 0x06, 0x32, 0xE8, 0xBE, 0x42, 0xB4, 0x60, 0xAA, 0x97, 0xE2, 0xE9,
+    0x84, 0x1C, 0x01, 0x45, 0x7C, 0x59, 0x26, 0xEC, 0x9E, 0x0E, 0x72, 0x54, 0x76, 0x41, 0xCB, 0xE3,
+    0xC6, 0x8D, 0xEB, 0xAA, 0x68, 0x17, 0x66, 0xB7, 0xD7, 0x3C, 0x3F, 0x61, 0x13, 0x4A, 0x7E, 0xB6,
+    0x75, 0xF9, 0x59, 0xC9, 0xCC, 0x96, 0xF8, 0xCE, 0xF9, 0x9B, 0xE0, 0xCD, 0x6E, 0xE7, 0x24, 0x0C,
+    0x49, 0x07, 0x31, 0x08, 0x4A, 0xEF, 0x70, 0xA6, 0xAC, 0x58, 0xC9, 0x94, 0x3D, 0x1D, 0x78, 0xDF,
+    0x34, 0xCF, 0xEF, 0x98, 0x5B, 0xD9, 0xD7, 0xE6, 0x89, 0x6D, 0x48, 0x1C, 0x46, 0x01, 0xF8, 0x65,
+    0x09, 0xF0, 0x94, 0x08, 0xF9, 0x85, 0x5C, 0xFD, 0x0F, 0xB8, 0x12, 0xA2, 0x38, 0xEA, 0xF1, 0xEE,
+    0xE3, 0x6B, 0x22, 0xE7, 0x22, 0xA0, 0x9C, 0x4B, 0xA4, 0xB7, 0x46, 0x1D, 0x7F, 0xAF, 0xE6, 0x0E,
+    0xE9, 0x21, 0x5E, 0x0B, 0x92, 0x8B, 0x67, 0x6C, 0x81, 0x86, 0x05, 0x0A, 0x0B, 0x5E, 0x02, 0xBE,
+    0x10, 0x0A, 0xB4, 0x62, 0x72, 0xCD, 0x59, 0xF6, 0x49, 0xF4, 0x69, 0x62, 0xAF, 0xE3, 0x57, 0x66,
+    0xA8, 0xE0, 0x2E, 0xF0, 0x6D, 0xBF, 0x67, 0x8A, 0x41, 0x92, 0x94, 0x92, 0xCA, 0x9B, 0xBB, 0x9C,
+    0x65, 0x34, 0x5F, 0x26, 0x9A, 0xD6, 0xAD, 0xF9, 0x53, 0x40, 0xCD, 0x2F, 0x44, 0x2C, 0xBE, 0xCD,
+    0xEE, 0x12, 0xE1, 0xF2, 0x8A, 0x14, 0xAD, 0x67, 0xA2, 0x3C, 0xE9, 0x9D, 0x00, 0x4F, 0xD2, 0x2D,
+    0x52, 0x00, 0x6A, 0x04, 0x35, 0x80, 0x38, 0x88, 0x1B, 0xEB, 0x2D, 0x04, 0x5A, 0xAD, 0xB1, 0x8A,
+    0x93, 0x55, 0x0A, 0xA6, 0x4C, 0x0F, 0x46, 0xB6, 0x52, 0x7C, 0xAD, 0xA2, 0x6C, 0x15, 0xE1, 0x41,
+    0x46, 0xE9, 0xC8, 0x69, 0x84, 0x42, 0x34, 0x37, 0x88, 0x44, 0x73, 0x82, 0x4E, 0x59, 0x2D, 0xA4,
+    0x92, 0xDC, 0xCF, 0x12, 0xAC, 0x4A, 0xC1, 0x22, 0x82, 0x30, 0x58, 0x4C, 0x13, 0x06, 0x8B, 0xC9,
+    0xA2, 0xE9, 0x2A, 0x57, 0x91, 0x55, 0x5B, 0xA4, 0xEC, 0x19, 0x8B, 0x43, 0x2E, 0x53, 0xE6, 0x92,
+    0x63, 0xC2, 0x6A, 0xF6, 0x21, 0x35, 0xE9, 0x75, 0x80, 0xE1, 0x4B, 0xD0, 0x93, 0x52, 0xE1, 0xA9,
+    0xCA, 0xE5, 0x35, 0x3B, 0xAA, 0x01, 0x40, 0x99, 0x42, 0xD6, 0x9A, 0xF8, 0xB2, 0x3B, 0x67, 0x6C,
+    0x22, 0x16, 0x3E, 0x66, 0x0D, 0x31, 0x88, 0x80, 0x0F, 0xC1, 0x9D, 0x08, 0xA6, 0x2D, 0x9E, 0x9A,
+    0x36, 0x14, 0xC1, 0x12, 0xF0, 0x6B, 0x34, 0x6A, 0x05, 0xE0, 0xAF, 0xA0, 0xED, 0x07, 0x77, 0x25,
+    0x70, 0x98, 0xDC, 0xB7, 0x5F, 0x66, 0x62, 0xDB, 0x57, 0xD8, 0xBD, 0xED, 0x98, 0x5A, 0x5E, 0x0E,
+    0xBF, 0x59, 0x05, 0x36, 0x9A, 0x38, 0x52, 0xC9, 0xC4, 0x79, 0x02, 0xFE, 0x15, 0xB0, 0xAE, 0x9C,
+    0x8B, 0xFB, 0x8E, 0x71, 0xCD, 0x17, 0x24, 0x11, 0x39, 0xDA, 0x2F, 0xF8, 0x13, 0x0F, 0xD8, 0xDB,
+    0xF6, 0xB9, 0x01, 0x63, 0xDA, 0x81, 0x21, 0x56, 0x43, 0xAF, 0x26, 0x9D, 0x2F, 0x53, 0x85, 0x2B,
+    0xF5, 0xE5, 0x69, 0x65, 0x79, 0x52, 0x95, 0xB3, 0x4B, 0xE2, 0x4B, 0x96, 0x52, 0x18, 0x10, 0x4C,
+    0xAF, 0xDD, 0xB2, 0x84, 0xA0, 0x58, 0x4C, 0x9D, 0xC2, 0xE6, 0xB1, 0x2F, 0x7C, 0xDC, 0xAB, 0xB4,
+    0xDF, 0x62, 0x3E, 0xC6, 0x62, 0x05, 0x90, 0xAD, 0xBA, 0x49, 0xEA, 0xCF, 0x97, 0xF8, 0x85, 0xBB,
+    0x38, 0x38, 0xE9, 0xC7, 0x29, 0x3F, 0x49, 0xF8, 0xAD, 0xA6, 0xFB, 0x98, 0xC9, 0x86, 0x79, 0x3C,
+    0x5D, 0xD5, 0xC1, 0xA8, 0x2E, 0x70, 0x89, 0xC6, 0x55, 0x0D, 0xF5, 0x06, 0x26, 0xA4, 0xE3, 0xAA,
+    0x96, 0x0B, 0xBF, 0xBF, 0x18, 0x41, 0x1E, 0x5C, 0x94, 0x06, 0x78, 0xBD, 0x7E, 0x54, 0x1C, 0xDD,
+    0xEA, 0x9C, 0xA3, 0x0F, 0x37, 0x8C, 0x0D, 0x11, 0xAC, 0x92, 0x58, 0x78, 0x59, 0x2B, 0x21, 0x51,
+    0x45, 0x2B, 0x19, 0x3A, 0xAC, 0x28, 0xE5, 0xF5, 0x5C, 0xC9, 0x55, 0x0D, 0x75, 0x5F, 0xA8, 0x23,
+    0x3A, 0x75, 0x90, 0xE9, 0xE8, 0x8D, 0x99, 0xB2, 0xA3, 0x93, 0x51, 0x4A, 0x18, 0x41, 0x2F, 0xC2,
+    0x13, 0x74, 0x05, 0xC6, 0xF0, 0x17, 0xB2, 0x42, 0xA2, 0x47, 0x1F, 0x0A, 0x53, 0x06, 0x65, 0xCE,
+    0x3C, 0xD2, 0xFE, 0x2F, 0xA1, 0x72, 0x32, 0x0B, 0x16, 0xC2, 0x22, 0x09, 0x8C, 0x89, 0x49, 0x22,
+    0x59, 0xA5, 0x24, 0x7E, 0x09, 0x2C, 0xF0, 0x4D, 0x8B, 0xBB, 0xFC, 0x4F, 0xCE, 0xE4, 0xF2, 0x4A,
+    0x8E, 0xE8, 0x9E, 0x57, 0xB2, 0x57, 0x95, 0x1B, 0x56, 0x97, 0x26, 0x29, 0x5D, 0xF8, 0x69, 0x12,
+    0x5D, 0xD7, 0x57, 0xF5, 0xFF, 0xB7, 0x74, 0x7C, 0xD7, 0x4C, 0xD3, 0x74, 0x9F, 0x23, 0xC6, 0x90,
+    0x6B, 0x46, 0xE8, 0x16, 0xA4, 0x16, 0x78, 0x15, 0x4A, 0xED, 0x3B, 0x46, 0x4E, 0xFA, 0x2A, 0xF8,
+    0xD3, 0x81, 0x50, 0xBC, 0x4A, 0x3A, 0x64, 0xB9, 0xE7, 0xCC, 0xC6, 0xE0, 0x7F, 0x19, 0x53, 0x5A,
+    0x1F, 0x1C, 0x4E, 0x2E, 0x12, 0x44, 0xF4, 0xA8, 0xE5, 0xCF, 0x98, 0x7B, 0xF1, 0x8C, 0xB9, 0x89,
+    0x1E, 0x1A, 0x26, 0xCE, 0x80, 0x17, 0x5A, 0xD1, 0xCE, 0xEF, 0x33, 0x0F, 0xA2, 0xB5, 0x3E, 0x9C,
+    0x33, 0xD3, 0x1E, 0xBC, 0x09, 0x8A, 0x3F, 0xD2, 0x4C, 0xE5, 0x5A, 0x2E, 0x32, 0x65, 0xFE, 0xCF,
+    0x2E, 0x58, 0xC0, 0x6C, 0x9F, 0x00, 0xCC, 0xDE, 0x3B, 0xCB, 0xB5, 0x26, 0xB2, 0x21, 0xB0, 0x4B,
+    0x2D, 0x67, 0xBE, 0x06, 0x2F, 0x4C, 0xA9, 0xDA, 0x52, 0x31, 0xA6, 0x9F, 0x49, 0x69, 0x1C, 0x56,
+    0x1D, 0x47, 0x29, 0x8D, 0x76, 0x93, 0xD2, 0x90, 0x0C, 0x4B, 0x8B, 0x04, 0x4A, 0xC3, 0xAF, 0xA2,
+    0xB0, 0x9D, 0x24, 0x31, 0xAA, 0xF9, 0x55, 0x69, 0x2D, 0x95, 0x0C, 0x57, 0xC8, 0xE0, 0x3E, 0x40,
+    0x24, 0x5D, 0x6A, 0x20, 0xC1, 0xD5, 0x28, 0x8E, 0xF2, 0x49, 0x25, 0x6E, 0xEF, 0x97, 0xD2, 0x0A,
+    0x59, 0x6D, 0x70, 0xCA, 0x87, 0x23, 0x9C, 0xF2, 0xB9, 0x2C, 0xE5, 0x50, 0x43, 0x38, 0xA1, 0xB2,
+    0x88, 0xA0, 0x8B, 0xD4, 0xDC, 0x54, 0x99, 0xC6, 0x8F, 0x64, 0xB3, 0x39, 0xB2, 0x21, 0x3D, 0xAF,
+    0x51, 0xCD, 0x09, 0xA0, 0xDA, 0xF4, 0xEB, 0x45, 0x33, 0x56, 0xC6, 0x4C, 0xBF, 0x6C, 0x0A, 0xF5,
+    0x31, 0x73, 0x50, 0x9A, 0xD1, 0x0F, 0x3F, 0xBF, 0x2F, 0x65, 0x33, 0xFF, 0x53, 0x22, 0x9A, 0x4D,
+    0xC4, 0x4B, 0xD6, 0x88, 0x57, 0x4C, 0xE2, 0x6E, 0x9D, 0xCA, 0xB8, 0xEC, 0xC9, 0x40, 0x86, 0x9D,
+    0x23, 0x55, 0x2E, 0x17, 0x6A, 0x02, 0xCB, 0xBF, 0x23, 0x8D, 0xB9, 0xAC, 0x57, 0x38, 0xBD, 0x74,
+    0x91, 0x7E, 0x2E, 0x1B, 0x35, 0x7B, 0x4C, 0xEF, 0x9E, 0xE9, 0xFD, 0x72, 0x87, 0x54, 0x20, 0xE7,
+    0xFF, 0xCA, 0x00, 0xFD, 0x31, 0x11, 0x3B, 0x81, 0xE6, 0xEC, 0x13, 0xA6, 0x37, 0x49, 0xE2, 0x9F,
+    0x91, 0x24, 0x52, 0xA8, 0xFE, 0xDE, 0xDC, 0x64, 0x6F, 0x51, 0x98, 0xFC, 0x6A, 0x6D, 0x8A, 0x88,
+    0x40, 0xDB, 0x7A, 0xAA, 0x25, 0x91, 0xE6, 0x58, 0x46, 0xFC, 0x2D, 0x53, 0x46, 0x7A, 0x6F, 0xA2,
+    0xD9, 0x17, 0x48, 0x99, 0xCF, 0xB1, 0x46, 0xFD, 0x3C, 0x6C, 0xE3, 0x59, 0xD8, 0xA6, 0x4D, 0x44,
+    0x3F, 0x71, 0x13, 0xD7, 0xC7, 0x46, 0x19, 0x0F, 0x7E, 0x34, 0xBF, 0x2A, 0x58, 0x0C, 0x30, 0x5A,
+    0x48, 0x9D, 0xE1, 0x99, 0x44, 0xEA, 0xA7, 0xF0, 0x04, 0x60, 0x7F, 0xCF, 0xFE, 0x32, 0x6B, 0xF4,
+    0xB5, 0xBB, 0x34, 0x17, 0xA1, 0x1C, 0xF5, 0x47, 0xAC, 0xAC, 0x35, 0x81, 0x00, 0xCA, 0x7F, 0x64,
+    0x38, 0x5A, 0x42, 0x3B, 0x3E, 0x4D, 0x11, 0xB1, 0x2D, 0x20, 0xC0, 0xFF, 0x4A, 0xA9, 0x37, 0x95,
+    0xAD, 0x23, 0xD3, 0x0E, 0xCB, 0xDC, 0xA0, 0x0B, 0x6C, 0xA6, 0xE5, 0x15, 0x71, 0x62, 0x19, 0x43,
+    0xB5, 0xF0, 0x28, 0x6C, 0xE3, 0xEB, 0x99, 0xF5, 0x30, 0x8C, 0xC2, 0x02, 0x4E, 0x3B, 0x25, 0x48,
+    0x63, 0x0C, 0x5A, 0xA7, 0x92, 0xA0, 0x89, 0x53, 0xBA, 0x46, 0xA3, 0xFC, 0x4B, 0x7C, 0xF3, 0x37,
+    0x04, 0x1A, 0xA7, 0x1C, 0xCD, 0x2F, 0xE8, 0x4D, 0x3B, 0xC8, 0x6A, 0x5B, 0xB1, 0xA5, 0x5E, 0x4B,
+    0x98, 0xDC, 0x43, 0x4E, 0x9C, 0x9C, 0x9C, 0x39, 0x3A, 0x50, 0x33, 0xB9, 0x09, 0x66, 0xE4, 0x28,
+    0xA2, 0x59, 0xAB, 0x8E, 0x5B, 0x68, 0xAD, 0xB0, 0x8E, 0x3A, 0x34, 0x17, 0x45, 0x65, 0xD0, 0x23,
+    0xDB, 0x1B, 0xE7, 0xFE, 0x02, 0x69, 0xF4, 0x38, 0xF7, 0x6C, 0x88, 0x1B, 0xA2, 0xCD, 0x57, 0x6B,
+    0xC9, 0x53, 0x17, 0xDF, 0x29, 0x51, 0x38, 0x35, 0xD9, 0x4F, 0x18, 0x53, 0x82, 0x20, 0xFD, 0x90,
+    0x5F, 0xBE, 0xA3, 0x9D, 0xCE, 0x0C, 0x41, 0x04, 0xE6, 0x92, 0x5B, 0x16, 0x0C, 0xAA, 0x22, 0xE1,
+    0x3C, 0xED, 0xDA, 0x3B, 0xE2, 0x04, 0xA2, 0x12, 0xD1, 0xAF, 0x98, 0xD7, 0xCD, 0xCD, 0xF6, 0xA6,
+    0x3D, 0x54, 0x9A, 0x7C, 0x8E, 0x5D, 0x02, 0x4E, 0x95, 0x5E, 0xB0, 0x48, 0x95, 0xDA, 0x8B, 0xC7,
+    0x9F, 0x2A, 0xFD, 0x35, 0x64, 0xD3, 0xE1, 0xD6, 0x70, 0x57, 0x46, 0x18, 0x53, 0x19, 0x63, 0x8F,
+    0xD0, 0x28, 0xE8, 0xB1, 0x7B, 0xF8, 0xA5, 0xC3, 0x9F, 0x7F, 0xF2, 0x7C, 0xD4, 0x9E, 0xDF, 0xBD,
+    0xC9, 0xF6, 0x90, 0x5C, 0x9A, 0x02, 0x94, 0x50, 0x13, 0xAF, 0x5B, 0xBF, 0xBE, 0x69, 0x7E, 0x5B,
+    0x6E, 0xAE, 0x38, 0xBA, 0xA4, 0x2E, 0x9D, 0x12, 0x7F, 0xA8, 0x58, 0x47, 0xAE, 0x9A, 0x12, 0x38,
+    0xD2, 0x79, 0xD7, 0x7E, 0xED, 0x97, 0xB9, 0xF4, 0xCE, 0x84, 0xD2, 0x3B, 0xD3, 0x72, 0xAE, 0xC1,
+    0x7B, 0xD4, 0x4D, 0x7A, 0x67, 0xEA, 0xB5, 0xDE, 0x99, 0x27, 0x2F, 0x1E, 0xBE, 0xF6, 0xBC, 0x6B,
+    0xE1, 0x53, 0xD0, 0x88, 0xFA, 0x95, 0x24, 0xCB, 0x7D, 0x33, 0x46, 0x2E, 0xD7, 0x98, 0x1D, 0x5D,
+    0x32, 0x98, 0x0B, 0xF5, 0x0F, 0xE7, 0x85, 0x2D, 0xDF, 0x30, 0xD1, 0xC7, 0x2D, 0x9B, 0xAE, 0xE8,
+    0xA3, 0x92, 0x6D, 0x0D, 0xD1, 0x8A, 0x87, 0x58, 0x12, 0x3A, 0xF1, 0x1C, 0xEC, 0x26, 0x26, 0xB1,
+    0xB9, 0x25, 0x70, 0x0A, 0x31, 0x77, 0x95, 0xC4, 0x6B, 0xD6, 0xB8, 0xDC, 0x08, 0xFF, 0x63, 0x01,
+    0xEB, 0x2A, 0x14, 0x95, 0x57, 0x0F, 0x32, 0x2C, 0x30, 0x70, 0x7A, 0x70, 0xF1, 0x65, 0x38, 0x1F,
+    0x56, 0x1A, 0xC7, 0x97, 0xCD, 0x0D, 0x4F, 0x9F, 0xA8, 0x99, 0xCF, 0x22, 0x6A, 0xC9, 0x67, 0x10,
+    0x35, 0xFF, 0x31, 0xAA, 0xEA, 0x9E, 0xBB, 0x71, 0xA6, 0xD7, 0x38, 0x1D, 0xE5, 0x8F, 0xCA, 0xCA,
+    0x75, 0x00, 0xB8, 0xB8, 0x5B, 0xD2, 0x16, 0x46, 0x3C, 0x08, 0xB9, 0xD9, 0x1B, 0x65, 0x11, 0xA2,
+    0x28, 0x92, 0x08, 0x41, 0x84, 0x1C, 0xB2, 0x18, 0x42, 0x0A, 0x21, 0x84, 0x90, 0x41, 0x88, 0x20,
+    0x24, 0x10, 0x02, 0x08, 0xF9, 0x83, 0xF8, 0x41, 0xFA, 0x58, 0xF8, 0x72, 0x66, 0x76, 0x9E, 0x32,
+    0xC7, 0x91, 0x09, 0x03, 0x9B, 0x33, 0xCD, 0x92, 0xAC, 0x26, 0x48, 0x82, 0x65, 0x52, 0x75, 0xB6,
+    0x92, 0x20, 0x79, 0x7F, 0x63, 0xD3, 0xF5, 0x44, 0xC9, 0x78, 0x52, 0xF3, 0x4D, 0x65, 0x67, 0x86,
+    0x2D, 0x59, 0x6C, 0xC3, 0x1E, 0x25, 0x7D, 0x6E, 0x80, 0xE0, 0x1C, 0x45, 0x3D, 0xA6, 0x30, 0x24,
+    0x00, 0x36, 0xE9, 0x0C, 0xFA, 0x2A, 0x69, 0x42, 0x19, 0x50, 0xEA, 0x27, 0x57, 0xB1, 0xC5, 0x80,
+    0xBE, 0x89, 0x6C, 0x86, 0x32, 0x59, 0x36, 0xC3, 0x1E, 0x88, 0xAC, 0x96, 0x8D, 0x31, 0xB5, 0xE6,
+    0x3D, 0x30, 0x58, 0x49, 0x9B, 0x0E, 0x18, 0x68, 0x42, 0x4E, 0xAA, 0x52, 0x30, 0x9D, 0x48, 0x73,
+    0xBC, 0x46, 0x9D, 0xDC, 0x4C, 0xC0, 0x7B, 0x13, 0x07, 0x59, 0x4F, 0xC5, 0x27, 0xBA, 0x81, 0x44,
+    0x52, 0x98, 0xB2, 0x81, 0x04, 0xE8, 0x01, 0xB9, 0x43, 0xBD, 0xD7, 0x2C, 0xCE, 0x07, 0xE8, 0x1D,
+    0x24, 0x81, 0x5B, 0x90, 0x4B, 0x86, 0xD4, 0x38, 0x14, 0x00, 0xAF, 0xFF, 0x1E, 0x49, 0x57, 0xF4,
+    0xD8, 0xF1, 0xA5, 0xE3, 0x5C, 0x6B, 0xC7, 0x89, 0xD6, 0x39, 0xA7, 0x8E, 0x5A, 0xEE, 0x36, 0x6C,
+    0x90, 0x93, 0x44, 0x16, 0x39, 0xE5, 0x1D, 0x40, 0x48, 0xF2, 0x84, 0xC3, 0x0F, 0x1B, 0xED, 0x9E,
+    0xD3, 0xCD, 0x38, 0x0D, 0x02, 0x26, 0x92, 0x9D, 0xF9, 0xE1, 0xAE, 0xA9, 0x78, 0x43, 0xD7, 0xD4,
+    0x29, 0x20, 0xBB, 0x37, 0x63, 0x93, 0x87, 0x75, 0xBC, 0xF8, 0x3A, 0x97, 0xA3, 0xE1, 0xF3, 0x2F,
+    0x56, 0x30, 0x3D, 0x66, 0x2E, 0x98, 0xFD, 0xED, 0xBB, 0x08, 0x24, 0x40, 0x93, 0x70, 0x8E, 0xAC,
+    0x56, 0x5C, 0x17, 0x92, 0x3F, 0x82, 0x7A, 0xBE, 0x27, 0x5D, 0x0A, 0xB9, 0x77, 0xBA, 0x98, 0x61,
+    0xFC, 0xBB, 0xE7, 0xF7, 0x38, 0x64, 0xCC, 0x10, 0xB0, 0xC0, 0x1C, 0x60, 0x57, 0x5B, 0xC7, 0xAE,
+    0x56, 0x30, 0xE3, 0x7D, 0xBC, 0xDE, 0x34, 0x88, 0x98, 0x6C, 0xA2, 0x02, 0x6F, 0xA4, 0x33, 0x18,
+    0xDC, 0xD1, 0xFA, 0xD1, 0xD2, 0x4C, 0xF6, 0x5A, 0x9C, 0xD0, 0x66, 0x54, 0x14, 0x28, 0xC0, 0x24,
+    0x14, 0x25, 0xE6, 0xC8, 0xB3, 0xB6, 0xE8, 0xCD, 0x6D, 0x5C, 0x0A, 0xBF, 0x54, 0xAB, 0x39, 0xB8,
+    0xB4, 0xA8, 0x30, 0x4B, 0x3B, 0x4E, 0xB7, 0xD6, 0x92, 0x24, 0x1E, 0x5A, 0x02, 0x16, 0x60, 0x81,
+    0xF4, 0x06, 0xD8, 0xD2, 0x87, 0xE5, 0x0A, 0x65, 0x97, 0xCD, 0x7D, 0x26, 0x07, 0x4F, 0xF3, 0xBA,
+    0x02, 0x41, 0x7A, 0x9B, 0x98, 0xC1, 0xBA, 0xEF, 0x26, 0xB3, 0x03, 0x69, 0x05, 0xFE, 0x33, 0x74,
+    0x20, 0xB3, 0x24, 0x76, 0x4D, 0xE9, 0xCB, 0x16, 0x81, 0x46, 0x9B, 0xBA, 0x12, 0x6E, 0x24, 0x60,
+    0xD6, 0xA4, 0xAC, 0x33, 0x98, 0x39, 0xE3, 0xDE, 0xBD, 0xB1, 0xE9, 0x19, 0x81, 0x2A, 0xDF, 0x54,
+    0xE3, 0x8D, 0xCB, 0xB7, 0x5B, 0xD7, 0xC8, 0x44, 0xEF, 0xF5, 0x73, 0x42, 0x99, 0xA3, 0xD7, 0x88,
+    0xA9, 0xC7, 0xFA, 0x38, 0x66, 0xB2, 0x20, 0x59, 0xC8, 0x0C, 0xE3, 0x9B, 0x87, 0x60, 0x99, 0xE0,
+    0x17, 0x39, 0xFC, 0x1C, 0xDB, 0x84, 0x11, 0xD7, 0x85, 0x15, 0x29, 0xE9, 0x8B, 0xE4, 0x93, 0xEA,
+    0xBD, 0x61, 0x97, 0xA9, 0x99, 0xFC, 0xAC, 0x0D, 0xE7, 0xBC, 0x2F, 0xC7, 0xCE, 0x82, 0x8E, 0xEB,
+    0x5C, 0xB6, 0x0C, 0xB1, 0x68, 0x38, 0xB3, 0xC9, 0x6C, 0xA1, 0x65, 0xD0, 0x32, 0x63, 0x16, 0x2C,
+    0x62, 0x4C, 0x15, 0xB2, 0x30, 0x3C, 0x2E, 0x76, 0x3B, 0x88, 0x0D, 0x07, 0xE1, 0xCC, 0xA0, 0x83,
+    0x6B, 0x92, 0x0A, 0xD7, 0x2A, 0x52, 0xAC, 0x55, 0xA5, 0x54, 0xC7, 0x8C, 0x24, 0x9D, 0x59, 0x45,
+    0xF0, 0x85, 0xCC, 0xAC, 0x85, 0xCD, 0x77, 0x89, 0x5D, 0xBB, 0x4D, 0x81, 0x6A, 0xF4, 0x90, 0x47,
+    0x2C, 0x6F, 0xCC, 0xB2, 0xEB, 0x2B, 0x5D, 0x41, 0xAE, 0xB3, 0xAB, 0x9E, 0xF6, 0x23, 0x69, 0xA3,
+    0x75, 0x63, 0xCC, 0xCA, 0x56, 0x8C, 0x95, 0xAD, 0x56, 0x90, 0x83, 0xFA, 0x82, 0xD4, 0xDA, 0xFC,
+    0xC1, 0x8C, 0x1B, 0xB8, 0xAA, 0xB1, 0xEB, 0x87, 0xA9, 0x3E, 0xE0, 0x0F, 0x4C, 0x5C, 0x2B, 0x26,
+    0xDC, 0xC2, 0xE2, 0xE9, 0xA6, 0xAB, 0x50, 0x52, 0x62, 0xCC, 0xC6, 0x70, 0xF8, 0xC1, 0x80, 0xCA,
+    0x05, 0x66, 0x26, 0x9A, 0xC8, 0xA0, 0x95, 0x45, 0x54, 0xB7, 0x12, 0x64, 0x71, 0x09, 0x4B, 0x2C,
+    0xDA, 0xAC, 0xF6, 0xA5, 0x55, 0xC3, 0xD3, 0xED, 0x5E, 0x56, 0x82, 0x71, 0x7E, 0x2B, 0x49, 0x15,
+    0xB9, 0x2D, 0xDF, 0xB2, 0xFF, 0x63, 0xD2, 0x8E, 0x5B, 0x55, 0xCC, 0x76, 0xEF, 0xEA, 0x23, 0x78,
+    0x1A, 0xF3, 0x2C, 0x9B, 0xDF, 0x6F, 0x19, 0x33, 0x6D, 0x55, 0x20, 0x12, 0x65, 0x43, 0x68, 0xCD,
+    0x85, 0x05, 0xEF, 0xCA, 0x5A, 0x5C, 0x26, 0xF2, 0xF6, 0x0D, 0x3D, 0xB8, 0xA8, 0x5F, 0x90, 0xDE,
+    0x12, 0x64, 0xF7, 0xF0, 0xF6, 0x8D, 0x15, 0xD1, 0xB1, 0x62, 0xB2, 0xB1, 0x6C, 0x92, 0x8F, 0x74,
+    0x3E, 0xE1, 0xD4, 0x5C, 0xF9, 0x92, 0xA8, 0xCA, 0x39, 0x57, 0x5A, 0xD3, 0xD0, 0x92, 0xC6, 0x8E,
+    0xD9, 0x14, 0x5A, 0x6D, 0xE5, 0x81, 0x6D, 0x8A, 0xD6, 0xAB, 0xFE, 0xD1, 0x76, 0x26, 0xFE, 0xA7,
+    0xB7, 0xE8, 0xF2, 0x0F, 0x3E, 0x79, 0x52, 0xFF, 0xE1, 0x35, 0x92, 0x26, 0x42, 0x95, 0x23, 0x9D,
+    0xAD, 0x96, 0x92, 0xF3, 0x43, 0xA5, 0xA6, 0x23, 0x3D, 0xA9, 0xB5, 0xED, 0x3A, 0xA8, 0xBB, 0x00,
+    0xBE, 0x54, 0x02, 0x3A, 0xD7, 0x1D, 0xD8, 0x4E, 0x8D, 0x9D, 0xDB, 0xE7, 0x80, 0xC0, 0x45, 0xBB,
+    0xFE, 0x5D, 0xDB, 0xBF, 0xC6, 0x2E, 0xDA, 0xF8, 0x7F, 0xC4, 0x8E, 0xD0, 0x13, 0xC8, 0xC9, 0x3D,
+    0xF3, 0xA7, 0x7C, 0xCE, 0x04, 0xCD, 0xF8, 0x06, 0xD3, 0x27, 0x63, 0xFA, 0xC2, 0x05, 0x80, 0x92,
+    0x99, 0x04, 0xB3, 0xC7, 0xB4, 0x2E, 0xC6, 0xEC, 0x9A, 0x1D, 0xF7, 0x3B, 0x2A, 0x33, 0x45, 0xBC,
+    0x24, 0x5E, 0x7F, 0x76, 0x5A, 0x32, 0x6A, 0xF8, 0xE5, 0x1F, 0x0E, 0x5C, 0x06, 0x67, 0x48, 0xD8,
+    0xDD, 0x2E, 0xB5, 0x71, 0x80, 0xEB, 0x86, 0x70, 0xF6, 0xCF, 0xB9, 0xCC, 0x65, 0x31, 0xD9, 0x4F,
+    0x21, 0x9B, 0xB2, 0xC5, 0xB9, 0x0B, 0x75, 0xAB, 0x72, 0x27, 0x73, 0x4A, 0x4D, 0xB9, 0x5E, 0x76,
+    0x8F, 0x6B, 0xD9, 0x6D, 0xCE, 0x7B, 0xA2, 0x89, 0xF0, 0x6F, 0x00, 0xB9, 0x07, 0xC0, 0x4E, 0xF6,
+    0x97, 0xD2, 0xF4, 0xA4, 0xCA, 0xC9, 0x16, 0xB1, 0x82, 0x1E, 0xBE, 0x35, 0xC0, 0x26, 0x62, 0xCB,
+    0x85, 0x2A, 0xDD, 0x33, 0x77, 0x5C, 0xAE, 0x13, 0xE8, 0x2E, 0xDC, 0x69, 0x15, 0x61, 0xB9, 0xA2,
+    0x68, 0x6F, 0x80, 0xE1, 0x7C, 0x7A, 0xC6, 0xDB, 0x96, 0x9F, 0x2A, 0x72, 0x8F, 0x8C, 0x41, 0x4E,
+    0xAE, 0x40, 0xCA, 0x42, 0xF2, 0x8C, 0xA6, 0x9F, 0xD1, 0x64, 0x82, 0xE2, 0x6F, 0x2A, 0xBB, 0x17,
+    0x51, 0x26, 0x1D, 0x9B, 0x3F, 0x88, 0x07, 0x17, 0x99, 0x7A, 0x57, 0xB9, 0xE2, 0x93, 0xF1, 0x8B,
+    0xB2, 0x92, 0xA3, 0x94, 0x83, 0xDD, 0x5A, 0xDB, 0xE2, 0xD5, 0x7C, 0x9D, 0xDF, 0x5B, 0xEE, 0x9A,
+    0x90, 0x18, 0xE3, 0x63, 0xE8, 0xC7, 0xFA, 0x3E, 0xD6, 0xF0, 0xA5, 0x55, 0x62, 0x9F, 0x18, 0x6A,
+    0x6F, 0x83, 0xD8, 0xE8, 0xC2, 0x40, 0xF0, 0xFC, 0x80, 0xA5, 0x28, 0xE5, 0xD3, 0x53, 0xA2, 0x92,
+    0xBB, 0x36, 0x9F, 0x10, 0xB5, 0x4F, 0x06, 0x0D, 0x83, 0x7F, 0x5E, 0xBA, 0x00, 0x7A, 0xC2, 0xC0,
+    0xC3, 0x49, 0xD4, 0xFC, 0xE6, 0x98, 0xF0, 0x0F, 0xD0, 0xCF, 0xE9, 0xEB, 0xDE, 0xAF, 0xE3, 0xA2,
+    0x25, 0xB4, 0x33, 0x2E, 0xF0, 0xCE, 0xA1, 0xEF, 0xB1, 0x92, 0xC6, 0x18, 0x1A, 0x25, 0x13, 0x17,
+    0xB4, 0x7D, 0x03, 0x69, 0xBC, 0x1D, 0x04, 0x0F, 0x29, 0x4E, 0xAF, 0x91, 0xEC, 0x9D, 0xA4, 0x1B,
+    0x04, 0xBF, 0x89, 0x9E, 0x3B, 0x21, 0x12, 0xEE, 0x95, 0xDC, 0x74, 0xD9, 0x32, 0x93, 0xEE, 0x27,
+    0x4E, 0x71, 0x63, 0x8F, 0x30, 0x22, 0x97, 0xA5, 0x7F, 0x7E, 0x9C, 0x12, 0x0E, 0xE7, 0x78, 0x11,
+    0xCB, 0x75, 0x46, 0xBE, 0x6F, 0x9F, 0x30, 0x42, 0xF7, 0x2F, 0x31, 0x42, 0xB7, 0x76, 0xD8, 0x0A,
+    0xBC, 0x7E, 0x99, 0x63, 0x8C, 0x9B, 0x9F, 0xDA, 0x04, 0x93, 0xAF, 0x9F, 0x59, 0xF2, 0xB9, 0xBA,
+    0x6E, 0x40, 0xE5, 0x33, 0x76, 0x90, 0x5A, 0x16, 0xBF, 0xE5, 0xAC, 0x30, 0x39, 0x5F, 0xF6, 0x01,
+    0x8B, 0x75, 0x91, 0x83, 0x83, 0x82, 0x65, 0xF7, 0x91, 0x9C, 0x12, 0x14, 0x2F, 0x9C, 0x10, 0xC1,
+    0x57, 0xE0, 0x50, 0x39, 0x90, 0x1E, 0x65, 0xCE, 0x59, 0x60, 0xBB, 0xF8, 0xA7, 0x94, 0x6D, 0x37,
+    0xF6, 0xB4, 0xB6, 0x3A, 0x76, 0x5B, 0x12, 0xC1, 0xF1, 0x3A, 0xFA, 0x6B, 0xED, 0x2E, 0x94, 0x10,
+    0x55, 0x6B, 0xB9, 0x12, 0xC8, 0x70, 0xCC, 0x55, 0xBD, 0xBF, 0x3C, 0x64, 0xC4, 0x6F, 0xB0, 0x8D,
+    0x41, 0x8E, 0x18, 0x91, 0x13, 0x46, 0x44, 0xF6, 0xA4, 0x9D, 0x66, 0x64, 0xFE, 0x09, 0xE0, 0x87,
+    0x31, 0xBF, 0x6B, 0xA4, 0x1F, 0xAD, 0x43, 0xC2, 0x6E, 0x3B, 0xA8, 0x4D, 0x1C, 0x92, 0xEC, 0x6F,
+    0xC1, 0x85, 0x64, 0x3F, 0x86, 0x82, 0x3C, 0x53, 0xD8, 0xE1, 0x50, 0xE9, 0x37, 0x3A, 0xA2, 0xF4,
+    0xEB, 0x1A, 0xC4, 0x51, 0xE0, 0x54, 0x73, 0x9B, 0x95, 0xD7, 0xB0, 0xB2, 0xD1, 0x21, 0x76, 0xED,
+    0x8B, 0xA6, 0x4C, 0x8C, 0xCE, 0xF6, 0x33, 0xFB, 0x16, 0x8D, 0x3A, 0x5F, 0x10, 0x65, 0xBC, 0x52,
+    0x36, 0xB8, 0x70, 0x0A, 0x35, 0x96, 0xA6, 0x7C, 0x82, 0xBA, 0x4E, 0xB0, 0x4D, 0xF5, 0xB0, 0x7C,
+    0xFD, 0xDE, 0x70, 0x17, 0x8D, 0x47, 0x47, 0xD5, 0x41, 0x59, 0x9C, 0x30, 0x36, 0xE7, 0xA0, 0x0F,
+    0xB0, 0xC2, 0xCF, 0x69, 0xA1, 0x43, 0x34, 0x56, 0x7E, 0x13, 0x7E, 0xEC, 0x4F, 0x19, 0x14, 0x6E,
+    0xE3, 0xA6, 0xE1, 0xA6, 0x3B, 0x26, 0x6B, 0xE9, 0x04, 0x64, 0x88, 0x73, 0x3B, 0x19, 0xE6, 0xA8,
+    0x8B, 0x0E, 0x22, 0x14, 0xF7, 0x04, 0xA8, 0xB9, 0x20, 0x2F, 0xD1, 0xB4, 0x27, 0x51, 0xBF, 0x8F,
+    0x22, 0x39, 0xE7, 0xD9, 0x51, 0x54, 0x9D, 0xA1, 0xB5, 0x87, 0xB0, 0xC3, 0xE9, 0x1A, 0xB2, 0x2D,
+    0x88, 0x0C, 0x33, 0x60, 0x85, 0xDE, 0xE3, 0x01, 0x8B, 0x40, 0x48, 0x9E, 0xC8, 0x70, 0x49, 0x48,
+    0x7F, 0x45, 0x68, 0xBF, 0x23, 0xC3, 0x2D, 0x19, 0x3A, 0x30, 0xDA, 0xD3, 0x84, 0x4B, 0x83, 0x72,
+    0x33, 0x17, 0x17, 0x43, 0xDD, 0x13, 0x23, 0x1B, 0xA2, 0x46, 0x6F, 0x4C, 0x5B, 0xEB, 0x2F, 0x73,
+    0x6B, 0xFD, 0x8F, 0xCC, 0x45, 0x8E, 0x90, 0x2F, 0xAF, 0xB6, 0xD6, 0xE3, 0x43, 0x0B, 0x02, 0x7B,
+    0x97, 0x8F, 0x66, 0x61, 0xC7, 0xBC, 0x45, 0x4E, 0x65, 0xCC, 0xF8, 0x36, 0x9C, 0xF1, 0xE5, 0xB4,
+    0x6F, 0xAA, 0x69, 0x5F, 0x2E, 0x37, 0xA0, 0xDA, 0x80, 0xE4, 0x3E, 0x52, 0xFB, 0x19, 0x9F, 0x68,
+    0x92, 0xE5, 0xE1, 0x40, 0xAA, 0xE1, 0x37, 0xE8, 0x92, 0x5F, 0x1E, 0x4C, 0xF6, 0x5E, 0x6B, 0xB7,
+    0x32, 0x5B, 0x57, 0x03, 0x99, 0x0A, 0x5A, 0xB7, 0xD7, 0xD0, 0xC5, 0xA1, 0xB5, 0xF6, 0x14, 0xDD,
+    0xDD, 0x66, 0xEB, 0xC6, 0x8D, 0xD3, 0x45, 0x70, 0xD7, 0xAD, 0x5F, 0xAF, 0x1D, 0x12, 0x79, 0x8C,
+    0x14, 0x3E, 0x2B, 0xDD, 0x3A, 0x31, 0x8E, 0xC4, 0x33, 0xD1, 0x07, 0x0F, 0xC5, 0x28, 0xF7, 0xD3,
+    0xF0, 0x6E, 0xC2, 0xFC, 0x53, 0x41, 0xF6, 0xCF, 0xB0, 0x77, 0xE0, 0x98, 0xB9, 0x60, 0xB6, 0x85,
+    0xFB, 0xD2, 0xB8, 0xEA, 0x7F, 0xFC, 0x40, 0x36, 0xF2, 0x25, 0x32, 0xC4, 0x93, 0xDF, 0xFC, 0xB9,
+    0xB4, 0x05, 0x88, 0x0F, 0x65, 0xCE, 0x97, 0xA7, 0x4C, 0x05, 0x81, 0x10, 0xCC, 0x0B, 0xEF, 0xE0,
+    0x4D, 0xEE, 0x27, 0x8B, 0x91, 0xE6, 0xD5, 0x3B, 0x39, 0x8F, 0x0A, 0xAD, 0xCE, 0x67, 0xF6, 0x9E,
+    0x10, 0xA7, 0x5E, 0x2C, 0x71, 0x9E, 0x40, 0x71, 0x5B, 0x52, 0x2D, 0x92, 0xA2, 0x9D, 0x23, 0x0E,
+    0x8F, 0x66, 0x99, 0x6C, 0x65, 0xBC, 0x27, 0xAB, 0x26, 0x3F, 0x65, 0xBC, 0x39, 0x73, 0xE7, 0x45,
+    0x94, 0x6C, 0xD9, 0xBA, 0x67, 0xDF, 0x66, 0x78, 0x1F, 0xB0, 0x61, 0xF5, 0xE7, 0x11, 0x2C, 0xF2,
+    0x25, 0x2C, 0xA0, 0x73, 0x6B, 0xFB, 0xA8, 0x99, 0x35, 0x06, 0xBC, 0x41, 0x1E, 0xA7, 0x75, 0x39,
+    0xF8, 0xB1, 0x48, 0x8D, 0xD6, 0xF9, 0x04, 0xA5, 0xEA, 0x74, 0xD2, 0x3A, 0x3F, 0x2D, 0x52, 0x57,
+    0xAE, 0x26, 0x9C, 0xC9, 0xA9, 0x97, 0xCC, 0x28, 0xE1, 0x94, 0xB0, 0x4A, 0x78, 0x65, 0xC0, 0x2C,
+    0x23, 0xDC, 0x12, 0x76, 0x9D, 0x70, 0xBA, 0x2F, 0xA6, 0x5D, 0x25, 0x72, 0x72, 0xE7, 0xB8, 0x43,
+    0x76, 0xA5, 0x64, 0x9B, 0xFD, 0x4B, 0x6E, 0x5C, 0x94, 0xE2, 0x3A, 0xCB, 0x8E, 0x73, 0x65, 0x5C,
+    0x72, 0xC1, 0x02, 0x5C, 0x70, 0x40, 0x9A, 0x2E, 0x2F, 0x7C, 0xC0, 0x28, 0x22, 0x07, 0xE7, 0x37,
+    0xED, 0x3B, 0xF0, 0x02, 0xD7, 0x29, 0x82, 0x16, 0x71, 0x8D, 0x35, 0xBF, 0xEB, 0xEA, 0xD1, 0x0F,
+    0x5C, 0x3F, 0x8D, 0xDF, 0xEA, 0x99, 0xA3, 0x2B, 0xBB, 0x16, 0x84, 0x00, 0xA4, 0x08, 0xBD, 0x3D,
+    0x9A, 0xBE, 0x2F, 0x2C, 0xB6, 0xCB, 0xD0, 0x1D, 0xE3, 0x8F, 0x0D, 0xDD, 0x39, 0xB3, 0x93, 0x43,
+    0xBF, 0x37, 0xC0, 0x58, 0x4E, 0xE8, 0xDC, 0x97, 0x9D, 0x2C, 0x2D, 0xB3, 0x9E, 0x79, 0x4E, 0x1F,
+    0xF2, 0xC1, 0x7D, 0xEF, 0xFF, 0xE6, 0xCC, 0x6B, 0x0A, 0xFC, 0x82, 0x7F, 0x9B, 0x73, 0x03, 0x0F,
+    0x17, 0x8D, 0x7E, 0xDC, 0x31, 0x73, 0xB9, 0x5A, 0xF1, 0x2A, 0x87, 0x86, 0xEC, 0x79, 0xC7, 0x44,
+    0xC3, 0x2B, 0xF0, 0x34, 0x2F, 0xD2, 0x4C, 0xF7, 0x71, 0xB7, 0x43, 0x77, 0x72, 0xEC, 0xDB, 0xBD,
+    0xA0, 0x47, 0x81, 0xDD, 0x9A, 0xD6, 0x97, 0xCA, 0xBF, 0xF5, 0x1B, 0xBF, 0x47, 0x3F, 0x90, 0x0D,
+    0x6A, 0xBF, 0x87, 0x99, 0xAD, 0xA2, 0xD2, 0xEB, 0x91, 0x74, 0xAD, 0x62, 0x9A, 0x1D, 0x99, 0xD7,
+    0xEA, 0x12, 0xDD, 0x21, 0xEF, 0x5E, 0x90, 0xB0, 0x2C, 0xE0, 0x0B, 0x17, 0x2C, 0xA5, 0xC0, 0x1C,
+    0xCD, 0x79, 0x33, 0x17, 0xCD, 0xD8, 0xD1, 0xED, 0x16, 0xAA, 0xB1, 0xA0, 0x8D, 0x94, 0x7C, 0x4D,
+    0xFB, 0xE3, 0x35, 0x01, 0xA1, 0x01, 0xB6, 0x89, 0xFF, 0x5D, 0x88, 0x99, 0x69, 0x03, 0x40, 0xA7,
+    0x3D, 0x02, 0xF9, 0xE1, 0xC6, 0xA4, 0x2D, 0x56, 0xC0, 0x01, 0x47, 0xB3, 0xBB, 0x1D, 0xAF, 0x81,
+    0x8C, 0xBB, 0x4D, 0x28, 0x2A, 0x8F, 0x79, 0x4C, 0x48, 0x84, 0x78, 0x4C, 0x69, 0x2C, 0x29, 0x60,
+    0xFE, 0x43, 0x26, 0x11, 0x8D, 0x7F, 0x49, 0x23, 0x6F, 0x09, 0xFF, 0xCF, 0x8E, 0xA4, 0xC1, 0xEF,
+    0xFC, 0xBF, 0xED, 0x49, 0xE8, 0xFD, 0x2E, 0xB8, 0xDD, 0x9B, 0xD7, 0x69, 0x8C, 0xC8, 0x25, 0x27,
+    0x3A, 0x77, 0x67, 0xBD, 0xDE, 0x27, 0x2A, 0x77, 0x2F, 0x79, 0x3D, 0xDB, 0xDF, 0xEE, 0xB2, 0xD7,
+    0xB3, 0x76, 0xEF, 0x5A, 0xAF, 0xBF, 0x48, 0xE3, 0x41, 0xE3, 0xF5, 0x7C, 0xB2, 0xE2, 0xA3, 0xDA,
+    0xF4, 0xAD, 0x64, 0x51, 0x18, 0x6D, 0x5E, 0xF5, 0x8C, 0x8F, 0x3F, 0x2C, 0x11, 0xCD, 0x57, 0xDA,
+    0x0E, 0x05, 0x4B, 0x5F, 0xB7, 0x32, 0xFC, 0x97, 0x84, 0x0F, 0x2F, 0xCF, 0xA5, 0x67, 0xE2, 0x96,
+    0x3C, 0xFF, 0xCC, 0x24, 0x9F, 0xD1, 0x7B, 0x14, 0x32, 0x64, 0x32, 0x04, 0x48, 0x6B, 0x20, 0xAC,
+    0x62, 0xF9, 0xB5, 0x12, 0x5A, 0x58, 0xA4, 0x35, 0x38, 0xC2, 0xB8, 0x25, 0xC4, 0x9E, 0x4B, 0x7D,
+    0x14, 0xF5, 0x36, 0x39, 0xCF, 0x32, 0x6E, 0x13, 0x09, 0x59, 0xAE, 0x48, 0xFC, 0x02, 0x9B, 0x1C,
+    0x7C, 0xD2, 0x08, 0x28, 0xF5, 0x24, 0x30, 0x5C, 0x3B, 0xC6, 0x67, 0xF5, 0xFC, 0x1E, 0x1D, 0xC4,
+    0xA2, 0xBB, 0x83, 0xB6, 0xB4, 0x0C, 0x85, 0xDF, 0x28, 0x04, 0xDA, 0x93, 0xA4, 0xFA, 0x6C, 0xB5,
+    0xD9, 0xB2, 0x52, 0xAC, 0xF1, 0xC6, 0xE8, 0x23, 0x39, 0x19, 0xB2, 0xEC, 0xA4, 0x65, 0x64, 0xC7,
+    0xE8, 0x76, 0xEC, 0x55, 0xDE, 0x42, 0x22, 0x68, 0x81, 0x7B, 0x15, 0x32, 0x29, 0x1C, 0xCF, 0x71,
+    0xCC, 0xCF, 0x5D, 0xBA, 0x8D, 0xD1, 0x4E, 0x5D, 0x6C, 0xD3, 0x9B, 0x01, 0xA6, 0x58, 0x4A, 0xB8,
+    0x4C, 0x11, 0x82, 0x1E, 0x19, 0xA6, 0x41, 0x0A, 0x06, 0x56, 0x4A, 0x06, 0x95, 0x34, 0x01, 0x15,
+    0xB9, 0x04, 0xDB, 0xB7, 0x25, 0x93, 0xF3, 0x63, 0x69, 0x27, 0xFB, 0xFB, 0x52, 0x3A, 0xC3, 0x44,
+    0x04, 0xF5, 0x38, 0xE5, 0x95, 0xC3, 0x9F, 0xDC, 0xFE, 0xFF, 0xF2, 0x70, 0xBD, 0x4D, 0x49, 0x81,
+    0x8A, 0xC7, 0xB9, 0x6D, 0xD9, 0x6C, 0xA2, 0xB9, 0x23, 0x3D, 0x2A, 0x90, 0x00, 0xB9, 0x25, 0xBB,
+    0x3A, 0x06, 0x81, 0x61, 0x90, 0x49, 0x7A, 0x31, 0xC0, 0xCF, 0xAE, 0x4B, 0xF6, 0x89, 0xE7, 0xBB,
+    0x64, 0xA6, 0x35, 0xC1, 0xA6, 0x93, 0xEB, 0x31, 0xAF, 0x4A, 0xC8, 0xF8, 0x70, 0x63, 0x6D, 0x24,
+    0xCD, 0xC1, 0xB1, 0x0C, 0x5C, 0x5B, 0x1D, 0x50, 0xF3, 0x89, 0xA4, 0xDB, 0x89, 0x15, 0xE4, 0x8E,
+    0x1C, 0xEB, 0x79, 0xD3, 0x9D, 0x59, 0x25, 0x4D, 0x46, 0xAE, 0xDB, 0x4B, 0xCF, 0x0C, 0x29, 0xF4,
+    0x54, 0xAB, 0xFC, 0xF3, 0x3C, 0x91, 0xEA, 0x13, 0x35, 0x4E, 0x94, 0xA3, 0x27, 0x7C, 0x81, 0x83,
+    0x0D, 0x6B, 0x0F, 0xC3, 0xCA, 0x4F, 0x70, 0x6F, 0xD0, 0xFA, 0xC9, 0x61, 0x9F, 0xB1, 0x46, 0xA0,
+    0xBD, 0x0E, 0x1D, 0x1F, 0xFF, 0x3D, 0x37, 0x57, 0x59, 0xAE, 0x51, 0x56, 0x7F, 0xD7, 0x8C, 0x45,
+    0x18, 0xD0, 0x18, 0x55, 0x17, 0x6D, 0x53, 0x70, 0x7F, 0xEF, 0xCC, 0xF4, 0x5C, 0xE8, 0xCA, 0x78,
+    0x33, 0xE2, 0x58, 0xC0, 0x6A, 0x2E, 0xAC, 0x79, 0x4B, 0x5F, 0xC9, 0x15, 0xFC, 0x5C, 0xCF, 0x15,
+    0x77, 0xCE, 0xBA, 0x9E, 0xA6, 0xA5, 0xC7, 0xD7, 0xEA, 0xA9, 0xA8, 0x49, 0x7D, 0xD4, 0x26, 0xC2,
+    0x13, 0xCE, 0x85, 0xBD, 0xB1, 0x7E, 0xD5, 0x3B, 0x8A, 0x1D, 0x75, 0xFC, 0xDF, 0xF1, 0x70, 0xE1,
+    0x2B, 0xE6, 0x8C, 0x94, 0x54, 0xA1, 0x7E, 0x92, 0x57, 0xDB, 0x49, 0x0F, 0x6A, 0xA8, 0xB8, 0x2F,
+    0x5C, 0x99, 0xEE, 0x94, 0x70, 0xC1, 0xCF, 0x39, 0xD3, 0x19, 0x40, 0x0B, 0x79, 0x73, 0x28, 0xCB,
+    0x01, 0x38, 0x16, 0x9B, 0x32, 0x9D, 0x53, 0x76, 0x08, 0x3F, 0x84, 0x21, 0xC2, 0x11, 0x65, 0x89,
+    0xA6, 0xBA, 0x45, 0xFD, 0x48, 0xFB, 0xB9, 0xE4, 0xF3, 0xA6, 0xFF, 0xEC, 0x96, 0x39, 0x39, 0xF9,
+    0x27, 0x33, 0xC7, 0x80, 0x3B, 0xD8, 0x0A, 0x0B, 0xAF, 0x98, 0x54, 0x38, 0x18, 0xE4, 0xCE, 0xDF,
+    0xE7, 0xEE, 0xC4, 0xF7, 0xC5, 0x05, 0x19, 0x64, 0xF2, 0x42, 0x72, 0x86, 0x99, 0xA8, 0xEC, 0xAB,
+    0xE2, 0xC0, 0x3E, 0x3B, 0xD9, 0xC3, 0x3B, 0x4C, 0x37, 0x0E, 0xA8, 0xD2, 0xF4, 0x56, 0x3A, 0x4E,
+    0x55, 0x5B, 0xEA, 0x96, 0x02, 0x6D, 0x3D, 0x8E, 0x36, 0x1D, 0x76, 0x17, 0xAF, 0x2C, 0x48, 0x77,
+    0xE6, 0x5D, 0xB9, 0x32, 0xE4, 0x53, 0x27, 0x7A, 0x23, 0x0C, 0x2B, 0x2F, 0x77, 0x30, 0xAC, 0xBE,
+    0xBC, 0x99, 0x16, 0xFA, 0x75, 0xAF, 0xE1, 0x30, 0x55, 0x0D, 0xFF, 0x0F, 0xED, 0x5C, 0x3D, 0xAC,
+    0x1C, 0xD7, 0x75, 0xBE, 0x33, 0x23, 0xBE, 0x8D, 0x39, 0x88, 0x87, 0x85, 0x88, 0x44, 0xA6, 0xAD,
+    0x69, 0x5C, 0x18, 0x0A, 0xC4, 0x6D, 0x15, 0x80, 0xE4, 0x8C, 0xE5, 0x42, 0x2D, 0x03, 0x90, 0x55,
+    0x0A, 0xB9, 0x70, 0x11, 0x48, 0xC5, 0x6B, 0x5C, 0xA8, 0x78, 0xD2, 0x8C, 0x9D, 0x32, 0x0D, 0x1B,
+    0xB9, 0x0D, 0x0B, 0x15, 0x12, 0x05, 0xC4, 0x2A, 0x0C, 0x84, 0x41, 0x1E, 0x35, 0xA3, 0xB8, 0x48,
+    0x99, 0x4D, 0x10, 0xA4, 0x49, 0xB3, 0x46, 0x24, 0x38, 0x4E, 0xC3, 0x45, 0xB2, 0x11, 0xF6, 0x99,
+    0xBB, 0x33, 0x39, 0xE7, 0xFB, 0xCE, 0xBD, 0x73, 0xDF, 0x3E, 0x52, 0x90, 0x03, 0x88, 0xA2, 0x68,
+    0x3D, 0x90, 0x73, 0xE7, 0xBD, 0xDD, 0x9D, 0xB9, 0xF7, 0x9C, 0x73, 0xCF, 0xCF, 0x77, 0xBE, 0x59,
+    0xE7, 0xF4, 0x27, 0x5D, 0x62, 0x70, 0xF9, 0xC6, 0xB9, 0x64, 0x1C, 0x30, 0xCE, 0xC7, 0x71, 0x99,
+    0xAD, 0x9D, 0x1B, 0xDB, 0x7C, 0x9B, 0xAE, 0xDC, 0x6C, 0x2B, 0xAF, 0x64, 0x0B, 0x57, 0xAE, 0x9C,
+    0xEB, 0x5E, 0xAD, 0x5D, 0xD5, 0x3B, 0x57, 0xE9, 0xCB, 0xB5, 0xBC, 0xB5, 0x77, 0xC9, 0x20, 0x1F,
+    0x9F, 0x2F, 0x5C, 0xB6, 0x95, 0xB1, 0x5C, 0xEA, 0xDB, 0x31, 0x16, 0x6B, 0xFD, 0xBB, 0x8C, 0x2B,
+    0x8E, 0xFA, 0x71, 0x57, 0x2D, 0xF4, 0x14, 0xA3, 0xFC, 0x73, 0x7A, 0x2D, 0xBD, 0x9C, 0x6B, 0x6C,
+    0xEC, 0x78, 0x79, 0x37, 0xE2, 0x25, 0x97, 0x0E, 0x1C, 0xF5, 0xDA, 0x72, 0x0B, 0xCC, 0x4E, 0x2E,
+    0x8D, 0x6B, 0xE9, 0x75, 0xF5, 0xB5, 0xD9, 0x06, 0x6F, 0xD7, 0x79, 0xE4, 0x7A, 0x6B, 0xD7, 0xFC,
+    0x76, 0xC4, 0xA2, 0xF2, 0x71, 0xE0, 0xDA, 0x2E, 0xD6, 0xCE, 0xFF, 0x7C, 0x97, 0xC3, 0x88, 0x63,
+    0xA2, 0xC3, 0xB9, 0xEB, 0xFA, 0x5B, 0x2A, 0xEF, 0x7D, 0x4B, 0xAE, 0x7B, 0xD2, 0xF5, 0x47, 0x72,
+    0x85, 0xBA, 0xF8, 0xD5, 0xCA, 0x25, 0x3B, 0x37, 0x1B, 0x5B, 0x97, 0x6D, 0x70, 0xFB, 0x7C, 0x85,
+    0xA1, 0xE0, 0x50, 0x72, 0xBD, 0x72, 0x7F, 0x3F, 0xC8, 0x2C, 0xAA, 0x16, 0x93, 0x69, 0x5A, 0x97,
+    0xAF, 0x31, 0xE8, 0x14, 0x75, 0x58, 0xE2, 0xB5, 0x79, 0x8F, 0xA1, 0xA2, 0xD8, 0x74, 0x6E, 0xC5,
+    0x12, 0x42, 0x9B, 0x0D, 0x3F, 0xC7, 0x84, 0x3B, 0xCE, 0xF7, 0xDC, 0x34, 0x5D, 0x57, 0xDA, 0x79,
+    0xD5, 0x57, 0x32, 0xC3, 0xF9, 0xB6, 0x5A, 0x70, 0x2C, 0xFB, 0x44, 0xA6, 0xE6, 0xB6, 0x45, 0x8F,
+    0xB5, 0xDC, 0x2D, 0x1D, 0x2E, 0xB8, 0x3E, 0xD6, 0x59, 0xCB, 0xFA, 0x96, 0x2E, 0x95, 0x2B, 0x27,
+    0x6B, 0x8A, 0x4E, 0x95, 0xAC, 0x13, 0xD4, 0x71, 0xA6, 0x7F, 0x53, 0x51, 0xEA, 0xD8, 0x63, 0x5D,
+    0x6E, 0xD6, 0x53, 0x9C, 0x79, 0xEB, 0x30, 0xD9, 0xA2, 0xC6, 0x0A, 0x31, 0xEA, 0xAC, 0x0B, 0x6A,
+    0xCA, 0x95, 0x36, 0x5E, 0x76, 0x58, 0x89, 0xBB, 0xAA, 0xD2, 0x96, 0xF7, 0x5C, 0xB1, 0xF1, 0xC8,
+    0xC6, 0x8D, 0xBE, 0x5E, 0xBB, 0x64, 0xC5, 0xF7, 0xCF, 0x74, 0x75, 0xE5, 0xDA, 0xCD, 0x5B, 0x5D,
+    0xEC, 0x68, 0x6A, 0xE9, 0xA8, 0x25, 0x97, 0xDC, 0x98, 0x96, 0xFB, 0x0D, 0x5B, 0x6D, 0x8B, 0xA1,
+    0xE9, 0x6D, 0xED, 0xDD, 0x4E, 0xA6, 0x5F, 0xB6, 0x87, 0x5B, 0x99, 0xFD, 0x5C, 0x57, 0x34, 0x5B,
+    0x1D, 0xE9, 0x82, 0xF2, 0x07, 0x4B, 0x27, 0x86, 0x5A, 0x9C, 0xC8, 0x65, 0x57, 0xAE, 0x58, 0x60,
+    0x35, 0x25, 0x07, 0xCC, 0x7B, 0xC9, 0x61, 0x81, 0x2B, 0x96, 0xBD, 0x97, 0x7D, 0xC7, 0x7B, 0x8C,
+    0x98, 0x66, 0xCA, 0x61, 0xA6, 0xB3, 0x6A, 0xDC, 0x1F, 0x62, 0xA8, 0x5F, 0xD2, 0xA1, 0xFA, 0x68,
+    0x35, 0x9E, 0x93, 0x61, 0xEC, 0x55, 0x33, 0xC5, 0x00, 0xAB, 0x77, 0xD7, 0xDD, 0x39, 0x17, 0xFF,
+    0xFC, 0xD0, 0x3D, 0x37, 0xFD, 0x72, 0x94, 0x6C, 0xA6, 0x5F, 0xE6, 0xF9, 0x32, 0xD2, 0xE4, 0xFD,
+    0x76, 0xFA, 0xA5, 0x18, 0xA3, 0x0B, 0x60, 0xC3, 0xF8, 0x9F, 0xE4, 0xBA, 0x3B, 0xFD, 0x53, 0x8C,
+    0xE3, 0x6F, 0x1C, 0xF6, 0xA4, 0xC8, 0xAD, 0x94, 0xE3, 0x5A, 0x67, 0x04, 0x21, 0x76, 0xFD, 0x1F,
+    0x0D, 0x10, 0xB4, 0xDA, 0xBD, 0xD8, 0x59, 0xD7, 0xAB, 0x06, 0x74, 0x6F, 0x88, 0x12, 0x64, 0x9B,
+    0xDD, 0xC5, 0x3E, 0xD3, 0xD5, 0x8A, 0x72, 0x57, 0xBA, 0x9F, 0x61, 0xF9, 0xA2, 0x79, 0x11, 0x9B,
+    0x2E, 0x70, 0xE0, 0xEE, 0xC1, 0xE7, 0xD5, 0x6E, 0xB8, 0x85, 0xE5, 0x9D, 0xA9, 0xFF, 0xA5, 0x91,
+    0xCF, 0xAB, 0x25, 0xE1, 0x17, 0xDD, 0xF0, 0x99, 0xFD, 0x82, 0xCF, 0xAB, 0x4D, 0x61, 0x6F, 0xC0,
+    0x8A, 0xD7, 0x5C, 0x0A, 0xF6, 0x39, 0xAC, 0x6A, 0xC3, 0xCF, 0xD3, 0xB4, 0xCC, 0x61, 0xE0, 0x17,
+    0xDD, 0x44, 0x30, 0x82, 0x82, 0x7B, 0x99, 0xFB, 0x56, 0x15, 0xA7, 0xFE, 0x61, 0x05, 0xD9, 0xF5,
+    0xD0, 0x3F, 0x4D, 0x40, 0x6D, 0x4E, 0x3E, 0x2C, 0xFF, 0xD2, 0x5A, 0x15, 0x27, 0x6E, 0x41, 0x3F,
+    0x3F, 0x6B, 0x75, 0xA1, 0xE2, 0x13, 0xF4, 0xF3, 0x79, 0x0D, 0xE7, 0xB1, 0xC4, 0xE7, 0x0B, 0x5D,
+    0xE8, 0x81, 0xBC, 0x5F, 0x3F, 0xDF, 0xB8, 0x43, 0x91, 0x97, 0x7A, 0x09, 0x88, 0xAD, 0x93, 0x83,
+    0xD8, 0xA6, 0xFE, 0xB2, 0x9B, 0xC4, 0xFC, 0xC7, 0xEE, 0x60, 0xDA, 0x76, 0xA5, 0xFA, 0x02, 0x13,
+    0xBC, 0xCB, 0xFF, 0x41, 0x9D, 0x0E, 0x05, 0xEF, 0x66, 0x0F, 0x54, 0xA5, 0x14, 0xBC, 0xCB, 0x46,
+    0xB8, 0x2E, 0x08, 0x9E, 0xCE, 0xC4, 0x04, 0xEF, 0x1C, 0x6C, 0x9A, 0x82, 0x77, 0xC1, 0xE5, 0xA8,
+    0x0C, 0xF8, 0x43, 0xC1, 0x37, 0xE3, 0xB8, 0x0A, 0x82, 0x97, 0x69, 0x2D, 0x82, 0xE0, 0x37, 0xF4,
+    0x7E, 0x90, 0xB5, 0xEC, 0x22, 0xBD, 0x34, 0x05, 0x9F, 0xF6, 0xFA, 0xC7, 0x20, 0xF8, 0xD9, 0x3A,
+    0x16, 0xFC, 0x32, 0x12, 0x3C, 0xBC, 0x68, 0x10, 0xBC, 0x9B, 0x04, 0x9F, 0xEE, 0x22, 0xC1, 0x43,
+    0xFB, 0x5E, 0xF0, 0xC5, 0x32, 0x12, 0x7C, 0x15, 0x0B, 0xBE, 0xF3, 0xBB, 0x52, 0x04, 0x2F, 0xD3,
+    0xCD, 0x6A, 0x67, 0x82, 0xD7, 0x3D, 0x68, 0x5E, 0x1B, 0x8E, 0xBE, 0x70, 0x5E, 0xF0, 0x72, 0xBD,
+    0xC6, 0x79, 0xC1, 0x37, 0x34, 0x57, 0x08, 0x5E, 0x07, 0xCA, 0xFD, 0xFC, 0x9D, 0xDA, 0x9D, 0x77,
+    0xA9, 0x6E, 0x8B, 0x52, 0x4C, 0x33, 0xEF, 0xE1, 0xEC, 0x12, 0xF9, 0x70, 0xB6, 0xBC, 0xE7, 0x4C,
+    0x80, 0xE9, 0x83, 0x8D, 0x3F, 0x75, 0xE6, 0x30, 0x3A, 0x68, 0xC0, 0xCB, 0xD1, 0x5D, 0xA4, 0x48,
+    0x83, 0x2E, 0xCF, 0xFD, 0x99, 0xDF, 0x4F, 0xA2, 0xE3, 0xAD, 0xEE, 0x15, 0x91, 0x40, 0xFE, 0xBF,
+    0x87, 0x1B, 0x3D, 0xD5, 0x98, 0xD1, 0x8A, 0xC0, 0xDE, 0x44, 0x38, 0x19, 0x55, 0x76, 0xBF, 0x50,
+    0x0D, 0x8A, 0x54, 0x45, 0x72, 0x4B, 0xBD, 0xA0, 0x3A, 0x94, 0x95, 0xF3, 0x3E, 0x5F, 0x85, 0xA2,
+    0x32, 0x95, 0x51, 0xFD, 0xCB, 0x9C, 0xFF, 0xCB, 0x1E, 0x7A, 0x57, 0xF9, 0xA8, 0xBC, 0xC6, 0x10,
+    0xC9, 0xB0, 0x4F, 0x44, 0x50, 0x16, 0x03, 0x54, 0x4C, 0x22, 0x1C, 0x68, 0x46, 0x4E, 0x47, 0x73,
+    0x6D, 0x0D, 0x9C, 0xCE, 0xE8, 0xD2, 0x5E, 0x67, 0xD3, 0xE9, 0xDD, 0x33, 0xFD, 0xF8, 0x77, 0x3A,
+    0x9D, 0x90, 0x78, 0xE1, 0xF9, 0xF2, 0x6E, 0xF7, 0x8A, 0x7C, 0x6A, 0x5E, 0x8B, 0x19, 0x2E, 0x9B,
+    0x51, 0x37, 0xBC, 0xBA, 0xCE, 0xBA, 0x5A, 0xF3, 0x54, 0x0C, 0xEC, 0x5C, 0xE4, 0x21, 0x74, 0x2A,
+    0x74, 0x0F, 0x35, 0xCF, 0x5C, 0xB7, 0x80, 0x00, 0x5A, 0xCE, 0x93, 0x53, 0x6C, 0x6A, 0x86, 0x49,
+    0x8A, 0xD0, 0x22, 0x05, 0x92, 0x80, 0xAD, 0xC9, 0x12, 0xF3, 0xC7, 0xDF, 0x19, 0x2F, 0x70, 0xA6,
+    0xF6, 0x85, 0x77, 0x40, 0x10, 0x58, 0x21, 0x25, 0xB4, 0xF1, 0x67, 0x30, 0xC3, 0x20, 0x2A, 0x8B,
+    0x1D, 0x61, 0x1B, 0xF3, 0xAC, 0xA2, 0x3F, 0x36, 0xEF, 0xAE, 0xEF, 0xE0, 0xD4, 0xF4, 0x1D, 0x2B,
+    0x4C, 0xAD, 0xC2, 0x99, 0xF9, 0x66, 0x09, 0x55, 0x36, 0x65, 0x09, 0x56, 0x03, 0x6D, 0x2C, 0xEF,
+    0xFD, 0x94, 0xE7, 0xD8, 0x06, 0x6A, 0x5D, 0x63, 0xAB, 0x67, 0x9D, 0x9E, 0xD5, 0x59, 0x70, 0xA4,
+    0x59, 0xF0, 0xC2, 0xB3, 0xB0, 0xE7, 0xF2, 0xB0, 0x15, 0x8B, 0xE0, 0x96, 0xCB, 0xDE, 0x9F, 0x55,
+    0x6D, 0xB4, 0x51, 0x79, 0x8D, 0x71, 0x13, 0xCE, 0x6E, 0x45, 0x0E, 0xD9, 0x3B, 0x68, 0xB9, 0x1B,
+    0x25, 0x2F, 0x27, 0x14, 0xBC, 0x6E, 0x42, 0xC8, 0x3D, 0x5B, 0x7B, 0xB1, 0x7B, 0xA9, 0x7B, 0xBB,
+    0x3D, 0x75, 0x07, 0x47, 0x27, 0xB2, 0xA4, 0xC4, 0x13, 0xF9, 0x28, 0x05, 0x2E, 0x22, 0xA1, 0xBC,
+    0xE7, 0x66, 0x50, 0x38, 0xD9, 0xD8, 0x34, 0xB9, 0x22, 0xF5, 0xFA, 0x58, 0x50, 0xE3, 0x05, 0x1C,
+    0xBC, 0xCD, 0xE0, 0x57, 0x38, 0x78, 0x39, 0xEF, 0x4C, 0xCC, 0xC9, 0xD6, 0xA4, 0xAC, 0x97, 0x87,
+    0x90, 0xF5, 0xAA, 0x90, 0xB1, 0x4E, 0x19, 0x22, 0x9E, 0xAD, 0x4D, 0xC2, 0x12, 0x51, 0x29, 0x60,
+    0xB9, 0x0F, 0xE5, 0x1B, 0xE4, 0x56, 0x2C, 0xF6, 0xE5, 0x37, 0xEF, 0xF7, 0xE5, 0xD8, 0xC4, 0x8B,
+    0x0C, 0x46, 0xA6, 0xE3, 0x68, 0x8A, 0x48, 0xD5, 0x1B, 0x1C, 0xDC, 0x69, 0xDD, 0xB3, 0x22, 0x48,
+    0xE4, 0x31, 0x5D, 0x6F, 0x5B, 0x64, 0xC4, 0x02, 0xEF, 0xF9, 0xAB, 0x74, 0xD1, 0x85, 0x06, 0xDB,
+    0xED, 0xA2, 0x1D, 0x59, 0xCE, 0xE1, 0x1A, 0x5B, 0x77, 0xAD, 0xE2, 0x91, 0x09, 0xCB, 0x2A, 0x64,
+    0xB6, 0x33, 0x6C, 0x5B, 0x66, 0x04, 0x9A, 0x10, 0xF4, 0x96, 0x08, 0xC8, 0xAF, 0x72, 0xD4, 0x34,
+    0x00, 0xC9, 0x98, 0xDC, 0x41, 0x8E, 0x0D, 0x6E, 0xD8, 0xE1, 0x86, 0x83, 0x3F, 0x8A, 0x48, 0x44,
+    0x66, 0xD5, 0x4F, 0xBF, 0xAF, 0x72, 0x1A, 0x5F, 0x56, 0xE7, 0xBA, 0x51, 0x51, 0x25, 0x75, 0x06,
+    0xE9, 0xCF, 0x56, 0x93, 0x45, 0x51, 0x2A, 0x94, 0x04, 0x57, 0x8F, 0xE9, 0x76, 0x58, 0x6E, 0x77,
+    0x8B, 0x3B, 0x54, 0xD4, 0x36, 0x0E, 0xF9, 0x28, 0xCB, 0x2C, 0xC5, 0xCD, 0x4B, 0x66, 0x5A, 0xE8,
+    0xB9, 0xEB, 0x98, 0x19, 0x56, 0x7A, 0xA1, 0x46, 0x0E, 0x73, 0x73, 0xDC, 0xCD, 0x06, 0x49, 0x16,
+    0xCE, 0xFF, 0x7E, 0x8B, 0x44, 0x0B, 0x97, 0xFE, 0x74, 0x87, 0x64, 0x0B, 0x26, 0xB5, 0x1A, 0x91,
+    0x70, 0xE9, 0xCD, 0x92, 0x95, 0x98, 0xDF, 0x5D, 0x1A, 0x56, 0xBA, 0x12, 0xEF, 0xBD, 0xA6, 0x9C,
+    0xD2, 0x65, 0xA5, 0xE7, 0x30, 0xAF, 0x6C, 0x21, 0xFE, 0xC4, 0xDC, 0x7F, 0xD6, 0x17, 0x2B, 0x09,
+    0x2B, 0xD0, 0xC8, 0xAC, 0xCF, 0x37, 0xB2, 0xD9, 0x60, 0x67, 0x79, 0x9B, 0x6D, 0x65, 0xBB, 0xC1,
+    0xD4, 0x8A, 0x3A, 0xDD, 0x89, 0x53, 0x82, 0xB5, 0x15, 0x75, 0x32, 0x4A, 0x8E, 0x88, 0xF5, 0x6A,
+    0x68, 0x7D, 0xA5, 0xA7, 0xA9, 0x49, 0x3E, 0xD8, 0xFC, 0x15, 0xD3, 0x5C, 0x4C, 0xF7, 0x9F, 0x6A,
+    0x4A, 0x43, 0xA6, 0x3B, 0xBF, 0x6F, 0xC6, 0x77, 0x85, 0xD9, 0x0E, 0x0C, 0x44, 0xA6, 0x9B, 0x5B,
+    0x46, 0xEF, 0x8E, 0x99, 0x43, 0x60, 0x59, 0x1A, 0xDA, 0x76, 0x5C, 0xD6, 0xE1, 0x78, 0x5B, 0xF5,
+    0x8A, 0x73, 0x64, 0x88, 0xDB, 0x68, 0xE3, 0xC4, 0x7B, 0x27, 0xB2, 0x2C, 0xEF, 0xCB, 0xA6, 0x8D,
+    0x39, 0x9D, 0xAF, 0xA3, 0x4C, 0x6A, 0x15, 0xA5, 0x66, 0xFD, 0x74, 0xC5, 0xE8, 0x92, 0xE3, 0xC7,
+    0xA7, 0x72, 0xAF, 0x67, 0xA7, 0xD3, 0x2E, 0x68, 0x51, 0x03, 0xA2, 0x29, 0x11, 0xB3, 0x31, 0x1D,
+    0x7E, 0x38, 0xA9, 0xD0, 0x4D, 0x1A, 0x74, 0x93, 0x02, 0xDD, 0xA4, 0x3F, 0x17, 0xD4, 0x37, 0x6E,
+    0x83, 0xF6, 0x0E, 0x37, 0x41, 0x79, 0xF0, 0xB8, 0xD4, 0x1D, 0xD3, 0x75, 0xA8, 0x4E, 0x8D, 0xCE,
+    0x34, 0xC7, 0xA4, 0x1D, 0x8A, 0x83, 0xD7, 0xA5, 0xDE, 0x8A, 0x45, 0x50, 0x9B, 0x9A, 0xA3, 0x69,
+    0xCD, 0x12, 0x78, 0x55, 0xDA, 0xBC, 0x0F, 0x3A, 0x53, 0xB9, 0x9B, 0xCA, 0x34, 0x29, 0x36, 0x8D,
+    0x35, 0x93, 0xC2, 0xBA, 0x49, 0x5F, 0xC3, 0xA4, 0xAE, 0x61, 0xD2, 0xD6, 0x2E, 0x28, 0x2B, 0xD9,
+    0x06, 0x5D, 0xA5, 0x93, 0xEC, 0x27, 0x1F, 0x1C, 0x6B, 0x61, 0x36, 0x29, 0x61, 0x72, 0xC8, 0x93,
+    0x43, 0x39, 0xA5, 0x99, 0x66, 0x3A, 0x9B, 0xD4, 0xDB, 0x2C, 0x1E, 0xA2, 0x9F, 0xB3, 0xAE, 0x35,
+    0x9C, 0xDC, 0x73, 0x9F, 0xFD, 0xC3, 0xF4, 0x61, 0x3E, 0xBE, 0x2C, 0x2A, 0x15, 0x6D, 0x5C, 0x1A,
+    0x0B, 0xF1, 0x4F, 0xAA, 0x8B, 0xF1, 0xC5, 0x9C, 0xE2, 0x1F, 0x3E, 0xA0, 0x73, 0x71, 0x43, 0xAF,
+    0xF9, 0xCE, 0x4A, 0x53, 0x14, 0x4D, 0x12, 0xA4, 0xC6, 0x1A, 0xCD, 0xCB, 0xC8, 0xAE, 0xCA, 0x71,
+    0xA2, 0x41, 0x01, 0x1E, 0x87, 0x6F, 0x90, 0xC5, 0xF0, 0x0D, 0x22, 0x6E, 0x7A, 0xA2, 0xAA, 0xB6,
+    0xBF, 0x37, 0xF0, 0x1C, 0x74, 0x3D, 0x7C, 0x43, 0xE7, 0x4B, 0x94, 0xC1, 0x99, 0x7B, 0xDA, 0xD1,
+    0x3B, 0x7C, 0x04, 0x37, 0x54, 0x9B, 0x27, 0xAA, 0xE4, 0xFD, 0x5B, 0x13, 0xAE, 0xF8, 0xA3, 0xCD,
+    0xBE, 0x8C, 0x83, 0x58, 0x27, 0x77, 0x1D, 0xBC, 0x74, 0xBB, 0x27, 0xAF, 0xCE, 0xAB, 0xAB, 0xF3,
+    0x52, 0xB5, 0x84, 0xCC, 0x67, 0x63, 0x21, 0x15, 0x4B, 0x1F, 0xD8, 0xF5, 0x2D, 0x09, 0x73, 0x5D,
+    0x1B, 0xCB, 0x6F, 0x52, 0xAA, 0x5D, 0xA8, 0xB4, 0xB7, 0x55, 0x36, 0x36, 0x36, 0xAB, 0x07, 0x1C,
+    0xD3, 0x5F, 0x73, 0xCC, 0xFE, 0x91, 0x97, 0x2D, 0xFE, 0x92, 0x63, 0x69, 0xEB, 0xB9, 0x6A, 0x9B,
+    0xF8, 0xD8, 0x0C, 0x6A, 0xCD, 0x31, 0x5D, 0x72, 0xA3, 0xCF, 0x98, 0x09, 0xB8, 0xA2, 0xA5, 0x13,
+    0xB0, 0xF2, 0xD7, 0x59, 0x72, 0x84, 0x78, 0xE5, 0x58, 0xFF, 0x76, 0x58, 0x04, 0x1D, 0x8A, 0xD6,
+    0xB9, 0x3A, 0x6A, 0x5D, 0xAB, 0x1B, 0x60, 0x6E, 0x79, 0xC9, 0x35, 0x1B, 0x07, 0x16, 0x9D, 0x97,
+    0xC4, 0xAC, 0x2F, 0x8D, 0x27, 0x72, 0xB5, 0xB5, 0xFC, 0xDF, 0x05, 0xA9, 0xCC, 0x20, 0x93, 0x6C,
+    0xA5, 0x5B, 0x3D, 0x61, 0x5E, 0x4A, 0x69, 0x30, 0x1B, 0x8D, 0x24, 0x71, 0xEE, 0x3A, 0xB2, 0xAF,
+    0xE1, 0xC8, 0x32, 0x4F, 0x26, 0x9D, 0xCC, 0x37, 0x99, 0x6A, 0x32, 0xCB, 0x64, 0x82, 0xC9, 0xDC,
+    0x92, 0x69, 0x25, 0x33, 0x4A, 0x26, 0x93, 0xCC, 0x23, 0x99, 0x42, 0x32, 0x7B, 0x64, 0xE2, 0x88,
+    0x9C, 0x91, 0xE9, 0x22, 0x33, 0x45, 0x26, 0x89, 0xCC, 0x0F, 0x43, 0x6A, 0xF8, 0x1C, 0x2A, 0x9A,
+    0xA2, 0xD6, 0x45, 0xCE, 0xFE, 0x19, 0x55, 0x03, 0x84, 0x9F, 0xA2, 0x6A, 0x61, 0x31, 0xE6, 0x6E,
+    0xB8, 0xD3, 0x59, 0x24, 0x13, 0x19, 0x33, 0x07, 0xA6, 0x30, 0xCC, 0x5F, 0xBA, 0x68, 0x57, 0x0D,
+    0x93, 0xC7, 0x65, 0xC2, 0x42, 0xE5, 0x50, 0x65, 0x54, 0x20, 0x93, 0x14, 0x0B, 0x90, 0xF1, 0x71,
+    0xE9, 0xF3, 0x43, 0xBF, 0xD3, 0xAB, 0x28, 0x70, 0xF2, 0x86, 0x5D, 0x1D, 0xE6, 0x77, 0x38, 0xFE,
+    0x27, 0xB4, 0x89, 0x2B, 0xDF, 0x76, 0xDF, 0x73, 0x77, 0xD3, 0x95, 0xBB, 0xA6, 0xC2, 0xD2, 0xAC,
+    0x5A, 0xEE, 0x5D, 0x6C, 0x4E, 0x95, 0xCC, 0xEA, 0x27, 0x0E, 0x7D, 0x85, 0xBA, 0xE1, 0xA6, 0xD0,
+    0x9D, 0x9B, 0x1B, 0x5E, 0x04, 0x70, 0x63, 0xC1, 0x68, 0x6D, 0x70, 0x0C, 0xFF, 0xD7, 0xFC, 0x8F,
+    0x34, 0xF4, 0xA7, 0xBA, 0xD3, 0xE4, 0xF2, 0x88, 0xF7, 0xF1, 0xA6, 0x10, 0xFD, 0xEB, 0x40, 0x03,
+    0xF0, 0x16, 0x10, 0xAA, 0x92, 0xFE, 0xCC, 0x76, 0x48, 0x88, 0x74, 0x28, 0x9C, 0xE6, 0x88, 0xA6,
+    0x39, 0x82, 0x69, 0x2C, 0x92, 0x0D, 0xEB, 0x92, 0xFF, 0x44, 0xD2, 0x0C, 0x48, 0x33, 0x1C, 0xCD,
+    0x60, 0x34, 0x43, 0xD1, 0x0C, 0x44, 0x33, 0x0C, 0xCD, 0x20, 0x34, 0x43, 0xD0, 0x0C, 0x40, 0x33,
+    0xFC, 0xCC, 0xE0, 0x33, 0x43, 0xCF, 0x0C, 0x3C, 0x33, 0xEC, 0xCC, 0xA0, 0x33, 0x43, 0xCE, 0x0C,
+    0x38, 0xF3, 0xB8, 0x99, 0xC1, 0x66, 0x1E, 0x35, 0xBB, 0x18, 0x2F, 0x9D, 0xDE, 0x80, 0xBE, 0xE0,
+    0x73, 0x58, 0x7E, 0x8A, 0x6B, 0x28, 0x98, 0x06, 0x2C, 0x8D, 0x50, 0x1A, 0x72, 0x34, 0x3A, 0x50,
+    0x7A, 0x49, 0xCD, 0x9B, 0xE1, 0x31, 0x59, 0x37, 0x11, 0x44, 0x23, 0x86, 0xC6, 0xF2, 0x89, 0x08,
+    0x9A, 0x1C, 0xCB, 0xA5, 0x4F, 0xD9, 0x5A, 0xCB, 0xDA, 0x06, 0x0F, 0x9E, 0x19, 0x76, 0x46, 0xE8,
+    0xCC, 0x23, 0x67, 0xDF, 0x95, 0x69, 0x3B, 0xDD, 0xD6, 0xC7, 0xB0, 0xB6, 0x1F, 0xD0, 0xF4, 0xEE,
+    0x63, 0xAE, 0x33, 0x1A, 0x7E, 0x66, 0x11, 0x65, 0xDA, 0x00, 0x00, 0xD6, 0xC6, 0x0D, 0x87, 0x35,
+    0x4A, 0xA7, 0x81, 0x16, 0x7F, 0xD7, 0xC0, 0x35, 0xDA, 0x3C, 0xF3, 0xA6, 0x84, 0x38, 0xA0, 0x98,
+    0xA3, 0x01, 0x6B, 0x86, 0xAB, 0x19, 0xAC, 0x66, 0xA8, 0x9A, 0x81, 0x6A, 0x86, 0xA9, 0x19, 0xA4,
+    0x66, 0x01, 0xD9, 0x00, 0x35, 0xC3, 0xD3, 0x0C, 0x4E, 0x33, 0x34, 0xCD, 0xC0, 0x34, 0xC3, 0xD2,
+    0x0C, 0x4A, 0x33, 0x24, 0xCD, 0x80, 0x34, 0x8F, 0xA3, 0x19, 0x8C, 0xE6, 0x51, 0xB4, 0xDF, 0x71,
+    0xD7, 0xD3, 0x74, 0x15, 0x5E, 0x73, 0x40, 0xD7, 0x08, 0xAE, 0x79, 0x35, 0xAD, 0x7D, 0x1E, 0xBD,
+    0x34, 0x60, 0x8D, 0xB8, 0x5A, 0xC8, 0xA6, 0x65, 0xD2, 0xA5, 0xCF, 0xA3, 0xBB, 0x29, 0x71, 0x87,
+    0x8F, 0x02, 0xA0, 0x46, 0x3C, 0x8D, 0x70, 0x1A, 0xD1, 0x34, 0x82, 0x69, 0x86, 0xA5, 0x19, 0x94,
+    0x96, 0xDE, 0xB9, 0x73, 0x0B, 0x96, 0xA7, 0x08, 0x88, 0x3B, 0x7F, 0xE7, 0x4E, 0x84, 0x94, 0x25,
+    0xEE, 0x19, 0x26, 0x08, 0xBA, 0x3D, 0x65, 0x0A, 0x70, 0x14, 0x25, 0x7F, 0xCB, 0xDB, 0xCB, 0xFB,
+    0xD1, 0xFC, 0xE9, 0x50, 0xE2, 0xCD, 0x9B, 0xD7, 0x45, 0x61, 0x12, 0x7D, 0xD2, 0x71, 0x8C, 0x92,
+    0x56, 0xF1, 0x3C, 0x85, 0x66, 0xE4, 0xAA, 0x94, 0xB5, 0x6E, 0x9D, 0x65, 0xD1, 0xBB, 0x87, 0xA8,
+    0x12, 0x9A, 0x84, 0x22, 0xA1, 0x47, 0xA8, 0x11, 0x5A, 0x84, 0x12, 0xA1, 0x43, 0xA8, 0x10, 0x1A,
+    0x84, 0x02, 0xA1, 0x3F, 0xA8, 0x0F, 0xDA, 0x83, 0xF2, 0xA0, 0x3B, 0xA8, 0x0E, 0x9A, 0x83, 0xE2,
+    0xA8, 0x37, 0x8F, 0x80, 0x5A, 0x8C, 0xA7, 0x07, 0xB7, 0x08, 0x61, 0xF8, 0x67, 0xC6, 0x97, 0xF2,
+    0x9A, 0xD1, 0x1A, 0xB9, 0x44, 0xB1, 0x24, 0x28, 0x65, 0xC3, 0x62, 0x0E, 0x38, 0xE2, 0xA9, 0x53,
+    0x9E, 0x3B, 0x7F, 0xDB, 0xCB, 0x06, 0xC6, 0xFA, 0xA1, 0x25, 0x22, 0x40, 0xDB, 0xD3, 0x85, 0x4C,
+    0x66, 0xB6, 0xC2, 0x56, 0x12, 0xA7, 0x2C, 0x67, 0xBD, 0x04, 0x99, 0x73, 0x5F, 0x8E, 0x06, 0xD3,
+    0xDE, 0x7D, 0x80, 0xC9, 0xE5, 0xD0, 0xE0, 0x3D, 0xE6, 0xDB, 0x15, 0x33, 0x2E, 0xC2, 0xB0, 0xE6,
+    0x52, 0x7F, 0xBF, 0x34, 0x78, 0x4B, 0x12, 0x0D, 0x64, 0x1A, 0xEE, 0x9A, 0x26, 0x0A, 0xA5, 0xCE,
+    0xBF, 0x50, 0xA9, 0x1C, 0x88, 0x66, 0x93, 0xE5, 0x4C, 0x31, 0x18, 0x91, 0xBC, 0xEC, 0x41, 0xF5,
+    0x8E, 0x85, 0x6A, 0x30, 0xF9, 0x72, 0x34, 0x68, 0xE8, 0x96, 0xAF, 0xBA, 0x2C, 0xA6, 0x55, 0x96,
+    0xD1, 0x31, 0x1A, 0x66, 0xED, 0xEF, 0x9D, 0x06, 0x93, 0xF7, 0x42, 0x9A, 0x0A, 0x59, 0x94, 0xCC,
+    0xDE, 0xF4, 0x15, 0x79, 0x5B, 0x72, 0xFB, 0x40, 0xBB, 0x7A, 0xEA, 0x45, 0xF5, 0x90, 0xA9, 0x2E,
+    0x5D, 0x9D, 0xD4, 0x5F, 0x86, 0x06, 0x31, 0xE1, 0xB9, 0xC6, 0x3D, 0x05, 0xCA, 0xD3, 0xB5, 0xD4,
+    0xD8, 0x99, 0x5E, 0x20, 0xB1, 0x64, 0x18, 0x1E, 0x04, 0xBA, 0xD2, 0xC3, 0x45, 0x29, 0x4E, 0x72,
+    0xCD, 0xD3, 0xBB, 0x4F, 0xBA, 0x5A, 0x32, 0x98, 0x4E, 0x45, 0x3B, 0x4A, 0x76, 0x27, 0x2A, 0xA9,
+    0x7A, 0xCD, 0xA1, 0xB4, 0xCC, 0x68, 0x5A, 0x2D, 0x2C, 0x7B, 0xCD, 0x98, 0x14, 0x6F, 0xC8, 0xC7,
+    0x65, 0x14, 0xF2, 0xEF, 0xDC, 0x79, 0x87, 0xA0, 0x87, 0xFA, 0xE9, 0xC4, 0x7E, 0xF3, 0xC8, 0x26,
+    0x64, 0x90, 0x6E, 0xD0, 0xB6, 0xCA, 0xB6, 0xC8, 0x39, 0x45, 0x4E, 0x2B, 0xC8, 0x6D, 0xD6, 0x9F,
+    0xAD, 0x9D, 0xAD, 0xD8, 0xF3, 0x71, 0x60, 0x19, 0x57, 0x7A, 0x2C, 0xF4, 0xAC, 0xCE, 0xB3, 0x32,
+    0xCF, 0xAA, 0x3C, 0x2B, 0xF2, 0xAC, 0xC6, 0xB3, 0x12, 0x8F, 0x15, 0x9E, 0x15, 0x78, 0x56, 0xDF,
+    0x59, 0x79, 0x67, 0xD5, 0x9D, 0x15, 0x77, 0xAC, 0xED, 0xAC, 0xB4, 0xB3, 0xCA, 0xCE, 0x0A, 0x3B,
+    0xAB, 0xEB, 0xAC, 0xAC, 0xB3, 0xAA, 0x8E, 0x45, 0x9D, 0xD5, 0x74, 0xA1, 0xA4, 0xBB, 0x78, 0xF3,
+    0x06, 0xC4, 0xB0, 0x0D, 0xC2, 0x88, 0x13, 0xF7, 0x4D, 0xA6, 0x4D, 0xB0, 0x2D, 0xF1, 0x6E, 0x3D,
+    0x26, 0xEB, 0x6C, 0xB9, 0xB7, 0xF8, 0x27, 0xA1, 0xC6, 0x73, 0xEE, 0xB5, 0x3B, 0xEF, 0xBA, 0xB0,
+    0x10, 0xD1, 0xEE, 0xBB, 0x67, 0xB5, 0x64, 0x2D, 0x7E, 0xF3, 0x15, 0xD6, 0x84, 0xCA, 0x2C, 0xAF,
+    0xA8, 0x9F, 0x4A, 0x7D, 0x6E, 0xF7, 0x45, 0xB0, 0x88, 0x8A, 0xD2, 0x08, 0xC1, 0x8D, 0x37, 0xFD,
+    0x93, 0xA1, 0xCF, 0x78, 0xF6, 0xD3, 0x99, 0x26, 0x84, 0x8F, 0xFA, 0x29, 0x14, 0x9B, 0x67, 0x03,
+    0x35, 0x9C, 0xB9, 0xBF, 0xDD, 0x5A, 0x21, 0x9E, 0xFC, 0xCF, 0x56, 0x7D, 0xB6, 0xEA, 0xEC, 0x97,
+    0x1B, 0x3B, 0x2B, 0x5E, 0x59, 0xAB, 0x03, 0x47, 0x87, 0x5A, 0x06, 0xA8, 0xF9, 0x28, 0xA0, 0xA3,
+    0x6B, 0x7F, 0x96, 0x2E, 0x3D, 0x82, 0x24, 0xC1, 0xC3, 0x60, 0x9D, 0x22, 0xE0, 0x73, 0xD7, 0xAC,
+    0x9D, 0xA6, 0xD0, 0x60, 0xC5, 0x0A, 0x37, 0x59, 0xF9, 0xAE, 0x87, 0x84, 0x00, 0x56, 0xF1, 0x98,
+    0x9D, 0x81, 0x4F, 0xE1, 0xEC, 0x28, 0x40, 0xB7, 0x6B, 0x0F, 0xDC, 0x66, 0x24, 0x2C, 0x1C, 0xC0,
+    0x4D, 0x83, 0x67, 0x81, 0x20, 0x01, 0xAA, 0x05, 0x9C, 0xB8, 0xAE, 0xE6, 0x2A, 0x7B, 0x1B, 0x6B,
+    0x05, 0x1C, 0xFF, 0x64, 0xBC, 0x9D, 0x76, 0x23, 0x1B, 0x7C, 0xAB, 0xD9, 0x38, 0xDA, 0x1E, 0x36,
+    0xA8, 0x20, 0x88, 0x6E, 0x4F, 0x70, 0x52, 0xD4, 0xAA, 0x9A, 0xD3, 0x71, 0x97, 0xAA, 0xD1, 0x94,
+    0xEB, 0xC3, 0xBF, 0xFE, 0x44, 0x55, 0xD4, 0x8A, 0x1A, 0x9A, 0x56, 0x2A, 0xE1, 0xD4, 0x1C, 0x29,
+    0x7C, 0x29, 0xF1, 0x3F, 0x14, 0xB0, 0xF0, 0xB3, 0x22, 0x84, 0x72, 0x21, 0xEF, 0x98, 0xAB, 0xBE,
+    0x25, 0x00, 0xA9, 0xBA, 0xFF, 0x6D, 0x64, 0x55, 0x3A, 0x9E, 0xC0, 0x63, 0x37, 0x6F, 0x5B, 0xD3,
+    0xAF, 0xB5, 0x8E, 0x5F, 0x4B, 0x58, 0x63, 0xA4, 0x33, 0x67, 0x15, 0x56, 0xF5, 0xB3, 0x57, 0x17,
+    0xEE, 0xC7, 0x52, 0x8A, 0x5F, 0x2E, 0x36, 0x07, 0x62, 0x51, 0xE3, 0x26, 0xD3, 0xDA, 0x27, 0x15,
+    0x29, 0x76, 0xD6, 0xD2, 0x3C, 0x77, 0x6A, 0xDE, 0x0C, 0x6F, 0x25, 0x83, 0x5D, 0xB7, 0xC8, 0x94,
+    0x96, 0x22, 0xF3, 0x1F, 0x19, 0x5B, 0xAD, 0x5D, 0x5B, 0xA1, 0x43, 0xEE, 0xFE, 0xD4, 0x5A, 0xD1,
+    0x1E, 0x07, 0x67, 0x8F, 0x97, 0x74, 0x9C, 0x00, 0x82, 0xDB, 0x16, 0x9F, 0x53, 0xAD, 0xD5, 0xC2,
+    0x25, 0x37, 0x6F, 0x2A, 0x74, 0x20, 0xF3, 0x00, 0x90, 0x70, 0xB8, 0x63, 0xC3, 0x6E, 0xE5, 0xFB,
+    0x76, 0x32, 0x5C, 0x3C, 0xFC, 0x44, 0x3F, 0x20, 0xCA, 0xD6, 0x8F, 0x5F, 0x6C, 0xFE, 0x95, 0x40,
+    0x42, 0x8B, 0xBE, 0x97, 0x76, 0x93, 0x34, 0x30, 0xD5, 0xE8, 0xF6, 0x8E, 0x2C, 0xE7, 0x3E, 0x0E,
+    0xFB, 0x0A, 0x3F, 0x6F, 0x41, 0x05, 0xDA, 0xE0, 0x95, 0x17, 0x1F, 0xA0, 0x55, 0xF9, 0xB3, 0xE1,
+    0x9B, 0xC8, 0x5B, 0x3A, 0x04, 0x1E, 0x20, 0xBE, 0xB2, 0x33, 0x1B, 0x62, 0x47, 0x0D, 0x01, 0xA3,
+    0x8E, 0x00, 0x31, 0x08, 0x33, 0x0B, 0xC5, 0x9A, 0xB5, 0xF4, 0x67, 0xE3, 0x1B, 0x06, 0x9A, 0x12,
+    0xB3, 0x32, 0xF0, 0x7E, 0x66, 0x3E, 0xEC, 0x54, 0x2A, 0x54, 0xFD, 0xE6, 0xBA, 0x99, 0x60, 0xCD,
+    0x99, 0xA9, 0x14, 0xBA, 0xF7, 0xD5, 0x66, 0x66, 0x64, 0x2C, 0x95, 0xE8, 0x01, 0xCB, 0xFB, 0xCF,
+    0xBF, 0x3F, 0xDC, 0x96, 0x3B, 0x97, 0x6A, 0xD2, 0x32, 0x81, 0x74, 0x8D, 0x8B, 0xA8, 0xBB, 0x90,
+    0xB5, 0x1F, 0xF6, 0xF8, 0x34, 0xAC, 0xF7, 0xD0, 0x77, 0x05, 0xD3, 0xD6, 0xDD, 0x86, 0xF5, 0xF3,
+    0xD6, 0x5B, 0xA2, 0xAC, 0x6F, 0xD1, 0xC4, 0xAB, 0xCD, 0xD9, 0x6C, 0xFA, 0x49, 0x52, 0xAA, 0x1A,
+    0x35, 0x9A, 0xDA, 0x3D, 0x3E, 0x5E, 0xF5, 0xBF, 0x9B, 0x52, 0xBF, 0x47, 0xA4, 0xE5, 0xB2, 0x7B,
+    0x33, 0x8A, 0x07, 0xF9, 0xFD, 0x05, 0xDB, 0xA6, 0x10, 0x44, 0x36, 0x9C, 0x46, 0x5A, 0xBE, 0x12,
+    0x56, 0xC0, 0x1E, 0x54, 0x18, 0x3E, 0x87, 0x15, 0x00, 0x9E, 0x24, 0x05, 0x88, 0x4A, 0xA9, 0x8C,
+    0xFD, 0x53, 0x1A, 0x52, 0x5E, 0x98, 0x1C, 0xF2, 0xED, 0x43, 0x98, 0x3E, 0x8A, 0xBE, 0x6A, 0x1A,
+    0xA8, 0xF8, 0x6B, 0x85, 0xCE, 0xE0, 0x02, 0x64, 0x37, 0x60, 0x60, 0x0B, 0x23, 0x96, 0xD4, 0xAC,
+    0xB2, 0x8F, 0x89, 0xC4, 0x66, 0xD6, 0xEC, 0x05, 0x06, 0xA0, 0x09, 0xA0, 0x55, 0x02, 0x1B, 0x8E,
+    0x20, 0x5D, 0x89, 0xB9, 0xB0, 0x31, 0x99, 0x6D, 0xC8, 0xA4, 0x99, 0x7D, 0x0A, 0x8C, 0xC5, 0xE5,
+    0x0F, 0xEE, 0x13, 0x14, 0x1B, 0x0C, 0x97, 0x5D, 0xE7, 0xEC, 0xE6, 0x93, 0x91, 0x26, 0x56, 0x91,
+    0x59, 0x2B, 0x9A, 0x76, 0x67, 0x20, 0x25, 0xDA, 0x14, 0xE6, 0xD2, 0x02, 0x5F, 0x6F, 0x49, 0x5C,
+    0x49, 0x1C, 0x22, 0xF0, 0xDA, 0x5C, 0x09, 0x23, 0xE2, 0x7E, 0x13, 0xAE, 0xFB, 0x96, 0xFB, 0x0B,
+    0x64, 0x03, 0x7A, 0x9B, 0x37, 0x31, 0xD7, 0x0A, 0x48, 0x41, 0xB9, 0x9B, 0x0C, 0x58, 0x44, 0x91,
+    0xDC, 0xB9, 0x0D, 0x93, 0x59, 0x4D, 0xBB, 0x85, 0xD1, 0x87, 0xAD, 0x21, 0xAE, 0x62, 0x1E, 0x61,
+    0xC5, 0x40, 0x80, 0xE4, 0x58, 0x8D, 0xCA, 0x34, 0x99, 0xAB, 0x99, 0x22, 0xB4, 0x0F, 0x9A, 0x65,
+    0x88, 0x2D, 0x5D, 0x83, 0xF2, 0x36, 0x10, 0x85, 0x12, 0x6B, 0x36, 0x40, 0x30, 0xD7, 0x68, 0x07,
+    0xFC, 0x37, 0xBA, 0xF5, 0xE8, 0xC0, 0xE6, 0x3B, 0xB4, 0xCA, 0x56, 0x44, 0x86, 0x81, 0x13, 0x2F,
+    0x34, 0xD6, 0x94, 0x3D, 0x38, 0x87, 0x00, 0x65, 0x35, 0xA5, 0x47, 0x9B, 0xAC, 0xF9, 0x58, 0xA5,
+    0x9C, 0x6F, 0xF6, 0x43, 0xF0, 0x57, 0x1A, 0xE8, 0x9D, 0xDF, 0x8A, 0xFA, 0x64, 0xE9, 0x3A, 0xEE,
+    0xD2, 0x99, 0x05, 0x5B, 0x47, 0x69, 0x76, 0x72, 0xDD, 0x4D, 0x3A, 0xF2, 0x2D, 0x23, 0xC6, 0xD3,
+    0xC1, 0xE0, 0x5E, 0x0D, 0x96, 0x00, 0x7B, 0x81, 0xF5, 0x02, 0xEA, 0x05, 0xD2, 0x0B, 0xA0, 0x17,
+    0x38, 0x2F, 0x60, 0x5E, 0xA0, 0xBC, 0x00, 0x79, 0x81, 0xF1, 0x02, 0xE2, 0x05, 0xC2, 0x0B, 0x80,
+    0x17, 0xF8, 0x2E, 0x2C, 0x91, 0xE8, 0x2E, 0x62, 0x22, 0x72, 0x53, 0xF8, 0x8E, 0xAD, 0xEF, 0x76,
+    0x61, 0x07, 0xF0, 0x6C, 0x77, 0x43, 0xB5, 0x00, 0xC6, 0x0D, 0xED, 0x9E, 0x9B, 0x3B, 0xB3, 0xC4,
+    0x44, 0xFC, 0xA0, 0xFB, 0x5A, 0x69, 0x41, 0x69, 0x90, 0x0E, 0x0E, 0x91, 0x64, 0x9E, 0x4C, 0x45,
+    0xBA, 0x1F, 0x81, 0x5E, 0x79, 0x15, 0x5E, 0xAF, 0x7C, 0x65, 0x15, 0x80, 0xFC, 0x7C, 0x9C, 0x60,
+    0xFC, 0xC9, 0x95, 0xCE, 0xC0, 0xD3, 0x13, 0xE7, 0x2C, 0x6B, 0xD3, 0xD4, 0x73, 0xE1, 0x8A, 0xB7,
+    0x6F, 0x8A, 0x03, 0x7F, 0x1E, 0x6E, 0xF3, 0xDB, 0xE6, 0x34, 0x8B, 0x96, 0x19, 0xAC, 0x47, 0xE6,
+    0x2C, 0x5C, 0xCC, 0x27, 0x99, 0x22, 0x3D, 0xD4, 0x98, 0xC2, 0x17, 0xD6, 0x13, 0x4F, 0x93, 0x1D,
+    0xAF, 0x64, 0xB0, 0x63, 0x82, 0xE3, 0x1C, 0x7F, 0x6F, 0x48, 0xE4, 0xAB, 0xD1, 0xC1, 0xE8, 0x55,
+    0x97, 0xD5, 0x4A, 0xFB, 0xD5, 0xC5, 0xF8, 0xF3, 0x11, 0x8C, 0xC3, 0x75, 0x04, 0x32, 0x31, 0x5C,
+    0x1C, 0xE3, 0xFE, 0xD7, 0x20, 0x93, 0x39, 0x1C, 0x26, 0xC3, 0x04, 0x83, 0xC4, 0x3E, 0x19, 0x54,
+    0x54, 0x26, 0x3E, 0x6B, 0x86, 0x63, 0x8E, 0x80, 0x2C, 0x2B, 0x39, 0xD2, 0x64, 0x59, 0x91, 0x91,
+    0xEF, 0x10, 0xE2, 0xB0, 0x65, 0x20, 0x4A, 0xA4, 0xE4, 0xA9, 0xF4, 0x7B, 0xAB, 0x73, 0x4C, 0x96,
+    0x5F, 0x1F, 0x23, 0x9A, 0x2D, 0x93, 0x07, 0x5A, 0x0D, 0x0B, 0xA5, 0x2C, 0x3A, 0x86, 0x7E, 0xDE,
+    0x1F, 0x20, 0x7F, 0x78, 0x13, 0x7E, 0xF9, 0x43, 0x18, 0x6A, 0x07, 0x7E, 0x60, 0xB3, 0x40, 0xFC,
+    0xC4, 0x66, 0x4A, 0xBA, 0x13, 0x0F, 0xA4, 0xFD, 0x68, 0xF2, 0xFD, 0x65, 0xE4, 0xFB, 0xB7, 0x91,
+    0xEF, 0xDF, 0xDF, 0x99, 0xEC, 0xF5, 0x1F, 0x9E, 0x69, 0x29, 0xC6, 0xCC, 0x9B, 0xB3, 0xFC, 0x9B,
+    0x47, 0x86, 0x89, 0x28, 0x58, 0x9C, 0x25, 0x13, 0xED, 0xA6, 0x4E, 0x66, 0xB2, 0x8D, 0x3A, 0x99,
+    0x9B, 0x33, 0x37, 0x99, 0x2E, 0x59, 0x0D, 0x51, 0x71, 0xFC, 0x35, 0x3B, 0xF7, 0x0B, 0x65, 0xE7,
+    0x7A, 0x0E, 0xAE, 0xAF, 0x6E, 0x03, 0x8F, 0xC4, 0x18, 0xB8, 0xCE, 0x4D, 0x04, 0x5C, 0x17, 0xF3,
+    0x6F, 0xF7, 0xE9, 0xB7, 0x31, 0xFB, 0x36, 0x22, 0xDF, 0xC6, 0xDC, 0xDB, 0x98, 0x7A, 0x1B, 0x33,
+    0x6F, 0x63, 0xE2, 0x6D, 0xCC, 0xBB, 0x8D, 0x69, 0xB7, 0x31, 0xEB, 0x36, 0x26, 0xDD, 0xC6, 0x9C,
+    0xDB, 0x98, 0x72, 0x1B, 0x33, 0x6E, 0x63, 0xC2, 0x6D, 0xCC, 0xB7, 0x8D, 0xE9, 0xB6, 0x31, 0xDB,
+    0x36, 0x26, 0xDB, 0x46, 0x5C, 0xDB, 0x98, 0x6A, 0xBB, 0xC7, 0xB4, 0x55, 0xA2, 0xAD, 0x97, 0x61,
+    0x1B, 0xA2, 0x5F, 0x7D, 0x86, 0x3C, 0xF3, 0xD0, 0xB3, 0x89, 0x64, 0xB5, 0xDB, 0x27, 0xD8, 0x4E,
+    0xFC, 0xDA, 0x89, 0x5E, 0x3B, 0xB1, 0x6B, 0x03, 0xB9, 0x76, 0xE2, 0xD6, 0x4E, 0xD4, 0xDA, 0x89,
+    0x59, 0x3B, 0x11, 0x6B, 0x27, 0x5E, 0xED, 0x44, 0xAB, 0x9D, 0x58, 0xB5, 0x13, 0xA9, 0x76, 0xE2,
+    0xD4, 0x4E, 0x94, 0xDA, 0x89, 0x51, 0x3B, 0x11, 0x6A, 0x27, 0x3E, 0xED, 0x44, 0xA7, 0x9D, 0xD8,
+    0xB4, 0x11, 0x99, 0xF6, 0x46, 0xCC, 0xE8, 0x47, 0xF7, 0x66, 0xC2, 0xC0, 0xDA, 0x68, 0xE9, 0x3E,
+    0xCE, 0xF6, 0xD6, 0x99, 0x74, 0x4F, 0x59, 0x31, 0xE7, 0x5E, 0xAB, 0x23, 0x95, 0x1B, 0x13, 0xC7,
+    0x57, 0x31, 0x7C, 0xC9, 0x78, 0x6C, 0x17, 0xDC, 0xD3, 0x5C, 0xCC, 0x69, 0x31, 0x46, 0x3A, 0x0C,
+    0xEA, 0x31, 0xE3, 0xC4, 0x20, 0x77, 0xB2, 0xA4, 0xB7, 0x09, 0xBC, 0x6A, 0x74, 0x27, 0x8C, 0xE2,
+    0xDB, 0x4D, 0x1B, 0x67, 0x9C, 0x28, 0x68, 0x43, 0x90, 0xA8, 0x7A, 0x1B, 0xC3, 0xBB, 0xD4, 0x23,
+    0x58, 0xD7, 0x26, 0x38, 0xF0, 0xC9, 0x7D, 0x5B, 0xA8, 0x1F, 0x37, 0x00, 0xFB, 0x81, 0x6E, 0xAD,
+    0x71, 0x9A, 0x93, 0xCB, 0xA2, 0xC1, 0xC7, 0x5C, 0x8B, 0xF7, 0x38, 0x93, 0x1D, 0x18, 0x5B, 0x02,
+    0x3E, 0x46, 0xFE, 0x37, 0xF6, 0x0C, 0x8F, 0x7F, 0xEC, 0xC5, 0x72, 0x5A, 0x17, 0xC8, 0x2F, 0x83,
+    0xAD, 0xA7, 0x6A, 0x31, 0xB7, 0x0E, 0x98, 0x6B, 0x88, 0x28, 0xF3, 0x3E, 0xB7, 0xBA, 0xCE, 0x15,
+    0xBF, 0x85, 0x04, 0x14, 0x59, 0x4B, 0xC7, 0xC9, 0x2D, 0x9C, 0x3B, 0x1D, 0xC0, 0xC7, 0x4D, 0xAA,
+    0x5A, 0x4B, 0xC6, 0x4D, 0x89, 0x37, 0xE5, 0x1B, 0x51, 0x8A, 0x76, 0x6A, 0x3E, 0x5D, 0xC3, 0x4D,
+    0xCF, 0x1E, 0xB4, 0x88, 0x7B, 0x4A, 0x2C, 0x54, 0x57, 0x5D, 0x6C, 0xA7, 0xC7, 0xB9, 0x74, 0xF4,
+    0x8F, 0x77, 0x61, 0xFA, 0x4B, 0x9B, 0xFB, 0x22, 0x4C, 0x9C, 0xB3, 0x36, 0x1E, 0x97, 0x4E, 0x5B,
+    0xE7, 0x6B, 0xD2, 0x46, 0x52, 0x66, 0x1E, 0x5B, 0x97, 0x95, 0xDB, 0xD3, 0x15, 0x73, 0x0B, 0x93,
+    0x0D, 0xC9, 0xDA, 0xA9, 0x05, 0x47, 0x04, 0x04, 0xA6, 0x6A, 0xEA, 0xB1, 0x67, 0x4C, 0xBC, 0x56,
+    0xCC, 0x3B, 0x0B, 0x5B, 0x61, 0x61, 0xF5, 0xBD, 0xE7, 0xB3, 0x79, 0xF8, 0xB3, 0xDA, 0x1F, 0xDB,
+    0xD3, 0x6C, 0x6F, 0x73, 0xAF, 0xAF, 0x5B, 0xFC, 0xEA, 0xA6, 0x67, 0x4D, 0xBE, 0xD5, 0xEE, 0xF3,
+    0xF3, 0x02, 0x27, 0x32, 0x0D, 0xF1, 0xED, 0xD8, 0x9F, 0xBC, 0xE8, 0x4F, 0x9E, 0x79, 0x24, 0xFC,
+    0x4B, 0x56, 0x6A, 0xE0, 0xA4, 0x06, 0x46, 0x6A, 0xC4, 0x47, 0x0D, 0x6C, 0xD4, 0xC0, 0x45, 0x0D,
+    0x4C, 0x54, 0xA3, 0x11, 0x07, 0x0E, 0x71, 0x20, 0x10, 0x7B, 0x06, 0x6A, 0xE0, 0x9F, 0x06, 0xF6,
+    0x69, 0xE0, 0x9E, 0x06, 0xE6, 0x69, 0xE0, 0x9D, 0x06, 0xD6, 0x69, 0xE0, 0x9C, 0x06, 0xC6, 0x69,
+    0xE0, 0x9B, 0x06, 0xB6, 0x69, 0xE0, 0x9A, 0x06, 0xA6, 0x69, 0xE0, 0x99, 0x06, 0x96, 0x69, 0x20,
+    0x04, 0x07, 0x36, 0xB0, 0xB6, 0x39, 0x22, 0x91, 0x33, 0xE5, 0x63, 0xE7, 0x82, 0xE9, 0xAE, 0x04,
+    0x9D, 0x53, 0x3E, 0x8A, 0x80, 0x2A, 0x19, 0x9E, 0xA4, 0x77, 0x92, 0xDB, 0x49, 0x62, 0x27, 0x59,
+    0x9D, 0xA4, 0x74, 0x92, 0xCF, 0x49, 0x32, 0xA7, 0x71, 0x94, 0xD6, 0x8F, 0xA0, 0x92, 0x63, 0x8F,
+    0xED, 0x51, 0x60, 0xAA, 0x9A, 0x74, 0xCD, 0x1A, 0x5C, 0xCD, 0xBA, 0xB2, 0xAE, 0x71, 0x48, 0x71,
+    0x6D, 0x6B, 0x9B, 0x83, 0x37, 0x8B, 0x39, 0x8E, 0x1A, 0x14, 0x7E, 0x2F, 0x35, 0x74, 0xBD, 0x27,
+    0x1F, 0x1A, 0x0C, 0xCF, 0x77, 0x80, 0x4C, 0x91, 0x2E, 0x0A, 0x96, 0x2D, 0x73, 0xDF, 0xA9, 0x8C,
+    0xE0, 0xC5, 0xEA, 0x61, 0xAD, 0x9A, 0x5F, 0x12, 0xF3, 0xFF, 0x01, 0xAE, 0x39, 0xA7, 0x57, 0xBF,
+    0xC2, 0xA9, 0x6C, 0xD8, 0xA3, 0xC1, 0x73, 0x01, 0xA2, 0xE5, 0x47, 0xF7, 0x68, 0x46, 0xF6, 0x68,
+    0x56, 0xEC, 0xD1, 0x2C, 0xD8, 0x9C, 0xA1, 0xFB, 0x28, 0xB9, 0x94, 0x33, 0xCD, 0x99, 0x6F, 0x45,
+    0xCD, 0x19, 0xD3, 0x18, 0x8B, 0x26, 0xCE, 0x80, 0x61, 0x85, 0x51, 0xE5, 0x08, 0x2F, 0xFE, 0x62,
+    0x7A, 0x30, 0xEE, 0xDA, 0x9F, 0x83, 0x2D, 0x0E, 0xC3, 0xBA, 0x0B, 0xD1, 0xBC, 0x81, 0xE3, 0xB5,
+    0x4B, 0xB0, 0x27, 0xEC, 0xAD, 0xE4, 0x9D, 0x27, 0xAF, 0x75, 0xE3, 0xD2, 0xD0, 0x7E, 0x9B, 0x9E,
+    0xF5, 0x2A, 0x03, 0x61, 0xB9, 0xAA, 0xCF, 0x6C, 0xEF, 0x74, 0xE9, 0xBE, 0x6E, 0xEC, 0x7C, 0x9E,
+    0xC6, 0x8E, 0xDF, 0xF4, 0x81, 0xDD, 0xEF, 0x69, 0xCE, 0x65, 0x98, 0xB6, 0xBF, 0xF3, 0x43, 0x1A,
+    0x9B, 0x5F, 0xC1, 0xC6, 0x8F, 0xE5, 0xA1, 0x96, 0xFF, 0x59, 0x58, 0xD9, 0xC5, 0xBD, 0xDB, 0xBC,
+    0xB5, 0xC0, 0x60, 0xFE, 0x65, 0x86, 0xA7, 0x10, 0x87, 0x82, 0x2A, 0xD9, 0x3D, 0x04, 0xD4, 0xCA,
+    0x46, 0x80, 0x5A, 0x79, 0x07, 0x50, 0xEB, 0x79, 0x82, 0x5A, 0x57, 0x08, 0x6A, 0xAD, 0x01, 0x6A,
+    0xA5, 0x4B, 0x80, 0x5A, 0xB3, 0x1E, 0xA0, 0x56, 0x41, 0x50, 0xEB, 0x2A, 0x41, 0xAD, 0xBB, 0x00,
+    0xB5, 0x92, 0x15, 0x40, 0xAD, 0xAC, 0x07, 0xA8, 0x85, 0xBA, 0xAE, 0xEA, 0x9F, 0x27, 0xA8, 0x75,
+    0x85, 0xA0, 0x16, 0x58, 0x84, 0xF3, 0x7F, 0x59, 0x02, 0xD4, 0xFA, 0x35, 0x80, 0x90, 0x82, 0xB9,
+    0xFC, 0x6C, 0x17, 0x83, 0x5A, 0xC9, 0x08, 0x50, 0x2B, 0xFB, 0x77, 0x26, 0x0A, 0x35, 0x28, 0xA7,
+    0xDF, 0x98, 0x36, 0xD3, 0x7B, 0x53, 0x72, 0x6C, 0xCF, 0x26, 0x62, 0xC5, 0x68, 0x35, 0x24, 0xAB,
+    0x58, 0xCB, 0x1A, 0x79, 0x92, 0x1B, 0x05, 0x6A, 0x9E, 0xBF, 0x51, 0x52, 0xA8, 0x3A, 0x81, 0x12,
+    0xEB, 0x6A, 0x94, 0x28, 0xE1, 0x40, 0x39, 0x14, 0x43, 0xBC, 0x3C, 0xEA, 0xDC, 0xDE, 0x50, 0xCF,
+    0x20, 0x01, 0x4F, 0xB4, 0x9B, 0xF5, 0x7A, 0x2C, 0x6A, 0xC5, 0xA9, 0x2E, 0xCB, 0xBC, 0xCA, 0xE5,
+    0x1B, 0xA2, 0xE8, 0xF2, 0x57, 0x2B, 0x65, 0xA7, 0xFE, 0x47, 0x2F, 0x77, 0x2F, 0xEE, 0xD7, 0xEA,
+    0x37, 0x06, 0x84, 0x00, 0x10, 0x54, 0xC5, 0x64, 0x35, 0xCB, 0x18, 0xDF, 0x97, 0x9B, 0x14, 0x87,
+    0xAA, 0xE1, 0xCB, 0x40, 0x6A, 0xDE, 0xF0, 0x33, 0x7F, 0x8F, 0xCA, 0x1B, 0xED, 0x99, 0xAD, 0xEF,
+    0x13, 0xEE, 0xE8, 0xE1, 0xCE, 0x67, 0xCB, 0x39, 0xE7, 0x4F, 0x54, 0xE6, 0x42, 0x52, 0x3F, 0x4D,
+    0xBC, 0x8A, 0xF7, 0x94, 0x22, 0xE5, 0x3A, 0x4C, 0xA4, 0x6A, 0x71, 0xAF, 0xBE, 0x81, 0xC9, 0xC2,
+    0xD5, 0xAF, 0x91, 0x19, 0x5C, 0x88, 0x36, 0xE7, 0x93, 0xE1, 0xBA, 0x0F, 0x36, 0x46, 0x7E, 0x62,
+    0xD5, 0x01, 0x38, 0x21, 0x59, 0x21, 0xFE, 0x64, 0x7D, 0xB2, 0x64, 0xB5, 0x57, 0x3F, 0x1D, 0x4C,
+    0x89, 0x83, 0x13, 0x3A, 0x6D, 0xDD, 0x4B, 0x1D, 0x56, 0xBA, 0xD6, 0x28, 0x24, 0x01, 0x76, 0x85,
+    0x0D, 0xF5, 0x44, 0xE9, 0x26, 0x79, 0x97, 0x5B, 0x69, 0x60, 0x8E, 0xDC, 0x50, 0x62, 0x25, 0x2C,
+    0x4B, 0x94, 0xC0, 0x9E, 0xD7, 0x8A, 0x78, 0xEE, 0x85, 0xE4, 0xE1, 0x21, 0xB4, 0x65, 0xFC, 0x6C,
+    0xC1, 0x56, 0xB7, 0xB2, 0xA1, 0xA4, 0x4F, 0x2D, 0x58, 0xB1, 0x95, 0xAC, 0x1B, 0x9E, 0x3F, 0x55,
+    0xA9, 0x05, 0xAC, 0xD7, 0x17, 0x6A, 0x53, 0x65, 0x36, 0x10, 0x69, 0xDE, 0x4D, 0x61, 0xA8, 0x38,
+    0x3D, 0x2C, 0xE3, 0xC8, 0x3F, 0xEF, 0x43, 0xA5, 0x70, 0x1B, 0x5A, 0x52, 0x83, 0x92, 0x39, 0xA8,
+    0x79, 0x75, 0xD4, 0xE0, 0x88, 0x38, 0xC6, 0xC7, 0x2D, 0xED, 0x61, 0x4B, 0x5B, 0x3A, 0x16, 0x8E,
+    0x65, 0x63, 0xD1, 0x58, 0x32, 0x17, 0x3C, 0x2D, 0xD7, 0x22, 0x9B, 0xDC, 0x17, 0x31, 0x4D, 0x02,
+    0x9A, 0x3B, 0xC5, 0x07, 0xAB, 0x2D, 0x88, 0x21, 0x82, 0x69, 0xF8, 0x42, 0xEC, 0x42, 0xE0, 0x7A,
+    0xDB, 0x3F, 0x75, 0xB1, 0xC7, 0x36, 0x9B, 0x6B, 0x98, 0x42, 0x8C, 0x42, 0x80, 0x62, 0x74, 0x32,
+    0x38, 0x9A, 0x06, 0x24, 0x16, 0xC4, 0xAA, 0x98, 0x9B, 0x05, 0x36, 0xA4, 0x8C, 0xD2, 0x33, 0x9B,
+    0xE5, 0xAB, 0xAC, 0x03, 0x0B, 0x3F, 0x15, 0x72, 0xE0, 0x4E, 0x1F, 0x98, 0xD5, 0x2C, 0xA6, 0x97,
+    0xBD, 0x12, 0x2D, 0xF1, 0xB1, 0x8A, 0x1F, 0x0E, 0x16, 0xFE, 0x15, 0x61, 0xA5, 0xE8, 0xDF, 0x42,
+    0x48, 0xA9, 0x8D, 0xC5, 0x7B, 0xE1, 0x94, 0x97, 0x2A, 0x4C, 0xF0, 0xB5, 0x01, 0x17, 0x4D, 0xEB,
+    0x53, 0x89, 0x2E, 0x3C, 0xCD, 0x33, 0x78, 0x51, 0x43, 0xD0, 0xFC, 0x76, 0x01, 0xFF, 0x15, 0x03,
+    0x84, 0xFD, 0xF9, 0xD8, 0xE7, 0x74, 0x58, 0x7A, 0xB1, 0xCE, 0xFB, 0x40, 0x4E, 0x0C, 0x6B, 0x40,
+    0x76, 0x38, 0xD6, 0x06, 0x19, 0x00, 0x2C, 0xB8, 0x93, 0xBE, 0xE3, 0x9A, 0x97, 0x25, 0x9C, 0xF6,
+    0x12, 0xF6, 0x97, 0x95, 0x9A, 0x6F, 0xEF, 0x8E, 0x45, 0xF2, 0xCF, 0x46, 0x93, 0xFD, 0x42, 0x9E,
+    0xDC, 0x49, 0x4F, 0xBC, 0xA7, 0xEB, 0x74, 0xFD, 0x6A, 0xA3, 0x74, 0x73, 0xF5, 0xA9, 0xEA, 0xF0,
+    0xC9, 0x10, 0x93, 0x06, 0x93, 0x44, 0x4E, 0xB2, 0x41, 0x5B, 0xD8, 0xA5, 0xFB, 0xA6, 0xCB, 0x35,
+    0xB7, 0xFB, 0x82, 0x9F, 0x6D, 0x7A, 0x8D, 0x25, 0x4B, 0xF5, 0x13, 0x3A, 0x56, 0x9F, 0xA3, 0xA0,
+    0x54, 0x49, 0xD7, 0x6C, 0x7B, 0x1C, 0x93, 0xFB, 0xF8, 0x8C, 0x7B, 0xCA, 0x9A, 0xA8, 0x7C, 0xC4,
+    0x29, 0xDA, 0x51, 0x3F, 0xF1, 0x3B, 0x2A, 0xD3, 0x1D, 0xE5, 0xF6, 0x76, 0xD4, 0xE3, 0x6A, 0x90,
+    0x1A, 0x08, 0xF0, 0xB0, 0x9C, 0x24, 0x0D, 0x39, 0xC9, 0xE2, 0x4C, 0x4E, 0xF2, 0x34, 0x3C, 0x6D,
+    0xF6, 0xB9, 0xBD, 0xED, 0xE3, 0xD2, 0x02, 0xF3, 0x59, 0x4B, 0x68, 0xFD, 0x2E, 0x81, 0x89, 0x78,
+    0x23, 0x31, 0x33, 0xD9, 0x77, 0xBD, 0x71, 0x77, 0x50, 0x43, 0x1F, 0x1E, 0x52, 0xEB, 0x2F, 0x61,
+    0xE9, 0x6D, 0x3A, 0x84, 0xEF, 0x03, 0x51, 0x17, 0x63, 0xF0, 0xA5, 0xFA, 0x84, 0x01, 0x7F, 0x48,
+    0x58, 0x26, 0xA5, 0x36, 0x6C, 0x7D, 0x6F, 0x4A, 0xC5, 0x23, 0x33, 0x51, 0x85, 0xCC, 0x86, 0xF7,
+    0x07, 0x80, 0xEE, 0xB8, 0x72, 0xB1, 0x2A, 0x39, 0x98, 0xEB, 0x01, 0xFA, 0x50, 0x82, 0xC8, 0x22,
+    0x8B, 0xE4, 0x97, 0x92, 0xF4, 0xF0, 0x5C, 0x55, 0x9B, 0x18, 0xE0, 0x3B, 0xD2, 0x0D, 0x01, 0x3F,
+    0x45, 0x2B, 0xEE, 0xF5, 0xF1, 0xBF, 0xDC, 0x7C, 0xA3, 0xA1, 0xCF, 0x1D, 0x6C, 0xA5, 0xFE, 0x7C,
+    0xA1, 0xD6, 0xAF, 0x5B, 0xD2, 0x66, 0x98, 0xBA, 0x96, 0x7B, 0x19, 0xC0, 0xC4, 0x8D, 0xD6, 0x9D,
+    0x57, 0xD5, 0x7B, 0x4C, 0x80, 0xE4, 0x0D, 0x57, 0x0D, 0xB3, 0xD1, 0x5D, 0xDA, 0x69, 0x7B, 0x69,
+    0xF7, 0x92, 0xC8, 0x74, 0xAB, 0xA2, 0xD9, 0x49, 0x59, 0x88, 0xCE, 0x00, 0xBE, 0x61, 0x89, 0x5F,
+    0x3C, 0xF0, 0x30, 0x97, 0xB9, 0xF4, 0xED, 0x5B, 0x1C, 0x50, 0xCF, 0xCF, 0x83, 0xB7, 0x84, 0x23,
+    0xAA, 0x7C, 0xD6, 0xCD, 0xC7, 0xF3, 0x9B, 0xC1, 0xBA, 0x4F, 0x35, 0x10, 0x09, 0xD4, 0xC1, 0xB3,
+    0x1A, 0xE8, 0xE3, 0x7E, 0xE6, 0xF1, 0x95, 0x15, 0xBF, 0xF8, 0xFA, 0xD6, 0x68, 0x1B, 0xC5, 0x03,
+    0xA0, 0xB7, 0x47, 0x0A, 0x97, 0xBE, 0xA8, 0x76, 0xF6, 0xD8, 0x25, 0x0F, 0x5B, 0x70, 0xB4, 0x06,
+    0x67, 0xF6, 0x60, 0x16, 0xA1, 0x6F, 0x61, 0x85, 0xDE, 0x5E, 0x25, 0xD6, 0xF9, 0xCC, 0xD3, 0xF8,
+    0x4C, 0x5E, 0xFA, 0xCE, 0x0B, 0xAD, 0xFA, 0x16, 0xF9, 0xD3, 0x4E, 0x83, 0x6E, 0x95, 0x2A, 0xC0,
+    0xD0, 0x1E, 0xEB, 0x64, 0xB4, 0xE8, 0xFA, 0xB2, 0x1E, 0xE1, 0xF2, 0x15, 0x28, 0xD1, 0x41, 0x4D,
+    0x1D, 0x00, 0x0C, 0x95, 0x84, 0xF4, 0x80, 0x18, 0xC7, 0x39, 0xC4, 0xD3, 0xF1, 0x7C, 0x16, 0xDC,
+    0x80, 0x3A, 0x69, 0xB8, 0x00, 0x38, 0x80, 0x5C, 0xB7, 0xFF, 0xE9, 0x78, 0xF8, 0x58, 0x1F, 0x85,
+    0x64, 0xE4, 0xD5, 0x32, 0x7A, 0xBC, 0xAF, 0x9D, 0xA7, 0xB5, 0x6E, 0x3F, 0xFD, 0x96, 0x07, 0x7C,
+    0xD3, 0x46, 0x85, 0xFA, 0x77, 0x8E, 0xEE, 0xE3, 0xB3, 0x1E, 0xCC, 0x23, 0xA2, 0x6A, 0x8F, 0xBF,
+    0xAF, 0x27, 0x86, 0xE8, 0x8C, 0x9C, 0x23, 0xC2, 0x9E, 0x73, 0xB2, 0x9C, 0xF8, 0xF0, 0x6E, 0xB7,
+    0x8C, 0xC8, 0x91, 0x6B, 0xF7, 0x6D, 0xA0, 0xCC, 0x6F, 0x62, 0x47, 0xDF, 0xC3, 0x96, 0x26, 0xE3,
+    0xA1, 0x81, 0x16, 0x94, 0x14, 0x20, 0x5A, 0x19, 0x5E, 0xA7, 0x9C, 0x96, 0xEE, 0xF4, 0x37, 0xED,
+    0x1D, 0xDC, 0x9A, 0x68, 0x2D, 0x44, 0xE1, 0x09, 0xA0, 0xF2, 0xDB, 0x49, 0x3E, 0x88, 0xF7, 0xEF,
+    0x4D, 0x38, 0x3A, 0xD5, 0xD1, 0xCF, 0x46, 0x85, 0x20, 0x9B, 0x3A, 0xD9, 0xA8, 0x70, 0xC4, 0x13,
+    0xAA, 0x99, 0x3C, 0x63, 0x25, 0x1A, 0x01, 0x85, 0x8D, 0xAF, 0x0C, 0x33, 0x2C, 0xA3, 0x81, 0xB3,
+    0xD9, 0xD0, 0x01, 0xBD, 0xA8, 0xF8, 0xEE, 0x35, 0x7D, 0x44, 0xB4, 0xD2, 0x56, 0x97, 0x54, 0x47,
+    0xA2, 0x89, 0x93, 0xC3, 0xDE, 0xD8, 0x56, 0xD3, 0xD7, 0x34, 0xBE, 0xE0, 0xEC, 0xB9, 0x49, 0xF4,
+    0x7B, 0x00, 0xF5, 0x01, 0xFF, 0xC7, 0xA3, 0x6C, 0xB0, 0xE6, 0x1C, 0x04, 0x91, 0x82, 0xC7, 0xC5,
+    0x6C, 0x9D, 0x6C, 0x4B, 0x15, 0xC0, 0xF1, 0x65, 0x15, 0xC0, 0xD1, 0x15, 0xB5, 0xC6, 0x37, 0x5E,
+    0xD2, 0xCD, 0xF1, 0xE3, 0xCF, 0xF8, 0xB6, 0x81, 0x3A, 0xFA, 0xB6, 0x81, 0x47, 0x7C, 0xBD, 0x41,
+    0xCC, 0x42, 0xFA, 0xCC, 0xAF, 0x37, 0x80, 0x56, 0xCE, 0x8F, 0x03, 0xBF, 0x43, 0x61, 0xFF, 0x59,
+    0x29, 0xF6, 0xFC, 0xE6, 0x91, 0x9C, 0x8F, 0xF8, 0x25, 0x30, 0xB8, 0xD5, 0x22, 0x7E, 0xEB, 0x0F,
+    0xF9, 0x67, 0x5D, 0x74, 0xC6, 0x66, 0xAE, 0x3E, 0x04, 0x3C, 0x53, 0x0D, 0x86, 0xAC, 0xBE, 0x26,
+    0x97, 0xC9, 0xF7, 0x9B, 0x07, 0x22, 0xC3, 0xDA, 0xC5, 0x09, 0x24, 0x15, 0x2B, 0x10, 0xD4, 0x45,
+    0x63, 0xDC, 0x9C, 0x63, 0xD6, 0xA4, 0x14, 0x1A, 0x33, 0xD9, 0xF4, 0xB6, 0x15, 0x10, 0x3D, 0x9F,
+    0x15, 0x7C, 0xDE, 0xD4, 0x1F, 0x97, 0x46, 0x39, 0x34, 0xD3, 0x3D, 0x90, 0x15, 0x65, 0x3B, 0x5D,
+    0xA4, 0x58, 0x9C, 0xA8, 0xB3, 0x40, 0x87, 0xBD, 0x00, 0xA2, 0x9F, 0xF7, 0xA7, 0x84, 0x52, 0xAC,
+    0xA6, 0xB2, 0x1B, 0x26, 0x3E, 0xE3, 0x97, 0x5B, 0x21, 0x02, 0x23, 0x62, 0x0F, 0xAF, 0xCA, 0x1B,
+    0x93, 0x5B, 0xF6, 0x04, 0xFE, 0x18, 0x7D, 0x9B, 0x08, 0xF9, 0x44, 0x76, 0x6C, 0xA7, 0xBF, 0xB3,
+    0xE1, 0x13, 0x11, 0xFE, 0x0A, 0xDC, 0xB0, 0x21, 0x55, 0x40, 0x5F, 0x9C, 0x83, 0x28, 0xA5, 0x26,
+    0x78, 0x40, 0xF2, 0x20, 0x30, 0x8A, 0xBF, 0xF3, 0x39, 0xE3, 0x0D, 0xDC, 0x5C, 0x92, 0xC0, 0x93,
+    0x43, 0x6D, 0xE2, 0x69, 0x10, 0xAF, 0x45, 0x54, 0x95, 0xAA, 0xB9, 0x64, 0x7B, 0x31, 0x7C, 0xAF,
+    0x1E, 0x57, 0xA0, 0xB7, 0xCF, 0x55, 0xA8, 0x9D, 0x96, 0x59, 0x27, 0x83, 0x4A, 0x0D, 0x66, 0x33,
+    0xEF, 0x43, 0xD0, 0x5C, 0x3E, 0xA2, 0xCC, 0x1B, 0xFD, 0x3C, 0x95, 0x12, 0x8D, 0x92, 0xF2, 0xD2,
+    0xA0, 0x13, 0x5B, 0xD8, 0xFE, 0x08, 0x94, 0xA6, 0xE7, 0xFC, 0x97, 0x0E, 0x16, 0xB5, 0xA5, 0x38,
+    0xF9, 0x47, 0xD6, 0xDE, 0xC8, 0x1E, 0xF8, 0x66, 0x4D, 0x30, 0xA6, 0x71, 0x8A, 0xFA, 0x7B, 0x49,
+    0x66, 0x1B, 0x2A, 0xD8, 0xA9, 0x8A, 0x0D, 0x95, 0x6C, 0xA8, 0x66, 0x43, 0x45, 0xDB, 0x9D, 0x62,
+    0x28, 0x0C, 0x51, 0x75, 0x1B, 0x2A, 0xDC, 0x74, 0x1B, 0x33, 0x13, 0x02, 0x2F, 0x21, 0xF3, 0xFD,
+    0x18, 0x72, 0x12, 0x6C, 0x0F, 0x84, 0xCA, 0xB7, 0x38, 0x7D, 0xB2, 0xB4, 0xF0, 0x64, 0x4C, 0x84,
+    0xC0, 0x43, 0x98, 0x9A, 0xF9, 0xA1, 0x48, 0xE5, 0x4C, 0x6B, 0xDB, 0x8F, 0xBE, 0x3A, 0x4E, 0x7C,
+    0x85, 0x1C, 0xAA, 0x64, 0xFF, 0x7C, 0x0F, 0xD9, 0x93, 0xFC, 0xB6, 0x4D, 0x12, 0xED, 0x49, 0xB3,
+    0x67, 0xFF, 0x70, 0xB6, 0xFD, 0xFF, 0xB3, 0xCA, 0xF5, 0xBB, 0x2C, 0x2A, 0x6D, 0x15, 0xBB, 0x06,
+    0xAD, 0xE2, 0xEE, 0xEA, 0x63, 0x6E, 0x15, 0xFF, 0x1F, 0xA5, 0x56, 0x3D, 0x6C, 0x1C, 0xC7, 0x19,
+    0x7D, 0xBB, 0x4B, 0x6A, 0x45, 0x6E, 0x74, 0xC3, 0x82, 0x34, 0x18, 0x49, 0xD4, 0xA6, 0x60, 0x21,
+    0x08, 0xBC, 0xDB, 0x86, 0xC5, 0x15, 0x77, 0xB7, 0x13, 0xA8, 0x30, 0x82, 0x20, 0xC0, 0x15, 0x3C,
+    0xBB, 0x10, 0x90, 0xA8, 0x60, 0x11, 0x30, 0x30, 0x28, 0x03, 0x2C, 0x36, 0xC1, 0x51, 0x3B, 0x4E,
+    0x19, 0x20, 0x00, 0x0B, 0xA7, 0x0A, 0x10, 0xB0, 0x50, 0x21, 0x5C, 0x80, 0xF8, 0x02, 0xB0, 0xA0,
+    0x03, 0xD9, 0x37, 0x40, 0x8A, 0xB4, 0xAB, 0x20, 0x81, 0x4B, 0x2F, 0x10, 0x75, 0x29, 0xB2, 0x81,
+    0xD7, 0xC1, 0xD9, 0xD9, 0xBB, 0xF1, 0x9B, 0xBD, 0xA3, 0x15, 0xC1, 0x36, 0x52, 0x78, 0x6E, 0x6F,
+    0x76, 0x77, 0xE6, 0xDB, 0x6F, 0xBE, 0x9F, 0xF7, 0xBD, 0x99, 0x23, 0x19, 0x6B, 0x91, 0xF9, 0xB9,
+    0x53, 0x20, 0x01, 0x30, 0x82, 0x3B, 0x83, 0x5F, 0x42, 0x64, 0x88, 0x80, 0x4B, 0xD4, 0xED, 0x9E,
+    0xC2, 0x44, 0xBB, 0x26, 0xF7, 0x3F, 0x29, 0x42, 0x35, 0x3D, 0x45, 0x67, 0x03, 0x2B, 0x38, 0x04,
+    0x02, 0x83, 0x71, 0x64, 0x9E, 0xE7, 0x49, 0x68, 0xF4, 0xD8, 0x33, 0x94, 0xDC, 0x40, 0x6C, 0xE6,
+    0xA9, 0x99, 0x6D, 0x0D, 0x0E, 0x62, 0x63, 0xEC, 0x0B, 0xF8, 0x88, 0x47, 0xD8, 0x4B, 0x70, 0xD9,
+    0x7B, 0xB3, 0x88, 0x4C, 0xC6, 0x8F, 0x28, 0xB6, 0x8A, 0x58, 0xA5, 0x3A, 0x55, 0x31, 0x3F, 0x0A,
+    0x31, 0x8C, 0xD5, 0x3C, 0x55, 0xF3, 0x18, 0xB3, 0x15, 0x6C, 0xAC, 0x3F, 0x41, 0x6A, 0x70, 0x11,
+    0x49, 0x84, 0x12, 0x31, 0xD6, 0x67, 0x10, 0x67, 0x10, 0x40, 0x83, 0xA2, 0x87, 0x5C, 0x53, 0x46,
+    0x0F, 0xB2, 0x8E, 0x93, 0x77, 0x50, 0xB0, 0x8F, 0x5F, 0xCF, 0x84, 0x51, 0xCE, 0x53, 0x1A, 0xF9,
+    0xCE, 0x08, 0x93, 0xFB, 0x95, 0x33, 0x0B, 0x0A, 0xAF, 0x08, 0xB5, 0xD0, 0x3D, 0xB4, 0x50, 0x72,
+    0x29, 0x89, 0x73, 0xDC, 0x1D, 0x3A, 0x65, 0x1C, 0xE4, 0xE1, 0x44, 0x89, 0x39, 0x82, 0x0A, 0x4E,
+    0x1F, 0x6B, 0x61, 0xAB, 0xDB, 0xE9, 0xEC, 0xAE, 0x39, 0x2A, 0xF4, 0x74, 0xCB, 0xD3, 0x5D, 0x5F,
+    0x77, 0x02, 0xD5, 0x11, 0x72, 0x77, 0x1D, 0xF7, 0xBE, 0xFF, 0x14, 0x91, 0x9E, 0x43, 0xE4, 0x29,
+    0xAC, 0x32, 0x4C, 0xFD, 0x0C, 0x5D, 0x86, 0x88, 0xE6, 0x59, 0xC7, 0x67, 0x70, 0x78, 0x55, 0x18,
+    0x1F, 0xB6, 0x2F, 0x70, 0xF1, 0xF8, 0xCD, 0x22, 0x36, 0x3A, 0x98, 0x83, 0x4B, 0x61, 0x22, 0x7D,
+    0x53, 0x84, 0xFF, 0x2D, 0x7B, 0x18, 0x26, 0x8B, 0x40, 0x6D, 0x3B, 0x55, 0xA0, 0x5A, 0xE8, 0xE0,
+    0x94, 0x93, 0x93, 0x6C, 0x92, 0xC5, 0x7A, 0x15, 0x6E, 0x26, 0xA6, 0xA2, 0x0A, 0x2A, 0xB7, 0xC2,
+    0x33, 0x94, 0x4E, 0x1E, 0xEA, 0x0F, 0xF8, 0xF5, 0x35, 0x15, 0xE7, 0x69, 0x61, 0x32, 0x23, 0xA7,
+    0xB8, 0x60, 0x3E, 0x7A, 0x08, 0xB4, 0xA3, 0xBE, 0x5E, 0xF6, 0x88, 0x11, 0x0C, 0x75, 0x90, 0xB9,
+    0x05, 0x45, 0x37, 0x70, 0x24, 0x61, 0x40, 0x09, 0xBF, 0x80, 0x50, 0xE8, 0xDA, 0x18, 0x03, 0xDB,
+    0xE8, 0x6C, 0x0D, 0xE3, 0xE9, 0x91, 0xD5, 0x36, 0x5E, 0xC3, 0x0E, 0x5A, 0x07, 0x71, 0xD5, 0x7B,
+    0x9A, 0xE0, 0x04, 0xF7, 0x46, 0x32, 0x35, 0x7A, 0xF0, 0x40, 0x21, 0x90, 0x36, 0xBA, 0x8B, 0x00,
+    0xDF, 0x01, 0x9A, 0x36, 0xE3, 0x7E, 0x26, 0x0A, 0x51, 0x12, 0x07, 0x05, 0x0A, 0x9F, 0x91, 0xB4,
+    0xCA, 0x02, 0x1D, 0xEB, 0x67, 0x76, 0x00, 0x53, 0x3C, 0xA6, 0x2E, 0xDB, 0x08, 0x99, 0x0B, 0x70,
+    0x64, 0xEB, 0x53, 0xE6, 0x9A, 0x3A, 0xED, 0x58, 0x6C, 0x24, 0x9F, 0xDD, 0x0C, 0x9E, 0xB6, 0x97,
+    0xCB, 0xA0, 0x9C, 0x39, 0xB9, 0x9B, 0xA5, 0xF3, 0xC9, 0xDC, 0x53, 0xBE, 0xBC, 0x46, 0x48, 0x50,
+    0x42, 0xD3, 0x02, 0x5C, 0xC3, 0x72, 0xED, 0x10, 0xCC, 0x16, 0xCD, 0xFE, 0x45, 0x85, 0xC9, 0x14,
+    0x69, 0x4E, 0x80, 0xD0, 0xFA, 0x2E, 0xA3, 0xD6, 0xE1, 0x22, 0x97, 0xF8, 0xF0, 0xA7, 0xE9, 0x34,
+    0x2E, 0x1C, 0x19, 0x10, 0xAE, 0x31, 0x23, 0x18, 0xCA, 0xE8, 0x55, 0xD4, 0x38, 0xEF, 0x22, 0x34,
+    0xE8, 0xFD, 0x44, 0x5F, 0x7A, 0xFA, 0xC2, 0xCD, 0x2E, 0xBD, 0xAC, 0x77, 0x4B, 0x73, 0xC4, 0x79,
+    0x82, 0x6B, 0xE7, 0x22, 0x13, 0x2A, 0xA2, 0xA6, 0x13, 0x6B, 0xDF, 0x0A, 0xF8, 0xC4, 0x64, 0x10,
+    0xD3, 0x16, 0xE6, 0x41, 0x8E, 0x20, 0x43, 0xA8, 0xAD, 0xD9, 0x53, 0xE0, 0x03, 0xFA, 0x8E, 0xC8,
+    0x02, 0x0F, 0x29, 0x45, 0xD8, 0xFF, 0xDD, 0xBA, 0x16, 0xCC, 0xB0, 0xD6, 0x6A, 0x76, 0x3A, 0xC9,
+    0xE1, 0xEA, 0x60, 0x70, 0x10, 0x19, 0x53, 0x11, 0xDF, 0xD3, 0x1E, 0x9C, 0x92, 0x21, 0x28, 0x6C,
+    0x0C, 0xFA, 0x40, 0xFF, 0xE1, 0xB6, 0x8B, 0x71, 0xC7, 0x47, 0x31, 0x14, 0x98, 0x7C, 0x5C, 0xA1,
+    0xF5, 0x7A, 0x8E, 0x87, 0xF8, 0xEE, 0xD0, 0x99, 0x46, 0x04, 0xDF, 0xBF, 0x94, 0x30, 0xF0, 0x6B,
+    0xF0, 0xD5, 0x25, 0x95, 0x39, 0xA6, 0xF0, 0x3F, 0x29, 0x43, 0x55, 0x9D, 0xA2, 0x4B, 0xA4, 0xEC,
+    0x63, 0xA7, 0x43, 0xA7, 0xDE, 0x28, 0x43, 0x96, 0x9A, 0x91, 0x36, 0xE8, 0x57, 0x68, 0xEA, 0xE2,
+    0x59, 0xF2, 0x65, 0xD9, 0x79, 0x86, 0x30, 0x35, 0xE5, 0x45, 0x33, 0x30, 0x79, 0xDB, 0x31, 0xCA,
+    0xBA, 0xC4, 0x9A, 0x9B, 0x98, 0xCA, 0xD6, 0x9A, 0x6D, 0xA9, 0x31, 0x46, 0x4E, 0xD8, 0x2D, 0xEA,
+    0x77, 0x7D, 0x34, 0x1A, 0x9D, 0x85, 0x7C, 0xCD, 0x6E, 0xF2, 0x49, 0xE1, 0xCB, 0x16, 0x5B, 0xB9,
+    0x5A, 0xF8, 0x9B, 0xF4, 0xDE, 0x1B, 0x8D, 0xCE, 0x29, 0x90, 0x1F, 0x51, 0x03, 0x9F, 0xD9, 0xEA,
+    0x8F, 0xA8, 0xF9, 0x68, 0xF1, 0x86, 0x1A, 0xF5, 0x7E, 0xCE, 0x45, 0x33, 0xF8, 0xB3, 0xFA, 0x46,
+    0x0A, 0x41, 0xC4, 0x91, 0xC7, 0x9C, 0xFC, 0xDE, 0x72, 0x29, 0x0B, 0x03, 0xCA, 0x69, 0xDB, 0x8B,
+    0xFA, 0x39, 0xAA, 0xC7, 0xBB, 0x75, 0x3F, 0xB5, 0x1D, 0xEB, 0x8B, 0xCD, 0xCB, 0x50, 0x83, 0x0D,
+    0x35, 0x33, 0xD8, 0xD6, 0xAB, 0xFB, 0x61, 0xDD, 0x97, 0xB5, 0xAE, 0xFC, 0x5B, 0xEA, 0x7A, 0xF6,
+    0xFF, 0x75, 0x75, 0xEA, 0xFE, 0xEE, 0xD2, 0x7A, 0x5F, 0xD5, 0x85, 0x66, 0xAB, 0x21, 0x8F, 0x74,
+    0xD7, 0x62, 0x68, 0x73, 0x8F, 0x42, 0x94, 0x4A, 0xA8, 0xB2, 0x64, 0x88, 0x0A, 0xC6, 0xBB, 0x18,
+    0x0C, 0x06, 0xFD, 0x2B, 0x80, 0x74, 0x07, 0x83, 0x21, 0xE7, 0xDB, 0x6D, 0xE0, 0x84, 0xC0, 0x1B,
+    0xDB, 0x79, 0x46, 0xEC, 0xDC, 0x39, 0xBB, 0x8B, 0xF0, 0x3F, 0x06, 0xDD, 0xE3, 0x07, 0xF2, 0xD1,
+    0x1D, 0x5F, 0x9E, 0xDF, 0xF6, 0xB9, 0xC2, 0xF5, 0xEF, 0x84, 0xA7, 0x41, 0x19, 0xE4, 0xBD, 0xB2,
+    0x6D, 0x51, 0x7A, 0xE8, 0x97, 0x42, 0x87, 0x64, 0x40, 0xA1, 0x03, 0xED, 0x67, 0x5E, 0x16, 0xEA,
+    0x09, 0xFA, 0x0B, 0x63, 0x04, 0xC3, 0x5F, 0xD8, 0x2E, 0x7F, 0x99, 0x49, 0x9B, 0x1B, 0x65, 0x33,
+    0xA3, 0xEC, 0x93, 0x5C, 0x90, 0x83, 0x9F, 0xD3, 0xE6, 0x4B, 0xE2, 0x88, 0x68, 0xFB, 0x0A, 0x39,
+    0x38, 0x84, 0x0A, 0x39, 0xEB, 0x2B, 0x04, 0x2E, 0x6C, 0x85, 0xD9, 0x45, 0x95, 0xA8, 0x77, 0x84,
+    0xBA, 0x39, 0x0C, 0xAA, 0x57, 0x21, 0xBC, 0x3F, 0xBD, 0x8C, 0xFF, 0xFC, 0xEF, 0x59, 0xFC, 0x97,
+    0xE7, 0xB3, 0xE8, 0x87, 0xAA, 0x5A, 0x09, 0x6A, 0x66, 0xC0, 0x16, 0x52, 0x99, 0xB2, 0x58, 0x8C,
+    0x9A, 0x64, 0x37, 0xC1, 0x00, 0xF4, 0x6D, 0x75, 0xF0, 0x5F, 0x9E, 0xC2, 0xAD, 0xAB, 0x83, 0xE9,
+    0xC8, 0x69, 0xBE, 0xE4, 0xDC, 0x40, 0xD6, 0x50, 0xB4, 0x9D, 0xFE, 0x3A, 0x28, 0x6E, 0x51, 0x04,
+    0xA4, 0x65, 0x72, 0x72, 0xF3, 0x8A, 0x93, 0x13, 0x81, 0xC3, 0x75, 0x4A, 0x4D, 0x0A, 0x53, 0x38,
+    0xB9, 0x65, 0x13, 0x87, 0xF0, 0xEC, 0xC3, 0x39, 0xA3, 0x47, 0x46, 0x93, 0x7F, 0xFF, 0x9A, 0x27,
+    0x11, 0x9D, 0x88, 0xC9, 0xC2, 0x17, 0x1B, 0x0B, 0xF6, 0xB3, 0xF1, 0xF2, 0xCA, 0xE5, 0xBF, 0xA8,
+    0x81, 0xEA, 0xCE, 0xE5, 0xAE, 0x30, 0x9F, 0x96, 0xBD, 0x63, 0x93, 0xEF, 0xBB, 0x84, 0xFD, 0x8A,
+    0x4D, 0x38, 0xD3, 0x1E, 0x2F, 0xFF, 0x6B, 0x7C, 0xFF, 0x50, 0x6E, 0xFB, 0xA6, 0x1C, 0x8A, 0xF7,
+    0x4C, 0xB9, 0xE7, 0x9A, 0xCC, 0xBA, 0x67, 0x55, 0x31, 0x58, 0x5C, 0xE7, 0x9F, 0xF5, 0x3A, 0x7D,
+    0x0B, 0x71, 0x6A, 0x95, 0x67, 0x62, 0xC4, 0xE4, 0x93, 0x0C, 0xCA, 0x1D, 0x57, 0xAF, 0xB8, 0xCB,
+    0x68, 0xE9, 0xA0, 0x88, 0xAA, 0x20, 0x13, 0xDC, 0x85, 0x42, 0x15, 0xCA, 0xB4, 0xF4, 0x8C, 0x0E,
+    0x67, 0xCB, 0xDB, 0xCF, 0xFB, 0x18, 0x60, 0xF5, 0xAD, 0x45, 0x6C, 0x9B, 0xBC, 0x6D, 0xD6, 0xB7,
+    0x46, 0x67, 0x6C, 0xB9, 0xB7, 0xB1, 0x39, 0xB6, 0x8A, 0x6B, 0xEA, 0x84, 0xAB, 0xEC, 0x85, 0xEB,
+    0x1C, 0xD9, 0xC5, 0x86, 0xA5, 0xDC, 0x64, 0x25, 0xB1, 0x26, 0x6F, 0x34, 0x13, 0xEB, 0xE1, 0x4A,
+    0x33, 0xB1, 0x38, 0x6D, 0x36, 0x93, 0x5D, 0xCB, 0xF6, 0xCD, 0xA5, 0xCE, 0xDD, 0x5A, 0x72, 0xBB,
+    0xE6, 0xE8, 0x7D, 0x9A, 0x23, 0xED, 0x75, 0xA5, 0xD3, 0xF9, 0x11, 0xDE, 0x96, 0x58, 0xAE, 0x97,
+    0xD4, 0x10, 0x6F, 0xBE, 0xB4, 0xC5, 0xDE, 0x5E, 0x35, 0x17, 0xC8, 0xB8, 0xDF, 0x45, 0xB9, 0x57,
+    0x05, 0xD3, 0x54, 0x95, 0xA0, 0x3D, 0xE7, 0x41, 0x1E, 0xA9, 0x4E, 0xCD, 0xCD, 0xB1, 0x14, 0xD2,
+    0x01, 0x37, 0x23, 0xDF, 0x66, 0xB4, 0xE8, 0x61, 0x4A, 0x9E, 0xEA, 0x5F, 0x6E, 0x12, 0x6C, 0xBC,
+    0x9C, 0xE9, 0x32, 0xBB, 0xB7, 0x6F, 0x20, 0x4A, 0xED, 0xC6, 0xCB, 0x3C, 0x88, 0x0A, 0x71, 0x84,
+    0xEB, 0x8C, 0xB4, 0x63, 0xAB, 0xD2, 0xE1, 0x31, 0xA1, 0x44, 0x4C, 0x0A, 0x9E, 0xD5, 0x94, 0xEB,
+    0xDB, 0xDC, 0x11, 0xA2, 0xD1, 0x0B, 0xEA, 0xB4, 0xB3, 0xE1, 0x67, 0x36, 0x33, 0xFB, 0x35, 0xCF,
+    0xB0, 0xB8, 0x85, 0x9C, 0x9C, 0x85, 0x2A, 0xA8, 0x22, 0xED, 0x55, 0x71, 0x16, 0xBD, 0x78, 0xBF,
+    0x98, 0xA1, 0x28, 0xCF, 0x9D, 0x7C, 0xB8, 0x0A, 0x16, 0x0B, 0x0F, 0x32, 0x4E, 0xE1, 0xB2, 0x48,
+    0x63, 0xC6, 0x75, 0x8D, 0xB8, 0x9C, 0xA8, 0x89, 0x4A, 0x17, 0x56, 0xAC, 0x24, 0xD8, 0x3B, 0x41,
+    0xF4, 0x36, 0xCF, 0x32, 0x19, 0x77, 0x99, 0xF6, 0xC7, 0xD2, 0xF9, 0x48, 0xBB, 0xCF, 0xEB, 0x94,
+    0xF5, 0x0F, 0x10, 0xCE, 0x8D, 0xEC, 0x1D, 0x7F, 0xA4, 0x13, 0xE1, 0xE6, 0x89, 0xE0, 0x09, 0x43,
+    0xDC, 0xCF, 0x08, 0x4B, 0x1D, 0x94, 0x73, 0xE2, 0xA4, 0x69, 0xBD, 0x9D, 0xA5, 0x55, 0xBD, 0x21,
+    0x3D, 0xBC, 0x82, 0x6D, 0x7B, 0x41, 0x0F, 0xB2, 0xB9, 0x08, 0x9D, 0x2D, 0x2F, 0x2A, 0x2B, 0xE1,
+    0x7D, 0xC6, 0xFB, 0x31, 0xB1, 0x33, 0xF9, 0x7C, 0x34, 0x99, 0x5B, 0x12, 0xBA, 0xAA, 0xD7, 0x9B,
+    0xA3, 0x77, 0x5F, 0xA2, 0x7E, 0x49, 0x33, 0x9E, 0x5A, 0xB0, 0x53, 0xB8, 0xE4, 0xAA, 0x67, 0x35,
+    0x85, 0x22, 0xB4, 0xAC, 0x3A, 0x1F, 0xBD, 0x67, 0x2C, 0xC3, 0xF2, 0xFB, 0x17, 0x76, 0xEE, 0xB5,
+    0xD1, 0x93, 0x65, 0xB9, 0xD4, 0x7B, 0x90, 0xB1, 0xAC, 0x3F, 0x58, 0x54, 0xDC, 0xAB, 0x23, 0x07,
+    0x78, 0xED, 0x37, 0xF6, 0x83, 0x87, 0xAE, 0x31, 0xB4, 0xC6, 0xC9, 0xC5, 0xE7, 0x13, 0x3E, 0xDC,
+    0xD2, 0xDC, 0x68, 0x8F, 0x2D, 0x83, 0xDB, 0x74, 0x1F, 0x9B, 0x72, 0x51, 0x2B, 0x8B, 0xB6, 0xB5,
+    0xD8, 0x3F, 0x38, 0x3D, 0x5D, 0xDA, 0x6C, 0xB7, 0x81, 0xF4, 0x6F, 0xC0, 0xAD, 0x12, 0x6E, 0x4D,
+    0x98, 0xA7, 0x08, 0xEA, 0x1D, 0x44, 0x2C, 0x4E, 0x0A, 0xB4, 0x7D, 0xF1, 0xBD, 0x23, 0xFF, 0xC7,
+    0x2D, 0x5D, 0xEF, 0x15, 0x45, 0x6D, 0xCD, 0xD4, 0x56, 0xB5, 0x59, 0xF0, 0x71, 0xED, 0x9D, 0x7B,
+    0x25, 0x75, 0x00, 0xFF, 0xB7, 0xEA, 0x86, 0x2F, 0xB9, 0x63, 0xB6, 0x03, 0x9C, 0x34, 0x70, 0xD2,
+    0x44, 0xFB, 0x77, 0x20, 0xB3, 0xA0, 0x1F, 0xBC, 0xB5, 0xB7, 0xD3, 0xDE, 0xFB, 0x53, 0x5E, 0x62,
+    0x8C, 0x64, 0x37, 0xCC, 0x56, 0xED, 0x29, 0x81, 0x29, 0x1D, 0x62, 0x8F, 0x41, 0xDF, 0xE7, 0x91,
+    0x72, 0x8C, 0x3F, 0xDA, 0x5D, 0xDC, 0x2A, 0xC1, 0x8E, 0xA7, 0x3A, 0x9E, 0x4E, 0x3C, 0x75, 0xE2,
+    0xCB, 0x93, 0x00, 0xED, 0xDB, 0x76, 0x5B, 0x67, 0x5D, 0xB5, 0x3C, 0x75, 0xC3, 0x93, 0x24, 0xD8,
+    0x3D, 0x0E, 0x0A, 0xEC, 0xB7, 0xAC, 0xFE, 0x16, 0x1D, 0x38, 0x08, 0x7E, 0xBC, 0xD7, 0x68, 0x53,
+    0x87, 0xFD, 0x25, 0x9B, 0x61, 0x86, 0x6B, 0x67, 0x70, 0x32, 0x96, 0x2E, 0xDE, 0xD0, 0xDF, 0x64,
+    0xD5, 0x4D, 0xC9, 0x4C, 0x13, 0xA0, 0x08, 0x56, 0xD0, 0xF8, 0xBD, 0x14, 0xF7, 0xE5, 0xCE, 0x42,
+    0x73, 0x03, 0xFB, 0x0D, 0x3C, 0x6A, 0xE0, 0x61, 0xA0, 0x56, 0x57, 0x1D, 0x19, 0xFE, 0xEC, 0x57,
+    0x79, 0xF0, 0xCB, 0x7C, 0x2C, 0x3C, 0x9D, 0x73, 0xF9, 0xEC, 0xB6, 0xEF, 0xE8, 0xBD, 0xC0, 0xD5,
+    0x6D, 0xE1, 0xEA, 0xFD, 0x75, 0x94, 0x9B, 0x9B, 0xAD, 0x3F, 0x34, 0x7E, 0x70, 0x87, 0x9E, 0x74,
+    0x96, 0xBE, 0x30, 0x34, 0x3C, 0x87, 0x45, 0x67, 0x37, 0x70, 0x7B, 0xE9, 0x5F, 0x9B, 0xB4, 0xB4,
+    0xE9, 0x50, 0xBB, 0xBA, 0xE1, 0xAA, 0x86, 0x2B, 0x1B, 0x14, 0x58, 0x83, 0xBF, 0x0D, 0xFF, 0x9C,
+    0x21, 0x67, 0xB4, 0x37, 0x5C, 0x9D, 0xE1, 0x1F, 0x12, 0xEF, 0xD7, 0x20, 0x24, 0x62, 0x7E, 0x8D,
+    0x40, 0xE0, 0xAE, 0xAF, 0xBE, 0x00, 0xED, 0x7D, 0x4D, 0x8C, 0x25, 0xD7, 0x75, 0x5E, 0xFD, 0xA8,
+    0xA7, 0x68, 0x57, 0xAC, 0x22, 0x02, 0x0E, 0x63, 0x68, 0x22, 0x56, 0x16, 0x5E, 0x04, 0x92, 0x66,
+    0x2A, 0x0B, 0x2F, 0xB4, 0xE8, 0x9E, 0x2A, 0x91, 0x08, 0xB4, 0xD0, 0xC2, 0x93, 0x60, 0x9A, 0x04,
+    0x42, 0x20, 0xCC, 0xC2, 0x59, 0xC4, 0x84, 0xD1, 0x5E, 0x68, 0xC1, 0x00, 0x43, 0x56, 0xD1, 0x5A,
+    0x64, 0xE1, 0x85, 0x66, 0x61, 0x39, 0x0B, 0x2D, 0xCC, 0x45, 0x16, 0xE6, 0x10, 0xC8, 0x70, 0x41,
+    0x20, 0x13, 0x63, 0x38, 0x55, 0xB4, 0x17, 0x5A, 0x78, 0xA1, 0x92, 0x0D, 0xC6, 0x40, 0x0C, 0xC4,
+    0xCF, 0x09, 0x19, 0xDB, 0x54, 0x6C, 0x96, 0xA2, 0x62, 0xF4, 0x7A, 0xF8, 0x5E, 0x55, 0xCE, 0xF7,
+    0x9D, 0x73, 0xAB, 0xEA, 0x75, 0xF7, 0x0C, 0x49, 0x85, 0xA4, 0x48, 0x3A, 0x2D, 0xAA, 0xAA, 0x7A,
+    0xBA, 0xFB, 0xD5, 0xBD, 0xE7, 0xDC, 0x7B, 0x7E, 0xBF, 0x73, 0xAE, 0xE7, 0x79, 0x37, 0x3C, 0x7E,
+    0x95, 0x05, 0x6F, 0x59, 0xC3, 0x5B, 0xDC, 0xF2, 0x16, 0x76, 0xFA, 0x43, 0xBB, 0x3D, 0xE8, 0x4D,
+    0x5F, 0xC9, 0x28, 0x5F, 0x95, 0xBB, 0x79, 0xF5, 0xEB, 0x87, 0xF8, 0x80, 0x52, 0xFE, 0x45, 0x3F,
+    0x0B, 0xB7, 0xDA, 0xE3, 0x6D, 0xF4, 0xBC, 0x47, 0xE4, 0x36, 0xF0, 0xEF, 0x7C, 0xBB, 0x6D, 0x79,
+    0x0B, 0x36, 0xFA, 0x1A, 0xBB, 0x8D, 0x23, 0x7E, 0x1A, 0xE9, 0x2D, 0xD6, 0x97, 0x26, 0xBB, 0xB7,
+    0x15, 0x6F, 0x69, 0xBB, 0x1C, 0x6C, 0x2E, 0xB7, 0x17, 0x78, 0xF3, 0xE5, 0xC7, 0x79, 0xE5, 0x85,
+    0xF2, 0xE3, 0xBA, 0xF0, 0xA2, 0x86, 0x2F, 0x97, 0xDF, 0x7A, 0x5A, 0x87, 0x59, 0xE3, 0x56, 0xCC,
+    0x93, 0xF0, 0xD6, 0x7E, 0xCF, 0x51, 0x70, 0x00, 0x76, 0xF3, 0xD7, 0x41, 0xEF, 0x9D, 0xFD, 0xF5,
+    0x69, 0x9E, 0x74, 0x84, 0xDB, 0xD6, 0x8B, 0xF5, 0x96, 0xBC, 0xF9, 0xD4, 0x3B, 0x87, 0x72, 0x2B,
+    0xE4, 0x15, 0xB7, 0x65, 0xA4, 0xF2, 0x8A, 0x6B, 0xDE, 0x45, 0xBC, 0xE2, 0x19, 0x6F, 0xDF, 0xCB,
+    0x70, 0x7B, 0x08, 0x9F, 0xF1, 0xA0, 0xBD, 0xC9, 0xE3, 0x2B, 0x16, 0xEB, 0xA4, 0x7E, 0x72, 0xBC,
+    0x8E, 0x69, 0xE2, 0xC3, 0xE4, 0xF6, 0xD7, 0x4F, 0x83, 0xAE, 0x32, 0x83, 0xB1, 0xE1, 0x34, 0xF3,
+    0x15, 0xA7, 0x99, 0x76, 0x9C, 0xA6, 0xBC, 0x24, 0x5C, 0xF3, 0x16, 0xE9, 0x2D, 0x16, 0x0A, 0xA7,
+    0x2B, 0xCE, 0x56, 0xDE, 0x85, 0x69, 0xCA, 0x4B, 0x30, 0x4D, 0x19, 0x79, 0x2E, 0xBF, 0xBC, 0xF5,
+    0xBE, 0x30, 0x0E, 0xD5, 0xD8, 0x79, 0xD9, 0x38, 0x36, 0x83, 0xBE, 0xF1, 0xE7, 0x5F, 0xD0, 0xE9,
+    0xB7, 0xCB, 0x61, 0x18, 0x45, 0x95, 0x4E, 0x71, 0x75, 0x36, 0xC7, 0x0A, 0xBD, 0xE1, 0xAF, 0x5E,
+    0x3F, 0xAC, 0x75, 0x2A, 0xB9, 0x7E, 0xC6, 0x25, 0xE5, 0xD8, 0x45, 0xE5, 0x98, 0xDD, 0x3E, 0x37,
+    0x33, 0xEE, 0x4C, 0x8E, 0xAD, 0x79, 0x8B, 0x74, 0x95, 0xC4, 0x76, 0x7B, 0x7F, 0x1C, 0xBB, 0x17,
+    0x39, 0x75, 0x55, 0x3E, 0x3D, 0xDE, 0x25, 0x6D, 0x39, 0xD6, 0xE9, 0xEB, 0x1C, 0x49, 0x5C, 0x0A,
+    0x25, 0xBC, 0x60, 0x00, 0x79, 0x92, 0x1E, 0xEF, 0x91, 0xCF, 0x91, 0x97, 0xCA, 0x1F, 0xC6, 0x2B,
+    0xAC, 0xAF, 0x73, 0x85, 0x0E, 0x2F, 0x5E, 0xCF, 0xE3, 0xC8, 0x78, 0xCD, 0x39, 0x8A, 0xFC, 0xAD,
+    0x1B, 0x2F, 0xF2, 0x53, 0x36, 0x24, 0xC3, 0x55, 0x79, 0x0D, 0x47, 0x60, 0xD7, 0x62, 0xF1, 0xCC,
+    0x6B, 0xD9, 0xCC, 0x83, 0xCD, 0x64, 0x3A, 0xBF, 0x81, 0xD7, 0x0A, 0xA1, 0xA3, 0xB1, 0x38, 0x6A,
+    0x3D, 0x5F, 0x37, 0x52, 0x36, 0xF2, 0x6D, 0x87, 0x8B, 0xD1, 0xA6, 0x63, 0xCB, 0x75, 0x21, 0xAF,
+    0x89, 0xD6, 0xC1, 0x48, 0x5A, 0xC8, 0x35, 0x6D, 0xBC, 0x92, 0x93, 0xBE, 0xCC, 0xEB, 0x43, 0x8E,
+    0x00, 0xF3, 0x0B, 0xE4, 0x77, 0x48, 0xCA, 0x64, 0xD0, 0x6D, 0xC1, 0x51, 0xEB, 0xE7, 0x67, 0xFC,
+    0xA7, 0x68, 0xE4, 0x5F, 0x8C, 0x3A, 0x30, 0xFD, 0x8B, 0xCE, 0x26, 0x7B, 0x89, 0xD7, 0x9C, 0x6F,
+    0x2B, 0x49, 0x78, 0xF0, 0xB8, 0xC1, 0x07, 0x0B, 0x7B, 0xE3, 0xE1, 0xA6, 0x90, 0xD0, 0xAF, 0xF9,
+    0x99, 0xFE, 0x55, 0x5B, 0x18, 0xDC, 0xC8, 0xD8, 0xBF, 0xAD, 0x63, 0x07, 0x99, 0x51, 0x7B, 0xBA,
+    0x0A, 0xEC, 0x32, 0xB8, 0x65, 0xC0, 0x45, 0x40, 0x1A, 0x73, 0x01, 0x90, 0xFD, 0x64, 0x3E, 0x59,
+    0x4F, 0x82, 0x93, 0xED, 0x64, 0x3A, 0x59, 0x9E, 0xCF, 0x97, 0xE9, 0xD3, 0xF1, 0xC2, 0xA7, 0xC7,
+    0x63, 0x30, 0x79, 0xEB, 0x48, 0xE6, 0xAF, 0xA3, 0x95, 0x7C, 0x32, 0x76, 0x09, 0x2E, 0x7E, 0x1F,
+    0xB5, 0x67, 0xAC, 0xE3, 0x4F, 0xC4, 0x70, 0x39, 0x0E, 0x1B, 0x88, 0x8E, 0xC4, 0xF8, 0xA8, 0xEB,
+    0xB8, 0xF6, 0xA6, 0x81, 0xD8, 0x75, 0x98, 0xB7, 0x91, 0xEE, 0x22, 0x5D, 0xA5, 0xBA, 0x87, 0x74,
+    0x0B, 0xE9, 0x0E, 0x8A, 0xBB, 0x79, 0xDD, 0xEA, 0xF6, 0xD1, 0xDD, 0x93, 0x2D, 0xD6, 0xA1, 0x5D,
+    0xEF, 0xF1, 0xC2, 0xFB, 0xBE, 0x2A, 0x5E, 0x7C, 0xB0, 0xCE, 0x91, 0xBF, 0x5E, 0xBE, 0xE1, 0x56,
+    0xAD, 0x7C, 0xE9, 0x5A, 0xC3, 0x93, 0xEE, 0xE9, 0xED, 0xE1, 0x13, 0xC6, 0xA3, 0xDB, 0x14, 0x5C,
+    0xD4, 0x18, 0x6E, 0xC3, 0x7B, 0xBD, 0xDB, 0xF3, 0x7E, 0xE7, 0xB6, 0xBD, 0x6C, 0x0F, 0xDB, 0xF9,
+    0xE1, 0xCA, 0x6D, 0x7E, 0x11, 0xCB, 0xB6, 0xFF, 0x45, 0x32, 0xE7, 0xAF, 0x73, 0xD4, 0xB1, 0x3C,
+    0x29, 0x09, 0x13, 0x59, 0xA5, 0x6F, 0x8D, 0x64, 0x46, 0x21, 0x53, 0x8A, 0x31, 0xE2, 0x14, 0xD3,
+    0x0A, 0xF0, 0xE6, 0xCB, 0x9C, 0x1A, 0x66, 0x77, 0xA0, 0xC2, 0x55, 0x9E, 0xAE, 0x51, 0x9B, 0x8C,
+    0x1C, 0x0A, 0x7E, 0x49, 0x9E, 0x44, 0x89, 0x61, 0xC2, 0x23, 0xF5, 0xB5, 0x4C, 0x1A, 0xBF, 0x20,
+    0x0A, 0x5C, 0x26, 0x2E, 0x82, 0x14, 0x6F, 0x17, 0x3A, 0x47, 0x1B, 0xEF, 0x61, 0xC8, 0x8A, 0x0E,
+    0x7B, 0xA6, 0xC4, 0x86, 0xEC, 0x7C, 0xD9, 0x49, 0xE5, 0x46, 0xC4, 0x0B, 0x55, 0x8F, 0x6C, 0x28,
+    0x48, 0x49, 0x11, 0xEA, 0x7B, 0xBB, 0xCB, 0x2E, 0xA7, 0x62, 0x02, 0xCB, 0xF5, 0x09, 0x6C, 0xF7,
+    0x75, 0x2B, 0x82, 0x13, 0xA3, 0x13, 0x63, 0x26, 0x2B, 0xEB, 0x49, 0x5C, 0x8E, 0x93, 0xC4, 0x9C,
+    0x9F, 0x06, 0xC7, 0x0F, 0xFC, 0xB6, 0xB2, 0x1F, 0xBF, 0xAD, 0x94, 0x0C, 0xB7, 0x87, 0x87, 0x4F,
+    0xBD, 0x73, 0x55, 0x95, 0x22, 0xBE, 0x84, 0x82, 0xD1, 0x70, 0xE3, 0xC6, 0xCD, 0xBB, 0xF5, 0x46,
+    0x97, 0x49, 0xDA, 0x42, 0xA2, 0x50, 0x6D, 0x34, 0x90, 0x53, 0xA6, 0x39, 0x4C, 0x79, 0xE8, 0x96,
+    0x07, 0xDD, 0x65, 0x38, 0xD8, 0xFC, 0x0D, 0x05, 0x9B, 0xFE, 0x02, 0x06, 0x51, 0x4E, 0x4F, 0xF8,
+    0xE7, 0x0A, 0xC3, 0xF1, 0x47, 0x37, 0xF8, 0x68, 0xCB, 0xE5, 0x2E, 0x03, 0x2D, 0x7B, 0xAE, 0xF9,
+    0x9B, 0xA6, 0x3E, 0xB7, 0x81, 0x3C, 0xBC, 0xE1, 0x9D, 0xA1, 0x41, 0x1F, 0xFF, 0x70, 0x34, 0x28,
+    0x48, 0x33, 0xBE, 0x75, 0x73, 0x54, 0xFA, 0xC8, 0x3B, 0x41, 0x1C, 0x19, 0x2B, 0x28, 0x23, 0x7F,
+    0x1A, 0xDA, 0x6D, 0xCD, 0x1B, 0x16, 0xA2, 0x7C, 0x10, 0xA8, 0x51, 0x92, 0x9F, 0xB4, 0x38, 0x3A,
+    0xCE, 0x6A, 0xD6, 0xA0, 0x32, 0x2D, 0x68, 0x50, 0x7F, 0x7C, 0x03, 0x1A, 0x34, 0xD0, 0xA5, 0xED,
+    0x4C, 0xBD, 0xC0, 0x56, 0xB5, 0x69, 0x30, 0x2F, 0xD1, 0xE1, 0x51, 0x27, 0xE2, 0xEB, 0x96, 0xDD,
+    0x8B, 0x93, 0x12, 0xA8, 0x34, 0x21, 0x54, 0x9B, 0x1C, 0x4A, 0x7A, 0x9D, 0x55, 0x6A, 0xF2, 0xE2,
+    0x39, 0x5B, 0x00, 0x6B, 0x65, 0x7A, 0xB8, 0xD2, 0x7B, 0x52, 0x29, 0xEB, 0x2F, 0x1B, 0xE3, 0xD7,
+    0xCA, 0x76, 0xFD, 0xB1, 0x88, 0xBC, 0xCA, 0xEC, 0xA0, 0x4A, 0xA5, 0xBC, 0x0A, 0xF8, 0xB8, 0x57,
+    0xA5, 0x10, 0x77, 0x26, 0x13, 0x3A, 0x6E, 0x0E, 0x99, 0x63, 0xB8, 0x55, 0xE9, 0x10, 0x8C, 0x26,
+    0x1F, 0xB8, 0x93, 0x84, 0x34, 0xB5, 0x09, 0xB0, 0xDC, 0x24, 0x24, 0xB5, 0x03, 0xCC, 0xB2, 0xB5,
+    0x4A, 0xB2, 0x68, 0x50, 0x61, 0x16, 0x8C, 0x2B, 0x95, 0x67, 0x47, 0x7C, 0x43, 0xF0, 0x7B, 0x36,
+    0x45, 0x5B, 0xB7, 0xF2, 0x75, 0xC7, 0x3D, 0xE4, 0xD3, 0xF4, 0x9D, 0x6D, 0x11, 0x36, 0xDE, 0x59,
+    0xE4, 0x21, 0x7D, 0x62, 0x8C, 0x1D, 0x04, 0x4A, 0x38, 0x09, 0xC8, 0xC7, 0xBC, 0x33, 0xC6, 0x73,
+    0x0D, 0x80, 0xF5, 0x7C, 0xA8, 0x9D, 0x9E, 0x95, 0x39, 0x04, 0x1C, 0x3F, 0xD8, 0xE7, 0x24, 0x78,
+    0x3E, 0xDA, 0x0E, 0x59, 0x0F, 0x3A, 0xAC, 0xE8, 0x2F, 0xB6, 0x2A, 0xCF, 0xD2, 0x47, 0xB7, 0x2A,
+    0xD2, 0x9E, 0xE5, 0x60, 0xA3, 0x3E, 0xE8, 0xB9, 0xB3, 0xE2, 0x3E, 0x6E, 0xB8, 0xB1, 0xE2, 0x2E,
+    0x57, 0xBE, 0x26, 0xDD, 0xC6, 0x44, 0xFD, 0xFF, 0x58, 0xA9, 0x7C, 0x4A, 0xDF, 0xD6, 0x0D, 0xE3,
+    0x65, 0x5B, 0x93, 0x84, 0x79, 0x6F, 0x52, 0x16, 0x14, 0xCB, 0x9A, 0x33, 0x47, 0x8A, 0xC1, 0x81,
+    0xB0, 0x20, 0xDC, 0x97, 0x9D, 0x26, 0x28, 0x55, 0x12, 0x7C, 0xCE, 0xF3, 0x71, 0x7B, 0xD6, 0x0B,
+    0x2B, 0x0E, 0x3C, 0x25, 0xBF, 0xBF, 0x73, 0x9B, 0xAB, 0x7C, 0x24, 0x71, 0x2F, 0x0C, 0xA7, 0x6C,
+    0xB2, 0x52, 0x56, 0xA3, 0x10, 0xAB, 0x16, 0x29, 0x2B, 0xA4, 0x8A, 0xE5, 0x17, 0x64, 0x1D, 0x61,
+    0x16, 0xB1, 0xAE, 0x75, 0x21, 0x35, 0x56, 0x68, 0xA6, 0x76, 0xF3, 0x81, 0xD2, 0xE6, 0x96, 0xDE,
+    0x3A, 0xDA, 0x2A, 0x5C, 0x39, 0x79, 0x15, 0x29, 0xBF, 0x93, 0x82, 0x66, 0xE1, 0x25, 0xAE, 0x8A,
+    0xD5, 0xBE, 0x2E, 0x96, 0x57, 0x78, 0xFB, 0x11, 0x97, 0x4E, 0xFC, 0x93, 0x56, 0x57, 0x98, 0x2D,
+    0xB4, 0xE5, 0x26, 0xF0, 0x37, 0x4E, 0x86, 0x9B, 0xD8, 0x9E, 0x75, 0x4E, 0x69, 0xA2, 0x4D, 0x7F,
+    0x31, 0xD7, 0xDF, 0xD8, 0x5B, 0xB0, 0x3B, 0x35, 0xD3, 0xB2, 0xC8, 0x68, 0xB0, 0xD5, 0xAD, 0x19,
+    0x27, 0x65, 0x65, 0x06, 0x15, 0x88, 0x38, 0x3A, 0x35, 0x35, 0xE9, 0xE8, 0xC1, 0xB8, 0x4C, 0x81,
+    0x89, 0x29, 0x92, 0x95, 0xF8, 0xCE, 0xDC, 0x10, 0x93, 0x91, 0xF8, 0x8E, 0xAC, 0xC4, 0x77, 0xD4,
+    0x3A, 0xF8, 0x8E, 0x3C, 0xC5, 0x25, 0x71, 0x7A, 0x9C, 0xAC, 0xC4, 0x03, 0x59, 0x89, 0xEF, 0x38,
+    0x7E, 0x7C, 0x47, 0x0E, 0xE2, 0xBB, 0x49, 0xB7, 0x53, 0x06, 0xE1, 0x81, 0x52, 0x08, 0xDF, 0xD5,
+    0xCE, 0xFE, 0x9B, 0x06, 0x38, 0xD2, 0x14, 0xC5, 0xD7, 0x5F, 0x79, 0xEA, 0x3E, 0x8C, 0x6A, 0x5A,
+    0x8E, 0xB6, 0x09, 0x42, 0x67, 0xBA, 0x98, 0x29, 0x3C, 0x3B, 0x8A, 0x8B, 0x87, 0xF6, 0xD4, 0x86,
+    0x99, 0xBF, 0xCC, 0xBD, 0x34, 0x15, 0xA9, 0xB6, 0x9C, 0x57, 0xEB, 0x9F, 0xBE, 0xAB, 0xBA, 0xE0,
+    0x2F, 0x79, 0x8B, 0xBE, 0xA7, 0x9B, 0xFF, 0xEB, 0x14, 0x55, 0x99, 0xBE, 0xEF, 0x40, 0x6F, 0xB7,
+    0xD5, 0x5D, 0xEB, 0xD4, 0xD2, 0x59, 0xE9, 0x86, 0x68, 0x48, 0xD5, 0xA4, 0xE0, 0x2D, 0x53, 0x62,
+    0xE7, 0x6A, 0xFC, 0xAB, 0x0F, 0x00, 0x8F, 0x6F, 0x54, 0x4E, 0xD7, 0x5C, 0x72, 0x94, 0x10, 0xEA,
+    0xC6, 0x65, 0x4A, 0x92, 0x67, 0x95, 0x44, 0xB4, 0xBA, 0x9B, 0x2F, 0x8F, 0x2F, 0x78, 0x17, 0xC6,
+    0xE3, 0x5C, 0x94, 0x74, 0x0E, 0xB1, 0xAF, 0xDA, 0x72, 0xE1, 0x50, 0x0C, 0xFA, 0x47, 0x07, 0xCA,
+    0xEF, 0x7D, 0xE5, 0xF6, 0xBE, 0x92, 0x71, 0x7F, 0x32, 0x4E, 0xCE, 0x76, 0x28, 0x86, 0x17, 0x0B,
+    0x15, 0x7D, 0x34, 0xD1, 0x8E, 0x9F, 0xC4, 0x66, 0x13, 0x4E, 0xC3, 0xF6, 0x86, 0xA6, 0x5E, 0x91,
+    0xAF, 0xC6, 0x63, 0xE3, 0x70, 0xA2, 0xCA, 0xCF, 0xF9, 0x4C, 0x7A, 0x83, 0x53, 0x24, 0x63, 0x28,
+    0xA9, 0xF0, 0xFC, 0x91, 0xCC, 0x4C, 0xB7, 0xCA, 0xC5, 0x15, 0x79, 0x78, 0x6C, 0x8B, 0xF6, 0x45,
+    0x1D, 0x3B, 0x7C, 0xC5, 0xD7, 0x8F, 0xA8, 0x4A, 0xA0, 0xF7, 0xCA, 0x42, 0x3C, 0x0B, 0x19, 0xB7,
+    0x4F, 0x73, 0xC3, 0xAE, 0x03, 0x06, 0x2D, 0xDB, 0x44, 0xC6, 0x2C, 0x94, 0x96, 0x21, 0xD3, 0x40,
+    0x85, 0x30, 0x08, 0xF9, 0x79, 0xEA, 0xB2, 0xCA, 0x70, 0xEB, 0xC6, 0xEC, 0x0A, 0xF5, 0xEC, 0x64,
+    0xAC, 0xA2, 0xA4, 0x64, 0xA8, 0x72, 0x95, 0x91, 0x8A, 0x43, 0x02, 0x57, 0xA5, 0xB7, 0xE1, 0xCA,
+    0x30, 0x45, 0xB0, 0x0B, 0xA5, 0x64, 0xB0, 0xA3, 0x7C, 0x06, 0xC7, 0xB8, 0xC6, 0x10, 0xE1, 0xE7,
+    0x7D, 0xCA, 0xFD, 0x35, 0xEE, 0x95, 0x95, 0x7B, 0xC0, 0xA7, 0x45, 0x6F, 0x1E, 0x3E, 0xD5, 0xDB,
+    0x7E, 0x48, 0x57, 0x66, 0x06, 0xAA, 0x0F, 0x2B, 0xEE, 0xAA, 0xBE, 0x29, 0x29, 0xEC, 0x25, 0x89,
+    0x7B, 0x4D, 0xEA, 0x5E, 0x74, 0xD9, 0x99, 0xB8, 0x07, 0x6E, 0x21, 0x5D, 0x73, 0x0F, 0x6B, 0x37,
+    0xE9, 0xDE, 0x19, 0xBD, 0x9D, 0xB3, 0x7B, 0x57, 0x36, 0xF5, 0xA8, 0xB1, 0x07, 0x11, 0xA9, 0x6A,
+    0xC0, 0xA6, 0x85, 0xD1, 0x21, 0x77, 0x24, 0x78, 0xD6, 0x11, 0x61, 0x6D, 0x64, 0x08, 0x9C, 0x24,
+    0x81, 0x17, 0xC2, 0x91, 0xA6, 0xA6, 0x14, 0x22, 0xB5, 0xCA, 0x2A, 0x35, 0x81, 0xC8, 0x27, 0x2C,
+    0x2B, 0x7F, 0x74, 0x04, 0x2C, 0x9D, 0x9E, 0xBC, 0xEC, 0xA9, 0x2E, 0xC0, 0xC3, 0x25, 0x37, 0x7E,
+    0x4A, 0x66, 0x5C, 0xA7, 0x87, 0xCF, 0x48, 0x38, 0x29, 0xA0, 0x89, 0xD8, 0x25, 0xC2, 0xF9, 0x70,
+    0xDC, 0x84, 0xF6, 0xC8, 0xC8, 0xC6, 0x46, 0xF5, 0x4C, 0xCC, 0x7D, 0x4B, 0xD9, 0x18, 0x72, 0x27,
+    0xD3, 0xE4, 0xF2, 0xE9, 0x2E, 0xE4, 0xC6, 0x4D, 0x19, 0xC4, 0x6D, 0xE3, 0x70, 0xD6, 0x58, 0x44,
+    0xE3, 0x92, 0x8C, 0x22, 0xD6, 0x51, 0x25, 0x32, 0x92, 0xCC, 0xA4, 0x67, 0x55, 0x56, 0xB7, 0xCD,
+    0x84, 0x6B, 0xCB, 0x47, 0xBB, 0x99, 0x84, 0xF6, 0x98, 0x4F, 0x2E, 0x8C, 0x58, 0x93, 0x83, 0x91,
+    0x23, 0x18, 0xFD, 0xAD, 0x09, 0xEE, 0x78, 0x13, 0x6C, 0x7C, 0x5D, 0x45, 0x69, 0x27, 0x3F, 0x36,
+    0x45, 0xD7, 0x62, 0x77, 0xAB, 0x8F, 0x5D, 0x84, 0x6B, 0x5D, 0x93, 0xE1, 0x80, 0x05, 0x43, 0x53,
+    0x2C, 0xD9, 0xD8, 0x36, 0x67, 0x60, 0x21, 0xE9, 0xD4, 0xFC, 0xAB, 0xB9, 0xAB, 0x23, 0x28, 0x2D,
+    0xA1, 0x85, 0xFC, 0x00, 0xFA, 0x55, 0x2C, 0x8C, 0x9F, 0x97, 0xFD, 0xEC, 0xC3, 0xD0, 0xBA, 0x0E,
+    0xE7, 0xAA, 0xB2, 0x58, 0x84, 0x0A, 0x7A, 0xB0, 0x38, 0xA6, 0xD0, 0xCB, 0x56, 0xF2, 0x02, 0xF0,
+    0x79, 0x24, 0x7F, 0x85, 0xCA, 0x77, 0x68, 0x18, 0x5D, 0xDC, 0x0D, 0x4C, 0x8C, 0x33, 0xAF, 0x75,
+    0x37, 0x73, 0x40, 0x6A, 0x84, 0xE8, 0xD5, 0x9C, 0x51, 0xE5, 0x6B, 0xB4, 0x74, 0xFF, 0xB6, 0x76,
+    0xFD, 0x3C, 0xFF, 0x25, 0x77, 0x57, 0x88, 0x25, 0x9A, 0x88, 0xA2, 0x7D, 0x60, 0xCA, 0x8E, 0x2F,
+    0x41, 0x39, 0xD0, 0xD0, 0x5F, 0x84, 0x08, 0xFE, 0xAE, 0x59, 0x74, 0x6A, 0xD5, 0x99, 0x22, 0xDF,
+    0x77, 0x92, 0xF2, 0x15, 0x7D, 0xD8, 0x5E, 0x68, 0xDD, 0xC6, 0x32, 0xDB, 0xB7, 0x7E, 0xE3, 0x9E,
+    0x81, 0xD2, 0xBF, 0x6B, 0xA4, 0xFB, 0xCC, 0xFA, 0x47, 0xA9, 0xFA, 0xBB, 0x1A, 0x18, 0xD9, 0x30,
+    0x2C, 0xF2, 0xF8, 0xA8, 0x41, 0x11, 0xB5, 0xA1, 0xD7, 0xB6, 0xD3, 0x7A, 0xDD, 0x9B, 0xBE, 0x46,
+    0x79, 0x19, 0x2B, 0xEC, 0x55, 0xE0, 0x91, 0xF4, 0xA1, 0xDA, 0x2E, 0x10, 0xA3, 0xA4, 0x77, 0xDC,
+    0x98, 0xC1, 0x6A, 0x6A, 0xD0, 0x69, 0xC1, 0xD4, 0x68, 0x7D, 0xD9, 0x94, 0xE1, 0x81, 0xE9, 0xC2,
+    0x6B, 0xA6, 0x0A, 0xD7, 0x2A, 0x0E, 0xCC, 0x8E, 0xA3, 0x50, 0x1D, 0x54, 0xC4, 0xAA, 0xCD, 0xA7,
+    0x7E, 0xF3, 0xC3, 0xEA, 0xCA, 0xD3, 0x88, 0x07, 0x61, 0x4A, 0x91, 0xC4, 0xB5, 0x98, 0x72, 0x39,
+    0x64, 0xB4, 0xC8, 0xC9, 0xBD, 0x79, 0xA9, 0x72, 0x81, 0x88, 0x30, 0x4A, 0x68, 0x85, 0x65, 0xF8,
+    0xBE, 0xC4, 0x84, 0x72, 0x7C, 0x5C, 0xBE, 0x71, 0x51, 0xC8, 0xE7, 0xE4, 0xC9, 0x7F, 0x17, 0xBF,
+    0xFC, 0x9F, 0x61, 0xAA, 0xFF, 0x19, 0xE6, 0x72, 0x2C, 0x4F, 0xF1, 0xF7, 0xF1, 0xD4, 0xC3, 0x28,
+    0xE4, 0xBC, 0x3A, 0x79, 0xE3, 0x25, 0xCC, 0xCC, 0xC7, 0xD3, 0x3E, 0xE6, 0x16, 0xAC, 0xC0, 0x74,
+    0xCC, 0x2A, 0x6C, 0xC5, 0x3E, 0xEB, 0xF8, 0xD4, 0x94, 0x45, 0xD8, 0x62, 0x86, 0x51, 0x93, 0x57,
+    0x71, 0x83, 0x39, 0xC6, 0xF2, 0x94, 0x70, 0x96, 0x71, 0x95, 0x37, 0x97, 0x38, 0xBF, 0xA4, 0xC8,
+    0x9A, 0x6B, 0xFA, 0x24, 0x73, 0xEB, 0x29, 0x04, 0x53, 0x2F, 0xFD, 0x41, 0xC7, 0xD9, 0x5E, 0xF2,
+    0xD2, 0x3F, 0x69, 0xB9, 0xFA, 0x2F, 0x7B, 0xC9, 0x0F, 0x1B, 0x32, 0xE2, 0x00, 0x7B, 0x87, 0xAC,
+    0xD8, 0x47, 0x30, 0x95, 0x4C, 0xB8, 0x0D, 0x22, 0xD0, 0xF4, 0xE1, 0x0D, 0x0B, 0xF3, 0xE9, 0xB1,
+    0x8A, 0xBA, 0xA0, 0x1E, 0xA0, 0xC7, 0x9A, 0xB0, 0x0D, 0xB9, 0xAE, 0xB0, 0x8A, 0xA7, 0x58, 0x63,
+    0x3A, 0xC5, 0x1B, 0x6B, 0x17, 0x73, 0x9C, 0x22, 0x83, 0x53, 0xEC, 0xB1, 0x5E, 0x7A, 0x0D, 0xBB,
+    0xFE, 0x8D, 0x8B, 0x45, 0x4E, 0xF1, 0xC8, 0x29, 0x26, 0xA9, 0x71, 0x49, 0x17, 0x73, 0x8B, 0x5C,
+    0xC8, 0x0D, 0x03, 0x9C, 0x62, 0x94, 0x53, 0x9C, 0x72, 0x8A, 0x55, 0x4E, 0xF1, 0xCA, 0x29, 0x66,
+    0x39, 0xC5, 0x2D, 0xF3, 0xDD, 0x87, 0xE5, 0x48, 0x6B, 0x17, 0xC7, 0x74, 0xB1, 0xCC, 0x23, 0xBC,
+    0x14, 0xEB, 0xBB, 0x1E, 0x37, 0x3B, 0x61, 0xF6, 0xB5, 0x7A, 0x7D, 0xD8, 0x67, 0xA2, 0x95, 0xB0,
+    0x3B, 0x92, 0xDE, 0x85, 0x5D, 0x82, 0xAD, 0x7D, 0x88, 0x4E, 0x6B, 0xD4, 0x29, 0xD4, 0x05, 0xC3,
+    0xED, 0x75, 0xC5, 0x31, 0xD6, 0x55, 0xAA, 0x37, 0x3A, 0x34, 0x72, 0x53, 0x91, 0x51, 0x2E, 0x6F,
+    0x14, 0x74, 0xBE, 0xDE, 0x64, 0xA3, 0xF2, 0xA6, 0x5A, 0x57, 0x3E, 0x09, 0x8E, 0xA3, 0x7C, 0x12,
+    0x6E, 0xB2, 0xB9, 0x6D, 0x3A, 0x30, 0xC1, 0x46, 0xCF, 0x8C, 0x6F, 0x8A, 0xBD, 0x8E, 0xF1, 0x22,
+    0x8A, 0x83, 0xD4, 0x22, 0x3B, 0x87, 0xB3, 0x15, 0x35, 0xD9, 0xCF, 0xCE, 0x82, 0x3E, 0xAC, 0x1D,
+    0x4D, 0xDE, 0xCB, 0x29, 0x1D, 0x9D, 0x25, 0xF5, 0x1E, 0x4E, 0xE9, 0xDA, 0xF4, 0x70, 0xB4, 0xEB,
+    0x94, 0xF6, 0xC6, 0xAB, 0xF8, 0x43, 0x72, 0x4A, 0xA7, 0x91, 0xCA, 0x8C, 0x02, 0x75, 0x4A, 0x11,
+    0x95, 0xFB, 0x2B, 0xE5, 0x9E, 0x0A, 0x23, 0x99, 0xE9, 0x7F, 0xB0, 0x99, 0x53, 0x52, 0xBF, 0x7E,
+    0xA4, 0x32, 0x97, 0x26, 0x80, 0xBA, 0x35, 0xF8, 0x30, 0x5B, 0xA0, 0x8B, 0xDB, 0x30, 0x4D, 0x77,
+    0xE4, 0xF4, 0xF0, 0x9B, 0x32, 0xB9, 0x50, 0x27, 0x9A, 0xE8, 0xEC, 0x4A, 0x19, 0x77, 0x7C, 0xFC,
+    0xF4, 0x6C, 0xAF, 0x78, 0xC9, 0xDD, 0x17, 0x3F, 0xA9, 0x09, 0x9E, 0x66, 0x4E, 0xDB, 0xE8, 0xF5,
+    0xC3, 0x4D, 0xF0, 0x68, 0xF8, 0x53, 0xA3, 0x9F, 0xC9, 0x9B, 0x4F, 0x1E, 0x3F, 0xBE, 0x4D, 0x0A,
+    0x61, 0xF9, 0xED, 0x47, 0x30, 0xCA, 0x6B, 0x17, 0x31, 0xA2, 0x67, 0xF6, 0x41, 0x98, 0x67, 0x1E,
+    0x02, 0x5D, 0x1E, 0xFC, 0xE0, 0xA1, 0xFB, 0xF7, 0x93, 0x2B, 0x58, 0x64, 0x09, 0xB8, 0x0F, 0xC4,
+    0xCC, 0xBC, 0x4E, 0x1D, 0xD5, 0x7E, 0x46, 0x02, 0x4B, 0x9E, 0x77, 0xFE, 0xF0, 0x8A, 0x59, 0xF1,
+    0xFA, 0x93, 0xC8, 0x12, 0xA0, 0x66, 0xC7, 0xEF, 0xBD, 0x84, 0x19, 0x93, 0x41, 0xE0, 0x50, 0x3A,
+    0x3C, 0xF9, 0x0E, 0x22, 0x27, 0x75, 0x1B, 0x77, 0xB2, 0xE8, 0x45, 0x70, 0x25, 0x9D, 0xC8, 0x17,
+    0x11, 0xF7, 0x48, 0xBC, 0x21, 0x3A, 0x2D, 0xCC, 0x28, 0x2B, 0xE1, 0x30, 0x52, 0x70, 0x8D, 0x86,
+    0xC5, 0xF3, 0x06, 0xA1, 0xF0, 0x6A, 0xBA, 0x97, 0x8D, 0xC8, 0x1C, 0xF8, 0xE4, 0xE2, 0x59, 0xD0,
+    0x0E, 0xAF, 0xE8, 0x9D, 0xCB, 0x7F, 0xF2, 0xFB, 0x03, 0x57, 0x65, 0xEB, 0x6D, 0x61, 0x57, 0xA7,
+    0xD0, 0x3B, 0x42, 0x79, 0xB8, 0x10, 0x30, 0x28, 0xFC, 0xF1, 0xDF, 0x6F, 0x9F, 0x1C, 0x2C, 0x6F,
+    0xC2, 0x49, 0x3E, 0x7D, 0xF7, 0xB7, 0x77, 0xA3, 0xCB, 0xBD, 0xB9, 0x1F, 0x4A, 0x25, 0xFF, 0xC6,
+    0x0D, 0xCD, 0x81, 0x30, 0xA1, 0x40, 0x45, 0xE3, 0x95, 0xF4, 0xF9, 0x56, 0x2A, 0xFB, 0x91, 0x88,
+    0x68, 0x95, 0xBD, 0x69, 0xA1, 0x7F, 0xFF, 0xAC, 0xAD, 0xFB, 0xB5, 0x92, 0x41, 0x89, 0x19, 0x6C,
+    0x35, 0x6E, 0xED, 0x8F, 0xE6, 0x16, 0x8D, 0xE6, 0x13, 0xD5, 0xCE, 0x0B, 0x6A, 0x77, 0xEF, 0xF6,
+    0xEF, 0x81, 0xB9, 0x46, 0xD1, 0xF7, 0x54, 0x74, 0xA6, 0x8F, 0x29, 0x5D, 0x9F, 0x0D, 0x06, 0xF3,
+    0xC4, 0x46, 0xE3, 0x98, 0x66, 0x68, 0x1A, 0xCA, 0x63, 0xB8, 0x0C, 0x5C, 0xC3, 0xAF, 0x6A, 0xBC,
+    0x8A, 0x41, 0x79, 0xF9, 0xC0, 0xA3, 0xB1, 0x3A, 0x87, 0xC8, 0x85, 0x6C, 0xDE, 0x98, 0xFC, 0xF8,
+    0x2C, 0x07, 0x06, 0x87, 0x29, 0x30, 0xB8, 0xDD, 0x09, 0x0C, 0x7A, 0x6A, 0x63, 0xED, 0x86, 0x04,
+    0x7D, 0x87, 0xA2, 0xF0, 0xBB, 0x7B, 0x3F, 0xAC, 0x16, 0x62, 0x10, 0xC4, 0x12, 0x95, 0x8C, 0x2C,
+    0x13, 0x34, 0xB3, 0xAC, 0x89, 0x70, 0x74, 0xD2, 0xD9, 0x53, 0xE9, 0x4C, 0x5A, 0xAC, 0xF9, 0x0F,
+    0x91, 0x6D, 0xED, 0x53, 0x08, 0x83, 0x9E, 0x53, 0x8D, 0xD4, 0x9A, 0x87, 0xAA, 0xCA, 0xA6, 0x14,
+    0x4A, 0x30, 0x5E, 0x7F, 0x18, 0x8C, 0xB0, 0x28, 0x43, 0x36, 0x1E, 0x93, 0x1B, 0x57, 0x4D, 0x16,
+    0x9D, 0x1D, 0xAA, 0x3B, 0x2B, 0xB4, 0xA0, 0xB3, 0xA5, 0x41, 0x49, 0x3B, 0x66, 0x45, 0xBE, 0x3F,
+    0x2F, 0x52, 0x08, 0x23, 0x97, 0xC7, 0xAF, 0xC9, 0x7A, 0xA0, 0xC2, 0x10, 0xDE, 0xA7, 0x6B, 0xEC,
+    0x4A, 0x8D, 0x66, 0xE8, 0x68, 0x41, 0xE3, 0x74, 0xA5, 0xA4, 0xAA, 0x75, 0x9C, 0xBD, 0xE7, 0x82,
+    0x0B, 0x64, 0xE8, 0xE0, 0x99, 0xF8, 0xE7, 0x3A, 0xC8, 0xD5, 0x57, 0x61, 0x5A, 0xA8, 0x20, 0x23,
+    0x31, 0x1C, 0x19, 0x3B, 0x58, 0x89, 0x0F, 0xAC, 0x95, 0x99, 0xA1, 0xDA, 0xC6, 0x8C, 0xD5, 0xF4,
+    0xEE, 0x43, 0xF0, 0x29, 0x84, 0x64, 0xA8, 0x71, 0x81, 0xBF, 0x04, 0x8B, 0x6D, 0x28, 0xB5, 0xAE,
+    0x8C, 0x50, 0xF3, 0x87, 0xF8, 0xC0, 0xD0, 0x02, 0x4B, 0x9A, 0x37, 0xA4, 0x50, 0xD6, 0xA1, 0x90,
+    0x12, 0x1A, 0xC4, 0x23, 0x35, 0x30, 0xAA, 0x95, 0xB3, 0x83, 0xDC, 0x5F, 0x72, 0x12, 0x2D, 0x3D,
+    0x70, 0x5D, 0x29, 0xCC, 0x29, 0xD6, 0xEE, 0xF1, 0xFF, 0x13, 0xEA, 0x24, 0xA1, 0xFA, 0x05, 0xA1,
+    0xBA, 0x99, 0x50, 0x73, 0xB4, 0xA4, 0x9C, 0xF7, 0x48, 0x32, 0xE3, 0x02, 0x92, 0x39, 0xAA, 0x1E,
+    0x2F, 0x1E, 0xAB, 0x33, 0x1F, 0x77, 0x32, 0x55, 0x11, 0x23, 0x93, 0x31, 0x0D, 0xA6, 0xE4, 0x4D,
+    0x98, 0x4B, 0xE2, 0x62, 0xB4, 0x08, 0xAA, 0x81, 0x06, 0x17, 0x79, 0xDD, 0x27, 0x11, 0x1E, 0x3A,
+    0x2B, 0xAB, 0x7F, 0xA8, 0x71, 0xCE, 0x63, 0x08, 0xDE, 0x97, 0x64, 0x17, 0xC9, 0x0C, 0x73, 0x4E,
+    0x4E, 0x6D, 0x65, 0xD9, 0x70, 0xBA, 0x33, 0x63, 0xBD, 0x92, 0x78, 0x0A, 0xFC, 0x11, 0x1A, 0xC4,
+    0x6B, 0x0B, 0x61, 0x67, 0x8D, 0x59, 0xB8, 0x35, 0x94, 0xD2, 0x85, 0xD1, 0xBB, 0x40, 0x17, 0x20,
+    0x9F, 0xA2, 0xC0, 0x0C, 0x32, 0x6A, 0xFC, 0x40, 0x9F, 0xCC, 0x07, 0xE9, 0x4C, 0x8C, 0xCE, 0x8E,
+    0xF9, 0x1C, 0x43, 0x50, 0x19, 0x36, 0x4E, 0x26, 0xC6, 0xE0, 0x06, 0xEF, 0x3B, 0xEB, 0xD6, 0x36,
+    0xF5, 0xC8, 0x7D, 0x7D, 0xD5, 0x7E, 0x25, 0xC4, 0x9B, 0xF9, 0x83, 0x70, 0xB8, 0x39, 0x7A, 0x16,
+    0x4B, 0x90, 0x91, 0x59, 0x30, 0x01, 0x41, 0xAA, 0xB5, 0x67, 0xA1, 0x78, 0x0B, 0x27, 0xC0, 0xDD,
+    0xEE, 0x75, 0x45, 0x24, 0x3D, 0x25, 0x2F, 0xE7, 0xA5, 0x11, 0x05, 0x70, 0x5E, 0x43, 0x0A, 0x78,
+    0xD2, 0x98, 0x02, 0xEC, 0x78, 0x17, 0x54, 0xA0, 0x16, 0xB6, 0x48, 0xBD, 0xFA, 0x08, 0x08, 0xD6,
+    0x6B, 0x5C, 0x41, 0xB6, 0x88, 0x05, 0x16, 0xE4, 0x3A, 0xA5, 0xDE, 0x67, 0xCC, 0x05, 0xA9, 0xA0,
+    0x14, 0x78, 0x5F, 0x76, 0xD4, 0xF6, 0xAA, 0x9B, 0xA1, 0xCE, 0x4E, 0x67, 0xA6, 0xB3, 0xB2, 0xE4,
+    0x82, 0xFD, 0x87, 0x99, 0xCC, 0xDC, 0x51, 0xFB, 0x53, 0xAF, 0x59, 0x6B, 0xC9, 0x05, 0xCD, 0x2D,
+    0x70, 0xB4, 0x9A, 0x59, 0x70, 0x89, 0x05, 0x97, 0xD8, 0x5B, 0xC4, 0xF5, 0x02, 0x8D, 0xEB, 0xA9,
+    0x3D, 0x21, 0x1F, 0x72, 0x87, 0x88, 0xAF, 0x8B, 0x13, 0xC4, 0xA3, 0x9B, 0x6D, 0x83, 0x93, 0x57,
+    0x2E, 0x7F, 0xDF, 0x6D, 0x02, 0xC5, 0xF8, 0x68, 0xEC, 0x3C, 0x5B, 0x5A, 0xBA, 0x1A, 0xA9, 0x44,
+    0x5C, 0x4F, 0x66, 0x3C, 0xC7, 0xF5, 0x7A, 0xA6, 0x18, 0x64, 0xC8, 0x2B, 0x0C, 0x36, 0x19, 0x6E,
+    0x6E, 0x68, 0x7C, 0xC0, 0x66, 0xDA, 0xBB, 0x72, 0x06, 0xAA, 0xE6, 0xC8, 0x51, 0x37, 0x52, 0x27,
+    0x54, 0xFC, 0x5D, 0x19, 0xFD, 0x56, 0x59, 0x25, 0x9F, 0x50, 0xD3, 0xDB, 0x35, 0x0D, 0x22, 0x93,
+    0x01, 0xDF, 0xD5, 0x27, 0xC3, 0xC8, 0xD2, 0x95, 0x59, 0x49, 0x9C, 0xD1, 0xE0, 0x5C, 0x38, 0xA1,
+    0xFE, 0x58, 0x38, 0x31, 0x32, 0x7A, 0x26, 0x45, 0x68, 0x61, 0xE0, 0x49, 0x51, 0x73, 0x29, 0x8C,
+    0x6D, 0x6A, 0x50, 0x18, 0x54, 0x3D, 0x5D, 0x96, 0x0C, 0xD1, 0x12, 0x3E, 0xE5, 0x60, 0x85, 0x3E,
+    0x21, 0x62, 0xC2, 0x27, 0xB1, 0xDC, 0xD3, 0x96, 0x4F, 0x14, 0x81, 0x18, 0x14, 0xC5, 0x5E, 0xE3,
+    0x9C, 0xEA, 0xBC, 0x21, 0x9C, 0x82, 0x89, 0x1D, 0xFC, 0x04, 0xC3, 0x2B, 0x0B, 0xC3, 0x3E, 0x60,
+    0x48, 0x79, 0x1B, 0x58, 0x94, 0x47, 0x28, 0xD3, 0xAB, 0x27, 0xE5, 0xCF, 0xA0, 0x48, 0x47, 0xA1,
+    0x73, 0xB5, 0xFA, 0x53, 0xB5, 0xFA, 0x55, 0xD1, 0x78, 0x78, 0xD4, 0x29, 0x42, 0xCB, 0x19, 0x0C,
+    0xB6, 0x84, 0xA7, 0x3D, 0x57, 0x5A, 0xDC, 0xCE, 0xC5, 0x03, 0x9C, 0xD1, 0x60, 0x5B, 0x4F, 0x97,
+    0x63, 0x5D, 0xA9, 0x3A, 0xCD, 0x35, 0x66, 0x21, 0x63, 0x78, 0x62, 0xE3, 0xCD, 0x19, 0x30, 0x31,
+    0x75, 0x5F, 0xB2, 0x55, 0xA0, 0x86, 0x7E, 0xBE, 0xD2, 0x75, 0x52, 0x37, 0xBC, 0x8B, 0x5D, 0xCB,
+    0x7D, 0x25, 0x8E, 0xB3, 0x9A, 0x34, 0x6B, 0xB5, 0x68, 0xB2, 0xCE, 0xC4, 0x41, 0xCB, 0x3B, 0xF8,
+    0x8E, 0xDD, 0x94, 0x0E, 0x1A, 0xA4, 0x43, 0x84, 0x57, 0xC3, 0x9B, 0xE7, 0x35, 0x5A, 0xFF, 0x8A,
+    0x97, 0xBE, 0x53, 0x8A, 0x9F, 0x2D, 0xD6, 0xB1, 0x8C, 0x2B, 0xE9, 0xE0, 0xF0, 0xAD, 0xE4, 0x8D,
+    0x49, 0x9B, 0xC0, 0x4C, 0x86, 0x70, 0xC2, 0x16, 0xCD, 0x61, 0x0D, 0xE7, 0x45, 0x0D, 0x64, 0x0E,
+    0x8C, 0x62, 0x9D, 0xD6, 0x08, 0x73, 0x78, 0x04, 0x5C, 0x64, 0xF4, 0x7E, 0x41, 0xB6, 0x6D, 0xB1,
+    0xBF, 0xF5, 0xCA, 0xD7, 0xBA, 0xE1, 0x81, 0x4C, 0x34, 0xD9, 0x36, 0xA6, 0x03, 0x77, 0xC5, 0xCC,
+    0xF9, 0x80, 0x2B, 0xF5, 0x42, 0x43, 0xF0, 0x59, 0x45, 0x1F, 0xCF, 0x4D, 0x36, 0x19, 0xFF, 0x1A,
+    0x13, 0x7C, 0x63, 0x82, 0x1B, 0xA8, 0xBD, 0x14, 0xAE, 0xCE, 0x0B, 0x0B, 0xC2, 0x3F, 0x60, 0x6A,
+    0xED, 0xDB, 0x6F, 0x0A, 0xD7, 0x12, 0x0C, 0x13, 0xC1, 0xF7, 0xB0, 0xA7, 0x86, 0xDC, 0x30, 0xC8,
+    0xEE, 0xA4, 0xAE, 0xAC, 0x12, 0x5C, 0x9B, 0xF9, 0x5A, 0x32, 0xD7, 0x53, 0x12, 0x22, 0xA2, 0x9A,
+    0x14, 0xFA, 0x67, 0x02, 0xC4, 0x11, 0x87, 0x97, 0xAC, 0x68, 0x49, 0x0D, 0x64, 0x2A, 0xA3, 0x95,
+    0x9E, 0xAF, 0x9C, 0xC7, 0xDB, 0x03, 0xBC, 0x3C, 0x7D, 0x53, 0x48, 0x58, 0xCB, 0x4A, 0x17, 0x47,
+    0x26, 0x5D, 0x85, 0x70, 0x23, 0x84, 0x38, 0x59, 0xA3, 0xDE, 0x44, 0x73, 0x6E, 0x0B, 0xE0, 0x12,
+    0x09, 0x0B, 0xB7, 0x41, 0x86, 0x54, 0x63, 0x8F, 0xD0, 0xD5, 0x26, 0xAD, 0x4A, 0x5E, 0x84, 0x11,
+    0x78, 0xAB, 0xEC, 0x15, 0xE4, 0x67, 0x23, 0xBC, 0x50, 0x57, 0x1B, 0x17, 0x9A, 0x7F, 0x48, 0xB3,
+    0x0F, 0xDE, 0x0B, 0xB6, 0x41, 0x0F, 0x27, 0xBF, 0x59, 0x80, 0xD9, 0x26, 0x89, 0x4D, 0x59, 0x0B,
+    0xB7, 0x55, 0x08, 0x40, 0xF6, 0x5A, 0x68, 0xB5, 0xD9, 0x41, 0xC1, 0x09, 0xA3, 0x1E, 0xC4, 0x94,
+    0x5F, 0x16, 0xDA, 0x44, 0x2B, 0x38, 0x85, 0x48, 0x55, 0x0E, 0xC6, 0x77, 0x31, 0xD7, 0xAE, 0x83,
+    0xEC, 0xF2, 0x79, 0x7B, 0xFC, 0x08, 0x95, 0x26, 0x53, 0xC4, 0xC2, 0xC2, 0x1A, 0x2E, 0x44, 0xB5,
+    0x17, 0x02, 0x1A, 0xF5, 0x13, 0xA1, 0xF6, 0x5B, 0x30, 0x46, 0xBD, 0x74, 0x03, 0xED, 0xB6, 0xA1,
+    0x42, 0x4B, 0x40, 0x74, 0x9A, 0x95, 0xC8, 0x0E, 0xAD, 0x4B, 0x24, 0xD5, 0x6A, 0x80, 0x71, 0x08,
+    0xC5, 0xC1, 0x05, 0x01, 0xBF, 0xB4, 0x81, 0xE4, 0xAB, 0xE0, 0x56, 0x81, 0xF8, 0x58, 0xB3, 0xC2,
+    0xC2, 0xF8, 0x98, 0xDE, 0x35, 0x46, 0xB5, 0x57, 0x2C, 0xD6, 0x24, 0x28, 0xCE, 0xED, 0x53, 0x56,
+    0x3E, 0x58, 0x19, 0x62, 0xAB, 0xC5, 0x08, 0x06, 0x09, 0xC5, 0x85, 0x0F, 0x0D, 0x84, 0x5C, 0x83,
+    0x20, 0xD1, 0x7F, 0x15, 0xF5, 0xCD, 0xF0, 0x6C, 0xFD, 0x9D, 0x69, 0xE6, 0x93, 0x8B, 0xEF, 0x74,
+    0xE3, 0x2F, 0xCB, 0x5E, 0xA5, 0x33, 0xCF, 0x54, 0xEF, 0xE0, 0xB6, 0xB6, 0x72, 0xF9, 0xDC, 0x15,
+    0x04, 0x37, 0xE5, 0xC3, 0x6B, 0x99, 0x19, 0xF6, 0x54, 0xF8, 0xCE, 0x10, 0xAC, 0xCA, 0x46, 0xD6,
+    0x7F, 0xF3, 0x5C, 0x28, 0xDC, 0x95, 0x3D, 0x50, 0x3C, 0x07, 0x9D, 0x96, 0x36, 0xB9, 0xF7, 0x55,
+    0xCC, 0x27, 0xAB, 0x5E, 0xD5, 0xB8, 0x47, 0x5E, 0x58, 0x98, 0x39, 0xFF, 0x9A, 0x3E, 0xBC, 0x59,
+    0x3E, 0xB1, 0x76, 0xC1, 0x27, 0x2E, 0xE1, 0xF4, 0xAD, 0x51, 0x77, 0x71, 0xDA, 0x6C, 0x23, 0x0D,
+    0x53, 0x54, 0x1B, 0x7D, 0xC8, 0x7D, 0x7B, 0x28, 0x83, 0x0D, 0x34, 0xE9, 0x81, 0xF7, 0x6A, 0xB8,
+    0x96, 0x99, 0x16, 0xAF, 0x7A, 0x72, 0x0B, 0x37, 0x7E, 0x73, 0x27, 0xEC, 0xC2, 0x2E, 0x18, 0xA2,
+    0xA6, 0xFC, 0xDD, 0x46, 0x7E, 0x55, 0x46, 0x97, 0x0D, 0x5E, 0xBC, 0x42, 0x1C, 0x56, 0xC7, 0xEE,
+    0x17, 0xD3, 0xBA, 0x81, 0xAA, 0x78, 0x62, 0x0B, 0xAB, 0x63, 0x44, 0x18, 0xB8, 0x44, 0x88, 0x59,
+    0xA8, 0x0D, 0x7A, 0x9B, 0x2E, 0x84, 0x94, 0xD9, 0x7B, 0x72, 0x45, 0x51, 0xE0, 0x79, 0x5F, 0xB8,
+    0x09, 0x86, 0x87, 0xBD, 0xF3, 0xCE, 0x65, 0x69, 0x3D, 0x80, 0xCB, 0x01, 0xBE, 0xBD, 0xC3, 0x38,
+    0x1C, 0x88, 0x92, 0xBF, 0x59, 0xC3, 0x3E, 0x9A, 0xD6, 0x8D, 0x39, 0xE3, 0xF8, 0x4D, 0x31, 0x54,
+    0x7C, 0xE2, 0xEB, 0xF0, 0xC1, 0x7C, 0xB3, 0xCF, 0x7D, 0x89, 0xB5, 0x4D, 0x51, 0x1F, 0xD3, 0x0F,
+    0xC1, 0x55, 0xF3, 0xE0, 0x90, 0x29, 0xCC, 0x9A, 0x31, 0xE8, 0xAD, 0x38, 0xB5, 0x92, 0xDB, 0x51,
+    0x56, 0x60, 0xDA, 0x60, 0x1D, 0x66, 0x4D, 0x94, 0x43, 0x98, 0x7F, 0x31, 0x87, 0xB8, 0xBE, 0x95,
+    0xFF, 0xA6, 0x50, 0x72, 0x95, 0x23, 0x35, 0x5E, 0x60, 0xB5, 0x5F, 0xE1, 0x8C, 0xED, 0xEB, 0x65,
+    0xE1, 0x2B, 0x3E, 0xFA, 0x65, 0xAC, 0xD1, 0xA0, 0x9D, 0x52, 0x31, 0x2A, 0x3D, 0xF7, 0x4E, 0x64,
+    0x61, 0x3E, 0x09, 0x63, 0xCE, 0xE0, 0xE5, 0xC3, 0xC0, 0xCB, 0xE0, 0x24, 0x53, 0x7C, 0x0F, 0xF4,
+    0xEB, 0x41, 0x76, 0x8C, 0xA4, 0x67, 0xAA, 0x83, 0xE6, 0x39, 0xE2, 0x2D, 0xE1, 0xF1, 0x73, 0xAA,
+    0x0F, 0xB0, 0x21, 0xEF, 0xD2, 0xA0, 0x60, 0xB8, 0x5C, 0x56, 0x20, 0x23, 0xC0, 0xF4, 0x6B, 0x5B,
+    0x28, 0xB8, 0x94, 0x4A, 0x2F, 0x6B, 0x82, 0xC1, 0x69, 0xEA, 0xBC, 0x00, 0x74, 0xAF, 0x74, 0x21,
+    0x32, 0x97, 0x91, 0xA7, 0x97, 0x8E, 0x6B, 0xD4, 0xE0, 0xF5, 0x51, 0x85, 0x6B, 0x5C, 0xC0, 0x98,
+    0x4E, 0x30, 0x49, 0x2F, 0xA5, 0x16, 0xB9, 0x48, 0x55, 0xB6, 0x8F, 0x4F, 0x91, 0x6B, 0x49, 0x1C,
+    0x5C, 0xCD, 0xDA, 0x87, 0x9A, 0x1E, 0xEB, 0xC0, 0x14, 0xC6, 0x96, 0x18, 0x13, 0x40, 0xDB, 0xB1,
+    0x4D, 0xE5, 0xD7, 0xE4, 0x5A, 0x02, 0x23, 0xF1, 0x40, 0x09, 0x9F, 0x62, 0x83, 0xD8, 0x40, 0xBD,
+    0xDA, 0x3B, 0xC1, 0x0D, 0xF0, 0x07, 0x6A, 0x1B, 0x88, 0x8B, 0xC4, 0x9E, 0xB3, 0x5E, 0xEF, 0x65,
+    0xA7, 0xFE, 0x24, 0x46, 0x98, 0x6C, 0xBD, 0xE0, 0x6D, 0xF9, 0x84, 0x47, 0x06, 0x2F, 0xFA, 0xBE,
+    0x8C, 0xEF, 0xE2, 0x1D, 0x2F, 0x81, 0xA6, 0xDB, 0x2F, 0xBD, 0x4B, 0x18, 0xA9, 0xDC, 0xAF, 0x61,
+    0xAC, 0xAF, 0xE4, 0x5E, 0x87, 0xD1, 0x76, 0xF9, 0xA3, 0xB2, 0x21, 0x65, 0x74, 0xF9, 0xD7, 0x9B,
+    0x12, 0xE3, 0xCB, 0xBE, 0x0D, 0x4D, 0x15, 0x35, 0xD9, 0xDF, 0xD2, 0x5F, 0xAA, 0xD2, 0x0D, 0xC6,
+    0x5D, 0x42, 0x5C, 0x0E, 0x18, 0x27, 0x62, 0x42, 0x7B, 0x32, 0x52, 0x71, 0x1F, 0xEA, 0x41, 0xC6,
+    0x2A, 0xAE, 0x41, 0xDE, 0xEB, 0x48, 0xF7, 0x8A, 0x89, 0x63, 0x9E, 0x5B, 0x35, 0xDE, 0x68, 0xCE,
+    0x37, 0x0C, 0xE0, 0x53, 0x6B, 0xC7, 0xEC, 0xFB, 0xE3, 0xC3, 0xA7, 0x98, 0x54, 0x11, 0x49, 0x13,
+    0xDD, 0xBD, 0xA1, 0x60, 0x90, 0x8C, 0xAB, 0x46, 0xAF, 0xA6, 0x7E, 0xB0, 0x76, 0x70, 0x85, 0x06,
+    0xA2, 0xD9, 0x20, 0xAB, 0x46, 0xBE, 0xCD, 0xC7, 0x02, 0x80, 0xED, 0x8D, 0xDB, 0xDB, 0xA7, 0x34,
+    0x50, 0x02, 0x80, 0x4F, 0xD4, 0xC3, 0xAB, 0x58, 0xD3, 0x8A, 0x82, 0x03, 0xB5, 0xA1, 0xAE, 0xE3,
+    0x45, 0x96, 0x66, 0xB8, 0x11, 0xD9, 0x17, 0xAE, 0x31, 0xF3, 0x1E, 0xA0, 0x9E, 0x49, 0x04, 0x67,
+    0x0D, 0x5F, 0x85, 0xE5, 0x81, 0x84, 0xD8, 0x06, 0xD2, 0x77, 0xB5, 0x23, 0x7D, 0xBD, 0xF3, 0x98,
+    0xF1, 0xA3, 0x32, 0xF6, 0x0B, 0x63, 0x02, 0x16, 0x8C, 0x17, 0xA1, 0x6C, 0x86, 0x97, 0xE9, 0xDD,
+    0x21, 0x8D, 0x28, 0xEB, 0x1D, 0x33, 0x1E, 0x39, 0xE3, 0xED, 0xEC, 0xD1, 0x9C, 0xB9, 0x5B, 0xEE,
+    0x35, 0xE3, 0xFC, 0xF4, 0x8C, 0xB7, 0xD3, 0x8C, 0x21, 0xD9, 0x82, 0xB1, 0x83, 0x88, 0xAB, 0x7F,
+    0x84, 0x95, 0x9F, 0xFC, 0x8F, 0x56, 0x26, 0x94, 0xFC, 0x39, 0x3F, 0xE8, 0x7F, 0x11, 0xD4, 0xDA,
+    0x19, 0x9A, 0x5D, 0x2D, 0xAF, 0xDC, 0xA2, 0x77, 0xF6, 0xB9, 0xA5, 0xA7, 0x9A, 0x16, 0xFF, 0x0D,
+    0x66, 0x75, 0x41, 0x6F, 0x12, 0xB8, 0xE3, 0xBB, 0x7D, 0x9E, 0xAE, 0xCC, 0x3C, 0x08, 0xC7, 0xEF,
+    0x6E, 0xE9, 0x07, 0x62, 0x37, 0x74, 0x57, 0x4F, 0xA0, 0xA3, 0xD5, 0xC9, 0x4C, 0x9B, 0x39, 0x5E,
+    0x69, 0x71, 0xDC, 0xBB, 0x26, 0x53, 0x4E, 0xDA, 0x09, 0x40, 0x42, 0xC8, 0x58, 0xE4, 0x3D, 0x19,
+    0xB4, 0x56, 0x8A, 0x64, 0xC8, 0xCF, 0x2D, 0x71, 0xE5, 0x95, 0xD3, 0x4B, 0x75, 0xB1, 0xAB, 0xB0,
+    0x4E, 0x69, 0xAD, 0x6F, 0x9E, 0xAD, 0xB5, 0xC8, 0xA5, 0xAB, 0xCA, 0x27, 0x11, 0x31, 0xE4, 0x94,
+    0x58, 0x5B, 0xE4, 0xD5, 0x2D, 0x99, 0x96, 0x70, 0xEB, 0x18, 0xD6, 0x89, 0xF0, 0xEB, 0xDD, 0x22,
+    0x81, 0xDD, 0x8F, 0x30, 0xE8, 0x0A, 0x3C, 0x13, 0x56, 0xB5, 0xE0, 0x5A, 0xAF, 0xF2, 0x82, 0xCE,
+    0x8D, 0x72, 0x2E, 0xAF, 0x94, 0x77, 0x79, 0xA1, 0xDC, 0x2B, 0x8D, 0x7F, 0xB5, 0x71, 0xB0, 0x36,
+    0xA3, 0x69, 0x30, 0x2E, 0x0E, 0x66, 0x3B, 0x0D, 0x46, 0xF1, 0x71, 0x2F, 0x27, 0xCD, 0xC7, 0x2D,
+    0x4D, 0x1D, 0xE6, 0x8F, 0x67, 0x29, 0xBC, 0x27, 0x54, 0x06, 0x9F, 0xFC, 0x9A, 0xF9, 0xD6, 0x8C,
+    0xE8, 0x9F, 0x84, 0xA1, 0x4D, 0xA0, 0xA4, 0xB8, 0x64, 0x62, 0x06, 0x0E, 0x92, 0x8A, 0x09, 0x87,
+    0x82, 0x2C, 0xA2, 0x48, 0x3C, 0x60, 0x61, 0xCB, 0x3E, 0x75, 0xD8, 0x2B, 0xA4, 0x13, 0xF3, 0xE6,
+    0x8F, 0xD2, 0x91, 0xFC, 0x16, 0x0D, 0xDE, 0xEF, 0x93, 0x47, 0xFF, 0xCD, 0x53, 0x58, 0xC6, 0xE4,
+    0x3D, 0xA9, 0x72, 0x8D, 0x9A, 0xD9, 0xEB, 0xCF, 0x1C, 0x68, 0x48, 0xD8, 0xD5, 0x4F, 0x2E, 0x14,
+    0x3D, 0x35, 0xAF, 0xA4, 0x4D, 0xAC, 0xE3, 0x9E, 0xA5, 0xD5, 0x39, 0x0D, 0x37, 0xE7, 0x5A, 0x80,
+    0xB1, 0xE5, 0xD2, 0x08, 0xD6, 0x8C, 0xB9, 0x8A, 0x66, 0x2E, 0xA6, 0xB7, 0xB8, 0x1C, 0x88, 0xAE,
+    0x97, 0xF3, 0xE9, 0x6B, 0x57, 0xB8, 0xA6, 0xFE, 0x1C, 0xE2, 0xF8, 0x07, 0xE3, 0x30, 0x62, 0xCF,
+    0xE5, 0x6D, 0x06, 0x50, 0x49, 0x2E, 0x4C, 0x41, 0x36, 0x45, 0x3D, 0xE4, 0x5A, 0x9D, 0x62, 0x04,
+    0xAA, 0x89, 0xB2, 0x9B, 0x6E, 0xB4, 0x7C, 0xE4, 0x56, 0x00, 0x6B, 0xB6, 0xAA, 0x81, 0x41, 0x49,
+    0xDB, 0x1A, 0x1B, 0x2D, 0x13, 0x53, 0x2A, 0xC2, 0x16, 0xA0, 0x82, 0x2E, 0x8B, 0x12, 0x3C, 0x93,
+    0x8F, 0x17, 0x51, 0x8E, 0xF8, 0x43, 0x93, 0xAF, 0x90, 0xD4, 0x7C, 0x77, 0x3C, 0x16, 0x0F, 0x20,
+    0x1A, 0x6F, 0x72, 0x7F, 0x5F, 0xCD, 0x9F, 0x2F, 0x16, 0x79, 0x98, 0x5C, 0xB7, 0x7B, 0xA9, 0x08,
+    0x87, 0x41, 0xC1, 0x49, 0x1B, 0xB5, 0x45, 0x14, 0x11, 0xF5, 0x5D, 0xAD, 0x3A, 0x18, 0xDD, 0x96,
+    0x5C, 0x6A, 0xD2, 0x0E, 0x46, 0x77, 0x26, 0xC6, 0xD7, 0x75, 0xEC, 0x21, 0xB8, 0x5D, 0x5B, 0x42,
+    0x74, 0x06, 0xC2, 0x1C, 0x6B, 0xA6, 0xE8, 0xF3, 0x23, 0xCF, 0x25, 0x8C, 0x5D, 0x29, 0xCB, 0xC2,
+    0xD5, 0xCD, 0xA9, 0x93, 0x7E, 0x9F, 0x81, 0xDC, 0x1F, 0x6D, 0xC9, 0x25, 0xFA, 0x85, 0x15, 0x01,
+    0x6E, 0x1C, 0x25, 0x2D, 0xF8, 0x2F, 0xD3, 0xCA, 0xCF, 0x3B, 0xE3, 0xEB, 0xC7, 0xAA, 0xC6, 0xFF,
+    0x5D, 0x41, 0x35, 0x5E, 0x40, 0x8D, 0xBF, 0x4B, 0x35, 0xFE, 0x0D, 0x8E, 0xE0, 0x11, 0x52, 0x84,
+    0x06, 0x60, 0xC6, 0x51, 0xD1, 0x33, 0x0F, 0xB8, 0x88, 0xC2, 0x7E, 0x06, 0x79, 0x06, 0x13, 0xC2,
+    0x67, 0x2B, 0xEF, 0x3F, 0xC2, 0x98, 0xB0, 0xE7, 0x10, 0x3E, 0x49, 0x60, 0xFB, 0xA6, 0x30, 0xE9,
+    0xD2, 0x86, 0xFA, 0x81, 0x7E, 0x09, 0x06, 0x26, 0x6B, 0x83, 0x5E, 0xB5, 0x4C, 0x50, 0x8C, 0x75,
+    0xC0, 0x10, 0x57, 0x83, 0x2B, 0xED, 0x52, 0x33, 0xCD, 0x05, 0xBF, 0xA1, 0x65, 0xF1, 0x72, 0x7A,
+    0xC2, 0xAB, 0x9D, 0x45, 0x9B, 0x8F, 0x4A, 0x0E, 0xA5, 0x52, 0xD4, 0x29, 0x9D, 0xE4, 0x45, 0xA4,
+    0x94, 0x88, 0x84, 0x8D, 0x92, 0x45, 0xA9, 0x95, 0xB4, 0xFA, 0xC3, 0xB4, 0xE1, 0x0F, 0xEF, 0x2F,
+    0x12, 0x72, 0x13, 0x09, 0x04, 0x29, 0x81, 0x7A, 0x55, 0x00, 0x91, 0x10, 0x08, 0x99, 0xB6, 0x98,
+    0x51, 0xED, 0x7D, 0x7E, 0x2B, 0x9F, 0xF0, 0x48, 0x59, 0x7C, 0x75, 0x4B, 0x2A, 0xC2, 0x17, 0x24,
+    0x1D, 0xC5, 0x1D, 0x0C, 0xC7, 0x2A, 0x19, 0xA0, 0xE2, 0xAF, 0x7A, 0x93, 0x53, 0xF8, 0x09, 0x1C,
+    0xEF, 0xE7, 0x6D, 0xBC, 0x83, 0x8D, 0xF7, 0x6F, 0x6C, 0xBC, 0x5F, 0xB1, 0xE1, 0x5E, 0x33, 0xD1,
+    0x60, 0x22, 0xAE, 0xB4, 0xA4, 0x96, 0x8A, 0x08, 0x2F, 0x1E, 0x76, 0xC3, 0x93, 0x89, 0xFD, 0xD5,
+    0x03, 0x53, 0x49, 0x98, 0x78, 0x2B, 0x19, 0x2E, 0x39, 0x4C, 0x79, 0x9A, 0x58, 0xAF, 0x90, 0xAB,
+    0xF1, 0x8A, 0xDE, 0x81, 0xED, 0x4B, 0x1F, 0x1A, 0x29, 0x44, 0xC0, 0x26, 0xEA, 0xD4, 0xD5, 0xAF,
+    0x61, 0xA5, 0x89, 0x07, 0x04, 0x75, 0xA7, 0x17, 0x58, 0xF8, 0xAC, 0x28, 0x8B, 0xFB, 0x40, 0x68,
+    0x35, 0x3C, 0xD5, 0x1B, 0x9E, 0x6C, 0xB1, 0x61, 0xA1, 0xA3, 0xA2, 0x71, 0x05, 0xE8, 0x79, 0x50,
+    0x6B, 0x28, 0x47, 0xDC, 0x58, 0x05, 0x87, 0x70, 0x1D, 0xD9, 0x2D, 0xAF, 0x18, 0xD7, 0xCB, 0x0B,
+    0xAE, 0xE1, 0x52, 0x35, 0x62, 0x8D, 0x6A, 0xB1, 0x0D, 0x49, 0x28, 0x63, 0x18, 0x74, 0x14, 0x5B,
+    0xCC, 0xAD, 0x7C, 0x7E, 0x43, 0x62, 0xFF, 0xE6, 0x86, 0xF5, 0x65, 0xDF, 0xE2, 0x77, 0xE5, 0x63,
+    0xE4, 0xC8, 0x88, 0xAD, 0x27, 0x23, 0x0A, 0x37, 0x0F, 0x89, 0x57, 0xDD, 0x07, 0x44, 0xB4, 0x0A,
+    0x03, 0x5A, 0x8E, 0x6B, 0x6F, 0x1E, 0x17, 0xF6, 0xB1, 0x0B, 0xD1, 0x6D, 0x77, 0x16, 0x77, 0x30,
+    0xD5, 0x6A, 0x31, 0xA1, 0x10, 0xA1, 0x66, 0x2D, 0x26, 0x1D, 0xE0, 0x04, 0x92, 0xB1, 0x7A, 0x69,
+    0xF5, 0xA9, 0x84, 0x9E, 0xAD, 0x8B, 0x08, 0x90, 0x90, 0x60, 0x78, 0x72, 0x0D, 0xA9, 0xDE, 0x1A,
+    0x1D, 0xCC, 0x41, 0x42, 0x6C, 0xEA, 0x89, 0xCD, 0xE4, 0x20, 0xC9, 0x7C, 0x19, 0x20, 0x29, 0x2C,
+    0x6A, 0xD2, 0x2C, 0x2A, 0xBF, 0xE8, 0x2C, 0x67, 0x1A, 0xF4, 0xC9, 0x1D, 0x43, 0xE4, 0xCF, 0x1E,
+    0x50, 0x4B, 0x5D, 0xB6, 0xF1, 0xAB, 0x74, 0x18, 0x69, 0xCC, 0xFC, 0xCF, 0xD1, 0xE1, 0x66, 0x0E,
+    0xE7, 0xB8, 0x11, 0xEC, 0xC6, 0x1A, 0xCA, 0x59, 0x5D, 0xDC, 0x11, 0xD2, 0x05, 0x56, 0x67, 0x8D,
+    0x3F, 0xDE, 0x0A, 0xF9, 0x83, 0x8D, 0xBF, 0x61, 0x0E, 0x87, 0xBE, 0x9F, 0xBF, 0xD5, 0x62, 0xB7,
+    0x6D, 0x78, 0xFC, 0x14, 0x42, 0xE6, 0x9C, 0xB4, 0xFC, 0xE4, 0x6E, 0x0D, 0xF3, 0x2E, 0xEE, 0xE8,
+    0x5E, 0x8B, 0xD5, 0x0F, 0x1D, 0xC9, 0x5B, 0xDC, 0x25, 0x2D, 0xCD, 0xAB, 0x14, 0x31, 0x88, 0xAC,
+    0xC9, 0x48, 0x84, 0x42, 0xF6, 0x40, 0x2F, 0x1F, 0x9E, 0x17, 0x01, 0xD6, 0x42, 0xE9, 0x74, 0x9B,
+    0xAD, 0x87, 0xBD, 0x43, 0x5D, 0x57, 0xC8, 0x05, 0x0F, 0x80, 0x2D, 0x69, 0x41, 0xA0, 0x66, 0x37,
+    0x6B, 0x28, 0x75, 0x5C, 0xB7, 0x0C, 0xC6, 0xC2, 0x16, 0xAF, 0xC0, 0x05, 0xD1, 0x59, 0x48, 0xAC,
+    0x69, 0x2C, 0x4A, 0x9D, 0xDA, 0xE1, 0xC9, 0xCE, 0xE3, 0xB0, 0x10, 0x8B, 0x80, 0xE2, 0x4B, 0x57,
+    0x09, 0xD3, 0x68, 0x09, 0xB1, 0xA1, 0x72, 0xF5, 0xB1, 0x54, 0xAA, 0x2F, 0x23, 0xA9, 0xD1, 0xE6,
+    0x30, 0x61, 0x68, 0x60, 0xCA, 0x20, 0xFC, 0xDF, 0x9B, 0x22, 0xB3, 0xA5, 0xE7, 0x96, 0x3B, 0x63,
+    0xF6, 0x41, 0xBB, 0x53, 0x46, 0xF2, 0xB1, 0x06, 0x02, 0x82, 0x55, 0x5C, 0xC9, 0x36, 0x4B, 0xA1,
+    0x22, 0x90, 0x56, 0xE9, 0x90, 0x50, 0x28, 0xFC, 0x1D, 0xFF, 0xF1, 0xE3, 0x1C, 0x90, 0x7F, 0xE3,
+    0x05, 0x2C, 0xFC, 0xCE, 0x61, 0x3B, 0x35, 0x77, 0xD9, 0x32, 0xAC, 0x30, 0xE0, 0xB2, 0x75, 0x29,
+    0x4A, 0x86, 0xFC, 0x8B, 0x5F, 0x93, 0x0F, 0x8C, 0xF0, 0xBA, 0x54, 0xFE, 0x66, 0xD8, 0x17, 0xF5,
+    0xBF, 0x5D, 0x85, 0xBD, 0x3F, 0xCA, 0xE8, 0x68, 0xAA, 0x8B, 0xCC, 0xA3, 0xF2, 0x89, 0x35, 0xB8,
+    0x47, 0x39, 0x49, 0x21, 0x49, 0xF1, 0x49, 0xD9, 0x49, 0xC1, 0x49, 0xDB, 0x8E, 0x86, 0x1D, 0x4D,
+    0x3E, 0xDA, 0x79, 0xE5, 0xC9, 0xAD, 0xA9, 0xBB, 0xB2, 0x77, 0xA6, 0x4F, 0xE2, 0x4C, 0x5B, 0x62,
+    0x14, 0x2D, 0xBF, 0xFD, 0xA5, 0xEB, 0x6E, 0x8E, 0x0C, 0x3C, 0xAC, 0x0D, 0x40, 0xAD, 0x38, 0xE8,
+    0xCF, 0x4D, 0xA5, 0x9E, 0x1F, 0x6B, 0xC4, 0xEB, 0x83, 0x5B, 0xE9, 0xF8, 0xDD, 0x9A, 0x97, 0x9F,
+    0xC2, 0x4A, 0x3F, 0xD4, 0xA9, 0x89, 0xC8, 0x91, 0xE9, 0x0F, 0x22, 0x70, 0x9E, 0x13, 0x72, 0x1D,
+    0xC8, 0xFF, 0x1F, 0x44, 0x68, 0x2D, 0x24, 0xBE, 0x76, 0xA5, 0x66, 0x67, 0xCC, 0x8C, 0xCE, 0x4A,
+    0xA3, 0xFB, 0x51, 0xF7, 0x8C, 0x50, 0x57, 0xE4, 0x54, 0x87, 0xFF, 0x8B, 0xE4, 0x6D, 0xF2, 0x37,
+    0xEB, 0x22, 0x86, 0xD3, 0x7C, 0x1E, 0x5A, 0x87, 0xDE, 0x88, 0x18, 0xD1, 0xF2, 0x5F, 0x5A, 0x9D,
+    0x08, 0x70, 0x5C, 0x50, 0x40, 0xD6, 0x16, 0xDC, 0x0A, 0xF8, 0x1F, 0xCA, 0x1E, 0x7B, 0x30, 0x2A,
+    0xD6, 0xA4, 0x06, 0x6D, 0xEE, 0x94, 0x91, 0x4F, 0xF9, 0x2F, 0xFD, 0x41, 0x95, 0x8E, 0x0D, 0x34,
+    0x96, 0x58, 0x37, 0xD7, 0x1F, 0xA2, 0xC3, 0x18, 0xAF, 0xC7, 0x42, 0xFE, 0x2F, 0xEF, 0xBE, 0x73,
+    0x0A, 0xC9, 0x0A, 0x99, 0x0D, 0x91, 0x4D, 0x89, 0xBD, 0xD5, 0x45, 0xE1, 0xA0, 0x6C, 0x58, 0x16,
+    0x58, 0x15, 0x51, 0x37, 0x63, 0x9E, 0xF8, 0xFF, 0x56, 0xFD, 0x27, 0x87, 0x50, 0x93, 0x77, 0x0A,
+    0x6B, 0x1A, 0xD5, 0x93, 0xAA, 0xA6, 0x7E, 0x49, 0xD9, 0x8C, 0xD8, 0x05, 0x93, 0x02, 0x9B, 0x53,
+    0x2F, 0x06, 0x4C, 0xC1, 0xAF, 0xBB, 0x39, 0x93, 0x7F, 0xF2, 0x53, 0x09, 0x72, 0x2B, 0x54, 0xA8,
+    0xD4, 0xB6, 0xEC, 0x4E, 0x0C, 0xF2, 0xE4, 0x00, 0xDD, 0x20, 0xDD, 0xC7, 0xE0, 0xCF, 0xEF, 0xA8,
+    0xC9, 0x9A, 0xEF, 0x94, 0x1C, 0xBB, 0xDC, 0xCB, 0x91, 0x61, 0x3A, 0xA2, 0x46, 0x75, 0x7B, 0x54,
+    0xA5, 0xE6, 0x5B, 0x58, 0xE5, 0xC2, 0x54, 0xAF, 0xA0, 0xE6, 0xF5, 0x45, 0xCB, 0x49, 0xED, 0x5B,
+    0xC0, 0x7D, 0xDF, 0xAB, 0xDF, 0x02, 0xA7, 0x6F, 0xC1, 0x7B, 0xEA, 0x10, 0x4B, 0xA1, 0x2B, 0xE6,
+    0xE3, 0x2E, 0x6B, 0x22, 0x44, 0x70, 0x19, 0x19, 0xC3, 0x46, 0xEF, 0x69, 0xE5, 0xF3, 0xE7, 0xF4,
+    0xB2, 0xC4, 0x11, 0x80, 0x24, 0x11, 0x69, 0x8C, 0xC8, 0x8A, 0xE8, 0x9C, 0x02, 0xB1, 0x15, 0xAC,
+    0x8A, 0x3D, 0xF3, 0x08, 0xE7, 0x10, 0x13, 0x26, 0x7B, 0x61, 0x74, 0x79, 0x55, 0xDE, 0x06, 0xDD,
+    0xB0, 0x5B, 0x4E, 0xDE, 0x57, 0xF8, 0x2F, 0xFD, 0x0A, 0x86, 0x77, 0x31, 0x9D, 0x70, 0xB8, 0x71,
+    0xF3, 0xAD, 0x17, 0xAD, 0xD6, 0x74, 0x15, 0xBD, 0x73, 0x58, 0xBE, 0xFE, 0xD4, 0x1A, 0xF1, 0xBF,
+    0x2A, 0xD8, 0xD2, 0x30, 0xF5, 0x06, 0x77, 0xA3, 0x33, 0x3F, 0x50, 0x56, 0xF8, 0x5B, 0x68, 0x40,
+    0xD1, 0x13, 0xCC, 0x32, 0x45, 0xEB, 0x1C, 0x55, 0x10, 0x47, 0xAB, 0x12, 0x8B, 0x5B, 0x3D, 0x27,
+    0x91, 0xFB, 0x94, 0x66, 0x26, 0xCE, 0xAC, 0xB8, 0x7D, 0xE1, 0x5C, 0x27, 0xAE, 0x84, 0x68, 0x3B,
+    0xB9, 0x27, 0x4A, 0x3E, 0x8A, 0x35, 0x95, 0x6B, 0x2A, 0xD8, 0x54, 0xB2, 0x51, 0xB4, 0x79, 0x94,
+    0x6D, 0x16, 0x87, 0xA0, 0x74, 0x73, 0xF1, 0x97, 0xF5, 0x87, 0x16, 0x87, 0xF8, 0x52, 0x35, 0x27,
+    0xD6, 0xA8, 0xB0, 0x02, 0xCD, 0xCA, 0xB4, 0x9E, 0x13, 0x64, 0xB3, 0x24, 0xFB, 0x59, 0xC7, 0xF7,
+    0xB4, 0x6A, 0xD3, 0xEA, 0x3F, 0x4A, 0x1D, 0x4B, 0x31, 0xA7, 0xC3, 0xAD, 0xFC, 0xAC, 0xF8, 0xE4,
+    0x45, 0x44, 0x65, 0x84, 0x5E, 0x48, 0x9F, 0x8F, 0xB5, 0x2D, 0xD5, 0xB5, 0x09, 0xEA, 0x95, 0xAA,
+    0xE5, 0xB2, 0xE3, 0x79, 0x7E, 0x7A, 0xE3, 0x08, 0x3F, 0x1B, 0x6A, 0xFF, 0x53, 0x52, 0x3B, 0x26,
+    0xB5, 0xD3, 0x79, 0x6D, 0x68, 0xDA, 0xD1, 0x21, 0xE4, 0xAD, 0x12, 0x4A, 0xBE, 0xBE, 0xC8, 0x5F,
+    0xF9, 0xC5, 0x9D, 0x45, 0x02, 0xFC, 0x3C, 0x35, 0x60, 0x6A, 0xD5, 0x70, 0x55, 0x09, 0xD3, 0x56,
+    0xB6, 0x5E, 0x73, 0x45, 0x34, 0xF2, 0x54, 0x51, 0x5E, 0x16, 0xA6, 0x56, 0xF2, 0xE9, 0xA1, 0xC2,
+    0x83, 0x36, 0x9F, 0xC8, 0x74, 0xEF, 0x35, 0x58, 0x95, 0xFA, 0xA0, 0xDD, 0x29, 0xE4, 0xD7, 0x9E,
+    0x75, 0x0F, 0x1B, 0xCF, 0x66, 0xA8, 0x98, 0xA5, 0x91, 0x65, 0x3F, 0x80, 0xEF, 0x35, 0x58, 0xBE,
+    0x49, 0x17, 0xBE, 0xCD, 0xEA, 0x1F, 0xB1, 0x7C, 0x9F, 0x6A, 0x13, 0x86, 0xE9, 0xD2, 0xB4, 0xBD,
+    0xCC, 0x87, 0xFD, 0xB4, 0xBD, 0xC6, 0x87, 0x3E, 0x6D, 0x99, 0xC1, 0xFA, 0xD1, 0x2A, 0xF9, 0x13,
+    0xC2, 0xEA, 0x7F, 0xDC, 0x24, 0x7F, 0x06, 0xC6, 0xC5, 0xEF, 0x16, 0x5A, 0x43, 0x21, 0x6A, 0x27,
+    0xD9, 0x5A, 0x59, 0x8C, 0xB1, 0xB7, 0x37, 0x22, 0x88, 0xCD, 0x90, 0xCC, 0x1A, 0xF5, 0xA1, 0x4C,
+    0xC5, 0x5D, 0xDD, 0x43, 0xCE, 0x8D, 0xFF, 0x80, 0x15, 0x32, 0xB5, 0x70, 0x48, 0xE6, 0x92, 0x23,
+    0x0D, 0xD8, 0x78, 0x97, 0x91, 0xC6, 0xC2, 0x0C, 0x06, 0x84, 0x90, 0x6F, 0x8B, 0xF6, 0x48, 0x30,
+    0x0D, 0xDC, 0x7C, 0x06, 0x78, 0x5A, 0x26, 0x62, 0xF2, 0x16, 0xCD, 0x0E, 0x44, 0xC1, 0xA3, 0xBF,
+    0x81, 0xFF, 0xC3, 0x95, 0xAC, 0x9E, 0xFC, 0xB1, 0xEF, 0xAD, 0x64, 0xC4, 0xF9, 0xAF, 0x44, 0x9D,
+    0x8C, 0x21, 0xFF, 0xF5, 0xE8, 0xC7, 0x28, 0xAE, 0x5A, 0xB3, 0xA9, 0x47, 0xD6, 0x85, 0x0A, 0xA4,
+    0xA1, 0xE4, 0xCE, 0x14, 0x86, 0xA9, 0xB0, 0x87, 0xF4, 0x6C, 0xD8, 0xC3, 0xDE, 0xE1, 0x78, 0x78,
+    0x95, 0x29, 0x27, 0x19, 0xD6, 0x77, 0xC6, 0xC7, 0xD7, 0xDE, 0x25, 0x59, 0x6A, 0xAF, 0x78, 0xFB,
+    0x32, 0xDA, 0x57, 0x4E, 0xC0, 0x47, 0x89, 0x10, 0xB5, 0x62, 0xC5, 0xCE, 0xD7, 0x7A, 0xA5, 0x19,
+    0xFC, 0x40, 0xD4, 0x21, 0xCC, 0xE0, 0xDE, 0x30, 0x45, 0x53, 0x99, 0x22, 0xFC, 0xAE, 0x02, 0xEB,
+    0xBC, 0xB6, 0x62, 0xC5, 0x73, 0x23, 0x14, 0xE2, 0x5C, 0xAC, 0xA8, 0x4A, 0x48, 0xA3, 0xC7, 0x2E,
+    0x7C, 0x6C, 0xF1, 0x63, 0x0B, 0x20, 0x6B, 0x04, 0xD9, 0x42, 0xC8, 0x26, 0xBB, 0xB1, 0x16, 0xE3,
+    0x4E, 0xB5, 0xD0, 0xFF, 0x79, 0x91, 0x8B, 0x1E, 0xEA, 0xA7, 0x03, 0x18, 0x67, 0xAD, 0x4E, 0xFE,
+    0x86, 0xCB, 0xC3, 0x87, 0x16, 0x12, 0xD2, 0x0F, 0x1A, 0x87, 0xDC, 0xD2, 0x01, 0xA6, 0xFA, 0x81,
+    0xFF, 0x8A, 0xB5, 0xB6, 0x8A, 0x7A, 0xE1, 0x57, 0x3C, 0x1C, 0xAD, 0x72, 0x6F, 0xCA, 0xE2, 0xEF,
+    0x82, 0x1C, 0x48, 0xC5, 0x0B, 0xA8, 0x6A, 0x02, 0x25, 0xD5, 0x13, 0x02, 0x35, 0xE3, 0x35, 0x8D,
+    0xCA, 0x92, 0x51, 0x64, 0xD0, 0x55, 0x51, 0x02, 0xD0, 0x43, 0xDA, 0x7C, 0x22, 0xA7, 0x2A, 0x85,
+    0xE1, 0xF6, 0x4B, 0x9E, 0xAA, 0x63, 0x87, 0x8A, 0x53, 0x28, 0x06, 0x7E, 0xC9, 0x90, 0xCE, 0x42,
+    0x6D, 0x05, 0x13, 0x7B, 0x53, 0x01, 0x99, 0xD3, 0xAA, 0x0E, 0x37, 0xCC, 0x48, 0x01, 0x63, 0x76,
+    0x56, 0x7E, 0xE7, 0x9F, 0x7E, 0x5A, 0x99, 0x30, 0x17, 0x6E, 0xB8, 0xA7, 0xAC, 0x71, 0x7F, 0x91,
+    0xCF, 0x4F, 0x95, 0x81, 0xA9, 0x09, 0x2F, 0x69, 0xBC, 0x40, 0x31, 0xFE, 0x80, 0x8D, 0x2A, 0xC8,
+    0x5F, 0x16, 0x7B, 0x0D, 0xD3, 0xE5, 0xAF, 0x30, 0x88, 0x8D, 0x59, 0xDA, 0x56, 0x8E, 0x3E, 0x15,
+    0x77, 0xA9, 0xBD, 0x0A, 0x9F, 0x55, 0xF4, 0x2C, 0x0C, 0xBC, 0xFA, 0xC9, 0x0D, 0x4D, 0x07, 0x99,
+    0x16, 0x27, 0xBB, 0xF5, 0xB6, 0xDC, 0xA2, 0x70, 0x79, 0x2A, 0xEF, 0x85, 0x80, 0xB9, 0x6D, 0x87,
+    0xE6, 0x08, 0xD7, 0xFE, 0x30, 0x4D, 0x52, 0xF4, 0xD8, 0x4B, 0xA0, 0x6B, 0xAC, 0x95, 0xC8, 0xC9,
+    0x2A, 0xD4, 0x9B, 0x7E, 0xA7, 0x48, 0x87, 0x94, 0x39, 0x23, 0x58, 0x4D, 0x62, 0x97, 0x20, 0x1F,
+    0x51, 0x57, 0x69, 0x01, 0x95, 0x3C, 0x12, 0xBA, 0x12, 0x19, 0x26, 0xF5, 0xFC, 0x4E, 0xB3, 0x01,
+    0x23, 0xAF, 0xD1, 0x56, 0xCB, 0x7E, 0x82, 0xB7, 0x15, 0x72, 0xFC, 0x7D, 0x35, 0x27, 0xBE, 0xA1,
+    0xE0, 0x18, 0x8D, 0xDF, 0x1F, 0xA8, 0xD8, 0xBE, 0xA5, 0xC8, 0xDB, 0x8E, 0xF6, 0x4F, 0xA0, 0xD8,
+    0xA5, 0x68, 0x42, 0xCB, 0x33, 0xFE, 0x91, 0xFC, 0x00, 0xB7, 0xFD, 0xF4, 0x35, 0xC8, 0x85, 0x5B,
+    0x59, 0x03, 0xD0, 0x69, 0x97, 0x57, 0x4C, 0x71, 0xE5, 0xD5, 0xC8, 0x9A, 0x14, 0x24, 0x92, 0x12,
+    0xB1, 0x10, 0x6A, 0x54, 0x99, 0x30, 0x95, 0x7F, 0x4D, 0xF1, 0x2D, 0xE2, 0xCD, 0xCB, 0x98, 0xE0,
+    0xCD, 0x7B, 0x75, 0x23, 0xAB, 0x7F, 0x23, 0x36, 0x59, 0x29, 0xB7, 0x64, 0x51, 0x4E, 0xB1, 0x04,
+    0xA3, 0x73, 0xE0, 0xC1, 0x1F, 0xB1, 0xA4, 0xF4, 0xB7, 0xB8, 0xB3, 0x39, 0xCE, 0x8B, 0x2C, 0x87,
+    0xDC, 0xE7, 0x28, 0x7B, 0xDD, 0x1E, 0xB0, 0xF8, 0xC3, 0xB7, 0xEF, 0x42, 0x2C, 0x7E, 0x03, 0x23,
+    0x7C, 0x24, 0x69, 0x65, 0x80, 0xFB, 0x09, 0xC6, 0xF7, 0x0A, 0xD2, 0xE9, 0x7E, 0x97, 0x55, 0x35,
+    0xD2, 0x5C, 0x32, 0x2E, 0xF1, 0x12, 0x80, 0x53, 0xEE, 0xF2, 0x60, 0x5C, 0x8D, 0x9D, 0x18, 0x4D,
+    0x9D, 0x89, 0x8C, 0xCB, 0x9E, 0x13, 0x1B, 0xEA, 0xBA, 0xB4, 0x5A, 0xA2, 0xAA, 0xE2, 0x23, 0x1C,
+    0x1D, 0xFE, 0x36, 0xE2, 0x4A, 0x25, 0xAC, 0x2F, 0x73, 0xB8, 0xB1, 0x4B, 0x34, 0x6B, 0x69, 0xB9,
+    0xC2, 0xD0, 0xA5, 0x27, 0xD6, 0xE3, 0x09, 0x3B, 0xC2, 0xEF, 0x60, 0xBD, 0xD1, 0xAE, 0x6E, 0xCC,
+    0x8C, 0xF4, 0x62, 0x56, 0x7E, 0x84, 0x13, 0x66, 0x2F, 0x9A, 0x9E, 0xC0, 0x92, 0x6B, 0xF9, 0xD7,
+    0xAD, 0x26, 0xA2, 0xCF, 0x1F, 0xD3, 0xA7, 0x60, 0x55, 0x86, 0x5A, 0x69, 0x1B, 0x36, 0x35, 0x3E,
+    0x01, 0x88, 0x2B, 0xAD, 0xD1, 0x84, 0x77, 0xE2, 0x6D, 0xAD, 0xE9, 0xC7, 0x81, 0xBF, 0x31, 0x2C,
+    0xE2, 0x6D, 0xA1, 0xB4, 0x62, 0xA9, 0xFA, 0x60, 0xA3, 0x01, 0x8B, 0xB0, 0x63, 0x48, 0x47, 0x16,
+    0xBB, 0xB8, 0xB7, 0xE2, 0xF4, 0x62, 0xB1, 0x97, 0xDB, 0xA8, 0xFB, 0xF2, 0xB8, 0x12, 0xF7, 0x7B,
+    0x1C, 0xC4, 0xA4, 0x9A, 0x00, 0x84, 0x58, 0xE2, 0x42, 0x6F, 0x2C, 0xF1, 0x44, 0x4B, 0xA6, 0x2E,
+    0x29, 0x6E, 0xF1, 0xDF, 0x52, 0x1D, 0x7B, 0x1D, 0x33, 0x44, 0x41, 0xAB, 0xBE, 0x53, 0xB3, 0xA5,
+    0x91, 0x8C, 0x6C, 0xF8, 0x9A, 0x6C, 0x9F, 0x96, 0xF8, 0x8D, 0xBB, 0x83, 0xF8, 0x64, 0x9D, 0xBF,
+    0xDA, 0x20, 0x6C, 0x1B, 0xBE, 0xB6, 0xCE, 0xE4, 0x16, 0x3F, 0xDA, 0x8B, 0x33, 0xDD, 0xA6, 0x61,
+    0x97, 0x36, 0x69, 0xB3, 0x1F, 0x32, 0x44, 0x73, 0x2B, 0xEA, 0x92, 0x55, 0xFE, 0x7C, 0x1F, 0xAF,
+    0xD2, 0x2E, 0xFF, 0xC6, 0x36, 0x69, 0xEB, 0x4D, 0x9E, 0x6E, 0x93, 0x66, 0xDC, 0x18, 0xA5, 0x86,
+    0xA9, 0x97, 0x0A, 0xDB, 0xBB, 0xBC, 0x64, 0xD8, 0xA5, 0xC0, 0x90, 0x9B, 0x71, 0x63, 0xF8, 0x26,
+    0xDB, 0xED, 0xB7, 0x55, 0x12, 0x04, 0x96, 0xA3, 0x52, 0xFB, 0x2E, 0xEE, 0x32, 0x83, 0x1B, 0x2B,
+    0xEA, 0x3B, 0x18, 0x74, 0x07, 0x1D, 0xA9, 0x64, 0x8E, 0xCC, 0x83, 0x49, 0x65, 0x61, 0x30, 0xC6,
+    0xD7, 0xD4, 0x81, 0xE2, 0x2F, 0x07, 0x5F, 0xE1, 0x53, 0x5B, 0xFA, 0x5F, 0x1B, 0x25, 0xB3, 0xEC,
+    0x67, 0x92, 0x96, 0x5B, 0x78, 0xF0, 0x34, 0x64, 0x4D, 0x80, 0xA8, 0x2C, 0x4C, 0x80, 0x9B, 0x10,
+    0x68, 0x65, 0x61, 0xBC, 0xD0, 0xB0, 0xAE, 0xB2, 0x2D, 0xEA, 0xA6, 0xF2, 0x37, 0xF2, 0x15, 0xAA,
+    0xA6, 0xE2, 0x7E, 0x51, 0xD9, 0xCA, 0xD7, 0x9A, 0xE8, 0x2B, 0xD5, 0xD3, 0x92, 0x6D, 0x7E, 0x59,
+    0x11, 0x9B, 0xDC, 0x89, 0x2B, 0x4D, 0xA5, 0xF4, 0xBA, 0xC9, 0x37, 0x2C, 0xFA, 0xDB, 0x1B, 0xB6,
+    0xF6, 0xE7, 0x80, 0xAC, 0x0E, 0x47, 0xDF, 0x63, 0xBF, 0x9B, 0xEC, 0x79, 0xD6, 0x26, 0x72, 0x5F,
+    0xE6, 0xBA, 0x21, 0xCB, 0x22, 0x57, 0x8C, 0x4D, 0x29, 0xFF, 0x93, 0x45, 0x79, 0x47, 0x3E, 0x5D,
+    0x26, 0x88, 0x00, 0xCC, 0x91, 0x88, 0xB1, 0xEB, 0x69, 0x2F, 0xA3, 0x13, 0x6D, 0xB2, 0x76, 0x95,
+    0x5C, 0x08, 0x5F, 0xA5, 0x5A, 0xCB, 0xC5, 0x48, 0x16, 0x60, 0xB6, 0x77, 0x6F, 0xDC, 0xB8, 0xD9,
+    0x39, 0x98, 0xAD, 0x6B, 0x81, 0x00, 0xA1, 0x91, 0xE9, 0x86, 0x00, 0x33, 0x6E, 0x4F, 0xE5, 0x40,
+    0x9A, 0xE7, 0xE0, 0x4F, 0x62, 0xB7, 0x27, 0xB4, 0x14, 0x59, 0x23, 0xAB, 0xCD, 0x6D, 0x17, 0x26,
+    0x49, 0xFE, 0x7B, 0xE7, 0xB4, 0x6E, 0xFC, 0x6E, 0x33, 0xB7, 0xF1, 0x39, 0x9E, 0xB4, 0x00, 0xE3,
+    0x8B, 0xD8, 0x19, 0xF9, 0x6B, 0x1B, 0xEB, 0x6E, 0xE0, 0x8D, 0xC1, 0xC6, 0x50, 0xEB, 0xC1, 0x36,
+    0x5C, 0x47, 0xEA, 0xA2, 0x02, 0x15, 0x62, 0x10, 0xEE, 0xB8, 0x8B, 0x88, 0xBA, 0xA4, 0x4B, 0x13,
+    0x75, 0x56, 0x8F, 0x95, 0x35, 0xB1, 0x3E, 0x56, 0x4C, 0x23, 0xE0, 0xD1, 0x02, 0xDE, 0x04, 0xEB,
+    0x16, 0xFE, 0x60, 0x0E, 0xC4, 0x58, 0x44, 0x40, 0x49, 0xC9, 0x58, 0xB1, 0x49, 0xFA, 0x9F, 0x1F,
+    0xEF, 0x7A, 0xE3, 0x75, 0xEC, 0x12, 0x50, 0xC7, 0x75, 0x93, 0xD3, 0x7D, 0x82, 0x12, 0x86, 0x2D,
+    0x5C, 0x19, 0x9A, 0x15, 0x23, 0x98, 0x17, 0x20, 0x82, 0x29, 0x56, 0x76, 0x84, 0xCC, 0x3F, 0x40,
+    0x50, 0xB4, 0x65, 0xD7, 0x22, 0x0A, 0x69, 0xCD, 0x5A, 0xC9, 0x7D, 0x1E, 0x6B, 0x7B, 0x9E, 0xEC,
+    0xA6, 0x9B, 0xF3, 0x1A, 0x3B, 0x66, 0xFC, 0xE1, 0xDD, 0x11, 0x26, 0xC7, 0x10, 0x75, 0xC8, 0x72,
+    0x84, 0x9B, 0x78, 0x85, 0xB1, 0x6A, 0x20, 0x53, 0x76, 0xCD, 0x2A, 0x69, 0xB0, 0x6D, 0x72, 0xF9,
+    0x3F, 0xFE, 0xA5, 0x2E, 0x10, 0x98, 0xCA, 0x9F, 0x1F, 0x19, 0x5E, 0xCB, 0xBF, 0xB1, 0x09, 0xC6,
+    0x3E, 0x1A, 0xF2, 0x74, 0x25, 0xF2, 0x15, 0x12, 0x20, 0xAC, 0xC0, 0x8A, 0x60, 0x05, 0x0B, 0xD7,
+    0x5B, 0x3F, 0x87, 0xC6, 0x42, 0xCF, 0xF5, 0x53, 0x81, 0xC3, 0x05, 0xAA, 0x90, 0xF1, 0x5D, 0xD4,
+    0x3D, 0xB2, 0x5C, 0x23, 0xEE, 0xCD, 0xC4, 0xC1, 0x43, 0xAB, 0x6E, 0x36, 0xF5, 0x79, 0x61, 0x3D,
+    0x10, 0x92, 0x05, 0xB0, 0x92, 0x96, 0xD5, 0x39, 0x70, 0xF9, 0x86, 0xF5, 0x2F, 0x20, 0x26, 0xEC,
+    0xA8, 0x5F, 0xB4, 0xFB, 0x18, 0x17, 0x85, 0x4C, 0xA7, 0x4B, 0x8B, 0x46, 0x0D, 0x5A, 0x4C, 0x66,
+    0x36, 0x63, 0x17, 0x17, 0x46, 0x96, 0x6E, 0xC1, 0x00, 0x63, 0xAB, 0x80, 0x9D, 0x52, 0x25, 0xB9,
+    0x1E, 0x89, 0xC1, 0xD9, 0x5E, 0xD0, 0x25, 0x3A, 0xC2, 0xB9, 0x3D, 0xB6, 0xC2, 0x77, 0x04, 0xD3,
+    0x5E, 0xF0, 0x7E, 0x5D, 0x44, 0x28, 0x3E, 0x32, 0x4B, 0x5E, 0x97, 0x0F, 0xF8, 0x5B, 0xFB, 0x68,
+    0x56, 0x92, 0x88, 0xCF, 0x8D, 0x2C, 0x92, 0xCC, 0x27, 0x07, 0xEE, 0x2C, 0x5B, 0xF4, 0x3B, 0x53,
+    0x88, 0x6E, 0xEB, 0x05, 0x37, 0x40, 0x34, 0x90, 0xC5, 0x7F, 0x7C, 0x98, 0x5E, 0x3B, 0xD5, 0x42,
+    0x58, 0x95, 0x89, 0xA1, 0x73, 0x39, 0xF4, 0x87, 0xEB, 0xB5, 0xC7, 0x6A, 0x8E, 0xEC, 0xCD, 0xDD,
+    0x30, 0x9B, 0x77, 0x4E, 0x54, 0xDE, 0xF3, 0xB5, 0x2E, 0x0D, 0xF1, 0xEE, 0x8B, 0x4B, 0xA6, 0xE6,
+    0xB6, 0x3E, 0x8A, 0x16, 0xD6, 0xE5, 0x16, 0x98, 0x82, 0x71, 0x8D, 0x91, 0x20, 0x6D, 0x80, 0x7B,
+    0xA3, 0x7D, 0x33, 0x88, 0xC8, 0x44, 0x35, 0x7D, 0x15, 0x02, 0xC6, 0x80, 0xE1, 0xD2, 0xD9, 0x29,
+    0x69, 0x85, 0x77, 0x0A, 0x39, 0x62, 0x46, 0x43, 0xAD, 0x51, 0x66, 0x1C, 0xD2, 0x96, 0x70, 0x31,
+    0x58, 0x42, 0x4C, 0x0A, 0x12, 0x3D, 0x87, 0xFD, 0x6A, 0x72, 0x29, 0xE9, 0xC3, 0x35, 0x21, 0x9F,
+    0x43, 0xD4, 0x67, 0xBD, 0x37, 0x55, 0x34, 0x78, 0xE7, 0xEA, 0xE1, 0xB7, 0x97, 0xC9, 0xD9, 0x29,
+    0x27, 0x93, 0x36, 0xDE, 0xB2, 0x54, 0xCD, 0xD9, 0x16, 0x5A, 0x13, 0x0C, 0x46, 0xDD, 0x35, 0x97,
+    0x6D, 0x2A, 0x03, 0x27, 0x6F, 0x35, 0x44, 0xAD, 0xD9, 0x3D, 0xBD, 0x9A, 0x53, 0x58, 0x59, 0xE3,
+    0x8A, 0x29, 0xDD, 0x93, 0x7A, 0x57, 0x52, 0xE1, 0x63, 0xB4, 0x2E, 0x37, 0xDE, 0xA5, 0x64, 0xF3,
+    0xF7, 0xC5, 0xFD, 0x0C, 0xA1, 0xCC, 0x0E, 0x3C, 0x28, 0xB7, 0x6B, 0xDE, 0x65, 0x19, 0xF9, 0x6D,
+    0xB9, 0xF6, 0x62, 0x3F, 0x5C, 0x92, 0x5D, 0xBE, 0xF6, 0x2E, 0xCA, 0xD6, 0xE8, 0xBD, 0x8B, 0x62,
+    0x28, 0x75, 0xA2, 0xE3, 0x01, 0x31, 0xDC, 0xA7, 0xFB, 0xF0, 0x4C, 0xDA, 0x88, 0x5F, 0xF2, 0x72,
+    0xDA, 0xC4, 0xAD, 0xBF, 0xC2, 0x46, 0x09, 0x9B, 0xB4, 0x4D, 0x1A, 0x74, 0xDA, 0x4A, 0x9B, 0xE7,
+    0x60, 0xEE, 0xFE, 0xD9, 0xDA, 0xF0, 0x26, 0x62, 0xD6, 0x6D, 0x67, 0x24, 0x74, 0xE9, 0xCD, 0x78,
+    0xE8, 0x61, 0x6E, 0x0F, 0x79, 0xAF, 0x8A, 0xB2, 0x29, 0x26, 0xAB, 0x73, 0xCE, 0xAC, 0x73, 0x47,
+    0x85, 0x35, 0x26, 0x32, 0xC3, 0x1F, 0x35, 0x3A, 0xA9, 0xFE, 0x1E, 0x0D, 0x50, 0x14, 0xC4, 0x35,
+    0xB4, 0xFC, 0x98, 0xD6, 0xC6, 0xE6, 0x89, 0xF4, 0x96, 0xF4, 0x0F, 0x21, 0xD0, 0x93, 0xFC, 0x64,
+    0x04, 0x7A, 0x38, 0x85, 0x8E, 0x2B, 0xDB, 0xAC, 0x47, 0x6F, 0xB5, 0x16, 0x6E, 0xFB, 0x58, 0x13,
+    0xF3, 0x7D, 0x65, 0x82, 0x7E, 0x1B, 0xEE, 0x9B, 0x2B, 0x6F, 0xE0, 0x0D, 0x6B, 0xA6, 0x65, 0x6C,
+    0x23, 0xD5, 0xB8, 0xA8, 0xF5, 0x76, 0x89, 0xB4, 0x56, 0x41, 0x5E, 0xCB, 0x7D, 0x55, 0xDE, 0xE5,
+    0x30, 0x63, 0x63, 0x94, 0x21, 0xD4, 0xF6, 0xA6, 0x40, 0xEF, 0x5D, 0x20, 0xEA, 0xC5, 0x2A, 0xC1,
+    0xEF, 0xA3, 0x1C, 0x3E, 0x5C, 0xC7, 0x9D, 0x6B, 0x2E, 0xA8, 0xC8, 0x99, 0xB1, 0xC7, 0x65, 0xBC,
+    0xB9, 0xCE, 0xC5, 0x7A, 0x5B, 0x97, 0x95, 0xFF, 0x8D, 0x9E, 0xAA, 0x80, 0xEB, 0x0B, 0x9E, 0x6B,
+    0x03, 0xA1, 0xAA, 0xB6, 0x2A, 0x8D, 0xD9, 0x68, 0x40, 0x21, 0x78, 0xED, 0x40, 0x33, 0xA8, 0xAF,
+    0x93, 0x31, 0xF2, 0x36, 0x76, 0xF1, 0x96, 0x81, 0x2E, 0x1A, 0x43, 0xAB, 0xC2, 0xCA, 0xEC, 0x68,
+    0xCE, 0x28, 0xB5, 0x9F, 0x55, 0xD2, 0x6F, 0xA8, 0x2E, 0x80, 0x71, 0xF5, 0x29, 0x48, 0x31, 0x1F,
+    0xC6, 0x95, 0x06, 0x2D, 0x65, 0x18, 0xD5, 0x21, 0x1F, 0x55, 0xEB, 0xD7, 0x8C, 0x5D, 0xC8, 0x4D,
+    0x5B, 0x49, 0x15, 0x14, 0x43, 0xD6, 0xE9, 0x22, 0x7F, 0x4C, 0x65, 0xC8, 0x6F, 0xA9, 0x10, 0xF9,
+    0xB6, 0x46, 0xCE, 0x6E, 0xEA, 0xEA, 0x7E, 0x55, 0xD7, 0xA2, 0x1A, 0xA2, 0x9A, 0x84, 0x9F, 0x7A,
+    0x7D, 0xCC, 0x11, 0xCE, 0x2B, 0x48, 0xC6, 0xC7, 0x1B, 0xE4, 0xB2, 0x73, 0x1A, 0x5C, 0xAF, 0x7E,
+    0x05, 0x56, 0x01, 0xAB, 0x00, 0xA0, 0x9D, 0xB7, 0x5C, 0xE5, 0x03, 0xED, 0x70, 0xED, 0x6A, 0x55,
+    0x53, 0x85, 0x97, 0x0C, 0x80, 0x94, 0xD4, 0xE3, 0xF9, 0xD7, 0x18, 0x4C, 0xF9, 0x16, 0xE5, 0xC7,
+    0xBF, 0x63, 0x30, 0x85, 0x43, 0xB1, 0x90, 0xCA, 0xDF, 0x9C, 0x0C, 0xA9, 0x24, 0xDD, 0xA2, 0xE0,
+    0xF3, 0x05, 0x46, 0xDA, 0xC8, 0x10, 0xAC, 0x52, 0x87, 0x89, 0xB4, 0x16, 0x2D, 0xB7, 0x75, 0x9F,
+    0xA9, 0x81, 0x53, 0x9C, 0x44, 0xF5, 0x7D, 0xCA, 0xE9, 0xFF, 0xA5, 0xE7, 0x5F, 0xA4, 0x38, 0x1A,
+    0x99, 0xFE, 0x85, 0xBF, 0x29, 0xA6, 0x10, 0x3E, 0x6A, 0x13, 0x61, 0x5D, 0x5F, 0x66, 0x6D, 0xD8,
+    0xE7, 0x96, 0xAD, 0x86, 0x7F, 0xF6, 0xFC, 0xF2, 0x4E, 0x97, 0x89, 0x5B, 0xA9, 0xB8, 0x05, 0xF5,
+    0x64, 0x0B, 0x67, 0x26, 0x70, 0x45, 0xB7, 0x3A, 0x83, 0x30, 0x6B, 0x5D, 0xBD, 0x18, 0x64, 0xB7,
+    0xD5, 0x93, 0x4D, 0xB5, 0xF2, 0x7E, 0x41, 0xFB, 0x69, 0x4C, 0x81, 0x79, 0xE1, 0xEF, 0x8D, 0x17,
+    0x44, 0xE8, 0xF7, 0x04, 0x2F, 0x8E, 0x08, 0x84, 0xAF, 0x13, 0x2D, 0x76, 0x1A, 0xBC, 0x60, 0xAD,
+    0x45, 0xDF, 0xF0, 0xCD, 0xB5, 0xEF, 0x03, 0x2C, 0xC0, 0xA0, 0xC3, 0xA3, 0xC8, 0x29, 0xD1, 0x29,
+    0x1D, 0x34, 0x2B, 0x24, 0x49, 0x15, 0xAE, 0x28, 0x4D, 0xE0, 0xBD, 0x46, 0x8D, 0x13, 0x2C, 0x4D,
+    0xCC, 0x47, 0x14, 0x70, 0x8A, 0x20, 0x65, 0xC0, 0x15, 0x56, 0x41, 0x46, 0xC9, 0x03, 0x59, 0xB3,
+    0xDA, 0xD7, 0x26, 0x52, 0xB0, 0xB7, 0x6E, 0x69, 0xD9, 0x00, 0xF2, 0x83, 0x9D, 0x6B, 0x2D, 0x18,
+    0xFE, 0x98, 0x26, 0x04, 0x95, 0xCE, 0xBB, 0xAC, 0x53, 0xC6, 0x88, 0xA8, 0xEF, 0x6B, 0x96, 0xA2,
+    0x53, 0x2C, 0xC6, 0x4A, 0x9C, 0xCD, 0x54, 0x92, 0xEE, 0xCF, 0xB6, 0x71, 0xB4, 0x3A, 0xAB, 0x78,
+    0x29, 0x9F, 0x29, 0xBB, 0x9D, 0x7F, 0x75, 0x2A, 0x1D, 0xFC, 0x5A, 0x3D, 0xB5, 0x11, 0x9B, 0x35,
+    0x53, 0xE0, 0x7C, 0x79, 0x15, 0x7E, 0x00, 0xCF, 0x6D, 0x22, 0x22, 0x15, 0xB3, 0xBB, 0xE3, 0xA3,
+    0x04, 0x7F, 0x41, 0xC0, 0xA2, 0x02, 0x02, 0xF0, 0x7E, 0xD0, 0xE3, 0x0E, 0x42, 0xA3, 0xC8, 0x29,
+    0x3F, 0x07, 0x6D, 0x2B, 0x7A, 0xC4, 0x7B, 0x15, 0x91, 0x1F, 0x78, 0x74, 0xB7, 0xD9, 0x81, 0x58,
+    0xBE, 0x5B, 0x33, 0xF2, 0x23, 0x3F, 0xEF, 0xF9, 0x10, 0x75, 0x41, 0xC7, 0x28, 0x50, 0xD8, 0x87,
+    0x6D, 0x89, 0x68, 0x8B, 0x98, 0xA4, 0xA8, 0x93, 0xCD, 0xDA, 0x60, 0x2D, 0x8E, 0x71, 0xC5, 0x6C,
+    0x5A, 0x46, 0x34, 0x58, 0xE1, 0x6D, 0x58, 0x32, 0x25, 0xE4, 0xD8, 0xDC, 0x52, 0xD5, 0xEF, 0x0D,
+    0xA0, 0x6A, 0xA4, 0x26, 0x77, 0x34, 0x60, 0x1E, 0x2C, 0xFF, 0x1C, 0x6C, 0xD2, 0x84, 0x1F, 0x3E,
+    0xEB, 0xA6, 0x74, 0xAA, 0x8F, 0xDA, 0x44, 0x22, 0xC3, 0x2D, 0x4D, 0xCB, 0xE7, 0xCA, 0x53, 0xAE,
+    0xB3, 0xCF, 0xE8, 0x54, 0xF8, 0xF1, 0x89, 0xCC, 0x91, 0xF5, 0xBB, 0xD2, 0x32, 0xA0, 0x9A, 0x95,
+    0x2F, 0xA9, 0x75, 0x99, 0xFC, 0xF3, 0x2D, 0xDC, 0xC1, 0xED, 0xB9, 0x95, 0x62, 0x0A, 0xAD, 0xC0,
+    0x07, 0x2B, 0x16, 0x4B, 0x39, 0x5A, 0xD3, 0x51, 0x0E, 0x37, 0xA1, 0x76, 0x58, 0x89, 0xD4, 0xA6,
+    0xE2, 0x32, 0xA4, 0x0A, 0xA1, 0xCC, 0x22, 0x56, 0x7E, 0xC3, 0x55, 0x18, 0x6D, 0x68, 0xD0, 0xC5,
+    0xEC, 0x6D, 0x21, 0x4B, 0x4A, 0x2D, 0xAC, 0x4E, 0xAB, 0x4B, 0x57, 0x56, 0x2A, 0xA2, 0x1A, 0xAF,
+    0xA2, 0xA9, 0xAD, 0x19, 0x82, 0x70, 0xAB, 0x9E, 0x07, 0xD6, 0xD3, 0x39, 0xA4, 0x75, 0xFC, 0xF1,
+    0xE8, 0x7F, 0x63, 0x00, 0xF9, 0xD4, 0x10, 0xA2, 0x5A, 0x94, 0xBE, 0x99, 0xAD, 0xB2, 0x93, 0x7A,
+    0xD0, 0xF2, 0xEA, 0x68, 0xEB, 0xB9, 0xBE, 0xBE, 0x31, 0x67, 0x98, 0xFF, 0xE9, 0x3B, 0x83, 0x95,
+    0xA3, 0xB0, 0x1C, 0xA6, 0xC2, 0x5E, 0xCC, 0x1B, 0x55, 0xA5, 0x5A, 0xF8, 0xAA, 0xCA, 0xDC, 0xAE,
+    0xEC, 0xF0, 0xC2, 0xF0, 0x57, 0x45, 0xEE, 0x90, 0x47, 0x00, 0x96, 0x59, 0x78, 0x2B, 0x72, 0x05,
+    0x6B, 0xC9, 0xFF, 0xDE, 0x94, 0x8D, 0x6B, 0x29, 0xA5, 0xC1, 0x24, 0x8D, 0x26, 0x87, 0xBB, 0xCD,
+    0xC2, 0xCF, 0xB9, 0x30, 0x7F, 0x3D, 0xB8, 0xC5, 0x3A, 0xDE, 0x2D, 0xD4, 0x7C, 0xBA, 0xA0, 0xE2,
+    0x22, 0xF2, 0x5F, 0x38, 0x3A, 0xD9, 0x3E, 0x6F, 0x92, 0x29, 0xD3, 0xA7, 0xB9, 0x85, 0x70, 0xC1,
+    0xC5, 0x67, 0x1F, 0x3A, 0x21, 0x88, 0x8E, 0x06, 0x91, 0x45, 0x2B, 0x3A, 0x1C, 0xA2, 0xC7, 0x19,
+    0x4A, 0xCE, 0x64, 0x2A, 0xAC, 0x39, 0x48, 0x9A, 0x3B, 0xBA, 0x1C, 0xE3, 0x86, 0xDD, 0xA4, 0xB6,
+    0xDE, 0x9E, 0x87, 0xAA, 0x7C, 0x13, 0x47, 0xE9, 0xCA, 0x44, 0x54, 0x6A, 0xF5, 0x35, 0xF2, 0x60,
+    0x51, 0xBD, 0x74, 0x65, 0x2E, 0x51, 0xBA, 0x32, 0xB2, 0x67, 0xAD, 0x6B, 0x68, 0xD0, 0x96, 0x2E,
+    0x2E, 0xA5, 0x26, 0xFF, 0xFC, 0x50, 0x36, 0x26, 0x09, 0xEB, 0x6A, 0x74, 0x52, 0x6E, 0x34, 0xE3,
+    0xCA, 0x1E, 0x64, 0x53, 0xDA, 0xF4, 0x37, 0x30, 0xA9, 0xF6, 0x08, 0x84, 0x2E, 0x11, 0xF2, 0x60,
+    0xF9, 0x4E, 0x0B, 0x4B, 0x54, 0xFE, 0x4B, 0xD7, 0xD1, 0x78, 0x1C, 0x69, 0xD1, 0xDF, 0x0F, 0xC8,
+    0x52, 0x98, 0x67, 0x19, 0xE3, 0x87, 0x48, 0xAC, 0x59, 0xF0, 0x2E, 0x7B, 0xC3, 0xF6, 0x00, 0x16,
+    0x77, 0xF8, 0x26, 0x4B, 0x58, 0xA2, 0xE2, 0x1C, 0x2B, 0x4B, 0x82, 0xFE, 0xFC, 0x82, 0xA6, 0xFE,
+    0x7A, 0x49, 0x4F, 0xB5, 0x67, 0xAD, 0x27, 0xD9, 0xEE, 0xD7, 0x21, 0x20, 0xA6, 0x40, 0x6F, 0x20,
+    0x0D, 0x53, 0x7E, 0xB7, 0xAB, 0x9F, 0x5A, 0xF9, 0xDB, 0xA0, 0xDF, 0x20, 0xD8, 0xE2, 0x77, 0xEB,
+    0x40, 0xEC, 0x28, 0xBF, 0xFA, 0xD5, 0x60, 0xA3, 0x4D, 0xD2, 0x54, 0x75, 0x07, 0x1B, 0xDA, 0xD3,
+    0x8C, 0xC6, 0x4E, 0x37, 0xB1, 0xAE, 0xD8, 0xD5, 0x6F, 0x4D, 0xAB, 0x34, 0xEC, 0x4B, 0xCD, 0xA8,
+    0x94, 0xAA, 0x55, 0xF4, 0xD6, 0xCA, 0xAF, 0xA8, 0xA5, 0x15, 0x20, 0xCA, 0x2C, 0xF6, 0x2D, 0x82,
+    0x3C, 0xC9, 0x30, 0x96, 0x6F, 0xAF, 0x91, 0xFA, 0x8D, 0x31, 0x61, 0x82, 0x5E, 0x77, 0x32, 0x13,
+    0x2E, 0x2F, 0x1B, 0xDC, 0xAD, 0x5F, 0x22, 0xBF, 0xFC, 0xF6, 0x2B, 0xD6, 0x5F, 0xB1, 0xF8, 0x9C,
+    0x7F, 0xA6, 0xBE, 0xFA, 0x3B, 0x99, 0xCD, 0x38, 0x7F, 0x78, 0x78, 0xA8, 0x0A, 0x1A, 0xBF, 0x7A,
+    0xF0, 0xE4, 0xEB, 0xE8, 0xF2, 0xF0, 0xCB, 0x61, 0xF1, 0x4F, 0xCE, 0x24, 0xD1, 0x27, 0x2B, 0xEF,
+    0xE1, 0x04, 0x5C, 0x6D, 0xE9, 0x8F, 0x8E, 0xFD, 0x65, 0x36, 0x60, 0xA4, 0xCA, 0x4D, 0x95, 0x4C,
+    0x32, 0x2E, 0xE1, 0xA3, 0xBF, 0xD2, 0xD0, 0xA6, 0xF5, 0xFB, 0x3B, 0x65, 0xBF, 0xA4, 0x8B, 0x0C,
+    0xF4, 0x09, 0xDF, 0xFB, 0xCC, 0xAB, 0x6E, 0x7E, 0x95, 0x05, 0x46, 0x5D, 0xF5, 0x9E, 0xB8, 0xD1,
+    0x84, 0xA0, 0xEC, 0xCE, 0xB3, 0x2C, 0xCC, 0xBC, 0x7F, 0xAF, 0x6E, 0xBA, 0x97, 0xEA, 0x5C, 0xE6,
+    0xDA, 0xF4, 0x64, 0xF2, 0x54, 0x12, 0x40, 0x52, 0xCA, 0x82, 0x0D, 0x26, 0x14, 0x9B, 0x0D, 0xBC,
+    0xD8, 0xCF, 0x59, 0x7B, 0xAE, 0x95, 0x77, 0xAA, 0x2B, 0x79, 0x59, 0xED, 0x5C, 0xA6, 0x86, 0x05,
+    0x56, 0xC7, 0xB5, 0xF6, 0x5D, 0x5E, 0xB9, 0x9E, 0x9A, 0xA0, 0x7B, 0x9B, 0xFB, 0xE1, 0x78, 0xE6,
+    0x4E, 0xE8, 0x9E, 0x36, 0xB2, 0x25, 0xFD, 0xE3, 0x95, 0x17, 0x80, 0xBB, 0xF1, 0x0A, 0x6B, 0x7D,
+    0xCB, 0xC4, 0xFE, 0xD6, 0x19, 0xB5, 0x0C, 0x1F, 0xC7, 0xA0, 0x42, 0xF2, 0xBD, 0x01, 0x2C, 0x7B,
+    0xF5, 0xF3, 0xC2, 0xF6, 0x07, 0x72, 0xC4, 0xA9, 0xD3, 0x81, 0xA9, 0x1E, 0x42, 0x98, 0xB4, 0xA7,
+    0x14, 0x34, 0x1A, 0x40, 0x2E, 0x25, 0x6C, 0xBA, 0x8D, 0xF7, 0xB2, 0x0A, 0x23, 0xD5, 0xF1, 0x2F,
+    0x2C, 0x16, 0x20, 0xA4, 0xF8, 0x5A, 0xE8, 0xD3, 0xCB, 0x82, 0x05, 0x92, 0xC0, 0xFB, 0xC7, 0x4E,
+    0xE2, 0x5F, 0x18, 0x9B, 0x87, 0xE5, 0xDF, 0xEA, 0x6D, 0xD8, 0x0D, 0x45, 0xE0, 0x1A, 0x5B, 0xC8,
+    0xAE, 0x7D, 0xD5, 0x7B, 0x46, 0xA4, 0x58, 0xA4, 0xE8, 0x8B, 0x4A, 0xEC, 0x3B, 0x78, 0xC9, 0xC5,
+    0x81, 0x45, 0x71, 0xD0, 0x16, 0xE8, 0xF2, 0x93, 0x63, 0xF7, 0xB2, 0x77, 0xD4, 0x5D, 0x71, 0xD0,
+    0xC8, 0x6C, 0xD1, 0xAC, 0x6D, 0x6E, 0x3E, 0x2F, 0xA6, 0x5C, 0x3D, 0x0B, 0x8B, 0x66, 0x2E, 0x1B,
+    0x0F, 0x8B, 0xB0, 0xF2, 0xEE, 0xF7, 0x15, 0xB8, 0x86, 0x64, 0xAC, 0xD8, 0xD6, 0x25, 0x01, 0xB1,
+    0x95, 0xFE, 0x0E, 0x45, 0xEE, 0xE5, 0x7F, 0xD1, 0x01, 0x00, 0xC2, 0xB6, 0x29, 0xCF, 0x20, 0x29,
+    0xF7, 0x90, 0xE6, 0x59, 0xFF, 0x11, 0x13, 0x4A, 0x1F, 0xD2, 0xD7, 0xBF, 0x76, 0x0F, 0xFF, 0x46,
+    0x21, 0x45, 0x3A, 0xA0, 0x36, 0x1D, 0xA7, 0xA6, 0x88, 0xFD, 0x81, 0x33, 0xAE, 0x2E, 0x79, 0xB7,
+    0xF7, 0x5D, 0xD7, 0xC9, 0xFD, 0xDD, 0xF6, 0x93, 0x1F, 0xDE, 0xD7, 0xBF, 0xD1, 0xD5, 0xF4, 0x22,
+    0xC7, 0xA1, 0xDB, 0x48, 0xFB, 0x6A, 0xF5, 0x53, 0x4B, 0x97, 0x4B, 0xEA, 0x55, 0xED, 0x43, 0x4E,
+    0xDA, 0x38, 0xBE, 0x29, 0x14, 0xBA, 0xEF, 0x57, 0xB6, 0xB0, 0x32, 0x66, 0x43, 0x18, 0x7A, 0xE0,
+    0x4C, 0xDE, 0x05, 0x45, 0x30, 0xF3, 0x6E, 0x09, 0x65, 0x0F, 0x17, 0x30, 0x9F, 0xA8, 0xF1, 0xCE,
+    0xB2, 0xC8, 0xA7, 0x50, 0xD1, 0x04, 0x56, 0xB4, 0x80, 0xDC, 0x64, 0x89, 0x76, 0x2E, 0xD4, 0xA2,
+    0x1B, 0xAC, 0x74, 0x0A, 0xF5, 0x55, 0x73, 0x90, 0x8A, 0x29, 0x16, 0xA3, 0x60, 0x78, 0x6E, 0xD2,
+    0x40, 0xC1, 0xC2, 0x2A, 0x28, 0xC6, 0xC5, 0x4B, 0x7F, 0x59, 0x07, 0xF3, 0xA1, 0x50, 0xFF, 0x97,
+    0x16, 0x0F, 0xE5, 0x9B, 0xCE, 0x82, 0xBE, 0x2E, 0x74, 0x77, 0x61, 0x2F, 0x18, 0x4D, 0xEE, 0x79,
+    0x9C, 0x5A, 0xF3, 0x7B, 0xFE, 0x51, 0xBB, 0x00, 0x8B, 0x14, 0x1F, 0xF6, 0xAA, 0xF8, 0xE2, 0xC2,
+    0xF8, 0x28, 0x17, 0xBE, 0xB1, 0x55, 0xF0, 0xF7, 0x93, 0xF0, 0xB4, 0x33, 0x2E, 0x34, 0x34, 0x69,
+    0x9D, 0x4C, 0x68, 0x6F, 0x17, 0x1A, 0xD2, 0xEC, 0x16, 0x3C, 0xEA, 0x17, 0x3C, 0xFA, 0x57, 0xA7,
+    0xDD, 0xA9, 0x9D, 0xE7, 0x83, 0xC5, 0xF3, 0xB5, 0x7B, 0x8D, 0xD2, 0x0C, 0x88, 0x07, 0x0D, 0xF2,
+    0x01, 0x40, 0xA1, 0xBA, 0xB4, 0x2B, 0xFB, 0x9B, 0xA8, 0x8F, 0x1C, 0xF2, 0xDB, 0xB5, 0x82, 0xAE,
+    0xD7, 0x67, 0x7F, 0xD6, 0xD4, 0x01, 0x32, 0xD5, 0x0E, 0x90, 0x95, 0x26, 0xE2, 0xD8, 0x19, 0xAD,
+    0xDC, 0xE9, 0xAB, 0xE8, 0xB2, 0x70, 0xB5, 0x15, 0x90, 0x6B, 0x07, 0x48, 0x62, 0x04, 0x4D, 0x8C,
+    0xE7, 0xA3, 0x25, 0x1B, 0x5C, 0x07, 0xC8, 0x70, 0xEE, 0x00, 0x69, 0x62, 0xFD, 0x59, 0x8B, 0xFC,
+    0x06, 0xEA, 0x49, 0xC7, 0x5D, 0xDC, 0x44, 0xDA, 0xB3, 0x61, 0xEA, 0x00, 0xB9, 0x3E, 0xD5, 0x01,
+    0x52, 0x3B, 0x84, 0xB0, 0x03, 0xA4, 0x86, 0x81, 0xAD, 0xB2, 0x9F, 0x83, 0xCB, 0xA6, 0x01, 0x5A,
+    0xA1, 0xBB, 0x55, 0xBA, 0x17, 0x9A, 0xD0, 0x44, 0x7A, 0xF9, 0xCB, 0x23, 0x9B, 0xE7, 0x6D, 0x16,
+    0x81, 0x80, 0x09, 0xFB, 0x3E, 0x53, 0xFC, 0xF6, 0x49, 0xD3, 0x7E, 0xF2, 0xF1, 0xE2, 0xD5, 0xC9,
+    0xDD, 0x97, 0x2D, 0x25, 0xEE, 0xE7, 0x91, 0x6F, 0xD9, 0x07, 0xAB, 0xE1, 0xAA, 0x47, 0x2D, 0xCC,
+    0xC3, 0xC2, 0xDA, 0x17, 0xED, 0xF8, 0x42, 0x35, 0x50, 0x35, 0x47, 0x88, 0x2E, 0x23, 0x58, 0xD7,
+    0x31, 0xBE, 0x4C, 0x2C, 0x0D, 0x40, 0x05, 0xA8, 0x6B, 0x4F, 0x5B, 0x2D, 0xB9, 0x20, 0xF4, 0xB5,
+    0x35, 0x2C, 0x7D, 0xC1, 0x5A, 0x27, 0x7A, 0x09, 0x79, 0x11, 0xE0, 0x12, 0x01, 0xFA, 0xFA, 0x0B,
+    0x72, 0x29, 0xBE, 0x3A, 0x78, 0xF9, 0x6B, 0xDD, 0xB8, 0x27, 0xFB, 0xA6, 0x1E, 0x92, 0x01, 0xD5,
+    0xC2, 0x57, 0xBC, 0xBD, 0x6B, 0x6E, 0x16, 0x41, 0xE7, 0x44, 0x09, 0x47, 0x9E, 0x56, 0x6E, 0xB5,
+    0x01, 0x3F, 0xF9, 0xF3, 0xD7, 0xEF, 0x61, 0x10, 0xCC, 0x3D, 0x2B, 0xD4, 0xCD, 0xCB, 0x15, 0x5A,
+    0x7D, 0x8F, 0xC3, 0x3B, 0x3E, 0x2E, 0x08, 0x87, 0xB7, 0xC4, 0x15, 0x97, 0xD3, 0x06, 0xAD, 0x5D,
+    0x47, 0xB6, 0xA7, 0xC7, 0x1B, 0xD5, 0xC9, 0x3A, 0x94, 0x85, 0x1D, 0x71, 0x7C, 0x83, 0x47, 0x2B,
+    0x09, 0xC9, 0xDF, 0x79, 0x7C, 0x54, 0xA4, 0x92, 0x02, 0xF4, 0x5B, 0xAD, 0x95, 0xE7, 0x25, 0x37,
+    0xC0, 0x31, 0x72, 0x89, 0xE1, 0xF8, 0x5D, 0x62, 0x12, 0x56, 0x86, 0x44, 0xB0, 0x06, 0x76, 0xA9,
+    0x05, 0xF0, 0xEB, 0x26, 0xD3, 0x16, 0x27, 0xE1, 0x3D, 0x1B, 0xD8, 0xED, 0x76, 0xAE, 0x73, 0x0D,
+    0xEC, 0x22, 0xA6, 0x88, 0x36, 0xF1, 0xB7, 0x88, 0xFB, 0x0C, 0xFF, 0x4C, 0x1B, 0xD8, 0x31, 0x13,
+    0xDD, 0x3F, 0x6C, 0x2D, 0x2E, 0x06, 0x6D, 0x60, 0x97, 0xA8, 0xD9, 0x06, 0xF9, 0x2F, 0x83, 0x0B,
+    0x9A, 0x53, 0x0D, 0xEC, 0x2A, 0x6F, 0x46, 0xDB, 0x58, 0x7A, 0xC7, 0x9C, 0xB7, 0xA3, 0xF1, 0xAD,
+    0xDD, 0x06, 0x76, 0xA7, 0x4B, 0x17, 0xE1, 0x0A, 0xEE, 0x94, 0x2E, 0x92, 0x1F, 0xDA, 0xA2, 0x21,
+    0x6F, 0x77, 0x0B, 0x18, 0xB5, 0xE9, 0x98, 0x2B, 0x5D, 0xD4, 0x6E, 0x11, 0x83, 0xCF, 0xD2, 0xC5,
+    0xF8, 0x31, 0x24, 0xA6, 0xC3, 0xEF, 0x21, 0xC3, 0xE6, 0x8F, 0x8C, 0xA4, 0xB1, 0x23, 0xD4, 0xEF,
+    0x20, 0x7B, 0xFC, 0xEE, 0xF8, 0x36, 0x4B, 0x17, 0x45, 0xE3, 0x21, 0xBA, 0x4D, 0x88, 0x98, 0x5F,
+    0xBD, 0xCF, 0xD2, 0xC5, 0x09, 0xEE, 0x68, 0xE6, 0x93, 0xEB, 0x8F, 0x63, 0x5B, 0xB7, 0xF4, 0x5C,
+    0x93, 0xF7, 0xD4, 0x4E, 0xB7, 0xB2, 0x1C, 0x49, 0xB9, 0xD3, 0xD0, 0xEF, 0x83, 0xB6, 0x8C, 0x3A,
+    0xD1, 0x85, 0xFC, 0x03, 0x75, 0xA3, 0xFE, 0xA0, 0x3C, 0x99, 0x26, 0x95, 0x4C, 0xC0, 0xCD, 0xE7,
+    0xB4, 0x00, 0xE7, 0xC2, 0x78, 0xE3, 0xF7, 0x16, 0x27, 0x05, 0xDD, 0xBB, 0x04, 0xE5, 0x84, 0x91,
+    0xBC, 0xDA, 0x4D, 0x9A, 0x35, 0x3B, 0xA8, 0x71, 0x85, 0xE4, 0x3B, 0xB1, 0x3F, 0x12, 0x53, 0xA3,
+    0xCD, 0xE9, 0x6A, 0x56, 0x4C, 0xBA, 0xD6, 0xFA, 0x70, 0x31, 0x95, 0x72, 0x8F, 0x28, 0xE5, 0xBE,
+    0xF8, 0x7E, 0x28, 0x17, 0xDC, 0x1C, 0xD0, 0x31, 0x2E, 0xD2, 0x7E, 0x96, 0x2E, 0xB8, 0xFA, 0xD1,
+    0x50, 0x8E, 0x61, 0xA4, 0x71, 0x75, 0x6E, 0x7C, 0xAB, 0x86, 0x27, 0x1B, 0xB7, 0xDA, 0x0C, 0x30,
+    0x2F, 0x42, 0x4C, 0x24, 0xAC, 0x16, 0x88, 0xF8, 0xC1, 0xFD, 0xE1, 0x4B, 0xC3, 0x8B, 0x3B, 0x94,
+    0xBB, 0x27, 0xF9, 0x26, 0x79, 0xF9, 0x51, 0x50, 0x09, 0x68, 0x66, 0x03, 0x3E, 0xB0, 0xF3, 0xF1,
+    0xDD, 0x97, 0xAC, 0xFF, 0x4C, 0x49, 0xDF, 0x5B, 0x83, 0x7D, 0x2B, 0x3B, 0x44, 0xC7, 0x33, 0xB8,
+    0x89, 0x6B, 0x8B, 0xC6, 0x48, 0x99, 0x36, 0xBC, 0xAA, 0x5C, 0xC7, 0x2C, 0xCD, 0x9D, 0xE3, 0x06,
+    0x2A, 0x85, 0x94, 0x98, 0x6E, 0xF5, 0x2E, 0xA8, 0xAE, 0x6D, 0x1E, 0x61, 0x12, 0xA2, 0x15, 0x86,
+    0x9D, 0xAD, 0xA0, 0x07, 0x0F, 0xA1, 0x87, 0x2A, 0xF2, 0x0D, 0xE3, 0xBB, 0xB4, 0xB8, 0x32, 0x6B,
+    0x15, 0x74, 0xF8, 0x81, 0x68, 0x7D, 0x67, 0x5A, 0xAA, 0x48, 0xCF, 0xF9, 0xE3, 0xCD, 0xAD, 0x62,
+    0xB0, 0xD8, 0x9F, 0x9C, 0x95, 0xA1, 0x28, 0x66, 0x68, 0x5D, 0x7D, 0x87, 0x76, 0x70, 0x69, 0x89,
+    0xF8, 0x4F, 0x9A, 0x65, 0x89, 0x93, 0xD6, 0x34, 0xC5, 0xAC, 0xDF, 0xC5, 0x92, 0x67, 0xD5, 0x57,
+    0xDE, 0xA4, 0x2B, 0xC5, 0x0A, 0x05, 0xDA, 0xF8, 0x7B, 0x40, 0xBC, 0x6E, 0x85, 0xC4, 0x76, 0x38,
+    0x36, 0x62, 0xE5, 0xB4, 0xC0, 0x62, 0x03, 0x5A, 0x84, 0xDC, 0x26, 0xAA, 0xB2, 0x2A, 0xEA, 0x9B,
+    0x03, 0x51, 0x7E, 0x81, 0x77, 0x0B, 0x3C, 0x5D, 0xB3, 0x24, 0x16, 0x6A, 0xDA, 0xBA, 0xDA, 0xED,
+    0x63, 0x4C, 0x2E, 0xCC, 0x64, 0xBD, 0x24, 0x89, 0x94, 0x2F, 0x12, 0x93, 0x33, 0x45, 0x5E, 0x3C,
+    0x62, 0x26, 0x78, 0x55, 0x3A, 0x47, 0x24, 0x6C, 0x6B, 0x67, 0x21, 0xF8, 0xC7, 0xE3, 0x93, 0xED,
+    0x94, 0x62, 0x18, 0x5D, 0xDB, 0xC2, 0xDF, 0x19, 0x8E, 0xAC, 0xFB, 0xDC, 0xDA, 0x8E, 0x2A, 0xF4,
+    0x98, 0x18, 0x36, 0xB0, 0x5C, 0xDE, 0x84, 0xEB, 0xE9, 0x34, 0x26, 0x99, 0x9B, 0x4B, 0xCB, 0x47,
+    0xDA, 0x50, 0xD6, 0x60, 0x87, 0xDA, 0xD4, 0x5D, 0xAB, 0x08, 0xAD, 0xFD, 0x49, 0x62, 0x27, 0x13,
+    0x64, 0x2B, 0x77, 0xBE, 0x84, 0xA7, 0x60, 0xE3, 0x58, 0x51, 0xF5, 0x80, 0x4C, 0x84, 0x68, 0x9D,
+    0xBC, 0x06, 0xA9, 0xAC, 0xF8, 0xD3, 0xEC, 0x95, 0xF9, 0x31, 0x99, 0x63, 0x17, 0x8B, 0xE3, 0xCB,
+    0x16, 0x87, 0x7F, 0x2C, 0x1F, 0x67, 0x33, 0x27, 0x5A, 0x3C, 0x16, 0xCE, 0x57, 0x81, 0x62, 0xCC,
+    0x88, 0x99, 0xCC, 0xD8, 0x66, 0x1F, 0xB5, 0xA3, 0xC3, 0x51, 0xEB, 0xF7, 0x69, 0x87, 0xF6, 0x20,
+    0x49, 0x17, 0x54, 0x30, 0x45, 0xC5, 0x28, 0xEA, 0x7C, 0x24, 0x38, 0x57, 0x69, 0x65, 0x08, 0xF3,
+    0x36, 0x67, 0x11, 0x6A, 0xB0, 0x41, 0x04, 0xD4, 0xB3, 0x27, 0xDB, 0x2E, 0xEB, 0xF4, 0xB5, 0xE9,
+    0x60, 0x80, 0x71, 0x7E, 0x5A, 0x9B, 0x51, 0x96, 0x9B, 0x84, 0x8E, 0xBB, 0xD2, 0x9E, 0x92, 0xF6,
+    0x0E, 0x9F, 0x7E, 0x51, 0x98, 0xFB, 0x2A, 0x9F, 0xAE, 0x09, 0x17, 0xB7, 0x24, 0xFD, 0x56, 0x24,
+    0x2A, 0x10, 0x70, 0xBF, 0x2C, 0xFA, 0x0A, 0xF7, 0xD1, 0x17, 0x8A, 0x7F, 0xB7, 0x0B, 0xD6, 0xC2,
+    0xB2, 0x8E, 0x25, 0x09, 0x58, 0x30, 0x9D, 0x73, 0xBE, 0xAE, 0x4C, 0xD4, 0xF1, 0xDB, 0xD3, 0xBE,
+    0xD8, 0xEC, 0x89, 0xCD, 0x68, 0x5C, 0xE7, 0x6D, 0x79, 0xE7, 0x27, 0xE1, 0x94, 0x4F, 0xF8, 0xBA,
+    0x73, 0xD7, 0x17, 0x71, 0xE0, 0x91, 0x7D, 0x40, 0xDE, 0xDE, 0x32, 0xA2, 0x3A, 0xD2, 0xDC, 0x51,
+    0x0D, 0x9B, 0x29, 0xF6, 0x9F, 0x66, 0xBC, 0x5C, 0xFD, 0x33, 0xFA, 0x67, 0xE9, 0xDA, 0xB9, 0x00,
+    0x3C, 0xFD, 0x4B, 0xEC, 0x7B, 0xAC, 0x81, 0x81, 0x3D, 0x4D, 0xBB, 0x68, 0x04, 0x68, 0xD9, 0x47,
+    0x5F, 0x7B, 0x64, 0xCA, 0xF5, 0x22, 0x17, 0xD4, 0x73, 0xDA, 0xC4, 0x98, 0x91, 0x27, 0xB4, 0x2A,
+    0xEA, 0x51, 0xB8, 0x5C, 0xE2, 0x24, 0xB1, 0x9B, 0xDC, 0x53, 0x34, 0xF0, 0xF6, 0xFA, 0x85, 0x1D,
+    0x7C, 0x79, 0xE1, 0x9A, 0xF0, 0xFA, 0xE0, 0x9D, 0x79, 0x6A, 0x4B, 0x2F, 0xD7, 0x3B, 0x2C, 0xAC,
+    0xFD, 0xEC, 0xF8, 0x3B, 0xCC, 0xED, 0x88, 0x49, 0x84, 0x0D, 0x1B, 0x74, 0x8B, 0xB8, 0x10, 0x75,
+    0xB1, 0x0C, 0xEC, 0x4B, 0x37, 0x11, 0x54, 0x83, 0xC4, 0x3B, 0xCF, 0x9E, 0xE5, 0xE1, 0xC6, 0x9B,
+    0x5B, 0x19, 0xEF, 0x7B, 0x04, 0x73, 0xA2, 0x25, 0x97, 0x02, 0x54, 0x61, 0x21, 0x1E, 0x4F, 0x3D,
+    0x5E, 0x68, 0xBD, 0x92, 0x17, 0x34, 0xCC, 0x69, 0xDB, 0x12, 0xE2, 0xFE, 0xF5, 0xCE, 0xA5, 0x9A,
+    0xC6, 0x6A, 0xE9, 0xD6, 0x04, 0x6A, 0x1A, 0x14, 0xA9, 0x39, 0x35, 0x25, 0xDB, 0xDB, 0x57, 0xFE,
+    0x3A, 0x21, 0x8C, 0x36, 0x6C, 0xCF, 0x29, 0x58, 0xCA, 0xFA, 0x93, 0x25, 0x66, 0x20, 0x5C, 0x34,
+    0x09, 0x7E, 0xCD, 0x44, 0xB8, 0x1D, 0x7E, 0x16, 0xAC, 0x94, 0xC6, 0xBA, 0x06, 0xC2, 0x6D, 0x69,
+    0x31, 0x0C, 0x75, 0x97, 0xE3, 0xE3, 0xDA, 0x75, 0x77, 0xB7, 0xB6, 0xBF, 0x76, 0xA0, 0x87, 0xA2,
+    0x4B, 0x27, 0xA8, 0xAC, 0x03, 0xCA, 0xA2, 0xF8, 0xB7, 0xB0, 0x2E, 0x73, 0x16, 0x29, 0x9B, 0x1A,
+    0x75, 0xB5, 0xAA, 0xF7, 0xD2, 0x4E, 0xBD, 0x97, 0x64, 0xB8, 0x4E, 0xE7, 0xC5, 0x1C, 0xF3, 0xC9,
+    0xCC, 0x99, 0x7C, 0x62, 0xB7, 0x16, 0x4D, 0x6C, 0x4D, 0xAE, 0xCD, 0xC9, 0xFB, 0xE7, 0x5D, 0xA5,
+    0x02, 0x2B, 0x40, 0x1B, 0xD6, 0x71, 0x13, 0xCF, 0xF2, 0xEF, 0x81, 0x66, 0x39, 0xF0, 0x51, 0xDC,
+    0xCF, 0xBC, 0x33, 0xA6, 0x2A, 0x86, 0x6A, 0xC5, 0xF0, 0xF9, 0x84, 0xDD, 0xD3, 0x25, 0x27, 0x26,
+    0x1D, 0x6B, 0x41, 0x32, 0xAA, 0x2B, 0xAD, 0x79, 0x62, 0x2B, 0x4F, 0xE6, 0x2C, 0xD2, 0x26, 0xD8,
+    0xBA, 0x49, 0x12, 0x3C, 0x4B, 0xEB, 0xF1, 0x98, 0x27, 0xA0, 0xE9, 0xEE, 0xBE, 0x68, 0xB2, 0x77,
+    0xBE, 0xDE, 0x9A, 0xF3, 0x8F, 0xD4, 0xC4, 0x74, 0xF1, 0xED, 0x0C, 0x23, 0xFF, 0x57, 0x1D, 0x34,
+    0x1A, 0x1D, 0xD5, 0xD8, 0xFB, 0xAD, 0x53, 0x6C, 0xDC, 0xA8, 0xC0, 0xB8, 0xCB, 0xA1, 0x36, 0x4E,
+    0x5B, 0xFB, 0xCC, 0x0A, 0xA9, 0x68, 0x1F, 0xF7, 0x54, 0x86, 0x0D, 0x09, 0x79, 0xEB, 0x6F, 0xD3,
+    0x44, 0x79, 0x79, 0xE9, 0x40, 0x79, 0x79, 0xF1, 0x9A, 0xF2, 0xF2, 0xC0, 0x8E, 0xB3, 0x53, 0xFC,
+    0xAB, 0xF5, 0x95, 0x13, 0x5E, 0xAA, 0xD4, 0x49, 0xBA, 0x77, 0x06, 0xBD, 0x77, 0xA3, 0xF2, 0xB2,
+    0x23, 0xCF, 0xD2, 0x1F, 0xAC, 0xA8, 0xA5, 0xB2, 0x3F, 0xB0, 0xCC, 0xD9, 0x6B, 0x45, 0xE6, 0x3A,
+    0xF5, 0x9B, 0xDB, 0xAC, 0xC2, 0xB9, 0xD0, 0x06, 0x37, 0xCC, 0xE4, 0x29, 0x2F, 0xB5, 0x63, 0xFF,
+    0xC6, 0x9D, 0x68, 0x26, 0xF6, 0x2D, 0x78, 0x91, 0xA1, 0xBC, 0xDC, 0x23, 0x94, 0x2D, 0x7C, 0x67,
+    0xCD, 0xFC, 0xF8, 0x37, 0xBD, 0xED, 0xE7, 0x2E, 0x61, 0xE8, 0xFB, 0xCF, 0x60, 0xC0, 0xFB, 0x2C,
+    0x8A, 0x62, 0x92, 0x78, 0x5D, 0x7A, 0xAE, 0x9D, 0x50, 0x74, 0x57, 0x01, 0xAC, 0x3F, 0x06, 0x50,
+    0xF5, 0x47, 0xFF, 0x1D, 0x71, 0xFD, 0xBF, 0xF8, 0x01, 0x22, 0xB6, 0x7F, 0xDC, 0xDA, 0x49, 0x9E,
+    0x5A, 0x4B, 0x44, 0x1B, 0x3E, 0x53, 0x47, 0x0B, 0x5E, 0x23, 0xD3, 0xC1, 0xEF, 0xB5, 0x43, 0xCE,
+    0xD7, 0xDF, 0xE1, 0x0E, 0xC9, 0xC7, 0x81, 0x54, 0x3C, 0x3F, 0x1E, 0x7E, 0xE2, 0x76, 0x48, 0x6F,
+    0x3B, 0x84, 0x15, 0xCD, 0x1B, 0x9E, 0x76, 0xB8, 0x5B, 0xD1, 0xD5, 0x9D, 0xAE, 0xE8, 0xEA, 0x68,
+    0xCF, 0xAC, 0x96, 0x15, 0x5D, 0x7B, 0xBC, 0xD2, 0xBA, 0x0B, 0x59, 0x59, 0x7E, 0x72, 0x47, 0x70,
+    0x6A, 0xFE, 0x87, 0xB8, 0x23, 0x7A, 0xB6, 0x3D, 0xDD, 0xB8, 0x30, 0x0E, 0x7C, 0x4A, 0xE1, 0x09,
+    0xCC, 0x4D, 0x54, 0x3D, 0x26, 0x05, 0x3B, 0xE1, 0x35, 0xEC, 0xF4, 0xB9, 0x8E, 0xAB, 0x5F, 0x84,
+    0x4C, 0x5D, 0x9D, 0xA3, 0x1C, 0x55, 0xE2, 0xD6, 0xB6, 0xD9, 0x47, 0xCB, 0x90, 0x0D, 0xBA, 0x97,
+    0x84, 0x27, 0xB7, 0x94, 0x17, 0xBA, 0x11, 0x66, 0x5E, 0x1C, 0x15, 0xA6, 0x46, 0xB5, 0x3C, 0xF0,
+    0xF8, 0xA6, 0xF6, 0xC5, 0xEE, 0xA2, 0x5D, 0x5E, 0xE8, 0x61, 0x05, 0x76, 0x14, 0x2C, 0x2D, 0x50,
+    0x77, 0x36, 0x85, 0xF2, 0xA2, 0x99, 0xFA, 0xF6, 0xBB, 0x48, 0x7F, 0x66, 0x72, 0x17, 0x2A, 0x08,
+    0x4D, 0xFC, 0x62, 0x3D, 0x8A, 0xD1, 0xF3, 0x9D, 0x94, 0xDA, 0x33, 0x63, 0xA4, 0xC9, 0x6E, 0xA0,
+    0xEE, 0xA7, 0x3D, 0xA0, 0xC4, 0x69, 0xF7, 0x41, 0xE0, 0xA0, 0x79, 0x50, 0x29, 0x0C, 0x12, 0x6B,
+    0x9E, 0x8E, 0x6B, 0x2D, 0x5C, 0x5F, 0xD2, 0x94, 0xED, 0x2D, 0x5D, 0x41, 0x5A, 0x14, 0x44, 0x3A,
+    0x1B, 0xA1, 0xAD, 0x02, 0x0D, 0xC6, 0x64, 0x4F, 0x47, 0x47, 0x33, 0x33, 0xD6, 0x2F, 0x40, 0xB1,
+    0x5F, 0x08, 0x99, 0x68, 0xED, 0x25, 0x0A, 0x13, 0x4B, 0x4D, 0x04, 0x4F, 0x07, 0x27, 0xA4, 0xD3,
+    0xC1, 0x09, 0xB5, 0x3B, 0x38, 0x41, 0xF3, 0xCB, 0xDE, 0x7D, 0x0F, 0x4E, 0x70, 0xD5, 0x9B, 0xF3,
+    0x79, 0x09, 0xDB, 0x85, 0x53, 0x16, 0xBE, 0xD7, 0xC1, 0x09, 0xA7, 0xCF, 0x4B, 0x58, 0x1E, 0x9C,
+    0x40, 0xF1, 0x71, 0xBF, 0x83, 0x13, 0xAA, 0x45, 0x97, 0x1E, 0x1D, 0x60, 0x31, 0x1F, 0x9C, 0xC0,
+    0x42, 0x11, 0xEC, 0x87, 0x23, 0xB4, 0x2C, 0xC4, 0x86, 0xA8, 0xA7, 0x10, 0x74, 0xBC, 0xDD, 0xC9,
+    0xC7, 0x7B, 0xCB, 0x52, 0xD6, 0x5B, 0xA7, 0x1E, 0x5E, 0x71, 0x0F, 0x2F, 0x9F, 0xCC, 0x72, 0x53,
+    0x77, 0xE4, 0xD5, 0x85, 0xD1, 0x15, 0xA2, 0x4C, 0x9D, 0x8C, 0x98, 0xBE, 0xF4, 0x89, 0x55, 0x0F,
+    0xD8, 0x00, 0x7A, 0xAE, 0xF2, 0xDD, 0x98, 0xFD, 0x16, 0xDD, 0xBD, 0xF1, 0x12, 0x4F, 0x63, 0x8D,
+    0x34, 0x18, 0xD4, 0xD9, 0x71, 0x69, 0xA8, 0x91, 0x5B, 0xCD, 0x05, 0x91, 0xA9, 0x16, 0x44, 0x76,
+    0x57, 0x50, 0xB2, 0x39, 0xA2, 0x64, 0x26, 0xD4, 0x08, 0xFD, 0x3F, 0xE3, 0xE2, 0x0D, 0x16, 0x20,
+    0x47, 0xD5, 0xDD, 0xE9, 0x8C, 0x2A, 0x7C, 0x58, 0x61, 0x86, 0x5C, 0xD5, 0x0F, 0x17, 0x13, 0xBB,
+    0xD5, 0x89, 0x23, 0xB8, 0xDA, 0x31, 0xBC, 0xCA, 0x27, 0x8E, 0xA7, 0x13, 0xCB, 0x1F, 0x99, 0x78,
+    0xFE, 0xC8, 0xC4, 0xF4, 0xCF, 0x2D, 0xB8, 0x3E, 0xB3, 0x7D, 0xE6, 0xFB, 0xCC, 0xF8, 0x99, 0xF3,
+    0x33, 0xEB, 0x67, 0xDE, 0xCF, 0xCC, 0x9F, 0x99, 0xBE, 0x7C, 0x72, 0xFC, 0x9F, 0x17, 0xC0, 0xBC,
+    0x02, 0xE6, 0x25, 0x30, 0xAF, 0x81, 0x79, 0x11, 0xCC, 0xAB, 0x60, 0x5A, 0x06, 0xB6, 0x0E, 0xFE,
+    0xCA, 0x73, 0x0B, 0x61, 0xB3, 0x53, 0x0A, 0x0A, 0xA9, 0x4E, 0x1E, 0xDE, 0xD8, 0x2A, 0x13, 0xF7,
+    0x95, 0x8B, 0xFB, 0xCA, 0xC6, 0x7D, 0xE5, 0xE3, 0x43, 0xC1, 0xC6, 0x95, 0x28, 0x5B, 0x95, 0x72,
+    0xB8, 0x99, 0x6C, 0x71, 0x65, 0xA6, 0x71, 0xD3, 0xD8, 0xE9, 0x8E, 0xBF, 0x53, 0x86, 0x1A, 0x47,
+    0x8D, 0xA5, 0xC6, 0x53, 0x8F, 0x4C, 0x6D, 0xB5, 0x98, 0xC6, 0x90, 0x32, 0xCE, 0xD3, 0xD6, 0xF4,
+    0xDD, 0xF4, 0xA4, 0x6D, 0xEB, 0x0B, 0x07, 0xCB, 0x1A, 0x5C, 0x54, 0xC7, 0xFC, 0xE9, 0xFA, 0x7D,
+    0x1E, 0x5B, 0xBB, 0x75, 0x54, 0x0F, 0x36, 0x8E, 0xD6, 0xE1, 0xC6, 0x69, 0x05, 0xFC, 0x76, 0xCA,
+    0xA3, 0x22, 0x08, 0x5D, 0xA7, 0x62, 0xE0, 0xB1, 0xB5, 0x6F, 0xD5, 0x5B, 0xCF, 0x90, 0x9D, 0xD1,
+    0x68, 0x4F, 0x15, 0x0F, 0xD1, 0x52, 0x83, 0x03, 0x35, 0xEE, 0xAD, 0x36, 0xBB, 0xE6, 0xA2, 0xB5,
+    0xA3, 0x3F, 0xF2, 0xF9, 0x89, 0x18, 0x37, 0x3B, 0x26, 0xC4, 0xD7, 0x0F, 0xAB, 0x0B, 0x37, 0x08,
+    0xB3, 0x09, 0x92, 0x95, 0xF0, 0xC8, 0x47, 0x7B, 0x72, 0xE0, 0x04, 0x79, 0x24, 0xD9, 0x02, 0xEA,
+    0x9E, 0x4F, 0xEE, 0x86, 0x05, 0x45, 0x0A, 0x17, 0xC7, 0x8A, 0x1B, 0x47, 0x8F, 0xC4, 0x1D, 0x1D,
+    0xC7, 0x7A, 0x53, 0xF3, 0xF7, 0x7B, 0x57, 0x8B, 0x14, 0x8F, 0x37, 0x07, 0x07, 0x9E, 0x1D, 0xDF,
+    0x38, 0x55, 0x58, 0xE5, 0xD9, 0x69, 0x41, 0x32, 0x9A, 0x0B, 0xE3, 0x8D, 0x1B, 0x04, 0x28, 0x59,
+    0xBB, 0x6D, 0xF6, 0xDA, 0x36, 0xAB, 0xBD, 0x34, 0xB9, 0x61, 0x85, 0x55, 0x53, 0xC7, 0x46, 0x3B,
+    0xD5, 0x49, 0x5B, 0x32, 0x03, 0x15, 0x0E, 0x1F, 0xBC, 0x93, 0xFB, 0x4D, 0x2B, 0x16, 0xD5, 0xE6,
+    0x30, 0x61, 0xAF, 0xBD, 0x60, 0xD8, 0x18, 0x4A, 0x4B, 0x46, 0xD1, 0xB9, 0x52, 0x77, 0xBB, 0x6B,
+    0x40, 0xA7, 0x25, 0xD0, 0x72, 0x37, 0x54, 0x03, 0xCB, 0x46, 0x27, 0x0A, 0x58, 0x6C, 0xC8, 0xC5,
+    0xF4, 0x54, 0x26, 0x7F, 0xC1, 0xA0, 0x68, 0xB9, 0xAD, 0x88, 0xD2, 0xCA, 0x61, 0x73, 0x85, 0x30,
+    0x79, 0x99, 0x85, 0x8B, 0xCE, 0x8D, 0x6F, 0xEC, 0xA0, 0x88, 0x37, 0x8B, 0x1F, 0x8E, 0xC5, 0xCF,
+    0x4D, 0xF9, 0x78, 0x4B, 0x94, 0x1B, 0xDE, 0x1D, 0x67, 0xAB, 0x8D, 0xAC, 0x87, 0x4D, 0xFA, 0x51,
+    0x01, 0xE2, 0x65, 0x41, 0x4C, 0x8C, 0x05, 0x88, 0xE5, 0xD6, 0x31, 0xC5, 0xCF, 0xA3, 0xD9, 0xF2,
+    0x26, 0x5B, 0xB1, 0x6B, 0x5B, 0xDE, 0xB2, 0xAB, 0x6B, 0x8E, 0x72, 0x13, 0xA0, 0xDB, 0x62, 0xFE,
+    0x6E, 0x93, 0xA0, 0xFC, 0x07, 0x37, 0xFE, 0x09, 0x11, 0xBF, 0x99, 0xE8, 0x2E, 0x04, 0xC4, 0x57,
+    0xD1, 0x9A, 0xBC, 0x63, 0x9F, 0xBC, 0x68, 0x1D, 0x6C, 0x15, 0x45, 0x4C, 0xF1, 0x51, 0xDE, 0x1D,
+    0xDB, 0xCF, 0xD1, 0x62, 0xB9, 0x0B, 0x8B, 0xE3, 0x7C, 0x64, 0x6E, 0xF0, 0x17, 0x0A, 0x57, 0x41,
+    0xA8, 0xA8, 0xE8, 0x64, 0xF8, 0x8F, 0x53, 0x1D, 0xD7, 0x60, 0x4B, 0x1C, 0x2D, 0x8A, 0x7B, 0x4C,
+    0x17, 0xDD, 0xB0, 0x6B, 0x46, 0x5B, 0x72, 0x8C, 0x53, 0x68, 0x0C, 0x44, 0x15, 0xAE, 0x65, 0x51,
+    0x02, 0x51, 0x45, 0x3C, 0x15, 0xDA, 0xE6, 0xE2, 0x79, 0x8B, 0xAB, 0x76, 0xEB, 0xFA, 0x3A, 0xE2,
+    0x36, 0xF9, 0xB7, 0x31, 0x38, 0x98, 0x88, 0xE1, 0x70, 0x64, 0xD1, 0x34, 0xD4, 0xA1, 0x5D, 0xC9,
+    0x4E, 0x36, 0x43, 0xF8, 0x64, 0x40, 0x21, 0xFE, 0x21, 0x77, 0xD6, 0x35, 0x40, 0x21, 0x22, 0x36,
+    0xDB, 0xE1, 0x9E, 0xD6, 0x2C, 0x82, 0x3A, 0xEB, 0x06, 0x87, 0x6F, 0xE6, 0x2A, 0x74, 0x5E, 0x7D,
+    0x86, 0x4B, 0xD5, 0xF1, 0x08, 0xB7, 0xCB, 0xDA, 0xEE, 0x8F, 0x04, 0x0A, 0xF1, 0x4D, 0x2F, 0x59,
+    0x07, 0x9D, 0xD9, 0x64, 0x84, 0x42, 0x24, 0xD7, 0xCF, 0xF0, 0x70, 0xBB, 0x5D, 0x0F, 0xB7, 0x58,
+    0xC4, 0xE4, 0xC6, 0x6D, 0xA2, 0xD7, 0x36, 0xEA, 0x7D, 0xB1, 0x4B, 0x65, 0x63, 0xDD, 0xBE, 0x84,
+    0xC1, 0x5C, 0xD3, 0xF3, 0x5D, 0xBE, 0x8A, 0x31, 0x7D, 0xF3, 0x3D, 0x72, 0x3C, 0xCB, 0xB2, 0x90,
+    0xF7, 0x38, 0xA0, 0xFD, 0xBE, 0xA7, 0xBC, 0x64, 0x76, 0xCA, 0x8B, 0xAE, 0x00, 0xD2, 0x73, 0x5C,
+    0xBC, 0x31, 0x3D, 0x55, 0x88, 0x90, 0x2C, 0x9C, 0xD2, 0x5F, 0xF0, 0x5C, 0x59, 0xE5, 0x4F, 0xDF,
+    0x3D, 0x30, 0xF8, 0x68, 0xBA, 0x07, 0x9E, 0xD3, 0xEE, 0x81, 0xF5, 0x98, 0x6B, 0xF7, 0x40, 0x93,
+    0xA7, 0x7B, 0xFF, 0xD2, 0x18, 0x71, 0xD1, 0xF3, 0x16, 0xCE, 0xEC, 0x9C, 0xB5, 0x5D, 0xEF, 0x24,
+    0x11, 0x7D, 0x73, 0xF8, 0x22, 0x4B, 0x6A, 0xFB, 0xFF, 0x5A, 0xE6, 0xB9, 0xF1, 0x79, 0x6C, 0x3B,
+    0x6F, 0xA1, 0x1E, 0xD1, 0x6A, 0x47, 0xC2, 0x53, 0x87, 0x54, 0x64, 0x77, 0xA6, 0x8B, 0xE7, 0x9A,
+    0x52, 0xB2, 0xD7, 0x9A, 0x86, 0x95, 0x82, 0x03, 0x09, 0xE6, 0xEC, 0x52, 0x65, 0xC5, 0x81, 0xF2,
+    0x45, 0xCF, 0x5E, 0xB9, 0xBB, 0xD2, 0x58, 0x64, 0x73, 0xEF, 0xE4, 0xC7, 0x6E, 0x54, 0xFA, 0x3E,
+    0xC9, 0x0F, 0x4D, 0x81, 0xEB, 0x01, 0x3E, 0x50, 0xD4, 0xAD, 0xCB, 0xCD, 0x94, 0x48, 0xEB, 0x65,
+    0x42, 0x73, 0x94, 0x85, 0x8A, 0x48, 0x43, 0x43, 0x17, 0x9C, 0x40, 0x8B, 0xFA, 0xC7, 0xB0, 0xF3,
+    0xDD, 0x05, 0x35, 0x32, 0x31, 0x3B, 0x07, 0x82, 0xCC, 0x19, 0x62, 0xC5, 0x07, 0x86, 0x59, 0x2F,
+    0x89, 0x51, 0xC0, 0x92, 0xCF, 0x31, 0xDD, 0x3C, 0x77, 0x21, 0xA6, 0xAC, 0xF3, 0xBC, 0x93, 0x51,
+    0xE1, 0xBC, 0xD8, 0x49, 0xFF, 0x4D, 0x76, 0xB9, 0x47, 0xF9, 0xCE, 0x6E, 0xF6, 0x3F, 0x1B, 0x92,
+    0xFA, 0x8F, 0x0F, 0x87, 0xB6, 0x25, 0xE5, 0x05, 0xE7, 0x5E, 0x1A, 0x6E, 0x7C, 0xA2, 0x49, 0x5A,
+    0x42, 0x40, 0x97, 0x7C, 0xE9, 0x7B, 0x93, 0xF4, 0xFE, 0xE7, 0xFF, 0x28, 0x8C, 0xF8, 0xD4, 0xF9,
+    0x3F, 0x16, 0x8E, 0x9C, 0xCE, 0xFF, 0xA9, 0x54, 0xF1, 0x5E, 0xB6, 0x54, 0x9C, 0xE9, 0x8D, 0xE9,
+    0xFC, 0x1F, 0xA7, 0xE4, 0x5D, 0x2C, 0xDD, 0xB6, 0x8C, 0x3B, 0xFF, 0xE7, 0x4F, 0x2D, 0xCA, 0x6B,
+    0xE7, 0xFF, 0x5C, 0xBE, 0xF7, 0xF9, 0x3F, 0x8D, 0x36, 0xC0, 0x58, 0x9E, 0xFF, 0x13, 0xEC, 0x9C,
+    0xFF, 0x83, 0x48, 0x1A, 0xCE, 0xFF, 0x79, 0xBF, 0x91, 0xB4, 0xE2, 0xBE, 0x91, 0x34, 0x8F, 0xC4,
+    0x90, 0x4F, 0x3F, 0xEA, 0x70, 0x7C, 0xAA, 0x08, 0xE1, 0xB5, 0x9B, 0xB6, 0xBF, 0xE5, 0x4A, 0x1A,
+    0xB8, 0x90, 0x6A, 0xAE, 0x23, 0x6D, 0x2C, 0xA9, 0xA7, 0x48, 0x99, 0x44, 0x5E, 0xCD, 0xD3, 0xFD,
+    0x09, 0xD3, 0x51, 0x7F, 0xCC, 0xF2, 0xCC, 0xD7, 0xF4, 0x4C, 0xEC, 0x81, 0xB3, 0xA8, 0x09, 0x8D,
+    0x2D, 0x35, 0x80, 0xB3, 0x86, 0xEF, 0x62, 0x7A, 0xF7, 0x54, 0x0C, 0xCD, 0xE2, 0x30, 0xDD, 0x04,
+    0x59, 0xD8, 0x23, 0x41, 0x12, 0x2D, 0x11, 0xFC, 0x0F, 0xA6, 0x33, 0x1E, 0x93, 0xD9, 0x53, 0x6D,
+    0x7C, 0x5D, 0xA4, 0x34, 0xCA, 0x19, 0x4B, 0x84, 0x23, 0x52, 0x18, 0x06, 0xD0, 0x4A, 0x48, 0x85,
+    0xB0, 0xCF, 0xF2, 0xBE, 0xBC, 0x93, 0x01, 0x88, 0xAF, 0x8A, 0x86, 0xF8, 0xE2, 0x0C, 0xFF, 0x70,
+    0xE7, 0x07, 0xCC, 0xD9, 0xB5, 0xA9, 0x17, 0xD6, 0xE8, 0xC4, 0xCA, 0x60, 0xCB, 0xDF, 0x37, 0xF8,
+    0xC7, 0x9C, 0x76, 0x9B, 0x0A, 0xFF, 0xEC, 0xDC, 0x4F, 0xEB, 0xE6, 0x0E, 0x15, 0x12, 0xD9, 0x39,
+    0x1D, 0xBA, 0x47, 0x5C, 0xD5, 0x29, 0x49, 0x95, 0x38, 0xD5, 0x9A, 0xEE, 0xA0, 0x3E, 0xA6, 0x73,
+    0x3F, 0x6B, 0x83, 0x7F, 0x7C, 0x99, 0xC6, 0xEC, 0xDD, 0x82, 0xE9, 0x98, 0x71, 0x02, 0x7B, 0x9C,
+    0x9B, 0x22, 0xF3, 0x13, 0x0A, 0xEB, 0xF2, 0x29, 0xF8, 0xC7, 0xF4, 0xB0, 0x7F, 0xEA, 0xE1, 0xAB,
+    0x33, 0xE4, 0x0A, 0x95, 0xB1, 0x79, 0x91, 0xFD, 0x70, 0xA8, 0x85, 0x6E, 0x97, 0xC3, 0x75, 0xD2,
+    0x88, 0xEF, 0x14, 0xAE, 0xE3, 0x6A, 0xF4, 0x9E, 0x09, 0xFB, 0xA8, 0x18, 0xBC, 0x97, 0xA3, 0x2E,
+    0x2A, 0xD4, 0xE7, 0xF0, 0xD5, 0xCD, 0xA0, 0xC9, 0xAF, 0x87, 0xC9, 0xA4, 0x56, 0x7F, 0xCA, 0x46,
+    0x30, 0xEE, 0x14, 0x1C, 0x3B, 0xE1, 0x33, 0x67, 0x6F, 0x04, 0xF6, 0xE3, 0xE7, 0x2D, 0xF8, 0x3E,
+    0xFD, 0x8B, 0x98, 0x0E, 0x47, 0xF3, 0x2A, 0x7D, 0x27, 0x3D, 0xB1, 0x38, 0x11, 0xD9, 0x06, 0x6B,
+    0x40, 0xCC, 0x92, 0x7F, 0xDE, 0x2E, 0x73, 0x36, 0x76, 0x33, 0x7C, 0x59, 0x5A, 0x78, 0x33, 0x8E,
+    0x49, 0x1D, 0x63, 0x07, 0x03, 0x7A, 0xB8, 0x60, 0x45, 0x9E, 0x38, 0x72, 0x35, 0x65, 0x65, 0x0F,
+    0xBC, 0x64, 0xBC, 0xA5, 0xB3, 0x64, 0xD5, 0x23, 0xF1, 0x7C, 0x6E, 0xD3, 0xCE, 0x81, 0x4D, 0xF1,
+    0x7D, 0x8E, 0x37, 0xB7, 0xD9, 0xC0, 0x0A, 0xC3, 0x39, 0xCC, 0x43, 0x71, 0x44, 0x9C, 0x90, 0x66,
+    0x84, 0x8F, 0xC6, 0xEB, 0xEF, 0xE3, 0x2C, 0xE8, 0xB3, 0xCE, 0x00, 0x57, 0x69, 0x79, 0x4E, 0xA5,
+    0xA5, 0x05, 0xEF, 0x5C, 0xAB, 0x11, 0x87, 0x82, 0x4B, 0x76, 0xA6, 0x6E, 0x48, 0x01, 0x77, 0x3B,
+    0x01, 0xF9, 0x29, 0xE9, 0xEB, 0x1E, 0xD1, 0xD5, 0x0D, 0xA7, 0x88, 0xC5, 0xC6, 0x4E, 0xAC, 0x0A,
+    0x39, 0xF1, 0x50, 0x4F, 0xC9, 0xE1, 0xB4, 0xE3, 0xCE, 0xFE, 0x93, 0x7D, 0x1E, 0x6D, 0x9F, 0x44,
+    0xFF, 0xC3, 0x71, 0xFC, 0x36, 0x0A, 0x45, 0xFA, 0xA5, 0x69, 0x75, 0xC6, 0x31, 0x7A, 0xAF, 0x31,
+    0x4E, 0x3C, 0x36, 0x0E, 0x5E, 0xE8, 0xF9, 0x8F, 0x55, 0x2E, 0x85, 0xE6, 0xC4, 0x4B, 0xBA, 0x58,
+    0x90, 0x24, 0xC9, 0x13, 0x73, 0xEB, 0x56, 0xD8, 0xF9, 0x3F, 0xFD, 0x71, 0x5B, 0x7E, 0xC5, 0xE3,
+    0xB6, 0xC2, 0x86, 0xDC, 0x63, 0x33, 0x84, 0xA8, 0x8F, 0x1A, 0x1E, 0xB7, 0x15, 0x57, 0xDA, 0xB8,
+    0xB1, 0xE0, 0x71, 0x5B, 0xBF, 0xFB, 0xF8, 0x19, 0xC7, 0x6D, 0x3D, 0xA7, 0xDB, 0xE5, 0x40, 0xE5,
+    0xEC, 0xBE, 0xEA, 0xBA, 0x6B, 0xCA, 0xB6, 0x67, 0x34, 0xB7, 0xFD, 0xCA, 0x7B, 0x1E, 0xB7, 0x65,
+    0xB8, 0xA7, 0xFB, 0x76, 0x99, 0xFD, 0x55, 0x74, 0x99, 0x7D, 0x05, 0x25, 0xD7, 0xAC, 0xBF, 0xEE,
+    0x64, 0xD1, 0xBF, 0xF3, 0xEE, 0x4E, 0x97, 0x59, 0xF4, 0x3B, 0xF0, 0x42, 0xA4, 0x05, 0xA3, 0xE7,
+    0xE5, 0x72, 0xEE, 0xD1, 0x7B, 0x74, 0x99, 0x55, 0x00, 0x9B, 0x6B, 0x46, 0xE3, 0x96, 0xC8, 0x07,
+    0x07, 0x84, 0x9C, 0x03, 0x8C, 0x3A, 0x1C, 0x18, 0x87, 0x08, 0xC7, 0xE3, 0x27, 0x46, 0xC5, 0x57,
+    0xD7, 0x95, 0x16, 0xC5, 0x9F, 0x5A, 0xF7, 0x2B, 0xED, 0xCD, 0xD9, 0x72, 0xF9, 0x53, 0xC7, 0x16,
+    0x76, 0x0A, 0x0D, 0x85, 0xD4, 0xE8, 0x59, 0xBD, 0x0A, 0xB6, 0x05, 0x96, 0xBF, 0x16, 0x7F, 0x23,
+    0x3E, 0x73, 0x73, 0x7C, 0xC3, 0xB6, 0xE0, 0xFD, 0x23, 0xD7, 0x3B, 0x68, 0x19, 0x17, 0xB9, 0x46,
+    0xFD, 0x44, 0xCE, 0xAE, 0x36, 0x25, 0x81, 0xBD, 0xF5, 0xC1, 0x7D, 0x7A, 0xA2, 0x07, 0x1F, 0xA8,
+    0x27, 0x7A, 0x75, 0xAA, 0x17, 0xD9, 0x6B, 0x85, 0xF6, 0x22, 0xCB, 0x5D, 0xFD, 0x9D, 0x5F, 0x9C,
+    0x28, 0x77, 0xAC, 0xCC, 0x31, 0x51, 0xC8, 0x64, 0x4B, 0x1F, 0x2A, 0xD0, 0xE8, 0x20, 0x33, 0x21,
+    0x58, 0x55, 0x90, 0x74, 0x0E, 0xAD, 0x57, 0x17, 0xBE, 0x85, 0xAE, 0xB2, 0xE7, 0x35, 0xD6, 0x56,
+    0xF2, 0x74, 0x4F, 0xF1, 0x40, 0x19, 0xA1, 0x11, 0xB5, 0x87, 0xFA, 0x5E, 0xE8, 0xD8, 0xB7, 0x8F,
+    0x0F, 0xEB, 0xC1, 0x34, 0x18, 0xA4, 0xC0, 0x53, 0x77, 0x5F, 0xBC, 0xB2, 0xAC, 0xFE, 0x4B, 0x4F,
+    0xDC, 0x93, 0x7B, 0xDC, 0x5D, 0xC9, 0x1F, 0x8F, 0xE6, 0xF3, 0xB4, 0x30, 0x2E, 0x57, 0x83, 0xE7,
+    0x1F, 0x6C, 0x2D, 0x2E, 0x60, 0xD2, 0xC6, 0x92, 0x89, 0xAE, 0x4D, 0x8F, 0x46, 0x4D, 0x50, 0x93,
+    0xE1, 0x85, 0xC7, 0x25, 0x75, 0x11, 0xA3, 0x5A, 0x38, 0x9B, 0x86, 0xE5, 0x52, 0xE9, 0xF3, 0x28,
+    0x05, 0xCF, 0x19, 0x0B, 0xC8, 0x45, 0x88, 0x8A, 0xF3, 0xFF, 0x8D, 0x4E, 0x56, 0x4D, 0xF6, 0x36,
+    0xCE, 0x7D, 0x3C, 0xA7, 0xA8, 0xAE, 0xF4, 0xCD, 0x62, 0x72, 0x56, 0xCD, 0x65, 0x5D, 0xCD, 0xE3,
+    0x93, 0xD1, 0x7D, 0x11, 0xEB, 0xCE, 0x67, 0x57, 0x07, 0x0E, 0x24, 0xD3, 0x61, 0x5C, 0xF5, 0x3E,
+    0x83, 0xB4, 0xCE, 0x5D, 0x60, 0xD4, 0x68, 0x3D, 0xD5, 0x0B, 0x4E, 0xA0, 0x55, 0x9B, 0xEE, 0xB3,
+    0x27, 0x7C, 0xAB, 0x67, 0x4E, 0xC4, 0xA9, 0x5F, 0xF6, 0x7E, 0xA6, 0x3C, 0xCA, 0x39, 0x5E, 0x8B,
+    0x61, 0xAC, 0x16, 0x51, 0x85, 0x6A, 0x56, 0x42, 0xA7, 0x7C, 0xDE, 0x29, 0x09, 0xB1, 0x48, 0x3E,
+    0x2C, 0x5A, 0x19, 0x4C, 0xC9, 0x86, 0x29, 0xC9, 0xB0, 0xE8, 0x9C, 0xA0, 0xAD, 0x82, 0xFA, 0x9D,
+    0xD2, 0x88, 0x29, 0x89, 0xB0, 0xEC, 0x15, 0x3A, 0x23, 0x6A, 0x2A, 0x6F, 0x71, 0xC2, 0xF2, 0x91,
+    0x9E, 0xCD, 0x7B, 0xBA, 0x99, 0xA5, 0xB5, 0xBC, 0xB3, 0xAC, 0xFF, 0xA4, 0x30, 0xF3, 0x6A, 0xB2,
+    0x85, 0xF2, 0xB1, 0x9F, 0x73, 0xEC, 0x33, 0x26, 0xE4, 0xCA, 0xE9, 0xA2, 0x83, 0xAD, 0x28, 0x49,
+    0x9A, 0x2B, 0xA1, 0x06, 0x36, 0xF1, 0x08, 0x0B, 0x53, 0x84, 0x07, 0xA7, 0x13, 0xD3, 0x88, 0xA0,
+    0x7F, 0x1C, 0x6A, 0x1A, 0xA0, 0x51, 0xD0, 0x3A, 0x84, 0x90, 0x59, 0xF8, 0x32, 0x95, 0xDB, 0xC6,
+    0x79, 0xD7, 0x58, 0x06, 0x16, 0x6A, 0x13, 0x4F, 0x60, 0x9D, 0xCA, 0x0E, 0x15, 0x8D, 0xAB, 0xB2,
+    0xBA, 0xED, 0x60, 0x2D, 0x56, 0x01, 0xAD, 0x61, 0x65, 0xE7, 0x65, 0xB8, 0x30, 0x3C, 0x96, 0xD7,
+    0x60, 0x0A, 0x2B, 0x18, 0xFD, 0xAD, 0x85, 0x7A, 0x70, 0x50, 0xAA, 0xB5, 0xB8, 0x62, 0x40, 0xCF,
+    0x10, 0x3A, 0xED, 0xD4, 0x2A, 0x6B, 0x2C, 0x88, 0x65, 0xD2, 0x12, 0xB9, 0xA8, 0xB7, 0xF6, 0xB7,
+    0xDA, 0xEF, 0xBB, 0x53, 0x91, 0x9D, 0x74, 0xBA, 0x0A, 0x14, 0xF8, 0x1A, 0x6D, 0xB4, 0x0E, 0x05,
+    0xC7, 0x40, 0x8D, 0x84, 0x2F, 0x8B, 0xC3, 0x57, 0xA0, 0xB5, 0xAA, 0x38, 0x0B, 0x29, 0xD8, 0x9F,
+    0x9D, 0xA8, 0x5D, 0xFE, 0x8A, 0xF7, 0xF7, 0x5C, 0x6E, 0x66, 0xDF, 0x4C, 0x25, 0x77, 0x04, 0xE7,
+    0x54, 0x45, 0x5A, 0x0E, 0xBB, 0xD8, 0xC8, 0xDD, 0xEA, 0x81, 0x4F, 0xFB, 0x89, 0x41, 0x1F, 0x03,
+    0x6E, 0xE3, 0xBA, 0xCB, 0xCA, 0x14, 0xAC, 0x52, 0x7B, 0x89, 0x42, 0x27, 0xE1, 0xA9, 0x01, 0x7A,
+    0xE8, 0xDB, 0x56, 0x37, 0x92, 0x6F, 0xC7, 0x47, 0x72, 0x25, 0x64, 0xCD, 0xEC, 0x65, 0x38, 0x34,
+    0x3C, 0x53, 0x46, 0xD5, 0x7C, 0x78, 0x39, 0x8F, 0x60, 0x2D, 0x3C, 0xD7, 0xD4, 0x8C, 0xEA, 0x7E,
+    0xDC, 0x38, 0x13, 0xC3, 0x19, 0x17, 0x53, 0xA9, 0x39, 0x1D, 0x9F, 0x03, 0xDB, 0xB8, 0x83, 0xC5,
+    0x31, 0x47, 0x6B, 0xD6, 0x52, 0x33, 0x7A, 0x81, 0x70, 0x53, 0xED, 0x44, 0xA4, 0xB2, 0xFB, 0xFC,
+    0xB4, 0xD3, 0x7E, 0x1A, 0x1C, 0xC7, 0x9D, 0xC2, 0xB3, 0x43, 0xED, 0xA2, 0xBB, 0x8F, 0x8F, 0xB4,
+    0x66, 0xB2, 0xD5, 0x9C, 0x8B, 0x0B, 0x7B, 0x73, 0x54, 0xD2, 0x46, 0xAB, 0xD1, 0x19, 0xF7, 0xAE,
+    0xB4, 0x2D, 0x0A, 0xAE, 0x32, 0xD5, 0x70, 0xD1, 0x78, 0x72, 0x3A, 0x8E, 0xC4, 0x67, 0xE7, 0xDE,
+    0xA8, 0xB5, 0x23, 0x34, 0x47, 0x4F, 0x7B, 0x5A, 0x38, 0x1B, 0xF0, 0x68, 0x70, 0x25, 0xB6, 0xDC,
+    0x8E, 0xA1, 0x3B, 0x38, 0x33, 0x29, 0xAC, 0xD3, 0xA3, 0x7D, 0x52, 0x6A, 0x32, 0xF6, 0x92, 0x89,
+    0xD1, 0x03, 0x73, 0x94, 0xF7, 0x2D, 0xC8, 0xFB, 0x8C, 0xD9, 0xD5, 0xAF, 0xD8, 0x5D, 0xB3, 0x2C,
+    0x38, 0x9D, 0x96, 0x82, 0x33, 0x68, 0x55, 0x76, 0x86, 0x06, 0x21, 0x88, 0x2A, 0xBD, 0x27, 0x85,
+    0xF2, 0x20, 0x31, 0x3B, 0xEF, 0x92, 0x39, 0x1D, 0xFB, 0xC6, 0x8B, 0x5B, 0xE6, 0x76, 0xF4, 0x2A,
+    0x53, 0x03, 0xB6, 0xE2, 0xF1, 0x1E, 0x8A, 0x68, 0x1B, 0x79, 0xCF, 0xA4, 0xEA, 0xA6, 0xD5, 0xA3,
+    0x9A, 0x65, 0x35, 0xF6, 0x31, 0x60, 0x76, 0xEC, 0x63, 0xB6, 0xB2, 0x8A, 0xB4, 0xC6, 0x5B, 0xFA,
+    0x1F, 0x66, 0xD4, 0xCF, 0x7E, 0xE6, 0xED, 0xDD, 0xEC, 0xAB, 0x2B, 0x46, 0xB6, 0x70, 0x90, 0xAE,
+    0x7F, 0xB6, 0x9B, 0xF6, 0xB6, 0x4F, 0xB1, 0x79, 0x10, 0xDB, 0x95, 0x35, 0x7A, 0x02, 0x52, 0x3A,
+    0x9D, 0x80, 0xF4, 0x08, 0x17, 0xE2, 0xC1, 0xE2, 0x04, 0xA4, 0x5B, 0x9C, 0xBA, 0x3B, 0xFB, 0x68,
+    0x24, 0x11, 0x68, 0x30, 0xC3, 0x97, 0x88, 0xD1, 0xA7, 0xF7, 0x1F, 0x25, 0x98, 0xEE, 0xAD, 0xCB,
+    0xC4, 0x63, 0xE2, 0xFC, 0xF4, 0x07, 0xD8, 0x90, 0x82, 0xA0, 0x97, 0x7A, 0x83, 0xEC, 0xE6, 0xDE,
+    0x2B, 0x73, 0x8E, 0x57, 0x63, 0x36, 0xBA, 0x59, 0x34, 0x1C, 0x92, 0x2D, 0x26, 0x72, 0xFB, 0x33,
+    0x95, 0x40, 0xAF, 0x4E, 0x24, 0xD0, 0x39, 0x52, 0xB7, 0x75, 0x77, 0xF6, 0xEE, 0xB4, 0x79, 0xA7,
+    0xDD, 0x6B, 0x2E, 0xEA, 0x57, 0x9C, 0x59, 0xF0, 0xAA, 0x4B, 0x44, 0x8C, 0x73, 0xD3, 0x25, 0x2D,
+    0xC9, 0x84, 0x49, 0xE9, 0xA0, 0xA1, 0x77, 0xBD, 0x13, 0x69, 0xD8, 0x8F, 0x2A, 0x93, 0xCE, 0x8A,
+    0x06, 0x9A, 0xF0, 0xD5, 0xC2, 0x84, 0x3F, 0xEB, 0x60, 0xF7, 0x01, 0xC0, 0x65, 0x30, 0xE2, 0x59,
+    0xCE, 0xED, 0x0E, 0xC9, 0x5B, 0x13, 0xD1, 0xA4, 0x95, 0xA0, 0x96, 0x3E, 0xFB, 0x4C, 0x03, 0x27,
+    0x2A, 0x97, 0x30, 0xBF, 0x5B, 0x58, 0xBE, 0x7C, 0x0A, 0x19, 0x5D, 0x3A, 0x55, 0x8E, 0xE5, 0x2A,
+    0xA9, 0xA6, 0x22, 0xAF, 0xF0, 0xDE, 0xF5, 0x41, 0xF9, 0xC7, 0xC3, 0xEE, 0x7B, 0x01, 0x27, 0x2C,
+    0xDD, 0xF0, 0x44, 0x33, 0x87, 0x1B, 0xB2, 0x45, 0xB4, 0x4B, 0xDD, 0xF5, 0x7E, 0xCE, 0x53, 0xC4,
+    0xED, 0xA7, 0x32, 0x2E, 0x54, 0xE9, 0xFA, 0x64, 0x98, 0x65, 0xBD, 0x8C, 0x0A, 0x65, 0x3B, 0xB1,
+    0xBD, 0xFD, 0x1D, 0xEF, 0xE1, 0x9B, 0x27, 0x20, 0x2E, 0x1A, 0x16, 0x62, 0x54, 0x88, 0x41, 0x21,
+    0xC6, 0x84, 0x18, 0x55, 0x61, 0x44, 0x88, 0x01, 0x21, 0xC6, 0x83, 0x18, 0x0B, 0x62, 0x34, 0x88,
+    0xC1, 0x20, 0x61, 0xD1, 0xAF, 0x88, 0x49, 0xF7, 0xC6, 0x6C, 0x76, 0x9F, 0x48, 0x59, 0xD4, 0x95,
+    0x81, 0xEA, 0xD9, 0x04, 0x0B, 0x87, 0x5B, 0x6A, 0x05, 0xE6, 0xDA, 0x09, 0x5D, 0x9E, 0xAE, 0x4E,
+    0xFC, 0x13, 0xD5, 0x48, 0xA8, 0xE1, 0x22, 0xE2, 0x9A, 0x80, 0x68, 0xE7, 0x4E, 0x60, 0x45, 0x2A,
+    0xA3, 0x77, 0x04, 0xB7, 0x94, 0x1B, 0x17, 0x22, 0x7A, 0x0E, 0xE1, 0x55, 0x9C, 0x45, 0xC7, 0x33,
+    0x8B, 0xB4, 0xDF, 0xE8, 0x3B, 0x80, 0x16, 0x3C, 0x85, 0x0F, 0xEC, 0x50, 0x33, 0xC7, 0x16, 0x99,
+    0x9D, 0xCC, 0xEE, 0x00, 0x23, 0x0B, 0x80, 0x66, 0xBC, 0x86, 0xE1, 0x05, 0x38, 0x7A, 0xAD, 0x63,
+    0x6B, 0x9F, 0xB6, 0x46, 0xC7, 0x4B, 0x3C, 0x35, 0x25, 0x3A, 0x5E, 0x52, 0x07, 0x94, 0x45, 0x52,
+    0xD0, 0x9F, 0xAC, 0x10, 0x13, 0x1E, 0x14, 0x12, 0x5F, 0x1D, 0x30, 0x4A, 0x85, 0xC0, 0xD1, 0x6D,
+    0xAA, 0xB3, 0x44, 0xE6, 0xAB, 0x1D, 0x55, 0x53, 0x40, 0x22, 0xC9, 0xB0, 0x4B, 0x5E, 0xFA, 0x27,
+    0x0A, 0xC9, 0x3A, 0xF0, 0x92, 0x3F, 0x2F, 0xC8, 0xB6, 0x7D, 0x1C, 0xC3, 0x40, 0xBB, 0xE1, 0x1A,
+    0x3A, 0x03, 0x70, 0x37, 0xDF, 0x86, 0x01, 0xCD, 0x5D, 0x3C, 0xD9, 0xD1, 0x4F, 0x8F, 0x2F, 0x44,
+    0xAB, 0x00, 0x0A, 0xB6, 0x1E, 0x57, 0x51, 0x13, 0x4D, 0xC1, 0xFA, 0x25, 0x32, 0x3D, 0x99, 0x6C,
+    0xDF, 0xD4, 0x3B, 0x15, 0xD2, 0x9D, 0x91, 0x4D, 0xFE, 0x54, 0xF4, 0x38, 0xD5, 0xF2, 0xCD, 0xC5,
+    0x7C, 0x73, 0x32, 0x82, 0xC2, 0x1D, 0x98, 0x7D, 0x0A, 0x6C, 0xD8, 0x7F, 0x0C, 0x70, 0xE0, 0x3B,
+    0x66, 0x4E, 0x70, 0x1E, 0x00, 0xA9, 0x9E, 0xC8, 0xC3, 0x4F, 0x30, 0x97, 0x47, 0x6A, 0x2F, 0xFC,
+    0x53, 0xB6, 0x45, 0x15, 0x3B, 0xF4, 0xB7, 0xF8, 0x50, 0x7A, 0x29, 0x27, 0x72, 0x2B, 0x2F, 0x0E,
+    0x68, 0xBD, 0x08, 0x61, 0x6F, 0x61, 0x4D, 0xF8, 0x5D, 0xFE, 0x7C, 0xC7, 0xDE, 0xA4, 0x6D, 0xF6,
+    0x87, 0x3C, 0x5B, 0x3A, 0x6C, 0xB2, 0x3F, 0xAA, 0xD8, 0xCE, 0xA5, 0x4A, 0xDF, 0xC6, 0x42, 0x11,
+    0x15, 0x9D, 0xD2, 0xD0, 0x12, 0x2D, 0x9D, 0xD0, 0xCA, 0x62, 0xD6, 0x1E, 0x31, 0x17, 0x59, 0x06,
+    0x22, 0x55, 0xC4, 0xC3, 0x14, 0x75, 0x1D, 0x03, 0xC5, 0x64, 0x25, 0x85, 0xFE, 0x53, 0xF7, 0x2C,
+    0x60, 0xF4, 0x4F, 0x17, 0x30, 0xB6, 0xA7, 0x04, 0x54, 0xF1, 0x89, 0xF3, 0x40, 0xA3, 0xCA, 0x6F,
+    0x14, 0xCA, 0xC7, 0x10, 0x5E, 0x9B, 0x6A, 0xC0, 0x7D, 0x63, 0xA5, 0xE2, 0xFC, 0x9D, 0x13, 0xBD,
+    0x55, 0x62, 0xD7, 0x02, 0x45, 0x65, 0xED, 0x6A, 0x99, 0x3E, 0x7A, 0x57, 0x31, 0x3F, 0x7F, 0xA9,
+    0x56, 0xCD, 0xF7, 0xD4, 0x39, 0xFF, 0x96, 0x7A, 0x2F, 0x2A, 0x4D, 0x0E, 0x54, 0xB6, 0xDC, 0x56,
+    0x49, 0xD3, 0xAB, 0x2E, 0xE2, 0x81, 0xBB, 0x38, 0xE8, 0x60, 0xAB, 0x06, 0xD0, 0xA0, 0x6B, 0x6C,
+    0x30, 0x0F, 0x52, 0xE1, 0x0F, 0xA3, 0x12, 0xB9, 0x56, 0xD1, 0x8F, 0xA6, 0x9C, 0xEA, 0x16, 0x24,
+    0xEA, 0x19, 0x64, 0x3A, 0xF1, 0xCB, 0x7A, 0x63, 0x23, 0x1A, 0xB1, 0xD2, 0x5F, 0xF0, 0x2E, 0x8C,
+    0xC7, 0x39, 0x0F, 0x4F, 0x37, 0x63, 0x22, 0x68, 0x3C, 0x94, 0x9C, 0x37, 0x58, 0xD7, 0xC9, 0x8A,
+    0xD5, 0x7E, 0x8A, 0x28, 0xD5, 0x38, 0xC8, 0xCE, 0x64, 0x1D, 0xD6, 0x43, 0xB4, 0x50, 0xFC, 0xCE,
+    0x11, 0x1B, 0x6A, 0x46, 0xAC, 0xE2, 0x89, 0x7A, 0xD7, 0x9B, 0x9D, 0x6D, 0x0A, 0x97, 0x87, 0x69,
+    0x64, 0xB4, 0xCA, 0xF5, 0x30, 0xE1, 0xA9, 0x96, 0xAF, 0x64, 0x2D, 0x1F, 0xCF, 0x4A, 0xD6, 0xFE,
+    0x3B, 0x0C, 0xCB, 0x54, 0x11, 0x4F, 0xFF, 0xFE, 0x22, 0xCE, 0x62, 0x5C, 0xDD, 0xAA, 0xBF, 0x0E,
+    0xFD, 0x51, 0xB2, 0x2B, 0x3E, 0x8A, 0x6D, 0xAF, 0x5A, 0xBB, 0x78, 0xBF, 0x57, 0x74, 0x82, 0x6B,
+    0x31, 0x94, 0x28, 0x06, 0x5F, 0xB7, 0xD4, 0x99, 0xC5, 0xD8, 0x9F, 0x5E, 0x0E, 0xF1, 0xE0, 0x1D,
+    0x3D, 0x74, 0xC7, 0x30, 0xA7, 0x7A, 0xF6, 0xCE, 0xC9, 0xC3, 0x77, 0x3E, 0x29, 0xBC, 0x51, 0x08,
+    0xDD, 0xC6, 0x65, 0xA9, 0x6C, 0x6B, 0xFD, 0xA7, 0x8D, 0x03, 0xC4, 0xFD, 0x78, 0x63, 0x09, 0xC2,
+    0xF0, 0x0F, 0xD7, 0xF6, 0x94, 0xA0, 0xEB, 0xB1, 0xBA, 0xF1, 0xD8, 0xC5, 0x64, 0xCE, 0xB5, 0xA9,
+    0x9F, 0x5A, 0xEF, 0x9E, 0xC4, 0x19, 0x59, 0xB9, 0xFA, 0x97, 0x74, 0x3A, 0x3A, 0xCC, 0xE5, 0x4C,
+    0x2F, 0x83, 0xEA, 0x9D, 0xCA, 0x9F, 0x5C, 0xDD, 0x3D, 0xBF, 0x73, 0x21, 0xF7, 0xB0, 0x75, 0x85,
+    0x7C, 0xC9, 0xE8, 0x4C, 0xAA, 0x6C, 0x7A, 0xBA, 0x36, 0xD9, 0xD7, 0xBD, 0xD3, 0xFA, 0xA1, 0xA6,
+    0xCB, 0xCE, 0xD1, 0x05, 0x61, 0x60, 0x92, 0xC2, 0x9E, 0x48, 0x6A, 0x5A, 0x53, 0x98, 0xCD, 0x81,
+    0x22, 0xEB, 0x7A, 0x58, 0x4D, 0x5F, 0x1E, 0x5F, 0x08, 0x6A, 0x4E, 0x57, 0x34, 0x64, 0xE4, 0xEC,
+    0xC6, 0xF3, 0x85, 0x81, 0x76, 0xB6, 0x7A, 0x2E, 0x52, 0x7F, 0xF4, 0xBB, 0x6F, 0x6A, 0x7B, 0xE0,
+    0xB1, 0x28, 0x71, 0xE0, 0x3A, 0x01, 0x49, 0xB0, 0xAF, 0x36, 0xDA, 0x7B, 0x2A, 0x22, 0x46, 0x8D,
+    0x11, 0x9C, 0x51, 0x1B, 0x7A, 0x06, 0x5B, 0x3D, 0x89, 0x46, 0xCB, 0x62, 0xF3, 0xFF, 0x32, 0x6A,
+    0x25, 0x2C, 0xF5, 0xB8, 0xB0, 0xE9, 0x3B, 0x2A, 0x2B, 0x6B, 0x93, 0x99, 0xA3, 0x89, 0xB8, 0x51,
+    0x61, 0x3E, 0x8A, 0x12, 0xC8, 0x9B, 0xE8, 0x29, 0xE0, 0x7C, 0xD2, 0xEE, 0x52, 0xB2, 0x3E, 0xD7,
+    0xA1, 0xEB, 0x1A, 0xD1, 0x3E, 0xAC, 0x02, 0x18, 0x14, 0xEF, 0xB2, 0xEC, 0x02, 0x2F, 0x26, 0xC0,
+    0x0B, 0xD4, 0x50, 0xBE, 0x56, 0x7C, 0xD1, 0x99, 0xB4, 0x06, 0x92, 0x81, 0x05, 0xAF, 0x1E, 0x3A,
+    0x51, 0xBC, 0x6F, 0x32, 0x5C, 0x0B, 0xF7, 0x1B, 0x17, 0x93, 0x30, 0x44, 0x6B, 0xA2, 0xB2, 0x3C,
+    0x55, 0x69, 0xFE, 0xC8, 0xFB, 0xAB, 0x4F, 0xD4, 0x20, 0x68, 0xA4, 0x18, 0xCC, 0x0F, 0x56, 0xFF,
+    0xFA, 0x02, 0x37, 0x17, 0xCC, 0x19, 0x9C, 0x5E, 0xDA, 0xAA, 0xB5, 0xA7, 0x88, 0x48, 0x59, 0xEC,
+    0x47, 0x3A, 0xCC, 0x7A, 0x91, 0x99, 0x65, 0xB8, 0x91, 0x81, 0x46, 0x9E, 0xAF, 0xC1, 0xE0, 0xA2,
+    0x9E, 0xAE, 0x71, 0xE5, 0x24, 0xFC, 0x6A, 0x4B, 0xF8, 0x15, 0xA6, 0x55, 0xE2, 0x8C, 0x6E, 0x72,
+    0x8F, 0xFB, 0x8C, 0x7C, 0x1B, 0x1D, 0xC7, 0xC0, 0x2E, 0xF2, 0x8A, 0x8C, 0xFA, 0xCE, 0xFD, 0xE1,
+    0x57, 0xE7, 0x76, 0xE0, 0x57, 0xCB, 0xFE, 0x1B, 0x25, 0x22, 0xDF, 0x31, 0x69, 0x90, 0x1D, 0x3F,
+    0x39, 0xB2, 0x33, 0x74, 0xD9, 0x10, 0x4C, 0xB5, 0x1B, 0x0B, 0x76, 0x81, 0x9C, 0x1D, 0x8C, 0x54,
+    0x34, 0x5D, 0xFD, 0x5F, 0xBB, 0xB9, 0xA6, 0xA5, 0x2B, 0x5A, 0x7D, 0xF8, 0xED, 0xA4, 0x47, 0x2F,
+    0x96, 0xA4, 0x83, 0x91, 0x9A, 0xAE, 0x20, 0x0D, 0xF3, 0x16, 0x6E, 0x78, 0xD9, 0x68, 0xEC, 0x68,
+    0x74, 0x7D, 0xB8, 0x34, 0xFE, 0x98, 0xF4, 0x86, 0x34, 0xCD, 0x5B, 0xE0, 0x60, 0x93, 0x01, 0xF6,
+    0x5F, 0xA0, 0xC1, 0xF2, 0xBD, 0xA9, 0x00, 0x4F, 0x9B, 0x6E, 0xE1, 0x0D, 0x41, 0x1F, 0xA2, 0x6B,
+    0x3D, 0xBA, 0x47, 0x9D, 0x9A, 0x31, 0x2E, 0xE7, 0x61, 0x43, 0x90, 0x05, 0x6F, 0xD6, 0x05, 0xEB,
+    0xC1, 0x48, 0x39, 0x9E, 0xB9, 0xB7, 0xA0, 0xA7, 0x9E, 0x61, 0x07, 0x29, 0xF9, 0x7F, 0x10, 0x43,
+    0xE0, 0x96, 0xBE, 0x6A, 0xD1, 0x8D, 0x4B, 0x9E, 0x1D, 0xD6, 0x8B, 0xA3, 0x3E, 0x91, 0x62, 0x68,
+    0x34, 0xBD, 0x7C, 0xF2, 0xB8, 0x99, 0x4F, 0x09, 0xFD, 0xA2, 0x56, 0x84, 0x0B, 0xCF, 0x35, 0xE5,
+    0x25, 0x6E, 0xC5, 0x71, 0x3B, 0x21, 0xDE, 0x3F, 0x66, 0x12, 0x33, 0xC5, 0x3A, 0x19, 0xAB, 0xC3,
+    0xD4, 0x70, 0xCE, 0x9F, 0x1F, 0xBD, 0xCD, 0xDC, 0xCB, 0xEE, 0xC1, 0xFB, 0xF5, 0x40, 0xF9, 0xFF,
+    0x31, 0xF8, 0xF7, 0x1F, 0x83, 0xBF, 0xED, 0x88, 0xBE, 0x75, 0xFD, 0xE8, 0xDC, 0x83, 0x90, 0xBB,
+    0xBB, 0x3F, 0xB1, 0x3F, 0x1B, 0xA1, 0x77, 0xF9, 0x3B, 0xB6, 0xF9, 0xA0, 0x3A, 0x18, 0xC9, 0x9C,
+    0x3B, 0xFE, 0xD9, 0x5D, 0x63, 0x98, 0x7E, 0x8C, 0xA9, 0x6A, 0xB3, 0x55, 0x38, 0x58, 0x4B, 0x77,
+    0xC2, 0x24, 0x0B, 0x54, 0x82, 0x0B, 0xB3, 0x2E, 0x9E, 0xD1, 0x75, 0x5C, 0x1D, 0x7C, 0x25, 0xAB,
+    0xD6, 0x0D, 0x69, 0xC1, 0xB8, 0x21, 0xFB, 0xDB, 0x59, 0x30, 0x44, 0x9B, 0x93, 0x05, 0xAD, 0x72,
+    0xFD, 0x3C, 0xFF, 0x25, 0x77, 0xD7, 0x78, 0x6D, 0xC8, 0x19, 0x14, 0x4B, 0xC9, 0x3A, 0x1E, 0x5F,
+    0x1A, 0x27, 0x98, 0xBB, 0x26, 0x02, 0x63, 0x2C, 0xCC, 0x14, 0x2D, 0xFC, 0xD2, 0x16, 0xDA, 0x10,
+    0xA0, 0x72, 0xFF, 0x44, 0x7B, 0x4A, 0x3D, 0xE7, 0x0F, 0xD6, 0xDA, 0x13, 0xDB, 0xE9, 0x00, 0xCE,
+    0x12, 0xCA, 0x4B, 0xFE, 0xA2, 0x50, 0xF0, 0x8C, 0xC3, 0xBB, 0xEF, 0x3D, 0x89, 0x50, 0x13, 0xBE,
+    0xFB, 0xC2, 0xCD, 0xD6, 0x45, 0x71, 0x7D, 0x2B, 0x61, 0x7D, 0x00, 0x97, 0x03, 0x7C, 0x7B, 0x87,
+    0xD5, 0xAB, 0x2C, 0xE2, 0x7E, 0x73, 0xAA, 0x5E, 0x3D, 0x6F, 0x45, 0xFF, 0xF2, 0xAA, 0x98, 0x1B,
+    0x22, 0x61, 0x63, 0xEC, 0xE4, 0x3B, 0x87, 0x25, 0x35, 0xF3, 0x6D, 0x00, 0x97, 0x75, 0xA1, 0x69,
+    0xD8, 0xF5, 0xF2, 0xA2, 0x2C, 0xB2, 0x9D, 0x63, 0x19, 0xAF, 0xDA, 0xC6, 0xD6, 0x70, 0x7A, 0x3B,
+    0x57, 0xE3, 0x2A, 0xC9, 0x54, 0xA5, 0x2B, 0xA1, 0xE5, 0xEA, 0xF3, 0x9A, 0xF1, 0xDF, 0x4B, 0x3D,
+    0xF6, 0xA5, 0x80, 0xBC, 0x2D, 0xF5, 0xA4, 0xF2, 0x4E, 0x09, 0x77, 0x93, 0x31, 0x30, 0xAE, 0xB3,
+    0x65, 0x6D, 0x40, 0xC8, 0x63, 0x00, 0x22, 0x5E, 0x63, 0x1A, 0x6D, 0x09, 0x41, 0x93, 0x09, 0xCB,
+    0x2C, 0xBF, 0x68, 0x41, 0xE2, 0x6C, 0xF6, 0x3D, 0x0D, 0x7A, 0xD6, 0x9C, 0x18, 0xAD, 0xE2, 0x08,
+    0xC5, 0xB1, 0x57, 0x36, 0x37, 0xB3, 0x43, 0xA0, 0xD6, 0x85, 0x06, 0x75, 0xC2, 0xC5, 0x75, 0x42,
+    0x17, 0x3F, 0xC0, 0x05, 0xF1, 0x2C, 0x31, 0x10, 0x77, 0x5C, 0x4D, 0x20, 0x8E, 0x57, 0x68, 0x31,
+    0xDD, 0x94, 0xE6, 0xA6, 0xEF, 0xFA, 0xAA, 0x4E, 0x80, 0x93, 0x29, 0x66, 0xE0, 0x1F, 0x1E, 0x16,
+    0x27, 0xEC, 0x25, 0x6D, 0x76, 0x94, 0x68, 0xB3, 0xA3, 0x46, 0x57, 0x1D, 0x31, 0x79, 0x13, 0x98,
+    0x6C, 0xEE, 0x25, 0x64, 0xB1, 0x9B, 0xB9, 0xD9, 0xD1, 0x68, 0x47, 0x49, 0xB2, 0x38, 0xC2, 0xC1,
+    0xDE, 0x5C, 0xB3, 0xA3, 0x68, 0x6E, 0x76, 0x64, 0x85, 0x11, 0xCF, 0x06, 0xD6, 0xEC, 0xA8, 0xD7,
+    0x66, 0x47, 0x7D, 0xDC, 0x18, 0xEC, 0x6D, 0x6A, 0x76, 0xB4, 0x39, 0xD5, 0xEC, 0xC8, 0x8A, 0x47,
+    0xB3, 0xAD, 0xD9, 0x59, 0x79, 0xEF, 0x60, 0x6F, 0xED, 0x49, 0xD8, 0xDB, 0x34, 0x52, 0x6B, 0x4E,
+    0x21, 0x24, 0x3E, 0x66, 0x11, 0x1E, 0x2B, 0xF0, 0x4A, 0x67, 0xC7, 0x61, 0x09, 0xCA, 0x54, 0x77,
+    0x89, 0xF1, 0x31, 0xF4, 0x22, 0xEA, 0xDD, 0x49, 0xCA, 0x41, 0x67, 0x85, 0xF3, 0x61, 0x6F, 0xA6,
+    0x63, 0xE4, 0x1E, 0xC2, 0xCE, 0x85, 0x24, 0x8A, 0xB3, 0xDB, 0x62, 0xFE, 0x5D, 0xE4, 0x59, 0xB0,
+    0x8A, 0xF4, 0x34, 0x5D, 0xB9, 0xC8, 0x46, 0x09, 0xCF, 0x3A, 0xF3, 0xF5, 0x63, 0x66, 0xE1, 0x2D,
+    0xA6, 0x51, 0xFD, 0xAD, 0x26, 0xC8, 0xF4, 0xE6, 0x9B, 0x62, 0x3C, 0x4B, 0x2D, 0x7E, 0x38, 0xBD,
+    0xFA, 0xA9, 0x27, 0x94, 0xB4, 0x2B, 0xEA, 0xF7, 0xBC, 0xA5, 0xDE, 0xC8, 0xDB, 0x5C, 0x81, 0xA0,
+    0x4A, 0xD2, 0x8F, 0xA6, 0x57, 0x3F, 0x57, 0x6D, 0xA8, 0x5C, 0x48, 0xEE, 0xC1, 0x85, 0xB9, 0x9D,
+    0xFF, 0x31, 0x9D, 0x2F, 0x16, 0xD0, 0x46, 0x84, 0x6D, 0x9F, 0x6A, 0xE7, 0xDF, 0xD8, 0x65, 0x2D,
+    0xB4, 0x8F, 0xD6, 0xA2, 0x31, 0xE3, 0xA9, 0x9D, 0x7F, 0x7A, 0x8F, 0x76, 0xFE, 0xE8, 0x96, 0x30,
+    0xB5, 0xF3, 0xFF, 0x28, 0x69, 0xAB, 0x47, 0x7F, 0x69, 0x2D, 0x98, 0xD2, 0xB6, 0xFC, 0x48, 0x69,
+    0xFB, 0x81, 0x08, 0xF7, 0xFA, 0xE1, 0x13, 0x38, 0x07, 0x61, 0x5C, 0xE7, 0x6F, 0xDD, 0x78, 0xE9,
+    0xA7, 0x23, 0xDC, 0x27, 0x60, 0xF9, 0x7E, 0xDC, 0x24, 0xFE, 0xB0, 0x97, 0xEF, 0xFF, 0x3B, 0x17,
+    0xDE, 0xBF, 0x7D, 0x59, 0x2E, 0xED, 0xCB, 0x40, 0xED, 0xCB, 0x92, 0x8D, 0x86, 0xD0, 0x22, 0x9E,
+    0xD6, 0xC3, 0xC5, 0x65, 0x05, 0xED, 0x04, 0xBE, 0x3A, 0x71, 0xA5, 0xA1, 0xE5, 0x3B, 0xFF, 0x23,
+    0x5D, 0x9C, 0xA3, 0x73, 0xAA, 0xC1, 0x8A, 0xD0, 0xF3, 0xF3, 0xA4, 0xE8, 0x6C, 0x5F, 0xF6, 0x8C,
+    0x14, 0x8A, 0xDC, 0x5C, 0xA9, 0xF7, 0x78, 0x53, 0xCF, 0xB4, 0xB9, 0x3E, 0x79, 0x8F, 0xEF, 0xDF,
+    0xBE, 0x5C, 0x7D, 0x4C, 0x07, 0xBC, 0xD7, 0x1A, 0x5A, 0xB6, 0xE8, 0xDF, 0xE1, 0xE1, 0xD5, 0xD3,
+    0x94, 0x95, 0x21, 0x8C, 0x15, 0xCE, 0xA4, 0x10, 0x75, 0x1A, 0x6B, 0x18, 0x8D, 0xF9, 0x3C, 0x0B,
+    0xB7, 0xB1, 0xA1, 0x3A, 0xAC, 0x37, 0xAC, 0xE9, 0x03, 0xD5, 0x9F, 0xB7, 0xF4, 0xA6, 0x3D, 0x2D,
+    0x42, 0x6D, 0x9D, 0x10, 0xE9, 0x70, 0x99, 0x88, 0xC9, 0xDA, 0x4B, 0x4A, 0xD9, 0x7D, 0x65, 0x08,
+    0xE1, 0x04, 0xC9, 0x8F, 0xD4, 0x1A, 0xFC, 0x89, 0x9E, 0x4C, 0xA3, 0x58, 0xB1, 0x70, 0x5C, 0x06,
+    0x9E, 0x0C, 0x0D, 0x61, 0x9E, 0x97, 0x65, 0x51, 0x35, 0x9C, 0x54, 0x9A, 0xB1, 0xA8, 0xBF, 0xA8,
+    0x45, 0x13, 0x8B, 0x33, 0x4B, 0x77, 0x71, 0xBE, 0x7B, 0x87, 0x87, 0xBB, 0xCB, 0xDA, 0xE3, 0x61,
+    0xAC, 0xE8, 0x77, 0x55, 0xF3, 0x34, 0x6A, 0xD6, 0xE8, 0x6A, 0x41, 0x41, 0xAC, 0x05, 0x06, 0x88,
+    0x4B, 0x03, 0xD9, 0xDD, 0x6A, 0x93, 0x25, 0xDD, 0x6B, 0x30, 0xBC, 0x71, 0x6E, 0x62, 0x41, 0x6B,
+    0x21, 0x53, 0xBA, 0x9F, 0x71, 0xC0, 0x46, 0xFE, 0x9B, 0xBA, 0x86, 0xFE, 0x50, 0x4D, 0xD9, 0x3F,
+    0xD2, 0xD2, 0xB6, 0xB7, 0x75, 0x64, 0xE6, 0xC9, 0xAE, 0x97, 0x19, 0x18, 0x6B, 0xB4, 0x64, 0x87,
+    0x62, 0xE7, 0xCB, 0x2C, 0x95, 0x65, 0x34, 0xB9, 0x1E, 0x1F, 0xD2, 0x96, 0xAC, 0xB9, 0xDA, 0xCB,
+    0x99, 0xEB, 0x7B, 0x78, 0x49, 0xCB, 0x3B, 0xCA, 0xAF, 0x69, 0x51, 0xF4, 0xD7, 0xAC, 0xE8, 0x75,
+    0xA3, 0x71, 0x97, 0x07, 0x3F, 0xA3, 0x2C, 0xCE, 0x34, 0xE1, 0xCE, 0x43, 0xD5, 0xB0, 0x47, 0x15,
+    0x0E, 0xA5, 0x08, 0xF9, 0x33, 0x66, 0xFD, 0x19, 0xE4, 0xBB, 0xF7, 0x6B, 0x8F, 0xF2, 0xEC, 0xE4,
+    0x21, 0xD2, 0x7E, 0x75, 0xC4, 0x81, 0xEB, 0x51, 0x2C, 0x32, 0x56, 0xBA, 0x56, 0x07, 0xFE, 0x29,
+    0x15, 0xF6, 0x19, 0x61, 0xBF, 0xF7, 0xA5, 0xE7, 0x59, 0x45, 0x57, 0x3F, 0xA6, 0xFE, 0x35, 0x4D,
+    0xEE, 0x90, 0x79, 0x54, 0x61, 0xDB, 0x65, 0xDD, 0x17, 0xFD, 0x59, 0xFA, 0xFB, 0x33, 0xB6, 0x0A,
+    0xE2, 0x26, 0xD5, 0x22, 0x80, 0x5C, 0xD3, 0xA2, 0xBC, 0x51, 0xD5, 0x9C, 0x52, 0x36, 0xAE, 0xAE,
+    0xFD, 0xA7, 0xAB, 0x16, 0x51, 0xF0, 0xE3, 0x0E, 0xA6, 0xC3, 0x4E, 0xF6, 0x8B, 0xD6, 0x3B, 0x5D,
+    0x08, 0xC7, 0xEB, 0x0F, 0x9F, 0x51, 0x2D, 0x72, 0xF5, 0x03, 0x77, 0xDA, 0x3C, 0xA3, 0x5A, 0x84,
+    0x49, 0xB7, 0xA8, 0x67, 0x8F, 0x58, 0xBC, 0xF8, 0xDE, 0x9E, 0xCF, 0x7D, 0x0B, 0x4A, 0xE0, 0xEF,
+    0x74, 0x3C, 0x6F, 0x10, 0xD8, 0x6F, 0x74, 0xF4, 0x89, 0xFB, 0x0B, 0x3B, 0x05, 0x25, 0x8B, 0x8E,
+    0x9A, 0x73, 0x5B, 0xCD, 0xB3, 0x0B, 0x4A, 0x3E, 0xFC, 0x0E, 0x90, 0x1F, 0x57, 0x87, 0xD1, 0x68,
+    0x87, 0x15, 0x0E, 0x45, 0xBF, 0xBF, 0x73, 0xFB, 0xEA, 0x0E, 0x18, 0xE6, 0x37, 0xE6, 0xC4, 0xED,
+    0x07, 0xE9, 0xAF, 0x79, 0xA2, 0x3D, 0xE9, 0xDC, 0x5A, 0xF3, 0xAC, 0x1E, 0xFE, 0x89, 0x36, 0xB9,
+    0x6D, 0x76, 0xE0, 0x2E, 0x4C, 0x75, 0xA9, 0xA8, 0xC1, 0xE7, 0xDD, 0x71, 0x65, 0x50, 0xB4, 0x6D,
+    0xBE, 0x50, 0x4C, 0xB0, 0x8F, 0x83, 0xA9, 0x35, 0x46, 0x3D, 0x3D, 0x8D, 0x13, 0xE8, 0xEA, 0x39,
+    0xEF, 0x3D, 0xBF, 0x68, 0x39, 0x4C, 0xF1, 0x04, 0x7D, 0x52, 0xF8, 0x43, 0xDE, 0x4D, 0x79, 0x22,
+    0xE7, 0xA8, 0xCF, 0x31, 0x05, 0x6B, 0x2A, 0x3D, 0x81, 0xE7, 0x06, 0x37, 0x7F, 0x0D, 0xB5, 0x4D,
+    0x25, 0x90, 0x5A, 0x03, 0xB9, 0xBD, 0xEA, 0x8A, 0x20, 0x11, 0x55, 0xD3, 0x2A, 0xC8, 0xE1, 0xE6,
+    0xE8, 0x59, 0x6C, 0x41, 0x96, 0x91, 0x05, 0x17, 0x10, 0x3E, 0x35, 0xD8, 0x71, 0xD2, 0x59, 0x78,
+    0x01, 0x89, 0x3F, 0x2B, 0x85, 0x4C, 0xFA, 0xD8, 0x4A, 0x20, 0xB5, 0xB1, 0x94, 0x22, 0xAB, 0x34,
+    0xC4, 0x80, 0x27, 0x57, 0x0E, 0x99, 0xB5, 0x2E, 0xC8, 0x30, 0x39, 0x13, 0x62, 0xB2, 0x9A, 0x3F,
+    0x91, 0x6E, 0x2D, 0xCE, 0x20, 0x0C, 0xB5, 0x40, 0x83, 0x5C, 0xED, 0x00, 0xC1, 0x0F, 0x9E, 0xD1,
+    0xD7, 0x38, 0x3E, 0x41, 0x0A, 0x17, 0x06, 0x6C, 0xDF, 0x95, 0x1E, 0x2F, 0xDA, 0xFA, 0x7A, 0xCA,
+    0x28, 0xE7, 0xE8, 0x1A, 0x31, 0x55, 0x9C, 0x1D, 0x5B, 0x78, 0xB2, 0x3F, 0x07, 0x7B, 0x76, 0x7A,
+    0x31, 0x4C, 0x69, 0x14, 0xE0, 0xFB, 0xA3, 0x1E, 0xA3, 0x58, 0x17, 0x5B, 0x44, 0xF8, 0xCA, 0xE7,
+    0x37, 0xAC, 0x3D, 0xFA, 0xCD, 0x0D, 0x4F, 0x33, 0xF9, 0x16, 0xBF, 0x2B, 0x1F, 0x63, 0x13, 0xCC,
+    0x11, 0xE1, 0x8D, 0x3E, 0xD8, 0x86, 0x9B, 0x87, 0xC2, 0xE1, 0xA8, 0x0F, 0xD8, 0x1A, 0xBA, 0xF2,
+    0xC6, 0x96, 0x11, 0xEC, 0xBD, 0x4F, 0x7B, 0x47, 0x5B, 0x83, 0x31, 0x3D, 0x72, 0x06, 0x5E, 0xED,
+    0xF7, 0xAD, 0xC9, 0x4D, 0xBF, 0xAC, 0x7A, 0x5C, 0x28, 0xCA, 0x8F, 0xA6, 0x13, 0xAE, 0xEE, 0xD4,
+    0xEB, 0x3B, 0x3B, 0x35, 0xDA, 0xD9, 0xA9, 0x8F, 0xD4, 0x54, 0x53, 0x18, 0xFC, 0x7A, 0x2A, 0x47,
+    0xF8, 0x34, 0x55, 0x8B, 0x57, 0xEF, 0x55, 0x2D, 0x5E, 0x59, 0xB5, 0x78, 0xB3, 0x0B, 0x3F, 0x73,
+    0xAD, 0x50, 0xE3, 0xDD, 0x6A, 0xF1, 0x47, 0x4C, 0x22, 0xE5, 0x86, 0xEE, 0x49, 0xD7, 0xA7, 0xEA,
+    0x34, 0x3E, 0xE6, 0x6A, 0xF1, 0x63, 0x56, 0x8B, 0x6F, 0x17, 0x4B, 0x6A, 0x7F, 0x81, 0x64, 0xA5,
+    0x53, 0xF1, 0x43, 0x46, 0x42, 0xD4, 0x3F, 0xD6, 0x79, 0x3E, 0xF4, 0x31, 0x70, 0x31, 0xB1, 0x13,
+    0x86, 0x1D, 0x70, 0xE1, 0x14, 0x17, 0xC3, 0x0F, 0x91, 0x8B, 0x85, 0x71, 0xB1, 0xF8, 0x29, 0xB9,
+    0xE0, 0x13, 0xA7, 0xEA, 0x6B, 0xAB, 0xF1, 0xFF, 0x87, 0x9A, 0xFD, 0xFF, 0x0B, 0xED, 0x9C, 0x31,
+    0x90, 0xDB, 0xD6, 0x11, 0x86, 0x17, 0xE4, 0xE9, 0x10, 0x1D, 0xC7, 0xC2, 0x15, 0x72, 0x61, 0x5D,
+    0x2C, 0xA4, 0x50, 0xE1, 0xF1, 0x58, 0x87, 0x56, 0x85, 0x4E, 0x40, 0x9C, 0xC2, 0xA5, 0xAF, 0x50,
+    0x97, 0xC2, 0x8D, 0x2A, 0x17, 0xB9, 0x46, 0x85, 0x0B, 0xD9, 0xE4, 0x28, 0x45, 0x8A, 0x14, 0xB9,
+    0x26, 0x49, 0x99, 0x2B, 0x54, 0x48, 0x2A, 0xE2, 0x14, 0xCA, 0x8C, 0x0A, 0x49, 0x44, 0x26, 0x45,
+    0x8A, 0x34, 0xAC, 0x52, 0xC3, 0x33, 0x71, 0x92, 0x2E, 0x2C, 0xE0, 0x19, 0xCA, 0x26, 0xF9, 0xB2,
+    0xFB, 0xEF, 0x2E, 0x08, 0x48, 0x1A, 0x8F, 0x2B, 0xE9, 0x78, 0x0C, 0xE7, 0x84, 0x27, 0x1E, 0x41,
+    0x60, 0xDF, 0xFB, 0xDE, 0xEE, 0xDB, 0xDD, 0xB7, 0x38, 0x22, 0xA2, 0xC1, 0x84, 0xE4, 0x95, 0x56,
+    0x68, 0x72, 0x6D, 0x86, 0x53, 0x34, 0xDF, 0xA1, 0xE9, 0xFD, 0x1B, 0x4D, 0xFF, 0x6F, 0xB5, 0x34,
+    0xC9, 0x2F, 0xD1, 0xA4, 0xFD, 0x99, 0x34, 0x07, 0xFD, 0xB9, 0x34, 0x4F, 0x7A, 0x68, 0x6A, 0x34,
+    0xBD, 0x2A, 0x5A, 0x70, 0x13, 0x97, 0x68, 0x92, 0x11, 0x2D, 0xE5, 0x7C, 0x42, 0x93, 0x87, 0x10,
+    0xB8, 0x19, 0xA3, 0x89, 0xF8, 0x4A, 0x63, 0xBE, 0x30, 0xDF, 0x73, 0x58, 0xF0, 0xF9, 0x68, 0x92,
+    0x82, 0xCF, 0x1A, 0x51, 0x26, 0x27, 0x97, 0x74, 0x43, 0x1B, 0xF9, 0xEA, 0xB0, 0xDC, 0x0B, 0x27,
+    0xB4, 0x17, 0x9E, 0xE7, 0xA1, 0xE6, 0xEB, 0x2C, 0xA8, 0x79, 0xDD, 0xC2, 0x31, 0xD2, 0xDF, 0xF4,
+    0x96, 0xDA, 0xE8, 0xBB, 0x68, 0x4E, 0xAD, 0xD7, 0xB9, 0x43, 0xF9, 0x55, 0x58, 0xDE, 0xE1, 0x6E,
+    0x7F, 0x73, 0x34, 0x93, 0x1B, 0xC5, 0x2C, 0x43, 0x20, 0x3E, 0xB2, 0xE8, 0x83, 0x29, 0xF5, 0x6B,
+    0x4A, 0xA6, 0xF2, 0x9F, 0xA4, 0xC2, 0xCF, 0x84, 0xB2, 0x09, 0xA5, 0xA5, 0xC8, 0x90, 0xE1, 0x28,
+    0x3F, 0x23, 0x1A, 0x8E, 0x44, 0xD4, 0x71, 0x21, 0xC7, 0x20, 0x62, 0xF7, 0x02, 0x2E, 0x36, 0x16,
+    0x69, 0xDF, 0xE5, 0x63, 0x56, 0x3D, 0x1E, 0x7F, 0x44, 0x49, 0xA8, 0x86, 0x7C, 0xF1, 0x50, 0xE4,
+    0x7C, 0x97, 0x9B, 0x74, 0x4E, 0xE4, 0x2A, 0x30, 0x88, 0x18, 0xF4, 0xAC, 0x5A, 0x1D, 0x93, 0xB2,
+    0x2D, 0x28, 0x6D, 0x6B, 0x2F, 0xD2, 0x80, 0x5F, 0x5F, 0x8D, 0x15, 0x92, 0x35, 0x7A, 0xAE, 0xDC,
+    0x92, 0x74, 0xF4, 0xA4, 0xD1, 0xEF, 0xF7, 0x46, 0xED, 0xAB, 0xAC, 0x31, 0xDB, 0xE8, 0x01, 0x04,
+    0x42, 0xFF, 0xF7, 0xD1, 0x8F, 0xAD, 0x3E, 0x7A, 0x33, 0x90, 0xDF, 0x44, 0x63, 0x19, 0xC6, 0xFE,
+    0x3F, 0x57, 0x3D, 0xEF, 0x8F, 0x4E, 0x15, 0x66, 0x7D, 0xDD, 0xD7, 0xA6, 0x5F, 0x1B, 0x0E, 0x48,
+    0x1A, 0xCF, 0xF7, 0x95, 0xCA, 0xE2, 0x8A, 0xF2, 0x18, 0xEA, 0x4C, 0xAD, 0x13, 0x74, 0x61, 0x30,
+    0xEA, 0x77, 0xA7, 0xC2, 0x0B, 0x30, 0x9D, 0xA6, 0xE3, 0x74, 0x9E, 0x06, 0xD4, 0x89, 0x3A, 0x52,
+    0x67, 0xEA, 0x50, 0x9D, 0xAA, 0x63, 0x35, 0xAE, 0x0E, 0xD6, 0xC9, 0x3A, 0x5A, 0x67, 0xEB, 0x70,
+    0x8D, 0xAE, 0xE3, 0x75, 0xBE, 0x0E, 0xD8, 0x09, 0x3B, 0x62, 0x67, 0x6C, 0x90, 0xC9, 0x28, 0x53,
+    0x47, 0x85, 0x6F, 0xE2, 0xFE, 0x90, 0x2E, 0xE6, 0xCB, 0xF5, 0xE7, 0xA9, 0x5C, 0x68, 0xF1, 0x9E,
+    0x7C, 0x15, 0x63, 0x33, 0x97, 0x91, 0xE9, 0x4F, 0x84, 0x7F, 0x44, 0x54, 0x9C, 0x2A, 0xCE, 0xD1,
+    0x89, 0xCA, 0xA2, 0x83, 0x4B, 0x07, 0xC6, 0x28, 0xC6, 0xA0, 0x6E, 0xA7, 0x8B, 0x16, 0x62, 0x23,
+    0xFC, 0x6A, 0xC0, 0xEB, 0xAB, 0xAA, 0x87, 0x90, 0x71, 0xDE, 0xEA, 0x7E, 0x0A, 0x69, 0xB6, 0x3F,
+    0x46, 0xE7, 0x4F, 0x3F, 0x42, 0x79, 0xBD, 0x6D, 0x6D, 0x30, 0x34, 0x1F, 0x9A, 0x72, 0xF5, 0x4C,
+    0xE9, 0xB2, 0x91, 0xAA, 0xEE, 0x75, 0x53, 0xDD, 0xDD, 0xFF, 0xAB, 0x6E, 0xF3, 0x1A, 0xA3, 0x77,
+    0xBF, 0x43, 0x9F, 0x22, 0x1C, 0xF7, 0x4A, 0x51, 0x63, 0x99, 0x0C, 0xC9, 0xE2, 0xE2, 0x9A, 0xCC,
+    0x81, 0x88, 0xB6, 0x14, 0xCD, 0xBB, 0x98, 0x07, 0xCB, 0x27, 0xF2, 0xBB, 0xAF, 0x42, 0x8D, 0x45,
+    0xF5, 0x52, 0x7B, 0x59, 0x55, 0xDD, 0xA6, 0x4D, 0xD0, 0x6D, 0xF2, 0x79, 0x7B, 0x41, 0x3E, 0x15,
+    0x42, 0xF4, 0x4D, 0x60, 0xA9, 0xA2, 0xD2, 0xA7, 0xB2, 0x48, 0x0D, 0xC1, 0x92, 0xB5, 0xD1, 0xF6,
+    0x9E, 0x2E, 0xCB, 0x03, 0xC5, 0x98, 0xA9, 0xA7, 0x35, 0xCE, 0x81, 0x71, 0x06, 0x8C, 0xF1, 0x04,
+    0x18, 0x3B, 0xB2, 0x6F, 0x96, 0xA7, 0xAC, 0x63, 0x14, 0x2F, 0xD4, 0x09, 0x45, 0x47, 0xB3, 0x02,
+    0xE3, 0x53, 0x9E, 0x56, 0xB2, 0xD1, 0x31, 0x44, 0xD6, 0xA1, 0xC7, 0x90, 0x27, 0xF8, 0x7F, 0x3C,
+    0xED, 0x6A, 0xA3, 0xBD, 0x37, 0x87, 0xFB, 0x86, 0xFE, 0x12, 0x67, 0x46, 0x65, 0x21, 0xAB, 0x79,
+    0x34, 0xED, 0x81, 0xED, 0xF2, 0x4B, 0x9C, 0x32, 0x54, 0x3F, 0x3B, 0x9D, 0xD1, 0xD9, 0xD2, 0xEC,
+    0xDE, 0x3D, 0xF4, 0x00, 0x32, 0xA7, 0x20, 0x29, 0xEA, 0x4D, 0xC7, 0x87, 0xE2, 0x96, 0x4E, 0x49,
+    0xC4, 0x7E, 0xF6, 0xF3, 0x0A, 0xB7, 0x95, 0x71, 0x48, 0x74, 0xB6, 0x14, 0xA7, 0xCD, 0xCD, 0xCE,
+    0xB4, 0xD1, 0x15, 0x18, 0xE3, 0xD0, 0x2C, 0x43, 0x51, 0x79, 0xB8, 0x39, 0x3C, 0x2F, 0x15, 0xAB,
+    0x59, 0xAD, 0x91, 0x12, 0x10, 0xD2, 0xF1, 0x4F, 0xD6, 0x8B, 0xA7, 0x1B, 0x20, 0x15, 0xAF, 0xFF,
+    0x89, 0x0A, 0x38, 0xD0, 0xE6, 0xA8, 0xA3, 0xAD, 0xA3, 0xCD, 0xA1, 0x1B, 0x3D, 0x83, 0x5C, 0x5F,
+    0x8E, 0x56, 0x11, 0xEF, 0x1E, 0x86, 0xE4, 0x29, 0x18, 0x9F, 0xAC, 0x17, 0x63, 0xF3, 0xB5, 0xB2,
+    0x8E, 0xAF, 0x55, 0x8D, 0x5F, 0xF6, 0xB5, 0xA2, 0x92, 0x36, 0xC8, 0x22, 0xAB, 0x21, 0xAB, 0x06,
+    0x72, 0xD2, 0xF2, 0x17, 0x7C, 0xFC, 0xF3, 0x58, 0x04, 0x98, 0x0C, 0x56, 0xBE, 0xD6, 0x31, 0xAD,
+    0x15, 0x69, 0xE6, 0xF7, 0x27, 0xB0, 0x55, 0x83, 0xBC, 0xF8, 0xA4, 0xD4, 0x40, 0x04, 0x72, 0x66,
+    0xD6, 0xE7, 0x82, 0xCE, 0x96, 0x93, 0x65, 0xAF, 0x47, 0x2D, 0xE7, 0x98, 0xFA, 0x8B, 0xF6, 0xBB,
+    0x08, 0x32, 0xF7, 0x30, 0x38, 0x51, 0x85, 0xB9, 0xFD, 0x1C, 0x43, 0xA3, 0x23, 0x93, 0xCD, 0x4F,
+    0xAD, 0x69, 0x4E, 0x15, 0x8B, 0xAA, 0xA1, 0x1E, 0xA1, 0xAE, 0x97, 0x75, 0xEE, 0xF2, 0x38, 0x86,
+    0x11, 0x3B, 0x8C, 0x68, 0x68, 0x5C, 0x22, 0xB0, 0xE4, 0x33, 0xE4, 0x6B, 0x32, 0x98, 0x84, 0x11,
+    0x96, 0x77, 0x41, 0xBF, 0xB3, 0xEC, 0x38, 0xA4, 0xD6, 0xCC, 0x3B, 0x23, 0x17, 0x82, 0x9C, 0x14,
+    0x07, 0x0C, 0xF1, 0xC0, 0x9C, 0xB7, 0x6E, 0xA3, 0xB3, 0x24, 0xD5, 0xA9, 0x93, 0x95, 0x8D, 0x8C,
+    0x27, 0x60, 0x27, 0x73, 0x8F, 0x65, 0x90, 0x45, 0x71, 0xAC, 0x5C, 0xF9, 0xE6, 0x3C, 0x34, 0x47,
+    0x2A, 0xA6, 0xC0, 0x0F, 0xC5, 0x4B, 0xF8, 0x3E, 0x53, 0xC9, 0xCC, 0x47, 0x0E, 0xED, 0x77, 0xF4,
+    0x78, 0x45, 0xA5, 0x27, 0x62, 0x25, 0x5F, 0x63, 0x2C, 0xF9, 0x26, 0x0B, 0xBE, 0x2F, 0x0B, 0x0E,
+    0x3C, 0xC3, 0x82, 0xE5, 0x0B, 0x2C, 0x16, 0xF7, 0x2B, 0x2B, 0x53, 0x9E, 0x25, 0xFF, 0x60, 0x5D,
+    0xCD, 0x39, 0x86, 0xA6, 0xE1, 0x6F, 0x7D, 0xE4, 0x70, 0xC8, 0x47, 0x3E, 0xA8, 0x0C, 0xED, 0x36,
+    0x7B, 0xAF, 0xDB, 0x53, 0xE9, 0xB7, 0x08, 0x2C, 0x77, 0x8C, 0x0E, 0xDB, 0x73, 0x0A, 0xC3, 0x83,
+    0xF9, 0xA4, 0x23, 0xF4, 0xA8, 0x93, 0x31, 0xCE, 0x34, 0x83, 0x71, 0x5D, 0x73, 0x8D, 0x96, 0x72,
+    0x94, 0xDE, 0xCA, 0xF9, 0xB6, 0xA6, 0x5A, 0x32, 0x59, 0xED, 0xEC, 0x76, 0xAB, 0xEB, 0xEB, 0xCD,
+    0x6F, 0xE7, 0x9E, 0xAF, 0x0D, 0x8F, 0x25, 0x56, 0x51, 0xA7, 0x56, 0x14, 0x77, 0x07, 0x8A, 0x2F,
+    0xE1, 0x81, 0x74, 0x80, 0x2E, 0x74, 0xD4, 0xEA, 0x35, 0x02, 0x7C, 0x47, 0x07, 0x2B, 0x4C, 0x2E,
+    0x60, 0x5C, 0x66, 0x92, 0x4C, 0x1A, 0xF4, 0x25, 0x9E, 0x66, 0x99, 0x86, 0x95, 0x2D, 0x8D, 0x67,
+    0x84, 0xC6, 0x2D, 0xDC, 0x6D, 0x74, 0x8D, 0xBB, 0x51, 0x3F, 0xA2, 0xAB, 0x83, 0x50, 0xD1, 0xB5,
+    0x48, 0xFA, 0xA1, 0x6B, 0xFF, 0x9B, 0xD1, 0x9F, 0x4F, 0xAD, 0xB5, 0x58, 0xB7, 0xAF, 0x0B, 0xCA,
+    0xD2, 0xD2, 0x77, 0xE1, 0x47, 0xDA, 0xE5, 0x3F, 0xA8, 0x66, 0x3C, 0xD5, 0xED, 0x16, 0x36, 0xCF,
+    0xD3, 0x57, 0x38, 0x1A, 0x46, 0xA7, 0xC1, 0xE3, 0x7C, 0x1C, 0x90, 0x13, 0x72, 0x44, 0xCE, 0xC8,
+    0x20, 0x39, 0x25, 0xC7, 0xE4, 0x9C, 0x1C, 0x94, 0x93, 0x72, 0x54, 0xCE, 0xCA, 0x29, 0xAD, 0x5A,
+    0x73, 0x0E, 0x52, 0xCF, 0x54, 0x5A, 0x02, 0xCA, 0x88, 0x39, 0x32, 0x67, 0xE6, 0xD0, 0x8C, 0x9A,
+    0x63, 0xEB, 0x5A, 0xC1, 0x9B, 0xAB, 0x5D, 0x0B, 0x31, 0x20, 0x83, 0x99, 0xEC, 0x58, 0xA4, 0x73,
+    0x41, 0x3A, 0x7C, 0x86, 0x34, 0x49, 0x8A, 0x8F, 0xE4, 0x42, 0x5B, 0x2F, 0xA5, 0x01, 0x80, 0x54,
+    0x99, 0x2A, 0x54, 0x50, 0x25, 0x60, 0x25, 0x70, 0x25, 0x80, 0x55, 0xB2, 0x8A, 0x56, 0xD9, 0x2A,
+    0x5C, 0xA5, 0x6B, 0x0B, 0x8B, 0x1E, 0xF3, 0xD1, 0x6A, 0xD9, 0x01, 0x62, 0x65, 0x6C, 0x90, 0x95,
+    0xB2, 0x63, 0xB6, 0x4D, 0x97, 0x2F, 0xDA, 0x0B, 0x16, 0xC5, 0x77, 0xF5, 0x94, 0x5F, 0x87, 0x36,
+    0x62, 0x25, 0xFC, 0x2A, 0xC0, 0xEB, 0xAC, 0x7B, 0x18, 0x07, 0x75, 0x31, 0xC4, 0xB1, 0xA6, 0xFD,
+    0x01, 0x5B, 0x98, 0x9D, 0x74, 0x6E, 0xF4, 0x00, 0x0F, 0xEC, 0x5A, 0xE8, 0x5E, 0xBB, 0x2A, 0x9E,
+    0xD3, 0x3B, 0xE7, 0xDA, 0xEF, 0xDD, 0xBA, 0xED, 0x33, 0xC1, 0xDF, 0xED, 0x2D, 0x2F, 0xA8, 0x52,
+    0x6E, 0x9D, 0x79, 0x60, 0xAB, 0x17, 0x0C, 0x09, 0xFD, 0x7E, 0xB2, 0xDA, 0x7A, 0xD8, 0x83, 0xFE,
+    0x1D, 0x40, 0xFF, 0x76, 0xD7, 0x42, 0xFF, 0x7C, 0x11, 0x4B, 0x66, 0x03, 0xDD, 0x7D, 0xF8, 0x23,
+    0xC8, 0x0E, 0x31, 0xA6, 0x27, 0xDB, 0x27, 0x2F, 0x07, 0xF9, 0x83, 0x0D, 0x50, 0x4A, 0x7B, 0x65,
+    0x93, 0x1F, 0xF3, 0xE7, 0x8B, 0x27, 0x14, 0xFD, 0x2B, 0xB0, 0x62, 0x8C, 0xDC, 0x5A, 0x93, 0xE8,
+    0x28, 0x9D, 0x2E, 0x1D, 0x7D, 0x68, 0x03, 0x64, 0x8C, 0x34, 0x66, 0xFB, 0x4D, 0xD9, 0x62, 0x34,
+    0x8D, 0xA6, 0x4A, 0x7B, 0xF7, 0x8C, 0xE9, 0xE1, 0x0F, 0x0E, 0x01, 0x90, 0x27, 0x4F, 0xE6, 0x1E,
+    0xCD, 0x3E, 0xCB, 0xF9, 0x57, 0x35, 0x3B, 0x9E, 0x6F, 0xDC, 0xBE, 0x7E, 0x4F, 0xA8, 0x30, 0x58,
+    0x40, 0x2D, 0xF9, 0x42, 0xD7, 0x90, 0x2E, 0xC4, 0x21, 0xE5, 0xB7, 0xF1, 0xD2, 0x6B, 0x4C, 0x90,
+    0x6E, 0xDB, 0x6E, 0x31, 0x05, 0xD1, 0xC2, 0xF6, 0xFA, 0x54, 0x9A, 0x42, 0x49, 0x62, 0x28, 0x95,
+    0x22, 0x18, 0x82, 0xA0, 0xDE, 0x18, 0x87, 0x99, 0x27, 0xE5, 0xC1, 0x2D, 0x59, 0x1D, 0x2A, 0xE7,
+    0x05, 0x5A, 0xE8, 0x52, 0xDE, 0x74, 0x13, 0xF5, 0x1D, 0x72, 0xC3, 0xA3, 0xF0, 0x1F, 0x71, 0x4E,
+    0xE4, 0x52, 0xEF, 0x1F, 0x47, 0x61, 0xDE, 0x9B, 0x3C, 0x25, 0xFA, 0x5C, 0x3C, 0xB8, 0xAC, 0xA6,
+    0x1B, 0x05, 0x5D, 0x77, 0x4C, 0xFC, 0xC5, 0x05, 0x1D, 0xCD, 0xE5, 0xAE, 0x7C, 0x4F, 0x76, 0x5E,
+    0x62, 0x0D, 0x87, 0xA7, 0x16, 0x0E, 0xA7, 0x1A, 0x08, 0x8F, 0xF0, 0x53, 0xC8, 0x0F, 0xF7, 0x20,
+    0xBF, 0x5B, 0xE4, 0xA1, 0x48, 0x67, 0x14, 0x15, 0xA7, 0xA6, 0x9B, 0xAB, 0xE4, 0x57, 0xED, 0x57,
+    0x8F, 0x9B, 0xFB, 0x68, 0x1E, 0x85, 0x8E, 0xE5, 0x5E, 0x6C, 0x32, 0xF8, 0xA7, 0xDF, 0x31, 0x93,
+    0x71, 0x98, 0x6C, 0x07, 0x0F, 0xF6, 0xA5, 0x8F, 0x10, 0x3E, 0x40, 0xF0, 0x85, 0xEC, 0xF1, 0xF4,
+    0x74, 0x78, 0x30, 0x42, 0x32, 0x48, 0x7C, 0x9C, 0x5D, 0xE9, 0x87, 0x5A, 0x5C, 0xF3, 0x8B, 0x16,
+    0xC9, 0xB3, 0x68, 0xA2, 0xB7, 0x23, 0xDA, 0x6F, 0x4B, 0xA3, 0xEE, 0x68, 0x16, 0x42, 0x85, 0x85,
+    0x4A, 0xB6, 0xCF, 0x58, 0xAE, 0x48, 0x14, 0x69, 0x8A, 0x9E, 0x48, 0xDF, 0xF8, 0x9F, 0x74, 0x27,
+    0x2B, 0xA1, 0x27, 0xD9, 0x04, 0x42, 0xA7, 0x55, 0xAC, 0x0D, 0x36, 0x64, 0xB2, 0x0A, 0x03, 0x93,
+    0x55, 0xF2, 0x35, 0xCA, 0x27, 0xA8, 0x7F, 0xCA, 0x27, 0xF9, 0x04, 0xC3, 0x83, 0x01, 0x1A, 0x6A,
+    0x33, 0x2E, 0x72, 0xF5, 0x54, 0xA5, 0xE1, 0xB5, 0x22, 0xC7, 0xB6, 0xB2, 0x4C, 0x7C, 0xE9, 0xB8,
+    0xA4, 0x88, 0x52, 0x00, 0x96, 0x0F, 0xE2, 0x19, 0xBA, 0xC9, 0xB7, 0xC5, 0xBE, 0xDE, 0xF0, 0x5B,
+    0x88, 0x39, 0x50, 0xA1, 0xE9, 0xED, 0x8E, 0x72, 0x7F, 0x6E, 0x8B, 0xAD, 0xF5, 0xAB, 0xFD, 0xCE,
+    0x27, 0x93, 0xEA, 0x2B, 0x7F, 0x39, 0x7D, 0x0E, 0x13, 0x96, 0x4C, 0x99, 0x7A, 0x5C, 0x63, 0xE8,
+    0x24, 0xDB, 0x32, 0x4F, 0xE4, 0xC0, 0x5C, 0xFB, 0x73, 0x2C, 0xAD, 0x72, 0x98, 0xC9, 0xF2, 0x3A,
+    0xE3, 0x61, 0x1B, 0xD4, 0x7C, 0x48, 0xA6, 0x62, 0xF4, 0x2A, 0xC9, 0x1D, 0x95, 0x60, 0x91, 0x49,
+    0xDE, 0x28, 0xA9, 0xB8, 0x03, 0xF1, 0xF2, 0xCB, 0xCA, 0xF4, 0xF5, 0x5C, 0x23, 0xD8, 0xE5, 0x66,
+    0x9D, 0x45, 0x5E, 0x05, 0xD3, 0x63, 0xDF, 0x97, 0x49, 0xCD, 0xED, 0x63, 0xAD, 0xA5, 0x0B, 0x46,
+    0xDC, 0x1A, 0x4D, 0x98, 0x45, 0x6A, 0xBE, 0x7A, 0x75, 0xBB, 0x6A, 0xA1, 0x53, 0x0C, 0x76, 0x16,
+    0xF8, 0x45, 0x0F, 0xBD, 0x26, 0xEC, 0xB2, 0x54, 0x0A, 0x6D, 0xA1, 0xF6, 0x4D, 0x06, 0x00, 0xF5,
+    0x60, 0x08, 0x58, 0x90, 0x1B, 0x5F, 0x6D, 0xC2, 0xBF, 0x7E, 0x8E, 0x0F, 0x54, 0x52, 0xCD, 0x4D,
+    0x8B, 0x94, 0x6C, 0x80, 0x91, 0x89, 0x48, 0x96, 0xD0, 0xAF, 0xFC, 0x08, 0xA7, 0xCE, 0x90, 0x99,
+    0xE9, 0x4F, 0xA2, 0xEA, 0xA5, 0x65, 0xE7, 0x8C, 0x68, 0x5A, 0xAB, 0xAC, 0x4B, 0x10, 0xC5, 0xF3,
+    0x94, 0xBC, 0xAC, 0x0B, 0x35, 0x13, 0xEC, 0xE3, 0x14, 0xBE, 0xD5, 0x1E, 0xBD, 0xC2, 0x89, 0x45,
+    0x9A, 0x56, 0xA8, 0xE9, 0xEA, 0x08, 0x6E, 0x66, 0xBB, 0x40, 0x8E, 0x80, 0x8E, 0xC0, 0xCE, 0xFD,
+    0x5B, 0xA1, 0x07, 0x2F, 0x77, 0x46, 0xE0, 0x47, 0x00, 0x08, 0xF7, 0xA3, 0x42, 0x1A, 0xD7, 0xED,
+    0x22, 0x20, 0x2A, 0x45, 0xC3, 0x68, 0x4E, 0xAC, 0x81, 0xBC, 0xA7, 0xA2, 0x3C, 0xA1, 0xF6, 0x26,
+    0x71, 0xF2, 0x33, 0x78, 0x27, 0xBD, 0x8F, 0xB5, 0xAB, 0x9B, 0x40, 0x52, 0xFD, 0x89, 0x59, 0xB3,
+    0x3B, 0x8C, 0xC2, 0xB6, 0x6D, 0xD4, 0x7A, 0x08, 0x44, 0x30, 0x04, 0xC2, 0xE8, 0x45, 0x5F, 0xE7,
+    0x35, 0xEA, 0x9C, 0xA5, 0xA7, 0x2D, 0x83, 0x76, 0x68, 0x0B, 0xA2, 0x36, 0x7B, 0x13, 0x68, 0xE0,
+    0x55, 0xF0, 0x5B, 0x6E, 0x6D, 0x94, 0x06, 0x6A, 0x61, 0x4B, 0xF9, 0xAA, 0xEA, 0xAC, 0xB8, 0x55,
+    0x9D, 0x75, 0xFA, 0xB5, 0xD1, 0x43, 0xCA, 0xB4, 0x4E, 0x74, 0xFF, 0x0F, 0xBB, 0x9E, 0xD3, 0x31,
+    0xE6, 0xE5, 0x64, 0xE7, 0xB8, 0xD5, 0x5D, 0xDB, 0x68, 0x49, 0x36, 0x47, 0x45, 0x3D, 0xB2, 0xAC,
+    0xDE, 0x92, 0x51, 0x63, 0x2D, 0xFD, 0x3A, 0xD4, 0xD4, 0x2B, 0x3D, 0x1F, 0xA8, 0xCE, 0xE3, 0xA9,
+    0xD2, 0xD8, 0x48, 0x53, 0x74, 0xF1, 0xD2, 0xA2, 0x0B, 0x43, 0x05, 0x6F, 0x65, 0xAE, 0xA8, 0x74,
+    0x53, 0x2C, 0x3A, 0xAB, 0x5A, 0xF9, 0x03, 0x3C, 0x50, 0x44, 0x96, 0xB8, 0x12, 0x2A, 0xD4, 0x86,
+    0xB9, 0x55, 0xA7, 0xBD, 0x71, 0x6B, 0xFB, 0x7D, 0x9E, 0x2A, 0xED, 0x9C, 0x78, 0x9E, 0xC3, 0x6C,
+    0xB2, 0x7D, 0x6B, 0xD1, 0x4E, 0xB8, 0x4B, 0x9D, 0xA4, 0xB6, 0x5B, 0x48, 0xF4, 0x34, 0x09, 0x10,
+    0x21, 0x2C, 0xAD, 0x20, 0x16, 0x6F, 0x4E, 0x18, 0xF7, 0xA6, 0x0A, 0x99, 0x63, 0x77, 0x50, 0xFE,
+    0xC4, 0x30, 0xD7, 0x64, 0x9C, 0xC9, 0x40, 0x93, 0x91, 0x26, 0x43, 0x4D, 0xC6, 0x9A, 0x0C, 0x36,
+    0x19, 0x6D, 0x32, 0xDC, 0x64, 0xBC, 0xC9, 0x80, 0x93, 0x11, 0x27, 0x43, 0xEE, 0xCC, 0x1D, 0xBA,
+    0x53, 0x77, 0xEC, 0xCE, 0xDD, 0xC1, 0x37, 0xE4, 0x1D, 0x7D, 0xC3, 0x7E, 0x05, 0x7F, 0xE7, 0x5E,
+    0x67, 0x77, 0x5B, 0x47, 0xE1, 0x59, 0x6B, 0x4F, 0x58, 0x72, 0x13, 0x57, 0x74, 0xE6, 0xB7, 0x26,
+    0x07, 0x33, 0x0E, 0x4A, 0xF9, 0x0B, 0xE5, 0x7C, 0x07, 0x66, 0xF8, 0x2B, 0xB5, 0xC3, 0x1C, 0xB9,
+    0x09, 0xED, 0x39, 0x99, 0x25, 0x36, 0x53, 0x6C, 0xB6, 0xD8, 0x8C, 0xB1, 0x59, 0x63, 0x33, 0xC7,
+    0x66, 0x8F, 0xCD, 0x20, 0xA3, 0xA9, 0xC8, 0x4C, 0xB2, 0xD9, 0x64, 0x33, 0xCA, 0x66, 0x95, 0xDD,
+    0x2C, 0x9B, 0x5D, 0x5E, 0xCD, 0x86, 0xF7, 0x47, 0xDD, 0x6D, 0x07, 0xAF, 0x55, 0x68, 0xC2, 0x52,
+    0x2F, 0xD2, 0xB8, 0x4E, 0x8E, 0x7C, 0x93, 0x88, 0x3F, 0xE8, 0xA8, 0x76, 0x5E, 0xB4, 0x4B, 0x0F,
+    0xED, 0x69, 0x9E, 0x68, 0x4A, 0x57, 0x5E, 0x32, 0x07, 0xA7, 0x98, 0xB8, 0x45, 0xA3, 0x1E, 0x8E,
+    0x36, 0xF1, 0xE8, 0x4A, 0xB9, 0xAD, 0x5F, 0x96, 0x51, 0xB3, 0x98, 0xB4, 0x29, 0xA5, 0xE7, 0xA8,
+    0x74, 0x93, 0x66, 0x40, 0xF4, 0x90, 0x56, 0x4F, 0x32, 0x69, 0xDC, 0xEA, 0x91, 0x6B, 0x13, 0xBC,
+    0x23, 0x0D, 0xE4, 0x8F, 0x09, 0xF5, 0xD5, 0x02, 0x70, 0xB3, 0x1E, 0xF3, 0xE1, 0x1D, 0xDF, 0xBB,
+    0x40, 0x91, 0x38, 0xF5, 0x83, 0x3A, 0xDB, 0x83, 0x0F, 0xB1, 0xB1, 0xBD, 0xDA, 0xD9, 0x66, 0x9B,
+    0xB6, 0x49, 0xDC, 0xDF, 0xB1, 0xAC, 0x71, 0xF9, 0x01, 0x3E, 0xAD, 0x3F, 0x03, 0xFD, 0x20, 0x72,
+    0x7D, 0x40, 0xA1, 0xBC, 0xA2, 0xB6, 0x70, 0x3D, 0x10, 0xD3, 0x86, 0x2D, 0xD3, 0xF6, 0x72, 0xA7,
+    0x66, 0x68, 0x6B, 0xDC, 0xD8, 0xDB, 0xA2, 0xFB, 0x39, 0xBF, 0xD6, 0xCA, 0x82, 0xB7, 0x5D, 0x30,
+    0x73, 0xD4, 0xF2, 0x49, 0xFB, 0x9D, 0x56, 0xDB, 0xE6, 0x2C, 0x7B, 0x16, 0x66, 0xDA, 0x20, 0x41,
+    0x2C, 0x17, 0x0F, 0xBA, 0xF9, 0xB1, 0x44, 0x19, 0x2E, 0x52, 0xE1, 0x53, 0xE4, 0xC1, 0x23, 0xED,
+    0x00, 0xCF, 0x03, 0x11, 0x99, 0xA7, 0x8B, 0x64, 0xC3, 0x79, 0x36, 0x88, 0xC8, 0x6C, 0xCB, 0x24,
+    0x2D, 0xCE, 0xBE, 0x8D, 0x48, 0x3E, 0x50, 0xC9, 0x93, 0x02, 0x79, 0xF1, 0x04, 0xE1, 0x9F, 0xEC,
+    0x0B, 0x09, 0xA4, 0x54, 0x9B, 0x7D, 0x75, 0x8E, 0x0E, 0xD4, 0x81, 0xBC, 0xAE, 0xCD, 0x1D, 0x6D,
+    0x66, 0x58, 0x47, 0x23, 0x73, 0xBA, 0x05, 0x72, 0x8D, 0xC7, 0xB3, 0x62, 0x2B, 0x98, 0x18, 0x2B,
+    0xD5, 0xE8, 0x66, 0x27, 0x2F, 0x3E, 0x6A, 0x3B, 0x5E, 0xD9, 0xB4, 0xFD, 0x6E, 0xB0, 0x4A, 0x93,
+    0x8E, 0x17, 0x2C, 0xFD, 0xD1, 0x5C, 0xFC, 0x67, 0x3E, 0x4C, 0x11, 0xDC, 0x4A, 0x65, 0x5D, 0x15,
+    0xCB, 0x36, 0x02, 0xF7, 0x21, 0x9D, 0xF0, 0x21, 0x2B, 0x59, 0x7E, 0x3E, 0xF0, 0xDC, 0x1C, 0x49,
+    0x89, 0x9D, 0x38, 0xCC, 0x63, 0x11, 0x98, 0xE3, 0x04, 0x29, 0xA8, 0xCB, 0x0B, 0x0E, 0x6D, 0x86,
+    0xF4, 0x16, 0x1F, 0x8A, 0x6B, 0x1C, 0x34, 0xFC, 0x65, 0x1A, 0xCE, 0xE5, 0xA1, 0x1C, 0x2F, 0x39,
+    0x2A, 0x65, 0x85, 0x38, 0x6C, 0xEA, 0xE9, 0x70, 0x67, 0x8C, 0x39, 0xC6, 0x3F, 0x9B, 0xAC, 0x2A,
+    0x9D, 0x33, 0x5D, 0x0C, 0x6C, 0x6A, 0x56, 0xB9, 0x39, 0x10, 0xDA, 0x3C, 0x55, 0xF1, 0xF5, 0x94,
+    0x4C, 0xBF, 0x70, 0x55, 0x3F, 0x7A, 0x6F, 0xD5, 0xE7, 0xB3, 0xC1, 0x6F, 0xFB, 0x3E, 0xBA, 0xC2,
+    0x5F, 0x3C, 0x90, 0x7A, 0x95, 0xDD, 0x66, 0xB7, 0x0A, 0x9B, 0xC7, 0x83, 0x66, 0xC8, 0x06, 0x9D,
+    0xA4, 0xC7, 0xEB, 0xE4, 0xF8, 0xE9, 0xA8, 0xE3, 0xE4, 0x79, 0x21, 0x8F, 0x3F, 0x77, 0x62, 0x4F,
+    0x26, 0xF8, 0xA3, 0xA1, 0xB2, 0x57, 0x9A, 0x16, 0x5E, 0xA3, 0x03, 0x38, 0x73, 0x8E, 0x3D, 0xD1,
+    0xA6, 0x25, 0x28, 0xCD, 0x13, 0x5D, 0xFB, 0x1F, 0x5B, 0x95, 0x6A, 0xFD, 0x44, 0x41, 0xF1, 0xC0,
+    0x80, 0x54, 0xAD, 0x86, 0x4E, 0x4C, 0xB2, 0xB1, 0x72, 0x58, 0x4E, 0xCB, 0x71, 0x39, 0x2F, 0x07,
+    0xE6, 0xC4, 0x1C, 0x99, 0x33, 0x73, 0x68, 0x4E, 0xCD, 0xB1, 0x39, 0x37, 0x07, 0xE7, 0xE4, 0x1C,
+    0x9D, 0xB3, 0x6B, 0xE0, 0x39, 0xBD, 0x96, 0xFA, 0x5D, 0x3A, 0x69, 0xD5, 0x8C, 0xEA, 0x56, 0x9A,
+    0x3F, 0x6C, 0x64, 0x5E, 0x10, 0x0B, 0x74, 0x5E, 0x83, 0x41, 0x8B, 0x88, 0x86, 0xBE, 0x7F, 0x0B,
+    0x8E, 0xE9, 0x08, 0x24, 0x33, 0x02, 0xCB, 0x3B, 0x48, 0x39, 0x7D, 0x57, 0xA1, 0xE2, 0xF5, 0x39,
+    0x86, 0x59, 0x9E, 0xA6, 0x07, 0x53, 0x34, 0xE8, 0x5A, 0xA5, 0xCD, 0x04, 0x57, 0x04, 0x5B, 0xF4,
+    0x79, 0xAC, 0x5D, 0x0C, 0xE8, 0x49, 0x4F, 0x1B, 0xA4, 0x21, 0x40, 0x99, 0x94, 0x33, 0x29, 0x69,
+    0x94, 0x56, 0x8B, 0xE9, 0x54, 0xDA, 0xD4, 0xF0, 0xF6, 0x18, 0x37, 0x36, 0xC7, 0xB6, 0x79, 0x72,
+    0xEA, 0x29, 0x75, 0x1E, 0x49, 0xC1, 0x40, 0x5B, 0xEE, 0x6A, 0x83, 0x88, 0xDB, 0xE3, 0x75, 0x5E,
+    0xDF, 0xF6, 0xAC, 0x63, 0xB9, 0x4C, 0x19, 0x58, 0xE0, 0xF3, 0x5A, 0xE2, 0xBC, 0x16, 0xC4, 0xDD,
+    0x1A, 0xBB, 0x39, 0x6E, 0xEC, 0xB1, 0x77, 0xCB, 0xD1, 0x9B, 0x49, 0x76, 0x9B, 0xEC, 0x46, 0x59,
+    0xAC, 0xF2, 0x26, 0xE9, 0xFC, 0xF6, 0x7D, 0x5B, 0x80, 0xD0, 0xE7, 0x03, 0xAD, 0x3E, 0xDE, 0xB5,
+    0xB0, 0x37, 0x1D, 0xB5, 0x4B, 0x7F, 0x1A, 0x87, 0xE3, 0xBC, 0xDA, 0xF0, 0xF5, 0x98, 0x0F, 0xB7,
+    0x7C, 0xB7, 0xBD, 0xB8, 0xAD, 0x4F, 0x48, 0x7E, 0x05, 0x63, 0x7F, 0xDD, 0x62, 0xE2, 0xDB, 0x3D,
+    0xAF, 0x26, 0xD9, 0xDD, 0x28, 0xEE, 0xB7, 0xAC, 0x5C, 0x67, 0x74, 0x0D, 0x11, 0x6F, 0x2D, 0xF5,
+    0x26, 0xA8, 0xFC, 0x25, 0xD4, 0xFE, 0x9E, 0xD7, 0x98, 0x67, 0x3D, 0x10, 0xD3, 0x86, 0x2D, 0xD3,
+    0xDD, 0x30, 0x2F, 0x9E, 0xB5, 0xCA, 0xD2, 0x48, 0x05, 0x6E, 0x7F, 0x2E, 0xAF, 0xF3, 0xD4, 0xCE,
+    0x62, 0x9E, 0x7E, 0x9C, 0x2B, 0xDF, 0xBA, 0x6C, 0xC7, 0x3C, 0xE6, 0x98, 0xD8, 0x67, 0x9E, 0xD0,
+    0xB4, 0x73, 0xAC, 0xAE, 0xCC, 0x53, 0x5B, 0xB3, 0x4E, 0x2E, 0x73, 0xAB, 0xB5, 0xFB, 0x12, 0xE6,
+    0x51, 0x08, 0xA3, 0x5C, 0x1B, 0x79, 0xD0, 0x82, 0x47, 0x4C, 0x22, 0x5E, 0x31, 0x70, 0x41, 0xD7,
+    0x3D, 0xB6, 0x09, 0x99, 0x46, 0x93, 0x77, 0xF4, 0xB6, 0xB5, 0x6E, 0x50, 0x00, 0x50, 0x85, 0x7D,
+    0x8F, 0x64, 0x9A, 0x6A, 0xAD, 0xF7, 0x81, 0x3A, 0x18, 0xB8, 0x5F, 0xFF, 0xDB, 0xCA, 0x52, 0x09,
+    0x6D, 0x37, 0xB3, 0x5B, 0x36, 0xD7, 0xAD, 0x97, 0xB3, 0x66, 0xD6, 0x76, 0x53, 0xAC, 0x6C, 0x4E,
+    0x57, 0xA8, 0x9D, 0xB0, 0x3C, 0xD6, 0xC2, 0xAE, 0x49, 0xA7, 0xD7, 0xD6, 0x5D, 0x73, 0x5D, 0x3D,
+    0x73, 0xF7, 0xA4, 0xB3, 0x98, 0x6D, 0x75, 0x67, 0xCC, 0x39, 0x51, 0x78, 0xD4, 0x56, 0x45, 0x63,
+    0x0D, 0xD6, 0x39, 0xAC, 0x92, 0xD8, 0x5D, 0x1E, 0x47, 0xAA, 0x70, 0x5F, 0x6C, 0xFF, 0xD7, 0x68,
+    0x58, 0xA6, 0x44, 0xE3, 0x74, 0x19, 0x11, 0x96, 0x1E, 0x3A, 0xB6, 0x54, 0x97, 0x29, 0xA8, 0x8F,
+    0x3C, 0xD6, 0x1B, 0x0E, 0x0B, 0xDC, 0x3E, 0xBF, 0x0B, 0x99, 0xB2, 0xBF, 0xA2, 0xF7, 0xE9, 0xDF,
+    0x21, 0x68, 0xF2, 0x5F, 0x5A, 0xFD, 0xCD, 0x01, 0x9F, 0xA4, 0x06, 0xC9, 0xD2, 0xAA, 0xBA, 0xCC,
+    0xF8, 0x02, 0x3D, 0x6F, 0x0F, 0x05, 0xE2, 0xAC, 0x8B, 0xDB, 0xB0, 0xD1, 0xB9, 0x66, 0xA9, 0x32,
+    0x4D, 0x6A, 0xAE, 0x3B, 0xC6, 0xF6, 0xEB, 0x72, 0x27, 0x79, 0x61, 0xEA, 0x69, 0xEF, 0xF6, 0xD7,
+    0x88, 0x1F, 0x2A, 0x2D, 0xE7, 0xA8, 0xB7, 0xE3, 0x70, 0x6E, 0xE1, 0x9B, 0x7A, 0xE0, 0xF7, 0xE8,
+    0x05, 0x7E, 0x4D, 0x92, 0xA6, 0x1F, 0xF4, 0xD9, 0xFF, 0x9F, 0xCE, 0xDA, 0x8A, 0xDB, 0xD3, 0x3B,
+    0xE8, 0x1F, 0x2C, 0x71, 0x65, 0x36, 0xD5, 0x3E, 0x39, 0x3B, 0xCA, 0x4C, 0x97, 0x74, 0x47, 0x3C,
+    0xD8, 0x9F, 0x87, 0x51, 0xE7, 0xB4, 0x38, 0x68, 0x6B, 0xF3, 0x9E, 0x5E, 0xE8, 0x46, 0xD1, 0x36,
+    0x68, 0xD7, 0xCE, 0xB0, 0x6A, 0xFB, 0x1F, 0x88, 0xE0, 0xF5, 0xBB, 0xA7, 0x8F, 0x5A, 0x7E, 0x24,
+    0x4D, 0x85, 0x07, 0xC6, 0x7A, 0x65, 0x32, 0x7F, 0xF1, 0x61, 0xD4, 0x75, 0x9F, 0x05, 0x4D, 0x77,
+    0x23, 0x14, 0xB3, 0x86, 0x5F, 0xC9, 0xBD, 0xA6, 0x43, 0x19, 0x9A, 0xA8, 0x1C, 0xBC, 0xEA, 0xD9,
+    0xDB, 0xB3, 0x05, 0xFC, 0x7F, 0xBD, 0x59, 0x4D, 0x8C, 0xDE, 0x46, 0x19, 0x7E, 0x6D, 0x67, 0x63,
+    0x5A, 0x4B, 0x75, 0x0E, 0x09, 0x6A, 0x5A, 0x88, 0x2F, 0x45, 0xA2, 0x51, 0x77, 0x7D, 0xE9, 0xA1,
+    0x12, 0x9B, 0xB5, 0xAB, 0x1C, 0x7A, 0x40, 0xA2, 0x3D, 0x64, 0x39, 0x50, 0x89, 0xF4, 0x50, 0x0E,
+    0x44, 0x42, 0xE9, 0x21, 0x95, 0x22, 0xB4, 0x89, 0x5D, 0x90, 0xB8, 0x12, 0x01, 0x52, 0x4F, 0x48,
+    0x39, 0x14, 0x29, 0x5D, 0x24, 0xD2, 0x43, 0x0E, 0x39, 0x6C, 0xE2, 0x09, 0x3D, 0x70, 0xFD, 0x7A,
+    0xE9, 0xB5, 0x2E, 0x2D, 0x17, 0x7A, 0x88, 0x29, 0x46, 0x72, 0x12, 0x7F, 0x1E, 0x9E, 0xE7, 0x1D,
+    0x7F, 0x3F, 0xFB, 0x65, 0x4B, 0x91, 0x58, 0xE1, 0xF5, 0x8C, 0xE7, 0xB3, 0x67, 0xDE, 0x79, 0xFF,
+    0x7F, 0x66, 0x5F, 0x6B, 0xFE, 0xC3, 0x75, 0xDC, 0xCB, 0xD7, 0xC3, 0x32, 0xFA, 0xB1, 0xF8, 0x9D,
+    0x78, 0xAD, 0x84, 0x53, 0x39, 0xF5, 0x28, 0x7F, 0xE9, 0x4B, 0x23, 0x8D, 0x1C, 0xC2, 0xFD, 0x9A,
+    0xC8, 0x2D, 0x91, 0x75, 0xB9, 0x70, 0x33, 0xB7, 0xB6, 0x6C, 0x4E, 0x49, 0x73, 0x59, 0x9A, 0xEB,
+    0x87, 0x00, 0xF8, 0xBA, 0x88, 0x97, 0x4B, 0x58, 0xCA, 0x29, 0x91, 0xAB, 0xBB, 0x79, 0x65, 0xCD,
+    0x7A, 0x60, 0xA2, 0xB3, 0xC6, 0xFF, 0xA5, 0x91, 0xE0, 0x7F, 0xBF, 0xCB, 0xD3, 0xBB, 0x37, 0x32,
+    0xDB, 0x15, 0xB6, 0x15, 0x91, 0xE5, 0x71, 0x66, 0x2D, 0x87, 0xE8, 0x4E, 0x6C, 0x6F, 0x6F, 0x83,
+    0xBC, 0xD9, 0xC5, 0x0F, 0x7A, 0xF5, 0xC5, 0x6C, 0xD4, 0x2D, 0xBE, 0x3E, 0xE7, 0x5D, 0xDB, 0xF1,
+    0xEB, 0xFF, 0xE7, 0xAD, 0xDB, 0x26, 0xC0, 0x62, 0x92, 0xA2, 0x33, 0x0B, 0x54, 0x4E, 0xEF, 0xEE,
+    0xEE, 0xE6, 0xC4, 0x31, 0xBF, 0x80, 0x91, 0xC8, 0x9A, 0xDC, 0x0D, 0xEA, 0x38, 0x4F, 0x24, 0x93,
+    0xCC, 0x64, 0x4D, 0xD6, 0x24, 0x8D, 0x97, 0x7B, 0x9F, 0x87, 0xD3, 0x70, 0x08, 0x06, 0x19, 0xE4,
+    0x8C, 0x6C, 0x4A, 0x1B, 0x4D, 0xB6, 0xE4, 0x98, 0xF8, 0x75, 0xDC, 0xA6, 0x2D, 0xE6, 0x94, 0x7C,
+    0xB9, 0x2E, 0x71, 0x1E, 0x34, 0xF2, 0x86, 0xF7, 0xB9, 0x5F, 0x87, 0xD3, 0xB8, 0x0B, 0x87, 0xB8,
+    0x0F, 0x86, 0xA8, 0x97, 0xC1, 0xEF, 0xB1, 0x6A, 0x0F, 0x53, 0x6E, 0x49, 0xEB, 0x35, 0xD1, 0xE4,
+    0x59, 0xB3, 0x25, 0x57, 0xB0, 0x5E, 0x00, 0xE1, 0xE8, 0x35, 0xC0, 0x68, 0x14, 0x4A, 0x53, 0xD5,
+    0x59, 0x59, 0xE5, 0x6E, 0xEA, 0x6D, 0xC0, 0xDB, 0x04, 0xC4, 0x0D, 0x09, 0xB0, 0x42, 0xDE, 0x90,
+    0x12, 0xA8, 0x62, 0x45, 0x81, 0x76, 0x17, 0x6D, 0x0F, 0xAD, 0x47, 0x23, 0x53, 0x1B, 0x6D, 0x47,
+    0xA4, 0x5E, 0x4B, 0x07, 0x3B, 0x64, 0xF6, 0xFE, 0xF4, 0x3B, 0x81, 0x79, 0x5A, 0xB0, 0x4C, 0x62,
+    0xB4, 0x14, 0x2D, 0x63, 0x03, 0xD5, 0x19, 0xC0, 0x64, 0xE2, 0xDA, 0x55, 0xB4, 0x2B, 0x23, 0xA8,
+    0xDB, 0x68, 0xED, 0x1C, 0x94, 0x78, 0xE0, 0x97, 0x87, 0x25, 0x3E, 0x96, 0x04, 0x6C, 0x58, 0x16,
+    0xE4, 0x73, 0x9E, 0xDD, 0x40, 0xF3, 0xB8, 0xBB, 0xCF, 0x35, 0x7E, 0xA3, 0x94, 0xA0, 0x0B, 0xB0,
+    0xE4, 0x58, 0x60, 0x8E, 0x48, 0xF6, 0xC5, 0x17, 0xBD, 0x14, 0x14, 0xF9, 0x4F, 0xA2, 0x97, 0xDF,
+    0x04, 0x1A, 0x58, 0x2F, 0x29, 0x3B, 0x22, 0x21, 0x19, 0x41, 0xAD, 0x13, 0xD2, 0x0B, 0xEC, 0xBE,
+    0xCB, 0xEE, 0x45, 0x76, 0x97, 0x64, 0x24, 0x29, 0xE8, 0xE7, 0x1D, 0xB7, 0x08, 0x00, 0x3D, 0xFB,
+    0xCD, 0xC7, 0x77, 0xA8, 0x56, 0xBD, 0x6C, 0xBD, 0xFB, 0x2B, 0xE0, 0x1C, 0x12, 0x5C, 0xC4, 0x2E,
+    0x26, 0xB8, 0x24, 0x9F, 0x01, 0xCE, 0x66, 0x88, 0xFA, 0x0F, 0x24, 0xB5, 0x65, 0x61, 0x27, 0x95,
+    0x6D, 0xEC, 0xEC, 0xC6, 0xB8, 0xB0, 0x75, 0x66, 0x4D, 0x34, 0xCC, 0xC8, 0x79, 0x71, 0x5C, 0x94,
+    0xB5, 0xD4, 0xDB, 0x1C, 0xAD, 0xE5, 0x46, 0x68, 0x1D, 0x5A, 0x29, 0x59, 0xE7, 0x18, 0xF7, 0xD2,
+    0x38, 0x3F, 0x95, 0xCA, 0x58, 0x03, 0xC8, 0x3A, 0x96, 0xAE, 0x32, 0xC1, 0xD4, 0x9A, 0x60, 0xB0,
+    0x65, 0x30, 0x2D, 0xC4, 0x27, 0xD6, 0x12, 0xE5, 0x99, 0x29, 0x4C, 0x65, 0xB2, 0xFC, 0x88, 0x5C,
+    0xD8, 0x2D, 0xA1, 0x72, 0x87, 0xE2, 0x40, 0xDC, 0xFD, 0x81, 0x08, 0x94, 0x96, 0x6A, 0x1C, 0x1C,
+    0xE2, 0x4D, 0x4E, 0x1D, 0x78, 0x1F, 0x0A, 0xD2, 0x80, 0xF3, 0xF3, 0xDD, 0xF2, 0x2D, 0x91, 0xF9,
+    0xFD, 0xF6, 0x76, 0x7E, 0x88, 0xC0, 0x4F, 0xEF, 0x42, 0xF9, 0x16, 0xF7, 0x89, 0xED, 0x43, 0xC3,
+    0x7C, 0xDF, 0x95, 0x74, 0x4E, 0xCD, 0x79, 0x0D, 0x50, 0x80, 0xD8, 0xB9, 0x92, 0xA0, 0x81, 0x8A,
+    0xA7, 0xEE, 0x75, 0x34, 0xC1, 0xCB, 0x33, 0x6E, 0x1C, 0x1B, 0x58, 0xE0, 0xE8, 0xF8, 0xD2, 0x3C,
+    0x9E, 0xF8, 0x23, 0xB8, 0x0C, 0x96, 0x19, 0x4E, 0xE6, 0x63, 0xA3, 0x06, 0xA2, 0x36, 0x19, 0x9B,
+    0x11, 0x0C, 0xC6, 0x89, 0xB9, 0x32, 0x8E, 0xEF, 0x60, 0x75, 0xC7, 0xF0, 0xE1, 0xD1, 0x66, 0xB3,
+    0xA0, 0x49, 0xA0, 0xBD, 0x55, 0x8B, 0x39, 0x77, 0x22, 0x73, 0xF5, 0xBC, 0x09, 0x5A, 0xD8, 0x86,
+    0xF4, 0xC9, 0xCB, 0x1D, 0x77, 0xCF, 0x24, 0x7D, 0xA5, 0xD9, 0x0A, 0x9A, 0xB0, 0x4E, 0xF3, 0x4C,
+    0x22, 0x5B, 0xEE, 0x45, 0x93, 0xA0, 0xC1, 0xDB, 0x5C, 0xCE, 0x79, 0x6D, 0x6C, 0x82, 0xE6, 0x2A,
+    0xC7, 0x30, 0xAB, 0xA4, 0x0C, 0x9B, 0x5E, 0xC7, 0x91, 0x49, 0xF3, 0xB0, 0xEE, 0xD5, 0x10, 0x12,
+    0xAE, 0xFA, 0xB4, 0x57, 0x2F, 0xB1, 0x45, 0xFC, 0x3E, 0xEA, 0xD4, 0xF1, 0xF0, 0x4D, 0x7C, 0xAF,
+    0x03, 0x36, 0x34, 0x7A, 0xC0, 0x7B, 0xA7, 0xA3, 0x13, 0x02, 0x21, 0x29, 0x7E, 0x75, 0x5E, 0xA7,
+    0xFC, 0x48, 0xF2, 0x3B, 0xD2, 0xC3, 0x13, 0x92, 0x1F, 0xF1, 0xC7, 0xC0, 0xF1, 0xBC, 0x51, 0x47,
+    0xE3, 0x43, 0x5F, 0x93, 0x99, 0xD1, 0x1D, 0x47, 0xCB, 0xE5, 0xB1, 0x6B, 0x99, 0xBD, 0xFB, 0x39,
+    0xBC, 0xC2, 0xE4, 0x15, 0x3E, 0xAF, 0xB0, 0x7A, 0x85, 0xDB, 0x2B, 0x0C, 0x5F, 0xE1, 0xF9, 0x0A,
+    0xDB, 0x57, 0x38, 0xBF, 0xC2, 0x7C, 0x20, 0xBE, 0xCC, 0xFF, 0xC0, 0x9A, 0x65, 0x11, 0x24, 0xEF,
+    0x36, 0xCB, 0x52, 0xB8, 0xEA, 0xB5, 0xCB, 0x82, 0xE8, 0xA5, 0x5F, 0x92, 0xC5, 0xCB, 0x2D, 0x5E,
+    0x2C, 0xC4, 0x71, 0xB6, 0x21, 0x2B, 0xE7, 0x12, 0x71, 0x3F, 0xE7, 0x42, 0xF9, 0x7E, 0x4D, 0x7F,
+    0x3B, 0x97, 0x4B, 0x34, 0x41, 0x7A, 0xB2, 0x10, 0x0D, 0x40, 0xB4, 0x4B, 0xD2, 0x21, 0xC4, 0x25,
+    0x01, 0xC5, 0x26, 0xAC, 0x97, 0x64, 0x14, 0x19, 0xB0, 0x6D, 0x21, 0xA6, 0x70, 0x02, 0xE9, 0x2F,
+    0x24, 0x15, 0xFC, 0xEB, 0xCE, 0x3E, 0x61, 0x55, 0xED, 0x3E, 0x79, 0xAD, 0xE1, 0x4B, 0x1F, 0x74,
+    0x61, 0x13, 0xD5, 0x64, 0x60, 0xA2, 0x51, 0x8A, 0xEF, 0xA2, 0x26, 0xE8, 0xE2, 0x3A, 0x6C, 0x12,
+    0x13, 0xD5, 0x69, 0x49, 0xE2, 0xE3, 0x72, 0x4B, 0x12, 0xD9, 0xC1, 0x8C, 0xDB, 0x98, 0xE3, 0x24,
+    0xC1, 0x79, 0xA9, 0xE1, 0xCC, 0xAC, 0xE4, 0x5C, 0x90, 0x83, 0xD9, 0xE4, 0x7E, 0x86, 0x30, 0xC4,
+    0x15, 0x1D, 0xD7, 0x78, 0x0D, 0x57, 0x21, 0xA4, 0x60, 0x5D, 0x30, 0x13, 0x7F, 0x5A, 0xA6, 0x26,
+    0x01, 0xEE, 0x11, 0xE4, 0x18, 0x4C, 0xFC, 0x9A, 0x31, 0x2A, 0x2D, 0x2B, 0x49, 0x4D, 0x05, 0x71,
+    0x15, 0x0A, 0x23, 0x02, 0x31, 0xE1, 0x04, 0x71, 0x18, 0xCD, 0xAF, 0xA3, 0xD2, 0xAB, 0x83, 0xD2,
+    0xAD, 0xAD, 0xFC, 0x1E, 0x13, 0xFD, 0x9E, 0x33, 0x7B, 0x4E, 0x9D, 0x72, 0xEE, 0x1D, 0x4E, 0x3E,
+    0xC3, 0xD9, 0x5B, 0x9C, 0xBE, 0xC1, 0xF9, 0x4F, 0xB9, 0xED, 0x9E, 0x16, 0xEA, 0x16, 0xF4, 0xCF,
+    0xE6, 0xDE, 0x23, 0x13, 0x7C, 0x36, 0x09, 0xFF, 0xDC, 0x44, 0x65, 0x13, 0xCB, 0xED, 0x0D, 0xD9,
+    0xDC, 0x94, 0x0D, 0xB2, 0x23, 0x20, 0x17, 0xA1, 0x2D, 0x90, 0x4D, 0xD4, 0x30, 0xCE, 0x16, 0xA5,
+    0x54, 0x39, 0x63, 0x45, 0x62, 0x18, 0x7E, 0x11, 0xB6, 0x40, 0x0A, 0x53, 0x3E, 0x17, 0x5E, 0x77,
+    0x28, 0x33, 0x5A, 0x1B, 0x3E, 0xC7, 0x35, 0xD7, 0xC4, 0x0D, 0x23, 0xE2, 0x5D, 0x81, 0xE9, 0x60,
+    0x32, 0x02, 0x99, 0x46, 0x45, 0x5D, 0xF1, 0x0D, 0xF1, 0xA7, 0x22, 0x65, 0x26, 0xC1, 0x94, 0x6A,
+    0x61, 0xF0, 0x0B, 0x92, 0x6C, 0xF0, 0x2D, 0x73, 0xC1, 0xB7, 0x57, 0xF4, 0x68, 0x68, 0x49, 0xA9,
+    0x56, 0x02, 0x31, 0xD3, 0x62, 0x3D, 0x35, 0x4A, 0x68, 0x31, 0x3F, 0x9D, 0x94, 0xE4, 0xD7, 0xC6,
+    0xBF, 0x56, 0xE4, 0xA1, 0xC5, 0x7E, 0x55, 0x89, 0x95, 0x71, 0x5B, 0xE5, 0x81, 0xC5, 0x63, 0x43,
+    0xE2, 0x4F, 0x8C, 0x86, 0xD6, 0x50, 0xC5, 0xD3, 0x2B, 0x58, 0xAC, 0x2A, 0xC4, 0x19, 0xB2, 0xD1,
+    0x44, 0x81, 0x1F, 0x7B, 0x0D, 0xF8, 0xF8, 0xF4, 0xA6, 0x90, 0xD3, 0x88, 0x71, 0x14, 0x1E, 0x30,
+    0x0B, 0xEB, 0x6F, 0x11, 0x4F, 0xCF, 0x8C, 0x81, 0x5B, 0x92, 0x3A, 0x26, 0x2B, 0x94, 0xB0, 0xA4,
+    0x66, 0x37, 0x01, 0x43, 0x52, 0x23, 0x05, 0x22, 0x22, 0x16, 0x83, 0x39, 0x15, 0x9D, 0xCC, 0x40,
+    0xD0, 0x53, 0x6E, 0xD5, 0x33, 0xA1, 0xE9, 0x61, 0x65, 0x1E, 0x2D, 0x02, 0x7A, 0xDB, 0xB1, 0x83,
+    0x6D, 0xD5, 0x60, 0x5E, 0x30, 0x61, 0x67, 0xA0, 0x0B, 0xA1, 0x81, 0x63, 0x40, 0x2A, 0xB6, 0xEC,
+    0x35, 0x92, 0x1C, 0x09, 0x40, 0x61, 0x90, 0xDD, 0x20, 0xD2, 0xD6, 0xEC, 0x26, 0xDC, 0xA7, 0x44,
+    0x32, 0x74, 0x64, 0x9C, 0x52, 0x58, 0x90, 0x5E, 0x35, 0x49, 0x1D, 0x76, 0x19, 0xF0, 0xC6, 0xCE,
+    0x53, 0x6C, 0x3C, 0x9C, 0x4A, 0xCD, 0x20, 0xE9, 0xBD, 0xA9, 0x64, 0xBF, 0x80, 0xDD, 0x9C, 0x45,
+    0xA0, 0x07, 0xC6, 0x57, 0x89, 0xE1, 0xA8, 0xF4, 0x43, 0xEE, 0x08, 0x6A, 0x17, 0x19, 0x91, 0x2C,
+    0xE5, 0xB7, 0x21, 0x08, 0x4E, 0xF0, 0x3E, 0x63, 0xC3, 0x37, 0xF2, 0xCA, 0x1B, 0xD3, 0xC9, 0x1B,
+    0x9A, 0x15, 0x73, 0x74, 0x7D, 0x36, 0xDD, 0xA5, 0x0E, 0x61, 0xEE, 0xC4, 0xBB, 0xEE, 0x12, 0x22,
+    0xD0, 0x1B, 0x3C, 0xC0, 0xF3, 0x22, 0xFC, 0x52, 0xF5, 0x70, 0xB7, 0xA2, 0x6F, 0x8C, 0xB0, 0x54,
+    0x93, 0xD5, 0x67, 0x76, 0x7F, 0xE7, 0x96, 0xBA, 0xAC, 0xDA, 0xAB, 0xAC, 0xFD, 0x7C, 0x4C, 0x61,
+    0x91, 0xA2, 0x88, 0xBD, 0x86, 0x75, 0x35, 0x45, 0xAE, 0x02, 0x4F, 0x74, 0xEA, 0xC6, 0xB8, 0x4F,
+    0xA4, 0xC9, 0xA5, 0x43, 0x88, 0x15, 0x81, 0x38, 0x37, 0xB9, 0x37, 0xAA, 0xA1, 0xCB, 0xD8, 0xD4,
+    0xCD, 0x46, 0x66, 0x96, 0x3F, 0xA5, 0x5F, 0x35, 0x8D, 0x5D, 0x44, 0x4E, 0xC4, 0xD4, 0x8E, 0x74,
+    0x8B, 0xD3, 0xB8, 0xDD, 0x1E, 0x69, 0x68, 0xC1, 0x07, 0xBF, 0x81, 0x0E, 0xA9, 0x9C, 0x00, 0xAD,
+    0x23, 0xB4, 0x1D, 0x42, 0xDB, 0x22, 0xB4, 0x84, 0xD0, 0x9C, 0xA3, 0x7D, 0x6E, 0xE1, 0x7B, 0x9D,
+    0x37, 0x2F, 0x47, 0xDF, 0x1D, 0xD5, 0x3B, 0xE3, 0xA0, 0xBB, 0xEC, 0xB9, 0xD1, 0xDD, 0x4B, 0x17,
+    0x9D, 0x98, 0xE3, 0x47, 0x56, 0x17, 0x7B, 0xAF, 0xDB, 0xBF, 0xE7, 0xAE, 0xAE, 0x98, 0x8E, 0xEE,
+    0xE0, 0x6F, 0xF7, 0x9D, 0x3B, 0x3F, 0xE9, 0x7F, 0x38, 0xBE, 0x0A, 0x8C, 0x9D, 0x09, 0x67, 0x73,
+    0x16, 0x13, 0x9C, 0x1A, 0xE4, 0x47, 0x8D, 0x53, 0x88, 0xDE, 0x69, 0xF6, 0x93, 0x14, 0xED, 0x75,
+    0xE0, 0x95, 0x94, 0x0D, 0xD8, 0x17, 0x03, 0x5C, 0x0D, 0x97, 0x39, 0x60, 0x10, 0x3E, 0x98, 0xDC,
+    0x95, 0xE2, 0xF7, 0x51, 0x2D, 0xC5, 0x7D, 0x2B, 0xE1, 0x60, 0x1B, 0x39, 0x6F, 0x07, 0x59, 0x83,
+    0x58, 0x2C, 0xF2, 0xC2, 0x98, 0xDC, 0xAF, 0x3E, 0xAB, 0x24, 0x1A, 0xBE, 0xD7, 0xC8, 0xE5, 0xF0,
+    0xD5, 0x3A, 0x2C, 0x2F, 0x41, 0x70, 0xF1, 0x59, 0x80, 0x6E, 0xA1, 0x3F, 0x71, 0x0E, 0xD6, 0xB5,
+    0x60, 0x42, 0x9A, 0xA3, 0x42, 0x68, 0x3D, 0xC7, 0x59, 0x7F, 0x39, 0x8D, 0x58, 0xDB, 0xDE, 0x4E,
+    0xEC, 0x90, 0xDA, 0x69, 0x66, 0x7B, 0xBD, 0xBB, 0x0B, 0xBB, 0xEF, 0xA9, 0x7B, 0x54, 0x8A, 0x54,
+    0x26, 0x2E, 0x9F, 0xA5, 0xBB, 0x98, 0x49, 0xC4, 0x53, 0x10, 0x2E, 0x38, 0xBA, 0x98, 0xE8, 0x22,
+    0x96, 0xE3, 0xA2, 0xDA, 0x9E, 0xDB, 0xC5, 0x85, 0x39, 0xC7, 0x74, 0x37, 0x65, 0x67, 0xE6, 0x80,
+    0x5C, 0x26, 0xFD, 0x75, 0x5B, 0xD4, 0x07, 0x6F, 0x21, 0xDE, 0xEE, 0xFB, 0x08, 0x78, 0xF0, 0x46,
+    0xA0, 0x37, 0xC4, 0x86, 0xF0, 0x5F, 0x74, 0x60, 0x74, 0x65, 0x5A, 0x68, 0x24, 0x2C, 0x36, 0xCC,
+    0xA2, 0xD0, 0x28, 0x72, 0x57, 0xAF, 0x54, 0x68, 0x94, 0x8C, 0xDD, 0x15, 0x0F, 0xAC, 0x64, 0x82,
+    0xCC, 0xD4, 0x3E, 0xE8, 0x5C, 0x76, 0x1F, 0xB6, 0xFB, 0x41, 0x11, 0x0C, 0xCD, 0x29, 0x9D, 0xD5,
+    0x2B, 0x04, 0x85, 0x71, 0x05, 0x55, 0x60, 0x9B, 0xE3, 0x21, 0xE1, 0x0C, 0xD2, 0x08, 0x8D, 0x90,
+    0xE8, 0xAD, 0x56, 0xA1, 0x2D, 0x23, 0x05, 0x07, 0x70, 0x01, 0x22, 0xB4, 0x76, 0x44, 0x0A, 0xB4,
+    0x78, 0x53, 0x57, 0xCE, 0xF8, 0x2B, 0xA0, 0xA2, 0x19, 0xA8, 0x7A, 0x01, 0x0A, 0x88, 0x14, 0x08,
+    0x8D, 0x95, 0x2D, 0x97, 0x04, 0x5A, 0xC0, 0x59, 0x44, 0x30, 0x4F, 0x38, 0x1A, 0xA8, 0xCD, 0xA3,
+    0x41, 0xE8, 0x6D, 0xBC, 0x41, 0xAA, 0x92, 0x2E, 0x07, 0xE0, 0x52, 0x43, 0xBF, 0x03, 0x53, 0x4A,
+    0x26, 0x74, 0x3E, 0x18, 0xC4, 0x13, 0xD8, 0xE5, 0x00, 0xAF, 0x42, 0xA0, 0x44, 0x40, 0x07, 0x5A,
+    0x3B, 0x10, 0x53, 0xA2, 0xC0, 0x68, 0xA2, 0x64, 0x28, 0x9E, 0xE4, 0x00, 0xE9, 0xF5, 0xE9, 0x25,
+    0xD2, 0xDA, 0x35, 0xFD, 0xC1, 0x46, 0xF4, 0x54, 0xC0, 0xB1, 0x8C, 0x55, 0x5C, 0x32, 0x93, 0xE7,
+    0xC6, 0xAC, 0x3A, 0xA3, 0xEF, 0x51, 0xEF, 0x79, 0x5C, 0x0E, 0xBA, 0xB4, 0x9E, 0x62, 0x1D, 0x48,
+    0xB7, 0xA6, 0x80, 0xE9, 0xDB, 0x02, 0xEE, 0x4D, 0x07, 0x47, 0xA1, 0xAB, 0x58, 0x14, 0x47, 0xB5,
+    0xD3, 0x63, 0x2B, 0x2C, 0x28, 0x4A, 0x65, 0x40, 0x55, 0x92, 0x7C, 0xC4, 0x4D, 0x12, 0x0F, 0xDC,
+    0x49, 0xBA, 0x73, 0xF7, 0x03, 0x08, 0x55, 0xB2, 0x15, 0xC4, 0x54, 0x21, 0xF9, 0xBD, 0xAF, 0x05,
+    0x5F, 0xA7, 0x85, 0x5E, 0xDC, 0xA8, 0xBF, 0x29, 0x98, 0xC1, 0x10, 0x89, 0xD0, 0x11, 0x4A, 0x95,
+    0x1E, 0x9C, 0xDA, 0xB6, 0x4E, 0xB5, 0x1B, 0x75, 0x5B, 0x24, 0x30, 0x76, 0xE4, 0xC5, 0x8E, 0xB8,
+    0xB5, 0x83, 0xC8, 0xBA, 0xA2, 0x44, 0x79, 0x56, 0x49, 0xF2, 0xAD, 0x12, 0xC4, 0x07, 0xC8, 0x51,
+    0xD9, 0xAF, 0xD0, 0x82, 0xB0, 0x75, 0x91, 0xF2, 0x4D, 0x27, 0xBE, 0x65, 0x28, 0xC8, 0x4C, 0xDC,
+    0x52, 0x2F, 0x34, 0x96, 0x0D, 0xE2, 0xC2, 0x59, 0x45, 0xFD, 0x86, 0x05, 0xF1, 0x09, 0x87, 0xCB,
+    0x27, 0xF5, 0x9C, 0xB2, 0xD2, 0x1C, 0x77, 0x60, 0x74, 0x73, 0xDC, 0x22, 0x99, 0x51, 0xEB, 0x9E,
+    0x48, 0x12, 0xE0, 0xF6, 0x81, 0x4B, 0xAE, 0xD6, 0x9A, 0xB4, 0xCE, 0x6A, 0x8B, 0xDC, 0xD9, 0xDD,
+    0xDE, 0x68, 0xE2, 0xB7, 0xC5, 0x15, 0xDE, 0xED, 0x18, 0x6A, 0x9A, 0x51, 0x76, 0xAF, 0x1D, 0x20,
+    0x38, 0x20, 0xA1, 0xF2, 0x85, 0x86, 0xC4, 0x9C, 0x5F, 0x19, 0x05, 0xAB, 0x4F, 0x65, 0x66, 0xEE,
+    0xD4, 0xE3, 0xC8, 0x28, 0x36, 0xBD, 0xB6, 0x72, 0xEF, 0x47, 0x86, 0x71, 0xCA, 0x75, 0x91, 0x1E,
+    0x8A, 0x6C, 0x9F, 0x8B, 0x17, 0xF5, 0xF4, 0xDC, 0xFC, 0xB3, 0xB9, 0x97, 0x38, 0x33, 0x77, 0x26,
+    0x7B, 0x73, 0x9F, 0xD3, 0xB9, 0x40, 0x36, 0x2A, 0x9B, 0x0B, 0x19, 0xB3, 0xB3, 0x00, 0xE7, 0x8A,
+    0x5C, 0x8C, 0x31, 0x33, 0x9F, 0xB4, 0x02, 0xFD, 0xB4, 0xA0, 0x3E, 0xDE, 0xFD, 0x03, 0x18, 0x69,
+    0xE9, 0x5F, 0xC3, 0x07, 0x17, 0x51, 0xE1, 0x7B, 0x0D, 0x1C, 0x24, 0xA8, 0x4E, 0x68, 0xA6, 0xEC,
+    0xF3, 0xAF, 0xE8, 0x97, 0xE6, 0xB8, 0xF9, 0xBD, 0xF6, 0xAC, 0xDB, 0x92, 0xF7, 0x73, 0xF6, 0x6A,
+    0x0F, 0x87, 0xDF, 0xFB, 0x0D, 0xBD, 0xE7, 0xEB, 0x4D, 0x82, 0xA0, 0x5C, 0x35, 0xF3, 0xB2, 0x06,
+    0xE1, 0x7A, 0x7B, 0xFB, 0x5C, 0x08, 0x52, 0x86, 0xC4, 0x3E, 0xBC, 0x39, 0xC9, 0x2C, 0xE6, 0x15,
+    0xE8, 0x40, 0xDE, 0x57, 0x74, 0xFA, 0x95, 0xF3, 0x4A, 0xC4, 0x16, 0xFB, 0xC0, 0xE7, 0x5A, 0x02,
+    0x51, 0x86, 0x4C, 0xC2, 0x87, 0x37, 0x6D, 0xEB, 0x29, 0x61, 0xE8, 0xA6, 0x8E, 0xD0, 0xC7, 0x3B,
+    0xFD, 0xD0, 0x03, 0x29, 0xDB, 0x5D, 0xB4, 0x7A, 0xCA, 0xA1, 0x59, 0xC2, 0x39, 0x57, 0xCD, 0x20,
+    0xF1, 0x60, 0x18, 0x9E, 0xB0, 0x6B, 0x6F, 0xF9, 0x50, 0xFA, 0x0F, 0x0A, 0x4D, 0x25, 0xF2, 0x35,
+    0xC6, 0xD5, 0x8C, 0x5C, 0xCB, 0xFE, 0xFA, 0x49, 0x29, 0xCF, 0x07, 0x7F, 0xA1, 0xEF, 0xBB, 0xA7,
+    0xB6, 0xB6, 0x33, 0x4A, 0xED, 0xC9, 0x79, 0x01, 0x76, 0xCC, 0x9B, 0x06, 0x03, 0xFE, 0xA6, 0x4B,
+    0x75, 0xD6, 0xD2, 0xE5, 0xD7, 0x71, 0x97, 0x76, 0x59, 0xEB, 0xCE, 0xC3, 0xBE, 0x0D, 0x71, 0x43,
+    0x1D, 0xDE, 0x98, 0x7D, 0x54, 0x84, 0x52, 0x9E, 0x09, 0x79, 0x43, 0xEE, 0x55, 0x79, 0xA8, 0x51,
+    0x03, 0xA9, 0x2B, 0xA2, 0xA4, 0x6A, 0xD7, 0xDE, 0xED, 0x45, 0x38, 0x3A, 0xB4, 0x4B, 0x73, 0xEF,
+    0x75, 0x2D, 0xE6, 0x76, 0x58, 0xE6, 0x7A, 0x2D, 0x8F, 0xC5, 0xA2, 0x9A, 0xB9, 0x75, 0x85, 0xDC,
+    0xF1, 0x61, 0x85, 0xC1, 0x51, 0xCB, 0x74, 0x4A, 0xD6, 0x5C, 0xA6, 0x95, 0x8F, 0x59, 0xCF, 0x0B,
+    0xEC, 0x0A, 0xEA, 0x71, 0xF1, 0xA1, 0x39, 0x2E, 0xD1, 0x3F, 0x91, 0x29, 0x4A, 0x55, 0xF5, 0x72,
+    0xA2, 0xB2, 0x37, 0x7C, 0xA6, 0x69, 0x9E, 0xFD, 0x01, 0x38, 0x55, 0x9F, 0xE2, 0x09, 0xDB, 0x06,
+    0x23, 0xC5, 0x16, 0x23, 0xF8, 0x15, 0x16, 0x4A, 0x3F, 0x9B, 0x63, 0x70, 0x6D, 0xCC, 0x3B, 0x9E,
+    0x22, 0xD3, 0xD2, 0x92, 0x75, 0xF1, 0xA7, 0xF5, 0x11, 0xF1, 0x1F, 0x7C, 0x84, 0xB4, 0x37, 0xBB,
+    0x8F, 0xD4, 0xE2, 0xA2, 0x7D, 0x5F, 0xA8, 0xFB, 0x52, 0xFD, 0x16, 0xD5, 0xC3, 0xA5, 0xE8, 0x55,
+    0xFA, 0x38, 0x3A, 0x9C, 0x84, 0x76, 0x9F, 0xD1, 0x37, 0x3D, 0x3B, 0x2F, 0x7A, 0xCD, 0x7A, 0x52,
+    0x6F, 0x26, 0xCD, 0x4E, 0x52, 0xDF, 0x3E, 0x9A, 0x37, 0xB4, 0x3A, 0xEC, 0x09, 0x57, 0x11, 0x32,
+    0xF5, 0xA0, 0x17, 0x3C, 0xA5, 0x76, 0xBA, 0xA9, 0x3E, 0xA4, 0xA5, 0xE7, 0xF0, 0x99, 0x9D, 0xF1,
+    0x3B, 0x72, 0x65, 0x7C, 0x4F, 0xBC, 0x1C, 0xB8, 0x6E, 0xC6, 0xCD, 0x4E, 0xDC, 0xDC, 0x8A, 0x34,
+    0x7F, 0x7C, 0x4F, 0x7C, 0x28, 0x1F, 0xA0, 0xA4, 0x37, 0x27, 0xA1, 0x39, 0x13, 0xB4, 0x51, 0xB9,
+    0x29, 0xC3, 0x45, 0xE6, 0x71, 0x83, 0x5C, 0x96, 0xA3, 0x34, 0xEF, 0x67, 0x2C, 0x33, 0x62, 0xA1,
+    0x6A, 0xD3, 0xAF, 0x15, 0x0F, 0xB7, 0x7F, 0x08, 0x8F, 0xE1, 0x33, 0x7F, 0x45, 0xAC, 0xD4, 0x73,
+    0x38, 0x2D, 0xF6, 0x34, 0x77, 0xE0, 0xF1, 0x0E, 0x3F, 0x00, 0xF6, 0xF5, 0xD1, 0x3F, 0xF8, 0xEF,
+    0x34, 0x2F, 0xA2, 0x26, 0x6A, 0xEE, 0x80, 0xB7, 0xFF, 0xA0, 0x53, 0xFC, 0x0C, 0x5B, 0x6F, 0xDC,
+    0xCF, 0xE5, 0xA7, 0xAF, 0x4C, 0xBF, 0x59, 0xF2, 0x00, 0xD6, 0x14, 0x7F, 0x1C, 0xE0, 0xB3, 0x62,
+    0x46, 0x9C, 0x2B, 0x5F, 0x4C, 0xC4, 0xEF, 0xBE, 0xEC, 0x20, 0xA9, 0x66, 0x90, 0xE0, 0x5E, 0xB3,
+    0x49, 0x07, 0x73, 0x6C, 0x74, 0x35, 0xB3, 0x8A, 0x50, 0xCF, 0x12, 0x27, 0x63, 0x80, 0x72, 0xA3,
+    0x68, 0xA9, 0x3C, 0x78, 0x42, 0x66, 0x07, 0x8E, 0xC5, 0xBC, 0xD3, 0x9F, 0x6B, 0x07, 0xF9, 0xD0,
+    0xC7, 0x40, 0xA5, 0x66, 0xA9, 0x66, 0xAD, 0xC4, 0x55, 0xAD, 0x48, 0x09, 0xB5, 0x6E, 0xED, 0x5D,
+    0xE5, 0x8A, 0xD4, 0x5B, 0x6B, 0x57, 0x28, 0xBA, 0x56, 0xAF, 0x70, 0x7D, 0x5A, 0xBF, 0x42, 0x20,
+    0x5A, 0xC1, 0x22, 0xFA, 0x68, 0x0D, 0x1B, 0x2D, 0x6F, 0xE6, 0x72, 0xD2, 0x42, 0x31, 0xAD, 0x74,
+    0x13, 0x77, 0x20, 0x5D, 0x95, 0x32, 0xC6, 0xEB, 0xE5, 0xEB, 0xA4, 0x36, 0xE6, 0x02, 0x55, 0xC9,
+    0xD9, 0xD6, 0xB8, 0xDE, 0xBD, 0x39, 0x39, 0xCE, 0x58, 0xBE, 0x1C, 0x04, 0x07, 0x6D, 0x84, 0x6C,
+    0x16, 0x3B, 0x1E, 0x99, 0x63, 0xE1, 0x92, 0x2B, 0x4D, 0xAD, 0xCC, 0xA2, 0x2F, 0xCC, 0xA9, 0xFC,
+    0x71, 0x2C, 0x9E, 0x90, 0x39, 0x33, 0x47, 0x68, 0xAE, 0x77, 0x6F, 0xD6, 0x0E, 0x60, 0xE7, 0x86,
+    0x38, 0x68, 0xCB, 0xF0, 0x67, 0xE9, 0xDC, 0x58, 0x08, 0xE4, 0x3C, 0x21, 0x2D, 0x4C, 0x9A, 0x7F,
+    0xBD, 0x1D, 0x3F, 0x23, 0x9C, 0x4B, 0x08, 0x8B, 0xBD, 0x0A, 0xED, 0x5D, 0x26, 0xB6, 0xDC, 0x5F,
+    0xFD, 0x2F, 0x7D, 0xC3, 0x96, 0xCE, 0xE5, 0x1A, 0x9B, 0x93, 0x4F, 0xB6, 0x74, 0xE3, 0x62, 0x0E,
+    0xFB, 0xEB, 0x2F, 0xC7, 0x27, 0x9B, 0xAF, 0xE2, 0xB0, 0xBA, 0x3E, 0x2D, 0x63, 0x54, 0x04, 0xC8,
+    0x24, 0xF8, 0x5F, 0x85, 0x45, 0x0F, 0x6A, 0x62, 0xE5, 0x5E, 0x3C, 0x1A, 0xCE, 0xA2, 0x4F, 0x66,
+    0xFF, 0x45, 0x31, 0xAE, 0x3F, 0x68, 0x0E, 0xFB, 0x27, 0xD1, 0x3F, 0x21, 0x8F, 0x41, 0x36, 0x49,
+    0x1E, 0xEB, 0xC1, 0x5E, 0x5A, 0x16, 0x93, 0x62, 0xC2, 0xDF, 0xFB, 0x25, 0x94, 0x19, 0xBE, 0x4F,
+    0xCB, 0x7D, 0x5C, 0x1E, 0xDF, 0x66, 0x66, 0x4D, 0x69, 0x00, 0x47, 0x8C, 0x2D, 0x9D, 0x4B, 0x7E,
+    0x1E, 0x1A, 0x45, 0x0E, 0x55, 0xF9, 0xA8, 0xBF, 0xE3, 0xD7, 0x8D, 0x7D, 0x5F, 0x0B, 0x7C, 0xE5,
+    0x69, 0xEC, 0xC3, 0x72, 0xF9, 0x08, 0xF5, 0xC4, 0xBF, 0xF2, 0x43, 0x3D, 0x47, 0x9E, 0xBC, 0x25,
+    0x8B, 0xFB, 0xED, 0xC3, 0x3B, 0xEA, 0xCD, 0xAC, 0x49, 0x2D, 0x5D, 0x61, 0x34, 0xB0, 0x12, 0x60,
+    0x66, 0x7A, 0x88, 0xC7, 0xF6, 0x9A, 0x99, 0xB3, 0xE8, 0xEF, 0xF9, 0x7F, 0x45, 0xEC, 0x82, 0xBD,
+    0xB0, 0xE3, 0x61, 0xFD, 0x6B, 0x11, 0xD8, 0x46, 0x7F, 0x92, 0xF5, 0xB0, 0xDC, 0x0C, 0x4C, 0x7C,
+    0x5E, 0x2B, 0x99, 0x43, 0xC2, 0xBC, 0xA8, 0xE5, 0xF4, 0xFE, 0x37, 0x87, 0x28, 0xD0, 0x7F, 0x03,
+    0xAD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xC6, 0x4E, 0xCE, 0xE2, 0xAC, 0xC8, 0x29, 0x92,
+    0xE6, 0x0E, 0x9D, 0x5B, 0x74, 0x90, 0x73, 0x73, 0x05, 0x48, 0xBB, 0xEB, 0x41, 0x48, 0xD0, 0x52,
+    0xDC, 0x56, 0x34, 0x29, 0x52, 0xA0, 0x03, 0x11, 0x0A, 0x8A, 0x2B, 0x9C, 0xB3, 0xF3, 0x0B, 0xB8,
+    0x86, 0xFE, 0x8A, 0x14, 0x61, 0x53, 0x5C, 0x8A, 0x2B, 0x0E, 0xB1, 0x5A, 0x4F, 0x68, 0x23, 0x21,
+    0xF3, 0x0F, 0x8C, 0x04, 0x11, 0xA2, 0x61, 0x0A, 0x07, 0x9C, 0x9C, 0x77, 0xCD, 0xF7, 0xEC, 0x5D,
+    0x92, 0x90, 0x13, 0x15, 0xF6, 0x3C, 0xAF, 0x77, 0xC6, 0xF3, 0xDE, 0xF7, 0xDE, 0xFB, 0xDE, 0x1B,
+    0xAC, 0x3D, 0x03, 0xE2, 0x36, 0x43, 0x13, 0x94, 0xAE, 0xF5, 0xAC, 0xCF, 0x67, 0x60, 0xDC, 0x2A,
+    0xA4, 0x44, 0x99, 0x67, 0x63, 0x11, 0xED, 0x53, 0x82, 0x92, 0x62, 0x62, 0x1D, 0x65, 0xB1, 0x8E,
+    0x11, 0x9A, 0x06, 0x7E, 0x6B, 0xA1, 0x66, 0x1A, 0x8A, 0x7B, 0x9C, 0x02, 0xBC, 0x52, 0x13, 0x98,
+    0x20, 0x0B, 0x74, 0x80, 0x10, 0x3B, 0x18, 0x62, 0x20, 0xF7, 0xD5, 0xB8, 0xBC, 0xCC, 0xB5, 0xF5,
+    0x8C, 0x86, 0x0C, 0x90, 0x1B, 0x38, 0xB4, 0xE7, 0xA7, 0x1A, 0x5B, 0x31, 0x70, 0x90, 0x72, 0x7F,
+    0x0E, 0xD7, 0x2C, 0x10, 0x60, 0x4E, 0x28, 0x6D, 0xBD, 0xFD, 0x60, 0x71, 0x0F, 0x4E, 0x0D, 0xB8,
+    0x22, 0x15, 0xB7, 0xB4, 0x1A, 0xE3, 0x31, 0xB0, 0x3D, 0x39, 0xE6, 0xBB, 0x45, 0xDB, 0x96, 0x28,
+    0x50, 0x28, 0x03, 0xED, 0x52, 0xA3, 0x4B, 0xCD, 0x5E, 0x4B, 0x3C, 0xDF, 0xB4, 0xB4, 0x13, 0xF3,
+    0x5F, 0x68, 0x2E, 0x51, 0x06, 0x88, 0xCC, 0x21, 0x88, 0x56, 0xE7, 0x08, 0xDB, 0x1A, 0x6A, 0xC2,
+    0xA5, 0xB5, 0xDF, 0x08, 0xB3, 0x85, 0x6A, 0x02, 0x7A, 0x46, 0xA4, 0xC5, 0x1B, 0xFC, 0x92, 0xBB,
+    0x3E, 0xD4, 0xB4, 0x5D, 0x23, 0xFD, 0x69, 0x8E, 0x1C, 0x33, 0xDE, 0xFD, 0x73, 0x86, 0x05, 0x0E,
+    0xD1, 0x20, 0x26, 0x96, 0x80, 0x66, 0xD5, 0x73, 0x7A, 0x32, 0x99, 0xE8, 0xA8, 0x6D, 0x33, 0x62,
+    0xD5, 0xBB, 0xD8, 0xC2, 0x97, 0xF4, 0x12, 0x38, 0x05, 0x94, 0x25, 0x18, 0x2A, 0xF3, 0x05, 0x02,
+    0xA7, 0x86, 0x94, 0xB3, 0xE5, 0x74, 0xF1, 0x62, 0xFA, 0xBA, 0x84, 0xCA, 0x5F, 0xD0, 0xAF, 0x93,
+    0x42, 0x35, 0x9E, 0x75, 0x6B, 0xD7, 0xBA, 0x15, 0xA5, 0xF1, 0x0A, 0xB5, 0x88, 0x34, 0x72, 0xFA,
+    0x9D, 0xCE, 0xE1, 0x3D, 0x6D, 0x75, 0x68, 0x62, 0xC6, 0x9C, 0x4F, 0x30, 0xF6, 0x08, 0x33, 0x46,
+    0x1F, 0xC1, 0x79, 0x43, 0x5F, 0x8E, 0x80, 0xCD, 0x63, 0xA8, 0x96, 0xDF, 0x59, 0xCE, 0x15, 0x61,
+    0x16, 0x9A, 0xD0, 0x44, 0x4B, 0x91, 0x67, 0x50, 0xE6, 0x99, 0x47, 0x8C, 0xF8, 0x36, 0xA5, 0xC1,
+    0x19, 0x2E, 0xD1, 0x8F, 0x81, 0x53, 0xE1, 0x8E, 0x57, 0x76, 0x29, 0x5F, 0xA7, 0x19, 0xBC, 0xF3,
+    0xBA, 0x4C, 0x66, 0x13, 0xDD, 0xCA, 0xBE, 0x0B, 0xD6, 0xA8, 0x04, 0x93, 0xC9, 0x72, 0x9D, 0xD7,
+    0x98, 0x79, 0x59, 0xBD, 0xBF, 0x7C, 0xE5, 0x9C, 0x5B, 0xCD, 0xD3, 0xFF, 0xB0, 0x64, 0x3C, 0x9D,
+    0x86, 0x50, 0x89, 0x94, 0x69, 0x61, 0x56, 0x40, 0x50, 0xB9, 0xC0, 0x62, 0xD6, 0x5F, 0x0C, 0xFE,
+    0xE5, 0x3C, 0x79, 0x11, 0x92, 0x22, 0x05, 0x1C, 0x86, 0xEE, 0x66, 0xA7, 0xF0, 0x06, 0xC0, 0xC8,
+    0x70, 0xCA, 0xB5, 0xC2, 0x09, 0xD2, 0x43, 0x35, 0xC0, 0x6A, 0xA8, 0x6E, 0x70, 0x92, 0x4B, 0x62,
+    0xA3, 0x94, 0xA4, 0xD2, 0x06, 0x83, 0x53, 0x21, 0xCA, 0xF0, 0x6E, 0x8F, 0x2A, 0xFD, 0xA1, 0x46,
+    0xF8, 0xE3, 0x21, 0x82, 0x87, 0x3B, 0x8C, 0x27, 0x45, 0x0F, 0x99, 0x91, 0x01, 0xB9, 0x9A, 0x30,
+    0x59, 0x67, 0x7C, 0xAB, 0xF8, 0x56, 0xF1, 0xAD, 0xD2, 0x15, 0x72, 0xE6, 0xEB, 0xDA, 0x8A, 0x31,
+    0xDA, 0xA9, 0x43, 0xE3, 0x95, 0x41, 0x19, 0x18, 0xDF, 0x86, 0x94, 0x38, 0xF3, 0xBB, 0xCA, 0x48,
+    0x69, 0x8D, 0x52, 0xE4, 0xD4, 0x48, 0x9E, 0x65, 0x29, 0xD1, 0xC7, 0xE4, 0x4C, 0x7C, 0xB7, 0xE9,
+    0x19, 0x33, 0x13, 0xCB, 0x9F, 0x0A, 0x99, 0x6F, 0x57, 0xFE, 0x5F, 0xD6, 0xF9, 0xC8, 0xC2, 0xEF,
+    0x20, 0x32, 0x12, 0x81, 0x11, 0xA0, 0x04, 0x48, 0xD6, 0xAE, 0x42, 0x12, 0xB7, 0xCD, 0xF5, 0xF1,
+    0xDE, 0x0B, 0x82, 0xF8, 0x56, 0x91, 0x1C, 0xB0, 0x14, 0xF1, 0x4D, 0xB6, 0x49, 0x74, 0x30, 0xA2,
+    0xDA, 0xBA, 0x67, 0x96, 0xB0, 0xEA, 0x4C, 0x19, 0xA7, 0x74, 0x4C, 0xF0, 0xFB, 0x49, 0x47, 0xCC,
+    0xED, 0xC9, 0x84, 0x04, 0x61, 0x44, 0xDB, 0xDC, 0xB8, 0xB5, 0x14, 0x37, 0xF5, 0x10, 0x7E, 0xBF,
+    0x9F, 0xC5, 0xF7, 0x36, 0xF7, 0xC6, 0xC2, 0x80, 0x55, 0xD1, 0x44, 0x52, 0x30, 0x59, 0x42, 0x1C,
+    0xA9, 0x5A, 0x20, 0x62, 0x31, 0xAC, 0x4D, 0x24, 0x7F, 0x1B, 0x59, 0xBF, 0xCE, 0x64, 0xBA, 0xFC,
+    0x36, 0x20, 0xC8, 0x01, 0xE5, 0x74, 0x06, 0xA7, 0x98, 0xC3, 0xD7, 0x0D, 0xB6, 0x18, 0x7B, 0xDA,
+    0xAC, 0xF6, 0x1F, 0x2C, 0x8E, 0xBB, 0x82, 0x15, 0xA8, 0xF4, 0x91, 0xCC, 0x40, 0x57, 0xB8, 0xFB,
+    0x64, 0x6B, 0xDB, 0x16, 0x8A, 0xE2, 0x18, 0x65, 0x58, 0xB0, 0xDA, 0xA5, 0x6A, 0x4F, 0xEA, 0x80,
+    0x76, 0x82, 0xBE, 0x70, 0x75, 0x6F, 0x27, 0xEE, 0x30, 0x4C, 0x19, 0xC4, 0x5C, 0xCD, 0x89, 0xA3,
+    0xEA, 0x71, 0xFC, 0x0F, 0x85, 0xBB, 0xC1, 0x98, 0x48, 0x6C, 0x28, 0x2C, 0xDA, 0x1B, 0x38, 0xC6,
+    0x01, 0xED, 0x12, 0xA7, 0x74, 0x2F, 0x8F, 0xCA, 0x02, 0xFE, 0xDD, 0xA1, 0x24, 0x14, 0xBA, 0xE1,
+    0x94, 0xCB, 0x69, 0xDD, 0x4F, 0x5F, 0x93, 0x4C, 0x6E, 0xB2, 0x61, 0xB6, 0x27, 0x8C, 0xA9, 0xDF,
+    0x35, 0x4C, 0xDE, 0xA5, 0x5B, 0xB1, 0x65, 0xCE, 0x49, 0xDA, 0x56, 0x9A, 0x15, 0x1B, 0xD1, 0x93,
+    0x96, 0x5E, 0xA4, 0x9A, 0x54, 0xC8, 0x66, 0x8C, 0xE9, 0x21, 0xA9, 0xCB, 0xA8, 0x22, 0x3C, 0x97,
+    0x26, 0x44, 0x65, 0x9F, 0x1D, 0x31, 0x94, 0xC4, 0x55, 0xCE, 0x20, 0xA5, 0x2D, 0x2D, 0xEA, 0xA5,
+    0x1B, 0xD1, 0xA3, 0x96, 0x98, 0xE9, 0xEB, 0x7D, 0xE6, 0x8F, 0x3E, 0x5C, 0x25, 0xB1, 0x4F, 0x19,
+    0xD3, 0x86, 0x74, 0xC9, 0x19, 0xAA, 0xCD, 0x5F, 0xD0, 0x63, 0xFD, 0x97, 0x6C, 0x9F, 0x4C, 0x24,
+    0xF7, 0xE6, 0xA2, 0x35, 0x5C, 0x96, 0xFE, 0xB9, 0x5C, 0x97, 0x26, 0x34, 0x1E, 0xEB, 0xD5, 0xFB,
+    0xCB, 0x97, 0xCC, 0xFD, 0x33, 0xFF, 0x39, 0xBC, 0x1A, 0x51, 0xC1, 0x90, 0x32, 0xC3, 0x4C, 0xAC,
+    0xDF, 0x91, 0x76, 0xC9, 0x58, 0xBD, 0x1A, 0x58, 0xBE, 0x70, 0x92, 0x4B, 0x41, 0x57, 0xA2, 0xC2,
+    0xCC, 0xB7, 0x56, 0x3A, 0x77, 0xC1, 0x54, 0x48, 0xF9, 0x12, 0x3F, 0x55, 0x78, 0x5D, 0x05, 0xBF,
+    0x32, 0xAC, 0x4C, 0xFA, 0x76, 0xA9, 0x9D, 0xBA, 0xBA, 0x6E, 0x11, 0x58, 0xA4, 0x99, 0x34, 0x56,
+    0xB9, 0x36, 0xEE, 0x42, 0x3D, 0xCD, 0x99, 0x8F, 0x11, 0xDD, 0x19, 0x92, 0xFD, 0x03, 0xA6, 0x29,
+    0xC1, 0x94, 0xC5, 0x5A, 0x33, 0x59, 0xB5, 0x23, 0x62, 0x31, 0xBD, 0x62, 0x11, 0x9F, 0x3E, 0x37,
+    0x9B, 0xD9, 0x77, 0x42, 0x5D, 0xF5, 0xA7, 0xF5, 0xB3, 0x3A, 0x44, 0x3D, 0x52, 0x36, 0xF1, 0x8A,
+    0xD9, 0x0C, 0x73, 0x2D, 0xD8, 0xD8, 0x35, 0xEE, 0xC0, 0x44, 0x27, 0x99, 0x9C, 0x7F, 0x1B, 0x47,
+    0xCE, 0xF3, 0xDA, 0xCF, 0x86, 0x21, 0xA2, 0x21, 0xA2, 0x04, 0xD1, 0x14, 0x51, 0x8D, 0x51, 0x8D,
+    0xA4, 0x46, 0x9D, 0x28, 0x1B, 0x7D, 0x22, 0x9F, 0xA9, 0x3D, 0xEC, 0xA9, 0xC6, 0x2D, 0x31, 0xF4,
+    0xE9, 0xCC, 0x9B, 0x8C, 0xEA, 0x57, 0x10, 0x77, 0x7A, 0x8A, 0xF0, 0xF7, 0x3D, 0xBA, 0x6D, 0xD9,
+    0x9A, 0xCC, 0x14, 0xA1, 0x1E, 0xE9, 0x6D, 0x6C, 0x68, 0xEC, 0xC3, 0xFB, 0xA3, 0xBC, 0xA2, 0xC8,
+    0x8B, 0xA9, 0x0C, 0x35, 0x55, 0x2D, 0x09, 0xDC, 0xA1, 0x71, 0xCB, 0x84, 0xCE, 0x7C, 0x21, 0x2A,
+    0xD6, 0x8F, 0xFB, 0x7A, 0x91, 0x76, 0x27, 0xA4, 0x93, 0x9A, 0x76, 0x1F, 0xDD, 0x83, 0xF7, 0x98,
+    0x05, 0x76, 0x9F, 0x7D, 0xAA, 0x94, 0x7E, 0x35, 0x62, 0x9D, 0x4B, 0xBF, 0x4A, 0x2E, 0xE8, 0x57,
+    0x0B, 0x73, 0x8B, 0xB3, 0x17, 0xEA, 0x31, 0xE3, 0x8F, 0x3D, 0x93, 0x1E, 0xF9, 0xD9, 0x80, 0x44,
+    0x66, 0x02, 0x3D, 0x8D, 0x90, 0xDD, 0x74, 0x8B, 0x44, 0x8A, 0xBE, 0xD6, 0xF4, 0xC6, 0x60, 0xC0,
+    0x0F, 0x13, 0x26, 0xE1, 0x0C, 0xCF, 0x70, 0x0B, 0xDB, 0xD4, 0xE3, 0x5B, 0xC7, 0x3A, 0xA5, 0x5B,
+    0xB8, 0xC6, 0x33, 0xBE, 0x9C, 0xE8, 0xAF, 0x9C, 0xE9, 0xF1, 0xC3, 0x50, 0x5F, 0x7F, 0xFF, 0x9E,
+    0x73, 0x84, 0xDB, 0x8F, 0xE7, 0x61, 0x2D, 0x18, 0x6F, 0x26, 0x44, 0x29, 0xED, 0x43, 0xCE, 0xA9,
+    0x69, 0x87, 0x94, 0xD4, 0xE9, 0xD0, 0x11, 0x2D, 0x8F, 0x00, 0xE2, 0xE5, 0x93, 0x88, 0x09, 0x2C,
+    0x01, 0x95, 0xD3, 0x9A, 0x75, 0xCE, 0x69, 0xEF, 0x98, 0x6F, 0xD4, 0x26, 0xBA, 0x5E, 0xF3, 0x36,
+    0xFA, 0x0F, 0x6F, 0xD5, 0xDE, 0x86, 0x5E, 0x6B, 0xDA, 0x02, 0xDF, 0x7F, 0x60, 0x31, 0xA7, 0xF2,
+    0x5A, 0x59, 0x25, 0xB8, 0x57, 0xD8, 0x0B, 0xCF, 0xB8, 0x26, 0xD0, 0x1E, 0x3B, 0xBD, 0xFF, 0x33,
+    0xCB, 0xED, 0x24, 0xEB, 0x2A, 0x21, 0x5C, 0x56, 0x79, 0x2C, 0xC2, 0x28, 0x61, 0x5F, 0x3B, 0x4F,
+    0x2A, 0x3F, 0x3B, 0x08, 0xF4, 0x2E, 0x83, 0x41, 0xCA, 0x4B, 0xAF, 0x0B, 0xC9, 0xE3, 0x72, 0x57,
+    0x95, 0x07, 0x4E, 0x31, 0xEA, 0xF2, 0x2F, 0x17, 0x0F, 0xDC, 0x02, 0xDE, 0xAF, 0xAC, 0x12, 0x39,
+    0xCD, 0xD9, 0x17, 0x38, 0xC2, 0x4E, 0xE3, 0x4E, 0x77, 0xDC, 0x0F, 0xBA, 0x11, 0x9F, 0xC1, 0x3F,
+    0xC2, 0xDF, 0x8D, 0x59, 0x3D, 0x90, 0xDD, 0xD4, 0x15, 0x3E, 0x7A, 0x62, 0xAD, 0x0C, 0x9A, 0xB1,
+    0xDC, 0xB8, 0xC1, 0x18, 0xB5, 0x99, 0x89, 0xBD, 0x4A, 0x41, 0xE1, 0x64, 0x76, 0x2D, 0x01, 0x85,
+    0x8B, 0x14, 0x6C, 0xC1, 0x83, 0x82, 0x82, 0x14, 0xA9, 0x28, 0x58, 0x32, 0xE3, 0x82, 0xC9, 0x60,
+    0x24, 0xE2, 0xC2, 0x05, 0x45, 0x9C, 0x22, 0x29, 0x42, 0x01, 0x05, 0x05, 0x6C, 0x0A, 0x6F, 0x66,
+    0x5C, 0x50, 0xD8, 0x96, 0x62, 0x17, 0x2E, 0x5C, 0x58, 0xC1, 0x93, 0xA1, 0xC8, 0xCF, 0x28, 0x04,
+    0x42, 0x70, 0x66, 0x82, 0x98, 0x88, 0xB1, 0xBC, 0xE8, 0xE9, 0xE6, 0xFB, 0xCE, 0xD1, 0x7B, 0xBB,
+    0x06, 0x32, 0x13, 0xE1, 0xBD, 0xE7, 0xEE, 0xEA, 0xEA, 0xDE, 0x73, 0xCE, 0x3D, 0xE7, 0x3B, 0xDF,
+    0xBD, 0x88, 0xE8, 0xE3, 0x95, 0x3D, 0xDA, 0x68, 0xCF, 0xA1, 0xCD, 0xB3, 0xB4, 0x10, 0x6F, 0x90,
+    0x24, 0x13, 0xBF, 0x93, 0xE3, 0x22, 0x61, 0xCB, 0x21, 0x51, 0xCD, 0x36, 0xA9, 0xD8, 0xA6, 0xC5,
+    0xD1, 0xF9, 0x7C, 0x2B, 0xCD, 0x52, 0xE7, 0xBA, 0x34, 0x0B, 0xBA, 0xA0, 0xCD, 0x25, 0x68, 0xBD,
+    0x36, 0x45, 0x2B, 0x6D, 0x9A, 0x85, 0x8D, 0x34, 0x69, 0xC1, 0x2F, 0xE2, 0x3A, 0xC2, 0x17, 0xC1,
+    0xFD, 0xED, 0x3F, 0x3E, 0x23, 0x52, 0x3A, 0x37, 0xE8, 0xD7, 0x3A, 0x47, 0xA6, 0xAD, 0x2E, 0x9F,
+    0x8B, 0x87, 0xDF, 0xAE, 0x89, 0x8F, 0x37, 0x0B, 0x09, 0xD1, 0x1F, 0x24, 0x12, 0x39, 0x36, 0xEE,
+    0x5C, 0xC3, 0x10, 0xE7, 0x16, 0x54, 0xF1, 0x09, 0x7E, 0xE0, 0x9F, 0xE7, 0xC7, 0xFE, 0x53, 0xEC,
+    0x07, 0x3F, 0x52, 0xBD, 0x5C, 0x87, 0x97, 0xEE, 0xF3, 0x11, 0x8A, 0x8E, 0x87, 0x61, 0x40, 0xFA,
+    0x97, 0xE3, 0x79, 0x26, 0xEE, 0xD1, 0x13, 0xA9, 0xCC, 0x86, 0x13, 0x27, 0x36, 0x24, 0xE8, 0x36,
+    0x4E, 0x61, 0x5C, 0x7B, 0xEA, 0x71, 0xEA, 0x73, 0xF6, 0x2C, 0xAD, 0xD8, 0xDD, 0xA5, 0x1E, 0xBB,
+    0x2D, 0xDB, 0xA6, 0xA1, 0xD1, 0x0D, 0xB4, 0xCD, 0xBD, 0x3F, 0x40, 0xDB, 0x7C, 0x76, 0x9D, 0xAD,
+    0x7F, 0x43, 0x5B, 0x2E, 0x98, 0x3E, 0x75, 0x06, 0x0B, 0xA6, 0x17, 0x02, 0xC9, 0x24, 0xBE, 0x15,
+    0xFA, 0x95, 0x84, 0x2E, 0x4A, 0x0A, 0x99, 0x39, 0xA7, 0x1E, 0x73, 0xF4, 0xDE, 0xC9, 0x73, 0x54,
+    0x07, 0xEB, 0xE1, 0xE1, 0x82, 0x22, 0x5C, 0x50, 0x84, 0x0B, 0xAE, 0x9E, 0x99, 0x1B, 0xE9, 0x45,
+    0xE7, 0x6A, 0xF1, 0xC6, 0x2C, 0x69, 0x25, 0xEC, 0x24, 0xEA, 0xE8, 0x56, 0x74, 0x4A, 0xA1, 0x17,
+    0x61, 0xAC, 0x5F, 0xF8, 0x74, 0x14, 0x34, 0x57, 0x0B, 0xD5, 0xFF, 0x71, 0xBD, 0x73, 0xF1, 0x1A,
+    0x06, 0xBA, 0x8F, 0x5C, 0x91, 0x56, 0xD1, 0x87, 0x97, 0x2A, 0x78, 0xF8, 0xCF, 0x51, 0x91, 0x67,
+    0xD1, 0xC7, 0x0F, 0x43, 0x7F, 0x8E, 0xCA, 0x31, 0x8A, 0x2D, 0x77, 0x29, 0x57, 0x3F, 0x63, 0x33,
+    0xA9, 0x79, 0x46, 0x3F, 0xA7, 0x55, 0xCE, 0xB5, 0xEB, 0x6B, 0xF2, 0x7D, 0xAC, 0xB9, 0xF0, 0x5A,
+    0xF1, 0xC7, 0x45, 0x0C, 0xE3, 0x61, 0x05, 0x86, 0xC6, 0xEA, 0x66, 0x99, 0xD3, 0xB5, 0xA1, 0x53,
+    0xCB, 0x26, 0x81, 0x2F, 0x65, 0xB4, 0x8D, 0x3B, 0x6D, 0x3B, 0xB7, 0x69, 0x5B, 0xB7, 0xA1, 0x7B,
+    0xA7, 0xA2, 0x34, 0xFB, 0x46, 0x13, 0x0B, 0x8B, 0xAA, 0xE1, 0xA0, 0x98, 0xF5, 0x2A, 0x7C, 0x0B,
+    0x82, 0x49, 0x04, 0x6A, 0xDB, 0x14, 0x62, 0x12, 0x35, 0x6C, 0x0F, 0x5D, 0xDA, 0x7B, 0xD7, 0x74,
+    0xE8, 0xF7, 0x43, 0x6E, 0x29, 0x2C, 0x78, 0xA6, 0xE8, 0x91, 0x52, 0x7F, 0xFB, 0x9E, 0xDB, 0xD3,
+    0xBF, 0xA9, 0xAE, 0xAB, 0xC7, 0x2B, 0xA9, 0x4C, 0x34, 0xBA, 0x8A, 0xC3, 0xE1, 0x6A, 0x86, 0x56,
+    0x4B, 0x35, 0xB0, 0x28, 0x22, 0xDB, 0xAF, 0xC5, 0x6F, 0xC5, 0x5B, 0xEA, 0xF0, 0xCD, 0xD6, 0xA7,
+    0xF7, 0x3D, 0x75, 0x8E, 0xB5, 0x93, 0x09, 0x6A, 0xCF, 0x6C, 0x67, 0x7C, 0x0F, 0x03, 0xCD, 0x3F,
+    0xF6, 0x77, 0xDF, 0xBE, 0x55, 0x1B, 0x22, 0x55, 0x6C, 0x5D, 0x15, 0x71, 0x63, 0x76, 0x98, 0x23,
+    0xF7, 0x16, 0x92, 0xFC, 0x0B, 0x19, 0x23, 0xDF, 0x95, 0x63, 0x4E, 0xDF, 0x3F, 0x33, 0xA9, 0xEA,
+    0x9B, 0x6D, 0x12, 0x98, 0x71, 0x8C, 0x7D, 0x7D, 0x4E, 0x6A, 0x7B, 0x54, 0x36, 0x9E, 0x41, 0xC8,
+    0x3C, 0xE9, 0x6A, 0xE7, 0xB2, 0x63, 0x2E, 0x72, 0x5F, 0x38, 0xD8, 0xE4, 0x4E, 0x86, 0xF7, 0x7A,
+    0xEC, 0xDE, 0xB8, 0xEB, 0xBB, 0x1A, 0x8E, 0x1B, 0x2B, 0xDF, 0x65, 0x51, 0xE3, 0xB9, 0xCC, 0x1F,
+    0xE1, 0xC8, 0x99, 0x93, 0x00, 0x49, 0x54, 0xCF, 0x16, 0x8C, 0xAC, 0xB8, 0x42, 0x40, 0x21, 0x42,
+    0x92, 0x0A, 0x46, 0x61, 0x70, 0x5A, 0xC0, 0x44, 0xE4, 0x27, 0x52, 0xB5, 0xC5, 0x4B, 0x6C, 0x22,
+    0xFE, 0x08, 0x0F, 0x97, 0xF6, 0x92, 0xB2, 0xA6, 0x73, 0x47, 0xBE, 0x74, 0x19, 0x24, 0xBE, 0x74,
+    0xDC, 0x5E, 0x7C, 0x09, 0xE9, 0xD6, 0xD2, 0x2C, 0xC2, 0x96, 0x97, 0x63, 0x2A, 0xEB, 0x90, 0x69,
+    0x67, 0x51, 0xB0, 0x86, 0x6D, 0xB9, 0x3C, 0x29, 0xDF, 0x4E, 0xB6, 0xD5, 0xF2, 0xC0, 0x13, 0x39,
+    0x4B, 0x82, 0x18, 0x8A, 0x6A, 0x32, 0xC0, 0x15, 0x31, 0xED, 0x2F, 0x2B, 0xB3, 0x1B, 0xA9, 0x61,
+    0xB2, 0x91, 0xC7, 0xE8, 0xED, 0xAF, 0x5A, 0xF5, 0x83, 0xF7, 0x69, 0xAB, 0x61, 0x37, 0xBB, 0xD3,
+    0xEB, 0x52, 0xFE, 0xF5, 0x81, 0xD2, 0x67, 0x88, 0xC2, 0xA7, 0x26, 0xB1, 0x66, 0x58, 0x38, 0x5D,
+    0x3A, 0xCC, 0x72, 0xCA, 0xB5, 0x17, 0x7E, 0x55, 0xFE, 0xFA, 0xCB, 0x2D, 0x2C, 0xCB, 0xA7, 0x96,
+    0xB5, 0xED, 0xF9, 0xF6, 0x87, 0x9F, 0x64, 0xF4, 0x6D, 0x74, 0x87, 0xCB, 0x6E, 0x4A, 0xF4, 0x77,
+    0xCA, 0x0D, 0x09, 0xEF, 0x15, 0x2A, 0x03, 0xDD, 0x9C, 0x57, 0x30, 0x25, 0x83, 0xEC, 0x32, 0xD4,
+    0x35, 0x73, 0x3C, 0xDD, 0xEA, 0xCE, 0x82, 0x7C, 0x7B, 0x2C, 0xE4, 0x2A, 0xB5, 0xC6, 0x56, 0x9C,
+    0x33, 0xBB, 0xC6, 0x8B, 0x26, 0x9D, 0x25, 0x41, 0x5E, 0x95, 0xB5, 0x45, 0xAC, 0x25, 0x70, 0x5E,
+    0x04, 0x1A, 0x26, 0x79, 0x66, 0xC9, 0x5D, 0x8A, 0x49, 0x37, 0xC9, 0x11, 0x12, 0xD1, 0x88, 0xFC,
+    0xF7, 0x87, 0x00, 0x0B, 0x0D, 0x12, 0xF4, 0x70, 0x84, 0x6E, 0xDC, 0xBA, 0xCA, 0xB8, 0x79, 0x0D,
+    0xB2, 0x97, 0xF2, 0x26, 0x52, 0x35, 0xE8, 0x8F, 0x8D, 0x29, 0x24, 0xD2, 0xA4, 0x61, 0x44, 0x46,
+    0x7B, 0xEF, 0x88, 0xD7, 0x1B, 0x5A, 0x50, 0x49, 0x26, 0x36, 0x23, 0x92, 0x88, 0x40, 0xC9, 0xFC,
+    0x61, 0x5C, 0xA7, 0x95, 0xC5, 0x28, 0x13, 0x29, 0x24, 0xF2, 0x51, 0xD6, 0xBA, 0x0D, 0xFC, 0x5D,
+    0x73, 0x29, 0x18, 0xBB, 0x9C, 0x81, 0x3D, 0x73, 0x8D, 0x4C, 0x21, 0xC8, 0x75, 0xDE, 0x59, 0xEE,
+    0x20, 0x1D, 0x69, 0x69, 0x58, 0xC5, 0xDD, 0xB2, 0x67, 0x56, 0x70, 0xE2, 0x99, 0xA5, 0x3F, 0x2C,
+    0xF5, 0x26, 0x3C, 0x28, 0xD9, 0xF3, 0xE6, 0x6A, 0x35, 0x7A, 0x09, 0xE7, 0x75, 0xE8, 0x79, 0xE3,
+    0xF3, 0x3D, 0x2D, 0x9F, 0x0D, 0x7E, 0x0B, 0x23, 0xD4, 0x76, 0x28, 0x31, 0xD0, 0xFA, 0xA8, 0x45,
+    0x0C, 0x5E, 0xA1, 0xDD, 0x79, 0x85, 0xA8, 0x3C, 0x02, 0xB4, 0xFA, 0xAD, 0x06, 0xB3, 0x6E, 0x7A,
+    0x0D, 0x25, 0x15, 0x21, 0x61, 0x97, 0xAA, 0x19, 0xB6, 0xB4, 0xB4, 0x5C, 0xD0, 0x03, 0xF4, 0x01,
+    0xE2, 0x0B, 0xC1, 0xCC, 0x9E, 0x87, 0x2D, 0x8A, 0x1B, 0xFD, 0x30, 0x69, 0xE0, 0x0F, 0x55, 0x54,
+    0xE3, 0x1D, 0xBD, 0x5D, 0x62, 0x42, 0x5A, 0x41, 0xE5, 0x8E, 0xE6, 0xA7, 0x05, 0x76, 0x79, 0xA0,
+    0x43, 0x10, 0x8E, 0xAE, 0x40, 0xFC, 0x17, 0xF0, 0x48, 0x96, 0x76, 0xF9, 0x3F, 0x1C, 0x70, 0xDE,
+    0x65, 0x61, 0xAF, 0x05, 0xC7, 0x9E, 0x39, 0x97, 0x81, 0x1A, 0x3F, 0xA1, 0x46, 0x0A, 0xA0, 0x30,
+    0x82, 0x5D, 0x0F, 0xDE, 0xE4, 0x32, 0x54, 0x09, 0x7E, 0x0C, 0xD8, 0xCD, 0xB4, 0x1B, 0xA1, 0x9B,
+    0xE8, 0xAE, 0x4B, 0x3C, 0x88, 0x46, 0x34, 0xF3, 0x07, 0x6A, 0x5F, 0xB1, 0xEE, 0x39, 0x74, 0x3B,
+    0x75, 0x99, 0x7C, 0xB9, 0x90, 0x59, 0x6B, 0x7E, 0x6C, 0x47, 0x4B, 0xA4, 0x3C, 0x9B, 0xD5, 0xA3,
+    0x84, 0x95, 0xC6, 0x93, 0x5F, 0x21, 0xD3, 0x31, 0xED, 0x8B, 0xE5, 0xDD, 0x4B, 0x77, 0xDD, 0x4E,
+    0xB9, 0x93, 0x89, 0x5B, 0x3E, 0x44, 0xFD, 0xEA, 0x34, 0x96, 0xB9, 0x62, 0xBB, 0xB3, 0x81, 0xB9,
+    0x3B, 0xEB, 0xBE, 0x2F, 0xA5, 0x4E, 0x8B, 0x6E, 0x2B, 0xA5, 0xE5, 0x67, 0x72, 0xBD, 0x91, 0x5C,
+    0xA7, 0x95, 0x04, 0x75, 0x2F, 0x7F, 0x5A, 0xF1, 0x35, 0xB9, 0x55, 0x48, 0xFE, 0x82, 0x9A, 0x1A,
+    0xDF, 0xC6, 0xF8, 0x73, 0xD6, 0xFD, 0x37, 0xBA, 0x57, 0xAC, 0x3B, 0x58, 0xEE, 0xD3, 0xA1, 0xD8,
+    0xC8, 0x74, 0x82, 0x71, 0x86, 0x59, 0xBD, 0x42, 0xF4, 0x54, 0xA7, 0x9D, 0xCF, 0xE7, 0xC4, 0x07,
+    0x47, 0x54, 0x8F, 0x6A, 0x37, 0x7F, 0xD6, 0x41, 0x8C, 0x7C, 0xAB, 0x22, 0xAA, 0x4D, 0xB4, 0x2A,
+    0x42, 0x13, 0x01, 0x85, 0xF7, 0xAE, 0x8A, 0xD9, 0xF0, 0xFF, 0x0B, 0x4E, 0xA7, 0x22, 0x9E, 0x44,
+    0xA5, 0x22, 0x31, 0x91, 0x16, 0x14, 0xD8, 0xE7, 0x91, 0xF5, 0x7B, 0x30, 0xA1, 0xB9, 0x3B, 0xDB,
+    0x51, 0x11, 0x4C, 0x61, 0x9F, 0xD7, 0xF2, 0xF5, 0x02, 0xE4, 0x1B, 0xE0, 0x07, 0xCB, 0x24, 0x9F,
+    0xEA, 0x50, 0xAE, 0x75, 0xEB, 0x5D, 0x2D, 0x82, 0xA5, 0xBE, 0x0A, 0xFA, 0x60, 0xA1, 0x55, 0x5B,
+    0xAB, 0x05, 0xB6, 0x6D, 0x98, 0x52, 0x5C, 0x33, 0x1B, 0x49, 0xCC, 0x1F, 0x56, 0x18, 0xD4, 0x78,
+    0xA6, 0x25, 0x7C, 0x16, 0x9A, 0xA0, 0xCB, 0x90, 0xBC, 0xCC, 0x5F, 0x84, 0x4F, 0xA2, 0x24, 0x4A,
+    0x7D, 0x08, 0xC1, 0x5A, 0x16, 0x37, 0xB3, 0xCF, 0x2B, 0x8E, 0x0C, 0xB6, 0x21, 0xC2, 0x7E, 0x3D,
+    0x01, 0x69, 0xF1, 0x5D, 0x9F, 0xE0, 0xA5, 0x87, 0x52, 0xB0, 0xD0, 0x7C, 0xF5, 0x32, 0xF9, 0xDA,
+    0x93, 0x2A, 0x4E, 0x32, 0x88, 0x09, 0x93, 0x20, 0x70, 0xF3, 0xAD, 0x03, 0x6F, 0xB7, 0x47, 0x65,
+    0x27, 0xCE, 0x38, 0x9B, 0x72, 0x89, 0x50, 0x4B, 0x26, 0x8B, 0x65, 0xCF, 0xE0, 0xB3, 0xA2, 0x68,
+    0x25, 0x3A, 0xAE, 0x0E, 0x92, 0xC1, 0x09, 0x13, 0x32, 0x79, 0xD8, 0xED, 0xEC, 0x58, 0x6C, 0x2F,
+    0xA9, 0x00, 0x98, 0x4E, 0xA3, 0x4B, 0x37, 0x8A, 0x6C, 0xF2, 0x6D, 0xED, 0x44, 0x1A, 0xDC, 0x84,
+    0x19, 0xF2, 0x36, 0x3E, 0x68, 0x82, 0x5A, 0x27, 0x65, 0xD1, 0x35, 0x5E, 0xC2, 0xD2, 0xC2, 0xBF,
+    0xBC, 0x0E, 0xF7, 0xC6, 0xCE, 0x3D, 0x41, 0x2F, 0x03, 0x60, 0x19, 0x67, 0x80, 0xB0, 0xDC, 0xD2,
+    0xA4, 0xD7, 0x1C, 0xD2, 0x12, 0x8C, 0x7C, 0x2C, 0x74, 0xEE, 0x73, 0xBA, 0x10, 0x21, 0x51, 0x66,
+    0x0B, 0x22, 0x1D, 0x36, 0x21, 0xD1, 0xCA, 0x34, 0x0C, 0x4B, 0xAA, 0xB3, 0x30, 0x31, 0x30, 0xF2,
+    0x14, 0xF5, 0xA3, 0x36, 0x57, 0xB3, 0x5A, 0x0D, 0xDE, 0xA8, 0x49, 0x1A, 0xDD, 0xCC, 0xB8, 0x55,
+    0xB3, 0xA3, 0x4E, 0xB3, 0x27, 0x34, 0x36, 0xAB, 0x78, 0x92, 0x17, 0xB3, 0xD1, 0x80, 0x8E, 0x76,
+    0x60, 0x0E, 0xEC, 0xC6, 0xB6, 0xFB, 0xA7, 0xA4, 0x80, 0x6B, 0xCC, 0x8B, 0xA1, 0xBA, 0x42, 0x1D,
+    0x59, 0x5B, 0x63, 0xAE, 0x2A, 0xC6, 0x54, 0x61, 0xB5, 0x8E, 0x99, 0x02, 0xE4, 0x27, 0x2A, 0x6B,
+    0x71, 0x8A, 0x55, 0x22, 0x53, 0x2F, 0x70, 0x32, 0xE5, 0x03, 0x4E, 0x49, 0x8E, 0x82, 0x8E, 0x42,
+    0x9E, 0x57, 0x2A, 0x7E, 0xDD, 0x63, 0x7B, 0xC8, 0x1F, 0x5E, 0xD2, 0xA8, 0x5C, 0x68, 0x50, 0x72,
+    0x60, 0xCE, 0x81, 0xC7, 0xB8, 0xC5, 0x92, 0x3E, 0x4D, 0xAD, 0x8F, 0xC4, 0xB6, 0x65, 0x07, 0xF9,
+    0xBB, 0xB6, 0x65, 0xB5, 0xE2, 0x4E, 0xF9, 0x83, 0xD4, 0x49, 0x9F, 0x13, 0xAB, 0xDE, 0xEE, 0xB2,
+    0xB3, 0x5F, 0xCB, 0xA3, 0x6A, 0x49, 0xB2, 0xA6, 0x44, 0x90, 0xD3, 0x17, 0xAF, 0x86, 0x96, 0x36,
+    0x47, 0x64, 0xF0, 0xFA, 0xE9, 0x83, 0x4E, 0x8B, 0xA4, 0x91, 0x23, 0xE3, 0xFA, 0x0C, 0xAB, 0xD8,
+    0x78, 0x0E, 0xF0, 0x7D, 0x9A, 0x07, 0x62, 0xEA, 0x21, 0xB2, 0xC2, 0x29, 0xED, 0x0A, 0x99, 0x26,
+    0x44, 0x92, 0x2D, 0x7B, 0xB2, 0xEC, 0xE5, 0xAB, 0x5E, 0xB9, 0xEA, 0x8D, 0xCB, 0x53, 0x0A, 0xF9,
+    0x67, 0x54, 0x3F, 0x82, 0x40, 0x12, 0xCD, 0x7E, 0x56, 0x05, 0xE6, 0x61, 0x72, 0xBD, 0xC5, 0xA9,
+    0x86, 0x6C, 0x2D, 0x3D, 0x53, 0x61, 0x41, 0xE6, 0x1F, 0x50, 0x0F, 0xFF, 0x7D, 0xCA, 0x58, 0x8F,
+    0x8A, 0xA0, 0x3E, 0xB9, 0xDD, 0x20, 0x41, 0xA3, 0x22, 0xAC, 0x1E, 0x47, 0xC0, 0x07, 0x6D, 0x8C,
+    0xB7, 0x8F, 0x47, 0x57, 0xE1, 0xB8, 0xA4, 0x8E, 0xB3, 0xCD, 0x97, 0xC2, 0xBB, 0xE0, 0x40, 0xF7,
+    0xAF, 0xA1, 0x0E, 0x79, 0x25, 0xCA, 0x45, 0xB2, 0xAC, 0x05, 0xAF, 0xAD, 0xBC, 0x75, 0x75, 0xD5,
+    0x1B, 0xBE, 0xD9, 0x9B, 0x48, 0xF0, 0x92, 0x5D, 0xCA, 0x3E, 0x6F, 0x54, 0x6F, 0x1E, 0xC8, 0x48,
+    0x8F, 0xA9, 0x18, 0x90, 0x02, 0x47, 0xD5, 0xAB, 0x30, 0xA2, 0x40, 0xA9, 0x48, 0xB2, 0xF5, 0xA9,
+    0x49, 0xAD, 0x77, 0x92, 0x6E, 0xDA, 0xE0, 0xB6, 0x6E, 0xD0, 0xCE, 0xF7, 0x69, 0x36, 0x51, 0xE4,
+    0x0B, 0x16, 0xC4, 0xFF, 0x54, 0x53, 0x4C, 0xF8, 0x4A, 0x5C, 0xE0, 0x9D, 0x87, 0x98, 0x64, 0x27,
+    0x18, 0x9D, 0x9B, 0x33, 0x52, 0x48, 0xDF, 0x55, 0x9E, 0x7B, 0xE3, 0x85, 0xC6, 0xBF, 0xFD, 0x57,
+    0xC0, 0xC9, 0x99, 0x21, 0xEC, 0x22, 0xBF, 0xF3, 0xFB, 0xE3, 0x5E, 0xEB, 0x0F, 0x1B, 0x62, 0xD0,
+    0x65, 0x5C, 0x7E, 0xE4, 0xB6, 0x5E, 0x23, 0x0B, 0x7A, 0x4D, 0x70, 0x70, 0xB8, 0x4A, 0xAA, 0x81,
+    0xB7, 0x9A, 0x56, 0xB9, 0x96, 0xDF, 0x31, 0x23, 0x2A, 0x7E, 0x36, 0x65, 0x14, 0x37, 0x24, 0xAD,
+    0x59, 0x1E, 0xA0, 0x9B, 0x66, 0x06, 0x62, 0xCE, 0x19, 0x08, 0xC1, 0xA6, 0xDC, 0x04, 0xE3, 0x9C,
+    0x79, 0x56, 0x6A, 0x0E, 0xCF, 0xDD, 0x7C, 0x5E, 0x5E, 0xF4, 0x26, 0x22, 0xF7, 0xEC, 0x88, 0x12,
+    0xB1, 0x85, 0x94, 0x5D, 0x62, 0x26, 0x93, 0xCE, 0x1F, 0xD6, 0x48, 0xAA, 0x7C, 0x83, 0xDF, 0x60,
+    0xEF, 0xBD, 0xEC, 0xC0, 0xE1, 0xE1, 0x41, 0x61, 0x21, 0x11, 0x3F, 0x00, 0xE1, 0x16, 0xF7, 0x16,
+    0xF8, 0xC8, 0x91, 0xBD, 0xCC, 0x60, 0x71, 0x62, 0xDD, 0xF2, 0xE3, 0x83, 0xC4, 0xB5, 0x54, 0x1B,
+    0x62, 0x5B, 0xA9, 0xFC, 0xE0, 0x26, 0x2B, 0xFA, 0xC2, 0xAF, 0xE0, 0xB6, 0xA8, 0xF5, 0xAB, 0xBC,
+    0x62, 0xD6, 0x16, 0x88, 0x4C, 0x50, 0x82, 0xEC, 0x07, 0xAC, 0x26, 0xA1, 0x18, 0x59, 0x13, 0xAD,
+    0xF7, 0x87, 0xA9, 0x43, 0xA7, 0x0C, 0x36, 0x32, 0x02, 0x8B, 0x34, 0xDC, 0xD0, 0xF3, 0x97, 0x0A,
+    0xE0, 0xD6, 0xE6, 0x7C, 0x9E, 0x41, 0x23, 0xF8, 0xA2, 0x82, 0xB8, 0xBC, 0xBD, 0xA0, 0x7E, 0xE4,
+    0x2E, 0x2A, 0x10, 0x5C, 0x95, 0xD7, 0x68, 0x05, 0x98, 0xD5, 0x09, 0x19, 0xCC, 0x8C, 0xC3, 0xB8,
+    0x38, 0x10, 0x37, 0x18, 0xFC, 0x22, 0xE5, 0x01, 0xF4, 0x42, 0x51, 0x66, 0x06, 0xEA, 0xE6, 0x79,
+    0xCB, 0x75, 0x8B, 0xA3, 0xC3, 0x66, 0xCF, 0xF1, 0x65, 0x48, 0x4D, 0x89, 0x25, 0xF1, 0xC4, 0xEA,
+    0xD2, 0x49, 0xE6, 0x53, 0x00, 0x7E, 0x65, 0x72, 0xF6, 0xA9, 0x49, 0xFF, 0xE6, 0x54, 0xD9, 0xCF,
+    0x9B, 0x8C, 0x7D, 0x0B, 0xDE, 0x4D, 0x05, 0xBC, 0xA3, 0xF3, 0xAB, 0xCF, 0x2D, 0x50, 0x42, 0xF2,
+    0x69, 0xBF, 0x8E, 0x3E, 0xF7, 0xC9, 0xB3, 0xFC, 0x5D, 0x82, 0xCA, 0x60, 0x3D, 0x2A, 0x0C, 0xD8,
+    0x63, 0x8D, 0x1E, 0xDB, 0x56, 0x57, 0xCC, 0x26, 0xC9, 0x28, 0xD2, 0x43, 0xA3, 0xDF, 0x18, 0xDC,
+    0x05, 0x95, 0x49, 0x12, 0x1A, 0x96, 0x94, 0x64, 0xDA, 0xAF, 0xD3, 0x93, 0x1C, 0x95, 0x52, 0x63,
+    0xD7, 0xDE, 0xC6, 0xCF, 0x7D, 0x6C, 0x5B, 0x27, 0xA9, 0x5B, 0xAC, 0xD2, 0x25, 0x70, 0x1F, 0x2B,
+    0x8E, 0x71, 0xA9, 0x91, 0x47, 0x17, 0x28, 0x09, 0xAF, 0x21, 0x87, 0x63, 0x3D, 0xE7, 0xC1, 0x9F,
+    0xDE, 0xC5, 0xC9, 0xF2, 0xA4, 0x36, 0x7E, 0x7E, 0x68, 0x67, 0x67, 0xC7, 0x7D, 0xAC, 0x88, 0xDC,
+    0x7B, 0x88, 0xB6, 0xFB, 0x5B, 0x2C, 0x58, 0xF5, 0xF2, 0x94, 0x1E, 0xB3, 0x9B, 0x28, 0x5E, 0x6B,
+    0xD8, 0x56, 0xBE, 0xDA, 0x13, 0xF6, 0xFB, 0x61, 0xF6, 0xF5, 0xF6, 0x65, 0xD4, 0x7D, 0xB2, 0x6F,
+    0x8C, 0xDC, 0x6E, 0x97, 0x07, 0xEB, 0xC4, 0xCE, 0xB1, 0xF3, 0x49, 0x53, 0x63, 0x1A, 0xB5, 0x81,
+    0xA7, 0x9E, 0xBB, 0x09, 0xD6, 0xE5, 0xF9, 0x5F, 0x80, 0x16, 0x2C, 0x82, 0xF3, 0x0B, 0x4C, 0x14,
+    0x3E, 0xC9, 0x58, 0x88, 0x90, 0x7F, 0x38, 0xD2, 0x79, 0x38, 0xD3, 0x71, 0x2B, 0x61, 0xD0, 0x71,
+    0x0D, 0xAD, 0x93, 0x1A, 0x59, 0x1B, 0xBA, 0x22, 0xD3, 0xBE, 0xC5, 0x59, 0x85, 0xCC, 0xF6, 0xAC,
+    0x46, 0xD5, 0xAE, 0xBA, 0xAB, 0xDD, 0x6F, 0x3D, 0xA5, 0x60, 0x5C, 0x10, 0x1C, 0xBD, 0xA2, 0xF5,
+    0xBE, 0xB2, 0x08, 0x5E, 0xB6, 0x44, 0x5D, 0x90, 0x3D, 0x2A, 0xC1, 0x22, 0xCC, 0x5E, 0x85, 0xD1,
+    0x6F, 0xF1, 0x80, 0x92, 0x6B, 0x0C, 0x85, 0xCA, 0x20, 0x65, 0x3D, 0xDB, 0xAF, 0x04, 0x7A, 0xB1,
+    0x11, 0x36, 0x2C, 0xAE, 0xE0, 0xD5, 0x8D, 0x51, 0x36, 0xA2, 0x0E, 0x91, 0x3B, 0xA9, 0x48, 0x09,
+    0xD2, 0x22, 0xD1, 0x16, 0xFB, 0x67, 0x7E, 0xD3, 0x96, 0xC7, 0xCA, 0x52, 0x31, 0x64, 0x54, 0x38,
+    0x31, 0x30, 0xD6, 0xD6, 0xD3, 0xD4, 0x26, 0x37, 0xF2, 0x7B, 0xE5, 0x44, 0x9D, 0x52, 0xA2, 0x96,
+    0x90, 0x18, 0xB6, 0xCA, 0x8B, 0x1A, 0xA5, 0x45, 0xF5, 0xC1, 0x05, 0xE3, 0x03, 0x0B, 0x72, 0x47,
+    0x71, 0x16, 0x1D, 0xDF, 0x46, 0x6D, 0x08, 0xEC, 0x58, 0x32, 0xDF, 0x07, 0xD1, 0x98, 0x51, 0x31,
+    0x5D, 0x0E, 0xF5, 0x7A, 0xD2, 0x54, 0x2A, 0x85, 0x7F, 0x50, 0x14, 0x5A, 0x82, 0x94, 0x23, 0xE6,
+    0x1E, 0xB2, 0x53, 0xD0, 0x12, 0x1F, 0x8C, 0xBA, 0x26, 0xFD, 0x74, 0x5A, 0xD5, 0xFA, 0xAA, 0x71,
+    0xA3, 0x37, 0x16, 0x7A, 0xB0, 0x60, 0x88, 0xD4, 0xFB, 0xA9, 0x63, 0x87, 0x20, 0x0B, 0x0C, 0xF8,
+    0x30, 0xBE, 0x75, 0xFB, 0x7C, 0x2F, 0x3F, 0xDC, 0xBB, 0xF7, 0x61, 0x27, 0x3F, 0xFD, 0xE2, 0xA3,
+    0x9B, 0xAD, 0xFC, 0xEE, 0x83, 0x1B, 0xB7, 0x1B, 0xF9, 0xD9, 0x8D, 0x1B, 0x60, 0x6E, 0xC9, 0x9D,
+    0x5B, 0xA3, 0x32, 0x48, 0xCC, 0x19, 0xBC, 0xF9, 0x96, 0x5E, 0x64, 0x11, 0x34, 0xC2, 0x88, 0xF9,
+    0xBA, 0xB6, 0xF6, 0xD0, 0x44, 0x33, 0x5D, 0x11, 0x98, 0xF7, 0xBE, 0xF1, 0xC4, 0x7A, 0x2D, 0xA3,
+    0xBE, 0x45, 0x7A, 0xE4, 0xF8, 0x21, 0xBB, 0xDF, 0x44, 0x18, 0x8C, 0xE8, 0x5D, 0xD6, 0x76, 0x17,
+    0x0E, 0x3E, 0xB5, 0xBC, 0x7B, 0x51, 0xF2, 0x29, 0x96, 0xBE, 0x56, 0x77, 0x8C, 0xCC, 0x85, 0x07,
+    0x5A, 0x03, 0x4C, 0xAB, 0x9F, 0x0F, 0xD0, 0xBB, 0xCA, 0x92, 0xC5, 0x10, 0x73, 0x75, 0xCD, 0xC2,
+    0x3C, 0x1E, 0x7D, 0xA5, 0x4E, 0x86, 0xA7, 0x9A, 0x04, 0x3A, 0x15, 0x18, 0xED, 0xDA, 0xFC, 0xF9,
+    0xFB, 0x5B, 0x4C, 0xAC, 0x56, 0x7B, 0xD3, 0x0B, 0x5D, 0x82, 0xF3, 0x91, 0x23, 0xBD, 0xC8, 0x2B,
+    0xC7, 0x12, 0x55, 0xC3, 0x2E, 0x71, 0x74, 0x19, 0x4D, 0x4C, 0x9B, 0xA8, 0x37, 0x34, 0xB5, 0xBA,
+    0x35, 0x91, 0x43, 0x1B, 0xA8, 0xB0, 0x6C, 0x6C, 0xD5, 0x98, 0xB8, 0x96, 0x39, 0x05, 0xF1, 0xA4,
+    0xD9, 0xD7, 0x3B, 0x39, 0x78, 0xCB, 0xF8, 0x84, 0x1E, 0xA3, 0x74, 0xFA, 0x52, 0x2F, 0x13, 0x6D,
+    0xB8, 0x95, 0xB6, 0xE1, 0x10, 0x3E, 0x78, 0x7D, 0xC8, 0x95, 0x6B, 0x1A, 0xCD, 0xCA, 0x1E, 0x51,
+    0x22, 0x85, 0x84, 0x01, 0x26, 0x96, 0xD5, 0xEC, 0x8C, 0xC2, 0x08, 0x68, 0x06, 0x68, 0x69, 0x64,
+    0x6D, 0x4D, 0xC4, 0x22, 0x5B, 0xD1, 0x58, 0x02, 0x6A, 0xD9, 0xED, 0x58, 0x5E, 0xA1, 0x32, 0xC2,
+    0x51, 0xA4, 0xA6, 0x0E, 0x38, 0xB5, 0x84, 0xA7, 0x89, 0x0D, 0x73, 0xD9, 0x57, 0x09, 0x75, 0xD2,
+    0xE9, 0xA5, 0x4F, 0xAB, 0x6D, 0xEF, 0xFF, 0x0B, 0xD1, 0x50, 0xAA, 0x37, 0x53, 0xB7, 0xF7, 0x1B,
+    0x27, 0x87, 0xDE, 0xCC, 0x78, 0x01, 0x1B, 0x66, 0x84, 0xD1, 0x88, 0xB7, 0x1A, 0xDA, 0x66, 0x72,
+    0xF8, 0xC8, 0x11, 0xAC, 0x75, 0xFC, 0xEC, 0x2E, 0x60, 0x35, 0x19, 0x3B, 0x90, 0x82, 0xB4, 0x5C,
+    0xC0, 0x59, 0xE7, 0xD6, 0x11, 0xB6, 0x5E, 0xFF, 0x1D, 0xD0, 0x02, 0x3D, 0xE9, 0xCA, 0x69, 0xBD,
+    0x87, 0x39, 0x6B, 0xB7, 0x31, 0x20, 0x06, 0x19, 0x4F, 0x98, 0x33, 0xAC, 0x76, 0x4E, 0x8F, 0x8F,
+    0xE9, 0x2F, 0xB9, 0x6B, 0xF1, 0x74, 0x9A, 0xE9, 0xA6, 0x43, 0xBE, 0x3E, 0x5B, 0x07, 0xCB, 0xA0,
+    0x67, 0x35, 0xC2, 0xB3, 0xD2, 0xA1, 0xB0, 0x25, 0xDE, 0x25, 0xAD, 0x9C, 0x89, 0x02, 0x97, 0xE7,
+    0xCE, 0xBC, 0xB1, 0xE0, 0xA6, 0x87, 0x99, 0xD3, 0xB3, 0x03, 0x73, 0x29, 0x2D, 0x22, 0xEE, 0x68,
+    0x09, 0xA5, 0x13, 0xDE, 0x1D, 0x3E, 0x06, 0x4F, 0x79, 0x44, 0xAE, 0xB8, 0xF2, 0x79, 0x7D, 0x13,
+    0xF3, 0x1E, 0x6A, 0x03, 0xEF, 0x02, 0x82, 0x17, 0x58, 0x70, 0x0B, 0xF4, 0xC2, 0x47, 0x0D, 0xA2,
+    0x57, 0x2F, 0x8E, 0x51, 0x04, 0xB3, 0x98, 0x00, 0xC6, 0xCB, 0x4C, 0xE8, 0x50, 0x1A, 0x84, 0xF1,
+    0xFE, 0x09, 0x36, 0xC0, 0x4B, 0x99, 0xCF, 0x09, 0x73, 0x51, 0x41, 0xB8, 0xFA, 0x6C, 0x75, 0x31,
+    0x91, 0x17, 0xC7, 0xC8, 0xF0, 0xF4, 0xC8, 0x95, 0x6A, 0xE1, 0xC8, 0x35, 0x80, 0x4A, 0x6D, 0x47,
+    0xFD, 0xB7, 0xE0, 0x3F, 0x4F, 0xEF, 0x19, 0x78, 0x64, 0xEF, 0x48, 0xCC, 0xB0, 0x3A, 0x2F, 0x57,
+    0x0A, 0x4F, 0xF7, 0x81, 0x1C, 0xA3, 0xF8, 0x96, 0xE4, 0x38, 0x74, 0xE9, 0xEE, 0x3B, 0xBA, 0x54,
+    0xF7, 0xE0, 0x09, 0x68, 0x0A, 0xB5, 0xDC, 0xCE, 0x32, 0x99, 0x52, 0xEB, 0xBB, 0x07, 0xA9, 0xF5,
+    0xA3, 0x7A, 0x27, 0x7C, 0x42, 0xEF, 0x84, 0x4F, 0xBD, 0xAC, 0x63, 0x47, 0xAB, 0xD9, 0x84, 0xE6,
+    0xF6, 0x73, 0x2C, 0x34, 0xEE, 0xFE, 0x89, 0xA7, 0xAD, 0xBF, 0xDD, 0xE4, 0x61, 0xF0, 0xA3, 0x1B,
+    0x8C, 0xB2, 0x3B, 0x2C, 0x20, 0xBF, 0xBF, 0xC1, 0xA2, 0xF8, 0x73, 0xB6, 0xF9, 0x53, 0x17, 0x18,
+    0xC4, 0x3E, 0xEF, 0xBE, 0x9D, 0xB7, 0xB6, 0x3A, 0x3D, 0xFD, 0xAF, 0xB6, 0x5C, 0x9E, 0xAA, 0x56,
+    0x7A, 0x1A, 0x25, 0xB2, 0x20, 0x99, 0x6E, 0x6A, 0x88, 0x78, 0xA9, 0x62, 0xCD, 0x7E, 0xAB, 0x63,
+    0x37, 0xEC, 0x36, 0xFB, 0x15, 0xB6, 0xAF, 0x5C, 0xD6, 0xDB, 0x0E, 0xBD, 0x5A, 0xD1, 0xC2, 0xEB,
+    0x9E, 0x74, 0x7A, 0xA7, 0x41, 0x6C, 0x70, 0x3A, 0xC7, 0xC8, 0x0C, 0x44, 0xF5, 0x8F, 0xC9, 0xA1,
+    0x99, 0xCD, 0x56, 0x84, 0xD1, 0x22, 0x18, 0xE0, 0x5B, 0x5E, 0x85, 0x74, 0xC1, 0xB0, 0x34, 0x3A,
+    0x52, 0x0C, 0x04, 0xC2, 0xF7, 0x7A, 0xAA, 0x5D, 0x10, 0x00, 0x08, 0x0D, 0x89, 0x51, 0x45, 0x6B,
+    0x0B, 0xB6, 0xBC, 0xD0, 0xA7, 0x2D, 0x04, 0x03, 0xBB, 0x2F, 0x73, 0x84, 0x08, 0xFC, 0x9A, 0x37,
+    0x38, 0x66, 0xB1, 0x58, 0xA1, 0x21, 0x03, 0xF0, 0x2F, 0xEC, 0xFF, 0xAF, 0x81, 0xF0, 0x69, 0x8D,
+    0x56, 0x02, 0xEA, 0x7F, 0x01, 0xD3, 0x5A, 0xB5, 0xC2, 0xFE, 0xFF, 0x8F, 0xFA, 0xFF, 0x5F, 0x18,
+    0x18, 0x18, 0x00, 0x75, 0x90, 0xB1, 0x71, 0x85, 0x30, 0x10, 0x44, 0x57, 0xE0, 0x19, 0x02, 0x02,
+    0x22, 0x47, 0x0E, 0x7E, 0x05, 0x1E, 0x3A, 0xB0, 0xE4, 0x0E, 0x9C, 0xB8, 0x0A, 0x07, 0xBF, 0x04,
+    0xA8, 0xC2, 0xDD, 0x78, 0xA0, 0x04, 0x4A, 0xA0, 0x04, 0x02, 0x02, 0xFE, 0x8C, 0xC4, 0x79, 0xEF,
+    0x0E, 0x87, 0x56, 0xC0, 0x1B, 0x24, 0xB8, 0x7D, 0x5A, 0x00, 0x78, 0x79, 0x40, 0x57, 0x10, 0x59,
+    0x94, 0xED, 0xDE, 0x6C, 0xCA, 0xDB, 0x5C, 0x1D, 0xCA, 0x38, 0x86, 0xAC, 0x1C, 0xE0, 0x9C, 0x2E,
+    0x9E, 0xA8, 0xED, 0xBC, 0xF0, 0x0F, 0xFD, 0xBD, 0x60, 0x12, 0x6E, 0x84, 0xCC, 0x41, 0xDC, 0xA8,
+    0x32, 0xBA, 0x95, 0xFB, 0xFC, 0xC8, 0xB9, 0xA3, 0xD3, 0xF9, 0x1C, 0x7E, 0x9B, 0x35, 0x66, 0x43,
+    0xAF, 0xEC, 0x36, 0x26, 0x28, 0x57, 0xC4, 0xA4, 0x5C, 0x98, 0x64, 0xF1, 0x4E, 0x7E, 0x34, 0xB9,
+    0x06, 0x13, 0x9D, 0xC5, 0x98, 0xF0, 0x8F, 0x16, 0xCE, 0x2A, 0xA9, 0x16, 0x44, 0x46, 0xDB, 0x8C,
+    0xC5, 0x74, 0x10, 0x92, 0x13, 0xAE, 0x63, 0xCB, 0xEF, 0x4A, 0x9D, 0xD5, 0xD9, 0xCD, 0x4E, 0x73,
+    0x22, 0xCE, 0xEB, 0xF5, 0x3A, 0xD6, 0xF5, 0xE5, 0x7D, 0x35, 0x57, 0x5F, 0x71, 0xF1, 0x59, 0xB4,
+    0xFC, 0x13, 0x28, 0xDE, 0x07, 0x7E, 0x94, 0xD9, 0xDF, 0xF9, 0x30, 0xC1, 0xCF, 0x82, 0x9A, 0x6C,
+    0x45, 0x70, 0x97, 0x8C, 0xF8, 0x2D, 0xF4, 0xCC, 0x3C, 0x1D, 0x52, 0xB3, 0x23, 0x1C, 0xBC, 0x18,
+    0x9D, 0x58, 0x7D, 0xAF, 0x15, 0x51, 0xF7, 0x49, 0xAB, 0xA9, 0x8A, 0x57, 0x03, 0x5E, 0xC9, 0xFA,
+    0x9B, 0x0E, 0xAB, 0x06, 0xBD, 0x24, 0x63, 0x4D, 0x19, 0x73, 0x1E, 0x76, 0xEF, 0xB1, 0x3D, 0xBC,
+    0x3F, 0x86, 0xD1, 0xEC, 0x55, 0xC3, 0xC9, 0x37, 0x4D, 0xA0, 0x61, 0x44, 0xB5, 0x1B, 0x47, 0x86,
+    0x4D, 0xEF, 0x63, 0xF7, 0xB8, 0xB3, 0x6F, 0x99, 0x2B, 0x61, 0x50, 0xCF, 0x83, 0x67, 0xCE, 0x08,
+    0x1F, 0xF8, 0x05, 0x4D, 0x90, 0xB1, 0x0D, 0x83, 0x30, 0x14, 0x44, 0x0F, 0x53, 0x50, 0xD0, 0xA6,
+    0x77, 0x36, 0x60, 0x04, 0xCA, 0x8C, 0x90, 0x55, 0xD2, 0xC1, 0x26, 0x59, 0x24, 0x12, 0x8C, 0x90,
+    0x11, 0x18, 0x81, 0x22, 0x05, 0x52, 0x88, 0x2F, 0x77, 0x36, 0x91, 0xE2, 0xE2, 0xFB, 0xC9, 0x7A,
+    0xFF, 0xFE, 0x97, 0x81, 0xBF, 0x73, 0x3B, 0xEE, 0x2A, 0x1D, 0xD0, 0x70, 0x2C, 0x10, 0xB9, 0x14,
+    0x18, 0xB8, 0x15, 0x85, 0x4C, 0x87, 0xC2, 0x22, 0xC5, 0x27, 0xBA, 0x2C, 0x0D, 0x38, 0xD5, 0x96,
+    0xAA, 0x0F, 0x12, 0x2C, 0x35, 0x7B, 0x45, 0x0C, 0x92, 0x62, 0x0A, 0x44, 0xBF, 0x38, 0xE5, 0x2D,
+    0xD8, 0x9C, 0x42, 0x41, 0xCA, 0x29, 0x09, 0x13, 0xC7, 0x28, 0xD8, 0x41, 0x2E, 0xBD, 0xE0, 0x55,
+    0x93, 0x5B, 0xE7, 0x01, 0x7A, 0x5E, 0x5B, 0x81, 0x1B, 0xE6, 0xA0, 0x52, 0xBB, 0x51, 0x0D, 0xBC,
+    0xD8, 0x87, 0xA4, 0xBB, 0x14, 0xC0, 0x92, 0x14, 0x20, 0x64, 0xF0, 0x3E, 0x53, 0xAA, 0xAD, 0x48,
+    0xD2, 0x1E, 0xAB, 0xA1, 0xD5, 0x84, 0xD9, 0x10, 0xBC, 0x59, 0x3E, 0xD3, 0x75, 0x2F, 0xD0, 0x15,
+    0xC5, 0x49, 0x73, 0x81, 0xC0, 0xDF, 0xFF, 0x3C, 0x7E, 0x70, 0x76, 0xF9, 0x02,
 };
 
 static const EpdGlyph notoserif_18_italicGlyphs[] = {
@@ -3326,99 +3333,99 @@ static const EpdGlyph notoserif_18_italicGlyphs[] = {
     { 0, 0, 156, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 156, 0, 0, 0, 0 }, // U+0020
     { 10, 28, 200, 2, 27, 70, 0 }, // !
-    { 13, 10, 245, 4, 27, 33, 70 }, // "
-    { 21, 27, 335, 0, 27, 142, 103 }, // #
-    { 20, 32, 335, 0, 29, 160, 245 }, // $
-    { 30, 29, 538, 2, 28, 218, 405 }, // %
-    { 28, 29, 445, 1, 28, 203, 623 }, // &
-    { 6, 10, 132, 4, 27, 15, 826 }, // '
-    { 15, 34, 208, 1, 29, 128, 841 }, // (
-    { 14, 35, 208, -2, 29, 123, 969 }, // )
-    { 17, 16, 300, 4, 29, 68, 1092 }, // *
-    { 17, 17, 335, 2, 22, 73, 1160 }, // +
-    { 8, 11, 150, -2, 5, 22, 1233 }, // ,
-    { 11, 4, 186, 0, 12, 11, 1255 }, // -
-    { 6, 6, 150, 0, 5, 9, 1266 }, // .
-    { 19, 34, 173, -4, 29, 162, 1275 }, // /
-    { 19, 29, 335, 1, 28, 138, 1437 }, // 0
-    { 16, 27, 275, -1, 27, 108, 1575 }, // 1
-    { 21, 28, 335, -1, 28, 147, 1683 }, // 2
-    { 21, 29, 335, -1, 28, 153, 1830 }, // 3
-    { 21, 27, 335, -1, 27, 142, 1983 }, // 4
-    { 20, 28, 335, 0, 27, 140, 2125 }, // 5
-    { 19, 29, 335, 2, 28, 138, 2265 }, // 6
-    { 19, 27, 335, 3, 27, 129, 2403 }, // 7
-    { 20, 29, 335, 0, 28, 145, 2532 }, // 8
-    { 19, 29, 335, 1, 28, 138, 2677 }, // 9
-    { 9, 22, 172, 1, 21, 50, 2815 }, // :
-    { 11, 27, 172, -1, 21, 75, 2865 }, // ;
-    { 17, 19, 335, 2, 23, 81, 2940 }, // <
-    { 17, 11, 335, 2, 19, 47, 3021 }, // =
-    { 17, 19, 335, 2, 23, 81, 3068 }, // >
-    { 16, 29, 300, 4, 28, 116, 3149 }, // ?
-    { 31, 33, 553, 2, 27, 256, 3265 }, // @
-    { 28, 27, 423, -3, 27, 189, 3521 }, // A
-    { 25, 27, 392, -1, 27, 169, 3710 }, // B
-    { 24, 29, 376, 1, 28, 174, 3879 }, // C
-    { 28, 27, 435, -1, 27, 189, 4053 }, // D
-    { 25, 27, 374, -1, 27, 169, 4242 }, // E
-    { 25, 27, 354, -1, 27, 169, 4411 }, // F
-    { 26, 29, 428, 1, 28, 189, 4580 }, // G
-    { 33, 27, 476, -1, 27, 223, 4769 }, // H
-    { 17, 27, 220, -1, 27, 115, 4992 }, // I
-    { 22, 36, 214, -6, 27, 198, 5107 }, // J
-    { 30, 27, 420, -1, 27, 203, 5305 }, // K
-    { 23, 27, 374, -1, 27, 156, 5508 }, // L
-    { 39, 27, 563, -1, 27, 264, 5664 }, // M
-    { 33, 27, 458, -1, 27, 223, 5928 }, // N
-    { 26, 29, 445, 1, 28, 189, 6151 }, // O
-    { 25, 27, 372, -1, 27, 169, 6340 }, // P
-    { 26, 37, 445, 1, 28, 241, 6509 }, // Q
-    { 25, 27, 398, -1, 27, 169, 6750 }, // R
-    { 21, 29, 326, 0, 28, 153, 6919 }, // S
-    { 24, 27, 368, 2, 27, 162, 7072 }, // T
-    { 27, 28, 438, 3, 27, 189, 7234 }, // U
-    { 26, 27, 405, 3, 27, 176, 7423 }, // V
-    { 40, 27, 627, 3, 27, 270, 7599 }, // W
-    { 30, 27, 396, -2, 27, 203, 7869 }, // X
-    { 25, 27, 375, 2, 27, 169, 8072 }, // Y
-    { 25, 27, 363, -1, 27, 169, 8241 }, // Z
-    { 16, 34, 216, 0, 29, 136, 8410 }, // [
-    { 5, 34, 173, 4, 29, 43, 8546 }, // <backslash>
-    { 16, 34, 216, -2, 29, 136, 8589 }, // ]
-    { 19, 18, 335, 1, 27, 86, 8725 }, // ^
-    { 19, 3, 275, -4, -3, 15, 8811 }, // _
-    { 7, 7, 167, 5, 29, 13, 8826 }, // `
-    { 21, 22, 347, 1, 21, 116, 8839 }, // a
-    { 19, 30, 337, 1, 29, 143, 8955 }, // b
-    { 18, 22, 292, 1, 21, 99, 9098 }, // c
-    { 21, 30, 347, 1, 29, 158, 9197 }, // d
-    { 17, 22, 296, 1, 21, 94, 9355 }, // e
-    { 25, 38, 191, -6, 29, 238, 9449 }, // f
-    { 25, 31, 334, -2, 22, 194, 9687 }, // g
-    { 21, 30, 359, 1, 29, 158, 9881 }, // h
-    { 9, 30, 182, 2, 29, 68, 10039 }, // i
-    { 17, 38, 175, -6, 29, 162, 10107 }, // j
-    { 22, 30, 341, 1, 29, 165, 10269 }, // k
-    { 10, 30, 182, 2, 29, 75, 10434 }, // l
-    { 32, 22, 538, 1, 21, 176, 10509 }, // m
-    { 21, 22, 359, 1, 21, 116, 10685 }, // n
-    { 19, 22, 344, 1, 21, 105, 10801 }, // o
-    { 22, 30, 346, -1, 21, 165, 10906 }, // p
-    { 20, 30, 336, 1, 21, 150, 11071 }, // q
-    { 17, 21, 281, 1, 21, 90, 11221 }, // r
-    { 17, 22, 278, 0, 21, 94, 11311 }, // s
-    { 12, 26, 221, 2, 25, 78, 11405 }, // t
-    { 20, 22, 359, 2, 21, 110, 11483 }, // u
-    { 19, 22, 323, 0, 21, 105, 11593 }, // v
-    { 29, 22, 491, 1, 21, 160, 11698 }, // w
-    { 22, 21, 328, -1, 21, 116, 11858 }, // x
-    { 26, 30, 317, -7, 21, 195, 11974 }, // y
-    { 19, 21, 307, -1, 21, 100, 12169 }, // z
-    { 17, 34, 257, 2, 29, 145, 12269 }, // {
-    { 3, 38, 335, 9, 29, 29, 12414 }, // |
-    { 17, 34, 257, -2, 29, 145, 12443 }, // }
-    { 17, 7, 335, 2, 17, 30, 12588 }, // ~
+    { 13, 10, 245, 4, 27, 33, 0 }, // "
+    { 21, 27, 335, 0, 27, 142, 33 }, // #
+    { 20, 32, 335, 0, 29, 160, 175 }, // $
+    { 30, 29, 538, 2, 28, 218, 335 }, // %
+    { 28, 29, 445, 1, 28, 203, 553 }, // &
+    { 6, 10, 132, 4, 27, 15, 756 }, // '
+    { 15, 34, 208, 1, 29, 128, 70 }, // (
+    { 14, 35, 208, -2, 29, 123, 198 }, // )
+    { 17, 16, 300, 4, 29, 68, 771 }, // *
+    { 17, 17, 335, 2, 22, 73, 839 }, // +
+    { 8, 11, 150, -2, 5, 22, 321 }, // ,
+    { 11, 4, 186, 0, 12, 11, 343 }, // -
+    { 6, 6, 150, 0, 5, 9, 354 }, // .
+    { 19, 34, 173, -4, 29, 162, 912 }, // /
+    { 19, 29, 335, 1, 28, 138, 363 }, // 0
+    { 16, 27, 275, -1, 27, 108, 501 }, // 1
+    { 21, 28, 335, -1, 28, 147, 609 }, // 2
+    { 21, 29, 335, -1, 28, 153, 756 }, // 3
+    { 21, 27, 335, -1, 27, 142, 909 }, // 4
+    { 20, 28, 335, 0, 27, 140, 1051 }, // 5
+    { 19, 29, 335, 2, 28, 138, 1191 }, // 6
+    { 19, 27, 335, 3, 27, 129, 1329 }, // 7
+    { 20, 29, 335, 0, 28, 145, 1458 }, // 8
+    { 19, 29, 335, 1, 28, 138, 1603 }, // 9
+    { 9, 22, 172, 1, 21, 50, 1741 }, // :
+    { 11, 27, 172, -1, 21, 75, 1791 }, // ;
+    { 17, 19, 335, 2, 23, 81, 1074 }, // <
+    { 17, 11, 335, 2, 19, 47, 1155 }, // =
+    { 17, 19, 335, 2, 23, 81, 1202 }, // >
+    { 16, 29, 300, 4, 28, 116, 1866 }, // ?
+    { 31, 33, 553, 2, 27, 256, 1283 }, // @
+    { 28, 27, 423, -3, 27, 189, 1982 }, // A
+    { 25, 27, 392, -1, 27, 169, 2171 }, // B
+    { 24, 29, 376, 1, 28, 174, 2340 }, // C
+    { 28, 27, 435, -1, 27, 189, 2514 }, // D
+    { 25, 27, 374, -1, 27, 169, 2703 }, // E
+    { 25, 27, 354, -1, 27, 169, 2872 }, // F
+    { 26, 29, 428, 1, 28, 189, 3041 }, // G
+    { 33, 27, 476, -1, 27, 223, 3230 }, // H
+    { 17, 27, 220, -1, 27, 115, 3453 }, // I
+    { 22, 36, 214, -6, 27, 198, 3568 }, // J
+    { 30, 27, 420, -1, 27, 203, 3766 }, // K
+    { 23, 27, 374, -1, 27, 156, 3969 }, // L
+    { 39, 27, 563, -1, 27, 264, 4125 }, // M
+    { 33, 27, 458, -1, 27, 223, 4389 }, // N
+    { 26, 29, 445, 1, 28, 189, 4612 }, // O
+    { 25, 27, 372, -1, 27, 169, 4801 }, // P
+    { 26, 37, 445, 1, 28, 241, 4970 }, // Q
+    { 25, 27, 398, -1, 27, 169, 5211 }, // R
+    { 21, 29, 326, 0, 28, 153, 5380 }, // S
+    { 24, 27, 368, 2, 27, 162, 5533 }, // T
+    { 27, 28, 438, 3, 27, 189, 1539 }, // U
+    { 26, 27, 405, 3, 27, 176, 5695 }, // V
+    { 40, 27, 627, 3, 27, 270, 5871 }, // W
+    { 30, 27, 396, -2, 27, 203, 6141 }, // X
+    { 25, 27, 375, 2, 27, 169, 6344 }, // Y
+    { 25, 27, 363, -1, 27, 169, 6513 }, // Z
+    { 16, 34, 216, 0, 29, 136, 1728 }, // [
+    { 5, 34, 173, 4, 29, 43, 1864 }, // <backslash>
+    { 16, 34, 216, -2, 29, 136, 1907 }, // ]
+    { 19, 18, 335, 1, 27, 86, 2043 }, // ^
+    { 19, 3, 275, -4, -3, 15, 2129 }, // _
+    { 7, 7, 167, 5, 29, 13, 2144 }, // `
+    { 21, 22, 347, 1, 21, 116, 6682 }, // a
+    { 19, 30, 337, 1, 29, 143, 6798 }, // b
+    { 18, 22, 292, 1, 21, 99, 6941 }, // c
+    { 21, 30, 347, 1, 29, 158, 7040 }, // d
+    { 17, 22, 296, 1, 21, 94, 7198 }, // e
+    { 25, 38, 191, -6, 29, 238, 7292 }, // f
+    { 25, 31, 334, -2, 22, 194, 7530 }, // g
+    { 21, 30, 359, 1, 29, 158, 7724 }, // h
+    { 9, 30, 182, 2, 29, 68, 7882 }, // i
+    { 17, 38, 175, -6, 29, 162, 7950 }, // j
+    { 22, 30, 341, 1, 29, 165, 8112 }, // k
+    { 10, 30, 182, 2, 29, 75, 8277 }, // l
+    { 32, 22, 538, 1, 21, 176, 8352 }, // m
+    { 21, 22, 359, 1, 21, 116, 8528 }, // n
+    { 19, 22, 344, 1, 21, 105, 8644 }, // o
+    { 22, 30, 346, -1, 21, 165, 8749 }, // p
+    { 20, 30, 336, 1, 21, 150, 8914 }, // q
+    { 17, 21, 281, 1, 21, 90, 9064 }, // r
+    { 17, 22, 278, 0, 21, 94, 9154 }, // s
+    { 12, 26, 221, 2, 25, 78, 9248 }, // t
+    { 20, 22, 359, 2, 21, 110, 9326 }, // u
+    { 19, 22, 323, 0, 21, 105, 9436 }, // v
+    { 29, 22, 491, 1, 21, 160, 9541 }, // w
+    { 22, 21, 328, -1, 21, 116, 9701 }, // x
+    { 26, 30, 317, -7, 21, 195, 9817 }, // y
+    { 19, 21, 307, -1, 21, 100, 10012 }, // z
+    { 17, 34, 257, 2, 29, 145, 2157 }, // {
+    { 3, 38, 335, 9, 29, 29, 2302 }, // |
+    { 17, 34, 257, -2, 29, 145, 2331 }, // }
+    { 17, 7, 335, 2, 17, 30, 2476 }, // ~
     { 0, 0, 156, 0, 0, 0, 0 }, // U+00A0
     { 11, 28, 200, 0, 21, 77, 0 }, // U+00A1
     { 17, 27, 335, 3, 27, 115, 77 }, // U+00A2
@@ -3502,19 +3509,19 @@ static const EpdGlyph notoserif_18_italicGlyphs[] = {
     { 19, 30, 344, 1, 29, 143, 11995 }, // U+00F0
     { 21, 29, 359, 1, 28, 153, 12138 }, // U+00F1
     { 19, 30, 344, 1, 29, 143, 12291 }, // U+00F2
-    { 19, 30, 344, 1, 29, 143, 12434 }, // U+00F3
-    { 19, 30, 344, 1, 29, 143, 12577 }, // U+00F4
-    { 20, 29, 344, 1, 28, 145, 12720 }, // U+00F5
-    { 19, 29, 344, 1, 28, 138, 12865 }, // U+00F6
-    { 17, 19, 335, 2, 23, 81, 13003 }, // U+00F7
-    { 22, 24, 344, 0, 22, 132, 13084 }, // U+00F8
-    { 20, 30, 359, 2, 29, 150, 13216 }, // U+00F9
-    { 20, 30, 359, 2, 29, 150, 13366 }, // U+00FA
-    { 20, 30, 359, 2, 29, 150, 13516 }, // U+00FB
-    { 20, 29, 359, 2, 28, 145, 13666 }, // U+00FC
-    { 26, 38, 317, -7, 29, 247, 13811 }, // U+00FD
-    { 21, 38, 337, -1, 29, 200, 14058 }, // U+00FE
-    { 26, 37, 317, -7, 28, 241, 14258 }, // U+00FF
+    { 19, 30, 344, 1, 29, 143, 10112 }, // U+00F3
+    { 19, 30, 344, 1, 29, 143, 12434 }, // U+00F4
+    { 20, 29, 344, 1, 28, 145, 12577 }, // U+00F5
+    { 19, 29, 344, 1, 28, 138, 12722 }, // U+00F6
+    { 17, 19, 335, 2, 23, 81, 12860 }, // U+00F7
+    { 22, 24, 344, 0, 22, 132, 12941 }, // U+00F8
+    { 20, 30, 359, 2, 29, 150, 13073 }, // U+00F9
+    { 20, 30, 359, 2, 29, 150, 13223 }, // U+00FA
+    { 20, 30, 359, 2, 29, 150, 13373 }, // U+00FB
+    { 20, 29, 359, 2, 28, 145, 13523 }, // U+00FC
+    { 26, 38, 317, -7, 29, 247, 13668 }, // U+00FD
+    { 21, 38, 337, -1, 29, 200, 13915 }, // U+00FE
+    { 26, 37, 317, -7, 28, 241, 14115 }, // U+00FF
     { 28, 31, 423, -3, 31, 217, 0 }, // U+0100
     { 21, 26, 347, 1, 25, 137, 217 }, // U+0101
     { 28, 34, 423, -3, 34, 238, 354 }, // U+0102
@@ -4216,98 +4223,98 @@ static const EpdGlyph notoserif_18_italicGlyphs[] = {
     { 11, 4, 186, 0, 12, 11, 233 }, // U+2010
     { 11, 4, 186, 0, 12, 11, 244 }, // U+2011
     { 19, 3, 335, 1, 15, 15, 255 }, // U+2012
-    { 21, 4, 300, -1, 12, 21, 270 }, // U+2013
-    { 39, 4, 600, -1, 12, 39, 291 }, // U+2014
-    { 39, 4, 600, -1, 12, 39, 330 }, // U+2015
-    { 10, 38, 335, 6, 29, 95, 369 }, // U+2016
-    { 18, 8, 247, -4, 0, 36, 464 }, // U+2017
-    { 8, 11, 150, 3, 27, 22, 500 }, // U+2018
-    { 7, 11, 150, 3, 27, 20, 522 }, // U+2019
-    { 8, 11, 150, -2, 5, 22, 542 }, // U+201A
-    { 7, 11, 150, 4, 27, 20, 564 }, // U+201B
-    { 16, 11, 270, 3, 27, 44, 584 }, // U+201C
-    { 15, 11, 270, 3, 27, 42, 628 }, // U+201D
-    { 16, 11, 270, -2, 5, 44, 670 }, // U+201E
-    { 14, 11, 270, 4, 27, 39, 714 }, // U+201F
-    { 16, 34, 269, 2, 29, 136, 753 }, // U+2020
-    { 20, 34, 269, -1, 29, 170, 889 }, // U+2021
-    { 11, 12, 217, 2, 19, 33, 1059 }, // U+2022
-    { 13, 13, 300, 5, 20, 43, 1092 }, // U+2023
-    { 5, 6, 172, 3, 16, 8, 1135 }, // U+2024
-    { 16, 6, 322, 3, 16, 24, 1143 }, // U+2025
-    { 27, 6, 515, 1, 5, 41, 1167 }, // U+2026
-    { 6, 6, 150, 2, 13, 9, 1208 }, // U+2027
-    { 0, 0, 360, 0, 0, 0, 1217 }, // U+2028
-    { 0, 0, 360, 0, 0, 0, 1217 }, // U+2029
-    { 9, 28, 0, -1, 23, 63, 1217 }, // U+202A
-    { 9, 28, 0, -8, 23, 63, 1280 }, // U+202B
-    { 10, 31, 0, -5, 26, 78, 1343 }, // U+202C
-    { 10, 31, 0, -5, 26, 78, 1421 }, // U+202D
-    { 10, 31, 0, -5, 26, 78, 1499 }, // U+202E
-    { 0, 0, 100, 0, 0, 0, 1577 }, // U+202F
-    { 45, 29, 770, 2, 28, 327, 1577 }, // U+2030
-    { 60, 29, 1003, 2, 28, 435, 1904 }, // U+2031
-    { 8, 10, 132, 3, 27, 20, 2339 }, // U+2032
-    { 15, 10, 245, 3, 27, 38, 2359 }, // U+2033
-    { 22, 10, 358, 3, 27, 55, 2397 }, // U+2034
-    { 6, 10, 132, 4, 27, 15, 2452 }, // U+2035
-    { 13, 10, 245, 4, 27, 33, 2467 }, // U+2036
-    { 20, 10, 358, 4, 27, 50, 2500 }, // U+2037
-    { 12, 11, 240, -1, 2, 33, 2550 }, // U+2038
-    { 10, 15, 200, 2, 18, 38, 2583 }, // U+2039
-    { 11, 15, 200, 0, 18, 42, 2621 }, // U+203A
-    { 27, 27, 491, 2, 27, 183, 2663 }, // U+203B
-    { 19, 28, 336, 2, 27, 133, 2846 }, // U+203C
-    { 16, 29, 300, 4, 28, 116, 2979 }, // U+203D
-    { 19, 3, 275, 3, 31, 15, 3095 }, // U+203E
-    { 29, 8, 0, -28, 0, 58, 3110 }, // U+203F
-    { 29, 8, 0, -22, 32, 58, 3168 }, // U+2040
-    { 17, 27, 270, -2, 27, 115, 3226 }, // U+2041
-    { 35, 30, 600, 1, 29, 263, 3341 }, // U+2042
-    { 12, 7, 217, 1, 17, 21, 3604 }, // U+2043
-    { 22, 27, 37, -10, 27, 149, 3625 }, // U+2044
-    { 16, 34, 216, 0, 29, 136, 3774 }, // U+2045
-    { 16, 34, 216, -2, 29, 136, 3910 }, // U+2046
-    { 34, 29, 586, 4, 28, 247, 4046 }, // U+2047
-    { 25, 29, 472, 4, 28, 182, 4293 }, // U+2048
-    { 29, 29, 468, 2, 28, 211, 4475 }, // U+2049
-    { 18, 29, 335, 1, 22, 131, 4686 }, // U+204A
-    { 21, 34, 370, 3, 29, 179, 4817 }, // U+204B
-    { 20, 14, 358, 2, 21, 70, 4996 }, // U+204C
-    { 20, 14, 358, 2, 21, 70, 5066 }, // U+204D
-    { 17, 16, 300, 1, 22, 68, 5136 }, // U+204E
-    { 8, 27, 172, 1, 21, 54, 5204 }, // U+204F
-    { 24, 29, 438, 3, 28, 174, 5258 }, // U+2050
-    { 20, 32, 300, 1, 29, 160, 5432 }, // U+2051
-    { 12, 28, 197, 1, 27, 84, 5592 }, // U+2052
-    { 18, 7, 335, 2, 17, 32, 5676 }, // U+2053
-    { 29, 7, 0, -7, -1, 51, 5708 }, // U+2054
-    { 18, 17, 324, 2, 22, 77, 5759 }, // U+2055
-    { 18, 22, 368, 1, 21, 99, 5836 }, // U+2056
-    { 29, 10, 470, 3, 27, 73, 5935 }, // U+2057
-    { 21, 22, 425, 2, 21, 116, 6008 }, // U+2058
-    { 22, 22, 425, 1, 21, 121, 6124 }, // U+2059
-    { 6, 29, 172, 3, 28, 44, 6245 }, // U+205A
-    { 21, 29, 425, 3, 28, 153, 6289 }, // U+205B
-    { 22, 21, 418, 1, 21, 116, 6442 }, // U+205C
-    { 6, 29, 172, 3, 28, 44, 6558 }, // U+205D
-    { 5, 29, 172, 3, 28, 37, 6602 }, // U+205E
-    { 0, 0, 133, 0, 0, 0, 6639 }, // U+205F
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2060
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2061
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2062
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2063
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2064
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2066
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2067
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2068
-    { 0, 0, 360, 0, 0, 0, 6639 }, // U+2069
-    { 10, 31, 0, -5, 26, 78, 6639 }, // U+206A
-    { 10, 31, 0, -5, 26, 78, 6717 }, // U+206B
-    { 10, 31, 0, -5, 26, 78, 6795 }, // U+206C
-    { 10, 31, 0, -5, 26, 78, 6873 }, // U+206D
-    { 10, 31, 0, -5, 26, 78, 6951 }, // U+206E
-    { 10, 31, 0, -5, 26, 78, 7029 }, // U+206F
+    { 21, 4, 300, -1, 12, 21, 10255 }, // U+2013
+    { 39, 4, 600, -1, 12, 39, 10276 }, // U+2014
+    { 39, 4, 600, -1, 12, 39, 270 }, // U+2015
+    { 10, 38, 335, 6, 29, 95, 309 }, // U+2016
+    { 18, 8, 247, -4, 0, 36, 404 }, // U+2017
+    { 8, 11, 150, 3, 27, 22, 440 }, // U+2018
+    { 7, 11, 150, 3, 27, 20, 10315 }, // U+2019
+    { 8, 11, 150, -2, 5, 22, 462 }, // U+201A
+    { 7, 11, 150, 4, 27, 20, 484 }, // U+201B
+    { 16, 11, 270, 3, 27, 44, 10335 }, // U+201C
+    { 15, 11, 270, 3, 27, 42, 10379 }, // U+201D
+    { 16, 11, 270, -2, 5, 44, 504 }, // U+201E
+    { 14, 11, 270, 4, 27, 39, 548 }, // U+201F
+    { 16, 34, 269, 2, 29, 136, 587 }, // U+2020
+    { 20, 34, 269, -1, 29, 170, 723 }, // U+2021
+    { 11, 12, 217, 2, 19, 33, 893 }, // U+2022
+    { 13, 13, 300, 5, 20, 43, 926 }, // U+2023
+    { 5, 6, 172, 3, 16, 8, 969 }, // U+2024
+    { 16, 6, 322, 3, 16, 24, 977 }, // U+2025
+    { 27, 6, 515, 1, 5, 41, 10421 }, // U+2026
+    { 6, 6, 150, 2, 13, 9, 1001 }, // U+2027
+    { 0, 0, 360, 0, 0, 0, 1010 }, // U+2028
+    { 0, 0, 360, 0, 0, 0, 1010 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 1010 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 1073 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 1136 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 1214 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 1292 }, // U+202E
+    { 0, 0, 100, 0, 0, 0, 1370 }, // U+202F
+    { 45, 29, 770, 2, 28, 327, 1370 }, // U+2030
+    { 60, 29, 1003, 2, 28, 435, 1697 }, // U+2031
+    { 8, 10, 132, 3, 27, 20, 2132 }, // U+2032
+    { 15, 10, 245, 3, 27, 38, 2152 }, // U+2033
+    { 22, 10, 358, 3, 27, 55, 2190 }, // U+2034
+    { 6, 10, 132, 4, 27, 15, 2245 }, // U+2035
+    { 13, 10, 245, 4, 27, 33, 2260 }, // U+2036
+    { 20, 10, 358, 4, 27, 50, 2293 }, // U+2037
+    { 12, 11, 240, -1, 2, 33, 2343 }, // U+2038
+    { 10, 15, 200, 2, 18, 38, 2376 }, // U+2039
+    { 11, 15, 200, 0, 18, 42, 2414 }, // U+203A
+    { 27, 27, 491, 2, 27, 183, 2456 }, // U+203B
+    { 19, 28, 336, 2, 27, 133, 2639 }, // U+203C
+    { 16, 29, 300, 4, 28, 116, 2772 }, // U+203D
+    { 19, 3, 275, 3, 31, 15, 2888 }, // U+203E
+    { 29, 8, 0, -28, 0, 58, 2903 }, // U+203F
+    { 29, 8, 0, -22, 32, 58, 2961 }, // U+2040
+    { 17, 27, 270, -2, 27, 115, 3019 }, // U+2041
+    { 35, 30, 600, 1, 29, 263, 3134 }, // U+2042
+    { 12, 7, 217, 1, 17, 21, 3397 }, // U+2043
+    { 22, 27, 37, -10, 27, 149, 3418 }, // U+2044
+    { 16, 34, 216, 0, 29, 136, 3567 }, // U+2045
+    { 16, 34, 216, -2, 29, 136, 3703 }, // U+2046
+    { 34, 29, 586, 4, 28, 247, 3839 }, // U+2047
+    { 25, 29, 472, 4, 28, 182, 4086 }, // U+2048
+    { 29, 29, 468, 2, 28, 211, 4268 }, // U+2049
+    { 18, 29, 335, 1, 22, 131, 4479 }, // U+204A
+    { 21, 34, 370, 3, 29, 179, 4610 }, // U+204B
+    { 20, 14, 358, 2, 21, 70, 4789 }, // U+204C
+    { 20, 14, 358, 2, 21, 70, 4859 }, // U+204D
+    { 17, 16, 300, 1, 22, 68, 4929 }, // U+204E
+    { 8, 27, 172, 1, 21, 54, 4997 }, // U+204F
+    { 24, 29, 438, 3, 28, 174, 5051 }, // U+2050
+    { 20, 32, 300, 1, 29, 160, 5225 }, // U+2051
+    { 12, 28, 197, 1, 27, 84, 5385 }, // U+2052
+    { 18, 7, 335, 2, 17, 32, 5469 }, // U+2053
+    { 29, 7, 0, -7, -1, 51, 5501 }, // U+2054
+    { 18, 17, 324, 2, 22, 77, 5552 }, // U+2055
+    { 18, 22, 368, 1, 21, 99, 5629 }, // U+2056
+    { 29, 10, 470, 3, 27, 73, 5728 }, // U+2057
+    { 21, 22, 425, 2, 21, 116, 5801 }, // U+2058
+    { 22, 22, 425, 1, 21, 121, 5917 }, // U+2059
+    { 6, 29, 172, 3, 28, 44, 6038 }, // U+205A
+    { 21, 29, 425, 3, 28, 153, 6082 }, // U+205B
+    { 22, 21, 418, 1, 21, 116, 6235 }, // U+205C
+    { 6, 29, 172, 3, 28, 44, 6351 }, // U+205D
+    { 5, 29, 172, 3, 28, 37, 6395 }, // U+205E
+    { 0, 0, 133, 0, 0, 0, 6432 }, // U+205F
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2060
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2061
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2062
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2063
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2064
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2066
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2067
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2068
+    { 0, 0, 360, 0, 0, 0, 6432 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 6432 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 6510 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 6588 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 6666 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 6744 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 6822 }, // U+206F
     { 15, 17, 240, 2, 31, 64, 0 }, // U+2070
     { 7, 18, 119, 3, 28, 32, 64 }, // U+2071
     { 15, 17, 240, 1, 31, 64, 96 }, // U+2074
@@ -4383,13 +4390,13 @@ static const EpdGlyph notoserif_18_italicGlyphs[] = {
     { 23, 30, 335, 0, 30, 173, 5671 }, // U+20BE
     { 22, 34, 335, -2, 30, 187, 5844 }, // U+20BF
     { 11, 4, 186, 0, 12, 11, 0 }, // U+2212
-    { 36, 38, 370, -6, 29, 342, 0 }, // U+FB00
-    { 28, 38, 356, -6, 29, 266, 342 }, // U+FB01
-    { 29, 38, 356, -6, 29, 276, 608 }, // U+FB02
-    { 39, 38, 535, -6, 29, 371, 884 }, // U+FB03
-    { 40, 38, 534, -6, 29, 380, 1255 }, // U+FB04
-    { 31, 38, 395, -6, 29, 295, 1635 }, // U+FB05
-    { 32, 30, 499, 0, 29, 240, 1930 }, // U+FB06
+    { 36, 38, 370, -6, 29, 342, 10462 }, // U+FB00
+    { 28, 38, 356, -6, 29, 266, 10804 }, // U+FB01
+    { 29, 38, 356, -6, 29, 276, 11070 }, // U+FB02
+    { 39, 38, 535, -6, 29, 371, 11346 }, // U+FB03
+    { 40, 38, 534, -6, 29, 380, 11717 }, // U+FB04
+    { 31, 38, 395, -6, 29, 295, 0 }, // U+FB05
+    { 32, 30, 499, 0, 29, 240, 295 }, // U+FB06
     { 35, 35, 600, 1, 29, 307, 0 }, // U+FFFD
 };
 
@@ -4397,8 +4404,7 @@ static const EpdUnicodeInterval notoserif_18_italicIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -4406,8 +4412,7 @@ static const EpdUnicodeInterval notoserif_18_italicIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20BF, 0x404 },
@@ -4417,19 +4422,57 @@ static const EpdUnicodeInterval notoserif_18_italicIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_18_italicGroups[] = {
-    { 0, 5711, 13674, 97, 0 },
-    { 5711, 4758, 15551, 96, 97 },
-    { 10469, 6086, 25619, 128, 193 },
-    { 16555, 6157, 22424, 96, 321 },
-    { 22712, 1837, 3026, 112, 417 },
-    { 24549, 16599, 51651, 256, 529 },
-    { 41148, 3304, 20701, 90, 785 },
-    { 44452, 3111, 7783, 111, 875 },
-    { 47563, 1330, 2395, 42, 986 },
-    { 48893, 3171, 6376, 32, 1028 },
-    { 52064, 14, 12, 1, 1060 },
-    { 52078, 705, 2216, 7, 1061 },
-    { 52783, 170, 315, 1, 1068 },
+    { 0, 5085, 12983, 83, 2 },
+    { 5085, 1302, 2729, 26, 0 },
+    { 6387, 4739, 15401, 95, 97 },
+    { 11126, 6086, 25619, 128, 193 },
+    { 17212, 6157, 22424, 96, 321 },
+    { 23369, 1837, 3026, 112, 417 },
+    { 25206, 16599, 51651, 256, 529 },
+    { 41805, 3304, 20701, 90, 785 },
+    { 45109, 3003, 7567, 105, 875 },
+    { 48112, 1330, 2395, 42, 986 },
+    { 49442, 3171, 6376, 32, 1028 },
+    { 52613, 14, 12, 1, 1060 },
+    { 52627, 272, 544, 2, 1066 },
+    { 52899, 170, 315, 1, 1068 },
+};
+
+static const uint16_t notoserif_18_italicGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_18_italicKernLeftClasses[] = {
@@ -5660,18 +5703,81 @@ static const EpdLigaturePair notoserif_18_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_18_italicGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 0 }, { 0x0004, 1, 1 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 2 }, { 0x0009, 1, 1 }, // U+0020
+    { 0x000A, 3, 0 }, { 0x000B, 0, 3 }, { 0x000C, 4, 4 }, { 0x000D, 0, 0 }, { 0x000E, 5, 5 }, { 0x000F, 6, 6 }, { 0x0010, 5, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 0, 0 }, { 0x0023, 7, 10 }, { 0x0024, 8, 11 }, { 0x0025, 9, 12 }, { 0x0026, 10, 11 }, { 0x0027, 11, 11 }, { 0x0028, 12, 11 }, { 0x0029, 13, 12 }, // U+0040
+    { 0x002A, 0, 11 }, { 0x002B, 0, 11 }, { 0x002C, 14, 11 }, { 0x002D, 15, 11 }, { 0x002E, 16, 11 }, { 0x002F, 0, 11 }, { 0x0030, 17, 11 }, { 0x0031, 10, 12 }, // U+0048
+    { 0x0032, 18, 11 }, { 0x0033, 10, 12 }, { 0x0034, 19, 11 }, { 0x0035, 20, 13 }, { 0x0036, 21, 14 }, { 0x0037, 22, 15 }, { 0x0038, 23, 16 }, { 0x0039, 24, 17 }, // U+0050
+    { 0x003A, 25, 18 }, { 0x003B, 26, 19 }, { 0x003C, 0, 20 }, { 0x003D, 3, 0 }, { 0x003E, 0, 21 }, { 0x003F, 0, 3 }, { 0x0040, 0, 0 }, { 0x0041, 27, 22 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 28, 23 }, { 0x0044, 29, 24 }, { 0x0045, 30, 25 }, { 0x0046, 0, 25 }, { 0x0047, 30, 25 }, { 0x0048, 31, 0 }, { 0x0049, 0, 26 }, // U+0060
+    { 0x004A, 28, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 32, 24 }, { 0x004E, 0, 28 }, { 0x004F, 28, 29 }, { 0x0050, 28, 29 }, { 0x0051, 29, 25 }, // U+0068
+    { 0x0052, 29, 29 }, { 0x0053, 33, 25 }, { 0x0054, 34, 29 }, { 0x0055, 35, 30 }, { 0x0056, 0, 31 }, { 0x0057, 0, 32 }, { 0x0058, 36, 33 }, { 0x0059, 37, 34 }, // U+0070
+    { 0x005A, 0, 35 }, { 0x005B, 38, 36 }, { 0x005C, 39, 37 }, { 0x005D, 3, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 3 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 40, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 38 }, { 0x006B, 0, 0 }, { 0x006C, 41, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 38 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 39 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 42, 0 }, // U+00B8
+    { 0x0081, 43, 10 }, { 0x0082, 43, 10 }, { 0x0083, 43, 10 }, { 0x0084, 43, 10 }, { 0x0085, 43, 10 }, { 0x0086, 43, 10 }, { 0x0087, 11, 40 }, { 0x0088, 9, 12 }, // U+00C0
+    { 0x0089, 11, 11 }, { 0x008A, 11, 11 }, { 0x008B, 11, 11 }, { 0x008C, 11, 11 }, { 0x008D, 0, 11 }, { 0x008E, 0, 11 }, { 0x008F, 0, 11 }, { 0x0090, 0, 11 }, // U+00C8
+    { 0x0091, 10, 11 }, { 0x0092, 17, 11 }, { 0x0093, 10, 12 }, { 0x0094, 10, 12 }, { 0x0095, 10, 12 }, { 0x0096, 10, 12 }, { 0x0097, 10, 12 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 10, 12 }, { 0x009A, 22, 15 }, { 0x009B, 22, 15 }, { 0x009C, 22, 15 }, { 0x009D, 22, 15 }, { 0x009E, 26, 19 }, { 0x009F, 10, 11 }, { 0x00A0, 35, 0 }, // U+00D8
+    { 0x00A1, 28, 23 }, { 0x00A2, 28, 23 }, { 0x00A3, 28, 23 }, { 0x00A4, 28, 23 }, { 0x00A5, 28, 23 }, { 0x00A6, 28, 23 }, { 0x00A7, 30, 23 }, { 0x00A8, 30, 25 }, // U+00E0
+    { 0x00A9, 30, 25 }, { 0x00AA, 30, 25 }, { 0x00AB, 30, 25 }, { 0x00AC, 30, 25 }, { 0x00AD, 0, 27 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 27 }, { 0x00B0, 0, 27 }, // U+00E8
+    { 0x00B1, 29, 25 }, { 0x00B2, 28, 29 }, { 0x00B3, 29, 25 }, { 0x00B4, 29, 25 }, { 0x00B5, 29, 25 }, { 0x00B6, 29, 25 }, { 0x00B7, 29, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 29, 25 }, { 0x00BA, 28, 32 }, { 0x00BB, 28, 32 }, { 0x00BC, 28, 32 }, { 0x00BD, 28, 32 }, { 0x00BE, 38, 36 }, { 0x00BF, 29, 24 }, { 0x00C0, 38, 36 }, // U+00F8
+    { 0x00C1, 7, 10 }, { 0x00C2, 28, 23 }, { 0x00C3, 43, 10 }, { 0x00C4, 28, 23 }, { 0x00C5, 43, 10 }, { 0x00C6, 28, 23 }, { 0x00C7, 9, 12 }, { 0x00C8, 30, 25 }, // U+0100
+    { 0x00C9, 9, 12 }, { 0x00CA, 30, 25 }, { 0x00CB, 9, 12 }, { 0x00CC, 30, 25 }, { 0x00CD, 9, 12 }, { 0x00CE, 30, 25 }, { 0x00CF, 10, 11 }, { 0x00D0, 44, 25 }, // U+0108
+    { 0x00D1, 10, 11 }, { 0x00D2, 0, 25 }, { 0x00D3, 11, 11 }, { 0x00D4, 30, 25 }, { 0x00D5, 11, 11 }, { 0x00D6, 30, 25 }, { 0x00D7, 11, 11 }, { 0x00D8, 30, 25 }, // U+0110
+    { 0x00D9, 11, 11 }, { 0x00DA, 30, 25 }, { 0x00DB, 11, 11 }, { 0x00DC, 30, 25 }, { 0x00DD, 13, 12 }, { 0x00DE, 0, 25 }, { 0x00DF, 13, 12 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 13, 12 }, { 0x00E2, 0, 25 }, { 0x00E3, 13, 12 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 11 }, { 0x00E6, 28, 24 }, { 0x00E7, 0, 11 }, { 0x00E8, 28, 24 }, // U+0120
+    { 0x00E9, 0, 11 }, { 0x00EA, 0, 27 }, { 0x00EB, 0, 11 }, { 0x00EC, 0, 27 }, { 0x00ED, 0, 11 }, { 0x00EE, 0, 27 }, { 0x00EF, 0, 11 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 11 }, { 0x00F2, 0, 0 }, { 0x00F3, 14, 11 }, { 0x00F4, 0, 27 }, { 0x00F5, 14, 11 }, { 0x00F6, 0, 0 }, { 0x00F7, 15, 11 }, { 0x00F8, 32, 24 }, // U+0130
+    { 0x00F9, 32, 29 }, { 0x00FA, 16, 11 }, { 0x00FB, 0, 28 }, { 0x00FC, 16, 11 }, { 0x00FD, 0, 28 }, { 0x00FE, 45, 11 }, { 0x00FF, 44, 28 }, { 0x0100, 0, 11 }, // U+0138
+    { 0x0101, 0, 28 }, { 0x0102, 16, 11 }, { 0x0103, 0, 28 }, { 0x0104, 17, 11 }, { 0x0105, 28, 29 }, { 0x0106, 17, 11 }, { 0x0107, 28, 29 }, { 0x0108, 17, 11 }, // U+0140
+    { 0x0109, 28, 29 }, { 0x010A, 28, 41 }, { 0x010B, 14, 11 }, { 0x010C, 28, 29 }, { 0x010D, 10, 12 }, { 0x010E, 29, 25 }, { 0x010F, 10, 12 }, { 0x0110, 29, 25 }, // U+0148
+    { 0x0111, 10, 12 }, { 0x0112, 29, 25 }, { 0x0113, 11, 12 }, { 0x0114, 30, 25 }, { 0x0115, 19, 11 }, { 0x0116, 34, 29 }, { 0x0117, 19, 11 }, { 0x0118, 34, 29 }, // U+0150
+    { 0x0119, 19, 11 }, { 0x011A, 34, 29 }, { 0x011B, 20, 13 }, { 0x011C, 35, 30 }, { 0x011D, 20, 13 }, { 0x011E, 35, 30 }, { 0x011F, 20, 13 }, { 0x0120, 35, 30 }, // U+0158
+    { 0x0121, 20, 13 }, { 0x0122, 35, 30 }, { 0x0123, 21, 0 }, { 0x0124, 0, 31 }, { 0x0125, 21, 0 }, { 0x0126, 0, 31 }, { 0x0127, 21, 0 }, { 0x0128, 0, 31 }, // U+0160
+    { 0x0129, 22, 15 }, { 0x012A, 28, 32 }, { 0x012B, 22, 15 }, { 0x012C, 28, 32 }, { 0x012D, 22, 15 }, { 0x012E, 28, 32 }, { 0x012F, 22, 15 }, { 0x0130, 28, 32 }, // U+0168
+    { 0x0131, 22, 15 }, { 0x0132, 28, 32 }, { 0x0133, 22, 15 }, { 0x0134, 28, 32 }, { 0x0135, 24, 17 }, { 0x0136, 37, 34 }, { 0x0137, 26, 19 }, { 0x0138, 38, 36 }, // U+0170
+    { 0x0139, 26, 19 }, { 0x013A, 0, 20 }, { 0x013B, 39, 37 }, { 0x013C, 0, 20 }, { 0x013D, 39, 37 }, { 0x013E, 0, 20 }, { 0x013F, 39, 37 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 50, 42 }, { 0x0212, 50, 42 }, { 0x0213, 51, 43 }, { 0x0214, 52, 42 }, { 0x0215, 53, 44 }, { 0x0216, 54, 45 }, { 0x0217, 55, 42 }, { 0x0218, 55, 42 }, // U+0400
+    { 0x0219, 56, 46 }, { 0x021A, 57, 47 }, { 0x021B, 57, 42 }, { 0x021C, 58, 43 }, { 0x021D, 59, 42 }, { 0x021E, 55, 42 }, { 0x021F, 60, 48 }, { 0x0220, 55, 42 }, // U+0408
+    { 0x0221, 61, 49 }, { 0x0222, 62, 42 }, { 0x0223, 63, 42 }, { 0x0224, 52, 42 }, { 0x0225, 64, 50 }, { 0x0226, 50, 42 }, { 0x0227, 59, 51 }, { 0x0228, 63, 52 }, // U+0410
+    { 0x0229, 55, 42 }, { 0x022A, 55, 42 }, { 0x022B, 59, 42 }, { 0x022C, 55, 47 }, { 0x022D, 55, 42 }, { 0x022E, 55, 42 }, { 0x022F, 65, 44 }, { 0x0230, 55, 42 }, // U+0418
+    { 0x0231, 66, 42 }, { 0x0232, 53, 44 }, { 0x0233, 52, 43 }, { 0x0234, 60, 48 }, { 0x0235, 67, 53 }, { 0x0236, 68, 54 }, { 0x0237, 64, 42 }, { 0x0238, 55, 55 }, // U+0420
+    { 0x0239, 55, 42 }, { 0x023A, 64, 42 }, { 0x023B, 57, 43 }, { 0x023C, 55, 42 }, { 0x023D, 57, 42 }, { 0x023E, 65, 52 }, { 0x023F, 65, 42 }, { 0x0240, 55, 56 }, // U+0428
+    { 0x0241, 69, 57 }, { 0x0242, 70, 58 }, { 0x0243, 71, 57 }, { 0x0244, 72, 59 }, { 0x0245, 73, 60 }, { 0x0246, 74, 57 }, { 0x0247, 75, 61 }, { 0x0248, 71, 62 }, // U+0430
+    { 0x0249, 69, 63 }, { 0x024A, 69, 63 }, { 0x024B, 76, 64 }, { 0x024C, 69, 65 }, { 0x024D, 69, 65 }, { 0x024E, 69, 64 }, { 0x024F, 77, 57 }, { 0x0250, 78, 64 }, // U+0438
+    { 0x0251, 77, 66 }, { 0x0252, 79, 57 }, { 0x0253, 78, 64 }, { 0x0254, 80, 67 }, { 0x0255, 77, 57 }, { 0x0256, 76, 68 }, { 0x0257, 81, 63 }, { 0x0258, 69, 69 }, // U+0440
+    { 0x0259, 69, 63 }, { 0x025A, 81, 63 }, { 0x025B, 82, 70 }, { 0x025C, 69, 63 }, { 0x025D, 82, 63 }, { 0x025E, 77, 61 }, { 0x025F, 77, 64 }, { 0x0260, 69, 71 }, // U+0448
+    { 0x0261, 74, 57 }, { 0x0262, 74, 57 }, { 0x0263, 83, 72 }, { 0x0264, 72, 59 }, { 0x0265, 79, 57 }, { 0x0266, 84, 73 }, { 0x0267, 69, 74 }, { 0x0268, 85, 75 }, // U+0450
+    { 0x0269, 86, 76 }, { 0x026A, 82, 65 }, { 0x026B, 82, 64 }, { 0x026C, 78, 72 }, { 0x026D, 76, 64 }, { 0x026E, 69, 63 }, { 0x026F, 80, 67 }, { 0x0270, 69, 63 }, // U+0458
+};
+
 static const EpdFontData notoserif_18_italic = {
     notoserif_18_italicBitmaps,
     notoserif_18_italicGlyphs,
     notoserif_18_italicIntervals,
-    20,
+    18,
     51,
     41,
     -11,
     true,
     notoserif_18_italicGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_18_italicGlyphToGroup,
     notoserif_18_italicKernLeftClasses,
     notoserif_18_italicKernRightClasses,
     notoserif_18_italicKernMatrix,
@@ -5681,4 +5787,8 @@ static const EpdFontData notoserif_18_italic = {
     90,
     notoserif_18_italicLigaturePairs,
     5,
+    notoserif_18_italicGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
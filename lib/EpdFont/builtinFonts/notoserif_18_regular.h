@@ -3,2517 +3,2539 @@
  * name: notoserif_18_regular
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notoserif_18_regular 18 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum
+ * Command used: fontconvert.py notoserif_18_regular 18 ../builtinFonts/source/NotoSerif/NotoSerif-Regular.ttf --2bit --compress --pnum --hot-group-corpus hot-glyph-corpus.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notoserif_18_regularBitmaps[44439] = {
-    0xCD, 0x5A, 0x3D, 0x90, 0xDD, 0xD6, 0x79, 0xBD, 0x00, 0x48, 0x22, 0x11, 0xC6, 0x81, 0x0A, 0xCB,
-    0x49, 0x2C, 0x8B, 0x48, 0x91, 0x22, 0x91, 0xC4, 0x45, 0xEB, 0x62, 0x77, 0x81, 0x89, 0xCB, 0x14,
-    0x61, 0x21, 0x3A, 0x85, 0x0B, 0xA9, 0x70, 0xC5, 0x4C, 0x66, 0x5D, 0xA4, 0x50, 0xB1, 0x24, 0x10,
-    0xB5, 0x29, 0xCC, 0x26, 0x75, 0x52, 0xB0, 0xF1, 0xAA, 0x60, 0x0A, 0x17, 0x2C, 0xC8, 0x05, 0x6C,
-    0x97, 0x69, 0x10, 0x66, 0x32, 0x2E, 0x89, 0x82, 0x4E, 0x64, 0x69, 0x26, 0x44, 0x1C, 0xC8, 0x7A,
-    0xA4, 0xF0, 0x70, 0x7D, 0xCE, 0xF9, 0xF0, 0x76, 0x1F, 0x29, 0x4A, 0x24, 0x25, 0x73, 0xEC, 0xF7,
-    0xF0, 0xBE, 0x8B, 0x07, 0x5C, 0xDC, 0x9F, 0xEF, 0xFF, 0x07, 0x79, 0x57, 0xF0, 0xDB, 0xE6, 0xCB,
-    0x37, 0xB3, 0x6F, 0x9D, 0xDA, 0xB7, 0xB4, 0xEF, 0x59, 0xC7, 0x4F, 0x52, 0xA3, 0x67, 0x5F, 0xF4,
-    0x79, 0xEB, 0x5C, 0x13, 0x4E, 0x76, 0x5C, 0x0D, 0x56, 0x38, 0xF6, 0xDC, 0x88, 0x63, 0xD7, 0x0D,
-    0x38, 0xD4, 0x77, 0x08, 0x7A, 0xE7, 0x82, 0x21, 0xEA, 0x36, 0x30, 0xEC, 0x23, 0x3C, 0x16, 0x75,
-    0xB1, 0x60, 0x52, 0x03, 0xB6, 0x80, 0x67, 0xBF, 0xF7, 0x5F, 0x6F, 0xFF, 0xB3, 0x4B, 0x3D, 0x3E,
-    0x2E, 0x11, 0x74, 0x69, 0x99, 0x61, 0x80, 0xD4, 0xED, 0x00, 0x66, 0x6E, 0x4F, 0x70, 0x17, 0x70,
-    0x47, 0x70, 0xCF, 0x1D, 0x02, 0xEE, 0xBA, 0x9B, 0xCE, 0x15, 0xE8, 0xBE, 0x12, 0x9C, 0xDC, 0x2B,
-    0x0F, 0xBE, 0xFB, 0xF1, 0x5B, 0xCE, 0x8D, 0x01, 0xA7, 0x1F, 0xC2, 0x7E, 0x03, 0x9F, 0x34, 0x39,
-    0xA1, 0x0B, 0xB0, 0x02, 0x17, 0x76, 0x1B, 0x10, 0x3F, 0x00, 0xF0, 0x7E, 0x70, 0xF1, 0xAF, 0x7F,
-    0x3E, 0xB9, 0xF4, 0x4E, 0xB7, 0x76, 0xF9, 0x4F, 0xBB, 0x63, 0x57, 0xBC, 0xD7, 0xDD, 0x26, 0x78,
-    0x97, 0xC0, 0xB9, 0xFC, 0x0E, 0x40, 0xFA, 0x10, 0x20, 0xF6, 0xDC, 0x1A, 0xE6, 0xC7, 0x45, 0x8F,
-    0xB1, 0x42, 0x3C, 0xEB, 0xC2, 0xFB, 0x13, 0xC0, 0x1D, 0xCF, 0x41, 0x1B, 0xB7, 0x1B, 0x76, 0x55,
-    0x79, 0x2B, 0xEC, 0x8A, 0x72, 0x0D, 0xE0, 0x3C, 0xAF, 0x55, 0x7F, 0xC5, 0x91, 0xFF, 0xFB, 0xA3,
-    0x15, 0x06, 0xE0, 0x63, 0x7F, 0x7C, 0xEF, 0x91, 0x65, 0x9C, 0x82, 0xE5, 0x13, 0x78, 0x6C, 0xE2,
-    0x02, 0xA6, 0xFB, 0x35, 0x46, 0xC6, 0xCE, 0xD3, 0xF6, 0xAA, 0x73, 0x98, 0x34, 0xAF, 0x0B, 0xC7,
-    0xBD, 0x16, 0x65, 0x5E, 0x47, 0xE8, 0x52, 0xB8, 0xBC, 0xE5, 0xBE, 0x0A, 0x97, 0xB5, 0x29, 0xC6,
-    0xAD, 0xD0, 0x12, 0x8D, 0x6C, 0xF7, 0x97, 0x96, 0x88, 0x63, 0xBF, 0x95, 0x2B, 0xF9, 0xDC, 0x3F,
-    0x0E, 0xD9, 0xCC, 0x71, 0xBE, 0xD3, 0x37, 0x6F, 0xB7, 0x69, 0x5B, 0xC4, 0xED, 0x14, 0xF7, 0x49,
-    0x3F, 0xA5, 0xEF, 0x8D, 0xD1, 0x10, 0xFA, 0x31, 0x8B, 0xC6, 0x70, 0x74, 0xAF, 0x94, 0xFB, 0xF8,
-    0xC7, 0x6D, 0x1E, 0xC6, 0x43, 0x88, 0x45, 0xB8, 0x95, 0xB5, 0xC1, 0x60, 0x6D, 0xD4, 0x5B, 0x1B,
-    0xB7, 0xD6, 0x2F, 0xAD, 0xD1, 0x8E, 0x24, 0x5A, 0x88, 0x71, 0x9C, 0xC3, 0xEC, 0x18, 0x57, 0x8B,
-    0x3F, 0xCE, 0x5A, 0x5B, 0xBC, 0x5F, 0x36, 0x77, 0xF1, 0x64, 0x9F, 0xB1, 0x1F, 0xD9, 0x14, 0x9F,
-    0xCE, 0x6C, 0x3C, 0xD6, 0x87, 0x66, 0xED, 0xF8, 0x40, 0x00, 0x7A, 0xA0, 0x09, 0xAD, 0xC1, 0x3F,
-    0x5E, 0xC4, 0xBD, 0xBC, 0x56, 0xCF, 0x8A, 0x0F, 0x54, 0xEF, 0xAD, 0xD9, 0xE4, 0xF7, 0x49, 0x78,
-    0x97, 0xCE, 0x18, 0xAF, 0x75, 0xD5, 0x9A, 0x4D, 0x38, 0xFB, 0x32, 0x1E, 0x5D, 0x3A, 0x14, 0x5D,
-    0xD2, 0x61, 0xF7, 0xD9, 0x90, 0xB4, 0xAE, 0xA8, 0xE3, 0x09, 0xDC, 0x57, 0x95, 0x81, 0x4F, 0x4B,
-    0xD7, 0x60, 0x80, 0xBB, 0x8E, 0x4D, 0x3E, 0xAB, 0x49, 0x30, 0x5A, 0x55, 0x82, 0xA6, 0x58, 0x51,
-    0x0D, 0x1A, 0xB4, 0x2E, 0xEF, 0x30, 0x56, 0xEF, 0xD2, 0x95, 0xCB, 0x7F, 0xB8, 0x72, 0x91, 0xBF,
-    0xBF, 0x8E, 0xFC, 0x75, 0x57, 0xE1, 0x12, 0x16, 0x1E, 0xBC, 0xC5, 0x59, 0x1B, 0x7D, 0xAF, 0xE2,
-    0xBB, 0x87, 0xEF, 0xAE, 0xB8, 0xD5, 0xB9, 0x97, 0x49, 0xA6, 0xB4, 0xE3, 0x32, 0x27, 0x17, 0x8D,
-    0x2E, 0xD1, 0xBF, 0x9C, 0x4B, 0xE0, 0x51, 0x69, 0xF6, 0x86, 0x1B, 0x79, 0xFC, 0xB0, 0xEB, 0x15,
-    0x69, 0xC5, 0x9E, 0x78, 0x24, 0xEB, 0x5C, 0xDA, 0x3B, 0x20, 0x15, 0x48, 0x70, 0xC7, 0x8E, 0x88,
-    0x08, 0x81, 0xE1, 0x97, 0x81, 0xAB, 0x91, 0x24, 0xE6, 0xC8, 0xCB, 0xDD, 0x59, 0xFF, 0x39, 0x47,
-    0xBB, 0x3C, 0x99, 0xF5, 0x7C, 0x38, 0x1D, 0x3E, 0x73, 0xF4, 0xBC, 0x95, 0x69, 0x4D, 0xB6, 0x2C,
-    0x5B, 0x93, 0x56, 0x8B, 0x9B, 0x98, 0x1D, 0x24, 0x23, 0x39, 0xC2, 0x6B, 0xA4, 0xB6, 0x7E, 0xDF,
-    0x8A, 0xBA, 0x6F, 0x15, 0xEF, 0xB5, 0xEB, 0xEA, 0x57, 0xFF, 0xEE, 0xCF, 0x79, 0x7F, 0xCF, 0x65,
-    0x2B, 0x17, 0x34, 0xBE, 0x2E, 0x1E, 0xDE, 0x9D, 0x8B, 0x9F, 0xFE, 0x64, 0xBE, 0x10, 0x75, 0x6F,
-    0x3A, 0x4A, 0xDE, 0xD2, 0xDF, 0x48, 0x2D, 0xB1, 0xFC, 0x3C, 0x70, 0xF9, 0xFD, 0x87, 0x47, 0x65,
-    0x03, 0x61, 0xAE, 0x75, 0xF6, 0xC5, 0x9D, 0x5D, 0x70, 0x4D, 0xFA, 0x68, 0x28, 0x86, 0x7C, 0x8C,
-    0x87, 0x00, 0xEA, 0x26, 0x6A, 0xB3, 0x72, 0x72, 0xD7, 0xDC, 0xEB, 0x47, 0xD7, 0x0B, 0xBF, 0x2A,
-    0x24, 0x99, 0x3B, 0xAE, 0x6A, 0x1B, 0x7C, 0xC5, 0x4D, 0xEE, 0xCF, 0x1D, 0xB5, 0x06, 0x30, 0x35,
-    0x90, 0x26, 0x18, 0x06, 0x4A, 0x01, 0x47, 0x5C, 0xBB, 0xA4, 0x84, 0xBE, 0x01, 0xC7, 0x52, 0xE7,
-    0xEC, 0x51, 0xBB, 0x90, 0x5B, 0x1F, 0xEB, 0xDB, 0xA9, 0x6F, 0x8B, 0x59, 0xA1, 0xA1, 0x9E, 0xD0,
-    0xFD, 0xC7, 0xCE, 0xBD, 0xB3, 0xE1, 0xE6, 0xDC, 0x97, 0xD4, 0x26, 0x78, 0x6A, 0x15, 0xAD, 0x88,
-    0x64, 0x71, 0x72, 0x23, 0xFC, 0x96, 0x22, 0x3C, 0x70, 0x9C, 0xB7, 0x8D, 0x00, 0x46, 0xEA, 0x40,
-    0xEE, 0xAC, 0xFF, 0x62, 0xA0, 0x7E, 0x64, 0xD1, 0x56, 0xCF, 0x8A, 0xB4, 0x05, 0xC7, 0xC3, 0xC8,
-    0x15, 0x09, 0x35, 0x63, 0x36, 0x08, 0x49, 0xE0, 0x6F, 0x0C, 0x8B, 0x4E, 0x32, 0xF9, 0xBA, 0x85,
-    0x5F, 0x44, 0xF1, 0xC8, 0x08, 0x66, 0x80, 0x57, 0x7F, 0x05, 0x50, 0xDC, 0x01, 0xC8, 0x43, 0x5E,
-    0x7B, 0x21, 0x20, 0x02, 0x0B, 0xBE, 0x74, 0xC3, 0x7F, 0x28, 0xE5, 0xBE, 0xC8, 0x7B, 0x33, 0x53,
-    0x38, 0xA1, 0x39, 0x21, 0x8B, 0x23, 0xB0, 0x10, 0x4D, 0x58, 0x3A, 0x7A, 0x57, 0x2E, 0x58, 0x43,
-    0x35, 0x05, 0x7C, 0xCE, 0x00, 0x15, 0x8D, 0xB4, 0x4E, 0x44, 0xBD, 0x90, 0x90, 0xE4, 0x94, 0x7E,
-    0x74, 0xC2, 0xE7, 0x36, 0x7B, 0xE8, 0xE6, 0xA3, 0xD7, 0xB9, 0x53, 0x08, 0x44, 0x40, 0x32, 0xC5,
-    0x65, 0x06, 0x2A, 0x95, 0x20, 0x4F, 0x5E, 0xD2, 0xAE, 0x6C, 0x81, 0xCD, 0x5A, 0x4A, 0x58, 0x9C,
-    0xA6, 0x77, 0x79, 0x1F, 0x4F, 0x58, 0x0B, 0x97, 0x51, 0x52, 0xF3, 0x50, 0xF8, 0x72, 0x82, 0x40,
-    0x62, 0x64, 0x0B, 0x8A, 0x38, 0x5D, 0x42, 0xE3, 0x52, 0x01, 0xB1, 0x05, 0xFF, 0x15, 0x1E, 0x3C,
-    0xE8, 0x0E, 0x56, 0xCB, 0x5E, 0xF1, 0x44, 0xB9, 0xDC, 0xA6, 0xD0, 0x9D, 0x80, 0x6F, 0xF3, 0x1A,
-    0x56, 0xD6, 0x94, 0xB7, 0x41, 0x1B, 0xCC, 0xC1, 0xD9, 0x1E, 0x82, 0x37, 0x62, 0x8F, 0x15, 0x40,
-    0xBF, 0x6A, 0x39, 0x52, 0x5F, 0x36, 0x4C, 0x3C, 0x2F, 0x3A, 0x0C, 0x9F, 0x0B, 0x82, 0x87, 0x82,
-    0xC3, 0x2C, 0xE6, 0x27, 0x8C, 0x5B, 0xC2, 0xB4, 0x9C, 0xC5, 0xE3, 0x84, 0x87, 0x82, 0x23, 0x21,
-    0x30, 0x30, 0xD3, 0xBA, 0x12, 0x82, 0x53, 0x01, 0x73, 0x6D, 0x64, 0xFF, 0xD2, 0x25, 0x7F, 0xC9,
-    0x35, 0x42, 0xC1, 0xE5, 0xA3, 0x23, 0x7F, 0xC4, 0x41, 0x35, 0xF2, 0x67, 0x61, 0x20, 0x8A, 0xDD,
-    0xF0, 0x1F, 0xC8, 0x2A, 0x42, 0x15, 0x10, 0xC0, 0x62, 0xAD, 0x0D, 0x40, 0x06, 0xAE, 0x50, 0x68,
-    0x5E, 0x73, 0x89, 0x73, 0x5F, 0xA3, 0x30, 0xB8, 0x27, 0x82, 0x8C, 0x04, 0xCF, 0x28, 0x08, 0x7F,
-    0xEA, 0x32, 0x91, 0x74, 0x51, 0xEF, 0x54, 0x97, 0xA7, 0xD8, 0xAA, 0x37, 0x67, 0x55, 0xFD, 0x27,
-    0xBC, 0x71, 0xC8, 0x2E, 0x57, 0xC5, 0x18, 0x75, 0x02, 0x8D, 0xEB, 0x1F, 0xC7, 0x16, 0x69, 0x41,
-    0xC3, 0x58, 0x7D, 0x34, 0x91, 0x3C, 0x33, 0xB5, 0x9E, 0x64, 0x80, 0xE6, 0x0F, 0x22, 0x69, 0xA8,
-    0xD7, 0x88, 0xA5, 0x34, 0xB3, 0xC0, 0xCB, 0x18, 0x36, 0x83, 0x5C, 0xF8, 0xE6, 0xC6, 0xE8, 0x7C,
-    0x8F, 0xE1, 0x3D, 0x09, 0xEE, 0xD9, 0x4B, 0x9A, 0xBE, 0x21, 0xBD, 0x04, 0xA8, 0x75, 0x5B, 0xE9,
-    0x5D, 0xCA, 0xD9, 0x67, 0x45, 0xAC, 0xD9, 0x16, 0xB1, 0x0A, 0x18, 0xED, 0x4E, 0x40, 0x7B, 0x85,
-    0xD6, 0xF9, 0x1F, 0x68, 0x9A, 0x7F, 0x40, 0xBE, 0x04, 0xB8, 0xCA, 0xF9, 0xA7, 0x0D, 0x30, 0xB6,
-    0x26, 0x2B, 0xC5, 0x04, 0x49, 0xB7, 0xE1, 0xE1, 0x4C, 0xC8, 0x28, 0x37, 0xDC, 0x7C, 0xBC, 0xE1,
-    0x8B, 0xE0, 0x09, 0x4F, 0xA5, 0x27, 0x4F, 0xE5, 0xED, 0xE6, 0x29, 0x7D, 0x32, 0xFA, 0x25, 0xFE,
-    0xFD, 0x89, 0x1C, 0xEB, 0xC9, 0xB1, 0x45, 0x29, 0x7B, 0x83, 0x2D, 0x64, 0x0B, 0xE8, 0xE8, 0x23,
-    0x80, 0xEF, 0x6B, 0x58, 0xB3, 0x82, 0x4C, 0xB7, 0xC6, 0x8E, 0xFE, 0x87, 0xCE, 0x04, 0x39, 0x38,
-    0x25, 0x62, 0x1B, 0xD8, 0xCE, 0x68, 0x15, 0xFB, 0x12, 0xFD, 0x9A, 0x96, 0x96, 0xA1, 0x07, 0x22,
-    0xD2, 0x01, 0x78, 0x89, 0x09, 0xA2, 0xA1, 0xE0, 0x19, 0xAE, 0x25, 0x03, 0xEE, 0xA6, 0x1D, 0x74,
-    0x1C, 0xC4, 0x79, 0xFE, 0x2E, 0xED, 0x0E, 0x07, 0x30, 0x93, 0x28, 0x5D, 0x38, 0x6F, 0x74, 0xE1,
-    0x04, 0xCE, 0x4F, 0xC9, 0x9C, 0x58, 0x81, 0xE9, 0xC2, 0x9A, 0x0A, 0xAC, 0x95, 0x71, 0x03, 0xC8,
-    0x3A, 0x03, 0xED, 0x02, 0x7A, 0x18, 0xDD, 0xA2, 0xC7, 0x13, 0xBE, 0x8F, 0xE7, 0xF7, 0xEF, 0x77,
-    0x81, 0xF7, 0x6F, 0x77, 0xEE, 0x9B, 0xD7, 0xB3, 0x6E, 0xB3, 0xED, 0xFC, 0x84, 0xCE, 0xC5, 0x09,
-    0x9D, 0xD7, 0xEE, 0x8F, 0xE4, 0x2B, 0xD4, 0xD8, 0x7B, 0xF2, 0x10, 0xA6, 0x3B, 0xF4, 0x44, 0x22,
-    0x39, 0xE7, 0x0C, 0x09, 0x5D, 0xF3, 0xBB, 0xE3, 0x9E, 0xF4, 0xD9, 0x71, 0x76, 0x57, 0x4C, 0x03,
-    0xA7, 0x21, 0x5D, 0xF1, 0x2B, 0x7B, 0xF3, 0x99, 0x4F, 0xDC, 0xA5, 0x63, 0x36, 0xA5, 0x13, 0xA6,
-    0xBA, 0x09, 0xB7, 0xB3, 0x4F, 0xE0, 0x66, 0xFD, 0x99, 0xEE, 0x94, 0x72, 0x95, 0x17, 0x0E, 0x8F,
-    0x39, 0x77, 0xD5, 0x2D, 0x52, 0x5D, 0xF5, 0x8B, 0x08, 0xE4, 0xC3, 0x46, 0x02, 0x0A, 0x8E, 0xAE,
-    0x5E, 0xEA, 0x26, 0xD7, 0x03, 0xB7, 0x74, 0xBA, 0x3A, 0x91, 0x13, 0xB1, 0x46, 0x60, 0x44, 0x96,
-    0x8D, 0x14, 0x70, 0x9F, 0xF7, 0x21, 0x1F, 0x9A, 0x2D, 0x7D, 0xE5, 0xD2, 0xA5, 0x4B, 0x5A, 0x11,
-    0xCD, 0x19, 0x9E, 0xE5, 0x33, 0xD9, 0x28, 0x09, 0xE7, 0xD5, 0x9C, 0xA7, 0xA1, 0xE4, 0x31, 0xEF,
-    0x4F, 0x34, 0x50, 0x55, 0x2F, 0x17, 0x79, 0x5B, 0x1D, 0x33, 0x9D, 0xD4, 0xCB, 0x9A, 0x24, 0xAB,
-    0x54, 0xB6, 0xEE, 0xC4, 0x81, 0x0B, 0xFD, 0x03, 0x50, 0xDA, 0xB7, 0x55, 0x9B, 0x0C, 0x0D, 0x58,
-    0xE7, 0x18, 0x5C, 0x7B, 0x05, 0xB2, 0x79, 0x46, 0xEA, 0x93, 0x3F, 0xF9, 0x8A, 0xF8, 0x25, 0xF4,
-    0x0D, 0x7B, 0x2D, 0x85, 0x7B, 0x05, 0x83, 0x49, 0x57, 0x6C, 0xFF, 0xCE, 0x6E, 0x6D, 0x05, 0x5A,
-    0x5C, 0xE2, 0x4C, 0xE4, 0xF0, 0x27, 0xD1, 0xD6, 0xE7, 0x1B, 0xC7, 0xD7, 0x6C, 0x66, 0x53, 0xE9,
-    0xF9, 0x83, 0xE0, 0x00, 0x58, 0x0D, 0x66, 0x13, 0x18, 0x4E, 0x43, 0x39, 0x12, 0x8B, 0xC0, 0x23,
-    0x96, 0x9B, 0x08, 0x23, 0x3E, 0xB9, 0x73, 0x0F, 0xCE, 0x20, 0x1E, 0x18, 0x5D, 0x75, 0x7F, 0x82,
-    0x0F, 0xDB, 0x87, 0x24, 0xE1, 0x98, 0x62, 0xDD, 0x30, 0x29, 0x63, 0x56, 0x67, 0x2D, 0x44, 0x6D,
-    0x95, 0xC3, 0x4C, 0xA3, 0xCF, 0xCD, 0x02, 0x0F, 0x42, 0xEA, 0x56, 0x05, 0x98, 0x0B, 0xED, 0x78,
-    0x15, 0xEC, 0x0B, 0x6F, 0x16, 0xED, 0x9A, 0x56, 0x69, 0xB8, 0x8D, 0x36, 0xED, 0x02, 0x6B, 0xDB,
-    0xA8, 0xBB, 0x2D, 0x53, 0x1F, 0x43, 0x09, 0x20, 0x76, 0xE8, 0xD2, 0xF2, 0x2A, 0x38, 0xF3, 0xFF,
-    0x87, 0x7D, 0x2A, 0x26, 0xFF, 0x1F, 0x8C, 0x56, 0xDC, 0x39, 0xCF, 0x7D, 0xE4, 0x8B, 0xC0, 0xA6,
-    0xCB, 0x76, 0x92, 0x85, 0xC9, 0x64, 0x67, 0x82, 0x45, 0x0D, 0x93, 0x8B, 0xC0, 0x1F, 0x81, 0xCE,
-    0xFD, 0x87, 0x8D, 0xFA, 0x1C, 0x88, 0x9D, 0xC9, 0xD1, 0x0B, 0x1E, 0x56, 0x46, 0x00, 0xBB, 0x6A,
-    0x04, 0x84, 0xB6, 0xB4, 0x51, 0xC5, 0x3C, 0x2E, 0x95, 0x88, 0xB8, 0x4C, 0xB8, 0x70, 0x7B, 0x92,
-    0x1F, 0xB7, 0x9B, 0x2A, 0x52, 0xBB, 0x25, 0xA3, 0xE6, 0x46, 0x9B, 0x78, 0x88, 0xA4, 0x6B, 0x7A,
-    0xB3, 0xE0, 0x9D, 0x33, 0x63, 0x23, 0x85, 0x9D, 0xCA, 0x31, 0x94, 0x35, 0x6F, 0xA9, 0xFC, 0xD4,
-    0xEC, 0xD1, 0x29, 0xB1, 0xC0, 0x64, 0x10, 0x8B, 0x71, 0x34, 0x60, 0x3E, 0x5E, 0x29, 0x3A, 0xC1,
-    0x68, 0x54, 0x59, 0xF0, 0x3E, 0xA8, 0xB4, 0x22, 0xEF, 0x6E, 0xCC, 0x35, 0xAC, 0xCA, 0x3D, 0x3E,
-    0xEB, 0xFD, 0x08, 0x36, 0xBD, 0xBE, 0xA8, 0x4F, 0xF2, 0xDB, 0xC1, 0x48, 0xBD, 0x4F, 0x57, 0xC5,
-    0x6B, 0xCF, 0xFE, 0x73, 0x0F, 0xBB, 0xCB, 0xB5, 0x7A, 0x97, 0x0D, 0x54, 0x2F, 0xE6, 0x70, 0x49,
-    0xF7, 0xB9, 0x78, 0xDA, 0xEA, 0x0C, 0x5E, 0xF5, 0xE2, 0x9A, 0xA7, 0x42, 0x5F, 0x62, 0x0D, 0x10,
-    0xD3, 0x03, 0x8C, 0x33, 0x52, 0xCA, 0xE6, 0x8D, 0x52, 0xA5, 0x67, 0x4B, 0x33, 0x86, 0xAB, 0x75,
-    0xBC, 0x06, 0x6E, 0x82, 0x19, 0x11, 0x85, 0x9B, 0xB9, 0xE7, 0xDB, 0x50, 0x52, 0xEE, 0x9D, 0x53,
-    0x83, 0x5F, 0x6D, 0x24, 0xDF, 0xDC, 0x81, 0x27, 0x01, 0xDD, 0x95, 0x24, 0x56, 0x27, 0x8F, 0x71,
-    0x14, 0x6D, 0x45, 0x12, 0xF6, 0x35, 0x92, 0x71, 0xDF, 0xF9, 0xEE, 0xDC, 0xC4, 0xF8, 0x76, 0x04,
-    0xD3, 0x50, 0xF8, 0xCE, 0x5E, 0x24, 0xB2, 0x7E, 0xB9, 0x08, 0x78, 0x2F, 0x21, 0x7D, 0x75, 0x36,
-    0x83, 0xCA, 0xFB, 0xDE, 0xA4, 0xD8, 0x1B, 0x35, 0xD0, 0x2C, 0x98, 0x30, 0x44, 0x89, 0x45, 0xBC,
-    0xDB, 0xA0, 0x76, 0xC1, 0xCF, 0xB3, 0x37, 0x81, 0x35, 0xE1, 0xBC, 0x3D, 0xE6, 0x32, 0x43, 0x3A,
-    0x6E, 0xCF, 0xDE, 0x50, 0xE9, 0x8A, 0x07, 0x0D, 0x97, 0x1B, 0x64, 0x72, 0xD5, 0xEB, 0x05, 0xA2,
-    0x43, 0x60, 0xEB, 0xD9, 0xDB, 0x82, 0x17, 0x04, 0x5F, 0x5B, 0x5C, 0x84, 0xCF, 0x87, 0x62, 0x3E,
-    0x53, 0x81, 0x4F, 0xE9, 0xB9, 0x81, 0x61, 0xA9, 0xE5, 0x8A, 0x1B, 0x12, 0xC1, 0xB4, 0xE6, 0x8E,
-    0xF2, 0x9A, 0x6B, 0x34, 0x85, 0x0A, 0xCD, 0xCF, 0xB5, 0x09, 0xD8, 0xFA, 0xB4, 0xB0, 0x0D, 0xB8,
-    0x60, 0x6B, 0xF3, 0x27, 0xE3, 0x3E, 0x11, 0x18, 0x6F, 0xFB, 0xFA, 0x69, 0xFD, 0x1E, 0x01, 0x52,
-    0xB2, 0x07, 0x70, 0x96, 0x89, 0xAA, 0x47, 0x14, 0xF9, 0x3D, 0xC9, 0xBE, 0x2E, 0x56, 0x1D, 0x23,
-    0x51, 0x92, 0xAF, 0xE8, 0xA4, 0x28, 0x18, 0x0F, 0x0E, 0xD2, 0x21, 0x14, 0xC2, 0x3F, 0x3C, 0x51,
-    0x8E, 0x4B, 0x53, 0x99, 0x81, 0x68, 0xCA, 0xED, 0xC6, 0x3F, 0xDE, 0x9C, 0x85, 0x81, 0xF0, 0x74,
-    0x85, 0x3D, 0xBB, 0x04, 0xCD, 0xA8, 0xE7, 0x40, 0x49, 0x32, 0x27, 0xC6, 0x2D, 0xAC, 0x21, 0x83,
-    0x2E, 0xF3, 0xA1, 0x49, 0x6C, 0x76, 0xF2, 0x02, 0xA7, 0x6E, 0x96, 0xFB, 0x46, 0x17, 0xD8, 0xE9,
-    0x07, 0x12, 0x9B, 0xB7, 0xB4, 0x03, 0x52, 0x7C, 0xB2, 0x06, 0x58, 0x65, 0x54, 0x5D, 0x7E, 0x29,
-    0xFE, 0xDB, 0x6E, 0x2C, 0x53, 0xB4, 0x69, 0xBE, 0xE2, 0x60, 0x6A, 0x6C, 0x65, 0xA0, 0xC1, 0x07,
-    0xFC, 0x35, 0x58, 0x6E, 0x43, 0x4E, 0x58, 0x2F, 0x8B, 0xF6, 0xEE, 0xAB, 0x1C, 0x18, 0xC1, 0x06,
-    0x85, 0xF7, 0xDC, 0xF1, 0x27, 0xCB, 0x2A, 0xDA, 0xBD, 0xE8, 0x5F, 0x6F, 0x3F, 0x52, 0x89, 0xEA,
-    0x5F, 0xE9, 0x0C, 0x50, 0x65, 0x65, 0xEC, 0x41, 0xB2, 0x00, 0x85, 0x4B, 0xC3, 0x8D, 0x66, 0xA6,
-    0x39, 0x72, 0x93, 0xAC, 0x7D, 0x43, 0xD1, 0x64, 0x28, 0x1A, 0xD4, 0x24, 0xAD, 0x9A, 0xCC, 0x78,
-    0xF7, 0x8A, 0x9A, 0x40, 0xD9, 0x1B, 0x2F, 0xFF, 0xD4, 0xF9, 0xD4, 0xFE, 0x15, 0x72, 0x79, 0x7D,
-    0x63, 0x5C, 0xFE, 0x7F, 0xF2, 0x57, 0x7C, 0x2B, 0xD7, 0x06, 0x61, 0x96, 0x0D, 0x96, 0xAE, 0xD4,
-    0xC8, 0x01, 0xF2, 0xB4, 0x10, 0x86, 0xB1, 0xD6, 0x74, 0xB7, 0xA9, 0x13, 0xE0, 0x8A, 0xF2, 0x91,
-    0xAE, 0x45, 0x9D, 0xC8, 0x77, 0xA4, 0x8E, 0x3B, 0xE8, 0x2B, 0x59, 0x42, 0x83, 0xA1, 0x31, 0xF4,
-    0x33, 0x2A, 0x83, 0xAF, 0x02, 0xA3, 0xF6, 0x71, 0x45, 0xB2, 0x51, 0x27, 0x96, 0x2E, 0x7A, 0x54,
-    0x9D, 0xB4, 0x72, 0xD8, 0x70, 0xA2, 0x5D, 0xFB, 0x5A, 0x69, 0xC2, 0x80, 0xC0, 0xCB, 0x22, 0xE2,
-    0xF2, 0x27, 0x40, 0x41, 0x74, 0x17, 0x1D, 0x3F, 0x61, 0x16, 0xED, 0x5F, 0x70, 0xF2, 0x31, 0x4E,
-    0xD2, 0xB7, 0x71, 0x32, 0x32, 0x84, 0x63, 0xBA, 0x6B, 0xC4, 0xD0, 0x3B, 0x3A, 0x81, 0x0D, 0xDE,
-    0xD3, 0x09, 0x28, 0x79, 0xA8, 0x13, 0x90, 0xF5, 0xA6, 0x4E, 0x40, 0xE3, 0x41, 0x27, 0xE9, 0x10,
-    0xD8, 0x49, 0x32, 0x84, 0x9D, 0x4E, 0xA2, 0x55, 0xD4, 0xDA, 0xC9, 0x14, 0xDB, 0x49, 0x30, 0xA5,
-    0xA5, 0x4E, 0x60, 0xC6, 0x9C, 0x9D, 0xF8, 0xF3, 0xCB, 0x49, 0x75, 0x65, 0x39, 0x29, 0xA6, 0xE5,
-    0x24, 0x5F, 0x2D, 0x27, 0x70, 0x04, 0x31, 0x4D, 0xA0, 0xA4, 0x06, 0x5C, 0x93, 0x03, 0x5F, 0x27,
-    0x7D, 0x08, 0xE5, 0xDE, 0xF8, 0x36, 0x6A, 0x11, 0x25, 0xB6, 0x15, 0xB3, 0x0A, 0x34, 0xED, 0x6A,
-    0x42, 0x22, 0x80, 0x06, 0xC3, 0x9C, 0x04, 0xEE, 0x99, 0xCD, 0x4A, 0xCD, 0x27, 0x6B, 0x35, 0x1F,
-    0x7B, 0x35, 0x23, 0x2C, 0x22, 0x1B, 0xE8, 0x36, 0x36, 0xE0, 0x43, 0x36, 0xE0, 0x8F, 0x43, 0x2D,
-    0x5B, 0x0D, 0x58, 0xF7, 0x50, 0x2B, 0xAD, 0xD5, 0x14, 0xAD, 0x9A, 0x6C, 0x50, 0x93, 0x8E, 0x6A,
-    0xA2, 0x49, 0x4D, 0xE8, 0xD5, 0x38, 0x7F, 0x4B, 0x0D, 0x79, 0x11, 0x4D, 0x6E, 0x4D, 0x3A, 0x29,
-    0x9E, 0x82, 0xF1, 0x3A, 0x40, 0x10, 0x0F, 0xFF, 0xAF, 0xE1, 0xCA, 0xA6, 0x53, 0x67, 0x96, 0xD6,
-    0x2A, 0x97, 0xE9, 0x02, 0xC9, 0x66, 0x19, 0x3B, 0x84, 0xA2, 0xF4, 0x5C, 0x3B, 0x49, 0xD4, 0x40,
-    0x75, 0x17, 0x8F, 0xD4, 0x8D, 0xD1, 0x44, 0x41, 0x8A, 0x26, 0x1A, 0xF4, 0x70, 0x4D, 0x2D, 0x1B,
-    0xAE, 0xC9, 0x8C, 0xCC, 0x3B, 0xD2, 0xD8, 0x3E, 0x0E, 0xC3, 0xD9, 0xFA, 0x58, 0x7F, 0x7B, 0xD6,
-    0xC6, 0xA1, 0x7C, 0xC6, 0x63, 0xA6, 0xF1, 0x13, 0xE9, 0x59, 0xCE, 0x0B, 0x3A, 0xFB, 0x52, 0x4A,
-    0x7F, 0x6E, 0xB0, 0x66, 0xF3, 0x04, 0xE8, 0x0A, 0xB8, 0x53, 0xF7, 0xA9, 0x96, 0xEA, 0x1A, 0x4E,
-    0x9D, 0x9F, 0xC5, 0xD4, 0x3F, 0xC3, 0xB1, 0xED, 0x4A, 0x71, 0x83, 0x3E, 0xA0, 0x80, 0xC2, 0x5E,
-    0x93, 0x5F, 0x8F, 0x2E, 0x3E, 0x8F, 0x74, 0x58, 0x1C, 0x21, 0x2B, 0xF6, 0xA8, 0x19, 0xFB, 0xFD,
-    0xC4, 0x67, 0xBE, 0x8D, 0x4F, 0xE9, 0xA1, 0x25, 0xE2, 0x8A, 0xC5, 0x08, 0xF2, 0x84, 0x97, 0x84,
-    0xC5, 0x62, 0x2E, 0x8B, 0x7B, 0x96, 0x79, 0x90, 0x5D, 0xBD, 0x5C, 0x3E, 0x86, 0xFF, 0x6C, 0x3C,
-    0xC5, 0xE4, 0x17, 0xBB, 0xAF, 0x0B, 0xE6, 0xD7, 0x5B, 0x98, 0x27, 0xED, 0x8E, 0xCC, 0x89, 0x95,
-    0xB2, 0x55, 0xC2, 0xCE, 0x07, 0xA6, 0x0F, 0x1B, 0x29, 0xE3, 0x42, 0xCE, 0x6D, 0x3E, 0x6C, 0xD4,
-    0xE6, 0x09, 0xAD, 0x97, 0x01, 0xE5, 0xCE, 0x54, 0x1D, 0x75, 0x24, 0xB6, 0x06, 0xAD, 0x78, 0xCE,
-    0x9F, 0xA6, 0x04, 0x02, 0x7F, 0x7F, 0x02, 0x32, 0xD0, 0x85, 0xB9, 0x68, 0x4A, 0x3E, 0x2B, 0x07,
-    0x2E, 0x27, 0x3A, 0xBE, 0xBE, 0x15, 0x4C, 0xCB, 0x05, 0x4D, 0xE5, 0xFD, 0x5B, 0x81, 0x63, 0xAD,
-    0x74, 0x26, 0x6B, 0x28, 0x5A, 0x98, 0x52, 0xF7, 0xA1, 0x3F, 0x71, 0x5E, 0xF3, 0xEE, 0x0C, 0x93,
-    0x11, 0x3B, 0x04, 0xC5, 0x02, 0x32, 0x25, 0x27, 0x6B, 0xB8, 0x10, 0x8D, 0x4B, 0xE6, 0xBF, 0x5B,
-    0xD1, 0x21, 0xB8, 0x66, 0x2C, 0xCB, 0x62, 0x8D, 0x1F, 0x16, 0x58, 0x66, 0x5D, 0x3C, 0xEC, 0x81,
-    0x2C, 0xC1, 0xB0, 0x4B, 0xAD, 0xB2, 0xC0, 0x6F, 0x13, 0xFE, 0x9B, 0x99, 0xAC, 0x17, 0x0F, 0x65,
-    0x87, 0x5E, 0xF2, 0x88, 0x4B, 0xE8, 0xBE, 0x74, 0x32, 0x27, 0x05, 0xF5, 0x97, 0x1A, 0xED, 0xD4,
-    0x64, 0x89, 0x01, 0xEF, 0xEF, 0xA2, 0xB9, 0x69, 0x79, 0x0D, 0x33, 0xD8, 0x2A, 0xF9, 0x28, 0xC9,
-    0xEF, 0xB2, 0x07, 0xA2, 0x58, 0xBC, 0x64, 0x57, 0x1B, 0x2B, 0xA0, 0x04, 0x97, 0x96, 0x3A, 0x16,
-    0x14, 0xB2, 0x85, 0x31, 0x5D, 0x32, 0x5B, 0x20, 0x36, 0x29, 0x35, 0x48, 0xCD, 0x40, 0x43, 0x3E,
-    0x2B, 0xBE, 0x93, 0x29, 0x6B, 0xE5, 0x1C, 0x26, 0xE6, 0x1D, 0xA4, 0x16, 0x6F, 0x67, 0x16, 0x93,
-    0x30, 0x4F, 0x02, 0x01, 0x65, 0x11, 0x2E, 0x95, 0x42, 0x06, 0x0F, 0x29, 0x93, 0x00, 0xF7, 0x73,
-    0x94, 0x90, 0xA8, 0xE0, 0x16, 0xAC, 0x2D, 0x49, 0x32, 0x47, 0xC2, 0x69, 0xA3, 0x0A, 0x9B, 0xAB,
-    0xFE, 0x5A, 0x82, 0x52, 0xFC, 0x50, 0xC2, 0x93, 0xDF, 0x35, 0x66, 0xFC, 0x5F, 0x8B, 0x7B, 0x4D,
-    0xD9, 0x26, 0xD6, 0xC4, 0x16, 0xC3, 0xCA, 0x7D, 0x68, 0x60, 0x1D, 0xC2, 0x6B, 0x88, 0x33, 0x57,
-    0x3C, 0x43, 0xDC, 0x88, 0x33, 0xFA, 0x05, 0x14, 0x91, 0xAA, 0xA4, 0x3C, 0xD2, 0xBD, 0x28, 0x24,
-    0x62, 0x1C, 0xC5, 0x02, 0x87, 0xCC, 0xCA, 0x63, 0xD8, 0xC7, 0xFE, 0x5A, 0xA8, 0x03, 0xB2, 0x76,
-    0x67, 0xA1, 0x0D, 0xBB, 0x39, 0x6C, 0xCC, 0x08, 0xC0, 0x52, 0x56, 0xC2, 0x21, 0xB6, 0x36, 0x16,
-    0x65, 0x68, 0xCE, 0xD1, 0x50, 0xB4, 0x5C, 0x37, 0xAD, 0xA6, 0x15, 0xD1, 0x92, 0x11, 0x66, 0xB3,
-    0x23, 0x42, 0x62, 0xD8, 0xCD, 0xB4, 0x4F, 0xA5, 0x54, 0xE2, 0x36, 0x19, 0x88, 0x9D, 0x68, 0x4A,
-    0xEA, 0x78, 0xC8, 0xB4, 0xED, 0xB4, 0x8C, 0x46, 0xE5, 0x92, 0x60, 0x44, 0xA3, 0x69, 0x4F, 0xAA,
-    0x22, 0x83, 0x41, 0x51, 0xED, 0xA7, 0xC1, 0x9D, 0xF5, 0xA1, 0x30, 0xF1, 0xF7, 0xE8, 0xA1, 0x04,
-    0x4C, 0x81, 0xA5, 0x1D, 0x8B, 0x52, 0x34, 0x45, 0x95, 0xFC, 0x25, 0x2A, 0x8E, 0xC2, 0x0A, 0x57,
-    0x46, 0xDE, 0xE5, 0x8C, 0x16, 0xB7, 0xF0, 0xAB, 0x50, 0xAC, 0x38, 0x85, 0x0A, 0x9A, 0x54, 0x89,
-    0x62, 0x80, 0x95, 0x1B, 0x9D, 0xF6, 0x4D, 0x66, 0x99, 0x8C, 0x49, 0xAD, 0xF8, 0x19, 0x4D, 0x22,
-    0x42, 0x38, 0x2B, 0x07, 0xE5, 0xFC, 0xDB, 0x16, 0x0B, 0x58, 0x7A, 0x20, 0x37, 0x44, 0x5B, 0xE8,
-    0xBF, 0xC1, 0x7E, 0xBA, 0x5E, 0xD4, 0x84, 0x9A, 0x5D, 0x45, 0xA6, 0x6E, 0xA5, 0x75, 0x84, 0x83,
-    0x14, 0x42, 0xDC, 0x4A, 0x3F, 0xA6, 0xB5, 0x94, 0x62, 0x6E, 0x9A, 0xFE, 0xD0, 0xD4, 0xE2, 0x24,
-    0x4D, 0x10, 0xD9, 0x6E, 0xE0, 0x0F, 0x9C, 0x33, 0x6F, 0x00, 0xF1, 0x44, 0x89, 0x55, 0x07, 0xA7,
-    0x8D, 0x88, 0xB8, 0x32, 0x96, 0xB3, 0xFC, 0x8F, 0x0A, 0x96, 0x2D, 0x33, 0x0B, 0x2A, 0x41, 0xD9,
-    0xC2, 0xF6, 0x8C, 0x1F, 0x88, 0x37, 0x26, 0x66, 0xB4, 0x07, 0xE3, 0xAE, 0xE6, 0x3B, 0x62, 0xAB,
-    0xE2, 0x9F, 0x2C, 0x9B, 0x71, 0x77, 0x7B, 0xF1, 0xA6, 0xB3, 0x2D, 0x7D, 0xF2, 0x5C, 0xCD, 0x36,
-    0x1F, 0x86, 0x0D, 0x15, 0x3A, 0x93, 0xDD, 0x2B, 0xCB, 0x70, 0x4C, 0x2A, 0x2E, 0x53, 0x2A, 0x56,
-    0xFB, 0xC4, 0xF3, 0x1E, 0xC9, 0xB3, 0x4B, 0xFC, 0xBF, 0x69, 0xC2, 0xA9, 0x74, 0x8B, 0xE6, 0x96,
-    0xCF, 0xAB, 0xB4, 0x9E, 0xA2, 0x2F, 0xE5, 0x86, 0xFD, 0xA6, 0xF2, 0x22, 0xBB, 0x22, 0x4C, 0x8A,
-    0xCE, 0xD2, 0x9C, 0x66, 0xBB, 0x10, 0xB6, 0xF1, 0xF1, 0xF3, 0xC4, 0xEF, 0x0E, 0x7B, 0xEC, 0x13,
-    0xEF, 0xC7, 0x74, 0x1F, 0xD7, 0x02, 0xAF, 0x1F, 0xD1, 0x8B, 0xAC, 0x3A, 0x32, 0x34, 0x7C, 0xBF,
-    0xDF, 0xE6, 0x51, 0x73, 0x21, 0x18, 0xBC, 0xF0, 0xED, 0x3B, 0xAA, 0x5F, 0xBD, 0xAB, 0x5A, 0xD6,
-    0xAE, 0xC2, 0xF0, 0xF3, 0x4A, 0xC5, 0x81, 0xDF, 0x13, 0xD1, 0x89, 0xA5, 0xB2, 0x8E, 0x75, 0x30,
-    0xF2, 0x98, 0xE5, 0x78, 0x6E, 0x8A, 0x05, 0x76, 0x25, 0x81, 0x3B, 0x2A, 0x87, 0x9D, 0x3C, 0x60,
-    0x85, 0xB5, 0x10, 0x66, 0xA7, 0xDF, 0xEA, 0xFD, 0xFD, 0xCB, 0x2C, 0xF0, 0xB5, 0x0C, 0x62, 0x8B,
-    0x17, 0x70, 0x34, 0x2D, 0x11, 0x45, 0xC4, 0xFF, 0x60, 0x93, 0x16, 0x53, 0xE6, 0x5C, 0x34, 0x8A,
-    0xC8, 0x2D, 0x09, 0x39, 0x27, 0x25, 0xD7, 0xED, 0xB0, 0x72, 0xB4, 0xC7, 0xBD, 0xDC, 0xE2, 0xE2,
-    0x46, 0xEC, 0x24, 0x24, 0xEB, 0x61, 0x8F, 0x39, 0xB7, 0x9B, 0x96, 0x60, 0xCA, 0x84, 0x15, 0xF4,
-    0xA8, 0xDB, 0x37, 0x85, 0xE9, 0xCC, 0x7A, 0x8D, 0x02, 0x4C, 0xAB, 0x5E, 0xBC, 0x5C, 0x17, 0x50,
-    0x0E, 0xD1, 0x08, 0x11, 0xD8, 0xD9, 0xA8, 0xDE, 0x86, 0x89, 0xEE, 0xF9, 0x7B, 0xB4, 0xB5, 0xCC,
-    0x10, 0x0E, 0x4C, 0x1B, 0xD2, 0x0E, 0xBA, 0x8B, 0x4B, 0xA1, 0x7A, 0x01, 0x67, 0x8F, 0x3C, 0xCD,
-    0x22, 0x2C, 0xFF, 0x03, 0xD6, 0xE6, 0x11, 0x6D, 0x73, 0x0B, 0x15, 0x35, 0x70, 0x73, 0x02, 0x60,
-    0xF3, 0x5B, 0x3A, 0x16, 0x7D, 0x56, 0x94, 0x29, 0xF8, 0xF0, 0x1E, 0xA2, 0x07, 0x48, 0x30, 0x13,
-    0x7F, 0xAF, 0xFF, 0x48, 0x03, 0x6D, 0x15, 0x8C, 0xDC, 0xD3, 0xE0, 0x5B, 0x52, 0x53, 0x34, 0xE5,
-    0x73, 0x45, 0x06, 0x9F, 0x47, 0x46, 0x5D, 0x7E, 0xC9, 0x7D, 0x59, 0xF1, 0xCB, 0x66, 0x25, 0x9C,
-    0xC5, 0xC8, 0xB3, 0xDC, 0x82, 0x27, 0xC2, 0x25, 0x75, 0x66, 0xFD, 0x4B, 0x32, 0x7C, 0xB3, 0x8C,
-    0x16, 0xAC, 0x47, 0xF0, 0x74, 0x8E, 0x98, 0x1F, 0xA1, 0xC4, 0xA4, 0x82, 0x84, 0xD3, 0xEC, 0x67,
-    0xDF, 0x52, 0x30, 0x14, 0xCF, 0x07, 0x23, 0xF0, 0x06, 0xFF, 0x2C, 0x9C, 0x8A, 0x32, 0x58, 0x41,
-    0x25, 0x5F, 0x6B, 0x16, 0x27, 0x72, 0xDE, 0xFA, 0x2D, 0xC1, 0xA0, 0xCC, 0x1F, 0x53, 0x8F, 0x98,
-    0xEB, 0x0C, 0xB4, 0xDF, 0x9B, 0xE9, 0x83, 0x60, 0x8A, 0x68, 0xE3, 0x48, 0x6C, 0xD5, 0x38, 0xCF,
-    0x1D, 0xD1, 0xC4, 0xA4, 0x8A, 0xB6, 0xA8, 0x1C, 0x37, 0xDE, 0xCC, 0xE7, 0xC0, 0xB3, 0x17, 0x01,
-    0xE1, 0xDA, 0x00, 0xC2, 0x7C, 0x22, 0xD0, 0xCA, 0xC6, 0xF8, 0xBE, 0x78, 0xC8, 0x5B, 0x01, 0xBC,
-    0x55, 0xF1, 0x9C, 0x15, 0xDB, 0x65, 0x9B, 0xF9, 0x06, 0x7E, 0x16, 0x15, 0x76, 0xDD, 0x7A, 0xDA,
-    0x53, 0x36, 0x82, 0x8D, 0x96, 0x8E, 0xF1, 0x5D, 0xBE, 0x3A, 0xE0, 0xD3, 0x19, 0x33, 0x4E, 0x29,
-    0x13, 0x2E, 0x32, 0x87, 0xF4, 0x86, 0x80, 0x8C, 0x12, 0xDC, 0x72, 0x83, 0x45, 0x78, 0xE8, 0xA3,
-    0xBC, 0x05, 0xBF, 0x16, 0xAC, 0xD8, 0x55, 0xF2, 0xFA, 0xB8, 0x73, 0xBD, 0x07, 0xA0, 0x34, 0x87,
-    0x81, 0x47, 0x53, 0x47, 0x2A, 0x78, 0xA8, 0x5A, 0x81, 0xD9, 0xCE, 0x90, 0x8D, 0x5E, 0x03, 0x43,
-    0x61, 0x94, 0x50, 0xBE, 0xB6, 0x84, 0x41, 0x59, 0x98, 0xA0, 0xA1, 0x45, 0xC5, 0xE8, 0x70, 0x3A,
-    0x8F, 0xC1, 0x98, 0x6B, 0x77, 0x9D, 0xB2, 0xB1, 0xFD, 0x63, 0x0E, 0xF5, 0xFD, 0xF9, 0xA8, 0x7C,
-    0xFC, 0xFA, 0xF3, 0xFC, 0x28, 0x6A, 0x37, 0xFC, 0x2F, 0x97, 0xF0, 0x41, 0x2F, 0x3F, 0x5C, 0x82,
-    0xC3, 0x91, 0xFB, 0xFB, 0xB3, 0x6B, 0xFE, 0x76, 0xBE, 0x0A, 0x85, 0xBE, 0xFE, 0x03, 0x08, 0x4C,
-    0x43, 0xBB, 0x5E, 0x11, 0x14, 0xE5, 0x29, 0x60, 0x4E, 0x9E, 0x7A, 0xF9, 0x18, 0xE4, 0x67, 0xB5,
-    0xA0, 0x60, 0x50, 0xB6, 0x73, 0x5C, 0x4A, 0x37, 0x49, 0xF1, 0x98, 0x20, 0x06, 0xF3, 0xD1, 0xF5,
-    0x25, 0xFB, 0x07, 0x61, 0x44, 0xF8, 0x79, 0xE4, 0x07, 0x78, 0xB5, 0xF1, 0x08, 0x9B, 0x18, 0xAE,
-    0x0A, 0xD6, 0x86, 0x01, 0xC2, 0xB1, 0x70, 0x4B, 0x9D, 0xAA, 0x87, 0x91, 0x3F, 0x68, 0x63, 0xAD,
-    0x8A, 0x01, 0xDF, 0xF3, 0x0B, 0x8F, 0x90, 0x38, 0x67, 0x8A, 0x66, 0xC9, 0xD6, 0x6E, 0xEE, 0x69,
-    0x32, 0x7C, 0xBB, 0x04, 0x5A, 0xF3, 0x06, 0xCE, 0x8F, 0xFE, 0x7D, 0x7E, 0x68, 0x59, 0xD6, 0xDC,
-    0xDF, 0x73, 0xFE, 0x5E, 0x05, 0x8A, 0xE1, 0xF8, 0xFA, 0x56, 0xD8, 0x70, 0xFC, 0x48, 0x9D, 0xA7,
-    0xF0, 0xEE, 0xD5, 0xED, 0x97, 0x45, 0x9E, 0xE5, 0xF0, 0xE5, 0x1B, 0xFE, 0x41, 0x01, 0x54, 0x9C,
-    0x75, 0x1B, 0x5E, 0xAF, 0xB7, 0xEA, 0x87, 0xB2, 0xA9, 0xBE, 0x7E, 0x09, 0xC8, 0xAD, 0xEA, 0xE5,
-    0x25, 0x95, 0x2F, 0x73, 0xE8, 0xB5, 0x95, 0x8A, 0x9B, 0x02, 0x29, 0xE1, 0x19, 0x5C, 0x2D, 0xBF,
-    0x8C, 0xCE, 0x32, 0xC8, 0xF4, 0xFB, 0xEC, 0x0E, 0x66, 0x8A, 0x46, 0x2A, 0xDF, 0x95, 0xF5, 0xB0,
-    0x59, 0xCE, 0xCF, 0xAC, 0xB0, 0x7D, 0x16, 0x63, 0xCC, 0x4A, 0x4D, 0xCD, 0x12, 0xF4, 0xB5, 0x7C,
-    0x2B, 0x89, 0x81, 0xF3, 0x3F, 0x53, 0x9F, 0xC0, 0x14, 0x0C, 0xC3, 0xC5, 0x59, 0x56, 0x7A, 0x96,
-    0x4D, 0x9E, 0x19, 0x4D, 0xE1, 0x1E, 0x98, 0x17, 0x68, 0x0F, 0x7C, 0x4F, 0xB4, 0xE7, 0xC3, 0xE5,
-    0x1F, 0xB9, 0x66, 0xD6, 0x3A, 0x7F, 0x1B, 0x47, 0xE0, 0x2D, 0xAD, 0x38, 0xA9, 0x64, 0x4C, 0xE1,
-    0x6F, 0x60, 0x49, 0x4A, 0xD6, 0xC7, 0x0F, 0x56, 0xDE, 0xDF, 0x61, 0xE2, 0x34, 0xFA, 0xB4, 0xCB,
-    0x3E, 0x61, 0xD8, 0x14, 0xF2, 0x5D, 0x38, 0xEE, 0x94, 0xA1, 0xB2, 0x6A, 0x27, 0xA1, 0xFC, 0x77,
-    0xD8, 0x14, 0x3B, 0x89, 0x5E, 0xE4, 0x09, 0x66, 0xB4, 0x70, 0xE1, 0x86, 0xEF, 0x23, 0x7F, 0x2D,
-    0xF2, 0x35, 0x74, 0x6D, 0xC4, 0xA3, 0x33, 0x6D, 0x42, 0x1B, 0x58, 0x6B, 0xD9, 0xB0, 0x75, 0x0F,
-    0xBB, 0x8C, 0xC9, 0x16, 0xCA, 0x6D, 0x28, 0x5A, 0x43, 0x22, 0x08, 0x27, 0x2A, 0x84, 0xAF, 0x02,
-    0x23, 0x96, 0x59, 0xB8, 0x06, 0x50, 0x04, 0x0B, 0x60, 0xCE, 0x4C, 0x52, 0x88, 0x88, 0x86, 0x3A,
-    0x73, 0x05, 0x9D, 0x89, 0xFB, 0xB9, 0x8C, 0x26, 0x0B, 0xF5, 0x95, 0xDB, 0x7A, 0x99, 0x26, 0xED,
-    0x18, 0x1D, 0xF4, 0xA7, 0xC0, 0x6F, 0x40, 0xA7, 0x2E, 0xEA, 0x6C, 0x51, 0xAA, 0x4A, 0xFB, 0x03,
-    0x86, 0xD2, 0xA0, 0xD0, 0x99, 0xD7, 0x4E, 0xAA, 0xD7, 0x34, 0x57, 0x13, 0x2D, 0xE6, 0x1B, 0x13,
-    0x2D, 0x26, 0xED, 0xDA, 0x8B, 0xB1, 0x98, 0x8B, 0x2D, 0x5E, 0x54, 0x8B, 0xA9, 0x19, 0xB3, 0xD7,
-    0xEE, 0xA9, 0x2F, 0x69, 0xE4, 0x2A, 0x11, 0x54, 0x8A, 0xCE, 0xCD, 0xAA, 0xC0, 0xB2, 0xC1, 0xCE,
-    0x40, 0xDD, 0xFD, 0xCD, 0x43, 0x59, 0xB6, 0xEE, 0x45, 0x59, 0xB6, 0xFB, 0xB2, 0x9F, 0x0C, 0x53,
-    0xBC, 0x92, 0x2D, 0x67, 0xCB, 0xFC, 0xA9, 0xB6, 0x77, 0x09, 0x70, 0xBE, 0x29, 0x0B, 0x51, 0xA8,
-    0x6E, 0x87, 0x45, 0xFB, 0xA1, 0x58, 0xBB, 0x83, 0x11, 0x16, 0x0E, 0x0C, 0xA5, 0x44, 0x74, 0x43,
-    0xA6, 0x7A, 0xD7, 0xF2, 0x2F, 0xF6, 0x52, 0xD1, 0xF4, 0xBC, 0x40, 0xAE, 0x37, 0xD3, 0x21, 0x4B,
-    0x52, 0x05, 0xF3, 0x04, 0x98, 0x36, 0xF9, 0x45, 0xD5, 0xE6, 0x35, 0x33, 0x15, 0x31, 0x7F, 0x7A,
-    0x39, 0x4C, 0x45, 0x8E, 0x15, 0x73, 0x3B, 0x9D, 0xE5, 0x3C, 0xF8, 0x72, 0x47, 0x40, 0x86, 0xA7,
-    0x86, 0x88, 0x87, 0x37, 0x21, 0x18, 0xF0, 0x0E, 0x87, 0xAB, 0xB4, 0x28, 0x2E, 0xE9, 0xF3, 0x5F,
-    0x34, 0x75, 0xCC, 0x7E, 0x7C, 0xAD, 0xE0, 0x2F, 0xF4, 0x42, 0xAA, 0xBC, 0x61, 0x06, 0x62, 0x9C,
-    0x3B, 0x57, 0x52, 0xDD, 0x7F, 0x69, 0x43, 0x1A, 0xAC, 0x37, 0xBE, 0xCF, 0x87, 0xA5, 0xDE, 0x26,
-    0x3B, 0x79, 0x55, 0xB2, 0x98, 0xA9, 0xF5, 0xDF, 0x98, 0xA9, 0xF8, 0x83, 0xAF, 0x6C, 0x6D, 0x1E,
-    0x81, 0x8D, 0x95, 0x06, 0x14, 0xA8, 0x15, 0x5D, 0x56, 0x31, 0x24, 0x5C, 0x57, 0x1F, 0x80, 0xC6,
-    0x03, 0xD3, 0xA7, 0xAF, 0x9C, 0xD8, 0x07, 0x08, 0x7E, 0xE6, 0x7B, 0x58, 0xD2, 0x04, 0xC7, 0xA4,
-    0x57, 0x05, 0x27, 0x7A, 0xF8, 0xA1, 0xB2, 0xAB, 0x5C, 0xBB, 0x92, 0x54, 0x8C, 0xDA, 0x1A, 0x06,
-    0x02, 0x34, 0xF0, 0x2C, 0x65, 0xB7, 0x09, 0xD3, 0x80, 0xAD, 0xCA, 0xFC, 0xFD, 0x79, 0x85, 0x7B,
-    0xBB, 0x7A, 0xA1, 0x65, 0x57, 0x01, 0xD9, 0x8F, 0x45, 0x38, 0xCB, 0x27, 0x28, 0xE0, 0x33, 0xCF,
-    0xD1, 0xFC, 0xB9, 0x62, 0xFB, 0x6D, 0x07, 0xEF, 0xBB, 0x90, 0x29, 0x8E, 0x12, 0x36, 0x01, 0x1A,
-    0xEB, 0x60, 0xCD, 0x08, 0x0B, 0x41, 0x63, 0x34, 0x50, 0x0F, 0x61, 0x49, 0x7C, 0x5B, 0x6F, 0x62,
-    0x6C, 0xC8, 0x30, 0x64, 0x72, 0xE7, 0x8F, 0x99, 0xB0, 0xC7, 0xC2, 0x2E, 0x54, 0x4A, 0x70, 0xCC,
-    0x6E, 0x17, 0x1E, 0xB5, 0x1C, 0xA8, 0x77, 0xF3, 0xFA, 0xBC, 0x5C, 0xF2, 0x31, 0x6B, 0x2F, 0xE8,
-    0x45, 0x12, 0xF8, 0x12, 0x5C, 0x4F, 0xF1, 0x93, 0x3E, 0xE9, 0x49, 0xD2, 0xFC, 0x67, 0x6D, 0x3C,
-    0x70, 0x6D, 0xE9, 0x7F, 0xB6, 0xD1, 0xA8, 0xFC, 0xD8, 0xCF, 0xEB, 0x70, 0xA5, 0x5A, 0xED, 0x47,
-    0xCB, 0x52, 0xE3, 0xA5, 0x68, 0x21, 0x0F, 0x48, 0x0B, 0x0E, 0xA7, 0xA5, 0x00, 0x47, 0x72, 0x9E,
-    0x9A, 0xD7, 0xC2, 0x8F, 0x58, 0xF6, 0xAB, 0xC0, 0x9E, 0x6C, 0x02, 0xCB, 0xFE, 0x55, 0xCD, 0x00,
-    0x38, 0x6F, 0xB3, 0x13, 0x84, 0x18, 0x2A, 0x82, 0xB9, 0xDF, 0xDA, 0xBE, 0x41, 0x5D, 0xF9, 0x54,
-    0x2F, 0x6D, 0xDC, 0x21, 0x4B, 0xC7, 0xB5, 0x4A, 0xF3, 0x9A, 0x69, 0x4F, 0xA9, 0x81, 0x5B, 0xB2,
-    0x1B, 0x13, 0x53, 0x23, 0x07, 0x2C, 0x43, 0x5C, 0xF3, 0x4C, 0x04, 0x75, 0x1B, 0xBC, 0xB5, 0xB9,
-    0x6F, 0x71, 0xFD, 0x55, 0x5F, 0x9F, 0x12, 0x6E, 0xA5, 0xC5, 0x0E, 0x4C, 0x74, 0x85, 0x22, 0x1C,
-    0x13, 0x08, 0x55, 0xA9, 0xE8, 0xBC, 0x4E, 0xB4, 0x36, 0x22, 0x2D, 0xED, 0x32, 0xBD, 0x03, 0xB7,
-    0xA3, 0x2C, 0xD0, 0x9E, 0xD6, 0x79, 0xA8, 0x0D, 0x2A, 0xB3, 0xB1, 0x56, 0x8C, 0xD4, 0x0C, 0x27,
-    0x22, 0xBE, 0x88, 0x7B, 0xD6, 0x6E, 0x5E, 0xE3, 0xD0, 0x8B, 0x68, 0xCE, 0x8A, 0x4A, 0xCB, 0xFB,
-    0x23, 0x81, 0x25, 0x5C, 0xF5, 0xD0, 0x81, 0x4A, 0xE0, 0xF6, 0x2E, 0xC7, 0x3D, 0x77, 0xFA, 0x2A,
-    0xA5, 0xA7, 0x3B, 0x04, 0xB9, 0xCD, 0xB9, 0xD8, 0x3D, 0x26, 0xA9, 0x77, 0x2D, 0x81, 0x21, 0x9C,
-    0x58, 0xA9, 0x7D, 0x13, 0xC9, 0xB3, 0x2C, 0xBF, 0x75, 0xB3, 0xDA, 0xBA, 0x99, 0xF0, 0x66, 0xCA,
-    0x9B, 0x19, 0xD7, 0x57, 0x29, 0x71, 0x6B, 0xC0, 0xB9, 0x6F, 0xD4, 0xCA, 0xAD, 0xA4, 0xE3, 0x69,
-    0xA5, 0xEC, 0x69, 0xBF, 0xC2, 0xF2, 0x65, 0xD2, 0x92, 0x2B, 0xCB, 0x0D, 0xEB, 0x45, 0x8D, 0x6A,
-    0x51, 0x27, 0xCF, 0x32, 0x46, 0xD6, 0xD9, 0x6A, 0x23, 0xF2, 0xCE, 0x41, 0xFB, 0xFD, 0x9B, 0xCF,
-    0xF2, 0xF9, 0xCB, 0xD2, 0xCA, 0x19, 0x52, 0xFF, 0x4B, 0x5C, 0x64, 0xBF, 0xF6, 0x8B, 0x7F, 0x9C,
-    0x91, 0x3B, 0x64, 0x52, 0x33, 0x00, 0x5B, 0x2D, 0x45, 0xDC, 0xA7, 0x3E, 0xB7, 0x19, 0x9F, 0x73,
-    0x79, 0x9B, 0xBB, 0x80, 0x91, 0x0C, 0xFF, 0xD5, 0x9D, 0xAB, 0x11, 0xD6, 0x24, 0x75, 0xD1, 0xB4,
-    0x49, 0x7D, 0x18, 0x0F, 0xA9, 0xBB, 0x19, 0xCC, 0x95, 0xD5, 0x8D, 0x46, 0xF2, 0xF6, 0x6F, 0x00,
-    0xDD, 0x5B, 0x3D, 0x8C, 0xDD, 0xD6, 0x95, 0xBE, 0x24, 0x47, 0x22, 0x60, 0x22, 0xA1, 0x8A, 0x28,
-    0x40, 0xAC, 0xB5, 0xD9, 0x6C, 0x91, 0xC8, 0xF6, 0xB0, 0x49, 0x91, 0x62, 0xDE, 0x90, 0x5E, 0x17,
-    0x29, 0xA3, 0x42, 0x93, 0x05, 0x36, 0x4D, 0x0A, 0x57, 0x6E, 0x26, 0x45, 0x8A, 0x09, 0x30, 0x16,
-    0x99, 0x34, 0x29, 0x52, 0x64, 0x8A, 0xDD, 0x5E, 0xC0, 0x6A, 0x01, 0x67, 0x5C, 0xCC, 0x16, 0x59,
-    0x60, 0x8A, 0xB1, 0x49, 0x61, 0x81, 0xA4, 0x25, 0x16, 0x58, 0xA4, 0xD8, 0x22, 0x34, 0x20, 0x20,
-    0x3F, 0x2E, 0xCC, 0x82, 0x49, 0x9E, 0x24, 0x92, 0x37, 0xDF, 0x77, 0xCE, 0xE5, 0x9B, 0x37, 0x92,
-    0x2C, 0xDB, 0x90, 0x56, 0xF2, 0x68, 0x66, 0xDE, 0x39, 0x7C, 0xE4, 0xE5, 0xBD, 0xE7, 0x9C, 0x7B,
-    0xEE, 0xF9, 0xBB, 0x77, 0x8C, 0x49, 0xEB, 0xAC, 0xC5, 0x6F, 0x13, 0xE5, 0x06, 0x3F, 0x17, 0x4C,
-    0x9C, 0xBB, 0xDF, 0x92, 0xBF, 0x49, 0x99, 0xD4, 0xFC, 0x4D, 0xDD, 0x6F, 0x56, 0x67, 0x4D, 0xD6,
-    0xA4, 0x8D, 0x31, 0xDF, 0x66, 0xF3, 0xBD, 0x19, 0x44, 0xF6, 0xC0, 0x98, 0xCA, 0x8E, 0xC6, 0x1F,
-    0x7F, 0x62, 0xF3, 0xB0, 0xDB, 0x2B, 0xCA, 0xB8, 0xDD, 0xCB, 0xF2, 0xA4, 0xDE, 0xDB, 0xC6, 0x10,
-    0x68, 0x92, 0x09, 0x28, 0x3F, 0x0D, 0xF0, 0xA9, 0xB4, 0x4B, 0x1A, 0x80, 0xB8, 0xDB, 0x0B, 0x4C,
-    0x30, 0xEC, 0xC5, 0xB9, 0x67, 0xA7, 0x0A, 0x8F, 0xD1, 0xB3, 0xF1, 0xA6, 0x83, 0xF5, 0x21, 0x15,
-    0xF0, 0xE7, 0xA2, 0x5D, 0xA2, 0xC9, 0x7D, 0x6B, 0xCC, 0x64, 0x8A, 0xDA, 0x1B, 0x4C, 0x52, 0x07,
-    0xBD, 0x89, 0xEB, 0xA0, 0x33, 0x71, 0x09, 0x70, 0xC1, 0x00, 0x18, 0x83, 0x7B, 0xC6, 0xF8, 0x68,
-    0x6A, 0xD0, 0x04, 0x3F, 0x04, 0x97, 0xA7, 0x9D, 0x6B, 0xE8, 0xDD, 0x76, 0xE6, 0x72, 0xF1, 0x6F,
-    0xD7, 0x40, 0x02, 0xA5, 0x90, 0x94, 0x00, 0x71, 0x7D, 0x06, 0x24, 0x7C, 0x90, 0xF1, 0xB5, 0x7D,
-    0x63, 0x36, 0xBC, 0xFB, 0x77, 0xCD, 0xEB, 0x91, 0xB5, 0xF7, 0x86, 0xF4, 0x3E, 0x5E, 0xFE, 0x96,
-    0xB9, 0x62, 0xD9, 0xE8, 0x6B, 0x4A, 0xCF, 0x96, 0x97, 0xC7, 0x26, 0x4B, 0xA7, 0xCC, 0xC4, 0xD6,
-    0x0E, 0x26, 0xEC, 0x30, 0x72, 0x54, 0x9B, 0xA5, 0x89, 0xF1, 0xCC, 0x24, 0xC6, 0x2C, 0xCC, 0xAB,
-    0x04, 0x72, 0x25, 0xF7, 0xE2, 0xD2, 0x1C, 0x9B, 0xB0, 0xF5, 0x41, 0xF0, 0x74, 0x34, 0x98, 0xAC,
-    0x98, 0x0A, 0xF4, 0x72, 0x2D, 0xD6, 0xFE, 0x2A, 0x5B, 0xA7, 0xB6, 0x54, 0x18, 0x0F, 0xC6, 0x1F,
-    0x20, 0x1A, 0xE3, 0x75, 0xBC, 0xF0, 0x5B, 0x32, 0x1D, 0x60, 0xF0, 0xCA, 0x84, 0x20, 0x3B, 0xC3,
-    0xCC, 0x51, 0x90, 0x09, 0xE9, 0x6E, 0x16, 0x84, 0x2D, 0x08, 0x06, 0x0D, 0xBD, 0x48, 0x80, 0x72,
-    0xF0, 0x26, 0x4C, 0x9F, 0x67, 0xAD, 0x6D, 0x1D, 0xE4, 0x6B, 0x66, 0x86, 0x3B, 0x15, 0xE4, 0xE0,
-    0xEE, 0xE3, 0x3A, 0x3F, 0xFB, 0xD4, 0x14, 0x02, 0x2B, 0x72, 0xFB, 0x9A, 0xBD, 0xC7, 0xDB, 0xD6,
-    0xE6, 0xE6, 0xED, 0xE3, 0x33, 0x3F, 0x6F, 0xBB, 0x89, 0x39, 0x7B, 0xF7, 0xD8, 0x5C, 0xB8, 0xCE,
-    0x1E, 0x6C, 0x09, 0x2D, 0xD9, 0xED, 0x4C, 0xD4, 0x04, 0x10, 0x49, 0xED, 0x2D, 0xC9, 0xBE, 0x80,
-    0xD6, 0x09, 0x9C, 0x24, 0x45, 0x23, 0x09, 0xB6, 0x0D, 0x75, 0x0B, 0x97, 0xAF, 0x82, 0x77, 0xB3,
-    0xF0, 0x6D, 0x0F, 0x91, 0xA5, 0x83, 0xD9, 0x36, 0xA1, 0x85, 0xE6, 0x98, 0x2A, 0x4F, 0x3B, 0x32,
-    0x3D, 0x61, 0x82, 0x02, 0xDB, 0x62, 0x96, 0xAA, 0x09, 0xBC, 0x27, 0xA2, 0x2F, 0x54, 0x0B, 0x93,
-    0x10, 0xF8, 0x32, 0xE1, 0x1F, 0x18, 0x5F, 0x24, 0x9E, 0x13, 0x94, 0x14, 0x7B, 0x8D, 0xD9, 0x8C,
-    0x5B, 0xAF, 0x37, 0xE1, 0x74, 0xD4, 0x52, 0xD0, 0xE0, 0xCE, 0xCB, 0xD9, 0xE8, 0xB8, 0xF2, 0x86,
-    0xCA, 0x1F, 0x0B, 0x33, 0x6C, 0x98, 0x4B, 0xB3, 0xA2, 0x99, 0x5D, 0x4B, 0x31, 0x86, 0x90, 0x0E,
-    0x64, 0x9D, 0xDE, 0x31, 0x57, 0xF0, 0x95, 0x74, 0x7E, 0xA8, 0x1A, 0x96, 0x94, 0x51, 0xED, 0x55,
-    0x6D, 0xD8, 0xC4, 0x79, 0x72, 0x7F, 0xF4, 0xBB, 0x4D, 0x3C, 0x28, 0x4C, 0xBF, 0x05, 0x16, 0xB7,
-    0xCD, 0xFE, 0x3E, 0xDA, 0x7C, 0xCD, 0x6C, 0x1D, 0x4B, 0xD3, 0x45, 0x1F, 0x92, 0xCB, 0xCD, 0x3E,
-    0x12, 0xD4, 0x45, 0xCD, 0xDA, 0x37, 0x87, 0x8E, 0x43, 0x69, 0xB9, 0x2F, 0x2F, 0x6C, 0x6D, 0x41,
-    0x75, 0x7D, 0xB3, 0xBF, 0x8D, 0xF9, 0x7E, 0xD5, 0x2C, 0x13, 0x93, 0xFD, 0x79, 0xF0, 0xBA, 0xB8,
-    0x0E, 0x6D, 0x1B, 0x34, 0xD2, 0x02, 0x2C, 0x91, 0x96, 0x02, 0x73, 0xD2, 0x98, 0x70, 0x49, 0xC1,
-    0x7D, 0x4C, 0xF9, 0x41, 0xE2, 0x77, 0x85, 0xFA, 0x1D, 0x59, 0x2B, 0x07, 0x26, 0xF9, 0x43, 0x6F,
-    0xD2, 0x72, 0x30, 0x51, 0x3E, 0xC8, 0x32, 0xF0, 0xAA, 0xC1, 0xA4, 0xFF, 0x3B, 0xE0, 0xCD, 0x01,
-    0x04, 0xE3, 0x83, 0xF5, 0x51, 0x84, 0x50, 0xC3, 0xB1, 0x28, 0x2F, 0xDE, 0xBC, 0xCA, 0x19, 0xBF,
-    0x84, 0x31, 0x7F, 0x6D, 0xF6, 0xFD, 0xCE, 0x5B, 0x86, 0x18, 0x2D, 0xA9, 0xE3, 0x36, 0xCB, 0xB3,
-    0xDA, 0x9A, 0xEA, 0x9F, 0x46, 0x53, 0xFC, 0x6C, 0x84, 0xCA, 0x59, 0xC3, 0x7B, 0x01, 0x48, 0x32,
-    0x4B, 0xF0, 0xB6, 0x80, 0x82, 0x26, 0x66, 0xEF, 0x9D, 0xC3, 0xC3, 0xC3, 0xBC, 0xA2, 0xC0, 0x70,
-    0x75, 0xC4, 0x85, 0x15, 0x7D, 0x36, 0xB8, 0x60, 0xAE, 0x1E, 0xDE, 0xCA, 0xEC, 0x32, 0x93, 0x19,
-    0xFC, 0x02, 0xD2, 0xBF, 0xBD, 0xB3, 0x63, 0x20, 0xFD, 0xEF, 0x62, 0x4D, 0x52, 0xFA, 0x19, 0x18,
-    0xE9, 0xB7, 0xB0, 0x6C, 0x6F, 0x40, 0xFA, 0x40, 0x19, 0xA4, 0x2F, 0x68, 0xD1, 0xCB, 0xCD, 0x4D,
-    0xA2, 0x01, 0xD2, 0x87, 0x16, 0xB7, 0xF2, 0x0D, 0x8A, 0x4D, 0x14, 0x37, 0x90, 0xBE, 0xC9, 0xD0,
-    0xED, 0x02, 0xEF, 0x41, 0xF0, 0x5B, 0xEC, 0x65, 0xA4, 0xF4, 0x33, 0x88, 0x69, 0x99, 0xF8, 0xB6,
-    0xCD, 0x3E, 0xEA, 0xE2, 0xDF, 0x1C, 0xDE, 0x7C, 0xE9, 0xDF, 0xBF, 0x80, 0xF4, 0xAF, 0x42, 0x1A,
-    0x60, 0xCC, 0xDA, 0x9E, 0x57, 0x37, 0x79, 0xDB, 0x43, 0xA3, 0x08, 0x7C, 0x26, 0xE5, 0x07, 0x4A,
-    0x1A, 0xA4, 0x36, 0x7F, 0xF8, 0x9D, 0xF7, 0xF9, 0xDC, 0x93, 0xCE, 0xF8, 0xC2, 0x35, 0x2A, 0x74,
-    0xFB, 0x18, 0xF0, 0xCE, 0xFB, 0xF7, 0x66, 0x99, 0xF3, 0xEA, 0xF1, 0x8D, 0x8D, 0x77, 0x60, 0x1E,
-    0xFC, 0x91, 0x77, 0x05, 0xF8, 0x54, 0x97, 0x8F, 0x97, 0xC2, 0x7C, 0x06, 0xCD, 0x7B, 0x19, 0xC2,
-    0x56, 0xA1, 0x43, 0x75, 0xA0, 0xD6, 0x22, 0x79, 0xD8, 0x36, 0xB3, 0xC9, 0xE5, 0x8E, 0xAF, 0x4D,
-    0x88, 0xF5, 0x15, 0xD1, 0x2A, 0x80, 0x71, 0x6B, 0x2E, 0x63, 0x42, 0x7C, 0x4C, 0x57, 0xCA, 0x3E,
-    0xBC, 0xD1, 0x50, 0x7B, 0xDF, 0x98, 0xDF, 0x87, 0x59, 0xF4, 0xA0, 0x12, 0xC2, 0x99, 0xCF, 0x7B,
-    0x95, 0x08, 0xF0, 0xDB, 0xF8, 0xEC, 0xE1, 0xFA, 0x06, 0xDA, 0xA7, 0x98, 0x72, 0x1F, 0x2C, 0x78,
-    0x87, 0xC1, 0x10, 0x76, 0x71, 0x93, 0x62, 0xC1, 0xBA, 0xE5, 0x58, 0xB0, 0xFD, 0x93, 0x83, 0xDC,
-    0x80, 0xD2, 0xD2, 0x03, 0xA8, 0x03, 0xA8, 0x73, 0x9F, 0x14, 0xE0, 0x7C, 0x4A, 0xFB, 0x93, 0xAA,
-    0x8F, 0xFA, 0x93, 0x0B, 0x50, 0xFE, 0x13, 0x8E, 0x26, 0x80, 0x34, 0xA2, 0x39, 0x29, 0xE5, 0x64,
-    0x54, 0x9C, 0xF7, 0xAC, 0x9D, 0x3D, 0x86, 0xF9, 0x3E, 0x75, 0x9D, 0xEA, 0x69, 0xCB, 0xC4, 0x4E,
-    0x3F, 0x80, 0x1E, 0xD9, 0x21, 0xAC, 0x1D, 0x2C, 0x1E, 0x0B, 0xB5, 0x4D, 0x2A, 0x30, 0x16, 0x18,
-    0x08, 0x34, 0xFF, 0x72, 0x42, 0x68, 0xB6, 0xFE, 0xDF, 0xE0, 0x7E, 0x08, 0x56, 0xBE, 0x3E, 0x84,
-    0x50, 0xD2, 0x74, 0x08, 0x6D, 0xA9, 0xC2, 0x4D, 0x21, 0x8E, 0x0A, 0xBF, 0x99, 0x1A, 0xC4, 0xA0,
-    0x84, 0x77, 0x32, 0xE1, 0xA8, 0xFA, 0x2D, 0x7F, 0x95, 0x81, 0x6B, 0xAB, 0xC0, 0xFC, 0x4B, 0x74,
-    0x0A, 0xA1, 0xCD, 0x8B, 0x22, 0xFF, 0x26, 0x9A, 0x3F, 0xF6, 0x2F, 0xB5, 0x23, 0x34, 0xC2, 0x83,
-    0x52, 0xC5, 0xF7, 0x61, 0x5F, 0x72, 0x9A, 0xC7, 0x0C, 0x2A, 0xC5, 0xAB, 0xB4, 0x9C, 0x3F, 0x37,
-    0xF0, 0x9D, 0xAA, 0xCF, 0x6F, 0x54, 0x7D, 0x73, 0x58, 0x62, 0xD2, 0x73, 0x78, 0xC4, 0x16, 0x84,
-    0xD1, 0x53, 0xDC, 0x30, 0x11, 0x6D, 0x4D, 0x9F, 0x34, 0xFE, 0x18, 0x75, 0xC6, 0xC2, 0x1F, 0xDA,
-    0x70, 0xE9, 0x0F, 0x31, 0x5C, 0x6D, 0x52, 0x47, 0x0D, 0x3C, 0x6F, 0xF9, 0x2E, 0x94, 0xAD, 0x37,
-    0x7B, 0xBE, 0x92, 0x08, 0xAD, 0x53, 0xFD, 0xDA, 0xA7, 0x05, 0x01, 0x46, 0xB7, 0x15, 0x98, 0x81,
-    0x95, 0x32, 0xDF, 0x04, 0x0E, 0x5A, 0x55, 0x29, 0x91, 0x49, 0x21, 0xCB, 0x59, 0x70, 0xE2, 0x54,
-    0x6D, 0xDB, 0xE1, 0x7D, 0x87, 0x97, 0x8A, 0xF1, 0xFA, 0x7B, 0xC4, 0x41, 0x0B, 0x12, 0x80, 0xC3,
-    0x3A, 0x24, 0x66, 0xF4, 0x04, 0x9B, 0x6A, 0x47, 0xAC, 0xE3, 0x01, 0x8B, 0xE0, 0xFA, 0xB6, 0xF9,
-    0xAF, 0x41, 0x83, 0x87, 0x8F, 0x04, 0x2F, 0x83, 0xDB, 0xC4, 0x5E, 0x17, 0xBD, 0x49, 0x1C, 0xB4,
-    0xAF, 0x4A, 0x4C, 0x12, 0xD6, 0x58, 0x38, 0x4B, 0x8E, 0x7E, 0xF5, 0xFD, 0xE9, 0x96, 0x8C, 0x2E,
-    0xF7, 0xB7, 0x1D, 0xDE, 0x77, 0x18, 0x4D, 0x52, 0x67, 0x0F, 0x2E, 0xEF, 0xE4, 0xC2, 0xDF, 0xB1,
-    0xE3, 0xAF, 0x57, 0xFE, 0x10, 0x4A, 0x08, 0x7F, 0x41, 0xA3, 0xFC, 0x45, 0x33, 0x5F, 0xB9, 0xE2,
-    0xD4, 0xF1, 0xB1, 0x70, 0xF8, 0xC4, 0xE1, 0x5E, 0x31, 0x5F, 0x17, 0xBE, 0x9A, 0xF4, 0x2E, 0x71,
-    0x74, 0x7B, 0xAA, 0x4A, 0xE0, 0xF8, 0x2D, 0x2C, 0x42, 0xF0, 0x97, 0xC2, 0xCE, 0xB7, 0xE0, 0x6F,
-    0xE1, 0xDD, 0x8C, 0x5A, 0xF0, 0x77, 0xE2, 0xBC, 0x76, 0xAF, 0xE1, 0x12, 0x5F, 0xE7, 0x9A, 0xE0,
-    0xE8, 0x0C, 0x9A, 0x38, 0x3A, 0x47, 0xC0, 0xE8, 0xD2, 0x73, 0xEA, 0x0C, 0xFD, 0x82, 0xAC, 0xFD,
-    0x48, 0x9E, 0xF5, 0xE6, 0x3F, 0x09, 0x02, 0xC6, 0x62, 0x68, 0x13, 0x12, 0x53, 0x42, 0x3B, 0x3B,
-    0xD7, 0x68, 0x40, 0xE0, 0xAD, 0xC5, 0x88, 0xB0, 0x29, 0x0D, 0x09, 0x47, 0xA2, 0x31, 0x61, 0x77,
-    0x34, 0x28, 0x41, 0xA3, 0x21, 0x9D, 0xF0, 0xC9, 0xE8, 0x8F, 0x8A, 0x0B, 0xE3, 0x92, 0x3A, 0x13,
-    0x2B, 0x7C, 0xC2, 0xC8, 0x9C, 0xA8, 0x81, 0x53, 0x3E, 0x4D, 0xE1, 0x77, 0xFE, 0x4D, 0x1A, 0x9C,
-    0xA0, 0x89, 0x3B, 0x1A, 0x9D, 0xA8, 0x4E, 0x3A, 0x1A, 0x9E, 0x38, 0xCF, 0x3A, 0x1A, 0x9F, 0xD4,
-    0xFC, 0xAD, 0xA3, 0x01, 0x5A, 0xF8, 0xBF, 0x13, 0x72, 0x4E, 0x82, 0x9F, 0x0B, 0xEE, 0x63, 0xF1,
-    0xCD, 0x7E, 0xF7, 0x86, 0xE0, 0xA0, 0xD9, 0x13, 0x1C, 0xD5, 0x1A, 0x38, 0xC5, 0xF9, 0xE1, 0xD1,
-    0xBD, 0x03, 0xE1, 0x53, 0x7D, 0xB8, 0xC3, 0x27, 0x0E, 0xF7, 0x2E, 0xD6, 0xA0, 0x5B, 0xD8, 0xD1,
-    0x15, 0x87, 0x58, 0xC8, 0x50, 0x77, 0xA2, 0x41, 0xB1, 0xDF, 0xAF, 0x19, 0x64, 0x98, 0x7C, 0xE8,
-    0xBE, 0x28, 0xEB, 0xFC, 0x89, 0x3A, 0xB1, 0x42, 0xC1, 0x84, 0xD1, 0xD0, 0x94, 0x21, 0x79, 0x56,
-    0x6B, 0x7C, 0x56, 0xA9, 0x2A, 0x5C, 0xE3, 0xB4, 0xE2, 0x33, 0x66, 0x25, 0x18, 0x6A, 0x82, 0x21,
-    0x98, 0xAA, 0x5E, 0xC2, 0x2F, 0x11, 0xEC, 0xAF, 0xB4, 0x6B, 0xAB, 0x28, 0xD3, 0xBB, 0x12, 0x7F,
-    0xA9, 0x55, 0x37, 0x4E, 0xA9, 0x1E, 0xFA, 0x51, 0x9F, 0x2C, 0x06, 0xDB, 0xC8, 0xF8, 0xC6, 0x2D,
-    0x29, 0x10, 0x55, 0x09, 0x53, 0xB1, 0xF6, 0x96, 0xA4, 0xD2, 0xDB, 0x22, 0x91, 0xB9, 0xD9, 0x8A,
-    0x55, 0x82, 0x91, 0x0A, 0x30, 0x90, 0x40, 0xBC, 0xE3, 0xB2, 0x81, 0x1F, 0x92, 0xDE, 0x30, 0x87,
-    0x93, 0x2C, 0x02, 0x21, 0x0A, 0x2B, 0x90, 0xCC, 0x20, 0x84, 0x66, 0x6C, 0x9D, 0x2A, 0x5A, 0x30,
-    0x41, 0x90, 0x75, 0xC0, 0xDE, 0x8E, 0x55, 0x0C, 0x54, 0xF9, 0xA5, 0x08, 0x05, 0xBD, 0x91, 0xF4,
-    0x60, 0x14, 0x31, 0xC3, 0x9E, 0x1F, 0x4D, 0xA5, 0x39, 0xB2, 0x77, 0xF8, 0xAE, 0x95, 0xE8, 0xC1,
-    0x7F, 0x4F, 0x09, 0x55, 0xE9, 0xC6, 0xBA, 0x86, 0x34, 0xB4, 0x35, 0xEF, 0x2A, 0x7F, 0x8E, 0xF7,
-    0xFC, 0x85, 0x61, 0xDA, 0xF1, 0xEC, 0xA8, 0x8E, 0x55, 0xF1, 0xD2, 0x5F, 0x0A, 0x9D, 0x37, 0x74,
-    0xAA, 0x7B, 0x9D, 0xEA, 0x7C, 0x2D, 0xD6, 0x3D, 0xE7, 0x4C, 0x7F, 0xC3, 0xA9, 0x77, 0x1B, 0x4B,
-    0x1E, 0x31, 0x32, 0x40, 0x09, 0x7E, 0x6A, 0xC5, 0xCA, 0xE6, 0x69, 0xFF, 0x82, 0xE9, 0xF5, 0xB1,
-    0x27, 0xA3, 0x4F, 0x32, 0xFA, 0x8C, 0x46, 0xC9, 0x78, 0xC5, 0x75, 0xBE, 0x60, 0xAB, 0x58, 0x7F,
-    0x42, 0xA5, 0x3A, 0xF9, 0x44, 0x09, 0x94, 0x68, 0x16, 0x41, 0x42, 0xA7, 0x48, 0xBE, 0x2D, 0xC4,
-    0xAF, 0x23, 0x1F, 0xAC, 0xD7, 0x5E, 0x38, 0x6F, 0xDC, 0x32, 0xA2, 0x94, 0x45, 0x2B, 0x17, 0x24,
-    0x33, 0x3C, 0x42, 0xE0, 0x28, 0x55, 0x0A, 0x90, 0x2B, 0xA1, 0xCA, 0x26, 0x2E, 0x58, 0x00, 0x30,
-    0x5B, 0xBC, 0x20, 0x0F, 0xC7, 0xB8, 0x08, 0x78, 0xA7, 0x53, 0x96, 0x40, 0xB1, 0xBB, 0x08, 0x6A,
-    0x77, 0x11, 0x95, 0xEE, 0x22, 0x31, 0xEE, 0x62, 0x41, 0xA2, 0x3B, 0x89, 0x34, 0xDC, 0x45, 0xEF,
-    0x1E, 0x81, 0x54, 0xBD, 0x08, 0x94, 0x2B, 0x4D, 0xC4, 0xE4, 0x02, 0xBE, 0x56, 0x1F, 0x25, 0xC6,
-    0x5D, 0x2C, 0xF4, 0xE2, 0x26, 0x1D, 0x1E, 0x2F, 0x3A, 0xF2, 0x2B, 0x17, 0xF4, 0xD7, 0xF0, 0x53,
-    0x7E, 0x17, 0xEA, 0x45, 0xD4, 0x55, 0x53, 0xF9, 0x12, 0xF9, 0xEA, 0xD0, 0x5B, 0x22, 0x17, 0x2E,
-    0xCF, 0xA9, 0xC0, 0x6A, 0x42, 0x09, 0x54, 0x65, 0x38, 0x42, 0xD8, 0xDE, 0x14, 0xA2, 0x97, 0x89,
-    0x42, 0xFC, 0x80, 0xEE, 0xEE, 0x87, 0xF4, 0x77, 0xE2, 0xF4, 0x54, 0x16, 0x32, 0x8F, 0xF6, 0xD3,
-    0x80, 0x3C, 0xAD, 0x24, 0xAA, 0x5B, 0xBD, 0xC6, 0x5E, 0x4C, 0x22, 0x8E, 0x1B, 0x33, 0xFB, 0x15,
-    0xEA, 0xC5, 0xB6, 0xB1, 0xCD, 0xC5, 0x81, 0xF9, 0x4B, 0x8F, 0x5C, 0x99, 0xC2, 0x4E, 0x98, 0x6F,
-    0xC5, 0x07, 0x73, 0x29, 0x41, 0x6B, 0x47, 0xE3, 0x5C, 0x40, 0x62, 0x65, 0x81, 0x55, 0x09, 0x04,
-    0x19, 0x68, 0xFB, 0xB2, 0xE4, 0x52, 0xAA, 0x34, 0xBA, 0xF8, 0xA4, 0x91, 0x0B, 0x1F, 0x35, 0xF8,
-    0x32, 0xDE, 0x4A, 0x81, 0x91, 0x21, 0xD9, 0xD1, 0x41, 0xDF, 0x1A, 0x86, 0x35, 0x56, 0x84, 0xB7,
-    0x82, 0x6F, 0x08, 0x7C, 0x65, 0x76, 0xD3, 0x9F, 0x0A, 0x65, 0x26, 0x54, 0x39, 0x3E, 0xA3, 0xE5,
-    0x0C, 0x7D, 0x26, 0x3E, 0x54, 0x19, 0x2B, 0xB1, 0x98, 0xA5, 0xF2, 0x22, 0x0B, 0x42, 0xD0, 0xBD,
-    0x6B, 0xE7, 0xF4, 0x4F, 0x74, 0xED, 0x50, 0x68, 0x9E, 0xE6, 0x18, 0x05, 0xAD, 0x65, 0x49, 0x89,
-    0xD6, 0x69, 0x58, 0xB5, 0xE6, 0x34, 0xCE, 0x03, 0x47, 0x57, 0xCB, 0x55, 0x06, 0x67, 0x44, 0xD9,
-    0x82, 0xBF, 0x90, 0xAF, 0xA8, 0x79, 0x57, 0x54, 0x98, 0x11, 0xFF, 0xC6, 0xE9, 0x24, 0x9D, 0x03,
-    0x8E, 0xE2, 0x9C, 0xEA, 0x95, 0xD6, 0xD5, 0x0A, 0x26, 0x75, 0x21, 0x8A, 0xB6, 0x71, 0xD6, 0xE6,
-    0x7F, 0xF9, 0x79, 0x79, 0x27, 0xE7, 0xCA, 0x44, 0x2A, 0x41, 0x93, 0xB8, 0x14, 0xAA, 0x36, 0x94,
-    0xF2, 0x11, 0x7F, 0xBE, 0x95, 0x4E, 0x9E, 0xE0, 0x0F, 0x3D, 0xEC, 0xDA, 0x3F, 0x4A, 0xA1, 0xFA,
-    0x3D, 0x1A, 0x60, 0x8C, 0x94, 0x96, 0x5C, 0x9D, 0xBD, 0x0B, 0xF8, 0x9E, 0xFE, 0x40, 0x87, 0xBC,
-    0x0E, 0x6D, 0x1D, 0xFF, 0x5F, 0x9B, 0x7A, 0xFD, 0xBE, 0xD9, 0xBF, 0x24, 0x2C, 0x3D, 0xF5, 0x81,
-    0xE6, 0x9A, 0xE5, 0xB0, 0x5E, 0xB3, 0x7C, 0xEA, 0xA3, 0x40, 0x79, 0xFE, 0xE4, 0x34, 0xA9, 0xA5,
-    0xE5, 0x33, 0x57, 0x26, 0x9D, 0x5F, 0xA7, 0x0A, 0x69, 0x2B, 0x88, 0x26, 0xD0, 0x6A, 0x22, 0x63,
-    0xC5, 0xC5, 0x89, 0x0A, 0xA8, 0xBE, 0xD1, 0x96, 0x58, 0x33, 0xF7, 0x8D, 0x4F, 0x45, 0x9B, 0xBF,
-    0x42, 0x67, 0x9F, 0xAD, 0x21, 0x4F, 0x91, 0x3F, 0xAD, 0xF7, 0xE9, 0x46, 0x60, 0x0A, 0x74, 0x3A,
-    0x7A, 0x55, 0x93, 0x32, 0xFA, 0x77, 0xEA, 0x96, 0x24, 0x5B, 0x76, 0x92, 0xE9, 0xBD, 0xA8, 0xA1,
-    0x50, 0xD5, 0x87, 0xCC, 0x0F, 0xED, 0xC4, 0xE0, 0xD0, 0x6F, 0xAA, 0x49, 0xBC, 0x62, 0xB2, 0x7C,
-    0x30, 0xF2, 0x2F, 0x46, 0x7A, 0xF1, 0xBE, 0xB0, 0x82, 0x7C, 0x2A, 0x3D, 0x47, 0x57, 0x6F, 0x4E,
-    0xDB, 0x41, 0xB4, 0x14, 0xF4, 0xB7, 0x51, 0xD0, 0x5F, 0xAC, 0xA0, 0x1E, 0x9E, 0x86, 0x28, 0x6B,
-    0x04, 0xC1, 0xC7, 0x10, 0xC5, 0x4B, 0x41, 0x20, 0x9D, 0x08, 0xFC, 0x10, 0x41, 0x72, 0x82, 0xB2,
-    0x5A, 0x50, 0xD2, 0x09, 0x8A, 0x7B, 0x41, 0xC1, 0x20, 0xC8, 0xB7, 0x82, 0x8C, 0x95, 0x44, 0xD9,
-    0x64, 0x83, 0xA0, 0x54, 0x11, 0xB7, 0x04, 0x34, 0x79, 0xDC, 0xB5, 0x07, 0x74, 0x48, 0x15, 0x29,
-    0xC3, 0xB3, 0x8B, 0xB7, 0xC4, 0x68, 0xAB, 0x07, 0xD2, 0x98, 0x27, 0x5B, 0xCB, 0xF2, 0x34, 0x5E,
-    0x5A, 0xFB, 0xF1, 0x45, 0x48, 0xA9, 0x48, 0xCC, 0x96, 0x90, 0xB3, 0xD4, 0x34, 0x4A, 0xE6, 0x4A,
-    0x49, 0xC3, 0xF4, 0x3E, 0xEE, 0xE8, 0x31, 0xC3, 0x9E, 0xCE, 0x33, 0x18, 0xE8, 0x74, 0x83, 0x81,
-    0x2E, 0xD5, 0x1F, 0xE9, 0x5D, 0xFD, 0x91, 0x8E, 0xD6, 0x9F, 0xA4, 0x88, 0xFE, 0x10, 0xF4, 0x27,
-    0x6D, 0xA3, 0xED, 0xF5, 0x5D, 0xED, 0x87, 0x71, 0x41, 0xD8, 0x27, 0xD2, 0x3F, 0x43, 0xA3, 0xA4,
-    0xE1, 0xB8, 0x08, 0xC7, 0x6C, 0x4E, 0x55, 0xC9, 0xA6, 0x6A, 0x69, 0x9C, 0x2F, 0x36, 0x17, 0xAE,
-    0x09, 0xA5, 0x6A, 0xC2, 0x75, 0x2F, 0x42, 0x18, 0x93, 0x6D, 0x1D, 0x2D, 0xE2, 0x38, 0x2F, 0xBB,
-    0x71, 0x0E, 0xF9, 0x7A, 0x49, 0x2A, 0xC2, 0x9A, 0x9C, 0x64, 0x1A, 0x67, 0xDC, 0x20, 0xFD, 0x3D,
-    0x77, 0x9F, 0xC2, 0x9A, 0x61, 0x9D, 0xB7, 0xA6, 0x9E, 0xE7, 0x85, 0x2F, 0xEF, 0x5F, 0x25, 0x6C,
-    0xB0, 0xAC, 0xF0, 0x24, 0xF6, 0xA3, 0x8E, 0x71, 0x35, 0xAD, 0xC7, 0x77, 0x3C, 0xAD, 0x45, 0x6C,
-    0x9C, 0xBB, 0x99, 0x0A, 0x1A, 0x96, 0xAF, 0xA2, 0x2E, 0xA9, 0x09, 0x85, 0xA4, 0x4E, 0x16, 0x55,
-    0xEE, 0x9D, 0xDB, 0x35, 0x65, 0xCC, 0x3F, 0x20, 0x06, 0xD6, 0xEA, 0x2E, 0x78, 0x61, 0x56, 0x42,
-    0x27, 0x3C, 0x90, 0xAF, 0x8C, 0xE1, 0x44, 0x2C, 0xB9, 0x73, 0x3F, 0x5F, 0xC9, 0x3D, 0x3E, 0x95,
-    0x76, 0xF2, 0x86, 0xBC, 0xFB, 0xBA, 0x31, 0x5F, 0x3D, 0xE5, 0xDF, 0x13, 0x6D, 0x0D, 0x69, 0x90,
-    0xA7, 0xEF, 0x89, 0x20, 0xA6, 0x35, 0x41, 0x54, 0x22, 0x08, 0x4B, 0x41, 0xF8, 0xBF, 0xA7, 0x20,
-    0xC2, 0xDF, 0x52, 0x10, 0xF1, 0x5B, 0x14, 0x44, 0x22, 0x82, 0x58, 0x88, 0x20, 0xF6, 0x44, 0x10,
-    0x1D, 0x05, 0xE1, 0xB7, 0x64, 0x3E, 0xA8, 0x09, 0xA3, 0x92, 0x30, 0x16, 0x41, 0x2C, 0x44, 0x10,
-    0xFB, 0x22, 0x08, 0x1A, 0xCE, 0xEC, 0x76, 0x47, 0x41, 0xFC, 0x77, 0x4D, 0x41, 0x7C, 0x5C, 0x52,
-    0x10, 0x56, 0x04, 0x31, 0xAD, 0x09, 0xC2, 0x52, 0x10, 0xDE, 0x5F, 0x29, 0x88, 0xA0, 0xA1, 0x20,
-    0x7C, 0xB7, 0xBA, 0xDE, 0x51, 0x9C, 0x69, 0x5A, 0x14, 0xB7, 0x67, 0xCA, 0x62, 0xCE, 0x4F, 0x68,
-    0xF0, 0xBB, 0x6E, 0x69, 0xE0, 0x6B, 0x91, 0x3A, 0xF4, 0x0E, 0x49, 0xDD, 0x52, 0x7D, 0x1E, 0x13,
-    0xA1, 0xE7, 0x81, 0x8E, 0xB5, 0x1A, 0xB8, 0x94, 0x14, 0x89, 0xD9, 0x26, 0x1C, 0x12, 0xB9, 0x48,
-    0xEE, 0x4A, 0x3A, 0xC6, 0x14, 0x4E, 0x37, 0x7C, 0x7A, 0x2D, 0xB6, 0x3A, 0xA5, 0xD5, 0x82, 0x51,
-    0xD8, 0xAF, 0x33, 0x9F, 0x96, 0x6B, 0x99, 0x8C, 0xAB, 0x9F, 0xAE, 0x57, 0x16, 0x5E, 0x10, 0xDE,
-    0x0F, 0x55, 0x6D, 0xD5, 0x32, 0x05, 0x5A, 0x64, 0x8F, 0xFE, 0x20, 0x13, 0x9F, 0xE4, 0x4B, 0x9D,
-    0xF6, 0x85, 0x26, 0x3D, 0x1B, 0x2F, 0x18, 0xEF, 0x9B, 0xBA, 0xBB, 0x91, 0xE5, 0x93, 0x56, 0x84,
-    0x15, 0x69, 0xAE, 0xBB, 0x71, 0xB6, 0x32, 0xF8, 0x02, 0x4D, 0xB8, 0x46, 0x49, 0x2E, 0x69, 0x9F,
-    0xEB, 0x20, 0x1A, 0x27, 0xB9, 0xDD, 0x02, 0xEF, 0xE1, 0x8A, 0x70, 0x66, 0x07, 0xCF, 0xDA, 0xDC,
-    0xA1, 0xC0, 0x6A, 0x05, 0x81, 0xF1, 0x68, 0x2B, 0x55, 0x06, 0xBA, 0xEA, 0x4C, 0x4B, 0x33, 0x30,
-    0xC2, 0x89, 0xF6, 0x4F, 0xB5, 0x09, 0x25, 0x04, 0x64, 0x94, 0x26, 0x44, 0x58, 0x0D, 0xC2, 0xAA,
-    0xB7, 0x64, 0xD8, 0xEC, 0x17, 0x5A, 0x83, 0xFA, 0xBD, 0x52, 0xA4, 0xB5, 0xB9, 0x70, 0x30, 0xA7,
-    0xB9, 0xF7, 0x17, 0x41, 0xFA, 0x5E, 0x24, 0xC8, 0xAF, 0xEC, 0x2D, 0xAD, 0xDD, 0x50, 0x3A, 0xB4,
-    0xC1, 0x0E, 0xFA, 0x5A, 0x0D, 0x3E, 0x93, 0xAC, 0xED, 0xB8, 0x5A, 0x53, 0xCE, 0xEB, 0x4A, 0x22,
-    0xF9, 0x48, 0xC2, 0x6C, 0x17, 0xC0, 0x7F, 0x8E, 0x3F, 0x8D, 0xF1, 0x35, 0x46, 0x17, 0x13, 0x7F,
-    0xA8, 0x09, 0xE3, 0xDD, 0x47, 0xA5, 0x87, 0x4A, 0xC3, 0xAE, 0x24, 0x16, 0x95, 0xD5, 0x40, 0xF5,
-    0xE2, 0x7F, 0xC8, 0x2A, 0x94, 0xF3, 0x1F, 0x7D, 0xA8, 0xD5, 0xA3, 0x51, 0x2A, 0xF5, 0xC5, 0xBC,
-    0x09, 0x59, 0xC9, 0xD7, 0x4A, 0xAC, 0xB9, 0xC0, 0xD4, 0x22, 0xBC, 0x28, 0x5F, 0x46, 0x26, 0x71,
-    0x88, 0xFB, 0x52, 0xA8, 0xA9, 0xA4, 0x0A, 0x53, 0x89, 0xE1, 0x9E, 0xAF, 0xE5, 0xBE, 0x67, 0x65,
-    0xA3, 0x44, 0x92, 0x03, 0x78, 0x25, 0x39, 0x3F, 0x03, 0x12, 0xD1, 0x4F, 0xD1, 0x11, 0x82, 0xE8,
-    0x4A, 0x44, 0x59, 0x05, 0x25, 0x82, 0xCB, 0x2A, 0x14, 0x18, 0xF1, 0x60, 0x91, 0x0D, 0xDB, 0xB0,
-    0x7B, 0xCD, 0x06, 0xE3, 0x6E, 0x93, 0x31, 0x6B, 0x99, 0x37, 0xE5, 0xC5, 0x72, 0x48, 0x25, 0x4A,
-    0x94, 0x48, 0xCA, 0x24, 0x5E, 0xEF, 0x8E, 0x0C, 0xAD, 0xB9, 0x09, 0x51, 0xBC, 0x0A, 0x01, 0x50,
-    0x30, 0xFD, 0x60, 0xA0, 0x91, 0x1D, 0x59, 0x11, 0xAC, 0x18, 0xBD, 0x72, 0xD7, 0x86, 0xDC, 0x99,
-    0x15, 0xB8, 0x70, 0x68, 0xE5, 0x34, 0x8E, 0x89, 0xEE, 0xE2, 0x2B, 0x74, 0xA9, 0xA0, 0x5E, 0x15,
-    0xCA, 0xF3, 0x0C, 0x2C, 0xEE, 0x21, 0xE1, 0x49, 0xDA, 0x24, 0xCB, 0x63, 0x3B, 0x64, 0x77, 0x7C,
-    0xDB, 0xA5, 0x4B, 0x73, 0xF9, 0xD4, 0x98, 0xCB, 0x7E, 0x87, 0xD4, 0x34, 0x65, 0xAF, 0xE3, 0xDD,
-    0xD5, 0x3E, 0x47, 0xFE, 0x7C, 0xA8, 0xF2, 0xDE, 0x13, 0x6D, 0x9C, 0xB7, 0x23, 0x64, 0x33, 0x62,
-    0x3B, 0xE8, 0xDC, 0x46, 0xC4, 0xE9, 0x42, 0x7B, 0xB6, 0x54, 0x7D, 0x63, 0xDE, 0x31, 0xF0, 0xB9,
-    0x73, 0x1B, 0xDC, 0x86, 0x65, 0x0B, 0xDC, 0x5E, 0x41, 0xFE, 0x5C, 0x08, 0x3A, 0x66, 0xB9, 0x74,
-    0x84, 0x16, 0x7A, 0x04, 0x66, 0xA0, 0x06, 0x3F, 0x50, 0xCE, 0x7F, 0xC6, 0xDA, 0xF4, 0xB6, 0x44,
-    0xF2, 0x34, 0x6B, 0xFF, 0x0C, 0x6D, 0xE2, 0x21, 0x1F, 0xB3, 0x65, 0x66, 0x90, 0x7E, 0xB7, 0x75,
-    0x4F, 0xE7, 0xDD, 0xC5, 0x67, 0xAE, 0x57, 0x3B, 0xC6, 0xBB, 0xAE, 0x03, 0x72, 0xA3, 0x13, 0x63,
-    0x4E, 0xF6, 0xA8, 0xE7, 0xB0, 0xF0, 0x50, 0x83, 0x8C, 0xCC, 0x82, 0x3D, 0x07, 0xAF, 0xDD, 0xF8,
-    0x5A, 0xB2, 0x27, 0x90, 0x1D, 0x00, 0xC5, 0x20, 0x84, 0xE5, 0x28, 0xCF, 0x6A, 0xC9, 0x9D, 0xE4,
-    0xC8, 0xC9, 0xC0, 0x56, 0x49, 0x25, 0x51, 0xB9, 0xEE, 0x9A, 0x4A, 0x49, 0x99, 0xB8, 0x56, 0x0C,
-    0x23, 0xE2, 0x91, 0xC0, 0x4F, 0x10, 0x13, 0x93, 0xC6, 0xDF, 0x8E, 0xE6, 0x43, 0x6E, 0x08, 0x78,
-    0x3C, 0x0A, 0xE8, 0xC3, 0xFC, 0xCA, 0xC6, 0x3D, 0x89, 0x25, 0x9D, 0x3C, 0x11, 0x57, 0xD9, 0x32,
-    0x9C, 0x76, 0xFB, 0xB8, 0x65, 0xD8, 0xEE, 0x0F, 0x59, 0xEE, 0x2D, 0x0B, 0xE3, 0x1D, 0x54, 0xCE,
-    0x3C, 0x4E, 0x6B, 0x1F, 0x57, 0x0C, 0xD1, 0x83, 0x32, 0xB9, 0x8C, 0xB7, 0x81, 0xA8, 0xF9, 0xF5,
-    0xF8, 0xAE, 0x37, 0xC8, 0xCE, 0xB9, 0x30, 0x8D, 0xFE, 0x83, 0x3B, 0x5A, 0x28, 0x91, 0xE5, 0xCE,
-    0xC8, 0x8D, 0x07, 0x1B, 0x69, 0x39, 0x19, 0xFC, 0xF6, 0xC6, 0xFF, 0xD5, 0xCA, 0xF8, 0x8A, 0x3D,
-    0x48, 0xEA, 0x55, 0xF6, 0xDC, 0x9F, 0x29, 0xE8, 0x4A, 0x6E, 0xC0, 0xAD, 0xEA, 0x60, 0x3A, 0x02,
-    0x43, 0x2D, 0xB4, 0x30, 0xE5, 0x09, 0x4B, 0xBC, 0x35, 0xB1, 0x3F, 0x4B, 0x52, 0x2A, 0xA9, 0xB9,
-    0xC8, 0xEE, 0x84, 0x03, 0xAB, 0xDE, 0xD5, 0xE1, 0xAE, 0x92, 0x75, 0xC8, 0x6D, 0x83, 0x42, 0x7C,
-    0x05, 0x13, 0xEC, 0x51, 0x1C, 0xB4, 0xBF, 0xB2, 0x23, 0x2D, 0xB3, 0xA6, 0x09, 0x70, 0xBA, 0x32,
-    0x53, 0xE3, 0x6C, 0x41, 0x79, 0xC0, 0x71, 0xAD, 0x6E, 0xFE, 0x6C, 0xA9, 0x12, 0xA2, 0xA4, 0x36,
-    0x94, 0xC9, 0x69, 0x33, 0x9E, 0x1A, 0xE9, 0x63, 0xCA, 0x19, 0x92, 0x5E, 0xCB, 0xC7, 0x9F, 0x29,
-    0x55, 0x7E, 0x8B, 0x0C, 0x34, 0xEC, 0xE3, 0x86, 0x80, 0xE5, 0x52, 0xA6, 0x69, 0x0F, 0x64, 0x9F,
-    0xCF, 0x94, 0xA0, 0xAB, 0x25, 0x27, 0x0E, 0x0B, 0x8C, 0x07, 0x17, 0x4E, 0xE4, 0x40, 0x98, 0xB7,
-    0x0A, 0x96, 0xCC, 0x15, 0x0D, 0x0C, 0xAA, 0xCF, 0xFD, 0x67, 0xF3, 0xD7, 0xEC, 0xDD, 0x0C, 0xC1,
-    0x00, 0x2C, 0x49, 0x20, 0x0B, 0x17, 0x0C, 0xA6, 0xE2, 0x4A, 0x2F, 0x3D, 0x8D, 0x6E, 0xA5, 0x2A,
-    0x1B, 0x68, 0x55, 0xF6, 0xCD, 0xD3, 0xAA, 0xEC, 0x13, 0x76, 0x7B, 0x5A, 0x83, 0xF5, 0xCE, 0x9C,
-    0x1B, 0x7D, 0x22, 0x52, 0x73, 0x6E, 0x47, 0x2C, 0x99, 0x57, 0xDB, 0x9F, 0xF1, 0x80, 0x88, 0x1C,
-    0x97, 0xB3, 0x62, 0x87, 0x19, 0x65, 0x7E, 0x0F, 0xCB, 0xF6, 0xC7, 0xBA, 0xD9, 0x24, 0xA1, 0xDE,
-    0x0D, 0xAC, 0xA0, 0xA9, 0xE0, 0xF4, 0xC0, 0x6E, 0xF5, 0x17, 0x2D, 0x37, 0xFB, 0xAA, 0x1A, 0x96,
-    0x22, 0x6B, 0x78, 0xEE, 0xA7, 0xA9, 0x68, 0xC6, 0x58, 0x32, 0x6D, 0xA7, 0x33, 0xA0, 0xE1, 0x3D,
-    0x79, 0xCA, 0xCD, 0x83, 0x84, 0x47, 0xBF, 0x32, 0xEE, 0x0F, 0x16, 0x4C, 0x00, 0x47, 0xEA, 0xD0,
-    0x6A, 0xBA, 0xAF, 0xAD, 0x8E, 0x0D, 0xC6, 0x13, 0xED, 0x7E, 0x66, 0xFF, 0x07, 0x44, 0x6C, 0xC9,
-    0x2E, 0xEB, 0x8F, 0x5D, 0x44, 0xB9, 0xEE, 0xA2, 0xA0, 0x1E, 0xB6, 0xCF, 0xF0, 0xEA, 0xEE, 0x92,
-    0x65, 0xE3, 0xE0, 0x5E, 0x93, 0xB0, 0xA6, 0xC9, 0xF0, 0x0A, 0x46, 0x8A, 0xC7, 0x98, 0x47, 0x81,
-    0x03, 0x77, 0xD7, 0x9E, 0x04, 0x06, 0xDC, 0x25, 0x34, 0x47, 0xB6, 0xF5, 0x6C, 0x0B, 0x73, 0xE8,
-    0xE1, 0x6F, 0xCD, 0xD2, 0xAD, 0x8E, 0x75, 0x6B, 0x1E, 0xFF, 0xEB, 0x33, 0x96, 0xCE, 0xB9, 0x0D,
-    0x9E, 0xA8, 0x39, 0xE2, 0xBE, 0x00, 0xFA, 0x11, 0xE6, 0x45, 0x0C, 0x85, 0xDB, 0x58, 0x49, 0x54,
-    0x48, 0x67, 0x05, 0xA7, 0xC2, 0x5C, 0x49, 0x4F, 0xA4, 0x2C, 0xF2, 0x76, 0xD2, 0xEB, 0xD0, 0x95,
-    0x74, 0x0A, 0xE9, 0x1D, 0xCC, 0x96, 0x4E, 0xB2, 0x0E, 0xC9, 0x39, 0x24, 0x58, 0xCC, 0xE6, 0x6C,
-    0x43, 0xB7, 0xAD, 0xF3, 0xE7, 0x43, 0x95, 0x7F, 0x6B, 0x4E, 0x18, 0x12, 0x4A, 0x2C, 0xA3, 0xE3,
-    0x18, 0xA2, 0x1A, 0xC6, 0x46, 0x53, 0xA0, 0x4B, 0xCF, 0x85, 0xAA, 0x1D, 0x49, 0x11, 0xEA, 0x57,
-    0x10, 0xA0, 0x2F, 0xF7, 0x4D, 0x44, 0x1F, 0xFA, 0x55, 0x53, 0xB4, 0xEB, 0x1E, 0xE1, 0xD9, 0x12,
-    0xD4, 0xC3, 0xEE, 0xFB, 0x43, 0xC4, 0xF2, 0x12, 0xED, 0xDD, 0x32, 0xEC, 0x1E, 0x3A, 0x2F, 0xF4,
-    0x6C, 0x09, 0x92, 0xB5, 0x28, 0x4A, 0x2D, 0x25, 0x1B, 0xB9, 0x7A, 0xC4, 0xB1, 0xDE, 0x33, 0x67,
-    0xB1, 0x0F, 0x1F, 0x3E, 0x14, 0x92, 0x9F, 0xE9, 0x45, 0x80, 0x7F, 0x53, 0x73, 0x08, 0xE4, 0xD3,
-    0xD7, 0x23, 0x24, 0x55, 0xF6, 0x13, 0x0E, 0x3E, 0xAE, 0x38, 0x42, 0x2C, 0x06, 0x2B, 0x0A, 0x8E,
-    0xC2, 0x4F, 0xC0, 0x51, 0x4C, 0x8E, 0x36, 0xC9, 0xD1, 0x3E, 0x99, 0x81, 0x63, 0x9A, 0xFC, 0x16,
-    0xCC, 0x04, 0x35, 0x40, 0x94, 0x83, 0xA3, 0x84, 0x1C, 0x6D, 0x91, 0xA3, 0x25, 0x39, 0xEA, 0x66,
-    0x8E, 0x42, 0x11, 0x53, 0x05, 0x8E, 0x36, 0xC9, 0xD1, 0x3F, 0x9A, 0xD3, 0x72, 0xB8, 0x1E, 0xD5,
-    0xD2, 0x13, 0xFC, 0x72, 0xFA, 0xD8, 0x1D, 0x5E, 0xD4, 0x53, 0x0E, 0x0F, 0x9E, 0xD3, 0x32, 0xD9,
-    0x44, 0x6B, 0xFB, 0xDA, 0x44, 0x83, 0xEB, 0x76, 0x9A, 0x9E, 0x16, 0xAC, 0x64, 0x0B, 0xAA, 0x90,
-    0x74, 0x3F, 0x6B, 0x92, 0x42, 0xFE, 0xCF, 0xA0, 0xF8, 0x23, 0xF4, 0xB2, 0x63, 0xB5, 0x5E, 0x03,
-    0xE4, 0x79, 0x6F, 0xA2, 0xFC, 0x7C, 0x7B, 0x13, 0x5F, 0x0A, 0x9A, 0xD7, 0xF7, 0x1D, 0x0A, 0xDD,
-    0x77, 0xF8, 0x50, 0x4E, 0x37, 0xA6, 0x8F, 0xDC, 0x77, 0xF8, 0x32, 0xD0, 0x1C, 0xB4, 0xEB, 0x15,
-    0xF8, 0xE4, 0x31, 0x15, 0xF8, 0x2F, 0x87, 0x56, 0x1C, 0x9E, 0x96, 0x59, 0x54, 0x95, 0xD5, 0x68,
-    0xE8, 0x4E, 0xDC, 0xE6, 0xA3, 0x48, 0x46, 0x34, 0x56, 0xA7, 0xB6, 0xDE, 0xB5, 0xE5, 0x15, 0x38,
-    0xF2, 0x81, 0xDE, 0x9D, 0xA5, 0x8B, 0xA5, 0xBC, 0xCF, 0xB4, 0x50, 0xCE, 0xBE, 0x5A, 0x09, 0xF7,
-    0x8B, 0x5C, 0x0A, 0x4E, 0x25, 0x65, 0x92, 0xD6, 0x54, 0xB2, 0xB8, 0x61, 0xD1, 0x29, 0xEA, 0x36,
-    0x65, 0x25, 0x2F, 0xA4, 0x2C, 0xB4, 0x2F, 0xC7, 0x57, 0xE4, 0xA0, 0xDF, 0x28, 0xA3, 0xCB, 0x01,
-    0x76, 0x56, 0xC9, 0x56, 0x85, 0xAF, 0x44, 0x61, 0x7E, 0xBA, 0xCA, 0xB6, 0x4F, 0x0B, 0x61, 0xDE,
-    0xF2, 0x94, 0xF0, 0x5D, 0x39, 0x3A, 0x23, 0xAE, 0x3E, 0xBD, 0x23, 0x6A, 0x2F, 0x8E, 0xB6, 0x98,
-    0xD6, 0xCE, 0x59, 0x7D, 0x16, 0xA4, 0xE9, 0x9A, 0x62, 0x86, 0x33, 0x53, 0xC1, 0xBA, 0xD4, 0xD4,
-    0xF3, 0x84, 0xB9, 0x95, 0xA3, 0x54, 0xE8, 0x59, 0x8E, 0xE6, 0x6B, 0xC2, 0x47, 0x38, 0x49, 0x04,
-    0x3A, 0x09, 0xA5, 0x8F, 0x84, 0x59, 0xBD, 0xD6, 0x3E, 0xE7, 0x86, 0x74, 0x35, 0xF7, 0xA6, 0x3D,
-    0x8F, 0x05, 0x23, 0xD6, 0x29, 0xD1, 0x6D, 0xDC, 0xEB, 0x9F, 0x45, 0xA1, 0x27, 0xB3, 0x95, 0xDA,
-    0x3B, 0x52, 0x2C, 0x1B, 0xF4, 0xC0, 0x94, 0xFE, 0x63, 0x15, 0x43, 0x89, 0xB8, 0x15, 0xA8, 0x47,
-    0xE4, 0x1F, 0x5A, 0xD2, 0xE7, 0x70, 0x06, 0xFF, 0x0E, 0xDD, 0x5C, 0x3D, 0x8C, 0xDD, 0x56, 0x76,
-    0xBE, 0x24, 0x47, 0xC3, 0x5D, 0x3D, 0x64, 0xA9, 0xC2, 0x6A, 0x6C, 0xAC, 0xD9, 0xA4, 0x58, 0x58,
-    0xB2, 0xD8, 0xBA, 0x98, 0x19, 0x72, 0x37, 0x40, 0xDA, 0xA8, 0xD0, 0x64, 0x0B, 0x17, 0x49, 0x91,
-    0x00, 0x89, 0x82, 0x60, 0x1A, 0x17, 0x2A, 0x26, 0x43, 0x62, 0x03, 0xA4, 0x49, 0x91, 0x29, 0x02,
-    0xA7, 0x8C, 0x0A, 0x17, 0xD6, 0x34, 0x56, 0x00, 0x17, 0x2A, 0xA4, 0xE1, 0xF3, 0x6E, 0xB9, 0x45,
-    0xB8, 0x58, 0x2C, 0xB6, 0x48, 0xB1, 0x0C, 0x20, 0x03, 0xCE, 0x2E, 0x02, 0x33, 0x00, 0x8D, 0xBC,
-    0xF1, 0xF2, 0xF1, 0xE6, 0x7C, 0xDF, 0xB9, 0x7C, 0x3F, 0x33, 0xB2, 0x23, 0x69, 0xFE, 0xE7, 0x69,
-    0x78, 0xCE, 0xD3, 0x23, 0x79, 0x7F, 0xCE, 0x39, 0x3C, 0xF7, 0xFC, 0x5D, 0x1A, 0xB3, 0xB9, 0x79,
-    0xD7, 0x18, 0xE3, 0x59, 0x3B, 0x99, 0xA3, 0xC3, 0x1F, 0xFD, 0xCD, 0x9F, 0x12, 0x05, 0x3D, 0x51,
-    0x68, 0x89, 0x46, 0x65, 0x06, 0x14, 0xA5, 0x05, 0x50, 0x9C, 0x8C, 0x81, 0xD6, 0xE3, 0x0A, 0x68,
-    0x2D, 0x6A, 0x80, 0x9E, 0x8E, 0x88, 0xDA, 0x80, 0x3D, 0x34, 0x41, 0x87, 0xB6, 0x6A, 0xB6, 0x16,
-    0x54, 0x06, 0xAD, 0x85, 0x63, 0x83, 0xD6, 0xA2, 0xC2, 0xE4, 0xD2, 0x5A, 0x64, 0xAD, 0x95, 0x66,
-    0x12, 0x45, 0xEB, 0xD2, 0xAA, 0xB4, 0xB6, 0x2D, 0xBF, 0x4B, 0x33, 0x4F, 0xA4, 0x47, 0x41, 0xAD,
-    0xDC, 0x33, 0x91, 0xB6, 0xA4, 0x85, 0xCE, 0x04, 0x40, 0x53, 0x13, 0x02, 0x59, 0xF3, 0x49, 0x5F,
-    0x98, 0x4F, 0xEC, 0x73, 0xDC, 0x6B, 0x6D, 0xCB, 0xE9, 0x71, 0x56, 0x87, 0xA7, 0xE6, 0x6D, 0x0A,
-    0x28, 0x6D, 0x2D, 0xF3, 0x79, 0xBF, 0x33, 0x61, 0x6B, 0xA6, 0x68, 0xB9, 0x34, 0x41, 0x2D, 0xC0,
-    0xDC, 0x35, 0x39, 0x2E, 0x1A, 0xC0, 0xB5, 0x3D, 0x8B, 0x06, 0xAC, 0x19, 0x1D, 0xC8, 0x7F, 0xE3,
-    0x5A, 0x40, 0x3A, 0x06, 0x28, 0xE4, 0xE2, 0x01, 0x58, 0xF9, 0xCD, 0xB7, 0x72, 0x36, 0x4E, 0xB3,
-    0xC8, 0x76, 0xE9, 0x73, 0xDF, 0x36, 0xC9, 0xC4, 0xDC, 0x64, 0x77, 0xB5, 0xF9, 0x00, 0xA8, 0x31,
-    0xA4, 0xC5, 0xFE, 0xFB, 0x44, 0xA9, 0x25, 0x9D, 0x46, 0x96, 0x34, 0x34, 0x37, 0xAE, 0x0A, 0xD1,
-    0x1B, 0x4C, 0xB6, 0xC5, 0x0D, 0x3B, 0x3F, 0x6E, 0xDC, 0x34, 0x75, 0x92, 0x37, 0xCE, 0x89, 0xFC,
-    0x97, 0x99, 0x9A, 0xF8, 0x3C, 0xD0, 0x71, 0xD7, 0x44, 0x11, 0x47, 0x68, 0x62, 0x8E, 0xD7, 0x24,
-    0x0E, 0xB9, 0x1F, 0x3F, 0xCF, 0x54, 0xA4, 0x38, 0x7C, 0xCF, 0x16, 0x67, 0x49, 0xE9, 0x4F, 0x41,
-    0x88, 0x4A, 0xC9, 0x20, 0x23, 0xA2, 0x88, 0x13, 0x60, 0x4C, 0xC9, 0xE7, 0x05, 0x08, 0x23, 0xC3,
-    0xF4, 0x2D, 0x4E, 0xBF, 0x03, 0x90, 0x03, 0x80, 0x7E, 0xDE, 0x64, 0x98, 0xDF, 0x08, 0x17, 0xAF,
-    0xCC, 0xE4, 0xA4, 0x94, 0x8B, 0x63, 0x90, 0xA1, 0x2C, 0xC2, 0xA9, 0x50, 0xDC, 0xEB, 0x65, 0x0A,
-    0xA6, 0x07, 0x25, 0x9F, 0x25, 0xD2, 0xD7, 0x9F, 0xA7, 0x98, 0x38, 0x01, 0x1B, 0x23, 0x33, 0xED,
-    0x37, 0x01, 0x9E, 0x2D, 0xD9, 0xF3, 0xEC, 0x36, 0xB4, 0x62, 0x62, 0x30, 0x78, 0x24, 0x83, 0xF8,
-    0x03, 0x08, 0xC7, 0x86, 0xB1, 0xD5, 0x6A, 0x27, 0x82, 0x2B, 0xFD, 0xAE, 0x5A, 0x0C, 0xF7, 0x1A,
-    0xB4, 0xE4, 0x9B, 0x0F, 0xF5, 0x16, 0x50, 0x4B, 0x78, 0xEF, 0x37, 0xE4, 0xBB, 0xF1, 0xDC, 0x58,
-    0xAF, 0xDD, 0x03, 0xA1, 0x8B, 0xB0, 0xDF, 0x6A, 0xA3, 0x3A, 0xE8, 0x92, 0xB1, 0xDF, 0xA5, 0x99,
-    0x37, 0xC9, 0x8D, 0xB7, 0x5B, 0x62, 0x00, 0x6E, 0xAA, 0xC3, 0x61, 0xDD, 0x81, 0x73, 0x10, 0x1A,
-    0xA1, 0xEC, 0x8A, 0x8C, 0xE5, 0x76, 0x74, 0xE0, 0x75, 0x81, 0xB5, 0x8D, 0xC9, 0xC1, 0x3D, 0xF4,
-    0x7B, 0xFD, 0x21, 0x86, 0x09, 0x49, 0x48, 0x21, 0x79, 0xD3, 0x1D, 0xE9, 0xBB, 0x8D, 0x33, 0xE9,
-    0x5C, 0xBA, 0x97, 0xDE, 0xB3, 0x8B, 0x47, 0xAB, 0xD5, 0x8F, 0x84, 0xD9, 0x32, 0xD8, 0x44, 0xAE,
-    0x48, 0x85, 0xFF, 0xDD, 0x68, 0xEC, 0xD7, 0x5E, 0xE3, 0x0D, 0x2A, 0xE0, 0xD4, 0x68, 0xE5, 0x61,
-    0xD4, 0x7C, 0x6A, 0xE7, 0x60, 0x54, 0x1F, 0x59, 0xD2, 0x2E, 0x94, 0x5C, 0xC9, 0x11, 0xB4, 0x7A,
-    0x99, 0xE8, 0x04, 0x6A, 0x83, 0xC5, 0xCF, 0x69, 0xD1, 0xEA, 0xBA, 0xF1, 0x0B, 0x91, 0xA1, 0x28,
-    0x13, 0x69, 0xDA, 0xC1, 0xCD, 0x10, 0xAE, 0x1C, 0x62, 0x96, 0x80, 0x60, 0xD7, 0xB2, 0x8B, 0x47,
-    0x2B, 0x19, 0xF0, 0x43, 0xD1, 0xBF, 0x95, 0x79, 0x26, 0xDA, 0x2F, 0x95, 0x19, 0xC6, 0x53, 0xBD,
-    0x85, 0xBC, 0x3F, 0x6D, 0x5A, 0x49, 0x57, 0xE3, 0x18, 0xA3, 0x57, 0x7A, 0x39, 0x8A, 0xC9, 0x9D,
-    0xCA, 0xB0, 0x44, 0xC5, 0x6C, 0x46, 0x37, 0x9C, 0xB1, 0xF6, 0xBF, 0x14, 0x89, 0x02, 0x16, 0xC5,
-    0x67, 0xDE, 0x72, 0xBD, 0x62, 0x3E, 0x56, 0x6F, 0xB1, 0x2A, 0xA5, 0x82, 0xC2, 0x8E, 0x28, 0x50,
-    0x84, 0xE5, 0x45, 0x90, 0xD7, 0xCF, 0x86, 0xF9, 0x4A, 0xC8, 0x53, 0xE4, 0xF7, 0x8B, 0x6D, 0xBA,
-    0x1E, 0xA2, 0x76, 0xB1, 0xF7, 0x72, 0x8C, 0x91, 0x61, 0x35, 0xDC, 0xB2, 0x5C, 0x70, 0x4A, 0x6B,
-    0x7B, 0x4E, 0x62, 0x75, 0x2F, 0xFB, 0x2B, 0x2A, 0x6D, 0xCC, 0xB3, 0x1C, 0x43, 0x47, 0x27, 0x9F,
-    0x61, 0xB2, 0xC9, 0x4F, 0x31, 0xD7, 0xE4, 0x67, 0xE4, 0xDD, 0x67, 0xC3, 0xFA, 0x73, 0xED, 0xAE,
-    0x40, 0xCF, 0x4E, 0x05, 0x86, 0xD6, 0xFE, 0xD9, 0xD8, 0xC4, 0x6D, 0xF8, 0xE5, 0x18, 0x1C, 0x16,
-    0xB5, 0x2F, 0xA4, 0xCD, 0xB1, 0x94, 0xE0, 0xBF, 0x25, 0xA1, 0xE5, 0x5D, 0x0A, 0xFB, 0x23, 0x50,
-    0x7F, 0xD7, 0x2B, 0xF5, 0x2E, 0x6D, 0x41, 0x5B, 0x8B, 0xDA, 0xF0, 0x37, 0x15, 0x7A, 0x89, 0x7A,
-    0xE9, 0xB1, 0x8B, 0x44, 0xB2, 0x48, 0xF7, 0xD3, 0x20, 0x78, 0x09, 0x41, 0x98, 0xA1, 0xD3, 0x26,
-    0xB8, 0x71, 0xAB, 0x24, 0x2F, 0x9B, 0x2D, 0xEC, 0x80, 0x22, 0x90, 0x32, 0x4D, 0x9F, 0x70, 0xF1,
-    0xF7, 0x37, 0x1F, 0x26, 0x68, 0xB0, 0x8F, 0x85, 0x2C, 0xB6, 0xFC, 0x57, 0x21, 0x7B, 0xED, 0x5B,
-    0x12, 0x4A, 0x5A, 0x10, 0xA9, 0xCE, 0x17, 0x08, 0x9E, 0xBE, 0x1C, 0xC1, 0xCB, 0x23, 0x04, 0x8F,
-    0xBF, 0x81, 0xE0, 0xE6, 0xDA, 0x26, 0x0C, 0x8C, 0x84, 0x83, 0x8A, 0xAD, 0xCD, 0x96, 0x54, 0x17,
-    0xF8, 0x30, 0x75, 0x50, 0xA6, 0xEC, 0x29, 0x85, 0xD7, 0x17, 0xE0, 0xBB, 0x84, 0xDF, 0x57, 0x42,
-    0x7E, 0x0B, 0xA4, 0x25, 0x65, 0xAD, 0x63, 0xA3, 0x79, 0x09, 0xE8, 0x67, 0x64, 0x00, 0xEC, 0x15,
-    0x33, 0x22, 0x8C, 0x0A, 0xF0, 0x28, 0x29, 0x40, 0x75, 0x5B, 0x94, 0x84, 0xDE, 0xE6, 0x66, 0x06,
-    0xCA, 0xD6, 0x0A, 0x16, 0xD5, 0xEE, 0x5D, 0x1A, 0x4E, 0x72, 0xB6, 0xFF, 0xA4, 0x31, 0xA2, 0x4D,
-    0x26, 0x42, 0x1F, 0xAF, 0x83, 0x35, 0xD3, 0x43, 0x22, 0x2D, 0xA8, 0x54, 0x92, 0x9F, 0x18, 0x98,
-    0x75, 0x60, 0x36, 0x06, 0x82, 0xD2, 0x38, 0xCD, 0x02, 0x32, 0xAE, 0xC0, 0xA2, 0xFA, 0xBE, 0xD8,
-    0x56, 0xD2, 0x8A, 0x4F, 0xC6, 0x43, 0xBD, 0x18, 0x4F, 0x74, 0x96, 0xFC, 0x1C, 0x41, 0x05, 0xCA,
-    0x3F, 0x19, 0xE7, 0xAF, 0x9E, 0xD1, 0x3C, 0xED, 0x68, 0xC2, 0x71, 0x50, 0x2B, 0x97, 0x88, 0xA4,
-    0xFE, 0x58, 0xDC, 0x1D, 0x31, 0x8F, 0x2B, 0xE3, 0x1D, 0x88, 0x12, 0x80, 0x3E, 0x96, 0x4B, 0x68,
-    0x7A, 0x67, 0xE7, 0x43, 0x5C, 0x73, 0x8D, 0x9D, 0x72, 0xA9, 0x59, 0x82, 0xCE, 0x86, 0x3E, 0xF4,
-    0xB9, 0xF8, 0x24, 0x56, 0x33, 0x87, 0x5E, 0x09, 0x54, 0x8B, 0x82, 0xB0, 0x39, 0x3A, 0x95, 0x33,
-    0xA5, 0xF3, 0x25, 0xA0, 0x9B, 0x5C, 0x48, 0xCF, 0x28, 0xE6, 0x7D, 0xEB, 0x84, 0xDD, 0x02, 0x54,
-    0x07, 0xD1, 0x7E, 0xA8, 0xEE, 0x39, 0x5D, 0xA9, 0xFE, 0x2C, 0xA9, 0xF8, 0x8C, 0x7E, 0xA6, 0x71,
-    0x46, 0x60, 0x58, 0x0F, 0x6C, 0x0D, 0xF8, 0x1B, 0x43, 0x18, 0x04, 0xD0, 0xBD, 0x3F, 0x10, 0xAB,
-    0x44, 0x66, 0x92, 0x6D, 0x60, 0x94, 0xBF, 0xC0, 0xF8, 0x83, 0xDF, 0x53, 0x04, 0xD4, 0xF9, 0xD3,
-    0xE5, 0xE3, 0xE6, 0x65, 0x52, 0x1C, 0x62, 0xDD, 0x89, 0x57, 0x05, 0x17, 0xB2, 0x4B, 0x60, 0x8D,
-    0x81, 0x64, 0x71, 0x37, 0xC8, 0xF7, 0x60, 0xE3, 0x9D, 0xB9, 0xF6, 0xF0, 0x3F, 0xD6, 0x40, 0x81,
-    0x8A, 0x48, 0xAC, 0xB3, 0x4A, 0xD5, 0xF1, 0xEE, 0x46, 0x15, 0x83, 0x01, 0x5E, 0xA3, 0xFA, 0xED,
-    0xC6, 0x92, 0x1E, 0x79, 0x4E, 0x5F, 0xDC, 0xE2, 0x8E, 0xBC, 0xF2, 0x84, 0x6C, 0x30, 0x2E, 0xD2,
-    0xCA, 0x20, 0x90, 0x10, 0x57, 0x34, 0x43, 0xC4, 0x9B, 0x47, 0x74, 0xE0, 0xBB, 0x83, 0x4A, 0x1A,
-    0x50, 0xAE, 0xAA, 0x49, 0x83, 0x13, 0x03, 0xB2, 0x87, 0x11, 0x56, 0x5F, 0x41, 0xD2, 0x07, 0x2E,
-    0xF1, 0xCA, 0x96, 0xF7, 0x89, 0x9D, 0x01, 0xDB, 0x5A, 0xDA, 0x4D, 0x15, 0xC1, 0xBE, 0x76, 0xFD,
-    0x09, 0x1A, 0x69, 0xEF, 0xB0, 0x54, 0xD0, 0x75, 0xE9, 0xCE, 0x2B, 0x5F, 0xC5, 0xFD, 0x3F, 0xA0,
-    0xD5, 0xCF, 0xA9, 0x9B, 0x3D, 0x43, 0x33, 0x0A, 0xCB, 0x91, 0x9C, 0x8C, 0x7E, 0x2E, 0x12, 0x99,
-    0xFA, 0x2D, 0xC2, 0x18, 0xDB, 0xF0, 0xE5, 0x56, 0x5C, 0xE4, 0xCA, 0xDB, 0x14, 0xEB, 0x29, 0xB1,
-    0x5F, 0xF6, 0xA6, 0xFC, 0x71, 0xBF, 0xE3, 0x77, 0x66, 0xFA, 0x1D, 0x11, 0xD9, 0x12, 0xC2, 0x9B,
-    0x03, 0xA4, 0xD9, 0x1C, 0xC8, 0x89, 0x1C, 0x14, 0xD8, 0x17, 0x03, 0x5A, 0xAE, 0x94, 0xE7, 0x4C,
-    0x86, 0x75, 0x67, 0x5F, 0xE6, 0xF4, 0x29, 0xC3, 0x2B, 0x46, 0x5D, 0x6B, 0xA1, 0xD5, 0xDE, 0x47,
-    0x4E, 0xCE, 0xC4, 0x0B, 0x10, 0x9B, 0x66, 0xCF, 0x36, 0x91, 0xD8, 0x20, 0xAD, 0xC8, 0x86, 0x3F,
-    0x49, 0x11, 0x34, 0x48, 0x61, 0x8B, 0xA7, 0x78, 0x5A, 0x84, 0xF5, 0x61, 0x1D, 0xD5, 0x66, 0x6B,
-    0x2C, 0x36, 0x4A, 0x0F, 0xCB, 0x6A, 0x57, 0x2E, 0xA8, 0xCC, 0x63, 0x36, 0xA9, 0xDC, 0x99, 0xBE,
-    0x5F, 0x2B, 0x5B, 0x54, 0xF7, 0x6B, 0x14, 0xC8, 0x64, 0xE6, 0x6A, 0xB1, 0xEC, 0xB1, 0x79, 0x0F,
-    0x01, 0xA3, 0x27, 0x32, 0xAC, 0x3F, 0x6D, 0x61, 0x99, 0xD5, 0x60, 0x5E, 0x31, 0x8F, 0xBE, 0x5D,
-    0x54, 0x6E, 0xD1, 0x11, 0x46, 0x73, 0xFA, 0x9C, 0x05, 0x4B, 0xC8, 0x7B, 0x51, 0x60, 0xFA, 0x0A,
-    0x3D, 0x67, 0x6F, 0x0C, 0xAB, 0x8F, 0xCF, 0x70, 0x58, 0x3F, 0x5F, 0x92, 0x16, 0x3E, 0x17, 0x97,
-    0x73, 0x57, 0x87, 0x11, 0xEE, 0xE3, 0x74, 0x7E, 0xA0, 0xF1, 0x57, 0x67, 0x5A, 0x31, 0xB8, 0x89,
-    0x28, 0x80, 0xC6, 0x61, 0xF5, 0x4A, 0x67, 0x9A, 0xFB, 0xF4, 0xDC, 0x32, 0xAE, 0xC8, 0x43, 0xE0,
-    0x93, 0x61, 0x55, 0xB2, 0xF2, 0xDE, 0x45, 0x67, 0xE0, 0x9E, 0x4E, 0x42, 0x09, 0x1D, 0xA8, 0x86,
-    0x8C, 0xFE, 0x83, 0xFA, 0x32, 0xF1, 0x48, 0x84, 0x6D, 0x68, 0xFC, 0xB9, 0xCE, 0x57, 0x7E, 0xC3,
-    0xA0, 0xE8, 0x14, 0x4D, 0x7D, 0x7A, 0xA7, 0xD9, 0x6B, 0x45, 0x2B, 0x16, 0x11, 0x17, 0xEB, 0x19,
-    0x3A, 0x66, 0x63, 0x44, 0x3A, 0x32, 0x99, 0xEA, 0x17, 0x38, 0x4A, 0x19, 0x2E, 0x0E, 0xF3, 0x26,
-    0x67, 0x9E, 0x92, 0xB7, 0x39, 0xF5, 0x4B, 0xC7, 0x90, 0x7E, 0x83, 0xD0, 0xF5, 0xA8, 0x40, 0x6C,
-    0x77, 0x05, 0xEB, 0xC3, 0x3B, 0x8F, 0x78, 0x05, 0x19, 0x19, 0xEA, 0xAA, 0xF1, 0xFF, 0x40, 0xCA,
-    0x52, 0x1F, 0x83, 0x8C, 0x7D, 0x0E, 0x6B, 0xA2, 0xAF, 0x61, 0x3D, 0xD8, 0xB1, 0x8B, 0x31, 0xF4,
-    0x03, 0xEC, 0x97, 0xFF, 0xFB, 0xEA, 0x50, 0xA3, 0x0E, 0x89, 0x3C, 0x78, 0xF6, 0xB9, 0xB0, 0xC2,
-    0x0C, 0xDC, 0x78, 0x19, 0xA6, 0xDC, 0xB7, 0x7B, 0x7B, 0x7B, 0xF6, 0x63, 0x1A, 0x5F, 0x76, 0x7A,
-    0xD3, 0x6E, 0x6E, 0x6E, 0xDA, 0x7B, 0xE7, 0xCB, 0x94, 0x6F, 0x27, 0x75, 0x8E, 0x10, 0x8C, 0x83,
-    0xCB, 0x04, 0xF7, 0x71, 0x5F, 0x9F, 0xC0, 0xF2, 0xED, 0xF7, 0x4B, 0x44, 0x5B, 0x6A, 0x86, 0x5E,
-    0x0A, 0xEF, 0xE4, 0x08, 0x7E, 0x94, 0xD4, 0xDE, 0x2E, 0x22, 0x90, 0x5E, 0x95, 0xDA, 0xBF, 0x1F,
-    0x7F, 0x9A, 0xD8, 0xE2, 0x31, 0x53, 0x4A, 0x37, 0x9C, 0x99, 0x68, 0x33, 0xC6, 0x43, 0x44, 0xDB,
-    0x50, 0x2B, 0x9D, 0xF4, 0x21, 0xED, 0xBE, 0x65, 0xBF, 0x66, 0xE4, 0x05, 0xE3, 0x48, 0x64, 0x1C,
-    0xB9, 0x1B, 0x47, 0x43, 0xD2, 0xCD, 0x4D, 0x51, 0x04, 0x94, 0x56, 0xAD, 0xBB, 0x2F, 0x79, 0xCD,
-    0x43, 0xB4, 0xF8, 0x75, 0xDB, 0x67, 0x91, 0xA8, 0x99, 0x9B, 0x9B, 0xF7, 0x84, 0x57, 0x7C, 0x86,
-    0x9C, 0x1A, 0x70, 0x92, 0x66, 0xCD, 0x71, 0xFE, 0xA4, 0x05, 0x95, 0x84, 0xCD, 0xCD, 0x7B, 0xD6,
-    0x76, 0xD6, 0xCE, 0x17, 0x40, 0xF1, 0xC5, 0xDE, 0xD2, 0xCB, 0xCA, 0x97, 0xFE, 0xB3, 0xD9, 0x2D,
-    0x7B, 0x90, 0xDA, 0xFE, 0x03, 0x73, 0x7B, 0xCD, 0x6C, 0xA7, 0x1F, 0x4E, 0x62, 0xDB, 0xC0, 0x10,
-    0xBA, 0x71, 0x2A, 0x63, 0xFE, 0xC0, 0xAC, 0x89, 0x86, 0x14, 0x93, 0x6B, 0xB1, 0x97, 0x63, 0x8E,
-    0xFC, 0xC4, 0x07, 0x69, 0xEE, 0xC0, 0xBB, 0x0C, 0x6A, 0x23, 0x5E, 0x8B, 0xAC, 0x10, 0xB2, 0x0C,
-    0x8C, 0x0E, 0xEE, 0x06, 0xF2, 0x38, 0x95, 0x35, 0x2C, 0x90, 0xD9, 0x2D, 0xFB, 0x4B, 0x66, 0xC7,
-    0x71, 0xA6, 0x00, 0x4F, 0x7B, 0x82, 0x65, 0x4A, 0x3A, 0x15, 0x77, 0x56, 0xD6, 0xB5, 0x60, 0x7A,
-    0xCF, 0x17, 0x1F, 0x76, 0xEB, 0x39, 0x7A, 0xEC, 0x87, 0xB0, 0xE9, 0xB3, 0x45, 0x2B, 0xE2, 0xA4,
-    0x67, 0x7D, 0x6C, 0x2E, 0xC8, 0x43, 0x66, 0x1C, 0xE2, 0xB8, 0xC6, 0x6C, 0x2A, 0x2F, 0x2E, 0x14,
-    0xC2, 0xC8, 0x04, 0x41, 0xA1, 0x0A, 0xC2, 0xBC, 0x9D, 0x49, 0x95, 0x67, 0x2F, 0x40, 0xA5, 0x59,
-    0x70, 0xD1, 0x3D, 0x7D, 0x92, 0xC3, 0x89, 0x1A, 0x01, 0x5C, 0xF6, 0x69, 0x88, 0x82, 0x47, 0x6F,
-    0xA8, 0x06, 0xA4, 0x02, 0xB4, 0x30, 0xE8, 0xF6, 0x87, 0x38, 0xC9, 0xA1, 0x8F, 0x10, 0x39, 0xED,
-    0x85, 0xCC, 0xB7, 0x7A, 0xBD, 0xAE, 0xC4, 0x6D, 0xC7, 0x06, 0x32, 0xAB, 0x5E, 0x18, 0x61, 0x7A,
-    0x48, 0x53, 0x3F, 0xD3, 0xF9, 0xFD, 0x2C, 0x5C, 0x03, 0xE0, 0x31, 0xFC, 0x31, 0x71, 0x41, 0x31,
-    0x8F, 0x76, 0xDD, 0x81, 0x66, 0x4E, 0x91, 0x38, 0xCD, 0xE5, 0xF4, 0x74, 0x5F, 0xC4, 0x30, 0xCE,
-    0x90, 0x34, 0x1D, 0x72, 0xA6, 0x62, 0x01, 0x55, 0x38, 0x78, 0x0D, 0x6D, 0xD3, 0xD3, 0x3E, 0x6A,
-    0x3D, 0x60, 0x85, 0x52, 0xA7, 0x16, 0x94, 0x7F, 0x18, 0x1F, 0xE4, 0xD5, 0x1E, 0x52, 0xF6, 0x62,
-    0x7D, 0x8D, 0x7E, 0xDD, 0xC4, 0x3F, 0x9C, 0xAC, 0x99, 0xF5, 0x99, 0xB5, 0x15, 0xD9, 0x62, 0x55,
-    0xB4, 0x8A, 0x5C, 0x95, 0xBE, 0xF6, 0x5F, 0x86, 0xBF, 0x1C, 0xA4, 0x13, 0x6B, 0x32, 0x6F, 0xCC,
-    0x4E, 0x46, 0x0B, 0x4E, 0x65, 0xDB, 0x38, 0xD9, 0x8E, 0x35, 0x35, 0x92, 0xA8, 0x58, 0x6D, 0xA8,
-    0x88, 0x74, 0xBA, 0x62, 0x37, 0x44, 0x34, 0x7F, 0xAD, 0x86, 0xD0, 0xAC, 0xF9, 0x3B, 0x22, 0x35,
-    0x11, 0xAD, 0xA6, 0x2E, 0x6D, 0xA4, 0xFF, 0x63, 0xB6, 0xDA, 0xD8, 0x52, 0x63, 0x2E, 0xFF, 0x43,
-    0x1F, 0xD4, 0x8E, 0xB1, 0x1E, 0xA2, 0x86, 0x40, 0x1B, 0x8B, 0x18, 0xD2, 0x32, 0xE1, 0x94, 0x28,
-    0x18, 0x2C, 0x04, 0xF7, 0x80, 0x69, 0xBE, 0x44, 0xB8, 0xE3, 0xC9, 0xC8, 0xA2, 0x29, 0x65, 0x3B,
-    0xB0, 0x15, 0x9F, 0xE9, 0xAD, 0x23, 0x59, 0xDD, 0xC1, 0x66, 0x57, 0x57, 0xD1, 0xA5, 0x51, 0x43,
-    0xBD, 0x2C, 0x54, 0x9B, 0x7D, 0xA4, 0xC2, 0xCF, 0x94, 0xFD, 0xAB, 0x9B, 0x75, 0x0E, 0x22, 0xA0,
-    0xDD, 0x9B, 0xAD, 0x1E, 0xD1, 0x26, 0x70, 0xB5, 0x67, 0x1C, 0xB9, 0x27, 0xB1, 0x7A, 0xD2, 0xAA,
-    0x27, 0xA9, 0x7A, 0x52, 0xAA, 0x67, 0xA6, 0x66, 0xCA, 0x24, 0xA1, 0xD6, 0x73, 0xD8, 0x9F, 0xF1,
-    0x1A, 0x4F, 0xB3, 0x91, 0xF0, 0x74, 0x7A, 0xAE, 0xCC, 0x3D, 0x89, 0xDF, 0x83, 0x26, 0x72, 0x2E,
-    0xE8, 0x61, 0x6B, 0x78, 0xB6, 0x86, 0xAD, 0x91, 0x1C, 0x8A, 0xED, 0xB2, 0x24, 0x00, 0x2A, 0x1C,
-    0x96, 0x86, 0x86, 0x33, 0x38, 0x33, 0x16, 0x5D, 0x98, 0xB5, 0x43, 0xF5, 0x44, 0x39, 0xC7, 0x7C,
-    0x8B, 0x63, 0xF6, 0xCE, 0x72, 0xCC, 0xDE, 0xDE, 0xDC, 0x85, 0x0F, 0xDB, 0xF9, 0x90, 0x5F, 0x3C,
-    0x4C, 0x8A, 0xE1, 0x00, 0x9D, 0x2B, 0xF2, 0x92, 0x01, 0xC6, 0xE3, 0xC0, 0x60, 0x7C, 0x38, 0x38,
-    0x39, 0x84, 0x28, 0x11, 0xF8, 0x4A, 0x97, 0x03, 0xC8, 0x22, 0x63, 0xA2, 0x25, 0xE5, 0x19, 0x96,
-    0x07, 0x64, 0x83, 0xA1, 0xDA, 0xCC, 0xDC, 0x7F, 0x64, 0xCA, 0x9E, 0x22, 0x74, 0x12, 0x7F, 0x9E,
-    0x55, 0x7B, 0xB8, 0xBB, 0x04, 0xD4, 0x58, 0xFA, 0xBC, 0x59, 0x2C, 0xE4, 0x2B, 0xB3, 0x59, 0xF5,
-    0x8F, 0x8B, 0xB2, 0x3F, 0x98, 0x31, 0xFB, 0x94, 0xC8, 0xE5, 0x46, 0xB1, 0x87, 0x05, 0x01, 0x51,
-    0xDC, 0xD6, 0xF8, 0x35, 0x66, 0xE3, 0x29, 0x0D, 0x3B, 0x40, 0x46, 0x77, 0x33, 0xAF, 0x1D, 0xB4,
-    0x99, 0xC5, 0x05, 0x80, 0xC5, 0x39, 0x53, 0xF2, 0xFE, 0x23, 0xFF, 0x61, 0xD9, 0x87, 0x75, 0xD8,
-    0x8B, 0x65, 0xD6, 0x47, 0xA2, 0x5F, 0x22, 0x99, 0xDC, 0xF7, 0xE4, 0x58, 0x59, 0xAE, 0x58, 0x38,
-    0xE6, 0xE1, 0x31, 0xE9, 0xFC, 0x85, 0x01, 0xBD, 0x8E, 0x2B, 0x5F, 0x77, 0x49, 0x45, 0x26, 0xB8,
-    0x83, 0xE9, 0x1C, 0x7A, 0xDD, 0x09, 0x52, 0xC5, 0x40, 0x54, 0x54, 0x3B, 0xBF, 0xDA, 0x71, 0xD7,
-    0xF4, 0xB2, 0x0E, 0xF4, 0xE2, 0x04, 0xF2, 0x08, 0xDA, 0x53, 0xA7, 0x0A, 0x34, 0xB2, 0x65, 0xA9,
-    0x91, 0xA5, 0x89, 0xA5, 0xF5, 0xA6, 0x8C, 0xA4, 0x50, 0x6B, 0xBA, 0xC4, 0xC1, 0x0E, 0xE1, 0xE3,
-    0xE3, 0x50, 0xE5, 0x63, 0x71, 0x3D, 0x51, 0x59, 0x20, 0xB4, 0xF7, 0xBE, 0xF1, 0x6F, 0xC5, 0xEB,
-    0x1E, 0x78, 0x76, 0xE2, 0xD9, 0xCA, 0x9F, 0x22, 0x89, 0x22, 0x26, 0xD0, 0xBF, 0xBD, 0xE8, 0x4A,
-    0x51, 0xD9, 0x2C, 0x36, 0x9C, 0xCC, 0x17, 0x50, 0x35, 0x03, 0x69, 0xA8, 0xCC, 0x0B, 0x0C, 0x37,
-    0xF4, 0xF1, 0x6A, 0x8F, 0x04, 0xCD, 0xF3, 0x29, 0x82, 0xCC, 0x6D, 0x6E, 0x89, 0x7C, 0xC6, 0x3C,
-    0x34, 0x07, 0xB5, 0x2D, 0xA8, 0x51, 0x34, 0x21, 0xFA, 0xDF, 0x29, 0xD1, 0x57, 0x96, 0xA8, 0x2D,
-    0x0B, 0x22, 0x71, 0x2C, 0x81, 0x64, 0x1D, 0x01, 0x92, 0x85, 0x04, 0x48, 0xD6, 0x0C, 0x20, 0xA1,
-    0x1C, 0x90, 0x38, 0xF2, 0x44, 0xE9, 0x98, 0x28, 0x6E, 0x88, 0xA2, 0x96, 0x28, 0xE8, 0x88, 0x7C,
-    0x4B, 0x64, 0xEC, 0x53, 0x22, 0x18, 0x1F, 0x08, 0x7F, 0x2B, 0x8A, 0x84, 0x5A, 0x13, 0x96, 0x63,
-    0x20, 0xDE, 0x25, 0x84, 0x2B, 0x31, 0x32, 0xEA, 0x8C, 0xFB, 0x73, 0x1E, 0xD3, 0x8A, 0x74, 0x86,
-    0x83, 0x06, 0xF9, 0x62, 0xB3, 0x9C, 0x7D, 0xD7, 0x30, 0xA1, 0x6D, 0x53, 0x51, 0x7E, 0x5B, 0x13,
-    0x96, 0x0D, 0x7C, 0x5D, 0xC5, 0xE8, 0x1C, 0x66, 0x87, 0x4F, 0xCB, 0x4A, 0xE8, 0xED, 0x0F, 0xCC,
-    0x39, 0x0E, 0x0C, 0x50, 0x69, 0x25, 0xCC, 0xA9, 0x65, 0x3D, 0xB5, 0xB6, 0xF1, 0x6C, 0x73, 0xD9,
-    0x49, 0xBD, 0xFC, 0xB9, 0x6F, 0x16, 0xAC, 0xAA, 0xE1, 0x02, 0x15, 0x3D, 0xCD, 0xD7, 0xB8, 0x5C,
-    0xED, 0x20, 0x6D, 0xE7, 0x49, 0xF9, 0x43, 0xD6, 0xD7, 0xEE, 0xDC, 0xEE, 0xD2, 0xC7, 0x23, 0x59,
-    0x78, 0x46, 0x16, 0xCD, 0x9A, 0x3F, 0x44, 0x9C, 0x1B, 0x27, 0x18, 0x3B, 0x8D, 0x7E, 0xCA, 0xC7,
-    0x27, 0xFC, 0xBD, 0x3A, 0x58, 0x1A, 0x65, 0x1D, 0x82, 0xDB, 0x37, 0xAF, 0xCA, 0x23, 0xA5, 0xB5,
-    0x72, 0x5A, 0x2A, 0x17, 0x34, 0x3B, 0xF3, 0x42, 0x39, 0xAD, 0x93, 0x4B, 0xEB, 0xC3, 0x55, 0x72,
-    0xE7, 0xC9, 0xD8, 0xEB, 0x6E, 0x1C, 0xA9, 0xF3, 0x26, 0xD2, 0x66, 0x19, 0x8F, 0x1C, 0xF6, 0x07,
-    0x2C, 0xD7, 0xDD, 0xC4, 0xC4, 0x7E, 0x6E, 0x7F, 0x04, 0x16, 0xC4, 0x7F, 0x6C, 0xFF, 0x09, 0x61,
-    0xF4, 0xCE, 0xA4, 0xFF, 0x0D, 0x27, 0x65, 0x17, 0x66, 0xAF, 0xD6, 0x34, 0xD6, 0x6A, 0x0B, 0x25,
-    0x95, 0x4A, 0x8A, 0xFC, 0xE7, 0xC4, 0x31, 0x9E, 0x0F, 0xE1, 0x75, 0x2C, 0x83, 0xBA, 0x8E, 0x58,
-    0x4B, 0xCF, 0xDA, 0x73, 0xAC, 0x34, 0x2F, 0x25, 0x42, 0xDD, 0x0B, 0x45, 0x68, 0xFC, 0x02, 0x11,
-    0x1A, 0xA9, 0xEC, 0x08, 0xFD, 0x16, 0x45, 0xA8, 0x54, 0xD9, 0x49, 0xAB, 0x45, 0x11, 0x1A, 0xA9,
-    0xEC, 0x04, 0x53, 0x22, 0xCF, 0x89, 0x50, 0xD9, 0x2D, 0x8A, 0x50, 0xAC, 0x68, 0xA4, 0x22, 0x14,
-    0xA8, 0x08, 0x79, 0x4E, 0x84, 0x9E, 0x2A, 0xA5, 0xB7, 0x5F, 0x84, 0xDC, 0xB9, 0x27, 0x8B, 0x8B,
-    0x91, 0x73, 0xF4, 0x72, 0x55, 0x16, 0xFB, 0x4E, 0xA2, 0x28, 0x50, 0x94, 0x27, 0x8A, 0x13, 0xA5,
-    0x89, 0xC2, 0x44, 0x59, 0xA2, 0x38, 0xBC, 0x3A, 0x80, 0xFC, 0x74, 0x10, 0x9F, 0x0E, 0xD2, 0xD3,
-    0x0D, 0x4B, 0xC6, 0x1C, 0xF8, 0xB3, 0x38, 0x04, 0x33, 0x47, 0x58, 0x42, 0x67, 0xC1, 0x08, 0x96,
-    0x9A, 0x21, 0x73, 0x55, 0x0D, 0x70, 0xC9, 0x79, 0x65, 0x09, 0x60, 0x42, 0x6F, 0xCB, 0x16, 0x32,
-    0x52, 0x78, 0x4D, 0x79, 0x31, 0x02, 0xB5, 0x2A, 0xC6, 0x0D, 0x1A, 0x24, 0xAD, 0xC2, 0x16, 0xC2,
-    0x15, 0x74, 0x08, 0x17, 0x04, 0x1D, 0xCA, 0x68, 0xFD, 0x29, 0xBC, 0x31, 0x7F, 0x0A, 0x35, 0xE2,
-    0xF7, 0x80, 0xDE, 0x11, 0xE8, 0xF7, 0x7A, 0x8D, 0x5E, 0xAF, 0xF7, 0x6A, 0x3B, 0x10, 0xD1, 0xB0,
-    0x8D, 0xD9, 0xFE, 0x88, 0xD9, 0x32, 0xF4, 0x8B, 0x2A, 0xFF, 0x8C, 0xA9, 0xBB, 0xBE, 0x94, 0xC9,
-    0x68, 0xFD, 0xAD, 0x96, 0x5D, 0x60, 0x47, 0x8D, 0x8F, 0x08, 0xBC, 0x6F, 0x97, 0xD5, 0x22, 0x73,
-    0x1E, 0xA5, 0x4C, 0x2B, 0xE8, 0x3F, 0x81, 0x87, 0x24, 0xB7, 0x27, 0xDC, 0x3B, 0x90, 0x49, 0x73,
-    0x39, 0xE4, 0x15, 0xF5, 0xBA, 0x15, 0x8C, 0x9A, 0x0A, 0x72, 0x5A, 0xCF, 0x81, 0x1D, 0x40, 0xC5,
-    0x4B, 0x78, 0x31, 0x63, 0x16, 0x6C, 0x20, 0x6A, 0xA4, 0x29, 0x36, 0x2A, 0x66, 0xD9, 0xAE, 0xEB,
-    0x28, 0xCC, 0x7C, 0x8C, 0x7F, 0x0C, 0xFB, 0x3D, 0x38, 0xD8, 0x2A, 0x98, 0xC7, 0xA3, 0x18, 0x50,
-    0xD5, 0x78, 0xD9, 0x65, 0x23, 0x2C, 0x6B, 0x15, 0xB4, 0x52, 0x81, 0x75, 0x0A, 0xAC, 0x52, 0xD0,
-    0x1A, 0x85, 0xEC, 0x7C, 0x48, 0x6C, 0xDE, 0x29, 0xE0, 0xBE, 0xE7, 0x3F, 0x61, 0x6C, 0x06, 0x42,
-    0xED, 0x75, 0xB0, 0x6F, 0x83, 0x26, 0xA6, 0x7E, 0xDF, 0x60, 0x20, 0xE5, 0x8D, 0x4B, 0x27, 0xC1,
-    0xD7, 0x1F, 0xBE, 0x53, 0x88, 0xCA, 0x94, 0xF6, 0xD2, 0xB1, 0x5C, 0x90, 0x43, 0x05, 0x75, 0x61,
-    0x2D, 0x2A, 0x3E, 0x42, 0x61, 0xDD, 0xCA, 0x39, 0x51, 0x7B, 0x4E, 0x46, 0x7C, 0x26, 0xBA, 0x7D,
-    0x88, 0x39, 0x10, 0x21, 0x26, 0xD7, 0x3F, 0x99, 0x17, 0x02, 0xB5, 0x4F, 0x8D, 0x90, 0x14, 0x5F,
-    0xD6, 0xA0, 0x5F, 0xF4, 0x8B, 0x10, 0x16, 0x5F, 0x6E, 0x63, 0xE9, 0xD1, 0x60, 0xAE, 0x90, 0x48,
-    0xBF, 0x94, 0xB3, 0x2F, 0x99, 0xFB, 0x62, 0x17, 0xBF, 0xB0, 0x9C, 0x78, 0xE9, 0xCB, 0xF2, 0x35,
-    0xB3, 0xBB, 0x66, 0xED, 0xCC, 0x5A, 0x9E, 0xF5, 0x95, 0xE8, 0x97, 0x55, 0x2C, 0x44, 0xF8, 0x32,
-    0xCA, 0x84, 0x11, 0xF8, 0x12, 0x65, 0x6E, 0xCC, 0x31, 0x9A, 0xC6, 0x97, 0x9C, 0x1C, 0xD1, 0x34,
-    0xE2, 0xAA, 0x75, 0xF9, 0x44, 0xE5, 0x8B, 0x23, 0xB9, 0xEE, 0x57, 0x2A, 0x46, 0x22, 0x46, 0x42,
-    0xA3, 0x36, 0xFD, 0x5D, 0x0F, 0xDA, 0x4F, 0x7B, 0xE9, 0x17, 0xD4, 0xEB, 0x40, 0x4A, 0xE1, 0x80,
-    0xD8, 0x2A, 0x35, 0xE8, 0xDA, 0x08, 0x39, 0x4B, 0x6E, 0x1E, 0x88, 0x1A, 0x92, 0x5D, 0x96, 0x6C,
-    0x5D, 0x06, 0xED, 0x12, 0xAE, 0xD5, 0xC8, 0x9F, 0xE1, 0x46, 0x63, 0xE0, 0xDC, 0x74, 0x90, 0x0F,
-    0xDB, 0x6B, 0x84, 0x45, 0x42, 0xF8, 0x0C, 0xFD, 0x08, 0xC5, 0xC7, 0xC2, 0x28, 0x11, 0xD0, 0x78,
-    0x8C, 0x71, 0xB0, 0xC2, 0x39, 0xB7, 0x45, 0x68, 0xDD, 0x76, 0x83, 0x9B, 0xB3, 0xFA, 0xA8, 0x17,
-    0x05, 0xB8, 0xB2, 0x17, 0xC6, 0xE1, 0xAC, 0xFD, 0x48, 0x0B, 0xF1, 0x10, 0xAD, 0x37, 0x31, 0xE3,
-    0x10, 0x5A, 0x29, 0xEE, 0xAA, 0xCE, 0xBF, 0xF5, 0x4F, 0x73, 0x99, 0x7A, 0x3D, 0x24, 0xDD, 0xEE,
-    0xE1, 0xC9, 0xD0, 0x34, 0x99, 0x0D, 0xF8, 0x94, 0x7A, 0xAE, 0x64, 0x9D, 0xF1, 0x0C, 0x59, 0xC2,
-    0x91, 0xB0, 0x6C, 0x86, 0x38, 0xAB, 0x75, 0xE5, 0xE8, 0xBE, 0x6B, 0x90, 0x25, 0x78, 0x79, 0x05,
-    0xCF, 0x37, 0xE9, 0x11, 0x53, 0x5D, 0xB5, 0x6E, 0x5F, 0x16, 0xAB, 0x2F, 0xA0, 0x7B, 0xF0, 0x6C,
-    0xB8, 0x3D, 0x5D, 0xD9, 0xB2, 0x23, 0x24, 0x2C, 0xB3, 0x4D, 0x3A, 0x35, 0x5B, 0xAD, 0x70, 0x50,
-    0x96, 0x58, 0x46, 0x8F, 0x4B, 0xB4, 0xFD, 0x40, 0x53, 0x07, 0xDC, 0x1E, 0xE7, 0x77, 0xAF, 0x0A,
-    0x38, 0x0F, 0x0C, 0x49, 0x27, 0x76, 0x19, 0x48, 0xF6, 0x7A, 0xAE, 0xC1, 0x19, 0x11, 0x70, 0x61,
-    0x81, 0xFE, 0x78, 0x66, 0x9B, 0x34, 0xC3, 0x6E, 0x3B, 0x86, 0xC5, 0x19, 0x14, 0xD7, 0x5D, 0x6C,
-    0x5A, 0x53, 0x9A, 0x30, 0xAA, 0x3F, 0xFA, 0x6C, 0x32, 0xAB, 0x29, 0xF5, 0xDC, 0x96, 0x84, 0xE2,
-    0x48, 0x4D, 0xE9, 0x05, 0xE7, 0x0E, 0x9D, 0x11, 0xFA, 0x22, 0xEA, 0x8A, 0xE8, 0x26, 0xA7, 0x66,
-    0xB0, 0xF8, 0x17, 0xDC, 0x90, 0x33, 0xE3, 0x07, 0xF6, 0xC6, 0xA9, 0xFE, 0xA1, 0x7F, 0x90, 0x0E,
-    0xDE, 0xAF, 0xBF, 0x9C, 0xD0, 0x88, 0x65, 0xE5, 0xF1, 0xEC, 0x97, 0xD8, 0xB3, 0x29, 0xD3, 0x12,
-    0xB5, 0x92, 0x67, 0x22, 0x56, 0x69, 0x26, 0x52, 0x95, 0x40, 0x53, 0xBD, 0xE1, 0xDC, 0x8B, 0xF1,
-    0xB0, 0x75, 0x2A, 0x62, 0xF1, 0x0A, 0xEC, 0x4A, 0x8F, 0xD1, 0x2B, 0x56, 0x43, 0xF8, 0xEC, 0x33,
-    0xB1, 0x66, 0xD8, 0x77, 0x99, 0xAB, 0x4F, 0xB2, 0x02, 0x4D, 0x75, 0x07, 0x20, 0x75, 0x20, 0x76,
-    0x2B, 0x14, 0xF6, 0x85, 0x8E, 0xFA, 0xBF, 0xE1, 0x96, 0xE9, 0xDD, 0x41, 0x35, 0x43, 0x2B, 0x40,
-    0x29, 0x4C, 0xD5, 0xB0, 0x85, 0x46, 0x88, 0x16, 0xF4, 0xC1, 0x35, 0xEC, 0xB2, 0xEE, 0xCD, 0xE8,
-    0xF3, 0x7C, 0x9C, 0x14, 0x68, 0x2D, 0xC4, 0x01, 0x3D, 0xAD, 0x05, 0x59, 0x13, 0xDD, 0x92, 0xCA,
-    0x71, 0x25, 0x28, 0x5F, 0xC7, 0xD0, 0x30, 0xE8, 0xB0, 0xB9, 0x2D, 0x0D, 0xAE, 0x93, 0x39, 0x41,
-    0x93, 0x9A, 0x51, 0x9D, 0x7C, 0x5E, 0x8A, 0x8E, 0x9D, 0xAA, 0x97, 0xE5, 0x3D, 0xE2, 0x94, 0x58,
-    0x54, 0x26, 0x23, 0x88, 0xFF, 0x5D, 0x6E, 0xDB, 0x80, 0xF4, 0x4E, 0xE0, 0x02, 0x64, 0xB3, 0xFE,
-    0x2F, 0x12, 0xAD, 0x86, 0x9C, 0x23, 0x5C, 0x9D, 0xE9, 0x0E, 0x77, 0x6A, 0x2E, 0xE6, 0x1C, 0x4F,
-    0x8D, 0x56, 0x17, 0x89, 0x10, 0xAB, 0x35, 0x77, 0xC9, 0x0D, 0xB5, 0xC3, 0xAA, 0x09, 0xB9, 0x6F,
-    0x99, 0x9A, 0x11, 0x5B, 0xAD, 0x59, 0x5D, 0x9F, 0x4C, 0x4E, 0x89, 0x20, 0x88, 0x3D, 0xC0, 0x4A,
-    0x85, 0x46, 0xA2, 0x63, 0xE6, 0x0E, 0x44, 0x11, 0xC4, 0x6D, 0xC1, 0xC6, 0x68, 0xF3, 0x50, 0xB4,
-    0x9D, 0x79, 0x8A, 0x64, 0x40, 0x8A, 0x24, 0x61, 0xF4, 0xE5, 0xD8, 0xED, 0x09, 0x0F, 0x16, 0x4B,
-    0xF6, 0x2E, 0x94, 0x70, 0x41, 0x9B, 0x85, 0x55, 0x54, 0xF8, 0x6D, 0xAE, 0xAA, 0x2C, 0x6D, 0x69,
-    0x02, 0xCD, 0xF4, 0xD8, 0x29, 0x09, 0x57, 0x0A, 0x3B, 0xAD, 0x71, 0x30, 0x8B, 0xAB, 0xB0, 0x59,
-    0x17, 0xB3, 0xD6, 0x6B, 0xD6, 0x10, 0x82, 0x70, 0xF0, 0x3D, 0xC0, 0xC7, 0x9A, 0xDB, 0x3E, 0x7D,
-    0xC8, 0xF8, 0xCC, 0x75, 0xDB, 0x17, 0xAC, 0xB4, 0xC2, 0x4F, 0x23, 0x0D, 0x5A, 0xEF, 0x2E, 0x94,
-    0xEA, 0x6B, 0x95, 0xC2, 0xCE, 0x42, 0x5C, 0x80, 0xB5, 0x02, 0x2E, 0x32, 0x5F, 0x71, 0xBD, 0xD3,
-    0x45, 0x79, 0x5B, 0x63, 0x0B, 0x50, 0xD8, 0x5A, 0xEB, 0xA1, 0x79, 0x8C, 0xD7, 0x3A, 0xA6, 0xC3,
-    0xA6, 0xD2, 0xDF, 0x66, 0xD2, 0x58, 0x86, 0x57, 0x04, 0x30, 0x0B, 0xCD, 0x1C, 0x77, 0xEE, 0x34,
-    0x7E, 0xAA, 0x43, 0x82, 0x50, 0x94, 0xF5, 0x10, 0x33, 0x0B, 0x19, 0x33, 0x73, 0xBB, 0x4B, 0x5D,
-    0xCC, 0xAC, 0x9D, 0x6F, 0x2D, 0x9D, 0x2F, 0x56, 0x97, 0x81, 0x1F, 0xFE, 0x43, 0xAD, 0x9B, 0xC5,
-    0x5A, 0x31, 0x1A, 0x9B, 0x1F, 0x88, 0x01, 0xB9, 0xF6, 0x3D, 0xA1, 0xF4, 0x77, 0x4E, 0x8F, 0xD2,
-    0x62, 0x96, 0x9F, 0x1C, 0x65, 0x92, 0x4A, 0x7D, 0xB1, 0xDE, 0x78, 0x7B, 0xE5, 0xD7, 0x8F, 0x4E,
-    0x8E, 0x32, 0xAF, 0x28, 0x73, 0xB7, 0xFA, 0x47, 0x06, 0xA5, 0x2F, 0xFE, 0x2B, 0x52, 0x42, 0xB4,
-    0xB0, 0x2B, 0xF8, 0x69, 0x43, 0xE6, 0xA3, 0xFA, 0x3F, 0x61, 0x48, 0x9D, 0xE5, 0x18, 0xE2, 0xDB,
-    0x74, 0x87, 0x33, 0x39, 0xC8, 0x79, 0xA5, 0x08, 0x19, 0x12, 0x51, 0x49, 0x69, 0xF1, 0x24, 0x46,
-    0x79, 0x1E, 0xE8, 0x89, 0x56, 0x29, 0x69, 0x71, 0x0C, 0x02, 0x23, 0x28, 0x24, 0x87, 0x87, 0x7F,
-    0x40, 0x65, 0x1B, 0xAA, 0xEF, 0x28, 0xCE, 0x62, 0x3B, 0x7B, 0xA5, 0x88, 0xF1, 0xFE, 0x59, 0xDF,
-    0x7F, 0x41, 0xFE, 0xDA, 0xFF, 0x6C, 0xF0, 0x0E, 0x0F, 0xD4, 0x33, 0xBD, 0xE7, 0x69, 0xBA, 0x7A,
-    0xE5, 0x50, 0xC9, 0x52, 0x8F, 0x85, 0xE8, 0x56, 0x8F, 0xEA, 0x30, 0xEF, 0xD8, 0xC5, 0xB8, 0x4B,
-    0xB0, 0xD4, 0xD2, 0x9E, 0x0C, 0xE6, 0x4B, 0x5A, 0xC5, 0x39, 0xC6, 0x33, 0xCD, 0xBF, 0x90, 0x61,
-    0x37, 0x30, 0x0D, 0xD4, 0x88, 0xBE, 0xB9, 0x79, 0x4F, 0x49, 0xDF, 0x2F, 0xA0, 0xE5, 0xBD, 0x0D,
-    0x57, 0x80, 0x29, 0xD7, 0x18, 0xF9, 0x8C, 0x58, 0x6E, 0xAF, 0xF0, 0x68, 0xED, 0xD8, 0x39, 0x33,
-    0xE2, 0x03, 0x73, 0x5B, 0x1D, 0x34, 0xBA, 0x68, 0xE9, 0x87, 0x13, 0x5D, 0xF9, 0x1B, 0x33, 0x6C,
-    0x7D, 0x1A, 0xF6, 0x68, 0x5C, 0x21, 0xB6, 0x8C, 0x58, 0xF7, 0x10, 0x16, 0x21, 0xA2, 0x69, 0x5F,
-    0x6D, 0x65, 0xD4, 0x77, 0xF3, 0x62, 0x78, 0xEF, 0x82, 0xB1, 0xC8, 0xFC, 0xA5, 0x59, 0xE0, 0x46,
-    0xF4, 0x2F, 0xE4, 0xCD, 0xDB, 0x9A, 0x04, 0x78, 0x97, 0x5B, 0x22, 0xCC, 0x1D, 0xFD, 0x5F, 0xF4,
-    0x0F, 0x8E, 0x6F, 0x1A, 0x63, 0xFF, 0xEB, 0x2B, 0xC6, 0x37, 0xA7, 0xD8, 0x4B, 0xA6, 0xEC, 0xBF,
-    0x42, 0xE5, 0x6C, 0x30, 0x8E, 0x09, 0xA3, 0xD9, 0x77, 0xBF, 0xD5, 0xC2, 0xBC, 0xC9, 0xBC, 0x32,
-    0xE7, 0xE2, 0x70, 0xD2, 0x7B, 0xC4, 0xFA, 0xB5, 0xA0, 0x8B, 0xF9, 0xC6, 0x9F, 0x86, 0xF9, 0xB2,
-    0x68, 0x9C, 0xEB, 0xCB, 0x82, 0xB8, 0x30, 0x6D, 0x6B, 0xC2, 0xED, 0xC6, 0x55, 0x5B, 0x9F, 0x5C,
-    0x50, 0x3D, 0xFD, 0xAC, 0x7F, 0xB9, 0xA0, 0xFA, 0x05, 0xE0, 0x17, 0x8C, 0x8F, 0x04, 0xE9, 0x34,
-    0xA0, 0x89, 0xE7, 0x52, 0x89, 0x88, 0x06, 0x6C, 0x2B, 0x01, 0xD6, 0xCE, 0x10, 0xE5, 0xDA, 0x2D,
-    0x12, 0x00, 0x4F, 0xD5, 0xA7, 0x99, 0xD0, 0x3C, 0x06, 0xDD, 0xC5, 0xEF, 0x82, 0xC9, 0x15, 0xB8,
-    0x37, 0x64, 0xE4, 0xEE, 0x8D, 0x6F, 0x3B, 0x4B, 0xC9, 0x42, 0x0D, 0xB2, 0x8C, 0x54, 0x33, 0x44,
-    0xD5, 0x62, 0xA5, 0xCB, 0xE8, 0xE0, 0xAE, 0xEE, 0x7E, 0xD2, 0xBC, 0x56, 0x59, 0x5F, 0x00, 0xFA,
-    0x6B, 0x25, 0xC4, 0xE8, 0x48, 0x24, 0x51, 0x27, 0x95, 0xEB, 0xF0, 0x7E, 0xC5, 0x17, 0x82, 0xD0,
-    0xC0, 0x59, 0xD5, 0x6A, 0x82, 0xD5, 0x87, 0xB3, 0xBD, 0x1F, 0xB3, 0x18, 0x60, 0x3A, 0x2B, 0xDA,
-    0xDE, 0x49, 0x67, 0x6F, 0x99, 0x73, 0x2F, 0x13, 0x13, 0x27, 0x65, 0x08, 0x3F, 0x1D, 0x56, 0xFB,
-    0x22, 0xBF, 0x13, 0xE3, 0xEF, 0xCA, 0xC2, 0x3D, 0xC1, 0x37, 0x31, 0xE9, 0xE5, 0x1B, 0x86, 0x8B,
-    0x88, 0x5D, 0x9E, 0x21, 0x34, 0x86, 0x7A, 0xDF, 0x94, 0x94, 0x41, 0x6F, 0xBA, 0x99, 0x3C, 0xD6,
-    0xE4, 0xB2, 0x88, 0xC9, 0x06, 0x73, 0x16, 0x60, 0xD9, 0x5A, 0x4F, 0x76, 0x09, 0xD7, 0xB6, 0x4B,
-    0x4D, 0x07, 0x8F, 0xCD, 0x93, 0x9C, 0x8F, 0x8E, 0x58, 0xDB, 0x6D, 0x9A, 0xF9, 0x5A, 0x1F, 0x2D,
-    0x0A, 0x01, 0x4E, 0x53, 0xD4, 0x78, 0x4D, 0x82, 0x77, 0x5C, 0x99, 0x51, 0xEB, 0x57, 0x71, 0x85,
-    0x92, 0x9C, 0x70, 0x22, 0x5A, 0xAE, 0x8E, 0x98, 0xFF, 0x09, 0xC7, 0xA3, 0x06, 0x61, 0xE9, 0xA0,
-    0x1B, 0x15, 0x61, 0x13, 0xD3, 0xBF, 0x8B, 0xB2, 0xA0, 0xBD, 0x43, 0xF7, 0x29, 0x92, 0xDF, 0x59,
-    0x7A, 0x68, 0x63, 0xB1, 0x9D, 0xB9, 0xAC, 0x97, 0x72, 0x66, 0xCA, 0x4C, 0x72, 0xFE, 0xB7, 0x72,
-    0x05, 0xB3, 0xC8, 0xA9, 0x0C, 0x6D, 0x5F, 0x9D, 0xAC, 0x6E, 0x28, 0x51, 0x40, 0xD4, 0x40, 0x0B,
-    0x02, 0x22, 0x7D, 0xAA, 0xDD, 0x37, 0x0D, 0xEB, 0x1A, 0xFF, 0xA3, 0xC3, 0xB4, 0x8D, 0x87, 0x28,
-    0x70, 0x9A, 0x38, 0x7D, 0xD5, 0xB9, 0x4D, 0x82, 0xC3, 0xCE, 0xF0, 0xA3, 0x2F, 0xF8, 0x1B, 0x3E,
-    0xE2, 0x13, 0x88, 0xAE, 0x2B, 0x6D, 0xB6, 0xD5, 0x63, 0xC7, 0xDF, 0xD6, 0x14, 0xDB, 0x15, 0xC3,
-    0x09, 0x24, 0x5A, 0xD4, 0x83, 0x78, 0xB2, 0x42, 0x8A, 0xA0, 0x83, 0x70, 0x07, 0x63, 0x38, 0x01,
-    0x6F, 0xEF, 0xA3, 0x4E, 0x4C, 0x2C, 0xFE, 0x77, 0x73, 0x06, 0xE5, 0x7B, 0xB3, 0x96, 0x66, 0x11,
-    0xB3, 0x19, 0x0F, 0x92, 0xE2, 0x6D, 0x4A, 0x45, 0x1B, 0x8F, 0xDF, 0xA5, 0x2E, 0x6D, 0xA2, 0x6A,
-    0x8D, 0xEA, 0xA6, 0x1E, 0xD5, 0xDB, 0xFA, 0xCA, 0x9E, 0xB0, 0xC1, 0x52, 0x19, 0xFD, 0x72, 0x1C,
-    0xB4, 0x0C, 0x56, 0xFC, 0xBA, 0xF0, 0x27, 0x7C, 0xF3, 0xD2, 0xEF, 0xA4, 0xD1, 0xDA, 0xBD, 0x17,
-    0x8F, 0x6B, 0x2C, 0xE2, 0x20, 0x7C, 0x8B, 0x80, 0xDF, 0xB9, 0xFA, 0x74, 0xF8, 0x1A, 0x7C, 0x9B,
-    0xDB, 0x6C, 0x4F, 0xFC, 0x74, 0x69, 0x4F, 0xFC, 0x56, 0xA1, 0xAF, 0xCB, 0xAB, 0x16, 0x76, 0x5D,
-    0x2F, 0xEE, 0x89, 0x4F, 0x6D, 0xE7, 0xC9, 0xC3, 0xE9, 0x10, 0x85, 0x68, 0xA2, 0xEF, 0xC9, 0xA9,
-    0x19, 0x5C, 0x0E, 0x75, 0x8F, 0x12, 0xD8, 0x2B, 0x4B, 0x43, 0xAC, 0x64, 0x5F, 0xD7, 0x92, 0xB4,
-    0x6D, 0x1D, 0x88, 0x96, 0x96, 0xAB, 0xB0, 0x96, 0x7F, 0xA4, 0xEF, 0xF2, 0xF8, 0x47, 0x7D, 0x75,
-    0xDF, 0x6F, 0x94, 0x29, 0x6E, 0x2F, 0x43, 0xB7, 0x54, 0x0C, 0xFE, 0xF2, 0xA8, 0x5B, 0xD8, 0xEC,
-    0xEF, 0x97, 0x88, 0x6F, 0x43, 0xA3, 0x4C, 0x86, 0x28, 0xA8, 0x56, 0xA5, 0x6B, 0x0D, 0x85, 0xAC,
-    0xBE, 0x1D, 0xF3, 0x23, 0x3B, 0xDC, 0x0E, 0x0A, 0x6E, 0xAC, 0x1C, 0x7E, 0x7E, 0xC4, 0xDC, 0x4D,
-    0xEC, 0x78, 0xCB, 0x16, 0x6F, 0xD9, 0x02, 0x8D, 0x32, 0x8D, 0x87, 0x2D, 0x31, 0x1D, 0x5E, 0x07,
-    0x29, 0x2B, 0x98, 0xAB, 0x43, 0xAD, 0xF0, 0x30, 0x71, 0xFE, 0x05, 0x9E, 0xF6, 0x04, 0xEF, 0xE5,
-    0x12, 0xFD, 0x14, 0x73, 0x81, 0xBC, 0xC3, 0xF4, 0xD2, 0x3A, 0x47, 0xB9, 0x4D, 0x3E, 0x50, 0x76,
-    0xA7, 0x24, 0x70, 0xA9, 0x65, 0x35, 0xD5, 0xBC, 0xFA, 0xF6, 0x68, 0x45, 0xF8, 0xC6, 0xBC, 0x7A,
-    0x42, 0x77, 0x52, 0xEB, 0x8E, 0xD6, 0x2D, 0xBE, 0x77, 0x4B, 0xDF, 0x27, 0xF4, 0xDC, 0x95, 0x56,
-    0x90, 0xB4, 0xDE, 0x94, 0xF5, 0x0B, 0xDE, 0x54, 0x93, 0x5A, 0x5D, 0x70, 0x64, 0x35, 0xBE, 0x1A,
-    0x1C, 0xA5, 0x18, 0xB3, 0xDE, 0x91, 0x6B, 0x00, 0xDF, 0x07, 0xB3, 0x31, 0xAB, 0x30, 0x19, 0x66,
-    0x8B, 0x4C, 0x6C, 0x97, 0x12, 0x14, 0x26, 0x9A, 0x6C, 0x20, 0x64, 0xB6, 0x0E, 0x92, 0x63, 0x5D,
-    0x1A, 0xDF, 0x56, 0x6B, 0x80, 0x51, 0xC3, 0x70, 0xF6, 0xB6, 0x0A, 0x56, 0xEC, 0xD3, 0xB0, 0xE1,
-    0x8B, 0x24, 0xEC, 0x90, 0x09, 0x00, 0x79, 0x34, 0x4C, 0x48, 0x0D, 0xC3, 0x28, 0xA0, 0x26, 0xB8,
-    0x8D, 0xF9, 0x2E, 0x6E, 0x7F, 0x1B, 0x99, 0x8D, 0x3B, 0xB8, 0x62, 0x03, 0x3C, 0xDD, 0x47, 0xB2,
-    0x74, 0x4A, 0x30, 0xBC, 0x09, 0xB0, 0x72, 0x21, 0x54, 0xC6, 0xB4, 0xB8, 0xF3, 0x22, 0xA8, 0x8E,
-    0x28, 0x6E, 0x8C, 0x19, 0x40, 0x16, 0x6D, 0x50, 0x60, 0x1D, 0x49, 0xE3, 0x35, 0x4D, 0x3B, 0x70,
-    0x54, 0xFA, 0x92, 0xB6, 0x81, 0x3C, 0x64, 0xF3, 0xFC, 0x64, 0xBE, 0x70, 0x72, 0x84, 0x93, 0x11,
-    0x4E, 0xC6, 0x10, 0xB2, 0x9C, 0xE9, 0x1E, 0x05, 0xEE, 0xC5, 0x3A, 0xE9, 0x2C, 0x9C, 0x49, 0x25,
-    0x91, 0x1E, 0x11, 0x92, 0x0B, 0x43, 0xBF, 0xBB, 0xC3, 0x7C, 0xE7, 0xC0, 0xFF, 0x86, 0x17, 0x0B,
-    0x9C, 0x09, 0xFD, 0x98, 0x6E, 0x63, 0xB6, 0x2D, 0x42, 0xB2, 0x8D, 0xB9, 0x36, 0x4D, 0xB5, 0x71,
-    0x31, 0xBF, 0x79, 0xB1, 0xE8, 0xE7, 0xED, 0x9A, 0xBF, 0x10, 0xD5, 0x05, 0x85, 0xB5, 0x81, 0xE5,
-    0x2D, 0x46, 0xCB, 0xA3, 0x19, 0x0D, 0xCC, 0xBD, 0xB3, 0x97, 0xBF, 0xF2, 0xB9, 0x0C, 0x60, 0x6A,
-    0x92, 0xC2, 0xE2, 0x84, 0x2C, 0x81, 0xEF, 0x9D, 0x64, 0xB5, 0xFC, 0x72, 0x7D, 0xF8, 0x6F, 0xF1,
-    0x9E, 0x36, 0xF3, 0x7F, 0xED, 0x5C, 0xBF, 0x93, 0xDC, 0x46, 0x76, 0x6E, 0x00, 0x24, 0xC7, 0x47,
-    0xD4, 0x19, 0x0C, 0x44, 0x57, 0xE9, 0x58, 0xD2, 0x24, 0x0A, 0x54, 0x94, 0x45, 0xA4, 0xBE, 0xAA,
-    0x5D, 0x02, 0xF6, 0x05, 0x0A, 0xBD, 0x81, 0xB6, 0x1C, 0x38, 0x38, 0x07, 0x8A, 0xE4, 0x60, 0x53,
-    0x06, 0x4B, 0x02, 0xBE, 0xFB, 0x07, 0x94, 0x5C, 0xE4, 0x44, 0x81, 0xCA, 0x25, 0xF1, 0x02, 0x2A,
-    0x50, 0xC0, 0x60, 0x45, 0xC0, 0xBE, 0xE0, 0x52, 0x04, 0x77, 0xE5, 0xF0, 0x26, 0xA0, 0xCA, 0xB2,
-    0x1C, 0x2C, 0x5C, 0x35, 0x67, 0x0F, 0xA5, 0x19, 0xB4, 0xDF, 0xF7, 0xBD, 0xD7, 0x18, 0xEC, 0x92,
-    0x3A, 0x49, 0x24, 0x8F, 0x22, 0xF7, 0x3C, 0xB5, 0xDB, 0xFD, 0x76, 0x06, 0xD3, 0xE8, 0x7E, 0xAF,
-    0xFB, 0xFD, 0xF8, 0xDE, 0xC3, 0x3A, 0x27, 0xAF, 0x78, 0x81, 0xD6, 0xA5, 0x2B, 0x17, 0xFB, 0xA1,
-    0x4C, 0xD7, 0x2E, 0xF7, 0x7E, 0x19, 0xAF, 0x9C, 0xAF, 0xE3, 0xC1, 0x2D, 0x93, 0xB5, 0x73, 0x55,
-    0xDD, 0xA7, 0x4B, 0xE7, 0xE6, 0xFF, 0xDE, 0x66, 0x72, 0x6D, 0x36, 0xB8, 0xBC, 0x73, 0x6E, 0xB6,
-    0x74, 0x45, 0xEB, 0x9C, 0x7C, 0x5E, 0xD5, 0xEC, 0x1A, 0xE9, 0xE2, 0x8D, 0x6B, 0x4A, 0x76, 0x1E,
-    0xDD, 0xC0, 0x2E, 0x7A, 0x54, 0x27, 0x9F, 0xD9, 0x95, 0xF6, 0x3D, 0x1B, 0xC5, 0xC6, 0xCC, 0x5B,
-    0xDE, 0x61, 0x8E, 0xFB, 0xF5, 0x2E, 0xED, 0xE5, 0xEE, 0x1D, 0xDE, 0x77, 0x85, 0x5C, 0xE6, 0x4B,
-    0x19, 0x44, 0xC8, 0xA1, 0x59, 0x49, 0x77, 0xC1, 0xFB, 0x1A, 0x0B, 0x38, 0xBF, 0xE7, 0xF4, 0xF5,
-    0x03, 0xB6, 0x18, 0x88, 0x6D, 0xF4, 0x36, 0x46, 0x6B, 0x7C, 0x97, 0xB6, 0xC9, 0x70, 0x67, 0x95,
-    0xD6, 0xD9, 0x22, 0x1A, 0xE6, 0x78, 0xAF, 0x5A, 0xB9, 0xA2, 0xC4, 0x25, 0x95, 0xE3, 0x25, 0xBC,
-    0x89, 0x97, 0x3B, 0x76, 0x4E, 0xC6, 0x97, 0xB5, 0x4E, 0x5B, 0x3F, 0xB6, 0x9D, 0x5D, 0xA9, 0xDF,
-    0x92, 0x09, 0xC9, 0x4F, 0xCE, 0x41, 0xB2, 0x1E, 0x13, 0xC3, 0x5D, 0xE4, 0xD6, 0x95, 0x7F, 0x4F,
-    0x5A, 0xB9, 0x7B, 0x78, 0x5D, 0xB3, 0xBE, 0xA9, 0x2B, 0xBF, 0x71, 0xC5, 0xAA, 0x69, 0xD9, 0xAF,
-    0xF3, 0x3A, 0xC6, 0x0A, 0xD6, 0x59, 0x89, 0xE1, 0xDD, 0xD1, 0xDC, 0x69, 0x7F, 0x53, 0xFB, 0xA6,
-    0xD7, 0xFE, 0x53, 0x67, 0xEF, 0x3F, 0xA3, 0xFE, 0x2E, 0xEE, 0x2D, 0xBF, 0x5C, 0x4B, 0xED, 0xA2,
-    0x1E, 0xEC, 0x14, 0x21, 0xA0, 0x9F, 0x3F, 0xA0, 0x84, 0xDC, 0xCC, 0x7B, 0xAF, 0x6B, 0xF2, 0x4B,
-    0xF6, 0xD1, 0xFE, 0xB8, 0xDC, 0x0B, 0x25, 0x3B, 0x61, 0x14, 0x5E, 0x79, 0xCF, 0x2E, 0xEB, 0x8B,
-    0xC1, 0x15, 0x3E, 0x59, 0xBC, 0x31, 0xB8, 0x2B, 0x3E, 0x69, 0xC1, 0x2F, 0x9F, 0xD6, 0xE0, 0xB1,
-    0xBF, 0xE7, 0xD8, 0x2D, 0xB4, 0x73, 0x4F, 0xDC, 0x35, 0x2E, 0x42, 0x57, 0x95, 0x89, 0xE7, 0xD4,
-    0xE7, 0x15, 0xA6, 0xE3, 0x37, 0xD5, 0xE7, 0x98, 0x78, 0x5F, 0xC8, 0x6E, 0x72, 0x97, 0xDD, 0xE4,
-    0xF5, 0xBE, 0x7B, 0x7D, 0xA4, 0x6F, 0x72, 0xDD, 0xFA, 0xCA, 0x7F, 0xD2, 0x8F, 0x74, 0x76, 0xDC,
-    0x8E, 0x74, 0xE2, 0xCB, 0x91, 0x8E, 0xFD, 0x64, 0xA0, 0xB7, 0xDD, 0x89, 0x57, 0xE5, 0xFD, 0x7F,
-    0x6A, 0xE7, 0x7B, 0x34, 0x0B, 0xF0, 0x0B, 0x87, 0xCC, 0xBB, 0x2B, 0x32, 0xD7, 0x7B, 0xE4, 0x8E,
-    0x7C, 0x5F, 0x76, 0xC1, 0x11, 0x79, 0x2C, 0x74, 0xBE, 0x80, 0x00, 0xE4, 0x1D, 0xCF, 0x13, 0xF0,
-    0x09, 0xD7, 0x22, 0x3F, 0xB3, 0xB5, 0xD0, 0xC9, 0x86, 0x34, 0xCE, 0x83, 0x93, 0x03, 0x0B, 0x5A,
-    0x4E, 0x10, 0x2F, 0x04, 0xAD, 0xA7, 0x63, 0xA1, 0x5C, 0x20, 0x0B, 0xDA, 0x2D, 0x8D, 0x39, 0x1B,
-    0x1D, 0x8F, 0xEF, 0xD9, 0x58, 0x46, 0x67, 0xAB, 0x2D, 0x3D, 0xEF, 0xB7, 0x74, 0xD1, 0x69, 0x8F,
-    0xA9, 0x34, 0xAD, 0x8D, 0x61, 0xCC, 0xB6, 0x31, 0x92, 0xC1, 0x68, 0x99, 0xA7, 0xFC, 0xB8, 0xD7,
-    0x38, 0xDE, 0x12, 0x3F, 0x6E, 0xC7, 0xD6, 0x85, 0xAD, 0x70, 0xE8, 0x74, 0x0C, 0x9C, 0xD2, 0x23,
-    0x99, 0xC7, 0x4C, 0x97, 0x1F, 0xAD, 0x0F, 0xC0, 0x18, 0xB9, 0x83, 0xBC, 0x56, 0xC2, 0xA4, 0xA1,
-    0x34, 0x3A, 0xB0, 0xB9, 0x16, 0x29, 0x19, 0xD9, 0xCF, 0x3A, 0xE3, 0xAC, 0x5B, 0xE7, 0xA5, 0x31,
-    0xD6, 0x15, 0x8D, 0x33, 0xBE, 0xBA, 0xB9, 0xB2, 0x06, 0x87, 0x0B, 0xF7, 0xD7, 0xBB, 0xBB, 0x68,
-    0xCF, 0x19, 0x53, 0xDD, 0x76, 0xAE, 0x6E, 0xBB, 0x04, 0x19, 0x68, 0x6D, 0x1C, 0x0D, 0xA4, 0x30,
-    0xF4, 0xA6, 0x13, 0x15, 0xA8, 0x7C, 0xB8, 0x0B, 0xB5, 0xA4, 0xE4, 0xC7, 0x58, 0x40, 0xE0, 0x62,
-    0x53, 0x8E, 0xE4, 0x70, 0x82, 0xAF, 0x46, 0xA6, 0xCB, 0x2D, 0x87, 0x17, 0x23, 0x23, 0x8B, 0x76,
-    0xE4, 0x63, 0x53, 0x8E, 0x5F, 0x19, 0xC6, 0x99, 0x05, 0xC1, 0xC8, 0x0A, 0x64, 0x80, 0x57, 0x6C,
-    0x15, 0x32, 0xFB, 0x37, 0xB7, 0x2C, 0xDC, 0x35, 0x0E, 0xCA, 0x31, 0x3D, 0x52, 0x06, 0x3A, 0x69,
-    0xD7, 0xCA, 0x3F, 0x92, 0x72, 0x1C, 0x6F, 0x97, 0xEE, 0x65, 0x1E, 0xCA, 0xCC, 0xB7, 0x2E, 0xAB,
-    0x73, 0x1E, 0xDB, 0x56, 0xCE, 0xF3, 0xA7, 0xDC, 0xE3, 0xA2, 0x28, 0x87, 0x95, 0x51, 0xD4, 0x39,
-    0x4A, 0x51, 0xE6, 0xA4, 0xCE, 0x97, 0x81, 0x52, 0x6D, 0x6B, 0x54, 0xE4, 0x37, 0x79, 0x1B, 0x63,
-    0x6B, 0x8B, 0x32, 0xF8, 0xA9, 0x52, 0xF3, 0xE5, 0xEC, 0xB8, 0x8D, 0x7B, 0x99, 0x1A, 0xD8, 0xD3,
-    0x26, 0xA2, 0x2B, 0x6B, 0x51, 0x92, 0x55, 0x9B, 0x80, 0x5B, 0x95, 0x0B, 0x5A, 0xBE, 0x51, 0x6A,
-    0xB6, 0xE2, 0xAA, 0x5A, 0x0A, 0xC5, 0x28, 0x79, 0x7F, 0x50, 0xAA, 0xAA, 0x03, 0xE5, 0x9D, 0x51,
-    0xC6, 0x54, 0xA1, 0xE4, 0xAB, 0x36, 0x0A, 0xE4, 0xA9, 0x23, 0xCB, 0xDB, 0x1F, 0xF3, 0x6E, 0xF8,
-    0x6A, 0xCF, 0x19, 0xE0, 0xEA, 0x3E, 0x5B, 0xCE, 0x7E, 0xD7, 0x89, 0x54, 0x67, 0x98, 0x69, 0x36,
-    0x40, 0x77, 0xF5, 0x91, 0x5F, 0x67, 0xFE, 0x2D, 0x50, 0xB6, 0x3E, 0x9E, 0x53, 0x9C, 0x25, 0xD9,
-    0x73, 0x23, 0x11, 0xF3, 0xA0, 0xCF, 0xBC, 0x6D, 0x75, 0x3B, 0x7E, 0x22, 0xB4, 0xF5, 0x73, 0x40,
-    0x24, 0xAD, 0x11, 0xB3, 0xDA, 0x88, 0xF4, 0x21, 0x22, 0x03, 0x81, 0xE3, 0x5E, 0x80, 0xC0, 0x16,
-    0xF1, 0x20, 0x9A, 0x40, 0xD8, 0x89, 0x7A, 0x88, 0x48, 0x1E, 0x22, 0x66, 0xCB, 0xA0, 0x08, 0x83,
-    0x4E, 0xCC, 0x3B, 0x7B, 0x23, 0x68, 0xC3, 0xEC, 0x7E, 0x50, 0x7C, 0x51, 0x78, 0xA7, 0x57, 0x56,
-    0x6E, 0x7B, 0xE5, 0x68, 0xAA, 0xE7, 0xC8, 0xCE, 0xDE, 0xD7, 0xF6, 0x89, 0xE7, 0xB6, 0x70, 0x51,
-    0xA3, 0xBD, 0x6D, 0x13, 0x07, 0xBF, 0xE0, 0x29, 0xF4, 0x49, 0xAB, 0xFD, 0xAC, 0xD6, 0x3E, 0x3D,
-    0xD5, 0x67, 0xD2, 0x2B, 0xEF, 0xD2, 0x5E, 0x59, 0x97, 0xF6, 0x8D, 0xF5, 0x3A, 0xC9, 0xAF, 0xEB,
-    0xB3, 0x85, 0xF5, 0xC6, 0xA2, 0x70, 0x78, 0x2A, 0xE5, 0x4B, 0xB6, 0x19, 0x2F, 0x7B, 0xF7, 0x23,
-    0xE7, 0xF6, 0x9A, 0x41, 0x38, 0x3F, 0x1B, 0xB0, 0xBF, 0xAC, 0x89, 0xD6, 0xD4, 0x04, 0x0F, 0x37,
-    0x0D, 0x3E, 0xC8, 0xD1, 0xC4, 0xEB, 0x70, 0xDD, 0x93, 0x35, 0xA2, 0x8B, 0xA0, 0x7D, 0x3F, 0x8F,
-    0x44, 0x6D, 0xAC, 0x23, 0x88, 0xFB, 0x54, 0xC3, 0x4D, 0x91, 0xAC, 0xC2, 0x1E, 0x80, 0x6B, 0x46,
-    0xBF, 0x25, 0x79, 0xE0, 0x2A, 0x59, 0x48, 0xEE, 0x97, 0x85, 0x1F, 0x2A, 0x6F, 0x94, 0x8F, 0xE5,
-    0xD4, 0x51, 0x0F, 0xCA, 0xE1, 0xEB, 0xA0, 0xF0, 0xE1, 0xE8, 0x79, 0xAA, 0x7E, 0xAC, 0x1F, 0x1A,
-    0x5D, 0xA9, 0xFF, 0xDD, 0x04, 0xEA, 0xF7, 0x3E, 0x50, 0x4B, 0xB9, 0xD6, 0x28, 0x51, 0x40, 0x46,
-    0x89, 0x29, 0x32, 0x4A, 0x0C, 0x94, 0x51, 0xB2, 0x2F, 0x8D, 0x92, 0xF9, 0x1B, 0x25, 0x0A, 0x3F,
-    0x50, 0x45, 0x1B, 0xA8, 0x79, 0x1F, 0xA8, 0x6C, 0x19, 0xA8, 0x64, 0x1D, 0xA8, 0xD8, 0x07, 0xCA,
-    0xF9, 0xA3, 0x40, 0xC1, 0x41, 0x50, 0x2A, 0x1F, 0xA9, 0x8C, 0x94, 0x78, 0xC7, 0x34, 0x1A, 0x55,
-    0x79, 0x20, 0x4E, 0x5E, 0x4C, 0xAA, 0xC1, 0xDA, 0xD6, 0xA3, 0x6C, 0xDD, 0xA3, 0xA9, 0xC6, 0x3D,
-    0x4C, 0x0D, 0xA3, 0x0F, 0xB1, 0x09, 0x54, 0x3A, 0xDA, 0x3B, 0xDF, 0x85, 0x13, 0xF8, 0x60, 0xEB,
-    0x50, 0xEC, 0x8D, 0xE7, 0xD4, 0x38, 0x9F, 0x6C, 0x8C, 0xF1, 0xC9, 0xC6, 0xF8, 0x2E, 0x22, 0x33,
-    0xB6, 0xBB, 0xC0, 0x75, 0x17, 0x98, 0xEE, 0x02, 0xCF, 0x9D, 0xB1, 0x5C, 0x76, 0x93, 0x72, 0xFC,
-    0x60, 0x6D, 0x0C, 0x97, 0x35, 0x29, 0xBF, 0x65, 0x1C, 0x65, 0x37, 0x08, 0x72, 0x1B, 0x04, 0x99,
-    0x0D, 0x82, 0xBC, 0x26, 0x01, 0x56, 0x93, 0x00, 0xA7, 0x49, 0x80, 0xD1, 0x24, 0xC0, 0x67, 0x12,
-    0x60, 0x33, 0x09, 0x70, 0x59, 0x09, 0x61, 0xB2, 0x12, 0x79, 0x20, 0x32, 0x10, 0xC6, 0x61, 0xEC,
-    0x48, 0x32, 0x18, 0xBB, 0x92, 0xFC, 0x8D, 0x82, 0x22, 0xFA, 0x03, 0xC4, 0x56, 0x7D, 0x05, 0x36,
-    0xCE, 0x82, 0xB2, 0x9A, 0x2F, 0x02, 0x5F, 0xEB, 0xD3, 0x6C, 0xDD, 0x3B, 0xF9, 0x9D, 0xE0, 0x14,
-    0x04, 0xCD, 0x17, 0x2F, 0xDD, 0xD7, 0xBE, 0xD4, 0xC9, 0xC7, 0xB6, 0x97, 0x2D, 0xBE, 0x3E, 0x58,
-    0xC1, 0x13, 0x39, 0x58, 0x27, 0x5F, 0x76, 0x73, 0x2C, 0x5E, 0x74, 0x87, 0x0C, 0x2A, 0x3D, 0x0F,
-    0xAB, 0xF4, 0x1B, 0xEB, 0xB9, 0x9A, 0xA7, 0xDF, 0x8B, 0xE6, 0x10, 0x87, 0x25, 0x59, 0xDF, 0xF1,
-    0x8B, 0xC8, 0x2F, 0x92, 0x35, 0xCD, 0x5C, 0x9F, 0x9C, 0x5A, 0x4F, 0x58, 0xE7, 0xD8, 0x2F, 0x4F,
-    0xB2, 0x2A, 0xE8, 0x30, 0xD3, 0x59, 0xC1, 0xD7, 0xE5, 0xD9, 0x37, 0x47, 0xD9, 0x7C, 0xE4, 0xFC,
-    0xAD, 0x7E, 0xE2, 0x19, 0xDB, 0x85, 0xC1, 0x1F, 0x3E, 0xE9, 0x0A, 0xAF, 0xA6, 0xFB, 0x5C, 0x7D,
-    0x45, 0x9A, 0x55, 0xDC, 0xAF, 0xE1, 0xF7, 0xB2, 0x82, 0x82, 0x99, 0xEB, 0x6D, 0x77, 0x35, 0x7A,
-    0xD8, 0x51, 0x63, 0x73, 0xA4, 0x73, 0x5A, 0x72, 0xCA, 0x91, 0xAE, 0x28, 0x5E, 0x70, 0xB4, 0x84,
-    0x21, 0x9B, 0x9B, 0xA9, 0x37, 0x96, 0xD5, 0x3C, 0x72, 0x99, 0xE8, 0xE8, 0x16, 0xC7, 0x82, 0xDD,
-    0xAE, 0xC6, 0x22, 0x87, 0x6A, 0xBA, 0xEE, 0xEA, 0x0A, 0x97, 0xF4, 0x3E, 0x10, 0xDB, 0xC0, 0x79,
-    0xED, 0x69, 0xDB, 0xC1, 0x01, 0x09, 0x19, 0xEE, 0x0C, 0xB5, 0xBB, 0xE3, 0xEF, 0xE3, 0xBB, 0xF0,
-    0xA8, 0xB8, 0xE6, 0xA3, 0x08, 0x5B, 0x76, 0xB6, 0xB0, 0xD5, 0x72, 0xEA, 0xBA, 0x8C, 0x71, 0x9D,
-    0x8C, 0x80, 0x1A, 0xD9, 0x00, 0xC9, 0xF0, 0xF7, 0x6B, 0xB0, 0x6B, 0x83, 0x1B, 0x35, 0x2E, 0x59,
-    0xE0, 0xC8, 0xEF, 0xC1, 0x47, 0x71, 0x63, 0x73, 0xFE, 0xB6, 0xA7, 0x7F, 0xEB, 0x52, 0x51, 0xA2,
-    0xD8, 0x9C, 0x95, 0x86, 0xA3, 0xC2, 0x84, 0x66, 0x6C, 0xBC, 0xBC, 0x27, 0xEC, 0x9C, 0x2F, 0xE6,
-    0x45, 0x99, 0xF9, 0x75, 0x71, 0x3F, 0xF6, 0x7D, 0xBE, 0x62, 0xE8, 0xF2, 0x8E, 0x7B, 0x79, 0x57,
-    0x02, 0xC6, 0x9F, 0xF7, 0xE9, 0x71, 0x97, 0xF8, 0x1A, 0xFE, 0xE4, 0xDB, 0xE6, 0xC2, 0xC8, 0x0F,
-    0x8C, 0xAC, 0xFA, 0x2C, 0x8F, 0xFB, 0x23, 0x23, 0x88, 0x49, 0x68, 0xFC, 0x46, 0x6E, 0x74, 0xDD,
-    0x1D, 0x65, 0x3F, 0x13, 0xD7, 0x49, 0x6E, 0x44, 0x2E, 0xBF, 0x64, 0x0B, 0x2E, 0xC4, 0xDB, 0xD6,
-    0xEB, 0x9B, 0x6F, 0xFD, 0xE3, 0xCB, 0x37, 0xFC, 0x03, 0x31, 0x17, 0xE2, 0x8F, 0x46, 0x12, 0x25,
-    0x27, 0x8B, 0x54, 0xB8, 0x19, 0xAD, 0x0A, 0x8C, 0x77, 0x8F, 0xBB, 0xA3, 0xE0, 0x56, 0x61, 0xF4,
-    0xB1, 0xF5, 0xCC, 0x1C, 0x21, 0x0A, 0x4A, 0x14, 0x3A, 0x04, 0x00, 0x85, 0xE2, 0x13, 0x84, 0x27,
-    0x3A, 0xA2, 0x13, 0xBD, 0x82, 0x13, 0xEA, 0x61, 0x2A, 0xA8, 0xA0, 0x08, 0x83, 0xC2, 0x0D, 0x8A,
-    0x3D, 0x28, 0x10, 0x71, 0xBA, 0x8D, 0x07, 0xBD, 0x46, 0xAF, 0xD7, 0xEF, 0xEA, 0x38, 0x0A, 0x47,
-    0x28, 0x1A, 0xA1, 0x60, 0x84, 0x61, 0x11, 0x0A, 0x45, 0x28, 0x12, 0x61, 0x40, 0x04, 0x70, 0x88,
-    0xA8, 0x76, 0xFF, 0x80, 0x8D, 0x2A, 0x97, 0xDE, 0xCA, 0xB0, 0x05, 0x31, 0x70, 0x36, 0x04, 0xB5,
-    0x12, 0xED, 0x9D, 0xD0, 0x1C, 0x8D, 0x68, 0x6A, 0x82, 0x06, 0x40, 0x26, 0x14, 0x4A, 0x00, 0x2E,
-    0x51, 0x13, 0x60, 0x20, 0xD6, 0x40, 0xD8, 0x81, 0x38, 0xC4, 0xB6, 0xF1, 0xA1, 0xE9, 0x78, 0x09,
-    0x2F, 0x26, 0x18, 0xC1, 0x01, 0x08, 0x45, 0x28, 0x12, 0x41, 0x20, 0x42, 0x55, 0xD4, 0x6B, 0x0A,
-    0x8E, 0x5C, 0x53, 0xE5, 0x9F, 0xFD, 0x1B, 0xCF, 0xFC, 0xEC, 0xAB, 0x85, 0xB2, 0x56, 0x4F, 0xBA,
-    0x1D, 0xF4, 0xCB, 0xD3, 0xF8, 0x75, 0x23, 0x52, 0x5E, 0x5A, 0x47, 0xD5, 0xB9, 0x19, 0xB1, 0x82,
-    0xEF, 0xA3, 0xBB, 0x3B, 0x22, 0x13, 0x06, 0x4C, 0x18, 0x2E, 0x61, 0xB0, 0x44, 0x40, 0x25, 0x0C,
-    0x94, 0x50, 0x4C, 0xE2, 0x22, 0x62, 0x47, 0x51, 0x10, 0x19, 0x44, 0xBC, 0xBC, 0x45, 0xC3, 0x4B,
-    0x55, 0x58, 0xF1, 0xA2, 0x7C, 0x71, 0x6A, 0xA7, 0xE9, 0xDE, 0x06, 0x58, 0xE1, 0x88, 0x55, 0x30,
-    0xAA, 0xF6, 0x21, 0xB4, 0x7B, 0xF2, 0x56, 0xD1, 0x09, 0x05, 0x27, 0x14, 0x9B, 0x50, 0x68, 0xC2,
-    0x90, 0x09, 0x65, 0xFF, 0xD5, 0xDB, 0x1F, 0xE9, 0x11, 0x1B, 0x26, 0x7F, 0xD9, 0xEB, 0x9C, 0xBB,
-    0xC4, 0xCF, 0x1C, 0xCF, 0x4B, 0x55, 0xF3, 0x92, 0xA2, 0x1C, 0x54, 0xC0, 0x37, 0x4E, 0xDB, 0xA8,
-    0x33, 0x21, 0xC4, 0xF3, 0xFB, 0xFB, 0xAA, 0xD7, 0xDB, 0xD0, 0x4E, 0x5F, 0x69, 0x37, 0xAF, 0x09,
-    0x31, 0x31, 0x92, 0xE4, 0x20, 0xDD, 0xBC, 0x7C, 0x84, 0xBD, 0xFE, 0xBE, 0xC5, 0xAA, 0x08, 0xCD,
-    0x68, 0x8B, 0xCD, 0xE4, 0x66, 0xBA, 0x9C, 0xB9, 0x5E, 0xF2, 0xBA, 0x61, 0x86, 0x47, 0xEA, 0x40,
-    0x0E, 0x93, 0xCE, 0x44, 0x7E, 0xE6, 0xA4, 0x2B, 0x3B, 0xBC, 0xDE, 0xBA, 0xCB, 0x5C, 0x6A, 0x44,
-    0x33, 0x90, 0xF0, 0x70, 0xA6, 0x78, 0xFB, 0x42, 0x7D, 0x91, 0x11, 0x93, 0xA2, 0x05, 0x90, 0x74,
-    0xBA, 0xC8, 0x6B, 0x84, 0x9A, 0xE7, 0x9F, 0x2F, 0x19, 0xDF, 0x70, 0xAF, 0x52, 0xAF, 0x94, 0x94,
-    0x71, 0xF6, 0x1F, 0xBD, 0x3A, 0x47, 0xEA, 0xCE, 0x9B, 0xF7, 0xA9, 0xAB, 0xCE, 0x55, 0xC6, 0x76,
-    0x74, 0xC3, 0x41, 0x3E, 0xA3, 0x32, 0x56, 0x35, 0xAC, 0x27, 0x35, 0x5E, 0xDD, 0xE3, 0xE7, 0xE4,
-    0x50, 0x41, 0x06, 0xFD, 0xE8, 0x3D, 0x82, 0x7C, 0x17, 0xCB, 0x87, 0x64, 0xDC, 0x3E, 0x87, 0x32,
-    0x56, 0x5F, 0x35, 0x20, 0x20, 0xE6, 0x31, 0x87, 0x40, 0xE1, 0x48, 0xBB, 0x57, 0x4C, 0xC6, 0x87,
-    0x13, 0x19, 0x17, 0x41, 0xC6, 0x9F, 0x9E, 0x4D, 0x19, 0x13, 0xA2, 0x9D, 0xAD, 0x26, 0xB1, 0xD8,
-    0x3D, 0xE3, 0x02, 0x3F, 0xA8, 0xB7, 0x32, 0xEE, 0xF3, 0x51, 0x57, 0x3F, 0x9F, 0x32, 0xA6, 0x37,
-    0x07, 0xC7, 0x6E, 0x06, 0x8C, 0x30, 0xAB, 0xD3, 0xB5, 0xFB, 0x21, 0xE6, 0x71, 0xCE, 0x22, 0xF8,
-    0xA2, 0x0C, 0xFB, 0x80, 0x09, 0xA7, 0xBC, 0xBD, 0xBC, 0xBF, 0x5F, 0xB5, 0x05, 0x42, 0x8E, 0xE2,
-    0x8B, 0xDB, 0x0D, 0x3D, 0x32, 0xA0, 0xA0, 0x45, 0x8D, 0xA6, 0x54, 0xDF, 0x0C, 0x39, 0xA5, 0x74,
-    0x49, 0x48, 0xEE, 0x0E, 0x60, 0x4B, 0x88, 0x59, 0x7D, 0xC2, 0xDB, 0xB7, 0x3F, 0xA0, 0x7E, 0xF0,
-    0x6B, 0xFD, 0xEB, 0xC3, 0x09, 0x27, 0x2E, 0x69, 0x88, 0xBA, 0x89, 0xC9, 0xD8, 0x41, 0x8D, 0x87,
-    0x75, 0x37, 0xA2, 0xFE, 0x11, 0x76, 0xEE, 0x05, 0x0E, 0xB7, 0xF6, 0xF7, 0xF7, 0x08, 0xBD, 0x5A,
-    0xB3, 0x7D, 0xAD, 0xE5, 0x7C, 0x45, 0x1B, 0x99, 0x13, 0x1B, 0x77, 0x14, 0x9F, 0x58, 0xF8, 0x33,
-    0x8D, 0xBE, 0x46, 0x39, 0x59, 0xC7, 0x39, 0x6F, 0x5F, 0xEF, 0x4C, 0x51, 0x09, 0x13, 0x42, 0xC0,
-    0x28, 0xDE, 0x39, 0x4B, 0x72, 0x8A, 0x20, 0xA2, 0xE8, 0x94, 0x9C, 0x30, 0x86, 0x9E, 0x7E, 0x36,
-    0xD1, 0xC9, 0x0F, 0x9F, 0xB1, 0x9C, 0xE0, 0x38, 0x06, 0x94, 0xDA, 0xBC, 0xC6, 0xCC, 0x07, 0x08,
-    0xE8, 0xEB, 0x5F, 0x00, 0x79, 0x19, 0x0E, 0x91, 0xC0, 0xE5, 0xB3, 0x3B, 0xCC, 0x2A, 0xC8, 0xD7,
-    0x73, 0x24, 0x51, 0xE0, 0xA1, 0x21, 0x0B, 0x01, 0x62, 0x07, 0x04, 0xC6, 0xBE, 0x8B, 0x0C, 0x05,
-    0xDE, 0xE9, 0x0D, 0x3B, 0x89, 0x17, 0x01, 0x44, 0x69, 0x8D, 0x48, 0xEB, 0x3C, 0x38, 0x7B, 0x46,
-    0xEC, 0x42, 0x1E, 0x90, 0xE3, 0x61, 0x20, 0x96, 0xF6, 0x91, 0x48, 0x21, 0x37, 0x64, 0xC5, 0xE6,
-    0x3E, 0x0B, 0x84, 0xC4, 0x32, 0xFA, 0xD1, 0x3C, 0xE0, 0x34, 0xBB, 0x4A, 0xBC, 0x0F, 0xF5, 0x0D,
-    0xA2, 0x27, 0xB4, 0x06, 0x02, 0xE7, 0x44, 0xB8, 0x16, 0xF7, 0x33, 0x25, 0xD2, 0xBE, 0x19, 0xEA,
-    0x8B, 0x58, 0x57, 0x2F, 0xA3, 0xCD, 0x49, 0x6C, 0xF9, 0x94, 0x5B, 0x5E, 0x37, 0xF4, 0xA7, 0x01,
-    0xAF, 0xFD, 0x10, 0xB9, 0x2E, 0xA0, 0xBC, 0x44, 0x88, 0x83, 0xBF, 0xB3, 0x84, 0x1C, 0x3D, 0xD4,
-    0x1A, 0x44, 0x89, 0x9D, 0x07, 0x69, 0xB6, 0x26, 0x50, 0xDD, 0x7B, 0x68, 0xB8, 0x95, 0xB5, 0x17,
-    0xC9, 0x82, 0xB1, 0x4C, 0xF1, 0x01, 0x4F, 0x7F, 0xA0, 0x17, 0x51, 0xC4, 0xAA, 0x52, 0x2B, 0xD3,
-    0xAF, 0x4D, 0x6D, 0x7D, 0xAB, 0xBD, 0x30, 0x20, 0x82, 0xC4, 0x8F, 0x45, 0x29, 0x43, 0xE8, 0xBF,
-    0xDE, 0x88, 0x8D, 0x11, 0x99, 0x46, 0x38, 0x8B, 0xB1, 0x6C, 0xC5, 0x1C, 0xAE, 0xD6, 0xE5, 0x53,
-    0x08, 0x54, 0xE5, 0x91, 0x9B, 0x48, 0xD5, 0x68, 0x55, 0x5D, 0x84, 0x51, 0x06, 0xB5, 0x69, 0x2B,
-    0x9E, 0x03, 0x9C, 0x01, 0xF1, 0xC3, 0x71, 0x22, 0x7E, 0x10, 0x6A, 0x08, 0x42, 0x57, 0xE9, 0x7E,
-    0xD1, 0x03, 0x19, 0x3A, 0x7F, 0xBA, 0x03, 0x07, 0xA5, 0x93, 0x7B, 0xE0, 0x92, 0xA8, 0x59, 0xF2,
-    0x7B, 0x12, 0x5E, 0x22, 0x09, 0x2B, 0xE3, 0xCA, 0x60, 0x57, 0x9B, 0x2F, 0xE0, 0x33, 0x54, 0x72,
-    0x89, 0xDC, 0xEF, 0xF2, 0xC1, 0x67, 0xC4, 0x7B, 0xE5, 0x33, 0x24, 0x01, 0x71, 0x6B, 0x61, 0x1E,
-    0x7C, 0x8A, 0xB9, 0xCA, 0x59, 0x96, 0xF4, 0xC0, 0x4D, 0x4B, 0x09, 0x2E, 0x41, 0x00, 0x31, 0x91,
-    0xDF, 0x63, 0xA4, 0x0D, 0xFF, 0x6E, 0xB8, 0x85, 0x43, 0xB6, 0xF9, 0x33, 0x80, 0x78, 0x0D, 0xE3,
-    0x89, 0x8A, 0xAD, 0x18, 0xA7, 0x69, 0x2B, 0x9F, 0x56, 0x04, 0xFC, 0x60, 0x8D, 0x07, 0x1E, 0xCB,
-    0x82, 0x5B, 0x2D, 0xBF, 0x57, 0x5A, 0xC2, 0x5F, 0xD3, 0xFC, 0x4E, 0x95, 0x6A, 0x34, 0xD0, 0x1A,
-    0xE9, 0xD6, 0x2F, 0x00, 0x6A, 0xC6, 0xFE, 0x36, 0xAC, 0x60, 0x07, 0x49, 0xE7, 0xA5, 0x38, 0x70,
-    0xE2, 0xC3, 0x5C, 0xFD, 0xE5, 0x50, 0x17, 0xF8, 0x58, 0x5A, 0xE8, 0x0A, 0xB9, 0x51, 0xBA, 0x80,
-    0x8D, 0x3B, 0x68, 0xB1, 0x53, 0xA1, 0x7F, 0x0E, 0xB4, 0x14, 0xE2, 0x3D, 0x55, 0x7B, 0x4B, 0x1D,
-    0xFD, 0x96, 0xC6, 0x3B, 0xB9, 0x29, 0xB8, 0x61, 0x8A, 0xBA, 0x46, 0x7B, 0xEE, 0xB9, 0x93, 0x1A,
-    0x3A, 0x4A, 0x45, 0xEF, 0x27, 0xDD, 0x77, 0x90, 0x1A, 0xD1, 0xC3, 0x5D, 0x28, 0xFA, 0xF9, 0xCF,
-    0xE5, 0xCB, 0x29, 0xD0, 0xC3, 0x84, 0x66, 0xDF, 0x4F, 0xD0, 0xC3, 0x4B, 0x2A, 0x57, 0x8A, 0x15,
-    0x52, 0xA5, 0x50, 0x29, 0x53, 0x8A, 0x94, 0x52, 0xDC, 0x36, 0x14, 0xA7, 0x4A, 0x93, 0xC2, 0xA4,
-    0x2C, 0xAF, 0x41, 0x94, 0x9F, 0x04, 0x41, 0x92, 0xD3, 0x2A, 0x46, 0x4A, 0x11, 0x42, 0xA4, 0x0C,
-    0x29, 0x42, 0x4A, 0xB0, 0x30, 0xE0, 0x2D, 0x5E, 0x52, 0x7C, 0xD8, 0x2C, 0x0B, 0x0A, 0x4F, 0x65,
-    0xA7, 0xA2, 0x33, 0xC0, 0x97, 0xF0, 0xA7, 0x01, 0xA0, 0x23, 0xE0, 0x6B, 0x86, 0xCA, 0xCC, 0xD6,
-    0xF4, 0xB8, 0xC1, 0x8B, 0x15, 0x86, 0x5A, 0x07, 0x34, 0x72, 0xAE, 0x05, 0x0A, 0x08, 0xD8, 0xA4,
-    0xBB, 0xAE, 0xF9, 0x3D, 0x4D, 0x70, 0xC7, 0x5A, 0x68, 0x90, 0x6A, 0x5D, 0xC1, 0x5C, 0x73, 0x7F,
-    0x37, 0xD9, 0xE9, 0x5D, 0x3D, 0x2B, 0x4F, 0x9C, 0xCF, 0xF4, 0xAF, 0x42, 0x2D, 0x6F, 0xA3, 0xC5,
-    0x07, 0xFF, 0x4D, 0xED, 0xEC, 0xDB, 0x46, 0x4B, 0x14, 0x0A, 0x1D, 0xCC, 0x0A, 0x19, 0x66, 0x4C,
-    0xE3, 0xBA, 0xC4, 0x92, 0xEF, 0x5E, 0x53, 0xC9, 0x95, 0xE6, 0xE0, 0x73, 0x54, 0x1B, 0x94, 0xC8,
-    0xC5, 0x1D, 0xF8, 0xCF, 0x11, 0xA0, 0x35, 0x48, 0x51, 0x1E, 0x2C, 0x42, 0xB2, 0x9C, 0x89, 0xF2,
-    0x64, 0x41, 0x43, 0xF6, 0xD5, 0x32, 0xA4, 0x53, 0xC2, 0xF6, 0x82, 0x82, 0xB9, 0x4A, 0x54, 0xA6,
-    0xE2, 0xFA, 0x67, 0xC3, 0x24, 0xA5, 0xF3, 0x4D, 0x6D, 0xE3, 0x91, 0xDA, 0x3E, 0x18, 0x4A, 0x69,
-    0xB1, 0xA5, 0x06, 0x87, 0xA8, 0x68, 0x20, 0x5F, 0x06, 0xB2, 0x65, 0x20, 0x57, 0x06, 0x32, 0x65,
-    0xA0, 0x86, 0xDF, 0x54, 0x5C, 0x1A, 0xDD, 0x6D, 0xFF, 0x2B, 0x5E, 0x13, 0x69, 0xC5, 0x01, 0xB6,
-    0xF6, 0xC0, 0x69, 0x0D, 0xE4, 0xF3, 0x80, 0xE5, 0xCB, 0x67, 0x22, 0x98, 0xDC, 0xDF, 0x8F, 0xA0,
-    0xA9, 0xD7, 0xA1, 0x0C, 0xE7, 0x85, 0x00, 0x52, 0xD3, 0x6E, 0x1B, 0x33, 0xDC, 0x54, 0xDF, 0xEF,
-    0xA1, 0xD6, 0xEF, 0xEB, 0x46, 0xA3, 0x51, 0xDD, 0x3C, 0x4B, 0x40, 0x35, 0xB9, 0xAF, 0x1E, 0x15,
-    0xC2, 0xB8, 0x30, 0xC1, 0x4F, 0xC7, 0x50, 0xA7, 0xFA, 0x05, 0x95, 0x6B, 0x69, 0x3B, 0x22, 0x22,
-    0x6E, 0x25, 0xDA, 0xA5, 0x0B, 0xED, 0xF4, 0x75, 0x56, 0x65, 0x01, 0xDF, 0x30, 0x81, 0x5B, 0x11,
-    0xAB, 0x47, 0xE3, 0x9E, 0x39, 0xEA, 0xCD, 0xA4, 0x16, 0x85, 0xC4, 0xA9, 0xDF, 0x1A, 0x1B, 0x75,
-    0x2F, 0x7E, 0x4B, 0xB6, 0xCB, 0xC7, 0x17, 0x20, 0x00, 0x82, 0xE3, 0x84, 0xC6, 0x09, 0x8C, 0x13,
-    0x16, 0x57, 0x50, 0x9C, 0x76, 0x22, 0x00, 0xE2, 0xAC, 0x1B, 0x49, 0x43, 0xD3, 0xA5, 0xBF, 0xDD,
-    0xFF, 0x69, 0x9D, 0x42, 0x99, 0xA5, 0xEA, 0xC8, 0x13, 0xAC, 0xA2, 0x6D, 0xCB, 0x03, 0x0C, 0xC0,
-    0x53, 0x9C, 0xFE, 0x86, 0x5E, 0xE7, 0x7D, 0xBA, 0x9E, 0x18, 0xB0, 0xC1, 0x85, 0xF3, 0xA5, 0xD5,
-    0x70, 0x29, 0x18, 0x98, 0xD0, 0x6B, 0xDF, 0xCC, 0xD1, 0x14, 0x14, 0xB6, 0xE8, 0x63, 0xC8, 0x2B,
-    0x5B, 0x16, 0xA2, 0xEE, 0xBB, 0xCC, 0xDF, 0x11, 0xE9, 0x70, 0xA7, 0xC0, 0x85, 0x56, 0x93, 0x4A,
-    0x83, 0xFA, 0x87, 0xF3, 0x0C, 0xE6, 0xF1, 0xFA, 0x72, 0x6C, 0xE0, 0x3C, 0x1E, 0x89, 0x9E, 0x15,
-    0x3B, 0xF1, 0x43, 0x37, 0xEB, 0x02, 0x9F, 0xAE, 0x9F, 0x98, 0x33, 0xFD, 0xD9, 0xEC, 0x37, 0x74,
-    0x04, 0x85, 0x9D, 0x7F, 0xC1, 0x82, 0x4B, 0x4D, 0xED, 0xD1, 0x92, 0x5A, 0xCC, 0x1B, 0xCA, 0xFC,
-    0xB2, 0xB1, 0xE1, 0x9F, 0xF3, 0xF6, 0x4D, 0x7C, 0x7A, 0x0B, 0x51, 0x72, 0x45, 0xE5, 0xD4, 0xC9,
-    0xB4, 0xE6, 0x70, 0x24, 0xA2, 0xE6, 0x01, 0x20, 0xCE, 0x8B, 0xB9, 0x3B, 0x14, 0x66, 0x27, 0x5F,
-    0x2D, 0xC0, 0x68, 0xE1, 0xCA, 0xE5, 0x71, 0xAE, 0xF5, 0x05, 0x11, 0x4C, 0x55, 0x5B, 0x7D, 0xE5,
-    0xE3, 0xFC, 0x94, 0xF8, 0xE1, 0x7D, 0xC5, 0x3A, 0x8A, 0xDA, 0xBC, 0x55, 0xFE, 0x7F, 0x25, 0xDE,
-    0x53, 0xA8, 0xC4, 0x0B, 0x35, 0x77, 0xC6, 0xC7, 0x31, 0xA1, 0xAE, 0x35, 0x77, 0x76, 0xD3, 0x10,
-    0x5B, 0xF9, 0x90, 0x59, 0xF9, 0x93, 0xAD, 0xB9, 0x0B, 0xFB, 0x79, 0xCC, 0x55, 0x34, 0x23, 0x95,
-    0x7F, 0x47, 0xEA, 0x0C, 0xD7, 0xDC, 0x8D, 0xA8, 0x61, 0x00, 0x53, 0x0B, 0xFD, 0x44, 0x01, 0x52,
-    0x75, 0x00, 0x81, 0x66, 0xF0, 0xAF, 0x47, 0x45, 0xA4, 0x67, 0x20, 0x46, 0x70, 0xF1, 0x87, 0x01,
-    0x36, 0x65, 0xE1, 0x58, 0x3E, 0xEA, 0x63, 0x2E, 0xBF, 0x7C, 0xAE, 0x63, 0x04, 0x38, 0xF9, 0x15,
-    0x61, 0x30, 0xA5, 0x36, 0xD4, 0x09, 0xA5, 0xD3, 0x42, 0xBF, 0xF1, 0x90, 0xFE, 0x11, 0x28, 0xBC,
-    0x68, 0x11, 0x27, 0x94, 0x86, 0x12, 0x9B, 0x70, 0xDD, 0x56, 0x21, 0x3C, 0x06, 0xB5, 0x3A, 0x4D,
-    0x35, 0x88, 0x7E, 0xB9, 0xAE, 0xA2, 0x16, 0x29, 0x23, 0x6C, 0x70, 0xF3, 0x2F, 0x01, 0x74, 0x60,
-    0xD5, 0x33, 0x3F, 0xD6, 0x73, 0x5D, 0xDE, 0xEE, 0xEE, 0x6A, 0x1D, 0x35, 0xF2, 0x61, 0xB5, 0xA1,
-    0xF7, 0x17, 0x0D, 0xC5, 0xBF, 0xC8, 0xF6, 0x71, 0xC3, 0x11, 0x0B, 0xCA, 0x44, 0x26, 0x89, 0x56,
-    0xCA, 0x45, 0xA6, 0x3A, 0xBD, 0x59, 0x87, 0x72, 0xAA, 0xE4, 0x82, 0xAE, 0x3B, 0xD9, 0x8D, 0x4A,
-    0x6D, 0x6B, 0x02, 0x6C, 0xF2, 0xB3, 0xD5, 0xA8, 0x74, 0xBD, 0xEE, 0x3E, 0x6F, 0xCF, 0x4F, 0x4C,
-    0x57, 0x89, 0x60, 0x6B, 0xC1, 0x8E, 0x10, 0x8B, 0x4F, 0x2D, 0xAE, 0xE2, 0x59, 0xD3, 0xED, 0x39,
-    0x9E, 0x01, 0xF7, 0x4D, 0x5D, 0xA4, 0x7A, 0xFF, 0x0D, 0xFD, 0x5E, 0x15, 0x58, 0x61, 0x6A, 0xD0,
-    0x4E, 0x9B, 0x3D, 0x11, 0x60, 0x59, 0xCF, 0x00, 0x0C, 0xEE, 0x84, 0xAC, 0xF6, 0x43, 0x27, 0x5B,
-    0x4B, 0xDC, 0xAC, 0xC0, 0x6D, 0x2C, 0x2B, 0x54, 0xCC, 0xD2, 0x4A, 0xDB, 0xAC, 0xB0, 0xCD, 0xCA,
-    0xDA, 0xAC, 0x8E, 0xD0, 0x8A, 0x08, 0xAD, 0x82, 0xD0, 0xCA, 0x07, 0xAD, 0x76, 0xD0, 0x0A, 0x07,
-    0xAD, 0x6A, 0xD0, 0x4A, 0x06, 0xAD, 0x5E, 0xD0, 0x8A, 0x05, 0xAD, 0x52, 0xD0, 0xCA, 0x04, 0xAD,
-    0x46, 0xD0, 0x0A, 0x04, 0xAD, 0x3A, 0xD0, 0x4A, 0x03, 0xB5, 0x68, 0xCD, 0x4A, 0xD6, 0xAC, 0x60,
-    0x2D, 0x94, 0x03, 0x5E, 0xF8, 0x60, 0x92, 0xE8, 0x55, 0x76, 0x14, 0x6A, 0x11, 0xEA, 0x89, 0x4A,
-    0x2B, 0x4F, 0xFA, 0xC6, 0x5A, 0x49, 0xA6, 0x75, 0x64, 0x5A, 0x45, 0xA6, 0x35, 0x64, 0x5A, 0x41,
-    0xA6, 0xF5, 0x63, 0x5A, 0xED, 0xF5, 0x24, 0xAD, 0xD6, 0x89, 0x69, 0x95, 0x98, 0xD6, 0x88, 0x8D,
-    0x59, 0x9B, 0x50, 0xB9, 0x9A, 0xD7, 0x13, 0x8F, 0xDF, 0x2D, 0xA6, 0x11, 0x7E, 0xAA, 0x9B, 0x22,
-    0xFF, 0x67, 0x0A, 0x75, 0x47, 0x9F, 0x22, 0x3A, 0x8C, 0xD8, 0xED, 0x68, 0x77, 0x9D, 0x6E, 0x25,
-    0x7C, 0xB9, 0x09, 0x40, 0x90, 0x3C, 0x0A, 0xD7, 0x7E, 0xD5, 0xD0, 0x4B, 0x2D, 0x94, 0x3D, 0x54,
-    0x3F, 0xE1, 0xAE, 0xD6, 0x1A, 0xF7, 0xC4, 0xB5, 0xE3, 0x5E, 0xEB, 0x4F, 0xBB, 0xE8, 0x24, 0xA0,
-    0xDD, 0x3C, 0x12, 0xD0, 0x5E, 0x8C, 0x80, 0xF6, 0x92, 0x25, 0x6B, 0x53, 0x24, 0x7B, 0xFD, 0x35,
-    0x48, 0xB6, 0x69, 0xDE, 0x3E, 0x2C, 0xFB, 0xE6, 0x64, 0xC9, 0x7A, 0xB4, 0xD4, 0x8A, 0x5F, 0xC3,
-    0x52, 0x77, 0x5C, 0x6F, 0xCD, 0x75, 0xE8, 0xCF, 0xF9, 0x71, 0x37, 0xAE, 0xEC, 0x7B, 0x40, 0xB7,
-    0xCD, 0x74, 0x90, 0xAF, 0x63, 0x7D, 0x76, 0x08, 0x32, 0x8B, 0x72, 0x7C, 0xA4, 0xC5, 0x5E, 0x63,
-    0x2C, 0x56, 0xFE, 0xC9, 0xE3, 0xDD, 0xA2, 0x9B, 0x4E, 0x54, 0x64, 0x8C, 0xE5, 0x90, 0x69, 0x28,
-    0xDD, 0x36, 0x47, 0x76, 0x77, 0x8B, 0xBD, 0xBE, 0xD0, 0x38, 0xF8, 0x43, 0x15, 0x16, 0xF1, 0xA4,
-    0xC2, 0x22, 0x2B, 0x55, 0x05, 0x6B, 0xDD, 0xBE, 0x08, 0x37, 0xF6, 0xC3, 0xDF, 0xF2, 0x60, 0x0D,
-    0x13, 0x64, 0xA2, 0x21, 0x32, 0xE1, 0x81, 0x4C, 0xC4, 0xBF, 0x03, 0x32, 0x31, 0xFB, 0x35, 0x90,
-    0x89, 0xEC, 0x27, 0x40, 0x26, 0xE6, 0x44, 0x26, 0x76, 0x89, 0x4C, 0xDC, 0x20, 0x32, 0xD1, 0x03,
-    0x99, 0x88, 0x17, 0x40, 0x23, 0xF0, 0xBC, 0x97, 0x2F, 0xD3, 0x1A, 0x6D, 0x46, 0x64, 0x62, 0x97,
-    0xC8, 0xC4, 0x21, 0x91, 0x09, 0x68, 0xDA, 0xE2, 0x5F, 0x7B, 0x20, 0x13, 0xBF, 0x6A, 0x81, 0x4C,
-    0xFC, 0x57, 0x0D, 0x64, 0x82, 0xB6, 0x0B, 0xCA, 0x63, 0x44, 0x26, 0x3C, 0x90, 0x89, 0xE8, 0x7F,
-    0xB0, 0x43, 0x93, 0x0E, 0x09, 0xDA, 0xB8, 0x9C, 0xB8, 0x90, 0x74, 0x20, 0xB9, 0xC0, 0x4D, 0x70,
-    0x1D, 0x93, 0x76, 0xEB, 0x36, 0xC6, 0x12, 0xDB, 0xBC, 0x9D, 0x96, 0x22, 0xB2, 0x63, 0x20, 0x05,
-    0x9B, 0x11, 0x7E, 0xF0, 0x70, 0x97, 0x7C, 0x2D, 0x2E, 0xD4, 0x71, 0xDB, 0xB8, 0x0C, 0xF0, 0xC3,
-    0x35, 0xC0, 0x0F, 0x87, 0x40, 0x1E, 0x96, 0xD2, 0xC4, 0xE2, 0xF3, 0xF8, 0xA4, 0x95, 0x26, 0x2D,
-    0xB3, 0xAE, 0x99, 0x03, 0x7E, 0xD8, 0x01, 0xFC, 0xB0, 0x02, 0xFC, 0xD0, 0x07, 0xF8, 0x61, 0x46,
-    0x4C, 0xA3, 0x11, 0x33, 0x70, 0x0D, 0x7B, 0xE3, 0x35, 0x65, 0xFB, 0xDF, 0x7C, 0xA8, 0x82, 0x1C,
-    0xF4, 0x6C, 0x52, 0xAC, 0x49, 0x4F, 0x45, 0x13, 0xAD, 0x88, 0xEF, 0xB9, 0x43, 0xC5, 0xC5, 0xCF,
-    0xB9, 0xBD, 0xB3, 0x91, 0x1B, 0x7C, 0x17, 0x6B, 0x2E, 0xDA, 0x8D, 0xAD, 0x77, 0x86, 0xD5, 0xEA,
-    0x5A, 0xB9, 0xD2, 0xED, 0x3A, 0x9F, 0xB1, 0xBA, 0x8C, 0x95, 0x89, 0x73, 0xD5, 0x29, 0xC5, 0xB1,
-    0x32, 0x4A, 0x9D, 0xEC, 0x5E, 0x0B, 0xE7, 0x2E, 0x9D, 0x3C, 0xE7, 0x2F, 0x70, 0x7E, 0xF6, 0xC2,
-    0x03, 0x82, 0x37, 0x88, 0xE9, 0x8E, 0xE5, 0x8C, 0xAF, 0xF0, 0x1D, 0x80, 0x18, 0xA2, 0xFB, 0x2F,
-    0x7D, 0x1F, 0xEC, 0xBF, 0xF8, 0xFE, 0x55, 0x80, 0xA2, 0x4B, 0x30, 0x2A, 0x5E, 0xD3, 0xCD, 0xF8,
-    0x94, 0xC0, 0x7E, 0x41, 0x2E, 0xA7, 0xF5, 0x2E, 0x9F, 0x1B, 0x3A, 0x37, 0x79, 0x76, 0x92, 0xF1,
-    0x04, 0x5A, 0x19, 0x32, 0x52, 0x9F, 0x7E, 0x77, 0xD2, 0xBE, 0xC9, 0xF6, 0x95, 0x69, 0x64, 0xF0,
-    0xC8, 0x96, 0xDC, 0x54, 0xB3, 0xF6, 0x0D, 0x57, 0x86, 0x36, 0x2E, 0xF5, 0xB1, 0x20, 0x7D, 0x18,
-    0x48, 0x1F, 0x05, 0x8A, 0x98, 0xBE, 0xD0, 0xC7, 0x80, 0xF4, 0x21, 0xA0, 0x77, 0x61, 0x7B, 0x8B,
-    0x7F, 0xDA, 0x00, 0xEF, 0x62, 0xF2, 0x4D, 0x42, 0xA6, 0x68, 0x09, 0x34, 0xEE, 0x10, 0x5A, 0xF5,
-    0xDC, 0x68, 0x65, 0x69, 0x29, 0xA8, 0x8E, 0xFD, 0x2F, 0xD7, 0x30, 0x34, 0x03, 0xF8, 0x5C, 0xC1,
-    0x52, 0x17, 0xF5, 0x1C, 0xA0, 0x42, 0x8E, 0x40, 0x9A, 0xD1, 0xB4, 0x16, 0x90, 0xB0, 0x69, 0x83,
-    0xE7, 0x7C, 0x1A, 0x6C, 0xEB, 0x45, 0xA5, 0xC9, 0x2E, 0x98, 0x95, 0xF1, 0x00, 0x78, 0x8D, 0xD1,
-    0xC7, 0x9C, 0x78, 0xCC, 0xBE, 0x3E, 0x66, 0x4C, 0x1B, 0x4A, 0x04, 0xF4, 0x2B, 0xEC, 0xB9, 0x79,
-    0x89, 0x60, 0xF2, 0x4D, 0xB1, 0x13, 0xD4, 0xF1, 0x2F, 0x0E, 0x87, 0xF5, 0x71, 0x18, 0x02, 0xCB,
-    0xBE, 0x81, 0x49, 0x97, 0x63, 0x23, 0xA6, 0x64, 0x81, 0x4D, 0x1C, 0x98, 0xCB, 0xA7, 0xBF, 0x1B,
-    0x31, 0x37, 0xA2, 0xD3, 0xC5, 0x14, 0x2E, 0x84, 0xBD, 0x79, 0x2B, 0x4E, 0x6E, 0x81, 0xE4, 0x4A,
-    0xC5, 0xF0, 0x06, 0x91, 0x1B, 0xAB, 0x7E, 0x30, 0xA8, 0x35, 0xE3, 0x6C, 0xFC, 0xF8, 0x4C, 0x4E,
-    0x65, 0xC0, 0xE6, 0x39, 0xEC, 0xEE, 0x57, 0x64, 0x9F, 0xC3, 0x61, 0xA6, 0x83, 0xA8, 0x75, 0x3A,
-    0x22, 0x45, 0x88, 0xBC, 0xF8, 0xD9, 0x5A, 0x04, 0x7E, 0x4F, 0x1C, 0x85, 0xA2, 0x8C, 0x21, 0xEE,
-    0x23, 0x91, 0xF6, 0x4B, 0x3A, 0x1F, 0x04, 0xA1, 0x0C, 0x44, 0x11, 0x82, 0xE2, 0xBC, 0x3F, 0xED,
-    0x5F, 0x19, 0x37, 0x6A, 0xFC, 0xFB, 0x98, 0x16, 0xE7, 0x22, 0xBB, 0x0F, 0x9B, 0x6F, 0xD6, 0x4F,
-    0xE6, 0x72, 0x6E, 0xE2, 0xDE, 0x21, 0x30, 0x3F, 0xB0, 0xEF, 0xC6, 0x8F, 0xF9, 0x0B, 0xA8, 0x53,
-    0x14, 0x0B, 0xEA, 0x71, 0xA2, 0x7B, 0x72, 0xAC, 0x17, 0xF9, 0xF1, 0x72, 0xD7, 0x1D, 0xDD, 0x70,
-    0x3B, 0x97, 0x18, 0xB5, 0x3D, 0xF5, 0x67, 0x0E, 0x44, 0x4F, 0x67, 0xBE, 0x13, 0xFD, 0x7C, 0xE8,
-    0x56, 0x9F, 0xE0, 0x2E, 0x97, 0x9E, 0xC2, 0x03, 0x07, 0x1F, 0x5D, 0x80, 0x8F, 0xD0, 0x50, 0x17,
-    0x17, 0x7F, 0xBD, 0x26, 0x54, 0x7F, 0x8B, 0x0E, 0x50, 0x8E, 0x94, 0xC9, 0x92, 0xA6, 0xF8, 0xD2,
-    0x96, 0x75, 0x2F, 0xC8, 0x03, 0x07, 0xDF, 0x4D, 0x09, 0x3D, 0xBB, 0x07, 0x0E, 0xAE, 0xF0, 0x59,
-    0x50, 0xE2, 0x00, 0xCA, 0x84, 0xA4, 0x03, 0x87, 0x67, 0x35, 0x5C, 0xB2, 0xC8, 0xBD, 0x70, 0x7C,
-    0x56, 0x7B, 0x8A, 0xE8, 0xDC, 0x35, 0x80, 0x48, 0x90, 0x7A, 0x11, 0x45, 0xD4, 0x9F, 0xB0, 0xA7,
-    0xCF, 0x92, 0xC5, 0x57, 0xEB, 0x8F, 0x68, 0x10, 0x1A, 0x22, 0x2A, 0x05, 0xAB, 0x6A, 0x99, 0x7C,
-    0x3A, 0xA2, 0x55, 0xCD, 0xE9, 0xD6, 0x9C, 0xDF, 0xBA, 0x33, 0xA2, 0xE7, 0x3F, 0x50, 0x9D, 0x5F,
-    0x43, 0xDB, 0xCF, 0x97, 0x5B, 0xB4, 0xCB, 0xAA, 0x2B, 0xFF, 0xE0, 0x8F, 0x5A, 0x07, 0xBD, 0x1E,
-    0xFC, 0xF2, 0xB7, 0x89, 0x53, 0x11, 0xF8, 0xF3, 0x4C, 0x5E, 0xF9, 0xC8, 0x8F, 0x68, 0x92, 0x67,
-    0xA2, 0xC2, 0x33, 0xCF, 0xA0, 0xD9, 0x78, 0x4F, 0xE0, 0xDF, 0x33, 0xE1, 0x41, 0xAC, 0x8B, 0x15,
-    0x98, 0x1D, 0x30, 0xB4, 0x7C, 0x80, 0x05, 0xBB, 0xE0, 0xB9, 0x22, 0xB2, 0x27, 0xED, 0x59, 0xB4,
-    0x82, 0xE5, 0xAC, 0x51, 0x72, 0x70, 0x3D, 0xEA, 0xC7, 0xC7, 0x1E, 0x8C, 0xD1, 0xC5, 0x3A, 0xF3,
-    0xE5, 0x95, 0x4D, 0x21, 0x96, 0x67, 0xF8, 0x44, 0x44, 0xDA, 0x74, 0xF8, 0x47, 0x1E, 0xED, 0xAB,
-    0x66, 0xFE, 0xE8, 0x9C, 0x35, 0xEE, 0xBB, 0x36, 0x58, 0xD3, 0x15, 0xFF, 0x25, 0x8B, 0x5E, 0x46,
-    0x53, 0x3A, 0x9B, 0x9A, 0x52, 0xA7, 0xA6, 0xF4, 0xCF, 0x69, 0x4A, 0xCF, 0xBD, 0x38, 0xCC, 0xD5,
-    0x03, 0xD9, 0x10, 0x32, 0x94, 0x41, 0x92, 0x85, 0xB8, 0x9E, 0x49, 0x1B, 0x77, 0x27, 0xCE, 0xA2,
-    0x6C, 0x74, 0xDF, 0x17, 0x1B, 0x77, 0xB0, 0x94, 0xE5, 0x27, 0x5F, 0x76, 0xD4, 0xC9, 0xFC, 0xB7,
-    0x0A, 0x37, 0xD4, 0x79, 0xA6, 0xEF, 0xBA, 0xAD, 0xED, 0xFB, 0xB6, 0x0D, 0x97, 0x40, 0xB8, 0x54,
-    0xD7, 0xA4, 0xBE, 0x20, 0xB6, 0x6D, 0xCB, 0x4B, 0x14, 0xB2, 0xD8, 0x68, 0x9D, 0x47, 0xA1, 0xC0,
-    0x60, 0x56, 0x1F, 0x2A, 0xE6, 0x7F, 0xEE, 0x4C, 0xD5, 0x48, 0xC7, 0x1F, 0xA2, 0xD2, 0x5D, 0x96,
-    0x8C, 0xB5, 0xDE, 0x63, 0x9A, 0xFA, 0xA4, 0x35, 0x62, 0x01, 0x4C, 0x19, 0x3D, 0x5F, 0xF5, 0xEE,
-    0x11, 0xEB, 0xC4, 0x5C, 0xAA, 0xC8, 0xC9, 0xFC, 0x2B, 0x4A, 0xE8, 0xBA, 0x96, 0xB6, 0xEF, 0xC0,
-    0x4D, 0x84, 0xE9, 0x3C, 0x5B, 0x82, 0xB2, 0xFC, 0x65, 0xC4, 0x84, 0x46, 0x32, 0x78, 0x17, 0x9E,
-    0x21, 0x4B, 0x4B, 0x60, 0x5E, 0x91, 0x7B, 0xCE, 0x44, 0xA4, 0x91, 0xAD, 0x9C, 0x67, 0x7F, 0x8C,
-    0x58, 0x4E, 0xBE, 0x21, 0xA7, 0xAA, 0x2A, 0xE7, 0x2C, 0x3E, 0xAF, 0xC5, 0x1E, 0x88, 0x89, 0x78,
-    0x49, 0xA3, 0x08, 0x0D, 0x25, 0xFA, 0xF0, 0x8F, 0x08, 0xF8, 0x6C, 0x8A, 0xAE, 0x93, 0x41, 0x4A,
-    0xCC, 0x33, 0x9A, 0xFB, 0xF1, 0x69, 0xE9, 0x8A, 0x5F, 0xEA, 0xCE, 0xC1, 0x3C, 0x5D, 0x43, 0x53,
-    0x58, 0x33, 0x37, 0x1B, 0x85, 0x78, 0x31, 0x1D, 0xFE, 0x91, 0xB5, 0xC0, 0xEF, 0x4D, 0xFE, 0x21,
-    0x93, 0x8B, 0x3E, 0x1C, 0x55, 0x00, 0xE1, 0x98, 0x3E, 0x60, 0x32, 0x04, 0x12, 0x23, 0xD3, 0x39,
-    0x91, 0xB8, 0x09, 0xE9, 0x67, 0x55, 0x9B, 0xD7, 0x18, 0x75, 0x86, 0xDF, 0x16, 0xE0, 0x25, 0xF3,
-    0x6A, 0x2B, 0x6C, 0xBB, 0x4E, 0xE7, 0x87, 0x92, 0x8D, 0x08, 0x53, 0xC4, 0xE4, 0x67, 0xFD, 0x5F,
-    0xCA, 0xA8, 0xBB, 0x32, 0xE8, 0x2D, 0xA4, 0xA6, 0xF0, 0x18, 0xC1, 0x67, 0x4D, 0x3D, 0xC3, 0x75,
-    0x21, 0xFF, 0x72, 0xF1, 0x3D, 0xCC, 0x51, 0x61, 0xDD, 0xC2, 0xB0, 0xBC, 0x43, 0xC5, 0xF2, 0x0A,
-    0xE2, 0x80, 0xD6, 0x96, 0xF3, 0x6E, 0xD6, 0xEF, 0x8A, 0xED, 0x89, 0xFA, 0x1D, 0xC4, 0x58, 0xD6,
-    0xFE, 0x15, 0xDA, 0x8F, 0x43, 0xDE, 0xE2, 0x8F, 0xDD, 0xB2, 0x74, 0xED, 0xA2, 0x97, 0x28, 0x1E,
-    0x59, 0xC2, 0x53, 0x95, 0x42, 0xEE, 0x47, 0xF5, 0x36, 0x21, 0xAC, 0xC0, 0x6E, 0x31, 0x81, 0x27,
-    0x6F, 0x6C, 0x21, 0xCA, 0xD7, 0x2D, 0xA5, 0x72, 0xA8, 0xBB, 0x1F, 0xCC, 0xCF, 0x59, 0x8B, 0xE7,
-    0x59, 0x83, 0xFE, 0x58, 0xBF, 0x9B, 0x90, 0x74, 0xFF, 0xA2, 0x94, 0xC1, 0xCA, 0xB1, 0xBC, 0x04,
-    0xB0, 0x1B, 0x74, 0x37, 0x0C, 0x35, 0x9E, 0xB7, 0xCB, 0xED, 0xDE, 0xA3, 0xA1, 0x86, 0x33, 0x94,
-    0xFA, 0x3B, 0x03, 0xCE, 0x52, 0x53, 0xA3, 0xA8, 0x83, 0xFE, 0xCD, 0x82, 0xFF, 0x32, 0xEB, 0xBA,
-    0x81, 0xEE, 0xC4, 0x02, 0xC8, 0x03, 0x9A, 0x83, 0xC6, 0x8A, 0x58, 0x22, 0xB8, 0x59, 0x07, 0x60,
-    0xC4, 0xAD, 0xB7, 0x86, 0xD1, 0x18, 0xE7, 0x5D, 0xC0, 0xEA, 0x59, 0x0E, 0xC8, 0x26, 0x1D, 0x29,
-    0x7E, 0xC0, 0x9D, 0x8D, 0xDA, 0x0B, 0x62, 0xA5, 0xAC, 0xB0, 0x40, 0xB2, 0x8D, 0x65, 0x37, 0x57,
-    0x64, 0xF6, 0x17, 0x90, 0x31, 0x2E, 0xE0, 0xCE, 0xFD, 0x58, 0xB3, 0x75, 0x7B, 0x08, 0xF3, 0xCA,
-    0xEC, 0xF7, 0x07, 0x1D, 0xFE, 0xD3, 0x47, 0x21, 0x11, 0xBA, 0xFC, 0xAE, 0x5F, 0xDD, 0x06, 0x40,
-    0x2B, 0x05, 0x5F, 0xF2, 0x8E, 0x07, 0xF1, 0x40, 0xD8, 0x31, 0x1C, 0x74, 0xAE, 0x44, 0x9A, 0x82,
-    0x9B, 0x7B, 0x70, 0x63, 0x11, 0x41, 0xA8, 0x48, 0x88, 0x2C, 0x00, 0xC4, 0xDC, 0xA0, 0x48, 0x64,
-    0xE7, 0x5E, 0x81, 0x1D, 0xEE, 0xF8, 0x80, 0xF3, 0x8F, 0xED, 0x59, 0x80, 0x97, 0x55, 0x84, 0x7C,
-    0x62, 0x88, 0xF5, 0xA1, 0xA8, 0x10, 0xED, 0x14, 0x03, 0xAF, 0x35, 0xA0, 0x7C, 0xE4, 0x3F, 0x96,
-    0x1A, 0xB3, 0xAD, 0x6B, 0x4B, 0xBA, 0x86, 0x8C, 0xEB, 0x36, 0x33, 0xF8, 0x78, 0x1D, 0x83, 0xE3,
-    0xB1, 0x7B, 0xC2, 0xC1, 0x9C, 0x45, 0x75, 0x90, 0x01, 0xAC, 0xBF, 0x46, 0x77, 0xC4, 0x2B, 0xBE,
-    0xF5, 0xE3, 0xDF, 0xDF, 0xBD, 0xC6, 0x92, 0x5E, 0xF8, 0x40, 0x90, 0x6F, 0xA8, 0xA0, 0xD0, 0x87,
-    0x05, 0x0B, 0x74, 0xDA, 0x78, 0x73, 0x52, 0xB3, 0x3E, 0xB1, 0x62, 0xD6, 0xE4, 0x6B, 0x8E, 0xD0,
-    0xF8, 0x3E, 0x52, 0xE0, 0x7E, 0xFD, 0x7F, 0xAD, 0x56, 0x4D, 0x6C, 0x24, 0x47, 0x15, 0xFE, 0xAA,
-    0xDB, 0x9E, 0xCE, 0xA6, 0x95, 0x69, 0x1F, 0xC6, 0x60, 0x36, 0x6B, 0x37, 0x07, 0x1F, 0x4C, 0x94,
-    0xD9, 0xBE, 0xE4, 0xE0, 0x48, 0xE3, 0xE9, 0x72, 0x22, 0xE0, 0x80, 0x10, 0x3E, 0x78, 0x84, 0x04,
-    0x12, 0xF8, 0x90, 0x03, 0xB1, 0x12, 0xB2, 0x48, 0x3E, 0x4C, 0xA4, 0xB1, 0xA7, 0x93, 0x03, 0x48,
-    0xE4, 0x32, 0x0A, 0x12, 0x5C, 0x7D, 0x48, 0x00, 0xCF, 0x82, 0x76, 0x0E, 0x20, 0xE5, 0x60, 0x76,
-    0x5A, 0x41, 0x88, 0x0B, 0x87, 0x16, 0x42, 0xE2, 0xDA, 0x42, 0x41, 0x20, 0x71, 0x29, 0xA4, 0x5E,
-    0x69, 0x70, 0x7A, 0xA6, 0xF8, 0x5E, 0xCF, 0x4C, 0x36, 0xDE, 0x65, 0xE1, 0x42, 0xD5, 0xAB, 0xAE,
-    0xA9, 0xAA, 0x57, 0x3F, 0xEF, 0xBD, 0xEF, 0xBD, 0x37, 0xCF, 0x25, 0x08, 0x73, 0xF8, 0x06, 0xCE,
-    0x04, 0x38, 0x05, 0x42, 0x40, 0x01, 0x43, 0x67, 0xEA, 0x16, 0x41, 0x16, 0xEA, 0x16, 0xD6, 0x38,
-    0x82, 0xB2, 0x89, 0x6B, 0x33, 0xFF, 0x6F, 0x26, 0xDC, 0x9F, 0xEC, 0x61, 0x6F, 0x0D, 0x2B, 0x6A,
-    0x40, 0xDE, 0x29, 0xF2, 0xD8, 0xFE, 0x31, 0xEB, 0x86, 0x36, 0xBD, 0xE3, 0x58, 0x80, 0xCC, 0xEB,
-    0x9D, 0xC3, 0xBE, 0x9D, 0x92, 0x8E, 0x87, 0xC3, 0x8B, 0xB1, 0xB5, 0x33, 0xE9, 0x77, 0xF1, 0x7C,
-    0x0B, 0xAD, 0xE8, 0xC7, 0x93, 0xC0, 0x1A, 0xD7, 0xA6, 0x68, 0x60, 0x15, 0x71, 0x2A, 0x35, 0x4A,
-    0x80, 0xDB, 0xF8, 0xA0, 0xBF, 0x3F, 0x25, 0xC5, 0x28, 0x57, 0xB0, 0x56, 0xFB, 0x39, 0x62, 0xAB,
-    0x5F, 0x0C, 0xD3, 0x35, 0x3F, 0x45, 0x90, 0xAA, 0x31, 0x9C, 0x02, 0x4E, 0x0E, 0x95, 0x41, 0xBD,
-    0x87, 0xC0, 0xA2, 0xFD, 0xCD, 0xB4, 0xE7, 0x66, 0x5D, 0x47, 0xA8, 0xED, 0xA7, 0xA1, 0xD5, 0x9C,
-    0x57, 0x17, 0x4F, 0xBF, 0xE7, 0x96, 0x81, 0xF1, 0x4D, 0x9C, 0x06, 0x59, 0x1F, 0x91, 0x2E, 0x71,
-    0xEA, 0x18, 0xBE, 0x48, 0xE3, 0x15, 0x7C, 0xAE, 0x8D, 0xCB, 0xE0, 0xC3, 0xC2, 0xFB, 0x38, 0x77,
-    0x78, 0xBD, 0xD5, 0x58, 0xC7, 0x4E, 0x4B, 0xCA, 0xCE, 0xD1, 0x8D, 0x22, 0x5C, 0xD6, 0xA3, 0x1B,
-    0xC7, 0x2F, 0xF1, 0xF2, 0x74, 0x0A, 0x39, 0xC1, 0x33, 0x51, 0xA2, 0x26, 0x7C, 0x43, 0x8F, 0xC7,
-    0xAC, 0xE0, 0x80, 0xE2, 0xE1, 0x3E, 0x60, 0x85, 0x1A, 0xA7, 0x0D, 0x0A, 0xC4, 0x43, 0x43, 0x5B,
-    0xF8, 0x36, 0xC7, 0xAB, 0x50, 0xF7, 0x35, 0x7F, 0x44, 0x76, 0xC2, 0x49, 0x2E, 0x51, 0x43, 0x78,
-    0x0A, 0x97, 0x6E, 0x16, 0x60, 0x0B, 0x6D, 0xC4, 0x49, 0x6C, 0x62, 0x13, 0x19, 0x2F, 0x71, 0x06,
-    0xC1, 0x24, 0x28, 0x83, 0xD2, 0x29, 0x71, 0x89, 0x5F, 0xC1, 0x78, 0x69, 0x8C, 0x6D, 0xD4, 0x92,
-    0xC8, 0x08, 0x47, 0x9C, 0xB4, 0xC9, 0x1F, 0xC0, 0xCD, 0x50, 0x62, 0xE3, 0x3F, 0xF3, 0x1E, 0x6B,
-    0x4A, 0x98, 0xBB, 0x86, 0x1C, 0x4D, 0xDA, 0xE1, 0xC2, 0x2D, 0x7D, 0x13, 0xA4, 0x11, 0xBA, 0x62,
-    0xAA, 0x01, 0x4C, 0xC7, 0x58, 0x33, 0x34, 0x60, 0x3D, 0xE2, 0xE7, 0x81, 0xB6, 0xE6, 0xEA, 0x5C,
-    0x86, 0xC7, 0xC3, 0x64, 0x6C, 0xB3, 0xCE, 0xD7, 0x33, 0x38, 0x8F, 0x11, 0xE0, 0xE6, 0x41, 0x11,
-    0x4C, 0xDC, 0x42, 0x19, 0x87, 0xF7, 0x9C, 0x55, 0xE2, 0x7A, 0x59, 0x94, 0xEE, 0x81, 0xD2, 0x60,
-    0x0F, 0x61, 0x2A, 0x6C, 0x6E, 0x2A, 0xF5, 0xB3, 0x7F, 0x1A, 0xCF, 0x8E, 0x2F, 0x80, 0xF1, 0x6C,
-    0x3C, 0x9B, 0xCF, 0x38, 0x89, 0x93, 0x48, 0xBF, 0x9C, 0x71, 0x92, 0x4E, 0xC7, 0xDA, 0xE1, 0x10,
-    0x3B, 0xD5, 0x76, 0xA9, 0xBD, 0x9F, 0x4E, 0xC6, 0x45, 0x3F, 0x5F, 0xC5, 0x39, 0xCC, 0xA2, 0x16,
-    0xB8, 0xFF, 0x9D, 0xFE, 0x24, 0x2A, 0x94, 0xDE, 0xA2, 0xD6, 0xFB, 0x84, 0xC3, 0xD6, 0xA3, 0x60,
-    0x50, 0x87, 0x62, 0xF1, 0xF8, 0xDB, 0x69, 0xCB, 0x15, 0xDA, 0xF3, 0xC4, 0xDC, 0xDE, 0x14, 0x37,
-    0x93, 0x28, 0x8D, 0x74, 0xCC, 0x87, 0x89, 0xD8, 0x0A, 0x9E, 0xF6, 0x73, 0xBF, 0xA4, 0x7D, 0x62,
-    0xD6, 0x99, 0x2D, 0xC7, 0x39, 0x15, 0xE6, 0x11, 0x3F, 0x9A, 0xE3, 0x8A, 0x34, 0xA2, 0xBF, 0x26,
-    0x81, 0x4D, 0x1D, 0x9B, 0xCC, 0x4D, 0xDF, 0x58, 0xEF, 0x74, 0xB4, 0xB5, 0xD6, 0x48, 0x9B, 0xD2,
-    0xDC, 0x05, 0x94, 0x31, 0x80, 0xA1, 0xE8, 0x07, 0x83, 0xED, 0x5A, 0xBE, 0xEB, 0x9B, 0xCB, 0x3A,
-    0x91, 0x1C, 0xBE, 0x5D, 0xBC, 0x82, 0x4D, 0x41, 0xD0, 0x6F, 0x8D, 0x67, 0x33, 0x01, 0x30, 0x41,
-    0xD0, 0x10, 0x34, 0x28, 0xAB, 0x39, 0x0C, 0xFE, 0x6C, 0xA2, 0xFD, 0x49, 0x8F, 0x8F, 0xC1, 0x0A,
-    0x0D, 0x7F, 0x0D, 0x19, 0x43, 0xA0, 0x03, 0xEE, 0xE2, 0x30, 0xDE, 0x2F, 0xB9, 0xB4, 0x8D, 0x8D,
-    0xDA, 0x47, 0x38, 0x88, 0x66, 0x2A, 0x6F, 0x8F, 0xFF, 0x91, 0x9E, 0x04, 0x36, 0x39, 0x52, 0x33,
-    0x01, 0xD7, 0xDC, 0x6F, 0x30, 0x2F, 0x76, 0x51, 0xE4, 0x77, 0xA7, 0x23, 0xDA, 0xB4, 0x56, 0xDC,
-    0x09, 0x8F, 0xAC, 0x53, 0x88, 0xC3, 0x6B, 0xBE, 0x18, 0xD9, 0x74, 0xB4, 0xF0, 0x45, 0xBA, 0xDE,
-    0x80, 0x7B, 0x72, 0xE9, 0xD9, 0xE6, 0x0E, 0x39, 0x77, 0x49, 0xFE, 0xAE, 0x1C, 0x9D, 0x76, 0xA5,
-    0x1D, 0x13, 0xF8, 0xF4, 0xFE, 0x3E, 0xA1, 0xC0, 0xEB, 0xA3, 0xBC, 0xD2, 0x16, 0x01, 0x5C, 0x95,
-    0x23, 0x36, 0x2E, 0xD2, 0x5C, 0xA0, 0x1F, 0x08, 0x32, 0x45, 0xAF, 0x08, 0xE8, 0xB8, 0x01, 0xA7,
-    0x23, 0x36, 0xCA, 0x8D, 0xDE, 0xFF, 0x9D, 0x6D, 0xA7, 0xBA, 0xFE, 0x94, 0xBE, 0xE3, 0x55, 0x18,
-    0x23, 0xFA, 0x75, 0x85, 0x71, 0x2D, 0x46, 0x12, 0x63, 0x95, 0x70, 0xCD, 0xD2, 0x80, 0x54, 0xD1,
-    0xC1, 0xD2, 0xA0, 0x0F, 0x3A, 0x9D, 0xCA, 0x90, 0xCB, 0x26, 0x73, 0x94, 0xF8, 0xBC, 0xB6, 0x7F,
-    0x1E, 0x7F, 0x3C, 0xFD, 0xF5, 0xD9, 0xB7, 0xF2, 0x96, 0x9F, 0x3F, 0xEF, 0x03, 0xBB, 0xB7, 0xDA,
-    0xA7, 0x61, 0xE1, 0xE7, 0xE1, 0xE4, 0xF4, 0x74, 0x7B, 0x43, 0x25, 0x21, 0xE1, 0x2E, 0x66, 0x8C,
-    0x19, 0x77, 0xBC, 0xCC, 0xCD, 0x7C, 0x5E, 0xD9, 0x78, 0xCC, 0x1C, 0x52, 0x44, 0x83, 0x32, 0x96,
-    0xE8, 0x36, 0x14, 0x87, 0xCC, 0xE8, 0x90, 0x13, 0x6E, 0x5D, 0x51, 0x43, 0xB7, 0xF4, 0x2A, 0x87,
-    0xEC, 0x09, 0x32, 0x9F, 0x60, 0x9A, 0xDB, 0xE8, 0x27, 0xDC, 0x95, 0xFA, 0x49, 0x40, 0x04, 0x2F,
-    0x8A, 0x5B, 0x50, 0x1B, 0x13, 0xDC, 0x26, 0x14, 0xE3, 0x2F, 0xFF, 0xA5, 0x8C, 0xDF, 0xF9, 0xB0,
-    0x8C, 0xFD, 0xB7, 0xCA, 0x15, 0x5F, 0xA4, 0x06, 0x63, 0x56, 0x7F, 0x5E, 0xCF, 0x63, 0x53, 0xD3,
-    0xFF, 0x0D, 0xBD, 0xFF, 0x0B, 0x30, 0xD7, 0x83, 0x1E, 0xD7, 0x18, 0x32, 0x16, 0x3E, 0x79, 0x0E,
-    0x95, 0x40, 0xFD, 0x28, 0x43, 0x68, 0x93, 0x87, 0xAF, 0x8E, 0xF9, 0xEA, 0xEE, 0x1A, 0xAA, 0x77,
-    0xAC, 0x8A, 0x9D, 0x92, 0x79, 0x0B, 0x75, 0x75, 0x76, 0xF0, 0x2F, 0x91, 0xF0, 0xDD, 0xEC, 0xCD,
-    0x3E, 0x79, 0xBD, 0x85, 0x92, 0x64, 0x6D, 0xC9, 0xC7, 0x3D, 0x4F, 0xD2, 0xC4, 0x93, 0xE6, 0x45,
-    0x1F, 0x48, 0x83, 0xA1, 0x89, 0x6D, 0xC9, 0xB0, 0xEA, 0x23, 0x77, 0x90, 0x54, 0x07, 0x3B, 0x49,
-    0x60, 0xE2, 0xD2, 0xCB, 0x96, 0xB5, 0x5F, 0xD0, 0x07, 0xC3, 0xE9, 0xA2, 0x7B, 0xF3, 0x80, 0x0E,
-    0xB7, 0xFA, 0xFA, 0x5C, 0xA9, 0xCD, 0x6E, 0xE5, 0xA8, 0xEC, 0xEA, 0xAD, 0x11, 0xC3, 0x25, 0xEA,
-    0x8D, 0x91, 0x1C, 0x9C, 0x0A, 0xF1, 0x20, 0x21, 0xC6, 0x69, 0x30, 0xAC, 0xAE, 0x6D, 0xB2, 0xEB,
-    0xAE, 0x74, 0x05, 0xF6, 0x6B, 0x4D, 0x11, 0x16, 0x2B, 0xCD, 0x6E, 0x4B, 0x0E, 0x69, 0x76, 0xB7,
-    0xD9, 0x6D, 0x34, 0x17, 0x67, 0x6E, 0x57, 0x9C, 0x1B, 0x90, 0xEE, 0x05, 0x0A, 0xA6, 0x85, 0x96,
-    0x67, 0xAA, 0xAF, 0xE2, 0x7B, 0x1A, 0x8B, 0xFB, 0xBA, 0x15, 0x8A, 0x9B, 0x0F, 0xDF, 0x22, 0xDD,
-    0xF5, 0xE7, 0x8A, 0x83, 0x9D, 0x21, 0x2C, 0xD4, 0xD4, 0x9B, 0x46, 0x59, 0x97, 0x71, 0x57, 0x25,
-    0x04, 0x8F, 0x9E, 0x07, 0xCD, 0x28, 0x61, 0xFE, 0x01, 0xD3, 0xCB, 0x3C, 0x82, 0xCC, 0x73, 0xCB,
-    0xF6, 0xE9, 0xC6, 0x3C, 0x0B, 0x49, 0x3A, 0x92, 0xB2, 0x7B, 0xEB, 0xEC, 0x37, 0x02, 0xE3, 0xA8,
-    0x82, 0x31, 0x27, 0x6E, 0x80, 0xE3, 0xBE, 0xEE, 0x67, 0x44, 0x53, 0x53, 0x94, 0xFF, 0xE8, 0x1D,
-    0x52, 0xBA, 0x20, 0xBC, 0x33, 0x02, 0x7D, 0x1A, 0x66, 0xCE, 0x34, 0x32, 0xE1, 0xA4, 0x65, 0xCE,
-    0xF0, 0x41, 0x97, 0x59, 0x83, 0x41, 0x2A, 0x46, 0x98, 0xCC, 0xBD, 0x2E, 0x62, 0x4E, 0x12, 0x2D,
-    0x8E, 0x99, 0x37, 0xAD, 0xEE, 0xA3, 0xF2, 0xDE, 0xCF, 0x9B, 0x64, 0xEF, 0x67, 0xE9, 0xB3, 0x33,
-    0x7D, 0xF3, 0x4A, 0x9F, 0xDD, 0xCD, 0xB6, 0xFF, 0x99, 0x70, 0x52, 0x1D, 0x1C, 0x22, 0xBC, 0xB2,
-    0x7A, 0xEF, 0x8D, 0x9F, 0xA4, 0xDD, 0x80, 0xF9, 0x99, 0xAD, 0x17, 0xBE, 0x9C, 0xC5, 0xD6, 0xA6,
-    0xBE, 0x99, 0x31, 0xA2, 0x34, 0x29, 0x53, 0x3C, 0xED, 0x97, 0xEC, 0xBA, 0x55, 0x64, 0xA9, 0x4A,
-    0x6B, 0x8E, 0xFE, 0x34, 0x98, 0x83, 0x89, 0x79, 0x67, 0xEE, 0xF9, 0x55, 0x58, 0xE4, 0x5F, 0x13,
-    0x44, 0xB3, 0xF7, 0xEF, 0x5A, 0x5A, 0xCA, 0x21, 0x7E, 0x25, 0x7A, 0xA0, 0x76, 0xEF, 0x02, 0x0F,
-    0xCB, 0x63, 0xFB, 0x73, 0xE9, 0x2F, 0x81, 0x19, 0xED, 0xF2, 0xAC, 0xEC, 0xB7, 0xC3, 0x7B, 0xD7,
-    0xF6, 0xAF, 0x0E, 0xDF, 0xE7, 0x37, 0x16, 0x7F, 0x28, 0xE7, 0xDF, 0x75, 0xF1, 0x99, 0xC3, 0xC7,
-    0x67, 0x3E, 0xB9, 0x64, 0x3C, 0x23, 0x50, 0x9D, 0xD4, 0xE3, 0xD2, 0x80, 0x9A, 0x0B, 0x07, 0x9F,
-    0x61, 0x82, 0x1B, 0xCB, 0xDD, 0x35, 0x32, 0x0B, 0x10, 0x50, 0x1B, 0x92, 0x05, 0x37, 0xED, 0x95,
-    0x78, 0x85, 0x30, 0x4A, 0x30, 0x8F, 0xAF, 0x3A, 0xDF, 0x60, 0xC6, 0x50, 0xF2, 0xDB, 0x2B, 0xAA,
-    0x68, 0x27, 0x31, 0x6E, 0xAB, 0x3A, 0xD4, 0xD7, 0x3B, 0x0B, 0x48, 0x3F, 0x94, 0x46, 0xA5, 0xCF,
-    0x49, 0x74, 0x31, 0xD5, 0x2B, 0x26, 0xD5, 0xB7, 0xA8, 0xE6, 0x2B, 0xAD, 0x28, 0xBD, 0xE0, 0x3A,
-    0x40, 0xB3, 0x87, 0x9D, 0x5B, 0x20, 0x0C, 0x6F, 0xFE, 0x12, 0x27, 0x9B, 0x18, 0x6D, 0xE2, 0xE4,
-    0x75, 0x84, 0x3F, 0xD4, 0x5C, 0xAA, 0xBF, 0x86, 0x56, 0x1D, 0xBB, 0x3E, 0x45, 0x94, 0x97, 0xED,
-    0x92, 0xAB, 0x26, 0xA1, 0xE5, 0x29, 0xF1, 0x01, 0xDA, 0xB2, 0x87, 0x5B, 0x9F, 0xD4, 0x4D, 0xC6,
-    0x7F, 0x6E, 0xD9, 0x7A, 0x0D, 0x2F, 0xF8, 0xB8, 0xE3, 0x61, 0xE4, 0x69, 0xD2, 0x89, 0x2F, 0x27,
-    0xF8, 0x05, 0x1A, 0xAB, 0xBA, 0xE9, 0xA5, 0xCF, 0x38, 0x9F, 0x22, 0x6A, 0xDA, 0x4B, 0x9D, 0x07,
-    0xB9, 0xD2, 0xCD, 0xEE, 0x9D, 0x9D, 0x51, 0x15, 0x37, 0x46, 0xD8, 0xDD, 0xF0, 0x73, 0x7C, 0xA1,
-    0x8A, 0xE3, 0x01, 0x56, 0xBF, 0x86, 0xF6, 0x18, 0xA3, 0x10, 0x26, 0x58, 0xD0, 0x88, 0x81, 0x2E,
-    0x42, 0xF8, 0xFB, 0xE4, 0x55, 0x79, 0x32, 0x9E, 0x21, 0x35, 0x50, 0xBF, 0xA7, 0x03, 0xF7, 0xDA,
-    0xE1, 0x5B, 0x4E, 0xFA, 0xC6, 0xDB, 0x79, 0x63, 0x5D, 0xE9, 0xF0, 0xEE, 0xD0, 0xF8, 0xFB, 0xF9,
-    0x89, 0xAF, 0xB2, 0xDD, 0x47, 0x5B, 0x34, 0xF8, 0xA8, 0xDD, 0x68, 0x60, 0xEB, 0x1E, 0xFC, 0x2F,
-    0x81, 0x81, 0xFC, 0xD3, 0x14, 0x9D, 0x8B, 0x29, 0x50, 0xD7, 0xD1, 0xA0, 0x8E, 0x65, 0x15, 0x50,
-    0xAC, 0xAB, 0x83, 0xE8, 0xA5, 0xBC, 0xAE, 0x52, 0xDF, 0xD1, 0xEE, 0xCB, 0x70, 0x7F, 0x07, 0xF5,
-    0x87, 0x2A, 0x1B, 0xDD, 0xC1, 0xFA, 0x17, 0x75, 0xF8, 0x83, 0x81, 0xFB, 0x7D, 0xA8, 0xBF, 0x83,
-    0x7F, 0x1C, 0xF0, 0x0B, 0xB8, 0x01, 0x9E, 0x76, 0x93, 0xEF, 0x7E, 0x25, 0xFF, 0x37, 0xED, 0x7D,
-    0x3D, 0x90, 0xE5, 0xD6, 0x75, 0x26, 0x7E, 0x66, 0x06, 0x2A, 0xA2, 0x2C, 0x30, 0x20, 0x5D, 0x5A,
-    0x8D, 0x45, 0x28, 0x50, 0xA0, 0xE2, 0x4F, 0x63, 0x83, 0x0D, 0x18, 0x74, 0x0F, 0x40, 0xBB, 0xCA,
-    0xA9, 0x27, 0x60, 0x8B, 0x55, 0x66, 0x30, 0x4E, 0x36, 0xB0, 0x36, 0xE8, 0xC4, 0x01, 0x83, 0x1E,
-    0x02, 0x96, 0x03, 0x05, 0x0E, 0xDC, 0xC1, 0x52, 0x0E, 0x1C, 0x98, 0x5B, 0xC5, 0xAD, 0xB2, 0x9A,
-    0x55, 0x3B, 0x0C, 0x18, 0x4C, 0x30, 0x24, 0x20, 0x3B, 0x50, 0xE0, 0xC0, 0x90, 0x57, 0x72, 0xE2,
-    0xAA, 0x15, 0xB4, 0x35, 0x74, 0x51, 0x64, 0x6D, 0x11, 0x6B, 0x81, 0xCB, 0x37, 0xA3, 0xF7, 0x70,
-    0xF7, 0x7C, 0xDF, 0xB9, 0x17, 0x0F, 0xEF, 0x75, 0xCF, 0x1F, 0x39, 0x33, 0x9C, 0x91, 0xDD, 0x33,
-    0x7D, 0xCE, 0xED, 0x6E, 0x3C, 0xE0, 0xE2, 0xDE, 0x73, 0xCF, 0x3D, 0xFF, 0xD7, 0x4B, 0x3B, 0x4F,
-    0xBE, 0x92, 0x1E, 0x30, 0x5C, 0x00, 0x7A, 0x2B, 0xC2, 0x8C, 0x30, 0xAE, 0xBC, 0x8D, 0xAF, 0xD2,
-    0x18, 0xB3, 0xB2, 0x30, 0x30, 0xFB, 0xFB, 0x72, 0xAD, 0xF1, 0xBC, 0x0B, 0x84, 0x3B, 0x33, 0xF8,
-    0x0C, 0xA1, 0x77, 0x1B, 0x68, 0x4C, 0x33, 0xC1, 0xDB, 0x5F, 0xE9, 0x60, 0x50, 0x01, 0x46, 0x0D,
-    0x60, 0x4C, 0x98, 0x54, 0xBE, 0xC0, 0xB2, 0x3A, 0x90, 0xFB, 0x98, 0xAA, 0x26, 0xB4, 0x1D, 0x4D,
-    0xAB, 0xAC, 0xF0, 0xBC, 0xBC, 0xC9, 0x2B, 0x07, 0xF5, 0x37, 0x27, 0xBE, 0x1E, 0xFD, 0x37, 0xCA,
-    0x00, 0x65, 0x82, 0x72, 0xE0, 0x41, 0xF0, 0x1B, 0x07, 0x3F, 0x7B, 0x65, 0x40, 0x1F, 0xB3, 0xC6,
-    0x17, 0xBC, 0x2B, 0xD8, 0x73, 0xF8, 0xDD, 0x35, 0x7E, 0x0A, 0xF8, 0x49, 0xCE, 0x65, 0xA3, 0xEF,
-    0x7A, 0x02, 0xFF, 0xA8, 0xBE, 0x41, 0xFC, 0x89, 0x31, 0x2D, 0xB0, 0x79, 0xA3, 0x1E, 0x80, 0x3B,
-    0x2F, 0x5E, 0xEA, 0x75, 0xE1, 0xA8, 0x18, 0xDD, 0xE2, 0xE7, 0xEE, 0x12, 0xFB, 0xF6, 0x73, 0x21,
-    0xEE, 0x93, 0x77, 0x5E, 0x22, 0xF7, 0xFD, 0xBA, 0x19, 0xFF, 0x14, 0xCF, 0x91, 0x17, 0xFA, 0x11,
-    0x9F, 0xEB, 0x1D, 0xCB, 0x77, 0x00, 0x7A, 0x0B, 0xF1, 0xD8, 0x04, 0x7D, 0x48, 0x31, 0x49, 0xBB,
-    0xF8, 0xE3, 0x93, 0xB3, 0x19, 0x5A, 0x12, 0xC8, 0xFC, 0x7C, 0x67, 0x89, 0x27, 0x5C, 0x03, 0xD8,
-    0xDD, 0x04, 0x67, 0x74, 0x5C, 0xEF, 0x1F, 0xF0, 0x8D, 0x74, 0xE5, 0xC0, 0x7C, 0xE4, 0x79, 0x32,
-    0x0F, 0x8E, 0x5C, 0xFC, 0x5A, 0x48, 0x2C, 0xC5, 0x3C, 0xD4, 0x55, 0xBC, 0x92, 0xBE, 0x07, 0x63,
-    0x24, 0x7D, 0x1F, 0x13, 0x59, 0x47, 0xD7, 0xF0, 0xFE, 0x7F, 0x94, 0x63, 0x70, 0x4B, 0xD0, 0x61,
-    0x5D, 0x38, 0x60, 0x08, 0x8E, 0x8F, 0xDF, 0x02, 0x7D, 0x2C, 0x3C, 0xF3, 0xC6, 0xFE, 0xCB, 0xF6,
-    0x77, 0xBC, 0xA4, 0x72, 0x9F, 0xE0, 0x67, 0x73, 0x0E, 0x03, 0x56, 0x64, 0x22, 0x0B, 0xF2, 0xB7,
-    0x30, 0x03, 0x7B, 0x9E, 0x69, 0xCF, 0x2D, 0x41, 0x01, 0x83, 0x17, 0x91, 0xC8, 0xCF, 0x5E, 0x74,
-    0x84, 0x2E, 0x23, 0xEA, 0x83, 0x78, 0x23, 0xB9, 0xAF, 0x27, 0xDD, 0xC8, 0xAB, 0xB4, 0xF1, 0xB2,
-    0x4A, 0xFA, 0x92, 0x16, 0x02, 0xCE, 0xE8, 0x6C, 0x67, 0xBC, 0x29, 0x47, 0x19, 0x33, 0x13, 0x9A,
-    0x8E, 0x24, 0x5B, 0xE0, 0x06, 0x3D, 0xDE, 0x75, 0xC5, 0x7B, 0x15, 0x68, 0xAE, 0x3B, 0x81, 0x8B,
-    0x92, 0x6E, 0x07, 0x20, 0x77, 0xA0, 0x95, 0xC5, 0x94, 0x35, 0xF2, 0xA7, 0xBA, 0x88, 0xC7, 0xB7,
-    0x57, 0x18, 0x11, 0xB9, 0xCC, 0x7F, 0x19, 0x13, 0xB5, 0x92, 0xFF, 0x81, 0x21, 0x55, 0x7F, 0x81,
-    0xFF, 0x32, 0xF0, 0x07, 0x66, 0x51, 0xB3, 0x4B, 0xB9, 0xB7, 0x2C, 0x5F, 0x5A, 0xC9, 0x7F, 0x69,
-    0xCC, 0xD6, 0xEC, 0x7D, 0x7E, 0x90, 0x8C, 0x69, 0x8B, 0x6F, 0x2F, 0x5B, 0x28, 0x33, 0x7C, 0x28,
-    0xDF, 0x9D, 0x92, 0x3C, 0xE6, 0x47, 0xC6, 0x94, 0x0B, 0x5F, 0xDE, 0xB1, 0x3C, 0xF2, 0x48, 0x71,
-    0x64, 0x24, 0xDA, 0xC0, 0x5C, 0x84, 0x9F, 0xEE, 0x5F, 0x1A, 0x48, 0x81, 0xBD, 0x65, 0xD7, 0xDE,
-    0xAD, 0x1B, 0xFE, 0xED, 0x1B, 0x9F, 0x82, 0x78, 0x02, 0x59, 0x94, 0xC6, 0x5C, 0xD7, 0xC6, 0xCD,
-    0x7A, 0xD4, 0x46, 0xEF, 0xD5, 0xB2, 0x68, 0x5B, 0x34, 0x84, 0x0B, 0x68, 0x43, 0xFE, 0x6B, 0x23,
-    0x1E, 0xC0, 0xAC, 0xA4, 0x21, 0xB4, 0x16, 0xBB, 0x46, 0x32, 0x35, 0x2A, 0x5E, 0xB3, 0xF0, 0x84,
-    0xCF, 0xEA, 0xC5, 0xA5, 0xA7, 0x1F, 0x7F, 0x65, 0x64, 0x23, 0x6F, 0x8D, 0xBC, 0x5F, 0xD6, 0xCB,
-    0xB0, 0x0B, 0x9B, 0x39, 0x47, 0x96, 0x2B, 0x74, 0x16, 0x4B, 0xE3, 0xC8, 0x3B, 0x3B, 0x9B, 0x5C,
-    0x9F, 0x7C, 0x6E, 0x6A, 0x60, 0xA2, 0xE3, 0xD1, 0x2E, 0x4B, 0x32, 0x94, 0x2F, 0xDC, 0xD8, 0xDF,
-    0x7F, 0x65, 0xB5, 0x5F, 0x90, 0x5D, 0xB3, 0x1B, 0x58, 0x9C, 0x6F, 0x8F, 0x6F, 0x9B, 0xC6, 0x5E,
-    0x23, 0xCB, 0x4F, 0x1B, 0xD1, 0xD2, 0x36, 0x42, 0xD7, 0x90, 0x35, 0xAF, 0x0D, 0x61, 0x71, 0xB7,
-    0x6A, 0x4C, 0xD7, 0x4C, 0x9F, 0x8A, 0x17, 0x60, 0x27, 0x72, 0xB7, 0xB2, 0x17, 0x92, 0xF3, 0x6B,
-    0x65, 0xEF, 0x78, 0x41, 0x99, 0x82, 0x87, 0xC3, 0xE1, 0xC9, 0x06, 0xCC, 0x71, 0xDD, 0x2B, 0x87,
-    0x07, 0x73, 0x99, 0x38, 0xF4, 0x0C, 0x07, 0x0E, 0xAF, 0xEE, 0x01, 0x0B, 0x87, 0x0F, 0x46, 0x72,
-    0xF8, 0x2A, 0xD0, 0x17, 0x6A, 0x02, 0x4C, 0xB6, 0x77, 0xEE, 0x2D, 0x6F, 0x2D, 0x60, 0xB8, 0x6E,
-    0xE5, 0xDA, 0x39, 0x5D, 0xD0, 0x7E, 0xA7, 0x3F, 0x15, 0xF3, 0x3D, 0x59, 0xC6, 0xCF, 0x38, 0x84,
-    0xE9, 0x07, 0x3B, 0x34, 0xD3, 0x06, 0x93, 0xEB, 0x5C, 0x2E, 0x89, 0x82, 0x9E, 0x28, 0x6E, 0x88,
-    0xB8, 0x7D, 0x18, 0xEF, 0xB2, 0x4E, 0x37, 0x17, 0x8C, 0x09, 0x3B, 0xDD, 0x9F, 0x7B, 0x45, 0x4A,
-    0x01, 0xA1, 0x12, 0x94, 0xAF, 0x6C, 0x18, 0x54, 0x0F, 0x94, 0xEB, 0xCD, 0xD2, 0x85, 0xDE, 0x73,
-    0x45, 0x14, 0x1A, 0x7D, 0x9E, 0xDD, 0xD9, 0xCB, 0x4E, 0xFB, 0x32, 0x70, 0x87, 0x48, 0x56, 0xB2,
-    0x47, 0x2C, 0xE4, 0x9A, 0x96, 0x0C, 0xEB, 0xA0, 0xB7, 0x2C, 0xDF, 0x32, 0x73, 0xBB, 0xAB, 0x09,
-    0x0D, 0xE8, 0x08, 0x78, 0x2A, 0x63, 0x79, 0x2F, 0x9C, 0x22, 0x88, 0xC8, 0x6A, 0x30, 0xA3, 0x45,
-    0x78, 0x69, 0x5F, 0xC9, 0x11, 0xF7, 0x23, 0xD2, 0x6D, 0x49, 0x99, 0x57, 0xA8, 0x28, 0x56, 0x94,
-    0xE9, 0xDF, 0xAE, 0x11, 0xF9, 0x3D, 0x51, 0xD4, 0xD6, 0x3A, 0x20, 0x44, 0x7B, 0xFA, 0xF1, 0x05,
-    0x91, 0x0C, 0x08, 0x90, 0xAC, 0x5C, 0xA0, 0x4C, 0x6F, 0x7D, 0x4D, 0x51, 0xAF, 0xA8, 0x55, 0x54,
-    0x4C, 0x8F, 0x75, 0xA8, 0xE0, 0x88, 0x99, 0x0A, 0x2F, 0xFD, 0x9C, 0xB9, 0x51, 0xB3, 0xBB, 0x06,
-    0xBB, 0xF5, 0x93, 0xFA, 0x96, 0x18, 0x7A, 0xD9, 0x12, 0x6B, 0xFC, 0xB4, 0xF4, 0x75, 0x23, 0xD5,
-    0x31, 0x3F, 0x6F, 0x8E, 0xB6, 0x5F, 0x1A, 0xE4, 0x2E, 0xBB, 0x90, 0x45, 0x78, 0x1B, 0x61, 0x1B,
-    0x98, 0x1A, 0xE9, 0xA2, 0xAF, 0xB2, 0x11, 0x5F, 0xB3, 0xE2, 0x2E, 0x99, 0x50, 0xA4, 0xF3, 0x52,
-    0x25, 0xE0, 0x3D, 0xA5, 0x2B, 0xC8, 0x0A, 0xC2, 0x74, 0xAE, 0xF2, 0x79, 0x5E, 0x4F, 0x89, 0xC2,
-    0xD7, 0xA9, 0x0E, 0x39, 0xF4, 0xF5, 0xEF, 0x71, 0x22, 0xF2, 0xBF, 0xA7, 0x6C, 0x98, 0xFD, 0x5C,
-    0x67, 0x65, 0x54, 0xA4, 0xC2, 0x6E, 0xA4, 0xA4, 0x48, 0x29, 0x84, 0x2C, 0x92, 0x3F, 0x29, 0x61,
-    0xA6, 0xFA, 0x69, 0xD2, 0x89, 0x97, 0xEB, 0xC7, 0x52, 0x9D, 0x45, 0xBF, 0x70, 0x13, 0x57, 0x43,
-    0x42, 0x21, 0xC2, 0xC4, 0xD9, 0xC9, 0x81, 0x0C, 0x04, 0xB4, 0x7A, 0x14, 0xD0, 0xC8, 0xF1, 0x94,
-    0x6F, 0x8A, 0x96, 0xE6, 0x43, 0x6E, 0x2C, 0x98, 0x97, 0x98, 0xDB, 0x8B, 0xAC, 0x32, 0x9D, 0x11,
-    0x7D, 0x41, 0xAB, 0x04, 0x88, 0xA0, 0xC5, 0xAF, 0x43, 0x45, 0xBB, 0xF3, 0xA9, 0xF3, 0x75, 0x0C,
-    0x02, 0xBD, 0x52, 0x97, 0x93, 0x08, 0x27, 0x3A, 0xAC, 0xBA, 0x04, 0x92, 0x5C, 0x87, 0x5C, 0x97,
-    0xFD, 0x5E, 0xCA, 0x07, 0x1D, 0x2A, 0x2F, 0xB8, 0x16, 0x13, 0x0D, 0x54, 0x3A, 0xFC, 0x9E, 0xDC,
-    0x27, 0xEC, 0x54, 0x18, 0x6C, 0xD9, 0x0B, 0x95, 0x88, 0xB1, 0xAD, 0x94, 0x14, 0x53, 0xC8, 0xC1,
-    0x32, 0x45, 0x7B, 0x2A, 0xD1, 0x1C, 0x2A, 0x67, 0x91, 0x5B, 0xE0, 0x6E, 0x32, 0x7B, 0xB2, 0x0D,
-    0x81, 0x1F, 0x80, 0xF3, 0x02, 0x89, 0x54, 0xD4, 0x73, 0xAD, 0x5C, 0x19, 0x2B, 0xEF, 0x8A, 0xB9,
-    0x8E, 0xCF, 0x0A, 0xAD, 0x95, 0x94, 0xC2, 0x28, 0x52, 0x7A, 0x2A, 0x53, 0xAA, 0x50, 0x09, 0x78,
-    0xE8, 0xA9, 0x44, 0xB9, 0x86, 0xA7, 0x4B, 0xEF, 0xC7, 0xFF, 0x55, 0x65, 0x7E, 0x79, 0x43, 0xF3,
-    0x9D, 0x7A, 0x41, 0x3E, 0xB1, 0x9A, 0x49, 0x17, 0xBA, 0x68, 0xCB, 0xEA, 0x74, 0xA8, 0x7F, 0xE5,
-    0xFF, 0x80, 0x33, 0x93, 0x2E, 0x39, 0x31, 0x1D, 0x36, 0xFC, 0x1B, 0x94, 0x79, 0xDF, 0x52, 0xC9,
-    0xB7, 0x45, 0x0F, 0x0F, 0x66, 0xF7, 0xF7, 0x6F, 0x2F, 0xD5, 0x90, 0xE6, 0x42, 0xBE, 0x11, 0xC4,
-    0x37, 0x43, 0x19, 0x8F, 0x77, 0x06, 0x4F, 0x98, 0xF7, 0x30, 0x67, 0x4F, 0xF2, 0x66, 0x0D, 0x65,
-    0x48, 0x0D, 0x45, 0xBF, 0xAD, 0xDF, 0x1B, 0x59, 0xF4, 0x5E, 0x34, 0xB2, 0x87, 0x03, 0x7A, 0x38,
-    0x16, 0x8F, 0x8C, 0x54, 0x5E, 0xEA, 0x9E, 0x69, 0x51, 0x70, 0x43, 0x36, 0x76, 0x72, 0x59, 0x12,
-    0xD4, 0x70, 0x1A, 0xEA, 0x6F, 0x8D, 0x7C, 0x8B, 0x3A, 0xA2, 0x40, 0x91, 0x90, 0x23, 0x51, 0x33,
-    0x47, 0x51, 0x45, 0x14, 0x17, 0x44, 0x89, 0x0A, 0x16, 0xA9, 0xA2, 0x0B, 0x8A, 0x0E, 0x15, 0x2D,
-    0x54, 0x22, 0x50, 0xAA, 0x64, 0x37, 0xCD, 0xC2, 0x21, 0x0A, 0xD9, 0x8B, 0x52, 0x95, 0xEF, 0xD7,
-    0x75, 0x55, 0xE9, 0x5A, 0x73, 0xE8, 0x35, 0xA2, 0xAB, 0x7F, 0x42, 0xF4, 0xDA, 0x63, 0xA3, 0xB3,
-    0x26, 0xA6, 0x17, 0xE1, 0xB2, 0x2A, 0xE7, 0x2D, 0xEC, 0x26, 0x25, 0xE5, 0x42, 0x51, 0x4F, 0x40,
-    0x6B, 0xB2, 0xFF, 0xE0, 0x16, 0x99, 0x72, 0x74, 0x59, 0xB0, 0xD2, 0xDA, 0xD3, 0x3D, 0x52, 0x5A,
-    0x64, 0x2F, 0x97, 0xA5, 0xC5, 0x0D, 0xDE, 0xCB, 0xA4, 0x15, 0x91, 0x8F, 0x24, 0xA2, 0xDB, 0x24,
-    0xE4, 0x2F, 0x61, 0x9B, 0x35, 0x17, 0x2C, 0xCB, 0xCE, 0x1A, 0xE5, 0x55, 0xA1, 0x3C, 0xDE, 0xF1,
-    0x22, 0x63, 0xF5, 0xB6, 0x64, 0xC8, 0x1A, 0x6E, 0xF0, 0xB2, 0x6D, 0x64, 0x4D, 0x4E, 0xBE, 0x5E,
-    0x36, 0xA2, 0xC4, 0xE8, 0x36, 0x21, 0x6A, 0x12, 0xD5, 0x5D, 0x61, 0x81, 0x59, 0x83, 0x45, 0x86,
-    0xFD, 0x40, 0x9E, 0x6B, 0x54, 0x05, 0x93, 0xBE, 0x90, 0xF3, 0xB0, 0x7F, 0x98, 0xB2, 0x92, 0x7D,
-    0xCE, 0x20, 0x92, 0xE8, 0x7B, 0x2C, 0xC9, 0xF1, 0xE5, 0xBE, 0xC2, 0xFE, 0xB2, 0xA5, 0xF7, 0x84,
-    0xAC, 0x0F, 0xDF, 0x74, 0x72, 0x69, 0x82, 0x91, 0xCD, 0xEC, 0xCE, 0x7F, 0x20, 0x82, 0x11, 0xFA,
-    0x04, 0x35, 0xAC, 0x6E, 0x72, 0xFC, 0x21, 0x87, 0xC8, 0x0C, 0x71, 0x79, 0x88, 0x0B, 0xAA, 0xC8,
-    0x2A, 0x28, 0x11, 0x50, 0x63, 0x83, 0x56, 0x08, 0x9E, 0x48, 0x26, 0x1D, 0x83, 0x33, 0xC8, 0x02,
-    0x00, 0x53, 0xE5, 0x4D, 0xF9, 0x09, 0xEE, 0x5D, 0xCA, 0x3E, 0x97, 0x24, 0xC0, 0x1C, 0x40, 0x58,
-    0x66, 0xB4, 0xC8, 0x21, 0x9A, 0x67, 0x10, 0xBC, 0x63, 0xF3, 0xB6, 0x2C, 0xE2, 0x1A, 0xC2, 0xA5,
-    0xD5, 0xD4, 0x1E, 0x67, 0x59, 0xE3, 0x8C, 0xFC, 0xA3, 0xFC, 0x08, 0x8B, 0x8E, 0xBF, 0xA4, 0xA4,
-    0x25, 0x34, 0x48, 0x3D, 0xDA, 0xEA, 0xEA, 0x4F, 0x40, 0xB3, 0xF9, 0x0D, 0x12, 0xB0, 0x1E, 0x6F,
-    0x91, 0x98, 0x4C, 0xA1, 0x53, 0xD4, 0x43, 0x95, 0x7D, 0x55, 0x99, 0x6D, 0xB4, 0x20, 0xEB, 0x85,
-    0x05, 0x65, 0x13, 0xF9, 0xB7, 0x41, 0xC2, 0x96, 0x4F, 0x22, 0x61, 0xD2, 0x27, 0x91, 0xF0, 0x0B,
-    0xA0, 0x58, 0x51, 0x62, 0x51, 0x45, 0x24, 0xA4, 0x03, 0x54, 0x52, 0x58, 0x85, 0x82, 0x2A, 0x08,
-    0xE3, 0x20, 0x8B, 0x59, 0x94, 0xD3, 0xA0, 0x36, 0x6F, 0xCA, 0x3E, 0x28, 0xCC, 0xA4, 0x3F, 0xEB,
-    0xA8, 0xA7, 0xA5, 0x18, 0xD8, 0x94, 0x1C, 0xB4, 0xDA, 0xB4, 0x01, 0x1B, 0x58, 0x52, 0xF2, 0xB2,
-    0xF2, 0xE2, 0xF2, 0xD3, 0x67, 0xD8, 0x35, 0x7E, 0x2E, 0x8D, 0xFF, 0x87, 0x9D, 0xE2, 0x1F, 0xA4,
-    0xF1, 0x29, 0xEE, 0xFC, 0x17, 0x10, 0x4E, 0xC0, 0x29, 0xFF, 0x00, 0x0D, 0xA1, 0xB6, 0x04, 0x2B,
-    0x7C, 0x90, 0xC5, 0xBD, 0xC3, 0x86, 0xD0, 0xEF, 0x1E, 0x1B, 0xB2, 0xE6, 0x29, 0x1E, 0x0D, 0x02,
-    0xAE, 0xBA, 0x46, 0xCF, 0x46, 0xB4, 0xF0, 0xB5, 0x11, 0x2E, 0x83, 0x96, 0x8D, 0x60, 0x15, 0x36,
-    0x6C, 0xF8, 0x63, 0x54, 0xB1, 0x21, 0x14, 0x57, 0x68, 0xA3, 0xFE, 0x03, 0x4F, 0x1B, 0xE5, 0xFF,
-    0xB0, 0x8D, 0x7C, 0x65, 0x1B, 0xC2, 0xA0, 0xB4, 0x21, 0xAC, 0x4D, 0x1A, 0x3E, 0x7F, 0x14, 0x62,
-    0x3A, 0x30, 0x55, 0xD4, 0x07, 0xF5, 0x28, 0x1C, 0xBC, 0x0D, 0x5B, 0x79, 0xF3, 0xB6, 0xE4, 0x26,
-    0xB3, 0xB2, 0x08, 0x34, 0x67, 0x4D, 0x2E, 0x76, 0x89, 0x7C, 0x3E, 0xA4, 0x5C, 0xD9, 0xA1, 0x2F,
-    0x78, 0x33, 0xCF, 0x9A, 0x71, 0xAC, 0x29, 0x47, 0x5E, 0xE2, 0xC3, 0x9A, 0x72, 0xB8, 0x95, 0x5F,
-    0xA5, 0xC7, 0x22, 0xAB, 0x40, 0x6A, 0xC4, 0x34, 0x15, 0x81, 0x8A, 0x46, 0x65, 0x03, 0x71, 0x31,
-    0xED, 0x20, 0x20, 0x09, 0x83, 0x6C, 0x3C, 0xE5, 0x95, 0x60, 0x9B, 0x15, 0x20, 0xA4, 0xD7, 0x60,
-    0x45, 0x38, 0x1A, 0x85, 0x60, 0xBC, 0x9B, 0x70, 0xF6, 0x57, 0xBD, 0x5E, 0x3F, 0xAB, 0xF7, 0xC9,
-    0x79, 0x4F, 0xBD, 0x7F, 0xC2, 0x67, 0xE1, 0xB9, 0x79, 0xE3, 0x53, 0x94, 0xF2, 0xF2, 0x9B, 0x57,
-    0x84, 0x64, 0xCE, 0xA9, 0xB9, 0x1A, 0xA6, 0x3C, 0x15, 0x08, 0x96, 0x16, 0x61, 0x4F, 0xFF, 0xCE,
-    0x23, 0xAA, 0x43, 0x14, 0x58, 0xFB, 0x18, 0xEA, 0x2B, 0x3A, 0xD4, 0xDA, 0x6B, 0x2B, 0xAC, 0x56,
-    0x14, 0x56, 0x07, 0x72, 0x47, 0x8A, 0xA0, 0xB6, 0xFB, 0xE6, 0x84, 0x60, 0x3C, 0x87, 0xB3, 0xFF,
-    0x01, 0x9F, 0x14, 0x2F, 0x28, 0x54, 0xAF, 0xC5, 0xD7, 0xE3, 0x8B, 0xDE, 0x5D, 0x0B, 0x28, 0x56,
-    0x44, 0x54, 0x19, 0x71, 0x6E, 0xBA, 0xDD, 0xB0, 0xDD, 0x46, 0xAB, 0x00, 0xF6, 0x9A, 0xBB, 0xB6,
-    0xDD, 0x6E, 0x09, 0xA2, 0x5B, 0xB6, 0xDB, 0xE6, 0x5E, 0x6D, 0xB7, 0x6A, 0xF1, 0x51, 0x7B, 0x4F,
-    0xFE, 0xC6, 0xA5, 0x0F, 0x5E, 0x19, 0x2E, 0x08, 0x8D, 0xF8, 0xC3, 0x2E, 0x84, 0x76, 0x85, 0xEF,
-    0x2A, 0x7C, 0x0A, 0xF0, 0x49, 0x6B, 0x8B, 0x7D, 0x80, 0x90, 0x02, 0x85, 0x48, 0x2E, 0xA2, 0xA2,
-    0x27, 0xD0, 0x3A, 0x7E, 0x13, 0x34, 0x73, 0x19, 0xEA, 0xFD, 0x7D, 0x6B, 0x25, 0xD7, 0xAB, 0xFC,
-    0x5A, 0x6F, 0xE4, 0x8C, 0x33, 0x67, 0xEB, 0x5F, 0xE2, 0xF7, 0x6A, 0x8B, 0x94, 0x2E, 0xDC, 0x28,
-    0xFF, 0x09, 0x7C, 0x1E, 0x22, 0x61, 0x4A, 0x75, 0x81, 0x02, 0xA1, 0xC8, 0x59, 0x10, 0x02, 0x31,
-    0xB1, 0x82, 0xEB, 0x4A, 0xD8, 0xB4, 0xE0, 0x9C, 0x32, 0xDC, 0x0C, 0xB7, 0xB7, 0xC0, 0x8D, 0xBB,
-    0xDE, 0x7D, 0xDE, 0xDD, 0xCF, 0xDD, 0xDF, 0xB7, 0xCF, 0xF3, 0x72, 0x3C, 0xBF, 0xD1, 0xFE, 0xD0,
-    0x6E, 0x77, 0x4E, 0xFB, 0x37, 0xF5, 0x97, 0x3B, 0xED, 0xEC, 0x7D, 0x9E, 0x38, 0x3E, 0xC6, 0xC8,
-    0x9B, 0xA5, 0x4F, 0x31, 0x41, 0xD0, 0x28, 0x4B, 0xB0, 0xA1, 0xF0, 0x28, 0xFB, 0x37, 0x7D, 0x60,
-    0x2D, 0x34, 0x03, 0xF4, 0xFD, 0x1A, 0xC9, 0x92, 0x63, 0x18, 0x2E, 0x39, 0x86, 0xC1, 0x48, 0x19,
-    0xC1, 0x33, 0x97, 0xF4, 0xE6, 0xD6, 0xF5, 0xB7, 0xB0, 0x52, 0xB3, 0xBA, 0x00, 0x75, 0x06, 0x62,
-    0x3B, 0xBE, 0xBA, 0x9C, 0xF6, 0x54, 0x9C, 0x5E, 0x90, 0xDE, 0x83, 0x9E, 0x14, 0x1F, 0xB6, 0x58,
-    0xB7, 0xB2, 0xBF, 0x52, 0x84, 0xCE, 0xD4, 0x65, 0x74, 0x99, 0x42, 0xB2, 0x47, 0xA6, 0xAB, 0xBC,
-    0x97, 0x3B, 0xCD, 0x39, 0x61, 0xCB, 0xB2, 0xCF, 0xC4, 0xD4, 0x0C, 0x1E, 0x07, 0xF3, 0xC9, 0x4A,
-    0xCD, 0x27, 0x2B, 0x6B, 0x3E, 0x59, 0x4E, 0xE6, 0x93, 0xF5, 0x08, 0xF9, 0xCB, 0xB9, 0x59, 0x73,
-    0xCB, 0x66, 0x62, 0xD1, 0xF3, 0x96, 0x15, 0x89, 0x00, 0x2A, 0xCB, 0x6A, 0x61, 0x91, 0xBF, 0x7E,
-    0x69, 0x30, 0xC0, 0x5A, 0x1F, 0x7B, 0x0F, 0xA8, 0x20, 0x12, 0xC6, 0x05, 0x24, 0x73, 0x82, 0xBB,
-    0x64, 0xAB, 0x97, 0x0E, 0xA8, 0x39, 0x90, 0xB4, 0x7D, 0x63, 0x7E, 0x82, 0x69, 0xF1, 0x2F, 0xFA,
-    0x3A, 0xC9, 0x77, 0x81, 0x9C, 0x69, 0x47, 0xA7, 0x5C, 0xF8, 0xBD, 0x15, 0x16, 0x65, 0xAA, 0xE4,
-    0xAE, 0x22, 0x21, 0x74, 0xEB, 0x16, 0xE6, 0x4D, 0x68, 0x33, 0x55, 0x53, 0x8A, 0x50, 0x6B, 0x3C,
-    0x4C, 0xAD, 0xFE, 0x31, 0x6F, 0xF9, 0xB6, 0xB5, 0xB0, 0x93, 0x0F, 0x7F, 0x45, 0xED, 0x5A, 0xDD,
-    0xBF, 0xD5, 0xD1, 0xE8, 0xD7, 0xA3, 0xD1, 0x4F, 0xA3, 0xD1, 0xBB, 0xBD, 0xF6, 0x60, 0x6A, 0xC5,
-    0x53, 0x2B, 0x9C, 0x5A, 0xC1, 0xD4, 0xF2, 0xA7, 0x96, 0x77, 0x5A, 0x8B, 0x1B, 0xA5, 0xA7, 0x9E,
-    0x11, 0xA0, 0x37, 0x68, 0x32, 0xB9, 0xA0, 0x7B, 0xF4, 0xEE, 0x69, 0xE8, 0x29, 0x45, 0xDE, 0x36,
-    0x7A, 0xC3, 0xDA, 0x6A, 0x29, 0x72, 0x95, 0x1F, 0x41, 0x64, 0x97, 0xBF, 0x51, 0xE5, 0x91, 0x4B,
-    0xB0, 0xD3, 0x0B, 0x02, 0x97, 0x5D, 0x23, 0x30, 0xD1, 0x13, 0x28, 0x6F, 0xE7, 0x97, 0xE0, 0xEE,
-    0x6A, 0xD1, 0x13, 0xB6, 0x7E, 0x7E, 0x05, 0x1B, 0xB7, 0xF3, 0xE4, 0x8C, 0xAA, 0x71, 0x3A, 0x95,
-    0xD3, 0xE9, 0x9C, 0x93, 0xD2, 0xE9, 0xB4, 0xCE, 0x7B, 0xC2, 0xFB, 0x16, 0x43, 0xAA, 0x05, 0x7E,
-    0x5B, 0x1E, 0xC6, 0xBF, 0x0B, 0x0F, 0x22, 0x16, 0xA6, 0xE9, 0x84, 0x2A, 0x27, 0x62, 0x39, 0x4B,
-    0xE4, 0xED, 0xB1, 0xBB, 0xCE, 0x7E, 0x4E, 0xD6, 0x3E, 0x34, 0x51, 0xEC, 0xA7, 0x86, 0x96, 0x9D,
-    0x96, 0xBA, 0xA8, 0xEC, 0x4A, 0x56, 0x19, 0xB5, 0x6F, 0x47, 0x95, 0xE0, 0x5E, 0x84, 0x33, 0x7D,
-    0x07, 0x7D, 0x03, 0xED, 0xBF, 0xF6, 0x7E, 0x5B, 0x58, 0xBC, 0x7B, 0xFB, 0x29, 0x59, 0x73, 0xAA,
-    0x8B, 0xB3, 0xB5, 0xF6, 0x53, 0x47, 0x85, 0x30, 0x7B, 0x46, 0x9C, 0x0B, 0x1A, 0x5D, 0x3C, 0x5A,
-    0x5D, 0x60, 0xF9, 0x94, 0x05, 0x99, 0xD1, 0x76, 0x17, 0x17, 0x96, 0xCF, 0xF9, 0xE3, 0xC9, 0xAE,
-    0x16, 0x16, 0xC6, 0x94, 0x43, 0x15, 0xCE, 0x7F, 0x7F, 0xAA, 0xF4, 0x39, 0x5A, 0x3B, 0x60, 0xCE,
-    0x88, 0x9A, 0xB2, 0xC0, 0x0A, 0x80, 0x6C, 0xD4, 0x42, 0x95, 0x86, 0xAC, 0x64, 0xDE, 0x56, 0x86,
-    0x8C, 0x1D, 0x18, 0xD6, 0x98, 0x4D, 0x13, 0x85, 0xAF, 0xD6, 0xD5, 0x15, 0xF6, 0xF8, 0x8E, 0xC3,
-    0x2B, 0xD2, 0xEA, 0xD2, 0x09, 0xC7, 0x6A, 0x79, 0x18, 0xAC, 0x65, 0x96, 0xAA, 0x05, 0xCC, 0xB5,
-    0x30, 0xAD, 0x27, 0xF0, 0x59, 0x82, 0x2E, 0xE5, 0xDD, 0xB4, 0xC1, 0x90, 0x80, 0x92, 0x0A, 0x09,
-    0x1A, 0x95, 0x6D, 0xD4, 0xB6, 0xC1, 0xB5, 0xB0, 0xD1, 0x98, 0xFE, 0xB4, 0x6E, 0x4C, 0x9F, 0x9A,
-    0xEE, 0x33, 0xDD, 0x79, 0x7A, 0x56, 0xE6, 0x9E, 0x6E, 0xDD, 0xDA, 0x46, 0x8D, 0x7C, 0x56, 0xC4,
-    0x91, 0x21, 0x80, 0x44, 0x2E, 0xDA, 0x97, 0xDA, 0x05, 0xB2, 0x9B, 0xF5, 0x40, 0x0D, 0xED, 0x9C,
-    0x1D, 0x4E, 0x17, 0xCD, 0x70, 0x8E, 0xC2, 0xBA, 0xAF, 0x9A, 0x61, 0x3C, 0xEE, 0x63, 0xAD, 0xA7,
-    0x9C, 0x2D, 0x3C, 0x2A, 0xD7, 0xA5, 0x96, 0xAB, 0xC0, 0x49, 0x54, 0xCC, 0x91, 0xFD, 0x9B, 0xBD,
-    0x52, 0x96, 0x29, 0x90, 0xC8, 0x30, 0x40, 0xA1, 0x79, 0x83, 0x7C, 0xC0, 0x2E, 0xFF, 0xFC, 0x23,
-    0x35, 0x15, 0x55, 0xF4, 0x4F, 0x18, 0x5E, 0x12, 0x8C, 0x44, 0x32, 0xD2, 0xB3, 0xCF, 0x65, 0x1B,
-    0x4F, 0x37, 0x7C, 0x02, 0xCC, 0x82, 0x10, 0xAD, 0x96, 0xB2, 0xD6, 0x6F, 0xC2, 0xE8, 0x97, 0xA1,
-    0xBB, 0x67, 0x5F, 0xA6, 0xB2, 0xD1, 0x89, 0x88, 0xFC, 0xEA, 0x12, 0x33, 0xBE, 0x02, 0x90, 0xA9,
-    0xA2, 0x25, 0xE8, 0xA2, 0x47, 0x1B, 0xAF, 0x03, 0x67, 0x8F, 0x0D, 0x5F, 0xD3, 0x8B, 0x57, 0x45,
-    0x09, 0x81, 0xB9, 0xC4, 0x23, 0x4A, 0xDC, 0xBD, 0x06, 0xC1, 0xD4, 0x5E, 0x5E, 0x70, 0x7C, 0x65,
-    0xEB, 0xCD, 0xBA, 0x34, 0x2F, 0x12, 0xB3, 0xCA, 0xAF, 0x07, 0x66, 0x10, 0xC9, 0xEC, 0x69, 0x4B,
-    0x2A, 0xB0, 0x08, 0x9F, 0x93, 0xE1, 0xFE, 0x2F, 0xB2, 0x82, 0x62, 0x10, 0x7E, 0x0E, 0xBA, 0x31,
-    0x37, 0x0B, 0x4F, 0x2D, 0x98, 0x9D, 0xBA, 0x4E, 0x60, 0x9B, 0xDE, 0x2F, 0xBC, 0x67, 0x62, 0x19,
-    0xEF, 0x17, 0xF2, 0x1F, 0x98, 0x62, 0x4F, 0x26, 0xA0, 0xBD, 0x20, 0x9F, 0xE9, 0x73, 0x18, 0x49,
-    0xE4, 0xB9, 0x21, 0x74, 0x5F, 0xAA, 0xAC, 0xC1, 0x12, 0xEF, 0x37, 0x07, 0xF8, 0x03, 0x7D, 0xC3,
-    0x29, 0xAE, 0x4B, 0x60, 0x6B, 0x89, 0xE0, 0xD1, 0x0F, 0x96, 0x94, 0x64, 0xE5, 0x7E, 0x42, 0xA6,
-    0x60, 0xA5, 0xFB, 0xB6, 0x5B, 0xB5, 0xF3, 0x67, 0xC3, 0x8F, 0x5C, 0x36, 0x22, 0x13, 0x65, 0xAD,
-    0x80, 0x14, 0x20, 0x61, 0x0B, 0xBF, 0xCB, 0x2B, 0x7F, 0xB5, 0x3F, 0xEA, 0x1A, 0xF0, 0x47, 0x98,
-    0x26, 0xED, 0x75, 0x49, 0xEF, 0x63, 0xF4, 0x04, 0x44, 0x53, 0x4B, 0x9F, 0xD6, 0x62, 0x79, 0x8B,
-    0xCC, 0x68, 0x06, 0xF7, 0x1C, 0x83, 0xC7, 0xC8, 0x9F, 0x72, 0x7C, 0x18, 0x77, 0xC6, 0xB5, 0xF2,
-    0x7D, 0x16, 0x82, 0xD8, 0x1D, 0xBF, 0x57, 0xEA, 0xB3, 0x3A, 0x10, 0xA9, 0x66, 0x6E, 0x2D, 0xC0,
-    0x8E, 0x4E, 0xEF, 0xFC, 0x91, 0xA8, 0x36, 0x6A, 0xE8, 0x87, 0x87, 0x4A, 0xE0, 0xE0, 0x60, 0x5C,
-    0xAC, 0x61, 0xA2, 0xD0, 0x5B, 0xC3, 0x94, 0x70, 0x87, 0x70, 0x8F, 0x70, 0x97, 0xF0, 0x2A, 0xE1,
-    0x00, 0x28, 0xBB, 0x5F, 0x68, 0x3D, 0x16, 0x1D, 0x61, 0x8F, 0xB5, 0x95, 0xF6, 0x20, 0x8F, 0xA8,
-    0xBF, 0xCC, 0x9D, 0xF2, 0x90, 0xBB, 0xE4, 0x21, 0x77, 0x48, 0x9A, 0xFD, 0x7B, 0xBA, 0x00, 0xDE,
-    0x54, 0x86, 0x91, 0x71, 0xDC, 0x5E, 0x59, 0xE2, 0x3E, 0xEB, 0xA0, 0x1F, 0x51, 0x34, 0xA0, 0x70,
-    0xC8, 0xCC, 0xA5, 0x08, 0xD2, 0x49, 0xBB, 0xF2, 0xA3, 0xE3, 0x2B, 0x7C, 0x42, 0x57, 0xBE, 0xB1,
-    0xBF, 0x5F, 0x68, 0x88, 0xD1, 0x14, 0x67, 0x44, 0xAF, 0x1C, 0x95, 0x3F, 0x68, 0x76, 0xD8, 0x0A,
-    0x33, 0xEE, 0x2C, 0x10, 0xF2, 0x87, 0xD9, 0x94, 0x72, 0xB4, 0x85, 0x7E, 0x52, 0xD3, 0x1E, 0x8C,
-    0xE7, 0xCC, 0x22, 0x36, 0x18, 0x92, 0xBC, 0x09, 0x16, 0x90, 0x75, 0xF3, 0x0A, 0x9A, 0xC4, 0x9E,
-    0x60, 0xA8, 0x82, 0x29, 0x7A, 0x82, 0xD7, 0x90, 0x5E, 0xEC, 0x32, 0xC8, 0x24, 0xAF, 0x38, 0x61,
-    0x9F, 0x96, 0xFF, 0xD4, 0xDB, 0x01, 0x06, 0xB9, 0x44, 0x63, 0xFD, 0xF1, 0x8A, 0x5A, 0x62, 0x5E,
-    0x81, 0x6B, 0xA2, 0xC3, 0xB5, 0x0D, 0xD8, 0x43, 0xE7, 0xEA, 0x22, 0xAF, 0xB2, 0x4E, 0xD7, 0x66,
-    0x42, 0xA7, 0x4C, 0x0E, 0x26, 0x28, 0x22, 0x58, 0xD9, 0x48, 0x47, 0xEB, 0xFE, 0x1C, 0xC2, 0xA8,
-    0x3A, 0x53, 0x81, 0xAE, 0x65, 0x95, 0x3E, 0x7D, 0x11, 0x8B, 0xA0, 0xC8, 0x3F, 0x28, 0xDB, 0xB2,
-    0x48, 0xFA, 0xD7, 0x85, 0x4E, 0x65, 0xF0, 0x17, 0x67, 0x38, 0xE8, 0xF0, 0x01, 0x26, 0xAD, 0xF7,
-    0xB4, 0xAC, 0x2C, 0x3C, 0xFC, 0xBB, 0x58, 0xFC, 0xB1, 0xFA, 0x63, 0x84, 0x4A, 0xBF, 0x26, 0xB4,
-    0x70, 0x28, 0x34, 0xF1, 0x1E, 0x0D, 0x3F, 0xF1, 0x90, 0x7F, 0x50, 0x77, 0x31, 0xD6, 0xD2, 0xD3,
-    0xC5, 0xF4, 0xF6, 0x7D, 0x66, 0x96, 0x99, 0x39, 0x3A, 0x6F, 0xAE, 0x07, 0xDC, 0xA3, 0x40, 0x3D,
-    0x23, 0xE9, 0x88, 0x30, 0x24, 0x4C, 0x08, 0x2F, 0x00, 0xFA, 0x0B, 0xC0, 0xA8, 0x05, 0x4C, 0x0B,
-    0xC0, 0xCB, 0xB8, 0x72, 0xEC, 0x01, 0x65, 0xFF, 0x57, 0x67, 0xEC, 0xE8, 0xEE, 0x43, 0x18, 0x8E,
-    0xEA, 0x9D, 0xED, 0xE4, 0x29, 0xFA, 0x44, 0x27, 0x40, 0x55, 0x21, 0xC8, 0xA3, 0xC2, 0x6B, 0x64,
-    0xB4, 0x5C, 0x25, 0x37, 0xC0, 0x1A, 0xD5, 0xB4, 0x35, 0xA9, 0xBA, 0xDE, 0x23, 0xD1, 0xDB, 0x1A,
-    0xC2, 0x60, 0x21, 0x4F, 0xCF, 0x46, 0xB0, 0x54, 0x21, 0x4D, 0xB9, 0x5E, 0xF8, 0x10, 0x9E, 0xC5,
-    0x95, 0x77, 0x0D, 0x10, 0x52, 0x9F, 0x3C, 0x11, 0x66, 0xFB, 0xD5, 0x25, 0xCA, 0x44, 0xD0, 0x7A,
-    0xFD, 0xF1, 0x0A, 0x7F, 0x0F, 0xC5, 0xD3, 0x5F, 0xD2, 0x11, 0xC7, 0x00, 0x02, 0xF9, 0x54, 0x5D,
-    0x59, 0x3B, 0xBF, 0xDC, 0x4D, 0xB6, 0x04, 0x79, 0x7A, 0x0C, 0x87, 0x69, 0x17, 0xC2, 0xE1, 0xD4,
-    0xAB, 0x01, 0xC6, 0xAD, 0xDF, 0xD6, 0x3F, 0xE0, 0x8E, 0x16, 0x37, 0xDB, 0x2B, 0xD7, 0xAE, 0xDF,
-    0x39, 0x9C, 0xAF, 0xE2, 0x13, 0x6B, 0x39, 0x23, 0xBC, 0x40, 0x78, 0x19, 0x10, 0x7C, 0x69, 0x00,
-    0x11, 0x41, 0xDC, 0x82, 0x59, 0xFB, 0xA8, 0x84, 0x43, 0xB9, 0x3D, 0xBB, 0x35, 0x03, 0xD4, 0xC9,
-    0x65, 0x14, 0x40, 0xC9, 0x50, 0xC8, 0x61, 0x52, 0x80, 0xD9, 0x04, 0xDF, 0x2D, 0x4D, 0xC5, 0xE1,
-    0x27, 0x82, 0x3F, 0x5B, 0x78, 0xD1, 0xCF, 0x05, 0xFF, 0x4A, 0x28, 0xFB, 0x92, 0xE0, 0x7F, 0x95,
-    0xA1, 0x92, 0x9D, 0xDC, 0xEF, 0x8D, 0xB7, 0x43, 0x5C, 0x17, 0xBB, 0xC4, 0x79, 0xF5, 0x9A, 0xE2,
-    0x66, 0x20, 0x4E, 0x7F, 0xD1, 0x13, 0x27, 0xBF, 0x6A, 0x89, 0xA3, 0x5F, 0x37, 0xC4, 0x32, 0x1C,
-    0xC4, 0x01, 0x25, 0x02, 0xE9, 0xF0, 0x88, 0xDD, 0xE5, 0x60, 0x2C, 0x56, 0x01, 0x15, 0xEE, 0xE6,
-    0x30, 0x9A, 0xF6, 0xDC, 0x1A, 0xF6, 0xA7, 0xC5, 0x44, 0x27, 0xBE, 0xD2, 0xC9, 0x8A, 0x74, 0x72,
-    0x2A, 0x5C, 0xC1, 0xD1, 0xE8, 0x53, 0x9D, 0xF4, 0xC7, 0xE3, 0xE3, 0xDB, 0x5C, 0x69, 0xAF, 0xB7,
-    0x74, 0x12, 0xCC, 0xE8, 0x24, 0xC7, 0x02, 0xDC, 0x27, 0x07, 0x83, 0x46, 0xF4, 0x1D, 0xE3, 0x91,
-    0x95, 0x20, 0x4A, 0xAC, 0x93, 0x1E, 0xC7, 0x30, 0xC6, 0xBA, 0x4D, 0xA9, 0x52, 0x7B, 0xEC, 0x09,
-    0xC0, 0x3F, 0xF0, 0x12, 0x5E, 0xCC, 0x8F, 0xE1, 0x06, 0x2D, 0x6E, 0x25, 0xD2, 0xE1, 0x0F, 0x46,
-    0x7B, 0xFB, 0x35, 0x07, 0xA3, 0x7E, 0x32, 0xD0, 0xE8, 0xF6, 0x26, 0xEC, 0x7E, 0xEC, 0xE3, 0xFD,
-    0xFC, 0xBF, 0xC2, 0x76, 0x17, 0xF2, 0x75, 0xE5, 0x5D, 0x85, 0x3D, 0xF3, 0x5D, 0xAD, 0xB7, 0xAD,
-    0x96, 0x51, 0x6E, 0xBD, 0x83, 0x45, 0x0D, 0xA7, 0xC8, 0xD8, 0x45, 0x18, 0x12, 0xCA, 0xD8, 0x14,
-    0x64, 0xB1, 0x46, 0xF3, 0x0A, 0xB2, 0x9D, 0xB0, 0xD4, 0xA5, 0x83, 0xD9, 0x2D, 0xA0, 0xFC, 0x55,
-    0xAF, 0xD4, 0x4F, 0xE9, 0x1D, 0x0C, 0x3C, 0xB0, 0xC1, 0x78, 0x3D, 0x46, 0x37, 0xE8, 0x06, 0x97,
-    0xF5, 0x8F, 0xFD, 0xDB, 0x7B, 0xD9, 0xD3, 0x78, 0xAE, 0x5B, 0x42, 0x0A, 0x0B, 0x2A, 0x27, 0x83,
-    0x22, 0x28, 0xC0, 0xBA, 0xF9, 0xF1, 0xCD, 0x2B, 0x23, 0xE9, 0x1D, 0xCB, 0xB8, 0x2C, 0xB0, 0xC3,
-    0x60, 0x09, 0x7E, 0xDB, 0xEE, 0x21, 0x53, 0xD4, 0xEA, 0x16, 0x58, 0xEF, 0x30, 0xF9, 0xB4, 0xC3,
-    0xC8, 0x92, 0x8E, 0x0A, 0x44, 0x10, 0x68, 0xAC, 0xAA, 0xDC, 0x1E, 0xEE, 0xB9, 0x97, 0x27, 0x6B,
-    0x08, 0x6D, 0x21, 0xC6, 0x2C, 0x73, 0x21, 0x99, 0xE5, 0x9E, 0x80, 0xC3, 0x5D, 0x01, 0xBB, 0x04,
-    0xDF, 0x12, 0xF0, 0x94, 0x0D, 0x4C, 0xB9, 0x5B, 0xA0, 0x91, 0x02, 0x7C, 0x8F, 0x0F, 0x69, 0x1F,
-    0x9B, 0xE2, 0x8D, 0x1A, 0x6C, 0x63, 0xD8, 0x37, 0xAA, 0x98, 0x64, 0x0A, 0x36, 0xB3, 0xE4, 0x60,
-    0x0C, 0xE4, 0x6E, 0xD4, 0x47, 0x82, 0x0E, 0x52, 0x2B, 0x8C, 0x94, 0xB2, 0xED, 0xC0, 0xF7, 0xDB,
-    0x40, 0x94, 0x4A, 0xBA, 0x84, 0xFA, 0x6C, 0xC6, 0x08, 0xA7, 0x3D, 0x9A, 0xD1, 0x76, 0x69, 0xF8,
-    0xB9, 0xCA, 0x07, 0x73, 0xA3, 0x63, 0x78, 0x9D, 0xA7, 0x3E, 0x66, 0x8D, 0x7B, 0x51, 0x33, 0xA5,
-    0x7A, 0xAC, 0x13, 0xF6, 0x62, 0x47, 0x6D, 0x68, 0x6B, 0x6B, 0x11, 0xCD, 0x9B, 0x11, 0x87, 0x3F,
-    0x62, 0x9C, 0x9E, 0xB5, 0xB9, 0x68, 0x90, 0xAF, 0x7F, 0xFC, 0xA6, 0xDA, 0x61, 0x54, 0xF4, 0x49,
-    0x15, 0x45, 0xC3, 0xDC, 0x32, 0x7A, 0x2A, 0x3A, 0x4F, 0x4D, 0x28, 0xD6, 0x2D, 0xB7, 0xFC, 0xF8,
-    0x26, 0x68, 0x62, 0x15, 0x0E, 0x29, 0x9C, 0xF0, 0xE1, 0x80, 0x90, 0xCD, 0x2E, 0x1C, 0x84, 0x9E,
-    0xB2, 0x26, 0x54, 0x95, 0x41, 0x11, 0x38, 0x23, 0x36, 0x60, 0x08, 0x29, 0x22, 0x34, 0xCC, 0x51,
-    0x3E, 0x43, 0xB5, 0xFB, 0x40, 0xD6, 0x92, 0xD3, 0x24, 0xBD, 0xDC, 0x4C, 0x18, 0xE4, 0x82, 0xB7,
-    0x0E, 0x46, 0x79, 0x10, 0x86, 0xF1, 0xD7, 0x37, 0xC1, 0x71, 0x22, 0xED, 0x84, 0x17, 0xDD, 0xB8,
-    0x63, 0xAF, 0xA3, 0xB9, 0xDD, 0x51, 0x64, 0xB1, 0x23, 0xF5, 0xEA, 0xF7, 0x5B, 0xEE, 0x5C, 0x59,
-    0x5E, 0xC2, 0x68, 0xCF, 0x9B, 0xEE, 0x80, 0x6E, 0x89, 0x18, 0xCF, 0xAA, 0x30, 0x4D, 0x59, 0x93,
-    0x52, 0xB2, 0xD8, 0x65, 0x54, 0xC5, 0xBB, 0x54, 0xC9, 0x38, 0x1D, 0x6A, 0xB3, 0x54, 0x4B, 0xAA,
-    0x4E, 0xD0, 0xAF, 0xF1, 0xA8, 0xE0, 0x1F, 0xF1, 0xA4, 0x88, 0x72, 0x48, 0x42, 0x12, 0xDE, 0xA3,
-    0x46, 0x73, 0x0D, 0xEA, 0x8C, 0xBC, 0x50, 0x82, 0x9D, 0x46, 0xB6, 0x99, 0x23, 0x21, 0x1E, 0x8D,
-    0xC5, 0x75, 0xDC, 0x73, 0xC0, 0x3E, 0x27, 0x1C, 0x65, 0xC4, 0x32, 0x52, 0x1E, 0x70, 0x7F, 0xF9,
-    0x4A, 0x48, 0x48, 0x3B, 0xCB, 0x50, 0xDB, 0xE0, 0x50, 0x67, 0x98, 0xD5, 0xD1, 0xF2, 0x75, 0xB0,
-    0xE6, 0xF0, 0xDD, 0x49, 0x3F, 0xA0, 0xC6, 0x23, 0xFD, 0xEC, 0x9F, 0x33, 0x6F, 0x6E, 0xF7, 0xF3,
-    0x04, 0xF4, 0xE6, 0x90, 0xE2, 0xBB, 0x57, 0xB7, 0xE7, 0x97, 0x5C, 0x9D, 0x4B, 0x98, 0xA4, 0xFF,
-    0xE5, 0x5E, 0x19, 0x89, 0x1B, 0x28, 0x63, 0xFE, 0x56, 0x86, 0x4E, 0xC6, 0xEA, 0xC0, 0xFC, 0x69,
-    0x3D, 0x82, 0xE1, 0x45, 0x74, 0x3A, 0xCA, 0x73, 0xE5, 0x25, 0x20, 0x22, 0x2C, 0xBF, 0x84, 0x46,
-    0xA8, 0x8D, 0xC9, 0x8C, 0x85, 0xFD, 0x51, 0xBF, 0x9A, 0xC7, 0xA6, 0xF3, 0xDD, 0x64, 0x83, 0x6B,
-    0xB6, 0x3B, 0xEF, 0x44, 0x22, 0xCB, 0x7E, 0x34, 0x9E, 0x4E, 0xBF, 0x22, 0xD7, 0x08, 0x4F, 0x34,
-    0x82, 0x66, 0xE2, 0xC8, 0x0B, 0xC2, 0x0E, 0xA1, 0x05, 0x23, 0xB9, 0xD5, 0x8A, 0x46, 0xB6, 0x35,
-    0xFC, 0x96, 0x0D, 0x12, 0x5C, 0x59, 0xCE, 0x7A, 0xDD, 0x73, 0xFE, 0xBA, 0x15, 0xC3, 0x64, 0xD4,
-    0xE1, 0x4C, 0x3D, 0x58, 0x20, 0x56, 0xB5, 0x83, 0x31, 0x87, 0x0F, 0xAB, 0x8B, 0x01, 0xE0, 0x19,
-    0x3F, 0x55, 0x3A, 0xD5, 0x4E, 0x07, 0x7E, 0xA0, 0x40, 0x2F, 0x54, 0x2B, 0x94, 0x77, 0x93, 0xC1,
-    0xC5, 0xB8, 0xD4, 0xB7, 0x41, 0xC7, 0xB4, 0xB5, 0xA7, 0xB7, 0xC1, 0xE8, 0x8E, 0x62, 0x53, 0xE8,
-    0xEF, 0xCB, 0x56, 0x71, 0xD2, 0x2B, 0x8E, 0xEF, 0x80, 0xE9, 0x18, 0x46, 0xC8, 0x56, 0x9B, 0xEB,
-    0x30, 0xFF, 0xBE, 0xA8, 0x46, 0x50, 0x6F, 0x63, 0x27, 0x42, 0x31, 0x9C, 0x06, 0x3D, 0xD4, 0xEE,
-    0xB1, 0x6F, 0xEC, 0xC0, 0x36, 0x40, 0x67, 0xD8, 0x13, 0x76, 0x63, 0x43, 0xCD, 0xDD, 0x02, 0x49,
-    0xCF, 0x27, 0x3A, 0x5D, 0x57, 0x86, 0xF4, 0x69, 0xD8, 0x9D, 0x46, 0x4F, 0xB4, 0x92, 0x46, 0x35,
-    0x9B, 0x70, 0xB1, 0x27, 0x4B, 0xEE, 0x8C, 0x3E, 0x6E, 0xF4, 0x9C, 0x13, 0x5C, 0x86, 0xCF, 0x3A,
-    0x3B, 0x8D, 0xFD, 0xFD, 0x4A, 0x34, 0x9B, 0xE5, 0xA1, 0x5C, 0x2B, 0x9A, 0xCD, 0x50, 0x23, 0x7B,
-    0xE3, 0x83, 0xBA, 0x62, 0x0C, 0x91, 0xD5, 0x6C, 0x44, 0x69, 0x02, 0x85, 0x07, 0x86, 0x02, 0xD3,
-    0x51, 0xFA, 0xC1, 0x41, 0x4B, 0x33, 0x48, 0x21, 0xB3, 0x24, 0x77, 0x1F, 0x95, 0x9F, 0x39, 0x99,
-    0x4E, 0xD9, 0x82, 0xC8, 0xE5, 0x0B, 0x58, 0xA1, 0x26, 0xBC, 0x42, 0xA0, 0x3A, 0x4C, 0x85, 0x46,
-    0xF1, 0x78, 0x45, 0xF1, 0x12, 0xB1, 0x1D, 0xC0, 0xF3, 0xEB, 0x8D, 0x95, 0xEB, 0x47, 0xBD, 0xAF,
-    0xBF, 0x9A, 0x9E, 0x23, 0x82, 0x53, 0x59, 0xD1, 0xA6, 0xDC, 0xA5, 0x37, 0x84, 0x51, 0xBB, 0x7E,
-    0xD1, 0x3A, 0x34, 0x69, 0x38, 0xB0, 0xAE, 0x82, 0xC6, 0x6E, 0x08, 0xB7, 0xC9, 0x9B, 0x08, 0xF2,
-    0x1E, 0x8C, 0x6B, 0x33, 0x10, 0xC1, 0x70, 0x43, 0x75, 0xD1, 0x37, 0xB0, 0xF2, 0x64, 0xD0, 0x04,
-    0x92, 0x4F, 0x69, 0xBF, 0xCD, 0x2B, 0x4D, 0x05, 0x13, 0x3D, 0xB1, 0xF2, 0x47, 0x7B, 0x5D, 0x23,
-    0xDC, 0xB4, 0x6C, 0xCA, 0x4E, 0xA8, 0x6C, 0x2C, 0x64, 0x6A, 0xBD, 0xEF, 0x16, 0x6E, 0x93, 0x60,
-    0xE4, 0xB6, 0x1A, 0xAD, 0x17, 0xD3, 0x86, 0x7D, 0x66, 0xB2, 0x5C, 0x3F, 0x54, 0x45, 0xFC, 0x6A,
-    0x00, 0x4D, 0x4A, 0xC6, 0x90, 0xC0, 0x5B, 0x82, 0xFB, 0x3F, 0xE9, 0x6D, 0xA8, 0x7E, 0x0F, 0xB5,
-    0x43, 0xDF, 0xFD, 0x1B, 0x50, 0xDA, 0xD2, 0xED, 0xD3, 0xC1, 0x04, 0x9C, 0x11, 0xB6, 0x9D, 0xFD,
-    0x2E, 0x58, 0x9E, 0xFB, 0x1B, 0x01, 0xA5, 0x11, 0x11, 0x76, 0xC4, 0xC4, 0x36, 0xF1, 0xC0, 0x50,
-    0x8C, 0x00, 0x73, 0x1F, 0x58, 0xEA, 0xBA, 0x47, 0x80, 0xAD, 0x6C, 0x79, 0xC5, 0x74, 0xBE, 0x48,
-    0xBC, 0xFD, 0x69, 0xCB, 0x8E, 0x8F, 0x66, 0x78, 0x71, 0x38, 0x45, 0xD6, 0x51, 0xCD, 0x84, 0x08,
-    0xF2, 0xEC, 0x91, 0xBE, 0x6B, 0xAD, 0x17, 0x63, 0x96, 0xB7, 0x72, 0x1D, 0xEF, 0xBB, 0x85, 0xE9,
-    0xDE, 0xE5, 0x6A, 0x2C, 0x67, 0x05, 0xF7, 0x2E, 0x57, 0x9F, 0xBD, 0x08, 0x03, 0x81, 0x97, 0x7C,
-    0x50, 0x36, 0x59, 0x81, 0xCC, 0xAD, 0x48, 0xBE, 0xC3, 0x26, 0xB7, 0x1F, 0x67, 0xA2, 0x13, 0x75,
-    0x51, 0x7E, 0x0A, 0x66, 0xCD, 0x4E, 0x83, 0x00, 0xC2, 0xE1, 0x79, 0x2F, 0x18, 0x84, 0x6F, 0x0C,
-    0xA2, 0xF2, 0xF6, 0xA5, 0x17, 0x77, 0x99, 0xF0, 0x9E, 0x08, 0xD7, 0x81, 0x6F, 0x5C, 0xA4, 0xB8,
-    0x40, 0xE5, 0x7E, 0x96, 0x91, 0xC5, 0x01, 0x5B, 0xC2, 0x28, 0x1A, 0xDC, 0x93, 0xD2, 0x34, 0x6A,
-    0x54, 0xF6, 0xF2, 0x29, 0xEF, 0x62, 0x29, 0x4C, 0x2A, 0x5A, 0xD4, 0xE1, 0xE2, 0x42, 0xD0, 0xDF,
-    0xAF, 0xDB, 0x42, 0x6F, 0x80, 0x3D, 0xB5, 0xA2, 0xC9, 0x78, 0xA3, 0xB7, 0x99, 0x61, 0x6C, 0x5F,
-    0x4D, 0x83, 0xEC, 0xE7, 0xFE, 0x5F, 0x5B, 0x8B, 0x88, 0xB0, 0xA2, 0xBA, 0xF3, 0xC6, 0xF5, 0x7A,
-    0x0C, 0xEC, 0x5E, 0x0C, 0x5B, 0x04, 0x7F, 0x1D, 0x37, 0x1A, 0xF7, 0x1E, 0x55, 0x49, 0x77, 0x1A,
-    0x8E, 0xB7, 0x71, 0x91, 0xD0, 0x58, 0x9D, 0x00, 0x2F, 0x88, 0x3B, 0x8C, 0x79, 0x02, 0xA2, 0xA9,
-    0x2D, 0x96, 0x77, 0xCB, 0x74, 0x91, 0x7B, 0x17, 0x2C, 0xBE, 0xAC, 0xBF, 0x07, 0xA5, 0xE2, 0x3A,
-    0xF9, 0x68, 0x8A, 0xCF, 0xD5, 0xBD, 0x9A, 0xDE, 0xCA, 0x26, 0xA4, 0x71, 0xE4, 0xAC, 0x77, 0xC2,
-    0x6A, 0x94, 0x43, 0x6A, 0xA3, 0x44, 0x7B, 0xC4, 0x1D, 0x8D, 0x31, 0xA5, 0x56, 0x36, 0xC4, 0xC0,
-    0xDE, 0x1E, 0x8F, 0xC7, 0x6F, 0x8F, 0xC7, 0x17, 0xD5, 0x7A, 0x6F, 0x30, 0x26, 0xC8, 0xB0, 0x32,
-    0x8D, 0xFE, 0x9D, 0xB6, 0x5D, 0x88, 0xD2, 0x9D, 0xC5, 0xFD, 0x09, 0xCC, 0xE7, 0xA4, 0x5D, 0xC8,
-    0xE7, 0x96, 0xCD, 0x81, 0x69, 0x69, 0x45, 0x66, 0xBF, 0x84, 0xA8, 0xC9, 0x6F, 0x94, 0xE1, 0xD8,
-    0x98, 0x10, 0x15, 0x3B, 0xD5, 0xE9, 0xAE, 0x39, 0x72, 0xE4, 0x3A, 0xF6, 0x37, 0x0E, 0x9E, 0xFB,
-    0x21, 0x60, 0x6E, 0xB0, 0xA5, 0x8F, 0x35, 0xBC, 0x97, 0x4D, 0xBC, 0x80, 0x6A, 0xA8, 0xE9, 0x5A,
-    0xA7, 0x18, 0x03, 0x56, 0xF7, 0x00, 0xF5, 0xE3, 0xB0, 0x85, 0x51, 0xEF, 0xF7, 0x4D, 0x27, 0xDB,
-    0xA0, 0x4F, 0x1E, 0x79, 0xBC, 0xF6, 0x29, 0x69, 0x5E, 0x75, 0xA4, 0x99, 0xD6, 0xD5, 0x5A, 0xF5,
-    0x7B, 0xF2, 0xE4, 0x1C, 0x7C, 0x39, 0xB6, 0xB3, 0x27, 0xA8, 0x5F, 0xC6, 0xC3, 0x7A, 0x58, 0xBD,
-    0xF7, 0x67, 0x49, 0xE0, 0x56, 0x5E, 0x7C, 0xA4, 0xEC, 0x8C, 0x5E, 0xAA, 0x31, 0x47, 0x0C, 0x22,
-    0xCF, 0x61, 0xF5, 0xF2, 0xC0, 0xA6, 0xA0, 0x68, 0x52, 0x1E, 0x3D, 0x7B, 0x22, 0xD1, 0xE8, 0x31,
-    0x54, 0xFC, 0x1F, 0xB2, 0xA6, 0xA9, 0x09, 0x1E, 0xB0, 0x5D, 0xA9, 0xA6, 0x59, 0xF2, 0xBD, 0x18,
-    0x87, 0xCE, 0x61, 0x76, 0xD4, 0xAB, 0x30, 0xE6, 0x7B, 0x45, 0x33, 0xF9, 0x83, 0xE9, 0x25, 0x08,
-    0x8E, 0xEF, 0x90, 0x48, 0x0C, 0x0F, 0xDC, 0x50, 0x6A, 0xFC, 0x7B, 0xB6, 0x7C, 0xB2, 0x64, 0x72,
-    0x29, 0x24, 0xAE, 0x1E, 0xB1, 0x71, 0xA0, 0x8C, 0x81, 0x2B, 0x79, 0x89, 0x1F, 0x75, 0x32, 0xE4,
-    0x47, 0xA8, 0x91, 0xEC, 0x8D, 0xEE, 0x2F, 0x36, 0xA5, 0x66, 0xA1, 0x59, 0x2F, 0x85, 0xB7, 0x50,
-    0xA7, 0x6F, 0xE5, 0xD9, 0x70, 0xCE, 0xC6, 0x67, 0xBE, 0x5D, 0x28, 0x92, 0x05, 0xF5, 0xFF, 0xF8,
-    0xA0, 0xE5, 0xE4, 0x35, 0x49, 0xDA, 0x61, 0xFE, 0xF2, 0xE6, 0x1B, 0x49, 0x4F, 0xC7, 0x44, 0xBB,
-    0x9B, 0xF4, 0x09, 0xD3, 0x99, 0x5F, 0x8B, 0x87, 0x67, 0x28, 0x0F, 0xF4, 0xD1, 0xC0, 0x10, 0xB5,
-    0xFF, 0xDB, 0x85, 0xCC, 0xB3, 0x88, 0x3E, 0x6B, 0xC2, 0x25, 0x23, 0x99, 0x4C, 0x15, 0x6A, 0xD2,
-    0xAD, 0x61, 0x34, 0x15, 0x1B, 0x1A, 0x55, 0xA8, 0x01, 0x8A, 0x96, 0xC1, 0x4C, 0xFB, 0xDF, 0x53,
-    0x18, 0x25, 0xD2, 0xAB, 0x19, 0xAC, 0x8B, 0x76, 0x89, 0xED, 0x21, 0x2F, 0x64, 0xAE, 0x90, 0x2F,
-    0x0D, 0x73, 0x1F, 0x33, 0xB2, 0x85, 0xBA, 0x44, 0xAC, 0x4C, 0x41, 0x5F, 0xB2, 0xBE, 0x53, 0x6B,
-    0xD1, 0xDF, 0x41, 0x07, 0x45, 0x06, 0xD9, 0x43, 0xFF, 0x84, 0x5D, 0xEC, 0x82, 0xDA, 0x84, 0x4C,
-    0xAF, 0xC2, 0x79, 0x91, 0x30, 0x76, 0x2E, 0x5C, 0x7C, 0x63, 0x85, 0x54, 0xC9, 0x60, 0xB9, 0x5B,
-    0x43, 0x5D, 0xF3, 0x97, 0x7F, 0x52, 0x52, 0x62, 0x59, 0xBD, 0x93, 0x33, 0x7A, 0xAB, 0xEE, 0xF2,
-    0x95, 0x2A, 0x7E, 0x1A, 0x03, 0x97, 0xDB, 0x8D, 0x24, 0x2F, 0x38, 0x5F, 0x6A, 0x7F, 0x71, 0xDE,
-    0x17, 0xCF, 0xE5, 0x0C, 0xE8, 0x7A, 0x7F, 0x5A, 0x78, 0xF5, 0x45, 0x9A, 0xE1, 0x44, 0x86, 0x7E,
-    0x65, 0xF5, 0x6A, 0xEF, 0xED, 0x06, 0x78, 0xEA, 0x8B, 0x84, 0x9B, 0xDA, 0x3E, 0x43, 0x04, 0x03,
-    0xFA, 0x68, 0xE1, 0xE2, 0xA3, 0x9C, 0x97, 0x0C, 0x94, 0xE1, 0x97, 0x6B, 0x18, 0x90, 0x46, 0x29,
-    0xDF, 0xB9, 0xF6, 0xCA, 0xFE, 0x15, 0x4E, 0x77, 0x8D, 0xAD, 0xEB, 0x64, 0x9B, 0x86, 0x56, 0xC4,
-    0x24, 0xD8, 0x67, 0x7F, 0xA8, 0x8A, 0xE7, 0x2C, 0x19, 0x4D, 0x61, 0x7D, 0x67, 0x98, 0x93, 0xF3,
-    0x3F, 0x6B, 0x8E, 0x8F, 0xEE, 0xEE, 0x7A, 0x6C, 0x15, 0xF0, 0x1C, 0x1F, 0x5F, 0xA1, 0x72, 0x02,
-    0x5A, 0xD3, 0xF0, 0xFB, 0xFA, 0xB4, 0xFF, 0xC6, 0xA6, 0x54, 0x3D, 0xC7, 0xE4, 0xD9, 0xDC, 0x6E,
-    0xE8, 0x6B, 0x8F, 0xBD, 0x80, 0x23, 0x60, 0xD8, 0xB8, 0x60, 0xD9, 0xCD, 0xBA, 0x68, 0x65, 0x6F,
-    0x66, 0x2C, 0x5B, 0xAC, 0xAD, 0x2B, 0xFC, 0xB2, 0xF5, 0xDE, 0x7F, 0x13, 0x3E, 0x72, 0x0D, 0x85,
-    0xB4, 0xB9, 0xB1, 0x6B, 0xAC, 0xF1, 0x98, 0xF0, 0xFC, 0xDA, 0xAD, 0x8D, 0x93, 0x36, 0x61, 0xF7,
-    0xFB, 0x09, 0xA7, 0xFD, 0x26, 0x9E, 0xEE, 0xA7, 0xA1, 0xFE, 0xD6, 0x90, 0x66, 0xA6, 0x1C, 0x68,
-    0x0C, 0xEE, 0x13, 0x76, 0x19, 0xED, 0xA0, 0xBF, 0xF9, 0x10, 0xAC, 0x20, 0xA5, 0x26, 0xB4, 0x32,
-    0xD1, 0xC6, 0x5F, 0xCD, 0xDC, 0xF2, 0x94, 0xF7, 0x61, 0x42, 0x85, 0xEC, 0x7A, 0x5E, 0xAE, 0x33,
-    0x7F, 0x09, 0x76, 0x5F, 0x68, 0x6E, 0x73, 0x0D, 0xF7, 0x1A, 0x7D, 0xD6, 0x90, 0x3F, 0xF0, 0xB3,
-    0xD0, 0xF7, 0xB7, 0x81, 0x35, 0xDD, 0xAF, 0xB6, 0x6C, 0xB0, 0xB6, 0x4C, 0xD1, 0x25, 0xB4, 0xD7,
-    0xC7, 0xBA, 0x5D, 0x4F, 0xBF, 0x9F, 0xAE, 0x73, 0x9F, 0x53, 0xF2, 0xAD, 0x69, 0x2D, 0x00, 0x96,
-    0x75, 0x11, 0x31, 0x8C, 0xC0, 0x14, 0x07, 0x32, 0x17, 0x22, 0x71, 0x41, 0x2F, 0x96, 0x7E, 0xA5,
-    0xCE, 0x70, 0xB0, 0x3F, 0xB3, 0x88, 0x85, 0x36, 0x70, 0x74, 0x35, 0x8F, 0x5E, 0x4C, 0x74, 0xF6,
-    0xD3, 0x9C, 0x13, 0xB8, 0xA3, 0x4F, 0xDE, 0x75, 0x79, 0x89, 0x7C, 0xDE, 0xA0, 0xD3, 0xD2, 0xD3,
-    0x0A, 0x19, 0x74, 0x9A, 0x58, 0xA3, 0x91, 0x7E, 0x1A, 0x48, 0xE2, 0x25, 0xDF, 0xEF, 0x69, 0x2A,
-    0x8C, 0x7A, 0xE4, 0x25, 0x66, 0x51, 0x0F, 0x79, 0x7A, 0x2F, 0x62, 0x1C, 0xF9, 0x61, 0xD4, 0x63,
-    0xFA, 0xAE, 0x46, 0x36, 0x68, 0xBF, 0x17, 0x4A, 0xF7, 0xFB, 0xA8, 0x97, 0xBE, 0x87, 0x5D, 0x04,
-    0xE5, 0x3E, 0x6A, 0xA3, 0x5E, 0x96, 0x42, 0x22, 0x3F, 0xC9, 0x44, 0xD4, 0x2B, 0xF9, 0x9C, 0x48,
-    0x0D, 0x63, 0xA4, 0xE2, 0xD7, 0x3C, 0x7B, 0x3B, 0x6F, 0xD7, 0xDB, 0xCA, 0xAF, 0xD0, 0x1B, 0xFF,
-    0x7F, 0x53, 0x99, 0xF9, 0x09, 0xFB, 0xD2, 0x30, 0x45, 0x12, 0xB9, 0x27, 0x30, 0x5A, 0x6A, 0x8C,
-    0xBB, 0x7C, 0xEC, 0x42, 0x7D, 0x45, 0xE0, 0x6B, 0x25, 0x5E, 0xA6, 0x2F, 0x31, 0x74, 0x7D, 0x09,
-    0x97, 0x73, 0x5B, 0x62, 0xE5, 0x35, 0xA5, 0x10, 0x63, 0x5C, 0x95, 0xC2, 0xA8, 0xD2, 0xA6, 0x94,
-    0xB1, 0xAC, 0xBB, 0x32, 0x94, 0xC7, 0xF7, 0xA5, 0xEC, 0x41, 0x1A, 0xCF, 0xB3, 0x70, 0x44, 0xED,
-    0x6B, 0x74, 0x4F, 0xE1, 0x72, 0x3B, 0xCD, 0xB4, 0x3B, 0x01, 0xC4, 0xB5, 0x0B, 0x8B, 0x4E, 0xB2,
-    0xC6, 0xB6, 0x52, 0x0E, 0x24, 0x5A, 0x3B, 0x1C, 0x4B, 0xB4, 0x76, 0xE3, 0xDE, 0xB6, 0x0E, 0x39,
-    0xA2, 0x86, 0x39, 0x9F, 0x4B, 0xDB, 0xEA, 0x9D, 0xCA, 0x68, 0x93, 0xB6, 0xAC, 0x0D, 0x4B, 0xFF,
-    0x1A, 0xFD, 0xDD, 0x80, 0xF7, 0x42, 0xDE, 0xC4, 0x9F, 0xC1, 0x25, 0xC4, 0x56, 0x38, 0xD8, 0x84,
-    0x97, 0x4C, 0xCD, 0xCB, 0xD2, 0xDA, 0x0B, 0x91, 0x25, 0xC1, 0xDC, 0xCD, 0x70, 0xB0, 0x81, 0x76,
-    0x57, 0xC3, 0x41, 0xED, 0x0D, 0xF2, 0xB0, 0x41, 0xB3, 0x21, 0xFD, 0x3E, 0x1C, 0x34, 0x9A, 0x33,
-    0xEC, 0xA9, 0x1C, 0xCB, 0xBB, 0xC5, 0xF8, 0x1D, 0x32, 0x07, 0x3E, 0x2C, 0xC7, 0x70, 0x38, 0x8F,
-    0xAD, 0x6F, 0x55, 0x1B, 0x79, 0xC6, 0xDA, 0x14, 0x05, 0x02, 0xC3, 0x3B, 0x80, 0xF0, 0x99, 0x32,
-    0x8F, 0x05, 0xBE, 0x54, 0x46, 0xB2, 0xBB, 0x52, 0x7C, 0x58, 0x2B, 0x1E, 0x72, 0xC5, 0x3D, 0xC3,
-    0x52, 0x84, 0x7A, 0x52, 0x6A, 0x98, 0x21, 0x9C, 0x73, 0x2E, 0xF9, 0x05, 0x4C, 0xE7, 0xCA, 0xC7,
-    0xB0, 0x91, 0x78, 0xCF, 0xA4, 0x7F, 0x47, 0xF6, 0xB3, 0x97, 0xFE, 0x2D, 0x8C, 0xAD, 0x42, 0x88,
-    0x0D, 0x19, 0xD1, 0xBB, 0x69, 0x43, 0xC6, 0xD3, 0xCB, 0x1C, 0xC9, 0xC2, 0x0A, 0x04, 0x23, 0xDA,
-    0x27, 0x04, 0x6E, 0x9F, 0x33, 0xD9, 0x22, 0x6D, 0xE0, 0x2E, 0xC9, 0x97, 0xE9, 0x8F, 0xA4, 0x73,
-    0xAE, 0x54, 0x84, 0xC3, 0xA2, 0xDA, 0x1F, 0xD7, 0x8D, 0x12, 0x51, 0x66, 0xF5, 0xDE, 0xCB, 0x56,
-    0x0A, 0x5D, 0xA8, 0x44, 0xAF, 0x36, 0x8D, 0xDA, 0x5A, 0x04, 0xF3, 0x86, 0x19, 0x42, 0xC2, 0x77,
-    0x34, 0x97, 0x2E, 0x1E, 0x16, 0x36, 0xA5, 0xB7, 0xB7, 0x41, 0x54, 0x63, 0x65, 0x13, 0xEB, 0x18,
-    0xDF, 0x3B, 0xE4, 0x7F, 0xC6, 0x62, 0x21, 0x9D, 0xBA, 0xEE, 0x61, 0x52, 0x71, 0xAE, 0x7B, 0x0D,
-    0x87, 0xB3, 0x2E, 0x7C, 0xD9, 0x81, 0x74, 0xAE, 0x44, 0x3C, 0x83, 0x51, 0x42, 0x5D, 0xF9, 0x30,
-    0xF9, 0xAD, 0x5D, 0xFA, 0x0B, 0xEB, 0xD2, 0x87, 0x3B, 0x35, 0x36, 0x37, 0x02, 0x73, 0x84, 0x8C,
-    0x41, 0x11, 0x44, 0xBA, 0xB5, 0xE0, 0xA6, 0xB9, 0x1B, 0x56, 0x24, 0xA9, 0x28, 0x47, 0xCB, 0xB8,
-    0x32, 0x79, 0xB0, 0xE7, 0x1B, 0x06, 0x4B, 0xCD, 0x53, 0x1E, 0x55, 0x71, 0xCC, 0xBF, 0xCF, 0xD7,
-    0x3A, 0xF8, 0xE4, 0x48, 0x9D, 0x1F, 0x74, 0x03, 0xFD, 0xCB, 0x0A, 0x06, 0xD1, 0xF2, 0xA5, 0x25,
-    0x28, 0xB3, 0xF6, 0x97, 0x98, 0xD2, 0xD1, 0x87, 0x19, 0x25, 0x58, 0x52, 0x5E, 0x0E, 0x05, 0x05,
-    0x30, 0x50, 0xCA, 0xDD, 0x46, 0xB5, 0xC3, 0xD5, 0xB2, 0x3C, 0x44, 0x35, 0xCE, 0x3B, 0x53, 0xE4,
-    0xA6, 0x3D, 0xDF, 0x97, 0x36, 0xE9, 0x52, 0xD8, 0x96, 0x46, 0x2B, 0xDB, 0xF4, 0xDC, 0x82, 0x63,
-    0x7E, 0xA5, 0x99, 0xF2, 0xB1, 0x52, 0x4B, 0xB6, 0xF2, 0x8C, 0xD7, 0x6D, 0xD9, 0x89, 0x85, 0xCB,
-    0xCD, 0x9A, 0xC6, 0xDF, 0xAC, 0xA7, 0xC0, 0xAC, 0x67, 0x81, 0x2B, 0x4A, 0x27, 0xC2, 0x50, 0xDA,
-    0x74, 0x85, 0x2B, 0x64, 0x93, 0xEA, 0xBD, 0xF5, 0x62, 0x39, 0x5A, 0xAF, 0x16, 0x4D, 0xCC, 0xC2,
-    0xBC, 0x7C, 0xCF, 0x9A, 0x03, 0xDD, 0xD4, 0x30, 0xA5, 0x57, 0x66, 0xA5, 0xB0, 0xE1, 0x9B, 0x39,
-    0x03, 0x9E, 0xCC, 0x7A, 0x8E, 0x8C, 0x8D, 0xB4, 0x68, 0xED, 0x26, 0xC7, 0x99, 0xD2, 0x2C, 0x62,
-    0x4E, 0x92, 0x06, 0x9D, 0xE5, 0x95, 0xAE, 0x2A, 0x37, 0x65, 0x58, 0x38, 0xD0, 0xD1, 0xC2, 0x15,
-    0xF3, 0x6D, 0xFA, 0x27, 0xCC, 0x0D, 0x1F, 0x11, 0xB1, 0x2B, 0xCC, 0x9D, 0x99, 0xCD, 0x1D, 0x16,
-    0x4F, 0x4E, 0x87, 0xB1, 0xAC, 0x9E, 0xDC, 0x16, 0xDA, 0x28, 0x52, 0xDA, 0xB1, 0x75, 0xE3, 0x08,
-    0x98, 0x0D, 0x27, 0x43, 0x1E, 0x37, 0x76, 0xB7, 0x4D, 0x75, 0x09, 0xE5, 0xD5, 0x65, 0x6D, 0x24,
-    0xED, 0xA0, 0x8D, 0xE8, 0xB3, 0xCE, 0x6D, 0x1F, 0xCC, 0x9A, 0x3B, 0xBE, 0x32, 0xD6, 0xAC, 0xB6,
-    0x20, 0xE3, 0x55, 0xD2, 0xD8, 0x28, 0x63, 0x5F, 0xD2, 0x6D, 0x21, 0x9F, 0x2E, 0x75, 0xD7, 0x2D,
-    0x8B, 0x52, 0x37, 0x29, 0x23, 0xE2, 0x18, 0x16, 0x93, 0x90, 0x21, 0x83, 0xAD, 0x0C, 0xE6, 0x57,
-    0x46, 0xE7, 0x39, 0x93, 0x2E, 0x62, 0xD3, 0x25, 0x58, 0x4F, 0x6D, 0x62, 0xE0, 0x0D, 0xEB, 0xB0,
-    0x5C, 0xAE, 0x61, 0x97, 0xCC, 0x62, 0x04, 0xB6, 0x7D, 0x62, 0x77, 0x13, 0xBA, 0xA2, 0x62, 0x53,
-    0xCB, 0x80, 0x88, 0xA6, 0x57, 0xC8, 0xDD, 0x72, 0xAC, 0xD3, 0xAC, 0x7D, 0xDF, 0xAE, 0x1D, 0x6E,
-    0xDC, 0xE4, 0x81, 0x64, 0x89, 0x36, 0xB8, 0x8C, 0xC1, 0x72, 0x1E, 0xF2, 0x5F, 0x05, 0x5C, 0x9F,
-    0x72, 0xE4, 0xE9, 0x8C, 0xE2, 0x16, 0x9E, 0x4C, 0xA9, 0x9C, 0x33, 0xD0, 0xBB, 0x3C, 0x92, 0x92,
-    0xE9, 0x00, 0x85, 0x48, 0x4A, 0xB2, 0x56, 0x10, 0xDE, 0x95, 0x5F, 0xDF, 0xC8, 0x51, 0x91, 0xD6,
-    0x41, 0x97, 0xB7, 0xE7, 0xCD, 0x80, 0x0C, 0x79, 0x91, 0x3F, 0x6E, 0xBC, 0x44, 0xDE, 0x75, 0x74,
-    0xAE, 0x40, 0xFE, 0x72, 0x87, 0xDB, 0x2D, 0x2E, 0xC8, 0x46, 0xFE, 0x3A, 0x74, 0x15, 0x24, 0xF3,
-    0x31, 0x04, 0x20, 0xFD, 0xF4, 0xA0, 0xB5, 0x36, 0x53, 0x10, 0x67, 0x06, 0xE0, 0xAB, 0xA6, 0x1A,
-    0xB1, 0x3F, 0xD2, 0xB3, 0x63, 0x04, 0xCA, 0x70, 0x53, 0xD8, 0xAF, 0x5B, 0xE7, 0x98, 0x0B, 0xD6,
-    0x46, 0xB6, 0xD5, 0x64, 0x64, 0x5B, 0xDA, 0x2E, 0xFF, 0xA1, 0x69, 0x35, 0x4B, 0x35, 0xFF, 0xA9,
-    0xD3, 0x21, 0x57, 0x0A, 0xCE, 0xC9, 0x7A, 0x79, 0xA9, 0x36, 0x1A, 0x1A, 0xE6, 0x1F, 0x17, 0xA9,
-    0x15, 0x9F, 0x56, 0xC8, 0x58, 0x30, 0x0B, 0x87, 0x43, 0x46, 0xF3, 0x18, 0x88, 0xCD, 0x49, 0xAB,
-    0xB2, 0x53, 0xD2, 0xAA, 0x32, 0x78, 0x4F, 0x18, 0x4B, 0xB8, 0x55, 0x0D, 0x52, 0xB1, 0x88, 0x43,
-    0x6D, 0xC0, 0x58, 0x44, 0xC6, 0x09, 0x40, 0x43, 0x60, 0x16, 0x5D, 0xB2, 0x48, 0x5A, 0x0D, 0xA6,
-    0xB1, 0xC9, 0xC2, 0x5F, 0xAF, 0xC7, 0xA3, 0x79, 0xDD, 0x8E, 0x5B, 0x63, 0x4B, 0xE6, 0x36, 0xBD,
-    0xF7, 0x9C, 0x72, 0x49, 0x30, 0x1C, 0x55, 0x97, 0xBF, 0x36, 0xD3, 0xF5, 0xEE, 0x0E, 0x16, 0xE5,
-    0x88, 0xCD, 0xEC, 0x39, 0x81, 0xD1, 0x52, 0x08, 0x75, 0x2F, 0x80, 0x71, 0x7C, 0x4F, 0xC6, 0x11,
-    0x30, 0x27, 0xCC, 0x08, 0xD3, 0x19, 0x4C, 0x66, 0x50, 0x7F, 0xF3, 0x0C, 0xE1, 0x0E, 0xE1, 0x2E,
-    0x53, 0x53, 0x0F, 0xE5, 0xBD, 0xF7, 0x90, 0x04, 0xD8, 0xEE, 0x09, 0xEF, 0x49, 0x6F, 0xEC, 0x1D,
-    0x34, 0x9A, 0x8A, 0x8C, 0x05, 0x05, 0x7A, 0xF2, 0x2F, 0xDF, 0x73, 0x6F, 0xBD, 0xD3, 0x32, 0xEC,
-    0x2A, 0x6B, 0x37, 0x2A, 0xC9, 0x32, 0xD2, 0x36, 0xD1, 0x0C, 0xBB, 0xD6, 0xD3, 0xA8, 0x8E, 0x75,
-    0x86, 0x5D, 0xA5, 0x19, 0x76, 0x08, 0xBE, 0x35, 0x07, 0x30, 0x77, 0x40, 0x07, 0x88, 0x46, 0x68,
-    0xE9, 0x66, 0x84, 0xB2, 0x75, 0x13, 0xB9, 0x75, 0x67, 0x5D, 0x6E, 0x9D, 0x5E, 0x3F, 0xCF, 0xB0,
-    0x63, 0xD6, 0xDE, 0xA0, 0x19, 0x76, 0xCC, 0xE6, 0x6B, 0x99, 0x61, 0x07, 0xEB, 0x3E, 0xAC, 0x2E,
-    0xF9, 0x58, 0x6F, 0x66, 0xD8, 0xA9, 0x79, 0xBC, 0x16, 0x02, 0x0D, 0xC7, 0x2B, 0xF0, 0x7C, 0x23,
-    0x36, 0x86, 0x41, 0x97, 0x08, 0x1F, 0x2D, 0xB1, 0xA7, 0xD4, 0xB8, 0x0B, 0x38, 0x69, 0x6B, 0xCC,
-    0x51, 0xD2, 0x49, 0x47, 0xEA, 0x0E, 0x16, 0xA8, 0x6E, 0xF4, 0xCE, 0xCA, 0x8F, 0xF8, 0x03, 0x2F,
-    0x29, 0x3D, 0xB5, 0xA5, 0x73, 0x7F, 0x2B, 0x61, 0xBC, 0x1A, 0xF5, 0xA6, 0x50, 0x04, 0xF4, 0x41,
-    0xDC, 0xE9, 0xB3, 0x56, 0x9D, 0x22, 0x3D, 0xA4, 0xCF, 0xC0, 0xB0, 0xC6, 0x45, 0xD8, 0x5F, 0x84,
-    0x0A, 0x09, 0xDD, 0x74, 0x54, 0x4D, 0xDA, 0xA8, 0x89, 0x40, 0xDE, 0x33, 0x55, 0xA6, 0xB1, 0xA3,
-    0x26, 0xDA, 0x3D, 0xD5, 0xBD, 0x0F, 0x95, 0xD4, 0xAE, 0xEA, 0x0A, 0x1B, 0x74, 0x19, 0x52, 0x49,
-    0x75, 0x99, 0x3C, 0x41, 0xCB, 0xC5, 0xA8, 0x3E, 0xBC, 0x51, 0x8D, 0x35, 0xB5, 0x1A, 0xB3, 0xCB,
-    0x3F, 0xD0, 0xDC, 0xA8, 0xBF, 0x50, 0x4A, 0xFD, 0x5F, 0x2A, 0xFD, 0xFE, 0x1F, 0xA5, 0x5F, 0x9B,
-    0xBC, 0xB2, 0xD8, 0x88, 0x26, 0x70, 0x32, 0xA8, 0x5F, 0xC0, 0xF7, 0x97, 0xF5, 0x07, 0xF2, 0x46,
-    0xF5, 0x20, 0xEC, 0xDE, 0x5F, 0xBC, 0x03, 0xCD, 0xAE, 0xA3, 0x12, 0x47, 0x47, 0x9C, 0x66, 0x80,
-    0x31, 0x01, 0x4C, 0x6D, 0x31, 0x45, 0xC2, 0x9E, 0xEF, 0x90, 0x01, 0x32, 0x07, 0xAC, 0xDB, 0x65,
-    0xB7, 0xA9, 0x5C, 0xF7, 0xEF, 0xB2, 0xD3, 0x8C, 0x02, 0xA4, 0x96, 0xED, 0xAF, 0xB8, 0x92, 0x74,
-    0xB9, 0x58, 0xDF, 0x3C, 0x7A, 0xFD, 0x6C, 0x45, 0x4D, 0x30, 0x6D, 0x6B, 0x4D, 0x1F, 0xE0, 0x2F,
-    0x83, 0x85, 0x5A, 0x20, 0xAE, 0x69, 0xEE, 0x57, 0xA6, 0xBE, 0xEE, 0xB3, 0x33, 0x1B, 0xDA, 0x63,
-    0x3D, 0xE4, 0xC1, 0x5B, 0x5F, 0x07, 0x85, 0x53, 0x3A, 0xF1, 0x56, 0xE4, 0xC0, 0xB9, 0xAF, 0xD9,
-    0x54, 0xEF, 0xE1, 0xD2, 0x96, 0x96, 0xB8, 0xC2, 0xDF, 0xF0, 0xF7, 0x7C, 0x79, 0x53, 0x34, 0xFF,
-    0x3A, 0x37, 0x8B, 0xB7, 0xCF, 0xA7, 0xF8, 0x08, 0x6C, 0xF4, 0xB1, 0x13, 0xA2, 0xB5, 0x22, 0x96,
-    0x37, 0x55, 0x82, 0x72, 0x29, 0x99, 0x8C, 0x0F, 0xA9, 0xD6, 0x09, 0x79, 0x2E, 0xC9, 0x8D, 0x0E,
-    0x8A, 0xFF, 0x49, 0xEB, 0x2F, 0xFF, 0x9E, 0xFE, 0xA2, 0x16, 0x91, 0x70, 0x64, 0x50, 0x3A, 0x0B,
-    0x1A, 0x84, 0xCC, 0x7A, 0xD0, 0xDC, 0x5A, 0x21, 0x08, 0x53, 0x58, 0x2E, 0x80, 0xB2, 0x14, 0x6C,
-    0x8B, 0x5C, 0x17, 0x4F, 0xED, 0x25, 0xDE, 0x5D, 0xDB, 0x70, 0xE2, 0x78, 0xB6, 0x2D, 0xD4, 0xB0,
-    0xE3, 0xD9, 0xFB, 0x40, 0x0A, 0xF7, 0xEC, 0xFD, 0x65, 0x94, 0x0E, 0xB5, 0x5F, 0xD2, 0xBF, 0xAC,
-    0xB9, 0x6A, 0xFB, 0xD3, 0x0A, 0x45, 0x0E, 0x53, 0x3F, 0x93, 0x5F, 0x68, 0xE8, 0x3D, 0xC6, 0x23,
-    0xFA, 0xD7, 0x4E, 0xDF, 0x4B, 0x08, 0x36, 0xFC, 0xAC, 0xA1, 0xB4, 0x87, 0x3D, 0x87, 0xA6, 0x23,
-    0x5F, 0xD3, 0x59, 0x35, 0x5B, 0xA0, 0xBC, 0xC9, 0xF1, 0xA9, 0xB5, 0x3C, 0x05, 0xD5, 0xAA, 0xD7,
-    0xD5, 0x15, 0x5B, 0x68, 0xB5, 0x8B, 0xF5, 0xD7, 0xB5, 0x59, 0x7B, 0xB1, 0x6E, 0xCE, 0x7D, 0x23,
-    0xD1, 0x5A, 0xD0, 0x5A, 0x7B, 0xF9, 0x21, 0xA7, 0xCC, 0xCC, 0x13, 0xAB, 0x99, 0x21, 0xF1, 0x68,
-    0xED, 0x26, 0xB4, 0x46, 0x90, 0x96, 0xA1, 0x0D, 0x0D, 0x98, 0xD7, 0x81, 0xA9, 0xCE, 0x8B, 0xFC,
-    0xD6, 0xF9, 0x63, 0x4C, 0x83, 0x20, 0x58, 0x9B, 0xAA, 0x0C, 0x60, 0x90, 0xDF, 0x5B, 0xC2, 0x40,
-    0x0A, 0xC6, 0xF7, 0xA3, 0x15, 0x28, 0xCC, 0xB2, 0xCA, 0x90, 0xA5, 0x62, 0x64, 0x07, 0xC5, 0xC8,
-    0x8F, 0xAC, 0x10, 0x88, 0x30, 0x60, 0xB6, 0x58, 0xA4, 0x83, 0xAD, 0xA4, 0x4D, 0x75, 0xCD, 0x75,
-    0x49, 0xAF, 0x85, 0x49, 0x12, 0x51, 0x82, 0x77, 0x3D, 0xBD, 0x4B, 0x88, 0x52, 0x27, 0x64, 0xA9,
-    0xFE, 0x72, 0xE0, 0x78, 0xCA, 0xFF, 0x15, 0x63, 0x5D, 0xE9, 0x61, 0x61, 0xB5, 0x3C, 0xB2, 0xF4,
-    0xD6, 0xB3, 0x6C, 0x56, 0xD3, 0x74, 0xC1, 0x6B, 0xD3, 0xCA, 0xBD, 0x51, 0x3A, 0xBD, 0xF4, 0xDA,
-    0xCF, 0x73, 0x61, 0x6A, 0x2D, 0xB7, 0xAA, 0x16, 0x39, 0x31, 0x47, 0x15, 0x9C, 0x76, 0xF2, 0x09,
-    0xB9, 0x9B, 0x64, 0x9B, 0xD5, 0x23, 0x6C, 0x64, 0x52, 0x32, 0x0F, 0x49, 0x4A, 0x35, 0x65, 0xB4,
-    0xFE, 0xE7, 0x95, 0x2C, 0x8C, 0x60, 0x0C, 0xAE, 0xA7, 0x5A, 0xCF, 0x20, 0x64, 0x5A, 0x3D, 0x08,
-    0x3E, 0x53, 0x75, 0x98, 0xBD, 0xAD, 0x6D, 0xA7, 0x2B, 0x5B, 0xE7, 0xB1, 0x56, 0x2F, 0xB3, 0xB9,
-    0x33, 0xB2, 0x57, 0xDA, 0xCF, 0x95, 0x7A, 0x17, 0xBD, 0x67, 0x61, 0x9F, 0x80, 0xE7, 0x41, 0xB1,
-    0x1F, 0xEC, 0x52, 0xF3, 0x8F, 0x48, 0x8D, 0x7F, 0xBE, 0x64, 0x5C, 0xB9, 0xAA, 0xD6, 0x36, 0xDF,
-    0x64, 0xCA, 0xAB, 0x5D, 0x9C, 0xA8, 0xBA, 0xF6, 0xBE, 0x4B, 0x9D, 0x2E, 0xCD, 0x82, 0xF2, 0x50,
-    0x91, 0x0C, 0x63, 0x0A, 0x1D, 0x56, 0xF6, 0x6E, 0x44, 0x13, 0x96, 0x10, 0xFC, 0x40, 0xBB, 0x2B,
-    0x86, 0x18, 0x50, 0xC3, 0x18, 0x27, 0x60, 0x1C, 0x18, 0x79, 0x89, 0x88, 0xC7, 0xBE, 0x86, 0x6A,
-    0xA6, 0xC8, 0x33, 0x88, 0x07, 0x93, 0x76, 0x8C, 0x81, 0x90, 0x51, 0x5E, 0xB8, 0x1C, 0xED, 0xF7,
-    0xD7, 0x4F, 0xFF, 0x0F, 0xB6, 0x27, 0xBE, 0x63, 0x27, 0xA2, 0x6F, 0xFE, 0x52, 0xBB, 0x5A, 0x1D,
-    0x28, 0xC3, 0x88, 0xFD, 0xFF, 0x56, 0x7B, 0x73, 0xE3, 0xCE, 0x3A, 0xE7, 0xD2, 0xF3, 0x5E, 0x74,
-    0x8D, 0x77, 0xDC, 0xFC, 0xBA, 0x59, 0xDD, 0x76, 0x05, 0xC4, 0x48, 0xA9, 0x59, 0xA8, 0x65, 0x9D,
-    0xB2, 0x70, 0xB0, 0x8C, 0x16, 0x09, 0x02, 0x6A, 0x91, 0x73, 0x20, 0xA4, 0xC9, 0xC0, 0x9A, 0x45,
-    0x0C, 0xAD, 0x54, 0x5E, 0xFE, 0xA2, 0x4F, 0x23, 0x6E, 0x63, 0xAB, 0x63, 0xD9, 0x86, 0x71, 0x8C,
-    0xCB, 0x96, 0x1D, 0xB1, 0x09, 0x54, 0xDA, 0x70, 0xF1, 0x21, 0xD5, 0xDD, 0x34, 0xEA, 0xA9, 0xE1,
-    0xEE, 0xE3, 0xEE, 0x5C, 0x94, 0xEE, 0x59, 0xFA, 0x50, 0x5F, 0x6D, 0x7E, 0x15, 0xEC, 0x95, 0x29,
-    0x19, 0x1F, 0x42, 0xE2, 0x69, 0x3F, 0x87, 0x09, 0x1D, 0x11, 0x23, 0x55, 0x09, 0xF6, 0x6A, 0x56,
-    0x99, 0x2D, 0x96, 0xD5, 0x05, 0xEA, 0x0E, 0x79, 0xD9, 0x45, 0x51, 0xA8, 0x72, 0x66, 0x2D, 0x7C,
-    0xE1, 0x07, 0x0C, 0x55, 0x0E, 0xAB, 0x88, 0x85, 0x3F, 0xFD, 0xE5, 0xD3, 0xB3, 0xEC, 0x4F, 0xC7,
-    0x8D, 0x6C, 0xE6, 0xAA, 0x46, 0x95, 0x85, 0xD5, 0xC9, 0x0A, 0xBA, 0x22, 0x5D, 0x41, 0xC0, 0xAA,
-    0x47, 0xF8, 0x92, 0xC3, 0xD5, 0xC1, 0x9F, 0xDD, 0xA8, 0x8B, 0xB8, 0x4F, 0x7E, 0xDC, 0x25, 0x22,
-    0x63, 0xC7, 0x3F, 0x6E, 0x63, 0x21, 0xA1, 0x73, 0x7E, 0xA5, 0x06, 0x32, 0x59, 0x4A, 0xDC, 0x41,
-    0x18, 0xDF, 0x7B, 0xB7, 0x48, 0x3F, 0xC7, 0x8F, 0x47, 0xBD, 0xC8, 0xDF, 0xDF, 0xD4, 0x88, 0xDF,
-    0x5D, 0xC6, 0xFC, 0xFA, 0x86, 0x75, 0x15, 0xAE, 0x98, 0x5F, 0x43, 0xC7, 0x35, 0xBF, 0x4B, 0xEA,
-    0xBA, 0xA8, 0xAF, 0xEB, 0x5B, 0xF5, 0x98, 0xBA, 0xB2, 0xAE, 0xE1, 0x77, 0x12, 0x9B, 0x5E, 0xF8,
-    0xCD, 0xB3, 0x73, 0x2F, 0xCB, 0xBF, 0x71, 0x27, 0xC6, 0xFE, 0xFE, 0xFE, 0xCB, 0xD6, 0x3A, 0xCB,
-    0x9F, 0xF7, 0x5E, 0xFD, 0x19, 0x5D, 0x5B, 0x2F, 0x86, 0xC5, 0x7F, 0xF4, 0x6E, 0xF1, 0xF5, 0x18,
-    0x38, 0x3D, 0x4E, 0x2B, 0xFB, 0xB0, 0x9A, 0xCA, 0x3E, 0xC8, 0x03, 0xDE, 0x03, 0x07, 0xFD, 0xA3,
-    0x75, 0x50, 0xC5, 0x5A, 0xAF, 0x36, 0xB7, 0x02, 0xF5, 0x29, 0x65, 0x1F, 0xB2, 0xA9, 0xEC, 0x03,
-    0xF7, 0x7A, 0x6B, 0x30, 0x45, 0x5A, 0x00, 0x32, 0xBC, 0xA1, 0x1B, 0x62, 0x9D, 0xDC, 0x36, 0x64,
-    0x99, 0x2E, 0x0F, 0x58, 0xE1, 0x91, 0x05, 0xCF, 0x74, 0x32, 0xE9, 0x76, 0x34, 0x1E, 0x0C, 0x32,
-    0x36, 0x4B, 0xC4, 0x7E, 0xCB, 0xB0, 0x2E, 0x4A, 0xCF, 0x3F, 0xAA, 0x67, 0x21, 0x5E, 0xE3, 0x46,
-    0x08, 0x98, 0x0A, 0x16, 0xB0, 0xF6, 0x30, 0x77, 0x0D, 0xB6, 0x8B, 0x1B, 0xBE, 0x90, 0x15, 0x92,
-    0x91, 0x51, 0xED, 0x08, 0x2F, 0x97, 0xDF, 0xE1, 0xDB, 0xF3, 0xA7, 0x02, 0x0B, 0xB1, 0x08, 0x92,
-    0x30, 0xB3, 0xC5, 0x1D, 0x2A, 0x54, 0xAD, 0xCA, 0xA9, 0x4A, 0xB0, 0x9A, 0xC4, 0x0B, 0x70, 0x52,
-    0xA4, 0x4A, 0xFC, 0x18, 0xE1, 0x63, 0xC5, 0x7B, 0x5F, 0x95, 0xB9, 0xFF, 0x4A, 0xDE, 0xCA, 0x15,
-    0xE9, 0xE8, 0xEA, 0xE1, 0xA0, 0x22, 0x10, 0xE2, 0x4C, 0xD0, 0x25, 0x94, 0xF3, 0x28, 0x63, 0xDA,
-    0xC1, 0xDE, 0xD1, 0x6D, 0x58, 0x95, 0x8D, 0x37, 0x67, 0xC2, 0x0D, 0x8A, 0x5C, 0xF5, 0xA5, 0x26,
-    0x14, 0xC3, 0xAC, 0x02, 0x47, 0x82, 0x72, 0xAF, 0xF3, 0xA6, 0x78, 0x15, 0xF1, 0xB7, 0xA3, 0xDF,
-    0xC9, 0xAB, 0xF4, 0xAE, 0xC8, 0x77, 0xDE, 0x5C, 0x10, 0xBA, 0x49, 0x0B, 0x8D, 0x5B, 0xCC, 0x8A,
-    0xBC, 0x11, 0xB6, 0xDD, 0xA4, 0x05, 0x76, 0x83, 0x18, 0x76, 0x08, 0xD1, 0x6E, 0x2F, 0x1F, 0x98,
-    0xEE, 0x1D, 0xBF, 0xEE, 0x2F, 0x82, 0x2D, 0x6C, 0x6F, 0xEE, 0x66, 0x2D, 0x20, 0x05, 0x63, 0xBD,
-    0xDE, 0xF0, 0x9B, 0x75, 0x34, 0x50, 0x58, 0x9C, 0xC6, 0xF5, 0x66, 0x5F, 0x36, 0x05, 0x96, 0x4C,
-    0x34, 0x51, 0x2B, 0x3E, 0xAA, 0x32, 0x7B, 0xE9, 0x0F, 0x48, 0x93, 0x17, 0xFE, 0xB0, 0x07, 0x17,
-    0xDD, 0xD5, 0x0A, 0x6E, 0x2C, 0xDB, 0x4A, 0xDB, 0xC0, 0x37, 0xBD, 0x6F, 0x79, 0xF7, 0xED, 0xEB,
-    0x3F, 0xBB, 0xC6, 0x1F, 0xCB, 0xAC, 0x58, 0x59, 0x30, 0x32, 0x6D, 0xEA, 0x9C, 0x0A, 0x89, 0x19,
-    0xF6, 0x9C, 0x1C, 0xB9, 0xE3, 0x5D, 0xDB, 0x5D, 0xD7, 0x25, 0xD8, 0xF5, 0x1E, 0xC8, 0xD7, 0x1F,
-    0xEB, 0xDA, 0xFB, 0x21, 0xFB, 0xA1, 0x92, 0x07, 0xFA, 0x95, 0x28, 0x1B, 0xA6, 0xB3, 0x63, 0x47,
-    0x85, 0xDC, 0x5D, 0x2D, 0x6D, 0xBB, 0xAB, 0x51, 0xCB, 0xAF, 0xDD, 0xFE, 0xB6, 0xD9, 0x30, 0x9B,
-    0xBB, 0x71, 0x3D, 0x05, 0x37, 0x4F, 0x9F, 0xBB, 0xA0, 0x08, 0xD6, 0x73, 0xE7, 0xCF, 0xF8, 0x7D,
-    0xD8, 0xCE, 0xE4, 0xE8, 0xB5, 0xEC, 0x6C, 0xFD, 0xDC, 0x27, 0x64, 0x6A, 0x54, 0xAC, 0xD3, 0x2F,
-    0xC4, 0x8D, 0x15, 0xEB, 0xDC, 0xF5, 0x72, 0x26, 0x61, 0x96, 0xCE, 0xC3, 0xFF, 0x9E, 0x55, 0x8C,
-    0x0A, 0x97, 0xF3, 0xE9, 0xE5, 0xCB, 0x29, 0xF4, 0x3C, 0x50, 0x15, 0x49, 0x9D, 0x4E, 0x66, 0xF6,
-    0xD0, 0xFF, 0xE4, 0x6D, 0x39, 0xD4, 0xBF, 0xC0, 0xD7, 0xB7, 0x66, 0x8D, 0xF2, 0x03, 0x27, 0x18,
-    0x1F, 0xA1, 0x7E, 0x95, 0x6D, 0x8F, 0xD2, 0xBF, 0x29, 0xD8, 0xB7, 0x9D, 0x0A, 0x06, 0xFB, 0x10,
-    0x86, 0x27, 0xA1, 0xB0, 0xB8, 0xDF, 0x54, 0xF1, 0x8D, 0x69, 0x9D, 0xBB, 0x91, 0xD1, 0x6C, 0x86,
-    0x92, 0x4F, 0xD2, 0xE2, 0x2C, 0xBA, 0xCF, 0xEB, 0x9A, 0x4A, 0x5C, 0xD9, 0x72, 0xA4, 0x9E, 0x32,
-    0x4A, 0xA2, 0xE0, 0x2F, 0x27, 0x35, 0x08, 0x73, 0x34, 0xCC, 0xE6, 0xE8, 0x8F, 0x4E, 0x28, 0x01,
-    0x9B, 0xED, 0xBD, 0x59, 0xFB, 0xF0, 0x76, 0x3D, 0x3D, 0xB4, 0xC1, 0x1A, 0x4B, 0x3B, 0xDD, 0xA3,
-    0xED, 0x63, 0xF9, 0xF1, 0x68, 0xA5, 0xC8, 0xEB, 0xA7, 0x7C, 0xCA, 0x16, 0x97, 0x9B, 0xB0, 0xAB,
-    0x32, 0xE7, 0xCA, 0xCC, 0x4D, 0x5C, 0xDA, 0xAC, 0xBF, 0x5D, 0x2D, 0xB5, 0xD8, 0x99, 0xEC, 0xED,
-    0xDF, 0xAF, 0x29, 0x66, 0xB5, 0x39, 0x57, 0x6E, 0xCE, 0xD5, 0x9B, 0x73, 0x05, 0xE7, 0x5C, 0xC5,
-    0x39, 0x57, 0x72, 0xCE, 0xD5, 0x9C, 0x73, 0x45, 0xE7, 0x5C, 0xD5, 0x39, 0x57, 0x76, 0xCE, 0xD5,
-    0x9D, 0x73, 0x85, 0xE7, 0x36, 0xFA, 0x53, 0x17, 0x9E, 0xAD, 0x3D, 0xE7, 0x69, 0xF1, 0xB9, 0x9B,
-    0x85, 0xAD, 0x3E, 0x67, 0x89, 0x3F, 0xB6, 0xF4, 0x90, 0xB8, 0x01, 0xDF, 0xD2, 0xB3, 0x2E, 0x6F,
-    0xE9, 0xAE, 0x56, 0x38, 0xF7, 0xA7, 0x35, 0xFB, 0xA8, 0xA7, 0x32, 0x2E, 0x66, 0x21, 0x46, 0xAF,
-    0xCD, 0xC4, 0xDE, 0x7E, 0xAD, 0x7A, 0xAB, 0xFD, 0x29, 0xDA, 0x0C, 0x8A, 0xF9, 0xE1, 0x9D, 0xEB,
-    0x1E, 0xD4, 0xEA, 0xFC, 0xD3, 0x3C, 0x96, 0xBB, 0xAA, 0x93, 0x80, 0xA2, 0x5A, 0xAE, 0xC2, 0xAC,
-    0x56, 0x9B, 0xB4, 0x75, 0x5D, 0x4F, 0x29, 0xAA, 0x75, 0xB2, 0xB4, 0xBD, 0xAB, 0x03, 0xEB, 0xB3,
-    0xDE, 0xE4, 0x29, 0xB5, 0x11, 0x1E, 0xB1, 0x80, 0x8A, 0xCD, 0x22, 0x62, 0xAC, 0x1F, 0xE2, 0x8A,
-    0x88, 0x05, 0xAB, 0x3B, 0xBE, 0x6F, 0xD0, 0x10, 0xFE, 0x82, 0x6F, 0xFD, 0x19, 0x3F, 0x85, 0xE8,
-    0x25, 0xE3, 0xC3, 0x71, 0xE1, 0x8A, 0x88, 0xFD, 0x1E, 0xD7, 0xA1, 0xAF, 0x1E, 0xAE, 0x37, 0xEF,
-    0x30, 0xFE, 0x1A, 0x82, 0xB2, 0x55, 0x44, 0x0C, 0x52, 0xD9, 0x12, 0x61, 0xB3, 0xCF, 0x2D, 0xA1,
-    0x24, 0xFB, 0xAB, 0x81, 0x15, 0x75, 0x6D, 0x91, 0x5C, 0x70, 0x88, 0x75, 0x5D, 0x5D, 0x9A, 0x41,
-    0x72, 0x9A, 0x45, 0xB2, 0x5B, 0x40, 0xD6, 0x70, 0xB8, 0xC8, 0xEB, 0x7B, 0x64, 0xFC, 0x57, 0x70,
-    0x24, 0x9B, 0x66, 0x07, 0x24, 0x3A, 0x40, 0x51, 0x1F, 0x4B, 0x6C, 0x97, 0x63, 0x8A, 0x0D, 0x74,
-    0xF4, 0x5E, 0x66, 0xA0, 0x1A, 0x36, 0x4A, 0x81, 0xBF, 0xE3, 0x4A, 0x35, 0xCF, 0x20, 0x33, 0xDE,
-    0x6C, 0x0C, 0x70, 0x39, 0x45, 0xCA, 0x5D, 0x9C, 0xE8, 0x78, 0x70, 0x20, 0x60, 0x09, 0x64, 0x82,
-    0x3E, 0xB8, 0xCF, 0x05, 0x7A, 0x6F, 0x0F, 0xAC, 0x98, 0x3B, 0x3B, 0x54, 0x03, 0xEA, 0xF9, 0x33,
-    0xF6, 0x1B, 0x8C, 0xE4, 0x75, 0xD0, 0x83, 0x50, 0xC6, 0x0F, 0x27, 0xDE, 0xF4, 0x79, 0xBE, 0x65,
-    0x36, 0x9E, 0x43, 0x79, 0x06, 0x94, 0x5B, 0xA5, 0x6B, 0x47, 0x21, 0x8C, 0x98, 0xA5, 0x2B, 0x55,
-    0x06, 0x33, 0xDE, 0x0C, 0xC6, 0x53, 0x6E, 0xD8, 0xE9, 0xF0, 0xD9, 0xFA, 0xA3, 0xB7, 0x5C, 0x66,
-    0xCC, 0xED, 0xAF, 0xBC, 0x03, 0xA4, 0x21, 0xF5, 0xBC, 0xB9, 0x59, 0xB9, 0xA0, 0x8D, 0x29, 0x09,
-    0xB2, 0x38, 0x2F, 0x2B, 0xA2, 0xD0, 0x9A, 0x9D, 0xB4, 0xD8, 0xD6, 0xE0, 0xB9, 0x35, 0x76, 0xBD,
-    0x7A, 0x5A, 0x6B, 0xB5, 0x5E, 0x5C, 0x60, 0x79, 0xCE, 0x7F, 0x77, 0x2A, 0x00, 0xE5, 0x63, 0x20,
-    0xB4, 0x70, 0xAA, 0x96, 0xBC, 0x76, 0x85, 0xAF, 0xC9, 0x47, 0x4F, 0x2D, 0x79, 0xFD, 0xFC, 0x1D,
-    0x99, 0xD3, 0xF1, 0x91, 0xB7, 0x5E, 0x58, 0x5A, 0xC4, 0x25, 0x9D, 0x97, 0xA7, 0x2E, 0x67, 0x05,
-    0xA5, 0x59, 0x1A, 0xC4, 0x42, 0x16, 0xC5, 0xD0, 0xE0, 0x77, 0xF8, 0xDA, 0x09, 0x41, 0x0E, 0x11,
-    0xF2, 0xDB, 0xAC, 0x49, 0x5C, 0x23, 0x70, 0x34, 0x8C, 0x29, 0x61, 0x35, 0x39, 0x11, 0x96, 0xDE,
-    0x77, 0xC5, 0xA8, 0xEB, 0x82, 0x7A, 0x1C, 0x5D, 0x3C, 0x83, 0xF5, 0x66, 0x6A, 0x2E, 0xCB, 0xBD,
-    0x0F, 0xA3, 0x87, 0x94, 0x5C, 0xAF, 0xFE, 0xD8, 0x14, 0x74, 0x06, 0x6B, 0xB0, 0x11, 0x23, 0x8D,
-    0xE8, 0x94, 0x46, 0x7A, 0x8B, 0x86, 0x78, 0xCB, 0x05, 0x23, 0x86, 0x71, 0xC4, 0x30, 0xAE, 0x15,
-    0x37, 0x9B, 0xF1, 0xF3, 0x04, 0x03, 0x6C, 0x99, 0xCA, 0x0C, 0x29, 0x25, 0x47, 0xBC, 0x47, 0xCA,
-    0x00, 0x39, 0x59, 0x8A, 0xC9, 0x75, 0x69, 0x23, 0x2D, 0x12, 0x25, 0x38, 0xD1, 0xCA, 0x46, 0xD6,
-    0xAC, 0x83, 0x15, 0x4A, 0x76, 0xF1, 0x08, 0x04, 0xE9, 0xF7, 0x3B, 0xDE, 0x57, 0x7C, 0xD4, 0x01,
-    0x09, 0x9B, 0xAF, 0x70, 0x8D, 0x96, 0x36, 0x1D, 0x61, 0x17, 0x0E, 0x26, 0xBE, 0xD8, 0x0B, 0xD2,
-    0x7A, 0xC1, 0x6E, 0xBF, 0xA5, 0x95, 0xDA, 0xE3, 0xA2, 0x74, 0x86, 0x99, 0xA6, 0xB4, 0x5A, 0x51,
-    0xD0, 0x95, 0x4E, 0xB8, 0xBD, 0x51, 0x5F, 0xAA, 0xAC, 0xF4, 0xEF, 0xEC, 0x20, 0xF9, 0x2F, 0xEB,
-    0x57, 0x5D, 0x71, 0x9B, 0x52, 0xD5, 0x58, 0xE7, 0x12, 0xD7, 0x02, 0xD5, 0x36, 0xEF, 0x63, 0x41,
-    0xC7, 0x96, 0x4E, 0x43, 0xA9, 0x11, 0xD7, 0xAC, 0x53, 0xC2, 0x78, 0x2A, 0x16, 0x2B, 0xF1, 0xB5,
-    0xE8, 0x11, 0x96, 0x13, 0xEB, 0x6F, 0x6A, 0x48, 0x7C, 0xA3, 0x35, 0xC6, 0x2B, 0x6C, 0x58, 0xF5,
-    0x42, 0xA8, 0x7C, 0x21, 0x0F, 0x3F, 0x32, 0x47, 0x42, 0xE9, 0x2B, 0xCD, 0x31, 0xB0, 0xA2, 0xC3,
-    0xD4, 0x8A, 0xA7, 0x56, 0x38, 0xB5, 0xFC, 0x53, 0x5A, 0xDE, 0xA9, 0x2D, 0x2B, 0x32, 0x5C, 0x44,
-    0x42, 0x83, 0xAC, 0xA5, 0x18, 0x63, 0x8B, 0x84, 0x77, 0x81, 0x17, 0x52, 0x64, 0x03, 0xBD, 0x97,
-    0x79, 0xCF, 0x87, 0x6D, 0xD8, 0xFB, 0xFD, 0x57, 0x59, 0x67, 0xBE, 0xD7, 0xC1, 0xB9, 0x1A, 0xF6,
-    0x3A, 0xC0, 0x7B, 0x61, 0xAF, 0xBE, 0xE8, 0x24, 0xEC, 0x75, 0x50, 0xA3, 0x8F, 0x6F, 0xAE, 0x6B,
-    0x8C, 0x68, 0xE4, 0xCB, 0x2B, 0x9F, 0x96, 0xAA, 0xDC, 0xCB, 0xA7, 0xE8, 0x95, 0xC1, 0x7D, 0x38,
-    0x26, 0xB8, 0x33, 0x6B, 0x48, 0x35, 0x61, 0xAF, 0x02, 0x5D, 0x11, 0x32, 0xA6, 0x1A, 0x21, 0xE6,
-    0xA8, 0xBC, 0xEC, 0x69, 0xD9, 0x0A, 0x94, 0x1F, 0x42, 0xD5, 0x9B, 0x2A, 0xE6, 0x68, 0x48, 0x57,
-    0xFD, 0x69, 0x30, 0x9C, 0x27, 0x79, 0x3D, 0x00, 0x53, 0x23, 0x38, 0xD1, 0xF0, 0x4F, 0x34, 0xDC,
-    0x70, 0xA0, 0xBE, 0x74, 0x68, 0x3E, 0x31, 0x45, 0xB2, 0x40, 0xB2, 0x5B, 0xAB, 0x19, 0x6C, 0xF1,
-    0x20, 0x62, 0x71, 0xB4, 0x40, 0xD5, 0xDB, 0x85, 0x73, 0x3A, 0xC5, 0xCE, 0xC3, 0xAF, 0x95, 0x93,
-    0x99, 0xD7, 0x73, 0x1D, 0x40, 0xEB, 0x4B, 0x37, 0xCE, 0xAB, 0xAD, 0xC6, 0x8C, 0xA5, 0x0B, 0xA3,
-    0x0B, 0x57, 0x28, 0x6C, 0xB4, 0x9A, 0xEA, 0x4B, 0xC3, 0x13, 0x9B, 0x0C, 0xB9, 0x10, 0x6B, 0x9B,
-    0x98, 0x2B, 0xC6, 0xE6, 0x80, 0xF9, 0xEF, 0x4D, 0x91, 0xCE, 0xB4, 0xC1, 0x30, 0xC2, 0x85, 0x00,
-    0xE2, 0x52, 0x68, 0x2A, 0x9B, 0x2E, 0xE7, 0x52, 0xD0, 0xB0, 0x80, 0xD3, 0x4F, 0x0F, 0xE0, 0x39,
-    0xE8, 0xB1, 0x86, 0x10, 0x8A, 0xA0, 0x91, 0x08, 0x91, 0x56, 0x13, 0x42, 0x18, 0x02, 0xD4, 0x74,
-    0x06, 0x21, 0xB0, 0xE4, 0x2F, 0xA3, 0xDB, 0x5F, 0x90, 0xC5, 0x79, 0x59, 0x70, 0xC9, 0x92, 0x00,
-    0xF2, 0x9A, 0x37, 0xEA, 0x96, 0x3E, 0x95, 0xF3, 0x95, 0x1D, 0xC0, 0xC1, 0x8A, 0xA0, 0xD7, 0xD4,
-    0xD0, 0x95, 0x2F, 0x26, 0xB2, 0x2B, 0xF5, 0xBC, 0x24, 0xA0, 0x4C, 0xB3, 0xF1, 0x6B, 0x95, 0x9A,
-    0xD4, 0x3F, 0xC1, 0x45, 0xA8, 0x7E, 0x33, 0x58, 0xD7, 0x95, 0xED, 0xBD, 0xA0, 0x68, 0x57, 0xD1,
-    0xBB, 0x8A, 0x6C, 0x35, 0x4B, 0x5B, 0x44, 0x51, 0x2B, 0x61, 0xE9, 0x4A, 0x33, 0xAF, 0x9A, 0x99,
-    0x79, 0xD8, 0x9A, 0x70, 0x6D, 0x70, 0xA7, 0x8D, 0xD1, 0x34, 0x3A, 0x25, 0x5A, 0xD8, 0xDF, 0xB2,
-    0x4E, 0x2B, 0x49, 0x58, 0x16, 0x0A, 0x71, 0x3C, 0xEB, 0x3D, 0x0D, 0xCE, 0x44, 0x84, 0xCD, 0xB4,
-    0x84, 0x34, 0xCE, 0xDC, 0x2D, 0x1E, 0x4B, 0x2F, 0x96, 0x48, 0x1C, 0x65, 0x9C, 0x82, 0xCE, 0x52,
-    0x2E, 0xA8, 0x45, 0xD4, 0xFD, 0x30, 0x34, 0x08, 0xB4, 0x88, 0xFF, 0xA9, 0x67, 0xD0, 0x4D, 0xA7,
-    0x1E, 0x30, 0x81, 0xB0, 0xFB, 0xD5, 0xF4, 0x73, 0xD2, 0xE4, 0xE6, 0xD5, 0x07, 0x85, 0xCB, 0x75,
-    0xF4, 0xEA, 0x57, 0x35, 0xE2, 0x4D, 0x77, 0xE6, 0x92, 0x7E, 0xC5, 0x9C, 0x1A, 0x45, 0xAA, 0x91,
-    0x38, 0x8C, 0x6B, 0xA3, 0xD4, 0x56, 0x88, 0x5A, 0x83, 0x20, 0x4D, 0x14, 0xBB, 0x5F, 0x6A, 0xC4,
-    0x9C, 0xCB, 0x2D, 0x58, 0xCE, 0xB4, 0xAF, 0xDD, 0x19, 0x7C, 0x7E, 0x0E, 0x59, 0x0A, 0x4B, 0x15,
-    0xA9, 0xD8, 0x54, 0x0C, 0xAB, 0x55, 0x39, 0xEB, 0x72, 0x4C, 0xF9, 0x6A, 0x08, 0x9C, 0x30, 0xE7,
-    0x99, 0xB3, 0xEC, 0xA8, 0x49, 0x74, 0xC2, 0x12, 0x9D, 0xB0, 0x44, 0x27, 0x2C, 0x39, 0x54, 0xA4,
-    0xC1, 0xB0, 0x97, 0x6C, 0x4C, 0xAD, 0x1A, 0xE8, 0x2E, 0x19, 0xFD, 0x1C, 0xA9, 0xC2, 0x24, 0x3A,
-    0x29, 0x09, 0x99, 0x9D, 0x49, 0x74, 0x52, 0x12, 0x9D, 0x94, 0xB3, 0x6E, 0x52, 0x6C, 0xD4, 0x94,
-    0xD6, 0xA6, 0x61, 0x1E, 0x30, 0x0A, 0x83, 0x2D, 0x39, 0x45, 0xF3, 0x33, 0x60, 0xA0, 0xCC, 0xF0,
-    0xC5, 0x17, 0x8C, 0x98, 0x5D, 0xC2, 0xD0, 0x3B, 0xBC, 0x87, 0xC1, 0x69, 0x9E, 0xF7, 0xEA, 0x84,
-    0xEE, 0xE7, 0x04, 0x22, 0x4F, 0x9D, 0xEC, 0x12, 0x82, 0xA0, 0xEA, 0x4B, 0x5A, 0x5A, 0x7A, 0x64,
-    0x9B, 0x02, 0x75, 0xC2, 0xE1, 0x4D, 0x38, 0xBC, 0x09, 0x87, 0x97, 0xFD, 0x9B, 0x8B, 0xD8, 0xA0,
-    0xDE, 0x06, 0x43, 0x9D, 0xDF, 0xC0, 0x13, 0x23, 0x73, 0x3B, 0xEA, 0x7E, 0xDA, 0xBC, 0x0C, 0xEA,
-    0x96, 0x7E, 0x62, 0xB0, 0xF6, 0xCD, 0xCB, 0x8F, 0x08, 0x75, 0x8F, 0x54, 0x35, 0xFD, 0xBA, 0xFA,
-    0xFA, 0x6D, 0xC3, 0xC0, 0x73, 0xCA, 0x4B, 0x56, 0x23, 0x9D, 0xF4, 0x8F, 0xB3, 0xAA, 0x58, 0x80,
-    0x86, 0x41, 0xD5, 0xB2, 0x8B, 0x3F, 0x70, 0xAA, 0xBE, 0x8E, 0xA1, 0x4E, 0x51, 0xB4, 0x62, 0xC5,
-    0x9A, 0x61, 0xC0, 0x19, 0x94, 0x72, 0xDD, 0xD6, 0x79, 0xF6, 0xC5, 0xF0, 0x8C, 0xF7, 0x2D, 0xBC,
-    0x7F, 0xFB, 0x15, 0x1D, 0x0E, 0x5B, 0x28, 0x2F, 0xB1, 0x2F, 0xF5, 0x8C, 0x37, 0x1B, 0x73, 0xC1,
-    0xAF, 0x79, 0xB3, 0x51, 0x17, 0x65, 0x46, 0x37, 0x71, 0xF3, 0xAA, 0xF5, 0x06, 0x39, 0x47, 0x86,
-    0xDB, 0xBE, 0xAD, 0xDF, 0xC9, 0xD8, 0x38, 0xE1, 0x59, 0xFC, 0xF7, 0xB0, 0x15, 0xEF, 0xBD, 0xB2,
-    0x83, 0xE8, 0x84, 0x70, 0x3B, 0x67, 0xFC, 0x20, 0xE7, 0x60, 0x80, 0x8C, 0x78, 0x83, 0x8E, 0xB1,
-    0x12, 0xB9, 0x5B, 0xEA, 0xE9, 0xF7, 0xCE, 0x50, 0xD8, 0x95, 0xFD, 0x20, 0x3F, 0x36, 0xD7, 0x23,
-    0xD3, 0xE1, 0xA5, 0x92, 0xBF, 0xEC, 0x5E, 0x14, 0xB1, 0xE7, 0x82, 0xDF, 0x3C, 0x29, 0xE8, 0x9A,
-    0x0A, 0x41, 0x7C, 0xF0, 0x4A, 0x37, 0xD6, 0x95, 0x6E, 0xAB, 0xD6, 0x96, 0x6A, 0xCB, 0x36, 0x8C,
-    0x97, 0xD8, 0x97, 0x55, 0x60, 0xA5, 0x26, 0xA3, 0x88, 0x06, 0xF4, 0x95, 0xBE, 0xC0, 0x4A, 0xFB,
-    0xBF, 0x62, 0x90, 0x6D, 0xC0, 0xE3, 0x46, 0xB0, 0xA3, 0x61, 0x97, 0xC4, 0xAB, 0x67, 0x36, 0xFA,
-    0x72, 0x39, 0x55, 0x23, 0x2F, 0x6C, 0x15, 0x95, 0x47, 0xAD, 0x1A, 0xB9, 0xED, 0x19, 0xA8, 0xFA,
-    0xC0, 0xFC, 0x52, 0xAB, 0x91, 0xDB, 0x03, 0x29, 0xEC, 0xB6, 0x67, 0xD1, 0xEB, 0x1B, 0xC6, 0x13,
-    0xB5, 0x36, 0x59, 0xA2, 0xF0, 0xBE, 0xBA, 0x81, 0x10, 0x47, 0x29, 0xDB, 0x64, 0x23, 0xAC, 0x24,
-    0xA8, 0x47, 0xC6, 0x32, 0x80, 0x01, 0xD5, 0x6A, 0x1F, 0xBB, 0x03, 0x72, 0xB1, 0xC7, 0x8C, 0xB9,
-    0x3F, 0xBE, 0xD2, 0xDE, 0xED, 0xE7, 0x92, 0x56, 0x63, 0x9D, 0x7B, 0x10, 0x7C, 0x20, 0x2B, 0xCE,
-    0x76, 0x62, 0x5E, 0x5D, 0xC0, 0x5A, 0x4B, 0x6D, 0x65, 0x01, 0x6B, 0x47, 0x0D, 0x4F, 0x47, 0x36,
-    0x7A, 0x76, 0xE9, 0xB0, 0x8E, 0x93, 0xB7, 0xB4, 0xC3, 0xB6, 0x7B, 0x0B, 0xFC, 0xB5, 0xB9, 0xA9,
-    0xEC, 0xF6, 0xDF, 0x2E, 0x74, 0x7C, 0x1D, 0x42, 0x7E, 0x3F, 0xBF, 0x6D, 0x7F, 0x3D, 0x9D, 0x58,
-    0xCD, 0xE9, 0xAD, 0x67, 0xEE, 0x03, 0x1D, 0x1E, 0xE8, 0x1E, 0xD7, 0x83, 0xFA, 0xA3, 0x5A, 0x67,
-    0xA9, 0xA5, 0xF2, 0x21, 0x63, 0x19, 0x5B, 0x1C, 0x55, 0x8A, 0xFD, 0x69, 0x8C, 0xE7, 0x98, 0x46,
-    0x61, 0x3B, 0x59, 0x6E, 0xB6, 0x4E, 0xBB, 0xEE, 0xB6, 0x58, 0x27, 0x4D, 0x67, 0x6D, 0xAC, 0x1C,
-    0xED, 0xD8, 0x12, 0xF3, 0xBD, 0xE7, 0xCD, 0x5A, 0x78, 0x1F, 0x9B, 0x21, 0x61, 0xA6, 0xF3, 0x5F,
-    0x1F, 0x44, 0x6B, 0x3C, 0x2E, 0x9C, 0xB1, 0xD3, 0xAC, 0xDC, 0xEF, 0xAE, 0x58, 0xC3, 0x28, 0xAA,
-    0x64, 0xF6, 0xAE, 0xA5, 0xA5, 0x40, 0xD1, 0x52, 0x8B, 0x9F, 0x67, 0xE3, 0xF8, 0x6D, 0x4B, 0xCB,
-    0x7F, 0x6A, 0x04, 0xA7, 0x6B, 0x65, 0xA7, 0xB5, 0xDA, 0x40, 0x37, 0x66, 0x56, 0x0E, 0xFC, 0xD0,
-    0xAF, 0xCD, 0x9B, 0xF2, 0xD7, 0x1A, 0x8C, 0xC3, 0xF4, 0x93, 0xB5, 0xDB, 0x9B, 0xB5, 0xF2, 0x75,
-    0xAB, 0x72, 0xD6, 0xFD, 0x7A, 0x8A, 0xFE, 0x18, 0x5D, 0xDC, 0x81, 0xCB, 0x2B, 0x19, 0x5D, 0x1D,
-    0x1E, 0xCF, 0xDC, 0x74, 0x3A, 0x7C, 0xB6, 0x26, 0x87, 0xFD, 0xCD, 0x52, 0x35, 0x96, 0x24, 0x45,
-    0x2F, 0x3D, 0xD6, 0x03, 0xF9, 0xCC, 0x64, 0x0C, 0x70, 0xCF, 0xBB, 0xE7, 0x86, 0xB1, 0xD9, 0x07,
-    0xF9, 0xAF, 0x4D, 0x63, 0xFF, 0xA4, 0xFB, 0x95, 0x56, 0x36, 0xD0, 0x86, 0xAD, 0x12, 0xAD, 0x36,
-    0x29, 0x6D, 0xD4, 0xAE, 0xA1, 0x9A, 0x9B, 0x2C, 0xE5, 0xB2, 0x78, 0x0E, 0x65, 0xFD, 0x6E, 0xA2,
-    0xB2, 0x8F, 0x59, 0x22, 0x86, 0xBB, 0x74, 0x96, 0xD8, 0xC9, 0xBF, 0x51, 0x6E, 0xDA, 0x0D, 0xA3,
-    0xC2, 0x0E, 0x89, 0xC8, 0xF8, 0x4B, 0x6B, 0x89, 0x0F, 0x6C, 0xDD, 0xF0, 0xCE, 0x96, 0xFC, 0x8D,
-    0x27, 0xC3, 0x71, 0x3D, 0x8F, 0x60, 0xD2, 0x41, 0xCA, 0xD4, 0xFC, 0x63, 0xAA, 0x73, 0xEB, 0x78,
-    0x0E, 0x1B, 0x30, 0x26, 0x32, 0x3F, 0x7C, 0x77, 0x19, 0xC2, 0xEC, 0x51, 0xBB, 0xC0, 0x1F, 0xE5,
-    0xBD, 0x4A, 0x79, 0xA7, 0x88, 0x2E, 0xDC, 0x81, 0xA1, 0xF9, 0x8C, 0xEB, 0x12, 0x5D, 0x07, 0xC9,
-    0x34, 0x44, 0xE3, 0x1A, 0xA5, 0xD0, 0xC9, 0x2C, 0xAA, 0xF5, 0x97, 0x75, 0xC5, 0x2B, 0x4B, 0x41,
-    0xAC, 0x1D, 0x11, 0x0F, 0x2C, 0xBE, 0x1E, 0xA1, 0x4C, 0x05, 0x0E, 0x67, 0x88, 0x51, 0x11, 0x53,
-    0x1E, 0xC4, 0xD2, 0x2A, 0x06, 0xEC, 0x0D, 0x41, 0xFF, 0xE8, 0xE7, 0x58, 0x2F, 0xBD, 0x82, 0x15,
-    0xD9, 0xFF, 0xAA, 0x41, 0xB0, 0x43, 0x69, 0x2B, 0xC9, 0xBF, 0x65, 0x33, 0xFA, 0xD9, 0x49, 0xA1,
-    0xEB, 0xB7, 0x1B, 0x67, 0xB3, 0xB0, 0xE9, 0x3B, 0x88, 0x85, 0x85, 0x3E, 0x0D, 0xC3, 0xAB, 0x97,
-    0x7F, 0x1F, 0xEA, 0x61, 0x2D, 0x43, 0x34, 0x7A, 0x23, 0x53, 0x0C, 0x56, 0xBE, 0x42, 0xEC, 0x86,
-    0x0A, 0x47, 0x24, 0xEB, 0xF2, 0xAF, 0x65, 0x51, 0xB3, 0x98, 0x59, 0xF9, 0x7B, 0x83, 0x8C, 0x6B,
-    0xF6, 0x0F, 0x28, 0xD8, 0x04, 0xF7, 0x59, 0x20, 0x6A, 0x96, 0xEF, 0xD9, 0x82, 0x29, 0xDE, 0xCB,
-    0xF1, 0xB8, 0x19, 0xBB, 0xF0, 0xB0, 0x1D, 0xDD, 0x3C, 0xDF, 0xE0, 0xC2, 0xEC, 0x7C, 0x03, 0x8D,
-    0xB7, 0x4D, 0x2F, 0xBA, 0xCD, 0x80, 0x26, 0x73, 0x35, 0xFF, 0x2F, 0x68, 0x76, 0x74, 0x09, 0x4D,
-    0xF9, 0x14, 0x9C, 0xF3, 0x85, 0x1D, 0xDD, 0x67, 0xA4, 0x4F, 0xCF, 0x27, 0x37, 0xFC, 0x25, 0x6B,
-    0x44, 0xC1, 0xD1, 0x3D, 0x29, 0x7F, 0x87, 0x76, 0x7B, 0xCD, 0x75, 0xB7, 0x85, 0x81, 0x2A, 0x59,
-    0xAC, 0x57, 0x64, 0x6F, 0x61, 0x91, 0xB6, 0x51, 0xBF, 0x87, 0x1A, 0xA5, 0xFD, 0x2E, 0x58, 0xB0,
-    0x85, 0x2F, 0x02, 0xBE, 0xE3, 0x3C, 0x75, 0x0F, 0x1A, 0xE6, 0xF6, 0xFC, 0x85, 0x8A, 0x11, 0x5B,
-    0x9A, 0xFA, 0x35, 0xFB, 0xB3, 0x3A, 0x1C, 0xC2, 0x19, 0x54, 0xF9, 0xD0, 0x57, 0xB8, 0x2E, 0xDB,
-    0x63, 0x46, 0x91, 0xD6, 0x8E, 0xC7, 0x3D, 0xA1, 0xBC, 0x0B, 0x30, 0x1E, 0xED, 0x00, 0x3C, 0xF3,
-    0xA2, 0x80, 0xAF, 0x7A, 0x9B, 0x55, 0x68, 0xEF, 0x0A, 0xA8, 0x11, 0xB1, 0x9A, 0x1B, 0x11, 0xAD,
-    0x99, 0x39, 0x9F, 0x3C, 0x40, 0xE9, 0xE4, 0x13, 0x9A, 0x03, 0x9E, 0x46, 0x80, 0x45, 0x44, 0x04,
-    0x27, 0x57, 0xAC, 0x9C, 0x1C, 0x61, 0x8B, 0x42, 0x56, 0x91, 0x0D, 0xA4, 0xD4, 0x38, 0x4B, 0x2D,
-    0xD9, 0x45, 0x61, 0x5D, 0x56, 0xE4, 0xA1, 0x2A, 0x8B, 0x2A, 0xC8, 0xAA, 0x56, 0xEB, 0xCE, 0x8A,
-    0xF8, 0x73, 0xB2, 0x94, 0xD4, 0x9E, 0x15, 0xB1, 0x79, 0x48, 0xC4, 0xE2, 0x5E, 0xD1, 0xBC, 0x7E,
-    0x7F, 0x50, 0xD3, 0xE1, 0x12, 0x3A, 0x41, 0x9B, 0x92, 0x44, 0x97, 0x9A, 0xEE, 0xC0, 0x1C, 0xC5,
-    0xF2, 0x7F, 0x69, 0x63, 0x7A, 0x44, 0x95, 0xD0, 0xA4, 0x71, 0xB0, 0xD6, 0x29, 0x69, 0xBC, 0xA6,
-    0xA0, 0x93, 0x17, 0x10, 0xF2, 0x85, 0xBB, 0x14, 0x4C, 0x1D, 0x27, 0x2F, 0xD3, 0x30, 0x9D, 0x5D,
-    0xDA, 0x5E, 0xD6, 0x25, 0xC9, 0x6C, 0x7C, 0xAD, 0x16, 0x26, 0xB3, 0xD3, 0x3D, 0x8B, 0xAF, 0x55,
-    0x9F, 0xE3, 0x2D, 0x61, 0x35, 0x37, 0x23, 0x3B, 0x66, 0xFA, 0x65, 0x0D, 0xF8, 0xD9, 0x57, 0x56,
-    0xFB, 0x1A, 0x0F, 0x09, 0xBA, 0x78, 0xE2, 0xED, 0xF1, 0xF8, 0xF1, 0x1B, 0xF0, 0xA9, 0x80, 0x44,
-    0x73, 0x4F, 0x03, 0xBE, 0x08, 0xF4, 0xD8, 0x8D, 0x80, 0x96, 0x99, 0xCD, 0x63, 0x37, 0x9A, 0x8D,
-    0x63, 0x37, 0x06, 0x77, 0xEC, 0x06, 0x0F, 0xCC, 0x18, 0x55, 0x49, 0x3A, 0xFD, 0xD8, 0x8D, 0x7E,
-    0x36, 0x46, 0x6E, 0xC0, 0xED, 0xB1, 0x1B, 0xBB, 0xAA, 0xF3, 0x6D, 0x1C, 0xBB, 0x11, 0x35, 0x89,
-    0x3D, 0x76, 0x83, 0x06, 0x49, 0x35, 0xAE, 0x1D, 0x2A, 0x0F, 0x3F, 0xE5, 0xD8, 0x8D, 0xAA, 0x36,
-    0x4D, 0xEC, 0xC2, 0xB4, 0x95, 0xC3, 0xB8, 0x94, 0x16, 0x1B, 0x31, 0x69, 0xAD, 0xC7, 0xC1, 0x06,
-    0xF2, 0x37, 0xD0, 0x56, 0xF1, 0x3D, 0xEF, 0xC1, 0x17, 0xDF, 0xEB, 0x58, 0x7C, 0x6F, 0xE6, 0x18,
-    0x08, 0xDD, 0x69, 0xD6, 0x93, 0x7F, 0xF6, 0x14, 0xF8, 0x0E, 0x8B, 0x4A, 0x62, 0xB2, 0xD6, 0x8D,
-    0xA2, 0x96, 0x6D, 0xD6, 0x34, 0xF4, 0x9F, 0x1F, 0xE2, 0x89, 0xBB, 0x48, 0xBD, 0xDC, 0x68, 0xBC,
-    0x28, 0x8D, 0xE7, 0xED, 0x16, 0x39, 0xED, 0x95, 0x8F, 0x58, 0xC3, 0xD8, 0x7D, 0xF9, 0x39, 0xCA,
-    0x96, 0x37, 0x9D, 0x90, 0xE9, 0x22, 0x98, 0x83, 0x29, 0x94, 0x79, 0x12, 0xE5, 0x32, 0xD7, 0x48,
-    0x5C, 0x23, 0x3E, 0xD1, 0x88, 0x4E, 0x34, 0x78, 0xDF, 0x7F, 0x94, 0x85, 0x99, 0xBF, 0x3D, 0x5E,
-    0xF9, 0x49, 0x3D, 0x1E, 0xED, 0x05, 0x4B, 0x9E, 0xF4, 0xB2, 0x1B, 0x2C, 0x03, 0xD9, 0x37, 0x81,
-    0x7D, 0xE0, 0x17, 0x2D, 0xE6, 0x62, 0x7D, 0x10, 0x98, 0xD5, 0xB8, 0x85, 0xD4, 0x0F, 0x46, 0x51,
-    0x8C, 0x68, 0x16, 0xD0, 0x53, 0xE5, 0xA6, 0x54, 0x82, 0x79, 0x4C, 0xBC, 0xB3, 0xA0, 0x3B, 0xBB,
-    0xB9, 0xBF, 0x85, 0x27, 0x1F, 0x42, 0xB7, 0x7D, 0x14, 0x4B, 0xA3, 0x47, 0xB1, 0x14, 0x9F, 0xF3,
-    0x28, 0x16, 0x6F, 0xE3, 0x28, 0x96, 0xC6, 0xC3, 0xA1, 0x10, 0xD9, 0x8D, 0xDF, 0x86, 0xD0, 0x2B,
-    0x82, 0xF5, 0xA7, 0xAC, 0xFC, 0x3F, 0xDE, 0xFD, 0x19, 0x2C, 0x9B, 0xE8, 0xC4, 0x51, 0x2C, 0x73,
-    0x56, 0xE1, 0x62, 0xA1, 0xAF, 0x6D, 0xC4, 0xED, 0x6E, 0x1E, 0x3C, 0x63, 0xD1, 0xEF, 0xB8, 0x68,
-    0x95, 0x21, 0xC7, 0xAA, 0xE8, 0x9E, 0x9B, 0x97, 0x00, 0x1E, 0x6F, 0x09, 0x35, 0xDA, 0x53, 0xFE,
-    0xC3, 0x92, 0x61, 0x7E, 0x86, 0x33, 0xE3, 0x85, 0x07, 0x8E, 0x90, 0xF4, 0x8B, 0x13, 0xCE, 0xE8,
-    0x93, 0x8E, 0xE9, 0x03, 0xA3, 0x51, 0xD7, 0xCB, 0xD9, 0x56, 0x70, 0x2B, 0x5B, 0xF0, 0x86, 0x5D,
-    0xF8, 0x0B, 0x9C, 0x96, 0xF3, 0x6D, 0x45, 0x87, 0x73, 0x54, 0x1C, 0xEA, 0x14, 0x1D, 0xEA, 0x69,
-    0x39, 0x87, 0x7A, 0x5A, 0xCE, 0xE5, 0xD3, 0x4E, 0xCB, 0xB9, 0xA6, 0x03, 0x7F, 0x78, 0x67, 0x74,
-    0xCB, 0xD3, 0x72, 0xDC, 0x50, 0xDF, 0x4D, 0x1D, 0xCE, 0x73, 0xBF, 0x8B, 0xD2, 0x34, 0xF1, 0xF7,
-    0x26, 0x68, 0x08, 0xEB, 0x7F, 0xFE, 0xAB, 0xED, 0x3A, 0x9C, 0xFC, 0xFD, 0x06, 0xE4, 0x67, 0x4F,
-    0xD4, 0xE1, 0xD4, 0xA4, 0x7E, 0x7B, 0x56, 0xC7, 0xC4, 0x15, 0x6C, 0x38, 0xC3, 0x3D, 0x20, 0x9F,
-    0x6A, 0xAB, 0x49, 0xED, 0x81, 0xB1, 0xFF, 0x1D, 0x52, 0x3C, 0x9C, 0x9B, 0x9A, 0x6E, 0x1F, 0xA9,
-    0xA0, 0x11, 0x2E, 0x3F, 0x37, 0x42, 0xCF, 0x22, 0xE6, 0x13, 0xA3, 0x74, 0x97, 0xE8, 0xE9, 0x32,
-    0x05, 0x0B, 0x2D, 0x09, 0x52, 0x8E, 0x33, 0xE3, 0xD9, 0x1D, 0x20, 0x53, 0x41, 0xC6, 0x14, 0x9D,
-    0xB4, 0xB1, 0x13, 0x1D, 0x0D, 0x0A, 0x8D, 0x8D, 0x21, 0x19, 0x1D, 0x1C, 0x37, 0x7F, 0xBC, 0x77,
-    0xA8, 0x7E, 0x6E, 0xC4, 0x5A, 0xA8, 0x2D, 0xD8, 0xCC, 0x8B, 0xA1, 0x9D, 0xD7, 0xE0, 0x30, 0xDF,
-    0xE6, 0x94, 0x46, 0xD6, 0xD4, 0x99, 0x76, 0xBA, 0x79, 0x09, 0x5B, 0xA0, 0x6D, 0xBC, 0xD6, 0xD3,
-    0x83, 0x6D, 0x56, 0xF8, 0x99, 0x40, 0xB5, 0x9C, 0xDC, 0xFE, 0xAE, 0x76, 0x38, 0xDA, 0xC4, 0xB2,
-    0x0C, 0x8E, 0x8F, 0x8F, 0x0D, 0x69, 0x95, 0x0F, 0x78, 0x75, 0xB5, 0xBF, 0x8F, 0x73, 0xCE, 0xAC,
-    0x54, 0x36, 0xE1, 0x70, 0x0B, 0x3B, 0xB7, 0x9B, 0x6F, 0xA6, 0x14, 0x2D, 0x6F, 0xB2, 0xE6, 0x7D,
-    0xCD, 0x06, 0x57, 0x5E, 0x63, 0xB5, 0x8C, 0xE2, 0xD2, 0x60, 0xFB, 0xDF, 0x6E, 0x18, 0x36, 0xF6,
-    0x67, 0x88, 0xD1, 0xBF, 0x36, 0x1E, 0x0E, 0xD5, 0x1B, 0x59, 0xE8, 0xAB, 0xC9, 0x59, 0x97, 0xF4,
-    0x75, 0x9E, 0x12, 0xF1, 0x7E, 0x0C, 0x88, 0x5A, 0x14, 0xB1, 0xD5, 0xB5, 0x62, 0xB5, 0x3C, 0xA9,
-    0xC7, 0xD3, 0xC2, 0x7E, 0xED, 0xF3, 0xD7, 0x9C, 0x1C, 0x08, 0x8B, 0x64, 0xBF, 0x88, 0xEA, 0x35,
-    0xA8, 0x5F, 0xA8, 0xF1, 0x0E, 0x5E, 0xA4, 0x92, 0xE2, 0xD3, 0x1B, 0x5A, 0xEF, 0x6F, 0xDE, 0x58,
-    0x5B, 0x5B, 0x93, 0x4B, 0xA5, 0x9B, 0x0A, 0xB6, 0x6F, 0x45, 0xDB, 0xB9, 0x50, 0x46, 0x17, 0xC0,
-    0xFB, 0xFC, 0x26, 0xFE, 0x72, 0xE7, 0x48, 0x4D, 0x62, 0xE5, 0x2C, 0xFE, 0x72, 0x67, 0x16, 0x00,
-    0xBA, 0x05, 0xF5, 0x90, 0x51, 0x6B, 0xCE, 0xFF, 0x02, 0xFF, 0xD5, 0xEC, 0x3E, 0x37, 0xCA, 0xAA,
-    0x2A, 0x1A, 0xB9, 0x1C, 0xC3, 0xC2, 0x05, 0x1B, 0xE4, 0x8D, 0x73, 0xBA, 0xA7, 0x9F, 0x5A, 0x6F,
-    0x87, 0x17, 0xAC, 0xE3, 0x89, 0xB7, 0x53, 0x86, 0xFE, 0xFD, 0x38, 0xEB, 0x93, 0xC7, 0x59, 0xAB,
-    0xE6, 0xAF, 0x3D, 0xCF, 0xAD, 0x27, 0x20, 0x2F, 0x34, 0x66, 0x3A, 0xFB, 0xA0, 0xB6, 0x21, 0xF1,
-    0xAB, 0xD3, 0x07, 0xD4, 0xC6, 0x57, 0x3C, 0xDA, 0xA7, 0x8A, 0xA8, 0x1F, 0x55, 0xDD, 0xA8, 0xD6,
-    0x8B, 0xAA, 0x4E, 0x54, 0x8D, 0x10, 0xD0, 0x00, 0x01, 0xF5, 0xE7, 0xA9, 0x03, 0x55, 0x7D, 0x79,
-    0xEA, 0x3E, 0x55, 0x3F, 0x9E, 0x3A, 0x4F, 0xCD, 0xA5, 0x0F, 0x54, 0xC7, 0xC4, 0xB3, 0x8F, 0xEB,
-    0x95, 0xD2, 0xAA, 0x1E, 0x67, 0x35, 0x8B, 0x90, 0xE2, 0xA1, 0x4A, 0x7A, 0xC6, 0x12, 0x56, 0x96,
-    0x1E, 0x81, 0xA8, 0x16, 0x30, 0x42, 0x06, 0xE7, 0x8E, 0xCC, 0x11, 0x19, 0x49, 0xE4, 0xE3, 0x5A,
-    0x34, 0x54, 0x88, 0xD2, 0x5A, 0x15, 0xD6, 0x66, 0xCA, 0x03, 0xDA, 0x40, 0x8A, 0x1D, 0x43, 0x4F,
-    0x2A, 0xE1, 0x04, 0x57, 0x46, 0x9A, 0x08, 0xBB, 0x59, 0x0E, 0x28, 0xC3, 0x01, 0x7C, 0x38, 0x96,
-    0xE0, 0xDF, 0x83, 0x01, 0xF5, 0x2F, 0xE1, 0x38, 0xDD, 0xF1, 0x5A, 0x2A, 0x47, 0x2C, 0x42, 0x03,
-    0x48, 0x29, 0x5A, 0x13, 0x9C, 0xEB, 0x83, 0xB7, 0x3C, 0x57, 0x6A, 0xB1, 0x7E, 0xE3, 0x60, 0x1E,
-    0xEE, 0x59, 0xD3, 0xC7, 0x91, 0x37, 0xD6, 0x93, 0x51, 0x7B, 0xAE, 0x54, 0x65, 0xCF, 0x33, 0xB4,
-    0x7A, 0x38, 0x4E, 0x91, 0xDE, 0xB1, 0xB4, 0x9C, 0x64, 0x2B, 0xCE, 0x4B, 0x74, 0x4B, 0xE4, 0x1A,
-    0xB6, 0x58, 0x4E, 0x11, 0x93, 0x4D, 0xA3, 0x85, 0xA6, 0xD1, 0x52, 0xEF, 0x3B, 0x40, 0x88, 0xF0,
-    0xE3, 0x78, 0x90, 0xF4, 0x5B, 0x7A, 0x90, 0xF4, 0x42, 0xD7, 0x80, 0x75, 0x1A, 0xF4, 0xF3, 0x6C,
-    0x5E, 0xAB, 0xAC, 0x58, 0xFD, 0xDB, 0x3A, 0xD5, 0x6C, 0x02, 0x53, 0x3A, 0x29, 0x74, 0x5F, 0xCA,
-    0xD1, 0x26, 0xDD, 0xD9, 0xC9, 0x06, 0xA0, 0x9E, 0x3C, 0xC7, 0xB4, 0xD6, 0x7D, 0xCB, 0x66, 0x4C,
-    0xFE, 0xB2, 0xF7, 0x38, 0xB9, 0x69, 0xBD, 0x51, 0x33, 0xAE, 0x46, 0x6F, 0xBD, 0x9C, 0xB6, 0xCF,
-    0xC0, 0x5C, 0x32, 0x25, 0x2A, 0x64, 0x05, 0x56, 0x52, 0x6C, 0xCA, 0xA3, 0xDC, 0xEC, 0xAA, 0x82,
-    0x60, 0x60, 0x05, 0xEE, 0xA3, 0x2D, 0x4F, 0xE0, 0x97, 0xE2, 0xAD, 0x15, 0x84, 0x55, 0x96, 0xB4,
-    0xAC, 0x5B, 0x95, 0x6C, 0x98, 0x77, 0x2C, 0xB2, 0x59, 0x2D, 0xAC, 0x9F, 0xA1, 0xE7, 0x9A, 0xC5,
-    0x1D, 0x37, 0xEA, 0x78, 0x61, 0x4B, 0x7E, 0x69, 0x8A, 0x0E, 0xD7, 0x9B, 0x9D, 0x4D, 0x8B, 0x57,
-    0xCE, 0xB9, 0x7D, 0x1F, 0x1D, 0xAB, 0x0F, 0xD3, 0x69, 0xFB, 0x91, 0x75, 0xDA, 0x9A, 0xAD, 0x3C,
-    0x86, 0x74, 0x4B, 0xA2, 0x3A, 0xDC, 0xCA, 0x63, 0xB0, 0xF6, 0xC9, 0xC0, 0xAE, 0xDD, 0xA9, 0x48,
-    0xC6, 0x43, 0x3F, 0x42, 0xE7, 0x43, 0x3E, 0x71, 0x9E, 0x9F, 0x30, 0xAC, 0xAD, 0x60, 0x6A, 0xEA,
-    0x50, 0xEB, 0x9D, 0x7A, 0xE4, 0x95, 0x93, 0xA4, 0xD5, 0x63, 0x61, 0xE2, 0x38, 0x4D, 0x7F, 0xF6,
-    0x55, 0x7F, 0xF6, 0xD5, 0x8F, 0xE8, 0xAE, 0x5F, 0x78, 0x33, 0xD3, 0x9F, 0x43, 0x9B, 0xA1, 0x6F,
-    0xED, 0x3A, 0x21, 0xE7, 0x21, 0x9B, 0x38, 0x3E, 0x9C, 0x4C, 0x1C, 0x9A, 0xD8, 0xFD, 0xFE, 0x8C,
-    0x92, 0xAE, 0xCE, 0xE0, 0xBB, 0x33, 0xF8, 0x27, 0xD6, 0x89, 0x08, 0x4F, 0x58, 0x49, 0xB1, 0xDF,
-    0x20, 0xE4, 0xAD, 0xB7, 0x59, 0x94, 0xF8, 0xA6, 0x36, 0xF0, 0x19, 0xCA, 0x0B, 0xFC, 0x5C, 0x2E,
-    0x44, 0x86, 0x43, 0xF4, 0xD7, 0xD2, 0xF8, 0x14, 0x1B, 0xCD, 0x25, 0xE4, 0x40, 0xA1, 0xD2, 0x02,
-    0x93, 0xA1, 0xA4, 0x1F, 0x3B, 0x6C, 0x94, 0x85, 0xB7, 0xC7, 0x86, 0xAC, 0xF1, 0x43, 0x36, 0x64,
-    0xCD, 0x5F, 0x65, 0x03, 0xEE, 0x2D, 0x36, 0x92, 0xDE, 0xD7, 0x46, 0xDC, 0x07, 0x2D, 0x1B, 0xE1,
-    0x22, 0x6C, 0xB4, 0xB1, 0x8C, 0xB4, 0xE1, 0x2F, 0x93, 0x42, 0xD3, 0xAC, 0xC6, 0xC4, 0xE6, 0x5B,
-    0x99, 0x67, 0x6C, 0xA3, 0xBC, 0x6C, 0x1B, 0xF9, 0xD2, 0x36, 0xB2, 0x85, 0x6D, 0x08, 0x83, 0xC4,
-    0x59, 0x54, 0xAC, 0x86, 0xC0, 0x13, 0x14, 0xAA, 0xB8, 0x0B, 0xD4, 0xFE, 0x1C, 0xA2, 0x08, 0x75,
-    0x3B, 0xA5, 0xEB, 0x4D, 0xC9, 0x41, 0xDB, 0xF6, 0xC9, 0xF4, 0x44, 0x06, 0xD7, 0x54, 0xD1, 0xE1,
-    0x3D, 0x6F, 0x33, 0xC7, 0xC8, 0x7B, 0xE4, 0x8F, 0xDD, 0xAA, 0x36, 0x5F, 0xEE, 0x4E, 0x39, 0x54,
-    0xCB, 0x4D, 0xDE, 0xE3, 0x0F, 0x0F, 0x4E, 0x4B, 0x92, 0x25, 0x74, 0x55, 0xD9, 0xDA, 0x4A, 0x35,
-    0x3B, 0x9A, 0xBE, 0xCC, 0xAB, 0x4B, 0x5D, 0x40, 0xDD, 0x3A, 0x8B, 0x64, 0xFA, 0x5A, 0x6C, 0x2C,
-    0x59, 0xA7, 0xA0, 0xE8, 0x34, 0x2A, 0xDD, 0x27, 0xEA, 0x33, 0x49, 0xD5, 0x19, 0xBE, 0xA7, 0x5E,
-    0xCC, 0x5D, 0x15, 0xF6, 0xAE, 0xA9, 0xE4, 0xC7, 0x12, 0x8D, 0x18, 0x3E, 0x6A, 0x2B, 0x1D, 0xEF,
-    0x16, 0xB2, 0x7A, 0x17, 0x0B, 0xB9, 0xA8, 0x98, 0x51, 0x16, 0x1A, 0xBE, 0xDE, 0xA8, 0xDB, 0xBB,
-    0xF1, 0x6C, 0x3E, 0x00, 0x98, 0x34, 0xEE, 0x76, 0x55, 0xE5, 0xC8, 0x81, 0xE2, 0xB3, 0xAF, 0x66,
-    0x62, 0x30, 0x68, 0x51, 0x7C, 0x68, 0x34, 0x36, 0xDE, 0x95, 0xB1, 0xD2, 0x72, 0xF0, 0x8D, 0xE7,
-    0x8A, 0x00, 0xF0, 0x8D, 0xF9, 0xBE, 0x7C, 0xDB, 0x80, 0xEF, 0xAA, 0x6F, 0x3A, 0xBD, 0x27, 0x9D,
-    0xFB, 0xD3, 0x89, 0x9E, 0x22, 0x1B, 0xAD, 0x6C, 0x72, 0xC0, 0xED, 0x4F, 0xF4, 0xBC, 0xA1, 0x21,
-    0xF4, 0xF3, 0x13, 0x3D, 0x1D, 0x40, 0x98, 0x24, 0x48, 0x44, 0x4F, 0xF4, 0x5C, 0xE2, 0x44, 0xCF,
-    0x7E, 0x3A, 0xD1, 0xF3, 0xAA, 0x32, 0xB2, 0x51, 0x3D, 0x65, 0x16, 0xAD, 0xB4, 0xF0, 0xC8, 0x93,
-    0xA7, 0x26, 0x62, 0x3E, 0xC6, 0x73, 0x70, 0x15, 0x82, 0xEF, 0x1D, 0x4E, 0xB3, 0x78, 0xB8, 0xC3,
-    0xEF, 0x4D, 0xCE, 0x13, 0x36, 0x30, 0x6E, 0xD1, 0x95, 0x46, 0x5D, 0x2D, 0xA8, 0x70, 0x4A, 0x81,
-    0x17, 0x05, 0x63, 0x69, 0x4B, 0xD8, 0x45, 0x03, 0x83, 0x7A, 0x15, 0x67, 0xC4, 0xE0, 0x37, 0xBD,
-    0x0D, 0x24, 0x0A, 0xBA, 0xCC, 0x05, 0xBC, 0xD9, 0x46, 0x5C, 0xD9, 0x46, 0xEA, 0x82, 0x8D, 0xF6,
-    0x30, 0x8A, 0x3D, 0xE5, 0x0C, 0xDB, 0x18, 0xEC, 0x9F, 0x7C, 0x17, 0x9A, 0x14, 0xBA, 0x93, 0x7C,
-    0x22, 0xD7, 0x10, 0xBE, 0x61, 0xAB, 0x8A, 0xBB, 0x00, 0x93, 0x3D, 0x6D, 0xBC, 0x89, 0xCD, 0x05,
-    0x0D, 0x96, 0xAA, 0x62, 0x03, 0xA3, 0x8B, 0xE3, 0x5C, 0xFB, 0xA8, 0xB7, 0x67, 0x75, 0xD7, 0x63,
-    0xF5, 0x04, 0x75, 0x26, 0xD6, 0x41, 0xA7, 0xF2, 0x24, 0x03, 0x6C, 0x4B, 0xA2, 0x75, 0x0C, 0x9A,
-    0x18, 0x5F, 0x1D, 0xCD, 0x95, 0x81, 0x4A, 0x00, 0x6A, 0x60, 0x62, 0xB0, 0x41, 0x07, 0x18, 0xEF,
-    0xC6, 0x0E, 0xB9, 0x52, 0x02, 0x80, 0x1E, 0x52, 0x41, 0x2C, 0x63, 0x8F, 0x01, 0xD3, 0xC2, 0xFF,
-    0xC2, 0xE4, 0x6F, 0xE8, 0x45, 0xA9, 0x0A, 0x95, 0x9C, 0x87, 0x42, 0x5D, 0xA8, 0xB4, 0x09, 0x00,
-    0x37, 0x8A, 0x51, 0x94, 0x1F, 0x73, 0xF2, 0x49, 0x2F, 0xDC, 0x50, 0xA6, 0xE5, 0xC7, 0x2B, 0xD9,
-    0x2D, 0x85, 0xCE, 0x7C, 0x4D, 0x4F, 0x5A, 0x78, 0x38, 0x36, 0x8F, 0xF3, 0xB3, 0x3E, 0x24, 0xF9,
-    0x05, 0x32, 0xCE, 0xF7, 0x3D, 0xAD, 0xAC, 0xCA, 0x62, 0x4C, 0x1F, 0x68, 0x29, 0x82, 0xC5, 0xA6,
-    0x9D, 0xA1, 0xA4, 0x94, 0xA5, 0x30, 0xD0, 0x5D, 0xDF, 0x70, 0xCC, 0x26, 0xF8, 0x02, 0xE1, 0x37,
-    0xEE, 0x9C, 0x87, 0xA9, 0x26, 0x6F, 0xCD, 0xC3, 0xBC, 0x8B, 0xBC, 0x4D, 0x64, 0x9D, 0x53, 0x9D,
-    0xA7, 0x82, 0xAF, 0xD1, 0xEA, 0x09, 0x4E, 0xE8, 0x13, 0xC5, 0x96, 0x05, 0xD6, 0xAB, 0xDA, 0x91,
-    0x18, 0xC8, 0x44, 0x44, 0x96, 0xA4, 0x0D, 0xB0, 0x4D, 0xA2, 0xC0, 0xF1, 0x8A, 0x25, 0x2D, 0x79,
-    0x4E, 0xF8, 0xB4, 0x1C, 0x58, 0xBE, 0x0E, 0xBB, 0x5B, 0x88, 0x22, 0xFF, 0xAC, 0x95, 0x91, 0xF1,
-    0x14, 0x5D, 0xC4, 0x60, 0x95, 0x34, 0x57, 0xDA, 0xF0, 0xE5, 0x9A, 0xD4, 0x6B, 0xC1, 0x66, 0xF2,
-    0x5D, 0x3D, 0xF9, 0x02, 0x65, 0xD0, 0xCE, 0x60, 0x7A, 0xBE, 0x21, 0xAB, 0x05, 0xC7, 0x2F, 0x68,
-    0x61, 0x55, 0x3E, 0x72, 0x3D, 0xCE, 0x4C, 0x22, 0x64, 0x11, 0x20, 0x2F, 0xB9, 0xF9, 0x1D, 0x59,
-    0x86, 0xB2, 0x00, 0xD2, 0x85, 0xF7, 0x95, 0x79, 0xBC, 0xE0, 0x24, 0xE3, 0x94, 0x33, 0xDF, 0xAE,
-    0x96, 0x8B, 0xD7, 0x3C, 0x8B, 0xB4, 0x3B, 0x96, 0xAF, 0xBA, 0x53, 0x47, 0x9D, 0xD9, 0xDF, 0xDF,
-    0x3F, 0xE8, 0x18, 0x53, 0x65, 0x21, 0x33, 0xD9, 0x5A, 0xB5, 0xD0, 0xB0, 0x74, 0x6C, 0x43, 0x2B,
-    0x8D, 0x2D, 0x1B, 0x9B, 0x74, 0x30, 0x2C, 0xC4, 0x83, 0xAD, 0xA8, 0x42, 0x03, 0xD5, 0xC7, 0x8C,
-    0x2F, 0xD2, 0xB9, 0xDE, 0x77, 0x63, 0xC3, 0x6A, 0x36, 0x11, 0x6D, 0x96, 0xA8, 0xED, 0xFF, 0x5B,
-    0x30, 0x9B, 0x9C, 0x71, 0x01, 0xE3, 0x85, 0xB7, 0x79, 0xB2, 0xCD, 0xD3, 0xFB, 0xFB, 0xF2, 0x18,
-    0x4C, 0x6A, 0xFE, 0xD1, 0x71, 0xDD, 0xE8, 0x99, 0x40, 0xD0, 0x83, 0x00, 0x0A, 0x2D, 0xE8, 0x87,
-    0xDA, 0x80, 0x31, 0x16, 0x41, 0x60, 0x70, 0xAA, 0x82, 0x8E, 0xCD, 0x45, 0x2A, 0xBC, 0x7B, 0xBC,
-    0x13, 0x3B, 0xDE, 0xF0, 0x25, 0xAA, 0xF7, 0x4F, 0xAF, 0x53, 0xF0, 0x98, 0x8C, 0xDF, 0xC0, 0x72,
-    0x71, 0xA8, 0xC4, 0x8A, 0x10, 0x38, 0x7F, 0x09, 0xB6, 0xBD, 0xC5, 0x89, 0x1F, 0xEE, 0x10, 0x63,
-    0xDF, 0x49, 0xA7, 0xC4, 0x28, 0x17, 0x94, 0x39, 0x6B, 0xB5, 0xAE, 0x14, 0x83, 0x7F, 0xEB, 0xE4,
-    0xFD, 0x7F, 0xB7, 0xD7, 0x6E, 0xDA, 0x6B, 0xE3, 0x4A, 0xAD, 0xEF, 0x69, 0xAB, 0xD1, 0x00, 0x0E,
-    0x27, 0x4D, 0x6E, 0x87, 0xF2, 0xCC, 0x6D, 0x4A, 0x21, 0x3C, 0xF2, 0xA7, 0x3F, 0xEF, 0x40, 0x02,
-    0xA9, 0xA9, 0x9B, 0x52, 0x33, 0x85, 0xF0, 0x7C, 0x66, 0xF3, 0x78, 0x15, 0x24, 0xC7, 0xB1, 0xE2,
-    0x29, 0xEC, 0x36, 0xA0, 0xC6, 0x0C, 0x75, 0x25, 0x93, 0x1E, 0xA5, 0x6D, 0x86, 0xB8, 0x98, 0x55,
-    0xDD, 0x25, 0xE0, 0x2A, 0xC4, 0x92, 0x0A, 0xE8, 0x14, 0x46, 0x5D, 0x1A, 0x9B, 0x1C, 0x57, 0xB9,
-    0xE4, 0x38, 0x7E, 0x22, 0x9A, 0xCA, 0xDF, 0x86, 0xCB, 0x94, 0xC5, 0x49, 0x5D, 0x72, 0x1C, 0xAA,
-    0x56, 0xB1, 0x56, 0x61, 0xDE, 0xC6, 0x06, 0x27, 0x9C, 0xD7, 0xEE, 0x38, 0xD8, 0xB0, 0x95, 0x35,
-    0xD4, 0xA3, 0xFC, 0x81, 0x90, 0x14, 0xB4, 0xAF, 0x79, 0x59, 0xC7, 0x07, 0x74, 0x90, 0x75, 0xE4,
-    0x1C, 0x3B, 0x04, 0x6D, 0xFC, 0xB3, 0xFD, 0x4B, 0x55, 0x0C, 0xA5, 0x23, 0x56, 0x39, 0x92, 0x16,
-    0x48, 0x9A, 0x0B, 0x32, 0xA7, 0xAE, 0x92, 0xEE, 0xE3, 0x9F, 0x72, 0x35, 0x5D, 0xA7, 0xFC, 0xC7,
-    0x78, 0xD0, 0xCE, 0xD5, 0xEC, 0x88, 0x97, 0x9F, 0x27, 0x39, 0x70, 0x7F, 0x5A, 0xA1, 0xA8, 0x2F,
-    0xE7, 0x00, 0xA4, 0x9B, 0x6B, 0x42, 0x3E, 0x22, 0xFF, 0xFC, 0x96, 0x9A, 0x41, 0x29, 0x6F, 0x5D,
-    0xD8, 0xE8, 0x0B, 0x97, 0x5F, 0xF2, 0x53, 0x32, 0xD7, 0x23, 0xCF, 0xFB, 0x6D, 0x06, 0x15, 0x6B,
-    0x8A, 0x90, 0xAD, 0x91, 0xE7, 0x62, 0x6F, 0x29, 0xE8, 0x26, 0x13, 0xE0, 0x8F, 0x69, 0xF3, 0x02,
-    0xFE, 0xFA, 0x3A, 0xF8, 0x55, 0x49, 0xD7, 0x5F, 0x1B, 0xE1, 0xE8, 0x00, 0x28, 0x87, 0x1A, 0x92,
-    0xFD, 0xB4, 0x96, 0xC0, 0x2A, 0x75, 0xFD, 0x96, 0x5B, 0x5E, 0xA4, 0x75, 0x71, 0x0F, 0x8B, 0x5C,
-    0x69, 0x0F, 0x5B, 0x39, 0xC3, 0x46, 0xA5, 0xAE, 0x6D, 0x8C, 0x36, 0x44, 0x21, 0x36, 0x53, 0x51,
-    0x0F, 0x5B, 0xD3, 0xC3, 0x96, 0xF4, 0xB0, 0x15, 0x3D, 0x6C, 0x41, 0x0F, 0x5B, 0xCF, 0xC3, 0x96,
-    0xF3, 0xB0, 0xD5, 0x3C, 0x6C, 0x31, 0x0F, 0x5B, 0xCB, 0xC3, 0x96, 0xF2, 0xB0, 0x95, 0x3C, 0x6C,
-    0x21, 0x0F, 0x5B, 0xC7, 0x63, 0xF6, 0x74, 0x9C, 0xC5, 0xC7, 0x22, 0x1E, 0x5A, 0xC3, 0xE3, 0x86,
-    0x2D, 0xE1, 0x21, 0x43, 0xBF, 0xAF, 0x62, 0x7C, 0x33, 0x2B, 0x52, 0xFC, 0x25, 0xD7, 0xDB, 0x98,
-    0x8E, 0xF4, 0xD9, 0x51, 0xAB, 0x48, 0xAE, 0x36, 0x96, 0x52, 0x51, 0xAE, 0xC5, 0xA3, 0xCF, 0x9C,
-    0x38, 0x28, 0xE9, 0x31, 0x9F, 0x89, 0x10, 0x59, 0x21, 0x7A, 0xD6, 0xB5, 0xE6, 0xE8, 0x7A, 0x51,
-    0xA7, 0x56, 0x59, 0xDF, 0x7B, 0x94, 0x66, 0x25, 0x6C, 0x63, 0x32, 0x18, 0xF4, 0x2D, 0xD6, 0x22,
-    0xCE, 0x3D, 0x79, 0x44, 0xB1, 0xDD, 0xCF, 0x2F, 0x54, 0x03, 0x1A, 0x10, 0xE3, 0x14, 0x8C, 0xAC,
-    0x42, 0x78, 0x02, 0xDE, 0xC7, 0x1A, 0xD0, 0x43, 0xD8, 0xAA, 0xA0, 0xC3, 0x80, 0xFF, 0x60, 0xA1,
-    0xBE, 0xEC, 0x4D, 0xBD, 0x73, 0xAB, 0x4C, 0xB4, 0xBF, 0x55, 0x26, 0x3A, 0x9B, 0x95, 0x89, 0x66,
-    0x75, 0xD3, 0x35, 0x30, 0x0E, 0xDC, 0x75, 0x99, 0xE8, 0xFB, 0x3C, 0x7C, 0x3C, 0x19, 0xC0, 0x42,
-    0xEF, 0x01, 0x0C, 0xDF, 0x3D, 0x95, 0xD0, 0xDE, 0xDF, 0xBF, 0xD4, 0xA9, 0xDC, 0x7A, 0x7C, 0x7C,
-    0x65, 0x3D, 0x40, 0x77, 0x3F, 0x36, 0x41, 0x07, 0xF2, 0x8B, 0x60, 0x72, 0x03, 0x11, 0xA2, 0xFA,
-    0xEB, 0x03, 0x26, 0xBF, 0x07, 0x3D, 0x7E, 0x73, 0x61, 0x7B, 0x38, 0x5D, 0xD8, 0x7E, 0xB8, 0x43,
-    0xBC, 0x67, 0xF3, 0x62, 0x69, 0xAE, 0xA6, 0x79, 0x9D, 0xB2, 0xD3, 0x29, 0x2C, 0x97, 0x01, 0x65,
-    0x7A, 0x00, 0x0E, 0x25, 0x28, 0x8F, 0x22, 0x14, 0x5E, 0x56, 0xDE, 0x24, 0x63, 0x6C, 0x4D, 0x5C,
-    0x58, 0x63, 0x94, 0x9E, 0x7A, 0xB7, 0xA9, 0x14, 0x17, 0x16, 0xC6, 0x54, 0x89, 0x62, 0x17, 0xA8,
-    0xBA, 0x01, 0xB7, 0x3F, 0x25, 0xF7, 0xA1, 0x4C, 0x05, 0xF3, 0x2F, 0x72, 0xC4, 0xE8, 0x7F, 0xCB,
-    0xE9, 0x7E, 0xCB, 0x7B, 0x58, 0x13, 0x12, 0xF3, 0xF6, 0x6A, 0xAA, 0x6C, 0xCB, 0x17, 0x8A, 0x84,
-    0xB5, 0x82, 0xA5, 0x8A, 0x64, 0xD9, 0xC4, 0xDD, 0x54, 0xB4, 0xCD, 0xCA, 0x56, 0x0F, 0xE8, 0x28,
-    0x5D, 0xD9, 0x59, 0x2F, 0x7A, 0xD3, 0x19, 0xE5, 0xA7, 0x1C, 0x55, 0x4E, 0x9B, 0x97, 0xBC, 0xB1,
-    0x45, 0xD8, 0x88, 0x70, 0x02, 0xD6, 0x48, 0xB9, 0x0B, 0xAC, 0x58, 0xEB, 0x74, 0x6B, 0xA1, 0xEE,
-    0x4A, 0x2B, 0x75, 0xAB, 0x56, 0x92, 0xB1, 0xFC, 0x89, 0xC7, 0x62, 0xA7, 0x8C, 0xE7, 0xBF, 0xAA,
-    0x42, 0x17, 0xA5, 0xE9, 0x95, 0x6F, 0x13, 0xB4, 0xDB, 0x79, 0xBC, 0xFE, 0xDF, 0xF3, 0xA5, 0x33,
-    0x1B, 0xAF, 0x3F, 0x9E, 0x16, 0xB6, 0x3F, 0xCC, 0x3D, 0x27, 0xD6, 0xF9, 0xAC, 0x1B, 0x50, 0xAE,
-    0x53, 0x91, 0xEB, 0xC7, 0x52, 0xEB, 0x69, 0x51, 0x0A, 0x3D, 0x8B, 0xB8, 0x27, 0xCF, 0x9E, 0x4A,
-    0x39, 0xD9, 0xB3, 0xB7, 0xDE, 0x13, 0xE5, 0xA4, 0xB5, 0x94, 0xF4, 0x3A, 0x7E, 0x7F, 0x41, 0x2F,
-    0x2A, 0x4F, 0x81, 0x0E, 0xB4, 0x8C, 0x15, 0xB4, 0x98, 0x82, 0xF9, 0x08, 0xD4, 0x1B, 0x54, 0xA1,
-    0x62, 0x99, 0x68, 0x99, 0xE2, 0x1D, 0x6F, 0x3A, 0x65, 0x0F, 0xA5, 0xA1, 0xDD, 0x29, 0x7B, 0x2B,
-    0x3D, 0xB4, 0x46, 0x8F, 0x78, 0x69, 0xD7, 0x79, 0x56, 0xDA, 0xF1, 0xB9, 0x2B, 0xFA, 0xC2, 0xDA,
-    0xE5, 0xA2, 0xBE, 0x22, 0x65, 0xF3, 0x2C, 0xF3, 0x9C, 0xF2, 0x05, 0x6D, 0x05, 0x48, 0x7F, 0xE0,
-    0xD0, 0x71, 0x33, 0x00, 0xA2, 0xE8, 0x1F, 0x2C, 0xD6, 0x15, 0x49, 0x7E, 0x13, 0xA7, 0x51, 0xD5,
-    0x6B, 0x54, 0xEA, 0x76, 0x6A, 0xB5, 0xA8, 0xD4, 0xC5, 0x2D, 0xD5, 0xE9, 0xC7, 0x6C, 0x4A, 0xBD,
-    0x27, 0xDE, 0x7C, 0xB6, 0xA2, 0xE9, 0x44, 0x75, 0x82, 0x3F, 0xE5, 0x90, 0xBD, 0xAF, 0x56, 0x6E,
-    0x9D, 0xD9, 0xB0, 0x4B, 0xB4, 0xD8, 0xDC, 0x99, 0xDF, 0xB0, 0x99, 0xF5, 0x9E, 0xAD, 0x90, 0x7A,
-    0x53, 0x7E, 0x8F, 0x19, 0xB6, 0x78, 0x65, 0x7F, 0x89, 0x37, 0x0E, 0x7B, 0x94, 0x49, 0x8F, 0x69,
-    0xAB, 0x38, 0xBB, 0xCD, 0xD9, 0x1F, 0xB7, 0xF9, 0xDD, 0x51, 0xEF, 0xBC, 0xD3, 0x14, 0xAA, 0x3B,
-    0x68, 0x0A, 0x5F, 0x20, 0x74, 0xFC, 0x34, 0x54, 0x6C, 0xB8, 0xBE, 0x5B, 0x4F, 0x43, 0xC7, 0x5F,
-    0x3A, 0x2D, 0x74, 0xFC, 0xE2, 0x17, 0x73, 0x7D, 0x33, 0x74, 0x3C, 0xE2, 0xA1, 0x50, 0x76, 0x95,
-    0xF2, 0x9C, 0xB9, 0xB8, 0xCD, 0xAA, 0x5B, 0x1A, 0x6A, 0xEE, 0x2E, 0xC8, 0x9C, 0x53, 0x3B, 0x87,
-    0x86, 0xB0, 0x6E, 0xCF, 0x6F, 0x07, 0x99, 0x6F, 0x1E, 0xFC, 0x38, 0x83, 0x27, 0x82, 0xCC, 0x99,
-    0xD7, 0x6F, 0xE0, 0x9D, 0xF4, 0x98, 0xCA, 0xCA, 0x83, 0x0E, 0x51, 0x0D, 0xC3, 0x82, 0xE7, 0x1F,
-    0x50, 0x31, 0xB9, 0x62, 0xA3, 0x98, 0xDC, 0x39, 0x33, 0x39, 0x85, 0x4E, 0x4B, 0x4C, 0x8C, 0x27,
-    0x70, 0xEF, 0x75, 0xC2, 0xEE, 0x12, 0x6C, 0x96, 0x5B, 0xBB, 0xCB, 0x4C, 0xC9, 0xF5, 0x4E, 0xE4,
-    0xB6, 0x22, 0xB7, 0x17, 0xDD, 0x6E, 0x33, 0x72, 0x36, 0x0A, 0xAB, 0x07, 0x3B, 0x45, 0x78, 0xD2,
-    0x84, 0x9D, 0x2A, 0x7C, 0x4F, 0x78, 0xDF, 0x62, 0x08, 0xD4, 0xC0, 0x6F, 0x9B, 0x5E, 0xFF, 0x8E,
-    0xA8, 0xB0, 0x42, 0xEB, 0x4A, 0xD6, 0xD6, 0x01, 0xAD, 0x98, 0x65, 0xEF, 0x79, 0xA4, 0xD8, 0xED,
-    0xB1, 0xBB, 0xCE, 0x7E, 0x4E, 0x48, 0x1E, 0xEA, 0x31, 0x38, 0x98, 0xA1, 0x57, 0xA4, 0xA5, 0x82,
-    0x2C, 0x22, 0x15, 0x47, 0x2E, 0xB5, 0x7E, 0x70, 0x35, 0xB2, 0xAF, 0xF1, 0xAD, 0xCC, 0xED, 0xDB,
-    0x1A, 0xF3, 0x40, 0x2B, 0x9A, 0x2C, 0x03, 0xA1, 0x89, 0x9B, 0x1A, 0x8C, 0x9D, 0xB7, 0xBA, 0xDC,
-    0xB2, 0x46, 0x33, 0x65, 0xD2, 0xDB, 0x60, 0x9C, 0x47, 0xAA, 0xD8, 0x14, 0xFA, 0xFB, 0xB2, 0x55,
-    0x9C, 0xF4, 0x8A, 0xE3, 0x3B, 0x60, 0xEA, 0xF5, 0xA8, 0xA7, 0xD6, 0x32, 0xF6, 0xC1, 0x98, 0xDF,
-    0x37, 0x88, 0x32, 0x33, 0xD7, 0xD1, 0xAF, 0xC7, 0xA1, 0x22, 0x61, 0x78, 0x02, 0xD2, 0xFE, 0x06,
-    0xA7, 0x28, 0x83, 0x61, 0xD6, 0x29, 0x19, 0x17, 0xBD, 0xCF, 0xB3, 0xA4, 0x3E, 0x57, 0x05, 0xC3,
-    0xC2, 0xE5, 0xAA, 0xAD, 0x01, 0xB6, 0xA1, 0xAF, 0xE2, 0xC2, 0x94, 0x67, 0x73, 0x32, 0x5C, 0xE8,
-    0xE2, 0x23, 0x9B, 0x9B, 0x69, 0x6E, 0x9B, 0x9B, 0x59, 0x68, 0x6E, 0xA6, 0x32, 0xF8, 0x68, 0x03,
-    0xD9, 0xE0, 0x18, 0x8D, 0xBB, 0xFC, 0xAA, 0xB5, 0xDE, 0x5B, 0x67, 0xBF, 0x35, 0x54, 0xAE, 0x2B,
-    0x20, 0x3E, 0xE4, 0xDC, 0xCC, 0x23, 0xE6, 0x66, 0x76, 0xEB, 0x18, 0xB4, 0x39, 0x54, 0x09, 0xFB,
-    0xAF, 0xF5, 0x20, 0x82, 0x66, 0x5D, 0xD4, 0xE9, 0xA9, 0x07, 0x32, 0x45, 0xA1, 0x0D, 0x0C, 0x76,
-    0x05, 0x4E, 0x1E, 0xD4, 0x14, 0x15, 0x9F, 0x6F, 0xA8, 0x43, 0x56, 0xDE, 0x54, 0xF8, 0x05, 0x86,
-    0xBA, 0xFD, 0xFF, 0xE5, 0x5C, 0xBD, 0x8F, 0xDC, 0xC6, 0x15, 0x7F, 0x24, 0x4F, 0x4B, 0x48, 0x04,
-    0xC4, 0x2B, 0x24, 0x20, 0xD6, 0x41, 0x62, 0xE3, 0xC2, 0x90, 0x2D, 0x6D, 0xAB, 0x42, 0x27, 0x32,
-    0xF1, 0x1F, 0x10, 0x15, 0x16, 0x52, 0xA8, 0x48, 0x0A, 0x17, 0x89, 0x9A, 0x4B, 0xE1, 0xC2, 0x85,
-    0x74, 0x4B, 0x23, 0x85, 0x0B, 0x17, 0xB9, 0x22, 0xB0, 0xCB, 0x5C, 0x02, 0x15, 0x92, 0x53, 0x28,
-    0x85, 0x8B, 0x2B, 0xCE, 0xC7, 0x0D, 0xF2, 0x07, 0x84, 0x49, 0xE3, 0xD2, 0x1B, 0x40, 0x30, 0x8C,
-    0x34, 0x61, 0x80, 0x55, 0xB2, 0x07, 0x2F, 0x77, 0xF2, 0xDE, 0xEF, 0xCD, 0x90, 0xDC, 0x73, 0x2C,
-    0x29, 0x90, 0x71, 0xB7, 0xBB, 0xB7, 0x38, 0xBC, 0xD9, 0x0F, 0xF2, 0xCD, 0xCC, 0xFB, 0xCD, 0xFB,
-    0x9C, 0xE1, 0x11, 0xD1, 0x84, 0xE4, 0xE5, 0xD7, 0x68, 0x82, 0x19, 0x9A, 0xD0, 0xA0, 0x89, 0x8A,
-    0x4C, 0x9A, 0x38, 0xCD, 0xA5, 0x49, 0xFA, 0x43, 0x69, 0x36, 0x93, 0x52, 0x9A, 0x9B, 0x71, 0x25,
-    0xCD, 0x7E, 0x84, 0x66, 0x1C, 0x08, 0x1B, 0xAF, 0x0A, 0xA6, 0xC2, 0x6B, 0x04, 0x6E, 0x41, 0x49,
-    0xC2, 0x2D, 0x1C, 0x92, 0x70, 0x8B, 0x73, 0x1A, 0x30, 0xB7, 0xD8, 0x18, 0xC3, 0x6C, 0xFA, 0xDA,
-    0x6C, 0x32, 0x57, 0xE6, 0x76, 0x9F, 0xBF, 0x67, 0x36, 0x7B, 0xDC, 0x23, 0x37, 0x63, 0xBE, 0x67,
-    0xC2, 0xBC, 0x98, 0xC3, 0x94, 0x02, 0x69, 0x6A, 0x0A, 0xA5, 0x31, 0xF4, 0x64, 0x96, 0xD3, 0x13,
-    0xF3, 0x54, 0xEE, 0x35, 0x66, 0x4C, 0x47, 0x5F, 0x0F, 0x75, 0x0E, 0x53, 0x6D, 0xEA, 0xEE, 0x27,
-    0xFA, 0x4C, 0x88, 0x77, 0x87, 0x49, 0x61, 0x46, 0x3C, 0xCF, 0xBB, 0x53, 0x0A, 0xC7, 0x54, 0x4B,
-    0x8F, 0x05, 0x05, 0x23, 0x26, 0x74, 0x9B, 0x06, 0x72, 0x91, 0x23, 0x67, 0x3E, 0x35, 0xE4, 0xF1,
-    0x38, 0x29, 0x3A, 0xE4, 0x8F, 0xC9, 0x88, 0x49, 0x3A, 0x14, 0x92, 0xF3, 0xC5, 0x8E, 0x18, 0xFE,
-    0xCE, 0x37, 0xFC, 0x6B, 0x92, 0x66, 0xB1, 0x99, 0xA6, 0x4F, 0x7D, 0x53, 0xF5, 0x27, 0x74, 0x71,
-    0x7E, 0x50, 0x18, 0x44, 0x4B, 0x3C, 0x0C, 0x3D, 0x54, 0x59, 0xF7, 0x0D, 0xC4, 0x7A, 0x2D, 0x2C,
-    0x75, 0xBC, 0x23, 0x15, 0xBD, 0x7E, 0x32, 0x00, 0x80, 0xEC, 0x54, 0x2B, 0x6D, 0x76, 0xE7, 0x26,
-    0xBD, 0xC4, 0xF8, 0xF5, 0x1E, 0x63, 0xFE, 0x3C, 0xBA, 0x4D, 0x99, 0xEF, 0x3A, 0x44, 0x10, 0xC9,
-    0x28, 0x0B, 0xFE, 0xCE, 0xD3, 0x21, 0xC9, 0xF0, 0x46, 0x6E, 0xB2, 0xC7, 0x0F, 0xE0, 0x23, 0x15,
-    0xAF, 0x22, 0x80, 0x01, 0x06, 0x75, 0x2C, 0x62, 0x8D, 0xCC, 0x0F, 0x20, 0xD5, 0xDF, 0x42, 0xAA,
-    0x0F, 0x14, 0xB7, 0x4A, 0x84, 0xF0, 0xAD, 0xD7, 0x72, 0xAB, 0xD8, 0x3B, 0xD2, 0xDF, 0x44, 0x97,
-    0x26, 0xCF, 0x3D, 0xE7, 0xA1, 0xBF, 0xC6, 0x4C, 0xBF, 0x64, 0xE6, 0xB7, 0xC2, 0x91, 0x30, 0x63,
-    0xAE, 0x19, 0x9D, 0x08, 0x44, 0x9E, 0xC2, 0x43, 0x56, 0xC9, 0x53, 0x6D, 0xE2, 0x5F, 0x41, 0xD4,
-    0xDE, 0x47, 0x2A, 0xE3, 0x06, 0xA2, 0x6A, 0x15, 0x21, 0xBA, 0xD3, 0x4C, 0x3C, 0x1E, 0xA2, 0x3F,
-    0xB1, 0x19, 0xBF, 0x13, 0xBE, 0xE1, 0x7F, 0xF8, 0xFA, 0xF8, 0x83, 0x89, 0xF4, 0x70, 0x9D, 0xD5,
-    0xAB, 0x9D, 0xED, 0x9D, 0x4C, 0x3A, 0xE7, 0x1F, 0xCC, 0xC7, 0x2C, 0xFF, 0x9A, 0xD2, 0xCC, 0x9F,
-    0x12, 0x4F, 0x6C, 0x22, 0xE4, 0x02, 0x25, 0xC2, 0xC8, 0x11, 0xEF, 0x5E, 0xC1, 0x88, 0x70, 0x67,
-    0xFE, 0x2C, 0x4B, 0x86, 0x3C, 0xA6, 0x64, 0xC8, 0xC3, 0x64, 0x32, 0xE2, 0x8B, 0x1D, 0x49, 0xE5,
-    0xBB, 0x82, 0x7F, 0x0D, 0xFF, 0x52, 0x06, 0xC6, 0xC4, 0x87, 0x54, 0x4C, 0xA3, 0x19, 0x9D, 0xB1,
-    0xCB, 0xC2, 0x6A, 0x93, 0x5A, 0x3A, 0xFA, 0x91, 0xDA, 0x36, 0xCF, 0x5A, 0x3A, 0x8C, 0xBA, 0xBE,
-    0x8C, 0xF7, 0x66, 0xED, 0x74, 0xE8, 0x14, 0xA4, 0x21, 0xC3, 0xFB, 0xA4, 0x74, 0x92, 0xE0, 0x0E,
-    0x83, 0xFA, 0x8A, 0x4C, 0x62, 0x6D, 0x51, 0xB4, 0x4B, 0x5E, 0x00, 0x24, 0x2D, 0x6F, 0x62, 0xC4,
-    0x33, 0x78, 0xAF, 0xAA, 0x90, 0x39, 0x78, 0xC3, 0x73, 0x3B, 0x1D, 0x3C, 0xAC, 0xBB, 0x8D, 0x8E,
-    0xA8, 0xDC, 0x0A, 0x23, 0xD8, 0xDF, 0x79, 0x8B, 0xA1, 0xA8, 0xF7, 0x89, 0x9E, 0xF1, 0x57, 0x5E,
-    0xB9, 0x51, 0x76, 0x45, 0x81, 0x99, 0x2C, 0x0A, 0x8C, 0xFE, 0xA3, 0xAE, 0x90, 0x63, 0x8D, 0x2A,
-    0xFA, 0xBF, 0x86, 0x58, 0xB7, 0xD5, 0x2C, 0x8E, 0x15, 0xA3, 0xAC, 0x6B, 0x26, 0x4E, 0x59, 0x70,
-    0x28, 0x42, 0x0A, 0x8C, 0x13, 0x10, 0xC4, 0x73, 0x2B, 0xA8, 0x4E, 0x5E, 0x05, 0x9F, 0x17, 0x44,
-    0xBA, 0x40, 0x31, 0x01, 0x0A, 0x74, 0x4B, 0x2F, 0x57, 0x75, 0x1B, 0x65, 0xEF, 0x29, 0xB2, 0x40,
-    0x61, 0xFB, 0x0F, 0x68, 0x52, 0x35, 0xC2, 0x36, 0xF8, 0x5C, 0x21, 0x95, 0xEC, 0xED, 0x38, 0x17,
-    0x08, 0x67, 0x78, 0x5F, 0x02, 0xE5, 0xDB, 0xAF, 0x0B, 0x0B, 0xFE, 0x71, 0xFB, 0x27, 0x95, 0x4C,
-    0xBD, 0x14, 0x03, 0x25, 0xF3, 0x58, 0x3F, 0x21, 0x30, 0x07, 0xD6, 0x74, 0xE4, 0xAD, 0xEB, 0x73,
-    0x31, 0x2E, 0x8D, 0xD6, 0x4F, 0x11, 0x5C, 0x57, 0x1B, 0x31, 0x40, 0x08, 0x10, 0xC1, 0xEE, 0xCF,
-    0x16, 0x0D, 0x2E, 0xFB, 0x0A, 0xD5, 0x4C, 0x9C, 0xDB, 0xB2, 0xE1, 0xA5, 0x05, 0x91, 0x3A, 0xB9,
-    0xD9, 0x68, 0xE7, 0x14, 0x81, 0x87, 0x4E, 0xA3, 0x27, 0x8D, 0x2C, 0x12, 0x37, 0x9F, 0xDD, 0xDD,
-    0xC5, 0x43, 0xD0, 0x06, 0x30, 0x6F, 0x69, 0x00, 0xB3, 0x8F, 0x78, 0x44, 0x03, 0x98, 0xB2, 0xD7,
-    0x0D, 0x60, 0x46, 0x74, 0x9A, 0xAC, 0x25, 0x16, 0x70, 0x79, 0x8D, 0xA1, 0x10, 0x91, 0x3C, 0x2B,
-    0xF8, 0xB6, 0x32, 0x72, 0x69, 0xF6, 0x2E, 0x2D, 0x1A, 0x8C, 0x16, 0x9C, 0x4A, 0xC1, 0x39, 0xB8,
-    0x6B, 0xC1, 0x29, 0x35, 0xE4, 0x54, 0xDF, 0xBC, 0x4E, 0xA7, 0x35, 0x72, 0xA9, 0x44, 0x3A, 0x8B,
-    0x67, 0x38, 0xBF, 0x23, 0x68, 0xE1, 0x5C, 0xD2, 0xD4, 0x96, 0xFA, 0x48, 0x3F, 0x45, 0x92, 0x9B,
-    0x1D, 0x7A, 0x0D, 0xF4, 0x32, 0x28, 0x3D, 0x87, 0x42, 0xD8, 0x4C, 0xF3, 0x17, 0x5E, 0xE9, 0xA8,
-    0x9F, 0x09, 0x0D, 0x65, 0xF4, 0x14, 0x81, 0xC6, 0xB9, 0x67, 0xC4, 0x13, 0x6D, 0x19, 0x61, 0x54,
-    0x18, 0x65, 0xD7, 0x7D, 0x5D, 0x57, 0xCF, 0x8D, 0x6F, 0x8B, 0xBC, 0x7D, 0x8F, 0xEF, 0xCF, 0xDC,
-    0x86, 0x5C, 0x33, 0x96, 0xEB, 0x93, 0x8A, 0xE2, 0x51, 0x20, 0x29, 0xB4, 0x37, 0xE5, 0x8C, 0x9A,
-    0x57, 0xC9, 0x40, 0xFA, 0x64, 0xF1, 0x16, 0xD2, 0x51, 0x21, 0x23, 0x35, 0x96, 0x34, 0x83, 0x02,
-    0x29, 0xC0, 0x54, 0xF0, 0x62, 0x31, 0xAF, 0x89, 0xC0, 0x2F, 0xB3, 0xE8, 0x99, 0x8B, 0x8F, 0xE5,
-    0x30, 0x90, 0x11, 0x79, 0xEF, 0xB8, 0xF1, 0xF8, 0x08, 0x74, 0x64, 0x7D, 0xC6, 0x63, 0xF7, 0x2E,
-    0xC0, 0xE2, 0x2D, 0x84, 0xFA, 0x06, 0xD2, 0x1E, 0x7E, 0x8E, 0x8B, 0x1F, 0xB4, 0xE5, 0x91, 0x04,
-    0x2B, 0x2B, 0xC9, 0x1A, 0x8B, 0x4D, 0xE7, 0x9A, 0x39, 0x2E, 0x01, 0x26, 0x97, 0x1E, 0x62, 0x9C,
-    0xB2, 0xE6, 0xFB, 0x3C, 0x87, 0xF5, 0x38, 0xB7, 0xB3, 0xF1, 0x45, 0x1D, 0x83, 0xA7, 0x98, 0xB4,
-    0x23, 0x74, 0xFC, 0xD8, 0x78, 0x70, 0x26, 0x49, 0x2D, 0xC5, 0xCA, 0xD4, 0xFC, 0x8D, 0xA1, 0x78,
-    0x3F, 0x11, 0x59, 0xFC, 0xD2, 0x37, 0xF3, 0xE6, 0x69, 0x09, 0x64, 0xFD, 0x2E, 0x32, 0xA1, 0xFC,
-    0x26, 0xDB, 0xB5, 0xF1, 0x1E, 0x9D, 0x0F, 0x4D, 0xC5, 0xA3, 0x29, 0xCA, 0xAE, 0x56, 0x1C, 0xFB,
-    0xC2, 0xBF, 0x94, 0xB7, 0x15, 0x3E, 0xF1, 0xE2, 0xE9, 0x9F, 0x64, 0xE1, 0x9B, 0x7F, 0xF1, 0xDD,
-    0xC1, 0xBF, 0x11, 0x90, 0x0C, 0x65, 0xB1, 0x5F, 0xA1, 0x38, 0x9B, 0x53, 0xDF, 0xA5, 0x30, 0x37,
-    0x9E, 0x48, 0x13, 0xFE, 0x97, 0x13, 0xB9, 0xB8, 0xE2, 0x71, 0xF5, 0xA7, 0x0C, 0xC2, 0xE0, 0x40,
-    0x3C, 0x19, 0x7F, 0x15, 0x94, 0xAC, 0xE1, 0x5E, 0x9B, 0x85, 0x1E, 0xAB, 0xF4, 0xAF, 0xAA, 0xC9,
-    0xD0, 0x48, 0x48, 0x63, 0x84, 0x71, 0x2A, 0x9F, 0x5E, 0x37, 0x02, 0x81, 0xBF, 0xDC, 0xD2, 0xBF,
-    0xD3, 0x78, 0x3E, 0xE4, 0xD0, 0x41, 0x29, 0xF7, 0xFF, 0x1E, 0xF5, 0xD3, 0x6F, 0x46, 0x4D, 0xFD,
-    0x74, 0x53, 0x14, 0x78, 0xAD, 0xA9, 0x9F, 0x22, 0xEC, 0x60, 0x19, 0xA5, 0xFF, 0xE0, 0xAB, 0x67,
-    0xEC, 0x0E, 0xFD, 0x29, 0x0B, 0x28, 0x18, 0x33, 0x14, 0xEC, 0xD3, 0xE3, 0x8A, 0x7D, 0x6B, 0x54,
-    0xC5, 0x20, 0xDC, 0x87, 0x25, 0x55, 0x63, 0xB7, 0x85, 0x20, 0xC2, 0x08, 0xC7, 0xD6, 0x33, 0x66,
-    0xDE, 0x8C, 0x23, 0x30, 0x2A, 0x76, 0x58, 0xCC, 0x1C, 0x45, 0x64, 0x1C, 0xAB, 0x88, 0x54, 0x2F,
-    0x42, 0x9A, 0x9E, 0x02, 0x80, 0x90, 0x66, 0x0D, 0x95, 0x38, 0x02, 0xC5, 0x0E, 0x49, 0xFA, 0x67,
-    0x81, 0xC2, 0x54, 0x2B, 0xA1, 0x07, 0x4D, 0xB0, 0xE6, 0xFF, 0x14, 0x7B, 0x2C, 0x99, 0xFA, 0xAA,
-    0xB8, 0xDA, 0x13, 0x8D, 0xB8, 0xBD, 0x28, 0x1A, 0xA1, 0x95, 0x32, 0x0A, 0x6B, 0x71, 0x36, 0xB1,
-    0xF9, 0x27, 0xBF, 0xBF, 0xBE, 0x21, 0x1C, 0xDE, 0xB0, 0xFB, 0x45, 0xBA, 0x1B, 0x01, 0x8D, 0x81,
-    0x8E, 0xAC, 0x04, 0x32, 0x33, 0x0E, 0x34, 0x03, 0xF3, 0x55, 0x45, 0xE1, 0x17, 0x1C, 0x61, 0x46,
-    0xB4, 0xE5, 0xA6, 0x81, 0xF5, 0xDC, 0x97, 0x20, 0x63, 0x51, 0xE0, 0xB9, 0x9A, 0x37, 0xF1, 0x90,
-    0x05, 0xE0, 0x19, 0x00, 0x28, 0x1F, 0x60, 0x41, 0x25, 0xC8, 0x0B, 0xBD, 0xA5, 0x53, 0x8D, 0x97,
-    0x89, 0x48, 0xCF, 0xED, 0x3A, 0x5B, 0x91, 0x4A, 0xAA, 0x70, 0x30, 0x90, 0xA8, 0x3B, 0x5E, 0x00,
-    0x85, 0xF9, 0xEE, 0xC8, 0xD5, 0x9F, 0x71, 0x06, 0x31, 0x3A, 0xEF, 0x57, 0x92, 0x1E, 0xB1, 0xFD,
-    0x1C, 0x0C, 0x89, 0xA3, 0xD7, 0xF7, 0x09, 0x71, 0x08, 0x33, 0xA9, 0xF9, 0xCF, 0x37, 0x10, 0xD4,
-    0x2B, 0xFC, 0x31, 0x87, 0x2D, 0xF3, 0x75, 0x61, 0x6A, 0xEF, 0xD3, 0x2C, 0x32, 0xA3, 0xF8, 0xED,
-    0x6A, 0x8D, 0xD3, 0x11, 0xEE, 0xB4, 0x5F, 0xD2, 0x36, 0xB2, 0xB5, 0x1B, 0x4E, 0x71, 0x0D, 0x6D,
-    0xE8, 0x5D, 0xC5, 0x4B, 0xFF, 0x99, 0xEC, 0x4D, 0x73, 0x98, 0x9A, 0xD9, 0xF7, 0x3E, 0x5A, 0x3B,
-    0xA6, 0x9F, 0xCB, 0x97, 0x9E, 0xFE, 0xCA, 0x43, 0xBD, 0xD0, 0xB9, 0xF8, 0x60, 0x6E, 0x71, 0xBC,
-    0xCA, 0xE0, 0x2D, 0x8B, 0x5F, 0x74, 0x98, 0x3F, 0x68, 0xC0, 0x33, 0x33, 0xEC, 0x1A, 0x0A, 0xAE,
-    0x26, 0xE7, 0xA0, 0x5B, 0xDC, 0xD6, 0x20, 0x8F, 0xC6, 0x92, 0xEC, 0xC6, 0xE2, 0x29, 0x2B, 0x16,
-    0x24, 0x7B, 0x34, 0x31, 0x7B, 0xC1, 0x54, 0x56, 0x64, 0x30, 0x95, 0xD5, 0xE9, 0xD7, 0x92, 0x6F,
-    0xFB, 0xB5, 0x41, 0xAC, 0x2E, 0xD4, 0xFB, 0x16, 0xF5, 0x67, 0x7A, 0x8D, 0x5E, 0xAF, 0xF7, 0x2A,
-    0x1F, 0xC9, 0xCE, 0xC3, 0x71, 0x02, 0xFE, 0xE2, 0x32, 0x93, 0x52, 0xFA, 0x95, 0xFC, 0x53, 0x5C,
-    0x26, 0xA5, 0xB3, 0x82, 0x97, 0x7A, 0x4F, 0x55, 0x04, 0x4B, 0xDA, 0xBE, 0x7A, 0x79, 0x63, 0x99,
-    0xE6, 0x28, 0xB6, 0xF0, 0xB1, 0x24, 0x0B, 0x36, 0x62, 0xBC, 0xF6, 0x27, 0xBC, 0xF6, 0x99, 0x53,
-    0x1F, 0x09, 0x6E, 0xC6, 0x9C, 0x79, 0xED, 0xF7, 0x87, 0x85, 0xF4, 0x24, 0xCA, 0x58, 0x72, 0x27,
-    0xF1, 0xA8, 0x25, 0xC6, 0x91, 0x12, 0x97, 0xE0, 0x62, 0x1E, 0x4D, 0x9A, 0x83, 0x41, 0x5C, 0x31,
-    0x2B, 0x30, 0xE5, 0x65, 0xBB, 0xD3, 0x5D, 0xFB, 0xDE, 0xAE, 0xCB, 0x81, 0xC3, 0x36, 0x1B, 0x46,
-    0x30, 0xD5, 0x1F, 0x6B, 0x69, 0x0A, 0x75, 0x0E, 0x2D, 0x2A, 0x26, 0xED, 0x6E, 0x76, 0x58, 0x37,
-    0xA3, 0x16, 0x2B, 0x41, 0xB0, 0x18, 0xCB, 0x86, 0x49, 0xEF, 0x11, 0x16, 0x66, 0x26, 0x65, 0x16,
-    0xBE, 0x77, 0x1D, 0x35, 0x5F, 0xA9, 0xD5, 0x7B, 0xE8, 0x62, 0x8C, 0xEA, 0x0A, 0x4A, 0x72, 0x8D,
-    0xB8, 0x8E, 0x1B, 0x21, 0xAD, 0x05, 0x62, 0xFF, 0x00, 0x95, 0xDD, 0xB8, 0x92, 0x1D, 0x84, 0x54,
-    0x62, 0x0E, 0xAA, 0x45, 0xC3, 0xFC, 0x4A, 0x92, 0xCD, 0x30, 0x0F, 0xCA, 0x79, 0x63, 0xBC, 0x3C,
-    0x7A, 0x81, 0xA9, 0x62, 0xB7, 0x8F, 0xA7, 0x19, 0x4E, 0x24, 0xAE, 0xAA, 0xDF, 0xE0, 0x4B, 0x07,
-    0x28, 0x78, 0x0D, 0x19, 0x02, 0xDD, 0x89, 0x58, 0x3F, 0x09, 0x0C, 0x74, 0x33, 0x39, 0xAC, 0x9A,
-    0xB8, 0xD6, 0xD5, 0xE2, 0xCE, 0xA6, 0xA8, 0x5E, 0xAC, 0x02, 0x06, 0x17, 0xE7, 0x37, 0x3D, 0xFC,
-    0x4A, 0x98, 0xBD, 0x2B, 0xD5, 0xBA, 0x40, 0x8E, 0x6A, 0x44, 0xC3, 0x7D, 0xF1, 0xE1, 0x50, 0xFE,
-    0x26, 0x36, 0x91, 0x0C, 0x20, 0x12, 0x2F, 0xC0, 0xA9, 0x46, 0xCE, 0x9E, 0x39, 0x19, 0x71, 0xAA,
-    0x11, 0x56, 0x81, 0x54, 0xE1, 0x59, 0x5A, 0xFE, 0x94, 0x3B, 0xF6, 0x6A, 0x91, 0x54, 0x2D, 0x13,
-    0x9D, 0x75, 0x48, 0x65, 0x49, 0x8D, 0x4B, 0x70, 0x31, 0x3B, 0xF9, 0x60, 0x02, 0x06, 0x24, 0xA5,
-    0x3B, 0x65, 0x1A, 0x9A, 0xC3, 0x36, 0xD5, 0xB8, 0xDD, 0xD6, 0xBB, 0xCF, 0xC4, 0x9D, 0xED, 0x8E,
-    0x6D, 0xE8, 0x44, 0x05, 0x9D, 0x58, 0x5F, 0x1D, 0x9D, 0xD0, 0xD1, 0x0A, 0xBF, 0xBB, 0x4D, 0xF1,
-    0x68, 0x83, 0x45, 0x32, 0xD9, 0x14, 0xED, 0xB8, 0xB0, 0x28, 0xDA, 0x61, 0x3B, 0xF6, 0x4C, 0x86,
-    0x8A, 0xF1, 0x37, 0x52, 0xE0, 0xFD, 0x50, 0x62, 0xCD, 0x73, 0xBA, 0x93, 0xD6, 0x89, 0xC3, 0x69,
-    0x75, 0xF4, 0xC5, 0x46, 0xE7, 0xD9, 0x0D, 0x9E, 0xF8, 0x21, 0x2F, 0xF8, 0xAF, 0x38, 0x94, 0x0F,
-    0xF2, 0xBE, 0x8B, 0x86, 0x43, 0x31, 0x13, 0xB1, 0xF8, 0xC7, 0x45, 0x01, 0x09, 0xB1, 0xB7, 0x75,
-    0xE8, 0x16, 0x86, 0x6D, 0x9C, 0x1E, 0x04, 0x0C, 0xC3, 0x70, 0x48, 0xDD, 0x08, 0x7C, 0xA5, 0x42,
-    0x2A, 0x5F, 0xCA, 0xB3, 0x91, 0xCC, 0x39, 0x91, 0xCC, 0x20, 0x15, 0x94, 0xA6, 0x8B, 0xA0, 0x36,
-    0xCF, 0x0B, 0xBD, 0x6C, 0x9E, 0xA8, 0x19, 0x0C, 0x91, 0xC6, 0xBF, 0xFE, 0xA4, 0x7B, 0x10, 0xD7,
-    0xE6, 0xEA, 0x6B, 0x36, 0x42, 0xE1, 0x39, 0x4E, 0x80, 0x1B, 0x4F, 0x55, 0x80, 0xE3, 0x8B, 0x81,
-    0xDC, 0x58, 0xA1, 0xAB, 0x80, 0xDD, 0x17, 0x43, 0x80, 0x37, 0x23, 0x45, 0x8F, 0x54, 0xEC, 0xA4,
-    0x18, 0x90, 0x02, 0x42, 0x8A, 0x0E, 0x29, 0x54, 0xA4, 0xB8, 0xFD, 0x8F, 0x86, 0x7F, 0xB3, 0x57,
-    0xDA, 0xFB, 0x2C, 0x17, 0xCB, 0x53, 0xB1, 0x24, 0x05, 0x93, 0x14, 0x4D, 0xB2, 0x70, 0x5A, 0x3C,
-    0x2D, 0xA0, 0x0E, 0x51, 0x07, 0x69, 0xEF, 0x61, 0x8B, 0xA0, 0x6E, 0x81, 0xB5, 0xB5, 0x55, 0x11,
-    0xCF, 0x59, 0xD4, 0x38, 0xB4, 0x86, 0xC1, 0x94, 0xC5, 0xC9, 0x57, 0x31, 0x70, 0xD1, 0x50, 0x84,
-    0x1C, 0xE5, 0x02, 0x5D, 0x02, 0xEC, 0x26, 0x00, 0x4F, 0x30, 0xC0, 0x25, 0x18, 0x02, 0x60, 0x22,
-    0xC0, 0x36, 0x47, 0x4D, 0x43, 0x4B, 0x7B, 0xA5, 0xDE, 0x05, 0x1C, 0x75, 0x25, 0x28, 0x92, 0x16,
-    0x4A, 0xC5, 0xD2, 0x82, 0xD9, 0x9B, 0xDB, 0x09, 0xB3, 0x70, 0x35, 0x87, 0x3E, 0xB5, 0xEE, 0xEF,
-    0x37, 0x67, 0x85, 0x57, 0x0A, 0x2F, 0xEF, 0x71, 0xA7, 0x6C, 0xA0, 0x1B, 0x97, 0x3A, 0x61, 0x3D,
-    0xBD, 0x45, 0x9F, 0x01, 0xAF, 0xF5, 0xC5, 0xC2, 0xCB, 0x5A, 0x42, 0x9B, 0xDB, 0xB8, 0xE4, 0xC6,
-    0x66, 0x37, 0x16, 0x37, 0xCD, 0x6F, 0x6C, 0x82, 0x63, 0x33, 0x1C, 0x49, 0x71, 0x56, 0x4B, 0xDB,
-    0x90, 0x00, 0x69, 0x06, 0xA4, 0x29, 0x90, 0xCD, 0x81, 0x14, 0x44, 0x64, 0x41, 0xF6, 0x8C, 0xB9,
-    0x0F, 0xCD, 0xE3, 0x44, 0x68, 0xA1, 0x90, 0xF4, 0x7E, 0xE3, 0x4E, 0x77, 0xFE, 0x11, 0x16, 0xFE,
-    0xEF, 0x15, 0xE2, 0x73, 0x23, 0x20, 0xDD, 0xF0, 0x6C, 0x7D, 0x6A, 0x6D, 0xC5, 0x40, 0xBB, 0xA3,
-    0x3E, 0x7A, 0x78, 0x59, 0x4E, 0x0E, 0x4C, 0x38, 0x1D, 0x8C, 0x7C, 0x29, 0xCA, 0x9F, 0xA7, 0xC1,
-    0xE8, 0x2C, 0x42, 0xF4, 0xC5, 0x52, 0x36, 0x5A, 0x39, 0x17, 0x35, 0x17, 0x77, 0x58, 0x57, 0x75,
-    0xA4, 0x09, 0x5D, 0x64, 0x7B, 0xB6, 0x53, 0x72, 0x5F, 0x20, 0x44, 0x6C, 0xF4, 0x61, 0x7D, 0x96,
-    0x1E, 0x24, 0xD3, 0xF7, 0x88, 0x40, 0x06, 0x9C, 0xD9, 0xA5, 0x66, 0x6C, 0x1B, 0x5F, 0x66, 0xAF,
-    0xC5, 0x67, 0x71, 0xC3, 0x27, 0xD1, 0xEC, 0x69, 0x4D, 0x77, 0x82, 0x92, 0xB2, 0x44, 0x6E, 0x69,
-    0x09, 0x17, 0x93, 0x1C, 0x2A, 0x8E, 0x52, 0x03, 0x46, 0x00, 0x37, 0x6E, 0x4E, 0x95, 0xB4, 0xAF,
-    0xBD, 0xEE, 0x99, 0x1B, 0x7F, 0xD6, 0xFD, 0xD4, 0x39, 0x01, 0x9E, 0xCE, 0xA4, 0x46, 0xF9, 0xE6,
-    0x4C, 0xCA, 0x94, 0x22, 0x39, 0xEC, 0xA0, 0x7D, 0x3F, 0xB4, 0x40, 0x85, 0x74, 0x90, 0xC9, 0x29,
-    0xDE, 0xB4, 0x4C, 0x06, 0x62, 0xAA, 0xEA, 0xC1, 0xD7, 0x3C, 0xEC, 0x4A, 0xC2, 0xF1, 0x8B, 0xF4,
-    0x12, 0xC1, 0x2C, 0x56, 0x90, 0x35, 0x69, 0x11, 0xF6, 0x0E, 0x28, 0xFA, 0xE1, 0x78, 0xEE, 0x50,
-    0x91, 0x2E, 0xBD, 0x54, 0x97, 0xDE, 0x26, 0xB5, 0x1B, 0x72, 0xB2, 0x01, 0xD4, 0xD9, 0xD6, 0x59,
-    0x05, 0x6C, 0x2F, 0xED, 0xB6, 0x1E, 0x7C, 0x0C, 0x97, 0x9D, 0x75, 0xAA, 0x93, 0x3D, 0xA0, 0xAB,
-    0x07, 0xC7, 0xD4, 0x77, 0x87, 0x47, 0xF6, 0x2A, 0x4E, 0x1C, 0x6D, 0x7B, 0xF6, 0x5D, 0xB7, 0x5A,
-    0x09, 0xFA, 0xDC, 0x3D, 0x83, 0xEB, 0x8E, 0x4C, 0xBB, 0x67, 0xEC, 0x24, 0x3B, 0xBB, 0x6E, 0xDF,
-    0x16, 0x39, 0xC0, 0x9B, 0x14, 0x43, 0xB4, 0xD3, 0x7E, 0x0E, 0x14, 0xA7, 0x71, 0xA6, 0x62, 0x4D,
-    0xAC, 0x78, 0x1F, 0x68, 0x5B, 0x54, 0xDA, 0x7E, 0x4E, 0x8D, 0xD8, 0x8F, 0xA5, 0xDD, 0xA3, 0x06,
-    0x58, 0x87, 0xAC, 0x83, 0xD6, 0x61, 0xDB, 0x80, 0xEB, 0xD0, 0x6D, 0x55, 0xD7, 0xA5, 0x40, 0xF9,
-    0xF3, 0x52, 0xA0, 0x5E, 0x86, 0x14, 0x48, 0xCF, 0xC8, 0x51, 0xDF, 0x99, 0x60, 0x80, 0x1B, 0x8C,
-    0x80, 0x6E, 0x30, 0x04, 0xBC, 0x51, 0x0E, 0x74, 0x0E, 0x14, 0xA4, 0x91, 0xC3, 0xEA, 0x55, 0x1B,
-    0xC5, 0xDA, 0x82, 0x6D, 0xD1, 0xB6, 0x70, 0x3B, 0xBC, 0x1D, 0xE0, 0xF7, 0xB2, 0xEE, 0xF6, 0x6B,
-    0x0B, 0xB8, 0x8D, 0x94, 0x9D, 0x16, 0x37, 0x9A, 0x2B, 0x13, 0x3B, 0x45, 0x88, 0x6B, 0x8D, 0x82,
-    0x22, 0xFD, 0xD2, 0xB7, 0xB9, 0xD4, 0xC1, 0xDC, 0x99, 0x66, 0x36, 0x82, 0x82, 0x38, 0xEB, 0xC2,
-    0x52, 0x20, 0xEE, 0x02, 0x50, 0x6B, 0xAE, 0x5B, 0x7B, 0xED, 0xA0, 0xB6, 0x16, 0xDB, 0x99, 0xEC,
-    0x06, 0x79, 0x6B, 0xB4, 0xC5, 0x6A, 0x9F, 0x26, 0x9D, 0x57, 0x9B, 0xEE, 0xD2, 0x32, 0xB5, 0xEA,
-    0xCE, 0xAC, 0xDB, 0xB4, 0xAC, 0x67, 0x1F, 0xE7, 0x1A, 0xB9, 0xB4, 0xAC, 0x87, 0x42, 0xE2, 0x72,
-    0xAC, 0x87, 0x9E, 0xB5, 0x00, 0x83, 0x71, 0x98, 0xE9, 0x44, 0x7F, 0x8C, 0x55, 0x50, 0x16, 0x90,
-    0x87, 0x3F, 0x8C, 0xA7, 0x8D, 0xB1, 0x3F, 0x45, 0xB8, 0xBF, 0x28, 0x89, 0x83, 0xD8, 0xD6, 0x96,
-    0x03, 0xE2, 0xF6, 0x18, 0xC4, 0x29, 0x71, 0xD3, 0xF3, 0x31, 0x76, 0x13, 0x56, 0xDB, 0x28, 0xBB,
-    0xF9, 0xDC, 0x89, 0xB3, 0xAD, 0x16, 0x2C, 0x0D, 0x9C, 0x2F, 0xCA, 0xF4, 0x34, 0x30, 0x7F, 0x4C,
-    0x9D, 0x42, 0x98, 0xAD, 0x84, 0xB9, 0xDA, 0x9F, 0x8D, 0x57, 0x5C, 0x28, 0xB7, 0xDE, 0x3D, 0x14,
-    0x31, 0xF5, 0x8C, 0xC9, 0x6C, 0x23, 0xE3, 0x89, 0x26, 0x60, 0x22, 0xE7, 0x19, 0x39, 0x6B, 0x15,
-    0xE6, 0x1C, 0x2F, 0xC8, 0x99, 0x62, 0xCE, 0x53, 0x13, 0xED, 0x75, 0x53, 0xF7, 0x18, 0xEE, 0xAB,
-    0x9B, 0xD4, 0x5D, 0x7A, 0xCD, 0xB0, 0x8B, 0xB7, 0x35, 0xCF, 0xFC, 0x48, 0x9F, 0x20, 0xF8, 0x52,
-    0x07, 0x51, 0x77, 0x1F, 0x16, 0x0A, 0x26, 0xFF, 0x6F, 0xA3, 0xF7, 0xA1, 0x84, 0x4E, 0x7E, 0x61,
-    0x70, 0x7A, 0xDE, 0xE0, 0x14, 0xE0, 0xA5, 0x9D, 0x56, 0x0E, 0xC1, 0xB8, 0xF3, 0xC0, 0xFB, 0xAD,
-    0x4E, 0x89, 0xDA, 0x3B, 0xB2, 0x50, 0x8C, 0x19, 0xF6, 0xCD, 0x70, 0xCB, 0xE4, 0x1B, 0x26, 0x17,
-    0xA6, 0x53, 0xF4, 0x30, 0x81, 0xC7, 0x97, 0x4D, 0x41, 0x38, 0x45, 0x83, 0xF3, 0x37, 0x83, 0x0C,
-    0xF3, 0xCF, 0x79, 0x1D, 0xC8, 0xE3, 0xDC, 0xF2, 0x3C, 0x43, 0x99, 0xE0, 0x88, 0xE2, 0x75, 0x04,
-    0xCE, 0x9B, 0x18, 0xA5, 0xC8, 0xC1, 0x9B, 0x62, 0x7D, 0xD5, 0x18, 0x4A, 0x51, 0xB5, 0x3E, 0x55,
-    0x2B, 0xC8, 0x7A, 0x46, 0x54, 0x8F, 0x98, 0xF7, 0x3B, 0x23, 0xDC, 0x6F, 0x77, 0x75, 0x75, 0x87,
-    0x77, 0xAB, 0xC4, 0x52, 0x90, 0x0B, 0xFB, 0x4F, 0x97, 0x1F, 0xA0, 0x23, 0x2F, 0x4D, 0xF9, 0xDD,
-    0x0D, 0xAE, 0xBF, 0x69, 0xF7, 0xA9, 0xF7, 0x05, 0x42, 0x08, 0xA3, 0xDD, 0x97, 0xAE, 0xBD, 0x89,
-    0xD0, 0x10, 0x8F, 0xBB, 0x6C, 0x95, 0xDE, 0x78, 0x0E, 0x21, 0x92, 0xA7, 0x41, 0x14, 0x2A, 0x08,
-    0xF5, 0x86, 0x55, 0x3A, 0xFB, 0x10, 0x63, 0x62, 0xF3, 0xE6, 0xEE, 0xBF, 0xCB, 0xB0, 0x73, 0xF5,
-    0x76, 0x56, 0x45, 0x11, 0xE9, 0x5E, 0x8E, 0x92, 0x20, 0xFE, 0x1B, 0x46, 0x89, 0x7D, 0xA4, 0xEE,
-    0x13, 0x16, 0x1B, 0xE3, 0xF6, 0x51, 0xDC, 0x2B, 0xD4, 0xD2, 0x65, 0x55, 0x4A, 0xA2, 0xD7, 0xEC,
-    0xB0, 0x47, 0x31, 0x84, 0x50, 0x4B, 0xD7, 0xC1, 0x07, 0x78, 0xC2, 0x24, 0xCC, 0x6C, 0x75, 0xDF,
-    0x5B, 0x15, 0x74, 0x75, 0x9D, 0xC6, 0x72, 0xCC, 0x95, 0xFA, 0xE6, 0xAF, 0x3C, 0x84, 0x9B, 0x78,
-    0x82, 0xE3, 0x3D, 0x5F, 0x9F, 0x30, 0x5B, 0x5B, 0x66, 0x2C, 0xFF, 0x0B, 0xBD, 0x59, 0xBD, 0x93,
-    0xDC, 0x48, 0x15, 0x7F, 0x92, 0xBC, 0x2B, 0x38, 0x15, 0xC8, 0x81, 0x97, 0x3A, 0x7F, 0xD4, 0xEA,
-    0x02, 0x07, 0xBE, 0x2D, 0x76, 0x95, 0x10, 0x38, 0xD8, 0x5D, 0x35, 0xE5, 0x80, 0xD4, 0x81, 0xF7,
-    0x82, 0xA3, 0x0A, 0x13, 0x5C, 0xE4, 0xC4, 0x97, 0x5C, 0x95, 0x0B, 0xD6, 0xAB, 0xE6, 0x2E, 0x20,
-    0x20, 0x60, 0xFF, 0x04, 0x07, 0xBE, 0x2A, 0x6E, 0xA9, 0x62, 0xAF, 0x0A, 0x57, 0xE1, 0x02, 0xDB,
-    0x6A, 0x93, 0x92, 0xE8, 0xE0, 0x0F, 0x38, 0x05, 0x7C, 0x14, 0x38, 0x40, 0x18, 0xC1, 0x8D, 0x97,
-    0x19, 0x35, 0xBF, 0xF7, 0x5A, 0x33, 0xA3, 0x99, 0x5D, 0x9B, 0x2D, 0x3C, 0xA0, 0x51, 0x3F, 0xB5,
-    0xFA, 0xE3, 0xF5, 0xEB, 0xF7, 0xDD, 0x9A, 0xEB, 0xF5, 0x2B, 0xAE, 0x73, 0x9E, 0x5A, 0x0F, 0x75,
-    0xF4, 0x1D, 0xF2, 0x07, 0xE4, 0x35, 0x14, 0x8E, 0x68, 0xF5, 0x5F, 0xEA, 0xEA, 0x73, 0x43, 0x35,
-    0x2D, 0xE0, 0xBE, 0x4E, 0xF4, 0x80, 0x68, 0x9D, 0x6E, 0x1D, 0x2A, 0x6B, 0x75, 0xBD, 0x4A, 0xF5,
-    0x1D, 0xAA, 0xEF, 0x2D, 0x00, 0xF1, 0x3D, 0x22, 0x4F, 0x51, 0xA8, 0x69, 0x95, 0x68, 0xEF, 0x40,
-    0x15, 0xD6, 0xAC, 0x07, 0x26, 0xBA, 0x66, 0xFC, 0x8F, 0x0C, 0x05, 0xAF, 0x7F, 0xEB, 0xB5, 0x83,
-    0xFB, 0x99, 0x1D, 0xE0, 0x26, 0xA2, 0x7E, 0x3D, 0xB7, 0xD6, 0x36, 0x05, 0x83, 0x95, 0x9D, 0x9D,
-    0x1D, 0x6C, 0x0F, 0x57, 0x86, 0x57, 0x2B, 0x80, 0x66, 0x2F, 0x69, 0xE3, 0x6B, 0x30, 0xAD, 0xD1,
-    0x09, 0xD7, 0xAB, 0xC7, 0x5D, 0x5E, 0xA6, 0xDD, 0x58, 0xFD, 0x3F, 0xEF, 0x09, 0x51, 0x5A, 0xC0,
-    0x94, 0x94, 0xB5, 0x83, 0x83, 0x03, 0x25, 0x6D, 0x52, 0xA3, 0xB7, 0xFC, 0x3A, 0xD6, 0xEB, 0xB4,
-    0x4B, 0x8F, 0xC8, 0x92, 0x35, 0xB6, 0xCC, 0xCD, 0x05, 0x15, 0xE9, 0xAC, 0xCA, 0xEA, 0xAC, 0x89,
-    0x6A, 0xAF, 0xF6, 0xAA, 0xC0, 0x24, 0x6A, 0x44, 0xFB, 0x84, 0xD6, 0x3A, 0xAB, 0xD3, 0x26, 0x9C,
-    0xB4, 0x0E, 0xD1, 0x7A, 0x41, 0xE5, 0x98, 0x85, 0x99, 0xC0, 0xB0, 0x0B, 0x3D, 0x89, 0xB5, 0x5F,
-    0xD3, 0x5B, 0xF8, 0x7D, 0xD7, 0xAF, 0xC3, 0x2A, 0xD6, 0x89, 0x5A, 0xA7, 0x4D, 0xF4, 0x34, 0xE8,
-    0x6F, 0xC8, 0x7A, 0x23, 0xB2, 0x4F, 0xAD, 0xB6, 0x9F, 0x59, 0x83, 0x79, 0xFA, 0x82, 0xDA, 0x00,
-    0xDE, 0x0B, 0x2A, 0xAB, 0x72, 0x93, 0xD5, 0x45, 0x95, 0x35, 0x79, 0x1D, 0xD5, 0x49, 0xE5, 0xD5,
-    0x41, 0xC5, 0x6B, 0x04, 0x26, 0x04, 0x86, 0x94, 0x46, 0xDE, 0x80, 0xF6, 0x3D, 0x8D, 0xB1, 0x89,
-    0xCA, 0xEA, 0xBC, 0xE4, 0xB1, 0x69, 0x93, 0xD5, 0x61, 0x1D, 0xF3, 0xD8, 0x72, 0x3A, 0x76, 0x83,
-    0x86, 0x32, 0x56, 0x11, 0xE3, 0xE6, 0x35, 0x78, 0x2D, 0x59, 0x13, 0x6B, 0x33, 0x0D, 0x4C, 0x0B,
-    0xD3, 0xC4, 0xB4, 0x31, 0x8D, 0x4C, 0x2B, 0xBD, 0x01, 0x1E, 0x25, 0x86, 0x28, 0xEE, 0x17, 0xB4,
-    0x45, 0x5C, 0x14, 0x5D, 0x0F, 0xD5, 0xD9, 0xC2, 0x16, 0xAC, 0x37, 0xCD, 0x8D, 0x48, 0xBD, 0x27,
-    0xFD, 0x3C, 0x3E, 0x2D, 0x51, 0x2A, 0xD4, 0xCB, 0x13, 0xE6, 0x77, 0x38, 0x7A, 0x78, 0x26, 0x25,
-    0xE4, 0x42, 0xB3, 0x85, 0x2F, 0xA6, 0xE3, 0x18, 0x0D, 0x8A, 0x54, 0x84, 0xF5, 0x9F, 0x1D, 0xCA,
-    0xFA, 0x1F, 0x47, 0xDF, 0x9C, 0x5D, 0x9F, 0xEB, 0x8C, 0x9F, 0x71, 0x04, 0x5D, 0x61, 0xFC, 0x3C,
-    0x57, 0xE8, 0x2A, 0x27, 0xB8, 0x9E, 0x7C, 0xFB, 0x1D, 0xC1, 0xC1, 0x4F, 0x47, 0x4B, 0x47, 0xDF,
-    0x78, 0x3D, 0xC6, 0x89, 0xCB, 0xFB, 0x25, 0xC5, 0xB6, 0x4C, 0x6D, 0x9D, 0xD9, 0xC6, 0x59, 0x8E,
-    0xBB, 0xD1, 0x12, 0xDB, 0xCA, 0xB7, 0xAA, 0x23, 0xF7, 0x1B, 0xAC, 0x66, 0x78, 0xC9, 0x1A, 0x56,
-    0x37, 0x85, 0xD2, 0xB0, 0xDA, 0x41, 0xC3, 0x46, 0x78, 0x96, 0x94, 0x8D, 0xD0, 0x8E, 0xE5, 0xB7,
-    0x30, 0xEE, 0x2C, 0x4A, 0x0A, 0x89, 0x14, 0xF8, 0xF1, 0x9C, 0x94, 0xE8, 0x61, 0x61, 0x82, 0x16,
-    0xC5, 0xF2, 0x33, 0x53, 0xDE, 0x90, 0x71, 0x6E, 0x88, 0x17, 0xDB, 0xB7, 0x3A, 0x18, 0x51, 0x52,
-    0x5B, 0x0D, 0x87, 0x96, 0xD6, 0xDD, 0x5B, 0x4E, 0xFE, 0x90, 0xE2, 0xAA, 0x5B, 0x7D, 0xA3, 0x87,
-    0xED, 0xD6, 0x81, 0xB6, 0xD6, 0x2C, 0xC4, 0xE5, 0xB9, 0xFB, 0x53, 0x22, 0x18, 0x08, 0x70, 0x2E,
-    0xC2, 0x1B, 0x4D, 0xDD, 0x52, 0x0E, 0x13, 0x3B, 0xE9, 0x5E, 0x08, 0xD1, 0xC0, 0xF3, 0xBD, 0x03,
-    0xFD, 0x3E, 0xD1, 0xE4, 0xFE, 0x60, 0x47, 0x2D, 0x10, 0xF9, 0xDA, 0x01, 0x64, 0x39, 0xBD, 0x57,
-    0x76, 0x16, 0x46, 0x79, 0xFF, 0xF2, 0x6C, 0xC5, 0x11, 0x47, 0xAE, 0xF0, 0x9F, 0xD0, 0x89, 0x5D,
-    0x57, 0x8F, 0xCD, 0x1E, 0x51, 0xE7, 0x56, 0x53, 0x9D, 0x91, 0xD7, 0x4D, 0xCB, 0x54, 0xAA, 0x83,
-    0x4E, 0x27, 0x32, 0x4A, 0x4D, 0x68, 0xC6, 0xF5, 0xC4, 0xC4, 0x9D, 0xEF, 0xCB, 0x51, 0x4F, 0x68,
-    0x5A, 0xDF, 0xEE, 0xD5, 0x77, 0x69, 0x3A, 0x77, 0x40, 0xD0, 0x25, 0x4F, 0x70, 0xFE, 0xA0, 0x4E,
-    0x5A, 0xA2, 0x62, 0xC0, 0x6B, 0x5D, 0xAB, 0x9E, 0xDC, 0x34, 0xFE, 0x8B, 0x02, 0x34, 0x64, 0xA1,
-    0x19, 0x86, 0x55, 0x58, 0xA5, 0x3A, 0xAA, 0x86, 0xF1, 0x87, 0x4D, 0x50, 0xC7, 0x65, 0x6C, 0x7C,
-    0xDB, 0x24, 0x41, 0xE3, 0x37, 0xB1, 0x89, 0x4B, 0x5A, 0x51, 0xDB, 0x41, 0xED, 0x0F, 0xB0, 0x3A,
-    0x53, 0xB5, 0x1B, 0xD6, 0xFE, 0x30, 0x35, 0x11, 0xD7, 0x07, 0xD3, 0xBA, 0x57, 0x4F, 0xEB, 0x41,
-    0x35, 0xAD, 0x87, 0x66, 0x3A, 0x37, 0xD6, 0xA8, 0x3B, 0x9C, 0x94, 0x90, 0xDF, 0xAD, 0x45, 0x04,
-    0xEA, 0x85, 0x86, 0x44, 0x0B, 0x73, 0x9E, 0x24, 0x26, 0x18, 0xE4, 0x24, 0xCC, 0x49, 0xAD, 0xD0,
-    0xEC, 0x18, 0x89, 0xE8, 0xB6, 0xA4, 0x8E, 0x05, 0xAB, 0x3E, 0x7F, 0xE7, 0x79, 0x3C, 0xCF, 0xE7,
-    0x79, 0x5E, 0xCF, 0xF3, 0x7B, 0x9E, 0xE7, 0xF3, 0x7C, 0x9F, 0xE7, 0xFD, 0x3C, 0xFF, 0xE7, 0x65,
-    0x30, 0x2F, 0x07, 0x3A, 0x33, 0x2B, 0x0B, 0x1F, 0xFA, 0x96, 0xAA, 0x9E, 0x3C, 0xFE, 0x38, 0x98,
-    0x91, 0x49, 0xAA, 0x1F, 0x53, 0x5F, 0x2E, 0x19, 0xB0, 0xF7, 0x65, 0x93, 0x03, 0x7B, 0x5F, 0x3E,
-    0x4F, 0xC4, 0x7D, 0x4D, 0x65, 0xD4, 0xBD, 0x4F, 0xE4, 0xD4, 0x52, 0xA6, 0xFB, 0xB2, 0x72, 0xEF,
-    0x53, 0x79, 0xB9, 0xF1, 0x53, 0x99, 0xB9, 0xF7, 0xA9, 0xDC, 0x64, 0xBD, 0x9E, 0xEC, 0x98, 0x9E,
-    0xBE, 0xFC, 0x52, 0xF5, 0x98, 0x26, 0x32, 0x6C, 0x72, 0x8A, 0x7F, 0x3B, 0x98, 0x91, 0xA3, 0x6F,
-    0xAB, 0x59, 0x59, 0xAE, 0xC0, 0x67, 0x23, 0xE8, 0xC5, 0x25, 0x78, 0x8A, 0xC0, 0xB8, 0x8D, 0x40,
-    0x76, 0x95, 0xB8, 0x2D, 0xC5, 0xEA, 0x19, 0x56, 0xCC, 0x54, 0x82, 0x55, 0x12, 0x75, 0x17, 0x0E,
-    0xF6, 0x11, 0xFA, 0x07, 0x18, 0x51, 0x63, 0x8C, 0xC3, 0xC3, 0xE3, 0xC0, 0x35, 0x8C, 0xB4, 0xC4,
-    0x63, 0xE1, 0x54, 0x31, 0x7A, 0xC8, 0xE3, 0x11, 0x36, 0x31, 0x03, 0xD1, 0x1B, 0x73, 0xFC, 0x8A,
-    0x67, 0xC1, 0x61, 0x61, 0x5E, 0x30, 0x16, 0x6D, 0xA6, 0x53, 0x83, 0x3D, 0x96, 0x61, 0x19, 0x54,
-    0x18, 0x56, 0xB3, 0x8B, 0xCC, 0x74, 0x4B, 0x8C, 0x91, 0xB1, 0x30, 0xBE, 0xB0, 0x4C, 0xA0, 0x1B,
-    0x9C, 0x04, 0x40, 0x23, 0x18, 0xC1, 0xA7, 0x7E, 0xE9, 0xE6, 0xB6, 0x48, 0x4F, 0x31, 0x12, 0xFE,
-    0xDB, 0xAD, 0xC8, 0xA3, 0x1F, 0x13, 0x8F, 0xDF, 0x23, 0x9E, 0x91, 0x11, 0xCF, 0x81, 0x9E, 0x60,
-    0x56, 0x4C, 0x3C, 0x2F, 0x1A, 0xAB, 0xEE, 0x97, 0xC4, 0xD7, 0x93, 0xB0, 0xB2, 0x00, 0xFB, 0xBF,
-    0x30, 0xE4, 0xFF, 0xBD, 0xA2, 0xE0, 0xB3, 0x1A, 0x9C, 0x6F, 0x08, 0x19, 0x0F, 0x38, 0xBC, 0x85,
-    0x9F, 0xD3, 0xB2, 0x55, 0x66, 0x28, 0x76, 0x13, 0xD4, 0x1C, 0x2A, 0x32, 0x43, 0x85, 0xA2, 0x5C,
-    0x63, 0x71, 0x7E, 0x45, 0x23, 0xB3, 0x77, 0x8B, 0x85, 0x82, 0x88, 0xB4, 0x29, 0x71, 0x08, 0xDA,
-    0x0A, 0xD3, 0x0B, 0x90, 0x3F, 0x23, 0x5E, 0x59, 0xBE, 0x41, 0x66, 0x80, 0x08, 0x59, 0x72, 0xD7,
-    0xC6, 0xD8, 0x3A, 0x1E, 0x08, 0x2D, 0x3E, 0xC6, 0x80, 0x5A, 0xC4, 0xA3, 0xA0, 0x4A, 0x0C, 0xDE,
-    0x62, 0x13, 0xD6, 0xE8, 0x83, 0x91, 0x70, 0xFC, 0x1A, 0xB2, 0x42, 0xCB, 0x32, 0xB0, 0x4E, 0x36,
-    0x56, 0x64, 0x18, 0x4C, 0x38, 0x08, 0x92, 0xF0, 0xB6, 0xC7, 0x5D, 0xE7, 0x29, 0xF9, 0xB1, 0xF1,
-    0xF7, 0x73, 0x15, 0x5A, 0x88, 0xA4, 0xD0, 0x98, 0x19, 0x37, 0x85, 0x0A, 0x20, 0x94, 0x66, 0x83,
-    0xE2, 0xCF, 0x0D, 0xDB, 0x57, 0x16, 0x8A, 0xD1, 0x0D, 0x05, 0x2D, 0x66, 0xE5, 0x62, 0x9B, 0x12,
-    0xA2, 0x81, 0x90, 0x3B, 0xD1, 0x81, 0x4E, 0x74, 0xBD, 0x87, 0x4E, 0x38, 0x21, 0xC7, 0x5B, 0x50,
-    0x16, 0x56, 0x97, 0x98, 0x4E, 0xCF, 0x38, 0x65, 0x42, 0x9A, 0x90, 0x54, 0x59, 0x99, 0xD4, 0x52,
-    0xA0, 0x28, 0xE9, 0x6C, 0x29, 0x93, 0x7E, 0xD1, 0x50, 0x5C, 0x1D, 0x4D, 0x8B, 0xE2, 0x12, 0x4E,
-    0xCA, 0x12, 0xE7, 0xED, 0xDD, 0x15, 0x69, 0x64, 0x85, 0x8C, 0xB3, 0x4A, 0xA5, 0xA4, 0x26, 0x9E,
-    0x3A, 0x06, 0xAF, 0x40, 0x46, 0x10, 0x21, 0x6B, 0xA2, 0xAC, 0xF2, 0x5A, 0xC4, 0x6A, 0xCA, 0x15,
-    0xF6, 0x90, 0xC1, 0x5C, 0x9B, 0xD4, 0xBC, 0x11, 0x36, 0x48, 0x4C, 0xC2, 0x1A, 0x19, 0x4C, 0x80,
-    0x79, 0x00, 0x19, 0x03, 0xC8, 0x2A, 0xF8, 0x1B, 0x6C, 0x3D, 0xF8, 0x02, 0x74, 0x07, 0xB0, 0x76,
-    0xDE, 0x0E, 0x5B, 0x1C, 0x80, 0x3F, 0x0B, 0xBC, 0x59, 0xD7, 0x26, 0x6D, 0x11, 0xEF, 0x36, 0x1E,
-    0x8E, 0x41, 0xD8, 0xF4, 0xF2, 0xDE, 0xFB, 0x9C, 0xF7, 0x36, 0x5C, 0xBB, 0x37, 0x9E, 0xB3, 0x29,
-    0x50, 0x14, 0x8E, 0xA7, 0x40, 0x1D, 0xF9, 0x79, 0x97, 0x40, 0x2E, 0xDB, 0x0A, 0x18, 0xD7, 0x7E,
-    0xFC, 0x53, 0xCE, 0x9F, 0xFD, 0x71, 0x46, 0xBF, 0x7C, 0xF8, 0x89, 0x8C, 0xBD, 0x60, 0x8F, 0x78,
-    0xF9, 0x10, 0xED, 0x4C, 0x5F, 0x76, 0xB4, 0xF3, 0x2E, 0x52, 0x05, 0xD6, 0x1F, 0x5E, 0xD4, 0xB9,
-    0xC3, 0x2D, 0x56, 0x45, 0x46, 0xA4, 0xAE, 0x38, 0x0A, 0x75, 0xA7, 0xC8, 0x92, 0x0F, 0xC1, 0x3A,
-    0x71, 0x31, 0x81, 0x3E, 0xCB, 0x39, 0xE0, 0xA5, 0x23, 0x9E, 0x27, 0xE9, 0x7B, 0xFA, 0xB2, 0x61,
-    0x0C, 0xA2, 0x66, 0xBC, 0xC1, 0x94, 0x87, 0x6C, 0xB1, 0xDE, 0x3F, 0xE2, 0x69, 0x0D, 0x10, 0xF8,
-    0xC8, 0x87, 0x81, 0x0D, 0xA3, 0xF1, 0xC2, 0xD6, 0x01, 0x0C, 0x29, 0x89, 0x7D, 0x88, 0x4B, 0x70,
-    0xF8, 0xBD, 0x31, 0x0F, 0xFC, 0x7A, 0xAE, 0xF2, 0x15, 0xAF, 0xFE, 0xB2, 0x54, 0x12, 0x53, 0xE5,
-    0xCE, 0xF0, 0x07, 0x7F, 0x72, 0x19, 0x1F, 0xB8, 0xF0, 0xFB, 0x4E, 0xF0, 0xA3, 0x6E, 0x56, 0x61,
-    0xF7, 0x5D, 0x90, 0x18, 0x3D, 0x73, 0x87, 0xA7, 0xB4, 0xAA, 0x5C, 0xE5, 0xAB, 0x5E, 0xBD, 0xDA,
-    0x29, 0xC2, 0xDC, 0x12, 0x4B, 0xCA, 0x6F, 0xE8, 0x06, 0x63, 0x29, 0x9D, 0xC1, 0xB8, 0x7D, 0x83,
-    0xB4, 0xCB, 0xA1, 0xB9, 0xEC, 0xD3, 0xAE, 0xAF, 0xF6, 0x82, 0xA7, 0xF0, 0x90, 0x77, 0x12, 0x53,
-    0xFC, 0xEE, 0x47, 0xA3, 0x78, 0x74, 0xB5, 0x30, 0x17, 0xB1, 0xB6, 0x57, 0x14, 0xAD, 0xA2, 0xDB,
-    0xD8, 0xFD, 0x32, 0x08, 0xF2, 0x0A, 0x10, 0x71, 0x11, 0x2A, 0x72, 0xFB, 0x8B, 0xC3, 0xC1, 0xB2,
-    0xFD, 0xBE, 0xD5, 0xC5, 0x47, 0x3F, 0x1C, 0x46, 0x83, 0xAB, 0xB9, 0xD9, 0x0A, 0xCD, 0xC3, 0xA0,
-    0xBC, 0x13, 0xE9, 0xB3, 0x90, 0x84, 0x27, 0x2C, 0x1C, 0x2F, 0x41, 0x1C, 0x4C, 0x09, 0x33, 0x57,
-    0x76, 0x6E, 0xF4, 0x53, 0x5B, 0xDC, 0x6B, 0x07, 0x3F, 0x71, 0xEE, 0xE3, 0xB5, 0x04, 0xB4, 0x88,
-    0x61, 0x6B, 0x07, 0x48, 0x14, 0x4D, 0x5E, 0xB2, 0xDF, 0xCA, 0xD5, 0x29, 0xEE, 0xBF, 0x20, 0xCD,
-    0xD3, 0xA7, 0x1A, 0xA9, 0xC5, 0x10, 0xAD, 0xC9, 0xAC, 0xB9, 0x25, 0xC7, 0x6E, 0x0F, 0x7A, 0x9B,
-    0x9D, 0xEA, 0x5E, 0x2B, 0x78, 0xD6, 0x29, 0x07, 0x53, 0x61, 0x78, 0x0B, 0xBD, 0xC3, 0xA7, 0x6F,
-    0x5F, 0x70, 0x5C, 0xDB, 0x87, 0x51, 0xF1, 0xAA, 0x7F, 0x1D, 0x82, 0x92, 0xA8, 0x0E, 0x87, 0x54,
-    0xE0, 0x17, 0x0C, 0x60, 0x6E, 0x99, 0x7E, 0x02, 0x87, 0x06, 0x57, 0x9C, 0x18, 0xD8, 0xE0, 0x08,
-    0xD6, 0x98, 0x94, 0x67, 0xD8, 0xA8, 0x94, 0x1C, 0x62, 0xC4, 0xBA, 0xB8, 0xE2, 0x8B, 0xEA, 0x83,
-    0x79, 0x01, 0x57, 0x32, 0xD3, 0x59, 0x04, 0x7C, 0x07, 0x25, 0x9C, 0x5A, 0xB5, 0x5D, 0xA0, 0x60,
-    0x6F, 0x20, 0x9A, 0x9A, 0xF3, 0x11, 0x88, 0xFD, 0x43, 0x2B, 0x66, 0xDE, 0x09, 0x42, 0x2A, 0xF5,
-    0x89, 0x95, 0x25, 0xAE, 0x5C, 0x3F, 0xE9, 0xA8, 0x8F, 0x50, 0x49, 0x7C, 0x42, 0x71, 0xEB, 0x0A,
-    0x01, 0x8C, 0x3D, 0x1C, 0xF5, 0x2B, 0x93, 0xAE, 0xD9, 0x8B, 0x39, 0xE0, 0xB5, 0xBC, 0x7D, 0xBF,
-    0xE5, 0xBD, 0x7B, 0x2D, 0x6F, 0xDC, 0x6B, 0x79, 0xD7, 0xDE, 0x88, 0xB7, 0xEC, 0x8D, 0x64, 0xBF,
-    0x23, 0xEA, 0x20, 0x76, 0x3A, 0x14, 0x54, 0x43, 0xD9, 0xE3, 0x50, 0x36, 0x38, 0x94, 0xDD, 0x0D,
-    0x65, 0x6B, 0xEE, 0x38, 0xF4, 0x48, 0x28, 0xEF, 0xC3, 0x87, 0x02, 0xEF, 0xC8, 0x46, 0xCE, 0x1D,
-    0xA3, 0xFF, 0x21, 0x53, 0xE8, 0xB7, 0x4C, 0x30, 0x62, 0x0E, 0xA0, 0x6F, 0xB9, 0xC5, 0x73, 0x56,
-    0x7D, 0x76, 0x9C, 0xF8, 0x95, 0x5E, 0xD1, 0xF2, 0x01, 0x2E, 0x6E, 0x0B, 0x04, 0xB1, 0x32, 0xAD,
-    0x10, 0x22, 0xE1, 0xBE, 0x35, 0x28, 0x4B, 0xF9, 0xD4, 0xC5, 0xB1, 0x1F, 0x9A, 0x5B, 0xE0, 0xB1,
-    0xE4, 0x1E, 0xCC, 0x78, 0x77, 0x88, 0xB4, 0xF2, 0x80, 0x28, 0x12, 0xC7, 0x0B, 0xCE, 0x55, 0xE3,
-    0x46, 0x0E, 0x9B, 0x99, 0x84, 0x55, 0x2C, 0xC9, 0x0F, 0x76, 0xD1, 0x30, 0x01, 0xF6, 0x98, 0x27,
-    0x3E, 0x96, 0x8E, 0x39, 0x7A, 0x89, 0x3B, 0x72, 0x72, 0x05, 0xA2, 0x04, 0xD2, 0xCA, 0x2A, 0x9C,
-    0x10, 0x27, 0x0F, 0x8E, 0xF3, 0xE5, 0xEC, 0xF0, 0x6D, 0xE5, 0xBD, 0x6B, 0xD8, 0xFB, 0x3B, 0x10,
-    0x31, 0xA0, 0x9D, 0x1B, 0x92, 0xA4, 0x8A, 0xF9, 0x49, 0xE2, 0x90, 0x52, 0x97, 0x63, 0xD0, 0xF6,
-    0xC4, 0x1A, 0x77, 0x27, 0x26, 0x39, 0x18, 0x03, 0x91, 0xBD, 0xB8, 0x34, 0x67, 0xC8, 0xD5, 0xD8,
-    0x9A, 0xC3, 0xA9, 0x49, 0x0B, 0x38, 0x01, 0xFB, 0x9A, 0x44, 0xA2, 0x4F, 0x94, 0xFB, 0x0A, 0x45,
-    0xE1, 0x8B, 0x9B, 0x1C, 0x3D, 0x9A, 0x98, 0x3F, 0x3C, 0x31, 0x54, 0x02, 0xF5, 0x4B, 0xA0, 0xEA,
-    0x8D, 0x14, 0xE8, 0xE6, 0x36, 0x0C, 0x0F, 0xD8, 0xFB, 0x3B, 0xCD, 0x5E, 0x30, 0x14, 0x75, 0xE7,
-    0xCD, 0x5C, 0x6C, 0xE2, 0x3F, 0x40, 0xC7, 0xB1, 0xE2, 0x84, 0xB1, 0xFC, 0x09, 0x8D, 0x43, 0xA0,
-    0x8D, 0xED, 0xD1, 0x61, 0x85, 0xD3, 0x3F, 0xF2, 0x38, 0x00, 0x38, 0xA3, 0x97, 0x00, 0xE9, 0x4D,
-    0x2D, 0xE7, 0xC6, 0x98, 0x75, 0xE4, 0xF1, 0x5C, 0x46, 0x22, 0x0C, 0xA9, 0xC2, 0xA3, 0x43, 0x44,
-    0x59, 0x2C, 0x30, 0x64, 0xD0, 0xBA, 0x8D, 0x1E, 0x07, 0xD2, 0x31, 0xF2, 0x78, 0xDC, 0x6D, 0xE6,
-    0x63, 0x2E, 0xDF, 0xB8, 0xFC, 0x7D, 0x27, 0x0C, 0x94, 0x4B, 0x41, 0x79, 0x29, 0xFB, 0xD0, 0x8C,
-    0xF2, 0xE7, 0xBF, 0xB1, 0xCB, 0x1C, 0xB3, 0x92, 0x01, 0x67, 0x23, 0x3A, 0x3B, 0xFA, 0xBC, 0xCD,
-    0x7E, 0xFD, 0xB4, 0x5D, 0x0F, 0xCA, 0xAF, 0x8B, 0xCC, 0xBA, 0xF1, 0x1E, 0xE7, 0x4D, 0x15, 0xFF,
-    0x22, 0x7D, 0x92, 0xC9, 0x47, 0x1A, 0xE9, 0x0D, 0xFF, 0xF4, 0x16, 0xE2, 0x77, 0xCC, 0x53, 0x87,
-    0xF4, 0x66, 0x2F, 0xCF, 0xE1, 0x18, 0x98, 0xB8, 0x4C, 0xA0, 0x10, 0x07, 0x8B, 0x64, 0x97, 0x33,
-    0xB4, 0x2E, 0xC0, 0xB1, 0xC9, 0x41, 0xA9, 0x44, 0xA3, 0x62, 0x45, 0xFF, 0xBB, 0x6B, 0xDD, 0xA5,
-    0x1B, 0xA9, 0x53, 0xB8, 0xD8, 0x85, 0x3C, 0x24, 0xB2, 0x52, 0x10, 0x3A, 0xE5, 0x73, 0x55, 0x7B,
-    0xD8, 0xBA, 0x58, 0x2E, 0xA9, 0x9A, 0x77, 0x43, 0x3C, 0xD3, 0x7F, 0xCF, 0x3C, 0x7A, 0xCD, 0xF9,
-    0x61, 0xB9, 0x1A, 0xD7, 0x1B, 0x71, 0xBD, 0x19, 0xD7, 0xBB, 0xBE, 0x7E, 0xC0, 0xFE, 0x17, 0xD6,
-    0xC5, 0x39, 0x8C, 0xE1, 0xCF, 0xC3, 0xE0, 0x57, 0x2C, 0x59, 0xD3, 0x96, 0xA4, 0x6B, 0x0F, 0xD9,
-    0x75, 0xA3, 0x1F, 0xD9, 0x1E, 0xF7, 0x1B, 0xF6, 0x03, 0x31, 0xA9, 0x24, 0xAC, 0xD7, 0xA3, 0xC1,
-    0x66, 0xD4, 0xEC, 0x4A, 0xD2, 0xEC, 0xDF, 0xA3, 0x65, 0x1D, 0xB7, 0xFC, 0xCD, 0xB2, 0x30, 0x91,
-    0x46, 0x63, 0x4C, 0x0F, 0xBD, 0x36, 0xC7, 0xDC, 0x0C, 0xBA, 0x45, 0x51, 0xEF, 0xF8, 0x8A, 0x14,
-    0xA2, 0xED, 0xA7, 0x72, 0xF9, 0x9F, 0xAF, 0xBF, 0x53, 0xC0, 0x23, 0xBE, 0xE0, 0x6C, 0xAF, 0x71,
-    0x06, 0x7D, 0x62, 0x2A, 0x77, 0xBF, 0x8B, 0x23, 0x9E, 0x69, 0xAE, 0x20, 0xE3, 0xAE, 0x71, 0x8E,
-    0x69, 0x6A, 0x60, 0x78, 0xF4, 0x73, 0x4E, 0xFE, 0x7F, 0xA5, 0xE9, 0xED, 0x6F, 0x8D, 0xBE, 0xB6,
-    0xCF, 0x1E, 0xA7, 0xCC, 0x9E, 0xB5, 0x87, 0x25, 0x72, 0x61, 0x56, 0x83, 0x5F, 0x94, 0x38, 0x0B,
-    0x3C, 0x1F, 0x40, 0x3D, 0x6A, 0x78, 0x7F, 0xD3, 0x60, 0x53, 0xAA, 0x71, 0x07, 0x04, 0x72, 0x07,
-    0x5E, 0x92, 0x43, 0x26, 0x02, 0xE8, 0x18, 0xE4, 0x66, 0x9C, 0x38, 0x76, 0xD7, 0x79, 0xEA, 0xC2,
-    0x1D, 0x49, 0x7C, 0x15, 0x20, 0xAF, 0xE7, 0x8F, 0xA9, 0x84, 0x4C, 0x9B, 0xA2, 0x12, 0x90, 0xA9,
-    0xEE, 0x30, 0x98, 0x5F, 0x1B, 0x70, 0xCA, 0x5E, 0x84, 0x4D, 0xA6, 0xE3, 0xB2, 0x0D, 0x6B, 0x3E,
-    0xBB, 0x0F, 0x23, 0x1C, 0x5B, 0x13, 0x35, 0x88, 0xCD, 0x63, 0x4A, 0xD9, 0xF4, 0x71, 0x8C, 0xF4,
-    0xC1, 0xC0, 0x86, 0x36, 0xFD, 0x72, 0x95, 0x0F, 0x93, 0x81, 0x59, 0xF7, 0x7A, 0x1C, 0x3C, 0xE3,
-    0x32, 0x41, 0x81, 0x2E, 0xDE, 0x77, 0x50, 0xD1, 0x1C, 0xDD, 0x63, 0xDA, 0xDF, 0x14, 0x6A, 0xAD,
-    0xE2, 0x71, 0x56, 0x3B, 0xE8, 0x5A, 0x5C, 0xEF, 0x09, 0x5B, 0xE8, 0xB0, 0xF5, 0xF1, 0xE7, 0x33,
-    0x14, 0x9C, 0xE1, 0xF4, 0x06, 0x54, 0xF4, 0x71, 0x0A, 0x54, 0x1B, 0x34, 0xF3, 0xBD, 0x63, 0xCA,
-    0x41, 0xC7, 0xB3, 0x19, 0x9C, 0xAE, 0xE5, 0xFC, 0x09, 0x14, 0x6C, 0x38, 0xCC, 0x33, 0x34, 0xBB,
-    0x15, 0xA7, 0x1F, 0x32, 0xD0, 0x6E, 0xAC, 0xDE, 0x3E, 0x85, 0xA5, 0xBE, 0x0D, 0x47, 0xC1, 0x58,
-    0x72, 0x75, 0xA6, 0x37, 0xFF, 0x18, 0x07, 0x05, 0xEE, 0x9D, 0xD2, 0xFA, 0xB7, 0x65, 0x6C, 0x47,
-    0xA5, 0x99, 0xEE, 0x3F, 0x9F, 0xE1, 0xD5, 0xAB, 0xAF, 0xFF, 0xCC, 0x6B, 0x77, 0xED, 0xC1, 0x18,
-    0x9F, 0x20, 0xC8, 0x6F, 0xF2, 0xFF, 0x06, 0x8A, 0x61, 0x21, 0xF5, 0x73, 0x80, 0xE7, 0x26, 0x27,
-    0xAB, 0x3E, 0x64, 0xEF, 0x27, 0xFF, 0x8C, 0x74, 0xF0, 0xA4, 0x31, 0x9B, 0x22, 0xFD, 0x4D, 0xBA,
-    0xD2, 0x61, 0x73, 0x98, 0xDD, 0x2A, 0xBC, 0xE2, 0xDD, 0x97, 0x72, 0x79, 0xBB, 0x6B, 0xCD, 0x5F,
-    0xC1, 0xE5, 0xD9, 0x99, 0xE3, 0xBE, 0xA2, 0x93, 0xC0, 0xB8, 0x77, 0xE3, 0xD8, 0x4C, 0xFE, 0xF2,
-    0x79, 0xA4, 0xFB, 0x9F, 0x2B, 0x57, 0xFE, 0xA1, 0x16, 0xFA, 0xCD, 0xB6, 0x7C, 0x9F, 0xA6, 0xF7,
-    0x07, 0x8B, 0xFB, 0xAC, 0x8A, 0x74, 0x3D, 0xB5, 0x1A, 0x01, 0x3B, 0x6A, 0x39, 0x07, 0xE3, 0xA8,
-    0xB4, 0xC0, 0x4F, 0xE4, 0x92, 0x2B, 0x23, 0x1D, 0x02, 0x66, 0x64, 0xBD, 0x58, 0x25, 0xE5, 0xFF,
-    0x9B, 0x16, 0xF6, 0xC7, 0x23, 0xA8, 0x8D, 0x7E, 0x46, 0xEB, 0xA1, 0xDE, 0xC4, 0x01, 0xFD, 0xA6,
-    0xE4, 0xD3, 0x0B, 0xA2, 0x3C, 0xAF, 0x68, 0x6D, 0xB6, 0x65, 0x81, 0x02, 0xFD, 0x37, 0xED, 0x56,
+static const uint8_t notoserif_18_regularBitmaps[44518] = {
+    0xCD, 0x5A, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0xC0, 0x23, 0x89, 0x44, 0x18, 0x07, 0x29, 0xAC,
+    0x19, 0x47, 0x1C, 0x11, 0x2E, 0x33, 0x96, 0xB8, 0x68, 0x55, 0xEC, 0x12, 0x98, 0x49, 0x99, 0x22,
+    0x2C, 0xC8, 0xA4, 0x48, 0x21, 0xD7, 0xCA, 0x64, 0x36, 0x45, 0x0A, 0x17, 0x4B, 0x02, 0x7D, 0x8A,
+    0x6C, 0x95, 0x36, 0x0D, 0x1B, 0xAD, 0x8A, 0x75, 0xE1, 0x42, 0x85, 0xB4, 0x80, 0xC7, 0xFF, 0x00,
+    0xA2, 0x14, 0x29, 0x85, 0x62, 0x3D, 0x91, 0xED, 0x99, 0x10, 0xC9, 0xC0, 0xA3, 0x47, 0x1A, 0x0F,
+    0x37, 0xDF, 0xF7, 0x1D, 0xE0, 0xED, 0x5B, 0x72, 0x65, 0x92, 0xA2, 0xE8, 0xF1, 0xEE, 0x7B, 0xE7,
+    0xDE, 0x07, 0x5C, 0xDC, 0x7B, 0xEE, 0xF9, 0x7D, 0xCE, 0x45, 0xD6, 0xE6, 0xFC, 0x6F, 0xB2, 0xF9,
+    0x3F, 0xB5, 0xFF, 0x2A, 0xB1, 0xFF, 0xC2, 0xFE, 0xAF, 0x3B, 0xFE, 0xC5, 0x15, 0x46, 0x76, 0x79,
+    0x97, 0x35, 0xFC, 0xF5, 0xE7, 0x2E, 0xE8, 0x5D, 0xD2, 0xBA, 0xD2, 0xB9, 0xD1, 0xAD, 0x06, 0x17,
+    0xEB, 0x17, 0xEE, 0xE5, 0x15, 0x3F, 0x65, 0xE1, 0x6A, 0xC7, 0x8F, 0x7F, 0xEE, 0x63, 0xD7, 0x31,
+    0x20, 0x2F, 0x38, 0x12, 0x8F, 0xA4, 0xAD, 0x4B, 0x3A, 0xB7, 0xEA, 0x5D, 0x30, 0x3A, 0x77, 0xE6,
+    0x5C, 0xDA, 0xB8, 0xB0, 0xC7, 0x12, 0x85, 0x73, 0x83, 0xE3, 0x0A, 0x98, 0x79, 0xBE, 0x3B, 0xE9,
+    0x37, 0xD7, 0x68, 0xE6, 0x27, 0xD3, 0x8E, 0x0F, 0x27, 0xFD, 0x73, 0x9F, 0x8E, 0xB7, 0x52, 0xE1,
+    0x64, 0x68, 0x19, 0x4E, 0xC2, 0x16, 0x37, 0xB1, 0xFA, 0xDA, 0xB9, 0x42, 0xFB, 0xEA, 0xF3, 0x3E,
+    0x1B, 0xA2, 0x3E, 0xE8, 0x83, 0x6E, 0xD5, 0xA4, 0xC5, 0xE8, 0x8E, 0xDD, 0x8F, 0x4E, 0x1E, 0xE5,
+    0x7E, 0x8D, 0x0F, 0xF6, 0xBA, 0xE7, 0xCA, 0xA6, 0xC6, 0x3F, 0x1E, 0x99, 0xFF, 0x32, 0x8F, 0xAE,
+    0xF7, 0x40, 0x7A, 0xBD, 0x5A, 0x73, 0xB5, 0x0D, 0x91, 0xAE, 0xB5, 0x50, 0x21, 0x0A, 0x60, 0xB1,
+    0xAC, 0xA9, 0x05, 0xB0, 0xA1, 0x16, 0xFB, 0x4E, 0xBB, 0xDF, 0x0F, 0x34, 0x0E, 0x20, 0x6B, 0xF4,
+    0xAC, 0xF6, 0x98, 0x73, 0x3E, 0xCC, 0x5C, 0x12, 0xE3, 0x09, 0xAB, 0x85, 0xA3, 0x0B, 0xFC, 0x69,
+    0x4F, 0x0C, 0x2A, 0xE7, 0x82, 0xBB, 0x44, 0xE6, 0x33, 0x7C, 0x57, 0x1B, 0x80, 0x94, 0x60, 0x02,
+    0xB8, 0xF9, 0x7F, 0x00, 0xF9, 0x17, 0x00, 0x59, 0xC8, 0x6B, 0x6F, 0x04, 0xAC, 0xC0, 0x8B, 0xB7,
+    0x4E, 0xFD, 0xAF, 0x5D, 0xE2, 0xBD, 0x37, 0xB2, 0x04, 0x35, 0xAE, 0x25, 0x93, 0x6F, 0x5D, 0xDE,
+    0xC6, 0x03, 0xA8, 0xB0, 0x1A, 0x81, 0x3A, 0x46, 0x97, 0x2E, 0xD8, 0xB8, 0x9C, 0xC0, 0xCD, 0x60,
+    0xE4, 0x34, 0x24, 0x2E, 0xB8, 0x01, 0x1E, 0x74, 0x00, 0x09, 0x05, 0x2B, 0xE7, 0x3C, 0x9F, 0x73,
+    0x84, 0x6E, 0x5E, 0xBE, 0xCE, 0x9D, 0x42, 0x32, 0x02, 0x17, 0x35, 0x2E, 0x2A, 0xD2, 0xC2, 0x25,
+    0xC5, 0x01, 0xF6, 0x58, 0x00, 0x01, 0xBF, 0x03, 0x16, 0x5C, 0x0A, 0x17, 0xFB, 0xBA, 0x73, 0x59,
+    0x17, 0x8D, 0xC0, 0x85, 0x68, 0x14, 0x10, 0xC0, 0x9C, 0x52, 0x98, 0x11, 0x04, 0x92, 0x27, 0x43,
+    0x68, 0xC5, 0xE5, 0x20, 0xC4, 0x90, 0x2F, 0x10, 0x36, 0xE7, 0xAF, 0xDC, 0x1F, 0x03, 0x1E, 0xAE,
+    0xE7, 0xBD, 0xE2, 0x89, 0x62, 0xBE, 0x4D, 0xE9, 0xDB, 0x82, 0x0F, 0x78, 0x0D, 0x98, 0xD5, 0xC5,
+    0xE7, 0xE0, 0x0D, 0xD6, 0xE0, 0x6A, 0x4F, 0x21, 0x1B, 0x91, 0x07, 0x06, 0xEE, 0x6D, 0x43, 0x87,
+    0x6B, 0xCC, 0xD3, 0x44, 0x82, 0x89, 0xE0, 0x6D, 0xC1, 0x23, 0xC1, 0x9E, 0x30, 0xEC, 0x08, 0xA3,
+    0x86, 0x30, 0x29, 0x26, 0x49, 0x1F, 0xE1, 0x91, 0xE0, 0x40, 0x08, 0x0A, 0x00, 0xAE, 0x1A, 0xC2,
+    0xA4, 0x20, 0xCC, 0xB4, 0x91, 0x3B, 0xF7, 0xEF, 0xFB, 0xFB, 0xAE, 0x16, 0x09, 0x3E, 0x3A, 0x39,
+    0xF1, 0x27, 0x9C, 0x54, 0x33, 0x3F, 0x0F, 0x03, 0x71, 0xEC, 0xD4, 0x7F, 0xC5, 0x6D, 0x79, 0xE8,
+    0x04, 0x41, 0xE4, 0xFD, 0xC6, 0x40, 0x5C, 0xB9, 0x07, 0x2E, 0x2E, 0xDC, 0xBB, 0x2E, 0x76, 0xEE,
+    0x7B, 0x2E, 0x11, 0xC2, 0x57, 0x80, 0x94, 0x0C, 0x4F, 0xA9, 0x08, 0x7F, 0xE1, 0x52, 0xB1, 0xD4,
+    0x08, 0x45, 0x50, 0x5F, 0x50, 0xAB, 0x5A, 0x7A, 0x65, 0xF5, 0x03, 0xDE, 0x38, 0xE2, 0x90, 0x87,
+    0x12, 0x8C, 0x2A, 0x5E, 0x43, 0x96, 0x9F, 0xA5, 0x16, 0x79, 0x81, 0x6B, 0xAE, 0xFC, 0xCD, 0x48,
+    0xF6, 0x4C, 0x54, 0x7F, 0xE9, 0x40, 0x4E, 0x3D, 0x3B, 0x98, 0x49, 0xAF, 0x19, 0xF9, 0x40, 0xAD,
+    0xF5, 0x60, 0x93, 0x9C, 0x4F, 0xA1, 0x17, 0xBE, 0x3E, 0x1D, 0x9C, 0xEF, 0x30, 0xBD, 0x27, 0xC3,
+    0x3D, 0x47, 0x79, 0x8E, 0xAF, 0xC9, 0x2F, 0x01, 0x9A, 0x9F, 0x46, 0x06, 0x88, 0x7A, 0xF6, 0xBC,
+    0x8A, 0xD5, 0xBB, 0x2A, 0x56, 0x82, 0xA2, 0xED, 0x16, 0x34, 0x0F, 0x70, 0xAB, 0xFA, 0x67, 0xCC,
+    0x52, 0xFC, 0x13, 0xE5, 0x12, 0xE0, 0x21, 0xD7, 0x1F, 0x17, 0x60, 0x62, 0x4D, 0x51, 0x8A, 0x08,
+    0xE2, 0x76, 0x91, 0xE1, 0x54, 0xC4, 0x28, 0x16, 0x69, 0x3E, 0x5B, 0xE4, 0x22, 0xB8, 0xE2, 0xA9,
+    0x64, 0xFB, 0x94, 0xEC, 0xED, 0x85, 0xE9, 0x49, 0xA1, 0x5D, 0xCE, 0x7F, 0x32, 0x52, 0x62, 0x3D,
+    0x25, 0x36, 0x2F, 0x64, 0x78, 0xB1, 0x85, 0x74, 0x06, 0x30, 0x8A, 0x0D, 0x36, 0x93, 0x55, 0xC9,
+    0x1A, 0x2B, 0x41, 0xE8, 0x36, 0xD8, 0xD1, 0x7F, 0xF7, 0x94, 0x68, 0x4C, 0x93, 0x90, 0xB0, 0x75,
+    0xB9, 0xC1, 0x04, 0x91, 0x2F, 0x30, 0xAE, 0x6E, 0x68, 0x22, 0x3B, 0x10, 0x22, 0xE9, 0x41, 0x97,
+    0x88, 0x60, 0xD5, 0xE7, 0xEC, 0xE1, 0x5A, 0xDC, 0xE3, 0x6E, 0xD2, 0xC2, 0xC6, 0x41, 0x9D, 0xA7,
+    0xBF, 0xA5, 0x01, 0xE6, 0x04, 0xC1, 0xBD, 0xAD, 0x2D, 0x9C, 0x16, 0x5B, 0x38, 0x42, 0xF2, 0x13,
+    0x0A, 0x27, 0x30, 0x30, 0x5B, 0x58, 0xD1, 0x80, 0x35, 0xB2, 0xF2, 0x00, 0x69, 0x6B, 0xA0, 0x99,
+    0x41, 0x97, 0xC1, 0x50, 0x74, 0x78, 0xC2, 0x77, 0xD1, 0xF4, 0xC9, 0xE3, 0x36, 0xF0, 0xFE, 0xC3,
+    0xD6, 0xBD, 0xF3, 0x28, 0x6D, 0x97, 0x6D, 0x67, 0x5B, 0x3E, 0xE7, 0x5B, 0x3E, 0x6F, 0xDC, 0x9F,
+    0x39, 0xF0, 0x28, 0xA9, 0xB0, 0xF7, 0xF8, 0xA9, 0x87, 0xAF, 0xF0, 0x24, 0x22, 0x25, 0xE7, 0x1A,
+    0x19, 0x5D, 0xF1, 0x7F, 0xCF, 0x5D, 0xF5, 0xB7, 0xE7, 0xEC, 0xAE, 0x84, 0xA6, 0x88, 0x86, 0x64,
+    0xCD, 0xFF, 0xB0, 0xBB, 0x6A, 0x6C, 0xD4, 0x26, 0x43, 0x3A, 0x26, 0x23, 0x96, 0xFA, 0xD4, 0x0D,
+    0x41, 0x17, 0x37, 0x77, 0xDC, 0x0F, 0x75, 0x27, 0xF4, 0x4F, 0xB0, 0x69, 0xDF, 0x94, 0x4D, 0xDC,
+    0xD7, 0xA0, 0xE2, 0x19, 0x18, 0xF8, 0x00, 0x62, 0x7A, 0x4D, 0x96, 0x84, 0x5F, 0x3C, 0x03, 0x6A,
+    0x80, 0xF5, 0x03, 0x0D, 0x3B, 0xF0, 0x06, 0x19, 0x71, 0x19, 0xB4, 0x96, 0xDA, 0xEC, 0x7E, 0xAF,
+    0xEF, 0x2C, 0x09, 0x83, 0x26, 0xC9, 0x2E, 0x5B, 0xFB, 0x4A, 0xCA, 0xF5, 0xB7, 0xB6, 0x85, 0x65,
+    0x44, 0x66, 0x2B, 0x02, 0x85, 0x31, 0x3D, 0x91, 0x9E, 0xB9, 0x44, 0x54, 0x72, 0xA9, 0x79, 0xE7,
+    0x03, 0x91, 0xD0, 0xED, 0x27, 0xBD, 0xCC, 0xA6, 0xEC, 0x9A, 0x1B, 0x64, 0xE3, 0x82, 0x7E, 0x25,
+    0x71, 0xEB, 0xCC, 0x88, 0xB7, 0xCE, 0xEC, 0x8D, 0x74, 0x36, 0x91, 0x93, 0x94, 0x41, 0x6F, 0x28,
+    0xFF, 0x6A, 0x0E, 0xE8, 0x97, 0x68, 0x80, 0xC8, 0x5B, 0xD0, 0x42, 0x56, 0x12, 0x1B, 0x8B, 0xD6,
+    0x0C, 0x01, 0xB8, 0x4F, 0x4A, 0x2D, 0x1C, 0x10, 0xE5, 0x76, 0xE5, 0xDD, 0xE9, 0x54, 0xC1, 0xB0,
+    0x9C, 0xF3, 0x59, 0xEF, 0x07, 0x68, 0xCC, 0xA3, 0x59, 0x83, 0x40, 0x38, 0x77, 0x38, 0x50, 0xF5,
+    0xE9, 0xAD, 0x60, 0x7E, 0xA7, 0xAB, 0xC2, 0x83, 0xE5, 0x63, 0x77, 0x89, 0xAB, 0x77, 0x69, 0x4F,
+    0x09, 0x33, 0x9F, 0x2B, 0xF1, 0x77, 0xD1, 0xB8, 0x33, 0x18, 0xA6, 0xC5, 0x8B, 0x5A, 0x2F, 0x84,
+    0xBE, 0x00, 0x0E, 0xB0, 0xBF, 0x87, 0x98, 0x67, 0xA0, 0xA9, 0x9C, 0x16, 0xBD, 0x0A, 0x6A, 0x68,
+    0x7B, 0xAA, 0xAB, 0x55, 0xB4, 0x01, 0x6D, 0x82, 0x29, 0x02, 0xAE, 0x13, 0xF7, 0xFC, 0x39, 0xE4,
+    0xD4, 0xFD, 0xF8, 0xC2, 0xE6, 0xCB, 0x94, 0x89, 0xEC, 0xFE, 0x9B, 0x80, 0xEE, 0xD6, 0x32, 0x50,
+    0xDB, 0xC7, 0x38, 0x8B, 0xB6, 0xE2, 0x60, 0xF3, 0xDC, 0xF7, 0xC8, 0xC6, 0x3B, 0xCE, 0xB7, 0x37,
+    0xE0, 0x2E, 0xB8, 0xEE, 0x0D, 0x4F, 0x7B, 0x73, 0xFD, 0x2E, 0x89, 0xF5, 0x2B, 0x67, 0x34, 0xEB,
+    0x28, 0x6D, 0xEE, 0xE6, 0x64, 0x36, 0x95, 0xF7, 0xD1, 0x64, 0x9D, 0x1A, 0x62, 0x86, 0x66, 0xA6,
+    0x84, 0x11, 0x4A, 0x22, 0x82, 0x66, 0x26, 0xED, 0x4C, 0x9F, 0x97, 0x6F, 0x02, 0x6B, 0xC2, 0x69,
+    0x77, 0xCE, 0x79, 0x85, 0x64, 0xD8, 0x5D, 0xBD, 0xA6, 0xDE, 0x49, 0x06, 0x8D, 0x96, 0x0B, 0x31,
+    0x89, 0xF5, 0x66, 0x86, 0x18, 0x10, 0x18, 0x3E, 0x07, 0x3B, 0xF0, 0xB6, 0xE0, 0xBB, 0xB3, 0x97,
+    0xF8, 0x66, 0x28, 0xE1, 0xF3, 0x7E, 0xDE, 0xB4, 0x7B, 0x09, 0x18, 0x16, 0x42, 0x57, 0xD2, 0x10,
+    0x0B, 0x26, 0x15, 0x77, 0x94, 0x55, 0xC4, 0xD1, 0x57, 0x72, 0x8D, 0x95, 0x70, 0x13, 0x30, 0xFC,
+    0x84, 0xD8, 0x02, 0x6E, 0x1B, 0x6E, 0x7E, 0x3B, 0xEF, 0x95, 0xC0, 0x64, 0xDB, 0x57, 0x2F, 0x1A,
+    0x77, 0x09, 0x04, 0x14, 0x8C, 0x43, 0xC4, 0x4B, 0x24, 0xD5, 0x8E, 0xD6, 0x97, 0xFE, 0x5C, 0xEE,
+    0x4E, 0x17, 0x4B, 0x18, 0xC1, 0x46, 0xEC, 0xCB, 0x5B, 0xC5, 0x24, 0x8C, 0x8D, 0x7B, 0x79, 0x02,
+    0x2A, 0xE1, 0x9F, 0x6E, 0x8D, 0xC2, 0xDC, 0x48, 0x14, 0x67, 0x71, 0xDB, 0x36, 0xFE, 0xD9, 0xE6,
+    0xFA, 0xFD, 0xFB, 0x6C, 0xB0, 0x06, 0x87, 0x04, 0xF5, 0xA0, 0xE7, 0xC0, 0x49, 0x0A, 0x27, 0xE6,
+    0xCD, 0xAD, 0xA1, 0x80, 0xCE, 0xEB, 0xA1, 0x89, 0x6D, 0x75, 0xCA, 0x02, 0x97, 0xAE, 0xE7, 0xFB,
+    0xC6, 0x17, 0x98, 0xEA, 0x27, 0x52, 0x9B, 0x7B, 0xDA, 0x01, 0x39, 0x3E, 0x5A, 0x03, 0xAA, 0x16,
+    0x2E, 0x94, 0xE3, 0x7D, 0x75, 0xF9, 0xDB, 0x6D, 0xBC, 0x28, 0xB2, 0x34, 0xAF, 0x39, 0x99, 0x1A,
+    0xC3, 0x0C, 0x3C, 0xF8, 0x8A, 0xDF, 0x1A, 0xE8, 0xD6, 0x94, 0x84, 0xCD, 0x8C, 0xB4, 0x77, 0xAF,
+    0xF3, 0xC1, 0x0C, 0x36, 0x29, 0x02, 0xA8, 0x96, 0x5F, 0x97, 0x0D, 0xA6, 0xA4, 0x6F, 0xFC, 0xDB,
+    0xD9, 0x97, 0x5C, 0xA2, 0xF9, 0x87, 0x27, 0xA0, 0xD4, 0x97, 0x6B, 0x13, 0x0F, 0xB2, 0x05, 0x24,
+    0x9C, 0x1B, 0x6E, 0x34, 0x35, 0xCB, 0x91, 0x99, 0x66, 0xDD, 0x31, 0x12, 0x8D, 0x46, 0xA2, 0x5E,
+    0x4D, 0xDC, 0xA8, 0x49, 0x4D, 0x76, 0x1F, 0xA8, 0x09, 0x06, 0x35, 0x0A, 0x51, 0x9C, 0x4F, 0xEC,
+    0x57, 0xAE, 0xA8, 0xC7, 0xD7, 0x26, 0xE5, 0xFF, 0x4B, 0x65, 0x75, 0xBE, 0xA9, 0x5B, 0x3D, 0x97,
+    0xDB, 0x64, 0xC9, 0x5A, 0x4D, 0xB4, 0x51, 0xB3, 0x5A, 0x58, 0xD2, 0x98, 0xED, 0x36, 0x73, 0x02,
+    0x5A, 0x51, 0x3F, 0x92, 0x8D, 0xB8, 0xB3, 0xF2, 0x2D, 0xB9, 0xE3, 0x0E, 0xBB, 0x52, 0xBE, 0xDD,
+    0x60, 0x68, 0x02, 0xFD, 0x92, 0xC6, 0xE0, 0x75, 0xE0, 0xAA, 0x79, 0xD6, 0x90, 0x2C, 0xE6, 0x24,
+    0x54, 0x1C, 0x79, 0xD9, 0x9C, 0x90, 0x56, 0x35, 0x3B, 0xDA, 0xB5, 0xC7, 0x98, 0x9E, 0x0A, 0x42,
+    0x22, 0xCB, 0x23, 0xE2, 0xF2, 0xD7, 0x20, 0xC1, 0xEA, 0x4B, 0x0C, 0xFC, 0x1A, 0xF4, 0x8A, 0xFE,
+    0x1D, 0x9D, 0xDF, 0xA2, 0x93, 0x7C, 0x88, 0xCE, 0xC0, 0x28, 0x3E, 0x65, 0x07, 0x53, 0xEF, 0xA9,
+    0x03, 0x1F, 0x7C, 0xA0, 0x0E, 0x38, 0x79, 0xA4, 0x0E, 0xD8, 0xFA, 0xA9, 0x3A, 0xE0, 0x71, 0xAF,
+    0x4E, 0x82, 0x6C, 0x55, 0x9D, 0xB8, 0x0F, 0x5B, 0x75, 0x90, 0x8A, 0x36, 0xD6, 0x19, 0x23, 0xEB,
+    0x04, 0x63, 0x52, 0xA8, 0x03, 0x37, 0xE6, 0xAC, 0xE3, 0x6F, 0xCD, 0x9D, 0xF2, 0xC1, 0xDC, 0x01,
+    0x07, 0xAD, 0x93, 0xAD, 0xE7, 0x4E, 0x3A, 0x50, 0x94, 0x02, 0xE5, 0xB5, 0x79, 0x07, 0x86, 0x54,
+    0x71, 0x17, 0xC2, 0xB8, 0xD7, 0xBE, 0x59, 0x35, 0x48, 0x14, 0x9A, 0x92, 0x89, 0x25, 0x5D, 0xBB,
+    0x9A, 0x90, 0x04, 0xA0, 0xC3, 0xB0, 0x20, 0x81, 0x7B, 0x66, 0xB3, 0x56, 0xF3, 0xF5, 0x46, 0xCD,
+    0x6F, 0xBD, 0x9A, 0x01, 0x1E, 0x91, 0x0D, 0x6C, 0x1B, 0x1B, 0xC8, 0x21, 0x1B, 0xC8, 0xC7, 0x91,
+    0xD0, 0x56, 0x03, 0xD1, 0x3D, 0x12, 0xA6, 0x95, 0x9A, 0xBC, 0x51, 0x93, 0xF6, 0x6A, 0x92, 0x41,
+    0xCD, 0x6A, 0x54, 0x13, 0x7A, 0x35, 0xCE, 0x7F, 0xA6, 0x86, 0xB2, 0x88, 0x26, 0xB3, 0x26, 0x19,
+    0x15, 0x52, 0xC3, 0x79, 0x1D, 0x22, 0x8F, 0x43, 0x44, 0x56, 0x13, 0xB3, 0x71, 0xB1, 0xBA, 0xA1,
+    0xBC, 0x55, 0x26, 0xD7, 0x05, 0x96, 0x4D, 0x72, 0x76, 0xC8, 0x46, 0x18, 0xB1, 0xB5, 0xD2, 0xA8,
+    0x9E, 0xE6, 0x2E, 0x1A, 0x68, 0x1B, 0x57, 0x23, 0x15, 0x69, 0x35, 0xD2, 0xA1, 0x87, 0x1B, 0x5A,
+    0xD9, 0x70, 0x43, 0x61, 0x0C, 0x27, 0xC2, 0xE0, 0x39, 0x18, 0x4E, 0x36, 0xC6, 0xC6, 0xDB, 0xB3,
+    0x36, 0x0F, 0xF5, 0x33, 0x1A, 0x52, 0xCD, 0x1F, 0xCB, 0xCE, 0x72, 0x5D, 0xF0, 0xD9, 0x17, 0x32,
+    0xFA, 0x53, 0x0D, 0x9C, 0x2D, 0x12, 0x60, 0x28, 0xE0, 0x2E, 0xC2, 0xA7, 0x4A, 0xA6, 0xAB, 0xBF,
+    0x08, 0x7E, 0x66, 0x57, 0xFF, 0x12, 0x9F, 0xDD, 0x50, 0x8A, 0x1B, 0xF4, 0x01, 0x15, 0x14, 0xFE,
+    0x9A, 0xF2, 0x7A, 0x72, 0xF7, 0x55, 0xB4, 0x23, 0x14, 0x94, 0x17, 0xBB, 0xEC, 0xC6, 0xFE, 0x38,
+    0xE9, 0x99, 0xED, 0xD2, 0x53, 0x76, 0x48, 0x6E, 0xCD, 0x62, 0x1A, 0x0B, 0x70, 0x96, 0x9C, 0x75,
+    0x76, 0x97, 0xF9, 0xB9, 0x25, 0x9F, 0xF2, 0xAB, 0x1F, 0x15, 0xCF, 0xD0, 0x3F, 0x1D, 0x2E, 0x28,
+    0xF9, 0xFB, 0xC3, 0xD7, 0x99, 0xF2, 0x9B, 0x1D, 0xCA, 0x93, 0x77, 0x27, 0x16, 0xC4, 0xCA, 0xD8,
+    0xAA, 0x66, 0xE3, 0x03, 0xB3, 0x87, 0xB5, 0x8C, 0x71, 0xAE, 0xE0, 0x36, 0xEB, 0x17, 0xB3, 0xB9,
+    0xE5, 0xF5, 0x3C, 0xA1, 0xC2, 0x99, 0xB2, 0xA5, 0x8D, 0xC4, 0xD6, 0x60, 0x15, 0x6F, 0xF8, 0x8B,
+    0xAC, 0x30, 0xF0, 0x8F, 0x91, 0xC3, 0x53, 0x81, 0x58, 0x97, 0xA3, 0xE6, 0xE7, 0x05, 0x6C, 0x7C,
+    0x46, 0x72, 0x7C, 0x7F, 0x27, 0x9F, 0x52, 0x08, 0x9A, 0x28, 0xFA, 0xA7, 0xCE, 0x06, 0x32, 0xAE,
+    0x19, 0xBB, 0xA1, 0x10, 0xCB, 0xBC, 0xF8, 0xB9, 0x0D, 0x5E, 0xB3, 0xF6, 0x1A, 0xF3, 0xD1, 0x3D,
+    0x82, 0x7C, 0x06, 0xA9, 0xEA, 0x53, 0x15, 0x42, 0x88, 0xDA, 0xC5, 0xD3, 0x3F, 0xAC, 0x19, 0x10,
+    0x1C, 0x9B, 0xC8, 0xE6, 0x34, 0x8B, 0xFD, 0x0C, 0x8B, 0xB4, 0x8D, 0xFA, 0x03, 0xB0, 0x25, 0xE8,
+    0xF7, 0x69, 0x55, 0x66, 0xF8, 0x01, 0xE1, 0x4F, 0xCD, 0x65, 0xBD, 0x79, 0x28, 0x3F, 0xF4, 0x96,
+    0x47, 0x5E, 0xC2, 0xF0, 0xA5, 0x05, 0xFD, 0x7B, 0x08, 0x6F, 0x63, 0x29, 0x40, 0x1B, 0x4F, 0x96,
+    0xC4, 0x8C, 0xAA, 0xAC, 0x50, 0xAB, 0xE8, 0x04, 0x27, 0xE5, 0x46, 0x72, 0x03, 0x8D, 0x02, 0xAB,
+    0xD8, 0x3C, 0x6B, 0x62, 0x39, 0x5A, 0x6A, 0xF1, 0x3C, 0xD3, 0x4C, 0x08, 0xF7, 0x81, 0x93, 0x27,
+    0x3E, 0xA2, 0x60, 0x0D, 0x4C, 0x91, 0x18, 0xBA, 0x0D, 0x12, 0x30, 0xA6, 0x48, 0x10, 0x03, 0xCB,
+    0x31, 0xA7, 0x95, 0xF0, 0xA9, 0x23, 0x05, 0x6F, 0xE5, 0x5F, 0x4B, 0xC8, 0xF2, 0x7F, 0x95, 0xE0,
+    0x65, 0x5F, 0x1A, 0x23, 0xFF, 0x47, 0x4D, 0x62, 0x86, 0x2A, 0xB6, 0x26, 0xB2, 0xFC, 0x4F, 0xAE,
+    0xB7, 0x86, 0x65, 0x0D, 0x8F, 0x91, 0xA3, 0xAD, 0xD9, 0x43, 0xCE, 0x85, 0x1E, 0x7D, 0x2A, 0xC5,
+    0xAB, 0x2C, 0x28, 0xCB, 0x74, 0xCD, 0xB9, 0xC4, 0x93, 0xB3, 0x58, 0xD0, 0xCD, 0xE2, 0xCC, 0x91,
+    0xF6, 0x71, 0x67, 0xA3, 0x3A, 0x1A, 0x94, 0x68, 0x7F, 0x52, 0x62, 0x89, 0xDD, 0x1C, 0xD5, 0x66,
+    0x40, 0xE1, 0x65, 0x4A, 0x25, 0x75, 0xD8, 0xDA, 0x90, 0x17, 0xA1, 0x05, 0x16, 0x7D, 0xDE, 0x10,
+    0x6F, 0x7A, 0x9C, 0xAC, 0x21, 0xEA, 0xF1, 0x00, 0x97, 0xD3, 0x92, 0x20, 0x11, 0x7C, 0x4E, 0xD2,
+    0x25, 0x52, 0xC8, 0x08, 0xE9, 0x30, 0xA9, 0xB3, 0x1A, 0xE3, 0x2A, 0xEA, 0x53, 0x6D, 0x3B, 0x29,
+    0x56, 0x83, 0x52, 0x71, 0x38, 0xA0, 0xD5, 0x78, 0x20, 0x35, 0x4B, 0x61, 0x8C, 0xF7, 0x45, 0x06,
+    0xDC, 0xD9, 0x1C, 0x89, 0x12, 0xFF, 0x88, 0x11, 0x9F, 0x8A, 0x18, 0x40, 0xED, 0x4C, 0xA1, 0x05,
+    0xCD, 0x78, 0xA9, 0x58, 0x83, 0x4A, 0x97, 0x8B, 0x7E, 0x8C, 0x76, 0xF2, 0x76, 0xE9, 0xD1, 0x5B,
+    0xE5, 0x7E, 0xCD, 0xF4, 0x3F, 0xF7, 0x63, 0xA8, 0x84, 0xA3, 0x51, 0x90, 0x8A, 0xE4, 0x24, 0x33,
+    0x3E, 0xDD, 0x31, 0x79, 0x67, 0xE1, 0x30, 0x19, 0xC4, 0x8B, 0xD5, 0x28, 0x26, 0x84, 0x53, 0x2C,
+    0xEA, 0xFB, 0x0F, 0x2D, 0x8E, 0xB6, 0xD4, 0x3A, 0x33, 0x42, 0x5B, 0xDA, 0xBC, 0x50, 0x3F, 0xD9,
+    0xCC, 0x2A, 0xA6, 0x66, 0x5F, 0x59, 0x9D, 0x5B, 0x0B, 0x8F, 0xB0, 0x97, 0x32, 0x45, 0x8D, 0x6C,
+    0x4B, 0x52, 0xC9, 0xA0, 0x64, 0x66, 0x25, 0x8F, 0xCC, 0xA4, 0x8C, 0xD2, 0xA2, 0x95, 0xED, 0x06,
+    0xBE, 0xF4, 0x86, 0x79, 0x52, 0xC4, 0xE2, 0x05, 0xB0, 0x0E, 0x2E, 0x1A, 0x31, 0x71, 0x6D, 0x22,
+    0x67, 0x35, 0x03, 0xD2, 0x1A, 0x7B, 0x20, 0x79, 0x59, 0xCA, 0x36, 0xC4, 0x0E, 0x4C, 0x1E, 0x48,
+    0x37, 0x38, 0x35, 0x8B, 0xC2, 0x4C, 0xBA, 0xEA, 0xBF, 0x92, 0x58, 0xE5, 0xFF, 0x62, 0x95, 0x80,
+    0x2F, 0x77, 0x91, 0x37, 0x7B, 0x67, 0x55, 0xCE, 0x57, 0x6A, 0x76, 0xE5, 0x30, 0xAC, 0x69, 0x0C,
+    0x59, 0x2B, 0x5C, 0x5B, 0x75, 0x60, 0xCC, 0x05, 0xA0, 0x15, 0xEB, 0x3B, 0xA4, 0xF3, 0x01, 0xD9,
+    0xB3, 0x4F, 0xFA, 0xBF, 0x6F, 0xFE, 0x42, 0xA5, 0x0A, 0xAD, 0xAD, 0x78, 0x91, 0x86, 0xCD, 0x32,
+    0x17, 0x95, 0xD6, 0xFC, 0x52, 0xB8, 0x96, 0x4D, 0x16, 0x25, 0xC5, 0x67, 0x59, 0x1D, 0xB3, 0xFB,
+    0x48, 0x79, 0xF8, 0xF8, 0x2D, 0xD2, 0x77, 0x8F, 0x23, 0xEE, 0x90, 0xEE, 0x67, 0x0C, 0xBD, 0x36,
+    0x02, 0x2E, 0xB8, 0x2F, 0xA5, 0xE8, 0xB0, 0xD6, 0xDF, 0xD3, 0xFC, 0xB9, 0x0D, 0x55, 0xA1, 0x66,
+    0xE9, 0x18, 0x52, 0x7D, 0x97, 0xC7, 0x05, 0x6E, 0x0B, 0xAE, 0x9F, 0x78, 0x5A, 0x2A, 0x18, 0xE3,
+    0x27, 0xF8, 0x09, 0xA2, 0x96, 0x44, 0xA7, 0xA4, 0x62, 0xD7, 0x5B, 0x00, 0x33, 0xDC, 0xD0, 0xD6,
+    0x77, 0x69, 0x5E, 0x24, 0xD8, 0xDE, 0x39, 0x02, 0x3A, 0x08, 0xC6, 0xDB, 0x98, 0xE2, 0x47, 0x1F,
+    0x6B, 0xA2, 0x9D, 0x32, 0xAE, 0x7B, 0x11, 0xBC, 0x27, 0xE9, 0xA7, 0x75, 0x9D, 0x4A, 0xD2, 0x6D,
+    0x1A, 0x18, 0x08, 0xFB, 0xB9, 0x1C, 0x61, 0x25, 0x69, 0x5B, 0x95, 0x70, 0x12, 0x7D, 0x26, 0x59,
+    0xEA, 0x2B, 0xE1, 0x5C, 0xCD, 0xB0, 0xF1, 0x05, 0xE9, 0x58, 0xCF, 0xB3, 0x05, 0x9B, 0x01, 0xA4,
+    0xCA, 0x90, 0x86, 0x21, 0xBA, 0x1B, 0x55, 0x26, 0x74, 0x5A, 0xFD, 0xFA, 0x3D, 0xC5, 0xA7, 0xD1,
+    0x74, 0x38, 0x24, 0x1D, 0x5D, 0x66, 0x38, 0xE6, 0x45, 0xB0, 0x86, 0xA6, 0x1F, 0xD7, 0xB3, 0x5F,
+    0x9F, 0x76, 0xBE, 0x73, 0x7C, 0xAE, 0x62, 0x1B, 0xAB, 0x41, 0x58, 0xEB, 0x1A, 0x94, 0xEA, 0xFD,
+    0xE4, 0x49, 0x30, 0xAE, 0x68, 0x3A, 0x4B, 0x2C, 0xAA, 0x93, 0x87, 0x1B, 0x27, 0xB4, 0x5C, 0x89,
+    0x02, 0x60, 0xEA, 0xDC, 0xE2, 0x60, 0xBE, 0x01, 0x5E, 0xBF, 0x0B, 0x08, 0x6F, 0x03, 0x88, 0xFC,
+    0x08, 0xB1, 0x6F, 0x3A, 0x44, 0x8F, 0x1B, 0xED, 0xC8, 0xCE, 0x67, 0x1A, 0x9D, 0xED, 0xF0, 0x1C,
+    0x65, 0xDE, 0x66, 0xB6, 0xC0, 0xE7, 0x49, 0x61, 0xD7, 0x6D, 0xA4, 0x3D, 0x65, 0x33, 0xD8, 0x6C,
+    0xC9, 0x10, 0x7D, 0xD9, 0x72, 0x95, 0x64, 0xC2, 0x8A, 0x63, 0xC2, 0x1C, 0x58, 0x56, 0x96, 0x0E,
+    0x0A, 0xC4, 0x28, 0x20, 0x2D, 0xA7, 0x3C, 0x23, 0x82, 0x98, 0x67, 0x4D, 0x30, 0x92, 0x94, 0x13,
+    0xE7, 0xF1, 0x76, 0x3C, 0xA5, 0x63, 0x2A, 0x65, 0x9E, 0x06, 0x2E, 0x67, 0xF3, 0x2A, 0x43, 0xAA,
+    0x86, 0x88, 0xD5, 0xAE, 0x51, 0x8C, 0xDE, 0x85, 0x40, 0x61, 0x96, 0x50, 0xE1, 0x4F, 0x29, 0xE1,
+    0xBE, 0xA7, 0xA2, 0x12, 0x0D, 0x35, 0x66, 0x47, 0x1C, 0x70, 0x06, 0xC1, 0xDC, 0xB8, 0x47, 0xAC,
+    0xF5, 0xEE, 0x7E, 0x59, 0xD6, 0xFA, 0x64, 0x3A, 0x29, 0x9E, 0xBD, 0xFE, 0x2A, 0x5F, 0x6A, 0xD9,
+    0xA9, 0xFF, 0xD5, 0x1C, 0xD1, 0xE9, 0x6C, 0xEE, 0x3E, 0xFC, 0x58, 0xE6, 0x1F, 0x4F, 0xAE, 0xFE,
+    0xBB, 0xE9, 0x21, 0xEC, 0xC4, 0xE6, 0x4F, 0x56, 0x70, 0x76, 0x74, 0x17, 0x25, 0x41, 0x5E, 0x5C,
+    0x00, 0xDC, 0x28, 0xA9, 0xEE, 0x67, 0x60, 0x3F, 0x0B, 0x97, 0x39, 0xE3, 0xE4, 0xBD, 0x33, 0x6C,
+    0xEF, 0x67, 0x2A, 0x17, 0xDA, 0x99, 0x0B, 0x43, 0xB1, 0x93, 0x47, 0x73, 0x41, 0x06, 0x6A, 0x8F,
+    0x8C, 0xE0, 0xC4, 0xF7, 0x08, 0x34, 0xA2, 0x01, 0xA6, 0x36, 0x5C, 0xE7, 0x3C, 0xB1, 0x01, 0x08,
+    0x87, 0xDC, 0xCD, 0xD5, 0xE3, 0x0E, 0xBE, 0xE3, 0xB0, 0x89, 0x84, 0x15, 0x63, 0xF0, 0x57, 0x57,
+    0x1E, 0x11, 0x71, 0x4A, 0x95, 0x60, 0x50, 0xAC, 0xDD, 0xD4, 0xD1, 0x12, 0xF9, 0x66, 0x8E, 0x7D,
+    0xA7, 0x05, 0x4E, 0x97, 0x7F, 0xBE, 0x3A, 0xB4, 0xC2, 0x57, 0xE6, 0xCF, 0x9D, 0x3F, 0x2F, 0xC1,
+    0x31, 0x7C, 0xBE, 0xBF, 0x13, 0xC9, 0x9D, 0x5D, 0x2A, 0x0D, 0xE7, 0xDE, 0xDD, 0xDC, 0x3D, 0xCB,
+    0x7C, 0x99, 0x8F, 0x2F, 0xDE, 0xF3, 0x4F, 0x72, 0x90, 0xE2, 0xBA, 0x5B, 0x64, 0xBD, 0xDA, 0xA9,
+    0xEA, 0xCB, 0x54, 0xFB, 0xEA, 0x2D, 0x10, 0xB7, 0xAC, 0xE6, 0x33, 0xD4, 0x6F, 0xF3, 0xD1, 0xA9,
+    0x6A, 0xC9, 0x4D, 0x81, 0x95, 0x70, 0x38, 0x0F, 0x8B, 0x6F, 0x63, 0xB3, 0x0C, 0xB2, 0x22, 0x3A,
+    0xB9, 0xC3, 0x89, 0xAA, 0x91, 0x28, 0x24, 0xE2, 0x01, 0xC6, 0x24, 0x9F, 0x3A, 0x29, 0x93, 0x9A,
+    0x24, 0x18, 0x93, 0xAA, 0x05, 0x93, 0x14, 0x7D, 0x23, 0x97, 0x2D, 0x35, 0x70, 0xFE, 0x17, 0x1A,
+    0x13, 0x98, 0x81, 0x61, 0x04, 0x3F, 0xC9, 0xF8, 0x4F, 0x32, 0xF5, 0x13, 0x03, 0x5C, 0xDC, 0x83,
+    0xF0, 0x82, 0xEC, 0x81, 0xEF, 0x48, 0xF6, 0xAC, 0xFF, 0xE8, 0x63, 0x57, 0x4F, 0xC2, 0xF3, 0xBB,
+    0xF8, 0x04, 0xDE, 0x2A, 0x3D, 0xA3, 0x0E, 0x72, 0xA8, 0xFC, 0xF5, 0x90, 0xFB, 0x82, 0xA7, 0x56,
+    0x87, 0x6B, 0xEF, 0xBF, 0x60, 0x2D, 0x6B, 0xF5, 0xBB, 0x36, 0xFD, 0x9A, 0x91, 0x2C, 0x6C, 0x7E,
+    0xEC, 0xB9, 0x53, 0x66, 0x2F, 0x2A, 0x67, 0x87, 0x0A, 0x0B, 0xE1, 0x53, 0xAC, 0xB3, 0x7A, 0x93,
+    0x1D, 0xAC, 0x68, 0x51, 0xE8, 0xA9, 0xEF, 0x56, 0xFE, 0x78, 0xE5, 0x2B, 0xD8, 0xDA, 0x15, 0x3F,
+    0xAD, 0x59, 0x13, 0x0F, 0xCC, 0x2B, 0xA1, 0x0D, 0x5F, 0xF7, 0xB4, 0x4D, 0x99, 0xFF, 0x52, 0x6F,
+    0x43, 0xF1, 0x1A, 0x1A, 0x41, 0x38, 0xD2, 0x20, 0xBC, 0x0E, 0x5C, 0xB1, 0xF2, 0x4D, 0x1C, 0xC0,
+    0x11, 0x20, 0xC0, 0x32, 0x86, 0xB4, 0x10, 0x81, 0x32, 0x6D, 0xE6, 0x1A, 0x36, 0x13, 0xF7, 0x33,
+    0x39, 0x4D, 0x1E, 0x9F, 0x95, 0x6E, 0xE7, 0x88, 0x3B, 0x69, 0x19, 0x74, 0x76, 0x17, 0xC0, 0x2F,
+    0xA0, 0xD5, 0x10, 0x0D, 0xB6, 0xC4, 0x41, 0x07, 0x6E, 0x3D, 0xA6, 0xD2, 0xA4, 0xB0, 0x99, 0xC7,
+    0xDB, 0x33, 0x25, 0xBA, 0xAB, 0x91, 0x1E, 0xF3, 0xBD, 0x91, 0x1E, 0x93, 0x7E, 0xED, 0xCD, 0x78,
+    0xCC, 0xD9, 0x17, 0xCF, 0xA6, 0xC5, 0xCC, 0x8C, 0xF9, 0x6B, 0xF7, 0xC2, 0xA3, 0xD3, 0x4C, 0x55,
+    0xDB, 0x52, 0x09, 0x93, 0x79, 0x15, 0x78, 0x36, 0xF8, 0x19, 0x98, 0xBB, 0xBF, 0x79, 0x2A, 0xCF,
+    0xD6, 0xBE, 0x29, 0xCF, 0xF6, 0x58, 0xFE, 0x93, 0xD1, 0xAF, 0x57, 0xFE, 0x7B, 0xBD, 0xC8, 0x5E,
+    0xE8, 0x7B, 0xE7, 0xB8, 0xF9, 0x1D, 0x79, 0x88, 0x5C, 0x47, 0x29, 0x40, 0x1A, 0x09, 0xDA, 0xC6,
+    0x1D, 0x0E, 0xF0, 0x70, 0x10, 0x28, 0xD5, 0x06, 0x6B, 0x0A, 0xD5, 0x4F, 0x2C, 0x25, 0xB6, 0xA3,
+    0xFE, 0xF1, 0x55, 0x81, 0x22, 0x3A, 0x66, 0xA8, 0x73, 0x9E, 0x8B, 0x75, 0x02, 0x2C, 0x1B, 0xFF,
+    0xB2, 0x6C, 0xB2, 0x8A, 0xC9, 0x63, 0xC4, 0xAF, 0x5E, 0xA6, 0x50, 0xDD, 0x79, 0xCD, 0x74, 0xBB,
+    0xB5, 0x34, 0x94, 0x47, 0xAE, 0x01, 0x05, 0x9E, 0x16, 0x22, 0xEA, 0xDF, 0x87, 0x62, 0x1C, 0xC0,
+    0x9B, 0x3C, 0xA4, 0x47, 0x71, 0x71, 0x97, 0xFD, 0xB2, 0xAE, 0x22, 0x8E, 0xE3, 0x61, 0xDF, 0x5F,
+    0x32, 0x18, 0xB7, 0x38, 0x9B, 0xF1, 0x3D, 0xD7, 0xCE, 0x54, 0xE7, 0xF4, 0xDF, 0xDA, 0x91, 0x06,
+    0x9B, 0x25, 0xF6, 0xF9, 0x75, 0xA1, 0x77, 0x3C, 0xEC, 0x05, 0x0B, 0x92, 0x6C, 0xA2, 0xD5, 0x7F,
+    0x6F, 0xA2, 0xE1, 0x0F, 0x5E, 0xDB, 0xDB, 0x5C, 0x82, 0xB5, 0x55, 0x6B, 0x15, 0xFF, 0xE7, 0x6D,
+    0x5A, 0x32, 0xD3, 0xD8, 0x94, 0x5F, 0x81, 0xC7, 0x3D, 0x2B, 0x5A, 0x6F, 0x6F, 0xFD, 0x03, 0x14,
+    0x3F, 0xF5, 0x1D, 0x3C, 0x69, 0x8C, 0xCF, 0xA8, 0x37, 0x59, 0x46, 0x1E, 0xC8, 0x85, 0x2A, 0x78,
+    0x11, 0x77, 0xD5, 0x0D, 0x98, 0x0C, 0xD4, 0x2C, 0x61, 0xD2, 0xC1, 0xF3, 0x5D, 0x86, 0x26, 0x66,
+    0x65, 0xA6, 0xD1, 0x89, 0x63, 0x77, 0x4B, 0x59, 0xC4, 0xBE, 0x8E, 0x99, 0xF7, 0x15, 0xE7, 0xFF,
+    0x4C, 0x8C, 0xB3, 0x34, 0x55, 0x79, 0x84, 0x45, 0x8E, 0x16, 0xCF, 0xD9, 0xA9, 0xE2, 0x16, 0x81,
+    0x36, 0x64, 0xE6, 0x5C, 0xC0, 0x27, 0xC0, 0x62, 0x1D, 0x6E, 0x18, 0xB8, 0x23, 0x17, 0x41, 0x5E,
+    0x0A, 0x3B, 0x04, 0x94, 0x90, 0x59, 0x01, 0x25, 0xA4, 0x1C, 0x58, 0x1D, 0x58, 0xDD, 0x3A, 0x63,
+    0x0D, 0x15, 0x88, 0xDD, 0x2E, 0x95, 0x37, 0x4F, 0x6E, 0x1F, 0x11, 0xB5, 0x02, 0xA8, 0x9F, 0x64,
+    0xD5, 0x2D, 0x85, 0xE4, 0x43, 0xDA, 0xDC, 0xD6, 0xF1, 0x2E, 0x62, 0x09, 0xE2, 0x93, 0xFF, 0xBC,
+    0x8B, 0x3B, 0xB2, 0x34, 0xFB, 0x45, 0x13, 0xF5, 0xC4, 0x2D, 0xF9, 0xCF, 0x66, 0x35, 0xA8, 0x64,
+    0xF1, 0x5F, 0x55, 0xB8, 0xD6, 0xF1, 0xD9, 0x6F, 0x66, 0x54, 0xA3, 0xB9, 0x8E, 0xAC, 0x08, 0x48,
+    0x08, 0x87, 0xE3, 0x7C, 0x26, 0x42, 0x76, 0x5E, 0xB8, 0xD7, 0xDC, 0x0F, 0x40, 0xFB, 0x26, 0xA8,
+    0x27, 0x9F, 0xC0, 0xD7, 0x4D, 0xCA, 0x8A, 0x79, 0x55, 0xD6, 0xA4, 0x5B, 0x82, 0x18, 0x29, 0x82,
+    0xA9, 0xDB, 0xD9, 0xBE, 0x41, 0x5D, 0xF9, 0x1D, 0x7D, 0x5A, 0xF8, 0x05, 0x45, 0x3A, 0xAA, 0x74,
+    0x5A, 0xAA, 0x95, 0x0E, 0x94, 0x71, 0x7E, 0x26, 0xBF, 0x31, 0x32, 0xE3, 0x3E, 0x64, 0x65, 0xF8,
+    0xD8, 0xB3, 0xBE, 0xD0, 0x2E, 0x74, 0x6B, 0x32, 0xDF, 0xE0, 0xFA, 0x4D, 0x5F, 0x5D, 0x30, 0x6E,
+    0x2D, 0x64, 0x7B, 0x1E, 0x68, 0x87, 0x62, 0x1C, 0xF3, 0xD2, 0xB2, 0x50, 0xD2, 0x57, 0xC5, 0xC2,
+    0x8D, 0x44, 0x4B, 0xDA, 0x54, 0x6F, 0xA6, 0xEC, 0xA9, 0xB8, 0x70, 0x20, 0x3C, 0x8F, 0xB4, 0x41,
+    0x25, 0xCC, 0x1B, 0xA5, 0xAA, 0x75, 0xBF, 0x55, 0xF1, 0x59, 0xDD, 0xD3, 0x66, 0x39, 0x51, 0xD6,
+    0xEB, 0x21, 0xCE, 0xEA, 0xFC, 0xF6, 0x0A, 0x8D, 0xBD, 0x5B, 0x63, 0xEF, 0x19, 0xB8, 0x43, 0x9D,
+    0x4A, 0xAA, 0xF8, 0x95, 0x9D, 0xBB, 0x8B, 0x17, 0x9C, 0x3C, 0xC3, 0x21, 0xE8, 0x6D, 0x46, 0x64,
+    0x0F, 0x58, 0x37, 0xDC, 0xB7, 0xBC, 0x58, 0x34, 0xB1, 0xD3, 0xCF, 0x25, 0x41, 0xE4, 0x49, 0xE9,
+    0xCE, 0xCD, 0x72, 0xE7, 0x66, 0xCC, 0x9B, 0x09, 0x6F, 0xA6, 0xC4, 0xAF, 0x54, 0x2D, 0xCD, 0x00,
+    0x12, 0x88, 0x47, 0xCB, 0x73, 0xD9, 0xA5, 0x77, 0x7C, 0x02, 0x11, 0x7C, 0xCB, 0xBD, 0x3F, 0xB4,
+    0x03, 0x9A, 0x6B, 0x58, 0xB9, 0xF7, 0x97, 0x0E, 0xEA, 0xB6, 0x37, 0xF8, 0xB7, 0xBE, 0xE8, 0x5D,
+    0xDC, 0x8D, 0xAB, 0xBC, 0xCB, 0xFB, 0x7C, 0x88, 0xB7, 0xAF, 0x92, 0x6D, 0x1C, 0xA6, 0xFD, 0xA1,
+    0xFB, 0x71, 0xD8, 0x23, 0x1C, 0xAE, 0xD2, 0xE2, 0x36, 0xA8, 0x78, 0x04, 0x6D, 0xFD, 0x8C, 0x15,
+    0x6E, 0x1E, 0x3E, 0xFE, 0x1C, 0x7E, 0xFE, 0x3F, 0xF8, 0x2E, 0x81, 0xAF, 0xDE, 0x29, 0xF6, 0x30,
+    0xC3, 0x3B, 0x45, 0xDE, 0x95, 0x4D, 0xDE, 0xD7, 0x5D, 0x3E, 0x94, 0x7D, 0xDC, 0xA7, 0x5D, 0xD0,
+    0xAF, 0x3A, 0xCE, 0xB6, 0x6A, 0x22, 0xCC, 0x90, 0xB9, 0x0D, 0xD8, 0x77, 0x1C, 0x54, 0x6E, 0xCF,
+    0x05, 0x83, 0x8B, 0x8E, 0x7D, 0x05, 0x8B, 0x9B, 0xF6, 0x48, 0xF0, 0x10, 0xF2, 0xF7, 0xF3, 0xAF,
+    0x52, 0xC2, 0x78, 0xF1, 0x62, 0xC3, 0xFD, 0xC2, 0xD5, 0xE7, 0x54, 0x98, 0x75, 0x44, 0x17, 0x90,
+    0xFD, 0xDB, 0x26, 0x25, 0xD1, 0x4A, 0xB7, 0xC9, 0x8B, 0x9C, 0x22, 0xF8, 0x69, 0xE9, 0x3E, 0xD0,
+    0xDB, 0x28, 0xF5, 0xAC, 0x3C, 0xCF, 0xB6, 0xDE, 0xCD, 0x87, 0x71, 0x50, 0x38, 0x24, 0x2C, 0xB5,
+    0x3F, 0xA9, 0xAE, 0x1C, 0xF7, 0xA6, 0xDB, 0xA5, 0xAC, 0x40, 0x89, 0x3D, 0xF5, 0xE7, 0xEF, 0xF9,
+    0xA7, 0x72, 0x34, 0xE5, 0xF2, 0xDE, 0x97, 0x1D, 0xA9, 0x1E, 0x33, 0xD6, 0x65, 0xED, 0x37, 0x6B,
+    0xE8, 0xE2, 0xF5, 0xFE, 0x19, 0xED, 0xED, 0xA8, 0x3D, 0xDE, 0xB5, 0x57, 0x6E, 0x2E, 0x41, 0x3B,
+    0x68, 0xC4, 0xCE, 0x4E, 0xFC, 0xBC, 0xDE, 0x77, 0x0F, 0xFD, 0x8C, 0xB9, 0xF0, 0x5E, 0xAB, 0x7E,
+    0xC2, 0x53, 0xAE, 0xA7, 0x1F, 0x93, 0x33, 0x94, 0xB5, 0xB4, 0xA5, 0x49, 0x2B, 0xE5, 0x11, 0xCC,
+    0x3B, 0xD8, 0x9B, 0x12, 0xE3, 0xB3, 0x90, 0x6C, 0x10, 0xB6, 0xD5, 0x55, 0x77, 0xBF, 0x2B, 0xB8,
+    0x83, 0xED, 0x57, 0x0B, 0xB6, 0x6E, 0x57, 0xA6, 0x32, 0x6F, 0x66, 0x78, 0x1D, 0xFA, 0x53, 0x86,
+    0x0C, 0x90, 0x2B, 0x9E, 0x15, 0xC9, 0xB2, 0x6F, 0xF4, 0x46, 0xA4, 0x64, 0x0B, 0x8A, 0xFA, 0xD0,
+    0xDE, 0x75, 0x2A, 0x99, 0x9D, 0x6E, 0xF9, 0x79, 0x75, 0x6F, 0x51, 0xAC, 0xCA, 0xB8, 0x71, 0x72,
+    0x52, 0x6F, 0x25, 0x2D, 0xFF, 0x63, 0xE9, 0x59, 0x44, 0x39, 0xCB, 0x21, 0x82, 0x33, 0xD1, 0xE8,
+    0x49, 0x0C, 0x61, 0x94, 0x2C, 0x4E, 0x89, 0x2C, 0x07, 0x28, 0x74, 0x73, 0x3A, 0x59, 0x28, 0x24,
+    0x09, 0x25, 0x85, 0x7A, 0x9D, 0x64, 0xCE, 0x14, 0x2A, 0x16, 0x0A, 0xE5, 0xC5, 0x42, 0x21, 0xF4,
+    0x96, 0xD5, 0xAE, 0xEE, 0x19, 0x7D, 0x3A, 0xF4, 0x8C, 0x42, 0xC7, 0x2F, 0x7C, 0xE2, 0x0F, 0xDF,
+    0xBB, 0x44, 0xA1, 0xFA, 0x6A, 0x0A, 0xFD, 0x3F, 0xC5, 0x56, 0x3B, 0x73, 0xE4, 0x44, 0x10, 0x6E,
+    0x8D, 0xC0, 0x0A, 0x14, 0x4C, 0xE4, 0x23, 0xB9, 0x42, 0x09, 0x09, 0x14, 0x67, 0xFD, 0x81, 0x5D,
+    0x8F, 0x0A, 0xFE, 0xC0, 0x05, 0x67, 0x12, 0x82, 0xBB, 0xE0, 0x22, 0x27, 0x26, 0xBC, 0xE0, 0xB0,
+    0x84, 0x53, 0x02, 0x2E, 0x21, 0x27, 0x20, 0x3A, 0x52, 0x82, 0x0D, 0x6C, 0x6B, 0xEE, 0x52, 0x12,
+    0xE1, 0x2A, 0x8A, 0xD0, 0x0A, 0x5C, 0x04, 0x10, 0x58, 0x05, 0xE2, 0x4A, 0x6B, 0x76, 0x77, 0xF8,
+    0xBE, 0xD6, 0xAE, 0x29, 0xA8, 0x7B, 0x05, 0x50, 0xE8, 0xD1, 0x3D, 0xAB, 0xE9, 0xE9, 0xE9, 0xD7,
+    0xD7, 0xB3, 0xB5, 0x59, 0xD4, 0xFA, 0x1C, 0x46, 0x03, 0x9E, 0xA9, 0xF4, 0x78, 0x26, 0xD2, 0xE1,
+    0x11, 0x5E, 0x5D, 0xD4, 0x8A, 0x44, 0x5D, 0xDC, 0x6C, 0xA8, 0x69, 0x63, 0x2F, 0x12, 0x37, 0x89,
+    0xD2, 0xB4, 0x02, 0xF5, 0xA0, 0x6F, 0x7E, 0xFC, 0xC3, 0xDD, 0x2F, 0xC5, 0x06, 0x5C, 0x92, 0x2A,
+    0x15, 0x5B, 0x64, 0x50, 0x60, 0x65, 0x07, 0x34, 0x93, 0xA9, 0xD2, 0x09, 0xE8, 0x8E, 0xD2, 0xA9,
+    0x3C, 0x04, 0x9D, 0xC8, 0x4C, 0xC4, 0x41, 0x7C, 0x50, 0xBA, 0x90, 0xED, 0xF9, 0x47, 0xBF, 0xDF,
+    0x11, 0xE9, 0x23, 0x6E, 0xDF, 0x99, 0x76, 0x43, 0x9F, 0xB7, 0x39, 0xA9, 0x44, 0xB0, 0x40, 0x4C,
+    0xB3, 0x21, 0xC9, 0x1C, 0x24, 0x84, 0x4E, 0x92, 0x67, 0x3F, 0x2E, 0xC4, 0x9E, 0x35, 0x4B, 0xC9,
+    0x9F, 0x36, 0xA7, 0xE2, 0x8E, 0x9A, 0x13, 0x92, 0x07, 0x24, 0x22, 0xF9, 0x19, 0x88, 0xBD, 0x02,
+    0x49, 0x02, 0x5D, 0xC3, 0xFE, 0xF8, 0x18, 0xA0, 0xCB, 0x60, 0xAD, 0x98, 0xCB, 0x05, 0xC8, 0x59,
+    0xA0, 0xD2, 0x5A, 0x26, 0xA6, 0x29, 0x8B, 0x63, 0xD3, 0xB8, 0x62, 0x09, 0x22, 0x81, 0xDF, 0xCA,
+    0x0F, 0xA8, 0xF9, 0xA7, 0x5F, 0x06, 0x28, 0xE0, 0xB2, 0xB7, 0x2E, 0xFE, 0x66, 0xC6, 0x5F, 0x64,
+    0x7D, 0x45, 0x01, 0x4E, 0xDC, 0xC2, 0x76, 0xCF, 0xA0, 0x19, 0x9E, 0x5B, 0x7F, 0x28, 0x82, 0x4D,
+    0xF3, 0xCA, 0x09, 0x7D, 0x75, 0x45, 0x5E, 0xC5, 0x10, 0x71, 0x92, 0x7B, 0xFA, 0xE5, 0x24, 0xF3,
+    0x16, 0x7A, 0x4B, 0x70, 0x86, 0x91, 0x7C, 0x77, 0xCD, 0x19, 0x38, 0xCA, 0x0D, 0x52, 0x70, 0xDD,
+    0x67, 0x5D, 0xB6, 0xA2, 0x9E, 0x0F, 0xDB, 0xFA, 0xAE, 0xB7, 0xDE, 0x25, 0x7E, 0x91, 0xB4, 0x69,
+    0xBB, 0xB0, 0x47, 0x7D, 0xDC, 0x99, 0xD0, 0x67, 0x71, 0x6F, 0x7A, 0xD9, 0x2E, 0x76, 0xF1, 0x8B,
+    0x6E, 0x3E, 0x4C, 0x3A, 0x03, 0x23, 0x64, 0x18, 0x79, 0xD4, 0x8D, 0x3C, 0x6E, 0x47, 0x9E, 0xF8,
+    0x51, 0xCE, 0x56, 0xE0, 0x3D, 0x93, 0x66, 0xA0, 0x47, 0x04, 0xBB, 0x43, 0xAF, 0x1A, 0x7F, 0x9A,
+    0xF9, 0xD1, 0xF8, 0xB0, 0x76, 0xEE, 0xF6, 0xB5, 0x9F, 0x49, 0xE8, 0xC9, 0xDC, 0x1F, 0x2B, 0xB2,
+    0x00, 0xFB, 0xC0, 0x96, 0xC2, 0x05, 0x11, 0xF2, 0x01, 0x66, 0x46, 0x86, 0x5F, 0xFC, 0x88, 0xB9,
+    0xBC, 0x52, 0xC9, 0x92, 0x0B, 0xCA, 0xA3, 0x25, 0x59, 0x7E, 0xC9, 0xC4, 0x8B, 0x5D, 0x41, 0x9F,
+    0x97, 0x72, 0x49, 0x66, 0x56, 0xA1, 0x48, 0x7A, 0xB1, 0x9D, 0x6B, 0xD2, 0x06, 0xDE, 0x67, 0x5D,
+    0xEA, 0xC5, 0x55, 0xC9, 0x02, 0xD5, 0x57, 0x16, 0x51, 0xB0, 0x85, 0xD4, 0x50, 0x70, 0x2E, 0x64,
+    0xF9, 0x4A, 0x59, 0x0A, 0x6D, 0x65, 0x81, 0x9C, 0xC2, 0xA2, 0x0A, 0x39, 0xF0, 0x92, 0x37, 0xD0,
+    0xD5, 0x8A, 0x1D, 0x24, 0xFF, 0x62, 0x90, 0x38, 0x5C, 0x2E, 0xE3, 0xF0, 0xB5, 0x94, 0xF8, 0x04,
+    0xC3, 0xA3, 0x3B, 0xDC, 0xB5, 0xD6, 0xFB, 0x10, 0xF7, 0x14, 0xF7, 0x44, 0xAB, 0x55, 0xCC, 0x23,
+    0x46, 0x48, 0xDF, 0x9B, 0x71, 0x73, 0xD3, 0x1D, 0xF9, 0x65, 0xF9, 0xEB, 0x77, 0x61, 0x2B, 0x84,
+    0x0B, 0xC9, 0x06, 0x89, 0xEA, 0x50, 0xB9, 0xAB, 0xF3, 0x95, 0x7B, 0xFA, 0x64, 0x75, 0x2B, 0x6E,
+    0xDE, 0x17, 0x56, 0xEB, 0x5A, 0x7E, 0x0C, 0x8F, 0x96, 0xF2, 0x8B, 0xC8, 0xFE, 0x37, 0x57, 0x8F,
+    0x8B, 0x1A, 0x00, 0xA8, 0x74, 0xF4, 0x72, 0x61, 0x89, 0x1E, 0xD1, 0xA2, 0x77, 0x84, 0xD8, 0x41,
+    0xB4, 0x3B, 0x16, 0x10, 0x26, 0x00, 0x0D, 0x3C, 0x49, 0x25, 0x69, 0x01, 0xD4, 0x21, 0x6F, 0x44,
+    0xDE, 0x94, 0x18, 0x63, 0xCE, 0xFE, 0x21, 0xDB, 0xA8, 0xAC, 0x17, 0x04, 0xCF, 0x3E, 0x4F, 0xFC,
+    0x5B, 0x91, 0x7B, 0x63, 0x46, 0x99, 0x40, 0xC2, 0x5C, 0x6A, 0x8C, 0x12, 0xA6, 0xA7, 0x24, 0x6C,
+    0x98, 0xDF, 0x12, 0xD6, 0x18, 0x0E, 0xF2, 0x6E, 0x3D, 0x2F, 0x8E, 0x06, 0xAA, 0x94, 0x8A, 0x69,
+    0x06, 0x30, 0xA5, 0xC3, 0x41, 0x36, 0x52, 0x19, 0xF5, 0x45, 0x85, 0xEA, 0x57, 0xB7, 0x95, 0xC8,
+    0x8B, 0xAE, 0x12, 0xB3, 0x63, 0x78, 0xB6, 0xF7, 0xF6, 0xF6, 0xD4, 0x22, 0xFA, 0x83, 0xB5, 0x5C,
+    0x93, 0xF5, 0x8A, 0x2F, 0x7E, 0xCD, 0x39, 0x34, 0x5A, 0x95, 0x39, 0x0D, 0x89, 0xB5, 0x0A, 0xCB,
+    0x6A, 0xFD, 0x91, 0xD3, 0x2A, 0x98, 0xE9, 0xA0, 0x5A, 0xDB, 0xC4, 0x79, 0x39, 0xA6, 0xE4, 0xA6,
+    0x8E, 0x6F, 0x9C, 0x6A, 0x88, 0x0D, 0xF7, 0xE5, 0xBA, 0x79, 0x74, 0x00, 0x0F, 0xA3, 0x95, 0x96,
+    0xAD, 0xA4, 0xBD, 0x02, 0x10, 0x35, 0xC8, 0x1A, 0xAD, 0xC6, 0xCA, 0x45, 0x44, 0x17, 0xB2, 0x35,
+    0x7F, 0x03, 0x2D, 0xAA, 0x97, 0xF2, 0x72, 0x01, 0x58, 0xB5, 0x66, 0x81, 0x62, 0xEF, 0xAD, 0x4F,
+    0xBB, 0x68, 0x90, 0x3E, 0xAB, 0x32, 0x0F, 0x60, 0x0D, 0x79, 0xE1, 0x2A, 0xC8, 0xCC, 0x1C, 0x16,
+    0x02, 0x58, 0x83, 0x43, 0xB5, 0x81, 0xF7, 0x87, 0x82, 0x72, 0x6F, 0xC9, 0x97, 0x92, 0xB6, 0xD2,
+    0x9D, 0x80, 0xDB, 0x26, 0x1A, 0xB9, 0x8F, 0x9B, 0x13, 0xC5, 0x51, 0xE2, 0x3F, 0x15, 0xB4, 0xB3,
+    0xC6, 0x16, 0x87, 0x00, 0xD7, 0x6F, 0xDD, 0x2E, 0x5B, 0x45, 0xF8, 0x9E, 0x0D, 0x54, 0xB6, 0x02,
+    0x83, 0x9E, 0x8F, 0x71, 0x55, 0x94, 0xF1, 0x4A, 0xDB, 0x91, 0xC7, 0xF4, 0x35, 0xC2, 0xBB, 0x5A,
+    0x67, 0x14, 0xB9, 0x8A, 0x74, 0x1C, 0x7E, 0xAE, 0x55, 0xE6, 0x20, 0x2C, 0x47, 0xD1, 0xED, 0x31,
+    0xEA, 0x4B, 0x34, 0xE5, 0x7E, 0xCD, 0x0C, 0xC3, 0xB5, 0x24, 0x50, 0x35, 0x56, 0xFF, 0x07, 0x9B,
+    0x29, 0xA6, 0xD9, 0x78, 0x90, 0x31, 0x6D, 0x9A, 0x0D, 0x03, 0x27, 0xD9, 0x5C, 0x53, 0x91, 0xE8,
+    0xA9, 0xC3, 0x82, 0xD2, 0x16, 0x14, 0xED, 0x81, 0xBC, 0xF7, 0xB8, 0x2A, 0x83, 0x47, 0x50, 0x4A,
+    0x36, 0x89, 0x7F, 0xF5, 0x81, 0x42, 0xB4, 0xA6, 0xE0, 0x5D, 0xF0, 0xF7, 0x14, 0x2F, 0x0F, 0x14,
+    0x3B, 0x13, 0x6D, 0xF3, 0x6F, 0xF3, 0xE0, 0x23, 0xB2, 0x10, 0xE7, 0x44, 0x71, 0x89, 0xFA, 0x00,
+    0xEE, 0x68, 0x75, 0xA7, 0x48, 0x9C, 0x29, 0xCC, 0x26, 0x0A, 0xB9, 0x1D, 0x85, 0xDF, 0xF5, 0x82,
+    0x11, 0xC8, 0x38, 0x3D, 0x78, 0xF6, 0x5E, 0x4B, 0xDF, 0xDF, 0x67, 0x8B, 0xF0, 0x6C, 0x62, 0xEE,
+    0x3F, 0x78, 0x6A, 0xCF, 0x40, 0x31, 0xC9, 0x9F, 0xC8, 0x18, 0x64, 0xAD, 0xF5, 0x11, 0x42, 0xF1,
+    0x39, 0xCB, 0xE4, 0x73, 0x4C, 0x5A, 0x1E, 0x4E, 0x3B, 0xEC, 0x6A, 0x53, 0xFA, 0x72, 0x4C, 0xE3,
+    0x7A, 0x78, 0x62, 0x3A, 0x38, 0x02, 0x1F, 0x73, 0xBA, 0x6B, 0x0B, 0xA0, 0x22, 0xE5, 0xB9, 0x15,
+    0x37, 0x38, 0x36, 0xCC, 0xF8, 0x57, 0x82, 0x07, 0x7C, 0xAF, 0x84, 0x28, 0xBE, 0xBD, 0x5F, 0x39,
+    0x6F, 0x09, 0x96, 0x85, 0xFE, 0x43, 0x90, 0x1B, 0x15, 0xF0, 0x86, 0xB5, 0x3C, 0x72, 0x9A, 0x11,
+    0x5C, 0xAF, 0x7A, 0x9D, 0xD7, 0xBE, 0xCE, 0xE2, 0xC8, 0x61, 0xB0, 0xBB, 0x18, 0x31, 0xCA, 0xF4,
+    0xE8, 0xDC, 0xEB, 0xE8, 0xE0, 0x5E, 0x16, 0x06, 0xC6, 0xD8, 0x5B, 0x0E, 0xFC, 0xFD, 0xD9, 0xEB,
+    0x5C, 0xEF, 0x72, 0x03, 0x9E, 0x9D, 0x61, 0xB3, 0x5B, 0xB5, 0x7E, 0xFD, 0xCB, 0x5F, 0xEE, 0x48,
+    0x0F, 0x89, 0xA6, 0xA8, 0xF6, 0xDA, 0x7F, 0x68, 0xC1, 0xAB, 0xD6, 0x6D, 0xF4, 0x73, 0xAF, 0x30,
+    0xEE, 0xED, 0xD0, 0xA2, 0xCC, 0x57, 0xB2, 0x55, 0xE1, 0x94, 0x4C, 0x2B, 0x57, 0xE3, 0x5F, 0x18,
+    0x4E, 0x76, 0x2B, 0xB3, 0x68, 0x55, 0x22, 0x25, 0x10, 0xE9, 0x09, 0xFD, 0x3F, 0x01, 0xDD, 0x5B,
+    0x3D, 0x8C, 0xDD, 0x56, 0x76, 0x3E, 0x24, 0x47, 0x22, 0x60, 0x22, 0x4B, 0x15, 0xAB, 0x05, 0xD6,
+    0x8A, 0xCD, 0x26, 0xC5, 0x46, 0xB6, 0x87, 0xCD, 0x16, 0x5B, 0xCC, 0x1B, 0x72, 0xE3, 0x62, 0xCB,
+    0x55, 0xA1, 0x49, 0x80, 0x6C, 0x93, 0xC2, 0x95, 0x9B, 0x49, 0xB1, 0xC5, 0x04, 0x18, 0x8B, 0xCC,
+    0x36, 0x29, 0x52, 0x64, 0x8A, 0xA4, 0x17, 0x10, 0x05, 0xF0, 0xCE, 0x16, 0x93, 0x62, 0x03, 0x4C,
+    0x31, 0x36, 0x29, 0x04, 0xC8, 0xB6, 0x44, 0x80, 0x20, 0x45, 0x8A, 0xA5, 0x01, 0x01, 0xBB, 0x89,
+    0x0B, 0xB3, 0xE0, 0x66, 0x9F, 0x24, 0x92, 0x37, 0xDF, 0x77, 0x0E, 0xDF, 0x9B, 0x37, 0x92, 0x2C,
+    0xDB, 0x90, 0x22, 0x5B, 0x7A, 0x9A, 0x77, 0x0E, 0x1F, 0x79, 0x79, 0xEF, 0x39, 0xE7, 0x9E, 0x7B,
+    0xFE, 0xEE, 0x95, 0x48, 0x5A, 0x67, 0x2D, 0xFE, 0x35, 0x51, 0x2E, 0xF8, 0x5C, 0x92, 0x38, 0x9F,
+    0xFF, 0x95, 0xFC, 0x97, 0x94, 0x49, 0xCD, 0x7F, 0xE9, 0xFC, 0x2F, 0xAB, 0xB3, 0x26, 0x6B, 0xD2,
+    0x46, 0xE4, 0xFB, 0x6C, 0x7E, 0xB0, 0x02, 0x91, 0x3B, 0x12, 0xA9, 0xDC, 0x28, 0xFE, 0xF8, 0x57,
+    0x2E, 0x0F, 0xBB, 0x83, 0xA2, 0x8C, 0xDB, 0x83, 0x2C, 0x4F, 0xEA, 0x83, 0x5D, 0x0C, 0x81, 0x26,
+    0x99, 0x82, 0xF2, 0xF3, 0x00, 0x9F, 0x6A, 0xBB, 0xA4, 0x01, 0x88, 0xBB, 0x83, 0x40, 0x82, 0xE1,
+    0x20, 0xCE, 0x3D, 0x37, 0x55, 0x78, 0x8C, 0x9E, 0xC5, 0x9B, 0x8E, 0x36, 0x87, 0x34, 0xC0, 0xCF,
+    0x65, 0xB7, 0x44, 0x93, 0x87, 0x4E, 0x64, 0x92, 0xA2, 0xF6, 0x06, 0x49, 0xEA, 0xA0, 0x97, 0xB8,
+    0x0E, 0x3A, 0x89, 0x4B, 0x80, 0x4B, 0x02, 0x20, 0x82, 0x7B, 0x22, 0x3E, 0x9A, 0x0A, 0x9A, 0xE0,
+    0x43, 0x70, 0x75, 0xDA, 0xBB, 0x81, 0xDE, 0x5D, 0x27, 0x57, 0x8B, 0x7F, 0xB8, 0x01, 0x12, 0x28,
+    0x85, 0xA4, 0x04, 0x88, 0xEB, 0x0B, 0x20, 0xE1, 0x83, 0x8C, 0xAF, 0x1D, 0x8A, 0x6C, 0x79, 0x0F,
+    0xEF, 0xCB, 0xDB, 0x91, 0x73, 0x0F, 0x86, 0xF4, 0x21, 0x5E, 0xFE, 0x63, 0xB9, 0xE6, 0xD8, 0xE8,
+    0xDB, 0x46, 0xCF, 0x8E, 0x97, 0xC7, 0x92, 0xA5, 0x53, 0x26, 0xB1, 0x73, 0x83, 0x84, 0x1D, 0x46,
+    0x8E, 0x6A, 0x59, 0x4A, 0x8C, 0x67, 0x92, 0x88, 0x2C, 0xE4, 0x4D, 0x02, 0xBD, 0xD2, 0x7B, 0x71,
+    0x29, 0xA7, 0x12, 0xB6, 0x3E, 0x08, 0x9E, 0x4E, 0x06, 0xC9, 0x8A, 0xA9, 0x40, 0x2F, 0x37, 0x62,
+    0xEB, 0xAF, 0x72, 0x75, 0xEA, 0x4A, 0x83, 0xF1, 0x20, 0xFE, 0x00, 0xD1, 0x88, 0xD7, 0xF1, 0xC2,
+    0x6F, 0xC9, 0x74, 0x80, 0xC1, 0x2B, 0x09, 0x41, 0x76, 0x86, 0x99, 0xA3, 0x20, 0x13, 0xD2, 0xDD,
+    0x2C, 0x08, 0x5B, 0x10, 0x0C, 0x1A, 0x7A, 0x95, 0x00, 0xE5, 0xE0, 0x4D, 0x98, 0x3E, 0xCF, 0x39,
+    0xD7, 0xCE, 0x90, 0xAF, 0xC9, 0x0A, 0xEE, 0x55, 0x90, 0xC3, 0x7C, 0x1F, 0xD7, 0xF9, 0xC5, 0xA7,
+    0x52, 0x28, 0xAC, 0xC8, 0xED, 0x5B, 0xEE, 0x01, 0x6F, 0x3B, 0x97, 0xCB, 0x7B, 0xA7, 0x17, 0x3E,
+    0xEF, 0xCD, 0x13, 0x73, 0xF1, 0xEE, 0xA9, 0x5C, 0xBA, 0xC9, 0x1E, 0x5C, 0x09, 0x2D, 0xD9, 0xEF,
+    0x24, 0x6A, 0x02, 0x88, 0xA4, 0xF6, 0x96, 0x64, 0x5F, 0x41, 0x3B, 0x0B, 0x9C, 0x24, 0x45, 0x23,
+    0x09, 0x76, 0x0D, 0x75, 0x0B, 0x97, 0x6F, 0x82, 0x77, 0x59, 0xF8, 0xAE, 0x87, 0xC8, 0xD2, 0x41,
+    0x76, 0x25, 0x74, 0xD0, 0x1C, 0xA9, 0xF2, 0xB4, 0x23, 0xD3, 0x13, 0x26, 0x28, 0x70, 0x2D, 0x66,
+    0xA9, 0x9A, 0xC0, 0x7B, 0xA2, 0xFA, 0x42, 0xB5, 0x90, 0x84, 0xC0, 0xD7, 0x09, 0xFF, 0x48, 0x7C,
+    0x95, 0x78, 0x4E, 0x50, 0x52, 0xEC, 0x35, 0x66, 0x33, 0x6E, 0xBD, 0x5E, 0xC2, 0xE9, 0xA4, 0xA5,
+    0xA0, 0xC1, 0x9D, 0x97, 0xB3, 0xD1, 0x69, 0xE5, 0x0D, 0x95, 0x3F, 0x16, 0x32, 0x6C, 0xC9, 0x95,
+    0x95, 0xA2, 0xC9, 0xBE, 0xA3, 0x18, 0x43, 0x48, 0x07, 0xB2, 0x4E, 0xEF, 0xC9, 0x35, 0xFC, 0x24,
+    0x9D, 0x1F, 0x9B, 0x86, 0x25, 0x65, 0x54, 0x7B, 0x55, 0x1B, 0x36, 0x71, 0x9E, 0x3C, 0x1C, 0xFD,
+    0x6E, 0x1B, 0x0F, 0x0A, 0xE9, 0x77, 0xC0, 0xE2, 0xAE, 0x1C, 0x1E, 0xA2, 0xCD, 0xB7, 0x65, 0xE7,
+    0x54, 0x9B, 0x2E, 0xFA, 0x90, 0x5C, 0x6E, 0xF7, 0x91, 0xA2, 0x2E, 0x6A, 0x36, 0x7E, 0xCD, 0xE8,
+    0x34, 0xD4, 0x96, 0x87, 0xFA, 0xC2, 0xCE, 0x0E, 0x54, 0xD7, 0x97, 0xC3, 0x5D, 0xCC, 0xF7, 0x9B,
+    0xB2, 0x4C, 0x24, 0xFB, 0x9F, 0xC1, 0xEB, 0xE2, 0x3A, 0x74, 0x6D, 0xD0, 0x68, 0x0B, 0xB0, 0x44,
+    0x5A, 0x0A, 0xCC, 0x49, 0x23, 0xE1, 0x92, 0x82, 0xFB, 0x94, 0xF2, 0x83, 0xC4, 0xEF, 0x2B, 0xF5,
+    0x7B, 0xBA, 0x56, 0x8E, 0x24, 0xF9, 0x4D, 0x2F, 0x69, 0x39, 0x48, 0x94, 0x0F, 0xBA, 0x0C, 0xBC,
+    0x6A, 0x90, 0xF4, 0x3F, 0x06, 0xBC, 0x39, 0x80, 0x60, 0x7C, 0xB1, 0x3E, 0x8A, 0x10, 0x6A, 0x38,
+    0x16, 0xE5, 0xE5, 0xDB, 0xD7, 0x39, 0xE3, 0x57, 0x30, 0xE6, 0x2F, 0xE5, 0xD0, 0xEF, 0xBC, 0x65,
+    0x88, 0xD1, 0x92, 0x3A, 0x6E, 0xB3, 0x3C, 0xAB, 0x9D, 0x54, 0x7F, 0x32, 0x4A, 0xF1, 0xB3, 0x11,
+    0x2A, 0xE7, 0x84, 0xF7, 0x02, 0x90, 0x24, 0x4B, 0xF0, 0xB6, 0x80, 0x82, 0x26, 0x72, 0xF0, 0xFE,
+    0xF1, 0xF1, 0x71, 0x5E, 0x51, 0x60, 0xB8, 0x3A, 0xE1, 0xC2, 0x8A, 0xBE, 0x18, 0x5C, 0x92, 0xEB,
+    0xC7, 0x77, 0x32, 0xB7, 0xCC, 0x74, 0x06, 0xBF, 0x82, 0xF4, 0xEF, 0xEE, 0xED, 0x09, 0xA4, 0xFF,
+    0x23, 0xAC, 0x49, 0x4A, 0x3F, 0x03, 0x23, 0xFD, 0x0E, 0x96, 0xED, 0x2D, 0x48, 0x1F, 0x28, 0x83,
+    0xF4, 0x15, 0x2D, 0x7A, 0xBD, 0xB9, 0x4D, 0x34, 0x40, 0xFA, 0xD0, 0xE2, 0x56, 0x7F, 0x41, 0xB1,
+    0x89, 0xE2, 0x06, 0xD2, 0x97, 0x0C, 0xDD, 0x2E, 0xF0, 0x1E, 0x04, 0xBF, 0xC3, 0x5E, 0x46, 0x4A,
+    0x3F, 0x83, 0x98, 0x96, 0x89, 0xEF, 0xDA, 0xEC, 0x93, 0x2E, 0xFE, 0xB7, 0xE3, 0xDB, 0xAF, 0xFD,
+    0xE3, 0x57, 0x90, 0xFE, 0x75, 0x48, 0x03, 0x8C, 0x39, 0xD7, 0xF3, 0xEA, 0x36, 0x6F, 0x7B, 0x68,
+    0x14, 0x81, 0xCF, 0xA4, 0xFC, 0xC8, 0x48, 0x83, 0xD4, 0x56, 0x5F, 0xFE, 0xE6, 0x7D, 0x3E, 0xF7,
+    0xB4, 0x33, 0xBE, 0x70, 0x83, 0x0A, 0xDD, 0x3E, 0x05, 0xBC, 0xFF, 0x8B, 0x07, 0x2B, 0x99, 0xF3,
+    0xEA, 0xE9, 0x8D, 0xC5, 0x3B, 0x92, 0x47, 0x3F, 0xFA, 0xAE, 0x02, 0x9F, 0xEA, 0xF2, 0xE9, 0x52,
+    0x99, 0xCF, 0xA0, 0x79, 0xAF, 0x43, 0xD8, 0x26, 0x74, 0xA8, 0x0E, 0xD4, 0x5A, 0x25, 0x0F, 0xDB,
+    0x26, 0xDB, 0x5C, 0xEE, 0xF8, 0xD9, 0x84, 0x58, 0x5F, 0x11, 0xAD, 0x02, 0x18, 0x77, 0x72, 0x15,
+    0x13, 0xE2, 0x63, 0xBA, 0x52, 0xF6, 0xE1, 0x8D, 0x42, 0xED, 0x7D, 0x67, 0xF5, 0x3E, 0xCC, 0xA2,
+    0x07, 0x95, 0x50, 0xCE, 0x7C, 0xDE, 0xAB, 0x54, 0x80, 0xDF, 0xC7, 0xF7, 0x00, 0xD7, 0xB7, 0xD0,
+    0x3E, 0xC5, 0x94, 0xFB, 0x60, 0xC1, 0x3B, 0x0E, 0x86, 0xB0, 0x8B, 0x9B, 0x14, 0x0B, 0x76, 0x5E,
+    0x8E, 0x05, 0xDB, 0x3F, 0x3B, 0xC8, 0x05, 0x94, 0x96, 0x1E, 0x40, 0x1D, 0x40, 0x9D, 0xFB, 0xA4,
+    0x00, 0xE7, 0x53, 0xDA, 0x9F, 0x55, 0x7D, 0xD4, 0x9F, 0x5D, 0x82, 0xF2, 0x9F, 0x71, 0x34, 0x05,
+    0xA4, 0x11, 0xCD, 0x49, 0x29, 0x27, 0xA3, 0xE2, 0xBC, 0x67, 0xED, 0xCA, 0x63, 0xC8, 0x9F, 0x52,
+    0xD7, 0xA9, 0x9E, 0xAE, 0x4C, 0xDC, 0xF4, 0x13, 0xE8, 0x91, 0x1B, 0xC2, 0x7A, 0x86, 0xC5, 0x53,
+    0xA1, 0xB5, 0x49, 0x15, 0xC6, 0x0A, 0x03, 0x85, 0xF2, 0xE7, 0x67, 0x84, 0xB2, 0xF3, 0xFF, 0x06,
+    0x0F, 0x43, 0xB0, 0xF2, 0x9D, 0x21, 0x84, 0x92, 0xA6, 0x43, 0xE8, 0x4A, 0x13, 0x6E, 0x0A, 0x71,
+    0x54, 0xF8, 0x97, 0x99, 0x41, 0x0C, 0x4A, 0x78, 0x27, 0x09, 0x47, 0xD3, 0x6F, 0xFD, 0xAB, 0x04,
+    0xAE, 0xAD, 0x02, 0xF3, 0xAF, 0xD1, 0x29, 0x84, 0x2E, 0x2F, 0x8A, 0xFC, 0x7B, 0x68, 0xFE, 0xD4,
+    0xBF, 0xD4, 0x8D, 0xD0, 0x08, 0x0F, 0x4A, 0x15, 0x3F, 0x84, 0x7D, 0xC9, 0x69, 0x1E, 0x33, 0xA8,
+    0x14, 0xAF, 0xD2, 0x72, 0xF5, 0xBD, 0x85, 0xDF, 0x54, 0x7D, 0xFE, 0xA2, 0xEA, 0xCB, 0x71, 0x89,
+    0x49, 0xCF, 0xE1, 0x11, 0x5B, 0x10, 0x46, 0x4F, 0x71, 0x4B, 0x22, 0xDA, 0x9A, 0x3E, 0x69, 0xFC,
+    0x31, 0xEA, 0xC4, 0xC1, 0x1F, 0xBA, 0x70, 0xE9, 0x0F, 0x31, 0x5C, 0x6D, 0x52, 0x47, 0x0D, 0x3C,
+    0x6F, 0xF9, 0x01, 0x94, 0xAD, 0x97, 0x03, 0xDF, 0x48, 0x84, 0xD6, 0x99, 0x7E, 0x1D, 0xD2, 0x82,
+    0x00, 0xA3, 0xDB, 0x0A, 0xCC, 0xC0, 0x4A, 0xC9, 0xF7, 0x80, 0x83, 0xD6, 0x54, 0x4A, 0x65, 0x52,
+    0xE8, 0x72, 0x56, 0x9C, 0xCC, 0xAA, 0xB6, 0x3B, 0xE3, 0xC3, 0x19, 0x2F, 0x0D, 0xE3, 0xF5, 0x0F,
+    0x89, 0x83, 0x16, 0x24, 0x00, 0x87, 0x75, 0x48, 0xCC, 0xE8, 0x09, 0x36, 0xD5, 0x8D, 0x58, 0xC7,
+    0x03, 0x16, 0xC1, 0xCD, 0x5D, 0xF9, 0x97, 0xC1, 0x82, 0x87, 0x4F, 0x14, 0x2F, 0x83, 0xBB, 0xC4,
+    0x5E, 0x17, 0xFD, 0x90, 0x38, 0x68, 0xDF, 0xD4, 0x98, 0x24, 0xAC, 0xB1, 0x70, 0x96, 0x1C, 0xFD,
+    0xFA, 0x2F, 0xA6, 0x3B, 0x3A, 0xBA, 0xDE, 0xDF, 0x9D, 0xF1, 0xE1, 0x8C, 0xD1, 0x24, 0x9D, 0xED,
+    0xC1, 0xD5, 0xBD, 0x5C, 0xF9, 0x3B, 0x9D, 0xF9, 0xEB, 0x8D, 0x3F, 0x84, 0x12, 0xCA, 0x5F, 0xD0,
+    0x18, 0x7F, 0xD1, 0x8A, 0xAF, 0xDC, 0x70, 0x3A, 0xF3, 0xB1, 0x98, 0xF1, 0xD9, 0x8C, 0x7B, 0xC3,
+    0x7C, 0x5D, 0xF9, 0x6A, 0xD2, 0xFB, 0xC4, 0xD1, 0xDD, 0xA9, 0x2A, 0x81, 0xE3, 0x77, 0xB1, 0x08,
+    0xC1, 0x5F, 0x0A, 0x3B, 0xDF, 0x82, 0xBF, 0x85, 0x77, 0x3B, 0x6A, 0xC1, 0xDF, 0xD9, 0xEC, 0xB5,
+    0x7B, 0x0B, 0x97, 0xF8, 0x3A, 0xD7, 0x04, 0x47, 0x67, 0xD0, 0xC4, 0xD1, 0x39, 0x02, 0x46, 0xD7,
+    0x9E, 0xD3, 0xD9, 0xD0, 0x2F, 0xC8, 0xDA, 0x5F, 0xEA, 0xB3, 0x5E, 0xFE, 0x99, 0x20, 0x60, 0x2C,
+    0x86, 0x36, 0x21, 0x31, 0x25, 0xB4, 0xB7, 0x77, 0x83, 0x06, 0x04, 0xDE, 0x5A, 0x8D, 0x08, 0x9B,
+    0xD2, 0x90, 0x70, 0x24, 0x1A, 0x13, 0x76, 0x47, 0x83, 0x12, 0x34, 0x16, 0xD2, 0x29, 0x9F, 0x8C,
+    0xFE, 0xA8, 0xB8, 0x30, 0x2E, 0xE9, 0x6C, 0x62, 0x95, 0x4F, 0x18, 0x99, 0x33, 0x33, 0x70, 0xC6,
+    0xA7, 0x14, 0x7E, 0xE7, 0xDF, 0xA6, 0xC1, 0x09, 0x9A, 0xB8, 0xA3, 0xD1, 0x89, 0xEA, 0xA4, 0xA3,
+    0xE1, 0x89, 0xF3, 0xAC, 0xA3, 0xF1, 0x49, 0xE5, 0xF7, 0x1D, 0x0D, 0xD0, 0xC2, 0xFF, 0x4F, 0x25,
+    0xE7, 0x2C, 0xF8, 0x1B, 0xC5, 0x7D, 0xAC, 0xBE, 0xD9, 0xEF, 0xDE, 0x51, 0x1C, 0x34, 0x07, 0x8A,
+    0xA3, 0xDA, 0x02, 0xA7, 0x38, 0x3F, 0x3E, 0x79, 0x70, 0xA4, 0x7C, 0x9A, 0x0F, 0x9F, 0xF1, 0xD9,
+    0x8C, 0xFB, 0x39, 0xD6, 0xA0, 0x5B, 0xD8, 0xB3, 0x15, 0x87, 0x58, 0x48, 0xA8, 0x3B, 0xD1, 0x60,
+    0xD8, 0xEF, 0x37, 0x0C, 0x32, 0x4C, 0x3E, 0x74, 0x5F, 0x95, 0x75, 0xF5, 0x8D, 0x3A, 0xB5, 0x42,
+    0xC1, 0x84, 0xD1, 0xD0, 0x94, 0x21, 0x79, 0x56, 0x5B, 0x7C, 0x56, 0x99, 0x2A, 0xDC, 0xE0, 0xB4,
+    0xE2, 0x3B, 0x66, 0x25, 0x18, 0x6A, 0x82, 0x21, 0x98, 0xAA, 0x5E, 0xC3, 0x2F, 0x15, 0xEC, 0xCF,
+    0xAD, 0x6B, 0x67, 0x28, 0xB3, 0xBB, 0x1A, 0x7F, 0x99, 0x55, 0x97, 0x59, 0xA9, 0x1E, 0xFB, 0x98,
+    0x4F, 0x56, 0x83, 0x2D, 0x3A, 0xBE, 0xCC, 0x4B, 0x0A, 0x44, 0x55, 0xCA, 0x54, 0x6C, 0xBD, 0x25,
+    0xA9, 0xF6, 0xB6, 0x48, 0x74, 0x6E, 0x76, 0x62, 0x93, 0x60, 0x64, 0x02, 0x0C, 0x34, 0x10, 0xEF,
+    0xB8, 0x6C, 0xE0, 0x87, 0xB4, 0x37, 0xCC, 0xE1, 0xA4, 0x8B, 0x40, 0x89, 0xC2, 0x0A, 0x24, 0x33,
+    0x08, 0xA1, 0x19, 0x5B, 0xA7, 0x86, 0x16, 0x4C, 0x10, 0x74, 0x1D, 0xB0, 0xB7, 0x53, 0x13, 0x03,
+    0x55, 0x7E, 0xA9, 0x42, 0x41, 0x6F, 0x24, 0x3D, 0x18, 0x55, 0xCC, 0xB0, 0xE7, 0x27, 0x53, 0x29,
+    0x27, 0xEE, 0x1E, 0xDF, 0x75, 0x1A, 0x3D, 0xF8, 0x1F, 0x1A, 0xA1, 0x26, 0xDD, 0xD8, 0xD6, 0x90,
+    0x85, 0xB6, 0xF2, 0x81, 0xF1, 0x37, 0xF3, 0x9E, 0xBF, 0x32, 0x4C, 0xCF, 0x3C, 0xCF, 0x54, 0xC7,
+    0xA6, 0x78, 0xE9, 0xDF, 0x29, 0x9D, 0xB7, 0x6C, 0xAA, 0x7B, 0x9B, 0xEA, 0x7C, 0x23, 0xD6, 0x7D,
+    0xC9, 0x99, 0xFE, 0xEE, 0xAC, 0xDE, 0x6D, 0xAC, 0x79, 0xC4, 0xC8, 0x00, 0x25, 0xF8, 0x6B, 0xA7,
+    0x56, 0x36, 0x4F, 0xFB, 0x57, 0x4C, 0xAF, 0x4F, 0x3D, 0x1D, 0x7D, 0xD2, 0xD1, 0x57, 0x68, 0xD4,
+    0x8C, 0x57, 0x5D, 0xE7, 0x2B, 0xB6, 0x8A, 0xED, 0x13, 0x1A, 0xD5, 0xC9, 0x67, 0x46, 0xA0, 0x46,
+    0xB3, 0x08, 0x12, 0x3A, 0x43, 0xFA, 0x6B, 0xA1, 0x7E, 0x1D, 0xF9, 0x60, 0xBD, 0xF1, 0xC2, 0xCB,
+    0xC6, 0x2D, 0x23, 0x4A, 0x5D, 0xB4, 0x7A, 0x41, 0x32, 0xC3, 0x13, 0x04, 0x8E, 0x5A, 0xA5, 0x00,
+    0xB9, 0x1A, 0xAA, 0x6C, 0xE3, 0x82, 0x05, 0x00, 0xD9, 0xE1, 0x05, 0x79, 0x38, 0xC5, 0x45, 0xC0,
+    0x3B, 0x9D, 0xB1, 0x04, 0x8A, 0xE7, 0x8B, 0xA0, 0x9E, 0x2F, 0xA2, 0x72, 0xBE, 0x48, 0x64, 0xBE,
+    0x58, 0x90, 0xE8, 0x4E, 0x23, 0x8D, 0xF9, 0xA2, 0x9F, 0x1F, 0x81, 0x54, 0xBB, 0x08, 0x8C, 0x2B,
+    0x4B, 0xC4, 0xF4, 0x02, 0xBE, 0xD6, 0x1E, 0x25, 0x32, 0x5F, 0x2C, 0xEC, 0xE2, 0x36, 0x1D, 0x1E,
+    0x2F, 0x3A, 0xF2, 0xAB, 0x17, 0xF4, 0xD7, 0xF0, 0x53, 0x7E, 0x17, 0xDA, 0x45, 0xD4, 0x55, 0x53,
+    0xF9, 0x1A, 0xF9, 0xEA, 0xD0, 0x5B, 0xA2, 0x17, 0x73, 0x9E, 0x53, 0x81, 0xD5, 0x84, 0x12, 0xA8,
+    0xCA, 0x70, 0x84, 0xB0, 0xBD, 0x29, 0x44, 0x2F, 0x13, 0x85, 0xF8, 0x11, 0xDD, 0xDD, 0x5F, 0xD0,
+    0xDF, 0xA9, 0xD3, 0x33, 0x59, 0xE8, 0x3C, 0xBA, 0xCF, 0x03, 0xFA, 0xB4, 0xD2, 0xA8, 0x6E, 0xFD,
+    0x1A, 0x7B, 0x91, 0x44, 0x1D, 0x37, 0x66, 0xF6, 0x0F, 0xA8, 0x17, 0xBB, 0xE2, 0x9A, 0xCB, 0x03,
+    0xF3, 0x97, 0x1E, 0xB9, 0x32, 0x85, 0x9D, 0x30, 0xDF, 0x8A, 0x8F, 0x56, 0xA5, 0x04, 0xAB, 0x1D,
+    0x8D, 0xAB, 0x02, 0x12, 0x2B, 0x0B, 0xAC, 0x4A, 0x20, 0xC8, 0x40, 0xDB, 0xD7, 0x35, 0x97, 0x32,
+    0xA5, 0xB1, 0xC5, 0xA7, 0x8D, 0xE6, 0xF0, 0xD1, 0x82, 0x2F, 0xF1, 0xD6, 0x0A, 0x8C, 0x0C, 0xC9,
+    0x8D, 0x33, 0xF4, 0x9D, 0x30, 0xAC, 0x71, 0x2A, 0xBC, 0x35, 0x7C, 0x47, 0xE1, 0x1B, 0x2B, 0x37,
+    0xFD, 0xB9, 0x50, 0x67, 0xC2, 0x94, 0xE3, 0x0B, 0x5A, 0xAE, 0xA0, 0xCF, 0xC4, 0x87, 0x2A, 0xE3,
+    0x34, 0x16, 0x73, 0x54, 0x5E, 0x64, 0x41, 0x08, 0xBA, 0xF7, 0xDD, 0x2A, 0xFD, 0x53, 0x5D, 0x3B,
+    0x56, 0x9A, 0xA7, 0x55, 0x8C, 0x82, 0xD6, 0xBA, 0xA4, 0x54, 0xEB, 0x2C, 0xAC, 0xDA, 0x70, 0x1A,
+    0x2F, 0x03, 0x47, 0xD7, 0xCB, 0x75, 0x06, 0x27, 0xAA, 0x6C, 0xC1, 0xEF, 0xC8, 0x57, 0xD4, 0x7C,
+    0xA0, 0x2A, 0xCC, 0x88, 0x7F, 0xEB, 0x7C, 0x92, 0x5E, 0x02, 0x8E, 0xE2, 0x9C, 0xEA, 0x95, 0xD6,
+    0xD5, 0x1A, 0x26, 0x75, 0xA1, 0x8A, 0xB6, 0x75, 0xD1, 0xE6, 0x7F, 0xF3, 0x79, 0x79, 0x3F, 0xE7,
+    0xCA, 0x44, 0x2A, 0x41, 0x93, 0xB8, 0x54, 0xAA, 0xB6, 0x8C, 0xF2, 0x11, 0x7F, 0xBE, 0xD3, 0x4E,
+    0x9E, 0xE1, 0x0F, 0x3D, 0xEC, 0xBB, 0xDF, 0x6A, 0xA1, 0xFA, 0x43, 0x1A, 0x60, 0x8C, 0x94, 0x96,
+    0x5C, 0x9D, 0xFD, 0x1C, 0xF0, 0x3D, 0xFF, 0x81, 0x8E, 0x79, 0x1D, 0xBA, 0x3A, 0xFE, 0xAF, 0x36,
+    0xF5, 0xFA, 0x43, 0x39, 0xBC, 0xA2, 0x2C, 0x3D, 0xF7, 0x81, 0x56, 0x35, 0xCB, 0x61, 0xB3, 0x66,
+    0xF9, 0xDC, 0x47, 0x81, 0xF2, 0xFC, 0xF7, 0xAC, 0x49, 0x2D, 0x2D, 0x9F, 0x5C, 0x9B, 0x6C, 0x7E,
+    0x67, 0x55, 0x48, 0x5B, 0x45, 0x34, 0x81, 0xCE, 0x12, 0x19, 0xA7, 0x2E, 0x4E, 0x55, 0xC0, 0xF4,
+    0x8D, 0xB6, 0xC4, 0xC9, 0xAA, 0x6F, 0x7C, 0x2B, 0xDA, 0xFC, 0x35, 0xBA, 0xF8, 0x6C, 0x03, 0x79,
+    0x86, 0xFC, 0x69, 0xB3, 0xCF, 0x79, 0x04, 0xA6, 0x40, 0xE7, 0xA3, 0x57, 0x35, 0x29, 0xA3, 0x7F,
+    0xA7, 0x6E, 0x69, 0xB2, 0xE5, 0x26, 0x9D, 0xDE, 0xCB, 0x16, 0x0A, 0x55, 0x7D, 0xC8, 0xFC, 0xD0,
+    0x4D, 0x0C, 0x0E, 0xFD, 0xA6, 0x9A, 0xD4, 0x2B, 0x26, 0xCB, 0x47, 0x23, 0xFF, 0x62, 0xA4, 0x17,
+    0xEF, 0x0B, 0xA7, 0xC8, 0xA7, 0xD2, 0x73, 0x74, 0xF3, 0xE6, 0xB4, 0x1D, 0x44, 0x4B, 0x45, 0xBF,
+    0x1F, 0x15, 0xFD, 0xCE, 0x29, 0xEA, 0xE1, 0x69, 0x88, 0xB2, 0x46, 0x11, 0x7C, 0x0C, 0x51, 0xBC,
+    0x54, 0x04, 0xD2, 0x89, 0xC0, 0x0F, 0x11, 0x24, 0xA7, 0x28, 0xAB, 0x15, 0x25, 0x9D, 0xA2, 0xB8,
+    0x57, 0x14, 0x0C, 0x8A, 0x7C, 0xA7, 0x48, 0x9C, 0x26, 0xCA, 0x92, 0x0D, 0x8A, 0x52, 0x43, 0xDC,
+    0x12, 0xB0, 0xE4, 0x71, 0xDF, 0x1D, 0xD1, 0x21, 0x55, 0xA4, 0x0C, 0xCF, 0x2E, 0xDF, 0x51, 0xA3,
+    0x6D, 0x1E, 0xC8, 0x62, 0x9E, 0x6C, 0x23, 0xCB, 0xB3, 0x78, 0x69, 0xE3, 0xE3, 0xAB, 0x90, 0x52,
+    0x95, 0x98, 0x2B, 0x21, 0x67, 0xAD, 0x69, 0x94, 0xCC, 0x95, 0x92, 0x86, 0xE9, 0x7D, 0xDC, 0xD1,
+    0x63, 0x86, 0x3D, 0x9D, 0x67, 0x30, 0xD0, 0xE9, 0x06, 0x03, 0x5D, 0xAA, 0x3F, 0xD2, 0xBB, 0xFA,
+    0x23, 0x1D, 0xAD, 0x3F, 0x69, 0x11, 0xFD, 0x31, 0xE8, 0x4F, 0xD6, 0xC6, 0xDA, 0xDB, 0xBB, 0xD6,
+    0x0F, 0xE3, 0x82, 0xB0, 0x4F, 0xB4, 0x7F, 0x86, 0x46, 0x49, 0xC3, 0x71, 0x11, 0x8E, 0xB9, 0x9C,
+    0xAA, 0x92, 0x4D, 0xD5, 0x52, 0x66, 0x5F, 0x2C, 0x97, 0x6E, 0x28, 0xA5, 0x66, 0xC2, 0x6D, 0x2F,
+    0x42, 0x19, 0xD3, 0x6D, 0x1D, 0x2B, 0xE2, 0xCC, 0x5E, 0x76, 0xEB, 0x25, 0xE4, 0xEB, 0x35, 0xAD,
+    0x08, 0x5B, 0x72, 0x92, 0x59, 0x9C, 0x71, 0x8B, 0xF4, 0xF7, 0xDC, 0x7D, 0x0A, 0x6B, 0x86, 0x75,
+    0xDE, 0x86, 0x7A, 0xBE, 0x2C, 0x7C, 0x79, 0x7F, 0xAF, 0x61, 0x83, 0x63, 0x85, 0x27, 0x71, 0x9F,
+    0x74, 0x8C, 0xAB, 0x69, 0x3D, 0x7E, 0xE0, 0x59, 0x2D, 0x62, 0xEB, 0xA5, 0x9B, 0xA9, 0xA0, 0x61,
+    0xF9, 0x2A, 0xEA, 0x92, 0x9A, 0x50, 0x49, 0xEA, 0x74, 0x51, 0xE5, 0xDE, 0x4B, 0xBB, 0xA6, 0x44,
+    0xFE, 0x10, 0x31, 0xB0, 0x55, 0x77, 0xC1, 0x0B, 0xB3, 0x12, 0x3A, 0xE1, 0x81, 0x7C, 0x65, 0x0C,
+    0x27, 0x62, 0xCD, 0x9D, 0xFB, 0xD5, 0x95, 0xDE, 0xE3, 0x53, 0x6D, 0xA7, 0x6F, 0xE8, 0xBB, 0x6F,
+    0x8B, 0x7C, 0xEB, 0x9C, 0x7F, 0x4F, 0xB5, 0x35, 0xA4, 0x41, 0x9E, 0x7E, 0xAC, 0x82, 0x98, 0x36,
+    0x04, 0x51, 0xA9, 0x20, 0x1C, 0x05, 0xE1, 0xFF, 0x9A, 0x82, 0x08, 0x7F, 0x45, 0x41, 0xC4, 0xEF,
+    0x52, 0x10, 0x89, 0x0A, 0x62, 0xA1, 0x82, 0x38, 0x50, 0x41, 0x74, 0x14, 0x84, 0xDF, 0x92, 0xF9,
+    0xA0, 0x26, 0x8C, 0x4A, 0xC2, 0x58, 0x05, 0xB1, 0x50, 0x41, 0x1C, 0xAA, 0x20, 0x68, 0x38, 0xB3,
+    0xBB, 0x1D, 0x05, 0xF1, 0xAF, 0x35, 0x05, 0xF1, 0x69, 0x49, 0x41, 0x38, 0x15, 0xC4, 0xB4, 0x21,
+    0x08, 0x47, 0x41, 0x78, 0xFF, 0x4B, 0x41, 0x04, 0x0D, 0x05, 0xE1, 0xCF, 0xAB, 0xEB, 0x7D, 0xC3,
+    0x99, 0xA5, 0x45, 0x71, 0x7B, 0xA1, 0x2C, 0x36, 0xFB, 0x09, 0x0B, 0x7E, 0x37, 0x2D, 0x0D, 0x7C,
+    0x2D, 0x52, 0x87, 0x7E, 0x46, 0x5A, 0xB7, 0x34, 0x9F, 0xC7, 0x44, 0xE8, 0xEB, 0x40, 0xA7, 0x56,
+    0x0D, 0x5C, 0x6A, 0x8A, 0xC4, 0x6C, 0x13, 0x0E, 0x89, 0x5C, 0x24, 0xF7, 0x35, 0x1D, 0x63, 0x0A,
+    0x67, 0x1B, 0x3E, 0xBD, 0x15, 0x5B, 0x67, 0xA5, 0xB5, 0x82, 0x51, 0xD8, 0x6F, 0x32, 0x9F, 0x96,
+    0x1B, 0x99, 0xCC, 0x5C, 0x3F, 0xDD, 0xAC, 0x2C, 0xBC, 0x22, 0xBC, 0x1F, 0x9B, 0xDA, 0x9A, 0x65,
+    0x0A, 0xAC, 0xC8, 0x1E, 0xFD, 0x46, 0x27, 0x3E, 0xC9, 0x97, 0x36, 0xED, 0x0B, 0x4B, 0x7A, 0xB6,
+    0x5E, 0x31, 0xDE, 0xB7, 0x6D, 0x77, 0x23, 0xCB, 0x27, 0xAB, 0x08, 0x1B, 0xB2, 0x5C, 0x77, 0xEB,
+    0x62, 0x65, 0xF0, 0x15, 0x9A, 0x70, 0x8B, 0x92, 0xE6, 0xA4, 0x7D, 0x55, 0x07, 0xB1, 0x38, 0x69,
+    0xDE, 0x2D, 0xF0, 0x1E, 0xAF, 0x08, 0x67, 0x6E, 0xF0, 0x9C, 0xCB, 0x67, 0x14, 0x38, 0xAB, 0x20,
+    0x30, 0x1E, 0x6D, 0xB5, 0xCA, 0x40, 0x57, 0x9D, 0x59, 0x69, 0x06, 0x46, 0x38, 0xB1, 0xFE, 0xA9,
+    0x36, 0xA1, 0x86, 0x80, 0x8C, 0xD2, 0x94, 0x08, 0x67, 0x41, 0x58, 0xF5, 0xAE, 0x0E, 0x9B, 0xFD,
+    0xAD, 0xD5, 0xA0, 0x7E, 0x6D, 0x14, 0x59, 0x6D, 0x2E, 0x1C, 0xE4, 0x3C, 0xF7, 0xFE, 0x2A, 0xC8,
+    0xDE, 0x8B, 0x14, 0xF9, 0x95, 0xBB, 0x63, 0xB5, 0x1B, 0x4A, 0x87, 0x36, 0x78, 0x86, 0xBE, 0x55,
+    0x83, 0x2F, 0x24, 0x6B, 0x7B, 0x73, 0xAD, 0x29, 0xE7, 0x75, 0xA5, 0x91, 0x7C, 0xA4, 0x61, 0xF6,
+    0x1C, 0xC0, 0x7F, 0x89, 0x3F, 0x8B, 0xF1, 0x2D, 0x46, 0x57, 0x13, 0x7F, 0x6C, 0x09, 0xE3, 0xFD,
+    0x27, 0xA5, 0x87, 0x46, 0xC3, 0xBE, 0x26, 0x16, 0x95, 0xB3, 0x40, 0xF5, 0xF2, 0x3F, 0xE9, 0x2A,
+    0xD4, 0xF3, 0x1F, 0x7D, 0x68, 0xD5, 0xA3, 0x51, 0x2B, 0xF5, 0xC5, 0x6A, 0x13, 0xB2, 0xD2, 0x9F,
+    0x95, 0x5A, 0x73, 0x85, 0xA9, 0x43, 0x78, 0x51, 0xBE, 0x8E, 0x4C, 0xE2, 0x18, 0xF7, 0xB5, 0x50,
+    0x53, 0x69, 0x15, 0xA6, 0x52, 0xC3, 0xBD, 0xBA, 0xD6, 0xFB, 0x9E, 0xD3, 0x8D, 0x12, 0x4D, 0x0E,
+    0xE0, 0x95, 0xF4, 0xFC, 0x0C, 0x48, 0x44, 0x3F, 0x45, 0x47, 0x08, 0xA2, 0x2B, 0x15, 0x65, 0x15,
+    0x94, 0x08, 0x2E, 0xAB, 0x50, 0x61, 0xC4, 0x83, 0x45, 0x2E, 0x6C, 0xC3, 0xEE, 0x2D, 0x17, 0x8C,
+    0xFB, 0x4D, 0xC6, 0xAC, 0x65, 0xB5, 0x29, 0xAF, 0x96, 0x43, 0x2B, 0x51, 0xAA, 0x44, 0x5A, 0x26,
+    0xF1, 0xFA, 0xF9, 0xC8, 0xD0, 0x86, 0x9B, 0x50, 0xC5, 0xAB, 0x10, 0x00, 0x05, 0xD3, 0x4F, 0x06,
+    0x1A, 0xD9, 0x91, 0x15, 0xC1, 0x8A, 0xD1, 0x2B, 0x77, 0x6D, 0xC8, 0x9D, 0xAC, 0xC1, 0xA5, 0x63,
+    0xA7, 0xA7, 0x71, 0x24, 0xBA, 0x8F, 0x9F, 0xD0, 0xA5, 0x82, 0x7A, 0x55, 0x18, 0xCF, 0x2B, 0xE0,
+    0x70, 0x0F, 0x09, 0x4F, 0xD2, 0x26, 0x59, 0x1E, 0xBB, 0x21, 0xBB, 0xE7, 0xBB, 0x2E, 0x5D, 0xCA,
+    0xD5, 0x73, 0x63, 0xAE, 0xFB, 0x1D, 0x5A, 0xD3, 0xD4, 0xBD, 0x8E, 0x0F, 0xD6, 0xFB, 0x1C, 0xF9,
+    0xD7, 0x43, 0x95, 0xF7, 0xA1, 0x6A, 0xE3, 0x6A, 0x3B, 0x42, 0x37, 0x23, 0x76, 0x83, 0x6E, 0xDE,
+    0x88, 0x38, 0x5F, 0x68, 0x2F, 0x96, 0xAA, 0xEF, 0xAE, 0x76, 0x0C, 0x7C, 0xEE, 0xDC, 0x06, 0x77,
+    0x61, 0xD9, 0x82, 0x79, 0xAF, 0x20, 0xFF, 0x5A, 0x08, 0x3A, 0x65, 0xB9, 0x74, 0x84, 0x16, 0x7A,
+    0x04, 0x32, 0x50, 0x83, 0x1F, 0x29, 0xE7, 0xBF, 0x60, 0x6D, 0x7A, 0x4F, 0x23, 0x79, 0x9A, 0xB5,
+    0x3F, 0x83, 0x36, 0xF1, 0x90, 0x8F, 0xEC, 0xC8, 0x0A, 0xA4, 0x3F, 0x6A, 0xE7, 0xA7, 0xAB, 0xDD,
+    0xC5, 0x17, 0xAE, 0x57, 0x7B, 0xE2, 0xDD, 0xB4, 0x01, 0xB9, 0xD1, 0x89, 0x31, 0x27, 0x77, 0xD2,
+    0x73, 0x58, 0x78, 0xA8, 0x41, 0x47, 0x66, 0xC1, 0x9E, 0x83, 0xD7, 0xF3, 0xF8, 0x56, 0xB2, 0x27,
+    0xD0, 0x1D, 0x00, 0xC3, 0x20, 0x84, 0xE5, 0x28, 0xCF, 0x59, 0xC9, 0x9D, 0xE4, 0xE8, 0xC9, 0xC0,
+    0xD6, 0x48, 0x25, 0x51, 0xB9, 0xED, 0x9A, 0x6A, 0x49, 0x99, 0xB8, 0x36, 0x0C, 0x23, 0xE2, 0x91,
+    0xC0, 0xCF, 0x10, 0x13, 0x93, 0xC6, 0x5F, 0x8D, 0xF2, 0x31, 0x37, 0x04, 0x3C, 0x1E, 0x05, 0xF4,
+    0x61, 0x7E, 0x75, 0xE3, 0x9E, 0xC4, 0x92, 0x4E, 0x9E, 0x88, 0xAB, 0x5C, 0x19, 0x4E, 0xFB, 0x7D,
+    0xDC, 0x32, 0x6C, 0xF7, 0x87, 0x2C, 0xF7, 0x96, 0x85, 0x78, 0x47, 0xD5, 0x6C, 0x1E, 0xA7, 0x8D,
+    0xEF, 0x5C, 0x0C, 0xB1, 0x83, 0x32, 0xB9, 0x8E, 0xB7, 0x85, 0xA8, 0xF9, 0xED, 0xF8, 0xBE, 0x37,
+    0xE8, 0xCE, 0xB9, 0x32, 0x8D, 0xFE, 0x83, 0x7B, 0x56, 0x28, 0xD1, 0xE5, 0xCE, 0xC8, 0x8D, 0x07,
+    0x1B, 0x69, 0x39, 0x19, 0xFC, 0xF6, 0xE2, 0xFF, 0x7C, 0x6D, 0x7C, 0xD5, 0x1E, 0x24, 0xF5, 0x3A,
+    0x7B, 0xEE, 0x2F, 0x14, 0x74, 0x35, 0x37, 0xE0, 0x56, 0x75, 0x30, 0x9D, 0x80, 0xA1, 0x16, 0x5A,
+    0x98, 0xF2, 0x84, 0x25, 0xDE, 0x9A, 0xD8, 0x9F, 0x23, 0x29, 0x95, 0xD6, 0x5C, 0x74, 0x77, 0x62,
+    0x06, 0xEB, 0xDE, 0xCD, 0xE1, 0xAE, 0x93, 0x75, 0xC8, 0x6D, 0x8B, 0x42, 0x7C, 0x03, 0x13, 0xEC,
+    0x51, 0x1C, 0xB4, 0xBF, 0xBA, 0x23, 0xAD, 0xB3, 0x66, 0x09, 0x70, 0xBA, 0x36, 0x53, 0xE3, 0xCA,
+    0x82, 0xF2, 0x80, 0xE3, 0x46, 0xDD, 0xFC, 0xC5, 0x52, 0xA5, 0x44, 0x69, 0x6D, 0x28, 0xD3, 0xD3,
+    0x66, 0x3C, 0x35, 0xD2, 0xC7, 0x94, 0x33, 0x24, 0xBD, 0x91, 0x8F, 0xBF, 0x50, 0xAA, 0xFC, 0x16,
+    0x19, 0x68, 0xD8, 0xC7, 0x0D, 0x01, 0xCB, 0xA5, 0x4C, 0xD3, 0x1E, 0xC9, 0x3E, 0x5F, 0x28, 0x41,
+    0xD7, 0x4B, 0x4E, 0x1C, 0x16, 0x18, 0x0F, 0x2E, 0x9C, 0xE9, 0x81, 0x30, 0x6F, 0x1D, 0x2C, 0xC9,
+    0x35, 0x0B, 0x0C, 0xAA, 0x2F, 0xFD, 0xE7, 0xF2, 0xB7, 0xDC, 0xFD, 0x0C, 0xC1, 0x00, 0x2C, 0x49,
+    0xA0, 0x0B, 0x17, 0x0C, 0xA6, 0xEA, 0x4A, 0xAF, 0x3C, 0x8F, 0x6E, 0xB5, 0x2A, 0x1B, 0x58, 0x55,
+    0xF6, 0x87, 0xE7, 0x55, 0xD9, 0x67, 0xEC, 0xF6, 0xBC, 0x06, 0xEB, 0x5D, 0x38, 0x37, 0xFA, 0x4C,
+    0xA4, 0xE6, 0xDC, 0x8E, 0x58, 0x32, 0xAF, 0x76, 0x3F, 0xE3, 0x01, 0x11, 0x3D, 0x2E, 0xE7, 0xD4,
+    0x0E, 0x33, 0xCA, 0xFC, 0x31, 0x96, 0xED, 0x4F, 0x6D, 0xB3, 0x49, 0x43, 0xBD, 0x5B, 0x58, 0x41,
+    0x53, 0xC1, 0xE9, 0x81, 0xDD, 0xEA, 0x2F, 0x3B, 0x6E, 0xF6, 0x55, 0x35, 0x2C, 0x45, 0xD6, 0xF0,
+    0xDC, 0x4F, 0x53, 0xD1, 0x8C, 0xB1, 0x64, 0xDA, 0x4E, 0x17, 0x40, 0xC3, 0x7B, 0xFA, 0x94, 0x9B,
+    0x07, 0x09, 0x8F, 0x7E, 0x65, 0xDC, 0x1F, 0x2C, 0x98, 0x00, 0x8E, 0xD4, 0xA1, 0xF5, 0x74, 0xDF,
+    0x58, 0x1F, 0x1B, 0x8C, 0x27, 0xDA, 0xFD, 0xCC, 0xFD, 0x3B, 0x88, 0xD8, 0xD1, 0x5D, 0xD6, 0x9F,
+    0xCE, 0x11, 0xE5, 0xA6, 0x8B, 0x82, 0x7A, 0xB8, 0x3E, 0xC3, 0xAB, 0xFB, 0x4B, 0x96, 0x8D, 0x83,
+    0x07, 0x4D, 0xC2, 0x9A, 0x26, 0xC3, 0x2B, 0x18, 0x29, 0x1E, 0x63, 0x1E, 0x15, 0x0E, 0xDC, 0x5D,
+    0x7B, 0x16, 0x18, 0x70, 0x97, 0x50, 0x4E, 0x5C, 0xEB, 0xB9, 0x16, 0xE6, 0xD0, 0xC3, 0xDF, 0x86,
+    0xA5, 0x5B, 0x1F, 0xEB, 0xB6, 0x3C, 0xFE, 0x97, 0x17, 0x2C, 0xDD, 0xEC, 0x36, 0x78, 0xA2, 0xE6,
+    0x84, 0xFB, 0x02, 0xE8, 0x47, 0x99, 0x57, 0x31, 0x14, 0xF3, 0xC6, 0x4A, 0x62, 0x42, 0xBA, 0x28,
+    0x38, 0x13, 0xE6, 0x5A, 0x7A, 0x2A, 0x65, 0x95, 0xF7, 0x2C, 0xBD, 0x0E, 0x5D, 0x69, 0xA7, 0x90,
+    0xDE, 0xD1, 0x3C, 0x90, 0x7F, 0x67, 0x15, 0x9A, 0x27, 0xA4, 0x2D, 0xA3, 0x89, 0x1E, 0xA2, 0x1A,
+    0xCB, 0xDA, 0x92, 0x8D, 0x2B, 0x5F, 0x0B, 0x55, 0x7B, 0x1A, 0x8C, 0xD7, 0x6F, 0x20, 0x14, 0x5E,
+    0x1E, 0x4A, 0x44, 0x6F, 0xF5, 0x2D, 0x29, 0xDA, 0x4D, 0xDB, 0xFB, 0x62, 0x09, 0xEA, 0x61, 0x61,
+    0xFD, 0x21, 0x62, 0x21, 0x87, 0x96, 0x65, 0x19, 0x76, 0x8F, 0x9D, 0xCC, 0x79, 0xB1, 0x04, 0xA9,
+    0xD6, 0xAB, 0xFA, 0x68, 0x71, 0x44, 0xAF, 0x9E, 0x70, 0x80, 0xF6, 0xC2, 0xA9, 0xE7, 0xE3, 0xC7,
+    0x8F, 0x5F, 0xE4, 0x17, 0x7A, 0x51, 0xE0, 0xDF, 0xB6, 0x68, 0x1D, 0x99, 0xEB, 0xCD, 0x08, 0xE9,
+    0x8B, 0xFB, 0x8C, 0x83, 0x8F, 0x6B, 0x8E, 0x10, 0xF5, 0xC0, 0x5E, 0x81, 0xA3, 0xF0, 0x33, 0x70,
+    0x14, 0x93, 0xA3, 0x6D, 0x72, 0x74, 0x48, 0x66, 0xE0, 0x02, 0x26, 0xBF, 0x05, 0x33, 0x41, 0x0D,
+    0x10, 0xE5, 0xE0, 0x28, 0x21, 0x47, 0x3B, 0xE4, 0x68, 0x49, 0x8E, 0xBA, 0x15, 0x47, 0xA1, 0x8A,
+    0xA9, 0x02, 0x47, 0xDB, 0xE4, 0xE8, 0x8F, 0xE4, 0xBC, 0xF0, 0x6C, 0x87, 0xA2, 0xEC, 0xAC, 0xBC,
+    0x9E, 0xF3, 0x9D, 0x8F, 0x09, 0xDA, 0x79, 0x82, 0x47, 0x4F, 0x44, 0x49, 0x36, 0xD1, 0xAE, 0xBD,
+    0x35, 0xD1, 0xB4, 0xCD, 0x7B, 0x3A, 0xCF, 0x0B, 0x56, 0xBA, 0xD9, 0x53, 0x68, 0x62, 0x9D, 0x35,
+    0x49, 0xA1, 0x27, 0xFA, 0x8B, 0xDF, 0x42, 0x2F, 0x3B, 0xD6, 0xC5, 0x2D, 0x14, 0x5D, 0xED, 0x02,
+    0x94, 0x5F, 0x6E, 0x17, 0xE0, 0x1B, 0x41, 0xF3, 0x66, 0x85, 0xBF, 0xB0, 0x0A, 0xFF, 0xC7, 0x7A,
+    0x8E, 0x30, 0x7D, 0x62, 0x85, 0xFF, 0x9B, 0x40, 0x73, 0xD0, 0x6E, 0xD6, 0xBA, 0x93, 0xA7, 0xD4,
+    0xBA, 0xBF, 0x19, 0x5A, 0x71, 0x7C, 0x5E, 0xD0, 0x30, 0x55, 0x36, 0xA3, 0x61, 0x7B, 0x5E, 0xDB,
+    0x4F, 0x22, 0x19, 0x71, 0x4F, 0x9D, 0xBA, 0x7A, 0xDF, 0x95, 0xD7, 0xE0, 0x32, 0x07, 0xFA, 0x51,
+    0x16, 0x09, 0x96, 0xFA, 0x3E, 0x13, 0x30, 0x3D, 0x65, 0xEA, 0x34, 0xB0, 0x2E, 0x72, 0x2D, 0xED,
+    0x94, 0x94, 0x49, 0x5A, 0x53, 0xC9, 0xE2, 0x86, 0xE5, 0x9D, 0xA8, 0xDB, 0xD6, 0x95, 0xBC, 0xD0,
+    0x02, 0xCC, 0xA1, 0x1E, 0x14, 0xD1, 0x23, 0x75, 0xA3, 0x8E, 0xAE, 0x47, 0xC5, 0x59, 0x8F, 0x5A,
+    0x97, 0x98, 0x12, 0x83, 0xF9, 0xF9, 0x2A, 0xDB, 0x3D, 0x2F, 0x39, 0x79, 0xCB, 0x73, 0xC2, 0xF7,
+    0xF5, 0x90, 0x8A, 0x3A, 0xD5, 0xF4, 0x9E, 0xAA, 0xBD, 0xBA, 0xB4, 0x62, 0xDA, 0x38, 0xD1, 0xF4,
+    0x45, 0x90, 0xA6, 0x6B, 0x8A, 0x19, 0x38, 0x4C, 0x05, 0x2B, 0x40, 0x53, 0xCF, 0xB3, 0xDC, 0x4E,
+    0x0F, 0x2D, 0xA1, 0x67, 0x3D, 0x04, 0x6F, 0xA9, 0x15, 0xE1, 0xA4, 0xB1, 0xDE, 0xA4, 0x94, 0x3E,
+    0x11, 0x66, 0xF5, 0x46, 0xFB, 0x9C, 0x5B, 0xBF, 0xD5, 0xAA, 0x37, 0xEB, 0x79, 0x2C, 0x18, 0x1B,
+    0x4E, 0x89, 0x6D, 0x98, 0xDE, 0xFC, 0x22, 0x0A, 0x3D, 0x9D, 0xAD, 0xD4, 0xDD, 0xD3, 0xB2, 0xD4,
+    0x60, 0x47, 0x93, 0xEC, 0xBF, 0x30, 0xD1, 0x69, 0xC7, 0xAD, 0x42, 0x3B, 0x8C, 0xFE, 0xD8, 0x92,
+    0x7E, 0x09, 0x67, 0xF0, 0xFF, 0x00, 0xDD, 0x5C, 0x3D, 0x8C, 0xDD, 0x56, 0x76, 0xBE, 0x24, 0x47,
+    0xC3, 0x5D, 0x3D, 0x64, 0xA9, 0xC2, 0x6A, 0x6C, 0xAC, 0xD9, 0xA4, 0x58, 0x58, 0xB2, 0xD8, 0xBA,
+    0x98, 0x19, 0x72, 0x37, 0x40, 0xDA, 0xA8, 0xD0, 0x64, 0x0B, 0x17, 0x49, 0x91, 0x00, 0x89, 0x82,
+    0x60, 0x1A, 0x17, 0x2A, 0x26, 0x43, 0x62, 0x03, 0xA4, 0x49, 0x91, 0x29, 0x02, 0xA7, 0x8C, 0x0A,
+    0x17, 0xD6, 0x34, 0x56, 0x00, 0x17, 0x2A, 0xA4, 0xE1, 0xF3, 0x6E, 0xB9, 0x45, 0xB8, 0x58, 0x2C,
+    0xB6, 0x48, 0xB1, 0x0C, 0x20, 0x03, 0xCE, 0x2E, 0x02, 0x33, 0x00, 0x8D, 0xBC, 0xF1, 0xF2, 0xF1,
+    0xE6, 0x7C, 0xDF, 0xB9, 0x7C, 0x3F, 0x33, 0xB2, 0x23, 0x69, 0xFE, 0xE7, 0x69, 0x78, 0xCE, 0xD3,
+    0x23, 0x79, 0x7F, 0xCE, 0x39, 0x3C, 0xF7, 0xFC, 0x5D, 0x1A, 0xB3, 0xB9, 0x79, 0xD7, 0x18, 0xE3,
+    0x59, 0x3B, 0x99, 0xA3, 0xC3, 0x1F, 0xFD, 0xCD, 0x9F, 0x12, 0x05, 0x3D, 0x51, 0x68, 0x89, 0x46,
+    0x65, 0x06, 0x14, 0xA5, 0x05, 0x50, 0x9C, 0x8C, 0x81, 0xD6, 0xE3, 0x0A, 0x68, 0x2D, 0x6A, 0x80,
+    0x9E, 0x8E, 0x88, 0xDA, 0x80, 0x3D, 0x34, 0x41, 0x87, 0xB6, 0x6A, 0xB6, 0x16, 0x54, 0x06, 0xAD,
+    0x85, 0x63, 0x83, 0xD6, 0xA2, 0xC2, 0xE4, 0xD2, 0x5A, 0x64, 0xAD, 0x95, 0x66, 0x12, 0x45, 0xEB,
+    0xD2, 0xAA, 0xB4, 0xB6, 0x2D, 0xBF, 0x4B, 0x33, 0x4F, 0xA4, 0x47, 0x41, 0xAD, 0xDC, 0x33, 0x91,
+    0xB6, 0xA4, 0x85, 0xCE, 0x04, 0x40, 0x53, 0x13, 0x02, 0x59, 0xF3, 0x49, 0x5F, 0x98, 0x4F, 0xEC,
+    0x73, 0xDC, 0x6B, 0x6D, 0xCB, 0xE9, 0x71, 0x56, 0x87, 0xA7, 0xE6, 0x6D, 0x0A, 0x28, 0x6D, 0x2D,
+    0xF3, 0x79, 0xBF, 0x33, 0x61, 0x6B, 0xA6, 0x68, 0xB9, 0x34, 0x41, 0x2D, 0xC0, 0xDC, 0x35, 0x39,
+    0x2E, 0x1A, 0xC0, 0xB5, 0x3D, 0x8B, 0x06, 0xAC, 0x19, 0x1D, 0xC8, 0x7F, 0xE3, 0x5A, 0x40, 0x3A,
+    0x06, 0x28, 0xE4, 0xE2, 0x01, 0x58, 0xF9, 0xCD, 0xB7, 0x72, 0x36, 0x4E, 0xB3, 0xC8, 0x76, 0xE9,
+    0x73, 0xDF, 0x36, 0xC9, 0xC4, 0xDC, 0x64, 0x77, 0xB5, 0xF9, 0x00, 0xA8, 0x31, 0xA4, 0xC5, 0xFE,
+    0xFB, 0x44, 0xA9, 0x25, 0x9D, 0x46, 0x96, 0x34, 0x34, 0x37, 0xAE, 0x0A, 0xD1, 0x1B, 0x4C, 0xB6,
+    0xC5, 0x0D, 0x3B, 0x3F, 0x6E, 0xDC, 0x34, 0x75, 0x92, 0x37, 0xCE, 0x89, 0xFC, 0x97, 0x99, 0x9A,
+    0xF8, 0x3C, 0xD0, 0x71, 0xD7, 0x44, 0x11, 0x47, 0x68, 0x62, 0x8E, 0xD7, 0x24, 0x0E, 0xB9, 0x1F,
+    0x3F, 0xCF, 0x54, 0xA4, 0x38, 0x7C, 0xCF, 0x16, 0x67, 0x49, 0xE9, 0x4F, 0x41, 0x88, 0x4A, 0xC9,
+    0x20, 0x23, 0xA2, 0x88, 0x13, 0x60, 0x4C, 0xC9, 0xE7, 0x05, 0x08, 0x23, 0xC3, 0xF4, 0x2D, 0x4E,
+    0xBF, 0x03, 0x90, 0x03, 0x80, 0x7E, 0xDE, 0x64, 0x98, 0xDF, 0x08, 0x17, 0xAF, 0xCC, 0xE4, 0xA4,
+    0x94, 0x8B, 0x63, 0x90, 0xA1, 0x2C, 0xC2, 0xA9, 0x50, 0xDC, 0xEB, 0x65, 0x0A, 0xA6, 0x07, 0x25,
+    0x9F, 0x25, 0xD2, 0xD7, 0x9F, 0xA7, 0x98, 0x38, 0x01, 0x1B, 0x23, 0x33, 0xED, 0x37, 0x01, 0x9E,
+    0x2D, 0xD9, 0xF3, 0xEC, 0x36, 0xB4, 0x62, 0x62, 0x30, 0x78, 0x24, 0x83, 0xF8, 0x03, 0x08, 0xC7,
+    0x86, 0xB1, 0xD5, 0x6A, 0x27, 0x82, 0x2B, 0xFD, 0xAE, 0x5A, 0x0C, 0xF7, 0x1A, 0xB4, 0xE4, 0x9B,
+    0x0F, 0xF5, 0x16, 0x50, 0x4B, 0x78, 0xEF, 0x37, 0xE4, 0xBB, 0xF1, 0xDC, 0x58, 0xAF, 0xDD, 0x03,
+    0xA1, 0x8B, 0xB0, 0xDF, 0x6A, 0xA3, 0x3A, 0xE8, 0x92, 0xB1, 0xDF, 0xA5, 0x99, 0x37, 0xC9, 0x8D,
+    0xB7, 0x5B, 0x62, 0x00, 0x6E, 0xAA, 0xC3, 0x61, 0xDD, 0x81, 0x73, 0x10, 0x1A, 0xA1, 0xEC, 0x8A,
+    0x8C, 0xE5, 0x76, 0x74, 0xE0, 0x75, 0x81, 0xB5, 0x8D, 0xC9, 0xC1, 0x3D, 0xF4, 0x7B, 0xFD, 0x21,
+    0x86, 0x09, 0x49, 0x48, 0x21, 0x79, 0xD3, 0x1D, 0xE9, 0xBB, 0x8D, 0x33, 0xE9, 0x5C, 0xBA, 0x97,
+    0xDE, 0xB3, 0x8B, 0x47, 0xAB, 0xD5, 0x8F, 0x84, 0xD9, 0x32, 0xD8, 0x44, 0xAE, 0x48, 0x85, 0xFF,
+    0xDD, 0x68, 0xEC, 0xD7, 0x5E, 0xE3, 0x0D, 0x2A, 0xE0, 0xD4, 0x68, 0xE5, 0x61, 0xD4, 0x7C, 0x6A,
+    0xE7, 0x60, 0x54, 0x1F, 0x59, 0xD2, 0x2E, 0x94, 0x5C, 0xC9, 0x11, 0xB4, 0x7A, 0x99, 0xE8, 0x04,
+    0x6A, 0x83, 0xC5, 0xCF, 0x69, 0xD1, 0xEA, 0xBA, 0xF1, 0x0B, 0x91, 0xA1, 0x28, 0x13, 0x69, 0xDA,
+    0xC1, 0xCD, 0x10, 0xAE, 0x1C, 0x62, 0x96, 0x80, 0x60, 0xD7, 0xB2, 0x8B, 0x47, 0x2B, 0x19, 0xF0,
+    0x43, 0xD1, 0xBF, 0x95, 0x79, 0x26, 0xDA, 0x2F, 0x95, 0x19, 0xC6, 0x53, 0xBD, 0x85, 0xBC, 0x3F,
+    0x6D, 0x5A, 0x49, 0x57, 0xE3, 0x18, 0xA3, 0x57, 0x7A, 0x39, 0x8A, 0xC9, 0x9D, 0xCA, 0xB0, 0x44,
+    0xC5, 0x6C, 0x46, 0x37, 0x9C, 0xB1, 0xF6, 0xBF, 0x14, 0x89, 0x02, 0x16, 0xC5, 0x67, 0xDE, 0x72,
+    0xBD, 0x62, 0x3E, 0x56, 0x6F, 0xB1, 0x2A, 0xA5, 0x82, 0xC2, 0x8E, 0x28, 0x50, 0x84, 0xE5, 0x45,
+    0x90, 0xD7, 0xCF, 0x86, 0xF9, 0x4A, 0xC8, 0x53, 0xE4, 0xF7, 0x8B, 0x6D, 0xBA, 0x1E, 0xA2, 0x76,
+    0xB1, 0xF7, 0x72, 0x8C, 0x91, 0x61, 0x35, 0xDC, 0xB2, 0x5C, 0x70, 0x4A, 0x6B, 0x7B, 0x4E, 0x62,
+    0x75, 0x2F, 0xFB, 0x2B, 0x2A, 0x6D, 0xCC, 0xB3, 0x1C, 0x43, 0x47, 0x27, 0x9F, 0x61, 0xB2, 0xC9,
+    0x4F, 0x31, 0xD7, 0xE4, 0x67, 0xE4, 0xDD, 0x67, 0xC3, 0xFA, 0x73, 0xED, 0xAE, 0x40, 0xCF, 0x4E,
+    0x05, 0x86, 0xD6, 0xFE, 0xD9, 0xD8, 0xC4, 0x6D, 0xF8, 0xE5, 0x18, 0x1C, 0x16, 0xB5, 0x2F, 0xA4,
+    0xCD, 0xB1, 0x94, 0xE0, 0xBF, 0x25, 0xA1, 0xE5, 0x5D, 0x0A, 0xFB, 0x23, 0x50, 0x7F, 0xD7, 0x2B,
+    0xF5, 0x2E, 0x6D, 0x41, 0x5B, 0x8B, 0xDA, 0xF0, 0x37, 0x15, 0x7A, 0x89, 0x7A, 0xE9, 0xB1, 0x8B,
+    0x44, 0xB2, 0x48, 0xF7, 0xD3, 0x20, 0x78, 0x09, 0x41, 0x98, 0xA1, 0xD3, 0x26, 0xB8, 0x71, 0xAB,
+    0x24, 0x2F, 0x9B, 0x2D, 0xEC, 0x80, 0x22, 0x90, 0x32, 0x4D, 0x9F, 0x70, 0xF1, 0xF7, 0x37, 0x1F,
+    0x26, 0x68, 0xB0, 0x8F, 0x85, 0x2C, 0xB6, 0xFC, 0x57, 0x21, 0x7B, 0xED, 0x5B, 0x12, 0x4A, 0x5A,
+    0x10, 0xA9, 0xCE, 0x17, 0x08, 0x9E, 0xBE, 0x1C, 0xC1, 0xCB, 0x23, 0x04, 0x8F, 0xBF, 0x81, 0xE0,
+    0xE6, 0xDA, 0x26, 0x0C, 0x8C, 0x84, 0x83, 0x8A, 0xAD, 0xCD, 0x96, 0x54, 0x17, 0xF8, 0x30, 0x75,
+    0x50, 0xA6, 0xEC, 0x29, 0x85, 0xD7, 0x17, 0xE0, 0xBB, 0x84, 0xDF, 0x57, 0x42, 0x7E, 0x0B, 0xA4,
+    0x25, 0x65, 0xAD, 0x63, 0xA3, 0x79, 0x09, 0xE8, 0x67, 0x64, 0x00, 0xEC, 0x15, 0x33, 0x22, 0x8C,
+    0x0A, 0xF0, 0x28, 0x29, 0x40, 0x75, 0x5B, 0x94, 0x84, 0xDE, 0xE6, 0x66, 0x06, 0xCA, 0xD6, 0x0A,
+    0x16, 0xD5, 0xEE, 0x5D, 0x1A, 0x4E, 0x72, 0xB6, 0xFF, 0xA4, 0x31, 0xA2, 0x4D, 0x26, 0x42, 0x1F,
+    0xAF, 0x83, 0x35, 0xD3, 0x43, 0x22, 0x2D, 0xA8, 0x54, 0x92, 0x9F, 0x18, 0x98, 0x75, 0x60, 0x36,
+    0x06, 0x82, 0xD2, 0x38, 0xCD, 0x02, 0x32, 0xAE, 0xC0, 0xA2, 0xFA, 0xBE, 0xD8, 0x56, 0xD2, 0x8A,
+    0x4F, 0xC6, 0x43, 0xBD, 0x18, 0x4F, 0x74, 0x96, 0xFC, 0x1C, 0x41, 0x05, 0xCA, 0x3F, 0x19, 0xE7,
+    0xAF, 0x9E, 0xD1, 0x3C, 0xED, 0x68, 0xC2, 0x71, 0x50, 0x2B, 0x97, 0x88, 0xA4, 0xFE, 0x58, 0xDC,
+    0x1D, 0x31, 0x8F, 0x2B, 0xE3, 0x1D, 0x88, 0x12, 0x80, 0x3E, 0x96, 0x4B, 0x68, 0x7A, 0x67, 0xE7,
+    0x43, 0x5C, 0x73, 0x8D, 0x9D, 0x72, 0xA9, 0x59, 0x82, 0xCE, 0x86, 0x3E, 0xF4, 0xB9, 0xF8, 0x24,
+    0x56, 0x33, 0x87, 0x5E, 0x09, 0x54, 0x8B, 0x82, 0xB0, 0x39, 0x3A, 0x95, 0x33, 0xA5, 0xF3, 0x25,
+    0xA0, 0x9B, 0x5C, 0x48, 0xCF, 0x28, 0xE6, 0x7D, 0xEB, 0x84, 0xDD, 0x02, 0x54, 0x07, 0xD1, 0x7E,
+    0xA8, 0xEE, 0x39, 0x5D, 0xA9, 0xFE, 0x2C, 0xA9, 0xF8, 0x8C, 0x7E, 0xA6, 0x71, 0x46, 0x60, 0x58,
+    0x0F, 0x6C, 0x0D, 0xF8, 0x1B, 0x43, 0x18, 0x04, 0xD0, 0xBD, 0x3F, 0x10, 0xAB, 0x44, 0x66, 0x92,
+    0x6D, 0x60, 0x94, 0xBF, 0xC0, 0xF8, 0x83, 0xDF, 0x53, 0x04, 0xD4, 0xF9, 0xD3, 0xE5, 0xE3, 0xE6,
+    0x65, 0x52, 0x1C, 0x62, 0xDD, 0x89, 0x57, 0x05, 0x17, 0xB2, 0x4B, 0x60, 0x8D, 0x81, 0x64, 0x71,
+    0x37, 0xC8, 0xF7, 0x60, 0xE3, 0x9D, 0xB9, 0xF6, 0xF0, 0x3F, 0xD6, 0x40, 0x81, 0x8A, 0x48, 0xAC,
+    0xB3, 0x4A, 0xD5, 0xF1, 0xEE, 0x46, 0x15, 0x83, 0x01, 0x5E, 0xA3, 0xFA, 0xED, 0xC6, 0x92, 0x1E,
+    0x79, 0x4E, 0x5F, 0xDC, 0xE2, 0x8E, 0xBC, 0xF2, 0x84, 0x6C, 0x30, 0x2E, 0xD2, 0xCA, 0x20, 0x90,
+    0x10, 0x57, 0x34, 0x43, 0xC4, 0x9B, 0x47, 0x74, 0xE0, 0xBB, 0x83, 0x4A, 0x1A, 0x50, 0xAE, 0xAA,
+    0x49, 0x83, 0x13, 0x03, 0xB2, 0x87, 0x11, 0x56, 0x5F, 0x41, 0xD2, 0x07, 0x2E, 0xF1, 0xCA, 0x96,
+    0xF7, 0x89, 0x9D, 0x01, 0xDB, 0x5A, 0xDA, 0x4D, 0x15, 0xC1, 0xBE, 0x76, 0xFD, 0x09, 0x1A, 0x69,
+    0xEF, 0xB0, 0x54, 0xD0, 0x75, 0xE9, 0xCE, 0x2B, 0x5F, 0xC5, 0xFD, 0x3F, 0xA0, 0xD5, 0xCF, 0xA9,
+    0x9B, 0x3D, 0x43, 0x33, 0x0A, 0xCB, 0x91, 0x9C, 0x8C, 0x7E, 0x2E, 0x12, 0x99, 0xFA, 0x2D, 0xC2,
+    0x18, 0xDB, 0xF0, 0xE5, 0x56, 0x5C, 0xE4, 0xCA, 0xDB, 0x14, 0xEB, 0x29, 0xB1, 0x5F, 0xF6, 0xA6,
+    0xFC, 0x71, 0xBF, 0xE3, 0x77, 0x66, 0xFA, 0x1D, 0x11, 0xD9, 0x12, 0xC2, 0x9B, 0x03, 0xA4, 0xD9,
+    0x1C, 0xC8, 0x89, 0x1C, 0x14, 0xD8, 0x17, 0x03, 0x5A, 0xAE, 0x94, 0xE7, 0x4C, 0x86, 0x75, 0x67,
+    0x5F, 0xE6, 0xF4, 0x29, 0xC3, 0x2B, 0x46, 0x5D, 0x6B, 0xA1, 0xD5, 0xDE, 0x47, 0x4E, 0xCE, 0xC4,
+    0x0B, 0x10, 0x9B, 0x66, 0xCF, 0x36, 0x91, 0xD8, 0x20, 0xAD, 0xC8, 0x86, 0x3F, 0x49, 0x11, 0x34,
+    0x48, 0x61, 0x8B, 0xA7, 0x78, 0x5A, 0x84, 0xF5, 0x61, 0x1D, 0xD5, 0x66, 0x6B, 0x2C, 0x36, 0x4A,
+    0x0F, 0xCB, 0x6A, 0x57, 0x2E, 0xA8, 0xCC, 0x63, 0x36, 0xA9, 0xDC, 0x99, 0xBE, 0x5F, 0x2B, 0x5B,
+    0x54, 0xF7, 0x6B, 0x14, 0xC8, 0x64, 0xE6, 0x6A, 0xB1, 0xEC, 0xB1, 0x79, 0x0F, 0x01, 0xA3, 0x27,
+    0x32, 0xAC, 0x3F, 0x6D, 0x61, 0x99, 0xD5, 0x60, 0x5E, 0x31, 0x8F, 0xBE, 0x5D, 0x54, 0x6E, 0xD1,
+    0x11, 0x46, 0x73, 0xFA, 0x9C, 0x05, 0x4B, 0xC8, 0x7B, 0x51, 0x60, 0xFA, 0x0A, 0x3D, 0x67, 0x6F,
+    0x0C, 0xAB, 0x8F, 0xCF, 0x70, 0x58, 0x3F, 0x5F, 0x92, 0x16, 0x3E, 0x17, 0x97, 0x73, 0x57, 0x87,
+    0x11, 0xEE, 0xE3, 0x74, 0x7E, 0xA0, 0xF1, 0x57, 0x67, 0x5A, 0x31, 0xB8, 0x89, 0x28, 0x80, 0xC6,
+    0x61, 0xF5, 0x4A, 0x67, 0x9A, 0xFB, 0xF4, 0xDC, 0x32, 0xAE, 0xC8, 0x43, 0xE0, 0x93, 0x61, 0x55,
+    0xB2, 0xF2, 0xDE, 0x45, 0x67, 0xE0, 0x9E, 0x4E, 0x42, 0x09, 0x1D, 0xA8, 0x86, 0x8C, 0xFE, 0x83,
+    0xFA, 0x32, 0xF1, 0x48, 0x84, 0x6D, 0x68, 0xFC, 0xB9, 0xCE, 0x57, 0x7E, 0xC3, 0xA0, 0xE8, 0x14,
+    0x4D, 0x7D, 0x7A, 0xA7, 0xD9, 0x6B, 0x45, 0x2B, 0x16, 0x11, 0x17, 0xEB, 0x19, 0x3A, 0x66, 0x63,
+    0x44, 0x3A, 0x32, 0x99, 0xEA, 0x17, 0x38, 0x4A, 0x19, 0x2E, 0x0E, 0xF3, 0x26, 0x67, 0x9E, 0x92,
+    0xB7, 0x39, 0xF5, 0x4B, 0xC7, 0x90, 0x7E, 0x83, 0xD0, 0xF5, 0xA8, 0x40, 0x6C, 0x77, 0x05, 0xEB,
+    0xC3, 0x3B, 0x8F, 0x78, 0x05, 0x19, 0x19, 0xEA, 0xAA, 0xF1, 0xFF, 0x40, 0xCA, 0x52, 0x1F, 0x83,
+    0x8C, 0x7D, 0x0E, 0x6B, 0xA2, 0xAF, 0x61, 0x3D, 0xD8, 0xB1, 0x8B, 0x31, 0xF4, 0x03, 0xEC, 0x97,
+    0xFF, 0xFB, 0xEA, 0x50, 0xA3, 0x0E, 0x89, 0x3C, 0x78, 0xF6, 0xB9, 0xB0, 0xC2, 0x0C, 0xDC, 0x78,
+    0x19, 0xA6, 0xDC, 0xB7, 0x7B, 0x7B, 0x7B, 0xF6, 0x63, 0x1A, 0x5F, 0x76, 0x7A, 0xD3, 0x6E, 0x6E,
+    0x6E, 0xDA, 0x7B, 0xE7, 0xCB, 0x94, 0x6F, 0x27, 0x75, 0x8E, 0x10, 0x8C, 0x83, 0xCB, 0x04, 0xF7,
+    0x71, 0x5F, 0x9F, 0xC0, 0xF2, 0xED, 0xF7, 0x4B, 0x44, 0x5B, 0x6A, 0x86, 0x5E, 0x0A, 0xEF, 0xE4,
+    0x08, 0x7E, 0x94, 0xD4, 0xDE, 0x2E, 0x22, 0x90, 0x5E, 0x95, 0xDA, 0xBF, 0x1F, 0x7F, 0x9A, 0xD8,
+    0xE2, 0x31, 0x53, 0x4A, 0x37, 0x9C, 0x99, 0x68, 0x33, 0xC6, 0x43, 0x44, 0xDB, 0x50, 0x2B, 0x9D,
+    0xF4, 0x21, 0xED, 0xBE, 0x65, 0xBF, 0x66, 0xE4, 0x05, 0xE3, 0x48, 0x64, 0x1C, 0xB9, 0x1B, 0x47,
+    0x43, 0xD2, 0xCD, 0x4D, 0x51, 0x04, 0x94, 0x56, 0xAD, 0xBB, 0x2F, 0x79, 0xCD, 0x43, 0xB4, 0xF8,
+    0x75, 0xDB, 0x67, 0x91, 0xA8, 0x99, 0x9B, 0x9B, 0xF7, 0x84, 0x57, 0x7C, 0x86, 0x9C, 0x1A, 0x70,
+    0x92, 0x66, 0xCD, 0x71, 0xFE, 0xA4, 0x05, 0x95, 0x84, 0xCD, 0xCD, 0x7B, 0xD6, 0x76, 0xD6, 0xCE,
+    0x17, 0x40, 0xF1, 0xC5, 0xDE, 0xD2, 0xCB, 0xCA, 0x97, 0xFE, 0xB3, 0xD9, 0x2D, 0x7B, 0x90, 0xDA,
+    0xFE, 0x03, 0x73, 0x7B, 0xCD, 0x6C, 0xA7, 0x1F, 0x4E, 0x62, 0xDB, 0xC0, 0x10, 0xBA, 0x71, 0x2A,
+    0x63, 0xFE, 0xC0, 0xAC, 0x89, 0x86, 0x14, 0x93, 0x6B, 0xB1, 0x97, 0x63, 0x8E, 0xFC, 0xC4, 0x07,
+    0x69, 0xEE, 0xC0, 0xBB, 0x0C, 0x6A, 0x23, 0x5E, 0x8B, 0xAC, 0x10, 0xB2, 0x0C, 0x8C, 0x0E, 0xEE,
+    0x06, 0xF2, 0x38, 0x95, 0x35, 0x2C, 0x90, 0xD9, 0x2D, 0xFB, 0x4B, 0x66, 0xC7, 0x71, 0xA6, 0x00,
+    0x4F, 0x7B, 0x82, 0x65, 0x4A, 0x3A, 0x15, 0x77, 0x56, 0xD6, 0xB5, 0x60, 0x7A, 0xCF, 0x17, 0x1F,
+    0x76, 0xEB, 0x39, 0x7A, 0xEC, 0x87, 0xB0, 0xE9, 0xB3, 0x45, 0x2B, 0xE2, 0xA4, 0x67, 0x7D, 0x6C,
+    0x2E, 0xC8, 0x43, 0x66, 0x1C, 0xE2, 0xB8, 0xC6, 0x6C, 0x2A, 0x2F, 0x2E, 0x14, 0xC2, 0xC8, 0x04,
+    0x41, 0xA1, 0x0A, 0xC2, 0xBC, 0x9D, 0x49, 0x95, 0x67, 0x2F, 0x40, 0xA5, 0x59, 0x70, 0xD1, 0x3D,
+    0x7D, 0x92, 0xC3, 0x89, 0x1A, 0x01, 0x5C, 0xF6, 0x69, 0x88, 0x82, 0x47, 0x6F, 0xA8, 0x06, 0xA4,
+    0x02, 0xB4, 0x30, 0xE8, 0xF6, 0x87, 0x38, 0xC9, 0xA1, 0x8F, 0x10, 0x39, 0xED, 0x85, 0xCC, 0xB7,
+    0x7A, 0xBD, 0xAE, 0xC4, 0x6D, 0xC7, 0x06, 0x32, 0xAB, 0x5E, 0x18, 0x61, 0x7A, 0x48, 0x53, 0x3F,
+    0xD3, 0xF9, 0xFD, 0x2C, 0x5C, 0x03, 0xE0, 0x31, 0xFC, 0x31, 0x71, 0x41, 0x31, 0x8F, 0x76, 0xDD,
+    0x81, 0x66, 0x4E, 0x91, 0x38, 0xCD, 0xE5, 0xF4, 0x74, 0x5F, 0xC4, 0x30, 0xCE, 0x90, 0x34, 0x1D,
+    0x72, 0xA6, 0x62, 0x01, 0x55, 0x38, 0x78, 0x0D, 0x6D, 0xD3, 0xD3, 0x3E, 0x6A, 0x3D, 0x60, 0x85,
+    0x52, 0xA7, 0x16, 0x94, 0x7F, 0x18, 0x1F, 0xE4, 0xD5, 0x1E, 0x52, 0xF6, 0x62, 0x7D, 0x8D, 0x7E,
+    0xDD, 0xC4, 0x3F, 0x9C, 0xAC, 0x99, 0xF5, 0x99, 0xB5, 0x15, 0xD9, 0x62, 0x55, 0xB4, 0x8A, 0x5C,
+    0x95, 0xBE, 0xF6, 0x5F, 0x86, 0xBF, 0x1C, 0xA4, 0x13, 0x6B, 0x32, 0x6F, 0xCC, 0x4E, 0x46, 0x0B,
+    0x4E, 0x65, 0xDB, 0x38, 0xD9, 0x8E, 0x35, 0x35, 0x92, 0xA8, 0x58, 0x6D, 0xA8, 0x88, 0x74, 0xBA,
+    0x62, 0x37, 0x44, 0x34, 0x7F, 0xAD, 0x86, 0xD0, 0xAC, 0xF9, 0x3B, 0x22, 0x35, 0x11, 0xAD, 0xA6,
+    0x2E, 0x6D, 0xA4, 0xFF, 0x63, 0xB6, 0xDA, 0xD8, 0x52, 0x63, 0x2E, 0xFF, 0x43, 0x1F, 0xD4, 0x8E,
+    0xB1, 0x1E, 0xA2, 0x86, 0x40, 0x1B, 0x8B, 0x18, 0xD2, 0x32, 0xE1, 0x94, 0x28, 0x18, 0x2C, 0x04,
+    0xF7, 0x80, 0x69, 0xBE, 0x44, 0xB8, 0xE3, 0xC9, 0xC8, 0xA2, 0x29, 0x65, 0x3B, 0xB0, 0x15, 0x9F,
+    0xE9, 0xAD, 0x23, 0x59, 0xDD, 0xC1, 0x66, 0x57, 0x57, 0xD1, 0xA5, 0x51, 0x43, 0xBD, 0x2C, 0x54,
+    0x9B, 0x7D, 0xA4, 0xC2, 0xCF, 0x94, 0xFD, 0xAB, 0x9B, 0x75, 0x0E, 0x22, 0xA0, 0xDD, 0x9B, 0xAD,
+    0x1E, 0xD1, 0x26, 0x70, 0xB5, 0x67, 0x1C, 0xB9, 0x27, 0xB1, 0x7A, 0xD2, 0xAA, 0x27, 0xA9, 0x7A,
+    0x52, 0xAA, 0x67, 0xA6, 0x66, 0xCA, 0x24, 0xA1, 0xD6, 0x73, 0xD8, 0x9F, 0xF1, 0x1A, 0x4F, 0xB3,
+    0x91, 0xF0, 0x74, 0x7A, 0xAE, 0xCC, 0x3D, 0x89, 0xDF, 0x83, 0x26, 0x72, 0x2E, 0xE8, 0x61, 0x6B,
+    0x78, 0xB6, 0x86, 0xAD, 0x91, 0x1C, 0x8A, 0xED, 0xB2, 0x24, 0x00, 0x2A, 0x1C, 0x96, 0x86, 0x86,
+    0x33, 0x38, 0x33, 0x16, 0x5D, 0x98, 0xB5, 0x43, 0xF5, 0x44, 0x39, 0xC7, 0x7C, 0x8B, 0x63, 0xF6,
+    0xCE, 0x72, 0xCC, 0xDE, 0xDE, 0xDC, 0x85, 0x0F, 0xDB, 0xF9, 0x90, 0x5F, 0x3C, 0x4C, 0x8A, 0xE1,
+    0x00, 0x9D, 0x2B, 0xF2, 0x92, 0x01, 0xC6, 0xE3, 0xC0, 0x60, 0x7C, 0x38, 0x38, 0x39, 0x84, 0x28,
+    0x11, 0xF8, 0x4A, 0x97, 0x03, 0xC8, 0x22, 0x63, 0xA2, 0x25, 0xE5, 0x19, 0x96, 0x07, 0x64, 0x83,
+    0xA1, 0xDA, 0xCC, 0xDC, 0x7F, 0x64, 0xCA, 0x9E, 0x22, 0x74, 0x12, 0x7F, 0x9E, 0x55, 0x7B, 0xB8,
+    0xBB, 0x04, 0xD4, 0x58, 0xFA, 0xBC, 0x59, 0x2C, 0xE4, 0x2B, 0xB3, 0x59, 0xF5, 0x8F, 0x8B, 0xB2,
+    0x3F, 0x98, 0x31, 0xFB, 0x94, 0xC8, 0xE5, 0x46, 0xB1, 0x87, 0x05, 0x01, 0x51, 0xDC, 0xD6, 0xF8,
+    0x35, 0x66, 0xE3, 0x29, 0x0D, 0x3B, 0x40, 0x46, 0x77, 0x33, 0xAF, 0x1D, 0xB4, 0x99, 0xC5, 0x05,
+    0x80, 0xC5, 0x39, 0x53, 0xF2, 0xFE, 0x23, 0xFF, 0x61, 0xD9, 0x87, 0x75, 0xD8, 0x8B, 0x65, 0xD6,
+    0x47, 0xA2, 0x5F, 0x22, 0x99, 0xDC, 0xF7, 0xE4, 0x58, 0x59, 0xAE, 0x58, 0x38, 0xE6, 0xE1, 0x31,
+    0xE9, 0xFC, 0x85, 0x01, 0xBD, 0x8E, 0x2B, 0x5F, 0x77, 0x49, 0x45, 0x26, 0xB8, 0x83, 0xE9, 0x1C,
+    0x7A, 0xDD, 0x09, 0x52, 0xC5, 0x40, 0x54, 0x54, 0x3B, 0xBF, 0xDA, 0x71, 0xD7, 0xF4, 0xB2, 0x0E,
+    0xF4, 0xE2, 0x04, 0xF2, 0x08, 0xDA, 0x53, 0xA7, 0x0A, 0x34, 0xB2, 0x65, 0xA9, 0x91, 0xA5, 0x89,
+    0xA5, 0xF5, 0xA6, 0x8C, 0xA4, 0x50, 0x6B, 0xBA, 0xC4, 0xC1, 0x0E, 0xE1, 0xE3, 0xE3, 0x50, 0xE5,
+    0x63, 0x71, 0x3D, 0x51, 0x59, 0x20, 0xB4, 0xF7, 0xBE, 0xF1, 0x6F, 0xC5, 0xEB, 0x1E, 0x78, 0x76,
+    0xE2, 0xD9, 0xCA, 0x9F, 0x22, 0x89, 0x22, 0x26, 0xD0, 0xBF, 0xBD, 0xE8, 0x4A, 0x51, 0xD9, 0x2C,
+    0x36, 0x9C, 0xCC, 0x17, 0x50, 0x35, 0x03, 0x69, 0xA8, 0xCC, 0x0B, 0x0C, 0x37, 0xF4, 0xF1, 0x6A,
+    0x8F, 0x04, 0xCD, 0xF3, 0x29, 0x82, 0xCC, 0x6D, 0x6E, 0x89, 0x7C, 0xC6, 0x3C, 0x34, 0x07, 0xB5,
+    0x2D, 0xA8, 0x51, 0x34, 0x21, 0xFA, 0xDF, 0x29, 0xD1, 0x57, 0x96, 0xA8, 0x2D, 0x0B, 0x22, 0x71,
+    0x2C, 0x81, 0x64, 0x1D, 0x01, 0x92, 0x85, 0x04, 0x48, 0xD6, 0x0C, 0x20, 0xA1, 0x1C, 0x90, 0x38,
+    0xF2, 0x44, 0xE9, 0x98, 0x28, 0x6E, 0x88, 0xA2, 0x96, 0x28, 0xE8, 0x88, 0x7C, 0x4B, 0x64, 0xEC,
+    0x53, 0x22, 0x18, 0x1F, 0x08, 0x7F, 0x2B, 0x8A, 0x84, 0x5A, 0x13, 0x96, 0x63, 0x20, 0xDE, 0x25,
+    0x84, 0x2B, 0x31, 0x32, 0xEA, 0x8C, 0xFB, 0x73, 0x1E, 0xD3, 0x8A, 0x74, 0x86, 0x83, 0x06, 0xF9,
+    0x62, 0xB3, 0x9C, 0x7D, 0xD7, 0x30, 0xA1, 0x6D, 0x53, 0x51, 0x7E, 0x5B, 0x13, 0x96, 0x0D, 0x7C,
+    0x5D, 0xC5, 0xE8, 0x1C, 0x66, 0x87, 0x4F, 0xCB, 0x4A, 0xE8, 0xED, 0x0F, 0xCC, 0x39, 0x0E, 0x0C,
+    0x50, 0x69, 0x25, 0xCC, 0xA9, 0x65, 0x3D, 0xB5, 0xB6, 0xF1, 0x6C, 0x73, 0xD9, 0x49, 0xBD, 0xFC,
+    0xB9, 0x6F, 0x16, 0xAC, 0xAA, 0xE1, 0x02, 0x15, 0x3D, 0xCD, 0xD7, 0xB8, 0x5C, 0xED, 0x20, 0x6D,
+    0xE7, 0x49, 0xF9, 0x43, 0xD6, 0xD7, 0xEE, 0xDC, 0xEE, 0xD2, 0xC7, 0x23, 0x59, 0x78, 0x46, 0x16,
+    0xCD, 0x9A, 0x3F, 0x44, 0x9C, 0x1B, 0x27, 0x18, 0x3B, 0x8D, 0x7E, 0xCA, 0xC7, 0x27, 0xFC, 0xBD,
+    0x3A, 0x58, 0x1A, 0x65, 0x1D, 0x82, 0xDB, 0x37, 0xAF, 0xCA, 0x23, 0xA5, 0xB5, 0x72, 0x5A, 0x2A,
+    0x17, 0x34, 0x3B, 0xF3, 0x42, 0x39, 0xAD, 0x93, 0x4B, 0xEB, 0xC3, 0x55, 0x72, 0xE7, 0xC9, 0xD8,
+    0xEB, 0x6E, 0x1C, 0xA9, 0xF3, 0x26, 0xD2, 0x66, 0x19, 0x8F, 0x1C, 0xF6, 0x07, 0x2C, 0xD7, 0xDD,
+    0xC4, 0xC4, 0x7E, 0x6E, 0x7F, 0x04, 0x16, 0xC4, 0x7F, 0x6C, 0xFF, 0x09, 0x61, 0xF4, 0xCE, 0xA4,
+    0xFF, 0x0D, 0x27, 0x65, 0x17, 0x66, 0xAF, 0xD6, 0x34, 0xD6, 0x6A, 0x0B, 0x25, 0x95, 0x4A, 0x8A,
+    0xFC, 0xE7, 0xC4, 0x31, 0x9E, 0x0F, 0xE1, 0x75, 0x2C, 0x83, 0xBA, 0x8E, 0x58, 0x4B, 0xCF, 0xDA,
+    0x73, 0xAC, 0x34, 0x2F, 0x25, 0x42, 0xDD, 0x0B, 0x45, 0x68, 0xFC, 0x02, 0x11, 0x1A, 0xA9, 0xEC,
+    0x08, 0xFD, 0x16, 0x45, 0xA8, 0x54, 0xD9, 0x49, 0xAB, 0x45, 0x11, 0x1A, 0xA9, 0xEC, 0x04, 0x53,
+    0x22, 0xCF, 0x89, 0x50, 0xD9, 0x2D, 0x8A, 0x50, 0xAC, 0x68, 0xA4, 0x22, 0x14, 0xA8, 0x08, 0x79,
+    0x4E, 0x84, 0x9E, 0x2A, 0xA5, 0xB7, 0x5F, 0x84, 0xDC, 0xB9, 0x27, 0x8B, 0x8B, 0x91, 0x73, 0xF4,
+    0x72, 0x55, 0x16, 0xFB, 0x4E, 0xA2, 0x28, 0x50, 0x94, 0x27, 0x8A, 0x13, 0xA5, 0x89, 0xC2, 0x44,
+    0x59, 0xA2, 0x38, 0xBC, 0x3A, 0x80, 0xFC, 0x74, 0x10, 0x9F, 0x0E, 0xD2, 0xD3, 0x0D, 0x4B, 0xC6,
+    0x1C, 0xF8, 0xB3, 0x38, 0x04, 0x33, 0x47, 0x58, 0x42, 0x67, 0xC1, 0x08, 0x96, 0x9A, 0x21, 0x73,
+    0x55, 0x0D, 0x70, 0xC9, 0x79, 0x65, 0x09, 0x60, 0x42, 0x6F, 0xCB, 0x16, 0x32, 0x52, 0x78, 0x4D,
+    0x79, 0x31, 0x02, 0xB5, 0x2A, 0xC6, 0x0D, 0x1A, 0x24, 0xAD, 0xC2, 0x16, 0xC2, 0x15, 0x74, 0x08,
+    0x17, 0x04, 0x1D, 0xCA, 0x68, 0xFD, 0x29, 0xBC, 0x31, 0x7F, 0x0A, 0x35, 0xE2, 0xF7, 0x80, 0xDE,
+    0x11, 0xE8, 0xF7, 0x7A, 0x8D, 0x5E, 0xAF, 0xF7, 0x6A, 0x3B, 0x10, 0xD1, 0xB0, 0x8D, 0xD9, 0xFE,
+    0x88, 0xD9, 0x32, 0xF4, 0x8B, 0x2A, 0xFF, 0x8C, 0xA9, 0xBB, 0xBE, 0x94, 0xC9, 0x68, 0xFD, 0xAD,
+    0x96, 0x5D, 0x60, 0x47, 0x8D, 0x8F, 0x08, 0xBC, 0x6F, 0x97, 0xD5, 0x22, 0x73, 0x1E, 0xA5, 0x4C,
+    0x2B, 0xE8, 0x3F, 0x81, 0x87, 0x24, 0xB7, 0x27, 0xDC, 0x3B, 0x90, 0x49, 0x73, 0x39, 0xE4, 0x15,
+    0xF5, 0xBA, 0x15, 0x8C, 0x9A, 0x0A, 0x72, 0x5A, 0xCF, 0x81, 0x1D, 0x40, 0xC5, 0x4B, 0x78, 0x31,
+    0x63, 0x16, 0x6C, 0x20, 0x6A, 0xA4, 0x29, 0x36, 0x2A, 0x66, 0xD9, 0xAE, 0xEB, 0x28, 0xCC, 0x7C,
+    0x8C, 0x7F, 0x0C, 0xFB, 0x3D, 0x38, 0xD8, 0x2A, 0x98, 0xC7, 0xA3, 0x18, 0x50, 0xD5, 0x78, 0xD9,
+    0x65, 0x23, 0x2C, 0x6B, 0x15, 0xB4, 0x52, 0x81, 0x75, 0x0A, 0xAC, 0x52, 0xD0, 0x1A, 0x85, 0xEC,
+    0x7C, 0x48, 0x6C, 0xDE, 0x29, 0xE0, 0xBE, 0xE7, 0x3F, 0x61, 0x6C, 0x06, 0x42, 0xED, 0x75, 0xB0,
+    0x6F, 0x83, 0x26, 0xA6, 0x7E, 0xDF, 0x60, 0x20, 0xE5, 0x8D, 0x4B, 0x27, 0xC1, 0xD7, 0x1F, 0xBE,
+    0x53, 0x88, 0xCA, 0x94, 0xF6, 0xD2, 0xB1, 0x5C, 0x90, 0x43, 0x05, 0x75, 0x61, 0x2D, 0x2A, 0x3E,
+    0x42, 0x61, 0xDD, 0xCA, 0x39, 0x51, 0x7B, 0x4E, 0x46, 0x7C, 0x26, 0xBA, 0x7D, 0x88, 0x39, 0x10,
+    0x21, 0x26, 0xD7, 0x3F, 0x99, 0x17, 0x02, 0xB5, 0x4F, 0x8D, 0x90, 0x14, 0x5F, 0xD6, 0xA0, 0x5F,
+    0xF4, 0x8B, 0x10, 0x16, 0x5F, 0x6E, 0x63, 0xE9, 0xD1, 0x60, 0xAE, 0x90, 0x48, 0xBF, 0x94, 0xB3,
+    0x2F, 0x99, 0xFB, 0x62, 0x17, 0xBF, 0xB0, 0x9C, 0x78, 0xE9, 0xCB, 0xF2, 0x35, 0xB3, 0xBB, 0x66,
+    0xED, 0xCC, 0x5A, 0x9E, 0xF5, 0x95, 0xE8, 0x97, 0x55, 0x2C, 0x44, 0xF8, 0x32, 0xCA, 0x84, 0x11,
+    0xF8, 0x12, 0x65, 0x6E, 0xCC, 0x31, 0x9A, 0xC6, 0x97, 0x9C, 0x1C, 0xD1, 0x34, 0xE2, 0xAA, 0x75,
+    0xF9, 0x44, 0xE5, 0x8B, 0x23, 0xB9, 0xEE, 0x57, 0x2A, 0x46, 0x22, 0x46, 0x42, 0xA3, 0x36, 0xFD,
+    0x5D, 0x0F, 0xDA, 0x4F, 0x7B, 0xE9, 0x17, 0xD4, 0xEB, 0x40, 0x4A, 0xE1, 0x80, 0xD8, 0x2A, 0x35,
+    0xE8, 0xDA, 0x08, 0x39, 0x4B, 0x6E, 0x1E, 0x88, 0x1A, 0x92, 0x5D, 0x96, 0x6C, 0x5D, 0x06, 0xED,
+    0x12, 0xAE, 0xD5, 0xC8, 0x9F, 0xE1, 0x46, 0x63, 0xE0, 0xDC, 0x74, 0x90, 0x0F, 0xDB, 0x6B, 0x84,
+    0x45, 0x42, 0xF8, 0x0C, 0xFD, 0x08, 0xC5, 0xC7, 0xC2, 0x28, 0x11, 0xD0, 0x78, 0x8C, 0x71, 0xB0,
+    0xC2, 0x39, 0xB7, 0x45, 0x68, 0xDD, 0x76, 0x83, 0x9B, 0xB3, 0xFA, 0xA8, 0x17, 0x05, 0xB8, 0xB2,
+    0x17, 0xC6, 0xE1, 0xAC, 0xFD, 0x48, 0x0B, 0xF1, 0x10, 0xAD, 0x37, 0x31, 0xE3, 0x10, 0x5A, 0x29,
+    0xEE, 0xAA, 0xCE, 0xBF, 0xF5, 0x4F, 0x73, 0x99, 0x7A, 0x3D, 0x24, 0xDD, 0xEE, 0xE1, 0xC9, 0xD0,
+    0x34, 0x99, 0x0D, 0xF8, 0x94, 0x7A, 0xAE, 0x64, 0x9D, 0xF1, 0x0C, 0x59, 0xC2, 0x91, 0xB0, 0x6C,
+    0x86, 0x38, 0xAB, 0x75, 0xE5, 0xE8, 0xBE, 0x6B, 0x90, 0x25, 0x78, 0x79, 0x05, 0xCF, 0x37, 0xE9,
+    0x11, 0x53, 0x5D, 0xB5, 0x6E, 0x5F, 0x16, 0xAB, 0x2F, 0xA0, 0x7B, 0xF0, 0x6C, 0xB8, 0x3D, 0x5D,
+    0xD9, 0xB2, 0x23, 0x24, 0x2C, 0xB3, 0x4D, 0x3A, 0x35, 0x5B, 0xAD, 0x70, 0x50, 0x96, 0x58, 0x46,
+    0x8F, 0x4B, 0xB4, 0xFD, 0x40, 0x53, 0x07, 0xDC, 0x1E, 0xE7, 0x77, 0xAF, 0x0A, 0x38, 0x0F, 0x0C,
+    0x49, 0x27, 0x76, 0x19, 0x48, 0xF6, 0x7A, 0xAE, 0xC1, 0x19, 0x11, 0x70, 0x61, 0x81, 0xFE, 0x78,
+    0x66, 0x9B, 0x34, 0xC3, 0x6E, 0x3B, 0x86, 0xC5, 0x19, 0x14, 0xD7, 0x5D, 0x6C, 0x5A, 0x53, 0x9A,
+    0x30, 0xAA, 0x3F, 0xFA, 0x6C, 0x32, 0xAB, 0x29, 0xF5, 0xDC, 0x96, 0x84, 0xE2, 0x48, 0x4D, 0xE9,
+    0x05, 0xE7, 0x0E, 0x9D, 0x11, 0xFA, 0x22, 0xEA, 0x8A, 0xE8, 0x26, 0xA7, 0x66, 0xB0, 0xF8, 0x17,
+    0xDC, 0x90, 0x33, 0xE3, 0x07, 0xF6, 0xC6, 0xA9, 0xFE, 0xA1, 0x7F, 0x90, 0x0E, 0xDE, 0xAF, 0xBF,
+    0x9C, 0xD0, 0x88, 0x65, 0xE5, 0xF1, 0xEC, 0x97, 0xD8, 0xB3, 0x29, 0xD3, 0x12, 0xB5, 0x92, 0x67,
+    0x22, 0x56, 0x69, 0x26, 0x52, 0x95, 0x40, 0x53, 0xBD, 0xE1, 0xDC, 0x8B, 0xF1, 0xB0, 0x75, 0x2A,
+    0x62, 0xF1, 0x0A, 0xEC, 0x4A, 0x8F, 0xD1, 0x2B, 0x56, 0x43, 0xF8, 0xEC, 0x33, 0xB1, 0x66, 0xD8,
+    0x77, 0x99, 0xAB, 0x4F, 0xB2, 0x02, 0x4D, 0x75, 0x07, 0x20, 0x75, 0x20, 0x76, 0x2B, 0x14, 0xF6,
+    0x85, 0x8E, 0xFA, 0xBF, 0xE1, 0x96, 0xE9, 0xDD, 0x41, 0x35, 0x43, 0x2B, 0x40, 0x29, 0x4C, 0xD5,
+    0xB0, 0x85, 0x46, 0x88, 0x16, 0xF4, 0xC1, 0x35, 0xEC, 0xB2, 0xEE, 0xCD, 0xE8, 0xF3, 0x7C, 0x9C,
+    0x14, 0x68, 0x2D, 0xC4, 0x01, 0x3D, 0xAD, 0x05, 0x59, 0x13, 0xDD, 0x92, 0xCA, 0x71, 0x25, 0x28,
+    0x5F, 0xC7, 0xD0, 0x30, 0xE8, 0xB0, 0xB9, 0x2D, 0x0D, 0xAE, 0x93, 0x39, 0x41, 0x93, 0x9A, 0x51,
+    0x9D, 0x7C, 0x5E, 0x8A, 0x8E, 0x9D, 0xAA, 0x97, 0xE5, 0x3D, 0xE2, 0x94, 0x58, 0x54, 0x26, 0x23,
+    0x88, 0xFF, 0x5D, 0x6E, 0xDB, 0x80, 0xF4, 0x4E, 0xE0, 0x02, 0x64, 0xB3, 0xFE, 0x2F, 0x12, 0xAD,
+    0x86, 0x9C, 0x23, 0x5C, 0x9D, 0xE9, 0x0E, 0x77, 0x6A, 0x2E, 0xE6, 0x1C, 0x4F, 0x8D, 0x56, 0x17,
+    0x89, 0x10, 0xAB, 0x35, 0x77, 0xC9, 0x0D, 0xB5, 0xC3, 0xAA, 0x09, 0xB9, 0x6F, 0x99, 0x9A, 0x11,
+    0x5B, 0xAD, 0x59, 0x5D, 0x9F, 0x4C, 0x4E, 0x89, 0x20, 0x88, 0x3D, 0xC0, 0x4A, 0x85, 0x46, 0xA2,
+    0x63, 0xE6, 0x0E, 0x44, 0x11, 0xC4, 0x6D, 0xC1, 0xC6, 0x68, 0xF3, 0x50, 0xB4, 0x9D, 0x79, 0x8A,
+    0x64, 0x40, 0x8A, 0x24, 0x61, 0xF4, 0xE5, 0xD8, 0xED, 0x09, 0x0F, 0x16, 0x4B, 0xF6, 0x2E, 0x94,
+    0x70, 0x41, 0x9B, 0x85, 0x55, 0x54, 0xF8, 0x6D, 0xAE, 0xAA, 0x2C, 0x6D, 0x69, 0x02, 0xCD, 0xF4,
+    0xD8, 0x29, 0x09, 0x57, 0x0A, 0x3B, 0xAD, 0x71, 0x30, 0x8B, 0xAB, 0xB0, 0x59, 0x17, 0xB3, 0xD6,
+    0x6B, 0xD6, 0x10, 0x82, 0x70, 0xF0, 0x3D, 0xC0, 0xC7, 0x9A, 0xDB, 0x3E, 0x7D, 0xC8, 0xF8, 0xCC,
+    0x75, 0xDB, 0x17, 0xAC, 0xB4, 0xC2, 0x4F, 0x23, 0x0D, 0x5A, 0xEF, 0x2E, 0x94, 0xEA, 0x6B, 0x95,
+    0xC2, 0xCE, 0x42, 0x5C, 0x80, 0xB5, 0x02, 0x2E, 0x32, 0x5F, 0x71, 0xBD, 0xD3, 0x45, 0x79, 0x5B,
+    0x63, 0x0B, 0x50, 0xD8, 0x5A, 0xEB, 0xA1, 0x79, 0x8C, 0xD7, 0x3A, 0xA6, 0xC3, 0xA6, 0xD2, 0xDF,
+    0x66, 0xD2, 0x58, 0x86, 0x57, 0x04, 0x30, 0x0B, 0xCD, 0x1C, 0x77, 0xEE, 0x34, 0x7E, 0xAA, 0x43,
+    0x82, 0x50, 0x94, 0xF5, 0x10, 0x33, 0x0B, 0x19, 0x33, 0x73, 0xBB, 0x4B, 0x5D, 0xCC, 0xAC, 0x9D,
+    0x6F, 0x2D, 0x9D, 0x2F, 0x56, 0x97, 0x81, 0x1F, 0xFE, 0x43, 0xAD, 0x9B, 0xC5, 0x5A, 0x31, 0x1A,
+    0x9B, 0x1F, 0x88, 0x01, 0xB9, 0xF6, 0x3D, 0xA1, 0xF4, 0x77, 0x4E, 0x8F, 0xD2, 0x62, 0x96, 0x9F,
+    0x1C, 0x65, 0x92, 0x4A, 0x7D, 0xB1, 0xDE, 0x78, 0x7B, 0xE5, 0xD7, 0x8F, 0x4E, 0x8E, 0x32, 0xAF,
+    0x28, 0x73, 0xB7, 0xFA, 0x47, 0x06, 0xA5, 0x2F, 0xFE, 0x2B, 0x52, 0x42, 0xB4, 0xB0, 0x2B, 0xF8,
+    0x69, 0x43, 0xE6, 0xA3, 0xFA, 0x3F, 0x61, 0x48, 0x9D, 0xE5, 0x18, 0xE2, 0xDB, 0x74, 0x87, 0x33,
+    0x39, 0xC8, 0x79, 0xA5, 0x08, 0x19, 0x12, 0x51, 0x49, 0x69, 0xF1, 0x24, 0x46, 0x79, 0x1E, 0xE8,
+    0x89, 0x56, 0x29, 0x69, 0x71, 0x0C, 0x02, 0x23, 0x28, 0x24, 0x87, 0x87, 0x7F, 0x40, 0x65, 0x1B,
+    0xAA, 0xEF, 0x28, 0xCE, 0x62, 0x3B, 0x7B, 0xA5, 0x88, 0xF1, 0xFE, 0x59, 0xDF, 0x7F, 0x41, 0xFE,
+    0xDA, 0xFF, 0x6C, 0xF0, 0x0E, 0x0F, 0xD4, 0x33, 0xBD, 0xE7, 0x69, 0xBA, 0x7A, 0xE5, 0x50, 0xC9,
+    0x52, 0x8F, 0x85, 0xE8, 0x56, 0x8F, 0xEA, 0x30, 0xEF, 0xD8, 0xC5, 0xB8, 0x4B, 0xB0, 0xD4, 0xD2,
+    0x9E, 0x0C, 0xE6, 0x4B, 0x5A, 0xC5, 0x39, 0xC6, 0x33, 0xCD, 0xBF, 0x90, 0x61, 0x37, 0x30, 0x0D,
+    0xD4, 0x88, 0xBE, 0xB9, 0x79, 0x4F, 0x49, 0xDF, 0x2F, 0xA0, 0xE5, 0xBD, 0x0D, 0x57, 0x80, 0x29,
+    0xD7, 0x18, 0xF9, 0x8C, 0x58, 0x6E, 0xAF, 0xF0, 0x68, 0xED, 0xD8, 0x39, 0x33, 0xE2, 0x03, 0x73,
+    0x5B, 0x1D, 0x34, 0xBA, 0x68, 0xE9, 0x87, 0x13, 0x5D, 0xF9, 0x1B, 0x33, 0x6C, 0x7D, 0x1A, 0xF6,
+    0x68, 0x5C, 0x21, 0xB6, 0x8C, 0x58, 0xF7, 0x10, 0x16, 0x21, 0xA2, 0x69, 0x5F, 0x6D, 0x65, 0xD4,
+    0x77, 0xF3, 0x62, 0x78, 0xEF, 0x82, 0xB1, 0xC8, 0xFC, 0xA5, 0x59, 0xE0, 0x46, 0xF4, 0x2F, 0xE4,
+    0xCD, 0xDB, 0x9A, 0x04, 0x78, 0x97, 0x5B, 0x22, 0xCC, 0x1D, 0xFD, 0x5F, 0xF4, 0x0F, 0x8E, 0x6F,
+    0x1A, 0x63, 0xFF, 0xEB, 0x2B, 0xC6, 0x37, 0xA7, 0xD8, 0x4B, 0xA6, 0xEC, 0xBF, 0x42, 0xE5, 0x6C,
+    0x30, 0x8E, 0x09, 0xA3, 0xD9, 0x77, 0xBF, 0xD5, 0xC2, 0xBC, 0xC9, 0xBC, 0x32, 0xE7, 0xE2, 0x70,
+    0xD2, 0x7B, 0xC4, 0xFA, 0xB5, 0xA0, 0x8B, 0xF9, 0xC6, 0x9F, 0x86, 0xF9, 0xB2, 0x68, 0x9C, 0xEB,
+    0xCB, 0x82, 0xB8, 0x30, 0x6D, 0x6B, 0xC2, 0xED, 0xC6, 0x55, 0x5B, 0x9F, 0x5C, 0x50, 0x3D, 0xFD,
+    0xAC, 0x7F, 0xB9, 0xA0, 0xFA, 0x05, 0xE0, 0x17, 0x8C, 0x8F, 0x04, 0xE9, 0x34, 0xA0, 0x89, 0xE7,
+    0x52, 0x89, 0x88, 0x06, 0x6C, 0x2B, 0x01, 0xD6, 0xCE, 0x10, 0xE5, 0xDA, 0x2D, 0x12, 0x00, 0x4F,
+    0xD5, 0xA7, 0x99, 0xD0, 0x3C, 0x06, 0xDD, 0xC5, 0xEF, 0x82, 0xC9, 0x15, 0xB8, 0x37, 0x64, 0xE4,
+    0xEE, 0x8D, 0x6F, 0x3B, 0x4B, 0xC9, 0x42, 0x0D, 0xB2, 0x8C, 0x54, 0x33, 0x44, 0xD5, 0x62, 0xA5,
+    0xCB, 0xE8, 0xE0, 0xAE, 0xEE, 0x7E, 0xD2, 0xBC, 0x56, 0x59, 0x5F, 0x00, 0xFA, 0x6B, 0x25, 0xC4,
+    0xE8, 0x48, 0x24, 0x51, 0x27, 0x95, 0xEB, 0xF0, 0x7E, 0xC5, 0x17, 0x82, 0xD0, 0xC0, 0x59, 0xD5,
+    0x6A, 0x82, 0xD5, 0x87, 0xB3, 0xBD, 0x1F, 0xB3, 0x18, 0x60, 0x3A, 0x2B, 0xDA, 0xDE, 0x49, 0x67,
+    0x6F, 0x99, 0x73, 0x2F, 0x13, 0x13, 0x27, 0x65, 0x08, 0x3F, 0x1D, 0x56, 0xFB, 0x22, 0xBF, 0x13,
+    0xE3, 0xEF, 0xCA, 0xC2, 0x3D, 0xC1, 0x37, 0x31, 0xE9, 0xE5, 0x1B, 0x86, 0x8B, 0x88, 0x5D, 0x9E,
+    0x21, 0x34, 0x86, 0x7A, 0xDF, 0x94, 0x94, 0x41, 0x6F, 0xBA, 0x99, 0x3C, 0xD6, 0xE4, 0xB2, 0x88,
+    0xC9, 0x06, 0x73, 0x16, 0x60, 0xD9, 0x5A, 0x4F, 0x76, 0x09, 0xD7, 0xB6, 0x4B, 0x4D, 0x07, 0x8F,
+    0xCD, 0x93, 0x9C, 0x8F, 0x8E, 0x58, 0xDB, 0x6D, 0x9A, 0xF9, 0x5A, 0x1F, 0x2D, 0x0A, 0x01, 0x4E,
+    0x53, 0xD4, 0x78, 0x4D, 0x82, 0x77, 0x5C, 0x99, 0x51, 0xEB, 0x57, 0x71, 0x85, 0x92, 0x9C, 0x70,
+    0x22, 0x5A, 0xAE, 0x8E, 0x98, 0xFF, 0x09, 0xC7, 0xA3, 0x06, 0x61, 0xE9, 0xA0, 0x1B, 0x15, 0x61,
+    0x13, 0xD3, 0xBF, 0x8B, 0xB2, 0xA0, 0xBD, 0x43, 0xF7, 0x29, 0x92, 0xDF, 0x59, 0x7A, 0x68, 0x63,
+    0xB1, 0x9D, 0xB9, 0xAC, 0x97, 0x72, 0x66, 0xCA, 0x4C, 0x72, 0xFE, 0xB7, 0x72, 0x05, 0xB3, 0xC8,
+    0xA9, 0x0C, 0x6D, 0x5F, 0x9D, 0xAC, 0x6E, 0x28, 0x51, 0x40, 0xD4, 0x40, 0x0B, 0x02, 0x22, 0x7D,
+    0xAA, 0xDD, 0x37, 0x0D, 0xEB, 0x1A, 0xFF, 0xA3, 0xC3, 0xB4, 0x8D, 0x87, 0x28, 0x70, 0x9A, 0x38,
+    0x7D, 0xD5, 0xB9, 0x4D, 0x82, 0xC3, 0xCE, 0xF0, 0xA3, 0x2F, 0xF8, 0x1B, 0x3E, 0xE2, 0x13, 0x88,
+    0xAE, 0x2B, 0x6D, 0xB6, 0xD5, 0x63, 0xC7, 0xDF, 0xD6, 0x14, 0xDB, 0x15, 0xC3, 0x09, 0x24, 0x5A,
+    0xD4, 0x83, 0x78, 0xB2, 0x42, 0x8A, 0xA0, 0x83, 0x70, 0x07, 0x63, 0x38, 0x01, 0x6F, 0xEF, 0xA3,
+    0x4E, 0x4C, 0x2C, 0xFE, 0x77, 0x73, 0x06, 0xE5, 0x7B, 0xB3, 0x96, 0x66, 0x11, 0xB3, 0x19, 0x0F,
+    0x92, 0xE2, 0x6D, 0x4A, 0x45, 0x1B, 0x8F, 0xDF, 0xA5, 0x2E, 0x6D, 0xA2, 0x6A, 0x8D, 0xEA, 0xA6,
+    0x1E, 0xD5, 0xDB, 0xFA, 0xCA, 0x9E, 0xB0, 0xC1, 0x52, 0x19, 0xFD, 0x72, 0x1C, 0xB4, 0x0C, 0x56,
+    0xFC, 0xBA, 0xF0, 0x27, 0x7C, 0xF3, 0xD2, 0xEF, 0xA4, 0xD1, 0xDA, 0xBD, 0x17, 0x8F, 0x6B, 0x2C,
+    0xE2, 0x20, 0x7C, 0x8B, 0x80, 0xDF, 0xB9, 0xFA, 0x74, 0xF8, 0x1A, 0x7C, 0x9B, 0xDB, 0x6C, 0x4F,
+    0xFC, 0x74, 0x69, 0x4F, 0xFC, 0x56, 0xA1, 0xAF, 0xCB, 0xAB, 0x16, 0x76, 0x5D, 0x2F, 0xEE, 0x89,
+    0x4F, 0x6D, 0xE7, 0xC9, 0xC3, 0xE9, 0x10, 0x85, 0x68, 0xA2, 0xEF, 0xC9, 0xA9, 0x19, 0x5C, 0x0E,
+    0x75, 0x8F, 0x12, 0xD8, 0x2B, 0x4B, 0x43, 0xAC, 0x64, 0x5F, 0xD7, 0x92, 0xB4, 0x6D, 0x1D, 0x88,
+    0x96, 0x96, 0xAB, 0xB0, 0x96, 0x7F, 0xA4, 0xEF, 0xF2, 0xF8, 0x47, 0x7D, 0x75, 0xDF, 0x6F, 0x94,
+    0x29, 0x6E, 0x2F, 0x43, 0xB7, 0x54, 0x0C, 0xFE, 0xF2, 0xA8, 0x5B, 0xD8, 0xEC, 0xEF, 0x97, 0x88,
+    0x6F, 0x43, 0xA3, 0x4C, 0x86, 0x28, 0xA8, 0x56, 0xA5, 0x6B, 0x0D, 0x85, 0xAC, 0xBE, 0x1D, 0xF3,
+    0x23, 0x3B, 0xDC, 0x0E, 0x0A, 0x6E, 0xAC, 0x1C, 0x7E, 0x7E, 0xC4, 0xDC, 0x4D, 0xEC, 0x78, 0xCB,
+    0x16, 0x6F, 0xD9, 0x02, 0x8D, 0x32, 0x8D, 0x87, 0x2D, 0x31, 0x1D, 0x5E, 0x07, 0x29, 0x2B, 0x98,
+    0xAB, 0x43, 0xAD, 0xF0, 0x30, 0x71, 0xFE, 0x05, 0x9E, 0xF6, 0x04, 0xEF, 0xE5, 0x12, 0xFD, 0x14,
+    0x73, 0x81, 0xBC, 0xC3, 0xF4, 0xD2, 0x3A, 0x47, 0xB9, 0x4D, 0x3E, 0x50, 0x76, 0xA7, 0x24, 0x70,
+    0xA9, 0x65, 0x35, 0xD5, 0xBC, 0xFA, 0xF6, 0x68, 0x45, 0xF8, 0xC6, 0xBC, 0x7A, 0x42, 0x77, 0x52,
+    0xEB, 0x8E, 0xD6, 0x2D, 0xBE, 0x77, 0x4B, 0xDF, 0x27, 0xF4, 0xDC, 0x95, 0x56, 0x90, 0xB4, 0xDE,
+    0x94, 0xF5, 0x0B, 0xDE, 0x54, 0x93, 0x5A, 0x5D, 0x70, 0x64, 0x35, 0xBE, 0x1A, 0x1C, 0xA5, 0x18,
+    0xB3, 0xDE, 0x91, 0x6B, 0x00, 0xDF, 0x07, 0xB3, 0x31, 0xAB, 0x30, 0x19, 0x66, 0x8B, 0x4C, 0x6C,
+    0x97, 0x12, 0x14, 0x26, 0x9A, 0x6C, 0x20, 0x64, 0xB6, 0x0E, 0x92, 0x63, 0x5D, 0x1A, 0xDF, 0x56,
+    0x6B, 0x80, 0x51, 0xC3, 0x70, 0xF6, 0xB6, 0x0A, 0x56, 0xEC, 0xD3, 0xB0, 0xE1, 0x8B, 0x24, 0xEC,
+    0x90, 0x09, 0x00, 0x79, 0x34, 0x4C, 0x48, 0x0D, 0xC3, 0x28, 0xA0, 0x26, 0xB8, 0x8D, 0xF9, 0x2E,
+    0x6E, 0x7F, 0x1B, 0x99, 0x8D, 0x3B, 0xB8, 0x62, 0x03, 0x3C, 0xDD, 0x47, 0xB2, 0x74, 0x4A, 0x30,
+    0xBC, 0x09, 0xB0, 0x72, 0x21, 0x54, 0xC6, 0xB4, 0xB8, 0xF3, 0x22, 0xA8, 0x8E, 0x28, 0x6E, 0x8C,
+    0x19, 0x40, 0x16, 0x6D, 0x50, 0x60, 0x1D, 0x49, 0xE3, 0x35, 0x4D, 0x3B, 0x70, 0x54, 0xFA, 0x92,
+    0xB6, 0x81, 0x3C, 0x64, 0xF3, 0xFC, 0x64, 0xBE, 0x70, 0x72, 0x84, 0x93, 0x11, 0x4E, 0xC6, 0x10,
+    0xB2, 0x9C, 0xE9, 0x1E, 0x05, 0xEE, 0xC5, 0x3A, 0xE9, 0x2C, 0x9C, 0x49, 0x25, 0x91, 0x1E, 0x11,
+    0x92, 0x0B, 0x43, 0xBF, 0xBB, 0xC3, 0x7C, 0xE7, 0xC0, 0xFF, 0x86, 0x17, 0x0B, 0x9C, 0x09, 0xFD,
+    0x98, 0x6E, 0x63, 0xB6, 0x2D, 0x42, 0xB2, 0x8D, 0xB9, 0x36, 0x4D, 0xB5, 0x71, 0x31, 0xBF, 0x79,
+    0xB1, 0xE8, 0xE7, 0xED, 0x9A, 0xBF, 0x10, 0xD5, 0x05, 0x85, 0xB5, 0x81, 0xE5, 0x2D, 0x46, 0xCB,
+    0xA3, 0x19, 0x0D, 0xCC, 0xBD, 0xB3, 0x97, 0xBF, 0xF2, 0xB9, 0x0C, 0x60, 0x6A, 0x92, 0xC2, 0xE2,
+    0x84, 0x2C, 0x81, 0xEF, 0x9D, 0x64, 0xB5, 0xFC, 0x72, 0x7D, 0xF8, 0x6F, 0xF1, 0x9E, 0x36, 0xF3,
+    0x7F, 0xED, 0x5C, 0xBF, 0x93, 0xDC, 0x46, 0x76, 0x6E, 0x00, 0x24, 0xC7, 0x47, 0xD4, 0x19, 0x0C,
+    0x44, 0x57, 0xE9, 0x58, 0xD2, 0x24, 0x0A, 0x54, 0x94, 0x45, 0xA4, 0xBE, 0xAA, 0x5D, 0x02, 0xF6,
+    0x05, 0x0A, 0xBD, 0x81, 0xB6, 0x1C, 0x38, 0x38, 0x07, 0x8A, 0xE4, 0x60, 0x53, 0x06, 0x4B, 0x02,
+    0xBE, 0xFB, 0x07, 0x94, 0x5C, 0xE4, 0x44, 0x81, 0xCA, 0x25, 0xF1, 0x02, 0x2A, 0x50, 0xC0, 0x60,
+    0x45, 0xC0, 0xBE, 0xE0, 0x52, 0x04, 0x77, 0xE5, 0xF0, 0x26, 0xA0, 0xCA, 0xB2, 0x1C, 0x2C, 0x5C,
+    0x35, 0x67, 0x0F, 0xA5, 0x19, 0xB4, 0xDF, 0xF7, 0xBD, 0xD7, 0x18, 0xEC, 0x92, 0x3A, 0x49, 0x24,
+    0x8F, 0x22, 0xF7, 0x3C, 0xB5, 0xDB, 0xFD, 0x76, 0x06, 0xD3, 0xE8, 0x7E, 0xAF, 0xFB, 0xFD, 0xF8,
+    0xDE, 0xC3, 0x3A, 0x27, 0xAF, 0x78, 0x81, 0xD6, 0xA5, 0x2B, 0x17, 0xFB, 0xA1, 0x4C, 0xD7, 0x2E,
+    0xF7, 0x7E, 0x19, 0xAF, 0x9C, 0xAF, 0xE3, 0xC1, 0x2D, 0x93, 0xB5, 0x73, 0x55, 0xDD, 0xA7, 0x4B,
+    0xE7, 0xE6, 0xFF, 0xDE, 0x66, 0x72, 0x6D, 0x36, 0xB8, 0xBC, 0x73, 0x6E, 0xB6, 0x74, 0x45, 0xEB,
+    0x9C, 0x7C, 0x5E, 0xD5, 0xEC, 0x1A, 0xE9, 0xE2, 0x8D, 0x6B, 0x4A, 0x76, 0x1E, 0xDD, 0xC0, 0x2E,
+    0x7A, 0x54, 0x27, 0x9F, 0xD9, 0x95, 0xF6, 0x3D, 0x1B, 0xC5, 0xC6, 0xCC, 0x5B, 0xDE, 0x61, 0x8E,
+    0xFB, 0xF5, 0x2E, 0xED, 0xE5, 0xEE, 0x1D, 0xDE, 0x77, 0x85, 0x5C, 0xE6, 0x4B, 0x19, 0x44, 0xC8,
+    0xA1, 0x59, 0x49, 0x77, 0xC1, 0xFB, 0x1A, 0x0B, 0x38, 0xBF, 0xE7, 0xF4, 0xF5, 0x03, 0xB6, 0x18,
+    0x88, 0x6D, 0xF4, 0x36, 0x46, 0x6B, 0x7C, 0x97, 0xB6, 0xC9, 0x70, 0x67, 0x95, 0xD6, 0xD9, 0x22,
+    0x1A, 0xE6, 0x78, 0xAF, 0x5A, 0xB9, 0xA2, 0xC4, 0x25, 0x95, 0xE3, 0x25, 0xBC, 0x89, 0x97, 0x3B,
+    0x76, 0x4E, 0xC6, 0x97, 0xB5, 0x4E, 0x5B, 0x3F, 0xB6, 0x9D, 0x5D, 0xA9, 0xDF, 0x92, 0x09, 0xC9,
+    0x4F, 0xCE, 0x41, 0xB2, 0x1E, 0x13, 0xC3, 0x5D, 0xE4, 0xD6, 0x95, 0x7F, 0x4F, 0x5A, 0xB9, 0x7B,
+    0x78, 0x5D, 0xB3, 0xBE, 0xA9, 0x2B, 0xBF, 0x71, 0xC5, 0xAA, 0x69, 0xD9, 0xAF, 0xF3, 0x3A, 0xC6,
+    0x0A, 0xD6, 0x59, 0x89, 0xE1, 0xDD, 0xD1, 0xDC, 0x69, 0x7F, 0x53, 0xFB, 0xA6, 0xD7, 0xFE, 0x53,
+    0x67, 0xEF, 0x3F, 0xA3, 0xFE, 0x2E, 0xEE, 0x2D, 0xBF, 0x5C, 0x4B, 0xED, 0xA2, 0x1E, 0xEC, 0x14,
+    0x21, 0xA0, 0x9F, 0x3F, 0xA0, 0x84, 0xDC, 0xCC, 0x7B, 0xAF, 0x6B, 0xF2, 0x4B, 0xF6, 0xD1, 0xFE,
+    0xB8, 0xDC, 0x0B, 0x25, 0x3B, 0x61, 0x14, 0x5E, 0x79, 0xCF, 0x2E, 0xEB, 0x8B, 0xC1, 0x15, 0x3E,
+    0x59, 0xBC, 0x31, 0xB8, 0x2B, 0x3E, 0x69, 0xC1, 0x2F, 0x9F, 0xD6, 0xE0, 0xB1, 0xBF, 0xE7, 0xD8,
+    0x2D, 0xB4, 0x73, 0x4F, 0xDC, 0x35, 0x2E, 0x42, 0x57, 0x95, 0x89, 0xE7, 0xD4, 0xE7, 0x15, 0xA6,
+    0xE3, 0x37, 0xD5, 0xE7, 0x98, 0x78, 0x5F, 0xC8, 0x6E, 0x72, 0x97, 0xDD, 0xE4, 0xF5, 0xBE, 0x7B,
+    0x7D, 0xA4, 0x6F, 0x72, 0xDD, 0xFA, 0xCA, 0x7F, 0xD2, 0x8F, 0x74, 0x76, 0xDC, 0x8E, 0x74, 0xE2,
+    0xCB, 0x91, 0x8E, 0xFD, 0x64, 0xA0, 0xB7, 0xDD, 0x89, 0x57, 0xE5, 0xFD, 0x7F, 0x6A, 0xE7, 0x7B,
+    0x34, 0x0B, 0xF0, 0x0B, 0x87, 0xCC, 0xBB, 0x2B, 0x32, 0xD7, 0x7B, 0xE4, 0x8E, 0x7C, 0x5F, 0x76,
+    0xC1, 0x11, 0x79, 0x2C, 0x74, 0xBE, 0x80, 0x00, 0xE4, 0x1D, 0xCF, 0x13, 0xF0, 0x09, 0xD7, 0x22,
+    0x3F, 0xB3, 0xB5, 0xD0, 0xC9, 0x86, 0x34, 0xCE, 0x83, 0x93, 0x03, 0x0B, 0x5A, 0x4E, 0x10, 0x2F,
+    0x04, 0xAD, 0xA7, 0x63, 0xA1, 0x5C, 0x20, 0x0B, 0xDA, 0x2D, 0x8D, 0x39, 0x1B, 0x1D, 0x8F, 0xEF,
+    0xD9, 0x58, 0x46, 0x67, 0xAB, 0x2D, 0x3D, 0xEF, 0xB7, 0x74, 0xD1, 0x69, 0x8F, 0xA9, 0x34, 0xAD,
+    0x8D, 0x61, 0xCC, 0xB6, 0x31, 0x92, 0xC1, 0x68, 0x99, 0xA7, 0xFC, 0xB8, 0xD7, 0x38, 0xDE, 0x12,
+    0x3F, 0x6E, 0xC7, 0xD6, 0x85, 0xAD, 0x70, 0xE8, 0x74, 0x0C, 0x9C, 0xD2, 0x23, 0x99, 0xC7, 0x4C,
+    0x97, 0x1F, 0xAD, 0x0F, 0xC0, 0x18, 0xB9, 0x83, 0xBC, 0x56, 0xC2, 0xA4, 0xA1, 0x34, 0x3A, 0xB0,
+    0xB9, 0x16, 0x29, 0x19, 0xD9, 0xCF, 0x3A, 0xE3, 0xAC, 0x5B, 0xE7, 0xA5, 0x31, 0xD6, 0x15, 0x8D,
+    0x33, 0xBE, 0xBA, 0xB9, 0xB2, 0x06, 0x87, 0x0B, 0xF7, 0xD7, 0xBB, 0xBB, 0x68, 0xCF, 0x19, 0x53,
+    0xDD, 0x76, 0xAE, 0x6E, 0xBB, 0x04, 0x19, 0x68, 0x6D, 0x1C, 0x0D, 0xA4, 0x30, 0xF4, 0xA6, 0x13,
+    0x15, 0xA8, 0x7C, 0xB8, 0x0B, 0xB5, 0xA4, 0xE4, 0xC7, 0x58, 0x40, 0xE0, 0x62, 0x53, 0x8E, 0xE4,
+    0x70, 0x82, 0xAF, 0x46, 0xA6, 0xCB, 0x2D, 0x87, 0x17, 0x23, 0x23, 0x8B, 0x76, 0xE4, 0x63, 0x53,
+    0x8E, 0x5F, 0x19, 0xC6, 0x99, 0x05, 0xC1, 0xC8, 0x0A, 0x64, 0x80, 0x57, 0x6C, 0x15, 0x32, 0xFB,
+    0x37, 0xB7, 0x2C, 0xDC, 0x35, 0x0E, 0xCA, 0x31, 0x3D, 0x52, 0x06, 0x3A, 0x69, 0xD7, 0xCA, 0x3F,
+    0x92, 0x72, 0x1C, 0x6F, 0x97, 0xEE, 0x65, 0x1E, 0xCA, 0xCC, 0xB7, 0x2E, 0xAB, 0x73, 0x1E, 0xDB,
+    0x56, 0xCE, 0xF3, 0xA7, 0xDC, 0xE3, 0xA2, 0x28, 0x87, 0x95, 0x51, 0xD4, 0x39, 0x4A, 0x51, 0xE6,
+    0xA4, 0xCE, 0x97, 0x81, 0x52, 0x6D, 0x6B, 0x54, 0xE4, 0x37, 0x79, 0x1B, 0x63, 0x6B, 0x8B, 0x32,
+    0xF8, 0xA9, 0x52, 0xF3, 0xE5, 0xEC, 0xB8, 0x8D, 0x7B, 0x99, 0x1A, 0xD8, 0xD3, 0x26, 0xA2, 0x2B,
+    0x6B, 0x51, 0x92, 0x55, 0x9B, 0x80, 0x5B, 0x95, 0x0B, 0x5A, 0xBE, 0x51, 0x6A, 0xB6, 0xE2, 0xAA,
+    0x5A, 0x0A, 0xC5, 0x28, 0x79, 0x7F, 0x50, 0xAA, 0xAA, 0x03, 0xE5, 0x9D, 0x51, 0xC6, 0x54, 0xA1,
+    0xE4, 0xAB, 0x36, 0x0A, 0xE4, 0xA9, 0x23, 0xCB, 0xDB, 0x1F, 0xF3, 0x6E, 0xF8, 0x6A, 0xCF, 0x19,
+    0xE0, 0xEA, 0x3E, 0x5B, 0xCE, 0x7E, 0xD7, 0x89, 0x54, 0x67, 0x98, 0x69, 0x36, 0x40, 0x77, 0xF5,
+    0x91, 0x5F, 0x67, 0xFE, 0x2D, 0x50, 0xB6, 0x3E, 0x9E, 0x53, 0x9C, 0x25, 0xD9, 0x73, 0x23, 0x11,
+    0xF3, 0xA0, 0xCF, 0xBC, 0x6D, 0x75, 0x3B, 0x7E, 0x22, 0xB4, 0xF5, 0x73, 0x40, 0x24, 0xAD, 0x11,
+    0xB3, 0xDA, 0x88, 0xF4, 0x21, 0x22, 0x03, 0x81, 0xE3, 0x5E, 0x80, 0xC0, 0x16, 0xF1, 0x20, 0x9A,
+    0x40, 0xD8, 0x89, 0x7A, 0x88, 0x48, 0x1E, 0x22, 0x66, 0xCB, 0xA0, 0x08, 0x83, 0x4E, 0xCC, 0x3B,
+    0x7B, 0x23, 0x68, 0xC3, 0xEC, 0x7E, 0x50, 0x7C, 0x51, 0x78, 0xA7, 0x57, 0x56, 0x6E, 0x7B, 0xE5,
+    0x68, 0xAA, 0xE7, 0xC8, 0xCE, 0xDE, 0xD7, 0xF6, 0x89, 0xE7, 0xB6, 0x70, 0x51, 0xA3, 0xBD, 0x6D,
+    0x13, 0x07, 0xBF, 0xE0, 0x29, 0xF4, 0x49, 0xAB, 0xFD, 0xAC, 0xD6, 0x3E, 0x3D, 0xD5, 0x67, 0xD2,
+    0x2B, 0xEF, 0xD2, 0x5E, 0x59, 0x97, 0xF6, 0x8D, 0xF5, 0x3A, 0xC9, 0xAF, 0xEB, 0xB3, 0x85, 0xF5,
+    0xC6, 0xA2, 0x70, 0x78, 0x2A, 0xE5, 0x4B, 0xB6, 0x19, 0x2F, 0x7B, 0xF7, 0x23, 0xE7, 0xF6, 0x9A,
+    0x41, 0x38, 0x3F, 0x1B, 0xB0, 0xBF, 0xAC, 0x89, 0xD6, 0xD4, 0x04, 0x0F, 0x37, 0x0D, 0x3E, 0xC8,
+    0xD1, 0xC4, 0xEB, 0x70, 0xDD, 0x93, 0x35, 0xA2, 0x8B, 0xA0, 0x7D, 0x3F, 0x8F, 0x44, 0x6D, 0xAC,
+    0x23, 0x88, 0xFB, 0x54, 0xC3, 0x4D, 0x91, 0xAC, 0xC2, 0x1E, 0x80, 0x6B, 0x46, 0xBF, 0x25, 0x79,
+    0xE0, 0x2A, 0x59, 0x48, 0xEE, 0x97, 0x85, 0x1F, 0x2A, 0x6F, 0x94, 0x8F, 0xE5, 0xD4, 0x51, 0x0F,
+    0xCA, 0xE1, 0xEB, 0xA0, 0xF0, 0xE1, 0xE8, 0x79, 0xAA, 0x7E, 0xAC, 0x1F, 0x1A, 0x5D, 0xA9, 0xFF,
+    0xDD, 0x04, 0xEA, 0xF7, 0x3E, 0x50, 0x4B, 0xB9, 0xD6, 0x28, 0x51, 0x40, 0x46, 0x89, 0x29, 0x32,
+    0x4A, 0x0C, 0x94, 0x51, 0xB2, 0x2F, 0x8D, 0x92, 0xF9, 0x1B, 0x25, 0x0A, 0x3F, 0x50, 0x45, 0x1B,
+    0xA8, 0x79, 0x1F, 0xA8, 0x6C, 0x19, 0xA8, 0x64, 0x1D, 0xA8, 0xD8, 0x07, 0xCA, 0xF9, 0xA3, 0x40,
+    0xC1, 0x41, 0x50, 0x2A, 0x1F, 0xA9, 0x8C, 0x94, 0x78, 0xC7, 0x34, 0x1A, 0x55, 0x79, 0x20, 0x4E,
+    0x5E, 0x4C, 0xAA, 0xC1, 0xDA, 0xD6, 0xA3, 0x6C, 0xDD, 0xA3, 0xA9, 0xC6, 0x3D, 0x4C, 0x0D, 0xA3,
+    0x0F, 0xB1, 0x09, 0x54, 0x3A, 0xDA, 0x3B, 0xDF, 0x85, 0x13, 0xF8, 0x60, 0xEB, 0x50, 0xEC, 0x8D,
+    0xE7, 0xD4, 0x38, 0x9F, 0x6C, 0x8C, 0xF1, 0xC9, 0xC6, 0xF8, 0x2E, 0x22, 0x33, 0xB6, 0xBB, 0xC0,
+    0x75, 0x17, 0x98, 0xEE, 0x02, 0xCF, 0x9D, 0xB1, 0x5C, 0x76, 0x93, 0x72, 0xFC, 0x60, 0x6D, 0x0C,
+    0x97, 0x35, 0x29, 0xBF, 0x65, 0x1C, 0x65, 0x37, 0x08, 0x72, 0x1B, 0x04, 0x99, 0x0D, 0x82, 0xBC,
+    0x26, 0x01, 0x56, 0x93, 0x00, 0xA7, 0x49, 0x80, 0xD1, 0x24, 0xC0, 0x67, 0x12, 0x60, 0x33, 0x09,
+    0x70, 0x59, 0x09, 0x61, 0xB2, 0x12, 0x79, 0x20, 0x32, 0x10, 0xC6, 0x61, 0xEC, 0x48, 0x32, 0x18,
+    0xBB, 0x92, 0xFC, 0x8D, 0x82, 0x22, 0xFA, 0x03, 0xC4, 0x56, 0x7D, 0x05, 0x36, 0xCE, 0x82, 0xB2,
+    0x9A, 0x2F, 0x02, 0x5F, 0xEB, 0xD3, 0x6C, 0xDD, 0x3B, 0xF9, 0x9D, 0xE0, 0x14, 0x04, 0xCD, 0x17,
+    0x2F, 0xDD, 0xD7, 0xBE, 0xD4, 0xC9, 0xC7, 0xB6, 0x97, 0x2D, 0xBE, 0x3E, 0x58, 0xC1, 0x13, 0x39,
+    0x58, 0x27, 0x5F, 0x76, 0x73, 0x2C, 0x5E, 0x74, 0x87, 0x0C, 0x2A, 0x3D, 0x0F, 0xAB, 0xF4, 0x1B,
+    0xEB, 0xB9, 0x9A, 0xA7, 0xDF, 0x8B, 0xE6, 0x10, 0x87, 0x25, 0x59, 0xDF, 0xF1, 0x8B, 0xC8, 0x2F,
+    0x92, 0x35, 0xCD, 0x5C, 0x9F, 0x9C, 0x5A, 0x4F, 0x58, 0xE7, 0xD8, 0x2F, 0x4F, 0xB2, 0x2A, 0xE8,
+    0x30, 0xD3, 0x59, 0xC1, 0xD7, 0xE5, 0xD9, 0x37, 0x47, 0xD9, 0x7C, 0xE4, 0xFC, 0xAD, 0x7E, 0xE2,
+    0x19, 0xDB, 0x85, 0xC1, 0x1F, 0x3E, 0xE9, 0x0A, 0xAF, 0xA6, 0xFB, 0x5C, 0x7D, 0x45, 0x9A, 0x55,
+    0xDC, 0xAF, 0xE1, 0xF7, 0xB2, 0x82, 0x82, 0x99, 0xEB, 0x6D, 0x77, 0x35, 0x7A, 0xD8, 0x51, 0x63,
+    0x73, 0xA4, 0x73, 0x5A, 0x72, 0xCA, 0x91, 0xAE, 0x28, 0x5E, 0x70, 0xB4, 0x84, 0x21, 0x9B, 0x9B,
+    0xA9, 0x37, 0x96, 0xD5, 0x3C, 0x72, 0x99, 0xE8, 0xE8, 0x16, 0xC7, 0x82, 0xDD, 0xAE, 0xC6, 0x22,
+    0x87, 0x6A, 0xBA, 0xEE, 0xEA, 0x0A, 0x97, 0xF4, 0x3E, 0x10, 0xDB, 0xC0, 0x79, 0xED, 0x69, 0xDB,
+    0xC1, 0x01, 0x09, 0x19, 0xEE, 0x0C, 0xB5, 0xBB, 0xE3, 0xEF, 0xE3, 0xBB, 0xF0, 0xA8, 0xB8, 0xE6,
+    0xA3, 0x08, 0x5B, 0x76, 0xB6, 0xB0, 0xD5, 0x72, 0xEA, 0xBA, 0x8C, 0x71, 0x9D, 0x8C, 0x80, 0x1A,
+    0xD9, 0x00, 0xC9, 0xF0, 0xF7, 0x6B, 0xB0, 0x6B, 0x83, 0x1B, 0x35, 0x2E, 0x59, 0xE0, 0xC8, 0xEF,
+    0xC1, 0x47, 0x71, 0x63, 0x73, 0xFE, 0xB6, 0xA7, 0x7F, 0xEB, 0x52, 0x51, 0xA2, 0xD8, 0x9C, 0x95,
+    0x86, 0xA3, 0xC2, 0x84, 0x66, 0x6C, 0xBC, 0xBC, 0x27, 0xEC, 0x9C, 0x2F, 0xE6, 0x45, 0x99, 0xF9,
+    0x75, 0x71, 0x3F, 0xF6, 0x7D, 0xBE, 0x62, 0xE8, 0xF2, 0x8E, 0x7B, 0x79, 0x57, 0x02, 0xC6, 0x9F,
+    0xF7, 0xE9, 0x71, 0x97, 0xF8, 0x1A, 0xFE, 0xE4, 0xDB, 0xE6, 0xC2, 0xC8, 0x0F, 0x8C, 0xAC, 0xFA,
+    0x2C, 0x8F, 0xFB, 0x23, 0x23, 0x88, 0x49, 0x68, 0xFC, 0x46, 0x6E, 0x74, 0xDD, 0x1D, 0x65, 0x3F,
+    0x13, 0xD7, 0x49, 0x6E, 0x44, 0x2E, 0xBF, 0x64, 0x0B, 0x2E, 0xC4, 0xDB, 0xD6, 0xEB, 0x9B, 0x6F,
+    0xFD, 0xE3, 0xCB, 0x37, 0xFC, 0x03, 0x31, 0x17, 0xE2, 0x8F, 0x46, 0x12, 0x25, 0x27, 0x8B, 0x54,
+    0xB8, 0x19, 0xAD, 0x0A, 0x8C, 0x77, 0x8F, 0xBB, 0xA3, 0xE0, 0x56, 0x61, 0xF4, 0xB1, 0xF5, 0xCC,
+    0x1C, 0x21, 0x0A, 0x4A, 0x14, 0x3A, 0x04, 0x00, 0x85, 0xE2, 0x13, 0x84, 0x27, 0x3A, 0xA2, 0x13,
+    0xBD, 0x82, 0x13, 0xEA, 0x61, 0x2A, 0xA8, 0xA0, 0x08, 0x83, 0xC2, 0x0D, 0x8A, 0x3D, 0x28, 0x10,
+    0x71, 0xBA, 0x8D, 0x07, 0xBD, 0x46, 0xAF, 0xD7, 0xEF, 0xEA, 0x38, 0x0A, 0x47, 0x28, 0x1A, 0xA1,
+    0x60, 0x84, 0x61, 0x11, 0x0A, 0x45, 0x28, 0x12, 0x61, 0x40, 0x04, 0x70, 0x88, 0xA8, 0x76, 0xFF,
+    0x80, 0x8D, 0x2A, 0x97, 0xDE, 0xCA, 0xB0, 0x05, 0x31, 0x70, 0x36, 0x04, 0xB5, 0x12, 0xED, 0x9D,
+    0xD0, 0x1C, 0x8D, 0x68, 0x6A, 0x82, 0x06, 0x40, 0x26, 0x14, 0x4A, 0x00, 0x2E, 0x51, 0x13, 0x60,
+    0x20, 0xD6, 0x40, 0xD8, 0x81, 0x38, 0xC4, 0xB6, 0xF1, 0xA1, 0xE9, 0x78, 0x09, 0x2F, 0x26, 0x18,
+    0xC1, 0x01, 0x08, 0x45, 0x28, 0x12, 0x41, 0x20, 0x42, 0x55, 0xD4, 0x6B, 0x0A, 0x8E, 0x5C, 0x53,
+    0xE5, 0x9F, 0xFD, 0x1B, 0xCF, 0xFC, 0xEC, 0xAB, 0x85, 0xB2, 0x56, 0x4F, 0xBA, 0x1D, 0xF4, 0xCB,
+    0xD3, 0xF8, 0x75, 0x23, 0x52, 0x5E, 0x5A, 0x47, 0xD5, 0xB9, 0x19, 0xB1, 0x82, 0xEF, 0xA3, 0xBB,
+    0x3B, 0x22, 0x13, 0x06, 0x4C, 0x18, 0x2E, 0x61, 0xB0, 0x44, 0x40, 0x25, 0x0C, 0x94, 0x50, 0x4C,
+    0xE2, 0x22, 0x62, 0x47, 0x51, 0x10, 0x19, 0x44, 0xBC, 0xBC, 0x45, 0xC3, 0x4B, 0x55, 0x58, 0xF1,
+    0xA2, 0x7C, 0x71, 0x6A, 0xA7, 0xE9, 0xDE, 0x06, 0x58, 0xE1, 0x88, 0x55, 0x30, 0xAA, 0xF6, 0x21,
+    0xB4, 0x7B, 0xF2, 0x56, 0xD1, 0x09, 0x05, 0x27, 0x14, 0x9B, 0x50, 0x68, 0xC2, 0x90, 0x09, 0x65,
+    0xFF, 0xD5, 0xDB, 0x1F, 0xE9, 0x11, 0x1B, 0x26, 0x7F, 0xD9, 0xEB, 0x9C, 0xBB, 0xC4, 0xCF, 0x1C,
+    0xCF, 0x4B, 0x55, 0xF3, 0x92, 0xA2, 0x1C, 0x54, 0xC0, 0x37, 0x4E, 0xDB, 0xA8, 0x33, 0x21, 0xC4,
+    0xF3, 0xFB, 0xFB, 0xAA, 0xD7, 0xDB, 0xD0, 0x4E, 0x5F, 0x69, 0x37, 0xAF, 0x09, 0x31, 0x31, 0x92,
+    0xE4, 0x20, 0xDD, 0xBC, 0x7C, 0x84, 0xBD, 0xFE, 0xBE, 0xC5, 0xAA, 0x08, 0xCD, 0x68, 0x8B, 0xCD,
+    0xE4, 0x66, 0xBA, 0x9C, 0xB9, 0x5E, 0xF2, 0xBA, 0x61, 0x86, 0x47, 0xEA, 0x40, 0x0E, 0x93, 0xCE,
+    0x44, 0x7E, 0xE6, 0xA4, 0x2B, 0x3B, 0xBC, 0xDE, 0xBA, 0xCB, 0x5C, 0x6A, 0x44, 0x33, 0x90, 0xF0,
+    0x70, 0xA6, 0x78, 0xFB, 0x42, 0x7D, 0x91, 0x11, 0x93, 0xA2, 0x05, 0x90, 0x74, 0xBA, 0xC8, 0x6B,
+    0x84, 0x9A, 0xE7, 0x9F, 0x2F, 0x19, 0xDF, 0x70, 0xAF, 0x52, 0xAF, 0x94, 0x94, 0x71, 0xF6, 0x1F,
+    0xBD, 0x3A, 0x47, 0xEA, 0xCE, 0x9B, 0xF7, 0xA9, 0xAB, 0xCE, 0x55, 0xC6, 0x76, 0x74, 0xC3, 0x41,
+    0x3E, 0xA3, 0x32, 0x56, 0x35, 0xAC, 0x27, 0x35, 0x5E, 0xDD, 0xE3, 0xE7, 0xE4, 0x50, 0x41, 0x06,
+    0xFD, 0xE8, 0x3D, 0x82, 0x7C, 0x17, 0xCB, 0x87, 0x64, 0xDC, 0x3E, 0x87, 0x32, 0x56, 0x5F, 0x35,
+    0x20, 0x20, 0xE6, 0x31, 0x87, 0x40, 0xE1, 0x48, 0xBB, 0x57, 0x4C, 0xC6, 0x87, 0x13, 0x19, 0x17,
+    0x41, 0xC6, 0x9F, 0x9E, 0x4D, 0x19, 0x13, 0xA2, 0x9D, 0xAD, 0x26, 0xB1, 0xD8, 0x3D, 0xE3, 0x02,
+    0x3F, 0xA8, 0xB7, 0x32, 0xEE, 0xF3, 0x51, 0x57, 0x3F, 0x9F, 0x32, 0xA6, 0x37, 0x07, 0xC7, 0x6E,
+    0x06, 0x8C, 0x30, 0xAB, 0xD3, 0xB5, 0xFB, 0x21, 0xE6, 0x71, 0xCE, 0x22, 0xF8, 0xA2, 0x0C, 0xFB,
+    0x80, 0x09, 0xA7, 0xBC, 0xBD, 0xBC, 0xBF, 0x5F, 0xB5, 0x05, 0x42, 0x8E, 0xE2, 0x8B, 0xDB, 0x0D,
+    0x3D, 0x32, 0xA0, 0xA0, 0x45, 0x8D, 0xA6, 0x54, 0xDF, 0x0C, 0x39, 0xA5, 0x74, 0x49, 0x48, 0xEE,
+    0x0E, 0x60, 0x4B, 0x88, 0x59, 0x7D, 0xC2, 0xDB, 0xB7, 0x3F, 0xA0, 0x7E, 0xF0, 0x6B, 0xFD, 0xEB,
+    0xC3, 0x09, 0x27, 0x2E, 0x69, 0x88, 0xBA, 0x89, 0xC9, 0xD8, 0x41, 0x8D, 0x87, 0x75, 0x37, 0xA2,
+    0xFE, 0x11, 0x76, 0xEE, 0x05, 0x0E, 0xB7, 0xF6, 0xF7, 0xF7, 0x08, 0xBD, 0x5A, 0xB3, 0x7D, 0xAD,
+    0xE5, 0x7C, 0x45, 0x1B, 0x99, 0x13, 0x1B, 0x77, 0x14, 0x9F, 0x58, 0xF8, 0x33, 0x8D, 0xBE, 0x46,
+    0x39, 0x59, 0xC7, 0x39, 0x6F, 0x5F, 0xEF, 0x4C, 0x51, 0x09, 0x13, 0x42, 0xC0, 0x28, 0xDE, 0x39,
+    0x4B, 0x72, 0x8A, 0x20, 0xA2, 0xE8, 0x94, 0x9C, 0x30, 0x86, 0x9E, 0x7E, 0x36, 0xD1, 0xC9, 0x0F,
+    0x9F, 0xB1, 0x9C, 0xE0, 0x38, 0x06, 0x94, 0xDA, 0xBC, 0xC6, 0xCC, 0x07, 0x08, 0xE8, 0xEB, 0x5F,
+    0x00, 0x79, 0x19, 0x0E, 0x91, 0xC0, 0xE5, 0xB3, 0x3B, 0xCC, 0x2A, 0xC8, 0xD7, 0x73, 0x24, 0x51,
+    0xE0, 0xA1, 0x21, 0x0B, 0x01, 0x62, 0x07, 0x04, 0xC6, 0xBE, 0x8B, 0x0C, 0x05, 0xDE, 0xE9, 0x0D,
+    0x3B, 0x89, 0x17, 0x01, 0x44, 0x69, 0x8D, 0x48, 0xEB, 0x3C, 0x38, 0x7B, 0x46, 0xEC, 0x42, 0x1E,
+    0x90, 0xE3, 0x61, 0x20, 0x96, 0xF6, 0x91, 0x48, 0x21, 0x37, 0x64, 0xC5, 0xE6, 0x3E, 0x0B, 0x84,
+    0xC4, 0x32, 0xFA, 0xD1, 0x3C, 0xE0, 0x34, 0xBB, 0x4A, 0xBC, 0x0F, 0xF5, 0x0D, 0xA2, 0x27, 0xB4,
+    0x06, 0x02, 0xE7, 0x44, 0xB8, 0x16, 0xF7, 0x33, 0x25, 0xD2, 0xBE, 0x19, 0xEA, 0x8B, 0x58, 0x57,
+    0x2F, 0xA3, 0xCD, 0x49, 0x6C, 0xF9, 0x94, 0x5B, 0x5E, 0x37, 0xF4, 0xA7, 0x01, 0xAF, 0xFD, 0x10,
+    0xB9, 0x2E, 0xA0, 0xBC, 0x44, 0x88, 0x83, 0xBF, 0xB3, 0x84, 0x1C, 0x3D, 0xD4, 0x1A, 0x44, 0x89,
+    0x9D, 0x07, 0x69, 0xB6, 0x26, 0x50, 0xDD, 0x7B, 0x68, 0xB8, 0x95, 0xB5, 0x17, 0xC9, 0x82, 0xB1,
+    0x4C, 0xF1, 0x01, 0x4F, 0x7F, 0xA0, 0x17, 0x51, 0xC4, 0xAA, 0x52, 0x2B, 0xD3, 0xAF, 0x4D, 0x6D,
+    0x7D, 0xAB, 0xBD, 0x30, 0x20, 0x82, 0xC4, 0x8F, 0x45, 0x29, 0x43, 0xE8, 0xBF, 0xDE, 0x88, 0x8D,
+    0x11, 0x99, 0x46, 0x38, 0x8B, 0xB1, 0x6C, 0xC5, 0x1C, 0xAE, 0xD6, 0xE5, 0x53, 0x08, 0x54, 0xE5,
+    0x91, 0x9B, 0x48, 0xD5, 0x68, 0x55, 0x5D, 0x84, 0x51, 0x06, 0xB5, 0x69, 0x2B, 0x9E, 0x03, 0x9C,
+    0x01, 0xF1, 0xC3, 0x71, 0x22, 0x7E, 0x10, 0x6A, 0x08, 0x42, 0x57, 0xE9, 0x7E, 0xD1, 0x03, 0x19,
+    0x3A, 0x7F, 0xBA, 0x03, 0x07, 0xA5, 0x93, 0x7B, 0xE0, 0x92, 0xA8, 0x59, 0xF2, 0x7B, 0x12, 0x5E,
+    0x22, 0x09, 0x2B, 0xE3, 0xCA, 0x60, 0x57, 0x9B, 0x2F, 0xE0, 0x33, 0x54, 0x72, 0x89, 0xDC, 0xEF,
+    0xF2, 0xC1, 0x67, 0xC4, 0x7B, 0xE5, 0x33, 0x24, 0x01, 0x71, 0x6B, 0x61, 0x1E, 0x7C, 0x8A, 0xB9,
+    0xCA, 0x59, 0x96, 0xF4, 0xC0, 0x4D, 0x4B, 0x09, 0x2E, 0x41, 0x00, 0x31, 0x91, 0xDF, 0x63, 0xA4,
+    0x0D, 0xFF, 0x6E, 0xB8, 0x85, 0x43, 0xB6, 0xF9, 0x33, 0x80, 0x78, 0x0D, 0xE3, 0x89, 0x8A, 0xAD,
+    0x18, 0xA7, 0x69, 0x2B, 0x9F, 0x56, 0x04, 0xFC, 0x60, 0x8D, 0x07, 0x1E, 0xCB, 0x82, 0x5B, 0x2D,
+    0xBF, 0x57, 0x5A, 0xC2, 0x5F, 0xD3, 0xFC, 0x4E, 0x95, 0x6A, 0x34, 0xD0, 0x1A, 0xE9, 0xD6, 0x2F,
+    0x00, 0x6A, 0xC6, 0xFE, 0x36, 0xAC, 0x60, 0x07, 0x49, 0xE7, 0xA5, 0x38, 0x70, 0xE2, 0xC3, 0x5C,
+    0xFD, 0xE5, 0x50, 0x17, 0xF8, 0x58, 0x5A, 0xE8, 0x0A, 0xB9, 0x51, 0xBA, 0x80, 0x8D, 0x3B, 0x68,
+    0xB1, 0x53, 0xA1, 0x7F, 0x0E, 0xB4, 0x14, 0xE2, 0x3D, 0x55, 0x7B, 0x4B, 0x1D, 0xFD, 0x96, 0xC6,
+    0x3B, 0xB9, 0x29, 0xB8, 0x61, 0x8A, 0xBA, 0x46, 0x7B, 0xEE, 0xB9, 0x93, 0x1A, 0x3A, 0x4A, 0x45,
+    0xEF, 0x27, 0xDD, 0x77, 0x90, 0x1A, 0xD1, 0xC3, 0x5D, 0x28, 0xFA, 0xF9, 0xCF, 0xE5, 0xCB, 0x29,
+    0xD0, 0xC3, 0x84, 0x66, 0xDF, 0x4F, 0xD0, 0xC3, 0x4B, 0x2A, 0x57, 0x8A, 0x15, 0x52, 0xA5, 0x50,
+    0x29, 0x53, 0x8A, 0x94, 0x52, 0xDC, 0x36, 0x14, 0xA7, 0x4A, 0x93, 0xC2, 0xA4, 0x2C, 0xAF, 0x41,
+    0x94, 0x9F, 0x04, 0x41, 0x92, 0xD3, 0x2A, 0x46, 0x4A, 0x11, 0x42, 0xA4, 0x0C, 0x29, 0x42, 0x4A,
+    0xB0, 0x30, 0xE0, 0x2D, 0x5E, 0x52, 0x7C, 0xD8, 0x2C, 0x0B, 0x0A, 0x4F, 0x65, 0xA7, 0xA2, 0x33,
+    0xC0, 0x97, 0xF0, 0xA7, 0x01, 0xA0, 0x23, 0xE0, 0x6B, 0x86, 0xCA, 0xCC, 0xD6, 0xF4, 0xB8, 0xC1,
+    0x8B, 0x15, 0x86, 0x5A, 0x07, 0x34, 0x72, 0xAE, 0x05, 0x0A, 0x08, 0xD8, 0xA4, 0xBB, 0xAE, 0xF9,
+    0x3D, 0x4D, 0x70, 0xC7, 0x5A, 0x68, 0x90, 0x6A, 0x5D, 0xC1, 0x5C, 0x73, 0x7F, 0x37, 0xD9, 0xE9,
+    0x5D, 0x3D, 0x2B, 0x4F, 0x9C, 0xCF, 0xF4, 0xAF, 0x42, 0x2D, 0x6F, 0xA3, 0xC5, 0x07, 0xFF, 0x4D,
+    0xED, 0xEC, 0xDB, 0x46, 0x4B, 0x14, 0x0A, 0x1D, 0xCC, 0x0A, 0x19, 0x66, 0x4C, 0xE3, 0xBA, 0xC4,
+    0x92, 0xEF, 0x5E, 0x53, 0xC9, 0x95, 0xE6, 0xE0, 0x73, 0x54, 0x1B, 0x94, 0xC8, 0xC5, 0x1D, 0xF8,
+    0xCF, 0x11, 0xA0, 0x35, 0x48, 0x51, 0x1E, 0x2C, 0x42, 0xB2, 0x9C, 0x89, 0xF2, 0x64, 0x41, 0x43,
+    0xF6, 0xD5, 0x32, 0xA4, 0x53, 0xC2, 0xF6, 0x82, 0x82, 0xB9, 0x4A, 0x54, 0xA6, 0xE2, 0xFA, 0x67,
+    0xC3, 0x24, 0xA5, 0xF3, 0x4D, 0x6D, 0xE3, 0x91, 0xDA, 0x3E, 0x18, 0x4A, 0x69, 0xB1, 0xA5, 0x06,
+    0x87, 0xA8, 0x68, 0x20, 0x5F, 0x06, 0xB2, 0x65, 0x20, 0x57, 0x06, 0x32, 0x65, 0xA0, 0x86, 0xDF,
+    0x54, 0x5C, 0x1A, 0xDD, 0x6D, 0xFF, 0x2B, 0x5E, 0x13, 0x69, 0xC5, 0x01, 0xB6, 0xF6, 0xC0, 0x69,
+    0x0D, 0xE4, 0xF3, 0x80, 0xE5, 0xCB, 0x67, 0x22, 0x98, 0xDC, 0xDF, 0x8F, 0xA0, 0xA9, 0xD7, 0xA1,
+    0x0C, 0xE7, 0x85, 0x00, 0x52, 0xD3, 0x6E, 0x1B, 0x33, 0xDC, 0x54, 0xDF, 0xEF, 0xA1, 0xD6, 0xEF,
+    0xEB, 0x46, 0xA3, 0x51, 0xDD, 0x3C, 0x4B, 0x40, 0x35, 0xB9, 0xAF, 0x1E, 0x15, 0xC2, 0xB8, 0x30,
+    0xC1, 0x4F, 0xC7, 0x50, 0xA7, 0xFA, 0x05, 0x95, 0x6B, 0x69, 0x3B, 0x22, 0x22, 0x6E, 0x25, 0xDA,
+    0xA5, 0x0B, 0xED, 0xF4, 0x75, 0x56, 0x65, 0x01, 0xDF, 0x30, 0x81, 0x5B, 0x11, 0xAB, 0x47, 0xE3,
+    0x9E, 0x39, 0xEA, 0xCD, 0xA4, 0x16, 0x85, 0xC4, 0xA9, 0xDF, 0x1A, 0x1B, 0x75, 0x2F, 0x7E, 0x4B,
+    0xB6, 0xCB, 0xC7, 0x17, 0x20, 0x00, 0x82, 0xE3, 0x84, 0xC6, 0x09, 0x8C, 0x13, 0x16, 0x57, 0x50,
+    0x9C, 0x76, 0x22, 0x00, 0xE2, 0xAC, 0x1B, 0x49, 0x43, 0xD3, 0xA5, 0xBF, 0xDD, 0xFF, 0x69, 0x9D,
+    0x42, 0x99, 0xA5, 0xEA, 0xC8, 0x13, 0xAC, 0xA2, 0x6D, 0xCB, 0x03, 0x0C, 0xC0, 0x53, 0x9C, 0xFE,
+    0x86, 0x5E, 0xE7, 0x7D, 0xBA, 0x9E, 0x18, 0xB0, 0xC1, 0x85, 0xF3, 0xA5, 0xD5, 0x70, 0x29, 0x18,
+    0x98, 0xD0, 0x6B, 0xDF, 0xCC, 0xD1, 0x14, 0x14, 0xB6, 0xE8, 0x63, 0xC8, 0x2B, 0x5B, 0x16, 0xA2,
+    0xEE, 0xBB, 0xCC, 0xDF, 0x11, 0xE9, 0x70, 0xA7, 0xC0, 0x85, 0x56, 0x93, 0x4A, 0x83, 0xFA, 0x87,
+    0xF3, 0x0C, 0xE6, 0xF1, 0xFA, 0x72, 0x6C, 0xE0, 0x3C, 0x1E, 0x89, 0x9E, 0x15, 0x3B, 0xF1, 0x43,
+    0x37, 0xEB, 0x02, 0x9F, 0xAE, 0x9F, 0x98, 0x33, 0xFD, 0xD9, 0xEC, 0x37, 0x74, 0x04, 0x85, 0x9D,
+    0x7F, 0xC1, 0x82, 0x4B, 0x4D, 0xED, 0xD1, 0x92, 0x5A, 0xCC, 0x1B, 0xCA, 0xFC, 0xB2, 0xB1, 0xE1,
+    0x9F, 0xF3, 0xF6, 0x4D, 0x7C, 0x7A, 0x0B, 0x51, 0x72, 0x45, 0xE5, 0xD4, 0xC9, 0xB4, 0xE6, 0x70,
+    0x24, 0xA2, 0xE6, 0x01, 0x20, 0xCE, 0x8B, 0xB9, 0x3B, 0x14, 0x66, 0x27, 0x5F, 0x2D, 0xC0, 0x68,
+    0xE1, 0xCA, 0xE5, 0x71, 0xAE, 0xF5, 0x05, 0x11, 0x4C, 0x55, 0x5B, 0x7D, 0xE5, 0xE3, 0xFC, 0x94,
+    0xF8, 0xE1, 0x7D, 0xC5, 0x3A, 0x8A, 0xDA, 0xBC, 0x55, 0xFE, 0x7F, 0x25, 0xDE, 0x53, 0xA8, 0xC4,
+    0x0B, 0x35, 0x77, 0xC6, 0xC7, 0x31, 0xA1, 0xAE, 0x35, 0x77, 0x76, 0xD3, 0x10, 0x5B, 0xF9, 0x90,
+    0x59, 0xF9, 0x93, 0xAD, 0xB9, 0x0B, 0xFB, 0x79, 0xCC, 0x55, 0x34, 0x23, 0x95, 0x7F, 0x47, 0xEA,
+    0x0C, 0xD7, 0xDC, 0x8D, 0xA8, 0x61, 0x00, 0x53, 0x0B, 0xFD, 0x44, 0x01, 0x52, 0x75, 0x00, 0x81,
+    0x66, 0xF0, 0xAF, 0x47, 0x45, 0xA4, 0x67, 0x20, 0x46, 0x70, 0xF1, 0x87, 0x01, 0x36, 0x65, 0xE1,
+    0x58, 0x3E, 0xEA, 0x63, 0x2E, 0xBF, 0x7C, 0xAE, 0x63, 0x04, 0x38, 0xF9, 0x15, 0x61, 0x30, 0xA5,
+    0x36, 0xD4, 0x09, 0xA5, 0xD3, 0x42, 0xBF, 0xF1, 0x90, 0xFE, 0x11, 0x28, 0xBC, 0x68, 0x11, 0x27,
+    0x94, 0x86, 0x12, 0x9B, 0x70, 0xDD, 0x56, 0x21, 0x3C, 0x06, 0xB5, 0x3A, 0x4D, 0x35, 0x88, 0x7E,
+    0xB9, 0xAE, 0xA2, 0x16, 0x29, 0x23, 0x6C, 0x70, 0xF3, 0x2F, 0x01, 0x74, 0x60, 0xD5, 0x33, 0x3F,
+    0xD6, 0x73, 0x5D, 0xDE, 0xEE, 0xEE, 0x6A, 0x1D, 0x35, 0xF2, 0x61, 0xB5, 0xA1, 0xF7, 0x17, 0x0D,
+    0xC5, 0xBF, 0xC8, 0xF6, 0x71, 0xC3, 0x11, 0x0B, 0xCA, 0x44, 0x26, 0x89, 0x56, 0xCA, 0x45, 0xA6,
+    0x3A, 0xBD, 0x59, 0x87, 0x72, 0xAA, 0xE4, 0x82, 0xAE, 0x3B, 0xD9, 0x8D, 0x4A, 0x6D, 0x6B, 0x02,
+    0x6C, 0xF2, 0xB3, 0xD5, 0xA8, 0x74, 0xBD, 0xEE, 0x3E, 0x6F, 0xCF, 0x4F, 0x4C, 0x57, 0x89, 0x60,
+    0x6B, 0xC1, 0x8E, 0x10, 0x8B, 0x4F, 0x2D, 0xAE, 0xE2, 0x59, 0xD3, 0xED, 0x39, 0x9E, 0x01, 0xF7,
+    0x4D, 0x5D, 0xA4, 0x7A, 0xFF, 0x0D, 0xFD, 0x5E, 0x15, 0x58, 0x61, 0x6A, 0xD0, 0x4E, 0x9B, 0x3D,
+    0x11, 0x60, 0x59, 0xCF, 0x00, 0x0C, 0xEE, 0x84, 0xAC, 0xF6, 0x43, 0x27, 0x5B, 0x4B, 0xDC, 0xAC,
+    0xC0, 0x6D, 0x2C, 0x2B, 0x54, 0xCC, 0xD2, 0x4A, 0xDB, 0xAC, 0xB0, 0xCD, 0xCA, 0xDA, 0xAC, 0x8E,
+    0xD0, 0x8A, 0x08, 0xAD, 0x82, 0xD0, 0xCA, 0x07, 0xAD, 0x76, 0xD0, 0x0A, 0x07, 0xAD, 0x6A, 0xD0,
+    0x4A, 0x06, 0xAD, 0x5E, 0xD0, 0x8A, 0x05, 0xAD, 0x52, 0xD0, 0xCA, 0x04, 0xAD, 0x46, 0xD0, 0x0A,
+    0x04, 0xAD, 0x3A, 0xD0, 0x4A, 0x03, 0xB5, 0x68, 0xCD, 0x4A, 0xD6, 0xAC, 0x60, 0x2D, 0x94, 0x03,
+    0x5E, 0xF8, 0x60, 0x92, 0xE8, 0x55, 0x76, 0x14, 0x6A, 0x11, 0xEA, 0x89, 0x4A, 0x2B, 0x4F, 0xFA,
+    0xC6, 0x5A, 0x49, 0xA6, 0x75, 0x64, 0x5A, 0x45, 0xA6, 0x35, 0x64, 0x5A, 0x41, 0xA6, 0xF5, 0x63,
+    0x5A, 0xED, 0xF5, 0x24, 0xAD, 0xD6, 0x89, 0x69, 0x95, 0x98, 0xD6, 0x88, 0x8D, 0x59, 0x9B, 0x50,
+    0xB9, 0x9A, 0xD7, 0x13, 0x8F, 0xDF, 0x2D, 0xA6, 0x11, 0x7E, 0xAA, 0x9B, 0x22, 0xFF, 0x67, 0x0A,
+    0x75, 0x47, 0x9F, 0x22, 0x3A, 0x8C, 0xD8, 0xED, 0x68, 0x77, 0x9D, 0x6E, 0x25, 0x7C, 0xB9, 0x09,
+    0x40, 0x90, 0x3C, 0x0A, 0xD7, 0x7E, 0xD5, 0xD0, 0x4B, 0x2D, 0x94, 0x3D, 0x54, 0x3F, 0xE1, 0xAE,
+    0xD6, 0x1A, 0xF7, 0xC4, 0xB5, 0xE3, 0x5E, 0xEB, 0x4F, 0xBB, 0xE8, 0x24, 0xA0, 0xDD, 0x3C, 0x12,
+    0xD0, 0x5E, 0x8C, 0x80, 0xF6, 0x92, 0x25, 0x6B, 0x53, 0x24, 0x7B, 0xFD, 0x35, 0x48, 0xB6, 0x69,
+    0xDE, 0x3E, 0x2C, 0xFB, 0xE6, 0x64, 0xC9, 0x7A, 0xB4, 0xD4, 0x8A, 0x5F, 0xC3, 0x52, 0x77, 0x5C,
+    0x6F, 0xCD, 0x75, 0xE8, 0xCF, 0xF9, 0x71, 0x37, 0xAE, 0xEC, 0x7B, 0x40, 0xB7, 0xCD, 0x74, 0x90,
+    0xAF, 0x63, 0x7D, 0x76, 0x08, 0x32, 0x8B, 0x72, 0x7C, 0xA4, 0xC5, 0x5E, 0x63, 0x2C, 0x56, 0xFE,
+    0xC9, 0xE3, 0xDD, 0xA2, 0x9B, 0x4E, 0x54, 0x64, 0x8C, 0xE5, 0x90, 0x69, 0x28, 0xDD, 0x36, 0x47,
+    0x76, 0x77, 0x8B, 0xBD, 0xBE, 0xD0, 0x38, 0xF8, 0x43, 0x15, 0x16, 0xF1, 0xA4, 0xC2, 0x22, 0x2B,
+    0x55, 0x05, 0x6B, 0xDD, 0xBE, 0x08, 0x37, 0xF6, 0xC3, 0xDF, 0xF2, 0x60, 0x0D, 0x13, 0x64, 0xA2,
+    0x21, 0x32, 0xE1, 0x81, 0x4C, 0xC4, 0xBF, 0x03, 0x32, 0x31, 0xFB, 0x35, 0x90, 0x89, 0xEC, 0x27,
+    0x40, 0x26, 0xE6, 0x44, 0x26, 0x76, 0x89, 0x4C, 0xDC, 0x20, 0x32, 0xD1, 0x03, 0x99, 0x88, 0x17,
+    0x40, 0x23, 0xF0, 0xBC, 0x97, 0x2F, 0xD3, 0x1A, 0x6D, 0x46, 0x64, 0x62, 0x97, 0xC8, 0xC4, 0x21,
+    0x91, 0x09, 0x68, 0xDA, 0xE2, 0x5F, 0x7B, 0x20, 0x13, 0xBF, 0x6A, 0x81, 0x4C, 0xFC, 0x57, 0x0D,
+    0x64, 0x82, 0xB6, 0x0B, 0xCA, 0x63, 0x44, 0x26, 0x3C, 0x90, 0x89, 0xE8, 0x7F, 0xB0, 0x43, 0x93,
+    0x0E, 0x09, 0xDA, 0xB8, 0x9C, 0xB8, 0x90, 0x74, 0x20, 0xB9, 0xC0, 0x4D, 0x70, 0x1D, 0x93, 0x76,
+    0xEB, 0x36, 0xC6, 0x12, 0xDB, 0xBC, 0x9D, 0x96, 0x22, 0xB2, 0x63, 0x20, 0x05, 0x9B, 0x11, 0x7E,
+    0xF0, 0x70, 0x97, 0x7C, 0x2D, 0x2E, 0xD4, 0x71, 0xDB, 0xB8, 0x0C, 0xF0, 0xC3, 0x35, 0xC0, 0x0F,
+    0x87, 0x40, 0x1E, 0x96, 0xD2, 0xC4, 0xE2, 0xF3, 0xF8, 0xA4, 0x95, 0x26, 0x2D, 0xB3, 0xAE, 0x99,
+    0x03, 0x7E, 0xD8, 0x01, 0xFC, 0xB0, 0x02, 0xFC, 0xD0, 0x07, 0xF8, 0x61, 0x46, 0x4C, 0xA3, 0x11,
+    0x33, 0x70, 0x0D, 0x7B, 0xE3, 0x35, 0x65, 0xFB, 0xDF, 0x7C, 0xA8, 0x82, 0x1C, 0xF4, 0x6C, 0x52,
+    0xAC, 0x49, 0x4F, 0x45, 0x13, 0xAD, 0x88, 0xEF, 0xB9, 0x43, 0xC5, 0xC5, 0xCF, 0xB9, 0xBD, 0xB3,
+    0x91, 0x1B, 0x7C, 0x17, 0x6B, 0x2E, 0xDA, 0x8D, 0xAD, 0x77, 0x86, 0xD5, 0xEA, 0x5A, 0xB9, 0xD2,
+    0xED, 0x3A, 0x9F, 0xB1, 0xBA, 0x8C, 0x95, 0x89, 0x73, 0xD5, 0x29, 0xC5, 0xB1, 0x32, 0x4A, 0x9D,
+    0xEC, 0x5E, 0x0B, 0xE7, 0x2E, 0x9D, 0x3C, 0xE7, 0x2F, 0x70, 0x7E, 0xF6, 0xC2, 0x03, 0x82, 0x37,
+    0x88, 0xE9, 0x8E, 0xE5, 0x8C, 0xAF, 0xF0, 0x1D, 0x80, 0x18, 0xA2, 0xFB, 0x2F, 0x7D, 0x1F, 0xEC,
+    0xBF, 0xF8, 0xFE, 0x55, 0x80, 0xA2, 0x4B, 0x30, 0x2A, 0x5E, 0xD3, 0xCD, 0xF8, 0x94, 0xC0, 0x7E,
+    0x41, 0x2E, 0xA7, 0xF5, 0x2E, 0x9F, 0x1B, 0x3A, 0x37, 0x79, 0x76, 0x92, 0xF1, 0x04, 0x5A, 0x19,
+    0x32, 0x52, 0x9F, 0x7E, 0x77, 0xD2, 0xBE, 0xC9, 0xF6, 0x95, 0x69, 0x64, 0xF0, 0xC8, 0x96, 0xDC,
+    0x54, 0xB3, 0xF6, 0x0D, 0x57, 0x86, 0x36, 0x2E, 0xF5, 0xB1, 0x20, 0x7D, 0x18, 0x48, 0x1F, 0x05,
+    0x8A, 0x98, 0xBE, 0xD0, 0xC7, 0x80, 0xF4, 0x21, 0xA0, 0x77, 0x61, 0x7B, 0x8B, 0x7F, 0xDA, 0x00,
+    0xEF, 0x62, 0xF2, 0x4D, 0x42, 0xA6, 0x68, 0x09, 0x34, 0xEE, 0x10, 0x5A, 0xF5, 0xDC, 0x68, 0x65,
+    0x69, 0x29, 0xA8, 0x8E, 0xFD, 0x2F, 0xD7, 0x30, 0x34, 0x03, 0xF8, 0x5C, 0xC1, 0x52, 0x17, 0xF5,
+    0x1C, 0xA0, 0x42, 0x8E, 0x40, 0x9A, 0xD1, 0xB4, 0x16, 0x90, 0xB0, 0x69, 0x83, 0xE7, 0x7C, 0x1A,
+    0x6C, 0xEB, 0x45, 0xA5, 0xC9, 0x2E, 0x98, 0x95, 0xF1, 0x00, 0x78, 0x8D, 0xD1, 0xC7, 0x9C, 0x78,
+    0xCC, 0xBE, 0x3E, 0x66, 0x4C, 0x1B, 0x4A, 0x04, 0xF4, 0x2B, 0xEC, 0xB9, 0x79, 0x89, 0x60, 0xF2,
+    0x4D, 0xB1, 0x13, 0xD4, 0xF1, 0x2F, 0x0E, 0x87, 0xF5, 0x71, 0x18, 0x02, 0xCB, 0xBE, 0x81, 0x49,
+    0x97, 0x63, 0x23, 0xA6, 0x64, 0x81, 0x4D, 0x1C, 0x98, 0xCB, 0xA7, 0xBF, 0x1B, 0x31, 0x37, 0xA2,
+    0xD3, 0xC5, 0x14, 0x2E, 0x84, 0xBD, 0x79, 0x2B, 0x4E, 0x6E, 0x81, 0xE4, 0x4A, 0xC5, 0xF0, 0x06,
+    0x91, 0x1B, 0xAB, 0x7E, 0x30, 0xA8, 0x35, 0xE3, 0x6C, 0xFC, 0xF8, 0x4C, 0x4E, 0x65, 0xC0, 0xE6,
+    0x39, 0xEC, 0xEE, 0x57, 0x64, 0x9F, 0xC3, 0x61, 0xA6, 0x83, 0xA8, 0x75, 0x3A, 0x22, 0x45, 0x88,
+    0xBC, 0xF8, 0xD9, 0x5A, 0x04, 0x7E, 0x4F, 0x1C, 0x85, 0xA2, 0x8C, 0x21, 0xEE, 0x23, 0x91, 0xF6,
+    0x4B, 0x3A, 0x1F, 0x04, 0xA1, 0x0C, 0x44, 0x11, 0x82, 0xE2, 0xBC, 0x3F, 0xED, 0x5F, 0x19, 0x37,
+    0x6A, 0xFC, 0xFB, 0x98, 0x16, 0xE7, 0x22, 0xBB, 0x0F, 0x9B, 0x6F, 0xD6, 0x4F, 0xE6, 0x72, 0x6E,
+    0xE2, 0xDE, 0x21, 0x30, 0x3F, 0xB0, 0xEF, 0xC6, 0x8F, 0xF9, 0x0B, 0xA8, 0x53, 0x14, 0x0B, 0xEA,
+    0x71, 0xA2, 0x7B, 0x72, 0xAC, 0x17, 0xF9, 0xF1, 0x72, 0xD7, 0x1D, 0xDD, 0x70, 0x3B, 0x97, 0x18,
+    0xB5, 0x3D, 0xF5, 0x67, 0x0E, 0x44, 0x4F, 0x67, 0xBE, 0x13, 0xFD, 0x7C, 0xE8, 0x56, 0x9F, 0xE0,
+    0x2E, 0x97, 0x9E, 0xC2, 0x03, 0x07, 0x1F, 0x5D, 0x80, 0x8F, 0xD0, 0x50, 0x17, 0x17, 0x7F, 0xBD,
+    0x26, 0x54, 0x7F, 0x8B, 0x0E, 0x50, 0x8E, 0x94, 0xC9, 0x92, 0xA6, 0xF8, 0xD2, 0x96, 0x75, 0x2F,
+    0xC8, 0x03, 0x07, 0xDF, 0x4D, 0x09, 0x3D, 0xBB, 0x07, 0x0E, 0xAE, 0xF0, 0x59, 0x50, 0xE2, 0x00,
+    0xCA, 0x84, 0xA4, 0x03, 0x87, 0x67, 0x35, 0x5C, 0xB2, 0xC8, 0xBD, 0x70, 0x7C, 0x56, 0x7B, 0x8A,
+    0xE8, 0xDC, 0x35, 0x80, 0x48, 0x90, 0x7A, 0x11, 0x45, 0xD4, 0x9F, 0xB0, 0xA7, 0xCF, 0x92, 0xC5,
+    0x57, 0xEB, 0x8F, 0x68, 0x10, 0x1A, 0x22, 0x2A, 0x05, 0xAB, 0x6A, 0x99, 0x7C, 0x3A, 0xA2, 0x55,
+    0xCD, 0xE9, 0xD6, 0x9C, 0xDF, 0xBA, 0x33, 0xA2, 0xE7, 0x3F, 0x50, 0x9D, 0x5F, 0x43, 0xDB, 0xCF,
+    0x97, 0x5B, 0xB4, 0xCB, 0xAA, 0x2B, 0xFF, 0xE0, 0x8F, 0x5A, 0x07, 0xBD, 0x1E, 0xFC, 0xF2, 0xB7,
+    0x89, 0x53, 0x11, 0xF8, 0xF3, 0x4C, 0x5E, 0xF9, 0xC8, 0x8F, 0x68, 0x92, 0x67, 0xA2, 0xC2, 0x33,
+    0xCF, 0xA0, 0xD9, 0x78, 0x4F, 0xE0, 0xDF, 0x33, 0xE1, 0x41, 0xAC, 0x8B, 0x15, 0x98, 0x1D, 0x30,
+    0xB4, 0x7C, 0x80, 0x05, 0xBB, 0xE0, 0xB9, 0x22, 0xB2, 0x27, 0xED, 0x59, 0xB4, 0x82, 0xE5, 0xAC,
+    0x51, 0x72, 0x70, 0x3D, 0xEA, 0xC7, 0xC7, 0x1E, 0x8C, 0xD1, 0xC5, 0x3A, 0xF3, 0xE5, 0x95, 0x4D,
+    0x21, 0x96, 0x67, 0xF8, 0x44, 0x44, 0xDA, 0x74, 0xF8, 0x47, 0x1E, 0xED, 0xAB, 0x66, 0xFE, 0xE8,
+    0x9C, 0x35, 0xEE, 0xBB, 0x36, 0x58, 0xD3, 0x15, 0xFF, 0x25, 0x8B, 0x5E, 0x46, 0x53, 0x3A, 0x9B,
+    0x9A, 0x52, 0xA7, 0xA6, 0xF4, 0xCF, 0x69, 0x4A, 0xCF, 0xBD, 0x38, 0xCC, 0xD5, 0x03, 0xD9, 0x10,
+    0x32, 0x94, 0x41, 0x92, 0x85, 0xB8, 0x9E, 0x49, 0x1B, 0x77, 0x27, 0xCE, 0xA2, 0x6C, 0x74, 0xDF,
+    0x17, 0x1B, 0x77, 0xB0, 0x94, 0xE5, 0x27, 0x5F, 0x76, 0xD4, 0xC9, 0xFC, 0xB7, 0x0A, 0x37, 0xD4,
+    0x79, 0xA6, 0xEF, 0xBA, 0xAD, 0xED, 0xFB, 0xB6, 0x0D, 0x97, 0x40, 0xB8, 0x54, 0xD7, 0xA4, 0xBE,
+    0x20, 0xB6, 0x6D, 0xCB, 0x4B, 0x14, 0xB2, 0xD8, 0x68, 0x9D, 0x47, 0xA1, 0xC0, 0x60, 0x56, 0x1F,
+    0x2A, 0xE6, 0x7F, 0xEE, 0x4C, 0xD5, 0x48, 0xC7, 0x1F, 0xA2, 0xD2, 0x5D, 0x96, 0x8C, 0xB5, 0xDE,
+    0x63, 0x9A, 0xFA, 0xA4, 0x35, 0x62, 0x01, 0x4C, 0x19, 0x3D, 0x5F, 0xF5, 0xEE, 0x11, 0xEB, 0xC4,
+    0x5C, 0xAA, 0xC8, 0xC9, 0xFC, 0x2B, 0x4A, 0xE8, 0xBA, 0x96, 0xB6, 0xEF, 0xC0, 0x4D, 0x84, 0xE9,
+    0x3C, 0x5B, 0x82, 0xB2, 0xFC, 0x65, 0xC4, 0x84, 0x46, 0x32, 0x78, 0x17, 0x9E, 0x21, 0x4B, 0x4B,
+    0x60, 0x5E, 0x91, 0x7B, 0xCE, 0x44, 0xA4, 0x91, 0xAD, 0x9C, 0x67, 0x7F, 0x8C, 0x58, 0x4E, 0xBE,
+    0x21, 0xA7, 0xAA, 0x2A, 0xE7, 0x2C, 0x3E, 0xAF, 0xC5, 0x1E, 0x88, 0x89, 0x78, 0x49, 0xA3, 0x08,
+    0x0D, 0x25, 0xFA, 0xF0, 0x8F, 0x08, 0xF8, 0x6C, 0x8A, 0xAE, 0x93, 0x41, 0x4A, 0xCC, 0x33, 0x9A,
+    0xFB, 0xF1, 0x69, 0xE9, 0x8A, 0x5F, 0xEA, 0xCE, 0xC1, 0x3C, 0x5D, 0x43, 0x53, 0x58, 0x33, 0x37,
+    0x1B, 0x85, 0x78, 0x31, 0x1D, 0xFE, 0x91, 0xB5, 0xC0, 0xEF, 0x4D, 0xFE, 0x21, 0x93, 0x8B, 0x3E,
+    0x1C, 0x55, 0x00, 0xE1, 0x98, 0x3E, 0x60, 0x32, 0x04, 0x12, 0x23, 0xD3, 0x39, 0x91, 0xB8, 0x09,
+    0xE9, 0x67, 0x55, 0x9B, 0xD7, 0x18, 0x75, 0x86, 0xDF, 0x16, 0xE0, 0x25, 0xF3, 0x6A, 0x2B, 0x6C,
+    0xBB, 0x4E, 0xE7, 0x87, 0x92, 0x8D, 0x08, 0x53, 0xC4, 0xE4, 0x67, 0xFD, 0x5F, 0xCA, 0xA8, 0xBB,
+    0x32, 0xE8, 0x2D, 0xA4, 0xA6, 0xF0, 0x18, 0xC1, 0x67, 0x4D, 0x3D, 0xC3, 0x75, 0x21, 0xFF, 0x72,
+    0xF1, 0x3D, 0xCC, 0x51, 0x61, 0xDD, 0xC2, 0xB0, 0xBC, 0x43, 0xC5, 0xF2, 0x0A, 0xE2, 0x80, 0xD6,
+    0x96, 0xF3, 0x6E, 0xD6, 0xEF, 0x8A, 0xED, 0x89, 0xFA, 0x1D, 0xC4, 0x58, 0xD6, 0xFE, 0x15, 0xDA,
+    0x8F, 0x43, 0xDE, 0xE2, 0x8F, 0xDD, 0xB2, 0x74, 0xED, 0xA2, 0x97, 0x28, 0x1E, 0x59, 0xC2, 0x53,
+    0x95, 0x42, 0xEE, 0x47, 0xF5, 0x36, 0x21, 0xAC, 0xC0, 0x6E, 0x31, 0x81, 0x27, 0x6F, 0x6C, 0x21,
+    0xCA, 0xD7, 0x2D, 0xA5, 0x72, 0xA8, 0xBB, 0x1F, 0xCC, 0xCF, 0x59, 0x8B, 0xE7, 0x59, 0x83, 0xFE,
+    0x58, 0xBF, 0x9B, 0x90, 0x74, 0xFF, 0xA2, 0x94, 0xC1, 0xCA, 0xB1, 0xBC, 0x04, 0xB0, 0x1B, 0x74,
+    0x37, 0x0C, 0x35, 0x9E, 0xB7, 0xCB, 0xED, 0xDE, 0xA3, 0xA1, 0x86, 0x33, 0x94, 0xFA, 0x3B, 0x03,
+    0xCE, 0x52, 0x53, 0xA3, 0xA8, 0x83, 0xFE, 0xCD, 0x82, 0xFF, 0x32, 0xEB, 0xBA, 0x81, 0xEE, 0xC4,
+    0x02, 0xC8, 0x03, 0x9A, 0x83, 0xC6, 0x8A, 0x58, 0x22, 0xB8, 0x59, 0x07, 0x60, 0xC4, 0xAD, 0xB7,
+    0x86, 0xD1, 0x18, 0xE7, 0x5D, 0xC0, 0xEA, 0x59, 0x0E, 0xC8, 0x26, 0x1D, 0x29, 0x7E, 0xC0, 0x9D,
+    0x8D, 0xDA, 0x0B, 0x62, 0xA5, 0xAC, 0xB0, 0x40, 0xB2, 0x8D, 0x65, 0x37, 0x57, 0x64, 0xF6, 0x17,
+    0x90, 0x31, 0x2E, 0xE0, 0xCE, 0xFD, 0x58, 0xB3, 0x75, 0x7B, 0x08, 0xF3, 0xCA, 0xEC, 0xF7, 0x07,
+    0x1D, 0xFE, 0xD3, 0x47, 0x21, 0x11, 0xBA, 0xFC, 0xAE, 0x5F, 0xDD, 0x06, 0x40, 0x2B, 0x05, 0x5F,
+    0xF2, 0x8E, 0x07, 0xF1, 0x40, 0xD8, 0x31, 0x1C, 0x74, 0xAE, 0x44, 0x9A, 0x82, 0x9B, 0x7B, 0x70,
+    0x63, 0x11, 0x41, 0xA8, 0x48, 0x88, 0x2C, 0x00, 0xC4, 0xDC, 0xA0, 0x48, 0x64, 0xE7, 0x5E, 0x81,
+    0x1D, 0xEE, 0xF8, 0x80, 0xF3, 0x8F, 0xED, 0x59, 0x80, 0x97, 0x55, 0x84, 0x7C, 0x62, 0x88, 0xF5,
+    0xA1, 0xA8, 0x10, 0xED, 0x14, 0x03, 0xAF, 0x35, 0xA0, 0x7C, 0xE4, 0x3F, 0x96, 0x1A, 0xB3, 0xAD,
+    0x6B, 0x4B, 0xBA, 0x86, 0x8C, 0xEB, 0x36, 0x33, 0xF8, 0x78, 0x1D, 0x83, 0xE3, 0xB1, 0x7B, 0xC2,
+    0xC1, 0x9C, 0x45, 0x75, 0x90, 0x01, 0xAC, 0xBF, 0x46, 0x77, 0xC4, 0x2B, 0xBE, 0xF5, 0xE3, 0xDF,
+    0xDF, 0xBD, 0xC6, 0x92, 0x5E, 0xF8, 0x40, 0x90, 0x6F, 0xA8, 0xA0, 0xD0, 0x87, 0x05, 0x0B, 0x74,
+    0xDA, 0x78, 0x73, 0x52, 0xB3, 0x3E, 0xB1, 0x62, 0xD6, 0xE4, 0x6B, 0x8E, 0xD0, 0xF8, 0x3E, 0x52,
+    0xE0, 0x7E, 0xFD, 0x7F, 0xAD, 0x56, 0x4D, 0x6C, 0x24, 0x47, 0x15, 0xFE, 0xAA, 0xDB, 0x9E, 0xCE,
+    0xA6, 0x95, 0x69, 0x1F, 0xC6, 0x60, 0x36, 0x6B, 0x37, 0x07, 0x1F, 0x4C, 0x94, 0xD9, 0xBE, 0xE4,
+    0xE0, 0x48, 0xE3, 0xE9, 0x72, 0x22, 0xE0, 0x80, 0x10, 0x3E, 0x78, 0x84, 0x04, 0x12, 0xF8, 0x90,
+    0x03, 0xB1, 0x12, 0xB2, 0x48, 0x3E, 0x4C, 0xA4, 0xB1, 0xA7, 0x93, 0x03, 0x48, 0xE4, 0x32, 0x0A,
+    0x12, 0x5C, 0x7D, 0x48, 0x00, 0xCF, 0x82, 0x76, 0x0E, 0x20, 0xE5, 0x60, 0x76, 0x5A, 0x41, 0x88,
+    0x0B, 0x87, 0x16, 0x42, 0xE2, 0xDA, 0x42, 0x41, 0x20, 0x71, 0x29, 0xA4, 0x5E, 0x69, 0x70, 0x7A,
+    0xA6, 0xF8, 0x5E, 0xCF, 0x4C, 0x36, 0xDE, 0x65, 0xE1, 0x42, 0xD5, 0xAB, 0xAE, 0xA9, 0xAA, 0x57,
+    0x3F, 0xEF, 0xBD, 0xEF, 0xBD, 0x37, 0xCF, 0x25, 0x08, 0x73, 0xF8, 0x06, 0xCE, 0x04, 0x38, 0x05,
+    0x42, 0x40, 0x01, 0x43, 0x67, 0xEA, 0x16, 0x41, 0x16, 0xEA, 0x16, 0xD6, 0x38, 0x82, 0xB2, 0x89,
+    0x6B, 0x33, 0xFF, 0x6F, 0x26, 0xDC, 0x9F, 0xEC, 0x61, 0x6F, 0x0D, 0x2B, 0x6A, 0x40, 0xDE, 0x29,
+    0xF2, 0xD8, 0xFE, 0x31, 0xEB, 0x86, 0x36, 0xBD, 0xE3, 0x58, 0x80, 0xCC, 0xEB, 0x9D, 0xC3, 0xBE,
+    0x9D, 0x92, 0x8E, 0x87, 0xC3, 0x8B, 0xB1, 0xB5, 0x33, 0xE9, 0x77, 0xF1, 0x7C, 0x0B, 0xAD, 0xE8,
+    0xC7, 0x93, 0xC0, 0x1A, 0xD7, 0xA6, 0x68, 0x60, 0x15, 0x71, 0x2A, 0x35, 0x4A, 0x80, 0xDB, 0xF8,
+    0xA0, 0xBF, 0x3F, 0x25, 0xC5, 0x28, 0x57, 0xB0, 0x56, 0xFB, 0x39, 0x62, 0xAB, 0x5F, 0x0C, 0xD3,
+    0x35, 0x3F, 0x45, 0x90, 0xAA, 0x31, 0x9C, 0x02, 0x4E, 0x0E, 0x95, 0x41, 0xBD, 0x87, 0xC0, 0xA2,
+    0xFD, 0xCD, 0xB4, 0xE7, 0x66, 0x5D, 0x47, 0xA8, 0xED, 0xA7, 0xA1, 0xD5, 0x9C, 0x57, 0x17, 0x4F,
+    0xBF, 0xE7, 0x96, 0x81, 0xF1, 0x4D, 0x9C, 0x06, 0x59, 0x1F, 0x91, 0x2E, 0x71, 0xEA, 0x18, 0xBE,
+    0x48, 0xE3, 0x15, 0x7C, 0xAE, 0x8D, 0xCB, 0xE0, 0xC3, 0xC2, 0xFB, 0x38, 0x77, 0x78, 0xBD, 0xD5,
+    0x58, 0xC7, 0x4E, 0x4B, 0xCA, 0xCE, 0xD1, 0x8D, 0x22, 0x5C, 0xD6, 0xA3, 0x1B, 0xC7, 0x2F, 0xF1,
+    0xF2, 0x74, 0x0A, 0x39, 0xC1, 0x33, 0x51, 0xA2, 0x26, 0x7C, 0x43, 0x8F, 0xC7, 0xAC, 0xE0, 0x80,
+    0xE2, 0xE1, 0x3E, 0x60, 0x85, 0x1A, 0xA7, 0x0D, 0x0A, 0xC4, 0x43, 0x43, 0x5B, 0xF8, 0x36, 0xC7,
+    0xAB, 0x50, 0xF7, 0x35, 0x7F, 0x44, 0x76, 0xC2, 0x49, 0x2E, 0x51, 0x43, 0x78, 0x0A, 0x97, 0x6E,
+    0x16, 0x60, 0x0B, 0x6D, 0xC4, 0x49, 0x6C, 0x62, 0x13, 0x19, 0x2F, 0x71, 0x06, 0xC1, 0x24, 0x28,
+    0x83, 0xD2, 0x29, 0x71, 0x89, 0x5F, 0xC1, 0x78, 0x69, 0x8C, 0x6D, 0xD4, 0x92, 0xC8, 0x08, 0x47,
+    0x9C, 0xB4, 0xC9, 0x1F, 0xC0, 0xCD, 0x50, 0x62, 0xE3, 0x3F, 0xF3, 0x1E, 0x6B, 0x4A, 0x98, 0xBB,
+    0x86, 0x1C, 0x4D, 0xDA, 0xE1, 0xC2, 0x2D, 0x7D, 0x13, 0xA4, 0x11, 0xBA, 0x62, 0xAA, 0x01, 0x4C,
+    0xC7, 0x58, 0x33, 0x34, 0x60, 0x3D, 0xE2, 0xE7, 0x81, 0xB6, 0xE6, 0xEA, 0x5C, 0x86, 0xC7, 0xC3,
+    0x64, 0x6C, 0xB3, 0xCE, 0xD7, 0x33, 0x38, 0x8F, 0x11, 0xE0, 0xE6, 0x41, 0x11, 0x4C, 0xDC, 0x42,
+    0x19, 0x87, 0xF7, 0x9C, 0x55, 0xE2, 0x7A, 0x59, 0x94, 0xEE, 0x81, 0xD2, 0x60, 0x0F, 0x61, 0x2A,
+    0x6C, 0x6E, 0x2A, 0xF5, 0xB3, 0x7F, 0x1A, 0xCF, 0x8E, 0x2F, 0x80, 0xF1, 0x6C, 0x3C, 0x9B, 0xCF,
+    0x38, 0x89, 0x93, 0x48, 0xBF, 0x9C, 0x71, 0x92, 0x4E, 0xC7, 0xDA, 0xE1, 0x10, 0x3B, 0xD5, 0x76,
+    0xA9, 0xBD, 0x9F, 0x4E, 0xC6, 0x45, 0x3F, 0x5F, 0xC5, 0x39, 0xCC, 0xA2, 0x16, 0xB8, 0xFF, 0x9D,
+    0xFE, 0x24, 0x2A, 0x94, 0xDE, 0xA2, 0xD6, 0xFB, 0x84, 0xC3, 0xD6, 0xA3, 0x60, 0x50, 0x87, 0x62,
+    0xF1, 0xF8, 0xDB, 0x69, 0xCB, 0x15, 0xDA, 0xF3, 0xC4, 0xDC, 0xDE, 0x14, 0x37, 0x93, 0x28, 0x8D,
+    0x74, 0xCC, 0x87, 0x89, 0xD8, 0x0A, 0x9E, 0xF6, 0x73, 0xBF, 0xA4, 0x7D, 0x62, 0xD6, 0x99, 0x2D,
+    0xC7, 0x39, 0x15, 0xE6, 0x11, 0x3F, 0x9A, 0xE3, 0x8A, 0x34, 0xA2, 0xBF, 0x26, 0x81, 0x4D, 0x1D,
+    0x9B, 0xCC, 0x4D, 0xDF, 0x58, 0xEF, 0x74, 0xB4, 0xB5, 0xD6, 0x48, 0x9B, 0xD2, 0xDC, 0x05, 0x94,
+    0x31, 0x80, 0xA1, 0xE8, 0x07, 0x83, 0xED, 0x5A, 0xBE, 0xEB, 0x9B, 0xCB, 0x3A, 0x91, 0x1C, 0xBE,
+    0x5D, 0xBC, 0x82, 0x4D, 0x41, 0xD0, 0x6F, 0x8D, 0x67, 0x33, 0x01, 0x30, 0x41, 0xD0, 0x10, 0x34,
+    0x28, 0xAB, 0x39, 0x0C, 0xFE, 0x6C, 0xA2, 0xFD, 0x49, 0x8F, 0x8F, 0xC1, 0x0A, 0x0D, 0x7F, 0x0D,
+    0x19, 0x43, 0xA0, 0x03, 0xEE, 0xE2, 0x30, 0xDE, 0x2F, 0xB9, 0xB4, 0x8D, 0x8D, 0xDA, 0x47, 0x38,
+    0x88, 0x66, 0x2A, 0x6F, 0x8F, 0xFF, 0x91, 0x9E, 0x04, 0x36, 0x39, 0x52, 0x33, 0x01, 0xD7, 0xDC,
+    0x6F, 0x30, 0x2F, 0x76, 0x51, 0xE4, 0x77, 0xA7, 0x23, 0xDA, 0xB4, 0x56, 0xDC, 0x09, 0x8F, 0xAC,
+    0x53, 0x88, 0xC3, 0x6B, 0xBE, 0x18, 0xD9, 0x74, 0xB4, 0xF0, 0x45, 0xBA, 0xDE, 0x80, 0x7B, 0x72,
+    0xE9, 0xD9, 0xE6, 0x0E, 0x39, 0x77, 0x49, 0xFE, 0xAE, 0x1C, 0x9D, 0x76, 0xA5, 0x1D, 0x13, 0xF8,
+    0xF4, 0xFE, 0x3E, 0xA1, 0xC0, 0xEB, 0xA3, 0xBC, 0xD2, 0x16, 0x01, 0x5C, 0x95, 0x23, 0x36, 0x2E,
+    0xD2, 0x5C, 0xA0, 0x1F, 0x08, 0x32, 0x45, 0xAF, 0x08, 0xE8, 0xB8, 0x01, 0xA7, 0x23, 0x36, 0xCA,
+    0x8D, 0xDE, 0xFF, 0x9D, 0x6D, 0xA7, 0xBA, 0xFE, 0x94, 0xBE, 0xE3, 0x55, 0x18, 0x23, 0xFA, 0x75,
+    0x85, 0x71, 0x2D, 0x46, 0x12, 0x63, 0x95, 0x70, 0xCD, 0xD2, 0x80, 0x54, 0xD1, 0xC1, 0xD2, 0xA0,
+    0x0F, 0x3A, 0x9D, 0xCA, 0x90, 0xCB, 0x26, 0x73, 0x94, 0xF8, 0xBC, 0xB6, 0x7F, 0x1E, 0x7F, 0x3C,
+    0xFD, 0xF5, 0xD9, 0xB7, 0xF2, 0x96, 0x9F, 0x3F, 0xEF, 0x03, 0xBB, 0xB7, 0xDA, 0xA7, 0x61, 0xE1,
+    0xE7, 0xE1, 0xE4, 0xF4, 0x74, 0x7B, 0x43, 0x25, 0x21, 0xE1, 0x2E, 0x66, 0x8C, 0x19, 0x77, 0xBC,
+    0xCC, 0xCD, 0x7C, 0x5E, 0xD9, 0x78, 0xCC, 0x1C, 0x52, 0x44, 0x83, 0x32, 0x96, 0xE8, 0x36, 0x14,
+    0x87, 0xCC, 0xE8, 0x90, 0x13, 0x6E, 0x5D, 0x51, 0x43, 0xB7, 0xF4, 0x2A, 0x87, 0xEC, 0x09, 0x32,
+    0x9F, 0x60, 0x9A, 0xDB, 0xE8, 0x27, 0xDC, 0x95, 0xFA, 0x49, 0x40, 0x04, 0x2F, 0x8A, 0x5B, 0x50,
+    0x1B, 0x13, 0xDC, 0x26, 0x14, 0xE3, 0x2F, 0xFF, 0xA5, 0x8C, 0xDF, 0xF9, 0xB0, 0x8C, 0xFD, 0xB7,
+    0xCA, 0x15, 0x5F, 0xA4, 0x06, 0x63, 0x56, 0x7F, 0x5E, 0xCF, 0x63, 0x53, 0xD3, 0xFF, 0x0D, 0xBD,
+    0xFF, 0x0B, 0x30, 0xD7, 0x83, 0x1E, 0xD7, 0x18, 0x32, 0x16, 0x3E, 0x79, 0x0E, 0x95, 0x40, 0xFD,
+    0x28, 0x43, 0x68, 0x93, 0x87, 0xAF, 0x8E, 0xF9, 0xEA, 0xEE, 0x1A, 0xAA, 0x77, 0xAC, 0x8A, 0x9D,
+    0x92, 0x79, 0x0B, 0x75, 0x75, 0x76, 0xF0, 0x2F, 0x91, 0xF0, 0xDD, 0xEC, 0xCD, 0x3E, 0x79, 0xBD,
+    0x85, 0x92, 0x64, 0x6D, 0xC9, 0xC7, 0x3D, 0x4F, 0xD2, 0xC4, 0x93, 0xE6, 0x45, 0x1F, 0x48, 0x83,
+    0xA1, 0x89, 0x6D, 0xC9, 0xB0, 0xEA, 0x23, 0x77, 0x90, 0x54, 0x07, 0x3B, 0x49, 0x60, 0xE2, 0xD2,
+    0xCB, 0x96, 0xB5, 0x5F, 0xD0, 0x07, 0xC3, 0xE9, 0xA2, 0x7B, 0xF3, 0x80, 0x0E, 0xB7, 0xFA, 0xFA,
+    0x5C, 0xA9, 0xCD, 0x6E, 0xE5, 0xA8, 0xEC, 0xEA, 0xAD, 0x11, 0xC3, 0x25, 0xEA, 0x8D, 0x91, 0x1C,
+    0x9C, 0x0A, 0xF1, 0x20, 0x21, 0xC6, 0x69, 0x30, 0xAC, 0xAE, 0x6D, 0xB2, 0xEB, 0xAE, 0x74, 0x05,
+    0xF6, 0x6B, 0x4D, 0x11, 0x16, 0x2B, 0xCD, 0x6E, 0x4B, 0x0E, 0x69, 0x76, 0xB7, 0xD9, 0x6D, 0x34,
+    0x17, 0x67, 0x6E, 0x57, 0x9C, 0x1B, 0x90, 0xEE, 0x05, 0x0A, 0xA6, 0x85, 0x96, 0x67, 0xAA, 0xAF,
+    0xE2, 0x7B, 0x1A, 0x8B, 0xFB, 0xBA, 0x15, 0x8A, 0x9B, 0x0F, 0xDF, 0x22, 0xDD, 0xF5, 0xE7, 0x8A,
+    0x83, 0x9D, 0x21, 0x2C, 0xD4, 0xD4, 0x9B, 0x46, 0x59, 0x97, 0x71, 0x57, 0x25, 0x04, 0x8F, 0x9E,
+    0x07, 0xCD, 0x28, 0x61, 0xFE, 0x01, 0xD3, 0xCB, 0x3C, 0x82, 0xCC, 0x73, 0xCB, 0xF6, 0xE9, 0xC6,
+    0x3C, 0x0B, 0x49, 0x3A, 0x92, 0xB2, 0x7B, 0xEB, 0xEC, 0x37, 0x02, 0xE3, 0xA8, 0x82, 0x31, 0x27,
+    0x6E, 0x80, 0xE3, 0xBE, 0xEE, 0x67, 0x44, 0x53, 0x53, 0x94, 0xFF, 0xE8, 0x1D, 0x52, 0xBA, 0x20,
+    0xBC, 0x33, 0x02, 0x7D, 0x1A, 0x66, 0xCE, 0x34, 0x32, 0xE1, 0xA4, 0x65, 0xCE, 0xF0, 0x41, 0x97,
+    0x59, 0x83, 0x41, 0x2A, 0x46, 0x98, 0xCC, 0xBD, 0x2E, 0x62, 0x4E, 0x12, 0x2D, 0x8E, 0x99, 0x37,
+    0xAD, 0xEE, 0xA3, 0xF2, 0xDE, 0xCF, 0x9B, 0x64, 0xEF, 0x67, 0xE9, 0xB3, 0x33, 0x7D, 0xF3, 0x4A,
+    0x9F, 0xDD, 0xCD, 0xB6, 0xFF, 0x99, 0x70, 0x52, 0x1D, 0x1C, 0x22, 0xBC, 0xB2, 0x7A, 0xEF, 0x8D,
+    0x9F, 0xA4, 0xDD, 0x80, 0xF9, 0x99, 0xAD, 0x17, 0xBE, 0x9C, 0xC5, 0xD6, 0xA6, 0xBE, 0x99, 0x31,
+    0xA2, 0x34, 0x29, 0x53, 0x3C, 0xED, 0x97, 0xEC, 0xBA, 0x55, 0x64, 0xA9, 0x4A, 0x6B, 0x8E, 0xFE,
+    0x34, 0x98, 0x83, 0x89, 0x79, 0x67, 0xEE, 0xF9, 0x55, 0x58, 0xE4, 0x5F, 0x13, 0x44, 0xB3, 0xF7,
+    0xEF, 0x5A, 0x5A, 0xCA, 0x21, 0x7E, 0x25, 0x7A, 0xA0, 0x76, 0xEF, 0x02, 0x0F, 0xCB, 0x63, 0xFB,
+    0x73, 0xE9, 0x2F, 0x81, 0x19, 0xED, 0xF2, 0xAC, 0xEC, 0xB7, 0xC3, 0x7B, 0xD7, 0xF6, 0xAF, 0x0E,
+    0xDF, 0xE7, 0x37, 0x16, 0x7F, 0x28, 0xE7, 0xDF, 0x75, 0xF1, 0x99, 0xC3, 0xC7, 0x67, 0x3E, 0xB9,
+    0x64, 0x3C, 0x23, 0x50, 0x9D, 0xD4, 0xE3, 0xD2, 0x80, 0x9A, 0x0B, 0x07, 0x9F, 0x61, 0x82, 0x1B,
+    0xCB, 0xDD, 0x35, 0x32, 0x0B, 0x10, 0x50, 0x1B, 0x92, 0x05, 0x37, 0xED, 0x95, 0x78, 0x85, 0x30,
+    0x4A, 0x30, 0x8F, 0xAF, 0x3A, 0xDF, 0x60, 0xC6, 0x50, 0xF2, 0xDB, 0x2B, 0xAA, 0x68, 0x27, 0x31,
+    0x6E, 0xAB, 0x3A, 0xD4, 0xD7, 0x3B, 0x0B, 0x48, 0x3F, 0x94, 0x46, 0xA5, 0xCF, 0x49, 0x74, 0x31,
+    0xD5, 0x2B, 0x26, 0xD5, 0xB7, 0xA8, 0xE6, 0x2B, 0xAD, 0x28, 0xBD, 0xE0, 0x3A, 0x40, 0xB3, 0x87,
+    0x9D, 0x5B, 0x20, 0x0C, 0x6F, 0xFE, 0x12, 0x27, 0x9B, 0x18, 0x6D, 0xE2, 0xE4, 0x75, 0x84, 0x3F,
+    0xD4, 0x5C, 0xAA, 0xBF, 0x86, 0x56, 0x1D, 0xBB, 0x3E, 0x45, 0x94, 0x97, 0xED, 0x92, 0xAB, 0x26,
+    0xA1, 0xE5, 0x29, 0xF1, 0x01, 0xDA, 0xB2, 0x87, 0x5B, 0x9F, 0xD4, 0x4D, 0xC6, 0x7F, 0x6E, 0xD9,
+    0x7A, 0x0D, 0x2F, 0xF8, 0xB8, 0xE3, 0x61, 0xE4, 0x69, 0xD2, 0x89, 0x2F, 0x27, 0xF8, 0x05, 0x1A,
+    0xAB, 0xBA, 0xE9, 0xA5, 0xCF, 0x38, 0x9F, 0x22, 0x6A, 0xDA, 0x4B, 0x9D, 0x07, 0xB9, 0xD2, 0xCD,
+    0xEE, 0x9D, 0x9D, 0x51, 0x15, 0x37, 0x46, 0xD8, 0xDD, 0xF0, 0x73, 0x7C, 0xA1, 0x8A, 0xE3, 0x01,
+    0x56, 0xBF, 0x86, 0xF6, 0x18, 0xA3, 0x10, 0x26, 0x58, 0xD0, 0x88, 0x81, 0x2E, 0x42, 0xF8, 0xFB,
+    0xE4, 0x55, 0x79, 0x32, 0x9E, 0x21, 0x35, 0x50, 0xBF, 0xA7, 0x03, 0xF7, 0xDA, 0xE1, 0x5B, 0x4E,
+    0xFA, 0xC6, 0xDB, 0x79, 0x63, 0x5D, 0xE9, 0xF0, 0xEE, 0xD0, 0xF8, 0xFB, 0xF9, 0x89, 0xAF, 0xB2,
+    0xDD, 0x47, 0x5B, 0x34, 0xF8, 0xA8, 0xDD, 0x68, 0x60, 0xEB, 0x1E, 0xFC, 0x2F, 0x81, 0x81, 0xFC,
+    0xD3, 0x14, 0x9D, 0x8B, 0x29, 0x50, 0xD7, 0xD1, 0xA0, 0x8E, 0x65, 0x15, 0x50, 0xAC, 0xAB, 0x83,
+    0xE8, 0xA5, 0xBC, 0xAE, 0x52, 0xDF, 0xD1, 0xEE, 0xCB, 0x70, 0x7F, 0x07, 0xF5, 0x87, 0x2A, 0x1B,
+    0xDD, 0xC1, 0xFA, 0x17, 0x75, 0xF8, 0x83, 0x81, 0xFB, 0x7D, 0xA8, 0xBF, 0x83, 0x7F, 0x1C, 0xF0,
+    0x0B, 0xB8, 0x01, 0x9E, 0x76, 0x93, 0xEF, 0x7E, 0x25, 0xFF, 0x37, 0xED, 0x7D, 0x3D, 0x90, 0xE5,
+    0xD6, 0x75, 0x26, 0x7E, 0x66, 0x06, 0x2A, 0xA2, 0x2C, 0x30, 0x20, 0x5D, 0x5A, 0x8D, 0x45, 0x28,
+    0x50, 0xA0, 0xE2, 0x4F, 0x63, 0x83, 0x0D, 0x18, 0x74, 0x0F, 0x40, 0xBB, 0xCA, 0xA9, 0x27, 0x60,
+    0x8B, 0x55, 0x66, 0x30, 0x4E, 0x36, 0xB0, 0x36, 0xE8, 0xC4, 0x01, 0x83, 0x1E, 0x02, 0x96, 0x03,
+    0x05, 0x0E, 0xDC, 0xC1, 0x52, 0x0E, 0x1C, 0x98, 0x5B, 0xC5, 0xAD, 0xB2, 0x9A, 0x55, 0x3B, 0x0C,
+    0x18, 0x4C, 0x30, 0x24, 0x20, 0x3B, 0x50, 0xE0, 0xC0, 0x90, 0x57, 0x72, 0xE2, 0xAA, 0x15, 0xB4,
+    0x35, 0x74, 0x51, 0x64, 0x6D, 0x11, 0x6B, 0x81, 0xCB, 0x37, 0xA3, 0xF7, 0x70, 0xF7, 0x7C, 0xDF,
+    0xB9, 0x17, 0x0F, 0xEF, 0x75, 0xCF, 0x1F, 0x39, 0x33, 0x9C, 0x91, 0xDD, 0x33, 0x7D, 0xCE, 0xED,
+    0x6E, 0x3C, 0xE0, 0xE2, 0xDE, 0x73, 0xCF, 0x3D, 0xFF, 0xD7, 0x4B, 0x3B, 0x4F, 0xBE, 0x92, 0x1E,
+    0x30, 0x5C, 0x00, 0x7A, 0x2B, 0xC2, 0x8C, 0x30, 0xAE, 0xBC, 0x8D, 0xAF, 0xD2, 0x18, 0xB3, 0xB2,
+    0x30, 0x30, 0xFB, 0xFB, 0x72, 0xAD, 0xF1, 0xBC, 0x0B, 0x84, 0x3B, 0x33, 0xF8, 0x0C, 0xA1, 0x77,
+    0x1B, 0x68, 0x4C, 0x33, 0xC1, 0xDB, 0x5F, 0xE9, 0x60, 0x50, 0x01, 0x46, 0x0D, 0x60, 0x4C, 0x98,
+    0x54, 0xBE, 0xC0, 0xB2, 0x3A, 0x90, 0xFB, 0x98, 0xAA, 0x26, 0xB4, 0x1D, 0x4D, 0xAB, 0xAC, 0xF0,
+    0xBC, 0xBC, 0xC9, 0x2B, 0x07, 0xF5, 0x37, 0x27, 0xBE, 0x1E, 0xFD, 0x37, 0xCA, 0x00, 0x65, 0x82,
+    0x72, 0xE0, 0x41, 0xF0, 0x1B, 0x07, 0x3F, 0x7B, 0x65, 0x40, 0x1F, 0xB3, 0xC6, 0x17, 0xBC, 0x2B,
+    0xD8, 0x73, 0xF8, 0xDD, 0x35, 0x7E, 0x0A, 0xF8, 0x49, 0xCE, 0x65, 0xA3, 0xEF, 0x7A, 0x02, 0xFF,
+    0xA8, 0xBE, 0x41, 0xFC, 0x89, 0x31, 0x2D, 0xB0, 0x79, 0xA3, 0x1E, 0x80, 0x3B, 0x2F, 0x5E, 0xEA,
+    0x75, 0xE1, 0xA8, 0x18, 0xDD, 0xE2, 0xE7, 0xEE, 0x12, 0xFB, 0xF6, 0x73, 0x21, 0xEE, 0x93, 0x77,
+    0x5E, 0x22, 0xF7, 0xFD, 0xBA, 0x19, 0xFF, 0x14, 0xCF, 0x91, 0x17, 0xFA, 0x11, 0x9F, 0xEB, 0x1D,
+    0xCB, 0x77, 0x00, 0x7A, 0x0B, 0xF1, 0xD8, 0x04, 0x7D, 0x48, 0x31, 0x49, 0xBB, 0xF8, 0xE3, 0x93,
+    0xB3, 0x19, 0x5A, 0x12, 0xC8, 0xFC, 0x7C, 0x67, 0x89, 0x27, 0x5C, 0x03, 0xD8, 0xDD, 0x04, 0x67,
+    0x74, 0x5C, 0xEF, 0x1F, 0xF0, 0x8D, 0x74, 0xE5, 0xC0, 0x7C, 0xE4, 0x79, 0x32, 0x0F, 0x8E, 0x5C,
+    0xFC, 0x5A, 0x48, 0x2C, 0xC5, 0x3C, 0xD4, 0x55, 0xBC, 0x92, 0xBE, 0x07, 0x63, 0x24, 0x7D, 0x1F,
+    0x13, 0x59, 0x47, 0xD7, 0xF0, 0xFE, 0x7F, 0x94, 0x63, 0x70, 0x4B, 0xD0, 0x61, 0x5D, 0x38, 0x60,
+    0x08, 0x8E, 0x8F, 0xDF, 0x02, 0x7D, 0x2C, 0x3C, 0xF3, 0xC6, 0xFE, 0xCB, 0xF6, 0x77, 0xBC, 0xA4,
+    0x72, 0x9F, 0xE0, 0x67, 0x73, 0x0E, 0x03, 0x56, 0x64, 0x22, 0x0B, 0xF2, 0xB7, 0x30, 0x03, 0x7B,
+    0x9E, 0x69, 0xCF, 0x2D, 0x41, 0x01, 0x83, 0x17, 0x91, 0xC8, 0xCF, 0x5E, 0x74, 0x84, 0x2E, 0x23,
+    0xEA, 0x83, 0x78, 0x23, 0xB9, 0xAF, 0x27, 0xDD, 0xC8, 0xAB, 0xB4, 0xF1, 0xB2, 0x4A, 0xFA, 0x92,
+    0x16, 0x02, 0xCE, 0xE8, 0x6C, 0x67, 0xBC, 0x29, 0x47, 0x19, 0x33, 0x13, 0x9A, 0x8E, 0x24, 0x5B,
+    0xE0, 0x06, 0x3D, 0xDE, 0x75, 0xC5, 0x7B, 0x15, 0x68, 0xAE, 0x3B, 0x81, 0x8B, 0x92, 0x6E, 0x07,
+    0x20, 0x77, 0xA0, 0x95, 0xC5, 0x94, 0x35, 0xF2, 0xA7, 0xBA, 0x88, 0xC7, 0xB7, 0x57, 0x18, 0x11,
+    0xB9, 0xCC, 0x7F, 0x19, 0x13, 0xB5, 0x92, 0xFF, 0x81, 0x21, 0x55, 0x7F, 0x81, 0xFF, 0x32, 0xF0,
+    0x07, 0x66, 0x51, 0xB3, 0x4B, 0xB9, 0xB7, 0x2C, 0x5F, 0x5A, 0xC9, 0x7F, 0x69, 0xCC, 0xD6, 0xEC,
+    0x7D, 0x7E, 0x90, 0x8C, 0x69, 0x8B, 0x6F, 0x2F, 0x5B, 0x28, 0x33, 0x7C, 0x28, 0xDF, 0x9D, 0x92,
+    0x3C, 0xE6, 0x47, 0xC6, 0x94, 0x0B, 0x5F, 0xDE, 0xB1, 0x3C, 0xF2, 0x48, 0x71, 0x64, 0x24, 0xDA,
+    0xC0, 0x5C, 0x84, 0x9F, 0xEE, 0x5F, 0x1A, 0x48, 0x81, 0xBD, 0x65, 0xD7, 0xDE, 0xAD, 0x1B, 0xFE,
+    0xED, 0x1B, 0x9F, 0x82, 0x78, 0x02, 0x59, 0x94, 0xC6, 0x5C, 0xD7, 0xC6, 0xCD, 0x7A, 0xD4, 0x46,
+    0xEF, 0xD5, 0xB2, 0x68, 0x5B, 0x34, 0x84, 0x0B, 0x68, 0x43, 0xFE, 0x6B, 0x23, 0x1E, 0xC0, 0xAC,
+    0xA4, 0x21, 0xB4, 0x16, 0xBB, 0x46, 0x32, 0x35, 0x2A, 0x5E, 0xB3, 0xF0, 0x84, 0xCF, 0xEA, 0xC5,
+    0xA5, 0xA7, 0x1F, 0x7F, 0x65, 0x64, 0x23, 0x6F, 0x8D, 0xBC, 0x5F, 0xD6, 0xCB, 0xB0, 0x0B, 0x9B,
+    0x39, 0x47, 0x96, 0x2B, 0x74, 0x16, 0x4B, 0xE3, 0xC8, 0x3B, 0x3B, 0x9B, 0x5C, 0x9F, 0x7C, 0x6E,
+    0x6A, 0x60, 0xA2, 0xE3, 0xD1, 0x2E, 0x4B, 0x32, 0x94, 0x2F, 0xDC, 0xD8, 0xDF, 0x7F, 0x65, 0xB5,
+    0x5F, 0x90, 0x5D, 0xB3, 0x1B, 0x58, 0x9C, 0x6F, 0x8F, 0x6F, 0x9B, 0xC6, 0x5E, 0x23, 0xCB, 0x4F,
+    0x1B, 0xD1, 0xD2, 0x36, 0x42, 0xD7, 0x90, 0x35, 0xAF, 0x0D, 0x61, 0x71, 0xB7, 0x6A, 0x4C, 0xD7,
+    0x4C, 0x9F, 0x8A, 0x17, 0x60, 0x27, 0x72, 0xB7, 0xB2, 0x17, 0x92, 0xF3, 0x6B, 0x65, 0xEF, 0x78,
+    0x41, 0x99, 0x82, 0x87, 0xC3, 0xE1, 0xC9, 0x06, 0xCC, 0x71, 0xDD, 0x2B, 0x87, 0x07, 0x73, 0x99,
+    0x38, 0xF4, 0x0C, 0x07, 0x0E, 0xAF, 0xEE, 0x01, 0x0B, 0x87, 0x0F, 0x46, 0x72, 0xF8, 0x2A, 0xD0,
+    0x17, 0x6A, 0x02, 0x4C, 0xB6, 0x77, 0xEE, 0x2D, 0x6F, 0x2D, 0x60, 0xB8, 0x6E, 0xE5, 0xDA, 0x39,
+    0x5D, 0xD0, 0x7E, 0xA7, 0x3F, 0x15, 0xF3, 0x3D, 0x59, 0xC6, 0xCF, 0x38, 0x84, 0xE9, 0x07, 0x3B,
+    0x34, 0xD3, 0x06, 0x93, 0xEB, 0x5C, 0x2E, 0x89, 0x82, 0x9E, 0x28, 0x6E, 0x88, 0xB8, 0x7D, 0x18,
+    0xEF, 0xB2, 0x4E, 0x37, 0x17, 0x8C, 0x09, 0x3B, 0xDD, 0x9F, 0x7B, 0x45, 0x4A, 0x01, 0xA1, 0x12,
+    0x94, 0xAF, 0x6C, 0x18, 0x54, 0x0F, 0x94, 0xEB, 0xCD, 0xD2, 0x85, 0xDE, 0x73, 0x45, 0x14, 0x1A,
+    0x7D, 0x9E, 0xDD, 0xD9, 0xCB, 0x4E, 0xFB, 0x32, 0x70, 0x87, 0x48, 0x56, 0xB2, 0x47, 0x2C, 0xE4,
+    0x9A, 0x96, 0x0C, 0xEB, 0xA0, 0xB7, 0x2C, 0xDF, 0x32, 0x73, 0xBB, 0xAB, 0x09, 0x0D, 0xE8, 0x08,
+    0x78, 0x2A, 0x63, 0x79, 0x2F, 0x9C, 0x22, 0x88, 0xC8, 0x6A, 0x30, 0xA3, 0x45, 0x78, 0x69, 0x5F,
+    0xC9, 0x11, 0xF7, 0x23, 0xD2, 0x6D, 0x49, 0x99, 0x57, 0xA8, 0x28, 0x56, 0x94, 0xE9, 0xDF, 0xAE,
+    0x11, 0xF9, 0x3D, 0x51, 0xD4, 0xD6, 0x3A, 0x20, 0x44, 0x7B, 0xFA, 0xF1, 0x05, 0x91, 0x0C, 0x08,
+    0x90, 0xAC, 0x5C, 0xA0, 0x4C, 0x6F, 0x7D, 0x4D, 0x51, 0xAF, 0xA8, 0x55, 0x54, 0x4C, 0x8F, 0x75,
+    0xA8, 0xE0, 0x88, 0x99, 0x0A, 0x2F, 0xFD, 0x9C, 0xB9, 0x51, 0xB3, 0xBB, 0x06, 0xBB, 0xF5, 0x93,
+    0xFA, 0x96, 0x18, 0x7A, 0xD9, 0x12, 0x6B, 0xFC, 0xB4, 0xF4, 0x75, 0x23, 0xD5, 0x31, 0x3F, 0x6F,
+    0x8E, 0xB6, 0x5F, 0x1A, 0xE4, 0x2E, 0xBB, 0x90, 0x45, 0x78, 0x1B, 0x61, 0x1B, 0x98, 0x1A, 0xE9,
+    0xA2, 0xAF, 0xB2, 0x11, 0x5F, 0xB3, 0xE2, 0x2E, 0x99, 0x50, 0xA4, 0xF3, 0x52, 0x25, 0xE0, 0x3D,
+    0xA5, 0x2B, 0xC8, 0x0A, 0xC2, 0x74, 0xAE, 0xF2, 0x79, 0x5E, 0x4F, 0x89, 0xC2, 0xD7, 0xA9, 0x0E,
+    0x39, 0xF4, 0xF5, 0xEF, 0x71, 0x22, 0xF2, 0xBF, 0xA7, 0x6C, 0x98, 0xFD, 0x5C, 0x67, 0x65, 0x54,
+    0xA4, 0xC2, 0x6E, 0xA4, 0xA4, 0x48, 0x29, 0x84, 0x2C, 0x92, 0x3F, 0x29, 0x61, 0xA6, 0xFA, 0x69,
+    0xD2, 0x89, 0x97, 0xEB, 0xC7, 0x52, 0x9D, 0x45, 0xBF, 0x70, 0x13, 0x57, 0x43, 0x42, 0x21, 0xC2,
+    0xC4, 0xD9, 0xC9, 0x81, 0x0C, 0x04, 0xB4, 0x7A, 0x14, 0xD0, 0xC8, 0xF1, 0x94, 0x6F, 0x8A, 0x96,
+    0xE6, 0x43, 0x6E, 0x2C, 0x98, 0x97, 0x98, 0xDB, 0x8B, 0xAC, 0x32, 0x9D, 0x11, 0x7D, 0x41, 0xAB,
+    0x04, 0x88, 0xA0, 0xC5, 0xAF, 0x43, 0x45, 0xBB, 0xF3, 0xA9, 0xF3, 0x75, 0x0C, 0x02, 0xBD, 0x52,
+    0x97, 0x93, 0x08, 0x27, 0x3A, 0xAC, 0xBA, 0x04, 0x92, 0x5C, 0x87, 0x5C, 0x97, 0xFD, 0x5E, 0xCA,
+    0x07, 0x1D, 0x2A, 0x2F, 0xB8, 0x16, 0x13, 0x0D, 0x54, 0x3A, 0xFC, 0x9E, 0xDC, 0x27, 0xEC, 0x54,
+    0x18, 0x6C, 0xD9, 0x0B, 0x95, 0x88, 0xB1, 0xAD, 0x94, 0x14, 0x53, 0xC8, 0xC1, 0x32, 0x45, 0x7B,
+    0x2A, 0xD1, 0x1C, 0x2A, 0x67, 0x91, 0x5B, 0xE0, 0x6E, 0x32, 0x7B, 0xB2, 0x0D, 0x81, 0x1F, 0x80,
+    0xF3, 0x02, 0x89, 0x54, 0xD4, 0x73, 0xAD, 0x5C, 0x19, 0x2B, 0xEF, 0x8A, 0xB9, 0x8E, 0xCF, 0x0A,
+    0xAD, 0x95, 0x94, 0xC2, 0x28, 0x52, 0x7A, 0x2A, 0x53, 0xAA, 0x50, 0x09, 0x78, 0xE8, 0xA9, 0x44,
+    0xB9, 0x86, 0xA7, 0x4B, 0xEF, 0xC7, 0xFF, 0x55, 0x65, 0x7E, 0x79, 0x43, 0xF3, 0x9D, 0x7A, 0x41,
+    0x3E, 0xB1, 0x9A, 0x49, 0x17, 0xBA, 0x68, 0xCB, 0xEA, 0x74, 0xA8, 0x7F, 0xE5, 0xFF, 0x80, 0x33,
+    0x93, 0x2E, 0x39, 0x31, 0x1D, 0x36, 0xFC, 0x1B, 0x94, 0x79, 0xDF, 0x52, 0xC9, 0xB7, 0x45, 0x0F,
+    0x0F, 0x66, 0xF7, 0xF7, 0x6F, 0x2F, 0xD5, 0x90, 0xE6, 0x42, 0xBE, 0x11, 0xC4, 0x37, 0x43, 0x19,
+    0x8F, 0x77, 0x06, 0x4F, 0x98, 0xF7, 0x30, 0x67, 0x4F, 0xF2, 0x66, 0x0D, 0x65, 0x48, 0x0D, 0x45,
+    0xBF, 0xAD, 0xDF, 0x1B, 0x59, 0xF4, 0x5E, 0x34, 0xB2, 0x87, 0x03, 0x7A, 0x38, 0x16, 0x8F, 0x8C,
+    0x54, 0x5E, 0xEA, 0x9E, 0x69, 0x51, 0x70, 0x43, 0x36, 0x76, 0x72, 0x59, 0x12, 0xD4, 0x70, 0x1A,
+    0xEA, 0x6F, 0x8D, 0x7C, 0x8B, 0x3A, 0xA2, 0x40, 0x91, 0x90, 0x23, 0x51, 0x33, 0x47, 0x51, 0x45,
+    0x14, 0x17, 0x44, 0x89, 0x0A, 0x16, 0xA9, 0xA2, 0x0B, 0x8A, 0x0E, 0x15, 0x2D, 0x54, 0x22, 0x50,
+    0xAA, 0x64, 0x37, 0xCD, 0xC2, 0x21, 0x0A, 0xD9, 0x8B, 0x52, 0x95, 0xEF, 0xD7, 0x75, 0x55, 0xE9,
+    0x5A, 0x73, 0xE8, 0x35, 0xA2, 0xAB, 0x7F, 0x42, 0xF4, 0xDA, 0x63, 0xA3, 0xB3, 0x26, 0xA6, 0x17,
+    0xE1, 0xB2, 0x2A, 0xE7, 0x2D, 0xEC, 0x26, 0x25, 0xE5, 0x42, 0x51, 0x4F, 0x40, 0x6B, 0xB2, 0xFF,
+    0xE0, 0x16, 0x99, 0x72, 0x74, 0x59, 0xB0, 0xD2, 0xDA, 0xD3, 0x3D, 0x52, 0x5A, 0x64, 0x2F, 0x97,
+    0xA5, 0xC5, 0x0D, 0xDE, 0xCB, 0xA4, 0x15, 0x91, 0x8F, 0x24, 0xA2, 0xDB, 0x24, 0xE4, 0x2F, 0x61,
+    0x9B, 0x35, 0x17, 0x2C, 0xCB, 0xCE, 0x1A, 0xE5, 0x55, 0xA1, 0x3C, 0xDE, 0xF1, 0x22, 0x63, 0xF5,
+    0xB6, 0x64, 0xC8, 0x1A, 0x6E, 0xF0, 0xB2, 0x6D, 0x64, 0x4D, 0x4E, 0xBE, 0x5E, 0x36, 0xA2, 0xC4,
+    0xE8, 0x36, 0x21, 0x6A, 0x12, 0xD5, 0x5D, 0x61, 0x81, 0x59, 0x83, 0x45, 0x86, 0xFD, 0x40, 0x9E,
+    0x6B, 0x54, 0x05, 0x93, 0xBE, 0x90, 0xF3, 0xB0, 0x7F, 0x98, 0xB2, 0x92, 0x7D, 0xCE, 0x20, 0x92,
+    0xE8, 0x7B, 0x2C, 0xC9, 0xF1, 0xE5, 0xBE, 0xC2, 0xFE, 0xB2, 0xA5, 0xF7, 0x84, 0xAC, 0x0F, 0xDF,
+    0x74, 0x72, 0x69, 0x82, 0x91, 0xCD, 0xEC, 0xCE, 0x7F, 0x20, 0x82, 0x11, 0xFA, 0x04, 0x35, 0xAC,
+    0x6E, 0x72, 0xFC, 0x21, 0x87, 0xC8, 0x0C, 0x71, 0x79, 0x88, 0x0B, 0xAA, 0xC8, 0x2A, 0x28, 0x11,
+    0x50, 0x63, 0x83, 0x56, 0x08, 0x9E, 0x48, 0x26, 0x1D, 0x83, 0x33, 0xC8, 0x02, 0x00, 0x53, 0xE5,
+    0x4D, 0xF9, 0x09, 0xEE, 0x5D, 0xCA, 0x3E, 0x97, 0x24, 0xC0, 0x1C, 0x40, 0x58, 0x66, 0xB4, 0xC8,
+    0x21, 0x9A, 0x67, 0x10, 0xBC, 0x63, 0xF3, 0xB6, 0x2C, 0xE2, 0x1A, 0xC2, 0xA5, 0xD5, 0xD4, 0x1E,
+    0x67, 0x59, 0xE3, 0x8C, 0xFC, 0xA3, 0xFC, 0x08, 0x8B, 0x8E, 0xBF, 0xA4, 0xA4, 0x25, 0x34, 0x48,
+    0x3D, 0xDA, 0xEA, 0xEA, 0x4F, 0x40, 0xB3, 0xF9, 0x0D, 0x12, 0xB0, 0x1E, 0x6F, 0x91, 0x98, 0x4C,
+    0xA1, 0x53, 0xD4, 0x43, 0x95, 0x7D, 0x55, 0x99, 0x6D, 0xB4, 0x20, 0xEB, 0x85, 0x05, 0x65, 0x13,
+    0xF9, 0xB7, 0x41, 0xC2, 0x96, 0x4F, 0x22, 0x61, 0xD2, 0x27, 0x91, 0xF0, 0x0B, 0xA0, 0x58, 0x51,
+    0x62, 0x51, 0x45, 0x24, 0xA4, 0x03, 0x54, 0x52, 0x58, 0x85, 0x82, 0x2A, 0x08, 0xE3, 0x20, 0x8B,
+    0x59, 0x94, 0xD3, 0xA0, 0x36, 0x6F, 0xCA, 0x3E, 0x28, 0xCC, 0xA4, 0x3F, 0xEB, 0xA8, 0xA7, 0xA5,
+    0x18, 0xD8, 0x94, 0x1C, 0xB4, 0xDA, 0xB4, 0x01, 0x1B, 0x58, 0x52, 0xF2, 0xB2, 0xF2, 0xE2, 0xF2,
+    0xD3, 0x67, 0xD8, 0x35, 0x7E, 0x2E, 0x8D, 0xFF, 0x87, 0x9D, 0xE2, 0x1F, 0xA4, 0xF1, 0x29, 0xEE,
+    0xFC, 0x17, 0x10, 0x4E, 0xC0, 0x29, 0xFF, 0x00, 0x0D, 0xA1, 0xB6, 0x04, 0x2B, 0x7C, 0x90, 0xC5,
+    0xBD, 0xC3, 0x86, 0xD0, 0xEF, 0x1E, 0x1B, 0xB2, 0xE6, 0x29, 0x1E, 0x0D, 0x02, 0xAE, 0xBA, 0x46,
+    0xCF, 0x46, 0xB4, 0xF0, 0xB5, 0x11, 0x2E, 0x83, 0x96, 0x8D, 0x60, 0x15, 0x36, 0x6C, 0xF8, 0x63,
+    0x54, 0xB1, 0x21, 0x14, 0x57, 0x68, 0xA3, 0xFE, 0x03, 0x4F, 0x1B, 0xE5, 0xFF, 0xB0, 0x8D, 0x7C,
+    0x65, 0x1B, 0xC2, 0xA0, 0xB4, 0x21, 0xAC, 0x4D, 0x1A, 0x3E, 0x7F, 0x14, 0x62, 0x3A, 0x30, 0x55,
+    0xD4, 0x07, 0xF5, 0x28, 0x1C, 0xBC, 0x0D, 0x5B, 0x79, 0xF3, 0xB6, 0xE4, 0x26, 0xB3, 0xB2, 0x08,
+    0x34, 0x67, 0x4D, 0x2E, 0x76, 0x89, 0x7C, 0x3E, 0xA4, 0x5C, 0xD9, 0xA1, 0x2F, 0x78, 0x33, 0xCF,
+    0x9A, 0x71, 0xAC, 0x29, 0x47, 0x5E, 0xE2, 0xC3, 0x9A, 0x72, 0xB8, 0x95, 0x5F, 0xA5, 0xC7, 0x22,
+    0xAB, 0x40, 0x6A, 0xC4, 0x34, 0x15, 0x81, 0x8A, 0x46, 0x65, 0x03, 0x71, 0x31, 0xED, 0x20, 0x20,
+    0x09, 0x83, 0x6C, 0x3C, 0xE5, 0x95, 0x60, 0x9B, 0x15, 0x20, 0xA4, 0xD7, 0x60, 0x45, 0x38, 0x1A,
+    0x85, 0x60, 0xBC, 0x9B, 0x70, 0xF6, 0x57, 0xBD, 0x5E, 0x3F, 0xAB, 0xF7, 0xC9, 0x79, 0x4F, 0xBD,
+    0x7F, 0xC2, 0x67, 0xE1, 0xB9, 0x79, 0xE3, 0x53, 0x94, 0xF2, 0xF2, 0x9B, 0x57, 0x84, 0x64, 0xCE,
+    0xA9, 0xB9, 0x1A, 0xA6, 0x3C, 0x15, 0x08, 0x96, 0x16, 0x61, 0x4F, 0xFF, 0xCE, 0x23, 0xAA, 0x43,
+    0x14, 0x58, 0xFB, 0x18, 0xEA, 0x2B, 0x3A, 0xD4, 0xDA, 0x6B, 0x2B, 0xAC, 0x56, 0x14, 0x56, 0x07,
+    0x72, 0x47, 0x8A, 0xA0, 0xB6, 0xFB, 0xE6, 0x84, 0x60, 0x3C, 0x87, 0xB3, 0xFF, 0x01, 0x9F, 0x14,
+    0x2F, 0x28, 0x54, 0xAF, 0xC5, 0xD7, 0xE3, 0x8B, 0xDE, 0x5D, 0x0B, 0x28, 0x56, 0x44, 0x54, 0x19,
+    0x71, 0x6E, 0xBA, 0xDD, 0xB0, 0xDD, 0x46, 0xAB, 0x00, 0xF6, 0x9A, 0xBB, 0xB6, 0xDD, 0x6E, 0x09,
+    0xA2, 0x5B, 0xB6, 0xDB, 0xE6, 0x5E, 0x6D, 0xB7, 0x6A, 0xF1, 0x51, 0x7B, 0x4F, 0xFE, 0xC6, 0xA5,
+    0x0F, 0x5E, 0x19, 0x2E, 0x08, 0x8D, 0xF8, 0xC3, 0x2E, 0x84, 0x76, 0x85, 0xEF, 0x2A, 0x7C, 0x0A,
+    0xF0, 0x49, 0x6B, 0x8B, 0x7D, 0x80, 0x90, 0x02, 0x85, 0x48, 0x2E, 0xA2, 0xA2, 0x27, 0xD0, 0x3A,
+    0x7E, 0x13, 0x34, 0x73, 0x19, 0xEA, 0xFD, 0x7D, 0x6B, 0x25, 0xD7, 0xAB, 0xFC, 0x5A, 0x6F, 0xE4,
+    0x8C, 0x33, 0x67, 0xEB, 0x5F, 0xE2, 0xF7, 0x6A, 0x8B, 0x94, 0x2E, 0xDC, 0x28, 0xFF, 0x09, 0x7C,
+    0x1E, 0x22, 0x61, 0x4A, 0x75, 0x81, 0x02, 0xA1, 0xC8, 0x59, 0x10, 0x02, 0x31, 0xB1, 0x82, 0xEB,
+    0x4A, 0xD8, 0xB4, 0xE0, 0x9C, 0x32, 0xDC, 0x0C, 0xB7, 0xB7, 0xC0, 0x8D, 0xBB, 0xDE, 0x7D, 0xDE,
+    0xDD, 0xCF, 0xDD, 0xDF, 0xB7, 0xCF, 0xF3, 0x72, 0x3C, 0xBF, 0xD1, 0xFE, 0xD0, 0x6E, 0x77, 0x4E,
+    0xFB, 0x37, 0xF5, 0x97, 0x3B, 0xED, 0xEC, 0x7D, 0x9E, 0x38, 0x3E, 0xC6, 0xC8, 0x9B, 0xA5, 0x4F,
+    0x31, 0x41, 0xD0, 0x28, 0x4B, 0xB0, 0xA1, 0xF0, 0x28, 0xFB, 0x37, 0x7D, 0x60, 0x2D, 0x34, 0x03,
+    0xF4, 0xFD, 0x1A, 0xC9, 0x92, 0x63, 0x18, 0x2E, 0x39, 0x86, 0xC1, 0x48, 0x19, 0xC1, 0x33, 0x97,
+    0xF4, 0xE6, 0xD6, 0xF5, 0xB7, 0xB0, 0x52, 0xB3, 0xBA, 0x00, 0x75, 0x06, 0x62, 0x3B, 0xBE, 0xBA,
+    0x9C, 0xF6, 0x54, 0x9C, 0x5E, 0x90, 0xDE, 0x83, 0x9E, 0x14, 0x1F, 0xB6, 0x58, 0xB7, 0xB2, 0xBF,
+    0x52, 0x84, 0xCE, 0xD4, 0x65, 0x74, 0x99, 0x42, 0xB2, 0x47, 0xA6, 0xAB, 0xBC, 0x97, 0x3B, 0xCD,
+    0x39, 0x61, 0xCB, 0xB2, 0xCF, 0xC4, 0xD4, 0x0C, 0x1E, 0x07, 0xF3, 0xC9, 0x4A, 0xCD, 0x27, 0x2B,
+    0x6B, 0x3E, 0x59, 0x4E, 0xE6, 0x93, 0xF5, 0x08, 0xF9, 0xCB, 0xB9, 0x59, 0x73, 0xCB, 0x66, 0x62,
+    0xD1, 0xF3, 0x96, 0x15, 0x89, 0x00, 0x2A, 0xCB, 0x6A, 0x61, 0x91, 0xBF, 0x7E, 0x69, 0x30, 0xC0,
+    0x5A, 0x1F, 0x7B, 0x0F, 0xA8, 0x20, 0x12, 0xC6, 0x05, 0x24, 0x73, 0x82, 0xBB, 0x64, 0xAB, 0x97,
+    0x0E, 0xA8, 0x39, 0x90, 0xB4, 0x7D, 0x63, 0x7E, 0x82, 0x69, 0xF1, 0x2F, 0xFA, 0x3A, 0xC9, 0x77,
+    0x81, 0x9C, 0x69, 0x47, 0xA7, 0x5C, 0xF8, 0xBD, 0x15, 0x16, 0x65, 0xAA, 0xE4, 0xAE, 0x22, 0x21,
+    0x74, 0xEB, 0x16, 0xE6, 0x4D, 0x68, 0x33, 0x55, 0x53, 0x8A, 0x50, 0x6B, 0x3C, 0x4C, 0xAD, 0xFE,
+    0x31, 0x6F, 0xF9, 0xB6, 0xB5, 0xB0, 0x93, 0x0F, 0x7F, 0x45, 0xED, 0x5A, 0xDD, 0xBF, 0xD5, 0xD1,
+    0xE8, 0xD7, 0xA3, 0xD1, 0x4F, 0xA3, 0xD1, 0xBB, 0xBD, 0xF6, 0x60, 0x6A, 0xC5, 0x53, 0x2B, 0x9C,
+    0x5A, 0xC1, 0xD4, 0xF2, 0xA7, 0x96, 0x77, 0x5A, 0x8B, 0x1B, 0xA5, 0xA7, 0x9E, 0x11, 0xA0, 0x37,
+    0x68, 0x32, 0xB9, 0xA0, 0x7B, 0xF4, 0xEE, 0x69, 0xE8, 0x29, 0x45, 0xDE, 0x36, 0x7A, 0xC3, 0xDA,
+    0x6A, 0x29, 0x72, 0x95, 0x1F, 0x41, 0x64, 0x97, 0xBF, 0x51, 0xE5, 0x91, 0x4B, 0xB0, 0xD3, 0x0B,
+    0x02, 0x97, 0x5D, 0x23, 0x30, 0xD1, 0x13, 0x28, 0x6F, 0xE7, 0x97, 0xE0, 0xEE, 0x6A, 0xD1, 0x13,
+    0xB6, 0x7E, 0x7E, 0x05, 0x1B, 0xB7, 0xF3, 0xE4, 0x8C, 0xAA, 0x71, 0x3A, 0x95, 0xD3, 0xE9, 0x9C,
+    0x93, 0xD2, 0xE9, 0xB4, 0xCE, 0x7B, 0xC2, 0xFB, 0x16, 0x43, 0xAA, 0x05, 0x7E, 0x5B, 0x1E, 0xC6,
+    0xBF, 0x0B, 0x0F, 0x22, 0x16, 0xA6, 0xE9, 0x84, 0x2A, 0x27, 0x62, 0x39, 0x4B, 0xE4, 0xED, 0xB1,
+    0xBB, 0xCE, 0x7E, 0x4E, 0xD6, 0x3E, 0x34, 0x51, 0xEC, 0xA7, 0x86, 0x96, 0x9D, 0x96, 0xBA, 0xA8,
+    0xEC, 0x4A, 0x56, 0x19, 0xB5, 0x6F, 0x47, 0x95, 0xE0, 0x5E, 0x84, 0x33, 0x7D, 0x07, 0x7D, 0x03,
+    0xED, 0xBF, 0xF6, 0x7E, 0x5B, 0x58, 0xBC, 0x7B, 0xFB, 0x29, 0x59, 0x73, 0xAA, 0x8B, 0xB3, 0xB5,
+    0xF6, 0x53, 0x47, 0x85, 0x30, 0x7B, 0x46, 0x9C, 0x0B, 0x1A, 0x5D, 0x3C, 0x5A, 0x5D, 0x60, 0xF9,
+    0x94, 0x05, 0x99, 0xD1, 0x76, 0x17, 0x17, 0x96, 0xCF, 0xF9, 0xE3, 0xC9, 0xAE, 0x16, 0x16, 0xC6,
+    0x94, 0x43, 0x15, 0xCE, 0x7F, 0x7F, 0xAA, 0xF4, 0x39, 0x5A, 0x3B, 0x60, 0xCE, 0x88, 0x9A, 0xB2,
+    0xC0, 0x0A, 0x80, 0x6C, 0xD4, 0x42, 0x95, 0x86, 0xAC, 0x64, 0xDE, 0x56, 0x86, 0x8C, 0x1D, 0x18,
+    0xD6, 0x98, 0x4D, 0x13, 0x85, 0xAF, 0xD6, 0xD5, 0x15, 0xF6, 0xF8, 0x8E, 0xC3, 0x2B, 0xD2, 0xEA,
+    0xD2, 0x09, 0xC7, 0x6A, 0x79, 0x18, 0xAC, 0x65, 0x96, 0xAA, 0x05, 0xCC, 0xB5, 0x30, 0xAD, 0x27,
+    0xF0, 0x59, 0x82, 0x2E, 0xE5, 0xDD, 0xB4, 0xC1, 0x90, 0x80, 0x92, 0x0A, 0x09, 0x1A, 0x95, 0x6D,
+    0xD4, 0xB6, 0xC1, 0xB5, 0xB0, 0xD1, 0x98, 0xFE, 0xB4, 0x6E, 0x4C, 0x9F, 0x9A, 0xEE, 0x33, 0xDD,
+    0x79, 0x7A, 0x56, 0xE6, 0x9E, 0x6E, 0xDD, 0xDA, 0x46, 0x8D, 0x7C, 0x56, 0xC4, 0x91, 0x21, 0x80,
+    0x44, 0x2E, 0xDA, 0x97, 0xDA, 0x05, 0xB2, 0x9B, 0xF5, 0x40, 0x0D, 0xED, 0x9C, 0x1D, 0x4E, 0x17,
+    0xCD, 0x70, 0x8E, 0xC2, 0xBA, 0xAF, 0x9A, 0x61, 0x3C, 0xEE, 0x63, 0xAD, 0xA7, 0x9C, 0x2D, 0x3C,
+    0x2A, 0xD7, 0xA5, 0x96, 0xAB, 0xC0, 0x49, 0x54, 0xCC, 0x91, 0xFD, 0x9B, 0xBD, 0x52, 0x96, 0x29,
+    0x90, 0xC8, 0x30, 0x40, 0xA1, 0x79, 0x83, 0x7C, 0xC0, 0x2E, 0xFF, 0xFC, 0x23, 0x35, 0x15, 0x55,
+    0xF4, 0x4F, 0x18, 0x5E, 0x12, 0x8C, 0x44, 0x32, 0xD2, 0xB3, 0xCF, 0x65, 0x1B, 0x4F, 0x37, 0x7C,
+    0x02, 0xCC, 0x82, 0x10, 0xAD, 0x96, 0xB2, 0xD6, 0x6F, 0xC2, 0xE8, 0x97, 0xA1, 0xBB, 0x67, 0x5F,
+    0xA6, 0xB2, 0xD1, 0x89, 0x88, 0xFC, 0xEA, 0x12, 0x33, 0xBE, 0x02, 0x90, 0xA9, 0xA2, 0x25, 0xE8,
+    0xA2, 0x47, 0x1B, 0xAF, 0x03, 0x67, 0x8F, 0x0D, 0x5F, 0xD3, 0x8B, 0x57, 0x45, 0x09, 0x81, 0xB9,
+    0xC4, 0x23, 0x4A, 0xDC, 0xBD, 0x06, 0xC1, 0xD4, 0x5E, 0x5E, 0x70, 0x7C, 0x65, 0xEB, 0xCD, 0xBA,
+    0x34, 0x2F, 0x12, 0xB3, 0xCA, 0xAF, 0x07, 0x66, 0x10, 0xC9, 0xEC, 0x69, 0x4B, 0x2A, 0xB0, 0x08,
+    0x9F, 0x93, 0xE1, 0xFE, 0x2F, 0xB2, 0x82, 0x62, 0x10, 0x7E, 0x0E, 0xBA, 0x31, 0x37, 0x0B, 0x4F,
+    0x2D, 0x98, 0x9D, 0xBA, 0x4E, 0x60, 0x9B, 0xDE, 0x2F, 0xBC, 0x67, 0x62, 0x19, 0xEF, 0x17, 0xF2,
+    0x1F, 0x98, 0x62, 0x4F, 0x26, 0xA0, 0xBD, 0x20, 0x9F, 0xE9, 0x73, 0x18, 0x49, 0xE4, 0xB9, 0x21,
+    0x74, 0x5F, 0xAA, 0xAC, 0xC1, 0x12, 0xEF, 0x37, 0x07, 0xF8, 0x03, 0x7D, 0xC3, 0x29, 0xAE, 0x4B,
+    0x60, 0x6B, 0x89, 0xE0, 0xD1, 0x0F, 0x96, 0x94, 0x64, 0xE5, 0x7E, 0x42, 0xA6, 0x60, 0xA5, 0xFB,
+    0xB6, 0x5B, 0xB5, 0xF3, 0x67, 0xC3, 0x8F, 0x5C, 0x36, 0x22, 0x13, 0x65, 0xAD, 0x80, 0x14, 0x20,
+    0x61, 0x0B, 0xBF, 0xCB, 0x2B, 0x7F, 0xB5, 0x3F, 0xEA, 0x1A, 0xF0, 0x47, 0x98, 0x26, 0xED, 0x75,
+    0x49, 0xEF, 0x63, 0xF4, 0x04, 0x44, 0x53, 0x4B, 0x9F, 0xD6, 0x62, 0x79, 0x8B, 0xCC, 0x68, 0x06,
+    0xF7, 0x1C, 0x83, 0xC7, 0xC8, 0x9F, 0x72, 0x7C, 0x18, 0x77, 0xC6, 0xB5, 0xF2, 0x7D, 0x16, 0x82,
+    0xD8, 0x1D, 0xBF, 0x57, 0xEA, 0xB3, 0x3A, 0x10, 0xA9, 0x66, 0x6E, 0x2D, 0xC0, 0x8E, 0x4E, 0xEF,
+    0xFC, 0x91, 0xA8, 0x36, 0x6A, 0xE8, 0x87, 0x87, 0x4A, 0xE0, 0xE0, 0x60, 0x5C, 0xAC, 0x61, 0xA2,
+    0xD0, 0x5B, 0xC3, 0x94, 0x70, 0x87, 0x70, 0x8F, 0x70, 0x97, 0xF0, 0x2A, 0xE1, 0x00, 0x28, 0xBB,
+    0x5F, 0x68, 0x3D, 0x16, 0x1D, 0x61, 0x8F, 0xB5, 0x95, 0xF6, 0x20, 0x8F, 0xA8, 0xBF, 0xCC, 0x9D,
+    0xF2, 0x90, 0xBB, 0xE4, 0x21, 0x77, 0x48, 0x9A, 0xFD, 0x7B, 0xBA, 0x00, 0xDE, 0x54, 0x86, 0x91,
+    0x71, 0xDC, 0x5E, 0x59, 0xE2, 0x3E, 0xEB, 0xA0, 0x1F, 0x51, 0x34, 0xA0, 0x70, 0xC8, 0xCC, 0xA5,
+    0x08, 0xD2, 0x49, 0xBB, 0xF2, 0xA3, 0xE3, 0x2B, 0x7C, 0x42, 0x57, 0xBE, 0xB1, 0xBF, 0x5F, 0x68,
+    0x88, 0xD1, 0x14, 0x67, 0x44, 0xAF, 0x1C, 0x95, 0x3F, 0x68, 0x76, 0xD8, 0x0A, 0x33, 0xEE, 0x2C,
+    0x10, 0xF2, 0x87, 0xD9, 0x94, 0x72, 0xB4, 0x85, 0x7E, 0x52, 0xD3, 0x1E, 0x8C, 0xE7, 0xCC, 0x22,
+    0x36, 0x18, 0x92, 0xBC, 0x09, 0x16, 0x90, 0x75, 0xF3, 0x0A, 0x9A, 0xC4, 0x9E, 0x60, 0xA8, 0x82,
+    0x29, 0x7A, 0x82, 0xD7, 0x90, 0x5E, 0xEC, 0x32, 0xC8, 0x24, 0xAF, 0x38, 0x61, 0x9F, 0x96, 0xFF,
+    0xD4, 0xDB, 0x01, 0x06, 0xB9, 0x44, 0x63, 0xFD, 0xF1, 0x8A, 0x5A, 0x62, 0x5E, 0x81, 0x6B, 0xA2,
+    0xC3, 0xB5, 0x0D, 0xD8, 0x43, 0xE7, 0xEA, 0x22, 0xAF, 0xB2, 0x4E, 0xD7, 0x66, 0x42, 0xA7, 0x4C,
+    0x0E, 0x26, 0x28, 0x22, 0x58, 0xD9, 0x48, 0x47, 0xEB, 0xFE, 0x1C, 0xC2, 0xA8, 0x3A, 0x53, 0x81,
+    0xAE, 0x65, 0x95, 0x3E, 0x7D, 0x11, 0x8B, 0xA0, 0xC8, 0x3F, 0x28, 0xDB, 0xB2, 0x48, 0xFA, 0xD7,
+    0x85, 0x4E, 0x65, 0xF0, 0x17, 0x67, 0x38, 0xE8, 0xF0, 0x01, 0x26, 0xAD, 0xF7, 0xB4, 0xAC, 0x2C,
+    0x3C, 0xFC, 0xBB, 0x58, 0xFC, 0xB1, 0xFA, 0x63, 0x84, 0x4A, 0xBF, 0x26, 0xB4, 0x70, 0x28, 0x34,
+    0xF1, 0x1E, 0x0D, 0x3F, 0xF1, 0x90, 0x7F, 0x50, 0x77, 0x31, 0xD6, 0xD2, 0xD3, 0xC5, 0xF4, 0xF6,
+    0x7D, 0x66, 0x96, 0x99, 0x39, 0x3A, 0x6F, 0xAE, 0x07, 0xDC, 0xA3, 0x40, 0x3D, 0x23, 0xE9, 0x88,
+    0x30, 0x24, 0x4C, 0x08, 0x2F, 0x00, 0xFA, 0x0B, 0xC0, 0xA8, 0x05, 0x4C, 0x0B, 0xC0, 0xCB, 0xB8,
+    0x72, 0xEC, 0x01, 0x65, 0xFF, 0x57, 0x67, 0xEC, 0xE8, 0xEE, 0x43, 0x18, 0x8E, 0xEA, 0x9D, 0xED,
+    0xE4, 0x29, 0xFA, 0x44, 0x27, 0x40, 0x55, 0x21, 0xC8, 0xA3, 0xC2, 0x6B, 0x64, 0xB4, 0x5C, 0x25,
+    0x37, 0xC0, 0x1A, 0xD5, 0xB4, 0x35, 0xA9, 0xBA, 0xDE, 0x23, 0xD1, 0xDB, 0x1A, 0xC2, 0x60, 0x21,
+    0x4F, 0xCF, 0x46, 0xB0, 0x54, 0x21, 0x4D, 0xB9, 0x5E, 0xF8, 0x10, 0x9E, 0xC5, 0x95, 0x77, 0x0D,
+    0x10, 0x52, 0x9F, 0x3C, 0x11, 0x66, 0xFB, 0xD5, 0x25, 0xCA, 0x44, 0xD0, 0x7A, 0xFD, 0xF1, 0x0A,
+    0x7F, 0x0F, 0xC5, 0xD3, 0x5F, 0xD2, 0x11, 0xC7, 0x00, 0x02, 0xF9, 0x54, 0x5D, 0x59, 0x3B, 0xBF,
+    0xDC, 0x4D, 0xB6, 0x04, 0x79, 0x7A, 0x0C, 0x87, 0x69, 0x17, 0xC2, 0xE1, 0xD4, 0xAB, 0x01, 0xC6,
+    0xAD, 0xDF, 0xD6, 0x3F, 0xE0, 0x8E, 0x16, 0x37, 0xDB, 0x2B, 0xD7, 0xAE, 0xDF, 0x39, 0x9C, 0xAF,
+    0xE2, 0x13, 0x6B, 0x39, 0x23, 0xBC, 0x40, 0x78, 0x19, 0x10, 0x7C, 0x69, 0x00, 0x11, 0x41, 0xDC,
+    0x82, 0x59, 0xFB, 0xA8, 0x84, 0x43, 0xB9, 0x3D, 0xBB, 0x35, 0x03, 0xD4, 0xC9, 0x65, 0x14, 0x40,
+    0xC9, 0x50, 0xC8, 0x61, 0x52, 0x80, 0xD9, 0x04, 0xDF, 0x2D, 0x4D, 0xC5, 0xE1, 0x27, 0x82, 0x3F,
+    0x5B, 0x78, 0xD1, 0xCF, 0x05, 0xFF, 0x4A, 0x28, 0xFB, 0x92, 0xE0, 0x7F, 0x95, 0xA1, 0x92, 0x9D,
+    0xDC, 0xEF, 0x8D, 0xB7, 0x43, 0x5C, 0x17, 0xBB, 0xC4, 0x79, 0xF5, 0x9A, 0xE2, 0x66, 0x20, 0x4E,
+    0x7F, 0xD1, 0x13, 0x27, 0xBF, 0x6A, 0x89, 0xA3, 0x5F, 0x37, 0xC4, 0x32, 0x1C, 0xC4, 0x01, 0x25,
+    0x02, 0xE9, 0xF0, 0x88, 0xDD, 0xE5, 0x60, 0x2C, 0x56, 0x01, 0x15, 0xEE, 0xE6, 0x30, 0x9A, 0xF6,
+    0xDC, 0x1A, 0xF6, 0xA7, 0xC5, 0x44, 0x27, 0xBE, 0xD2, 0xC9, 0x8A, 0x74, 0x72, 0x2A, 0x5C, 0xC1,
+    0xD1, 0xE8, 0x53, 0x9D, 0xF4, 0xC7, 0xE3, 0xE3, 0xDB, 0x5C, 0x69, 0xAF, 0xB7, 0x74, 0x12, 0xCC,
+    0xE8, 0x24, 0xC7, 0x02, 0xDC, 0x27, 0x07, 0x83, 0x46, 0xF4, 0x1D, 0xE3, 0x91, 0x95, 0x20, 0x4A,
+    0xAC, 0x93, 0x1E, 0xC7, 0x30, 0xC6, 0xBA, 0x4D, 0xA9, 0x52, 0x7B, 0xEC, 0x09, 0xC0, 0x3F, 0xF0,
+    0x12, 0x5E, 0xCC, 0x8F, 0xE1, 0x06, 0x2D, 0x6E, 0x25, 0xD2, 0xE1, 0x0F, 0x46, 0x7B, 0xFB, 0x35,
+    0x07, 0xA3, 0x7E, 0x32, 0xD0, 0xE8, 0xF6, 0x26, 0xEC, 0x7E, 0xEC, 0xE3, 0xFD, 0xFC, 0xBF, 0xC2,
+    0x76, 0x17, 0xF2, 0x75, 0xE5, 0x5D, 0x85, 0x3D, 0xF3, 0x5D, 0xAD, 0xB7, 0xAD, 0x96, 0x51, 0x6E,
+    0xBD, 0x83, 0x45, 0x0D, 0xA7, 0xC8, 0xD8, 0x45, 0x18, 0x12, 0xCA, 0xD8, 0x14, 0x64, 0xB1, 0x46,
+    0xF3, 0x0A, 0xB2, 0x9D, 0xB0, 0xD4, 0xA5, 0x83, 0xD9, 0x2D, 0xA0, 0xFC, 0x55, 0xAF, 0xD4, 0x4F,
+    0xE9, 0x1D, 0x0C, 0x3C, 0xB0, 0xC1, 0x78, 0x3D, 0x46, 0x37, 0xE8, 0x06, 0x97, 0xF5, 0x8F, 0xFD,
+    0xDB, 0x7B, 0xD9, 0xD3, 0x78, 0xAE, 0x5B, 0x42, 0x0A, 0x0B, 0x2A, 0x27, 0x83, 0x22, 0x28, 0xC0,
+    0xBA, 0xF9, 0xF1, 0xCD, 0x2B, 0x23, 0xE9, 0x1D, 0xCB, 0xB8, 0x2C, 0xB0, 0xC3, 0x60, 0x09, 0x7E,
+    0xDB, 0xEE, 0x21, 0x53, 0xD4, 0xEA, 0x16, 0x58, 0xEF, 0x30, 0xF9, 0xB4, 0xC3, 0xC8, 0x92, 0x8E,
+    0x0A, 0x44, 0x10, 0x68, 0xAC, 0xAA, 0xDC, 0x1E, 0xEE, 0xB9, 0x97, 0x27, 0x6B, 0x08, 0x6D, 0x21,
+    0xC6, 0x2C, 0x73, 0x21, 0x99, 0xE5, 0x9E, 0x80, 0xC3, 0x5D, 0x01, 0xBB, 0x04, 0xDF, 0x12, 0xF0,
+    0x94, 0x0D, 0x4C, 0xB9, 0x5B, 0xA0, 0x91, 0x02, 0x7C, 0x8F, 0x0F, 0x69, 0x1F, 0x9B, 0xE2, 0x8D,
+    0x1A, 0x6C, 0x63, 0xD8, 0x37, 0xAA, 0x98, 0x64, 0x0A, 0x36, 0xB3, 0xE4, 0x60, 0x0C, 0xE4, 0x6E,
+    0xD4, 0x47, 0x82, 0x0E, 0x52, 0x2B, 0x8C, 0x94, 0xB2, 0xED, 0xC0, 0xF7, 0xDB, 0x40, 0x94, 0x4A,
+    0xBA, 0x84, 0xFA, 0x6C, 0xC6, 0x08, 0xA7, 0x3D, 0x9A, 0xD1, 0x76, 0x69, 0xF8, 0xB9, 0xCA, 0x07,
+    0x73, 0xA3, 0x63, 0x78, 0x9D, 0xA7, 0x3E, 0x66, 0x8D, 0x7B, 0x51, 0x33, 0xA5, 0x7A, 0xAC, 0x13,
+    0xF6, 0x62, 0x47, 0x6D, 0x68, 0x6B, 0x6B, 0x11, 0xCD, 0x9B, 0x11, 0x87, 0x3F, 0x62, 0x9C, 0x9E,
+    0xB5, 0xB9, 0x68, 0x90, 0xAF, 0x7F, 0xFC, 0xA6, 0xDA, 0x61, 0x54, 0xF4, 0x49, 0x15, 0x45, 0xC3,
+    0xDC, 0x32, 0x7A, 0x2A, 0x3A, 0x4F, 0x4D, 0x28, 0xD6, 0x2D, 0xB7, 0xFC, 0xF8, 0x26, 0x68, 0x62,
+    0x15, 0x0E, 0x29, 0x9C, 0xF0, 0xE1, 0x80, 0x90, 0xCD, 0x2E, 0x1C, 0x84, 0x9E, 0xB2, 0x26, 0x54,
+    0x95, 0x41, 0x11, 0x38, 0x23, 0x36, 0x60, 0x08, 0x29, 0x22, 0x34, 0xCC, 0x51, 0x3E, 0x43, 0xB5,
+    0xFB, 0x40, 0xD6, 0x92, 0xD3, 0x24, 0xBD, 0xDC, 0x4C, 0x18, 0xE4, 0x82, 0xB7, 0x0E, 0x46, 0x79,
+    0x10, 0x86, 0xF1, 0xD7, 0x37, 0xC1, 0x71, 0x22, 0xED, 0x84, 0x17, 0xDD, 0xB8, 0x63, 0xAF, 0xA3,
+    0xB9, 0xDD, 0x51, 0x64, 0xB1, 0x23, 0xF5, 0xEA, 0xF7, 0x5B, 0xEE, 0x5C, 0x59, 0x5E, 0xC2, 0x68,
+    0xCF, 0x9B, 0xEE, 0x80, 0x6E, 0x89, 0x18, 0xCF, 0xAA, 0x30, 0x4D, 0x59, 0x93, 0x52, 0xB2, 0xD8,
+    0x65, 0x54, 0xC5, 0xBB, 0x54, 0xC9, 0x38, 0x1D, 0x6A, 0xB3, 0x54, 0x4B, 0xAA, 0x4E, 0xD0, 0xAF,
+    0xF1, 0xA8, 0xE0, 0x1F, 0xF1, 0xA4, 0x88, 0x72, 0x48, 0x42, 0x12, 0xDE, 0xA3, 0x46, 0x73, 0x0D,
+    0xEA, 0x8C, 0xBC, 0x50, 0x82, 0x9D, 0x46, 0xB6, 0x99, 0x23, 0x21, 0x1E, 0x8D, 0xC5, 0x75, 0xDC,
+    0x73, 0xC0, 0x3E, 0x27, 0x1C, 0x65, 0xC4, 0x32, 0x52, 0x1E, 0x70, 0x7F, 0xF9, 0x4A, 0x48, 0x48,
+    0x3B, 0xCB, 0x50, 0xDB, 0xE0, 0x50, 0x67, 0x98, 0xD5, 0xD1, 0xF2, 0x75, 0xB0, 0xE6, 0xF0, 0xDD,
+    0x49, 0x3F, 0xA0, 0xC6, 0x23, 0xFD, 0xEC, 0x9F, 0x33, 0x6F, 0x6E, 0xF7, 0xF3, 0x04, 0xF4, 0xE6,
+    0x90, 0xE2, 0xBB, 0x57, 0xB7, 0xE7, 0x97, 0x5C, 0x9D, 0x4B, 0x98, 0xA4, 0xFF, 0xE5, 0x5E, 0x19,
+    0x89, 0x1B, 0x28, 0x63, 0xFE, 0x56, 0x86, 0x4E, 0xC6, 0xEA, 0xC0, 0xFC, 0x69, 0x3D, 0x82, 0xE1,
+    0x45, 0x74, 0x3A, 0xCA, 0x73, 0xE5, 0x25, 0x20, 0x22, 0x2C, 0xBF, 0x84, 0x46, 0xA8, 0x8D, 0xC9,
+    0x8C, 0x85, 0xFD, 0x51, 0xBF, 0x9A, 0xC7, 0xA6, 0xF3, 0xDD, 0x64, 0x83, 0x6B, 0xB6, 0x3B, 0xEF,
+    0x44, 0x22, 0xCB, 0x7E, 0x34, 0x9E, 0x4E, 0xBF, 0x22, 0xD7, 0x08, 0x4F, 0x34, 0x82, 0x66, 0xE2,
+    0xC8, 0x0B, 0xC2, 0x0E, 0xA1, 0x05, 0x23, 0xB9, 0xD5, 0x8A, 0x46, 0xB6, 0x35, 0xFC, 0x96, 0x0D,
+    0x12, 0x5C, 0x59, 0xCE, 0x7A, 0xDD, 0x73, 0xFE, 0xBA, 0x15, 0xC3, 0x64, 0xD4, 0xE1, 0x4C, 0x3D,
+    0x58, 0x20, 0x56, 0xB5, 0x83, 0x31, 0x87, 0x0F, 0xAB, 0x8B, 0x01, 0xE0, 0x19, 0x3F, 0x55, 0x3A,
+    0xD5, 0x4E, 0x07, 0x7E, 0xA0, 0x40, 0x2F, 0x54, 0x2B, 0x94, 0x77, 0x93, 0xC1, 0xC5, 0xB8, 0xD4,
+    0xB7, 0x41, 0xC7, 0xB4, 0xB5, 0xA7, 0xB7, 0xC1, 0xE8, 0x8E, 0x62, 0x53, 0xE8, 0xEF, 0xCB, 0x56,
+    0x71, 0xD2, 0x2B, 0x8E, 0xEF, 0x80, 0xE9, 0x18, 0x46, 0xC8, 0x56, 0x9B, 0xEB, 0x30, 0xFF, 0xBE,
+    0xA8, 0x46, 0x50, 0x6F, 0x63, 0x27, 0x42, 0x31, 0x9C, 0x06, 0x3D, 0xD4, 0xEE, 0xB1, 0x6F, 0xEC,
+    0xC0, 0x36, 0x40, 0x67, 0xD8, 0x13, 0x76, 0x63, 0x43, 0xCD, 0xDD, 0x02, 0x49, 0xCF, 0x27, 0x3A,
+    0x5D, 0x57, 0x86, 0xF4, 0x69, 0xD8, 0x9D, 0x46, 0x4F, 0xB4, 0x92, 0x46, 0x35, 0x9B, 0x70, 0xB1,
+    0x27, 0x4B, 0xEE, 0x8C, 0x3E, 0x6E, 0xF4, 0x9C, 0x13, 0x5C, 0x86, 0xCF, 0x3A, 0x3B, 0x8D, 0xFD,
+    0xFD, 0x4A, 0x34, 0x9B, 0xE5, 0xA1, 0x5C, 0x2B, 0x9A, 0xCD, 0x50, 0x23, 0x7B, 0xE3, 0x83, 0xBA,
+    0x62, 0x0C, 0x91, 0xD5, 0x6C, 0x44, 0x69, 0x02, 0x85, 0x07, 0x86, 0x02, 0xD3, 0x51, 0xFA, 0xC1,
+    0x41, 0x4B, 0x33, 0x48, 0x21, 0xB3, 0x24, 0x77, 0x1F, 0x95, 0x9F, 0x39, 0x99, 0x4E, 0xD9, 0x82,
+    0xC8, 0xE5, 0x0B, 0x58, 0xA1, 0x26, 0xBC, 0x42, 0xA0, 0x3A, 0x4C, 0x85, 0x46, 0xF1, 0x78, 0x45,
+    0xF1, 0x12, 0xB1, 0x1D, 0xC0, 0xF3, 0xEB, 0x8D, 0x95, 0xEB, 0x47, 0xBD, 0xAF, 0xBF, 0x9A, 0x9E,
+    0x23, 0x82, 0x53, 0x59, 0xD1, 0xA6, 0xDC, 0xA5, 0x37, 0x84, 0x51, 0xBB, 0x7E, 0xD1, 0x3A, 0x34,
+    0x69, 0x38, 0xB0, 0xAE, 0x82, 0xC6, 0x6E, 0x08, 0xB7, 0xC9, 0x9B, 0x08, 0xF2, 0x1E, 0x8C, 0x6B,
+    0x33, 0x10, 0xC1, 0x70, 0x43, 0x75, 0xD1, 0x37, 0xB0, 0xF2, 0x64, 0xD0, 0x04, 0x92, 0x4F, 0x69,
+    0xBF, 0xCD, 0x2B, 0x4D, 0x05, 0x13, 0x3D, 0xB1, 0xF2, 0x47, 0x7B, 0x5D, 0x23, 0xDC, 0xB4, 0x6C,
+    0xCA, 0x4E, 0xA8, 0x6C, 0x2C, 0x64, 0x6A, 0xBD, 0xEF, 0x16, 0x6E, 0x93, 0x60, 0xE4, 0xB6, 0x1A,
+    0xAD, 0x17, 0xD3, 0x86, 0x7D, 0x66, 0xB2, 0x5C, 0x3F, 0x54, 0x45, 0xFC, 0x6A, 0x00, 0x4D, 0x4A,
+    0xC6, 0x90, 0xC0, 0x5B, 0x82, 0xFB, 0x3F, 0xE9, 0x6D, 0xA8, 0x7E, 0x0F, 0xB5, 0x43, 0xDF, 0xFD,
+    0x1B, 0x50, 0xDA, 0xD2, 0xED, 0xD3, 0xC1, 0x04, 0x9C, 0x11, 0xB6, 0x9D, 0xFD, 0x2E, 0x58, 0x9E,
+    0xFB, 0x1B, 0x01, 0xA5, 0x11, 0x11, 0x76, 0xC4, 0xC4, 0x36, 0xF1, 0xC0, 0x50, 0x8C, 0x00, 0x73,
+    0x1F, 0x58, 0xEA, 0xBA, 0x47, 0x80, 0xAD, 0x6C, 0x79, 0xC5, 0x74, 0xBE, 0x48, 0xBC, 0xFD, 0x69,
+    0xCB, 0x8E, 0x8F, 0x66, 0x78, 0x71, 0x38, 0x45, 0xD6, 0x51, 0xCD, 0x84, 0x08, 0xF2, 0xEC, 0x91,
+    0xBE, 0x6B, 0xAD, 0x17, 0x63, 0x96, 0xB7, 0x72, 0x1D, 0xEF, 0xBB, 0x85, 0xE9, 0xDE, 0xE5, 0x6A,
+    0x2C, 0x67, 0x05, 0xF7, 0x2E, 0x57, 0x9F, 0xBD, 0x08, 0x03, 0x81, 0x97, 0x7C, 0x50, 0x36, 0x59,
+    0x81, 0xCC, 0xAD, 0x48, 0xBE, 0xC3, 0x26, 0xB7, 0x1F, 0x67, 0xA2, 0x13, 0x75, 0x51, 0x7E, 0x0A,
+    0x66, 0xCD, 0x4E, 0x83, 0x00, 0xC2, 0xE1, 0x79, 0x2F, 0x18, 0x84, 0x6F, 0x0C, 0xA2, 0xF2, 0xF6,
+    0xA5, 0x17, 0x77, 0x99, 0xF0, 0x9E, 0x08, 0xD7, 0x81, 0x6F, 0x5C, 0xA4, 0xB8, 0x40, 0xE5, 0x7E,
+    0x96, 0x91, 0xC5, 0x01, 0x5B, 0xC2, 0x28, 0x1A, 0xDC, 0x93, 0xD2, 0x34, 0x6A, 0x54, 0xF6, 0xF2,
+    0x29, 0xEF, 0x62, 0x29, 0x4C, 0x2A, 0x5A, 0xD4, 0xE1, 0xE2, 0x42, 0xD0, 0xDF, 0xAF, 0xDB, 0x42,
+    0x6F, 0x80, 0x3D, 0xB5, 0xA2, 0xC9, 0x78, 0xA3, 0xB7, 0x99, 0x61, 0x6C, 0x5F, 0x4D, 0x83, 0xEC,
+    0xE7, 0xFE, 0x5F, 0x5B, 0x8B, 0x88, 0xB0, 0xA2, 0xBA, 0xF3, 0xC6, 0xF5, 0x7A, 0x0C, 0xEC, 0x5E,
+    0x0C, 0x5B, 0x04, 0x7F, 0x1D, 0x37, 0x1A, 0xF7, 0x1E, 0x55, 0x49, 0x77, 0x1A, 0x8E, 0xB7, 0x71,
+    0x91, 0xD0, 0x58, 0x9D, 0x00, 0x2F, 0x88, 0x3B, 0x8C, 0x79, 0x02, 0xA2, 0xA9, 0x2D, 0x96, 0x77,
+    0xCB, 0x74, 0x91, 0x7B, 0x17, 0x2C, 0xBE, 0xAC, 0xBF, 0x07, 0xA5, 0xE2, 0x3A, 0xF9, 0x68, 0x8A,
+    0xCF, 0xD5, 0xBD, 0x9A, 0xDE, 0xCA, 0x26, 0xA4, 0x71, 0xE4, 0xAC, 0x77, 0xC2, 0x6A, 0x94, 0x43,
+    0x6A, 0xA3, 0x44, 0x7B, 0xC4, 0x1D, 0x8D, 0x31, 0xA5, 0x56, 0x36, 0xC4, 0xC0, 0xDE, 0x1E, 0x8F,
+    0xC7, 0x6F, 0x8F, 0xC7, 0x17, 0xD5, 0x7A, 0x6F, 0x30, 0x26, 0xC8, 0xB0, 0x32, 0x8D, 0xFE, 0x9D,
+    0xB6, 0x5D, 0x88, 0xD2, 0x9D, 0xC5, 0xFD, 0x09, 0xCC, 0xE7, 0xA4, 0x5D, 0xC8, 0xE7, 0x96, 0xCD,
+    0x81, 0x69, 0x69, 0x45, 0x66, 0xBF, 0x84, 0xA8, 0xC9, 0x6F, 0x94, 0xE1, 0xD8, 0x98, 0x10, 0x15,
+    0x3B, 0xD5, 0xE9, 0xAE, 0x39, 0x72, 0xE4, 0x3A, 0xF6, 0x37, 0x0E, 0x9E, 0xFB, 0x21, 0x60, 0x6E,
+    0xB0, 0xA5, 0x8F, 0x35, 0xBC, 0x97, 0x4D, 0xBC, 0x80, 0x6A, 0xA8, 0xE9, 0x5A, 0xA7, 0x18, 0x03,
+    0x56, 0xF7, 0x00, 0xF5, 0xE3, 0xB0, 0x85, 0x51, 0xEF, 0xF7, 0x4D, 0x27, 0xDB, 0xA0, 0x4F, 0x1E,
+    0x79, 0xBC, 0xF6, 0x29, 0x69, 0x5E, 0x75, 0xA4, 0x99, 0xD6, 0xD5, 0x5A, 0xF5, 0x7B, 0xF2, 0xE4,
+    0x1C, 0x7C, 0x39, 0xB6, 0xB3, 0x27, 0xA8, 0x5F, 0xC6, 0xC3, 0x7A, 0x58, 0xBD, 0xF7, 0x67, 0x49,
+    0xE0, 0x56, 0x5E, 0x7C, 0xA4, 0xEC, 0x8C, 0x5E, 0xAA, 0x31, 0x47, 0x0C, 0x22, 0xCF, 0x61, 0xF5,
+    0xF2, 0xC0, 0xA6, 0xA0, 0x68, 0x52, 0x1E, 0x3D, 0x7B, 0x22, 0xD1, 0xE8, 0x31, 0x54, 0xFC, 0x1F,
+    0xB2, 0xA6, 0xA9, 0x09, 0x1E, 0xB0, 0x5D, 0xA9, 0xA6, 0x59, 0xF2, 0xBD, 0x18, 0x87, 0xCE, 0x61,
+    0x76, 0xD4, 0xAB, 0x30, 0xE6, 0x7B, 0x45, 0x33, 0xF9, 0x83, 0xE9, 0x25, 0x08, 0x8E, 0xEF, 0x90,
+    0x48, 0x0C, 0x0F, 0xDC, 0x50, 0x6A, 0xFC, 0x7B, 0xB6, 0x7C, 0xB2, 0x64, 0x72, 0x29, 0x24, 0xAE,
+    0x1E, 0xB1, 0x71, 0xA0, 0x8C, 0x81, 0x2B, 0x79, 0x89, 0x1F, 0x75, 0x32, 0xE4, 0x47, 0xA8, 0x91,
+    0xEC, 0x8D, 0xEE, 0x2F, 0x36, 0xA5, 0x66, 0xA1, 0x59, 0x2F, 0x85, 0xB7, 0x50, 0xA7, 0x6F, 0xE5,
+    0xD9, 0x70, 0xCE, 0xC6, 0x67, 0xBE, 0x5D, 0x28, 0x92, 0x05, 0xF5, 0xFF, 0xF8, 0xA0, 0xE5, 0xE4,
+    0x35, 0x49, 0xDA, 0x61, 0xFE, 0xF2, 0xE6, 0x1B, 0x49, 0x4F, 0xC7, 0x44, 0xBB, 0x9B, 0xF4, 0x09,
+    0xD3, 0x99, 0x5F, 0x8B, 0x87, 0x67, 0x28, 0x0F, 0xF4, 0xD1, 0xC0, 0x10, 0xB5, 0xFF, 0xDB, 0x85,
+    0xCC, 0xB3, 0x88, 0x3E, 0x6B, 0xC2, 0x25, 0x23, 0x99, 0x4C, 0x15, 0x6A, 0xD2, 0xAD, 0x61, 0x34,
+    0x15, 0x1B, 0x1A, 0x55, 0xA8, 0x01, 0x8A, 0x96, 0xC1, 0x4C, 0xFB, 0xDF, 0x53, 0x18, 0x25, 0xD2,
+    0xAB, 0x19, 0xAC, 0x8B, 0x76, 0x89, 0xED, 0x21, 0x2F, 0x64, 0xAE, 0x90, 0x2F, 0x0D, 0x73, 0x1F,
+    0x33, 0xB2, 0x85, 0xBA, 0x44, 0xAC, 0x4C, 0x41, 0x5F, 0xB2, 0xBE, 0x53, 0x6B, 0xD1, 0xDF, 0x41,
+    0x07, 0x45, 0x06, 0xD9, 0x43, 0xFF, 0x84, 0x5D, 0xEC, 0x82, 0xDA, 0x84, 0x4C, 0xAF, 0xC2, 0x79,
+    0x91, 0x30, 0x76, 0x2E, 0x5C, 0x7C, 0x63, 0x85, 0x54, 0xC9, 0x60, 0xB9, 0x5B, 0x43, 0x5D, 0xF3,
+    0x97, 0x7F, 0x52, 0x52, 0x62, 0x59, 0xBD, 0x93, 0x33, 0x7A, 0xAB, 0xEE, 0xF2, 0x95, 0x2A, 0x7E,
+    0x1A, 0x03, 0x97, 0xDB, 0x8D, 0x24, 0x2F, 0x38, 0x5F, 0x6A, 0x7F, 0x71, 0xDE, 0x17, 0xCF, 0xE5,
+    0x0C, 0xE8, 0x7A, 0x7F, 0x5A, 0x78, 0xF5, 0x45, 0x9A, 0xE1, 0x44, 0x86, 0x7E, 0x65, 0xF5, 0x6A,
+    0xEF, 0xED, 0x06, 0x78, 0xEA, 0x8B, 0x84, 0x9B, 0xDA, 0x3E, 0x43, 0x04, 0x03, 0xFA, 0x68, 0xE1,
+    0xE2, 0xA3, 0x9C, 0x97, 0x0C, 0x94, 0xE1, 0x97, 0x6B, 0x18, 0x90, 0x46, 0x29, 0xDF, 0xB9, 0xF6,
+    0xCA, 0xFE, 0x15, 0x4E, 0x77, 0x8D, 0xAD, 0xEB, 0x64, 0x9B, 0x86, 0x56, 0xC4, 0x24, 0xD8, 0x67,
+    0x7F, 0xA8, 0x8A, 0xE7, 0x2C, 0x19, 0x4D, 0x61, 0x7D, 0x67, 0x98, 0x93, 0xF3, 0x3F, 0x6B, 0x8E,
+    0x8F, 0xEE, 0xEE, 0x7A, 0x6C, 0x15, 0xF0, 0x1C, 0x1F, 0x5F, 0xA1, 0x72, 0x02, 0x5A, 0xD3, 0xF0,
+    0xFB, 0xFA, 0xB4, 0xFF, 0xC6, 0xA6, 0x54, 0x3D, 0xC7, 0xE4, 0xD9, 0xDC, 0x6E, 0xE8, 0x6B, 0x8F,
+    0xBD, 0x80, 0x23, 0x60, 0xD8, 0xB8, 0x60, 0xD9, 0xCD, 0xBA, 0x68, 0x65, 0x6F, 0x66, 0x2C, 0x5B,
+    0xAC, 0xAD, 0x2B, 0xFC, 0xB2, 0xF5, 0xDE, 0x7F, 0x13, 0x3E, 0x72, 0x0D, 0x85, 0xB4, 0xB9, 0xB1,
+    0x6B, 0xAC, 0xF1, 0x98, 0xF0, 0xFC, 0xDA, 0xAD, 0x8D, 0x93, 0x36, 0x61, 0xF7, 0xFB, 0x09, 0xA7,
+    0xFD, 0x26, 0x9E, 0xEE, 0xA7, 0xA1, 0xFE, 0xD6, 0x90, 0x66, 0xA6, 0x1C, 0x68, 0x0C, 0xEE, 0x13,
+    0x76, 0x19, 0xED, 0xA0, 0xBF, 0xF9, 0x10, 0xAC, 0x20, 0xA5, 0x26, 0xB4, 0x32, 0xD1, 0xC6, 0x5F,
+    0xCD, 0xDC, 0xF2, 0x94, 0xF7, 0x61, 0x42, 0x85, 0xEC, 0x7A, 0x5E, 0xAE, 0x33, 0x7F, 0x09, 0x76,
+    0x5F, 0x68, 0x6E, 0x73, 0x0D, 0xF7, 0x1A, 0x7D, 0xD6, 0x90, 0x3F, 0xF0, 0xB3, 0xD0, 0xF7, 0xB7,
+    0x81, 0x35, 0xDD, 0xAF, 0xB6, 0x6C, 0xB0, 0xB6, 0x4C, 0xD1, 0x25, 0xB4, 0xD7, 0xC7, 0xBA, 0x5D,
+    0x4F, 0xBF, 0x9F, 0xAE, 0x73, 0x9F, 0x53, 0xF2, 0xAD, 0x69, 0x2D, 0x00, 0x96, 0x75, 0x11, 0x31,
+    0x8C, 0xC0, 0x14, 0x07, 0x32, 0x17, 0x22, 0x71, 0x41, 0x2F, 0x96, 0x7E, 0xA5, 0xCE, 0x70, 0xB0,
+    0x3F, 0xB3, 0x88, 0x85, 0x36, 0x70, 0x74, 0x35, 0x8F, 0x5E, 0x4C, 0x74, 0xF6, 0xD3, 0x9C, 0x13,
+    0xB8, 0xA3, 0x4F, 0xDE, 0x75, 0x79, 0x89, 0x7C, 0xDE, 0xA0, 0xD3, 0xD2, 0xD3, 0x0A, 0x19, 0x74,
+    0x9A, 0x58, 0xA3, 0x91, 0x7E, 0x1A, 0x48, 0xE2, 0x25, 0xDF, 0xEF, 0x69, 0x2A, 0x8C, 0x7A, 0xE4,
+    0x25, 0x66, 0x51, 0x0F, 0x79, 0x7A, 0x2F, 0x62, 0x1C, 0xF9, 0x61, 0xD4, 0x63, 0xFA, 0xAE, 0x46,
+    0x36, 0x68, 0xBF, 0x17, 0x4A, 0xF7, 0xFB, 0xA8, 0x97, 0xBE, 0x87, 0x5D, 0x04, 0xE5, 0x3E, 0x6A,
+    0xA3, 0x5E, 0x96, 0x42, 0x22, 0x3F, 0xC9, 0x44, 0xD4, 0x2B, 0xF9, 0x9C, 0x48, 0x0D, 0x63, 0xA4,
+    0xE2, 0xD7, 0x3C, 0x7B, 0x3B, 0x6F, 0xD7, 0xDB, 0xCA, 0xAF, 0xD0, 0x1B, 0xFF, 0x7F, 0x53, 0x99,
+    0xF9, 0x09, 0xFB, 0xD2, 0x30, 0x45, 0x12, 0xB9, 0x27, 0x30, 0x5A, 0x6A, 0x8C, 0xBB, 0x7C, 0xEC,
+    0x42, 0x7D, 0x45, 0xE0, 0x6B, 0x25, 0x5E, 0xA6, 0x2F, 0x31, 0x74, 0x7D, 0x09, 0x97, 0x73, 0x5B,
+    0x62, 0xE5, 0x35, 0xA5, 0x10, 0x63, 0x5C, 0x95, 0xC2, 0xA8, 0xD2, 0xA6, 0x94, 0xB1, 0xAC, 0xBB,
+    0x32, 0x94, 0xC7, 0xF7, 0xA5, 0xEC, 0x41, 0x1A, 0xCF, 0xB3, 0x70, 0x44, 0xED, 0x6B, 0x74, 0x4F,
+    0xE1, 0x72, 0x3B, 0xCD, 0xB4, 0x3B, 0x01, 0xC4, 0xB5, 0x0B, 0x8B, 0x4E, 0xB2, 0xC6, 0xB6, 0x52,
+    0x0E, 0x24, 0x5A, 0x3B, 0x1C, 0x4B, 0xB4, 0x76, 0xE3, 0xDE, 0xB6, 0x0E, 0x39, 0xA2, 0x86, 0x39,
+    0x9F, 0x4B, 0xDB, 0xEA, 0x9D, 0xCA, 0x68, 0x93, 0xB6, 0xAC, 0x0D, 0x4B, 0xFF, 0x1A, 0xFD, 0xDD,
+    0x80, 0xF7, 0x42, 0xDE, 0xC4, 0x9F, 0xC1, 0x25, 0xC4, 0x56, 0x38, 0xD8, 0x84, 0x97, 0x4C, 0xCD,
+    0xCB, 0xD2, 0xDA, 0x0B, 0x91, 0x25, 0xC1, 0xDC, 0xCD, 0x70, 0xB0, 0x81, 0x76, 0x57, 0xC3, 0x41,
+    0xED, 0x0D, 0xF2, 0xB0, 0x41, 0xB3, 0x21, 0xFD, 0x3E, 0x1C, 0x34, 0x9A, 0x33, 0xEC, 0xA9, 0x1C,
+    0xCB, 0xBB, 0xC5, 0xF8, 0x1D, 0x32, 0x07, 0x3E, 0x2C, 0xC7, 0x70, 0x38, 0x8F, 0xAD, 0x6F, 0x55,
+    0x1B, 0x79, 0xC6, 0xDA, 0x14, 0x05, 0x02, 0xC3, 0x3B, 0x80, 0xF0, 0x99, 0x32, 0x8F, 0x05, 0xBE,
+    0x54, 0x46, 0xB2, 0xBB, 0x52, 0x7C, 0x58, 0x2B, 0x1E, 0x72, 0xC5, 0x3D, 0xC3, 0x52, 0x84, 0x7A,
+    0x52, 0x6A, 0x98, 0x21, 0x9C, 0x73, 0x2E, 0xF9, 0x05, 0x4C, 0xE7, 0xCA, 0xC7, 0xB0, 0x91, 0x78,
+    0xCF, 0xA4, 0x7F, 0x47, 0xF6, 0xB3, 0x97, 0xFE, 0x2D, 0x8C, 0xAD, 0x42, 0x88, 0x0D, 0x19, 0xD1,
+    0xBB, 0x69, 0x43, 0xC6, 0xD3, 0xCB, 0x1C, 0xC9, 0xC2, 0x0A, 0x04, 0x23, 0xDA, 0x27, 0x04, 0x6E,
+    0x9F, 0x33, 0xD9, 0x22, 0x6D, 0xE0, 0x2E, 0xC9, 0x97, 0xE9, 0x8F, 0xA4, 0x73, 0xAE, 0x54, 0x84,
+    0xC3, 0xA2, 0xDA, 0x1F, 0xD7, 0x8D, 0x12, 0x51, 0x66, 0xF5, 0xDE, 0xCB, 0x56, 0x0A, 0x5D, 0xA8,
+    0x44, 0xAF, 0x36, 0x8D, 0xDA, 0x5A, 0x04, 0xF3, 0x86, 0x19, 0x42, 0xC2, 0x77, 0x34, 0x97, 0x2E,
+    0x1E, 0x16, 0x36, 0xA5, 0xB7, 0xB7, 0x41, 0x54, 0x63, 0x65, 0x13, 0xEB, 0x18, 0xDF, 0x3B, 0xE4,
+    0x7F, 0xC6, 0x62, 0x21, 0x9D, 0xBA, 0xEE, 0x61, 0x52, 0x71, 0xAE, 0x7B, 0x0D, 0x87, 0xB3, 0x2E,
+    0x7C, 0xD9, 0x81, 0x74, 0xAE, 0x44, 0x3C, 0x83, 0x51, 0x42, 0x5D, 0xF9, 0x30, 0xF9, 0xAD, 0x5D,
+    0xFA, 0x0B, 0xEB, 0xD2, 0x87, 0x3B, 0x35, 0x36, 0x37, 0x02, 0x73, 0x84, 0x8C, 0x41, 0x11, 0x44,
+    0xBA, 0xB5, 0xE0, 0xA6, 0xB9, 0x1B, 0x56, 0x24, 0xA9, 0x28, 0x47, 0xCB, 0xB8, 0x32, 0x79, 0xB0,
+    0xE7, 0x1B, 0x06, 0x4B, 0xCD, 0x53, 0x1E, 0x55, 0x71, 0xCC, 0xBF, 0xCF, 0xD7, 0x3A, 0xF8, 0xE4,
+    0x48, 0x9D, 0x1F, 0x74, 0x03, 0xFD, 0xCB, 0x0A, 0x06, 0xD1, 0xF2, 0xA5, 0x25, 0x28, 0xB3, 0xF6,
+    0x97, 0x98, 0xD2, 0xD1, 0x87, 0x19, 0x25, 0x58, 0x52, 0x5E, 0x0E, 0x05, 0x05, 0x30, 0x50, 0xCA,
+    0xDD, 0x46, 0xB5, 0xC3, 0xD5, 0xB2, 0x3C, 0x44, 0x35, 0xCE, 0x3B, 0x53, 0xE4, 0xA6, 0x3D, 0xDF,
+    0x97, 0x36, 0xE9, 0x52, 0xD8, 0x96, 0x46, 0x2B, 0xDB, 0xF4, 0xDC, 0x82, 0x63, 0x7E, 0xA5, 0x99,
+    0xF2, 0xB1, 0x52, 0x4B, 0xB6, 0xF2, 0x8C, 0xD7, 0x6D, 0xD9, 0x89, 0x85, 0xCB, 0xCD, 0x9A, 0xC6,
+    0xDF, 0xAC, 0xA7, 0xC0, 0xAC, 0x67, 0x81, 0x2B, 0x4A, 0x27, 0xC2, 0x50, 0xDA, 0x74, 0x85, 0x2B,
+    0x64, 0x93, 0xEA, 0xBD, 0xF5, 0x62, 0x39, 0x5A, 0xAF, 0x16, 0x4D, 0xCC, 0xC2, 0xBC, 0x7C, 0xCF,
+    0x9A, 0x03, 0xDD, 0xD4, 0x30, 0xA5, 0x57, 0x66, 0xA5, 0xB0, 0xE1, 0x9B, 0x39, 0x03, 0x9E, 0xCC,
+    0x7A, 0x8E, 0x8C, 0x8D, 0xB4, 0x68, 0xED, 0x26, 0xC7, 0x99, 0xD2, 0x2C, 0x62, 0x4E, 0x92, 0x06,
+    0x9D, 0xE5, 0x95, 0xAE, 0x2A, 0x37, 0x65, 0x58, 0x38, 0xD0, 0xD1, 0xC2, 0x15, 0xF3, 0x6D, 0xFA,
+    0x27, 0xCC, 0x0D, 0x1F, 0x11, 0xB1, 0x2B, 0xCC, 0x9D, 0x99, 0xCD, 0x1D, 0x16, 0x4F, 0x4E, 0x87,
+    0xB1, 0xAC, 0x9E, 0xDC, 0x16, 0xDA, 0x28, 0x52, 0xDA, 0xB1, 0x75, 0xE3, 0x08, 0x98, 0x0D, 0x27,
+    0x43, 0x1E, 0x37, 0x76, 0xB7, 0x4D, 0x75, 0x09, 0xE5, 0xD5, 0x65, 0x6D, 0x24, 0xED, 0xA0, 0x8D,
+    0xE8, 0xB3, 0xCE, 0x6D, 0x1F, 0xCC, 0x9A, 0x3B, 0xBE, 0x32, 0xD6, 0xAC, 0xB6, 0x20, 0xE3, 0x55,
+    0xD2, 0xD8, 0x28, 0x63, 0x5F, 0xD2, 0x6D, 0x21, 0x9F, 0x2E, 0x75, 0xD7, 0x2D, 0x8B, 0x52, 0x37,
+    0x29, 0x23, 0xE2, 0x18, 0x16, 0x93, 0x90, 0x21, 0x83, 0xAD, 0x0C, 0xE6, 0x57, 0x46, 0xE7, 0x39,
+    0x93, 0x2E, 0x62, 0xD3, 0x25, 0x58, 0x4F, 0x6D, 0x62, 0xE0, 0x0D, 0xEB, 0xB0, 0x5C, 0xAE, 0x61,
+    0x97, 0xCC, 0x62, 0x04, 0xB6, 0x7D, 0x62, 0x77, 0x13, 0xBA, 0xA2, 0x62, 0x53, 0xCB, 0x80, 0x88,
+    0xA6, 0x57, 0xC8, 0xDD, 0x72, 0xAC, 0xD3, 0xAC, 0x7D, 0xDF, 0xAE, 0x1D, 0x6E, 0xDC, 0xE4, 0x81,
+    0x64, 0x89, 0x36, 0xB8, 0x8C, 0xC1, 0x72, 0x1E, 0xF2, 0x5F, 0x05, 0x5C, 0x9F, 0x72, 0xE4, 0xE9,
+    0x8C, 0xE2, 0x16, 0x9E, 0x4C, 0xA9, 0x9C, 0x33, 0xD0, 0xBB, 0x3C, 0x92, 0x92, 0xE9, 0x00, 0x85,
+    0x48, 0x4A, 0xB2, 0x56, 0x10, 0xDE, 0x95, 0x5F, 0xDF, 0xC8, 0x51, 0x91, 0xD6, 0x41, 0x97, 0xB7,
+    0xE7, 0xCD, 0x80, 0x0C, 0x79, 0x91, 0x3F, 0x6E, 0xBC, 0x44, 0xDE, 0x75, 0x74, 0xAE, 0x40, 0xFE,
+    0x72, 0x87, 0xDB, 0x2D, 0x2E, 0xC8, 0x46, 0xFE, 0x3A, 0x74, 0x15, 0x24, 0xF3, 0x31, 0x04, 0x20,
+    0xFD, 0xF4, 0xA0, 0xB5, 0x36, 0x53, 0x10, 0x67, 0x06, 0xE0, 0xAB, 0xA6, 0x1A, 0xB1, 0x3F, 0xD2,
+    0xB3, 0x63, 0x04, 0xCA, 0x70, 0x53, 0xD8, 0xAF, 0x5B, 0xE7, 0x98, 0x0B, 0xD6, 0x46, 0xB6, 0xD5,
+    0x64, 0x64, 0x5B, 0xDA, 0x2E, 0xFF, 0xA1, 0x69, 0x35, 0x4B, 0x35, 0xFF, 0xA9, 0xD3, 0x21, 0x57,
+    0x0A, 0xCE, 0xC9, 0x7A, 0x79, 0xA9, 0x36, 0x1A, 0x1A, 0xE6, 0x1F, 0x17, 0xA9, 0x15, 0x9F, 0x56,
+    0xC8, 0x58, 0x30, 0x0B, 0x87, 0x43, 0x46, 0xF3, 0x18, 0x88, 0xCD, 0x49, 0xAB, 0xB2, 0x53, 0xD2,
+    0xAA, 0x32, 0x78, 0x4F, 0x18, 0x4B, 0xB8, 0x55, 0x0D, 0x52, 0xB1, 0x88, 0x43, 0x6D, 0xC0, 0x58,
+    0x44, 0xC6, 0x09, 0x40, 0x43, 0x60, 0x16, 0x5D, 0xB2, 0x48, 0x5A, 0x0D, 0xA6, 0xB1, 0xC9, 0xC2,
+    0x5F, 0xAF, 0xC7, 0xA3, 0x79, 0xDD, 0x8E, 0x5B, 0x63, 0x4B, 0xE6, 0x36, 0xBD, 0xF7, 0x9C, 0x72,
+    0x49, 0x30, 0x1C, 0x55, 0x97, 0xBF, 0x36, 0xD3, 0xF5, 0xEE, 0x0E, 0x16, 0xE5, 0x88, 0xCD, 0xEC,
+    0x39, 0x81, 0xD1, 0x52, 0x08, 0x75, 0x2F, 0x80, 0x71, 0x7C, 0x4F, 0xC6, 0x11, 0x30, 0x27, 0xCC,
+    0x08, 0xD3, 0x19, 0x4C, 0x66, 0x50, 0x7F, 0xF3, 0x0C, 0xE1, 0x0E, 0xE1, 0x2E, 0x53, 0x53, 0x0F,
+    0xE5, 0xBD, 0xF7, 0x90, 0x04, 0xD8, 0xEE, 0x09, 0xEF, 0x49, 0x6F, 0xEC, 0x1D, 0x34, 0x9A, 0x8A,
+    0x8C, 0x05, 0x05, 0x7A, 0xF2, 0x2F, 0xDF, 0x73, 0x6F, 0xBD, 0xD3, 0x32, 0xEC, 0x2A, 0x6B, 0x37,
+    0x2A, 0xC9, 0x32, 0xD2, 0x36, 0xD1, 0x0C, 0xBB, 0xD6, 0xD3, 0xA8, 0x8E, 0x75, 0x86, 0x5D, 0xA5,
+    0x19, 0x76, 0x08, 0xBE, 0x35, 0x07, 0x30, 0x77, 0x40, 0x07, 0x88, 0x46, 0x68, 0xE9, 0x66, 0x84,
+    0xB2, 0x75, 0x13, 0xB9, 0x75, 0x67, 0x5D, 0x6E, 0x9D, 0x5E, 0x3F, 0xCF, 0xB0, 0x63, 0xD6, 0xDE,
+    0xA0, 0x19, 0x76, 0xCC, 0xE6, 0x6B, 0x99, 0x61, 0x07, 0xEB, 0x3E, 0xAC, 0x2E, 0xF9, 0x58, 0x6F,
+    0x66, 0xD8, 0xA9, 0x79, 0xBC, 0x16, 0x02, 0x0D, 0xC7, 0x2B, 0xF0, 0x7C, 0x23, 0x36, 0x86, 0x41,
+    0x97, 0x08, 0x1F, 0x2D, 0xB1, 0xA7, 0xD4, 0xB8, 0x0B, 0x38, 0x69, 0x6B, 0xCC, 0x51, 0xD2, 0x49,
+    0x47, 0xEA, 0x0E, 0x16, 0xA8, 0x6E, 0xF4, 0xCE, 0xCA, 0x8F, 0xF8, 0x03, 0x2F, 0x29, 0x3D, 0xB5,
+    0xA5, 0x73, 0x7F, 0x2B, 0x61, 0xBC, 0x1A, 0xF5, 0xA6, 0x50, 0x04, 0xF4, 0x41, 0xDC, 0xE9, 0xB3,
+    0x56, 0x9D, 0x22, 0x3D, 0xA4, 0xCF, 0xC0, 0xB0, 0xC6, 0x45, 0xD8, 0x5F, 0x84, 0x0A, 0x09, 0xDD,
+    0x74, 0x54, 0x4D, 0xDA, 0xA8, 0x89, 0x40, 0xDE, 0x33, 0x55, 0xA6, 0xB1, 0xA3, 0x26, 0xDA, 0x3D,
+    0xD5, 0xBD, 0x0F, 0x95, 0xD4, 0xAE, 0xEA, 0x0A, 0x1B, 0x74, 0x19, 0x52, 0x49, 0x75, 0x99, 0x3C,
+    0x41, 0xCB, 0xC5, 0xA8, 0x3E, 0xBC, 0x51, 0x8D, 0x35, 0xB5, 0x1A, 0xB3, 0xCB, 0x3F, 0xD0, 0xDC,
+    0xA8, 0xBF, 0x50, 0x4A, 0xFD, 0x5F, 0x2A, 0xFD, 0xFE, 0x1F, 0xA5, 0x5F, 0x9B, 0xBC, 0xB2, 0xD8,
+    0x88, 0x26, 0x70, 0x32, 0xA8, 0x5F, 0xC0, 0xF7, 0x97, 0xF5, 0x07, 0xF2, 0x46, 0xF5, 0x20, 0xEC,
+    0xDE, 0x5F, 0xBC, 0x03, 0xCD, 0xAE, 0xA3, 0x12, 0x47, 0x47, 0x9C, 0x66, 0x80, 0x31, 0x01, 0x4C,
+    0x6D, 0x31, 0x45, 0xC2, 0x9E, 0xEF, 0x90, 0x01, 0x32, 0x07, 0xAC, 0xDB, 0x65, 0xB7, 0xA9, 0x5C,
+    0xF7, 0xEF, 0xB2, 0xD3, 0x8C, 0x02, 0xA4, 0x96, 0xED, 0xAF, 0xB8, 0x92, 0x74, 0xB9, 0x58, 0xDF,
+    0x3C, 0x7A, 0xFD, 0x6C, 0x45, 0x4D, 0x30, 0x6D, 0x6B, 0x4D, 0x1F, 0xE0, 0x2F, 0x83, 0x85, 0x5A,
+    0x20, 0xAE, 0x69, 0xEE, 0x57, 0xA6, 0xBE, 0xEE, 0xB3, 0x33, 0x1B, 0xDA, 0x63, 0x3D, 0xE4, 0xC1,
+    0x5B, 0x5F, 0x07, 0x85, 0x53, 0x3A, 0xF1, 0x56, 0xE4, 0xC0, 0xB9, 0xAF, 0xD9, 0x54, 0xEF, 0xE1,
+    0xD2, 0x96, 0x96, 0xB8, 0xC2, 0xDF, 0xF0, 0xF7, 0x7C, 0x79, 0x53, 0x34, 0xFF, 0x3A, 0x37, 0x8B,
+    0xB7, 0xCF, 0xA7, 0xF8, 0x08, 0x6C, 0xF4, 0xB1, 0x13, 0xA2, 0xB5, 0x22, 0x96, 0x37, 0x55, 0x82,
+    0x72, 0x29, 0x99, 0x8C, 0x0F, 0xA9, 0xD6, 0x09, 0x79, 0x2E, 0xC9, 0x8D, 0x0E, 0x8A, 0xFF, 0x49,
+    0xEB, 0x2F, 0xFF, 0x9E, 0xFE, 0xA2, 0x16, 0x91, 0x70, 0x64, 0x50, 0x3A, 0x0B, 0x1A, 0x84, 0xCC,
+    0x7A, 0xD0, 0xDC, 0x5A, 0x21, 0x08, 0x53, 0x58, 0x2E, 0x80, 0xB2, 0x14, 0x6C, 0x8B, 0x5C, 0x17,
+    0x4F, 0xED, 0x25, 0xDE, 0x5D, 0xDB, 0x70, 0xE2, 0x78, 0xB6, 0x2D, 0xD4, 0xB0, 0xE3, 0xD9, 0xFB,
+    0x40, 0x0A, 0xF7, 0xEC, 0xFD, 0x65, 0x94, 0x0E, 0xB5, 0x5F, 0xD2, 0xBF, 0xAC, 0xB9, 0x6A, 0xFB,
+    0xD3, 0x0A, 0x45, 0x0E, 0x53, 0x3F, 0x93, 0x5F, 0x68, 0xE8, 0x3D, 0xC6, 0x23, 0xFA, 0xD7, 0x4E,
+    0xDF, 0x4B, 0x08, 0x36, 0xFC, 0xAC, 0xA1, 0xB4, 0x87, 0x3D, 0x87, 0xA6, 0x23, 0x5F, 0xD3, 0x59,
+    0x35, 0x5B, 0xA0, 0xBC, 0xC9, 0xF1, 0xA9, 0xB5, 0x3C, 0x05, 0xD5, 0xAA, 0xD7, 0xD5, 0x15, 0x5B,
+    0x68, 0xB5, 0x8B, 0xF5, 0xD7, 0xB5, 0x59, 0x7B, 0xB1, 0x6E, 0xCE, 0x7D, 0x23, 0xD1, 0x5A, 0xD0,
+    0x5A, 0x7B, 0xF9, 0x21, 0xA7, 0xCC, 0xCC, 0x13, 0xAB, 0x99, 0x21, 0xF1, 0x68, 0xED, 0x26, 0xB4,
+    0x46, 0x90, 0x96, 0xA1, 0x0D, 0x0D, 0x98, 0xD7, 0x81, 0xA9, 0xCE, 0x8B, 0xFC, 0xD6, 0xF9, 0x63,
+    0x4C, 0x83, 0x20, 0x58, 0x9B, 0xAA, 0x0C, 0x60, 0x90, 0xDF, 0x5B, 0xC2, 0x40, 0x0A, 0xC6, 0xF7,
+    0xA3, 0x15, 0x28, 0xCC, 0xB2, 0xCA, 0x90, 0xA5, 0x62, 0x64, 0x07, 0xC5, 0xC8, 0x8F, 0xAC, 0x10,
+    0x88, 0x30, 0x60, 0xB6, 0x58, 0xA4, 0x83, 0xAD, 0xA4, 0x4D, 0x75, 0xCD, 0x75, 0x49, 0xAF, 0x85,
+    0x49, 0x12, 0x51, 0x82, 0x77, 0x3D, 0xBD, 0x4B, 0x88, 0x52, 0x27, 0x64, 0xA9, 0xFE, 0x72, 0xE0,
+    0x78, 0xCA, 0xFF, 0x15, 0x63, 0x5D, 0xE9, 0x61, 0x61, 0xB5, 0x3C, 0xB2, 0xF4, 0xD6, 0xB3, 0x6C,
+    0x56, 0xD3, 0x74, 0xC1, 0x6B, 0xD3, 0xCA, 0xBD, 0x51, 0x3A, 0xBD, 0xF4, 0xDA, 0xCF, 0x73, 0x61,
+    0x6A, 0x2D, 0xB7, 0xAA, 0x16, 0x39, 0x31, 0x47, 0x15, 0x9C, 0x76, 0xF2, 0x09, 0xB9, 0x9B, 0x64,
+    0x9B, 0xD5, 0x23, 0x6C, 0x64, 0x52, 0x32, 0x0F, 0x49, 0x4A, 0x35, 0x65, 0xB4, 0xFE, 0xE7, 0x95,
+    0x2C, 0x8C, 0x60, 0x0C, 0xAE, 0xA7, 0x5A, 0xCF, 0x20, 0x64, 0x5A, 0x3D, 0x08, 0x3E, 0x53, 0x75,
+    0x98, 0xBD, 0xAD, 0x6D, 0xA7, 0x2B, 0x5B, 0xE7, 0xB1, 0x56, 0x2F, 0xB3, 0xB9, 0x33, 0xB2, 0x57,
+    0xDA, 0xCF, 0x95, 0x7A, 0x17, 0xBD, 0x67, 0x61, 0x9F, 0x80, 0xE7, 0x41, 0xB1, 0x1F, 0xEC, 0x52,
+    0xF3, 0x8F, 0x48, 0x8D, 0x7F, 0xBE, 0x64, 0x5C, 0xB9, 0xAA, 0xD6, 0x36, 0xDF, 0x64, 0xCA, 0xAB,
+    0x5D, 0x9C, 0xA8, 0xBA, 0xF6, 0xBE, 0x4B, 0x9D, 0x2E, 0xCD, 0x82, 0xF2, 0x50, 0x91, 0x0C, 0x63,
+    0x0A, 0x1D, 0x56, 0xF6, 0x6E, 0x44, 0x13, 0x96, 0x10, 0xFC, 0x40, 0xBB, 0x2B, 0x86, 0x18, 0x50,
+    0xC3, 0x18, 0x27, 0x60, 0x1C, 0x18, 0x79, 0x89, 0x88, 0xC7, 0xBE, 0x86, 0x6A, 0xA6, 0xC8, 0x33,
+    0x88, 0x07, 0x93, 0x76, 0x8C, 0x81, 0x90, 0x51, 0x5E, 0xB8, 0x1C, 0xED, 0xF7, 0xD7, 0x4F, 0xFF,
+    0x0F, 0xB6, 0x27, 0xBE, 0x63, 0x27, 0xA2, 0x6F, 0xFE, 0x52, 0xBB, 0x5A, 0x1D, 0x28, 0xC3, 0x88,
+    0xFD, 0xFF, 0x56, 0x7B, 0x73, 0xE3, 0xCE, 0x3A, 0xE7, 0xD2, 0xF3, 0x5E, 0x74, 0x8D, 0x77, 0xDC,
+    0xFC, 0xBA, 0x59, 0xDD, 0x76, 0x05, 0xC4, 0x48, 0xA9, 0x59, 0xA8, 0x65, 0x9D, 0xB2, 0x70, 0xB0,
+    0x8C, 0x16, 0x09, 0x02, 0x6A, 0x91, 0x73, 0x20, 0xA4, 0xC9, 0xC0, 0x9A, 0x45, 0x0C, 0xAD, 0x54,
+    0x5E, 0xFE, 0xA2, 0x4F, 0x23, 0x6E, 0x63, 0xAB, 0x63, 0xD9, 0x86, 0x71, 0x8C, 0xCB, 0x96, 0x1D,
+    0xB1, 0x09, 0x54, 0xDA, 0x70, 0xF1, 0x21, 0xD5, 0xDD, 0x34, 0xEA, 0xA9, 0xE1, 0xEE, 0xE3, 0xEE,
+    0x5C, 0x94, 0xEE, 0x59, 0xFA, 0x50, 0x5F, 0x6D, 0x7E, 0x15, 0xEC, 0x95, 0x29, 0x19, 0x1F, 0x42,
+    0xE2, 0x69, 0x3F, 0x87, 0x09, 0x1D, 0x11, 0x23, 0x55, 0x09, 0xF6, 0x6A, 0x56, 0x99, 0x2D, 0x96,
+    0xD5, 0x05, 0xEA, 0x0E, 0x79, 0xD9, 0x45, 0x51, 0xA8, 0x72, 0x66, 0x2D, 0x7C, 0xE1, 0x07, 0x0C,
+    0x55, 0x0E, 0xAB, 0x88, 0x85, 0x3F, 0xFD, 0xE5, 0xD3, 0xB3, 0xEC, 0x4F, 0xC7, 0x8D, 0x6C, 0xE6,
+    0xAA, 0x46, 0x95, 0x85, 0xD5, 0xC9, 0x0A, 0xBA, 0x22, 0x5D, 0x41, 0xC0, 0xAA, 0x47, 0xF8, 0x92,
+    0xC3, 0xD5, 0xC1, 0x9F, 0xDD, 0xA8, 0x8B, 0xB8, 0x4F, 0x7E, 0xDC, 0x25, 0x22, 0x63, 0xC7, 0x3F,
+    0x6E, 0x63, 0x21, 0xA1, 0x73, 0x7E, 0xA5, 0x06, 0x32, 0x59, 0x4A, 0xDC, 0x41, 0x18, 0xDF, 0x7B,
+    0xB7, 0x48, 0x3F, 0xC7, 0x8F, 0x47, 0xBD, 0xC8, 0xDF, 0xDF, 0xD4, 0x88, 0xDF, 0x5D, 0xC6, 0xFC,
+    0xFA, 0x86, 0x75, 0x15, 0xAE, 0x98, 0x5F, 0x43, 0xC7, 0x35, 0xBF, 0x4B, 0xEA, 0xBA, 0xA8, 0xAF,
+    0xEB, 0x5B, 0xF5, 0x98, 0xBA, 0xB2, 0xAE, 0xE1, 0x77, 0x12, 0x9B, 0x5E, 0xF8, 0xCD, 0xB3, 0x73,
+    0x2F, 0xCB, 0xBF, 0x71, 0x27, 0xC6, 0xFE, 0xFE, 0xFE, 0xCB, 0xD6, 0x3A, 0xCB, 0x9F, 0xF7, 0x5E,
+    0xFD, 0x19, 0x5D, 0x5B, 0x2F, 0x86, 0xC5, 0x7F, 0xF4, 0x6E, 0xF1, 0xF5, 0x18, 0x38, 0x3D, 0x4E,
+    0x2B, 0xFB, 0xB0, 0x9A, 0xCA, 0x3E, 0xC8, 0x03, 0xDE, 0x03, 0x07, 0xFD, 0xA3, 0x75, 0x50, 0xC5,
+    0x5A, 0xAF, 0x36, 0xB7, 0x02, 0xF5, 0x29, 0x65, 0x1F, 0xB2, 0xA9, 0xEC, 0x03, 0xF7, 0x7A, 0x6B,
+    0x30, 0x45, 0x5A, 0x00, 0x32, 0xBC, 0xA1, 0x1B, 0x62, 0x9D, 0xDC, 0x36, 0x64, 0x99, 0x2E, 0x0F,
+    0x58, 0xE1, 0x91, 0x05, 0xCF, 0x74, 0x32, 0xE9, 0x76, 0x34, 0x1E, 0x0C, 0x32, 0x36, 0x4B, 0xC4,
+    0x7E, 0xCB, 0xB0, 0x2E, 0x4A, 0xCF, 0x3F, 0xAA, 0x67, 0x21, 0x5E, 0xE3, 0x46, 0x08, 0x98, 0x0A,
+    0x16, 0xB0, 0xF6, 0x30, 0x77, 0x0D, 0xB6, 0x8B, 0x1B, 0xBE, 0x90, 0x15, 0x92, 0x91, 0x51, 0xED,
+    0x08, 0x2F, 0x97, 0xDF, 0xE1, 0xDB, 0xF3, 0xA7, 0x02, 0x0B, 0xB1, 0x08, 0x92, 0x30, 0xB3, 0xC5,
+    0x1D, 0x2A, 0x54, 0xAD, 0xCA, 0xA9, 0x4A, 0xB0, 0x9A, 0xC4, 0x0B, 0x70, 0x52, 0xA4, 0x4A, 0xFC,
+    0x18, 0xE1, 0x63, 0xC5, 0x7B, 0x5F, 0x95, 0xB9, 0xFF, 0x4A, 0xDE, 0xCA, 0x15, 0xE9, 0xE8, 0xEA,
+    0xE1, 0xA0, 0x22, 0x10, 0xE2, 0x4C, 0xD0, 0x25, 0x94, 0xF3, 0x28, 0x63, 0xDA, 0xC1, 0xDE, 0xD1,
+    0x6D, 0x58, 0x95, 0x8D, 0x37, 0x67, 0xC2, 0x0D, 0x8A, 0x5C, 0xF5, 0xA5, 0x26, 0x14, 0xC3, 0xAC,
+    0x02, 0x47, 0x82, 0x72, 0xAF, 0xF3, 0xA6, 0x78, 0x15, 0xF1, 0xB7, 0xA3, 0xDF, 0xC9, 0xAB, 0xF4,
+    0xAE, 0xC8, 0x77, 0xDE, 0x5C, 0x10, 0xBA, 0x49, 0x0B, 0x8D, 0x5B, 0xCC, 0x8A, 0xBC, 0x11, 0xB6,
+    0xDD, 0xA4, 0x05, 0x76, 0x83, 0x18, 0x76, 0x08, 0xD1, 0x6E, 0x2F, 0x1F, 0x98, 0xEE, 0x1D, 0xBF,
+    0xEE, 0x2F, 0x82, 0x2D, 0x6C, 0x6F, 0xEE, 0x66, 0x2D, 0x20, 0x05, 0x63, 0xBD, 0xDE, 0xF0, 0x9B,
+    0x75, 0x34, 0x50, 0x58, 0x9C, 0xC6, 0xF5, 0x66, 0x5F, 0x36, 0x05, 0x96, 0x4C, 0x34, 0x51, 0x2B,
+    0x3E, 0xAA, 0x32, 0x7B, 0xE9, 0x0F, 0x48, 0x93, 0x17, 0xFE, 0xB0, 0x07, 0x17, 0xDD, 0xD5, 0x0A,
+    0x6E, 0x2C, 0xDB, 0x4A, 0xDB, 0xC0, 0x37, 0xBD, 0x6F, 0x79, 0xF7, 0xED, 0xEB, 0x3F, 0xBB, 0xC6,
+    0x1F, 0xCB, 0xAC, 0x58, 0x59, 0x30, 0x32, 0x6D, 0xEA, 0x9C, 0x0A, 0x89, 0x19, 0xF6, 0x9C, 0x1C,
+    0xB9, 0xE3, 0x5D, 0xDB, 0x5D, 0xD7, 0x25, 0xD8, 0xF5, 0x1E, 0xC8, 0xD7, 0x1F, 0xEB, 0xDA, 0xFB,
+    0x21, 0xFB, 0xA1, 0x92, 0x07, 0xFA, 0x95, 0x28, 0x1B, 0xA6, 0xB3, 0x63, 0x47, 0x85, 0xDC, 0x5D,
+    0x2D, 0x6D, 0xBB, 0xAB, 0x51, 0xCB, 0xAF, 0xDD, 0xFE, 0xB6, 0xD9, 0x30, 0x9B, 0xBB, 0x71, 0x3D,
+    0x05, 0x37, 0x4F, 0x9F, 0xBB, 0xA0, 0x08, 0xD6, 0x73, 0xE7, 0xCF, 0xF8, 0x7D, 0xD8, 0xCE, 0xE4,
+    0xE8, 0xB5, 0xEC, 0x6C, 0xFD, 0xDC, 0x27, 0x64, 0x6A, 0x54, 0xAC, 0xD3, 0x2F, 0xC4, 0x8D, 0x15,
+    0xEB, 0xDC, 0xF5, 0x72, 0x26, 0x61, 0x96, 0xCE, 0xC3, 0xFF, 0x9E, 0x55, 0x8C, 0x0A, 0x97, 0xF3,
+    0xE9, 0xE5, 0xCB, 0x29, 0xF4, 0x3C, 0x50, 0x15, 0x49, 0x9D, 0x4E, 0x66, 0xF6, 0xD0, 0xFF, 0xE4,
+    0x6D, 0x39, 0xD4, 0xBF, 0xC0, 0xD7, 0xB7, 0x66, 0x8D, 0xF2, 0x03, 0x27, 0x18, 0x1F, 0xA1, 0x7E,
+    0x95, 0x6D, 0x8F, 0xD2, 0xBF, 0x29, 0xD8, 0xB7, 0x9D, 0x0A, 0x06, 0xFB, 0x10, 0x86, 0x27, 0xA1,
+    0xB0, 0xB8, 0xDF, 0x54, 0xF1, 0x8D, 0x69, 0x9D, 0xBB, 0x91, 0xD1, 0x6C, 0x86, 0x92, 0x4F, 0xD2,
+    0xE2, 0x2C, 0xBA, 0xCF, 0xEB, 0x9A, 0x4A, 0x5C, 0xD9, 0x72, 0xA4, 0x9E, 0x32, 0x4A, 0xA2, 0xE0,
+    0x2F, 0x27, 0x35, 0x08, 0x73, 0x34, 0xCC, 0xE6, 0xE8, 0x8F, 0x4E, 0x28, 0x01, 0x9B, 0xED, 0xBD,
+    0x59, 0xFB, 0xF0, 0x76, 0x3D, 0x3D, 0xB4, 0xC1, 0x1A, 0x4B, 0x3B, 0xDD, 0xA3, 0xED, 0x63, 0xF9,
+    0xF1, 0x68, 0xA5, 0xC8, 0xEB, 0xA7, 0x7C, 0xCA, 0x16, 0x97, 0x9B, 0xB0, 0xAB, 0x32, 0xE7, 0xCA,
+    0xCC, 0x4D, 0x5C, 0xDA, 0xAC, 0xBF, 0x5D, 0x2D, 0xB5, 0xD8, 0x99, 0xEC, 0xED, 0xDF, 0xAF, 0x29,
+    0x66, 0xB5, 0x39, 0x57, 0x6E, 0xCE, 0xD5, 0x9B, 0x73, 0x05, 0xE7, 0x5C, 0xC5, 0x39, 0x57, 0x72,
+    0xCE, 0xD5, 0x9C, 0x73, 0x45, 0xE7, 0x5C, 0xD5, 0x39, 0x57, 0x76, 0xCE, 0xD5, 0x9D, 0x73, 0x85,
+    0xE7, 0x36, 0xFA, 0x53, 0x17, 0x9E, 0xAD, 0x3D, 0xE7, 0x69, 0xF1, 0xB9, 0x9B, 0x85, 0xAD, 0x3E,
+    0x67, 0x89, 0x3F, 0xB6, 0xF4, 0x90, 0xB8, 0x01, 0xDF, 0xD2, 0xB3, 0x2E, 0x6F, 0xE9, 0xAE, 0x56,
+    0x38, 0xF7, 0xA7, 0x35, 0xFB, 0xA8, 0xA7, 0x32, 0x2E, 0x66, 0x21, 0x46, 0xAF, 0xCD, 0xC4, 0xDE,
+    0x7E, 0xAD, 0x7A, 0xAB, 0xFD, 0x29, 0xDA, 0x0C, 0x8A, 0xF9, 0xE1, 0x9D, 0xEB, 0x1E, 0xD4, 0xEA,
+    0xFC, 0xD3, 0x3C, 0x96, 0xBB, 0xAA, 0x93, 0x80, 0xA2, 0x5A, 0xAE, 0xC2, 0xAC, 0x56, 0x9B, 0xB4,
+    0x75, 0x5D, 0x4F, 0x29, 0xAA, 0x75, 0xB2, 0xB4, 0xBD, 0xAB, 0x03, 0xEB, 0xB3, 0xDE, 0xE4, 0x29,
+    0xB5, 0x11, 0x1E, 0xB1, 0x80, 0x8A, 0xCD, 0x22, 0x62, 0xAC, 0x1F, 0xE2, 0x8A, 0x88, 0x05, 0xAB,
+    0x3B, 0xBE, 0x6F, 0xD0, 0x10, 0xFE, 0x82, 0x6F, 0xFD, 0x19, 0x3F, 0x85, 0xE8, 0x25, 0xE3, 0xC3,
+    0x71, 0xE1, 0x8A, 0x88, 0xFD, 0x1E, 0xD7, 0xA1, 0xAF, 0x1E, 0xAE, 0x37, 0xEF, 0x30, 0xFE, 0x1A,
+    0x82, 0xB2, 0x55, 0x44, 0x0C, 0x52, 0xD9, 0x12, 0x61, 0xB3, 0xCF, 0x2D, 0xA1, 0x24, 0xFB, 0xAB,
+    0x81, 0x15, 0x75, 0x6D, 0x91, 0x5C, 0x70, 0x88, 0x75, 0x5D, 0x5D, 0x9A, 0x41, 0x72, 0x9A, 0x45,
+    0xB2, 0x5B, 0x40, 0xD6, 0x70, 0xB8, 0xC8, 0xEB, 0x7B, 0x64, 0xFC, 0x57, 0x70, 0x24, 0x9B, 0x66,
+    0x07, 0x24, 0x3A, 0x40, 0x51, 0x1F, 0x4B, 0x6C, 0x97, 0x63, 0x8A, 0x0D, 0x74, 0xF4, 0x5E, 0x66,
+    0xA0, 0x1A, 0x36, 0x4A, 0x81, 0xBF, 0xE3, 0x4A, 0x35, 0xCF, 0x20, 0x33, 0xDE, 0x6C, 0x0C, 0x70,
+    0x39, 0x45, 0xCA, 0x5D, 0x9C, 0xE8, 0x78, 0x70, 0x20, 0x60, 0x09, 0x64, 0x82, 0x3E, 0xB8, 0xCF,
+    0x05, 0x7A, 0x6F, 0x0F, 0xAC, 0x98, 0x3B, 0x3B, 0x54, 0x03, 0xEA, 0xF9, 0x33, 0xF6, 0x1B, 0x8C,
+    0xE4, 0x75, 0xD0, 0x83, 0x50, 0xC6, 0x0F, 0x27, 0xDE, 0xF4, 0x79, 0xBE, 0x65, 0x36, 0x9E, 0x43,
+    0x79, 0x06, 0x94, 0x5B, 0xA5, 0x6B, 0x47, 0x21, 0x8C, 0x98, 0xA5, 0x2B, 0x55, 0x06, 0x33, 0xDE,
+    0x0C, 0xC6, 0x53, 0x6E, 0xD8, 0xE9, 0xF0, 0xD9, 0xFA, 0xA3, 0xB7, 0x5C, 0x66, 0xCC, 0xED, 0xAF,
+    0xBC, 0x03, 0xA4, 0x21, 0xF5, 0xBC, 0xB9, 0x59, 0xB9, 0xA0, 0x8D, 0x29, 0x09, 0xB2, 0x38, 0x2F,
+    0x2B, 0xA2, 0xD0, 0x9A, 0x9D, 0xB4, 0xD8, 0xD6, 0xE0, 0xB9, 0x35, 0x76, 0xBD, 0x7A, 0x5A, 0x6B,
+    0xB5, 0x5E, 0x5C, 0x60, 0x79, 0xCE, 0x7F, 0x77, 0x2A, 0x00, 0xE5, 0x63, 0x20, 0xB4, 0x70, 0xAA,
+    0x96, 0xBC, 0x76, 0x85, 0xAF, 0xC9, 0x47, 0x4F, 0x2D, 0x79, 0xFD, 0xFC, 0x1D, 0x99, 0xD3, 0xF1,
+    0x91, 0xB7, 0x5E, 0x58, 0x5A, 0xC4, 0x25, 0x9D, 0x97, 0xA7, 0x2E, 0x67, 0x05, 0xA5, 0x59, 0x1A,
+    0xC4, 0x42, 0x16, 0xC5, 0xD0, 0xE0, 0x77, 0xF8, 0xDA, 0x09, 0x41, 0x0E, 0x11, 0xF2, 0xDB, 0xAC,
+    0x49, 0x5C, 0x23, 0x70, 0x34, 0x8C, 0x29, 0x61, 0x35, 0x39, 0x11, 0x96, 0xDE, 0x77, 0xC5, 0xA8,
+    0xEB, 0x82, 0x7A, 0x1C, 0x5D, 0x3C, 0x83, 0xF5, 0x66, 0x6A, 0x2E, 0xCB, 0xBD, 0x0F, 0xA3, 0x87,
+    0x94, 0x5C, 0xAF, 0xFE, 0xD8, 0x14, 0x74, 0x06, 0x6B, 0xB0, 0x11, 0x23, 0x8D, 0xE8, 0x94, 0x46,
+    0x7A, 0x8B, 0x86, 0x78, 0xCB, 0x05, 0x23, 0x86, 0x71, 0xC4, 0x30, 0xAE, 0x15, 0x37, 0x9B, 0xF1,
+    0xF3, 0x04, 0x03, 0x6C, 0x99, 0xCA, 0x0C, 0x29, 0x25, 0x47, 0xBC, 0x47, 0xCA, 0x00, 0x39, 0x59,
+    0x8A, 0xC9, 0x75, 0x69, 0x23, 0x2D, 0x12, 0x25, 0x38, 0xD1, 0xCA, 0x46, 0xD6, 0xAC, 0x83, 0x15,
+    0x4A, 0x76, 0xF1, 0x08, 0x04, 0xE9, 0xF7, 0x3B, 0xDE, 0x57, 0x7C, 0xD4, 0x01, 0x09, 0x9B, 0xAF,
+    0x70, 0x8D, 0x96, 0x36, 0x1D, 0x61, 0x17, 0x0E, 0x26, 0xBE, 0xD8, 0x0B, 0xD2, 0x7A, 0xC1, 0x6E,
+    0xBF, 0xA5, 0x95, 0xDA, 0xE3, 0xA2, 0x74, 0x86, 0x99, 0xA6, 0xB4, 0x5A, 0x51, 0xD0, 0x95, 0x4E,
+    0xB8, 0xBD, 0x51, 0x5F, 0xAA, 0xAC, 0xF4, 0xEF, 0xEC, 0x20, 0xF9, 0x2F, 0xEB, 0x57, 0x5D, 0x71,
+    0x9B, 0x52, 0xD5, 0x58, 0xE7, 0x12, 0xD7, 0x02, 0xD5, 0x36, 0xEF, 0x63, 0x41, 0xC7, 0x96, 0x4E,
+    0x43, 0xA9, 0x11, 0xD7, 0xAC, 0x53, 0xC2, 0x78, 0x2A, 0x16, 0x2B, 0xF1, 0xB5, 0xE8, 0x11, 0x96,
+    0x13, 0xEB, 0x6F, 0x6A, 0x48, 0x7C, 0xA3, 0x35, 0xC6, 0x2B, 0x6C, 0x58, 0xF5, 0x42, 0xA8, 0x7C,
+    0x21, 0x0F, 0x3F, 0x32, 0x47, 0x42, 0xE9, 0x2B, 0xCD, 0x31, 0xB0, 0xA2, 0xC3, 0xD4, 0x8A, 0xA7,
+    0x56, 0x38, 0xB5, 0xFC, 0x53, 0x5A, 0xDE, 0xA9, 0x2D, 0x2B, 0x32, 0x5C, 0x44, 0x42, 0x83, 0xAC,
+    0xA5, 0x18, 0x63, 0x8B, 0x84, 0x77, 0x81, 0x17, 0x52, 0x64, 0x03, 0xBD, 0x97, 0x79, 0xCF, 0x87,
+    0x6D, 0xD8, 0xFB, 0xFD, 0x57, 0x59, 0x67, 0xBE, 0xD7, 0xC1, 0xB9, 0x1A, 0xF6, 0x3A, 0xC0, 0x7B,
+    0x61, 0xAF, 0xBE, 0xE8, 0x24, 0xEC, 0x75, 0x50, 0xA3, 0x8F, 0x6F, 0xAE, 0x6B, 0x8C, 0x68, 0xE4,
+    0xCB, 0x2B, 0x9F, 0x96, 0xAA, 0xDC, 0xCB, 0xA7, 0xE8, 0x95, 0xC1, 0x7D, 0x38, 0x26, 0xB8, 0x33,
+    0x6B, 0x48, 0x35, 0x61, 0xAF, 0x02, 0x5D, 0x11, 0x32, 0xA6, 0x1A, 0x21, 0xE6, 0xA8, 0xBC, 0xEC,
+    0x69, 0xD9, 0x0A, 0x94, 0x1F, 0x42, 0xD5, 0x9B, 0x2A, 0xE6, 0x68, 0x48, 0x57, 0xFD, 0x69, 0x30,
+    0x9C, 0x27, 0x79, 0x3D, 0x00, 0x53, 0x23, 0x38, 0xD1, 0xF0, 0x4F, 0x34, 0xDC, 0x70, 0xA0, 0xBE,
+    0x74, 0x68, 0x3E, 0x31, 0x45, 0xB2, 0x40, 0xB2, 0x5B, 0xAB, 0x19, 0x6C, 0xF1, 0x20, 0x62, 0x71,
+    0xB4, 0x40, 0xD5, 0xDB, 0x85, 0x73, 0x3A, 0xC5, 0xCE, 0xC3, 0xAF, 0x95, 0x93, 0x99, 0xD7, 0x73,
+    0x1D, 0x40, 0xEB, 0x4B, 0x37, 0xCE, 0xAB, 0xAD, 0xC6, 0x8C, 0xA5, 0x0B, 0xA3, 0x0B, 0x57, 0x28,
+    0x6C, 0xB4, 0x9A, 0xEA, 0x4B, 0xC3, 0x13, 0x9B, 0x0C, 0xB9, 0x10, 0x6B, 0x9B, 0x98, 0x2B, 0xC6,
+    0xE6, 0x80, 0xF9, 0xEF, 0x4D, 0x91, 0xCE, 0xB4, 0xC1, 0x30, 0xC2, 0x85, 0x00, 0xE2, 0x52, 0x68,
+    0x2A, 0x9B, 0x2E, 0xE7, 0x52, 0xD0, 0xB0, 0x80, 0xD3, 0x4F, 0x0F, 0xE0, 0x39, 0xE8, 0xB1, 0x86,
+    0x10, 0x8A, 0xA0, 0x91, 0x08, 0x91, 0x56, 0x13, 0x42, 0x18, 0x02, 0xD4, 0x74, 0x06, 0x21, 0xB0,
+    0xE4, 0x2F, 0xA3, 0xDB, 0x5F, 0x90, 0xC5, 0x79, 0x59, 0x70, 0xC9, 0x92, 0x00, 0xF2, 0x9A, 0x37,
+    0xEA, 0x96, 0x3E, 0x95, 0xF3, 0x95, 0x1D, 0xC0, 0xC1, 0x8A, 0xA0, 0xD7, 0xD4, 0xD0, 0x95, 0x2F,
+    0x26, 0xB2, 0x2B, 0xF5, 0xBC, 0x24, 0xA0, 0x4C, 0xB3, 0xF1, 0x6B, 0x95, 0x9A, 0xD4, 0x3F, 0xC1,
+    0x45, 0xA8, 0x7E, 0x33, 0x58, 0xD7, 0x95, 0xED, 0xBD, 0xA0, 0x68, 0x57, 0xD1, 0xBB, 0x8A, 0x6C,
+    0x35, 0x4B, 0x5B, 0x44, 0x51, 0x2B, 0x61, 0xE9, 0x4A, 0x33, 0xAF, 0x9A, 0x99, 0x79, 0xD8, 0x9A,
+    0x70, 0x6D, 0x70, 0xA7, 0x8D, 0xD1, 0x34, 0x3A, 0x25, 0x5A, 0xD8, 0xDF, 0xB2, 0x4E, 0x2B, 0x49,
+    0x58, 0x16, 0x0A, 0x71, 0x3C, 0xEB, 0x3D, 0x0D, 0xCE, 0x44, 0x84, 0xCD, 0xB4, 0x84, 0x34, 0xCE,
+    0xDC, 0x2D, 0x1E, 0x4B, 0x2F, 0x96, 0x48, 0x1C, 0x65, 0x9C, 0x82, 0xCE, 0x52, 0x2E, 0xA8, 0x45,
+    0xD4, 0xFD, 0x30, 0x34, 0x08, 0xB4, 0x88, 0xFF, 0xA9, 0x67, 0xD0, 0x4D, 0xA7, 0x1E, 0x30, 0x81,
+    0xB0, 0xFB, 0xD5, 0xF4, 0x73, 0xD2, 0xE4, 0xE6, 0xD5, 0x07, 0x85, 0xCB, 0x75, 0xF4, 0xEA, 0x57,
+    0x35, 0xE2, 0x4D, 0x77, 0xE6, 0x92, 0x7E, 0xC5, 0x9C, 0x1A, 0x45, 0xAA, 0x91, 0x38, 0x8C, 0x6B,
+    0xA3, 0xD4, 0x56, 0x88, 0x5A, 0x83, 0x20, 0x4D, 0x14, 0xBB, 0x5F, 0x6A, 0xC4, 0x9C, 0xCB, 0x2D,
+    0x58, 0xCE, 0xB4, 0xAF, 0xDD, 0x19, 0x7C, 0x7E, 0x0E, 0x59, 0x0A, 0x4B, 0x15, 0xA9, 0xD8, 0x54,
+    0x0C, 0xAB, 0x55, 0x39, 0xEB, 0x72, 0x4C, 0xF9, 0x6A, 0x08, 0x9C, 0x30, 0xE7, 0x99, 0xB3, 0xEC,
+    0xA8, 0x49, 0x74, 0xC2, 0x12, 0x9D, 0xB0, 0x44, 0x27, 0x2C, 0x39, 0x54, 0xA4, 0xC1, 0xB0, 0x97,
+    0x6C, 0x4C, 0xAD, 0x1A, 0xE8, 0x2E, 0x19, 0xFD, 0x1C, 0xA9, 0xC2, 0x24, 0x3A, 0x29, 0x09, 0x99,
+    0x9D, 0x49, 0x74, 0x52, 0x12, 0x9D, 0x94, 0xB3, 0x6E, 0x52, 0x6C, 0xD4, 0x94, 0xD6, 0xA6, 0x61,
+    0x1E, 0x30, 0x0A, 0x83, 0x2D, 0x39, 0x45, 0xF3, 0x33, 0x60, 0xA0, 0xCC, 0xF0, 0xC5, 0x17, 0x8C,
+    0x98, 0x5D, 0xC2, 0xD0, 0x3B, 0xBC, 0x87, 0xC1, 0x69, 0x9E, 0xF7, 0xEA, 0x84, 0xEE, 0xE7, 0x04,
+    0x22, 0x4F, 0x9D, 0xEC, 0x12, 0x82, 0xA0, 0xEA, 0x4B, 0x5A, 0x5A, 0x7A, 0x64, 0x9B, 0x02, 0x75,
+    0xC2, 0xE1, 0x4D, 0x38, 0xBC, 0x09, 0x87, 0x97, 0xFD, 0x9B, 0x8B, 0xD8, 0xA0, 0xDE, 0x06, 0x43,
+    0x9D, 0xDF, 0xC0, 0x13, 0x23, 0x73, 0x3B, 0xEA, 0x7E, 0xDA, 0xBC, 0x0C, 0xEA, 0x96, 0x7E, 0x62,
+    0xB0, 0xF6, 0xCD, 0xCB, 0x8F, 0x08, 0x75, 0x8F, 0x54, 0x35, 0xFD, 0xBA, 0xFA, 0xFA, 0x6D, 0xC3,
+    0xC0, 0x73, 0xCA, 0x4B, 0x56, 0x23, 0x9D, 0xF4, 0x8F, 0xB3, 0xAA, 0x58, 0x80, 0x86, 0x41, 0xD5,
+    0xB2, 0x8B, 0x3F, 0x70, 0xAA, 0xBE, 0x8E, 0xA1, 0x4E, 0x51, 0xB4, 0x62, 0xC5, 0x9A, 0x61, 0xC0,
+    0x19, 0x94, 0x72, 0xDD, 0xD6, 0x79, 0xF6, 0xC5, 0xF0, 0x8C, 0xF7, 0x2D, 0xBC, 0x7F, 0xFB, 0x15,
+    0x1D, 0x0E, 0x5B, 0x28, 0x2F, 0xB1, 0x2F, 0xF5, 0x8C, 0x37, 0x1B, 0x73, 0xC1, 0xAF, 0x79, 0xB3,
+    0x51, 0x17, 0x65, 0x46, 0x37, 0x71, 0xF3, 0xAA, 0xF5, 0x06, 0x39, 0x47, 0x86, 0xDB, 0xBE, 0xAD,
+    0xDF, 0xC9, 0xD8, 0x38, 0xE1, 0x59, 0xFC, 0xF7, 0xB0, 0x15, 0xEF, 0xBD, 0xB2, 0x83, 0xE8, 0x84,
+    0x70, 0x3B, 0x67, 0xFC, 0x20, 0xE7, 0x60, 0x80, 0x8C, 0x78, 0x83, 0x8E, 0xB1, 0x12, 0xB9, 0x5B,
+    0xEA, 0xE9, 0xF7, 0xCE, 0x50, 0xD8, 0x95, 0xFD, 0x20, 0x3F, 0x36, 0xD7, 0x23, 0xD3, 0xE1, 0xA5,
+    0x92, 0xBF, 0xEC, 0x5E, 0x14, 0xB1, 0xE7, 0x82, 0xDF, 0x3C, 0x29, 0xE8, 0x9A, 0x0A, 0x41, 0x7C,
+    0xF0, 0x4A, 0x37, 0xD6, 0x95, 0x6E, 0xAB, 0xD6, 0x96, 0x6A, 0xCB, 0x36, 0x8C, 0x97, 0xD8, 0x97,
+    0x55, 0x60, 0xA5, 0x26, 0xA3, 0x88, 0x06, 0xF4, 0x95, 0xBE, 0xC0, 0x4A, 0xFB, 0xBF, 0x62, 0x90,
+    0x6D, 0xC0, 0xE3, 0x46, 0xB0, 0xA3, 0x61, 0x97, 0xC4, 0xAB, 0x67, 0x36, 0xFA, 0x72, 0x39, 0x55,
+    0x23, 0x2F, 0x6C, 0x15, 0x95, 0x47, 0xAD, 0x1A, 0xB9, 0xED, 0x19, 0xA8, 0xFA, 0xC0, 0xFC, 0x52,
+    0xAB, 0x91, 0xDB, 0x03, 0x29, 0xEC, 0xB6, 0x67, 0xD1, 0xEB, 0x1B, 0xC6, 0x13, 0xB5, 0x36, 0x59,
+    0xA2, 0xF0, 0xBE, 0xBA, 0x81, 0x10, 0x47, 0x29, 0xDB, 0x64, 0x23, 0xAC, 0x24, 0xA8, 0x47, 0xC6,
+    0x32, 0x80, 0x01, 0xD5, 0x6A, 0x1F, 0xBB, 0x03, 0x72, 0xB1, 0xC7, 0x8C, 0xB9, 0x3F, 0xBE, 0xD2,
+    0xDE, 0xED, 0xE7, 0x92, 0x56, 0x63, 0x9D, 0x7B, 0x10, 0x7C, 0x20, 0x2B, 0xCE, 0x76, 0x62, 0x5E,
+    0x5D, 0xC0, 0x5A, 0x4B, 0x6D, 0x65, 0x01, 0x6B, 0x47, 0x0D, 0x4F, 0x47, 0x36, 0x7A, 0x76, 0xE9,
+    0xB0, 0x8E, 0x93, 0xB7, 0xB4, 0xC3, 0xB6, 0x7B, 0x0B, 0xFC, 0xB5, 0xB9, 0xA9, 0xEC, 0xF6, 0xDF,
+    0x2E, 0x74, 0x7C, 0x1D, 0x42, 0x7E, 0x3F, 0xBF, 0x6D, 0x7F, 0x3D, 0x9D, 0x58, 0xCD, 0xE9, 0xAD,
+    0x67, 0xEE, 0x03, 0x1D, 0x1E, 0xE8, 0x1E, 0xD7, 0x83, 0xFA, 0xA3, 0x5A, 0x67, 0xA9, 0xA5, 0xF2,
+    0x21, 0x63, 0x19, 0x5B, 0x1C, 0x55, 0x8A, 0xFD, 0x69, 0x8C, 0xE7, 0x98, 0x46, 0x61, 0x3B, 0x59,
+    0x6E, 0xB6, 0x4E, 0xBB, 0xEE, 0xB6, 0x58, 0x27, 0x4D, 0x67, 0x6D, 0xAC, 0x1C, 0xED, 0xD8, 0x12,
+    0xF3, 0xBD, 0xE7, 0xCD, 0x5A, 0x78, 0x1F, 0x9B, 0x21, 0x61, 0xA6, 0xF3, 0x5F, 0x1F, 0x44, 0x6B,
+    0x3C, 0x2E, 0x9C, 0xB1, 0xD3, 0xAC, 0xDC, 0xEF, 0xAE, 0x58, 0xC3, 0x28, 0xAA, 0x64, 0xF6, 0xAE,
+    0xA5, 0xA5, 0x40, 0xD1, 0x52, 0x8B, 0x9F, 0x67, 0xE3, 0xF8, 0x6D, 0x4B, 0xCB, 0x7F, 0x6A, 0x04,
+    0xA7, 0x6B, 0x65, 0xA7, 0xB5, 0xDA, 0x40, 0x37, 0x66, 0x56, 0x0E, 0xFC, 0xD0, 0xAF, 0xCD, 0x9B,
+    0xF2, 0xD7, 0x1A, 0x8C, 0xC3, 0xF4, 0x93, 0xB5, 0xDB, 0x9B, 0xB5, 0xF2, 0x75, 0xAB, 0x72, 0xD6,
+    0xFD, 0x7A, 0x8A, 0xFE, 0x18, 0x5D, 0xDC, 0x81, 0xCB, 0x2B, 0x19, 0x5D, 0x1D, 0x1E, 0xCF, 0xDC,
+    0x74, 0x3A, 0x7C, 0xB6, 0x26, 0x87, 0xFD, 0xCD, 0x52, 0x35, 0x96, 0x24, 0x45, 0x2F, 0x3D, 0xD6,
+    0x03, 0xF9, 0xCC, 0x64, 0x0C, 0x70, 0xCF, 0xBB, 0xE7, 0x86, 0xB1, 0xD9, 0x07, 0xF9, 0xAF, 0x4D,
+    0x63, 0xFF, 0xA4, 0xFB, 0x95, 0x56, 0x36, 0xD0, 0x86, 0xAD, 0x12, 0xAD, 0x36, 0x29, 0x6D, 0xD4,
+    0xAE, 0xA1, 0x9A, 0x9B, 0x2C, 0xE5, 0xB2, 0x78, 0x0E, 0x65, 0xFD, 0x6E, 0xA2, 0xB2, 0x8F, 0x59,
+    0x22, 0x86, 0xBB, 0x74, 0x96, 0xD8, 0xC9, 0xBF, 0x51, 0x6E, 0xDA, 0x0D, 0xA3, 0xC2, 0x0E, 0x89,
+    0xC8, 0xF8, 0x4B, 0x6B, 0x89, 0x0F, 0x6C, 0xDD, 0xF0, 0xCE, 0x96, 0xFC, 0x8D, 0x27, 0xC3, 0x71,
+    0x3D, 0x8F, 0x60, 0xD2, 0x41, 0xCA, 0xD4, 0xFC, 0x63, 0xAA, 0x73, 0xEB, 0x78, 0x0E, 0x1B, 0x30,
+    0x26, 0x32, 0x3F, 0x7C, 0x77, 0x19, 0xC2, 0xEC, 0x51, 0xBB, 0xC0, 0x1F, 0xE5, 0xBD, 0x4A, 0x79,
+    0xA7, 0x88, 0x2E, 0xDC, 0x81, 0xA1, 0xF9, 0x8C, 0xEB, 0x12, 0x5D, 0x07, 0xC9, 0x34, 0x44, 0xE3,
+    0x1A, 0xA5, 0xD0, 0xC9, 0x2C, 0xAA, 0xF5, 0x97, 0x75, 0xC5, 0x2B, 0x4B, 0x41, 0xAC, 0x1D, 0x11,
+    0x0F, 0x2C, 0xBE, 0x1E, 0xA1, 0x4C, 0x05, 0x0E, 0x67, 0x88, 0x51, 0x11, 0x53, 0x1E, 0xC4, 0xD2,
+    0x2A, 0x06, 0xEC, 0x0D, 0x41, 0xFF, 0xE8, 0xE7, 0x58, 0x2F, 0xBD, 0x82, 0x15, 0xD9, 0xFF, 0xAA,
+    0x41, 0xB0, 0x43, 0x69, 0x2B, 0xC9, 0xBF, 0x65, 0x33, 0xFA, 0xD9, 0x49, 0xA1, 0xEB, 0xB7, 0x1B,
+    0x67, 0xB3, 0xB0, 0xE9, 0x3B, 0x88, 0x85, 0x85, 0x3E, 0x0D, 0xC3, 0xAB, 0x97, 0x7F, 0x1F, 0xEA,
+    0x61, 0x2D, 0x43, 0x34, 0x7A, 0x23, 0x53, 0x0C, 0x56, 0xBE, 0x42, 0xEC, 0x86, 0x0A, 0x47, 0x24,
+    0xEB, 0xF2, 0xAF, 0x65, 0x51, 0xB3, 0x98, 0x59, 0xF9, 0x7B, 0x83, 0x8C, 0x6B, 0xF6, 0x0F, 0x28,
+    0xD8, 0x04, 0xF7, 0x59, 0x20, 0x6A, 0x96, 0xEF, 0xD9, 0x82, 0x29, 0xDE, 0xCB, 0xF1, 0xB8, 0x19,
+    0xBB, 0xF0, 0xB0, 0x1D, 0xDD, 0x3C, 0xDF, 0xE0, 0xC2, 0xEC, 0x7C, 0x03, 0x8D, 0xB7, 0x4D, 0x2F,
+    0xBA, 0xCD, 0x80, 0x26, 0x73, 0x35, 0xFF, 0x2F, 0x68, 0x76, 0x74, 0x09, 0x4D, 0xF9, 0x14, 0x9C,
+    0xF3, 0x85, 0x1D, 0xDD, 0x67, 0xA4, 0x4F, 0xCF, 0x27, 0x37, 0xFC, 0x25, 0x6B, 0x44, 0xC1, 0xD1,
+    0x3D, 0x29, 0x7F, 0x87, 0x76, 0x7B, 0xCD, 0x75, 0xB7, 0x85, 0x81, 0x2A, 0x59, 0xAC, 0x57, 0x64,
+    0x6F, 0x61, 0x91, 0xB6, 0x51, 0xBF, 0x87, 0x1A, 0xA5, 0xFD, 0x2E, 0x58, 0xB0, 0x85, 0x2F, 0x02,
+    0xBE, 0xE3, 0x3C, 0x75, 0x0F, 0x1A, 0xE6, 0xF6, 0xFC, 0x85, 0x8A, 0x11, 0x5B, 0x9A, 0xFA, 0x35,
+    0xFB, 0xB3, 0x3A, 0x1C, 0xC2, 0x19, 0x54, 0xF9, 0xD0, 0x57, 0xB8, 0x2E, 0xDB, 0x63, 0x46, 0x91,
+    0xD6, 0x8E, 0xC7, 0x3D, 0xA1, 0xBC, 0x0B, 0x30, 0x1E, 0xED, 0x00, 0x3C, 0xF3, 0xA2, 0x80, 0xAF,
+    0x7A, 0x9B, 0x55, 0x68, 0xEF, 0x0A, 0xA8, 0x11, 0xB1, 0x9A, 0x1B, 0x11, 0xAD, 0x99, 0x39, 0x9F,
+    0x3C, 0x40, 0xE9, 0xE4, 0x13, 0x9A, 0x03, 0x9E, 0x46, 0x80, 0x45, 0x44, 0x04, 0x27, 0x57, 0xAC,
+    0x9C, 0x1C, 0x61, 0x8B, 0x42, 0x56, 0x91, 0x0D, 0xA4, 0xD4, 0x38, 0x4B, 0x2D, 0xD9, 0x45, 0x61,
+    0x5D, 0x56, 0xE4, 0xA1, 0x2A, 0x8B, 0x2A, 0xC8, 0xAA, 0x56, 0xEB, 0xCE, 0x8A, 0xF8, 0x73, 0xB2,
+    0x94, 0xD4, 0x9E, 0x15, 0xB1, 0x79, 0x48, 0xC4, 0xE2, 0x5E, 0xD1, 0xBC, 0x7E, 0x7F, 0x50, 0xD3,
+    0xE1, 0x12, 0x3A, 0x41, 0x9B, 0x92, 0x44, 0x97, 0x9A, 0xEE, 0xC0, 0x1C, 0xC5, 0xF2, 0x7F, 0x69,
+    0x63, 0x7A, 0x44, 0x95, 0xD0, 0xA4, 0x71, 0xB0, 0xD6, 0x29, 0x69, 0xBC, 0xA6, 0xA0, 0x93, 0x17,
+    0x10, 0xF2, 0x85, 0xBB, 0x14, 0x4C, 0x1D, 0x27, 0x2F, 0xD3, 0x30, 0x9D, 0x5D, 0xDA, 0x5E, 0xD6,
+    0x25, 0xC9, 0x6C, 0x7C, 0xAD, 0x16, 0x26, 0xB3, 0xD3, 0x3D, 0x8B, 0xAF, 0x55, 0x9F, 0xE3, 0x2D,
+    0x61, 0x35, 0x37, 0x23, 0x3B, 0x66, 0xFA, 0x65, 0x0D, 0xF8, 0xD9, 0x57, 0x56, 0xFB, 0x1A, 0x0F,
+    0x09, 0xBA, 0x78, 0xE2, 0xED, 0xF1, 0xF8, 0xF1, 0x1B, 0xF0, 0xA9, 0x80, 0x44, 0x73, 0x4F, 0x03,
+    0xBE, 0x08, 0xF4, 0xD8, 0x8D, 0x80, 0x96, 0x99, 0xCD, 0x63, 0x37, 0x9A, 0x8D, 0x63, 0x37, 0x06,
+    0x77, 0xEC, 0x06, 0x0F, 0xCC, 0x18, 0x55, 0x49, 0x3A, 0xFD, 0xD8, 0x8D, 0x7E, 0x36, 0x46, 0x6E,
+    0xC0, 0xED, 0xB1, 0x1B, 0xBB, 0xAA, 0xF3, 0x6D, 0x1C, 0xBB, 0x11, 0x35, 0x89, 0x3D, 0x76, 0x83,
+    0x06, 0x49, 0x35, 0xAE, 0x1D, 0x2A, 0x0F, 0x3F, 0xE5, 0xD8, 0x8D, 0xAA, 0x36, 0x4D, 0xEC, 0xC2,
+    0xB4, 0x95, 0xC3, 0xB8, 0x94, 0x16, 0x1B, 0x31, 0x69, 0xAD, 0xC7, 0xC1, 0x06, 0xF2, 0x37, 0xD0,
+    0x56, 0xF1, 0x3D, 0xEF, 0xC1, 0x17, 0xDF, 0xEB, 0x58, 0x7C, 0x6F, 0xE6, 0x18, 0x08, 0xDD, 0x69,
+    0xD6, 0x93, 0x7F, 0xF6, 0x14, 0xF8, 0x0E, 0x8B, 0x4A, 0x62, 0xB2, 0xD6, 0x8D, 0xA2, 0x96, 0x6D,
+    0xD6, 0x34, 0xF4, 0x9F, 0x1F, 0xE2, 0x89, 0xBB, 0x48, 0xBD, 0xDC, 0x68, 0xBC, 0x28, 0x8D, 0xE7,
+    0xED, 0x16, 0x39, 0xED, 0x95, 0x8F, 0x58, 0xC3, 0xD8, 0x7D, 0xF9, 0x39, 0xCA, 0x96, 0x37, 0x9D,
+    0x90, 0xE9, 0x22, 0x98, 0x83, 0x29, 0x94, 0x79, 0x12, 0xE5, 0x32, 0xD7, 0x48, 0x5C, 0x23, 0x3E,
+    0xD1, 0x88, 0x4E, 0x34, 0x78, 0xDF, 0x7F, 0x94, 0x85, 0x99, 0xBF, 0x3D, 0x5E, 0xF9, 0x49, 0x3D,
+    0x1E, 0xED, 0x05, 0x4B, 0x9E, 0xF4, 0xB2, 0x1B, 0x2C, 0x03, 0xD9, 0x37, 0x81, 0x7D, 0xE0, 0x17,
+    0x2D, 0xE6, 0x62, 0x7D, 0x10, 0x98, 0xD5, 0xB8, 0x85, 0xD4, 0x0F, 0x46, 0x51, 0x8C, 0x68, 0x16,
+    0xD0, 0x53, 0xE5, 0xA6, 0x54, 0x82, 0x79, 0x4C, 0xBC, 0xB3, 0xA0, 0x3B, 0xBB, 0xB9, 0xBF, 0x85,
+    0x27, 0x1F, 0x42, 0xB7, 0x7D, 0x14, 0x4B, 0xA3, 0x47, 0xB1, 0x14, 0x9F, 0xF3, 0x28, 0x16, 0x6F,
+    0xE3, 0x28, 0x96, 0xC6, 0xC3, 0xA1, 0x10, 0xD9, 0x8D, 0xDF, 0x86, 0xD0, 0x2B, 0x82, 0xF5, 0xA7,
+    0xAC, 0xFC, 0x3F, 0xDE, 0xFD, 0x19, 0x2C, 0x9B, 0xE8, 0xC4, 0x51, 0x2C, 0x73, 0x56, 0xE1, 0x62,
+    0xA1, 0xAF, 0x6D, 0xC4, 0xED, 0x6E, 0x1E, 0x3C, 0x63, 0xD1, 0xEF, 0xB8, 0x68, 0x95, 0x21, 0xC7,
+    0xAA, 0xE8, 0x9E, 0x9B, 0x97, 0x00, 0x1E, 0x6F, 0x09, 0x35, 0xDA, 0x53, 0xFE, 0xC3, 0x92, 0x61,
+    0x7E, 0x86, 0x33, 0xE3, 0x85, 0x07, 0x8E, 0x90, 0xF4, 0x8B, 0x13, 0xCE, 0xE8, 0x93, 0x8E, 0xE9,
+    0x03, 0xA3, 0x51, 0xD7, 0xCB, 0xD9, 0x56, 0x70, 0x2B, 0x5B, 0xF0, 0x86, 0x5D, 0xF8, 0x0B, 0x9C,
+    0x96, 0xF3, 0x6D, 0x45, 0x87, 0x73, 0x54, 0x1C, 0xEA, 0x14, 0x1D, 0xEA, 0x69, 0x39, 0x87, 0x7A,
+    0x5A, 0xCE, 0xE5, 0xD3, 0x4E, 0xCB, 0xB9, 0xA6, 0x03, 0x7F, 0x78, 0x67, 0x74, 0xCB, 0xD3, 0x72,
+    0xDC, 0x50, 0xDF, 0x4D, 0x1D, 0xCE, 0x73, 0xBF, 0x8B, 0xD2, 0x34, 0xF1, 0xF7, 0x26, 0x68, 0x08,
+    0xEB, 0x7F, 0xFE, 0xAB, 0xED, 0x3A, 0x9C, 0xFC, 0xFD, 0x06, 0xE4, 0x67, 0x4F, 0xD4, 0xE1, 0xD4,
+    0xA4, 0x7E, 0x7B, 0x56, 0xC7, 0xC4, 0x15, 0x6C, 0x38, 0xC3, 0x3D, 0x20, 0x9F, 0x6A, 0xAB, 0x49,
+    0xED, 0x81, 0xB1, 0xFF, 0x1D, 0x52, 0x3C, 0x9C, 0x9B, 0x9A, 0x6E, 0x1F, 0xA9, 0xA0, 0x11, 0x2E,
+    0x3F, 0x37, 0x42, 0xCF, 0x22, 0xE6, 0x13, 0xA3, 0x74, 0x97, 0xE8, 0xE9, 0x32, 0x05, 0x0B, 0x2D,
+    0x09, 0x52, 0x8E, 0x33, 0xE3, 0xD9, 0x1D, 0x20, 0x53, 0x41, 0xC6, 0x14, 0x9D, 0xB4, 0xB1, 0x13,
+    0x1D, 0x0D, 0x0A, 0x8D, 0x8D, 0x21, 0x19, 0x1D, 0x1C, 0x37, 0x7F, 0xBC, 0x77, 0xA8, 0x7E, 0x6E,
+    0xC4, 0x5A, 0xA8, 0x2D, 0xD8, 0xCC, 0x8B, 0xA1, 0x9D, 0xD7, 0xE0, 0x30, 0xDF, 0xE6, 0x94, 0x46,
+    0xD6, 0xD4, 0x99, 0x76, 0xBA, 0x79, 0x09, 0x5B, 0xA0, 0x6D, 0xBC, 0xD6, 0xD3, 0x83, 0x6D, 0x56,
+    0xF8, 0x99, 0x40, 0xB5, 0x9C, 0xDC, 0xFE, 0xAE, 0x76, 0x38, 0xDA, 0xC4, 0xB2, 0x0C, 0x8E, 0x8F,
+    0x8F, 0x0D, 0x69, 0x95, 0x0F, 0x78, 0x75, 0xB5, 0xBF, 0x8F, 0x73, 0xCE, 0xAC, 0x54, 0x36, 0xE1,
+    0x70, 0x0B, 0x3B, 0xB7, 0x9B, 0x6F, 0xA6, 0x14, 0x2D, 0x6F, 0xB2, 0xE6, 0x7D, 0xCD, 0x06, 0x57,
+    0x5E, 0x63, 0xB5, 0x8C, 0xE2, 0xD2, 0x60, 0xFB, 0xDF, 0x6E, 0x18, 0x36, 0xF6, 0x67, 0x88, 0xD1,
+    0xBF, 0x36, 0x1E, 0x0E, 0xD5, 0x1B, 0x59, 0xE8, 0xAB, 0xC9, 0x59, 0x97, 0xF4, 0x75, 0x9E, 0x12,
+    0xF1, 0x7E, 0x0C, 0x88, 0x5A, 0x14, 0xB1, 0xD5, 0xB5, 0x62, 0xB5, 0x3C, 0xA9, 0xC7, 0xD3, 0xC2,
+    0x7E, 0xED, 0xF3, 0xD7, 0x9C, 0x1C, 0x08, 0x8B, 0x64, 0xBF, 0x88, 0xEA, 0x35, 0xA8, 0x5F, 0xA8,
+    0xF1, 0x0E, 0x5E, 0xA4, 0x92, 0xE2, 0xD3, 0x1B, 0x5A, 0xEF, 0x6F, 0xDE, 0x58, 0x5B, 0x5B, 0x93,
+    0x4B, 0xA5, 0x9B, 0x0A, 0xB6, 0x6F, 0x45, 0xDB, 0xB9, 0x50, 0x46, 0x17, 0xC0, 0xFB, 0xFC, 0x26,
+    0xFE, 0x72, 0xE7, 0x48, 0x4D, 0x62, 0xE5, 0x2C, 0xFE, 0x72, 0x67, 0x16, 0x00, 0xBA, 0x05, 0xF5,
+    0x90, 0x51, 0x6B, 0xCE, 0xFF, 0x02, 0xFF, 0xD5, 0xEC, 0x3E, 0x37, 0xCA, 0xAA, 0x2A, 0x1A, 0xB9,
+    0x1C, 0xC3, 0xC2, 0x05, 0x1B, 0xE4, 0x8D, 0x73, 0xBA, 0xA7, 0x9F, 0x5A, 0x6F, 0x87, 0x17, 0xAC,
+    0xE3, 0x89, 0xB7, 0x53, 0x86, 0xFE, 0xFD, 0x38, 0xEB, 0x93, 0xC7, 0x59, 0xAB, 0xE6, 0xAF, 0x3D,
+    0xCF, 0xAD, 0x27, 0x20, 0x2F, 0x34, 0x66, 0x3A, 0xFB, 0xA0, 0xB6, 0x21, 0xF1, 0xAB, 0xD3, 0x07,
+    0xD4, 0xC6, 0x57, 0x3C, 0xDA, 0xA7, 0x8A, 0xA8, 0x1F, 0x55, 0xDD, 0xA8, 0xD6, 0x8B, 0xAA, 0x4E,
+    0x54, 0x8D, 0x10, 0xD0, 0x00, 0x01, 0xF5, 0xE7, 0xA9, 0x03, 0x55, 0x7D, 0x79, 0xEA, 0x3E, 0x55,
+    0x3F, 0x9E, 0x3A, 0x4F, 0xCD, 0xA5, 0x0F, 0x54, 0xC7, 0xC4, 0xB3, 0x8F, 0xEB, 0x95, 0xD2, 0xAA,
+    0x1E, 0x67, 0x35, 0x8B, 0x90, 0xE2, 0xA1, 0x4A, 0x7A, 0xC6, 0x12, 0x56, 0x96, 0x1E, 0x81, 0xA8,
+    0x16, 0x30, 0x42, 0x06, 0xE7, 0x8E, 0xCC, 0x11, 0x19, 0x49, 0xE4, 0xE3, 0x5A, 0x34, 0x54, 0x88,
+    0xD2, 0x5A, 0x15, 0xD6, 0x66, 0xCA, 0x03, 0xDA, 0x40, 0x8A, 0x1D, 0x43, 0x4F, 0x2A, 0xE1, 0x04,
+    0x57, 0x46, 0x9A, 0x08, 0xBB, 0x59, 0x0E, 0x28, 0xC3, 0x01, 0x7C, 0x38, 0x96, 0xE0, 0xDF, 0x83,
+    0x01, 0xF5, 0x2F, 0xE1, 0x38, 0xDD, 0xF1, 0x5A, 0x2A, 0x47, 0x2C, 0x42, 0x03, 0x48, 0x29, 0x5A,
+    0x13, 0x9C, 0xEB, 0x83, 0xB7, 0x3C, 0x57, 0x6A, 0xB1, 0x7E, 0xE3, 0x60, 0x1E, 0xEE, 0x59, 0xD3,
+    0xC7, 0x91, 0x37, 0xD6, 0x93, 0x51, 0x7B, 0xAE, 0x54, 0x65, 0xCF, 0x33, 0xB4, 0x7A, 0x38, 0x4E,
+    0x91, 0xDE, 0xB1, 0xB4, 0x9C, 0x64, 0x2B, 0xCE, 0x4B, 0x74, 0x4B, 0xE4, 0x1A, 0xB6, 0x58, 0x4E,
+    0x11, 0x93, 0x4D, 0xA3, 0x85, 0xA6, 0xD1, 0x52, 0xEF, 0x3B, 0x40, 0x88, 0xF0, 0xE3, 0x78, 0x90,
+    0xF4, 0x5B, 0x7A, 0x90, 0xF4, 0x42, 0xD7, 0x80, 0x75, 0x1A, 0xF4, 0xF3, 0x6C, 0x5E, 0xAB, 0xAC,
+    0x58, 0xFD, 0xDB, 0x3A, 0xD5, 0x6C, 0x02, 0x53, 0x3A, 0x29, 0x74, 0x5F, 0xCA, 0xD1, 0x26, 0xDD,
+    0xD9, 0xC9, 0x06, 0xA0, 0x9E, 0x3C, 0xC7, 0xB4, 0xD6, 0x7D, 0xCB, 0x66, 0x4C, 0xFE, 0xB2, 0xF7,
+    0x38, 0xB9, 0x69, 0xBD, 0x51, 0x33, 0xAE, 0x46, 0x6F, 0xBD, 0x9C, 0xB6, 0xCF, 0xC0, 0x5C, 0x32,
+    0x25, 0x2A, 0x64, 0x05, 0x56, 0x52, 0x6C, 0xCA, 0xA3, 0xDC, 0xEC, 0xAA, 0x82, 0x60, 0x60, 0x05,
+    0xEE, 0xA3, 0x2D, 0x4F, 0xE0, 0x97, 0xE2, 0xAD, 0x15, 0x84, 0x55, 0x96, 0xB4, 0xAC, 0x5B, 0x95,
+    0x6C, 0x98, 0x77, 0x2C, 0xB2, 0x59, 0x2D, 0xAC, 0x9F, 0xA1, 0xE7, 0x9A, 0xC5, 0x1D, 0x37, 0xEA,
+    0x78, 0x61, 0x4B, 0x7E, 0x69, 0x8A, 0x0E, 0xD7, 0x9B, 0x9D, 0x4D, 0x8B, 0x57, 0xCE, 0xB9, 0x7D,
+    0x1F, 0x1D, 0xAB, 0x0F, 0xD3, 0x69, 0xFB, 0x91, 0x75, 0xDA, 0x9A, 0xAD, 0x3C, 0x86, 0x74, 0x4B,
+    0xA2, 0x3A, 0xDC, 0xCA, 0x63, 0xB0, 0xF6, 0xC9, 0xC0, 0xAE, 0xDD, 0xA9, 0x48, 0xC6, 0x43, 0x3F,
+    0x42, 0xE7, 0x43, 0x3E, 0x71, 0x9E, 0x9F, 0x30, 0xAC, 0xAD, 0x60, 0x6A, 0xEA, 0x50, 0xEB, 0x9D,
+    0x7A, 0xE4, 0x95, 0x93, 0xA4, 0xD5, 0x63, 0x61, 0xE2, 0x38, 0x4D, 0x7F, 0xF6, 0x55, 0x7F, 0xF6,
+    0xD5, 0x8F, 0xE8, 0xAE, 0x5F, 0x78, 0x33, 0xD3, 0x9F, 0x43, 0x9B, 0xA1, 0x6F, 0xED, 0x3A, 0x21,
+    0xE7, 0x21, 0x9B, 0x38, 0x3E, 0x9C, 0x4C, 0x1C, 0x9A, 0xD8, 0xFD, 0xFE, 0x8C, 0x92, 0xAE, 0xCE,
+    0xE0, 0xBB, 0x33, 0xF8, 0x27, 0xD6, 0x89, 0x08, 0x4F, 0x58, 0x49, 0xB1, 0xDF, 0x20, 0xE4, 0xAD,
+    0xB7, 0x59, 0x94, 0xF8, 0xA6, 0x36, 0xF0, 0x19, 0xCA, 0x0B, 0xFC, 0x5C, 0x2E, 0x44, 0x86, 0x43,
+    0xF4, 0xD7, 0xD2, 0xF8, 0x14, 0x1B, 0xCD, 0x25, 0xE4, 0x40, 0xA1, 0xD2, 0x02, 0x93, 0xA1, 0xA4,
+    0x1F, 0x3B, 0x6C, 0x94, 0x85, 0xB7, 0xC7, 0x86, 0xAC, 0xF1, 0x43, 0x36, 0x64, 0xCD, 0x5F, 0x65,
+    0x03, 0xEE, 0x2D, 0x36, 0x92, 0xDE, 0xD7, 0x46, 0xDC, 0x07, 0x2D, 0x1B, 0xE1, 0x22, 0x6C, 0xB4,
+    0xB1, 0x8C, 0xB4, 0xE1, 0x2F, 0x93, 0x42, 0xD3, 0xAC, 0xC6, 0xC4, 0xE6, 0x5B, 0x99, 0x67, 0x6C,
+    0xA3, 0xBC, 0x6C, 0x1B, 0xF9, 0xD2, 0x36, 0xB2, 0x85, 0x6D, 0x08, 0x83, 0xC4, 0x59, 0x54, 0xAC,
+    0x86, 0xC0, 0x13, 0x14, 0xAA, 0xB8, 0x0B, 0xD4, 0xFE, 0x1C, 0xA2, 0x08, 0x75, 0x3B, 0xA5, 0xEB,
+    0x4D, 0xC9, 0x41, 0xDB, 0xF6, 0xC9, 0xF4, 0x44, 0x06, 0xD7, 0x54, 0xD1, 0xE1, 0x3D, 0x6F, 0x33,
+    0xC7, 0xC8, 0x7B, 0xE4, 0x8F, 0xDD, 0xAA, 0x36, 0x5F, 0xEE, 0x4E, 0x39, 0x54, 0xCB, 0x4D, 0xDE,
+    0xE3, 0x0F, 0x0F, 0x4E, 0x4B, 0x92, 0x25, 0x74, 0x55, 0xD9, 0xDA, 0x4A, 0x35, 0x3B, 0x9A, 0xBE,
+    0xCC, 0xAB, 0x4B, 0x5D, 0x40, 0xDD, 0x3A, 0x8B, 0x64, 0xFA, 0x5A, 0x6C, 0x2C, 0x59, 0xA7, 0xA0,
+    0xE8, 0x34, 0x2A, 0xDD, 0x27, 0xEA, 0x33, 0x49, 0xD5, 0x19, 0xBE, 0xA7, 0x5E, 0xCC, 0x5D, 0x15,
+    0xF6, 0xAE, 0xA9, 0xE4, 0xC7, 0x12, 0x8D, 0x18, 0x3E, 0x6A, 0x2B, 0x1D, 0xEF, 0x16, 0xB2, 0x7A,
+    0x17, 0x0B, 0xB9, 0xA8, 0x98, 0x51, 0x16, 0x1A, 0xBE, 0xDE, 0xA8, 0xDB, 0xBB, 0xF1, 0x6C, 0x3E,
+    0x00, 0x98, 0x34, 0xEE, 0x76, 0x55, 0xE5, 0xC8, 0x81, 0xE2, 0xB3, 0xAF, 0x66, 0x62, 0x30, 0x68,
+    0x51, 0x7C, 0x68, 0x34, 0x36, 0xDE, 0x95, 0xB1, 0xD2, 0x72, 0xF0, 0x8D, 0xE7, 0x8A, 0x00, 0xF0,
+    0x8D, 0xF9, 0xBE, 0x7C, 0xDB, 0x80, 0xEF, 0xAA, 0x6F, 0x3A, 0xBD, 0x27, 0x9D, 0xFB, 0xD3, 0x89,
+    0x9E, 0x22, 0x1B, 0xAD, 0x6C, 0x72, 0xC0, 0xED, 0x4F, 0xF4, 0xBC, 0xA1, 0x21, 0xF4, 0xF3, 0x13,
+    0x3D, 0x1D, 0x40, 0x98, 0x24, 0x48, 0x44, 0x4F, 0xF4, 0x5C, 0xE2, 0x44, 0xCF, 0x7E, 0x3A, 0xD1,
+    0xF3, 0xAA, 0x32, 0xB2, 0x51, 0x3D, 0x65, 0x16, 0xAD, 0xB4, 0xF0, 0xC8, 0x93, 0xA7, 0x26, 0x62,
+    0x3E, 0xC6, 0x73, 0x70, 0x15, 0x82, 0xEF, 0x1D, 0x4E, 0xB3, 0x78, 0xB8, 0xC3, 0xEF, 0x4D, 0xCE,
+    0x13, 0x36, 0x30, 0x6E, 0xD1, 0x95, 0x46, 0x5D, 0x2D, 0xA8, 0x70, 0x4A, 0x81, 0x17, 0x05, 0x63,
+    0x69, 0x4B, 0xD8, 0x45, 0x03, 0x83, 0x7A, 0x15, 0x67, 0xC4, 0xE0, 0x37, 0xBD, 0x0D, 0x24, 0x0A,
+    0xBA, 0xCC, 0x05, 0xBC, 0xD9, 0x46, 0x5C, 0xD9, 0x46, 0xEA, 0x82, 0x8D, 0xF6, 0x30, 0x8A, 0x3D,
+    0xE5, 0x0C, 0xDB, 0x18, 0xEC, 0x9F, 0x7C, 0x17, 0x9A, 0x14, 0xBA, 0x93, 0x7C, 0x22, 0xD7, 0x10,
+    0xBE, 0x61, 0xAB, 0x8A, 0xBB, 0x00, 0x93, 0x3D, 0x6D, 0xBC, 0x89, 0xCD, 0x05, 0x0D, 0x96, 0xAA,
+    0x62, 0x03, 0xA3, 0x8B, 0xE3, 0x5C, 0xFB, 0xA8, 0xB7, 0x67, 0x75, 0xD7, 0x63, 0xF5, 0x04, 0x75,
+    0x26, 0xD6, 0x41, 0xA7, 0xF2, 0x24, 0x03, 0x6C, 0x4B, 0xA2, 0x75, 0x0C, 0x9A, 0x18, 0x5F, 0x1D,
+    0xCD, 0x95, 0x81, 0x4A, 0x00, 0x6A, 0x60, 0x62, 0xB0, 0x41, 0x07, 0x18, 0xEF, 0xC6, 0x0E, 0xB9,
+    0x52, 0x02, 0x80, 0x1E, 0x52, 0x41, 0x2C, 0x63, 0x8F, 0x01, 0xD3, 0xC2, 0xFF, 0xC2, 0xE4, 0x6F,
+    0xE8, 0x45, 0xA9, 0x0A, 0x95, 0x9C, 0x87, 0x42, 0x5D, 0xA8, 0xB4, 0x09, 0x00, 0x37, 0x8A, 0x51,
+    0x94, 0x1F, 0x73, 0xF2, 0x49, 0x2F, 0xDC, 0x50, 0xA6, 0xE5, 0xC7, 0x2B, 0xD9, 0x2D, 0x85, 0xCE,
+    0x7C, 0x4D, 0x4F, 0x5A, 0x78, 0x38, 0x36, 0x8F, 0xF3, 0xB3, 0x3E, 0x24, 0xF9, 0x05, 0x32, 0xCE,
+    0xF7, 0x3D, 0xAD, 0xAC, 0xCA, 0x62, 0x4C, 0x1F, 0x68, 0x29, 0x82, 0xC5, 0xA6, 0x9D, 0xA1, 0xA4,
+    0x94, 0xA5, 0x30, 0xD0, 0x5D, 0xDF, 0x70, 0xCC, 0x26, 0xF8, 0x02, 0xE1, 0x37, 0xEE, 0x9C, 0x87,
+    0xA9, 0x26, 0x6F, 0xCD, 0xC3, 0xBC, 0x8B, 0xBC, 0x4D, 0x64, 0x9D, 0x53, 0x9D, 0xA7, 0x82, 0xAF,
+    0xD1, 0xEA, 0x09, 0x4E, 0xE8, 0x13, 0xC5, 0x96, 0x05, 0xD6, 0xAB, 0xDA, 0x91, 0x18, 0xC8, 0x44,
+    0x44, 0x96, 0xA4, 0x0D, 0xB0, 0x4D, 0xA2, 0xC0, 0xF1, 0x8A, 0x25, 0x2D, 0x79, 0x4E, 0xF8, 0xB4,
+    0x1C, 0x58, 0xBE, 0x0E, 0xBB, 0x5B, 0x88, 0x22, 0xFF, 0xAC, 0x95, 0x91, 0xF1, 0x14, 0x5D, 0xC4,
+    0x60, 0x95, 0x34, 0x57, 0xDA, 0xF0, 0xE5, 0x9A, 0xD4, 0x6B, 0xC1, 0x66, 0xF2, 0x5D, 0x3D, 0xF9,
+    0x02, 0x65, 0xD0, 0xCE, 0x60, 0x7A, 0xBE, 0x21, 0xAB, 0x05, 0xC7, 0x2F, 0x68, 0x61, 0x55, 0x3E,
+    0x72, 0x3D, 0xCE, 0x4C, 0x22, 0x64, 0x11, 0x20, 0x2F, 0xB9, 0xF9, 0x1D, 0x59, 0x86, 0xB2, 0x00,
+    0xD2, 0x85, 0xF7, 0x95, 0x79, 0xBC, 0xE0, 0x24, 0xE3, 0x94, 0x33, 0xDF, 0xAE, 0x96, 0x8B, 0xD7,
+    0x3C, 0x8B, 0xB4, 0x3B, 0x96, 0xAF, 0xBA, 0x53, 0x47, 0x9D, 0xD9, 0xDF, 0xDF, 0x3F, 0xE8, 0x18,
+    0x53, 0x65, 0x21, 0x33, 0xD9, 0x5A, 0xB5, 0xD0, 0xB0, 0x74, 0x6C, 0x43, 0x2B, 0x8D, 0x2D, 0x1B,
+    0x9B, 0x74, 0x30, 0x2C, 0xC4, 0x83, 0xAD, 0xA8, 0x42, 0x03, 0xD5, 0xC7, 0x8C, 0x2F, 0xD2, 0xB9,
+    0xDE, 0x77, 0x63, 0xC3, 0x6A, 0x36, 0x11, 0x6D, 0x96, 0xA8, 0xED, 0xFF, 0x5B, 0x30, 0x9B, 0x9C,
+    0x71, 0x01, 0xE3, 0x85, 0xB7, 0x79, 0xB2, 0xCD, 0xD3, 0xFB, 0xFB, 0xF2, 0x18, 0x4C, 0x6A, 0xFE,
+    0xD1, 0x71, 0xDD, 0xE8, 0x99, 0x40, 0xD0, 0x83, 0x00, 0x0A, 0x2D, 0xE8, 0x87, 0xDA, 0x80, 0x31,
+    0x16, 0x41, 0x60, 0x70, 0xAA, 0x82, 0x8E, 0xCD, 0x45, 0x2A, 0xBC, 0x7B, 0xBC, 0x13, 0x3B, 0xDE,
+    0xF0, 0x25, 0xAA, 0xF7, 0x4F, 0xAF, 0x53, 0xF0, 0x98, 0x8C, 0xDF, 0xC0, 0x72, 0x71, 0xA8, 0xC4,
+    0x8A, 0x10, 0x38, 0x7F, 0x09, 0xB6, 0xBD, 0xC5, 0x89, 0x1F, 0xEE, 0x10, 0x63, 0xDF, 0x49, 0xA7,
+    0xC4, 0x28, 0x17, 0x94, 0x39, 0x6B, 0xB5, 0xAE, 0x14, 0x83, 0x7F, 0xEB, 0xE4, 0xFD, 0x7F, 0xB7,
+    0xD7, 0x6E, 0xDA, 0x6B, 0xE3, 0x4A, 0xAD, 0xEF, 0x69, 0xAB, 0xD1, 0x00, 0x0E, 0x27, 0x4D, 0x6E,
+    0x87, 0xF2, 0xCC, 0x6D, 0x4A, 0x21, 0x3C, 0xF2, 0xA7, 0x3F, 0xEF, 0x40, 0x02, 0xA9, 0xA9, 0x9B,
+    0x52, 0x33, 0x85, 0xF0, 0x7C, 0x66, 0xF3, 0x78, 0x15, 0x24, 0xC7, 0xB1, 0xE2, 0x29, 0xEC, 0x36,
+    0xA0, 0xC6, 0x0C, 0x75, 0x25, 0x93, 0x1E, 0xA5, 0x6D, 0x86, 0xB8, 0x98, 0x55, 0xDD, 0x25, 0xE0,
+    0x2A, 0xC4, 0x92, 0x0A, 0xE8, 0x14, 0x46, 0x5D, 0x1A, 0x9B, 0x1C, 0x57, 0xB9, 0xE4, 0x38, 0x7E,
+    0x22, 0x9A, 0xCA, 0xDF, 0x86, 0xCB, 0x94, 0xC5, 0x49, 0x5D, 0x72, 0x1C, 0xAA, 0x56, 0xB1, 0x56,
+    0x61, 0xDE, 0xC6, 0x06, 0x27, 0x9C, 0xD7, 0xEE, 0x38, 0xD8, 0xB0, 0x95, 0x35, 0xD4, 0xA3, 0xFC,
+    0x81, 0x90, 0x14, 0xB4, 0xAF, 0x79, 0x59, 0xC7, 0x07, 0x74, 0x90, 0x75, 0xE4, 0x1C, 0x3B, 0x04,
+    0x6D, 0xFC, 0xB3, 0xFD, 0x4B, 0x55, 0x0C, 0xA5, 0x23, 0x56, 0x39, 0x92, 0x16, 0x48, 0x9A, 0x0B,
+    0x32, 0xA7, 0xAE, 0x92, 0xEE, 0xE3, 0x9F, 0x72, 0x35, 0x5D, 0xA7, 0xFC, 0xC7, 0x78, 0xD0, 0xCE,
+    0xD5, 0xEC, 0x88, 0x97, 0x9F, 0x27, 0x39, 0x70, 0x7F, 0x5A, 0xA1, 0xA8, 0x2F, 0xE7, 0x00, 0xA4,
+    0x9B, 0x6B, 0x42, 0x3E, 0x22, 0xFF, 0xFC, 0x96, 0x9A, 0x41, 0x29, 0x6F, 0x5D, 0xD8, 0xE8, 0x0B,
+    0x97, 0x5F, 0xF2, 0x53, 0x32, 0xD7, 0x23, 0xCF, 0xFB, 0x6D, 0x06, 0x15, 0x6B, 0x8A, 0x90, 0xAD,
+    0x91, 0xE7, 0x62, 0x6F, 0x29, 0xE8, 0x26, 0x13, 0xE0, 0x8F, 0x69, 0xF3, 0x02, 0xFE, 0xFA, 0x3A,
+    0xF8, 0x55, 0x49, 0xD7, 0x5F, 0x1B, 0xE1, 0xE8, 0x00, 0x28, 0x87, 0x1A, 0x92, 0xFD, 0xB4, 0x96,
+    0xC0, 0x2A, 0x75, 0xFD, 0x96, 0x5B, 0x5E, 0xA4, 0x75, 0x71, 0x0F, 0x8B, 0x5C, 0x69, 0x0F, 0x5B,
+    0x39, 0xC3, 0x46, 0xA5, 0xAE, 0x6D, 0x8C, 0x36, 0x44, 0x21, 0x36, 0x53, 0x51, 0x0F, 0x5B, 0xD3,
+    0xC3, 0x96, 0xF4, 0xB0, 0x15, 0x3D, 0x6C, 0x41, 0x0F, 0x5B, 0xCF, 0xC3, 0x96, 0xF3, 0xB0, 0xD5,
+    0x3C, 0x6C, 0x31, 0x0F, 0x5B, 0xCB, 0xC3, 0x96, 0xF2, 0xB0, 0x95, 0x3C, 0x6C, 0x21, 0x0F, 0x5B,
+    0xC7, 0x63, 0xF6, 0x74, 0x9C, 0xC5, 0xC7, 0x22, 0x1E, 0x5A, 0xC3, 0xE3, 0x86, 0x2D, 0xE1, 0x21,
+    0x43, 0xBF, 0xAF, 0x62, 0x7C, 0x33, 0x2B, 0x52, 0xFC, 0x25, 0xD7, 0xDB, 0x98, 0x8E, 0xF4, 0xD9,
+    0x51, 0xAB, 0x48, 0xAE, 0x36, 0x96, 0x52, 0x51, 0xAE, 0xC5, 0xA3, 0xCF, 0x9C, 0x38, 0x28, 0xE9,
+    0x31, 0x9F, 0x89, 0x10, 0x59, 0x21, 0x7A, 0xD6, 0xB5, 0xE6, 0xE8, 0x7A, 0x51, 0xA7, 0x56, 0x59,
+    0xDF, 0x7B, 0x94, 0x66, 0x25, 0x6C, 0x63, 0x32, 0x18, 0xF4, 0x2D, 0xD6, 0x22, 0xCE, 0x3D, 0x79,
+    0x44, 0xB1, 0xDD, 0xCF, 0x2F, 0x54, 0x03, 0x1A, 0x10, 0xE3, 0x14, 0x8C, 0xAC, 0x42, 0x78, 0x02,
+    0xDE, 0xC7, 0x1A, 0xD0, 0x43, 0xD8, 0xAA, 0xA0, 0xC3, 0x80, 0xFF, 0x60, 0xA1, 0xBE, 0xEC, 0x4D,
+    0xBD, 0x73, 0xAB, 0x4C, 0xB4, 0xBF, 0x55, 0x26, 0x3A, 0x9B, 0x95, 0x89, 0x66, 0x75, 0xD3, 0x35,
+    0x30, 0x0E, 0xDC, 0x75, 0x99, 0xE8, 0xFB, 0x3C, 0x7C, 0x3C, 0x19, 0xC0, 0x42, 0xEF, 0x01, 0x0C,
+    0xDF, 0x3D, 0x95, 0xD0, 0xDE, 0xDF, 0xBF, 0xD4, 0xA9, 0xDC, 0x7A, 0x7C, 0x7C, 0x65, 0x3D, 0x40,
+    0x77, 0x3F, 0x36, 0x41, 0x07, 0xF2, 0x8B, 0x60, 0x72, 0x03, 0x11, 0xA2, 0xFA, 0xEB, 0x03, 0x26,
+    0xBF, 0x07, 0x3D, 0x7E, 0x73, 0x61, 0x7B, 0x38, 0x5D, 0xD8, 0x7E, 0xB8, 0x43, 0xBC, 0x67, 0xF3,
+    0x62, 0x69, 0xAE, 0xA6, 0x79, 0x9D, 0xB2, 0xD3, 0x29, 0x2C, 0x97, 0x01, 0x65, 0x7A, 0x00, 0x0E,
+    0x25, 0x28, 0x8F, 0x22, 0x14, 0x5E, 0x56, 0xDE, 0x24, 0x63, 0x6C, 0x4D, 0x5C, 0x58, 0x63, 0x94,
+    0x9E, 0x7A, 0xB7, 0xA9, 0x14, 0x17, 0x16, 0xC6, 0x54, 0x89, 0x62, 0x17, 0xA8, 0xBA, 0x01, 0xB7,
+    0x3F, 0x25, 0xF7, 0xA1, 0x4C, 0x05, 0xF3, 0x2F, 0x72, 0xC4, 0xE8, 0x7F, 0xCB, 0xE9, 0x7E, 0xCB,
+    0x7B, 0x58, 0x13, 0x12, 0xF3, 0xF6, 0x6A, 0xAA, 0x6C, 0xCB, 0x17, 0x8A, 0x84, 0xB5, 0x82, 0xA5,
+    0x8A, 0x64, 0xD9, 0xC4, 0xDD, 0x54, 0xB4, 0xCD, 0xCA, 0x56, 0x0F, 0xE8, 0x28, 0x5D, 0xD9, 0x59,
+    0x2F, 0x7A, 0xD3, 0x19, 0xE5, 0xA7, 0x1C, 0x55, 0x4E, 0x9B, 0x97, 0xBC, 0xB1, 0x45, 0xD8, 0x88,
+    0x70, 0x02, 0xD6, 0x48, 0xB9, 0x0B, 0xAC, 0x58, 0xEB, 0x74, 0x6B, 0xA1, 0xEE, 0x4A, 0x2B, 0x75,
+    0xAB, 0x56, 0x92, 0xB1, 0xFC, 0x89, 0xC7, 0x62, 0xA7, 0x8C, 0xE7, 0xBF, 0xAA, 0x42, 0x17, 0xA5,
+    0xE9, 0x95, 0x6F, 0x13, 0xB4, 0xDB, 0x79, 0xBC, 0xFE, 0xDF, 0xF3, 0xA5, 0x33, 0x1B, 0xAF, 0x3F,
+    0x9E, 0x16, 0xB6, 0x3F, 0xCC, 0x3D, 0x27, 0xD6, 0xF9, 0xAC, 0x1B, 0x50, 0xAE, 0x53, 0x91, 0xEB,
+    0xC7, 0x52, 0xEB, 0x69, 0x51, 0x0A, 0x3D, 0x8B, 0xB8, 0x27, 0xCF, 0x9E, 0x4A, 0x39, 0xD9, 0xB3,
+    0xB7, 0xDE, 0x13, 0xE5, 0xA4, 0xB5, 0x94, 0xF4, 0x3A, 0x7E, 0x7F, 0x41, 0x2F, 0x2A, 0x4F, 0x81,
+    0x0E, 0xB4, 0x8C, 0x15, 0xB4, 0x98, 0x82, 0xF9, 0x08, 0xD4, 0x1B, 0x54, 0xA1, 0x62, 0x99, 0x68,
+    0x99, 0xE2, 0x1D, 0x6F, 0x3A, 0x65, 0x0F, 0xA5, 0xA1, 0xDD, 0x29, 0x7B, 0x2B, 0x3D, 0xB4, 0x46,
+    0x8F, 0x78, 0x69, 0xD7, 0x79, 0x56, 0xDA, 0xF1, 0xB9, 0x2B, 0xFA, 0xC2, 0xDA, 0xE5, 0xA2, 0xBE,
+    0x22, 0x65, 0xF3, 0x2C, 0xF3, 0x9C, 0xF2, 0x05, 0x6D, 0x05, 0x48, 0x7F, 0xE0, 0xD0, 0x71, 0x33,
+    0x00, 0xA2, 0xE8, 0x1F, 0x2C, 0xD6, 0x15, 0x49, 0x7E, 0x13, 0xA7, 0x51, 0xD5, 0x6B, 0x54, 0xEA,
+    0x76, 0x6A, 0xB5, 0xA8, 0xD4, 0xC5, 0x2D, 0xD5, 0xE9, 0xC7, 0x6C, 0x4A, 0xBD, 0x27, 0xDE, 0x7C,
+    0xB6, 0xA2, 0xE9, 0x44, 0x75, 0x82, 0x3F, 0xE5, 0x90, 0xBD, 0xAF, 0x56, 0x6E, 0x9D, 0xD9, 0xB0,
+    0x4B, 0xB4, 0xD8, 0xDC, 0x99, 0xDF, 0xB0, 0x99, 0xF5, 0x9E, 0xAD, 0x90, 0x7A, 0x53, 0x7E, 0x8F,
+    0x19, 0xB6, 0x78, 0x65, 0x7F, 0x89, 0x37, 0x0E, 0x7B, 0x94, 0x49, 0x8F, 0x69, 0xAB, 0x38, 0xBB,
+    0xCD, 0xD9, 0x1F, 0xB7, 0xF9, 0xDD, 0x51, 0xEF, 0xBC, 0xD3, 0x14, 0xAA, 0x3B, 0x68, 0x0A, 0x5F,
+    0x20, 0x74, 0xFC, 0x34, 0x54, 0x6C, 0xB8, 0xBE, 0x5B, 0x4F, 0x43, 0xC7, 0x5F, 0x3A, 0x2D, 0x74,
+    0xFC, 0xE2, 0x17, 0x73, 0x7D, 0x33, 0x74, 0x3C, 0xE2, 0xA1, 0x50, 0x76, 0x95, 0xF2, 0x9C, 0xB9,
+    0xB8, 0xCD, 0xAA, 0x5B, 0x1A, 0x6A, 0xEE, 0x2E, 0xC8, 0x9C, 0x53, 0x3B, 0x87, 0x86, 0xB0, 0x6E,
+    0xCF, 0x6F, 0x07, 0x99, 0x6F, 0x1E, 0xFC, 0x38, 0x83, 0x27, 0x82, 0xCC, 0x99, 0xD7, 0x6F, 0xE0,
+    0x9D, 0xF4, 0x98, 0xCA, 0xCA, 0x83, 0x0E, 0x51, 0x0D, 0xC3, 0x82, 0xE7, 0x1F, 0x50, 0x31, 0xB9,
+    0x62, 0xA3, 0x98, 0xDC, 0x39, 0x33, 0x39, 0x85, 0x4E, 0x4B, 0x4C, 0x8C, 0x27, 0x70, 0xEF, 0x75,
+    0xC2, 0xEE, 0x12, 0x6C, 0x96, 0x5B, 0xBB, 0xCB, 0x4C, 0xC9, 0xF5, 0x4E, 0xE4, 0xB6, 0x22, 0xB7,
+    0x17, 0xDD, 0x6E, 0x33, 0x72, 0x36, 0x0A, 0xAB, 0x07, 0x3B, 0x45, 0x78, 0xD2, 0x84, 0x9D, 0x2A,
+    0x7C, 0x4F, 0x78, 0xDF, 0x62, 0x08, 0xD4, 0xC0, 0x6F, 0x9B, 0x5E, 0xFF, 0x8E, 0xA8, 0xB0, 0x42,
+    0xEB, 0x4A, 0xD6, 0xD6, 0x01, 0xAD, 0x98, 0x65, 0xEF, 0x79, 0xA4, 0xD8, 0xED, 0xB1, 0xBB, 0xCE,
+    0x7E, 0x4E, 0x48, 0x1E, 0xEA, 0x31, 0x38, 0x98, 0xA1, 0x57, 0xA4, 0xA5, 0x82, 0x2C, 0x22, 0x15,
+    0x47, 0x2E, 0xB5, 0x7E, 0x70, 0x35, 0xB2, 0xAF, 0xF1, 0xAD, 0xCC, 0xED, 0xDB, 0x1A, 0xF3, 0x40,
+    0x2B, 0x9A, 0x2C, 0x03, 0xA1, 0x89, 0x9B, 0x1A, 0x8C, 0x9D, 0xB7, 0xBA, 0xDC, 0xB2, 0x46, 0x33,
+    0x65, 0xD2, 0xDB, 0x60, 0x9C, 0x47, 0xAA, 0xD8, 0x14, 0xFA, 0xFB, 0xB2, 0x55, 0x9C, 0xF4, 0x8A,
+    0xE3, 0x3B, 0x60, 0xEA, 0xF5, 0xA8, 0xA7, 0xD6, 0x32, 0xF6, 0xC1, 0x98, 0xDF, 0x37, 0x88, 0x32,
+    0x33, 0xD7, 0xD1, 0xAF, 0xC7, 0xA1, 0x22, 0x61, 0x78, 0x02, 0xD2, 0xFE, 0x06, 0xA7, 0x28, 0x83,
+    0x61, 0xD6, 0x29, 0x19, 0x17, 0xBD, 0xCF, 0xB3, 0xA4, 0x3E, 0x57, 0x05, 0xC3, 0xC2, 0xE5, 0xAA,
+    0xAD, 0x01, 0xB6, 0xA1, 0xAF, 0xE2, 0xC2, 0x94, 0x67, 0x73, 0x32, 0x5C, 0xE8, 0xE2, 0x23, 0x9B,
+    0x9B, 0x69, 0x6E, 0x9B, 0x9B, 0x59, 0x68, 0x6E, 0xA6, 0x32, 0xF8, 0x68, 0x03, 0xD9, 0xE0, 0x18,
+    0x8D, 0xBB, 0xFC, 0xAA, 0xB5, 0xDE, 0x5B, 0x67, 0xBF, 0x35, 0x54, 0xAE, 0x2B, 0x20, 0x3E, 0xE4,
+    0xDC, 0xCC, 0x23, 0xE6, 0x66, 0x76, 0xEB, 0x18, 0xB4, 0x39, 0x54, 0x09, 0xFB, 0xAF, 0xF5, 0x20,
+    0x82, 0x66, 0x5D, 0xD4, 0xE9, 0xA9, 0x07, 0x32, 0x45, 0xA1, 0x0D, 0x0C, 0x76, 0x05, 0x4E, 0x1E,
+    0xD4, 0x14, 0x15, 0x9F, 0x6F, 0xA8, 0x43, 0x56, 0xDE, 0x54, 0xF8, 0x05, 0x86, 0xBA, 0xFD, 0xFF,
+    0xE5, 0x5C, 0xBD, 0x8F, 0xDC, 0xC6, 0x15, 0x7F, 0x24, 0x4F, 0x4B, 0x48, 0x04, 0xC4, 0x2B, 0x24,
+    0x20, 0xD6, 0x41, 0x62, 0xE3, 0xC2, 0x90, 0x2D, 0x6D, 0xAB, 0x42, 0x27, 0x32, 0xF1, 0x1F, 0x10,
+    0x15, 0x16, 0x52, 0xA8, 0x48, 0x0A, 0x17, 0x89, 0x9A, 0x4B, 0xE1, 0xC2, 0x85, 0x74, 0x4B, 0x23,
+    0x85, 0x0B, 0x17, 0xB9, 0x22, 0xB0, 0xCB, 0x5C, 0x02, 0x15, 0x92, 0x53, 0x28, 0x85, 0x8B, 0x2B,
+    0xCE, 0xC7, 0x0D, 0xF2, 0x07, 0x84, 0x49, 0xE3, 0xD2, 0x1B, 0x40, 0x30, 0x8C, 0x34, 0x61, 0x80,
+    0x55, 0xB2, 0x07, 0x2F, 0x77, 0xF2, 0xDE, 0xEF, 0xCD, 0x90, 0xDC, 0x73, 0x2C, 0x29, 0x90, 0x71,
+    0xB7, 0xBB, 0xB7, 0x38, 0xBC, 0xD9, 0x0F, 0xF2, 0xCD, 0xCC, 0xFB, 0xCD, 0xFB, 0x9C, 0xE1, 0x11,
+    0xD1, 0x84, 0xE4, 0xE5, 0xD7, 0x68, 0x82, 0x19, 0x9A, 0xD0, 0xA0, 0x89, 0x8A, 0x4C, 0x9A, 0x38,
+    0xCD, 0xA5, 0x49, 0xFA, 0x43, 0x69, 0x36, 0x93, 0x52, 0x9A, 0x9B, 0x71, 0x25, 0xCD, 0x7E, 0x84,
+    0x66, 0x1C, 0x08, 0x1B, 0xAF, 0x0A, 0xA6, 0xC2, 0x6B, 0x04, 0x6E, 0x41, 0x49, 0xC2, 0x2D, 0x1C,
+    0x92, 0x70, 0x8B, 0x73, 0x1A, 0x30, 0xB7, 0xD8, 0x18, 0xC3, 0x6C, 0xFA, 0xDA, 0x6C, 0x32, 0x57,
+    0xE6, 0x76, 0x9F, 0xBF, 0x67, 0x36, 0x7B, 0xDC, 0x23, 0x37, 0x63, 0xBE, 0x67, 0xC2, 0xBC, 0x98,
+    0xC3, 0x94, 0x02, 0x69, 0x6A, 0x0A, 0xA5, 0x31, 0xF4, 0x64, 0x96, 0xD3, 0x13, 0xF3, 0x54, 0xEE,
+    0x35, 0x66, 0x4C, 0x47, 0x5F, 0x0F, 0x75, 0x0E, 0x53, 0x6D, 0xEA, 0xEE, 0x27, 0xFA, 0x4C, 0x88,
+    0x77, 0x87, 0x49, 0x61, 0x46, 0x3C, 0xCF, 0xBB, 0x53, 0x0A, 0xC7, 0x54, 0x4B, 0x8F, 0x05, 0x05,
+    0x23, 0x26, 0x74, 0x9B, 0x06, 0x72, 0x91, 0x23, 0x67, 0x3E, 0x35, 0xE4, 0xF1, 0x38, 0x29, 0x3A,
+    0xE4, 0x8F, 0xC9, 0x88, 0x49, 0x3A, 0x14, 0x92, 0xF3, 0xC5, 0x8E, 0x18, 0xFE, 0xCE, 0x37, 0xFC,
+    0x6B, 0x92, 0x66, 0xB1, 0x99, 0xA6, 0x4F, 0x7D, 0x53, 0xF5, 0x27, 0x74, 0x71, 0x7E, 0x50, 0x18,
+    0x44, 0x4B, 0x3C, 0x0C, 0x3D, 0x54, 0x59, 0xF7, 0x0D, 0xC4, 0x7A, 0x2D, 0x2C, 0x75, 0xBC, 0x23,
+    0x15, 0xBD, 0x7E, 0x32, 0x00, 0x80, 0xEC, 0x54, 0x2B, 0x6D, 0x76, 0xE7, 0x26, 0xBD, 0xC4, 0xF8,
+    0xF5, 0x1E, 0x63, 0xFE, 0x3C, 0xBA, 0x4D, 0x99, 0xEF, 0x3A, 0x44, 0x10, 0xC9, 0x28, 0x0B, 0xFE,
+    0xCE, 0xD3, 0x21, 0xC9, 0xF0, 0x46, 0x6E, 0xB2, 0xC7, 0x0F, 0xE0, 0x23, 0x15, 0xAF, 0x22, 0x80,
+    0x01, 0x06, 0x75, 0x2C, 0x62, 0x8D, 0xCC, 0x0F, 0x20, 0xD5, 0xDF, 0x42, 0xAA, 0x0F, 0x14, 0xB7,
+    0x4A, 0x84, 0xF0, 0xAD, 0xD7, 0x72, 0xAB, 0xD8, 0x3B, 0xD2, 0xDF, 0x44, 0x97, 0x26, 0xCF, 0x3D,
+    0xE7, 0xA1, 0xBF, 0xC6, 0x4C, 0xBF, 0x64, 0xE6, 0xB7, 0xC2, 0x91, 0x30, 0x63, 0xAE, 0x19, 0x9D,
+    0x08, 0x44, 0x9E, 0xC2, 0x43, 0x56, 0xC9, 0x53, 0x6D, 0xE2, 0x5F, 0x41, 0xD4, 0xDE, 0x47, 0x2A,
+    0xE3, 0x06, 0xA2, 0x6A, 0x15, 0x21, 0xBA, 0xD3, 0x4C, 0x3C, 0x1E, 0xA2, 0x3F, 0xB1, 0x19, 0xBF,
+    0x13, 0xBE, 0xE1, 0x7F, 0xF8, 0xFA, 0xF8, 0x83, 0x89, 0xF4, 0x70, 0x9D, 0xD5, 0xAB, 0x9D, 0xED,
+    0x9D, 0x4C, 0x3A, 0xE7, 0x1F, 0xCC, 0xC7, 0x2C, 0xFF, 0x9A, 0xD2, 0xCC, 0x9F, 0x12, 0x4F, 0x6C,
+    0x22, 0xE4, 0x02, 0x25, 0xC2, 0xC8, 0x11, 0xEF, 0x5E, 0xC1, 0x88, 0x70, 0x67, 0xFE, 0x2C, 0x4B,
+    0x86, 0x3C, 0xA6, 0x64, 0xC8, 0xC3, 0x64, 0x32, 0xE2, 0x8B, 0x1D, 0x49, 0xE5, 0xBB, 0x82, 0x7F,
+    0x0D, 0xFF, 0x52, 0x06, 0xC6, 0xC4, 0x87, 0x54, 0x4C, 0xA3, 0x19, 0x9D, 0xB1, 0xCB, 0xC2, 0x6A,
+    0x93, 0x5A, 0x3A, 0xFA, 0x91, 0xDA, 0x36, 0xCF, 0x5A, 0x3A, 0x8C, 0xBA, 0xBE, 0x8C, 0xF7, 0x66,
+    0xED, 0x74, 0xE8, 0x14, 0xA4, 0x21, 0xC3, 0xFB, 0xA4, 0x74, 0x92, 0xE0, 0x0E, 0x83, 0xFA, 0x8A,
+    0x4C, 0x62, 0x6D, 0x51, 0xB4, 0x4B, 0x5E, 0x00, 0x24, 0x2D, 0x6F, 0x62, 0xC4, 0x33, 0x78, 0xAF,
+    0xAA, 0x90, 0x39, 0x78, 0xC3, 0x73, 0x3B, 0x1D, 0x3C, 0xAC, 0xBB, 0x8D, 0x8E, 0xA8, 0xDC, 0x0A,
+    0x23, 0xD8, 0xDF, 0x79, 0x8B, 0xA1, 0xA8, 0xF7, 0x89, 0x9E, 0xF1, 0x57, 0x5E, 0xB9, 0x51, 0x76,
+    0x45, 0x81, 0x99, 0x2C, 0x0A, 0x8C, 0xFE, 0xA3, 0xAE, 0x90, 0x63, 0x8D, 0x2A, 0xFA, 0xBF, 0x86,
+    0x58, 0xB7, 0xD5, 0x2C, 0x8E, 0x15, 0xA3, 0xAC, 0x6B, 0x26, 0x4E, 0x59, 0x70, 0x28, 0x42, 0x0A,
+    0x8C, 0x13, 0x10, 0xC4, 0x73, 0x2B, 0xA8, 0x4E, 0x5E, 0x05, 0x9F, 0x17, 0x44, 0xBA, 0x40, 0x31,
+    0x01, 0x0A, 0x74, 0x4B, 0x2F, 0x57, 0x75, 0x1B, 0x65, 0xEF, 0x29, 0xB2, 0x40, 0x61, 0xFB, 0x0F,
+    0x68, 0x52, 0x35, 0xC2, 0x36, 0xF8, 0x5C, 0x21, 0x95, 0xEC, 0xED, 0x38, 0x17, 0x08, 0x67, 0x78,
+    0x5F, 0x02, 0xE5, 0xDB, 0xAF, 0x0B, 0x0B, 0xFE, 0x71, 0xFB, 0x27, 0x95, 0x4C, 0xBD, 0x14, 0x03,
+    0x25, 0xF3, 0x58, 0x3F, 0x21, 0x30, 0x07, 0xD6, 0x74, 0xE4, 0xAD, 0xEB, 0x73, 0x31, 0x2E, 0x8D,
+    0xD6, 0x4F, 0x11, 0x5C, 0x57, 0x1B, 0x31, 0x40, 0x08, 0x10, 0xC1, 0xEE, 0xCF, 0x16, 0x0D, 0x2E,
+    0xFB, 0x0A, 0xD5, 0x4C, 0x9C, 0xDB, 0xB2, 0xE1, 0xA5, 0x05, 0x91, 0x3A, 0xB9, 0xD9, 0x68, 0xE7,
+    0x14, 0x81, 0x87, 0x4E, 0xA3, 0x27, 0x8D, 0x2C, 0x12, 0x37, 0x9F, 0xDD, 0xDD, 0xC5, 0x43, 0xD0,
+    0x06, 0x30, 0x6F, 0x69, 0x00, 0xB3, 0x8F, 0x78, 0x44, 0x03, 0x98, 0xB2, 0xD7, 0x0D, 0x60, 0x46,
+    0x74, 0x9A, 0xAC, 0x25, 0x16, 0x70, 0x79, 0x8D, 0xA1, 0x10, 0x91, 0x3C, 0x2B, 0xF8, 0xB6, 0x32,
+    0x72, 0x69, 0xF6, 0x2E, 0x2D, 0x1A, 0x8C, 0x16, 0x9C, 0x4A, 0xC1, 0x39, 0xB8, 0x6B, 0xC1, 0x29,
+    0x35, 0xE4, 0x54, 0xDF, 0xBC, 0x4E, 0xA7, 0x35, 0x72, 0xA9, 0x44, 0x3A, 0x8B, 0x67, 0x38, 0xBF,
+    0x23, 0x68, 0xE1, 0x5C, 0xD2, 0xD4, 0x96, 0xFA, 0x48, 0x3F, 0x45, 0x92, 0x9B, 0x1D, 0x7A, 0x0D,
+    0xF4, 0x32, 0x28, 0x3D, 0x87, 0x42, 0xD8, 0x4C, 0xF3, 0x17, 0x5E, 0xE9, 0xA8, 0x9F, 0x09, 0x0D,
+    0x65, 0xF4, 0x14, 0x81, 0xC6, 0xB9, 0x67, 0xC4, 0x13, 0x6D, 0x19, 0x61, 0x54, 0x18, 0x65, 0xD7,
+    0x7D, 0x5D, 0x57, 0xCF, 0x8D, 0x6F, 0x8B, 0xBC, 0x7D, 0x8F, 0xEF, 0xCF, 0xDC, 0x86, 0x5C, 0x33,
+    0x96, 0xEB, 0x93, 0x8A, 0xE2, 0x51, 0x20, 0x29, 0xB4, 0x37, 0xE5, 0x8C, 0x9A, 0x57, 0xC9, 0x40,
+    0xFA, 0x64, 0xF1, 0x16, 0xD2, 0x51, 0x21, 0x23, 0x35, 0x96, 0x34, 0x83, 0x02, 0x29, 0xC0, 0x54,
+    0xF0, 0x62, 0x31, 0xAF, 0x89, 0xC0, 0x2F, 0xB3, 0xE8, 0x99, 0x8B, 0x8F, 0xE5, 0x30, 0x90, 0x11,
+    0x79, 0xEF, 0xB8, 0xF1, 0xF8, 0x08, 0x74, 0x64, 0x7D, 0xC6, 0x63, 0xF7, 0x2E, 0xC0, 0xE2, 0x2D,
+    0x84, 0xFA, 0x06, 0xD2, 0x1E, 0x7E, 0x8E, 0x8B, 0x1F, 0xB4, 0xE5, 0x91, 0x04, 0x2B, 0x2B, 0xC9,
+    0x1A, 0x8B, 0x4D, 0xE7, 0x9A, 0x39, 0x2E, 0x01, 0x26, 0x97, 0x1E, 0x62, 0x9C, 0xB2, 0xE6, 0xFB,
+    0x3C, 0x87, 0xF5, 0x38, 0xB7, 0xB3, 0xF1, 0x45, 0x1D, 0x83, 0xA7, 0x98, 0xB4, 0x23, 0x74, 0xFC,
+    0xD8, 0x78, 0x70, 0x26, 0x49, 0x2D, 0xC5, 0xCA, 0xD4, 0xFC, 0x8D, 0xA1, 0x78, 0x3F, 0x11, 0x59,
+    0xFC, 0xD2, 0x37, 0xF3, 0xE6, 0x69, 0x09, 0x64, 0xFD, 0x2E, 0x32, 0xA1, 0xFC, 0x26, 0xDB, 0xB5,
+    0xF1, 0x1E, 0x9D, 0x0F, 0x4D, 0xC5, 0xA3, 0x29, 0xCA, 0xAE, 0x56, 0x1C, 0xFB, 0xC2, 0xBF, 0x94,
+    0xB7, 0x15, 0x3E, 0xF1, 0xE2, 0xE9, 0x9F, 0x64, 0xE1, 0x9B, 0x7F, 0xF1, 0xDD, 0xC1, 0xBF, 0x11,
+    0x90, 0x0C, 0x65, 0xB1, 0x5F, 0xA1, 0x38, 0x9B, 0x53, 0xDF, 0xA5, 0x30, 0x37, 0x9E, 0x48, 0x13,
+    0xFE, 0x97, 0x13, 0xB9, 0xB8, 0xE2, 0x71, 0xF5, 0xA7, 0x0C, 0xC2, 0xE0, 0x40, 0x3C, 0x19, 0x7F,
+    0x15, 0x94, 0xAC, 0xE1, 0x5E, 0x9B, 0x85, 0x1E, 0xAB, 0xF4, 0xAF, 0xAA, 0xC9, 0xD0, 0x48, 0x48,
+    0x63, 0x84, 0x71, 0x2A, 0x9F, 0x5E, 0x37, 0x02, 0x81, 0xBF, 0xDC, 0xD2, 0xBF, 0xD3, 0x78, 0x3E,
+    0xE4, 0xD0, 0x41, 0x29, 0xF7, 0xFF, 0x1E, 0xF5, 0xD3, 0x6F, 0x46, 0x4D, 0xFD, 0x74, 0x53, 0x14,
+    0x78, 0xAD, 0xA9, 0x9F, 0x22, 0xEC, 0x60, 0x19, 0xA5, 0xFF, 0xE0, 0xAB, 0x67, 0xEC, 0x0E, 0xFD,
+    0x29, 0x0B, 0x28, 0x18, 0x33, 0x14, 0xEC, 0xD3, 0xE3, 0x8A, 0x7D, 0x6B, 0x54, 0xC5, 0x20, 0xDC,
+    0x87, 0x25, 0x55, 0x63, 0xB7, 0x85, 0x20, 0xC2, 0x08, 0xC7, 0xD6, 0x33, 0x66, 0xDE, 0x8C, 0x23,
+    0x30, 0x2A, 0x76, 0x58, 0xCC, 0x1C, 0x45, 0x64, 0x1C, 0xAB, 0x88, 0x54, 0x2F, 0x42, 0x9A, 0x9E,
+    0x02, 0x80, 0x90, 0x66, 0x0D, 0x95, 0x38, 0x02, 0xC5, 0x0E, 0x49, 0xFA, 0x67, 0x81, 0xC2, 0x54,
+    0x2B, 0xA1, 0x07, 0x4D, 0xB0, 0xE6, 0xFF, 0x14, 0x7B, 0x2C, 0x99, 0xFA, 0xAA, 0xB8, 0xDA, 0x13,
+    0x8D, 0xB8, 0xBD, 0x28, 0x1A, 0xA1, 0x95, 0x32, 0x0A, 0x6B, 0x71, 0x36, 0xB1, 0xF9, 0x27, 0xBF,
+    0xBF, 0xBE, 0x21, 0x1C, 0xDE, 0xB0, 0xFB, 0x45, 0xBA, 0x1B, 0x01, 0x8D, 0x81, 0x8E, 0xAC, 0x04,
+    0x32, 0x33, 0x0E, 0x34, 0x03, 0xF3, 0x55, 0x45, 0xE1, 0x17, 0x1C, 0x61, 0x46, 0xB4, 0xE5, 0xA6,
+    0x81, 0xF5, 0xDC, 0x97, 0x20, 0x63, 0x51, 0xE0, 0xB9, 0x9A, 0x37, 0xF1, 0x90, 0x05, 0xE0, 0x19,
+    0x00, 0x28, 0x1F, 0x60, 0x41, 0x25, 0xC8, 0x0B, 0xBD, 0xA5, 0x53, 0x8D, 0x97, 0x89, 0x48, 0xCF,
+    0xED, 0x3A, 0x5B, 0x91, 0x4A, 0xAA, 0x70, 0x30, 0x90, 0xA8, 0x3B, 0x5E, 0x00, 0x85, 0xF9, 0xEE,
+    0xC8, 0xD5, 0x9F, 0x71, 0x06, 0x31, 0x3A, 0xEF, 0x57, 0x92, 0x1E, 0xB1, 0xFD, 0x1C, 0x0C, 0x89,
+    0xA3, 0xD7, 0xF7, 0x09, 0x71, 0x08, 0x33, 0xA9, 0xF9, 0xCF, 0x37, 0x10, 0xD4, 0x2B, 0xFC, 0x31,
+    0x87, 0x2D, 0xF3, 0x75, 0x61, 0x6A, 0xEF, 0xD3, 0x2C, 0x32, 0xA3, 0xF8, 0xED, 0x6A, 0x8D, 0xD3,
+    0x11, 0xEE, 0xB4, 0x5F, 0xD2, 0x36, 0xB2, 0xB5, 0x1B, 0x4E, 0x71, 0x0D, 0x6D, 0xE8, 0x5D, 0xC5,
+    0x4B, 0xFF, 0x99, 0xEC, 0x4D, 0x73, 0x98, 0x9A, 0xD9, 0xF7, 0x3E, 0x5A, 0x3B, 0xA6, 0x9F, 0xCB,
+    0x97, 0x9E, 0xFE, 0xCA, 0x43, 0xBD, 0xD0, 0xB9, 0xF8, 0x60, 0x6E, 0x71, 0xBC, 0xCA, 0xE0, 0x2D,
+    0x8B, 0x5F, 0x74, 0x98, 0x3F, 0x68, 0xC0, 0x33, 0x33, 0xEC, 0x1A, 0x0A, 0xAE, 0x26, 0xE7, 0xA0,
+    0x5B, 0xDC, 0xD6, 0x20, 0x8F, 0xC6, 0x92, 0xEC, 0xC6, 0xE2, 0x29, 0x2B, 0x16, 0x24, 0x7B, 0x34,
+    0x31, 0x7B, 0xC1, 0x54, 0x56, 0x64, 0x30, 0x95, 0xD5, 0xE9, 0xD7, 0x92, 0x6F, 0xFB, 0xB5, 0x41,
+    0xAC, 0x2E, 0xD4, 0xFB, 0x16, 0xF5, 0x67, 0x7A, 0x8D, 0x5E, 0xAF, 0xF7, 0x2A, 0x1F, 0xC9, 0xCE,
+    0xC3, 0x71, 0x02, 0xFE, 0xE2, 0x32, 0x93, 0x52, 0xFA, 0x95, 0xFC, 0x53, 0x5C, 0x26, 0xA5, 0xB3,
+    0x82, 0x97, 0x7A, 0x4F, 0x55, 0x04, 0x4B, 0xDA, 0xBE, 0x7A, 0x79, 0x63, 0x99, 0xE6, 0x28, 0xB6,
+    0xF0, 0xB1, 0x24, 0x0B, 0x36, 0x62, 0xBC, 0xF6, 0x27, 0xBC, 0xF6, 0x99, 0x53, 0x1F, 0x09, 0x6E,
+    0xC6, 0x9C, 0x79, 0xED, 0xF7, 0x87, 0x85, 0xF4, 0x24, 0xCA, 0x58, 0x72, 0x27, 0xF1, 0xA8, 0x25,
+    0xC6, 0x91, 0x12, 0x97, 0xE0, 0x62, 0x1E, 0x4D, 0x9A, 0x83, 0x41, 0x5C, 0x31, 0x2B, 0x30, 0xE5,
+    0x65, 0xBB, 0xD3, 0x5D, 0xFB, 0xDE, 0xAE, 0xCB, 0x81, 0xC3, 0x36, 0x1B, 0x46, 0x30, 0xD5, 0x1F,
+    0x6B, 0x69, 0x0A, 0x75, 0x0E, 0x2D, 0x2A, 0x26, 0xED, 0x6E, 0x76, 0x58, 0x37, 0xA3, 0x16, 0x2B,
+    0x41, 0xB0, 0x18, 0xCB, 0x86, 0x49, 0xEF, 0x11, 0x16, 0x66, 0x26, 0x65, 0x16, 0xBE, 0x77, 0x1D,
+    0x35, 0x5F, 0xA9, 0xD5, 0x7B, 0xE8, 0x62, 0x8C, 0xEA, 0x0A, 0x4A, 0x72, 0x8D, 0xB8, 0x8E, 0x1B,
+    0x21, 0xAD, 0x05, 0x62, 0xFF, 0x00, 0x95, 0xDD, 0xB8, 0x92, 0x1D, 0x84, 0x54, 0x62, 0x0E, 0xAA,
+    0x45, 0xC3, 0xFC, 0x4A, 0x92, 0xCD, 0x30, 0x0F, 0xCA, 0x79, 0x63, 0xBC, 0x3C, 0x7A, 0x81, 0xA9,
+    0x62, 0xB7, 0x8F, 0xA7, 0x19, 0x4E, 0x24, 0xAE, 0xAA, 0xDF, 0xE0, 0x4B, 0x07, 0x28, 0x78, 0x0D,
+    0x19, 0x02, 0xDD, 0x89, 0x58, 0x3F, 0x09, 0x0C, 0x74, 0x33, 0x39, 0xAC, 0x9A, 0xB8, 0xD6, 0xD5,
+    0xE2, 0xCE, 0xA6, 0xA8, 0x5E, 0xAC, 0x02, 0x06, 0x17, 0xE7, 0x37, 0x3D, 0xFC, 0x4A, 0x98, 0xBD,
+    0x2B, 0xD5, 0xBA, 0x40, 0x8E, 0x6A, 0x44, 0xC3, 0x7D, 0xF1, 0xE1, 0x50, 0xFE, 0x26, 0x36, 0x91,
+    0x0C, 0x20, 0x12, 0x2F, 0xC0, 0xA9, 0x46, 0xCE, 0x9E, 0x39, 0x19, 0x71, 0xAA, 0x11, 0x56, 0x81,
+    0x54, 0xE1, 0x59, 0x5A, 0xFE, 0x94, 0x3B, 0xF6, 0x6A, 0x91, 0x54, 0x2D, 0x13, 0x9D, 0x75, 0x48,
+    0x65, 0x49, 0x8D, 0x4B, 0x70, 0x31, 0x3B, 0xF9, 0x60, 0x02, 0x06, 0x24, 0xA5, 0x3B, 0x65, 0x1A,
+    0x9A, 0xC3, 0x36, 0xD5, 0xB8, 0xDD, 0xD6, 0xBB, 0xCF, 0xC4, 0x9D, 0xED, 0x8E, 0x6D, 0xE8, 0x44,
+    0x05, 0x9D, 0x58, 0x5F, 0x1D, 0x9D, 0xD0, 0xD1, 0x0A, 0xBF, 0xBB, 0x4D, 0xF1, 0x68, 0x83, 0x45,
+    0x32, 0xD9, 0x14, 0xED, 0xB8, 0xB0, 0x28, 0xDA, 0x61, 0x3B, 0xF6, 0x4C, 0x86, 0x8A, 0xF1, 0x37,
+    0x52, 0xE0, 0xFD, 0x50, 0x62, 0xCD, 0x73, 0xBA, 0x93, 0xD6, 0x89, 0xC3, 0x69, 0x75, 0xF4, 0xC5,
+    0x46, 0xE7, 0xD9, 0x0D, 0x9E, 0xF8, 0x21, 0x2F, 0xF8, 0xAF, 0x38, 0x94, 0x0F, 0xF2, 0xBE, 0x8B,
+    0x86, 0x43, 0x31, 0x13, 0xB1, 0xF8, 0xC7, 0x45, 0x01, 0x09, 0xB1, 0xB7, 0x75, 0xE8, 0x16, 0x86,
+    0x6D, 0x9C, 0x1E, 0x04, 0x0C, 0xC3, 0x70, 0x48, 0xDD, 0x08, 0x7C, 0xA5, 0x42, 0x2A, 0x5F, 0xCA,
+    0xB3, 0x91, 0xCC, 0x39, 0x91, 0xCC, 0x20, 0x15, 0x94, 0xA6, 0x8B, 0xA0, 0x36, 0xCF, 0x0B, 0xBD,
+    0x6C, 0x9E, 0xA8, 0x19, 0x0C, 0x91, 0xC6, 0xBF, 0xFE, 0xA4, 0x7B, 0x10, 0xD7, 0xE6, 0xEA, 0x6B,
+    0x36, 0x42, 0xE1, 0x39, 0x4E, 0x80, 0x1B, 0x4F, 0x55, 0x80, 0xE3, 0x8B, 0x81, 0xDC, 0x58, 0xA1,
+    0xAB, 0x80, 0xDD, 0x17, 0x43, 0x80, 0x37, 0x23, 0x45, 0x8F, 0x54, 0xEC, 0xA4, 0x18, 0x90, 0x02,
+    0x42, 0x8A, 0x0E, 0x29, 0x54, 0xA4, 0xB8, 0xFD, 0x8F, 0x86, 0x7F, 0xB3, 0x57, 0xDA, 0xFB, 0x2C,
+    0x17, 0xCB, 0x53, 0xB1, 0x24, 0x05, 0x93, 0x14, 0x4D, 0xB2, 0x70, 0x5A, 0x3C, 0x2D, 0xA0, 0x0E,
+    0x51, 0x07, 0x69, 0xEF, 0x61, 0x8B, 0xA0, 0x6E, 0x81, 0xB5, 0xB5, 0x55, 0x11, 0xCF, 0x59, 0xD4,
+    0x38, 0xB4, 0x86, 0xC1, 0x94, 0xC5, 0xC9, 0x57, 0x31, 0x70, 0xD1, 0x50, 0x84, 0x1C, 0xE5, 0x02,
+    0x5D, 0x02, 0xEC, 0x26, 0x00, 0x4F, 0x30, 0xC0, 0x25, 0x18, 0x02, 0x60, 0x22, 0xC0, 0x36, 0x47,
+    0x4D, 0x43, 0x4B, 0x7B, 0xA5, 0xDE, 0x05, 0x1C, 0x75, 0x25, 0x28, 0x92, 0x16, 0x4A, 0xC5, 0xD2,
+    0x82, 0xD9, 0x9B, 0xDB, 0x09, 0xB3, 0x70, 0x35, 0x87, 0x3E, 0xB5, 0xEE, 0xEF, 0x37, 0x67, 0x85,
+    0x57, 0x0A, 0x2F, 0xEF, 0x71, 0xA7, 0x6C, 0xA0, 0x1B, 0x97, 0x3A, 0x61, 0x3D, 0xBD, 0x45, 0x9F,
+    0x01, 0xAF, 0xF5, 0xC5, 0xC2, 0xCB, 0x5A, 0x42, 0x9B, 0xDB, 0xB8, 0xE4, 0xC6, 0x66, 0x37, 0x16,
+    0x37, 0xCD, 0x6F, 0x6C, 0x82, 0x63, 0x33, 0x1C, 0x49, 0x71, 0x56, 0x4B, 0xDB, 0x90, 0x00, 0x69,
+    0x06, 0xA4, 0x29, 0x90, 0xCD, 0x81, 0x14, 0x44, 0x64, 0x41, 0xF6, 0x8C, 0xB9, 0x0F, 0xCD, 0xE3,
+    0x44, 0x68, 0xA1, 0x90, 0xF4, 0x7E, 0xE3, 0x4E, 0x77, 0xFE, 0x11, 0x16, 0xFE, 0xEF, 0x15, 0xE2,
+    0x73, 0x23, 0x20, 0xDD, 0xF0, 0x6C, 0x7D, 0x6A, 0x6D, 0xC5, 0x40, 0xBB, 0xA3, 0x3E, 0x7A, 0x78,
+    0x59, 0x4E, 0x0E, 0x4C, 0x38, 0x1D, 0x8C, 0x7C, 0x29, 0xCA, 0x9F, 0xA7, 0xC1, 0xE8, 0x2C, 0x42,
+    0xF4, 0xC5, 0x52, 0x36, 0x5A, 0x39, 0x17, 0x35, 0x17, 0x77, 0x58, 0x57, 0x75, 0xA4, 0x09, 0x5D,
+    0x64, 0x7B, 0xB6, 0x53, 0x72, 0x5F, 0x20, 0x44, 0x6C, 0xF4, 0x61, 0x7D, 0x96, 0x1E, 0x24, 0xD3,
+    0xF7, 0x88, 0x40, 0x06, 0x9C, 0xD9, 0xA5, 0x66, 0x6C, 0x1B, 0x5F, 0x66, 0xAF, 0xC5, 0x67, 0x71,
+    0xC3, 0x27, 0xD1, 0xEC, 0x69, 0x4D, 0x77, 0x82, 0x92, 0xB2, 0x44, 0x6E, 0x69, 0x09, 0x17, 0x93,
+    0x1C, 0x2A, 0x8E, 0x52, 0x03, 0x46, 0x00, 0x37, 0x6E, 0x4E, 0x95, 0xB4, 0xAF, 0xBD, 0xEE, 0x99,
+    0x1B, 0x7F, 0xD6, 0xFD, 0xD4, 0x39, 0x01, 0x9E, 0xCE, 0xA4, 0x46, 0xF9, 0xE6, 0x4C, 0xCA, 0x94,
+    0x22, 0x39, 0xEC, 0xA0, 0x7D, 0x3F, 0xB4, 0x40, 0x85, 0x74, 0x90, 0xC9, 0x29, 0xDE, 0xB4, 0x4C,
+    0x06, 0x62, 0xAA, 0xEA, 0xC1, 0xD7, 0x3C, 0xEC, 0x4A, 0xC2, 0xF1, 0x8B, 0xF4, 0x12, 0xC1, 0x2C,
+    0x56, 0x90, 0x35, 0x69, 0x11, 0xF6, 0x0E, 0x28, 0xFA, 0xE1, 0x78, 0xEE, 0x50, 0x91, 0x2E, 0xBD,
+    0x54, 0x97, 0xDE, 0x26, 0xB5, 0x1B, 0x72, 0xB2, 0x01, 0xD4, 0xD9, 0xD6, 0x59, 0x05, 0x6C, 0x2F,
+    0xED, 0xB6, 0x1E, 0x7C, 0x0C, 0x97, 0x9D, 0x75, 0xAA, 0x93, 0x3D, 0xA0, 0xAB, 0x07, 0xC7, 0xD4,
+    0x77, 0x87, 0x47, 0xF6, 0x2A, 0x4E, 0x1C, 0x6D, 0x7B, 0xF6, 0x5D, 0xB7, 0x5A, 0x09, 0xFA, 0xDC,
+    0x3D, 0x83, 0xEB, 0x8E, 0x4C, 0xBB, 0x67, 0xEC, 0x24, 0x3B, 0xBB, 0x6E, 0xDF, 0x16, 0x39, 0xC0,
+    0x9B, 0x14, 0x43, 0xB4, 0xD3, 0x7E, 0x0E, 0x14, 0xA7, 0x71, 0xA6, 0x62, 0x4D, 0xAC, 0x78, 0x1F,
+    0x68, 0x5B, 0x54, 0xDA, 0x7E, 0x4E, 0x8D, 0xD8, 0x8F, 0xA5, 0xDD, 0xA3, 0x06, 0x58, 0x87, 0xAC,
+    0x83, 0xD6, 0x61, 0xDB, 0x80, 0xEB, 0xD0, 0x6D, 0x55, 0xD7, 0xA5, 0x40, 0xF9, 0xF3, 0x52, 0xA0,
+    0x5E, 0x86, 0x14, 0x48, 0xCF, 0xC8, 0x51, 0xDF, 0x99, 0x60, 0x80, 0x1B, 0x8C, 0x80, 0x6E, 0x30,
+    0x04, 0xBC, 0x51, 0x0E, 0x74, 0x0E, 0x14, 0xA4, 0x91, 0xC3, 0xEA, 0x55, 0x1B, 0xC5, 0xDA, 0x82,
+    0x6D, 0xD1, 0xB6, 0x70, 0x3B, 0xBC, 0x1D, 0xE0, 0xF7, 0xB2, 0xEE, 0xF6, 0x6B, 0x0B, 0xB8, 0x8D,
+    0x94, 0x9D, 0x16, 0x37, 0x9A, 0x2B, 0x13, 0x3B, 0x45, 0x88, 0x6B, 0x8D, 0x82, 0x22, 0xFD, 0xD2,
+    0xB7, 0xB9, 0xD4, 0xC1, 0xDC, 0x99, 0x66, 0x36, 0x82, 0x82, 0x38, 0xEB, 0xC2, 0x52, 0x20, 0xEE,
+    0x02, 0x50, 0x6B, 0xAE, 0x5B, 0x7B, 0xED, 0xA0, 0xB6, 0x16, 0xDB, 0x99, 0xEC, 0x06, 0x79, 0x6B,
+    0xB4, 0xC5, 0x6A, 0x9F, 0x26, 0x9D, 0x57, 0x9B, 0xEE, 0xD2, 0x32, 0xB5, 0xEA, 0xCE, 0xAC, 0xDB,
+    0xB4, 0xAC, 0x67, 0x1F, 0xE7, 0x1A, 0xB9, 0xB4, 0xAC, 0x87, 0x42, 0xE2, 0x72, 0xAC, 0x87, 0x9E,
+    0xB5, 0x00, 0x83, 0x71, 0x98, 0xE9, 0x44, 0x7F, 0x8C, 0x55, 0x50, 0x16, 0x90, 0x87, 0x3F, 0x8C,
+    0xA7, 0x8D, 0xB1, 0x3F, 0x45, 0xB8, 0xBF, 0x28, 0x89, 0x83, 0xD8, 0xD6, 0x96, 0x03, 0xE2, 0xF6,
+    0x18, 0xC4, 0x29, 0x71, 0xD3, 0xF3, 0x31, 0x76, 0x13, 0x56, 0xDB, 0x28, 0xBB, 0xF9, 0xDC, 0x89,
+    0xB3, 0xAD, 0x16, 0x2C, 0x0D, 0x9C, 0x2F, 0xCA, 0xF4, 0x34, 0x30, 0x7F, 0x4C, 0x9D, 0x42, 0x98,
+    0xAD, 0x84, 0xB9, 0xDA, 0x9F, 0x8D, 0x57, 0x5C, 0x28, 0xB7, 0xDE, 0x3D, 0x14, 0x31, 0xF5, 0x8C,
+    0xC9, 0x6C, 0x23, 0xE3, 0x89, 0x26, 0x60, 0x22, 0xE7, 0x19, 0x39, 0x6B, 0x15, 0xE6, 0x1C, 0x2F,
+    0xC8, 0x99, 0x62, 0xCE, 0x53, 0x13, 0xED, 0x75, 0x53, 0xF7, 0x18, 0xEE, 0xAB, 0x9B, 0xD4, 0x5D,
+    0x7A, 0xCD, 0xB0, 0x8B, 0xB7, 0x35, 0xCF, 0xFC, 0x48, 0x9F, 0x20, 0xF8, 0x52, 0x07, 0x51, 0x77,
+    0x1F, 0x16, 0x0A, 0x26, 0xFF, 0x6F, 0xA3, 0xF7, 0xA1, 0x84, 0x4E, 0x7E, 0x61, 0x70, 0x7A, 0xDE,
+    0xE0, 0x14, 0xE0, 0xA5, 0x9D, 0x56, 0x0E, 0xC1, 0xB8, 0xF3, 0xC0, 0xFB, 0xAD, 0x4E, 0x89, 0xDA,
+    0x3B, 0xB2, 0x50, 0x8C, 0x19, 0xF6, 0xCD, 0x70, 0xCB, 0xE4, 0x1B, 0x26, 0x17, 0xA6, 0x53, 0xF4,
+    0x30, 0x81, 0xC7, 0x97, 0x4D, 0x41, 0x38, 0x45, 0x83, 0xF3, 0x37, 0x83, 0x0C, 0xF3, 0xCF, 0x79,
+    0x1D, 0xC8, 0xE3, 0xDC, 0xF2, 0x3C, 0x43, 0x99, 0xE0, 0x88, 0xE2, 0x75, 0x04, 0xCE, 0x9B, 0x18,
+    0xA5, 0xC8, 0xC1, 0x9B, 0x62, 0x7D, 0xD5, 0x18, 0x4A, 0x51, 0xB5, 0x3E, 0x55, 0x2B, 0xC8, 0x7A,
+    0x46, 0x54, 0x8F, 0x98, 0xF7, 0x3B, 0x23, 0xDC, 0x6F, 0x77, 0x75, 0x75, 0x87, 0x77, 0xAB, 0xC4,
+    0x52, 0x90, 0x0B, 0xFB, 0x4F, 0x97, 0x1F, 0xA0, 0x23, 0x2F, 0x4D, 0xF9, 0xDD, 0x0D, 0xAE, 0xBF,
+    0x69, 0xF7, 0xA9, 0xF7, 0x05, 0x42, 0x08, 0xA3, 0xDD, 0x97, 0xAE, 0xBD, 0x89, 0xD0, 0x10, 0x8F,
+    0xBB, 0x6C, 0x95, 0xDE, 0x78, 0x0E, 0x21, 0x92, 0xA7, 0x41, 0x14, 0x2A, 0x08, 0xF5, 0x86, 0x55,
+    0x3A, 0xFB, 0x10, 0x63, 0x62, 0xF3, 0xE6, 0xEE, 0xBF, 0xCB, 0xB0, 0x73, 0xF5, 0x76, 0x56, 0x45,
+    0x11, 0xE9, 0x5E, 0x8E, 0x92, 0x20, 0xFE, 0x1B, 0x46, 0x89, 0x7D, 0xA4, 0xEE, 0x13, 0x16, 0x1B,
+    0xE3, 0xF6, 0x51, 0xDC, 0x2B, 0xD4, 0xD2, 0x65, 0x55, 0x4A, 0xA2, 0xD7, 0xEC, 0xB0, 0x47, 0x31,
+    0x84, 0x50, 0x4B, 0xD7, 0xC1, 0x07, 0x78, 0xC2, 0x24, 0xCC, 0x6C, 0x75, 0xDF, 0x5B, 0x15, 0x74,
+    0x75, 0x9D, 0xC6, 0x72, 0xCC, 0x95, 0xFA, 0xE6, 0xAF, 0x3C, 0x84, 0x9B, 0x78, 0x82, 0xE3, 0x3D,
+    0x5F, 0x9F, 0x30, 0x5B, 0x5B, 0x66, 0x2C, 0xFF, 0x0B, 0xBD, 0x59, 0xBD, 0x73, 0xDD, 0x58, 0x15,
+    0x3F, 0x92, 0xE2, 0x08, 0x56, 0x03, 0x4A, 0x11, 0x33, 0x9B, 0x8F, 0xB1, 0x52, 0xA4, 0xC8, 0x7A,
+    0xB0, 0xD5, 0x50, 0xA4, 0xB0, 0xAD, 0xCB, 0xA4, 0xA0, 0x4D, 0x11, 0x6F, 0xB1, 0xCC, 0x10, 0x8A,
+    0xAD, 0xD2, 0x64, 0x9B, 0x9D, 0xC9, 0x80, 0x63, 0x5D, 0x76, 0x0B, 0x0A, 0x0A, 0xFC, 0x27, 0xA4,
+    0xC8, 0xCE, 0xB0, 0x66, 0x06, 0xEF, 0x0C, 0x99, 0xC1, 0x03, 0x89, 0x75, 0x43, 0x4B, 0xA3, 0x85,
+    0x3F, 0x60, 0x55, 0xF0, 0x31, 0x90, 0x02, 0x11, 0x04, 0x79, 0x31, 0xEF, 0xE9, 0xF2, 0x3B, 0xE7,
+    0xEA, 0xF9, 0xE9, 0x3D, 0x3B, 0xC1, 0x43, 0x1E, 0xC8, 0xBA, 0x47, 0xF7, 0xE9, 0xDE, 0x73, 0xEE,
+    0xB9, 0xE7, 0xFB, 0xCA, 0x37, 0xEB, 0xD7, 0x5C, 0xE7, 0x3D, 0xB5, 0x12, 0xEA, 0xE8, 0x3B, 0xE4,
+    0x0F, 0xC8, 0x6B, 0x28, 0x1C, 0xD1, 0xD2, 0xBF, 0xD4, 0xF5, 0xE7, 0x86, 0x6A, 0x9A, 0xC3, 0x7D,
+    0x93, 0xE8, 0x11, 0xD1, 0x0A, 0xDD, 0xD9, 0x53, 0xD6, 0xEA, 0x7A, 0x89, 0xEA, 0x7B, 0x54, 0x3F,
+    0x98, 0x03, 0xE1, 0x07, 0x44, 0x9E, 0xA2, 0x50, 0xD3, 0x12, 0xD1, 0xF6, 0xAE, 0x2A, 0xAC, 0x59,
+    0x09, 0x4C, 0x74, 0xC3, 0xF8, 0x1F, 0x1B, 0x0A, 0xDE, 0xFC, 0xD6, 0xCB, 0xBB, 0x0F, 0x33, 0x3B,
+    0xC0, 0x4D, 0x44, 0xFD, 0x7E, 0x6E, 0xAD, 0x6D, 0x0A, 0x06, 0x8B, 0x9B, 0x9B, 0x9B, 0xD8, 0xDE,
+    0xF8, 0xCA, 0x6C, 0x77, 0x0D, 0x26, 0xBD, 0xC9, 0xE8, 0xD5, 0xB3, 0xB4, 0x15, 0xAB, 0xFF, 0xE7,
+    0x7D, 0xC4, 0x94, 0x16, 0x30, 0x61, 0x65, 0x79, 0x77, 0x77, 0x57, 0xC9, 0x3B, 0xE9, 0xD1, 0x15,
+    0xBF, 0x8E, 0xF5, 0x0A, 0x6D, 0xD1, 0x63, 0xB2, 0x64, 0x8D, 0x2D, 0x73, 0x73, 0x51, 0x45, 0x3A,
+    0xAB, 0xB3, 0x3A, 0x6D, 0xC2, 0xDA, 0xAB, 0xBD, 0x2A, 0x30, 0x89, 0x1A, 0xD2, 0x0E, 0x5D, 0x54,
+    0x39, 0xC6, 0x31, 0x07, 0x73, 0xB7, 0xA0, 0xD5, 0x58, 0xFB, 0x35, 0x5D, 0x89, 0x74, 0xA2, 0xB2,
+    0x3A, 0x2F, 0xB3, 0xBA, 0xA8, 0xD2, 0x26, 0xAB, 0xC3, 0x3A, 0xAE, 0xBC, 0x3A, 0x28, 0x19, 0x2F,
+    0x30, 0x21, 0x46, 0x57, 0x69, 0xE8, 0x0D, 0x68, 0x07, 0x0A, 0xBB, 0x88, 0x3E, 0x68, 0x68, 0xFB,
+    0x39, 0xA8, 0x3C, 0xC5, 0xD3, 0x1B, 0x81, 0x56, 0x03, 0x6A, 0x0D, 0xE8, 0xAD, 0x81, 0x62, 0xA2,
+    0xFC, 0x3A, 0xAC, 0xE8, 0x0A, 0x7D, 0x97, 0xDE, 0x02, 0xD7, 0x89, 0x21, 0x8A, 0xFB, 0x0D, 0xEF,
+    0x22, 0x6E, 0x8A, 0x6E, 0x86, 0xEA, 0x5C, 0x61, 0x0B, 0xD6, 0x46, 0x73, 0x2B, 0x52, 0xEF, 0xCB,
+    0x38, 0xCF, 0x4F, 0x4B, 0xB4, 0x0A, 0xFD, 0xF2, 0x04, 0xFC, 0x8E, 0x46, 0x8F, 0xCE, 0x51, 0x0B,
+    0xB9, 0xD1, 0x74, 0xE3, 0x8B, 0xF9, 0x38, 0xC6, 0x83, 0x22, 0x15, 0x61, 0xFD, 0x67, 0x7B, 0xB2,
+    0xFE, 0x27, 0xD1, 0x37, 0xA7, 0xD7, 0xE7, 0x3E, 0xD3, 0x67, 0x1A, 0x41, 0xD7, 0x98, 0x3E, 0xE3,
+    0x0A, 0x5F, 0xE5, 0x11, 0xAD, 0x83, 0x6F, 0xBF, 0x2B, 0x34, 0xF8, 0xE9, 0x78, 0xE9, 0xF8, 0x1B,
+    0xAF, 0xC7, 0x34, 0x71, 0x79, 0xBF, 0xA4, 0xD8, 0x96, 0xA9, 0xAD, 0x33, 0xDB, 0x38, 0x7B, 0x74,
+    0x37, 0xDE, 0xC4, 0xB6, 0xF2, 0xAD, 0xEA, 0xD8, 0xFD, 0x06, 0x2B, 0x1E, 0x3F, 0xB2, 0x86, 0x0D,
+    0x40, 0xA1, 0x35, 0x6C, 0x08, 0xD0, 0xF9, 0x08, 0xCF, 0x92, 0xB2, 0x11, 0xDE, 0x63, 0xF9, 0x75,
+    0xCC, 0x3B, 0x87, 0x96, 0x42, 0x23, 0x05, 0xFE, 0x18, 0x27, 0x25, 0xDA, 0x2F, 0x4C, 0xD0, 0xA2,
+    0x59, 0x7E, 0x66, 0xCA, 0x1B, 0x32, 0xCD, 0xD5, 0xDE, 0x9C, 0x3B, 0xBB, 0xDA, 0x5A, 0x33, 0x97,
+    0xF0, 0xE0, 0xEE, 0xCF, 0x88, 0x60, 0x88, 0xA0, 0x39, 0x0F, 0xCF, 0x9D, 0xB8, 0x70, 0x0E, 0x53,
+    0x3E, 0xE9, 0x9E, 0x0B, 0xD3, 0xA0, 0xF3, 0xBD, 0x5D, 0xFD, 0x01, 0xD1, 0xD1, 0xFD, 0xE1, 0xA6,
+    0x9A, 0x23, 0xF1, 0xE5, 0x5D, 0x68, 0x68, 0x72, 0x2F, 0x6E, 0xCE, 0x8D, 0xF3, 0xFE, 0xE5, 0xD9,
+    0x8A, 0xA3, 0xB3, 0x5C, 0xE1, 0x3F, 0xA1, 0xE9, 0x2D, 0xD7, 0x8F, 0xCD, 0x36, 0x51, 0x17, 0xBE,
+    0x52, 0x9D, 0x91, 0xD7, 0xA1, 0x65, 0x2A, 0xD5, 0x41, 0xD5, 0xF5, 0x29, 0x35, 0xA1, 0x19, 0xF7,
+    0x13, 0x13, 0x77, 0x31, 0x26, 0x47, 0x3F, 0xA1, 0x49, 0x7F, 0xA3, 0xD7, 0xDF, 0xA2, 0x09, 0xEE,
+    0x80, 0x60, 0x4B, 0x9E, 0xD0, 0xFC, 0x41, 0x9D, 0xB4, 0x44, 0xC5, 0x80, 0xD7, 0xBA, 0x51, 0x1D,
+    0xDC, 0x36, 0xFE, 0xCB, 0x02, 0x3C, 0x64, 0xA1, 0x19, 0x86, 0x55, 0x58, 0xA5, 0x3A, 0xAA, 0x86,
+    0xF1, 0x47, 0x4D, 0x50, 0xC7, 0x65, 0x6C, 0x7C, 0xDB, 0x24, 0x41, 0xE3, 0x37, 0xB1, 0x89, 0x4B,
+    0x5A, 0x54, 0x1B, 0x41, 0xED, 0x0F, 0xB0, 0x3A, 0x73, 0xB5, 0x15, 0xD6, 0xFE, 0x30, 0x35, 0x11,
+    0xF7, 0x07, 0x93, 0xBE, 0x57, 0x4F, 0xFA, 0x41, 0x35, 0xE9, 0x87, 0x66, 0x82, 0x1B, 0x6B, 0xF4,
+    0x1D, 0x4D, 0x4A, 0xC8, 0xEF, 0xD6, 0x22, 0x02, 0xF7, 0xC2, 0x43, 0xA2, 0x45, 0x38, 0x07, 0x89,
+    0x09, 0x06, 0x39, 0x89, 0x70, 0x52, 0x2B, 0x3C, 0x3B, 0x41, 0x22, 0x13, 0x2C, 0x28, 0x9A, 0xBD,
+    0xFA, 0xF2, 0x9D, 0x95, 0xF1, 0xAC, 0x9C, 0x67, 0x65, 0x3D, 0x2B, 0xEF, 0x59, 0x99, 0xCF, 0xCA,
+    0x7D, 0x56, 0xF6, 0xB3, 0xF2, 0x9F, 0xD5, 0xC1, 0xAC, 0x1E, 0xE8, 0xCC, 0xB4, 0x2E, 0x7C, 0xD8,
+    0x5B, 0xAA, 0x7A, 0xFA, 0xF8, 0xE3, 0x60, 0x4A, 0x27, 0xA9, 0x7E, 0x42, 0x7D, 0xBD, 0x64, 0xA0,
+    0xDE, 0xD7, 0x4D, 0x0E, 0xEA, 0x7D, 0xFD, 0x1C, 0x48, 0x50, 0x9A, 0xE8, 0xA8, 0xFB, 0x7D, 0xA4,
+    0xA7, 0x96, 0x32, 0xDD, 0xD7, 0x95, 0xFB, 0x3D, 0xD1, 0x97, 0x9B, 0x3F, 0xD1, 0x99, 0xFB, 0x3D,
+    0xD1, 0x9B, 0xAC, 0xD7, 0xD3, 0x1D, 0xF3, 0xD3, 0xD7, 0x5F, 0xAA, 0x9E, 0xD0, 0x91, 0x0E, 0x9B,
+    0x9C, 0xE2, 0xDF, 0x0E, 0xA6, 0xF4, 0xE8, 0xDB, 0x6A, 0x5A, 0x97, 0x8B, 0x88, 0xC4, 0x48, 0x65,
+    0x71, 0x09, 0x99, 0xAA, 0x14, 0x94, 0xD6, 0xE8, 0x3A, 0xF1, 0xBB, 0x14, 0xAB, 0x67, 0x58, 0x31,
+    0x53, 0x09, 0x56, 0x49, 0xD4, 0x7D, 0x84, 0xCD, 0xC7, 0x18, 0x1F, 0x60, 0x46, 0x8D, 0x39, 0x8E,
+    0x0E, 0xCF, 0x83, 0xD4, 0x30, 0xD3, 0x12, 0xCF, 0x1D, 0x11, 0xCF, 0x1E, 0xF2, 0x7C, 0x24, 0x43,
+    0x60, 0x20, 0x77, 0x02, 0xC7, 0xAF, 0x18, 0x0B, 0x01, 0x0B, 0x78, 0xC1, 0x58, 0xB5, 0x99, 0x4E,
+    0x0D, 0xF6, 0x58, 0x86, 0x65, 0x50, 0x61, 0x5A, 0xCD, 0x21, 0x32, 0xD3, 0x2D, 0x31, 0x45, 0xA6,
+    0xC2, 0xF4, 0xC2, 0x32, 0x81, 0x6D, 0x70, 0x0A, 0x86, 0x45, 0x30, 0x81, 0xCF, 0xFC, 0xD2, 0xE1,
+    0xB6, 0x28, 0xE5, 0x30, 0xD3, 0x1F, 0x76, 0x2B, 0xF2, 0xEC, 0x27, 0xC4, 0xF3, 0xB7, 0x89, 0x31,
+    0x32, 0x62, 0x1C, 0xD8, 0x09, 0xB0, 0x62, 0x62, 0xBC, 0x68, 0x6C, 0xBA, 0x5F, 0x92, 0x58, 0x4F,
+    0x22, 0xCA, 0x02, 0xE2, 0x7F, 0x61, 0xC8, 0xFF, 0x7B, 0x45, 0xC1, 0xE7, 0x35, 0x24, 0xDF, 0x10,
+    0x2A, 0x0B, 0x48, 0x78, 0x1D, 0x7F, 0xCE, 0xCA, 0x96, 0x58, 0xA0, 0xD8, 0x4D, 0x50, 0x63, 0xA3,
+    0x94, 0x19, 0x2A, 0x14, 0xE5, 0x1A, 0x8B, 0xF3, 0x4F, 0xBC, 0x64, 0xF1, 0xAE, 0xB3, 0x52, 0x90,
+    0x67, 0xD6, 0x24, 0xBB, 0xC0, 0x5A, 0xE1, 0x7A, 0x01, 0x6A, 0x4D, 0x64, 0x21, 0xCB, 0x37, 0xD8,
+    0x0C, 0x90, 0xF7, 0x4A, 0x1E, 0x5A, 0x1D, 0x7B, 0xC7, 0x23, 0xE1, 0xC5, 0xC7, 0x1C, 0x70, 0x1B,
+    0x8C, 0xC0, 0x76, 0x62, 0xF0, 0x2B, 0x36, 0x61, 0x8D, 0x31, 0x38, 0x09, 0x67, 0xA5, 0x21, 0x1B,
+    0xB4, 0x2C, 0x03, 0xEF, 0x64, 0x67, 0x45, 0xDD, 0xC0, 0x8C, 0x83, 0x21, 0x49, 0x5A, 0xDB, 0x3C,
+    0x74, 0x81, 0x92, 0x1F, 0x1B, 0x7F, 0x27, 0x57, 0xA1, 0x85, 0x4A, 0x0A, 0x0D, 0xCC, 0xB8, 0x29,
+    0x54, 0x00, 0xA5, 0x34, 0xAB, 0x14, 0x7F, 0x61, 0xD8, 0xBF, 0xB2, 0x50, 0x9C, 0x6E, 0x28, 0x64,
+    0x81, 0x95, 0x8B, 0x6F, 0x4A, 0xE2, 0x05, 0x41, 0x1E, 0xC4, 0x00, 0x06, 0x31, 0xF4, 0x3E, 0x06,
+    0x11, 0x84, 0x9C, 0x6C, 0xC1, 0x59, 0x58, 0x5D, 0x66, 0x3E, 0x3D, 0xE3, 0x8C, 0x09, 0xC9, 0x3F,
+    0xA9, 0xB2, 0x32, 0xA9, 0xA5, 0xC1, 0x50, 0xD2, 0xE9, 0x56, 0x26, 0xFD, 0xA6, 0x61, 0xB8, 0x3A,
+    0x9A, 0x34, 0xC5, 0x2D, 0x3C, 0x6A, 0x0B, 0x5C, 0xE3, 0x76, 0x57, 0xA4, 0x51, 0x93, 0x31, 0xCD,
+    0x2A, 0x95, 0x96, 0xBA, 0x90, 0xD7, 0x99, 0x6C, 0x81, 0x3C, 0x1F, 0xA1, 0x16, 0xA2, 0xAC, 0xF2,
+    0x5A, 0xE4, 0x6A, 0xCA, 0x15, 0xF6, 0x90, 0xC1, 0x5D, 0x9B, 0xD4, 0xBC, 0x15, 0x36, 0x28, 0x37,
+    0xC2, 0x1A, 0x75, 0x49, 0x00, 0x3C, 0x80, 0x8C, 0x01, 0x74, 0x15, 0xFC, 0x0D, 0xBE, 0x1E, 0xBC,
+    0x00, 0xDF, 0x01, 0xBC, 0x9D, 0xB7, 0xC3, 0x1E, 0x07, 0xE0, 0x4F, 0x03, 0x6F, 0x3A, 0xB4, 0xC9,
+    0xBB, 0x88, 0x77, 0x1B, 0x0F, 0xC7, 0x20, 0x6C, 0x7A, 0xF5, 0xE5, 0x43, 0xAE, 0x2F, 0x1B, 0xEE,
+    0x3D, 0x18, 0xE3, 0xAC, 0x09, 0x14, 0x83, 0x63, 0x14, 0x98, 0x23, 0x3F, 0xEF, 0x13, 0xD8, 0x65,
+    0x5F, 0x81, 0xE0, 0xDA, 0x4F, 0x7E, 0xCA, 0x75, 0xAA, 0x3F, 0xAE, 0x9C, 0xCF, 0xEE, 0x7D, 0x2A,
+    0x73, 0x2F, 0xDA, 0x43, 0x5E, 0x3E, 0xC4, 0x7B, 0xE6, 0x2F, 0x3B, 0xDC, 0x7C, 0x0F, 0xA5, 0x02,
+    0xDB, 0x0F, 0x2F, 0xEA, 0xC2, 0xE1, 0x3A, 0x9B, 0x22, 0x13, 0x52, 0xD7, 0x1C, 0x87, 0xBA, 0x33,
+    0x64, 0xA9, 0x72, 0xE0, 0x9D, 0xB8, 0x98, 0x41, 0x9F, 0xF5, 0x1C, 0xF0, 0xD2, 0x11, 0xE3, 0x49,
+    0x99, 0x9C, 0xBE, 0x6A, 0x1A, 0x83, 0xA8, 0x19, 0x6F, 0x30, 0xE5, 0x29, 0xEB, 0x6C, 0xF7, 0x8F,
+    0x19, 0xAD, 0x01, 0x01, 0x1F, 0x55, 0x2E, 0xA8, 0x61, 0x36, 0x7E, 0xB0, 0x77, 0x80, 0x42, 0x4A,
+    0xE2, 0x1F, 0x12, 0x12, 0x1C, 0x7D, 0x6F, 0x2C, 0x03, 0xBF, 0x9E, 0xE9, 0x7C, 0xC5, 0xAB, 0xBF,
+    0x2C, 0x9D, 0xC4, 0x54, 0xB9, 0x73, 0xFC, 0xC1, 0x9F, 0x5C, 0x1D, 0x07, 0x29, 0xFC, 0xBE, 0x53,
+    0xFC, 0xA8, 0xC3, 0x2A, 0xEC, 0x8E, 0x4B, 0x12, 0xA3, 0x67, 0xD6, 0x75, 0xAA, 0xCA, 0x75, 0xBE,
+    0xEA, 0xD5, 0x4B, 0x9D, 0x21, 0xCC, 0x2C, 0xB1, 0xA0, 0xFC, 0x86, 0x6E, 0x31, 0x95, 0xD2, 0x39,
+    0x8C, 0xDB, 0x37, 0x58, 0xBB, 0x1A, 0x9A, 0xAB, 0x3E, 0x6D, 0xF9, 0x6A, 0x3B, 0x78, 0x8A, 0x08,
+    0x79, 0x2F, 0x31, 0xC5, 0xEF, 0x7E, 0x34, 0x8A, 0x47, 0xD7, 0x0B, 0x73, 0x09, 0x6B, 0x7B, 0x45,
+    0xD1, 0x2A, 0xBA, 0x8B, 0xDD, 0x9F, 0x05, 0x43, 0x5E, 0x01, 0x26, 0x2E, 0xC1, 0x44, 0xEE, 0xBE,
+    0xD8, 0x1B, 0x9C, 0xB5, 0xDF, 0xB7, 0xBA, 0xF8, 0xF8, 0x87, 0xC3, 0x68, 0x70, 0x3D, 0x37, 0xEB,
+    0xA1, 0xD9, 0x0F, 0xCA, 0x7B, 0x91, 0x3E, 0x07, 0x4D, 0x78, 0x22, 0xC2, 0xF1, 0x12, 0xC4, 0xC9,
+    0x94, 0x80, 0xB9, 0xB8, 0x79, 0xAB, 0x5F, 0xB0, 0xE2, 0x5E, 0xDE, 0xFD, 0x89, 0x0B, 0x1F, 0x6F,
+    0xA4, 0xA0, 0x79, 0x4C, 0x5B, 0xDE, 0x45, 0xA1, 0x68, 0xF2, 0x92, 0xE3, 0x56, 0xAE, 0x4E, 0x71,
+    0xFF, 0x05, 0x65, 0x9E, 0x3E, 0xD5, 0x4C, 0x2D, 0x8E, 0x68, 0x4D, 0x66, 0xCD, 0x1D, 0x39, 0xA2,
+    0x7A, 0xB0, 0xDB, 0xEC, 0x54, 0xF7, 0x72, 0xC1, 0x58, 0xA7, 0x9C, 0x4C, 0x85, 0xE1, 0x2D, 0xF4,
+    0x0E, 0x79, 0xBE, 0x7D, 0xC9, 0x79, 0x6D, 0x07, 0x4E, 0xC5, 0xAB, 0xFE, 0x75, 0x08, 0x4E, 0xA2,
+    0x3A, 0x1C, 0x52, 0x81, 0xBF, 0x60, 0x00, 0x77, 0xCB, 0xF4, 0x01, 0x02, 0x1A, 0x42, 0x71, 0x62,
+    0xE0, 0x83, 0x23, 0x78, 0x63, 0x52, 0x9E, 0x61, 0xA7, 0x52, 0x72, 0x34, 0x11, 0xEF, 0xE2, 0x8E,
+    0x2F, 0xA6, 0x0F, 0xE1, 0x05, 0xDC, 0xC9, 0x4C, 0xE7, 0x11, 0x88, 0x1D, 0x94, 0x70, 0x69, 0xD5,
+    0x76, 0x89, 0x82, 0xA3, 0x81, 0x58, 0x6A, 0xCE, 0x07, 0x1B, 0x8E, 0x0F, 0xAD, 0xB8, 0x79, 0xA7,
+    0x08, 0xE9, 0xD4, 0x27, 0x76, 0x16, 0xB8, 0x73, 0x93, 0x4E, 0xBA, 0x12, 0xAE, 0x4C, 0x9A, 0x6E,
+    0x5D, 0x61, 0x80, 0xA9, 0x87, 0xA3, 0x7E, 0xE7, 0x68, 0x68, 0xFA, 0x62, 0x09, 0x78, 0x2D, 0x6F,
+    0xDF, 0x6F, 0x79, 0xEF, 0x5E, 0xCB, 0x1B, 0xF7, 0x5A, 0xDE, 0xB5, 0x37, 0xE2, 0x2D, 0x7B, 0x23,
+    0xD9, 0xEF, 0x88, 0x3A, 0x88, 0x9D, 0x0E, 0x85, 0xD4, 0x50, 0xF6, 0x38, 0x94, 0x0D, 0x0E, 0x65,
+    0x77, 0x43, 0xD9, 0xDA, 0x50, 0xF6, 0xF5, 0x58, 0x38, 0xEF, 0xC3, 0x7D, 0x81, 0xF7, 0x64, 0x23,
+    0xE7, 0x8F, 0xF1, 0xBF, 0xCF, 0x1C, 0xFA, 0x2D, 0x33, 0x8C, 0x9C, 0x03, 0xE8, 0x5B, 0x7E, 0xE3,
+    0x39, 0xAF, 0x3E, 0x37, 0x2E, 0xFC, 0x4A, 0xAF, 0x68, 0xF9, 0x58, 0x16, 0xB7, 0x05, 0x92, 0x58,
+    0x99, 0x56, 0x48, 0x91, 0x08, 0xDF, 0x1A, 0x9C, 0xA5, 0x7C, 0xEA, 0xE2, 0xDC, 0x0F, 0xCB, 0x2D,
+    0xF0, 0x58, 0x70, 0x0F, 0x16, 0xBC, 0x3B, 0x1A, 0x5A, 0x79, 0x40, 0x15, 0x89, 0x93, 0x05, 0xD7,
+    0xAA, 0x71, 0x23, 0x47, 0xC8, 0x4C, 0xD2, 0x2A, 0x96, 0xE4, 0x07, 0x87, 0x68, 0xB8, 0x00, 0x47,
+    0xCC, 0x13, 0x1F, 0x0B, 0xC7, 0x02, 0xBD, 0xE4, 0x1D, 0x39, 0x8F, 0x82, 0x50, 0x02, 0x6D, 0x65,
+    0x15, 0xA5, 0x93, 0x07, 0xE7, 0xF9, 0x72, 0x7A, 0xFA, 0x86, 0xF2, 0xDE, 0x33, 0x1C, 0xFD, 0x1D,
+    0x88, 0x18, 0xD0, 0xE6, 0x2D, 0x29, 0x52, 0xC5, 0xFD, 0xA4, 0x70, 0x48, 0xA9, 0xAB, 0x31, 0x68,
+    0xE3, 0xC8, 0x1B, 0xB7, 0x8E, 0x5C, 0x72, 0x30, 0x06, 0xA2, 0x7B, 0x09, 0x69, 0xCE, 0x91, 0xAB,
+    0xB1, 0x37, 0x87, 0x13, 0x97, 0x16, 0x70, 0x02, 0xF5, 0x65, 0xC9, 0x44, 0x9F, 0x2A, 0xF7, 0xC5,
+    0x86, 0xC2, 0x97, 0xB7, 0x39, 0x7B, 0x34, 0xB1, 0xB5, 0x0E, 0x2A, 0x81, 0xFA, 0x15, 0x50, 0xF5,
+    0x66, 0x0A, 0x74, 0xB8, 0x0D, 0xC3, 0x5D, 0x8E, 0xFE, 0xCE, 0xB2, 0xE7, 0x0C, 0xC5, 0xDC, 0x79,
+    0x33, 0x97, 0x9A, 0xF8, 0x0F, 0xB0, 0x71, 0xAC, 0x78, 0x24, 0x58, 0xFE, 0xDC, 0xC4, 0x29, 0xD0,
+    0xC6, 0xF6, 0x70, 0xAF, 0xC2, 0x99, 0x1E, 0x75, 0x1C, 0x00, 0x82, 0xD1, 0x2B, 0x80, 0x8C, 0xA6,
+    0x96, 0x6B, 0x63, 0x60, 0x1D, 0x7A, 0x8C, 0xCB, 0x44, 0x44, 0x20, 0x55, 0x78, 0xB8, 0x87, 0x2C,
+    0x8B, 0x05, 0x86, 0x0C, 0x5A, 0xB7, 0xD1, 0xE3, 0x40, 0x06, 0x46, 0x1E, 0xCF, 0xBB, 0xCB, 0x72,
+    0xCC, 0xE5, 0x5B, 0x92, 0xBF, 0xE3, 0x94, 0x81, 0x76, 0x39, 0x28, 0x2F, 0x67, 0x1F, 0x99, 0x51,
+    0xFE, 0xFC, 0x37, 0xF6, 0x2C, 0xE7, 0xAC, 0x64, 0xC0, 0xD5, 0x88, 0xCE, 0x0E, 0xBF, 0x68, 0xB3,
+    0x5F, 0x3F, 0x6D, 0x57, 0x82, 0xF2, 0xEB, 0xA2, 0xB3, 0x6E, 0xBE, 0xC7, 0x75, 0x53, 0xC5, 0x7F,
+    0x91, 0x3E, 0xC9, 0xE5, 0x23, 0x8D, 0xF2, 0x86, 0xFF, 0xF4, 0x3A, 0xF2, 0x77, 0xCC, 0xA8, 0x43,
+    0x7A, 0xBB, 0x57, 0xE7, 0x70, 0x0E, 0x4C, 0x5C, 0x25, 0x50, 0x48, 0x80, 0x45, 0xB1, 0xCB, 0x15,
+    0x5A, 0x97, 0xE0, 0xD8, 0xE5, 0x60, 0x54, 0x62, 0x51, 0xB1, 0xA2, 0xFF, 0xDD, 0xB5, 0xE2, 0xCA,
+    0x8D, 0xD4, 0x19, 0x5C, 0xEC, 0x52, 0x1E, 0x0A, 0x59, 0x69, 0x48, 0x9D, 0xF2, 0x11, 0xAA, 0xDD,
+    0x6B, 0x5D, 0x2E, 0x97, 0x52, 0xCD, 0xBB, 0x25, 0x91, 0xE9, 0xBF, 0x17, 0x1E, 0xBD, 0x21, 0x7E,
+    0x58, 0x2E, 0xC5, 0xF5, 0x6A, 0x5C, 0xAF, 0xC5, 0xF5, 0x96, 0xAF, 0x1F, 0x71, 0xFC, 0x85, 0x77,
+    0x71, 0x0D, 0x63, 0xF8, 0x53, 0x2A, 0xE4, 0x15, 0x4B, 0xD5, 0xB4, 0x2E, 0xE5, 0xDA, 0x3E, 0x87,
+    0x6E, 0x8C, 0xA3, 0xDA, 0xE3, 0x71, 0xC3, 0x71, 0x20, 0x26, 0x95, 0x84, 0xF5, 0x4A, 0x34, 0x58,
+    0x8B, 0x9A, 0x2D, 0x29, 0x9A, 0xFD, 0x07, 0x74, 0x56, 0xC7, 0x2D, 0x06, 0xB3, 0xC2, 0x44, 0x1A,
+    0x2F, 0x63, 0xDA, 0xF7, 0xDA, 0x1C, 0xB8, 0x19, 0x6C, 0x8B, 0xA2, 0xDE, 0xF1, 0x15, 0x25, 0x44,
+    0xDB, 0x2F, 0xE5, 0xF2, 0x3F, 0xDF, 0x7C, 0xB7, 0x40, 0x44, 0x7C, 0xC9, 0xD5, 0x5E, 0xE3, 0x1C,
+    0xFA, 0xC4, 0x52, 0xEE, 0x61, 0x97, 0x47, 0x3C, 0xD3, 0x5C, 0x43, 0xC5, 0x5D, 0xE3, 0x1C, 0xD3,
+    0xD4, 0xA0, 0xF0, 0xF8, 0xE7, 0x5C, 0xFC, 0xFF, 0x4A, 0xD3, 0x3B, 0xDF, 0x1A, 0x7D, 0x6D, 0x87,
+    0x23, 0x4E, 0x99, 0x3D, 0x6B, 0xF7, 0x4A, 0xD4, 0xC2, 0x6C, 0x06, 0xBF, 0x28, 0x71, 0x16, 0x78,
+    0x3E, 0x80, 0x79, 0xD4, 0x88, 0xFE, 0xA6, 0xC1, 0xA6, 0x54, 0xE3, 0x0E, 0x08, 0xE4, 0x0E, 0xBC,
+    0x24, 0x87, 0x4C, 0x24, 0xD0, 0x31, 0xC8, 0xCD, 0xB8, 0x70, 0xEC, 0xAE, 0x0B, 0xD4, 0xA5, 0x3B,
+    0x92, 0xFC, 0x2A, 0x40, 0x7E, 0x5E, 0x38, 0x66, 0x12, 0x82, 0x36, 0x21, 0x25, 0x20, 0x53, 0xDD,
+    0x61, 0x30, 0xBF, 0x31, 0xE0, 0x92, 0xBD, 0x08, 0x9B, 0x4C, 0xC7, 0x65, 0x1B, 0xD6, 0x7C, 0x76,
+    0x1F, 0x46, 0x38, 0xB6, 0x26, 0x6A, 0x10, 0x9B, 0x27, 0x94, 0xB2, 0xEB, 0xE3, 0x18, 0xE9, 0x43,
+    0x80, 0x0D, 0xAD, 0xF9, 0xE5, 0x12, 0x1F, 0x26, 0x03, 0xB3, 0xE2, 0xF5, 0x24, 0x78, 0xC6, 0x55,
+    0x82, 0x02, 0x5D, 0xBE, 0xEF, 0xA0, 0xA2, 0x19, 0xBE, 0xC7, 0xBC, 0xBF, 0x2D, 0xDC, 0x5A, 0xC5,
+    0xF3, 0xAC, 0x76, 0xD0, 0xBD, 0x71, 0xA3, 0x27, 0x6C, 0xA1, 0xA3, 0xD6, 0xA7, 0x9F, 0x4F, 0x71,
+    0x70, 0x86, 0xCB, 0x1B, 0x70, 0xD1, 0xA7, 0x29, 0x50, 0xAD, 0xD2, 0xD4, 0xF7, 0x8E, 0x89, 0x04,
+    0x9D, 0xCC, 0xA6, 0x68, 0xBA, 0x37, 0x17, 0x4E, 0xE0, 0x60, 0xD5, 0x51, 0x9E, 0xE2, 0xD9, 0xAD,
+    0x38, 0xF9, 0x90, 0x81, 0xF7, 0xC6, 0xEA, 0x8D, 0x53, 0x78, 0xEA, 0x3B, 0x08, 0x14, 0x4C, 0x25,
+    0x57, 0x67, 0x7A, 0xF8, 0xC7, 0x24, 0x28, 0x70, 0xFB, 0x94, 0xDE, 0xBF, 0x21, 0x73, 0x3B, 0x2E,
+    0xCD, 0x64, 0xFF, 0xF9, 0x94, 0xAC, 0x5E, 0x7F, 0xFD, 0x67, 0x59, 0xBB, 0x6B, 0x1B, 0xCE, 0x78,
+    0x80, 0x24, 0xBF, 0xC6, 0xDF, 0xE7, 0x15, 0xC3, 0x42, 0xFA, 0xE7, 0x01, 0xCF, 0x1F, 0x9D, 0xAC,
+    0xFA, 0x90, 0xA3, 0x9F, 0xFC, 0x07, 0xA2, 0x83, 0x27, 0xCD, 0x59, 0x13, 0xED, 0xAF, 0xD1, 0xB5,
+    0x8E, 0x9A, 0xA3, 0xEC, 0x56, 0xE1, 0x15, 0xEF, 0xBF, 0x52, 0xCA, 0x1B, 0xDD, 0xDB, 0xFC, 0x35,
+    0x52, 0x9E, 0xC6, 0x1C, 0x8F, 0x15, 0x9D, 0x06, 0xC6, 0xA3, 0xAB, 0xC7, 0x30, 0xF9, 0xCB, 0xE7,
+    0xA1, 0xEE, 0x7F, 0xAE, 0x5C, 0xFC, 0x87, 0x9A, 0xEB, 0x37, 0xDB, 0xF2, 0x03, 0x9A, 0xDC, 0x1F,
+    0xCE, 0xEF, 0xB3, 0x2A, 0xCA, 0xF5, 0xD4, 0x6A, 0x24, 0xEC, 0xA8, 0xE5, 0x1A, 0x8C, 0xB3, 0xD2,
+    0x1C, 0x3F, 0x91, 0x4B, 0xAD, 0x8C, 0x72, 0x08, 0x94, 0x51, 0xF5, 0x62, 0x95, 0x94, 0xFF, 0xAF,
+    0x33, 0xB7, 0x7F, 0xD2, 0x81, 0xDB, 0xE8, 0x67, 0xB4, 0x12, 0xEA, 0x35, 0x1C, 0xD0, 0x6F, 0x4B,
+    0x3D, 0x3D, 0x27, 0xCE, 0xF3, 0x8A, 0x96, 0xA7, 0xDF, 0xCC, 0x51, 0xA1, 0xFF, 0x06, 0xED, 0x56,
     0xBF, 0x8F, 0xE3, 0x44, 0x18, 0x7D, 0xB6, 0x51, 0x46, 0x5A, 0x0B, 0xB9, 0x21, 0xCD, 0xC1, 0xE1,
     0x16, 0x2D, 0xBB, 0x19, 0x8A, 0x2B, 0x28, 0x72, 0xF1, 0xDC, 0xFD, 0x05, 0x14, 0x67, 0x28, 0xA9,
     0x49, 0x13, 0x4A, 0x84, 0x72, 0x6B, 0x43, 0x43, 0x9B, 0x8A, 0xE6, 0x0A, 0x52, 0xA4, 0xC8, 0xF9,
@@ -2746,47 +2768,30 @@ static const uint8_t notoserif_18_regularBitmaps[44439] = {
     0xC3, 0xED, 0x66, 0x69, 0xC8, 0x88, 0x43, 0x60, 0x7D, 0xC3, 0xDA, 0x43, 0x21, 0xFB, 0x1C, 0xB0,
     0x6F, 0x97, 0x5F, 0x7B, 0xC3, 0x91, 0x4C, 0xBC, 0x14, 0x71, 0xB7, 0x49, 0x2E, 0xED, 0x39, 0xFC,
     0x35, 0xFD, 0xD0, 0x73, 0xE0, 0x47, 0x13, 0x59, 0xD0, 0xDF, 0x7F, 0x01, 0xDB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0B, 0xFB, 0xE1, 0x04, 0x03, 0x08, 0x00, 0x00, 0xCD, 0x54, 0x31, 0x6E, 0xDB, 0x40, 0x10,
-    0x1C, 0x91, 0x30, 0x58, 0xB0, 0x50, 0x9A, 0x54, 0x2E, 0xF8, 0x80, 0x04, 0x60, 0x9B, 0xC6, 0x20,
-    0x9F, 0xE0, 0x26, 0xEF, 0xF0, 0x0F, 0x74, 0x7C, 0x82, 0xAB, 0xFC, 0x21, 0x4C, 0xE1, 0xD6, 0x4D,
-    0x72, 0xF7, 0x04, 0x3D, 0x41, 0x85, 0x0D, 0x04, 0x4E, 0xA3, 0xC2, 0x05, 0x23, 0x88, 0x1C, 0xEF,
-    0xEE, 0x1D, 0x63, 0x0B, 0x51, 0xE0, 0xC6, 0x0E, 0x7C, 0xC5, 0xCE, 0x92, 0xBC, 0xDB, 0x9B, 0xDD,
-    0x9D, 0x25, 0xF0, 0xB9, 0x85, 0xBF, 0x01, 0x0A, 0x0E, 0x05, 0x27, 0xA0, 0xFE, 0x32, 0x56, 0xC1,
-    0x03, 0x0E, 0x63, 0xD3, 0x36, 0xC0, 0x88, 0x6B, 0x87, 0x4F, 0x8A, 0x90, 0xB7, 0x58, 0xEC, 0xFF,
-    0x46, 0x0A, 0xD2, 0x56, 0xC0, 0xB7, 0xA9, 0xF7, 0xEC, 0xBB, 0xA3, 0xFB, 0x5E, 0x1B, 0x95, 0x47,
-    0x2E, 0x29, 0xB0, 0x05, 0xAE, 0x78, 0xF3, 0x81, 0x3B, 0xE5, 0xB5, 0x77, 0xD4, 0x17, 0x69, 0x39,
-    0x5E, 0x4A, 0xAE, 0x93, 0x1F, 0x24, 0xD3, 0x50, 0x8C, 0x9A, 0xE7, 0x42, 0xAC, 0x9C, 0xDA, 0x5B,
-    0x8E, 0xE7, 0x16, 0x09, 0x07, 0xD6, 0x52, 0xD3, 0xCC, 0x7A, 0xA6, 0xFB, 0x5E, 0xDE, 0x32, 0x31,
-    0x37, 0xDE, 0x83, 0xB0, 0x6E, 0x28, 0x6C, 0x2E, 0x76, 0x5F, 0xB5, 0x33, 0x72, 0x3B, 0xAA, 0x75,
-    0x41, 0x63, 0x4B, 0x63, 0x4B, 0x63, 0xCB, 0x74, 0xF6, 0xA9, 0xD5, 0x36, 0x18, 0xDB, 0xEE, 0xD8,
-    0xD7, 0x97, 0xB2, 0x4F, 0xD8, 0xFE, 0x9C, 0xD9, 0x3E, 0x2E, 0xD1, 0x54, 0xCD, 0x0D, 0x4C, 0x55,
-    0x19, 0xAF, 0x64, 0xAF, 0xEA, 0xAA, 0xDC, 0x64, 0xDA, 0x22, 0x51, 0x56, 0x15, 0xAC, 0x69, 0xA2,
-    0xAD, 0xA6, 0xC5, 0xCA, 0x3C, 0x79, 0x8D, 0x77, 0x8F, 0xFD, 0x3C, 0xEE, 0x31, 0xAD, 0x2E, 0x76,
-    0xA3, 0xEF, 0xFD, 0x1F, 0xA5, 0x35, 0x6F, 0xC5, 0xA3, 0x79, 0x49, 0x87, 0x2E, 0x44, 0x25, 0xFE,
-    0x2E, 0x45, 0x8C, 0xA6, 0xC5, 0x69, 0xA9, 0xDD, 0xD4, 0x0A, 0x9D, 0x4E, 0xFD, 0x5C, 0x21, 0x53,
-    0xA8, 0x56, 0x68, 0x9B, 0xA9, 0x97, 0x2A, 0xD4, 0xCE, 0x15, 0x6A, 0xDA, 0xB9, 0x42, 0xE2, 0xCD,
-    0xB7, 0x1D, 0xF7, 0x62, 0x7D, 0x36, 0xE2, 0xC5, 0x0A, 0x5D, 0x3E, 0x7B, 0xE2, 0xFF, 0x7B, 0x07,
-    0x15, 0xF2, 0xFF, 0xAA, 0x90, 0x1B, 0xB4, 0xE3, 0x32, 0xAA, 0x9D, 0x40, 0x15, 0xCA, 0x2D, 0x34,
-    0x40, 0x3E, 0x98, 0x82, 0x32, 0x1D, 0xCC, 0x1F, 0x71, 0x3E, 0xA7, 0x19, 0xB2, 0x08, 0x79, 0x84,
-    0x9A, 0x36, 0x29, 0x2E, 0x42, 0x76, 0xB0, 0xE5, 0x35, 0x40, 0x49, 0xA4, 0xE1, 0xBC, 0xE0, 0x1D,
-    0xFC, 0x2F, 0x78, 0xB9, 0xBA, 0x66, 0x94, 0xF0, 0xB9, 0x1A, 0xFD, 0xCF, 0x02, 0xE5, 0xCE, 0xFE,
-    0x47, 0x4D, 0xB7, 0xDC, 0x58, 0x2E, 0xC5, 0xBD, 0xC0, 0x77, 0x58, 0x66, 0x63, 0x84, 0xF4, 0xB4,
-    0x32, 0x38, 0xF1, 0x28, 0x07, 0x09, 0xCD, 0xCE, 0x71, 0x2C, 0x6F, 0x5D, 0x20, 0xC7, 0xBA, 0x5B,
-    0xAE, 0xE5, 0x5B, 0x83, 0x22, 0x41, 0x50, 0x90, 0xB0, 0x0A, 0xC1, 0xA0, 0x1A, 0x0C, 0x4A, 0xAE,
-    0x15, 0x16, 0x8C, 0xA1, 0x6B, 0x76, 0x0A, 0x0B, 0xAE, 0xED, 0x86, 0x6A, 0x6B, 0x50, 0x28, 0x7C,
-    0x44, 0x7E, 0x2F, 0x70, 0x86, 0x5C, 0x9F, 0x56, 0x0A, 0x7B, 0x09, 0x2D, 0x53, 0x3B, 0xA2, 0xBE,
-    0x95, 0x36, 0xF0, 0xAE, 0xD0, 0x31, 0x77, 0x13, 0xDE, 0xB7, 0x9A, 0xD2, 0x03, 0x4D, 0x90, 0xB1,
-    0x0D, 0x83, 0x30, 0x14, 0x44, 0x0F, 0x53, 0x50, 0xD0, 0xA6, 0x77, 0x36, 0x60, 0x04, 0xCA, 0x8C,
-    0x90, 0x55, 0xD2, 0xC1, 0x26, 0x59, 0x24, 0x12, 0x8C, 0x90, 0x11, 0x18, 0x81, 0x22, 0x05, 0x52,
-    0x88, 0x2F, 0x77, 0x36, 0x91, 0xE2, 0xE2, 0xFB, 0xC9, 0x7A, 0xFF, 0xFE, 0x97, 0x81, 0xBF, 0x73,
-    0x3B, 0xEE, 0x2A, 0x1D, 0xD0, 0x70, 0x2C, 0x10, 0xB9, 0x14, 0x18, 0xB8, 0x15, 0x85, 0x4C, 0x87,
-    0xC2, 0x22, 0xC5, 0x27, 0xBA, 0x2C, 0x0D, 0x38, 0xD5, 0x96, 0xAA, 0x0F, 0x12, 0x2C, 0x35, 0x7B,
-    0x45, 0x0C, 0x92, 0x62, 0x0A, 0x44, 0xBF, 0x38, 0xE5, 0x2D, 0xD8, 0x9C, 0x42, 0x41, 0xCA, 0x29,
-    0x09, 0x13, 0xC7, 0x28, 0xD8, 0x41, 0x2E, 0xBD, 0xE0, 0x55, 0x93, 0x5B, 0xE7, 0x01, 0x7A, 0x5E,
-    0x5B, 0x81, 0x1B, 0xE6, 0xA0, 0x52, 0xBB, 0x51, 0x0D, 0xBC, 0xD8, 0x87, 0xA4, 0xBB, 0x14, 0xC0,
-    0x92, 0x14, 0x20, 0x64, 0xF0, 0x3E, 0x53, 0xAA, 0xAD, 0x48, 0xD2, 0x1E, 0xAB, 0xA1, 0xD5, 0x84,
-    0xD9, 0x10, 0xBC, 0x59, 0x3E, 0xD3, 0x75, 0x2F, 0xD0, 0x15, 0xC5, 0x49, 0x73, 0x81, 0xC0, 0xDF,
-    0xFF, 0x3C, 0x7E, 0x70, 0x76, 0xF9, 0x02,
+    0xFF, 0x0B, 0xFB, 0xE1, 0x04, 0x03, 0x08, 0x00, 0x00, 0xB5, 0xD1, 0xB1, 0x0D, 0x83, 0x30, 0x10,
+    0x05, 0xD0, 0x6F, 0x50, 0xE4, 0xC2, 0x05, 0x55, 0x6A, 0x16, 0x88, 0xE4, 0x09, 0x22, 0x18, 0x21,
+    0x9B, 0x64, 0x03, 0xEC, 0xC5, 0x12, 0x33, 0x02, 0x23, 0x50, 0x84, 0x86, 0x34, 0x29, 0x28, 0x50,
+    0x04, 0x5C, 0xEE, 0x6C, 0x52, 0x64, 0x80, 0x50, 0xF0, 0xB0, 0x8D, 0xFE, 0xF1, 0x05, 0xE0, 0x66,
+    0xF0, 0xA5, 0xB7, 0xE0, 0x99, 0xB2, 0x35, 0x2F, 0xA6, 0xAA, 0x73, 0xD9, 0x75, 0xC8, 0x16, 0xE6,
+    0x0E, 0x25, 0x6C, 0x5F, 0xB2, 0x44, 0x9E, 0xB0, 0x44, 0x82, 0x4B, 0x64, 0x3F, 0xAF, 0xFC, 0x03,
+    0xF9, 0x08, 0x15, 0x67, 0xE1, 0x4A, 0x23, 0xC2, 0x13, 0x81, 0x47, 0x5B, 0x92, 0x16, 0x50, 0x17,
+    0xB9, 0x85, 0x87, 0x3C, 0x9B, 0x37, 0xD5, 0xD2, 0xC5, 0x17, 0x7D, 0xEC, 0xA2, 0x27, 0xE6, 0x86,
+    0xD8, 0x6C, 0x4D, 0xEC, 0xAB, 0x26, 0x72, 0x08, 0x30, 0x33, 0x47, 0x93, 0x77, 0xB4, 0x9A, 0xC1,
+    0xB5, 0x44, 0xAB, 0xF5, 0x45, 0xC7, 0x67, 0x15, 0xF4, 0x4E, 0x2B, 0x70, 0xAC, 0xD0, 0x46, 0xCA,
+    0x39, 0x62, 0xA8, 0x13, 0x14, 0xA5, 0x68, 0x4B, 0x5E, 0x50, 0xD4, 0xC5, 0x09, 0xE5, 0x2B, 0xA2,
+    0x85, 0x13, 0xF2, 0x89, 0x39, 0x23, 0x97, 0x55, 0x23, 0x2C, 0x1C, 0x6D, 0xFA, 0x6C, 0x85, 0x1D,
+    0xF8, 0x37, 0xD0, 0xA8, 0x39, 0x05, 0x6E, 0xC3, 0xB1, 0x96, 0x4A, 0x1F, 0x4D, 0x90, 0xB1, 0x0D,
+    0x83, 0x30, 0x14, 0x44, 0x0F, 0x53, 0x50, 0xD0, 0xA6, 0x77, 0x36, 0x60, 0x04, 0xCA, 0x8C, 0x90,
+    0x55, 0xD2, 0xC1, 0x26, 0x59, 0x24, 0x12, 0x8C, 0x90, 0x11, 0x18, 0x81, 0x22, 0x05, 0x52, 0x88,
+    0x2F, 0x77, 0x36, 0x91, 0xE2, 0xE2, 0xFB, 0xC9, 0x7A, 0xFF, 0xFE, 0x97, 0x81, 0xBF, 0x73, 0x3B,
+    0xEE, 0x2A, 0x1D, 0xD0, 0x70, 0x2C, 0x10, 0xB9, 0x14, 0x18, 0xB8, 0x15, 0x85, 0x4C, 0x87, 0xC2,
+    0x22, 0xC5, 0x27, 0xBA, 0x2C, 0x0D, 0x38, 0xD5, 0x96, 0xAA, 0x0F, 0x12, 0x2C, 0x35, 0x7B, 0x45,
+    0x0C, 0x92, 0x62, 0x0A, 0x44, 0xBF, 0x38, 0xE5, 0x2D, 0xD8, 0x9C, 0x42, 0x41, 0xCA, 0x29, 0x09,
+    0x13, 0xC7, 0x28, 0xD8, 0x41, 0x2E, 0xBD, 0xE0, 0x55, 0x93, 0x5B, 0xE7, 0x01, 0x7A, 0x5E, 0x5B,
+    0x81, 0x1B, 0xE6, 0xA0, 0x52, 0xBB, 0x51, 0x0D, 0xBC, 0xD8, 0x87, 0xA4, 0xBB, 0x14, 0xC0, 0x92,
+    0x14, 0x20, 0x64, 0xF0, 0x3E, 0x53, 0xAA, 0xAD, 0x48, 0xD2, 0x1E, 0xAB, 0xA1, 0xD5, 0x84, 0xD9,
+    0x10, 0xBC, 0x59, 0x3E, 0xD3, 0x75, 0x2F, 0xD0, 0x15, 0xC5, 0x49, 0x73, 0x81, 0xC0, 0xDF, 0xFF,
+    0x3C, 0x7E, 0x70, 0x76, 0xF9, 0x02,
 };
 
 static const EpdGlyph notoserif_18_regularGlyphs[] = {
@@ -2794,99 +2799,99 @@ static const EpdGlyph notoserif_18_regularGlyphs[] = {
     { 0, 0, 156, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 156, 0, 0, 0, 0 }, // U+0020
     { 6, 28, 199, 3, 27, 42, 0 }, // !
-    { 12, 10, 245, 2, 27, 30, 42 }, // "
-    { 21, 27, 335, 0, 27, 142, 72 }, // #
-    { 17, 32, 335, 2, 29, 136, 214 }, // $
-    { 31, 29, 538, 1, 28, 225, 350 }, // %
-    { 27, 29, 445, 1, 28, 196, 575 }, // &
-    { 5, 10, 132, 2, 27, 13, 771 }, // '
-    { 10, 34, 208, 2, 29, 85, 784 }, // (
-    { 10, 34, 208, 1, 29, 85, 869 }, // )
-    { 16, 15, 300, 1, 29, 60, 954 }, // *
-    { 17, 17, 335, 2, 22, 73, 1014 }, // +
-    { 7, 11, 150, 1, 5, 20, 1087 }, // ,
-    { 11, 4, 186, 0, 12, 11, 1107 }, // -
-    { 6, 6, 150, 2, 5, 9, 1118 }, // .
-    { 11, 34, 173, 0, 29, 94, 1127 }, // /
-    { 18, 29, 347, 2, 28, 131, 1221 }, // 0
-    { 17, 27, 275, 0, 27, 115, 1352 }, // 1
-    { 17, 28, 297, 1, 28, 119, 1467 }, // 2
-    { 17, 29, 307, 1, 28, 124, 1586 }, // 3
-    { 21, 27, 331, 0, 27, 142, 1710 }, // 4
-    { 17, 28, 307, 1, 27, 119, 1852 }, // 5
-    { 17, 29, 330, 2, 28, 124, 1971 }, // 6
-    { 18, 27, 308, 1, 27, 122, 2095 }, // 7
-    { 19, 29, 334, 1, 28, 138, 2217 }, // 8
-    { 18, 29, 330, 1, 28, 131, 2355 }, // 9
-    { 5, 22, 172, 3, 21, 28, 2486 }, // :
-    { 7, 27, 172, 1, 21, 48, 2514 }, // ;
-    { 17, 19, 335, 2, 23, 81, 2562 }, // <
-    { 17, 11, 335, 2, 19, 47, 2643 }, // =
-    { 17, 19, 335, 2, 23, 81, 2690 }, // >
-    { 16, 29, 284, 1, 28, 116, 2771 }, // ?
-    { 31, 33, 553, 2, 27, 256, 2887 }, // @
-    { 27, 27, 423, 0, 27, 183, 3143 }, // A
-    { 22, 27, 392, 1, 27, 149, 3326 }, // B
-    { 20, 29, 368, 2, 28, 145, 3475 }, // C
-    { 25, 27, 436, 1, 27, 169, 3620 }, // D
-    { 21, 27, 374, 1, 27, 142, 3789 }, // E
-    { 20, 27, 354, 1, 27, 135, 3931 }, // F
-    { 25, 29, 428, 2, 28, 182, 4066 }, // G
-    { 28, 27, 476, 1, 27, 189, 4248 }, // H
-    { 12, 27, 220, 1, 27, 81, 4437 }, // I
-    { 14, 36, 214, -1, 27, 126, 4518 }, // J
-    { 26, 27, 420, 1, 27, 176, 4644 }, // K
-    { 21, 27, 374, 1, 27, 142, 4820 }, // L
-    { 33, 27, 563, 1, 27, 223, 4962 }, // M
-    { 27, 27, 458, 1, 27, 183, 5185 }, // N
-    { 24, 29, 445, 2, 28, 174, 5368 }, // O
-    { 21, 27, 362, 1, 27, 142, 5542 }, // P
-    { 24, 37, 445, 2, 28, 222, 5684 }, // Q
-    { 24, 27, 394, 1, 27, 162, 5906 }, // R
-    { 18, 29, 326, 1, 28, 131, 6068 }, // S
-    { 23, 27, 368, 0, 27, 156, 6199 }, // T
-    { 27, 28, 430, 0, 27, 189, 6355 }, // U
-    { 26, 27, 405, 0, 27, 176, 6544 }, // V
-    { 39, 27, 628, 0, 27, 264, 6720 }, // W
-    { 25, 27, 396, 0, 27, 169, 6984 }, // X
-    { 25, 27, 375, -1, 27, 169, 7153 }, // Y
-    { 20, 27, 355, 1, 27, 135, 7322 }, // Z
-    { 10, 34, 216, 3, 29, 85, 7457 }, // [
-    { 11, 34, 173, 0, 29, 94, 7542 }, // <backslash>
-    { 9, 34, 216, 1, 29, 77, 7636 }, // ]
-    { 19, 18, 335, 1, 27, 86, 7713 }, // ^
-    { 19, 3, 275, -1, -3, 15, 7799 }, // _
-    { 8, 7, 164, 1, 29, 14, 7814 }, // `
-    { 19, 22, 338, 1, 21, 105, 7828 }, // a
-    { 21, 30, 368, 0, 29, 158, 7933 }, // b
-    { 15, 22, 295, 2, 21, 83, 8091 }, // c
-    { 21, 30, 368, 2, 29, 158, 8174 }, // d
-    { 17, 22, 321, 2, 21, 94, 8332 }, // e
-    { 16, 29, 221, 1, 29, 116, 8426 }, // f
-    { 20, 31, 323, 0, 22, 155, 8542 }, // g
-    { 23, 29, 381, 0, 29, 167, 8697 }, // h
-    { 12, 29, 192, 0, 29, 87, 8864 }, // i
-    { 9, 38, 180, -1, 29, 86, 8951 }, // j
-    { 22, 29, 351, 0, 29, 160, 9037 }, // k
-    { 12, 29, 186, 0, 29, 87, 9197 }, // l
-    { 34, 21, 567, 1, 21, 179, 9284 }, // m
-    { 23, 21, 387, 1, 21, 121, 9463 }, // n
-    { 18, 22, 346, 2, 21, 99, 9584 }, // o
-    { 21, 30, 368, 0, 21, 158, 9683 }, // p
-    { 21, 30, 368, 2, 21, 158, 9841 }, // q
-    { 17, 21, 283, 1, 21, 90, 9999 }, // r
-    { 15, 22, 271, 1, 21, 83, 10089 }, // s
-    { 13, 26, 211, 0, 25, 85, 10172 }, // t
-    { 23, 22, 381, 0, 21, 127, 10257 }, // u
-    { 22, 21, 347, 0, 21, 116, 10384 }, // v
-    { 33, 21, 517, 0, 21, 174, 10500 }, // w
-    { 22, 21, 347, 0, 21, 116, 10674 }, // x
-    { 22, 30, 339, 0, 21, 165, 10790 }, // y
-    { 17, 21, 307, 1, 21, 90, 10955 }, // z
-    { 14, 34, 257, 1, 29, 119, 11045 }, // {
-    { 3, 38, 335, 9, 29, 29, 11164 }, // |
-    { 14, 34, 257, 1, 29, 119, 11193 }, // }
-    { 17, 7, 335, 2, 17, 30, 11312 }, // ~
+    { 12, 10, 245, 2, 27, 30, 0 }, // "
+    { 21, 27, 335, 0, 27, 142, 30 }, // #
+    { 17, 32, 335, 2, 29, 136, 172 }, // $
+    { 31, 29, 538, 1, 28, 225, 308 }, // %
+    { 27, 29, 445, 1, 28, 196, 533 }, // &
+    { 5, 10, 132, 2, 27, 13, 729 }, // '
+    { 10, 34, 208, 2, 29, 85, 42 }, // (
+    { 10, 34, 208, 1, 29, 85, 127 }, // )
+    { 16, 15, 300, 1, 29, 60, 742 }, // *
+    { 17, 17, 335, 2, 22, 73, 802 }, // +
+    { 7, 11, 150, 1, 5, 20, 212 }, // ,
+    { 11, 4, 186, 0, 12, 11, 232 }, // -
+    { 6, 6, 150, 2, 5, 9, 243 }, // .
+    { 11, 34, 173, 0, 29, 94, 875 }, // /
+    { 18, 29, 347, 2, 28, 131, 252 }, // 0
+    { 17, 27, 275, 0, 27, 115, 383 }, // 1
+    { 17, 28, 297, 1, 28, 119, 498 }, // 2
+    { 17, 29, 307, 1, 28, 124, 617 }, // 3
+    { 21, 27, 331, 0, 27, 142, 741 }, // 4
+    { 17, 28, 307, 1, 27, 119, 883 }, // 5
+    { 17, 29, 330, 2, 28, 124, 1002 }, // 6
+    { 18, 27, 308, 1, 27, 122, 1126 }, // 7
+    { 19, 29, 334, 1, 28, 138, 1248 }, // 8
+    { 18, 29, 330, 1, 28, 131, 1386 }, // 9
+    { 5, 22, 172, 3, 21, 28, 1517 }, // :
+    { 7, 27, 172, 1, 21, 48, 1545 }, // ;
+    { 17, 19, 335, 2, 23, 81, 969 }, // <
+    { 17, 11, 335, 2, 19, 47, 1050 }, // =
+    { 17, 19, 335, 2, 23, 81, 1097 }, // >
+    { 16, 29, 284, 1, 28, 116, 1593 }, // ?
+    { 31, 33, 553, 2, 27, 256, 1178 }, // @
+    { 27, 27, 423, 0, 27, 183, 1709 }, // A
+    { 22, 27, 392, 1, 27, 149, 1892 }, // B
+    { 20, 29, 368, 2, 28, 145, 2041 }, // C
+    { 25, 27, 436, 1, 27, 169, 2186 }, // D
+    { 21, 27, 374, 1, 27, 142, 2355 }, // E
+    { 20, 27, 354, 1, 27, 135, 2497 }, // F
+    { 25, 29, 428, 2, 28, 182, 2632 }, // G
+    { 28, 27, 476, 1, 27, 189, 2814 }, // H
+    { 12, 27, 220, 1, 27, 81, 3003 }, // I
+    { 14, 36, 214, -1, 27, 126, 3084 }, // J
+    { 26, 27, 420, 1, 27, 176, 3210 }, // K
+    { 21, 27, 374, 1, 27, 142, 3386 }, // L
+    { 33, 27, 563, 1, 27, 223, 3528 }, // M
+    { 27, 27, 458, 1, 27, 183, 3751 }, // N
+    { 24, 29, 445, 2, 28, 174, 3934 }, // O
+    { 21, 27, 362, 1, 27, 142, 4108 }, // P
+    { 24, 37, 445, 2, 28, 222, 4250 }, // Q
+    { 24, 27, 394, 1, 27, 162, 4472 }, // R
+    { 18, 29, 326, 1, 28, 131, 4634 }, // S
+    { 23, 27, 368, 0, 27, 156, 4765 }, // T
+    { 27, 28, 430, 0, 27, 189, 1434 }, // U
+    { 26, 27, 405, 0, 27, 176, 4921 }, // V
+    { 39, 27, 628, 0, 27, 264, 5097 }, // W
+    { 25, 27, 396, 0, 27, 169, 5361 }, // X
+    { 25, 27, 375, -1, 27, 169, 5530 }, // Y
+    { 20, 27, 355, 1, 27, 135, 5699 }, // Z
+    { 10, 34, 216, 3, 29, 85, 1623 }, // [
+    { 11, 34, 173, 0, 29, 94, 1708 }, // <backslash>
+    { 9, 34, 216, 1, 29, 77, 1802 }, // ]
+    { 19, 18, 335, 1, 27, 86, 1879 }, // ^
+    { 19, 3, 275, -1, -3, 15, 1965 }, // _
+    { 8, 7, 164, 1, 29, 14, 1980 }, // `
+    { 19, 22, 338, 1, 21, 105, 5834 }, // a
+    { 21, 30, 368, 0, 29, 158, 5939 }, // b
+    { 15, 22, 295, 2, 21, 83, 6097 }, // c
+    { 21, 30, 368, 2, 29, 158, 6180 }, // d
+    { 17, 22, 321, 2, 21, 94, 6338 }, // e
+    { 16, 29, 221, 1, 29, 116, 6432 }, // f
+    { 20, 31, 323, 0, 22, 155, 6548 }, // g
+    { 23, 29, 381, 0, 29, 167, 6703 }, // h
+    { 12, 29, 192, 0, 29, 87, 6870 }, // i
+    { 9, 38, 180, -1, 29, 86, 6957 }, // j
+    { 22, 29, 351, 0, 29, 160, 7043 }, // k
+    { 12, 29, 186, 0, 29, 87, 7203 }, // l
+    { 34, 21, 567, 1, 21, 179, 7290 }, // m
+    { 23, 21, 387, 1, 21, 121, 7469 }, // n
+    { 18, 22, 346, 2, 21, 99, 7590 }, // o
+    { 21, 30, 368, 0, 21, 158, 7689 }, // p
+    { 21, 30, 368, 2, 21, 158, 7847 }, // q
+    { 17, 21, 283, 1, 21, 90, 8005 }, // r
+    { 15, 22, 271, 1, 21, 83, 8095 }, // s
+    { 13, 26, 211, 0, 25, 85, 8178 }, // t
+    { 23, 22, 381, 0, 21, 127, 8263 }, // u
+    { 22, 21, 347, 0, 21, 116, 8390 }, // v
+    { 33, 21, 517, 0, 21, 174, 8506 }, // w
+    { 22, 21, 347, 0, 21, 116, 8680 }, // x
+    { 22, 30, 339, 0, 21, 165, 8796 }, // y
+    { 17, 21, 307, 1, 21, 90, 8961 }, // z
+    { 14, 34, 257, 1, 29, 119, 1994 }, // {
+    { 3, 38, 335, 9, 29, 29, 2113 }, // |
+    { 14, 34, 257, 1, 29, 119, 2142 }, // }
+    { 17, 7, 335, 2, 17, 30, 2261 }, // ~
     { 0, 0, 156, 0, 0, 0, 0 }, // U+00A0
     { 6, 28, 199, 3, 21, 42, 0 }, // U+00A1
     { 17, 27, 335, 2, 27, 115, 42 }, // U+00A2
@@ -2970,19 +2975,19 @@ static const EpdGlyph notoserif_18_regularGlyphs[] = {
     { 18, 30, 346, 2, 29, 135, 10986 }, // U+00F0
     { 23, 28, 387, 1, 28, 161, 11121 }, // U+00F1
     { 18, 30, 346, 2, 29, 135, 11282 }, // U+00F2
-    { 18, 30, 346, 2, 29, 135, 11417 }, // U+00F3
-    { 18, 30, 346, 2, 29, 135, 11552 }, // U+00F4
-    { 18, 29, 346, 2, 28, 131, 11687 }, // U+00F5
-    { 18, 29, 346, 2, 28, 131, 11818 }, // U+00F6
-    { 17, 19, 335, 2, 23, 81, 11949 }, // U+00F7
-    { 18, 24, 346, 2, 22, 108, 12030 }, // U+00F8
-    { 23, 30, 381, 0, 29, 173, 12138 }, // U+00F9
-    { 23, 30, 381, 0, 29, 173, 12311 }, // U+00FA
-    { 23, 30, 381, 0, 29, 173, 12484 }, // U+00FB
-    { 23, 29, 381, 0, 28, 167, 12657 }, // U+00FC
-    { 22, 38, 339, 0, 29, 209, 12824 }, // U+00FD
-    { 21, 38, 368, 0, 29, 200, 13033 }, // U+00FE
-    { 22, 37, 339, 0, 28, 204, 13233 }, // U+00FF
+    { 18, 30, 346, 2, 29, 135, 9051 }, // U+00F3
+    { 18, 30, 346, 2, 29, 135, 11417 }, // U+00F4
+    { 18, 29, 346, 2, 28, 131, 11552 }, // U+00F5
+    { 18, 29, 346, 2, 28, 131, 11683 }, // U+00F6
+    { 17, 19, 335, 2, 23, 81, 11814 }, // U+00F7
+    { 18, 24, 346, 2, 22, 108, 11895 }, // U+00F8
+    { 23, 30, 381, 0, 29, 173, 12003 }, // U+00F9
+    { 23, 30, 381, 0, 29, 173, 12176 }, // U+00FA
+    { 23, 30, 381, 0, 29, 173, 12349 }, // U+00FB
+    { 23, 29, 381, 0, 28, 167, 12522 }, // U+00FC
+    { 22, 38, 339, 0, 29, 209, 12689 }, // U+00FD
+    { 21, 38, 368, 0, 29, 200, 12898 }, // U+00FE
+    { 22, 37, 339, 0, 28, 204, 13098 }, // U+00FF
     { 27, 32, 423, 0, 32, 216, 0 }, // U+0100
     { 19, 27, 338, 1, 26, 129, 216 }, // U+0101
     { 27, 34, 423, 0, 34, 230, 345 }, // U+0102
@@ -3684,98 +3689,98 @@ static const EpdGlyph notoserif_18_regularGlyphs[] = {
     { 11, 4, 186, 0, 12, 11, 233 }, // U+2010
     { 11, 4, 186, 0, 12, 11, 244 }, // U+2011
     { 19, 3, 335, 1, 15, 15, 255 }, // U+2012
-    { 20, 4, 300, -1, 12, 20, 270 }, // U+2013
-    { 39, 4, 600, -1, 12, 39, 290 }, // U+2014
-    { 39, 4, 600, -1, 12, 39, 329 }, // U+2015
-    { 9, 38, 335, 6, 29, 86, 368 }, // U+2016
-    { 17, 8, 247, -1, 0, 34, 454 }, // U+2017
-    { 7, 11, 150, 2, 27, 20, 488 }, // U+2018
-    { 7, 11, 150, 1, 27, 20, 508 }, // U+2019
-    { 7, 11, 150, 1, 5, 20, 528 }, // U+201A
-    { 7, 11, 150, 2, 27, 20, 548 }, // U+201B
-    { 14, 11, 270, 2, 27, 39, 568 }, // U+201C
-    { 14, 11, 270, 1, 27, 39, 607 }, // U+201D
-    { 14, 11, 270, 1, 5, 39, 646 }, // U+201E
-    { 14, 11, 270, 2, 27, 39, 685 }, // U+201F
-    { 15, 34, 269, 1, 29, 128, 724 }, // U+2020
-    { 15, 34, 269, 1, 29, 128, 852 }, // U+2021
-    { 11, 12, 217, 1, 19, 33, 980 }, // U+2022
-    { 13, 13, 300, 3, 20, 43, 1013 }, // U+2023
-    { 6, 6, 150, 2, 16, 9, 1056 }, // U+2024
-    { 16, 6, 322, 2, 16, 24, 1065 }, // U+2025
-    { 27, 6, 515, 3, 5, 41, 1089 }, // U+2026
-    { 6, 6, 150, 2, 14, 9, 1130 }, // U+2027
-    { 0, 0, 360, 0, 0, 0, 1139 }, // U+2028
-    { 0, 0, 360, 0, 0, 0, 1139 }, // U+2029
-    { 9, 28, 0, -1, 23, 63, 1139 }, // U+202A
-    { 9, 28, 0, -8, 23, 63, 1202 }, // U+202B
-    { 10, 31, 0, -5, 26, 78, 1265 }, // U+202C
-    { 10, 31, 0, -5, 26, 78, 1343 }, // U+202D
-    { 10, 31, 0, -5, 26, 78, 1421 }, // U+202E
-    { 0, 0, 100, 0, 0, 0, 1499 }, // U+202F
-    { 46, 29, 775, 1, 28, 334, 1499 }, // U+2030
-    { 61, 29, 1012, 1, 28, 443, 1833 }, // U+2031
-    { 7, 10, 113, 0, 27, 18, 2276 }, // U+2032
-    { 14, 10, 226, 0, 27, 35, 2294 }, // U+2033
-    { 21, 10, 338, 0, 27, 53, 2329 }, // U+2034
-    { 7, 10, 113, 0, 27, 18, 2382 }, // U+2035
-    { 14, 10, 226, 0, 27, 35, 2400 }, // U+2036
-    { 21, 10, 338, 0, 27, 53, 2435 }, // U+2037
-    { 13, 11, 240, 1, 2, 36, 2488 }, // U+2038
-    { 9, 15, 200, 2, 18, 34, 2524 }, // U+2039
-    { 9, 15, 200, 2, 18, 34, 2558 }, // U+203A
-    { 27, 27, 491, 2, 27, 183, 2592 }, // U+203B
-    { 15, 28, 335, 3, 27, 105, 2775 }, // U+203C
-    { 18, 29, 324, 1, 28, 131, 2880 }, // U+203D
-    { 19, 3, 275, -1, 31, 15, 3011 }, // U+203E
-    { 30, 8, 0, -15, 0, 60, 3026 }, // U+203F
-    { 30, 7, 0, -15, 31, 53, 3086 }, // U+2040
-    { 17, 27, 270, 0, 27, 115, 3139 }, // U+2041
-    { 34, 29, 600, 2, 29, 247, 3254 }, // U+2042
-    { 11, 7, 217, 1, 17, 20, 3501 }, // U+2043
-    { 17, 27, 37, -7, 27, 115, 3521 }, // U+2044
-    { 10, 34, 216, 3, 29, 85, 3636 }, // U+2045
-    { 9, 34, 216, 1, 29, 77, 3721 }, // U+2046
-    { 34, 29, 573, 1, 28, 247, 3798 }, // U+2047
-    { 24, 29, 461, 1, 28, 174, 4045 }, // U+2048
-    { 25, 29, 455, 3, 28, 182, 4219 }, // U+2049
-    { 18, 29, 335, 1, 22, 131, 4401 }, // U+204A
-    { 21, 34, 370, 1, 29, 179, 4532 }, // U+204B
-    { 20, 14, 358, 1, 21, 70, 4711 }, // U+204C
-    { 20, 14, 358, 1, 21, 70, 4781 }, // U+204D
-    { 16, 15, 300, 1, 21, 60, 4851 }, // U+204E
-    { 7, 27, 172, 2, 21, 48, 4911 }, // U+204F
-    { 25, 29, 438, 1, 28, 182, 4959 }, // U+2050
-    { 16, 31, 300, 1, 29, 124, 5141 }, // U+2051
-    { 12, 28, 197, 0, 27, 84, 5265 }, // U+2052
-    { 17, 7, 335, 2, 17, 30, 5349 }, // U+2053
-    { 30, 8, 0, -15, 0, 60, 5379 }, // U+2054
-    { 18, 17, 324, 1, 22, 77, 5439 }, // U+2055
-    { 18, 22, 368, 3, 21, 99, 5516 }, // U+2056
-    { 26, 10, 415, 0, 27, 65, 5615 }, // U+2057
-    { 21, 22, 425, 3, 21, 116, 5680 }, // U+2058
-    { 21, 22, 425, 3, 21, 116, 5796 }, // U+2059
-    { 5, 29, 172, 3, 28, 37, 5912 }, // U+205A
-    { 21, 29, 425, 3, 28, 153, 5949 }, // U+205B
-    { 21, 21, 418, 3, 21, 111, 6102 }, // U+205C
-    { 5, 29, 172, 3, 28, 37, 6213 }, // U+205D
-    { 5, 29, 172, 3, 28, 37, 6250 }, // U+205E
-    { 0, 0, 133, 0, 0, 0, 6287 }, // U+205F
-    { 0, 0, 360, 0, 0, 0, 6287 }, // U+2060
-    { 0, 0, 360, 0, 0, 0, 6287 }, // U+2061
-    { 0, 0, 360, 0, 0, 0, 6287 }, // U+2062
-    { 0, 0, 360, 0, 0, 0, 6287 }, // U+2063
-    { 0, 0, 360, 0, 0, 0, 6287 }, // U+2064
-    { 0, 0, 0, 0, 0, 0, 6287 }, // U+2066
-    { 0, 0, 0, 0, 0, 0, 6287 }, // U+2067
-    { 0, 0, 0, 0, 0, 0, 6287 }, // U+2068
-    { 0, 0, 0, 0, 0, 0, 6287 }, // U+2069
-    { 10, 31, 0, -5, 26, 78, 6287 }, // U+206A
-    { 10, 31, 0, -5, 26, 78, 6365 }, // U+206B
-    { 10, 31, 0, -5, 26, 78, 6443 }, // U+206C
-    { 10, 31, 0, -5, 26, 78, 6521 }, // U+206D
-    { 10, 31, 0, -5, 26, 78, 6599 }, // U+206E
-    { 10, 31, 0, -5, 26, 78, 6677 }, // U+206F
+    { 20, 4, 300, -1, 12, 20, 9186 }, // U+2013
+    { 39, 4, 600, -1, 12, 39, 9206 }, // U+2014
+    { 39, 4, 600, -1, 12, 39, 270 }, // U+2015
+    { 9, 38, 335, 6, 29, 86, 309 }, // U+2016
+    { 17, 8, 247, -1, 0, 34, 395 }, // U+2017
+    { 7, 11, 150, 2, 27, 20, 429 }, // U+2018
+    { 7, 11, 150, 1, 27, 20, 9245 }, // U+2019
+    { 7, 11, 150, 1, 5, 20, 449 }, // U+201A
+    { 7, 11, 150, 2, 27, 20, 469 }, // U+201B
+    { 14, 11, 270, 2, 27, 39, 9265 }, // U+201C
+    { 14, 11, 270, 1, 27, 39, 9304 }, // U+201D
+    { 14, 11, 270, 1, 5, 39, 489 }, // U+201E
+    { 14, 11, 270, 2, 27, 39, 528 }, // U+201F
+    { 15, 34, 269, 1, 29, 128, 567 }, // U+2020
+    { 15, 34, 269, 1, 29, 128, 695 }, // U+2021
+    { 11, 12, 217, 1, 19, 33, 823 }, // U+2022
+    { 13, 13, 300, 3, 20, 43, 856 }, // U+2023
+    { 6, 6, 150, 2, 16, 9, 899 }, // U+2024
+    { 16, 6, 322, 2, 16, 24, 908 }, // U+2025
+    { 27, 6, 515, 3, 5, 41, 9343 }, // U+2026
+    { 6, 6, 150, 2, 14, 9, 932 }, // U+2027
+    { 0, 0, 360, 0, 0, 0, 941 }, // U+2028
+    { 0, 0, 360, 0, 0, 0, 941 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 941 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 1004 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 1067 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 1145 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 1223 }, // U+202E
+    { 0, 0, 100, 0, 0, 0, 1301 }, // U+202F
+    { 46, 29, 775, 1, 28, 334, 1301 }, // U+2030
+    { 61, 29, 1012, 1, 28, 443, 1635 }, // U+2031
+    { 7, 10, 113, 0, 27, 18, 2078 }, // U+2032
+    { 14, 10, 226, 0, 27, 35, 2096 }, // U+2033
+    { 21, 10, 338, 0, 27, 53, 2131 }, // U+2034
+    { 7, 10, 113, 0, 27, 18, 2184 }, // U+2035
+    { 14, 10, 226, 0, 27, 35, 2202 }, // U+2036
+    { 21, 10, 338, 0, 27, 53, 2237 }, // U+2037
+    { 13, 11, 240, 1, 2, 36, 2290 }, // U+2038
+    { 9, 15, 200, 2, 18, 34, 2326 }, // U+2039
+    { 9, 15, 200, 2, 18, 34, 2360 }, // U+203A
+    { 27, 27, 491, 2, 27, 183, 2394 }, // U+203B
+    { 15, 28, 335, 3, 27, 105, 2577 }, // U+203C
+    { 18, 29, 324, 1, 28, 131, 2682 }, // U+203D
+    { 19, 3, 275, -1, 31, 15, 2813 }, // U+203E
+    { 30, 8, 0, -15, 0, 60, 2828 }, // U+203F
+    { 30, 7, 0, -15, 31, 53, 2888 }, // U+2040
+    { 17, 27, 270, 0, 27, 115, 2941 }, // U+2041
+    { 34, 29, 600, 2, 29, 247, 3056 }, // U+2042
+    { 11, 7, 217, 1, 17, 20, 3303 }, // U+2043
+    { 17, 27, 37, -7, 27, 115, 3323 }, // U+2044
+    { 10, 34, 216, 3, 29, 85, 3438 }, // U+2045
+    { 9, 34, 216, 1, 29, 77, 3523 }, // U+2046
+    { 34, 29, 573, 1, 28, 247, 3600 }, // U+2047
+    { 24, 29, 461, 1, 28, 174, 3847 }, // U+2048
+    { 25, 29, 455, 3, 28, 182, 4021 }, // U+2049
+    { 18, 29, 335, 1, 22, 131, 4203 }, // U+204A
+    { 21, 34, 370, 1, 29, 179, 4334 }, // U+204B
+    { 20, 14, 358, 1, 21, 70, 4513 }, // U+204C
+    { 20, 14, 358, 1, 21, 70, 4583 }, // U+204D
+    { 16, 15, 300, 1, 21, 60, 4653 }, // U+204E
+    { 7, 27, 172, 2, 21, 48, 4713 }, // U+204F
+    { 25, 29, 438, 1, 28, 182, 4761 }, // U+2050
+    { 16, 31, 300, 1, 29, 124, 4943 }, // U+2051
+    { 12, 28, 197, 0, 27, 84, 5067 }, // U+2052
+    { 17, 7, 335, 2, 17, 30, 5151 }, // U+2053
+    { 30, 8, 0, -15, 0, 60, 5181 }, // U+2054
+    { 18, 17, 324, 1, 22, 77, 5241 }, // U+2055
+    { 18, 22, 368, 3, 21, 99, 5318 }, // U+2056
+    { 26, 10, 415, 0, 27, 65, 5417 }, // U+2057
+    { 21, 22, 425, 3, 21, 116, 5482 }, // U+2058
+    { 21, 22, 425, 3, 21, 116, 5598 }, // U+2059
+    { 5, 29, 172, 3, 28, 37, 5714 }, // U+205A
+    { 21, 29, 425, 3, 28, 153, 5751 }, // U+205B
+    { 21, 21, 418, 3, 21, 111, 5904 }, // U+205C
+    { 5, 29, 172, 3, 28, 37, 6015 }, // U+205D
+    { 5, 29, 172, 3, 28, 37, 6052 }, // U+205E
+    { 0, 0, 133, 0, 0, 0, 6089 }, // U+205F
+    { 0, 0, 360, 0, 0, 0, 6089 }, // U+2060
+    { 0, 0, 360, 0, 0, 0, 6089 }, // U+2061
+    { 0, 0, 360, 0, 0, 0, 6089 }, // U+2062
+    { 0, 0, 360, 0, 0, 0, 6089 }, // U+2063
+    { 0, 0, 360, 0, 0, 0, 6089 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 6089 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 6089 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 6089 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 6089 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 6089 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 6167 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 6245 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 6323 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 6401 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 6479 }, // U+206F
     { 13, 17, 240, 1, 31, 56, 0 }, // U+2070
     { 8, 18, 125, 0, 28, 36, 56 }, // U+2071
     { 15, 17, 240, 0, 31, 64, 92 }, // U+2074
@@ -3852,13 +3857,13 @@ static const EpdGlyph notoserif_18_regularGlyphs[] = {
     { 19, 33, 335, 1, 30, 157, 5431 }, // U+20BF
     { 17, 27, 295, 1, 21, 115, 5588 }, // U+20C0
     { 18, 4, 347, 2, 15, 18, 0 }, // U+2212
-    { 29, 29, 425, 1, 29, 211, 0 }, // U+FB00
-    { 24, 30, 398, 1, 30, 180, 211 }, // U+FB01
-    { 24, 29, 397, 1, 29, 174, 391 }, // U+FB02
-    { 37, 30, 601, 1, 30, 278, 565 }, // U+FB03
-    { 37, 29, 601, 1, 29, 269, 843 }, // U+FB04
-    { 25, 30, 401, 0, 29, 188, 1112 }, // U+FB05
-    { 28, 30, 474, 1, 29, 210, 1300 }, // U+FB06
+    { 29, 29, 425, 1, 29, 211, 9384 }, // U+FB00
+    { 24, 30, 398, 1, 30, 180, 9595 }, // U+FB01
+    { 24, 29, 397, 1, 29, 174, 9775 }, // U+FB02
+    { 37, 30, 601, 1, 30, 278, 9949 }, // U+FB03
+    { 37, 29, 601, 1, 29, 269, 10227 }, // U+FB04
+    { 25, 30, 401, 0, 29, 188, 0 }, // U+FB05
+    { 28, 30, 474, 1, 29, 210, 188 }, // U+FB06
     { 35, 35, 600, 1, 29, 307, 0 }, // U+FFFD
 };
 
@@ -3866,8 +3871,7 @@ static const EpdUnicodeInterval notoserif_18_regularIntervals[] = {
     { 0x0, 0x0, 0x0 },
     { 0xD, 0xD, 0x1 },
     { 0x20, 0x7E, 0x2 },
-    { 0xA0, 0xFF, 0x61 },
-    { 0x100, 0x17F, 0xC1 },
+    { 0xA0, 0x17F, 0x61 },
     { 0x1A0, 0x1A1, 0x141 },
     { 0x1AF, 0x1B0, 0x143 },
     { 0x1C4, 0x21F, 0x145 },
@@ -3875,8 +3879,7 @@ static const EpdUnicodeInterval notoserif_18_regularIntervals[] = {
     { 0x400, 0x4FF, 0x211 },
     { 0x1EA0, 0x1EF9, 0x311 },
     { 0x2000, 0x2064, 0x36B },
-    { 0x2066, 0x206F, 0x3D0 },
-    { 0x2070, 0x2071, 0x3DA },
+    { 0x2066, 0x2071, 0x3D0 },
     { 0x2074, 0x208E, 0x3DC },
     { 0x2090, 0x209C, 0x3F7 },
     { 0x20A0, 0x20C0, 0x404 },
@@ -3886,19 +3889,57 @@ static const EpdUnicodeInterval notoserif_18_regularIntervals[] = {
 };
 
 static const EpdFontGroup notoserif_18_regularGroups[] = {
-    { 0, 4832, 12382, 97, 0 },
-    { 4832, 4105, 14348, 96, 97 },
-    { 8937, 5035, 22835, 128, 193 },
-    { 13972, 5123, 20312, 96, 321 },
-    { 19095, 1607, 2849, 112, 417 },
-    { 20702, 13749, 48055, 256, 529 },
-    { 34451, 2937, 18922, 90, 785 },
-    { 37388, 2690, 7597, 111, 875 },
-    { 40078, 930, 2284, 42, 986 },
-    { 41008, 2780, 6047, 33, 1028 },
-    { 43788, 13, 20, 1, 1061 },
-    { 43801, 468, 1596, 7, 1062 },
-    { 44269, 170, 315, 1, 1069 },
+    { 0, 4168, 11391, 83, 2 },
+    { 4168, 1126, 2529, 26, 0 },
+    { 5294, 4088, 14198, 95, 97 },
+    { 9382, 5035, 22835, 128, 193 },
+    { 14417, 5123, 20312, 96, 321 },
+    { 19540, 1607, 2849, 112, 417 },
+    { 21147, 13749, 48055, 256, 529 },
+    { 34896, 2937, 18922, 90, 785 },
+    { 37833, 2597, 7385, 105, 875 },
+    { 40430, 930, 2284, 42, 986 },
+    { 41360, 2780, 6047, 33, 1028 },
+    { 44140, 13, 20, 1, 1061 },
+    { 44153, 195, 420, 2, 1067 },
+    { 44348, 170, 315, 1, 1069 },
+};
+
+static const uint16_t notoserif_18_regularGlyphToGroup[] = {
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 11, 0, 0, 0, 0, 0, 12, 12, 13,
 };
 
 static const EpdKernClassEntry notoserif_18_regularKernLeftClasses[] = {
@@ -4818,18 +4859,81 @@ static const EpdLigaturePair notoserif_18_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry notoserif_18_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0001, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0002, 0, 0 }, { 0x0003, 0, 1 }, { 0x0004, 1, 2 }, { 0x0005, 0, 0 }, { 0x0006, 0, 0 }, { 0x0007, 0, 0 }, { 0x0008, 2, 3 }, { 0x0009, 1, 2 }, // U+0020
+    { 0x000A, 0, 0 }, { 0x000B, 0, 4 }, { 0x000C, 3, 5 }, { 0x000D, 0, 0 }, { 0x000E, 4, 6 }, { 0x000F, 0, 0 }, { 0x0010, 4, 7 }, { 0x0011, 0, 0 }, // U+0028
+    { 0x0012, 0, 0 }, { 0x0013, 0, 0 }, { 0x0014, 0, 0 }, { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, // U+0030
+    { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 8 }, { 0x001D, 0, 8 }, { 0x001E, 0, 0 }, { 0x001F, 0, 0 }, { 0x0020, 0, 0 }, { 0x0021, 0, 9 }, // U+0038
+    { 0x0022, 5, 10 }, { 0x0023, 6, 11 }, { 0x0024, 7, 12 }, { 0x0025, 0, 13 }, { 0x0026, 8, 12 }, { 0x0027, 9, 12 }, { 0x0028, 10, 12 }, { 0x0029, 11, 13 }, // U+0040
+    { 0x002A, 0, 12 }, { 0x002B, 0, 12 }, { 0x002C, 0, 14 }, { 0x002D, 12, 12 }, { 0x002E, 13, 12 }, { 0x002F, 0, 12 }, { 0x0030, 14, 12 }, { 0x0031, 8, 13 }, // U+0048
+    { 0x0032, 3, 12 }, { 0x0033, 8, 13 }, { 0x0034, 15, 12 }, { 0x0035, 16, 15 }, { 0x0036, 17, 16 }, { 0x0037, 18, 17 }, { 0x0038, 19, 18 }, { 0x0039, 20, 19 }, // U+0050
+    { 0x003A, 21, 20 }, { 0x003B, 22, 21 }, { 0x003C, 0, 22 }, { 0x003D, 0, 0 }, { 0x003E, 0, 0 }, { 0x003F, 0, 4 }, { 0x0040, 0, 0 }, { 0x0041, 0, 0 }, // U+0058
+    { 0x0042, 0, 0 }, { 0x0043, 23, 23 }, { 0x0044, 24, 24 }, { 0x0045, 0, 25 }, { 0x0046, 0, 25 }, { 0x0047, 25, 25 }, { 0x0048, 26, 0 }, { 0x0049, 27, 26 }, // U+0060
+    { 0x004A, 23, 24 }, { 0x004B, 0, 27 }, { 0x004C, 0, 0 }, { 0x004D, 28, 24 }, { 0x004E, 0, 24 }, { 0x004F, 23, 27 }, { 0x0050, 23, 27 }, { 0x0051, 24, 25 }, // U+0068
+    { 0x0052, 24, 27 }, { 0x0053, 0, 25 }, { 0x0054, 29, 27 }, { 0x0055, 30, 28 }, { 0x0056, 0, 29 }, { 0x0057, 0, 30 }, { 0x0058, 31, 31 }, { 0x0059, 32, 32 }, // U+0070
+    { 0x005A, 0, 33 }, { 0x005B, 33, 34 }, { 0x005C, 0, 35 }, { 0x005D, 0, 0 }, { 0x005E, 0, 0 }, { 0x005F, 0, 4 }, { 0x0060, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0061, 0, 0 }, { 0x0062, 34, 0 }, { 0x0063, 0, 0 }, { 0x0064, 0, 0 }, { 0x0065, 0, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, // U+00A0
+    { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, { 0x006C, 0, 36 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 0, 0 }, { 0x0070, 0, 0 }, // U+00A8
+    { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 37 }, // U+00B0
+    { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, { 0x007C, 0, 36 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 0, 0 }, { 0x0080, 35, 0 }, // U+00B8
+    { 0x0081, 36, 11 }, { 0x0082, 36, 11 }, { 0x0083, 36, 11 }, { 0x0084, 36, 11 }, { 0x0085, 36, 11 }, { 0x0086, 36, 11 }, { 0x0087, 9, 38 }, { 0x0088, 0, 13 }, // U+00C0
+    { 0x0089, 9, 12 }, { 0x008A, 9, 12 }, { 0x008B, 9, 12 }, { 0x008C, 9, 12 }, { 0x008D, 0, 12 }, { 0x008E, 0, 12 }, { 0x008F, 0, 12 }, { 0x0090, 0, 12 }, // U+00C8
+    { 0x0091, 8, 12 }, { 0x0092, 14, 12 }, { 0x0093, 8, 13 }, { 0x0094, 8, 13 }, { 0x0095, 8, 13 }, { 0x0096, 8, 13 }, { 0x0097, 8, 13 }, { 0x0098, 0, 0 }, // U+00D0
+    { 0x0099, 8, 13 }, { 0x009A, 18, 17 }, { 0x009B, 18, 17 }, { 0x009C, 18, 17 }, { 0x009D, 18, 17 }, { 0x009E, 22, 21 }, { 0x009F, 8, 12 }, { 0x00A0, 24, 0 }, // U+00D8
+    { 0x00A1, 23, 23 }, { 0x00A2, 23, 23 }, { 0x00A3, 23, 23 }, { 0x00A4, 23, 23 }, { 0x00A5, 23, 23 }, { 0x00A6, 23, 23 }, { 0x00A7, 25, 23 }, { 0x00A8, 0, 25 }, // U+00E0
+    { 0x00A9, 25, 25 }, { 0x00AA, 25, 25 }, { 0x00AB, 25, 25 }, { 0x00AC, 25, 25 }, { 0x00AD, 0, 39 }, { 0x00AE, 0, 27 }, { 0x00AF, 0, 39 }, { 0x00B0, 0, 39 }, // U+00E8
+    { 0x00B1, 24, 25 }, { 0x00B2, 23, 27 }, { 0x00B3, 24, 25 }, { 0x00B4, 24, 25 }, { 0x00B5, 24, 25 }, { 0x00B6, 24, 25 }, { 0x00B7, 24, 25 }, { 0x00B8, 0, 0 }, // U+00F0
+    { 0x00B9, 24, 25 }, { 0x00BA, 0, 30 }, { 0x00BB, 0, 30 }, { 0x00BC, 0, 30 }, { 0x00BD, 0, 30 }, { 0x00BE, 33, 34 }, { 0x00BF, 24, 24 }, { 0x00C0, 33, 34 }, // U+00F8
+    { 0x00C1, 6, 11 }, { 0x00C2, 0, 23 }, { 0x00C3, 36, 11 }, { 0x00C4, 0, 23 }, { 0x00C5, 36, 11 }, { 0x00C6, 0, 23 }, { 0x00C7, 0, 13 }, { 0x00C8, 0, 25 }, // U+0100
+    { 0x00C9, 0, 13 }, { 0x00CA, 0, 25 }, { 0x00CB, 0, 13 }, { 0x00CC, 0, 25 }, { 0x00CD, 0, 13 }, { 0x00CE, 0, 25 }, { 0x00CF, 8, 12 }, { 0x00D0, 37, 25 }, // U+0108
+    { 0x00D1, 8, 12 }, { 0x00D2, 0, 25 }, { 0x00D3, 9, 12 }, { 0x00D4, 25, 25 }, { 0x00D5, 9, 12 }, { 0x00D6, 25, 25 }, { 0x00D7, 9, 12 }, { 0x00D8, 25, 25 }, // U+0110
+    { 0x00D9, 9, 12 }, { 0x00DA, 25, 25 }, { 0x00DB, 9, 12 }, { 0x00DC, 25, 25 }, { 0x00DD, 11, 13 }, { 0x00DE, 0, 25 }, { 0x00DF, 11, 13 }, { 0x00E0, 0, 25 }, // U+0118
+    { 0x00E1, 11, 13 }, { 0x00E2, 0, 25 }, { 0x00E3, 11, 13 }, { 0x00E4, 0, 25 }, { 0x00E5, 0, 12 }, { 0x00E6, 23, 24 }, { 0x00E7, 0, 12 }, { 0x00E8, 23, 24 }, // U+0120
+    { 0x00E9, 0, 12 }, { 0x00EA, 38, 40 }, { 0x00EB, 0, 12 }, { 0x00EC, 0, 39 }, { 0x00ED, 0, 12 }, { 0x00EE, 0, 39 }, { 0x00EF, 0, 12 }, { 0x00F0, 0, 27 }, // U+0128
+    { 0x00F1, 0, 12 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 12 }, { 0x00F4, 0, 27 }, { 0x00F5, 0, 14 }, { 0x00F6, 0, 0 }, { 0x00F7, 12, 12 }, { 0x00F8, 28, 24 }, // U+0130
+    { 0x00F9, 28, 27 }, { 0x00FA, 13, 12 }, { 0x00FB, 0, 24 }, { 0x00FC, 13, 12 }, { 0x00FD, 0, 24 }, { 0x00FE, 0, 12 }, { 0x00FF, 37, 24 }, { 0x0100, 0, 12 }, // U+0138
+    { 0x0101, 0, 24 }, { 0x0102, 13, 12 }, { 0x0103, 0, 24 }, { 0x0104, 14, 12 }, { 0x0105, 23, 27 }, { 0x0106, 14, 12 }, { 0x0107, 23, 27 }, { 0x0108, 14, 12 }, // U+0140
+    { 0x0109, 23, 27 }, { 0x010A, 23, 0 }, { 0x010B, 0, 12 }, { 0x010C, 23, 27 }, { 0x010D, 8, 13 }, { 0x010E, 24, 25 }, { 0x010F, 8, 13 }, { 0x0110, 24, 25 }, // U+0148
+    { 0x0111, 8, 13 }, { 0x0112, 24, 25 }, { 0x0113, 9, 13 }, { 0x0114, 25, 25 }, { 0x0115, 15, 12 }, { 0x0116, 29, 27 }, { 0x0117, 15, 12 }, { 0x0118, 29, 27 }, // U+0150
+    { 0x0119, 15, 12 }, { 0x011A, 29, 0 }, { 0x011B, 16, 15 }, { 0x011C, 30, 28 }, { 0x011D, 16, 15 }, { 0x011E, 30, 28 }, { 0x011F, 16, 15 }, { 0x0120, 30, 28 }, // U+0158
+    { 0x0121, 16, 15 }, { 0x0122, 30, 28 }, { 0x0123, 17, 16 }, { 0x0124, 0, 29 }, { 0x0125, 17, 16 }, { 0x0126, 39, 29 }, { 0x0127, 17, 16 }, { 0x0128, 0, 29 }, // U+0160
+    { 0x0129, 18, 17 }, { 0x012A, 0, 30 }, { 0x012B, 18, 17 }, { 0x012C, 0, 30 }, { 0x012D, 18, 17 }, { 0x012E, 0, 30 }, { 0x012F, 18, 17 }, { 0x0130, 0, 30 }, // U+0168
+    { 0x0131, 18, 17 }, { 0x0132, 0, 30 }, { 0x0133, 18, 17 }, { 0x0134, 0, 30 }, { 0x0135, 20, 19 }, { 0x0136, 32, 32 }, { 0x0137, 22, 21 }, { 0x0138, 33, 34 }, // U+0170
+    { 0x0139, 22, 21 }, { 0x013A, 0, 22 }, { 0x013B, 0, 35 }, { 0x013C, 0, 22 }, { 0x013D, 0, 35 }, { 0x013E, 0, 22 }, { 0x013F, 0, 35 }, { 0x0140, 0, 0 }, // U+0178
+    { 0x0211, 0, 0 }, { 0x0212, 0, 0 }, { 0x0213, 44, 41 }, { 0x0214, 0, 0 }, { 0x0215, 0, 0 }, { 0x0216, 0, 0 }, { 0x0217, 0, 0 }, { 0x0218, 0, 0 }, // U+0400
+    { 0x0219, 0, 0 }, { 0x021A, 45, 0 }, { 0x021B, 45, 0 }, { 0x021C, 0, 41 }, { 0x021D, 0, 0 }, { 0x021E, 0, 0 }, { 0x021F, 46, 42 }, { 0x0220, 0, 0 }, // U+0408
+    { 0x0221, 0, 0 }, { 0x0222, 0, 0 }, { 0x0223, 0, 0 }, { 0x0224, 0, 0 }, { 0x0225, 0, 0 }, { 0x0226, 0, 0 }, { 0x0227, 0, 41 }, { 0x0228, 0, 0 }, // U+0410
+    { 0x0229, 0, 0 }, { 0x022A, 0, 0 }, { 0x022B, 0, 0 }, { 0x022C, 0, 0 }, { 0x022D, 0, 0 }, { 0x022E, 0, 0 }, { 0x022F, 0, 0 }, { 0x0230, 0, 0 }, // U+0418
+    { 0x0231, 0, 0 }, { 0x0232, 0, 0 }, { 0x0233, 0, 41 }, { 0x0234, 46, 42 }, { 0x0235, 0, 0 }, { 0x0236, 0, 41 }, { 0x0237, 0, 0 }, { 0x0238, 0, 43 }, // U+0420
+    { 0x0239, 0, 0 }, { 0x023A, 0, 0 }, { 0x023B, 45, 41 }, { 0x023C, 0, 0 }, { 0x023D, 45, 0 }, { 0x023E, 0, 0 }, { 0x023F, 0, 0 }, { 0x0240, 0, 44 }, // U+0428
+    { 0x0241, 0, 0 }, { 0x0242, 47, 45 }, { 0x0243, 0, 0 }, { 0x0244, 0, 0 }, { 0x0245, 0, 0 }, { 0x0246, 0, 0 }, { 0x0247, 0, 46 }, { 0x0248, 0, 0 }, // U+0430
+    { 0x0249, 0, 0 }, { 0x024A, 0, 0 }, { 0x024B, 0, 0 }, { 0x024C, 0, 0 }, { 0x024D, 0, 0 }, { 0x024E, 0, 0 }, { 0x024F, 48, 0 }, { 0x0250, 0, 0 }, // U+0438
+    { 0x0251, 48, 0 }, { 0x0252, 0, 0 }, { 0x0253, 0, 0 }, { 0x0254, 0, 47 }, { 0x0255, 49, 0 }, { 0x0256, 0, 46 }, { 0x0257, 0, 0 }, { 0x0258, 0, 48 }, // U+0440
+    { 0x0259, 0, 0 }, { 0x025A, 0, 0 }, { 0x025B, 0, 0 }, { 0x025C, 0, 0 }, { 0x025D, 0, 0 }, { 0x025E, 49, 0 }, { 0x025F, 49, 0 }, { 0x0260, 0, 0 }, // U+0448
+    { 0x0261, 0, 0 }, { 0x0262, 0, 49 }, { 0x0263, 0, 0 }, { 0x0264, 0, 0 }, { 0x0265, 0, 0 }, { 0x0266, 0, 0 }, { 0x0267, 0, 50 }, { 0x0268, 50, 51 }, // U+0450
+    { 0x0269, 0, 0 }, { 0x026A, 0, 0 }, { 0x026B, 0, 0 }, { 0x026C, 0, 0 }, { 0x026D, 0, 0 }, { 0x026E, 0, 0 }, { 0x026F, 0, 47 }, { 0x0270, 0, 0 }, // U+0458
+};
+
 static const EpdFontData notoserif_18_regular = {
     notoserif_18_regularBitmaps,
     notoserif_18_regularGlyphs,
     notoserif_18_regularIntervals,
-    20,
+    18,
     51,
     41,
     -11,
     true,
     notoserif_18_regularGroups,
-    13,
-    nullptr,
+    14,
+    notoserif_18_regularGlyphToGroup,
     notoserif_18_regularKernLeftClasses,
     notoserif_18_regularKernRightClasses,
     notoserif_18_regularKernMatrix,
@@ -4839,4 +4943,8 @@ static const EpdFontData notoserif_18_regular = {
     66,
     notoserif_18_regularLigaturePairs,
     5,
+    notoserif_18_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -2149,8 +2149,7 @@ static const EpdUnicodeInterval ubuntu_10_boldIntervals[] = {
     { 0xD, 0xD, 0x3 },
     { 0x1D, 0x1D, 0x4 },
     { 0x20, 0x7E, 0x5 },
-    { 0xA0, 0xFF, 0x64 },
-    { 0x100, 0x17F, 0xC4 },
+    { 0xA0, 0x17F, 0x64 },
     { 0x1A0, 0x1A1, 0x144 },
     { 0x1AF, 0x1B0, 0x146 },
     { 0x1C4, 0x21F, 0x148 },
@@ -3514,11 +3513,74 @@ static const EpdLigaturePair ubuntu_10_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry ubuntu_10_boldGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0x0001, 0, 0 }, { 0x0002, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0003, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0004, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0005, 0, 0 }, { 0x0006, 0, 1 }, { 0x0007, 1, 2 }, { 0x0008, 0, 0 }, { 0x0009, 0, 0 }, { 0x000A, 0, 0 }, { 0x000B, 2, 3 }, { 0x000C, 1, 2 }, // U+0020
+    { 0x000D, 3, 4 }, { 0x000E, 4, 5 }, { 0x000F, 5, 6 }, { 0x0010, 0, 0 }, { 0x0011, 6, 7 }, { 0x0012, 7, 8 }, { 0x0013, 6, 7 }, { 0x0014, 8, 9 }, // U+0028
+    { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 0 }, // U+0030
+    { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 9, 10 }, { 0x0020, 9, 10 }, { 0x0021, 0, 0 }, { 0x0022, 0, 0 }, { 0x0023, 0, 0 }, { 0x0024, 0, 11 }, // U+0038
+    { 0x0025, 10, 12 }, { 0x0026, 11, 13 }, { 0x0027, 12, 14 }, { 0x0028, 13, 15 }, { 0x0029, 14, 14 }, { 0x002A, 15, 14 }, { 0x002B, 16, 14 }, { 0x002C, 17, 16 }, // U+0040
+    { 0x002D, 18, 14 }, { 0x002E, 18, 14 }, { 0x002F, 19, 17 }, { 0x0030, 20, 14 }, { 0x0031, 21, 14 }, { 0x0032, 22, 18 }, { 0x0033, 18, 14 }, { 0x0034, 23, 19 }, // U+0048
+    { 0x0035, 24, 14 }, { 0x0036, 25, 19 }, { 0x0037, 26, 14 }, { 0x0038, 27, 20 }, { 0x0039, 28, 21 }, { 0x003A, 29, 22 }, { 0x003B, 30, 23 }, { 0x003C, 31, 24 }, // U+0050
+    { 0x003D, 32, 25 }, { 0x003E, 33, 26 }, { 0x003F, 34, 27 }, { 0x0040, 35, 28 }, { 0x0041, 36, 29 }, { 0x0042, 37, 30 }, { 0x0043, 0, 0 }, { 0x0044, 0, 0 }, // U+0058
+    { 0x0045, 0, 0 }, { 0x0046, 38, 31 }, { 0x0047, 39, 32 }, { 0x0048, 40, 33 }, { 0x0049, 41, 34 }, { 0x004A, 0, 33 }, { 0x004B, 42, 35 }, { 0x004C, 43, 33 }, // U+0060
+    { 0x004D, 44, 36 }, { 0x004E, 45, 37 }, { 0x004F, 46, 38 }, { 0x0050, 47, 36 }, { 0x0051, 48, 36 }, { 0x0052, 49, 39 }, { 0x0053, 49, 39 }, { 0x0054, 50, 34 }, // U+0068
+    { 0x0055, 39, 39 }, { 0x0056, 51, 33 }, { 0x0057, 52, 39 }, { 0x0058, 53, 40 }, { 0x0059, 54, 41 }, { 0x005A, 55, 42 }, { 0x005B, 56, 43 }, { 0x005C, 57, 44 }, // U+0070
+    { 0x005D, 58, 45 }, { 0x005E, 59, 46 }, { 0x005F, 60, 47 }, { 0x0060, 61, 48 }, { 0x0061, 0, 0 }, { 0x0062, 62, 49 }, { 0x0063, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0064, 0, 0 }, { 0x0065, 63, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, // U+00A0
+    { 0x006C, 0, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 64, 50 }, { 0x0070, 0, 0 }, { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, // U+00A8
+    { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, // U+00B0
+    { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 65, 51 }, { 0x0080, 0, 0 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 66, 0 }, // U+00B8
+    { 0x0084, 11, 13 }, { 0x0085, 11, 13 }, { 0x0086, 11, 13 }, { 0x0087, 11, 13 }, { 0x0088, 11, 13 }, { 0x0089, 11, 13 }, { 0x008A, 15, 52 }, { 0x008B, 13, 15 }, // U+00C0
+    { 0x008C, 15, 14 }, { 0x008D, 15, 14 }, { 0x008E, 15, 14 }, { 0x008F, 15, 14 }, { 0x0090, 18, 14 }, { 0x0091, 18, 14 }, { 0x0092, 18, 14 }, { 0x0093, 18, 14 }, // U+00C8
+    { 0x0094, 14, 14 }, { 0x0095, 18, 14 }, { 0x0096, 23, 19 }, { 0x0097, 23, 19 }, { 0x0098, 23, 19 }, { 0x0099, 23, 19 }, { 0x009A, 23, 19 }, { 0x009B, 0, 0 }, // U+00D0
+    { 0x009C, 23, 19 }, { 0x009D, 29, 22 }, { 0x009E, 29, 22 }, { 0x009F, 29, 22 }, { 0x00A0, 29, 22 }, { 0x00A1, 33, 26 }, { 0x00A2, 67, 0 }, { 0x00A3, 68, 53 }, // U+00D8
+    { 0x00A4, 38, 31 }, { 0x00A5, 38, 31 }, { 0x00A6, 38, 31 }, { 0x00A7, 38, 31 }, { 0x00A8, 38, 54 }, { 0x00A9, 38, 31 }, { 0x00AA, 0, 31 }, { 0x00AB, 40, 33 }, // U+00E0
+    { 0x00AC, 0, 33 }, { 0x00AD, 0, 33 }, { 0x00AE, 0, 33 }, { 0x00AF, 0, 33 }, { 0x00B0, 45, 55 }, { 0x00B1, 45, 37 }, { 0x00B2, 45, 56 }, { 0x00B3, 45, 57 }, // U+00E8
+    { 0x00B4, 69, 58 }, { 0x00B5, 49, 39 }, { 0x00B6, 50, 34 }, { 0x00B7, 50, 34 }, { 0x00B8, 50, 34 }, { 0x00B9, 50, 34 }, { 0x00BA, 50, 34 }, { 0x00BB, 0, 0 }, // U+00F0
+    { 0x00BC, 50, 34 }, { 0x00BD, 55, 42 }, { 0x00BE, 55, 42 }, { 0x00BF, 55, 42 }, { 0x00C0, 55, 42 }, { 0x00C1, 59, 46 }, { 0x00C2, 70, 0 }, { 0x00C3, 59, 46 }, // U+00F8
+    { 0x00C4, 11, 13 }, { 0x00C5, 38, 31 }, { 0x00C6, 11, 13 }, { 0x00C7, 38, 31 }, { 0x00C8, 11, 13 }, { 0x00C9, 38, 31 }, { 0x00CA, 13, 15 }, { 0x00CB, 40, 33 }, // U+0100
+    { 0x00CC, 13, 15 }, { 0x00CD, 40, 33 }, { 0x00CE, 13, 15 }, { 0x00CF, 40, 33 }, { 0x00D0, 13, 15 }, { 0x00D1, 40, 33 }, { 0x00D2, 14, 14 }, { 0x00D3, 71, 34 }, // U+0108
+    { 0x00D4, 14, 0 }, { 0x00D5, 41, 34 }, { 0x00D6, 15, 14 }, { 0x00D7, 0, 33 }, { 0x00D8, 15, 14 }, { 0x00D9, 0, 33 }, { 0x00DA, 15, 14 }, { 0x00DB, 0, 33 }, // U+0110
+    { 0x00DC, 15, 14 }, { 0x00DD, 0, 33 }, { 0x00DE, 15, 14 }, { 0x00DF, 0, 33 }, { 0x00E0, 17, 16 }, { 0x00E1, 43, 33 }, { 0x00E2, 17, 16 }, { 0x00E3, 43, 33 }, // U+0118
+    { 0x00E4, 17, 16 }, { 0x00E5, 43, 33 }, { 0x00E6, 17, 16 }, { 0x00E7, 43, 33 }, { 0x00E8, 18, 14 }, { 0x00E9, 44, 36 }, { 0x00EA, 18, 14 }, { 0x00EB, 44, 36 }, // U+0120
+    { 0x00EC, 18, 14 }, { 0x00ED, 45, 59 }, { 0x00EE, 18, 14 }, { 0x00EF, 45, 60 }, { 0x00F0, 18, 14 }, { 0x00F1, 45, 61 }, { 0x00F2, 18, 14 }, { 0x00F3, 45, 37 }, // U+0128
+    { 0x00F4, 18, 14 }, { 0x00F5, 45, 37 }, { 0x00F6, 19, 14 }, { 0x00F7, 46, 37 }, { 0x00F8, 19, 17 }, { 0x00F9, 46, 38 }, { 0x00FA, 20, 14 }, { 0x00FB, 47, 36 }, // U+0130
+    { 0x00FC, 47, 0 }, { 0x00FD, 21, 14 }, { 0x00FE, 48, 36 }, { 0x00FF, 21, 14 }, { 0x0100, 48, 36 }, { 0x0101, 21, 14 }, { 0x0102, 71, 36 }, { 0x0103, 21, 14 }, // U+0138
+    { 0x0104, 48, 36 }, { 0x0105, 21, 14 }, { 0x0106, 48, 36 }, { 0x0107, 18, 14 }, { 0x0108, 49, 39 }, { 0x0109, 18, 14 }, { 0x010A, 49, 39 }, { 0x010B, 18, 14 }, // U+0140
+    { 0x010C, 49, 39 }, { 0x010D, 49, 39 }, { 0x010E, 72, 62 }, { 0x010F, 73, 63 }, { 0x0110, 23, 19 }, { 0x0111, 50, 34 }, { 0x0112, 23, 19 }, { 0x0113, 50, 34 }, // U+0148
+    { 0x0114, 23, 19 }, { 0x0115, 50, 34 }, { 0x0116, 15, 19 }, { 0x0117, 0, 34 }, { 0x0118, 26, 14 }, { 0x0119, 52, 39 }, { 0x011A, 26, 14 }, { 0x011B, 52, 39 }, // U+0150
+    { 0x011C, 26, 14 }, { 0x011D, 52, 39 }, { 0x011E, 27, 20 }, { 0x011F, 53, 40 }, { 0x0120, 27, 20 }, { 0x0121, 53, 40 }, { 0x0122, 27, 20 }, { 0x0123, 53, 40 }, // U+0158
+    { 0x0124, 27, 20 }, { 0x0125, 53, 40 }, { 0x0126, 28, 21 }, { 0x0127, 54, 41 }, { 0x0128, 28, 21 }, { 0x0129, 54, 41 }, { 0x012A, 28, 21 }, { 0x012B, 54, 41 }, // U+0160
+    { 0x012C, 29, 22 }, { 0x012D, 55, 42 }, { 0x012E, 29, 22 }, { 0x012F, 55, 42 }, { 0x0130, 29, 22 }, { 0x0131, 55, 42 }, { 0x0132, 29, 22 }, { 0x0133, 55, 42 }, // U+0168
+    { 0x0134, 29, 22 }, { 0x0135, 55, 42 }, { 0x0136, 29, 22 }, { 0x0137, 55, 42 }, { 0x0138, 31, 24 }, { 0x0139, 57, 44 }, { 0x013A, 33, 26 }, { 0x013B, 59, 46 }, // U+0170
+    { 0x013C, 33, 26 }, { 0x013D, 34, 27 }, { 0x013E, 60, 47 }, { 0x013F, 34, 27 }, { 0x0140, 60, 47 }, { 0x0141, 34, 27 }, { 0x0142, 60, 47 }, { 0x0143, 42, 35 }, // U+0178
+    { 0x01B4, 79, 0 }, { 0x01B5, 79, 0 }, { 0x01B6, 80, 68 }, { 0x01B7, 81, 0 }, { 0x01B8, 82, 69 }, { 0x01B9, 83, 70 }, { 0x01BA, 18, 0 }, { 0x01BB, 18, 0 }, // U+0400
+    { 0x01BC, 84, 71 }, { 0x01BD, 85, 72 }, { 0x01BE, 85, 0 }, { 0x01BF, 86, 68 }, { 0x01C0, 87, 0 }, { 0x01C1, 18, 0 }, { 0x01C2, 88, 73 }, { 0x01C3, 18, 0 }, // U+0408
+    { 0x01C4, 89, 74 }, { 0x01C5, 80, 0 }, { 0x01C6, 90, 0 }, { 0x01C7, 81, 0 }, { 0x01C8, 91, 75 }, { 0x01C9, 79, 0 }, { 0x01CA, 92, 76 }, { 0x01CB, 93, 77 }, // U+0410
+    { 0x01CC, 18, 0 }, { 0x01CD, 18, 0 }, { 0x01CE, 87, 0 }, { 0x01CF, 0, 72 }, { 0x01D0, 94, 78 }, { 0x01D1, 18, 0 }, { 0x01D2, 95, 79 }, { 0x01D3, 18, 0 }, // U+0418
+    { 0x01D4, 96, 0 }, { 0x01D5, 82, 69 }, { 0x01D6, 97, 68 }, { 0x01D7, 88, 73 }, { 0x01D8, 98, 80 }, { 0x01D9, 99, 81 }, { 0x01DA, 91, 0 }, { 0x01DB, 0, 82 }, // U+0420
+    { 0x01DC, 18, 0 }, { 0x01DD, 91, 0 }, { 0x01DE, 85, 0 }, { 0x01DF, 18, 0 }, { 0x01E0, 85, 0 }, { 0x01E1, 100, 83 }, { 0x01E2, 95, 0 }, { 0x01E3, 0, 84 }, // U+0428
+    { 0x01E4, 101, 85 }, { 0x01E5, 102, 86 }, { 0x01E6, 103, 87 }, { 0x01E7, 104, 88 }, { 0x01E8, 105, 89 }, { 0x01E9, 106, 90 }, { 0x01EA, 107, 91 }, { 0x01EB, 108, 92 }, // U+0430
+    { 0x01EC, 0, 88 }, { 0x01ED, 0, 88 }, { 0x01EE, 109, 88 }, { 0x01EF, 110, 93 }, { 0x01F0, 111, 94 }, { 0x01F1, 112, 88 }, { 0x01F2, 113, 95 }, { 0x01F3, 112, 88 }, // U+0438
+    { 0x01F4, 114, 96 }, { 0x01F5, 115, 97 }, { 0x01F6, 116, 98 }, { 0x01F7, 117, 99 }, { 0x01F8, 118, 100 }, { 0x01F9, 119, 101 }, { 0x01FA, 105, 88 }, { 0x01FB, 112, 102 }, // U+0440
+    { 0x01FC, 112, 88 }, { 0x01FD, 105, 103 }, { 0x01FE, 120, 104 }, { 0x01FF, 112, 88 }, { 0x0200, 120, 88 }, { 0x0201, 121, 105 }, { 0x0202, 122, 106 }, { 0x0203, 123, 107 }, // U+0448
+    { 0x0204, 106, 90 }, { 0x0205, 106, 90 }, { 0x0206, 124, 108 }, { 0x0207, 104, 88 }, { 0x0208, 125, 109 }, { 0x0209, 126, 110 }, { 0x020A, 127, 111 }, { 0x020B, 127, 112 }, // U+0450
+    { 0x020C, 128, 113 }, { 0x020D, 120, 93 }, { 0x020E, 120, 88 }, { 0x020F, 129, 114 }, { 0x0210, 109, 88 }, { 0x0211, 0, 88 }, { 0x0212, 117, 99 }, { 0x0213, 130, 103 }, // U+0458
+};
+
 static const EpdFontData ubuntu_10_bold = {
     ubuntu_10_boldBitmaps,
     ubuntu_10_boldGlyphs,
     ubuntu_10_boldIntervals,
-    51,
+    50,
     24,
     20,
     -4,
@@ -3535,4 +3597,8 @@ static const EpdFontData ubuntu_10_bold = {
     155,
     ubuntu_10_boldLigaturePairs,
     5,
+    ubuntu_10_boldGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
@@ -2459,8 +2459,7 @@ static const EpdUnicodeInterval ubuntu_12_regularIntervals[] = {
     { 0xD, 0xD, 0x3 },
     { 0x1D, 0x1D, 0x4 },
     { 0x20, 0x7E, 0x5 },
-    { 0xA0, 0xFF, 0x64 },
-    { 0x100, 0x17F, 0xC4 },
+    { 0xA0, 0x17F, 0x64 },
     { 0x1A0, 0x1A1, 0x144 },
     { 0x1AF, 0x1B0, 0x146 },
     { 0x1C4, 0x21F, 0x148 },
@@ -3605,11 +3604,74 @@ static const EpdLigaturePair ubuntu_12_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const EpdGlyphLutEntry ubuntu_12_regularGlyphLut[] = {
+    { 0x0000, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0000
+    { 0x0001, 0, 0 }, { 0x0002, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0003, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0008
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0010
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0x0004, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0018
+    { 0x0005, 0, 0 }, { 0x0006, 0, 1 }, { 0x0007, 1, 2 }, { 0x0008, 0, 0 }, { 0x0009, 0, 0 }, { 0x000A, 0, 0 }, { 0x000B, 0, 0 }, { 0x000C, 1, 2 }, // U+0020
+    { 0x000D, 2, 3 }, { 0x000E, 3, 4 }, { 0x000F, 4, 5 }, { 0x0010, 0, 0 }, { 0x0011, 5, 6 }, { 0x0012, 6, 7 }, { 0x0013, 5, 6 }, { 0x0014, 7, 8 }, // U+0028
+    { 0x0015, 0, 0 }, { 0x0016, 0, 0 }, { 0x0017, 0, 0 }, { 0x0018, 0, 0 }, { 0x0019, 0, 0 }, { 0x001A, 0, 0 }, { 0x001B, 0, 0 }, { 0x001C, 0, 0 }, // U+0030
+    { 0x001D, 0, 0 }, { 0x001E, 0, 0 }, { 0x001F, 8, 9 }, { 0x0020, 8, 9 }, { 0x0021, 0, 0 }, { 0x0022, 0, 0 }, { 0x0023, 0, 0 }, { 0x0024, 0, 10 }, // U+0038
+    { 0x0025, 9, 11 }, { 0x0026, 10, 12 }, { 0x0027, 11, 0 }, { 0x0028, 12, 13 }, { 0x0029, 13, 0 }, { 0x002A, 14, 0 }, { 0x002B, 15, 0 }, { 0x002C, 16, 14 }, // U+0040
+    { 0x002D, 0, 0 }, { 0x002E, 0, 0 }, { 0x002F, 17, 15 }, { 0x0030, 18, 0 }, { 0x0031, 19, 0 }, { 0x0032, 20, 16 }, { 0x0033, 0, 0 }, { 0x0034, 21, 17 }, // U+0048
+    { 0x0035, 22, 0 }, { 0x0036, 23, 18 }, { 0x0037, 24, 0 }, { 0x0038, 0, 19 }, { 0x0039, 25, 20 }, { 0x003A, 26, 21 }, { 0x003B, 27, 22 }, { 0x003C, 28, 23 }, // U+0050
+    { 0x003D, 29, 24 }, { 0x003E, 30, 25 }, { 0x003F, 31, 26 }, { 0x0040, 32, 27 }, { 0x0041, 0, 28 }, { 0x0042, 33, 29 }, { 0x0043, 0, 0 }, { 0x0044, 0, 0 }, // U+0058
+    { 0x0045, 0, 0 }, { 0x0046, 34, 30 }, { 0x0047, 35, 31 }, { 0x0048, 36, 32 }, { 0x0049, 0, 33 }, { 0x004A, 0, 34 }, { 0x004B, 37, 35 }, { 0x004C, 0, 36 }, // U+0060
+    { 0x004D, 38, 31 }, { 0x004E, 0, 37 }, { 0x004F, 39, 38 }, { 0x0050, 40, 31 }, { 0x0051, 0, 39 }, { 0x0052, 41, 40 }, { 0x0053, 41, 40 }, { 0x0054, 42, 41 }, // U+0068
+    { 0x0055, 43, 40 }, { 0x0056, 44, 42 }, { 0x0057, 45, 40 }, { 0x0058, 0, 43 }, { 0x0059, 46, 44 }, { 0x005A, 0, 45 }, { 0x005B, 47, 46 }, { 0x005C, 48, 47 }, // U+0070
+    { 0x005D, 49, 48 }, { 0x005E, 0, 49 }, { 0x005F, 50, 50 }, { 0x0060, 51, 51 }, { 0x0061, 0, 0 }, { 0x0062, 52, 52 }, { 0x0063, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0078
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0080
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0088
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0090
+    { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, { 0xFFFF, 0, 0 }, // U+0098
+    { 0x0064, 0, 0 }, { 0x0065, 53, 0 }, { 0x0066, 0, 0 }, { 0x0067, 0, 0 }, { 0x0068, 0, 0 }, { 0x0069, 0, 0 }, { 0x006A, 0, 0 }, { 0x006B, 0, 0 }, // U+00A0
+    { 0x006C, 0, 0 }, { 0x006D, 0, 0 }, { 0x006E, 0, 0 }, { 0x006F, 54, 53 }, { 0x0070, 0, 0 }, { 0x0071, 0, 0 }, { 0x0072, 0, 0 }, { 0x0073, 0, 0 }, // U+00A8
+    { 0x0074, 0, 0 }, { 0x0075, 0, 0 }, { 0x0076, 0, 0 }, { 0x0077, 0, 0 }, { 0x0078, 0, 0 }, { 0x0079, 0, 0 }, { 0x007A, 0, 0 }, { 0x007B, 0, 0 }, // U+00B0
+    { 0x007C, 0, 0 }, { 0x007D, 0, 0 }, { 0x007E, 0, 0 }, { 0x007F, 55, 54 }, { 0x0080, 0, 0 }, { 0x0081, 0, 0 }, { 0x0082, 0, 0 }, { 0x0083, 56, 0 }, // U+00B8
+    { 0x0084, 10, 12 }, { 0x0085, 10, 12 }, { 0x0086, 10, 12 }, { 0x0087, 10, 12 }, { 0x0088, 10, 12 }, { 0x0089, 10, 12 }, { 0x008A, 14, 55 }, { 0x008B, 12, 13 }, // U+00C0
+    { 0x008C, 14, 0 }, { 0x008D, 14, 0 }, { 0x008E, 14, 0 }, { 0x008F, 14, 0 }, { 0x0090, 0, 0 }, { 0x0091, 0, 0 }, { 0x0092, 0, 0 }, { 0x0093, 0, 0 }, // U+00C8
+    { 0x0094, 13, 0 }, { 0x0095, 0, 0 }, { 0x0096, 21, 17 }, { 0x0097, 21, 17 }, { 0x0098, 21, 17 }, { 0x0099, 21, 17 }, { 0x009A, 21, 17 }, { 0x009B, 0, 0 }, // U+00D0
+    { 0x009C, 21, 17 }, { 0x009D, 26, 21 }, { 0x009E, 26, 21 }, { 0x009F, 26, 21 }, { 0x00A0, 26, 21 }, { 0x00A1, 30, 25 }, { 0x00A2, 57, 0 }, { 0x00A3, 58, 56 }, // U+00D8
+    { 0x00A4, 34, 30 }, { 0x00A5, 34, 30 }, { 0x00A6, 34, 30 }, { 0x00A7, 34, 30 }, { 0x00A8, 34, 30 }, { 0x00A9, 34, 30 }, { 0x00AA, 0, 30 }, { 0x00AB, 36, 32 }, // U+00E0
+    { 0x00AC, 0, 34 }, { 0x00AD, 0, 34 }, { 0x00AE, 0, 34 }, { 0x00AF, 0, 34 }, { 0x00B0, 0, 57 }, { 0x00B1, 0, 37 }, { 0x00B2, 0, 58 }, { 0x00B3, 0, 59 }, // U+00E8
+    { 0x00B4, 59, 60 }, { 0x00B5, 41, 40 }, { 0x00B6, 42, 41 }, { 0x00B7, 42, 41 }, { 0x00B8, 42, 41 }, { 0x00B9, 42, 41 }, { 0x00BA, 42, 41 }, { 0x00BB, 0, 0 }, // U+00F0
+    { 0x00BC, 42, 41 }, { 0x00BD, 0, 45 }, { 0x00BE, 0, 45 }, { 0x00BF, 0, 45 }, { 0x00C0, 0, 45 }, { 0x00C1, 0, 49 }, { 0x00C2, 60, 56 }, { 0x00C3, 0, 49 }, // U+00F8
+    { 0x00C4, 10, 12 }, { 0x00C5, 34, 30 }, { 0x00C6, 10, 12 }, { 0x00C7, 34, 30 }, { 0x00C8, 10, 12 }, { 0x00C9, 34, 30 }, { 0x00CA, 12, 13 }, { 0x00CB, 36, 32 }, // U+0100
+    { 0x00CC, 12, 13 }, { 0x00CD, 36, 32 }, { 0x00CE, 12, 13 }, { 0x00CF, 36, 32 }, { 0x00D0, 12, 13 }, { 0x00D1, 36, 32 }, { 0x00D2, 13, 0 }, { 0x00D3, 61, 33 }, // U+0108
+    { 0x00D4, 13, 0 }, { 0x00D5, 0, 33 }, { 0x00D6, 14, 0 }, { 0x00D7, 0, 34 }, { 0x00D8, 14, 0 }, { 0x00D9, 0, 34 }, { 0x00DA, 14, 0 }, { 0x00DB, 0, 34 }, // U+0110
+    { 0x00DC, 14, 0 }, { 0x00DD, 0, 34 }, { 0x00DE, 14, 0 }, { 0x00DF, 0, 34 }, { 0x00E0, 16, 14 }, { 0x00E1, 0, 36 }, { 0x00E2, 16, 14 }, { 0x00E3, 0, 36 }, // U+0118
+    { 0x00E4, 16, 14 }, { 0x00E5, 0, 36 }, { 0x00E6, 16, 14 }, { 0x00E7, 0, 36 }, { 0x00E8, 0, 0 }, { 0x00E9, 38, 31 }, { 0x00EA, 0, 0 }, { 0x00EB, 38, 31 }, // U+0120
+    { 0x00EC, 0, 0 }, { 0x00ED, 0, 61 }, { 0x00EE, 0, 0 }, { 0x00EF, 0, 62 }, { 0x00F0, 0, 0 }, { 0x00F1, 0, 63 }, { 0x00F2, 0, 0 }, { 0x00F3, 0, 37 }, // U+0128
+    { 0x00F4, 0, 0 }, { 0x00F5, 0, 37 }, { 0x00F6, 17, 0 }, { 0x00F7, 39, 37 }, { 0x00F8, 17, 15 }, { 0x00F9, 39, 38 }, { 0x00FA, 18, 0 }, { 0x00FB, 40, 31 }, // U+0130
+    { 0x00FC, 40, 0 }, { 0x00FD, 19, 0 }, { 0x00FE, 0, 39 }, { 0x00FF, 19, 0 }, { 0x0100, 0, 39 }, { 0x0101, 19, 0 }, { 0x0102, 61, 39 }, { 0x0103, 19, 0 }, // U+0138
+    { 0x0104, 0, 39 }, { 0x0105, 19, 0 }, { 0x0106, 0, 39 }, { 0x0107, 0, 0 }, { 0x0108, 41, 40 }, { 0x0109, 0, 0 }, { 0x010A, 41, 40 }, { 0x010B, 0, 0 }, // U+0140
+    { 0x010C, 41, 40 }, { 0x010D, 41, 40 }, { 0x010E, 62, 64 }, { 0x010F, 63, 65 }, { 0x0110, 21, 17 }, { 0x0111, 42, 41 }, { 0x0112, 21, 17 }, { 0x0113, 42, 41 }, // U+0148
+    { 0x0114, 21, 17 }, { 0x0115, 42, 41 }, { 0x0116, 14, 17 }, { 0x0117, 0, 41 }, { 0x0118, 24, 0 }, { 0x0119, 45, 40 }, { 0x011A, 24, 0 }, { 0x011B, 45, 40 }, // U+0150
+    { 0x011C, 24, 0 }, { 0x011D, 45, 40 }, { 0x011E, 0, 19 }, { 0x011F, 0, 43 }, { 0x0120, 0, 19 }, { 0x0121, 0, 43 }, { 0x0122, 0, 19 }, { 0x0123, 0, 43 }, // U+0158
+    { 0x0124, 0, 19 }, { 0x0125, 0, 43 }, { 0x0126, 25, 20 }, { 0x0127, 46, 44 }, { 0x0128, 25, 20 }, { 0x0129, 46, 44 }, { 0x012A, 25, 20 }, { 0x012B, 46, 44 }, // U+0160
+    { 0x012C, 26, 21 }, { 0x012D, 0, 45 }, { 0x012E, 26, 21 }, { 0x012F, 0, 45 }, { 0x0130, 26, 21 }, { 0x0131, 0, 45 }, { 0x0132, 26, 21 }, { 0x0133, 0, 45 }, // U+0168
+    { 0x0134, 26, 21 }, { 0x0135, 0, 45 }, { 0x0136, 26, 21 }, { 0x0137, 0, 45 }, { 0x0138, 28, 23 }, { 0x0139, 48, 47 }, { 0x013A, 30, 25 }, { 0x013B, 0, 49 }, // U+0170
+    { 0x013C, 30, 25 }, { 0x013D, 31, 26 }, { 0x013E, 50, 50 }, { 0x013F, 31, 26 }, { 0x0140, 50, 50 }, { 0x0141, 31, 26 }, { 0x0142, 50, 50 }, { 0x0143, 37, 35 }, // U+0178
+    { 0x01B4, 67, 0 }, { 0x01B5, 67, 0 }, { 0x01B6, 68, 71 }, { 0x01B7, 69, 0 }, { 0x01B8, 70, 72 }, { 0x01B9, 71, 73 }, { 0x01BA, 0, 0 }, { 0x01BB, 0, 0 }, // U+0400
+    { 0x01BC, 0, 74 }, { 0x01BD, 0, 75 }, { 0x01BE, 0, 0 }, { 0x01BF, 72, 71 }, { 0x01C0, 73, 0 }, { 0x01C1, 0, 0 }, { 0x01C2, 74, 76 }, { 0x01C3, 0, 0 }, // U+0408
+    { 0x01C4, 75, 77 }, { 0x01C5, 68, 0 }, { 0x01C6, 76, 0 }, { 0x01C7, 69, 0 }, { 0x01C8, 77, 78 }, { 0x01C9, 67, 0 }, { 0x01CA, 0, 79 }, { 0x01CB, 78, 80 }, // U+0410
+    { 0x01CC, 0, 0 }, { 0x01CD, 0, 0 }, { 0x01CE, 73, 0 }, { 0x01CF, 0, 75 }, { 0x01D0, 79, 81 }, { 0x01D1, 0, 0 }, { 0x01D2, 80, 82 }, { 0x01D3, 0, 0 }, // U+0418
+    { 0x01D4, 81, 0 }, { 0x01D5, 70, 72 }, { 0x01D6, 82, 71 }, { 0x01D7, 74, 76 }, { 0x01D8, 83, 83 }, { 0x01D9, 84, 84 }, { 0x01DA, 85, 0 }, { 0x01DB, 0, 85 }, // U+0420
+    { 0x01DC, 0, 0 }, { 0x01DD, 85, 0 }, { 0x01DE, 0, 71 }, { 0x01DF, 0, 0 }, { 0x01E0, 0, 0 }, { 0x01E1, 86, 86 }, { 0x01E2, 80, 0 }, { 0x01E3, 0, 87 }, // U+0428
+    { 0x01E4, 87, 88 }, { 0x01E5, 88, 89 }, { 0x01E6, 89, 90 }, { 0x01E7, 90, 91 }, { 0x01E8, 91, 92 }, { 0x01E9, 92, 93 }, { 0x01EA, 93, 94 }, { 0x01EB, 94, 95 }, // U+0430
+    { 0x01EC, 0, 91 }, { 0x01ED, 0, 91 }, { 0x01EE, 95, 91 }, { 0x01EF, 0, 96 }, { 0x01F0, 0, 97 }, { 0x01F1, 0, 91 }, { 0x01F2, 96, 98 }, { 0x01F3, 0, 91 }, // U+0438
+    { 0x01F4, 97, 99 }, { 0x01F5, 98, 100 }, { 0x01F6, 99, 101 }, { 0x01F7, 100, 102 }, { 0x01F8, 101, 103 }, { 0x01F9, 102, 104 }, { 0x01FA, 103, 91 }, { 0x01FB, 0, 105 }, // U+0440
+    { 0x01FC, 0, 91 }, { 0x01FD, 103, 106 }, { 0x01FE, 104, 107 }, { 0x01FF, 0, 91 }, { 0x0200, 104, 91 }, { 0x0201, 105, 108 }, { 0x0202, 106, 90 }, { 0x0203, 0, 109 }, // U+0448
+    { 0x0204, 92, 93 }, { 0x0205, 92, 93 }, { 0x0206, 107, 110 }, { 0x0207, 90, 91 }, { 0x0208, 108, 111 }, { 0x0209, 109, 112 }, { 0x020A, 0, 113 }, { 0x020B, 0, 114 }, // U+0450
+    { 0x020C, 0, 115 }, { 0x020D, 104, 96 }, { 0x020E, 104, 91 }, { 0x020F, 110, 116 }, { 0x0210, 95, 91 }, { 0x0211, 0, 91 }, { 0x0212, 100, 102 }, { 0x0213, 0, 106 }, // U+0458
+};
+
 static const EpdFontData ubuntu_12_regular = {
     ubuntu_12_regularBitmaps,
     ubuntu_12_regularGlyphs,
     ubuntu_12_regularIntervals,
-    51,
+    50,
     29,
     24,
     -5,
@@ -3626,4 +3688,8 @@ static const EpdFontData ubuntu_12_regular = {
     158,
     ubuntu_12_regularLigaturePairs,
     5,
+    ubuntu_12_regularGlyphLut,
+    EPD_BITMAP_PACKED,
+    nullptr,
+    nullptr,
 };
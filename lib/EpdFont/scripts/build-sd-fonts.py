@@ -48,6 +48,9 @@ DEFAULT_OUTPUT = SCRIPT_DIR / "output"
 DOWNLOAD_DIR = SCRIPT_DIR / "downloaded_fonts"
 INSTANCE_DIR = SCRIPT_DIR / "instanced_fonts"
 DEFAULT_FALLBACK_FONT = EPDFONTS_DIR / "builtinFonts/source/NotoSans/NotoSans-Regular.ttf"
+# English prose; it only matches the glyph frequencies of Latin-only families
+DEFAULT_BITMAP_ORDER_CORPUS = ["hot-glyph-corpus.txt"]
+LATIN_INTERVAL_PRESETS = {"ascii", "latin1", "latin-ext", "punctuation"}
 
 
 _orig_getaddrinfo = socket.getaddrinfo
@@ -185,6 +188,16 @@ def _stream_pipe(pipe, prefix: str, dest: list[str]):
         print(f"  [{prefix}] {line}", end="", flush=True)
 
 
+def bitmap_order_corpus(family: dict) -> list[str]:
+    """Corpus files the family's bitmaps are ordered by. Families covering other
+    scripts keep codepoint order unless they list corpora in their target languages:
+    an English corpus would only move Latin glyphs to the front of their files."""
+    if "bitmap_order_corpus" in family:
+        return family["bitmap_order_corpus"]
+    presets = {p.strip() for p in family["intervals"].split(",")}
+    return DEFAULT_BITMAP_ORDER_CORPUS if presets <= LATIN_INTERVAL_PRESETS else []
+
+
 def build_family(
     family: dict, output_base: Path, verbose: bool = False, timeout: int = 600
 ) -> tuple[str, bool, str]:
@@ -232,6 +245,9 @@ def build_family(
     if family.get("force_autohint", False):
         cmd.append("--force-autohint")
 
+    for corpus in bitmap_order_corpus(family):
+        cmd.extend(["--bitmap-order-corpus", str(SCRIPT_DIR / corpus)])
+
     # Run fontconvert_sdcard.py
     start = time.monotonic()
     try:
@@ -4,7 +4,7 @@ import sys
 import re
 import math
 import argparse
-from collections import namedtuple
+from collections import Counter, namedtuple
 
 # Force UTF-8 stdout so that `python fontconvert.py … > foo.h` on Windows
 # (default cp1252) doesn't emit UTF-16 LE / replacement chars in the generated
@@ -21,6 +21,9 @@ parser.add_argument("fontstack", action="store", nargs='+', help="list of font f
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="Compress glyph bitmaps using DEFLATE with group-based compression.")
+parser.add_argument("--rle", dest="rle", action="store_true", help="Run-length encode each glyph bitmap on its own (alternative to --compress). Any glyph decodes directly without inflating a group, at roughly twice the flash size of --compress.")
+parser.add_argument("--hot-group-corpus", dest="hot_group_corpus", action="append", help="UTF-8 text file to measure glyph frequency from (with --compress). The most frequent glyphs form group 0, which the firmware keeps resident across pages; the rest keep script grouping. This argument can be repeated.")
+parser.add_argument("--hot-group-bytes", dest="hot_group_bytes", type=int, default=16384, help="Uncompressed size cap of the --hot-group-corpus group (default: 16384, the firmware's resident group limit).")
 parser.add_argument("--force-autohint", dest="force_autohint", action="store_true", help="Force FreeType auto-hinter instead of native font hinting. Improves stem width consistency for fonts with weak or no native TrueType hints.")
 parser.add_argument("--pnum", dest="pnum", action="store_true", help="Use proportional numerals (pnum OpenType feature) instead of default tabular figures. Reduces visual gaps between digits in running prose.")
 args = parser.parse_args()
@@ -761,6 +764,7 @@ ligature_pairs = sorted(unique_ligature_pairs, key=lambda p: p[0])
 print(f"ligatures: {len(ligature_pairs)} pairs extracted", file=sys.stderr)
 
 compress = args.compress
+rle = args.rle
 
 
 def to_byte_aligned(packed, width, height):
@@ -790,6 +794,60 @@ def to_byte_aligned(packed, width, height):
     return bytes(aligned)
 
 
+def rle_encode_glyph(packed, width, height):
+    """Encode one packed 2-bit glyph bitmap as a nibble run-length stream.
+
+    The format is documented in lib/EpdFont/GlyphRle.h: gray pixels are single nibbles,
+    short white/black runs one nibble, longer ones two or three. The stream is padded to
+    a whole byte so every glyph starts byte-aligned at its own dataOffset.
+    """
+    count = width * height
+    pixels = [(packed[i // 4] >> ((3 - i % 4) * 2)) & 0x3 for i in range(count)]
+    nibbles = []
+    i = 0
+    while i < count:
+        value = pixels[i]
+        run = 1
+        while i + run < count and pixels[i + run] == value:
+            run += 1
+        i += run
+        while run > 0:
+            if value in (1, 2):
+                nibbles.append(value - 1)
+                run -= 1
+                continue
+            short_base, short_max, extended = (0x2, 6, 0x8) if value == 0 else (0x9, 5, 0xE)
+            if run <= short_max:
+                nibbles.append(short_base + run - 1)
+                taken = run
+            elif run <= short_max + 16:
+                nibbles += [extended, run - short_max - 1]
+                taken = run
+            else:
+                taken = min(run, 128)
+                code = (0x80 if value == 3 else 0) | (taken - 1)
+                nibbles += [0xF, code >> 4, code & 0xF]
+            run -= taken
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[j] << 4) | nibbles[j + 1] for j in range(0, len(nibbles), 2))
+
+
+if compress and rle:
+    print("Error: --compress and --rle are alternative bitmap encodings; pick one", file=sys.stderr)
+    sys.exit(1)
+if rle and not is2Bit:
+    print("Error: --rle requires --2bit", file=sys.stderr)
+    sys.exit(1)
+if rle:
+    # dataOffset points at the glyph's own stream; dataLength keeps the packed size, which is
+    # what the firmware allocates when decoding.
+    rle_bitmap_data = []
+    for gi, (props, packed) in enumerate(all_glyphs):
+        glyph_props[gi] = glyph_props[gi]._replace(data_offset=len(rle_bitmap_data))
+        rle_bitmap_data.extend(rle_encode_glyph(packed, props.width, props.height))
+    print(f"// RLE: {len(glyph_data)} -> {len(rle_bitmap_data)} bytes ({100*len(rle_bitmap_data)/len(glyph_data):.1f}%)", file=sys.stderr)
+
 # Build groups for compression
 if compress and not is2Bit:
     print("Error: --compress requires --2bit (byte-aligned compression only supports 2-bit format)", file=sys.stderr)
@@ -836,41 +894,80 @@ if compress:
                 return i
         return -1
 
-    groups = []  # list of (first_glyph_index, glyph_count)
+    def glyph_aligned_size(props):
+        # Use the byte-aligned size (4-pixel-aligned row stride) rather than
+        # the packed length, since the decompressor consumes byte-aligned
+        # buffers. Empty glyphs contribute zero.
+        return ((props.width + 3) // 4) * props.height if props.width > 0 and props.height > 0 else 0
+
+    # Frequency-ordered hot group: with --hot-group-corpus, the glyphs that
+    # cover most running text form group 0, most frequent first, up to
+    # --hot-group-bytes uncompressed. The firmware keeps group 0 of each active
+    # style resident across pages, so a typical page only inflates a cold group
+    # when it uses a rarer glyph. Group 0 is not contiguous in the glyph array,
+    # so these fonts emit a glyphToGroup table.
+    hot_glyphs = set()
+    if args.hot_group_corpus:
+        # Count the glyphs rendering actually draws: ligatures are applied
+        # greedily left to right, as EpdFont::applyLigatures() does.
+        ligature_map = dict(ligature_pairs)
+        cp_counts = Counter()
+        for corpus_path in args.hot_group_corpus:
+            with open(corpus_path, encoding="utf-8") as f:
+                text = [ord(c) for c in f.read()]
+            pos = 0
+            while pos < len(text):
+                code_point = text[pos]
+                pos += 1
+                while pos < len(text) and ((code_point << 16) | text[pos]) in ligature_map:
+                    code_point = ligature_map[(code_point << 16) | text[pos]]
+                    pos += 1
+                cp_counts[code_point] += 1
+        ranked = sorted((i for i, (props, _) in enumerate(all_glyphs) if cp_counts[props.code_point] > 0),
+                        key=lambda i: (-cp_counts[all_glyphs[i][0].code_point], i))
+        hot_cap = min(args.hot_group_bytes, GROUP_MAX_UNCOMPRESSED_BYTES)
+        hot_bytes = 0
+        for i in ranked:
+            glyph_size = glyph_aligned_size(all_glyphs[i][0])
+            if hot_bytes + glyph_size > hot_cap:
+                break
+            hot_glyphs.add(i)
+            hot_bytes += glyph_size
+        print(f"// Hot group: {len(hot_glyphs)} glyphs, {hot_bytes} bytes uncompressed", file=sys.stderr)
+
+    groups = []  # list of glyph index lists, each ascending
+    if hot_glyphs:
+        groups.append(sorted(hot_glyphs))
     current_group_id = None
-    group_start = 0
-    group_count = 0
+    group_members = []
     group_uncompressed = 0
 
     for i, (props, _) in enumerate(all_glyphs):
+        if i in hot_glyphs:
+            continue
         sg = get_script_group(props.code_point)
-        # Use the byte-aligned size (4-pixel-aligned row stride) rather than
-        # the packed length, since the decompressor consumes byte-aligned
-        # buffers. Empty glyphs contribute zero.
-        glyph_aligned_size = (((props.width + 3) // 4) * props.height
-                              if props.width > 0 and props.height > 0 else 0)
-        if glyph_aligned_size > GROUP_MAX_UNCOMPRESSED_BYTES:
+        glyph_size = glyph_aligned_size(props)
+        if glyph_size > GROUP_MAX_UNCOMPRESSED_BYTES:
             raise ValueError(
                 f"Glyph {i} (code point U+{props.code_point:04X}) byte-aligned size "
-                f"{glyph_aligned_size} exceeds GROUP_MAX_UNCOMPRESSED_BYTES="
+                f"{glyph_size} exceeds GROUP_MAX_UNCOMPRESSED_BYTES="
                 f"{GROUP_MAX_UNCOMPRESSED_BYTES}. Consider: (1) increasing GROUP_MAX_UNCOMPRESSED_BYTES, "
                 f"(2) reducing font size, or (3) excluding this codepoint."  
             )
-        size_overflow = group_uncompressed + glyph_aligned_size > GROUP_MAX_UNCOMPRESSED_BYTES
+        size_overflow = group_uncompressed + glyph_size > GROUP_MAX_UNCOMPRESSED_BYTES
 
         if sg != current_group_id or size_overflow:
-            if group_count > 0:
-                groups.append((group_start, group_count))
+            if group_members:
+                groups.append(group_members)
             current_group_id = sg
-            group_start = i
-            group_count = 1
-            group_uncompressed = glyph_aligned_size
+            group_members = [i]
+            group_uncompressed = glyph_size
         else:
-            group_count += 1
-            group_uncompressed += glyph_aligned_size
+            group_members.append(i)
+            group_uncompressed += glyph_size
 
-    if group_count > 0:
-        groups.append((group_start, group_count))
+    if group_members:
+        groups.append(group_members)
 
     # Compress each group
     compressed_groups = []  # list of (compressed_bytes, uncompressed_size, glyph_count, first_glyph_index)
@@ -880,11 +977,11 @@ if compress:
     # Also build modified glyph props with within-group offsets
     modified_glyph_props = list(glyph_props)
 
-    for first_idx, count in groups:
+    for members in groups:
         # Concatenate bitmap data for this group
         packed_len = 0
         group_aligned = bytearray()
-        for gi in range(first_idx, first_idx + count):
+        for gi in members:
             props, packed = all_glyphs[gi]
             # Update glyph's dataOffset to be within-group offset (packed offset)
             within_group_offset = packed_len
@@ -906,7 +1003,7 @@ if compress:
         compressor = zlib.compressobj(level=9, wbits=-15)
         compressed = compressor.compress(bytes(group_aligned)) + compressor.flush()
 
-        compressed_groups.append((compressed, len(group_aligned), count, first_idx))
+        compressed_groups.append((compressed, len(group_aligned), len(members), members[0]))
         compressed_bitmap_data.extend(compressed)
         compressed_offset += len(compressed)
 
@@ -919,7 +1016,7 @@ print(f"""/**
  * generated by fontconvert.py
  * name: {font_name}
  * size: {size}
- * mode: {'2-bit' if is2Bit else '1-bit'}{'  compressed: true' if compress else ''}
+ * mode: {'2-bit' if is2Bit else '1-bit'}{'  compressed: true' if compress else ''}{'  rle: true' if rle else ''}
  * Command used: {' '.join(sys.argv)}
  */
 #pragma once
@@ -931,6 +1028,11 @@ if compress:
     for c in chunks(compressed_bitmap_data, 16):
         print ("    " + " ".join(f"0x{b:02X}," for b in c))
     print ("};\n");
+elif rle:
+    print(f"static const uint8_t {font_name}Bitmaps[{len(rle_bitmap_data)}] = {{")
+    for c in chunks(rle_bitmap_data, 16):
+        print ("    " + " ".join(f"0x{b:02X}," for b in c))
+    print ("};\n");
 else:
     print(f"static const uint8_t {font_name}Bitmaps[{len(glyph_data)}] = {{")
     for c in chunks(glyph_data, 16):
@@ -962,6 +1064,16 @@ if compress:
         compressed_offset += len(compressed)
     print("};\n")
 
+    if hot_glyphs:
+        glyph_to_group = [0] * len(glyph_props)
+        for group_id, members in enumerate(groups):
+            for gi in members:
+                glyph_to_group[gi] = group_id
+        print(f"static const uint16_t {font_name}GlyphToGroup[] = {{")
+        for c in chunks(glyph_to_group, 32):
+            print("    " + " ".join(f"{g}," for g in c))
+        print("};\n")
+
 if kern_map:
     print(f"static const EpdKernClassEntry {font_name}KernLeftClasses[] = {{")
     for cp, cls in kern_left_classes:
@@ -986,6 +1098,33 @@ if ligature_pairs:
         print(f"    {{ 0x{packed_pair:08X}, 0x{lig_cp:04X} }}, // {cp_label(packed_pair >> 16)} {cp_label(packed_pair & 0xFFFF)} -> {cp_label(lig_cp)}")
     print("};\n")
 
+# Direct-index table for the hot codepoint ranges: glyph index plus left/right kern
+# class per codepoint. Ranges and slot order must match epdGlyphLutSlot() in EpdFontData.h.
+GLYPH_LUT_RANGES = [(0x0000, 0x017F), (0x0400, 0x045F)]
+GLYPH_LUT_NONE = 0xFFFF
+
+glyph_index_by_cp = {}
+offset = 0
+for i_start, i_end in intervals:
+    for code_point in range(i_start, i_end + 1):
+        glyph_index_by_cp[code_point] = offset + (code_point - i_start)
+    offset += i_end - i_start + 1
+if offset >= GLYPH_LUT_NONE:
+    print(f"Error: {offset} glyphs do not fit the 16-bit glyph lookup table", file=sys.stderr)
+    sys.exit(1)
+left_class_by_cp = dict(kern_left_classes)
+right_class_by_cp = dict(kern_right_classes)
+glyph_lut = []
+for r_start, r_end in GLYPH_LUT_RANGES:
+    for code_point in range(r_start, r_end + 1):
+        glyph_lut.append((code_point, glyph_index_by_cp.get(code_point, GLYPH_LUT_NONE),
+                          left_class_by_cp.get(code_point, 0), right_class_by_cp.get(code_point, 0)))
+
+print(f"static const EpdGlyphLutEntry {font_name}GlyphLut[] = {{")
+for c in chunks(glyph_lut, 8):
+    print("    " + " ".join(f"{{ 0x{g:04X}, {lc}, {rc} }}," for _, g, lc, rc in c) + f" // U+{c[0][0]:04X}")
+print("};\n")
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -1001,8 +1140,11 @@ if compress:
 else:
     print("    nullptr,")
     print("    0,")
-# glyphToGroup (not used for script-grouped fonts)
-print("    nullptr,")
+# glyphToGroup (only for fonts with a frequency-ordered hot group)
+if compress and hot_glyphs:
+    print(f"    {font_name}GlyphToGroup,")
+else:
+    print("    nullptr,")
 if kern_map:
     print(f"    {font_name}KernLeftClasses,")
     print(f"    {font_name}KernRightClasses,")
@@ -1025,4 +1167,9 @@ if ligature_pairs:
 else:
     print(f"    nullptr,")
     print(f"    0,")
+print(f"    {font_name}GlyphLut,")
+print(f"    {'EPD_BITMAP_RLE' if rle else 'EPD_BITMAP_PACKED'},")
+# glyphMissHandler, glyphMissCtx: only SD card fonts load glyphs on demand
+print("    nullptr,")
+print("    nullptr,")
 print("};")
@@ -30,7 +30,7 @@ import os
 import re
 import math
 import argparse
-from collections import namedtuple
+from collections import Counter, namedtuple
 
 from cpfont_version import CPFONT_VERSION
 
@@ -720,6 +720,49 @@ def rasterize_font_style(fontfile, size, intervals, style_id=0, force_autohint=F
     )
 
 
+# --- Corpus-driven bitmap order ---
+
+def count_corpus_glyphs(corpus_paths, ligature_pairs):
+    """Count how often rendering draws each codepoint over the UTF-8 corpus files.
+    Ligatures are applied greedily left to right, as EpdFont::applyLigatures() does."""
+    ligature_map = dict(ligature_pairs)
+    cp_counts = Counter()
+    for corpus_path in corpus_paths:
+        with open(corpus_path, encoding="utf-8") as f:
+            text = [ord(c) for c in f.read()]
+        pos = 0
+        while pos < len(text):
+            code_point = text[pos]
+            pos += 1
+            while pos < len(text) and ((code_point << 16) | text[pos]) in ligature_map:
+                code_point = ligature_map[(code_point << 16) | text[pos]]
+                pos += 1
+            cp_counts[code_point] += 1
+    return cp_counts
+
+
+def order_bitmaps_by_corpus(sd, corpus_paths):
+    """Lay out a style's bitmaps most frequent first over the corpus, then the
+    remaining glyphs in codepoint order (which keeps each script together).
+
+    The glyph table stays indexed by codepoint; only data_offset changes. A
+    typical page's glyphs then sit in one contiguous region at the start of
+    the bitmap section plus, for rarer glyphs, their script's run, so
+    SdCardFont::prewarm() reads them in a few sequential block reads.
+    Returns (reordered StyleRasterData, number of corpus glyphs)."""
+    cp_counts = count_corpus_glyphs(corpus_paths, sd.ligature_pairs)
+    order = sorted(range(len(sd.all_glyphs)), key=lambda i: (-cp_counts[sd.all_glyphs[i][0].code_point], i))
+    offsets = [0] * len(sd.all_glyphs)
+    offset = 0
+    for i in order:
+        offsets[i] = offset
+        offset += len(sd.all_glyphs[i][1])
+    all_glyphs = [(props._replace(data_offset=offsets[i]), packed)
+                  for i, (props, packed) in enumerate(sd.all_glyphs)]
+    corpus_glyphs = sum(1 for props, _ in sd.all_glyphs if cp_counts[props.code_point] > 0)
+    return sd._replace(all_glyphs=all_glyphs), corpus_glyphs
+
+
 # --- Binary packing helpers ---
 
 # EpdGlyph struct: 16 bytes, little-endian
@@ -759,8 +802,11 @@ def pack_style_sections(sd):
     for packed_pair, lig_cp in sd.ligature_pairs:
         ligature_data += struct.pack("<II", packed_pair, lig_cp)
 
+    # Bitmaps are laid out by data_offset, which is codepoint order unless
+    # order_bitmaps_by_corpus() moved the frequent glyphs to the front.
     bitmap_data = bytearray()
-    for glyph, packed in sd.all_glyphs:
+    for glyph, packed in sorted(sd.all_glyphs, key=lambda g: g[0].data_offset):
+        assert glyph.data_offset == len(bitmap_data) or glyph.data_length == 0
         bitmap_data += packed
     assert len(bitmap_data) == sd.total_bitmap_size
 
@@ -776,16 +822,24 @@ def style_sections_total_size(sections):
 # --- File writers ---
 
 def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
-                               force_autohint=False, fallback_style_fonts=None):
+                               force_autohint=False, fallback_style_fonts=None,
+                               bitmap_order_corpus=None):
     """Generate a multi-style v4 .cpfont file.
 
     style_fonts: dict of {style_id: fontfile_path} e.g. {0: "Regular.ttf", 2: "Italic.ttf"}
     fallback_style_fonts: optional dict of {style_id: fallback_fontfile_path}
+    bitmap_order_corpus: optional list of UTF-8 text files; see order_bitmaps_by_corpus()
     """
     MAGIC = b"CPFONT\x00\x00"
     HEADER_SIZE = 32
     STYLE_TOC_ENTRY_SIZE = 32
-    flags = 1  # always 2-bit greyscale
+    # bit 0: 2-bit greyscale (always set)
+    # bit 1: bitmaps in corpus frequency order rather than codepoint order.
+    #        Informational only: glyphs locate bitmaps through data_offset, so
+    #        readers need no change and the file version stays the same.
+    flags = 1
+    if bitmap_order_corpus:
+        flags |= 2
     style_count = len(style_fonts)
 
     # Rasterize each style
@@ -799,6 +853,10 @@ def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
             fontfile, size, intervals, style_id=style_id,
             force_autohint=force_autohint,
             fallback_fontfile=fallback_fontfile)
+        if bitmap_order_corpus:
+            raster_data[style_id], corpus_glyphs = order_bitmaps_by_corpus(raster_data[style_id],
+                                                                           bitmap_order_corpus)
+            print(f"  Style {style_id}: {corpus_glyphs} corpus glyph bitmaps stored first", file=sys.stderr)
 
     # Pack binary sections for each style
     packed_sections = {}  # style_id -> tuple of section bytearrays
@@ -899,6 +957,10 @@ def main():
                         help="Output directory for multi-size mode.")
     parser.add_argument("--list-presets", action="store_true",
                         help="List available interval presets and exit.")
+    parser.add_argument("--bitmap-order-corpus", dest="bitmap_order_corpus", action="append",
+                        help="UTF-8 text file in the font's target languages. Bitmaps of the glyphs it uses "
+                             "are stored first, most frequent first, so a page's bitmaps are read in a few "
+                             "contiguous regions. This argument can be repeated.")
 
     # Multi-style mode: per-style font file arguments (generates v4 .cpfont)
     parser.add_argument("--regular", dest="font_regular",
@@ -1016,7 +1078,8 @@ def main():
         total_size += generate_cpfont_multistyle(
             style_fonts, sz, intervals, output_path,
             force_autohint=args.force_autohint,
-            fallback_style_fonts=fallback_style_fonts)
+            fallback_style_fonts=fallback_style_fonts,
+            bitmap_order_corpus=args.bitmap_order_corpus)
     print(f"\nTotal: {len(sizes)} files, {total_size / 1024 / 1024:.2f} MB", file=sys.stderr)
 
 
@@ -7,7 +7,8 @@ Parses each generated .h file in the given directory, identifies compressed font
 compacts to packed format, and verifies the data matches expected glyph sizes.
 
 Supports both contiguous-group fonts (Latin) and frequency-grouped fonts (CJK)
-with glyphToGroup mapping arrays.
+with glyphToGroup mapping arrays. Per-glyph RLE fonts (fontconvert.py --rle) are
+checked stream by stream: each must cover exactly its glyph's pixels.
 """
 import math
 import os
@@ -96,11 +97,83 @@ def compact_aligned_to_packed(aligned_data, width, height):
     return bytes(packed)
 
 
+def rle_stream_length(data, offset, pixel_count):
+    """Walk one GlyphRle nibble stream and return its length in bytes, or None if it overruns."""
+    nibble = offset * 2
+    end = len(data) * 2
+
+    def next_nibble():
+        nonlocal nibble
+        if nibble >= end:
+            raise IndexError
+        byte = data[nibble // 2]
+        value = byte & 0xF if nibble % 2 else byte >> 4
+        nibble += 1
+        return value
+
+    pos = 0
+    try:
+        while pos < pixel_count:
+            code = next_nibble()
+            if code <= 0x1:
+                pos += 1
+            elif code <= 0x7:
+                pos += code - 1
+            elif code == 0x8:
+                pos += 7 + next_nibble()
+            elif code <= 0xD:
+                pos += code - 8
+            elif code == 0xE:
+                pos += 6 + next_nibble()
+            else:
+                pos += (((next_nibble() & 0x7) << 4) | next_nibble()) + 1
+    except IndexError:
+        return None
+    if pos != pixel_count:
+        return None
+    return (nibble + 1) // 2 - offset
+
+
+def verify_rle_font(font_name, content):
+    """Verify a per-glyph RLE font: streams tile the bitmap array in glyph order."""
+    bitmap_match = re.search(
+        r'static const uint8_t ' + re.escape(font_name) + r'Bitmaps\[\d+\]\s*=\s*\{([^}]+)\}',
+        content, re.DOTALL
+    )
+    glyphs_match = re.search(
+        r'static const EpdGlyph ' + re.escape(font_name) + r'Glyphs\[\]\s*=\s*\{(.+?)\};',
+        content, re.DOTALL
+    )
+    if not bitmap_match or not glyphs_match:
+        return (font_name, False, "could not find Bitmaps or Glyphs array")
+    data = parse_hex_array(bitmap_match.group(1))
+    glyphs = parse_glyphs(glyphs_match.group(1))
+
+    offset = 0
+    for glyph_idx, glyph in enumerate(glyphs):
+        pixel_count = glyph['width'] * glyph['height']
+        if glyph['dataLength'] != math.ceil(pixel_count / 4):
+            return (font_name, False, f"glyph {glyph_idx}: dataLength {glyph['dataLength']} != packed length {math.ceil(pixel_count / 4)}")
+        if glyph['dataOffset'] != offset:
+            return (font_name, False, f"glyph {glyph_idx}: dataOffset {glyph['dataOffset']} != expected stream offset {offset}")
+        length = rle_stream_length(data, offset, pixel_count)
+        if length is None:
+            return (font_name, False, f"glyph {glyph_idx}: RLE stream does not cover exactly {pixel_count} pixels")
+        offset += length
+    if offset != len(data):
+        return (font_name, False, f"RLE streams end at {offset}, bitmap array has {len(data)} bytes")
+    return (font_name, True, f"{len(glyphs)} glyphs OK (rle)")
+
+
 def verify_font_file(filepath):
     """Verify a single font header file. Returns (font_name, success, message)."""
     with open(filepath, 'r') as f:
         content = f.read()
 
+    rle_match = re.search(r'static const EpdFontData (\w+) = \{[^}]*EPD_BITMAP_RLE,', content)
+    if rle_match:
+        return verify_rle_font(rle_match.group(1), content)
+
     # Check if this is a compressed font (has Groups array)
     groups_match = re.search(r'static const EpdFontGroup (\w+)Groups\[\]', content)
     if not groups_match:
@@ -790,7 +790,21 @@ int Epub::getSpineItemsCount() const {
   return bookMetadataCache->getSpineCount();
 }
 
-size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const { return getSpineItem(spineIndex).cumulativeSize; }
+size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const { return getSpineInfo(spineIndex).cumulativeSize; }
+
+BookMetadataCache::SpineInfo Epub::getSpineInfo(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded() || bookMetadataCache->getSpineCount() == 0) {
+    LOG_ERR("EBP", "getSpineInfo called but cache not loaded");
+    return {0, 0, -1};
+  }
+
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    LOG_ERR("EBP", "getSpineInfo index:%d is out of range", spineIndex);
+    return bookMetadataCache->getSpineInfo(0);
+  }
+
+  return bookMetadataCache->getSpineInfo(spineIndex);
+}
 
 BookMetadataCache::SpineEntry Epub::getSpineItem(const int spineIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
@@ -849,7 +863,7 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
   return spineIndex;
 }
 
-int Epub::getTocIndexForSpineIndex(const int spineIndex) const { return getSpineItem(spineIndex).tocIndex; }
+int Epub::getTocIndexForSpineIndex(const int spineIndex) const { return getSpineInfo(spineIndex).tocIndex; }
 
 size_t Epub::getBookSize() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded() || bookMetadataCache->getSpineCount() == 0) {
@@ -873,13 +887,12 @@ int Epub::getSpineIndexForTextReference() const {
     return 0;
   }
 
-  // loop through spine items to get the correct index matching the text href
-  for (size_t i = 0; i < getSpineItemsCount(); i++) {
-    if (getSpineItem(i).href == bookMetadataCache->coreMetadata.textReferenceHref) {
-      LOG_DBG("EBP", "Text reference %s found at index %d", bookMetadataCache->coreMetadata.textReferenceHref.c_str(),
-              i);
-      return i;
-    }
+  // look up the spine item matching the text href
+  const int textIndex = bookMetadataCache->findSpineIndexByHref(bookMetadataCache->coreMetadata.textReferenceHref);
+  if (textIndex >= 0) {
+    LOG_DBG("EBP", "Text reference %s found at index %d", bookMetadataCache->coreMetadata.textReferenceHref.c_str(),
+            textIndex);
+    return textIndex;
   }
   // This should not happen, as we checked for empty textReferenceHref earlier
   LOG_DBG("EBP", "Section not found for text reference");
@@ -910,18 +923,11 @@ int Epub::resolveHrefToSpineIndex(const std::string& href) const {
   // Same-file reference (anchor-only)
   if (target.empty()) return -1;
 
-  // Extract just the filename for comparison
-  size_t targetSlash = target.find_last_of('/');
-  std::string targetFilename = (targetSlash != std::string::npos) ? target.substr(targetSlash + 1) : target;
+  // Exact path first, then filename-only (hrefs relative to another directory)
+  const int exactIndex = bookMetadataCache->findSpineIndexByHref(target);
+  if (exactIndex >= 0) return exactIndex;
 
-  for (int i = 0; i < getSpineItemsCount(); i++) {
-    const auto& spineHref = getSpineItem(i).href;
-    // Try exact match first
-    if (spineHref == target) return i;
-    // Then filename-only match
-    size_t spineSlash = spineHref.find_last_of('/');
-    std::string spineFilename = (spineSlash != std::string::npos) ? spineHref.substr(spineSlash + 1) : spineHref;
-    if (spineFilename == targetFilename) return i;
-  }
-  return -1;
+  const size_t targetSlash = target.find_last_of('/');
+  const std::string targetFilename = (targetSlash != std::string::npos) ? target.substr(targetSlash + 1) : target;
+  return bookMetadataCache->findSpineIndexByFileName(targetFilename);
 }
@@ -1,6 +1,7 @@
 #include "BookMetadataCache.h"
 
 #include <Logging.h>
+#include <Memory.h>
 #include <Serialization.h>
 #include <Utf8.h>
 #include <ZipFile.h>
@@ -10,10 +11,17 @@
 #include "FsHelpers.h"
 
 namespace {
-constexpr uint8_t BOOK_CACHE_VERSION = 8;  // v8: TOC/book titles stored NFC-composed
+constexpr uint8_t BOOK_CACHE_VERSION = 11;  // v11: spine table without the unused href hash
 constexpr char bookBinFile[] = "/book.bin";
 constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
 constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
+// Bucket ranges are read in chunks of this many entries
+constexpr uint16_t HREF_INDEX_READ_CHUNK = 32;
+
+std::string hrefFileName(const std::string& href) {
+  const size_t slash = href.find_last_of('/');
+  return slash == std::string::npos ? href : href.substr(slash + 1);
+}
 }  // namespace
 
 /* ============= WRITING / BUILDING FUNCTIONS ================ */
@@ -41,51 +49,13 @@ bool BookMetadataCache::endContentOpfPass() {
 
 bool BookMetadataCache::beginTocPass() {
   LOG_DBG("BMC", "Beginning toc pass");
-
-  if (!Storage.openFileForRead("BMC", cachePath + tmpSpineBinFile, spineFile)) {
-    return false;
-  }
-  if (!Storage.openFileForWrite("BMC", cachePath + tmpTocBinFile, tocFile)) {
-    // Explicit close() required: member variable persists beyond function scope
-    spineFile.close();
-    return false;
-  }
-
-  if (spineCount >= LARGE_SPINE_THRESHOLD) {
-    spineHrefIndex.clear();
-    spineHrefIndex.resize(spineCount);
-    spineFile.seek(0);
-    for (int i = 0; i < spineCount; i++) {
-      auto entry = readSpineEntry(spineFile);
-      SpineHrefIndexEntry idx;
-      idx.hrefHash = fnvHash64(entry.href);
-      idx.hrefLen = static_cast<uint16_t>(entry.href.size());
-      idx.spineIndex = static_cast<int16_t>(i);
-      spineHrefIndex[i] = idx;
-    }
-    std::sort(spineHrefIndex.begin(), spineHrefIndex.end(),
-              [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
-                return a.hrefHash < b.hrefHash || (a.hrefHash == b.hrefHash && a.hrefLen < b.hrefLen);
-              });
-    spineFile.seek(0);
-    useSpineHrefIndex = true;
-    LOG_DBG("BMC", "Using fast index for %d spine items", spineCount);
-  } else {
-    useSpineHrefIndex = false;
-  }
-
-  return true;
+  // TOC hrefs are resolved to spine indices by buildBookBin(), against the href index
+  return Storage.openFileForWrite("BMC", cachePath + tmpTocBinFile, tocFile);
 }
 
 bool BookMetadataCache::endTocPass() {
-  // Explicit close() required: member variables persist beyond function scope
+  // Explicit close() required: member variable persists beyond function scope
   tocFile.close();
-  spineFile.close();
-
-  spineHrefIndex.clear();
-  spineHrefIndex.shrink_to_fit();
-  useSpineHrefIndex = false;
-
   return true;
 }
 
@@ -119,19 +89,23 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     return false;
   }
 
-  constexpr uint32_t headerASize =
-      sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) + sizeof(spineCount) + sizeof(tocCount);
+  constexpr uint32_t headerASize = sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) +
+                                   sizeof(spineCount) + sizeof(tocCount) + /* Spine table offset */ sizeof(uint32_t);
   const uint32_t metadataSize = metadata.title.size() + metadata.author.size() + metadata.language.size() +
                                 metadata.coverItemHref.size() + metadata.textReferenceHref.size() +
                                 sizeof(uint32_t) * 5;
   const uint32_t lutSize = sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocCount;
   const uint32_t lutOffset = headerASize + metadataSize;
+  // Spine and TOC entries are copied verbatim from the temp files, followed by the packed spine table
+  const uint32_t spineTableOffset =
+      lutOffset + lutSize + static_cast<uint32_t>(spineFile.size()) + static_cast<uint32_t>(tocFile.size());
 
   // Header A
   serialization::writePod(bookFile, BOOK_CACHE_VERSION);
   serialization::writePod(bookFile, lutOffset);
   serialization::writePod(bookFile, spineCount);
   serialization::writePod(bookFile, tocCount);
+  serialization::writePod(bookFile, spineTableOffset);
   // Metadata
   serialization::writeString(bookFile, metadata.title);
   serialization::writeString(bookFile, metadata.author);
@@ -158,18 +132,6 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   // LUTs complete
   // Loop through spines from spine file matching up TOC indexes, calculating cumulative size and writing to book.bin
 
-  // Build spineIndex->tocIndex mapping in one pass (O(n) instead of O(n*m))
-  std::deque<int16_t> spineToTocIndex(spineCount, -1);
-  tocFile.seek(0);
-  for (int j = 0; j < tocCount; j++) {
-    auto tocEntry = readTocEntry(tocFile);
-    if (tocEntry.spineIndex >= 0 && tocEntry.spineIndex < spineCount) {
-      if (spineToTocIndex[tocEntry.spineIndex] == -1) {
-        spineToTocIndex[tocEntry.spineIndex] = static_cast<int16_t>(j);
-      }
-    }
-  }
-
   ZipFile zip(epubPath);
   // Pre-open zip file to speed up size calculations
   if (!zip.open()) {
@@ -223,6 +185,36 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     useBatchSizes = true;
   }
 
+  // Path index, built once the batch targets are freed: it resolves TOC hrefs now and is persisted below
+  std::deque<HrefIndexEntry> pathIndex(spineCount);
+  spineFile.seek(0);
+  for (int i = 0; i < spineCount; i++) {
+    pathIndex[i] = makeHrefIndexEntry(readSpineEntry(spineFile).href, i);
+  }
+  std::sort(pathIndex.begin(), pathIndex.end(), hrefIndexLess);
+  // Spine item a TOC href points at, or -1
+  const auto tocSpineIndex = [&pathIndex](const std::string& href) -> int16_t {
+    const uint64_t hash = fnvHash64(href);
+    const auto len = static_cast<uint16_t>(href.size());
+    const auto it = lowerBoundHref(pathIndex.begin(), pathIndex.end(), hash, len);
+    return it != pathIndex.end() && hrefMatches(*it, hash, len) ? it->spineIndex : -1;
+  };
+
+  // Build spineIndex->tocIndex mapping in one pass (O(n) instead of O(n*m))
+  std::deque<int16_t> spineToTocIndex(spineCount, -1);
+  tocFile.seek(0);
+  for (int j = 0; j < tocCount; j++) {
+    auto tocEntry = readTocEntry(tocFile);
+    const int16_t spineIndex = tocSpineIndex(tocEntry.href);
+    if (spineIndex < 0) {
+      LOG_DBG("BMC", "Could not find spine item for TOC href %s", tocEntry.href.c_str());
+    } else if (spineToTocIndex[spineIndex] == -1) {
+      spineToTocIndex[spineIndex] = static_cast<int16_t>(j);
+    }
+  }
+
+  std::deque<SpineInfo> spineInfos(spineCount);
+  std::deque<HrefIndexEntry> fileNameIndex(spineCount);
   uint32_t cumSize = 0;
   spineFile.seek(0);
   int lastSpineTocIndex = -1;
@@ -258,6 +250,8 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
 
     cumSize += itemSize;
     spineEntry.cumulativeSize = cumSize;
+    spineInfos[i] = SpineInfo{cumSize, spineEntry.tocIndex};
+    fileNameIndex[i] = makeHrefIndexEntry(hrefFileName(spineEntry.href), i);
 
     // Write out spine data to book.bin
     writeSpineEntry(bookFile, spineEntry);
@@ -269,9 +263,32 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   tocFile.seek(0);
   for (int i = 0; i < tocCount; i++) {
     auto tocEntry = readTocEntry(tocFile);
+    tocEntry.spineIndex = tocSpineIndex(tocEntry.href);
     writeTocEntry(bookFile, tocEntry);
   }
 
+  // Packed spine table, loaded whole at load()
+  if (bookFile.position() != spineTableOffset) {
+    LOG_ERR("BMC", "Spine table offset mismatch: expected %u, at %u", static_cast<unsigned>(spineTableOffset),
+            static_cast<unsigned>(bookFile.position()));
+    // Explicit close() required: member variables persist beyond function scope
+    bookFile.close();
+    spineFile.close();
+    tocFile.close();
+    return false;
+  }
+  for (const auto& info : spineInfos) {
+    serialization::writePod(bookFile, info);
+  }
+  spineInfos.clear();
+
+  // Href index tables follow the spine table (see hrefIndexTableOffset)
+  std::sort(fileNameIndex.begin(), fileNameIndex.end(), hrefIndexLess);
+  writeHrefIndexTable(bookFile, pathIndex);
+  writeHrefIndexTable(bookFile, fileNameIndex);
+  pathIndex.clear();
+  fileNameIndex.clear();
+
   // Explicit close() required: member variables persist beyond function scope
   bookFile.close();
   spineFile.close();
@@ -281,6 +298,20 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   return true;
 }
 
+void BookMetadataCache::writeHrefIndexTable(HalFile& file, const std::deque<HrefIndexEntry>& entries) {
+  // bucketStart[b] is the first entry whose top hash byte is >= b; the extra slot closes the last bucket
+  uint16_t next = 0;
+  for (uint16_t bucket = 0; bucket <= HREF_INDEX_BUCKETS; bucket++) {
+    while (next < entries.size() && hrefBucket(entries[next].hrefHash) < bucket) {
+      next++;
+    }
+    serialization::writePod(file, next);
+  }
+  for (const auto& entry : entries) {
+    serialization::writePod(file, entry);
+  }
+}
+
 bool BookMetadataCache::cleanupTmpFiles() const {
   const auto spineBinFile = cachePath + tmpSpineBinFile;
   if (Storage.exists(spineBinFile.c_str())) {
@@ -326,48 +357,15 @@ void BookMetadataCache::createSpineEntry(const std::string& href) {
 
 void BookMetadataCache::createTocEntry(const std::string& title, const std::string& href, const std::string& anchor,
                                        const uint8_t level) {
-  if (!buildMode || !tocFile || !spineFile) {
+  if (!buildMode || !tocFile) {
     LOG_DBG("BMC", "createTocEntry called but not in build mode");
     return;
   }
 
-  int16_t spineIndex = -1;
-
-  if (useSpineHrefIndex) {
-    uint64_t targetHash = fnvHash64(href);
-    uint16_t targetLen = static_cast<uint16_t>(href.size());
-
-    auto it =
-        std::lower_bound(spineHrefIndex.begin(), spineHrefIndex.end(), SpineHrefIndexEntry{targetHash, targetLen, 0},
-                         [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
-                           return a.hrefHash < b.hrefHash || (a.hrefHash == b.hrefHash && a.hrefLen < b.hrefLen);
-                         });
-
-    while (it != spineHrefIndex.end() && it->hrefHash == targetHash && it->hrefLen == targetLen) {
-      spineIndex = it->spineIndex;
-      break;
-    }
-
-    if (spineIndex == -1) {
-      LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
-    }
-  } else {
-    spineFile.seek(0);
-    for (int i = 0; i < spineCount; i++) {
-      auto spineEntry = readSpineEntry(spineFile);
-      if (spineEntry.href == href) {
-        spineIndex = static_cast<int16_t>(i);
-        break;
-      }
-    }
-    if (spineIndex == -1) {
-      LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
-    }
-  }
-
   // Compose the title to NFC at index time so the cache stores precomposed glyphs;
   // device fonts have no combining-mark positioning, so NFD titles render broken.
-  const TocEntry entry(utf8ComposeNfc(title), href, anchor, level, spineIndex);
+  // The spine index is filled in by buildBookBin().
+  const TocEntry entry(utf8ComposeNfc(title), href, anchor, level, -1);
   writeTocEntry(tocFile, entry);
   tocCount++;
 }
@@ -391,6 +389,7 @@ bool BookMetadataCache::load() {
   serialization::readPod(bookFile, lutOffset);
   serialization::readPod(bookFile, spineCount);
   serialization::readPod(bookFile, tocCount);
+  serialization::readPod(bookFile, spineTableOffset);
 
   serialization::readString(bookFile, coreMetadata.title);
   serialization::readString(bookFile, coreMetadata.author);
@@ -398,6 +397,11 @@ bool BookMetadataCache::load() {
   serialization::readString(bookFile, coreMetadata.coverItemHref);
   serialization::readString(bookFile, coreMetadata.textReferenceHref);
 
+  if (!loadSpineTable()) {
+    // Still usable, spine queries just go back to reading entries from book.bin
+    LOG_ERR("BMC", "Spine table not resident, falling back to SD reads");
+  }
+
   loaded = true;
   LOG_DBG("BMC", "Loaded cache data: %d spine, %d TOC entries", spineCount, tocCount);
   return true;
@@ -422,6 +426,82 @@ BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index)
   return readSpineEntry(bookFile);
 }
 
+bool BookMetadataCache::loadSpineTable() {
+  spineTable.reset();
+  if (spineCount == 0) {
+    return true;
+  }
+
+  const size_t tableSize = sizeof(SpineInfo) * spineCount;
+  auto table = makeUniqueNoThrow<SpineInfo[]>(spineCount);
+  if (!table) {
+    LOG_ERR("BMC", "OOM: %u byte spine table", static_cast<unsigned>(tableSize));
+    return false;
+  }
+  if (!bookFile.seek(spineTableOffset) ||
+      bookFile.read(reinterpret_cast<uint8_t*>(table.get()), tableSize) != static_cast<int>(tableSize)) {
+    LOG_ERR("BMC", "Failed to read spine table");
+    return false;
+  }
+  spineTable = std::move(table);
+  return true;
+}
+
+BookMetadataCache::SpineInfo BookMetadataCache::getSpineInfo(const int index) {
+  if (spineTable) {
+    return spineTable[index];
+  }
+  const auto entry = getSpineEntry(index);
+  return SpineInfo{entry.cumulativeSize, entry.tocIndex};
+}
+
+uint32_t BookMetadataCache::hrefIndexTableOffset(const HrefIndexTable table) const {
+  const uint32_t tableSize =
+      sizeof(uint16_t) * (HREF_INDEX_BUCKETS + 1) + sizeof(HrefIndexEntry) * static_cast<uint32_t>(spineCount);
+  return spineTableOffset + sizeof(SpineInfo) * spineCount + tableSize * table;
+}
+
+int BookMetadataCache::lookupHrefIndex(const HrefIndexTable table, const std::string& key) {
+  if (!loaded || spineCount == 0 || key.empty()) {
+    return -1;
+  }
+
+  const uint64_t hash = fnvHash64(key);
+  const uint16_t len = static_cast<uint16_t>(key.size());
+  const uint32_t tableOffset = hrefIndexTableOffset(table);
+
+  uint16_t range[2];
+  if (!bookFile.seek(tableOffset + sizeof(uint16_t) * hrefBucket(hash)) ||
+      bookFile.read(range, sizeof(range)) != static_cast<int>(sizeof(range))) {
+    LOG_ERR("BMC", "Failed to read href index bucket");
+    return -1;
+  }
+
+  const uint32_t entriesOffset = tableOffset + sizeof(uint16_t) * (HREF_INDEX_BUCKETS + 1);
+  HrefIndexEntry chunk[HREF_INDEX_READ_CHUNK];
+  for (uint16_t start = range[0]; start < range[1] && start < spineCount;) {
+    const uint16_t count = std::min<uint16_t>(HREF_INDEX_READ_CHUNK, range[1] - start);
+    const int bytes = static_cast<int>(sizeof(HrefIndexEntry) * count);
+    if (!bookFile.seek(entriesOffset + sizeof(HrefIndexEntry) * start) || bookFile.read(chunk, bytes) != bytes) {
+      LOG_ERR("BMC", "Failed to read href index entries");
+      return -1;
+    }
+    // Past the chunk means the key may still be in the next one; anything else decides it
+    const HrefIndexEntry* hit = lowerBoundHref(chunk, chunk + count, hash, len);
+    if (hit != chunk + count) {
+      return hrefMatches(*hit, hash, len) ? hit->spineIndex : -1;
+    }
+    start += count;
+  }
+  return -1;
+}
+
+int BookMetadataCache::findSpineIndexByHref(const std::string& path) { return lookupHrefIndex(HREF_INDEX_PATH, path); }
+
+int BookMetadataCache::findSpineIndexByFileName(const std::string& fileName) {
+  return lookupHrefIndex(HREF_INDEX_BASENAME, fileName);
+}
+
 BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
   if (!loaded) {
     LOG_ERR("BMC", "getTocEntry called but cache not loaded");
@@ -3,7 +3,9 @@
 #include <HalStorage.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <deque>
+#include <memory>
 #include <string>
 
 class BookMetadataCache {
@@ -26,6 +28,12 @@ class BookMetadataCache {
         : href(std::move(href)), cumulativeSize(cumulativeSize), tocIndex(tocIndex) {}
   };
 
+  // Resident per-spine-item data, so progress and TOC lookups don't touch the SD card
+  struct SpineInfo {
+    uint32_t cumulativeSize;
+    int16_t tocIndex;
+  } __attribute__((packed));
+
   struct TocEntry {
     std::string title;
     std::string href;
@@ -47,25 +55,55 @@ class BookMetadataCache {
   uint32_t lutOffset;
   uint16_t spineCount;
   uint16_t tocCount;
+  uint32_t spineTableOffset;
   bool loaded;
   bool buildMode;
 
+  // Copy of book.bin's spine table, read in one go by load(); null if it didn't fit
+  std::unique_ptr<SpineInfo[]> spineTable;
+
   HalFile bookFile;
   // Temp file handles during build
   HalFile spineFile;
   HalFile tocFile;
 
-  // Index for fast href→spineIndex lookup (used only for large EPUBs)
-  struct SpineHrefIndexEntry {
-    uint64_t hrefHash;  // FNV-1a 64-bit hash
-    uint16_t hrefLen;   // length for collision reduction
-    int16_t spineIndex;
-  };
-  std::deque<SpineHrefIndexEntry> spineHrefIndex;
-  bool useSpineHrefIndex = false;
-
   static constexpr uint16_t LARGE_SPINE_THRESHOLD = 400;
 
+  // Persisted href→spine index: one table keyed by the full href and one by its
+  // basename, each sorted by (hash, length, spine index) and preceded by bucket
+  // starts for the top hash byte, so a lookup is two small reads. buildBookBin()
+  // also resolves TOC hrefs against the path table before writing it.
+  struct HrefIndexEntry {
+    uint64_t hrefHash;
+    uint16_t hrefLen;
+    int16_t spineIndex;
+  } __attribute__((packed));
+  static constexpr uint16_t HREF_INDEX_BUCKETS = 256;
+  enum HrefIndexTable : uint8_t { HREF_INDEX_PATH = 0, HREF_INDEX_BASENAME = 1 };
+
+  static uint16_t hrefBucket(const uint64_t hash) { return static_cast<uint16_t>(hash >> 56); }
+  static bool hrefIndexLess(const HrefIndexEntry& a, const HrefIndexEntry& b) {
+    if (a.hrefHash != b.hrefHash) return a.hrefHash < b.hrefHash;
+    if (a.hrefLen != b.hrefLen) return a.hrefLen < b.hrefLen;
+    return a.spineIndex < b.spineIndex;
+  }
+  // First entry of a sorted run not ordered before key (hash, len); when it
+  // matches the key it has the lowest spine index for it
+  template <typename It>
+  static It lowerBoundHref(It first, It last, const uint64_t hash, const uint16_t len) {
+    return std::lower_bound(first, last, HrefIndexEntry{hash, len, INT16_MIN}, hrefIndexLess);
+  }
+  static bool hrefMatches(const HrefIndexEntry& entry, const uint64_t hash, const uint16_t len) {
+    return entry.hrefHash == hash && entry.hrefLen == len;
+  }
+  static HrefIndexEntry makeHrefIndexEntry(const std::string& key, const int spineIndex) {
+    return HrefIndexEntry{fnvHash64(key), static_cast<uint16_t>(key.size()), static_cast<int16_t>(spineIndex)};
+  }
+  // entries must already be sorted by hrefIndexLess
+  static void writeHrefIndexTable(HalFile& file, const std::deque<HrefIndexEntry>& entries);
+  uint32_t hrefIndexTableOffset(HrefIndexTable table) const;
+  int lookupHrefIndex(HrefIndexTable table, const std::string& key);
+
   // FNV-1a 64-bit hash function
   static uint64_t fnvHash64(const std::string& s) {
     uint64_t hash = 14695981039346656037ull;
@@ -76,6 +114,7 @@ class BookMetadataCache {
     return hash;
   }
 
+  bool loadSpineTable();
   uint32_t writeSpineEntry(HalFile& file, const SpineEntry& entry) const;
   uint32_t writeTocEntry(HalFile& file, const TocEntry& entry) const;
   SpineEntry readSpineEntry(HalFile& file) const;
@@ -85,7 +124,13 @@ class BookMetadataCache {
   BookMetadata coreMetadata;
 
   explicit BookMetadataCache(std::string cachePath)
-      : cachePath(std::move(cachePath)), lutOffset(0), spineCount(0), tocCount(0), loaded(false), buildMode(false) {}
+      : cachePath(std::move(cachePath)),
+        lutOffset(0),
+        spineCount(0),
+        tocCount(0),
+        spineTableOffset(0),
+        loaded(false),
+        buildMode(false) {}
   ~BookMetadataCache() = default;
 
   // Building phase (stream to disk immediately)
@@ -105,6 +150,12 @@ class BookMetadataCache {
   // Reading phase (read mode)
   bool load();
   SpineEntry getSpineEntry(int index);
+  // Size/TOC data of a spine item without reading its href; index must be in range
+  SpineInfo getSpineInfo(int index);
+  // Spine index whose href equals path, or -1
+  int findSpineIndexByHref(const std::string& path);
+  // Lowest spine index whose href's file name equals fileName, or -1
+  int findSpineIndexByFileName(const std::string& fileName);
   TocEntry getTocEntry(int index);
   int getSpineCount() const { return spineCount; }
   int getTocCount() const { return tocCount; }
@@ -3,25 +3,29 @@
 #include <GfxRenderer.h>
 #include <Logging.h>
 #include <Serialization.h>
+#include <Utf8.h>
 
+#include <cstring>
 #include <new>
 
 namespace {
 
 template <typename Predicate>
-void renderFilteredPageElements(const std::vector<std::shared_ptr<PageElement>>& elements, GfxRenderer& renderer,
+void renderFilteredPageElements(const std::vector<PageElement*>& elements, GfxRenderer& renderer,
                                 const int fontId, const int xOffset, const int yOffset, Predicate&& predicate) {
+  // One font lookup for the whole page instead of several per word
+  const FontHandle font = renderer.resolveFont(fontId);
   for (const auto& element : elements) {
     if (predicate(*element)) {
-      element->render(renderer, fontId, xOffset, yOffset);
+      element->render(renderer, font, xOffset, yOffset);
     }
   }
 }
 
 }  // namespace
 
-void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
+void PageLine::render(GfxRenderer& renderer, const FontHandle& font, const int xOffset, const int yOffset) {
+  block->render(renderer, font, xPos + xOffset, yPos + yOffset);
 }
 
 bool PageLine::serialize(HalFile& file) {
@@ -32,28 +36,30 @@ bool PageLine::serialize(HalFile& file) {
   return block->serialize(file);
 }
 
-std::unique_ptr<PageLine> PageLine::deserialize(HalFile& file) {
+PageLine* PageLine::deserialize(HalFile& file, PageArena& arena) {
   int16_t xPos;
   int16_t yPos;
   serialization::readPod(file, xPos);
   serialization::readPod(file, yPos);
 
-  auto tb = TextBlock::deserialize(file);
+  auto* tb = TextBlock::deserialize(file, arena);
   if (!tb) {
     LOG_ERR("PGE", "Deserialization failed: null TextBlock");
     return nullptr;
   }
 
-  auto* line = new (std::nothrow) PageLine(std::move(tb), xPos, yPos);
+  auto* line = arena.create<PageLine>(tb, xPos, yPos);
   if (!line) {
     LOG_ERR("PGE", "Deserialization failed: could not allocate PageLine");
+    tb->~TextBlock();
     return nullptr;
   }
-  return std::unique_ptr<PageLine>(line);
+  return line;
 }
 
-void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  // Images don't use fontId or text rendering
+void PageImage::render(GfxRenderer& renderer, const FontHandle& font, const int xOffset, const int yOffset) {
+  // Images don't use the font or text rendering
+  (void)font;
   imageBlock->render(renderer, xPos + xOffset, yPos + yOffset);
 }
 
@@ -65,18 +71,18 @@ bool PageImage::serialize(HalFile& file) {
   return imageBlock->serialize(file);
 }
 
-std::unique_ptr<PageImage> PageImage::deserialize(HalFile& file) {
+PageImage* PageImage::deserialize(HalFile& file, PageArena& arena) {
   int16_t xPos;
   int16_t yPos;
   serialization::readPod(file, xPos);
   serialization::readPod(file, yPos);
 
   auto ib = ImageBlock::deserialize(file);
-  return std::unique_ptr<PageImage>(new PageImage(std::move(ib), xPos, yPos));
+  return arena.create<PageImage>(std::move(ib), xPos, yPos);
 }
 
-void PageHorizontalRule::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  (void)fontId;
+void PageHorizontalRule::render(GfxRenderer& renderer, const FontHandle& font, const int xOffset, const int yOffset) {
+  (void)font;
   if (width == 0 || thickness == 0) {
     return;
   }
@@ -92,7 +98,7 @@ bool PageHorizontalRule::serialize(HalFile& file) {
   return true;
 }
 
-std::unique_ptr<PageHorizontalRule> PageHorizontalRule::deserialize(HalFile& file) {
+PageHorizontalRule* PageHorizontalRule::deserialize(HalFile& file, PageArena& arena) {
   int16_t xPos = 0;
   int16_t yPos = 0;
   uint16_t width = 0;
@@ -108,24 +114,44 @@ std::unique_ptr<PageHorizontalRule> PageHorizontalRule::deserialize(HalFile& fil
     return nullptr;
   }
 
-  auto* rule = new (std::nothrow) PageHorizontalRule(width, thickness, xPos, yPos);
+  auto* rule = arena.create<PageHorizontalRule>(width, thickness, xPos, yPos);
   if (!rule) {
     LOG_ERR("PGE", "Deserialization failed: could not allocate PageHorizontalRule");
     return nullptr;
   }
-  return std::unique_ptr<PageHorizontalRule>(rule);
+  return rule;
 }
 
 void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
   renderFilteredPageElements(elements, renderer, fontId, xOffset, yOffset, [](const PageElement&) { return true; });
 }
 
+bool Page::forEachWord(const TextBlock::WordVisitor& fn) const {
+  for (const auto& el : elements) {
+    if (el->getTag() != TAG_PageLine) continue;
+    const auto& block = static_cast<const PageLine&>(*el).getBlock();
+    if (block && !block->forEachWord(fn)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void Page::renderImages(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
   renderFilteredPageElements(elements, renderer, fontId, xOffset, yOffset,
                              [](const PageElement& element) { return element.getTag() == TAG_PageImage; });
 }
 
 bool Page::serialize(HalFile& file) const {
+  // Prewarm set first, so readGlyphSet() gets it without walking the elements
+  const uint16_t glyphSetLen = glyphSetText.size();
+  serialization::writePod(file, glyphSetStyleMask);
+  serialization::writePod(file, glyphSetLen);
+  if (file.write(glyphSetText.data(), glyphSetLen) != glyphSetLen) {
+    LOG_ERR("PGE", "Failed to write glyph set");
+    return false;
+  }
+
   const uint16_t count = elements.size();
   serialization::writePod(file, count);
 
@@ -156,35 +182,34 @@ bool Page::serialize(HalFile& file) const {
 std::unique_ptr<Page> Page::deserialize(HalFile& file) {
   auto page = std::unique_ptr<Page>(new Page());
 
+  if (!readGlyphSet(file, page->glyphSetText, page->glyphSetStyleMask)) {
+    LOG_ERR("PGE", "Failed to read glyph set");
+    return nullptr;
+  }
+
   uint16_t count;
   serialization::readPod(file, count);
 
+  page->elements.reserve(count);
   for (uint16_t i = 0; i < count; i++) {
     uint8_t tag;
     serialization::readPod(file, tag);
 
+    PageElement* el;
     if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
-      if (!pl) {
-        return nullptr;
-      }
-      page->elements.push_back(std::move(pl));
+      el = PageLine::deserialize(file, page->arena);
     } else if (tag == TAG_PageImage) {
-      auto pi = PageImage::deserialize(file);
-      if (!pi) {
-        return nullptr;
-      }
-      page->elements.push_back(std::move(pi));
+      el = PageImage::deserialize(file, page->arena);
     } else if (tag == TAG_PageHorizontalRule) {
-      auto rule = PageHorizontalRule::deserialize(file);
-      if (!rule) {
-        return nullptr;
-      }
-      page->elements.push_back(std::move(rule));
+      el = PageHorizontalRule::deserialize(file, page->arena);
     } else {
       LOG_ERR("PGE", "Deserialization failed: Unknown tag %u", tag);
       return nullptr;
     }
+    if (!el) {
+      return nullptr;
+    }
+    page->elements.push_back(el);
   }
 
   // Deserialize footnotes
@@ -208,3 +233,88 @@ std::unique_ptr<Page> Page::deserialize(HalFile& file) {
 
   return page;
 }
+
+bool Page::forEachSerializedWord(HalFile& file, const TextBlock::WordVisitor& fn) {
+  // uint8 glyph set style mask, uint16 length, text
+  uint8_t glyphSetStyleMask;
+  uint16_t glyphSetLen;
+  serialization::readPod(file, glyphSetStyleMask);
+  serialization::readPod(file, glyphSetLen);
+  if (!file.seekCur(glyphSetLen)) {
+    return false;
+  }
+
+  uint16_t count;
+  serialization::readPod(file, count);
+
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t tag;
+    serialization::readPod(file, tag);
+
+    // Every element starts with int16 xPos, yPos
+    if (!file.seekCur(2 * sizeof(int16_t))) {
+      return false;
+    }
+    if (tag == TAG_PageLine) {
+      bool stopped;
+      if (!TextBlock::forEachSerializedWord(file, fn, stopped)) {
+        return false;
+      }
+      if (stopped) {
+        return true;
+      }
+    } else if (tag == TAG_PageImage) {
+      // String imagePath, int16 width, int16 height
+      uint32_t pathLen;
+      serialization::readPod(file, pathLen);
+      if (!file.seekCur(pathLen + 2 * sizeof(int16_t))) {
+        return false;
+      }
+    } else if (tag == TAG_PageHorizontalRule) {
+      // uint16 width, uint8 thickness
+      if (!file.seekCur(sizeof(uint16_t) + sizeof(uint8_t))) {
+        return false;
+      }
+    } else {
+      LOG_ERR("PGE", "Word walk failed: Unknown tag %u", tag);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Page::readGlyphSet(HalFile& file, std::string& text, uint8_t& styleMask) {
+  uint16_t len = 0;
+  serialization::readPod(file, styleMask);
+  serialization::readPod(file, len);
+  text.resize(len);
+  return len == 0 || file.read(&text[0], len) == len;
+}
+
+PageTextSink::PageTextSink(char* buffer, const size_t capacity) : buffer(buffer), capacity(capacity) {
+  if (capacity > 0) buffer[0] = '\0';
+  full = capacity == 0;
+}
+
+bool PageTextSink::append(const char* word, const uint16_t len) {
+  if (full) return false;
+  if (len == 0) return true;
+
+  const size_t separator = length > 0 ? 1 : 0;
+  size_t take = len;
+  if (length + separator + take >= capacity) {
+    full = true;
+    if (length + separator + 1 >= capacity) {
+      return false;
+    }
+    take = utf8SafeTruncateBuffer(word, static_cast<int>(capacity - 1 - length - separator));
+    if (take == 0) {
+      return false;
+    }
+  }
+  if (separator) buffer[length++] = ' ';
+  memcpy(buffer + length, word, take);
+  length += take;
+  buffer[length] = '\0';
+  return !full;
+}
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "FootnoteEntry.h"
+#include "PageArena.h"
 #include "blocks/ImageBlock.h"
 #include "blocks/TextBlock.h"
 
@@ -23,23 +24,26 @@ class PageElement {
   int16_t yPos;
   explicit PageElement(const int16_t xPos, const int16_t yPos) : xPos(xPos), yPos(yPos) {}
   virtual ~PageElement() = default;
-  virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) = 0;
+  virtual void render(GfxRenderer& renderer, const FontHandle& font, int xOffset, int yOffset) = 0;
   virtual bool serialize(HalFile& file) = 0;
   virtual PageElementTag getTag() const = 0;  // Add type identification
 };
 
-// a line from a block element
+// a line from a block element. The TextBlock lives in the same page arena as the
+// line and is destroyed with it.
 class PageLine final : public PageElement {
-  std::shared_ptr<TextBlock> block;
+  TextBlock* block;
 
  public:
-  PageLine(std::shared_ptr<TextBlock> block, const int16_t xPos, const int16_t yPos)
-      : PageElement(xPos, yPos), block(std::move(block)) {}
-  const std::shared_ptr<TextBlock>& getBlock() const { return block; }
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
+  PageLine(TextBlock* block, const int16_t xPos, const int16_t yPos) : PageElement(xPos, yPos), block(block) {}
+  ~PageLine() override { block->~TextBlock(); }
+  PageLine(const PageLine&) = delete;
+  PageLine& operator=(const PageLine&) = delete;
+  const TextBlock* getBlock() const { return block; }
+  void render(GfxRenderer& renderer, const FontHandle& font, int xOffset, int yOffset) override;
   bool serialize(HalFile& file) override;
   PageElementTag getTag() const override { return TAG_PageLine; }
-  static std::unique_ptr<PageLine> deserialize(HalFile& file);
+  static PageLine* deserialize(HalFile& file, PageArena& arena);
 };
 
 // New PageImage class
@@ -49,10 +53,10 @@ class PageImage final : public PageElement {
  public:
   PageImage(std::shared_ptr<ImageBlock> block, const int16_t xPos, const int16_t yPos)
       : PageElement(xPos, yPos), imageBlock(std::move(block)) {}
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
+  void render(GfxRenderer& renderer, const FontHandle& font, int xOffset, int yOffset) override;
   bool serialize(HalFile& file) override;
   PageElementTag getTag() const override { return TAG_PageImage; }
-  static std::unique_ptr<PageImage> deserialize(HalFile& file);
+  static PageImage* deserialize(HalFile& file, PageArena& arena);
   const ImageBlock& getImageBlock() const { return *imageBlock; }
 };
 
@@ -64,18 +68,41 @@ class PageHorizontalRule final : public PageElement {
   PageHorizontalRule(uint16_t width, uint8_t thickness, const int16_t xPos, const int16_t yPos)
       : PageElement(xPos, yPos), width(width), thickness(thickness) {}
 
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
+  void render(GfxRenderer& renderer, const FontHandle& font, int xOffset, int yOffset) override;
   bool serialize(HalFile& file) override;
   PageElementTag getTag() const override { return TAG_PageHorizontalRule; }
-  static std::unique_ptr<PageHorizontalRule> deserialize(HalFile& file);
+  static PageHorizontalRule* deserialize(HalFile& file, PageArena& arena);
 };
 
 class Page {
  public:
-  // the list of block index and line numbers on this page
-  std::vector<std::shared_ptr<PageElement>> elements;
+  // Backs the elements (and the TextBlocks of their lines), see PageArena
+  PageArena arena;
+  // the list of block index and line numbers on this page. Owned by the page and
+  // allocated in its arena: add them with addElement().
+  std::vector<PageElement*> elements;
   std::vector<FootnoteEntry> footnotes;
   static constexpr uint16_t MAX_FOOTNOTES_PER_PAGE = 16;
+  // Prewarm set recorded when the page was laid out (FontCacheManager::captureGlyphSet): each
+  // codepoint the page draws once, as UTF-8, and the styles it draws them in. A style mask of 0
+  // means nothing was recorded and the reader falls back to a scan pass.
+  std::string glyphSetText;
+  uint8_t glyphSetStyleMask = 0;
+
+  Page() = default;
+  ~Page() {
+    for (PageElement* el : elements) el->~PageElement();
+  }
+  Page(const Page&) = delete;
+  Page& operator=(const Page&) = delete;
+
+  // Construct an element in the page arena and append it; nullptr on OOM.
+  template <typename T, typename... Args>
+  T* addElement(Args&&... args) {
+    T* el = arena.create<T>(std::forward<Args>(args)...);
+    if (el) elements.push_back(el);
+    return el;
+  }
 
   void addFootnote(const char* number, const char* href) {
     if (footnotes.size() >= MAX_FOOTNOTES_PER_PAGE) return;  // Cap per-page footnotes
@@ -88,14 +115,21 @@ class Page {
   }
 
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
+  // Visit the words of every text line in page order. Returns false when fn stopped the walk.
+  bool forEachWord(const TextBlock::WordVisitor& fn) const;
   void renderImages(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
   bool serialize(HalFile& file) const;
   static std::unique_ptr<Page> deserialize(HalFile& file);
+  // forEachWord() over a serialized page, streamed from the file without building
+  // its elements (see TextBlock::forEachSerializedWord). Returns false on a read error.
+  static bool forEachSerializedWord(HalFile& file, const TextBlock::WordVisitor& fn);
+  // Read only the prewarm set at the start of a serialized page. Returns false on a read error.
+  static bool readGlyphSet(HalFile& file, std::string& text, uint8_t& styleMask);
 
   // Check if page contains any images (used to force full refresh)
   bool hasImages() const {
     return std::any_of(elements.begin(), elements.end(),
-                       [](const std::shared_ptr<PageElement>& el) { return el->getTag() == TAG_PageImage; });
+                       [](const PageElement* el) { return el->getTag() == TAG_PageImage; });
   }
 
   // Get bounding box of all images on the page (union of image rects)
@@ -126,3 +160,23 @@ class Page {
     return found;
   }
 };
+
+// Bounded page text for features that only need a prefix of it (bookmark
+// summaries, QR payloads): words joined by single spaces into a caller-owned
+// buffer, cut at a UTF-8 boundary once it is full. Feed it from forEachWord().
+class PageTextSink {
+  char* buffer;
+  size_t capacity;
+  size_t length = 0;
+  bool full = false;
+
+ public:
+  // capacity includes the NUL terminator
+  PageTextSink(char* buffer, size_t capacity);
+
+  // Returns false once the buffer is full, which stops the word walk.
+  bool append(const char* word, uint16_t len);
+  const char* c_str() const { return buffer; }
+  size_t size() const { return length; }
+  bool truncated() const { return full; }
+};
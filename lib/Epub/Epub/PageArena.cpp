@@ -0,0 +1,103 @@
+#include "PageArena.h"
+
+#include <Logging.h>
+
+std::atomic<PageArena::Slab*> PageArena::spares[SPARE_SLABS] = {};
+std::atomic<uint32_t> PageArena::slabsAllocated{0};
+std::atomic<uint32_t> PageArena::slabsReused{0};
+std::atomic<uint32_t> PageArena::oversized{0};
+
+PageArena::~PageArena() {
+  while (head) {
+    Slab* next = head->next;
+    releaseSlab(head);
+    head = next;
+  }
+}
+
+void* PageArena::allocate(const size_t bytes, const size_t align) {
+  if (head) {
+    const size_t start = (head->offset + align - 1) & ~(align - 1);
+    if (start + bytes <= head->capacity) {
+      head->offset = start + bytes;
+      used += bytes;
+      return data(head) + start;
+    }
+  }
+
+  constexpr size_t standardCapacity = SLAB_BYTES - sizeof(Slab);
+  if (bytes > standardCapacity) {
+    // Gets a slab of its own, linked behind the current one so that keeps filling
+    Slab* slab = takeSlab(bytes);
+    if (!slab) {
+      LOG_ERR("PGA", "OOM: %u byte allocation", static_cast<uint32_t>(bytes));
+      return nullptr;
+    }
+    oversized.fetch_add(1, std::memory_order_relaxed);
+    slab->offset = bytes;
+    if (head) {
+      slab->next = head->next;
+      head->next = slab;
+    } else {
+      slab->next = nullptr;
+      head = slab;
+    }
+    used += bytes;
+    return data(slab);
+  }
+
+  Slab* slab = takeSlab(standardCapacity);
+  if (!slab) {
+    LOG_ERR("PGA", "OOM: slab");
+    return nullptr;
+  }
+  slab->next = head;
+  slab->offset = bytes;
+  head = slab;
+  used += bytes;
+  return data(slab);
+}
+
+PageArena::Slab* PageArena::takeSlab(const size_t capacity) {
+  if (capacity == SLAB_BYTES - sizeof(Slab)) {
+    for (auto& spare : spares) {
+      if (Slab* slab = spare.exchange(nullptr, std::memory_order_acquire)) {
+        slabsReused.fetch_add(1, std::memory_order_relaxed);
+        slab->offset = 0;
+        return slab;
+      }
+    }
+  }
+
+  void* mem = ::operator new(sizeof(Slab) + capacity, std::nothrow);
+  if (!mem) {
+    return nullptr;
+  }
+  slabsAllocated.fetch_add(1, std::memory_order_relaxed);
+  return new (mem) Slab{nullptr, capacity, 0};
+}
+
+void PageArena::releaseSlab(Slab* slab) {
+  if (slab->capacity == SLAB_BYTES - sizeof(Slab)) {
+    for (auto& spare : spares) {
+      Slab* empty = nullptr;
+      if (spare.compare_exchange_strong(empty, slab, std::memory_order_release, std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+  ::operator delete(slab);
+}
+
+PageArena::Stats PageArena::getStats() {
+  return Stats{slabsAllocated.load(std::memory_order_relaxed), slabsReused.load(std::memory_order_relaxed),
+               oversized.load(std::memory_order_relaxed)};
+}
+
+void PageArena::releaseSpareSlabs() {
+  for (auto& spare : spares) {
+    if (Slab* slab = spare.exchange(nullptr, std::memory_order_acquire)) {
+      ::operator delete(slab);
+    }
+  }
+}
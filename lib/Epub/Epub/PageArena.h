@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// Bump allocator owned by one Page. The page's elements, their TextBlocks and the
+// word data of deserialized blocks are carved out of a few 4 KB slabs that are
+// released together with the page, instead of several small heap blocks per line
+// that are all freed again on the next page turn (the churn that fragmented the
+// ESP32-C3 heap).
+//
+// Released slabs are parked in a small process-wide spare list and handed to the
+// next page, so steady page turning doesn't touch the heap at all. The spare list
+// is lock-free (atomic slots): pages are built on the render task and by section
+// layout alike.
+//
+// The arena never runs destructors; the owner destroys what it created (Page
+// does it for its elements, PageLine for its TextBlock).
+class PageArena {
+ public:
+  static constexpr size_t SLAB_BYTES = 4096;
+  static constexpr size_t SPARE_SLABS = 4;
+
+  struct Stats {
+    uint32_t slabsAllocated;  // slabs taken from the heap
+    uint32_t slabsReused;     // slabs taken from the spare list
+    uint32_t oversized;       // single allocations too big for a slab
+  };
+
+  PageArena() = default;
+  ~PageArena();
+  PageArena(const PageArena&) = delete;
+  PageArena& operator=(const PageArena&) = delete;
+
+  // nullptr on OOM. `align` must be a power of two no larger than alignof(std::max_align_t).
+  void* allocate(size_t bytes, size_t align);
+
+  // Construct a T in the arena; nullptr on OOM.
+  template <typename T, typename... Args>
+  T* create(Args&&... args) {
+    void* mem = allocate(sizeof(T), alignof(T));
+    return mem ? new (mem) T(std::forward<Args>(args)...) : nullptr;
+  }
+
+  // Bytes handed out so far (excluding alignment padding and slab headers)
+  size_t bytesUsed() const { return used; }
+
+  static Stats getStats();
+  // Return the spare slabs to the heap, e.g. when leaving the reader.
+  static void releaseSpareSlabs();
+
+ private:
+  struct alignas(std::max_align_t) Slab {
+    Slab* next;
+    size_t capacity;  // usable bytes after the header
+    size_t offset;
+  };
+
+  // Usable bytes start right after the header
+  static uint8_t* data(Slab* slab) { return reinterpret_cast<uint8_t*>(slab + 1); }
+
+  Slab* head = nullptr;
+  size_t used = 0;
+
+  static Slab* takeSlab(size_t capacity);
+  static void releaseSlab(Slab* slab);
+  static std::atomic<Slab*> spares[SPARE_SLABS];
+  static std::atomic<uint32_t> slabsAllocated;
+  static std::atomic<uint32_t> slabsReused;
+  static std::atomic<uint32_t> oversized;
+};
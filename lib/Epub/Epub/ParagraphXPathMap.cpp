@@ -0,0 +1,258 @@
+#include "ParagraphXPathMap.h"
+
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr uint16_t MAX_PATHS = ParagraphXPathMap::NO_PATH - 1;
+constexpr size_t READ_CHUNK = 32;
+
+const char* localName(const char* name) {
+  const char* local = std::strrchr(name, ':');
+  return local ? local + 1 : name;
+}
+
+bool isNonVisible(const char* name) {
+  return std::strcmp(name, "head") == 0 || std::strcmp(name, "style") == 0 || std::strcmp(name, "script") == 0 ||
+         std::strcmp(name, "title") == 0;
+}
+
+const char* kindTag(const ParagraphXPathMap::Kind kind) {
+  return kind == ParagraphXPathMap::Kind::Paragraph ? "p" : "li";
+}
+}  // namespace
+
+bool ParagraphXPathMap::load(HalFile&& sectionFile, const uint32_t offset) {
+  file = std::move(sectionFile);
+  paths.clear();
+  counts[0] = counts[1] = 0;
+
+  const uint32_t fileSize = file.size();
+  if (offset == 0 || offset >= fileSize || !file.seek(offset)) {
+    return false;
+  }
+
+  uint16_t pathCount;
+  serialization::readPod(file, totalBytes);
+  serialization::readPod(file, mappedEnd);
+  serialization::readPod(file, totalVisibleChars);
+  serialization::readPod(file, pathCount);
+  paths.resize(pathCount);
+  for (auto& path : paths) {
+    uint32_t len;
+    serialization::readPod(file, len);
+    if (file.position() + len > fileSize) {
+      LOG_ERR("XPM", "Malformed path dictionary");
+      paths.clear();
+      return false;
+    }
+    path.resize(len);
+    file.read(&path[0], len);
+  }
+
+  for (int kind = 0; kind < 2; kind++) {
+    serialization::readPod(file, counts[kind]);
+    entriesOffset[kind] = file.position();
+    const uint32_t end = entriesOffset[kind] + sizeof(Entry) * counts[kind];
+    if (end > fileSize || (kind == 0 && !file.seek(end))) {
+      LOG_ERR("XPM", "Malformed entry table");
+      counts[0] = counts[1] = 0;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ParagraphXPathMap::readEntry(const Kind kind, const uint16_t index, Entry& out) {
+  const int k = static_cast<int>(kind);
+  if (index == 0 || index > counts[k]) {
+    return false;
+  }
+  return file.seek(entriesOffset[k] + sizeof(Entry) * (index - 1)) &&
+         file.read(&out, sizeof(Entry)) == static_cast<int>(sizeof(Entry));
+}
+
+std::string ParagraphXPathMap::xpathFor(const Kind kind, const uint16_t index, const int spineIndex) {
+  Entry entry;
+  if (!readEntry(kind, index, entry) || entry.pathId >= paths.size()) {
+    return "";
+  }
+  return "/body/DocFragment[" + std::to_string(spineIndex + 1) + "]/body" + paths[entry.pathId] + "/" +
+         kindTag(kind) + "[" + std::to_string(entry.siblingIndex) + "]";
+}
+
+uint16_t ParagraphXPathMap::find(const Kind kind, const std::string& parentPath, const uint16_t siblingIndex,
+                                 Entry& out) {
+  uint16_t pathId = 0;
+  while (pathId < paths.size() && paths[pathId] != parentPath) {
+    pathId++;
+  }
+  if (pathId == paths.size()) {
+    return 0;
+  }
+
+  const int k = static_cast<int>(kind);
+  Entry chunk[READ_CHUNK];
+  for (uint16_t start = 0; start < counts[k];) {
+    const uint16_t n = std::min<uint16_t>(READ_CHUNK, counts[k] - start);
+    const int bytes = static_cast<int>(sizeof(Entry) * n);
+    if (!file.seek(entriesOffset[k] + sizeof(Entry) * start) || file.read(chunk, bytes) != bytes) {
+      LOG_ERR("XPM", "Failed to read entries");
+      return 0;
+    }
+    for (uint16_t i = 0; i < n; i++) {
+      if (chunk[i].pathId == pathId && chunk[i].siblingIndex == siblingIndex) {
+        out = chunk[i];
+        return start + i + 1;
+      }
+    }
+    start += n;
+  }
+  return 0;
+}
+
+uint16_t ParagraphXPathMap::countAtOffset(const Kind kind, const uint32_t byteOffset) {
+  // Entries are in document order, so offsets ascend
+  uint16_t lo = 0;
+  uint16_t hi = count(kind);
+  while (lo < hi) {
+    const uint16_t mid = lo + (hi - lo) / 2;
+    Entry entry;
+    if (!readEntry(kind, mid + 1, entry)) {
+      return lo;
+    }
+    if (entry.byteOffset <= byteOffset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+uint16_t ParagraphXPathMapBuilder::internTag(const char* name) {
+  for (uint16_t i = 0; i < tagNames.size(); i++) {
+    if (tagNames[i] == name) return i;
+  }
+  tagNames.emplace_back(name);
+  return static_cast<uint16_t>(tagNames.size() - 1);
+}
+
+void ParagraphXPathMapBuilder::pushElement(const char* rawName) {
+  const char* name = localName(rawName);
+  if (nonVisibleDepth > 0 || isNonVisible(name)) {
+    nonVisibleDepth++;
+  }
+  if (!insideBody) {
+    if (std::strcmp(name, "body") == 0) {
+      insideBody = true;
+      counters.clear();
+      path.clear();
+    }
+    return;
+  }
+
+  const uint16_t tagId = internTag(name);
+  const size_t siblingsStart = path.empty() ? 0 : path.back().childCounters;
+  uint16_t siblingIndex = 1;
+  size_t i = siblingsStart;
+  for (; i < counters.size(); i++) {
+    if (counters[i].tagId == tagId) {
+      siblingIndex = ++counters[i].count;
+      break;
+    }
+  }
+  if (i == counters.size()) {
+    counters.push_back({tagId, 1});
+  }
+  path.push_back({tagId, siblingIndex, static_cast<uint16_t>(counters.size())});
+}
+
+void ParagraphXPathMapBuilder::popElement() {
+  if (nonVisibleDepth > 0) {
+    nonVisibleDepth--;
+  }
+  if (!insideBody) {
+    return;
+  }
+  if (path.empty()) {
+    // </body>
+    insideBody = false;
+    return;
+  }
+  counters.resize(path.back().childCounters);
+  path.pop_back();
+}
+
+void ParagraphXPathMapBuilder::addText(const char* text, const int len) {
+  if (nonVisibleDepth > 0) {
+    return;
+  }
+  for (int i = 0; i < len; i++) {
+    if ((static_cast<uint8_t>(text[i]) & 0xC0) != 0x80) visibleChars++;
+  }
+}
+
+uint16_t ParagraphXPathMapBuilder::internParentPath() {
+  scratch.clear();
+  for (size_t i = 0; i + 1 < path.size(); i++) {
+    scratch += '/';
+    scratch += tagNames[path[i].tagId];
+    scratch += '[';
+    scratch += std::to_string(path[i].siblingIndex);
+    scratch += ']';
+  }
+
+  // Consecutive paragraphs nearly always share their parent
+  if (lastPathId < paths.size() && paths[lastPathId] == scratch) {
+    return lastPathId;
+  }
+  for (uint16_t id = 0; id < paths.size(); id++) {
+    if (paths[id] == scratch) {
+      lastPathId = id;
+      return id;
+    }
+  }
+  if (paths.size() >= MAX_PATHS) {
+    return ParagraphXPathMap::NO_PATH;
+  }
+  paths.push_back(scratch);
+  lastPathId = static_cast<uint16_t>(paths.size() - 1);
+  return lastPathId;
+}
+
+void ParagraphXPathMapBuilder::recordCurrent(const ParagraphXPathMap::Kind kind, const uint32_t byteOffset) {
+  auto& list = entries[static_cast<int>(kind)];
+  if (list.size() >= MAX_ENTRIES) {
+    truncatedAt = std::min(truncatedAt, byteOffset);
+    return;
+  }
+  if (!insideBody || path.empty()) {
+    list.push_back({byteOffset, visibleChars, ParagraphXPathMap::NO_PATH, 0});
+    return;
+  }
+  list.push_back({byteOffset, visibleChars, internParentPath(), path.back().siblingIndex});
+}
+
+bool ParagraphXPathMapBuilder::serialize(HalFile& file, const uint32_t htmlBytes, const uint32_t parsedBytes) const {
+  const bool complete = parsedBytes >= htmlBytes;
+  serialization::writePod(file, htmlBytes);
+  serialization::writePod(file, std::min({htmlBytes, parsedBytes, truncatedAt}));
+  serialization::writePod(file, complete ? visibleChars : 0u);
+  serialization::writePod(file, static_cast<uint16_t>(paths.size()));
+  for (const auto& p : paths) {
+    serialization::writeString(file, p);
+  }
+  for (const auto& list : entries) {
+    serialization::writePod(file, static_cast<uint16_t>(list.size()));
+    const size_t bytes = sizeof(ParagraphXPathMap::Entry) * list.size();
+    if (bytes > 0 && file.write(list.data(), bytes) != bytes) {
+      LOG_ERR("XPM", "Failed to write entries");
+      return false;
+    }
+  }
+  return true;
+}
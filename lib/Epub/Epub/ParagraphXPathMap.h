@@ -0,0 +1,124 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Where each paragraph the layout counted starts in the chapter's XHTML, persisted
+// in the section cache so KOReader sync can turn a paragraph index into an XPath
+// (and an XPath back into paragraph/list-item indices) without re-parsing the
+// chapter.
+//
+// Indices are the section layout's running <p> and <li> counters (the same values
+// as the paragraph and list-item LUTs). Each entry stores the element's parent
+// ancestry as an id into a path dictionary ("/div[2]/section[1]", "" for a direct
+// child of <body>), its own sibling index, the byte offset of its start tag and the
+// number of visible characters before it. Visible characters are counted the way
+// KOReader positions are: text codepoints outside <head>, <style>, <script> and
+// <title>, with entities resolved.
+//
+// A map can stop short of the chapter end: a partial build's map covers what was
+// parsed so far, and the builder drops entries past MAX_ENTRIES. mappedBytes() is
+// where that coverage ends; positions past it must be resolved from the XHTML.
+class ParagraphXPathMap {
+ public:
+  enum class Kind : uint8_t { Paragraph = 0, ListItem = 1 };
+
+  struct Entry {
+    uint32_t byteOffset;
+    uint32_t visibleChars;
+    uint16_t pathId;  // NO_PATH when the element was outside <body>
+    uint16_t siblingIndex;
+  } __attribute__((packed));
+
+  static constexpr uint16_t NO_PATH = 0xFFFF;
+
+  // Read the map stored at `offset` in an open section file (see Section::openXPathMap).
+  // Only the header and path dictionary are loaded; entries are read on demand.
+  bool load(HalFile&& sectionFile, uint32_t offset);
+
+  uint32_t htmlBytes() const { return totalBytes; }
+  // Every element starting before this byte offset is mapped; htmlBytes() for a full map
+  uint32_t mappedBytes() const { return mappedEnd; }
+  // Visible characters in the whole chapter; 0 for a partial build's map, which
+  // hasn't seen the end of the chapter
+  uint32_t htmlVisibleChars() const { return totalVisibleChars; }
+  uint16_t count(Kind kind) const { return counts[static_cast<int>(kind)]; }
+
+  // Entry for a 1-based index; false if it isn't mapped
+  bool readEntry(Kind kind, uint16_t index, Entry& out);
+
+  // KOReader XPath of the element at a 1-based index, e.g.
+  // /body/DocFragment[8]/body/div[2]/section[1]/p[4]. Empty if it isn't mapped.
+  std::string xpathFor(Kind kind, uint16_t index, int spineIndex);
+
+  // 1-based index of the element with the given parent path and sibling index, or 0
+  uint16_t find(Kind kind, const std::string& parentPath, uint16_t siblingIndex, Entry& out);
+
+  // Value of the running counter for `kind` at byteOffset: the number of elements
+  // starting at or before it
+  uint16_t countAtOffset(Kind kind, uint32_t byteOffset);
+
+ private:
+  HalFile file;
+  uint32_t totalBytes = 0;
+  uint32_t mappedEnd = 0;
+  uint32_t totalVisibleChars = 0;
+  std::vector<std::string> paths;
+  uint16_t counts[2] = {};
+  uint32_t entriesOffset[2] = {};
+};
+
+// Collects a ParagraphXPathMap while ChapterHtmlSlimParser lays out a section.
+class ParagraphXPathMapBuilder {
+ public:
+  // Bounds RAM use on giant single-file books; later paragraphs aren't mapped
+  // (the map's mappedBytes() ends at the first one) and sync parses the XHTML for them
+  static constexpr size_t MAX_ENTRIES = 4096;
+
+  // Called for every element, including ones the layout skips, so sibling indices
+  // match the XHTML as KOReader sees it.
+  void pushElement(const char* name);
+  void popElement();
+  // Called for all character data, including text the layout skips, with entities
+  // already resolved
+  void addText(const char* text, int len);
+  // Record the element just pushed as the next <p> or <li> the layout counted
+  void recordCurrent(ParagraphXPathMap::Kind kind, uint32_t byteOffset);
+
+  // parsedBytes: how much of the chapter's htmlBytes the parser has consumed. When it
+  // covers the whole chapter, the visible character total is known.
+  bool serialize(HalFile& file, uint32_t htmlBytes, uint32_t parsedBytes) const;
+
+ private:
+  struct SiblingCounter {
+    uint16_t tagId;
+    uint16_t count;
+  };
+  struct Segment {
+    uint16_t tagId;
+    uint16_t siblingIndex;
+    // Start of this element's child counters in `counters`
+    uint16_t childCounters;
+  };
+
+  bool insideBody = false;
+  // Depth inside <head>, <style>, <script> or <title>, whose text isn't visible
+  uint16_t nonVisibleDepth = 0;
+  uint32_t visibleChars = 0;
+  // Byte offset of the first element dropped past MAX_ENTRIES
+  uint32_t truncatedAt = UINT32_MAX;
+  std::vector<std::string> tagNames;
+  // Sibling counters of every open element below <body>, innermost last
+  std::vector<SiblingCounter> counters;
+  std::vector<Segment> path;
+  std::vector<std::string> paths;
+  uint16_t lastPathId = ParagraphXPathMap::NO_PATH;
+  std::string scratch;
+  std::vector<ParagraphXPathMap::Entry> entries[2];
+
+  uint16_t internTag(const char* name);
+  uint16_t internParentPath();
+};
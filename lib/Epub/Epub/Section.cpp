@@ -1,5 +1,7 @@
 #include "Section.h"
 
+#include <FontCacheManager.h>
+#include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <Memory.h>
@@ -7,13 +9,18 @@
 
 #include "Epub/css/CssParser.h"
 #include "Page.h"
+#include "ParagraphXPathMap.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
 // v29: TextBlock word data stored as one flat arena (offset table + NUL-terminated
 // text blob) instead of length-prefixed strings and per-field arrays.
-constexpr uint8_t SECTION_FILE_VERSION = 29;
+// v30: paragraph XPath map (see ParagraphXPathMap) after the LUTs, offset in the header.
+// v31: per-page prewarm glyph set at the start of each page record.
+// v32: visible-character offsets in the paragraph XPath map.
+// v33: mapped byte extent in the paragraph XPath map.
+constexpr uint8_t SECTION_FILE_VERSION = 33;
 // Written into the version field while a build is in progress; patched to
 // SECTION_FILE_VERSION only when the build is finalized. An abandoned /
 // crash-interrupted .bin therefore carries version 0, which loadSectionFile rejects
@@ -34,7 +41,14 @@ constexpr uint8_t SECTION_FILE_PARTIAL_VERSION = 0xFE - (SECTION_FILE_VERSION -
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint8_t) + sizeof(bool) + sizeof(uint32_t) + sizeof(uint32_t) +
-                                 sizeof(uint32_t) + sizeof(uint32_t);
+                                 sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t);
+// Positions of the fields patched on commit, at the end of the header
+constexpr uint32_t XPATH_MAP_OFFSET_POS = HEADER_SIZE - sizeof(uint32_t);
+constexpr uint32_t LI_LUT_OFFSET_POS = XPATH_MAP_OFFSET_POS - sizeof(uint32_t);
+constexpr uint32_t PARAGRAPH_LUT_OFFSET_POS = LI_LUT_OFFSET_POS - sizeof(uint32_t);
+constexpr uint32_t ANCHOR_MAP_OFFSET_POS = PARAGRAPH_LUT_OFFSET_POS - sizeof(uint32_t);
+constexpr uint32_t LUT_OFFSET_POS = ANCHOR_MAP_OFFSET_POS - sizeof(uint32_t);
+constexpr uint32_t PAGE_COUNT_POS = LUT_OFFSET_POS - sizeof(uint16_t);
 }  // namespace
 
 // Out-of-line so the unique_ptr<ChapterHtmlSlimParser> in BuildContext can be
@@ -50,12 +64,20 @@ Section::Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRen
 // (no-op once a build has completed or never started).
 Section::~Section() { suspendBuild(); }
 
-uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
+uint32_t Section::onPageComplete(std::unique_ptr<Page> page, const int fontId) {
   if (!file) {
     LOG_ERR("SCT", "File not open for writing page %d", builtPageCount_);
     return 0;
   }
 
+  // Record the glyphs the page draws, so the reader can prewarm the font caches from the
+  // section file instead of a scan render on every page turn
+  if (FontCacheManager* fcm = renderer.getFontCacheManager()) {
+    const Page& laidOut = *page;
+    page->glyphSetStyleMask =
+        fcm->captureGlyphSet([&]() { laidOut.render(renderer, fontId, 0, 0); }, page->glyphSetText);
+  }
+
   const uint32_t position = file.position();
   if (!page->serialize(file)) {
     LOG_ERR("SCT", "Failed to serialize page %d", builtPageCount_);
@@ -85,7 +107,8 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
                                    sizeof(extraParagraphSpacing) + sizeof(paragraphAlignment) + sizeof(viewportWidth) +
                                    sizeof(viewportHeight) + sizeof(pageCount) + sizeof(hyphenationEnabled) +
                                    sizeof(embeddedStyle) + sizeof(imageRendering) + sizeof(focusReadingEnabled) +
-                                   sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t),
+                                   sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t) +
+                                   sizeof(uint32_t),
                 "Header size mismatch");
   // Written as the incomplete sentinel; finalizeBuild() patches it to
   // SECTION_FILE_VERSION as the last step, committing the file.
@@ -105,6 +128,7 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
   serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for anchor map offset (patched later)
   serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for paragraph LUT offset (patched later)
   serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for li LUT offset (patched later)
+  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for XPath map offset (patched later)
 }
 
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
@@ -167,7 +191,7 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
     // A partial's pageCount is the watermark of a suspended build. Read the watermark
     // trailer (appended after the li LUT) so estimatedTotalPages can extrapolate.
     uint32_t liLutOffset = 0;
-    file.seek(HEADER_SIZE - sizeof(uint32_t));
+    file.seek(LI_LUT_OFFSET_POS);
     serialization::readPod(file, liLutOffset);
     const uint32_t trailerOffset = liLutOffset + static_cast<uint32_t>(pageCount) * sizeof(uint16_t);
     const bool trailerValid =
@@ -380,8 +404,8 @@ bool Section::startBuild(const int fontId, const float lineCompression, const bo
   ctx->parser = makeUniqueNoThrow<ChapterHtmlSlimParser>(
       epub, ctxPtr->parsePath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment,
       viewportWidth, viewportHeight, hyphenationEnabled, focusReadingEnabled,
-      [this, ctxPtr](std::unique_ptr<Page> page, const uint16_t paragraphIndex, const uint16_t listItemIndex) {
-        ctxPtr->lut.push_back({this->onPageComplete(std::move(page)), paragraphIndex, listItemIndex});
+      [this, ctxPtr, fontId](std::unique_ptr<Page> page, const uint16_t paragraphIndex, const uint16_t listItemIndex) {
+        ctxPtr->lut.push_back({this->onPageComplete(std::move(page), fontId), paragraphIndex, listItemIndex});
       },
       embeddedStyle, ctxPtr->contentBase, ctxPtr->imageBasePath, imageRendering, std::move(tocAnchors), popupFn,
       ctxPtr->cssParser);
@@ -554,13 +578,21 @@ bool Section::commitBuildFile(const uint8_t version, const uint32_t bytesConsume
     serialization::writePod(file, totalBytes);
   }
 
+  // Paragraph XPath map for KOReader sync. A partial's map covers what was parsed so far.
+  uint32_t xpathMapOffset = static_cast<uint32_t>(file.position());
+  if (!build_->parser->getXPathMap().serialize(file, build_->totalBytes,
+                                               asPartial ? bytesConsumed : build_->totalBytes)) {
+    xpathMapOffset = 0;
+  }
+
   // Patch header with the built page count and section offsets...
-  file.seek(HEADER_SIZE - sizeof(uint32_t) * 4 - sizeof(builtPageCount_));
+  file.seek(PAGE_COUNT_POS);
   serialization::writePod(file, builtPageCount_);
   serialization::writePod(file, lutOffset);
   serialization::writePod(file, anchorMapOffset);
   serialization::writePod(file, paragraphLutOffset);
   serialization::writePod(file, liLutFileOffset);
+  serialization::writePod(file, xpathMapOffset);
   // ...then commit by overwriting the sentinel version with the real one. Writing the
   // version last makes it the commit point: a crash before here leaves version 0.
   file.seek(0);
@@ -702,7 +734,7 @@ std::unique_ptr<Page> Section::loadPageAt(const int page) const {
     return nullptr;
   }
 
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 4);
+  f.seek(LUT_OFFSET_POS);
   uint32_t lutOffset;
   serialization::readPod(f, lutOffset);
   f.seek(lutOffset + sizeof(uint32_t) * page);
@@ -730,24 +762,101 @@ std::unique_ptr<Page> Section::loadPage(const int page) {
   return loadPageAt(page);
 }
 
-std::string Section::getTextFromSectionFile() {
-  std::string fullText;
-  auto p = loadPage(currentPage);
-  if (p) {
-    for (const auto& el : p->elements) {
-      if (el->getTag() == TAG_PageLine) {
-        const auto& line = static_cast<const PageLine&>(*el);
-        if (line.getBlock()) {
-          const auto& block = *line.getBlock();
-          for (uint16_t i = 0; i < block.wordCount(); i++) {
-            if (!fullText.empty()) fullText += " ";
-            fullText += block.wordText(i);
-          }
-        }
-      }
+bool Section::forEachWordOnPage(const int page, const TextBlock::WordVisitor& fn) {
+  if (page < 0) {
+    return false;
+  }
+  if (build_ && page < static_cast<int>(build_->lut.size())) {
+    const auto p = loadPageDuringBuild(page);
+    if (!p) {
+      return false;
+    }
+    p->forEachWord(fn);
+    return true;
+  }
+  const int onDisk = partial_ ? partialPageCount_ : (build_ ? 0 : pageCount);
+  if (page >= onDisk) {
+    return false;
+  }
+
+  HalFile f;
+  if (!Storage.openFileForRead("SCT", filePath, f)) {
+    return false;
+  }
+  f.seek(LUT_OFFSET_POS);
+  uint32_t lutOffset;
+  serialization::readPod(f, lutOffset);
+  f.seek(lutOffset + sizeof(uint32_t) * page);
+  uint32_t pagePos;
+  serialization::readPod(f, pagePos);
+  return f.seek(pagePos) && Page::forEachSerializedWord(f, fn);
+}
+
+bool Section::loadPageGlyphSet(const int page, std::string& text, uint8_t& styleMask) {
+  if (page < 0) {
+    return false;
+  }
+  if (build_ && page < static_cast<int>(build_->lut.size())) {
+    const uint32_t pos = build_->lut[page].fileOffset;
+    if (pos == 0 || !file) {
+      return false;
+    }
+    // Same as loadPageDuringBuild: read, then restore the build's write cursor
+    const uint32_t writePos = file.position();
+    const bool ok = file.seek(pos) && Page::readGlyphSet(file, text, styleMask);
+    file.seek(writePos);
+    return ok;
+  }
+  const int onDisk = partial_ ? partialPageCount_ : (build_ ? 0 : pageCount);
+  if (page >= onDisk) {
+    return false;
+  }
+
+  HalFile f;
+  if (!Storage.openFileForRead("SCT", filePath, f)) {
+    return false;
+  }
+  f.seek(LUT_OFFSET_POS);
+  uint32_t lutOffset;
+  serialization::readPod(f, lutOffset);
+  f.seek(lutOffset + sizeof(uint32_t) * page);
+  uint32_t pagePos;
+  serialization::readPod(f, pagePos);
+  return f.seek(pagePos) && Page::readGlyphSet(f, text, styleMask);
+}
+
+int Section::forEachPage(const int first, const int count, const std::function<bool(int, const Page&)>& fn) const {
+  const int end = std::min(first + count, static_cast<int>(pageCount));
+  if (first < 0 || first >= end || build_) {
+    return 0;
+  }
+  HalFile f;
+  if (!Storage.openFileForRead("SCT", filePath, f)) {
+    return 0;
+  }
+
+  f.seek(LUT_OFFSET_POS);
+  uint32_t lutOffset;
+  serialization::readPod(f, lutOffset);
+  std::vector<uint32_t> offsets(end - first);
+  const int lutBytes = static_cast<int>(sizeof(uint32_t) * offsets.size());
+  if (!f.seek(lutOffset + sizeof(uint32_t) * first) || f.read(offsets.data(), lutBytes) != lutBytes) {
+    LOG_ERR("SCT", "Failed to read page LUT");
+    return 0;
+  }
+
+  int read = 0;
+  for (const uint32_t offset : offsets) {
+    f.seek(offset);
+    const auto page = Page::deserialize(f);
+    if (!page) {
+      break;
+    }
+    if (!fn(first + read++, *page)) {
+      break;
     }
   }
-  return fullText;
+  return read;
 }
 
 std::optional<uint16_t> Section::getCachedPageCount() const {
@@ -770,7 +879,7 @@ std::optional<uint16_t> Section::getCachedPageCount() const {
     return std::nullopt;
   }
 
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 4 - sizeof(uint16_t));
+  f.seek(PAGE_COUNT_POS);
   uint16_t count;
   serialization::readPod(f, count);
   return count;
@@ -783,7 +892,7 @@ std::optional<uint16_t> Section::getPageForAnchor(const std::string& anchor) con
   }
 
   const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 3);
+  f.seek(ANCHOR_MAP_OFFSET_POS);
   uint32_t anchorMapOffset;
   serialization::readPod(f, anchorMapOffset);
   if (anchorMapOffset == 0 || anchorMapOffset >= fileSize) {
@@ -813,7 +922,7 @@ std::optional<uint16_t> Section::getPageForParagraphIndex(const uint16_t pIndex)
   }
 
   const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
+  f.seek(PARAGRAPH_LUT_OFFSET_POS);
   uint32_t paragraphLutOffset;
   serialization::readPod(f, paragraphLutOffset);
   if (paragraphLutOffset == 0 || paragraphLutOffset >= fileSize) {
@@ -852,7 +961,7 @@ std::optional<uint16_t> Section::getParagraphIndexForPage(const uint16_t page) c
   }
 
   const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
+  f.seek(PARAGRAPH_LUT_OFFSET_POS);
   uint32_t paragraphLutOffset;
   serialization::readPod(f, paragraphLutOffset);
   if (paragraphLutOffset == 0 || paragraphLutOffset >= fileSize) {
@@ -884,7 +993,7 @@ std::optional<uint16_t> Section::getPageForListItemIndex(const uint16_t liIndex)
   }
 
   const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t));
+  f.seek(LI_LUT_OFFSET_POS);
   uint32_t liLutOffset;
   serialization::readPod(f, liLutOffset);
   if (liLutOffset == 0 || liLutOffset >= fileSize) {
@@ -892,7 +1001,7 @@ std::optional<uint16_t> Section::getPageForListItemIndex(const uint16_t liIndex)
   }
 
   // The li LUT shares count with the paragraph LUT; read count from paragraphLutOffset
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
+  f.seek(PARAGRAPH_LUT_OFFSET_POS);
   uint32_t paragraphLutOffset;
   serialization::readPod(f, paragraphLutOffset);
   if (paragraphLutOffset == 0 || paragraphLutOffset >= fileSize) {
@@ -924,3 +1033,30 @@ std::optional<uint16_t> Section::getPageForListItemIndex(const uint16_t liIndex)
 
   return resultPage;
 }
+
+bool Section::openXPathMap(const std::shared_ptr<Epub>& epub, const int spineIndex, ParagraphXPathMap& map) {
+  if (!epub) {
+    return false;
+  }
+  HalFile f;
+  const std::string path = epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin";
+  if (!Storage.openFileForRead("SCT", path, f)) {
+    return false;
+  }
+  if (f.size() < HEADER_SIZE) {
+    return false;
+  }
+
+  // The map describes the XHTML, not the layout, so any committed file will do
+  // regardless of the settings it was built with. A partial maps the part it parsed.
+  uint8_t version;
+  serialization::readPod(f, version);
+  if (version != SECTION_FILE_VERSION && version != SECTION_FILE_PARTIAL_VERSION) {
+    return false;
+  }
+
+  f.seek(XPATH_MAP_OFFSET_POS);
+  uint32_t xpathMapOffset;
+  serialization::readPod(f, xpathMapOffset);
+  return map.load(std::move(f), xpathMapOffset);
+}
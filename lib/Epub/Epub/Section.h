@@ -6,11 +6,13 @@
 #include <vector>
 
 #include "Epub.h"
+#include "blocks/TextBlock.h"
 
 class Page;
 class GfxRenderer;
 class ChapterHtmlSlimParser;
 class CssParser;
+class ParagraphXPathMap;
 
 class Section {
   std::shared_ptr<Epub> epub;
@@ -22,7 +24,7 @@ class Section {
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle, uint8_t imageRendering, bool focusReadingEnabled);
-  uint32_t onPageComplete(std::unique_ptr<Page> page);
+  uint32_t onPageComplete(std::unique_ptr<Page> page, int fontId);
 
   // Page-offset table entry, kept in RAM while an incremental build is running so
   // already-built pages can be located in the partially-written .bin.
@@ -125,7 +127,19 @@ class Section {
   // the on-disk file (finalized section, or a partial the rebuild hasn't caught up to).
   std::unique_ptr<Page> loadPage(int page);
 
-  std::string getTextFromSectionFile();
+  // Visit the words of a page without materializing it: committed pages are streamed
+  // straight from the section file, pages of the active build go through loadPage().
+  // False if the page is missing or unreadable.
+  bool forEachWordOnPage(int page, const TextBlock::WordVisitor& fn);
+
+  // Read only a page's recorded prewarm set (see Page::glyphSetText), from the active build
+  // or the file on disk like forEachWordOnPage(). False if the page is missing or unreadable.
+  bool loadPageGlyphSet(int page, std::string& text, uint8_t& styleMask);
+
+  // Read committed pages [first, first + count) in order through one open file, for
+  // whole-chapter scans such as search. Stops early when fn returns false. Returns
+  // the number of pages read.
+  int forEachPage(int first, int count, const std::function<bool(int, const Page&)>& fn) const;
 
   // Resolve an anchor from the in-progress build first, then the on-disk anchor map
   // (covers finalized sections and partials from a previous session).
@@ -154,4 +168,8 @@ class Section {
 
   // Look up the synthetic paragraph index for the given rendered page.
   std::optional<uint16_t> getParagraphIndexForPage(uint16_t page) const;
+
+  // Open the paragraph XPath map of a spine's cached section file, whatever settings
+  // it was laid out with. False if the spine has no committed section file yet.
+  static bool openXPathMap(const std::shared_ptr<Epub>& epub, int spineIndex, ParagraphXPathMap& map);
 };
@@ -0,0 +1,77 @@
+#include "WordWidthCache.h"
+
+#include <Memory.h>
+
+#include <cstring>
+
+uint64_t WordWidthCache::hashWord(const char* word, const size_t len, const uint8_t style) {
+  uint64_t hash = 14695981039346656037ull ^ style;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ static_cast<uint8_t>(word[i])) * 1099511628211ull;
+  }
+  return hash;
+}
+
+bool WordWidthCache::prepare(const int fontId) {
+  if (fontId != this->fontId) {
+    clear();
+    this->fontId = fontId;
+  }
+  if (!entries && !allocFailed) {
+    entries = makeUniqueNoThrow<Entry[]>(CAPACITY);
+    allocFailed = !entries;
+  }
+  return entries != nullptr;
+}
+
+bool WordWidthCache::lookup(const int fontId, const uint8_t style, const char* word, const size_t len,
+                            uint16_t& width) {
+  if (len == 0 || len > MAX_WORD_BYTES || !prepare(fontId)) {
+    stats.misses++;
+    return false;
+  }
+  const uint64_t hash = hashWord(word, len, style);
+  const auto hashLow = static_cast<uint32_t>(hash);
+  const auto hashHigh = static_cast<uint32_t>(hash >> 32);
+  for (size_t probe = 0; probe < MAX_PROBES; probe++) {
+    const Entry& entry = entries[(hashLow + probe) & (CAPACITY - 1)];
+    if (entry.len == 0) {
+      break;
+    }
+    if (entry.hashLow == hashLow && entry.hashHigh == hashHigh && entry.len == len && entry.style == style) {
+      width = entry.width;
+      stats.hits++;
+      return true;
+    }
+  }
+  stats.misses++;
+  return false;
+}
+
+void WordWidthCache::store(const int fontId, const uint8_t style, const char* word, const size_t len,
+                           const uint16_t width) {
+  if (len == 0 || len > MAX_WORD_BYTES || !prepare(fontId)) {
+    return;
+  }
+  const uint64_t hash = hashWord(word, len, style);
+  const auto hashLow = static_cast<uint32_t>(hash);
+  Entry* slot = &entries[hashLow & (CAPACITY - 1)];
+  for (size_t probe = 0; probe < MAX_PROBES; probe++) {
+    Entry& entry = entries[(hashLow + probe) & (CAPACITY - 1)];
+    if (entry.len == 0) {
+      slot = &entry;
+      break;
+    }
+  }
+  if (slot->len != 0) {
+    stats.evictions++;
+  }
+  *slot = Entry{hashLow, static_cast<uint32_t>(hash >> 32), width, static_cast<uint8_t>(len), style};
+}
+
+void WordWidthCache::clear() {
+  if (entries) {
+    memset(entries.get(), 0, CAPACITY * sizeof(Entry));
+  }
+  fontId = -1;
+}
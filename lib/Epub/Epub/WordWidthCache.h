@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Memo of measured word widths for one section build.
+//
+// Laying out a chapter measures every word, and most of them are the same few
+// hundred ("the", "and", "said", ...). Each measurement walks the UTF-8, applies
+// ligatures and searches glyph intervals and kerning classes per codepoint, so a
+// hit here turns that into one hash of the word bytes.
+//
+// Fixed-size open-addressing table, allocated on first use (12 KB) and never
+// grown. A key is (64-bit word hash, length, style) under the current font; the
+// word bytes aren't kept, so the hash is wide enough that a collision (which
+// would bake a wrong width into the section's layout) doesn't happen. A lookup
+// with another font id drops everything. Probing is bounded: when every slot on
+// a word's probe path is taken, the home slot is overwritten, so words that keep
+// coming back win their slot back on the next miss.
+class WordWidthCache {
+ public:
+  static constexpr size_t CAPACITY = 1024;  // power of two
+  static constexpr size_t MAX_PROBES = 4;
+  static constexpr size_t MAX_WORD_BYTES = 255;
+
+  struct Stats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;  // stores that overwrote a live entry
+  };
+
+  WordWidthCache() = default;
+  WordWidthCache(const WordWidthCache&) = delete;
+  WordWidthCache& operator=(const WordWidthCache&) = delete;
+
+  // True and fills `width` when the word was measured before with this font and style
+  bool lookup(int fontId, uint8_t style, const char* word, size_t len, uint16_t& width);
+  // Remember a width measured after a failed lookup(). Ignored when the table couldn't be allocated.
+  void store(int fontId, uint8_t style, const char* word, size_t len, uint16_t width);
+  void clear();
+
+  const Stats& getStats() const { return stats; }
+
+ private:
+  // The hash is split in two halves so entries stay 4-byte aligned at 12 bytes
+  struct Entry {
+    uint32_t hashLow;
+    uint32_t hashHigh;
+    uint16_t width;
+    uint8_t len;  // 0: empty slot
+    uint8_t style;
+  };
+
+  std::unique_ptr<Entry[]> entries;
+  bool allocFailed = false;
+  int fontId = -1;
+  Stats stats{};
+
+  bool prepare(int fontId);
+  // FNV-1a 64-bit over the style and the word bytes
+  static uint64_t hashWord(const char* word, size_t len, uint8_t style);
+};
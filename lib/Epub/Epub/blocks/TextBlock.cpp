@@ -5,9 +5,33 @@
 #include <Logging.h>
 #include <Memory.h>
 #include <Serialization.h>
+#include <Utf8.h>
 
+#include "Epub/PageArena.h"
+
+#include <algorithm>
 #include <cstring>
 
+namespace {
+// Style (alignment + margins/padding/indent), as written by TextBlock::serialize
+void readBlockStyle(HalFile& file, BlockStyle& blockStyle) {
+  serialization::readPod(file, blockStyle.alignment);
+  serialization::readPod(file, blockStyle.textAlignDefined);
+  serialization::readPod(file, blockStyle.marginTop);
+  serialization::readPod(file, blockStyle.marginBottom);
+  serialization::readPod(file, blockStyle.marginLeft);
+  serialization::readPod(file, blockStyle.marginRight);
+  serialization::readPod(file, blockStyle.paddingTop);
+  serialization::readPod(file, blockStyle.paddingBottom);
+  serialization::readPod(file, blockStyle.paddingLeft);
+  serialization::readPod(file, blockStyle.paddingRight);
+  serialization::readPod(file, blockStyle.textIndent);
+  serialization::readPod(file, blockStyle.textIndentDefined);
+  serialization::readPod(file, blockStyle.isRtl);
+  serialization::readPod(file, blockStyle.directionDefined);
+}
+}  // namespace
+
 size_t TextBlock::arenaSize(const uint16_t wordCount, const bool hasFocus, const uint16_t textBytes) {
   // Layout documented in TextBlock.h: 16-bit arrays first, then 8-bit arrays, then text.
   size_t size = static_cast<size_t>(wordCount) * (sizeof(uint16_t) + sizeof(int16_t) + sizeof(uint8_t));
@@ -17,8 +41,7 @@ size_t TextBlock::arenaSize(const uint16_t wordCount, const bool hasFocus, const
   return size + textBytes;
 }
 
-void TextBlock::bindArenaPointers() {
-  uint8_t* base = arena.get();
+void TextBlock::bindArenaPointers(uint8_t* base) {
   const size_t wc = numWords;
   textOffArr = reinterpret_cast<const uint16_t*>(base);
   xposArr = reinterpret_cast<const int16_t*>(base + wc * 2);
@@ -82,7 +105,7 @@ TextBlock::TextBlock(const std::vector<std::string>& words, const std::vector<in
     isValid = false;
     return;
   }
-  bindArenaPointers();
+  bindArenaPointers(arena.get());
 
   // Pass 2: fill. Mutable aliases of the const views bound above.
   auto* textOff = const_cast<uint16_t*>(textOffArr);
@@ -108,14 +131,14 @@ TextBlock::TextBlock(const std::vector<std::string>& words, const std::vector<in
   }
 }
 
-void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int x, const int y) const {
+void TextBlock::render(const GfxRenderer& renderer, const FontHandle& font, const int x, const int y) const {
   if (!isValid) {
     LOG_ERR("TXB", "Render skipped: invalid block");
     return;
   }
 
   const bool scanning = renderer.isFontCacheScanning();
-  const int ascender = renderer.getFontAscenderSize(fontId);
+  const int ascender = renderer.getFontAscenderSize(font);
 
   struct DecorationLineTracker {
     EpdFontFamily::Style style;
@@ -182,11 +205,11 @@ void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int
           std::min<size_t>({static_cast<size_t>(boundary), static_cast<size_t>(wordTextLen(i)), sizeof(boldBuf) - 1});
       memcpy(boldBuf, word, boldLen);
       boldBuf[boldLen] = '\0';
-      renderer.drawText(fontId, wordX, wordY, boldBuf, true, boldStyle, baseDir);
+      renderer.drawText(font, wordX, wordY, boldBuf, true, boldStyle, baseDir);
       const int suffixX = wordX + focusSuffixXArr[i];
-      renderer.drawText(fontId, suffixX, wordY, word + boldLen, true, currentStyle, baseDir);
+      renderer.drawText(font, suffixX, wordY, word + boldLen, true, currentStyle, baseDir);
     } else {
-      renderer.drawText(fontId, wordX, wordY, word, true, currentStyle, baseDir);
+      renderer.drawText(font, wordX, wordY, word, true, currentStyle, baseDir);
     }
 
     if (scanning) {
@@ -195,7 +218,7 @@ void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int
 
     if (EpdFontFamily::hasTextDecoration(currentStyle)) {
       int lineStartX = wordX;
-      int lineWidth = renderer.getTextWidth(fontId, word, currentStyle, baseDir);
+      int lineWidth = renderer.getTextWidth(font, word, currentStyle, baseDir);
 
       if ((currentStyle & (EpdFontFamily::SUP | EpdFontFamily::SUB)) != 0) {
         lineWidth = (lineWidth + 1) / 2;
@@ -205,8 +228,8 @@ void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int
       if (wordTextLen(i) >= 3 && static_cast<uint8_t>(word[0]) == 0xE2 && static_cast<uint8_t>(word[1]) == 0x80 &&
           static_cast<uint8_t>(word[2]) == 0x83) {
         const char* visibleText = word + 3;
-        lineStartX += renderer.getTextAdvanceX(fontId, "\xe2\x80\x83", currentStyle);
-        lineWidth = renderer.getTextWidth(fontId, visibleText, currentStyle, baseDir);
+        lineStartX += renderer.getTextAdvanceX(font, "\xe2\x80\x83", currentStyle);
+        lineWidth = renderer.getTextWidth(font, visibleText, currentStyle, baseDir);
         if ((currentStyle & (EpdFontFamily::SUP | EpdFontFamily::SUB)) != 0) {
           lineWidth = (lineWidth + 1) / 2;
         }
@@ -249,7 +272,8 @@ bool TextBlock::serialize(HalFile& file) const {
   serialization::writePod(file, textBytes);
   if (numWords > 0) {
     const size_t size = arenaSize(numWords, focusPresent, textBytes);
-    if (file.write(arena.get(), size) != size) {
+    // textOffArr is the arena base, whichever allocator holds it
+    if (file.write(reinterpret_cast<const uint8_t*>(textOffArr), size) != size) {
       LOG_ERR("TXB", "Serialization failed: arena write (%u bytes)", static_cast<uint32_t>(size));
       return false;
     }
@@ -274,7 +298,7 @@ bool TextBlock::serialize(HalFile& file) const {
   return true;
 }
 
-std::unique_ptr<TextBlock> TextBlock::deserialize(HalFile& file) {
+TextBlock* TextBlock::deserialize(HalFile& file, PageArena& pageArena) {
   uint16_t wc;
   uint8_t hasFocus;
   uint16_t textBytes;
@@ -293,27 +317,30 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(HalFile& file) {
     return nullptr;
   }
 
-  std::unique_ptr<TextBlock> block(new (std::nothrow) TextBlock());
-  if (!block) {
+  // Block and word arena both come from the page arena; on failure they are simply
+  // abandoned there (nothing to destroy: the block owns no heap memory).
+  void* mem = pageArena.allocate(sizeof(TextBlock), alignof(TextBlock));
+  if (!mem) {
     LOG_ERR("TXB", "OOM: TextBlock");
     return nullptr;
   }
+  auto* block = new (mem) TextBlock();
   block->numWords = wc;
   block->textBytes = textBytes;
   block->focusPresent = hasFocus != 0;
 
   if (wc > 0) {
     const size_t size = arenaSize(wc, block->focusPresent, textBytes);
-    block->arena = makeUniqueNoThrow<uint8_t[]>(size);
-    if (!block->arena) {
+    auto* words = static_cast<uint8_t*>(pageArena.allocate(size, alignof(uint16_t)));
+    if (!words) {
       LOG_ERR("TXB", "OOM: arena %u bytes", static_cast<uint32_t>(size));
       return nullptr;
     }
-    if (file.read(block->arena.get(), size) != size) {
+    if (file.read(words, size) != static_cast<int>(size)) {
       LOG_ERR("TXB", "Deserialization failed: arena read (%u bytes)", static_cast<uint32_t>(size));
       return nullptr;
     }
-    block->bindArenaPointers();
+    block->bindArenaPointers(words);
 
     // Validate offsets before anything dereferences wordText(): offset 0 first,
     // strictly increasing, in bounds, and every word NUL-terminated (word i ends
@@ -332,22 +359,86 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(HalFile& file) {
     }
   }
 
-  // Style (alignment + margins/padding/indent)
-  BlockStyle& blockStyle = block->blockStyle;
-  serialization::readPod(file, blockStyle.alignment);
-  serialization::readPod(file, blockStyle.textAlignDefined);
-  serialization::readPod(file, blockStyle.marginTop);
-  serialization::readPod(file, blockStyle.marginBottom);
-  serialization::readPod(file, blockStyle.marginLeft);
-  serialization::readPod(file, blockStyle.marginRight);
-  serialization::readPod(file, blockStyle.paddingTop);
-  serialization::readPod(file, blockStyle.paddingBottom);
-  serialization::readPod(file, blockStyle.paddingLeft);
-  serialization::readPod(file, blockStyle.paddingRight);
-  serialization::readPod(file, blockStyle.textIndent);
-  serialization::readPod(file, blockStyle.textIndentDefined);
-  serialization::readPod(file, blockStyle.isRtl);
-  serialization::readPod(file, blockStyle.directionDefined);
+  readBlockStyle(file, block->blockStyle);
 
   return block;
 }
+
+bool TextBlock::forEachWord(const WordVisitor& fn) const {
+  for (uint16_t i = 0; i < numWords; i++) {
+    if (!fn(wordText(i), wordTextLen(i), i + 1 == numWords)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TextBlock::forEachSerializedWord(HalFile& file, const WordVisitor& fn, bool& stopped) {
+  stopped = false;
+  uint16_t wc;
+  uint8_t hasFocus;
+  uint16_t textBytes;
+  serialization::readPod(file, wc);
+  serialization::readPod(file, hasFocus);
+  serialization::readPod(file, textBytes);
+  if (wc > 10000 || (wc == 0 && textBytes != 0) || (wc > 0 && textBytes < wc)) {
+    LOG_ERR("TXB", "Word walk failed: bad geometry (%u words, %u bytes)", wc, textBytes);
+    return false;
+  }
+  if (wc > 0 && !file.seekCur(static_cast<int64_t>(arenaSize(wc, hasFocus != 0, 0)))) {
+    return false;
+  }
+
+  // Words are NUL-separated: read chunks, hand out every complete word, carry the
+  // partial one over. A word filling the whole buffer is cut at a UTF-8 boundary
+  // and the rest of it skipped.
+  char buffer[MAX_STREAMED_WORD_BYTES + 1];
+  size_t have = 0;
+  size_t remaining = textBytes;
+  uint16_t word = 0;
+  bool skipping = false;
+  while (remaining > 0) {
+    const size_t want = std::min(sizeof(buffer) - have, remaining);
+    if (file.read(buffer + have, want) != static_cast<int>(want)) {
+      LOG_ERR("TXB", "Word walk failed: text read");
+      return false;
+    }
+    have += want;
+    remaining -= want;
+
+    size_t start = 0;
+    while (const auto* nul = static_cast<const char*>(memchr(buffer + start, '\0', have - start))) {
+      const size_t end = nul - buffer;
+      if (skipping) {
+        skipping = false;
+      } else {
+        word++;
+        if (!fn(buffer + start, static_cast<uint16_t>(end - start), word == wc)) {
+          stopped = true;
+          return true;
+        }
+      }
+      start = end + 1;
+    }
+    if (start == 0 && have == sizeof(buffer)) {
+      if (!skipping) {
+        const int len = utf8SafeTruncateBuffer(buffer, MAX_STREAMED_WORD_BYTES);
+        buffer[len] = '\0';
+        word++;
+        if (!fn(buffer, static_cast<uint16_t>(len), word == wc)) {
+          stopped = true;
+          return true;
+        }
+        skipping = true;
+      }
+      have = 0;
+    } else {
+      memmove(buffer, buffer + start, have - start);
+      have -= start;
+    }
+  }
+
+  BlockStyle style;
+  readBlockStyle(file, style);
+  return true;
+}
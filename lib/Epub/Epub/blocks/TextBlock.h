@@ -1,7 +1,9 @@
 #pragma once
 #include <EpdFontFamily.h>
+#include <FontHandle.h>
 #include <HalStorage.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -9,6 +11,8 @@
 #include "Block.h"
 #include "BlockStyle.h"
 
+class PageArena;
+
 // Represents a line of text on a page.
 //
 // All per-word data lives in ONE flat heap allocation (the arena) instead of
@@ -43,8 +47,10 @@ class TextBlock final : public Block {
   uint16_t textBytes = 0;  // total size of the text region, including NULs
   bool focusPresent = false;
   bool isValid = true;
-  // The ONLY allocation: makeUniqueNoThrow, so OOM yields an invalid block
-  // instead of abort() (bare new is not nothrow with -fno-exceptions).
+  // The ONLY allocation of a block built by layout: makeUniqueNoThrow, so OOM
+  // yields an invalid block instead of abort() (bare new is not nothrow with
+  // -fno-exceptions). Null for deserialized blocks, whose arena lives in the
+  // page's PageArena.
   std::unique_ptr<uint8_t[]> arena;
   // Typed views into the arena, bound once after the arena is filled. All
   // 16-bit bases sit at even offsets, so direct dereference is alignment-safe.
@@ -57,9 +63,15 @@ class TextBlock final : public Block {
 
   TextBlock() = default;  // deserialize() fills the fields directly
   static size_t arenaSize(uint16_t wordCount, bool hasFocus, uint16_t textBytes);
-  void bindArenaPointers();
+  void bindArenaPointers(uint8_t* base);
 
  public:
+  // Receives each word of a line in order: its text (NUL-terminated, only valid
+  // during the call), byte length, and whether it is the line's last word (where
+  // the layout appends '-' to a hyphenated word). Return false to stop. Keep
+  // captures to a pointer or two so std::function stores them inline.
+  using WordVisitor = std::function<bool(const char* word, uint16_t len, bool lineEnd)>;
+
   // Flatten-on-construct: copies the layout-time vectors into the arena; the
   // vectors die with the caller. On arena OOM the block is empty and valid()
   // is false -- callers must check and fail the line instead of using it.
@@ -69,6 +81,8 @@ class TextBlock final : public Block {
   ~TextBlock() override = default;
   TextBlock(const TextBlock&) = delete;
   TextBlock& operator=(const TextBlock&) = delete;
+  // Layout hands finished lines over by value; the arena (and the views into it) move along
+  TextBlock(TextBlock&&) = default;
 
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
   const BlockStyle& getBlockStyle() const { return blockStyle; }
@@ -86,8 +100,19 @@ class TextBlock final : public Block {
   uint8_t focusBoundary(const uint16_t i) const { return focusPresent ? focusBoundaryArr[i] : 0; }
   uint16_t focusSuffixX(const uint16_t i) const { return focusPresent ? focusSuffixXArr[i] : 0; }
 
-  void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
+  void render(const GfxRenderer& renderer, const FontHandle& font, int x, int y) const;
+  // Returns false when fn stopped the walk.
+  bool forEachWord(const WordVisitor& fn) const;
   BlockType getType() override { return TEXT_BLOCK; }
   bool serialize(HalFile& file) const;
-  static std::unique_ptr<TextBlock> deserialize(HalFile& file);
+  // Built in `pageArena`, word arena included; nullptr on a corrupt record or OOM.
+  // The caller runs the destructor (see PageLine).
+  static TextBlock* deserialize(HalFile& file, PageArena& pageArena);
+  // Visit the words of a serialized block without building it: the per-word
+  // arrays are skipped and the text is streamed through a small stack buffer
+  // (words over MAX_STREAMED_WORD_BYTES are cut short). Leaves the file after the
+  // block. Returns false on a read error; `stopped` is set when fn returned false,
+  // in which case the file position is unspecified.
+  static bool forEachSerializedWord(HalFile& file, const WordVisitor& fn, bool& stopped);
+  static constexpr size_t MAX_STREAMED_WORD_BYTES = 127;
 };
@@ -260,6 +260,7 @@ void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
   // block is flushed so the chapter starts on a fresh page.
   flushPendingAnchor();
   currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, focusReadingEnabled, blockStyle));
+  currentTextBlock->setWidthCache(&wordWidthCache);
   wordsExtractedInBlock = 0;
 }
 
@@ -310,13 +311,10 @@ void ChapterHtmlSlimParser::emitHorizontalRule(const BlockStyle& blockStyle) {
 
   currentPageNextY += topSpacing;
 
-  auto pageRule = std::shared_ptr<PageHorizontalRule>(
-      new (std::nothrow) PageHorizontalRule(width, ruleThickness, xPos, currentPageNextY));
-  if (!pageRule) {
+  if (!currentPage->addElement<PageHorizontalRule>(width, ruleThickness, xPos, currentPageNextY)) {
     LOG_ERR("EHP", "Failed to create PageHorizontalRule");
     return;
   }
-  currentPage->elements.push_back(pageRule);
   currentPageNextY = static_cast<int16_t>(currentPageNextY + ruleThickness + bottomSpacing);
 
   if (!pendingAnchorId.empty()) {
@@ -328,6 +326,9 @@ void ChapterHtmlSlimParser::emitHorizontalRule(const BlockStyle& blockStyle) {
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
+  // Skipped elements still count as siblings in KOReader's XPaths
+  self->xpathMap.pushElement(name);
+
   // Middle of skip
   if (self->skipUntilDepth < self->depth) {
     self->depth += 1;
@@ -336,9 +337,13 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
 
   if (strcmp(name, "p") == 0) {
     self->xpathParagraphIndex++;
+    self->xpathMap.recordCurrent(ParagraphXPathMap::Kind::Paragraph,
+                                 static_cast<uint32_t>(XML_GetCurrentByteIndex(self->xmlParser_)));
   }
   if (strcmp(name, "li") == 0) {
     self->xpathListItemIndex++;
+    self->xpathMap.recordCurrent(ParagraphXPathMap::Kind::ListItem,
+                                 static_cast<uint32_t>(XML_GetCurrentByteIndex(self->xmlParser_)));
   }
 
   // Extract class, style, id, and dir attributes for CSS/RTL processing
@@ -706,12 +711,10 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
                   return;
                 }
                 int xPos = (self->viewportWidth - displayWidth) / 2;
-                auto pageImage = std::make_shared<PageImage>(imageBlock, xPos, self->currentPageNextY);
-                if (!pageImage) {
+                if (!self->currentPage->addElement<PageImage>(imageBlock, xPos, self->currentPageNextY)) {
                   LOG_ERR("EHP", "Failed to create PageImage");
                   return;
                 }
-                self->currentPage->elements.push_back(pageImage);
                 self->currentPageNextY += displayHeight + imageMarginBottom;
 
                 // The image consumed the empty block's accumulated vertical spacing.
@@ -996,6 +999,9 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
 void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char* s, const int len) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
+  // Skipped text still counts towards KOReader's character positions
+  self->xpathMap.addText(s, len);
+
   // Skip content of nested table
   if (self->tableDepth > 1) {
     return;
@@ -1155,7 +1161,7 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
                                         : self->viewportWidth;
     self->currentTextBlock->layoutAndExtractLines(
         self->renderer, self->fontId, effectiveWidth,
-        [self](const std::shared_ptr<TextBlock>& textBlock) { self->addLineToPage(textBlock); }, false);
+        [self](TextBlock&& textBlock) { self->addLineToPage(std::move(textBlock)); }, false);
   }
 }
 
@@ -1177,6 +1183,7 @@ void XMLCALL ChapterHtmlSlimParser::defaultHandlerExpand(void* userData, const X
 
 void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* name) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
+  self->xpathMap.popElement();
 
   // Check if any style state will change after we decrement depth
   // If so, we MUST flush the partWordBuffer with the CURRENT style first
@@ -1379,6 +1386,9 @@ void ChapterHtmlSlimParser::abortParse() {
 bool ChapterHtmlSlimParser::finishParse() {
   if (xmlParser_) {
     LOG_DBG("EHP", "Time to parse and build pages: %lu ms", millis() - parseStartTime_);
+    const auto& widthStats = wordWidthCache.getStats();
+    LOG_DBG("EHP", "Word widths: %lu hits, %lu misses, %lu evictions", widthStats.hits, widthStats.misses,
+            widthStats.evictions);
     destroyXmlParser(xmlParser_);
     xmlParser_ = nullptr;
   }
@@ -1417,7 +1427,7 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   return finishParse();
 }
 
-void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
+void ChapterHtmlSlimParser::addLineToPage(TextBlock&& line) {
   const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
 
   if (!currentPage) {
@@ -1433,7 +1443,7 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   }
 
   // Track cumulative words to assign footnotes to the page containing their anchor
-  wordsExtractedInBlock += line->wordCount();
+  wordsExtractedInBlock += line.wordCount();
   auto footnoteIt = pendingFootnotes.begin();
   while (footnoteIt != pendingFootnotes.end() && footnoteIt->first <= wordsExtractedInBlock) {
     currentPage->addFootnote(footnoteIt->second.number, footnoteIt->second.href);
@@ -1442,8 +1452,17 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   pendingFootnotes.erase(pendingFootnotes.begin(), footnoteIt);
 
   // Apply horizontal left inset (margin + padding) as x position offset
-  const int16_t xOffset = line->getBlockStyle().leftInset();
-  currentPage->elements.push_back(std::make_shared<PageLine>(line, xOffset, currentPageNextY));
+  const int16_t xOffset = line.getBlockStyle().leftInset();
+  TextBlock* block = currentPage->arena.create<TextBlock>(std::move(line));
+  if (!block) {
+    LOG_ERR("EHP", "Dropping line: page arena exhausted");
+    return;
+  }
+  if (!currentPage->addElement<PageLine>(block, xOffset, currentPageNextY)) {
+    LOG_ERR("EHP", "Dropping line: page arena exhausted");
+    block->~TextBlock();
+    return;
+  }
   currentPageNextY += lineHeight;
 }
 
@@ -1476,7 +1495,7 @@ void ChapterHtmlSlimParser::makePages() {
 
   currentTextBlock->layoutAndExtractLines(
       renderer, fontId, effectiveWidth,
-      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); });
+      [this](TextBlock&& textBlock) { addLineToPage(std::move(textBlock)); });
 
   // Fallback: transfer any remaining pending footnotes to current page.
   // Normally addLineToPage handles this via word-index tracking, but this catches
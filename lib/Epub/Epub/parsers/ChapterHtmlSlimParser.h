@@ -10,7 +10,9 @@
 #include <vector>
 
 #include "Epub/FootnoteEntry.h"
+#include "Epub/ParagraphXPathMap.h"
 #include "Epub/ParsedText.h"
+#include "Epub/WordWidthCache.h"
 #include "Epub/blocks/ImageBlock.h"
 #include "Epub/blocks/TextBlock.h"
 #include "Epub/css/CssParser.h"
@@ -38,6 +40,7 @@ class ChapterHtmlSlimParser {
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  WordWidthCache wordWidthCache;  // shared by every text block of this section
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
   int fontId;
@@ -88,6 +91,7 @@ class ChapterHtmlSlimParser {
   std::vector<std::string> tocAnchors;  // the list of anchors that are TOC chapter boundaries
   uint16_t xpathParagraphIndex = 0;
   uint16_t xpathListItemIndex = 0;
+  ParagraphXPathMapBuilder xpathMap;
 
   // Footnote link tracking
   bool insideFootnoteLink = false;
@@ -171,8 +175,10 @@ class ChapterHtmlSlimParser {
   bool finishParse();  // flush the trailing page and tear down; returns true
   void abortParse();   // tear down without flushing (error / abandon)
 
-  void addLineToPage(std::shared_ptr<TextBlock> line);
+  void addLineToPage(TextBlock&& line);
   const std::vector<std::pair<std::string, uint16_t>>& getAnchors() const { return anchorData; }
+  // Paragraph/list-item start positions recorded so far, for the section's XPath map
+  const ParagraphXPathMapBuilder& getXPathMap() const { return xpathMap; }
 
   // Byte progress of the in-flight parse, used to estimate a still-building section's total page
   // count (a giant single-spine book never fully lays out, so its real count is unknown). Valid
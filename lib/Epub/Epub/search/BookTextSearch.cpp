@@ -0,0 +1,371 @@
+#include "BookTextSearch.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <Print.h>
+#include <Utf8.h>
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include "Epub.h"
+#include "Epub/Page.h"
+#include "Epub/Section.h"
+#include "Epub/htmlEntities.h"
+
+namespace {
+constexpr int PAGES_PER_SLICE = 4;
+constexpr size_t HTML_READ_CHUNK = 512;
+constexpr size_t STREAM_CHUNK = 1024;
+
+// Keep the last `maxBytes` of text, starting on a codepoint boundary
+std::string tailSnippet(const std::string& text, const size_t maxBytes) {
+  size_t start = text.size() > maxBytes ? text.size() - maxBytes : 0;
+  while (start < text.size() && (static_cast<uint8_t>(text[start]) & 0xC0) == 0x80) {
+    start++;
+  }
+  while (start < text.size() && text[start] == ' ') {
+    start++;
+  }
+  return text.substr(start);
+}
+
+bool isHiddenTag(const char* name) {
+  return strcmp(name, "head") == 0 || strcmp(name, "script") == 0 || strcmp(name, "style") == 0 ||
+         strcmp(name, "title") == 0;
+}
+
+// Elements that end a run of text as the layout would (a new line or block)
+bool isBreakTag(const char* name) {
+  static const char* const TAGS[] = {"p",  "div", "br", "li", "h1",         "h2",      "h3", "h4", "h5", "h6", "tr",
+                                     "td", "th",  "dt", "dd", "blockquote", "section", "hr", "ul", "ol", "pre"};
+  for (const char* tag : TAGS) {
+    if (strcmp(name, tag) == 0) return true;
+  }
+  return false;
+}
+}  // namespace
+
+// Strips tags and decodes entities from a chapter's XHTML byte stream, feeding
+// the visible text to the matcher. Works on arbitrary chunk boundaries, so the
+// same instance takes both the cached html/ file (read a slice at a time) and
+// an inflate stream from the EPUB.
+class BookTextSearch::HtmlText final : public Print {
+  static constexpr uint8_t MAX_TAG_NAME = 12;
+  static constexpr uint8_t MAX_ENTITY = 12;
+  static constexpr size_t RUN_BYTES = 64;
+
+  BookTextSearch& search;
+  const uint32_t totalBytes;
+  uint32_t consumed = 0;
+
+  enum class Mode : uint8_t { Text, Tag, Entity } mode = Mode::Text;
+  char tagName[MAX_TAG_NAME] = {};
+  uint8_t tagNameLen = 0;
+  bool tagNameDone = false;
+  bool tagClose = false;
+  char tagQuote = 0;
+  char tagLastChar = 0;
+  uint8_t hiddenDepth = 0;
+  char entity[MAX_ENTITY] = {};
+  uint8_t entityLen = 0;
+
+  // Visible text not yet fed to the matcher
+  char run[RUN_BYTES] = {};
+  size_t runLen = 0;
+  // Text of the current block so far, for hit snippets
+  std::string context;
+  bool blockHasHit = false;
+
+  void flushRun() {
+    if (runLen == 0) return;
+    const int found = search.matcher.feed(run, runLen);
+    for (size_t i = 0; i < runLen; i++) {
+      const char c = run[i];
+      const bool space = c == ' ' || c == '\n' || c == '\r' || c == '\t';
+      if (space && (context.empty() || context.back() == ' ')) continue;
+      context += space ? ' ' : c;
+    }
+    if (context.size() > 2 * MAX_SNIPPET_BYTES) {
+      context.erase(0, context.size() - MAX_SNIPPET_BYTES);
+    }
+    runLen = 0;
+    if (found > 0) onMatch();
+  }
+
+  void emit(const char* text, const size_t len) {
+    if (hiddenDepth > 0) return;
+    for (size_t i = 0; i < len; i++) {
+      if (runLen == RUN_BYTES) flushRun();
+      run[runLen++] = text[i];
+    }
+  }
+
+  void onMatch() {
+    if (blockHasHit || search.hits.size() >= MAX_HITS) return;
+    blockHasHit = true;
+    const float progress = totalBytes > 0 ? static_cast<float>(consumed) / static_cast<float>(totalBytes) : 0.0f;
+    search.addHit(-1, progress, tailSnippet(context, MAX_SNIPPET_BYTES));
+  }
+
+  void endTag() {
+    tagName[tagNameLen] = '\0';
+    const bool selfClosing = tagLastChar == '/';
+    if (isHiddenTag(tagName)) {
+      if (tagClose && hiddenDepth > 0) {
+        hiddenDepth--;
+      } else if (!tagClose && !selfClosing) {
+        hiddenDepth++;
+      }
+    } else if (isBreakTag(tagName)) {
+      endBlock();
+    }
+  }
+
+  void endEntity() {
+    entity[entityLen] = '\0';
+    if (entityLen > 2 && entity[1] == '#') {
+      const bool hex = entity[2] == 'x' || entity[2] == 'X';
+      const uint32_t cp = strtoul(entity + (hex ? 3 : 2), nullptr, hex ? 16 : 10);
+      if (cp > 0) {
+        std::string utf8;
+        utf8AppendCodepoint(cp, utf8);
+        emit(utf8.data(), utf8.size());
+        return;
+      }
+    } else if (const char* value = lookupHtmlEntity(entity, entityLen)) {
+      emit(value, strlen(value));
+      return;
+    }
+    emit(entity, entityLen);
+  }
+
+  void process(const uint8_t c) {
+    switch (mode) {
+      case Mode::Text:
+        if (c == '<') {
+          flushRun();
+          mode = Mode::Tag;
+          tagNameLen = 0;
+          tagNameDone = false;
+          tagClose = false;
+          tagQuote = 0;
+          tagLastChar = 0;
+        } else if (c == '&') {
+          mode = Mode::Entity;
+          entity[0] = '&';
+          entityLen = 1;
+        } else {
+          const char ch = static_cast<char>(c);
+          emit(&ch, 1);
+        }
+        break;
+
+      case Mode::Tag:
+        if (tagQuote) {
+          if (c == tagQuote) tagQuote = 0;
+        } else if (c == '>') {
+          endTag();
+          mode = Mode::Text;
+        } else if (!tagNameDone) {
+          if (c == '/' && tagNameLen == 0) {
+            tagClose = true;
+          } else if (isalnum(c) && tagNameLen + 1 < MAX_TAG_NAME) {
+            tagName[tagNameLen++] = static_cast<char>(tolower(c));
+          } else {
+            tagNameDone = true;
+          }
+        } else if (c == '"' || c == '\'') {
+          tagQuote = static_cast<char>(c);
+        }
+        if (!isspace(c)) tagLastChar = static_cast<char>(c);
+        break;
+
+      case Mode::Entity:
+        if (c == ';' && entityLen + 1 < MAX_ENTITY) {
+          entity[entityLen++] = ';';
+          endEntity();
+          mode = Mode::Text;
+        } else if ((isalnum(c) || c == '#') && entityLen + 2 < MAX_ENTITY) {
+          entity[entityLen++] = static_cast<char>(c);
+        } else {
+          // Not an entity after all: keep the text and reprocess this byte
+          emit(entity, entityLen);
+          mode = Mode::Text;
+          process(c);
+        }
+        break;
+    }
+  }
+
+ public:
+  HtmlText(BookTextSearch& search, const uint32_t totalBytes) : search(search), totalBytes(totalBytes) {}
+
+  size_t write(const uint8_t c) override { return write(&c, 1); }
+
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    // An inflate stream can't be stopped, so once the hit list is full the rest is skipped
+    if (search.hits.size() >= MAX_HITS) return size;
+    for (size_t i = 0; i < size; i++) {
+      consumed++;
+      process(buffer[i]);
+    }
+    return size;
+  }
+
+  void endBlock() {
+    flushRun();
+    if (search.matcher.feedSpace() > 0) onMatch();
+    context.clear();
+    blockHasHit = false;
+  }
+};
+
+BookTextSearch::BookTextSearch(std::shared_ptr<Epub> epub, GfxRenderer& renderer, SectionLoader loader)
+    : epub(std::move(epub)), renderer(renderer), loader(std::move(loader)) {}
+
+// Out-of-line so Section and HtmlText are complete where their unique_ptrs are destroyed
+BookTextSearch::~BookTextSearch() = default;
+
+bool BookTextSearch::begin(const std::string& query) {
+  hits.clear();
+  section.reset();
+  html.reset();
+  if (htmlFile) htmlFile.close();
+  spineIndex = 0;
+
+  if (!matcher.setPattern(query.c_str())) {
+    state = State::Done;
+    return false;
+  }
+  state = State::NextSpine;
+  return true;
+}
+
+bool BookTextSearch::step(const uint32_t budgetMs) {
+  const unsigned long start = millis();
+  do {
+    switch (state) {
+      case State::NextSpine:
+        openSpine();
+        break;
+      case State::Pages:
+        scanPages();
+        break;
+      case State::Html:
+        scanHtml();
+        break;
+      case State::Done:
+        return false;
+    }
+  } while (millis() - start < budgetMs);
+  return state != State::Done;
+}
+
+void BookTextSearch::openSpine() {
+  if (spineIndex >= epub->getSpineItemsCount() || hits.size() >= MAX_HITS) {
+    LOG_DBG("BTS", "Search finished: %d hits", static_cast<int>(hits.size()));
+    state = State::Done;
+    return;
+  }
+  matcher.reset();
+
+  section = std::unique_ptr<Section>(new Section(epub, spineIndex, renderer));
+  if (loader(*section) && !section->isPartial() && section->pageCount > 0) {
+    nextPage = 0;
+    state = State::Pages;
+    return;
+  }
+  section.reset();
+
+  // Not laid out for the current settings: scan the chapter's XHTML instead
+  const std::string htmlPath = epub->getCachePath() + "/html/" + std::to_string(spineIndex) + ".html";
+  if (Storage.exists(htmlPath.c_str()) && Storage.openFileForRead("BTS", htmlPath, htmlFile)) {
+    html.reset(new HtmlText(*this, htmlFile.size()));
+    state = State::Html;
+    return;
+  }
+
+  // Never opened: inflate straight from the EPUB. The stream can't be split across
+  // slices, so a long chapter makes for one long step.
+  const std::string href = epub->getSpineItem(spineIndex).href;
+  size_t size = 0;
+  epub->getItemSize(href, &size);
+  HtmlText text(*this, size);
+  if (!epub->readItemContentsToStream(href, text, STREAM_CHUNK)) {
+    LOG_ERR("BTS", "Failed to read %s", href.c_str());
+  }
+  text.endBlock();
+  finishSpine();
+}
+
+void BookTextSearch::scanPages() {
+  const int read = section->forEachPage(nextPage, PAGES_PER_SLICE,
+                                        [this](const int page, const Page& content) { return scanPage(page, content); });
+  nextPage += read;
+  if (read < PAGES_PER_SLICE || nextPage >= section->pageCount || hits.size() >= MAX_HITS) {
+    finishSpine();
+  }
+}
+
+bool BookTextSearch::scanPage(const int page, const Page& content) {
+  const TextBlock* hitLine = nullptr;
+  for (const auto& element : content.elements) {
+    if (element->getTag() != TAG_PageLine) continue;
+    const TextBlock* block = static_cast<const PageLine&>(*element).getBlock();
+    if (!block) continue;
+
+    int found = 0;
+    const uint16_t words = block->wordCount();
+    for (uint16_t i = 0; i < words; i++) {
+      const char* text = block->wordText(i);
+      const uint16_t len = block->wordTextLen(i);
+      // The layout appends '-' to a word it hyphenated at the end of a line; join
+      // it back onto the next line so the whole word can match
+      const bool hyphenated = i + 1 == words && len > 1 && text[len - 1] == '-';
+      found += matcher.feed(text, hyphenated ? len - 1 : len);
+      if (!hyphenated) found += matcher.feedSpace();
+    }
+    if (found > 0 && !hitLine) hitLine = block;
+  }
+
+  if (hitLine) {
+    std::string snippet;
+    for (uint16_t i = 0; i < hitLine->wordCount() && snippet.size() < MAX_SNIPPET_BYTES; i++) {
+      if (!snippet.empty()) snippet += ' ';
+      snippet.append(hitLine->wordText(i), hitLine->wordTextLen(i));
+    }
+    if (snippet.size() > MAX_SNIPPET_BYTES) {
+      snippet.resize(utf8SafeTruncateBuffer(snippet.data(), MAX_SNIPPET_BYTES));
+    }
+    addHit(page, 0.0f, std::move(snippet));
+  }
+  return hits.size() < MAX_HITS;
+}
+
+void BookTextSearch::scanHtml() {
+  uint8_t buffer[HTML_READ_CHUNK];
+  const int read = htmlFile.read(buffer, sizeof(buffer));
+  if (read > 0) {
+    html->write(buffer, read);
+  }
+  if (read < static_cast<int>(sizeof(buffer)) || hits.size() >= MAX_HITS) {
+    html->endBlock();
+    finishSpine();
+  }
+}
+
+void BookTextSearch::finishSpine() {
+  section.reset();
+  html.reset();
+  if (htmlFile) htmlFile.close();
+  spineIndex++;
+  state = State::NextSpine;
+}
+
+void BookTextSearch::addHit(const int page, const float spineProgress, std::string snippet) {
+  const uint16_t pageCount = section ? section->pageCount : 0;
+  hits.push_back({static_cast<int16_t>(spineIndex), static_cast<int16_t>(page), pageCount, spineProgress,
+                  std::move(snippet)});
+}
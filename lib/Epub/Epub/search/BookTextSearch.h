@@ -0,0 +1,85 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "TextMatcher.h"
+
+class Epub;
+class GfxRenderer;
+class Page;
+class Section;
+
+// Full-text search over a whole book, run a slice at a time from an activity's
+// loop() (like Section::buildSomeMore) so hits show up while the scan goes on and
+// the caller can stop it between slices.
+//
+// Chapters with a section cache laid out for the current settings are scanned
+// page by page straight from the cached TextBlocks, so hits carry an exact page.
+// Chapters that were never opened fall back to the chapter's XHTML (the unzipped
+// html/ cache if present, otherwise inflated from the EPUB) run through a light
+// tag stripper; those hits carry the byte position within the chapter instead.
+class BookTextSearch {
+ public:
+  struct Hit {
+    int16_t spineIndex;
+    // Page in the section cache, or -1 for a hit found in the chapter's XHTML
+    int16_t page;
+    uint16_t pageCount;
+    // Position within the chapter for XHTML hits (0..1)
+    float spineProgress;
+    std::string snippet;
+  };
+
+  // Loads a spine's section file with the reader's current layout settings.
+  // Must not build: unindexed chapters are scanned from their XHTML instead.
+  using SectionLoader = std::function<bool(Section&)>;
+
+  static constexpr size_t MAX_HITS = 100;
+  static constexpr size_t MAX_SNIPPET_BYTES = 80;
+
+  BookTextSearch(std::shared_ptr<Epub> epub, GfxRenderer& renderer, SectionLoader loader);
+  ~BookTextSearch();
+
+  // Start a new search from the first chapter. False if the query is unusable.
+  bool begin(const std::string& query);
+  // Scan for roughly budgetMs (at least one unit of work). Returns true while
+  // there is more of the book left to scan.
+  bool step(uint32_t budgetMs);
+  bool isDone() const { return state == State::Done; }
+
+  const std::vector<Hit>& getHits() const { return hits; }
+  // Spine items finished so far, for a progress readout
+  int getSpinesScanned() const { return spineIndex; }
+
+ private:
+  enum class State { NextSpine, Pages, Html, Done };
+
+  // Byte-level XHTML to text filter; feeds visible text into the matcher
+  class HtmlText;
+
+  std::shared_ptr<Epub> epub;
+  GfxRenderer& renderer;
+  SectionLoader loader;
+  TextMatcher matcher;
+  std::vector<Hit> hits;
+
+  State state = State::Done;
+  int spineIndex = 0;
+  std::unique_ptr<Section> section;
+  int nextPage = 0;
+  std::unique_ptr<HtmlText> html;
+  HalFile htmlFile;
+
+  void openSpine();
+  void scanPages();
+  void scanHtml();
+  void finishSpine();
+  bool scanPage(int page, const Page& content);
+  void addHit(int page, float spineProgress, std::string snippet);
+};
@@ -0,0 +1,210 @@
+#include "TextMatcher.h"
+
+#include <cstring>
+
+#include "Epub/hyphenation/HyphenationCommon.h"
+
+namespace {
+// Folded value of characters that are dropped from the text entirely
+constexpr uint32_t DROP = 0;
+
+bool isAsciiSpace(const uint8_t c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'; }
+
+bool isSpace(const uint32_t cp) {
+  return cp == 0x00A0 || (cp >= 0x2000 && cp <= 0x200A) || cp == 0x202F || cp == 0x205F || cp == 0x3000;
+}
+
+uint32_t fold(const uint32_t cp) {
+  switch (cp) {
+    case 0x00AD:  // soft hyphen
+    case 0x200B:  // zero-width space
+    case 0x200C:
+    case 0x200D:
+    case 0x2060:
+    case 0xFEFF:
+      return DROP;
+    case 0x2018:
+    case 0x2019:
+    case 0x201B:
+      return '\'';
+    case 0x201C:
+    case 0x201D:
+    case 0x201E:
+      return '"';
+    default:
+      return toLowerCyrillic(toLowerLatin(cp));
+  }
+}
+}  // namespace
+
+bool TextMatcher::setPattern(const char* text) {
+  patternLen = 0;
+  reset();
+  // Folding never makes text longer, so anything that fits the window can be
+  // folded in one pass through the same path as the searched text
+  const size_t len = std::strlen(text);
+  if (len >= WINDOW_BYTES) {
+    return false;
+  }
+  feed(text, len);
+  size_t folded = windowLen;
+  if (folded > 0 && window[folded - 1] == ' ') {
+    folded--;
+  }
+  if (folded == 0 || folded > MAX_PATTERN_BYTES) {
+    reset();
+    return false;
+  }
+
+  std::memcpy(pattern, window, folded);
+  patternLen = folded;
+  for (auto& s : shift) {
+    s = static_cast<uint8_t>(patternLen);
+  }
+  for (size_t i = 0; i + 1 < patternLen; i++) {
+    shift[pattern[i]] = static_cast<uint8_t>(patternLen - 1 - i);
+  }
+  reset();
+  return true;
+}
+
+void TextMatcher::reset() {
+  windowLen = 0;
+  partialLen = 0;
+  partialNeed = 0;
+  lastWasSpace = true;
+}
+
+int TextMatcher::feed(const char* text, const size_t len) {
+  int found = 0;
+  const auto* p = reinterpret_cast<const uint8_t*>(text);
+  const auto* const end = p + len;
+
+  while (p < end) {
+    const uint8_t b = *p;
+
+    if (partialNeed > 0) {
+      if ((b & 0xC0) != 0x80) {
+        // Truncated sequence: drop it and reprocess this byte as a lead byte
+        partialLen = partialNeed = 0;
+        continue;
+      }
+      partial[partialLen++] = b;
+      p++;
+      if (partialLen == partialNeed) {
+        uint32_t cp = partial[0] & (0xFF >> (partialNeed + 1));
+        for (uint8_t i = 1; i < partialNeed; i++) {
+          cp = (cp << 6) | (partial[i] & 0x3F);
+        }
+        partialLen = partialNeed = 0;
+        if (windowLen + 4 > WINDOW_BYTES) found += scan();
+        append(cp);
+      }
+      continue;
+    }
+
+    p++;
+    if (b < 0x80) {
+      // ASCII fast path: the bulk of most books
+      uint8_t c = b;
+      if (isAsciiSpace(c)) {
+        if (lastWasSpace) continue;
+        c = ' ';
+        lastWasSpace = true;
+      } else {
+        if (static_cast<uint8_t>(c - 'A') < 26) c += 'a' - 'A';
+        lastWasSpace = false;
+      }
+      if (windowLen == WINDOW_BYTES) found += scan();
+      window[windowLen++] = c;
+    } else if ((b & 0xE0) == 0xC0) {
+      partial[0] = b;
+      partialLen = 1;
+      partialNeed = 2;
+    } else if ((b & 0xF0) == 0xE0) {
+      partial[0] = b;
+      partialLen = 1;
+      partialNeed = 3;
+    } else if ((b & 0xF8) == 0xF0) {
+      partial[0] = b;
+      partialLen = 1;
+      partialNeed = 4;
+    }
+    // Stray continuation bytes are skipped
+  }
+
+  return found + scan();
+}
+
+int TextMatcher::feedSpace() {
+  if (lastWasSpace) {
+    return 0;
+  }
+  lastWasSpace = true;
+  int found = 0;
+  if (windowLen == WINDOW_BYTES) found += scan();
+  window[windowLen++] = ' ';
+  return found + scan();
+}
+
+void TextMatcher::append(uint32_t cp) {
+  if (isSpace(cp)) {
+    if (lastWasSpace) return;
+    cp = ' ';
+    lastWasSpace = true;
+  } else {
+    cp = fold(cp);
+    if (cp == DROP) return;
+    lastWasSpace = false;
+  }
+
+  uint8_t* out = window + windowLen;
+  if (cp < 0x80) {
+    out[0] = static_cast<uint8_t>(cp);
+    windowLen += 1;
+  } else if (cp < 0x800) {
+    out[0] = static_cast<uint8_t>(0xC0 | (cp >> 6));
+    out[1] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+    windowLen += 2;
+  } else if (cp < 0x10000) {
+    out[0] = static_cast<uint8_t>(0xE0 | (cp >> 12));
+    out[1] = static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F));
+    out[2] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+    windowLen += 3;
+  } else {
+    out[0] = static_cast<uint8_t>(0xF0 | (cp >> 18));
+    out[1] = static_cast<uint8_t>(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+    windowLen += 4;
+  }
+}
+
+int TextMatcher::scan() {
+  // Without a pattern the window only collects the folded pattern itself
+  if (patternLen == 0) {
+    return 0;
+  }
+
+  int found = 0;
+  const size_t m = patternLen;
+  const uint8_t lastByte = pattern[m - 1];
+  size_t i = 0;
+  while (i + m <= windowLen) {
+    const uint8_t c = window[i + m - 1];
+    if (c == lastByte && std::memcmp(window + i, pattern, m - 1) == 0) {
+      found++;
+      i += m;
+    } else {
+      i += shift[c];
+    }
+  }
+
+  // Everything before i is ruled out; the rest is shorter than the pattern and
+  // may still start a match completed by the next run
+  windowLen -= i;
+  if (windowLen > 0 && i > 0) {
+    std::memmove(window, window + i, windowLen);
+  }
+  return found;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Streaming, case-insensitive substring matcher for in-book search.
+//
+// Text is fed in arbitrary chunks (a word, a page line, a buffer of HTML text)
+// and folded on the fly: Latin and Cyrillic letters are lowercased, every run of
+// whitespace (including NBSP) becomes one space, curly quotes become straight
+// ones, and soft hyphens / zero-width characters are dropped. The folded bytes
+// are scanned with Boyer-Moore-Horspool in a small fixed window; only the tail
+// that could still start a match is carried into the next chunk, so a match may
+// span any number of feed() calls and nothing is allocated after setPattern().
+class TextMatcher {
+ public:
+  static constexpr size_t MAX_PATTERN_BYTES = 64;
+
+  // Fold and set the search term. False if it is empty (after trimming spaces)
+  // or longer than MAX_PATTERN_BYTES once folded.
+  bool setPattern(const char* pattern);
+  bool hasPattern() const { return patternLen > 0; }
+
+  // Forget all fed text (start of a new chapter); keeps the pattern
+  void reset();
+
+  // Feed the next run of text (UTF-8, may split codepoints). Returns the number
+  // of matches that ended within this run; matches don't overlap.
+  int feed(const char* text, size_t len);
+  // Word boundary between two fed runs
+  int feedSpace();
+
+ private:
+  static constexpr size_t WINDOW_BYTES = 512;
+
+  uint8_t pattern[MAX_PATTERN_BYTES] = {};
+  size_t patternLen = 0;
+  uint8_t shift[256] = {};
+
+  uint8_t window[WINDOW_BYTES] = {};
+  size_t windowLen = 0;
+  // Bytes of a codepoint split across feed() calls
+  uint8_t partial[4] = {};
+  uint8_t partialLen = 0;
+  uint8_t partialNeed = 0;
+  bool lastWasSpace = true;
+
+  void append(uint32_t cp);
+  int scan();
+};
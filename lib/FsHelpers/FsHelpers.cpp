@@ -79,11 +79,10 @@ std::string normalisePath(const std::string& path) {
   return result;
 }
 
-bool naturalLess(const std::string& str1, const std::string& str2) {
-  // Naive natural sort: numeric-aware, case-insensitive
-  const char* s1 = str1.c_str();
-  const char* s2 = str2.c_str();
+bool naturalLess(const std::string& str1, const std::string& str2) { return naturalLess(str1.c_str(), str2.c_str()); }
 
+bool naturalLess(const char* s1, const char* s2) {
+  // Naive natural sort: numeric-aware, case-insensitive
   // ctype functions require unsigned char values: passing a negative char (UTF-8
   // bytes above 0x7f with signed char) is undefined behavior
   const auto isDigit = [](const char c) { return isdigit(static_cast<unsigned char>(c)) != 0; };
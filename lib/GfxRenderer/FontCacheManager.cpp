@@ -3,8 +3,11 @@
 #include <FontDecompressor.h>
 #include <Logging.h>
 #include <SdCardFont.h>
+#include <Utf8.h>
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 FontCacheManager::FontCacheManager(const std::map<int, EpdFontFamily>& fontMap,
                                    const std::map<int, SdCardFont*>& sdCardFonts)
@@ -19,6 +22,15 @@ void FontCacheManager::clearCache() {
   }
 }
 
+void FontCacheManager::releaseCrossPageCaches() {
+  for (auto& [id, font] : sdCardFonts_) {
+    font->releaseBlockCache();
+  }
+  if (!fontDecompressor_) return;
+  fontDecompressor_->releaseResidentGroups();
+  fontDecompressor_->releaseGlyphCache();
+}
+
 void FontCacheManager::prewarmCache(int fontId, const char* utf8Text, uint8_t styleMask) {
   // SD card font prewarm path: prewarm all requested styles in one call
   auto it = sdCardFonts_.find(fontId);
@@ -45,6 +57,12 @@ void FontCacheManager::prewarmCache(int fontId, const char* utf8Text, uint8_t st
   }
 }
 
+void FontCacheManager::prewarmAhead(int fontId, const char* utf8Text, uint8_t styleMask) {
+  if (scanMode_ != ScanMode::None) return;  // a render is mid-prewarm; leave its caches alone
+  prewarmCache(fontId, utf8Text, styleMask);
+  clearCache();
+}
+
 void FontCacheManager::logStats(const char* label) {
   if (fontDecompressor_) fontDecompressor_->logStats(label);
   for (auto& [id, font] : sdCardFonts_) {
@@ -74,6 +92,40 @@ void FontCacheManager::recordText(const char* text, int fontId, EpdFontFamily::S
   scanStyleCounts_[baseStyle] += cpCount;
 }
 
+uint8_t FontCacheManager::captureGlyphSet(const std::function<void()>& render, std::string& outText) {
+  outText.clear();
+  if (scanMode_ != ScanMode::None) return 0;  // don't take over a running prewarm scan
+
+  scanMode_ = ScanMode::Scanning;
+  scanText_.clear();
+  memset(scanStyleCounts_, 0, sizeof(scanStyleCounts_));
+  scanFontId_ = -1;
+  render();
+  scanMode_ = ScanMode::None;
+
+  uint8_t styleMask = 0;
+  for (uint8_t i = 0; i < 4; i++) {
+    if (scanStyleCounts_[i] > 0) styleMask |= (1 << i);
+  }
+
+  // Distinct codepoints, kept sorted as they come in: a page has a few thousand characters but
+  // rarely more than ~100 distinct ones, so this stays small where sorting them all would not
+  std::vector<uint32_t> codepoints;
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(scanText_.c_str());
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(&p))) {
+    const auto it = std::lower_bound(codepoints.begin(), codepoints.end(), cp);
+    if (it == codepoints.end() || *it != cp) codepoints.insert(it, cp);
+  }
+  for (const uint32_t c : codepoints) {
+    utf8AppendCodepoint(c, outText);
+  }
+
+  scanText_.clear();
+  scanText_.shrink_to_fit();
+  return outText.empty() ? 0 : styleMask;
+}
+
 // --- PrewarmScope implementation ---
 
 FontCacheManager::PrewarmScope::PrewarmScope(FontCacheManager& manager) : manager_(&manager) {
@@ -104,6 +156,11 @@ void FontCacheManager::PrewarmScope::endScanAndPrewarm() {
   manager_->scanText_.shrink_to_fit();
 }
 
+void FontCacheManager::PrewarmScope::prewarmRecorded(int fontId, const char* utf8Text, uint8_t styleMask) {
+  manager_->scanMode_ = ScanMode::None;
+  manager_->prewarmCache(fontId, utf8Text, styleMask);
+}
+
 FontCacheManager::PrewarmScope::~PrewarmScope() {
   if (active_) {
     endScanAndPrewarm();  // no-op if already called (scanText_ is empty)
@@ -3,6 +3,7 @@
 #include <EpdFontFamily.h>
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <string>
 
@@ -16,13 +17,23 @@ class FontCacheManager {
   void setFontDecompressor(FontDecompressor* d);
 
   void clearCache();
+  // Free the caches clearCache() keeps across pages: the compressed fonts' resident glyph groups and
+  // glyph cache, and the SD card fonts' file block caches
+  void releaseCrossPageCaches();
   void prewarmCache(int fontId, const char* utf8Text, uint8_t styleMask = 0x0F);
+  // Prewarm a page ahead of its render: only the cross-page caches (glyph cache, resident groups,
+  // SD card block cache) keep the result, the per-page buffers are released again right away.
+  void prewarmAhead(int fontId, const char* utf8Text, uint8_t styleMask);
   void logStats(const char* label = "render");
   void resetStats();
 
   // Scan-mode API: called by GfxRenderer::drawText() during scan pass
   bool isScanning() const;
   void recordText(const char* text, int fontId, EpdFontFamily::Style style);
+  // Run `render` as a scan pass without touching any cache and return the styles it drew as a
+  // prewarmCache() style mask (0 = no text). outText receives each drawn codepoint once, in
+  // ascending order, as UTF-8. Used to record a page's prewarm set when the page is laid out.
+  uint8_t captureGlyphSet(const std::function<void()>& render, std::string& outText);
 
   // The FontDecompressor pointer, needed by GfxRenderer::getGlyphBitmap()
   FontDecompressor* getDecompressor() const { return fontDecompressor_; }
@@ -33,6 +44,8 @@ class FontCacheManager {
     explicit PrewarmScope(FontCacheManager& manager);
     ~PrewarmScope();
     void endScanAndPrewarm();
+    // Skip the scan pass: prewarm from a glyph set recorded by captureGlyphSet()
+    void prewarmRecorded(int fontId, const char* utf8Text, uint8_t styleMask);
     PrewarmScope(PrewarmScope&& other) noexcept;
     PrewarmScope& operator=(PrewarmScope&&) = delete;
     PrewarmScope(const PrewarmScope&) = delete;
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+class SdCardFont;
+
+// A font id resolved once against GfxRenderer's font registry.
+//
+// Every id-based text call looks the font up in the registry's std::maps
+// (twice for SD card fonts). Layout and page rendering make several such
+// calls per word, so they resolve the id once per paragraph/page with
+// GfxRenderer::resolveFont() and pass the handle to the FontHandle overloads
+// instead.
+//
+// Plain pointers into the registry: valid until the font is removed or
+// re-registered. Don't keep one across a font change.
+struct FontHandle {
+  int fontId = -1;
+  const EpdFontFamily* family = nullptr;
+  SdCardFont* sdCardFont = nullptr;      // set for SD card fonts
+  const EpdFontData* styleData[4] = {};  // per font variant (style bits 0-1), fallbacks resolved
+
+  explicit operator bool() const { return family != nullptr; }
+  const EpdFontData* getData(const EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    return styleData[static_cast<uint8_t>(style) & EpdFontFamily::BOLD_ITALIC];
+  }
+};
@@ -2,6 +2,8 @@
 
 #include <BidiUtils.h>
 #include <FontDecompressor.h>
+#include <GlyphBitmap.h>
+#include <GlyphRle.h>
 #include <HalGPIO.h>
 #include <Logging.h>
 #include <SdCardFont.h>
@@ -26,18 +28,20 @@ namespace {
 const char* resolveVisualText(const char* text, std::string& visualBuffer, BidiUtils::BidiBaseDir baseDir);
 }  // namespace
 
-const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const {
-  if (fontData->groups != nullptr) {
+const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph,
+                                           uint8_t* rowStride) const {
+  if (rowStride) *rowStride = 0;
+  if (fontData->groups != nullptr || fontData->bitmapEncoding == EPD_BITMAP_RLE) {
     auto* fd = fontCacheManager_ ? fontCacheManager_->getDecompressor() : nullptr;
     if (!fd) {
       LOG_ERR("GFX", "Compressed font but no FontDecompressor set");
       return nullptr;
     }
     uint32_t glyphIndex = static_cast<uint32_t>(glyph - fontData->glyph);
-    // For page-buffer hits the pointer is stable for the page lifetime.
-    // For hot-group hits it is valid only until the next getBitmap() call — callers
-    // must consume it (draw the glyph) before requesting another bitmap.
-    return fd->getBitmap(fontData, glyph, glyphIndex);
+    // Read in place (rowStride set), page-buffer rows stay valid for the page lifetime.
+    // Hot-group rows and packed scratch copies are valid only until the next getBitmap()
+    // call — callers must consume them (draw the glyph) before requesting another bitmap.
+    return fd->getBitmap(fontData, glyph, glyphIndex, rowStride);
   }
   // For SD card fonts, check if the glyph was loaded on demand into the overflow
   // buffer.  getOverflowBitmap() returns:
@@ -89,6 +93,9 @@ void GfxRenderer::begin() {
   panelWidthBytes = display.getDisplayWidthBytes();
   frameBufferSize = display.getBufferSize();
   bwBufferChunks.assign((frameBufferSize + BW_BUFFER_CHUNK_SIZE - 1) / BW_BUFFER_CHUNK_SIZE, nullptr);
+  if (!refreshPlanner.begin(panelWidthBytes, panelHeight)) {
+    LOG_ERR("GFX", "OOM: refresh planner; page turns use the plain refresh cadence");
+  }
 }
 
 bool GfxRenderer::isFontCacheScanning() const { return fontCacheManager_ && fontCacheManager_->isScanning(); }
@@ -100,6 +107,23 @@ void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
   }
 }
 
+FontHandle GfxRenderer::resolveFont(const int fontId) const {
+  FontHandle font;
+  font.fontId = fontId;
+  const auto fontIt = fontMap.find(fontId);
+  if (fontIt != fontMap.end()) {
+    font.family = &fontIt->second;
+    for (uint8_t variant = 0; variant < 4; variant++) {
+      font.styleData[variant] = font.family->getData(static_cast<EpdFontFamily::Style>(variant));
+    }
+  }
+  const auto sdIt = sdCardFonts_.find(fontId);
+  if (sdIt != sdCardFonts_.end()) {
+    font.sdCardFont = sdIt->second;
+  }
+  return font;
+}
+
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
 static inline void rotateCoordinates(const GfxRenderer::Orientation orientation, const int x, const int y, int* phyX,
@@ -212,6 +236,19 @@ static void renderCharScaled(const GfxRenderer& renderer, GfxRenderer::RenderMod
   }
 }
 
+// Whether a raw 2-bit font value (0 = white ... 3 = black) puts a pixel down in this render pass.
+static bool rawDrawsInMode(const GfxRenderer::RenderMode renderMode, const uint8_t raw) {
+  switch (renderMode) {
+    case GfxRenderer::BW:
+      return raw != 0;
+    case GfxRenderer::GRAYSCALE_MSB:
+      return raw == 1 || raw == 2;
+    case GfxRenderer::GRAYSCALE_LSB:
+      return raw == 2;
+  }
+  return false;
+}
+
 template <TextRotation rotation = TextRotation::None>
 static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode,
                            const EpdFontFamily& fontFamily, const uint32_t cp, int cursorX, int cursorY,
@@ -246,55 +283,73 @@ static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode
     }
   }
 
-  const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph);
+  // For Normal:  outer loop advances screenY, inner loop advances screenX
+  // For Rotated: outer loop advances screenX, inner loop advances screenY (in reverse)
+  int outerBase, innerBase;
+  if constexpr (rotation == TextRotation::Rotated90CW) {
+    outerBase = cursorX + fontData->ascender - top;  // screenX = outerBase + glyphY
+    innerBase = cursorY - left;                      // screenY = innerBase - glyphX
+  } else {
+    outerBase = cursorY - top;   // screenY = outerBase + glyphY
+    innerBase = cursorX + left;  // screenX = innerBase + glyphX
+  }
 
-  if (bitmap != nullptr) {
-    // For Normal:  outer loop advances screenY, inner loop advances screenX
-    // For Rotated: outer loop advances screenX, inner loop advances screenY (in reverse)
-    int outerBase, innerBase;
+  // Plots one 2-bit pixel; `raw` is the value straight from the font
+  auto plot2Bit = [&](const int glyphX, const int glyphY, const uint8_t raw) {
+    int screenX, screenY;
     if constexpr (rotation == TextRotation::Rotated90CW) {
-      outerBase = cursorX + fontData->ascender - top;  // screenX = outerBase + glyphY
-      innerBase = cursorY - left;                      // screenY = innerBase - glyphX
+      screenX = outerBase + glyphY;
+      screenY = innerBase - glyphX;
     } else {
-      outerBase = cursorY - top;   // screenY = outerBase + glyphY
-      innerBase = cursorX + left;  // screenX = innerBase + glyphX
+      screenX = innerBase + glyphX;
+      screenY = outerBase + glyphY;
+    }
+
+    // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
+    // we swap this to better match the way images and screen think about colors:
+    // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
+    const uint8_t bmpVal = 3 - raw;
+
+    if (renderMode == GfxRenderer::BW && bmpVal < 3) {
+      // Black (also paints over the grays in BW mode)
+      renderer.drawPixel(screenX, screenY, pixelState);
+    } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+      // Light gray (also mark the MSB if it's going to be a dark gray too)
+      // Dedicated X3 gray LUTs now provide proper 4-level gray on both devices
+      // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
+      renderer.drawPixel(screenX, screenY, false);
+    } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
+      // Dark gray
+      renderer.drawPixel(screenX, screenY, false);
     }
+  };
 
-    if (is2Bit) {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
-          } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
-          }
+  // RLE fonts: runs go straight from flash to the framebuffer, no decoded bitmap in between.
+  // Runs this pass doesn't draw (white, or black in the gray passes) are skipped whole.
+  if (is2Bit && fontData->bitmapEncoding == EPD_BITMAP_RLE) {
+    GlyphRle::forEachRun(&fontData->bitmap[glyph->dataOffset], width, height,
+                         [&](const uint32_t pos, uint32_t run, const uint8_t raw) {
+                           if (!rawDrawsInMode(renderMode, raw)) return;
+                           int glyphY = pos / width;
+                           int glyphX = pos % width;
+                           for (; run > 0; run--) {
+                             plot2Bit(glyphX, glyphY, raw);
+                             if (++glyphX == width) {
+                               glyphX = 0;
+                               glyphY++;
+                             }
+                           }
+                         });
+    return;
+  }
 
-          const uint8_t byte = bitmap[pixelPosition >> 2];
-          const uint8_t bit_index = (3 - (pixelPosition & 3)) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
+  uint8_t rowStride = 0;
+  const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph, &rowStride);
 
-          if (renderMode == GfxRenderer::BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            renderer.drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // Dedicated X3 gray LUTs now provide proper 4-level gray on both devices
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            renderer.drawPixel(screenX, screenY, false);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            renderer.drawPixel(screenX, screenY, false);
-          }
-        }
-      }
+  if (bitmap != nullptr) {
+    if (is2Bit) {
+      // Packed, or byte-aligned rows straight from an inflated group when rowStride is set
+      GlyphBitmap::forEachInkedPixel(bitmap, width, height, rowStride, plot2Bit);
     } else {
       int pixelPosition = 0;
       for (int glyphY = 0; glyphY < height; glyphY++) {
@@ -364,10 +419,17 @@ int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontF
   if (text == nullptr || *text == '\0') {
     return 0;
   }
+  return getTextWidth(resolveFont(fontId), text, style, baseDir);
+}
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+int GfxRenderer::getTextWidth(const FontHandle& font, const char* text, const EpdFontFamily::Style style,
+                              const BidiUtils::BidiBaseDir baseDir) const {
+  if (text == nullptr || *text == '\0') {
+    return 0;
+  }
+
+  if (!font) {
+    LOG_ERR("GFX", "Font %d not found", font.fontId);
     return 0;
   }
 
@@ -375,7 +437,7 @@ int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontF
   const char* renderedText = resolveVisualText(text, visual, baseDir);
 
   int w = 0, h = 0;
-  fontIt->second.getTextDimensions(renderedText, &w, &h, style);
+  font.family->getTextDimensions(renderedText, &w, &h, style);
   return w;
 }
 
@@ -391,11 +453,21 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   if (text == nullptr || *text == '\0') {
     return;
   }
+  drawText(resolveFont(fontId), x, y, text, black, style, baseDir);
+}
+
+void GfxRenderer::drawText(const FontHandle& fontHandle, const int x, const int y, const char* text,
+                           const bool black, const EpdFontFamily::Style style,
+                           const BidiUtils::BidiBaseDir baseDir) const {
+  // cannot draw a NULL / empty string
+  if (text == nullptr || *text == '\0') {
+    return;
+  }
 
   std::string visual;
   const char* renderedText = resolveVisualText(text, visual, baseDir);
 
-  const int yPos = y + getFontAscenderSize(fontId);
+  const int yPos = y + getFontAscenderSize(fontHandle);
   int lastBaseX = x;
   int lastBaseLeft = 0;
   int lastBaseWidth = 0;
@@ -403,16 +475,15 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   int32_t prevAdvanceFP = 0;  // 12.4 fixed-point: prev glyph's advance + next kern for snap
 
   if (fontCacheManager_ && fontCacheManager_->isScanning()) {
-    fontCacheManager_->recordText(renderedText, fontId, style);
+    fontCacheManager_->recordText(renderedText, fontHandle.fontId, style);
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  if (!fontHandle) {
+    LOG_ERR("GFX", "Font %d not found", fontHandle.fontId);
     return;
   }
-  const auto& font = fontIt->second;
+  const auto& font = *fontHandle.family;
 
   const char* textCursor = renderedText;
   uint32_t cp;
@@ -1322,6 +1393,9 @@ void GfxRenderer::clearScreen(const uint8_t color) const {
     return;
   }
   display.clearScreen(color);
+  // Whole frame redrawn from scratch: earlier marks no longer describe it
+  _dirtyX1 = -1;
+  _dirtyY1 = -1;
 }
 
 void GfxRenderer::beginStripTarget(uint8_t* scratch, int stripY0, int stripRows) const {
@@ -1367,6 +1441,43 @@ void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const
   auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
   display.displayBuffer(refreshMode, fadingFix);
+  refreshPlanner.commit(frameBuffer);
+  _displayCount++;
+  _dirtyX1 = -1;
+  _dirtyY1 = -1;
+}
+
+RefreshPlanner::Plan GfxRenderer::displayPlanned(const bool halfDue) const {
+  const auto t0 = millis();
+  const auto plan = refreshPlanner.plan(frameBuffer, halfDue, display.supportsWindowedRefresh());
+  const auto tPlan = millis();
+  switch (plan.action) {
+    case RefreshPlanner::Action::Skip:
+      break;
+    case RefreshPlanner::Action::Window:
+      display.displayWindow(0, plan.firstRow, panelWidth, plan.lastRow - plan.firstRow + 1, fadingFix);
+      break;
+    case RefreshPlanner::Action::Fast:
+      display.displayBuffer(HalDisplay::FAST_REFRESH, fadingFix);
+      break;
+    case RefreshPlanner::Action::Half:
+      display.displayBuffer(HalDisplay::HALF_REFRESH, fadingFix);
+      break;
+  }
+  refreshPlanner.commitPlan();
+  if (plan.action != RefreshPlanner::Action::Skip) {
+    _displayCount++;
+  }
+  _dirtyX1 = -1;
+  _dirtyY1 = -1;
+
+  static constexpr const char* ACTION_NAMES[] = {"skip", "window", "fast", "half"};
+  const auto& stats = refreshPlanner.getStats();
+  LOG_DBG("GFX", "Planned refresh: %s rows=%u-%u changed=%u ink=%u%% plan=%lums (skip=%u win=%u fast=%u half=%u/%u)",
+          ACTION_NAMES[static_cast<int>(plan.action)], plan.firstRow, plan.lastRow, plan.changedRows,
+          plan.inkPermille / 10, tPlan - t0, (unsigned)stats.skipped, (unsigned)stats.windowed, (unsigned)stats.fast,
+          (unsigned)stats.half, (unsigned)stats.heavyInk);
+  return plan;
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
@@ -1565,38 +1676,95 @@ bool GfxRenderer::copyBufferToRegion(int lx, int ly, int lw, int lh, const uint8
   return true;
 }
 
+void GfxRenderer::markDirty(const int x, const int y, const int width, const int height) const {
+  int x0, y0, x1, y1;
+  if (!logicalRectToPhysicalBounds(orientation, x, y, width, height, panelWidth, panelHeight, &x0, &y0, &x1, &y1)) {
+    return;
+  }
+  // Widen to whole bytes: the controller window is addressed in frame buffer bytes
+  x0 &= ~7;
+  x1 |= 7;
+  if (!hasDirtyRegion()) {
+    _dirtyX0 = x0;
+    _dirtyY0 = y0;
+    _dirtyX1 = x1;
+    _dirtyY1 = y1;
+    return;
+  }
+  _dirtyX0 = std::min(_dirtyX0, x0);
+  _dirtyY0 = std::min(_dirtyY0, y0);
+  _dirtyX1 = std::max(_dirtyX1, x1);
+  _dirtyY1 = std::max(_dirtyY1, y1);
+}
+
+void GfxRenderer::displayDirtyRegion(const HalDisplay::RefreshMode fallback) const {
+  if (!hasDirtyRegion()) {
+    return;
+  }
+  const uint32_t windowBytes =
+      static_cast<uint32_t>((_dirtyX1 - _dirtyX0 + 1) / 8) * static_cast<uint32_t>(_dirtyY1 - _dirtyY0 + 1);
+  // Past half the panel the window saves little SPI time; a regular refresh also
+  // keeps the controller's differential base in step with the whole frame.
+  if (windowBytes > frameBufferSize / 2 || !display.supportsWindowedRefresh()) {
+    displayBuffer(fallback);
+    return;
+  }
+  LOG_DBG("GFX", "Windowed refresh: %d,%d %dx%d (%lu bytes)", _dirtyX0, _dirtyY0, _dirtyX1 - _dirtyX0 + 1,
+          _dirtyY1 - _dirtyY0 + 1, static_cast<unsigned long>(windowBytes));
+  display.displayWindow(static_cast<uint16_t>(_dirtyX0), static_cast<uint16_t>(_dirtyY0),
+                        static_cast<uint16_t>(_dirtyX1 - _dirtyX0 + 1), static_cast<uint16_t>(_dirtyY1 - _dirtyY0 + 1),
+                        fadingFix);
+  // The caller vouches that nothing outside the window changed, so the panel now matches the framebuffer
+  refreshPlanner.commit(frameBuffer);
+  _displayCount++;
+  _dirtyX1 = -1;
+  _dirtyY1 = -1;
+}
+
+void GfxRenderer::displayWindow(const int x, const int y, const int width, const int height) const {
+  _dirtyX1 = -1;
+  _dirtyY1 = -1;
+  markDirty(x, y, width, height);
+  displayDirtyRegion();
+}
+
 int GfxRenderer::getSpaceWidth(const int fontId, const EpdFontFamily::Style style) const {
+  return getSpaceWidth(resolveFont(fontId), style);
+}
+
+int GfxRenderer::getSpaceWidth(const FontHandle& font, const EpdFontFamily::Style style) const {
   // Advance table fast-path for SD card fonts during layout
-  auto sdIt = sdCardFonts_.find(fontId);
-  if (sdIt != sdCardFonts_.end() && sdIt->second->hasAdvanceTable()) {
-    const uint8_t resolvedStyle = resolveSdCardStyle(*sdIt->second, style);
-    return fp4::toPixel(sdIt->second->getAdvance(' ', resolvedStyle));
+  if (font.sdCardFont && font.sdCardFont->hasAdvanceTable()) {
+    const uint8_t resolvedStyle = resolveSdCardStyle(*font.sdCardFont, style);
+    return fp4::toPixel(font.sdCardFont->getAdvance(' ', resolvedStyle));
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  if (!font) {
+    LOG_ERR("GFX", "Font %d not found", font.fontId);
     return 0;
   }
 
-  const EpdGlyph* spaceGlyph = fontIt->second.getGlyph(' ', style);
+  const EpdGlyph* spaceGlyph = font.family->getGlyph(' ', style);
   return spaceGlyph ? fp4::toPixel(spaceGlyph->advanceX) : 0;  // snap 12.4 fixed-point to nearest pixel
 }
 
 int GfxRenderer::getSpaceAdvance(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                                  const EpdFontFamily::Style style) const {
+  return getSpaceAdvance(resolveFont(fontId), leftCp, rightCp, style);
+}
+
+int GfxRenderer::getSpaceAdvance(const FontHandle& fontHandle, const uint32_t leftCp, const uint32_t rightCp,
+                                 const EpdFontFamily::Style style) const {
   // Advance table fast-path for SD card fonts during layout.
   // Kern data is not loaded during layout (consistent with previous metadataOnly behavior),
   // so we return just the space advance without kerning.
-  auto sdIt = sdCardFonts_.find(fontId);
-  if (sdIt != sdCardFonts_.end() && sdIt->second->hasAdvanceTable()) {
-    const uint8_t resolvedStyle = resolveSdCardStyle(*sdIt->second, style);
-    return fp4::toPixel(sdIt->second->getAdvance(' ', resolvedStyle));
+  if (fontHandle.sdCardFont && fontHandle.sdCardFont->hasAdvanceTable()) {
+    const uint8_t resolvedStyle = resolveSdCardStyle(*fontHandle.sdCardFont, style);
+    return fp4::toPixel(fontHandle.sdCardFont->getAdvance(' ', resolvedStyle));
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  const auto& font = fontIt->second;
+  if (!fontHandle) return 0;
+  const auto& font = *fontHandle.family;
   const EpdGlyph* spaceGlyph = font.getGlyph(' ', style);
   const int32_t spaceAdvanceFP = spaceGlyph ? static_cast<int32_t>(spaceGlyph->advanceX) : 0;
   // Combine space advance + flanking kern into one fixed-point sum before snapping.
@@ -1608,29 +1776,36 @@ int GfxRenderer::getSpaceAdvance(const int fontId, const uint32_t leftCp, const
 
 int GfxRenderer::getKerning(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                             const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  const int kernFP = fontIt->second.getKerning(leftCp, rightCp, style);  // 4.4 fixed-point
-  return fp4::toPixel(kernFP);                                           // snap 4.4 fixed-point to nearest pixel
+  return getKerning(resolveFont(fontId), leftCp, rightCp, style);
+}
+
+int GfxRenderer::getKerning(const FontHandle& font, const uint32_t leftCp, const uint32_t rightCp,
+                            const EpdFontFamily::Style style) const {
+  if (!font) return 0;
+  const int kernFP = font.family->getKerning(leftCp, rightCp, style);  // 4.4 fixed-point
+  return fp4::toPixel(kernFP);                                         // snap 4.4 fixed-point to nearest pixel
+}
+
+int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, const EpdFontFamily::Style style) const {
+  return getTextAdvanceX(resolveFont(fontId), text, style);
 }
 
-int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFamily::Style style) const {
+int GfxRenderer::getTextAdvanceX(const FontHandle& fontHandle, const char* text, EpdFontFamily::Style style) const {
+  if (!fontHandle) {
+    LOG_ERR("GFX", "Font %d not found", fontHandle.fontId);
+    return 0;
+  }
+  const auto& font = *fontHandle.family;
+
   // Advance table fast-path for SD card fonts during layout.
   // No kerning/ligature lookup — consistent with previous metadataOnly behavior
   // where kern/lig data was not loaded.
-  auto sdIt = sdCardFonts_.find(fontId);
-  if (sdIt != sdCardFonts_.end() && sdIt->second->hasAdvanceTable()) {
+  if (fontHandle.sdCardFont && fontHandle.sdCardFont->hasAdvanceTable()) {
     int32_t widthFP = 0;
     const bool isSupSub = (style & (EpdFontFamily::SUP | EpdFontFamily::SUB)) != 0;
-    const uint8_t styleIdx = resolveSdCardStyle(*sdIt->second, style);
-    const auto fontIt = fontMap.find(fontId);
-    if (fontIt == fontMap.end()) {
-      LOG_ERR("GFX", "Font %d not found", fontId);
-      return 0;
-    }
-    const auto& font = fontIt->second;
+    const uint8_t styleIdx = resolveSdCardStyle(*fontHandle.sdCardFont, style);
     while (uint32_t cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text))) {
-      int32_t advFP = sdIt->second->getAdvance(cp, styleIdx);
+      int32_t advFP = fontHandle.sdCardFont->getAdvance(cp, styleIdx);
       if (advFP == 0 && !utf8IsCombiningMark(cp)) {
         const EpdGlyph* glyph = font.getGlyph(cp, style);
         advFP = glyph ? glyph->advanceX : 0;
@@ -1640,17 +1815,10 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
     return fp4::toPixel(widthFP);
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
-    return 0;
-  }
-
   uint32_t cp;
   uint32_t prevCp = 0;
   int widthPx = 0;
   int32_t prevAdvanceFP = 0;  // 12.4 fixed-point: prev glyph's advance + next kern for snap
-  const auto& font = fontIt->second;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
     if (utf8IsCombiningMark(cp)) {
       continue;
@@ -1675,24 +1843,26 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
   return widthPx;
 }
 
-int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+int GfxRenderer::getFontAscenderSize(const int fontId) const { return getFontAscenderSize(resolveFont(fontId)); }
+
+int GfxRenderer::getFontAscenderSize(const FontHandle& font) const {
+  if (!font) {
+    LOG_ERR("GFX", "Font %d not found", font.fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+  return font.getData(EpdFontFamily::REGULAR)->ascender;
 }
 
-int GfxRenderer::getLineHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+int GfxRenderer::getLineHeight(const int fontId) const { return getLineHeight(resolveFont(fontId)); }
+
+int GfxRenderer::getLineHeight(const FontHandle& font) const {
+  if (!font) {
+    LOG_ERR("GFX", "Font %d not found", font.fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->advanceY;
+  return font.getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
@@ -1775,6 +1945,8 @@ size_t GfxRenderer::getBufferSize() const { return frameBufferSize; }
 
 void GfxRenderer::displayGrayscaleBase(HalDisplay::RefreshMode fallback) const {
   display.displayGrayscaleBase(fallback, fadingFix);
+  refreshPlanner.commit(frameBuffer);
+  _displayCount++;
 }
 
 void GfxRenderer::preconditionGrayscale() const { display.preconditionGrayscale(); }
@@ -1801,7 +1973,12 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuff
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  display.displayGrayBuffer(fadingFix);
+  // Controller RAM holds grayscale planes until a cleanup re-syncs it from the BW frame
+  refreshPlanner.invalidate();
+  _displayCount++;
+}
 
 void GfxRenderer::writeGrayscalePlaneStrip(bool lsbPlane, const uint8_t* scratch, int yStart, int numRows) const {
   // Guard the uint16_t casts below: a negative would wrap to a huge length.
@@ -1811,6 +1988,8 @@ void GfxRenderer::writeGrayscalePlaneStrip(bool lsbPlane, const uint8_t* scratch
 
 bool GfxRenderer::supportsStripGrayscale() const { return display.supportsStripGrayscale(); }
 
+bool GfxRenderer::supportsWindowedRefresh() const { return display.supportsWindowedRefresh(); }
+
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
     if (bwBufferChunk) {
@@ -1881,6 +2060,7 @@ void GfxRenderer::restoreBwBuffer() {
   }
 
   display.cleanupGrayscaleBuffers(frameBuffer);
+  refreshPlanner.commit(frameBuffer);
 
   freeBwBufferChunks();
   LOG_DBG("GFX", "Restored and freed BW buffer chunks");
@@ -1893,6 +2073,7 @@ void GfxRenderer::restoreBwBuffer() {
 void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   if (frameBuffer) {
     display.cleanupGrayscaleBuffers(frameBuffer);
+    refreshPlanner.commit(frameBuffer);
   }
 }
 
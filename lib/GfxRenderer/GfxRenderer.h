@@ -20,6 +20,8 @@ class SdCardFont;
 #include <vector>
 
 #include "Bitmap.h"
+#include "FontHandle.h"
+#include "RefreshPlanner.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -74,6 +76,18 @@ class GfxRenderer {
   mutable int _stripRows = 0;
   mutable bool _stripActive = false;
 
+  // Dirty region for windowed refresh: inclusive physical bounds, x widened to
+  // whole frame buffer bytes. Empty while _dirtyX1 < _dirtyX0. Mutable because
+  // the draw/display path is const. See markDirty().
+  mutable int _dirtyX0 = 0;
+  mutable int _dirtyY0 = 0;
+  mutable int _dirtyX1 = -1;
+  mutable int _dirtyY1 = -1;
+  // Frames pushed to the panel so far, see getDisplayCount()
+  mutable uint32_t _displayCount = 0;
+  // Row signatures of the last BW frame sent to the panel, see displayPlanned()
+  mutable RefreshPlanner refreshPlanner;
+
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
   void freeBwBufferChunks();
@@ -117,6 +131,9 @@ class GfxRenderer {
   void clearSdCardFonts() { sdCardFonts_.clear(); }
   const std::map<int, SdCardFont*>& getSdCardFonts() const { return sdCardFonts_; }
   bool isSdCardFont(int fontId) const { return sdCardFonts_.count(fontId) > 0; }
+  // Look fontId up once for a run of FontHandle text calls. The handle is falsy when
+  // the id isn't registered; the FontHandle overloads then behave like an unknown id.
+  FontHandle resolveFont(int fontId) const;
   // Ensure SD card font glyph data is loaded for the given text. Called from layout code
   // (which holds a const GfxRenderer&) before measuring word widths. Safe to call on non-SD fonts (no-op).
   // styleMask: bitmask of styles to prepare (bit 0=regular, 1=bold, 2=italic, 3=bold-italic).
@@ -135,8 +152,32 @@ class GfxRenderer {
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
+  // Windowed update - display only a rectangular region (logical coords) with a
+  // fast refresh. The window is widened to whole frame buffer bytes.
+  void displayWindow(int x, int y, int width, int height) const;
+
+  // Dirty-region tracking. A caller that redraws only part of an otherwise
+  // unchanged frame marks what it touched (logical coords); marks accumulate
+  // into one bounding box until displayDirtyRegion(), displayBuffer() or
+  // clearScreen() resets them.
+  void markDirty(int x, int y, int width, int height) const;
+  bool hasDirtyRegion() const { return _dirtyX1 >= _dirtyX0; }
+  // Push only the dirty window. Falls back to displayBuffer(fallback) when the
+  // window covers most of the panel or the display has no windowed refresh;
+  // no-op when nothing is marked.
+  void displayDirtyRegion(HalDisplay::RefreshMode fallback = HalDisplay::FAST_REFRESH) const;
+  bool supportsWindowedRefresh() const;
+  // Frames pushed to the panel so far (any display path). A caller that plans a
+  // windowed refresh compares it with the count after its own last frame to
+  // notice that another screen was shown in between.
+  uint32_t getDisplayCount() const { return _displayCount; }
+
+  // Diff the framebuffer against the last frame sent to the panel and send it the
+  // cheapest adequate way: skipped when identical, a fast window over the changed
+  // rows, or a fast/half full refresh. halfDue: the caller's cadence wants a half
+  // refresh now. Returns what was done, see RefreshPlanner.
+  RefreshPlanner::Plan displayPlanned(bool halfDue) const;
+  const RefreshPlanner::Stats& getRefreshStats() const { return refreshPlanner.getStats(); }
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
@@ -189,25 +230,36 @@ class GfxRenderer {
   void drawBitmap1Bit(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight) const;
   void fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state = true) const;
 
-  // Text
+  // Text. The FontHandle overloads skip the font lookup; the fontId ones resolve and forward.
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR,
                    BidiUtils::BidiBaseDir baseDir = BidiUtils::BidiBaseDir::AUTO) const;
+  int getTextWidth(const FontHandle& font, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR,
+                   BidiUtils::BidiBaseDir baseDir = BidiUtils::BidiBaseDir::AUTO) const;
   void drawCenteredText(int fontId, int y, const char* text, bool black = true,
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR,
                         BidiUtils::BidiBaseDir baseDir = BidiUtils::BidiBaseDir::AUTO) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR,
                 BidiUtils::BidiBaseDir baseDir = BidiUtils::BidiBaseDir::AUTO) const;
+  void drawText(const FontHandle& font, int x, int y, const char* text, bool black = true,
+                EpdFontFamily::Style style = EpdFontFamily::REGULAR,
+                BidiUtils::BidiBaseDir baseDir = BidiUtils::BidiBaseDir::AUTO) const;
   int getSpaceWidth(int fontId, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  int getSpaceWidth(const FontHandle& font, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   /// Returns the total inter-word advance: fp4::toPixel(spaceAdvance + kern(leftCp,' ') + kern(' ',rightCp)).
   /// Using a single snap avoids the +/-1 px rounding error that arises when space advance and kern are
   /// snapped separately and then added as integers.
   int getSpaceAdvance(int fontId, uint32_t leftCp, uint32_t rightCp, EpdFontFamily::Style style) const;
+  int getSpaceAdvance(const FontHandle& font, uint32_t leftCp, uint32_t rightCp, EpdFontFamily::Style style) const;
   /// Returns the kerning adjustment between two adjacent codepoints.
   int getKerning(int fontId, uint32_t leftCp, uint32_t rightCp, EpdFontFamily::Style style) const;
+  int getKerning(const FontHandle& font, uint32_t leftCp, uint32_t rightCp, EpdFontFamily::Style style) const;
   int getTextAdvanceX(int fontId, const char* text, EpdFontFamily::Style style) const;
+  int getTextAdvanceX(const FontHandle& font, const char* text, EpdFontFamily::Style style) const;
   int getFontAscenderSize(int fontId) const;
+  int getFontAscenderSize(const FontHandle& font) const;
   int getLineHeight(int fontId) const;
+  int getLineHeight(const FontHandle& font) const;
   std::string truncatedText(int fontId, const char* text, int maxWidth,
                             EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   /// Word-wrap \p text into at most \p maxLines lines, each no wider than
@@ -248,7 +300,10 @@ class GfxRenderer {
   void cleanupGrayscaleWithFrameBuffer() const;
 
   // Font helpers
-  const uint8_t* getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const;
+  // Packed glyph bitmap. With rowStride, compressed glyphs may come back as byte-aligned rows instead;
+  // *rowStride is then the bytes per row (0 = packed).
+  const uint8_t* getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph,
+                                uint8_t* rowStride = nullptr) const;
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
@@ -0,0 +1,127 @@
+#include "RefreshPlanner.h"
+
+#include <Memory.h>
+
+#include <cstring>
+
+bool RefreshPlanner::begin(const uint16_t widthBytes, const uint16_t rows) {
+  this->widthBytes = widthBytes;
+  this->rows = rows;
+  committed = makeUniqueNoThrow<uint32_t[]>(rows);
+  planned = makeUniqueNoThrow<uint32_t[]>(rows);
+  if (!committed || !planned) {
+    committed.reset();
+    planned.reset();
+  }
+  baselineValid = false;
+  planPending = false;
+  return committed != nullptr;
+}
+
+void RefreshPlanner::hashRows(const uint8_t* frame, uint32_t* out) const {
+  const uint16_t words = widthBytes / 4;
+  for (uint16_t row = 0; row < rows; row++) {
+    const uint8_t* p = frame + static_cast<size_t>(row) * widthBytes;
+    uint32_t hash = 2166136261u;
+    for (uint16_t i = 0; i < words; i++, p += 4) {
+      uint32_t word;
+      memcpy(&word, p, sizeof(word));
+      hash = (hash ^ word) * 16777619u;
+    }
+    for (uint16_t i = words * 4; i < widthBytes; i++, p++) {
+      hash = (hash ^ *p) * 16777619u;
+    }
+    out[row] = hash;
+  }
+}
+
+uint32_t RefreshPlanner::countInk(const uint8_t* frame, const uint16_t firstRow, const uint16_t lastRow) const {
+  // Black pixels are 0 bits
+  const uint8_t* p = frame + static_cast<size_t>(firstRow) * widthBytes;
+  const size_t bytes = static_cast<size_t>(lastRow - firstRow + 1) * widthBytes;
+  uint32_t ink = 0;
+  size_t i = 0;
+  for (; i + 4 <= bytes; i += 4) {
+    uint32_t word;
+    memcpy(&word, p + i, sizeof(word));
+    ink += __builtin_popcount(~word);
+  }
+  for (; i < bytes; i++) {
+    ink += __builtin_popcount(static_cast<uint8_t>(~p[i]));
+  }
+  return ink;
+}
+
+RefreshPlanner::Plan RefreshPlanner::plan(const uint8_t* frame, const bool halfDue, const bool windowAllowed) {
+  Plan result{halfDue ? Action::Half : Action::Fast, 0, static_cast<uint16_t>(rows ? rows - 1 : 0), rows, 0};
+  planPending = false;
+  if (!committed || !frame) {
+    // No signatures: behave like the plain cadence
+    (halfDue ? stats.half : stats.fast)++;
+    lastPlan = result;
+    return result;
+  }
+
+  hashRows(frame, planned.get());
+  planPending = true;
+
+  if (baselineValid) {
+    int first = -1;
+    int last = -1;
+    uint16_t changed = 0;
+    for (uint16_t row = 0; row < rows; row++) {
+      if (planned[row] != committed[row]) {
+        if (first < 0) first = row;
+        last = row;
+        changed++;
+      }
+    }
+    if (changed == 0) {
+      result = Plan{Action::Skip, 0, 0, 0, 0};
+      stats.skipped++;
+      lastPlan = result;
+      return result;
+    }
+    result.firstRow = static_cast<uint16_t>(first);
+    result.lastRow = static_cast<uint16_t>(last);
+    result.changedRows = changed;
+  }
+
+  const uint32_t bandRows = result.lastRow - result.firstRow + 1;
+  const uint32_t bandPixels = bandRows * widthBytes * 8;
+  result.inkPermille =
+      static_cast<uint16_t>(bandPixels ? countInk(frame, result.firstRow, result.lastRow) * 1000ULL / bandPixels : 0);
+
+  if (halfDue) {
+    stats.half++;
+  } else if (result.inkPermille >= HEAVY_INK_PERMILLE) {
+    result.action = Action::Half;
+    stats.half++;
+    stats.heavyInk++;
+  } else if (windowAllowed && baselineValid && bandRows * 1000 <= static_cast<uint32_t>(rows) * WINDOW_MAX_ROWS_PERMILLE) {
+    result.action = Action::Window;
+    stats.windowed++;
+  } else {
+    stats.fast++;
+  }
+  lastPlan = result;
+  return result;
+}
+
+void RefreshPlanner::commitPlan() {
+  if (!planPending) {
+    return;
+  }
+  committed.swap(planned);
+  baselineValid = true;
+  planPending = false;
+}
+
+void RefreshPlanner::commit(const uint8_t* frame) {
+  planPending = false;
+  if (!committed || !frame) {
+    return;
+  }
+  hashRows(frame, committed.get());
+  baselineValid = true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Picks the cheapest adequate refresh for the next frame from what actually
+// changed since the frame the panel last received.
+//
+// A second 48 KB framebuffer to diff against is more than the heap can spare,
+// so the previous frame is kept as one 32-bit signature per physical row
+// (~2 KB). A row whose signature differs counts as changed; black pixels are
+// counted on the changed rows only. From that:
+//   - nothing changed             -> Skip (the panel already shows this frame)
+//   - a narrow band of rows       -> Window (fast refresh of that band only,
+//                                    when the display supports it)
+//   - heavy ink in the change     -> Half (fast waveforms ghost on dense black)
+//   - caller's cadence is due     -> Half
+//   - otherwise                   -> Fast
+//
+// Every frame sent to the panel must be committed (GfxRenderer does it on its
+// BW display paths) so the signatures describe the panel, not the last plan.
+class RefreshPlanner {
+ public:
+  enum class Action : uint8_t { Skip, Window, Fast, Half };
+
+  struct Plan {
+    Action action;
+    uint16_t firstRow;     // changed physical rows, inclusive; valid when changedRows > 0
+    uint16_t lastRow;
+    uint16_t changedRows;
+    uint16_t inkPermille;  // black pixels per mille of the changed rows
+  };
+
+  struct Stats {
+    uint32_t skipped;
+    uint32_t windowed;
+    uint32_t fast;
+    uint32_t half;
+    uint32_t heavyInk;  // Half refreshes forced by ink density rather than cadence
+  };
+
+  // A band of at most this share of the rows goes out as a window
+  static constexpr uint16_t WINDOW_MAX_ROWS_PERMILLE = 250;
+  // Changed rows at least this dense in black get a half refresh
+  static constexpr uint16_t HEAVY_INK_PERMILLE = 350;
+
+  RefreshPlanner() = default;
+  RefreshPlanner(const RefreshPlanner&) = delete;
+  RefreshPlanner& operator=(const RefreshPlanner&) = delete;
+
+  // Allocates the signatures (2 x rows x 4 bytes). False on OOM; plan() then always asks for a full refresh.
+  bool begin(uint16_t widthBytes, uint16_t rows);
+
+  // Compare `frame` with the last committed one. halfDue: the caller's refresh cadence wants a half refresh.
+  // windowAllowed: the display can refresh a band of rows; otherwise such a change plans a Fast refresh.
+  Plan plan(const uint8_t* frame, bool halfDue, bool windowAllowed = true);
+  // The frame passed to the last plan() was sent to the panel unchanged
+  void commitPlan();
+  // Record a frame sent to the panel without a plan
+  void commit(const uint8_t* frame);
+  // Panel content no longer matches any committed frame (sleep, grayscale overlay, ...)
+  void invalidate() { baselineValid = false; }
+
+  const Stats& getStats() const { return stats; }
+  const Plan& getLastPlan() const { return lastPlan; }
+
+ private:
+  uint16_t widthBytes = 0;
+  uint16_t rows = 0;
+  std::unique_ptr<uint32_t[]> committed;
+  std::unique_ptr<uint32_t[]> planned;
+  bool baselineValid = false;
+  bool planPending = false;
+  Stats stats{};
+  Plan lastPlan{Action::Fast, 0, 0, 0, 0};
+
+  void hashRows(const uint8_t* frame, uint32_t* out) const;
+  uint32_t countInk(const uint8_t* frame, uint16_t firstRow, uint16_t lastRow) const;
+};
@@ -0,0 +1,157 @@
+#include "HttpRange.h"
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const char* skipSpaces(const char* p) {
+  while (*p == ' ' || *p == '\t') ++p;
+  return p;
+}
+
+// Parses a run of decimal digits. Returns nullptr on no digits or overflow.
+const char* parseSize(const char* p, size_t& out) {
+  if (!isdigit(static_cast<unsigned char>(*p))) return nullptr;
+  size_t value = 0;
+  while (isdigit(static_cast<unsigned char>(*p))) {
+    const size_t digit = static_cast<size_t>(*p - '0');
+    if (value > (SIZE_MAX - digit) / 10) return nullptr;
+    value = value * 10 + digit;
+    ++p;
+  }
+  out = value;
+  return p;
+}
+
+bool startsWithNoCase(const char* s, const char* prefix) {
+  for (; *prefix; ++s, ++prefix) {
+    if (tolower(static_cast<unsigned char>(*s)) != *prefix) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+namespace HttpRange {
+
+RangeRequest parseRangeHeader(const char* header, const size_t fileSize, ByteRange& out) {
+  if (!header) return RangeRequest::FULL;
+  const char* p = skipSpaces(header);
+  if (!startsWithNoCase(p, "bytes")) return RangeRequest::FULL;
+  p = skipSpaces(p + 5);
+  if (*p != '=') return RangeRequest::FULL;
+  p = skipSpaces(p + 1);
+
+  // Multiple ranges would need a multipart/byteranges body; serve the full file instead.
+  if (strchr(p, ',')) return RangeRequest::FULL;
+
+  if (*p == '-') {
+    // Suffix range: the final N bytes.
+    size_t suffix = 0;
+    const char* end = parseSize(skipSpaces(p + 1), suffix);
+    if (!end || *skipSpaces(end) != '\0') return RangeRequest::FULL;
+    if (suffix == 0 || fileSize == 0) return RangeRequest::UNSATISFIABLE;
+    out.first = suffix >= fileSize ? 0 : fileSize - suffix;
+    out.last = fileSize - 1;
+    return RangeRequest::PARTIAL;
+  }
+
+  size_t first = 0;
+  p = parseSize(p, first);
+  if (!p) return RangeRequest::FULL;
+  p = skipSpaces(p);
+  if (*p != '-') return RangeRequest::FULL;
+  p = skipSpaces(p + 1);
+
+  size_t last = SIZE_MAX;
+  if (*p != '\0') {
+    p = parseSize(p, last);
+    if (!p || *skipSpaces(p) != '\0') return RangeRequest::FULL;
+    if (last < first) return RangeRequest::FULL;  // invalid spec, ignored per RFC 9110
+  }
+
+  if (first >= fileSize) return RangeRequest::UNSATISFIABLE;
+  out.first = first;
+  out.last = last >= fileSize ? fileSize - 1 : last;
+  return RangeRequest::PARTIAL;
+}
+
+bool parseContentRange(const char* header, ByteRange& range, size_t& total) {
+  if (!header) return false;
+  const char* p = skipSpaces(header);
+  if (!startsWithNoCase(p, "bytes")) return false;
+  p = skipSpaces(p + 5);
+
+  size_t first = 0;
+  size_t last = 0;
+  p = parseSize(p, first);
+  if (!p || *p != '-') return false;
+  p = parseSize(p + 1, last);
+  if (!p || *p != '/') return false;
+  size_t length = 0;
+  p = parseSize(p + 1, length);
+  if (!p || *skipSpaces(p) != '\0') return false;
+  if (last < first || last >= length) return false;
+
+  range.first = first;
+  range.last = last;
+  total = length;
+  return true;
+}
+
+void formatContentRange(char* buf, const size_t bufSize, const ByteRange& range, const size_t total) {
+  snprintf(buf, bufSize, "bytes %zu-%zu/%zu", range.first, range.last, total);
+}
+
+void formatUnsatisfiedRange(char* buf, const size_t bufSize, const size_t total) {
+  snprintf(buf, bufSize, "bytes */%zu", total);
+}
+
+void formatEtag(char* buf, const size_t bufSize, const size_t size, const uint16_t fatDate, const uint16_t fatTime) {
+  snprintf(buf, bufSize, "\"%zx-%x-%x\"", size, static_cast<unsigned>(fatDate), static_cast<unsigned>(fatTime));
+}
+
+bool ifRangeMatches(const char* ifRange, const char* etag) {
+  if (!ifRange || *ifRange == '\0') return true;
+  const char* p = skipSpaces(ifRange);
+  // Weak validators are never usable for If-Range (RFC 9110 §13.1.5).
+  if (*p != '"') return false;
+  size_t len = strlen(p);
+  while (len > 0 && (p[len - 1] == ' ' || p[len - 1] == '\t')) --len;
+  return etag && strlen(etag) == len && strncmp(p, etag, len) == 0;
+}
+
+RangeRequest planResponse(const char* rangeHeader, const char* ifRange, const char* etag, const size_t fileSize,
+                          ByteRange& out) {
+  out.first = 0;
+  out.last = fileSize > 0 ? fileSize - 1 : 0;
+  // Without an ETag there is no validator for the client to resume against, so
+  // ranges aren't offered. A stale If-Range means the client's partial copy is of
+  // an older file: ignore the Range and send the whole new representation.
+  if (!rangeHeader || !etag || *etag == '\0' || !ifRangeMatches(ifRange, etag)) return RangeRequest::FULL;
+  ByteRange range;
+  const RangeRequest request = parseRangeHeader(rangeHeader, fileSize, range);
+  if (request == RangeRequest::PARTIAL) out = range;
+  return request;
+}
+
+ResumeResponse classifyResumeResponse(const size_t resumeFrom, const int status, const char* contentRange,
+                                      size_t& total) {
+  if (status == 200) return ResumeResponse::FULL_BODY;
+  if (resumeFrom == 0) return ResumeResponse::UNEXPECTED;
+  if (status == 416) return ResumeResponse::RANGE_REJECTED;
+  if (status != 206) return ResumeResponse::UNEXPECTED;
+  // Only continue if the server picked up exactly where our data ends.
+  ByteRange range;
+  size_t length = 0;
+  if (!parseContentRange(contentRange, range, length) || range.first != resumeFrom) {
+    return ResumeResponse::RANGE_REJECTED;
+  }
+  total = length;
+  return ResumeResponse::APPEND;
+}
+
+}  // namespace HttpRange
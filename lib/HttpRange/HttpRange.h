@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Byte-range helpers (RFC 9110 §14) shared by the web server download paths
+ * and the resuming HttpDownloader. Pure string handling, no Arduino types, so
+ * the parsing rules are covered by the host tests.
+ */
+namespace HttpRange {
+
+// Inclusive byte range within a representation of known length.
+struct ByteRange {
+  size_t first = 0;
+  size_t last = 0;
+
+  size_t length() const { return last - first + 1; }
+};
+
+enum class RangeRequest : uint8_t {
+  FULL,           // no usable Range header: send the whole file with 200
+  PARTIAL,        // single satisfiable range: send 206 with Content-Range
+  UNSATISFIABLE,  // syntactically valid but outside the file: send 416
+};
+
+/**
+ * Interpret a request's Range header against a file of fileSize bytes.
+ * Only a single "bytes=" range is honoured; multi-range and unknown units fall
+ * back to FULL, which RFC 9110 explicitly allows a server to do.
+ */
+RangeRequest parseRangeHeader(const char* header, size_t fileSize, ByteRange& out);
+
+/**
+ * Parse a response's "Content-Range: bytes first-last/total" header. An
+ * unknown total (an asterisk) is rejected since a resume needs the full length.
+ */
+bool parseContentRange(const char* header, ByteRange& range, size_t& total);
+
+// "bytes first-last/total" for a 206 response.
+void formatContentRange(char* buf, size_t bufSize, const ByteRange& range, size_t total);
+
+// "bytes */total" for a 416 response.
+void formatUnsatisfiedRange(char* buf, size_t bufSize, size_t total);
+
+/**
+ * Strong ETag for an SD file derived from its size and FAT modify timestamp,
+ * e.g. "\"1a2b3c-5a21-6b40\"". Any rewrite of the file changes at least one.
+ */
+void formatEtag(char* buf, size_t bufSize, size_t size, uint16_t fatDate, uint16_t fatTime);
+
+/**
+ * If-Range evaluation: the range is served only when the validator is our
+ * current strong ETag. HTTP-date validators never match because the device
+ * clock (and therefore FAT mtimes) can't be trusted to one-second precision.
+ * An absent header always matches.
+ */
+bool ifRangeMatches(const char* ifRange, const char* etag);
+
+/**
+ * How the file server answers a GET/HEAD: the Range header is honoured only
+ * when the file has an ETag and If-Range (if any) matches it; otherwise the
+ * whole file is sent. Null headers mean "not present". On PARTIAL, `out` is
+ * the range to send; on FULL it covers the whole file.
+ */
+RangeRequest planResponse(const char* rangeHeader, const char* ifRange, const char* etag, size_t fileSize,
+                          ByteRange& out);
+
+enum class ResumeResponse : uint8_t {
+  APPEND,          // 206 starting exactly at the resume offset: append the body
+  FULL_BODY,       // 200: the body starts at 0, so any partial data must be discarded
+  RANGE_REJECTED,  // 416, or a 206 we can't append to: start the download over
+  UNEXPECTED,      // any other status: fail the attempt
+};
+
+/**
+ * Client side of a resume: classify a download response to a request that
+ * asked for bytes from resumeFrom on (0 = a plain GET). On APPEND, total is
+ * the full length from Content-Range.
+ */
+ResumeResponse classifyResumeResponse(size_t resumeFrom, int status, const char* contentRange, size_t& total);
+
+}  // namespace HttpRange
@@ -13,6 +13,9 @@
 #include <utility>
 #include <vector>
 
+#include "Epub/ParagraphXPathMap.h"
+#include "Epub/Section.h"
+
 namespace {
 std::string stripPrefix(const XML_Char* name) {
   if (!name) {
@@ -278,15 +281,10 @@ class XPathParagraphResolver final : public Print {
     path.push_back({name, siblingIndex});
     parentStates.emplace_back();
 
-    // Count both <p> and <li> as paragraph-like positions, matching how the section
-    // layout tracks them (xpathParagraphIndex and xpathListItemIndex). This ensures
-    // KOReader progress in list items maps to the correct XPath.
-    if (name == "p") {
-      paragraphCount++;
-    } else if (name == "li") {
-      paragraphCount++;
-    }
-    if (paragraphCount == targetParagraph) {
+    // Count <p> only: the target is a value of the section's paragraph LUT
+    // (xpathParagraphIndex), the same index the paragraph XPath map is keyed by.
+    // List items have their own counter.
+    if (name == "p" && ++paragraphCount == targetParagraph) {
       xpath = buildParagraphXPath(spineIndex, path, 0, 0);
       stopped = true;
       XML_StopParser(parser, XML_FALSE);
@@ -526,6 +524,19 @@ std::string ChapterXPathResolver::findXPathForParagraph(const std::shared_ptr<Ep
     return "";
   }
 
+  // The section build recorded where each paragraph starts; only parse the XHTML
+  // when the section isn't cached or the paragraph is past what the map covers.
+  {
+    ParagraphXPathMap map;
+    if (Section::openXPathMap(epub, spineIndex, map)) {
+      std::string xpath = map.xpathFor(ParagraphXPathMap::Kind::Paragraph, paragraphIndex, spineIndex);
+      if (!xpath.empty()) {
+        LOG_DBG("KOX", "Mapped paragraph %u in spine %d -> %s", paragraphIndex, spineIndex, xpath.c_str());
+        return xpath;
+      }
+    }
+  }
+
   const auto href = epub->getSpineItem(spineIndex).href;
   if (href.empty()) {
     return "";
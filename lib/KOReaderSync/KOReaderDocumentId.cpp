@@ -3,8 +3,24 @@
 #include <HalStorage.h>
 #include <Logging.h>
 #include <MD5Builder.h>
+#include <Memory.h>
+#include <Serialization.h>
 
 namespace {
+constexpr char CACHE_FILE_NAME[] = "/koreader_id.bin";
+constexpr size_t NAME_BUFFER_SIZE = 500;
+
+struct FileStamp {
+  uint32_t size = 0;
+  uint16_t date = 0;
+  uint16_t time = 0;
+};
+
+bool readStamp(HalFile& file, FileStamp& stamp) {
+  stamp.size = static_cast<uint32_t>(file.fileSize());
+  return file.getModifyDateTime(&stamp.date, &stamp.time);
+}
+
 // Extract filename from path (everything after last '/')
 std::string getFilename(const std::string& path) {
   const size_t pos = path.rfind('/');
@@ -48,18 +64,22 @@ std::string KOReaderDocumentId::calculate(const std::string& filePath) {
     return "";
   }
 
+  LOG_DBG("KODoc", "Calculating hash for file: %s (size: %zu)", filePath.c_str(), file.fileSize());
+  uint8_t buffer[CHUNK_SIZE];
+  return calculate(file, buffer);
+}
+
+std::string KOReaderDocumentId::calculate(HalFile& file, uint8_t* buffer) {
   const size_t fileSize = file.fileSize();
-  LOG_DBG("KODoc", "Calculating hash for file: %s (size: %zu)", filePath.c_str(), fileSize);
 
   // Initialize MD5 builder
   MD5Builder md5;
   md5.begin();
 
-  // Buffer for reading chunks
-  uint8_t buffer[CHUNK_SIZE];
   size_t totalBytesRead = 0;
 
-  // Read from each offset (i = -1 to 10)
+  // Read from each offset (i = -1 to 10). Offsets only grow, so the reads
+  // walk the file front to back.
   for (int i = -1; i < OFFSET_COUNT - 1; i++) {
     const size_t offset = getOffset(i);
 
@@ -92,3 +112,102 @@ std::string KOReaderDocumentId::calculate(const std::string& filePath) {
 
   return result;
 }
+
+std::string KOReaderDocumentId::calculateCached(const std::string& filePath, const std::string& cacheDir) {
+  HalFile file;
+  if (!Storage.openFileForRead("KODoc", filePath, file)) {
+    LOG_DBG("KODoc", "Failed to open file: %s", filePath.c_str());
+    return "";
+  }
+  uint8_t buffer[CHUNK_SIZE];
+  return calculateCached(file, filePath, cacheDir, buffer);
+}
+
+std::string KOReaderDocumentId::calculateCached(HalFile& file, const std::string& filePath,
+                                                const std::string& cacheDir, uint8_t* buffer) {
+  FileStamp stamp;
+  const bool hasStamp = readStamp(file, stamp);
+  const std::string cachePath = cacheDir + CACHE_FILE_NAME;
+
+  HalFile cacheFile;
+  if (hasStamp && Storage.exists(cachePath.c_str()) && Storage.openFileForRead("KODoc", cachePath, cacheFile)) {
+    uint8_t version = 0;
+    FileStamp cached;
+    std::string cachedPath;
+    std::string cachedId;
+    serialization::readPod(cacheFile, version);
+    if (version == CACHE_VERSION) {
+      serialization::readPod(cacheFile, cached.size);
+      serialization::readPod(cacheFile, cached.date);
+      serialization::readPod(cacheFile, cached.time);
+      serialization::readString(cacheFile, cachedPath);
+      serialization::readString(cacheFile, cachedId);
+    }
+    cacheFile.close();
+    if (version == CACHE_VERSION && cached.size == stamp.size && cached.date == stamp.date &&
+        cached.time == stamp.time && cachedPath == filePath && cachedId.size() == 32) {
+      LOG_DBG("KODoc", "Cached hash: %s", cachedId.c_str());
+      return cachedId;
+    }
+  }
+
+  std::string result = calculate(file, buffer);
+  if (result.empty() || !hasStamp) {
+    return result;
+  }
+
+  Storage.mkdir(cacheDir.c_str());
+  if (Storage.openFileForWrite("KODoc", cachePath, cacheFile)) {
+    serialization::writePod(cacheFile, CACHE_VERSION);
+    serialization::writePod(cacheFile, stamp.size);
+    serialization::writePod(cacheFile, stamp.date);
+    serialization::writePod(cacheFile, stamp.time);
+    serialization::writeString(cacheFile, filePath);
+    serialization::writeString(cacheFile, result);
+    cacheFile.close();
+  }
+  return result;
+}
+
+size_t KOReaderDocumentId::calculateDirectory(const std::string& dirPath, const CacheDirResolver& cacheDirFor,
+                                              const IdCallback& onId) {
+  auto dir = Storage.open(dirPath.c_str());
+  if (!dir || !dir.isDirectory()) {
+    LOG_DBG("KODoc", "Not a directory: %s", dirPath.c_str());
+    return 0;
+  }
+  dir.rewindDirectory();
+
+  const auto nameBuffer = makeUniqueNoThrow<char[]>(NAME_BUFFER_SIZE);
+  const auto buffer = makeUniqueNoThrow<uint8_t[]>(CHUNK_SIZE);
+  if (!nameBuffer || !buffer) {
+    LOG_ERR("KODoc", "OOM hashing %s", dirPath.c_str());
+    dir.close();
+    return 0;
+  }
+
+  const std::string prefix = dirPath.empty() || dirPath.back() != '/' ? dirPath + "/" : dirPath;
+  size_t count = 0;
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (file.isDirectory()) {
+      continue;
+    }
+    file.getName(nameBuffer.get(), NAME_BUFFER_SIZE);
+    const std::string filePath = prefix + nameBuffer.get();
+    const std::string cacheDir = cacheDirFor(filePath);
+    if (cacheDir.empty()) {
+      continue;
+    }
+
+    const std::string id = calculateCached(file, filePath, cacheDir, buffer.get());
+    file.close();
+    if (!id.empty()) {
+      onId(filePath, id);
+      count++;
+    }
+  }
+  dir.close();
+
+  LOG_DBG("KODoc", "Hashed %zu files in %s", count, dirPath.c_str());
+  return count;
+}
@@ -1,6 +1,11 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 
+class HalFile;
+
 /**
  * Calculate KOReader document ID (partial MD5 hash).
  *
@@ -13,6 +18,9 @@
  *            16777216, 67108864, 268435456, 1073741824 bytes
  *
  * If an offset is beyond the file size, it is skipped.
+ *
+ * The content hash can be persisted in a book's cache directory, keyed by the
+ * file's path, size and FAT modification time, so it is only computed once.
  */
 class KOReaderDocumentId {
  public:
@@ -24,6 +32,29 @@ class KOReaderDocumentId {
    */
   static std::string calculate(const std::string& filePath);
 
+  /**
+   * Same as calculate(), but reuses the ID saved in cacheDir when the file's
+   * path, size and modification time still match, and saves it otherwise.
+   *
+   * @param cacheDir The book's cache directory (created if missing)
+   */
+  static std::string calculateCached(const std::string& filePath, const std::string& cacheDir);
+
+  // Returns the cache directory for a file, or an empty string to skip it
+  using CacheDirResolver = std::function<std::string(const std::string& filePath)>;
+  using IdCallback = std::function<void(const std::string& filePath, const std::string& documentId)>;
+
+  /**
+   * Compute (or load from cache) the IDs of every file in a directory that
+   * cacheDirFor accepts. Single pass over the directory: each file is hashed
+   * through the handle the enumeration already opened, reading its chunks in
+   * ascending offset order with one shared buffer.
+   *
+   * @return Number of IDs reported through onId
+   */
+  static size_t calculateDirectory(const std::string& dirPath, const CacheDirResolver& cacheDirFor,
+                                   const IdCallback& onId);
+
   /**
    * Calculate document hash from filename only (filename-based sync mode).
    * This is simpler and works when files have the same name across devices.
@@ -40,6 +71,13 @@ class KOReaderDocumentId {
   // Number of offsets to try (i = -1 to 10, so 12 offsets)
   static constexpr int OFFSET_COUNT = 12;
 
+  // Bumped when the layout of the cached ID file changes
+  static constexpr uint8_t CACHE_VERSION = 1;
+
   // Calculate offset for index i: 1024 << (2*i)
   static size_t getOffset(int i);
+
+  static std::string calculate(HalFile& file, uint8_t* buffer);
+  static std::string calculateCached(HalFile& file, const std::string& filePath, const std::string& cacheDir,
+                                     uint8_t* buffer);
 };
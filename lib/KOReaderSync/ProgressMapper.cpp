@@ -1,6 +1,7 @@
 #include "ProgressMapper.h"
 
 #include <GfxRenderer.h>
+#include <HalStorage.h>
 #include <Logging.h>
 
 #include <algorithm>
@@ -8,6 +9,7 @@
 #include <cstring>
 
 #include "ChapterXPathResolver.h"
+#include "Epub/ParagraphXPathMap.h"
 #include "Epub/Section.h"
 #include "Epub/htmlEntities.h"
 #include "Utf8.h"
@@ -690,6 +692,7 @@ class ParagraphStreamer final : public Print {
   const char* getCapturedAnchorId() const { return capturedAnchorIdLen > 0 ? capturedAnchorId : nullptr; }
   size_t totalBytes() const { return bytesWritten; }
   bool found() const { return revDone || revPFound; }
+  bool reachedTarget() const { return revDone; }
   size_t getTotalVisChars() const { return totalVisChars; }
   size_t getTargetVisChars() const { return targetVisChars; }
   float progress() const {
@@ -701,6 +704,88 @@ bool streamSpine(const std::shared_ptr<Epub>& epub, int spineIndex, ParagraphStr
   const auto href = epub->getSpineItem(spineIndex).href;
   return !href.empty() && epub->readItemContentsToStream(href, s, 1024);
 }
+
+// Resolve an ancestry XPath ending in a <p> or <li> through the section's paragraph
+// XPath map instead of streaming the whole chapter. The map locates the element and
+// the visible characters before it; only the element's own bytes are streamed from
+// the cached XHTML, to place text()[N] + charOffset in visible characters and pick
+// up an anchor id inside it, exactly as the full streaming pass would. Returns false
+// (the caller streams the chapter) when the section or its XHTML isn't cached, the
+// element isn't mapped, or the target isn't inside the element's byte window.
+bool resolveFromXPathMap(const std::shared_ptr<Epub>& epub, const int spineIndex, const XPathStep* steps,
+                         const int stepCount, const int charOffset, const int textNode, CrossPointPosition& result,
+                         float& intra) {
+  const XPathStep& leaf = steps[stepCount - 1];
+  ParagraphXPathMap::Kind kind;
+  if (strcasecmp(leaf.tag, "p") == 0) {
+    kind = ParagraphXPathMap::Kind::Paragraph;
+  } else if (strcasecmp(leaf.tag, "li") == 0) {
+    kind = ParagraphXPathMap::Kind::ListItem;
+  } else {
+    return false;
+  }
+
+  ParagraphXPathMap map;
+  if (!Section::openXPathMap(epub, spineIndex, map) || map.htmlVisibleChars() == 0) {
+    return false;
+  }
+
+  std::string parentPath;
+  for (int i = 0; i + 1 < stepCount; i++) {
+    parentPath += "/" + std::string(steps[i].tag) + "[" + std::to_string(std::max(1, steps[i].siblingIndex)) + "]";
+  }
+  ParagraphXPathMap::Entry entry;
+  const uint16_t index = map.find(kind, parentPath, static_cast<uint16_t>(std::max(1, leaf.siblingIndex)), entry);
+  if (index == 0) {
+    return false;
+  }
+
+  // The element's bytes run at most up to the next element of the same kind
+  ParagraphXPathMap::Entry next;
+  const uint32_t end = map.readEntry(kind, index + 1, next) ? next.byteOffset : map.htmlBytes();
+  const std::string htmlPath = epub->getCachePath() + "/html/" + std::to_string(spineIndex) + ".html";
+  HalFile html;
+  if (end <= entry.byteOffset || !Storage.exists(htmlPath.c_str()) ||
+      !Storage.openFileForRead("PM", htmlPath, html) || end > html.size() || !html.seek(entry.byteOffset)) {
+    return false;
+  }
+
+  // The window starts at the element's own start tag, so it is the first match of its tag
+  XPathStep element = leaf;
+  element.siblingIndex = 1;
+  ParagraphStreamer s(&element, 1, charOffset, textNode);
+  uint8_t buffer[256];
+  for (uint32_t remaining = end - entry.byteOffset; remaining > 0;) {
+    const int read = html.read(buffer, std::min<uint32_t>(sizeof(buffer), remaining));
+    if (read <= 0) {
+      return false;
+    }
+    s.write(buffer, static_cast<size_t>(read));
+    remaining -= static_cast<uint32_t>(read);
+  }
+  if (!s.reachedTarget()) {
+    return false;
+  }
+
+  intra = std::min(1.0f, static_cast<float>(entry.visibleChars + s.getTargetVisChars()) /
+                             static_cast<float>(map.htmlVisibleChars()));
+
+  const uint16_t paragraphIndex = kind == ParagraphXPathMap::Kind::Paragraph
+                                      ? index
+                                      : map.countAtOffset(ParagraphXPathMap::Kind::Paragraph, entry.byteOffset);
+  if (paragraphIndex > 0) {
+    result.paragraphIndex = paragraphIndex;
+    result.hasParagraphIndex = true;
+  }
+  if (kind == ParagraphXPathMap::Kind::ListItem) {
+    result.liIndex = index;
+    result.hasLiIndex = true;
+  }
+  if (const char* anchorId = s.getCapturedAnchorId()) {
+    strncpy(result.xpathAnchorId, anchorId, sizeof(result.xpathAnchorId) - 1);
+  }
+  return true;
+}
 }  // namespace
 
 SavedProgressPosition ProgressMapper::toSavedProgress(const std::shared_ptr<Epub>& epub,
@@ -783,7 +868,15 @@ CrossPointPosition ProgressMapper::toCrossPoint(const std::shared_ptr<Epub>& epu
 
   float intra = 0.0f;
   bool resolvedIntra = false;
-  if (useAncestry) {
+  if (useAncestry && resolveFromXPathMap(epub, result.spineIndex, xpathSteps, xpathStepCount, xpathChar,
+                                         xpathTextNode, result, intra)) {
+    resolvedIntra = true;
+    LOG_DBG("PM", "XPath map %s[%d]/text()[%d]+%d -> %.1f%% (p~%d li~%d anchor=%s)",
+            xpathSteps[xpathStepCount - 1].tag, xpathSteps[xpathStepCount - 1].siblingIndex, xpathTextNode, xpathChar,
+            intra * 100, result.hasParagraphIndex ? static_cast<int>(result.paragraphIndex) : 0,
+            result.hasLiIndex ? static_cast<int>(result.liIndex) : 0,
+            result.xpathAnchorId[0] != '\0' ? result.xpathAnchorId : "none");
+  } else if (useAncestry) {
     ParagraphStreamer s(xpathSteps, xpathStepCount, xpathChar, xpathTextNode);
     if (streamSpine(epub, result.spineIndex, s) && s.found()) {
       intra = s.progress();
@@ -891,6 +984,18 @@ std::string ProgressMapper::generateXPath(const std::shared_ptr<Epub>& epub, int
   const std::string base = "/body/DocFragment[" + std::to_string(spineIndex + 1) + "]/body";
   if (intra <= 0.0f) return base;
 
+  // The section's paragraph map gives the full ancestry without touching the XHTML, for
+  // positions inside the part of the chapter it covers
+  ParagraphXPathMap map;
+  if (Section::openXPathMap(epub, spineIndex, map) && map.htmlBytes() > 0) {
+    const auto target = static_cast<uint32_t>(static_cast<float>(map.htmlBytes()) * std::min(intra, 1.0f));
+    if (target < map.mappedBytes()) {
+      const uint16_t p = map.countAtOffset(ParagraphXPathMap::Kind::Paragraph, target);
+      std::string xpath = map.xpathFor(ParagraphXPathMap::Kind::Paragraph, p, spineIndex);
+      if (!xpath.empty()) return xpath;
+    }
+  }
+
   size_t spineSize = 0;
   const auto href = epub->getSpineItem(spineIndex).href;
   if (href.empty() || !epub->getItemSize(href, &spineSize) || spineSize == 0) return base;
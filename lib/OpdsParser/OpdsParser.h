@@ -2,6 +2,7 @@
 #include <Print.h>
 #include <expat.h>
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -42,9 +43,16 @@ using OpdsBook = OpdsEntry;
  *       }
  *     }
  *   }
+ *
+ * For large catalogs, setEntryCallback() hands each entry over as soon as its
+ * closing tag is parsed instead of collecting them all in getEntries().
  */
 class OpdsParser final : public Print {
  public:
+  // Receives each completed entry; the parser reuses the object afterwards, so
+  // the callback may move from it.
+  using EntryCallback = std::function<void(OpdsEntry& entry)>;
+
   OpdsParser();
   ~OpdsParser();
 
@@ -77,6 +85,12 @@ class OpdsParser final : public Print {
    */
   std::vector<OpdsEntry> getBooks() const;
 
+  /**
+   * Deliver entries to the callback instead of storing them. Must be set
+   * before feeding data; getEntries() stays empty while a callback is set.
+   */
+  void setEntryCallback(EntryCallback callback) { onEntry = std::move(callback); }
+
   /**
    * Clear all parsed entries.
    */
@@ -96,6 +110,7 @@ class OpdsParser final : public Print {
 
   XML_Parser parser = nullptr;
   std::vector<OpdsEntry> entries;
+  EntryCallback onEntry;
   OpdsEntry currentEntry;
   std::string currentText;
 
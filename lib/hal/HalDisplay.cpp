@@ -1,5 +1,7 @@
 #include <HalDisplay.h>
 #include <HalGPIO.h>
+#include <Logging.h>
+#include <SPI.h>
 
 // Global HalDisplay instance
 HalDisplay display;
@@ -45,6 +47,108 @@ void HalDisplay::drawImageTransparent(const uint8_t* imageData, uint16_t x, uint
   einkDisplay.drawImageTransparent(imageData, x, y, w, h, fromProgmem);
 }
 
+namespace {
+// SSD1677 (X4 panel) commands for the windowed update. The SDK drives the same
+// controller for full-frame refreshes but only exposes whole-frame updates.
+constexpr uint8_t CMD_DATA_ENTRY_MODE = 0x11;
+constexpr uint8_t CMD_SET_RAM_X_RANGE = 0x44;
+constexpr uint8_t CMD_SET_RAM_Y_RANGE = 0x45;
+constexpr uint8_t CMD_SET_RAM_X_COUNTER = 0x4E;
+constexpr uint8_t CMD_SET_RAM_Y_COUNTER = 0x4F;
+constexpr uint8_t CMD_WRITE_RAM_BW = 0x24;
+constexpr uint8_t CMD_WRITE_RAM_RED = 0x26;
+constexpr uint8_t CMD_DISPLAY_UPDATE_CTRL1 = 0x21;
+constexpr uint8_t CMD_DISPLAY_UPDATE_CTRL2 = 0x22;
+constexpr uint8_t CMD_MASTER_ACTIVATION = 0x20;
+
+constexpr uint8_t DATA_ENTRY_X_INC_Y_DEC = 0x01;
+// CTRL1: compare BW RAM against RED RAM (the previous frame), as the SDK's fast refresh does
+constexpr uint8_t CTRL1_NORMAL = 0x00;
+// CTRL2 sequence bits: clock/analog on, fast (mode 2) update with the OTP LUT, clock/analog off
+constexpr uint8_t CTRL2_POWER_ON = 0xC0;
+constexpr uint8_t CTRL2_FAST_UPDATE = 0x1C;
+constexpr uint8_t CTRL2_POWER_OFF = 0x03;
+
+constexpr unsigned long BUSY_TIMEOUT_MS = 10000;
+
+const SPISettings EPD_SPI_SETTINGS(40000000, MSBFIRST, SPI_MODE0);
+
+void sendCommand(const uint8_t command) {
+  digitalWrite(EPD_DC, LOW);
+  digitalWrite(EPD_CS, LOW);
+  SPI.transfer(command);
+  digitalWrite(EPD_CS, HIGH);
+}
+
+void sendData(const uint8_t* data, const size_t length) {
+  digitalWrite(EPD_DC, HIGH);
+  digitalWrite(EPD_CS, LOW);
+  SPI.writeBytes(data, length);
+  digitalWrite(EPD_CS, HIGH);
+}
+
+void sendData(const uint8_t data) { sendData(&data, 1); }
+
+bool waitWhileBusy() {
+  const unsigned long start = millis();
+  while (digitalRead(EPD_BUSY) == HIGH) {
+    if (millis() - start > BUSY_TIMEOUT_MS) {
+      LOG_ERR("DISP", "Panel busy for over %lu ms", BUSY_TIMEOUT_MS);
+      return false;
+    }
+    delay(1);
+  }
+  return true;
+}
+
+// Address the RAM window for (x, y, w, h) in frame buffer coordinates. The
+// gates are reversed on this panel, so frame buffer row y is RAM row
+// panelHeight - 1 - y and rows are written with Y decrementing.
+void setRamArea(const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h, const uint16_t panelHeight) {
+  const uint16_t xEnd = x + w - 1;
+  const uint16_t yTop = panelHeight - 1 - y;
+  const uint16_t yBottom = panelHeight - y - h;
+  sendCommand(CMD_DATA_ENTRY_MODE);
+  sendData(DATA_ENTRY_X_INC_Y_DEC);
+  const uint8_t xRange[] = {static_cast<uint8_t>(x & 0xFF), static_cast<uint8_t>(x >> 8),
+                            static_cast<uint8_t>(xEnd & 0xFF), static_cast<uint8_t>(xEnd >> 8)};
+  sendCommand(CMD_SET_RAM_X_RANGE);
+  sendData(xRange, sizeof(xRange));
+  const uint8_t yRange[] = {static_cast<uint8_t>(yTop & 0xFF), static_cast<uint8_t>(yTop >> 8),
+                            static_cast<uint8_t>(yBottom & 0xFF), static_cast<uint8_t>(yBottom >> 8)};
+  sendCommand(CMD_SET_RAM_Y_RANGE);
+  sendData(yRange, sizeof(yRange));
+  sendCommand(CMD_SET_RAM_X_COUNTER);
+  sendData(xRange, 2);
+  sendCommand(CMD_SET_RAM_Y_COUNTER);
+  sendData(yRange, 2);
+}
+
+// Stream the window's rows of the frame buffer into one of the controller RAMs
+void writeRamWindow(const uint8_t ram, const uint8_t* frameBuffer, const uint16_t widthBytes, const uint16_t x,
+                    const uint16_t y, const uint16_t w, const uint16_t h, const uint16_t panelHeight) {
+  setRamArea(x, y, w, h, panelHeight);
+  sendCommand(ram);
+  digitalWrite(EPD_DC, HIGH);
+  digitalWrite(EPD_CS, LOW);
+  const uint8_t* row = frameBuffer + static_cast<size_t>(y) * widthBytes + x / 8;
+  for (uint16_t i = 0; i < h; i++, row += widthBytes) {
+    SPI.writeBytes(row, w / 8);
+  }
+  digitalWrite(EPD_CS, HIGH);
+}
+
+// Run a display update sequence (CTRL2 value) and wait for it to finish
+bool runUpdate(const uint8_t ctrl2) {
+  SPI.beginTransaction(EPD_SPI_SETTINGS);
+  sendCommand(CMD_DISPLAY_UPDATE_CTRL2);
+  sendData(ctrl2);
+  sendCommand(CMD_MASTER_ACTIVATION);
+  SPI.endTransaction();
+  return waitWhileBusy();
+}
+}  // namespace
+
 EInkDisplay::RefreshMode convertRefreshMode(HalDisplay::RefreshMode mode) {
   switch (mode) {
     case HalDisplay::FULL_REFRESH:
@@ -57,23 +161,72 @@ EInkDisplay::RefreshMode convertRefreshMode(HalDisplay::RefreshMode mode) {
   }
 }
 
+void HalDisplay::restorePanelPower() {
+  // The SDK only powers the panel up when its own last refresh turned it off
+  if (panelOffAfterWindow && sdkPanelOn) {
+    runUpdate(CTRL2_POWER_ON);
+  }
+  panelOffAfterWindow = false;
+}
+
 void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen) {
+  restorePanelPower();
   if (gpio.deviceIsX3() && mode == RefreshMode::HALF_REFRESH) {
     einkDisplay.requestResync(1);
   }
 
   einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
+  sdkPanelOn = !turnOffScreen;
 }
 
 void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen) {
+  restorePanelPower();
   if (gpio.deviceIsX3() && mode == RefreshMode::HALF_REFRESH) {
     einkDisplay.requestResync(1);
   }
 
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
+  sdkPanelOn = !turnOffScreen;
+}
+
+void HalDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen) {
+  const uint16_t panelWidth = einkDisplay.getDisplayWidth();
+  const uint16_t panelHeight = einkDisplay.getDisplayHeight();
+  if (!supportsWindowedRefresh() || w == 0 || h == 0 || x % 8 != 0 || w % 8 != 0 || x + w > panelWidth ||
+      y + h > panelHeight) {
+    LOG_DBG("DISP", "Window %u,%u %ux%u not supported, refreshing the frame", x, y, w, h);
+    displayBuffer(FAST_REFRESH, turnOffScreen);
+    return;
+  }
+
+  const uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  const uint16_t widthBytes = einkDisplay.getDisplayWidthBytes();
+
+  // New content into BW RAM; RED RAM still holds what the panel shows
+  SPI.beginTransaction(EPD_SPI_SETTINGS);
+  writeRamWindow(CMD_WRITE_RAM_BW, frameBuffer, widthBytes, x, y, w, h, panelHeight);
+  sendCommand(CMD_DISPLAY_UPDATE_CTRL1);
+  sendData(CTRL1_NORMAL);
+  SPI.endTransaction();
+
+  // Power-on is harmless when the panel is already up and required after the fading fix turned it off
+  runUpdate(CTRL2_POWER_ON | CTRL2_FAST_UPDATE | (turnOffScreen ? CTRL2_POWER_OFF : 0));
+  panelOffAfterWindow = turnOffScreen;
+
+  // Sync RED RAM so the next differential refresh compares against the new window
+  SPI.beginTransaction(EPD_SPI_SETTINGS);
+  writeRamWindow(CMD_WRITE_RAM_RED, frameBuffer, widthBytes, x, y, w, h, panelHeight);
+  SPI.endTransaction();
 }
 
-void HalDisplay::deepSleep() { einkDisplay.deepSleep(); }
+// The X3 panel uses a different controller and waveform set; only the X4's SSD1677 sequence is implemented
+bool HalDisplay::supportsWindowedRefresh() const { return !gpio.deviceIsX3(); }
+
+void HalDisplay::deepSleep() {
+  einkDisplay.deepSleep();
+  sdkPanelOn = false;
+  panelOffAfterWindow = false;
+}
 
 uint8_t* HalDisplay::getFrameBuffer() const { return einkDisplay.getFrameBuffer(); }
 
@@ -89,11 +242,13 @@ void HalDisplay::displayGrayscaleBase(RefreshMode fallback, bool turnOffScreen)
   // resync makes displayGrayscaleBase clear first, matching displayBuffer(HALF).
   // The reader's FAST path is deliberately left on the differential path so
   // per-page grayscale stays cheap.
+  restorePanelPower();
   if (gpio.deviceIsX3() && fallback == RefreshMode::HALF_REFRESH) {
     einkDisplay.requestResync(1);
   }
 
   einkDisplay.displayGrayscaleBase(convertRefreshMode(fallback), turnOffScreen);
+  sdkPanelOn = !turnOffScreen;
 }
 
 void HalDisplay::preconditionGrayscale() { einkDisplay.preconditionGrayscale(); }
@@ -108,7 +263,11 @@ void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { einkDisplay
 
 void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) { einkDisplay.cleanupGrayscaleBuffers(bwBuffer); }
 
-void HalDisplay::displayGrayBuffer(bool turnOffScreen) { einkDisplay.displayGrayBuffer(turnOffScreen); }
+void HalDisplay::displayGrayBuffer(bool turnOffScreen) {
+  restorePanelPower();
+  einkDisplay.displayGrayBuffer(turnOffScreen);
+  sdkPanelOn = !turnOffScreen;
+}
 
 void HalDisplay::writeGrayscalePlaneStrip(bool lsbPlane, const uint8_t* rows, uint16_t yStart, uint16_t numRows) {
   einkDisplay.writeGrayscalePlaneStrip(lsbPlane ? EInkDisplay::GRAY_PLANE_LSB : EInkDisplay::GRAY_PLANE_MSB, rows,
@@ -41,6 +41,16 @@ class HalDisplay {
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
 
+  // Windowed fast refresh: sends only the frame buffer rows/columns inside the
+  // window (physical panel coords) and leaves the rest of the panel untouched.
+  // x and w must be multiples of 8 (whole frame buffer bytes). Driven directly
+  // on the X4 controller since the SDK only refreshes whole frames; without
+  // supportsWindowedRefresh() (or for an unaligned window) it falls back to a
+  // full-frame fast refresh.
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
+  // Whether this panel has the windowed update (X4 only)
+  bool supportsWindowedRefresh() const;
+
   // Power management
   void deepSleep();
 
@@ -81,6 +91,12 @@ class HalDisplay {
 
  private:
   EInkDisplay einkDisplay;
+  // Panel power as the SDK last left it, and whether a windowed refresh has
+  // since powered the panel down behind its back
+  bool sdkPanelOn = false;
+  bool panelOffAfterWindow = false;
+
+  void restorePanelPower();
 };
 
 extern HalDisplay display;
@@ -53,15 +53,32 @@ size_t HalStorage::readFileToBuffer(const char* path, char* buffer, size_t buffe
   HAL_STORAGE_WRAPPED_CALL(readFileToBuffer, path, buffer, bufferSize, maxBytes);
 }
 
+// Mutating calls run under the lock, then report the change once it's released
+#define HAL_STORAGE_NOTIFYING_CALL(path, method, ...) \
+  bool ok;                                           \
+  {                                                  \
+    HalStorage::StorageLock lock;                    \
+    ok = SDCard.method(__VA_ARGS__);                 \
+  }                                                  \
+  notifyChange(path);                                \
+  return ok;
+
 bool HalStorage::writeFile(const char* path, const String& content) {
-  HAL_STORAGE_WRAPPED_CALL(writeFile, path, content);
+  HAL_STORAGE_NOTIFYING_CALL(path, writeFile, path, content);
 }
 
-bool HalStorage::ensureDirectoryExists(const char* path) { HAL_STORAGE_WRAPPED_CALL(ensureDirectoryExists, path); }
+bool HalStorage::ensureDirectoryExists(const char* path) {
+  HAL_STORAGE_NOTIFYING_CALL(path, ensureDirectoryExists, path);
+}
 
 class HalFile::Impl {
  public:
   Impl(FsFile&& fsFile) : file(std::move(fsFile)) {}
+  // Files opened for writing remember their path so closing them can report
+  // the (possibly new or resized) entry to the storage change listener.
+  Impl(FsFile&& fsFile, const char* path) : file(std::move(fsFile)) {
+    if (path && file.isOpen()) writePath = path;
+  }
   // SdFat is not thread-safe; FsFile::close() touches SD/SPI and must run
   // under StorageLock or it races SdSpiCard::m_spiActive across tasks and
   // trips FreeRTOS's xTaskPriorityDisinherit assert. The FsFile member
@@ -69,10 +86,19 @@ class HalFile::Impl {
   // releases, but close() on an already-closed FsFile is a no-op. See SdFat
   // issue #518 and the HAL note in CLAUDE.md.
   ~Impl() {
-    HalStorage::StorageLock lock;
-    file.close();
+    {
+      HalStorage::StorageLock lock;
+      file.close();
+    }
+    notifyClosed();
+  }
+  void notifyClosed() {
+    if (writePath.empty()) return;
+    HalStorage::getInstance().notifyChange(writePath.c_str());
+    writePath.clear();
   }
   FsFile file;
+  std::string writePath;
 };
 
 HalFile::HalFile() = default;
@@ -83,19 +109,27 @@ HalFile& HalFile::operator=(HalFile&&) = default;
 
 HalFile HalStorage::open(const char* path, const oflag_t oflag) {
   StorageLock lock;  // ensure thread safety for the duration of this function
-  return HalFile(std::make_unique<HalFile::Impl>(SDCard.open(path, oflag)));
+  const bool writable = (oflag & (O_WRONLY | O_RDWR)) != 0;
+  return HalFile(std::make_unique<HalFile::Impl>(SDCard.open(path, oflag), writable ? path : nullptr));
 }
 
-bool HalStorage::mkdir(const char* path, const bool pFlag) { HAL_STORAGE_WRAPPED_CALL(mkdir, path, pFlag); }
+bool HalStorage::mkdir(const char* path, const bool pFlag) { HAL_STORAGE_NOTIFYING_CALL(path, mkdir, path, pFlag); }
 
 bool HalStorage::exists(const char* path) { HAL_STORAGE_WRAPPED_CALL(exists, path); }
 
-bool HalStorage::remove(const char* path) { HAL_STORAGE_WRAPPED_CALL(remove, path); }
+bool HalStorage::remove(const char* path) { HAL_STORAGE_NOTIFYING_CALL(path, remove, path); }
 bool HalStorage::rename(const char* oldPath, const char* newPath) {
-  HAL_STORAGE_WRAPPED_CALL(rename, oldPath, newPath);
+  bool ok;
+  {
+    StorageLock lock;
+    ok = SDCard.rename(oldPath, newPath);
+  }
+  notifyChange(oldPath);
+  notifyChange(newPath);
+  return ok;
 }
 
-bool HalStorage::rmdir(const char* path) { HAL_STORAGE_WRAPPED_CALL(rmdir, path); }
+bool HalStorage::rmdir(const char* path) { HAL_STORAGE_NOTIFYING_CALL(path, rmdir, path); }
 
 bool HalStorage::openFileForRead(const char* moduleName, const char* path, HalFile& file) {
   StorageLock lock;  // ensure thread safety for the duration of this function
@@ -117,7 +151,7 @@ bool HalStorage::openFileForWrite(const char* moduleName, const char* path, HalF
   StorageLock lock;  // ensure thread safety for the duration of this function
   FsFile fsFile;
   bool ok = SDCard.openFileForWrite(moduleName, path, fsFile);
-  file = HalFile(std::make_unique<HalFile::Impl>(std::move(fsFile)));
+  file = HalFile(std::make_unique<HalFile::Impl>(std::move(fsFile), path));
   return ok;
 }
 
@@ -129,7 +163,7 @@ bool HalStorage::openFileForWrite(const char* moduleName, const String& path, Ha
   return openFileForWrite(moduleName, path.c_str(), file);
 }
 
-bool HalStorage::removeDir(const char* path) { HAL_STORAGE_WRAPPED_CALL(removeDir, path); }
+bool HalStorage::removeDir(const char* path) { HAL_STORAGE_NOTIFYING_CALL(path, removeDir, path); }
 
 // HalFile implementation
 // Allow doing file operations while ensuring thread safety via HalStorage's mutex.
@@ -146,6 +180,9 @@ bool HalStorage::removeDir(const char* path) { HAL_STORAGE_WRAPPED_CALL(removeDi
 
 void HalFile::flush() { HAL_FILE_WRAPPED_CALL(flush, ); }
 size_t HalFile::getName(char* name, size_t len) { HAL_FILE_WRAPPED_CALL(getName, name, len); }
+bool HalFile::getModifyDateTime(uint16_t* pdate, uint16_t* ptime) {
+  HAL_FILE_WRAPPED_CALL(getModifyDateTime, pdate, ptime);
+}
 size_t HalFile::size() { HAL_FILE_FORWARD_CALL(size, ); }              // already thread-safe, no need to wrap
 size_t HalFile::fileSize() { HAL_FILE_FORWARD_CALL(fileSize, ); }      // already thread-safe, no need to wrap
 uint64_t HalFile::fileSize64() { HAL_FILE_FORWARD_CALL(fileSize, ); }  // already thread-safe, no need to wrap
@@ -159,10 +196,30 @@ int HalFile::read(void* buf, size_t count) { HAL_FILE_WRAPPED_CALL(read, buf, co
 int HalFile::read() { HAL_FILE_WRAPPED_CALL(read, ); }
 size_t HalFile::write(const void* buf, size_t count) { HAL_FILE_WRAPPED_CALL(write, buf, count); }
 size_t HalFile::write(uint8_t b) { HAL_FILE_WRAPPED_CALL(write, b); }
-bool HalFile::rename(const char* newPath) { HAL_FILE_WRAPPED_CALL(rename, newPath); }
+bool HalFile::rename(const char* newPath) {
+  bool ok;
+  {
+    HalStorage::StorageLock lock;
+    assert(impl != nullptr);
+    ok = impl->file.rename(newPath);
+  }
+  // The old location isn't known here, so report an unknown change
+  HalStorage::getInstance().notifyChange(nullptr);
+  if (!impl->writePath.empty()) impl->writePath = newPath;
+  return ok;
+}
 bool HalFile::isDirectory() const { HAL_FILE_FORWARD_CALL(isDirectory, ); }  // already thread-safe, no need to wrap
 void HalFile::rewindDirectory() { HAL_FILE_WRAPPED_CALL(rewindDirectory, ); }
-bool HalFile::close() { HAL_FILE_WRAPPED_CALL(close, ); }
+bool HalFile::close() {
+  bool ok;
+  {
+    HalStorage::StorageLock lock;
+    assert(impl != nullptr);
+    ok = impl->file.close();
+  }
+  impl->notifyClosed();
+  return ok;
+}
 HalFile HalFile::openNextFile() {
   HalStorage::StorageLock lock;
   assert(impl != nullptr);
@@ -45,6 +45,17 @@ class HalStorage {
   bool openFileForWrite(const char* moduleName, const String& path, HalFile& file);
   bool removeDir(const char* path);
 
+  // Called after the device itself creates, removes, renames or finishes
+  // writing a path, so caches of directory contents can drop stale data.
+  // `path` is nullptr when the affected path isn't known (HalFile::rename).
+  // Normally invoked after the storage lock is released; listeners must not
+  // block on anything that is held while waiting for storage.
+  using ChangeListener = void (*)(const char* path);
+  void setChangeListener(ChangeListener listener) { changeListener = listener; }
+  void notifyChange(const char* path) const {
+    if (changeListener) changeListener(path);
+  }
+
   static HalStorage& getInstance() { return instance; }
 
   class StorageLock;  // private class, used internally
@@ -54,6 +65,7 @@ class HalStorage {
 
   bool initialized = false;
   SemaphoreHandle_t storageMutex = nullptr;
+  ChangeListener changeListener = nullptr;
 };
 
 #define Storage HalStorage::getInstance()
@@ -74,6 +86,8 @@ class HalFile : public Print {
 
   void flush();
   size_t getName(char* name, size_t len);
+  // FAT-encoded modify date/time (see SdFat FS_DATE/FS_TIME helpers)
+  bool getModifyDateTime(uint16_t* pdate, uint16_t* ptime);
   size_t size();
   size_t fileSize();
   uint64_t fileSize64();
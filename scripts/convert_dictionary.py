@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+"""
+Convert a StarDict dictionary or a plain TSV word list into the .cpdict
+format read by lib/Dictionary on the device.
+
+A .cpdict holds a sorted headword index split into fixed-size pages, a sparse
+index (first key of every page) that the device keeps in RAM, and the
+definitions packed into raw-deflate blocks. A lookup is a binary search over
+the sparse index, one page read, and one block read + inflate.
+See docs/file-formats.md for the layout.
+
+Usage:
+    python convert_dictionary.py dict.ifo out.cpdict          # StarDict (.idx + .dict/.dict.dz next to it)
+    python convert_dictionary.py words.tsv out.cpdict --title "My Dictionary"
+
+TSV input has one entry per line: headword<TAB>definition. "\\n" in the
+definition becomes a line break.
+"""
+
+from __future__ import annotations
+
+import argparse
+import gzip
+import html
+import pathlib
+import re
+import struct
+import sys
+import zlib
+
+MAGIC = b"CPDC"
+VERSION = 1
+HEADER_FORMAT = "<4sBBHIIIIIII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+MAX_KEY_BYTES = 255
+MAX_DEFINITION_BYTES = 0xFFFF
+# Largest index page the device will read (MAX_PAGE_BYTES in Dictionary.cpp)
+MAX_PAGE_BYTES = 0xFFFF
+
+
+def fold_codepoint(cp: int) -> int:
+    """Mirror of the device's toLowerLatin/toLowerCyrillic, so keys sort and compare identically."""
+    if ord("A") <= cp <= ord("Z"):
+        return cp + 32
+    if 0x00C0 <= cp <= 0x00D6 or 0x00D8 <= cp <= 0x00DE:
+        return cp + 0x20
+    if (
+        (0x0100 <= cp <= 0x0137 and cp % 2 == 0)
+        or (0x0139 <= cp <= 0x0148 and cp % 2 == 1)
+        or (0x014A <= cp <= 0x0177 and cp % 2 == 0)
+        or (0x0179 <= cp <= 0x017E and cp % 2 == 1)
+    ):
+        return cp + 1
+    if cp == 0x0178:
+        return 0x00FF
+    if cp == 0x1E9E:
+        return 0x00DF
+    if 0x0410 <= cp <= 0x042F:
+        return cp + 0x20
+    if cp == 0x0401:
+        return 0x0451
+    return cp
+
+
+def fold_key(word: str) -> bytes:
+    """Lookup key of a headword: case-folded, soft hyphens dropped, whitespace collapsed."""
+    out = []
+    for ch in word:
+        cp = ord(ch)
+        if cp == 0x00AD:
+            continue
+        if cp in (0x2018, 0x2019, 0x02BC):
+            cp = ord("'")
+        if cp in (0x09, 0x0A, 0x0D, 0x20, 0xA0):
+            if out and out[-1] != " ":
+                out.append(" ")
+            continue
+        out.append(chr(fold_codepoint(cp)))
+    return "".join(out).strip().encode("utf-8")
+
+
+def utf8_prefix(text: str, limit: int) -> bytes:
+    """UTF-8 encoding of text cut to at most limit bytes without splitting a character."""
+    encoded = text.encode("utf-8")
+    if len(encoded) <= limit:
+        return encoded
+    return encoded[:limit].decode("utf-8", errors="ignore").encode("utf-8")
+
+
+def clean_definition(text: str, is_html: bool) -> str:
+    if is_html:
+        text = re.sub(r"(?i)<br\s*/?>|</p>|</div>|</li>", "\n", text)
+        text = re.sub(r"<[^>]+>", "", text)
+        text = html.unescape(text)
+    lines = [line.strip() for line in text.replace("\r", "").split("\n")]
+    return "\n".join(line for line in lines if line)
+
+
+def read_tsv(path: pathlib.Path) -> list[tuple[str, str]]:
+    entries = []
+    with path.open(encoding="utf-8") as f:
+        for line_number, line in enumerate(f, 1):
+            line = line.rstrip("\n")
+            if not line or line.startswith("#"):
+                continue
+            if "\t" not in line:
+                print(f"{path}:{line_number}: no tab, skipped", file=sys.stderr)
+                continue
+            word, definition = line.split("\t", 1)
+            entries.append((word, clean_definition(definition.replace("\\n", "\n"), False)))
+    return entries
+
+
+def read_stardict(ifo_path: pathlib.Path) -> tuple[str, list[tuple[str, str]]]:
+    info = {}
+    for line in ifo_path.read_text(encoding="utf-8").splitlines()[1:]:
+        if "=" in line:
+            key, value = line.split("=", 1)
+            info[key.strip()] = value.strip()
+
+    # Not with_suffix: StarDict names often carry a version ("stardict-eng_rus-2.4.2.ifo")
+    def sibling(suffix: str) -> pathlib.Path:
+        return ifo_path.with_name(ifo_path.stem + suffix)
+
+    if not sibling(".idx").exists() and sibling(".idx.gz").exists():
+        idx = gzip.open(sibling(".idx.gz")).read()
+    else:
+        idx = sibling(".idx").read_bytes()
+    if sibling(".dict.dz").exists():
+        data = gzip.open(sibling(".dict.dz")).read()  # dictzip is gzip-compatible
+    else:
+        data = sibling(".dict").read_bytes()
+
+    offset_format = ">Q" if info.get("idxoffsetbits") == "64" else ">I"
+    offset_size = struct.calcsize(offset_format)
+    sequence = info.get("sametypesequence", "")
+
+    entries = []
+    pos = 0
+    while pos < len(idx):
+        end = idx.index(b"\0", pos)
+        word = idx[pos:end].decode("utf-8", errors="replace")
+        pos = end + 1
+        (offset,) = struct.unpack_from(offset_format, idx, pos)
+        (size,) = struct.unpack_from(">I", idx, pos + offset_size)
+        pos += offset_size + 4
+        entries.append((word, stardict_text(data[offset : offset + size], sequence)))
+    return info.get("bookname", ifo_path.stem), entries
+
+
+def stardict_text(record: bytes, sequence: str) -> str:
+    """Keep the textual fields of a StarDict record (m, l, g, t, x, y, h, k, w); drop binary ones."""
+    parts = []
+    pos = 0
+
+    def take_field(kind: str, last: bool) -> None:
+        nonlocal pos
+        if kind.isupper():
+            if last and sequence:
+                size = len(record) - pos
+            else:
+                (size,) = struct.unpack_from(">I", record, pos)
+                pos += 4
+            pos += size  # binary payload (sound, picture, ...)
+            return
+        if last and sequence:
+            raw = record[pos:]
+            pos = len(record)
+        else:
+            end = record.find(b"\0", pos)
+            end = len(record) if end < 0 else end
+            raw = record[pos:end]
+            pos = end + 1
+        text = raw.decode("utf-8", errors="replace")
+        if kind in "mltgxykwh":
+            parts.append(clean_definition(text, kind in "xgh"))
+
+    if sequence:
+        for i, kind in enumerate(sequence):
+            take_field(kind, i == len(sequence) - 1)
+    else:
+        while pos < len(record):
+            kind = chr(record[pos])
+            pos += 1
+            take_field(kind, False)
+    return "\n".join(p for p in parts if p)
+
+
+def build(entries: list[tuple[str, str]], title: str, page_entries: int, block_bytes: int) -> bytes:
+    records = []
+    for word, definition in entries:
+        key = fold_key(word)
+        if not key or not definition:
+            continue
+        if len(key) > MAX_KEY_BYTES:
+            print(f"Headword too long, skipped: {word[:40]}...", file=sys.stderr)
+            continue
+        headword = utf8_prefix(word.strip(), MAX_KEY_BYTES)
+        body = utf8_prefix(definition, MAX_DEFINITION_BYTES)
+        records.append((key, headword, body))
+    # Stable sort: entries sharing a key keep their source order
+    records.sort(key=lambda r: r[0])
+
+    # Definition blocks. Each entry inside a raw block is
+    #   u8 headwordLen, headword, u16 definitionLen, definition
+    blocks = bytearray()
+    index_entries = []
+    raw = bytearray()
+    block_start = 0
+
+    def flush_block() -> None:
+        nonlocal raw
+        if not raw:
+            return
+        compressor = zlib.compressobj(level=9, wbits=-15)
+        packed = compressor.compress(bytes(raw)) + compressor.flush()
+        blocks.extend(struct.pack("<II", len(packed), len(raw)))
+        blocks.extend(packed)
+        raw = bytearray()
+
+    for key, headword, body in records:
+        entry = struct.pack("<B", len(headword)) + headword + struct.pack("<H", len(body)) + body
+        if raw and len(raw) + len(entry) > block_bytes:
+            flush_block()
+        if not raw:
+            block_start = len(blocks)
+        index_entries.append((key, block_start, len(raw)))
+        raw.extend(entry)
+    flush_block()
+
+    # Index pages: u8 keyLen, key, u32 blockOffset (relative to the block area), u16 offsetInBlock.
+    # A page ends after page_entries keys, or earlier when the next key would take it
+    # past MAX_PAGE_BYTES (long keys with a large --page-entries).
+    pages = bytearray()
+    sparse = bytearray()
+    page_count = 0
+    page_start = 0
+    keys_on_page = 0
+    for key, block_offset, entry_offset in index_entries:
+        record = struct.pack("<B", len(key)) + key + struct.pack("<IH", block_offset, entry_offset)
+        if keys_on_page == page_entries or (keys_on_page and len(pages) - page_start + len(record) > MAX_PAGE_BYTES):
+            keys_on_page = 0
+        if keys_on_page == 0:
+            page_start = len(pages)
+            page_count += 1
+            sparse.extend(struct.pack("<IB", page_start, len(key)) + key)
+        pages.extend(record)
+        keys_on_page += 1
+    # End sentinel so the device can size the last page
+    sparse.extend(struct.pack("<I", len(pages)))
+
+    title_bytes = utf8_prefix(title, 255)
+    sparse_offset = HEADER_SIZE + 1 + len(title_bytes)
+    index_offset = sparse_offset + len(sparse)
+    blocks_offset = index_offset + len(pages)
+    header = struct.pack(
+        HEADER_FORMAT,
+        MAGIC,
+        VERSION,
+        0,
+        page_entries,
+        len(index_entries),
+        page_count,
+        sparse_offset,
+        len(sparse),
+        index_offset,
+        blocks_offset,
+        len(blocks),
+    )
+    return header + struct.pack("<B", len(title_bytes)) + title_bytes + sparse + pages + blocks
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", type=pathlib.Path, help="StarDict .ifo or a .tsv file")
+    parser.add_argument("output", type=pathlib.Path, help="destination .cpdict")
+    parser.add_argument("--title", help="dictionary name (default: StarDict bookname or file name)")
+    parser.add_argument("--page-entries", type=int, default=128, help="maximum headwords per index page (default 128)")
+    parser.add_argument("--block-bytes", type=int, default=8192, help="target uncompressed block size (default 8192)")
+    args = parser.parse_args()
+
+    if not 1 <= args.page_entries <= 0xFFFF:
+        parser.error("--page-entries must be between 1 and 65535")
+    if not 256 <= args.block_bytes <= 0xFFFF:
+        parser.error("--block-bytes must be between 256 and 65535")
+    if args.input.suffix == ".ifo":
+        title, entries = read_stardict(args.input)
+    else:
+        title, entries = args.input.stem, read_tsv(args.input)
+    blob = build(entries, args.title or title, args.page_entries, args.block_bytes)
+    args.output.write_bytes(blob)
+    print(f"{args.output}: {len(entries)} entries, {len(blob) / 1024:.0f} KB")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Stand-in OPDS catalog server for testing the on-device OPDS browser.
+
+Serves a paged acquisition feed with a configurable number of synthetic books,
+linked with rel="next"/"previous" like Calibre and COPS catalogs, plus a root
+navigation feed and a search template. Book links return a tiny placeholder
+file so downloads can be exercised too.
+
+Usage:
+    python opds_test_server.py [--port 8080] [--books 2000] [--page-size 50] [--delay 0.5]
+
+Add http://<host-ip>:<port>/opds as an OPDS server on the device.
+"""
+
+from __future__ import annotations
+
+import argparse
+import html
+import time
+import urllib.parse
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+ATOM_TYPE = "application/atom+xml;profile=opds-catalog"
+
+
+def feed(title: str, links: list[str], entries: list[str]) -> bytes:
+    body = [
+        '<?xml version="1.0" encoding="UTF-8"?>',
+        '<feed xmlns="http://www.w3.org/2005/Atom">',
+        "<id>urn:crosspoint:test</id>",
+        f"<title>{html.escape(title)}</title>",
+        *links,
+        *entries,
+        "</feed>",
+    ]
+    return "\n".join(body).encode("utf-8")
+
+
+def book_entry(index: int) -> str:
+    return (
+        "<entry>"
+        f"<title>Test Book {index:05d}</title>"
+        f"<id>urn:crosspoint:book:{index}</id>"
+        f"<author><name>Author {index % 97}</name></author>"
+        f'<link rel="http://opds-spec.org/acquisition" type="application/epub+zip" href="/books/{index}.epub"/>'
+        "</entry>"
+    )
+
+
+class Handler(BaseHTTPRequestHandler):
+    books = 2000
+    page_size = 50
+    delay = 0.0
+
+    def send_body(self, status: int, content_type: str, body: bytes) -> None:
+        self.send_response(status)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def do_GET(self) -> None:  # noqa: N802 (http.server naming)
+        url = urllib.parse.urlparse(self.path)
+        query = urllib.parse.parse_qs(url.query)
+        if self.delay:
+            time.sleep(self.delay)
+
+        if url.path == "/opds":
+            links = [f'<link rel="search" type="{ATOM_TYPE}" href="/opds/search?q={{searchTerms}}"/>']
+            entries = [
+                "<entry><title>All books</title><id>urn:crosspoint:all</id>"
+                f'<link type="{ATOM_TYPE}" href="/opds/books"/></entry>'
+            ]
+            self.send_body(200, ATOM_TYPE, feed("Test catalog", links, entries))
+        elif url.path in ("/opds/books", "/opds/search"):
+            page = int(query.get("page", ["0"])[0])
+            term = query.get("q", [""])[0]
+            matches = [i for i in range(self.books) if term in f"Test Book {i:05d}"]
+            start = page * self.page_size
+            links = []
+            extra = f"&q={urllib.parse.quote(term)}" if url.path.endswith("search") else ""
+            if page > 0:
+                links.append(f'<link rel="previous" type="{ATOM_TYPE}" href="{url.path}?page={page - 1}{extra}"/>')
+            if start + self.page_size < len(matches):
+                links.append(f'<link rel="next" type="{ATOM_TYPE}" href="{url.path}?page={page + 1}{extra}"/>')
+            entries = [book_entry(i) for i in matches[start : start + self.page_size]]
+            self.send_body(200, ATOM_TYPE, feed(f"Books page {page}", links, entries))
+        elif url.path.startswith("/books/"):
+            self.send_body(200, "application/epub+zip", b"PK\x05\x06" + b"\x00" * 18)
+        else:
+            self.send_body(404, "text/plain", b"Not found")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--books", type=int, default=2000, help="number of synthetic books")
+    parser.add_argument("--page-size", type=int, default=50, help="entries per feed page")
+    parser.add_argument("--delay", type=float, default=0.0, help="seconds to wait before each response")
+    args = parser.parse_args()
+
+    Handler.books = args.books
+    Handler.page_size = args.page_size
+    Handler.delay = args.delay
+    server = ThreadingHTTPServer(("0.0.0.0", args.port), Handler)
+    print(f"Serving {args.books} books, {args.page_size} per page, on http://0.0.0.0:{args.port}/opds")
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -17,6 +17,7 @@
 #include "reader/ReaderActivity.h"
 #include "settings/OpdsServerListActivity.h"
 #include "settings/SettingsActivity.h"
+#include "util/DirectoryListingCache.h"
 #include "util/FullScreenMessageActivity.h"
 
 static portMUX_TYPE activityManagerSpinlock = portMUX_INITIALIZER_UNLOCKED;
@@ -40,21 +41,30 @@ void ActivityManager::renderTaskTrampoline(void* param) {
 void ActivityManager::renderTaskLoop() {
   while (true) {
     ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-    // Acquire the lock before reading currentActivity to avoid a TOCTOU race
-    // where the main task deletes the activity between the null-check and render().
-    RenderLock lock;
-    if (currentActivity) {
-      HalPowerManager::Lock powerLock;  // Ensure we don't go into low-power mode while rendering
-      currentActivity->render(std::move(lock));
-    }
-    // Notify any task blocked in requestUpdateAndWait() that the render is done.
-    TaskHandle_t waiter = nullptr;
-    taskENTER_CRITICAL(&activityManagerSpinlock);
-    waiter = waitingTaskHandle;
-    waitingTaskHandle = nullptr;
-    taskEXIT_CRITICAL(&activityManagerSpinlock);
-    if (waiter) {
-      xTaskNotify(waiter, 1, eIncrement);
+    // One render serves every request posted so far; requests arriving during it
+    // are served by the next pass, so a burst of page turns renders only the latest page.
+    while (renderRequests.take()) {
+      {
+        // Acquire the lock before reading currentActivity to avoid a TOCTOU race
+        // where the main task deletes the activity between the null-check and render().
+        RenderLock lock;
+        if (currentActivity) {
+          HalPowerManager::Lock powerLock;  // Ensure we don't go into low-power mode while rendering
+          currentActivity->render(std::move(lock));
+        }
+      }
+      // Notify a task blocked in requestUpdateAndWait() once its request has been rendered.
+      const uint32_t rendered = renderRequests.lastTaken();
+      TaskHandle_t waiter = nullptr;
+      taskENTER_CRITICAL(&activityManagerSpinlock);
+      if (waitingTaskHandle && static_cast<int32_t>(rendered - waitingRequest) >= 0) {
+        waiter = waitingTaskHandle;
+        waitingTaskHandle = nullptr;
+      }
+      taskEXIT_CRITICAL(&activityManagerSpinlock);
+      if (waiter) {
+        xTaskNotify(waiter, 1, eIncrement);
+      }
     }
   }
 }
@@ -141,14 +151,19 @@ void ActivityManager::loop() {
   }
 
   if (requestedUpdate.exchange(false)) {
-    // Using direct notification to signal the render task to update
-    // Increment counter so multiple rapid calls won't be lost
-    if (renderTaskHandle) {
-      xTaskNotify(renderTaskHandle, 1, eIncrement);
-    }
+    postRender();
   }
 }
 
+uint32_t ActivityManager::postRender() {
+  const uint32_t request = renderRequests.post();
+  // Using direct notification to wake the render task; it drains the queue on waking
+  if (renderTaskHandle) {
+    xTaskNotify(renderTaskHandle, 1, eIncrement);
+  }
+  return request;
+}
+
 void ActivityManager::exitActivity(const RenderLock& lock) {
   // Note: lock must be held by the caller
   if (currentActivity) {
@@ -196,6 +211,8 @@ void ActivityManager::goToBrowser() {
 }
 
 void ActivityManager::goToReader(std::string path) {
+  // The reader needs the heap more than the browser needs its cached listings
+  DIR_CACHE.clear();
   replaceActivity(std::make_unique<ReaderActivity>(renderer, mappedInput, std::move(path)));
 }
 
@@ -267,9 +284,7 @@ ScreenshotInfo ActivityManager::getScreenshotInfo() const {
 
 void ActivityManager::requestUpdate(bool immediate) {
   if (immediate) {
-    if (renderTaskHandle) {
-      xTaskNotify(renderTaskHandle, 1, eIncrement);
-    }
+    postRender();
   } else {
     // Deferring the update until current loop is finished
     // This is to avoid multiple updates being requested in the same loop
@@ -290,6 +305,11 @@ void ActivityManager::requestUpdateAndWait() {
   bool holdingRenderLock = (mutexHolder == currTaskHandler);
   if (!alreadyWaiting && !isRenderTask && !holdingRenderLock) {
     waitingTaskHandle = currTaskHandler;
+    // Posted under the spinlock so the render task can't serve it before the waiter is known;
+    // a render already in progress doesn't cover it
+    waitingRequest = renderRequests.post();
+  } else {
+    renderRequests.post();
   }
   taskEXIT_CRITICAL(&activityManagerSpinlock);
 
@@ -12,6 +12,7 @@
 
 #include "GfxRenderer.h"
 #include "MappedInputManager.h"
+#include "RenderRequestQueue.h"
 #include "util/ScreenshotInfo.h"
 
 class Activity;    // forward declaration
@@ -54,9 +55,16 @@ class ActivityManager {
   static void renderTaskTrampoline(void* param);
   [[noreturn]] virtual void renderTaskLoop();
 
-  // Set by requestUpdateAndWait(); read and cleared by the render task after render completes.
+  // Set by requestUpdateAndWait(); read and cleared by the render task once a render that
+  // covers waitingRequest completes.
   // Note: only one waiting task is supported at a time
   TaskHandle_t waitingTaskHandle = nullptr;
+  uint32_t waitingRequest = 0;
+
+  // Pending renders; the render task serves all of them with one render
+  RenderRequestQueue renderRequests;
+  // Post a render request and wake the render task. Returns the request's sequence number.
+  uint32_t postRender();
 
   // Mutex to protect rendering operations from race conditions
   // Must only be used via RenderLock
@@ -112,6 +120,10 @@ class ActivityManager {
   // Trigger a render and block until it completes.
   // Must NOT be called from the render task or while holding a RenderLock.
   void requestUpdateAndWait();
+
+  // Render task: another render was requested while the current one runs, so its
+  // output is about to be replaced. Long renders check it to skip optional stages.
+  bool isRenderSuperseded() const { return renderRequests.superseded(); }
 };
 
 extern ActivityManager activityManager;  // singleton, to be defined in main.cpp
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Render requests from the main loop (and the odd other task) to the render task.
+//
+// Requests carry no payload: an activity keeps what to draw (e.g. the target
+// page) in its own members and render() draws whatever is current. So pending
+// requests coalesce, latest wins: however many arrive while a frame is being
+// drawn, the render task draws once more, and rapid page turns skip straight to
+// the newest page.
+//
+// Lock-free: post() bumps a sequence number, the render task records the one it
+// is serving. A long render polls superseded() between stages to drop work
+// (grayscale passes) for a frame that is about to be replaced anyway.
+class RenderRequestQueue {
+  std::atomic<uint32_t> posted{0};
+  // Written by the render task only
+  std::atomic<uint32_t> served{0};
+  std::atomic<uint32_t> coalesced{0};
+
+ public:
+  // Any task. Returns the request's sequence number.
+  uint32_t post() { return posted.fetch_add(1, std::memory_order_acq_rel) + 1; }
+
+  // Render task: claim every pending request for one render. False when none is pending.
+  bool take() {
+    const uint32_t latest = posted.load(std::memory_order_acquire);
+    const uint32_t previous = served.load(std::memory_order_relaxed);
+    if (latest == previous) {
+      return false;
+    }
+    coalesced.fetch_add(latest - previous - 1, std::memory_order_relaxed);
+    served.store(latest, std::memory_order_release);
+    return true;
+  }
+
+  // Sequence number of the last request claimed by take()
+  uint32_t lastTaken() const { return served.load(std::memory_order_acquire); }
+
+  // A request arrived after the last take(): the frame being drawn will be redrawn right away.
+  bool superseded() const {
+    return posted.load(std::memory_order_acquire) != served.load(std::memory_order_relaxed);
+  }
+
+  // Requests folded into a later render, for diagnostics
+  uint32_t getCoalescedCount() const { return coalesced.load(std::memory_order_relaxed); }
+};
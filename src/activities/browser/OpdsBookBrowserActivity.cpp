@@ -3,8 +3,10 @@
 #include <GfxRenderer.h>
 #include <I18n.h>
 #include <Logging.h>
-#include <OpdsStream.h>
 #include <WiFi.h>
+#include <esp_task_wdt.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 #include "MappedInputManager.h"
 #include "SilentRestart.h"
@@ -18,14 +20,20 @@
 #include "util/UrlUtils.h"
 
 namespace {
-constexpr int PAGE_ITEMS = 23;
-}
+// The fetch runs esp_http_client, TLS included, on this stack
+constexpr uint32_t PREFETCH_STACK_SIZE = 8192;
+// A cancelled fetch only notices the flag when body data arrives; before that it can sit in DNS,
+// the TLS handshake or a stalled read for up to HttpDownloader's 60 s per-operation timeout.
+constexpr unsigned long PREFETCH_CANCEL_TIMEOUT_MS = 65000;
+constexpr TickType_t PREFETCH_WAIT_SLICE = pdMS_TO_TICKS(100);
+}  // namespace
 
 void OpdsBookBrowserActivity::onEnter() {
   Activity::onEnter();
 
   state = BrowserState::CHECK_WIFI;
-  entries.clear();
+  cancelPrefetch();
+  entries.close();
   navigationHistory.clear();
   searchTemplate = "";
   currentPath = "";
@@ -41,7 +49,8 @@ void OpdsBookBrowserActivity::onEnter() {
 
 void OpdsBookBrowserActivity::onExit() {
   Activity::onExit();
-  entries.clear();
+  cancelPrefetch();
+  entries.close();
   navigationHistory.clear();
 
   if (WiFi.getMode() != WIFI_MODE_NULL) {
@@ -92,9 +101,14 @@ void OpdsBookBrowserActivity::loop() {
 
   if (state == BrowserState::BROWSING) {
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-      if (!entries.empty()) {
-        const auto& entry = entries[selectorIndex];
+      OpdsEntry entry;
+      {
+        RenderLock lock(*this);
+        if (const auto* selected = entries.get(selectorIndex)) entry = *selected;
+      }
+      if (!entry.href.empty()) {
         entry.type == OpdsEntryType::BOOK ? downloadBook(entry) : navigateToEntry(entry);
+        return;
       }
     } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
       navigateBack();
@@ -120,6 +134,9 @@ void OpdsBookBrowserActivity::loop() {
         requestUpdate();
       });
     }
+
+    collectPrefetchedPage();
+    prefetchNextPage();
   }
 }
 
@@ -161,8 +178,8 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
     return;
   }
 
-  const char* confirmLabel =
-      (!entries.empty() && entries[selectorIndex].type == OpdsEntryType::BOOK) ? tr(STR_DOWNLOAD) : tr(STR_OPEN);
+  const auto* selected = entries.get(selectorIndex);
+  const char* confirmLabel = (selected && selected->type == OpdsEntryType::BOOK) ? tr(STR_DOWNLOAD) : tr(STR_OPEN);
   const char* searchLabel = (!searchTemplate.empty() && selectorIndex == 0) ? tr(STR_SEARCH) : tr(STR_DIR_UP);
   const auto labels = mappedInput.mapLabels(tr(STR_BACK), confirmLabel, searchLabel, tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
@@ -173,12 +190,15 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
     const auto pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
     renderer.fillRect(0, 60 + (selectorIndex % PAGE_ITEMS) * 30 - 2, pageWidth - 1, 30);
 
+    // The window holds exactly this page, so get() doesn't touch the SD card here
     for (size_t i = pageStartIndex; i < entries.size() && i < static_cast<size_t>(pageStartIndex + PAGE_ITEMS); i++) {
-      const auto& entry = entries[i];
+      const auto* item = entries.get(i);
+      if (!item) break;
+      const auto& entry = *item;
       std::string displayText = (entry.type == OpdsEntryType::NAVIGATION) ? "> " + entry.title : entry.title;
       if (entry.type == OpdsEntryType::BOOK && !entry.author.empty()) displayText += " - " + entry.author;
-      auto item = renderer.truncatedText(UI_10_FONT_ID, displayText.c_str(), pageWidth - 40);
-      renderer.drawText(UI_10_FONT_ID, 20, 60 + (i % PAGE_ITEMS) * 30, item.c_str(),
+      auto text = renderer.truncatedText(UI_10_FONT_ID, displayText.c_str(), pageWidth - 40);
+      renderer.drawText(UI_10_FONT_ID, 20, 60 + (i % PAGE_ITEMS) * 30, text.c_str(),
                         i != static_cast<size_t>(selectorIndex));
     }
   }
@@ -193,42 +213,201 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
     return;
   }
 
+  cancelPrefetch();
   std::string url = (path.find("http") == 0) ? path : UrlUtils::buildUrl(server.url, path);
   LOG_DBG("OPDS", "Fetching: %s", url.c_str());
-  OpdsParser parser;
+  bool spillReady;
   {
-    OpdsParserStream stream{parser};
-    if (!HttpDownloader::fetchUrl(url, stream, server.username, server.password)) {
-      state = BrowserState::ERROR;
-      errorMessage = tr(STR_FETCH_FEED_FAILED);
-      requestUpdate();
+    RenderLock lock(*this);
+    spillReady = entries.reset();
+  }
+  searchTemplate.clear();
+  nextPageUrl.clear();
+  if (!spillReady || !streamPage(url, true)) {
+    state = BrowserState::ERROR;
+    if (!spillReady) errorMessage = tr(STR_OPDS_CACHE_WRITE_FAILED);
+    requestUpdate();
+    return;
+  }
+
+  selectorIndex = 0;
+  state = entries.empty() ? BrowserState::ERROR : BrowserState::BROWSING;
+  if (entries.empty()) errorMessage = tr(STR_NO_ENTRIES);
+  requestUpdate();
+}
+
+bool OpdsBookBrowserActivity::streamPage(const std::string& url, const bool firstPage) {
+  OpdsParser parser;
+  bool prevLinkAdded = !firstPage;
+  bool truncated = false;
+
+  const auto addPrevLink = [this, &parser, &url, &prevLinkAdded] {
+    prevLinkAdded = true;
+    if (!parser.getPrevPageUrl().empty()) {
+      entries.append(OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_PREV_PAGE), "",
+                               UrlUtils::buildUrl(url, parser.getPrevPageUrl()), ""});
+    }
+  };
+
+  // Entries go straight to the SD-backed list as they are parsed. Hrefs are
+  // made absolute here since appended pages may live under a different path.
+  parser.setEntryCallback([this, &url, &prevLinkAdded, &truncated, &addPrevLink](OpdsEntry& entry) {
+    RenderLock lock(*this);
+    // Feed-level links precede the entries in practice, so the previous page
+    // link is known by the time the first entry completes
+    if (!prevLinkAdded) addPrevLink();
+    // Keep a slot for the "next page" entry
+    if (entries.size() + 1 >= OpdsEntryWindow::MAX_ENTRIES) {
+      truncated = true;
       return;
     }
+    entry.href = UrlUtils::buildUrl(url, entry.href);
+    entries.append(entry);
+  });
+
+  const bool fetched = HttpDownloader::fetchUrl(
+      url,
+      [&parser](const uint8_t* data, const size_t len) {
+        parser.write(data, len);
+        return !parser.error();
+      },
+      server.username, server.password);
+  if (fetched) parser.flush();
+
+  if (!fetched || !parser) {
+    errorMessage = fetched ? tr(STR_PARSE_FEED_FAILED) : tr(STR_FETCH_FEED_FAILED);
+    return false;
+  }
+  if (truncated) {
+    LOG_ERR("OPDS", "Feed exceeds %u entries, rest dropped", static_cast<unsigned>(OpdsEntryWindow::MAX_ENTRIES));
   }
 
-  if (!parser) {
-    state = BrowserState::ERROR;
-    errorMessage = tr(STR_PARSE_FEED_FAILED);
-    requestUpdate();
+  if (firstPage) searchTemplate = parser.getSearchTemplate();
+  nextPageUrl = parser.getNextPageUrl().empty() ? "" : UrlUtils::buildUrl(url, parser.getNextPageUrl());
+
+  RenderLock lock(*this);
+  if (!prevLinkAdded) addPrevLink();
+  if (!nextPageUrl.empty()) {
+    entries.append(OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_NEXT_PAGE), "", nextPageUrl, ""});
+  }
+  return true;
+}
+
+void OpdsBookBrowserActivity::prefetchNextPage() {
+  // Fetch the next feed page once the cursor reaches the last screen page, so
+  // scrolling continues into it. The "next page" entry stays in place until the
+  // page arrives, so it can still be opened explicitly in the meantime.
+  if (prefetchJob || nextPageUrl.empty() || static_cast<size_t>(selectorIndex + PAGE_ITEMS) < entries.size()) return;
+  // Near the cap the "next page" entry stays and opens the page as a new feed
+  if (entries.size() + PAGE_ITEMS * 2 > OpdsEntryWindow::MAX_ENTRIES) return;
+
+  std::shared_ptr<PrefetchJob> job(new (std::nothrow) PrefetchJob());
+  if (!job) {
+    LOG_ERR("OPDS", "OOM: prefetch job");
+    return;
+  }
+  job->done = xSemaphoreCreateBinary();
+  if (!job->done) {
+    LOG_ERR("OPDS", "OOM: prefetch semaphore");
+    return;
+  }
+  job->url = std::move(nextPageUrl);
+  job->username = server.username;
+  job->password = server.password;
+  nextPageUrl.clear();
+  LOG_DBG("OPDS", "Prefetching: %s", job->url.c_str());
+
+  // The task owns its own reference, released when it exits
+  auto* taskRef = new (std::nothrow) std::shared_ptr<PrefetchJob>(job);
+  if (!taskRef || xTaskCreate(&prefetchTask, "OpdsPrefetch", PREFETCH_STACK_SIZE, taskRef, uxTaskPriorityGet(nullptr),
+                              nullptr) != pdPASS) {
+    LOG_ERR("OPDS", "Failed to start prefetch task");
+    delete taskRef;
+    nextPageUrl = std::move(job->url);
     return;
   }
+  prefetchJob = std::move(job);
+}
 
-  searchTemplate = parser.getSearchTemplate();
-  const auto& nextUrl = parser.getNextPageUrl();
-  const auto& prevUrl = parser.getPrevPageUrl();
-  entries = std::move(parser).getEntries();
+void OpdsBookBrowserActivity::prefetchTask(void* param) {
+  auto* ref = static_cast<std::shared_ptr<PrefetchJob>*>(param);
+  {
+    PrefetchJob& job = **ref;
+    OpdsParser parser;
+    parser.setEntryCallback([&job](OpdsEntry& entry) {
+      if (job.cancelled || job.entries.size() >= OpdsEntryWindow::MAX_ENTRIES) return;
+      entry.href = UrlUtils::buildUrl(job.url, entry.href);
+      job.entries.push_back(std::move(entry));
+    });
+    const bool fetched = HttpDownloader::fetchUrl(
+        job.url,
+        [&parser, &job](const uint8_t* data, const size_t len) {
+          parser.write(data, len);
+          return !parser.error() && !job.cancelled;
+        },
+        job.username, job.password);
+    if (fetched) parser.flush();
+    job.ok = fetched && parser;
+    if (job.ok && !parser.getNextPageUrl().empty()) {
+      job.nextPageUrl = UrlUtils::buildUrl(job.url, parser.getNextPageUrl());
+    }
+    job.finished = true;
+    xSemaphoreGive(job.done);
+  }
+  delete ref;
+  vTaskDelete(nullptr);
+}
 
-  if (!prevUrl.empty()) {
-    entries.insert(entries.begin(), OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_PREV_PAGE), "", prevUrl, ""});
+void OpdsBookBrowserActivity::collectPrefetchedPage() {
+  if (!prefetchJob || !prefetchJob->finished) return;
+  const std::shared_ptr<PrefetchJob> job = std::move(prefetchJob);
+  if (!job->ok) {
+    // The "next page" entry is still there, so the page can be opened explicitly
+    LOG_ERR("OPDS", "Prefetch failed: %s", job->url.c_str());
+    return;
   }
-  if (!nextUrl.empty()) {
-    entries.push_back(OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_NEXT_PAGE), "", nextUrl, ""});
+
+  const size_t lastPage = (entries.size() - 1) / PAGE_ITEMS;
+  {
+    RenderLock lock(*this);
+    entries.popBack();  // the "next page" entry
+    bool truncated = false;
+    for (const auto& entry : job->entries) {
+      // Keep a slot for the "next page" entry
+      if (entries.size() + 1 >= OpdsEntryWindow::MAX_ENTRIES) {
+        truncated = true;
+        break;
+      }
+      entries.append(entry);
+    }
+    if (truncated) {
+      LOG_ERR("OPDS", "Feed exceeds %u entries, rest dropped", static_cast<unsigned>(OpdsEntryWindow::MAX_ENTRIES));
+    }
+    nextPageUrl = job->nextPageUrl;
+    if (!nextPageUrl.empty()) {
+      entries.append(OpdsEntry{OpdsEntryType::NAVIGATION, tr(STR_NEXT_PAGE), "", nextPageUrl, ""});
+    }
   }
+  // Only the page that held the "next page" entry looks different now
+  if (static_cast<size_t>(selectorIndex / PAGE_ITEMS) == lastPage) requestUpdate();
+}
 
-  selectorIndex = 0;
-  state = entries.empty() ? BrowserState::ERROR : BrowserState::BROWSING;
-  if (entries.empty()) errorMessage = tr(STR_NO_ENTRIES);
-  requestUpdate();
+void OpdsBookBrowserActivity::cancelPrefetch() {
+  if (!prefetchJob) return;
+  // Wait for the task to stop, so its TLS session is gone before the caller opens the next one.
+  // The page can be fetched again later (a new feed load clears the URL anyway).
+  prefetchJob->cancelled = true;
+  const unsigned long start = millis();
+  while (xSemaphoreTake(prefetchJob->done, PREFETCH_WAIT_SLICE) != pdTRUE) {
+    esp_task_wdt_reset();
+    if (millis() - start > PREFETCH_CANCEL_TIMEOUT_MS) {
+      // Past every socket timeout; the task frees the job whenever it does return
+      LOG_ERR("OPDS", "Prefetch did not stop within %lu ms", PREFETCH_CANCEL_TIMEOUT_MS);
+      break;
+    }
+  }
+  nextPageUrl = prefetchJob->url;
+  prefetchJob.reset();
 }
 
 void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
@@ -239,7 +418,10 @@ void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
 
   state = BrowserState::LOADING;
   statusMessage = tr(STR_LOADING);
-  entries.clear();
+  {
+    RenderLock lock(*this);
+    entries.close();
+  }
   selectorIndex = 0;
   requestUpdate(true);
   fetchFeed(currentPath);
@@ -253,7 +435,10 @@ void OpdsBookBrowserActivity::navigateBack() {
     navigationHistory.pop_back();
     state = BrowserState::LOADING;
     statusMessage = tr(STR_LOADING);
-    entries.clear();
+    {
+      RenderLock lock(*this);
+      entries.close();
+    }
     selectorIndex = 0;
     requestUpdate();
     fetchFeed(currentPath);
@@ -265,6 +450,8 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
   statusMessage = book.title;
   downloadProgress = downloadTotal = 0;
   requestUpdate(true);
+  // One transfer at a time: two TLS sessions don't fit the heap
+  cancelPrefetch();
 
   // Build full download URL relative to the current feed, not the root server URL
   const std::string feedUrl = UrlUtils::buildUrl(server.url, currentPath);
@@ -1,10 +1,15 @@
 #pragma once
 #include <OpdsParser.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "OpdsEntryWindow.h"
 #include "OpdsServerStore.h"
 #include "activities/Activity.h"
 #include "util/ButtonNavigator.h"
@@ -12,6 +17,9 @@
 /**
  * Activity for browsing and downloading books from an OPDS server.
  * Supports navigation through catalog hierarchy and downloading EPUBs.
+ * Feeds are parsed as they stream in; entries are kept on the SD card with one
+ * page in RAM, and the feed's next page is fetched on a worker task and
+ * appended while the user scrolls.
  */
 class OpdsBookBrowserActivity final : public Activity {
  public:
@@ -26,12 +34,15 @@ class OpdsBookBrowserActivity final : public Activity {
   void render(RenderLock&&) override;
 
  private:
+  static constexpr int PAGE_ITEMS = 23;
+
   ButtonNavigator buttonNavigator;
   BrowserState state = BrowserState::LOADING;
-  std::vector<OpdsEntry> entries;
+  OpdsEntryWindow entries{PAGE_ITEMS};
   std::vector<std::string> navigationHistory;
   std::string currentPath;
   std::string searchTemplate;
+  std::string nextPageUrl;  // Resolved URL of the feed page not yet appended to entries
   bool consumeConfirm = false;
   bool consumeBack = false;  // Added missing member
   int selectorIndex = 0;
@@ -42,10 +53,34 @@ class OpdsBookBrowserActivity final : public Activity {
 
   OpdsServer server;  // Copied at construction — safe even if the store changes during browsing
 
+  // Next-page fetch running on a worker task, so a slow or stalled server never blocks input.
+  // Shared with the task, which gives `done` as it finishes. loop() appends the entries of a
+  // finished job; cancelPrefetch() waits for `done`, so the next transfer never overlaps it.
+  struct PrefetchJob {
+    ~PrefetchJob() {
+      if (done) vSemaphoreDelete(done);
+    }
+    SemaphoreHandle_t done = nullptr;
+    std::string url;
+    std::string username;
+    std::string password;
+    std::vector<OpdsEntry> entries;
+    std::string nextPageUrl;
+    bool ok = false;
+    std::atomic<bool> cancelled{false};
+    std::atomic<bool> finished{false};
+  };
+  std::shared_ptr<PrefetchJob> prefetchJob;
+
   void checkAndConnectWifi();
   void launchWifiSelection();
   void onWifiSelectionComplete(bool connected);
   void fetchFeed(const std::string& path);
+  bool streamPage(const std::string& url, bool firstPage);
+  void prefetchNextPage();
+  void collectPrefetchedPage();
+  void cancelPrefetch();
+  static void prefetchTask(void* param);
   void navigateToEntry(const OpdsEntry& entry);
   void navigateBack();
   void downloadBook(const OpdsEntry& book);
@@ -0,0 +1,98 @@
+#include "OpdsEntryWindow.h"
+
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+namespace {
+constexpr char SPILL_FILE[] = "/.crosspoint/opds_feed.bin";
+}
+
+bool OpdsEntryWindow::reset() {
+  close();
+  Storage.mkdir("/.crosspoint");
+  file = Storage.open(SPILL_FILE, O_RDWR | O_CREAT | O_TRUNC);
+  if (!file) {
+    LOG_ERR("OPDS", "Cannot create %s", SPILL_FILE);
+    return false;
+  }
+  return true;
+}
+
+void OpdsEntryWindow::close() {
+  window.clear();
+  window.shrink_to_fit();
+  windowStart = 0;
+  offsets.clear();
+  offsets.shrink_to_fit();
+  endOffset = 0;
+  if (file) {
+    file.close();
+    Storage.remove(SPILL_FILE);
+  }
+}
+
+bool OpdsEntryWindow::append(const OpdsEntry& entry) {
+  if (!file || full()) return false;
+
+  if (!file.seekSet(endOffset)) {
+    LOG_ERR("OPDS", "Spill seek failed at %u", static_cast<unsigned>(endOffset));
+    return false;
+  }
+  serialization::writePod(file, static_cast<uint8_t>(entry.type));
+  serialization::writeString(file, entry.title);
+  serialization::writeString(file, entry.author);
+  serialization::writeString(file, entry.href);
+  serialization::writeString(file, entry.id);
+  const size_t position = file.position();
+  if (position != endOffset + 1 + 4 * sizeof(uint32_t) + entry.title.size() + entry.author.size() +
+                      entry.href.size() + entry.id.size()) {
+    LOG_ERR("OPDS", "Spill write failed");
+    return false;
+  }
+
+  offsets.push_back(endOffset);
+  endOffset = static_cast<uint32_t>(position);
+  return true;
+}
+
+void OpdsEntryWindow::popBack() {
+  if (offsets.empty()) return;
+  // The next append overwrites the dropped record in place
+  endOffset = offsets.back();
+  offsets.pop_back();
+  if (windowStart + window.size() > offsets.size()) {
+    window.clear();
+  }
+}
+
+const OpdsEntry* OpdsEntryWindow::get(const size_t index) {
+  if (index >= offsets.size()) return nullptr;
+  if (index < windowStart || index >= windowStart + window.size()) {
+    if (!loadWindow(index / windowSize * windowSize)) return nullptr;
+  }
+  return &window[index - windowStart];
+}
+
+bool OpdsEntryWindow::loadWindow(const size_t start) {
+  window.clear();
+  windowStart = start;
+  if (!file || !file.seekSet(offsets[start])) {
+    LOG_ERR("OPDS", "Spill seek failed for entry %u", static_cast<unsigned>(start));
+    return false;
+  }
+
+  const size_t end = std::min(start + windowSize, offsets.size());
+  window.resize(end - start);
+  for (auto& entry : window) {
+    uint8_t type;
+    serialization::readPod(file, type);
+    entry.type = static_cast<OpdsEntryType>(type);
+    serialization::readString(file, entry.title);
+    serialization::readString(file, entry.author);
+    serialization::readString(file, entry.href);
+    serialization::readString(file, entry.id);
+  }
+  return true;
+}
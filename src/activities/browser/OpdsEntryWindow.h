@@ -0,0 +1,55 @@
+#pragma once
+#include <HalStorage.h>
+#include <OpdsParser.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Entries of the OPDS feed being browsed, spilled to a file on the SD card as
+ * they stream in. Only a fixed-size window of entries (one screen page) lives
+ * in RAM; the rest is reloaded on demand through a 4-byte-per-entry offset
+ * index, so a catalog's size no longer translates into heap.
+ *
+ * Not thread-safe: the browser serializes access with its RenderLock.
+ */
+class OpdsEntryWindow {
+ public:
+  // Bounds the offset index; past this the browser stops appending pages
+  static constexpr size_t MAX_ENTRIES = 4096;
+
+  explicit OpdsEntryWindow(size_t windowSize) : windowSize(windowSize) {}
+  ~OpdsEntryWindow() { close(); }
+
+  OpdsEntryWindow(const OpdsEntryWindow&) = delete;
+  OpdsEntryWindow& operator=(const OpdsEntryWindow&) = delete;
+
+  // Start an empty list, (re)creating the spill file
+  bool reset();
+  // Release the window and delete the spill file
+  void close();
+
+  bool append(const OpdsEntry& entry);
+  // Drop the last entry (the "next page" placeholder when more entries arrive)
+  void popBack();
+
+  size_t size() const { return offsets.size(); }
+  bool empty() const { return offsets.empty(); }
+  bool full() const { return offsets.size() >= MAX_ENTRIES; }
+
+  // Entry at index, loading the window that contains it from the SD card when
+  // needed. Returns nullptr for out-of-range indices or read errors. The
+  // pointer stays valid until the next get(), popBack() or reset().
+  const OpdsEntry* get(size_t index);
+
+ private:
+  const size_t windowSize;
+  HalFile file;
+  std::vector<uint32_t> offsets;
+  uint32_t endOffset = 0;
+  std::vector<OpdsEntry> window;
+  size_t windowStart = 0;
+
+  bool loadWindow(size_t start);
+};
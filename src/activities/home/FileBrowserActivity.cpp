@@ -14,6 +14,7 @@
 #include "components/UITheme.h"
 #include "fontIds.h"
 #include "util/BookCacheUtils.h"
+#include "util/DirectoryListingCache.h"
 
 namespace {
 constexpr unsigned long GO_HOME_MS = 1000;
@@ -22,31 +23,18 @@ constexpr size_t NAME_BUFFER_SIZE = 500;
 
 void FileBrowserActivity::loadFiles() {
   files.clear();
+  // New directory contents: the next frame can't reuse the previous one
+  listRefresh.invalidate();
 
-  auto root = Storage.open(basepath.c_str());
-  if (!root || !root.isDirectory()) {
-    return;
-  }
-
-  root.rewindDirectory();
-
-  if (!fileNameBuffer) {
-    LOG_ERR("FileBrowser", "fileNameBuffer not allocated");
-    root.close();
-    return;
-  }
-
-  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
-    file.getName(fileNameBuffer.get(), NAME_BUFFER_SIZE);
-    if ((!SETTINGS.showHiddenFiles && fileNameBuffer[0] == '.') ||
-        strcmp(fileNameBuffer.get(), "System Volume Information") == 0) {
-      continue;
+  DIR_CACHE.forEach(basepath, [this](const DirectoryListing::Entry& entry) {
+    if ((!SETTINGS.showHiddenFiles && entry.name[0] == '.') || strcmp(entry.name, "System Volume Information") == 0) {
+      return;
     }
 
-    if (file.isDirectory()) {
-      files.emplace_back(std::string(fileNameBuffer.get()) + "/");
+    if (entry.isDirectory) {
+      files.emplace_back(std::string(entry.name) + "/");
     } else {
-      std::string_view filename{fileNameBuffer.get()};
+      std::string_view filename{entry.name};
       if (mode == Mode::PickFirmware) {
         // Firmware picker: only show .bin files.
         if (FsHelpers::checkFileExtension(filename, ".bin")) {
@@ -58,8 +46,8 @@ void FileBrowserActivity::loadFiles() {
         files.emplace_back(filename);
       }
     }
-  }
-  root.close();
+  });
+  // Cached listings are already in this order, but large folders are streamed in on-card order
   FsHelpers::sortFileList(files);
 }
 
@@ -362,12 +350,13 @@ void FileBrowserActivity::render(RenderLock&&) {
   const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
   const int contentHeight =
       pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing - pathReserved;
+  const Rect listRect{0, contentTop, pageWidth, contentHeight};
   if (files.empty()) {
     const char* emptyMsg = (mode == Mode::PickFirmware) ? tr(STR_NO_BIN_FILES) : tr(STR_NO_FILES_FOUND);
     renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, contentTop + 20, emptyMsg);
   } else {
     GUI.drawList(
-        renderer, Rect{0, contentTop, pageWidth, contentHeight}, files.size(), selectorIndex,
+        renderer, listRect, files.size(), selectorIndex,
         [this](int index) { return getFileName(files[index]); }, nullptr,
         [this](int index) { return UITheme::getFileIcon(files[index]); },
         [this](int index) { return getFileExtension(files[index]); }, false);
@@ -410,7 +399,12 @@ void FileBrowserActivity::render(RenderLock&&) {
                                             files.empty() ? "" : tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  if (mode == Mode::PickFirmware) {
+    // The Confirm hint follows the selection here, so a row-only refresh would leave it stale
+    listRefresh.invalidate();
+  }
+  listRefresh.display(renderer, listRect, static_cast<int>(files.size()),
+                      files.empty() ? -1 : static_cast<int>(selectorIndex));
 }
 
 size_t FileBrowserActivity::findEntry(const std::string& name) const {
@@ -7,6 +7,7 @@
 
 #include "RecentBooksStore.h"
 #include "activities/Activity.h"
+#include "components/ListSelectionRefresh.h"
 #include "util/ButtonNavigator.h"
 
 class FileBrowserActivity final : public Activity {
@@ -19,6 +20,7 @@ class FileBrowserActivity final : public Activity {
   bool removeDirFile(const std::string& fullPath);
 
   ButtonNavigator buttonNavigator;
+  ListSelectionRefresh listRefresh;
 
   size_t selectorIndex = 0;
 
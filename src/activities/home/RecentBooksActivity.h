@@ -7,11 +7,13 @@
 
 #include "RecentBooksStore.h"
 #include "activities/Activity.h"
+#include "components/ListSelectionRefresh.h"
 #include "util/ButtonNavigator.h"
 
 class RecentBooksActivity final : public Activity {
  private:
   ButtonNavigator buttonNavigator;
+  ListSelectionRefresh listRefresh;
 
   size_t selectorIndex = 0;
 
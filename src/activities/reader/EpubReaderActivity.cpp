@@ -5,6 +5,8 @@
 #include <FontCacheManager.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
+#include <HalClock.h>
+#include <HalPowerManager.h>
 #include <HalStorage.h>
 #include <I18n.h>
 #include <JsonSettingsIO.h>
@@ -24,8 +26,10 @@
 #include "EpubReaderChapterSelectionActivity.h"
 #include "EpubReaderFootnotesActivity.h"
 #include "EpubReaderPercentSelectionActivity.h"
+#include "EpubReaderSearchActivity.h"
 #include "EpubReaderUtils.h"
 #include "KOReaderCredentialStore.h"
+#include "KOReaderDocumentId.h"
 #include "KOReaderSyncActivity.h"
 #include "MappedInputManager.h"
 #include "ProgressMapper.h"
@@ -35,6 +39,7 @@
 #include "components/UITheme.h"
 #include "fontIds.h"
 #include "util/BookmarkUtil.h"
+#include "util/QrUtils.h"
 #include "util/ScreenshotUtil.h"
 
 namespace {
@@ -161,6 +166,11 @@ void EpubReaderActivity::onEnter() {
 
   epub->setupCacheDir();
 
+  // Hash once on open so KOReader sync later only reads the cached document ID
+  if (KOREADER_STORE.hasCredentials() && KOREADER_STORE.getMatchMethod() == DocumentMatchMethod::BINARY) {
+    KOReaderDocumentId::calculateCached(epub->getPath(), epub->getCachePath());
+  }
+
   HalFile f;
   if (Storage.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
     uint8_t data[6];
@@ -220,6 +230,10 @@ void EpubReaderActivity::onExit() {
   }
 
   section.reset();
+  PageArena::releaseSpareSlabs();
+  if (auto* fcm = renderer.getFontCacheManager()) {
+    fcm->releaseCrossPageCaches();
+  }
   if (pendingReadFolderMove && epub) {
     const std::string srcPath = epub->getPath();
     const std::string oldCachePath = epub->getCachePath();
@@ -289,6 +303,31 @@ void EpubReaderActivity::loop() {
     }
   }
 
+  // While the page is being read, warm the font caches with the next page's recorded glyph set so
+  // the page turn finds them resident. Same rule as the build above: never delay a pending render.
+  if (prewarmAheadPage >= 0 && !RenderLock::peek()) {
+    RenderLock lock;
+    std::string glyphSetText;
+    uint8_t glyphSetStyleMask = 0;
+    if (section && section->loadPageGlyphSet(prewarmAheadPage, glyphSetText, glyphSetStyleMask) &&
+        glyphSetStyleMask != 0) {
+      renderer.getFontCacheManager()->prewarmAhead(SETTINGS.getReaderFontId(), glyphSetText.c_str(),
+                                                   glyphSetStyleMask);
+    }
+    prewarmAheadPage = -1;
+  }
+
+  // Clock minute or battery reading changed under an idle page: refresh just the status bar.
+  // Skipped without a windowed refresh, which would redraw the whole page instead.
+  if (statusBarTop >= 0 && !statusBarRefreshPending && renderer.supportsWindowedRefresh() &&
+      millis() - lastStatusBarCheckMs >= STATUS_BAR_CHECK_INTERVAL_MS) {
+    lastStatusBarCheckMs = millis();
+    if (statusBarValues() != lastStatusBarValues) {
+      statusBarRefreshPending = true;
+      requestUpdate();
+    }
+  }
+
   // End-of-Book screen reached (currentSpineIndex == spine count) means the book is
   // finished. Two independent finished-book features key off this same condition.
   const bool atEndOfBook = currentSpineIndex > 0 && currentSpineIndex >= epub->getSpineItemsCount();
@@ -687,9 +726,15 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::DISPLAY_QR: {
       if (section && section->currentPage >= 0 && section->currentPage < section->pageCount) {
-        std::string fullText = section->getTextFromSectionFile();
+        // One bounded buffer: anything past the QR capacity would be cut anyway
+        std::string fullText(QrUtils::MAX_QR_CAPACITY + 1, '\0');
+        PageTextSink sink(&fullText[0], fullText.size());
+        section->forEachWordOnPage(section->currentPage, [&sink](const char* word, const uint16_t len, bool) {
+          return sink.append(word, len);
+        });
+        fullText.resize(sink.size());
         if (!fullText.empty()) {
-          startActivityForResult(std::make_unique<QrDisplayActivity>(renderer, mappedInput, fullText),
+          startActivityForResult(std::make_unique<QrDisplayActivity>(renderer, mappedInput, std::move(fullText)),
                                  [this](const ActivityResult& result) {});
           break;
         }
@@ -738,6 +783,22 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
           progressChangeResultHandler);
       break;
     }
+    case EpubReaderMenuActivity::MenuAction::SEARCH: {
+      // Only section caches laid out for the current settings are scanned page by page
+      const uint16_t viewportWidth = lastViewportWidth;
+      const uint16_t viewportHeight = lastViewportHeight;
+      auto sectionLoader = [viewportWidth, viewportHeight](Section& searchSection) {
+        return searchSection.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                             SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment,
+                                             viewportWidth, viewportHeight, SETTINGS.hyphenationEnabled,
+                                             SETTINGS.embeddedStyle, SETTINGS.imageRendering,
+                                             SETTINGS.focusReadingEnabled);
+      };
+      startActivityForResult(
+          std::make_unique<EpubReaderSearchActivity>(renderer, mappedInput, epub, std::move(sectionLoader)),
+          progressChangeResultHandler);
+      break;
+    }
     case EpubReaderMenuActivity::MenuAction::TOGGLE_BOOKMARK: {
       addBookmark();
       break;
@@ -887,6 +948,15 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     return;
   }
 
+  if (statusBarRefreshPending) {
+    statusBarRefreshPending = false;
+    if (refreshStatusBarOnly()) {
+      return;
+    }
+  }
+  // Set again once a page is on screen
+  statusBarTop = -1;
+
   const auto showPendingSyncSaveError = [this]() {
     if (!pendingSyncSaveError) return;
     pendingSyncSaveError = false;
@@ -937,6 +1007,8 @@ void EpubReaderActivity::render(RenderLock&& lock) {
 
   const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
   const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+  lastViewportWidth = viewportWidth;
+  lastViewportHeight = viewportHeight;
 
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
@@ -1185,6 +1257,17 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     const auto start = millis();
     renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
+    prewarmAheadPage = section->currentPage + 1;
+    statusBarTop = renderer.getScreenHeight() - orientedMarginBottom;
+    statusBarSpineIndex = currentSpineIndex;
+    statusBarPage = section->currentPage;
+    statusBarDisplayCount = renderer.getDisplayCount();
+    lastStatusBarValues = statusBarValues();
+    // Fragmentation = share of free heap not usable as one block; page slabs come from PageArena
+    LOG_DBG("ERS", "Heap: free=%u largest=%u fragmentation=%u%%, page slabs new=%u reused=%u",
+            (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMaxAllocHeap(),
+            (unsigned)(100 - 100ULL * ESP.getMaxAllocHeap() / std::max<uint32_t>(ESP.getFreeHeap(), 1)),
+            (unsigned)PageArena::getStats().slabsAllocated, (unsigned)PageArena::getStats().slabsReused);
   }
   saveProgress(currentSpineIndex, section->currentPage, section->estimatedTotalPages());
 
@@ -1233,11 +1316,16 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   const auto t0 = millis();
   const int fontId = SETTINGS.getReaderFontId();
 
-  // Font prewarm: scan pass accumulates text, then prewarm, then real render
+  // Font prewarm from the glyph set recorded when the page was laid out, or, for a page without
+  // one, a scan pass that accumulates its text; then the real render
   auto* fcm = renderer.getFontCacheManager();
   auto scope = fcm->createPrewarmScope();
-  page->render(renderer, fontId, orientedMarginLeft, orientedMarginTop);  // scan pass
-  scope.endScanAndPrewarm();
+  if (page->glyphSetStyleMask != 0) {
+    scope.prewarmRecorded(fontId, page->glyphSetText.c_str(), page->glyphSetStyleMask);
+  } else {
+    page->render(renderer, fontId, orientedMarginLeft, orientedMarginTop);  // scan pass
+    scope.endScanAndPrewarm();
+  }
   const auto tPrewarm = millis();
 
   const bool pageHasImages = page->hasImages();
@@ -1298,31 +1386,41 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     const int gwBytes = renderer.getDisplayWidthBytes();
 
     auto scratch = makeUniqueNoThrow<uint8_t[]>(static_cast<size_t>(gwBytes) * STRIP_ROWS);
-    if (!scratch) {
-      LOG_ERR("ERS", "OOM: grayscale strip scratch (%d bytes); skipping AA this page", gwBytes * STRIP_ROWS);
-    } else {
-      // Bands may be streamed in any order: X4 windows each via setRamArea, X3
-      // via PTL.
-      renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    // Streams one plane band by band. Stops early (false) once another page turn
+    // is queued: the BW page is already up, and the AA pass for a page about to
+    // be replaced would only delay the next one.
+    const auto writePlane = [&](const bool lsb) {
+      renderer.setRenderMode(lsb ? GfxRenderer::GRAYSCALE_LSB : GfxRenderer::GRAYSCALE_MSB);
       for (int y = 0; y < gh; y += STRIP_ROWS) {
+        if (activityManager.isRenderSuperseded()) {
+          return false;
+        }
         const int rows = (gh - y < STRIP_ROWS) ? (gh - y) : STRIP_ROWS;
         renderer.beginStripTarget(scratch.get(), y, rows);
         renderer.clearScreen(0x00);
         renderGrayscalePass();
         renderer.endStripTarget();
-        renderer.writeGrayscalePlaneStrip(true, scratch.get(), y, rows);
+        renderer.writeGrayscalePlaneStrip(lsb, scratch.get(), y, rows);
       }
+      return true;
+    };
+
+    if (!scratch) {
+      LOG_ERR("ERS", "OOM: grayscale strip scratch (%d bytes); skipping AA this page", gwBytes * STRIP_ROWS);
+    } else {
+      // Bands may be streamed in any order: X4 windows each via setRamArea, X3
+      // via PTL.
+      const bool lsbDone = writePlane(true);
       const auto tGrayLsb = millis();
 
       // MSB plane.
-      renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-      for (int y = 0; y < gh; y += STRIP_ROWS) {
-        const int rows = (gh - y < STRIP_ROWS) ? (gh - y) : STRIP_ROWS;
-        renderer.beginStripTarget(scratch.get(), y, rows);
-        renderer.clearScreen(0x00);
-        renderGrayscalePass();
-        renderer.endStripTarget();
-        renderer.writeGrayscalePlaneStrip(false, scratch.get(), y, rows);
+      if (!lsbDone || !writePlane(false)) {
+        // Partly written planes live in controller RAM only; re-sync it from the
+        // intact BW framebuffer like after a completed pass.
+        renderer.setRenderMode(GfxRenderer::BW);
+        renderer.cleanupGrayscaleWithFrameBuffer();
+        LOG_DBG("ERS", "Page render (tiled): grayscale cancelled by a newer render after %lums", millis() - tDisplay);
+        return;
       }
       const auto tGrayMsb = millis();
 
@@ -1363,6 +1461,14 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
       renderer.copyGrayscaleLsbBuffers();
       const auto tGrayLsb = millis();
 
+      // Another page turn is queued: skip the rest of the AA pass for this page
+      if (activityManager.isRenderSuperseded()) {
+        renderer.setRenderMode(GfxRenderer::BW);
+        renderer.restoreBwBuffer();
+        LOG_DBG("ERS", "Page render: grayscale cancelled by a newer render after %lums", millis() - tDisplay);
+        return;
+      }
+
       // Render and copy to MSB buffer
       renderer.clearScreen(0x00);
       renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
@@ -1393,6 +1499,47 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   }
 }
 
+uint32_t EpubReaderActivity::statusBarValues() const {
+  // FNV-1a over what the bar prints; a plain integer so loop() can compare it cheaply
+  uint32_t hash = 2166136261u;
+  const auto mix = [&hash](const char* text) {
+    for (; *text; ++text) {
+      hash = (hash ^ static_cast<uint8_t>(*text)) * 16777619u;
+    }
+  };
+  if (SETTINGS.statusBarClock && halClock.isAvailable()) {
+    char timeBuf[9];
+    if (halClock.formatTime(timeBuf, sizeof(timeBuf), SETTINGS.clockUtcOffsetQ, SETTINGS.clockFormat == 1)) {
+      mix(timeBuf);
+    }
+  }
+  if (SETTINGS.statusBarBattery &&
+      SETTINGS.hideBatteryPercentage == CrossPointSettings::HIDE_BATTERY_PERCENTAGE::HIDE_NEVER) {
+    mix("|");
+    mix(std::to_string(powerManager.getBatteryPercentage()).c_str());
+  }
+  return hash;
+}
+
+bool EpubReaderActivity::refreshStatusBarOnly() {
+  // Anything else shown since the page (popup, menu, another page) means the framebuffer
+  // and panel no longer hold just that page
+  if (!section || statusBarTop < 0 || currentSpineIndex != statusBarSpineIndex ||
+      section->currentPage != statusBarPage || renderer.getDisplayCount() != statusBarDisplayCount) {
+    return false;
+  }
+
+  const int width = renderer.getScreenWidth();
+  const int height = renderer.getScreenHeight() - statusBarTop;
+  renderer.fillRect(0, statusBarTop, width, height, false);
+  renderStatusBar();
+  renderer.markDirty(0, statusBarTop, width, height);
+  renderer.displayDirtyRegion();
+  statusBarDisplayCount = renderer.getDisplayCount();
+  lastStatusBarValues = statusBarValues();
+  return true;
+}
+
 void EpubReaderActivity::renderStatusBar() const {
   // Calculate progress in book. Use the estimated total while a giant spine is still building so
   // "page X of Y" and the progress bar don't read off the small build watermark.
@@ -1538,9 +1685,13 @@ void EpubReaderActivity::addBookmark() {
     bookmarkRemoved = true;
     currentPageBookmarked = false;
   } else {
-    std::string pageText;
+    // Only the start of the page makes it into the summary
+    char pageText[BookmarkUtil::MAX_SUMMARY_LENGTH * 2];
+    PageTextSink sink(pageText, sizeof(pageText));
     if (currentPage >= 0 && currentPage < pageCount) {
-      pageText = section->getTextFromSectionFile();
+      section->forEachWordOnPage(currentPage, [&sink](const char* word, const uint16_t len, bool) {
+        return sink.append(word, len);
+      });
     }
     BookmarkEntry entry;
     entry.percentage = progress.percentage;
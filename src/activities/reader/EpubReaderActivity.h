@@ -46,6 +46,9 @@ class EpubReaderActivity final : public Activity {
   // Set when the reader is left at end-of-book and SETTINGS.moveFinishedToReadFolder is on.
   // Consumed in onExit() to relocate the finished book into /Read/.
   bool pendingReadFolderMove = false;
+  // Viewport of the last laid-out page, so search can open section caches built for it
+  uint16_t lastViewportWidth = 0;
+  uint16_t lastViewportHeight = 0;
   // Next-book suggestion menu for the End-of-Book screen
   EndOfBookOptions endOfBookOptions;
 
@@ -61,7 +64,25 @@ class EpubReaderActivity final : public Activity {
 
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
+  // Page of the current section whose recorded glyph set loop() prewarms into the cross-page font
+  // caches while the reader is on the page before it (-1 = nothing pending)
+  int prewarmAheadPage = -1;
   void renderStatusBar() const;
+
+  // Status bar refresh without a page re-render: when only the clock or battery reading
+  // changed, the bar is redrawn over the BW frame still in the framebuffer and pushed
+  // through a display window. Valid while nothing else was displayed since the page.
+  static constexpr unsigned long STATUS_BAR_CHECK_INTERVAL_MS = 1000;
+  bool statusBarRefreshPending = false;
+  int statusBarTop = -1;  // logical y where the page content ends and the bar begins
+  int statusBarSpineIndex = -1;
+  int statusBarPage = -1;
+  uint32_t statusBarDisplayCount = 0;
+  unsigned long lastStatusBarCheckMs = 0;
+  uint32_t lastStatusBarValues = 0;
+  // Hash of the clock and battery text as the status bar would show them now
+  uint32_t statusBarValues() const;
+  bool refreshStatusBarOnly();
   // Pages laid out per incremental-build pump: on the render path (catching up to the page
   // being shown) and per loop() tick (background build of a large chapter). Kept small so a
   // background build chunk never noticeably delays input or a pending render.
@@ -83,7 +83,8 @@ void EpubReaderChapterSelectionActivity::render(RenderLock&&) {
   const int contentHeight = screen.height - contentTop - metrics.verticalSpacing;
 
   const int totalItems = getTotalItems();
-  GUI.drawList(renderer, Rect{screen.x, contentTop, screen.width, contentHeight}, totalItems, selectorIndex,
+  const Rect listRect{screen.x, contentTop, screen.width, contentHeight};
+  GUI.drawList(renderer, listRect, totalItems, selectorIndex,
                [this](int index) {
                  auto item = epub->getTocItem(index);
                  std::string indent((item.level - 1) * 2, ' ');
@@ -93,5 +94,5 @@ void EpubReaderChapterSelectionActivity::render(RenderLock&&) {
   const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  listRefresh.display(renderer, listRect, totalItems, selectorIndex);
 }
@@ -4,12 +4,14 @@
 #include <memory>
 
 #include "activities/Activity.h"
+#include "components/ListSelectionRefresh.h"
 #include "util/ButtonNavigator.h"
 
 class EpubReaderChapterSelectionActivity final : public Activity {
   std::shared_ptr<Epub> epub;
   std::string epubPath;
   ButtonNavigator buttonNavigator;
+  ListSelectionRefresh listRefresh;
   int currentSpineIndex = 0;
   int selectorIndex = 0;
 
@@ -16,6 +16,7 @@ class EpubReaderMenuActivity final : public Activity {
     SELECT_CHAPTER,
     FOOTNOTES,
     GO_TO_PERCENT,
+    SEARCH,
     AUTO_PAGE_TURN,
     ROTATE_SCREEN,
     BOOKMARKS,
@@ -0,0 +1,188 @@
+#include "EpubReaderSearchActivity.h"
+
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include <cstdio>
+
+#include "MappedInputManager.h"
+#include "activities/util/KeyboardEntryActivity.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+// Scan time per loop() pass; input is polled between slices
+constexpr uint32_t SEARCH_SLICE_MS = 120;
+// Minimum time between redraws while hits keep arriving (e-ink refreshes are slow)
+constexpr unsigned long REFRESH_INTERVAL_MS = 2000;
+}  // namespace
+
+void EpubReaderSearchActivity::onEnter() {
+  Activity::onEnter();
+
+  if (!epub) {
+    return;
+  }
+  promptForQuery();
+}
+
+void EpubReaderSearchActivity::onExit() { Activity::onExit(); }
+
+void EpubReaderSearchActivity::promptForQuery() {
+  startActivityForResult(
+      std::make_unique<KeyboardEntryActivity>(renderer, mappedInput, tr(STR_SEARCH), query,
+                                              TextMatcher::MAX_PATTERN_BYTES),
+      [this](const ActivityResult& result) {
+        if (result.isCancelled) {
+          cancel();
+          return;
+        }
+        query = std::get<KeyboardResult>(result.data).text;
+        RenderLock lock(*this);
+        selectorIndex = 0;
+        shownHits = 0;
+        shownSpines = 0;
+        lastRefreshMs = millis();
+        searching = search.begin(query);
+        if (!searching) {
+          LOG_DBG("ERS", "Unusable search term");
+        }
+      });
+}
+
+void EpubReaderSearchActivity::cancel() {
+  ActivityResult result;
+  result.isCancelled = true;
+  setResult(std::move(result));
+  finish();
+}
+
+void EpubReaderSearchActivity::openHit(const int index) {
+  const auto& hit = search.getHits().at(index);
+  ProgressChangeResult result{};
+  result.spineIndex = hit.spineIndex;
+  if (hit.page >= 0) {
+    result.page = hit.page;
+    result.totalPages = hit.pageCount;
+  } else {
+    // Found in a chapter that isn't laid out yet: jump by position instead
+    result.percentage = epub->calculateProgress(hit.spineIndex, hit.spineProgress);
+    result.hasSavedProgress = true;
+  }
+  setResult(std::move(result));
+  finish();
+}
+
+void EpubReaderSearchActivity::loop() {
+  if (searching) {
+    size_t hitCount;
+    int spinesScanned;
+    {
+      RenderLock lock(*this);
+      searching = search.step(SEARCH_SLICE_MS);
+      hitCount = search.getHits().size();
+      spinesScanned = search.getSpinesScanned();
+    }
+    // First hit and end of scan show at once; progress in between is batched
+    const bool news = hitCount != shownHits || spinesScanned != shownSpines;
+    if (!searching || (shownHits == 0 && hitCount > 0) || (news && millis() - lastRefreshMs >= REFRESH_INTERVAL_MS)) {
+      shownHits = hitCount;
+      shownSpines = spinesScanned;
+      lastRefreshMs = millis();
+      requestUpdate();
+    }
+  }
+
+  const int hitCount = static_cast<int>(search.getHits().size());
+
+  if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+    if (hitCount > 0) {
+      openHit(selectorIndex);
+    } else if (!searching) {
+      promptForQuery();
+    }
+    return;
+  }
+  if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
+    if (searching) {
+      // Stop scanning but keep the hits found so far
+      searching = false;
+      requestUpdate();
+    } else {
+      cancel();
+    }
+    return;
+  }
+
+  const int pageItems = UITheme::getInstance().getNumberOfItemsPerPage(renderer, true, false, true, true);
+
+  buttonNavigator.onNextRelease([this, hitCount] {
+    selectorIndex = ButtonNavigator::nextIndex(selectorIndex, hitCount);
+    requestUpdate();
+  });
+
+  buttonNavigator.onPreviousRelease([this, hitCount] {
+    selectorIndex = ButtonNavigator::previousIndex(selectorIndex, hitCount);
+    requestUpdate();
+  });
+
+  buttonNavigator.onNextContinuous([this, hitCount, pageItems] {
+    selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, hitCount, pageItems);
+    requestUpdate();
+  });
+
+  buttonNavigator.onPreviousContinuous([this, hitCount, pageItems] {
+    selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, hitCount, pageItems);
+    requestUpdate();
+  });
+}
+
+void EpubReaderSearchActivity::render(RenderLock&&) {
+  renderer.clearScreen();
+
+  auto metrics = UITheme::getInstance().getMetrics();
+  Rect screen = UITheme::getInstance().getScreenSafeArea(renderer, true, false);
+  const auto& hits = search.getHits();
+  const int hitCount = static_cast<int>(hits.size());
+
+  char status[32];
+  if (searching) {
+    const int spineCount = epub->getSpineItemsCount();
+    snprintf(status, sizeof(status), "%s %d%%", tr(STR_SEARCHING),
+             spineCount > 0 ? search.getSpinesScanned() * 100 / spineCount : 0);
+  } else {
+    snprintf(status, sizeof(status), tr(STR_MATCHES_FORMAT), hitCount);
+  }
+  GUI.drawHeader(renderer, Rect{screen.x, screen.y + metrics.topPadding, screen.width, metrics.headerHeight},
+                 query.c_str(), status);
+
+  const int contentTop = screen.y + metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+  const int contentHeight = screen.height - contentTop - metrics.verticalSpacing;
+
+  if (hitCount == 0) {
+    if (!searching) {
+      renderer.drawCenteredText(UI_12_FONT_ID, contentTop + contentHeight / 2, tr(STR_NO_MATCHES), true,
+                                EpdFontFamily::BOLD);
+    }
+  } else {
+    GUI.drawList(
+        renderer, Rect{screen.x, contentTop, screen.width, contentHeight}, hitCount, selectorIndex,
+        [&hits](int index) { return hits[index].snippet; },
+        [this, &hits](int index) {
+          const auto& hit = hits[index];
+          const int tocIndex = epub->getTocIndexForSpineIndex(hit.spineIndex);
+          const std::string tocTitle = tocIndex >= 0 ? epub->getTocItem(tocIndex).title : tr(STR_UNNAMED);
+          if (hit.page >= 0) {
+            return std::to_string(hit.page + 1) + "/" + std::to_string(hit.pageCount) + " - " + tocTitle;
+          }
+          const float progress = epub->calculateProgress(hit.spineIndex, hit.spineProgress);
+          return std::to_string(static_cast<int>(progress * 100.0f + 0.5f)) + "% - " + tocTitle;
+        });
+  }
+
+  const char* confirmLabel = hitCount > 0 ? tr(STR_SELECT) : (searching ? "" : tr(STR_SEARCH));
+  const auto labels = mappedInput.mapLabels(tr(STR_BACK), confirmLabel, tr(STR_DIR_UP), tr(STR_DIR_DOWN));
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+
+  renderer.displayBuffer();
+}
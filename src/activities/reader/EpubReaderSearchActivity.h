@@ -0,0 +1,41 @@
+#pragma once
+#include <Epub.h>
+#include <Epub/search/BookTextSearch.h>
+
+#include <memory>
+#include <string>
+
+#include "activities/Activity.h"
+#include "util/ButtonNavigator.h"
+
+// Full-text search in the open book: asks for a term, then lists matching pages
+// as the book is scanned a slice per loop() so the first hits show right away.
+// Back stops a running scan (keeping the hits so far), or leaves the list.
+class EpubReaderSearchActivity final : public Activity {
+  std::shared_ptr<Epub> epub;
+  BookTextSearch search;
+  ButtonNavigator buttonNavigator;
+  std::string query;
+  int selectorIndex = 0;
+  bool searching = false;
+  // What the screen last showed, to refresh only when the scan has news
+  size_t shownHits = 0;
+  int shownSpines = 0;
+  unsigned long lastRefreshMs = 0;
+
+  void promptForQuery();
+  void openHit(int index);
+  void cancel();
+
+ public:
+  explicit EpubReaderSearchActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
+                                    const std::shared_ptr<Epub>& epub, BookTextSearch::SectionLoader sectionLoader)
+      : Activity("EpubReaderSearch", renderer, mappedInput),
+        epub(epub),
+        search(epub, renderer, std::move(sectionLoader)) {}
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+  bool skipLoopDelay() override { return searching; }
+};
@@ -22,6 +22,7 @@
 #include "activities/network/WifiSelectionActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
+#include "util/BookCacheUtils.h"
 
 namespace {
 void syncTimeWithNTP() {
@@ -117,7 +118,7 @@ void KOReaderSyncActivity::performSync() {
   if (KOREADER_STORE.getMatchMethod() == DocumentMatchMethod::FILENAME) {
     documentHash = KOReaderDocumentId::calculateFromFilename(epubPath);
   } else {
-    documentHash = KOReaderDocumentId::calculate(epubPath);
+    documentHash = KOReaderDocumentId::calculateCached(epubPath, getBookCachePath(epubPath));
   }
   if (documentHash.empty()) {
     {
@@ -430,7 +431,7 @@ void KOReaderSyncActivity::loop() {
         if (KOREADER_STORE.getMatchMethod() == DocumentMatchMethod::FILENAME) {
           documentHash = KOReaderDocumentId::calculateFromFilename(epubPath);
         } else {
-          documentHash = KOReaderDocumentId::calculate(epubPath);
+          documentHash = KOReaderDocumentId::calculateCached(epubPath, getBookCachePath(epubPath));
         }
       }
       performUpload();
@@ -2,13 +2,14 @@
 #include <I18n.h>
 
 #include <string>
+#include <utility>
 
 #include "activities/Activity.h"
 
 class QrDisplayActivity final : public Activity {
  public:
-  explicit QrDisplayActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, const std::string& textPayload)
-      : Activity("QrDisplay", renderer, mappedInput), textPayload(textPayload) {}
+  explicit QrDisplayActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::string textPayload)
+      : Activity("QrDisplay", renderer, mappedInput), textPayload(std::move(textPayload)) {}
 
   void onEnter() override;
   void onExit() override;
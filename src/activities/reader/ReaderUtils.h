@@ -59,13 +59,22 @@ inline PageTurnResult detectPageTurn(const MappedInputManager& input) {
   return {prev, next, tiltPrev || tiltNext};
 }
 
+// Page turn refresh. The cadence asks for a half refresh every N pages; the planner
+// may go cheaper when little changed (identical frame, a narrow band of rows) or
+// escalate early on ink-heavy pages. Every fast waveform, windowed or not, adds
+// ghosting, so both advance the cadence; only a skipped frame doesn't.
 inline void displayWithRefreshCycle(const GfxRenderer& renderer, int& pagesUntilFullRefresh) {
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+  const auto plan = renderer.displayPlanned(pagesUntilFullRefresh <= 1);
+  switch (plan.action) {
+    case RefreshPlanner::Action::Half:
+      pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+      break;
+    case RefreshPlanner::Action::Fast:
+    case RefreshPlanner::Action::Window:
+      pagesUntilFullRefresh--;
+      break;
+    case RefreshPlanner::Action::Skip:
+      break;
   }
 }
 
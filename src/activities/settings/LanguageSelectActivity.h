@@ -6,6 +6,7 @@
 #include <functional>
 
 #include "activities/Activity.h"
+#include "components/ListSelectionRefresh.h"
 #include "components/UITheme.h"
 #include "util/ButtonNavigator.h"
 
@@ -29,6 +30,7 @@ class LanguageSelectActivity final : public Activity {
 
   void onBack() { finish(); }
   ButtonNavigator buttonNavigator;
+  ListSelectionRefresh listRefresh;
   int selectedIndex = 0;
   constexpr static uint8_t totalItems = getLanguageCount();
 };
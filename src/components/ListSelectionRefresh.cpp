@@ -0,0 +1,34 @@
+#include "ListSelectionRefresh.h"
+
+#include <GfxRenderer.h>
+
+#include "UITheme.h"
+
+void ListSelectionRefresh::display(const GfxRenderer& renderer, const Rect listRect, const int itemCount,
+                                   const int selectedIndex, const bool hasSubtitle) {
+  int pageStart = -1;
+  const Rect row = selectedIndex >= 0 ? GUI.getListRowRect(renderer, listRect, selectedIndex, hasSubtitle, &pageStart)
+                                      : Rect{};
+
+  const bool sameList = lastItemCount == itemCount && lastHasSubtitle == hasSubtitle && lastRect.x == listRect.x &&
+                        lastRect.y == listRect.y && lastRect.width == listRect.width &&
+                        lastRect.height == listRect.height && lastDisplayCount == renderer.getDisplayCount();
+  const bool selectionMoved =
+      sameList && selectedIndex >= 0 && lastSelectedIndex >= 0 && selectedIndex != lastSelectedIndex;
+
+  if (selectionMoved && pageStart == lastPageStart) {
+    const Rect previousRow = GUI.getListRowRect(renderer, listRect, lastSelectedIndex, hasSubtitle, nullptr);
+    renderer.markDirty(previousRow.x, previousRow.y, previousRow.width, previousRow.height);
+    renderer.markDirty(row.x, row.y, row.width, row.height);
+    renderer.displayDirtyRegion();
+  } else {
+    renderer.displayBuffer();
+  }
+
+  lastRect = listRect;
+  lastItemCount = itemCount;
+  lastSelectedIndex = selectedIndex;
+  lastPageStart = pageStart;
+  lastHasSubtitle = hasSubtitle;
+  lastDisplayCount = renderer.getDisplayCount();
+}
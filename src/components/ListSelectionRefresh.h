@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include "themes/BaseTheme.h"
+
+class GfxRenderer;
+
+// Pushes a list screen to the panel. When the previous frame showed the same page
+// of the same list and only the selection moved, just the two affected rows go out
+// through a display window instead of the whole 48 KB frame.
+//
+// The caller still redraws the complete frame into the framebuffer first, so a
+// full refresh is always correct; the window is only an optimization. Call
+// invalidate() after changing anything besides the selection (item labels,
+// header, hints). Frames shown by anything else in between (popups, sub
+// activities) are noticed through GfxRenderer::getDisplayCount().
+class ListSelectionRefresh {
+  Rect lastRect;
+  int lastItemCount = -1;
+  int lastSelectedIndex = -1;
+  int lastPageStart = -1;
+  bool lastHasSubtitle = false;
+  uint32_t lastDisplayCount = 0;
+
+ public:
+  // Instead of renderer.displayBuffer() at the end of render(). Arguments match the drawList() call.
+  void display(const GfxRenderer& renderer, Rect listRect, int itemCount, int selectedIndex, bool hasSubtitle = false);
+  void invalidate() { lastItemCount = -1; }
+};
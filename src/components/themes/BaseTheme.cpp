@@ -255,6 +255,19 @@ int BaseTheme::getListPageItems(int contentHeight, bool hasSubtitle) const {
   return contentHeight / rowHeight;
 }
 
+Rect BaseTheme::getListRowRect(const GfxRenderer& renderer, Rect rect, int index, bool hasSubtitle,
+                               int* pageStartIndex) const {
+  (void)renderer;
+  const int rowHeight =
+      hasSubtitle ? BaseMetrics::values.listWithSubtitleRowHeight : BaseMetrics::values.listRowHeight;
+  const int pageItems = std::max(1, rect.height / rowHeight);
+  if (pageStartIndex) {
+    *pageStartIndex = index / pageItems * pageItems;
+  }
+  // The selection fill starts 2px above the row's text
+  return Rect{rect.x, rect.y + index % pageItems * rowHeight - 2, rect.width, rowHeight + 2};
+}
+
 void BaseTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount, int selectedIndex,
                          const std::function<std::string(int index)>& rowTitle,
                          const std::function<std::string(int index)>& rowSubtitle,
@@ -219,6 +219,11 @@ class BaseTheme {
                         const std::function<UIIcon(int index)>& rowIcon = nullptr,
                         const std::function<std::string(int index)>& rowValue = nullptr, bool highlightValue = false,
                         const std::function<bool(int index)>& rowDimmed = nullptr) const;
+  // Bounds of row `index` as drawList() lays it out, selection highlight included;
+  // pageStartIndex receives the first index on that row's page. Lets a list screen
+  // refresh only the rows whose selection state changed.
+  virtual Rect getListRowRect(const GfxRenderer& renderer, Rect rect, int index, bool hasSubtitle,
+                              int* pageStartIndex) const;
   virtual void drawHeader(const GfxRenderer& renderer, Rect rect, const char* title,
                           const char* subtitle = nullptr) const;
   virtual void drawSubHeader(const GfxRenderer& renderer, Rect rect, const char* label,
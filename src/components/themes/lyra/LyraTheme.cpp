@@ -6,6 +6,7 @@
 #include <HalStorage.h>
 #include <I18n.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -210,6 +211,18 @@ int LyraTheme::getListPageItems(int contentHeight, bool hasSubtitle) const {
   return contentHeight / rowHeight;
 }
 
+Rect LyraTheme::getListRowRect(const GfxRenderer& renderer, Rect rect, int index, bool hasSubtitle,
+                               int* pageStartIndex) const {
+  (void)renderer;
+  const int rowHeight =
+      hasSubtitle ? LyraMetrics::values.listWithSubtitleRowHeight : LyraMetrics::values.listRowHeight;
+  const int pageItems = std::max(1, rect.height / rowHeight);
+  if (pageStartIndex) {
+    *pageStartIndex = index / pageItems * pageItems;
+  }
+  return Rect{rect.x, rect.y + index % pageItems * rowHeight, rect.width, rowHeight};
+}
+
 void LyraTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount, int selectedIndex,
                          const std::function<std::string(int index)>& rowTitle,
                          const std::function<std::string(int index)>& rowSubtitle,
@@ -93,6 +93,8 @@ class LyraTheme : public BaseTheme {
   void drawTabBar(const GfxRenderer& renderer, Rect rect, const std::vector<TabInfo>& tabs,
                   bool selected) const override;
   int getListPageItems(int contentHeight, bool hasSubtitle) const override;
+  Rect getListRowRect(const GfxRenderer& renderer, Rect rect, int index, bool hasSubtitle,
+                      int* pageStartIndex) const override;
   void drawList(const GfxRenderer& renderer, Rect rect, int itemCount, int selectedIndex,
                 const std::function<std::string(int index)>& rowTitle,
                 const std::function<std::string(int index)>& rowSubtitle,
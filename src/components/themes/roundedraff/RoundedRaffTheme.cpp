@@ -23,6 +23,17 @@ constexpr int kSelectableRowGap = 6;
 constexpr int kTitleFontId = UI_12_FONT_ID;     // Requested main title size: 12px
 constexpr int kSubtitleFontId = SMALL_FONT_ID;  // Requested subtitle size: 8px
 constexpr int kGuideFontId = SMALL_FONT_ID;     // Closest available to requested 6px
+constexpr int kSubtitleTopPadding = 10;
+constexpr int kSubtitleBottomPadding = 10;
+constexpr int kSubtitleInterLineGap = 4;
+
+int listRowHeight(const GfxRenderer& renderer, const bool hasSubtitle) {
+  if (!hasSubtitle) {
+    return RoundedRaffMetrics::values.listRowHeight;
+  }
+  return kSubtitleTopPadding + renderer.getLineHeight(kTitleFontId) + kSubtitleInterLineGap +
+         renderer.getLineHeight(kSubtitleFontId) + kSubtitleBottomPadding;
+}
 
 void drawScrollBar(const GfxRenderer& renderer, Rect rect, int itemCount, int pageStartIndex, int pageItems) {
   if (itemCount <= 0 || pageItems <= 0 || itemCount <= pageItems) {
@@ -301,6 +312,18 @@ void RoundedRaffTheme::drawKeyboardKey(const GfxRenderer& renderer, Rect rect, c
   }
 }
 
+Rect RoundedRaffTheme::getListRowRect(const GfxRenderer& renderer, Rect rect, int index, bool hasSubtitle,
+                                      int* pageStartIndex) const {
+  const int rowHeight = listRowHeight(renderer, hasSubtitle);
+  const int rowStep = rowHeight + kSelectableRowGap;
+  const int pageItems = std::max(1, rect.height / rowStep);
+  if (pageStartIndex) {
+    *pageStartIndex = index / pageItems * pageItems;
+  }
+  const int sidePadding = RoundedRaffMetrics::values.contentSidePadding;
+  return Rect{rect.x + sidePadding, rect.y + index % pageItems * rowStep, rect.width - sidePadding * 2, rowHeight};
+}
+
 void RoundedRaffTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount, int selectedIndex,
                                 const std::function<std::string(int index)>& rowTitle,
                                 const std::function<std::string(int index)>& rowSubtitle,
@@ -312,13 +335,7 @@ void RoundedRaffTheme::drawList(const GfxRenderer& renderer, Rect rect, int item
   (void)rowDimmed;
   const bool hasSubtitle = static_cast<bool>(rowSubtitle);
   const int titleLineHeight = renderer.getLineHeight(kTitleFontId);
-  const int subtitleLineHeight = renderer.getLineHeight(kSubtitleFontId);
-  constexpr int subtitleTopPadding = 10;
-  constexpr int subtitleBottomPadding = 10;
-  constexpr int subtitleInterLineGap = 4;
-  const int subtitleRowHeight =
-      subtitleTopPadding + titleLineHeight + subtitleInterLineGap + subtitleLineHeight + subtitleBottomPadding;
-  const int rowHeight = hasSubtitle ? subtitleRowHeight : RoundedRaffMetrics::values.listRowHeight;
+  const int rowHeight = listRowHeight(renderer, hasSubtitle);
   const int rowStep = rowHeight + kSelectableRowGap;
   const int pageItems = std::max(1, rect.height / rowStep);
   const int pageStartIndex = std::max(0, selectedIndex / pageItems) * pageItems;
@@ -361,8 +378,8 @@ void RoundedRaffTheme::drawList(const GfxRenderer& renderer, Rect rect, int item
         renderer.drawText(kTitleFontId, rowX + kInteractiveInsetX, centeredTitleY, title.c_str(), !isSelected,
                           EpdFontFamily::BOLD);
       } else {
-        const int titleY = rowY + subtitleTopPadding;
-        const int subtitleY = titleY + titleLineHeight + subtitleInterLineGap;
+        const int titleY = rowY + kSubtitleTopPadding;
+        const int subtitleY = titleY + titleLineHeight + kSubtitleInterLineGap;
         auto subtitle =
             renderer.truncatedText(kSubtitleFontId, subtitleRaw.c_str(), textAreaWidth, EpdFontFamily::REGULAR);
         renderer.drawText(kTitleFontId, rowX + kInteractiveInsetX, titleY, title.c_str(), !isSelected,
@@ -32,6 +32,7 @@
 #include "fontIds.h"
 #include "images/LoadingIcon.h"
 #include "util/ButtonNavigator.h"
+#include "util/DirectoryListingCache.h"
 #include "util/ScreenshotUtil.h"
 
 GfxRenderer renderer(display);
@@ -343,6 +344,7 @@ void setup() {
   }
 
   HalSystem::checkPanic();
+  DIR_CACHE.begin();
 
   SETTINGS.loadFromFile();
   APP_STATE.loadFromFile();
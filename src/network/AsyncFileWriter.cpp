@@ -0,0 +1,182 @@
+#include "AsyncFileWriter.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <Memory.h>
+#include <esp_task_wdt.h>
+
+#include <cstring>
+
+namespace {
+constexpr uint32_t WRITER_STACK_SIZE = 4096;
+// Waits are sliced so a slow card can't trip the task watchdog of the caller.
+constexpr TickType_t WAIT_SLICE = pdMS_TO_TICKS(100);
+
+portMUX_TYPE statsSpinlock = portMUX_INITIALIZER_UNLOCKED;
+AsyncFileWriter::Stats stats;
+}  // namespace
+
+AsyncFileWriter::~AsyncFileWriter() { abort(); }
+
+bool AsyncFileWriter::begin(HalFile&& newFile) {
+  abort();
+  file = std::move(newFile);
+  failed = false;
+  discard = false;
+  current = -1;
+  fill = 0;
+  accepted = 0;
+
+  pool = makeUniqueNoThrow<uint8_t[]>(BUFFER_SIZE * BUFFER_COUNT);
+  freeQueue = xQueueCreate(BUFFER_COUNT, sizeof(uint8_t));
+  // One extra slot so the stop request always fits behind every buffer.
+  fullQueue = xQueueCreate(BUFFER_COUNT + 1, sizeof(Job));
+  done = xSemaphoreCreateBinary();
+  if (!pool || !freeQueue || !fullQueue || !done) {
+    LOG_ERR("AFW", "OOM: %u byte write-behind pool", (unsigned)(BUFFER_SIZE * BUFFER_COUNT));
+    releaseResources();
+    file.close();
+    return false;
+  }
+  for (uint8_t i = 0; i < BUFFER_COUNT; i++) {
+    xQueueSend(freeQueue, &i, 0);
+  }
+
+  // Same priority as the network loop: the writer runs whenever the receive
+  // path blocks on the socket, which is exactly the time we want to overlap.
+  if (xTaskCreate(&taskTrampoline, "AsyncFileWriter", WRITER_STACK_SIZE, this, uxTaskPriorityGet(nullptr), &task) !=
+      pdPASS) {
+    LOG_ERR("AFW", "Failed to create writer task");
+    task = nullptr;
+    releaseResources();
+    file.close();
+    return false;
+  }
+  startMs = millis();
+  return true;
+}
+
+void AsyncFileWriter::taskTrampoline(void* param) {
+  auto* self = static_cast<AsyncFileWriter*>(param);
+  self->taskLoop();
+  // `self` may be destroyed as soon as `done` is given; touch nothing after it.
+  vTaskDelete(nullptr);
+}
+
+void AsyncFileWriter::taskLoop() {
+  Job job{};
+  while (xQueueReceive(fullQueue, &job, portMAX_DELAY) == pdTRUE) {
+    if (job.length == 0) break;
+    if (!failed && !discard) {
+      const unsigned long writeStart = millis();
+      const size_t written = file.write(pool.get() + job.index * BUFFER_SIZE, job.length);
+      const uint32_t elapsed = millis() - writeStart;
+      if (written != job.length) {
+        LOG_ERR("AFW", "SD write failed: expected %u, wrote %u", (unsigned)job.length, (unsigned)written);
+        failed = true;
+      }
+      taskENTER_CRITICAL(&statsSpinlock);
+      stats.bytesWritten += written;
+      stats.sdWrites++;
+      stats.sdWriteMs += elapsed;
+      if (elapsed > stats.maxSdWriteMs) stats.maxSdWriteMs = elapsed;
+      taskEXIT_CRITICAL(&statsSpinlock);
+    }
+    xQueueSend(freeQueue, &job.index, 0);
+  }
+  xSemaphoreGive(done);
+}
+
+bool AsyncFileWriter::acquireBuffer() {
+  uint8_t index = 0;
+  const unsigned long waitStart = millis();
+  while (xQueueReceive(freeQueue, &index, WAIT_SLICE) != pdTRUE) {
+    esp_task_wdt_reset();
+  }
+  const uint32_t waited = millis() - waitStart;
+  if (waited > 0) {
+    taskENTER_CRITICAL(&statsSpinlock);
+    stats.stallMs += waited;
+    taskEXIT_CRITICAL(&statsSpinlock);
+  }
+  current = index;
+  fill = 0;
+  return !failed;
+}
+
+void AsyncFileWriter::submitCurrent() {
+  const Job job{static_cast<uint8_t>(current), static_cast<uint16_t>(fill)};
+  xQueueSend(fullQueue, &job, portMAX_DELAY);
+  current = -1;
+  fill = 0;
+}
+
+bool AsyncFileWriter::write(const uint8_t* data, size_t len) {
+  if (!task || failed) return false;
+  accepted += len;
+  while (len > 0) {
+    if (current < 0 && !acquireBuffer()) return false;
+    const size_t space = BUFFER_SIZE - fill;
+    const size_t chunk = len < space ? len : space;
+    memcpy(pool.get() + current * BUFFER_SIZE + fill, data, chunk);
+    fill += chunk;
+    data += chunk;
+    len -= chunk;
+    if (fill == BUFFER_SIZE) submitCurrent();
+  }
+  return true;
+}
+
+bool AsyncFileWriter::stop(const bool drain) {
+  if (!task) return false;
+
+  if (!drain) discard = true;
+  if (current >= 0) {
+    if (drain && fill > 0) {
+      submitCurrent();
+    } else {
+      const auto index = static_cast<uint8_t>(current);
+      xQueueSend(freeQueue, &index, 0);
+      current = -1;
+    }
+  }
+  const Job stopJob{0, 0};
+  xQueueSend(fullQueue, &stopJob, portMAX_DELAY);
+  while (xSemaphoreTake(done, WAIT_SLICE) != pdTRUE) {
+    esp_task_wdt_reset();
+  }
+  task = nullptr;
+
+  const bool ok = drain && !failed;
+  const unsigned long elapsed = millis() - startMs;
+  taskENTER_CRITICAL(&statsSpinlock);
+  stats.transfers++;
+  if (failed) stats.failedTransfers++;
+  if (ok && elapsed > 0) stats.lastKBps = static_cast<uint32_t>(accepted / elapsed);  // bytes/ms ~= KB/s
+  taskEXIT_CRITICAL(&statsSpinlock);
+
+  releaseResources();
+  file.close();
+  return ok;
+}
+
+bool AsyncFileWriter::finish() { return stop(true); }
+
+void AsyncFileWriter::abort() { stop(false); }
+
+void AsyncFileWriter::releaseResources() {
+  if (fullQueue) vQueueDelete(fullQueue);
+  if (freeQueue) vQueueDelete(freeQueue);
+  if (done) vSemaphoreDelete(done);
+  fullQueue = nullptr;
+  freeQueue = nullptr;
+  done = nullptr;
+  pool.reset();
+}
+
+AsyncFileWriter::Stats AsyncFileWriter::getStats() {
+  taskENTER_CRITICAL(&statsSpinlock);
+  const Stats copy = stats;
+  taskEXIT_CRITICAL(&statsSpinlock);
+  return copy;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * Write-behind file sink for network receive paths (web/WebSocket uploads,
+ * WebDAV PUT, HTTP downloads). Incoming data is copied into one of a small
+ * pool of buffers; full buffers are handed to a writer task that performs the
+ * SD write while the caller goes back to reading the socket, so SD latency no
+ * longer stalls TCP receive. The caller only blocks when every buffer is
+ * queued for writing.
+ *
+ * Buffers and the task exist only between begin() and finish()/abort(), so an
+ * idle writer costs no heap.
+ */
+class AsyncFileWriter {
+ public:
+  static constexpr size_t BUFFER_SIZE = 4096;
+  static constexpr uint8_t BUFFER_COUNT = 3;
+
+  // Cumulative counters across all writers since boot, for /api/status.
+  struct Stats {
+    uint32_t transfers = 0;        // finished (successfully or not) writers
+    uint32_t failedTransfers = 0;  // writers that hit an SD write error
+    uint64_t bytesWritten = 0;     // bytes committed to the card
+    uint32_t sdWrites = 0;         // buffer writes performed by the writer task
+    uint32_t sdWriteMs = 0;        // time spent inside those writes
+    uint32_t maxSdWriteMs = 0;     // slowest single write
+    uint32_t stallMs = 0;          // time callers waited for a free buffer
+    uint32_t lastKBps = 0;         // throughput of the most recent transfer
+  };
+
+  AsyncFileWriter() = default;
+  ~AsyncFileWriter();
+  AsyncFileWriter(const AsyncFileWriter&) = delete;
+  AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+  // Take ownership of an open file and start the writer task. Returns false
+  // (and closes the file) if the buffers or task can't be allocated.
+  bool begin(HalFile&& file);
+
+  // Queue data for writing. Returns false once any earlier SD write failed.
+  bool write(const uint8_t* data, size_t len);
+
+  // Write out everything queued and close the file. Returns true only if all
+  // accepted bytes reached the card.
+  bool finish();
+
+  // Drop queued data and close the file without waiting for the card.
+  void abort();
+
+  bool isActive() const { return task != nullptr; }
+  size_t bytesAccepted() const { return accepted; }
+
+  static Stats getStats();
+
+ private:
+  struct Job {
+    uint8_t index;
+    uint16_t length;  // 0 = stop request
+  };
+
+  static void taskTrampoline(void* param);
+  void taskLoop();
+  void submitCurrent();
+  bool acquireBuffer();
+  bool stop(bool drain);
+  void releaseResources();
+
+  HalFile file;
+  std::unique_ptr<uint8_t[]> pool;
+  QueueHandle_t freeQueue = nullptr;
+  QueueHandle_t fullQueue = nullptr;
+  SemaphoreHandle_t done = nullptr;  // given by the writer task when it exits
+  TaskHandle_t task = nullptr;
+
+  int current = -1;  // buffer being filled by the caller, -1 when none held
+  size_t fill = 0;
+  size_t accepted = 0;
+  unsigned long startMs = 0;
+  volatile bool failed = false;
+  volatile bool discard = false;
+};
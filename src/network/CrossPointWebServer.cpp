@@ -15,6 +15,7 @@
 
 #include "CrossPointSettings.h"
 #include "FontInstaller.h"
+#include "HttpFileSender.h"
 #include "OpdsServerStore.h"
 #include "SdCardFontSystem.h"
 #include "SettingsList.h"
@@ -26,6 +27,7 @@
 #include "html/SettingsPageHtml.generated.h"
 #include "html/js/jszip_minJs.generated.h"
 #include "util/BookCacheUtils.h"
+#include "util/DirectoryListingCache.h"
 
 namespace {
 // Folders/files to hide from the web interface file browser
@@ -38,7 +40,7 @@ constexpr uint16_t LOCAL_UDP_PORT = 8134;
 CrossPointWebServer* wsInstance = nullptr;
 
 // WebSocket upload state
-HalFile wsUploadFile;
+AsyncFileWriter wsUploadWriter;
 String wsUploadFileName;
 String wsUploadPath;
 size_t wsUploadSize = 0;
@@ -86,7 +88,7 @@ bool isProtectedItemName(const String& name) {
 // - HomePageHtml (from html/HomePage.html)
 // - FilesPageHeaderHtml (from html/FilesPageHeader.html)
 // - FilesPageFooterHtml (from html/FilesPageFooter.html)
-CrossPointWebServer::CrossPointWebServer() {}
+CrossPointWebServer::CrossPointWebServer(const GfxRenderer& renderer) : renderer(renderer) {}
 
 CrossPointWebServer::~CrossPointWebServer() { stop(); }
 
@@ -181,9 +183,10 @@ void CrossPointWebServer::begin() {
   server->onNotFound([this] { handleNotFound(); });
   LOG_DBG("WEB", "[MEM] Free heap after route setup: %d bytes", ESP.getFreeHeap());
 
-  // Collect WebDAV headers and register handler
-  const char* davHeaders[] = {"Depth", "Destination", "Overwrite", "If", "Lock-Token", "Timeout"};
-  server->collectHeaders(davHeaders, 6);
+  // Collect WebDAV and byte-range headers and register handler
+  const char* collectedHeaders[] = {"Depth",   "Destination", "Overwrite", "If",
+                                    "Lock-Token", "Timeout",  "Range",     "If-Range"};
+  server->collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
   server->addHandler(new WebDAVHandler());  // Note: WebDAVHandler will be deleted by WebServer when server is stopped
   LOG_DBG("WEB", "WebDAV handler initialized");
 
@@ -211,8 +214,8 @@ void CrossPointWebServer::begin() {
 }
 
 void CrossPointWebServer::abortWsUpload(const char* tag) {
-  // Explicit close() required: file-scope global persists beyond function scope
-  wsUploadFile.close();
+  // Explicit abort() required: file-scope global persists beyond function scope
+  wsUploadWriter.abort();
   String filePath = wsUploadPath;
   if (!filePath.endsWith("/")) filePath += "/";
   filePath += wsUploadFileName;
@@ -238,7 +241,7 @@ void CrossPointWebServer::stop() {
   LOG_DBG("WEB", "[MEM] Free heap before stop: %d bytes", ESP.getFreeHeap());
 
   // Close any in-progress WebSocket upload and remove partial file
-  if (wsUploadInProgress && wsUploadFile) {
+  if (wsUploadInProgress && wsUploadWriter.isActive()) {
     abortWsUpload("WEB");
   }
 
@@ -389,31 +392,37 @@ void CrossPointWebServer::handleStatus() const {
     doc["serial"] = "Not found";
   }
 
+  // Write-behind SD throughput for uploads/downloads since boot
+  const AsyncFileWriter::Stats writerStats = AsyncFileWriter::getStats();
+  JsonObject sdWriter = doc["sdWriter"].to<JsonObject>();
+  sdWriter["transfers"] = writerStats.transfers;
+  sdWriter["failedTransfers"] = writerStats.failedTransfers;
+  sdWriter["bytesWritten"] = writerStats.bytesWritten;
+  sdWriter["sdWrites"] = writerStats.sdWrites;
+  sdWriter["sdWriteMs"] = writerStats.sdWriteMs;
+  sdWriter["maxSdWriteMs"] = writerStats.maxSdWriteMs;
+  sdWriter["stallMs"] = writerStats.stallMs;
+  sdWriter["lastKBps"] = writerStats.lastKBps;
+
+  // What the refresh planner chose for the frames sent to the panel since boot
+  const RefreshPlanner::Stats refreshStats = renderer.getRefreshStats();
+  JsonObject displayRefresh = doc["displayRefresh"].to<JsonObject>();
+  displayRefresh["skipped"] = refreshStats.skipped;
+  displayRefresh["windowed"] = refreshStats.windowed;
+  displayRefresh["fast"] = refreshStats.fast;
+  displayRefresh["half"] = refreshStats.half;
+  displayRefresh["heavyInk"] = refreshStats.heavyInk;
+
   String response;
   serializeJson(doc, response);
   server->send(200, "application/json", response);
 }
 
 void CrossPointWebServer::scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const {
-  HalFile root = Storage.open(path);
-  if (!root) {
-    LOG_DBG("WEB", "Failed to open directory: %s", path);
-    return;
-  }
-
-  if (!root.isDirectory()) {
-    LOG_DBG("WEB", "Not a directory: %s", path);
-    root.close();
-    return;
-  }
-
-  LOG_DBG("WEB", "Scanning files in: %s", path);
+  LOG_DBG("WEB", "Listing: %s", path);
 
-  HalFile file = root.openNextFile();
-  char name[500];
-  while (file) {
-    file.getName(name, sizeof(name));
-    auto fileName = String(name);
+  const bool listed = DIR_CACHE.forEach(path, [this, &callback](const DirectoryListing::Entry& entry) {
+    auto fileName = String(entry.name);
 
     // Skip hidden items (starting with ".")
     bool shouldHide = !SETTINGS.showHiddenFiles && fileName.startsWith(".");
@@ -431,25 +440,25 @@ void CrossPointWebServer::scanFiles(const char* path, const std::function<void(F
     if (!shouldHide) {
       FileInfo info;
       info.name = fileName;
-      info.isDirectory = file.isDirectory();
+      info.isDirectory = entry.isDirectory;
 
       if (info.isDirectory) {
         info.size = 0;
         info.isEpub = false;
       } else {
-        info.size = file.size();
+        info.size = entry.size;
         info.isEpub = isEpubFile(info.name);
       }
 
       callback(info);
     }
 
-    file.close();
-    yield();               // Yield to allow WiFi and other tasks to process during long scans
+    yield();               // Yield to allow WiFi and other tasks to process during long listings
     esp_task_wdt_reset();  // Reset watchdog to prevent timeout on large directories
-    file = root.openNextFile();
+  });
+  if (!listed) {
+    LOG_DBG("WEB", "Failed to list directory: %s", path);
   }
-  root.close();
 }
 
 bool CrossPointWebServer::isEpubFile(const String& filename) const { return FsHelpers::hasEpubExtension(filename); }
@@ -562,57 +571,13 @@ void CrossPointWebServer::handleDownload() const {
     filename = nameBuf;
   }
 
-  server->setContentLength(file.size());
   server->sendHeader("Content-Disposition", "attachment; filename=\"" + filename + "\"");
-  server->send(200, contentType.c_str(), "");
-
-  NetworkClient client = server->client();
-  const size_t chunkSize = 4096;
-  uint8_t buffer[chunkSize];
-
-  bool downloadOk = true;
-  while (downloadOk && file.available()) {
-    int result = file.read(buffer, chunkSize);
-    if (result <= 0) break;
-    size_t bytesRead = static_cast<size_t>(result);
-    size_t totalWritten = 0;
-    while (totalWritten < bytesRead) {
-      esp_task_wdt_reset();
-      size_t wrote = client.write(buffer + totalWritten, bytesRead - totalWritten);
-      if (wrote == 0) {
-        downloadOk = false;
-        break;
-      }
-      totalWritten += wrote;
-    }
-  }
-  client.clear();
+  HttpFileSender::send(*server, file, contentType);
   file.close();
 }
 
 // Diagnostic counters for upload performance analysis
 static unsigned long uploadStartTime = 0;
-static unsigned long totalWriteTime = 0;
-static size_t writeCount = 0;
-
-static bool flushUploadBuffer(CrossPointWebServer::UploadState& state) {
-  if (state.bufferPos > 0 && state.file) {
-    esp_task_wdt_reset();  // Reset watchdog before potentially slow SD write
-    const unsigned long writeStart = millis();
-    const size_t written = state.file.write(state.buffer.data(), state.bufferPos);
-    totalWriteTime += millis() - writeStart;
-    writeCount++;
-    esp_task_wdt_reset();  // Reset watchdog after SD write
-
-    if (written != state.bufferPos) {
-      LOG_DBG("WEB", "[UPLOAD] Buffer flush failed: expected %d, wrote %d", state.bufferPos, written);
-      state.bufferPos = 0;
-      return false;
-    }
-    state.bufferPos = 0;
-  }
-  return true;
-}
 
 void CrossPointWebServer::handleUpload(UploadState& state) const {
   static size_t lastLoggedSize = 0;
@@ -638,9 +603,6 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
     state.error = "";
     uploadStartTime = millis();
     lastLoggedSize = 0;
-    state.bufferPos = 0;
-    totalWriteTime = 0;
-    writeCount = 0;
 
     // Get upload path from query parameter (defaults to root if not specified)
     // Note: We use query parameter instead of form data because multipart form
@@ -677,38 +639,28 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
 
     // Open file for writing - this can be slow due to FAT cluster allocation
     esp_task_wdt_reset();
-    if (!Storage.openFileForWrite("WEB", filePath, state.file)) {
+    HalFile file;
+    if (!Storage.openFileForWrite("WEB", filePath, file)) {
       state.error = "Failed to create file on SD card";
       LOG_DBG("WEB", "[UPLOAD] FAILED to create file: %s", filePath.c_str());
       return;
     }
     esp_task_wdt_reset();
+    if (!state.writer.begin(std::move(file))) {
+      state.error = "Not enough memory for upload buffers";
+      Storage.remove(filePath.c_str());
+      return;
+    }
 
     LOG_DBG("WEB", "[UPLOAD] File created successfully: %s", filePath.c_str());
   } else if (upload.status == UPLOAD_FILE_WRITE) {
-    if (state.file && state.error.isEmpty()) {
-      // Buffer incoming data and flush when buffer is full
-      // This reduces SD card write operations and improves throughput
-      const uint8_t* data = upload.buf;
-      size_t remaining = upload.currentSize;
-
-      while (remaining > 0) {
-        const size_t space = UploadState::UPLOAD_BUFFER_SIZE - state.bufferPos;
-        const size_t toCopy = (remaining < space) ? remaining : space;
-
-        memcpy(state.buffer.data() + state.bufferPos, data, toCopy);
-        state.bufferPos += toCopy;
-        data += toCopy;
-        remaining -= toCopy;
-
-        // Flush buffer when full
-        if (state.bufferPos >= UploadState::UPLOAD_BUFFER_SIZE) {
-          if (!flushUploadBuffer(state)) {
-            state.error = "Failed to write to SD card - disk may be full";
-            state.file.close();
-            return;
-          }
-        }
+    if (state.writer.isActive() && state.error.isEmpty()) {
+      // Hand the chunk to the write-behind sink; the SD write happens on the
+      // writer task while we return to receiving the next chunk
+      if (!state.writer.write(upload.buf, upload.currentSize)) {
+        state.error = "Failed to write to SD card - disk may be full";
+        state.writer.abort();
+        return;
       }
 
       state.size += upload.currentSize;
@@ -717,28 +669,27 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
       if (state.size - lastLoggedSize >= 102400) {
         const unsigned long elapsed = millis() - uploadStartTime;
         const float kbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
-        LOG_DBG("WEB", "[UPLOAD] %d bytes (%.1f KB), %.1f KB/s, %d writes", state.size, state.size / 1024.0, kbps,
-                writeCount);
+        LOG_DBG("WEB", "[UPLOAD] %d bytes (%.1f KB), %.1f KB/s", state.size, state.size / 1024.0, kbps);
         lastLoggedSize = state.size;
       }
     }
   } else if (upload.status == UPLOAD_FILE_END) {
-    if (state.file) {
-      // Flush any remaining buffered data
-      if (!flushUploadBuffer(state)) {
+    if (state.writer.isActive()) {
+      // Wait for the writer to drain the remaining buffers and close the file
+      if (!state.writer.finish()) {
         state.error = "Failed to write final data to SD card";
       }
-      state.file.close();
 
       if (state.error.isEmpty()) {
         state.success = true;
         const unsigned long elapsed = millis() - uploadStartTime;
         const float avgKbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
-        const float writePercent = (elapsed > 0) ? (totalWriteTime * 100.0 / elapsed) : 0;
+        const AsyncFileWriter::Stats writerStats = AsyncFileWriter::getStats();
         LOG_DBG("WEB", "[UPLOAD] Complete: %s (%d bytes in %lu ms, avg %.1f KB/s)", state.fileName.c_str(), state.size,
                 elapsed, avgKbps);
-        LOG_DBG("WEB", "[UPLOAD] Diagnostics: %d writes, total write time: %lu ms (%.1f%%)", writeCount, totalWriteTime,
-                writePercent);
+        LOG_DBG("WEB", "[UPLOAD] Diagnostics: %lu SD writes total, %lu ms writing, %lu ms stalled",
+                (unsigned long)writerStats.sdWrites, (unsigned long)writerStats.sdWriteMs,
+                (unsigned long)writerStats.stallMs);
 
         // Clear epub cache to prevent stale metadata issues when overwriting files
         String filePath = state.path;
@@ -748,9 +699,8 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
-    state.bufferPos = 0;  // Discard buffered data
-    if (state.file) {
-      state.file.close();
+    if (state.writer.isActive()) {
+      state.writer.abort();  // Discard buffered data
       // Try to delete the incomplete file
       String filePath = state.path;
       if (!filePath.endsWith("/")) filePath += "/";
@@ -1562,7 +1512,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
       // Only clean up if this is the client that owns the active upload.
       // A new client may have already started a fresh upload before this
       // DISCONNECTED event fires (race condition on quick cancel + retry).
-      if (num == wsUploadClientNum && wsUploadInProgress && wsUploadFile) {
+      if (num == wsUploadClientNum && wsUploadInProgress && wsUploadWriter.isActive()) {
         abortWsUpload("WS");
       }
       break;
@@ -1579,7 +1529,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
 
       if (msg.startsWith("START:")) {
         // Reject any START while an upload is already active to prevent
-        // leaking the open wsUploadFile handle (owning client re-START included)
+        // leaking the active wsUploadWriter (owning client re-START included)
         if (wsUploadInProgress) {
           wsServer->sendTXT(num, "ERROR:Upload already in progress");
           break;
@@ -1631,7 +1581,8 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
 
           // Open file for writing
           esp_task_wdt_reset();
-          if (!Storage.openFileForWrite("WS", filePath, wsUploadFile)) {
+          HalFile file;
+          if (!Storage.openFileForWrite("WS", filePath, file)) {
             wsServer->sendTXT(num, "ERROR:Failed to create file");
             wsUploadInProgress = false;
             wsUploadClientNum = 255;
@@ -1641,8 +1592,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
 
           // Zero-byte upload: complete immediately without waiting for BIN frames
           if (wsUploadSize == 0) {
-            // Explicit close() required: file-scope global persists beyond function scope
-            wsUploadFile.close();
+            file.close();
             wsLastCompleteName = wsUploadFileName;
             wsLastCompleteSize = 0;
             wsLastCompleteAt = millis();
@@ -1653,6 +1603,12 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
             break;
           }
 
+          if (!wsUploadWriter.begin(std::move(file))) {
+            Storage.remove(filePath.c_str());
+            wsServer->sendTXT(num, "ERROR:Out of memory");
+            return;
+          }
+
           wsUploadClientNum = num;
           wsUploadInProgress = true;
           wsServer->sendTXT(num, "READY");
@@ -1664,12 +1620,12 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
     }
 
     case WStype_BIN: {
-      if (!wsUploadInProgress || !wsUploadFile || num != wsUploadClientNum) {
+      if (!wsUploadInProgress || !wsUploadWriter.isActive() || num != wsUploadClientNum) {
         wsServer->sendTXT(num, "ERROR:No upload in progress");
         return;
       }
 
-      // Write binary data directly to file
+      // Queue binary data on the write-behind sink
       size_t remaining = wsUploadSize - wsUploadReceived;
       if (length > remaining) {
         abortWsUpload("WS");
@@ -1677,16 +1633,13 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         return;
       }
       esp_task_wdt_reset();
-      size_t written = wsUploadFile.write(payload, length);
-      esp_task_wdt_reset();
-
-      if (written != length) {
+      if (!wsUploadWriter.write(payload, length)) {
         abortWsUpload("WS");
         wsServer->sendTXT(num, "ERROR:Write failed - disk full?");
         return;
       }
 
-      wsUploadReceived += written;
+      wsUploadReceived += length;
 
       // Send progress update (every 64KB or at end)
       if (wsUploadReceived - wsLastProgressSent >= 65536 || wsUploadReceived >= wsUploadSize) {
@@ -1697,8 +1650,12 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
 
       // Check if upload complete
       if (wsUploadReceived >= wsUploadSize) {
-        // Explicit close() required: file-scope global persists beyond function scope
-        wsUploadFile.close();
+        // Drain the remaining buffers before reporting success
+        if (!wsUploadWriter.finish()) {
+          abortWsUpload("WS");
+          wsServer->sendTXT(num, "ERROR:Write failed - disk full?");
+          return;
+        }
         wsUploadInProgress = false;
         wsUploadClientNum = 255;
 
@@ -1784,13 +1741,11 @@ void CrossPointWebServer::handleFontUploadData() {
     case UPLOAD_FILE_START: {
       esp_task_wdt_reset();
       String family = server->arg("family");
-      fontUpload.file = HalFile();
+      fontUpload.writer.abort();
       fontUpload.familyName.clear();
       fontUpload.filePath.clear();
       fontUpload.valid = false;
       fontUpload.magicChecked = false;
-      fontUpload.bytesWritten = 0;
-      fontUpload.bufferPos = 0;
 
       if (!FontInstaller::isValidFamilyName(family.c_str())) {
         LOG_ERR("WEB", "Invalid font family name: %s", family.c_str());
@@ -1821,10 +1776,15 @@ void CrossPointWebServer::handleFontUploadData() {
       FontInstaller::buildFontPath(family.c_str(), filename.c_str(), path, sizeof(path));
       fontUpload.filePath = path;
 
-      if (!Storage.openFileForWrite("WEB", path, fontUpload.file)) {
+      HalFile file;
+      if (!Storage.openFileForWrite("WEB", path, file)) {
         LOG_ERR("WEB", "Failed to open font file for write: %s", path);
         break;
       }
+      if (!fontUpload.writer.begin(std::move(file))) {
+        Storage.remove(path);
+        break;
+      }
 
       fontUpload.valid = true;
       LOG_DBG("WEB", "Font upload started: %s -> %s", filename.c_str(), path);
@@ -1845,50 +1805,33 @@ void CrossPointWebServer::handleFontUploadData() {
         fontUpload.magicChecked = true;
       }
 
-      // Buffer writes for efficiency
-      size_t remaining = upload.currentSize;
-      const uint8_t* src = upload.buf;
-      while (remaining > 0) {
-        size_t space = FontUploadState::BUFFER_SIZE - fontUpload.bufferPos;
-        size_t chunk = (remaining < space) ? remaining : space;
-        memcpy(fontUpload.buffer.data() + fontUpload.bufferPos, src, chunk);
-        fontUpload.bufferPos += chunk;
-        src += chunk;
-        remaining -= chunk;
-
-        if (fontUpload.bufferPos >= FontUploadState::BUFFER_SIZE) {
-          fontUpload.file.write(fontUpload.buffer.data(), fontUpload.bufferPos);
-          fontUpload.bytesWritten += fontUpload.bufferPos;
-          fontUpload.bufferPos = 0;
-          esp_task_wdt_reset();
-        }
+      if (!fontUpload.writer.write(upload.buf, upload.currentSize)) {
+        LOG_ERR("WEB", "Font upload write failed");
+        fontUpload.valid = false;
       }
       break;
     }
 
     case UPLOAD_FILE_END: {
-      // Flush remaining buffer
-      if (fontUpload.valid && fontUpload.bufferPos > 0) {
-        fontUpload.file.write(fontUpload.buffer.data(), fontUpload.bufferPos);
-        fontUpload.bytesWritten += fontUpload.bufferPos;
-        fontUpload.bufferPos = 0;
-      }
-      if (fontUpload.file.isOpen()) {
-        fontUpload.file.close();
+      // Drain the write-behind buffers; a failed SD write invalidates the font
+      if (fontUpload.writer.isActive()) {
+        const size_t bytesWritten = fontUpload.writer.bytesAccepted();
+        if (!fontUpload.valid) {
+          fontUpload.writer.abort();
+        } else if (!fontUpload.writer.finish()) {
+          fontUpload.valid = false;
+        }
+        LOG_DBG("WEB", "Font upload end: valid=%d, %zu bytes", fontUpload.valid, bytesWritten);
       }
 
       if (!fontUpload.valid && !fontUpload.filePath.empty()) {
         Storage.remove(fontUpload.filePath.c_str());
       }
-
-      LOG_DBG("WEB", "Font upload end: valid=%d, %zu bytes", fontUpload.valid, fontUpload.bytesWritten);
       break;
     }
 
     case UPLOAD_FILE_ABORTED: {
-      if (fontUpload.file) {
-        fontUpload.file.close();
-      }
+      fontUpload.writer.abort();
       if (!fontUpload.filePath.empty()) {
         Storage.remove(fontUpload.filePath.c_str());
       }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <NetworkUdp.h>
 #include <WebServer.h>
@@ -9,6 +10,8 @@
 #include <string>
 #include <vector>
 
+#include "AsyncFileWriter.h"
+
 // Structure to hold file information
 struct FileInfo {
   String name;
@@ -31,24 +34,18 @@ class CrossPointWebServer {
 
   // Used by POST upload handler
   struct UploadState {
-    HalFile file;
     String fileName;
     String path = "/";
     size_t size = 0;
     bool success = false;
     String error = "";
 
-    // Upload write buffer - batches small writes into larger SD card operations
-    // 4KB is a good balance: large enough to reduce syscall overhead, small enough
-    // to keep individual write times short and avoid watchdog issues
-    static constexpr size_t UPLOAD_BUFFER_SIZE = 4096;  // 4KB buffer
-    std::vector<uint8_t> buffer;
-    size_t bufferPos = 0;
-
-    UploadState() { buffer.resize(UPLOAD_BUFFER_SIZE); }
+    // Write-behind sink: SD writes overlap with receiving the next chunk
+    AsyncFileWriter writer;
   } upload;
 
-  CrossPointWebServer();
+  // renderer: read for the display refresh counters in /api/status
+  explicit CrossPointWebServer(const GfxRenderer& renderer);
   ~CrossPointWebServer();
 
   // Start the web server (call after WiFi is connected)
@@ -69,6 +66,7 @@ class CrossPointWebServer {
   uint16_t getPort() const { return port; }
 
  private:
+  const GfxRenderer& renderer;
   std::unique_ptr<WebServer> server = nullptr;
   std::unique_ptr<WebSocketsServer> wsServer = nullptr;
   bool running = false;
@@ -117,17 +115,11 @@ class CrossPointWebServer {
 
   // Font upload state
   struct FontUploadState {
-    HalFile file;
+    AsyncFileWriter writer;
     std::string familyName;
     std::string filePath;
     bool valid = false;
     bool magicChecked = false;
-    size_t bytesWritten = 0;
-    static constexpr size_t BUFFER_SIZE = 4096;
-    std::vector<uint8_t> buffer;
-    size_t bufferPos = 0;
-
-    FontUploadState() { buffer.resize(BUFFER_SIZE); }
   } fontUpload;
 
   // OPDS server handlers
@@ -1,8 +1,10 @@
 #include "HttpDownloader.h"
 
 #include <Arduino.h>
+#include <HttpRange.h>
 #include <Logging.h>
 #include <Memory.h>
+#include <Serialization.h>
 #include <base64.h>
 #include <esp_crt_bundle.h>
 #include <esp_http_client.h>
@@ -11,6 +13,8 @@
 #include <functional>
 #include <string>
 
+#include "AsyncFileWriter.h"
+
 namespace {
 // RX holds the response headers. 4096 fits real OPDS servers; GitHub's release
 // CDN sends more and logs HTTP_HEADER "Buffer length is small", but that's
@@ -25,15 +29,49 @@ constexpr int HTTP_TX_BUF = 1024;
 // HTTPClient's uint16 setTimeout it doesn't silently truncate.
 constexpr int HTTP_TIMEOUT_MS = 60000;
 constexpr size_t READ_CHUNK = 2048;
+// A dropped connection mid-download is retried with a Range request for the
+// missing tail this many times before the download fails.
+constexpr int MAX_RESUME_ATTEMPTS = 3;
+constexpr int RESUME_RETRY_DELAY_MS = 1000;
+// Validator sidecar kept next to an interrupted download (<dest>.part).
+constexpr const char* PART_SUFFIX = ".part";
+constexpr const char* PART_META_SUFFIX = ".part.meta";
+constexpr size_t VALIDATOR_MAX = 128;
 
 struct Sink {
   std::function<bool(const uint8_t*, size_t)> write;  // returns false to abort the transfer
+  // Called when the server ignored our Range and sent the full body; the sink
+  // must discard what it has and accept data from offset 0.
+  std::function<bool()> restart;
   HttpDownloader::ProgressCallback progress;
   bool* cancelFlag = nullptr;
   size_t total = 0;
   size_t downloaded = 0;
+  // Resume request: ask for bytes from resumeFrom onwards, conditional on the
+  // entity still matching `validator` (ETag) when known.
+  size_t resumeFrom = 0;
+  std::string validator;
+  // Set when the server answered a resume request with a range we can't
+  // append (416 or a mismatched Content-Range); the caller starts over.
+  bool rangeRejected = false;
+  // Response headers captured by the event handler.
+  std::string etag;
+  std::string contentRange;
 };
 
+// esp_http_client only exposes response headers through its event callback.
+esp_err_t onHttpEvent(esp_http_client_event_t* evt) {
+  if (evt->event_id != HTTP_EVENT_ON_HEADER || !evt->user_data) return ESP_OK;
+  auto* sink = static_cast<Sink*>(evt->user_data);
+  if (strcasecmp(evt->header_key, "ETag") == 0) {
+    // Only strong validators are usable for If-Range.
+    if (evt->header_value[0] == '"' && strlen(evt->header_value) < VALIDATOR_MAX) sink->etag = evt->header_value;
+  } else if (strcasecmp(evt->header_key, "Content-Range") == 0) {
+    sink->contentRange = evt->header_value;
+  }
+  return ESP_OK;
+}
+
 bool isRedirect(int status) {
   return status == 301 || status == 302 || status == 303 || status == 307 || status == 308;
 }
@@ -58,6 +96,8 @@ HttpDownloader::DownloadError runGet(const std::string& url, const std::string&
   // only because Arduino's ssl_client drives mbedtls directly.
   config.crt_bundle_attach = esp_crt_bundle_attach;
   config.keep_alive_enable = true;
+  config.event_handler = onHttpEvent;
+  config.user_data = &sink;
 
   esp_http_client_handle_t client = esp_http_client_init(&config);
   if (!client) {
@@ -72,6 +112,12 @@ HttpDownloader::DownloadError runGet(const std::string& url, const std::string&
     const String header = "Basic " + base64::encode(credentials.c_str());
     esp_http_client_set_header(client, "Authorization", header.c_str());
   }
+  char rangeHeader[32];
+  if (sink.resumeFrom > 0) {
+    snprintf(rangeHeader, sizeof(rangeHeader), "bytes=%zu-", sink.resumeFrom);
+    esp_http_client_set_header(client, "Range", rangeHeader);
+    if (!sink.validator.empty()) esp_http_client_set_header(client, "If-Range", sink.validator.c_str());
+  }
 
   // open()/read() does not auto-follow redirects (only perform() does), so step
   // 30x responses manually. OPDS download endpoints and the GitHub release CDN
@@ -86,6 +132,8 @@ HttpDownloader::DownloadError runGet(const std::string& url, const std::string&
   int status = esp_http_client_get_status_code(client);
   for (int hop = 0; isRedirect(status) && hop < 5; ++hop) {
     if (esp_http_client_set_redirection(client) != ESP_OK) break;
+    sink.etag.clear();
+    sink.contentRange.clear();
     err = esp_http_client_open(client, 0);
     if (err != ESP_OK) {
       LOG_ERR("HTTP", "redirect open failed: %s", esp_err_to_name(err));
@@ -96,16 +144,42 @@ HttpDownloader::DownloadError runGet(const std::string& url, const std::string&
     status = esp_http_client_get_status_code(client);
   }
 
-  if (status != 200) {
-    LOG_ERR("HTTP", "unexpected status: %d", status);
-    esp_http_client_cleanup(client);
-    return HttpDownloader::HTTP_ERROR;
+  size_t total = 0;
+  switch (HttpRange::classifyResumeResponse(sink.resumeFrom, status, sink.contentRange.c_str(), total)) {
+    case HttpRange::ResumeResponse::APPEND:
+      LOG_DBG("HTTP", "Resuming at %zu of %zu bytes", sink.resumeFrom, total);
+      sink.total = total;
+      sink.downloaded = sink.resumeFrom;
+      if (sink.validator.empty()) sink.validator = sink.etag;
+      break;
+    case HttpRange::ResumeResponse::FULL_BODY:
+      if (sink.resumeFrom > 0) {
+        // Range ignored or If-Range failed (the file changed): start over.
+        LOG_DBG("HTTP", "Server sent full body, restarting download");
+        if (!sink.restart || !sink.restart()) {
+          esp_http_client_cleanup(client);
+          return HttpDownloader::FILE_ERROR;
+        }
+        sink.resumeFrom = 0;
+      }
+      // fetch_headers returns 0 for a chunked response (no Content-Length); leave
+      // total at 0 so progress stays silent and the size check is skipped.
+      sink.total = contentLength > 0 ? static_cast<size_t>(contentLength) : 0;
+      sink.downloaded = 0;
+      sink.validator = sink.etag;
+      break;
+    case HttpRange::ResumeResponse::RANGE_REJECTED:
+      LOG_ERR("HTTP", "range rejected at %zu (status %d, Content-Range: %s)", sink.resumeFrom, status,
+              sink.contentRange.c_str());
+      esp_http_client_cleanup(client);
+      sink.rangeRejected = true;
+      return HttpDownloader::HTTP_ERROR;
+    case HttpRange::ResumeResponse::UNEXPECTED:
+      LOG_ERR("HTTP", "unexpected status: %d", status);
+      esp_http_client_cleanup(client);
+      return HttpDownloader::HTTP_ERROR;
   }
 
-  // fetch_headers returns 0 for a chunked response (no Content-Length); leave
-  // total at 0 so progress stays silent and the size check is skipped.
-  sink.total = contentLength > 0 ? static_cast<size_t>(contentLength) : 0;
-
   auto buf = makeUniqueNoThrow<char[]>(READ_CHUNK);
   if (!buf) {
     LOG_ERR("HTTP", "OOM: %u byte read buffer", (unsigned)READ_CHUNK);
@@ -141,6 +215,35 @@ HttpDownloader::DownloadError runGet(const std::string& url, const std::string&
   }
   return HttpDownloader::OK;
 }
+
+// Returns the size of a resumable <dest>.part left by an earlier attempt at the
+// same URL, filling in its ETag; 0 when there is nothing usable to resume.
+size_t loadPartialState(const std::string& url, const std::string& partPath, const std::string& metaPath,
+                        std::string& validator) {
+  if (!Storage.exists(partPath.c_str()) || !Storage.exists(metaPath.c_str())) return 0;
+  HalFile meta;
+  if (!Storage.openFileForRead("HTTP", metaPath, meta)) return 0;
+  std::string savedUrl;
+  serialization::readString(meta, savedUrl);
+  serialization::readString(meta, validator);
+  meta.close();
+  if (savedUrl != url || validator.empty() || validator.size() >= VALIDATOR_MAX) {
+    validator.clear();
+    return 0;
+  }
+  HalFile part = Storage.open(partPath.c_str());
+  const size_t size = part ? part.size() : 0;
+  part.close();
+  return size;
+}
+
+void savePartialState(const std::string& url, const std::string& metaPath, const std::string& validator) {
+  HalFile meta;
+  if (!Storage.openFileForWrite("HTTP", metaPath, meta)) return;
+  serialization::writeString(meta, url);
+  serialization::writeString(meta, validator);
+  meta.close();
+}
 }  // namespace
 
 bool HttpDownloader::fetchUrl(const std::string& url, Stream& outContent, const std::string& username,
@@ -176,34 +279,95 @@ HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string&
                                                              const std::string& username, const std::string& password) {
   LOG_DBG("HTTP", "Downloading: %s -> %s", url.c_str(), destPath.c_str());
 
-  if (Storage.exists(destPath.c_str())) {
-    Storage.remove(destPath.c_str());
-  }
+  // Data lands in <dest>.part and is renamed into place only when complete, so
+  // a dropped transfer neither destroys an existing file nor loses its progress.
+  const std::string partPath = destPath + PART_SUFFIX;
+  const std::string metaPath = destPath + PART_META_SUFFIX;
+
+  Sink sink;
+  sink.progress = std::move(progress);
+  sink.cancelFlag = cancelFlag;
+  sink.downloaded = loadPartialState(url, partPath, metaPath, sink.validator);
+
   HalFile file;
-  if (!Storage.openFileForWrite("HTTP", destPath.c_str(), file)) {
+  if (sink.downloaded > 0) {
+    LOG_DBG("HTTP", "Found %zu bytes of an earlier attempt", sink.downloaded);
+    file = Storage.open(partPath.c_str(), O_WRONLY | O_APPEND);
+  } else {
+    Storage.remove(partPath.c_str());
+    Storage.openFileForWrite("HTTP", partPath, file);
+  }
+  // SD writes go through a write-behind task so a slow card doesn't stall
+  // the socket between reads.
+  AsyncFileWriter writer;
+  if (!file || !writer.begin(std::move(file))) {
     LOG_ERR("HTTP", "Failed to open file for writing");
     return FILE_ERROR;
   }
 
-  Sink sink;
-  sink.progress = std::move(progress);
-  sink.cancelFlag = cancelFlag;
-  sink.write = [&file](const uint8_t* data, size_t len) { return file.write(data, len) == len; };
+  sink.write = [&writer](const uint8_t* data, size_t len) { return writer.write(data, len); };
+  sink.restart = [&writer, &partPath]() {
+    writer.abort();
+    Storage.remove(partPath.c_str());
+    HalFile fresh;
+    return Storage.openFileForWrite("HTTP", partPath, fresh) && writer.begin(std::move(fresh));
+  };
 
-  const DownloadError result = runGet(url, username, password, sink);
-  // Close before any remove() on the same path; DESTRUCTOR_CLOSES_FILE would
-  // otherwise close only after the remove.
-  file.close();
+  DownloadError result = HTTP_ERROR;
+  for (int attempt = 0;; ++attempt) {
+    sink.resumeFrom = sink.downloaded;
+    sink.rangeRejected = false;
+    result = runGet(url, username, password, sink);
+    if (result != HTTP_ERROR || attempt >= MAX_RESUME_ATTEMPTS) break;
+    if (sink.rangeRejected) {
+      // Our partial data doesn't line up with what the server has: start over.
+      if (!sink.restart()) {
+        result = FILE_ERROR;
+        break;
+      }
+      sink.downloaded = 0;
+      sink.validator.clear();
+      continue;
+    }
+    if (sink.downloaded == 0) break;  // failed before any body arrived; nothing to resume
+    LOG_DBG("HTTP", "Transfer dropped at %zu bytes, resuming", sink.downloaded);
+    delay(RESUME_RETRY_DELAY_MS);
+  }
+  // Drain and close before any remove()/rename() on the same path. A failed
+  // drain means the .part on the card is shorter than `downloaded`.
+  if (result == ABORTED) {
+    writer.abort();
+  } else if (!writer.finish() && result != FILE_ERROR) {
+    result = FILE_ERROR;
+  }
 
   if (result != OK) {
-    Storage.remove(destPath.c_str());
+    // Keep a validated partial file for the next attempt; a user cancel or a
+    // server that gave us no ETag leaves nothing worth resuming.
+    if (result == HTTP_ERROR && sink.downloaded > 0 && !sink.validator.empty()) {
+      savePartialState(url, metaPath, sink.validator);
+      LOG_DBG("HTTP", "Kept %zu bytes for resume", sink.downloaded);
+    } else {
+      Storage.remove(partPath.c_str());
+      Storage.remove(metaPath.c_str());
+    }
     return result;
   }
+  Storage.remove(metaPath.c_str());
   if (sink.downloaded == 0) {
     LOG_ERR("HTTP", "no data received");
-    Storage.remove(destPath.c_str());
+    Storage.remove(partPath.c_str());
     return HTTP_ERROR;
   }
+
+  if (Storage.exists(destPath.c_str())) {
+    Storage.remove(destPath.c_str());
+  }
+  if (!Storage.rename(partPath.c_str(), destPath.c_str())) {
+    LOG_ERR("HTTP", "Failed to move download into place");
+    Storage.remove(partPath.c_str());
+    return FILE_ERROR;
+  }
   LOG_DBG("HTTP", "Downloaded %zu bytes", sink.downloaded);
   return OK;
 }
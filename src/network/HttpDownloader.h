@@ -39,7 +39,11 @@ class HttpDownloader {
                        const std::string& password = "");
 
   /**
-   * Download a file to the SD card with optional credentials.
+   * Download a file to the SD card with optional credentials. The body is
+   * written to <destPath>.part and renamed into place once complete. A
+   * connection dropped mid-body is resumed with a Range request (guarded by
+   * If-Range on the server's ETag); if every retry fails the partial file is
+   * kept so the next call for the same URL continues where this one stopped.
    */
   static DownloadError downloadToFile(const std::string& url, const std::string& destPath,
                                       ProgressCallback progress = nullptr, bool* cancelFlag = nullptr,
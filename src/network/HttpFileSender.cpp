@@ -0,0 +1,76 @@
+#include "HttpFileSender.h"
+
+#include <HttpRange.h>
+#include <Logging.h>
+#include <esp_task_wdt.h>
+
+namespace {
+constexpr size_t SEND_CHUNK = 4096;
+}  // namespace
+
+void HttpFileSender::send(WebServer& server, HalFile& file, const String& contentType, const bool headOnly) {
+  const size_t fileSize = file.size();
+
+  char etag[40] = "";
+  uint16_t fatDate = 0;
+  uint16_t fatTime = 0;
+  if (file.getModifyDateTime(&fatDate, &fatTime)) {
+    HttpRange::formatEtag(etag, sizeof(etag), fileSize, fatDate, fatTime);
+    server.sendHeader("ETag", etag);
+  }
+  server.sendHeader("Accept-Ranges", "bytes");
+
+  const bool hasRange = server.hasHeader("Range");
+  const String rangeHeader = hasRange ? server.header("Range") : String();
+  const String ifRange = hasRange ? server.header("If-Range") : String();
+  HttpRange::ByteRange range;
+  const HttpRange::RangeRequest request =
+      HttpRange::planResponse(hasRange ? rangeHeader.c_str() : nullptr, ifRange.c_str(), etag, fileSize, range);
+
+  char contentRange[64];
+  if (request == HttpRange::RangeRequest::UNSATISFIABLE) {
+    HttpRange::formatUnsatisfiedRange(contentRange, sizeof(contentRange), fileSize);
+    server.sendHeader("Content-Range", contentRange);
+    server.send(416, "text/plain", "Range Not Satisfiable");
+    return;
+  }
+
+  size_t remaining = fileSize;
+  if (request == HttpRange::RangeRequest::PARTIAL) {
+    remaining = range.length();
+    HttpRange::formatContentRange(contentRange, sizeof(contentRange), range, fileSize);
+    server.sendHeader("Content-Range", contentRange);
+    LOG_DBG("WEB", "Range %s", contentRange);
+  }
+
+  server.setContentLength(remaining);
+  server.send(request == HttpRange::RangeRequest::PARTIAL ? 206 : 200, contentType.c_str(), "");
+  if (headOnly || remaining == 0) return;
+
+  if (range.first > 0 && !file.seek(range.first)) {
+    LOG_ERR("WEB", "Seek to %zu failed", range.first);
+    server.client().stop();
+    return;
+  }
+
+  NetworkClient client = server.client();
+  uint8_t buffer[SEND_CHUNK];
+  while (remaining > 0) {
+    const int result = file.read(buffer, remaining < SEND_CHUNK ? remaining : SEND_CHUNK);
+    if (result <= 0) break;
+    const size_t bytesRead = static_cast<size_t>(result);
+    size_t totalWritten = 0;
+    while (totalWritten < bytesRead) {
+      esp_task_wdt_reset();
+      const size_t wrote = client.write(buffer + totalWritten, bytesRead - totalWritten);
+      if (wrote == 0) {
+        // Client went away; whatever it got can be resumed with a Range request.
+        client.clear();
+        return;
+      }
+      totalWritten += wrote;
+    }
+    remaining -= bytesRead;
+  }
+  client.clear();
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <WebServer.h>
+
+/**
+ * Shared response path for serving an SD file from the web server. Advertises
+ * byte ranges and honours a single Range (with If-Range) by answering 206
+ * Partial Content, so interrupted downloads of large EPUB/XTC/font files can
+ * resume instead of restarting. Requires the server to collect the "Range"
+ * and "If-Range" request headers.
+ */
+namespace HttpFileSender {
+
+// Send `file` (already opened, not a directory) with the given content type.
+// Extra headers (e.g. Content-Disposition) must be queued with sendHeader()
+// before calling. With headOnly the headers are sent without a body.
+void send(WebServer& server, HalFile& file, const String& contentType, bool headOnly = false);
+
+}  // namespace HttpFileSender
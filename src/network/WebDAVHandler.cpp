@@ -5,7 +5,9 @@
 #include <Logging.h>
 #include <esp_task_wdt.h>
 
+#include "HttpFileSender.h"
 #include "util/BookCacheUtils.h"
+#include "util/DirectoryListingCache.h"
 
 namespace {
 constexpr const char* HIDDEN_ITEMS[] = {"System Volume Information", "XTCache"};
@@ -63,7 +65,7 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
       }
     }
 
-    if (_putFile) _putFile.close();
+    _putWriter.abort();
     _putExisted = Storage.exists(_putPath.c_str());
 
     if (_putExisted) {
@@ -79,20 +81,26 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
     // Write to a temp file to avoid destroying the original on failed upload
     String tempPath = _putPath + ".davtmp";
     Storage.remove(tempPath.c_str());
-    _putOk = Storage.openFileForWrite("DAV", tempPath, _putFile);
+    HalFile file;
+    _putOk = Storage.openFileForWrite("DAV", tempPath, file) && _putWriter.begin(std::move(file));
     LOG_DBG("DAV", "PUT START: %s", _putPath.c_str());
 
   } else if (raw.status == RAW_WRITE) {
-    if (_putFile && _putOk) {
+    if (_putWriter.isActive() && _putOk) {
       esp_task_wdt_reset();
-      size_t written = _putFile.write(raw.buf, raw.currentSize);
-      if (written != raw.currentSize) {
+      if (!_putWriter.write(raw.buf, raw.currentSize)) {
         _putOk = false;
       }
     }
 
   } else if (raw.status == RAW_END) {
-    if (_putFile) _putFile.close();
+    if (_putWriter.isActive()) {
+      if (_putOk) {
+        _putOk = _putWriter.finish();
+      } else {
+        _putWriter.abort();
+      }
+    }
     if (_putOk) {
       String tempPath = _putPath + ".davtmp";
       if (_putExisted) Storage.remove(_putPath.c_str());
@@ -108,7 +116,7 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
     LOG_DBG("DAV", "PUT END: %u bytes, ok=%d", raw.totalSize, _putOk);
 
   } else if (raw.status == RAW_ABORTED) {
-    if (_putFile) _putFile.close();
+    _putWriter.abort();
     String tempPath = _putPath + ".davtmp";
     Storage.remove(tempPath.c_str());
     _putOk = false;
@@ -209,23 +217,14 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
       "<D:multistatus xmlns:D=\"DAV:\">\n");
 
   // Entry for the resource itself
-  if (isDir) {
-    sendPropEntry(s, path, true, 0, FIXED_DATE);
-  } else {
-    sendPropEntry(s, path, false, root.size(), FIXED_DATE);
-    root.close();
-    s.sendContent("</D:multistatus>\n");
-    s.sendContent("");
-    return;
-  }
+  const size_t rootSize = isDir ? 0 : root.size();
+  root.close();
+  sendPropEntry(s, path, isDir, rootSize, FIXED_DATE);
 
-  // If depth > 0 and it's a directory, list children
-  if (depth > 0) {
-    HalFile file = root.openNextFile();
-    char name[500];
-    while (file) {
-      file.getName(name, sizeof(name));
-      String fileName(name);
+  // If depth > 0 and it's a directory, list children (served from the listing cache)
+  if (isDir && depth > 0) {
+    DIR_CACHE.forEach(path.c_str(), [this, &s, &path](const DirectoryListing::Entry& entry) {
+      String fileName(entry.name);
 
       // Skip hidden/protected items
       bool shouldHide = fileName.startsWith(".");
@@ -242,22 +241,14 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
         String childPath = path;
         if (!childPath.endsWith("/")) childPath += "/";
         childPath += fileName;
-
-        if (file.isDirectory()) {
-          sendPropEntry(s, childPath, true, 0, FIXED_DATE);
-        } else {
-          sendPropEntry(s, childPath, false, file.size(), FIXED_DATE);
-        }
+        sendPropEntry(s, childPath, entry.isDirectory, entry.size, FIXED_DATE);
       }
 
-      file.close();
       yield();
       esp_task_wdt_reset();
-      file = root.openNextFile();
-    }
+    });
   }
 
-  root.close();
   s.sendContent("</D:multistatus>\n");
   s.sendContent("");
 }
@@ -323,12 +314,7 @@ void WebDAVHandler::handleGet(WebServer& s) {
     return;
   }
 
-  String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
-
-  NetworkClient client = s.client();
-  client.write(file);
+  HttpFileSender::send(s, file, getMimeType(path));
   file.close();
 }
 
@@ -360,9 +346,7 @@ void WebDAVHandler::handleHead(WebServer& s) {
     return;
   }
 
-  String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
+  HttpFileSender::send(s, file, getMimeType(path), true);
   file.close();
 }
 
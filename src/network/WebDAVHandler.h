@@ -3,6 +3,8 @@
 #include <HalStorage.h>
 #include <WebServer.h>
 
+#include "AsyncFileWriter.h"
+
 class WebDAVHandler : public RequestHandler {
  public:
   // RequestHandler interface
@@ -12,8 +14,9 @@ class WebDAVHandler : public RequestHandler {
   bool handle(WebServer& server, HTTPMethod method, const String& uri) override;
 
  private:
-  // PUT streaming state (raw() is called in chunks)
-  HalFile _putFile;
+  // PUT streaming state (raw() is called in chunks); SD writes are overlapped
+  // with receiving the next chunk
+  AsyncFileWriter _putWriter;
   String _putPath;
   bool _putOk = false;
   bool _putExisted = false;
@@ -20,6 +20,19 @@ bool isBookCacheDirectoryName(const char* name) {
          strncmp(name, XTC_PREFIX, std::size(XTC_PREFIX) - 1) == 0;
 }
 
+std::string getBookCachePath(const std::string& path) {
+  // Same naming as the Epub/Xtc/Txt constructors, without loading the book
+  const std::string hash = std::to_string(std::hash<std::string>{}(path));
+  if (FsHelpers::hasEpubExtension(path)) {
+    return "/.crosspoint/epub_" + hash;
+  } else if (FsHelpers::hasXtcExtension(path)) {
+    return "/.crosspoint/xtc_" + hash;
+  } else if (FsHelpers::hasTxtExtension(path)) {
+    return "/.crosspoint/txt_" + hash;
+  }
+  return "";
+}
+
 void clearBookCache(const std::string& path) {
   if (FsHelpers::hasEpubExtension(path)) {
     Epub(path, "/.crosspoint").clearCache();
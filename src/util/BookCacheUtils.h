@@ -6,5 +6,9 @@
 // (EPUB, XTC, or TXT). Does nothing for other file types.
 void clearBookCache(const std::string& path);
 
+// Cache directory the matching reader (EPUB, XTC, or TXT) uses for a book file,
+// or an empty string for other file types.
+std::string getBookCachePath(const std::string& path);
+
 // Returns true if the directory name matches a book cache entry.
 bool isBookCacheDirectoryName(const char* name);
@@ -28,8 +28,8 @@ std::string BookmarkUtil::sanitizeBookmarkSummary(std::string summary) {
   summary.erase(
       std::find_if(summary.rbegin(), summary.rend(), [](unsigned char ch) { return !std::isspace(ch); }).base(),
       summary.end());
-  if (summary.size() > 72) {
-    summary.resize(72);
+  if (summary.size() > MAX_SUMMARY_LENGTH) {
+    summary.resize(MAX_SUMMARY_LENGTH);
   }
   return summary;
 }
@@ -1,8 +1,11 @@
 #pragma once
+#include <cstddef>
 #include <string>
 
 class BookmarkUtil {
  public:
+  static constexpr size_t MAX_SUMMARY_LENGTH = 72;
+
   static std::string getBookmarksDir();
   static std::string getBookmarkPath(const std::string& bookPath);
   static std::string sanitizeBookmarkSummary(std::string summary);
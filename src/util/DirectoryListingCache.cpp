@@ -0,0 +1,228 @@
+#include "DirectoryListingCache.h"
+
+#include <Arduino.h>
+#include <FsHelpers.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Memory.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace {
+constexpr size_t NAME_BUFFER_SIZE = 500;
+
+std::string normalizeDirPath(const std::string& path) {
+  std::string result = path.empty() || path[0] != '/' ? "/" + path : path;
+  while (result.length() > 1 && result.back() == '/') {
+    result.pop_back();
+  }
+  return result;
+}
+
+// True if a change to `changed` can alter the listing of `dir`: a change to an
+// entry directly inside it, to the directory itself, or anywhere below it.
+bool isAffected(const std::string& dir, const std::string& changed) {
+  if (changed == dir) return true;
+  const std::string parent = FsHelpers::extractFolderPath(changed);
+  if (parent == dir) return true;
+  // Anything below the changed path (the changed entry was an ancestor of dir)
+  return dir.length() > changed.length() && dir.compare(0, changed.length(), changed) == 0 &&
+         (changed == "/" || dir[changed.length()] == '/');
+}
+}  // namespace
+
+DirectoryListingCache DirectoryListingCache::instance;
+
+DirectoryListingCache::DirectoryListingCache() { mutex = xSemaphoreCreateMutex(); }
+
+void DirectoryListingCache::begin() { Storage.setChangeListener(&DirectoryListingCache::onStorageChange); }
+
+void DirectoryListingCache::onStorageChange(const char* path) { instance.invalidate(path); }
+
+DirectoryListingCache::ScanResult DirectoryListingCache::scan(const std::string& path,
+                                                               std::shared_ptr<const DirectoryListing>& out) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    LOG_DBG("DIRC", "Not a directory: %s", path.c_str());
+    return ScanResult::Failed;
+  }
+  dir.rewindDirectory();
+
+  const auto nameBuffer = makeUniqueNoThrow<char[]>(NAME_BUFFER_SIZE);
+  std::shared_ptr<DirectoryListing> listing(new (std::nothrow) DirectoryListing());
+  if (!nameBuffer || !listing) {
+    LOG_ERR("DIRC", "OOM scanning %s", path.c_str());
+    dir.close();
+    return ScanResult::Failed;
+  }
+  listing->dirPath = path;
+  std::string& names = listing->names;
+  std::vector<DirectoryListing::Record>& records = listing->records;
+
+  const unsigned long startMs = millis();
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    const size_t nameLength = file.getName(nameBuffer.get(), NAME_BUFFER_SIZE);
+    if (nameLength == 0) {
+      continue;
+    }
+    // Give up as soon as the listing can't fit the budget, before growing past it
+    const size_t namesNeeded = names.size() + nameLength + 1;
+    const size_t recordsNeeded = records.size() + 1;
+    if (sizeof(DirectoryListing) + namesNeeded + recordsNeeded * sizeof(DirectoryListing::Record) >
+        MAX_CACHED_BYTES) {
+      file.close();
+      dir.close();
+      LOG_DBG("DIRC", "%s exceeds %u bytes after %u entries, streaming it", path.c_str(),
+              static_cast<unsigned>(MAX_CACHED_BYTES), static_cast<unsigned>(records.size()));
+      return ScanResult::OverBudget;
+    }
+    // Grow geometrically but never beyond what the budget could still hold
+    if (names.capacity() < namesNeeded) {
+      names.reserve(std::min(std::max(namesNeeded, names.capacity() * 2), MAX_CACHED_BYTES));
+    }
+    if (records.capacity() < recordsNeeded) {
+      records.reserve(std::min(std::max(recordsNeeded, records.capacity() * 2),
+                               MAX_CACHED_BYTES / sizeof(DirectoryListing::Record)));
+    }
+    const bool isDirectory = file.isDirectory();
+    records.push_back(
+        {static_cast<uint32_t>(names.size()), isDirectory ? 0 : static_cast<uint32_t>(file.size()), isDirectory});
+    names.append(nameBuffer.get(), nameLength);
+    names.push_back('\0');
+    file.close();
+    esp_task_wdt_reset();  // Large folders can take seconds on slow cards
+  }
+  dir.close();
+
+  const char* namesData = names.data();
+  std::sort(records.begin(), records.end(),
+            [namesData](const DirectoryListing::Record& a, const DirectoryListing::Record& b) {
+              if (a.isDirectory != b.isDirectory) return a.isDirectory;
+              return FsHelpers::naturalLess(namesData + a.nameOffset, namesData + b.nameOffset);
+            });
+  names.shrink_to_fit();
+  records.shrink_to_fit();
+
+  LOG_DBG("DIRC", "Scanned %s: %u entries, %u bytes in %lu ms", path.c_str(), static_cast<unsigned>(records.size()),
+          static_cast<unsigned>(listing->memoryUsage()), millis() - startMs);
+  out = std::move(listing);
+  return ScanResult::Listed;
+}
+
+bool DirectoryListingCache::stream(const std::string& path,
+                                   const std::function<void(const DirectoryListing::Entry&)>& visit) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    LOG_DBG("DIRC", "Not a directory: %s", path.c_str());
+    return false;
+  }
+  dir.rewindDirectory();
+
+  const auto nameBuffer = makeUniqueNoThrow<char[]>(NAME_BUFFER_SIZE);
+  if (!nameBuffer) {
+    LOG_ERR("DIRC", "OOM streaming %s", path.c_str());
+    dir.close();
+    return false;
+  }
+
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (file.getName(nameBuffer.get(), NAME_BUFFER_SIZE) > 0) {
+      const bool isDirectory = file.isDirectory();
+      visit({nameBuffer.get(), isDirectory ? 0 : static_cast<uint32_t>(file.size()), isDirectory});
+    }
+    file.close();
+    esp_task_wdt_reset();
+  }
+  dir.close();
+  return true;
+}
+
+bool DirectoryListingCache::forEach(const std::string& path,
+                                    const std::function<void(const DirectoryListing::Entry&)>& visit) {
+  const std::string dirPath = normalizeDirPath(path);
+
+  std::shared_ptr<const DirectoryListing> listing;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const auto it = std::find_if(listings.begin(), listings.end(),
+                               [&dirPath](const std::shared_ptr<const DirectoryListing>& l) {
+                                 return l->path() == dirPath;
+                               });
+  const bool knownOversized = std::find(oversized.begin(), oversized.end(), dirPath) != oversized.end();
+  if (it != listings.end()) {
+    listing = *it;
+    std::rotate(listings.begin(), it, it + 1);
+    hits++;
+  } else if (knownOversized) {
+    streamed++;
+  } else {
+    misses++;
+  }
+  const uint32_t scanGeneration = generation;
+  xSemaphoreGive(mutex);
+
+  if (knownOversized) {
+    return stream(dirPath, visit);
+  }
+
+  if (!listing) {
+    // Scan without holding the cache lock: it takes the storage lock for a while,
+    // and writers notify us (taking the cache lock) after releasing theirs.
+    switch (scan(dirPath, listing)) {
+      case ScanResult::Failed:
+        return false;
+      case ScanResult::OverBudget:
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        streamed++;
+        if (generation == scanGeneration) {
+          if (oversized.size() >= MAX_DIRECTORIES) oversized.pop_back();
+          oversized.insert(oversized.begin(), dirPath);
+        }
+        xSemaphoreGive(mutex);
+        return stream(dirPath, visit);
+      case ScanResult::Listed:
+        break;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (generation == scanGeneration) {
+      listings.insert(listings.begin(), listing);
+      size_t total = 0;
+      size_t keep = 0;
+      for (; keep < listings.size() && keep < MAX_DIRECTORIES; keep++) {
+        total += listings[keep]->memoryUsage();
+        if (total > MAX_CACHED_BYTES) break;
+      }
+      listings.resize(keep);
+    }
+    xSemaphoreGive(mutex);
+  }
+
+  for (size_t i = 0; i < listing->size(); i++) {
+    visit(listing->at(i));
+  }
+  return true;
+}
+
+void DirectoryListingCache::invalidate(const char* path) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  generation++;
+  if (!path) {
+    listings.clear();
+    oversized.clear();
+  } else {
+    const std::string changed = normalizeDirPath(path);
+    listings.erase(std::remove_if(listings.begin(), listings.end(),
+                                  [&changed](const std::shared_ptr<const DirectoryListing>& l) {
+                                    return isAffected(l->path(), changed);
+                                  }),
+                   listings.end());
+    // A deletion can bring an oversized directory back under the budget
+    oversized.erase(std::remove_if(oversized.begin(), oversized.end(),
+                                   [&changed](const std::string& dir) { return isAffected(dir, changed); }),
+                    oversized.end());
+  }
+  xSemaphoreGive(mutex);
+}
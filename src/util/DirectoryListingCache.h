@@ -0,0 +1,108 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Immutable snapshot of one directory's entries, sorted directories first and
+// then by FsHelpers::naturalLess (the file browser order). Names live in one
+// NUL-separated blob so a listing is two allocations regardless of its size.
+// Hidden entries are included; callers apply their own visibility rules.
+class DirectoryListing {
+ public:
+  struct Entry {
+    const char* name;
+    uint32_t size;
+    bool isDirectory;
+  };
+
+  const std::string& path() const { return dirPath; }
+  size_t size() const { return records.size(); }
+  Entry at(size_t index) const {
+    const Record& r = records[index];
+    return {names.data() + r.nameOffset, r.fileSize, r.isDirectory};
+  }
+  // Approximate heap footprint, used for the cache budget
+  size_t memoryUsage() const { return sizeof(*this) + names.capacity() + records.capacity() * sizeof(Record); }
+
+ private:
+  friend class DirectoryListingCache;
+
+  struct Record {
+    uint32_t nameOffset;
+    uint32_t fileSize;
+    bool isDirectory;
+  };
+
+  std::string dirPath;
+  std::string names;
+  std::vector<Record> records;
+};
+
+// Keeps the listings of the last few directories the file browser, web file
+// manager and WebDAV PROPFIND looked at, so paging back and forth through a
+// large folder doesn't rescan the FAT directory each time. Entries are dropped
+// whenever HalStorage reports a change inside (or to) the cached directory.
+// A directory whose listing would not fit the budget is never held in RAM:
+// the scan gives up as soon as it crosses it and the entries are streamed
+// from the card instead.
+class DirectoryListingCache {
+  static DirectoryListingCache instance;
+
+  static constexpr size_t MAX_DIRECTORIES = 4;
+  // Bounds both a single listing under construction and the whole cache
+  static constexpr size_t MAX_CACHED_BYTES = 32 * 1024;
+
+  SemaphoreHandle_t mutex = nullptr;
+  // Most recently used first
+  std::vector<std::shared_ptr<const DirectoryListing>> listings;
+  // Directories known to exceed the budget, streamed without a scan attempt
+  std::vector<std::string> oversized;
+  // Bumped on every invalidation so a scan that raced with a change isn't cached
+  uint32_t generation = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t streamed = 0;
+
+  DirectoryListingCache();
+
+  enum class ScanResult { Listed, OverBudget, Failed };
+  static ScanResult scan(const std::string& path, std::shared_ptr<const DirectoryListing>& out);
+  static bool stream(const std::string& path, const std::function<void(const DirectoryListing::Entry&)>& visit);
+  static void onStorageChange(const char* path);
+
+ public:
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    // Directories too large to cache, listed straight from the card
+    uint32_t streamed = 0;
+  };
+
+  static DirectoryListingCache& getInstance() { return instance; }
+
+  // Subscribe to HalStorage change notifications; call once after Storage.begin()
+  void begin();
+
+  // Calls `visit` with each entry of `path` ("/" or "/a/b", a trailing slash
+  // is ignored). Cached listings come in file browser order; directories over
+  // the budget are streamed in on-card order, so callers that need an order
+  // sort themselves. `entry.name` is only valid during the call. Returns false
+  // if the path can't be opened as a directory or memory runs out.
+  bool forEach(const std::string& path, const std::function<void(const DirectoryListing::Entry&)>& visit);
+
+  // Drop cached data affected by a change to `path`: its parent directory,
+  // the path itself and everything below it. nullptr drops everything.
+  void invalidate(const char* path);
+  void clear() { invalidate(nullptr); }
+
+  Stats getStats() const { return {hits, misses, streamed}; }
+};
+
+#define DIR_CACHE DirectoryListingCache::getInstance()
@@ -2,12 +2,16 @@
 
 #include <GfxRenderer.h>
 
+#include <cstddef>
 #include <string>
 
 #include "components/themes/BaseTheme.h"
 
 namespace QrUtils {
 
+// Version 40, ECC_LOW, byte mode; longer payloads are truncated
+constexpr size_t MAX_QR_CAPACITY = 2953;
+
 // Renders a QR code with the given text payload within the specified bounding box.
 void drawQrCode(const GfxRenderer& renderer, const Rect& bounds, const std::string& textPayload);
 
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "lib/Dictionary/Dictionary.h"
+
+// tinflate.c references the zlib/gzip checksums; definition blocks are raw DEFLATE, so these never run.
+extern "C" uint32_t uzlib_adler32(const void*, unsigned int, const uint32_t prevSum) { return prevSum; }
+extern "C" uint32_t uzlib_crc32(const void*, unsigned int, const uint32_t crc) { return crc; }
+
+namespace {
+
+// FRUIT_DICT is fixtures/stardict-test_fruit-2.4.2.ifo converted with one key per
+// index page; LONG_KEYS_DICT holds 300 ~240-byte keys converted with no key limit
+// per page and a 400-byte title (see CMakeLists.txt).
+
+TEST(DictionaryTest, OpensConvertedStarDict) {
+  Dictionary dict;
+  ASSERT_TRUE(dict.open(FRUIT_DICT));
+  EXPECT_EQ(dict.getTitle(), "Test Fruit");
+  EXPECT_EQ(dict.getEntryCount(), 7u);
+}
+
+TEST(DictionaryTest, LooksUpStarDictEntries) {
+  Dictionary dict;
+  ASSERT_TRUE(dict.open(FRUIT_DICT));
+  std::vector<Dictionary::Entry> out;
+
+  ASSERT_TRUE(dict.lookup("banana", out));
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].headword, "banana");
+  EXPECT_EQ(out[0].definition, "A long yellow fruit & snack.");
+
+  ASSERT_TRUE(dict.lookup("ЁЖ", out));
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].headword, "Ёж");
+
+  ASSERT_TRUE(dict.lookup("(Zebra,", out));
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].definition, "An African equine with stripes.");
+
+  EXPECT_FALSE(dict.lookup("durian", out));
+  EXPECT_TRUE(out.empty());
+}
+
+TEST(DictionaryTest, CollectsSameKeyEntriesAcrossPages) {
+  Dictionary dict;
+  ASSERT_TRUE(dict.open(FRUIT_DICT));
+  std::vector<Dictionary::Entry> out;
+
+  ASSERT_TRUE(dict.lookup("APPLE", out));
+  ASSERT_EQ(out.size(), 2u);
+  EXPECT_EQ(out[0].headword, "apple");
+  EXPECT_EQ(out[0].definition, "apple\nA round fruit.");
+  EXPECT_EQ(out[1].headword, "Apple");
+  EXPECT_EQ(out[1].definition, "A technology company.");
+
+  ASSERT_TRUE(dict.lookup("apple", out, 1));
+  EXPECT_EQ(out.size(), 1u);
+}
+
+TEST(DictionaryTest, SplitsIndexPagesThatWouldExceedDeviceLimit) {
+  Dictionary dict;
+  ASSERT_TRUE(dict.open(LONG_KEYS_DICT));
+  EXPECT_EQ(dict.getEntryCount(), 300u);
+
+  const std::string padding(230, 'k');
+  std::vector<Dictionary::Entry> out;
+  for (int i = 100; i < 400; i += 37) {
+    ASSERT_TRUE(dict.lookup("longword-" + padding + "-" + std::to_string(i), out)) << i;
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].definition, "definition " + std::to_string(i));
+  }
+  ASSERT_TRUE(dict.lookup("longword-" + padding + "-399", out));
+  EXPECT_EQ(out[0].definition, "definition 399");
+}
+
+TEST(DictionaryTest, TrimsTitleOnCharacterBoundary) {
+  Dictionary dict;
+  ASSERT_TRUE(dict.open(LONG_KEYS_DICT));
+  std::string expected;
+  for (int i = 0; i < 63; i++) expected += "Ёж";
+  expected += "Ё";
+  EXPECT_EQ(dict.getTitle(), expected);
+}
+
+}  // namespace
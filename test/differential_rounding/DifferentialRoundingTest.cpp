@@ -73,6 +73,8 @@ const EpdFontData kTestFontData = {
   .kernRightClassCount = 2,
   .ligaturePairs     = nullptr,
   .ligaturePairCount = 0,
+  .glyphLut          = nullptr,
+  .bitmapEncoding    = EPD_BITMAP_PACKED,
   .glyphMissHandler  = nullptr,
   .glyphMissCtx      = nullptr,
 };
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "lib/EpdFont/GlyphBitmap.h"
+
+namespace {
+
+using Pixel = std::tuple<int, int, uint8_t>;
+
+void setPixel(std::vector<uint8_t>& bytes, const uint32_t pos, const uint8_t raw) {
+  bytes[pos >> 2] |= raw << ((3 - (pos & 3)) * 2);
+}
+
+// Glyph as raw values, row-major
+struct Glyph {
+  uint8_t width;
+  uint8_t height;
+  std::vector<uint8_t> raw;
+
+  std::vector<uint8_t> packed() const {
+    std::vector<uint8_t> bytes((width * height + 3) / 4, 0);
+    for (uint32_t i = 0; i < raw.size(); i++) setPixel(bytes, i, raw[i]);
+    return bytes;
+  }
+
+  std::vector<uint8_t> aligned() const {
+    const uint32_t stride = GlyphBitmap::alignedRowBytes(width);
+    std::vector<uint8_t> bytes(stride * height, 0);
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) setPixel(bytes, y * stride * 4 + x, raw[y * width + x]);
+    }
+    return bytes;
+  }
+
+  std::vector<Pixel> inked() const {
+    std::vector<Pixel> out;
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        if (raw[y * width + x] != 0) out.emplace_back(x, y, raw[y * width + x]);
+      }
+    }
+    return out;
+  }
+};
+
+std::vector<Pixel> walk(const std::vector<uint8_t>& bitmap, const uint8_t width, const uint8_t height,
+                        const uint8_t rowStride) {
+  std::vector<Pixel> out;
+  GlyphBitmap::forEachInkedPixel(bitmap.data(), width, height, rowStride,
+                                 [&out](const int x, const int y, const uint8_t raw) { out.emplace_back(x, y, raw); });
+  return out;
+}
+
+TEST(GlyphBitmapTest, AlignedRowBytes) {
+  EXPECT_EQ(GlyphBitmap::alignedRowBytes(0), 0u);
+  EXPECT_EQ(GlyphBitmap::alignedRowBytes(1), 1u);
+  EXPECT_EQ(GlyphBitmap::alignedRowBytes(4), 1u);
+  EXPECT_EQ(GlyphBitmap::alignedRowBytes(5), 2u);
+  EXPECT_EQ(GlyphBitmap::alignedRowBytes(255), 64u);
+}
+
+TEST(GlyphBitmapTest, PackedAndAlignedLayoutsVisitTheSamePixels) {
+  std::mt19937 rng(47);
+  for (int width = 1; width <= 13; width++) {
+    for (int height = 1; height <= 9; height += 4) {
+      Glyph glyph{static_cast<uint8_t>(width), static_cast<uint8_t>(height), {}};
+      // Mostly white, like real glyphs, so whole white bytes occur at every alignment
+      for (int i = 0; i < width * height; i++) glyph.raw.push_back(rng() % 3 == 0 ? rng() % 4 : 0);
+
+      const auto expected = glyph.inked();
+      EXPECT_EQ(walk(glyph.packed(), glyph.width, glyph.height, 0), expected) << width << "x" << height;
+      const auto stride = static_cast<uint8_t>(GlyphBitmap::alignedRowBytes(glyph.width));
+      EXPECT_EQ(walk(glyph.aligned(), glyph.width, glyph.height, stride), expected) << width << "x" << height;
+    }
+  }
+}
+
+TEST(GlyphBitmapTest, WhiteSkipPastPackedRowEndKeepsNextRowInk) {
+  // 5 wide: the white byte at pixels 4-7 spans the end of row 0 and the start of row 1
+  Glyph glyph{5, 3, std::vector<uint8_t>(15, 0)};
+  glyph.raw[1 * 5 + 3] = 3;  // pixel 8, first in its byte
+  glyph.raw[2 * 5 + 0] = 2;  // pixel 10, mid-byte after a white start
+  EXPECT_EQ(walk(glyph.packed(), glyph.width, glyph.height, 0), glyph.inked());
+
+  Glyph fourWide{4, 3, std::vector<uint8_t>(12, 0)};
+  fourWide.raw[2 * 4 + 3] = 1;
+  EXPECT_EQ(walk(fourWide.packed(), fourWide.width, fourWide.height, 0), fourWide.inked());
+}
+
+TEST(GlyphBitmapTest, AlignedRowsIgnorePaddingPixels) {
+  Glyph glyph{6, 2, {0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0}};
+  auto bytes = glyph.aligned();
+  // Non-zero padding after each 6-pixel row must not be drawn
+  bytes[1] |= 0x0F;
+  bytes[3] |= 0x0F;
+  EXPECT_EQ(walk(bytes, glyph.width, glyph.height, 2), glyph.inked());
+}
+
+TEST(GlyphBitmapTest, AllWhiteGlyphVisitsNothing) {
+  const Glyph glyph{9, 7, std::vector<uint8_t>(63, 0)};
+  EXPECT_TRUE(walk(glyph.packed(), glyph.width, glyph.height, 0).empty());
+  EXPECT_TRUE(walk(glyph.aligned(), glyph.width, glyph.height, 3).empty());
+}
+
+}  // namespace
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "lib/EpdFont/EpdFont.h"
+#include "lib/EpdFont/EpdFontData.h"
+
+// ============================================================================
+// Synthetic test font
+//
+// Intervals cover printable ASCII, Latin Extended-A, the basic Cyrillic block,
+// one codepoint past the table (U+2014 em dash) and U+FFFD. Gaps inside the
+// table ranges (U+0080-U+00FF, U+0450-U+045F) exercise the "not in font" slots.
+// Kern classes are spread over ASCII, Cyrillic and the em dash.
+// ============================================================================
+
+namespace {
+
+// clang-format off
+const EpdUnicodeInterval kIntervals[] = {
+  { 0x0020, 0x007E, 0 },    // 95 glyphs
+  { 0x0100, 0x017F, 95 },   // 128 glyphs
+  { 0x0410, 0x044F, 223 },  // 64 glyphs
+  { 0x2014, 0x2014, 287 },
+  { 0xFFFD, 0xFFFD, 288 },
+};
+constexpr size_t kGlyphCount = 289;
+
+const EpdKernClassEntry kKernLeft[] = {
+  { 0x0041, 1 },  // 'A'
+  { 0x0054, 2 },  // 'T'
+  { 0x0412, 1 },  // 'В'
+  { 0x0413, 2 },  // 'Г'
+  { 0x2014, 1 },  // em dash
+};
+
+const EpdKernClassEntry kKernRight[] = {
+  { 0x0061, 1 },  // 'a'
+  { 0x006F, 2 },  // 'o'
+  { 0x0430, 1 },  // 'а'
+  { 0x043E, 2 },  // 'о'
+  { 0x2014, 2 },  // em dash
+};
+
+const int8_t kKernMatrix[] = { -3, -5, -7, -9 };
+// clang-format on
+
+std::vector<EpdGlyph> makeGlyphs() {
+  std::vector<EpdGlyph> glyphs(kGlyphCount);
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    glyphs[i] = EpdGlyph{8, 10, static_cast<uint16_t>(128 + i), 0, 10, 0, 0};
+  }
+  return glyphs;
+}
+
+EpdFontData makeFontData(const EpdGlyph* glyphs, const EpdGlyphLutEntry* lut) {
+  EpdFontData data = {};
+  data.glyph = glyphs;
+  data.intervals = kIntervals;
+  data.intervalCount = sizeof(kIntervals) / sizeof(kIntervals[0]);
+  data.advanceY = 16;
+  data.ascender = 12;
+  data.kernLeftClasses = kKernLeft;
+  data.kernRightClasses = kKernRight;
+  data.kernMatrix = kKernMatrix;
+  data.kernLeftEntryCount = sizeof(kKernLeft) / sizeof(kKernLeft[0]);
+  data.kernRightEntryCount = sizeof(kKernRight) / sizeof(kKernRight[0]);
+  data.kernLeftClassCount = 2;
+  data.kernRightClassCount = 2;
+  data.glyphLut = lut;
+  return data;
+}
+
+class GlyphLutTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    glyphs = makeGlyphs();
+    searchData = makeFontData(glyphs.data(), nullptr);
+    ASSERT_TRUE(EpdFont::buildGlyphLut(searchData, lut));
+    lutData = makeFontData(glyphs.data(), lut);
+  }
+
+  std::vector<EpdGlyph> glyphs;
+  EpdGlyphLutEntry lut[EPD_GLYPH_LUT_SIZE] = {};
+  EpdFontData searchData = {};
+  EpdFontData lutData = {};
+};
+
+}  // namespace
+
+TEST(GlyphLutSlotTest, MapsRangeBoundaries) {
+  EXPECT_EQ(epdGlyphLutSlot(0x0000), 0);
+  EXPECT_EQ(epdGlyphLutSlot(0x017F), 0x17F);
+  EXPECT_EQ(epdGlyphLutSlot(0x0180), -1);
+  EXPECT_EQ(epdGlyphLutSlot(0x03FF), -1);
+  EXPECT_EQ(epdGlyphLutSlot(0x0400), 0x180);
+  EXPECT_EQ(epdGlyphLutSlot(0x045F), static_cast<int>(EPD_GLYPH_LUT_SIZE) - 1);
+  EXPECT_EQ(epdGlyphLutSlot(0x0460), -1);
+  EXPECT_EQ(epdGlyphLutSlot(0x2014), -1);
+}
+
+TEST_F(GlyphLutTest, BuiltTableMatchesIntervalsAndKernClasses) {
+  EXPECT_EQ(lut[epdGlyphLutSlot('A')].glyphIndex, 'A' - 0x20);
+  EXPECT_EQ(lut[epdGlyphLutSlot('A')].kernLeftClass, 1);
+  EXPECT_EQ(lut[epdGlyphLutSlot('a')].kernRightClass, 1);
+  EXPECT_EQ(lut[epdGlyphLutSlot(0x0100)].glyphIndex, 95);
+  EXPECT_EQ(lut[epdGlyphLutSlot(0x0410)].glyphIndex, 223);
+  EXPECT_EQ(lut[epdGlyphLutSlot(0x0413)].kernLeftClass, 2);
+  EXPECT_EQ(lut[epdGlyphLutSlot(0x0000)].glyphIndex, EPD_GLYPH_LUT_NONE);
+  EXPECT_EQ(lut[epdGlyphLutSlot(0x00E9)].glyphIndex, EPD_GLYPH_LUT_NONE);
+  EXPECT_EQ(lut[epdGlyphLutSlot(0x0451)].glyphIndex, EPD_GLYPH_LUT_NONE);
+}
+
+TEST_F(GlyphLutTest, GetGlyphAgreesWithIntervalSearch) {
+  const EpdFont searchFont(&searchData);
+  const EpdFont lutFont(&lutData);
+  for (uint32_t cp = 0; cp < 0x500; cp++) {
+    EXPECT_EQ(lutFont.getGlyph(cp), searchFont.getGlyph(cp)) << "cp=" << cp;
+  }
+  EXPECT_EQ(lutFont.getGlyph(0x2014), searchFont.getGlyph(0x2014));
+  EXPECT_EQ(lutFont.getGlyph(0x2014), &glyphs[287]);
+}
+
+TEST_F(GlyphLutTest, MissingCodepointInTableFallsBackToReplacement) {
+  const EpdFont lutFont(&lutData);
+  EXPECT_EQ(lutFont.getGlyph(0x00E9), &glyphs[288]);
+  EXPECT_EQ(lutFont.getGlyph(0x0451), &glyphs[288]);
+}
+
+TEST_F(GlyphLutTest, GetKerningAgreesWithClassSearch) {
+  const EpdFont searchFont(&searchData);
+  const EpdFont lutFont(&lutData);
+  const uint32_t samples[] = {0x41, 0x54, 0x61, 0x6F, 0x7A, 0x0412, 0x0413, 0x0430, 0x043E, 0x2014};
+  for (const uint32_t left : samples) {
+    for (const uint32_t right : samples) {
+      EXPECT_EQ(lutFont.getKerning(left, right), searchFont.getKerning(left, right))
+          << "left=" << left << " right=" << right;
+    }
+  }
+  EXPECT_EQ(lutFont.getKerning('T', 'o'), -9);
+  EXPECT_EQ(lutFont.getKerning(0x0412, 0x0430), -3);
+  EXPECT_EQ(lutFont.getKerning(0x2014, 0x2014), -5);
+}
+
+TEST(GlyphLutBuildTest, RejectsGlyphIndexThatDoesNotFit) {
+  const EpdUnicodeInterval intervals[] = {{0x41, 0x41, EPD_GLYPH_LUT_NONE}};
+  EpdFontData data = {};
+  data.intervals = intervals;
+  data.intervalCount = 1;
+  EpdGlyphLutEntry lut[EPD_GLYPH_LUT_SIZE];
+  EXPECT_FALSE(EpdFont::buildGlyphLut(data, lut));
+}
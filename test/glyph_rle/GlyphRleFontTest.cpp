@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "lib/EpdFont/EpdFontData.h"
+#include "lib/EpdFont/GlyphRle.h"
+#include "lib/InflateReader/InflateReader.h"
+
+// Built by fontconvert.py at test build time (see CMakeLists.txt)
+#include "notosans_18_bold_deflate.h"
+#include "notosans_18_bold_packed.h"
+#include "notosans_18_bold_rle.h"
+#include "notoserif_12_regular_deflate.h"
+#include "notoserif_12_regular_packed.h"
+#include "notoserif_12_regular_rle.h"
+
+// tinflate.c references the zlib/gzip checksums; font groups are raw DEFLATE, so these never run.
+extern "C" uint32_t uzlib_adler32(const void*, unsigned int, const uint32_t prevSum) { return prevSum; }
+extern "C" uint32_t uzlib_crc32(const void*, unsigned int, const uint32_t crc) { return crc; }
+
+namespace {
+
+// One font converted three ways from the same source
+struct FontSet {
+  const char* name;
+  const EpdFontData& packed;
+  const EpdFontData& rle;
+  const EpdFontData& deflate;
+  uint32_t rleBytes;
+};
+
+const FontSet FONTS[] = {
+    {"notoserif_12_regular", notoserif_12_regular_packed, notoserif_12_regular_rle, notoserif_12_regular_deflate,
+     sizeof(notoserif_12_regular_rleBitmaps)},
+    {"notosans_18_bold", notosans_18_bold_packed, notosans_18_bold_rle, notosans_18_bold_deflate,
+     sizeof(notosans_18_bold_rleBitmaps)},
+};
+
+// Byte-aligned rows (DEFLATE group layout) to the packed format, as FontDecompressor::compactSingleGlyph.
+void compactGlyph(const uint8_t* aligned, uint8_t* packed, const uint8_t width, const uint8_t height) {
+  const uint32_t rowStride = (width + 3) / 4;
+  memset(packed, 0, (static_cast<uint32_t>(width) * height + 3) / 4);
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      const uint8_t value = (aligned[y * rowStride + x / 4] >> ((3 - (x % 4)) * 2)) & 0x3;
+      const uint32_t pos = y * width + x;
+      packed[pos >> 2] |= value << ((3 - (pos & 3)) * 2);
+    }
+  }
+}
+
+uint32_t alignedSize(const EpdGlyph& glyph) { return ((glyph.width + 3) / 4) * glyph.height; }
+
+uint32_t glyphCount(const EpdFontData& font) {
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < font.intervalCount; i++) count += font.intervals[i].last - font.intervals[i].first + 1;
+  return count;
+}
+
+// Glyph indices of a group in stream order, for both contiguous and frequency-grouped fonts.
+std::vector<uint32_t> groupMembers(const EpdFontData& font, const uint16_t groupIndex) {
+  std::vector<uint32_t> members;
+  if (font.glyphToGroup) {
+    for (uint32_t i = 0; i < glyphCount(font); i++) {
+      if (font.glyphToGroup[i] == groupIndex) members.push_back(i);
+    }
+  } else {
+    const EpdFontGroup& group = font.groups[groupIndex];
+    for (uint32_t i = 0; i < group.glyphCount; i++) members.push_back(group.firstGlyphIndex + i);
+  }
+  return members;
+}
+
+bool inflateGroup(const EpdFontData& font, const uint16_t groupIndex, uint8_t* out) {
+  const EpdFontGroup& group = font.groups[groupIndex];
+  InflateReader reader;
+  reader.init(false);
+  reader.setSource(&font.bitmap[group.compressedOffset], group.compressedSize);
+  return reader.read(out, group.uncompressedSize);
+}
+
+std::vector<uint8_t> packedGlyph(const EpdFontData& font, const uint32_t index) {
+  const EpdGlyph& glyph = font.glyph[index];
+  return std::vector<uint8_t>(&font.bitmap[glyph.dataOffset], &font.bitmap[glyph.dataOffset] + glyph.dataLength);
+}
+
+}  // namespace
+
+TEST(GlyphRleFontTest, DecodesFontconvertStreams) {
+  for (const FontSet& font : FONTS) {
+    SCOPED_TRACE(font.name);
+    ASSERT_EQ(font.rle.bitmapEncoding, EPD_BITMAP_RLE);
+    ASSERT_EQ(font.rle.groupCount, 0);
+    const uint32_t count = glyphCount(font.packed);
+    ASSERT_EQ(glyphCount(font.rle), count);
+
+    std::vector<uint8_t> decoded;
+    for (uint32_t i = 0; i < count; i++) {
+      const EpdGlyph& glyph = font.rle.glyph[i];
+      ASSERT_EQ(glyph.width, font.packed.glyph[i].width) << "glyph " << i;
+      ASSERT_EQ(glyph.height, font.packed.glyph[i].height) << "glyph " << i;
+      ASSERT_EQ(glyph.dataLength, font.packed.glyph[i].dataLength) << "glyph " << i;
+      ASSERT_LE(glyph.dataOffset, font.rleBytes) << "glyph " << i;
+      decoded.assign(glyph.dataLength, 0x5A);
+      GlyphRle::decode(&font.rle.bitmap[glyph.dataOffset], decoded.data(), glyph.width, glyph.height);
+      ASSERT_EQ(decoded, packedGlyph(font.packed, i)) << "glyph " << i;
+    }
+  }
+}
+
+// Benchmark: fetching every glyph once in random-access order, the way the hot-group fallback in
+// FontDecompressor::getBitmap() does it (inflate the glyph's group, compact one glyph), against
+// decoding the glyph's RLE stream. Prints flash size, decode time and peak RAM per font.
+TEST(GlyphRleFontTest, BenchmarkAgainstDeflateGroups) {
+  using Clock = std::chrono::steady_clock;
+  for (const FontSet& font : FONTS) {
+    SCOPED_TRACE(font.name);
+    const EpdFontData& deflate = font.deflate;
+    const uint32_t count = glyphCount(deflate);
+    ASSERT_EQ(glyphCount(font.rle), count);
+
+    uint32_t deflateBytes = 0, maxGroup = 0, maxGlyph = 0, packedBytes = 0;
+    for (uint16_t g = 0; g < deflate.groupCount; g++) {
+      deflateBytes = std::max(deflateBytes, deflate.groups[g].compressedOffset + deflate.groups[g].compressedSize);
+      maxGroup = std::max(maxGroup, deflate.groups[g].uncompressedSize);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      maxGlyph = std::max<uint32_t>(maxGlyph, deflate.glyph[i].dataLength);
+      packedBytes += deflate.glyph[i].dataLength;
+    }
+    const uint32_t deflateFlash = deflateBytes + deflate.groupCount * sizeof(EpdFontGroup) +
+                                  (deflate.glyphToGroup ? count * sizeof(uint16_t) : 0);
+
+    std::vector<uint32_t> groupOf(count), alignedOffset(count);
+    for (uint16_t g = 0; g < deflate.groupCount; g++) {
+      uint32_t offset = 0;
+      for (const uint32_t i : groupMembers(deflate, g)) {
+        groupOf[i] = g;
+        alignedOffset[i] = offset;
+        if (deflate.glyph[i].width > 0 && deflate.glyph[i].height > 0) offset += alignedSize(deflate.glyph[i]);
+      }
+    }
+
+    // Both paths must produce the same glyphs; the sums cancel out
+    std::vector<uint8_t> groupBuf(maxGroup), glyphBuf(maxGlyph);
+    uint32_t checksum = 0;
+    auto start = Clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+      const EpdGlyph& glyph = deflate.glyph[i];
+      if (glyph.dataLength == 0) continue;
+      ASSERT_TRUE(inflateGroup(deflate, groupOf[i], groupBuf.data()));
+      compactGlyph(&groupBuf[alignedOffset[i]], glyphBuf.data(), glyph.width, glyph.height);
+      for (uint32_t b = 0; b < glyph.dataLength; b++) checksum += glyphBuf[b];
+    }
+    const double deflateUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+      const EpdGlyph& glyph = font.rle.glyph[i];
+      if (glyph.dataLength == 0) continue;
+      GlyphRle::decode(&font.rle.bitmap[glyph.dataOffset], glyphBuf.data(), glyph.width, glyph.height);
+      for (uint32_t b = 0; b < glyph.dataLength; b++) checksum -= glyphBuf[b];
+    }
+    const double rleUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    EXPECT_EQ(checksum, 0u);
+
+    // Peak RAM of one glyph fetch: group buffer + inflater state + glyph vs. the glyph alone
+    const uint32_t deflatePeak = maxGroup + sizeof(InflateReader) + maxGlyph;
+    const uint32_t rlePeak = maxGlyph;
+    printf("[ bench    ] %s: %u glyphs, %u bytes packed\n", font.name, count, packedBytes);
+    printf("[ bench    ]   DEFLATE groups: flash %6u B  %7.2f us/glyph  peak RAM %6u B\n", deflateFlash,
+           deflateUs / count, deflatePeak);
+    printf("[ bench    ]   per-glyph RLE:  flash %6u B  %7.2f us/glyph  peak RAM %6u B\n", font.rleBytes,
+           rleUs / count, rlePeak);
+
+    EXPECT_LT(rlePeak, deflatePeak);
+  }
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "lib/EpdFont/GlyphRle.h"
+
+namespace {
+
+uint8_t pixelAt(const uint8_t* packed, const uint32_t pos) { return (packed[pos >> 2] >> ((3 - (pos & 3)) * 2)) & 0x3; }
+
+}  // namespace
+
+// ============================================================================
+// Format
+// ============================================================================
+
+TEST(GlyphRleTest, DecodesEveryCode) {
+  // gray1, gray2, white 3, black 2, white 7+3, black 6+2, long white 20, long black 30
+  const uint8_t stream[] = {0x01, 0x4A, 0x83, 0xE2, 0xF1, 0x3F, 0x9D};
+  const uint8_t width = 75;
+  uint8_t packed[(width + 3) / 4];
+  GlyphRle::decode(stream, packed, width, 1);
+
+  std::vector<uint8_t> expected = {1, 2, 0, 0, 0, 3, 3};
+  expected.insert(expected.end(), 10, 0);
+  expected.insert(expected.end(), 8, 3);
+  expected.insert(expected.end(), 20, 0);
+  expected.insert(expected.end(), 30, 3);
+  ASSERT_EQ(expected.size(), width);
+  for (uint32_t i = 0; i < width; i++) {
+    EXPECT_EQ(pixelAt(packed, i), expected[i]) << "pixel " << i;
+  }
+}
+
+TEST(GlyphRleTest, RunsCrossRowBoundaries) {
+  // One black run of 6+3 covers the whole 3x3 glyph
+  const uint8_t stream[] = {0xE3};
+  uint8_t packed[3];
+  GlyphRle::decode(stream, packed, 3, 3);
+  EXPECT_EQ(packed[0], 0xFF);
+  EXPECT_EQ(packed[1], 0xFF);
+  EXPECT_EQ(packed[2], 0xC0);
+}
+
+TEST(GlyphRleTest, OverlongRunStopsAtGlyphEnd) {
+  // Long black run of 128 for a 2x2 glyph: decoding must not write past dataLength
+  const uint8_t stream[] = {0xFF, 0xF0};
+  uint8_t packed[2] = {0x00, 0xAA};
+  GlyphRle::decode(stream, packed, 2, 2);
+  EXPECT_EQ(packed[0], 0xFF);
+  EXPECT_EQ(packed[1], 0xAA);
+
+  uint32_t covered = 0;
+  GlyphRle::forEachRun(stream, 2, 2, [&covered](uint32_t, const uint32_t run, uint8_t) { covered += run; });
+  EXPECT_EQ(covered, 4u);
+}
+
+TEST(GlyphRleTest, ForEachRunReportsPixelPositions) {
+  // white 2, gray1, black 3, white 3+3 -> 4x3 glyph
+  const uint8_t stream[] = {0x30, 0xB4, 0x40};
+  std::vector<std::vector<uint32_t>> runs;
+  GlyphRle::forEachRun(stream, 4, 3, [&runs](const uint32_t pos, const uint32_t run, const uint8_t value) {
+    runs.push_back({pos, run, value});
+  });
+  const std::vector<std::vector<uint32_t>> expected = {{0, 2, 0}, {2, 1, 1}, {3, 3, 3}, {6, 3, 0}, {9, 3, 0}};
+  EXPECT_EQ(runs, expected);
+}
@@ -0,0 +1,13 @@
+# Runs fontconvert.py into a header file, for add_custom_command (which can't
+# redirect stdout). Expects PYTHON, SCRIPT, NAME, SIZE, FONT and OUTPUT; MODE is
+# the encoding flag, empty for packed bitmaps.
+
+execute_process(
+  COMMAND ${PYTHON} ${SCRIPT} ${NAME} ${SIZE} ${FONT} --2bit ${MODE}
+  OUTPUT_FILE ${OUTPUT}
+  RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+  file(REMOVE ${OUTPUT})
+  message(FATAL_ERROR "fontconvert.py failed for ${NAME}")
+endif()
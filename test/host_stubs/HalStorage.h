@@ -0,0 +1,152 @@
+#pragma once
+
+// Host stand-in for lib/hal/HalStorage.h: the HalFile calls the host-tested
+// libraries make, backed by stdio and dirent with paths used as given.
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <utility>
+
+class HalFile {
+ public:
+  HalFile() = default;
+  ~HalFile() { close(); }
+  HalFile(HalFile&& other) noexcept
+      : fp(std::exchange(other.fp, nullptr)), dir(std::exchange(other.dir, nullptr)), path(std::move(other.path)) {}
+  HalFile& operator=(HalFile&& other) noexcept {
+    if (this != &other) {
+      close();
+      fp = std::exchange(other.fp, nullptr);
+      dir = std::exchange(other.dir, nullptr);
+      path = std::move(other.path);
+    }
+    return *this;
+  }
+  HalFile(const HalFile&) = delete;
+  HalFile& operator=(const HalFile&) = delete;
+
+  bool openForRead(const char* filePath) { return openFile(filePath, "rb"); }
+  bool openForWrite(const char* filePath) { return openFile(filePath, "wb"); }
+  // Anonymous read/write file, removed when closed
+  bool openTemp() {
+    close();
+    fp = std::tmpfile();
+    return fp != nullptr;
+  }
+  // A directory, or a file for reading
+  bool open(const char* entryPath) {
+    close();
+    dir = opendir(entryPath);
+    if (dir) {
+      path = entryPath;
+      return true;
+    }
+    return openForRead(entryPath);
+  }
+
+  size_t size() {
+    const long pos = std::ftell(fp);
+    std::fseek(fp, 0, SEEK_END);
+    const long end = std::ftell(fp);
+    std::fseek(fp, pos, SEEK_SET);
+    return static_cast<size_t>(end);
+  }
+  size_t fileSize() { return size(); }
+  size_t position() const { return static_cast<size_t>(std::ftell(fp)); }
+  bool seek(const size_t pos) { return std::fseek(fp, static_cast<long>(pos), SEEK_SET) == 0; }
+  bool seekSet(const size_t pos) { return seek(pos); }
+  bool seekCur(const int64_t offset) { return std::fseek(fp, static_cast<long>(offset), SEEK_CUR) == 0; }
+  int read(void* buf, const size_t count) { return static_cast<int>(std::fread(buf, 1, count, fp)); }
+  size_t write(const void* buf, const size_t count) { return std::fwrite(buf, 1, count, fp); }
+
+  // FAT-encoded modification stamp, as SdFat reports it
+  bool getModifyDateTime(uint16_t* date, uint16_t* time) const {
+    struct stat st {};
+    if (path.empty() || stat(path.c_str(), &st) != 0) return false;
+    std::tm tm{};
+    localtime_r(&st.st_mtime, &tm);
+    *date = static_cast<uint16_t>(((tm.tm_year - 80) << 9) | ((tm.tm_mon + 1) << 5) | tm.tm_mday);
+    *time = static_cast<uint16_t>((tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec / 2));
+    return true;
+  }
+
+  bool isDirectory() const { return dir != nullptr; }
+  void rewindDirectory() {
+    if (dir) rewinddir(dir);
+  }
+  // Next entry of an open directory, skipping "." and ".."; a closed file at the end
+  HalFile openNextFile() {
+    HalFile entry;
+    while (dir) {
+      const dirent* d = readdir(dir);
+      if (!d) break;
+      if (std::strcmp(d->d_name, ".") == 0 || std::strcmp(d->d_name, "..") == 0) continue;
+      entry.open((path + "/" + d->d_name).c_str());
+      break;
+    }
+    return entry;
+  }
+  size_t getName(char* name, const size_t size) const {
+    const size_t slash = path.rfind('/');
+    const std::string base = slash == std::string::npos ? path : path.substr(slash + 1);
+    if (size == 0) return 0;
+    const size_t length = std::min(base.size(), size - 1);
+    std::memcpy(name, base.data(), length);
+    name[length] = '\0';
+    return length;
+  }
+
+  bool close() {
+    if (fp) std::fclose(fp);
+    if (dir) closedir(dir);
+    fp = nullptr;
+    dir = nullptr;
+    path.clear();
+    return true;
+  }
+  operator bool() const { return fp != nullptr || dir != nullptr; }
+
+ private:
+  FILE* fp = nullptr;
+  DIR* dir = nullptr;
+  std::string path;
+
+  bool openFile(const char* filePath, const char* mode) {
+    close();
+    fp = std::fopen(filePath, mode);
+    if (fp) path = filePath;
+    return fp != nullptr;
+  }
+};
+
+class HalStorage {
+ public:
+  HalFile open(const char* path) {
+    HalFile file;
+    file.open(path);
+    return file;
+  }
+  bool openFileForRead(const char*, const std::string& path, HalFile& file) { return file.openForRead(path.c_str()); }
+  bool openFileForWrite(const char*, const std::string& path, HalFile& file) {
+    return file.openForWrite(path.c_str());
+  }
+  bool exists(const char* path) {
+    struct stat st {};
+    return stat(path, &st) == 0;
+  }
+  bool mkdir(const char* path) { return ::mkdir(path, 0755) == 0 || exists(path); }
+  static HalStorage& getInstance() {
+    static HalStorage instance;
+    return instance;
+  }
+};
+
+#define Storage HalStorage::getInstance()
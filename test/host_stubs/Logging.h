@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for lib/Logging/Logging.h
+
+#define LOG_ERR(origin, format, ...)
+#define LOG_INF(origin, format, ...)
+#define LOG_DBG(origin, format, ...)
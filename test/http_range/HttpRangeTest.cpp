@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "lib/HttpRange/HttpRange.h"
+
+using HttpRange::ByteRange;
+using HttpRange::RangeRequest;
+
+using HttpRange::ResumeResponse;
+
+namespace {
+
+// Answers a GET for `body` through the same planResponse() decision
+// HttpFileSender makes, returning the status and filling the Content-Range
+// header and payload the way it writes them.
+int serve(const std::string& body, const char* etag, const char* rangeHeader, const char* ifRange,
+          std::string& contentRange, std::string& payload) {
+  ByteRange range;
+  const RangeRequest request = HttpRange::planResponse(rangeHeader, ifRange, etag, body.size(), range);
+  char buf[64];
+  if (request == RangeRequest::UNSATISFIABLE) {
+    HttpRange::formatUnsatisfiedRange(buf, sizeof(buf), body.size());
+    contentRange = buf;
+    payload.clear();
+    return 416;
+  }
+  if (request == RangeRequest::PARTIAL) {
+    HttpRange::formatContentRange(buf, sizeof(buf), range, body.size());
+    contentRange = buf;
+    payload = body.substr(range.first, range.length());
+    return 206;
+  }
+  contentRange.clear();
+  payload = body;
+  return 200;
+}
+
+}  // namespace
+
+TEST(HttpRangeTest, ParsesClosedRange) {
+  ByteRange r;
+  ASSERT_EQ(HttpRange::parseRangeHeader("bytes=0-499", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.first, 0u);
+  EXPECT_EQ(r.last, 499u);
+  EXPECT_EQ(r.length(), 500u);
+}
+
+TEST(HttpRangeTest, ParsesOpenEndedRange) {
+  ByteRange r;
+  ASSERT_EQ(HttpRange::parseRangeHeader("bytes=900-", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.first, 900u);
+  EXPECT_EQ(r.last, 999u);
+}
+
+TEST(HttpRangeTest, ParsesSuffixRange) {
+  ByteRange r;
+  ASSERT_EQ(HttpRange::parseRangeHeader("bytes=-100", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.first, 900u);
+  EXPECT_EQ(r.last, 999u);
+
+  ASSERT_EQ(HttpRange::parseRangeHeader("bytes=-5000", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.first, 0u);
+  EXPECT_EQ(r.last, 999u);
+}
+
+TEST(HttpRangeTest, ClampsLastBytePastEnd) {
+  ByteRange r;
+  ASSERT_EQ(HttpRange::parseRangeHeader("bytes=10-99999", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.last, 999u);
+}
+
+TEST(HttpRangeTest, AcceptsWhitespaceAndUnitCase) {
+  ByteRange r;
+  ASSERT_EQ(HttpRange::parseRangeHeader(" Bytes = 5 - 9 ", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.first, 5u);
+  EXPECT_EQ(r.last, 9u);
+}
+
+TEST(HttpRangeTest, UnsatisfiableRanges) {
+  ByteRange r;
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=1000-", 1000, r), RangeRequest::UNSATISFIABLE);
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=-0", 1000, r), RangeRequest::UNSATISFIABLE);
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=0-", 0, r), RangeRequest::UNSATISFIABLE);
+}
+
+TEST(HttpRangeTest, IgnoresUnsupportedOrMalformedRanges) {
+  ByteRange r;
+  EXPECT_EQ(HttpRange::parseRangeHeader(nullptr, 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::parseRangeHeader("", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::parseRangeHeader("items=0-5", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=0-5,10-20", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=9-5", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=abc", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=5-x", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::parseRangeHeader("bytes=99999999999999999999999-", 1000, r), RangeRequest::FULL);
+}
+
+TEST(HttpRangeTest, ParsesContentRange) {
+  ByteRange r;
+  size_t total = 0;
+  ASSERT_TRUE(HttpRange::parseContentRange("bytes 200-999/1000", r, total));
+  EXPECT_EQ(r.first, 200u);
+  EXPECT_EQ(r.last, 999u);
+  EXPECT_EQ(total, 1000u);
+
+  EXPECT_FALSE(HttpRange::parseContentRange("bytes 200-999/*", r, total));
+  EXPECT_FALSE(HttpRange::parseContentRange("bytes */1000", r, total));
+  EXPECT_FALSE(HttpRange::parseContentRange("bytes 200-1000/1000", r, total));
+  EXPECT_FALSE(HttpRange::parseContentRange(nullptr, r, total));
+}
+
+TEST(HttpRangeTest, FormatsHeaders) {
+  char buf[64];
+  HttpRange::formatContentRange(buf, sizeof(buf), ByteRange{100, 199}, 1000);
+  EXPECT_STREQ(buf, "bytes 100-199/1000");
+  HttpRange::formatUnsatisfiedRange(buf, sizeof(buf), 1000);
+  EXPECT_STREQ(buf, "bytes */1000");
+  HttpRange::formatEtag(buf, sizeof(buf), 0x1a2b, 0x5a21, 0x6b40);
+  EXPECT_STREQ(buf, "\"1a2b-5a21-6b40\"");
+}
+
+TEST(HttpRangeTest, IfRangeOnlyMatchesCurrentStrongEtag) {
+  EXPECT_TRUE(HttpRange::ifRangeMatches(nullptr, "\"a\""));
+  EXPECT_TRUE(HttpRange::ifRangeMatches("", "\"a\""));
+  EXPECT_TRUE(HttpRange::ifRangeMatches("\"a\"", "\"a\""));
+  EXPECT_TRUE(HttpRange::ifRangeMatches(" \"a\" ", "\"a\""));
+  EXPECT_FALSE(HttpRange::ifRangeMatches("\"b\"", "\"a\""));
+  EXPECT_FALSE(HttpRange::ifRangeMatches("W/\"a\"", "\"a\""));
+  EXPECT_FALSE(HttpRange::ifRangeMatches("Thu, 01 Jan 2024 00:00:00 GMT", "\"a\""));
+}
+
+TEST(HttpRangeTest, PlanResponseHonoursRangeOnlyWithMatchingValidator) {
+  ByteRange r;
+  EXPECT_EQ(HttpRange::planResponse(nullptr, nullptr, "\"a\"", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(r.first, 0u);
+  EXPECT_EQ(r.last, 999u);
+
+  ASSERT_EQ(HttpRange::planResponse("bytes=100-", nullptr, "\"a\"", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.first, 100u);
+  EXPECT_EQ(r.last, 999u);
+  ASSERT_EQ(HttpRange::planResponse("bytes=100-", "\"a\"", "\"a\"", 1000, r), RangeRequest::PARTIAL);
+  EXPECT_EQ(r.first, 100u);
+
+  // Stale If-Range, or no ETag to validate against: whole file
+  EXPECT_EQ(HttpRange::planResponse("bytes=100-", "\"b\"", "\"a\"", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(r.first, 0u);
+  EXPECT_EQ(r.last, 999u);
+  EXPECT_EQ(HttpRange::planResponse("bytes=100-", nullptr, "", 1000, r), RangeRequest::FULL);
+  EXPECT_EQ(HttpRange::planResponse("bytes=100-", nullptr, nullptr, 1000, r), RangeRequest::FULL);
+
+  EXPECT_EQ(HttpRange::planResponse("bytes=1000-", nullptr, "\"a\"", 1000, r), RangeRequest::UNSATISFIABLE);
+}
+
+TEST(HttpRangeTest, ClassifiesResumeResponses) {
+  size_t total = 0;
+  EXPECT_EQ(HttpRange::classifyResumeResponse(0, 200, "", total), ResumeResponse::FULL_BODY);
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1234, 200, "", total), ResumeResponse::FULL_BODY);
+
+  ASSERT_EQ(HttpRange::classifyResumeResponse(1234, 206, "bytes 1234-4999/5000", total), ResumeResponse::APPEND);
+  EXPECT_EQ(total, 5000u);
+
+  // A range that doesn't start where our data ends can't be appended
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1234, 206, "bytes 0-4999/5000", total), ResumeResponse::RANGE_REJECTED);
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1234, 206, "bytes 1234-4999/*", total), ResumeResponse::RANGE_REJECTED);
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1234, 206, "", total), ResumeResponse::RANGE_REJECTED);
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1234, 416, "bytes */1000", total), ResumeResponse::RANGE_REJECTED);
+
+  // 206 to a request without Range, and other statuses, fail the attempt
+  EXPECT_EQ(HttpRange::classifyResumeResponse(0, 206, "bytes 0-9/10", total), ResumeResponse::UNEXPECTED);
+  EXPECT_EQ(HttpRange::classifyResumeResponse(0, 416, "", total), ResumeResponse::UNEXPECTED);
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1234, 404, "", total), ResumeResponse::UNEXPECTED);
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1234, 500, "", total), ResumeResponse::UNEXPECTED);
+}
+
+TEST(HttpRangeTest, ResumesInterruptedTransferAgainstStandInServer) {
+  std::string body;
+  for (int i = 0; i < 5000; i++) body += static_cast<char>('a' + i % 26);
+  char etag[40];
+  HttpRange::formatEtag(etag, sizeof(etag), body.size(), 0x5a21, 0x6b40);
+
+  // First attempt drops after 1234 bytes.
+  std::string contentRange, payload;
+  ASSERT_EQ(serve(body, etag, nullptr, nullptr, contentRange, payload), 200);
+  std::string received = payload.substr(0, 1234);
+
+  // Resume with Range + If-Range, as HttpDownloader does.
+  const std::string rangeHeader = "bytes=" + std::to_string(received.size()) + "-";
+  ASSERT_EQ(serve(body, etag, rangeHeader.c_str(), etag, contentRange, payload), 206);
+  size_t total = 0;
+  ASSERT_EQ(HttpRange::classifyResumeResponse(received.size(), 206, contentRange.c_str(), total),
+            ResumeResponse::APPEND);
+  EXPECT_EQ(total, body.size());
+  received += payload;
+  EXPECT_EQ(received, body);
+}
+
+TEST(HttpRangeTest, ChangedFileRestartsFromZero) {
+  const std::string body(3000, 'x');
+  char oldEtag[40], newEtag[40];
+  HttpRange::formatEtag(oldEtag, sizeof(oldEtag), body.size(), 1, 1);
+  HttpRange::formatEtag(newEtag, sizeof(newEtag), body.size(), 1, 2);
+
+  std::string contentRange, payload;
+  const int status = serve(body, newEtag, "bytes=1000-", oldEtag, contentRange, payload);
+  EXPECT_EQ(status, 200);
+  size_t total = 0;
+  EXPECT_EQ(HttpRange::classifyResumeResponse(1000, status, contentRange.c_str(), total), ResumeResponse::FULL_BODY);
+  EXPECT_EQ(payload.size(), body.size());
+}
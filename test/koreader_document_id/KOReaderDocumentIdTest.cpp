@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "lib/KOReaderSync/KOReaderDocumentId.h"
+
+namespace {
+
+// A scratch library folder: a few books, a non-book and a subfolder
+class KOReaderDocumentIdTest : public ::testing::Test {
+ protected:
+  std::string root;
+  std::string library;
+
+  void SetUp() override {
+    char pattern[] = "/tmp/kodocXXXXXX";
+    ASSERT_NE(mkdtemp(pattern), nullptr);
+    root = pattern;
+    library = root + "/Books";
+    ASSERT_EQ(mkdir(library.c_str(), 0755), 0);
+    ASSERT_EQ(mkdir((library + "/Series").c_str(), 0755), 0);
+    // Large enough to cover several of the sampled offsets (256 B .. 256 KB)
+    writeBook(library + "/alpha.epub", 300 * 1024, 1);
+    writeBook(library + "/beta.epub", 5000, 2);
+    writeBook(library + "/notes.txt", 100, 3);
+  }
+
+  void TearDown() override {
+    const std::string command = "rm -rf '" + root + "'";
+    ASSERT_EQ(std::system(command.c_str()), 0);
+  }
+
+  static void writeBook(const std::string& path, const size_t size, const uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+      data[i] = static_cast<uint8_t>((i * 31 + seed * 7) ^ (i >> 8));
+    }
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(std::fwrite(data.data(), 1, size, f), size);
+    std::fclose(f);
+  }
+
+  // Books get a cache directory per file; everything else is skipped
+  std::string cacheDirFor(const std::string& filePath) const {
+    if (filePath.size() < 5 || filePath.compare(filePath.size() - 5, 5, ".epub") != 0) return "";
+    return root + "/cache_" + filePath.substr(filePath.rfind('/') + 1);
+  }
+
+  std::map<std::string, std::string> hashLibrary(size_t* count = nullptr) {
+    std::map<std::string, std::string> ids;
+    const size_t reported = KOReaderDocumentId::calculateDirectory(
+        library, [this](const std::string& path) { return cacheDirFor(path); },
+        [&ids](const std::string& path, const std::string& id) { ids[path] = id; });
+    if (count) *count = reported;
+    return ids;
+  }
+};
+
+TEST_F(KOReaderDocumentIdTest, FilenameHashIsMd5OfName) {
+  EXPECT_EQ(KOReaderDocumentId::calculateFromFilename("/Books/abc"), "900150983cd24fb0d6963f7d28e17f72");
+}
+
+TEST_F(KOReaderDocumentIdTest, DirectoryMatchesSingleFileIds) {
+  size_t count = 0;
+  const auto ids = hashLibrary(&count);
+
+  EXPECT_EQ(count, 2u);
+  ASSERT_EQ(ids.size(), 2u);
+  const std::string alpha = library + "/alpha.epub";
+  const std::string beta = library + "/beta.epub";
+  ASSERT_TRUE(ids.count(alpha));
+  ASSERT_TRUE(ids.count(beta));
+  EXPECT_EQ(ids.at(alpha), KOReaderDocumentId::calculate(alpha));
+  EXPECT_EQ(ids.at(beta), KOReaderDocumentId::calculate(beta));
+  EXPECT_NE(ids.at(alpha), ids.at(beta));
+  EXPECT_EQ(ids.at(alpha).size(), 32u);
+}
+
+TEST_F(KOReaderDocumentIdTest, DirectorySavesIdsForSingleFileLookups) {
+  const auto ids = hashLibrary();
+  const std::string alpha = library + "/alpha.epub";
+
+  struct stat st {};
+  EXPECT_EQ(stat((cacheDirFor(alpha) + "/koreader_id.bin").c_str(), &st), 0);
+  EXPECT_EQ(KOReaderDocumentId::calculateCached(alpha, cacheDirFor(alpha)), ids.at(alpha));
+}
+
+TEST_F(KOReaderDocumentIdTest, DirectoryReusesCachedIdsWhileStampMatches) {
+  const std::string beta = library + "/beta.epub";
+  const auto first = hashLibrary();
+
+  // Same size and modification time: the saved ID is trusted without rehashing
+  struct stat st {};
+  ASSERT_EQ(stat(beta.c_str(), &st), 0);
+  writeBook(beta, 5000, 9);
+  const utimbuf times{st.st_atime, st.st_mtime};
+  ASSERT_EQ(utime(beta.c_str(), &times), 0);
+  EXPECT_EQ(hashLibrary().at(beta), first.at(beta));
+
+  // A new stamp invalidates it
+  const utimbuf later{st.st_atime, st.st_mtime + 10};
+  ASSERT_EQ(utime(beta.c_str(), &later), 0);
+  const auto rehashed = hashLibrary().at(beta);
+  EXPECT_NE(rehashed, first.at(beta));
+  EXPECT_EQ(rehashed, KOReaderDocumentId::calculate(beta));
+}
+
+TEST_F(KOReaderDocumentIdTest, MissingDirectoryReportsNothing) {
+  bool called = false;
+  EXPECT_EQ(KOReaderDocumentId::calculateDirectory(
+                root + "/missing", [](const std::string&) { return std::string("/tmp"); },
+                [&called](const std::string&, const std::string&) { called = true; }),
+            0u);
+  EXPECT_FALSE(called);
+}
+
+}  // namespace
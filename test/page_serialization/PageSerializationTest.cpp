@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/Page.h"
+
+namespace {
+
+struct Word {
+  std::string text;
+  bool lineEnd;
+  bool operator==(const Word& other) const { return text == other.text && lineEnd == other.lineEnd; }
+};
+
+// Build a line from words laid out 10px apart, all in `style`
+TextBlock* addLine(Page& page, const std::vector<std::string>& words, const int16_t y,
+                   const EpdFontFamily::Style style = EpdFontFamily::REGULAR) {
+  std::vector<int16_t> xpos;
+  for (size_t i = 0; i < words.size(); i++) xpos.push_back(static_cast<int16_t>(i * 10));
+  const std::vector<EpdFontFamily::Style> styles(words.size(), style);
+  TextBlock* block = page.arena.create<TextBlock>(words, xpos, styles, std::vector<uint8_t>{},
+                                                  std::vector<uint16_t>{});
+  EXPECT_NE(block, nullptr);
+  EXPECT_NE(page.addElement<PageLine>(block, 5, y), nullptr);
+  return block;
+}
+
+// A page with every element type between two text lines, footnotes and a prewarm set
+std::unique_ptr<Page> makePage() {
+  auto page = std::unique_ptr<Page>(new Page());
+  addLine(*page, {"It", "was", "the", "best", "of", "times,"}, 20);
+  page->addElement<PageImage>(std::make_shared<ImageBlock>("/images/fig-1.png", 120, 80), 40, 30);
+  page->addElement<PageHorizontalRule>(200, 2, 0, 120);
+  addLine(*page, {"it", "was", "the", "worst", "of", "ti-"}, 140, EpdFontFamily::ITALIC);
+  page->addFootnote("1", "notes.xhtml#n1");
+  page->addFootnote("2", "notes.xhtml#n2");
+  page->glyphSetText = "It wasthebofim,rkc-";
+  page->glyphSetStyleMask = (1 << EpdFontFamily::REGULAR) | (1 << EpdFontFamily::ITALIC);
+  return page;
+}
+
+std::vector<Word> pageWords(const Page& page) {
+  std::vector<Word> words;
+  page.forEachWord([&](const char* word, const uint16_t len, const bool lineEnd) {
+    words.push_back({std::string(word, len), lineEnd});
+    return true;
+  });
+  return words;
+}
+
+std::vector<Word> serializedWords(HalFile& file, const size_t limit = SIZE_MAX) {
+  std::vector<Word> words;
+  EXPECT_TRUE(Page::forEachSerializedWord(file, [&](const char* word, const uint16_t len, const bool lineEnd) {
+    words.push_back({std::string(word, len), lineEnd});
+    return words.size() < limit;
+  }));
+  return words;
+}
+
+void writePage(const Page& page, HalFile& file) {
+  ASSERT_TRUE(file.openTemp());
+  ASSERT_TRUE(page.serialize(file));
+  ASSERT_TRUE(file.seek(0));
+}
+
+TEST(PageSerializationTest, DeserializeRestoresElementsAndFootnotes) {
+  const auto page = makePage();
+  HalFile file;
+  writePage(*page, file);
+
+  const auto restored = Page::deserialize(file);
+  ASSERT_NE(restored, nullptr);
+  ASSERT_EQ(restored->elements.size(), 4u);
+  EXPECT_EQ(restored->elements[0]->getTag(), TAG_PageLine);
+  EXPECT_EQ(restored->elements[1]->getTag(), TAG_PageImage);
+  EXPECT_EQ(restored->elements[2]->getTag(), TAG_PageHorizontalRule);
+  EXPECT_EQ(restored->elements[3]->getTag(), TAG_PageLine);
+  for (size_t i = 0; i < restored->elements.size(); i++) {
+    EXPECT_EQ(restored->elements[i]->xPos, page->elements[i]->xPos);
+    EXPECT_EQ(restored->elements[i]->yPos, page->elements[i]->yPos);
+  }
+
+  const auto& image = static_cast<const PageImage&>(*restored->elements[1]).getImageBlock();
+  EXPECT_EQ(image.getImagePath(), "/images/fig-1.png");
+  EXPECT_EQ(image.getWidth(), 120);
+  EXPECT_EQ(image.getHeight(), 80);
+
+  const TextBlock* italic = static_cast<const PageLine&>(*restored->elements[3]).getBlock();
+  ASSERT_EQ(italic->wordCount(), 6);
+  EXPECT_EQ(italic->wordStyle(3), EpdFontFamily::ITALIC);
+  EXPECT_EQ(italic->wordXpos(3), 30);
+
+  ASSERT_EQ(restored->footnotes.size(), 2u);
+  EXPECT_STREQ(restored->footnotes[1].number, "2");
+  EXPECT_STREQ(restored->footnotes[1].href, "notes.xhtml#n2");
+}
+
+TEST(PageSerializationTest, AllReadersAgreeWithTheWrittenPage) {
+  const auto page = makePage();
+  HalFile file;
+  writePage(*page, file);
+
+  const auto restored = Page::deserialize(file);
+  ASSERT_NE(restored, nullptr);
+
+  ASSERT_TRUE(file.seek(0));
+  std::string glyphSet;
+  uint8_t styleMask = 0;
+  ASSERT_TRUE(Page::readGlyphSet(file, glyphSet, styleMask));
+  EXPECT_EQ(glyphSet, page->glyphSetText);
+  EXPECT_EQ(styleMask, page->glyphSetStyleMask);
+  EXPECT_EQ(restored->glyphSetText, page->glyphSetText);
+  EXPECT_EQ(restored->glyphSetStyleMask, page->glyphSetStyleMask);
+
+  ASSERT_TRUE(file.seek(0));
+  const std::vector<Word> streamed = serializedWords(file);
+  const std::vector<Word> expected = pageWords(*page);
+  ASSERT_EQ(expected.size(), 12u);
+  EXPECT_TRUE(expected[5].lineEnd);
+  EXPECT_EQ(expected[11].text, "ti-");
+  EXPECT_EQ(streamed, expected);
+  EXPECT_EQ(pageWords(*restored), expected);
+}
+
+TEST(PageSerializationTest, WordWalkStopsWhenTheVisitorDoes) {
+  const auto page = makePage();
+  HalFile file;
+  writePage(*page, file);
+
+  const std::vector<Word> streamed = serializedWords(file, 8);
+  const std::vector<Word> expected = pageWords(*page);
+  ASSERT_EQ(streamed.size(), 8u);
+  EXPECT_EQ(streamed, std::vector<Word>(expected.begin(), expected.begin() + 8));
+}
+
+TEST(PageSerializationTest, PageWithoutGlyphSetOrText) {
+  Page page;
+  page.addElement<PageHorizontalRule>(100, 1, 0, 10);
+  HalFile file;
+  writePage(page, file);
+
+  std::string glyphSet = "stale";
+  uint8_t styleMask = 0xFF;
+  ASSERT_TRUE(Page::readGlyphSet(file, glyphSet, styleMask));
+  EXPECT_TRUE(glyphSet.empty());
+  EXPECT_EQ(styleMask, 0);
+
+  ASSERT_TRUE(file.seek(0));
+  EXPECT_TRUE(serializedWords(file).empty());
+
+  ASSERT_TRUE(file.seek(0));
+  const auto restored = Page::deserialize(file);
+  ASSERT_NE(restored, nullptr);
+  EXPECT_EQ(restored->elements.size(), 1u);
+  EXPECT_TRUE(restored->footnotes.empty());
+}
+
+TEST(PageSerializationTest, StreamedWalkCutsOverlongWords) {
+  Page page;
+  const std::string longWord(TextBlock::MAX_STREAMED_WORD_BYTES + 40, 'x');
+  addLine(page, {"before", longWord, "after"}, 20);
+  HalFile file;
+  writePage(page, file);
+
+  const std::vector<Word> streamed = serializedWords(file);
+  ASSERT_EQ(streamed.size(), 3u);
+  EXPECT_EQ(streamed[0].text, "before");
+  EXPECT_EQ(streamed[1].text, longWord.substr(0, TextBlock::MAX_STREAMED_WORD_BYTES));
+  EXPECT_EQ(streamed[2], (Word{"after", true}));
+
+  ASSERT_TRUE(file.seek(0));
+  const auto restored = Page::deserialize(file);
+  ASSERT_NE(restored, nullptr);
+  EXPECT_EQ(pageWords(*restored)[1].text, longWord);
+}
+
+}  // namespace
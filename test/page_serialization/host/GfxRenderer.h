@@ -0,0 +1,27 @@
+#pragma once
+
+// Host stand-in for lib/GfxRenderer/GfxRenderer.h: page and text block rendering
+// compile against it, but the serialization tests never draw.
+
+#include <FontHandle.h>
+
+#include <cstdint>
+
+namespace BidiUtils {
+enum class BidiBaseDir : signed char { AUTO = -1, LTR = 0, RTL = 1 };
+}
+
+class GfxRenderer {
+ public:
+  FontHandle resolveFont(int fontId) const {
+    FontHandle font;
+    font.fontId = fontId;
+    return font;
+  }
+  bool isFontCacheScanning() const { return false; }
+  int getFontAscenderSize(const FontHandle&) const { return 0; }
+  void drawLine(int, int, int, int, int, bool) const {}
+  void drawText(const FontHandle&, int, int, const char*, bool, EpdFontFamily::Style, BidiUtils::BidiBaseDir) const {}
+  int getTextWidth(const FontHandle&, const char*, EpdFontFamily::Style, BidiUtils::BidiBaseDir) const { return 0; }
+  int getTextAdvanceX(const FontHandle&, const char*, EpdFontFamily::Style) const { return 0; }
+};
@@ -0,0 +1,29 @@
+// Host stand-in for lib/Epub/Epub/blocks/ImageBlock.cpp, whose rendering needs the
+// image decoders and the display. The record layout is the device's: a string path
+// and int16 width, height.
+
+#include <Epub/blocks/ImageBlock.h>
+#include <Serialization.h>
+
+ImageBlock::ImageBlock(const std::string& imagePath, int16_t width, int16_t height)
+    : imagePath(imagePath), width(width), height(height) {}
+
+bool ImageBlock::imageExists() const { return false; }
+
+void ImageBlock::render(GfxRenderer&, const int, const int) {}
+
+bool ImageBlock::serialize(HalFile& file) {
+  serialization::writeString(file, imagePath);
+  serialization::writePod(file, width);
+  serialization::writePod(file, height);
+  return true;
+}
+
+std::unique_ptr<ImageBlock> ImageBlock::deserialize(HalFile& file) {
+  std::string path;
+  serialization::readString(file, path);
+  int16_t w, h;
+  serialization::readPod(file, w);
+  serialization::readPod(file, h);
+  return std::unique_ptr<ImageBlock>(new ImageBlock(path, w, h));
+}
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+#include "lib/Epub/Epub/ParagraphXPathMap.h"
+
+namespace {
+
+using Kind = ParagraphXPathMap::Kind;
+
+// Drives the builder the way ChapterHtmlSlimParser does, with a made-up byte
+// offset per start tag
+class Document {
+ public:
+  ParagraphXPathMapBuilder builder;
+
+  void open(const char* name) {
+    builder.pushElement(name);
+    offset += 10;
+  }
+  void paragraph(const Kind kind, const char* name) {
+    builder.pushElement(name);
+    builder.recordCurrent(kind, offset);
+    offset += 10;
+  }
+  void text(const char* s) {
+    builder.addText(s, static_cast<int>(std::strlen(s)));
+    offset += std::strlen(s);
+  }
+  void close() { builder.popElement(); }
+  uint32_t position() const { return offset; }
+
+  // Serialize behind a one-byte prefix (offset 0 means "no map") and load it back
+  bool load(ParagraphXPathMap& map, const uint32_t htmlBytes, const uint32_t parsedBytes) {
+    HalFile file;
+    if (!file.openTemp()) return false;
+    const uint8_t header = 0;
+    file.write(&header, 1);
+    if (!builder.serialize(file, htmlBytes, parsedBytes) || !file.seek(0)) return false;
+    return map.load(std::move(file), 1);
+  }
+
+ private:
+  uint32_t offset = 0;
+};
+
+// <html><head><title>T</title><style>p{}</style></head><body>
+//   <h1>Title</h1>
+//   <div><p>One</p><p>Two</p></div>
+//   <div><section><p>Три</p><ul><li>a</li><li>b</li></ul></section></div>
+// </body></html>
+void buildChapter(Document& doc) {
+  doc.open("html");
+  doc.open("head");
+  doc.open("title");
+  doc.text("T");
+  doc.close();
+  doc.open("style");
+  doc.text("p{}");
+  doc.close();
+  doc.close();
+  doc.open("body");
+  doc.open("h1");
+  doc.text("Title");
+  doc.close();
+  doc.open("div");
+  doc.paragraph(Kind::Paragraph, "p");
+  doc.text("One");
+  doc.close();
+  doc.paragraph(Kind::Paragraph, "p");
+  doc.text("Two");
+  doc.close();
+  doc.close();
+  doc.open("div");
+  doc.open("section");
+  doc.paragraph(Kind::Paragraph, "p");
+  doc.text("Три");
+  doc.close();
+  doc.open("ul");
+  doc.paragraph(Kind::ListItem, "li");
+  doc.text("a");
+  doc.close();
+  doc.paragraph(Kind::ListItem, "li");
+  doc.text("b");
+  doc.close();
+  doc.close();
+  doc.close();
+  doc.close();
+  doc.close();
+  doc.close();
+}
+
+TEST(ParagraphXPathMapTest, XPathsUseParentPathsAndSiblingIndices) {
+  Document doc;
+  buildChapter(doc);
+  ParagraphXPathMap map;
+  ASSERT_TRUE(doc.load(map, doc.position(), doc.position()));
+
+  ASSERT_EQ(map.count(Kind::Paragraph), 3);
+  ASSERT_EQ(map.count(Kind::ListItem), 2);
+  EXPECT_EQ(map.xpathFor(Kind::Paragraph, 1, 4), "/body/DocFragment[5]/body/div[1]/p[1]");
+  EXPECT_EQ(map.xpathFor(Kind::Paragraph, 2, 4), "/body/DocFragment[5]/body/div[1]/p[2]");
+  EXPECT_EQ(map.xpathFor(Kind::Paragraph, 3, 4), "/body/DocFragment[5]/body/div[2]/section[1]/p[1]");
+  EXPECT_EQ(map.xpathFor(Kind::ListItem, 2, 0), "/body/DocFragment[1]/body/div[2]/section[1]/ul[1]/li[2]");
+  EXPECT_EQ(map.xpathFor(Kind::Paragraph, 4, 4), "");
+  EXPECT_EQ(map.xpathFor(Kind::Paragraph, 0, 4), "");
+}
+
+TEST(ParagraphXPathMapTest, FindsElementsByParentPath) {
+  Document doc;
+  buildChapter(doc);
+  ParagraphXPathMap map;
+  ASSERT_TRUE(doc.load(map, doc.position(), doc.position()));
+
+  ParagraphXPathMap::Entry entry{};
+  EXPECT_EQ(map.find(Kind::Paragraph, "/div[1]", 2, entry), 2);
+  // Both paragraphs of the first div share one dictionary path
+  ParagraphXPathMap::Entry first{};
+  ASSERT_TRUE(map.readEntry(Kind::Paragraph, 1, first));
+  EXPECT_EQ(first.pathId, entry.pathId);
+  EXPECT_EQ(map.find(Kind::Paragraph, "/div[2]/section[1]", 1, entry), 3);
+  EXPECT_EQ(map.find(Kind::ListItem, "/div[2]/section[1]/ul[1]", 1, entry), 1);
+  EXPECT_EQ(map.find(Kind::Paragraph, "/div[3]", 1, entry), 0);
+  EXPECT_EQ(map.find(Kind::Paragraph, "/div[1]", 3, entry), 0);
+}
+
+TEST(ParagraphXPathMapTest, CountsVisibleCodepointsOutsideHeadAndStyle) {
+  Document doc;
+  buildChapter(doc);
+  ParagraphXPathMap map;
+  ASSERT_TRUE(doc.load(map, doc.position(), doc.position()));
+
+  // "Title" + "One" + "Two" + "Три" (three codepoints) + "a" + "b"; <title> and <style> text isn't visible
+  EXPECT_EQ(map.htmlVisibleChars(), 16u);
+  ParagraphXPathMap::Entry entry{};
+  ASSERT_TRUE(map.readEntry(Kind::Paragraph, 1, entry));
+  EXPECT_EQ(entry.visibleChars, 5u);
+  ASSERT_TRUE(map.readEntry(Kind::Paragraph, 3, entry));
+  EXPECT_EQ(entry.visibleChars, 11u);
+  ASSERT_TRUE(map.readEntry(Kind::ListItem, 2, entry));
+  EXPECT_EQ(entry.visibleChars, 15u);
+}
+
+TEST(ParagraphXPathMapTest, CountAtOffsetFollowsStartTags) {
+  Document doc;
+  buildChapter(doc);
+  ParagraphXPathMap map;
+  ASSERT_TRUE(doc.load(map, doc.position(), doc.position()));
+
+  ParagraphXPathMap::Entry second{};
+  ASSERT_TRUE(map.readEntry(Kind::Paragraph, 2, second));
+  EXPECT_EQ(map.countAtOffset(Kind::Paragraph, 0), 0);
+  EXPECT_EQ(map.countAtOffset(Kind::Paragraph, second.byteOffset - 1), 1);
+  EXPECT_EQ(map.countAtOffset(Kind::Paragraph, second.byteOffset), 2);
+  EXPECT_EQ(map.countAtOffset(Kind::Paragraph, doc.position()), 3);
+  EXPECT_EQ(map.mappedBytes(), doc.position());
+}
+
+TEST(ParagraphXPathMapTest, NamespacedElementsUseTheirLocalName) {
+  Document doc;
+  doc.open("html:html");
+  doc.open("html:body");
+  doc.open("html:div");
+  doc.paragraph(Kind::Paragraph, "html:p");
+  doc.close();
+  doc.close();
+  doc.close();
+  doc.close();
+  ParagraphXPathMap map;
+  ASSERT_TRUE(doc.load(map, doc.position(), doc.position()));
+  EXPECT_EQ(map.xpathFor(Kind::Paragraph, 1, 0), "/body/DocFragment[1]/body/div[1]/p[1]");
+}
+
+TEST(ParagraphXPathMapTest, PartialMapCoversOnlyParsedBytes) {
+  Document doc;
+  doc.open("html");
+  doc.open("body");
+  doc.paragraph(Kind::Paragraph, "p");
+  doc.text("Parsed so far");
+  const uint32_t parsed = doc.position();
+  ParagraphXPathMap map;
+  ASSERT_TRUE(doc.load(map, parsed * 4, parsed));
+
+  EXPECT_EQ(map.htmlBytes(), parsed * 4);
+  EXPECT_EQ(map.mappedBytes(), parsed);
+  EXPECT_EQ(map.htmlVisibleChars(), 0u);
+  EXPECT_EQ(map.count(Kind::Paragraph), 1);
+}
+
+TEST(ParagraphXPathMapTest, TruncatedMapEndsAtFirstDroppedElement) {
+  Document doc;
+  doc.open("html");
+  doc.open("body");
+  uint32_t firstDropped = 0;
+  for (size_t i = 0; i < ParagraphXPathMapBuilder::MAX_ENTRIES + 3; i++) {
+    if (i == ParagraphXPathMapBuilder::MAX_ENTRIES) firstDropped = doc.position();
+    doc.paragraph(Kind::Paragraph, "p");
+    doc.text("x");
+    doc.close();
+  }
+  doc.paragraph(Kind::ListItem, "li");
+  doc.close();
+  ParagraphXPathMap map;
+  ASSERT_TRUE(doc.load(map, doc.position(), doc.position()));
+
+  EXPECT_EQ(map.count(Kind::Paragraph), ParagraphXPathMapBuilder::MAX_ENTRIES);
+  EXPECT_EQ(map.count(Kind::ListItem), 1);
+  EXPECT_EQ(map.mappedBytes(), firstDropped);
+  EXPECT_EQ(map.htmlBytes(), doc.position());
+  EXPECT_EQ(map.xpathFor(Kind::Paragraph, ParagraphXPathMapBuilder::MAX_ENTRIES, 0),
+            "/body/DocFragment[1]/body/p[" + std::to_string(ParagraphXPathMapBuilder::MAX_ENTRIES) + "]");
+}
+
+}  // namespace
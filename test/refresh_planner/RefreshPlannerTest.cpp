@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "RefreshPlanner.h"
+
+namespace {
+
+constexpr uint16_t kWidthBytes = 100;  // 800 px
+constexpr uint16_t kRows = 480;
+
+using Action = RefreshPlanner::Action;
+
+std::vector<uint8_t> whiteFrame() { return std::vector<uint8_t>(static_cast<size_t>(kWidthBytes) * kRows, 0xFF); }
+
+// Sparse ink, roughly what a line of text leaves behind
+void drawText(std::vector<uint8_t>& frame, const uint16_t firstRow, const uint16_t lastRow, const uint8_t pattern) {
+  for (uint16_t row = firstRow; row <= lastRow; row++) {
+    for (uint16_t col = 0; col < kWidthBytes; col += 4) {
+      frame[static_cast<size_t>(row) * kWidthBytes + col] = pattern;
+    }
+  }
+}
+
+void fillBlack(std::vector<uint8_t>& frame, const uint16_t firstRow, const uint16_t lastRow) {
+  memset(frame.data() + static_cast<size_t>(firstRow) * kWidthBytes, 0x00,
+         static_cast<size_t>(lastRow - firstRow + 1) * kWidthBytes);
+}
+
+class RefreshPlannerTest : public ::testing::Test {
+ protected:
+  RefreshPlanner planner;
+
+  void SetUp() override { ASSERT_TRUE(planner.begin(kWidthBytes, kRows)); }
+};
+
+}  // namespace
+
+TEST_F(RefreshPlannerTest, FirstFrameHasNoBaseline) {
+  auto frame = whiteFrame();
+  drawText(frame, 10, 20, 0xF0);
+
+  const auto plan = planner.plan(frame.data(), false);
+  EXPECT_EQ(plan.action, Action::Fast);
+  EXPECT_EQ(plan.firstRow, 0);
+  EXPECT_EQ(plan.lastRow, kRows - 1);
+}
+
+TEST_F(RefreshPlannerTest, UnchangedFrameIsSkipped) {
+  auto frame = whiteFrame();
+  drawText(frame, 10, 20, 0xF0);
+  planner.plan(frame.data(), false);
+  planner.commitPlan();
+
+  EXPECT_EQ(planner.plan(frame.data(), false).action, Action::Skip);
+  // Skip wins even when the cadence is due: there is nothing to clean up on this frame
+  EXPECT_EQ(planner.plan(frame.data(), true).action, Action::Skip);
+  EXPECT_EQ(planner.getStats().skipped, 2u);
+}
+
+TEST_F(RefreshPlannerTest, NarrowChangeIsWindowed) {
+  auto frame = whiteFrame();
+  drawText(frame, 100, 300, 0xF0);
+  planner.commit(frame.data());
+
+  drawText(frame, 450, 460, 0x0F);
+  const auto plan = planner.plan(frame.data(), false);
+  EXPECT_EQ(plan.action, Action::Window);
+  EXPECT_EQ(plan.firstRow, 450);
+  EXPECT_EQ(plan.lastRow, 460);
+  EXPECT_EQ(plan.changedRows, 11);
+}
+
+TEST_F(RefreshPlannerTest, NarrowChangeIsFastWithoutWindowSupport) {
+  auto frame = whiteFrame();
+  planner.commit(frame.data());
+
+  drawText(frame, 450, 460, 0x0F);
+  const auto plan = planner.plan(frame.data(), false, false);
+  EXPECT_EQ(plan.action, Action::Fast);
+  EXPECT_EQ(planner.getStats().windowed, 0u);
+  EXPECT_EQ(planner.getStats().fast, 1u);
+}
+
+TEST_F(RefreshPlannerTest, PageTurnIsFast) {
+  auto frame = whiteFrame();
+  drawText(frame, 0, kRows - 1, 0xF0);
+  planner.commit(frame.data());
+
+  drawText(frame, 0, kRows - 1, 0x3C);
+  const auto plan = planner.plan(frame.data(), false);
+  EXPECT_EQ(plan.action, Action::Fast);
+  EXPECT_LT(plan.inkPermille, RefreshPlanner::HEAVY_INK_PERMILLE);
+}
+
+TEST_F(RefreshPlannerTest, DenseInkForcesHalf) {
+  auto frame = whiteFrame();
+  planner.commit(frame.data());
+
+  fillBlack(frame, 0, kRows / 2);
+  const auto plan = planner.plan(frame.data(), false);
+  EXPECT_EQ(plan.action, Action::Half);
+  EXPECT_GE(plan.inkPermille, RefreshPlanner::HEAVY_INK_PERMILLE);
+  EXPECT_EQ(planner.getStats().heavyInk, 1u);
+}
+
+TEST_F(RefreshPlannerTest, DueCadenceForcesHalf) {
+  auto frame = whiteFrame();
+  planner.commit(frame.data());
+
+  drawText(frame, 450, 460, 0x0F);
+  EXPECT_EQ(planner.plan(frame.data(), true).action, Action::Half);
+  EXPECT_EQ(planner.getStats().heavyInk, 0u);
+}
+
+TEST_F(RefreshPlannerTest, UncommittedPlanKeepsBaseline) {
+  auto frame = whiteFrame();
+  planner.commit(frame.data());
+
+  auto next = frame;
+  drawText(next, 450, 460, 0x0F);
+  planner.plan(next.data(), false);
+  // Not sent to the panel: the baseline is still the blank frame
+  EXPECT_EQ(planner.plan(frame.data(), false).action, Action::Skip);
+}
+
+TEST_F(RefreshPlannerTest, InvalidateDropsBaseline) {
+  auto frame = whiteFrame();
+  planner.commit(frame.data());
+  planner.invalidate();
+
+  EXPECT_EQ(planner.plan(frame.data(), false).action, Action::Fast);
+}
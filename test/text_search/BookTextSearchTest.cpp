@@ -0,0 +1,367 @@
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Epub.h"
+#include "Epub/Section.h"
+#include "Epub/search/BookTextSearch.h"
+#include "GfxRenderer.h"
+
+namespace {
+
+// A chapter as the layout leaves it: pages of lines of words
+using Line = std::vector<std::string>;
+using Pages = std::vector<std::vector<Line>>;
+
+std::unique_ptr<Page> makePage(const std::vector<Line>& lines) {
+  auto page = std::unique_ptr<Page>(new Page());
+  int16_t y = 0;
+  for (const auto& words : lines) {
+    std::vector<int16_t> xpos;
+    for (size_t i = 0; i < words.size(); i++) xpos.push_back(static_cast<int16_t>(i * 10));
+    const std::vector<EpdFontFamily::Style> styles(words.size(), EpdFontFamily::REGULAR);
+    TextBlock* block =
+        page->arena.create<TextBlock>(words, xpos, styles, std::vector<uint8_t>{}, std::vector<uint16_t>{});
+    EXPECT_NE(block, nullptr);
+    EXPECT_NE(page->addElement<PageLine>(block, 0, y), nullptr);
+    y = static_cast<int16_t>(y + 20);
+  }
+  return page;
+}
+
+// A book whose chapters are XHTML, some of them also laid out into section pages
+class BookTextSearchTest : public ::testing::Test {
+ protected:
+  std::string cacheDir;
+  GfxRenderer renderer;
+  std::shared_ptr<Epub> epub;
+  // Laid-out pages per spine item, handed to the section on load
+  std::map<int, std::vector<std::unique_ptr<Page>>> layouts;
+  std::set<int> partialSections;
+
+  void SetUp() override {
+    char pattern[] = "/tmp/booksearchXXXXXX";
+    ASSERT_NE(mkdtemp(pattern), nullptr);
+    cacheDir = pattern;
+  }
+
+  void TearDown() override {
+    const std::string command = "rm -rf '" + cacheDir + "'";
+    ASSERT_EQ(std::system(command.c_str()), 0);
+  }
+
+  void makeBook(std::vector<std::string> chapters) { epub = std::make_shared<Epub>(cacheDir, std::move(chapters)); }
+
+  void layOut(const int spineIndex, const Pages& pages) {
+    auto& section = layouts[spineIndex];
+    section.clear();
+    for (const auto& lines : pages) section.push_back(makePage(lines));
+  }
+
+  // Stand-in for the reader's loader: only chapters laid out above have a section
+  BookTextSearch::SectionLoader loader() {
+    return [this](Section& section) {
+      const auto it = layouts.find(section.spineIndex);
+      if (it == layouts.end()) return false;
+      section.pages = std::move(it->second);
+      layouts.erase(it);
+      section.pageCount = static_cast<uint16_t>(section.pages.size());
+      section.partial = partialSections.count(section.spineIndex) > 0;
+      return true;
+    };
+  }
+
+  // Run a whole search one unit of work per step, as a loop() with no time to spare would
+  std::vector<BookTextSearch::Hit> search(const std::string& query, int* steps = nullptr) {
+    BookTextSearch searcher(epub, renderer, loader());
+    EXPECT_TRUE(searcher.begin(query));
+    int count = 0;
+    while (searcher.step(0)) count++;
+    EXPECT_TRUE(searcher.isDone());
+    EXPECT_EQ(searcher.getSpinesScanned(), epub->getSpineItemsCount());
+    if (steps) *steps = count;
+    return searcher.getHits();
+  }
+
+  void writeHtmlCache(const int spineIndex, const std::string& xhtml) const {
+    const std::string dir = cacheDir + "/html";
+    mkdir(dir.c_str(), 0755);
+    FILE* f = std::fopen((dir + "/" + std::to_string(spineIndex) + ".html").c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(std::fwrite(xhtml.data(), 1, xhtml.size(), f), xhtml.size());
+    std::fclose(f);
+  }
+
+  // Hits from chapter 0 scanned from its XHTML, streamed `chunk` bytes at a time
+  size_t xhtmlHits(const std::string& xhtml, const std::string& query, const size_t chunk = 0) {
+    makeBook({xhtml});
+    epub->streamChunk = chunk;
+    const auto hits = search(query);
+    EXPECT_EQ(epub->itemsStreamed, 1);
+    return hits.size();
+  }
+};
+
+// --- Laid-out chapters: page by page from the section ---
+
+TEST_F(BookTextSearchTest, HitsCarryPageAndPageCount) {
+  makeBook({"", ""});
+  layOut(0, {{{"The", "quiet", "harbour"}}, {{"nothing", "here"}}, {{"an", "old"}, {"Quiet", "Harbour."}}});
+  layOut(1, {{{"no", "match"}}});
+
+  const auto hits = search("quiet harbour");
+
+  ASSERT_EQ(hits.size(), 2u);
+  EXPECT_EQ(hits[0].spineIndex, 0);
+  EXPECT_EQ(hits[0].page, 0);
+  EXPECT_EQ(hits[0].pageCount, 3);
+  EXPECT_EQ(hits[0].snippet, "The quiet harbour");
+  EXPECT_EQ(hits[1].page, 2);
+  EXPECT_EQ(hits[1].snippet, "Quiet Harbour.");
+  EXPECT_EQ(epub->itemsStreamed, 0);
+}
+
+TEST_F(BookTextSearchTest, OneHitPerPageWithTheFirstMatchingLine) {
+  makeBook({""});
+  layOut(0, {{{"a", "bell"}, {"the", "bell", "rang"}, {"bell", "again"}}});
+
+  const auto hits = search("bell");
+
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits[0].snippet, "a bell");
+}
+
+TEST_F(BookTextSearchTest, MatchesAcrossLinesAndPages) {
+  makeBook({""});
+  // A word the layout hyphenated at a line end, then a phrase split over a page turn
+  layOut(0, {{{"the", "light-"}, {"keeper", "was", "quiet"}}, {{"harbour", "lights"}}});
+
+  auto hits = search("lightkeeper");
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits[0].page, 0);
+
+  layOut(0, {{{"the", "light-"}, {"keeper", "was", "quiet"}}, {{"harbour", "lights"}}});
+  hits = search("quiet harbour");
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits[0].page, 1);
+}
+
+TEST_F(BookTextSearchTest, DoesNotMatchAcrossChapters) {
+  makeBook({"", ""});
+  layOut(0, {{{"the", "quiet"}}});
+  layOut(1, {{{"harbour", "again"}}});
+
+  EXPECT_TRUE(search("quiet harbour").empty());
+}
+
+TEST_F(BookTextSearchTest, PartialAndMissingSectionsFallBackToXhtml) {
+  makeBook({"", "<p>the quiet harbour</p>", "<p>a quiet harbour</p>"});
+  layOut(0, {{{"quiet", "harbour"}}});
+  layOut(1, {{{"quiet", "harbour"}}});
+  partialSections.insert(1);
+
+  const auto hits = search("quiet harbour");
+
+  ASSERT_EQ(hits.size(), 3u);
+  EXPECT_EQ(hits[0].page, 0);
+  for (const int i : {1, 2}) {
+    EXPECT_EQ(hits[i].spineIndex, i);
+    EXPECT_EQ(hits[i].page, -1);
+    EXPECT_EQ(hits[i].pageCount, 0);
+    EXPECT_GT(hits[i].spineProgress, 0.0f);
+    EXPECT_LE(hits[i].spineProgress, 1.0f);
+  }
+  EXPECT_EQ(epub->itemsStreamed, 2);
+}
+
+TEST_F(BookTextSearchTest, StopsAtMaxHits) {
+  makeBook({"", "<p>bell</p>"});
+  layOut(0, Pages(BookTextSearch::MAX_HITS + 20, {{"a", "bell"}}));
+
+  BookTextSearch searcher(epub, renderer, loader());
+  ASSERT_TRUE(searcher.begin("bell"));
+  while (searcher.step(0)) {
+  }
+
+  const auto& hits = searcher.getHits();
+  EXPECT_EQ(hits.size(), BookTextSearch::MAX_HITS);
+  EXPECT_EQ(hits.back().page, static_cast<int16_t>(BookTextSearch::MAX_HITS - 1));
+  // The rest of the book is left unscanned
+  EXPECT_EQ(searcher.getSpinesScanned(), 1);
+  EXPECT_EQ(epub->itemsStreamed, 0);
+}
+
+TEST_F(BookTextSearchTest, SlicedStepsFindWhatOneLongStepFinds) {
+  const Pages pages(10, {{"the", "bell"}, {"rang"}});
+  makeBook({"", "<p>bell</p>"});
+  layOut(0, pages);
+  int steps = 0;
+  const auto sliced = search("bell", &steps);
+
+  layOut(0, pages);
+  BookTextSearch searcher(epub, renderer, loader());
+  ASSERT_TRUE(searcher.begin("bell"));
+  EXPECT_FALSE(searcher.step(60 * 1000));
+  const auto& whole = searcher.getHits();
+
+  // One step opens a chapter or scans a few pages, so ten pages take several
+  EXPECT_GT(steps, 3);
+  ASSERT_EQ(sliced.size(), 11u);
+  ASSERT_EQ(whole.size(), sliced.size());
+  for (size_t i = 0; i < whole.size(); i++) {
+    EXPECT_EQ(whole[i].spineIndex, sliced[i].spineIndex);
+    EXPECT_EQ(whole[i].page, sliced[i].page);
+  }
+}
+
+TEST_F(BookTextSearchTest, RejectsUnusableQuery) {
+  makeBook({"<p>text</p>"});
+  BookTextSearch searcher(epub, renderer, loader());
+  EXPECT_FALSE(searcher.begin("   "));
+  EXPECT_TRUE(searcher.isDone());
+  EXPECT_FALSE(searcher.step(0));
+}
+
+// --- Chapters without a section: the XHTML tag and entity stripper ---
+
+TEST_F(BookTextSearchTest, XhtmlDecodesEntities) {
+  EXPECT_EQ(xhtmlHits("<p>le caf&eacute;, le caf&#233;, le caf&#xE9;</p>", "caf\xC3\xA9"), 1u);
+  EXPECT_EQ(xhtmlHits("<p>caf&eacute;</p><p>caf&#233;</p><p>caf&#xE9;</p>", "caf\xC3\xA9"), 3u);
+  EXPECT_EQ(xhtmlHits("<p>salt &amp; pepper</p>", "salt & pepper"), 1u);
+  EXPECT_EQ(xhtmlHits("<p>don&rsquo;t</p>", "don't"), 1u);
+  // Unknown entities and bare ampersands stay as written
+  EXPECT_EQ(xhtmlHits("<p>a &bogus; b</p>", "&bogus;"), 1u);
+  EXPECT_EQ(xhtmlHits("<p>salt & pepper</p>", "salt & pepper"), 1u);
+}
+
+TEST_F(BookTextSearchTest, XhtmlSkipsHeadScriptAndStyle) {
+  const std::string xhtml =
+      "<html><head><title>bell</title><style>p.bell { color: red }</style></head><body>"
+      "<script type=\"text/javascript\">var bell = 1;</script><script src=\"bell.js\"/>"
+      "<p>the bell</p></body></html>";
+  EXPECT_EQ(xhtmlHits(xhtml, "bell"), 1u);
+  EXPECT_EQ(xhtmlHits(xhtml, "color"), 0u);
+  EXPECT_EQ(xhtmlHits(xhtml, "var"), 0u);
+}
+
+TEST_F(BookTextSearchTest, XhtmlBlockTagsSeparateWordsAndInlineTagsDoNot) {
+  EXPECT_EQ(xhtmlHits("<p>quiet</p><p>harbour</p>", "quiet harbour"), 1u);
+  EXPECT_EQ(xhtmlHits("<p>light<em>keeper</em></p>", "lightkeeper"), 1u);
+  EXPECT_EQ(xhtmlHits("<p>light<br/>keeper</p>", "lightkeeper"), 0u);
+  EXPECT_EQ(xhtmlHits("<div>light</div><div>keeper</div>", "lightkeeper"), 0u);
+}
+
+TEST_F(BookTextSearchTest, XhtmlTagsAndEntitiesSplitAcrossChunks) {
+  const std::string xhtml =
+      "<p class=\"a>b\" id='c'>The <em data-x=\"<quiet>\">qui</em>et har&shy;bour, caf&eacute; "
+      "\xD0\x9C\xD0\xB8\xD1\x80</p><p>quiet HARBOUR, CAF\xC3\x89 \xD0\xBC\xD0\xB8\xD1\x80</p>";
+  for (const size_t chunk : {1, 2, 3, 5, 7, 64}) {
+    SCOPED_TRACE(chunk);
+    EXPECT_EQ(xhtmlHits(xhtml, "quiet harbour, caf\xC3\xA9 \xD0\xBC\xD0\xB8\xD1\x80", chunk), 2u);
+    EXPECT_EQ(xhtmlHits(xhtml, "quiet>", chunk), 0u);
+  }
+}
+
+TEST_F(BookTextSearchTest, XhtmlSnippetIsTheMatchingBlock) {
+  makeBook({"<p>first block</p><p>It was a quiet harbour at dusk</p>"});
+  const auto hits = search("quiet harbour");
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits[0].snippet, "It was a quiet harbour at dusk");
+}
+
+TEST_F(BookTextSearchTest, XhtmlReadsTheHtmlCacheInSlices) {
+  // A match straddling the first read of the cached file
+  std::string xhtml = "<p>";
+  while (xhtml.size() < 500) xhtml += "hay hay ";
+  xhtml += "quiet harbour</p>";
+  makeBook({"<p>not read</p>"});
+  writeHtmlCache(0, xhtml);
+
+  const auto hits = search("quiet harbour");
+
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits[0].page, -1);
+  EXPECT_GT(hits[0].spineProgress, 0.9f);
+  EXPECT_EQ(epub->itemsStreamed, 0);
+}
+
+// --- Benchmark ---
+
+// Deterministic stand-in for a novel: sentences of words drawn from a small
+// vocabulary, capitalized at sentence starts, laid out ten words to a line and
+// thirty lines to a page, fifty pages to a chapter.
+std::vector<Pages> makeNovel(const size_t targetBytes) {
+  static const char* const VOCAB[] = {
+      "the",    "harbour", "quiet", "lantern", "sea",    "of",     "and",     "she",    "was",     "a",
+      "light",  "keeper",  "night", "storm",   "waves",  "across", "through", "old",    "village", "boats",
+      "morning", "fog",    "rope",  "captain", "letter", "window", "shadow",  "silent", "distant", "bell"};
+  constexpr size_t VOCAB_SIZE = sizeof(VOCAB) / sizeof(VOCAB[0]);
+  constexpr size_t WORDS_PER_LINE = 10;
+  constexpr size_t LINES_PER_PAGE = 30;
+  constexpr size_t PAGES_PER_CHAPTER = 50;
+
+  std::vector<Pages> chapters;
+  uint32_t seed = 12345;
+  size_t bytes = 0;
+  bool sentenceStart = true;
+  while (bytes < targetBytes) {
+    if (chapters.empty() || chapters.back().size() == PAGES_PER_CHAPTER) chapters.emplace_back();
+    auto& pages = chapters.back();
+    if (pages.empty() || pages.back().size() == LINES_PER_PAGE) pages.emplace_back();
+    auto& lines = pages.back();
+    lines.emplace_back();
+    while (lines.back().size() < WORDS_PER_LINE) {
+      seed = seed * 1103515245u + 12345u;
+      std::string word = VOCAB[(seed >> 16) % VOCAB_SIZE];
+      if (sentenceStart) word[0] = static_cast<char>(word[0] - 'a' + 'A');
+      sentenceStart = ((seed >> 8) % 11) == 0;
+      if (sentenceStart) word += '.';
+      bytes += word.size() + 1;
+      lines.back().push_back(std::move(word));
+    }
+  }
+  return chapters;
+}
+
+// Walks the pages of a ~4 MB laid-out novel through BookTextSearch, as the reader
+// does for chapters with a section cache, and reports throughput. The section file
+// reads are left out: pages come from memory. The only hit is planted on the last
+// page, so every page is scanned.
+TEST_F(BookTextSearchTest, BenchmarkPageWalk) {
+  auto chapters = makeNovel(4 * 1024 * 1024);
+  chapters.back().back().push_back({"a", "distant", "light-"});
+  chapters.back().back().push_back({"house", "keeper."});
+
+  size_t pageCount = 0;
+  size_t wordCount = 0;
+  for (size_t i = 0; i < chapters.size(); i++) {
+    for (const auto& lines : chapters[i]) {
+      for (const auto& line : lines) wordCount += line.size();
+    }
+    pageCount += chapters[i].size();
+    layOut(static_cast<int>(i), chapters[i]);
+  }
+  makeBook(std::vector<std::string>(chapters.size()));
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto hits = search("Lighthouse Keeper");
+  const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits[0].spineIndex, static_cast<int16_t>(chapters.size() - 1));
+  EXPECT_EQ(hits[0].page, static_cast<int16_t>(chapters.back().size() - 1));
+  EXPECT_EQ(epub->itemsStreamed, 0);
+  std::printf("[ BENCH    ] %zu chapters, %zu pages, %zu words in %.1f ms (%.0f pages/s), %zu hits\n",
+              chapters.size(), pageCount, wordCount, elapsed * 1000.0, pageCount / elapsed, hits.size());
+}
+
+}  // namespace
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+#include "Epub/search/TextMatcher.h"
+
+namespace {
+
+int feedAll(TextMatcher& matcher, const std::string& text) { return matcher.feed(text.data(), text.size()); }
+
+// Feed one byte at a time, so every multi-byte codepoint and every match is split
+int feedBytewise(TextMatcher& matcher, const std::string& text) {
+  int found = 0;
+  for (const char c : text) {
+    found += matcher.feed(&c, 1);
+  }
+  return found;
+}
+
+}  // namespace
+
+TEST(TextMatcherTest, RejectsEmptyAndOversizedPatterns) {
+  TextMatcher matcher;
+  EXPECT_FALSE(matcher.setPattern(""));
+  EXPECT_FALSE(matcher.setPattern("   "));
+  EXPECT_FALSE(matcher.setPattern(std::string(TextMatcher::MAX_PATTERN_BYTES + 1, 'x').c_str()));
+  EXPECT_TRUE(matcher.setPattern(std::string(TextMatcher::MAX_PATTERN_BYTES, 'x').c_str()));
+  EXPECT_TRUE(matcher.setPattern("  word  "));
+  EXPECT_EQ(feedAll(matcher, "a word here"), 1);
+}
+
+TEST(TextMatcherTest, FoldsLatinCase) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("Caf\xC3\x89"));  // CAFÉ with uppercase É
+  EXPECT_EQ(feedAll(matcher, "le caf\xC3\xA9 et le CAF\xC3\x89"), 2);
+}
+
+TEST(TextMatcherTest, FoldsCyrillicCase) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("\xD0\xBC\xD0\xB8\xD1\x80"));  // "мир"
+  // "Мир" and "МИР"
+  EXPECT_EQ(feedAll(matcher, "\xD0\x9C\xD0\xB8\xD1\x80, \xD0\x9C\xD0\x98\xD0\xA0!"), 2);
+}
+
+TEST(TextMatcherTest, CollapsesWhitespaceAndIgnoresSoftHyphens) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("light  keeper"));
+  EXPECT_EQ(feedAll(matcher, "the light\n\t keeper"), 1);
+  EXPECT_EQ(feedAll(matcher, " light\xC2\xA0keeper"), 1);                // NBSP
+  EXPECT_EQ(feedAll(matcher, " li\xC2\xAD" "ght keep\xC2\xAD" "er"), 1);  // soft hyphens
+  EXPECT_EQ(feedAll(matcher, " lightkeeper"), 0);
+}
+
+TEST(TextMatcherTest, FoldsCurlyQuotes) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("don't"));
+  EXPECT_EQ(feedAll(matcher, "I don\xE2\x80\x99t know"), 1);
+}
+
+TEST(TextMatcherTest, MatchesAcrossFeedCalls) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("\xD0\x9C\xD0\xB8\xD1\x80 caf\xC3\xA9"));
+  EXPECT_EQ(feedBytewise(matcher, "xx \xD0\xBC\xD0\xB8\xD1\x80 CAF\xC3\x89 yy \xD0\x9C\xD0\x98\xD0\xA0 caf\xC3\xA9"), 2);
+
+  // Word-at-a-time feeding, as the search engine does for laid-out pages
+  matcher.reset();
+  ASSERT_TRUE(matcher.setPattern("quiet harbour"));
+  int found = 0;
+  for (const char* word : {"The", "quiet", "harbour", "was", "Quiet", "Harbour."}) {
+    found += matcher.feed(word, std::strlen(word));
+    found += matcher.feedSpace();
+  }
+  EXPECT_EQ(found, 2);
+}
+
+TEST(TextMatcherTest, MatchesDoNotOverlap) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("aa"));
+  EXPECT_EQ(feedAll(matcher, "aaaaa"), 2);
+}
+
+TEST(TextMatcherTest, ResetDropsCarriedText) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("end start"));
+  EXPECT_EQ(feedAll(matcher, "the end"), 0);
+  matcher.reset();
+  EXPECT_EQ(feedAll(matcher, " start"), 0);
+}
+
+TEST(TextMatcherTest, LongInputSpansWindowRefills) {
+  TextMatcher matcher;
+  ASSERT_TRUE(matcher.setPattern("needle in"));
+  std::string text;
+  int expected = 0;
+  for (int i = 0; i < 200; i++) {
+    text += "hay hay hay ";
+    if (i % 7 == 0) {
+      text += "NEEDLE IN ";
+      expected++;
+    }
+  }
+  EXPECT_EQ(feedAll(matcher, text), expected);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// Host stand-in for the Arduino core's millis(), which paces BookTextSearch::step
+
+#include <chrono>
+
+inline unsigned long millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+// Host stand-in for lib/Epub/Epub.h: a book held in memory as one XHTML string per
+// spine item, with the calls BookTextSearch makes.
+
+#include <Print.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Epub {
+ public:
+  struct SpineItem {
+    std::string href;
+  };
+
+  // Bytes per write() when streaming an item; 0 keeps the caller's chunk size
+  size_t streamChunk = 0;
+  // Items streamed so far, i.e. chapters scanned without a section or html/ cache
+  mutable int itemsStreamed = 0;
+
+  Epub(std::string cachePath, std::vector<std::string> chapters)
+      : cachePath(std::move(cachePath)), chapters(std::move(chapters)) {}
+
+  const std::string& getCachePath() const { return cachePath; }
+  int getSpineItemsCount() const { return static_cast<int>(chapters.size()); }
+  SpineItem getSpineItem(const int spineIndex) const { return {"chapter" + std::to_string(spineIndex) + ".xhtml"}; }
+
+  bool getItemSize(const std::string& itemHref, size_t* size) const {
+    const std::string* item = find(itemHref);
+    if (!item) return false;
+    *size = item->size();
+    return true;
+  }
+
+  bool readItemContentsToStream(const std::string& itemHref, Print& out, const size_t chunkSize) const {
+    const std::string* item = find(itemHref);
+    if (!item) return false;
+    itemsStreamed++;
+    const size_t chunk = streamChunk > 0 ? streamChunk : chunkSize;
+    for (size_t pos = 0; pos < item->size(); pos += chunk) {
+      const size_t len = std::min(chunk, item->size() - pos);
+      out.write(reinterpret_cast<const uint8_t*>(item->data() + pos), len);
+    }
+    return true;
+  }
+
+ private:
+  std::string cachePath;
+  std::vector<std::string> chapters;
+
+  const std::string* find(const std::string& itemHref) const {
+    for (int i = 0; i < getSpineItemsCount(); i++) {
+      if (getSpineItem(i).href == itemHref) return &chapters[i];
+    }
+    return nullptr;
+  }
+};
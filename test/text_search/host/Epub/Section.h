@@ -0,0 +1,40 @@
+#pragma once
+
+// Host stand-in for lib/Epub/Epub/Section.h: a chapter's laid-out pages held in
+// memory. The test's SectionLoader fills them in, where the device reads the
+// section file.
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Epub/Page.h"
+
+class Epub;
+class GfxRenderer;
+
+class Section {
+ public:
+  const int spineIndex;
+  uint16_t pageCount = 0;
+  bool partial = false;
+  std::vector<std::unique_ptr<Page>> pages;
+
+  Section(const std::shared_ptr<Epub>&, const int spineIndex, GfxRenderer&) : spineIndex(spineIndex) {}
+
+  bool isPartial() const { return partial; }
+
+  // Same contract as the device's: pages [first, first + count) in order, stopping
+  // early when fn returns false. Returns the number of pages read.
+  int forEachPage(const int first, const int count, const std::function<bool(int, const Page&)>& fn) const {
+    const int end = std::min({first + count, static_cast<int>(pageCount), static_cast<int>(pages.size())});
+    int read = 0;
+    for (int page = std::max(first, 0); page < end; page++) {
+      read++;
+      if (!fn(page, *pages[page])) break;
+    }
+    return read;
+  }
+};
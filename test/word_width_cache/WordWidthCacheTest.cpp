@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "Epub/WordWidthCache.h"
+
+namespace {
+
+constexpr int kFont = 7;
+constexpr uint8_t kRegular = 0;
+constexpr uint8_t kBold = 1;
+
+bool lookup(WordWidthCache& cache, const int fontId, const uint8_t style, const std::string& word, uint16_t& width) {
+  return cache.lookup(fontId, style, word.data(), word.size(), width);
+}
+
+void store(WordWidthCache& cache, const int fontId, const uint8_t style, const std::string& word,
+           const uint16_t width) {
+  cache.store(fontId, style, word.data(), word.size(), width);
+}
+
+std::string numberedWord(const int i) {
+  std::string word = std::to_string(i);
+  word.push_back('w');
+  return word;
+}
+
+}  // namespace
+
+TEST(WordWidthCacheTest, MissThenHit) {
+  WordWidthCache cache;
+  uint16_t width = 0;
+  EXPECT_FALSE(lookup(cache, kFont, kRegular, "the", width));
+  store(cache, kFont, kRegular, "the", 21);
+
+  EXPECT_TRUE(lookup(cache, kFont, kRegular, "the", width));
+  EXPECT_EQ(width, 21);
+  EXPECT_EQ(cache.getStats().hits, 1u);
+  EXPECT_EQ(cache.getStats().misses, 1u);
+}
+
+TEST(WordWidthCacheTest, StyleIsPartOfTheKey) {
+  WordWidthCache cache;
+  store(cache, kFont, kRegular, "said", 30);
+
+  uint16_t width = 0;
+  EXPECT_FALSE(lookup(cache, kFont, kBold, "said", width));
+  store(cache, kFont, kBold, "said", 33);
+  ASSERT_TRUE(lookup(cache, kFont, kRegular, "said", width));
+  EXPECT_EQ(width, 30);
+  ASSERT_TRUE(lookup(cache, kFont, kBold, "said", width));
+  EXPECT_EQ(width, 33);
+}
+
+TEST(WordWidthCacheTest, PrefixIsADifferentWord) {
+  WordWidthCache cache;
+  store(cache, kFont, kRegular, "and", 25);
+
+  uint16_t width = 0;
+  EXPECT_FALSE(lookup(cache, kFont, kRegular, "an", width));
+  EXPECT_FALSE(lookup(cache, kFont, kRegular, "andy", width));
+}
+
+TEST(WordWidthCacheTest, SameLengthHashCollisionIsAMiss) {
+  // "declinate" and "macallums" collide under 32-bit FNV-1a
+  WordWidthCache cache;
+  uint16_t width = 0;
+  store(cache, kFont, kRegular, "declinate", 61);
+  EXPECT_FALSE(lookup(cache, kFont, kRegular, "macallums", width));
+  store(cache, kFont, kRegular, "macallums", 74);
+  EXPECT_TRUE(lookup(cache, kFont, kRegular, "declinate", width));
+  EXPECT_EQ(width, 61);
+  EXPECT_TRUE(lookup(cache, kFont, kRegular, "macallums", width));
+  EXPECT_EQ(width, 74);
+}
+
+TEST(WordWidthCacheTest, FontChangeDropsEntries) {
+  WordWidthCache cache;
+  store(cache, kFont, kRegular, "the", 21);
+
+  uint16_t width = 0;
+  EXPECT_FALSE(lookup(cache, kFont + 1, kRegular, "the", width));
+  // Switching back doesn't resurrect the old font's widths
+  EXPECT_FALSE(lookup(cache, kFont, kRegular, "the", width));
+}
+
+TEST(WordWidthCacheTest, EmptyAndOverlongWordsBypass) {
+  WordWidthCache cache;
+  const std::string longWord(WordWidthCache::MAX_WORD_BYTES + 1, 'x');
+  store(cache, kFont, kRegular, "", 1);
+  store(cache, kFont, kRegular, longWord, 2);
+
+  uint16_t width = 0;
+  EXPECT_FALSE(lookup(cache, kFont, kRegular, "", width));
+  EXPECT_FALSE(lookup(cache, kFont, kRegular, longWord, width));
+}
+
+TEST(WordWidthCacheTest, StaysBoundedAndKeepsWorking) {
+  WordWidthCache cache;
+  // Far more unique words than slots: every store lands, older words get evicted
+  constexpr int kWords = 4 * static_cast<int>(WordWidthCache::CAPACITY);
+  for (int i = 0; i < kWords; i++) {
+    store(cache, kFont, kRegular, numberedWord(i), static_cast<uint16_t>(i));
+  }
+  EXPECT_GT(cache.getStats().evictions, 0u);
+
+  // The most recent words are still there with their own widths
+  int found = 0;
+  for (int i = kWords - 64; i < kWords; i++) {
+    uint16_t width = 0;
+    if (lookup(cache, kFont, kRegular, numberedWord(i), width)) {
+      EXPECT_EQ(width, static_cast<uint16_t>(i));
+      found++;
+    }
+  }
+  EXPECT_GT(found, 48);
+}